@@ -1,6 +1,22 @@
 
 #include "fs.h"
 
+// The block cache holds at most bc_capacity blocks (besides the boot and
+// super blocks, which stay put).  bc_blocks lists the blocks we've read
+// in, and bc_hand is the hand of the CLOCK that picks which one to
+// evict: blocks that have been used since the hand last passed (PTE_A)
+// get a second chance.  Each block has one slot in bc_blocks, which a
+// hash table on the block number finds, from when it's first read in
+// until it's evicted or dropped.
+uint32_t bc_capacity = BC_CAPACITY;
+static uint32_t bc_blocks[BC_MAX_CAPACITY];
+uint32_t bc_nblocks;
+static uint32_t bc_hand;
+#define BC_NHASH	BC_MAX_CAPACITY		// power of 2
+static int32_t bc_hash[BC_NHASH];		// first slot in each bucket, + 1
+static int32_t bc_hash_next[BC_MAX_CAPACITY];	// next slot in the bucket, + 1
+struct Fsret_bcstat bc_stats;
+
 // Return the virtual address of this disk block.
 void*
 diskaddr(uint32_t blockno)
@@ -10,9 +26,380 @@ diskaddr(uint32_t blockno)
 	return (char*) (DISKMAP + blockno * BLKSIZE);
 }
 
-// Fault any disk block that is read in to memory by
-// loading it from disk.
+// Is this virtual address mapped?
+bool
+va_is_mapped(void *va)
+{
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+}
+
+// Is this virtual address dirty?
+bool
+va_is_dirty(void *va)
+{
+	return (uvpt[PGNUM(va)] & PTE_D) != 0;
+}
+
+// Has the paging library swapped this page out?  A dirty block cache
+// page can be, and then it's the paging library's to bring back: the
+// copy on disk is stale.
+static bool
+va_is_paged_out(void *va)
+{
+	mte_t *mte;
+
+	if (!umapdir)
+		return 0;
+	mte = umapdir_walk(va, 0);
+	return mte && (*mte & MTE_P);
+}
+
+// Bring the page at va back in if the paging library swapped it out.
+// Returns whether va is mapped.
+static bool
+va_page_in(void *va)
+{
+	if (va_is_paged_out(va))
+		(void) *(volatile char*) va;
+	return va_is_mapped(va);
+}
+
+// Write the block at addr back to disk if it's dirty, and mark it clean.
+void
+flush_block(void *addr)
+{
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+	int r;
+
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+		panic("flush_block of bad va %08x", addr);
+
+	addr = ROUNDDOWN(addr, PGSIZE);
+	if (!va_page_in(addr) || !va_is_dirty(addr))
+		return;
+	if ((r = ide_write(blockno*BLKSECTS, addr, BLKSECTS)) < 0)
+		panic("in flush_block, ide_write: %e", r);
+	bc_stats.ret_writebacks++;
+	if ((r = sys_page_clean(0, addr, 1)) < 0)
+		panic("in flush_block, sys_page_clean: %e", r);
+}
+
+// Return blockno's slot in bc_blocks, or -1 if it has none
+static int32_t
+bc_lookup(uint32_t blockno)
+{
+	int32_t slot;
+
+	for (slot = bc_hash[blockno & (BC_NHASH - 1)] - 1; slot >= 0;
+	     slot = bc_hash_next[slot] - 1)
+		if (bc_blocks[slot] == blockno)
+			return slot;
+	return -1;
+}
+
+// Give blockno the bc_blocks slot 'slot', which must be unused
+static void
+bc_link(uint32_t slot, uint32_t blockno)
+{
+	int32_t *head = &bc_hash[blockno & (BC_NHASH - 1)];
+
+	bc_blocks[slot] = blockno;
+	bc_hash_next[slot] = *head;
+	*head = slot + 1;
+}
+
+// Take the block in slot 'slot' out of the hash table, leaving the
+// slot unused
 static void
+bc_unlink(uint32_t slot)
+{
+	int32_t *p = &bc_hash[bc_blocks[slot] & (BC_NHASH - 1)];
+
+	while (*p != slot + 1)
+		p = &bc_hash_next[*p - 1];
+	*p = bc_hash_next[slot];
+}
+
+// Forget the block in slot 'slot', moving the last block into the slot
+static void
+bc_remove(uint32_t slot)
+{
+	uint32_t last;
+
+	bc_unlink(slot);
+	if (slot != (last = --bc_nblocks)) {
+		bc_unlink(last);
+		bc_link(slot, bc_blocks[last]);
+	}
+}
+
+// Make room in the block cache by evicting a block, chosen by the
+// CLOCK algorithm.  Returns the bc_blocks slot that was freed up; the
+// block is still in it, for the caller to unlink or remove.
+static uint32_t
+bc_evict(void)
+{
+	void *addr;
+	int r;
+
+	for (;; bc_hand++) {
+		if (bc_hand >= bc_nblocks)
+			bc_hand = 0;
+		addr = (void*) (DISKMAP + bc_blocks[bc_hand] * BLKSIZE);
+
+		// The paging library may already have dropped it for us.
+		if (!va_page_in(addr))
+			break;
+
+		// Used since we last came by?  Clear PTE_A (remapping the
+		// page does that) and give it a second chance.
+		if (uvpt[PGNUM(addr)] & PTE_A) {
+			flush_block(addr);
+			if ((uvpt[PGNUM(addr)] & PTE_A) &&
+			    (r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0)
+				panic("in bc_evict, sys_page_map: %e", r);
+			continue;
+		}
+
+		flush_block(addr);
+		if ((r = sys_page_unmap(0, addr)) < 0)
+			panic("in bc_evict, sys_page_unmap: %e", r);
+		bc_stats.ret_evictions++;
+		break;
+	}
+	return bc_hand++;
+}
+
+// Record that blockno has been read into the block cache, evicting
+// another block if the cache is full.
+static void
+bc_add(uint32_t blockno)
+{
+	uint32_t slot;
+
+	// The boot and super blocks are never evicted.  A block the
+	// paging library dropped keeps its slot while it's out.
+	if (blockno < 2 || bc_lookup(blockno) >= 0)
+		return;
+
+	if (bc_nblocks < bc_capacity) {
+		bc_link(bc_nblocks++, blockno);
+		return;
+	}
+
+	slot = bc_evict();
+	bc_unlink(slot);
+	bc_link(slot, blockno);
+}
+
+// Return the number of blocks in the block cache that are in memory,
+// as opposed to dropped by the paging library until they're next used
+uint32_t
+bc_resident(void)
+{
+	uint32_t i, n;
+
+	for (i = n = 0; i < bc_nblocks; i++)
+		if (va_is_mapped((void*) (DISKMAP + bc_blocks[i] * BLKSIZE)))
+			n++;
+	return n;
+}
+
+// Change the block cache's capacity to 'capacity' blocks, evicting
+// blocks right away if it's shrinking.
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if capacity is less than BC_MIN_CAPACITY or more than
+//		BC_MAX_CAPACITY.
+int
+bc_set_capacity(uint32_t capacity)
+{
+	if (capacity < BC_MIN_CAPACITY || capacity > BC_MAX_CAPACITY)
+		return -E_INVAL;
+	bc_capacity = capacity;
+	while (bc_nblocks > bc_capacity)
+		bc_remove(bc_evict());
+	return 0;
+}
+
+// Read the nblocks disk blocks starting at blockno into the block cache
+// ahead of time, with one disk read for each run of them that isn't
+// cached yet.  nblocks is at most BC_MAX_READAHEAD.
+int
+bc_read_ahead(uint32_t blockno, uint32_t nblocks)
+{
+	uint32_t i, j;
+	char *addr;
+	int r = 0;
+
+	if (blockno < 2 || nblocks > BC_MAX_READAHEAD
+	    || (super && blockno + nblocks > super->s_nblocks))
+		return -E_INVAL;
+	// Don't read ahead more than the cache can hold onto
+	nblocks = MIN(nblocks, bc_capacity / 2);
+
+	addr = (char*) (DISKMAP + blockno * BLKSIZE);
+	for (i = 0; i < nblocks; i = j) {
+		if (va_is_mapped(addr + i*BLKSIZE) || va_is_paged_out(addr + i*BLKSIZE)) {
+			j = i + 1;
+			continue;
+		}
+		for (j = i; j < nblocks && !va_is_mapped(addr + j*BLKSIZE)
+			     && !va_is_paged_out(addr + j*BLKSIZE); j++) {
+			bc_add(blockno + j);
+			if ((r = page_alloc(0, addr + j*BLKSIZE, PTE_P|PTE_U|PTE_W, 0)) < 0)
+				break;
+			// Touch it, setting PTE_A, so that making room for the
+			// rest of the run doesn't evict it before it's read in.
+			(void) *(volatile char*) (addr + j*BLKSIZE);
+		}
+		if (j == i)
+			return r;
+		if ((r = ide_read((blockno + i)*BLKSECTS, addr + i*BLKSIZE, (j - i)*BLKSECTS)) < 0)
+			panic("in bc_read_ahead, ide_read: %e", r);
+		// Mark them clean
+		if ((r = sys_page_clean(0, addr + i*BLKSIZE, j - i)) < 0)
+			panic("in bc_read_ahead, sys_page_clean: %e", r);
+		bc_stats.ret_readahead += j - i;
+	}
+	return 0;
+}
+
+// Write the n blocks in blocknos (which it sorts) back to disk if
+// they're dirty, and mark them clean.  Dirty blocks that are next to
+// each other on disk go out together, in one disk write.
+void
+bc_write_blocks(uint32_t *blocknos, uint32_t n)
+{
+	uint32_t i, j, k, t;
+	char *addr;
+	int r;
+
+	// Shell sort
+	for (k = n / 2; k > 0; k /= 2)
+		for (i = k; i < n; i++)
+			for (j = i; j >= k && blocknos[j - k] > blocknos[j]; j -= k) {
+				t = blocknos[j];
+				blocknos[j] = blocknos[j - k];
+				blocknos[j - k] = t;
+			}
+
+	for (i = 0; i < n; i = j) {
+		addr = (char*) (DISKMAP + blocknos[i] * BLKSIZE);
+		j = i + 1;
+		if (!va_page_in(addr) || !va_is_dirty(addr))
+			continue;
+		// Extend the run while the next block is the next one on
+		// disk, and dirty too.  Skip over duplicates.
+		for (k = 1; j < n && k < BC_MAX_WRITEBACK; j++) {
+			if (blocknos[j] == blocknos[i] + k - 1)
+				continue;
+			if (blocknos[j] != blocknos[i] + k
+			    || !va_page_in(addr + k*BLKSIZE) || !va_is_dirty(addr + k*BLKSIZE))
+				break;
+			k++;
+		}
+		if ((r = ide_write(blocknos[i]*BLKSECTS, addr, k*BLKSECTS)) < 0)
+			panic("in bc_write_blocks, ide_write: %e", r);
+		if ((r = sys_page_clean(0, addr, k)) < 0)
+			panic("in bc_write_blocks, sys_page_clean: %e", r);
+		bc_stats.ret_writebacks += k;
+	}
+}
+
+// Write every dirty block in the block cache back to disk.
+void
+bc_sync(void)
+{
+	static uint32_t blocknos[BC_MAX_CAPACITY];
+
+	memmove(blocknos, bc_blocks, bc_nblocks * sizeof(bc_blocks[0]));
+	bc_write_blocks(blocknos, bc_nblocks);
+	flush_block(diskaddr(1));
+}
+
+// Map a zeroed page for blockno, which has just been allocated, into
+// the block cache, without reading the block from disk.  The block
+// will be written back when it's flushed.
+void *
+bc_alloc_block(uint32_t blockno)
+{
+	char *addr = (char*) (DISKMAP + blockno * BLKSIZE);
+	int r;
+
+	if (va_page_in(addr))
+		sys_page_unmap(0, addr);
+	bc_add(blockno);
+	if ((r = page_alloc(0, addr, PTE_P|PTE_U|PTE_W, 0)) < 0)
+		panic("in bc_alloc_block, page_alloc: %e", r);
+	return addr;
+}
+
+// Take 'pg', a page holding the contents of blockno (a block that has
+// just been allocated), into the block cache.  The page is mapped at
+// the block's address and unmapped from pg.
+void
+bc_insert_block(uint32_t blockno, void *pg)
+{
+	char *addr = (char*) (DISKMAP + blockno * BLKSIZE);
+	int r;
+
+	// Make sure pg is in memory, and drop whatever the cache held for
+	// the block when it was last in use.
+	(void) *(volatile char*) pg;
+	if (va_page_in(addr))
+		sys_page_unmap(0, addr);
+	bc_add(blockno);
+	if ((r = sys_page_map(0, pg, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+		panic("in bc_insert_block, sys_page_map: %e", r);
+	if ((r = sys_page_unmap(0, pg)) < 0)
+		panic("in bc_insert_block, sys_page_unmap: %e", r);
+	// Touch it, setting PTE_A, so that making room for the blocks
+	// after it doesn't evict it before it's written back.
+	(void) *(volatile char*) addr;
+}
+
+// Drop blockno, which has just been freed, from the block cache
+// without writing it back.
+void
+bc_drop_block(uint32_t blockno)
+{
+	char *addr = (char*) (DISKMAP + blockno * BLKSIZE);
+	int32_t slot;
+
+	if (va_page_in(addr))
+		sys_page_unmap(0, addr);
+	if ((slot = bc_lookup(blockno)) >= 0)
+		bc_remove(slot);
+}
+
+// Make the page at addr (in the block cache, or a block waiting to be
+// allocated) ours alone, so we can write to it.  Pages we've mapped
+// into clients copy-on-write (FSREQ_READMAP, FSREQ_PAGEIN) must not
+// change under them, so a shared page is replaced by a copy.
+// Returns 0 on success, < 0 on error.
+int
+bc_make_private(void *addr)
+{
+	int r;
+
+	addr = ROUNDDOWN(addr, PGSIZE);
+	(void) *(volatile char*) addr;
+	if (pageref(addr) <= 1)
+		return 0;
+	if ((r = page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W, 0)) < 0)
+		return r;
+	memmove(PFTEMP, addr, PGSIZE);
+	if ((r = sys_page_map(0, PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+		panic("in bc_make_private, sys_page_map: %e", r);
+	if ((r = sys_page_unmap(0, PFTEMP)) < 0)
+		panic("in bc_make_private, sys_page_unmap: %e", r);
+	return 0;
+}
+
+// Fault any disk block that is read in to memory by
+// loading it from disk.  Returns 0 if the fault wasn't in the block
+// cache, so the other page fault handlers get a look at it.
+static int
 bc_pgfault(struct UTrapframe *utf)
 {
 	void *addr = (void *) utf->utf_fault_va;
@@ -21,8 +408,7 @@ bc_pgfault(struct UTrapframe *utf)
 
 	// Check that the fault was within the block cache region
 	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
-		panic("page fault in FS: eip %08x, va %08x, err %04x",
-		      utf->utf_eip, addr, utf->utf_err);
+		return 0;
 
 	// Sanity check the block number.
 	if (super && blockno >= super->s_nblocks)
@@ -35,8 +421,20 @@ bc_pgfault(struct UTrapframe *utf)
 	// LAB 5: you code here:
 
 	addr = ROUNDDOWN(addr, PGSIZE);
-	sys_page_alloc(0, addr, PTE_P|PTE_U|PTE_W); // no need to allocate more than one page, because BLKSIZE is equal to PGSIZE
-	ide_read(blockno*BLKSECTS, addr, BLKSECTS);
+	bc_add(blockno);
+
+	// no need to allocate more than one page, because BLKSIZE is equal to PGSIZE
+	// page_alloc makes room by dropping clean blocks if it has to
+	if ((r = page_alloc(0, addr, PTE_P|PTE_U|PTE_W, 0)) < 0)
+		panic("in bc_pgfault, page_alloc: %e", r);
+	if ((r = ide_read(blockno*BLKSECTS, addr, BLKSECTS)) < 0)
+		panic("in bc_pgfault, ide_read: %e", r);
+
+	// Clear the dirty bit for the disk block page since we just read the
+	// block from disk
+	if ((r = sys_page_clean(0, addr, 1)) < 0)
+		panic("in bc_pgfault, sys_page_clean: %e", r);
+	return 1;
 }
 
 
@@ -44,7 +442,11 @@ void
 bc_init(void)
 {
 	struct Super super;
-	set_pgfault_handler(bc_pgfault);
+	add_pgfault_handler(bc_pgfault);
+
+	// Clean blocks can be dropped and read back in from the disk.
+	// Not the super block, though: bc_pgfault reads it.
+	page_add_backed((void*) (DISKMAP + 2*BLKSIZE), DISKSIZE - 2*BLKSIZE);
 
 	// cache the super block by reading it once
 	memmove(&super, diskaddr(1), sizeof super);
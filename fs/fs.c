@@ -2,6 +2,8 @@
 
 #include "fs.h"
 
+static void pend_init(void);
+
 // --------------------------------------------------------------
 // Super block
 // --------------------------------------------------------------
@@ -19,6 +21,97 @@ check_super(void)
 	cprintf("superblock is good\n");
 }
 
+// --------------------------------------------------------------
+// Free block bitmap
+// --------------------------------------------------------------
+
+// Where to look for free blocks when there's nowhere better
+static uint32_t alloc_hint;
+
+// Check to see if the block bitmap indicates that block 'blockno' is free.
+// Return 1 if the block is free, 0 if not.
+bool
+block_is_free(uint32_t blockno)
+{
+	if (super == 0 || blockno >= super->s_nblocks)
+		return 0;
+	if (bitmap[blockno / 32] & (1 << (blockno % 32)))
+		return 1;
+	return 0;
+}
+
+// Mark a block free in the bitmap, and drop it from the block cache.
+void
+free_block(uint32_t blockno)
+{
+	// Blockno zero is the null pointer of block numbers.
+	if (blockno == 0)
+		panic("attempt to free zero block");
+	bitmap[blockno/32] |= 1<<(blockno%32);
+	bc_drop_block(blockno);
+}
+
+// How many blocks in a row, up to n, are free starting at blockno?
+static uint32_t
+free_run(uint32_t blockno, uint32_t n)
+{
+	uint32_t i;
+
+	for (i = 0; i < n && block_is_free(blockno + i); i++)
+		/* do nothing */;
+	return i;
+}
+
+// Allocate up to n free disk blocks in a row, searching from block
+// 'goal' on (and around to the start of the disk).  We take the first
+// run of n free blocks, or if there isn't one, the first free block and
+// as many after it as are free.  The bitmap blocks we change are only
+// written back when they're flushed.
+//
+// Return the first block allocated and set *pgot to how many there are,
+// or return -E_NO_DISK if we are out of blocks.
+static int
+alloc_blocks(uint32_t goal, uint32_t n, uint32_t *pgot)
+{
+	uint32_t i, b, len, first = 0, firstlen = 0, nblocks = super->s_nblocks;
+
+	if (goal >= nblocks)
+		goal = 0;
+	for (i = 0; i < nblocks; i += len ? len : 1) {
+		b = (goal + i) % nblocks;
+		len = free_run(b, n);
+		if (len > firstlen) {
+			first = b;
+			firstlen = len;
+		}
+		if (len == n)
+			break;
+	}
+	if (firstlen == 0)
+		return -E_NO_DISK;
+
+	for (i = 0; i < firstlen; i++)
+		bitmap[(first + i)/32] &= ~(1<<((first + i)%32));
+	alloc_hint = first + firstlen;
+	*pgot = firstlen;
+	return first;
+}
+
+// Allocate a block, and map a zeroed page for it into the block cache.
+// Return block number allocated on success,
+// -E_NO_DISK if we are out of blocks.
+int
+alloc_block(void)
+{
+	uint32_t got;
+	int r;
+
+	if ((r = alloc_blocks(alloc_hint, 1, &got)) < 0)
+		return r;
+	bc_alloc_block(r);
+	return r;
+}
+
 
 // --------------------------------------------------------------
 // File system structures
@@ -41,42 +134,357 @@ fs_init(void)
 	// Set "super" to point to the super block.
 	super = diskaddr(1);
 	check_super();
+
+	// Set "bitmap" to the beginning of the first bitmap block.
+	bitmap = diskaddr(2);
+
+	pend_init();
 }
 
-// Find the disk block number slot for the 'filebno'th block in file 'f'.
-// Set '*ppdiskbno' to point to that slot.
-// The slot will be one of the f->f_direct[] entries,
-// or an entry in the indirect block.
-// When 'alloc' is set, this function will allocate an indirect block
-// if necessary.
+// --------------------------------------------------------------
+// Extents
+// --------------------------------------------------------------
+
+// Return a pointer to the i'th extent of file 'f'.  Extents past the
+// ones in the File itself are in f's indirect block; if f doesn't have
+// one, allocate it when 'alloc' is set, and otherwise return 0.
+// Also return 0 if i is out of range.
+static struct Extent *
+file_extent(struct File *f, uint32_t i, bool alloc)
+{
+	int r;
+
+	if (i < NEXTENT)
+		return &f->f_extents[i];
+	if (i >= NEXTENT + NINDIRECT)
+		return 0;
+	if (f->f_indirect == 0) {
+		if (!alloc || (r = alloc_block()) < 0)
+			return 0;
+		f->f_indirect = r;
+	}
+	return (struct Extent*) diskaddr(f->f_indirect) + i - NEXTENT;
+}
+
+// How many extents does file 'f' have?
+static uint32_t
+file_nextents(struct File *f)
+{
+	struct Extent *e;
+	uint32_t i;
+
+	for (i = 0; (e = file_extent(f, i, 0)) && e->e_len; i++)
+		/* do nothing */;
+	return i;
+}
+
+// Get ready to change the struct File f.  The directory block it's in
+// may be mapped into clients reading the directory.
+static int
+file_make_private(struct File *f)
+{
+	if ((void*) f >= (void*) DISKMAP && (void*) f < (void*) (DISKMAP + DISKSIZE))
+		return bc_make_private(f);
+	return 0;
+}
+
+// Find the disk block that holds the 'filebno'th block of file 'f'.
+// Set '*pdiskbno' to it, or to 0 if that block of the file isn't on disk,
+// and '*prun' (if not null) to the number of blocks from there on that
+// lie one after the other on disk, or that are all missing.
+// The file's blocks are found by walking its extents: the ones in
+// f->f_extents[], then those in the indirect block.
 //
 // Returns:
-//	0 on success (but note that *ppdiskbno might equal 0).
-//	-E_NOT_FOUND if the function needed to allocate an indirect block, but
-//		alloc was 0.
-//	-E_NO_DISK if there's no space on the disk for an indirect block.
-//	-E_INVAL if filebno is out of range (it's >= NDIRECT + NINDIRECT).
+//	0 on success (but note that *pdiskbno might equal 0).
+//	-E_INVAL if filebno is out of range (it's >= MAXFILESIZE / BLKSIZE).
 //
 // Analogy: This is like pgdir_walk for files.
-// Hint: Don't forget to clear any block you allocate.
 static int
-file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool alloc)
+file_block_walk(struct File *f, uint32_t filebno, uint32_t *pdiskbno, uint32_t *prun)
 {
-	int r;
-	uint32_t *ptr;
-	char *blk;
+	struct Extent *e;
+	uint32_t i;
 
-	if (filebno < NDIRECT)
-		ptr = &f->f_direct[filebno];
-	else if (filebno < NDIRECT + NINDIRECT) {
-		if (f->f_indirect == 0) {
-			return -E_NOT_FOUND;
+	if (filebno >= MAXFILESIZE / BLKSIZE)
+		return -E_INVAL;
+
+	*pdiskbno = 0;
+	if (prun)
+		*prun = 1;
+	for (i = 0; (e = file_extent(f, i, 0)) && e->e_len; i++) {
+		if (filebno < e->e_len) {
+			if (e->e_start)
+				*pdiskbno = e->e_start + filebno;
+			if (prun)
+				*prun = e->e_len - filebno;
+			break;
 		}
-		ptr = (uint32_t*)diskaddr(f->f_indirect) + filebno - NDIRECT;
-	} else
+		filebno -= e->e_len;
+	}
+	return 0;
+}
+
+// Remove the i'th extent of file 'f', moving the ones after it down.
+static void
+file_remove_extent(struct File *f, uint32_t i)
+{
+	uint32_t n = file_nextents(f);
+
+	for (; i + 1 < n; i++)
+		*file_extent(f, i, 0) = *file_extent(f, i + 1, 0);
+	memset(file_extent(f, n - 1, 0), 0, sizeof(struct Extent));
+}
+
+// Record that blocks [filebno, filebno+n) of file 'f', which weren't
+// on disk, are now at disk blocks [diskbno, diskbno+n).  The blocks
+// must all lie in one hole, which is split up around them.  A run that
+// carries on from the extent before it is merged into that extent, so
+// a file written front to back keeps to one extent for as long as the
+// disk can give it blocks in a row.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_DISK if f would need more extents than it can have.
+//	-E_INVAL if the blocks aren't all in one hole.
+static int
+file_map_blocks(struct File *f, uint32_t filebno, uint32_t diskbno, uint32_t n)
+{
+	struct Extent *e, *prev, pieces[3];
+	uint32_t i, j, next, npieces, before, after;
+
+	for (i = 0; (e = file_extent(f, i, 0)) && e->e_len; i++) {
+		if (filebno < e->e_len)
+			break;
+		filebno -= e->e_len;
+	}
+	if (!e || e->e_len == 0 || e->e_start != 0 || filebno + n > e->e_len)
 		return -E_INVAL;
+	before = filebno;
+	after = e->e_len - filebno - n;
+
+	prev = i > 0 ? file_extent(f, i - 1, 0) : 0;
+	if (before == 0 && prev && prev->e_start
+	    && prev->e_start + prev->e_len == diskbno) {
+		prev->e_len += n;
+		if ((e->e_len -= n) == 0)
+			file_remove_extent(f, i);
+		return 0;
+	}
+
+	npieces = 0;
+	if (before)
+		pieces[npieces++] = (struct Extent) { 0, before };
+	pieces[npieces++] = (struct Extent) { diskbno, n };
+	if (after)
+		pieces[npieces++] = (struct Extent) { 0, after };
 
-	*ppdiskbno = ptr;
+	// Move the extents after this one along to make room
+	next = file_nextents(f);
+	if (npieces > 1 && !file_extent(f, next + npieces - 2, 1))
+		return -E_NO_DISK;
+	for (j = next; j-- > i + 1; )
+		*file_extent(f, j + npieces - 1, 0) = *file_extent(f, j, 0);
+	for (j = 0; j < npieces; j++)
+		*file_extent(f, i + j, 0) = pieces[j];
+	return 0;
+}
+
+// Add n blocks that aren't on disk yet to the end of file 'f'.
+// Returns 0 on success, -E_NO_DISK if f has no extents to spare.
+static int
+file_add_hole(struct File *f, uint32_t n)
+{
+	struct Extent *e;
+	uint32_t next = file_nextents(f);
+
+	if (next > 0 && (e = file_extent(f, next - 1, 0))->e_start == 0) {
+		e->e_len += n;
+		return 0;
+	}
+	if (!(e = file_extent(f, next, 1)))
+		return -E_NO_DISK;
+	e->e_start = 0;
+	e->e_len = n;
+	return 0;
+}
+
+// --------------------------------------------------------------
+// Delayed allocation
+// --------------------------------------------------------------
+
+// Blocks written to files that don't have a place on disk yet are kept
+// in pages of their own at PENDMAP, and found through a hash table
+// keyed by (file, block number).  They're given disk blocks only when
+// the file is flushed, or when NPENDING of them have piled up, so that
+// the blocks written to a file go to disk together and can be laid out
+// contiguously.
+struct Pending {
+	struct File *p_file;	// file the block belongs to, 0 if slot free
+	uint32_t p_filebno;
+	int32_t p_next;		// next slot in the hash chain, or -1
+};
+
+#define PENDADDR(i)	((char*) (PENDMAP + (i) * BLKSIZE))
+
+static struct Pending pendtab[NPENDING];
+static int32_t pend_buckets[NPENDING];
+static uint32_t npending;
+
+static void
+pend_init(void)
+{
+	memset(pend_buckets, 0xFF, sizeof(pend_buckets));
+}
+
+static uint32_t
+pend_hash(struct File *f, uint32_t filebno)
+{
+	return ((uint32_t) f / sizeof(struct File) + filebno * 31) & (NPENDING - 1);
+}
+
+// Return the pendtab slot of the filebno'th block of file 'f', or -1.
+static int32_t
+pend_lookup(struct File *f, uint32_t filebno)
+{
+	int32_t i;
+
+	for (i = pend_buckets[pend_hash(f, filebno)]; i >= 0; i = pendtab[i].p_next)
+		if (pendtab[i].p_file == f && pendtab[i].p_filebno == filebno)
+			return i;
+	return -1;
+}
+
+// Free pendtab slot i.  Its page must already be unmapped or moved.
+static void
+pend_unlink(int32_t i)
+{
+	int32_t *pi;
+
+	pi = &pend_buckets[pend_hash(pendtab[i].p_file, pendtab[i].p_filebno)];
+	while (*pi != i)
+		pi = &pendtab[*pi].p_next;
+	*pi = pendtab[i].p_next;
+	pendtab[i].p_file = 0;
+	npending--;
+}
+
+static int pend_flush_all(void);
+
+// Set aside a zeroed page for the filebno'th block of file 'f', which
+// isn't on disk, and set *blk to it.  If there are too many such
+// blocks already, flush them all first.
+// Returns 0 on success, < 0 on error.
+static int
+pend_alloc(struct File *f, uint32_t filebno, char **blk)
+{
+	static uint32_t next;
+	uint32_t h;
+	int r;
+
+	if (npending == NPENDING && (r = pend_flush_all()) < 0)
+		return r;
+	while (pendtab[next].p_file)
+		next = (next + 1) % NPENDING;
+	if ((r = page_alloc(0, PENDADDR(next), PTE_P|PTE_U|PTE_W, 0)) < 0)
+		return r;
+
+	h = pend_hash(f, filebno);
+	pendtab[next].p_file = f;
+	pendtab[next].p_filebno = filebno;
+	pendtab[next].p_next = pend_buckets[h];
+	pend_buckets[h] = next;
+	npending++;
+	*blk = PENDADDR(next);
+	return 0;
+}
+
+// Throw away the blocks of file 'f' from block filebno on that are
+// waiting for a place on disk.
+static void
+pend_truncate(struct File *f, uint32_t filebno)
+{
+	int32_t i;
+
+	for (i = 0; i < NPENDING && npending > 0; i++)
+		if (pendtab[i].p_file == f && pendtab[i].p_filebno >= filebno) {
+			// Bring it back first if it was paged out, so the
+			// paging library lets go of it too.
+			(void) *(volatile char*) PENDADDR(i);
+			sys_page_unmap(0, PENDADDR(i));
+			pend_unlink(i);
+		}
+}
+
+// Give the blocks of file 'f' that are waiting for a place on disk
+// one, and write them there.  Each run of consecutive file blocks gets
+// consecutive disk blocks if the disk has them, right after the file's
+// previous block if that's free, and goes out in one disk write.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_DISK if the disk is full, or f has run out of extents.
+static int
+file_flush_pending(struct File *f)
+{
+	static int32_t slots[NPENDING];
+	static uint32_t blocknos[BC_MAX_WRITEBACK];
+	uint32_t i, j, k, n, t, filebno, goal, start, got;
+	int r;
+
+	for (i = n = 0; i < NPENDING; i++)
+		if (pendtab[i].p_file == f)
+			slots[n++] = i;
+	if (n == 0)
+		return 0;
+	if ((r = file_make_private(f)) < 0)
+		return r;
+
+	// Shell sort by file block number
+	for (k = n / 2; k > 0; k /= 2)
+		for (i = k; i < n; i++)
+			for (j = i; j >= k && pendtab[slots[j - k]].p_filebno > pendtab[slots[j]].p_filebno; j -= k) {
+				t = slots[j];
+				slots[j] = slots[j - k];
+				slots[j - k] = t;
+			}
+
+	for (i = 0; i < n; i += got) {
+		filebno = pendtab[slots[i]].p_filebno;
+		for (k = 1; i + k < n && k < BC_MAX_WRITEBACK
+			     && pendtab[slots[i + k]].p_filebno == filebno + k; k++)
+			/* do nothing */;
+
+		goal = alloc_hint;
+		if (filebno > 0 && file_block_walk(f, filebno - 1, &t, 0) == 0 && t)
+			goal = t + 1;
+		if ((r = alloc_blocks(goal, k, &got)) < 0)
+			return r;
+		start = r;
+		if ((r = file_map_blocks(f, filebno, start, got)) < 0) {
+			for (j = 0; j < got; j++)
+				bitmap[(start + j)/32] |= 1<<((start + j)%32);
+			return r;
+		}
+		for (j = 0; j < got; j++) {
+			bc_insert_block(start + j, PENDADDR(slots[i + j]));
+			pend_unlink(slots[i + j]);
+			blocknos[j] = start + j;
+		}
+		bc_write_blocks(blocknos, got);
+	}
+	return 0;
+}
+
+// Flush every block waiting for a place on disk.
+// Returns 0 on success, < 0 on error.
+static int
+pend_flush_all(void)
+{
+	uint32_t i;
+	int r;
+
+	for (i = 0; i < NPENDING && npending > 0; i++)
+		if (pendtab[i].p_file && (r = file_flush_pending(pendtab[i].p_file)) < 0)
+			return r;
 	return 0;
 }
 
@@ -84,25 +492,322 @@ file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool all
 // block of file 'f' would be mapped.
 //
 // Returns 0 on success, < 0 on error.  Errors are:
-//	-E_NO_DISK if a block needed to be allocated but the disk is full.
+//	-E_NOT_FOUND if the block hasn't been written.
 //	-E_INVAL if filebno is out of range.
 //
 int
 file_get_block(struct File *f, uint32_t filebno, char **blk)
 {
 	int r;
-	uint32_t *ptr;
+	int32_t i;
+	uint32_t diskbno;
 
-	if ((r = file_block_walk(f, filebno, &ptr, 1)) < 0)
+	if ((r = file_block_walk(f, filebno, &diskbno, 0)) < 0)
 		return r;
-	if (*ptr == 0) {
+	if (diskbno) {
+		*blk = diskaddr(diskbno);
+		return 0;
+	}
+	if ((i = pend_lookup(f, filebno)) < 0)
 		return -E_NOT_FOUND;
+	*blk = PENDADDR(i);
+	return 0;
+}
+
+// Like file_get_block, but for up to n blocks from the filebno'th on:
+// set *blk to the address of the first, and return how many of them
+// (at least 1) lie one after the other in memory, all read in.
+// Returns < 0 on error, as file_get_block does.
+int
+file_get_blocks(struct File *f, uint32_t filebno, uint32_t n, char **blk)
+{
+	int r;
+	uint32_t i, diskbno, run;
+
+	if ((r = file_get_block(f, filebno, blk)) < 0)
+		return r;
+	if (n <= 1 || file_block_walk(f, filebno, &diskbno, &run) < 0 || diskbno == 0)
+		return 1;
+	n = MIN(n, run);
+	for (i = 0; i < n; i++)
+		(void) *(volatile char*) (*blk + i*BLKSIZE);
+	return n;
+}
+
+// Like file_get_block, but get the block ready to be written, setting
+// it aside if it hasn't been written before.  Directories' blocks get a
+// place on disk right away instead: open files and the directory index
+// point into them, so they can't move later.
+static int
+file_get_block_for_write(struct File *f, uint32_t filebno, char **blk)
+{
+	int r, r2;
+	int32_t i;
+	uint32_t diskbno;
+
+	if ((r = file_block_walk(f, filebno, &diskbno, 0)) < 0)
+		return r;
+	if (diskbno == 0 && f->f_type == FTYPE_DIR) {
+		if ((r = alloc_block()) < 0)
+			return r;
+		if ((r2 = file_map_blocks(f, filebno, r, 1)) < 0) {
+			free_block(r);
+			return r2;
+		}
+		diskbno = r;
 	}
-	*blk = diskaddr(*ptr);
+
+	if (diskbno)
+		*blk = diskaddr(diskbno);
+	else if ((i = pend_lookup(f, filebno)) >= 0)
+		*blk = PENDADDR(i);
+	else
+		return pend_alloc(f, filebno, blk);
+	return bc_make_private(*blk);
+}
+
+// Is the filebno'th block of file 'f' in the block cache?
+bool
+file_block_is_cached(struct File *f, uint32_t filebno)
+{
+	uint32_t diskbno;
+
+	if (file_block_walk(f, filebno, &diskbno, 0) < 0 || diskbno == 0)
+		return 0;
+	return va_is_mapped((void*) (DISKMAP + diskbno * BLKSIZE));
+}
+
+// Count a client's read of 'count' bytes of file 'f' from 'offset' in
+// the block cache statistics: a hit for each block that's in memory
+// already, and a miss for each one that will have to be read in from
+// disk.  Blocks that have no place on disk yet don't count.
+void
+file_count_reads(struct File *f, off_t offset, size_t count)
+{
+	uint32_t filebno, end, diskbno;
+
+	if (offset >= f->f_size || count == 0)
+		return;
+	end = ROUNDUP(MIN(offset + count, f->f_size), BLKSIZE) / BLKSIZE;
+	for (filebno = offset / BLKSIZE; filebno < end; filebno++) {
+		if (file_block_walk(f, filebno, &diskbno, 0) < 0 || diskbno == 0)
+			continue;
+		if (va_is_mapped((void*) (DISKMAP + diskbno * BLKSIZE)))
+			bc_stats.ret_hits++;
+		else
+			bc_stats.ret_misses++;
+	}
+}
+
+// Read blocks [filebno, filebno+nblocks) of file 'f' (those that exist)
+// into the block cache ahead of time.  Each run of blocks that are next
+// to each other on disk is read in with one transfer.
+void
+file_readahead(struct File *f, uint32_t filebno, uint32_t nblocks)
+{
+	uint32_t diskbno, run, end;
+
+	end = MIN(filebno + nblocks, ROUNDUP(f->f_size, BLKSIZE) / BLKSIZE);
+	while (filebno < end) {
+		if (file_block_walk(f, filebno, &diskbno, &run) < 0 || diskbno == 0)
+			break;
+		run = MIN(MIN(run, end - filebno), BC_MAX_READAHEAD);
+		bc_read_ahead(diskbno, run);
+		filebno += run;
+	}
+}
+
+// --------------------------------------------------------------
+// Directory index
+// --------------------------------------------------------------
+
+// An in-memory hash table of directory entries, keyed by (dir, name),
+// so looking up a path component doesn't have to scan the whole
+// directory.  A directory is indexed, all at once, the first time
+// something is looked up in it.  Entries point at the struct Files in
+// the block cache, whose addresses never change.  Creating a file adds
+// it to the index, and removing one just empties its name, which
+// lookups check.  Removing or truncating a directory evicts it from the
+// index, since its entries point into blocks that are being freed, and
+// a directory created later in the same struct File must not look
+// indexed already.
+#define DIRHASH_NBUCKETS	1024	// power of 2
+#define DIRHASH_NENTRIES	8192
+#define DIRHASH_NDIRS		256	// power of 2
+
+struct Dirhash_entry {
+	struct File *dh_dir;
+	struct File *dh_file;
+	uint32_t dh_hash;
+	int32_t dh_next;	// next entry in the bucket, or -1
+};
+
+static struct Dirhash_entry dirhash_entries[DIRHASH_NENTRIES];
+static uint32_t dirhash_nentries;
+static int32_t dirhash_buckets[DIRHASH_NBUCKETS];
+static struct File *dirhash_dirs[DIRHASH_NDIRS];	// indexed directories
+static uint32_t dirhash_ndirs;
+static bool dirhash_ready;
+
+static uint32_t
+dirhash(struct File *dir, const char *name)
+{
+	uint32_t h = (uint32_t) dir;
+
+	while (*name)
+		h = h * 33 + (uint8_t) *name++;
+	return h;
+}
+
+static void
+dirhash_init(void)
+{
+	memset(dirhash_buckets, 0xFF, sizeof(dirhash_buckets));
+	dirhash_ready = 1;
+}
+
+// Find the dirhash_dirs slot for dir: the one holding it, or the empty
+// one it would go in.
+static struct File **
+dirhash_dir_slot(struct File *dir)
+{
+	uint32_t i = ((uint32_t) dir / sizeof(struct File)) & (DIRHASH_NDIRS - 1);
+
+	while (dirhash_dirs[i] && dirhash_dirs[i] != dir)
+		i = (i + 1) & (DIRHASH_NDIRS - 1);
+	return &dirhash_dirs[i];
+}
+
+// Add all the entries of dir to the index.
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NO_MEM if the index is full; dir is left unindexed.
+static int
+dirhash_index(struct File *dir)
+{
+	int r;
+	uint32_t i, j, h, nblock, start;
+	struct File **slot;
+	struct Dirhash_entry *e;
+	char *blk;
+	struct File *f;
+
+	nblock = dir->f_size / BLKSIZE;
+	slot = dirhash_dir_slot(dir);
+	if (dirhash_ndirs + 1 >= DIRHASH_NDIRS
+	    || dirhash_nentries + nblock * BLKFILES > DIRHASH_NENTRIES)
+		return -E_NO_MEM;
+
+	start = dirhash_nentries;
+	for (i = 0; i < nblock; i++) {
+		if ((r = file_get_block(dir, i, &blk)) < 0) {
+			// Take back what we added, newest first
+			while (dirhash_nentries > start) {
+				e = &dirhash_entries[--dirhash_nentries];
+				dirhash_buckets[e->dh_hash & (DIRHASH_NBUCKETS - 1)] = e->dh_next;
+			}
+			return r;
+		}
+		f = (struct File*) blk;
+		for (j = 0; j < BLKFILES; j++) {
+			if (f[j].f_name[0] == '\0')
+				continue;
+			h = dirhash(dir, f[j].f_name);
+			e = &dirhash_entries[dirhash_nentries];
+			e->dh_dir = dir;
+			e->dh_file = &f[j];
+			e->dh_hash = h;
+			e->dh_next = dirhash_buckets[h & (DIRHASH_NBUCKETS - 1)];
+			dirhash_buckets[h & (DIRHASH_NBUCKETS - 1)] = dirhash_nentries++;
+		}
+	}
+	*slot = dir;
+	dirhash_ndirs++;
 	return 0;
 }
 
+// Take dir and all its entries out of the index.
+static void
+dirhash_evict(struct File *dir)
+{
+	struct File **slot, *moved;
+	int32_t *ip;
+	uint32_t b, i;
+
+	if (!dirhash_ready || !*(slot = dirhash_dir_slot(dir)))
+		return;
+	for (b = 0; b < DIRHASH_NBUCKETS; b++)
+		for (ip = &dirhash_buckets[b]; *ip >= 0; )
+			if (dirhash_entries[*ip].dh_dir == dir)
+				*ip = dirhash_entries[*ip].dh_next;
+			else
+				ip = &dirhash_entries[*ip].dh_next;
+
+	// Empty dir's slot, then put the directories after it in the same
+	// run back, since they may have been pushed past it
+	*slot = NULL;
+	dirhash_ndirs--;
+	for (i = (slot - dirhash_dirs + 1) & (DIRHASH_NDIRS - 1);
+	     (moved = dirhash_dirs[i]) != NULL; i = (i + 1) & (DIRHASH_NDIRS - 1)) {
+		dirhash_dirs[i] = NULL;
+		*dirhash_dir_slot(moved) = moved;
+	}
+}
+
+// Look name up in the index of dir, indexing dir first if need be.
+// Returns 0 and sets *file on success, < 0 on error.  Errors are:
+//	-E_NOT_FOUND if the file is not found
+//	-E_NO_MEM if dir isn't indexed and there's no room to index it.
+static int
+dirhash_lookup(struct File *dir, const char *name, struct File **file)
+{
+	int r;
+	int32_t i;
+	uint32_t h;
+
+	if (!dirhash_ready)
+		dirhash_init();
+	if (!*dirhash_dir_slot(dir) && (r = dirhash_index(dir)) < 0)
+		return r;
+
+	h = dirhash(dir, name);
+	for (i = dirhash_buckets[h & (DIRHASH_NBUCKETS - 1)]; i >= 0; i = dirhash_entries[i].dh_next)
+		if (dirhash_entries[i].dh_hash == h && dirhash_entries[i].dh_dir == dir
+		    && strcmp(dirhash_entries[i].dh_file->f_name, name) == 0) {
+			*file = dirhash_entries[i].dh_file;
+			return 0;
+		}
+	return -E_NOT_FOUND;
+}
+
+// Add f, which has just been created in dir, to the index if dir is
+// indexed.  If there's no room, throw the whole index away; it gets
+// built again as lookups need it.
+static void
+dirhash_add(struct File *dir, struct File *f)
+{
+	uint32_t h;
+	struct Dirhash_entry *e;
+
+	if (!dirhash_ready || !*dirhash_dir_slot(dir))
+		return;
+	if (dirhash_nentries == DIRHASH_NENTRIES) {
+		memset(dirhash_dirs, 0, sizeof(dirhash_dirs));
+		dirhash_ndirs = dirhash_nentries = 0;
+		dirhash_init();
+		return;
+	}
+
+	h = dirhash(dir, f->f_name);
+	e = &dirhash_entries[dirhash_nentries];
+	e->dh_dir = dir;
+	e->dh_file = f;
+	e->dh_hash = h;
+	e->dh_next = dirhash_buckets[h & (DIRHASH_NBUCKETS - 1)];
+	dirhash_buckets[h & (DIRHASH_NBUCKETS - 1)] = dirhash_nentries++;
+}
+
 // Try to find a file named "name" in dir.  If so, set *file to it.
+// Uses the directory index if it can, or else scans the directory.
 //
 // Returns 0 and sets *file on success, < 0 on error.  Errors are:
 //	-E_NOT_FOUND if the file is not found
@@ -114,10 +819,14 @@ dir_lookup(struct File *dir, const char *name, struct File **file)
 	char *blk;
 	struct File *f;
 
-	// Search dir for name.
 	// We maintain the invariant that the size of a directory-file
 	// is always a multiple of the file system's block size.
 	assert((dir->f_size % BLKSIZE) == 0);
+
+	if (name[0] != '\0' && (r = dirhash_lookup(dir, name, file)) != -E_NO_MEM)
+		return r;
+
+	// Search dir for name.
 	nblock = dir->f_size / BLKSIZE;
 	for (i = 0; i < nblock; i++) {
 		if ((r = file_get_block(dir, i, &blk)) < 0)
@@ -133,6 +842,41 @@ dir_lookup(struct File *dir, const char *name, struct File **file)
 }
 
 
+// Set *file to point at a free File structure in dir.  The caller is
+// responsible for filling in the File fields.
+static int
+dir_alloc_file(struct File *dir, struct File **file)
+{
+	int r;
+	uint32_t nblock, i, j;
+	char *blk;
+	struct File *f;
+
+	assert((dir->f_size % BLKSIZE) == 0);
+	nblock = dir->f_size / BLKSIZE;
+	for (i = 0; i < nblock; i++) {
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+			return r;
+		f = (struct File*) blk;
+		for (j = 0; j < BLKFILES; j++)
+			if (f[j].f_name[0] == '\0') {
+				if ((r = bc_make_private(&f[j])) < 0)
+					return r;
+				*file = &f[j];
+				return 0;
+			}
+	}
+	if ((r = file_set_size(dir, dir->f_size + BLKSIZE)) < 0)
+		return r;
+	if ((r = file_get_block_for_write(dir, i, &blk)) < 0) {
+		file_set_size(dir, dir->f_size - BLKSIZE);
+		return r;
+	}
+	f = (struct File*) blk;
+	*file = &f[0];
+	return 0;
+}
+
 // Skip over slashes.
 static const char*
 skip_slash(const char *p)
@@ -203,6 +947,29 @@ walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem
 // --------------------------------------------------------------
 
 
+// Create "path".  On success set *pf to point at the file and return 0.
+// On error return < 0.
+int
+file_create(const char *path, struct File **pf)
+{
+	char name[MAXNAMELEN];
+	int r;
+	struct File *dir, *f;
+
+	if ((r = walk_path(path, &dir, &f, name)) == 0)
+		return -E_FILE_EXISTS;
+	if (r != -E_NOT_FOUND || dir == 0)
+		return r;
+	if ((r = dir_alloc_file(dir, &f)) < 0)
+		return r;
+
+	memset(f, 0, sizeof(*f));
+	strcpy(f->f_name, name);
+	dirhash_add(dir, f);
+	*pf = f;
+	return 0;
+}
+
 // Open "path".  On success set *pf to point at the file and return 0.
 // On error return < 0.
 int
@@ -227,10 +994,44 @@ file_read(struct File *f, void *buf, size_t count, off_t offset)
 	count = MIN(count, f->f_size - offset);
 
 	for (pos = offset; pos < offset + count; ) {
-		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+		// Blocks that have never been written read as zeros
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) == -E_NOT_FOUND)
+			memset(buf, 0, bn);
+		else if (r < 0)
+			return r;
+		else
+			memmove(buf, blk + pos % BLKSIZE, bn);
+		pos += bn;
+		buf += bn;
+	}
+
+	return count;
+}
+
+
+// Write count bytes from buf into f, starting at seek position
+// offset.  This is meant to mimic the standard pwrite function.
+// Extends the file if necessary.  The data stays in memory until the
+// file is flushed or its blocks are evicted.
+// Returns the number of bytes written, < 0 on error.
+int
+file_write(struct File *f, const void *buf, size_t count, off_t offset)
+{
+	int r, bn;
+	off_t pos;
+	char *blk;
+
+	// Extend file if necessary
+	if (offset + count > f->f_size)
+		if ((r = file_set_size(f, offset + count)) < 0)
+			return r;
+
+	for (pos = offset; pos < offset + count; ) {
+		if ((r = file_get_block_for_write(f, pos / BLKSIZE, &blk)) < 0)
 			return r;
 		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
-		memmove(buf, blk + pos % BLKSIZE, bn);
+		memmove(blk + pos % BLKSIZE, buf, bn);
 		pos += bn;
 		buf += bn;
 	}
@@ -238,5 +1039,110 @@ file_read(struct File *f, void *buf, size_t count, off_t offset)
 	return count;
 }
 
+// Cut file 'f' down to its first nblocks blocks: free the disk blocks
+// of the rest, and throw away those that are waiting for one.
+static void
+file_truncate_blocks(struct File *f, uint32_t nblocks)
+{
+	struct Extent *e;
+	uint32_t i, j, n, pos, keep;
+
+	n = file_nextents(f);
+	for (i = pos = 0; i < n; i++) {
+		e = file_extent(f, i, 0);
+		keep = pos < nblocks ? MIN(e->e_len, nblocks - pos) : 0;
+		pos += e->e_len;
+		if (e->e_start)
+			for (j = keep; j < e->e_len; j++)
+				free_block(e->e_start + j);
+		if (keep == 0)
+			e->e_start = 0;
+		e->e_len = keep;
+	}
+	if (f->f_indirect && file_nextents(f) <= NEXTENT) {
+		free_block(f->f_indirect);
+		f->f_indirect = 0;
+	}
+	pend_truncate(f, nblocks);
+}
+
+// Set the size of file f, truncating or extending as necessary.
+// New blocks at the end aren't given a place on disk until they're
+// written and flushed.
+int
+file_set_size(struct File *f, off_t newsize)
+{
+	uint32_t oldn, newn;
+	char *blk;
+	int r;
+
+	if (newsize < 0 || newsize > MAXFILESIZE)
+		return -E_INVAL;
+	if ((r = file_make_private(f)) < 0)
+		return r;
+
+	oldn = ROUNDUP(f->f_size, BLKSIZE) / BLKSIZE;
+	newn = ROUNDUP(newsize, BLKSIZE) / BLKSIZE;
+	if (f->f_type == FTYPE_DIR && newsize < f->f_size)
+		dirhash_evict(f);
+	if (newn < oldn)
+		file_truncate_blocks(f, newn);
+	else if (newn > oldn && (r = file_add_hole(f, newn - oldn)) < 0)
+		return r;
+
+	// Zero what's left of the last block past the end, so that it
+	// reads as zeros if the file grows again.
+	if (newsize < f->f_size && newsize % BLKSIZE
+	    && file_get_block(f, newsize / BLKSIZE, &blk) == 0
+	    && bc_make_private(blk) == 0)
+		memset(blk + newsize % BLKSIZE, 0, BLKSIZE - newsize % BLKSIZE);
+
+	f->f_size = newsize;
+	return 0;
+}
+
+// Flush the contents of file f out to disk.  Blocks waiting for a
+// place on disk get one, and then every dirty block in the cache is
+// written back, in order, in as few disk writes as it takes.
+int
+file_flush(struct File *f)
+{
+	int r;
+
+	if ((r = file_flush_pending(f)) < 0)
+		return r;
+	bc_sync();
+	return 0;
+}
+
+// Remove a file by truncating it and then zeroing the name.
+int
+file_remove(const char *path)
+{
+	int r;
+	struct File *f;
+
+	if ((r = walk_path(path, 0, &f, 0)) < 0)
+		return r;
+	if ((r = file_set_size(f, 0)) < 0)
+		return r;
+	if (f->f_type == FTYPE_DIR)
+		dirhash_evict(f);
+	f->f_name[0] = '\0';
+	return 0;
+}
+
+// Sync the entire file system.  A big hammer.
+int
+fs_sync(void)
+{
+	int r;
+
+	if ((r = pend_flush_all()) < 0)
+		return r;
+	bc_sync();
+	return 0;
+}
+
 
 
@@ -11,11 +11,30 @@
 /* Maximum disk size we can handle (3GB) */
 #define DISKSIZE	0xC0000000
 
+/* Default and maximum number of blocks in the block cache */
+#define BC_CAPACITY	1024
+#define BC_MAX_CAPACITY	8192
+
+/* Most blocks read ahead at once: one ide_read of 256 sectors */
+#define BC_MAX_READAHEAD	(256 / BLKSECTS)
+/* Most blocks written back at once: one ide_write of 256 sectors */
+#define BC_MAX_WRITEBACK	(256 / BLKSECTS)
+/* Fewest blocks the block cache may be limited to: enough for a full
+ * read-ahead in half of it, and for any one instruction's blocks */
+#define BC_MIN_CAPACITY	(2 * BC_MAX_READAHEAD)
+
+/* Blocks that have been written but not yet given a place on disk
+ * (delayed allocation) are kept at PENDMAP + (n*BLKSIZE), n < NPENDING,
+ * until they're flushed. */
+#define PENDMAP		0xE0000000
+#define NPENDING	256	// power of 2
+
 struct Super *super;		// superblock
 uint32_t *bitmap;		// bitmap blocks mapped in memory
 
 /* ide.c */
 bool	ide_probe_disk1(void);
+bool	ide_probe_disk(int d);
 void	ide_set_disk(int diskno);
 int	ide_read(uint32_t secno, void *dst, size_t nsecs);
 int	ide_write(uint32_t secno, const void *src, size_t nsecs);
@@ -26,22 +45,38 @@ bool	va_is_mapped(void *va);
 bool	va_is_dirty(void *va);
 void	flush_block(void *addr);
 void	bc_init(void);
+int	bc_read_ahead(uint32_t blockno, uint32_t nblocks);
+void	bc_write_blocks(uint32_t *blocknos, uint32_t n);
+void	bc_sync(void);
+void*	bc_alloc_block(uint32_t blockno);
+void	bc_insert_block(uint32_t blockno, void *pg);
+void	bc_drop_block(uint32_t blockno);
+int	bc_make_private(void *addr);
+uint32_t bc_resident(void);
+int	bc_set_capacity(uint32_t capacity);
+extern uint32_t bc_capacity, bc_nblocks;
+extern struct Fsret_bcstat bc_stats;
 
 /* fs.c */
 void	fs_init(void);
 int	file_get_block(struct File *f, uint32_t file_blockno, char **pblk);
+int	file_get_blocks(struct File *f, uint32_t filebno, uint32_t n, char **pblk);
+bool	file_block_is_cached(struct File *f, uint32_t filebno);
+void	file_count_reads(struct File *f, off_t offset, size_t count);
+void	file_readahead(struct File *f, uint32_t filebno, uint32_t nblocks);
 int	file_create(const char *path, struct File **f);
 int	file_open(const char *path, struct File **f);
 ssize_t	file_read(struct File *f, void *buf, size_t count, off_t offset);
 int	file_write(struct File *f, const void *buf, size_t count, off_t offset);
 int	file_set_size(struct File *f, off_t newsize);
-void	file_flush(struct File *f);
+int	file_flush(struct File *f);
 int	file_remove(const char *path);
-void	fs_sync(void);
+int	fs_sync(void);
 
 /* int	map_block(uint32_t); */
 bool	block_is_free(uint32_t blockno);
 int	alloc_block(void);
+void	free_block(uint32_t blockno);
 
 /* test.c */
 void	fs_test(void);
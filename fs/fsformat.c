@@ -33,6 +33,8 @@ typedef int bool;
 
 #define ROUNDUP(n, v) ((n) - 1 + (v) - ((n) - 1) % (v))
 #define MAX_DIR_ENTS 128
+// The file server maps the whole disk into 3GB of its address space
+#define MAXNBLOCKS (0xC0000000 / BLKSIZE)
 
 struct Dir
 {
@@ -134,16 +136,12 @@ finishdisk(void)
 void
 finishfile(struct File *f, uint32_t start, uint32_t len)
 {
-	int i;
 	f->f_size = len;
 	len = ROUNDUP(len, BLKSIZE);
-	for (i = 0; i < len / BLKSIZE && i < NDIRECT; ++i)
-		f->f_direct[i] = start + i;
-	if (i == NDIRECT) {
-		uint32_t *ind = alloc(BLKSIZE);
-		f->f_indirect = blockof(ind);
-		for (; i < len / BLKSIZE; ++i)
-			ind[i - NDIRECT] = start + i;
+	// Files are laid out contiguously, so one extent covers them.
+	if (len > 0) {
+		f->f_extents[0].e_start = start;
+		f->f_extents[0].e_len = len / BLKSIZE;
 	}
 }
 
@@ -228,7 +226,7 @@ main(int argc, char **argv)
 		usage();
 
 	nblocks = strtol(argv[2], &s, 0);
-	if (*s || s == argv[2] || nblocks < 2 || nblocks > 1024)
+	if (*s || s == argv[2] || nblocks < 2 || nblocks > MAXNBLOCKS)
 		usage();
 
 	opendisk(argv[1]);
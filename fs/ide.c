@@ -12,14 +12,46 @@
 #define IDE_DF		0x20
 #define IDE_ERR		0x01
 
+// Disks 0 and 1 are on the primary channel, 2 and 3 on the secondary.
+#define IDE_BASE(d)	((d) < 2 ? 0x1F0 : 0x170)
+
 static int diskno = 1;
 
+// The file server and the paging servers all drive the disks, and a
+// command takes several register writes that another environment must
+// not get in between, so each channel has a lock.  The kernel maps the
+// page holding the locks into all of them at UIDELOCKS (see env_create).
+// A lock is 0 when free, 1 when held, and 2 when held with others
+// asleep in sys_futex_wait on it.
+#define IDE_CHANNEL(d)	((d) >> 1)
+static volatile uint32_t *ide_locks = (volatile uint32_t *) UIDELOCKS;
+
+static void
+ide_lock(int d)
+{
+	volatile uint32_t *l = &ide_locks[IDE_CHANNEL(d)];
+
+	if (xchg(l, 1) == 0)
+		return;
+	while (xchg(l, 2) != 0)
+		sys_futex_wait((const uint32_t *) l, 2, -1);
+}
+
+static void
+ide_unlock(int d)
+{
+	volatile uint32_t *l = &ide_locks[IDE_CHANNEL(d)];
+
+	if (xchg(l, 0) == 2)
+		sys_futex_wake((const uint32_t *) l, 1);
+}
+
 static int
 ide_wait_ready(bool check_error)
 {
 	int r;
 
-	while (((r = inb(0x1F7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+	while (((r = inb(IDE_BASE(diskno) + 7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
 		/* do nothing */;
 
 	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
@@ -32,6 +64,7 @@ ide_probe_disk1(void)
 {
 	int r, x;
 
+	ide_lock(0);
 	// wait for Device 0 to be ready
 	ide_wait_ready(0);
 
@@ -46,15 +79,48 @@ ide_probe_disk1(void)
 
 	// switch back to Device 0
 	outb(0x1F6, 0xE0 | (0<<4));
+	ide_unlock(0);
 
 	cprintf("Device 1 presence: %d\n", (x < 1000));
 	return (x < 1000);
 }
 
+// Is there a disk d?  Unlike ide_probe_disk1, this works for any disk,
+// including ones on a channel with nothing attached, and doesn't change
+// which disk ide_read and ide_write use.
+bool
+ide_probe_disk(int d)
+{
+	int base = IDE_BASE(d), r, x;
+
+	ide_lock(d);
+	// an empty channel floats high
+	if (inb(base + 7) == 0xFF) {
+		ide_unlock(d);
+		return 0;
+	}
+
+	for (x = 0; x < 1000 && (inb(base + 7) & IDE_BSY) != 0; x++)
+		/* do nothing */;
+
+	outb(base + 6, 0xE0 | ((d&1)<<4));
+	for (x = 0;
+	     x < 1000 && ((r = inb(base + 7)) & (IDE_BSY|IDE_DRDY|IDE_DF|IDE_ERR)) != IDE_DRDY;
+	     x++)
+		/* do nothing */;
+
+	// switch back to the disk we were using, if it's on this channel
+	if (IDE_BASE(diskno) == base)
+		outb(base + 6, 0xE0 | ((diskno&1)<<4));
+	ide_unlock(d);
+
+	return (x < 1000);
+}
+
 void
 ide_set_disk(int d)
 {
-	if (d != 0 && d != 1)
+	if (d < 0 || d > 3)
 		panic("bad disk number");
 	diskno = d;
 }
@@ -62,50 +128,54 @@ ide_set_disk(int d)
 int
 ide_read(uint32_t secno, void *dst, size_t nsecs)
 {
-	int r;
+	int base = IDE_BASE(diskno), r;
 
 	assert(nsecs <= 256);
 
+	ide_lock(diskno);
 	ide_wait_ready(0);
 
-	outb(0x1F2, nsecs);
-	outb(0x1F3, secno & 0xFF);
-	outb(0x1F4, (secno >> 8) & 0xFF);
-	outb(0x1F5, (secno >> 16) & 0xFF);
-	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
-	outb(0x1F7, 0x20);	// CMD 0x20 means read sector
+	outb(base + 2, nsecs);
+	outb(base + 3, secno & 0xFF);
+	outb(base + 4, (secno >> 8) & 0xFF);
+	outb(base + 5, (secno >> 16) & 0xFF);
+	outb(base + 6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+	outb(base + 7, 0x20);	// CMD 0x20 means read sector
 
-	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+	for (r = 0; nsecs > 0; nsecs--, dst += SECTSIZE) {
 		if ((r = ide_wait_ready(1)) < 0)
-			return r;
-		insl(0x1F0, dst, SECTSIZE/4);
+			break;
+		insl(base, dst, SECTSIZE/4);
 	}
 
-	return 0;
+	ide_unlock(diskno);
+	return r;
 }
 
 int
 ide_write(uint32_t secno, const void *src, size_t nsecs)
 {
-	int r;
+	int base = IDE_BASE(diskno), r;
 
 	assert(nsecs <= 256);
 
+	ide_lock(diskno);
 	ide_wait_ready(0);
 
-	outb(0x1F2, nsecs);
-	outb(0x1F3, secno & 0xFF);
-	outb(0x1F4, (secno >> 8) & 0xFF);
-	outb(0x1F5, (secno >> 16) & 0xFF);
-	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
-	outb(0x1F7, 0x30);	// CMD 0x30 means write sector
+	outb(base + 2, nsecs);
+	outb(base + 3, secno & 0xFF);
+	outb(base + 4, (secno >> 8) & 0xFF);
+	outb(base + 5, (secno >> 16) & 0xFF);
+	outb(base + 6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+	outb(base + 7, 0x30);	// CMD 0x30 means write sector
 
-	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+	for (r = 0; nsecs > 0; nsecs--, src += SECTSIZE) {
 		if ((r = ide_wait_ready(1)) < 0)
-			return r;
-		outsl(0x1F0, src, SECTSIZE/4);
+			break;
+		outsl(base, src, SECTSIZE/4);
 	}
 
-	return 0;
+	ide_unlock(diskno);
+	return r;
 }
 
@@ -34,8 +34,15 @@ struct OpenFile {
 	struct File *o_file;	// mapped descriptor for open file
 	int o_mode;		// open mode
 	struct Fd *o_fd;	// Fd page
+	uint32_t o_ra_next;	// Block a sequential reader would read next
+	uint32_t o_ra_end;	// First block past what we've read ahead
+	uint32_t o_ra_window;	// Blocks to read ahead, 0 if not sequential
 };
 
+// Bounds on the readahead window, in blocks
+#define RA_MIN_WINDOW	4
+#define RA_MAX_WINDOW	BC_MAX_READAHEAD
+
 // Max number of open files in the file system at once
 #define MAXOPEN		1024
 #define FILEVA		0xD0000000
@@ -75,6 +82,8 @@ openfile_alloc(struct OpenFile **o)
 			/* fall through */
 		case 1:
 			opentab[i].o_fileid += MAXOPEN;
+			opentab[i].o_ra_next = opentab[i].o_ra_end = 0;
+			opentab[i].o_ra_window = 0;
 			*o = &opentab[i];
 			memset(opentab[i].o_fd, 0, PGSIZE);
 			return (*o)->o_fileid;
@@ -96,6 +105,44 @@ openfile_lookup(envid_t envid, uint32_t fileid, struct OpenFile **po)
 	return 0;
 }
 
+// Readahead for a read of o at 'offset'.  If the reads of o are
+// sequential, keep the next o_ra_window blocks in the block cache,
+// topping it up (in one go, with bc_read_ahead) whenever half of what
+// we read ahead has been used.  The window doubles while the blocks we
+// read ahead are still cached when they're read, and halves when they
+// got evicted first.  Reads that jump around turn readahead off.
+static void
+readahead(struct OpenFile *o, off_t offset)
+{
+	uint32_t bno = offset / BLKSIZE;
+
+	// Another read from the same block
+	if (bno + 1 == o->o_ra_next)
+		return;
+	if (bno != o->o_ra_next) {
+		o->o_ra_window = 0;
+		o->o_ra_next = o->o_ra_end = bno + 1;
+		return;
+	}
+
+	if (o->o_ra_window == 0)
+		o->o_ra_window = RA_MIN_WINDOW;
+	else if (bno < o->o_ra_end) {
+		if (file_block_is_cached(o->o_file, bno))
+			o->o_ra_window = MIN(o->o_ra_window * 2, RA_MAX_WINDOW);
+		else
+			o->o_ra_window = MAX(o->o_ra_window / 2, RA_MIN_WINDOW);
+	}
+
+	o->o_ra_next = bno + 1;
+	if (o->o_ra_end < bno + 1)
+		o->o_ra_end = bno + 1;
+	if (o->o_ra_end - (bno + 1) <= o->o_ra_window / 2) {
+		file_readahead(o->o_file, o->o_ra_end, bno + 1 + o->o_ra_window - o->o_ra_end);
+		o->o_ra_end = bno + 1 + o->o_ra_window;
+	}
+}
+
 // Open req->req_path in mode req->req_omode, storing the Fd page and
 // permissions to return to the calling environment in *pg_store and
 // *perm_store respectively.
@@ -124,16 +171,33 @@ serve_open(envid_t envid, struct Fsreq_open *req,
 	}
 	fileid = r;
 
-	if (req->req_omode != 0) {
-		if (debug)
-			cprintf("file_open omode 0x%x unsupported", req->req_omode);
-		return -E_INVAL;
+	// Open the file
+	if (req->req_omode & O_CREAT) {
+		if ((r = file_create(path, &f)) < 0) {
+			if (!(req->req_omode & O_EXCL) && r == -E_FILE_EXISTS)
+				goto try_open;
+			if (debug)
+				cprintf("file_create failed: %e", r);
+			return r;
+		}
+		if (req->req_omode & O_MKDIR)
+			f->f_type = FTYPE_DIR;
+	} else {
+try_open:
+		if ((r = file_open(path, &f)) < 0) {
+			if (debug)
+				cprintf("file_open failed: %e", r);
+			return r;
+		}
 	}
 
-	if ((r = file_open(path, &f)) < 0) {
-		if (debug)
-			cprintf("file_open failed: %e", r);
-		return r;
+	// Truncate
+	if (req->req_omode & O_TRUNC) {
+		if ((r = file_set_size(f, 0)) < 0) {
+			if (debug)
+				cprintf("file_set_size failed: %e", r);
+			return r;
+		}
 	}
 
 	// Save the file pointer
@@ -157,6 +221,24 @@ serve_open(envid_t envid, struct Fsreq_open *req,
 }
 
 
+// Set the size of req->req_fileid to req->req_size bytes, truncating
+// or extending the file as necessary.
+int
+serve_set_size(envid_t envid, struct Fsreq_set_size *req)
+{
+	struct OpenFile *o;
+	int r;
+
+	if (debug)
+		cprintf("serve_set_size %08x %08x %08x\n", envid, req->req_fileid, req->req_size);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	if ((o->o_mode & O_ACCMODE) == O_RDONLY)
+		return -E_INVAL;
+	return file_set_size(o->o_file, req->req_size);
+}
+
 // Read at most ipc->read.req_n bytes from the current seek position
 // in ipc->read.req_fileid.  Return the bytes read from the file to
 // the caller in ipc->readRet, then update the seek position.  Returns
@@ -181,6 +263,8 @@ serve_read(envid_t envid, union Fsipc *ipc)
 
 	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
 		return r;
+	file_count_reads(o->o_file, o->o_fd->fd_offset, MIN(req->req_n, sizeof ret->ret_buf));
+	readahead(o, o->o_fd->fd_offset);
 
 	if ((r = file_read(o->o_file, ret->ret_buf,
 			   MIN(req->req_n, sizeof ret->ret_buf),
@@ -193,6 +277,76 @@ serve_read(envid_t envid, union Fsipc *ipc)
 
 
 
+// Write req->req_n bytes from req->req_buf to req_fileid, starting at
+// the current seek position, and update the seek position
+// accordingly.  Extend the file if necessary.  Returns the number of
+// bytes written, or < 0 on error.  The data isn't written to disk until
+// the file is flushed (or the block cache needs the room).
+int
+serve_write(envid_t envid, struct Fsreq_write *req)
+{
+	struct OpenFile *o;
+	int r;
+
+	if (debug)
+		cprintf("serve_write %08x %08x %08x\n", envid, req->req_fileid, req->req_n);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	if ((o->o_mode & O_ACCMODE) == O_RDONLY)
+		return -E_INVAL;
+
+	if ((r = file_write(o->o_file, req->req_buf,
+			    MIN(req->req_n, sizeof req->req_buf),
+			    o->o_fd->fd_offset)) < 0)
+		return r;
+
+	o->o_fd->fd_offset += r;
+	return r;
+}
+
+// Read whole blocks of req->req_fileid from the current seek position,
+// up to req->req_n bytes' worth, by mapping the block cache pages
+// themselves into the caller, copy-on-write, instead of copying them
+// into the request page.  Blocks that lie one after the other on disk
+// go in one IPC.  The seek position must be at a block boundary, with
+// a whole block of the file after it.  The first page to return, the
+// number of pages and their permissions are stored in *pg_store,
+// *npg_store and *perm_store.  Returns the number of bytes read, or < 0
+// on error, in which case the caller should fall back to FSREQ_READ.
+int
+serve_readmap(envid_t envid, struct Fsreq_readmap *req,
+	      void **pg_store, size_t *npg_store, int *perm_store)
+{
+	struct OpenFile *o;
+	off_t offset;
+	uint32_t i, n;
+	char *blk;
+	int r;
+
+	if (debug)
+		cprintf("serve_readmap %08x %08x %08x\n", envid, req->req_fileid, req->req_n);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	offset = o->o_fd->fd_offset;
+	if (offset % BLKSIZE || offset + BLKSIZE > o->o_file->f_size)
+		return -E_INVAL;
+	n = MIN(req->req_n / BLKSIZE, (o->o_file->f_size - offset) / BLKSIZE);
+	n = MAX(MIN(n, READMAP_MAXBLOCKS), 1);
+	file_count_reads(o->o_file, offset, n*BLKSIZE);
+	for (i = 0; i < n; i++)
+		readahead(o, offset + i*BLKSIZE);
+	if ((r = file_get_blocks(o->o_file, offset / BLKSIZE, n, &blk)) < 0)
+		return r;
+
+	o->o_fd->fd_offset += r*BLKSIZE;
+	*pg_store = blk;
+	*npg_store = r;
+	*perm_store = PTE_P|PTE_U|PTE_COW;
+	return r*BLKSIZE;
+}
+
 // Stat ipc->stat.req_fileid.  Return the file's struct Stat to the
 // caller in ipc->statRet.
 int
@@ -216,21 +370,131 @@ serve_stat(envid_t envid, union Fsipc *ipc)
 }
 
 
-// Our read-only file system do nothing for flush
+// Flush all data and metadata of req->req_fileid to disk.
 int
 serve_flush(envid_t envid, struct Fsreq_flush *req)
 {
+	struct OpenFile *o;
+	int r;
+
+	if (debug)
+		cprintf("serve_flush %08x %08x\n", envid, req->req_fileid);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	// Nothing to write back for files that were only read
+	if ((o->o_mode & O_ACCMODE) == O_RDONLY)
+		return 0;
+	return file_flush(o->o_file);
+}
+
+// Remove the file req->req_path.
+int
+serve_remove(envid_t envid, struct Fsreq_remove *req)
+{
+	char path[MAXPATHLEN];
+
+	if (debug)
+		cprintf("serve_remove %08x %s\n", envid, req->req_path);
+
+	// Copy in the path, making sure it's null-terminated
+	memmove(path, req->req_path, MAXPATHLEN);
+	path[MAXPATHLEN-1] = 0;
+
+	return file_remove(path);
+}
+
+// Sync the file system.
+int
+serve_sync(envid_t envid, union Fsipc *req)
+{
+	return fs_sync();
+}
+
+// Supply a page of a program segment that the kernel is loading lazily
+// for envid (see env_segment_fault): req->req_n bytes of
+// req->req_fileid starting at the page-aligned req->req_offset, with
+// the rest of the page zeroed.  A whole page of file data is shared
+// straight out of the block cache; otherwise the data is copied into
+// the request page, which is sent back instead.  The page to return
+// and its permissions are stored in *pg_store and *perm_store.
+int
+serve_pagein(envid_t envid, struct Fsreq_pagein *req,
+	     void **pg_store, int *perm_store)
+{
+	struct OpenFile *o;
+	off_t offset;
+	size_t n;
+	int perm, r;
+	char *blk;
+
+	if (debug)
+		cprintf("serve_pagein %08x %08x %08x %08x\n", envid, req->req_fileid, req->req_offset, req->req_n);
+
+	// Copy out the request, since we may overwrite the request page
+	offset = req->req_offset;
+	n = MIN(req->req_n, PGSIZE);
+	perm = req->req_perm;
+
+	if (offset % BLKSIZE)
+		return -E_INVAL;
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	file_count_reads(o->o_file, offset, n);
+	readahead(o, offset);
+	if ((r = file_get_block(o->o_file, offset / BLKSIZE, &blk)) < 0)
+		return r;
+
+	if (n == PGSIZE) {
+		*pg_store = blk;
+	} else {
+		memmove(req, blk, n);
+		memset((char *) req + n, 0, PGSIZE - n);
+		*pg_store = req;
+	}
+	*perm_store = perm;
 	return 0;
 }
 
+// Return the block cache statistics in ipc->bcstatRet.
+int
+serve_bcstat(envid_t envid, union Fsipc *ipc)
+{
+	if (debug)
+		cprintf("serve_bcstat %08x\n", envid);
+
+	ipc->bcstatRet = bc_stats;
+	ipc->bcstatRet.ret_capacity = bc_capacity;
+	ipc->bcstatRet.ret_nblocks = bc_resident();
+	return 0;
+}
+
+// Change the block cache's capacity to ipc->bcset.req_capacity blocks.
+int
+serve_bcset(envid_t envid, union Fsipc *ipc)
+{
+	if (debug)
+		cprintf("serve_bcset %08x %d\n", envid, ipc->bcset.req_capacity);
+
+	return bc_set_capacity(ipc->bcset.req_capacity);
+}
+
 typedef int (*fshandler)(envid_t envid, union Fsipc *req);
 
 fshandler handlers[] = {
-	// Open is handled specially because it passes pages
+	// Open, read-map and page-in are handled specially because they pass pages
 	/* [FSREQ_OPEN] =	(fshandler)serve_open, */
+	/* [FSREQ_READMAP] =	(fshandler)serve_readmap, */
+	/* [FSREQ_PAGEIN] =	(fshandler)serve_pagein, */
 	[FSREQ_READ] =		serve_read,
 	[FSREQ_STAT] =		serve_stat,
 	[FSREQ_FLUSH] =		(fshandler)serve_flush,
+	[FSREQ_WRITE] =		(fshandler)serve_write,
+	[FSREQ_SET_SIZE] =	(fshandler)serve_set_size,
+	[FSREQ_SYNC] =		serve_sync,
+	[FSREQ_REMOVE] =	(fshandler)serve_remove,
+	[FSREQ_BCSTAT] =	serve_bcstat,
+	[FSREQ_BCSET] =		serve_bcset,
 };
 #define NHANDLERS (sizeof(handlers)/sizeof(handlers[0]))
 
@@ -239,6 +503,7 @@ serve(void)
 {
 	uint32_t req, whom;
 	int perm, r;
+	size_t npg;
 	void *pg;
 
 	while (1) {
@@ -256,15 +521,20 @@ serve(void)
 		}
 
 		pg = NULL;
+		npg = 1;
 		if (req == FSREQ_OPEN) {
 			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
+		} else if (req == FSREQ_READMAP) {
+			r = serve_readmap(whom, (struct Fsreq_readmap*)fsreq, &pg, &npg, &perm);
+		} else if (req == FSREQ_PAGEIN) {
+			r = serve_pagein(whom, (struct Fsreq_pagein*)fsreq, &pg, &perm);
 		} else if (req < NHANDLERS && handlers[req]) {
 			r = handlers[req](whom, fsreq);
 		} else {
 			cprintf("Invalid request code %d from %08x\n", req, whom);
 			r = -E_INVAL;
 		}
-		ipc_send(whom, r, pg, perm);
+		ipc_send_pages(whom, r, pg, npg, perm);
 		sys_page_unmap(0, fsreq);
 	}
 }
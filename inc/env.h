@@ -45,6 +45,26 @@ enum EnvType {
 	ENV_TYPE_PAGE,		// Paging server
 };
 
+// Maximum number of lazily loaded segments per environment
+#define NSEGS			4
+
+// A program segment whose pages are filled in on first touch (see
+// env_segment_fault in kern/env.c) instead of when the program is loaded.
+// The first seg_filesz bytes come from the program file, starting at
+// seg_offset; the rest of the segment is zero.  The file is either an
+// ELF image in kernel memory (seg_binary), or file seg_fileid on the
+// file server seg_pager.
+struct Segment {
+	uintptr_t seg_va;		// Page-aligned start of the segment
+	size_t seg_memsz;		// Size in memory (0 if unused)
+	size_t seg_filesz;		// Size in the file
+	uint32_t seg_offset;		// Page-aligned file offset of seg_va
+	int seg_perm;			// Permissions to map pages with
+	envid_t seg_pager;		// File server holding the file
+	int seg_fileid;			// File id on seg_pager
+	const uint8_t *seg_binary;	// Or, ELF image in kernel memory
+};
+
 struct Env {
 	struct Trapframe env_tf;	// Saved registers
 	struct Env *env_link;		// Next free Env
@@ -58,6 +78,9 @@ struct Env {
 	// Address space
 	pde_t *env_pgdir;		// Kernel virtual address of page dir
 	int env_npages;			// Number of pages mapped in page dir
+	int env_rss_min;		// Pages guaranteed to us (see sys_env_set_rss)
+	int env_rss_max;		// Most pages we may allocate, or 0 for no limit
+	uint32_t env_rss_reclaimed;	// Pages paging servers took from us
 
 	// Exception handling
 	void *env_pgfault_upcall;	// Page fault upcall entry point
@@ -65,14 +88,26 @@ struct Env {
 	// Lab 4 IPC
 	bool env_ipc_recving;		// Env is blocked receiving
 	void *env_ipc_dstva;		// VA at which to map received page
+	size_t env_ipc_dstnpg;		// Number of pages we'll take at env_ipc_dstva
 	uint32_t env_ipc_value;		// Data value sent to us
 	envid_t env_ipc_from;		// envid of the sender
 	int env_ipc_perm;		// Perm of page mapping received
+	size_t env_ipc_npages;		// Number of pages mapped by the IPC received
 	struct PageInfo *env_ipc_page;		// Page being sent by this env
+	void *env_ipc_srcva_sending;		// VA of the pages being sent by this env
+	size_t env_ipc_npg_sending;		// Number of pages being sent by this env
 	uint32_t env_ipc_value_sending;		// Data value being sent by this env
 	int env_ipc_perm_sending;		// Perm of page mapping being sent by this env
+	envid_t env_ipc_callee;		// Env we're waiting on in sys_ipc_call, or 0
 	struct Env *env_ipc_blocked_sender;		// blocked sender
 	struct Env *env_ipc_blocked_sender_chain;		// blocked sender that is trying to send to the same env that this env is trying to send to
+
+	// Lazily loaded program segments
+	struct Segment env_segs[NSEGS];
+	envid_t env_pagein_pager;	// Pager we're waiting on for a segment page, or 0
+
+	physaddr_t env_futex_addr;	// Word we're asleep on in sys_futex_wait, or 0
+	struct Env *env_futex_link;	// Next env asleep on a word in the same hash bucket
 };
 
 #endif // !JOS_INC_ENV_H
@@ -19,26 +19,35 @@
 // Maximum size of a complete pathname, including null
 #define MAXPATHLEN	1024
 
-// Number of block pointers in a File descriptor
-#define NDIRECT		10
-// Number of direct block pointers in an indirect block
-#define NINDIRECT	(BLKSIZE / 4)
-
-#define MAXFILESIZE	((NDIRECT + NINDIRECT) * BLKSIZE)
+// A run of 'e_len' consecutive disk blocks starting at block 'e_start'.
+// An extent with e_start == 0 is a hole; one with e_len == 0 ends the
+// file's extent list.
+struct Extent {
+	uint32_t e_start;
+	uint32_t e_len;
+} __attribute__((packed));
+
+// Number of extents in a File descriptor
+#define NEXTENT		14
+// Number of extents in an indirect block
+#define NINDIRECT	(BLKSIZE / sizeof(struct Extent))
+
+// Files are limited only by how many extents they need; most files
+// need just one.
+#define MAXFILESIZE	0x40000000
 
 struct File {
 	char f_name[MAXNAMELEN];	// filename
 	off_t f_size;			// file size in bytes
 	uint32_t f_type;		// file type
 
-	// Block pointers.
-	// A block is allocated iff its value is != 0.
-	uint32_t f_direct[NDIRECT];	// direct blocks
-	uint32_t f_indirect;		// indirect block
+	// The file's blocks, in order, as runs of disk blocks.
+	struct Extent f_extents[NEXTENT];
+	uint32_t f_indirect;		// block of NINDIRECT more extents
 
 	// Pad out to 256 bytes; must do arithmetic in case we're compiling
 	// fsformat on a 64-bit machine.
-	uint8_t f_pad[256 - MAXNAMELEN - 8 - 4*NDIRECT - 4];
+	uint8_t f_pad[256 - MAXNAMELEN - 8 - 8*NEXTENT - 4];
 } __attribute__((packed));	// required only on some 64-bit machines
 
 // An inode block contains exactly BLKFILES 'struct File's
@@ -59,6 +68,20 @@ struct Super {
 	struct File s_root;		// Root directory node
 };
 
+// Swap area header, in the block just before the area's first slot.
+// An area either fills a disk of its own, with the header in block 0, or
+// follows the file system on the file system's disk, with the header in
+// block s_nblocks.  The paging servers fill higher-priority areas first,
+// and spread pages evenly over areas of the same priority.
+
+#define SWAP_MAGIC	0x53574150	// 'SWAP'
+
+struct SwapHeader {
+	uint32_t sh_magic;		// Magic number: SWAP_MAGIC
+	uint32_t sh_nslots;		// Number of page slots after the header
+	int32_t sh_priority;
+};
+
 // Definitions for requests from clients to file system
 enum {
 	FSREQ_OPEN = 1,
@@ -70,9 +93,22 @@ enum {
 	FSREQ_STAT,
 	FSREQ_FLUSH,
 	FSREQ_REMOVE,
-	FSREQ_SYNC
+	FSREQ_SYNC,
+	// Page-in of a lazily loaded program segment, sent by the kernel on
+	// behalf of the faulting environment.  Returns the page.
+	FSREQ_PAGEIN,
+	// Block cache statistics; returns a Fsret_bcstat on the request page
+	FSREQ_BCSTAT,
+	// Read whole blocks by mapping them from the block cache; returns
+	// the pages
+	FSREQ_READMAP,
+	// Change the block cache's capacity
+	FSREQ_BCSET
 };
 
+// Most blocks a FSREQ_READMAP request returns at once
+#define READMAP_MAXBLOCKS	32
+
 union Fsipc {
 	struct Fsreq_open {
 		char req_path[MAXPATHLEN];
@@ -108,6 +144,28 @@ union Fsipc {
 	struct Fsreq_remove {
 		char req_path[MAXPATHLEN];
 	} remove;
+	struct Fsreq_pagein {
+		int req_fileid;
+		off_t req_offset;	// page-aligned
+		size_t req_n;		// bytes of file data; the rest is zeroed
+		int req_perm;
+	} pagein;
+	struct Fsreq_readmap {
+		int req_fileid;
+		size_t req_n;	// whole blocks' worth, at most READMAP_MAXBLOCKS
+	} readmap;
+	struct Fsret_bcstat {
+		uint32_t ret_capacity;	// Max blocks in the block cache
+		uint32_t ret_nblocks;	// Blocks of it in memory now
+		uint32_t ret_hits;	// Blocks clients read that were in memory
+		uint32_t ret_misses;	// ... and that had to come from disk
+		uint32_t ret_evictions;
+		uint32_t ret_readahead;	// Blocks read in ahead of time
+		uint32_t ret_writebacks;	// Dirty blocks written back
+	} bcstatRet;
+	struct Fsreq_bcset {
+		uint32_t req_capacity;	// in blocks, BC_MIN_CAPACITY to BC_MAX_CAPACITY in fs/fs.h
+	} bcset;
 
 	// Ensure Fsipc is one page
 	char _pad[PGSIZE];
@@ -32,6 +32,7 @@ extern const char *binaryname;
 extern const volatile struct Env *thisenv;
 extern const volatile struct Env envs[NENV];
 extern const volatile struct PageInfo pages[];
+extern const volatile struct Meminfo meminfo;
 
 // exit.c
 void	exit(void);
@@ -50,16 +51,32 @@ envid_t	sys_getenvid(void);
 int	sys_env_destroy(envid_t);
 void	sys_yield(void);
 static envid_t sys_exofork(void);
+envid_t	sys_fork(void);
 int	sys_env_set_status(envid_t env, int status);
 int	sys_env_set_trapframe(envid_t env, struct Trapframe *tf);
+int	sys_env_set_rss(envid_t env, int min, int max);
+int	sys_env_set_segments(envid_t env, const struct Segment *segs, int nsegs);
 int	sys_env_set_pgfault_upcall(envid_t env, void *upcall);
 int	sys_page_alloc(envid_t env, void *pg, int perm);
 int	sys_page_map(envid_t src_env, void *src_pg,
 		     envid_t dst_env, void *dst_pg, int perm);
 int	sys_page_unmap(envid_t env, void *pg);
+int	sys_page_split(envid_t env, void *pg);
+int	sys_page_reclaim(envid_t env, void *pg, uint32_t slot);
+int	sys_page_alloc_range(envid_t env, void *pg, size_t npages, int perm);
+int	sys_page_map_range(envid_t src_env, void *src_pg,
+			   envid_t dst_env, void *dst_pg, size_t npages, int perm);
+int	sys_page_unmap_range(envid_t env, void *pg, size_t npages);
+int	sys_page_clean(envid_t env, void *pg, size_t npages);
 int	sys_ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
+int	sys_ipc_send_pages(envid_t to_env, uint32_t value, void *pg, size_t npages, int perm);
 int	sys_ipc_recv(void *rcv_pg);
+int	sys_ipc_recv_pages(void *rcv_pg, size_t npages);
 int	sys_ipc_try_recv(void *rcv_pg);
+int	sys_ipc_call(envid_t to_env, uint32_t value, void *pg, size_t npages, int perm);
+int	sys_ipc_reply_recv(envid_t to_env, uint32_t value, void *pg, size_t npages, int perm);
+int	sys_futex_wait(const uint32_t *addr, uint32_t val, int ref);
+int	sys_futex_wake(const uint32_t *addr, int n);
 
 // This must be inlined.  Exercise for reader: why?
 static __inline envid_t __attribute__((always_inline))
@@ -76,11 +93,16 @@ sys_exofork(void)
 
 // ipc.c
 void	ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
+void	ipc_send_pages(envid_t to_env, uint32_t value, void *pg, size_t npages, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
+int32_t ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+		       int *perm_store, size_t *npages_store);
+int32_t ipc_call(envid_t to_env, uint32_t value, void *pg, size_t npages, int perm);
+int32_t ipc_reply_recv(envid_t to_env, uint32_t value, void *pg, size_t npages, int perm,
+		       envid_t *from_env_store, int *perm_store, size_t *npages_store);
 envid_t	ipc_find_env(enum EnvType type);
 
 // fork.c
-#define	PTE_SHARE	0x400
 envid_t	fork(void);
 envid_t	sfork(void);	// Challenge!
 
@@ -100,6 +122,8 @@ int	open(const char *path, int mode);
 int	ftruncate(int fd, off_t size);
 int	remove(const char *path);
 int	sync(void);
+int	fs_bcstat(struct Fsret_bcstat *st);
+int	fs_bcset(uint32_t capacity);
 
 // pageref.c
 int	pageref(void *addr);
@@ -126,12 +150,19 @@ void	wait(envid_t env);
 int	page_alloc(envid_t env, void *pg, int perm, int check_mte);
 int     page_map(envid_t srcenvid, void *srcva, envid_t dstenvid, void *dstva, int perm);
 int     page_unmap(envid_t envid, void *va);
+int	page_alloc_range(envid_t env, void *va, size_t npages, int perm, int check_mte);
+int	page_map_range(envid_t srcenvid, void *srcva, envid_t dstenvid, void *dstva, size_t npages, int perm);
+int	page_unmap_range(envid_t envid, void *va, size_t npages);
 void	set_page_choice_func(void *(*pgchc_func)(envid_t env, void *pg_in));
+uint32_t mem_pressure_wait(uint32_t level);
 mte_t*  umapdir_walk(const void *va, int create);
 
+// valloc.c
+void*	va_alloc(size_t npages);
+void	va_free(void *va, size_t npages);
+
 // malloc.c
-void*	find_free_page();
-void*	malloc();
+void*	malloc(size_t n);
 void	free(void *va);
 
 /* File open modes */
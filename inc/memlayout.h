@@ -50,7 +50,9 @@
  *    UVPT      ---->  +------------------------------+ 0xef400000
  *                     |          RO PAGES            | R-/R-  PTSIZE
  *    UPAGES    ---->  +------------------------------+ 0xef000000
- *                     |           RO ENVS            | R-/R-  PTSIZE
+ *                     |         RO MEMINFO           | R-/R-  PGSIZE
+ *    UMEMINFO  ---->  +------------------------------+ 0xeefff000
+ *                     |           RO ENVS            | R-/R-  PTSIZE-PGSIZE
  * UTOP,UENVS ------>  +------------------------------+ 0xeec00000
  * UXSTACKTOP -/       |     User Exception Stack     | RW/RW  PGSIZE
  *                     +------------------------------+ 0xeebff000
@@ -114,6 +116,9 @@
 #define UPAGES		(UVPT - PTSIZE)
 // Read-only copies of the global env structures
 #define UENVS		(UPAGES - PTSIZE)
+// Read-only copy of the kernel's struct Meminfo, in the last page of
+// the envs' slot
+#define UMEMINFO	(UPAGES - PGSIZE)
 
 /*
  * Top of user VM. User can manipulate VA from UTOP-1 and down!
@@ -130,9 +135,20 @@
 // Page to store the page directory for paged-out pages
 #define UMAPDIR		0xDEADB000
 
+// Page of IDE channel locks shared by the file server and the paging
+// servers (see fs/ide.c), just past the mapping directory.  It must
+// stay clear of the fd table (FDTABLE), the file server's open file
+// table (FILEVA) and pending block map (PENDMAP), and UHEAP.
+#define UIDELOCKS	(UMAPDIR + PGSIZE)
+
 // Where user programs generally begin
 #define UTEXT		(2*PTSIZE)
 
+// Address space handed out at run time by va_alloc: the malloc heap,
+// and the paging library's mapping tables
+#define UHEAP		0x08000000
+#define UHEAPTOP	0x0F000000
+
 // Used for temporary page mappings.  Typed 'void*' for convenience
 #define UTEMP		((void*) PTSIZE)
 // Used for temporary page mappings for the user page-fault handler
@@ -181,6 +197,12 @@ extern volatile pde_t uvpd[];     // VA of current page directory
 struct PageInfo {
 	// Next page on the free list.
 	struct PageInfo *pp_link;
+	// Previous page on the free list, so the buddy allocator can take
+	// a block off the middle of one.
+	struct PageInfo *pp_prev;
+	// If this page starts a free block, the block's order (it is
+	// 2^order pages long); otherwise -1.
+	int8_t pp_order;
 
 	// pp_ref is the count of pointers (usually in page table entries)
 	// to this page, for pages allocated using page_alloc.
@@ -189,6 +211,10 @@ struct PageInfo {
 
 	uint16_t pp_ref;
 
+	// Number of environments asleep in sys_futex_wait on a word in
+	// this page.
+	uint16_t pp_futex_waiters;
+
 	uint8_t age;
         uint8_t nfu_age;
 	long long timestamp;
@@ -10,6 +10,25 @@
 // from paging out.
 #define PTE_NO_PAGE         0x200
 
+// PTE_SHARE marks pages that fork and spawn share with the child
+// instead of copying.
+#define PTE_SHARE           0x400
+
+// PTE_COW marks copy-on-write page table entries.  The kernel's fork
+// sets it and resolves write faults on such pages itself, falling back
+// to the user page fault handler when it is short on memory.
+#define PTE_COW             0x800
+
+// PTE_SWAPPED marks a not-present page table entry for a page that a
+// paging server took away from the environment to make room for
+// someone else (see sys_page_reclaim).  The rest of the entry holds
+// the page's swap slot (see PTE_SWAP_SLOT) and its permissions; the
+// paging library moves it into its mapping tables the first time it
+// comes across it.  The bit is the large page bit, which means nothing
+// in a page table entry.
+#define PTE_SWAPPED         0x080
+#define PTE_SWAP_SLOT(pte)  (PTE_ADDR(pte) >> PTXSHIFT)
+
 // Typedefs for mapping directory
 typedef pte_t mte_t;
 typedef pde_t mde_t;
@@ -40,13 +59,90 @@ enum {
 	PAGEREQ_PAGE_OUT,
 	PAGEREQ_PAGE_REMOVE,
 	PAGEREQ_PAGE_STAT,
+	PAGEREQ_PAGE_SHARE,
+	PAGEREQ_PAGE_IN_RANGE,
+	PAGEREQ_RING_SETUP,
+	PAGEREQ_RING_ENTER,
+	PAGEREQ_PAGE_RECLAIM,
 };
 
+// The swap space is made of the swap areas the paging servers find on
+// disk at boot (see struct SwapHeader in inc/fs.h).  There are NPAGESERV
+// paging servers, created one after another at boot; each takes an equal
+// share of every area, and numbers its slots from PAGESERV_NSLOTS times
+// its place in that order, so requests about a slot go to its owner.
+#define NPAGESERV		2
+#define PAGESERV_NSLOTS		65536	// most slots one server can own
+#define PAGESERV_OF(slot)	((slot) / PAGESERV_NSLOTS)
+
+// A request is sent as the IPC value (swap slot << PAGEREQ_SHIFT) | request
+#define PAGEREQ_SHIFT	4
+#define PAGEREQ_MASK	((1 << PAGEREQ_SHIFT) - 1)
+
+// PAGEREQ_PAGE_RECLAIM asks a paging server to page out the coldest
+// page in the whole system, whoever it belongs to, rather than one of
+// the client's own (see sys_page_reclaim).  It has no argument page,
+// and fails with -E_NO_MEM if no page is cold enough.
+
 struct Pageipc {
 	// Ensure Pageipc is one page
 	char page_content[PGSIZE];
 };
 
+// Argument page for PAGEREQ_PAGE_SHARE: take another reference on each
+// of the first nslots swap slots, which are now referenced from one
+// more mapping table (after a fork).
+#define PAGEREQ_SHARE_NSLOTS	(PGSIZE/sizeof(uint32_t) - 1)
+struct Pagereq_share {
+	uint32_t nslots;
+	uint32_t slots[PAGEREQ_SHARE_NSLOTS];
+};
+
+// PAGEREQ_PAGE_IN_RANGE pages in up to PAGEREQ_PAGE_IN_MAXPAGES pages at
+// once.  The request sends the pages to be filled in, all in one IPC,
+// and the swap slots to read into them are listed at the start of the
+// first one (which they then overwrite).
+#define PAGEREQ_PAGE_IN_MAXPAGES	8
+struct Pagereq_page_in_range {
+	uint32_t nslots;
+	uint32_t slots[PAGEREQ_PAGE_IN_MAXPAGES];
+};
+
+// Request ring shared between a client and the paging server, in the
+// style of io_uring.  The client posts PAGEREQ_PAGE_IN, _PAGE_OUT and
+// _PAGE_REMOVE requests on the submission queue; the server takes them
+// off whenever it wakes up, for any client's request, and posts a
+// completion for each.  PAGEREQ_RING_SETUP sends the server the ring
+// page and the PAGERING_NDATA data pages after it, which hold the pages
+// going in and out, and PAGEREQ_RING_ENTER is the doorbell: the server
+// replies once everything on the ring is done.  The ring lives at
+// UPAGERING in the client.
+#define PAGERING_NENTRIES	128	// must be a power of 2
+#define PAGERING_NDATA		(PAGEREQ_PAGE_IN_MAXPAGES - 1)
+#define PAGERING_NPAGES		(1 + PAGERING_NDATA)
+#define UPAGERING		(UMAPDIR - PAGERING_NPAGES*PGSIZE)
+
+struct Pagering_sqe {
+	uint32_t op;		// PAGEREQ_PAGE_IN, _PAGE_OUT or _PAGE_REMOVE
+	uint32_t slot;		// swap slot, for PAGE_IN and PAGE_REMOVE
+	uint32_t data;		// data page for PAGE_IN and PAGE_OUT
+	uint32_t tag;
+};
+
+struct Pagering_cqe {
+	uint32_t tag;
+	int32_t res;		// what the IPC request would have returned
+};
+
+struct Pagering {
+	volatile uint32_t sq_head;	// next request the server takes
+	volatile uint32_t sq_tail;	// next request the client posts
+	volatile uint32_t cq_head;	// next completion the client takes
+	volatile uint32_t cq_tail;	// next completion the server posts
+	struct Pagering_sqe sq[PAGERING_NENTRIES];
+	struct Pagering_cqe cq[PAGERING_NENTRIES];
+};
+
 // Page directory for paged-out pages
 mde_t *umapdir;
 
@@ -54,20 +150,55 @@ struct Pageret_stat {
 	uint32_t num_page_outs;
 	uint32_t num_page_ins;
 	uint32_t num_page_removes;
+	uint32_t num_page_shares;
+	uint32_t num_page_reclaims;	// page outs of the coldest page anywhere
 };
 
+// Statistics are per paging server; get_paging_stats adds them up.
 struct Pageret_stat *get_paging_stats(void);
 void print_paging_stats(struct Pageret_stat *stats);
 void get_and_print_paging_stats(void);
+int page_share_paged_out(void);
+int page_add_backed(void *va, size_t len);
 
 #define MAX_PAGE_AGE 254
 #define PAGE_AGE_INCREMENT_ON_ACCESS 100
 #define PAGE_AGE_DECREMENT_ON_CLOCK  1
 #define PAGE_AGE_INITIAL MAX_PAGE_AGE
+// Pages at least this old were touched too recently for
+// sys_page_reclaim to take them from their environment
+#define PAGE_AGE_COLD (PAGE_AGE_INITIAL - 2*PAGE_AGE_DECREMENT_ON_CLOCK)
 #define NPAGESFREE_HIGH_THRESHOLD (1<<8)
 #define NPAGESFREE_LOW_THRESHOLD  (1<<4)
 #define NPAGEUPDATES_FACTOR 50
 
+// Memory pressure levels.  The level goes up as soon as fewer pages
+// than its watermark are free, so environments can drop caches and
+// other clean data of their own before the kernel starts refusing
+// page allocations (below SOFT_MIN_FREE_PAGES) and the paging servers
+// start taking their pages.  It only comes back down once a quarter
+// more than the watermark is free again, so it doesn't flap.
+enum {
+	MEM_PRESSURE_NONE = 0,
+	MEM_PRESSURE_LOW,	// worth trimming caches
+	MEM_PRESSURE_MEDIUM,	// pages are being aged faster; drop caches
+	MEM_PRESSURE_CRITICAL,	// allocations are about to be refused
+};
+#define MEM_PRESSURE_LOW_PAGES		(4*NPAGESFREE_HIGH_THRESHOLD)
+#define MEM_PRESSURE_MEDIUM_PAGES	NPAGESFREE_HIGH_THRESHOLD
+#define MEM_PRESSURE_CRITICAL_PAGES	(4*NPAGESFREE_LOW_THRESHOLD)
+
+// The kernel's view of memory, which every environment can read at
+// UMEMINFO (see 'meminfo' in inc/lib.h).  It is brought up to date on
+// every clock tick.  To be told when the pressure level changes, sleep
+// in sys_futex_wait on mi_level: the kernel wakes everyone asleep there
+// whenever it changes (see mem_pressure_wait).
+struct Meminfo {
+	volatile uint32_t mi_level;	// MEM_PRESSURE_*
+	volatile uint32_t mi_free_pages;
+	uint32_t mi_npages;
+};
+
 #endif /* !JOS_INC_PAGE_H */
 
 
@@ -18,6 +18,19 @@ enum {
 	SYS_ipc_send,
 	SYS_ipc_recv,
 	SYS_ipc_try_recv,
+	SYS_page_alloc_range,
+	SYS_page_map_range,
+	SYS_page_unmap_range,
+	SYS_fork,
+	SYS_env_set_segments,
+	SYS_ipc_call,
+	SYS_ipc_reply_recv,
+	SYS_futex_wait,
+	SYS_futex_wake,
+	SYS_page_split,
+	SYS_page_reclaim,
+	SYS_env_set_rss,
+	SYS_page_clean,
 	NSYSCALLS
 };
 
@@ -6,6 +6,8 @@
 #include <inc/string.h>
 #include <inc/assert.h>
 #include <inc/elf.h>
+#include <inc/page.h>
+#include <inc/fs.h>
 
 #include <kern/env.h>
 #include <kern/pmap.h>
@@ -234,7 +236,7 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 {
 	int32_t generation;
 	int r;
-	struct Env *e;
+	struct Env *e, *parent;
 
 	if (!(e = env_free_list))
 		return -E_NO_FREE_ENV;
@@ -285,12 +287,29 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 
 	// Also clear the IPC receiving flag.
 	e->env_ipc_recving = 0;
+	e->env_ipc_callee = 0;
 
 	// These fields define linked lists of environments sending messages to each other.
 	// They must start out as NULL, since this environment is not sending to anything / no environments are sending to it yet.
 	e->env_ipc_blocked_sender = 0;
 	e->env_ipc_blocked_sender_chain = 0;
 
+	// No lazily loaded segments yet.
+	memset(e->env_segs, 0, sizeof(e->env_segs));
+	e->env_pagein_pager = 0;
+
+	e->env_futex_addr = 0;
+	e->env_futex_link = NULL;
+
+	// A child gets its parent's resident-set guarantee and limit, which
+	// is how they pass through fork and spawn.
+	e->env_rss_min = e->env_rss_max = 0;
+	if (parent_id && envid2env(parent_id, &parent, 0) == 0) {
+		e->env_rss_min = parent->env_rss_min;
+		e->env_rss_max = parent->env_rss_max;
+	}
+	e->env_rss_reclaimed = 0;
+
 	// commit the allocation
 	env_free_list = e->env_link;
 	*newenv_store = e;
@@ -392,6 +411,7 @@ load_icode(struct Env *e, uint8_t *binary, size_t size)
 	struct Elf *elfhdr = (struct Elf *)binary;
 	struct Proghdr *ph = (struct Proghdr *) (((uint32_t)elfhdr) + elfhdr->e_phoff);
 	struct Proghdr *eph = ph + elfhdr->e_phnum;
+	struct Segment *seg;
 
 	// Temporarily switch to the env's pgdir
 	// for easy memmove-ing and memset-ing at the desired VAs.
@@ -400,12 +420,27 @@ load_icode(struct Env *e, uint8_t *binary, size_t size)
 	lcr3(PADDR(e->env_pgdir));
 
 	// Iterate through each ELF program header.
-	// Allocate physical pages for p_memsz bytes,
+	// The first NSEGS segments are only recorded in e->env_segs, and
+	// their pages are copied from the binary when e first touches them
+	// (see env_segment_fault).
+	// For any others, allocate physical pages for p_memsz bytes,
 	// mapped starting at virtual address p_va.
 	// Copy p_filesz bytes from the ELF binary,
 	// and zero the rest of the memory in the pages.
-	for (; ph < eph; ph++) {
-		if (ph->p_type == ELF_PROG_LOAD) {
+	for (seg = e->env_segs; ph < eph; ph++) {
+		if (ph->p_type != ELF_PROG_LOAD)
+			continue;
+		if (seg < e->env_segs + NSEGS) {
+			seg->seg_va = ROUNDDOWN(ph->p_va, PGSIZE);
+			seg->seg_memsz = ph->p_memsz + PGOFF(ph->p_va);
+			seg->seg_filesz = ph->p_filesz + PGOFF(ph->p_va);
+			seg->seg_offset = ph->p_offset - PGOFF(ph->p_va);
+			seg->seg_perm = PTE_P|PTE_U;
+			if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+				seg->seg_perm |= PTE_W;
+			seg->seg_binary = binary;
+			seg++;
+		} else {
 			region_alloc(e, (void *)ph->p_va, (size_t)ph->p_memsz);
 			memmove((void *)ph->p_va, (void *)(binary + ph->p_offset), (size_t)ph->p_filesz);
 			memset((void *)(ph->p_va + ph->p_filesz), 0, (size_t)(ph->p_memsz - ph->p_filesz));
@@ -424,6 +459,8 @@ load_icode(struct Env *e, uint8_t *binary, size_t size)
 	region_alloc(e, (void *)(USTACKTOP - PGSIZE), (size_t)PGSIZE);
 }
 
+static struct PageInfo *ide_locks;	// see UIDELOCKS
+
 //
 // Allocates a new env with env_alloc, loads the named elf
 // binary into it with load_icode, and sets its env_type.
@@ -444,9 +481,234 @@ env_create(uint8_t *binary, size_t size, enum EnvType type)
 
 	// If this is the file server (type == ENV_TYPE_FS) give it I/O privileges.
 	// LAB 5: Your code here.
-	if (type == ENV_TYPE_FS) {
+	// The paging servers drive the disks too.  They all share the
+	// page of IDE channel locks, which holds a reference of its own so
+	// it outlives them.
+	if (type == ENV_TYPE_FS || type == ENV_TYPE_PAGE) {
 		newenv->env_tf.tf_eflags |= FL_IOPL_3;
+		if (!ide_locks) {
+			if (!(ide_locks = page_alloc(ALLOC_ZERO)))
+				panic("env_create: out of memory for the IDE locks");
+			ide_locks->pp_ref++;
+		}
+		if (page_insert(newenv->env_pgdir, ide_locks, (void *) UIDELOCKS,
+				PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE, &newenv->env_npages) < 0)
+			panic("env_create: out of memory mapping the IDE locks");
 	}
+
+	// The servers get a share of memory that can't be squeezed.
+	if (type == ENV_TYPE_FS)
+		newenv->env_rss_min = ENV_RSS_MIN_FS;
+	else if (type == ENV_TYPE_PAGE)
+		newenv->env_rss_min = ENV_RSS_MIN_PAGE;
+}
+
+//
+// Handle a not-present page fault at 'va' in one of e's lazily loaded
+// segments.  Pages from an ELF image in kernel memory, and pages that
+// are all bss, are filled in right away.  Pages of a file on a file
+// server are requested from the server with an FSREQ_PAGEIN request,
+// sent as though e had called ipc_send followed by ipc_recv(va); e
+// sleeps until the reply (see env_pagein_done) maps the page in.
+// Either way the page is mapped clean (see page_clean), so e can drop
+// it again for as long as it doesn't write to it.
+//
+// Returns 0 if the page is now mapped, 1 if e has to wait for its
+// pager (the caller should give up the CPU), or < 0 on error:
+//	-E_INVAL if va isn't in one of e's segments.
+//	-E_NO_MEM if we're out of memory.
+//	-E_BAD_ENV if the segment's pager has gone away.
+//
+int
+env_segment_fault(struct Env *e, uintptr_t va)
+{
+	struct Segment *seg;
+	struct PageInfo *p;
+	struct Env *pager, *s;
+	union Fsipc *req;
+	size_t n;
+
+	va = ROUNDDOWN(va, PGSIZE);
+	for (seg = e->env_segs; seg < e->env_segs + NSEGS; seg++)
+		if (va >= seg->seg_va && va - seg->seg_va < seg->seg_memsz)
+			break;
+	if (seg == e->env_segs + NSEGS)
+		return -E_INVAL;
+
+	n = seg->seg_filesz > va - seg->seg_va ? MIN(PGSIZE, seg->seg_filesz - (va - seg->seg_va)) : 0;
+	if (n == 0 || seg->seg_binary) {
+		if (!(p = page_alloc(ALLOC_ZERO)))
+			return -E_NO_MEM;
+		if (n)
+			memmove(page2kva(p), seg->seg_binary + seg->seg_offset + (va - seg->seg_va), n);
+		if (page_insert(e->env_pgdir, p, (void *) va, seg->seg_perm, &e->env_npages) < 0) {
+			page_free(p);
+			return -E_NO_MEM;
+		}
+		page_clean(e->env_pgdir, (void *) va);
+		return 0;
+	}
+
+	if (envid2env(seg->seg_pager, &pager, 0) < 0)
+		return -E_BAD_ENV;
+	if (!(p = page_alloc(ALLOC_ZERO)))
+		return -E_NO_MEM;
+	req = page2kva(p);
+	req->pagein.req_fileid = seg->seg_fileid;
+	req->pagein.req_offset = seg->seg_offset + (va - seg->seg_va);
+	req->pagein.req_n = n;
+	// The page may be shared with the file server's cache, so writable
+	// segments get copy-on-write mappings.
+	req->pagein.req_perm = seg->seg_perm;
+	if (seg->seg_perm & PTE_W)
+		req->pagein.req_perm = (seg->seg_perm & ~PTE_W) | PTE_COW;
+
+	// Wait for the reply at va.
+	e->env_pagein_pager = pager->env_id;
+	e->env_ipc_recving = 1;
+	e->env_ipc_dstva = (void *) va;
+	e->env_status = ENV_NOT_RUNNABLE;
+
+	// Send the request, like sys_ipc_send.
+	e->env_ipc_page = p;
+	e->env_ipc_value_sending = FSREQ_PAGEIN;
+	e->env_ipc_perm_sending = PTE_P|PTE_U|PTE_W;
+	if (pager->env_ipc_recving && pager->env_status == ENV_NOT_RUNNABLE && !pager->env_pagein_pager) {
+		if ((uint32_t) pager->env_ipc_dstva < UTOP &&
+		    page_insert(pager->env_pgdir, p, pager->env_ipc_dstva, PTE_P|PTE_U|PTE_W, &pager->env_npages) < 0) {
+			env_pagein_cancel(e);
+			return -E_NO_MEM;
+		}
+		pager->env_ipc_recving = 0;
+		pager->env_ipc_from = e->env_id;
+		pager->env_ipc_value = FSREQ_PAGEIN;
+		pager->env_ipc_perm = PTE_P|PTE_U|PTE_W;
+		pager->env_ipc_npages = (uint32_t) pager->env_ipc_dstva < UTOP;
+		pager->env_tf.tf_regs.reg_eax = 0;
+		pager->env_status = ENV_RUNNABLE;
+	} else if (!pager->env_ipc_blocked_sender) {
+		pager->env_ipc_blocked_sender = e;
+	} else {
+		for (s = pager->env_ipc_blocked_sender; s->env_ipc_blocked_sender_chain; s = s->env_ipc_blocked_sender_chain) ;
+		s->env_ipc_blocked_sender_chain = e;
+	}
+	return 1;
+}
+
+//
+// The pager has replied to e's FSREQ_PAGEIN request with 'value' and
+// page 'pp' (or NULL), which is mapped at the faulting address with
+// permissions 'perm'.  e is made runnable again, to retry the faulting
+// instruction, or destroyed if the pager couldn't supply the page.
+//
+void
+env_pagein_done(struct Env *e, int32_t value, struct PageInfo *pp, int perm)
+{
+	e->env_pagein_pager = 0;
+	e->env_ipc_recving = 0;
+	if (value < 0 || !pp) {
+		cprintf("[%08x] page-in of va %08x failed: %e\n",
+			e->env_id, e->env_ipc_dstva, value < 0 ? value : -E_INVAL);
+		env_destroy(e);
+		return;
+	}
+	// If this fails, e just faults again and asks again.
+	if (page_insert(e->env_pgdir, pp, e->env_ipc_dstva, perm, &e->env_npages) == 0)
+		page_clean(e->env_pgdir, e->env_ipc_dstva);
+	e->env_status = ENV_RUNNABLE;
+}
+
+//
+// Give up on e's FSREQ_PAGEIN request before the pager has seen it.
+// e is made runnable again, and will fault and ask again.
+//
+void
+env_pagein_cancel(struct Env *e)
+{
+	if (e->env_ipc_page && e->env_ipc_page->pp_ref == 0)
+		page_free(e->env_ipc_page);
+	e->env_ipc_page = NULL;
+	e->env_pagein_pager = 0;
+	e->env_ipc_recving = 0;
+	e->env_status = ENV_RUNNABLE;
+}
+
+//
+// Environments asleep in sys_futex_wait, in FUTEX_NBUCKETS lists hashed
+// by the page of the word they're asleep on, so that waking the
+// sleepers on a word or on a whole page looks at one short list.
+//
+#define FUTEX_NBUCKETS	64
+static struct Env *futex_queues[FUTEX_NBUCKETS];
+#define FUTEX_QUEUE(pa)	(&futex_queues[PGNUM(pa) % FUTEX_NBUCKETS])
+
+//
+// Put e to sleep on the word at physical address pa.
+//
+void
+env_futex_wait(struct Env *e, physaddr_t pa)
+{
+	struct Env **q = FUTEX_QUEUE(pa);
+
+	e->env_futex_addr = pa;
+	e->env_futex_link = *q;
+	*q = e;
+	pa2page(pa)->pp_futex_waiters++;
+	e->env_status = ENV_NOT_RUNNABLE;
+}
+
+//
+// Take e off the sleep queue it's on.  It's up to the caller to make it
+// runnable, if need be.
+//
+static void
+env_futex_unlink(struct Env **ep)
+{
+	struct Env *e = *ep;
+
+	*ep = e->env_futex_link;
+	pa2page(e->env_futex_addr)->pp_futex_waiters--;
+	e->env_futex_addr = 0;
+	e->env_futex_link = NULL;
+}
+
+//
+// Wake up to 'n' environments asleep in sys_futex_wait on a word in
+// [pa, pa + len), which must be within one page.
+// Returns the number woken.
+//
+int
+env_futex_wake(physaddr_t pa, size_t len, int n)
+{
+	struct Env **ep = FUTEX_QUEUE(pa), *e;
+	int woken = 0;
+
+	while ((e = *ep) && woken < n) {
+		if (e->env_futex_addr < pa || e->env_futex_addr >= pa + len) {
+			ep = &e->env_futex_link;
+			continue;
+		}
+		env_futex_unlink(ep);
+		if (e->env_status == ENV_NOT_RUNNABLE)
+			e->env_status = ENV_RUNNABLE;
+		woken++;
+	}
+	return woken;
+}
+
+//
+// If e is asleep in sys_futex_wait, forget about it: it's going away.
+//
+static void
+env_futex_cancel(struct Env *e)
+{
+	struct Env **ep;
+
+	if (!e->env_futex_addr)
+		return;
+	for (ep = FUTEX_QUEUE(e->env_futex_addr); *ep != e; ep = &(*ep)->env_futex_link)
+		/* do nothing */;
+	env_futex_unlink(ep);
 }
 
 //
@@ -476,6 +738,9 @@ env_free(struct Env *e)
 		if (!(e->env_pgdir[pdeno] & PTE_P))
 			continue;
 
+		// a large page is unmapped a page at a time, like the rest
+		page_split(e->env_pgdir, PGADDR(pdeno, 0, 0));
+
 		// find the pa and va of the page table
 		pa = PTE_ADDR(e->env_pgdir[pdeno]);
 		pt = (pte_t*) KADDR(pa);
@@ -497,10 +762,14 @@ env_free(struct Env *e)
 	page_decref(pa2page(pa));
 
 	// return the environment to the free list
+	env_futex_cancel(e);
 	e->env_status = ENV_FREE;
 	e->env_link = env_free_list;
 	env_free_list = e;
 	num_free_envs--;
+
+	// wake whoever is waiting for e to exit (see lib/wait.c)
+	env_futex_wake(PADDR(&e->env_status), sizeof(e->env_status), NENV);
 }
 
 //
@@ -11,6 +11,11 @@ extern struct Env *envs;		// All environments
 extern struct Segdesc gdt[];
 extern size_t num_free_envs;
 
+// Resident-set guarantees the kernel gives its servers, in pages, so a
+// batch job can't squeeze them when memory runs short
+#define ENV_RSS_MIN_FS		512
+#define ENV_RSS_MIN_PAGE	128
+
 void	env_init(void);
 void	env_init_percpu(void);
 int	env_alloc(struct Env **e, envid_t parent_id);
@@ -18,6 +23,13 @@ void	env_free(struct Env *e);
 void	env_create(uint8_t *binary, size_t size, enum EnvType type);
 void	env_destroy(struct Env *e);	// Does not return if e == curenv
 
+int	env_segment_fault(struct Env *e, uintptr_t va);
+void	env_pagein_done(struct Env *e, int32_t value, struct PageInfo *pp, int perm);
+void	env_pagein_cancel(struct Env *e);
+
+void	env_futex_wait(struct Env *e, physaddr_t pa);
+int	env_futex_wake(physaddr_t pa, size_t len, int n);
+
 int	envid2env(envid_t envid, struct Env **env_store, bool checkperm);
 // The following two functions do not return
 void	env_run(struct Env *e) __attribute__((noreturn));
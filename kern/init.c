@@ -15,6 +15,7 @@
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
 #include <kern/reversemap.h>
+#include <inc/page.h>
 
 static void boot_aps(void);
 
@@ -24,6 +25,7 @@ void
 i386_init(void)
 {
 	extern char edata[], end[];
+	int i;
 
 	// Before doing anything else, complete the ELF loading process.
 	// Clear the uninitialized global data (BSS) section of our program.
@@ -65,8 +67,9 @@ i386_init(void)
 	// Start fs.
 	ENV_CREATE(fs_fs, ENV_TYPE_FS);
 
-	// Start page.
-	ENV_CREATE(page_page, ENV_TYPE_PAGE);
+	// Start the page servers.
+	for (i = 0; i < NPAGESERV; i++)
+		ENV_CREATE(page_page, ENV_TYPE_PAGE);
 
 #if defined(TEST)
 	// Don't touch -- used by grading script!
@@ -121,6 +124,8 @@ void
 mp_main(void)
 {
 	// We are in high EIP now, safe to switch to kern_pgdir 
+	// (which has large pages, see mem_init)
+	lcr4(rcr4() | CR4_PSE);
 	lcr3(PADDR(kern_pgdir));
 	cprintf("SMP: CPU %d starting\n", cpunum());
 
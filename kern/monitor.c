@@ -14,6 +14,7 @@
 #include <kern/kdebug.h>
 #include <kern/trap.h>
 #include <kern/pmap.h>
+#include <kern/env.h>
 
 #define CMDBUF_SIZE	80	// enough for one VGA text line
 
@@ -28,6 +29,8 @@ struct Command {
 static struct Command commands[] = {
 	{ "help", "Display this list of commands", mon_help },
 	{ "kerninfo", "Display information about the kernel", mon_kerninfo },
+	{ "meminfo", "Display free physical memory, by block size, and how fragmented it is", mon_meminfo },
+	{ "rss", "Display each environment's resident set, guarantee and limit, or set an environment's guarantee and limit", mon_rss },
 	{ "backtrace", "Displays a stack backtrace", mon_backtrace },           // Defines a shell command backtrace that calls mon_backtrace to print stack backtrace information.
 	{ "showmappings", "Displays all of the physical page mappings that apply to a particular range of virtual/linear addresses in the currently active address space", mon_showmappings },
 	{ "changemappingpermissions", "Explicitly set, clear, or change the permissions of any mapping in the current address space", mon_changemappingpermissions },
@@ -63,6 +66,74 @@ mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
 	return 0;
 }
 
+// Displays the buddy allocator's free blocks of each order, and how much
+// of free memory is in blocks too small for a large page.
+int
+mon_meminfo(int argc, char **argv, struct Trapframe *tf)
+{
+	size_t nblocks[PAGE_MAX_ORDER + 1], nfree, nsmall = 0;
+	int order, largest = -1;
+
+	nfree = page_free_stats(nblocks);
+	cprintf("Free memory: %u pages (%uK)\n", nfree, nfree * PGSIZE / 1024);
+	cprintf("order   blocks    pages\n");
+	for (order = 0; order <= PAGE_MAX_ORDER; order++) {
+		cprintf("%5d %8u %8u\n", order, nblocks[order], nblocks[order] << order);
+		if (nblocks[order])
+			largest = order;
+		if (order < PAGE_MAX_ORDER)
+			nsmall += nblocks[order] << order;
+	}
+	if (largest >= 0)
+		cprintf("Largest free block: %uK\n", (PGSIZE << largest) / 1024);
+	// The share of free memory that no large page can come from
+	if (nfree)
+		cprintf("Fragmentation: %u%% of free memory is in blocks under %uK\n",
+			nsmall * 100 / nfree, (PGSIZE << PAGE_MAX_ORDER) / 1024);
+	return 0;
+}
+
+// Displays each environment's resident set, the guarantee and limit it
+// has (see sys_env_set_rss), and how many of its pages the paging
+// servers have taken.  'rss <envid> <min> <max>' sets an environment's
+// guarantee and limit first, in pages; a limit of 0 means none.
+int
+mon_rss(int argc, char **argv, struct Trapframe *tf)
+{
+	long args[3];
+	struct Env *e;
+	int i, error = 0;
+
+	// expects no args, or an envid (in hex) and two page counts
+	if (argc != 1 && argc != 4) {
+		error = 1;
+	}
+	for (i = 0; !error && argc == 4 && i < 3; ++i) {
+		if (!strisl(argv[i+1], i ? 10 : 16, args+i)) {
+			error = 1;
+		}
+	}
+	if (!error && argc == 4 && (!args[0] || envid2env(args[0], &e, 0) < 0 ||
+	    args[1] < 0 || args[2] < 0 || (args[2] && args[2] < args[1]))) {
+		error = 1;
+	}
+	if (error) {
+		cprintf("Proper usage is 'rss' or 'rss <envid> <min> <max>' (e.g. 'rss 1001 256 0'), which first sets the (hexadecimal) environment's guarantee and limit, in pages.\n");
+		return 0;
+	}
+	if (argc == 4) {
+		e->env_rss_min = args[1];
+		e->env_rss_max = args[2];
+	}
+
+	cprintf("env      type   pages     min     max  reclaimed\n");
+	for (e = envs; e < envs + NENV; e++)
+		if (e->env_status != ENV_FREE)
+			cprintf("%08x %4d %7d %7d %7d %10u\n", e->env_id, e->env_type,
+				e->env_npages, e->env_rss_min, e->env_rss_max, e->env_rss_reclaimed);
+	return 0;
+}
+
 // Displays a stack backtrace. Returns 0 on success.
 int
 mon_backtrace(int argc, char **argv, struct Trapframe *tf)
@@ -164,7 +235,8 @@ mon_showmappings(int argc, char **argv, struct Trapframe *tf)
 			cprintf("%c ", *pte & PTE_U ? 'U' : '-');
 			cprintf("%c ", *pte & PTE_W ? 'W' : '-');
 			cprintf("%c    ", *pte & PTE_P ? 'P' : '-');
-			cprintf("0x%05x\n", PGNUM(*pte));
+			// A large page's entry gives the frame its 4MB starts at
+			cprintf("0x%05x\n", PGNUM(*pte) + (*pte & PTE_PS ? PTX(va) : 0));
 		}
 		else {
 			cprintf("<no physical page mapping>\n");
@@ -20,8 +20,8 @@ static size_t npages_basemem;	// Amount of base memory (in pages)
 // These variables are set in mem_init()
 pde_t *kern_pgdir;		// Kernel's initial page directory
 struct PageInfo *pages;		// Physical page state array
-static struct PageInfo *page_free_list;	// Free list of physical pages
 size_t num_free_pages;		// Amount of free memory (in pages)
+struct Meminfo *meminfo;	// Memory pressure, for users at UMEMINFO
 
 
 // --------------------------------------------------------------
@@ -64,12 +64,14 @@ i386_detect_memory(void)
 
 static void mem_init_mp(void);
 static void boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm);
-static void check_page_free_list(bool only_low_memory);
+static void check_page_free_list(void);
 static void check_page_alloc(void);
 static void check_kern_pgdir(void);
 static physaddr_t check_va2pa(pde_t *pgdir, uintptr_t va);
 static void check_page(void);
 static void check_page_installed_pgdir(void);
+static void page_remove_pte(struct PageInfo *pp, pte_t *pte, int *npages_store);
+static int page_insert_pte(pde_t *pgdir, pte_t *pte, struct PageInfo *pp, void *va, int perm, int *npages_store);
 
 // This simple physical memory allocator is used only while JOS is setting
 // up its virtual memory system.  page_alloc() is the real allocator.
@@ -82,7 +84,7 @@ static void check_page_installed_pgdir(void);
 //
 // If we're out of memory, boot_alloc should panic.
 // This function may ONLY be used during initialization,
-// before the page_free_list list has been set up.
+// before the free lists have been set up.
 static void *
 boot_alloc(uint32_t n)
 {
@@ -176,6 +178,38 @@ mem_init(void)
 	envs = (struct Env *) boot_alloc(m);        // allocate envs memory
 	memset(envs, 0, m);     // zero all the memory in envs
 
+	// The page users read memory pressure from shares envs' slot
+	static_assert(NENV*sizeof(struct Env) <= UMEMINFO - UENVS);
+	meminfo = (struct Meminfo *) boot_alloc(PGSIZE);
+	memset(meminfo, 0, PGSIZE);
+	meminfo->mi_npages = npages;
+
+	//////////////////////////////////////////////////////////////////////
+	// Map all of physical memory at KERNBASE.
+	// Ie.  the VA range [KERNBASE, 2^32) should map to
+	//      the PA range [0, 2^32 - KERNBASE)
+	// We might not have 2^32 - KERNBASE bytes of physical memory, but
+	// we just set up the mapping anyway.
+	// KERNBASE is 4MB-aligned, so boot_map_region maps all of it with
+	// large pages: no page tables, and one TLB entry per 4MB.
+	// Permissions: kernel RW, user NONE
+	// Your code goes here:
+	boot_map_region(kern_pgdir, (uintptr_t)KERNBASE, -KERNBASE, (physaddr_t)0, PTE_W | PTE_P);
+
+	// Switch from the minimal entry page directory to kern_pgdir.  Our
+	// instruction pointer should be somewhere between KERNBASE and
+	// KERNBASE+4MB right now, which is mapped the same way by both page
+	// tables.  The direct map took no pages, so we can switch before the
+	// page allocator is up: the pages it hands out (for the page tables
+	// of the mappings below, say) can then be anywhere in physical
+	// memory, not just in the 4MB that entry_pgdir maps.
+	//
+	// If the machine reboots at this point, you've probably set up your
+	// kern_pgdir wrong.
+	// kern_pgdir has large pages, so turn on page size extensions first.
+	lcr4(rcr4() | CR4_PSE);
+	lcr3(PADDR(kern_pgdir));
+
 	//////////////////////////////////////////////////////////////////////
 	// Now that we've allocated the initial kernel data structures, we set
 	// up the list of free physical pages. Once we've done so, all further
@@ -184,7 +218,7 @@ mem_init(void)
 	// or page_insert
 	page_init();
 
-	check_page_free_list(1);
+	check_page_free_list();
 	//check_page_alloc();
 	//check_page();
 
@@ -199,7 +233,6 @@ mem_init(void)
 	//    - pages itself -- kernel RW, user NONE
 	// Your code goes here:
 	boot_map_region(kern_pgdir, UPAGES, n, PADDR(pages), PTE_U | PTE_P);
-	boot_map_region(kern_pgdir, KERNBASE, npages * PGSIZE, 0, PTE_W | PTE_P);
 
 	//////////////////////////////////////////////////////////////////////
 	// Map the 'envs' array read-only by the user at linear address UENVS
@@ -209,6 +242,7 @@ mem_init(void)
 	//    - envs itself -- kernel RW, user NONE
 	// LAB 3: Your code here.
 	boot_map_region(kern_pgdir, UENVS, m, PADDR(envs), PTE_U | PTE_P);
+	boot_map_region(kern_pgdir, UMEMINFO, PGSIZE, PADDR(meminfo), PTE_U | PTE_P);
 
 	//////////////////////////////////////////////////////////////////////
 	// Use the physical memory that 'bootstack' refers to as the kernel
@@ -223,33 +257,12 @@ mem_init(void)
 	// Your code goes here:
 	boot_map_region(kern_pgdir, KSTACKTOP-KSTKSIZE, KSTKSIZE, PADDR(bootstack), PTE_W | PTE_P);
 
-	//////////////////////////////////////////////////////////////////////
-	// Map all of physical memory at KERNBASE.
-	// Ie.  the VA range [KERNBASE, 2^32) should map to
-	//      the PA range [0, 2^32 - KERNBASE)
-	// We might not have 2^32 - KERNBASE bytes of physical memory, but
-	// we just set up the mapping anyway.
-	// Permissions: kernel RW, user NONE
-	// Your code goes here:
-	boot_map_region(kern_pgdir, (uintptr_t)KERNBASE, (((uint64_t)1)<<32)-KERNBASE-PGSIZE, (physaddr_t)0, PTE_W | PTE_P);
-
 	// Initialize the SMP-related parts of the memory map
 	mem_init_mp();
 
 	// Check that the initial page directory has been set up correctly.
 	//check_kern_pgdir();
 
-	// Switch from the minimal entry page directory to the full kern_pgdir
-	// page table we just created.	Our instruction pointer should be
-	// somewhere between KERNBASE and KERNBASE+4MB right now, which is
-	// mapped the same way by both page tables.
-	//
-	// If the machine reboots at this point, you've probably set up your
-	// kern_pgdir wrong.
-	lcr3(PADDR(kern_pgdir));
-
-	//check_page_free_list(0);
-
 	// entry.S set the really important flags in cr0 (including enabling
 	// paging).  Here we configure the rest of the flags that we care about.
 	cr0 = rcr0();
@@ -297,14 +310,89 @@ mem_init_mp(void)
 // --------------------------------------------------------------
 // Tracking of physical pages.
 // The 'pages' array has one 'struct PageInfo' entry per physical page.
-// Pages are reference counted, and free pages are kept on a linked list.
+// Pages are reference counted, and free pages are kept by a buddy
+// allocator: free memory is cut into blocks of 2^order pages, each
+// aligned to its size, with a free list per order.  Freeing a block
+// whose buddy (the other half of the block twice its size) is free too
+// merges the two, so runs of contiguous memory come back together.
 // --------------------------------------------------------------
 
+// Free blocks of each order, linked through pp_link and pp_prev
+static struct PageInfo *page_free_lists[PAGE_MAX_ORDER + 1];
+static size_t page_free_nblocks[PAGE_MAX_ORDER + 1];
+
+static void
+page_free_link(struct PageInfo *pp, int order)
+{
+	pp->pp_order = order;
+	pp->pp_prev = NULL;
+	pp->pp_link = page_free_lists[order];
+	if (page_free_lists[order])
+		page_free_lists[order]->pp_prev = pp;
+	page_free_lists[order] = pp;
+	page_free_nblocks[order]++;
+}
+
+static void
+page_free_unlink(struct PageInfo *pp, int order)
+{
+	if (pp->pp_prev)
+		pp->pp_prev->pp_link = pp->pp_link;
+	else
+		page_free_lists[order] = pp->pp_link;
+	if (pp->pp_link)
+		pp->pp_link->pp_prev = pp->pp_prev;
+	pp->pp_order = -1;
+	pp->pp_link = pp->pp_prev = NULL;
+	page_free_nblocks[order]--;
+}
+
+// Give back the block of 2^order pages starting at pp, merging it with
+// its buddy for as long as the buddy is free
+static void
+page_free_block(struct PageInfo *pp, int order)
+{
+	size_t pn = pp - pages, buddy;
+
+	num_free_pages += 1 << order;
+	for (; order < PAGE_MAX_ORDER; order++) {
+		buddy = pn ^ (1 << order);
+		if (buddy >= npages || pages[buddy].pp_order != order)
+			break;
+		page_free_unlink(&pages[buddy], order);
+		pn &= ~(1 << order);
+	}
+	page_free_link(&pages[pn], order);
+}
+
+// Take a block of 2^order pages off the free lists, splitting a bigger
+// block if there is none that size.  Returns its first page, or NULL.
+static struct PageInfo *
+page_alloc_block(int order)
+{
+	struct PageInfo *pp;
+	int k;
+
+	for (k = order; k <= PAGE_MAX_ORDER && !page_free_lists[k]; k++)
+		/* do nothing */;
+	if (k > PAGE_MAX_ORDER)
+		return NULL;
+	pp = page_free_lists[k];
+	page_free_unlink(pp, k);
+	// Give back the top half until the block is the right size
+	while (k > order) {
+		k--;
+		page_free_link(pp + (1 << k), k);
+	}
+	num_free_pages -= 1 << order;
+	return pp;
+}
+
 //
 // Initialize page structure and memory free list.
 // After this is done, NEVER use boot_alloc again.  ONLY use the page
 // allocator functions below to allocate and deallocate physical
-// memory via the page_free_list.
+// memory via the free lists.
 //
 void
 page_init(void)
@@ -332,27 +420,26 @@ page_init(void)
 	// free pages!
 	size_t i;
 	size_t address = 0; // will temporarily store the address of a page
-	page_free_list = 0; // initialize the bottom of the stack to NULL
 	num_free_pages = 0; // initialize the number of free pages
 	for (i = 0; i < npages; i++) {
-		address = i * PGSIZE;   // the physical address of this page
 		pages[i].pp_ref = 0;
+		pages[i].pp_link = pages[i].pp_prev = 0;
+		pages[i].pp_order = -1;
 		pages[i].age = PAGE_AGE_INITIAL;
                 pages[i].nfu_age = 0;
 		pages[i].timestamp = 9223372036854775807;
-		// Add this page to page_free_list in any of these cases:
+	}
+	// Free the free pages one at a time, and let the buddy allocator
+	// put them together into blocks.
+	for (i = 0; i < npages; i++) {
+		address = i * PGSIZE;   // the physical address of this page
+		// Free this page in any of these cases:
 		//  2) the address is in base memory [PGSIZE, npages_basemem * PGSIZE)
 		//  4) the address is in extended memory [EXTPHYSMEM, ...)
 		//       and isn't in the kernel memory and isn't already in use
 		//  TODO Make sure 4) is implemented correctly
-		if (((PGSIZE <= address && address < npages_basemem * PGSIZE) || (EXTPHYSMEM <= address && (boot_alloc(0) <= page2kva(&pages[i])))) && (address != MPENTRY_PADDR)) {
-			pages[i].pp_link = page_free_list;
-			page_free_list = &pages[i];
-			num_free_pages++;
-		}
-		else {  // if this page isn't free, give it NULL link
-			pages[i].pp_link = 0;
-		}
+		if (((PGSIZE <= address && address < npages_basemem * PGSIZE) || (EXTPHYSMEM <= address && (boot_alloc(0) <= page2kva(&pages[i])))) && (address != MPENTRY_PADDR))
+			page_free_block(&pages[i], 0);
 	}
 }
 
@@ -368,25 +455,52 @@ page_init(void)
 struct PageInfo *
 page_alloc(int alloc_flags)
 {
-	// Fill this function in
-	struct PageInfo *pp = NULL; // initialize to NULL, in case no memory
+	struct PageInfo *pp;
 
-	// If page_free_list isn't NULL, there is a page on top of the stack
-	// Pop the page from the stack and mark it as not free
-	if (page_free_list) {
-		pp = page_free_list;
-		page_free_list = page_free_list->pp_link;
-		pp->pp_link = 0;
-		pp->age = PAGE_AGE_INITIAL;
-		pp->pp_refs_chain = 0;
-		if (alloc_flags & ALLOC_ZERO) { // fills page with '\0' bytes
-			memset(page2kva(pp), 0, PGSIZE);
-		}
+	// Single pages are the common case: take one straight off the
+	// order 0 list when there is one, as cheap as popping a stack
+	if ((pp = page_free_lists[0])) {
+		page_free_unlink(pp, 0);
 		num_free_pages--;
+	} else if (!(pp = page_alloc_block(0)))
+		return NULL;
+
+	pp->age = PAGE_AGE_INITIAL;
+	pp->pp_refs_chain = 0;
+	if (alloc_flags & ALLOC_ZERO) { // fills page with '\0' bytes
+		memset(page2kva(pp), 0, PGSIZE);
 	}
 	return pp;
 }
 
+//
+// Allocates 2^order pages of contiguous physical memory, aligned to its
+// size, and returns the first of them.  Each page is like a page from
+// page_alloc: pp_ref is left at 0, and it is given back with page_free
+// on its own, whenever its last reference goes (the buddy allocator
+// puts the block back together).  If (alloc_flags & ALLOC_ZERO), fills
+// all of the memory with '\0' bytes.
+//
+// Returns NULL if there is no free block that big, or order is more than
+// PAGE_MAX_ORDER.
+//
+struct PageInfo *
+page_alloc_contig(int order, int alloc_flags)
+{
+	struct PageInfo *pp;
+	size_t i;
+
+	if (order < 0 || order > PAGE_MAX_ORDER || !(pp = page_alloc_block(order)))
+		return NULL;
+	for (i = 0; i < (1 << order); i++) {
+		pp[i].age = PAGE_AGE_INITIAL;
+		pp[i].pp_refs_chain = 0;
+	}
+	if (alloc_flags & ALLOC_ZERO)
+		memset(page2kva(pp), 0, PGSIZE << order);
+	return pp;
+}
+
 //
 // Return a page to the free list.
 // (This function should only be called when pp->pp_ref reaches 0.)
@@ -399,10 +513,46 @@ page_free(struct PageInfo *pp)
 		panic("page_free: called when pp->pp_ref != 0\n");
 	}
 	pp->age = PAGE_AGE_INITIAL;
-	// push the page back onto the stack of free pages
-	pp->pp_link = page_free_list;
-	page_free_list = pp;
-	num_free_pages++;
+	page_free_block(pp, 0);
+}
+
+//
+// Report how fragmented free memory is: store in nblocks[k] the number
+// of free blocks of order k, for each k up to PAGE_MAX_ORDER.  Returns
+// the number of free pages.
+//
+size_t
+page_free_stats(size_t *nblocks)
+{
+	memmove(nblocks, page_free_nblocks, sizeof(page_free_nblocks));
+	return num_free_pages;
+}
+
+//
+// Bring meminfo up to date with the number of free pages, and if the
+// memory pressure level changed, wake everyone waiting for it to.
+// Called on every clock tick.
+//
+void
+mem_pressure_update(void)
+{
+	static const size_t watermarks[] = {
+		[MEM_PRESSURE_LOW]	MEM_PRESSURE_LOW_PAGES,
+		[MEM_PRESSURE_MEDIUM]	MEM_PRESSURE_MEDIUM_PAGES,
+		[MEM_PRESSURE_CRITICAL]	MEM_PRESSURE_CRITICAL_PAGES,
+	};
+	uint32_t level = meminfo->mi_level;
+
+	meminfo->mi_free_pages = num_free_pages;
+	while (level < MEM_PRESSURE_CRITICAL && num_free_pages < watermarks[level + 1])
+		level++;
+	while (level > MEM_PRESSURE_NONE &&
+	       num_free_pages >= watermarks[level] + watermarks[level] / 4)
+		level--;
+	if (level == meminfo->mi_level)
+		return;
+	meminfo->mi_level = level;
+	env_futex_wake(PADDR((uint32_t *) &meminfo->mi_level), sizeof(uint32_t), NENV);
 }
 
 //
@@ -450,6 +600,15 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
 	struct PageInfo *pp;
 
 	pde = &pgdir[PDX(va)];
+	if ((*pde & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS)) {
+		// The kernel's large pages (see boot_map_region) have no page
+		// table: the page directory entry maps the whole 4MB, so it
+		// is all there is to return.  A user large page is split back
+		// into ordinary pages (see page_insert_large).
+		if (PDX(va) >= PDX(UTOP))
+			return pde;
+		page_split(pgdir, (void *) va);
+	}
 	if(*pde & PTE_P){
 		pgtab = (pte_t*)KADDR(PTE_ADDR(*pde));
 	}
@@ -475,6 +634,11 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
 // above UTOP. As such, it should *not* change the pp_ref field on the
 // mapped pages.
 //
+// Wherever both va and pa are 4MB-aligned and at least 4MB is left to
+// map, the 4MB is mapped with a single large (PTE_PS) page directory
+// entry instead of a page table.  The region may end at the top of the
+// address space, so we count down size rather than compare addresses.
+//
 // Hint: the TA solution uses pgdir_walk
 static void
 boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm)
@@ -482,19 +646,25 @@ boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm
 	// Fill this function in
 
 	// Code adapted from mappages() in vm.c from xv6 code
-	char *va_cp, *va_last_cp, *pa_cp;
+	pte_t *pte;
 	if (size % PGSIZE) {
 		panic("boot_map_region: size is not a multiple of PGSIZE");
 	}
-	va_cp = (char *)ROUNDDOWN((uint32_t)va, PGSIZE);
-	va_last_cp = (char *)(((uint32_t)va_cp) + size);
-	pa_cp = (char *)ROUNDDOWN((uint32_t)pa, PGSIZE);
-	pte_t *pte;
-	for ( ; va_cp < va_last_cp; va_cp += PGSIZE, pa_cp += PGSIZE) {
-		if ((pte = pgdir_walk(pgdir, (void *)va_cp, 1)) == NULL) {
+	va = ROUNDDOWN(va, PGSIZE);
+	pa = ROUNDDOWN(pa, PGSIZE);
+	while (size > 0) {
+		if (va % PTSIZE == 0 && pa % PTSIZE == 0 && size >= PTSIZE) {
+			pgdir[PDX(va)] = pa|perm|PTE_PS|PTE_P;
+			va += PTSIZE;
+			pa += PTSIZE;
+			size -= PTSIZE;
 			continue;
 		}
-		*pte = ((pte_t)pa_cp)|perm|PTE_P;
+		if ((pte = pgdir_walk(pgdir, (void *)va, 1)) != NULL)
+			*pte = pa|perm|PTE_P;
+		va += PGSIZE;
+		pa += PGSIZE;
+		size -= PGSIZE;
 	}
 }
 
@@ -502,6 +672,9 @@ boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm
 // Map the physical page 'pp' at virtual address 'va'.
 // The permissions (the low 12 bits) of the page table entry
 // should be set to 'perm|PTE_P'.
+// The mapping starts out dirty (PTE_D), since we don't know where the
+// page's contents came from.  Callers that just filled the page from
+// its backing store can mark it clean with page_clean.
 //
 // Requirements
 //   - If there is already a page mapped at 'va', it should be page_remove()d.
@@ -547,6 +720,7 @@ page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm, int *npages_s
 	pp->pp_refs_chain = temp_pc;
 	temp_pc->pc_pgdir = pgdir;
 	temp_pc->pc_env_va = (uintptr_t)va;
+	temp_pc->pc_pte = NULL;	// not to be mistaken for the old mapping's
 
 	// removes any page currently at va
 	// invalidates TLB
@@ -559,7 +733,7 @@ page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm, int *npages_s
 	}
 	temp_pc->pc_pte = pte;
 	// if pgdir_walk succeeds
-	*pte = ((pte_t)page2pa(pp))|perm|PTE_P; // set PTE with pa, perms
+	*pte = ((pte_t)page2pa(pp))|perm|PTE_P|PTE_D; // set PTE with pa, perms
 	if(npages_store)
 		++(*npages_store);
 	return 0;   // indicate that insert was successful
@@ -582,8 +756,9 @@ page_lookup(pde_t *pgdir, void *va, pte_t **pte_store)
 	// Fill this function in
 	pte_t *pte = pgdir_walk(pgdir, va, 0);  // walk pgdir, get va's PTE
 
-	// Return NULL if there is no page mapped at va.
-	if (pte == NULL || *pte == 0) {
+	// Return NULL if there is no page mapped at va.  A not-present
+	// entry may still hold PTE_AVAIL bits, or a swap slot (PTE_SWAPPED).
+	if (pte == NULL || !(*pte & PTE_P)) {
 		return NULL;
 	}
 
@@ -623,44 +798,577 @@ page_remove(pde_t *pgdir, void *va, int *npages_store)
 
 	// if a page was found at va
 	if (pp) {
+		page_remove_pte(pp, pte, npages_store);
 
-		// The pg table entry corresponding to 'va' should be cleared.
-		// We leave PTE_AVAIL set to allow persistent user level map data.
-		// NOTE: this is really hacky, but makes the rest of the paging
-		// implementation cleaner.
+		// The TLB must be invalidated.
+		tlb_invalidate(pgdir, va);
+	} else if ((pte = pgdir_walk(pgdir, va, 0)) && (*pte & PTE_SWAPPED)) {
+		// Forget a page a paging server took (see page_reclaim);
+		// its swap slot is the environment's to give back.
 		*pte &= PTE_AVAIL;
+	}
+}
+
+//
+// Does the work of page_remove for a PTE that is already known to map
+// 'pp', but leaves TLB invalidation to the caller.  This lets the range
+// functions below remove many mappings and then flush the TLB once.
+//
+static void
+page_remove_pte(struct PageInfo *pp, pte_t *pte, int *npages_store)
+{
+	// The pg table entry corresponding to 'va' should be cleared.
+	// We leave PTE_AVAIL set to allow persistent user level map data.
+	// NOTE: this is really hacky, but makes the rest of the paging
+	// implementation cleaner.
+	*pte &= PTE_AVAIL;
+
+	// Whoever is asleep on a word in the page may be waiting for this
+	// (the other end of a pipe closing, say), so let them look again.
+	if (pp->pp_futex_waiters)
+		env_futex_wake(page2pa(pp), PGSIZE, NENV);
+
+	// The ref count on the physical page should decrement.
+	// The physical page should be freed if the refcount reaches 0.
+	page_decref(pp);
+
+	// Remove the PteChain
+	struct PteChain **pcp, *pc;
+	for (pcp = &pp->pp_refs_chain; (pc = *pcp) != NULL; pcp = &pc->pc_link)
+		if (pc->pc_pte == pte) {
+			*pcp = pc->pc_link;
+			dealloc_pte_chain(pc);
+			break;
+		}
+	if(npages_store)
+		--(*npages_store);
+}
+
+//
+// Does the work of page_insert for a PTE that was already found with
+// pgdir_walk, without invalidating the TLB.  Returns 1 if a present
+// mapping was replaced (so the caller must flush the TLB), 0 otherwise.
+//
+static int
+page_insert_pte(pde_t *pgdir, pte_t *pte, struct PageInfo *pp, void *va, int perm, int *npages_store)
+{
+	int replaced = 0;
+
+	// Take the new reference first, so re-inserting the same page at
+	// the same address doesn't free it (see page_insert).  The new
+	// PteChain only gets its PTE once the old mapping is gone, so
+	// page_remove_pte takes the old one off the chain, not this one.
+	++(pp->pp_ref);
+	struct PteChain* temp_pc = alloc_pte_chain();
+	temp_pc->pc_link = pp->pp_refs_chain;
+	pp->pp_refs_chain = temp_pc;
+	temp_pc->pc_pgdir = pgdir;
+	temp_pc->pc_env_va = (uintptr_t)va;
+	temp_pc->pc_pte = NULL;
+
+	if (*pte & PTE_P) {
+		page_remove_pte(pa2page(PTE_ADDR(*pte)), pte, npages_store);
+		replaced = 1;
+	}
+	temp_pc->pc_pte = pte;
+
+	*pte = ((pte_t)page2pa(pp))|perm|PTE_P|PTE_D;
+	if(npages_store)
+		++(*npages_store);
+	return replaced;
+}
+
+//
+// Mark the page mapped at 'va' in 'pgdir' clean (clear PTE_D), because
+// it holds the same data as its backing store.  User environments use
+// this to drop such pages under memory pressure instead of swapping
+// them out.
+//
+void
+page_clean(pde_t *pgdir, void *va)
+{
+	pte_t *pte;
+
+	if ((pte = pgdir_walk(pgdir, va, 0)) && (*pte & PTE_D)) {
+		*pte &= ~PTE_D;
+		tlb_invalidate(pgdir, va);
+	}
+}
+
+//
+// Allocate 4MB of zeroed, contiguous physical memory and map it at the
+// 4MB-aligned address 'va' in 'pgdir' with a single large (PTE_PS) page
+// directory entry and permission 'perm|PTE_P'.  The range must be empty:
+// no page table may exist for it yet.
+//
+// The large page also gets an ordinary page table mapping the same
+// memory a page at a time.  The MMU never sees it, but it holds each
+// page's entry in the reverse map, and page_split just puts it in
+// place of the large page.  Anything that works on single pages of the
+// range goes through pgdir_walk, which splits the large page first, so
+// the rest of the kernel (and paging) only ever sees ordinary pages.
+//
+// RETURNS:
+//   0 on success
+//   -E_INVAL, if va isn't 4MB-aligned, or there is a page table for it
+//   -E_NO_MEM, if there isn't 4MB of contiguous free memory, or a page
+//     for the page table
+//
+int
+page_insert_large(pde_t *pgdir, void *va, int perm, int *npages_store)
+{
+	struct PageInfo *pp, *pt;
+	pte_t *ptes;
+	int i;
+
+	if ((uintptr_t) va % PTSIZE || pgdir[PDX(va)])
+		return -E_INVAL;
+	if (!(pt = page_alloc(ALLOC_ZERO)))
+		return -E_NO_MEM;
+	if (!(pp = page_alloc_contig(PAGE_MAX_ORDER, ALLOC_ZERO))) {
+		page_free(pt);
+		return -E_NO_MEM;
+	}
+
+	++(pt->pp_ref);
+	ptes = page2kva(pt);
+	for (i = 0; i < NPTENTRIES; i++)
+		page_insert_pte(pgdir, &ptes[i], &pp[i], va + i*PGSIZE, perm, npages_store);
+	// Nothing was mapped here, so there's nothing in the TLB to flush
+	pgdir[PDX(va)] = page2pa(pp)|perm|PTE_PS|PTE_P|PTE_D;
+	return 0;
+}
+
+//
+// If 'va' is in a user large page in 'pgdir', turn it back into ordinary
+// pages by putting its page table (see page_insert_large) in its place.
+// The page table is found through the reverse map entry of the large
+// page's first page.  Whether the large page was accessed is copied to
+// each of its pages, so page aging doesn't take them for idle.
+//
+void
+page_split(pde_t *pgdir, void *va)
+{
+	pde_t *pde = &pgdir[PDX(va)];
+	pte_t *ptes;
+	int i;
+
+	if ((*pde & (PTE_P|PTE_PS)) != (PTE_P|PTE_PS) || (uintptr_t) va >= UTOP)
+		return;
+	ptes = find_pte_va(pa2page(PTE_ADDR(*pde)), pgdir, ROUNDDOWN((uintptr_t) va, PTSIZE));
+	if (!ptes)
+		panic("page_split: large page at %p has no page table", va);
+	for (i = 0; i < NPTENTRIES; i++)
+		ptes[i] |= *pde & PTE_A;
+	*pde = PADDR(ptes)|PTE_P|PTE_W|PTE_U;
+	tlb_flush(pgdir);
+}
+
+// --------------------------------------------------------------
+// Range operations.
+// These do the same thing as calling page_alloc/page_insert,
+// page_lookup/page_insert and page_remove once per page, but only
+// walk the page directory once per page table (PTSIZE bytes of
+// address space) and do a single TLB flush for the whole range.
+// --------------------------------------------------------------
+
+//
+// Allocate and map 'npages' zeroed pages at [va, va + npages*PGSIZE)
+// in 'pgdir' with permission 'perm|PTE_P', replacing anything already
+// mapped there.  Allocation stops early (without error) if we run out
+// of free pages.
+//
+// RETURNS:
+//   the number of pages mapped, starting at va, if at least one was
+//   -E_NO_MEM, if not even one page (or its page table) could be allocated
+//
+int
+page_alloc_range(pde_t *pgdir, void *va, size_t npages, int perm, int *npages_store)
+{
+	size_t i = 0;
+	int flush = 0;
+	pte_t *pte = NULL;
+	struct PageInfo *pp;
+
+	for (i = 0; i < npages; i++, va += PGSIZE, pte++) {
+		// Only walk the page directory when we cross into a new
+		// page table.
+		if (i == 0 || PTX(va) == 0)
+			if (!(pte = pgdir_walk(pgdir, va, 1)))
+				break;
+		if (!(pp = page_alloc(ALLOC_ZERO)))
+			break;
+		flush |= page_insert_pte(pgdir, pte, pp, va, perm, npages_store);
+	}
+
+	if (flush)
+		tlb_flush(pgdir);
+	return i ? (int)i : -E_NO_MEM;
+}
+
+//
+// Map the 'npages' pages at [srcva, srcva + npages*PGSIZE) in 'srcpgdir'
+// at [dstva, dstva + npages*PGSIZE) in 'dstpgdir' with permission
+// 'perm|PTE_P'.  The source and destination ranges may be the same range
+// (to change permissions in place) but must not otherwise overlap.
+// Remapping a range onto itself only changes the permissions, and
+// leaves the pages exactly as dirty as they were; otherwise, mapping the
+// pages writable marks the source pages dirty, since they can now be
+// written through the new mappings.
+//
+// The whole source range is checked before anything is mapped.
+//
+// RETURNS:
+//   0 on success
+//   -E_INVAL, if a source page is unmapped, or (perm & PTE_W) but a
+//     source page is read-only
+//   -E_NO_MEM, if a page table couldn't be allocated.  Pages before the
+//     failing page table have been mapped; repeating the call is safe.
+//
+int
+page_map_range(pde_t *srcpgdir, void *srcva, pde_t *dstpgdir, void *dstva,
+	       size_t npages, int perm, int *npages_store)
+{
+	size_t i;
+	int flush = 0;
+	pte_t *srcpte = NULL, *dstpte = NULL, dirty;
+	void *va;
+	bool same = (srcpgdir == dstpgdir && srcva == dstva);
+
+	for (i = 0, va = srcva; i < npages; i++, va += PGSIZE, srcpte++) {
+		if (i == 0 || PTX(va) == 0)
+			if (!(srcpte = pgdir_walk(srcpgdir, va, 0)))
+				return -E_INVAL;
+		if (!(*srcpte & PTE_P) || ((perm & PTE_W) && !(*srcpte & PTE_W)))
+			return -E_INVAL;
+	}
+
+	for (i = 0; i < npages; i++, srcva += PGSIZE, dstva += PGSIZE, srcpte++, dstpte++) {
+		if (i == 0 || PTX(srcva) == 0)
+			srcpte = pgdir_walk(srcpgdir, srcva, 0);
+		if (i == 0 || PTX(dstva) == 0)
+			if (!(dstpte = pgdir_walk(dstpgdir, dstva, 1))) {
+				if (flush)
+					tlb_flush(dstpgdir);
+				return -E_NO_MEM;
+			}
+		dirty = same ? (*srcpte & PTE_D) : PTE_D;
+		if ((perm & PTE_W) && !same)
+			*srcpte |= PTE_D;
+		flush |= page_insert_pte(dstpgdir, dstpte, pa2page(PTE_ADDR(*srcpte)), dstva, perm, npages_store);
+		if (!dirty)
+			*dstpte &= ~PTE_D;
+	}
+
+	if (flush)
+		tlb_flush(dstpgdir);
+	return 0;
+}
 
-		// The ref count on the physical page should decrement.
-		// The physical page should be freed if the refcount reaches 0.
-		page_decref(pp);
-
-		// Remove the PteChain
-		struct PteChain* pc = pp->pp_refs_chain;
-		struct PteChain* temppc;
-		if (pc)
-		{
-			if (pc->pc_pte == pte)
-				pp->pp_refs_chain = pc->pc_link;
-			while (pc->pc_link != NULL)
-			{
-				temppc = pc->pc_link;
-				if (temppc->pc_pte == pte)
-				{
-					pc->pc_link = temppc->pc_link;
-					dealloc_pte_chain(temppc);
-					break;
-				}
-				pc = temppc;
+//
+// Unmap the 'npages' pages at [va, va + npages*PGSIZE) in 'pgdir'.
+// Page tables that don't exist are skipped entirely.
+//
+void
+page_remove_range(pde_t *pgdir, void *va, size_t npages, int *npages_store)
+{
+	size_t i;
+	int flush = 0;
+	pte_t *pte = NULL;
+
+	for (i = 0; i < npages; i++, va += PGSIZE, pte++) {
+		if (i == 0 || PTX(va) == 0) {
+			if (!(pte = pgdir_walk(pgdir, va, 0))) {
+				// No page table: skip to the next one
+				i += NPTENTRIES - PTX(va) - 1;
+				va = ROUNDDOWN(va, PTSIZE) + PTSIZE - PGSIZE;
+				continue;
 			}
 		}
-		if(npages_store)
-			--(*npages_store);
+		if (*pte & PTE_P) {
+			page_remove_pte(pa2page(PTE_ADDR(*pte)), pte, npages_store);
+			flush = 1;
+		} else if (*pte & PTE_SWAPPED)
+			*pte &= PTE_AVAIL;
+	}
 
-		// The TLB must be invalidated.
+	if (flush)
+		tlb_flush(pgdir);
+}
+
+//
+// Copy the user mappings of srcpgdir below 'limit' into dstpgdir, for
+// fork.  Follows the same rules as the user-level duppage:
+//   - PTE_SHARE pages are shared with the same permissions.
+//   - PTE_NO_PAGE pages (the paging library's mapping tables) are
+//     copied, so the child keeps its own record of which of its pages
+//     are paged out.
+//   - Writable and copy-on-write pages become copy-on-write in both.
+//   - Everything else is shared read-only.
+//   - Pages a paging server took (PTE_SWAPPED entries) are copied as
+//     they are; the library shares their swap slots with the child
+//     (see page_share_paged_out).
+// The child's copies are clean (PTE_D) exactly when ours are.
+// Page tables that aren't present in srcpgdir are skipped.
+//
+// RETURNS:
+//   0 on success
+//   -E_NO_MEM, if a page table or a mapping table copy couldn't be
+//     allocated.  dstpgdir is left partly filled in and should be freed.
+//
+int
+page_fork(pde_t *srcpgdir, pde_t *dstpgdir, uintptr_t limit, int *npages_store)
+{
+	uintptr_t va;
+	pte_t *srcpte, *dstpt = NULL;
+	struct PageInfo *pp;
+	int perm, flush = 0, r = 0;
+	uint32_t dstpdx = NPDENTRIES;
+
+	for (va = 0; va < limit; va += PGSIZE) {
+		if ((srcpgdir[PDX(va)] & (PTE_P|PTE_U)) != (PTE_P|PTE_U)) {
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE - PGSIZE;
+			continue;
+		}
+		// Copy-on-write works a page at a time
+		if (srcpgdir[PDX(va)] & PTE_PS)
+			page_split(srcpgdir, (void *) va);
+		srcpte = (pte_t *) KADDR(PTE_ADDR(srcpgdir[PDX(va)])) + PTX(va);
+		if ((*srcpte & (PTE_P|PTE_U)) != (PTE_P|PTE_U) &&
+		    (*srcpte & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+			continue;
+		// Only walk dstpgdir once per page table
+		if (PDX(va) != dstpdx) {
+			if (!(dstpt = pgdir_walk(dstpgdir, (void *) va, 1))) {
+				r = -E_NO_MEM;
+				break;
+			}
+			dstpt -= PTX(va);
+			dstpdx = PDX(va);
+		}
+		if (!(*srcpte & PTE_P)) {
+			dstpt[PTX(va)] = *srcpte;
+			continue;
+		}
+
+		pp = pa2page(PTE_ADDR(*srcpte));
+		perm = *srcpte & PTE_SYSCALL;
+		if (*srcpte & PTE_SHARE) {
+			// Shared as is
+		} else if (*srcpte & PTE_NO_PAGE) {
+			struct PageInfo *copy = page_alloc(0);
+			if (!copy) {
+				r = -E_NO_MEM;
+				break;
+			}
+			memcpy(page2kva(copy), page2kva(pp), PGSIZE);
+			pp = copy;
+		} else if (*srcpte & (PTE_W|PTE_COW)) {
+			perm = (perm & ~PTE_W) | PTE_COW;
+			*srcpte = PTE_ADDR(*srcpte) | perm | (*srcpte & PTE_D);
+			flush = 1;
+		}
+		page_insert_pte(dstpgdir, dstpt + PTX(va), pp, (void *) va, perm, npages_store);
+		if (!(*srcpte & PTE_D))
+			dstpt[PTX(va)] &= ~PTE_D;
+	}
+
+	if (flush)
+		tlb_flush(srcpgdir);
+	return r;
+}
+
+//
+// Resolve a write fault on the copy-on-write page at 'va' in 'pgdir'.
+// If nobody else maps the page any more it is simply made writable;
+// otherwise it is replaced by a private writable copy.
+//
+// RETURNS:
+//   0 on success
+//   -E_INVAL, if va isn't mapped copy-on-write
+//   -E_NO_MEM, if we're too low on memory to copy the page.  The
+//     caller should leave the fault to the environment, which can page
+//     something out first.
+//
+int
+page_cow(pde_t *pgdir, void *va, int *npages_store)
+{
+	pte_t *pte;
+	struct PageInfo *pp, *copy;
+	int perm;
+
+	va = ROUNDDOWN(va, PGSIZE);
+	if ((uintptr_t) va >= UTOP || !(pte = pgdir_walk(pgdir, va, 0)))
+		return -E_INVAL;
+	if ((*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+		return -E_INVAL;
+
+	pp = pa2page(PTE_ADDR(*pte));
+	perm = ((*pte & PTE_SYSCALL) & ~PTE_COW) | PTE_W;
+	if (pp->pp_ref == 1) {
+		*pte = PTE_ADDR(*pte) | perm;
 		tlb_invalidate(pgdir, va);
+		return 0;
+	}
+
+	if (num_free_pages < SOFT_MIN_FREE_PAGES || !(copy = page_alloc(0)))
+		return -E_NO_MEM;
+	memcpy(page2kva(copy), page2kva(pp), PGSIZE);
+	page_insert_pte(pgdir, pte, copy, va, perm, npages_store);
+	tlb_invalidate(pgdir, va);
+	return 0;
+}
+
+//
+// Environments page_reclaim may take pages from, by page directory.
+// Only user environments that run the paging library (they have a
+// mapping directory at UMAPDIR, and a page fault handler that reads
+// PTE_SWAPPED entries) and that are between time slices or blocked
+// receiving, so they have nothing in flight that a page could vanish
+// from under, are included, and only while they have more pages than
+// their guarantee.  If any of them is over its limit (it was lowered
+// after it grew), only those are.  An environment that is still some
+// CPU's curenv is left out too: env_run doesn't reload %cr3 when it
+// resumes it there, so that CPU's TLB may still map its pages.
+//
+static struct {
+	pde_t *pgdir;
+	struct Env *env;
+} reclaim_envs[NENV];
+static int reclaim_nenvs;
+
+static bool
+env_on_cpu(struct Env *e)
+{
+	int i;
+
+	for (i = 0; i < ncpu; i++)
+		if (cpus[i].cpu_env == e)
+			return 1;
+	return 0;
+}
+
+static void
+reclaim_envs_init(void)
+{
+	struct Env *e;
+	bool over = 0;
+
+	reclaim_nenvs = 0;
+	for (e = envs; e < envs + NENV; e++) {
+		if (e->env_type != ENV_TYPE_USER || e->env_pagein_pager ||
+		    env_on_cpu(e) ||
+		    !(e->env_status == ENV_RUNNABLE ||
+		      (e->env_status == ENV_NOT_RUNNABLE && e->env_ipc_recving)) ||
+		    e->env_npages <= e->env_rss_min ||
+		    !page_lookup(e->env_pgdir, (void *) UMAPDIR, NULL))
+			continue;
+		if (e->env_rss_max && e->env_npages > e->env_rss_max) {
+			if (!over)
+				reclaim_nenvs = 0;
+			over = 1;
+		} else if (over)
+			continue;
+		reclaim_envs[reclaim_nenvs].pgdir = e->env_pgdir;
+		reclaim_envs[reclaim_nenvs].env = e;
+		reclaim_nenvs++;
 	}
 }
 
+// The environment in reclaim_envs whose page 'va' of page directory
+// 'pgdir' may be taken, or NULL.  Pages of the program itself aren't:
+// the paging library's own variables are among them.
+static struct Env *
+reclaim_env(pde_t *pgdir, uintptr_t va)
+{
+	struct Segment *seg;
+	int i;
+
+	for (i = 0; i < reclaim_nenvs && reclaim_envs[i].pgdir != pgdir; i++)
+		/* do nothing */;
+	if (i == reclaim_nenvs)
+		return NULL;
+	for (seg = reclaim_envs[i].env->env_segs; seg < reclaim_envs[i].env->env_segs + NSEGS; seg++)
+		if (va >= seg->seg_va && va - seg->seg_va < seg->seg_memsz)
+			return NULL;
+	return reclaim_envs[i].env;
+}
+
+//
+// Take the coldest page in the system away from the environment it is
+// mapped in, for the paging server 'pager', which is about to write it
+// to swap slot 'slot'.  The page is mapped at 'va' in the pager, and
+// the owner's page table entry is left not present, holding PTE_SWAPPED,
+// the slot and the page's permissions, from which the owner's paging
+// library pages it back in when it next touches it.
+//
+// The candidates are the pages that a single environment from
+// reclaim_envs (which heeds resident-set limits) maps, once, privately
+// (not PTE_SHARE, PTE_NO_PAGE or PTE_COW) and below its top stack
+// page, and that are older than PAGE_AGE_COLD (see the aging in
+// trap_dispatch) and haven't been touched (PTE_A) since they were last
+// aged.  pages[] is searched from where the last search
+// stopped, for the one with the lowest age.
+//
+// RETURNS:
+//   the envid of the page's owner, on success
+//   -E_NO_MEM, if there is no such page, or no memory for a page table
+//     at va in the pager
+//
+int
+page_reclaim(struct Env *pager, void *va, uint32_t slot)
+{
+	static size_t hand;
+	struct PageInfo *pp, *victim = NULL;
+	struct PteChain *pc;
+	struct Env *e, *owner = NULL;
+	uintptr_t owner_va = 0;
+	pte_t *pte;
+	size_t n;
+	int perm;
+
+	reclaim_envs_init();
+	for (n = 0; n < npages; n++) {
+		pp = &pages[(hand + n) % npages];
+		if (pp->pp_ref != 1 || !(pc = pp->pp_refs_chain) || pc->pc_link ||
+		    pp->pp_futex_waiters || pp->age >= PAGE_AGE_COLD ||
+		    (victim && pp->age >= victim->age))
+			continue;
+		if ((*pc->pc_pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U) ||
+		    (*pc->pc_pte & (PTE_SHARE|PTE_NO_PAGE|PTE_COW)) ||
+		    pc->pc_env_va >= USTACKTOP - PGSIZE ||
+		    (pc->pc_pgdir[PDX(pc->pc_env_va)] & PTE_PS) ||
+		    !(e = reclaim_env(pc->pc_pgdir, pc->pc_env_va)))
+			continue;
+		if (*pc->pc_pte & PTE_A) {
+			// Touched since it was last aged: give it a second
+			// chance, as the aging in trap_dispatch would.  No
+			// CPU has the owner loaded (see reclaim_envs_init), so
+			// its next touch sets the bit again.
+			*pc->pc_pte &= ~PTE_A;
+			pp->age = MIN(pp->age + PAGE_AGE_INCREMENT_ON_ACCESS, MAX_PAGE_AGE);
+			continue;
+		}
+		victim = pp;
+		owner = e;
+		owner_va = pc->pc_env_va;
+		if (pp->age == 0)
+			break;
+	}
+	if (!victim)
+		return -E_NO_MEM;
+	hand = (victim - pages + 1) % npages;
+
+	pte = victim->pp_refs_chain->pc_pte;
+	perm = *pte & (PTE_SYSCALL & ~PTE_P);
+	if (page_insert(pager->env_pgdir, victim, va, PTE_P|PTE_U, &pager->env_npages) < 0)
+		return -E_NO_MEM;
+	page_remove(owner->env_pgdir, (void *) owner_va, &owner->env_npages);
+	*pte = (slot << PTXSHIFT) | perm | PTE_SWAPPED;
+	owner->env_rss_reclaimed++;
+	return owner->env_id;
+}
+
 //
 // Invalidate a TLB entry, but only if the page tables being
 // edited are the ones currently in use by the processor.
@@ -673,6 +1381,18 @@ tlb_invalidate(pde_t *pgdir, void *va)
 		invlpg(va);
 }
 
+//
+// Invalidate the whole TLB, but only if the page tables being edited
+// are the ones currently in use by the processor.  Cheaper than many
+// tlb_invalidate calls once a batch touches more than a few pages.
+//
+void
+tlb_flush(pde_t *pgdir)
+{
+	if (!curenv || curenv->env_pgdir == pgdir)
+		lcr3(rcr3());
+}
+
 //
 // Reserve size bytes in the MMIO region and map [pa,pa+size) at this
 // location.  Return the base of the reserved region.  size does *not*
@@ -752,7 +1472,12 @@ user_mem_check(struct Env *env, const void *va, size_t len, int perm)
 	perm |= PTE_P;
 
 	for ( ; va_cp < va_last_cp; va_cp += PGSIZE) {
-		pte = pgdir_walk(env->env_pgdir, (void *)va_cp, 0);
+		// A large page's permissions are in its page directory
+		// entry; looking at it mustn't split it (see pgdir_walk)
+		if ((uintptr_t)va_cp < UTOP && (env->env_pgdir[PDX(va_cp)] & PTE_PS))
+			pte = &env->env_pgdir[PDX(va_cp)];
+		else
+			pte = pgdir_walk(env->env_pgdir, (void *)va_cp, 0);
 		if ((((uintptr_t)va_cp) >= ULIM) || (!pte) || ((PGOFF(*pte) & perm) != perm)) {
 			user_mem_check_addr = ((uintptr_t)va_cp < (uintptr_t)va ? (uintptr_t)va : (uintptr_t)va_cp);
 			return -E_FAULT;
@@ -784,60 +1509,54 @@ user_mem_assert(struct Env *env, const void *va, size_t len, int perm)
 // --------------------------------------------------------------
 
 //
-// Check that the pages on the page_free_list are reasonable.
+// Check that the blocks on the free lists are reasonable.
 //
 static void
-check_page_free_list(bool only_low_memory)
+check_page_free_list(void)
 {
-	struct PageInfo *pp;
-	unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+	struct PageInfo *pp, *block;
 	int nfree_basemem = 0, nfree_extmem = 0;
 	char *first_free_page;
-
-	if (!page_free_list)
-		panic("'page_free_list' is a null pointer!");
-
-	if (only_low_memory) {
-		// Move pages with lower addresses first in the free
-		// list, since entry_pgdir does not map all pages.
-		struct PageInfo *pp1, *pp2;
-		struct PageInfo **tp[2] = { &pp1, &pp2 };
-		for (pp = page_free_list; pp; pp = pp->pp_link) {
-			int pagetype = PDX(page2pa(pp)) >= pdx_limit;
-			*tp[pagetype] = pp;
-			tp[pagetype] = &pp->pp_link;
-		}
-		*tp[1] = 0;
-		*tp[0] = pp2;
-		page_free_list = pp1;
-	}
-
-	// if there's a page that shouldn't be on the free list,
-	// try to make sure it eventually causes trouble.
-	for (pp = page_free_list; pp; pp = pp->pp_link)
-		if (PDX(page2pa(pp)) < pdx_limit)
-			memset(page2kva(pp), 0x97, 128);
+	size_t i, nblocks;
+	int order;
 
 	first_free_page = (char *) boot_alloc(0);
-	for (pp = page_free_list; pp; pp = pp->pp_link) {
-		// check that we didn't corrupt the free list itself
-		assert(pp >= pages);
-		assert(pp < pages + npages);
-		assert(((char *) pp - (char *) pages) % sizeof(*pp) == 0);
-
-		// check a few pages that shouldn't be on the free list
-		assert(page2pa(pp) != 0);
-		assert(page2pa(pp) != IOPHYSMEM);
-		assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
-		assert(page2pa(pp) != EXTPHYSMEM);
-		assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
-		// (new test for lab 4)
-		assert(page2pa(pp) != MPENTRY_PADDR);
-
-		if (page2pa(pp) < EXTPHYSMEM)
-			++nfree_basemem;
-		else
-			++nfree_extmem;
+	for (order = 0; order <= PAGE_MAX_ORDER; order++) {
+		nblocks = 0;
+		for (block = page_free_lists[order]; block; block = block->pp_link) {
+			// check that we didn't corrupt the free list itself
+			assert(block >= pages);
+			assert(block < pages + npages);
+			assert(((char *) block - (char *) pages) % sizeof(*block) == 0);
+			assert(block->pp_order == order);
+			assert((block - pages) % (1 << order) == 0);
+			assert(!block->pp_link || block->pp_link->pp_prev == block);
+			nblocks++;
+
+			for (i = 0; i < (1 << order); i++) {
+				pp = block + i;
+
+				// if there's a page that shouldn't be free,
+				// try to make sure it eventually causes trouble.
+				if (PDX(page2pa(pp)) < 1)
+					memset(page2kva(pp), 0x97, 128);
+
+				// check a few pages that shouldn't be free
+				assert(page2pa(pp) != 0);
+				assert(page2pa(pp) != IOPHYSMEM);
+				assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+				assert(page2pa(pp) != EXTPHYSMEM);
+				assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+				// (new test for lab 4)
+				assert(page2pa(pp) != MPENTRY_PADDR);
+
+				if (page2pa(pp) < EXTPHYSMEM)
+					++nfree_basemem;
+				else
+					++nfree_extmem;
+			}
+		}
+		assert(nblocks == page_free_nblocks[order]);
 	}
 
 	assert(nfree_basemem > 0);
@@ -862,8 +1581,7 @@ check_page_alloc(void)
 		panic("'pages' is a null pointer!");
 
 	// check number of free pages
-	for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
-		++nfree;
+	nfree = num_free_pages;
 
 	// should be able to allocate three pages
 	pp0 = pp1 = pp2 = 0;
@@ -879,8 +1597,11 @@ check_page_alloc(void)
 	assert(page2pa(pp2) < npages*PGSIZE);
 
 	// temporarily steal the rest of the free pages
-	fl = page_free_list;
-	page_free_list = 0;
+	fl = 0;
+	while ((pp = page_alloc(0))) {
+		pp->pp_link = fl;
+		fl = pp;
+	}
 
 	// should be no free memory
 	assert(!page_alloc(0));
@@ -908,7 +1629,11 @@ check_page_alloc(void)
 		assert(c[i] == 0);
 
 	// give free list back
-	page_free_list = fl;
+	while ((pp = fl)) {
+		fl = pp->pp_link;
+		pp->pp_link = 0;
+		page_free(pp);
+	}
 
 	// free the pages we took
 	page_free(pp0);
@@ -916,9 +1641,7 @@ check_page_alloc(void)
 	page_free(pp2);
 
 	// number of free pages should be the same
-	for (pp = page_free_list; pp; pp = pp->pp_link)
-		--nfree;
-	assert(nfree == 0);
+	assert(nfree == num_free_pages);
 
 	cprintf("check_page_alloc() succeeded!\n");
 }
@@ -999,6 +1722,8 @@ check_va2pa(pde_t *pgdir, uintptr_t va)
 	pgdir = &pgdir[PDX(va)];
 	if (!(*pgdir & PTE_P))
 		return ~0;
+	if (*pgdir & PTE_PS)
+		return PTE_ADDR(*pgdir) + PTX(va) * PGSIZE;
 	p = (pte_t*) KADDR(PTE_ADDR(*pgdir));
 	if (!(p[PTX(va)] & PTE_P))
 		return ~0;
@@ -1029,8 +1754,11 @@ check_page(void)
 	assert(pp2 && pp2 != pp1 && pp2 != pp0);
 
 	// temporarily steal the rest of the free pages
-	fl = page_free_list;
-	page_free_list = 0;
+	fl = 0;
+	while ((pp = page_alloc(0))) {
+		pp->pp_link = fl;
+		fl = pp;
+	}
 
 	// should be no free memory
 	assert(!page_alloc(0));
@@ -1145,7 +1873,11 @@ check_page(void)
 	pp0->pp_ref = 0;
 
 	// give free list back
-	page_free_list = fl;
+	while ((pp = fl)) {
+		fl = pp->pp_link;
+		pp->pp_link = 0;
+		page_free(pp);
+	}
 
 	// free the pages we took
 	page_free(pp0);
@@ -14,6 +14,7 @@ extern char bootstacktop[], bootstack[];
 
 extern struct PageInfo *pages;
 extern size_t npages, num_free_pages;
+extern struct Meminfo *meminfo;
 
 extern pde_t *kern_pgdir;
 
@@ -51,17 +52,36 @@ enum {
 	ALLOC_ZERO = 1<<0,
 };
 
+// The biggest block page_alloc_contig hands out is 2^PAGE_MAX_ORDER
+// pages: 4MB, a large page.
+#define PAGE_MAX_ORDER	10
+
 void	mem_init(void);
 
 void	page_init(void);
 struct PageInfo *page_alloc(int alloc_flags);
+struct PageInfo *page_alloc_contig(int order, int alloc_flags);
 void	page_free(struct PageInfo *pp);
+size_t	page_free_stats(size_t *nblocks);
+void	mem_pressure_update(void);
 int	page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm, int *npages_store);
 void	page_remove(pde_t *pgdir, void *va, int *npages_store);
 struct PageInfo *page_lookup(pde_t *pgdir, void *va, pte_t **pte_store);
+void	page_clean(pde_t *pgdir, void *va);
 void	page_decref(struct PageInfo *pp);
+int	page_insert_large(pde_t *pgdir, void *va, int perm, int *npages_store);
+void	page_split(pde_t *pgdir, void *va);
+
+int	page_alloc_range(pde_t *pgdir, void *va, size_t npages, int perm, int *npages_store);
+int	page_map_range(pde_t *srcpgdir, void *srcva, pde_t *dstpgdir, void *dstva,
+		       size_t npages, int perm, int *npages_store);
+void	page_remove_range(pde_t *pgdir, void *va, size_t npages, int *npages_store);
+int	page_fork(pde_t *srcpgdir, pde_t *dstpgdir, uintptr_t limit, int *npages_store);
+int	page_cow(pde_t *pgdir, void *va, int *npages_store);
+int	page_reclaim(struct Env *pager, void *va, uint32_t slot);
 
 void	tlb_invalidate(pde_t *pgdir, void *va);
+void	tlb_flush(pde_t *pgdir);
 
 void *	mmio_map_region(physaddr_t pa, size_t size);
 
@@ -49,6 +49,21 @@ find_pte(struct PageInfo* pp, pte_t filter, struct PteChain** pc_store)
 	return 0;
 }
 
+// Find the pte that maps the physical page at va in pgdir.
+// Returns NULL if there is none.
+pte_t*
+find_pte_va(struct PageInfo* pp, pde_t* pgdir, uintptr_t va)
+{
+	struct PteChain* pc;
+	for (pc = pp->pp_refs_chain; pc != NULL; pc = pc->pc_link)
+	{
+		if (pc->pc_pgdir == pgdir && pc->pc_env_va == va)
+			return pc->pc_pte;
+	}
+
+	return NULL;
+}
+
 // Initialize the reverse map linked lists, memory allocation, etc.
 // NOTE: Not currently used. free_pte_chain is automatically 0, and
 // we don't need to allocate the initial page for PteChains, since
@@ -15,6 +15,7 @@ struct PteChain
 };
 
 int              find_pte(struct PageInfo* pp, pte_t filter, struct PteChain** pc_store);
+pte_t*           find_pte_va(struct PageInfo* pp, pde_t* pgdir, uintptr_t va);
 void             init_reverse_map();
 struct PteChain* alloc_pte_chain();
 int              alloc_pte_chain_page();
@@ -96,9 +96,61 @@ sys_exofork(void)
 	memmove((void *)(&(e->env_tf)), (void *)(&(curenv->env_tf)), (size_t)(sizeof(struct Trapframe)));
 	e->env_tf.tf_regs.reg_eax = 0;
 
+	// Pages of our segments that haven't been loaded yet get loaded
+	// on demand in the child too.
+	memmove(e->env_segs, curenv->env_segs, sizeof(e->env_segs));
+
 	return e->env_id;
 }
 
+// Fork the current environment in one step: like sys_exofork, but
+// the child also gets a copy-on-write copy of our address space below
+// USTACKTOP (see page_fork), a fresh exception stack, and our page
+// fault upcall.  Like sys_exofork, the child is left not runnable, so
+// the caller can finish setting it up (e.g. take references on swap
+// slots its mapping tables share with ours) before starting it.
+// Write faults on the copy-on-write pages are resolved by the kernel
+// (see page_fault_handler), so the child needs no help from the parent.
+//
+// Returns envid of new environment, or < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.  Nothing is left behind, so the
+//		caller may page something out and retry, or fall back to
+//		a user-level fork.
+static envid_t
+sys_fork(void)
+{
+	struct Env *e;
+	struct PageInfo *p;
+	int r;
+
+	if (num_free_pages < SOFT_MIN_FREE_PAGES)
+		return -E_NO_MEM;
+	if ((r = env_alloc(&e, curenv->env_id)) < 0)
+		return r;
+	e->env_status = ENV_NOT_RUNNABLE;
+	e->env_tf = curenv->env_tf;
+	e->env_tf.tf_regs.reg_eax = 0;
+	e->env_pgfault_upcall = curenv->env_pgfault_upcall;
+	memmove(e->env_segs, curenv->env_segs, sizeof(e->env_segs));
+
+	if ((r = page_fork(curenv->env_pgdir, e->env_pgdir, USTACKTOP, &e->env_npages)) < 0)
+		goto bad;
+	r = -E_NO_MEM;
+	if (!(p = page_alloc(ALLOC_ZERO)))
+		goto bad;
+	if (page_insert(e->env_pgdir, p, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W, &e->env_npages) < 0) {
+		page_free(p);
+		goto bad;
+	}
+
+	return e->env_id;
+
+bad:
+	env_free(e);
+	return r;
+}
+
 // Set envid's env_status to status, which must be ENV_RUNNABLE
 // or ENV_NOT_RUNNABLE.
 //
@@ -127,6 +179,40 @@ sys_env_set_status(envid_t envid, int status)
 	return 0;
 }
 
+// Set envid's resident-set guarantee to 'min' pages and its limit to
+// 'max' pages, or no limit if max is 0.
+// While free memory is short, an environment's share is the larger of
+// an even split of memory among all environments and its guarantee, and
+// the paging servers take none of its pages while it has no more than
+// its guarantee (see page_reclaim).  An environment at its limit is
+// refused memory outright, so it pages out its own pages to make room.
+// Children inherit both.
+// An environment can hand on part of its own guarantee and tighten its
+// own limit, but neither can be set above the caller's: only the kernel
+// (and its monitor) gives out more.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if min or max is negative, max is nonzero and below min,
+//		or either is above the caller's own.
+static int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+	struct Env *e;
+
+	if (envid2env(envid, &e, 1) < 0) {
+		return -E_BAD_ENV;
+	}
+	if (min < 0 || max < 0 || (max && max < min) || min > curenv->env_rss_min ||
+	    (curenv->env_rss_max && (!max || max > curenv->env_rss_max))) {
+		return -E_INVAL;
+	}
+	e->env_rss_min = min;
+	e->env_rss_max = max;
+	return 0;
+}
+
 // Set envid's trap frame to 'tf'.
 // tf is modified to make sure that user environments always run at code
 // protection level 3 (CPL 3) with interrupts enabled.
@@ -151,6 +237,52 @@ sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
 	return 0;
 }
 
+// Set envid's lazily loaded segments to the 'nsegs' segments at 'segs',
+// replacing any it had.  The pages of each segment are read in from the
+// segment's pager (see env_segment_fault) when envid first touches them,
+// so they should not already be mapped.  seg_va and seg_offset must be
+// page-aligned, and seg_memsz and seg_filesz count from seg_va.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid,
+//		or a segment's pager doesn't exist.
+//	-E_INVAL if nsegs is more than NSEGS, or a segment is not page-aligned,
+//		is not below UTOP, has more file than memory, or has
+//		inappropriate permissions (see sys_page_alloc).
+static int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+	struct Env *e, *pager;
+	struct Segment *seg;
+	int i;
+
+	if (envid2env(envid, &e, 1) < 0)
+		return -E_BAD_ENV;
+	if (nsegs < 0 || nsegs > NSEGS)
+		return -E_INVAL;
+	user_mem_assert(curenv, segs, nsegs * sizeof(struct Segment), PTE_U);
+	for (i = 0; i < nsegs; i++) {
+		if (PGOFF(segs[i].seg_va) || PGOFF(segs[i].seg_offset)
+		    || segs[i].seg_va >= UTOP || segs[i].seg_memsz > UTOP - segs[i].seg_va
+		    || segs[i].seg_filesz > segs[i].seg_memsz)
+			return -E_INVAL;
+		if ((segs[i].seg_perm & (PTE_U|PTE_P)) != (PTE_U|PTE_P)
+		    || (segs[i].seg_perm & ~(PTE_U|PTE_P|PTE_W)))
+			return -E_INVAL;
+		if (segs[i].seg_filesz && envid2env(segs[i].seg_pager, &pager, 0) < 0)
+			return -E_BAD_ENV;
+	}
+
+	memset(e->env_segs, 0, sizeof(e->env_segs));
+	for (i = 0; i < nsegs; i++) {
+		seg = &e->env_segs[i];
+		*seg = segs[i];
+		seg->seg_binary = NULL;
+	}
+	return 0;
+}
+
 // Set the page fault upcall for 'envid' by modifying the corresponding struct
 // Env's 'env_pgfault_upcall' field.  When 'envid' causes a page fault, the
 // kernel will push a fault record onto the exception stack, then branch to
@@ -171,6 +303,15 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func)
 	return 0;
 }
 
+// The most pages e may have when free memory runs short (see
+// sys_env_set_rss)
+static int
+env_share(struct Env *e)
+{
+	assert(NENV - num_free_envs > 0);
+	return MAX((int) (npages / (NENV - num_free_envs)), e->env_rss_min);
+}
+
 // Allocate a page of memory and map it at 'va' with permission
 // 'perm' in the address space of 'envid'.
 // The page's contents are set to 0.
@@ -179,6 +320,10 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func)
 //
 // perm -- PTE_U | PTE_P must be set, PTE_AVAIL | PTE_W may or may not be set,
 //         but no other bits may be set.  See PTE_SYSCALL in inc/mmu.h.
+//         The exception is PTE_PS, which asks for a 4MB large page of
+//         contiguous memory instead, at a 4MB-aligned 'va' that has no
+//         page table yet (see page_insert_large).  Large pages are
+//         private: PTE_AVAIL may not be set with PTE_PS.
 //
 // Return 0 on success, < 0 on error.  Errors are:
 //	-E_BAD_ENV if environment envid doesn't currently exist,
@@ -213,20 +358,30 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 	}
 
 	// return -E_INVAL if perm is inappropriate.
-	if (((perm & (PTE_U | PTE_P)) ^ (PTE_U | PTE_P)) | (perm & (~(PTE_U | PTE_P | PTE_AVAIL | PTE_W)))) {
+	if (((perm & (PTE_U | PTE_P)) ^ (PTE_U | PTE_P)) | (perm & (~(PTE_U | PTE_P | PTE_AVAIL | PTE_W | PTE_PS)))) {
 		return -E_INVAL;
 	}
 
-	// refuse to allocate memory if we're running low on free pages and the
-	// environment is using more than its share
-	extern size_t num_free_envs;
-	assert(NENV - num_free_envs > 0);
-	if(num_free_pages < SOFT_MIN_FREE_PAGES && e->env_npages > npages / (NENV - num_free_envs))
+	// refuse to allocate memory if the environment is at its limit, or
+	// we're running low on free pages and it is using more than its share
+	if (e->env_rss_max && e->env_npages >= e->env_rss_max)
+		return -E_NO_MEM;
+	if(num_free_pages < SOFT_MIN_FREE_PAGES && e->env_npages > env_share(e))
 		return -E_NO_MEM;
 
 	if(num_free_pages < HARD_MIN_FREE_PAGES)
 		return -E_NO_MEM;
 
+	// A large page mustn't take the pages held back for everyone else
+	if (perm & PTE_PS) {
+		if (perm & PTE_AVAIL)
+			return -E_INVAL;
+		if (num_free_pages < SOFT_MIN_FREE_PAGES + NPTENTRIES ||
+		    (e->env_rss_max && e->env_npages + NPTENTRIES > e->env_rss_max))
+			return -E_NO_MEM;
+		return page_insert_large(e->env_pgdir, va, perm & ~PTE_PS, &e->env_npages);
+	}
+
 	// allocate a page of memory
 	p = page_alloc(ALLOC_ZERO);
 
@@ -277,6 +432,7 @@ sys_page_map(envid_t srcenvid, void *srcva,
 	struct PageInfo *p = 0;
 	struct Env *srcenv, *dstenv;
 	pte_t *pte;
+	bool same, clean;
 
 	// return -E_BAD_ENV if srcenvid and/or dstenvid doesn't currently exist, or the caller doesn't have permission to change one of them.
 	if ((envid2env(srcenvid, &srcenv, 1) < 0) || (envid2env(dstenvid, &dstenv, 1) < 0)) {
@@ -304,11 +460,24 @@ sys_page_map(envid_t srcenvid, void *srcva,
 		return -E_INVAL;
 	}
 
+	// If the page can now be written through the new mapping, the old
+	// mapping's dirty bit no longer tells whether the page is clean.
+	// Remapping a page onto itself only changes its permissions: it
+	// stays exactly as dirty as it was (see sys_page_clean).
+	same = (srcenv == dstenv && srcva == dstva);
+	clean = same && !(*pte & PTE_D);
+	if ((perm & PTE_W) && !same) {
+		*pte |= PTE_D;
+	}
+
 	// map the page at dstva in environment dstenv.
 	// return -E_NO_MEM if there's no memory to allocate any necessary page tables.
 	if (page_insert(dstenv->env_pgdir, p, dstva, perm, &dstenv->env_npages) < 0) {
 		return -E_NO_MEM;
 	}
+	if (clean) {
+		page_clean(dstenv->env_pgdir, dstva);
+	}
 
 	// Return 0 on success.
 	return 0;
@@ -346,9 +515,369 @@ sys_page_unmap(envid_t envid, void *va)
 	return 0;
 }
 
+// Turn the large page containing 'va' in envid's address space back
+// into ordinary pages, which can be paged out one at a time.  Does
+// nothing if 'va' isn't in a large page.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if va >= UTOP.
+static int
+sys_page_split(envid_t envid, void *va)
+{
+	struct Env *e;
+
+	if (envid2env(envid, &e, 1) < 0) {
+		return -E_BAD_ENV;
+	}
+	if ((uint32_t)va >= UTOP) {
+		return -E_INVAL;
+	}
+
+	page_split(e->env_pgdir, va);
+	return 0;
+}
+
+// For paging servers only: page out the coldest page in the system on
+// behalf of envid, which is short of memory.  The page is taken from
+// whichever environment has it (see page_reclaim) and mapped at 'va' in
+// the caller, which writes it to swap slot 'slot', then unmaps it.
+// envid is refused if sys_page_alloc would still hold its limit or its
+// share of memory against it: it should page out one of its own pages
+// instead.
+//
+// Returns the envid of the page's owner on success, < 0 on error.
+// Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist, or the
+//		caller isn't a paging server.
+//	-E_INVAL if va >= UTOP, or va is not page-aligned.
+//	-E_NO_MEM if envid is at its limit or has more than its share, or
+//		there is no page cold enough to take.
+static int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+	struct Env *e;
+
+	if (curenv->env_type != ENV_TYPE_PAGE || envid2env(envid, &e, 0) < 0) {
+		return -E_BAD_ENV;
+	}
+	if ((((uint32_t)va) >= UTOP) || ((uint32_t)va)%PGSIZE) {
+		return -E_INVAL;
+	}
+	if ((e->env_rss_max && e->env_npages >= e->env_rss_max) ||
+	    (num_free_pages < SOFT_MIN_FREE_PAGES && e->env_npages > env_share(e))) {
+		return -E_NO_MEM;
+	}
+
+	return page_reclaim(curenv, va, slot);
+}
+
+// Return -E_INVAL unless [va, va + npg*PGSIZE) is a page-aligned,
+// non-empty range that lies entirely below UTOP.
+static int
+check_user_range(void *va, size_t npg)
+{
+	if ((((uint32_t)va) >= UTOP) || ((uint32_t)va)%PGSIZE) {
+		return -E_INVAL;
+	}
+	if (npg == 0 || npg > (UTOP - (uint32_t)va) / PGSIZE) {
+		return -E_INVAL;
+	}
+	return 0;
+}
+
+// Like sys_page_alloc, but allocates 'npg' consecutive pages
+// starting at 'va'.  The arguments are checked once for the whole range,
+// and the page table is only walked once per PTSIZE bytes.
+//
+// If memory runs low part way through, the pages allocated so far are
+// left mapped and their count is returned; the caller can free up memory
+// and ask for the rest.
+//
+// Returns the number of pages allocated (> 0) on success, < 0 on error.
+// Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if the range isn't page-aligned, is empty, or reaches UTOP.
+//	-E_INVAL if perm is inappropriate (see sys_page_alloc).
+//	-E_NO_MEM if not even the first page could be allocated.
+static int
+sys_page_alloc_range(envid_t envid, void *va, size_t npg, int perm)
+{
+	struct Env *e;
+	size_t nfree;
+
+	if (envid2env(envid, &e, 1) < 0) {
+		return -E_BAD_ENV;
+	}
+	if (check_user_range(va, npg) < 0) {
+		return -E_INVAL;
+	}
+	if (((perm & (PTE_U | PTE_P)) ^ (PTE_U | PTE_P)) | (perm & (~(PTE_U | PTE_P | PTE_AVAIL | PTE_W)))) {
+		return -E_INVAL;
+	}
+
+	// Apply the same low-memory policy as sys_page_alloc, but work out
+	// up front how many pages the environment may take.
+	if(num_free_pages < HARD_MIN_FREE_PAGES)
+		return -E_NO_MEM;
+	if(e->env_npages > env_share(e))
+		nfree = (num_free_pages > SOFT_MIN_FREE_PAGES ? num_free_pages - SOFT_MIN_FREE_PAGES : 0);
+	else
+		nfree = num_free_pages - HARD_MIN_FREE_PAGES;
+	if (e->env_rss_max)
+		nfree = MIN(nfree, (size_t) MAX(e->env_rss_max - e->env_npages, 0));
+	if (nfree == 0)
+		return -E_NO_MEM;
+
+	return page_alloc_range(e->env_pgdir, va, MIN(npg, nfree), perm, &e->env_npages);
+}
+
+// Like sys_page_map, but maps 'npg' consecutive pages.
+// A system call only has five argument registers, so 'perm' is passed
+// in the page offset bits of 'dstva_perm'; the address part must be
+// page-aligned as usual.  The whole source range must be mapped, and
+// it must be writable if PTE_W is requested; this is checked before
+// anything is mapped.  Source and destination may be the same range,
+// which changes the permissions of the pages in place.
+//
+// Return 0 on success, < 0 on error.  Errors are the same as for
+// sys_page_map, plus -E_INVAL if either range is empty or reaches UTOP.
+static int
+sys_page_map_range(envid_t srcenvid, void *srcva,
+		   envid_t dstenvid, uint32_t dstva_perm, size_t npg)
+{
+	struct Env *srcenv, *dstenv;
+	void *dstva = (void *)ROUNDDOWN(dstva_perm, PGSIZE);
+	int perm = PGOFF(dstva_perm);
+
+	if ((envid2env(srcenvid, &srcenv, 1) < 0) || (envid2env(dstenvid, &dstenv, 1) < 0)) {
+		return -E_BAD_ENV;
+	}
+	if ((check_user_range(srcva, npg) < 0) || (check_user_range(dstva, npg) < 0)) {
+		return -E_INVAL;
+	}
+	if (((perm & (PTE_U | PTE_P)) ^ (PTE_U | PTE_P)) | (perm & (~(PTE_U | PTE_P | PTE_AVAIL | PTE_W)))) {
+		return -E_INVAL;
+	}
+
+	return page_map_range(srcenv->env_pgdir, srcva, dstenv->env_pgdir, dstva, npg, perm, &dstenv->env_npages);
+}
+
+// Like sys_page_unmap, but unmaps 'npg' consecutive pages.
+// Unmapped pages in the range are silently skipped.
+//
+// Return 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if the range isn't page-aligned, is empty, or reaches UTOP.
+static int
+sys_page_unmap_range(envid_t envid, void *va, size_t npg)
+{
+	struct Env *e;
+
+	if (envid2env(envid, &e, 1) < 0) {
+		return -E_BAD_ENV;
+	}
+	if (check_user_range(va, npg) < 0) {
+		return -E_INVAL;
+	}
+
+	page_remove_range(e->env_pgdir, va, npg, &e->env_npages);
+	return 0;
+}
+
+// Mark the 'npg' pages at 'va' in envid's address space clean, because
+// they hold the same data as their backing store (see flush_block in
+// fs/bc.c).  Clean pages that the paging library knows how to read back
+// in are dropped instead of swapped out under memory pressure, so only
+// call this once the data really is safe elsewhere.
+// Unmapped pages in the range are silently skipped.
+//
+// Return 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if the range isn't page-aligned, is empty, or reaches UTOP.
+static int
+sys_page_clean(envid_t envid, void *va, size_t npg)
+{
+	struct Env *e;
+	size_t i;
+
+	if (envid2env(envid, &e, 1) < 0) {
+		return -E_BAD_ENV;
+	}
+	if (check_user_range(va, npg) < 0) {
+		return -E_INVAL;
+	}
+
+	for (i = 0; i < npg; i++, va += PGSIZE)
+		page_clean(e->env_pgdir, va);
+	return 0;
+}
+
+// Map the npg pages at srcva in srcenv, the sender of an IPC, at dstva
+// in dstenv, the receiver, with permissions perm.  The sender's pages
+// have all been checked by sys_ipc_send.
+// Returns 0 on success, -E_NO_MEM if there's not enough memory for the
+// page tables.  On failure, the pages mapped so far are unmapped again,
+// so the receiver doesn't get part of a message it never receives.
+static int
+ipc_map_pages(struct Env *srcenv, void *srcva, struct Env *dstenv, void *dstva, size_t npg, int perm)
+{
+	struct PageInfo *p;
+	size_t i;
+	int r = 0;
+
+	for (i = 0; i < npg; i++) {
+		if (!(p = page_lookup(srcenv->env_pgdir, srcva + i*PGSIZE, NULL))) {
+			r = -E_INVAL;
+			break;
+		}
+		if ((r = page_insert(dstenv->env_pgdir, p, dstva + i*PGSIZE, perm, &dstenv->env_npages)) < 0) {
+			break;
+		}
+	}
+	if (r < 0 && i > 0) {
+		page_remove_range(dstenv->env_pgdir, dstva, i, &dstenv->env_npages);
+	}
+	return r;
+}
+
+// Check the npg pages at srcva that the current environment wants to
+// send with permissions perm, for sys_ipc_send and friends, and store
+// the first in *pp.  The pages are marked dirty if the receiver may
+// write them.
+// Returns 0 on success, -E_INVAL if srcva, npg or perm is bad, or one
+// of the pages isn't mapped (writable, if perm has PTE_W).
+static int
+ipc_check_pages(void *srcva, unsigned perm, size_t npg, struct PageInfo **pp)
+{
+	size_t i;
+	pte_t *pte;
+
+	// return -E_INVAL if srcva is not page-aligned, or the range is bad.
+	if (check_user_range(srcva, npg) < 0) {
+		return -E_INVAL;
+	}
+
+	// return -E_INVAL if perm is inappropriate.
+	if (((perm & (PTE_U | PTE_P)) ^ (PTE_U | PTE_P)) | (perm & (~(PTE_U | PTE_P | PTE_AVAIL | PTE_W)))) {
+		return -E_INVAL;
+	}
+
+	for (i = npg; i-- > 0; ) {
+		// get the page and pte mapped at srcva in the current environment.
+		// return -E_INVAL is srcva is not mapped in curenv's address space.
+		if (!(*pp = page_lookup(curenv->env_pgdir, srcva + i*PGSIZE, &pte))) {
+			return -E_INVAL;
+		}
+
+		// return -E_INVAL if (perm & PTE_W), but srcva is read-only in srcenvid's
+		if ((perm & PTE_W) && !(*pte & PTE_W)) {
+			return -E_INVAL;
+		}
+	}
+
+	// The receiver may write the pages, so ours are no longer clean.
+	if (perm & PTE_W) {
+		for (i = 0; i < npg; i++) {
+			page_lookup(curenv->env_pgdir, srcva + i*PGSIZE, &pte);
+			*pte |= PTE_D;
+		}
+	}
+	return 0;
+}
+
+// Is dstenv blocked waiting for an IPC that the current environment
+// may send it now?  An env waiting for a page-in only takes the reply
+// from its pager, and one blocked in sys_ipc_call only the reply from
+// the env it called.
+static bool
+ipc_can_deliver(struct Env *dstenv)
+{
+	return dstenv->env_ipc_recving && dstenv->env_status == ENV_NOT_RUNNABLE
+		&& (!dstenv->env_pagein_pager || dstenv->env_pagein_pager == curenv->env_id)
+		&& (!dstenv->env_ipc_callee || dstenv->env_ipc_callee == curenv->env_id);
+}
+
+// Deliver an IPC from the current environment to dstenv, which
+// ipc_can_deliver says is waiting for it: 'value', and the npg pages at
+// srcva (checked by ipc_check_pages; the first is p) if srcva < UTOP.
+// dstenv is made runnable again.
+// Returns 0 on success, -E_NO_MEM if there's not enough memory to map
+// the pages in dstenv's address space.
+static int
+ipc_deliver(struct Env *dstenv, uint32_t value, void *srcva, size_t npg, unsigned perm, struct PageInfo *p)
+{
+	int r;
+
+	// If the target is waiting for its pager's reply to a page fault.
+	if (dstenv->env_pagein_pager) {
+		env_pagein_done(dstenv, value, p, perm);
+		return 0;
+	}
+
+	npg = MIN(npg, dstenv->env_ipc_dstnpg);
+	if (((uint32_t)dstenv->env_ipc_dstva < UTOP) && ((uint32_t)srcva < UTOP)) {
+		// map the pages at dstva in environment dstenv.
+		// return -E_NO_MEM if there's no memory to allocate any necessary page tables.
+		if ((r = ipc_map_pages(curenv, srcva, dstenv, dstenv->env_ipc_dstva, npg, perm)) < 0) {
+			return r;
+		}
+	}
+	dstenv->env_ipc_recving = 0;
+	dstenv->env_ipc_callee = 0;
+	dstenv->env_ipc_from = curenv->env_id;
+	dstenv->env_ipc_value = value;
+	dstenv->env_ipc_perm = perm;
+	dstenv->env_ipc_npages = npg;
+	dstenv->env_tf.tf_regs.reg_eax = 0; // makes sys_ipc_recv return 0
+	dstenv->env_status = ENV_RUNNABLE;
+	return 0;
+}
+
+// Save an IPC from the current environment to dstenv, which isn't
+// waiting for it yet, and block until dstenv takes it (see
+// ipc_recv_blocked_sender).  Does not return.
+static void
+ipc_block_sender(struct Env *dstenv, uint32_t value, void *srcva, size_t npg, unsigned perm, struct PageInfo *p)
+{
+	struct Env *e;
+
+	// Save the IPC data in the curenv.
+	curenv->env_ipc_page = p;
+	curenv->env_ipc_srcva_sending = srcva;
+	curenv->env_ipc_npg_sending = npg;
+	curenv->env_ipc_value_sending = value;
+	curenv->env_ipc_perm_sending = perm;
+
+	// Add the curenv to the end of the linked list of environments waiting
+	// to send to the target.
+	// env_ipc_blocked_sender points to the first waiting environment.
+	// The rest of the waiting environments are found by repeatedly
+	// following the env_ipc_blocked_sender_chain pointer.
+	if (!dstenv->env_ipc_blocked_sender) {
+		dstenv->env_ipc_blocked_sender = curenv;
+	}
+	else {
+		for (e = dstenv->env_ipc_blocked_sender; e->env_ipc_blocked_sender_chain; e = e->env_ipc_blocked_sender_chain) ;
+		e->env_ipc_blocked_sender_chain = curenv;
+	}
+
+	// Block until the IPC occurs, when the target will mark this process as ENV_RUNNABLE.
+	// This function will not return;
+	// sys_ipc_recv will ensure that the system call returns the correct value to the user program.
+	curenv->env_status = ENV_NOT_RUNNABLE;
+	sched_yield();
+}
+
 // Try to send 'value' to the target env 'envid'.
-// If srcva < UTOP, then also send page currently mapped at 'srcva',
-// so that receiver gets a duplicate mapping of the same page.
+// If srcva < UTOP, then also send the 'npg' pages currently mapped
+// starting at 'srcva', so that receiver gets duplicate mappings of the
+// same pages.  As many of them are mapped as the receiver asked for,
+// onto consecutive pages starting at its dstva.
 //
 // The send can fail for the reasons listed below.
 //
@@ -358,7 +887,8 @@ sys_page_unmap(envid_t envid, void *va)
 //    env_ipc_recving is set to 0 to block future sends;
 //    env_ipc_from is set to the sending envid;
 //    env_ipc_value is set to the 'value' parameter;
-//    env_ipc_perm is set to 'perm' if a page was transferred, 0 otherwise.
+//    env_ipc_perm is set to 'perm' if a page was transferred, 0 otherwise;
+//    env_ipc_npages is set to the number of pages transferred.
 // The target environment is marked runnable again, returning 0
 // from the paused sys_ipc_recv system call.
 //
@@ -376,106 +906,168 @@ sys_page_unmap(envid_t envid, void *va)
 // Errors are:
 //	-E_BAD_ENV if environment envid doesn't currently exist.
 //		(No need to check permissions.)
-//	-E_INVAL if srcva < UTOP but srcva is not page-aligned.
+//	-E_INVAL if srcva < UTOP but srcva is not page-aligned,
+//		or npg is 0 or runs past UTOP.
 //	-E_INVAL if srcva < UTOP and perm is inappropriate
 //		(see sys_page_alloc).
-//	-E_INVAL if srcva < UTOP but srcva is not mapped in the caller's
-//		address space.
-//	-E_INVAL if (perm & PTE_W), but srcva is read-only in the
-//		current environment's address space.
-//	-E_NO_MEM if there's not enough memory to map srcva in envid's
+//	-E_INVAL if srcva < UTOP but one of the pages is not mapped in
+//		the caller's address space.
+//	-E_INVAL if (perm & PTE_W), but one of the pages is read-only in
+//		the current environment's address space.
+//	-E_NO_MEM if there's not enough memory to map the pages in envid's
 //		address space.
 static int
-sys_ipc_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, unsigned perm, size_t npg)
 {
 	// LAB 4: Your code here.
 	int r;
 	struct PageInfo *p = 0;
-	struct Env *dstenv, *e;
-	pte_t *pte;
+	struct Env *dstenv;
 	if (envid2env(envid, &dstenv, 0) < 0) {
 		return -E_BAD_ENV;
 	}
 	if ((uint32_t)srcva < UTOP) {
-
-		// return -E_INVAL if srcva is not page-aligned.
-		if (((uint32_t)srcva)%PGSIZE) {
-			return -E_INVAL;
+		if ((r = ipc_check_pages(srcva, perm, npg, &p)) < 0) {
+			return r;
 		}
+	}
+	else {
+		perm = 0;
+		npg = 0;
+	}
 
-		// return -E_INVAL if perm is inappropriate.
-		if (((perm & (PTE_U | PTE_P)) ^ (PTE_U | PTE_P)) | (perm & (~(PTE_U | PTE_P | PTE_AVAIL | PTE_W)))) {
-			return -E_INVAL;
-		}
+	// If the target is not blocked waiting for an IPC from us, wait.
+	if (!ipc_can_deliver(dstenv)) {
+		ipc_block_sender(dstenv, value, srcva, npg, perm, p);
+	}
 
-		// get the page and pte mapped at srcva in the current environment.
-		// return -E_INVAL is srcva is not mapped in curenv's address space.
-		if (!(p = page_lookup(curenv->env_pgdir, srcva, &pte))) {
-			return -E_INVAL;
-		}
+	return ipc_deliver(dstenv, value, srcva, npg, perm, p);
+}
 
-		// return -E_INVAL if (perm & PTE_W), but srcva is read-only in srcenvid's
-		if ((perm & PTE_W) && !(*pte & PTE_W)) {
-			return -E_INVAL;
-		}
+// Send 'value' to the target env 'envid', like sys_ipc_send, and then
+// wait for its reply, like sys_ipc_recv, in one system call: a
+// synchronous call to a server.
+//
+// If srcva < UTOP, the window of 'npg' pages starting at 'srcva' is
+// both sent (if perm is nonzero) and where any pages of the reply are
+// mapped.  Only 'envid' can reply; other senders wait until we're done.
+//
+// If the target is already waiting for an IPC, it is handed this CPU
+// straight away instead of going through the scheduler; likewise, a
+// server that answers with sys_ipc_reply_recv hands it back to us.
+// Otherwise the request waits in the target's list of blocked senders,
+// and the call goes on waiting for the reply once the target has
+// taken it.
+//
+// Returns 0 once the reply has arrived (in env_ipc_value etc., as for
+// sys_ipc_recv), < 0 on error.  Errors are those of sys_ipc_send.
+static int
+sys_ipc_call(envid_t envid, uint32_t value, void *srcva, size_t npg, unsigned perm)
+{
+	int r;
+	struct PageInfo *p = 0;
+	struct Env *dstenv;
+	if (envid2env(envid, &dstenv, 0) < 0 || dstenv == curenv) {
+		return -E_BAD_ENV;
 	}
-	else {
+	if ((uint32_t)srcva < UTOP && check_user_range(srcva, npg) < 0) {
+		return -E_INVAL;
+	}
+	if ((uint32_t)srcva < UTOP && perm && (r = ipc_check_pages(srcva, perm, npg, &p)) < 0) {
+		return r;
+	}
+
+	// Where the reply goes, once the target has taken the request.
+	curenv->env_ipc_callee = dstenv->env_id;
+	curenv->env_ipc_dstva = srcva;
+	curenv->env_ipc_dstnpg = (uint32_t)srcva < UTOP ? npg : 0;
+	if ((uint32_t)srcva >= UTOP || !perm) {
+		srcva = (void *)UTOP;
 		perm = 0;
+		npg = 0;
 	}
 
-	// If the target is not blocked waiting for an IPC.
-	if (!dstenv->env_ipc_recving || dstenv->env_status!=ENV_NOT_RUNNABLE) {
+	if (!ipc_can_deliver(dstenv)) {
+		ipc_block_sender(dstenv, value, srcva, npg, perm, p);
+	}
+	if ((r = ipc_deliver(dstenv, value, srcva, npg, perm, p)) < 0) {
+		curenv->env_ipc_callee = 0;
+		return r;
+	}
 
-		// Save the IPC data in the curenv.
-		curenv->env_ipc_page = p;
-		curenv->env_ipc_value_sending = value;
-		curenv->env_ipc_perm_sending = perm;
+	// Wait for the reply, lending the target the rest of our turn.
+	curenv->env_ipc_recving = 1;
+	curenv->env_status = ENV_NOT_RUNNABLE;
+	env_run(dstenv);
+	return 0;
+}
 
-		// Add the curenv to the end of the linked list of environments waiting
-		// to send to the target.
-		// env_ipc_blocked_sender points to the first waiting environment.
-		// The rest of the waiting environments are found by repeatedly
-		// following the env_ipc_blocked_sender_chain pointer.
-		if (!dstenv->env_ipc_blocked_sender) {
-			dstenv->env_ipc_blocked_sender = curenv;
-		}
-		else {
-			for (e = dstenv->env_ipc_blocked_sender; e->env_ipc_blocked_sender_chain; e = e->env_ipc_blocked_sender_chain) ;
-			e->env_ipc_blocked_sender_chain = curenv;
-		}
+// Take the IPC from the environment at the head of our list of blocked
+// senders, if there is one, mapping up to dstnpg of the pages it sends
+// at dstva.  Senders whose pages we can't map are given -E_NO_MEM, and
+// we go on to the next one.
+// Returns 1 if an IPC was received, 0 if no sender is waiting.
+static int
+ipc_recv_blocked_sender(void *dstva, size_t dstnpg)
+{
+	struct Env *srcenv;
+	size_t npg;
 
-		// Block until the IPC occurs, when the target will mark this process as ENV_RUNNABLE.
-		// This function will not return;
-		// sys_ipc_recv will ensure that the system call returns the correct value to the user program.
-		curenv->env_status = ENV_NOT_RUNNABLE;
-		sched_yield();
+find_sender:
+	if (!(srcenv = curenv->env_ipc_blocked_sender)) {
+		return 0;
 	}
 
-	// If the targetis blocked waiting for an IPC.
+	// If there is a blocked sender, pop it from the head of the linked list of senders, and mark it as runnable.
+	curenv->env_ipc_blocked_sender = srcenv->env_ipc_blocked_sender_chain;
+	srcenv->env_ipc_blocked_sender_chain = 0;
+
+	// A sender that is asking us for a page-in (see env_segment_fault)
+	// keeps waiting for our reply.  If we can't take its request,
+	// it gives up and faults again later.
+	if (srcenv->env_pagein_pager) {
+		if ((uint32_t)dstva >= UTOP || page_insert(curenv->env_pgdir, srcenv->env_ipc_page, dstva, srcenv->env_ipc_perm_sending, &curenv->env_npages) < 0) {
+			env_pagein_cancel(srcenv);
+			goto find_sender;
+		}
+		npg = 1;
+	}
 	else {
-		if (((uint32_t)dstenv->env_ipc_dstva < UTOP) && ((uint32_t)srcva < UTOP)) {
-			// map the page at dstva in environment dstenv.
-			// return -E_NO_MEM if there's no memory to allocate any necessary page tables.
-			if ((r = page_insert(dstenv->env_pgdir, p, (void *)dstenv->env_ipc_dstva, perm, &dstenv->env_npages)) < 0) {
-				return r;
+		srcenv->env_status = ENV_RUNNABLE;
+
+		// If a page mapping is in order, attempt the insertion.
+		// If it fails, return the appropriate error code from the source's call to sys_ipc_send,
+		// and try again with the next blocked sender.
+		npg = 0;
+		if (((uint32_t)dstva < UTOP) && srcenv->env_ipc_page) {
+			npg = MIN(srcenv->env_ipc_npg_sending, dstnpg);
+			if (ipc_map_pages(srcenv, srcenv->env_ipc_srcva_sending, curenv, dstva, npg, srcenv->env_ipc_perm_sending) < 0) {
+				srcenv->env_ipc_callee = 0;
+				srcenv->env_tf.tf_regs.reg_eax = -E_NO_MEM; // makes sys_ipc_send return -E_NO_MEM
+				goto find_sender;  // go back to the top to try again with the next blocked sender in the linked list
 			}
 		}
-		dstenv->env_ipc_recving = 0;
-		dstenv->env_ipc_from = curenv->env_id;
-		dstenv->env_ipc_value = value;
-		dstenv->env_ipc_perm = perm;
-		dstenv->env_tf.tf_regs.reg_eax = 0; // makes sys_ipc_recv return 0
-		dstenv->env_status = ENV_RUNNABLE;
+		srcenv->env_tf.tf_regs.reg_eax = 0; // makes sys_ipc_send return 0
+
+		// A sender in sys_ipc_call now waits for our reply.
+		if (srcenv->env_ipc_callee) {
+			srcenv->env_ipc_recving = 1;
+			srcenv->env_status = ENV_NOT_RUNNABLE;
+		}
 	}
 
-	// Return 0 on success.
-	return 0;
+	// Store the values from the IPC in the curenv.
+	curenv->env_ipc_from = srcenv->env_id;
+	curenv->env_ipc_value = srcenv->env_ipc_value_sending;
+	curenv->env_ipc_perm = srcenv->env_ipc_perm_sending;
+	curenv->env_ipc_npages = npg;
+	return 1;
 }
 
 // If there isn't an environment blocked waiting to send to this environment,
 // block until a value is ready.  Record that you want to receive
-// using the env_ipc_recving and env_ipc_dstva fields of struct Env,
-// mark yourself not runnable, and then give up the CPU.
+// using the env_ipc_recving, env_ipc_dstva and env_ipc_dstnpg fields of
+// struct Env, mark yourself not runnable, and then give up the CPU.
 //
 // If there is an environment blocked waiting to send to this environment,
 // process the IPC immediately. The target ipc fields are
@@ -483,53 +1075,32 @@ sys_ipc_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 //    env_ipc_recving is set to 0;
 //    env_ipc_from is set to the sending envid;
 //    env_ipc_value is set to the 'value' parameter;
-//    env_ipc_perm is set to 'perm' if a page was transferred, 0 otherwise.
+//    env_ipc_perm is set to 'perm' if a page was transferred, 0 otherwise;
+//    env_ipc_npages is set to the number of pages transferred.
 // The sending environment is marked runnable again, returning 0
 // from the paused sys_ipc_send system call.
 //
-// If 'dstva' is < UTOP, then you are willing to receive a page of data.
-// 'dstva' is the virtual address at which the sent page should be mapped.
+// If 'dstva' is < UTOP, then you are willing to receive up to 'npg'
+// pages of data, which are mapped at consecutive pages starting at
+// 'dstva'.
 //
 // Return 0 on success.
 // Return < 0 on error.  Errors are:
-//	-E_INVAL if dstva < UTOP but dstva is not page-aligned.
+//	-E_INVAL if dstva < UTOP but dstva is not page-aligned,
+//		or npg is 0 or runs past UTOP.
 static int
-sys_ipc_recv(void *dstva)
+sys_ipc_recv(void *dstva, size_t npg)
 {
 	// LAB 4: Your code here.
-	struct Env *srcenv;
-	if (((uint32_t)dstva < UTOP) && (((uint32_t)dstva)%PGSIZE)) {
+	if (((uint32_t)dstva < UTOP) && check_user_range(dstva, npg) < 0) {
 		return -E_INVAL;
 	}
-sys_ipc_recv_find_sender:
-	if ((srcenv = curenv->env_ipc_blocked_sender)) {
-
-		// If there is a blocked sender, pop it from the head of the linked list of senders, and mark it as runnable.
-		curenv->env_ipc_blocked_sender = srcenv->env_ipc_blocked_sender_chain;
-		srcenv->env_ipc_blocked_sender_chain = 0;
-		srcenv->env_status = ENV_RUNNABLE;
-
-		// If a page mapping is in order, attempt the insertion.
-		// If it fails, return the appropriate error code from the source's call to sys_ipc_send,
-		// and try again with the next blocked sender.
-		if (((uint32_t)dstva < UTOP) && srcenv->env_ipc_page) {
-			if (page_insert(curenv->env_pgdir, srcenv->env_ipc_page, dstva, srcenv->env_ipc_perm_sending, &curenv->env_npages) < 0) {
-				srcenv->env_tf.tf_regs.reg_eax = -E_NO_MEM; // makes sys_ipc_send return -E_NO_MEM
-				goto sys_ipc_recv_find_sender;  // go back to the top to try again with the next blocked sender in the linked list
-			}
-		}
-
-		// Store the values from the IPC in the curenv.
-		curenv->env_ipc_from = srcenv->env_id;
-		curenv->env_ipc_value = srcenv->env_ipc_value_sending;
-		curenv->env_ipc_perm = srcenv->env_ipc_perm_sending;
-		srcenv->env_tf.tf_regs.reg_eax = 0; // makes sys_ipc_send return 0
-	}
-	else {
+	if (!ipc_recv_blocked_sender(dstva, npg)) {
 		// If there is no blocked sender (or if all waiting sends failed),
 		// block and wait for the next send.
 		curenv->env_ipc_recving = 1;
 		curenv->env_ipc_dstva = dstva;
+		curenv->env_ipc_dstnpg = (uint32_t)dstva < UTOP ? npg : 0;
 		curenv->env_status = ENV_NOT_RUNNABLE;
 		sched_yield();
 	}
@@ -541,62 +1112,157 @@ sys_ipc_recv_find_sender:
 // is no sender blocked, waiting to send an IPC.
 //
 // If there is an environment blocked waiting to send to this environment,
-// process the IPC immediately. The target ipc fields are
-// updated as follows:
-//    env_ipc_recving is set to 0;
-//    env_ipc_from is set to the sending envid;
-//    env_ipc_value is set to the 'value' parameter;
-//    env_ipc_perm is set to 'perm' if a page was transferred, 0 otherwise.
-// The sending environment is marked runnable again, returning 0
-// from the paused sys_ipc_send system call.
+// process the IPC immediately, as sys_ipc_recv does.
 //
-// If 'dstva' is < UTOP, then you are willing to receive a page of data.
-// 'dstva' is the virtual address at which the sent page should be mapped.
+// If 'dstva' is < UTOP, then you are willing to receive up to 'npg'
+// pages of data, which are mapped at consecutive pages starting at
+// 'dstva'.
 //
 // Return 0 on success.
 // Return < 0 on error.  Errors are:
 //	-E_IPC_NOT_SEND if no sender is currently blocked in sys_ipc_send.
-//	-E_INVAL if dstva < UTOP but dstva is not page-aligned.
+//	-E_INVAL if dstva < UTOP but dstva is not page-aligned,
+//		or npg is 0 or runs past UTOP.
 static int
-sys_ipc_try_recv(void *dstva)
+sys_ipc_try_recv(void *dstva, size_t npg)
 {
 	// LAB 4: Your code here.
-	struct Env *srcenv;
-	if (((uint32_t)dstva < UTOP) && (((uint32_t)dstva)%PGSIZE)) {
+	if (((uint32_t)dstva < UTOP) && check_user_range(dstva, npg) < 0) {
 		return -E_INVAL;
 	}
-sys_ipc_try_recv_find_sender:
-	if ((srcenv = curenv->env_ipc_blocked_sender)) {
+	if (!ipc_recv_blocked_sender(dstva, npg)) {
+		// If there is no blocked sender (or if all waiting sends failed),
+		// fail with a return value of -E_IPC_NOT_SEND.
+		return -E_IPC_NOT_SEND;
+	}
+	return 0;
+}
 
-		// If there is a blocked sender, pop it from the head of the linked list of senders, and mark it as runnable.
-		curenv->env_ipc_blocked_sender = srcenv->env_ipc_blocked_sender_chain;
-		srcenv->env_ipc_blocked_sender_chain = 0;
-		srcenv->env_status = ENV_RUNNABLE;
+// Reply to 'envid', which should be waiting for it in sys_ipc_call,
+// and then wait for the next IPC, like sys_ipc_recv, in one system call:
+// the loop of a server.
+//
+// The reply is 'value', and the page at 'pg' if perm is nonzero.  Then
+// the window of 'npg' pages at 'pg' is unmapped, and the next request
+// is received into it.  If 'envid' isn't waiting for us any more, the
+// reply is dropped.  If no request is waiting either, this CPU goes
+// straight back to 'envid'.
+//
+// Return 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if pg < UTOP but pg is not page-aligned, or npg is 0 or
+//		runs past UTOP.
+//	-E_INVAL if perm is nonzero, but inappropriate or the page at pg
+//		is not mapped (see sys_ipc_send).
+static int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, unsigned perm)
+{
+	int r;
+	struct PageInfo *p = 0;
+	struct Env *dstenv;
+	if (((uint32_t)pg < UTOP) && check_user_range(pg, npg) < 0) {
+		return -E_INVAL;
+	}
+	if ((uint32_t)pg >= UTOP) {
+		perm = 0;
+	}
+	if (perm && (r = ipc_check_pages(pg, perm, 1, &p)) < 0) {
+		return r;
+	}
 
-		// If a page mapping is in order, attempt the insertion.
-		// If it fails, return the appropriate error code from the source's call to sys_ipc_send,
-		// and try again with the next blocked sender.
-		if (((uint32_t)dstva < UTOP) && srcenv->env_ipc_page) {
-			if (page_insert(curenv->env_pgdir, srcenv->env_ipc_page, dstva, srcenv->env_ipc_perm_sending, NULL) < 0) {
-				srcenv->env_tf.tf_regs.reg_eax = -E_NO_MEM; // makes sys_ipc_send return -E_NO_MEM
-				goto sys_ipc_try_recv_find_sender;  // go back to the top to try again with the next blocked sender in the linked list
-			}
-		}
+	if (envid2env(envid, &dstenv, 0) < 0 || !ipc_can_deliver(dstenv)) {
+		dstenv = NULL;
+	}
+	else if (ipc_deliver(dstenv, value, perm ? pg : (void *)UTOP, perm ? 1 : 0, perm, p) < 0) {
+		// Let the caller know rather than leave it waiting.
+		ipc_deliver(dstenv, -E_NO_MEM, (void *)UTOP, 0, 0, NULL);
+	}
 
-		// Store the values from the IPC in the curenv.
-		curenv->env_ipc_from = srcenv->env_id;
-		curenv->env_ipc_value = srcenv->env_ipc_value_sending;
-		curenv->env_ipc_perm = srcenv->env_ipc_perm_sending;
-		srcenv->env_tf.tf_regs.reg_eax = 0; // makes sys_ipc_send return 0
+	if ((uint32_t)pg < UTOP) {
+		page_remove_range(curenv->env_pgdir, pg, npg, &curenv->env_npages);
 	}
-	else {
-		// If there is no blocked sender (or if all waiting sends failed),
-		// fail with a return value of -E_IPC_NOT_SEND.
-		return -E_IPC_NOT_SEND;
+	if (!ipc_recv_blocked_sender(pg, npg)) {
+		curenv->env_ipc_recving = 1;
+		curenv->env_ipc_dstva = pg;
+		curenv->env_ipc_dstnpg = (uint32_t)pg < UTOP ? npg : 0;
+		curenv->env_status = ENV_NOT_RUNNABLE;
+		if (dstenv && dstenv->env_status == ENV_RUNNABLE) {
+			env_run(dstenv);
+		}
+		sched_yield();
 	}
 	return 0;
 }
 
+// Look up the physical address of the user word at 'addr'.
+// Returns the word's page, or NULL if 'addr' is not a 4-byte aligned
+// address below UTOP that the current environment can read, or in the
+// read-only envs array at UENVS (so an environment can wait for another
+// one's status to change, or on the struct Meminfo at UMEMINFO).  Page
+// table pages at UVPT and the pages array at UPAGES are not words
+// anyone can wait on.
+static struct PageInfo *
+futex_lookup(const uint32_t *addr, physaddr_t *pa_store)
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+
+	// UTOP is UENVS, so this takes in the envs array
+	if ((uintptr_t) addr >= UENVS + PTSIZE || (uintptr_t) addr % 4 != 0)
+		return NULL;
+	if (!(pp = page_lookup(curenv->env_pgdir, (void *) addr, &pte)) || !(*pte & PTE_U))
+		return NULL;
+	*pa_store = page2pa(pp) + PGOFF(addr);
+	return pp;
+}
+
+// Sleep until another environment calls sys_futex_wake on the word at
+// 'addr', if the word still holds 'val'.  The word is known by its
+// physical address, so environments that share its page can wait for
+// each other wherever they map it.
+//
+// If 'ref' is not negative, don't sleep either unless the page still has
+// 'ref' references, and sleepers are woken whenever a mapping of the page
+// goes away.  Page references are how pipes tell that their other end has
+// closed, so this way a sleeper can't miss that.
+//
+// Returning doesn't mean the condition waited for holds: the caller must
+// look again.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if addr is not 4-byte aligned, or not mapped below UTOP
+//		or in the envs array (see futex_lookup).
+static int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+	struct PageInfo *pp;
+	physaddr_t pa;
+
+	if (!(pp = futex_lookup(addr, &pa)))
+		return -E_INVAL;
+	if (*(uint32_t *) KADDR(pa) != val || (ref >= 0 && pp->pp_ref != ref))
+		return 0;
+
+	env_futex_wait(curenv, pa);
+	curenv->env_tf.tf_regs.reg_eax = 0;
+	sched_yield();
+}
+
+// Wake up to 'n' environments asleep in sys_futex_wait on the word at
+// 'addr'.
+//
+// Returns the number woken, or < 0 on error.  Errors are:
+//	-E_INVAL if addr is not 4-byte aligned, or not mapped below UTOP
+//		or in the envs array (see futex_lookup).
+static int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+	physaddr_t pa;
+
+	if (!futex_lookup(addr, &pa))
+		return -E_INVAL;
+	return env_futex_wake(pa, sizeof(uint32_t), n);
+}
+
 // Dispatches to the correct kernel function, passing the arguments.
 int32_t
 syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
@@ -624,6 +1290,19 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 		[SYS_ipc_recv]          &sys_ipc_recv,
 		[SYS_ipc_try_recv]      &sys_ipc_try_recv,
 		[SYS_env_set_trapframe] &sys_env_set_trapframe,
+		[SYS_page_alloc_range]  &sys_page_alloc_range,
+		[SYS_page_map_range]    &sys_page_map_range,
+		[SYS_page_unmap_range]  &sys_page_unmap_range,
+		[SYS_fork]              &sys_fork,
+		[SYS_env_set_segments]  &sys_env_set_segments,
+		[SYS_ipc_call]          &sys_ipc_call,
+		[SYS_ipc_reply_recv]    &sys_ipc_reply_recv,
+		[SYS_futex_wait]        &sys_futex_wait,
+		[SYS_futex_wake]        &sys_futex_wake,
+		[SYS_page_split]        &sys_page_split,
+		[SYS_page_reclaim]      &sys_page_reclaim,
+		[SYS_env_set_rss]       &sys_env_set_rss,
+		[SYS_page_clean]        &sys_page_clean,
 	};
 	uint32_t ret = 0, esp = 0, ebp = 0;
 
@@ -248,6 +248,9 @@ trap_dispatch(struct Trapframe *tf)
 	if (tf->tf_trapno == IRQ_OFFSET + IRQ_TIMER) {
 		lapic_eoi();
 
+		// Wake environments waiting for the memory pressure to change
+		mem_pressure_update();
+
 		// Update the age of some physical pages
 
 		// If we fall below the thresholds, update more pages than usual
@@ -396,6 +399,7 @@ page_fault_handler(struct Trapframe *tf)
 {
 	uint32_t fault_va;
 	struct PageInfo *pp = NULL;
+	int r;
 
 	// Read processor's CR2 register to find the faulting address
 	fault_va = rcr2();
@@ -410,6 +414,23 @@ page_fault_handler(struct Trapframe *tf)
 	// We've already handled kernel-mode exceptions, so if we get here,
 	// the page fault happened in user mode.
 
+	// Load pages of lazily loaded segments on first touch.  If the page
+	// has to come from a pager, wait for it.  If we're out of memory, let
+	// the user's handler page something out, as below.
+	if (!(tf->tf_err & FEC_PR) && (r = env_segment_fault(curenv, fault_va)) >= 0) {
+		if (r > 0)
+			sched_yield();
+		return;
+	}
+
+	// Resolve writes to copy-on-write pages here, without a trip
+	// through the user's handler.  If we're short on memory, page_cow
+	// fails and the user's handler gets the fault instead, since it can
+	// page something out to make room.
+	if ((tf->tf_err & (FEC_PR|FEC_WR)) == (FEC_PR|FEC_WR) &&
+	    page_cow(curenv->env_pgdir, (void *) fault_va, &curenv->env_npages) == 0)
+		return;
+
 	// Call the environment's page fault upcall, if one exists.  Set up a
 	// page fault stack frame on the user exception stack (below
 	// UXSTACKTOP), then branch to curenv->env_pgfault_upcall.
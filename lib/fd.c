@@ -53,9 +53,14 @@ fd_alloc(struct Fd **fd_store)
 	int i;
 	struct Fd *fd;
 
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
 	for (i = 0; i < MAXFD; i++) {
 		fd = INDEX2FD(i);
-		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
 			*fd_store = fd;
 			return 0;
 		}
@@ -6,6 +6,8 @@
 
 union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
 
+static int fsipc_pages(unsigned type, void *dstva, size_t npg);
+
 // Send an inter-environment request to the file server, and wait for
 // a reply.  The request body should be in fsipcbuf, and parts of the
 // response may be written back to fsipcbuf.
@@ -14,6 +16,14 @@ union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
 // Returns result from the file server.
 static int
 fsipc(unsigned type, void *dstva)
+{
+	return fsipc_pages(type, dstva, 1);
+}
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
 {
 	static envid_t fsenv;
 	if (fsenv == 0)
@@ -25,7 +35,7 @@ fsipc(unsigned type, void *dstva)
 		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
 
 	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
-	return ipc_recv(NULL, dstva, NULL);
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
 }
 
 static int devfile_flush(struct Fd *fd);
@@ -41,6 +51,8 @@ struct Dev devfile =
 	.dev_read =	devfile_read,
 	.dev_close =	devfile_flush,
 	.dev_stat =	devfile_stat,
+	.dev_write =	devfile_write,
+	.dev_trunc =	devfile_trunc,
 };
 
 // Open a file (or directory).
@@ -101,6 +113,16 @@ devfile_flush(struct Fd *fd)
 	return fsipc(FSREQ_FLUSH, NULL);
 }
 
+// Can devfile_read map a block from the file server over the page at
+// va, an ordinary private page of ours?
+static bool
+devfile_can_map(void *va)
+{
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+}
+
 // Read at most 'n' bytes from 'fd' at the current position into 'buf'.
 //
 // Returns:
@@ -114,6 +136,22 @@ devfile_read(struct Fd *fd, void *buf, size_t n)
 	// bytes read will be written back to fsipcbuf by the file
 	// system server.
 	int r;
+	size_t npg;
+
+	// Whole blocks that land on whole pages of buf are mapped there
+	// straight out of the file server's block cache (copy-on-write),
+	// instead of being copied twice, as many as one request will
+	// take.  Only do this over ordinary private pages of ours.  At the
+	// end of the file the server says no, and we copy as usual.
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+		if (!devfile_can_map(buf + npg*PGSIZE))
+			break;
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+			return r;
+	}
 
 	fsipcbuf.read.req_fileid = fd->fd_file.id;
 	fsipcbuf.read.req_n = n;
@@ -126,6 +164,25 @@ devfile_read(struct Fd *fd, void *buf, size_t n)
 }
 
 
+// Write at most 'n' bytes from 'buf' to 'fd' at the current seek position.
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+	// Make an FSREQ_WRITE request to the file system server.  Be
+	// careful: fsipcbuf.write.req_buf is only so large, but
+	// remember that write is always allowed to write *fewer*
+	// bytes than requested.
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+	fsipcbuf.write.req_n = n;
+	memmove(fsipcbuf.write.req_buf, buf, n);
+	return fsipc(FSREQ_WRITE, NULL);
+}
+
 static int
 devfile_stat(struct Fd *fd, struct Stat *st)
 {
@@ -140,4 +197,52 @@ devfile_stat(struct Fd *fd, struct Stat *st)
 	return 0;
 }
 
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+	fsipcbuf.set_size.req_size = newsize;
+	return fsipc(FSREQ_SET_SIZE, NULL);
+}
+
 
+// Delete a file
+int
+remove(const char *path)
+{
+	if (strlen(path) >= MAXPATHLEN)
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+	return fsipc(FSREQ_REMOVE, NULL);
+}
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+}
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+		return r;
+	*st = fsipcbuf.bcstatRet;
+	return 0;
+}
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+	fsipcbuf.bcset.req_capacity = capacity;
+	return fsipc(FSREQ_BCSET, NULL);
+}
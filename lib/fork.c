@@ -3,10 +3,6 @@
 #include <inc/string.h>
 #include <inc/lib.h>
 
-// PTE_COW marks copy-on-write page table entries.
-// It is one of the bits explicitly allocated to user processes (PTE_AVAIL).
-#define PTE_COW		0x800
-
 extern void init_map_dir();
 
 //
@@ -86,13 +82,12 @@ duppage(envid_t envid, unsigned pn)
 	else if (uvpt[pn]&PTE_NO_PAGE) {
 		void *temp;
 
-		if (!(temp = malloc()))
+		if (!(temp = malloc(PGSIZE)))
 			panic("malloc failed");
 		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
 		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
 			panic("page_map: %e", r);
-		if ((r = page_unmap(0, temp)) < 0)
-			panic("page_unmap: %e", r);
+		free(temp);
 	}
 
 	// If the page is a writable or copy-on-write page, the new and old mappings must be made copy-on-write.
@@ -136,35 +131,69 @@ duppage(envid_t envid, unsigned pn)
 }
 
 //
-// User-level fork with copy-on-write.
-// Set up our page fault handler appropriately.
+// Return the permissions duppage would give page pn in the child,
+// or 0 if pn has to go through duppage by itself (shared pages and
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+}
+
+//
+// Like duppage, but for the run of 'npages' present pages starting at
+// pn, which all have the same dupperm 'perm'.  This takes one range
+// mapping into the child (and one back onto ourselves for copy-on-write
+// pages) rather than one or two page_maps per page.
+//
+static int
+duprange(envid_t envid, unsigned pn, size_t npages, int perm)
+{
+	int r;
+
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+		panic("page_map_range %e", r);
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+		panic("page_map_range %e", r);
+	return 0;
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+}
+
+//
+// User-level fork with copy-on-write, for when the kernel's sys_fork
+// runs out of memory: page_alloc and page_map can page things out to
+// make room, which the kernel can't.
 // Create a child.
 // Copy our address space and page fault handler setup to the child.
-// Then mark the child as runnable and return.
+// The child is left not runnable, as with sys_fork.
 //
 // Returns: child's envid to the parent, 0 to the child, < 0 on error.
 // It is also OK to panic on error.
 //
 // Hint:
 //   Use uvpd, uvpt, and duppage.
-//   Remember to fix "thisenv" in the child process.
 //   Neither user exception stack should ever be marked copy-on-write,
 //   so you must allocate a new page for the child's user exception stack.
 //
-envid_t
-fork(void)
+static envid_t
+ufork(void)
 {
 	// LAB 4: Your code here.
 	// Some code and comments taken from dumbfork().
 
 	envid_t envid;
-	int pn;
-	int r;
-
-	if(!umapdir)
-		init_map_dir();
-	// Set up our page fault handler appropriately.
-	add_pgfault_handler(pgfault);
+	int pn, n, perm;
 
 	// Allocate a new child environment.
 	// The kernel will initialize it with a copy of our register state,
@@ -174,14 +203,8 @@ fork(void)
 	envid = sys_exofork();
 	if (envid < 0)
 		panic("sys_exofork: %d", envid);
-	if (envid == 0) {
-		// We're the child.
-		// The copied value of the global variable 'thisenv'
-		// is no longer valid (it refers to the parent!).
-		// Fix it and return 0.
-		thisenv = &envs[ENVX(sys_getenvid())];
+	if (envid == 0)
 		return 0;
-	}
 
 	// We're the parent.
 	// Copy our address space to the child with copy-on-write.
@@ -189,14 +212,39 @@ fork(void)
 	// However, we handle the exception stack separately, so we only need to iterate up until UXSTACKTOP-PGSIZE.
 	// Since [USTACKTOP, UXSTACKTOP-PGSIZE) is empty memory, we can get away with only iterating up until USTACKTOP.
 	// This is the same as iterating through pages 0 through PGNUM(USTACKTOP)-1 inclusive.
-	for (pn = 0; pn < PGNUM(USTACKTOP); ++pn) {
+	// Runs of pages that get the same permissions are mapped with one
+	// range mapping, and page tables that aren't present are skipped.
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
 
 		// We only copy this page if it is present and readable in user mode.
 		// This requires checking for PTE_P and PTE_U not only in uvpt[pn],
 		// but in the associated PDE as well, since page pn won't exist if its page table doesn't exist, i.e. if it isn't present in the page directory.
-		if (((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U))) {
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+			pn += NPTENTRIES - pn%NPTENTRIES;
+			continue;
+		}
+		// Copy-on-write works a page at a time, so a large page has
+		// to be split first (and uvpt means nothing for it until then)
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+			sys_page_split(0, PGADDR(0,pn,0));
+		// A page that a paging server took from us (see
+		// sys_page_reclaim) is paged back in by touching it, since
+		// only the kernel's fork can copy its page table entry
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+			(void) *(volatile char *) PGADDR(0,pn,0);
+		if (!dupable(pn)) {
+			++pn;
+			continue;
+		}
+		if (!(perm = dupperm(pn))) {
 			duppage(envid, pn);
+			++pn;
+			continue;
 		}
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+			;
+		duprange(envid, pn, n, perm);
+		pn += n;
 	}
 
 	// Allocate a new page for the child's user exception stack.
@@ -205,6 +253,47 @@ fork(void)
 	// Copy our address space and page fault handler setup to the child.
 	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
 
+	return envid;
+}
+
+//
+// Fork with copy-on-write.
+// Set up our page fault handler appropriately.
+// Create a child with a copy-on-write copy of our address space, using
+// sys_fork if it can and ufork if not.
+// Then mark the child as runnable and return.
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+		envid = ufork();
+	if (envid == 0) {
+		// We're the child.
+		// The copied value of the global variable 'thisenv'
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+		panic("page_share_paged_out: %e", r);
+
 	// Start the child environment running
 	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
 		panic("sys_env_set_status: %d", r);
@@ -22,15 +22,27 @@
 int32_t
 ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
 {
-	// LAB 4: Your code here.
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+}
+
+// Like ipc_recv, but take up to 'npages' pages, mapped at consecutive
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
 	int32_t r;
-	if ((r = (int32_t)sys_ipc_recv(pg)) < 0) {
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
 		if (from_env_store) {
 			*from_env_store = 0;
 		}
 		if (perm_store) {
 			*perm_store = 0;
 		}
+		if (npages_store) {
+			*npages_store = 0;
+		}
 		return r;
 	}
 	if (from_env_store) {
@@ -39,6 +51,9 @@ ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
 	if (perm_store) {
 		*perm_store = thisenv->env_ipc_perm;
 	}
+	if (npages_store) {
+		*npages_store = thisenv->env_ipc_npages;
+	}
 	return thisenv->env_ipc_value;
 }
 
@@ -94,17 +109,81 @@ ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
 //   as meaning "no page".  (Zero is not the right value.)
 void
 ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+	ipc_send_pages(to_env, val, pg, 1, perm);
+}
+
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
 {
 	// LAB 4: Your code here.
 	int r;
 	if (pg == NULL) {
 		pg = (void *)UTOP;
 	}
-	if((r = sys_ipc_send(to_env, val, pg, (unsigned)perm)) < 0) {
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
 		panic("ipc_send: sys_ipc_send failed with error %d", r);
 	}
 }
 
+// Send 'val' to 'toenv' and wait for its reply, in one system call, so
+// the server runs straight away and we run straight after it replies.
+// If 'pg' is nonnull, it is the start of a window of 'npages' pages
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+		return r;
+	}
+	return thisenv->env_ipc_value;
+}
+
+// For a server: reply 'val' to 'toenv', a client waiting in ipc_call,
+// together with the page at 'pg' if 'perm' is nonzero, and then receive
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+		if (from_env_store) {
+			*from_env_store = 0;
+		}
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+		*from_env_store = thisenv->env_ipc_from;
+	}
+	if (perm_store) {
+		*perm_store = thisenv->env_ipc_perm;
+	}
+	if (npages_store) {
+		*npages_store = thisenv->env_ipc_npages;
+	}
+	return thisenv->env_ipc_value;
+}
+
 // Find the first environment of the given type.  We'll use this to
 // find special environments.
 // Returns 0 if no such environment exists.
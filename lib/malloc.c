@@ -1,52 +1,187 @@
 #include <inc/lib.h>
-#include <inc/page.h>
 
-extern void *end;
+/*
+ * The heap's address space comes from va_alloc.  Requests of up to
+ * HEAP_MAXSMALL bytes are rounded up to a power-of-2 size class and
+ * carved out of slab pages, each of which holds objects of one size class
+ * behind a small header.  Bigger requests get whole pages, mapped with
+ * one page_alloc_range, so they and only they are page-aligned.
+ *
+ * Bitmaps with a bit for each page of [UHEAP, UHEAPTOP) mark the first
+ * and the last page of each big allocation, so free can tell a pointer
+ * it handed out from one it didn't and knows how many pages to give
+ * back, and the slab pages, so it can tell their objects apart.
+ */
 
-// TODO: Make this less stupid (keep track of free pages)
+#define HEAP_NPAGES	((UHEAPTOP - UHEAP) / PGSIZE)
+#define HEAP_MINSIZE	16	// smallest size class, and the alignment of every object
+#define HEAP_NCLASSES	7	// 16, 32, ... 1024 bytes
+#define HEAP_MAXSMALL	(HEAP_MINSIZE << (HEAP_NCLASSES - 1))
 
-// Find a (virtual) page that is unmapped and return a pointer to it
-// Return NULL if it can't find a page
-void *
-find_unused_page()
-{
-	int r;
-	mte_t *mte;
-	void* va;
-	static void *last_page = (void*)UTEXT;
-
-	for(va = last_page + PGSIZE; va != last_page; va += PGSIZE){
-		if((uintptr_t)va >= USTACKTOP - PGSIZE){
-			va = (void*)(UTEXT - PGSIZE);
-			continue;
-		}
-		if((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P))
-			continue;
-		mte = umapdir_walk(va, 0);
-		if(mte && (*mte & PTE_P))
-			continue;
-		last_page = va;
-		return va;
-	}
-	return NULL;
-}
+// Header at the start of each slab page
+struct slab {
+	struct slab *next;	// slabs of this size class with free objects
+	struct slab *prev;
+	void *free;		// free objects, linked through their first word
+	uint16_t size;		// object size
+	uint16_t nfree;
+};
+#define SLAB_HDRSIZE	HEAP_MINSIZE
+#define SLAB_NOBJS(size) ((PGSIZE - SLAB_HDRSIZE) / (size))
+
+static uint32_t heap_first[HEAP_NPAGES / 32];
+static uint32_t heap_last[HEAP_NPAGES / 32];
+static uint32_t heap_slab[HEAP_NPAGES / 32];
+static struct slab *slabs[HEAP_NCLASSES];
 
-// Allocate a page of memory, returning a pointer to the beginning of the block
+#define HEAP_BIT(map, i)	((map)[(i) / 32] & (1 << ((i) % 32)))
+#define HEAP_SET(map, i)	((map)[(i) / 32] |= (1 << ((i) % 32)))
+#define HEAP_CLEAR(map, i)	((map)[(i) / 32] &= ~(1 << ((i) % 32)))
+
+// Allocate npages pages of heap, returning the address of the first
 // On error, return NULL
-void *malloc() {
-	int r;
+static void *
+heap_alloc_pages(size_t npages)
+{
+	uint32_t i;
 	void *va;
 
-	va = find_unused_page();
-	if(!va)
+	// The address space is taken before the pages are mapped: mapping
+	// them may page something out, which may want a mapping table.
+	if (!(va = va_alloc(npages)))
 		return NULL;
-	if((r = page_alloc(0, va, PTE_P|PTE_U|PTE_W, 1)) < 0)
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+	HEAP_SET(heap_first, i);
+	HEAP_SET(heap_last, i + npages - 1);
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+		free(va);
 		return NULL;
+	}
 	return va;
 }
 
-// Free a page of memory returned by malloc, so it can be malloc'd later
-void free(void *va) {
-	sys_page_unmap(0, va);
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+	if (!HEAP_BIT(heap_first, i))
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+	HEAP_CLEAR(heap_last, i + n - 1);
+	page_unmap_range(0, va, n);
+	va_free(va, n);
+}
+
+static void
+slab_link(struct slab *s, int c)
+{
+	s->prev = NULL;
+	s->next = slabs[c];
+	if (slabs[c])
+		slabs[c]->prev = s;
+	slabs[c] = s;
+}
+
+static void
+slab_unlink(struct slab *s, int c)
+{
+	if (s->prev)
+		s->prev->next = s->next;
+	else
+		slabs[c] = s->next;
+	if (s->next)
+		s->next->prev = s->prev;
+}
+
+// Make a new slab page for size class c, and put it on the class's list
+static struct slab *
+slab_new(int c)
+{
+	struct slab *s;
+	char *obj;
+	uint32_t i;
+
+	static_assert(sizeof(struct slab) <= SLAB_HDRSIZE);
+
+	if (!(s = heap_alloc_pages(1)))
+		return NULL;
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+	s->size = HEAP_MINSIZE << c;
+	s->nfree = SLAB_NOBJS(s->size);
+	s->free = NULL;
+	for (i = s->nfree; i > 0; i--) {
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+		*(void **) obj = s->free;
+		s->free = obj;
+	}
+	slab_link(s, c);
+	return s;
+}
+
+// Allocate n bytes of memory, returning a pointer to the beginning of the block
+// On error, return NULL
+void *
+malloc(size_t n)
+{
+	struct slab *s;
+	void *v;
+	int c;
+
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+		return NULL;
+	if (n > HEAP_MAXSMALL)
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+		/* do nothing */;
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+		return NULL;
+	v = s->free;
+	s->free = *(void **) v;
+	if (--s->nfree == 0)
+		slab_unlink(s, c);
+	return v;
 }
 
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+	struct slab *s;
+	int c;
+
+	if (!va)
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+		return;
+	}
+
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+		panic("free: %p is not allocated", va);
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+		/* do nothing */;
+	*(void **) va = s->free;
+	s->free = va;
+	if (s->nfree++ == 0)
+		slab_link(s, c);
+	// Give back slab pages nobody uses, except the last one of their
+	// size class
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
@@ -2,8 +2,12 @@
 
 #include <inc/lib.h>
 #include <inc/page.h>
+#include <inc/x86.h>
 #include <inc/stdio.h>
 
+// The paging servers, in the order they own the swap space (see
+// PAGESERV_OF), and the one we page out to, picked by a hash of our env
+static envid_t pagingenvs[NPAGESERV];
 static envid_t pagingenv = 0;
 extern char end[];
 
@@ -11,12 +15,96 @@ extern char end[];
 void init_map_dir();
 
 
-// Update the pagingenv static variable
+// Update the pagingenvs and pagingenv static variables.  Paging is
+// only on once all the paging servers are up.
 void
 find_paging_env()
 {
-	if(!pagingenv)
-		pagingenv = ipc_find_env(ENV_TYPE_PAGE);
+	int i, n;
+
+	if(pagingenv)
+		return;
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+			pagingenvs[n++] = envs[i].env_id;
+	if (n == NPAGESERV)
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+}
+
+// The paging server that owns swap slot 'slot'
+static envid_t
+slot_paging_env(uint32_t slot)
+{
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+}
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+		if ((uintptr_t)va >= seg->seg_va &&
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+			return seg;
+	return NULL;
+}
+
+// Address ranges outside our segments whose pages can be read back in
+// from a backing store (see page_add_backed)
+#define MAX_BACKED_RANGES 4
+static struct {
+	uintptr_t start, end;
+} backed_ranges[MAX_BACKED_RANGES];
+static int num_backed_ranges;
+
+// Number of clean pages we dropped instead of paging them out
+static uint32_t num_page_drops;
+
+// Number of times we ran short of memory and had the coldest page in
+// the system paged out rather than one of ours
+static uint32_t num_page_reclaims;
+
+// Tell the paging library that clean pages in [va, va+len) can be read
+// back in by one of our page fault handlers, e.g. from a file or a disk
+// block, so under memory pressure they are dropped instead of swapped
+// out.  Pages of our program are always treated this way, since the
+// kernel reads them back in itself (see sys_env_set_segments).
+// Pages count as clean until they are written to (PTE_D);
+// sys_page_clean marks them clean again.
+int
+page_add_backed(void *va, size_t len)
+{
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+		return -E_NO_MEM;
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+	num_backed_ranges++;
+	return 0;
+}
+
+// Is va a mapped page that still holds the same data as its backing
+// store?  Paging one out only means unmapping it -- even if it's
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+	if (segment_lookup(va))
+		return 1;
+	for (i = 0; i < num_backed_ranges; i++)
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+	return 0;
 }
 
 // The default linear walk page choice function, overridable by assigning page_choice
@@ -30,13 +118,17 @@ linear_walk(envid_t env, void *pg_in)
 	{
 		// Calculate the actual pgnum
 		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
-		// Check for the directory being present and UTOP
-		if (!(uvpd[pgnum_actual/NPTENTRIES] & PTE_P) || pgnum_actual >= PGNUM(UTOP))
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
 		{
 			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
 			continue;
 		}
 		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
 		if (pgnum_actual*PGSIZE < (uintptr_t)end)
 			continue;
 		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
@@ -88,8 +180,8 @@ nfu_with_aging_page_choice_func(envid_t env, void *pg_in)
 		// Calculate the actual pgnum
 		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
 
-		// Check for the directory being present and UTOP
-		if (!(uvpd[pgnum_actual/NPTENTRIES] & PTE_P) || pgnum_actual >= PGNUM(UTOP))
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
 		{
 			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
 			continue;
@@ -148,13 +240,17 @@ random_page_choice_func(envid_t env, void *pg_in)
 	{
 		// Calculate the actual pgnum
 		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
-		// Check for the directory being present and UTOP
-		if (!(uvpd[pgnum_actual/NPTENTRIES] & PTE_P) || pgnum_actual >= PGNUM(UTOP))
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
 		{
 			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
 			continue;
 		}
 		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
 		if (pgnum_actual*PGSIZE < (uintptr_t)end)
 			continue;
 		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
@@ -177,8 +273,8 @@ random_page_choice_func(envid_t env, void *pg_in)
 		counter++;
 		// Calculate the actual pgnum
 		//pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
-		// Check for the directory being present and UTOP
-		if (!(uvpd[random_pgnum/NPTENTRIES] & PTE_P) || random_pgnum >= PGNUM(UTOP))
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
 		{
 			pgnum_offset += (NPTENTRIES - random_pgnum%NPTENTRIES) - 1;
 			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
@@ -226,8 +322,8 @@ nfu(envid_t env, void *pg_in)
 		// Calculate the actual pgnum
 		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
 
-		// Check for the directory being present and UTOP
-		if (!(uvpd[pgnum_actual/NPTENTRIES] & PTE_P) || pgnum_actual >= PGNUM(UTOP))
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
 		{
 			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
 			continue;
@@ -283,8 +379,8 @@ lru(envid_t env, void *pg_in)
 		// Calculate the actual pgnum
 		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
 
-		// Check for the directory being present and UTOP
-		if (!(uvpd[pgnum_actual/NPTENTRIES] & PTE_P) || pgnum_actual >= PGNUM(UTOP))
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
 		{
 			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
 			continue;
@@ -328,12 +424,33 @@ set_page_choice_func(void *(*pgchc_func)(envid_t env, void *pg_in))
 	page_choice_func = pgchc_func;
 }
 
+// Split the first large page we find back into ordinary pages.
+// Returns 0 if there was one, -E_NOT_FOUND if not.
+static int
+page_split_any(void)
+{
+	uint32_t pdx;
+
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+	return -E_NOT_FOUND;
+}
+
 // Use this function to actually get the page choice
 void *
 get_page_choice(envid_t env, void *pg_in)
 {
 	void *pg_out = page_choice_func(env, pg_in);
 
+	// Large pages are paged out a page at a time, once split, and
+	// only split when there's nothing else to page out.  The choice
+	// functions skip them; one that doesn't gets its choice split.
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+		pg_out = page_choice_func(env, pg_in);
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+		sys_page_split(0, pg_out);
+
 	// Check constraints
 	// Prevent paging out the user exception stack,
 	// that is an unrecoverable situation
@@ -345,6 +462,9 @@ get_page_choice(envid_t env, void *pg_in)
 	else if ((uintptr_t)pg_out >= UTOP)
 //		panic("We tried to page out UTOP -- we need swapping!\n");
 		return (void *) UTOP;
+	// Clean pages can just be dropped (see page_out)
+	else if (page_is_clean(pg_out))
+		return pg_out;
 	// Prevent paging out code pages
 	else if ((uintptr_t)pg_out <= (uintptr_t)end)
 		panic("We tried to page out code pages\n");
@@ -365,6 +485,146 @@ get_page_choice(envid_t env, void *pg_in)
 }
 
 
+// Our request ring with the paging server (see struct Pagering), and
+// the env that set it up.  A child we fork shares our ring pages, so
+// it sets up its own before it posts anything.
+static struct Pagering *const ring = (struct Pagering *) UPAGERING;
+static envid_t ring_owner;
+
+// The i'th data page of the ring
+#define RING_DATA(i)	((void *) (UPAGERING + (1 + (i))*PGSIZE))
+
+// Make sure we have a request ring, setting one up if need be.
+// Returns 1 if we do, 0 if not (for lack of memory, say), in which case
+// requests go to the paging server by IPC as usual.
+static int
+page_ring_ready(void)
+{
+	int r;
+
+	if (ring_owner == thisenv->env_id)
+		return 1;
+	if (pagingenv == 0)
+		return 0;
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+		return 0;
+	}
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+		return 0;
+	}
+	ring_owner = thisenv->env_id;
+	return 1;
+}
+
+// Ring the doorbell: the paging server replies once it has done
+// everything on the ring.  Then take all the completions, storing the
+// results of the n requests tagged first, first+1, ... in res.
+static void
+page_ring_enter(uint32_t first, int32_t *res, uint32_t n)
+{
+	struct Pagering_cqe *cqe;
+	int r;
+
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+		panic("page_ring_enter: %e", r);
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+		if (cqe->tag - first < n)
+			res[cqe->tag - first] = cqe->res;
+	}
+}
+
+// Make room on the ring for n more requests, whose completions will
+// then fit too.
+static void
+page_ring_reserve(uint32_t n)
+{
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+		page_ring_enter(0, NULL, 0);
+}
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+	sqe->op = op;
+	sqe->slot = slot;
+	sqe->data = data;
+	sqe->tag = ring->sq_tail;
+	ring->sq_tail++;
+	return sqe->tag;
+}
+
+// Page in the writable page at addr, whose mapping table entry is
+// *mte, together with the pages right after it that are paged out with
+// the same permissions, using one PAGEREQ_PAGE_IN_RANGE request.  The
+// pages are allocated in place and sent to the paging server all at
+// once to be filled in.
+// Returns the number of pages paged in, 0 if there's only the one (for
+// page_in to do as usual), or < 0 on error.
+static int
+page_in_range(void *addr, mte_t *mte)
+{
+	static struct Pagereq_page_in_range req;
+	mte_t *mtes[PAGEREQ_PAGE_IN_MAXPAGES];
+	int perm, r;
+	uint32_t i, n;
+
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+	mtes[0] = mte;
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+		void *va = addr + n*PGSIZE;
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+			break;
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+			break;
+	}
+	if (n == 1)
+		return 0;
+
+	req.nslots = n;
+	for (i = 0; i < n; i++)
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+		return r;
+	memmove(addr, &req, sizeof(req));
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+
+	for (i = 0; i < n; i++)
+		*mtes[i] = 0;
+	return n;
+}
+
+// If a paging server took our page at va (see sys_page_reclaim), move
+// the swap slot it left in our page table entry into our mapping
+// tables, where the rest of the library looks for paged out pages.
+// Returns 1 if it did, 0 if the page wasn't taken, < 0 on error.
+static int
+page_adopt(void *va)
+{
+	pte_t pte;
+	mte_t *mte;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+		return 0;
+	if (!(mte = umapdir_walk(va, 1)))
+		return -E_NO_MEM;
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+	sys_page_unmap(0, va);
+	return 1;
+}
+
 // Paging in and out functions (not callable from outside paging.c)
 int
 page_in(envid_t env, void *addr)
@@ -379,7 +639,7 @@ page_in(envid_t env, void *addr)
 	// (1) Find page server index using mapping directory.
 	// (2) Send IPC to page server requesting page (set up IPC
 	//     to map the page to the correct address)
-	// (3) Block in ipc_recv until the paging server is done
+	// (3) Block in ipc_call until the paging server is done
 	// (4) Update mte to indicate not paged out
 
 	int r;
@@ -388,16 +648,21 @@ page_in(envid_t env, void *addr)
 	// Step 1: Find page server index
 	mte = umapdir_walk(addr, 0);
 
+	// Pages after this one that were paged out too are likely to be
+	// wanted soon; bring them in with it, in one request.
+	addr = ROUNDDOWN(addr, PGSIZE);
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+	    && (r = page_in_range(addr, mte)) != 0)
+		return r < 0 ? r : 0;
+
 	// Step 2: Send IPC to page server
 	int map_index = *mte >> MTEFLAGS;
-	int ipc_val = (map_index << 2) | PAGEREQ_PAGE_IN;
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_IN;
 	int perm = (*mte & PTE_SYSCALL) | PTE_P;
 	if ((r = page_alloc(env, addr, perm, 0)) < 0)
 		return r;
-	ipc_send(pagingenv, ipc_val, addr, PTE_U|PTE_W|PTE_P);
-
-	// Step 3: Block in ipc_recv until the paging server finishes
-	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+	// Step 3: Block in ipc_call until the paging server finishes
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
 		panic("page_in: failed to recv from paging server -- %e\n", r);
 
 	// Step 4: Update the mte
@@ -406,35 +671,109 @@ page_in(envid_t env, void *addr)
 	return 0;
 }
 
+// Page out the page at va, and more pages along with it, up to one per
+// data page of our request ring, with one doorbell for the lot: the
+// next time we run short of memory we needn't go to the paging server
+// again straight away.  Every victim is picked before any of them is
+// unmapped, and the list of them is kept on our stack, which is never
+// one of them, so nothing is read back from a page once it's gone.
+static int
+page_out_ring(envid_t env, void *pg_in, void *va)
+{
+	void *vas[PAGERING_NDATA];
+	int32_t res[PAGERING_NDATA];
+	uint32_t first, i, n;
+	uintptr_t stack_lo, stack_hi;
+	mte_t *mte;
+	int perm;
+
+	// Our stack, from the page below esp (which the calls we make run
+	// on) up to our return address
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+
+	page_ring_reserve(PAGERING_NDATA);
+	first = ring->sq_tail;
+	for (n = 0; ; ) {
+		memcpy(RING_DATA(n), va, PGSIZE);
+		vas[n] = va;
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+		if (++n == PAGERING_NDATA)
+			break;
+
+		// The next victim; clean pages are simply dropped.
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+			num_page_drops++;
+			sys_page_unmap(0, va);
+		}
+		if (va == (void *) UTOP ||
+		    ((uintptr_t) va >= stack_lo && (uintptr_t) va < stack_hi))
+			break;
+		for (i = 0; i < n && vas[i] != va; i++)
+			;
+		if (i < n)
+			break;
+	}
+	page_ring_enter(first, res, n);
+
+	for (i = 0; i < n; i++) {
+		if (res[i] < 0)
+			panic("Error from the paging server: %e\n", res[i]);
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+		sys_page_unmap(0, vas[i]);
+		mte = umapdir_walk(vas[i], 1);
+		*mte = (res[i] << MTEFLAGS) | perm;
+	}
+	return 0;
+}
+
 int
 page_out(envid_t env, void *pg_in)
 {
-	// Check that the paging server is up
+	// Find the paging server (clean pages can be dropped without it)
 	find_paging_env();
-	if (pagingenv == 0)
-		return -E_PAGING;
 
 	// Game plan:
 	// (1) Select page to page out using get_page_choice.
 	// (2) Send IPC to the paging server to page out the page
-	// (3) Block in ipc_recv, get the mapping index
+	// (3) Block in ipc_call, get the mapping index
 	// (4) Unmap the page from our end
 	// (5) Set up the mapping table entry.
 
 	int r, perm;
 	pte_t pte;
 
+	// Step 0: Ask for the coldest page in the whole system to be paged
+	// out, which may well not be ours.  The kernel turns us down when
+	// we have more than our share of memory, and then we page out one
+	// of our own.
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+		num_page_reclaims++;
+		return 0;
+	}
+
 	// Step 1: Select page to page out (and check it)
+	// If there's nothing of ours to page out either, the caller
+	// mustn't just try again.
 	void *map_out_addr = get_page_choice(env, pg_in);
 	if(map_out_addr == (void *) UTOP)
-		return 0;
+		return -E_NO_MEM;
 	//cprintf("page_out %p\n", map_out_addr);
 
-	// Step 2: Send the IPC to the paging server
-	ipc_send(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, PTE_P|PTE_U);
+	// Clean pages needn't be written to swap: they are read back in
+	// from their backing store the next time we touch them.
+	if (page_is_clean(map_out_addr)) {
+		num_page_drops++;
+		return sys_page_unmap(0, map_out_addr);
+	}
+	if (pagingenv == 0)
+		return -E_PAGING;
+	if (page_ring_ready())
+		return page_out_ring(env, pg_in, map_out_addr);
 
-	// Step 3: Recv the mapping table index
-	uint32_t map_index = ipc_recv(NULL, NULL, NULL);
+	// Step 2 and 3: Send the IPC to the paging server, and get back
+	// the mapping table index
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
 	if ((int)map_index < 0)
 		panic("Error from the paging server: %e\n", map_index);
 
@@ -482,7 +821,6 @@ page_alloc(envid_t env, void *pg, int perm, int check_mte)
 		}
 	}
 
-	int t = 0;
 	// Try just calling through
 	while ((r = sys_page_alloc(env, pg, perm)) < 0)
 	{
@@ -490,18 +828,11 @@ page_alloc(envid_t env, void *pg, int perm, int check_mte)
 		if (r != -E_NO_MEM)
 			return r;
 
-		// Handle -E_NO_MEM by paging a page to disk
+		// Handle -E_NO_MEM by paging a page to disk, then try
+		// allocating the page again.  There's nothing to wait
+		// for: the paging server has already run, in ipc_call.
 		if (page_out(env, pg) < 0)
 			return r;
-
-		// If we successfully paged out a page, yield then
-		// try allocating the page again
-		// Only yield once every ten loops
-		if(!t){
-			sys_yield();
-			t = 10;
-		}
-		t--;
 	}
 
 	return 0;
@@ -528,7 +859,8 @@ page_map(envid_t srcenvid, void *srcva,
 		// Check for -E_NO_MEM
 		if (r == -E_NO_MEM)
 		{
-			page_out(0, (void*)UTEMP);
+			if (page_out(0, (void*)UTEMP) < 0)
+				return r;
 			// Now try again
 			continue;
 		}
@@ -537,6 +869,11 @@ page_map(envid_t srcenvid, void *srcva,
 		if (r != -E_INVAL)
 			return r;
 
+		// A page a paging server took from us is paged back in
+		// like any other, from our mapping tables
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+			return r;
+
 		// Check for the paged out case by:
 		// - Map in srcenv's umapdir at UTEMP
 		// - Walk the umapdir, page in a map table if needed
@@ -548,7 +885,8 @@ page_map(envid_t srcenvid, void *srcva,
 		{
 			if (r2 != -E_NO_MEM)
 				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
-			page_out(-E_NO_MEM, (void*)UTEMP);
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+				return r2;
 		}
 				
 		mde = (mde_t*)UTEMP + MDX(srcva);
@@ -559,7 +897,8 @@ page_map(envid_t srcenvid, void *srcva,
 		{
 			if (r2 != -E_NO_MEM)
 				panic("page_map: Unable to map map table -- %e\n", r2);
-			page_out(0, (void*)UTEMP);
+			if (page_out(0, (void*)UTEMP) < 0)
+				return r2;
 		}
 		mte = (mte_t*)UTEMP + MTX(srcva);
 		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
@@ -572,7 +911,8 @@ page_map(envid_t srcenvid, void *srcva,
 		{
 			if (r2 != -E_NO_MEM)
 				panic("page_map: Unable to page in target page -- %e\n", r2);
-			page_out(0, (void*)srcva);
+			if (page_out(0, (void*)srcva) < 0)
+				return r2;
 		}
 
 		// Now we loop back to the top and hopefully succeed in mapping,
@@ -582,6 +922,48 @@ page_map(envid_t srcenvid, void *srcva,
 	return r;
 }
 
+// Tell the paging server that owns the slot to throw its page away.
+// Nothing waits on that, so it just goes on our request ring, to be
+// picked up the next time the paging server wakes up.
+static void
+page_remove_slot(uint32_t map_index)
+{
+	int r;
+
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+		page_ring_reserve(1);
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+		return;
+	}
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+}
+
+// If our page at va is paged out, throw it away instead of paging it
+// back in just to unmap it.
+// Called before unmapping it: a page a paging server took from us
+// keeps its swap slot in its page table entry until then.
+static void
+page_forget(void *va)
+{
+	mte_t *mte;
+	pte_t pte;
+
+	find_paging_env();
+	if (pagingenv == 0)
+		return;
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+		return;
+	}
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+		return;
+	page_remove_slot(*mte >> MTEFLAGS);
+	*mte = 0;
+}
+
 // Safe page unmap function - wrap sys_page_unmap to handle
 // several special cases that may arise:
 // (1) Unmapping a paged out page
@@ -592,18 +974,18 @@ page_unmap(envid_t envid, void *va)
 	mde_t *mde;
 	mte_t *mte;
 
+	// In the case where we unmap a page that was paged out, we
+	// need to tell the paging server to throw away that page.
+
+	// Unmapping from current env
+	if (envid == thisenv->env_id || envid <= 0) {
+		page_forget(va);
+		return sys_page_unmap(envid, va);
+	}
+
 	// First call through
 	r = sys_page_unmap(envid, va);
 
-	// In the case where we just unmapped page that was
-	// paged out AND in another environment (therefore
-	// wouldn't have been paged in by our poking code)
-	// then we need to tell the paging server to throw
-	// away that page.
-
-	// Unmapping from current env
-	if (envid == thisenv->env_id || envid <= 0)
-		return r;
 	// Check for paging env
 	find_paging_env();
 	if (pagingenv == 0)
@@ -623,16 +1005,111 @@ page_unmap(envid_t envid, void *va)
 		return r; // Just return
 	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
 		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
-	// Page was paged out, so we need to tell paging server to drop it
-	int map_index = *mte >> MTEFLAGS;
-	int ipc_val = (map_index << 2) | PAGEREQ_PAGE_REMOVE;
-	ipc_send(pagingenv, ipc_val, NULL, 0);
-	if ((r2 = ipc_recv(NULL, NULL, NULL)) < 0)
-		panic("page_unmap: failed to recv from paging server -- %e\n", r2);
+	// Page was paged out, so we need to tell paging server to drop it.
+	page_remove_slot(*mte >> MTEFLAGS);
+	return r;
+}
+
+
+// Range version of page_alloc - allocates 'npages' pages starting at
+// 'va' with as few system calls as possible.  Whenever the kernel
+// runs out of memory part way through, we page one page out and ask
+// for the rest of the range.
+int
+page_alloc_range(envid_t env, void *va, size_t npages, int perm, int check_mte)
+{
+	int r;
+	size_t i;
+	mte_t *mte;
+
+	if(!umapdir)
+		init_map_dir();
+
+	// Same check as page_alloc, for every page in the range
+	if (check_mte)
+	{
+		for (i = 0; i < npages; i++)
+		{
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+			if (mte && (*mte & PTE_P))
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+		}
+	}
+
+	while (npages > 0)
+	{
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+		{
+			va += r*PGSIZE;
+			npages -= r;
+			continue;
+		}
+
+		// Pass through all non-memory errors
+		if (r != -E_NO_MEM)
+			return r;
+
+		// Handle -E_NO_MEM by paging a page to disk, and try
+		// again, like page_alloc
+		if (page_out(env, va) < 0)
+			return r;
+	}
+
+	return 0;
+}
+
+// Range version of page_map.  The whole range is mapped with one
+// system call unless part of the source range has been paged out,
+// in which case we fall back to page_map for each page, which knows
+// how to page the missing pages back in.
+int
+page_map_range(envid_t srcenvid, void *srcva,
+	       envid_t dstenvid, void *dstva, size_t npages, int perm)
+{
+	int r;
+	size_t i;
+
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+	{
+		if (r == -E_NO_MEM)
+		{
+			if (page_out(0, (void*)UTEMP) < 0)
+				return r;
+			continue;
+		}
+		if (r != -E_INVAL)
+			return r;
+
+		for (i = 0; i < npages; i++)
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+				return r;
+		return 0;
+	}
 
 	return r;
 }
 
+// Range version of page_unmap.  Unmapping from another environment
+// may have to tell the paging server to drop paged out pages, which
+// page_unmap takes care of one page at a time.
+int
+page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+	int r;
+	size_t i;
+
+	find_paging_env();
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+		for (i = 0; i < npages; i++)
+			page_forget(va + i*PGSIZE);
+		return sys_page_unmap_range(envid, va, npages);
+	}
+
+	for (i = 0; i < npages; i++)
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+			return r;
+	return 0;
+}
 
 // Page fault handler -- checks if the page that we faulted on is
 // paged out currently. If that's the case, we need to page it back
@@ -648,6 +1125,8 @@ paging_pgfault_handler(struct UTrapframe *utf)
 	void *fault_addr = (void*)utf->utf_fault_va;
 
 	int r;
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+		return 0;
 	mte_t *mte = umapdir_walk(fault_addr, 0);
 	if (mte && (*mte & MTE_P))
 	{
@@ -657,24 +1136,113 @@ paging_pgfault_handler(struct UTrapframe *utf)
 		return 1;
 	}
 
+	// The kernel couldn't load a page of one of our segments for lack
+	// of memory (see env_segment_fault).  Make room and try again.
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+	{
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+			return 0;
+		return 1;
+	}
+
 	// Otherwise, we didn't handle it
 	return 0;
 }
 
-// Get paging stats from the paging server.
-// Simply a wrapper around sending the IPC to the paging server
+// Argument pages for PAGEREQ_PAGE_SHARE, one per paging server.
+// Static, so that building a request never has to allocate (and maybe
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+	sharereqs[i].nslots = 0;
+	return r;
+}
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+	req->slots[req->nslots++] = slot;
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+		return page_share_send(req - sharereqs);
+	return 0;
+}
+
+// Take another reference on every swap slot in our mapping tables, and
+// in our page table entries for pages a paging server took from us.
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+	if (pagingenv == 0 || !umapdir)
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+				return r;
+	}
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+			pn += NPTENTRIES - 1;
+			continue;
+		}
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+			return r;
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
 struct Pageret_stat*
 get_paging_stats()
 {
-	// First, check that the paging env is up
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
 	find_paging_env();
 	if (pagingenv == 0)
 		return NULL;
-	// Send the ipc
-	struct Pageret_stat* stats = (struct Pageret_stat*)malloc();
-	ipc_send(pagingenv, PAGEREQ_PAGE_STAT, stats, PTE_U|PTE_W|PTE_P);
-	// Recv the return value
-	ipc_recv(NULL, stats, NULL);
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+	memset(&total, 0, sizeof(total));
+	for (i = 0; i < NPAGESERV; i++) {
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+		total.num_page_outs += stats->num_page_outs;
+		total.num_page_ins += stats->num_page_ins;
+		total.num_page_removes += stats->num_page_removes;
+		total.num_page_shares += stats->num_page_shares;
+		total.num_page_reclaims += stats->num_page_reclaims;
+	}
+	*stats = total;
 	return stats;
 }
 
@@ -685,6 +1253,15 @@ print_paging_stats(struct Pageret_stat *stats)
 	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
 	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
 	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
 	cprintf("\n");
 }
 
@@ -694,6 +1271,20 @@ get_and_print_paging_stats()
 	print_paging_stats(get_paging_stats());
 }
 
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+	return now;
+}
+
 void
 init_map_dir()
 {
@@ -708,6 +1299,7 @@ init_map_dir()
 		panic("init_map_dir: %e", r);
 
 	find_paging_env();
+	page_ring_ready();
 }
 
 mte_t *
@@ -724,22 +1316,24 @@ umapdir_walk(const void *va, int create)
 		// Should we create it?
 		if(!create)
 			return NULL;
-		// Find a page to allocate for it
-		page = malloc();
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
 		if(!page)
 			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+		{
+			va_free(page, 1);
+			return NULL;
+		}
 		// Check to see if a recursive call to umapdir_walk
 		// created the table already
 		if(*mde & MTE_P)
 		{
 			sys_page_unmap(0, page);
+			va_free(page, 1);
 		}
 		else
-		{
-			// Find the mapping and set PTE_NO_PAGE
-			sys_page_map(0, page, 0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE);
 			*mde = (uintptr_t)(page) | MTE_P;
-		}
 	}
 	// Get the pointer to the mapping table and add the mapping table offset
 	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
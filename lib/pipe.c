@@ -17,14 +17,25 @@ struct Dev devpipe =
 	.dev_stat =	devpipe_stat,
 };
 
-#define PIPEBUFSIZ 32		// small to provoke races
+// The buffer takes up the rest of the pipe's page.  Positions count
+// modulo 2*PIPEBUFSIZ, so that a full pipe and an empty one differ.
+#define PIPEBUFSIZ (PGSIZE - 4*sizeof(uint32_t))
 
 struct Pipe {
-	off_t p_rpos;		// read position
-	off_t p_wpos;		// write position
+	uint32_t p_rpos;	// read position
+	uint32_t p_wpos;	// write position
+	uint32_t p_rsleep;	// a reader is asleep on p_wpos
+	uint32_t p_wsleep;	// a writer is asleep on p_rpos
 	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
 };
 
+// Number of bytes in the pipe
+static size_t
+pipe_count(struct Pipe *p)
+{
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+}
+
 int
 pipe(int pfd[2])
 {
@@ -101,11 +112,37 @@ pipeisclosed(int fdnum)
 	return _pipeisclosed(fd, p);
 }
 
+// Sleep until the other end moves *pos on from 'seen', which was read
+// when the pipe's page had 'ref' references, or until a mapping of the
+// page goes away (the other end may have closed).  The other end wakes
+// us if it finds *sleeping set after moving *pos.
+static void
+pipe_sleep(uint32_t *pos, uint32_t seen, int ref, uint32_t *sleeping)
+{
+	*sleeping = 1;
+	__sync_synchronize();
+	if (*pos == seen)
+		sys_futex_wait(pos, seen, ref);
+}
+
+// Wake the other end if it's asleep on *pos, which we've just moved on.
+static void
+pipe_wake(uint32_t *pos, uint32_t *sleeping)
+{
+	__sync_synchronize();
+	if (*sleeping) {
+		*sleeping = 0;
+		sys_futex_wake(pos, NENV);
+	}
+}
+
 static ssize_t
 devpipe_read(struct Fd *fd, void *vbuf, size_t n)
 {
 	uint8_t *buf;
-	size_t i;
+	size_t i, m;
+	uint32_t wpos;
+	int ref;
 	struct Pipe *p;
 
 	p = (struct Pipe*)fd2data(fd);
@@ -113,34 +150,40 @@ devpipe_read(struct Fd *fd, void *vbuf, size_t n)
 		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
 			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
 
-	buf = vbuf;
-	for (i = 0; i < n; i++) {
-		while (p->p_rpos == p->p_wpos) {
-			// pipe is empty
-			// if we got any data, return it
-			if (i > 0)
-				return i;
-			// if all the writers are gone, note eof
-			if (_pipeisclosed(fd, p))
-				return 0;
-			// yield and see what happens
-			if (debug)
-				cprintf("devpipe_read yield\n");
-			sys_yield();
-		}
-		// there's a byte.  take it.
-		// wait to increment rpos until the byte is taken!
-		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
-		p->p_rpos++;
+	while (pipe_count(p) == 0) {
+		// pipe is empty
+		// if all the writers are gone, note eof
+		wpos = p->p_wpos;
+		ref = pageref(p);
+		if (_pipeisclosed(fd, p))
+			return 0;
+		// sleep until a writer writes or goes away
+		if (debug)
+			cprintf("devpipe_read sleep\n");
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
 	}
-	return i;
+
+	// take as much as there is, in at most two pieces if it wraps
+	// around the end of the buffer
+	// wait to move rpos until the bytes are taken!
+	buf = vbuf;
+	n = MIN(n, pipe_count(p));
+	i = p->p_rpos % PIPEBUFSIZ;
+	m = MIN(n, PIPEBUFSIZ - i);
+	memmove(buf, p->p_buf + i, m);
+	memmove(buf + m, p->p_buf, n - m);
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+	pipe_wake(&p->p_rpos, &p->p_wsleep);
+	return n;
 }
 
 static ssize_t
 devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
 {
 	const uint8_t *buf;
-	size_t i;
+	size_t i, j, m, k;
+	uint32_t rpos;
+	int ref;
 	struct Pipe *p;
 
 	p = (struct Pipe*) fd2data(fd);
@@ -149,23 +192,30 @@ devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
 			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
 
 	buf = vbuf;
-	for (i = 0; i < n; i++) {
-		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+	for (i = 0; i < n; i += m) {
+		while (pipe_count(p) == PIPEBUFSIZ) {
 			// pipe is full
 			// if all the readers are gone
 			// (it's only writers like us now),
 			// note eof
+			rpos = p->p_rpos;
+			ref = pageref(p);
 			if (_pipeisclosed(fd, p))
 				return 0;
-			// yield and see what happens
+			// sleep until a reader reads or goes away
 			if (debug)
-				cprintf("devpipe_write yield\n");
-			sys_yield();
+				cprintf("devpipe_write sleep\n");
+			pipe_sleep(&p->p_rpos, rpos, ref, &p->p_wsleep);
 		}
-		// there's room for a byte.  store it.
-		// wait to increment wpos until the byte is stored!
-		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
-		p->p_wpos++;
+		// store as much as there's room for, in at most two pieces
+		// wait to move wpos until the bytes are stored!
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+		j = p->p_wpos % PIPEBUFSIZ;
+		k = MIN(m, PIPEBUFSIZ - j);
+		memmove(p->p_buf + j, buf + i, k);
+		memmove(p->p_buf, buf + i + k, m - k);
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
 	}
 
 	return i;
@@ -176,7 +226,7 @@ devpipe_stat(struct Fd *fd, struct Stat *stat)
 {
 	struct Pipe *p = (struct Pipe*) fd2data(fd);
 	strcpy(stat->st_name, "<pipe>");
-	stat->st_size = p->p_wpos - p->p_rpos;
+	stat->st_size = pipe_count(p);
 	stat->st_isdir = 0;
 	stat->st_dev = &devpipe;
 	return 0;
@@ -5,6 +5,11 @@
 #define UTEMP2			(UTEMP + PGSIZE)
 #define UTEMP3			(UTEMP2 + PGSIZE)
 
+// Where the child keeps the program's Fd page, so the file stays open on
+// the file server for as long as the child needs to page its segments in.
+// This is just below the Fd table, so it isn't one of the child's fds.
+#define PROGFD			(0xD0000000 - PGSIZE)
+
 // Helper functions for spawn.
 static int init_stack(envid_t child, const char **argv, uintptr_t *init_esp);
 static int map_segment(envid_t child, uintptr_t va, size_t memsz,
@@ -27,6 +32,9 @@ spawn(const char *prog, const char **argv)
 	struct Elf *elf;
 	struct Proghdr *ph;
 	int perm;
+	struct Fd *fdp;
+	struct Segment segs[NSEGS], *seg;
+	envid_t pager;
 
 	// This code follows this procedure:
 	//
@@ -80,6 +88,13 @@ spawn(const char *prog, const char **argv)
 	//     will overlap on the same page; and it guarantees that
 	//     PGOFF(ph->p_offset) == PGOFF(ph->p_va).
 	//
+	//   The first NSEGS segments aren't read in here at all.  Instead the
+	//   kernel is told where they are in the file (sys_env_set_segments),
+	//   and it asks the file server for each page the first time the
+	//   child touches it.  Whole pages of text come straight out of the
+	//   file server's block cache, so they are shared by every instance
+	//   of the program; data pages are mapped copy-on-write.
+	//
 	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
 	//     correct initial eip and esp values in the child.
 	//
@@ -110,7 +125,16 @@ spawn(const char *prog, const char **argv)
 	if ((r = init_stack(child, argv, &child_tf.tf_esp)) < 0)
 		return r;
 
+	// Keep the program file open in the child for its page-ins.
+	if ((r = fd_lookup(fd, &fdp)) < 0)
+		goto error;
+	if ((r = sys_page_map(0, fdp, child, (void*) PROGFD, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+		goto error;
+	pager = ipc_find_env(ENV_TYPE_FS);
+
 	// Set up program segments as defined in ELF header.
+	memset(segs, 0, sizeof(segs));
+	seg = segs;
 	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
 	for (i = 0; i < elf->e_phnum; i++, ph++) {
 		if (ph->p_type != ELF_PROG_LOAD)
@@ -118,10 +142,24 @@ spawn(const char *prog, const char **argv)
 		perm = PTE_P | PTE_U;
 		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
 			perm |= PTE_W;
+		if (seg < segs + NSEGS) {
+			seg->seg_va = ROUNDDOWN(ph->p_va, PGSIZE);
+			seg->seg_memsz = ph->p_memsz + PGOFF(ph->p_va);
+			seg->seg_filesz = ph->p_filesz + PGOFF(ph->p_va);
+			seg->seg_offset = ph->p_offset - PGOFF(ph->p_va);
+			seg->seg_perm = perm;
+			seg->seg_pager = pager;
+			seg->seg_fileid = fdp->fd_file.id;
+			seg++;
+			continue;
+		}
 		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
 				     fd, ph->p_filesz, ph->p_offset, perm)) < 0)
 			goto error;
 	}
+	// This also clears any segments the child inherited from us.
+	if ((r = sys_env_set_segments(child, segs, seg - segs)) < 0)
+		goto error;
 	close(fd);
 	fd = -1;
 
@@ -314,7 +352,8 @@ copy_shared_pages(envid_t child)
 		// We only copy this page if it is present and readable in user mode, and if it is a shared page.
 		// This requires checking for PTE_P and PTE_U not only in uvpt[pn],
 		// but in the associated PDE as well, since page pn won't exist if its page table doesn't exist, i.e. if it isn't present in the page directory.
-		if (((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U) && (uvpt[pn]&PTE_SHARE))) {
+		// Large pages are never shared (see sys_page_alloc), and have no uvpt entries.
+		if (((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U) && !(uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U) && (uvpt[pn]&PTE_SHARE))) {
 			sys_page_map(0, (void *)PGADDR(0,pn,0), child, (void *)PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL);
 		}
 	}
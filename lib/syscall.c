@@ -96,8 +96,55 @@ sys_page_unmap(envid_t envid, void *va)
 	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
 }
 
+int
+sys_page_split(envid_t envid, void *va)
+{
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+}
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+
 // sys_exofork is inlined in lib.h
 
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+
 int
 sys_env_set_status(envid_t envid, int status)
 {
@@ -111,6 +158,19 @@ sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
 	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
 }
 
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+
 int
 sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
 {
@@ -120,18 +180,60 @@ sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
 int
 sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
 {
-	touch_mem(srcva, 1);
-	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+	return sys_ipc_send_pages(envid, value, srcva, 1, perm);
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+		touch_mem(srcva, npg * PGSIZE);
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
 }
 
 int
 sys_ipc_recv(void *dstva)
 {
-	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+	if ((uint32_t) pg < UTOP && perm)
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+	touch_mem(addr, sizeof(*addr));
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+	touch_mem(addr, sizeof(*addr));
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
 }
 
 int
 sys_ipc_try_recv(void *dstva)
 {
-	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
 }
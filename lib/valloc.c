@@ -0,0 +1,152 @@
+#include <inc/lib.h>
+
+/*
+ * Virtual address space allocator for [UHEAP, UHEAPTOP), the part of
+ * the address space handed out at run time: the malloc heap and the
+ * paging library's mapping tables.
+ *
+ * Each 4MB chunk of the range has a bitmap of its pages (a 1 bit is an
+ * allocated page) and a summary: how many of its pages are free, and
+ * the longest run of free pages in it.  A request for up to a chunk's
+ * worth of pages is placed in the first chunk whose longest run is long
+ * enough, and a bigger one in a run of wholly free chunks, so finding
+ * room never takes more than a look at every summary and a scan of one
+ * chunk's bitmap, however fragmented the address space is.
+ */
+
+#define VA_NCHUNKS	((UHEAPTOP - UHEAP) / PTSIZE)
+#define VA_NWORDS	(NPTENTRIES / 32)	// bitmap words per chunk
+
+struct va_chunk {
+	uint32_t map[VA_NWORDS];
+	uint16_t nfree;		// free pages
+	uint16_t run;		// longest run of free pages
+};
+
+static struct va_chunk va_chunks[VA_NCHUNKS];
+static bool va_inited;
+
+static void
+va_init(void)
+{
+	int c;
+
+	for (c = 0; c < VA_NCHUNKS; c++)
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+	va_inited = 1;
+}
+
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+			i += 31;
+			len = 0;
+			continue;
+		}
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+			i += 31;
+			len += 32;
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+			len = 0;
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+			return i + 1 - len;
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+}
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+	struct va_chunk *ch = &va_chunks[c];
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+	}
+	va_chunk_scan(ch, 0, &run);
+	ch->run = run;
+}
+
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+		for (c = 0; c < VA_NCHUNKS; c++) {
+			if (va_chunks[c].run < npages)
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+	}
+
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+		if (va_chunks[c].nfree != NPTENTRIES) {
+			first = c + 1;
+			continue;
+		}
+		if (c + 1 - first == need) {
+			for (c = first; npages > 0; c++) {
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+				npages -= MIN(npages, NPTENTRIES);
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+	    || PGOFF(va))
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+	while (npages > 0) {
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+		i += n;
+		npages -= n;
+	}
+}
@@ -5,9 +5,12 @@ void
 wait(envid_t envid)
 {
 	const volatile struct Env *e;
+	unsigned status;
 
 	assert(envid != 0);
 	e = &envs[ENVX(envid)];
-	while (e->env_id == envid && e->env_status != ENV_FREE)
-		sys_yield();
+	// The kernel wakes us when it frees the environment.  Until then
+	// we sleep, unless its status changed since we looked.
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
 }
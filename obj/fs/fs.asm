@@ -0,0 +1,15587 @@
+
+obj/fs/fs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4f 32 00 00       	call   803280 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ide_wait_ready>:
+		sys_futex_wake((const uint32_t *) l, 1);
+}
+
+static int
+ide_wait_ready(bool check_error)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	89 c3                	mov    %eax,%ebx
+	int r;
+
+	while (((r = inb(IDE_BASE(diskno) + 7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+  800039:	83 3d 00 90 80 00 01 	cmpl   $0x1,0x809000
+  800040:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800045:	b8 77 01 00 00       	mov    $0x177,%eax
+  80004a:	0f 4f d0             	cmovg  %eax,%edx
+
+static __inline uint8_t
+inb(int port)
+{
+	uint8_t data;
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  80004d:	ec                   	in     (%dx),%al
+  80004e:	89 c1                	mov    %eax,%ecx
+  800050:	83 e1 c0             	and    $0xffffffc0,%ecx
+  800053:	80 f9 40             	cmp    $0x40,%cl
+  800056:	75 f5                	jne    80004d <ide_wait_ready+0x1a>
+		/* do nothing */;
+
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+		return -1;
+	return 0;
+  800058:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+  80005d:	84 db                	test   %bl,%bl
+  80005f:	74 0a                	je     80006b <ide_wait_ready+0x38>
+  800061:	a8 21                	test   $0x21,%al
+  800063:	0f 95 c2             	setne  %dl
+  800066:	0f b6 d2             	movzbl %dl,%edx
+  800069:	f7 da                	neg    %edx
+}
+  80006b:	89 d0                	mov    %edx,%eax
+  80006d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800070:	c9                   	leave
+  800071:	c3                   	ret
+
+00800072 <ide_lock>:
+{
+  800072:	55                   	push   %ebp
+  800073:	89 e5                	mov    %esp,%ebp
+  800075:	56                   	push   %esi
+  800076:	53                   	push   %ebx
+	volatile uint32_t *l = &ide_locks[IDE_CHANNEL(d)];
+  800077:	d1 f8                	sar    %eax
+  800079:	89 c2                	mov    %eax,%edx
+  80007b:	8d 1c 85 00 c0 ad de 	lea    -0x21524000(,%eax,4),%ebx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  800082:	b8 01 00 00 00       	mov    $0x1,%eax
+  800087:	f0 87 04 95 00 c0 ad 	lock xchg %eax,-0x21524000(,%edx,4)
+  80008e:	de 
+  80008f:	be 02 00 00 00       	mov    $0x2,%esi
+	if (xchg(l, 1) == 0)
+  800094:	85 c0                	test   %eax,%eax
+  800096:	75 12                	jne    8000aa <ide_lock+0x38>
+  800098:	eb 19                	jmp    8000b3 <ide_lock+0x41>
+		sys_futex_wait((const uint32_t *) l, 2, -1);
+  80009a:	83 ec 04             	sub    $0x4,%esp
+  80009d:	6a ff                	push   $0xffffffff
+  80009f:	6a 02                	push   $0x2
+  8000a1:	53                   	push   %ebx
+  8000a2:	e8 ca 42 00 00       	call   804371 <sys_futex_wait>
+  8000a7:	83 c4 10             	add    $0x10,%esp
+  8000aa:	89 f0                	mov    %esi,%eax
+  8000ac:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(l, 2) != 0)
+  8000af:	85 c0                	test   %eax,%eax
+  8000b1:	75 e7                	jne    80009a <ide_lock+0x28>
+}
+  8000b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000b6:	5b                   	pop    %ebx
+  8000b7:	5e                   	pop    %esi
+  8000b8:	5d                   	pop    %ebp
+  8000b9:	c3                   	ret
+
+008000ba <ide_unlock>:
+	volatile uint32_t *l = &ide_locks[IDE_CHANNEL(d)];
+  8000ba:	d1 f8                	sar    %eax
+  8000bc:	89 c2                	mov    %eax,%edx
+  8000be:	8d 0c 85 00 c0 ad de 	lea    -0x21524000(,%eax,4),%ecx
+  8000c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ca:	f0 87 04 95 00 c0 ad 	lock xchg %eax,-0x21524000(,%edx,4)
+  8000d1:	de 
+	if (xchg(l, 0) == 2)
+  8000d2:	83 f8 02             	cmp    $0x2,%eax
+  8000d5:	74 01                	je     8000d8 <ide_unlock+0x1e>
+  8000d7:	c3                   	ret
+{
+  8000d8:	55                   	push   %ebp
+  8000d9:	89 e5                	mov    %esp,%ebp
+  8000db:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((const uint32_t *) l, 1);
+  8000de:	6a 01                	push   $0x1
+  8000e0:	51                   	push   %ecx
+  8000e1:	e8 db 42 00 00       	call   8043c1 <sys_futex_wake>
+  8000e6:	83 c4 10             	add    $0x10,%esp
+}
+  8000e9:	c9                   	leave
+  8000ea:	c3                   	ret
+
+008000eb <ide_probe_disk1>:
+
+bool
+ide_probe_disk1(void)
+{
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	53                   	push   %ebx
+  8000ef:	83 ec 04             	sub    $0x4,%esp
+	int r, x;
+
+	ide_lock(0);
+  8000f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f7:	e8 76 ff ff ff       	call   800072 <ide_lock>
+	// wait for Device 0 to be ready
+	ide_wait_ready(0);
+  8000fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800101:	e8 2d ff ff ff       	call   800033 <ide_wait_ready>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800106:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80010b:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800110:	ee                   	out    %al,(%dx)
+
+	// switch to Device 1
+	outb(0x1F6, 0xE0 | (1<<4));
+
+	// check for Device 1 to be ready for a while
+	for (x = 0;
+  800111:	bb 00 00 00 00       	mov    $0x0,%ebx
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800116:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80011b:	ec                   	in     (%dx),%al
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  80011c:	a8 a1                	test   $0xa1,%al
+  80011e:	74 0b                	je     80012b <ide_probe_disk1+0x40>
+	     x++)
+  800120:	83 c3 01             	add    $0x1,%ebx
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  800123:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  800129:	75 f0                	jne    80011b <ide_probe_disk1+0x30>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  80012b:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+  800130:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800135:	ee                   	out    %al,(%dx)
+		/* do nothing */;
+
+	// switch back to Device 0
+	outb(0x1F6, 0xE0 | (0<<4));
+	ide_unlock(0);
+  800136:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013b:	e8 7a ff ff ff       	call   8000ba <ide_unlock>
+
+	cprintf("Device 1 presence: %d\n", (x < 1000));
+  800140:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+  800146:	0f 9e c3             	setle  %bl
+  800149:	83 ec 08             	sub    $0x8,%esp
+  80014c:	0f b6 c3             	movzbl %bl,%eax
+  80014f:	50                   	push   %eax
+  800150:	68 a0 7e 80 00       	push   $0x807ea0
+  800155:	e8 64 32 00 00       	call   8033be <cprintf>
+	return (x < 1000);
+}
+  80015a:	89 d8                	mov    %ebx,%eax
+  80015c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80015f:	c9                   	leave
+  800160:	c3                   	ret
+
+00800161 <ide_probe_disk>:
+// Is there a disk d?  Unlike ide_probe_disk1, this works for any disk,
+// including ones on a channel with nothing attached, and doesn't change
+// which disk ide_read and ide_write use.
+bool
+ide_probe_disk(int d)
+{
+  800161:	55                   	push   %ebp
+  800162:	89 e5                	mov    %esp,%ebp
+  800164:	57                   	push   %edi
+  800165:	56                   	push   %esi
+  800166:	53                   	push   %ebx
+  800167:	83 ec 1c             	sub    $0x1c,%esp
+  80016a:	8b 7d 08             	mov    0x8(%ebp),%edi
+	int base = IDE_BASE(d), r, x;
+  80016d:	83 ff 01             	cmp    $0x1,%edi
+  800170:	be 70 01 00 00       	mov    $0x170,%esi
+  800175:	b8 f0 01 00 00       	mov    $0x1f0,%eax
+  80017a:	0f 4e f0             	cmovle %eax,%esi
+
+	ide_lock(d);
+  80017d:	89 f8                	mov    %edi,%eax
+  80017f:	e8 ee fe ff ff       	call   800072 <ide_lock>
+	// an empty channel floats high
+	if (inb(base + 7) == 0xFF) {
+  800184:	8d 4e 07             	lea    0x7(%esi),%ecx
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800187:	89 ca                	mov    %ecx,%edx
+  800189:	ec                   	in     (%dx),%al
+	return data;
+  80018a:	bb e9 03 00 00       	mov    $0x3e9,%ebx
+  80018f:	3c ff                	cmp    $0xff,%al
+  800191:	74 69                	je     8001fc <ide_probe_disk+0x9b>
+		ide_unlock(d);
+		return 0;
+	}
+
+	for (x = 0; x < 1000 && (inb(base + 7) & IDE_BSY) != 0; x++)
+  800193:	83 eb 01             	sub    $0x1,%ebx
+  800196:	74 05                	je     80019d <ide_probe_disk+0x3c>
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800198:	ec                   	in     (%dx),%al
+  800199:	84 c0                	test   %al,%al
+  80019b:	78 f6                	js     800193 <ide_probe_disk+0x32>
+		/* do nothing */;
+
+	outb(base + 6, 0xE0 | ((d&1)<<4));
+  80019d:	89 d1                	mov    %edx,%ecx
+  80019f:	8d 56 06             	lea    0x6(%esi),%edx
+  8001a2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8001a5:	89 f8                	mov    %edi,%eax
+  8001a7:	c1 e0 04             	shl    $0x4,%eax
+  8001aa:	83 e0 10             	and    $0x10,%eax
+  8001ad:	83 c8 e0             	or     $0xffffffe0,%eax
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8001b0:	ee                   	out    %al,(%dx)
+	for (x = 0;
+  8001b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001b6:	89 ca                	mov    %ecx,%edx
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  8001b8:	ec                   	in     (%dx),%al
+	     x < 1000 && ((r = inb(base + 7)) & (IDE_BSY|IDE_DRDY|IDE_DF|IDE_ERR)) != IDE_DRDY;
+  8001b9:	83 e0 e1             	and    $0xffffffe1,%eax
+  8001bc:	3c 40                	cmp    $0x40,%al
+  8001be:	74 0b                	je     8001cb <ide_probe_disk+0x6a>
+	     x++)
+  8001c0:	83 c3 01             	add    $0x1,%ebx
+	     x < 1000 && ((r = inb(base + 7)) & (IDE_BSY|IDE_DRDY|IDE_DF|IDE_ERR)) != IDE_DRDY;
+  8001c3:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  8001c9:	75 ed                	jne    8001b8 <ide_probe_disk+0x57>
+		/* do nothing */;
+
+	// switch back to the disk we were using, if it's on this channel
+	if (IDE_BASE(diskno) == base)
+  8001cb:	a1 00 90 80 00       	mov    0x809000,%eax
+  8001d0:	83 f8 01             	cmp    $0x1,%eax
+  8001d3:	b9 70 01 00 00       	mov    $0x170,%ecx
+  8001d8:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  8001dd:	0f 4e ca             	cmovle %edx,%ecx
+  8001e0:	39 ce                	cmp    %ecx,%esi
+  8001e2:	74 26                	je     80020a <ide_probe_disk+0xa9>
+		outb(base + 6, 0xE0 | ((diskno&1)<<4));
+	ide_unlock(d);
+  8001e4:	89 f8                	mov    %edi,%eax
+  8001e6:	e8 cf fe ff ff       	call   8000ba <ide_unlock>
+
+	return (x < 1000);
+  8001eb:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+  8001f1:	0f 9e c0             	setle  %al
+}
+  8001f4:	83 c4 1c             	add    $0x1c,%esp
+  8001f7:	5b                   	pop    %ebx
+  8001f8:	5e                   	pop    %esi
+  8001f9:	5f                   	pop    %edi
+  8001fa:	5d                   	pop    %ebp
+  8001fb:	c3                   	ret
+		ide_unlock(d);
+  8001fc:	89 f8                	mov    %edi,%eax
+  8001fe:	e8 b7 fe ff ff       	call   8000ba <ide_unlock>
+		return 0;
+  800203:	b8 00 00 00 00       	mov    $0x0,%eax
+  800208:	eb ea                	jmp    8001f4 <ide_probe_disk+0x93>
+		outb(base + 6, 0xE0 | ((diskno&1)<<4));
+  80020a:	c1 e0 04             	shl    $0x4,%eax
+  80020d:	83 e0 10             	and    $0x10,%eax
+  800210:	83 c8 e0             	or     $0xffffffe0,%eax
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800213:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800216:	ee                   	out    %al,(%dx)
+}
+  800217:	eb cb                	jmp    8001e4 <ide_probe_disk+0x83>
+
+00800219 <ide_set_disk>:
+
+void
+ide_set_disk(int d)
+{
+  800219:	55                   	push   %ebp
+  80021a:	89 e5                	mov    %esp,%ebp
+  80021c:	83 ec 08             	sub    $0x8,%esp
+  80021f:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (d < 0 || d > 3)
+  800222:	83 f8 03             	cmp    $0x3,%eax
+  800225:	77 07                	ja     80022e <ide_set_disk+0x15>
+		panic("bad disk number");
+	diskno = d;
+  800227:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  80022c:	c9                   	leave
+  80022d:	c3                   	ret
+		panic("bad disk number");
+  80022e:	83 ec 04             	sub    $0x4,%esp
+  800231:	68 b7 7e 80 00       	push   $0x807eb7
+  800236:	6a 7c                	push   $0x7c
+  800238:	68 c7 7e 80 00       	push   $0x807ec7
+  80023d:	e8 a1 30 00 00       	call   8032e3 <_panic>
+
+00800242 <ide_read>:
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs)
+{
+  800242:	55                   	push   %ebp
+  800243:	89 e5                	mov    %esp,%ebp
+  800245:	57                   	push   %edi
+  800246:	56                   	push   %esi
+  800247:	53                   	push   %ebx
+  800248:	83 ec 1c             	sub    $0x1c,%esp
+  80024b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80024e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800251:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int base = IDE_BASE(diskno), r;
+  800254:	a1 00 90 80 00       	mov    0x809000,%eax
+  800259:	83 f8 01             	cmp    $0x1,%eax
+  80025c:	b9 70 01 00 00       	mov    $0x170,%ecx
+  800261:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  800266:	0f 4f d1             	cmovg  %ecx,%edx
+  800269:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+
+	assert(nsecs <= 256);
+  80026c:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+  800272:	0f 87 8a 00 00 00    	ja     800302 <ide_read+0xc0>
+
+	ide_lock(diskno);
+  800278:	e8 f5 fd ff ff       	call   800072 <ide_lock>
+	ide_wait_ready(0);
+  80027d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800282:	e8 ac fd ff ff       	call   800033 <ide_wait_ready>
+
+	outb(base + 2, nsecs);
+  800287:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80028a:	8d 51 02             	lea    0x2(%ecx),%edx
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  80028d:	89 f8                	mov    %edi,%eax
+  80028f:	ee                   	out    %al,(%dx)
+	outb(base + 3, secno & 0xFF);
+  800290:	8d 51 03             	lea    0x3(%ecx),%edx
+  800293:	89 d8                	mov    %ebx,%eax
+  800295:	ee                   	out    %al,(%dx)
+	outb(base + 4, (secno >> 8) & 0xFF);
+  800296:	89 d8                	mov    %ebx,%eax
+  800298:	c1 e8 08             	shr    $0x8,%eax
+  80029b:	8d 51 04             	lea    0x4(%ecx),%edx
+  80029e:	ee                   	out    %al,(%dx)
+	outb(base + 5, (secno >> 16) & 0xFF);
+  80029f:	89 d8                	mov    %ebx,%eax
+  8002a1:	c1 e8 10             	shr    $0x10,%eax
+  8002a4:	8d 51 05             	lea    0x5(%ecx),%edx
+  8002a7:	ee                   	out    %al,(%dx)
+	outb(base + 6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  8002a8:	0f b6 05 00 90 80 00 	movzbl 0x809000,%eax
+  8002af:	c1 e0 04             	shl    $0x4,%eax
+  8002b2:	83 e0 10             	and    $0x10,%eax
+  8002b5:	c1 eb 18             	shr    $0x18,%ebx
+  8002b8:	83 e3 0f             	and    $0xf,%ebx
+  8002bb:	09 d8                	or     %ebx,%eax
+  8002bd:	83 c8 e0             	or     $0xffffffe0,%eax
+  8002c0:	8d 51 06             	lea    0x6(%ecx),%edx
+  8002c3:	ee                   	out    %al,(%dx)
+	outb(base + 7, 0x20);	// CMD 0x20 means read sector
+  8002c4:	8d 51 07             	lea    0x7(%ecx),%edx
+  8002c7:	b8 20 00 00 00       	mov    $0x20,%eax
+  8002cc:	ee                   	out    %al,(%dx)
+
+	for (r = 0; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  8002cd:	c1 e7 09             	shl    $0x9,%edi
+  8002d0:	01 f7                	add    %esi,%edi
+  8002d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002d7:	89 d8                	mov    %ebx,%eax
+  8002d9:	89 fb                	mov    %edi,%ebx
+  8002db:	39 de                	cmp    %ebx,%esi
+  8002dd:	74 3c                	je     80031b <ide_read+0xd9>
+		if ((r = ide_wait_ready(1)) < 0)
+  8002df:	b8 01 00 00 00       	mov    $0x1,%eax
+  8002e4:	e8 4a fd ff ff       	call   800033 <ide_wait_ready>
+  8002e9:	85 c0                	test   %eax,%eax
+  8002eb:	78 2e                	js     80031b <ide_read+0xd9>
+	__asm __volatile("cld\n\trepne\n\tinsl"			:
+  8002ed:	89 f7                	mov    %esi,%edi
+  8002ef:	b9 80 00 00 00       	mov    $0x80,%ecx
+  8002f4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8002f7:	fc                   	cld
+  8002f8:	f2 6d                	repnz insl (%dx),%es:(%edi)
+	for (r = 0; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  8002fa:	81 c6 00 02 00 00    	add    $0x200,%esi
+  800300:	eb d9                	jmp    8002db <ide_read+0x99>
+	assert(nsecs <= 256);
+  800302:	68 d0 7e 80 00       	push   $0x807ed0
+  800307:	68 dd 7e 80 00       	push   $0x807edd
+  80030c:	68 85 00 00 00       	push   $0x85
+  800311:	68 c7 7e 80 00       	push   $0x807ec7
+  800316:	e8 c8 2f 00 00       	call   8032e3 <_panic>
+			break;
+		insl(base, dst, SECTSIZE/4);
+	}
+
+	ide_unlock(diskno);
+  80031b:	89 c3                	mov    %eax,%ebx
+  80031d:	a1 00 90 80 00       	mov    0x809000,%eax
+  800322:	e8 93 fd ff ff       	call   8000ba <ide_unlock>
+	return r;
+}
+  800327:	89 d8                	mov    %ebx,%eax
+  800329:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80032c:	5b                   	pop    %ebx
+  80032d:	5e                   	pop    %esi
+  80032e:	5f                   	pop    %edi
+  80032f:	5d                   	pop    %ebp
+  800330:	c3                   	ret
+
+00800331 <ide_write>:
+
+int
+ide_write(uint32_t secno, const void *src, size_t nsecs)
+{
+  800331:	55                   	push   %ebp
+  800332:	89 e5                	mov    %esp,%ebp
+  800334:	57                   	push   %edi
+  800335:	56                   	push   %esi
+  800336:	53                   	push   %ebx
+  800337:	83 ec 1c             	sub    $0x1c,%esp
+  80033a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80033d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800340:	8b 75 10             	mov    0x10(%ebp),%esi
+	int base = IDE_BASE(diskno), r;
+  800343:	a1 00 90 80 00       	mov    0x809000,%eax
+  800348:	83 f8 01             	cmp    $0x1,%eax
+  80034b:	b9 70 01 00 00       	mov    $0x170,%ecx
+  800350:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  800355:	0f 4f d1             	cmovg  %ecx,%edx
+  800358:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+
+	assert(nsecs <= 256);
+  80035b:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+  800361:	0f 87 91 00 00 00    	ja     8003f8 <ide_write+0xc7>
+
+	ide_lock(diskno);
+  800367:	e8 06 fd ff ff       	call   800072 <ide_lock>
+	ide_wait_ready(0);
+  80036c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800371:	e8 bd fc ff ff       	call   800033 <ide_wait_ready>
+
+	outb(base + 2, nsecs);
+  800376:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800379:	8d 51 02             	lea    0x2(%ecx),%edx
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  80037c:	89 f0                	mov    %esi,%eax
+  80037e:	ee                   	out    %al,(%dx)
+	outb(base + 3, secno & 0xFF);
+  80037f:	8d 51 03             	lea    0x3(%ecx),%edx
+  800382:	89 d8                	mov    %ebx,%eax
+  800384:	ee                   	out    %al,(%dx)
+	outb(base + 4, (secno >> 8) & 0xFF);
+  800385:	89 d8                	mov    %ebx,%eax
+  800387:	c1 e8 08             	shr    $0x8,%eax
+  80038a:	8d 51 04             	lea    0x4(%ecx),%edx
+  80038d:	ee                   	out    %al,(%dx)
+	outb(base + 5, (secno >> 16) & 0xFF);
+  80038e:	89 d8                	mov    %ebx,%eax
+  800390:	c1 e8 10             	shr    $0x10,%eax
+  800393:	8d 51 05             	lea    0x5(%ecx),%edx
+  800396:	ee                   	out    %al,(%dx)
+	outb(base + 6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  800397:	8b 0d 00 90 80 00    	mov    0x809000,%ecx
+  80039d:	89 c8                	mov    %ecx,%eax
+  80039f:	c1 e0 04             	shl    $0x4,%eax
+  8003a2:	83 e0 10             	and    $0x10,%eax
+  8003a5:	c1 eb 18             	shr    $0x18,%ebx
+  8003a8:	83 e3 0f             	and    $0xf,%ebx
+  8003ab:	09 d8                	or     %ebx,%eax
+  8003ad:	83 c8 e0             	or     $0xffffffe0,%eax
+  8003b0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8003b3:	8d 53 06             	lea    0x6(%ebx),%edx
+  8003b6:	ee                   	out    %al,(%dx)
+	outb(base + 7, 0x30);	// CMD 0x30 means write sector
+  8003b7:	8d 53 07             	lea    0x7(%ebx),%edx
+  8003ba:	b8 30 00 00 00       	mov    $0x30,%eax
+  8003bf:	ee                   	out    %al,(%dx)
+
+	for (r = 0; nsecs > 0; nsecs--, src += SECTSIZE) {
+  8003c0:	c1 e6 09             	shl    $0x9,%esi
+  8003c3:	01 fe                	add    %edi,%esi
+  8003c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003ca:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8003cd:	89 d8                	mov    %ebx,%eax
+  8003cf:	89 f3                	mov    %esi,%ebx
+  8003d1:	39 df                	cmp    %ebx,%edi
+  8003d3:	74 3c                	je     800411 <ide_write+0xe0>
+		if ((r = ide_wait_ready(1)) < 0)
+  8003d5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003da:	e8 54 fc ff ff       	call   800033 <ide_wait_ready>
+  8003df:	85 c0                	test   %eax,%eax
+  8003e1:	78 2e                	js     800411 <ide_write+0xe0>
+	__asm __volatile("cld\n\trepne\n\toutsl"		:
+  8003e3:	89 fe                	mov    %edi,%esi
+  8003e5:	b9 80 00 00 00       	mov    $0x80,%ecx
+  8003ea:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8003ed:	fc                   	cld
+  8003ee:	f2 6f                	repnz outsl %ds:(%esi),(%dx)
+	for (r = 0; nsecs > 0; nsecs--, src += SECTSIZE) {
+  8003f0:	81 c7 00 02 00 00    	add    $0x200,%edi
+  8003f6:	eb d9                	jmp    8003d1 <ide_write+0xa0>
+	assert(nsecs <= 256);
+  8003f8:	68 d0 7e 80 00       	push   $0x807ed0
+  8003fd:	68 dd 7e 80 00       	push   $0x807edd
+  800402:	68 a0 00 00 00       	push   $0xa0
+  800407:	68 c7 7e 80 00       	push   $0x807ec7
+  80040c:	e8 d2 2e 00 00       	call   8032e3 <_panic>
+			break;
+		outsl(base, src, SECTSIZE/4);
+	}
+
+	ide_unlock(diskno);
+  800411:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800414:	89 c3                	mov    %eax,%ebx
+  800416:	89 c8                	mov    %ecx,%eax
+  800418:	e8 9d fc ff ff       	call   8000ba <ide_unlock>
+	return r;
+}
+  80041d:	89 d8                	mov    %ebx,%eax
+  80041f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800422:	5b                   	pop    %ebx
+  800423:	5e                   	pop    %esi
+  800424:	5f                   	pop    %edi
+  800425:	5d                   	pop    %ebp
+  800426:	c3                   	ret
+
+00800427 <bc_lookup>:
+}
+
+// Return blockno's slot in bc_blocks, or -1 if it has none
+static int32_t
+bc_lookup(uint32_t blockno)
+{
+  800427:	89 c1                	mov    %eax,%ecx
+	int32_t slot;
+
+	for (slot = bc_hash[blockno & (BC_NHASH - 1)] - 1; slot >= 0;
+  800429:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  80042e:	8b 14 85 00 10 82 00 	mov    0x821000(,%eax,4),%edx
+  800435:	8d 42 ff             	lea    -0x1(%edx),%eax
+  800438:	eb 0a                	jmp    800444 <bc_lookup+0x1d>
+	     slot = bc_hash_next[slot] - 1)
+  80043a:	8b 04 85 00 90 81 00 	mov    0x819000(,%eax,4),%eax
+  800441:	83 e8 01             	sub    $0x1,%eax
+	for (slot = bc_hash[blockno & (BC_NHASH - 1)] - 1; slot >= 0;
+  800444:	85 c0                	test   %eax,%eax
+  800446:	78 0b                	js     800453 <bc_lookup+0x2c>
+		if (bc_blocks[slot] == blockno)
+  800448:	39 0c 85 20 90 82 00 	cmp    %ecx,0x829020(,%eax,4)
+  80044f:	75 e9                	jne    80043a <bc_lookup+0x13>
+  800451:	eb 05                	jmp    800458 <bc_lookup+0x31>
+			return slot;
+	return -1;
+  800453:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  800458:	c3                   	ret
+
+00800459 <bc_link>:
+
+// Give blockno the bc_blocks slot 'slot', which must be unused
+static void
+bc_link(uint32_t slot, uint32_t blockno)
+{
+	int32_t *head = &bc_hash[blockno & (BC_NHASH - 1)];
+  800459:	89 d1                	mov    %edx,%ecx
+  80045b:	81 e1 ff 1f 00 00    	and    $0x1fff,%ecx
+
+	bc_blocks[slot] = blockno;
+  800461:	89 14 85 20 90 82 00 	mov    %edx,0x829020(,%eax,4)
+	bc_hash_next[slot] = *head;
+  800468:	8b 14 8d 00 10 82 00 	mov    0x821000(,%ecx,4),%edx
+  80046f:	89 14 85 00 90 81 00 	mov    %edx,0x819000(,%eax,4)
+	*head = slot + 1;
+  800476:	83 c0 01             	add    $0x1,%eax
+  800479:	89 04 8d 00 10 82 00 	mov    %eax,0x821000(,%ecx,4)
+}
+  800480:	c3                   	ret
+
+00800481 <bc_unlink>:
+
+// Take the block in slot 'slot' out of the hash table, leaving the
+// slot unused
+static void
+bc_unlink(uint32_t slot)
+{
+  800481:	55                   	push   %ebp
+  800482:	89 e5                	mov    %esp,%ebp
+  800484:	53                   	push   %ebx
+	int32_t *p = &bc_hash[bc_blocks[slot] & (BC_NHASH - 1)];
+  800485:	8b 14 85 20 90 82 00 	mov    0x829020(,%eax,4),%edx
+  80048c:	81 e2 ff 1f 00 00    	and    $0x1fff,%edx
+  800492:	8d 0c 95 00 10 82 00 	lea    0x821000(,%edx,4),%ecx
+  800499:	8b 14 95 00 10 82 00 	mov    0x821000(,%edx,4),%edx
+
+	while (*p != slot + 1)
+  8004a0:	8d 58 01             	lea    0x1(%eax),%ebx
+  8004a3:	eb 0e                	jmp    8004b3 <bc_unlink+0x32>
+		p = &bc_hash_next[*p - 1];
+  8004a5:	8d 0c 95 fc 8f 81 00 	lea    0x818ffc(,%edx,4),%ecx
+  8004ac:	8b 14 95 fc 8f 81 00 	mov    0x818ffc(,%edx,4),%edx
+	while (*p != slot + 1)
+  8004b3:	39 da                	cmp    %ebx,%edx
+  8004b5:	75 ee                	jne    8004a5 <bc_unlink+0x24>
+	*p = bc_hash_next[slot];
+  8004b7:	8b 04 85 00 90 81 00 	mov    0x819000(,%eax,4),%eax
+  8004be:	89 01                	mov    %eax,(%ecx)
+}
+  8004c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8004c3:	c9                   	leave
+  8004c4:	c3                   	ret
+
+008004c5 <bc_remove>:
+
+// Forget the block in slot 'slot', moving the last block into the slot
+static void
+bc_remove(uint32_t slot)
+{
+  8004c5:	55                   	push   %ebp
+  8004c6:	89 e5                	mov    %esp,%ebp
+  8004c8:	56                   	push   %esi
+  8004c9:	53                   	push   %ebx
+  8004ca:	89 c6                	mov    %eax,%esi
+	uint32_t last;
+
+	bc_unlink(slot);
+  8004cc:	e8 b0 ff ff ff       	call   800481 <bc_unlink>
+	if (slot != (last = --bc_nblocks)) {
+  8004d1:	a1 38 a9 85 00       	mov    0x85a938,%eax
+  8004d6:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  8004d9:	89 1d 38 a9 85 00    	mov    %ebx,0x85a938
+  8004df:	39 f3                	cmp    %esi,%ebx
+  8004e1:	75 04                	jne    8004e7 <bc_remove+0x22>
+		bc_unlink(last);
+		bc_link(slot, bc_blocks[last]);
+	}
+}
+  8004e3:	5b                   	pop    %ebx
+  8004e4:	5e                   	pop    %esi
+  8004e5:	5d                   	pop    %ebp
+  8004e6:	c3                   	ret
+		bc_unlink(last);
+  8004e7:	89 d8                	mov    %ebx,%eax
+  8004e9:	e8 93 ff ff ff       	call   800481 <bc_unlink>
+		bc_link(slot, bc_blocks[last]);
+  8004ee:	8b 14 9d 20 90 82 00 	mov    0x829020(,%ebx,4),%edx
+  8004f5:	89 f0                	mov    %esi,%eax
+  8004f7:	e8 5d ff ff ff       	call   800459 <bc_link>
+}
+  8004fc:	eb e5                	jmp    8004e3 <bc_remove+0x1e>
+
+008004fe <va_is_paged_out>:
+	if (!umapdir)
+  8004fe:	83 3d 18 a9 85 00 00 	cmpl   $0x0,0x85a918
+  800505:	74 26                	je     80052d <va_is_paged_out+0x2f>
+{
+  800507:	55                   	push   %ebp
+  800508:	89 e5                	mov    %esp,%ebp
+  80050a:	83 ec 10             	sub    $0x10,%esp
+	mte = umapdir_walk(va, 0);
+  80050d:	6a 00                	push   $0x0
+  80050f:	50                   	push   %eax
+  800510:	e8 35 62 00 00       	call   80674a <umapdir_walk>
+  800515:	89 c2                	mov    %eax,%edx
+	return mte && (*mte & MTE_P);
+  800517:	83 c4 10             	add    $0x10,%esp
+  80051a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051f:	85 d2                	test   %edx,%edx
+  800521:	74 05                	je     800528 <va_is_paged_out+0x2a>
+  800523:	8b 02                	mov    (%edx),%eax
+  800525:	83 e0 01             	and    $0x1,%eax
+  800528:	83 e0 01             	and    $0x1,%eax
+}
+  80052b:	c9                   	leave
+  80052c:	c3                   	ret
+		return 0;
+  80052d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800532:	c3                   	ret
+
+00800533 <diskaddr>:
+{
+  800533:	55                   	push   %ebp
+  800534:	89 e5                	mov    %esp,%ebp
+  800536:	83 ec 08             	sub    $0x8,%esp
+  800539:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (blockno == 0 || (super && blockno >= super->s_nblocks))
+  80053c:	85 c0                	test   %eax,%eax
+  80053e:	74 19                	je     800559 <diskaddr+0x26>
+  800540:	8b 15 14 a9 85 00    	mov    0x85a914,%edx
+  800546:	85 d2                	test   %edx,%edx
+  800548:	74 05                	je     80054f <diskaddr+0x1c>
+  80054a:	3b 42 04             	cmp    0x4(%edx),%eax
+  80054d:	73 0a                	jae    800559 <diskaddr+0x26>
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  80054f:	05 00 00 01 00       	add    $0x10000,%eax
+  800554:	c1 e0 0c             	shl    $0xc,%eax
+}
+  800557:	c9                   	leave
+  800558:	c3                   	ret
+		panic("bad block number %08x in diskaddr", blockno);
+  800559:	50                   	push   %eax
+  80055a:	68 f4 7e 80 00       	push   $0x807ef4
+  80055f:	6a 19                	push   $0x19
+  800561:	68 fb 80 80 00       	push   $0x8080fb
+  800566:	e8 78 2d 00 00       	call   8032e3 <_panic>
+
+0080056b <va_is_mapped>:
+{
+  80056b:	55                   	push   %ebp
+  80056c:	89 e5                	mov    %esp,%ebp
+  80056e:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  800571:	89 d0                	mov    %edx,%eax
+  800573:	c1 e8 16             	shr    $0x16,%eax
+  800576:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  80057d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800582:	f6 c1 01             	test   $0x1,%cl
+  800585:	74 0d                	je     800594 <va_is_mapped+0x29>
+  800587:	c1 ea 0c             	shr    $0xc,%edx
+  80058a:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  800591:	83 e0 01             	and    $0x1,%eax
+  800594:	83 e0 01             	and    $0x1,%eax
+}
+  800597:	5d                   	pop    %ebp
+  800598:	c3                   	ret
+
+00800599 <va_page_in>:
+{
+  800599:	55                   	push   %ebp
+  80059a:	89 e5                	mov    %esp,%ebp
+  80059c:	53                   	push   %ebx
+  80059d:	83 ec 04             	sub    $0x4,%esp
+  8005a0:	89 c3                	mov    %eax,%ebx
+	if (va_is_paged_out(va))
+  8005a2:	e8 57 ff ff ff       	call   8004fe <va_is_paged_out>
+  8005a7:	84 c0                	test   %al,%al
+  8005a9:	74 03                	je     8005ae <va_page_in+0x15>
+		(void) *(volatile char*) va;
+  8005ab:	0f b6 03             	movzbl (%ebx),%eax
+	return va_is_mapped(va);
+  8005ae:	83 ec 0c             	sub    $0xc,%esp
+  8005b1:	53                   	push   %ebx
+  8005b2:	e8 b4 ff ff ff       	call   80056b <va_is_mapped>
+}
+  8005b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8005ba:	c9                   	leave
+  8005bb:	c3                   	ret
+
+008005bc <va_is_dirty>:
+{
+  8005bc:	55                   	push   %ebp
+  8005bd:	89 e5                	mov    %esp,%ebp
+	return (uvpt[PGNUM(va)] & PTE_D) != 0;
+  8005bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005c2:	c1 e8 0c             	shr    $0xc,%eax
+  8005c5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8005cc:	c1 e8 06             	shr    $0x6,%eax
+  8005cf:	83 e0 01             	and    $0x1,%eax
+}
+  8005d2:	5d                   	pop    %ebp
+  8005d3:	c3                   	ret
+
+008005d4 <flush_block>:
+{
+  8005d4:	55                   	push   %ebp
+  8005d5:	89 e5                	mov    %esp,%ebp
+  8005d7:	56                   	push   %esi
+  8005d8:	53                   	push   %ebx
+  8005d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  8005dc:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+  8005e2:	81 fe ff ff ff bf    	cmp    $0xbfffffff,%esi
+  8005e8:	77 18                	ja     800602 <flush_block+0x2e>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8005ea:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!va_page_in(addr) || !va_is_dirty(addr))
+  8005f0:	89 d8                	mov    %ebx,%eax
+  8005f2:	e8 a2 ff ff ff       	call   800599 <va_page_in>
+  8005f7:	84 c0                	test   %al,%al
+  8005f9:	75 19                	jne    800614 <flush_block+0x40>
+}
+  8005fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005fe:	5b                   	pop    %ebx
+  8005ff:	5e                   	pop    %esi
+  800600:	5d                   	pop    %ebp
+  800601:	c3                   	ret
+		panic("flush_block of bad va %08x", addr);
+  800602:	53                   	push   %ebx
+  800603:	68 03 81 80 00       	push   $0x808103
+  800608:	6a 4b                	push   $0x4b
+  80060a:	68 fb 80 80 00       	push   $0x8080fb
+  80060f:	e8 cf 2c 00 00       	call   8032e3 <_panic>
+	if (!va_page_in(addr) || !va_is_dirty(addr))
+  800614:	83 ec 0c             	sub    $0xc,%esp
+  800617:	53                   	push   %ebx
+  800618:	e8 9f ff ff ff       	call   8005bc <va_is_dirty>
+  80061d:	83 c4 10             	add    $0x10,%esp
+  800620:	84 c0                	test   %al,%al
+  800622:	74 d7                	je     8005fb <flush_block+0x27>
+	if ((r = ide_write(blockno*BLKSECTS, addr, BLKSECTS)) < 0)
+  800624:	83 ec 04             	sub    $0x4,%esp
+  800627:	6a 08                	push   $0x8
+  800629:	53                   	push   %ebx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  80062a:	c1 ee 0c             	shr    $0xc,%esi
+	if ((r = ide_write(blockno*BLKSECTS, addr, BLKSECTS)) < 0)
+  80062d:	c1 e6 03             	shl    $0x3,%esi
+  800630:	56                   	push   %esi
+  800631:	e8 fb fc ff ff       	call   800331 <ide_write>
+  800636:	83 c4 10             	add    $0x10,%esp
+  800639:	85 c0                	test   %eax,%eax
+  80063b:	78 2d                	js     80066a <flush_block+0x96>
+	bc_stats.ret_writebacks++;
+  80063d:	83 05 34 a9 85 00 01 	addl   $0x1,0x85a934
+	if ((r = sys_page_clean(0, addr, 1)) < 0)
+  800644:	83 ec 04             	sub    $0x4,%esp
+  800647:	6a 01                	push   $0x1
+  800649:	53                   	push   %ebx
+  80064a:	6a 00                	push   $0x0
+  80064c:	e8 23 3a 00 00       	call   804074 <sys_page_clean>
+  800651:	83 c4 10             	add    $0x10,%esp
+  800654:	85 c0                	test   %eax,%eax
+  800656:	79 a3                	jns    8005fb <flush_block+0x27>
+		panic("in flush_block, sys_page_clean: %e", r);
+  800658:	50                   	push   %eax
+  800659:	68 18 7f 80 00       	push   $0x807f18
+  80065e:	6a 54                	push   $0x54
+  800660:	68 fb 80 80 00       	push   $0x8080fb
+  800665:	e8 79 2c 00 00       	call   8032e3 <_panic>
+		panic("in flush_block, ide_write: %e", r);
+  80066a:	50                   	push   %eax
+  80066b:	68 1e 81 80 00       	push   $0x80811e
+  800670:	6a 51                	push   $0x51
+  800672:	68 fb 80 80 00       	push   $0x8080fb
+  800677:	e8 67 2c 00 00       	call   8032e3 <_panic>
+
+0080067c <bc_evict>:
+// Make room in the block cache by evicting a block, chosen by the
+// CLOCK algorithm.  Returns the bc_blocks slot that was freed up; the
+// block is still in it, for the caller to unlink or remove.
+static uint32_t
+bc_evict(void)
+{
+  80067c:	55                   	push   %ebp
+  80067d:	89 e5                	mov    %esp,%ebp
+  80067f:	56                   	push   %esi
+  800680:	53                   	push   %ebx
+  800681:	eb 07                	jmp    80068a <bc_evict+0xe>
+	void *addr;
+	int r;
+
+	for (;; bc_hand++) {
+  800683:	83 05 00 90 82 00 01 	addl   $0x1,0x829000
+		if (bc_hand >= bc_nblocks)
+  80068a:	a1 38 a9 85 00       	mov    0x85a938,%eax
+  80068f:	39 05 00 90 82 00    	cmp    %eax,0x829000
+  800695:	72 0a                	jb     8006a1 <bc_evict+0x25>
+			bc_hand = 0;
+  800697:	c7 05 00 90 82 00 00 	movl   $0x0,0x829000
+  80069e:	00 00 00 
+		addr = (void*) (DISKMAP + bc_blocks[bc_hand] * BLKSIZE);
+  8006a1:	a1 00 90 82 00       	mov    0x829000,%eax
+  8006a6:	8b 1c 85 20 90 82 00 	mov    0x829020(,%eax,4),%ebx
+  8006ad:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8006b3:	c1 e3 0c             	shl    $0xc,%ebx
+
+		// The paging library may already have dropped it for us.
+		if (!va_page_in(addr))
+  8006b6:	89 d8                	mov    %ebx,%eax
+  8006b8:	e8 dc fe ff ff       	call   800599 <va_page_in>
+  8006bd:	84 c0                	test   %al,%al
+  8006bf:	0f 84 84 00 00 00    	je     800749 <bc_evict+0xcd>
+			break;
+
+		// Used since we last came by?  Clear PTE_A (remapping the
+		// page does that) and give it a second chance.
+		if (uvpt[PGNUM(addr)] & PTE_A) {
+  8006c5:	89 de                	mov    %ebx,%esi
+  8006c7:	c1 ee 0c             	shr    $0xc,%esi
+  8006ca:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8006d1:	a8 20                	test   $0x20,%al
+  8006d3:	74 52                	je     800727 <bc_evict+0xab>
+			flush_block(addr);
+  8006d5:	83 ec 0c             	sub    $0xc,%esp
+  8006d8:	53                   	push   %ebx
+  8006d9:	e8 f6 fe ff ff       	call   8005d4 <flush_block>
+			if ((uvpt[PGNUM(addr)] & PTE_A) &&
+  8006de:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8006e5:	83 c4 10             	add    $0x10,%esp
+  8006e8:	a8 20                	test   $0x20,%al
+  8006ea:	74 97                	je     800683 <bc_evict+0x7>
+			    (r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0)
+  8006ec:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8006f3:	83 ec 0c             	sub    $0xc,%esp
+  8006f6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8006fb:	50                   	push   %eax
+  8006fc:	53                   	push   %ebx
+  8006fd:	6a 00                	push   $0x0
+  8006ff:	53                   	push   %ebx
+  800700:	6a 00                	push   $0x0
+  800702:	e8 d4 37 00 00       	call   803edb <sys_page_map>
+			if ((uvpt[PGNUM(addr)] & PTE_A) &&
+  800707:	83 c4 20             	add    $0x20,%esp
+  80070a:	85 c0                	test   %eax,%eax
+  80070c:	0f 89 71 ff ff ff    	jns    800683 <bc_evict+0x7>
+				panic("in bc_evict, sys_page_map: %e", r);
+  800712:	50                   	push   %eax
+  800713:	68 3c 81 80 00       	push   $0x80813c
+  800718:	68 a0 00 00 00       	push   $0xa0
+  80071d:	68 fb 80 80 00       	push   $0x8080fb
+  800722:	e8 bc 2b 00 00       	call   8032e3 <_panic>
+			continue;
+		}
+
+		flush_block(addr);
+  800727:	83 ec 0c             	sub    $0xc,%esp
+  80072a:	53                   	push   %ebx
+  80072b:	e8 a4 fe ff ff       	call   8005d4 <flush_block>
+		if ((r = sys_page_unmap(0, addr)) < 0)
+  800730:	83 c4 08             	add    $0x8,%esp
+  800733:	53                   	push   %ebx
+  800734:	6a 00                	push   $0x0
+  800736:	e8 e2 37 00 00       	call   803f1d <sys_page_unmap>
+  80073b:	83 c4 10             	add    $0x10,%esp
+  80073e:	85 c0                	test   %eax,%eax
+  800740:	78 1c                	js     80075e <bc_evict+0xe2>
+			panic("in bc_evict, sys_page_unmap: %e", r);
+		bc_stats.ret_evictions++;
+  800742:	83 05 2c a9 85 00 01 	addl   $0x1,0x85a92c
+		break;
+	}
+	return bc_hand++;
+  800749:	a1 00 90 82 00       	mov    0x829000,%eax
+  80074e:	8d 50 01             	lea    0x1(%eax),%edx
+  800751:	89 15 00 90 82 00    	mov    %edx,0x829000
+}
+  800757:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80075a:	5b                   	pop    %ebx
+  80075b:	5e                   	pop    %esi
+  80075c:	5d                   	pop    %ebp
+  80075d:	c3                   	ret
+			panic("in bc_evict, sys_page_unmap: %e", r);
+  80075e:	50                   	push   %eax
+  80075f:	68 3c 7f 80 00       	push   $0x807f3c
+  800764:	68 a6 00 00 00       	push   $0xa6
+  800769:	68 fb 80 80 00       	push   $0x8080fb
+  80076e:	e8 70 2b 00 00       	call   8032e3 <_panic>
+
+00800773 <bc_add>:
+{
+	uint32_t slot;
+
+	// The boot and super blocks are never evicted.  A block the
+	// paging library dropped keeps its slot while it's out.
+	if (blockno < 2 || bc_lookup(blockno) >= 0)
+  800773:	83 f8 01             	cmp    $0x1,%eax
+  800776:	76 48                	jbe    8007c0 <bc_add+0x4d>
+{
+  800778:	55                   	push   %ebp
+  800779:	89 e5                	mov    %esp,%ebp
+  80077b:	56                   	push   %esi
+  80077c:	53                   	push   %ebx
+  80077d:	89 c3                	mov    %eax,%ebx
+	if (blockno < 2 || bc_lookup(blockno) >= 0)
+  80077f:	e8 a3 fc ff ff       	call   800427 <bc_lookup>
+  800784:	85 c0                	test   %eax,%eax
+  800786:	79 22                	jns    8007aa <bc_add+0x37>
+		return;
+
+	if (bc_nblocks < bc_capacity) {
+  800788:	a1 38 a9 85 00       	mov    0x85a938,%eax
+  80078d:	3b 05 04 90 80 00    	cmp    0x809004,%eax
+  800793:	72 19                	jb     8007ae <bc_add+0x3b>
+		bc_link(bc_nblocks++, blockno);
+		return;
+	}
+
+	slot = bc_evict();
+  800795:	e8 e2 fe ff ff       	call   80067c <bc_evict>
+  80079a:	89 c6                	mov    %eax,%esi
+	bc_unlink(slot);
+  80079c:	e8 e0 fc ff ff       	call   800481 <bc_unlink>
+	bc_link(slot, blockno);
+  8007a1:	89 da                	mov    %ebx,%edx
+  8007a3:	89 f0                	mov    %esi,%eax
+  8007a5:	e8 af fc ff ff       	call   800459 <bc_link>
+}
+  8007aa:	5b                   	pop    %ebx
+  8007ab:	5e                   	pop    %esi
+  8007ac:	5d                   	pop    %ebp
+  8007ad:	c3                   	ret
+		bc_link(bc_nblocks++, blockno);
+  8007ae:	8d 50 01             	lea    0x1(%eax),%edx
+  8007b1:	89 15 38 a9 85 00    	mov    %edx,0x85a938
+  8007b7:	89 da                	mov    %ebx,%edx
+  8007b9:	e8 9b fc ff ff       	call   800459 <bc_link>
+		return;
+  8007be:	eb ea                	jmp    8007aa <bc_add+0x37>
+  8007c0:	c3                   	ret
+
+008007c1 <bc_pgfault>:
+// Fault any disk block that is read in to memory by
+// loading it from disk.  Returns 0 if the fault wasn't in the block
+// cache, so the other page fault handlers get a look at it.
+static int
+bc_pgfault(struct UTrapframe *utf)
+{
+  8007c1:	55                   	push   %ebp
+  8007c2:	89 e5                	mov    %esp,%ebp
+  8007c4:	56                   	push   %esi
+  8007c5:	53                   	push   %ebx
+	void *addr = (void *) utf->utf_fault_va;
+  8007c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007c9:	8b 10                	mov    (%eax),%edx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  8007cb:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+	int r;
+
+	// Check that the fault was within the block cache region
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+  8007d1:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8007d6:	0f 87 c3 00 00 00    	ja     80089f <bc_pgfault+0xde>
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  8007dc:	c1 e8 0c             	shr    $0xc,%eax
+  8007df:	89 c3                	mov    %eax,%ebx
+		return 0;
+
+	// Sanity check the block number.
+	if (super && blockno >= super->s_nblocks)
+  8007e1:	a1 14 a9 85 00       	mov    0x85a914,%eax
+  8007e6:	85 c0                	test   %eax,%eax
+  8007e8:	74 05                	je     8007ef <bc_pgfault+0x2e>
+  8007ea:	3b 58 04             	cmp    0x4(%eax),%ebx
+  8007ed:	73 5c                	jae    80084b <bc_pgfault+0x8a>
+	// of the block from the disk into that page.
+	// Hint: first round addr to page boundary.
+	//
+	// LAB 5: you code here:
+
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8007ef:	89 d6                	mov    %edx,%esi
+  8007f1:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	bc_add(blockno);
+  8007f7:	89 d8                	mov    %ebx,%eax
+  8007f9:	e8 75 ff ff ff       	call   800773 <bc_add>
+
+	// no need to allocate more than one page, because BLKSIZE is equal to PGSIZE
+	// page_alloc makes room by dropping clean blocks if it has to
+	if ((r = page_alloc(0, addr, PTE_P|PTE_U|PTE_W, 0)) < 0)
+  8007fe:	6a 00                	push   $0x0
+  800800:	6a 07                	push   $0x7
+  800802:	56                   	push   %esi
+  800803:	6a 00                	push   $0x0
+  800805:	e8 6a 62 00 00       	call   806a74 <page_alloc>
+  80080a:	83 c4 10             	add    $0x10,%esp
+  80080d:	85 c0                	test   %eax,%eax
+  80080f:	78 4f                	js     800860 <bc_pgfault+0x9f>
+		panic("in bc_pgfault, page_alloc: %e", r);
+	if ((r = ide_read(blockno*BLKSECTS, addr, BLKSECTS)) < 0)
+  800811:	83 ec 04             	sub    $0x4,%esp
+  800814:	6a 08                	push   $0x8
+  800816:	56                   	push   %esi
+  800817:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  80081e:	50                   	push   %eax
+  80081f:	e8 1e fa ff ff       	call   800242 <ide_read>
+  800824:	83 c4 10             	add    $0x10,%esp
+  800827:	85 c0                	test   %eax,%eax
+  800829:	78 4a                	js     800875 <bc_pgfault+0xb4>
+		panic("in bc_pgfault, ide_read: %e", r);
+
+	// Clear the dirty bit for the disk block page since we just read the
+	// block from disk
+	if ((r = sys_page_clean(0, addr, 1)) < 0)
+  80082b:	83 ec 04             	sub    $0x4,%esp
+  80082e:	6a 01                	push   $0x1
+  800830:	56                   	push   %esi
+  800831:	6a 00                	push   $0x0
+  800833:	e8 3c 38 00 00       	call   804074 <sys_page_clean>
+  800838:	83 c4 10             	add    $0x10,%esp
+  80083b:	85 c0                	test   %eax,%eax
+  80083d:	78 4b                	js     80088a <bc_pgfault+0xc9>
+		panic("in bc_pgfault, sys_page_clean: %e", r);
+	return 1;
+  80083f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  800844:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800847:	5b                   	pop    %ebx
+  800848:	5e                   	pop    %esi
+  800849:	5d                   	pop    %ebp
+  80084a:	c3                   	ret
+		panic("reading non-existent block %08x\n", blockno);
+  80084b:	53                   	push   %ebx
+  80084c:	68 5c 7f 80 00       	push   $0x807f5c
+  800851:	68 9f 01 00 00       	push   $0x19f
+  800856:	68 fb 80 80 00       	push   $0x8080fb
+  80085b:	e8 83 2a 00 00       	call   8032e3 <_panic>
+		panic("in bc_pgfault, page_alloc: %e", r);
+  800860:	50                   	push   %eax
+  800861:	68 5a 81 80 00       	push   $0x80815a
+  800866:	68 ad 01 00 00       	push   $0x1ad
+  80086b:	68 fb 80 80 00       	push   $0x8080fb
+  800870:	e8 6e 2a 00 00       	call   8032e3 <_panic>
+		panic("in bc_pgfault, ide_read: %e", r);
+  800875:	50                   	push   %eax
+  800876:	68 78 81 80 00       	push   $0x808178
+  80087b:	68 af 01 00 00       	push   $0x1af
+  800880:	68 fb 80 80 00       	push   $0x8080fb
+  800885:	e8 59 2a 00 00       	call   8032e3 <_panic>
+		panic("in bc_pgfault, sys_page_clean: %e", r);
+  80088a:	50                   	push   %eax
+  80088b:	68 80 7f 80 00       	push   $0x807f80
+  800890:	68 b4 01 00 00       	push   $0x1b4
+  800895:	68 fb 80 80 00       	push   $0x8080fb
+  80089a:	e8 44 2a 00 00       	call   8032e3 <_panic>
+		return 0;
+  80089f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a4:	eb 9e                	jmp    800844 <bc_pgfault+0x83>
+
+008008a6 <bc_resident>:
+{
+  8008a6:	55                   	push   %ebp
+  8008a7:	89 e5                	mov    %esp,%ebp
+  8008a9:	56                   	push   %esi
+  8008aa:	53                   	push   %ebx
+	for (i = n = 0; i < bc_nblocks; i++)
+  8008ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8008b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008b5:	eb 23                	jmp    8008da <bc_resident+0x34>
+		if (va_is_mapped((void*) (DISKMAP + bc_blocks[i] * BLKSIZE)))
+  8008b7:	83 ec 0c             	sub    $0xc,%esp
+  8008ba:	8b 04 9d 20 90 82 00 	mov    0x829020(,%ebx,4),%eax
+  8008c1:	05 00 00 01 00       	add    $0x10000,%eax
+  8008c6:	c1 e0 0c             	shl    $0xc,%eax
+  8008c9:	50                   	push   %eax
+  8008ca:	e8 9c fc ff ff       	call   80056b <va_is_mapped>
+  8008cf:	83 c4 10             	add    $0x10,%esp
+			n++;
+  8008d2:	3c 01                	cmp    $0x1,%al
+  8008d4:	83 de ff             	sbb    $0xffffffff,%esi
+	for (i = n = 0; i < bc_nblocks; i++)
+  8008d7:	83 c3 01             	add    $0x1,%ebx
+  8008da:	3b 1d 38 a9 85 00    	cmp    0x85a938,%ebx
+  8008e0:	72 d5                	jb     8008b7 <bc_resident+0x11>
+}
+  8008e2:	89 f0                	mov    %esi,%eax
+  8008e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008e7:	5b                   	pop    %ebx
+  8008e8:	5e                   	pop    %esi
+  8008e9:	5d                   	pop    %ebp
+  8008ea:	c3                   	ret
+
+008008eb <bc_set_capacity>:
+{
+  8008eb:	55                   	push   %ebp
+  8008ec:	89 e5                	mov    %esp,%ebp
+  8008ee:	83 ec 08             	sub    $0x8,%esp
+  8008f1:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (capacity < BC_MIN_CAPACITY || capacity > BC_MAX_CAPACITY)
+  8008f4:	8d 50 c0             	lea    -0x40(%eax),%edx
+  8008f7:	81 fa c0 1f 00 00    	cmp    $0x1fc0,%edx
+  8008fd:	77 25                	ja     800924 <bc_set_capacity+0x39>
+	bc_capacity = capacity;
+  8008ff:	a3 04 90 80 00       	mov    %eax,0x809004
+	while (bc_nblocks > bc_capacity)
+  800904:	eb 0a                	jmp    800910 <bc_set_capacity+0x25>
+		bc_remove(bc_evict());
+  800906:	e8 71 fd ff ff       	call   80067c <bc_evict>
+  80090b:	e8 b5 fb ff ff       	call   8004c5 <bc_remove>
+	while (bc_nblocks > bc_capacity)
+  800910:	a1 38 a9 85 00       	mov    0x85a938,%eax
+  800915:	39 05 04 90 80 00    	cmp    %eax,0x809004
+  80091b:	72 e9                	jb     800906 <bc_set_capacity+0x1b>
+	return 0;
+  80091d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800922:	c9                   	leave
+  800923:	c3                   	ret
+		return -E_INVAL;
+  800924:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800929:	eb f7                	jmp    800922 <bc_set_capacity+0x37>
+
+0080092b <bc_read_ahead>:
+{
+  80092b:	55                   	push   %ebp
+  80092c:	89 e5                	mov    %esp,%ebp
+  80092e:	57                   	push   %edi
+  80092f:	56                   	push   %esi
+  800930:	53                   	push   %ebx
+  800931:	83 ec 2c             	sub    $0x2c,%esp
+  800934:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (blockno < 2 || nblocks > BC_MAX_READAHEAD
+  800937:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  80093b:	0f 86 74 01 00 00    	jbe    800ab5 <bc_read_ahead+0x18a>
+  800941:	83 fa 20             	cmp    $0x20,%edx
+  800944:	0f 87 6b 01 00 00    	ja     800ab5 <bc_read_ahead+0x18a>
+	    || (super && blockno + nblocks > super->s_nblocks))
+  80094a:	a1 14 a9 85 00       	mov    0x85a914,%eax
+  80094f:	85 c0                	test   %eax,%eax
+  800951:	74 0e                	je     800961 <bc_read_ahead+0x36>
+  800953:	89 d1                	mov    %edx,%ecx
+  800955:	03 4d 08             	add    0x8(%ebp),%ecx
+  800958:	39 48 04             	cmp    %ecx,0x4(%eax)
+  80095b:	0f 82 5d 01 00 00    	jb     800abe <bc_read_ahead+0x193>
+	nblocks = MIN(nblocks, bc_capacity / 2);
+  800961:	a1 04 90 80 00       	mov    0x809004,%eax
+  800966:	d1 e8                	shr    %eax
+  800968:	39 d0                	cmp    %edx,%eax
+  80096a:	0f 46 d0             	cmovbe %eax,%edx
+  80096d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	addr = (char*) (DISKMAP + blockno * BLKSIZE);
+  800970:	8b 45 08             	mov    0x8(%ebp),%eax
+  800973:	05 00 00 01 00       	add    $0x10000,%eax
+  800978:	c1 e0 0c             	shl    $0xc,%eax
+  80097b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	int r = 0;
+  80097e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+	for (i = 0; i < nblocks; i = j) {
+  800985:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80098c:	eb 04                	jmp    800992 <bc_read_ahead+0x67>
+			j = i + 1;
+  80098e:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+	for (i = 0; i < nblocks; i = j) {
+  800992:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800995:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+  800998:	0f 83 05 01 00 00    	jae    800aa3 <bc_read_ahead+0x178>
+		if (va_is_mapped(addr + i*BLKSIZE) || va_is_paged_out(addr + i*BLKSIZE)) {
+  80099e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8009a1:	89 f3                	mov    %esi,%ebx
+  8009a3:	c1 e3 0c             	shl    $0xc,%ebx
+  8009a6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8009a9:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  8009ac:	83 ec 0c             	sub    $0xc,%esp
+  8009af:	57                   	push   %edi
+  8009b0:	e8 b6 fb ff ff       	call   80056b <va_is_mapped>
+  8009b5:	83 c4 10             	add    $0x10,%esp
+  8009b8:	84 c0                	test   %al,%al
+  8009ba:	75 d2                	jne    80098e <bc_read_ahead+0x63>
+  8009bc:	89 f8                	mov    %edi,%eax
+  8009be:	e8 3b fb ff ff       	call   8004fe <va_is_paged_out>
+  8009c3:	84 c0                	test   %al,%al
+  8009c5:	75 c7                	jne    80098e <bc_read_ahead+0x63>
+  8009c7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8009ca:	01 c3                	add    %eax,%ebx
+			     && !va_is_paged_out(addr + j*BLKSIZE); j++) {
+  8009cc:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+		for (j = i; j < nblocks && !va_is_mapped(addr + j*BLKSIZE)
+  8009cf:	89 df                	mov    %ebx,%edi
+  8009d1:	83 ec 0c             	sub    $0xc,%esp
+  8009d4:	53                   	push   %ebx
+  8009d5:	e8 91 fb ff ff       	call   80056b <va_is_mapped>
+  8009da:	83 c4 10             	add    $0x10,%esp
+  8009dd:	84 c0                	test   %al,%al
+  8009df:	75 44                	jne    800a25 <bc_read_ahead+0xfa>
+			     && !va_is_paged_out(addr + j*BLKSIZE); j++) {
+  8009e1:	89 d8                	mov    %ebx,%eax
+  8009e3:	e8 16 fb ff ff       	call   8004fe <va_is_paged_out>
+  8009e8:	84 c0                	test   %al,%al
+  8009ea:	75 39                	jne    800a25 <bc_read_ahead+0xfa>
+			bc_add(blockno + j);
+  8009ec:	89 f0                	mov    %esi,%eax
+  8009ee:	03 45 08             	add    0x8(%ebp),%eax
+  8009f1:	e8 7d fd ff ff       	call   800773 <bc_add>
+			if ((r = page_alloc(0, addr + j*BLKSIZE, PTE_P|PTE_U|PTE_W, 0)) < 0)
+  8009f6:	6a 00                	push   $0x0
+  8009f8:	6a 07                	push   $0x7
+  8009fa:	57                   	push   %edi
+  8009fb:	6a 00                	push   $0x0
+  8009fd:	e8 72 60 00 00       	call   806a74 <page_alloc>
+  800a02:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800a05:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800a0b:	83 c4 10             	add    $0x10,%esp
+  800a0e:	85 c0                	test   %eax,%eax
+  800a10:	78 13                	js     800a25 <bc_read_ahead+0xfa>
+			(void) *(volatile char*) (addr + j*BLKSIZE);
+  800a12:	0f b6 07             	movzbl (%edi),%eax
+			     && !va_is_paged_out(addr + j*BLKSIZE); j++) {
+  800a15:	83 c6 01             	add    $0x1,%esi
+  800a18:	39 75 e0             	cmp    %esi,-0x20(%ebp)
+  800a1b:	75 b2                	jne    8009cf <bc_read_ahead+0xa4>
+  800a1d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a20:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  800a23:	eb 08                	jmp    800a2d <bc_read_ahead+0x102>
+		if (j == i)
+  800a25:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a28:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800a2b:	74 7d                	je     800aaa <bc_read_ahead+0x17f>
+		if ((r = ide_read((blockno + i)*BLKSECTS, addr + i*BLKSIZE, (j - i)*BLKSECTS)) < 0)
+  800a2d:	89 f3                	mov    %esi,%ebx
+  800a2f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800a32:	29 d3                	sub    %edx,%ebx
+  800a34:	83 ec 04             	sub    $0x4,%esp
+  800a37:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  800a3e:	50                   	push   %eax
+  800a3f:	57                   	push   %edi
+  800a40:	89 d0                	mov    %edx,%eax
+  800a42:	03 45 08             	add    0x8(%ebp),%eax
+  800a45:	c1 e0 03             	shl    $0x3,%eax
+  800a48:	50                   	push   %eax
+  800a49:	e8 f4 f7 ff ff       	call   800242 <ide_read>
+  800a4e:	83 c4 10             	add    $0x10,%esp
+  800a51:	85 c0                	test   %eax,%eax
+  800a53:	78 24                	js     800a79 <bc_read_ahead+0x14e>
+		if ((r = sys_page_clean(0, addr + i*BLKSIZE, j - i)) < 0)
+  800a55:	83 ec 04             	sub    $0x4,%esp
+  800a58:	53                   	push   %ebx
+  800a59:	57                   	push   %edi
+  800a5a:	6a 00                	push   $0x0
+  800a5c:	e8 13 36 00 00       	call   804074 <sys_page_clean>
+  800a61:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800a64:	83 c4 10             	add    $0x10,%esp
+  800a67:	85 c0                	test   %eax,%eax
+  800a69:	78 23                	js     800a8e <bc_read_ahead+0x163>
+		bc_stats.ret_readahead += j - i;
+  800a6b:	01 1d 30 a9 85 00    	add    %ebx,0x85a930
+  800a71:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  800a74:	e9 19 ff ff ff       	jmp    800992 <bc_read_ahead+0x67>
+			panic("in bc_read_ahead, ide_read: %e", r);
+  800a79:	50                   	push   %eax
+  800a7a:	68 a4 7f 80 00       	push   $0x807fa4
+  800a7f:	68 02 01 00 00       	push   $0x102
+  800a84:	68 fb 80 80 00       	push   $0x8080fb
+  800a89:	e8 55 28 00 00       	call   8032e3 <_panic>
+			panic("in bc_read_ahead, sys_page_clean: %e", r);
+  800a8e:	50                   	push   %eax
+  800a8f:	68 c4 7f 80 00       	push   $0x807fc4
+  800a94:	68 05 01 00 00       	push   $0x105
+  800a99:	68 fb 80 80 00       	push   $0x8080fb
+  800a9e:	e8 40 28 00 00       	call   8032e3 <_panic>
+	return 0;
+  800aa3:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+}
+  800aaa:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  800aad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ab0:	5b                   	pop    %ebx
+  800ab1:	5e                   	pop    %esi
+  800ab2:	5f                   	pop    %edi
+  800ab3:	5d                   	pop    %ebp
+  800ab4:	c3                   	ret
+		return -E_INVAL;
+  800ab5:	c7 45 dc fd ff ff ff 	movl   $0xfffffffd,-0x24(%ebp)
+  800abc:	eb ec                	jmp    800aaa <bc_read_ahead+0x17f>
+  800abe:	c7 45 dc fd ff ff ff 	movl   $0xfffffffd,-0x24(%ebp)
+  800ac5:	eb e3                	jmp    800aaa <bc_read_ahead+0x17f>
+
+00800ac7 <bc_write_blocks>:
+{
+  800ac7:	55                   	push   %ebp
+  800ac8:	89 e5                	mov    %esp,%ebp
+  800aca:	57                   	push   %edi
+  800acb:	56                   	push   %esi
+  800acc:	53                   	push   %ebx
+  800acd:	83 ec 1c             	sub    $0x1c,%esp
+	for (k = n / 2; k > 0; k /= 2)
+  800ad0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ad3:	d1 ef                	shr    %edi
+  800ad5:	eb 30                	jmp    800b07 <bc_write_blocks+0x40>
+				blocknos[j] = blocknos[j - k];
+  800ad7:	89 08                	mov    %ecx,(%eax)
+				blocknos[j - k] = t;
+  800ad9:	89 1c 30             	mov    %ebx,(%eax,%esi,1)
+			for (j = i; j >= k && blocknos[j - k] > blocknos[j]; j -= k) {
+  800adc:	01 f0                	add    %esi,%eax
+  800ade:	39 fa                	cmp    %edi,%edx
+  800ae0:	72 0b                	jb     800aed <bc_write_blocks+0x26>
+  800ae2:	29 fa                	sub    %edi,%edx
+  800ae4:	8b 0c 30             	mov    (%eax,%esi,1),%ecx
+  800ae7:	8b 18                	mov    (%eax),%ebx
+  800ae9:	39 cb                	cmp    %ecx,%ebx
+  800aeb:	72 ea                	jb     800ad7 <bc_write_blocks+0x10>
+		for (i = k; i < n; i++)
+  800aed:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800af0:	83 c3 01             	add    $0x1,%ebx
+  800af3:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+  800af6:	73 0d                	jae    800b05 <bc_write_blocks+0x3e>
+  800af8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afb:	8d 04 98             	lea    (%eax,%ebx,4),%eax
+			for (j = i; j >= k && blocknos[j - k] > blocknos[j]; j -= k) {
+  800afe:	89 da                	mov    %ebx,%edx
+  800b00:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b03:	eb d9                	jmp    800ade <bc_write_blocks+0x17>
+	for (k = n / 2; k > 0; k /= 2)
+  800b05:	d1 ef                	shr    %edi
+  800b07:	85 ff                	test   %edi,%edi
+  800b09:	0f 84 98 00 00 00    	je     800ba7 <bc_write_blocks+0xe0>
+  800b0f:	8d 34 bd 00 00 00 00 	lea    0x0(,%edi,4),%esi
+  800b16:	f7 de                	neg    %esi
+		for (i = k; i < n; i++)
+  800b18:	89 fb                	mov    %edi,%ebx
+  800b1a:	eb d7                	jmp    800af3 <bc_write_blocks+0x2c>
+			k++;
+  800b1c:	83 c3 01             	add    $0x1,%ebx
+		for (k = 1; j < n && k < BC_MAX_WRITEBACK; j++) {
+  800b1f:	83 c7 01             	add    $0x1,%edi
+  800b22:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+  800b25:	73 42                	jae    800b69 <bc_write_blocks+0xa2>
+  800b27:	83 fb 1f             	cmp    $0x1f,%ebx
+  800b2a:	77 3d                	ja     800b69 <bc_write_blocks+0xa2>
+			if (blocknos[j] == blocknos[i] + k - 1)
+  800b2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2f:	8b 14 b8             	mov    (%eax,%edi,4),%edx
+  800b32:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800b35:	89 d8                	mov    %ebx,%eax
+  800b37:	03 01                	add    (%ecx),%eax
+  800b39:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  800b3c:	39 ca                	cmp    %ecx,%edx
+  800b3e:	74 df                	je     800b1f <bc_write_blocks+0x58>
+			if (blocknos[j] != blocknos[i] + k
+  800b40:	39 c2                	cmp    %eax,%edx
+  800b42:	75 25                	jne    800b69 <bc_write_blocks+0xa2>
+			    || !va_page_in(addr + k*BLKSIZE) || !va_is_dirty(addr + k*BLKSIZE))
+  800b44:	89 de                	mov    %ebx,%esi
+  800b46:	c1 e6 0c             	shl    $0xc,%esi
+  800b49:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b4c:	01 c6                	add    %eax,%esi
+  800b4e:	89 f0                	mov    %esi,%eax
+  800b50:	e8 44 fa ff ff       	call   800599 <va_page_in>
+  800b55:	84 c0                	test   %al,%al
+  800b57:	74 10                	je     800b69 <bc_write_blocks+0xa2>
+  800b59:	83 ec 0c             	sub    $0xc,%esp
+  800b5c:	56                   	push   %esi
+  800b5d:	e8 5a fa ff ff       	call   8005bc <va_is_dirty>
+  800b62:	83 c4 10             	add    $0x10,%esp
+  800b65:	84 c0                	test   %al,%al
+  800b67:	75 b3                	jne    800b1c <bc_write_blocks+0x55>
+		if ((r = ide_write(blocknos[i]*BLKSECTS, addr, k*BLKSECTS)) < 0)
+  800b69:	83 ec 04             	sub    $0x4,%esp
+  800b6c:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  800b73:	50                   	push   %eax
+  800b74:	ff 75 e0             	push   -0x20(%ebp)
+  800b77:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800b7a:	8b 00                	mov    (%eax),%eax
+  800b7c:	c1 e0 03             	shl    $0x3,%eax
+  800b7f:	50                   	push   %eax
+  800b80:	e8 ac f7 ff ff       	call   800331 <ide_write>
+  800b85:	83 c4 10             	add    $0x10,%esp
+  800b88:	85 c0                	test   %eax,%eax
+  800b8a:	78 5e                	js     800bea <bc_write_blocks+0x123>
+		if ((r = sys_page_clean(0, addr, k)) < 0)
+  800b8c:	83 ec 04             	sub    $0x4,%esp
+  800b8f:	53                   	push   %ebx
+  800b90:	ff 75 e0             	push   -0x20(%ebp)
+  800b93:	6a 00                	push   $0x0
+  800b95:	e8 da 34 00 00       	call   804074 <sys_page_clean>
+  800b9a:	83 c4 10             	add    $0x10,%esp
+  800b9d:	85 c0                	test   %eax,%eax
+  800b9f:	78 5e                	js     800bff <bc_write_blocks+0x138>
+		bc_stats.ret_writebacks += k;
+  800ba1:	01 1d 34 a9 85 00    	add    %ebx,0x85a934
+	for (i = 0; i < n; i = j) {
+  800ba7:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+  800baa:	73 68                	jae    800c14 <bc_write_blocks+0x14d>
+		addr = (char*) (DISKMAP + blocknos[i] * BLKSIZE);
+  800bac:	8b 45 08             	mov    0x8(%ebp),%eax
+  800baf:	8d 04 b8             	lea    (%eax,%edi,4),%eax
+  800bb2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800bb5:	8b 00                	mov    (%eax),%eax
+  800bb7:	05 00 00 01 00       	add    $0x10000,%eax
+  800bbc:	c1 e0 0c             	shl    $0xc,%eax
+  800bbf:	89 c6                	mov    %eax,%esi
+  800bc1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		j = i + 1;
+  800bc4:	83 c7 01             	add    $0x1,%edi
+		if (!va_page_in(addr) || !va_is_dirty(addr))
+  800bc7:	e8 cd f9 ff ff       	call   800599 <va_page_in>
+  800bcc:	84 c0                	test   %al,%al
+  800bce:	74 d7                	je     800ba7 <bc_write_blocks+0xe0>
+  800bd0:	83 ec 0c             	sub    $0xc,%esp
+  800bd3:	56                   	push   %esi
+  800bd4:	e8 e3 f9 ff ff       	call   8005bc <va_is_dirty>
+  800bd9:	83 c4 10             	add    $0x10,%esp
+  800bdc:	84 c0                	test   %al,%al
+  800bde:	74 c7                	je     800ba7 <bc_write_blocks+0xe0>
+		for (k = 1; j < n && k < BC_MAX_WRITEBACK; j++) {
+  800be0:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800be5:	e9 38 ff ff ff       	jmp    800b22 <bc_write_blocks+0x5b>
+			panic("in bc_write_blocks, ide_write: %e", r);
+  800bea:	50                   	push   %eax
+  800beb:	68 ec 7f 80 00       	push   $0x807fec
+  800bf0:	68 2e 01 00 00       	push   $0x12e
+  800bf5:	68 fb 80 80 00       	push   $0x8080fb
+  800bfa:	e8 e4 26 00 00       	call   8032e3 <_panic>
+			panic("in bc_write_blocks, sys_page_clean: %e", r);
+  800bff:	50                   	push   %eax
+  800c00:	68 10 80 80 00       	push   $0x808010
+  800c05:	68 30 01 00 00       	push   $0x130
+  800c0a:	68 fb 80 80 00       	push   $0x8080fb
+  800c0f:	e8 cf 26 00 00       	call   8032e3 <_panic>
+}
+  800c14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c17:	5b                   	pop    %ebx
+  800c18:	5e                   	pop    %esi
+  800c19:	5f                   	pop    %edi
+  800c1a:	5d                   	pop    %ebp
+  800c1b:	c3                   	ret
+
+00800c1c <bc_sync>:
+{
+  800c1c:	55                   	push   %ebp
+  800c1d:	89 e5                	mov    %esp,%ebp
+  800c1f:	83 ec 0c             	sub    $0xc,%esp
+	memmove(blocknos, bc_blocks, bc_nblocks * sizeof(bc_blocks[0]));
+  800c22:	a1 38 a9 85 00       	mov    0x85a938,%eax
+  800c27:	c1 e0 02             	shl    $0x2,%eax
+  800c2a:	50                   	push   %eax
+  800c2b:	68 20 90 82 00       	push   $0x829020
+  800c30:	68 00 10 81 00       	push   $0x811000
+  800c35:	e8 f1 2e 00 00       	call   803b2b <memmove>
+	bc_write_blocks(blocknos, bc_nblocks);
+  800c3a:	83 c4 08             	add    $0x8,%esp
+  800c3d:	ff 35 38 a9 85 00    	push   0x85a938
+  800c43:	68 00 10 81 00       	push   $0x811000
+  800c48:	e8 7a fe ff ff       	call   800ac7 <bc_write_blocks>
+	flush_block(diskaddr(1));
+  800c4d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800c54:	e8 da f8 ff ff       	call   800533 <diskaddr>
+  800c59:	89 04 24             	mov    %eax,(%esp)
+  800c5c:	e8 73 f9 ff ff       	call   8005d4 <flush_block>
+}
+  800c61:	83 c4 10             	add    $0x10,%esp
+  800c64:	c9                   	leave
+  800c65:	c3                   	ret
+
+00800c66 <bc_alloc_block>:
+{
+  800c66:	55                   	push   %ebp
+  800c67:	89 e5                	mov    %esp,%ebp
+  800c69:	56                   	push   %esi
+  800c6a:	53                   	push   %ebx
+  800c6b:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *addr = (char*) (DISKMAP + blockno * BLKSIZE);
+  800c6e:	8d 9e 00 00 01 00    	lea    0x10000(%esi),%ebx
+  800c74:	c1 e3 0c             	shl    $0xc,%ebx
+	if (va_page_in(addr))
+  800c77:	89 d8                	mov    %ebx,%eax
+  800c79:	e8 1b f9 ff ff       	call   800599 <va_page_in>
+  800c7e:	84 c0                	test   %al,%al
+  800c80:	75 23                	jne    800ca5 <bc_alloc_block+0x3f>
+	bc_add(blockno);
+  800c82:	89 f0                	mov    %esi,%eax
+  800c84:	e8 ea fa ff ff       	call   800773 <bc_add>
+	if ((r = page_alloc(0, addr, PTE_P|PTE_U|PTE_W, 0)) < 0)
+  800c89:	6a 00                	push   $0x0
+  800c8b:	6a 07                	push   $0x7
+  800c8d:	53                   	push   %ebx
+  800c8e:	6a 00                	push   $0x0
+  800c90:	e8 df 5d 00 00       	call   806a74 <page_alloc>
+  800c95:	83 c4 10             	add    $0x10,%esp
+  800c98:	85 c0                	test   %eax,%eax
+  800c9a:	78 19                	js     800cb5 <bc_alloc_block+0x4f>
+}
+  800c9c:	89 d8                	mov    %ebx,%eax
+  800c9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ca1:	5b                   	pop    %ebx
+  800ca2:	5e                   	pop    %esi
+  800ca3:	5d                   	pop    %ebp
+  800ca4:	c3                   	ret
+		sys_page_unmap(0, addr);
+  800ca5:	83 ec 08             	sub    $0x8,%esp
+  800ca8:	53                   	push   %ebx
+  800ca9:	6a 00                	push   $0x0
+  800cab:	e8 6d 32 00 00       	call   803f1d <sys_page_unmap>
+  800cb0:	83 c4 10             	add    $0x10,%esp
+  800cb3:	eb cd                	jmp    800c82 <bc_alloc_block+0x1c>
+		panic("in bc_alloc_block, page_alloc: %e", r);
+  800cb5:	50                   	push   %eax
+  800cb6:	68 38 80 80 00       	push   $0x808038
+  800cbb:	68 4d 01 00 00       	push   $0x14d
+  800cc0:	68 fb 80 80 00       	push   $0x8080fb
+  800cc5:	e8 19 26 00 00       	call   8032e3 <_panic>
+
+00800cca <bc_insert_block>:
+{
+  800cca:	55                   	push   %ebp
+  800ccb:	89 e5                	mov    %esp,%ebp
+  800ccd:	57                   	push   %edi
+  800cce:	56                   	push   %esi
+  800ccf:	53                   	push   %ebx
+  800cd0:	83 ec 0c             	sub    $0xc,%esp
+  800cd3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800cd6:	8b 75 0c             	mov    0xc(%ebp),%esi
+	char *addr = (char*) (DISKMAP + blockno * BLKSIZE);
+  800cd9:	8d 9f 00 00 01 00    	lea    0x10000(%edi),%ebx
+  800cdf:	c1 e3 0c             	shl    $0xc,%ebx
+	(void) *(volatile char*) pg;
+  800ce2:	0f b6 06             	movzbl (%esi),%eax
+	if (va_page_in(addr))
+  800ce5:	89 d8                	mov    %ebx,%eax
+  800ce7:	e8 ad f8 ff ff       	call   800599 <va_page_in>
+  800cec:	84 c0                	test   %al,%al
+  800cee:	75 3b                	jne    800d2b <bc_insert_block+0x61>
+	bc_add(blockno);
+  800cf0:	89 f8                	mov    %edi,%eax
+  800cf2:	e8 7c fa ff ff       	call   800773 <bc_add>
+	if ((r = sys_page_map(0, pg, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  800cf7:	83 ec 0c             	sub    $0xc,%esp
+  800cfa:	6a 07                	push   $0x7
+  800cfc:	53                   	push   %ebx
+  800cfd:	6a 00                	push   $0x0
+  800cff:	56                   	push   %esi
+  800d00:	6a 00                	push   $0x0
+  800d02:	e8 d4 31 00 00       	call   803edb <sys_page_map>
+  800d07:	83 c4 20             	add    $0x20,%esp
+  800d0a:	85 c0                	test   %eax,%eax
+  800d0c:	78 2d                	js     800d3b <bc_insert_block+0x71>
+	if ((r = sys_page_unmap(0, pg)) < 0)
+  800d0e:	83 ec 08             	sub    $0x8,%esp
+  800d11:	56                   	push   %esi
+  800d12:	6a 00                	push   $0x0
+  800d14:	e8 04 32 00 00       	call   803f1d <sys_page_unmap>
+  800d19:	83 c4 10             	add    $0x10,%esp
+  800d1c:	85 c0                	test   %eax,%eax
+  800d1e:	78 30                	js     800d50 <bc_insert_block+0x86>
+	(void) *(volatile char*) addr;
+  800d20:	0f b6 03             	movzbl (%ebx),%eax
+}
+  800d23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d26:	5b                   	pop    %ebx
+  800d27:	5e                   	pop    %esi
+  800d28:	5f                   	pop    %edi
+  800d29:	5d                   	pop    %ebp
+  800d2a:	c3                   	ret
+		sys_page_unmap(0, addr);
+  800d2b:	83 ec 08             	sub    $0x8,%esp
+  800d2e:	53                   	push   %ebx
+  800d2f:	6a 00                	push   $0x0
+  800d31:	e8 e7 31 00 00       	call   803f1d <sys_page_unmap>
+  800d36:	83 c4 10             	add    $0x10,%esp
+  800d39:	eb b5                	jmp    800cf0 <bc_insert_block+0x26>
+		panic("in bc_insert_block, sys_page_map: %e", r);
+  800d3b:	50                   	push   %eax
+  800d3c:	68 5c 80 80 00       	push   $0x80805c
+  800d41:	68 61 01 00 00       	push   $0x161
+  800d46:	68 fb 80 80 00       	push   $0x8080fb
+  800d4b:	e8 93 25 00 00       	call   8032e3 <_panic>
+		panic("in bc_insert_block, sys_page_unmap: %e", r);
+  800d50:	50                   	push   %eax
+  800d51:	68 84 80 80 00       	push   $0x808084
+  800d56:	68 63 01 00 00       	push   $0x163
+  800d5b:	68 fb 80 80 00       	push   $0x8080fb
+  800d60:	e8 7e 25 00 00       	call   8032e3 <_panic>
+
+00800d65 <bc_drop_block>:
+{
+  800d65:	55                   	push   %ebp
+  800d66:	89 e5                	mov    %esp,%ebp
+  800d68:	56                   	push   %esi
+  800d69:	53                   	push   %ebx
+  800d6a:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *addr = (char*) (DISKMAP + blockno * BLKSIZE);
+  800d6d:	8d 9e 00 00 01 00    	lea    0x10000(%esi),%ebx
+  800d73:	c1 e3 0c             	shl    $0xc,%ebx
+	if (va_page_in(addr))
+  800d76:	89 d8                	mov    %ebx,%eax
+  800d78:	e8 1c f8 ff ff       	call   800599 <va_page_in>
+  800d7d:	84 c0                	test   %al,%al
+  800d7f:	75 12                	jne    800d93 <bc_drop_block+0x2e>
+	if ((slot = bc_lookup(blockno)) >= 0)
+  800d81:	89 f0                	mov    %esi,%eax
+  800d83:	e8 9f f6 ff ff       	call   800427 <bc_lookup>
+  800d88:	85 c0                	test   %eax,%eax
+  800d8a:	79 17                	jns    800da3 <bc_drop_block+0x3e>
+}
+  800d8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d8f:	5b                   	pop    %ebx
+  800d90:	5e                   	pop    %esi
+  800d91:	5d                   	pop    %ebp
+  800d92:	c3                   	ret
+		sys_page_unmap(0, addr);
+  800d93:	83 ec 08             	sub    $0x8,%esp
+  800d96:	53                   	push   %ebx
+  800d97:	6a 00                	push   $0x0
+  800d99:	e8 7f 31 00 00       	call   803f1d <sys_page_unmap>
+  800d9e:	83 c4 10             	add    $0x10,%esp
+  800da1:	eb de                	jmp    800d81 <bc_drop_block+0x1c>
+		bc_remove(slot);
+  800da3:	e8 1d f7 ff ff       	call   8004c5 <bc_remove>
+}
+  800da8:	eb e2                	jmp    800d8c <bc_drop_block+0x27>
+
+00800daa <bc_make_private>:
+{
+  800daa:	55                   	push   %ebp
+  800dab:	89 e5                	mov    %esp,%ebp
+  800dad:	53                   	push   %ebx
+  800dae:	83 ec 10             	sub    $0x10,%esp
+	addr = ROUNDDOWN(addr, PGSIZE);
+  800db1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800db4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	(void) *(volatile char*) addr;
+  800dba:	0f b6 03             	movzbl (%ebx),%eax
+	if (pageref(addr) <= 1)
+  800dbd:	53                   	push   %ebx
+  800dbe:	e8 89 43 00 00       	call   80514c <pageref>
+  800dc3:	83 c4 10             	add    $0x10,%esp
+  800dc6:	83 f8 01             	cmp    $0x1,%eax
+  800dc9:	0f 8e 8e 00 00 00    	jle    800e5d <bc_make_private+0xb3>
+	if ((r = page_alloc(0, PFTEMP, PTE_P|PTE_U|PTE_W, 0)) < 0)
+  800dcf:	6a 00                	push   $0x0
+  800dd1:	6a 07                	push   $0x7
+  800dd3:	68 00 f0 7f 00       	push   $0x7ff000
+  800dd8:	6a 00                	push   $0x0
+  800dda:	e8 95 5c 00 00       	call   806a74 <page_alloc>
+  800ddf:	83 c4 10             	add    $0x10,%esp
+  800de2:	85 c0                	test   %eax,%eax
+  800de4:	78 7c                	js     800e62 <bc_make_private+0xb8>
+	memmove(PFTEMP, addr, PGSIZE);
+  800de6:	83 ec 04             	sub    $0x4,%esp
+  800de9:	68 00 10 00 00       	push   $0x1000
+  800dee:	53                   	push   %ebx
+  800def:	68 00 f0 7f 00       	push   $0x7ff000
+  800df4:	e8 32 2d 00 00       	call   803b2b <memmove>
+	if ((r = sys_page_map(0, PFTEMP, 0, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  800df9:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  800e00:	53                   	push   %ebx
+  800e01:	6a 00                	push   $0x0
+  800e03:	68 00 f0 7f 00       	push   $0x7ff000
+  800e08:	6a 00                	push   $0x0
+  800e0a:	e8 cc 30 00 00       	call   803edb <sys_page_map>
+  800e0f:	83 c4 20             	add    $0x20,%esp
+  800e12:	85 c0                	test   %eax,%eax
+  800e14:	78 1d                	js     800e33 <bc_make_private+0x89>
+	if ((r = sys_page_unmap(0, PFTEMP)) < 0)
+  800e16:	83 ec 08             	sub    $0x8,%esp
+  800e19:	68 00 f0 7f 00       	push   $0x7ff000
+  800e1e:	6a 00                	push   $0x0
+  800e20:	e8 f8 30 00 00       	call   803f1d <sys_page_unmap>
+  800e25:	83 c4 10             	add    $0x10,%esp
+  800e28:	85 c0                	test   %eax,%eax
+  800e2a:	78 1c                	js     800e48 <bc_make_private+0x9e>
+	return 0;
+  800e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e31:	eb 2f                	jmp    800e62 <bc_make_private+0xb8>
+		panic("in bc_make_private, sys_page_map: %e", r);
+  800e33:	50                   	push   %eax
+  800e34:	68 ac 80 80 00       	push   $0x8080ac
+  800e39:	68 89 01 00 00       	push   $0x189
+  800e3e:	68 fb 80 80 00       	push   $0x8080fb
+  800e43:	e8 9b 24 00 00       	call   8032e3 <_panic>
+		panic("in bc_make_private, sys_page_unmap: %e", r);
+  800e48:	50                   	push   %eax
+  800e49:	68 d4 80 80 00       	push   $0x8080d4
+  800e4e:	68 8b 01 00 00       	push   $0x18b
+  800e53:	68 fb 80 80 00       	push   $0x8080fb
+  800e58:	e8 86 24 00 00       	call   8032e3 <_panic>
+		return 0;
+  800e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e65:	c9                   	leave
+  800e66:	c3                   	ret
+
+00800e67 <bc_init>:
+
+
+void
+bc_init(void)
+{
+  800e67:	55                   	push   %ebp
+  800e68:	89 e5                	mov    %esp,%ebp
+  800e6a:	81 ec 24 01 00 00    	sub    $0x124,%esp
+	struct Super super;
+	add_pgfault_handler(bc_pgfault);
+  800e70:	68 c1 07 80 00       	push   $0x8007c1
+  800e75:	e8 4b 36 00 00       	call   8044c5 <add_pgfault_handler>
+
+	// Clean blocks can be dropped and read back in from the disk.
+	// Not the super block, though: bc_pgfault reads it.
+	page_add_backed((void*) (DISKMAP + 2*BLKSIZE), DISKSIZE - 2*BLKSIZE);
+  800e7a:	83 c4 08             	add    $0x8,%esp
+  800e7d:	68 00 e0 ff bf       	push   $0xbfffe000
+  800e82:	68 00 20 00 10       	push   $0x10002000
+  800e87:	e8 d3 4c 00 00       	call   805b5f <page_add_backed>
+
+	// cache the super block by reading it once
+	memmove(&super, diskaddr(1), sizeof super);
+  800e8c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800e93:	e8 9b f6 ff ff       	call   800533 <diskaddr>
+  800e98:	83 c4 0c             	add    $0xc,%esp
+  800e9b:	68 08 01 00 00       	push   $0x108
+  800ea0:	50                   	push   %eax
+  800ea1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800ea7:	50                   	push   %eax
+  800ea8:	e8 7e 2c 00 00       	call   803b2b <memmove>
+}
+  800ead:	83 c4 10             	add    $0x10,%esp
+  800eb0:	c9                   	leave
+  800eb1:	c3                   	ret
+
+00800eb2 <pend_lookup>:
+}
+
+// Return the pendtab slot of the filebno'th block of file 'f', or -1.
+static int32_t
+pend_lookup(struct File *f, uint32_t filebno)
+{
+  800eb2:	55                   	push   %ebp
+  800eb3:	89 e5                	mov    %esp,%ebp
+  800eb5:	53                   	push   %ebx
+  800eb6:	89 c1                	mov    %eax,%ecx
+  800eb8:	89 d3                	mov    %edx,%ebx
+	return ((uint32_t) f / sizeof(struct File) + filebno * 31) & (NPENDING - 1);
+  800eba:	c1 e8 08             	shr    $0x8,%eax
+  800ebd:	c1 e2 05             	shl    $0x5,%edx
+  800ec0:	29 da                	sub    %ebx,%edx
+  800ec2:	01 d0                	add    %edx,%eax
+  800ec4:	0f b6 c0             	movzbl %al,%eax
+	int32_t i;
+
+	for (i = pend_buckets[pend_hash(f, filebno)]; i >= 0; i = pendtab[i].p_next)
+  800ec7:	8b 04 85 00 29 85 00 	mov    0x852900(,%eax,4),%eax
+  800ece:	eb 0a                	jmp    800eda <pend_lookup+0x28>
+  800ed0:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  800ed3:	8b 04 85 08 2d 85 00 	mov    0x852d08(,%eax,4),%eax
+  800eda:	85 c0                	test   %eax,%eax
+  800edc:	78 17                	js     800ef5 <pend_lookup+0x43>
+		if (pendtab[i].p_file == f && pendtab[i].p_filebno == filebno)
+  800ede:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  800ee1:	39 0c 95 00 2d 85 00 	cmp    %ecx,0x852d00(,%edx,4)
+  800ee8:	75 e6                	jne    800ed0 <pend_lookup+0x1e>
+  800eea:	39 1c 95 04 2d 85 00 	cmp    %ebx,0x852d04(,%edx,4)
+  800ef1:	75 dd                	jne    800ed0 <pend_lookup+0x1e>
+  800ef3:	eb 05                	jmp    800efa <pend_lookup+0x48>
+			return i;
+	return -1;
+  800ef5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  800efa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800efd:	c9                   	leave
+  800efe:	c3                   	ret
+
+00800eff <dirhash_dir_slot>:
+// Find the dirhash_dirs slot for dir: the one holding it, or the empty
+// one it would go in.
+static struct File **
+dirhash_dir_slot(struct File *dir)
+{
+	uint32_t i = ((uint32_t) dir / sizeof(struct File)) & (DIRHASH_NDIRS - 1);
+  800eff:	0f b6 d4             	movzbl %ah,%edx
+
+	while (dirhash_dirs[i] && dirhash_dirs[i] != dir)
+  800f02:	8b 0c 95 c0 14 83 00 	mov    0x8314c0(,%edx,4),%ecx
+  800f09:	39 c1                	cmp    %eax,%ecx
+  800f0b:	74 0c                	je     800f19 <dirhash_dir_slot+0x1a>
+  800f0d:	85 c9                	test   %ecx,%ecx
+  800f0f:	74 08                	je     800f19 <dirhash_dir_slot+0x1a>
+		i = (i + 1) & (DIRHASH_NDIRS - 1);
+  800f11:	83 c2 01             	add    $0x1,%edx
+  800f14:	0f b6 d2             	movzbl %dl,%edx
+  800f17:	eb e9                	jmp    800f02 <dirhash_dir_slot+0x3>
+	return &dirhash_dirs[i];
+  800f19:	8d 04 95 c0 14 83 00 	lea    0x8314c0(,%edx,4),%eax
+}
+  800f20:	c3                   	ret
+
+00800f21 <dirhash_evict>:
+{
+	struct File **slot, *moved;
+	int32_t *ip;
+	uint32_t b, i;
+
+	if (!dirhash_ready || !*(slot = dirhash_dir_slot(dir)))
+  800f21:	80 3d a4 14 83 00 00 	cmpb   $0x0,0x8314a4
+  800f28:	75 01                	jne    800f2b <dirhash_evict+0xa>
+  800f2a:	c3                   	ret
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	57                   	push   %edi
+  800f2f:	56                   	push   %esi
+  800f30:	53                   	push   %ebx
+  800f31:	83 ec 0c             	sub    $0xc,%esp
+  800f34:	89 c3                	mov    %eax,%ebx
+	if (!dirhash_ready || !*(slot = dirhash_dir_slot(dir)))
+  800f36:	e8 c4 ff ff ff       	call   800eff <dirhash_dir_slot>
+  800f3b:	83 38 00             	cmpl   $0x0,(%eax)
+  800f3e:	0f 84 83 00 00 00    	je     800fc7 <dirhash_evict+0xa6>
+  800f44:	be c0 18 83 00       	mov    $0x8318c0,%esi
+  800f49:	89 df                	mov    %ebx,%edi
+  800f4b:	eb 29                	jmp    800f76 <dirhash_evict+0x55>
+	for (b = 0; b < DIRHASH_NBUCKETS; b++)
+		for (ip = &dirhash_buckets[b]; *ip >= 0; )
+			if (dirhash_entries[*ip].dh_dir == dir)
+				*ip = dirhash_entries[*ip].dh_next;
+			else
+				ip = &dirhash_entries[*ip].dh_next;
+  800f4d:	c1 e1 04             	shl    $0x4,%ecx
+  800f50:	8d 91 ec 28 83 00    	lea    0x8328ec(%ecx),%edx
+		for (ip = &dirhash_buckets[b]; *ip >= 0; )
+  800f56:	8b 0a                	mov    (%edx),%ecx
+  800f58:	85 c9                	test   %ecx,%ecx
+  800f5a:	78 17                	js     800f73 <dirhash_evict+0x52>
+			if (dirhash_entries[*ip].dh_dir == dir)
+  800f5c:	89 cb                	mov    %ecx,%ebx
+  800f5e:	c1 e3 04             	shl    $0x4,%ebx
+  800f61:	39 bb e0 28 83 00    	cmp    %edi,0x8328e0(%ebx)
+  800f67:	75 e4                	jne    800f4d <dirhash_evict+0x2c>
+				*ip = dirhash_entries[*ip].dh_next;
+  800f69:	8b 8b ec 28 83 00    	mov    0x8328ec(%ebx),%ecx
+  800f6f:	89 0a                	mov    %ecx,(%edx)
+  800f71:	eb e3                	jmp    800f56 <dirhash_evict+0x35>
+	for (b = 0; b < DIRHASH_NBUCKETS; b++)
+  800f73:	83 c6 04             	add    $0x4,%esi
+  800f76:	81 fe c0 28 83 00    	cmp    $0x8328c0,%esi
+  800f7c:	74 04                	je     800f82 <dirhash_evict+0x61>
+		for (ip = &dirhash_buckets[b]; *ip >= 0; )
+  800f7e:	89 f2                	mov    %esi,%edx
+  800f80:	eb d4                	jmp    800f56 <dirhash_evict+0x35>
+
+	// Empty dir's slot, then put the directories after it in the same
+	// run back, since they may have been pushed past it
+	*slot = NULL;
+  800f82:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	dirhash_ndirs--;
+  800f88:	83 2d a8 14 83 00 01 	subl   $0x1,0x8314a8
+	for (i = (slot - dirhash_dirs + 1) & (DIRHASH_NDIRS - 1);
+  800f8f:	89 c3                	mov    %eax,%ebx
+  800f91:	81 eb c0 14 83 00    	sub    $0x8314c0,%ebx
+  800f97:	c1 fb 02             	sar    $0x2,%ebx
+  800f9a:	83 c3 01             	add    $0x1,%ebx
+  800f9d:	0f b6 db             	movzbl %bl,%ebx
+	     (moved = dirhash_dirs[i]) != NULL; i = (i + 1) & (DIRHASH_NDIRS - 1)) {
+  800fa0:	8b 34 9d c0 14 83 00 	mov    0x8314c0(,%ebx,4),%esi
+  800fa7:	85 f6                	test   %esi,%esi
+  800fa9:	74 1c                	je     800fc7 <dirhash_evict+0xa6>
+		dirhash_dirs[i] = NULL;
+  800fab:	c7 04 9d c0 14 83 00 	movl   $0x0,0x8314c0(,%ebx,4)
+  800fb2:	00 00 00 00 
+		*dirhash_dir_slot(moved) = moved;
+  800fb6:	89 f0                	mov    %esi,%eax
+  800fb8:	e8 42 ff ff ff       	call   800eff <dirhash_dir_slot>
+  800fbd:	89 30                	mov    %esi,(%eax)
+	     (moved = dirhash_dirs[i]) != NULL; i = (i + 1) & (DIRHASH_NDIRS - 1)) {
+  800fbf:	83 c3 01             	add    $0x1,%ebx
+  800fc2:	0f b6 db             	movzbl %bl,%ebx
+  800fc5:	eb d9                	jmp    800fa0 <dirhash_evict+0x7f>
+	}
+}
+  800fc7:	83 c4 0c             	add    $0xc,%esp
+  800fca:	5b                   	pop    %ebx
+  800fcb:	5e                   	pop    %esi
+  800fcc:	5f                   	pop    %edi
+  800fcd:	5d                   	pop    %ebp
+  800fce:	c3                   	ret
+
+00800fcf <pend_unlink>:
+{
+  800fcf:	55                   	push   %ebp
+  800fd0:	89 e5                	mov    %esp,%ebp
+  800fd2:	53                   	push   %ebx
+  800fd3:	89 c1                	mov    %eax,%ecx
+	pi = &pend_buckets[pend_hash(pendtab[i].p_file, pendtab[i].p_filebno)];
+  800fd5:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  800fd8:	c1 e2 02             	shl    $0x2,%edx
+	return ((uint32_t) f / sizeof(struct File) + filebno * 31) & (NPENDING - 1);
+  800fdb:	8b 82 00 2d 85 00    	mov    0x852d00(%edx),%eax
+  800fe1:	c1 e8 08             	shr    $0x8,%eax
+  800fe4:	8b 9a 04 2d 85 00    	mov    0x852d04(%edx),%ebx
+  800fea:	89 da                	mov    %ebx,%edx
+  800fec:	c1 e2 05             	shl    $0x5,%edx
+  800fef:	29 da                	sub    %ebx,%edx
+  800ff1:	01 d0                	add    %edx,%eax
+  800ff3:	0f b6 c0             	movzbl %al,%eax
+	pi = &pend_buckets[pend_hash(pendtab[i].p_file, pendtab[i].p_filebno)];
+  800ff6:	8d 1c 85 00 29 85 00 	lea    0x852900(,%eax,4),%ebx
+  800ffd:	8b 04 85 00 29 85 00 	mov    0x852900(,%eax,4),%eax
+	while (*pi != i)
+  801004:	eb 16                	jmp    80101c <pend_unlink+0x4d>
+		pi = &pendtab[*pi].p_next;
+  801006:	8d 14 00             	lea    (%eax,%eax,1),%edx
+  801009:	8d 1c 02             	lea    (%edx,%eax,1),%ebx
+  80100c:	8d 1c 9d 08 2d 85 00 	lea    0x852d08(,%ebx,4),%ebx
+  801013:	01 c2                	add    %eax,%edx
+  801015:	8b 04 95 08 2d 85 00 	mov    0x852d08(,%edx,4),%eax
+	while (*pi != i)
+  80101c:	39 c8                	cmp    %ecx,%eax
+  80101e:	75 e6                	jne    801006 <pend_unlink+0x37>
+	*pi = pendtab[i].p_next;
+  801020:	8d 04 09             	lea    (%ecx,%ecx,1),%eax
+  801023:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801026:	8b 14 95 08 2d 85 00 	mov    0x852d08(,%edx,4),%edx
+  80102d:	89 13                	mov    %edx,(%ebx)
+	pendtab[i].p_file = 0;
+  80102f:	01 c8                	add    %ecx,%eax
+  801031:	c7 04 85 00 2d 85 00 	movl   $0x0,0x852d00(,%eax,4)
+  801038:	00 00 00 00 
+	npending--;
+  80103c:	83 2d e0 28 85 00 01 	subl   $0x1,0x8528e0
+}
+  801043:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801046:	c9                   	leave
+  801047:	c3                   	ret
+
+00801048 <check_super>:
+{
+  801048:	55                   	push   %ebp
+  801049:	89 e5                	mov    %esp,%ebp
+  80104b:	83 ec 08             	sub    $0x8,%esp
+	if (super->s_magic != FS_MAGIC)
+  80104e:	a1 14 a9 85 00       	mov    0x85a914,%eax
+  801053:	81 38 ae 30 05 4a    	cmpl   $0x4a0530ae,(%eax)
+  801059:	75 1b                	jne    801076 <check_super+0x2e>
+	if (super->s_nblocks > DISKSIZE/BLKSIZE)
+  80105b:	81 78 04 00 00 0c 00 	cmpl   $0xc0000,0x4(%eax)
+  801062:	77 26                	ja     80108a <check_super+0x42>
+	cprintf("superblock is good\n");
+  801064:	83 ec 0c             	sub    $0xc,%esp
+  801067:	68 d2 81 80 00       	push   $0x8081d2
+  80106c:	e8 4d 23 00 00       	call   8033be <cprintf>
+}
+  801071:	83 c4 10             	add    $0x10,%esp
+  801074:	c9                   	leave
+  801075:	c3                   	ret
+		panic("bad file system magic number");
+  801076:	83 ec 04             	sub    $0x4,%esp
+  801079:	68 94 81 80 00       	push   $0x808194
+  80107e:	6a 10                	push   $0x10
+  801080:	68 b1 81 80 00       	push   $0x8081b1
+  801085:	e8 59 22 00 00       	call   8032e3 <_panic>
+		panic("file system is too large");
+  80108a:	83 ec 04             	sub    $0x4,%esp
+  80108d:	68 b9 81 80 00       	push   $0x8081b9
+  801092:	6a 13                	push   $0x13
+  801094:	68 b1 81 80 00       	push   $0x8081b1
+  801099:	e8 45 22 00 00       	call   8032e3 <_panic>
+
+0080109e <block_is_free>:
+{
+  80109e:	55                   	push   %ebp
+  80109f:	89 e5                	mov    %esp,%ebp
+  8010a1:	53                   	push   %ebx
+  8010a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	if (super == 0 || blockno >= super->s_nblocks)
+  8010a5:	a1 14 a9 85 00       	mov    0x85a914,%eax
+  8010aa:	85 c0                	test   %eax,%eax
+  8010ac:	74 29                	je     8010d7 <block_is_free+0x39>
+		return 0;
+  8010ae:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (super == 0 || blockno >= super->s_nblocks)
+  8010b3:	3b 48 04             	cmp    0x4(%eax),%ecx
+  8010b6:	73 18                	jae    8010d0 <block_is_free+0x32>
+	if (bitmap[blockno / 32] & (1 << (blockno % 32)))
+  8010b8:	89 cb                	mov    %ecx,%ebx
+  8010ba:	c1 eb 05             	shr    $0x5,%ebx
+  8010bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010c2:	d3 e0                	shl    %cl,%eax
+  8010c4:	8b 15 10 a9 85 00    	mov    0x85a910,%edx
+  8010ca:	23 04 9a             	and    (%edx,%ebx,4),%eax
+  8010cd:	0f 95 c2             	setne  %dl
+}
+  8010d0:	89 d0                	mov    %edx,%eax
+  8010d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010d5:	c9                   	leave
+  8010d6:	c3                   	ret
+		return 0;
+  8010d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010dc:	eb f2                	jmp    8010d0 <block_is_free+0x32>
+
+008010de <alloc_blocks>:
+{
+  8010de:	55                   	push   %ebp
+  8010df:	89 e5                	mov    %esp,%ebp
+  8010e1:	57                   	push   %edi
+  8010e2:	56                   	push   %esi
+  8010e3:	53                   	push   %ebx
+  8010e4:	83 ec 2c             	sub    $0x2c,%esp
+  8010e7:	89 c7                	mov    %eax,%edi
+  8010e9:	89 d6                	mov    %edx,%esi
+  8010eb:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+	uint32_t i, b, len, first = 0, firstlen = 0, nblocks = super->s_nblocks;
+  8010ee:	a1 14 a9 85 00       	mov    0x85a914,%eax
+  8010f3:	8b 50 04             	mov    0x4(%eax),%edx
+  8010f6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		goal = 0;
+  8010f9:	39 d7                	cmp    %edx,%edi
+  8010fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801100:	0f 42 c7             	cmovb  %edi,%eax
+  801103:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	uint32_t i, b, len, first = 0, firstlen = 0, nblocks = super->s_nblocks;
+  801106:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  80110d:	ba 00 00 00 00       	mov    $0x0,%edx
+	for (i = 0; i < nblocks; i += len ? len : 1) {
+  801112:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801117:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  80111a:	eb 7b                	jmp    801197 <alloc_blocks+0xb9>
+  80111c:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  80111f:	eb 03                	jmp    801124 <alloc_blocks+0x46>
+  801121:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+	if (firstlen == 0)
+  801124:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801127:	85 c0                	test   %eax,%eax
+  801129:	74 4b                	je     801176 <alloc_blocks+0x98>
+  80112b:	8d 3c 02             	lea    (%edx,%eax,1),%edi
+  80112e:	89 d1                	mov    %edx,%ecx
+		bitmap[(first + i)/32] &= ~(1<<((first + i)%32));
+  801130:	be 01 00 00 00       	mov    $0x1,%esi
+  801135:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	for (i = 0; i < firstlen; i++)
+  801138:	39 f9                	cmp    %edi,%ecx
+  80113a:	74 1f                	je     80115b <alloc_blocks+0x7d>
+		bitmap[(first + i)/32] &= ~(1<<((first + i)%32));
+  80113c:	89 ca                	mov    %ecx,%edx
+  80113e:	c1 ea 05             	shr    $0x5,%edx
+  801141:	a1 10 a9 85 00       	mov    0x85a910,%eax
+  801146:	89 f3                	mov    %esi,%ebx
+  801148:	d3 e3                	shl    %cl,%ebx
+  80114a:	f7 d3                	not    %ebx
+  80114c:	21 1c 90             	and    %ebx,(%eax,%edx,4)
+	for (i = 0; i < firstlen; i++)
+  80114f:	83 c1 01             	add    $0x1,%ecx
+  801152:	eb e4                	jmp    801138 <alloc_blocks+0x5a>
+		if (len > firstlen) {
+  801154:	89 75 dc             	mov    %esi,-0x24(%ebp)
+			first = b;
+  801157:	89 fa                	mov    %edi,%edx
+  801159:	eb c9                	jmp    801124 <alloc_blocks+0x46>
+	alloc_hint = first + firstlen;
+  80115b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80115e:	89 3d 00 39 85 00    	mov    %edi,0x853900
+	*pgot = firstlen;
+  801164:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801167:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80116a:	89 08                	mov    %ecx,(%eax)
+	return first;
+  80116c:	89 d0                	mov    %edx,%eax
+}
+  80116e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801171:	5b                   	pop    %ebx
+  801172:	5e                   	pop    %esi
+  801173:	5f                   	pop    %edi
+  801174:	5d                   	pop    %ebp
+  801175:	c3                   	ret
+		return -E_NO_DISK;
+  801176:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80117b:	eb f1                	jmp    80116e <alloc_blocks+0x90>
+		if (len > firstlen) {
+  80117d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801180:	39 75 dc             	cmp    %esi,-0x24(%ebp)
+  801183:	72 cf                	jb     801154 <alloc_blocks+0x76>
+  801185:	89 f3                	mov    %esi,%ebx
+		if (len == n)
+  801187:	39 de                	cmp    %ebx,%esi
+  801189:	74 91                	je     80111c <alloc_blocks+0x3e>
+	for (i = 0; i < nblocks; i += len ? len : 1) {
+  80118b:	85 db                	test   %ebx,%ebx
+  80118d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801192:	0f 45 c3             	cmovne %ebx,%eax
+  801195:	01 c1                	add    %eax,%ecx
+  801197:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80119a:	39 c1                	cmp    %eax,%ecx
+  80119c:	73 83                	jae    801121 <alloc_blocks+0x43>
+		b = (goal + i) % nblocks;
+  80119e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8011a1:	01 c8                	add    %ecx,%eax
+  8011a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a8:	f7 75 e4             	divl   -0x1c(%ebp)
+  8011ab:	89 d7                	mov    %edx,%edi
+	for (i = 0; i < n && block_is_free(blockno + i); i++)
+  8011ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8011b5:	39 de                	cmp    %ebx,%esi
+  8011b7:	74 c4                	je     80117d <alloc_blocks+0x9f>
+  8011b9:	83 ec 0c             	sub    $0xc,%esp
+  8011bc:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  8011bf:	50                   	push   %eax
+  8011c0:	e8 d9 fe ff ff       	call   80109e <block_is_free>
+  8011c5:	83 c4 10             	add    $0x10,%esp
+  8011c8:	84 c0                	test   %al,%al
+  8011ca:	74 05                	je     8011d1 <alloc_blocks+0xf3>
+  8011cc:	83 c3 01             	add    $0x1,%ebx
+  8011cf:	eb e4                	jmp    8011b5 <alloc_blocks+0xd7>
+  8011d1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+		if (len > firstlen) {
+  8011d4:	39 5d dc             	cmp    %ebx,-0x24(%ebp)
+  8011d7:	73 ae                	jae    801187 <alloc_blocks+0xa9>
+  8011d9:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+			first = b;
+  8011dc:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  8011df:	eb aa                	jmp    80118b <alloc_blocks+0xad>
+
+008011e1 <free_block>:
+{
+  8011e1:	55                   	push   %ebp
+  8011e2:	89 e5                	mov    %esp,%ebp
+  8011e4:	53                   	push   %ebx
+  8011e5:	83 ec 04             	sub    $0x4,%esp
+  8011e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	if (blockno == 0)
+  8011eb:	85 c9                	test   %ecx,%ecx
+  8011ed:	74 26                	je     801215 <free_block+0x34>
+	bitmap[blockno/32] |= 1<<(blockno%32);
+  8011ef:	89 cb                	mov    %ecx,%ebx
+  8011f1:	c1 eb 05             	shr    $0x5,%ebx
+  8011f4:	8b 15 10 a9 85 00    	mov    0x85a910,%edx
+  8011fa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011ff:	d3 e0                	shl    %cl,%eax
+  801201:	09 04 9a             	or     %eax,(%edx,%ebx,4)
+	bc_drop_block(blockno);
+  801204:	83 ec 0c             	sub    $0xc,%esp
+  801207:	51                   	push   %ecx
+  801208:	e8 58 fb ff ff       	call   800d65 <bc_drop_block>
+}
+  80120d:	83 c4 10             	add    $0x10,%esp
+  801210:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801213:	c9                   	leave
+  801214:	c3                   	ret
+		panic("attempt to free zero block");
+  801215:	83 ec 04             	sub    $0x4,%esp
+  801218:	68 e6 81 80 00       	push   $0x8081e6
+  80121d:	6a 31                	push   $0x31
+  80121f:	68 b1 81 80 00       	push   $0x8081b1
+  801224:	e8 ba 20 00 00       	call   8032e3 <_panic>
+
+00801229 <alloc_block>:
+{
+  801229:	55                   	push   %ebp
+  80122a:	89 e5                	mov    %esp,%ebp
+  80122c:	53                   	push   %ebx
+  80122d:	83 ec 14             	sub    $0x14,%esp
+	if ((r = alloc_blocks(alloc_hint, 1, &got)) < 0)
+  801230:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801233:	ba 01 00 00 00       	mov    $0x1,%edx
+  801238:	a1 00 39 85 00       	mov    0x853900,%eax
+  80123d:	e8 9c fe ff ff       	call   8010de <alloc_blocks>
+  801242:	89 c3                	mov    %eax,%ebx
+  801244:	85 c0                	test   %eax,%eax
+  801246:	78 0c                	js     801254 <alloc_block+0x2b>
+	bc_alloc_block(r);
+  801248:	83 ec 0c             	sub    $0xc,%esp
+  80124b:	50                   	push   %eax
+  80124c:	e8 15 fa ff ff       	call   800c66 <bc_alloc_block>
+	return r;
+  801251:	83 c4 10             	add    $0x10,%esp
+}
+  801254:	89 d8                	mov    %ebx,%eax
+  801256:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801259:	c9                   	leave
+  80125a:	c3                   	ret
+
+0080125b <file_extent>:
+{
+  80125b:	55                   	push   %ebp
+  80125c:	89 e5                	mov    %esp,%ebp
+  80125e:	56                   	push   %esi
+  80125f:	53                   	push   %ebx
+  801260:	89 c6                	mov    %eax,%esi
+  801262:	89 d3                	mov    %edx,%ebx
+		return &f->f_extents[i];
+  801264:	8d 84 d0 88 00 00 00 	lea    0x88(%eax,%edx,8),%eax
+	if (i < NEXTENT)
+  80126b:	83 fa 0d             	cmp    $0xd,%edx
+  80126e:	76 3e                	jbe    8012ae <file_extent+0x53>
+	if (i >= NEXTENT + NINDIRECT)
+  801270:	81 fa 0d 02 00 00    	cmp    $0x20d,%edx
+  801276:	77 3d                	ja     8012b5 <file_extent+0x5a>
+	if (f->f_indirect == 0) {
+  801278:	83 be f8 00 00 00 00 	cmpl   $0x0,0xf8(%esi)
+  80127f:	75 18                	jne    801299 <file_extent+0x3e>
+			return 0;
+  801281:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (!alloc || (r = alloc_block()) < 0)
+  801286:	84 c9                	test   %cl,%cl
+  801288:	74 24                	je     8012ae <file_extent+0x53>
+  80128a:	e8 9a ff ff ff       	call   801229 <alloc_block>
+  80128f:	85 c0                	test   %eax,%eax
+  801291:	78 29                	js     8012bc <file_extent+0x61>
+		f->f_indirect = r;
+  801293:	89 86 f8 00 00 00    	mov    %eax,0xf8(%esi)
+	return (struct Extent*) diskaddr(f->f_indirect) + i - NEXTENT;
+  801299:	83 ec 0c             	sub    $0xc,%esp
+  80129c:	ff b6 f8 00 00 00    	push   0xf8(%esi)
+  8012a2:	e8 8c f2 ff ff       	call   800533 <diskaddr>
+  8012a7:	8d 44 d8 90          	lea    -0x70(%eax,%ebx,8),%eax
+  8012ab:	83 c4 10             	add    $0x10,%esp
+}
+  8012ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012b1:	5b                   	pop    %ebx
+  8012b2:	5e                   	pop    %esi
+  8012b3:	5d                   	pop    %ebp
+  8012b4:	c3                   	ret
+		return 0;
+  8012b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ba:	eb f2                	jmp    8012ae <file_extent+0x53>
+			return 0;
+  8012bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c1:	eb eb                	jmp    8012ae <file_extent+0x53>
+
+008012c3 <file_block_walk>:
+	if (filebno >= MAXFILESIZE / BLKSIZE)
+  8012c3:	81 fa ff ff 03 00    	cmp    $0x3ffff,%edx
+  8012c9:	77 72                	ja     80133d <file_block_walk+0x7a>
+{
+  8012cb:	55                   	push   %ebp
+  8012cc:	89 e5                	mov    %esp,%ebp
+  8012ce:	57                   	push   %edi
+  8012cf:	56                   	push   %esi
+  8012d0:	53                   	push   %ebx
+  8012d1:	83 ec 1c             	sub    $0x1c,%esp
+  8012d4:	89 c7                	mov    %eax,%edi
+  8012d6:	89 d3                	mov    %edx,%ebx
+	*pdiskbno = 0;
+  8012d8:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	if (prun)
+  8012de:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8012e2:	74 09                	je     8012ed <file_block_walk+0x2a>
+		*prun = 1;
+  8012e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012e7:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+{
+  8012ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	for (i = 0; (e = file_extent(f, i, 0)) && e->e_len; i++) {
+  8012f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012fa:	89 f2                	mov    %esi,%edx
+  8012fc:	89 f8                	mov    %edi,%eax
+  8012fe:	e8 58 ff ff ff       	call   80125b <file_extent>
+  801303:	85 c0                	test   %eax,%eax
+  801305:	74 3e                	je     801345 <file_block_walk+0x82>
+  801307:	8b 50 04             	mov    0x4(%eax),%edx
+  80130a:	85 d2                	test   %edx,%edx
+  80130c:	74 3c                	je     80134a <file_block_walk+0x87>
+		if (filebno < e->e_len) {
+  80130e:	39 d3                	cmp    %edx,%ebx
+  801310:	72 07                	jb     801319 <file_block_walk+0x56>
+		filebno -= e->e_len;
+  801312:	29 d3                	sub    %edx,%ebx
+	for (i = 0; (e = file_extent(f, i, 0)) && e->e_len; i++) {
+  801314:	83 c6 01             	add    $0x1,%esi
+  801317:	eb dc                	jmp    8012f5 <file_block_walk+0x32>
+			if (e->e_start)
+  801319:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80131c:	8b 10                	mov    (%eax),%edx
+  80131e:	85 d2                	test   %edx,%edx
+  801320:	74 04                	je     801326 <file_block_walk+0x63>
+				*pdiskbno = e->e_start + filebno;
+  801322:	01 da                	add    %ebx,%edx
+  801324:	89 11                	mov    %edx,(%ecx)
+	return 0;
+  801326:	ba 00 00 00 00       	mov    $0x0,%edx
+			if (prun)
+  80132b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80132f:	74 19                	je     80134a <file_block_walk+0x87>
+				*prun = e->e_len - filebno;
+  801331:	8b 40 04             	mov    0x4(%eax),%eax
+  801334:	29 d8                	sub    %ebx,%eax
+  801336:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801339:	89 07                	mov    %eax,(%edi)
+  80133b:	eb 0d                	jmp    80134a <file_block_walk+0x87>
+		return -E_INVAL;
+  80133d:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+}
+  801342:	89 d0                	mov    %edx,%eax
+  801344:	c3                   	ret
+	return 0;
+  801345:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  80134a:	89 d0                	mov    %edx,%eax
+  80134c:	83 c4 1c             	add    $0x1c,%esp
+  80134f:	5b                   	pop    %ebx
+  801350:	5e                   	pop    %esi
+  801351:	5f                   	pop    %edi
+  801352:	5d                   	pop    %ebp
+  801353:	c3                   	ret
+
+00801354 <file_nextents>:
+{
+  801354:	55                   	push   %ebp
+  801355:	89 e5                	mov    %esp,%ebp
+  801357:	56                   	push   %esi
+  801358:	53                   	push   %ebx
+  801359:	89 c6                	mov    %eax,%esi
+	for (i = 0; (e = file_extent(f, i, 0)) && e->e_len; i++)
+  80135b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801360:	eb 03                	jmp    801365 <file_nextents+0x11>
+  801362:	83 c3 01             	add    $0x1,%ebx
+  801365:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80136a:	89 da                	mov    %ebx,%edx
+  80136c:	89 f0                	mov    %esi,%eax
+  80136e:	e8 e8 fe ff ff       	call   80125b <file_extent>
+  801373:	85 c0                	test   %eax,%eax
+  801375:	74 06                	je     80137d <file_nextents+0x29>
+  801377:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+  80137b:	75 e5                	jne    801362 <file_nextents+0xe>
+}
+  80137d:	89 d8                	mov    %ebx,%eax
+  80137f:	5b                   	pop    %ebx
+  801380:	5e                   	pop    %esi
+  801381:	5d                   	pop    %ebp
+  801382:	c3                   	ret
+
+00801383 <file_map_blocks>:
+{
+  801383:	55                   	push   %ebp
+  801384:	89 e5                	mov    %esp,%ebp
+  801386:	57                   	push   %edi
+  801387:	56                   	push   %esi
+  801388:	53                   	push   %ebx
+  801389:	83 ec 3c             	sub    $0x3c,%esp
+  80138c:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  80138f:	89 d7                	mov    %edx,%edi
+  801391:	89 4d bc             	mov    %ecx,-0x44(%ebp)
+	for (i = 0; (e = file_extent(f, i, 0)) && e->e_len; i++) {
+  801394:	be 00 00 00 00       	mov    $0x0,%esi
+  801399:	89 c3                	mov    %eax,%ebx
+  80139b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013a0:	89 f2                	mov    %esi,%edx
+  8013a2:	89 d8                	mov    %ebx,%eax
+  8013a4:	e8 b2 fe ff ff       	call   80125b <file_extent>
+  8013a9:	85 c0                	test   %eax,%eax
+  8013ab:	0f 84 80 01 00 00    	je     801531 <file_map_blocks+0x1ae>
+  8013b1:	8b 50 04             	mov    0x4(%eax),%edx
+		if (filebno < e->e_len)
+  8013b4:	39 d7                	cmp    %edx,%edi
+  8013b6:	0f 82 a2 01 00 00    	jb     80155e <file_map_blocks+0x1db>
+  8013bc:	85 d2                	test   %edx,%edx
+  8013be:	74 07                	je     8013c7 <file_map_blocks+0x44>
+		filebno -= e->e_len;
+  8013c0:	29 d7                	sub    %edx,%edi
+	for (i = 0; (e = file_extent(f, i, 0)) && e->e_len; i++) {
+  8013c2:	83 c6 01             	add    $0x1,%esi
+  8013c5:	eb d4                	jmp    80139b <file_map_blocks+0x18>
+  8013c7:	89 c3                	mov    %eax,%ebx
+  8013c9:	e9 92 01 00 00       	jmp    801560 <file_map_blocks+0x1dd>
+	prev = i > 0 ? file_extent(f, i - 1, 0) : 0;
+  8013ce:	8d 56 ff             	lea    -0x1(%esi),%edx
+  8013d1:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8013d4:	e8 82 fe ff ff       	call   80125b <file_extent>
+	if (before == 0 && prev && prev->e_start
+  8013d9:	85 ff                	test   %edi,%edi
+  8013db:	0f 85 a8 01 00 00    	jne    801589 <file_map_blocks+0x206>
+  8013e1:	85 c0                	test   %eax,%eax
+  8013e3:	0f 84 a0 01 00 00    	je     801589 <file_map_blocks+0x206>
+  8013e9:	8b 10                	mov    (%eax),%edx
+  8013eb:	85 d2                	test   %edx,%edx
+  8013ed:	74 0c                	je     8013fb <file_map_blocks+0x78>
+	    && prev->e_start + prev->e_len == diskbno) {
+  8013ef:	8b 48 04             	mov    0x4(%eax),%ecx
+  8013f2:	01 ca                	add    %ecx,%edx
+  8013f4:	8b 7d bc             	mov    -0x44(%ebp),%edi
+  8013f7:	39 fa                	cmp    %edi,%edx
+  8013f9:	74 36                	je     801431 <file_map_blocks+0xae>
+	pieces[npieces++] = (struct Extent) { diskbno, n };
+  8013fb:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  8013fe:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801401:	8b 45 08             	mov    0x8(%ebp),%eax
+  801404:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	if (after)
+  801407:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+  80140b:	0f 85 a6 00 00 00    	jne    8014b7 <file_map_blocks+0x134>
+	next = file_nextents(f);
+  801411:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  801414:	e8 3b ff ff ff       	call   801354 <file_nextents>
+  801419:	89 c3                	mov    %eax,%ebx
+	pieces[npieces++] = (struct Extent) { diskbno, n };
+  80141b:	bf 01 00 00 00       	mov    $0x1,%edi
+  801420:	8d 53 ff             	lea    -0x1(%ebx),%edx
+	for (j = next; j-- > i + 1; )
+  801423:	8d 46 01             	lea    0x1(%esi),%eax
+  801426:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  801429:	89 75 bc             	mov    %esi,-0x44(%ebp)
+  80142c:	e9 be 00 00 00       	jmp    8014ef <file_map_blocks+0x16c>
+		prev->e_len += n;
+  801431:	03 4d 08             	add    0x8(%ebp),%ecx
+  801434:	89 48 04             	mov    %ecx,0x4(%eax)
+		if ((e->e_len -= n) == 0)
+  801437:	8b 53 04             	mov    0x4(%ebx),%edx
+  80143a:	2b 55 08             	sub    0x8(%ebp),%edx
+  80143d:	89 53 04             	mov    %edx,0x4(%ebx)
+		return 0;
+  801440:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((e->e_len -= n) == 0)
+  801445:	0f 85 de 00 00 00    	jne    801529 <file_map_blocks+0x1a6>
+	uint32_t n = file_nextents(f);
+  80144b:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80144e:	e8 01 ff ff ff       	call   801354 <file_nextents>
+  801453:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	for (; i + 1 < n; i++)
+  801456:	eb 2c                	jmp    801484 <file_map_blocks+0x101>
+		*file_extent(f, i, 0) = *file_extent(f, i + 1, 0);
+  801458:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80145d:	89 da                	mov    %ebx,%edx
+  80145f:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  801462:	e8 f4 fd ff ff       	call   80125b <file_extent>
+  801467:	89 c7                	mov    %eax,%edi
+  801469:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80146e:	89 f2                	mov    %esi,%edx
+  801470:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  801473:	e8 e3 fd ff ff       	call   80125b <file_extent>
+  801478:	8b 37                	mov    (%edi),%esi
+  80147a:	8b 7f 04             	mov    0x4(%edi),%edi
+  80147d:	89 30                	mov    %esi,(%eax)
+  80147f:	89 78 04             	mov    %edi,0x4(%eax)
+	for (; i + 1 < n; i++)
+  801482:	89 de                	mov    %ebx,%esi
+  801484:	8d 5e 01             	lea    0x1(%esi),%ebx
+  801487:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  80148a:	39 c3                	cmp    %eax,%ebx
+  80148c:	72 ca                	jb     801458 <file_map_blocks+0xd5>
+	memset(file_extent(f, n - 1, 0), 0, sizeof(struct Extent));
+  80148e:	89 c2                	mov    %eax,%edx
+  801490:	83 ea 01             	sub    $0x1,%edx
+  801493:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801498:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80149b:	e8 bb fd ff ff       	call   80125b <file_extent>
+  8014a0:	83 ec 04             	sub    $0x4,%esp
+  8014a3:	6a 08                	push   $0x8
+  8014a5:	6a 00                	push   $0x0
+  8014a7:	50                   	push   %eax
+  8014a8:	e8 49 26 00 00       	call   803af6 <memset>
+}
+  8014ad:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8014b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014b5:	eb 72                	jmp    801529 <file_map_blocks+0x1a6>
+	if (after)
+  8014b7:	8b 7d b8             	mov    -0x48(%ebp),%edi
+	pieces[npieces++] = (struct Extent) { diskbno, n };
+  8014ba:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014bf:	e9 f3 00 00 00       	jmp    8015b7 <file_map_blocks+0x234>
+		*file_extent(f, j + npieces - 1, 0) = *file_extent(f, j, 0);
+  8014c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014c9:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8014cc:	e8 8a fd ff ff       	call   80125b <file_extent>
+  8014d1:	89 c3                	mov    %eax,%ebx
+  8014d3:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+  8014d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014db:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8014de:	e8 78 fd ff ff       	call   80125b <file_extent>
+  8014e3:	8b 0b                	mov    (%ebx),%ecx
+  8014e5:	8b 5b 04             	mov    0x4(%ebx),%ebx
+  8014e8:	89 08                	mov    %ecx,(%eax)
+  8014ea:	89 58 04             	mov    %ebx,0x4(%eax)
+  8014ed:	89 f2                	mov    %esi,%edx
+	for (j = next; j-- > i + 1; )
+  8014ef:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8014f2:	8d 42 01             	lea    0x1(%edx),%eax
+  8014f5:	39 45 c0             	cmp    %eax,-0x40(%ebp)
+  8014f8:	72 ca                	jb     8014c4 <file_map_blocks+0x141>
+  8014fa:	8b 75 bc             	mov    -0x44(%ebp),%esi
+  8014fd:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+		*file_extent(f, i + j, 0) = pieces[j];
+  801500:	8d 14 1e             	lea    (%esi,%ebx,1),%edx
+  801503:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801508:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80150b:	e8 4b fd ff ff       	call   80125b <file_extent>
+  801510:	8b 54 dd d0          	mov    -0x30(%ebp,%ebx,8),%edx
+  801514:	8b 4c dd d4          	mov    -0x2c(%ebp,%ebx,8),%ecx
+  801518:	89 10                	mov    %edx,(%eax)
+  80151a:	89 48 04             	mov    %ecx,0x4(%eax)
+	for (j = 0; j < npieces; j++)
+  80151d:	83 c3 01             	add    $0x1,%ebx
+  801520:	39 fb                	cmp    %edi,%ebx
+  801522:	75 dc                	jne    801500 <file_map_blocks+0x17d>
+	return 0;
+  801524:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801529:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80152c:	5b                   	pop    %ebx
+  80152d:	5e                   	pop    %esi
+  80152e:	5f                   	pop    %edi
+  80152f:	5d                   	pop    %ebp
+  801530:	c3                   	ret
+		return -E_INVAL;
+  801531:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801536:	eb f1                	jmp    801529 <file_map_blocks+0x1a6>
+  801538:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80153d:	eb ea                	jmp    801529 <file_map_blocks+0x1a6>
+  80153f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801544:	eb e3                	jmp    801529 <file_map_blocks+0x1a6>
+  801546:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80154b:	eb dc                	jmp    801529 <file_map_blocks+0x1a6>
+	next = file_nextents(f);
+  80154d:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  801550:	e8 ff fd ff ff       	call   801354 <file_nextents>
+  801555:	89 c3                	mov    %eax,%ebx
+	pieces[npieces++] = (struct Extent) { diskbno, n };
+  801557:	bf 02 00 00 00       	mov    $0x2,%edi
+  80155c:	eb 75                	jmp    8015d3 <file_map_blocks+0x250>
+  80155e:	89 c3                	mov    %eax,%ebx
+	if (!e || e->e_len == 0 || e->e_start != 0 || filebno + n > e->e_len)
+  801560:	8b 43 04             	mov    0x4(%ebx),%eax
+  801563:	85 c0                	test   %eax,%eax
+  801565:	74 df                	je     801546 <file_map_blocks+0x1c3>
+  801567:	8b 0b                	mov    (%ebx),%ecx
+  801569:	89 4d b8             	mov    %ecx,-0x48(%ebp)
+  80156c:	85 c9                	test   %ecx,%ecx
+  80156e:	75 c8                	jne    801538 <file_map_blocks+0x1b5>
+  801570:	89 fa                	mov    %edi,%edx
+  801572:	03 55 08             	add    0x8(%ebp),%edx
+  801575:	39 d0                	cmp    %edx,%eax
+  801577:	72 c6                	jb     80153f <file_map_blocks+0x1bc>
+	after = e->e_len - filebno - n;
+  801579:	29 f8                	sub    %edi,%eax
+  80157b:	2b 45 08             	sub    0x8(%ebp),%eax
+  80157e:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	prev = i > 0 ? file_extent(f, i - 1, 0) : 0;
+  801581:	85 f6                	test   %esi,%esi
+  801583:	0f 85 45 fe ff ff    	jne    8013ce <file_map_blocks+0x4b>
+	if (before)
+  801589:	85 ff                	test   %edi,%edi
+  80158b:	0f 84 6a fe ff ff    	je     8013fb <file_map_blocks+0x78>
+		pieces[npieces++] = (struct Extent) { 0, before };
+  801591:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801598:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+	pieces[npieces++] = (struct Extent) { diskbno, n };
+  80159b:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  80159e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8015a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015a4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	if (after)
+  8015a7:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+  8015ab:	74 a0                	je     80154d <file_map_blocks+0x1ca>
+	pieces[npieces++] = (struct Extent) { diskbno, n };
+  8015ad:	b8 02 00 00 00       	mov    $0x2,%eax
+		pieces[npieces++] = (struct Extent) { 0, before };
+  8015b2:	bf 01 00 00 00       	mov    $0x1,%edi
+		pieces[npieces++] = (struct Extent) { 0, after };
+  8015b7:	83 c7 02             	add    $0x2,%edi
+  8015ba:	c7 44 c5 d0 00 00 00 	movl   $0x0,-0x30(%ebp,%eax,8)
+  8015c1:	00 
+  8015c2:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+  8015c5:	89 4c c5 d4          	mov    %ecx,-0x2c(%ebp,%eax,8)
+	next = file_nextents(f);
+  8015c9:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8015cc:	e8 83 fd ff ff       	call   801354 <file_nextents>
+  8015d1:	89 c3                	mov    %eax,%ebx
+	if (npieces > 1 && !file_extent(f, next + npieces - 2, 1))
+  8015d3:	8d 54 1f fe          	lea    -0x2(%edi,%ebx,1),%edx
+  8015d7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8015dc:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8015df:	e8 77 fc ff ff       	call   80125b <file_extent>
+  8015e4:	85 c0                	test   %eax,%eax
+  8015e6:	0f 85 34 fe ff ff    	jne    801420 <file_map_blocks+0x9d>
+		return -E_NO_DISK;
+  8015ec:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8015f1:	e9 33 ff ff ff       	jmp    801529 <file_map_blocks+0x1a6>
+
+008015f6 <file_flush_pending>:
+{
+  8015f6:	55                   	push   %ebp
+  8015f7:	89 e5                	mov    %esp,%ebp
+  8015f9:	57                   	push   %edi
+  8015fa:	56                   	push   %esi
+  8015fb:	53                   	push   %ebx
+  8015fc:	83 ec 3c             	sub    $0x3c,%esp
+  8015ff:	89 c1                	mov    %eax,%ecx
+  801601:	89 45 bc             	mov    %eax,-0x44(%ebp)
+	for (i = n = 0; i < NPENDING; i++)
+  801604:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801609:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160e:	eb 0a                	jmp    80161a <file_flush_pending+0x24>
+  801610:	83 c0 01             	add    $0x1,%eax
+  801613:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801618:	74 18                	je     801632 <file_flush_pending+0x3c>
+		if (pendtab[i].p_file == f)
+  80161a:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80161d:	39 0c 95 00 2d 85 00 	cmp    %ecx,0x852d00(,%edx,4)
+  801624:	75 ea                	jne    801610 <file_flush_pending+0x1a>
+			slots[n++] = i;
+  801626:	89 04 9d a0 10 83 00 	mov    %eax,0x8310a0(,%ebx,4)
+  80162d:	8d 5b 01             	lea    0x1(%ebx),%ebx
+  801630:	eb de                	jmp    801610 <file_flush_pending+0x1a>
+		return 0;
+  801632:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+  801635:	b9 00 00 00 00       	mov    $0x0,%ecx
+	if (n == 0)
+  80163a:	85 db                	test   %ebx,%ebx
+  80163c:	75 0a                	jne    801648 <file_flush_pending+0x52>
+}
+  80163e:	89 c8                	mov    %ecx,%eax
+  801640:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801643:	5b                   	pop    %ebx
+  801644:	5e                   	pop    %esi
+  801645:	5f                   	pop    %edi
+  801646:	5d                   	pop    %ebp
+  801647:	c3                   	ret
+	if ((void*) f >= (void*) DISKMAP && (void*) f < (void*) (DISKMAP + DISKSIZE))
+  801648:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  80164b:	2d 00 00 00 10       	sub    $0x10000000,%eax
+  801650:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801655:	76 0e                	jbe    801665 <file_flush_pending+0x6f>
+	for (k = n / 2; k > 0; k /= 2)
+  801657:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  80165a:	d1 e8                	shr    %eax
+  80165c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80165f:	c6 45 cc 00          	movb   $0x0,-0x34(%ebp)
+  801663:	eb 69                	jmp    8016ce <file_flush_pending+0xd8>
+		return bc_make_private(f);
+  801665:	83 ec 0c             	sub    $0xc,%esp
+  801668:	ff 75 bc             	push   -0x44(%ebp)
+  80166b:	e8 3a f7 ff ff       	call   800daa <bc_make_private>
+  801670:	89 c1                	mov    %eax,%ecx
+	if ((r = file_make_private(f)) < 0)
+  801672:	83 c4 10             	add    $0x10,%esp
+  801675:	85 c0                	test   %eax,%eax
+  801677:	78 c5                	js     80163e <file_flush_pending+0x48>
+  801679:	eb dc                	jmp    801657 <file_flush_pending+0x61>
+		for (i = k; i < n; i++)
+  80167b:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+  80167e:	83 c1 01             	add    $0x1,%ecx
+  801681:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  801684:	39 c1                	cmp    %eax,%ecx
+  801686:	73 43                	jae    8016cb <file_flush_pending+0xd5>
+  801688:	8d 04 8d a0 10 83 00 	lea    0x8310a0(,%ecx,4),%eax
+  80168f:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  801692:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+			for (j = i; j >= k && pendtab[slots[j - k]].p_filebno > pendtab[slots[j]].p_filebno; j -= k) {
+  801695:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  801698:	39 75 d4             	cmp    %esi,-0x2c(%ebp)
+  80169b:	72 de                	jb     80167b <file_flush_pending+0x85>
+  80169d:	29 75 d4             	sub    %esi,-0x2c(%ebp)
+  8016a0:	8b 0c 38             	mov    (%eax,%edi,1),%ecx
+  8016a3:	8b 10                	mov    (%eax),%edx
+  8016a5:	8d 34 49             	lea    (%ecx,%ecx,2),%esi
+  8016a8:	8d 1c 52             	lea    (%edx,%edx,2),%ebx
+  8016ab:	8b 34 b5 04 2d 85 00 	mov    0x852d04(,%esi,4),%esi
+  8016b2:	39 34 9d 04 2d 85 00 	cmp    %esi,0x852d04(,%ebx,4)
+  8016b9:	73 c0                	jae    80167b <file_flush_pending+0x85>
+				t = slots[j];
+  8016bb:	89 55 c8             	mov    %edx,-0x38(%ebp)
+				slots[j] = slots[j - k];
+  8016be:	89 08                	mov    %ecx,(%eax)
+				slots[j - k] = t;
+  8016c0:	89 14 38             	mov    %edx,(%eax,%edi,1)
+			for (j = i; j >= k && pendtab[slots[j - k]].p_filebno > pendtab[slots[j]].p_filebno; j -= k) {
+  8016c3:	01 f8                	add    %edi,%eax
+				slots[j - k] = t;
+  8016c5:	c6 45 cc 01          	movb   $0x1,-0x34(%ebp)
+  8016c9:	eb ca                	jmp    801695 <file_flush_pending+0x9f>
+	for (k = n / 2; k > 0; k /= 2)
+  8016cb:	d1 6d d0             	shrl   -0x30(%ebp)
+  8016ce:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8016d1:	85 c9                	test   %ecx,%ecx
+  8016d3:	74 0d                	je     8016e2 <file_flush_pending+0xec>
+  8016d5:	8d 04 8d 00 00 00 00 	lea    0x0(,%ecx,4),%eax
+  8016dc:	f7 d8                	neg    %eax
+  8016de:	89 c7                	mov    %eax,%edi
+  8016e0:	eb 9f                	jmp    801681 <file_flush_pending+0x8b>
+  8016e2:	80 7d cc 00          	cmpb   $0x0,-0x34(%ebp)
+  8016e6:	74 06                	je     8016ee <file_flush_pending+0xf8>
+  8016e8:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8016eb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (i = 0; i < n; i += got) {
+  8016ee:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8016f1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+		if ((r = alloc_blocks(goal, k, &got)) < 0)
+  8016f4:	8b 75 c0             	mov    -0x40(%ebp),%esi
+  8016f7:	e9 37 01 00 00       	jmp    801833 <file_flush_pending+0x23d>
+			     && pendtab[slots[i + k]].p_filebno == filebno + k; k++)
+  8016fc:	83 c7 01             	add    $0x1,%edi
+		for (k = 1; i + k < n && k < BC_MAX_WRITEBACK
+  8016ff:	39 f0                	cmp    %esi,%eax
+  801701:	73 1e                	jae    801721 <file_flush_pending+0x12b>
+  801703:	83 ff 1f             	cmp    $0x1f,%edi
+  801706:	77 19                	ja     801721 <file_flush_pending+0x12b>
+			     && pendtab[slots[i + k]].p_filebno == filebno + k; k++)
+  801708:	8b 14 85 a0 10 83 00 	mov    0x8310a0(,%eax,4),%edx
+  80170f:	8d 0c 52             	lea    (%edx,%edx,2),%ecx
+  801712:	83 c0 01             	add    $0x1,%eax
+  801715:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801718:	39 14 8d 04 2d 85 00 	cmp    %edx,0x852d04(,%ecx,4)
+  80171f:	74 db                	je     8016fc <file_flush_pending+0x106>
+		goal = alloc_hint;
+  801721:	a1 00 39 85 00       	mov    0x853900,%eax
+  801726:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+		if (filebno > 0 && file_block_walk(f, filebno - 1, &t, 0) == 0 && t)
+  801729:	85 db                	test   %ebx,%ebx
+  80172b:	75 4a                	jne    801777 <file_flush_pending+0x181>
+		if ((r = alloc_blocks(goal, k, &got)) < 0)
+  80172d:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  801730:	89 fa                	mov    %edi,%edx
+  801732:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801735:	e8 a4 f9 ff ff       	call   8010de <alloc_blocks>
+  80173a:	85 c0                	test   %eax,%eax
+  80173c:	0f 88 1c 01 00 00    	js     80185e <file_flush_pending+0x268>
+		start = r;
+  801742:	89 45 cc             	mov    %eax,-0x34(%ebp)
+		if ((r = file_map_blocks(f, filebno, start, got)) < 0) {
+  801745:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801748:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  80174b:	83 ec 0c             	sub    $0xc,%esp
+  80174e:	57                   	push   %edi
+  80174f:	89 c1                	mov    %eax,%ecx
+  801751:	89 da                	mov    %ebx,%edx
+  801753:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  801756:	e8 28 fc ff ff       	call   801383 <file_map_blocks>
+  80175b:	83 c4 10             	add    $0x10,%esp
+  80175e:	85 c0                	test   %eax,%eax
+  801760:	78 40                	js     8017a2 <file_flush_pending+0x1ac>
+  801762:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801765:	8d 3c 85 00 00 00 00 	lea    0x0(,%eax,4),%edi
+		for (j = 0; j < got; j++) {
+  80176c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80176f:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801772:	e9 99 00 00 00       	jmp    801810 <file_flush_pending+0x21a>
+		if (filebno > 0 && file_block_walk(f, filebno - 1, &t, 0) == 0 && t)
+  801777:	8d 53 ff             	lea    -0x1(%ebx),%edx
+  80177a:	83 ec 0c             	sub    $0xc,%esp
+  80177d:	6a 00                	push   $0x0
+  80177f:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  801782:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  801785:	e8 39 fb ff ff       	call   8012c3 <file_block_walk>
+  80178a:	83 c4 10             	add    $0x10,%esp
+  80178d:	85 c0                	test   %eax,%eax
+  80178f:	75 9c                	jne    80172d <file_flush_pending+0x137>
+  801791:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+			goal = t + 1;
+  801794:	8d 50 01             	lea    0x1(%eax),%edx
+  801797:	85 c0                	test   %eax,%eax
+  801799:	0f 44 55 d4          	cmove  -0x2c(%ebp),%edx
+  80179d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  8017a0:	eb 8b                	jmp    80172d <file_flush_pending+0x137>
+  8017a2:	89 c1                	mov    %eax,%ecx
+  8017a4:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  8017a7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8017aa:	01 c3                	add    %eax,%ebx
+				bitmap[(start + j)/32] |= 1<<((start + j)%32);
+  8017ac:	bf 01 00 00 00       	mov    $0x1,%edi
+  8017b1:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8017b4:	89 c1                	mov    %eax,%ecx
+  8017b6:	eb 14                	jmp    8017cc <file_flush_pending+0x1d6>
+  8017b8:	89 ca                	mov    %ecx,%edx
+  8017ba:	c1 ea 05             	shr    $0x5,%edx
+  8017bd:	a1 10 a9 85 00       	mov    0x85a910,%eax
+  8017c2:	89 fe                	mov    %edi,%esi
+  8017c4:	d3 e6                	shl    %cl,%esi
+  8017c6:	09 34 90             	or     %esi,(%eax,%edx,4)
+			for (j = 0; j < got; j++)
+  8017c9:	83 c1 01             	add    $0x1,%ecx
+  8017cc:	39 cb                	cmp    %ecx,%ebx
+  8017ce:	75 e8                	jne    8017b8 <file_flush_pending+0x1c2>
+  8017d0:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8017d3:	e9 66 fe ff ff       	jmp    80163e <file_flush_pending+0x48>
+			bc_insert_block(start + j, PENDADDR(slots[i + j]));
+  8017d8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8017db:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+  8017de:	83 ec 08             	sub    $0x8,%esp
+  8017e1:	8b 84 9f a0 10 83 00 	mov    0x8310a0(%edi,%ebx,4),%eax
+  8017e8:	c1 e0 0c             	shl    $0xc,%eax
+  8017eb:	2d 00 00 00 20       	sub    $0x20000000,%eax
+  8017f0:	50                   	push   %eax
+  8017f1:	56                   	push   %esi
+  8017f2:	e8 d3 f4 ff ff       	call   800cca <bc_insert_block>
+			pend_unlink(slots[i + j]);
+  8017f7:	8b 84 9f a0 10 83 00 	mov    0x8310a0(%edi,%ebx,4),%eax
+  8017fe:	e8 cc f7 ff ff       	call   800fcf <pend_unlink>
+			blocknos[j] = start + j;
+  801803:	89 34 9d 20 10 83 00 	mov    %esi,0x831020(,%ebx,4)
+		for (j = 0; j < got; j++) {
+  80180a:	83 c3 01             	add    $0x1,%ebx
+  80180d:	83 c4 10             	add    $0x10,%esp
+  801810:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+  801813:	75 c3                	jne    8017d8 <file_flush_pending+0x1e2>
+		bc_write_blocks(blocknos, got);
+  801815:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801818:	83 ec 08             	sub    $0x8,%esp
+  80181b:	53                   	push   %ebx
+  80181c:	68 20 10 83 00       	push   $0x831020
+  801821:	e8 a1 f2 ff ff       	call   800ac7 <bc_write_blocks>
+	for (i = 0; i < n; i += got) {
+  801826:	01 5d c8             	add    %ebx,-0x38(%ebp)
+  801829:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80182c:	83 c4 10             	add    $0x10,%esp
+  80182f:	39 f0                	cmp    %esi,%eax
+  801831:	73 21                	jae    801854 <file_flush_pending+0x25e>
+		filebno = pendtab[slots[i]].p_filebno;
+  801833:	8b 7d c8             	mov    -0x38(%ebp),%edi
+  801836:	8b 04 bd a0 10 83 00 	mov    0x8310a0(,%edi,4),%eax
+  80183d:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  801840:	8b 1c 85 04 2d 85 00 	mov    0x852d04(,%eax,4),%ebx
+		for (k = 1; i + k < n && k < BC_MAX_WRITEBACK
+  801847:	8d 47 01             	lea    0x1(%edi),%eax
+  80184a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80184f:	e9 ab fe ff ff       	jmp    8016ff <file_flush_pending+0x109>
+	return 0;
+  801854:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801859:	e9 e0 fd ff ff       	jmp    80163e <file_flush_pending+0x48>
+  80185e:	89 c1                	mov    %eax,%ecx
+  801860:	e9 d9 fd ff ff       	jmp    80163e <file_flush_pending+0x48>
+
+00801865 <pend_flush_all>:
+{
+  801865:	55                   	push   %ebp
+  801866:	89 e5                	mov    %esp,%ebp
+  801868:	56                   	push   %esi
+  801869:	53                   	push   %ebx
+	for (i = 0; i < NPENDING && npending > 0; i++)
+  80186a:	bb 00 2d 85 00       	mov    $0x852d00,%ebx
+  80186f:	be 00 39 85 00       	mov    $0x853900,%esi
+  801874:	eb 03                	jmp    801879 <pend_flush_all+0x14>
+  801876:	83 c3 0c             	add    $0xc,%ebx
+  801879:	39 f3                	cmp    %esi,%ebx
+  80187b:	74 23                	je     8018a0 <pend_flush_all+0x3b>
+  80187d:	83 3d e0 28 85 00 00 	cmpl   $0x0,0x8528e0
+  801884:	74 11                	je     801897 <pend_flush_all+0x32>
+		if (pendtab[i].p_file && (r = file_flush_pending(pendtab[i].p_file)) < 0)
+  801886:	8b 03                	mov    (%ebx),%eax
+  801888:	85 c0                	test   %eax,%eax
+  80188a:	74 ea                	je     801876 <pend_flush_all+0x11>
+  80188c:	e8 65 fd ff ff       	call   8015f6 <file_flush_pending>
+  801891:	85 c0                	test   %eax,%eax
+  801893:	79 e1                	jns    801876 <pend_flush_all+0x11>
+  801895:	eb 05                	jmp    80189c <pend_flush_all+0x37>
+	return 0;
+  801897:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80189c:	5b                   	pop    %ebx
+  80189d:	5e                   	pop    %esi
+  80189e:	5d                   	pop    %ebp
+  80189f:	c3                   	ret
+	return 0;
+  8018a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a5:	eb f5                	jmp    80189c <pend_flush_all+0x37>
+
+008018a7 <file_get_block_for_write>:
+{
+  8018a7:	55                   	push   %ebp
+  8018a8:	89 e5                	mov    %esp,%ebp
+  8018aa:	57                   	push   %edi
+  8018ab:	56                   	push   %esi
+  8018ac:	53                   	push   %ebx
+  8018ad:	83 ec 38             	sub    $0x38,%esp
+  8018b0:	89 c6                	mov    %eax,%esi
+  8018b2:	89 55 d0             	mov    %edx,-0x30(%ebp)
+  8018b5:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+	if ((r = file_block_walk(f, filebno, &diskbno, 0)) < 0)
+  8018b8:	6a 00                	push   $0x0
+  8018ba:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  8018bd:	e8 01 fa ff ff       	call   8012c3 <file_block_walk>
+  8018c2:	89 c3                	mov    %eax,%ebx
+  8018c4:	83 c4 10             	add    $0x10,%esp
+  8018c7:	85 c0                	test   %eax,%eax
+  8018c9:	78 75                	js     801940 <file_get_block_for_write+0x99>
+	if (diskbno == 0 && f->f_type == FTYPE_DIR) {
+  8018cb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8018ce:	85 ff                	test   %edi,%edi
+  8018d0:	75 4f                	jne    801921 <file_get_block_for_write+0x7a>
+  8018d2:	83 be 84 00 00 00 01 	cmpl   $0x1,0x84(%esi)
+  8018d9:	74 18                	je     8018f3 <file_get_block_for_write+0x4c>
+	else if ((i = pend_lookup(f, filebno)) >= 0)
+  8018db:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  8018de:	89 f0                	mov    %esi,%eax
+  8018e0:	e8 cd f5 ff ff       	call   800eb2 <pend_lookup>
+  8018e5:	85 c0                	test   %eax,%eax
+  8018e7:	78 6f                	js     801958 <file_get_block_for_write+0xb1>
+		*blk = PENDADDR(i);
+  8018e9:	c1 e0 0c             	shl    $0xc,%eax
+  8018ec:	2d 00 00 00 20       	sub    $0x20000000,%eax
+  8018f1:	eb 3a                	jmp    80192d <file_get_block_for_write+0x86>
+		if ((r = alloc_block()) < 0)
+  8018f3:	e8 31 f9 ff ff       	call   801229 <alloc_block>
+  8018f8:	89 c3                	mov    %eax,%ebx
+  8018fa:	85 c0                	test   %eax,%eax
+  8018fc:	78 42                	js     801940 <file_get_block_for_write+0x99>
+		if ((r2 = file_map_blocks(f, filebno, r, 1)) < 0) {
+  8018fe:	89 c7                	mov    %eax,%edi
+  801900:	83 ec 0c             	sub    $0xc,%esp
+  801903:	6a 01                	push   $0x1
+  801905:	89 c1                	mov    %eax,%ecx
+  801907:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  80190a:	89 f0                	mov    %esi,%eax
+  80190c:	e8 72 fa ff ff       	call   801383 <file_map_blocks>
+  801911:	89 c3                	mov    %eax,%ebx
+  801913:	83 c4 10             	add    $0x10,%esp
+  801916:	85 c0                	test   %eax,%eax
+  801918:	78 30                	js     80194a <file_get_block_for_write+0xa3>
+		diskbno = r;
+  80191a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+	if (diskbno)
+  80191d:	85 ff                	test   %edi,%edi
+  80191f:	74 ba                	je     8018db <file_get_block_for_write+0x34>
+		*blk = diskaddr(diskbno);
+  801921:	83 ec 0c             	sub    $0xc,%esp
+  801924:	57                   	push   %edi
+  801925:	e8 09 ec ff ff       	call   800533 <diskaddr>
+  80192a:	83 c4 10             	add    $0x10,%esp
+  80192d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  801930:	89 07                	mov    %eax,(%edi)
+	return bc_make_private(*blk);
+  801932:	83 ec 0c             	sub    $0xc,%esp
+  801935:	50                   	push   %eax
+  801936:	e8 6f f4 ff ff       	call   800daa <bc_make_private>
+  80193b:	89 c3                	mov    %eax,%ebx
+  80193d:	83 c4 10             	add    $0x10,%esp
+}
+  801940:	89 d8                	mov    %ebx,%eax
+  801942:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801945:	5b                   	pop    %ebx
+  801946:	5e                   	pop    %esi
+  801947:	5f                   	pop    %edi
+  801948:	5d                   	pop    %ebp
+  801949:	c3                   	ret
+			free_block(r);
+  80194a:	83 ec 0c             	sub    $0xc,%esp
+  80194d:	57                   	push   %edi
+  80194e:	e8 8e f8 ff ff       	call   8011e1 <free_block>
+			return r2;
+  801953:	83 c4 10             	add    $0x10,%esp
+  801956:	eb e8                	jmp    801940 <file_get_block_for_write+0x99>
+	if (npending == NPENDING && (r = pend_flush_all()) < 0)
+  801958:	81 3d e0 28 85 00 00 	cmpl   $0x100,0x8528e0
+  80195f:	01 00 00 
+  801962:	74 11                	je     801975 <file_get_block_for_write+0xce>
+  801964:	a1 a0 14 83 00       	mov    0x8314a0,%eax
+{
+  801969:	b9 00 00 00 00       	mov    $0x0,%ecx
+		next = (next + 1) % NPENDING;
+  80196e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801973:	eb 15                	jmp    80198a <file_get_block_for_write+0xe3>
+	if (npending == NPENDING && (r = pend_flush_all()) < 0)
+  801975:	e8 eb fe ff ff       	call   801865 <pend_flush_all>
+  80197a:	89 c3                	mov    %eax,%ebx
+  80197c:	85 c0                	test   %eax,%eax
+  80197e:	79 e4                	jns    801964 <file_get_block_for_write+0xbd>
+  801980:	eb be                	jmp    801940 <file_get_block_for_write+0x99>
+		next = (next + 1) % NPENDING;
+  801982:	83 c0 01             	add    $0x1,%eax
+  801985:	0f b6 c0             	movzbl %al,%eax
+  801988:	89 d9                	mov    %ebx,%ecx
+	while (pendtab[next].p_file)
+  80198a:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80198d:	83 3c 95 00 2d 85 00 	cmpl   $0x0,0x852d00(,%edx,4)
+  801994:	00 
+  801995:	75 eb                	jne    801982 <file_get_block_for_write+0xdb>
+  801997:	84 c9                	test   %cl,%cl
+  801999:	74 05                	je     8019a0 <file_get_block_for_write+0xf9>
+  80199b:	a3 a0 14 83 00       	mov    %eax,0x8314a0
+	if ((r = page_alloc(0, PENDADDR(next), PTE_P|PTE_U|PTE_W, 0)) < 0)
+  8019a0:	6a 00                	push   $0x0
+  8019a2:	6a 07                	push   $0x7
+  8019a4:	05 00 00 0e 00       	add    $0xe0000,%eax
+  8019a9:	c1 e0 0c             	shl    $0xc,%eax
+  8019ac:	50                   	push   %eax
+  8019ad:	6a 00                	push   $0x0
+  8019af:	e8 c0 50 00 00       	call   806a74 <page_alloc>
+  8019b4:	89 c3                	mov    %eax,%ebx
+  8019b6:	83 c4 10             	add    $0x10,%esp
+  8019b9:	85 c0                	test   %eax,%eax
+  8019bb:	78 83                	js     801940 <file_get_block_for_write+0x99>
+	return ((uint32_t) f / sizeof(struct File) + filebno * 31) & (NPENDING - 1);
+  8019bd:	89 f0                	mov    %esi,%eax
+  8019bf:	c1 e8 08             	shr    $0x8,%eax
+  8019c2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8019c5:	89 fa                	mov    %edi,%edx
+  8019c7:	c1 e2 05             	shl    $0x5,%edx
+  8019ca:	29 fa                	sub    %edi,%edx
+  8019cc:	01 d0                	add    %edx,%eax
+  8019ce:	0f b6 c0             	movzbl %al,%eax
+	pendtab[next].p_file = f;
+  8019d1:	8b 1d a0 14 83 00    	mov    0x8314a0,%ebx
+  8019d7:	8d 14 5b             	lea    (%ebx,%ebx,2),%edx
+  8019da:	c1 e2 02             	shl    $0x2,%edx
+  8019dd:	8d 8a 00 2d 85 00    	lea    0x852d00(%edx),%ecx
+  8019e3:	89 b2 00 2d 85 00    	mov    %esi,0x852d00(%edx)
+	pendtab[next].p_filebno = filebno;
+  8019e9:	89 ba 04 2d 85 00    	mov    %edi,0x852d04(%edx)
+	pendtab[next].p_next = pend_buckets[h];
+  8019ef:	8b 14 85 00 29 85 00 	mov    0x852900(,%eax,4),%edx
+  8019f6:	89 51 08             	mov    %edx,0x8(%ecx)
+	pend_buckets[h] = next;
+  8019f9:	89 1c 85 00 29 85 00 	mov    %ebx,0x852900(,%eax,4)
+	npending++;
+  801a00:	83 05 e0 28 85 00 01 	addl   $0x1,0x8528e0
+	*blk = PENDADDR(next);
+  801a07:	81 c3 00 00 0e 00    	add    $0xe0000,%ebx
+  801a0d:	c1 e3 0c             	shl    $0xc,%ebx
+  801a10:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801a13:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  801a15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a1a:	e9 21 ff ff ff       	jmp    801940 <file_get_block_for_write+0x99>
+
+00801a1f <fs_init>:
+{
+  801a1f:	55                   	push   %ebp
+  801a20:	89 e5                	mov    %esp,%ebp
+  801a22:	83 ec 08             	sub    $0x8,%esp
+	if (ide_probe_disk1())
+  801a25:	e8 c1 e6 ff ff       	call   8000eb <ide_probe_disk1>
+  801a2a:	84 c0                	test   %al,%al
+  801a2c:	74 53                	je     801a81 <fs_init+0x62>
+		ide_set_disk(1);
+  801a2e:	83 ec 0c             	sub    $0xc,%esp
+  801a31:	6a 01                	push   $0x1
+  801a33:	e8 e1 e7 ff ff       	call   800219 <ide_set_disk>
+  801a38:	83 c4 10             	add    $0x10,%esp
+	bc_init();
+  801a3b:	e8 27 f4 ff ff       	call   800e67 <bc_init>
+	super = diskaddr(1);
+  801a40:	83 ec 0c             	sub    $0xc,%esp
+  801a43:	6a 01                	push   $0x1
+  801a45:	e8 e9 ea ff ff       	call   800533 <diskaddr>
+  801a4a:	a3 14 a9 85 00       	mov    %eax,0x85a914
+	check_super();
+  801a4f:	e8 f4 f5 ff ff       	call   801048 <check_super>
+	bitmap = diskaddr(2);
+  801a54:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  801a5b:	e8 d3 ea ff ff       	call   800533 <diskaddr>
+  801a60:	a3 10 a9 85 00       	mov    %eax,0x85a910
+	memset(pend_buckets, 0xFF, sizeof(pend_buckets));
+  801a65:	83 c4 0c             	add    $0xc,%esp
+  801a68:	68 00 04 00 00       	push   $0x400
+  801a6d:	68 ff 00 00 00       	push   $0xff
+  801a72:	68 00 29 85 00       	push   $0x852900
+  801a77:	e8 7a 20 00 00       	call   803af6 <memset>
+}
+  801a7c:	83 c4 10             	add    $0x10,%esp
+  801a7f:	c9                   	leave
+  801a80:	c3                   	ret
+		ide_set_disk(0);
+  801a81:	83 ec 0c             	sub    $0xc,%esp
+  801a84:	6a 00                	push   $0x0
+  801a86:	e8 8e e7 ff ff       	call   800219 <ide_set_disk>
+  801a8b:	83 c4 10             	add    $0x10,%esp
+  801a8e:	eb ab                	jmp    801a3b <fs_init+0x1c>
+
+00801a90 <file_get_block>:
+{
+  801a90:	55                   	push   %ebp
+  801a91:	89 e5                	mov    %esp,%ebp
+  801a93:	83 ec 24             	sub    $0x24,%esp
+	if ((r = file_block_walk(f, filebno, &diskbno, 0)) < 0)
+  801a96:	6a 00                	push   $0x0
+  801a98:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801a9b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aa1:	e8 1d f8 ff ff       	call   8012c3 <file_block_walk>
+  801aa6:	83 c4 10             	add    $0x10,%esp
+  801aa9:	85 c0                	test   %eax,%eax
+  801aab:	78 28                	js     801ad5 <file_get_block+0x45>
+	if (diskbno) {
+  801aad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ab0:	85 c0                	test   %eax,%eax
+  801ab2:	75 23                	jne    801ad7 <file_get_block+0x47>
+	if ((i = pend_lookup(f, filebno)) < 0)
+  801ab4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ab7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aba:	e8 f3 f3 ff ff       	call   800eb2 <pend_lookup>
+  801abf:	85 c0                	test   %eax,%eax
+  801ac1:	78 2c                	js     801aef <file_get_block+0x5f>
+	*blk = PENDADDR(i);
+  801ac3:	c1 e0 0c             	shl    $0xc,%eax
+  801ac6:	2d 00 00 00 20       	sub    $0x20000000,%eax
+  801acb:	8b 55 10             	mov    0x10(%ebp),%edx
+  801ace:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801ad0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ad5:	c9                   	leave
+  801ad6:	c3                   	ret
+		*blk = diskaddr(diskbno);
+  801ad7:	83 ec 0c             	sub    $0xc,%esp
+  801ada:	50                   	push   %eax
+  801adb:	e8 53 ea ff ff       	call   800533 <diskaddr>
+  801ae0:	8b 55 10             	mov    0x10(%ebp),%edx
+  801ae3:	89 02                	mov    %eax,(%edx)
+		return 0;
+  801ae5:	83 c4 10             	add    $0x10,%esp
+  801ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aed:	eb e6                	jmp    801ad5 <file_get_block+0x45>
+		return -E_NOT_FOUND;
+  801aef:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  801af4:	eb df                	jmp    801ad5 <file_get_block+0x45>
+
+00801af6 <walk_path>:
+// If we cannot find the file but find the directory
+// it should be in, set *pdir and copy the final path
+// element into lastelem.
+static int
+walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem)
+{
+  801af6:	55                   	push   %ebp
+  801af7:	89 e5                	mov    %esp,%ebp
+  801af9:	57                   	push   %edi
+  801afa:	56                   	push   %esi
+  801afb:	53                   	push   %ebx
+  801afc:	81 ec cc 00 00 00    	sub    $0xcc,%esp
+  801b02:	89 d3                	mov    %edx,%ebx
+  801b04:	89 8d 34 ff ff ff    	mov    %ecx,-0xcc(%ebp)
+	while (*p == '/')
+  801b0a:	eb 03                	jmp    801b0f <walk_path+0x19>
+		p++;
+  801b0c:	83 c0 01             	add    $0x1,%eax
+	while (*p == '/')
+  801b0f:	80 38 2f             	cmpb   $0x2f,(%eax)
+  801b12:	74 f8                	je     801b0c <walk_path+0x16>
+	int r;
+
+	// if (*path != '/')
+	//	return -E_BAD_PATH;
+	path = skip_slash(path);
+	f = &super->s_root;
+  801b14:	8b 0d 14 a9 85 00    	mov    0x85a914,%ecx
+  801b1a:	83 c1 08             	add    $0x8,%ecx
+  801b1d:	89 8d 50 ff ff ff    	mov    %ecx,-0xb0(%ebp)
+	dir = 0;
+	name[0] = 0;
+  801b23:	c6 85 68 ff ff ff 00 	movb   $0x0,-0x98(%ebp)
+
+	if (pdir)
+  801b2a:	85 db                	test   %ebx,%ebx
+  801b2c:	74 06                	je     801b34 <walk_path+0x3e>
+		*pdir = 0;
+  801b2e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	*pf = 0;
+  801b34:	8b 8d 34 ff ff ff    	mov    -0xcc(%ebp),%ecx
+  801b3a:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	dir = 0;
+  801b40:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b45:	89 9d 38 ff ff ff    	mov    %ebx,-0xc8(%ebp)
+	while (*path != '\0') {
+  801b4b:	e9 13 01 00 00       	jmp    801c63 <walk_path+0x16d>
+		dir = f;
+		p = path;
+		while (*path != '/' && *path != '\0')
+			path++;
+		if (path - p >= MAXNAMELEN)
+  801b50:	88 95 47 ff ff ff    	mov    %dl,-0xb9(%ebp)
+  801b56:	89 de                	mov    %ebx,%esi
+  801b58:	29 c6                	sub    %eax,%esi
+  801b5a:	83 fe 7f             	cmp    $0x7f,%esi
+  801b5d:	0f 8f be 04 00 00    	jg     802021 <walk_path+0x52b>
+			return -E_BAD_PATH;
+		memmove(name, p, path - p);
+  801b63:	83 ec 04             	sub    $0x4,%esp
+  801b66:	56                   	push   %esi
+  801b67:	50                   	push   %eax
+  801b68:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  801b6e:	50                   	push   %eax
+  801b6f:	e8 b7 1f 00 00       	call   803b2b <memmove>
+		name[path - p] = '\0';
+  801b74:	c6 84 35 68 ff ff ff 	movb   $0x0,-0x98(%ebp,%esi,1)
+  801b7b:	00 
+	while (*p == '/')
+  801b7c:	83 c4 10             	add    $0x10,%esp
+  801b7f:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  801b82:	75 05                	jne    801b89 <walk_path+0x93>
+		p++;
+  801b84:	83 c3 01             	add    $0x1,%ebx
+  801b87:	eb f6                	jmp    801b7f <walk_path+0x89>
+		path = skip_slash(path);
+
+		if (dir->f_type != FTYPE_DIR)
+  801b89:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  801b8f:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  801b96:	0f 85 8c 04 00 00    	jne    802028 <walk_path+0x532>
+	assert((dir->f_size % BLKSIZE) == 0);
+  801b9c:	66 f7 80 80 00 00 00 	testw  $0xfff,0x80(%eax)
+  801ba3:	ff 0f 
+  801ba5:	0f 85 de 00 00 00    	jne    801c89 <walk_path+0x193>
+	if (name[0] != '\0' && (r = dirhash_lookup(dir, name, file)) != -E_NO_MEM)
+  801bab:	80 bd 68 ff ff ff 00 	cmpb   $0x0,-0x98(%ebp)
+  801bb2:	0f 85 ea 00 00 00    	jne    801ca2 <walk_path+0x1ac>
+	nblock = dir->f_size / BLKSIZE;
+  801bb8:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  801bbe:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+  801bc4:	8d 82 ff 0f 00 00    	lea    0xfff(%edx),%eax
+  801bca:	85 d2                	test   %edx,%edx
+  801bcc:	0f 49 c2             	cmovns %edx,%eax
+  801bcf:	c1 f8 0c             	sar    $0xc,%eax
+  801bd2:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+	for (i = 0; i < nblock; i++) {
+  801bd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bdd:	89 9d 48 ff ff ff    	mov    %ebx,-0xb8(%ebp)
+  801be3:	89 c3                	mov    %eax,%ebx
+  801be5:	39 9d 4c ff ff ff    	cmp    %ebx,-0xb4(%ebp)
+  801beb:	0f 84 aa 03 00 00    	je     801f9b <walk_path+0x4a5>
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  801bf1:	83 ec 04             	sub    $0x4,%esp
+  801bf4:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+  801bfa:	50                   	push   %eax
+  801bfb:	53                   	push   %ebx
+  801bfc:	ff b5 50 ff ff ff    	push   -0xb0(%ebp)
+  801c02:	e8 89 fe ff ff       	call   801a90 <file_get_block>
+  801c07:	83 c4 10             	add    $0x10,%esp
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	0f 88 99 03 00 00    	js     801fab <walk_path+0x4b5>
+		for (j = 0; j < BLKFILES; j++)
+  801c12:	8b b5 64 ff ff ff    	mov    -0x9c(%ebp),%esi
+  801c18:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+  801c1e:	39 f7                	cmp    %esi,%edi
+  801c20:	0f 84 6d 03 00 00    	je     801f93 <walk_path+0x49d>
+			if (strcmp(f[j].f_name, name) == 0) {
+  801c26:	89 b5 54 ff ff ff    	mov    %esi,-0xac(%ebp)
+  801c2c:	83 ec 08             	sub    $0x8,%esp
+  801c2f:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  801c35:	50                   	push   %eax
+  801c36:	56                   	push   %esi
+  801c37:	e8 1a 1e 00 00       	call   803a56 <strcmp>
+  801c3c:	81 c6 00 01 00 00    	add    $0x100,%esi
+  801c42:	83 c4 10             	add    $0x10,%esp
+  801c45:	85 c0                	test   %eax,%eax
+  801c47:	75 d5                	jne    801c1e <walk_path+0x128>
+  801c49:	8b 9d 48 ff ff ff    	mov    -0xb8(%ebp),%ebx
+  801c4f:	8b 95 50 ff ff ff    	mov    -0xb0(%ebp),%edx
+  801c55:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  801c5b:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+  801c61:	89 d8                	mov    %ebx,%eax
+	while (*path != '\0') {
+  801c63:	80 38 00             	cmpb   $0x0,(%eax)
+  801c66:	0f 84 8c 03 00 00    	je     801ff8 <walk_path+0x502>
+  801c6c:	89 c3                	mov    %eax,%ebx
+		while (*path != '/' && *path != '\0')
+  801c6e:	0f b6 0b             	movzbl (%ebx),%ecx
+  801c71:	80 f9 2f             	cmp    $0x2f,%cl
+  801c74:	0f 95 c2             	setne  %dl
+  801c77:	84 c9                	test   %cl,%cl
+  801c79:	0f 95 c1             	setne  %cl
+  801c7c:	20 ca                	and    %cl,%dl
+  801c7e:	0f 84 cc fe ff ff    	je     801b50 <walk_path+0x5a>
+			path++;
+  801c84:	83 c3 01             	add    $0x1,%ebx
+  801c87:	eb e5                	jmp    801c6e <walk_path+0x178>
+	assert((dir->f_size % BLKSIZE) == 0);
+  801c89:	68 01 82 80 00       	push   $0x808201
+  801c8e:	68 dd 7e 80 00       	push   $0x807edd
+  801c93:	68 38 03 00 00       	push   $0x338
+  801c98:	68 b1 81 80 00       	push   $0x8081b1
+  801c9d:	e8 41 16 00 00       	call   8032e3 <_panic>
+	if (!dirhash_ready)
+  801ca2:	80 3d a4 14 83 00 00 	cmpb   $0x0,0x8314a4
+  801ca9:	74 23                	je     801cce <walk_path+0x1d8>
+	if (!*dirhash_dir_slot(dir) && (r = dirhash_index(dir)) < 0)
+  801cab:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  801cb1:	e8 49 f2 ff ff       	call   800eff <dirhash_dir_slot>
+  801cb6:	89 c2                	mov    %eax,%edx
+  801cb8:	83 38 00             	cmpl   $0x0,(%eax)
+  801cbb:	74 34                	je     801cf1 <walk_path+0x1fb>
+	uint32_t h = (uint32_t) dir;
+  801cbd:	8b bd 50 ff ff ff    	mov    -0xb0(%ebp),%edi
+	while (*name)
+  801cc3:	8d 95 68 ff ff ff    	lea    -0x98(%ebp),%edx
+  801cc9:	e9 2b 02 00 00       	jmp    801ef9 <walk_path+0x403>
+	memset(dirhash_buckets, 0xFF, sizeof(dirhash_buckets));
+  801cce:	83 ec 04             	sub    $0x4,%esp
+  801cd1:	68 00 10 00 00       	push   $0x1000
+  801cd6:	68 ff 00 00 00       	push   $0xff
+  801cdb:	68 c0 18 83 00       	push   $0x8318c0
+  801ce0:	e8 11 1e 00 00       	call   803af6 <memset>
+	dirhash_ready = 1;
+  801ce5:	c6 05 a4 14 83 00 01 	movb   $0x1,0x8314a4
+}
+  801cec:	83 c4 10             	add    $0x10,%esp
+  801cef:	eb ba                	jmp    801cab <walk_path+0x1b5>
+	nblock = dir->f_size / BLKSIZE;
+  801cf1:	8b b5 50 ff ff ff    	mov    -0xb0(%ebp),%esi
+  801cf7:	8b 8e 80 00 00 00    	mov    0x80(%esi),%ecx
+  801cfd:	8d 81 ff 0f 00 00    	lea    0xfff(%ecx),%eax
+  801d03:	85 c9                	test   %ecx,%ecx
+  801d05:	0f 49 c1             	cmovns %ecx,%eax
+  801d08:	c1 f8 0c             	sar    $0xc,%eax
+  801d0b:	89 c1                	mov    %eax,%ecx
+  801d0d:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%ebp)
+	if (dirhash_ndirs + 1 >= DIRHASH_NDIRS
+  801d13:	a1 a8 14 83 00       	mov    0x8314a8,%eax
+  801d18:	83 c0 01             	add    $0x1,%eax
+  801d1b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801d20:	0f 87 92 fe ff ff    	ja     801bb8 <walk_path+0xc2>
+	    || dirhash_nentries + nblock * BLKFILES > DIRHASH_NENTRIES)
+  801d26:	8b 3d c0 28 83 00    	mov    0x8328c0,%edi
+  801d2c:	89 c8                	mov    %ecx,%eax
+  801d2e:	c1 e0 04             	shl    $0x4,%eax
+  801d31:	01 f8                	add    %edi,%eax
+  801d33:	3d 00 20 00 00       	cmp    $0x2000,%eax
+  801d38:	0f 87 7a fe ff ff    	ja     801bb8 <walk_path+0xc2>
+	for (i = 0; i < nblock; i++) {
+  801d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+	uint32_t h = (uint32_t) dir;
+  801d43:	89 b5 48 ff ff ff    	mov    %esi,-0xb8(%ebp)
+  801d49:	89 9d 30 ff ff ff    	mov    %ebx,-0xd0(%ebp)
+  801d4f:	89 95 2c ff ff ff    	mov    %edx,-0xd4(%ebp)
+  801d55:	89 bd 28 ff ff ff    	mov    %edi,-0xd8(%ebp)
+  801d5b:	89 c3                	mov    %eax,%ebx
+  801d5d:	e9 13 01 00 00       	jmp    801e75 <walk_path+0x37f>
+  801d62:	8b 9d 30 ff ff ff    	mov    -0xd0(%ebp),%ebx
+  801d68:	8b bd 28 ff ff ff    	mov    -0xd8(%ebp),%edi
+  801d6e:	89 c6                	mov    %eax,%esi
+  801d70:	a1 c0 28 83 00       	mov    0x8328c0,%eax
+  801d75:	eb 28                	jmp    801d9f <walk_path+0x2a9>
+				e = &dirhash_entries[--dirhash_nentries];
+  801d77:	83 e8 01             	sub    $0x1,%eax
+				dirhash_buckets[e->dh_hash & (DIRHASH_NBUCKETS - 1)] = e->dh_next;
+  801d7a:	89 c1                	mov    %eax,%ecx
+  801d7c:	c1 e1 04             	shl    $0x4,%ecx
+  801d7f:	8b 91 e8 28 83 00    	mov    0x8328e8(%ecx),%edx
+  801d85:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  801d8b:	8b 89 ec 28 83 00    	mov    0x8328ec(%ecx),%ecx
+  801d91:	89 0c 95 c0 18 83 00 	mov    %ecx,0x8318c0(,%edx,4)
+  801d98:	c6 85 47 ff ff ff 01 	movb   $0x1,-0xb9(%ebp)
+			while (dirhash_nentries > start) {
+  801d9f:	39 c7                	cmp    %eax,%edi
+  801da1:	72 d4                	jb     801d77 <walk_path+0x281>
+  801da3:	80 bd 47 ff ff ff 00 	cmpb   $0x0,-0xb9(%ebp)
+  801daa:	74 05                	je     801db1 <walk_path+0x2bb>
+  801dac:	a3 c0 28 83 00       	mov    %eax,0x8328c0
+	if (name[0] != '\0' && (r = dirhash_lookup(dir, name, file)) != -E_NO_MEM)
+  801db1:	83 fe fc             	cmp    $0xfffffffc,%esi
+  801db4:	0f 84 fe fd ff ff    	je     801bb8 <walk_path+0xc2>
+  801dba:	89 d9                	mov    %ebx,%ecx
+  801dbc:	8b 9d 38 ff ff ff    	mov    -0xc8(%ebp),%ebx
+  801dc2:	e9 f2 01 00 00       	jmp    801fb9 <walk_path+0x4c3>
+		h = h * 33 + (uint8_t) *name++;
+  801dc7:	89 c3                	mov    %eax,%ebx
+  801dc9:	c1 e3 05             	shl    $0x5,%ebx
+  801dcc:	01 d8                	add    %ebx,%eax
+  801dce:	83 c7 01             	add    $0x1,%edi
+  801dd1:	0f b6 d2             	movzbl %dl,%edx
+  801dd4:	01 d0                	add    %edx,%eax
+	while (*name)
+  801dd6:	0f b6 17             	movzbl (%edi),%edx
+  801dd9:	84 d2                	test   %dl,%dl
+  801ddb:	75 ea                	jne    801dc7 <walk_path+0x2d1>
+			e->dh_dir = dir;
+  801ddd:	8b 95 4c ff ff ff    	mov    -0xb4(%ebp),%edx
+  801de3:	8b bd 54 ff ff ff    	mov    -0xac(%ebp),%edi
+  801de9:	c1 e7 04             	shl    $0x4,%edi
+  801dec:	8d 9f e0 28 83 00    	lea    0x8328e0(%edi),%ebx
+  801df2:	89 9d 4c ff ff ff    	mov    %ebx,-0xb4(%ebp)
+  801df8:	8b 9d 50 ff ff ff    	mov    -0xb0(%ebp),%ebx
+  801dfe:	89 9f e0 28 83 00    	mov    %ebx,0x8328e0(%edi)
+			e->dh_file = &f[j];
+  801e04:	8b bd 4c ff ff ff    	mov    -0xb4(%ebp),%edi
+  801e0a:	89 57 04             	mov    %edx,0x4(%edi)
+			e->dh_hash = h;
+  801e0d:	89 47 08             	mov    %eax,0x8(%edi)
+			e->dh_next = dirhash_buckets[h & (DIRHASH_NBUCKETS - 1)];
+  801e10:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801e15:	8b 14 85 c0 18 83 00 	mov    0x8318c0(,%eax,4),%edx
+  801e1c:	89 57 0c             	mov    %edx,0xc(%edi)
+			dirhash_buckets[h & (DIRHASH_NBUCKETS - 1)] = dirhash_nentries++;
+  801e1f:	8b bd 54 ff ff ff    	mov    -0xac(%ebp),%edi
+  801e25:	89 3c 85 c0 18 83 00 	mov    %edi,0x8318c0(,%eax,4)
+  801e2c:	8d 47 01             	lea    0x1(%edi),%eax
+  801e2f:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  801e35:	b8 01 00 00 00       	mov    $0x1,%eax
+		for (j = 0; j < BLKFILES; j++) {
+  801e3a:	81 c6 00 01 00 00    	add    $0x100,%esi
+  801e40:	39 f1                	cmp    %esi,%ecx
+  801e42:	74 18                	je     801e5c <walk_path+0x366>
+			if (f[j].f_name[0] == '\0')
+  801e44:	80 3e 00             	cmpb   $0x0,(%esi)
+  801e47:	74 f1                	je     801e3a <walk_path+0x344>
+	uint32_t h = (uint32_t) dir;
+  801e49:	8b 85 48 ff ff ff    	mov    -0xb8(%ebp),%eax
+	while (*name)
+  801e4f:	89 f7                	mov    %esi,%edi
+  801e51:	89 b5 4c ff ff ff    	mov    %esi,-0xb4(%ebp)
+  801e57:	e9 7a ff ff ff       	jmp    801dd6 <walk_path+0x2e0>
+  801e5c:	8b 9d 40 ff ff ff    	mov    -0xc0(%ebp),%ebx
+  801e62:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  801e68:	84 c0                	test   %al,%al
+  801e6a:	74 06                	je     801e72 <walk_path+0x37c>
+  801e6c:	89 15 c0 28 83 00    	mov    %edx,0x8328c0
+	for (i = 0; i < nblock; i++) {
+  801e72:	83 c3 01             	add    $0x1,%ebx
+  801e75:	39 9d 3c ff ff ff    	cmp    %ebx,-0xc4(%ebp)
+  801e7b:	74 4d                	je     801eca <walk_path+0x3d4>
+		if ((r = file_get_block(dir, i, &blk)) < 0) {
+  801e7d:	83 ec 04             	sub    $0x4,%esp
+  801e80:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+  801e86:	50                   	push   %eax
+  801e87:	53                   	push   %ebx
+  801e88:	ff b5 50 ff ff ff    	push   -0xb0(%ebp)
+  801e8e:	e8 fd fb ff ff       	call   801a90 <file_get_block>
+  801e93:	83 c4 10             	add    $0x10,%esp
+  801e96:	85 c0                	test   %eax,%eax
+  801e98:	0f 88 c4 fe ff ff    	js     801d62 <walk_path+0x26c>
+		for (j = 0; j < BLKFILES; j++) {
+  801e9e:	8b 15 c0 28 83 00    	mov    0x8328c0,%edx
+  801ea4:	8b b5 64 ff ff ff    	mov    -0x9c(%ebp),%esi
+  801eaa:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+  801eb0:	0f b6 85 47 ff ff ff 	movzbl -0xb9(%ebp),%eax
+  801eb7:	89 9d 40 ff ff ff    	mov    %ebx,-0xc0(%ebp)
+  801ebd:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+  801ec3:	89 f9                	mov    %edi,%ecx
+  801ec5:	e9 76 ff ff ff       	jmp    801e40 <walk_path+0x34a>
+	*slot = dir;
+  801eca:	8b 9d 30 ff ff ff    	mov    -0xd0(%ebp),%ebx
+  801ed0:	8b 95 2c ff ff ff    	mov    -0xd4(%ebp),%edx
+  801ed6:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  801edc:	89 02                	mov    %eax,(%edx)
+	dirhash_ndirs++;
+  801ede:	83 05 a8 14 83 00 01 	addl   $0x1,0x8314a8
+	return 0;
+  801ee5:	e9 d3 fd ff ff       	jmp    801cbd <walk_path+0x1c7>
+		h = h * 33 + (uint8_t) *name++;
+  801eea:	89 f9                	mov    %edi,%ecx
+  801eec:	c1 e1 05             	shl    $0x5,%ecx
+  801eef:	01 cf                	add    %ecx,%edi
+  801ef1:	83 c2 01             	add    $0x1,%edx
+  801ef4:	0f b6 c0             	movzbl %al,%eax
+  801ef7:	01 c7                	add    %eax,%edi
+	while (*name)
+  801ef9:	0f b6 02             	movzbl (%edx),%eax
+  801efc:	84 c0                	test   %al,%al
+  801efe:	75 ea                	jne    801eea <walk_path+0x3f4>
+	for (i = dirhash_buckets[h & (DIRHASH_NBUCKETS - 1)]; i >= 0; i = dirhash_entries[i].dh_next)
+  801f00:	89 f8                	mov    %edi,%eax
+  801f02:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801f07:	8b 34 85 c0 18 83 00 	mov    0x8318c0(,%eax,4),%esi
+  801f0e:	89 9d 54 ff ff ff    	mov    %ebx,-0xac(%ebp)
+  801f14:	8b 9d 50 ff ff ff    	mov    -0xb0(%ebp),%ebx
+  801f1a:	eb 09                	jmp    801f25 <walk_path+0x42f>
+  801f1c:	c1 e6 04             	shl    $0x4,%esi
+  801f1f:	8b b6 ec 28 83 00    	mov    0x8328ec(%esi),%esi
+  801f25:	85 f6                	test   %esi,%esi
+  801f27:	78 55                	js     801f7e <walk_path+0x488>
+		if (dirhash_entries[i].dh_hash == h && dirhash_entries[i].dh_dir == dir
+  801f29:	89 f0                	mov    %esi,%eax
+  801f2b:	c1 e0 04             	shl    $0x4,%eax
+  801f2e:	39 b8 e8 28 83 00    	cmp    %edi,0x8328e8(%eax)
+  801f34:	75 e6                	jne    801f1c <walk_path+0x426>
+  801f36:	89 f0                	mov    %esi,%eax
+  801f38:	c1 e0 04             	shl    $0x4,%eax
+  801f3b:	39 98 e0 28 83 00    	cmp    %ebx,0x8328e0(%eax)
+  801f41:	75 d9                	jne    801f1c <walk_path+0x426>
+		    && strcmp(dirhash_entries[i].dh_file->f_name, name) == 0) {
+  801f43:	83 ec 08             	sub    $0x8,%esp
+  801f46:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  801f4c:	50                   	push   %eax
+  801f4d:	89 f0                	mov    %esi,%eax
+  801f4f:	c1 e0 04             	shl    $0x4,%eax
+  801f52:	ff b0 e4 28 83 00    	push   0x8328e4(%eax)
+  801f58:	e8 f9 1a 00 00       	call   803a56 <strcmp>
+  801f5d:	83 c4 10             	add    $0x10,%esp
+  801f60:	85 c0                	test   %eax,%eax
+  801f62:	75 b8                	jne    801f1c <walk_path+0x426>
+			*file = dirhash_entries[i].dh_file;
+  801f64:	8b 9d 54 ff ff ff    	mov    -0xac(%ebp),%ebx
+  801f6a:	c1 e6 04             	shl    $0x4,%esi
+  801f6d:	8b 86 e4 28 83 00    	mov    0x8328e4(%esi),%eax
+  801f73:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+			return 0;
+  801f79:	e9 d1 fc ff ff       	jmp    801c4f <walk_path+0x159>
+  801f7e:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  801f84:	89 c1                	mov    %eax,%ecx
+  801f86:	8b 9d 38 ff ff ff    	mov    -0xc8(%ebp),%ebx
+	for (i = 0; i < nblock; i++) {
+  801f8c:	be f5 ff ff ff       	mov    $0xfffffff5,%esi
+  801f91:	eb 26                	jmp    801fb9 <walk_path+0x4c3>
+  801f93:	83 c3 01             	add    $0x1,%ebx
+  801f96:	e9 4a fc ff ff       	jmp    801be5 <walk_path+0xef>
+  801f9b:	8b 85 48 ff ff ff    	mov    -0xb8(%ebp),%eax
+  801fa1:	89 c1                	mov    %eax,%ecx
+  801fa3:	8b 9d 38 ff ff ff    	mov    -0xc8(%ebp),%ebx
+  801fa9:	eb e1                	jmp    801f8c <walk_path+0x496>
+  801fab:	8b 8d 48 ff ff ff    	mov    -0xb8(%ebp),%ecx
+  801fb1:	89 c6                	mov    %eax,%esi
+  801fb3:	8b 9d 38 ff ff ff    	mov    -0xc8(%ebp),%ebx
+			return -E_NOT_FOUND;
+
+		if ((r = dir_lookup(dir, name, &f)) < 0) {
+			if (r == -E_NOT_FOUND && *path == '\0') {
+  801fb9:	83 fe f5             	cmp    $0xfffffff5,%esi
+  801fbc:	75 59                	jne    802017 <walk_path+0x521>
+  801fbe:	80 39 00             	cmpb   $0x0,(%ecx)
+  801fc1:	75 54                	jne    802017 <walk_path+0x521>
+				if (pdir)
+  801fc3:	85 db                	test   %ebx,%ebx
+  801fc5:	74 08                	je     801fcf <walk_path+0x4d9>
+					*pdir = dir;
+  801fc7:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  801fcd:	89 03                	mov    %eax,(%ebx)
+				if (lastelem)
+  801fcf:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  801fd3:	74 15                	je     801fea <walk_path+0x4f4>
+					strcpy(lastelem, name);
+  801fd5:	83 ec 08             	sub    $0x8,%esp
+  801fd8:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  801fde:	50                   	push   %eax
+  801fdf:	ff 75 08             	push   0x8(%ebp)
+  801fe2:	e8 be 19 00 00       	call   8039a5 <strcpy>
+  801fe7:	83 c4 10             	add    $0x10,%esp
+				*pf = 0;
+  801fea:	8b 85 34 ff ff ff    	mov    -0xcc(%ebp),%eax
+  801ff0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  801ff6:	eb 1f                	jmp    802017 <walk_path+0x521>
+			}
+			return r;
+		}
+	}
+
+	if (pdir)
+  801ff8:	8b 9d 38 ff ff ff    	mov    -0xc8(%ebp),%ebx
+  801ffe:	85 db                	test   %ebx,%ebx
+  802000:	74 02                	je     802004 <walk_path+0x50e>
+		*pdir = dir;
+  802002:	89 13                	mov    %edx,(%ebx)
+	*pf = f;
+  802004:	8b 85 34 ff ff ff    	mov    -0xcc(%ebp),%eax
+  80200a:	8b 8d 50 ff ff ff    	mov    -0xb0(%ebp),%ecx
+  802010:	89 08                	mov    %ecx,(%eax)
+	return 0;
+  802012:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802017:	89 f0                	mov    %esi,%eax
+  802019:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80201c:	5b                   	pop    %ebx
+  80201d:	5e                   	pop    %esi
+  80201e:	5f                   	pop    %edi
+  80201f:	5d                   	pop    %ebp
+  802020:	c3                   	ret
+			return -E_BAD_PATH;
+  802021:	be f4 ff ff ff       	mov    $0xfffffff4,%esi
+  802026:	eb ef                	jmp    802017 <walk_path+0x521>
+			return -E_NOT_FOUND;
+  802028:	be f5 ff ff ff       	mov    $0xfffffff5,%esi
+  80202d:	eb e8                	jmp    802017 <walk_path+0x521>
+
+0080202f <file_get_blocks>:
+{
+  80202f:	55                   	push   %ebp
+  802030:	89 e5                	mov    %esp,%ebp
+  802032:	57                   	push   %edi
+  802033:	56                   	push   %esi
+  802034:	53                   	push   %ebx
+  802035:	83 ec 20             	sub    $0x20,%esp
+  802038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80203b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80203e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	if ((r = file_get_block(f, filebno, blk)) < 0)
+  802041:	53                   	push   %ebx
+  802042:	57                   	push   %edi
+  802043:	56                   	push   %esi
+  802044:	e8 47 fa ff ff       	call   801a90 <file_get_block>
+  802049:	83 c4 10             	add    $0x10,%esp
+  80204c:	85 c0                	test   %eax,%eax
+  80204e:	78 54                	js     8020a4 <file_get_blocks+0x75>
+		return 1;
+  802050:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (n <= 1 || file_block_walk(f, filebno, &diskbno, &run) < 0 || diskbno == 0)
+  802055:	83 7d 10 01          	cmpl   $0x1,0x10(%ebp)
+  802059:	76 49                	jbe    8020a4 <file_get_blocks+0x75>
+  80205b:	83 ec 0c             	sub    $0xc,%esp
+  80205e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802061:	50                   	push   %eax
+  802062:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  802065:	89 fa                	mov    %edi,%edx
+  802067:	89 f0                	mov    %esi,%eax
+  802069:	e8 55 f2 ff ff       	call   8012c3 <file_block_walk>
+  80206e:	89 c2                	mov    %eax,%edx
+  802070:	83 c4 10             	add    $0x10,%esp
+		return 1;
+  802073:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (n <= 1 || file_block_walk(f, filebno, &diskbno, &run) < 0 || diskbno == 0)
+  802078:	85 d2                	test   %edx,%edx
+  80207a:	78 28                	js     8020a4 <file_get_blocks+0x75>
+  80207c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802080:	74 22                	je     8020a4 <file_get_blocks+0x75>
+	n = MIN(n, run);
+  802082:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802085:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802088:	0f 46 45 10          	cmovbe 0x10(%ebp),%eax
+	for (i = 0; i < n; i++)
+  80208c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802091:	eb 0d                	jmp    8020a0 <file_get_blocks+0x71>
+		(void) *(volatile char*) (*blk + i*BLKSIZE);
+  802093:	89 d1                	mov    %edx,%ecx
+  802095:	c1 e1 0c             	shl    $0xc,%ecx
+  802098:	03 0b                	add    (%ebx),%ecx
+  80209a:	0f b6 09             	movzbl (%ecx),%ecx
+	for (i = 0; i < n; i++)
+  80209d:	83 c2 01             	add    $0x1,%edx
+  8020a0:	39 c2                	cmp    %eax,%edx
+  8020a2:	75 ef                	jne    802093 <file_get_blocks+0x64>
+}
+  8020a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020a7:	5b                   	pop    %ebx
+  8020a8:	5e                   	pop    %esi
+  8020a9:	5f                   	pop    %edi
+  8020aa:	5d                   	pop    %ebp
+  8020ab:	c3                   	ret
+
+008020ac <file_block_is_cached>:
+{
+  8020ac:	55                   	push   %ebp
+  8020ad:	89 e5                	mov    %esp,%ebp
+  8020af:	83 ec 24             	sub    $0x24,%esp
+	if (file_block_walk(f, filebno, &diskbno, 0) < 0 || diskbno == 0)
+  8020b2:	6a 00                	push   $0x0
+  8020b4:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8020b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020bd:	e8 01 f2 ff ff       	call   8012c3 <file_block_walk>
+  8020c2:	89 c2                	mov    %eax,%edx
+  8020c4:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8020c7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (file_block_walk(f, filebno, &diskbno, 0) < 0 || diskbno == 0)
+  8020cc:	85 d2                	test   %edx,%edx
+  8020ce:	78 07                	js     8020d7 <file_block_is_cached+0x2b>
+  8020d0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020d3:	85 d2                	test   %edx,%edx
+  8020d5:	75 02                	jne    8020d9 <file_block_is_cached+0x2d>
+}
+  8020d7:	c9                   	leave
+  8020d8:	c3                   	ret
+	return va_is_mapped((void*) (DISKMAP + diskbno * BLKSIZE));
+  8020d9:	83 ec 0c             	sub    $0xc,%esp
+  8020dc:	81 c2 00 00 01 00    	add    $0x10000,%edx
+  8020e2:	c1 e2 0c             	shl    $0xc,%edx
+  8020e5:	52                   	push   %edx
+  8020e6:	e8 80 e4 ff ff       	call   80056b <va_is_mapped>
+  8020eb:	83 c4 10             	add    $0x10,%esp
+  8020ee:	eb e7                	jmp    8020d7 <file_block_is_cached+0x2b>
+
+008020f0 <file_count_reads>:
+{
+  8020f0:	55                   	push   %ebp
+  8020f1:	89 e5                	mov    %esp,%ebp
+  8020f3:	57                   	push   %edi
+  8020f4:	56                   	push   %esi
+  8020f5:	53                   	push   %ebx
+  8020f6:	83 ec 1c             	sub    $0x1c,%esp
+  8020f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020ff:	8b 45 10             	mov    0x10(%ebp),%eax
+	if (offset >= f->f_size || count == 0)
+  802102:	8b 8f 80 00 00 00    	mov    0x80(%edi),%ecx
+  802108:	85 c0                	test   %eax,%eax
+  80210a:	74 72                	je     80217e <file_count_reads+0x8e>
+  80210c:	39 d1                	cmp    %edx,%ecx
+  80210e:	7e 6e                	jle    80217e <file_count_reads+0x8e>
+	end = ROUNDUP(MIN(offset + count, f->f_size), BLKSIZE) / BLKSIZE;
+  802110:	01 d0                	add    %edx,%eax
+  802112:	39 c8                	cmp    %ecx,%eax
+  802114:	0f 47 c1             	cmova  %ecx,%eax
+  802117:	8d b0 ff 0f 00 00    	lea    0xfff(%eax),%esi
+  80211d:	c1 ee 0c             	shr    $0xc,%esi
+	for (filebno = offset / BLKSIZE; filebno < end; filebno++) {
+  802120:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802126:	85 d2                	test   %edx,%edx
+  802128:	0f 49 da             	cmovns %edx,%ebx
+  80212b:	c1 fb 0c             	sar    $0xc,%ebx
+  80212e:	eb 0a                	jmp    80213a <file_count_reads+0x4a>
+			bc_stats.ret_misses++;
+  802130:	83 05 28 a9 85 00 01 	addl   $0x1,0x85a928
+	for (filebno = offset / BLKSIZE; filebno < end; filebno++) {
+  802137:	83 c3 01             	add    $0x1,%ebx
+  80213a:	39 f3                	cmp    %esi,%ebx
+  80213c:	73 40                	jae    80217e <file_count_reads+0x8e>
+		if (file_block_walk(f, filebno, &diskbno, 0) < 0 || diskbno == 0)
+  80213e:	83 ec 0c             	sub    $0xc,%esp
+  802141:	6a 00                	push   $0x0
+  802143:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  802146:	89 da                	mov    %ebx,%edx
+  802148:	89 f8                	mov    %edi,%eax
+  80214a:	e8 74 f1 ff ff       	call   8012c3 <file_block_walk>
+  80214f:	83 c4 10             	add    $0x10,%esp
+  802152:	85 c0                	test   %eax,%eax
+  802154:	78 e1                	js     802137 <file_count_reads+0x47>
+  802156:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802159:	85 c0                	test   %eax,%eax
+  80215b:	74 da                	je     802137 <file_count_reads+0x47>
+		if (va_is_mapped((void*) (DISKMAP + diskbno * BLKSIZE)))
+  80215d:	83 ec 0c             	sub    $0xc,%esp
+  802160:	05 00 00 01 00       	add    $0x10000,%eax
+  802165:	c1 e0 0c             	shl    $0xc,%eax
+  802168:	50                   	push   %eax
+  802169:	e8 fd e3 ff ff       	call   80056b <va_is_mapped>
+  80216e:	83 c4 10             	add    $0x10,%esp
+  802171:	84 c0                	test   %al,%al
+  802173:	74 bb                	je     802130 <file_count_reads+0x40>
+			bc_stats.ret_hits++;
+  802175:	83 05 24 a9 85 00 01 	addl   $0x1,0x85a924
+  80217c:	eb b9                	jmp    802137 <file_count_reads+0x47>
+}
+  80217e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802181:	5b                   	pop    %ebx
+  802182:	5e                   	pop    %esi
+  802183:	5f                   	pop    %edi
+  802184:	5d                   	pop    %ebp
+  802185:	c3                   	ret
+
+00802186 <file_readahead>:
+{
+  802186:	55                   	push   %ebp
+  802187:	89 e5                	mov    %esp,%ebp
+  802189:	57                   	push   %edi
+  80218a:	56                   	push   %esi
+  80218b:	53                   	push   %ebx
+  80218c:	83 ec 2c             	sub    $0x2c,%esp
+  80218f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	end = MIN(filebno + nblocks, ROUNDUP(f->f_size, BLKSIZE) / BLKSIZE);
+  802192:	8b 45 08             	mov    0x8(%ebp),%eax
+  802195:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  80219b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80219e:	8d b8 ff 0f 00 00    	lea    0xfff(%eax),%edi
+  8021a4:	c1 ff 0c             	sar    $0xc,%edi
+  8021a7:	89 f0                	mov    %esi,%eax
+  8021a9:	03 45 10             	add    0x10(%ebp),%eax
+  8021ac:	39 c7                	cmp    %eax,%edi
+  8021ae:	0f 47 f8             	cmova  %eax,%edi
+	while (filebno < end) {
+  8021b1:	eb 28                	jmp    8021db <file_readahead+0x55>
+		run = MIN(MIN(run, end - filebno), BC_MAX_READAHEAD);
+  8021b3:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8021b6:	ba 20 00 00 00       	mov    $0x20,%edx
+  8021bb:	39 d3                	cmp    %edx,%ebx
+  8021bd:	0f 47 da             	cmova  %edx,%ebx
+  8021c0:	89 fa                	mov    %edi,%edx
+  8021c2:	29 f2                	sub    %esi,%edx
+  8021c4:	39 d3                	cmp    %edx,%ebx
+  8021c6:	0f 47 da             	cmova  %edx,%ebx
+  8021c9:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+		bc_read_ahead(diskbno, run);
+  8021cc:	83 ec 08             	sub    $0x8,%esp
+  8021cf:	53                   	push   %ebx
+  8021d0:	50                   	push   %eax
+  8021d1:	e8 55 e7 ff ff       	call   80092b <bc_read_ahead>
+		filebno += run;
+  8021d6:	01 de                	add    %ebx,%esi
+  8021d8:	83 c4 10             	add    $0x10,%esp
+	while (filebno < end) {
+  8021db:	39 fe                	cmp    %edi,%esi
+  8021dd:	73 22                	jae    802201 <file_readahead+0x7b>
+		if (file_block_walk(f, filebno, &diskbno, &run) < 0 || diskbno == 0)
+  8021df:	83 ec 0c             	sub    $0xc,%esp
+  8021e2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8021e5:	50                   	push   %eax
+  8021e6:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  8021e9:	89 f2                	mov    %esi,%edx
+  8021eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ee:	e8 d0 f0 ff ff       	call   8012c3 <file_block_walk>
+  8021f3:	83 c4 10             	add    $0x10,%esp
+  8021f6:	85 c0                	test   %eax,%eax
+  8021f8:	78 07                	js     802201 <file_readahead+0x7b>
+  8021fa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8021fd:	85 c0                	test   %eax,%eax
+  8021ff:	75 b2                	jne    8021b3 <file_readahead+0x2d>
+}
+  802201:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802204:	5b                   	pop    %ebx
+  802205:	5e                   	pop    %esi
+  802206:	5f                   	pop    %edi
+  802207:	5d                   	pop    %ebp
+  802208:	c3                   	ret
+
+00802209 <file_open>:
+
+// Open "path".  On success set *pf to point at the file and return 0.
+// On error return < 0.
+int
+file_open(const char *path, struct File **pf)
+{
+  802209:	55                   	push   %ebp
+  80220a:	89 e5                	mov    %esp,%ebp
+  80220c:	83 ec 14             	sub    $0x14,%esp
+	return walk_path(path, 0, pf, 0);
+  80220f:	6a 00                	push   $0x0
+  802211:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802214:	ba 00 00 00 00       	mov    $0x0,%edx
+  802219:	8b 45 08             	mov    0x8(%ebp),%eax
+  80221c:	e8 d5 f8 ff ff       	call   801af6 <walk_path>
+}
+  802221:	c9                   	leave
+  802222:	c3                   	ret
+
+00802223 <file_read>:
+// Read count bytes from f into buf, starting from seek position
+// offset.  This meant to mimic the standard pread function.
+// Returns the number of bytes read, < 0 on error.
+ssize_t
+file_read(struct File *f, void *buf, size_t count, off_t offset)
+{
+  802223:	55                   	push   %ebp
+  802224:	89 e5                	mov    %esp,%ebp
+  802226:	57                   	push   %edi
+  802227:	56                   	push   %esi
+  802228:	53                   	push   %ebx
+  802229:	83 ec 2c             	sub    $0x2c,%esp
+  80222c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80222f:	8b 4d 14             	mov    0x14(%ebp),%ecx
+	int r, bn;
+	off_t pos;
+	char *blk;
+
+	if (offset >= f->f_size)
+  802232:	8b 45 08             	mov    0x8(%ebp),%eax
+  802235:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+		return 0;
+  80223b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (offset >= f->f_size)
+  802240:	39 ca                	cmp    %ecx,%edx
+  802242:	0f 8e 9b 00 00 00    	jle    8022e3 <file_read+0xc0>
+
+	count = MIN(count, f->f_size - offset);
+  802248:	29 ca                	sub    %ecx,%edx
+  80224a:	39 da                	cmp    %ebx,%edx
+  80224c:	0f 46 da             	cmovbe %edx,%ebx
+  80224f:	89 de                	mov    %ebx,%esi
+
+	for (pos = offset; pos < offset + count; ) {
+  802251:	89 cb                	mov    %ecx,%ebx
+  802253:	8d 04 31             	lea    (%ecx,%esi,1),%eax
+  802256:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802259:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  80225c:	eb 16                	jmp    802274 <file_read+0x51>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+		// Blocks that have never been written read as zeros
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) == -E_NOT_FOUND)
+			memset(buf, 0, bn);
+  80225e:	83 ec 04             	sub    $0x4,%esp
+  802261:	57                   	push   %edi
+  802262:	6a 00                	push   $0x0
+  802264:	ff 75 0c             	push   0xc(%ebp)
+  802267:	e8 8a 18 00 00       	call   803af6 <memset>
+  80226c:	83 c4 10             	add    $0x10,%esp
+		else if (r < 0)
+			return r;
+		else
+			memmove(buf, blk + pos % BLKSIZE, bn);
+		pos += bn;
+  80226f:	01 fb                	add    %edi,%ebx
+		buf += bn;
+  802271:	01 7d 0c             	add    %edi,0xc(%ebp)
+	for (pos = offset; pos < offset + count; ) {
+  802274:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802277:	39 c3                	cmp    %eax,%ebx
+  802279:	73 63                	jae    8022de <file_read+0xbb>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  80227b:	89 d8                	mov    %ebx,%eax
+  80227d:	c1 f8 1f             	sar    $0x1f,%eax
+  802280:	c1 e8 14             	shr    $0x14,%eax
+  802283:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+  802286:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80228c:	29 c6                	sub    %eax,%esi
+  80228e:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802293:	29 f7                	sub    %esi,%edi
+  802295:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802298:	29 d8                	sub    %ebx,%eax
+  80229a:	39 c7                	cmp    %eax,%edi
+  80229c:	0f 47 f8             	cmova  %eax,%edi
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) == -E_NOT_FOUND)
+  80229f:	83 ec 04             	sub    $0x4,%esp
+  8022a2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8022a5:	50                   	push   %eax
+  8022a6:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  8022ac:	85 db                	test   %ebx,%ebx
+  8022ae:	0f 49 c3             	cmovns %ebx,%eax
+  8022b1:	c1 f8 0c             	sar    $0xc,%eax
+  8022b4:	50                   	push   %eax
+  8022b5:	ff 75 08             	push   0x8(%ebp)
+  8022b8:	e8 d3 f7 ff ff       	call   801a90 <file_get_block>
+  8022bd:	83 c4 10             	add    $0x10,%esp
+  8022c0:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8022c3:	74 99                	je     80225e <file_read+0x3b>
+		else if (r < 0)
+  8022c5:	85 c0                	test   %eax,%eax
+  8022c7:	78 1a                	js     8022e3 <file_read+0xc0>
+			memmove(buf, blk + pos % BLKSIZE, bn);
+  8022c9:	83 ec 04             	sub    $0x4,%esp
+  8022cc:	57                   	push   %edi
+  8022cd:	03 75 e4             	add    -0x1c(%ebp),%esi
+  8022d0:	56                   	push   %esi
+  8022d1:	ff 75 0c             	push   0xc(%ebp)
+  8022d4:	e8 52 18 00 00       	call   803b2b <memmove>
+  8022d9:	83 c4 10             	add    $0x10,%esp
+  8022dc:	eb 91                	jmp    80226f <file_read+0x4c>
+	}
+
+	return count;
+  8022de:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8022e1:	89 f0                	mov    %esi,%eax
+}
+  8022e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022e6:	5b                   	pop    %ebx
+  8022e7:	5e                   	pop    %esi
+  8022e8:	5f                   	pop    %edi
+  8022e9:	5d                   	pop    %ebp
+  8022ea:	c3                   	ret
+
+008022eb <file_set_size>:
+// Set the size of file f, truncating or extending as necessary.
+// New blocks at the end aren't given a place on disk until they're
+// written and flushed.
+int
+file_set_size(struct File *f, off_t newsize)
+{
+  8022eb:	55                   	push   %ebp
+  8022ec:	89 e5                	mov    %esp,%ebp
+  8022ee:	57                   	push   %edi
+  8022ef:	56                   	push   %esi
+  8022f0:	53                   	push   %ebx
+  8022f1:	83 ec 2c             	sub    $0x2c,%esp
+  8022f4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uint32_t oldn, newn;
+	char *blk;
+	int r;
+
+	if (newsize < 0 || newsize > MAXFILESIZE)
+  8022f7:	81 7d 0c 00 00 00 40 	cmpl   $0x40000000,0xc(%ebp)
+  8022fe:	0f 87 37 02 00 00    	ja     80253b <file_set_size+0x250>
+	if ((void*) f >= (void*) DISKMAP && (void*) f < (void*) (DISKMAP + DISKSIZE))
+  802304:	8d 87 00 00 00 f0    	lea    -0x10000000(%edi),%eax
+  80230a:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  80230f:	76 68                	jbe    802379 <file_set_size+0x8e>
+		return -E_INVAL;
+	if ((r = file_make_private(f)) < 0)
+		return r;
+
+	oldn = ROUNDUP(f->f_size, BLKSIZE) / BLKSIZE;
+  802311:	8b 87 80 00 00 00    	mov    0x80(%edi),%eax
+  802317:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+  80231d:	c1 fb 0c             	sar    $0xc,%ebx
+	newn = ROUNDUP(newsize, BLKSIZE) / BLKSIZE;
+  802320:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802323:	81 c2 ff 0f 00 00    	add    $0xfff,%edx
+  802329:	c1 fa 0c             	sar    $0xc,%edx
+  80232c:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	if (f->f_type == FTYPE_DIR && newsize < f->f_size)
+  80232f:	83 bf 84 00 00 00 01 	cmpl   $0x1,0x84(%edi)
+  802336:	75 05                	jne    80233d <file_set_size+0x52>
+  802338:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80233b:	7f 4e                	jg     80238b <file_set_size+0xa0>
+		dirhash_evict(f);
+	if (newn < oldn)
+  80233d:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+  802340:	72 52                	jb     802394 <file_set_size+0xa9>
+		file_truncate_blocks(f, newn);
+	else if (newn > oldn && (r = file_add_hole(f, newn - oldn)) < 0)
+  802342:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802345:	39 c3                	cmp    %eax,%ebx
+  802347:	0f 82 28 01 00 00    	jb     802475 <file_set_size+0x18a>
+		return r;
+
+	// Zero what's left of the last block past the end, so that it
+	// reads as zeros if the file grows again.
+	if (newsize < f->f_size && newsize % BLKSIZE
+  80234d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802350:	39 87 80 00 00 00    	cmp    %eax,0x80(%edi)
+  802356:	7e 0b                	jle    802363 <file_set_size+0x78>
+  802358:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80235d:	0f 85 63 01 00 00    	jne    8024c6 <file_set_size+0x1db>
+	    && file_get_block(f, newsize / BLKSIZE, &blk) == 0
+	    && bc_make_private(blk) == 0)
+		memset(blk + newsize % BLKSIZE, 0, BLKSIZE - newsize % BLKSIZE);
+
+	f->f_size = newsize;
+  802363:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802366:	89 87 80 00 00 00    	mov    %eax,0x80(%edi)
+	return 0;
+  80236c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802371:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802374:	5b                   	pop    %ebx
+  802375:	5e                   	pop    %esi
+  802376:	5f                   	pop    %edi
+  802377:	5d                   	pop    %ebp
+  802378:	c3                   	ret
+		return bc_make_private(f);
+  802379:	83 ec 0c             	sub    $0xc,%esp
+  80237c:	57                   	push   %edi
+  80237d:	e8 28 ea ff ff       	call   800daa <bc_make_private>
+	if ((r = file_make_private(f)) < 0)
+  802382:	83 c4 10             	add    $0x10,%esp
+  802385:	85 c0                	test   %eax,%eax
+  802387:	78 e8                	js     802371 <file_set_size+0x86>
+  802389:	eb 86                	jmp    802311 <file_set_size+0x26>
+		dirhash_evict(f);
+  80238b:	89 f8                	mov    %edi,%eax
+  80238d:	e8 8f eb ff ff       	call   800f21 <dirhash_evict>
+  802392:	eb a9                	jmp    80233d <file_set_size+0x52>
+	n = file_nextents(f);
+  802394:	89 f8                	mov    %edi,%eax
+  802396:	e8 b9 ef ff ff       	call   801354 <file_nextents>
+  80239b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	for (i = pos = 0; i < n; i++) {
+  80239e:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8023a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023aa:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8023ad:	89 c7                	mov    %eax,%edi
+  8023af:	e9 bb 01 00 00       	jmp    80256f <file_set_size+0x284>
+		keep = pos < nblocks ? MIN(e->e_len, nblocks - pos) : 0;
+  8023b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b9:	89 c6                	mov    %eax,%esi
+  8023bb:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8023be:	eb 13                	jmp    8023d3 <file_set_size+0xe8>
+				free_block(e->e_start + j);
+  8023c0:	83 ec 0c             	sub    $0xc,%esp
+  8023c3:	89 f0                	mov    %esi,%eax
+  8023c5:	03 03                	add    (%ebx),%eax
+  8023c7:	50                   	push   %eax
+  8023c8:	e8 14 ee ff ff       	call   8011e1 <free_block>
+			for (j = keep; j < e->e_len; j++)
+  8023cd:	83 c6 01             	add    $0x1,%esi
+  8023d0:	83 c4 10             	add    $0x10,%esp
+  8023d3:	3b 73 04             	cmp    0x4(%ebx),%esi
+  8023d6:	72 e8                	jb     8023c0 <file_set_size+0xd5>
+  8023d8:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8023db:	e9 cb 01 00 00       	jmp    8025ab <file_set_size+0x2c0>
+	if (f->f_indirect && file_nextents(f) <= NEXTENT) {
+  8023e0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023e3:	83 bf f8 00 00 00 00 	cmpl   $0x0,0xf8(%edi)
+  8023ea:	75 0c                	jne    8023f8 <file_set_size+0x10d>
+  8023ec:	bb 00 2d 85 00       	mov    $0x852d00,%ebx
+	for (i = pos = 0; i < n; i++) {
+  8023f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f6:	eb 3b                	jmp    802433 <file_set_size+0x148>
+	if (f->f_indirect && file_nextents(f) <= NEXTENT) {
+  8023f8:	89 f8                	mov    %edi,%eax
+  8023fa:	e8 55 ef ff ff       	call   801354 <file_nextents>
+  8023ff:	83 f8 0e             	cmp    $0xe,%eax
+  802402:	77 e8                	ja     8023ec <file_set_size+0x101>
+		free_block(f->f_indirect);
+  802404:	83 ec 0c             	sub    $0xc,%esp
+  802407:	ff b7 f8 00 00 00    	push   0xf8(%edi)
+  80240d:	e8 cf ed ff ff       	call   8011e1 <free_block>
+		f->f_indirect = 0;
+  802412:	c7 87 f8 00 00 00 00 	movl   $0x0,0xf8(%edi)
+  802419:	00 00 00 
+  80241c:	83 c4 10             	add    $0x10,%esp
+  80241f:	eb cb                	jmp    8023ec <file_set_size+0x101>
+	for (i = 0; i < NPENDING && npending > 0; i++)
+  802421:	83 c6 01             	add    $0x1,%esi
+  802424:	83 c3 0c             	add    $0xc,%ebx
+  802427:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+  80242d:	0f 84 1a ff ff ff    	je     80234d <file_set_size+0x62>
+  802433:	83 3d e0 28 85 00 00 	cmpl   $0x0,0x8528e0
+  80243a:	0f 84 0d ff ff ff    	je     80234d <file_set_size+0x62>
+		if (pendtab[i].p_file == f && pendtab[i].p_filebno >= filebno) {
+  802440:	3b 3b                	cmp    (%ebx),%edi
+  802442:	75 dd                	jne    802421 <file_set_size+0x136>
+  802444:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802447:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80244a:	72 d5                	jb     802421 <file_set_size+0x136>
+			(void) *(volatile char*) PENDADDR(i);
+  80244c:	89 f0                	mov    %esi,%eax
+  80244e:	c1 e0 0c             	shl    $0xc,%eax
+  802451:	8d 90 00 00 00 e0    	lea    -0x20000000(%eax),%edx
+  802457:	0f b6 80 00 00 00 e0 	movzbl -0x20000000(%eax),%eax
+			sys_page_unmap(0, PENDADDR(i));
+  80245e:	83 ec 08             	sub    $0x8,%esp
+  802461:	52                   	push   %edx
+  802462:	6a 00                	push   $0x0
+  802464:	e8 b4 1a 00 00       	call   803f1d <sys_page_unmap>
+			pend_unlink(i);
+  802469:	89 f0                	mov    %esi,%eax
+  80246b:	e8 5f eb ff ff       	call   800fcf <pend_unlink>
+  802470:	83 c4 10             	add    $0x10,%esp
+  802473:	eb ac                	jmp    802421 <file_set_size+0x136>
+	else if (newn > oldn && (r = file_add_hole(f, newn - oldn)) < 0)
+  802475:	89 c6                	mov    %eax,%esi
+  802477:	29 de                	sub    %ebx,%esi
+	uint32_t next = file_nextents(f);
+  802479:	89 f8                	mov    %edi,%eax
+  80247b:	e8 d4 ee ff ff       	call   801354 <file_nextents>
+  802480:	89 c3                	mov    %eax,%ebx
+	if (next > 0 && (e = file_extent(f, next - 1, 0))->e_start == 0) {
+  802482:	85 c0                	test   %eax,%eax
+  802484:	74 14                	je     80249a <file_set_size+0x1af>
+  802486:	8d 50 ff             	lea    -0x1(%eax),%edx
+  802489:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80248e:	89 f8                	mov    %edi,%eax
+  802490:	e8 c6 ed ff ff       	call   80125b <file_extent>
+  802495:	83 38 00             	cmpl   $0x0,(%eax)
+  802498:	74 24                	je     8024be <file_set_size+0x1d3>
+	if (!(e = file_extent(f, next, 1)))
+  80249a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80249f:	89 da                	mov    %ebx,%edx
+  8024a1:	89 f8                	mov    %edi,%eax
+  8024a3:	e8 b3 ed ff ff       	call   80125b <file_extent>
+  8024a8:	85 c0                	test   %eax,%eax
+  8024aa:	0f 84 95 00 00 00    	je     802545 <file_set_size+0x25a>
+	e->e_start = 0;
+  8024b0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	e->e_len = n;
+  8024b6:	89 70 04             	mov    %esi,0x4(%eax)
+	return 0;
+  8024b9:	e9 8f fe ff ff       	jmp    80234d <file_set_size+0x62>
+		e->e_len += n;
+  8024be:	01 70 04             	add    %esi,0x4(%eax)
+		return 0;
+  8024c1:	e9 87 fe ff ff       	jmp    80234d <file_set_size+0x62>
+	    && file_get_block(f, newsize / BLKSIZE, &blk) == 0
+  8024c6:	83 ec 04             	sub    $0x4,%esp
+  8024c9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8024cc:	50                   	push   %eax
+  8024cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024d0:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8024d5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8024d9:	0f 49 45 0c          	cmovns 0xc(%ebp),%eax
+  8024dd:	c1 f8 0c             	sar    $0xc,%eax
+  8024e0:	50                   	push   %eax
+  8024e1:	57                   	push   %edi
+  8024e2:	e8 a9 f5 ff ff       	call   801a90 <file_get_block>
+  8024e7:	83 c4 10             	add    $0x10,%esp
+  8024ea:	85 c0                	test   %eax,%eax
+  8024ec:	0f 85 71 fe ff ff    	jne    802363 <file_set_size+0x78>
+	    && bc_make_private(blk) == 0)
+  8024f2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8024f5:	83 ec 0c             	sub    $0xc,%esp
+  8024f8:	53                   	push   %ebx
+  8024f9:	e8 ac e8 ff ff       	call   800daa <bc_make_private>
+  8024fe:	83 c4 10             	add    $0x10,%esp
+  802501:	85 c0                	test   %eax,%eax
+  802503:	0f 85 5a fe ff ff    	jne    802363 <file_set_size+0x78>
+		memset(blk + newsize % BLKSIZE, 0, BLKSIZE - newsize % BLKSIZE);
+  802509:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80250c:	c1 fa 1f             	sar    $0x1f,%edx
+  80250f:	c1 ea 14             	shr    $0x14,%edx
+  802512:	89 d0                	mov    %edx,%eax
+  802514:	03 45 0c             	add    0xc(%ebp),%eax
+  802517:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80251c:	29 d0                	sub    %edx,%eax
+  80251e:	83 ec 04             	sub    $0x4,%esp
+  802521:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802526:	29 c2                	sub    %eax,%edx
+  802528:	52                   	push   %edx
+  802529:	6a 00                	push   $0x0
+  80252b:	01 c3                	add    %eax,%ebx
+  80252d:	53                   	push   %ebx
+  80252e:	e8 c3 15 00 00       	call   803af6 <memset>
+  802533:	83 c4 10             	add    $0x10,%esp
+  802536:	e9 28 fe ff ff       	jmp    802363 <file_set_size+0x78>
+		return -E_INVAL;
+  80253b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802540:	e9 2c fe ff ff       	jmp    802371 <file_set_size+0x86>
+		return -E_NO_DISK;
+  802545:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80254a:	e9 22 fe ff ff       	jmp    802371 <file_set_size+0x86>
+		pos += e->e_len;
+  80254f:	8b 53 04             	mov    0x4(%ebx),%edx
+  802552:	01 55 d0             	add    %edx,-0x30(%ebp)
+		if (e->e_start)
+  802555:	83 3b 00             	cmpl   $0x0,(%ebx)
+  802558:	0f 85 56 fe ff ff    	jne    8023b4 <file_set_size+0xc9>
+			e->e_start = 0;
+  80255e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802564:	b8 00 00 00 00       	mov    $0x0,%eax
+		e->e_len = keep;
+  802569:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = pos = 0; i < n; i++) {
+  80256c:	83 c7 01             	add    $0x1,%edi
+  80256f:	39 7d cc             	cmp    %edi,-0x34(%ebp)
+  802572:	0f 84 68 fe ff ff    	je     8023e0 <file_set_size+0xf5>
+		e = file_extent(f, i, 0);
+  802578:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80257d:	89 fa                	mov    %edi,%edx
+  80257f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802582:	e8 d4 ec ff ff       	call   80125b <file_extent>
+  802587:	89 c3                	mov    %eax,%ebx
+		keep = pos < nblocks ? MIN(e->e_len, nblocks - pos) : 0;
+  802589:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80258c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80258f:	39 c1                	cmp    %eax,%ecx
+  802591:	73 bc                	jae    80254f <file_set_size+0x264>
+  802593:	8b 53 04             	mov    0x4(%ebx),%edx
+  802596:	29 c8                	sub    %ecx,%eax
+  802598:	39 d0                	cmp    %edx,%eax
+  80259a:	0f 47 c2             	cmova  %edx,%eax
+		pos += e->e_len;
+  80259d:	01 d1                	add    %edx,%ecx
+  80259f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		if (e->e_start)
+  8025a2:	83 3b 00             	cmpl   $0x0,(%ebx)
+  8025a5:	0f 85 0e fe ff ff    	jne    8023b9 <file_set_size+0xce>
+		if (keep == 0)
+  8025ab:	85 c0                	test   %eax,%eax
+  8025ad:	75 ba                	jne    802569 <file_set_size+0x27e>
+  8025af:	eb ad                	jmp    80255e <file_set_size+0x273>
+
+008025b1 <file_create>:
+{
+  8025b1:	55                   	push   %ebp
+  8025b2:	89 e5                	mov    %esp,%ebp
+  8025b4:	57                   	push   %edi
+  8025b5:	56                   	push   %esi
+  8025b6:	53                   	push   %ebx
+  8025b7:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+	if ((r = walk_path(path, &dir, &f, name)) == 0)
+  8025bd:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8025c3:	50                   	push   %eax
+  8025c4:	8d 8d 60 ff ff ff    	lea    -0xa0(%ebp),%ecx
+  8025ca:	8d 95 64 ff ff ff    	lea    -0x9c(%ebp),%edx
+  8025d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025d3:	e8 1e f5 ff ff       	call   801af6 <walk_path>
+  8025d8:	83 c4 10             	add    $0x10,%esp
+  8025db:	85 c0                	test   %eax,%eax
+  8025dd:	0f 84 7c 02 00 00    	je     80285f <file_create+0x2ae>
+  8025e3:	89 c3                	mov    %eax,%ebx
+	if (r != -E_NOT_FOUND || dir == 0)
+  8025e5:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8025e8:	0f 85 07 01 00 00    	jne    8026f5 <file_create+0x144>
+  8025ee:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+  8025f4:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  8025fa:	85 c0                	test   %eax,%eax
+  8025fc:	0f 84 f3 00 00 00    	je     8026f5 <file_create+0x144>
+	assert((dir->f_size % BLKSIZE) == 0);
+  802602:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802608:	89 c3                	mov    %eax,%ebx
+  80260a:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802610:	75 69                	jne    80267b <file_create+0xca>
+	nblock = dir->f_size / BLKSIZE;
+  802612:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  802618:	85 c0                	test   %eax,%eax
+  80261a:	0f 48 c2             	cmovs  %edx,%eax
+  80261d:	c1 f8 0c             	sar    $0xc,%eax
+  802620:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+	for (i = 0; i < nblock; i++) {
+  802626:	be 00 00 00 00       	mov    $0x0,%esi
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  80262b:	8d bd 5c ff ff ff    	lea    -0xa4(%ebp),%edi
+	for (i = 0; i < nblock; i++) {
+  802631:	39 b5 50 ff ff ff    	cmp    %esi,-0xb0(%ebp)
+  802637:	0f 84 ca 00 00 00    	je     802707 <file_create+0x156>
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  80263d:	83 ec 04             	sub    $0x4,%esp
+  802640:	57                   	push   %edi
+  802641:	56                   	push   %esi
+  802642:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  802648:	e8 43 f4 ff ff       	call   801a90 <file_get_block>
+  80264d:	83 c4 10             	add    $0x10,%esp
+  802650:	85 c0                	test   %eax,%eax
+  802652:	0f 88 27 01 00 00    	js     80277f <file_create+0x1ce>
+		for (j = 0; j < BLKFILES; j++)
+  802658:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  80265e:	8d 88 00 10 00 00    	lea    0x1000(%eax),%ecx
+  802664:	39 c8                	cmp    %ecx,%eax
+  802666:	0f 84 93 00 00 00    	je     8026ff <file_create+0x14e>
+			if (f[j].f_name[0] == '\0') {
+  80266c:	8d 90 00 01 00 00    	lea    0x100(%eax),%edx
+  802672:	80 38 00             	cmpb   $0x0,(%eax)
+  802675:	74 1d                	je     802694 <file_create+0xe3>
+  802677:	89 d0                	mov    %edx,%eax
+  802679:	eb e9                	jmp    802664 <file_create+0xb3>
+	assert((dir->f_size % BLKSIZE) == 0);
+  80267b:	68 01 82 80 00       	push   $0x808201
+  802680:	68 dd 7e 80 00       	push   $0x807edd
+  802685:	68 57 03 00 00       	push   $0x357
+  80268a:	68 b1 81 80 00       	push   $0x8081b1
+  80268f:	e8 4f 0c 00 00       	call   8032e3 <_panic>
+			if (f[j].f_name[0] == '\0') {
+  802694:	89 c6                	mov    %eax,%esi
+				if ((r = bc_make_private(&f[j])) < 0)
+  802696:	83 ec 0c             	sub    $0xc,%esp
+  802699:	50                   	push   %eax
+  80269a:	e8 0b e7 ff ff       	call   800daa <bc_make_private>
+  80269f:	89 c7                	mov    %eax,%edi
+  8026a1:	83 c4 10             	add    $0x10,%esp
+  8026a4:	85 c0                	test   %eax,%eax
+  8026a6:	0f 88 cc 00 00 00    	js     802778 <file_create+0x1c7>
+	*file = &f[0];
+  8026ac:	89 b5 60 ff ff ff    	mov    %esi,-0xa0(%ebp)
+	memset(f, 0, sizeof(*f));
+  8026b2:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  8026b8:	83 ec 04             	sub    $0x4,%esp
+  8026bb:	68 00 01 00 00       	push   $0x100
+  8026c0:	6a 00                	push   $0x0
+  8026c2:	56                   	push   %esi
+  8026c3:	e8 2e 14 00 00       	call   803af6 <memset>
+	strcpy(f->f_name, name);
+  8026c8:	89 f7                	mov    %esi,%edi
+  8026ca:	83 c4 08             	add    $0x8,%esp
+  8026cd:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8026d3:	50                   	push   %eax
+  8026d4:	56                   	push   %esi
+  8026d5:	e8 cb 12 00 00       	call   8039a5 <strcpy>
+	if (!dirhash_ready || !*dirhash_dir_slot(dir))
+  8026da:	83 c4 10             	add    $0x10,%esp
+  8026dd:	80 3d a4 14 83 00 00 	cmpb   $0x0,0x8314a4
+  8026e4:	0f 85 9c 00 00 00    	jne    802786 <file_create+0x1d5>
+	*pf = f;
+  8026ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026ed:	8b bd 50 ff ff ff    	mov    -0xb0(%ebp),%edi
+  8026f3:	89 38                	mov    %edi,(%eax)
+}
+  8026f5:	89 d8                	mov    %ebx,%eax
+  8026f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026fa:	5b                   	pop    %ebx
+  8026fb:	5e                   	pop    %esi
+  8026fc:	5f                   	pop    %edi
+  8026fd:	5d                   	pop    %ebp
+  8026fe:	c3                   	ret
+	for (i = 0; i < nblock; i++) {
+  8026ff:	83 c6 01             	add    $0x1,%esi
+  802702:	e9 2a ff ff ff       	jmp    802631 <file_create+0x80>
+	if ((r = file_set_size(dir, dir->f_size + BLKSIZE)) < 0)
+  802707:	83 ec 08             	sub    $0x8,%esp
+  80270a:	8b bd 54 ff ff ff    	mov    -0xac(%ebp),%edi
+  802710:	8b 87 80 00 00 00    	mov    0x80(%edi),%eax
+  802716:	05 00 10 00 00       	add    $0x1000,%eax
+  80271b:	50                   	push   %eax
+  80271c:	89 bd 54 ff ff ff    	mov    %edi,-0xac(%ebp)
+  802722:	57                   	push   %edi
+  802723:	e8 c3 fb ff ff       	call   8022eb <file_set_size>
+  802728:	89 c7                	mov    %eax,%edi
+  80272a:	83 c4 10             	add    $0x10,%esp
+  80272d:	85 c0                	test   %eax,%eax
+  80272f:	78 47                	js     802778 <file_create+0x1c7>
+	if ((r = file_get_block_for_write(dir, i, &blk)) < 0) {
+  802731:	8d 8d 5c ff ff ff    	lea    -0xa4(%ebp),%ecx
+  802737:	89 f2                	mov    %esi,%edx
+  802739:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  80273f:	e8 63 f1 ff ff       	call   8018a7 <file_get_block_for_write>
+  802744:	89 c7                	mov    %eax,%edi
+	f = (struct File*) blk;
+  802746:	8b b5 5c ff ff ff    	mov    -0xa4(%ebp),%esi
+	if ((r = file_get_block_for_write(dir, i, &blk)) < 0) {
+  80274c:	85 c0                	test   %eax,%eax
+  80274e:	0f 89 58 ff ff ff    	jns    8026ac <file_create+0xfb>
+		file_set_size(dir, dir->f_size - BLKSIZE);
+  802754:	83 ec 08             	sub    $0x8,%esp
+  802757:	8b b5 54 ff ff ff    	mov    -0xac(%ebp),%esi
+  80275d:	8b 86 80 00 00 00    	mov    0x80(%esi),%eax
+  802763:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  802769:	2d 00 10 00 00       	sub    $0x1000,%eax
+  80276e:	50                   	push   %eax
+  80276f:	56                   	push   %esi
+  802770:	e8 76 fb ff ff       	call   8022eb <file_set_size>
+		return r;
+  802775:	83 c4 10             	add    $0x10,%esp
+  802778:	89 fb                	mov    %edi,%ebx
+  80277a:	e9 76 ff ff ff       	jmp    8026f5 <file_create+0x144>
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  80277f:	89 c3                	mov    %eax,%ebx
+  802781:	e9 6f ff ff ff       	jmp    8026f5 <file_create+0x144>
+	if (!dirhash_ready || !*dirhash_dir_slot(dir))
+  802786:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  80278c:	e8 6e e7 ff ff       	call   800eff <dirhash_dir_slot>
+  802791:	83 38 00             	cmpl   $0x0,(%eax)
+  802794:	0f 84 50 ff ff ff    	je     8026ea <file_create+0x139>
+	if (dirhash_nentries == DIRHASH_NENTRIES) {
+  80279a:	8b 35 c0 28 83 00    	mov    0x8328c0,%esi
+	uint32_t h = (uint32_t) dir;
+  8027a0:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+	if (dirhash_nentries == DIRHASH_NENTRIES) {
+  8027a6:	81 fe 00 20 00 00    	cmp    $0x2000,%esi
+  8027ac:	75 5d                	jne    80280b <file_create+0x25a>
+		memset(dirhash_dirs, 0, sizeof(dirhash_dirs));
+  8027ae:	83 ec 04             	sub    $0x4,%esp
+  8027b1:	68 00 04 00 00       	push   $0x400
+  8027b6:	6a 00                	push   $0x0
+  8027b8:	68 c0 14 83 00       	push   $0x8314c0
+  8027bd:	e8 34 13 00 00       	call   803af6 <memset>
+		dirhash_ndirs = dirhash_nentries = 0;
+  8027c2:	c7 05 c0 28 83 00 00 	movl   $0x0,0x8328c0
+  8027c9:	00 00 00 
+  8027cc:	c7 05 a8 14 83 00 00 	movl   $0x0,0x8314a8
+  8027d3:	00 00 00 
+	memset(dirhash_buckets, 0xFF, sizeof(dirhash_buckets));
+  8027d6:	83 c4 0c             	add    $0xc,%esp
+  8027d9:	68 00 10 00 00       	push   $0x1000
+  8027de:	68 ff 00 00 00       	push   $0xff
+  8027e3:	68 c0 18 83 00       	push   $0x8318c0
+  8027e8:	e8 09 13 00 00       	call   803af6 <memset>
+	dirhash_ready = 1;
+  8027ed:	c6 05 a4 14 83 00 01 	movb   $0x1,0x8314a4
+}
+  8027f4:	83 c4 10             	add    $0x10,%esp
+  8027f7:	e9 ee fe ff ff       	jmp    8026ea <file_create+0x139>
+		h = h * 33 + (uint8_t) *name++;
+  8027fc:	89 c1                	mov    %eax,%ecx
+  8027fe:	c1 e1 05             	shl    $0x5,%ecx
+  802801:	01 c8                	add    %ecx,%eax
+  802803:	83 c7 01             	add    $0x1,%edi
+  802806:	0f b6 d2             	movzbl %dl,%edx
+  802809:	01 d0                	add    %edx,%eax
+	while (*name)
+  80280b:	0f b6 17             	movzbl (%edi),%edx
+  80280e:	84 d2                	test   %dl,%dl
+  802810:	75 ea                	jne    8027fc <file_create+0x24b>
+	e->dh_dir = dir;
+  802812:	89 f1                	mov    %esi,%ecx
+  802814:	c1 e1 04             	shl    $0x4,%ecx
+  802817:	8d 91 e0 28 83 00    	lea    0x8328e0(%ecx),%edx
+  80281d:	8b bd 54 ff ff ff    	mov    -0xac(%ebp),%edi
+  802823:	89 b9 e0 28 83 00    	mov    %edi,0x8328e0(%ecx)
+	e->dh_file = f;
+  802829:	8b bd 50 ff ff ff    	mov    -0xb0(%ebp),%edi
+  80282f:	89 b9 e4 28 83 00    	mov    %edi,0x8328e4(%ecx)
+	e->dh_hash = h;
+  802835:	89 81 e8 28 83 00    	mov    %eax,0x8328e8(%ecx)
+	e->dh_next = dirhash_buckets[h & (DIRHASH_NBUCKETS - 1)];
+  80283b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802840:	8b 0c 85 c0 18 83 00 	mov    0x8318c0(,%eax,4),%ecx
+  802847:	89 4a 0c             	mov    %ecx,0xc(%edx)
+	dirhash_buckets[h & (DIRHASH_NBUCKETS - 1)] = dirhash_nentries++;
+  80284a:	8d 56 01             	lea    0x1(%esi),%edx
+  80284d:	89 15 c0 28 83 00    	mov    %edx,0x8328c0
+  802853:	89 34 85 c0 18 83 00 	mov    %esi,0x8318c0(,%eax,4)
+  80285a:	e9 8b fe ff ff       	jmp    8026ea <file_create+0x139>
+		return -E_FILE_EXISTS;
+  80285f:	bb f3 ff ff ff       	mov    $0xfffffff3,%ebx
+  802864:	e9 8c fe ff ff       	jmp    8026f5 <file_create+0x144>
+
+00802869 <file_write>:
+{
+  802869:	55                   	push   %ebp
+  80286a:	89 e5                	mov    %esp,%ebp
+  80286c:	57                   	push   %edi
+  80286d:	56                   	push   %esi
+  80286e:	53                   	push   %ebx
+  80286f:	83 ec 2c             	sub    $0x2c,%esp
+  802872:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	if (offset + count > f->f_size)
+  802875:	89 df                	mov    %ebx,%edi
+  802877:	03 7d 10             	add    0x10(%ebp),%edi
+  80287a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80287d:	39 b8 80 00 00 00    	cmp    %edi,0x80(%eax)
+  802883:	72 68                	jb     8028ed <file_write+0x84>
+  802885:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  802888:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (pos = offset; pos < offset + count; ) {
+  80288b:	89 de                	mov    %ebx,%esi
+  80288d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802890:	39 c3                	cmp    %eax,%ebx
+  802892:	73 6c                	jae    802900 <file_write+0x97>
+		if ((r = file_get_block_for_write(f, pos / BLKSIZE, &blk)) < 0)
+  802894:	8d 93 ff 0f 00 00    	lea    0xfff(%ebx),%edx
+  80289a:	85 db                	test   %ebx,%ebx
+  80289c:	0f 49 d3             	cmovns %ebx,%edx
+  80289f:	c1 fa 0c             	sar    $0xc,%edx
+  8028a2:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  8028a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028a8:	e8 fa ef ff ff       	call   8018a7 <file_get_block_for_write>
+  8028ad:	85 c0                	test   %eax,%eax
+  8028af:	78 52                	js     802903 <file_write+0x9a>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  8028b1:	89 da                	mov    %ebx,%edx
+  8028b3:	c1 fa 1f             	sar    $0x1f,%edx
+  8028b6:	c1 ea 14             	shr    $0x14,%edx
+  8028b9:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  8028bc:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8028c1:	29 d0                	sub    %edx,%eax
+  8028c3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8028c8:	29 c1                	sub    %eax,%ecx
+  8028ca:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  8028cd:	29 f2                	sub    %esi,%edx
+  8028cf:	39 d1                	cmp    %edx,%ecx
+  8028d1:	89 d6                	mov    %edx,%esi
+  8028d3:	0f 46 f1             	cmovbe %ecx,%esi
+		memmove(blk + pos % BLKSIZE, buf, bn);
+  8028d6:	83 ec 04             	sub    $0x4,%esp
+  8028d9:	56                   	push   %esi
+  8028da:	57                   	push   %edi
+  8028db:	03 45 e4             	add    -0x1c(%ebp),%eax
+  8028de:	50                   	push   %eax
+  8028df:	e8 47 12 00 00       	call   803b2b <memmove>
+		pos += bn;
+  8028e4:	01 f3                	add    %esi,%ebx
+		buf += bn;
+  8028e6:	01 f7                	add    %esi,%edi
+  8028e8:	83 c4 10             	add    $0x10,%esp
+  8028eb:	eb 9e                	jmp    80288b <file_write+0x22>
+		if ((r = file_set_size(f, offset + count)) < 0)
+  8028ed:	83 ec 08             	sub    $0x8,%esp
+  8028f0:	57                   	push   %edi
+  8028f1:	50                   	push   %eax
+  8028f2:	e8 f4 f9 ff ff       	call   8022eb <file_set_size>
+  8028f7:	83 c4 10             	add    $0x10,%esp
+  8028fa:	85 c0                	test   %eax,%eax
+  8028fc:	79 87                	jns    802885 <file_write+0x1c>
+  8028fe:	eb 03                	jmp    802903 <file_write+0x9a>
+	return count;
+  802900:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+  802903:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802906:	5b                   	pop    %ebx
+  802907:	5e                   	pop    %esi
+  802908:	5f                   	pop    %edi
+  802909:	5d                   	pop    %ebp
+  80290a:	c3                   	ret
+
+0080290b <file_flush>:
+// Flush the contents of file f out to disk.  Blocks waiting for a
+// place on disk get one, and then every dirty block in the cache is
+// written back, in order, in as few disk writes as it takes.
+int
+file_flush(struct File *f)
+{
+  80290b:	55                   	push   %ebp
+  80290c:	89 e5                	mov    %esp,%ebp
+  80290e:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if ((r = file_flush_pending(f)) < 0)
+  802911:	8b 45 08             	mov    0x8(%ebp),%eax
+  802914:	e8 dd ec ff ff       	call   8015f6 <file_flush_pending>
+  802919:	85 c0                	test   %eax,%eax
+  80291b:	78 0a                	js     802927 <file_flush+0x1c>
+		return r;
+	bc_sync();
+  80291d:	e8 fa e2 ff ff       	call   800c1c <bc_sync>
+	return 0;
+  802922:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802927:	c9                   	leave
+  802928:	c3                   	ret
+
+00802929 <file_remove>:
+
+// Remove a file by truncating it and then zeroing the name.
+int
+file_remove(const char *path)
+{
+  802929:	55                   	push   %ebp
+  80292a:	89 e5                	mov    %esp,%ebp
+  80292c:	53                   	push   %ebx
+  80292d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct File *f;
+
+	if ((r = walk_path(path, 0, &f, 0)) < 0)
+  802930:	6a 00                	push   $0x0
+  802932:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  802935:	ba 00 00 00 00       	mov    $0x0,%edx
+  80293a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80293d:	e8 b4 f1 ff ff       	call   801af6 <walk_path>
+  802942:	83 c4 10             	add    $0x10,%esp
+  802945:	85 c0                	test   %eax,%eax
+  802947:	78 26                	js     80296f <file_remove+0x46>
+		return r;
+	if ((r = file_set_size(f, 0)) < 0)
+  802949:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+  80294c:	83 ec 08             	sub    $0x8,%esp
+  80294f:	6a 00                	push   $0x0
+  802951:	53                   	push   %ebx
+  802952:	e8 94 f9 ff ff       	call   8022eb <file_set_size>
+  802957:	83 c4 10             	add    $0x10,%esp
+  80295a:	85 c0                	test   %eax,%eax
+  80295c:	78 11                	js     80296f <file_remove+0x46>
+		return r;
+	if (f->f_type == FTYPE_DIR)
+  80295e:	83 bb 84 00 00 00 01 	cmpl   $0x1,0x84(%ebx)
+  802965:	74 0d                	je     802974 <file_remove+0x4b>
+		dirhash_evict(f);
+	f->f_name[0] = '\0';
+  802967:	c6 03 00             	movb   $0x0,(%ebx)
+	return 0;
+  80296a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80296f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802972:	c9                   	leave
+  802973:	c3                   	ret
+		dirhash_evict(f);
+  802974:	89 d8                	mov    %ebx,%eax
+  802976:	e8 a6 e5 ff ff       	call   800f21 <dirhash_evict>
+  80297b:	eb ea                	jmp    802967 <file_remove+0x3e>
+
+0080297d <fs_sync>:
+
+// Sync the entire file system.  A big hammer.
+int
+fs_sync(void)
+{
+  80297d:	55                   	push   %ebp
+  80297e:	89 e5                	mov    %esp,%ebp
+  802980:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if ((r = pend_flush_all()) < 0)
+  802983:	e8 dd ee ff ff       	call   801865 <pend_flush_all>
+  802988:	85 c0                	test   %eax,%eax
+  80298a:	78 0a                	js     802996 <fs_sync+0x19>
+		return r;
+	bc_sync();
+  80298c:	e8 8b e2 ff ff       	call   800c1c <bc_sync>
+	return 0;
+  802991:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802996:	c9                   	leave
+  802997:	c3                   	ret
+
+00802998 <readahead>:
+// we read ahead has been used.  The window doubles while the blocks we
+// read ahead are still cached when they're read, and halves when they
+// got evicted first.  Reads that jump around turn readahead off.
+static void
+readahead(struct OpenFile *o, off_t offset)
+{
+  802998:	55                   	push   %ebp
+  802999:	89 e5                	mov    %esp,%ebp
+  80299b:	57                   	push   %edi
+  80299c:	56                   	push   %esi
+  80299d:	53                   	push   %ebx
+  80299e:	83 ec 0c             	sub    $0xc,%esp
+  8029a1:	89 c3                	mov    %eax,%ebx
+	uint32_t bno = offset / BLKSIZE;
+  8029a3:	8d b2 ff 0f 00 00    	lea    0xfff(%edx),%esi
+  8029a9:	85 d2                	test   %edx,%edx
+  8029ab:	0f 49 f2             	cmovns %edx,%esi
+  8029ae:	c1 fe 0c             	sar    $0xc,%esi
+
+	// Another read from the same block
+	if (bno + 1 == o->o_ra_next)
+  8029b1:	8d 7e 01             	lea    0x1(%esi),%edi
+  8029b4:	8b 40 10             	mov    0x10(%eax),%eax
+  8029b7:	39 c7                	cmp    %eax,%edi
+  8029b9:	74 11                	je     8029cc <readahead+0x34>
+		return;
+	if (bno != o->o_ra_next) {
+  8029bb:	39 f0                	cmp    %esi,%eax
+  8029bd:	74 15                	je     8029d4 <readahead+0x3c>
+		o->o_ra_window = 0;
+  8029bf:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		o->o_ra_next = o->o_ra_end = bno + 1;
+  8029c6:	89 7b 14             	mov    %edi,0x14(%ebx)
+  8029c9:	89 7b 10             	mov    %edi,0x10(%ebx)
+		o->o_ra_end = bno + 1;
+	if (o->o_ra_end - (bno + 1) <= o->o_ra_window / 2) {
+		file_readahead(o->o_file, o->o_ra_end, bno + 1 + o->o_ra_window - o->o_ra_end);
+		o->o_ra_end = bno + 1 + o->o_ra_window;
+	}
+}
+  8029cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029cf:	5b                   	pop    %ebx
+  8029d0:	5e                   	pop    %esi
+  8029d1:	5f                   	pop    %edi
+  8029d2:	5d                   	pop    %ebp
+  8029d3:	c3                   	ret
+	if (o->o_ra_window == 0)
+  8029d4:	83 7b 18 00          	cmpl   $0x0,0x18(%ebx)
+  8029d8:	75 47                	jne    802a21 <readahead+0x89>
+		o->o_ra_window = RA_MIN_WINDOW;
+  8029da:	c7 43 18 04 00 00 00 	movl   $0x4,0x18(%ebx)
+	o->o_ra_next = bno + 1;
+  8029e1:	89 7b 10             	mov    %edi,0x10(%ebx)
+	if (o->o_ra_end < bno + 1)
+  8029e4:	39 7b 14             	cmp    %edi,0x14(%ebx)
+  8029e7:	73 03                	jae    8029ec <readahead+0x54>
+		o->o_ra_end = bno + 1;
+  8029e9:	89 7b 14             	mov    %edi,0x14(%ebx)
+	if (o->o_ra_end - (bno + 1) <= o->o_ra_window / 2) {
+  8029ec:	8b 4b 14             	mov    0x14(%ebx),%ecx
+  8029ef:	8b 53 18             	mov    0x18(%ebx),%edx
+  8029f2:	8d 41 ff             	lea    -0x1(%ecx),%eax
+  8029f5:	29 f0                	sub    %esi,%eax
+  8029f7:	89 d7                	mov    %edx,%edi
+  8029f9:	d1 ef                	shr    %edi
+  8029fb:	39 c7                	cmp    %eax,%edi
+  8029fd:	72 cd                	jb     8029cc <readahead+0x34>
+		file_readahead(o->o_file, o->o_ra_end, bno + 1 + o->o_ra_window - o->o_ra_end);
+  8029ff:	83 ec 04             	sub    $0x4,%esp
+  802a02:	29 ca                	sub    %ecx,%edx
+  802a04:	8d 44 32 01          	lea    0x1(%edx,%esi,1),%eax
+  802a08:	50                   	push   %eax
+  802a09:	51                   	push   %ecx
+  802a0a:	ff 73 04             	push   0x4(%ebx)
+  802a0d:	e8 74 f7 ff ff       	call   802186 <file_readahead>
+		o->o_ra_end = bno + 1 + o->o_ra_window;
+  802a12:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a15:	8d 44 06 01          	lea    0x1(%esi,%eax,1),%eax
+  802a19:	89 43 14             	mov    %eax,0x14(%ebx)
+  802a1c:	83 c4 10             	add    $0x10,%esp
+  802a1f:	eb ab                	jmp    8029cc <readahead+0x34>
+	else if (bno < o->o_ra_end) {
+  802a21:	3b 73 14             	cmp    0x14(%ebx),%esi
+  802a24:	73 bb                	jae    8029e1 <readahead+0x49>
+		if (file_block_is_cached(o->o_file, bno))
+  802a26:	83 ec 08             	sub    $0x8,%esp
+  802a29:	56                   	push   %esi
+  802a2a:	ff 73 04             	push   0x4(%ebx)
+  802a2d:	e8 7a f6 ff ff       	call   8020ac <file_block_is_cached>
+  802a32:	83 c4 10             	add    $0x10,%esp
+  802a35:	84 c0                	test   %al,%al
+  802a37:	74 15                	je     802a4e <readahead+0xb6>
+			o->o_ra_window = MIN(o->o_ra_window * 2, RA_MAX_WINDOW);
+  802a39:	d1 63 18             	shll   0x18(%ebx)
+  802a3c:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a3f:	ba 20 00 00 00       	mov    $0x20,%edx
+  802a44:	39 d0                	cmp    %edx,%eax
+  802a46:	0f 47 c2             	cmova  %edx,%eax
+  802a49:	89 43 18             	mov    %eax,0x18(%ebx)
+  802a4c:	eb 93                	jmp    8029e1 <readahead+0x49>
+			o->o_ra_window = MAX(o->o_ra_window / 2, RA_MIN_WINDOW);
+  802a4e:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a51:	d1 e8                	shr    %eax
+  802a53:	ba 04 00 00 00       	mov    $0x4,%edx
+  802a58:	39 d0                	cmp    %edx,%eax
+  802a5a:	0f 42 c2             	cmovb  %edx,%eax
+  802a5d:	89 43 18             	mov    %eax,0x18(%ebx)
+  802a60:	e9 7c ff ff ff       	jmp    8029e1 <readahead+0x49>
+
+00802a65 <serve_remove>:
+}
+
+// Remove the file req->req_path.
+int
+serve_remove(envid_t envid, struct Fsreq_remove *req)
+{
+  802a65:	55                   	push   %ebp
+  802a66:	89 e5                	mov    %esp,%ebp
+  802a68:	53                   	push   %ebx
+  802a69:	81 ec 08 04 00 00    	sub    $0x408,%esp
+
+	if (debug)
+		cprintf("serve_remove %08x %s\n", envid, req->req_path);
+
+	// Copy in the path, making sure it's null-terminated
+	memmove(path, req->req_path, MAXPATHLEN);
+  802a6f:	68 00 04 00 00       	push   $0x400
+  802a74:	ff 75 0c             	push   0xc(%ebp)
+  802a77:	8d 9d f8 fb ff ff    	lea    -0x408(%ebp),%ebx
+  802a7d:	53                   	push   %ebx
+  802a7e:	e8 a8 10 00 00       	call   803b2b <memmove>
+	path[MAXPATHLEN-1] = 0;
+  802a83:	c6 45 f7 00          	movb   $0x0,-0x9(%ebp)
+
+	return file_remove(path);
+  802a87:	89 1c 24             	mov    %ebx,(%esp)
+  802a8a:	e8 9a fe ff ff       	call   802929 <file_remove>
+}
+  802a8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a92:	c9                   	leave
+  802a93:	c3                   	ret
+
+00802a94 <serve_sync>:
+
+// Sync the file system.
+int
+serve_sync(envid_t envid, union Fsipc *req)
+{
+  802a94:	55                   	push   %ebp
+  802a95:	89 e5                	mov    %esp,%ebp
+  802a97:	83 ec 08             	sub    $0x8,%esp
+	return fs_sync();
+  802a9a:	e8 de fe ff ff       	call   80297d <fs_sync>
+}
+  802a9f:	c9                   	leave
+  802aa0:	c3                   	ret
+
+00802aa1 <serve_bcstat>:
+}
+
+// Return the block cache statistics in ipc->bcstatRet.
+int
+serve_bcstat(envid_t envid, union Fsipc *ipc)
+{
+  802aa1:	55                   	push   %ebp
+  802aa2:	89 e5                	mov    %esp,%ebp
+  802aa4:	53                   	push   %ebx
+  802aa5:	83 ec 04             	sub    $0x4,%esp
+  802aa8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (debug)
+		cprintf("serve_bcstat %08x\n", envid);
+
+	ipc->bcstatRet = bc_stats;
+  802aab:	a1 1c a9 85 00       	mov    0x85a91c,%eax
+  802ab0:	89 03                	mov    %eax,(%ebx)
+  802ab2:	a1 20 a9 85 00       	mov    0x85a920,%eax
+  802ab7:	89 43 04             	mov    %eax,0x4(%ebx)
+  802aba:	a1 24 a9 85 00       	mov    0x85a924,%eax
+  802abf:	89 43 08             	mov    %eax,0x8(%ebx)
+  802ac2:	a1 28 a9 85 00       	mov    0x85a928,%eax
+  802ac7:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802aca:	a1 2c a9 85 00       	mov    0x85a92c,%eax
+  802acf:	89 43 10             	mov    %eax,0x10(%ebx)
+  802ad2:	a1 30 a9 85 00       	mov    0x85a930,%eax
+  802ad7:	89 43 14             	mov    %eax,0x14(%ebx)
+  802ada:	a1 34 a9 85 00       	mov    0x85a934,%eax
+  802adf:	89 43 18             	mov    %eax,0x18(%ebx)
+	ipc->bcstatRet.ret_capacity = bc_capacity;
+  802ae2:	a1 04 90 80 00       	mov    0x809004,%eax
+  802ae7:	89 03                	mov    %eax,(%ebx)
+	ipc->bcstatRet.ret_nblocks = bc_resident();
+  802ae9:	e8 b8 dd ff ff       	call   8008a6 <bc_resident>
+  802aee:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+}
+  802af1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802af9:	c9                   	leave
+  802afa:	c3                   	ret
+
+00802afb <serve_bcset>:
+
+// Change the block cache's capacity to ipc->bcset.req_capacity blocks.
+int
+serve_bcset(envid_t envid, union Fsipc *ipc)
+{
+  802afb:	55                   	push   %ebp
+  802afc:	89 e5                	mov    %esp,%ebp
+  802afe:	83 ec 14             	sub    $0x14,%esp
+	if (debug)
+		cprintf("serve_bcset %08x %d\n", envid, ipc->bcset.req_capacity);
+
+	return bc_set_capacity(ipc->bcset.req_capacity);
+  802b01:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b04:	ff 30                	push   (%eax)
+  802b06:	e8 e0 dd ff ff       	call   8008eb <bc_set_capacity>
+}
+  802b0b:	c9                   	leave
+  802b0c:	c3                   	ret
+
+00802b0d <serve_init>:
+	for (i = 0; i < MAXOPEN; i++) {
+  802b0d:	ba 60 90 80 00       	mov    $0x809060,%edx
+	uintptr_t va = FILEVA;
+  802b12:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	for (i = 0; i < MAXOPEN; i++) {
+  802b17:	b9 00 00 00 00       	mov    $0x0,%ecx
+		opentab[i].o_fileid = i;
+  802b1c:	89 0a                	mov    %ecx,(%edx)
+		opentab[i].o_fd = (struct Fd*) va;
+  802b1e:	89 42 0c             	mov    %eax,0xc(%edx)
+		va += PGSIZE;
+  802b21:	05 00 10 00 00       	add    $0x1000,%eax
+	for (i = 0; i < MAXOPEN; i++) {
+  802b26:	83 c1 01             	add    $0x1,%ecx
+  802b29:	83 c2 1c             	add    $0x1c,%edx
+  802b2c:	3d 00 00 40 d0       	cmp    $0xd0400000,%eax
+  802b31:	75 e9                	jne    802b1c <serve_init+0xf>
+}
+  802b33:	c3                   	ret
+
+00802b34 <openfile_alloc>:
+{
+  802b34:	55                   	push   %ebp
+  802b35:	89 e5                	mov    %esp,%ebp
+  802b37:	57                   	push   %edi
+  802b38:	56                   	push   %esi
+  802b39:	53                   	push   %ebx
+  802b3a:	83 ec 0c             	sub    $0xc,%esp
+  802b3d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	for (i = 0; i < MAXOPEN; i++) {
+  802b40:	be 6c 90 80 00       	mov    $0x80906c,%esi
+  802b45:	bb 00 00 00 00       	mov    $0x0,%ebx
+		switch (pageref(opentab[i].o_fd)) {
+  802b4a:	83 ec 0c             	sub    $0xc,%esp
+  802b4d:	ff 36                	push   (%esi)
+  802b4f:	e8 f8 25 00 00       	call   80514c <pageref>
+  802b54:	83 c4 10             	add    $0x10,%esp
+  802b57:	85 c0                	test   %eax,%eax
+  802b59:	74 1a                	je     802b75 <openfile_alloc+0x41>
+  802b5b:	83 f8 01             	cmp    $0x1,%eax
+  802b5e:	74 31                	je     802b91 <openfile_alloc+0x5d>
+	for (i = 0; i < MAXOPEN; i++) {
+  802b60:	83 c3 01             	add    $0x1,%ebx
+  802b63:	83 c6 1c             	add    $0x1c,%esi
+  802b66:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  802b6c:	75 dc                	jne    802b4a <openfile_alloc+0x16>
+	return -E_MAX_OPEN;
+  802b6e:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  802b73:	eb 6b                	jmp    802be0 <openfile_alloc+0xac>
+			if ((r = sys_page_alloc(0, opentab[i].o_fd, PTE_P|PTE_U|PTE_W)) < 0)
+  802b75:	83 ec 04             	sub    $0x4,%esp
+  802b78:	6a 07                	push   $0x7
+  802b7a:	6b c3 1c             	imul   $0x1c,%ebx,%eax
+  802b7d:	ff b0 6c 90 80 00    	push   0x80906c(%eax)
+  802b83:	6a 00                	push   $0x0
+  802b85:	e8 0e 13 00 00       	call   803e98 <sys_page_alloc>
+  802b8a:	83 c4 10             	add    $0x10,%esp
+  802b8d:	85 c0                	test   %eax,%eax
+  802b8f:	78 4f                	js     802be0 <openfile_alloc+0xac>
+			opentab[i].o_fileid += MAXOPEN;
+  802b91:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802b94:	8d 83 60 90 80 00    	lea    0x809060(%ebx),%eax
+  802b9a:	81 83 60 90 80 00 00 	addl   $0x400,0x809060(%ebx)
+  802ba1:	04 00 00 
+			opentab[i].o_ra_next = opentab[i].o_ra_end = 0;
+  802ba4:	c7 83 74 90 80 00 00 	movl   $0x0,0x809074(%ebx)
+  802bab:	00 00 00 
+  802bae:	c7 83 70 90 80 00 00 	movl   $0x0,0x809070(%ebx)
+  802bb5:	00 00 00 
+			opentab[i].o_ra_window = 0;
+  802bb8:	c7 83 78 90 80 00 00 	movl   $0x0,0x809078(%ebx)
+  802bbf:	00 00 00 
+			*o = &opentab[i];
+  802bc2:	89 07                	mov    %eax,(%edi)
+			memset(opentab[i].o_fd, 0, PGSIZE);
+  802bc4:	83 ec 04             	sub    $0x4,%esp
+  802bc7:	68 00 10 00 00       	push   $0x1000
+  802bcc:	6a 00                	push   $0x0
+  802bce:	ff b3 6c 90 80 00    	push   0x80906c(%ebx)
+  802bd4:	e8 1d 0f 00 00       	call   803af6 <memset>
+			return (*o)->o_fileid;
+  802bd9:	8b 07                	mov    (%edi),%eax
+  802bdb:	8b 00                	mov    (%eax),%eax
+  802bdd:	83 c4 10             	add    $0x10,%esp
+}
+  802be0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802be3:	5b                   	pop    %ebx
+  802be4:	5e                   	pop    %esi
+  802be5:	5f                   	pop    %edi
+  802be6:	5d                   	pop    %ebp
+  802be7:	c3                   	ret
+
+00802be8 <openfile_lookup>:
+{
+  802be8:	55                   	push   %ebp
+  802be9:	89 e5                	mov    %esp,%ebp
+  802beb:	57                   	push   %edi
+  802bec:	56                   	push   %esi
+  802bed:	53                   	push   %ebx
+  802bee:	83 ec 18             	sub    $0x18,%esp
+  802bf1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	o = &opentab[fileid % MAXOPEN];
+  802bf4:	89 fb                	mov    %edi,%ebx
+  802bf6:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802bfc:	6b f3 1c             	imul   $0x1c,%ebx,%esi
+	if (pageref(o->o_fd) == 1 || o->o_fileid != fileid)
+  802bff:	ff b6 6c 90 80 00    	push   0x80906c(%esi)
+	o = &opentab[fileid % MAXOPEN];
+  802c05:	81 c6 60 90 80 00    	add    $0x809060,%esi
+	if (pageref(o->o_fd) == 1 || o->o_fileid != fileid)
+  802c0b:	e8 3c 25 00 00       	call   80514c <pageref>
+  802c10:	83 c4 10             	add    $0x10,%esp
+  802c13:	83 f8 01             	cmp    $0x1,%eax
+  802c16:	74 1d                	je     802c35 <openfile_lookup+0x4d>
+  802c18:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802c1b:	39 bb 60 90 80 00    	cmp    %edi,0x809060(%ebx)
+  802c21:	75 19                	jne    802c3c <openfile_lookup+0x54>
+	*po = o;
+  802c23:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c26:	89 30                	mov    %esi,(%eax)
+	return 0;
+  802c28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c30:	5b                   	pop    %ebx
+  802c31:	5e                   	pop    %esi
+  802c32:	5f                   	pop    %edi
+  802c33:	5d                   	pop    %ebp
+  802c34:	c3                   	ret
+		return -E_INVAL;
+  802c35:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c3a:	eb f1                	jmp    802c2d <openfile_lookup+0x45>
+  802c3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c41:	eb ea                	jmp    802c2d <openfile_lookup+0x45>
+
+00802c43 <serve_set_size>:
+{
+  802c43:	55                   	push   %ebp
+  802c44:	89 e5                	mov    %esp,%ebp
+  802c46:	53                   	push   %ebx
+  802c47:	83 ec 18             	sub    $0x18,%esp
+  802c4a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  802c4d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c50:	50                   	push   %eax
+  802c51:	ff 33                	push   (%ebx)
+  802c53:	ff 75 08             	push   0x8(%ebp)
+  802c56:	e8 8d ff ff ff       	call   802be8 <openfile_lookup>
+  802c5b:	83 c4 10             	add    $0x10,%esp
+  802c5e:	85 c0                	test   %eax,%eax
+  802c60:	78 1a                	js     802c7c <serve_set_size+0x39>
+	if ((o->o_mode & O_ACCMODE) == O_RDONLY)
+  802c62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c65:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802c69:	74 16                	je     802c81 <serve_set_size+0x3e>
+	return file_set_size(o->o_file, req->req_size);
+  802c6b:	83 ec 08             	sub    $0x8,%esp
+  802c6e:	ff 73 04             	push   0x4(%ebx)
+  802c71:	ff 70 04             	push   0x4(%eax)
+  802c74:	e8 72 f6 ff ff       	call   8022eb <file_set_size>
+  802c79:	83 c4 10             	add    $0x10,%esp
+}
+  802c7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c7f:	c9                   	leave
+  802c80:	c3                   	ret
+		return -E_INVAL;
+  802c81:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c86:	eb f4                	jmp    802c7c <serve_set_size+0x39>
+
+00802c88 <serve_read>:
+{
+  802c88:	55                   	push   %ebp
+  802c89:	89 e5                	mov    %esp,%ebp
+  802c8b:	56                   	push   %esi
+  802c8c:	53                   	push   %ebx
+  802c8d:	83 ec 14             	sub    $0x14,%esp
+  802c90:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  802c93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c96:	50                   	push   %eax
+  802c97:	ff 33                	push   (%ebx)
+  802c99:	ff 75 08             	push   0x8(%ebp)
+  802c9c:	e8 47 ff ff ff       	call   802be8 <openfile_lookup>
+  802ca1:	83 c4 10             	add    $0x10,%esp
+  802ca4:	85 c0                	test   %eax,%eax
+  802ca6:	78 59                	js     802d01 <serve_read+0x79>
+	file_count_reads(o->o_file, o->o_fd->fd_offset, MIN(req->req_n, sizeof ret->ret_buf));
+  802ca8:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802cab:	83 ec 04             	sub    $0x4,%esp
+  802cae:	8b 43 04             	mov    0x4(%ebx),%eax
+  802cb1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cb6:	39 d0                	cmp    %edx,%eax
+  802cb8:	0f 47 c2             	cmova  %edx,%eax
+  802cbb:	50                   	push   %eax
+  802cbc:	8b 46 0c             	mov    0xc(%esi),%eax
+  802cbf:	ff 70 04             	push   0x4(%eax)
+  802cc2:	ff 76 04             	push   0x4(%esi)
+  802cc5:	e8 26 f4 ff ff       	call   8020f0 <file_count_reads>
+	readahead(o, o->o_fd->fd_offset);
+  802cca:	8b 46 0c             	mov    0xc(%esi),%eax
+  802ccd:	8b 50 04             	mov    0x4(%eax),%edx
+  802cd0:	89 f0                	mov    %esi,%eax
+  802cd2:	e8 c1 fc ff ff       	call   802998 <readahead>
+	if ((r = file_read(o->o_file, ret->ret_buf,
+  802cd7:	8b 46 0c             	mov    0xc(%esi),%eax
+  802cda:	ff 70 04             	push   0x4(%eax)
+			   MIN(req->req_n, sizeof ret->ret_buf),
+  802cdd:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ce0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ce5:	39 d0                	cmp    %edx,%eax
+  802ce7:	0f 47 c2             	cmova  %edx,%eax
+	if ((r = file_read(o->o_file, ret->ret_buf,
+  802cea:	50                   	push   %eax
+  802ceb:	53                   	push   %ebx
+  802cec:	ff 76 04             	push   0x4(%esi)
+  802cef:	e8 2f f5 ff ff       	call   802223 <file_read>
+  802cf4:	83 c4 20             	add    $0x20,%esp
+  802cf7:	85 c0                	test   %eax,%eax
+  802cf9:	78 06                	js     802d01 <serve_read+0x79>
+	o->o_fd->fd_offset += r;
+  802cfb:	8b 56 0c             	mov    0xc(%esi),%edx
+  802cfe:	01 42 04             	add    %eax,0x4(%edx)
+}
+  802d01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d04:	5b                   	pop    %ebx
+  802d05:	5e                   	pop    %esi
+  802d06:	5d                   	pop    %ebp
+  802d07:	c3                   	ret
+
+00802d08 <serve_write>:
+{
+  802d08:	55                   	push   %ebp
+  802d09:	89 e5                	mov    %esp,%ebp
+  802d0b:	56                   	push   %esi
+  802d0c:	53                   	push   %ebx
+  802d0d:	83 ec 14             	sub    $0x14,%esp
+  802d10:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  802d13:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d16:	50                   	push   %eax
+  802d17:	ff 33                	push   (%ebx)
+  802d19:	ff 75 08             	push   0x8(%ebp)
+  802d1c:	e8 c7 fe ff ff       	call   802be8 <openfile_lookup>
+  802d21:	83 c4 10             	add    $0x10,%esp
+  802d24:	85 c0                	test   %eax,%eax
+  802d26:	78 36                	js     802d5e <serve_write+0x56>
+	if ((o->o_mode & O_ACCMODE) == O_RDONLY)
+  802d28:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802d2b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802d2f:	74 34                	je     802d65 <serve_write+0x5d>
+	if ((r = file_write(o->o_file, req->req_buf,
+  802d31:	8b 46 0c             	mov    0xc(%esi),%eax
+  802d34:	ff 70 04             	push   0x4(%eax)
+			    MIN(req->req_n, sizeof req->req_buf),
+  802d37:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d3a:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802d3f:	39 d0                	cmp    %edx,%eax
+  802d41:	0f 47 c2             	cmova  %edx,%eax
+	if ((r = file_write(o->o_file, req->req_buf,
+  802d44:	50                   	push   %eax
+  802d45:	83 c3 08             	add    $0x8,%ebx
+  802d48:	53                   	push   %ebx
+  802d49:	ff 76 04             	push   0x4(%esi)
+  802d4c:	e8 18 fb ff ff       	call   802869 <file_write>
+  802d51:	83 c4 10             	add    $0x10,%esp
+  802d54:	85 c0                	test   %eax,%eax
+  802d56:	78 06                	js     802d5e <serve_write+0x56>
+	o->o_fd->fd_offset += r;
+  802d58:	8b 56 0c             	mov    0xc(%esi),%edx
+  802d5b:	01 42 04             	add    %eax,0x4(%edx)
+}
+  802d5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d61:	5b                   	pop    %ebx
+  802d62:	5e                   	pop    %esi
+  802d63:	5d                   	pop    %ebp
+  802d64:	c3                   	ret
+		return -E_INVAL;
+  802d65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d6a:	eb f2                	jmp    802d5e <serve_write+0x56>
+
+00802d6c <serve_stat>:
+{
+  802d6c:	55                   	push   %ebp
+  802d6d:	89 e5                	mov    %esp,%ebp
+  802d6f:	56                   	push   %esi
+  802d70:	53                   	push   %ebx
+  802d71:	83 ec 14             	sub    $0x14,%esp
+  802d74:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  802d77:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d7a:	50                   	push   %eax
+  802d7b:	ff 33                	push   (%ebx)
+  802d7d:	ff 75 08             	push   0x8(%ebp)
+  802d80:	e8 63 fe ff ff       	call   802be8 <openfile_lookup>
+  802d85:	83 c4 10             	add    $0x10,%esp
+  802d88:	85 c0                	test   %eax,%eax
+  802d8a:	78 3c                	js     802dc8 <serve_stat+0x5c>
+	strcpy(ret->ret_name, o->o_file->f_name);
+  802d8c:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802d8f:	83 ec 08             	sub    $0x8,%esp
+  802d92:	ff 76 04             	push   0x4(%esi)
+  802d95:	53                   	push   %ebx
+  802d96:	e8 0a 0c 00 00       	call   8039a5 <strcpy>
+	ret->ret_size = o->o_file->f_size;
+  802d9b:	8b 46 04             	mov    0x4(%esi),%eax
+  802d9e:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802da4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  802daa:	8b 46 04             	mov    0x4(%esi),%eax
+  802dad:	83 c4 10             	add    $0x10,%esp
+  802db0:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  802db7:	0f 94 c0             	sete   %al
+  802dba:	0f b6 c0             	movzbl %al,%eax
+  802dbd:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802dc3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802dc8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dcb:	5b                   	pop    %ebx
+  802dcc:	5e                   	pop    %esi
+  802dcd:	5d                   	pop    %ebp
+  802dce:	c3                   	ret
+
+00802dcf <serve_flush>:
+{
+  802dcf:	55                   	push   %ebp
+  802dd0:	89 e5                	mov    %esp,%ebp
+  802dd2:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  802dd5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dd8:	50                   	push   %eax
+  802dd9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ddc:	ff 30                	push   (%eax)
+  802dde:	ff 75 08             	push   0x8(%ebp)
+  802de1:	e8 02 fe ff ff       	call   802be8 <openfile_lookup>
+  802de6:	83 c4 10             	add    $0x10,%esp
+  802de9:	85 c0                	test   %eax,%eax
+  802deb:	78 0b                	js     802df8 <serve_flush+0x29>
+	if ((o->o_mode & O_ACCMODE) == O_RDONLY)
+  802ded:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802df0:	8b 42 08             	mov    0x8(%edx),%eax
+  802df3:	83 e0 03             	and    $0x3,%eax
+  802df6:	75 02                	jne    802dfa <serve_flush+0x2b>
+}
+  802df8:	c9                   	leave
+  802df9:	c3                   	ret
+	return file_flush(o->o_file);
+  802dfa:	83 ec 0c             	sub    $0xc,%esp
+  802dfd:	ff 72 04             	push   0x4(%edx)
+  802e00:	e8 06 fb ff ff       	call   80290b <file_flush>
+  802e05:	83 c4 10             	add    $0x10,%esp
+  802e08:	eb ee                	jmp    802df8 <serve_flush+0x29>
+
+00802e0a <serve_open>:
+{
+  802e0a:	55                   	push   %ebp
+  802e0b:	89 e5                	mov    %esp,%ebp
+  802e0d:	53                   	push   %ebx
+  802e0e:	81 ec 18 04 00 00    	sub    $0x418,%esp
+  802e14:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	memmove(path, req->req_path, MAXPATHLEN);
+  802e17:	68 00 04 00 00       	push   $0x400
+  802e1c:	53                   	push   %ebx
+  802e1d:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  802e23:	50                   	push   %eax
+  802e24:	e8 02 0d 00 00       	call   803b2b <memmove>
+	path[MAXPATHLEN-1] = 0;
+  802e29:	c6 45 f7 00          	movb   $0x0,-0x9(%ebp)
+	if ((r = openfile_alloc(&o)) < 0) {
+  802e2d:	8d 85 f0 fb ff ff    	lea    -0x410(%ebp),%eax
+  802e33:	89 04 24             	mov    %eax,(%esp)
+  802e36:	e8 f9 fc ff ff       	call   802b34 <openfile_alloc>
+  802e3b:	83 c4 10             	add    $0x10,%esp
+  802e3e:	85 c0                	test   %eax,%eax
+  802e40:	0f 88 c5 00 00 00    	js     802f0b <serve_open+0x101>
+	if (req->req_omode & O_CREAT) {
+  802e46:	f6 83 01 04 00 00 01 	testb  $0x1,0x401(%ebx)
+  802e4d:	74 46                	je     802e95 <serve_open+0x8b>
+		if ((r = file_create(path, &f)) < 0) {
+  802e4f:	83 ec 08             	sub    $0x8,%esp
+  802e52:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  802e58:	50                   	push   %eax
+  802e59:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  802e5f:	50                   	push   %eax
+  802e60:	e8 4c f7 ff ff       	call   8025b1 <file_create>
+  802e65:	83 c4 10             	add    $0x10,%esp
+  802e68:	85 c0                	test   %eax,%eax
+  802e6a:	78 1b                	js     802e87 <serve_open+0x7d>
+		if (req->req_omode & O_MKDIR)
+  802e6c:	f6 83 01 04 00 00 08 	testb  $0x8,0x401(%ebx)
+  802e73:	74 3d                	je     802eb2 <serve_open+0xa8>
+			f->f_type = FTYPE_DIR;
+  802e75:	8b 85 f4 fb ff ff    	mov    -0x40c(%ebp),%eax
+  802e7b:	c7 80 84 00 00 00 01 	movl   $0x1,0x84(%eax)
+  802e82:	00 00 00 
+  802e85:	eb 2b                	jmp    802eb2 <serve_open+0xa8>
+			if (!(req->req_omode & O_EXCL) && r == -E_FILE_EXISTS)
+  802e87:	f6 83 01 04 00 00 04 	testb  $0x4,0x401(%ebx)
+  802e8e:	75 7b                	jne    802f0b <serve_open+0x101>
+  802e90:	83 f8 f3             	cmp    $0xfffffff3,%eax
+  802e93:	75 76                	jne    802f0b <serve_open+0x101>
+		if ((r = file_open(path, &f)) < 0) {
+  802e95:	83 ec 08             	sub    $0x8,%esp
+  802e98:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  802e9e:	50                   	push   %eax
+  802e9f:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  802ea5:	50                   	push   %eax
+  802ea6:	e8 5e f3 ff ff       	call   802209 <file_open>
+  802eab:	83 c4 10             	add    $0x10,%esp
+  802eae:	85 c0                	test   %eax,%eax
+  802eb0:	78 59                	js     802f0b <serve_open+0x101>
+	if (req->req_omode & O_TRUNC) {
+  802eb2:	f6 83 01 04 00 00 02 	testb  $0x2,0x401(%ebx)
+  802eb9:	75 55                	jne    802f10 <serve_open+0x106>
+	o->o_file = f;
+  802ebb:	8b 85 f0 fb ff ff    	mov    -0x410(%ebp),%eax
+  802ec1:	8b 95 f4 fb ff ff    	mov    -0x40c(%ebp),%edx
+  802ec7:	89 50 04             	mov    %edx,0x4(%eax)
+	o->o_fd->fd_file.id = o->o_fileid;
+  802eca:	8b 50 0c             	mov    0xc(%eax),%edx
+  802ecd:	8b 08                	mov    (%eax),%ecx
+  802ecf:	89 4a 0c             	mov    %ecx,0xc(%edx)
+	o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+  802ed2:	8b 48 0c             	mov    0xc(%eax),%ecx
+  802ed5:	8b 93 00 04 00 00    	mov    0x400(%ebx),%edx
+  802edb:	83 e2 03             	and    $0x3,%edx
+  802ede:	89 51 08             	mov    %edx,0x8(%ecx)
+	o->o_fd->fd_dev_id = devfile.dev_id;
+  802ee1:	8b 50 0c             	mov    0xc(%eax),%edx
+  802ee4:	8b 0d 64 00 81 00    	mov    0x810064,%ecx
+  802eea:	89 0a                	mov    %ecx,(%edx)
+	o->o_mode = req->req_omode;
+  802eec:	8b 93 00 04 00 00    	mov    0x400(%ebx),%edx
+  802ef2:	89 50 08             	mov    %edx,0x8(%eax)
+	*pg_store = o->o_fd;
+  802ef5:	8b 50 0c             	mov    0xc(%eax),%edx
+  802ef8:	8b 45 10             	mov    0x10(%ebp),%eax
+  802efb:	89 10                	mov    %edx,(%eax)
+	*perm_store = PTE_P|PTE_U|PTE_W|PTE_SHARE;
+  802efd:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f00:	c7 00 07 04 00 00    	movl   $0x407,(%eax)
+	return 0;
+  802f06:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f0e:	c9                   	leave
+  802f0f:	c3                   	ret
+		if ((r = file_set_size(f, 0)) < 0) {
+  802f10:	83 ec 08             	sub    $0x8,%esp
+  802f13:	6a 00                	push   $0x0
+  802f15:	ff b5 f4 fb ff ff    	push   -0x40c(%ebp)
+  802f1b:	e8 cb f3 ff ff       	call   8022eb <file_set_size>
+  802f20:	83 c4 10             	add    $0x10,%esp
+  802f23:	85 c0                	test   %eax,%eax
+  802f25:	79 94                	jns    802ebb <serve_open+0xb1>
+  802f27:	eb e2                	jmp    802f0b <serve_open+0x101>
+
+00802f29 <serve_readmap>:
+{
+  802f29:	55                   	push   %ebp
+  802f2a:	89 e5                	mov    %esp,%ebp
+  802f2c:	57                   	push   %edi
+  802f2d:	56                   	push   %esi
+  802f2e:	53                   	push   %ebx
+  802f2f:	83 ec 30             	sub    $0x30,%esp
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  802f32:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802f35:	50                   	push   %eax
+  802f36:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f39:	ff 30                	push   (%eax)
+  802f3b:	ff 75 08             	push   0x8(%ebp)
+  802f3e:	e8 a5 fc ff ff       	call   802be8 <openfile_lookup>
+  802f43:	83 c4 10             	add    $0x10,%esp
+  802f46:	85 c0                	test   %eax,%eax
+  802f48:	0f 88 dc 00 00 00    	js     80302a <serve_readmap+0x101>
+	offset = o->o_fd->fd_offset;
+  802f4e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802f51:	8b 47 0c             	mov    0xc(%edi),%eax
+  802f54:	8b 70 04             	mov    0x4(%eax),%esi
+  802f57:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+	if (offset % BLKSIZE || offset + BLKSIZE > o->o_file->f_size)
+  802f5a:	89 f3                	mov    %esi,%ebx
+  802f5c:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  802f62:	0f 85 ca 00 00 00    	jne    803032 <serve_readmap+0x109>
+  802f68:	8b 57 04             	mov    0x4(%edi),%edx
+  802f6b:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802f71:	8d 8e ff 0f 00 00    	lea    0xfff(%esi),%ecx
+  802f77:	39 c1                	cmp    %eax,%ecx
+  802f79:	0f 8d ba 00 00 00    	jge    803039 <serve_readmap+0x110>
+	n = MIN(req->req_n / BLKSIZE, (o->o_file->f_size - offset) / BLKSIZE);
+  802f7f:	29 f0                	sub    %esi,%eax
+  802f81:	8d b0 ff 0f 00 00    	lea    0xfff(%eax),%esi
+  802f87:	0f 49 f0             	cmovns %eax,%esi
+  802f8a:	c1 fe 0c             	sar    $0xc,%esi
+	n = MAX(MIN(n, READMAP_MAXBLOCKS), 1);
+  802f8d:	b8 20 00 00 00       	mov    $0x20,%eax
+  802f92:	39 c6                	cmp    %eax,%esi
+  802f94:	0f 47 f0             	cmova  %eax,%esi
+	n = MIN(req->req_n / BLKSIZE, (o->o_file->f_size - offset) / BLKSIZE);
+  802f97:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f9a:	8b 40 04             	mov    0x4(%eax),%eax
+  802f9d:	c1 e8 0c             	shr    $0xc,%eax
+	n = MAX(MIN(n, READMAP_MAXBLOCKS), 1);
+  802fa0:	39 c6                	cmp    %eax,%esi
+  802fa2:	0f 46 c6             	cmovbe %esi,%eax
+  802fa5:	89 c6                	mov    %eax,%esi
+  802fa7:	85 c0                	test   %eax,%eax
+  802fa9:	b8 01 00 00 00       	mov    $0x1,%eax
+  802fae:	0f 45 c6             	cmovne %esi,%eax
+  802fb1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	file_count_reads(o->o_file, offset, n*BLKSIZE);
+  802fb4:	89 c6                	mov    %eax,%esi
+  802fb6:	c1 e6 0c             	shl    $0xc,%esi
+  802fb9:	83 ec 04             	sub    $0x4,%esp
+  802fbc:	56                   	push   %esi
+  802fbd:	53                   	push   %ebx
+  802fbe:	52                   	push   %edx
+  802fbf:	e8 2c f1 ff ff       	call   8020f0 <file_count_reads>
+	for (i = 0; i < n; i++)
+  802fc4:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  802fc7:	01 ce                	add    %ecx,%esi
+  802fc9:	83 c4 10             	add    $0x10,%esp
+  802fcc:	eb 0f                	jmp    802fdd <serve_readmap+0xb4>
+		readahead(o, offset + i*BLKSIZE);
+  802fce:	89 da                	mov    %ebx,%edx
+  802fd0:	89 f8                	mov    %edi,%eax
+  802fd2:	e8 c1 f9 ff ff       	call   802998 <readahead>
+	for (i = 0; i < n; i++)
+  802fd7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802fdd:	39 f3                	cmp    %esi,%ebx
+  802fdf:	75 ed                	jne    802fce <serve_readmap+0xa5>
+	if ((r = file_get_blocks(o->o_file, offset / BLKSIZE, n, &blk)) < 0)
+  802fe1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802fe4:	50                   	push   %eax
+  802fe5:	ff 75 d0             	push   -0x30(%ebp)
+  802fe8:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  802feb:	8d 81 ff 0f 00 00    	lea    0xfff(%ecx),%eax
+  802ff1:	85 c9                	test   %ecx,%ecx
+  802ff3:	0f 49 c1             	cmovns %ecx,%eax
+  802ff6:	c1 f8 0c             	sar    $0xc,%eax
+  802ff9:	50                   	push   %eax
+  802ffa:	ff 77 04             	push   0x4(%edi)
+  802ffd:	e8 2d f0 ff ff       	call   80202f <file_get_blocks>
+  803002:	89 c2                	mov    %eax,%edx
+  803004:	83 c4 10             	add    $0x10,%esp
+  803007:	85 c0                	test   %eax,%eax
+  803009:	78 1f                	js     80302a <serve_readmap+0x101>
+	o->o_fd->fd_offset += r*BLKSIZE;
+  80300b:	8b 4f 0c             	mov    0xc(%edi),%ecx
+  80300e:	c1 e0 0c             	shl    $0xc,%eax
+  803011:	01 41 04             	add    %eax,0x4(%ecx)
+	*pg_store = blk;
+  803014:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  803017:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80301a:	89 19                	mov    %ebx,(%ecx)
+	*npg_store = r;
+  80301c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80301f:	89 11                	mov    %edx,(%ecx)
+	*perm_store = PTE_P|PTE_U|PTE_COW;
+  803021:	8b 55 18             	mov    0x18(%ebp),%edx
+  803024:	c7 02 05 08 00 00    	movl   $0x805,(%edx)
+}
+  80302a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80302d:	5b                   	pop    %ebx
+  80302e:	5e                   	pop    %esi
+  80302f:	5f                   	pop    %edi
+  803030:	5d                   	pop    %ebp
+  803031:	c3                   	ret
+		return -E_INVAL;
+  803032:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803037:	eb f1                	jmp    80302a <serve_readmap+0x101>
+  803039:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80303e:	eb ea                	jmp    80302a <serve_readmap+0x101>
+
+00803040 <serve_pagein>:
+{
+  803040:	55                   	push   %ebp
+  803041:	89 e5                	mov    %esp,%ebp
+  803043:	57                   	push   %edi
+  803044:	56                   	push   %esi
+  803045:	53                   	push   %ebx
+  803046:	83 ec 2c             	sub    $0x2c,%esp
+  803049:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	offset = req->req_offset;
+  80304c:	8b 73 04             	mov    0x4(%ebx),%esi
+	n = MIN(req->req_n, PGSIZE);
+  80304f:	8b 7b 08             	mov    0x8(%ebx),%edi
+	perm = req->req_perm;
+  803052:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803055:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	if (offset % BLKSIZE)
+  803058:	89 f0                	mov    %esi,%eax
+  80305a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80305f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803062:	0f 85 b8 00 00 00    	jne    803120 <serve_pagein+0xe0>
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  803068:	83 ec 04             	sub    $0x4,%esp
+  80306b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80306e:	50                   	push   %eax
+  80306f:	ff 33                	push   (%ebx)
+  803071:	ff 75 08             	push   0x8(%ebp)
+  803074:	e8 6f fb ff ff       	call   802be8 <openfile_lookup>
+  803079:	83 c4 10             	add    $0x10,%esp
+  80307c:	85 c0                	test   %eax,%eax
+  80307e:	78 6d                	js     8030ed <serve_pagein+0xad>
+	n = MIN(req->req_n, PGSIZE);
+  803080:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803085:	39 c7                	cmp    %eax,%edi
+  803087:	0f 46 c7             	cmovbe %edi,%eax
+  80308a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	file_count_reads(o->o_file, offset, n);
+  80308d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803090:	83 ec 04             	sub    $0x4,%esp
+  803093:	50                   	push   %eax
+  803094:	56                   	push   %esi
+  803095:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  803098:	ff 71 04             	push   0x4(%ecx)
+  80309b:	e8 50 f0 ff ff       	call   8020f0 <file_count_reads>
+	readahead(o, offset);
+  8030a0:	89 f2                	mov    %esi,%edx
+  8030a2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8030a5:	e8 ee f8 ff ff       	call   802998 <readahead>
+	if ((r = file_get_block(o->o_file, offset / BLKSIZE, &blk)) < 0)
+  8030aa:	83 c4 0c             	add    $0xc,%esp
+  8030ad:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8030b0:	50                   	push   %eax
+  8030b1:	8d 86 ff 0f 00 00    	lea    0xfff(%esi),%eax
+  8030b7:	85 f6                	test   %esi,%esi
+  8030b9:	0f 49 c6             	cmovns %esi,%eax
+  8030bc:	c1 f8 0c             	sar    $0xc,%eax
+  8030bf:	50                   	push   %eax
+  8030c0:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8030c3:	ff 71 04             	push   0x4(%ecx)
+  8030c6:	e8 c5 e9 ff ff       	call   801a90 <file_get_block>
+  8030cb:	83 c4 10             	add    $0x10,%esp
+  8030ce:	85 c0                	test   %eax,%eax
+  8030d0:	78 1b                	js     8030ed <serve_pagein+0xad>
+	if (n == PGSIZE) {
+  8030d2:	81 ff ff 0f 00 00    	cmp    $0xfff,%edi
+  8030d8:	76 1b                	jbe    8030f5 <serve_pagein+0xb5>
+		*pg_store = blk;
+  8030da:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8030dd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8030e0:	89 18                	mov    %ebx,(%eax)
+	*perm_store = perm;
+  8030e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8030e5:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  8030e8:	89 10                	mov    %edx,(%eax)
+	return 0;
+  8030ea:	8b 45 d0             	mov    -0x30(%ebp),%eax
+}
+  8030ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030f0:	5b                   	pop    %ebx
+  8030f1:	5e                   	pop    %esi
+  8030f2:	5f                   	pop    %edi
+  8030f3:	5d                   	pop    %ebp
+  8030f4:	c3                   	ret
+		memmove(req, blk, n);
+  8030f5:	83 ec 04             	sub    $0x4,%esp
+  8030f8:	8b 7d c8             	mov    -0x38(%ebp),%edi
+  8030fb:	57                   	push   %edi
+  8030fc:	ff 75 e0             	push   -0x20(%ebp)
+  8030ff:	53                   	push   %ebx
+  803100:	e8 26 0a 00 00       	call   803b2b <memmove>
+		memset((char *) req + n, 0, PGSIZE - n);
+  803105:	83 c4 0c             	add    $0xc,%esp
+  803108:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80310d:	29 f8                	sub    %edi,%eax
+  80310f:	50                   	push   %eax
+  803110:	6a 00                	push   $0x0
+  803112:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+  803115:	50                   	push   %eax
+  803116:	e8 db 09 00 00       	call   803af6 <memset>
+  80311b:	83 c4 10             	add    $0x10,%esp
+  80311e:	eb bd                	jmp    8030dd <serve_pagein+0x9d>
+		return -E_INVAL;
+  803120:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803125:	eb c6                	jmp    8030ed <serve_pagein+0xad>
+
+00803127 <serve>:
+};
+#define NHANDLERS (sizeof(handlers)/sizeof(handlers[0]))
+
+void
+serve(void)
+{
+  803127:	55                   	push   %ebp
+  803128:	89 e5                	mov    %esp,%ebp
+  80312a:	56                   	push   %esi
+  80312b:	53                   	push   %ebx
+  80312c:	83 ec 10             	sub    $0x10,%esp
+	size_t npg;
+	void *pg;
+
+	while (1) {
+		perm = 0;
+		req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+  80312f:	8d 5d f0             	lea    -0x10(%ebp),%ebx
+  803132:	8d 75 f4             	lea    -0xc(%ebp),%esi
+  803135:	eb 13                	jmp    80314a <serve+0x23>
+			cprintf("fs req %d from %08x [page %08x: %s]\n",
+				req, whom, uvpt[PGNUM(fsreq)], fsreq);
+
+		// All requests must contain an argument page
+		if (!(perm & PTE_P)) {
+			cprintf("Invalid request from %08x: no argument page\n",
+  803137:	83 ec 08             	sub    $0x8,%esp
+  80313a:	ff 75 f4             	push   -0xc(%ebp)
+  80313d:	68 20 82 80 00       	push   $0x808220
+  803142:	e8 77 02 00 00       	call   8033be <cprintf>
+				whom);
+			continue; // just leave it hanging...
+  803147:	83 c4 10             	add    $0x10,%esp
+		perm = 0;
+  80314a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+		req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+  803151:	83 ec 04             	sub    $0x4,%esp
+  803154:	53                   	push   %ebx
+  803155:	ff 35 54 90 80 00    	push   0x809054
+  80315b:	56                   	push   %esi
+  80315c:	e8 76 14 00 00       	call   8045d7 <ipc_recv>
+		if (!(perm & PTE_P)) {
+  803161:	83 c4 10             	add    $0x10,%esp
+  803164:	f6 45 f0 01          	testb  $0x1,-0x10(%ebp)
+  803168:	74 cd                	je     803137 <serve+0x10>
+		}
+
+		pg = NULL;
+  80316a:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+		npg = 1;
+  803171:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%ebp)
+		if (req == FSREQ_OPEN) {
+  803178:	83 f8 01             	cmp    $0x1,%eax
+  80317b:	74 2d                	je     8031aa <serve+0x83>
+			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
+		} else if (req == FSREQ_READMAP) {
+  80317d:	83 f8 0b             	cmp    $0xb,%eax
+  803180:	74 40                	je     8031c2 <serve+0x9b>
+			r = serve_readmap(whom, (struct Fsreq_readmap*)fsreq, &pg, &npg, &perm);
+		} else if (req == FSREQ_PAGEIN) {
+  803182:	83 f8 09             	cmp    $0x9,%eax
+  803185:	74 5a                	je     8031e1 <serve+0xba>
+			r = serve_pagein(whom, (struct Fsreq_pagein*)fsreq, &pg, &perm);
+		} else if (req < NHANDLERS && handlers[req]) {
+  803187:	83 f8 0c             	cmp    $0xc,%eax
+  80318a:	77 6d                	ja     8031f9 <serve+0xd2>
+  80318c:	8b 14 85 20 90 80 00 	mov    0x809020(,%eax,4),%edx
+  803193:	85 d2                	test   %edx,%edx
+  803195:	74 62                	je     8031f9 <serve+0xd2>
+			r = handlers[req](whom, fsreq);
+  803197:	83 ec 08             	sub    $0x8,%esp
+  80319a:	ff 35 54 90 80 00    	push   0x809054
+  8031a0:	ff 75 f4             	push   -0xc(%ebp)
+  8031a3:	ff d2                	call   *%edx
+  8031a5:	83 c4 10             	add    $0x10,%esp
+  8031a8:	eb 68                	jmp    803212 <serve+0xeb>
+			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
+  8031aa:	53                   	push   %ebx
+  8031ab:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  8031ae:	50                   	push   %eax
+  8031af:	ff 35 54 90 80 00    	push   0x809054
+  8031b5:	ff 75 f4             	push   -0xc(%ebp)
+  8031b8:	e8 4d fc ff ff       	call   802e0a <serve_open>
+  8031bd:	83 c4 10             	add    $0x10,%esp
+  8031c0:	eb 50                	jmp    803212 <serve+0xeb>
+			r = serve_readmap(whom, (struct Fsreq_readmap*)fsreq, &pg, &npg, &perm);
+  8031c2:	83 ec 0c             	sub    $0xc,%esp
+  8031c5:	53                   	push   %ebx
+  8031c6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8031c9:	50                   	push   %eax
+  8031ca:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  8031cd:	50                   	push   %eax
+  8031ce:	ff 35 54 90 80 00    	push   0x809054
+  8031d4:	ff 75 f4             	push   -0xc(%ebp)
+  8031d7:	e8 4d fd ff ff       	call   802f29 <serve_readmap>
+  8031dc:	83 c4 20             	add    $0x20,%esp
+  8031df:	eb 31                	jmp    803212 <serve+0xeb>
+			r = serve_pagein(whom, (struct Fsreq_pagein*)fsreq, &pg, &perm);
+  8031e1:	53                   	push   %ebx
+  8031e2:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  8031e5:	50                   	push   %eax
+  8031e6:	ff 35 54 90 80 00    	push   0x809054
+  8031ec:	ff 75 f4             	push   -0xc(%ebp)
+  8031ef:	e8 4c fe ff ff       	call   803040 <serve_pagein>
+  8031f4:	83 c4 10             	add    $0x10,%esp
+  8031f7:	eb 19                	jmp    803212 <serve+0xeb>
+		} else {
+			cprintf("Invalid request code %d from %08x\n", req, whom);
+  8031f9:	83 ec 04             	sub    $0x4,%esp
+  8031fc:	ff 75 f4             	push   -0xc(%ebp)
+  8031ff:	50                   	push   %eax
+  803200:	68 50 82 80 00       	push   $0x808250
+  803205:	e8 b4 01 00 00       	call   8033be <cprintf>
+  80320a:	83 c4 10             	add    $0x10,%esp
+			r = -E_INVAL;
+  80320d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+		}
+		ipc_send_pages(whom, r, pg, npg, perm);
+  803212:	83 ec 0c             	sub    $0xc,%esp
+  803215:	ff 75 f0             	push   -0x10(%ebp)
+  803218:	ff 75 ec             	push   -0x14(%ebp)
+  80321b:	ff 75 e8             	push   -0x18(%ebp)
+  80321e:	50                   	push   %eax
+  80321f:	ff 75 f4             	push   -0xc(%ebp)
+  803222:	e8 31 14 00 00       	call   804658 <ipc_send_pages>
+		sys_page_unmap(0, fsreq);
+  803227:	83 c4 18             	add    $0x18,%esp
+  80322a:	ff 35 54 90 80 00    	push   0x809054
+  803230:	6a 00                	push   $0x0
+  803232:	e8 e6 0c 00 00       	call   803f1d <sys_page_unmap>
+  803237:	83 c4 10             	add    $0x10,%esp
+  80323a:	e9 0b ff ff ff       	jmp    80314a <serve+0x23>
+
+0080323f <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  80323f:	55                   	push   %ebp
+  803240:	89 e5                	mov    %esp,%ebp
+  803242:	83 ec 14             	sub    $0x14,%esp
+	static_assert(sizeof(struct File) == 256);
+	binaryname = "fs";
+  803245:	c7 05 60 00 81 00 73 	movl   $0x808273,0x810060
+  80324c:	82 80 00 
+	cprintf("FS is running\n");
+  80324f:	68 76 82 80 00       	push   $0x808276
+  803254:	e8 65 01 00 00       	call   8033be <cprintf>
+	__asm __volatile("outw %0,%w1" : : "a" (data), "d" (port));
+  803259:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+  80325e:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+  803263:	66 ef                	out    %ax,(%dx)
+
+	// Check that we are able to do I/O
+	outw(0x8A00, 0x8A00);
+	cprintf("FS can do I/O\n");
+  803265:	c7 04 24 85 82 80 00 	movl   $0x808285,(%esp)
+  80326c:	e8 4d 01 00 00       	call   8033be <cprintf>
+
+	serve_init();
+  803271:	e8 97 f8 ff ff       	call   802b0d <serve_init>
+	fs_init();
+  803276:	e8 a4 e7 ff ff       	call   801a1f <fs_init>
+	serve();
+  80327b:	e8 a7 fe ff ff       	call   803127 <serve>
+
+00803280 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  803280:	55                   	push   %ebp
+  803281:	89 e5                	mov    %esp,%ebp
+  803283:	56                   	push   %esi
+  803284:	53                   	push   %ebx
+  803285:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803288:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  80328b:	e8 ca 0b 00 00       	call   803e5a <sys_getenvid>
+  803290:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803295:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  803298:	c1 e0 06             	shl    $0x6,%eax
+  80329b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8032a0:	a3 3c a9 85 00       	mov    %eax,0x85a93c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8032a5:	85 db                	test   %ebx,%ebx
+  8032a7:	7e 07                	jle    8032b0 <libmain+0x30>
+		binaryname = argv[0];
+  8032a9:	8b 06                	mov    (%esi),%eax
+  8032ab:	a3 60 00 81 00       	mov    %eax,0x810060
+
+	// call user main routine
+	umain(argc, argv);
+  8032b0:	83 ec 08             	sub    $0x8,%esp
+  8032b3:	56                   	push   %esi
+  8032b4:	53                   	push   %ebx
+  8032b5:	e8 85 ff ff ff       	call   80323f <umain>
+
+	// exit gracefully
+	exit();
+  8032ba:	e8 0a 00 00 00       	call   8032c9 <exit>
+}
+  8032bf:	83 c4 10             	add    $0x10,%esp
+  8032c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032c5:	5b                   	pop    %ebx
+  8032c6:	5e                   	pop    %esi
+  8032c7:	5d                   	pop    %ebp
+  8032c8:	c3                   	ret
+
+008032c9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8032c9:	55                   	push   %ebp
+  8032ca:	89 e5                	mov    %esp,%ebp
+  8032cc:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8032cf:	e8 c6 16 00 00       	call   80499a <close_all>
+	sys_env_destroy(0);
+  8032d4:	83 ec 0c             	sub    $0xc,%esp
+  8032d7:	6a 00                	push   $0x0
+  8032d9:	e8 3b 0b 00 00       	call   803e19 <sys_env_destroy>
+}
+  8032de:	83 c4 10             	add    $0x10,%esp
+  8032e1:	c9                   	leave
+  8032e2:	c3                   	ret
+
+008032e3 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8032e3:	55                   	push   %ebp
+  8032e4:	89 e5                	mov    %esp,%ebp
+  8032e6:	56                   	push   %esi
+  8032e7:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8032e8:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8032eb:	8b 35 60 00 81 00    	mov    0x810060,%esi
+  8032f1:	e8 64 0b 00 00       	call   803e5a <sys_getenvid>
+  8032f6:	83 ec 0c             	sub    $0xc,%esp
+  8032f9:	ff 75 0c             	push   0xc(%ebp)
+  8032fc:	ff 75 08             	push   0x8(%ebp)
+  8032ff:	56                   	push   %esi
+  803300:	50                   	push   %eax
+  803301:	68 a0 82 80 00       	push   $0x8082a0
+  803306:	e8 b3 00 00 00       	call   8033be <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80330b:	83 c4 18             	add    $0x18,%esp
+  80330e:	53                   	push   %ebx
+  80330f:	ff 75 10             	push   0x10(%ebp)
+  803312:	e8 56 00 00 00       	call   80336d <vcprintf>
+	cprintf("\n");
+  803317:	c7 04 24 92 82 80 00 	movl   $0x808292,(%esp)
+  80331e:	e8 9b 00 00 00       	call   8033be <cprintf>
+  803323:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803326:	cc                   	int3
+	while (1)
+  803327:	eb fd                	jmp    803326 <_panic+0x43>
+
+00803329 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  803329:	55                   	push   %ebp
+  80332a:	89 e5                	mov    %esp,%ebp
+  80332c:	53                   	push   %ebx
+  80332d:	83 ec 04             	sub    $0x4,%esp
+  803330:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  803333:	8b 13                	mov    (%ebx),%edx
+  803335:	8d 42 01             	lea    0x1(%edx),%eax
+  803338:	89 03                	mov    %eax,(%ebx)
+  80333a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80333d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  803341:	3d ff 00 00 00       	cmp    $0xff,%eax
+  803346:	74 09                	je     803351 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  803348:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80334c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80334f:	c9                   	leave
+  803350:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  803351:	83 ec 08             	sub    $0x8,%esp
+  803354:	68 ff 00 00 00       	push   $0xff
+  803359:	8d 43 08             	lea    0x8(%ebx),%eax
+  80335c:	50                   	push   %eax
+  80335d:	e8 69 0a 00 00       	call   803dcb <sys_cputs>
+		b->idx = 0;
+  803362:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803368:	83 c4 10             	add    $0x10,%esp
+  80336b:	eb db                	jmp    803348 <putch+0x1f>
+
+0080336d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80336d:	55                   	push   %ebp
+  80336e:	89 e5                	mov    %esp,%ebp
+  803370:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  803376:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80337d:	00 00 00 
+	b.cnt = 0;
+  803380:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  803387:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80338a:	ff 75 0c             	push   0xc(%ebp)
+  80338d:	ff 75 08             	push   0x8(%ebp)
+  803390:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  803396:	50                   	push   %eax
+  803397:	68 29 33 80 00       	push   $0x803329
+  80339c:	e8 14 01 00 00       	call   8034b5 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8033a1:	83 c4 08             	add    $0x8,%esp
+  8033a4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8033aa:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8033b0:	50                   	push   %eax
+  8033b1:	e8 15 0a 00 00       	call   803dcb <sys_cputs>
+
+	return b.cnt;
+}
+  8033b6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8033bc:	c9                   	leave
+  8033bd:	c3                   	ret
+
+008033be <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8033be:	55                   	push   %ebp
+  8033bf:	89 e5                	mov    %esp,%ebp
+  8033c1:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8033c4:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8033c7:	50                   	push   %eax
+  8033c8:	ff 75 08             	push   0x8(%ebp)
+  8033cb:	e8 9d ff ff ff       	call   80336d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8033d0:	c9                   	leave
+  8033d1:	c3                   	ret
+
+008033d2 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8033d2:	55                   	push   %ebp
+  8033d3:	89 e5                	mov    %esp,%ebp
+  8033d5:	57                   	push   %edi
+  8033d6:	56                   	push   %esi
+  8033d7:	53                   	push   %ebx
+  8033d8:	83 ec 1c             	sub    $0x1c,%esp
+  8033db:	89 c7                	mov    %eax,%edi
+  8033dd:	89 d6                	mov    %edx,%esi
+  8033df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033e5:	89 d1                	mov    %edx,%ecx
+  8033e7:	89 c2                	mov    %eax,%edx
+  8033e9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8033ec:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8033ef:	8b 45 10             	mov    0x10(%ebp),%eax
+  8033f2:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8033f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8033f8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8033ff:	39 c2                	cmp    %eax,%edx
+  803401:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  803404:	72 3e                	jb     803444 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  803406:	83 ec 0c             	sub    $0xc,%esp
+  803409:	ff 75 18             	push   0x18(%ebp)
+  80340c:	83 eb 01             	sub    $0x1,%ebx
+  80340f:	53                   	push   %ebx
+  803410:	50                   	push   %eax
+  803411:	83 ec 08             	sub    $0x8,%esp
+  803414:	ff 75 e4             	push   -0x1c(%ebp)
+  803417:	ff 75 e0             	push   -0x20(%ebp)
+  80341a:	ff 75 dc             	push   -0x24(%ebp)
+  80341d:	ff 75 d8             	push   -0x28(%ebp)
+  803420:	e8 4e 49 00 00       	call   807d73 <__udivdi3>
+  803425:	83 c4 18             	add    $0x18,%esp
+  803428:	52                   	push   %edx
+  803429:	50                   	push   %eax
+  80342a:	89 f2                	mov    %esi,%edx
+  80342c:	89 f8                	mov    %edi,%eax
+  80342e:	e8 9f ff ff ff       	call   8033d2 <printnum>
+  803433:	83 c4 20             	add    $0x20,%esp
+  803436:	eb 13                	jmp    80344b <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  803438:	83 ec 08             	sub    $0x8,%esp
+  80343b:	56                   	push   %esi
+  80343c:	ff 75 18             	push   0x18(%ebp)
+  80343f:	ff d7                	call   *%edi
+  803441:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  803444:	83 eb 01             	sub    $0x1,%ebx
+  803447:	85 db                	test   %ebx,%ebx
+  803449:	7f ed                	jg     803438 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80344b:	83 ec 08             	sub    $0x8,%esp
+  80344e:	56                   	push   %esi
+  80344f:	83 ec 04             	sub    $0x4,%esp
+  803452:	ff 75 e4             	push   -0x1c(%ebp)
+  803455:	ff 75 e0             	push   -0x20(%ebp)
+  803458:	ff 75 dc             	push   -0x24(%ebp)
+  80345b:	ff 75 d8             	push   -0x28(%ebp)
+  80345e:	e8 2e 49 00 00       	call   807d91 <__umoddi3>
+  803463:	83 c4 14             	add    $0x14,%esp
+  803466:	0f be 80 c3 82 80 00 	movsbl 0x8082c3(%eax),%eax
+  80346d:	50                   	push   %eax
+  80346e:	ff d7                	call   *%edi
+}
+  803470:	83 c4 10             	add    $0x10,%esp
+  803473:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803476:	5b                   	pop    %ebx
+  803477:	5e                   	pop    %esi
+  803478:	5f                   	pop    %edi
+  803479:	5d                   	pop    %ebp
+  80347a:	c3                   	ret
+
+0080347b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80347b:	55                   	push   %ebp
+  80347c:	89 e5                	mov    %esp,%ebp
+  80347e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  803481:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  803485:	8b 10                	mov    (%eax),%edx
+  803487:	3b 50 04             	cmp    0x4(%eax),%edx
+  80348a:	73 0a                	jae    803496 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80348c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80348f:	89 08                	mov    %ecx,(%eax)
+  803491:	8b 45 08             	mov    0x8(%ebp),%eax
+  803494:	88 02                	mov    %al,(%edx)
+}
+  803496:	5d                   	pop    %ebp
+  803497:	c3                   	ret
+
+00803498 <printfmt>:
+{
+  803498:	55                   	push   %ebp
+  803499:	89 e5                	mov    %esp,%ebp
+  80349b:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80349e:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8034a1:	50                   	push   %eax
+  8034a2:	ff 75 10             	push   0x10(%ebp)
+  8034a5:	ff 75 0c             	push   0xc(%ebp)
+  8034a8:	ff 75 08             	push   0x8(%ebp)
+  8034ab:	e8 05 00 00 00       	call   8034b5 <vprintfmt>
+}
+  8034b0:	83 c4 10             	add    $0x10,%esp
+  8034b3:	c9                   	leave
+  8034b4:	c3                   	ret
+
+008034b5 <vprintfmt>:
+{
+  8034b5:	55                   	push   %ebp
+  8034b6:	89 e5                	mov    %esp,%ebp
+  8034b8:	57                   	push   %edi
+  8034b9:	56                   	push   %esi
+  8034ba:	53                   	push   %ebx
+  8034bb:	83 ec 2c             	sub    $0x2c,%esp
+  8034be:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034c1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8034c4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8034c7:	eb 0a                	jmp    8034d3 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8034c9:	83 ec 08             	sub    $0x8,%esp
+  8034cc:	53                   	push   %ebx
+  8034cd:	50                   	push   %eax
+  8034ce:	ff d6                	call   *%esi
+  8034d0:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8034d3:	83 c7 01             	add    $0x1,%edi
+  8034d6:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8034da:	83 f8 25             	cmp    $0x25,%eax
+  8034dd:	74 0c                	je     8034eb <vprintfmt+0x36>
+			if (ch == '\0')
+  8034df:	85 c0                	test   %eax,%eax
+  8034e1:	75 e6                	jne    8034c9 <vprintfmt+0x14>
+}
+  8034e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034e6:	5b                   	pop    %ebx
+  8034e7:	5e                   	pop    %esi
+  8034e8:	5f                   	pop    %edi
+  8034e9:	5d                   	pop    %ebp
+  8034ea:	c3                   	ret
+		padc = ' ';
+  8034eb:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8034ef:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8034f6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8034fd:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  803504:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  803509:	8d 47 01             	lea    0x1(%edi),%eax
+  80350c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80350f:	0f b6 17             	movzbl (%edi),%edx
+  803512:	8d 42 dd             	lea    -0x23(%edx),%eax
+  803515:	3c 55                	cmp    $0x55,%al
+  803517:	0f 87 c5 03 00 00    	ja     8038e2 <vprintfmt+0x42d>
+  80351d:	0f b6 c0             	movzbl %al,%eax
+  803520:	ff 24 85 40 84 80 00 	jmp    *0x808440(,%eax,4)
+  803527:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80352a:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80352e:	eb d9                	jmp    803509 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  803530:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803533:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  803537:	eb d0                	jmp    803509 <vprintfmt+0x54>
+  803539:	0f b6 d2             	movzbl %dl,%edx
+  80353c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80353f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803544:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  803547:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80354a:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80354e:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  803551:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  803554:	83 f9 09             	cmp    $0x9,%ecx
+  803557:	77 55                	ja     8035ae <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  803559:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80355c:	eb e9                	jmp    803547 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80355e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803561:	8b 00                	mov    (%eax),%eax
+  803563:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803566:	8b 45 14             	mov    0x14(%ebp),%eax
+  803569:	8d 40 04             	lea    0x4(%eax),%eax
+  80356c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80356f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  803572:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  803576:	79 91                	jns    803509 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  803578:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80357b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80357e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  803585:	eb 82                	jmp    803509 <vprintfmt+0x54>
+			if (width < 0)
+  803587:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80358a:	85 d2                	test   %edx,%edx
+  80358c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803591:	0f 49 c2             	cmovns %edx,%eax
+  803594:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  803597:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80359a:	e9 6a ff ff ff       	jmp    803509 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80359f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8035a2:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8035a9:	e9 5b ff ff ff       	jmp    803509 <vprintfmt+0x54>
+  8035ae:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8035b1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8035b4:	eb bc                	jmp    803572 <vprintfmt+0xbd>
+			lflag++;
+  8035b6:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8035b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8035bc:	e9 48 ff ff ff       	jmp    803509 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8035c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8035c4:	8d 78 04             	lea    0x4(%eax),%edi
+  8035c7:	83 ec 08             	sub    $0x8,%esp
+  8035ca:	53                   	push   %ebx
+  8035cb:	ff 30                	push   (%eax)
+  8035cd:	ff d6                	call   *%esi
+			break;
+  8035cf:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8035d2:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8035d5:	e9 63 02 00 00       	jmp    80383d <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8035da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8035dd:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8035e0:	8b 10                	mov    (%eax),%edx
+  8035e2:	89 d0                	mov    %edx,%eax
+  8035e4:	f7 d8                	neg    %eax
+  8035e6:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8035e9:	83 f8 12             	cmp    $0x12,%eax
+  8035ec:	7f 23                	jg     803611 <vprintfmt+0x15c>
+  8035ee:	8b 14 85 a0 85 80 00 	mov    0x8085a0(,%eax,4),%edx
+  8035f5:	85 d2                	test   %edx,%edx
+  8035f7:	74 18                	je     803611 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8035f9:	52                   	push   %edx
+  8035fa:	68 ef 7e 80 00       	push   $0x807eef
+  8035ff:	53                   	push   %ebx
+  803600:	56                   	push   %esi
+  803601:	e8 92 fe ff ff       	call   803498 <printfmt>
+  803606:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  803609:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80360c:	e9 2c 02 00 00       	jmp    80383d <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  803611:	50                   	push   %eax
+  803612:	68 db 82 80 00       	push   $0x8082db
+  803617:	53                   	push   %ebx
+  803618:	56                   	push   %esi
+  803619:	e8 7a fe ff ff       	call   803498 <printfmt>
+  80361e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  803621:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  803624:	e9 14 02 00 00       	jmp    80383d <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  803629:	8b 45 14             	mov    0x14(%ebp),%eax
+  80362c:	83 c0 04             	add    $0x4,%eax
+  80362f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  803632:	8b 45 14             	mov    0x14(%ebp),%eax
+  803635:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  803637:	85 c9                	test   %ecx,%ecx
+  803639:	b8 d4 82 80 00       	mov    $0x8082d4,%eax
+  80363e:	0f 45 c1             	cmovne %ecx,%eax
+  803641:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  803644:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  803648:	7e 06                	jle    803650 <vprintfmt+0x19b>
+  80364a:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80364e:	75 0b                	jne    80365b <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803650:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  803653:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  803656:	89 75 08             	mov    %esi,0x8(%ebp)
+  803659:	eb 5c                	jmp    8036b7 <vprintfmt+0x202>
+  80365b:	83 ec 08             	sub    $0x8,%esp
+  80365e:	ff 75 d0             	push   -0x30(%ebp)
+  803661:	ff 75 cc             	push   -0x34(%ebp)
+  803664:	e8 19 03 00 00       	call   803982 <strnlen>
+  803669:	89 c2                	mov    %eax,%edx
+  80366b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80366e:	29 d0                	sub    %edx,%eax
+  803670:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  803673:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  803677:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80367a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80367d:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80367f:	eb 0e                	jmp    80368f <vprintfmt+0x1da>
+					putch(padc, putdat);
+  803681:	83 ec 08             	sub    $0x8,%esp
+  803684:	53                   	push   %ebx
+  803685:	57                   	push   %edi
+  803686:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803689:	83 ee 01             	sub    $0x1,%esi
+  80368c:	83 c4 10             	add    $0x10,%esp
+  80368f:	85 f6                	test   %esi,%esi
+  803691:	7f ee                	jg     803681 <vprintfmt+0x1cc>
+  803693:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803696:	8b 75 08             	mov    0x8(%ebp),%esi
+  803699:	85 c0                	test   %eax,%eax
+  80369b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036a0:	0f 49 d0             	cmovns %eax,%edx
+  8036a3:	29 d0                	sub    %edx,%eax
+  8036a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8036a8:	eb a6                	jmp    803650 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8036aa:	83 ec 08             	sub    $0x8,%esp
+  8036ad:	53                   	push   %ebx
+  8036ae:	52                   	push   %edx
+  8036af:	ff 55 08             	call   *0x8(%ebp)
+  8036b2:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8036b5:	89 f1                	mov    %esi,%ecx
+  8036b7:	8d 71 01             	lea    0x1(%ecx),%esi
+  8036ba:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8036be:	0f be d0             	movsbl %al,%edx
+  8036c1:	85 d2                	test   %edx,%edx
+  8036c3:	74 28                	je     8036ed <vprintfmt+0x238>
+  8036c5:	85 ff                	test   %edi,%edi
+  8036c7:	78 05                	js     8036ce <vprintfmt+0x219>
+  8036c9:	83 ef 01             	sub    $0x1,%edi
+  8036cc:	78 30                	js     8036fe <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8036ce:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8036d2:	74 d6                	je     8036aa <vprintfmt+0x1f5>
+  8036d4:	0f be c0             	movsbl %al,%eax
+  8036d7:	83 e8 20             	sub    $0x20,%eax
+  8036da:	83 f8 5e             	cmp    $0x5e,%eax
+  8036dd:	76 cb                	jbe    8036aa <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8036df:	83 ec 08             	sub    $0x8,%esp
+  8036e2:	53                   	push   %ebx
+  8036e3:	6a 3f                	push   $0x3f
+  8036e5:	ff 55 08             	call   *0x8(%ebp)
+  8036e8:	83 c4 10             	add    $0x10,%esp
+  8036eb:	eb c8                	jmp    8036b5 <vprintfmt+0x200>
+  8036ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8036f0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8036f3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8036f6:	01 d0                	add    %edx,%eax
+  8036f8:	29 c8                	sub    %ecx,%eax
+  8036fa:	89 c7                	mov    %eax,%edi
+  8036fc:	eb 13                	jmp    803711 <vprintfmt+0x25c>
+  8036fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  803701:	eb ed                	jmp    8036f0 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  803703:	83 ec 08             	sub    $0x8,%esp
+  803706:	53                   	push   %ebx
+  803707:	6a 20                	push   $0x20
+  803709:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80370b:	83 ef 01             	sub    $0x1,%edi
+  80370e:	83 c4 10             	add    $0x10,%esp
+  803711:	85 ff                	test   %edi,%edi
+  803713:	7f ee                	jg     803703 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  803715:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  803718:	89 45 14             	mov    %eax,0x14(%ebp)
+  80371b:	e9 1d 01 00 00       	jmp    80383d <vprintfmt+0x388>
+	if (lflag >= 2)
+  803720:	83 f9 01             	cmp    $0x1,%ecx
+  803723:	7f 1b                	jg     803740 <vprintfmt+0x28b>
+	else if (lflag)
+  803725:	85 c9                	test   %ecx,%ecx
+  803727:	74 63                	je     80378c <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  803729:	8b 45 14             	mov    0x14(%ebp),%eax
+  80372c:	8b 00                	mov    (%eax),%eax
+  80372e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803731:	99                   	cltd
+  803732:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803735:	8b 45 14             	mov    0x14(%ebp),%eax
+  803738:	8d 40 04             	lea    0x4(%eax),%eax
+  80373b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80373e:	eb 17                	jmp    803757 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  803740:	8b 45 14             	mov    0x14(%ebp),%eax
+  803743:	8b 50 04             	mov    0x4(%eax),%edx
+  803746:	8b 00                	mov    (%eax),%eax
+  803748:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80374b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80374e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803751:	8d 40 08             	lea    0x8(%eax),%eax
+  803754:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  803757:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80375a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80375d:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  803762:	85 c9                	test   %ecx,%ecx
+  803764:	0f 89 b9 00 00 00    	jns    803823 <vprintfmt+0x36e>
+				putch('-', putdat);
+  80376a:	83 ec 08             	sub    $0x8,%esp
+  80376d:	53                   	push   %ebx
+  80376e:	6a 2d                	push   $0x2d
+  803770:	ff d6                	call   *%esi
+				num = -(long long) num;
+  803772:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803775:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803778:	f7 da                	neg    %edx
+  80377a:	83 d1 00             	adc    $0x0,%ecx
+  80377d:	f7 d9                	neg    %ecx
+  80377f:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  803782:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803787:	e9 97 00 00 00       	jmp    803823 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  80378c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80378f:	8b 00                	mov    (%eax),%eax
+  803791:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803794:	99                   	cltd
+  803795:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803798:	8b 45 14             	mov    0x14(%ebp),%eax
+  80379b:	8d 40 04             	lea    0x4(%eax),%eax
+  80379e:	89 45 14             	mov    %eax,0x14(%ebp)
+  8037a1:	eb b4                	jmp    803757 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8037a3:	83 f9 01             	cmp    $0x1,%ecx
+  8037a6:	7f 1b                	jg     8037c3 <vprintfmt+0x30e>
+	else if (lflag)
+  8037a8:	85 c9                	test   %ecx,%ecx
+  8037aa:	74 2c                	je     8037d8 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8037ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8037af:	8b 10                	mov    (%eax),%edx
+  8037b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8037b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8037b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8037bc:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8037c1:	eb 60                	jmp    803823 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8037c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8037c6:	8b 10                	mov    (%eax),%edx
+  8037c8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8037cb:	8d 40 08             	lea    0x8(%eax),%eax
+  8037ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8037d1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8037d6:	eb 4b                	jmp    803823 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8037d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8037db:	8b 10                	mov    (%eax),%edx
+  8037dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8037e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8037e5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8037e8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8037ed:	eb 34                	jmp    803823 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8037ef:	83 f9 01             	cmp    $0x1,%ecx
+  8037f2:	7f 15                	jg     803809 <vprintfmt+0x354>
+	else if (lflag)
+  8037f4:	85 c9                	test   %ecx,%ecx
+  8037f6:	74 4d                	je     803845 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8037f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8037fb:	8b 00                	mov    (%eax),%eax
+  8037fd:	99                   	cltd
+  8037fe:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  803801:	8d 49 04             	lea    0x4(%ecx),%ecx
+  803804:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  803807:	eb 11                	jmp    80381a <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  803809:	8b 45 14             	mov    0x14(%ebp),%eax
+  80380c:	8b 50 04             	mov    0x4(%eax),%edx
+  80380f:	8b 00                	mov    (%eax),%eax
+  803811:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  803814:	8d 49 08             	lea    0x8(%ecx),%ecx
+  803817:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  80381a:	89 d1                	mov    %edx,%ecx
+  80381c:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  80381e:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  803823:	83 ec 0c             	sub    $0xc,%esp
+  803826:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80382a:	50                   	push   %eax
+  80382b:	ff 75 e0             	push   -0x20(%ebp)
+  80382e:	57                   	push   %edi
+  80382f:	51                   	push   %ecx
+  803830:	52                   	push   %edx
+  803831:	89 da                	mov    %ebx,%edx
+  803833:	89 f0                	mov    %esi,%eax
+  803835:	e8 98 fb ff ff       	call   8033d2 <printnum>
+			break;
+  80383a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80383d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  803840:	e9 8e fc ff ff       	jmp    8034d3 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  803845:	8b 45 14             	mov    0x14(%ebp),%eax
+  803848:	8b 00                	mov    (%eax),%eax
+  80384a:	99                   	cltd
+  80384b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80384e:	8d 49 04             	lea    0x4(%ecx),%ecx
+  803851:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  803854:	eb c4                	jmp    80381a <vprintfmt+0x365>
+			putch('0', putdat);
+  803856:	83 ec 08             	sub    $0x8,%esp
+  803859:	53                   	push   %ebx
+  80385a:	6a 30                	push   $0x30
+  80385c:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80385e:	83 c4 08             	add    $0x8,%esp
+  803861:	53                   	push   %ebx
+  803862:	6a 78                	push   $0x78
+  803864:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  803866:	8b 45 14             	mov    0x14(%ebp),%eax
+  803869:	8b 10                	mov    (%eax),%edx
+  80386b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  803870:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  803873:	8d 40 04             	lea    0x4(%eax),%eax
+  803876:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803879:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  80387e:	eb a3                	jmp    803823 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  803880:	83 f9 01             	cmp    $0x1,%ecx
+  803883:	7f 1b                	jg     8038a0 <vprintfmt+0x3eb>
+	else if (lflag)
+  803885:	85 c9                	test   %ecx,%ecx
+  803887:	74 2f                	je     8038b8 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  803889:	8b 45 14             	mov    0x14(%ebp),%eax
+  80388c:	8b 10                	mov    (%eax),%edx
+  80388e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803893:	8d 40 04             	lea    0x4(%eax),%eax
+  803896:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803899:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80389e:	eb 83                	jmp    803823 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8038a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8038a3:	8b 10                	mov    (%eax),%edx
+  8038a5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8038a8:	8d 40 08             	lea    0x8(%eax),%eax
+  8038ab:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8038ae:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8038b3:	e9 6b ff ff ff       	jmp    803823 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8038b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8038bb:	8b 10                	mov    (%eax),%edx
+  8038bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8038c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8038c5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8038c8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8038cd:	e9 51 ff ff ff       	jmp    803823 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8038d2:	83 ec 08             	sub    $0x8,%esp
+  8038d5:	53                   	push   %ebx
+  8038d6:	6a 25                	push   $0x25
+  8038d8:	ff d6                	call   *%esi
+			break;
+  8038da:	83 c4 10             	add    $0x10,%esp
+  8038dd:	e9 5b ff ff ff       	jmp    80383d <vprintfmt+0x388>
+			putch('%', putdat);
+  8038e2:	83 ec 08             	sub    $0x8,%esp
+  8038e5:	53                   	push   %ebx
+  8038e6:	6a 25                	push   $0x25
+  8038e8:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8038ea:	83 c4 10             	add    $0x10,%esp
+  8038ed:	89 f8                	mov    %edi,%eax
+  8038ef:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8038f3:	74 05                	je     8038fa <vprintfmt+0x445>
+  8038f5:	83 e8 01             	sub    $0x1,%eax
+  8038f8:	eb f5                	jmp    8038ef <vprintfmt+0x43a>
+  8038fa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8038fd:	e9 3b ff ff ff       	jmp    80383d <vprintfmt+0x388>
+
+00803902 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  803902:	55                   	push   %ebp
+  803903:	89 e5                	mov    %esp,%ebp
+  803905:	83 ec 18             	sub    $0x18,%esp
+  803908:	8b 45 08             	mov    0x8(%ebp),%eax
+  80390b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80390e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  803911:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  803915:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  803918:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80391f:	85 c0                	test   %eax,%eax
+  803921:	74 26                	je     803949 <vsnprintf+0x47>
+  803923:	85 d2                	test   %edx,%edx
+  803925:	7e 22                	jle    803949 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  803927:	ff 75 14             	push   0x14(%ebp)
+  80392a:	ff 75 10             	push   0x10(%ebp)
+  80392d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  803930:	50                   	push   %eax
+  803931:	68 7b 34 80 00       	push   $0x80347b
+  803936:	e8 7a fb ff ff       	call   8034b5 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80393b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80393e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  803941:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803944:	83 c4 10             	add    $0x10,%esp
+}
+  803947:	c9                   	leave
+  803948:	c3                   	ret
+		return -E_INVAL;
+  803949:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80394e:	eb f7                	jmp    803947 <vsnprintf+0x45>
+
+00803950 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  803950:	55                   	push   %ebp
+  803951:	89 e5                	mov    %esp,%ebp
+  803953:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  803956:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  803959:	50                   	push   %eax
+  80395a:	ff 75 10             	push   0x10(%ebp)
+  80395d:	ff 75 0c             	push   0xc(%ebp)
+  803960:	ff 75 08             	push   0x8(%ebp)
+  803963:	e8 9a ff ff ff       	call   803902 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  803968:	c9                   	leave
+  803969:	c3                   	ret
+
+0080396a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80396a:	55                   	push   %ebp
+  80396b:	89 e5                	mov    %esp,%ebp
+  80396d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  803970:	b8 00 00 00 00       	mov    $0x0,%eax
+  803975:	eb 03                	jmp    80397a <strlen+0x10>
+		n++;
+  803977:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80397a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80397e:	75 f7                	jne    803977 <strlen+0xd>
+	return n;
+}
+  803980:	5d                   	pop    %ebp
+  803981:	c3                   	ret
+
+00803982 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  803982:	55                   	push   %ebp
+  803983:	89 e5                	mov    %esp,%ebp
+  803985:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803988:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80398b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803990:	eb 03                	jmp    803995 <strnlen+0x13>
+		n++;
+  803992:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803995:	39 d0                	cmp    %edx,%eax
+  803997:	74 08                	je     8039a1 <strnlen+0x1f>
+  803999:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80399d:	75 f3                	jne    803992 <strnlen+0x10>
+  80399f:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8039a1:	89 d0                	mov    %edx,%eax
+  8039a3:	5d                   	pop    %ebp
+  8039a4:	c3                   	ret
+
+008039a5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8039a5:	55                   	push   %ebp
+  8039a6:	89 e5                	mov    %esp,%ebp
+  8039a8:	53                   	push   %ebx
+  8039a9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8039ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8039af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039b4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8039b8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8039bb:	83 c0 01             	add    $0x1,%eax
+  8039be:	84 d2                	test   %dl,%dl
+  8039c0:	75 f2                	jne    8039b4 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8039c2:	89 c8                	mov    %ecx,%eax
+  8039c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039c7:	c9                   	leave
+  8039c8:	c3                   	ret
+
+008039c9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8039c9:	55                   	push   %ebp
+  8039ca:	89 e5                	mov    %esp,%ebp
+  8039cc:	53                   	push   %ebx
+  8039cd:	83 ec 10             	sub    $0x10,%esp
+  8039d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8039d3:	53                   	push   %ebx
+  8039d4:	e8 91 ff ff ff       	call   80396a <strlen>
+  8039d9:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8039dc:	ff 75 0c             	push   0xc(%ebp)
+  8039df:	01 d8                	add    %ebx,%eax
+  8039e1:	50                   	push   %eax
+  8039e2:	e8 be ff ff ff       	call   8039a5 <strcpy>
+	return dst;
+}
+  8039e7:	89 d8                	mov    %ebx,%eax
+  8039e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039ec:	c9                   	leave
+  8039ed:	c3                   	ret
+
+008039ee <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8039ee:	55                   	push   %ebp
+  8039ef:	89 e5                	mov    %esp,%ebp
+  8039f1:	56                   	push   %esi
+  8039f2:	53                   	push   %ebx
+  8039f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8039f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8039f9:	89 f3                	mov    %esi,%ebx
+  8039fb:	03 5d 10             	add    0x10(%ebp),%ebx
+  8039fe:	89 f0                	mov    %esi,%eax
+  803a00:	eb 0f                	jmp    803a11 <strncpy+0x23>
+		*dst++ = *src;
+  803a02:	83 c0 01             	add    $0x1,%eax
+  803a05:	0f b6 0a             	movzbl (%edx),%ecx
+  803a08:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  803a0b:	80 f9 01             	cmp    $0x1,%cl
+  803a0e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  803a11:	39 d8                	cmp    %ebx,%eax
+  803a13:	75 ed                	jne    803a02 <strncpy+0x14>
+	}
+	return ret;
+}
+  803a15:	89 f0                	mov    %esi,%eax
+  803a17:	5b                   	pop    %ebx
+  803a18:	5e                   	pop    %esi
+  803a19:	5d                   	pop    %ebp
+  803a1a:	c3                   	ret
+
+00803a1b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  803a1b:	55                   	push   %ebp
+  803a1c:	89 e5                	mov    %esp,%ebp
+  803a1e:	56                   	push   %esi
+  803a1f:	53                   	push   %ebx
+  803a20:	8b 75 08             	mov    0x8(%ebp),%esi
+  803a23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803a26:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  803a29:	89 f0                	mov    %esi,%eax
+  803a2b:	85 d2                	test   %edx,%edx
+  803a2d:	74 21                	je     803a50 <strlcpy+0x35>
+  803a2f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  803a33:	89 f2                	mov    %esi,%edx
+  803a35:	eb 09                	jmp    803a40 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  803a37:	83 c1 01             	add    $0x1,%ecx
+  803a3a:	83 c2 01             	add    $0x1,%edx
+  803a3d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  803a40:	39 c2                	cmp    %eax,%edx
+  803a42:	74 09                	je     803a4d <strlcpy+0x32>
+  803a44:	0f b6 19             	movzbl (%ecx),%ebx
+  803a47:	84 db                	test   %bl,%bl
+  803a49:	75 ec                	jne    803a37 <strlcpy+0x1c>
+  803a4b:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  803a4d:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  803a50:	29 f0                	sub    %esi,%eax
+}
+  803a52:	5b                   	pop    %ebx
+  803a53:	5e                   	pop    %esi
+  803a54:	5d                   	pop    %ebp
+  803a55:	c3                   	ret
+
+00803a56 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  803a56:	55                   	push   %ebp
+  803a57:	89 e5                	mov    %esp,%ebp
+  803a59:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803a5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  803a5f:	eb 06                	jmp    803a67 <strcmp+0x11>
+		p++, q++;
+  803a61:	83 c1 01             	add    $0x1,%ecx
+  803a64:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  803a67:	0f b6 01             	movzbl (%ecx),%eax
+  803a6a:	84 c0                	test   %al,%al
+  803a6c:	74 04                	je     803a72 <strcmp+0x1c>
+  803a6e:	3a 02                	cmp    (%edx),%al
+  803a70:	74 ef                	je     803a61 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  803a72:	0f b6 c0             	movzbl %al,%eax
+  803a75:	0f b6 12             	movzbl (%edx),%edx
+  803a78:	29 d0                	sub    %edx,%eax
+}
+  803a7a:	5d                   	pop    %ebp
+  803a7b:	c3                   	ret
+
+00803a7c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  803a7c:	55                   	push   %ebp
+  803a7d:	89 e5                	mov    %esp,%ebp
+  803a7f:	53                   	push   %ebx
+  803a80:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803a86:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  803a89:	eb 09                	jmp    803a94 <strncmp+0x18>
+		n--, p++, q++;
+  803a8b:	83 ea 01             	sub    $0x1,%edx
+  803a8e:	83 c0 01             	add    $0x1,%eax
+  803a91:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  803a94:	85 d2                	test   %edx,%edx
+  803a96:	74 18                	je     803ab0 <strncmp+0x34>
+  803a98:	0f b6 18             	movzbl (%eax),%ebx
+  803a9b:	84 db                	test   %bl,%bl
+  803a9d:	74 04                	je     803aa3 <strncmp+0x27>
+  803a9f:	3a 19                	cmp    (%ecx),%bl
+  803aa1:	74 e8                	je     803a8b <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  803aa3:	0f b6 00             	movzbl (%eax),%eax
+  803aa6:	0f b6 11             	movzbl (%ecx),%edx
+  803aa9:	29 d0                	sub    %edx,%eax
+}
+  803aab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803aae:	c9                   	leave
+  803aaf:	c3                   	ret
+		return 0;
+  803ab0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ab5:	eb f4                	jmp    803aab <strncmp+0x2f>
+
+00803ab7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  803ab7:	55                   	push   %ebp
+  803ab8:	89 e5                	mov    %esp,%ebp
+  803aba:	8b 45 08             	mov    0x8(%ebp),%eax
+  803abd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  803ac1:	eb 03                	jmp    803ac6 <strchr+0xf>
+  803ac3:	83 c0 01             	add    $0x1,%eax
+  803ac6:	0f b6 10             	movzbl (%eax),%edx
+  803ac9:	84 d2                	test   %dl,%dl
+  803acb:	74 06                	je     803ad3 <strchr+0x1c>
+		if (*s == c)
+  803acd:	38 ca                	cmp    %cl,%dl
+  803acf:	75 f2                	jne    803ac3 <strchr+0xc>
+  803ad1:	eb 05                	jmp    803ad8 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  803ad3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ad8:	5d                   	pop    %ebp
+  803ad9:	c3                   	ret
+
+00803ada <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  803ada:	55                   	push   %ebp
+  803adb:	89 e5                	mov    %esp,%ebp
+  803add:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ae0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  803ae4:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  803ae7:	38 ca                	cmp    %cl,%dl
+  803ae9:	74 09                	je     803af4 <strfind+0x1a>
+  803aeb:	84 d2                	test   %dl,%dl
+  803aed:	74 05                	je     803af4 <strfind+0x1a>
+	for (; *s; s++)
+  803aef:	83 c0 01             	add    $0x1,%eax
+  803af2:	eb f0                	jmp    803ae4 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  803af4:	5d                   	pop    %ebp
+  803af5:	c3                   	ret
+
+00803af6 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  803af6:	55                   	push   %ebp
+  803af7:	89 e5                	mov    %esp,%ebp
+  803af9:	57                   	push   %edi
+  803afa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803afd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  803b00:	85 c9                	test   %ecx,%ecx
+  803b02:	74 20                	je     803b24 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  803b04:	89 f8                	mov    %edi,%eax
+  803b06:	09 c8                	or     %ecx,%eax
+  803b08:	a8 03                	test   $0x3,%al
+  803b0a:	75 12                	jne    803b1e <memset+0x28>
+		c &= 0xFF;
+  803b0c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  803b10:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  803b16:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  803b19:	fc                   	cld
+  803b1a:	f3 ab                	rep stos %eax,%es:(%edi)
+  803b1c:	eb 06                	jmp    803b24 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  803b1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803b21:	fc                   	cld
+  803b22:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  803b24:	89 f8                	mov    %edi,%eax
+  803b26:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  803b29:	c9                   	leave
+  803b2a:	c3                   	ret
+
+00803b2b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  803b2b:	55                   	push   %ebp
+  803b2c:	89 e5                	mov    %esp,%ebp
+  803b2e:	57                   	push   %edi
+  803b2f:	56                   	push   %esi
+  803b30:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b33:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803b36:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  803b39:	39 c6                	cmp    %eax,%esi
+  803b3b:	73 32                	jae    803b6f <memmove+0x44>
+  803b3d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  803b40:	39 d0                	cmp    %edx,%eax
+  803b42:	73 2b                	jae    803b6f <memmove+0x44>
+		s += n;
+		d += n;
+  803b44:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803b47:	89 d6                	mov    %edx,%esi
+  803b49:	09 fe                	or     %edi,%esi
+  803b4b:	09 ce                	or     %ecx,%esi
+  803b4d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  803b53:	75 0e                	jne    803b63 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  803b55:	83 ef 04             	sub    $0x4,%edi
+  803b58:	8d 72 fc             	lea    -0x4(%edx),%esi
+  803b5b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  803b5e:	fd                   	std
+  803b5f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803b61:	eb 09                	jmp    803b6c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  803b63:	83 ef 01             	sub    $0x1,%edi
+  803b66:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  803b69:	fd                   	std
+  803b6a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  803b6c:	fc                   	cld
+  803b6d:	eb 1a                	jmp    803b89 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803b6f:	89 f2                	mov    %esi,%edx
+  803b71:	09 c2                	or     %eax,%edx
+  803b73:	09 ca                	or     %ecx,%edx
+  803b75:	f6 c2 03             	test   $0x3,%dl
+  803b78:	75 0a                	jne    803b84 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  803b7a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  803b7d:	89 c7                	mov    %eax,%edi
+  803b7f:	fc                   	cld
+  803b80:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  803b82:	eb 05                	jmp    803b89 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  803b84:	89 c7                	mov    %eax,%edi
+  803b86:	fc                   	cld
+  803b87:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  803b89:	5e                   	pop    %esi
+  803b8a:	5f                   	pop    %edi
+  803b8b:	5d                   	pop    %ebp
+  803b8c:	c3                   	ret
+
+00803b8d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  803b8d:	55                   	push   %ebp
+  803b8e:	89 e5                	mov    %esp,%ebp
+  803b90:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  803b93:	ff 75 10             	push   0x10(%ebp)
+  803b96:	ff 75 0c             	push   0xc(%ebp)
+  803b99:	ff 75 08             	push   0x8(%ebp)
+  803b9c:	e8 8a ff ff ff       	call   803b2b <memmove>
+}
+  803ba1:	c9                   	leave
+  803ba2:	c3                   	ret
+
+00803ba3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  803ba3:	55                   	push   %ebp
+  803ba4:	89 e5                	mov    %esp,%ebp
+  803ba6:	56                   	push   %esi
+  803ba7:	53                   	push   %ebx
+  803ba8:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bab:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  803bae:	89 c6                	mov    %eax,%esi
+  803bb0:	03 75 10             	add    0x10(%ebp),%esi
+  803bb3:	eb 06                	jmp    803bbb <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  803bb5:	83 c0 01             	add    $0x1,%eax
+  803bb8:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  803bbb:	39 f0                	cmp    %esi,%eax
+  803bbd:	74 14                	je     803bd3 <memcmp+0x30>
+		if (*s1 != *s2)
+  803bbf:	0f b6 08             	movzbl (%eax),%ecx
+  803bc2:	0f b6 1a             	movzbl (%edx),%ebx
+  803bc5:	38 d9                	cmp    %bl,%cl
+  803bc7:	74 ec                	je     803bb5 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  803bc9:	0f b6 c1             	movzbl %cl,%eax
+  803bcc:	0f b6 db             	movzbl %bl,%ebx
+  803bcf:	29 d8                	sub    %ebx,%eax
+  803bd1:	eb 05                	jmp    803bd8 <memcmp+0x35>
+	}
+
+	return 0;
+  803bd3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bd8:	5b                   	pop    %ebx
+  803bd9:	5e                   	pop    %esi
+  803bda:	5d                   	pop    %ebp
+  803bdb:	c3                   	ret
+
+00803bdc <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803bdc:	55                   	push   %ebp
+  803bdd:	89 e5                	mov    %esp,%ebp
+  803bdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  803be2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  803be5:	89 c2                	mov    %eax,%edx
+  803be7:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803bea:	eb 03                	jmp    803bef <memfind+0x13>
+  803bec:	83 c0 01             	add    $0x1,%eax
+  803bef:	39 d0                	cmp    %edx,%eax
+  803bf1:	73 04                	jae    803bf7 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803bf3:	38 08                	cmp    %cl,(%eax)
+  803bf5:	75 f5                	jne    803bec <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  803bf7:	5d                   	pop    %ebp
+  803bf8:	c3                   	ret
+
+00803bf9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  803bf9:	55                   	push   %ebp
+  803bfa:	89 e5                	mov    %esp,%ebp
+  803bfc:	57                   	push   %edi
+  803bfd:	56                   	push   %esi
+  803bfe:	53                   	push   %ebx
+  803bff:	8b 55 08             	mov    0x8(%ebp),%edx
+  803c02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  803c05:	eb 03                	jmp    803c0a <strtol+0x11>
+		s++;
+  803c07:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803c0a:	0f b6 02             	movzbl (%edx),%eax
+  803c0d:	3c 20                	cmp    $0x20,%al
+  803c0f:	74 f6                	je     803c07 <strtol+0xe>
+  803c11:	3c 09                	cmp    $0x9,%al
+  803c13:	74 f2                	je     803c07 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  803c15:	3c 2b                	cmp    $0x2b,%al
+  803c17:	74 2a                	je     803c43 <strtol+0x4a>
+	int neg = 0;
+  803c19:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  803c1e:	3c 2d                	cmp    $0x2d,%al
+  803c20:	74 2b                	je     803c4d <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803c22:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  803c28:	75 0f                	jne    803c39 <strtol+0x40>
+  803c2a:	80 3a 30             	cmpb   $0x30,(%edx)
+  803c2d:	74 28                	je     803c57 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  803c2f:	85 db                	test   %ebx,%ebx
+  803c31:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803c36:	0f 44 d8             	cmove  %eax,%ebx
+  803c39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c3e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  803c41:	eb 46                	jmp    803c89 <strtol+0x90>
+		s++;
+  803c43:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  803c46:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c4b:	eb d5                	jmp    803c22 <strtol+0x29>
+		s++, neg = 1;
+  803c4d:	83 c2 01             	add    $0x1,%edx
+  803c50:	bf 01 00 00 00       	mov    $0x1,%edi
+  803c55:	eb cb                	jmp    803c22 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803c57:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  803c5b:	74 0e                	je     803c6b <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  803c5d:	85 db                	test   %ebx,%ebx
+  803c5f:	75 d8                	jne    803c39 <strtol+0x40>
+		s++, base = 8;
+  803c61:	83 c2 01             	add    $0x1,%edx
+  803c64:	bb 08 00 00 00       	mov    $0x8,%ebx
+  803c69:	eb ce                	jmp    803c39 <strtol+0x40>
+		s += 2, base = 16;
+  803c6b:	83 c2 02             	add    $0x2,%edx
+  803c6e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  803c73:	eb c4                	jmp    803c39 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  803c75:	0f be c0             	movsbl %al,%eax
+  803c78:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  803c7b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803c7e:	7d 3a                	jge    803cba <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  803c80:	83 c2 01             	add    $0x1,%edx
+  803c83:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  803c87:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  803c89:	0f b6 02             	movzbl (%edx),%eax
+  803c8c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  803c8f:	89 f3                	mov    %esi,%ebx
+  803c91:	80 fb 09             	cmp    $0x9,%bl
+  803c94:	76 df                	jbe    803c75 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  803c96:	8d 70 9f             	lea    -0x61(%eax),%esi
+  803c99:	89 f3                	mov    %esi,%ebx
+  803c9b:	80 fb 19             	cmp    $0x19,%bl
+  803c9e:	77 08                	ja     803ca8 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  803ca0:	0f be c0             	movsbl %al,%eax
+  803ca3:	83 e8 57             	sub    $0x57,%eax
+  803ca6:	eb d3                	jmp    803c7b <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  803ca8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  803cab:	89 f3                	mov    %esi,%ebx
+  803cad:	80 fb 19             	cmp    $0x19,%bl
+  803cb0:	77 08                	ja     803cba <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  803cb2:	0f be c0             	movsbl %al,%eax
+  803cb5:	83 e8 37             	sub    $0x37,%eax
+  803cb8:	eb c1                	jmp    803c7b <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803cba:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803cbe:	74 05                	je     803cc5 <strtol+0xcc>
+		*endptr = (char *) s;
+  803cc0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803cc3:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803cc5:	89 c8                	mov    %ecx,%eax
+  803cc7:	f7 d8                	neg    %eax
+  803cc9:	85 ff                	test   %edi,%edi
+  803ccb:	0f 45 c8             	cmovne %eax,%ecx
+}
+  803cce:	89 c8                	mov    %ecx,%eax
+  803cd0:	5b                   	pop    %ebx
+  803cd1:	5e                   	pop    %esi
+  803cd2:	5f                   	pop    %edi
+  803cd3:	5d                   	pop    %ebp
+  803cd4:	c3                   	ret
+
+00803cd5 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  803cd5:	55                   	push   %ebp
+  803cd6:	89 e5                	mov    %esp,%ebp
+  803cd8:	57                   	push   %edi
+  803cd9:	56                   	push   %esi
+  803cda:	53                   	push   %ebx
+  803cdb:	83 ec 0c             	sub    $0xc,%esp
+  803cde:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803ce1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803ce4:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  803ce7:	85 ff                	test   %edi,%edi
+  803ce9:	74 16                	je     803d01 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  803ceb:	83 ec 04             	sub    $0x4,%esp
+  803cee:	56                   	push   %esi
+  803cef:	6a 00                	push   $0x0
+  803cf1:	53                   	push   %ebx
+  803cf2:	e8 02 ff ff ff       	call   803bf9 <strtol>
+  803cf7:	89 07                	mov    %eax,(%edi)
+  803cf9:	83 c4 10             	add    $0x10,%esp
+  803cfc:	eb 03                	jmp    803d01 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  803cfe:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  803d01:	0f b6 03             	movzbl (%ebx),%eax
+  803d04:	3c 20                	cmp    $0x20,%al
+  803d06:	74 f6                	je     803cfe <strisl+0x29>
+  803d08:	3c 09                	cmp    $0x9,%al
+  803d0a:	74 f2                	je     803cfe <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  803d0c:	3c 2b                	cmp    $0x2b,%al
+  803d0e:	74 23                	je     803d33 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  803d10:	3c 2d                	cmp    $0x2d,%al
+  803d12:	0f 94 c0             	sete   %al
+  803d15:	0f b6 c0             	movzbl %al,%eax
+  803d18:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803d1a:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  803d20:	75 41                	jne    803d63 <strisl+0x8e>
+  803d22:	80 3b 30             	cmpb   $0x30,(%ebx)
+  803d25:	74 11                	je     803d38 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  803d27:	85 f6                	test   %esi,%esi
+  803d29:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803d2e:	0f 44 f0             	cmove  %eax,%esi
+  803d31:	eb 30                	jmp    803d63 <strisl+0x8e>
+		s++;
+  803d33:	83 c3 01             	add    $0x1,%ebx
+  803d36:	eb e2                	jmp    803d1a <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  803d38:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  803d3c:	74 0e                	je     803d4c <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  803d3e:	85 f6                	test   %esi,%esi
+  803d40:	75 21                	jne    803d63 <strisl+0x8e>
+		s++, base = 8;
+  803d42:	83 c3 01             	add    $0x1,%ebx
+  803d45:	be 08 00 00 00       	mov    $0x8,%esi
+  803d4a:	eb 17                	jmp    803d63 <strisl+0x8e>
+		s += 2, base = 16;
+  803d4c:	83 c3 02             	add    $0x2,%ebx
+  803d4f:	be 10 00 00 00       	mov    $0x10,%esi
+  803d54:	eb 0d                	jmp    803d63 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  803d56:	0f be c0             	movsbl %al,%eax
+  803d59:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  803d5c:	39 f0                	cmp    %esi,%eax
+  803d5e:	7d 38                	jge    803d98 <strisl+0xc3>
+			return 0;
+		s++;
+  803d60:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  803d63:	0f b6 03             	movzbl (%ebx),%eax
+  803d66:	8d 50 d0             	lea    -0x30(%eax),%edx
+  803d69:	80 fa 09             	cmp    $0x9,%dl
+  803d6c:	76 e8                	jbe    803d56 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  803d6e:	8d 50 9f             	lea    -0x61(%eax),%edx
+  803d71:	80 fa 19             	cmp    $0x19,%dl
+  803d74:	77 08                	ja     803d7e <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  803d76:	0f be c0             	movsbl %al,%eax
+  803d79:	83 e8 57             	sub    $0x57,%eax
+  803d7c:	eb de                	jmp    803d5c <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  803d7e:	8d 50 bf             	lea    -0x41(%eax),%edx
+  803d81:	80 fa 19             	cmp    $0x19,%dl
+  803d84:	77 08                	ja     803d8e <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  803d86:	0f be c0             	movsbl %al,%eax
+  803d89:	83 e8 37             	sub    $0x37,%eax
+  803d8c:	eb ce                	jmp    803d5c <strisl+0x87>
+		else if (!*s)
+  803d8e:	84 c0                	test   %al,%al
+  803d90:	0f 94 c0             	sete   %al
+  803d93:	0f b6 c0             	movzbl %al,%eax
+  803d96:	eb 05                	jmp    803d9d <strisl+0xc8>
+			return 0;
+  803d98:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  803d9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803da0:	5b                   	pop    %ebx
+  803da1:	5e                   	pop    %esi
+  803da2:	5f                   	pop    %edi
+  803da3:	5d                   	pop    %ebp
+  803da4:	c3                   	ret
+
+00803da5 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  803da5:	55                   	push   %ebp
+  803da6:	89 e5                	mov    %esp,%ebp
+  803da8:	83 ec 10             	sub    $0x10,%esp
+  803dab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  803dae:	89 c8                	mov    %ecx,%eax
+  803db0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803db5:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803db8:	eb 0b                	jmp    803dc5 <touch_mem+0x20>
+		c = *(char *)page;
+  803dba:	0f b6 10             	movzbl (%eax),%edx
+  803dbd:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  803dc0:	05 00 10 00 00       	add    $0x1000,%eax
+  803dc5:	39 c8                	cmp    %ecx,%eax
+  803dc7:	72 f1                	jb     803dba <touch_mem+0x15>
+}
+  803dc9:	c9                   	leave
+  803dca:	c3                   	ret
+
+00803dcb <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  803dcb:	55                   	push   %ebp
+  803dcc:	89 e5                	mov    %esp,%ebp
+  803dce:	57                   	push   %edi
+  803dcf:	56                   	push   %esi
+  803dd0:	53                   	push   %ebx
+	touch_mem(s, len);
+  803dd1:	ff 75 0c             	push   0xc(%ebp)
+  803dd4:	ff 75 08             	push   0x8(%ebp)
+  803dd7:	e8 c9 ff ff ff       	call   803da5 <touch_mem>
+	asm volatile("int %1\n"
+  803ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de1:	8b 55 08             	mov    0x8(%ebp),%edx
+  803de4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803de7:	89 c3                	mov    %eax,%ebx
+  803de9:	89 c7                	mov    %eax,%edi
+  803deb:	89 c6                	mov    %eax,%esi
+  803ded:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  803def:	83 c4 08             	add    $0x8,%esp
+  803df2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803df5:	5b                   	pop    %ebx
+  803df6:	5e                   	pop    %esi
+  803df7:	5f                   	pop    %edi
+  803df8:	5d                   	pop    %ebp
+  803df9:	c3                   	ret
+
+00803dfa <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  803dfa:	55                   	push   %ebp
+  803dfb:	89 e5                	mov    %esp,%ebp
+  803dfd:	57                   	push   %edi
+  803dfe:	56                   	push   %esi
+  803dff:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  803e00:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e05:	b8 01 00 00 00       	mov    $0x1,%eax
+  803e0a:	89 d1                	mov    %edx,%ecx
+  803e0c:	89 d3                	mov    %edx,%ebx
+  803e0e:	89 d7                	mov    %edx,%edi
+  803e10:	89 d6                	mov    %edx,%esi
+  803e12:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  803e14:	5b                   	pop    %ebx
+  803e15:	5e                   	pop    %esi
+  803e16:	5f                   	pop    %edi
+  803e17:	5d                   	pop    %ebp
+  803e18:	c3                   	ret
+
+00803e19 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  803e19:	55                   	push   %ebp
+  803e1a:	89 e5                	mov    %esp,%ebp
+  803e1c:	57                   	push   %edi
+  803e1d:	56                   	push   %esi
+  803e1e:	53                   	push   %ebx
+  803e1f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  803e22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e27:	8b 55 08             	mov    0x8(%ebp),%edx
+  803e2a:	b8 03 00 00 00       	mov    $0x3,%eax
+  803e2f:	89 cb                	mov    %ecx,%ebx
+  803e31:	89 cf                	mov    %ecx,%edi
+  803e33:	89 ce                	mov    %ecx,%esi
+  803e35:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  803e37:	85 c0                	test   %eax,%eax
+  803e39:	7f 08                	jg     803e43 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  803e3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e3e:	5b                   	pop    %ebx
+  803e3f:	5e                   	pop    %esi
+  803e40:	5f                   	pop    %edi
+  803e41:	5d                   	pop    %ebp
+  803e42:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  803e43:	83 ec 0c             	sub    $0xc,%esp
+  803e46:	50                   	push   %eax
+  803e47:	6a 03                	push   $0x3
+  803e49:	68 0b 86 80 00       	push   $0x80860b
+  803e4e:	6a 23                	push   $0x23
+  803e50:	68 28 86 80 00       	push   $0x808628
+  803e55:	e8 89 f4 ff ff       	call   8032e3 <_panic>
+
+00803e5a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  803e5a:	55                   	push   %ebp
+  803e5b:	89 e5                	mov    %esp,%ebp
+  803e5d:	57                   	push   %edi
+  803e5e:	56                   	push   %esi
+  803e5f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  803e60:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e65:	b8 02 00 00 00       	mov    $0x2,%eax
+  803e6a:	89 d1                	mov    %edx,%ecx
+  803e6c:	89 d3                	mov    %edx,%ebx
+  803e6e:	89 d7                	mov    %edx,%edi
+  803e70:	89 d6                	mov    %edx,%esi
+  803e72:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  803e74:	5b                   	pop    %ebx
+  803e75:	5e                   	pop    %esi
+  803e76:	5f                   	pop    %edi
+  803e77:	5d                   	pop    %ebp
+  803e78:	c3                   	ret
+
+00803e79 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  803e79:	55                   	push   %ebp
+  803e7a:	89 e5                	mov    %esp,%ebp
+  803e7c:	57                   	push   %edi
+  803e7d:	56                   	push   %esi
+  803e7e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  803e7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e84:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803e89:	89 d1                	mov    %edx,%ecx
+  803e8b:	89 d3                	mov    %edx,%ebx
+  803e8d:	89 d7                	mov    %edx,%edi
+  803e8f:	89 d6                	mov    %edx,%esi
+  803e91:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  803e93:	5b                   	pop    %ebx
+  803e94:	5e                   	pop    %esi
+  803e95:	5f                   	pop    %edi
+  803e96:	5d                   	pop    %ebp
+  803e97:	c3                   	ret
+
+00803e98 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  803e98:	55                   	push   %ebp
+  803e99:	89 e5                	mov    %esp,%ebp
+  803e9b:	57                   	push   %edi
+  803e9c:	56                   	push   %esi
+  803e9d:	53                   	push   %ebx
+  803e9e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  803ea1:	be 00 00 00 00       	mov    $0x0,%esi
+  803ea6:	8b 55 08             	mov    0x8(%ebp),%edx
+  803ea9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803eac:	b8 04 00 00 00       	mov    $0x4,%eax
+  803eb1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803eb4:	89 f7                	mov    %esi,%edi
+  803eb6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  803eb8:	85 c0                	test   %eax,%eax
+  803eba:	7f 08                	jg     803ec4 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  803ebc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ebf:	5b                   	pop    %ebx
+  803ec0:	5e                   	pop    %esi
+  803ec1:	5f                   	pop    %edi
+  803ec2:	5d                   	pop    %ebp
+  803ec3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  803ec4:	83 ec 0c             	sub    $0xc,%esp
+  803ec7:	50                   	push   %eax
+  803ec8:	6a 04                	push   $0x4
+  803eca:	68 0b 86 80 00       	push   $0x80860b
+  803ecf:	6a 23                	push   $0x23
+  803ed1:	68 28 86 80 00       	push   $0x808628
+  803ed6:	e8 08 f4 ff ff       	call   8032e3 <_panic>
+
+00803edb <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  803edb:	55                   	push   %ebp
+  803edc:	89 e5                	mov    %esp,%ebp
+  803ede:	57                   	push   %edi
+  803edf:	56                   	push   %esi
+  803ee0:	53                   	push   %ebx
+  803ee1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  803ee4:	8b 55 08             	mov    0x8(%ebp),%edx
+  803ee7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803eea:	b8 05 00 00 00       	mov    $0x5,%eax
+  803eef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803ef2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  803ef5:	8b 75 18             	mov    0x18(%ebp),%esi
+  803ef8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  803efa:	85 c0                	test   %eax,%eax
+  803efc:	7f 08                	jg     803f06 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  803efe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f01:	5b                   	pop    %ebx
+  803f02:	5e                   	pop    %esi
+  803f03:	5f                   	pop    %edi
+  803f04:	5d                   	pop    %ebp
+  803f05:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  803f06:	83 ec 0c             	sub    $0xc,%esp
+  803f09:	50                   	push   %eax
+  803f0a:	6a 05                	push   $0x5
+  803f0c:	68 0b 86 80 00       	push   $0x80860b
+  803f11:	6a 23                	push   $0x23
+  803f13:	68 28 86 80 00       	push   $0x808628
+  803f18:	e8 c6 f3 ff ff       	call   8032e3 <_panic>
+
+00803f1d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  803f1d:	55                   	push   %ebp
+  803f1e:	89 e5                	mov    %esp,%ebp
+  803f20:	57                   	push   %edi
+  803f21:	56                   	push   %esi
+  803f22:	53                   	push   %ebx
+  803f23:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  803f26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  803f2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803f31:	b8 06 00 00 00       	mov    $0x6,%eax
+  803f36:	89 df                	mov    %ebx,%edi
+  803f38:	89 de                	mov    %ebx,%esi
+  803f3a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  803f3c:	85 c0                	test   %eax,%eax
+  803f3e:	7f 08                	jg     803f48 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  803f40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f43:	5b                   	pop    %ebx
+  803f44:	5e                   	pop    %esi
+  803f45:	5f                   	pop    %edi
+  803f46:	5d                   	pop    %ebp
+  803f47:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  803f48:	83 ec 0c             	sub    $0xc,%esp
+  803f4b:	50                   	push   %eax
+  803f4c:	6a 06                	push   $0x6
+  803f4e:	68 0b 86 80 00       	push   $0x80860b
+  803f53:	6a 23                	push   $0x23
+  803f55:	68 28 86 80 00       	push   $0x808628
+  803f5a:	e8 84 f3 ff ff       	call   8032e3 <_panic>
+
+00803f5f <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  803f5f:	55                   	push   %ebp
+  803f60:	89 e5                	mov    %esp,%ebp
+  803f62:	57                   	push   %edi
+  803f63:	56                   	push   %esi
+  803f64:	53                   	push   %ebx
+  803f65:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  803f68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  803f70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803f73:	b8 18 00 00 00       	mov    $0x18,%eax
+  803f78:	89 df                	mov    %ebx,%edi
+  803f7a:	89 de                	mov    %ebx,%esi
+  803f7c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  803f7e:	85 c0                	test   %eax,%eax
+  803f80:	7f 08                	jg     803f8a <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  803f82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f85:	5b                   	pop    %ebx
+  803f86:	5e                   	pop    %esi
+  803f87:	5f                   	pop    %edi
+  803f88:	5d                   	pop    %ebp
+  803f89:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  803f8a:	83 ec 0c             	sub    $0xc,%esp
+  803f8d:	50                   	push   %eax
+  803f8e:	6a 18                	push   $0x18
+  803f90:	68 0b 86 80 00       	push   $0x80860b
+  803f95:	6a 23                	push   $0x23
+  803f97:	68 28 86 80 00       	push   $0x808628
+  803f9c:	e8 42 f3 ff ff       	call   8032e3 <_panic>
+
+00803fa1 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  803fa1:	55                   	push   %ebp
+  803fa2:	89 e5                	mov    %esp,%ebp
+  803fa4:	57                   	push   %edi
+  803fa5:	56                   	push   %esi
+  803fa6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  803fa7:	be 00 00 00 00       	mov    $0x0,%esi
+  803fac:	8b 55 08             	mov    0x8(%ebp),%edx
+  803faf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803fb2:	b8 19 00 00 00       	mov    $0x19,%eax
+  803fb7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803fba:	89 f7                	mov    %esi,%edi
+  803fbc:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  803fbe:	5b                   	pop    %ebx
+  803fbf:	5e                   	pop    %esi
+  803fc0:	5f                   	pop    %edi
+  803fc1:	5d                   	pop    %ebp
+  803fc2:	c3                   	ret
+
+00803fc3 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  803fc3:	55                   	push   %ebp
+  803fc4:	89 e5                	mov    %esp,%ebp
+  803fc6:	57                   	push   %edi
+  803fc7:	56                   	push   %esi
+  803fc8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  803fc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  803fcc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803fcf:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803fd4:	be 00 00 00 00       	mov    $0x0,%esi
+  803fd9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803fdc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  803fdf:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  803fe1:	5b                   	pop    %ebx
+  803fe2:	5e                   	pop    %esi
+  803fe3:	5f                   	pop    %edi
+  803fe4:	5d                   	pop    %ebp
+  803fe5:	c3                   	ret
+
+00803fe6 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  803fe6:	55                   	push   %ebp
+  803fe7:	89 e5                	mov    %esp,%ebp
+  803fe9:	57                   	push   %edi
+  803fea:	56                   	push   %esi
+  803feb:	53                   	push   %ebx
+  803fec:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  803fef:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  803ff2:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  803ff8:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  803ffb:	8b 55 08             	mov    0x8(%ebp),%edx
+  803ffe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804001:	b8 10 00 00 00       	mov    $0x10,%eax
+  804006:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804009:	8b 75 18             	mov    0x18(%ebp),%esi
+  80400c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80400e:	85 c0                	test   %eax,%eax
+  804010:	7f 08                	jg     80401a <sys_page_map_range+0x34>
+}
+  804012:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804015:	5b                   	pop    %ebx
+  804016:	5e                   	pop    %esi
+  804017:	5f                   	pop    %edi
+  804018:	5d                   	pop    %ebp
+  804019:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80401a:	83 ec 0c             	sub    $0xc,%esp
+  80401d:	50                   	push   %eax
+  80401e:	6a 10                	push   $0x10
+  804020:	68 0b 86 80 00       	push   $0x80860b
+  804025:	6a 23                	push   $0x23
+  804027:	68 28 86 80 00       	push   $0x808628
+  80402c:	e8 b2 f2 ff ff       	call   8032e3 <_panic>
+
+00804031 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  804031:	55                   	push   %ebp
+  804032:	89 e5                	mov    %esp,%ebp
+  804034:	57                   	push   %edi
+  804035:	56                   	push   %esi
+  804036:	53                   	push   %ebx
+  804037:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80403a:	be 00 00 00 00       	mov    $0x0,%esi
+  80403f:	8b 55 08             	mov    0x8(%ebp),%edx
+  804042:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804045:	b8 11 00 00 00       	mov    $0x11,%eax
+  80404a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80404d:	89 f7                	mov    %esi,%edi
+  80404f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  804051:	85 c0                	test   %eax,%eax
+  804053:	7f 08                	jg     80405d <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  804055:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804058:	5b                   	pop    %ebx
+  804059:	5e                   	pop    %esi
+  80405a:	5f                   	pop    %edi
+  80405b:	5d                   	pop    %ebp
+  80405c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80405d:	83 ec 0c             	sub    $0xc,%esp
+  804060:	50                   	push   %eax
+  804061:	6a 11                	push   $0x11
+  804063:	68 0b 86 80 00       	push   $0x80860b
+  804068:	6a 23                	push   $0x23
+  80406a:	68 28 86 80 00       	push   $0x808628
+  80406f:	e8 6f f2 ff ff       	call   8032e3 <_panic>
+
+00804074 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  804074:	55                   	push   %ebp
+  804075:	89 e5                	mov    %esp,%ebp
+  804077:	57                   	push   %edi
+  804078:	56                   	push   %esi
+  804079:	53                   	push   %ebx
+  80407a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80407d:	be 00 00 00 00       	mov    $0x0,%esi
+  804082:	8b 55 08             	mov    0x8(%ebp),%edx
+  804085:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804088:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80408d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804090:	89 f7                	mov    %esi,%edi
+  804092:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  804094:	85 c0                	test   %eax,%eax
+  804096:	7f 08                	jg     8040a0 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  804098:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80409b:	5b                   	pop    %ebx
+  80409c:	5e                   	pop    %esi
+  80409d:	5f                   	pop    %edi
+  80409e:	5d                   	pop    %ebp
+  80409f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8040a0:	83 ec 0c             	sub    $0xc,%esp
+  8040a3:	50                   	push   %eax
+  8040a4:	6a 1b                	push   $0x1b
+  8040a6:	68 0b 86 80 00       	push   $0x80860b
+  8040ab:	6a 23                	push   $0x23
+  8040ad:	68 28 86 80 00       	push   $0x808628
+  8040b2:	e8 2c f2 ff ff       	call   8032e3 <_panic>
+
+008040b7 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  8040b7:	55                   	push   %ebp
+  8040b8:	89 e5                	mov    %esp,%ebp
+  8040ba:	57                   	push   %edi
+  8040bb:	56                   	push   %esi
+  8040bc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8040bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040c2:	b8 12 00 00 00       	mov    $0x12,%eax
+  8040c7:	89 d1                	mov    %edx,%ecx
+  8040c9:	89 d3                	mov    %edx,%ebx
+  8040cb:	89 d7                	mov    %edx,%edi
+  8040cd:	89 d6                	mov    %edx,%esi
+  8040cf:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8040d1:	5b                   	pop    %ebx
+  8040d2:	5e                   	pop    %esi
+  8040d3:	5f                   	pop    %edi
+  8040d4:	5d                   	pop    %ebp
+  8040d5:	c3                   	ret
+
+008040d6 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8040d6:	55                   	push   %ebp
+  8040d7:	89 e5                	mov    %esp,%ebp
+  8040d9:	57                   	push   %edi
+  8040da:	56                   	push   %esi
+  8040db:	53                   	push   %ebx
+  8040dc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8040df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8040e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8040e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8040ea:	b8 08 00 00 00       	mov    $0x8,%eax
+  8040ef:	89 df                	mov    %ebx,%edi
+  8040f1:	89 de                	mov    %ebx,%esi
+  8040f3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8040f5:	85 c0                	test   %eax,%eax
+  8040f7:	7f 08                	jg     804101 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8040f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040fc:	5b                   	pop    %ebx
+  8040fd:	5e                   	pop    %esi
+  8040fe:	5f                   	pop    %edi
+  8040ff:	5d                   	pop    %ebp
+  804100:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  804101:	83 ec 0c             	sub    $0xc,%esp
+  804104:	50                   	push   %eax
+  804105:	6a 08                	push   $0x8
+  804107:	68 0b 86 80 00       	push   $0x80860b
+  80410c:	6a 23                	push   $0x23
+  80410e:	68 28 86 80 00       	push   $0x808628
+  804113:	e8 cb f1 ff ff       	call   8032e3 <_panic>
+
+00804118 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  804118:	55                   	push   %ebp
+  804119:	89 e5                	mov    %esp,%ebp
+  80411b:	57                   	push   %edi
+  80411c:	56                   	push   %esi
+  80411d:	53                   	push   %ebx
+  80411e:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  804121:	6a 44                	push   $0x44
+  804123:	ff 75 0c             	push   0xc(%ebp)
+  804126:	e8 7a fc ff ff       	call   803da5 <touch_mem>
+	asm volatile("int %1\n"
+  80412b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804130:	8b 55 08             	mov    0x8(%ebp),%edx
+  804133:	b8 09 00 00 00       	mov    $0x9,%eax
+  804138:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80413b:	89 df                	mov    %ebx,%edi
+  80413d:	89 de                	mov    %ebx,%esi
+  80413f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  804141:	83 c4 08             	add    $0x8,%esp
+  804144:	85 c0                	test   %eax,%eax
+  804146:	7f 08                	jg     804150 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  804148:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80414b:	5b                   	pop    %ebx
+  80414c:	5e                   	pop    %esi
+  80414d:	5f                   	pop    %edi
+  80414e:	5d                   	pop    %ebp
+  80414f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  804150:	83 ec 0c             	sub    $0xc,%esp
+  804153:	50                   	push   %eax
+  804154:	6a 09                	push   $0x9
+  804156:	68 0b 86 80 00       	push   $0x80860b
+  80415b:	6a 23                	push   $0x23
+  80415d:	68 28 86 80 00       	push   $0x808628
+  804162:	e8 7c f1 ff ff       	call   8032e3 <_panic>
+
+00804167 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  804167:	55                   	push   %ebp
+  804168:	89 e5                	mov    %esp,%ebp
+  80416a:	57                   	push   %edi
+  80416b:	56                   	push   %esi
+  80416c:	53                   	push   %ebx
+  80416d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  804170:	be 00 00 00 00       	mov    $0x0,%esi
+  804175:	8b 55 08             	mov    0x8(%ebp),%edx
+  804178:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80417b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  804180:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804183:	89 f7                	mov    %esi,%edi
+  804185:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  804187:	85 c0                	test   %eax,%eax
+  804189:	7f 08                	jg     804193 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  80418b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80418e:	5b                   	pop    %ebx
+  80418f:	5e                   	pop    %esi
+  804190:	5f                   	pop    %edi
+  804191:	5d                   	pop    %ebp
+  804192:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  804193:	83 ec 0c             	sub    $0xc,%esp
+  804196:	50                   	push   %eax
+  804197:	6a 1a                	push   $0x1a
+  804199:	68 0b 86 80 00       	push   $0x80860b
+  80419e:	6a 23                	push   $0x23
+  8041a0:	68 28 86 80 00       	push   $0x808628
+  8041a5:	e8 39 f1 ff ff       	call   8032e3 <_panic>
+
+008041aa <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8041aa:	55                   	push   %ebp
+  8041ab:	89 e5                	mov    %esp,%ebp
+  8041ad:	57                   	push   %edi
+  8041ae:	56                   	push   %esi
+  8041af:	53                   	push   %ebx
+  8041b0:	83 ec 0c             	sub    $0xc,%esp
+  8041b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8041b6:	89 d8                	mov    %ebx,%eax
+  8041b8:	c1 e0 05             	shl    $0x5,%eax
+  8041bb:	50                   	push   %eax
+  8041bc:	ff 75 0c             	push   0xc(%ebp)
+  8041bf:	e8 e1 fb ff ff       	call   803da5 <touch_mem>
+	asm volatile("int %1\n"
+  8041c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8041c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8041cc:	b8 13 00 00 00       	mov    $0x13,%eax
+  8041d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8041d4:	89 f7                	mov    %esi,%edi
+  8041d6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8041d8:	83 c4 08             	add    $0x8,%esp
+  8041db:	85 c0                	test   %eax,%eax
+  8041dd:	7f 08                	jg     8041e7 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8041df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041e2:	5b                   	pop    %ebx
+  8041e3:	5e                   	pop    %esi
+  8041e4:	5f                   	pop    %edi
+  8041e5:	5d                   	pop    %ebp
+  8041e6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8041e7:	83 ec 0c             	sub    $0xc,%esp
+  8041ea:	50                   	push   %eax
+  8041eb:	6a 13                	push   $0x13
+  8041ed:	68 0b 86 80 00       	push   $0x80860b
+  8041f2:	6a 23                	push   $0x23
+  8041f4:	68 28 86 80 00       	push   $0x808628
+  8041f9:	e8 e5 f0 ff ff       	call   8032e3 <_panic>
+
+008041fe <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8041fe:	55                   	push   %ebp
+  8041ff:	89 e5                	mov    %esp,%ebp
+  804201:	57                   	push   %edi
+  804202:	56                   	push   %esi
+  804203:	53                   	push   %ebx
+  804204:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  804207:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80420c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80420f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804212:	b8 0a 00 00 00       	mov    $0xa,%eax
+  804217:	89 df                	mov    %ebx,%edi
+  804219:	89 de                	mov    %ebx,%esi
+  80421b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80421d:	85 c0                	test   %eax,%eax
+  80421f:	7f 08                	jg     804229 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  804221:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804224:	5b                   	pop    %ebx
+  804225:	5e                   	pop    %esi
+  804226:	5f                   	pop    %edi
+  804227:	5d                   	pop    %ebp
+  804228:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  804229:	83 ec 0c             	sub    $0xc,%esp
+  80422c:	50                   	push   %eax
+  80422d:	6a 0a                	push   $0xa
+  80422f:	68 0b 86 80 00       	push   $0x80860b
+  804234:	6a 23                	push   $0x23
+  804236:	68 28 86 80 00       	push   $0x808628
+  80423b:	e8 a3 f0 ff ff       	call   8032e3 <_panic>
+
+00804240 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  804240:	55                   	push   %ebp
+  804241:	89 e5                	mov    %esp,%ebp
+  804243:	57                   	push   %edi
+  804244:	56                   	push   %esi
+  804245:	53                   	push   %ebx
+  804246:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  804249:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80424f:	76 1d                	jbe    80426e <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  804251:	8b 55 08             	mov    0x8(%ebp),%edx
+  804254:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804257:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80425c:	be 01 00 00 00       	mov    $0x1,%esi
+  804261:	8b 7d 14             	mov    0x14(%ebp),%edi
+  804264:	cd 30                	int    $0x30
+}
+  804266:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804269:	5b                   	pop    %ebx
+  80426a:	5e                   	pop    %esi
+  80426b:	5f                   	pop    %edi
+  80426c:	5d                   	pop    %ebp
+  80426d:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80426e:	68 00 10 00 00       	push   $0x1000
+  804273:	53                   	push   %ebx
+  804274:	e8 2c fb ff ff       	call   803da5 <touch_mem>
+  804279:	83 c4 08             	add    $0x8,%esp
+  80427c:	eb d3                	jmp    804251 <sys_ipc_send+0x11>
+
+0080427e <sys_ipc_send_pages>:
+{
+  80427e:	55                   	push   %ebp
+  80427f:	89 e5                	mov    %esp,%ebp
+  804281:	57                   	push   %edi
+  804282:	56                   	push   %esi
+  804283:	53                   	push   %ebx
+  804284:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804287:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  80428a:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  804290:	76 18                	jbe    8042aa <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  804292:	8b 55 08             	mov    0x8(%ebp),%edx
+  804295:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804298:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80429d:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8042a0:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8042a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042a5:	5b                   	pop    %ebx
+  8042a6:	5e                   	pop    %esi
+  8042a7:	5f                   	pop    %edi
+  8042a8:	5d                   	pop    %ebp
+  8042a9:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8042aa:	89 f0                	mov    %esi,%eax
+  8042ac:	c1 e0 0c             	shl    $0xc,%eax
+  8042af:	50                   	push   %eax
+  8042b0:	53                   	push   %ebx
+  8042b1:	e8 ef fa ff ff       	call   803da5 <touch_mem>
+  8042b6:	83 c4 08             	add    $0x8,%esp
+  8042b9:	eb d7                	jmp    804292 <sys_ipc_send_pages+0x14>
+
+008042bb <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8042bb:	55                   	push   %ebp
+  8042bc:	89 e5                	mov    %esp,%ebp
+  8042be:	57                   	push   %edi
+  8042bf:	56                   	push   %esi
+  8042c0:	53                   	push   %ebx
+  8042c1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8042c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8042c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8042cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8042cf:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8042d4:	89 df                	mov    %ebx,%edi
+  8042d6:	89 de                	mov    %ebx,%esi
+  8042d8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8042da:	85 c0                	test   %eax,%eax
+  8042dc:	7f 08                	jg     8042e6 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8042de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042e1:	5b                   	pop    %ebx
+  8042e2:	5e                   	pop    %esi
+  8042e3:	5f                   	pop    %edi
+  8042e4:	5d                   	pop    %ebp
+  8042e5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8042e6:	83 ec 0c             	sub    $0xc,%esp
+  8042e9:	50                   	push   %eax
+  8042ea:	6a 0d                	push   $0xd
+  8042ec:	68 0b 86 80 00       	push   $0x80860b
+  8042f1:	6a 23                	push   $0x23
+  8042f3:	68 28 86 80 00       	push   $0x808628
+  8042f8:	e8 e6 ef ff ff       	call   8032e3 <_panic>
+
+008042fd <sys_ipc_recv>:
+{
+  8042fd:	55                   	push   %ebp
+  8042fe:	89 e5                	mov    %esp,%ebp
+  804300:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  804303:	6a 01                	push   $0x1
+  804305:	ff 75 08             	push   0x8(%ebp)
+  804308:	e8 ae ff ff ff       	call   8042bb <sys_ipc_recv_pages>
+}
+  80430d:	c9                   	leave
+  80430e:	c3                   	ret
+
+0080430f <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80430f:	55                   	push   %ebp
+  804310:	89 e5                	mov    %esp,%ebp
+  804312:	57                   	push   %edi
+  804313:	56                   	push   %esi
+  804314:	53                   	push   %ebx
+  804315:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804318:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80431b:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  80431e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  804324:	77 04                	ja     80432a <sys_ipc_call+0x1b>
+  804326:	85 f6                	test   %esi,%esi
+  804328:	75 15                	jne    80433f <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  80432a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80432d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804330:	b8 14 00 00 00       	mov    $0x14,%eax
+  804335:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  804337:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80433a:	5b                   	pop    %ebx
+  80433b:	5e                   	pop    %esi
+  80433c:	5f                   	pop    %edi
+  80433d:	5d                   	pop    %ebp
+  80433e:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80433f:	89 f8                	mov    %edi,%eax
+  804341:	c1 e0 0c             	shl    $0xc,%eax
+  804344:	50                   	push   %eax
+  804345:	53                   	push   %ebx
+  804346:	e8 5a fa ff ff       	call   803da5 <touch_mem>
+  80434b:	83 c4 08             	add    $0x8,%esp
+  80434e:	eb da                	jmp    80432a <sys_ipc_call+0x1b>
+
+00804350 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  804350:	55                   	push   %ebp
+  804351:	89 e5                	mov    %esp,%ebp
+  804353:	57                   	push   %edi
+  804354:	56                   	push   %esi
+  804355:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  804356:	8b 55 08             	mov    0x8(%ebp),%edx
+  804359:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80435c:	b8 15 00 00 00       	mov    $0x15,%eax
+  804361:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804364:	8b 7d 14             	mov    0x14(%ebp),%edi
+  804367:	8b 75 18             	mov    0x18(%ebp),%esi
+  80436a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80436c:	5b                   	pop    %ebx
+  80436d:	5e                   	pop    %esi
+  80436e:	5f                   	pop    %edi
+  80436f:	5d                   	pop    %ebp
+  804370:	c3                   	ret
+
+00804371 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  804371:	55                   	push   %ebp
+  804372:	89 e5                	mov    %esp,%ebp
+  804374:	57                   	push   %edi
+  804375:	56                   	push   %esi
+  804376:	53                   	push   %ebx
+  804377:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  80437a:	6a 04                	push   $0x4
+  80437c:	ff 75 08             	push   0x8(%ebp)
+  80437f:	e8 21 fa ff ff       	call   803da5 <touch_mem>
+	asm volatile("int %1\n"
+  804384:	be 00 00 00 00       	mov    $0x0,%esi
+  804389:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80438c:	b8 16 00 00 00       	mov    $0x16,%eax
+  804391:	8b 55 08             	mov    0x8(%ebp),%edx
+  804394:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804397:	89 f7                	mov    %esi,%edi
+  804399:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80439b:	83 c4 08             	add    $0x8,%esp
+  80439e:	85 c0                	test   %eax,%eax
+  8043a0:	7f 08                	jg     8043aa <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8043a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043a5:	5b                   	pop    %ebx
+  8043a6:	5e                   	pop    %esi
+  8043a7:	5f                   	pop    %edi
+  8043a8:	5d                   	pop    %ebp
+  8043a9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8043aa:	83 ec 0c             	sub    $0xc,%esp
+  8043ad:	50                   	push   %eax
+  8043ae:	6a 16                	push   $0x16
+  8043b0:	68 0b 86 80 00       	push   $0x80860b
+  8043b5:	6a 23                	push   $0x23
+  8043b7:	68 28 86 80 00       	push   $0x808628
+  8043bc:	e8 22 ef ff ff       	call   8032e3 <_panic>
+
+008043c1 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8043c1:	55                   	push   %ebp
+  8043c2:	89 e5                	mov    %esp,%ebp
+  8043c4:	57                   	push   %edi
+  8043c5:	56                   	push   %esi
+  8043c6:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8043c7:	6a 04                	push   $0x4
+  8043c9:	ff 75 08             	push   0x8(%ebp)
+  8043cc:	e8 d4 f9 ff ff       	call   803da5 <touch_mem>
+	asm volatile("int %1\n"
+  8043d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8043d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8043d9:	b8 17 00 00 00       	mov    $0x17,%eax
+  8043de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8043e1:	89 df                	mov    %ebx,%edi
+  8043e3:	89 de                	mov    %ebx,%esi
+  8043e5:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8043e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043ea:	5b                   	pop    %ebx
+  8043eb:	5e                   	pop    %esi
+  8043ec:	5f                   	pop    %edi
+  8043ed:	5d                   	pop    %ebp
+  8043ee:	c3                   	ret
+
+008043ef <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8043ef:	55                   	push   %ebp
+  8043f0:	89 e5                	mov    %esp,%ebp
+  8043f2:	57                   	push   %edi
+  8043f3:	56                   	push   %esi
+  8043f4:	53                   	push   %ebx
+  8043f5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8043f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8043fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  804400:	b8 0e 00 00 00       	mov    $0xe,%eax
+  804405:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80440a:	89 df                	mov    %ebx,%edi
+  80440c:	89 de                	mov    %ebx,%esi
+  80440e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  804410:	85 c0                	test   %eax,%eax
+  804412:	7f 08                	jg     80441c <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  804414:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804417:	5b                   	pop    %ebx
+  804418:	5e                   	pop    %esi
+  804419:	5f                   	pop    %edi
+  80441a:	5d                   	pop    %ebp
+  80441b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80441c:	83 ec 0c             	sub    $0xc,%esp
+  80441f:	50                   	push   %eax
+  804420:	6a 0e                	push   $0xe
+  804422:	68 0b 86 80 00       	push   $0x80860b
+  804427:	6a 23                	push   $0x23
+  804429:	68 28 86 80 00       	push   $0x808628
+  80442e:	e8 b0 ee ff ff       	call   8032e3 <_panic>
+
+00804433 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804433:	55                   	push   %ebp
+  804434:	89 e5                	mov    %esp,%ebp
+  804436:	56                   	push   %esi
+  804437:	53                   	push   %ebx
+  804438:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  80443b:	a1 04 39 85 00       	mov    0x853904,%eax
+  804440:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804443:	85 db                	test   %ebx,%ebx
+  804445:	78 17                	js     80445e <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804447:	83 ec 0c             	sub    $0xc,%esp
+  80444a:	56                   	push   %esi
+  80444b:	ff 14 9d 40 a9 85 00 	call   *0x85a940(,%ebx,4)
+  804452:	83 c4 10             	add    $0x10,%esp
+  804455:	85 c0                	test   %eax,%eax
+  804457:	75 27                	jne    804480 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804459:	83 eb 01             	sub    $0x1,%ebx
+  80445c:	eb e5                	jmp    804443 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  80445e:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  804463:	8b 40 48             	mov    0x48(%eax),%eax
+  804466:	83 ec 08             	sub    $0x8,%esp
+  804469:	ff 76 28             	push   0x28(%esi)
+  80446c:	ff 36                	push   (%esi)
+  80446e:	50                   	push   %eax
+  80446f:	68 38 86 80 00       	push   $0x808638
+  804474:	6a 1d                	push   $0x1d
+  804476:	68 5b 86 80 00       	push   $0x80865b
+  80447b:	e8 63 ee ff ff       	call   8032e3 <_panic>
+}
+  804480:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804483:	5b                   	pop    %ebx
+  804484:	5e                   	pop    %esi
+  804485:	5d                   	pop    %ebp
+  804486:	c3                   	ret
+
+00804487 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804487:	55                   	push   %ebp
+  804488:	89 e5                	mov    %esp,%ebp
+  80448a:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  80448d:	83 3d 68 a9 85 00 00 	cmpl   $0x0,0x85a968
+  804494:	74 0a                	je     8044a0 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804496:	8b 45 08             	mov    0x8(%ebp),%eax
+  804499:	a3 68 a9 85 00       	mov    %eax,0x85a968
+}
+  80449e:	c9                   	leave
+  80449f:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  8044a0:	83 ec 04             	sub    $0x4,%esp
+  8044a3:	6a 07                	push   $0x7
+  8044a5:	68 00 f0 bf ee       	push   $0xeebff000
+  8044aa:	6a 00                	push   $0x0
+  8044ac:	e8 e7 f9 ff ff       	call   803e98 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8044b1:	83 c4 08             	add    $0x8,%esp
+  8044b4:	68 27 45 80 00       	push   $0x804527
+  8044b9:	6a 00                	push   $0x0
+  8044bb:	e8 3e fd ff ff       	call   8041fe <sys_env_set_pgfault_upcall>
+  8044c0:	83 c4 10             	add    $0x10,%esp
+  8044c3:	eb d1                	jmp    804496 <set_pgfault_handler+0xf>
+
+008044c5 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  8044c5:	55                   	push   %ebp
+  8044c6:	89 e5                	mov    %esp,%ebp
+  8044c8:	83 ec 08             	sub    $0x8,%esp
+  8044cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  8044ce:	8b 15 04 39 85 00    	mov    0x853904,%edx
+  8044d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d9:	eb 03                	jmp    8044de <add_pgfault_handler+0x19>
+  8044db:	83 c0 01             	add    $0x1,%eax
+  8044de:	39 d0                	cmp    %edx,%eax
+  8044e0:	74 0b                	je     8044ed <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  8044e2:	39 0c 85 40 a9 85 00 	cmp    %ecx,0x85a940(,%eax,4)
+  8044e9:	75 f0                	jne    8044db <add_pgfault_handler+0x16>
+  8044eb:	eb 24                	jmp    804511 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  8044ed:	83 fa 0a             	cmp    $0xa,%edx
+  8044f0:	74 21                	je     804513 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  8044f2:	8d 42 01             	lea    0x1(%edx),%eax
+  8044f5:	a3 04 39 85 00       	mov    %eax,0x853904
+  8044fa:	89 0c 95 40 a9 85 00 	mov    %ecx,0x85a940(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  804501:	83 ec 0c             	sub    $0xc,%esp
+  804504:	68 33 44 80 00       	push   $0x804433
+  804509:	e8 79 ff ff ff       	call   804487 <set_pgfault_handler>
+  80450e:	83 c4 10             	add    $0x10,%esp
+}
+  804511:	c9                   	leave
+  804512:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  804513:	83 ec 04             	sub    $0x4,%esp
+  804516:	68 69 86 80 00       	push   $0x808669
+  80451b:	6a 44                	push   $0x44
+  80451d:	68 5b 86 80 00       	push   $0x80865b
+  804522:	e8 bc ed ff ff       	call   8032e3 <_panic>
+
+00804527 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804527:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804528:	a1 68 a9 85 00       	mov    0x85a968,%eax
+	call *%eax
+  80452d:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80452f:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  804532:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  804536:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  80453a:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  80453d:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  80453f:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  804543:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  804546:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  804547:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  80454a:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  80454b:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80454c:	c3                   	ret
+
+0080454d <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  80454d:	55                   	push   %ebp
+  80454e:	89 e5                	mov    %esp,%ebp
+  804550:	57                   	push   %edi
+  804551:	56                   	push   %esi
+  804552:	53                   	push   %ebx
+  804553:	83 ec 14             	sub    $0x14,%esp
+  804556:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804559:	8b 75 14             	mov    0x14(%ebp),%esi
+  80455c:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  80455f:	ff 75 10             	push   0x10(%ebp)
+  804562:	ff 75 0c             	push   0xc(%ebp)
+  804565:	e8 51 fd ff ff       	call   8042bb <sys_ipc_recv_pages>
+  80456a:	83 c4 10             	add    $0x10,%esp
+  80456d:	85 c0                	test   %eax,%eax
+  80456f:	78 46                	js     8045b7 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804571:	85 ff                	test   %edi,%edi
+  804573:	74 0d                	je     804582 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804575:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  80457a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804580:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804582:	85 f6                	test   %esi,%esi
+  804584:	74 0d                	je     804593 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804586:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  80458b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804591:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804593:	85 db                	test   %ebx,%ebx
+  804595:	74 0d                	je     8045a4 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804597:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  80459c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8045a2:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8045a4:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  8045a9:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8045af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045b2:	5b                   	pop    %ebx
+  8045b3:	5e                   	pop    %esi
+  8045b4:	5f                   	pop    %edi
+  8045b5:	5d                   	pop    %ebp
+  8045b6:	c3                   	ret
+		if (from_env_store) {
+  8045b7:	85 ff                	test   %edi,%edi
+  8045b9:	74 06                	je     8045c1 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  8045bb:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8045c1:	85 f6                	test   %esi,%esi
+  8045c3:	74 06                	je     8045cb <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  8045c5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8045cb:	85 db                	test   %ebx,%ebx
+  8045cd:	74 e0                	je     8045af <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8045cf:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8045d5:	eb d8                	jmp    8045af <ipc_recv_pages+0x62>
+
+008045d7 <ipc_recv>:
+{
+  8045d7:	55                   	push   %ebp
+  8045d8:	89 e5                	mov    %esp,%ebp
+  8045da:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8045dd:	6a 00                	push   $0x0
+  8045df:	ff 75 10             	push   0x10(%ebp)
+  8045e2:	6a 01                	push   $0x1
+  8045e4:	ff 75 0c             	push   0xc(%ebp)
+  8045e7:	ff 75 08             	push   0x8(%ebp)
+  8045ea:	e8 5e ff ff ff       	call   80454d <ipc_recv_pages>
+}
+  8045ef:	c9                   	leave
+  8045f0:	c3                   	ret
+
+008045f1 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8045f1:	55                   	push   %ebp
+  8045f2:	89 e5                	mov    %esp,%ebp
+  8045f4:	56                   	push   %esi
+  8045f5:	53                   	push   %ebx
+  8045f6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8045f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8045fc:	83 ec 0c             	sub    $0xc,%esp
+  8045ff:	ff 75 0c             	push   0xc(%ebp)
+  804602:	e8 e8 fd ff ff       	call   8043ef <sys_ipc_try_recv>
+  804607:	83 c4 10             	add    $0x10,%esp
+  80460a:	85 c0                	test   %eax,%eax
+  80460c:	78 34                	js     804642 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80460e:	85 f6                	test   %esi,%esi
+  804610:	74 0d                	je     80461f <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  804612:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  804617:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80461d:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  80461f:	85 db                	test   %ebx,%ebx
+  804621:	74 0d                	je     804630 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  804623:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  804628:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80462e:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804630:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  804635:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80463b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80463e:	5b                   	pop    %ebx
+  80463f:	5e                   	pop    %esi
+  804640:	5d                   	pop    %ebp
+  804641:	c3                   	ret
+		if (from_env_store) {
+  804642:	85 f6                	test   %esi,%esi
+  804644:	74 06                	je     80464c <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  804646:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  80464c:	85 db                	test   %ebx,%ebx
+  80464e:	74 eb                	je     80463b <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  804650:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804656:	eb e3                	jmp    80463b <ipc_try_recv+0x4a>
+
+00804658 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804658:	55                   	push   %ebp
+  804659:	89 e5                	mov    %esp,%ebp
+  80465b:	83 ec 14             	sub    $0x14,%esp
+  80465e:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804661:	85 c0                	test   %eax,%eax
+  804663:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804668:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80466b:	ff 75 18             	push   0x18(%ebp)
+  80466e:	ff 75 14             	push   0x14(%ebp)
+  804671:	50                   	push   %eax
+  804672:	ff 75 0c             	push   0xc(%ebp)
+  804675:	ff 75 08             	push   0x8(%ebp)
+  804678:	e8 01 fc ff ff       	call   80427e <sys_ipc_send_pages>
+  80467d:	83 c4 20             	add    $0x20,%esp
+  804680:	85 c0                	test   %eax,%eax
+  804682:	78 02                	js     804686 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804684:	c9                   	leave
+  804685:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804686:	50                   	push   %eax
+  804687:	68 84 86 80 00       	push   $0x808684
+  80468c:	68 80 00 00 00       	push   $0x80
+  804691:	68 b0 86 80 00       	push   $0x8086b0
+  804696:	e8 48 ec ff ff       	call   8032e3 <_panic>
+
+0080469b <ipc_send>:
+{
+  80469b:	55                   	push   %ebp
+  80469c:	89 e5                	mov    %esp,%ebp
+  80469e:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  8046a1:	ff 75 14             	push   0x14(%ebp)
+  8046a4:	6a 01                	push   $0x1
+  8046a6:	ff 75 10             	push   0x10(%ebp)
+  8046a9:	ff 75 0c             	push   0xc(%ebp)
+  8046ac:	ff 75 08             	push   0x8(%ebp)
+  8046af:	e8 a4 ff ff ff       	call   804658 <ipc_send_pages>
+}
+  8046b4:	83 c4 20             	add    $0x20,%esp
+  8046b7:	c9                   	leave
+  8046b8:	c3                   	ret
+
+008046b9 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8046b9:	55                   	push   %ebp
+  8046ba:	89 e5                	mov    %esp,%ebp
+  8046bc:	83 ec 14             	sub    $0x14,%esp
+  8046bf:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8046c2:	85 c0                	test   %eax,%eax
+  8046c4:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8046c9:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8046cc:	ff 75 18             	push   0x18(%ebp)
+  8046cf:	ff 75 14             	push   0x14(%ebp)
+  8046d2:	50                   	push   %eax
+  8046d3:	ff 75 0c             	push   0xc(%ebp)
+  8046d6:	ff 75 08             	push   0x8(%ebp)
+  8046d9:	e8 31 fc ff ff       	call   80430f <sys_ipc_call>
+  8046de:	83 c4 20             	add    $0x20,%esp
+  8046e1:	85 c0                	test   %eax,%eax
+  8046e3:	78 0b                	js     8046f0 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  8046e5:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  8046ea:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8046f0:	c9                   	leave
+  8046f1:	c3                   	ret
+
+008046f2 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  8046f2:	55                   	push   %ebp
+  8046f3:	89 e5                	mov    %esp,%ebp
+  8046f5:	57                   	push   %edi
+  8046f6:	56                   	push   %esi
+  8046f7:	53                   	push   %ebx
+  8046f8:	83 ec 18             	sub    $0x18,%esp
+  8046fb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8046fe:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  804701:	8b 75 20             	mov    0x20(%ebp),%esi
+  804704:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804707:	85 c0                	test   %eax,%eax
+  804709:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80470e:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804711:	ff 75 18             	push   0x18(%ebp)
+  804714:	ff 75 14             	push   0x14(%ebp)
+  804717:	50                   	push   %eax
+  804718:	ff 75 0c             	push   0xc(%ebp)
+  80471b:	ff 75 08             	push   0x8(%ebp)
+  80471e:	e8 2d fc ff ff       	call   804350 <sys_ipc_reply_recv>
+  804723:	83 c4 20             	add    $0x20,%esp
+  804726:	85 c0                	test   %eax,%eax
+  804728:	78 46                	js     804770 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80472a:	85 ff                	test   %edi,%edi
+  80472c:	74 0d                	je     80473b <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  80472e:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  804733:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804739:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80473b:	85 f6                	test   %esi,%esi
+  80473d:	74 0d                	je     80474c <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  80473f:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  804744:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80474a:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80474c:	85 db                	test   %ebx,%ebx
+  80474e:	74 0d                	je     80475d <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  804750:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  804755:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80475b:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80475d:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  804762:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804768:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80476b:	5b                   	pop    %ebx
+  80476c:	5e                   	pop    %esi
+  80476d:	5f                   	pop    %edi
+  80476e:	5d                   	pop    %ebp
+  80476f:	c3                   	ret
+		if (from_env_store) {
+  804770:	85 ff                	test   %edi,%edi
+  804772:	74 06                	je     80477a <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  804774:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80477a:	85 f6                	test   %esi,%esi
+  80477c:	74 06                	je     804784 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  80477e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804784:	85 db                	test   %ebx,%ebx
+  804786:	74 e0                	je     804768 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  804788:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80478e:	eb d8                	jmp    804768 <ipc_reply_recv+0x76>
+
+00804790 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804790:	55                   	push   %ebp
+  804791:	89 e5                	mov    %esp,%ebp
+  804793:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804796:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80479b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80479e:	c1 e0 06             	shl    $0x6,%eax
+  8047a1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8047a6:	8b 40 50             	mov    0x50(%eax),%eax
+  8047a9:	39 c8                	cmp    %ecx,%eax
+  8047ab:	74 12                	je     8047bf <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8047ad:	83 c2 01             	add    $0x1,%edx
+  8047b0:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8047b6:	75 e3                	jne    80479b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8047b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047bd:	eb 0e                	jmp    8047cd <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8047bf:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8047c2:	c1 e0 06             	shl    $0x6,%eax
+  8047c5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8047ca:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8047cd:	5d                   	pop    %ebp
+  8047ce:	c3                   	ret
+
+008047cf <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8047cf:	55                   	push   %ebp
+  8047d0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8047d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8047d5:	05 00 00 00 30       	add    $0x30000000,%eax
+  8047da:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8047dd:	5d                   	pop    %ebp
+  8047de:	c3                   	ret
+
+008047df <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8047df:	55                   	push   %ebp
+  8047e0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8047e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8047e5:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8047ea:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8047ef:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8047f4:	5d                   	pop    %ebp
+  8047f5:	c3                   	ret
+
+008047f6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8047f6:	55                   	push   %ebp
+  8047f7:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8047f9:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8047fe:	a8 01                	test   $0x1,%al
+  804800:	74 3c                	je     80483e <fd_alloc+0x48>
+  804802:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  804807:	89 c2                	mov    %eax,%edx
+  804809:	c1 ea 0c             	shr    $0xc,%edx
+  80480c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  804813:	89 c1                	mov    %eax,%ecx
+  804815:	05 00 10 00 00       	add    $0x1000,%eax
+  80481a:	f6 c2 01             	test   $0x1,%dl
+  80481d:	74 13                	je     804832 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80481f:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  804824:	75 e1                	jne    804807 <fd_alloc+0x11>
+  804826:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80482b:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  804830:	eb 05                	jmp    804837 <fd_alloc+0x41>
+			return 0;
+  804832:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  804837:	8b 55 08             	mov    0x8(%ebp),%edx
+  80483a:	89 0a                	mov    %ecx,(%edx)
+}
+  80483c:	5d                   	pop    %ebp
+  80483d:	c3                   	ret
+  80483e:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  804843:	b8 00 00 00 00       	mov    $0x0,%eax
+  804848:	eb ed                	jmp    804837 <fd_alloc+0x41>
+
+0080484a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80484a:	55                   	push   %ebp
+  80484b:	89 e5                	mov    %esp,%ebp
+  80484d:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  804850:	83 f8 1f             	cmp    $0x1f,%eax
+  804853:	77 30                	ja     804885 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  804855:	c1 e0 0c             	shl    $0xc,%eax
+  804858:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80485d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  804863:	f6 c2 01             	test   $0x1,%dl
+  804866:	74 24                	je     80488c <fd_lookup+0x42>
+  804868:	89 c2                	mov    %eax,%edx
+  80486a:	c1 ea 0c             	shr    $0xc,%edx
+  80486d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  804874:	f6 c2 01             	test   $0x1,%dl
+  804877:	74 1a                	je     804893 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  804879:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80487c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80487e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804883:	5d                   	pop    %ebp
+  804884:	c3                   	ret
+		return -E_INVAL;
+  804885:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80488a:	eb f7                	jmp    804883 <fd_lookup+0x39>
+		return -E_INVAL;
+  80488c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804891:	eb f0                	jmp    804883 <fd_lookup+0x39>
+  804893:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804898:	eb e9                	jmp    804883 <fd_lookup+0x39>
+
+0080489a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80489a:	55                   	push   %ebp
+  80489b:	89 e5                	mov    %esp,%ebp
+  80489d:	53                   	push   %ebx
+  80489e:	83 ec 04             	sub    $0x4,%esp
+  8048a1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8048a4:	b8 38 87 80 00       	mov    $0x808738,%eax
+  8048a9:	8b 18                	mov    (%eax),%ebx
+  8048ab:	85 db                	test   %ebx,%ebx
+  8048ad:	74 0e                	je     8048bd <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  8048af:	83 c0 04             	add    $0x4,%eax
+  8048b2:	39 13                	cmp    %edx,(%ebx)
+  8048b4:	75 f3                	jne    8048a9 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  8048b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048bb:	eb 1f                	jmp    8048dc <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8048bd:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  8048c2:	8b 40 48             	mov    0x48(%eax),%eax
+  8048c5:	83 ec 04             	sub    $0x4,%esp
+  8048c8:	52                   	push   %edx
+  8048c9:	50                   	push   %eax
+  8048ca:	68 bc 86 80 00       	push   $0x8086bc
+  8048cf:	e8 ea ea ff ff       	call   8033be <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8048d4:	83 c4 10             	add    $0x10,%esp
+  8048d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8048dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8048df:	89 1a                	mov    %ebx,(%edx)
+}
+  8048e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8048e4:	c9                   	leave
+  8048e5:	c3                   	ret
+
+008048e6 <fd_close>:
+{
+  8048e6:	55                   	push   %ebp
+  8048e7:	89 e5                	mov    %esp,%ebp
+  8048e9:	57                   	push   %edi
+  8048ea:	56                   	push   %esi
+  8048eb:	53                   	push   %ebx
+  8048ec:	83 ec 24             	sub    $0x24,%esp
+  8048ef:	8b 75 08             	mov    0x8(%ebp),%esi
+  8048f2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8048f5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8048f8:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8048f9:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8048ff:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  804902:	50                   	push   %eax
+  804903:	e8 42 ff ff ff       	call   80484a <fd_lookup>
+  804908:	89 c3                	mov    %eax,%ebx
+  80490a:	83 c4 10             	add    $0x10,%esp
+  80490d:	85 c0                	test   %eax,%eax
+  80490f:	78 05                	js     804916 <fd_close+0x30>
+	    || fd != fd2)
+  804911:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  804914:	74 16                	je     80492c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  804916:	89 f8                	mov    %edi,%eax
+  804918:	84 c0                	test   %al,%al
+  80491a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80491f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  804922:	89 d8                	mov    %ebx,%eax
+  804924:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804927:	5b                   	pop    %ebx
+  804928:	5e                   	pop    %esi
+  804929:	5f                   	pop    %edi
+  80492a:	5d                   	pop    %ebp
+  80492b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80492c:	83 ec 08             	sub    $0x8,%esp
+  80492f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  804932:	50                   	push   %eax
+  804933:	ff 36                	push   (%esi)
+  804935:	e8 60 ff ff ff       	call   80489a <dev_lookup>
+  80493a:	89 c3                	mov    %eax,%ebx
+  80493c:	83 c4 10             	add    $0x10,%esp
+  80493f:	85 c0                	test   %eax,%eax
+  804941:	78 1a                	js     80495d <fd_close+0x77>
+		if (dev->dev_close)
+  804943:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804946:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  804949:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80494e:	85 c0                	test   %eax,%eax
+  804950:	74 0b                	je     80495d <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  804952:	83 ec 0c             	sub    $0xc,%esp
+  804955:	56                   	push   %esi
+  804956:	ff d0                	call   *%eax
+  804958:	89 c3                	mov    %eax,%ebx
+  80495a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80495d:	83 ec 08             	sub    $0x8,%esp
+  804960:	56                   	push   %esi
+  804961:	6a 00                	push   $0x0
+  804963:	e8 b5 f5 ff ff       	call   803f1d <sys_page_unmap>
+	return r;
+  804968:	83 c4 10             	add    $0x10,%esp
+  80496b:	eb b5                	jmp    804922 <fd_close+0x3c>
+
+0080496d <close>:
+
+int
+close(int fdnum)
+{
+  80496d:	55                   	push   %ebp
+  80496e:	89 e5                	mov    %esp,%ebp
+  804970:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804973:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804976:	50                   	push   %eax
+  804977:	ff 75 08             	push   0x8(%ebp)
+  80497a:	e8 cb fe ff ff       	call   80484a <fd_lookup>
+  80497f:	83 c4 10             	add    $0x10,%esp
+  804982:	85 c0                	test   %eax,%eax
+  804984:	79 02                	jns    804988 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  804986:	c9                   	leave
+  804987:	c3                   	ret
+		return fd_close(fd, 1);
+  804988:	83 ec 08             	sub    $0x8,%esp
+  80498b:	6a 01                	push   $0x1
+  80498d:	ff 75 f4             	push   -0xc(%ebp)
+  804990:	e8 51 ff ff ff       	call   8048e6 <fd_close>
+  804995:	83 c4 10             	add    $0x10,%esp
+  804998:	eb ec                	jmp    804986 <close+0x19>
+
+0080499a <close_all>:
+
+void
+close_all(void)
+{
+  80499a:	55                   	push   %ebp
+  80499b:	89 e5                	mov    %esp,%ebp
+  80499d:	53                   	push   %ebx
+  80499e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8049a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8049a6:	83 ec 0c             	sub    $0xc,%esp
+  8049a9:	53                   	push   %ebx
+  8049aa:	e8 be ff ff ff       	call   80496d <close>
+	for (i = 0; i < MAXFD; i++)
+  8049af:	83 c3 01             	add    $0x1,%ebx
+  8049b2:	83 c4 10             	add    $0x10,%esp
+  8049b5:	83 fb 20             	cmp    $0x20,%ebx
+  8049b8:	75 ec                	jne    8049a6 <close_all+0xc>
+}
+  8049ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8049bd:	c9                   	leave
+  8049be:	c3                   	ret
+
+008049bf <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8049bf:	55                   	push   %ebp
+  8049c0:	89 e5                	mov    %esp,%ebp
+  8049c2:	57                   	push   %edi
+  8049c3:	56                   	push   %esi
+  8049c4:	53                   	push   %ebx
+  8049c5:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8049c8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8049cb:	50                   	push   %eax
+  8049cc:	ff 75 08             	push   0x8(%ebp)
+  8049cf:	e8 76 fe ff ff       	call   80484a <fd_lookup>
+  8049d4:	89 c3                	mov    %eax,%ebx
+  8049d6:	83 c4 10             	add    $0x10,%esp
+  8049d9:	85 c0                	test   %eax,%eax
+  8049db:	78 7f                	js     804a5c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8049dd:	83 ec 0c             	sub    $0xc,%esp
+  8049e0:	ff 75 0c             	push   0xc(%ebp)
+  8049e3:	e8 85 ff ff ff       	call   80496d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8049e8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8049eb:	c1 e6 0c             	shl    $0xc,%esi
+  8049ee:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8049f4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8049f7:	89 3c 24             	mov    %edi,(%esp)
+  8049fa:	e8 e0 fd ff ff       	call   8047df <fd2data>
+  8049ff:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  804a01:	89 34 24             	mov    %esi,(%esp)
+  804a04:	e8 d6 fd ff ff       	call   8047df <fd2data>
+  804a09:	83 c4 10             	add    $0x10,%esp
+  804a0c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  804a0f:	89 d8                	mov    %ebx,%eax
+  804a11:	c1 e8 16             	shr    $0x16,%eax
+  804a14:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  804a1b:	a8 01                	test   $0x1,%al
+  804a1d:	74 11                	je     804a30 <dup+0x71>
+  804a1f:	89 d8                	mov    %ebx,%eax
+  804a21:	c1 e8 0c             	shr    $0xc,%eax
+  804a24:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  804a2b:	f6 c2 01             	test   $0x1,%dl
+  804a2e:	75 36                	jne    804a66 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  804a30:	89 f8                	mov    %edi,%eax
+  804a32:	c1 e8 0c             	shr    $0xc,%eax
+  804a35:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804a3c:	83 ec 0c             	sub    $0xc,%esp
+  804a3f:	25 07 0e 00 00       	and    $0xe07,%eax
+  804a44:	50                   	push   %eax
+  804a45:	56                   	push   %esi
+  804a46:	6a 00                	push   $0x0
+  804a48:	57                   	push   %edi
+  804a49:	6a 00                	push   $0x0
+  804a4b:	e8 8b f4 ff ff       	call   803edb <sys_page_map>
+  804a50:	89 c3                	mov    %eax,%ebx
+  804a52:	83 c4 20             	add    $0x20,%esp
+  804a55:	85 c0                	test   %eax,%eax
+  804a57:	78 33                	js     804a8c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  804a59:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  804a5c:	89 d8                	mov    %ebx,%eax
+  804a5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a61:	5b                   	pop    %ebx
+  804a62:	5e                   	pop    %esi
+  804a63:	5f                   	pop    %edi
+  804a64:	5d                   	pop    %ebp
+  804a65:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  804a66:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804a6d:	83 ec 0c             	sub    $0xc,%esp
+  804a70:	25 07 0e 00 00       	and    $0xe07,%eax
+  804a75:	50                   	push   %eax
+  804a76:	ff 75 d4             	push   -0x2c(%ebp)
+  804a79:	6a 00                	push   $0x0
+  804a7b:	53                   	push   %ebx
+  804a7c:	6a 00                	push   $0x0
+  804a7e:	e8 58 f4 ff ff       	call   803edb <sys_page_map>
+  804a83:	89 c3                	mov    %eax,%ebx
+  804a85:	83 c4 20             	add    $0x20,%esp
+  804a88:	85 c0                	test   %eax,%eax
+  804a8a:	79 a4                	jns    804a30 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  804a8c:	83 ec 08             	sub    $0x8,%esp
+  804a8f:	56                   	push   %esi
+  804a90:	6a 00                	push   $0x0
+  804a92:	e8 86 f4 ff ff       	call   803f1d <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  804a97:	83 c4 08             	add    $0x8,%esp
+  804a9a:	ff 75 d4             	push   -0x2c(%ebp)
+  804a9d:	6a 00                	push   $0x0
+  804a9f:	e8 79 f4 ff ff       	call   803f1d <sys_page_unmap>
+	return r;
+  804aa4:	83 c4 10             	add    $0x10,%esp
+  804aa7:	eb b3                	jmp    804a5c <dup+0x9d>
+
+00804aa9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  804aa9:	55                   	push   %ebp
+  804aaa:	89 e5                	mov    %esp,%ebp
+  804aac:	56                   	push   %esi
+  804aad:	53                   	push   %ebx
+  804aae:	83 ec 18             	sub    $0x18,%esp
+  804ab1:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804ab4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  804ab7:	50                   	push   %eax
+  804ab8:	56                   	push   %esi
+  804ab9:	e8 8c fd ff ff       	call   80484a <fd_lookup>
+  804abe:	83 c4 10             	add    $0x10,%esp
+  804ac1:	85 c0                	test   %eax,%eax
+  804ac3:	78 3c                	js     804b01 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804ac5:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  804ac8:	83 ec 08             	sub    $0x8,%esp
+  804acb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804ace:	50                   	push   %eax
+  804acf:	ff 33                	push   (%ebx)
+  804ad1:	e8 c4 fd ff ff       	call   80489a <dev_lookup>
+  804ad6:	83 c4 10             	add    $0x10,%esp
+  804ad9:	85 c0                	test   %eax,%eax
+  804adb:	78 24                	js     804b01 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  804add:	8b 43 08             	mov    0x8(%ebx),%eax
+  804ae0:	83 e0 03             	and    $0x3,%eax
+  804ae3:	83 f8 01             	cmp    $0x1,%eax
+  804ae6:	74 20                	je     804b08 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  804ae8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804aeb:	8b 40 08             	mov    0x8(%eax),%eax
+  804aee:	85 c0                	test   %eax,%eax
+  804af0:	74 37                	je     804b29 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  804af2:	83 ec 04             	sub    $0x4,%esp
+  804af5:	ff 75 10             	push   0x10(%ebp)
+  804af8:	ff 75 0c             	push   0xc(%ebp)
+  804afb:	53                   	push   %ebx
+  804afc:	ff d0                	call   *%eax
+  804afe:	83 c4 10             	add    $0x10,%esp
+}
+  804b01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804b04:	5b                   	pop    %ebx
+  804b05:	5e                   	pop    %esi
+  804b06:	5d                   	pop    %ebp
+  804b07:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  804b08:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  804b0d:	8b 40 48             	mov    0x48(%eax),%eax
+  804b10:	83 ec 04             	sub    $0x4,%esp
+  804b13:	56                   	push   %esi
+  804b14:	50                   	push   %eax
+  804b15:	68 fd 86 80 00       	push   $0x8086fd
+  804b1a:	e8 9f e8 ff ff       	call   8033be <cprintf>
+		return -E_INVAL;
+  804b1f:	83 c4 10             	add    $0x10,%esp
+  804b22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804b27:	eb d8                	jmp    804b01 <read+0x58>
+		return -E_NOT_SUPP;
+  804b29:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804b2e:	eb d1                	jmp    804b01 <read+0x58>
+
+00804b30 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  804b30:	55                   	push   %ebp
+  804b31:	89 e5                	mov    %esp,%ebp
+  804b33:	57                   	push   %edi
+  804b34:	56                   	push   %esi
+  804b35:	53                   	push   %ebx
+  804b36:	83 ec 0c             	sub    $0xc,%esp
+  804b39:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804b3c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  804b3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804b44:	eb 02                	jmp    804b48 <readn+0x18>
+  804b46:	01 c3                	add    %eax,%ebx
+  804b48:	39 f3                	cmp    %esi,%ebx
+  804b4a:	73 21                	jae    804b6d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  804b4c:	83 ec 04             	sub    $0x4,%esp
+  804b4f:	89 f0                	mov    %esi,%eax
+  804b51:	29 d8                	sub    %ebx,%eax
+  804b53:	50                   	push   %eax
+  804b54:	89 d8                	mov    %ebx,%eax
+  804b56:	03 45 0c             	add    0xc(%ebp),%eax
+  804b59:	50                   	push   %eax
+  804b5a:	57                   	push   %edi
+  804b5b:	e8 49 ff ff ff       	call   804aa9 <read>
+		if (m < 0)
+  804b60:	83 c4 10             	add    $0x10,%esp
+  804b63:	85 c0                	test   %eax,%eax
+  804b65:	78 04                	js     804b6b <readn+0x3b>
+			return m;
+		if (m == 0)
+  804b67:	75 dd                	jne    804b46 <readn+0x16>
+  804b69:	eb 02                	jmp    804b6d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  804b6b:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  804b6d:	89 d8                	mov    %ebx,%eax
+  804b6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b72:	5b                   	pop    %ebx
+  804b73:	5e                   	pop    %esi
+  804b74:	5f                   	pop    %edi
+  804b75:	5d                   	pop    %ebp
+  804b76:	c3                   	ret
+
+00804b77 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  804b77:	55                   	push   %ebp
+  804b78:	89 e5                	mov    %esp,%ebp
+  804b7a:	56                   	push   %esi
+  804b7b:	53                   	push   %ebx
+  804b7c:	83 ec 18             	sub    $0x18,%esp
+  804b7f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804b82:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  804b85:	50                   	push   %eax
+  804b86:	53                   	push   %ebx
+  804b87:	e8 be fc ff ff       	call   80484a <fd_lookup>
+  804b8c:	83 c4 10             	add    $0x10,%esp
+  804b8f:	85 c0                	test   %eax,%eax
+  804b91:	78 37                	js     804bca <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804b93:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804b96:	83 ec 08             	sub    $0x8,%esp
+  804b99:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804b9c:	50                   	push   %eax
+  804b9d:	ff 36                	push   (%esi)
+  804b9f:	e8 f6 fc ff ff       	call   80489a <dev_lookup>
+  804ba4:	83 c4 10             	add    $0x10,%esp
+  804ba7:	85 c0                	test   %eax,%eax
+  804ba9:	78 1f                	js     804bca <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804bab:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  804baf:	74 20                	je     804bd1 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  804bb1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804bb4:	8b 40 0c             	mov    0xc(%eax),%eax
+  804bb7:	85 c0                	test   %eax,%eax
+  804bb9:	74 37                	je     804bf2 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  804bbb:	83 ec 04             	sub    $0x4,%esp
+  804bbe:	ff 75 10             	push   0x10(%ebp)
+  804bc1:	ff 75 0c             	push   0xc(%ebp)
+  804bc4:	56                   	push   %esi
+  804bc5:	ff d0                	call   *%eax
+  804bc7:	83 c4 10             	add    $0x10,%esp
+}
+  804bca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804bcd:	5b                   	pop    %ebx
+  804bce:	5e                   	pop    %esi
+  804bcf:	5d                   	pop    %ebp
+  804bd0:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  804bd1:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  804bd6:	8b 40 48             	mov    0x48(%eax),%eax
+  804bd9:	83 ec 04             	sub    $0x4,%esp
+  804bdc:	53                   	push   %ebx
+  804bdd:	50                   	push   %eax
+  804bde:	68 19 87 80 00       	push   $0x808719
+  804be3:	e8 d6 e7 ff ff       	call   8033be <cprintf>
+		return -E_INVAL;
+  804be8:	83 c4 10             	add    $0x10,%esp
+  804beb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804bf0:	eb d8                	jmp    804bca <write+0x53>
+		return -E_NOT_SUPP;
+  804bf2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804bf7:	eb d1                	jmp    804bca <write+0x53>
+
+00804bf9 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  804bf9:	55                   	push   %ebp
+  804bfa:	89 e5                	mov    %esp,%ebp
+  804bfc:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804bff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804c02:	50                   	push   %eax
+  804c03:	ff 75 08             	push   0x8(%ebp)
+  804c06:	e8 3f fc ff ff       	call   80484a <fd_lookup>
+  804c0b:	83 c4 10             	add    $0x10,%esp
+  804c0e:	85 c0                	test   %eax,%eax
+  804c10:	78 0e                	js     804c20 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  804c12:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804c15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804c18:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  804c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c20:	c9                   	leave
+  804c21:	c3                   	ret
+
+00804c22 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  804c22:	55                   	push   %ebp
+  804c23:	89 e5                	mov    %esp,%ebp
+  804c25:	56                   	push   %esi
+  804c26:	53                   	push   %ebx
+  804c27:	83 ec 18             	sub    $0x18,%esp
+  804c2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804c2d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  804c30:	50                   	push   %eax
+  804c31:	53                   	push   %ebx
+  804c32:	e8 13 fc ff ff       	call   80484a <fd_lookup>
+  804c37:	83 c4 10             	add    $0x10,%esp
+  804c3a:	85 c0                	test   %eax,%eax
+  804c3c:	78 34                	js     804c72 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804c3e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804c41:	83 ec 08             	sub    $0x8,%esp
+  804c44:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804c47:	50                   	push   %eax
+  804c48:	ff 36                	push   (%esi)
+  804c4a:	e8 4b fc ff ff       	call   80489a <dev_lookup>
+  804c4f:	83 c4 10             	add    $0x10,%esp
+  804c52:	85 c0                	test   %eax,%eax
+  804c54:	78 1c                	js     804c72 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804c56:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  804c5a:	74 1d                	je     804c79 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  804c5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804c5f:	8b 40 18             	mov    0x18(%eax),%eax
+  804c62:	85 c0                	test   %eax,%eax
+  804c64:	74 34                	je     804c9a <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  804c66:	83 ec 08             	sub    $0x8,%esp
+  804c69:	ff 75 0c             	push   0xc(%ebp)
+  804c6c:	56                   	push   %esi
+  804c6d:	ff d0                	call   *%eax
+  804c6f:	83 c4 10             	add    $0x10,%esp
+}
+  804c72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804c75:	5b                   	pop    %ebx
+  804c76:	5e                   	pop    %esi
+  804c77:	5d                   	pop    %ebp
+  804c78:	c3                   	ret
+			thisenv->env_id, fdnum);
+  804c79:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  804c7e:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  804c81:	83 ec 04             	sub    $0x4,%esp
+  804c84:	53                   	push   %ebx
+  804c85:	50                   	push   %eax
+  804c86:	68 dc 86 80 00       	push   $0x8086dc
+  804c8b:	e8 2e e7 ff ff       	call   8033be <cprintf>
+		return -E_INVAL;
+  804c90:	83 c4 10             	add    $0x10,%esp
+  804c93:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804c98:	eb d8                	jmp    804c72 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  804c9a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804c9f:	eb d1                	jmp    804c72 <ftruncate+0x50>
+
+00804ca1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  804ca1:	55                   	push   %ebp
+  804ca2:	89 e5                	mov    %esp,%ebp
+  804ca4:	56                   	push   %esi
+  804ca5:	53                   	push   %ebx
+  804ca6:	83 ec 18             	sub    $0x18,%esp
+  804ca9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804cac:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  804caf:	50                   	push   %eax
+  804cb0:	ff 75 08             	push   0x8(%ebp)
+  804cb3:	e8 92 fb ff ff       	call   80484a <fd_lookup>
+  804cb8:	83 c4 10             	add    $0x10,%esp
+  804cbb:	85 c0                	test   %eax,%eax
+  804cbd:	78 49                	js     804d08 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804cbf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804cc2:	83 ec 08             	sub    $0x8,%esp
+  804cc5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804cc8:	50                   	push   %eax
+  804cc9:	ff 36                	push   (%esi)
+  804ccb:	e8 ca fb ff ff       	call   80489a <dev_lookup>
+  804cd0:	83 c4 10             	add    $0x10,%esp
+  804cd3:	85 c0                	test   %eax,%eax
+  804cd5:	78 31                	js     804d08 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  804cd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804cda:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  804cde:	74 2f                	je     804d0f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  804ce0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  804ce3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  804cea:	00 00 00 
+	stat->st_isdir = 0;
+  804ced:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  804cf4:	00 00 00 
+	stat->st_dev = dev;
+  804cf7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  804cfd:	83 ec 08             	sub    $0x8,%esp
+  804d00:	53                   	push   %ebx
+  804d01:	56                   	push   %esi
+  804d02:	ff 50 14             	call   *0x14(%eax)
+  804d05:	83 c4 10             	add    $0x10,%esp
+}
+  804d08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804d0b:	5b                   	pop    %ebx
+  804d0c:	5e                   	pop    %esi
+  804d0d:	5d                   	pop    %ebp
+  804d0e:	c3                   	ret
+		return -E_NOT_SUPP;
+  804d0f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804d14:	eb f2                	jmp    804d08 <fstat+0x67>
+
+00804d16 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  804d16:	55                   	push   %ebp
+  804d17:	89 e5                	mov    %esp,%ebp
+  804d19:	56                   	push   %esi
+  804d1a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  804d1b:	83 ec 08             	sub    $0x8,%esp
+  804d1e:	6a 00                	push   $0x0
+  804d20:	ff 75 08             	push   0x8(%ebp)
+  804d23:	e8 bc 02 00 00       	call   804fe4 <open>
+  804d28:	89 c3                	mov    %eax,%ebx
+  804d2a:	83 c4 10             	add    $0x10,%esp
+  804d2d:	85 c0                	test   %eax,%eax
+  804d2f:	78 1b                	js     804d4c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  804d31:	83 ec 08             	sub    $0x8,%esp
+  804d34:	ff 75 0c             	push   0xc(%ebp)
+  804d37:	50                   	push   %eax
+  804d38:	e8 64 ff ff ff       	call   804ca1 <fstat>
+  804d3d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  804d3f:	89 1c 24             	mov    %ebx,(%esp)
+  804d42:	e8 26 fc ff ff       	call   80496d <close>
+	return r;
+  804d47:	83 c4 10             	add    $0x10,%esp
+  804d4a:	89 f3                	mov    %esi,%ebx
+}
+  804d4c:	89 d8                	mov    %ebx,%eax
+  804d4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804d51:	5b                   	pop    %ebx
+  804d52:	5e                   	pop    %esi
+  804d53:	5d                   	pop    %ebp
+  804d54:	c3                   	ret
+
+00804d55 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  804d55:	55                   	push   %ebp
+  804d56:	89 e5                	mov    %esp,%ebp
+  804d58:	57                   	push   %edi
+  804d59:	56                   	push   %esi
+  804d5a:	53                   	push   %ebx
+  804d5b:	83 ec 0c             	sub    $0xc,%esp
+  804d5e:	89 c7                	mov    %eax,%edi
+  804d60:	89 d3                	mov    %edx,%ebx
+  804d62:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  804d64:	83 3d 08 39 85 00 00 	cmpl   $0x0,0x853908
+  804d6b:	74 2d                	je     804d9a <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  804d6d:	6a 07                	push   $0x7
+  804d6f:	68 00 b0 85 00       	push   $0x85b000
+  804d74:	57                   	push   %edi
+  804d75:	ff 35 08 39 85 00    	push   0x853908
+  804d7b:	e8 1b f9 ff ff       	call   80469b <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  804d80:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  804d87:	6a 00                	push   $0x0
+  804d89:	56                   	push   %esi
+  804d8a:	53                   	push   %ebx
+  804d8b:	6a 00                	push   $0x0
+  804d8d:	e8 bb f7 ff ff       	call   80454d <ipc_recv_pages>
+}
+  804d92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804d95:	5b                   	pop    %ebx
+  804d96:	5e                   	pop    %esi
+  804d97:	5f                   	pop    %edi
+  804d98:	5d                   	pop    %ebp
+  804d99:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804d9a:	83 ec 0c             	sub    $0xc,%esp
+  804d9d:	6a 01                	push   $0x1
+  804d9f:	e8 ec f9 ff ff       	call   804790 <ipc_find_env>
+  804da4:	a3 08 39 85 00       	mov    %eax,0x853908
+  804da9:	83 c4 10             	add    $0x10,%esp
+  804dac:	eb bf                	jmp    804d6d <fsipc_pages+0x18>
+
+00804dae <fsipc>:
+{
+  804dae:	55                   	push   %ebp
+  804daf:	89 e5                	mov    %esp,%ebp
+  804db1:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  804db4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  804db9:	e8 97 ff ff ff       	call   804d55 <fsipc_pages>
+}
+  804dbe:	c9                   	leave
+  804dbf:	c3                   	ret
+
+00804dc0 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804dc0:	55                   	push   %ebp
+  804dc1:	89 e5                	mov    %esp,%ebp
+  804dc3:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  804dc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  804dc9:	8b 40 0c             	mov    0xc(%eax),%eax
+  804dcc:	a3 00 b0 85 00       	mov    %eax,0x85b000
+	fsipcbuf.set_size.req_size = newsize;
+  804dd1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804dd4:	a3 04 b0 85 00       	mov    %eax,0x85b004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  804dd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  804dde:	b8 02 00 00 00       	mov    $0x2,%eax
+  804de3:	e8 c6 ff ff ff       	call   804dae <fsipc>
+}
+  804de8:	c9                   	leave
+  804de9:	c3                   	ret
+
+00804dea <devfile_flush>:
+{
+  804dea:	55                   	push   %ebp
+  804deb:	89 e5                	mov    %esp,%ebp
+  804ded:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  804df0:	8b 45 08             	mov    0x8(%ebp),%eax
+  804df3:	8b 40 0c             	mov    0xc(%eax),%eax
+  804df6:	a3 00 b0 85 00       	mov    %eax,0x85b000
+	return fsipc(FSREQ_FLUSH, NULL);
+  804dfb:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e00:	b8 06 00 00 00       	mov    $0x6,%eax
+  804e05:	e8 a4 ff ff ff       	call   804dae <fsipc>
+}
+  804e0a:	c9                   	leave
+  804e0b:	c3                   	ret
+
+00804e0c <devfile_stat>:
+{
+  804e0c:	55                   	push   %ebp
+  804e0d:	89 e5                	mov    %esp,%ebp
+  804e0f:	53                   	push   %ebx
+  804e10:	83 ec 04             	sub    $0x4,%esp
+  804e13:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804e16:	8b 45 08             	mov    0x8(%ebp),%eax
+  804e19:	8b 40 0c             	mov    0xc(%eax),%eax
+  804e1c:	a3 00 b0 85 00       	mov    %eax,0x85b000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804e21:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e26:	b8 05 00 00 00       	mov    $0x5,%eax
+  804e2b:	e8 7e ff ff ff       	call   804dae <fsipc>
+  804e30:	85 c0                	test   %eax,%eax
+  804e32:	78 2c                	js     804e60 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804e34:	83 ec 08             	sub    $0x8,%esp
+  804e37:	68 00 b0 85 00       	push   $0x85b000
+  804e3c:	53                   	push   %ebx
+  804e3d:	e8 63 eb ff ff       	call   8039a5 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  804e42:	a1 80 b0 85 00       	mov    0x85b080,%eax
+  804e47:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804e4d:	a1 84 b0 85 00       	mov    0x85b084,%eax
+  804e52:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  804e58:	83 c4 10             	add    $0x10,%esp
+  804e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804e63:	c9                   	leave
+  804e64:	c3                   	ret
+
+00804e65 <devfile_write>:
+{
+  804e65:	55                   	push   %ebp
+  804e66:	89 e5                	mov    %esp,%ebp
+  804e68:	83 ec 0c             	sub    $0xc,%esp
+  804e6b:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  804e6e:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  804e73:	39 d0                	cmp    %edx,%eax
+  804e75:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804e78:	8b 55 08             	mov    0x8(%ebp),%edx
+  804e7b:	8b 52 0c             	mov    0xc(%edx),%edx
+  804e7e:	89 15 00 b0 85 00    	mov    %edx,0x85b000
+	fsipcbuf.write.req_n = n;
+  804e84:	a3 04 b0 85 00       	mov    %eax,0x85b004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  804e89:	50                   	push   %eax
+  804e8a:	ff 75 0c             	push   0xc(%ebp)
+  804e8d:	68 08 b0 85 00       	push   $0x85b008
+  804e92:	e8 94 ec ff ff       	call   803b2b <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  804e97:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e9c:	b8 04 00 00 00       	mov    $0x4,%eax
+  804ea1:	e8 08 ff ff ff       	call   804dae <fsipc>
+}
+  804ea6:	c9                   	leave
+  804ea7:	c3                   	ret
+
+00804ea8 <devfile_read>:
+{
+  804ea8:	55                   	push   %ebp
+  804ea9:	89 e5                	mov    %esp,%ebp
+  804eab:	57                   	push   %edi
+  804eac:	56                   	push   %esi
+  804ead:	53                   	push   %ebx
+  804eae:	83 ec 1c             	sub    $0x1c,%esp
+  804eb1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804eb4:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  804eb7:	89 fe                	mov    %edi,%esi
+  804eb9:	c1 ee 0c             	shr    $0xc,%esi
+  804ebc:	b8 20 00 00 00       	mov    $0x20,%eax
+  804ec1:	39 c6                	cmp    %eax,%esi
+  804ec3:	0f 47 f0             	cmova  %eax,%esi
+  804ec6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804ec9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804ece:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804ed1:	eb 14                	jmp    804ee7 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  804ed3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  804eda:	05 00 10 00 00       	add    $0x1000,%eax
+  804edf:	f6 c6 06             	test   $0x6,%dh
+  804ee2:	75 42                	jne    804f26 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  804ee4:	83 c1 01             	add    $0x1,%ecx
+  804ee7:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  804eea:	39 f1                	cmp    %esi,%ecx
+  804eec:	0f 84 95 00 00 00    	je     804f87 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  804ef2:	89 c2                	mov    %eax,%edx
+  804ef4:	c1 ea 16             	shr    $0x16,%edx
+  804ef7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  804efe:	f6 c2 01             	test   $0x1,%dl
+  804f01:	74 23                	je     804f26 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  804f03:	89 c2                	mov    %eax,%edx
+  804f05:	c1 ea 0c             	shr    $0xc,%edx
+  804f08:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  804f0f:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  804f15:	74 0f                	je     804f26 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  804f17:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  804f1e:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  804f24:	75 ad                	jne    804ed3 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  804f26:	85 c9                	test   %ecx,%ecx
+  804f28:	74 11                	je     804f3b <devfile_read+0x93>
+  804f2a:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  804f31:	75 08                	jne    804f3b <devfile_read+0x93>
+  804f33:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  804f39:	74 50                	je     804f8b <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804f3b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  804f3e:	a3 00 b0 85 00       	mov    %eax,0x85b000
+	fsipcbuf.read.req_n = n;
+  804f43:	89 3d 04 b0 85 00    	mov    %edi,0x85b004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  804f49:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f4e:	b8 03 00 00 00       	mov    $0x3,%eax
+  804f53:	e8 56 fe ff ff       	call   804dae <fsipc>
+  804f58:	89 c6                	mov    %eax,%esi
+  804f5a:	85 c0                	test   %eax,%eax
+  804f5c:	78 1f                	js     804f7d <devfile_read+0xd5>
+	assert(r <= n);
+  804f5e:	39 c7                	cmp    %eax,%edi
+  804f60:	72 50                	jb     804fb2 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  804f62:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  804f67:	7f 62                	jg     804fcb <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  804f69:	83 ec 04             	sub    $0x4,%esp
+  804f6c:	50                   	push   %eax
+  804f6d:	68 00 b0 85 00       	push   $0x85b000
+  804f72:	ff 75 0c             	push   0xc(%ebp)
+  804f75:	e8 b1 eb ff ff       	call   803b2b <memmove>
+	return r;
+  804f7a:	83 c4 10             	add    $0x10,%esp
+}
+  804f7d:	89 f0                	mov    %esi,%eax
+  804f7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804f82:	5b                   	pop    %ebx
+  804f83:	5e                   	pop    %esi
+  804f84:	5f                   	pop    %edi
+  804f85:	5d                   	pop    %ebp
+  804f86:	c3                   	ret
+  804f87:	89 f1                	mov    %esi,%ecx
+  804f89:	eb 9b                	jmp    804f26 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  804f8b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  804f8e:	a3 00 b0 85 00       	mov    %eax,0x85b000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  804f93:	89 c8                	mov    %ecx,%eax
+  804f95:	c1 e0 0c             	shl    $0xc,%eax
+  804f98:	a3 04 b0 85 00       	mov    %eax,0x85b004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  804f9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804fa0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  804fa5:	e8 ab fd ff ff       	call   804d55 <fsipc_pages>
+  804faa:	89 c6                	mov    %eax,%esi
+  804fac:	85 c0                	test   %eax,%eax
+  804fae:	78 8b                	js     804f3b <devfile_read+0x93>
+  804fb0:	eb cb                	jmp    804f7d <devfile_read+0xd5>
+	assert(r <= n);
+  804fb2:	68 48 87 80 00       	push   $0x808748
+  804fb7:	68 dd 7e 80 00       	push   $0x807edd
+  804fbc:	68 a0 00 00 00       	push   $0xa0
+  804fc1:	68 4f 87 80 00       	push   $0x80874f
+  804fc6:	e8 18 e3 ff ff       	call   8032e3 <_panic>
+	assert(r <= PGSIZE);
+  804fcb:	68 5a 87 80 00       	push   $0x80875a
+  804fd0:	68 dd 7e 80 00       	push   $0x807edd
+  804fd5:	68 a1 00 00 00       	push   $0xa1
+  804fda:	68 4f 87 80 00       	push   $0x80874f
+  804fdf:	e8 ff e2 ff ff       	call   8032e3 <_panic>
+
+00804fe4 <open>:
+{
+  804fe4:	55                   	push   %ebp
+  804fe5:	89 e5                	mov    %esp,%ebp
+  804fe7:	56                   	push   %esi
+  804fe8:	53                   	push   %ebx
+  804fe9:	83 ec 1c             	sub    $0x1c,%esp
+  804fec:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  804fef:	56                   	push   %esi
+  804ff0:	e8 75 e9 ff ff       	call   80396a <strlen>
+  804ff5:	83 c4 10             	add    $0x10,%esp
+  804ff8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804ffd:	7f 6c                	jg     80506b <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  804fff:	83 ec 0c             	sub    $0xc,%esp
+  805002:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805005:	50                   	push   %eax
+  805006:	e8 eb f7 ff ff       	call   8047f6 <fd_alloc>
+  80500b:	89 c3                	mov    %eax,%ebx
+  80500d:	83 c4 10             	add    $0x10,%esp
+  805010:	85 c0                	test   %eax,%eax
+  805012:	78 3c                	js     805050 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  805014:	83 ec 08             	sub    $0x8,%esp
+  805017:	56                   	push   %esi
+  805018:	68 00 b0 85 00       	push   $0x85b000
+  80501d:	e8 83 e9 ff ff       	call   8039a5 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  805022:	8b 45 0c             	mov    0xc(%ebp),%eax
+  805025:	a3 00 b4 85 00       	mov    %eax,0x85b400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80502a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80502d:	b8 01 00 00 00       	mov    $0x1,%eax
+  805032:	e8 77 fd ff ff       	call   804dae <fsipc>
+  805037:	89 c3                	mov    %eax,%ebx
+  805039:	83 c4 10             	add    $0x10,%esp
+  80503c:	85 c0                	test   %eax,%eax
+  80503e:	78 19                	js     805059 <open+0x75>
+	return fd2num(fd);
+  805040:	83 ec 0c             	sub    $0xc,%esp
+  805043:	ff 75 f4             	push   -0xc(%ebp)
+  805046:	e8 84 f7 ff ff       	call   8047cf <fd2num>
+  80504b:	89 c3                	mov    %eax,%ebx
+  80504d:	83 c4 10             	add    $0x10,%esp
+}
+  805050:	89 d8                	mov    %ebx,%eax
+  805052:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805055:	5b                   	pop    %ebx
+  805056:	5e                   	pop    %esi
+  805057:	5d                   	pop    %ebp
+  805058:	c3                   	ret
+		fd_close(fd, 0);
+  805059:	83 ec 08             	sub    $0x8,%esp
+  80505c:	6a 00                	push   $0x0
+  80505e:	ff 75 f4             	push   -0xc(%ebp)
+  805061:	e8 80 f8 ff ff       	call   8048e6 <fd_close>
+		return r;
+  805066:	83 c4 10             	add    $0x10,%esp
+  805069:	eb e5                	jmp    805050 <open+0x6c>
+		return -E_BAD_PATH;
+  80506b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  805070:	eb de                	jmp    805050 <open+0x6c>
+
+00805072 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  805072:	55                   	push   %ebp
+  805073:	89 e5                	mov    %esp,%ebp
+  805075:	53                   	push   %ebx
+  805076:	83 ec 10             	sub    $0x10,%esp
+  805079:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80507c:	53                   	push   %ebx
+  80507d:	e8 e8 e8 ff ff       	call   80396a <strlen>
+  805082:	83 c4 10             	add    $0x10,%esp
+  805085:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80508a:	7f 25                	jg     8050b1 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80508c:	83 ec 08             	sub    $0x8,%esp
+  80508f:	53                   	push   %ebx
+  805090:	68 00 b0 85 00       	push   $0x85b000
+  805095:	e8 0b e9 ff ff       	call   8039a5 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80509a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80509f:	b8 07 00 00 00       	mov    $0x7,%eax
+  8050a4:	e8 05 fd ff ff       	call   804dae <fsipc>
+  8050a9:	83 c4 10             	add    $0x10,%esp
+}
+  8050ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8050af:	c9                   	leave
+  8050b0:	c3                   	ret
+		return -E_BAD_PATH;
+  8050b1:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8050b6:	eb f4                	jmp    8050ac <remove+0x3a>
+
+008050b8 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8050b8:	55                   	push   %ebp
+  8050b9:	89 e5                	mov    %esp,%ebp
+  8050bb:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8050be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050c3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8050c8:	e8 e1 fc ff ff       	call   804dae <fsipc>
+}
+  8050cd:	c9                   	leave
+  8050ce:	c3                   	ret
+
+008050cf <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  8050cf:	55                   	push   %ebp
+  8050d0:	89 e5                	mov    %esp,%ebp
+  8050d2:	53                   	push   %ebx
+  8050d3:	83 ec 04             	sub    $0x4,%esp
+  8050d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  8050d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050de:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8050e3:	e8 c6 fc ff ff       	call   804dae <fsipc>
+  8050e8:	85 c0                	test   %eax,%eax
+  8050ea:	78 3c                	js     805128 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  8050ec:	a1 00 b0 85 00       	mov    0x85b000,%eax
+  8050f1:	89 03                	mov    %eax,(%ebx)
+  8050f3:	a1 04 b0 85 00       	mov    0x85b004,%eax
+  8050f8:	89 43 04             	mov    %eax,0x4(%ebx)
+  8050fb:	a1 08 b0 85 00       	mov    0x85b008,%eax
+  805100:	89 43 08             	mov    %eax,0x8(%ebx)
+  805103:	a1 0c b0 85 00       	mov    0x85b00c,%eax
+  805108:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80510b:	a1 10 b0 85 00       	mov    0x85b010,%eax
+  805110:	89 43 10             	mov    %eax,0x10(%ebx)
+  805113:	a1 14 b0 85 00       	mov    0x85b014,%eax
+  805118:	89 43 14             	mov    %eax,0x14(%ebx)
+  80511b:	a1 18 b0 85 00       	mov    0x85b018,%eax
+  805120:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  805123:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805128:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80512b:	c9                   	leave
+  80512c:	c3                   	ret
+
+0080512d <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  80512d:	55                   	push   %ebp
+  80512e:	89 e5                	mov    %esp,%ebp
+  805130:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  805133:	8b 45 08             	mov    0x8(%ebp),%eax
+  805136:	a3 00 b0 85 00       	mov    %eax,0x85b000
+	return fsipc(FSREQ_BCSET, NULL);
+  80513b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805140:	b8 0c 00 00 00       	mov    $0xc,%eax
+  805145:	e8 64 fc ff ff       	call   804dae <fsipc>
+}
+  80514a:	c9                   	leave
+  80514b:	c3                   	ret
+
+0080514c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80514c:	55                   	push   %ebp
+  80514d:	89 e5                	mov    %esp,%ebp
+  80514f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805152:	89 c2                	mov    %eax,%edx
+  805154:	c1 ea 16             	shr    $0x16,%edx
+  805157:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80515e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805163:	f6 c1 01             	test   $0x1,%cl
+  805166:	74 1e                	je     805186 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  805168:	c1 e8 0c             	shr    $0xc,%eax
+  80516b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  805172:	a8 01                	test   $0x1,%al
+  805174:	74 10                	je     805186 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  805176:	c1 e8 0c             	shr    $0xc,%eax
+  805179:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80517c:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  805183:	0f b7 d2             	movzwl %dx,%edx
+}
+  805186:	89 d0                	mov    %edx,%eax
+  805188:	5d                   	pop    %ebp
+  805189:	c3                   	ret
+
+0080518a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80518a:	55                   	push   %ebp
+  80518b:	89 e5                	mov    %esp,%ebp
+  80518d:	56                   	push   %esi
+  80518e:	53                   	push   %ebx
+  80518f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  805192:	83 ec 0c             	sub    $0xc,%esp
+  805195:	ff 75 08             	push   0x8(%ebp)
+  805198:	e8 42 f6 ff ff       	call   8047df <fd2data>
+  80519d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80519f:	83 c4 08             	add    $0x8,%esp
+  8051a2:	68 66 87 80 00       	push   $0x808766
+  8051a7:	53                   	push   %ebx
+  8051a8:	e8 f8 e7 ff ff       	call   8039a5 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8051ad:	8b 46 04             	mov    0x4(%esi),%eax
+  8051b0:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8051b6:	2b 0e                	sub    (%esi),%ecx
+  8051b8:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8051bd:	89 c8                	mov    %ecx,%eax
+  8051bf:	f7 e2                	mul    %edx
+  8051c1:	c1 ea 0c             	shr    $0xc,%edx
+  8051c4:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8051ca:	29 d1                	sub    %edx,%ecx
+  8051cc:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8051d2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8051d9:	00 00 00 
+	stat->st_dev = &devpipe;
+  8051dc:	c7 83 88 00 00 00 80 	movl   $0x810080,0x88(%ebx)
+  8051e3:	00 81 00 
+	return 0;
+}
+  8051e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8051ee:	5b                   	pop    %ebx
+  8051ef:	5e                   	pop    %esi
+  8051f0:	5d                   	pop    %ebp
+  8051f1:	c3                   	ret
+
+008051f2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8051f2:	55                   	push   %ebp
+  8051f3:	89 e5                	mov    %esp,%ebp
+  8051f5:	53                   	push   %ebx
+  8051f6:	83 ec 0c             	sub    $0xc,%esp
+  8051f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8051fc:	53                   	push   %ebx
+  8051fd:	6a 00                	push   $0x0
+  8051ff:	e8 19 ed ff ff       	call   803f1d <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  805204:	89 1c 24             	mov    %ebx,(%esp)
+  805207:	e8 d3 f5 ff ff       	call   8047df <fd2data>
+  80520c:	83 c4 08             	add    $0x8,%esp
+  80520f:	50                   	push   %eax
+  805210:	6a 00                	push   $0x0
+  805212:	e8 06 ed ff ff       	call   803f1d <sys_page_unmap>
+}
+  805217:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80521a:	c9                   	leave
+  80521b:	c3                   	ret
+
+0080521c <_pipeisclosed>:
+{
+  80521c:	55                   	push   %ebp
+  80521d:	89 e5                	mov    %esp,%ebp
+  80521f:	57                   	push   %edi
+  805220:	56                   	push   %esi
+  805221:	53                   	push   %ebx
+  805222:	83 ec 1c             	sub    $0x1c,%esp
+  805225:	89 c7                	mov    %eax,%edi
+  805227:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  805229:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  80522e:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  805231:	83 ec 0c             	sub    $0xc,%esp
+  805234:	57                   	push   %edi
+  805235:	e8 12 ff ff ff       	call   80514c <pageref>
+  80523a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80523d:	89 34 24             	mov    %esi,(%esp)
+  805240:	e8 07 ff ff ff       	call   80514c <pageref>
+		nn = thisenv->env_runs;
+  805245:	8b 15 3c a9 85 00    	mov    0x85a93c,%edx
+  80524b:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80524e:	83 c4 10             	add    $0x10,%esp
+  805251:	39 cb                	cmp    %ecx,%ebx
+  805253:	74 1b                	je     805270 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  805255:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  805258:	75 cf                	jne    805229 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80525a:	8b 42 58             	mov    0x58(%edx),%eax
+  80525d:	6a 01                	push   $0x1
+  80525f:	50                   	push   %eax
+  805260:	53                   	push   %ebx
+  805261:	68 6d 87 80 00       	push   $0x80876d
+  805266:	e8 53 e1 ff ff       	call   8033be <cprintf>
+  80526b:	83 c4 10             	add    $0x10,%esp
+  80526e:	eb b9                	jmp    805229 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  805270:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  805273:	0f 94 c0             	sete   %al
+  805276:	0f b6 c0             	movzbl %al,%eax
+}
+  805279:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80527c:	5b                   	pop    %ebx
+  80527d:	5e                   	pop    %esi
+  80527e:	5f                   	pop    %edi
+  80527f:	5d                   	pop    %ebp
+  805280:	c3                   	ret
+
+00805281 <devpipe_read>:
+{
+  805281:	55                   	push   %ebp
+  805282:	89 e5                	mov    %esp,%ebp
+  805284:	57                   	push   %edi
+  805285:	56                   	push   %esi
+  805286:	53                   	push   %ebx
+  805287:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80528a:	ff 75 08             	push   0x8(%ebp)
+  80528d:	e8 4d f5 ff ff       	call   8047df <fd2data>
+  805292:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  805294:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  805297:	8d 40 04             	lea    0x4(%eax),%eax
+  80529a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80529d:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8052a0:	8b 0b                	mov    (%ebx),%ecx
+  8052a2:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8052a8:	29 ce                	sub    %ecx,%esi
+  8052aa:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8052af:	f7 e6                	mul    %esi
+  8052b1:	c1 ea 0c             	shr    $0xc,%edx
+  8052b4:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8052ba:	29 c6                	sub    %eax,%esi
+  8052bc:	89 f2                	mov    %esi,%edx
+  8052be:	75 43                	jne    805303 <devpipe_read+0x82>
+		ref = pageref(p);
+  8052c0:	83 ec 0c             	sub    $0xc,%esp
+  8052c3:	53                   	push   %ebx
+  8052c4:	e8 83 fe ff ff       	call   80514c <pageref>
+  8052c9:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8052cb:	89 da                	mov    %ebx,%edx
+  8052cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8052d0:	e8 47 ff ff ff       	call   80521c <_pipeisclosed>
+  8052d5:	83 c4 10             	add    $0x10,%esp
+  8052d8:	85 c0                	test   %eax,%eax
+  8052da:	0f 85 c1 00 00 00    	jne    8053a1 <devpipe_read+0x120>
+	*sleeping = 1;
+  8052e0:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  8052e7:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8052ec:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  8052ef:	75 ac                	jne    80529d <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  8052f1:	83 ec 04             	sub    $0x4,%esp
+  8052f4:	56                   	push   %esi
+  8052f5:	57                   	push   %edi
+  8052f6:	ff 75 e4             	push   -0x1c(%ebp)
+  8052f9:	e8 73 f0 ff ff       	call   804371 <sys_futex_wait>
+  8052fe:	83 c4 10             	add    $0x10,%esp
+  805301:	eb 9a                	jmp    80529d <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  805303:	39 75 10             	cmp    %esi,0x10(%ebp)
+  805306:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  80530a:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80530c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  805311:	f7 e1                	mul    %ecx
+  805313:	c1 ea 0b             	shr    $0xb,%edx
+  805316:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80531c:	29 c1                	sub    %eax,%ecx
+  80531e:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  805320:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  805325:	29 cf                	sub    %ecx,%edi
+  805327:	39 f7                	cmp    %esi,%edi
+  805329:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  80532c:	8d 43 10             	lea    0x10(%ebx),%eax
+  80532f:	83 ec 04             	sub    $0x4,%esp
+  805332:	57                   	push   %edi
+  805333:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  805336:	01 c2                	add    %eax,%edx
+  805338:	52                   	push   %edx
+  805339:	ff 75 0c             	push   0xc(%ebp)
+  80533c:	e8 ea e7 ff ff       	call   803b2b <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  805341:	83 c4 0c             	add    $0xc,%esp
+  805344:	89 f1                	mov    %esi,%ecx
+  805346:	29 f9                	sub    %edi,%ecx
+  805348:	51                   	push   %ecx
+  805349:	ff 75 e4             	push   -0x1c(%ebp)
+  80534c:	89 f8                	mov    %edi,%eax
+  80534e:	03 45 0c             	add    0xc(%ebp),%eax
+  805351:	50                   	push   %eax
+  805352:	e8 d4 e7 ff ff       	call   803b2b <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  805357:	89 f1                	mov    %esi,%ecx
+  805359:	03 0b                	add    (%ebx),%ecx
+  80535b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  805360:	f7 e1                	mul    %ecx
+  805362:	c1 ea 0c             	shr    $0xc,%edx
+  805365:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80536b:	29 d1                	sub    %edx,%ecx
+  80536d:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  80536f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  805374:	83 c4 10             	add    $0x10,%esp
+  805377:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  80537b:	75 0a                	jne    805387 <devpipe_read+0x106>
+	return n;
+  80537d:	89 f0                	mov    %esi,%eax
+}
+  80537f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805382:	5b                   	pop    %ebx
+  805383:	5e                   	pop    %esi
+  805384:	5f                   	pop    %edi
+  805385:	5d                   	pop    %ebp
+  805386:	c3                   	ret
+		*sleeping = 0;
+  805387:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  80538e:	83 ec 08             	sub    $0x8,%esp
+  805391:	68 00 04 00 00       	push   $0x400
+  805396:	53                   	push   %ebx
+  805397:	e8 25 f0 ff ff       	call   8043c1 <sys_futex_wake>
+  80539c:	83 c4 10             	add    $0x10,%esp
+  80539f:	eb dc                	jmp    80537d <devpipe_read+0xfc>
+			return 0;
+  8053a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053a6:	eb d7                	jmp    80537f <devpipe_read+0xfe>
+
+008053a8 <devpipe_write>:
+{
+  8053a8:	55                   	push   %ebp
+  8053a9:	89 e5                	mov    %esp,%ebp
+  8053ab:	57                   	push   %edi
+  8053ac:	56                   	push   %esi
+  8053ad:	53                   	push   %ebx
+  8053ae:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8053b1:	ff 75 08             	push   0x8(%ebp)
+  8053b4:	e8 26 f4 ff ff       	call   8047df <fd2data>
+  8053b9:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8053bb:	83 c4 10             	add    $0x10,%esp
+  8053be:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8053c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8053c8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8053cb:	0f 83 23 01 00 00    	jae    8054f4 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8053d1:	8b 77 04             	mov    0x4(%edi),%esi
+  8053d4:	8b 1f                	mov    (%edi),%ebx
+  8053d6:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  8053dc:	29 d9                	sub    %ebx,%ecx
+  8053de:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8053e3:	f7 e1                	mul    %ecx
+  8053e5:	c1 ea 0c             	shr    $0xc,%edx
+  8053e8:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8053ee:	29 c1                	sub    %eax,%ecx
+  8053f0:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8053f2:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8053f8:	75 40                	jne    80543a <devpipe_write+0x92>
+			ref = pageref(p);
+  8053fa:	83 ec 0c             	sub    $0xc,%esp
+  8053fd:	57                   	push   %edi
+  8053fe:	e8 49 fd ff ff       	call   80514c <pageref>
+  805403:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  805405:	89 fa                	mov    %edi,%edx
+  805407:	8b 45 08             	mov    0x8(%ebp),%eax
+  80540a:	e8 0d fe ff ff       	call   80521c <_pipeisclosed>
+  80540f:	83 c4 10             	add    $0x10,%esp
+  805412:	85 c0                	test   %eax,%eax
+  805414:	0f 85 d5 00 00 00    	jne    8054ef <devpipe_write+0x147>
+	*sleeping = 1;
+  80541a:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  805421:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  805426:	39 1f                	cmp    %ebx,(%edi)
+  805428:	75 a7                	jne    8053d1 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  80542a:	83 ec 04             	sub    $0x4,%esp
+  80542d:	56                   	push   %esi
+  80542e:	53                   	push   %ebx
+  80542f:	57                   	push   %edi
+  805430:	e8 3c ef ff ff       	call   804371 <sys_futex_wait>
+  805435:	83 c4 10             	add    $0x10,%esp
+  805438:	eb 97                	jmp    8053d1 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80543a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80543d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  805440:	29 c1                	sub    %eax,%ecx
+  805442:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  805447:	89 d8                	mov    %ebx,%eax
+  805449:	29 d0                	sub    %edx,%eax
+  80544b:	39 c1                	cmp    %eax,%ecx
+  80544d:	0f 46 c1             	cmovbe %ecx,%eax
+  805450:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  805452:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  805457:	f7 e6                	mul    %esi
+  805459:	c1 ea 0b             	shr    $0xb,%edx
+  80545c:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  805462:	29 c6                	sub    %eax,%esi
+  805464:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  805466:	29 f3                	sub    %esi,%ebx
+  805468:	39 cb                	cmp    %ecx,%ebx
+  80546a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80546d:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  805470:	8d 77 10             	lea    0x10(%edi),%esi
+  805473:	83 ec 04             	sub    $0x4,%esp
+  805476:	53                   	push   %ebx
+  805477:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80547a:	03 45 0c             	add    0xc(%ebp),%eax
+  80547d:	50                   	push   %eax
+  80547e:	01 f2                	add    %esi,%edx
+  805480:	52                   	push   %edx
+  805481:	e8 a5 e6 ff ff       	call   803b2b <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  805486:	83 c4 0c             	add    $0xc,%esp
+  805489:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80548c:	29 d8                	sub    %ebx,%eax
+  80548e:	50                   	push   %eax
+  80548f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  805492:	01 d3                	add    %edx,%ebx
+  805494:	03 5d 0c             	add    0xc(%ebp),%ebx
+  805497:	53                   	push   %ebx
+  805498:	56                   	push   %esi
+  805499:	e8 8d e6 ff ff       	call   803b2b <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  80549e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8054a1:	03 4f 04             	add    0x4(%edi),%ecx
+  8054a4:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8054a9:	f7 e1                	mul    %ecx
+  8054ab:	c1 ea 0c             	shr    $0xc,%edx
+  8054ae:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8054b4:	29 d1                	sub    %edx,%ecx
+  8054b6:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8054b9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8054be:	83 c4 10             	add    $0x10,%esp
+  8054c1:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8054c5:	75 0b                	jne    8054d2 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8054c7:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8054ca:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8054cd:	e9 f3 fe ff ff       	jmp    8053c5 <devpipe_write+0x1d>
+		*sleeping = 0;
+  8054d2:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8054d9:	83 ec 08             	sub    $0x8,%esp
+  8054dc:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  8054e1:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  8054e4:	50                   	push   %eax
+  8054e5:	e8 d7 ee ff ff       	call   8043c1 <sys_futex_wake>
+  8054ea:	83 c4 10             	add    $0x10,%esp
+  8054ed:	eb d8                	jmp    8054c7 <devpipe_write+0x11f>
+				return 0;
+  8054ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8054f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8054f7:	5b                   	pop    %ebx
+  8054f8:	5e                   	pop    %esi
+  8054f9:	5f                   	pop    %edi
+  8054fa:	5d                   	pop    %ebp
+  8054fb:	c3                   	ret
+
+008054fc <pipe>:
+{
+  8054fc:	55                   	push   %ebp
+  8054fd:	89 e5                	mov    %esp,%ebp
+  8054ff:	56                   	push   %esi
+  805500:	53                   	push   %ebx
+  805501:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  805504:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805507:	50                   	push   %eax
+  805508:	e8 e9 f2 ff ff       	call   8047f6 <fd_alloc>
+  80550d:	89 c3                	mov    %eax,%ebx
+  80550f:	83 c4 10             	add    $0x10,%esp
+  805512:	85 c0                	test   %eax,%eax
+  805514:	0f 88 23 01 00 00    	js     80563d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80551a:	83 ec 04             	sub    $0x4,%esp
+  80551d:	68 07 04 00 00       	push   $0x407
+  805522:	ff 75 f4             	push   -0xc(%ebp)
+  805525:	6a 00                	push   $0x0
+  805527:	e8 6c e9 ff ff       	call   803e98 <sys_page_alloc>
+  80552c:	89 c3                	mov    %eax,%ebx
+  80552e:	83 c4 10             	add    $0x10,%esp
+  805531:	85 c0                	test   %eax,%eax
+  805533:	0f 88 04 01 00 00    	js     80563d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  805539:	83 ec 0c             	sub    $0xc,%esp
+  80553c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80553f:	50                   	push   %eax
+  805540:	e8 b1 f2 ff ff       	call   8047f6 <fd_alloc>
+  805545:	89 c3                	mov    %eax,%ebx
+  805547:	83 c4 10             	add    $0x10,%esp
+  80554a:	85 c0                	test   %eax,%eax
+  80554c:	0f 88 db 00 00 00    	js     80562d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805552:	83 ec 04             	sub    $0x4,%esp
+  805555:	68 07 04 00 00       	push   $0x407
+  80555a:	ff 75 f0             	push   -0x10(%ebp)
+  80555d:	6a 00                	push   $0x0
+  80555f:	e8 34 e9 ff ff       	call   803e98 <sys_page_alloc>
+  805564:	89 c3                	mov    %eax,%ebx
+  805566:	83 c4 10             	add    $0x10,%esp
+  805569:	85 c0                	test   %eax,%eax
+  80556b:	0f 88 bc 00 00 00    	js     80562d <pipe+0x131>
+	va = fd2data(fd0);
+  805571:	83 ec 0c             	sub    $0xc,%esp
+  805574:	ff 75 f4             	push   -0xc(%ebp)
+  805577:	e8 63 f2 ff ff       	call   8047df <fd2data>
+  80557c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80557e:	83 c4 0c             	add    $0xc,%esp
+  805581:	68 07 04 00 00       	push   $0x407
+  805586:	50                   	push   %eax
+  805587:	6a 00                	push   $0x0
+  805589:	e8 0a e9 ff ff       	call   803e98 <sys_page_alloc>
+  80558e:	89 c3                	mov    %eax,%ebx
+  805590:	83 c4 10             	add    $0x10,%esp
+  805593:	85 c0                	test   %eax,%eax
+  805595:	0f 88 82 00 00 00    	js     80561d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80559b:	83 ec 0c             	sub    $0xc,%esp
+  80559e:	ff 75 f0             	push   -0x10(%ebp)
+  8055a1:	e8 39 f2 ff ff       	call   8047df <fd2data>
+  8055a6:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8055ad:	50                   	push   %eax
+  8055ae:	6a 00                	push   $0x0
+  8055b0:	56                   	push   %esi
+  8055b1:	6a 00                	push   $0x0
+  8055b3:	e8 23 e9 ff ff       	call   803edb <sys_page_map>
+  8055b8:	89 c3                	mov    %eax,%ebx
+  8055ba:	83 c4 20             	add    $0x20,%esp
+  8055bd:	85 c0                	test   %eax,%eax
+  8055bf:	78 4e                	js     80560f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8055c1:	a1 80 00 81 00       	mov    0x810080,%eax
+  8055c6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8055c9:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8055cb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8055ce:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8055d5:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8055d8:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8055da:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8055dd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8055e4:	83 ec 0c             	sub    $0xc,%esp
+  8055e7:	ff 75 f4             	push   -0xc(%ebp)
+  8055ea:	e8 e0 f1 ff ff       	call   8047cf <fd2num>
+  8055ef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8055f2:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8055f4:	83 c4 04             	add    $0x4,%esp
+  8055f7:	ff 75 f0             	push   -0x10(%ebp)
+  8055fa:	e8 d0 f1 ff ff       	call   8047cf <fd2num>
+  8055ff:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  805602:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  805605:	83 c4 10             	add    $0x10,%esp
+  805608:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80560d:	eb 2e                	jmp    80563d <pipe+0x141>
+	sys_page_unmap(0, va);
+  80560f:	83 ec 08             	sub    $0x8,%esp
+  805612:	56                   	push   %esi
+  805613:	6a 00                	push   $0x0
+  805615:	e8 03 e9 ff ff       	call   803f1d <sys_page_unmap>
+  80561a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80561d:	83 ec 08             	sub    $0x8,%esp
+  805620:	ff 75 f0             	push   -0x10(%ebp)
+  805623:	6a 00                	push   $0x0
+  805625:	e8 f3 e8 ff ff       	call   803f1d <sys_page_unmap>
+  80562a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80562d:	83 ec 08             	sub    $0x8,%esp
+  805630:	ff 75 f4             	push   -0xc(%ebp)
+  805633:	6a 00                	push   $0x0
+  805635:	e8 e3 e8 ff ff       	call   803f1d <sys_page_unmap>
+  80563a:	83 c4 10             	add    $0x10,%esp
+}
+  80563d:	89 d8                	mov    %ebx,%eax
+  80563f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805642:	5b                   	pop    %ebx
+  805643:	5e                   	pop    %esi
+  805644:	5d                   	pop    %ebp
+  805645:	c3                   	ret
+
+00805646 <pipeisclosed>:
+{
+  805646:	55                   	push   %ebp
+  805647:	89 e5                	mov    %esp,%ebp
+  805649:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80564c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80564f:	50                   	push   %eax
+  805650:	ff 75 08             	push   0x8(%ebp)
+  805653:	e8 f2 f1 ff ff       	call   80484a <fd_lookup>
+  805658:	83 c4 10             	add    $0x10,%esp
+  80565b:	85 c0                	test   %eax,%eax
+  80565d:	78 18                	js     805677 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80565f:	83 ec 0c             	sub    $0xc,%esp
+  805662:	ff 75 f4             	push   -0xc(%ebp)
+  805665:	e8 75 f1 ff ff       	call   8047df <fd2data>
+  80566a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80566c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80566f:	e8 a8 fb ff ff       	call   80521c <_pipeisclosed>
+  805674:	83 c4 10             	add    $0x10,%esp
+}
+  805677:	c9                   	leave
+  805678:	c3                   	ret
+
+00805679 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  805679:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  80567b:	8b 15 3c a9 85 00    	mov    0x85a93c,%edx
+  805681:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  805687:	81 c2 34 01 00 00    	add    $0x134,%edx
+  80568d:	39 d0                	cmp    %edx,%eax
+  80568f:	74 2e                	je     8056bf <segment_lookup+0x46>
+{
+  805691:	55                   	push   %ebp
+  805692:	89 e5                	mov    %esp,%ebp
+  805694:	57                   	push   %edi
+  805695:	56                   	push   %esi
+  805696:	53                   	push   %ebx
+  805697:	eb 07                	jmp    8056a0 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  805699:	83 c0 20             	add    $0x20,%eax
+  80569c:	39 d0                	cmp    %edx,%eax
+  80569e:	74 15                	je     8056b5 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  8056a0:	8b 18                	mov    (%eax),%ebx
+  8056a2:	39 d9                	cmp    %ebx,%ecx
+  8056a4:	72 f3                	jb     805699 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  8056a6:	8b 38                	mov    (%eax),%edi
+  8056a8:	8b 58 04             	mov    0x4(%eax),%ebx
+  8056ab:	89 ce                	mov    %ecx,%esi
+  8056ad:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  8056af:	39 de                	cmp    %ebx,%esi
+  8056b1:	73 e6                	jae    805699 <segment_lookup+0x20>
+  8056b3:	eb 05                	jmp    8056ba <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  8056b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056ba:	5b                   	pop    %ebx
+  8056bb:	5e                   	pop    %esi
+  8056bc:	5f                   	pop    %edi
+  8056bd:	5d                   	pop    %ebp
+  8056be:	c3                   	ret
+	return NULL;
+  8056bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056c4:	c3                   	ret
+
+008056c5 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  8056c5:	55                   	push   %ebp
+  8056c6:	89 e5                	mov    %esp,%ebp
+  8056c8:	53                   	push   %ebx
+  8056c9:	83 ec 04             	sub    $0x4,%esp
+  8056cc:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8056ce:	c1 e8 16             	shr    $0x16,%eax
+  8056d1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8056d8:	25 81 00 00 00       	and    $0x81,%eax
+  8056dd:	83 f8 01             	cmp    $0x1,%eax
+  8056e0:	75 6b                	jne    80574d <page_is_clean+0x88>
+  8056e2:	89 da                	mov    %ebx,%edx
+  8056e4:	c1 ea 0c             	shr    $0xc,%edx
+  8056e7:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  8056ee:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8056f3:	f6 c1 01             	test   $0x1,%cl
+  8056f6:	74 5a                	je     805752 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  8056f8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8056ff:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  805705:	75 4b                	jne    805752 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  805707:	89 d8                	mov    %ebx,%eax
+  805709:	e8 6b ff ff ff       	call   805679 <segment_lookup>
+  80570e:	89 c2                	mov    %eax,%edx
+		return 1;
+  805710:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  805715:	85 d2                	test   %edx,%edx
+  805717:	75 39                	jne    805752 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  805719:	8b 15 0c 70 85 00    	mov    0x85700c,%edx
+  80571f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805724:	eb 03                	jmp    805729 <page_is_clean+0x64>
+  805726:	83 c0 01             	add    $0x1,%eax
+  805729:	39 c2                	cmp    %eax,%edx
+  80572b:	7e 19                	jle    805746 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  80572d:	3b 1c c5 20 70 85 00 	cmp    0x857020(,%eax,8),%ebx
+  805734:	72 f0                	jb     805726 <page_is_clean+0x61>
+  805736:	3b 1c c5 24 70 85 00 	cmp    0x857024(,%eax,8),%ebx
+  80573d:	73 e7                	jae    805726 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  80573f:	b8 01 00 00 00       	mov    $0x1,%eax
+  805744:	eb 0c                	jmp    805752 <page_is_clean+0x8d>
+	return 0;
+  805746:	b8 00 00 00 00       	mov    $0x0,%eax
+  80574b:	eb 05                	jmp    805752 <page_is_clean+0x8d>
+		return 0;
+  80574d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805752:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  805755:	c9                   	leave
+  805756:	c3                   	ret
+
+00805757 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  805757:	55                   	push   %ebp
+  805758:	89 e5                	mov    %esp,%ebp
+  80575a:	57                   	push   %edi
+  80575b:	56                   	push   %esi
+  80575c:	53                   	push   %ebx
+  80575d:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  805760:	be 00 00 00 00       	mov    $0x0,%esi
+  805765:	eb 19                	jmp    805780 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  805767:	f7 d3                	not    %ebx
+  805769:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80576f:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  805771:	83 c6 01             	add    $0x1,%esi
+  805774:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  80577a:	0f 87 97 00 00 00    	ja     805817 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  805780:	89 f3                	mov    %esi,%ebx
+  805782:	03 1d 34 40 85 00    	add    0x854034,%ebx
+  805788:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80578e:	89 d8                	mov    %ebx,%eax
+  805790:	c1 e8 0a             	shr    $0xa,%eax
+  805793:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80579a:	25 81 00 00 00       	and    $0x81,%eax
+  80579f:	83 f8 01             	cmp    $0x1,%eax
+  8057a2:	75 c3                	jne    805767 <linear_walk+0x10>
+  8057a4:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8057aa:	77 bb                	ja     805767 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8057ac:	89 df                	mov    %ebx,%edi
+  8057ae:	c1 e7 0c             	shl    $0xc,%edi
+  8057b1:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8057b4:	89 f8                	mov    %edi,%eax
+  8057b6:	e8 0a ff ff ff       	call   8056c5 <page_is_clean>
+  8057bb:	84 c0                	test   %al,%al
+  8057bd:	75 64                	jne    805823 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8057bf:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  8057c5:	77 aa                	ja     805771 <linear_walk+0x1a>
+  8057c7:	81 ff 00 c0 85 00    	cmp    $0x85c000,%edi
+  8057cd:	72 a2                	jb     805771 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8057cf:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8057d6:	a8 01                	test   $0x1,%al
+  8057d8:	74 97                	je     805771 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8057da:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8057e1:	f6 c4 04             	test   $0x4,%ah
+  8057e4:	75 8b                	jne    805771 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8057e6:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8057ed:	f6 c4 02             	test   $0x2,%ah
+  8057f0:	0f 85 7b ff ff ff    	jne    805771 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8057f6:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8057fd:	c1 e8 0c             	shr    $0xc,%eax
+  805800:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  805803:	05 00 00 00 ef       	add    $0xef000000,%eax
+  805808:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80580c:	66 83 f8 01          	cmp    $0x1,%ax
+  805810:	76 11                	jbe    805823 <linear_walk+0xcc>
+  805812:	e9 5a ff ff ff       	jmp    805771 <linear_walk+0x1a>
+  805817:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  80581c:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  805823:	89 1d 34 40 85 00    	mov    %ebx,0x854034
+}
+  805829:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80582c:	83 c4 1c             	add    $0x1c,%esp
+  80582f:	5b                   	pop    %ebx
+  805830:	5e                   	pop    %esi
+  805831:	5f                   	pop    %edi
+  805832:	5d                   	pop    %ebp
+  805833:	c3                   	ret
+
+00805834 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  805834:	55                   	push   %ebp
+  805835:	89 e5                	mov    %esp,%ebp
+  805837:	56                   	push   %esi
+  805838:	53                   	push   %ebx
+  805839:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  80583b:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  805840:	83 e0 7f             	and    $0x7f,%eax
+  805843:	c1 e0 04             	shl    $0x4,%eax
+  805846:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  80584c:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  805852:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  805858:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  80585e:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  805863:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  805866:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80586b:	83 c0 01             	add    $0x1,%eax
+  80586e:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  805873:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  805876:	5b                   	pop    %ebx
+  805877:	5e                   	pop    %esi
+  805878:	5d                   	pop    %ebp
+  805879:	c3                   	ret
+
+0080587a <page_ring_enter>:
+{
+  80587a:	55                   	push   %ebp
+  80587b:	89 e5                	mov    %esp,%ebp
+  80587d:	57                   	push   %edi
+  80587e:	56                   	push   %esi
+  80587f:	53                   	push   %ebx
+  805880:	83 ec 18             	sub    $0x18,%esp
+  805883:	89 c6                	mov    %eax,%esi
+  805885:	89 d7                	mov    %edx,%edi
+  805887:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  805889:	6a 00                	push   $0x0
+  80588b:	6a 00                	push   $0x0
+  80588d:	6a 00                	push   $0x0
+  80588f:	6a 07                	push   $0x7
+  805891:	ff 35 40 70 85 00    	push   0x857040
+  805897:	e8 1d ee ff ff       	call   8046b9 <ipc_call>
+  80589c:	83 c4 20             	add    $0x20,%esp
+  80589f:	85 c0                	test   %eax,%eax
+  8058a1:	79 22                	jns    8058c5 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  8058a3:	50                   	push   %eax
+  8058a4:	68 85 87 80 00       	push   $0x808785
+  8058a9:	68 13 02 00 00       	push   $0x213
+  8058ae:	68 99 87 80 00       	push   $0x808799
+  8058b3:	e8 2b da ff ff       	call   8032e3 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  8058b8:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8058bd:	83 c0 01             	add    $0x1,%eax
+  8058c0:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  8058c5:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  8058cb:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  8058d0:	39 c2                	cmp    %eax,%edx
+  8058d2:	74 24                	je     8058f8 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  8058d4:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8058d9:	83 e0 7f             	and    $0x7f,%eax
+  8058dc:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  8058e3:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  8058ea:	29 f0                	sub    %esi,%eax
+  8058ec:	39 d8                	cmp    %ebx,%eax
+  8058ee:	73 c8                	jae    8058b8 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  8058f0:	8b 52 04             	mov    0x4(%edx),%edx
+  8058f3:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  8058f6:	eb c0                	jmp    8058b8 <page_ring_enter+0x3e>
+}
+  8058f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8058fb:	5b                   	pop    %ebx
+  8058fc:	5e                   	pop    %esi
+  8058fd:	5f                   	pop    %edi
+  8058fe:	5d                   	pop    %ebp
+  8058ff:	c3                   	ret
+
+00805900 <page_ring_reserve>:
+{
+  805900:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  805902:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  805907:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  80590d:	29 d0                	sub    %edx,%eax
+  80590f:	ba 80 00 00 00       	mov    $0x80,%edx
+  805914:	29 ca                	sub    %ecx,%edx
+  805916:	39 c2                	cmp    %eax,%edx
+  805918:	72 01                	jb     80591b <page_ring_reserve+0x1b>
+  80591a:	c3                   	ret
+{
+  80591b:	55                   	push   %ebp
+  80591c:	89 e5                	mov    %esp,%ebp
+  80591e:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  805921:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805926:	ba 00 00 00 00       	mov    $0x0,%edx
+  80592b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805930:	e8 45 ff ff ff       	call   80587a <page_ring_enter>
+}
+  805935:	c9                   	leave
+  805936:	c3                   	ret
+
+00805937 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  805937:	55                   	push   %ebp
+  805938:	89 e5                	mov    %esp,%ebp
+  80593a:	53                   	push   %ebx
+  80593b:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  80593e:	6a 07                	push   $0x7
+  805940:	6a 01                	push   $0x1
+  805942:	89 c3                	mov    %eax,%ebx
+  805944:	c1 e3 0c             	shl    $0xc,%ebx
+  805947:	8d 93 00 50 85 00    	lea    0x855000(%ebx),%edx
+  80594d:	52                   	push   %edx
+  80594e:	6a 04                	push   $0x4
+  805950:	ff 34 85 44 70 85 00 	push   0x857044(,%eax,4)
+  805957:	e8 5d ed ff ff       	call   8046b9 <ipc_call>
+	sharereqs[i].nslots = 0;
+  80595c:	c7 83 00 50 85 00 00 	movl   $0x0,0x855000(%ebx)
+  805963:	00 00 00 
+	return r;
+}
+  805966:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  805969:	c9                   	leave
+  80596a:	c3                   	ret
+
+0080596b <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  80596b:	55                   	push   %ebp
+  80596c:	89 e5                	mov    %esp,%ebp
+  80596e:	56                   	push   %esi
+  80596f:	53                   	push   %ebx
+  805970:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  805972:	c1 e8 10             	shr    $0x10,%eax
+  805975:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  805978:	89 c2                	mov    %eax,%edx
+  80597a:	c1 e2 0c             	shl    $0xc,%edx
+  80597d:	8b b2 00 50 85 00    	mov    0x855000(%edx),%esi
+  805983:	8d 5e 01             	lea    0x1(%esi),%ebx
+  805986:	89 9a 00 50 85 00    	mov    %ebx,0x855000(%edx)
+  80598c:	89 c2                	mov    %eax,%edx
+  80598e:	c1 e2 0a             	shl    $0xa,%edx
+  805991:	01 f2                	add    %esi,%edx
+  805993:	89 0c 95 04 50 85 00 	mov    %ecx,0x855004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  80599a:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  8059a0:	74 09                	je     8059ab <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  8059a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8059a7:	5b                   	pop    %ebx
+  8059a8:	5e                   	pop    %esi
+  8059a9:	5d                   	pop    %ebp
+  8059aa:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  8059ab:	e8 87 ff ff ff       	call   805937 <page_share_send>
+  8059b0:	eb f5                	jmp    8059a7 <page_share_slot+0x3c>
+
+008059b2 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  8059b2:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  8059b7:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  8059ba:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  8059bf:	3b 15 00 70 85 00    	cmp    0x857000,%edx
+  8059c5:	74 09                	je     8059d0 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  8059c7:	a1 40 70 85 00       	mov    0x857040,%eax
+  8059cc:	85 c0                	test   %eax,%eax
+  8059ce:	75 01                	jne    8059d1 <page_ring_ready+0x1f>
+}
+  8059d0:	c3                   	ret
+{
+  8059d1:	55                   	push   %ebp
+  8059d2:	89 e5                	mov    %esp,%ebp
+  8059d4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  8059d7:	68 07 06 00 00       	push   $0x607
+  8059dc:	6a 08                	push   $0x8
+  8059de:	68 00 30 ad de       	push   $0xdead3000
+  8059e3:	6a 00                	push   $0x0
+  8059e5:	e8 d9 e5 ff ff       	call   803fc3 <sys_page_alloc_range>
+  8059ea:	83 c4 10             	add    $0x10,%esp
+  8059ed:	83 f8 08             	cmp    $0x8,%eax
+  8059f0:	74 1b                	je     805a0d <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  8059f2:	83 ec 04             	sub    $0x4,%esp
+  8059f5:	6a 08                	push   $0x8
+  8059f7:	68 00 30 ad de       	push   $0xdead3000
+  8059fc:	6a 00                	push   $0x0
+  8059fe:	e8 2e e6 ff ff       	call   804031 <sys_page_unmap_range>
+		return 0;
+  805a03:	83 c4 10             	add    $0x10,%esp
+  805a06:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805a0b:	c9                   	leave
+  805a0c:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  805a0d:	83 ec 0c             	sub    $0xc,%esp
+  805a10:	68 07 04 00 00       	push   $0x407
+  805a15:	6a 08                	push   $0x8
+  805a17:	68 00 30 ad de       	push   $0xdead3000
+  805a1c:	6a 06                	push   $0x6
+  805a1e:	ff 35 40 70 85 00    	push   0x857040
+  805a24:	e8 90 ec ff ff       	call   8046b9 <ipc_call>
+  805a29:	83 c4 20             	add    $0x20,%esp
+  805a2c:	85 c0                	test   %eax,%eax
+  805a2e:	78 14                	js     805a44 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  805a30:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  805a35:	8b 40 48             	mov    0x48(%eax),%eax
+  805a38:	a3 00 70 85 00       	mov    %eax,0x857000
+	return 1;
+  805a3d:	b8 01 00 00 00       	mov    $0x1,%eax
+  805a42:	eb c7                	jmp    805a0b <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  805a44:	83 ec 04             	sub    $0x4,%esp
+  805a47:	6a 08                	push   $0x8
+  805a49:	68 00 30 ad de       	push   $0xdead3000
+  805a4e:	6a 00                	push   $0x0
+  805a50:	e8 dc e5 ff ff       	call   804031 <sys_page_unmap_range>
+		return 0;
+  805a55:	83 c4 10             	add    $0x10,%esp
+  805a58:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a5d:	eb ac                	jmp    805a0b <page_ring_ready+0x59>
+
+00805a5f <page_remove_slot>:
+{
+  805a5f:	55                   	push   %ebp
+  805a60:	89 e5                	mov    %esp,%ebp
+  805a62:	56                   	push   %esi
+  805a63:	53                   	push   %ebx
+  805a64:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  805a66:	89 c6                	mov    %eax,%esi
+  805a68:	c1 ee 10             	shr    $0x10,%esi
+  805a6b:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  805a6e:	8b 04 b5 44 70 85 00 	mov    0x857044(,%esi,4),%eax
+  805a75:	39 05 40 70 85 00    	cmp    %eax,0x857040
+  805a7b:	74 2a                	je     805aa7 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  805a7d:	83 ec 0c             	sub    $0xc,%esp
+  805a80:	6a 00                	push   $0x0
+  805a82:	6a 00                	push   $0x0
+  805a84:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  805a86:	c1 e3 04             	shl    $0x4,%ebx
+  805a89:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  805a8c:	53                   	push   %ebx
+  805a8d:	ff 34 b5 44 70 85 00 	push   0x857044(,%esi,4)
+  805a94:	e8 20 ec ff ff       	call   8046b9 <ipc_call>
+  805a99:	83 c4 20             	add    $0x20,%esp
+  805a9c:	85 c0                	test   %eax,%eax
+  805a9e:	78 2d                	js     805acd <page_remove_slot+0x6e>
+}
+  805aa0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805aa3:	5b                   	pop    %ebx
+  805aa4:	5e                   	pop    %esi
+  805aa5:	5d                   	pop    %ebp
+  805aa6:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  805aa7:	e8 06 ff ff ff       	call   8059b2 <page_ring_ready>
+  805aac:	85 c0                	test   %eax,%eax
+  805aae:	74 cd                	je     805a7d <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  805ab0:	b8 01 00 00 00       	mov    $0x1,%eax
+  805ab5:	e8 46 fe ff ff       	call   805900 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  805aba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805abf:	89 da                	mov    %ebx,%edx
+  805ac1:	b8 02 00 00 00       	mov    $0x2,%eax
+  805ac6:	e8 69 fd ff ff       	call   805834 <page_ring_post>
+		return;
+  805acb:	eb d3                	jmp    805aa0 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  805acd:	50                   	push   %eax
+  805ace:	68 f4 87 80 00       	push   $0x8087f4
+  805ad3:	68 ac 03 00 00       	push   $0x3ac
+  805ad8:	68 99 87 80 00       	push   $0x808799
+  805add:	e8 01 d8 ff ff       	call   8032e3 <_panic>
+
+00805ae2 <find_paging_env>:
+	if(pagingenv)
+  805ae2:	a1 40 70 85 00       	mov    0x857040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  805ae7:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  805ae9:	85 c0                	test   %eax,%eax
+  805aeb:	74 05                	je     805af2 <find_paging_env+0x10>
+  805aed:	eb 56                	jmp    805b45 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  805aef:	83 c0 01             	add    $0x1,%eax
+  805af2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  805af7:	7f 47                	jg     805b40 <find_paging_env+0x5e>
+  805af9:	83 f9 01             	cmp    $0x1,%ecx
+  805afc:	7f 42                	jg     805b40 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  805afe:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  805b01:	c1 e2 06             	shl    $0x6,%edx
+  805b04:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  805b0a:	8b 52 50             	mov    0x50(%edx),%edx
+  805b0d:	83 fa 02             	cmp    $0x2,%edx
+  805b10:	75 dd                	jne    805aef <find_paging_env+0xd>
+  805b12:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  805b15:	c1 e2 06             	shl    $0x6,%edx
+  805b18:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  805b1e:	8b 52 54             	mov    0x54(%edx),%edx
+  805b21:	85 d2                	test   %edx,%edx
+  805b23:	74 ca                	je     805aef <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  805b25:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  805b28:	c1 e2 06             	shl    $0x6,%edx
+  805b2b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  805b31:	8b 52 48             	mov    0x48(%edx),%edx
+  805b34:	89 14 8d 44 70 85 00 	mov    %edx,0x857044(,%ecx,4)
+  805b3b:	8d 49 01             	lea    0x1(%ecx),%ecx
+  805b3e:	eb af                	jmp    805aef <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  805b40:	83 f9 02             	cmp    $0x2,%ecx
+  805b43:	74 01                	je     805b46 <find_paging_env+0x64>
+}
+  805b45:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  805b46:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  805b4b:	8b 40 48             	mov    0x48(%eax),%eax
+  805b4e:	83 e0 01             	and    $0x1,%eax
+  805b51:	8b 04 85 44 70 85 00 	mov    0x857044(,%eax,4),%eax
+  805b58:	a3 40 70 85 00       	mov    %eax,0x857040
+  805b5d:	eb e6                	jmp    805b45 <find_paging_env+0x63>
+
+00805b5f <page_add_backed>:
+{
+  805b5f:	55                   	push   %ebp
+  805b60:	89 e5                	mov    %esp,%ebp
+  805b62:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  805b65:	a1 0c 70 85 00       	mov    0x85700c,%eax
+  805b6a:	83 f8 04             	cmp    $0x4,%eax
+  805b6d:	74 35                	je     805ba4 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  805b6f:	89 d1                	mov    %edx,%ecx
+  805b71:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  805b77:	89 0c c5 20 70 85 00 	mov    %ecx,0x857020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  805b7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  805b81:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  805b88:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  805b8e:	89 14 c5 24 70 85 00 	mov    %edx,0x857024(,%eax,8)
+	num_backed_ranges++;
+  805b95:	83 c0 01             	add    $0x1,%eax
+  805b98:	a3 0c 70 85 00       	mov    %eax,0x85700c
+	return 0;
+  805b9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805ba2:	5d                   	pop    %ebp
+  805ba3:	c3                   	ret
+		return -E_NO_MEM;
+  805ba4:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  805ba9:	eb f7                	jmp    805ba2 <page_add_backed+0x43>
+
+00805bab <percentage_of_pgdir_to_walk>:
+{
+  805bab:	55                   	push   %ebp
+  805bac:	89 e5                	mov    %esp,%ebp
+  805bae:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  805bb1:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  805bb5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  805bb8:	db 45 fc             	fildl  -0x4(%ebp)
+  805bbb:	d8 35 80 8c 80 00    	fdivs  0x808c80
+	return ret*ret;
+  805bc1:	d8 c8                	fmul   %st(0),%st
+}
+  805bc3:	c9                   	leave
+  805bc4:	c3                   	ret
+
+00805bc5 <nfu_with_aging_page_choice_func>:
+{
+  805bc5:	55                   	push   %ebp
+  805bc6:	89 e5                	mov    %esp,%ebp
+  805bc8:	57                   	push   %edi
+  805bc9:	56                   	push   %esi
+  805bca:	53                   	push   %ebx
+  805bcb:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  805bce:	8b 35 30 40 85 00    	mov    0x854030,%esi
+	float pct_to_walk = 1.0f;
+  805bd4:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  805bd6:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  805bdb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805be0:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  805be7:	ba 00 00 00 00       	mov    $0x0,%edx
+  805bec:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  805bef:	eb 18                	jmp    805c09 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  805bf1:	f7 d0                	not    %eax
+  805bf3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805bf8:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  805bfa:	83 c2 01             	add    $0x1,%edx
+  805bfd:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  805c03:	0f 87 13 01 00 00    	ja     805d1c <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  805c09:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  805c0d:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  805c10:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  805c15:	89 c1                	mov    %eax,%ecx
+  805c17:	c1 e9 0a             	shr    $0xa,%ecx
+  805c1a:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  805c21:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  805c27:	83 f9 01             	cmp    $0x1,%ecx
+  805c2a:	75 c5                	jne    805bf1 <nfu_with_aging_page_choice_func+0x2c>
+  805c2c:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  805c31:	77 be                	ja     805bf1 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  805c33:	89 c1                	mov    %eax,%ecx
+  805c35:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  805c38:	81 f9 00 c0 85 00    	cmp    $0x85c000,%ecx
+  805c3e:	0f 82 a5 00 00 00    	jb     805ce9 <nfu_with_aging_page_choice_func+0x124>
+  805c44:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  805c4a:	0f 87 99 00 00 00    	ja     805ce9 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  805c50:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  805c57:	f6 c1 01             	test   $0x1,%cl
+  805c5a:	0f 84 89 00 00 00    	je     805ce9 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  805c60:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  805c67:	f6 c5 04             	test   $0x4,%ch
+  805c6a:	75 7d                	jne    805ce9 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  805c6c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  805c73:	f6 c5 02             	test   $0x2,%ch
+  805c76:	75 71                	jne    805ce9 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  805c78:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  805c7f:	c1 e9 0c             	shr    $0xc,%ecx
+  805c82:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  805c85:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  805c8b:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  805c8f:	66 83 f9 01          	cmp    $0x1,%cx
+  805c93:	77 54                	ja     805ce9 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  805c95:	89 f9                	mov    %edi,%ecx
+  805c97:	80 f9 ff             	cmp    $0xff,%cl
+  805c9a:	74 21                	je     805cbd <nfu_with_aging_page_choice_func+0xf8>
+  805c9c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  805ca3:	c1 e9 0c             	shr    $0xc,%ecx
+  805ca6:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  805ca9:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  805caf:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  805cb3:	89 fb                	mov    %edi,%ebx
+  805cb5:	38 d9                	cmp    %bl,%cl
+  805cb7:	73 30                	jae    805ce9 <nfu_with_aging_page_choice_func+0x124>
+  805cb9:	dd d8                	fstp   %st(0)
+  805cbb:	eb 02                	jmp    805cbf <nfu_with_aging_page_choice_func+0xfa>
+  805cbd:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  805cbf:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  805cc6:	c1 e9 0c             	shr    $0xc,%ecx
+  805cc9:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  805ccc:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  805cd3:	89 fb                	mov    %edi,%ebx
+  805cd5:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  805cd8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  805cdb:	db 45 e0             	fildl  -0x20(%ebp)
+  805cde:	d8 35 80 8c 80 00    	fdivs  0x808c80
+	return ret*ret;
+  805ce4:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  805ce6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  805ce9:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  805cec:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  805cef:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  805cf6:	df 6d e0             	fildll -0x20(%ebp)
+  805cf9:	d9 c1                	fld    %st(1)
+  805cfb:	d8 0d 84 8c 80 00    	fmuls  0x808c84
+  805d01:	d9 c9                	fxch   %st(1)
+  805d03:	df f1                	fcomip %st(1),%st
+  805d05:	dd d8                	fstp   %st(0)
+  805d07:	0f 82 ed fe ff ff    	jb     805bfa <nfu_with_aging_page_choice_func+0x35>
+  805d0d:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  805d0f:	a3 30 40 85 00       	mov    %eax,0x854030
+			return (void*)(pgnum_opt*PGSIZE);
+  805d14:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  805d17:	c1 e0 0c             	shl    $0xc,%eax
+  805d1a:	eb 0e                	jmp    805d2a <nfu_with_aging_page_choice_func+0x165>
+  805d1c:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  805d1e:	89 f8                	mov    %edi,%eax
+  805d20:	3c ff                	cmp    $0xff,%al
+  805d22:	74 0e                	je     805d32 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  805d24:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  805d27:	c1 e0 0c             	shl    $0xc,%eax
+}
+  805d2a:	83 c4 14             	add    $0x14,%esp
+  805d2d:	5b                   	pop    %ebx
+  805d2e:	5e                   	pop    %esi
+  805d2f:	5f                   	pop    %edi
+  805d30:	5d                   	pop    %ebp
+  805d31:	c3                   	ret
+	pgnum = 0;
+  805d32:	c7 05 30 40 85 00 00 	movl   $0x0,0x854030
+  805d39:	00 00 00 
+	return (void*)UTOP;
+  805d3c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  805d41:	eb e7                	jmp    805d2a <nfu_with_aging_page_choice_func+0x165>
+
+00805d43 <myRand>:
+    state = state * 1664525 + 1013904223;
+  805d43:	69 05 a0 00 81 00 0d 	imul   $0x19660d,0x8100a0,%eax
+  805d4a:	66 19 00 
+  805d4d:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  805d52:	a3 a0 00 81 00       	mov    %eax,0x8100a0
+    return state >> 24;
+  805d57:	c1 e8 18             	shr    $0x18,%eax
+}
+  805d5a:	c3                   	ret
+
+00805d5b <random_page_choice_func>:
+{
+  805d5b:	55                   	push   %ebp
+  805d5c:	89 e5                	mov    %esp,%ebp
+  805d5e:	57                   	push   %edi
+  805d5f:	56                   	push   %esi
+  805d60:	53                   	push   %ebx
+  805d61:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  805d64:	be 00 00 00 00       	mov    $0x0,%esi
+  805d69:	eb 19                	jmp    805d84 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  805d6b:	f7 d3                	not    %ebx
+  805d6d:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  805d73:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  805d75:	83 c6 01             	add    $0x1,%esi
+  805d78:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  805d7e:	0f 87 a0 00 00 00    	ja     805e24 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  805d84:	89 f3                	mov    %esi,%ebx
+  805d86:	03 1d 2c 40 85 00    	add    0x85402c,%ebx
+  805d8c:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  805d92:	89 d8                	mov    %ebx,%eax
+  805d94:	c1 e8 0a             	shr    $0xa,%eax
+  805d97:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  805d9e:	25 81 00 00 00       	and    $0x81,%eax
+  805da3:	83 f8 01             	cmp    $0x1,%eax
+  805da6:	75 c3                	jne    805d6b <random_page_choice_func+0x10>
+  805da8:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  805dae:	77 bb                	ja     805d6b <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  805db0:	89 df                	mov    %ebx,%edi
+  805db2:	c1 e7 0c             	shl    $0xc,%edi
+  805db5:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  805db8:	89 f8                	mov    %edi,%eax
+  805dba:	e8 06 f9 ff ff       	call   8056c5 <page_is_clean>
+  805dbf:	84 c0                	test   %al,%al
+  805dc1:	0f 85 82 00 00 00    	jne    805e49 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  805dc7:	81 ff 00 c0 85 00    	cmp    $0x85c000,%edi
+  805dcd:	72 a6                	jb     805d75 <random_page_choice_func+0x1a>
+  805dcf:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  805dd5:	77 9e                	ja     805d75 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  805dd7:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  805dde:	a8 01                	test   $0x1,%al
+  805de0:	74 93                	je     805d75 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  805de2:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  805de9:	f6 c4 04             	test   $0x4,%ah
+  805dec:	75 87                	jne    805d75 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  805dee:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  805df5:	f6 c4 02             	test   $0x2,%ah
+  805df8:	0f 85 77 ff ff ff    	jne    805d75 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  805dfe:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  805e05:	c1 e8 0c             	shr    $0xc,%eax
+  805e08:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  805e0b:	05 00 00 00 ef       	add    $0xef000000,%eax
+  805e10:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  805e14:	66 83 f8 01          	cmp    $0x1,%ax
+  805e18:	0f 87 57 ff ff ff    	ja     805d75 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  805e1e:	89 1d 2c 40 85 00    	mov    %ebx,0x85402c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  805e24:	e8 1a ff ff ff       	call   805d43 <myRand>
+  805e29:	8b 3d 2c 40 85 00    	mov    0x85402c,%edi
+  805e2f:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  805e34:	29 fe                	sub    %edi,%esi
+  805e36:	0f be c0             	movsbl %al,%eax
+  805e39:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e3e:	f7 f6                	div    %esi
+  805e40:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  805e42:	bb 15 00 00 00       	mov    $0x15,%ebx
+  805e47:	eb 1c                	jmp    805e65 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  805e49:	89 1d 2c 40 85 00    	mov    %ebx,0x85402c
+			return (void*)(pgnum*PGSIZE);
+  805e4f:	e9 8f 00 00 00       	jmp    805ee3 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  805e54:	e8 ea fe ff ff       	call   805d43 <myRand>
+  805e59:	0f be c0             	movsbl %al,%eax
+  805e5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e61:	f7 f6                	div    %esi
+  805e63:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  805e65:	83 eb 01             	sub    $0x1,%ebx
+  805e68:	0f 84 c2 00 00 00    	je     805f30 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  805e6e:	89 d0                	mov    %edx,%eax
+  805e70:	c1 e8 0a             	shr    $0xa,%eax
+  805e73:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  805e7a:	25 81 00 00 00       	and    $0x81,%eax
+  805e7f:	83 f8 01             	cmp    $0x1,%eax
+  805e82:	75 d0                	jne    805e54 <random_page_choice_func+0xf9>
+  805e84:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  805e8a:	77 c8                	ja     805e54 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  805e8c:	89 d0                	mov    %edx,%eax
+  805e8e:	c1 e0 0c             	shl    $0xc,%eax
+  805e91:	3d 00 c0 85 00       	cmp    $0x85c000,%eax
+  805e96:	72 56                	jb     805eee <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  805e98:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  805e9d:	77 65                	ja     805f04 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  805e9f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  805ea6:	f6 c1 01             	test   $0x1,%cl
+  805ea9:	74 59                	je     805f04 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  805eab:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  805eb2:	f6 c5 04             	test   $0x4,%ch
+  805eb5:	75 4d                	jne    805f04 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  805eb7:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  805ebe:	f6 c5 02             	test   $0x2,%ch
+  805ec1:	75 41                	jne    805f04 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  805ec3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  805eca:	c1 ea 0c             	shr    $0xc,%edx
+  805ecd:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  805ed0:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  805ed6:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  805eda:	66 83 fa 01          	cmp    $0x1,%dx
+  805ede:	77 3a                	ja     805f1a <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  805ee0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  805ee3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  805ee6:	83 c4 1c             	add    $0x1c,%esp
+  805ee9:	5b                   	pop    %ebx
+  805eea:	5e                   	pop    %esi
+  805eeb:	5f                   	pop    %edi
+  805eec:	5d                   	pop    %ebp
+  805eed:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  805eee:	e8 50 fe ff ff       	call   805d43 <myRand>
+  805ef3:	0f be c0             	movsbl %al,%eax
+  805ef6:	ba 00 00 00 00       	mov    $0x0,%edx
+  805efb:	f7 f6                	div    %esi
+  805efd:	01 fa                	add    %edi,%edx
+			continue;
+  805eff:	e9 61 ff ff ff       	jmp    805e65 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  805f04:	e8 3a fe ff ff       	call   805d43 <myRand>
+  805f09:	0f be c0             	movsbl %al,%eax
+  805f0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805f11:	f7 f6                	div    %esi
+  805f13:	01 fa                	add    %edi,%edx
+			continue;
+  805f15:	e9 4b ff ff ff       	jmp    805e65 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  805f1a:	e8 24 fe ff ff       	call   805d43 <myRand>
+  805f1f:	0f be c0             	movsbl %al,%eax
+  805f22:	ba 00 00 00 00       	mov    $0x0,%edx
+  805f27:	f7 f6                	div    %esi
+  805f29:	01 fa                	add    %edi,%edx
+			continue;
+  805f2b:	e9 35 ff ff ff       	jmp    805e65 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  805f30:	c7 05 2c 40 85 00 00 	movl   $0x0,0x85402c
+  805f37:	00 00 00 
+	return (void*)UTOP;
+  805f3a:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  805f41:	eb a0                	jmp    805ee3 <random_page_choice_func+0x188>
+
+00805f43 <nfu>:
+{
+  805f43:	55                   	push   %ebp
+  805f44:	89 e5                	mov    %esp,%ebp
+  805f46:	57                   	push   %edi
+  805f47:	56                   	push   %esi
+  805f48:	53                   	push   %ebx
+  805f49:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  805f4c:	8b 35 28 40 85 00    	mov    0x854028,%esi
+	float pct_to_walk = 1.0f;
+  805f52:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  805f54:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  805f59:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805f5e:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  805f65:	ba 00 00 00 00       	mov    $0x0,%edx
+  805f6a:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  805f6d:	eb 18                	jmp    805f87 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  805f6f:	f7 d0                	not    %eax
+  805f71:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805f76:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  805f78:	83 c2 01             	add    $0x1,%edx
+  805f7b:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  805f81:	0f 87 13 01 00 00    	ja     80609a <nfu+0x157>
+		++num_searched_ptes;
+  805f87:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  805f8b:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  805f8e:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  805f93:	89 c1                	mov    %eax,%ecx
+  805f95:	c1 e9 0a             	shr    $0xa,%ecx
+  805f98:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  805f9f:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  805fa5:	83 f9 01             	cmp    $0x1,%ecx
+  805fa8:	75 c5                	jne    805f6f <nfu+0x2c>
+  805faa:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  805faf:	77 be                	ja     805f6f <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  805fb1:	89 c1                	mov    %eax,%ecx
+  805fb3:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  805fb6:	81 f9 00 c0 85 00    	cmp    $0x85c000,%ecx
+  805fbc:	0f 82 a5 00 00 00    	jb     806067 <nfu+0x124>
+  805fc2:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  805fc8:	0f 87 99 00 00 00    	ja     806067 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  805fce:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  805fd5:	f6 c1 01             	test   $0x1,%cl
+  805fd8:	0f 84 89 00 00 00    	je     806067 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  805fde:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  805fe5:	f6 c5 04             	test   $0x4,%ch
+  805fe8:	75 7d                	jne    806067 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  805fea:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  805ff1:	f6 c5 02             	test   $0x2,%ch
+  805ff4:	75 71                	jne    806067 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  805ff6:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  805ffd:	c1 e9 0c             	shr    $0xc,%ecx
+  806000:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  806003:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  806009:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  80600d:	66 83 f9 01          	cmp    $0x1,%cx
+  806011:	77 54                	ja     806067 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  806013:	89 f9                	mov    %edi,%ecx
+  806015:	80 f9 ff             	cmp    $0xff,%cl
+  806018:	74 21                	je     80603b <nfu+0xf8>
+  80601a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  806021:	c1 e9 0c             	shr    $0xc,%ecx
+  806024:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  806027:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80602d:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  806031:	89 fb                	mov    %edi,%ebx
+  806033:	38 d9                	cmp    %bl,%cl
+  806035:	73 30                	jae    806067 <nfu+0x124>
+  806037:	dd d8                	fstp   %st(0)
+  806039:	eb 02                	jmp    80603d <nfu+0xfa>
+  80603b:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  80603d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  806044:	c1 e9 0c             	shr    $0xc,%ecx
+  806047:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80604a:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  806051:	89 fb                	mov    %edi,%ebx
+  806053:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  806056:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  806059:	db 45 e0             	fildl  -0x20(%ebp)
+  80605c:	d8 35 80 8c 80 00    	fdivs  0x808c80
+	return ret*ret;
+  806062:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  806064:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  806067:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80606a:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80606d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  806074:	df 6d e0             	fildll -0x20(%ebp)
+  806077:	d9 c1                	fld    %st(1)
+  806079:	d8 0d 84 8c 80 00    	fmuls  0x808c84
+  80607f:	d9 c9                	fxch   %st(1)
+  806081:	df f1                	fcomip %st(1),%st
+  806083:	dd d8                	fstp   %st(0)
+  806085:	0f 82 ed fe ff ff    	jb     805f78 <nfu+0x35>
+  80608b:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  80608d:	a3 28 40 85 00       	mov    %eax,0x854028
+			return (void*)(pgnum_opt*PGSIZE);
+  806092:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  806095:	c1 e0 0c             	shl    $0xc,%eax
+  806098:	eb 0e                	jmp    8060a8 <nfu+0x165>
+  80609a:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  80609c:	89 f8                	mov    %edi,%eax
+  80609e:	3c ff                	cmp    $0xff,%al
+  8060a0:	74 0e                	je     8060b0 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  8060a2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8060a5:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8060a8:	83 c4 14             	add    $0x14,%esp
+  8060ab:	5b                   	pop    %ebx
+  8060ac:	5e                   	pop    %esi
+  8060ad:	5f                   	pop    %edi
+  8060ae:	5d                   	pop    %ebp
+  8060af:	c3                   	ret
+	pgnum = 0;
+  8060b0:	c7 05 28 40 85 00 00 	movl   $0x0,0x854028
+  8060b7:	00 00 00 
+	return (void*)UTOP;
+  8060ba:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8060bf:	eb e7                	jmp    8060a8 <nfu+0x165>
+
+008060c1 <lru>:
+{
+  8060c1:	55                   	push   %ebp
+  8060c2:	89 e5                	mov    %esp,%ebp
+  8060c4:	57                   	push   %edi
+  8060c5:	56                   	push   %esi
+  8060c6:	53                   	push   %ebx
+  8060c7:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8060ca:	8b 3d 24 40 85 00    	mov    0x854024,%edi
+	long long time_min = 9223372036854775807;
+  8060d0:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  8060d7:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8060de:	be 00 00 00 00       	mov    $0x0,%esi
+  8060e3:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8060ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8060ef:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  8060f2:	eb 18                	jmp    80610c <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8060f4:	f7 d0                	not    %eax
+  8060f6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8060fb:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8060fd:	83 c2 01             	add    $0x1,%edx
+  806100:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  806106:	0f 87 fa 00 00 00    	ja     806206 <lru+0x145>
+		++num_searched_ptes;
+  80610c:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80610f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  806112:	01 d0                	add    %edx,%eax
+  806114:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  806119:	89 c1                	mov    %eax,%ecx
+  80611b:	c1 e9 0a             	shr    $0xa,%ecx
+  80611e:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  806125:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  80612b:	83 f9 01             	cmp    $0x1,%ecx
+  80612e:	75 c4                	jne    8060f4 <lru+0x33>
+  806130:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  806135:	77 bd                	ja     8060f4 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  806137:	89 c1                	mov    %eax,%ecx
+  806139:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80613c:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  806142:	0f 87 92 00 00 00    	ja     8061da <lru+0x119>
+  806148:	81 f9 00 c0 85 00    	cmp    $0x85c000,%ecx
+  80614e:	0f 82 86 00 00 00    	jb     8061da <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  806154:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80615b:	f6 c1 01             	test   $0x1,%cl
+  80615e:	74 7a                	je     8061da <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  806160:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  806167:	f6 c5 04             	test   $0x4,%ch
+  80616a:	75 6e                	jne    8061da <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80616c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  806173:	f6 c5 02             	test   $0x2,%ch
+  806176:	75 62                	jne    8061da <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  806178:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80617f:	c1 e9 0c             	shr    $0xc,%ecx
+  806182:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  806185:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80618b:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  80618f:	66 83 f9 01          	cmp    $0x1,%cx
+  806193:	77 45                	ja     8061da <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  806195:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80619c:	c1 e9 0c             	shr    $0xc,%ecx
+  80619f:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8061a2:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8061a8:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8061ab:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8061ae:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  8061b1:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8061b4:	19 df                	sbb    %ebx,%edi
+  8061b6:	7c 22                	jl     8061da <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  8061b8:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8061bf:	c1 e9 0c             	shr    $0xc,%ecx
+  8061c2:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8061c5:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8061cb:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8061ce:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8061d1:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8061d4:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8061d7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8061da:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8061dd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8061e4:	df 6d e0             	fildll -0x20(%ebp)
+  8061e7:	d9 05 84 8c 80 00    	flds   0x808c84
+  8061ed:	d9 c9                	fxch   %st(1)
+  8061ef:	df f1                	fcomip %st(1),%st
+  8061f1:	dd d8                	fstp   %st(0)
+  8061f3:	0f 82 04 ff ff ff    	jb     8060fd <lru+0x3c>
+			pgnum = pgnum_actual;
+  8061f9:	a3 24 40 85 00       	mov    %eax,0x854024
+			return (void*)(pgnum_opt*PGSIZE);
+  8061fe:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  806201:	c1 e0 0c             	shl    $0xc,%eax
+  806204:	eb 06                	jmp    80620c <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  806206:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  806209:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80620c:	83 c4 1c             	add    $0x1c,%esp
+  80620f:	5b                   	pop    %ebx
+  806210:	5e                   	pop    %esi
+  806211:	5f                   	pop    %edi
+  806212:	5d                   	pop    %ebp
+  806213:	c3                   	ret
+
+00806214 <set_page_choice_func>:
+{
+  806214:	55                   	push   %ebp
+  806215:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  806217:	8b 45 08             	mov    0x8(%ebp),%eax
+  80621a:	a3 9c 00 81 00       	mov    %eax,0x81009c
+}
+  80621f:	5d                   	pop    %ebp
+  806220:	c3                   	ret
+
+00806221 <get_page_choice>:
+{
+  806221:	55                   	push   %ebp
+  806222:	89 e5                	mov    %esp,%ebp
+  806224:	57                   	push   %edi
+  806225:	56                   	push   %esi
+  806226:	53                   	push   %ebx
+  806227:	83 ec 24             	sub    $0x24,%esp
+  80622a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80622d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  806230:	57                   	push   %edi
+  806231:	56                   	push   %esi
+  806232:	ff 15 9c 00 81 00    	call   *0x81009c
+  806238:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80623a:	83 c4 10             	add    $0x10,%esp
+  80623d:	eb 25                	jmp    806264 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  80623f:	83 ec 08             	sub    $0x8,%esp
+  806242:	c1 e0 16             	shl    $0x16,%eax
+  806245:	50                   	push   %eax
+  806246:	6a 00                	push   $0x0
+  806248:	e8 12 dd ff ff       	call   803f5f <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80624d:	83 c4 10             	add    $0x10,%esp
+  806250:	85 c0                	test   %eax,%eax
+  806252:	75 43                	jne    806297 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  806254:	83 ec 08             	sub    $0x8,%esp
+  806257:	57                   	push   %edi
+  806258:	56                   	push   %esi
+  806259:	ff 15 9c 00 81 00    	call   *0x81009c
+  80625f:	89 c3                	mov    %eax,%ebx
+  806261:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  806264:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  806267:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80626d:	0f 86 ae 00 00 00    	jbe    806321 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  806273:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  806278:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80627f:	81 e2 81 00 00 00    	and    $0x81,%edx
+  806285:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  80628b:	74 b2                	je     80623f <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80628d:	83 c0 01             	add    $0x1,%eax
+  806290:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  806295:	75 e1                	jne    806278 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  806297:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80629a:	05 00 10 40 11       	add    $0x11401000,%eax
+  80629f:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8062a4:	76 1f                	jbe    8062c5 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  8062a6:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  8062ab:	89 d8                	mov    %ebx,%eax
+  8062ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8062b0:	5b                   	pop    %ebx
+  8062b1:	5e                   	pop    %esi
+  8062b2:	5f                   	pop    %edi
+  8062b3:	5d                   	pop    %ebp
+  8062b4:	c3                   	ret
+		sys_page_split(0, pg_out);
+  8062b5:	83 ec 08             	sub    $0x8,%esp
+  8062b8:	53                   	push   %ebx
+  8062b9:	6a 00                	push   $0x0
+  8062bb:	e8 9f dc ff ff       	call   803f5f <sys_page_split>
+  8062c0:	83 c4 10             	add    $0x10,%esp
+  8062c3:	eb 6c                	jmp    806331 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  8062c5:	83 ec 04             	sub    $0x4,%esp
+  8062c8:	68 2c 88 80 00       	push   $0x80882c
+  8062cd:	68 cc 01 00 00       	push   $0x1cc
+  8062d2:	68 99 87 80 00       	push   $0x808799
+  8062d7:	e8 07 d0 ff ff       	call   8032e3 <_panic>
+		panic("We tried to page out code pages\n");
+  8062dc:	83 ec 04             	sub    $0x4,%esp
+  8062df:	68 5c 88 80 00       	push   $0x80885c
+  8062e4:	68 d6 01 00 00       	push   $0x1d6
+  8062e9:	68 99 87 80 00       	push   $0x808799
+  8062ee:	e8 f0 cf ff ff       	call   8032e3 <_panic>
+		panic("Invalid mapping for the va\n");
+  8062f3:	83 ec 04             	sub    $0x4,%esp
+  8062f6:	68 a6 87 80 00       	push   $0x8087a6
+  8062fb:	68 da 01 00 00       	push   $0x1da
+  806300:	68 99 87 80 00       	push   $0x808799
+  806305:	e8 d9 cf ff ff       	call   8032e3 <_panic>
+		panic("We tried to page out a shared page\n");
+  80630a:	83 ec 04             	sub    $0x4,%esp
+  80630d:	68 80 88 80 00       	push   $0x808880
+  806312:	68 e0 01 00 00       	push   $0x1e0
+  806317:	68 99 87 80 00       	push   $0x808799
+  80631c:	e8 c2 cf ff ff       	call   8032e3 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  806321:	89 de                	mov    %ebx,%esi
+  806323:	c1 ee 16             	shr    $0x16,%esi
+  806326:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80632d:	a8 80                	test   $0x80,%al
+  80632f:	75 84                	jne    8062b5 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  806331:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  806334:	05 00 10 40 11       	add    $0x11401000,%eax
+  806339:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80633e:	76 85                	jbe    8062c5 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  806340:	89 d8                	mov    %ebx,%eax
+  806342:	e8 7e f3 ff ff       	call   8056c5 <page_is_clean>
+  806347:	84 c0                	test   %al,%al
+  806349:	0f 85 5c ff ff ff    	jne    8062ab <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  80634f:	81 7d e4 00 c0 85 00 	cmpl   $0x85c000,-0x1c(%ebp)
+  806356:	76 84                	jbe    8062dc <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  806358:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80635f:	a8 01                	test   $0x1,%al
+  806361:	74 90                	je     8062f3 <get_page_choice+0xd2>
+  806363:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  806366:	c1 e8 0c             	shr    $0xc,%eax
+  806369:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  806370:	f6 c2 01             	test   $0x1,%dl
+  806373:	0f 84 7a ff ff ff    	je     8062f3 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  806379:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  806380:	f6 c2 01             	test   $0x1,%dl
+  806383:	74 85                	je     80630a <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  806385:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  80638c:	f6 c2 01             	test   $0x1,%dl
+  80638f:	0f 84 75 ff ff ff    	je     80630a <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  806395:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  80639c:	f6 c6 04             	test   $0x4,%dh
+  80639f:	0f 85 65 ff ff ff    	jne    80630a <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  8063a5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8063ac:	f6 c6 02             	test   $0x2,%dh
+  8063af:	0f 85 55 ff ff ff    	jne    80630a <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  8063b5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8063bc:	c1 e8 0c             	shr    $0xc,%eax
+  8063bf:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8063c2:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8063c7:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8063cb:	66 83 f8 01          	cmp    $0x1,%ax
+  8063cf:	0f 86 d6 fe ff ff    	jbe    8062ab <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  8063d5:	83 ec 04             	sub    $0x4,%esp
+  8063d8:	68 a4 88 80 00       	push   $0x8088a4
+  8063dd:	68 e2 01 00 00       	push   $0x1e2
+  8063e2:	68 99 87 80 00       	push   $0x808799
+  8063e7:	e8 f7 ce ff ff       	call   8032e3 <_panic>
+
+008063ec <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  8063ec:	55                   	push   %ebp
+  8063ed:	89 e5                	mov    %esp,%ebp
+  8063ef:	57                   	push   %edi
+  8063f0:	56                   	push   %esi
+  8063f1:	53                   	push   %ebx
+  8063f2:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  8063f5:	e8 e8 f6 ff ff       	call   805ae2 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  8063fa:	a1 40 70 85 00       	mov    0x857040,%eax
+  8063ff:	85 c0                	test   %eax,%eax
+  806401:	74 41                	je     806444 <page_share_paged_out+0x58>
+  806403:	83 3d 18 a9 85 00 00 	cmpl   $0x0,0x85a918
+  80640a:	0f 84 fd 00 00 00    	je     80650d <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  806410:	c7 05 00 50 85 00 00 	movl   $0x0,0x855000
+  806417:	00 00 00 
+  80641a:	c7 05 00 60 85 00 00 	movl   $0x0,0x856000
+  806421:	00 00 00 
+  806424:	bf 00 00 00 00       	mov    $0x0,%edi
+  806429:	eb 2c                	jmp    806457 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  80642b:	83 c3 04             	add    $0x4,%ebx
+  80642e:	39 f3                	cmp    %esi,%ebx
+  806430:	74 1a                	je     80644c <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  806432:	8b 03                	mov    (%ebx),%eax
+  806434:	a8 01                	test   $0x1,%al
+  806436:	74 f3                	je     80642b <page_share_paged_out+0x3f>
+  806438:	c1 e8 0c             	shr    $0xc,%eax
+  80643b:	e8 2b f5 ff ff       	call   80596b <page_share_slot>
+  806440:	85 c0                	test   %eax,%eax
+  806442:	79 e7                	jns    80642b <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  806444:	83 c4 0c             	add    $0xc,%esp
+  806447:	5b                   	pop    %ebx
+  806448:	5e                   	pop    %esi
+  806449:	5f                   	pop    %edi
+  80644a:	5d                   	pop    %ebp
+  80644b:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  80644c:	83 c7 04             	add    $0x4,%edi
+  80644f:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  806455:	74 1b                	je     806472 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  806457:	a1 18 a9 85 00       	mov    0x85a918,%eax
+  80645c:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  80645f:	f6 c3 01             	test   $0x1,%bl
+  806462:	74 e8                	je     80644c <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  806464:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  80646a:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  806470:	eb bc                	jmp    80642e <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  806472:	bb 00 00 00 00       	mov    $0x0,%ebx
+  806477:	eb 11                	jmp    80648a <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  806479:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80647f:	83 c3 01             	add    $0x1,%ebx
+  806482:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  806488:	77 41                	ja     8064cb <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  80648a:	89 d8                	mov    %ebx,%eax
+  80648c:	c1 e8 0a             	shr    $0xa,%eax
+  80648f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  806496:	25 81 00 00 00       	and    $0x81,%eax
+  80649b:	83 f8 01             	cmp    $0x1,%eax
+  80649e:	75 d9                	jne    806479 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  8064a0:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8064a7:	25 81 00 00 00       	and    $0x81,%eax
+  8064ac:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8064b1:	75 cc                	jne    80647f <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  8064b3:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8064ba:	c1 e8 0c             	shr    $0xc,%eax
+  8064bd:	e8 a9 f4 ff ff       	call   80596b <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  8064c2:	85 c0                	test   %eax,%eax
+  8064c4:	79 b9                	jns    80647f <page_share_paged_out+0x93>
+  8064c6:	e9 79 ff ff ff       	jmp    806444 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8064cb:	83 3d 00 50 85 00 00 	cmpl   $0x0,0x855000
+  8064d2:	75 13                	jne    8064e7 <page_share_paged_out+0xfb>
+  8064d4:	83 3d 00 60 85 00 00 	cmpl   $0x0,0x856000
+  8064db:	75 1d                	jne    8064fa <page_share_paged_out+0x10e>
+	return 0;
+  8064dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064e2:	e9 5d ff ff ff       	jmp    806444 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8064e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064ec:	e8 46 f4 ff ff       	call   805937 <page_share_send>
+  8064f1:	85 c0                	test   %eax,%eax
+  8064f3:	79 df                	jns    8064d4 <page_share_paged_out+0xe8>
+  8064f5:	e9 4a ff ff ff       	jmp    806444 <page_share_paged_out+0x58>
+  8064fa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8064ff:	e8 33 f4 ff ff       	call   805937 <page_share_send>
+  806504:	85 c0                	test   %eax,%eax
+  806506:	79 d5                	jns    8064dd <page_share_paged_out+0xf1>
+  806508:	e9 37 ff ff ff       	jmp    806444 <page_share_paged_out+0x58>
+		return 0;
+  80650d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806512:	e9 2d ff ff ff       	jmp    806444 <page_share_paged_out+0x58>
+
+00806517 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  806517:	55                   	push   %ebp
+  806518:	89 e5                	mov    %esp,%ebp
+  80651a:	56                   	push   %esi
+  80651b:	53                   	push   %ebx
+  80651c:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  80651f:	e8 be f5 ff ff       	call   805ae2 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  806524:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  806529:	83 3d 40 70 85 00 00 	cmpl   $0x0,0x857040
+  806530:	0f 84 82 00 00 00    	je     8065b8 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  806536:	83 ec 0c             	sub    $0xc,%esp
+  806539:	68 00 10 00 00       	push   $0x1000
+  80653e:	e8 84 11 00 00       	call   8076c7 <malloc>
+  806543:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  806545:	83 c4 0c             	add    $0xc,%esp
+  806548:	6a 14                	push   $0x14
+  80654a:	6a 00                	push   $0x0
+  80654c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80654f:	50                   	push   %eax
+  806550:	e8 a1 d5 ff ff       	call   803af6 <memset>
+  806555:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  806558:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  80655d:	83 ec 0c             	sub    $0xc,%esp
+  806560:	6a 07                	push   $0x7
+  806562:	6a 01                	push   $0x1
+  806564:	53                   	push   %ebx
+  806565:	6a 03                	push   $0x3
+  806567:	ff 34 b5 44 70 85 00 	push   0x857044(,%esi,4)
+  80656e:	e8 46 e1 ff ff       	call   8046b9 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  806573:	8b 03                	mov    (%ebx),%eax
+  806575:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  806578:	8b 43 04             	mov    0x4(%ebx),%eax
+  80657b:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  80657e:	8b 43 08             	mov    0x8(%ebx),%eax
+  806581:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  806584:	8b 43 0c             	mov    0xc(%ebx),%eax
+  806587:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  80658a:	8b 43 10             	mov    0x10(%ebx),%eax
+  80658d:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  806590:	83 c6 01             	add    $0x1,%esi
+  806593:	83 c4 20             	add    $0x20,%esp
+  806596:	83 fe 02             	cmp    $0x2,%esi
+  806599:	75 c2                	jne    80655d <get_paging_stats+0x46>
+	}
+	*stats = total;
+  80659b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80659e:	89 03                	mov    %eax,(%ebx)
+  8065a0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8065a3:	89 43 04             	mov    %eax,0x4(%ebx)
+  8065a6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8065a9:	89 43 08             	mov    %eax,0x8(%ebx)
+  8065ac:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8065af:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8065b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8065b5:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  8065b8:	89 d8                	mov    %ebx,%eax
+  8065ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8065bd:	5b                   	pop    %ebx
+  8065be:	5e                   	pop    %esi
+  8065bf:	5d                   	pop    %ebp
+  8065c0:	c3                   	ret
+
+008065c1 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  8065c1:	55                   	push   %ebp
+  8065c2:	89 e5                	mov    %esp,%ebp
+  8065c4:	53                   	push   %ebx
+  8065c5:	83 ec 10             	sub    $0x10,%esp
+  8065c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  8065cb:	68 92 82 80 00       	push   $0x808292
+  8065d0:	e8 e9 cd ff ff       	call   8033be <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  8065d5:	83 c4 08             	add    $0x8,%esp
+  8065d8:	ff 33                	push   (%ebx)
+  8065da:	68 d8 88 80 00       	push   $0x8088d8
+  8065df:	e8 da cd ff ff       	call   8033be <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  8065e4:	83 c4 08             	add    $0x8,%esp
+  8065e7:	ff 73 04             	push   0x4(%ebx)
+  8065ea:	68 c2 87 80 00       	push   $0x8087c2
+  8065ef:	e8 ca cd ff ff       	call   8033be <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  8065f4:	83 c4 08             	add    $0x8,%esp
+  8065f7:	ff 73 08             	push   0x8(%ebx)
+  8065fa:	68 f8 88 80 00       	push   $0x8088f8
+  8065ff:	e8 ba cd ff ff       	call   8033be <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  806604:	83 c4 08             	add    $0x8,%esp
+  806607:	ff 73 0c             	push   0xc(%ebx)
+  80660a:	68 1c 89 80 00       	push   $0x80891c
+  80660f:	e8 aa cd ff ff       	call   8033be <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  806614:	83 c4 08             	add    $0x8,%esp
+  806617:	ff 73 10             	push   0x10(%ebx)
+  80661a:	68 40 89 80 00       	push   $0x808940
+  80661f:	e8 9a cd ff ff       	call   8033be <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  806624:	83 c4 08             	add    $0x8,%esp
+  806627:	ff 35 08 70 85 00    	push   0x857008
+  80662d:	68 7c 89 80 00       	push   $0x80897c
+  806632:	e8 87 cd ff ff       	call   8033be <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  806637:	83 c4 08             	add    $0x8,%esp
+  80663a:	ff 35 04 70 85 00    	push   0x857004
+  806640:	68 b0 89 80 00       	push   $0x8089b0
+  806645:	e8 74 cd ff ff       	call   8033be <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  80664a:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  80664f:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  806652:	8b 50 68             	mov    0x68(%eax),%edx
+  806655:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  806658:	51                   	push   %ecx
+  806659:	52                   	push   %edx
+  80665a:	50                   	push   %eax
+  80665b:	68 f0 89 80 00       	push   $0x8089f0
+  806660:	e8 59 cd ff ff       	call   8033be <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  806665:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  80666a:	8b 40 70             	mov    0x70(%eax),%eax
+  80666d:	83 c4 18             	add    $0x18,%esp
+  806670:	50                   	push   %eax
+  806671:	68 24 8a 80 00       	push   $0x808a24
+  806676:	e8 43 cd ff ff       	call   8033be <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  80667b:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  806681:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  806687:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  80668c:	51                   	push   %ecx
+  80668d:	52                   	push   %edx
+  80668e:	50                   	push   %eax
+  80668f:	68 54 8a 80 00       	push   $0x808a54
+  806694:	e8 25 cd ff ff       	call   8033be <cprintf>
+	cprintf("\n");
+  806699:	83 c4 14             	add    $0x14,%esp
+  80669c:	68 92 82 80 00       	push   $0x808292
+  8066a1:	e8 18 cd ff ff       	call   8033be <cprintf>
+}
+  8066a6:	83 c4 10             	add    $0x10,%esp
+  8066a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8066ac:	c9                   	leave
+  8066ad:	c3                   	ret
+
+008066ae <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  8066ae:	55                   	push   %ebp
+  8066af:	89 e5                	mov    %esp,%ebp
+  8066b1:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  8066b4:	e8 5e fe ff ff       	call   806517 <get_paging_stats>
+  8066b9:	83 ec 0c             	sub    $0xc,%esp
+  8066bc:	50                   	push   %eax
+  8066bd:	e8 ff fe ff ff       	call   8065c1 <print_paging_stats>
+}
+  8066c2:	83 c4 10             	add    $0x10,%esp
+  8066c5:	c9                   	leave
+  8066c6:	c3                   	ret
+
+008066c7 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  8066c7:	55                   	push   %ebp
+  8066c8:	89 e5                	mov    %esp,%ebp
+  8066ca:	53                   	push   %ebx
+  8066cb:	83 ec 04             	sub    $0x4,%esp
+  8066ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  8066d1:	eb 13                	jmp    8066e6 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  8066d3:	83 ec 04             	sub    $0x4,%esp
+  8066d6:	6a ff                	push   $0xffffffff
+  8066d8:	53                   	push   %ebx
+  8066d9:	68 00 f0 ff ee       	push   $0xeefff000
+  8066de:	e8 8e dc ff ff       	call   804371 <sys_futex_wait>
+  8066e3:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  8066e6:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  8066eb:	39 d8                	cmp    %ebx,%eax
+  8066ed:	74 e4                	je     8066d3 <mem_pressure_wait+0xc>
+	return now;
+}
+  8066ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8066f2:	c9                   	leave
+  8066f3:	c3                   	ret
+
+008066f4 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  8066f4:	55                   	push   %ebp
+  8066f5:	89 e5                	mov    %esp,%ebp
+  8066f7:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  8066fa:	68 66 73 80 00       	push   $0x807366
+  8066ff:	e8 c1 dd ff ff       	call   8044c5 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  806704:	c7 05 18 a9 85 00 00 	movl   $0xdeadb000,0x85a918
+  80670b:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  80670e:	83 c4 0c             	add    $0xc,%esp
+  806711:	68 07 02 00 00       	push   $0x207
+  806716:	68 00 b0 ad de       	push   $0xdeadb000
+  80671b:	6a 00                	push   $0x0
+  80671d:	e8 76 d7 ff ff       	call   803e98 <sys_page_alloc>
+  806722:	83 c4 10             	add    $0x10,%esp
+  806725:	85 c0                	test   %eax,%eax
+  806727:	78 0c                	js     806735 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  806729:	e8 b4 f3 ff ff       	call   805ae2 <find_paging_env>
+	page_ring_ready();
+  80672e:	e8 7f f2 ff ff       	call   8059b2 <page_ring_ready>
+}
+  806733:	c9                   	leave
+  806734:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  806735:	50                   	push   %eax
+  806736:	68 e0 87 80 00       	push   $0x8087e0
+  80673b:	68 13 05 00 00       	push   $0x513
+  806740:	68 99 87 80 00       	push   $0x808799
+  806745:	e8 99 cb ff ff       	call   8032e3 <_panic>
+
+0080674a <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  80674a:	55                   	push   %ebp
+  80674b:	89 e5                	mov    %esp,%ebp
+  80674d:	57                   	push   %edi
+  80674e:	56                   	push   %esi
+  80674f:	53                   	push   %ebx
+  806750:	83 ec 0c             	sub    $0xc,%esp
+  806753:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  806756:	89 fa                	mov    %edi,%edx
+  806758:	c1 ea 16             	shr    $0x16,%edx
+  80675b:	a1 18 a9 85 00       	mov    0x85a918,%eax
+  806760:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  806763:	f6 06 01             	testb  $0x1,(%esi)
+  806766:	75 3e                	jne    8067a6 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  806768:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  80676d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  806771:	74 47                	je     8067ba <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  806773:	83 ec 0c             	sub    $0xc,%esp
+  806776:	6a 01                	push   $0x1
+  806778:	e8 f2 11 00 00       	call   80796f <va_alloc>
+  80677d:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  80677f:	83 c4 10             	add    $0x10,%esp
+  806782:	85 c0                	test   %eax,%eax
+  806784:	74 34                	je     8067ba <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  806786:	6a 00                	push   $0x0
+  806788:	68 07 02 00 00       	push   $0x207
+  80678d:	50                   	push   %eax
+  80678e:	6a 00                	push   $0x0
+  806790:	e8 df 02 00 00       	call   806a74 <page_alloc>
+  806795:	83 c4 10             	add    $0x10,%esp
+  806798:	85 c0                	test   %eax,%eax
+  80679a:	78 28                	js     8067c4 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  80679c:	f6 06 01             	testb  $0x1,(%esi)
+  80679f:	75 38                	jne    8067d9 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  8067a1:	83 cb 01             	or     $0x1,%ebx
+  8067a4:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  8067a6:	89 f8                	mov    %edi,%eax
+  8067a8:	c1 e8 0a             	shr    $0xa,%eax
+  8067ab:	25 fc 0f 00 00       	and    $0xffc,%eax
+  8067b0:	8b 1e                	mov    (%esi),%ebx
+  8067b2:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8067b8:	01 c3                	add    %eax,%ebx
+}
+  8067ba:	89 d8                	mov    %ebx,%eax
+  8067bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8067bf:	5b                   	pop    %ebx
+  8067c0:	5e                   	pop    %esi
+  8067c1:	5f                   	pop    %edi
+  8067c2:	5d                   	pop    %ebp
+  8067c3:	c3                   	ret
+			va_free(page, 1);
+  8067c4:	83 ec 08             	sub    $0x8,%esp
+  8067c7:	6a 01                	push   $0x1
+  8067c9:	53                   	push   %ebx
+  8067ca:	e8 d8 12 00 00       	call   807aa7 <va_free>
+			return NULL;
+  8067cf:	83 c4 10             	add    $0x10,%esp
+  8067d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8067d7:	eb e1                	jmp    8067ba <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  8067d9:	83 ec 08             	sub    $0x8,%esp
+  8067dc:	53                   	push   %ebx
+  8067dd:	6a 00                	push   $0x0
+  8067df:	e8 39 d7 ff ff       	call   803f1d <sys_page_unmap>
+			va_free(page, 1);
+  8067e4:	83 c4 08             	add    $0x8,%esp
+  8067e7:	6a 01                	push   $0x1
+  8067e9:	53                   	push   %ebx
+  8067ea:	e8 b8 12 00 00       	call   807aa7 <va_free>
+  8067ef:	83 c4 10             	add    $0x10,%esp
+  8067f2:	eb b2                	jmp    8067a6 <umapdir_walk+0x5c>
+
+008067f4 <page_out>:
+{
+  8067f4:	55                   	push   %ebp
+  8067f5:	89 e5                	mov    %esp,%ebp
+  8067f7:	57                   	push   %edi
+  8067f8:	56                   	push   %esi
+  8067f9:	53                   	push   %ebx
+  8067fa:	83 ec 5c             	sub    $0x5c,%esp
+  8067fd:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  806800:	e8 dd f2 ff ff       	call   805ae2 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  806805:	a1 40 70 85 00       	mov    0x857040,%eax
+  80680a:	85 c0                	test   %eax,%eax
+  80680c:	74 1e                	je     80682c <page_out+0x38>
+  80680e:	83 ec 0c             	sub    $0xc,%esp
+  806811:	6a 00                	push   $0x0
+  806813:	6a 00                	push   $0x0
+  806815:	6a 00                	push   $0x0
+  806817:	6a 08                	push   $0x8
+  806819:	50                   	push   %eax
+  80681a:	e8 9a de ff ff       	call   8046b9 <ipc_call>
+  80681f:	89 c3                	mov    %eax,%ebx
+  806821:	83 c4 20             	add    $0x20,%esp
+  806824:	85 c0                	test   %eax,%eax
+  806826:	0f 84 ac 00 00 00    	je     8068d8 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  80682c:	83 ec 08             	sub    $0x8,%esp
+  80682f:	ff 75 0c             	push   0xc(%ebp)
+  806832:	57                   	push   %edi
+  806833:	e8 e9 f9 ff ff       	call   806221 <get_page_choice>
+  806838:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  80683a:	83 c4 10             	add    $0x10,%esp
+  80683d:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  806842:	0f 84 18 02 00 00    	je     806a60 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  806848:	e8 78 ee ff ff       	call   8056c5 <page_is_clean>
+  80684d:	84 c0                	test   %al,%al
+  80684f:	0f 85 8c 00 00 00    	jne    8068e1 <page_out+0xed>
+	if (pagingenv == 0)
+  806855:	83 3d 40 70 85 00 00 	cmpl   $0x0,0x857040
+  80685c:	0f 84 08 02 00 00    	je     806a6a <page_out+0x276>
+	if (page_ring_ready())
+  806862:	e8 4b f1 ff ff       	call   8059b2 <page_ring_ready>
+  806867:	89 c3                	mov    %eax,%ebx
+  806869:	85 c0                	test   %eax,%eax
+  80686b:	0f 85 89 00 00 00    	jne    8068fa <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  806871:	83 ec 0c             	sub    $0xc,%esp
+  806874:	6a 05                	push   $0x5
+  806876:	6a 01                	push   $0x1
+  806878:	56                   	push   %esi
+  806879:	6a 01                	push   $0x1
+  80687b:	ff 35 40 70 85 00    	push   0x857040
+  806881:	e8 33 de ff ff       	call   8046b9 <ipc_call>
+  806886:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  806888:	83 c4 20             	add    $0x20,%esp
+  80688b:	85 c0                	test   %eax,%eax
+  80688d:	0f 88 b8 01 00 00    	js     806a4b <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  806893:	89 f0                	mov    %esi,%eax
+  806895:	c1 e8 0c             	shr    $0xc,%eax
+  806898:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80689f:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  8068a2:	83 ec 08             	sub    $0x8,%esp
+  8068a5:	56                   	push   %esi
+  8068a6:	6a 00                	push   $0x0
+  8068a8:	e8 70 d6 ff ff       	call   803f1d <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  8068ad:	83 c4 08             	add    $0x8,%esp
+  8068b0:	6a 01                	push   $0x1
+  8068b2:	56                   	push   %esi
+  8068b3:	e8 92 fe ff ff       	call   80674a <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  8068b8:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  8068bb:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  8068c1:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  8068c4:	09 fe                	or     %edi,%esi
+  8068c6:	83 ce 01             	or     $0x1,%esi
+  8068c9:	89 30                	mov    %esi,(%eax)
+	return 0;
+  8068cb:	83 c4 10             	add    $0x10,%esp
+}
+  8068ce:	89 d8                	mov    %ebx,%eax
+  8068d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8068d3:	5b                   	pop    %ebx
+  8068d4:	5e                   	pop    %esi
+  8068d5:	5f                   	pop    %edi
+  8068d6:	5d                   	pop    %ebp
+  8068d7:	c3                   	ret
+		num_page_reclaims++;
+  8068d8:	83 05 04 70 85 00 01 	addl   $0x1,0x857004
+		return 0;
+  8068df:	eb ed                	jmp    8068ce <page_out+0xda>
+		num_page_drops++;
+  8068e1:	83 05 08 70 85 00 01 	addl   $0x1,0x857008
+		return sys_page_unmap(0, map_out_addr);
+  8068e8:	83 ec 08             	sub    $0x8,%esp
+  8068eb:	56                   	push   %esi
+  8068ec:	6a 00                	push   $0x0
+  8068ee:	e8 2a d6 ff ff       	call   803f1d <sys_page_unmap>
+  8068f3:	89 c3                	mov    %eax,%ebx
+  8068f5:	83 c4 10             	add    $0x10,%esp
+  8068f8:	eb d4                	jmp    8068ce <page_out+0xda>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8068fa:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  8068fc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  806901:	2d 00 10 00 00       	sub    $0x1000,%eax
+  806906:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  806909:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  80690b:	83 c0 08             	add    $0x8,%eax
+  80690e:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  806911:	b8 07 00 00 00       	mov    $0x7,%eax
+  806916:	e8 e5 ef ff ff       	call   805900 <page_ring_reserve>
+	first = ring->sq_tail;
+  80691b:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  806920:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  806923:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  806928:	83 ec 04             	sub    $0x4,%esp
+  80692b:	68 00 10 00 00       	push   $0x1000
+  806930:	56                   	push   %esi
+  806931:	89 d8                	mov    %ebx,%eax
+  806933:	c1 e0 0c             	shl    $0xc,%eax
+  806936:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  80693b:	50                   	push   %eax
+  80693c:	e8 4c d2 ff ff       	call   803b8d <memcpy>
+		vas[n] = va;
+  806941:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  806945:	89 d9                	mov    %ebx,%ecx
+  806947:	ba 00 00 00 00       	mov    $0x0,%edx
+  80694c:	b8 01 00 00 00       	mov    $0x1,%eax
+  806951:	e8 de ee ff ff       	call   805834 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  806956:	8d 43 01             	lea    0x1(%ebx),%eax
+  806959:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  80695c:	83 c4 10             	add    $0x10,%esp
+  80695f:	83 fb 06             	cmp    $0x6,%ebx
+  806962:	74 62                	je     8069c6 <page_out+0x1d2>
+  806964:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  806967:	eb 15                	jmp    80697e <page_out+0x18a>
+			num_page_drops++;
+  806969:	83 05 08 70 85 00 01 	addl   $0x1,0x857008
+			sys_page_unmap(0, va);
+  806970:	83 ec 08             	sub    $0x8,%esp
+  806973:	56                   	push   %esi
+  806974:	6a 00                	push   $0x0
+  806976:	e8 a2 d5 ff ff       	call   803f1d <sys_page_unmap>
+  80697b:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  80697e:	83 ec 08             	sub    $0x8,%esp
+  806981:	53                   	push   %ebx
+  806982:	57                   	push   %edi
+  806983:	e8 99 f8 ff ff       	call   806221 <get_page_choice>
+  806988:	89 c6                	mov    %eax,%esi
+  80698a:	83 c4 10             	add    $0x10,%esp
+  80698d:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  806992:	74 32                	je     8069c6 <page_out+0x1d2>
+  806994:	e8 2c ed ff ff       	call   8056c5 <page_is_clean>
+  806999:	84 c0                	test   %al,%al
+  80699b:	75 cc                	jne    806969 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  80699d:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  8069a0:	39 c6                	cmp    %eax,%esi
+  8069a2:	72 07                	jb     8069ab <page_out+0x1b7>
+  8069a4:	8b 45 98             	mov    -0x68(%ebp),%eax
+  8069a7:	39 c6                	cmp    %eax,%esi
+  8069a9:	72 1b                	jb     8069c6 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  8069ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8069b0:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  8069b3:	eb 03                	jmp    8069b8 <page_out+0x1c4>
+  8069b5:	83 c3 01             	add    $0x1,%ebx
+  8069b8:	39 da                	cmp    %ebx,%edx
+  8069ba:	0f 84 68 ff ff ff    	je     806928 <page_out+0x134>
+  8069c0:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  8069c4:	75 ef                	jne    8069b5 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  8069c6:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  8069c9:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  8069cc:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  8069cf:	e8 a6 ee ff ff       	call   80587a <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  8069d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8069d9:	eb 42                	jmp    806a1d <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  8069db:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  8069df:	89 f8                	mov    %edi,%eax
+  8069e1:	c1 e8 0c             	shr    $0xc,%eax
+  8069e4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8069eb:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  8069ee:	83 ec 08             	sub    $0x8,%esp
+  8069f1:	57                   	push   %edi
+  8069f2:	6a 00                	push   $0x0
+  8069f4:	e8 24 d5 ff ff       	call   803f1d <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  8069f9:	83 c4 08             	add    $0x8,%esp
+  8069fc:	6a 01                	push   $0x1
+  8069fe:	57                   	push   %edi
+  8069ff:	e8 46 fd ff ff       	call   80674a <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  806a04:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  806a07:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  806a0d:	c1 e6 0c             	shl    $0xc,%esi
+  806a10:	09 d6                	or     %edx,%esi
+  806a12:	83 ce 01             	or     $0x1,%esi
+  806a15:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  806a17:	83 c3 01             	add    $0x1,%ebx
+  806a1a:	83 c4 10             	add    $0x10,%esp
+  806a1d:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  806a20:	39 c3                	cmp    %eax,%ebx
+  806a22:	74 1d                	je     806a41 <page_out+0x24d>
+		if (res[i] < 0)
+  806a24:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  806a28:	85 f6                	test   %esi,%esi
+  806a2a:	79 af                	jns    8069db <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  806a2c:	56                   	push   %esi
+  806a2d:	68 84 8a 80 00       	push   $0x808a84
+  806a32:	68 d1 02 00 00       	push   $0x2d1
+  806a37:	68 99 87 80 00       	push   $0x808799
+  806a3c:	e8 a2 c8 ff ff       	call   8032e3 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  806a41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  806a46:	e9 83 fe ff ff       	jmp    8068ce <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  806a4b:	50                   	push   %eax
+  806a4c:	68 84 8a 80 00       	push   $0x808a84
+  806a51:	68 0a 03 00 00       	push   $0x30a
+  806a56:	68 99 87 80 00       	push   $0x808799
+  806a5b:	e8 83 c8 ff ff       	call   8032e3 <_panic>
+		return -E_NO_MEM;
+  806a60:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  806a65:	e9 64 fe ff ff       	jmp    8068ce <page_out+0xda>
+		return -E_PAGING;
+  806a6a:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  806a6f:	e9 5a fe ff ff       	jmp    8068ce <page_out+0xda>
+
+00806a74 <page_alloc>:
+{
+  806a74:	55                   	push   %ebp
+  806a75:	89 e5                	mov    %esp,%ebp
+  806a77:	57                   	push   %edi
+  806a78:	56                   	push   %esi
+  806a79:	53                   	push   %ebx
+  806a7a:	83 ec 0c             	sub    $0xc,%esp
+  806a7d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  806a80:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  806a83:	83 3d 18 a9 85 00 00 	cmpl   $0x0,0x85a918
+  806a8a:	74 34                	je     806ac0 <page_alloc+0x4c>
+	if (check_mte)
+  806a8c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  806a90:	75 35                	jne    806ac7 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  806a92:	83 ec 04             	sub    $0x4,%esp
+  806a95:	ff 75 10             	push   0x10(%ebp)
+  806a98:	56                   	push   %esi
+  806a99:	57                   	push   %edi
+  806a9a:	e8 f9 d3 ff ff       	call   803e98 <sys_page_alloc>
+  806a9f:	89 c3                	mov    %eax,%ebx
+  806aa1:	83 c4 10             	add    $0x10,%esp
+  806aa4:	85 c0                	test   %eax,%eax
+  806aa6:	79 52                	jns    806afa <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  806aa8:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  806aab:	75 52                	jne    806aff <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  806aad:	83 ec 08             	sub    $0x8,%esp
+  806ab0:	56                   	push   %esi
+  806ab1:	57                   	push   %edi
+  806ab2:	e8 3d fd ff ff       	call   8067f4 <page_out>
+  806ab7:	83 c4 10             	add    $0x10,%esp
+  806aba:	85 c0                	test   %eax,%eax
+  806abc:	79 d4                	jns    806a92 <page_alloc+0x1e>
+  806abe:	eb 3f                	jmp    806aff <page_alloc+0x8b>
+		init_map_dir();
+  806ac0:	e8 2f fc ff ff       	call   8066f4 <init_map_dir>
+  806ac5:	eb c5                	jmp    806a8c <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  806ac7:	83 ec 08             	sub    $0x8,%esp
+  806aca:	6a 00                	push   $0x0
+  806acc:	56                   	push   %esi
+  806acd:	e8 78 fc ff ff       	call   80674a <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  806ad2:	83 c4 10             	add    $0x10,%esp
+  806ad5:	85 c0                	test   %eax,%eax
+  806ad7:	74 b9                	je     806a92 <page_alloc+0x1e>
+  806ad9:	8b 10                	mov    (%eax),%edx
+  806adb:	f6 c2 01             	test   $0x1,%dl
+  806ade:	74 b2                	je     806a92 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  806ae0:	83 ec 08             	sub    $0x8,%esp
+  806ae3:	56                   	push   %esi
+  806ae4:	52                   	push   %edx
+  806ae5:	50                   	push   %eax
+  806ae6:	68 a8 8a 80 00       	push   $0x808aa8
+  806aeb:	68 34 03 00 00       	push   $0x334
+  806af0:	68 99 87 80 00       	push   $0x808799
+  806af5:	e8 e9 c7 ff ff       	call   8032e3 <_panic>
+	return 0;
+  806afa:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  806aff:	89 d8                	mov    %ebx,%eax
+  806b01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806b04:	5b                   	pop    %ebx
+  806b05:	5e                   	pop    %esi
+  806b06:	5f                   	pop    %edi
+  806b07:	5d                   	pop    %ebp
+  806b08:	c3                   	ret
+
+00806b09 <page_adopt>:
+{
+  806b09:	55                   	push   %ebp
+  806b0a:	89 e5                	mov    %esp,%ebp
+  806b0c:	56                   	push   %esi
+  806b0d:	53                   	push   %ebx
+  806b0e:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  806b10:	c1 e8 16             	shr    $0x16,%eax
+  806b13:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  806b1a:	25 81 00 00 00       	and    $0x81,%eax
+  806b1f:	83 f8 01             	cmp    $0x1,%eax
+  806b22:	75 53                	jne    806b77 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  806b24:	89 d8                	mov    %ebx,%eax
+  806b26:	c1 e8 0c             	shr    $0xc,%eax
+  806b29:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  806b30:	89 f2                	mov    %esi,%edx
+  806b32:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  806b38:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  806b3d:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  806b43:	75 37                	jne    806b7c <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  806b45:	83 ec 08             	sub    $0x8,%esp
+  806b48:	6a 01                	push   $0x1
+  806b4a:	53                   	push   %ebx
+  806b4b:	e8 fa fb ff ff       	call   80674a <umapdir_walk>
+  806b50:	83 c4 10             	add    $0x10,%esp
+  806b53:	85 c0                	test   %eax,%eax
+  806b55:	74 2c                	je     806b83 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  806b57:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  806b5d:	83 ce 01             	or     $0x1,%esi
+  806b60:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  806b62:	83 ec 08             	sub    $0x8,%esp
+  806b65:	53                   	push   %ebx
+  806b66:	6a 00                	push   $0x0
+  806b68:	e8 b0 d3 ff ff       	call   803f1d <sys_page_unmap>
+	return 1;
+  806b6d:	83 c4 10             	add    $0x10,%esp
+  806b70:	b8 01 00 00 00       	mov    $0x1,%eax
+  806b75:	eb 05                	jmp    806b7c <page_adopt+0x73>
+		return 0;
+  806b77:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806b7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  806b7f:	5b                   	pop    %ebx
+  806b80:	5e                   	pop    %esi
+  806b81:	5d                   	pop    %ebp
+  806b82:	c3                   	ret
+		return -E_NO_MEM;
+  806b83:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  806b88:	eb f2                	jmp    806b7c <page_adopt+0x73>
+
+00806b8a <page_forget>:
+{
+  806b8a:	55                   	push   %ebp
+  806b8b:	89 e5                	mov    %esp,%ebp
+  806b8d:	53                   	push   %ebx
+  806b8e:	83 ec 04             	sub    $0x4,%esp
+  806b91:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  806b93:	e8 4a ef ff ff       	call   805ae2 <find_paging_env>
+	if (pagingenv == 0)
+  806b98:	83 3d 40 70 85 00 00 	cmpl   $0x0,0x857040
+  806b9f:	74 39                	je     806bda <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  806ba1:	89 d8                	mov    %ebx,%eax
+  806ba3:	c1 e8 16             	shr    $0x16,%eax
+  806ba6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  806bad:	25 81 00 00 00       	and    $0x81,%eax
+  806bb2:	83 f8 01             	cmp    $0x1,%eax
+  806bb5:	74 28                	je     806bdf <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  806bb7:	83 3d 18 a9 85 00 00 	cmpl   $0x0,0x85a918
+  806bbe:	74 1a                	je     806bda <page_forget+0x50>
+  806bc0:	83 ec 08             	sub    $0x8,%esp
+  806bc3:	6a 00                	push   $0x0
+  806bc5:	53                   	push   %ebx
+  806bc6:	e8 7f fb ff ff       	call   80674a <umapdir_walk>
+  806bcb:	89 c3                	mov    %eax,%ebx
+  806bcd:	83 c4 10             	add    $0x10,%esp
+  806bd0:	85 c0                	test   %eax,%eax
+  806bd2:	74 06                	je     806bda <page_forget+0x50>
+  806bd4:	8b 00                	mov    (%eax),%eax
+  806bd6:	a8 01                	test   $0x1,%al
+  806bd8:	75 2b                	jne    806c05 <page_forget+0x7b>
+}
+  806bda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  806bdd:	c9                   	leave
+  806bde:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  806bdf:	89 d8                	mov    %ebx,%eax
+  806be1:	c1 e8 0c             	shr    $0xc,%eax
+  806be4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  806beb:	89 c2                	mov    %eax,%edx
+  806bed:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  806bf3:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  806bf9:	75 bc                	jne    806bb7 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  806bfb:	c1 e8 0c             	shr    $0xc,%eax
+  806bfe:	e8 5c ee ff ff       	call   805a5f <page_remove_slot>
+		return;
+  806c03:	eb d5                	jmp    806bda <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  806c05:	c1 e8 0c             	shr    $0xc,%eax
+  806c08:	e8 52 ee ff ff       	call   805a5f <page_remove_slot>
+	*mte = 0;
+  806c0d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  806c13:	eb c5                	jmp    806bda <page_forget+0x50>
+
+00806c15 <page_unmap>:
+{
+  806c15:	55                   	push   %ebp
+  806c16:	89 e5                	mov    %esp,%ebp
+  806c18:	57                   	push   %edi
+  806c19:	56                   	push   %esi
+  806c1a:	53                   	push   %ebx
+  806c1b:	83 ec 0c             	sub    $0xc,%esp
+  806c1e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  806c21:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  806c24:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  806c29:	8b 40 48             	mov    0x48(%eax),%eax
+  806c2c:	85 db                	test   %ebx,%ebx
+  806c2e:	0f 8e b4 00 00 00    	jle    806ce8 <page_unmap+0xd3>
+  806c34:	39 d8                	cmp    %ebx,%eax
+  806c36:	0f 84 ac 00 00 00    	je     806ce8 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  806c3c:	83 ec 08             	sub    $0x8,%esp
+  806c3f:	57                   	push   %edi
+  806c40:	53                   	push   %ebx
+  806c41:	e8 d7 d2 ff ff       	call   803f1d <sys_page_unmap>
+  806c46:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  806c48:	e8 95 ee ff ff       	call   805ae2 <find_paging_env>
+	if (pagingenv == 0)
+  806c4d:	83 c4 10             	add    $0x10,%esp
+  806c50:	83 3d 40 70 85 00 00 	cmpl   $0x0,0x857040
+  806c57:	0f 84 a1 00 00 00    	je     806cfe <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  806c5d:	83 ec 0c             	sub    $0xc,%esp
+  806c60:	6a 05                	push   $0x5
+  806c62:	68 00 00 40 00       	push   $0x400000
+  806c67:	6a 00                	push   $0x0
+  806c69:	68 00 b0 ad de       	push   $0xdeadb000
+  806c6e:	53                   	push   %ebx
+  806c6f:	e8 67 d2 ff ff       	call   803edb <sys_page_map>
+  806c74:	83 c4 20             	add    $0x20,%esp
+  806c77:	85 c0                	test   %eax,%eax
+  806c79:	0f 88 89 00 00 00    	js     806d08 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  806c7f:	89 f8                	mov    %edi,%eax
+  806c81:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  806c84:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  806c8b:	a8 01                	test   $0x1,%al
+  806c8d:	74 6f                	je     806cfe <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  806c8f:	83 ec 0c             	sub    $0xc,%esp
+  806c92:	6a 05                	push   $0x5
+  806c94:	68 00 00 40 00       	push   $0x400000
+  806c99:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  806c9b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  806ca0:	50                   	push   %eax
+  806ca1:	53                   	push   %ebx
+  806ca2:	e8 34 d2 ff ff       	call   803edb <sys_page_map>
+  806ca7:	83 c4 20             	add    $0x20,%esp
+  806caa:	85 c0                	test   %eax,%eax
+  806cac:	78 6f                	js     806d1d <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  806cae:	c1 ef 0c             	shr    $0xc,%edi
+  806cb1:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  806cb7:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  806cbe:	01 
+  806cbf:	74 3d                	je     806cfe <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  806cc1:	83 ec 08             	sub    $0x8,%esp
+  806cc4:	68 00 00 40 00       	push   $0x400000
+  806cc9:	6a 00                	push   $0x0
+  806ccb:	e8 4d d2 ff ff       	call   803f1d <sys_page_unmap>
+  806cd0:	83 c4 10             	add    $0x10,%esp
+  806cd3:	85 c0                	test   %eax,%eax
+  806cd5:	78 5b                	js     806d32 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  806cd7:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  806cde:	c1 e8 0c             	shr    $0xc,%eax
+  806ce1:	e8 79 ed ff ff       	call   805a5f <page_remove_slot>
+	return r;
+  806ce6:	eb 16                	jmp    806cfe <page_unmap+0xe9>
+		page_forget(va);
+  806ce8:	89 f8                	mov    %edi,%eax
+  806cea:	e8 9b fe ff ff       	call   806b8a <page_forget>
+		return sys_page_unmap(envid, va);
+  806cef:	83 ec 08             	sub    $0x8,%esp
+  806cf2:	57                   	push   %edi
+  806cf3:	53                   	push   %ebx
+  806cf4:	e8 24 d2 ff ff       	call   803f1d <sys_page_unmap>
+  806cf9:	89 c6                	mov    %eax,%esi
+  806cfb:	83 c4 10             	add    $0x10,%esp
+}
+  806cfe:	89 f0                	mov    %esi,%eax
+  806d00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806d03:	5b                   	pop    %ebx
+  806d04:	5e                   	pop    %esi
+  806d05:	5f                   	pop    %edi
+  806d06:	5d                   	pop    %ebp
+  806d07:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  806d08:	50                   	push   %eax
+  806d09:	68 e4 8a 80 00       	push   $0x808ae4
+  806d0e:	68 e4 03 00 00       	push   $0x3e4
+  806d13:	68 99 87 80 00       	push   $0x808799
+  806d18:	e8 c6 c5 ff ff       	call   8032e3 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  806d1d:	50                   	push   %eax
+  806d1e:	68 10 8b 80 00       	push   $0x808b10
+  806d23:	68 ea 03 00 00       	push   $0x3ea
+  806d28:	68 99 87 80 00       	push   $0x808799
+  806d2d:	e8 b1 c5 ff ff       	call   8032e3 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  806d32:	50                   	push   %eax
+  806d33:	68 3c 8b 80 00       	push   $0x808b3c
+  806d38:	68 ef 03 00 00       	push   $0x3ef
+  806d3d:	68 99 87 80 00       	push   $0x808799
+  806d42:	e8 9c c5 ff ff       	call   8032e3 <_panic>
+
+00806d47 <page_unmap_range>:
+{
+  806d47:	55                   	push   %ebp
+  806d48:	89 e5                	mov    %esp,%ebp
+  806d4a:	57                   	push   %edi
+  806d4b:	56                   	push   %esi
+  806d4c:	53                   	push   %ebx
+  806d4d:	83 ec 0c             	sub    $0xc,%esp
+  806d50:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  806d53:	e8 8a ed ff ff       	call   805ae2 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  806d58:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  806d5d:	8b 40 48             	mov    0x48(%eax),%eax
+  806d60:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  806d64:	7e 38                	jle    806d9e <page_unmap_range+0x57>
+  806d66:	3b 45 08             	cmp    0x8(%ebp),%eax
+  806d69:	74 33                	je     806d9e <page_unmap_range+0x57>
+  806d6b:	83 3d 40 70 85 00 00 	cmpl   $0x0,0x857040
+  806d72:	74 2a                	je     806d9e <page_unmap_range+0x57>
+  806d74:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  806d77:	be 00 00 00 00       	mov    $0x0,%esi
+  806d7c:	39 fe                	cmp    %edi,%esi
+  806d7e:	74 56                	je     806dd6 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  806d80:	83 ec 08             	sub    $0x8,%esp
+  806d83:	53                   	push   %ebx
+  806d84:	ff 75 08             	push   0x8(%ebp)
+  806d87:	e8 89 fe ff ff       	call   806c15 <page_unmap>
+  806d8c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  806d92:	83 c4 10             	add    $0x10,%esp
+  806d95:	85 c0                	test   %eax,%eax
+  806d97:	78 35                	js     806dce <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  806d99:	83 c6 01             	add    $0x1,%esi
+  806d9c:	eb de                	jmp    806d7c <page_unmap_range+0x35>
+  806d9e:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  806da1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  806da6:	eb 10                	jmp    806db8 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  806da8:	89 f0                	mov    %esi,%eax
+  806daa:	e8 db fd ff ff       	call   806b8a <page_forget>
+		for (i = 0; i < npages; i++)
+  806daf:	83 c3 01             	add    $0x1,%ebx
+  806db2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  806db8:	39 fb                	cmp    %edi,%ebx
+  806dba:	75 ec                	jne    806da8 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  806dbc:	83 ec 04             	sub    $0x4,%esp
+  806dbf:	57                   	push   %edi
+  806dc0:	ff 75 0c             	push   0xc(%ebp)
+  806dc3:	ff 75 08             	push   0x8(%ebp)
+  806dc6:	e8 66 d2 ff ff       	call   804031 <sys_page_unmap_range>
+  806dcb:	83 c4 10             	add    $0x10,%esp
+}
+  806dce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806dd1:	5b                   	pop    %ebx
+  806dd2:	5e                   	pop    %esi
+  806dd3:	5f                   	pop    %edi
+  806dd4:	5d                   	pop    %ebp
+  806dd5:	c3                   	ret
+	return 0;
+  806dd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ddb:	eb f1                	jmp    806dce <page_unmap_range+0x87>
+
+00806ddd <page_alloc_range>:
+{
+  806ddd:	55                   	push   %ebp
+  806dde:	89 e5                	mov    %esp,%ebp
+  806de0:	57                   	push   %edi
+  806de1:	56                   	push   %esi
+  806de2:	53                   	push   %ebx
+  806de3:	83 ec 1c             	sub    $0x1c,%esp
+  806de6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  806de9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  806dec:	83 3d 18 a9 85 00 00 	cmpl   $0x0,0x85a918
+  806df3:	74 14                	je     806e09 <page_alloc_range+0x2c>
+	if (check_mte)
+  806df5:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  806df9:	74 66                	je     806e61 <page_alloc_range+0x84>
+  806dfb:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  806dfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e02:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  806e05:	89 c7                	mov    %eax,%edi
+  806e07:	eb 10                	jmp    806e19 <page_alloc_range+0x3c>
+		init_map_dir();
+  806e09:	e8 e6 f8 ff ff       	call   8066f4 <init_map_dir>
+  806e0e:	eb e5                	jmp    806df5 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  806e10:	83 c7 01             	add    $0x1,%edi
+  806e13:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  806e19:	39 df                	cmp    %ebx,%edi
+  806e1b:	74 38                	je     806e55 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  806e1d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  806e20:	83 ec 08             	sub    $0x8,%esp
+  806e23:	6a 00                	push   $0x0
+  806e25:	56                   	push   %esi
+  806e26:	e8 1f f9 ff ff       	call   80674a <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  806e2b:	83 c4 10             	add    $0x10,%esp
+  806e2e:	85 c0                	test   %eax,%eax
+  806e30:	74 de                	je     806e10 <page_alloc_range+0x33>
+  806e32:	8b 10                	mov    (%eax),%edx
+  806e34:	f6 c2 01             	test   $0x1,%dl
+  806e37:	74 d7                	je     806e10 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  806e39:	83 ec 08             	sub    $0x8,%esp
+  806e3c:	ff 75 e4             	push   -0x1c(%ebp)
+  806e3f:	52                   	push   %edx
+  806e40:	50                   	push   %eax
+  806e41:	68 a8 8a 80 00       	push   $0x808aa8
+  806e46:	68 0b 04 00 00       	push   $0x40b
+  806e4b:	68 99 87 80 00       	push   $0x808799
+  806e50:	e8 8e c4 ff ff       	call   8032e3 <_panic>
+  806e55:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  806e58:	eb 07                	jmp    806e61 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  806e5a:	c1 e0 0c             	shl    $0xc,%eax
+  806e5d:	01 c7                	add    %eax,%edi
+			npages -= r;
+  806e5f:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  806e61:	85 db                	test   %ebx,%ebx
+  806e63:	74 30                	je     806e95 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  806e65:	ff 75 14             	push   0x14(%ebp)
+  806e68:	53                   	push   %ebx
+  806e69:	57                   	push   %edi
+  806e6a:	ff 75 08             	push   0x8(%ebp)
+  806e6d:	e8 51 d1 ff ff       	call   803fc3 <sys_page_alloc_range>
+  806e72:	89 c6                	mov    %eax,%esi
+  806e74:	83 c4 10             	add    $0x10,%esp
+  806e77:	85 c0                	test   %eax,%eax
+  806e79:	7f df                	jg     806e5a <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  806e7b:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  806e7e:	75 1a                	jne    806e9a <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  806e80:	83 ec 08             	sub    $0x8,%esp
+  806e83:	57                   	push   %edi
+  806e84:	ff 75 08             	push   0x8(%ebp)
+  806e87:	e8 68 f9 ff ff       	call   8067f4 <page_out>
+  806e8c:	83 c4 10             	add    $0x10,%esp
+  806e8f:	85 c0                	test   %eax,%eax
+  806e91:	79 ce                	jns    806e61 <page_alloc_range+0x84>
+  806e93:	eb 05                	jmp    806e9a <page_alloc_range+0xbd>
+	return 0;
+  806e95:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  806e9a:	89 f0                	mov    %esi,%eax
+  806e9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806e9f:	5b                   	pop    %ebx
+  806ea0:	5e                   	pop    %esi
+  806ea1:	5f                   	pop    %edi
+  806ea2:	5d                   	pop    %ebp
+  806ea3:	c3                   	ret
+
+00806ea4 <page_in>:
+{
+  806ea4:	55                   	push   %ebp
+  806ea5:	89 e5                	mov    %esp,%ebp
+  806ea7:	57                   	push   %edi
+  806ea8:	56                   	push   %esi
+  806ea9:	53                   	push   %ebx
+  806eaa:	83 ec 3c             	sub    $0x3c,%esp
+  806ead:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  806eb0:	e8 2d ec ff ff       	call   805ae2 <find_paging_env>
+	if (pagingenv == 0)
+  806eb5:	83 3d 40 70 85 00 00 	cmpl   $0x0,0x857040
+  806ebc:	0f 84 09 02 00 00    	je     8070cb <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  806ec2:	83 ec 08             	sub    $0x8,%esp
+  806ec5:	6a 00                	push   $0x0
+  806ec7:	56                   	push   %esi
+  806ec8:	e8 7d f8 ff ff       	call   80674a <umapdir_walk>
+  806ecd:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  806ecf:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  806ed5:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  806ed8:	83 c4 10             	add    $0x10,%esp
+  806edb:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  806edf:	74 0d                	je     806eee <page_in+0x4a>
+  806ee1:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  806ee6:	8b 40 48             	mov    0x48(%eax),%eax
+  806ee9:	3b 45 08             	cmp    0x8(%ebp),%eax
+  806eec:	75 06                	jne    806ef4 <page_in+0x50>
+  806eee:	8b 03                	mov    (%ebx),%eax
+  806ef0:	a8 02                	test   $0x2,%al
+  806ef2:	75 63                	jne    806f57 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  806ef4:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  806ef6:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  806ef8:	89 f0                	mov    %esi,%eax
+  806efa:	25 06 0e 00 00       	and    $0xe06,%eax
+  806eff:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  806f02:	50                   	push   %eax
+  806f03:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  806f06:	57                   	push   %edi
+  806f07:	ff 75 08             	push   0x8(%ebp)
+  806f0a:	e8 65 fb ff ff       	call   806a74 <page_alloc>
+  806f0f:	83 c4 10             	add    $0x10,%esp
+  806f12:	85 c0                	test   %eax,%eax
+  806f14:	78 39                	js     806f4f <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  806f16:	89 f0                	mov    %esi,%eax
+  806f18:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  806f1b:	83 ec 0c             	sub    $0xc,%esp
+  806f1e:	6a 07                	push   $0x7
+  806f20:	6a 01                	push   $0x1
+  806f22:	57                   	push   %edi
+  806f23:	c1 e0 04             	shl    $0x4,%eax
+  806f26:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  806f27:	c1 ee 1c             	shr    $0x1c,%esi
+  806f2a:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  806f2d:	ff 34 b5 44 70 85 00 	push   0x857044(,%esi,4)
+  806f34:	e8 80 d7 ff ff       	call   8046b9 <ipc_call>
+  806f39:	83 c4 20             	add    $0x20,%esp
+  806f3c:	85 c0                	test   %eax,%eax
+  806f3e:	0f 88 72 01 00 00    	js     8070b6 <page_in+0x212>
+	*mte = 0;
+  806f44:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  806f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806f4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806f52:	5b                   	pop    %ebx
+  806f53:	5e                   	pop    %esi
+  806f54:	5f                   	pop    %edi
+  806f55:	5d                   	pop    %ebp
+  806f56:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  806f57:	25 06 0e 00 00       	and    $0xe06,%eax
+  806f5c:	83 c8 01             	or     $0x1,%eax
+  806f5f:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  806f62:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  806f65:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  806f68:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  806f6e:	be 01 00 00 00       	mov    $0x1,%esi
+  806f73:	eb 46                	jmp    806fbb <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  806f75:	83 ec 08             	sub    $0x8,%esp
+  806f78:	6a 00                	push   $0x0
+  806f7a:	51                   	push   %ecx
+  806f7b:	e8 ca f7 ff ff       	call   80674a <umapdir_walk>
+  806f80:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  806f84:	83 c4 10             	add    $0x10,%esp
+  806f87:	85 c0                	test   %eax,%eax
+  806f89:	74 66                	je     806ff1 <page_in+0x14d>
+  806f8b:	8b 00                	mov    (%eax),%eax
+  806f8d:	a8 01                	test   $0x1,%al
+  806f8f:	74 60                	je     806ff1 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  806f91:	89 c2                	mov    %eax,%edx
+  806f93:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  806f99:	83 ca 01             	or     $0x1,%edx
+  806f9c:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  806f9f:	75 50                	jne    806ff1 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  806fa1:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  806fa7:	c1 e8 1c             	shr    $0x1c,%eax
+  806faa:	8b 13                	mov    (%ebx),%edx
+  806fac:	c1 ea 1c             	shr    $0x1c,%edx
+  806faf:	39 d0                	cmp    %edx,%eax
+  806fb1:	75 3e                	jne    806ff1 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  806fb3:	83 c6 01             	add    $0x1,%esi
+  806fb6:	83 fe 08             	cmp    $0x8,%esi
+  806fb9:	74 3f                	je     806ffa <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  806fbb:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  806fbd:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  806fc3:	77 2c                	ja     806ff1 <page_in+0x14d>
+  806fc5:	89 f8                	mov    %edi,%eax
+  806fc7:	c1 e8 16             	shr    $0x16,%eax
+  806fca:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  806fd1:	f6 c2 01             	test   $0x1,%dl
+  806fd4:	74 9f                	je     806f75 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  806fd6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  806fdd:	a8 80                	test   $0x80,%al
+  806fdf:	75 10                	jne    806ff1 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  806fe1:	89 f8                	mov    %edi,%eax
+  806fe3:	c1 e8 0c             	shr    $0xc,%eax
+  806fe6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  806fed:	a8 01                	test   $0x1,%al
+  806fef:	74 84                	je     806f75 <page_in+0xd1>
+	if (n == 1)
+  806ff1:	83 fe 01             	cmp    $0x1,%esi
+  806ff4:	0f 84 fa fe ff ff    	je     806ef4 <page_in+0x50>
+	req.nslots = n;
+  806ffa:	89 35 00 40 85 00    	mov    %esi,0x854000
+	for (i = 0; i < n; i++)
+  807000:	b8 00 00 00 00       	mov    $0x0,%eax
+  807005:	eb 13                	jmp    80701a <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  807007:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  80700b:	8b 12                	mov    (%edx),%edx
+  80700d:	c1 ea 0c             	shr    $0xc,%edx
+  807010:	89 14 85 04 40 85 00 	mov    %edx,0x854004(,%eax,4)
+	for (i = 0; i < n; i++)
+  807017:	83 c0 01             	add    $0x1,%eax
+  80701a:	39 c6                	cmp    %eax,%esi
+  80701c:	75 e9                	jne    807007 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  80701e:	83 ec 0c             	sub    $0xc,%esp
+  807021:	6a 00                	push   $0x0
+  807023:	ff 75 c0             	push   -0x40(%ebp)
+  807026:	56                   	push   %esi
+  807027:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  80702a:	57                   	push   %edi
+  80702b:	6a 00                	push   $0x0
+  80702d:	e8 ab fd ff ff       	call   806ddd <page_alloc_range>
+  807032:	83 c4 20             	add    $0x20,%esp
+  807035:	85 c0                	test   %eax,%eax
+  807037:	78 6e                	js     8070a7 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  807039:	83 ec 04             	sub    $0x4,%esp
+  80703c:	6a 24                	push   $0x24
+  80703e:	68 00 40 85 00       	push   $0x854000
+  807043:	57                   	push   %edi
+  807044:	e8 e2 ca ff ff       	call   803b2b <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  807049:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  807050:	56                   	push   %esi
+  807051:	57                   	push   %edi
+  807052:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  807054:	0f b7 05 06 40 85 00 	movzwl 0x854006,%eax
+  80705b:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  80705e:	ff 34 85 44 70 85 00 	push   0x857044(,%eax,4)
+  807065:	e8 4f d6 ff ff       	call   8046b9 <ipc_call>
+  80706a:	83 c4 20             	add    $0x20,%esp
+  80706d:	85 c0                	test   %eax,%eax
+  80706f:	78 08                	js     807079 <page_in+0x1d5>
+  807071:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  807074:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  807077:	eb 20                	jmp    807099 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  807079:	50                   	push   %eax
+  80707a:	68 68 8b 80 00       	push   $0x808b68
+  80707f:	68 59 02 00 00       	push   $0x259
+  807084:	68 99 87 80 00       	push   $0x808799
+  807089:	e8 55 c2 ff ff       	call   8032e3 <_panic>
+		*mtes[i] = 0;
+  80708e:	8b 10                	mov    (%eax),%edx
+  807090:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  807096:	83 c0 04             	add    $0x4,%eax
+  807099:	39 c8                	cmp    %ecx,%eax
+  80709b:	75 f1                	jne    80708e <page_in+0x1ea>
+	return n;
+  80709d:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  80709f:	85 f6                	test   %esi,%esi
+  8070a1:	0f 84 4d fe ff ff    	je     806ef4 <page_in+0x50>
+		return r < 0 ? r : 0;
+  8070a7:	85 c0                	test   %eax,%eax
+  8070a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8070ae:	0f 4f c2             	cmovg  %edx,%eax
+  8070b1:	e9 99 fe ff ff       	jmp    806f4f <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  8070b6:	50                   	push   %eax
+  8070b7:	68 a0 8b 80 00       	push   $0x808ba0
+  8070bc:	68 9a 02 00 00       	push   $0x29a
+  8070c1:	68 99 87 80 00       	push   $0x808799
+  8070c6:	e8 18 c2 ff ff       	call   8032e3 <_panic>
+		return -E_PAGING;
+  8070cb:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8070d0:	e9 7a fe ff ff       	jmp    806f4f <page_in+0xab>
+
+008070d5 <page_map>:
+{
+  8070d5:	55                   	push   %ebp
+  8070d6:	89 e5                	mov    %esp,%ebp
+  8070d8:	57                   	push   %edi
+  8070d9:	56                   	push   %esi
+  8070da:	53                   	push   %ebx
+  8070db:	83 ec 1c             	sub    $0x1c,%esp
+  8070de:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8070e1:	83 ec 0c             	sub    $0xc,%esp
+  8070e4:	ff 75 18             	push   0x18(%ebp)
+  8070e7:	ff 75 14             	push   0x14(%ebp)
+  8070ea:	ff 75 10             	push   0x10(%ebp)
+  8070ed:	ff 75 0c             	push   0xc(%ebp)
+  8070f0:	56                   	push   %esi
+  8070f1:	e8 e5 cd ff ff       	call   803edb <sys_page_map>
+  8070f6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8070f9:	83 c4 20             	add    $0x20,%esp
+  8070fc:	85 c0                	test   %eax,%eax
+  8070fe:	0f 89 a9 01 00 00    	jns    8072ad <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  807104:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  807108:	74 5f                	je     807169 <page_map+0x94>
+		if (r != -E_INVAL)
+  80710a:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  80710e:	0f 85 a0 01 00 00    	jne    8072b4 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  807114:	85 f6                	test   %esi,%esi
+  807116:	74 70                	je     807188 <page_map+0xb3>
+  807118:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  80711d:	8b 40 48             	mov    0x48(%eax),%eax
+  807120:	39 f0                	cmp    %esi,%eax
+  807122:	74 64                	je     807188 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  807124:	83 ec 0c             	sub    $0xc,%esp
+  807127:	6a 05                	push   $0x5
+  807129:	68 00 00 40 00       	push   $0x400000
+  80712e:	6a 00                	push   $0x0
+  807130:	68 00 b0 ad de       	push   $0xdeadb000
+  807135:	56                   	push   %esi
+  807136:	e8 a0 cd ff ff       	call   803edb <sys_page_map>
+  80713b:	89 c3                	mov    %eax,%ebx
+  80713d:	83 c4 20             	add    $0x20,%esp
+  807140:	85 c0                	test   %eax,%eax
+  807142:	79 6a                	jns    8071ae <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  807144:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  807147:	75 50                	jne    807199 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  807149:	83 ec 08             	sub    $0x8,%esp
+  80714c:	68 00 00 40 00       	push   $0x400000
+  807151:	6a fc                	push   $0xfffffffc
+  807153:	e8 9c f6 ff ff       	call   8067f4 <page_out>
+  807158:	83 c4 10             	add    $0x10,%esp
+  80715b:	85 c0                	test   %eax,%eax
+  80715d:	79 c5                	jns    807124 <page_map+0x4f>
+}
+  80715f:	89 d8                	mov    %ebx,%eax
+  807161:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807164:	5b                   	pop    %ebx
+  807165:	5e                   	pop    %esi
+  807166:	5f                   	pop    %edi
+  807167:	5d                   	pop    %ebp
+  807168:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  807169:	83 ec 08             	sub    $0x8,%esp
+  80716c:	68 00 00 40 00       	push   $0x400000
+  807171:	6a 00                	push   $0x0
+  807173:	e8 7c f6 ff ff       	call   8067f4 <page_out>
+  807178:	83 c4 10             	add    $0x10,%esp
+  80717b:	85 c0                	test   %eax,%eax
+  80717d:	0f 89 5e ff ff ff    	jns    8070e1 <page_map+0xc>
+				return r;
+  807183:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  807186:	eb d7                	jmp    80715f <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  807188:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80718b:	e8 79 f9 ff ff       	call   806b09 <page_adopt>
+  807190:	85 c0                	test   %eax,%eax
+  807192:	79 90                	jns    807124 <page_map+0x4f>
+			return r;
+  807194:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  807197:	eb c6                	jmp    80715f <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  807199:	53                   	push   %ebx
+  80719a:	68 d4 8b 80 00       	push   $0x808bd4
+  80719f:	68 77 03 00 00       	push   $0x377
+  8071a4:	68 99 87 80 00       	push   $0x808799
+  8071a9:	e8 35 c1 ff ff       	call   8032e3 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  8071ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8071b1:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8071b4:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  8071bb:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8071c1:	0f 84 f5 00 00 00    	je     8072bc <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8071c7:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8071cd:	83 ec 0c             	sub    $0xc,%esp
+  8071d0:	6a 05                	push   $0x5
+  8071d2:	68 00 00 40 00       	push   $0x400000
+  8071d7:	6a 00                	push   $0x0
+  8071d9:	57                   	push   %edi
+  8071da:	56                   	push   %esi
+  8071db:	e8 fb cc ff ff       	call   803edb <sys_page_map>
+  8071e0:	89 c3                	mov    %eax,%ebx
+  8071e2:	83 c4 20             	add    $0x20,%esp
+  8071e5:	85 c0                	test   %eax,%eax
+  8071e7:	79 35                	jns    80721e <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  8071e9:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8071ec:	75 1b                	jne    807209 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8071ee:	83 ec 08             	sub    $0x8,%esp
+  8071f1:	68 00 00 40 00       	push   $0x400000
+  8071f6:	6a 00                	push   $0x0
+  8071f8:	e8 f7 f5 ff ff       	call   8067f4 <page_out>
+  8071fd:	83 c4 10             	add    $0x10,%esp
+  807200:	85 c0                	test   %eax,%eax
+  807202:	79 c9                	jns    8071cd <page_map+0xf8>
+  807204:	e9 56 ff ff ff       	jmp    80715f <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  807209:	53                   	push   %ebx
+  80720a:	68 fc 8b 80 00       	push   $0x808bfc
+  80720f:	68 83 03 00 00       	push   $0x383
+  807214:	68 99 87 80 00       	push   $0x808799
+  807219:	e8 c5 c0 ff ff       	call   8032e3 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  80721e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  807221:	c1 e8 0c             	shr    $0xc,%eax
+  807224:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  807229:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  807230:	01 
+  807231:	0f 84 8d 00 00 00    	je     8072c4 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  807237:	83 ec 08             	sub    $0x8,%esp
+  80723a:	68 00 00 40 00       	push   $0x400000
+  80723f:	6a 00                	push   $0x0
+  807241:	e8 d7 cc ff ff       	call   803f1d <sys_page_unmap>
+  807246:	83 c4 10             	add    $0x10,%esp
+  807249:	85 c0                	test   %eax,%eax
+  80724b:	78 36                	js     807283 <page_map+0x1ae>
+  80724d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  807250:	83 ec 08             	sub    $0x8,%esp
+  807253:	57                   	push   %edi
+  807254:	56                   	push   %esi
+  807255:	e8 4a fc ff ff       	call   806ea4 <page_in>
+  80725a:	89 c3                	mov    %eax,%ebx
+  80725c:	83 c4 10             	add    $0x10,%esp
+  80725f:	85 c0                	test   %eax,%eax
+  807261:	0f 89 7a fe ff ff    	jns    8070e1 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  807267:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80726a:	75 2c                	jne    807298 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  80726c:	83 ec 08             	sub    $0x8,%esp
+  80726f:	57                   	push   %edi
+  807270:	6a 00                	push   $0x0
+  807272:	e8 7d f5 ff ff       	call   8067f4 <page_out>
+  807277:	83 c4 10             	add    $0x10,%esp
+  80727a:	85 c0                	test   %eax,%eax
+  80727c:	79 d2                	jns    807250 <page_map+0x17b>
+  80727e:	e9 dc fe ff ff       	jmp    80715f <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  807283:	50                   	push   %eax
+  807284:	68 28 8c 80 00       	push   $0x808c28
+  807289:	68 8b 03 00 00       	push   $0x38b
+  80728e:	68 99 87 80 00       	push   $0x808799
+  807293:	e8 4b c0 ff ff       	call   8032e3 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  807298:	53                   	push   %ebx
+  807299:	68 50 8c 80 00       	push   $0x808c50
+  80729e:	68 91 03 00 00       	push   $0x391
+  8072a3:	68 99 87 80 00       	push   $0x808799
+  8072a8:	e8 36 c0 ff ff       	call   8032e3 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8072ad:	89 c3                	mov    %eax,%ebx
+  8072af:	e9 ab fe ff ff       	jmp    80715f <page_map+0x8a>
+  8072b4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8072b7:	e9 a3 fe ff ff       	jmp    80715f <page_map+0x8a>
+			return r; // Pass through the error
+  8072bc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8072bf:	e9 9b fe ff ff       	jmp    80715f <page_map+0x8a>
+			return r; // Pass through the error
+  8072c4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8072c7:	e9 93 fe ff ff       	jmp    80715f <page_map+0x8a>
+
+008072cc <page_map_range>:
+{
+  8072cc:	55                   	push   %ebp
+  8072cd:	89 e5                	mov    %esp,%ebp
+  8072cf:	57                   	push   %edi
+  8072d0:	56                   	push   %esi
+  8072d1:	53                   	push   %ebx
+  8072d2:	83 ec 0c             	sub    $0xc,%esp
+  8072d5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8072d8:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  8072db:	83 ec 08             	sub    $0x8,%esp
+  8072de:	ff 75 1c             	push   0x1c(%ebp)
+  8072e1:	ff 75 18             	push   0x18(%ebp)
+  8072e4:	56                   	push   %esi
+  8072e5:	ff 75 10             	push   0x10(%ebp)
+  8072e8:	57                   	push   %edi
+  8072e9:	ff 75 08             	push   0x8(%ebp)
+  8072ec:	e8 f5 cc ff ff       	call   803fe6 <sys_page_map_range>
+  8072f1:	89 c3                	mov    %eax,%ebx
+  8072f3:	83 c4 20             	add    $0x20,%esp
+  8072f6:	85 c0                	test   %eax,%eax
+  8072f8:	79 1b                	jns    807315 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  8072fa:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8072fd:	75 20                	jne    80731f <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8072ff:	83 ec 08             	sub    $0x8,%esp
+  807302:	68 00 00 40 00       	push   $0x400000
+  807307:	6a 00                	push   $0x0
+  807309:	e8 e6 f4 ff ff       	call   8067f4 <page_out>
+  80730e:	83 c4 10             	add    $0x10,%esp
+  807311:	85 c0                	test   %eax,%eax
+  807313:	79 c6                	jns    8072db <page_map_range+0xf>
+}
+  807315:	89 d8                	mov    %ebx,%eax
+  807317:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80731a:	5b                   	pop    %ebx
+  80731b:	5e                   	pop    %esi
+  80731c:	5f                   	pop    %edi
+  80731d:	5d                   	pop    %ebp
+  80731e:	c3                   	ret
+		if (r != -E_INVAL)
+  80731f:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  807322:	75 f1                	jne    807315 <page_map_range+0x49>
+  807324:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  807326:	be 00 00 00 00       	mov    $0x0,%esi
+  80732b:	eb 03                	jmp    807330 <page_map_range+0x64>
+  80732d:	83 c6 01             	add    $0x1,%esi
+  807330:	3b 75 18             	cmp    0x18(%ebp),%esi
+  807333:	74 2a                	je     80735f <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  807335:	83 ec 0c             	sub    $0xc,%esp
+  807338:	ff 75 1c             	push   0x1c(%ebp)
+  80733b:	53                   	push   %ebx
+  80733c:	ff 75 10             	push   0x10(%ebp)
+  80733f:	57                   	push   %edi
+  807340:	ff 75 08             	push   0x8(%ebp)
+  807343:	e8 8d fd ff ff       	call   8070d5 <page_map>
+  807348:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80734e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  807354:	83 c4 20             	add    $0x20,%esp
+  807357:	85 c0                	test   %eax,%eax
+  807359:	79 d2                	jns    80732d <page_map_range+0x61>
+  80735b:	89 c3                	mov    %eax,%ebx
+  80735d:	eb b6                	jmp    807315 <page_map_range+0x49>
+		return 0;
+  80735f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  807364:	eb af                	jmp    807315 <page_map_range+0x49>
+
+00807366 <paging_pgfault_handler>:
+{
+  807366:	55                   	push   %ebp
+  807367:	89 e5                	mov    %esp,%ebp
+  807369:	56                   	push   %esi
+  80736a:	53                   	push   %ebx
+  80736b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  80736e:	e8 6f e7 ff ff       	call   805ae2 <find_paging_env>
+	if (pagingenv == 0)
+  807373:	a1 40 70 85 00       	mov    0x857040,%eax
+  807378:	85 c0                	test   %eax,%eax
+  80737a:	74 3c                	je     8073b8 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  80737c:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  80737e:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  807382:	75 12                	jne    807396 <paging_pgfault_handler+0x30>
+  807384:	89 f0                	mov    %esi,%eax
+  807386:	e8 7e f7 ff ff       	call   806b09 <page_adopt>
+  80738b:	89 c2                	mov    %eax,%edx
+		return 0;
+  80738d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  807392:	85 d2                	test   %edx,%edx
+  807394:	78 22                	js     8073b8 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  807396:	83 ec 08             	sub    $0x8,%esp
+  807399:	6a 00                	push   $0x0
+  80739b:	56                   	push   %esi
+  80739c:	e8 a9 f3 ff ff       	call   80674a <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  8073a1:	83 c4 10             	add    $0x10,%esp
+  8073a4:	85 c0                	test   %eax,%eax
+  8073a6:	74 05                	je     8073ad <paging_pgfault_handler+0x47>
+  8073a8:	f6 00 01             	testb  $0x1,(%eax)
+  8073ab:	75 12                	jne    8073bf <paging_pgfault_handler+0x59>
+	return 0;
+  8073ad:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8073b2:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8073b6:	74 23                	je     8073db <paging_pgfault_handler+0x75>
+}
+  8073b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8073bb:	5b                   	pop    %ebx
+  8073bc:	5e                   	pop    %esi
+  8073bd:	5d                   	pop    %ebp
+  8073be:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  8073bf:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  8073c4:	8b 40 48             	mov    0x48(%eax),%eax
+  8073c7:	83 ec 08             	sub    $0x8,%esp
+  8073ca:	56                   	push   %esi
+  8073cb:	50                   	push   %eax
+  8073cc:	e8 d3 fa ff ff       	call   806ea4 <page_in>
+  8073d1:	f7 d0                	not    %eax
+  8073d3:	c1 e8 1f             	shr    $0x1f,%eax
+  8073d6:	83 c4 10             	add    $0x10,%esp
+  8073d9:	eb dd                	jmp    8073b8 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8073db:	89 f0                	mov    %esi,%eax
+  8073dd:	e8 97 e2 ff ff       	call   805679 <segment_lookup>
+  8073e2:	89 c2                	mov    %eax,%edx
+	return 0;
+  8073e4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8073e9:	85 d2                	test   %edx,%edx
+  8073eb:	74 cb                	je     8073b8 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  8073ed:	a1 3c a9 85 00       	mov    0x85a93c,%eax
+  8073f2:	8b 40 48             	mov    0x48(%eax),%eax
+  8073f5:	83 ec 08             	sub    $0x8,%esp
+  8073f8:	56                   	push   %esi
+  8073f9:	50                   	push   %eax
+  8073fa:	e8 f5 f3 ff ff       	call   8067f4 <page_out>
+  8073ff:	f7 d0                	not    %eax
+  807401:	c1 e8 1f             	shr    $0x1f,%eax
+  807404:	83 c4 10             	add    $0x10,%esp
+  807407:	eb af                	jmp    8073b8 <paging_pgfault_handler+0x52>
+
+00807409 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  807409:	55                   	push   %ebp
+  80740a:	89 e5                	mov    %esp,%ebp
+  80740c:	57                   	push   %edi
+  80740d:	56                   	push   %esi
+  80740e:	53                   	push   %ebx
+  80740f:	83 ec 2c             	sub    $0x2c,%esp
+  807412:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  807415:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  80741a:	89 c1                	mov    %eax,%ecx
+  80741c:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  80741f:	c1 e8 11             	shr    $0x11,%eax
+  807422:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  807425:	8b 3c 85 80 8c 85 00 	mov    0x858c80(,%eax,4),%edi
+  80742c:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  80742f:	b8 01 00 00 00       	mov    $0x1,%eax
+  807434:	d3 e0                	shl    %cl,%eax
+  807436:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  807439:	85 c7                	test   %eax,%edi
+  80743b:	74 12                	je     80744f <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  80743d:	bb 01 00 00 00       	mov    $0x1,%ebx
+  807442:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  807445:	bf 01 00 00 00       	mov    $0x1,%edi
+  80744a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80744d:	eb 17                	jmp    807466 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  80744f:	ff 75 e0             	push   -0x20(%ebp)
+  807452:	68 88 8c 80 00       	push   $0x808c88
+  807457:	6a 48                	push   $0x48
+  807459:	68 a2 8c 80 00       	push   $0x808ca2
+  80745e:	e8 80 be ff ff       	call   8032e3 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  807463:	83 c3 01             	add    $0x1,%ebx
+  807466:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  807469:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  80746c:	89 c8                	mov    %ecx,%eax
+  80746e:	c1 e8 05             	shr    $0x5,%eax
+  807471:	8b 14 85 80 7e 85 00 	mov    0x857e80(,%eax,4),%edx
+  807478:	89 fe                	mov    %edi,%esi
+  80747a:	d3 e6                	shl    %cl,%esi
+  80747c:	89 f1                	mov    %esi,%ecx
+  80747e:	85 d6                	test   %edx,%esi
+  807480:	74 e1                	je     807463 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  807482:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  807485:	f7 d6                	not    %esi
+  807487:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80748a:	21 fe                	and    %edi,%esi
+  80748c:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80748f:	89 34 bd 80 8c 85 00 	mov    %esi,0x858c80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  807496:	f7 d1                	not    %ecx
+  807498:	21 d1                	and    %edx,%ecx
+  80749a:	89 0c 85 80 7e 85 00 	mov    %ecx,0x857e80(,%eax,4)
+	page_unmap_range(0, va, n);
+  8074a1:	83 ec 04             	sub    $0x4,%esp
+  8074a4:	53                   	push   %ebx
+  8074a5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8074a8:	57                   	push   %edi
+  8074a9:	6a 00                	push   $0x0
+  8074ab:	e8 97 f8 ff ff       	call   806d47 <page_unmap_range>
+	va_free(va, n);
+  8074b0:	83 c4 08             	add    $0x8,%esp
+  8074b3:	53                   	push   %ebx
+  8074b4:	57                   	push   %edi
+  8074b5:	e8 ed 05 00 00       	call   807aa7 <va_free>
+}
+  8074ba:	83 c4 10             	add    $0x10,%esp
+  8074bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8074c0:	5b                   	pop    %ebx
+  8074c1:	5e                   	pop    %esi
+  8074c2:	5f                   	pop    %edi
+  8074c3:	5d                   	pop    %ebp
+  8074c4:	c3                   	ret
+
+008074c5 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  8074c5:	55                   	push   %ebp
+  8074c6:	89 e5                	mov    %esp,%ebp
+  8074c8:	57                   	push   %edi
+  8074c9:	56                   	push   %esi
+  8074ca:	53                   	push   %ebx
+  8074cb:	83 ec 1c             	sub    $0x1c,%esp
+  8074ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  8074d1:	85 db                	test   %ebx,%ebx
+  8074d3:	74 34                	je     807509 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  8074d5:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8074db:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  8074e0:	77 2f                	ja     807511 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  8074e2:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8074e8:	75 51                	jne    80753b <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  8074ea:	89 c1                	mov    %eax,%ecx
+  8074ec:	c1 e9 0c             	shr    $0xc,%ecx
+  8074ef:	ba 01 00 00 00       	mov    $0x1,%edx
+  8074f4:	d3 e2                	shl    %cl,%edx
+  8074f6:	c1 e8 11             	shr    $0x11,%eax
+  8074f9:	23 14 85 80 70 85 00 	and    0x857080(,%eax,4),%edx
+  807500:	75 24                	jne    807526 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  807502:	89 d8                	mov    %ebx,%eax
+  807504:	e8 00 ff ff ff       	call   807409 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  807509:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80750c:	5b                   	pop    %ebx
+  80750d:	5e                   	pop    %esi
+  80750e:	5f                   	pop    %edi
+  80750f:	5d                   	pop    %ebp
+  807510:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  807511:	53                   	push   %ebx
+  807512:	68 af 8c 80 00       	push   $0x808caf
+  807517:	68 a2 00 00 00       	push   $0xa2
+  80751c:	68 a2 8c 80 00       	push   $0x808ca2
+  807521:	e8 bd bd ff ff       	call   8032e3 <_panic>
+			panic("free: %p is not allocated", va);
+  807526:	53                   	push   %ebx
+  807527:	68 88 8c 80 00       	push   $0x808c88
+  80752c:	68 a5 00 00 00       	push   $0xa5
+  807531:	68 a2 8c 80 00       	push   $0x808ca2
+  807536:	e8 a8 bd ff ff       	call   8032e3 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  80753b:	89 de                	mov    %ebx,%esi
+  80753d:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  807543:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  807549:	89 c8                	mov    %ecx,%eax
+  80754b:	c1 e8 11             	shr    $0x11,%eax
+  80754e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  807551:	8b 3c 85 80 70 85 00 	mov    0x857080(,%eax,4),%edi
+  807558:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  80755b:	c1 e9 0c             	shr    $0xc,%ecx
+  80755e:	b8 01 00 00 00       	mov    $0x1,%eax
+  807563:	d3 e0                	shl    %cl,%eax
+  807565:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  807568:	85 c7                	test   %eax,%edi
+  80756a:	74 1b                	je     807587 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  80756c:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  807570:	89 d8                	mov    %ebx,%eax
+  807572:	29 f0                	sub    %esi,%eax
+  807574:	83 e8 10             	sub    $0x10,%eax
+  807577:	99                   	cltd
+  807578:	f7 ff                	idiv   %edi
+  80757a:	89 d1                	mov    %edx,%ecx
+  80757c:	85 d2                	test   %edx,%edx
+  80757e:	75 07                	jne    807587 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  807580:	ba 10 00 00 00       	mov    $0x10,%edx
+  807585:	eb 18                	jmp    80759f <free+0xda>
+		panic("free: %p is not allocated", va);
+  807587:	53                   	push   %ebx
+  807588:	68 88 8c 80 00       	push   $0x808c88
+  80758d:	68 ad 00 00 00       	push   $0xad
+  807592:	68 a2 8c 80 00       	push   $0x808ca2
+  807597:	e8 47 bd ff ff       	call   8032e3 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80759c:	83 c1 01             	add    $0x1,%ecx
+  80759f:	89 d0                	mov    %edx,%eax
+  8075a1:	d3 e0                	shl    %cl,%eax
+  8075a3:	39 c7                	cmp    %eax,%edi
+  8075a5:	7f f5                	jg     80759c <free+0xd7>
+	*(void **) va = s->free;
+  8075a7:	8b 46 08             	mov    0x8(%esi),%eax
+  8075aa:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  8075ac:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  8075af:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  8075b3:	8d 58 01             	lea    0x1(%eax),%ebx
+  8075b6:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  8075ba:	66 85 c0             	test   %ax,%ax
+  8075bd:	74 52                	je     807611 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8075bf:	0f b7 db             	movzwl %bx,%ebx
+  8075c2:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8075c6:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8075cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8075d0:	f7 ff                	idiv   %edi
+  8075d2:	39 c3                	cmp    %eax,%ebx
+  8075d4:	0f 85 2f ff ff ff    	jne    807509 <free+0x44>
+  8075da:	8b 46 04             	mov    0x4(%esi),%eax
+  8075dd:	85 c0                	test   %eax,%eax
+  8075df:	74 53                	je     807634 <free+0x16f>
+		s->prev->next = s->next;
+  8075e1:	8b 16                	mov    (%esi),%edx
+  8075e3:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8075e5:	8b 06                	mov    (%esi),%eax
+  8075e7:	85 c0                	test   %eax,%eax
+  8075e9:	74 06                	je     8075f1 <free+0x12c>
+		s->next->prev = s->prev;
+  8075eb:	8b 56 04             	mov    0x4(%esi),%edx
+  8075ee:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8075f1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8075f4:	f7 d0                	not    %eax
+  8075f6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8075f9:	21 d0                	and    %edx,%eax
+  8075fb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8075fe:	89 04 95 80 70 85 00 	mov    %eax,0x857080(,%edx,4)
+		heap_free_pages(s);
+  807605:	89 f0                	mov    %esi,%eax
+  807607:	e8 fd fd ff ff       	call   807409 <heap_free_pages>
+  80760c:	e9 f8 fe ff ff       	jmp    807509 <free+0x44>
+	s->prev = NULL;
+  807611:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  807618:	8b 04 8d 60 70 85 00 	mov    0x857060(,%ecx,4),%eax
+  80761f:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  807621:	85 c0                	test   %eax,%eax
+  807623:	74 03                	je     807628 <free+0x163>
+		slabs[c]->prev = s;
+  807625:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  807628:	89 34 8d 60 70 85 00 	mov    %esi,0x857060(,%ecx,4)
+}
+  80762f:	e9 d5 fe ff ff       	jmp    807509 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  807634:	8b 06                	mov    (%esi),%eax
+  807636:	85 c0                	test   %eax,%eax
+  807638:	0f 84 cb fe ff ff    	je     807509 <free+0x44>
+		slabs[c] = s->next;
+  80763e:	89 04 8d 60 70 85 00 	mov    %eax,0x857060(,%ecx,4)
+	if (s->next)
+  807645:	8b 06                	mov    (%esi),%eax
+  807647:	eb a2                	jmp    8075eb <free+0x126>
+
+00807649 <heap_alloc_pages>:
+{
+  807649:	55                   	push   %ebp
+  80764a:	89 e5                	mov    %esp,%ebp
+  80764c:	57                   	push   %edi
+  80764d:	56                   	push   %esi
+  80764e:	53                   	push   %ebx
+  80764f:	83 ec 18             	sub    $0x18,%esp
+  807652:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  807654:	50                   	push   %eax
+  807655:	e8 15 03 00 00       	call   80796f <va_alloc>
+  80765a:	89 c3                	mov    %eax,%ebx
+  80765c:	83 c4 10             	add    $0x10,%esp
+  80765f:	85 c0                	test   %eax,%eax
+  807661:	74 47                	je     8076aa <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  807663:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  807669:	89 c1                	mov    %eax,%ecx
+  80766b:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  80766e:	c1 e8 11             	shr    $0x11,%eax
+  807671:	ba 01 00 00 00       	mov    $0x1,%edx
+  807676:	89 d7                	mov    %edx,%edi
+  807678:	d3 e7                	shl    %cl,%edi
+  80767a:	09 3c 85 80 8c 85 00 	or     %edi,0x858c80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  807681:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  807685:	89 c8                	mov    %ecx,%eax
+  807687:	c1 e8 05             	shr    $0x5,%eax
+  80768a:	d3 e2                	shl    %cl,%edx
+  80768c:	09 14 85 80 7e 85 00 	or     %edx,0x857e80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  807693:	83 ec 0c             	sub    $0xc,%esp
+  807696:	6a 00                	push   $0x0
+  807698:	6a 07                	push   $0x7
+  80769a:	56                   	push   %esi
+  80769b:	53                   	push   %ebx
+  80769c:	6a 00                	push   $0x0
+  80769e:	e8 3a f7 ff ff       	call   806ddd <page_alloc_range>
+  8076a3:	83 c4 20             	add    $0x20,%esp
+  8076a6:	85 c0                	test   %eax,%eax
+  8076a8:	78 0a                	js     8076b4 <heap_alloc_pages+0x6b>
+}
+  8076aa:	89 d8                	mov    %ebx,%eax
+  8076ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8076af:	5b                   	pop    %ebx
+  8076b0:	5e                   	pop    %esi
+  8076b1:	5f                   	pop    %edi
+  8076b2:	5d                   	pop    %ebp
+  8076b3:	c3                   	ret
+		free(va);
+  8076b4:	83 ec 0c             	sub    $0xc,%esp
+  8076b7:	53                   	push   %ebx
+  8076b8:	e8 08 fe ff ff       	call   8074c5 <free>
+		return NULL;
+  8076bd:	83 c4 10             	add    $0x10,%esp
+  8076c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8076c5:	eb e3                	jmp    8076aa <heap_alloc_pages+0x61>
+
+008076c7 <malloc>:
+{
+  8076c7:	55                   	push   %ebp
+  8076c8:	89 e5                	mov    %esp,%ebp
+  8076ca:	57                   	push   %edi
+  8076cb:	56                   	push   %esi
+  8076cc:	53                   	push   %ebx
+  8076cd:	83 ec 1c             	sub    $0x1c,%esp
+  8076d0:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  8076d3:	8d 50 ff             	lea    -0x1(%eax),%edx
+  8076d6:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  8076dc:	0f 87 21 01 00 00    	ja     807803 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8076e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8076e7:	ba 10 00 00 00       	mov    $0x10,%edx
+  8076ec:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  8076ee:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8076f3:	76 15                	jbe    80770a <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  8076f5:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8076fa:	c1 e8 0c             	shr    $0xc,%eax
+  8076fd:	e8 47 ff ff ff       	call   807649 <heap_alloc_pages>
+  807702:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  807705:	eb 37                	jmp    80773e <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  807707:	83 c1 01             	add    $0x1,%ecx
+  80770a:	89 d6                	mov    %edx,%esi
+  80770c:	d3 e6                	shl    %cl,%esi
+  80770e:	39 c6                	cmp    %eax,%esi
+  807710:	72 f5                	jb     807707 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  807712:	89 cb                	mov    %ecx,%ebx
+  807714:	8b 3c 8d 60 70 85 00 	mov    0x857060(,%ecx,4),%edi
+  80771b:	85 ff                	test   %edi,%edi
+  80771d:	74 2a                	je     807749 <malloc+0x82>
+	v = s->free;
+  80771f:	8b 47 08             	mov    0x8(%edi),%eax
+  807722:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  807725:	8b 00                	mov    (%eax),%eax
+  807727:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  80772a:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  80772e:	83 e8 01             	sub    $0x1,%eax
+  807731:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  807735:	66 85 c0             	test   %ax,%ax
+  807738:	0f 84 9a 00 00 00    	je     8077d8 <malloc+0x111>
+}
+  80773e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  807741:	83 c4 1c             	add    $0x1c,%esp
+  807744:	5b                   	pop    %ebx
+  807745:	5e                   	pop    %esi
+  807746:	5f                   	pop    %edi
+  807747:	5d                   	pop    %ebp
+  807748:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  807749:	b8 01 00 00 00       	mov    $0x1,%eax
+  80774e:	e8 f6 fe ff ff       	call   807649 <heap_alloc_pages>
+  807753:	89 c1                	mov    %eax,%ecx
+  807755:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  807758:	85 c0                	test   %eax,%eax
+  80775a:	74 e2                	je     80773e <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  80775c:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  807762:	89 c8                	mov    %ecx,%eax
+  807764:	c1 e8 11             	shr    $0x11,%eax
+  807767:	c1 e9 0c             	shr    $0xc,%ecx
+  80776a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80776f:	d3 e2                	shl    %cl,%edx
+  807771:	09 14 85 80 70 85 00 	or     %edx,0x857080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  807778:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80777b:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  80777f:	0f b7 f6             	movzwl %si,%esi
+  807782:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  807787:	ba 00 00 00 00       	mov    $0x0,%edx
+  80778c:	f7 fe                	idiv   %esi
+  80778e:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  807792:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  807795:	85 c0                	test   %eax,%eax
+  807797:	74 14                	je     8077ad <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  807799:	83 e8 01             	sub    $0x1,%eax
+  80779c:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  8077a0:	0f af d0             	imul   %eax,%edx
+  8077a3:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  8077a7:	89 3a                	mov    %edi,(%edx)
+  8077a9:	89 d7                	mov    %edx,%edi
+  8077ab:	eb e5                	jmp    807792 <malloc+0xcb>
+	s->prev = NULL;
+  8077ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8077b0:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  8077b7:	8b 04 9d 60 70 85 00 	mov    0x857060(,%ebx,4),%eax
+  8077be:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  8077c0:	85 c0                	test   %eax,%eax
+  8077c2:	74 03                	je     8077c7 <malloc+0x100>
+		slabs[c]->prev = s;
+  8077c4:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  8077c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8077ca:	89 04 9d 60 70 85 00 	mov    %eax,0x857060(,%ebx,4)
+	return s;
+  8077d1:	89 c7                	mov    %eax,%edi
+  8077d3:	e9 47 ff ff ff       	jmp    80771f <malloc+0x58>
+	if (s->prev)
+  8077d8:	8b 47 04             	mov    0x4(%edi),%eax
+  8077db:	85 c0                	test   %eax,%eax
+  8077dd:	74 19                	je     8077f8 <malloc+0x131>
+		s->prev->next = s->next;
+  8077df:	8b 17                	mov    (%edi),%edx
+  8077e1:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8077e3:	8b 07                	mov    (%edi),%eax
+  8077e5:	85 c0                	test   %eax,%eax
+  8077e7:	0f 84 51 ff ff ff    	je     80773e <malloc+0x77>
+		s->next->prev = s->prev;
+  8077ed:	8b 57 04             	mov    0x4(%edi),%edx
+  8077f0:	89 50 04             	mov    %edx,0x4(%eax)
+  8077f3:	e9 46 ff ff ff       	jmp    80773e <malloc+0x77>
+		slabs[c] = s->next;
+  8077f8:	8b 07                	mov    (%edi),%eax
+  8077fa:	89 04 9d 60 70 85 00 	mov    %eax,0x857060(,%ebx,4)
+  807801:	eb e0                	jmp    8077e3 <malloc+0x11c>
+		return NULL;
+  807803:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80780a:	e9 2f ff ff ff       	jmp    80773e <malloc+0x77>
+
+0080780f <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  80780f:	55                   	push   %ebp
+  807810:	89 e5                	mov    %esp,%ebp
+  807812:	57                   	push   %edi
+  807813:	56                   	push   %esi
+  807814:	53                   	push   %ebx
+  807815:	83 ec 0c             	sub    $0xc,%esp
+  807818:	89 c6                	mov    %eax,%esi
+  80781a:	89 d7                	mov    %edx,%edi
+  80781c:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  80781f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  807824:	ba 00 00 00 00       	mov    $0x0,%edx
+  807829:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  80782e:	83 ef 01             	sub    $0x1,%edi
+  807831:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  807834:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  807837:	eb 34                	jmp    80786d <va_chunk_scan+0x5e>
+			i += 31;
+  807839:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  80783c:	89 ca                	mov    %ecx,%edx
+			continue;
+  80783e:	eb 23                	jmp    807863 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  807840:	89 c7                	mov    %eax,%edi
+  807842:	c1 ef 05             	shr    $0x5,%edi
+  807845:	be 01 00 00 00       	mov    $0x1,%esi
+  80784a:	d3 e6                	shl    %cl,%esi
+  80784c:	89 f1                	mov    %esi,%ecx
+  80784e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  807851:	23 0c be             	and    (%esi,%edi,4),%ecx
+  807854:	75 41                	jne    807897 <va_chunk_scan+0x88>
+			len++;
+  807856:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  807859:	39 d3                	cmp    %edx,%ebx
+  80785b:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  80785e:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  807861:	72 2d                	jb     807890 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  807863:	83 c0 01             	add    $0x1,%eax
+  807866:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80786b:	77 31                	ja     80789e <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  80786d:	89 c1                	mov    %eax,%ecx
+  80786f:	83 e1 1f             	and    $0x1f,%ecx
+  807872:	75 cc                	jne    807840 <va_chunk_scan+0x31>
+  807874:	89 c7                	mov    %eax,%edi
+  807876:	c1 ef 05             	shr    $0x5,%edi
+  807879:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80787c:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  80787f:	83 ff ff             	cmp    $0xffffffff,%edi
+  807882:	74 b5                	je     807839 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  807884:	85 ff                	test   %edi,%edi
+  807886:	75 b8                	jne    807840 <va_chunk_scan+0x31>
+			i += 31;
+  807888:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  80788b:	83 c2 20             	add    $0x20,%edx
+  80788e:	eb c9                	jmp    807859 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  807890:	83 c0 01             	add    $0x1,%eax
+  807893:	29 d0                	sub    %edx,%eax
+  807895:	eb 15                	jmp    8078ac <va_chunk_scan+0x9d>
+			len = 0;
+  807897:	ba 00 00 00 00       	mov    $0x0,%edx
+  80789c:	eb c5                	jmp    807863 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  80789e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  8078a3:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  8078a6:	85 d2                	test   %edx,%edx
+  8078a8:	74 02                	je     8078ac <va_chunk_scan+0x9d>
+		*run_store = best;
+  8078aa:	89 1a                	mov    %ebx,(%edx)
+}
+  8078ac:	83 c4 0c             	add    $0xc,%esp
+  8078af:	5b                   	pop    %ebx
+  8078b0:	5e                   	pop    %esi
+  8078b1:	5f                   	pop    %edi
+  8078b2:	5d                   	pop    %ebp
+  8078b3:	c3                   	ret
+
+008078b4 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  8078b4:	55                   	push   %ebp
+  8078b5:	89 e5                	mov    %esp,%ebp
+  8078b7:	57                   	push   %edi
+  8078b8:	56                   	push   %esi
+  8078b9:	53                   	push   %ebx
+  8078ba:	83 ec 14             	sub    $0x14,%esp
+  8078bd:	89 c3                	mov    %eax,%ebx
+  8078bf:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  8078c1:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  8078c7:	8d ba a0 9a 85 00    	lea    0x859aa0(%edx),%edi
+  8078cd:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  8078d0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  8078d3:	89 d6                	mov    %edx,%esi
+  8078d5:	81 c6 a0 9a 85 00    	add    $0x859aa0,%esi
+  8078db:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  8078dd:	eb 34                	jmp    807913 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  8078df:	89 c8                	mov    %ecx,%eax
+  8078e1:	c1 e8 05             	shr    $0x5,%eax
+  8078e4:	89 da                	mov    %ebx,%edx
+  8078e6:	c1 e2 05             	shl    $0x5,%edx
+  8078e9:	01 da                	add    %ebx,%edx
+  8078eb:	01 c2                	add    %eax,%edx
+  8078ed:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8078f2:	d3 c0                	rol    %cl,%eax
+  8078f4:	21 04 95 a0 9a 85 00 	and    %eax,0x859aa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  8078fb:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  807902:	b8 01 00 00 00       	mov    $0x1,%eax
+  807907:	01 d0                	add    %edx,%eax
+  807909:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  807910:	83 c1 01             	add    $0x1,%ecx
+  807913:	39 f9                	cmp    %edi,%ecx
+  807915:	74 30                	je     807947 <va_chunk_mark+0x93>
+		if (alloc)
+  807917:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80791b:	74 c2                	je     8078df <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  80791d:	89 c8                	mov    %ecx,%eax
+  80791f:	c1 e8 05             	shr    $0x5,%eax
+  807922:	89 da                	mov    %ebx,%edx
+  807924:	c1 e2 05             	shl    $0x5,%edx
+  807927:	01 da                	add    %ebx,%edx
+  807929:	01 c2                	add    %eax,%edx
+  80792b:	b8 01 00 00 00       	mov    $0x1,%eax
+  807930:	d3 e0                	shl    %cl,%eax
+  807932:	09 04 95 a0 9a 85 00 	or     %eax,0x859aa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  807939:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  807940:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  807945:	eb c0                	jmp    807907 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  807947:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  80794a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80794f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  807952:	e8 b8 fe ff ff       	call   80780f <va_chunk_scan>
+	ch->run = run;
+  807957:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  80795d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  807960:	66 89 83 22 9b 85 00 	mov    %ax,0x859b22(%ebx)
+}
+  807967:	83 c4 14             	add    $0x14,%esp
+  80796a:	5b                   	pop    %ebx
+  80796b:	5e                   	pop    %esi
+  80796c:	5f                   	pop    %edi
+  80796d:	5d                   	pop    %ebp
+  80796e:	c3                   	ret
+
+0080796f <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  80796f:	55                   	push   %ebp
+  807970:	89 e5                	mov    %esp,%ebp
+  807972:	57                   	push   %edi
+  807973:	56                   	push   %esi
+  807974:	53                   	push   %ebx
+  807975:	83 ec 04             	sub    $0x4,%esp
+  807978:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  80797b:	b8 20 9b 85 00       	mov    $0x859b20,%eax
+  807980:	ba 90 a9 85 00       	mov    $0x85a990,%edx
+  807985:	80 3d 80 9a 85 00 00 	cmpb   $0x0,0x859a80
+  80798c:	74 4f                	je     8079dd <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  80798e:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  807991:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  807996:	0f 87 01 01 00 00    	ja     807a9d <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  80799c:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  8079a2:	0f 87 80 00 00 00    	ja     807a28 <va_alloc+0xb9>
+  8079a8:	b8 22 9b 85 00       	mov    $0x859b22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  8079ad:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  8079b2:	0f b7 10             	movzwl (%eax),%edx
+  8079b5:	05 84 00 00 00       	add    $0x84,%eax
+  8079ba:	39 da                	cmp    %ebx,%edx
+  8079bc:	73 2c                	jae    8079ea <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  8079be:	83 c6 01             	add    $0x1,%esi
+  8079c1:	83 fe 1c             	cmp    $0x1c,%esi
+  8079c4:	75 ec                	jne    8079b2 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  8079c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8079cb:	eb 53                	jmp    807a20 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  8079cd:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  8079d3:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  8079d8:	05 84 00 00 00       	add    $0x84,%eax
+  8079dd:	39 d0                	cmp    %edx,%eax
+  8079df:	75 ec                	jne    8079cd <va_alloc+0x5e>
+	va_inited = 1;
+  8079e1:	c6 05 80 9a 85 00 01 	movb   $0x1,0x859a80
+}
+  8079e8:	eb a4                	jmp    80798e <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  8079ea:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  8079f0:	05 a0 9a 85 00       	add    $0x859aa0,%eax
+  8079f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8079fa:	89 da                	mov    %ebx,%edx
+  8079fc:	e8 0e fe ff ff       	call   80780f <va_chunk_scan>
+  807a01:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  807a03:	6a 01                	push   $0x1
+  807a05:	89 d9                	mov    %ebx,%ecx
+  807a07:	89 c2                	mov    %eax,%edx
+  807a09:	89 f0                	mov    %esi,%eax
+  807a0b:	e8 a4 fe ff ff       	call   8078b4 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  807a10:	c1 e6 16             	shl    $0x16,%esi
+  807a13:	c1 e7 0c             	shl    $0xc,%edi
+  807a16:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  807a1d:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  807a20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807a23:	5b                   	pop    %ebx
+  807a24:	5e                   	pop    %esi
+  807a25:	5f                   	pop    %edi
+  807a26:	5d                   	pop    %ebp
+  807a27:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  807a28:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  807a2e:	c1 ee 0a             	shr    $0xa,%esi
+  807a31:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  807a36:	b8 00 00 00 00       	mov    $0x0,%eax
+  807a3b:	eb 0a                	jmp    807a47 <va_alloc+0xd8>
+			first = c + 1;
+  807a3d:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  807a3f:	83 c2 01             	add    $0x1,%edx
+  807a42:	83 fa 1d             	cmp    $0x1d,%edx
+  807a45:	74 4f                	je     807a96 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  807a47:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  807a4d:	66 81 b9 9c 9a 85 00 	cmpw   $0x400,0x859a9c(%ecx)
+  807a54:	00 04 
+  807a56:	75 e5                	jne    807a3d <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  807a58:	89 d1                	mov    %edx,%ecx
+  807a5a:	29 c1                	sub    %eax,%ecx
+  807a5c:	39 f1                	cmp    %esi,%ecx
+  807a5e:	75 df                	jne    807a3f <va_alloc+0xd0>
+  807a60:	89 c7                	mov    %eax,%edi
+  807a62:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  807a65:	be 00 04 00 00       	mov    $0x400,%esi
+  807a6a:	39 f3                	cmp    %esi,%ebx
+  807a6c:	0f 46 f3             	cmovbe %ebx,%esi
+  807a6f:	6a 01                	push   $0x1
+  807a71:	89 f1                	mov    %esi,%ecx
+  807a73:	ba 00 00 00 00       	mov    $0x0,%edx
+  807a78:	89 f8                	mov    %edi,%eax
+  807a7a:	e8 35 fe ff ff       	call   8078b4 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  807a7f:	83 c7 01             	add    $0x1,%edi
+  807a82:	83 c4 04             	add    $0x4,%esp
+  807a85:	29 f3                	sub    %esi,%ebx
+  807a87:	75 dc                	jne    807a65 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  807a89:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  807a8c:	c1 e0 16             	shl    $0x16,%eax
+  807a8f:	05 00 00 00 08       	add    $0x8000000,%eax
+  807a94:	eb 8a                	jmp    807a20 <va_alloc+0xb1>
+	return NULL;
+  807a96:	b8 00 00 00 00       	mov    $0x0,%eax
+  807a9b:	eb 83                	jmp    807a20 <va_alloc+0xb1>
+		return NULL;
+  807a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  807aa2:	e9 79 ff ff ff       	jmp    807a20 <va_alloc+0xb1>
+
+00807aa7 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  807aa7:	55                   	push   %ebp
+  807aa8:	89 e5                	mov    %esp,%ebp
+  807aaa:	57                   	push   %edi
+  807aab:	56                   	push   %esi
+  807aac:	53                   	push   %ebx
+  807aad:	83 ec 0c             	sub    $0xc,%esp
+  807ab0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  807ab3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  807ab6:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  807abc:	76 21                	jbe    807adf <va_free+0x38>
+  807abe:	89 f0                	mov    %esi,%eax
+  807ac0:	c1 e0 0c             	shl    $0xc,%eax
+  807ac3:	01 f8                	add    %edi,%eax
+  807ac5:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  807aca:	77 13                	ja     807adf <va_free+0x38>
+	    || PGOFF(va))
+  807acc:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  807ad2:	75 0b                	jne    807adf <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  807ad4:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  807ada:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  807add:	eb 45                	jmp    807b24 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  807adf:	83 ec 0c             	sub    $0xc,%esp
+  807ae2:	56                   	push   %esi
+  807ae3:	57                   	push   %edi
+  807ae4:	68 cc 8c 80 00       	push   $0x808ccc
+  807ae9:	68 8e 00 00 00       	push   $0x8e
+  807aee:	68 ec 8c 80 00       	push   $0x808cec
+  807af3:	e8 eb b7 ff ff       	call   8032e3 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  807af8:	89 fa                	mov    %edi,%edx
+  807afa:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  807b00:	bb 00 04 00 00       	mov    $0x400,%ebx
+  807b05:	29 d3                	sub    %edx,%ebx
+  807b07:	39 f3                	cmp    %esi,%ebx
+  807b09:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  807b0c:	89 f8                	mov    %edi,%eax
+  807b0e:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  807b11:	83 ec 0c             	sub    $0xc,%esp
+  807b14:	6a 00                	push   $0x0
+  807b16:	89 d9                	mov    %ebx,%ecx
+  807b18:	e8 97 fd ff ff       	call   8078b4 <va_chunk_mark>
+		i += n;
+  807b1d:	01 df                	add    %ebx,%edi
+		npages -= n;
+  807b1f:	29 de                	sub    %ebx,%esi
+  807b21:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  807b24:	85 f6                	test   %esi,%esi
+  807b26:	75 d0                	jne    807af8 <va_free+0x51>
+	}
+}
+  807b28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807b2b:	5b                   	pop    %ebx
+  807b2c:	5e                   	pop    %esi
+  807b2d:	5f                   	pop    %edi
+  807b2e:	5d                   	pop    %ebp
+  807b2f:	c3                   	ret
+
+00807b30 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  807b30:	b8 00 00 00 00       	mov    $0x0,%eax
+  807b35:	c3                   	ret
+
+00807b36 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  807b36:	55                   	push   %ebp
+  807b37:	89 e5                	mov    %esp,%ebp
+  807b39:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  807b3c:	68 f9 8c 80 00       	push   $0x808cf9
+  807b41:	ff 75 0c             	push   0xc(%ebp)
+  807b44:	e8 5c be ff ff       	call   8039a5 <strcpy>
+	return 0;
+}
+  807b49:	b8 00 00 00 00       	mov    $0x0,%eax
+  807b4e:	c9                   	leave
+  807b4f:	c3                   	ret
+
+00807b50 <devcons_write>:
+{
+  807b50:	55                   	push   %ebp
+  807b51:	89 e5                	mov    %esp,%ebp
+  807b53:	57                   	push   %edi
+  807b54:	56                   	push   %esi
+  807b55:	53                   	push   %ebx
+  807b56:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  807b5c:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  807b61:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  807b67:	eb 2e                	jmp    807b97 <devcons_write+0x47>
+		m = n - tot;
+  807b69:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  807b6c:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  807b6e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  807b73:	39 c3                	cmp    %eax,%ebx
+  807b75:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  807b78:	83 ec 04             	sub    $0x4,%esp
+  807b7b:	53                   	push   %ebx
+  807b7c:	89 f0                	mov    %esi,%eax
+  807b7e:	03 45 0c             	add    0xc(%ebp),%eax
+  807b81:	50                   	push   %eax
+  807b82:	57                   	push   %edi
+  807b83:	e8 a3 bf ff ff       	call   803b2b <memmove>
+		sys_cputs(buf, m);
+  807b88:	83 c4 08             	add    $0x8,%esp
+  807b8b:	53                   	push   %ebx
+  807b8c:	57                   	push   %edi
+  807b8d:	e8 39 c2 ff ff       	call   803dcb <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  807b92:	01 de                	add    %ebx,%esi
+  807b94:	83 c4 10             	add    $0x10,%esp
+  807b97:	3b 75 10             	cmp    0x10(%ebp),%esi
+  807b9a:	72 cd                	jb     807b69 <devcons_write+0x19>
+}
+  807b9c:	89 f0                	mov    %esi,%eax
+  807b9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807ba1:	5b                   	pop    %ebx
+  807ba2:	5e                   	pop    %esi
+  807ba3:	5f                   	pop    %edi
+  807ba4:	5d                   	pop    %ebp
+  807ba5:	c3                   	ret
+
+00807ba6 <devcons_read>:
+{
+  807ba6:	55                   	push   %ebp
+  807ba7:	89 e5                	mov    %esp,%ebp
+  807ba9:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  807bac:	b8 00 00 00 00       	mov    $0x0,%eax
+  807bb1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  807bb5:	75 07                	jne    807bbe <devcons_read+0x18>
+  807bb7:	eb 1f                	jmp    807bd8 <devcons_read+0x32>
+		sys_yield();
+  807bb9:	e8 bb c2 ff ff       	call   803e79 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  807bbe:	e8 37 c2 ff ff       	call   803dfa <sys_cgetc>
+  807bc3:	85 c0                	test   %eax,%eax
+  807bc5:	74 f2                	je     807bb9 <devcons_read+0x13>
+	if (c < 0)
+  807bc7:	78 0f                	js     807bd8 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  807bc9:	83 f8 04             	cmp    $0x4,%eax
+  807bcc:	74 0c                	je     807bda <devcons_read+0x34>
+	*(char*)vbuf = c;
+  807bce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  807bd1:	88 02                	mov    %al,(%edx)
+	return 1;
+  807bd3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  807bd8:	c9                   	leave
+  807bd9:	c3                   	ret
+		return 0;
+  807bda:	b8 00 00 00 00       	mov    $0x0,%eax
+  807bdf:	eb f7                	jmp    807bd8 <devcons_read+0x32>
+
+00807be1 <cputchar>:
+{
+  807be1:	55                   	push   %ebp
+  807be2:	89 e5                	mov    %esp,%ebp
+  807be4:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  807be7:	8b 45 08             	mov    0x8(%ebp),%eax
+  807bea:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  807bed:	6a 01                	push   $0x1
+  807bef:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  807bf2:	50                   	push   %eax
+  807bf3:	e8 d3 c1 ff ff       	call   803dcb <sys_cputs>
+}
+  807bf8:	83 c4 10             	add    $0x10,%esp
+  807bfb:	c9                   	leave
+  807bfc:	c3                   	ret
+
+00807bfd <getchar>:
+{
+  807bfd:	55                   	push   %ebp
+  807bfe:	89 e5                	mov    %esp,%ebp
+  807c00:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  807c03:	6a 01                	push   $0x1
+  807c05:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  807c08:	50                   	push   %eax
+  807c09:	6a 00                	push   $0x0
+  807c0b:	e8 99 ce ff ff       	call   804aa9 <read>
+	if (r < 0)
+  807c10:	83 c4 10             	add    $0x10,%esp
+  807c13:	85 c0                	test   %eax,%eax
+  807c15:	78 06                	js     807c1d <getchar+0x20>
+	if (r < 1)
+  807c17:	74 06                	je     807c1f <getchar+0x22>
+	return c;
+  807c19:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  807c1d:	c9                   	leave
+  807c1e:	c3                   	ret
+		return -E_EOF;
+  807c1f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  807c24:	eb f7                	jmp    807c1d <getchar+0x20>
+
+00807c26 <iscons>:
+{
+  807c26:	55                   	push   %ebp
+  807c27:	89 e5                	mov    %esp,%ebp
+  807c29:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  807c2c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  807c2f:	50                   	push   %eax
+  807c30:	ff 75 08             	push   0x8(%ebp)
+  807c33:	e8 12 cc ff ff       	call   80484a <fd_lookup>
+  807c38:	83 c4 10             	add    $0x10,%esp
+  807c3b:	85 c0                	test   %eax,%eax
+  807c3d:	78 11                	js     807c50 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  807c3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  807c42:	8b 15 a4 00 81 00    	mov    0x8100a4,%edx
+  807c48:	39 10                	cmp    %edx,(%eax)
+  807c4a:	0f 94 c0             	sete   %al
+  807c4d:	0f b6 c0             	movzbl %al,%eax
+}
+  807c50:	c9                   	leave
+  807c51:	c3                   	ret
+
+00807c52 <opencons>:
+{
+  807c52:	55                   	push   %ebp
+  807c53:	89 e5                	mov    %esp,%ebp
+  807c55:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  807c58:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  807c5b:	50                   	push   %eax
+  807c5c:	e8 95 cb ff ff       	call   8047f6 <fd_alloc>
+  807c61:	83 c4 10             	add    $0x10,%esp
+  807c64:	85 c0                	test   %eax,%eax
+  807c66:	78 3a                	js     807ca2 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  807c68:	83 ec 04             	sub    $0x4,%esp
+  807c6b:	68 07 04 00 00       	push   $0x407
+  807c70:	ff 75 f4             	push   -0xc(%ebp)
+  807c73:	6a 00                	push   $0x0
+  807c75:	e8 1e c2 ff ff       	call   803e98 <sys_page_alloc>
+  807c7a:	83 c4 10             	add    $0x10,%esp
+  807c7d:	85 c0                	test   %eax,%eax
+  807c7f:	78 21                	js     807ca2 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  807c81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  807c84:	8b 15 a4 00 81 00    	mov    0x8100a4,%edx
+  807c8a:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  807c8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  807c8f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  807c96:	83 ec 0c             	sub    $0xc,%esp
+  807c99:	50                   	push   %eax
+  807c9a:	e8 30 cb ff ff       	call   8047cf <fd2num>
+  807c9f:	83 c4 10             	add    $0x10,%esp
+}
+  807ca2:	c9                   	leave
+  807ca3:	c3                   	ret
+
+00807ca4 <udivmod>:
+  807ca4:	55                   	push   %ebp
+  807ca5:	57                   	push   %edi
+  807ca6:	56                   	push   %esi
+  807ca7:	53                   	push   %ebx
+  807ca8:	83 ec 24             	sub    $0x24,%esp
+  807cab:	89 44 24 08          	mov    %eax,0x8(%esp)
+  807caf:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  807cb3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  807cb7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  807cbb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  807cbf:	89 54 24 14          	mov    %edx,0x14(%esp)
+  807cc3:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  807cc7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  807ccc:	b8 00 00 00 00       	mov    $0x0,%eax
+  807cd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  807cd6:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  807cdd:	00 
+  807cde:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  807ce5:	00 
+  807ce6:	89 fb                	mov    %edi,%ebx
+  807ce8:	eb 08                	jmp    807cf2 <udivmod+0x4e>
+  807cea:	83 e9 01             	sub    $0x1,%ecx
+  807ced:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  807cf0:	74 68                	je     807d5a <udivmod+0xb6>
+  807cf2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  807cf6:	01 c0                	add    %eax,%eax
+  807cf8:	89 c6                	mov    %eax,%esi
+  807cfa:	89 d7                	mov    %edx,%edi
+  807cfc:	8b 44 24 08          	mov    0x8(%esp),%eax
+  807d00:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  807d04:	0f ad d0             	shrd   %cl,%edx,%eax
+  807d07:	d3 ea                	shr    %cl,%edx
+  807d09:	f6 c1 20             	test   $0x20,%cl
+  807d0c:	74 04                	je     807d12 <udivmod+0x6e>
+  807d0e:	89 d0                	mov    %edx,%eax
+  807d10:	31 d2                	xor    %edx,%edx
+  807d12:	83 e0 01             	and    $0x1,%eax
+  807d15:	89 04 24             	mov    %eax,(%esp)
+  807d18:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  807d1f:	00 
+  807d20:	8b 04 24             	mov    (%esp),%eax
+  807d23:	8b 54 24 04          	mov    0x4(%esp),%edx
+  807d27:	09 f0                	or     %esi,%eax
+  807d29:	09 fa                	or     %edi,%edx
+  807d2b:	8b 74 24 10          	mov    0x10(%esp),%esi
+  807d2f:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  807d33:	39 f0                	cmp    %esi,%eax
+  807d35:	89 d5                	mov    %edx,%ebp
+  807d37:	19 fd                	sbb    %edi,%ebp
+  807d39:	72 af                	jb     807cea <udivmod+0x46>
+  807d3b:	29 f0                	sub    %esi,%eax
+  807d3d:	19 fa                	sbb    %edi,%edx
+  807d3f:	89 cf                	mov    %ecx,%edi
+  807d41:	c1 ef 05             	shr    $0x5,%edi
+  807d44:	83 e7 01             	and    $0x1,%edi
+  807d47:	89 fe                	mov    %edi,%esi
+  807d49:	83 f6 01             	xor    $0x1,%esi
+  807d4c:	d3 e6                	shl    %cl,%esi
+  807d4e:	d3 e7                	shl    %cl,%edi
+  807d50:	09 74 24 18          	or     %esi,0x18(%esp)
+  807d54:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  807d58:	eb 90                	jmp    807cea <udivmod+0x46>
+  807d5a:	85 db                	test   %ebx,%ebx
+  807d5c:	74 05                	je     807d63 <udivmod+0xbf>
+  807d5e:	89 03                	mov    %eax,(%ebx)
+  807d60:	89 53 04             	mov    %edx,0x4(%ebx)
+  807d63:	8b 44 24 18          	mov    0x18(%esp),%eax
+  807d67:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  807d6b:	83 c4 24             	add    $0x24,%esp
+  807d6e:	5b                   	pop    %ebx
+  807d6f:	5e                   	pop    %esi
+  807d70:	5f                   	pop    %edi
+  807d71:	5d                   	pop    %ebp
+  807d72:	c3                   	ret
+
+00807d73 <__udivdi3>:
+  807d73:	83 ec 08             	sub    $0x8,%esp
+  807d76:	6a 00                	push   $0x0
+  807d78:	ff 74 24 1c          	push   0x1c(%esp)
+  807d7c:	ff 74 24 1c          	push   0x1c(%esp)
+  807d80:	8b 44 24 18          	mov    0x18(%esp),%eax
+  807d84:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  807d88:	e8 17 ff ff ff       	call   807ca4 <udivmod>
+  807d8d:	83 c4 14             	add    $0x14,%esp
+  807d90:	c3                   	ret
+
+00807d91 <__umoddi3>:
+  807d91:	83 ec 18             	sub    $0x18,%esp
+  807d94:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  807d98:	50                   	push   %eax
+  807d99:	ff 74 24 2c          	push   0x2c(%esp)
+  807d9d:	ff 74 24 2c          	push   0x2c(%esp)
+  807da1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  807da5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  807da9:	e8 f6 fe ff ff       	call   807ca4 <udivmod>
+  807dae:	8b 44 24 18          	mov    0x18(%esp),%eax
+  807db2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  807db6:	83 c4 24             	add    $0x24,%esp
+  807db9:	c3                   	ret
+
+00807dba <__divdi3>:
+  807dba:	55                   	push   %ebp
+  807dbb:	57                   	push   %edi
+  807dbc:	56                   	push   %esi
+  807dbd:	53                   	push   %ebx
+  807dbe:	83 ec 10             	sub    $0x10,%esp
+  807dc1:	8b 44 24 24          	mov    0x24(%esp),%eax
+  807dc5:	8b 54 24 28          	mov    0x28(%esp),%edx
+  807dc9:	89 c6                	mov    %eax,%esi
+  807dcb:	89 d7                	mov    %edx,%edi
+  807dcd:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  807dd1:	33 7c 24 30          	xor    0x30(%esp),%edi
+  807dd5:	89 74 24 04          	mov    %esi,0x4(%esp)
+  807dd9:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  807ddd:	89 c5                	mov    %eax,%ebp
+  807ddf:	f7 dd                	neg    %ebp
+  807de1:	89 d6                	mov    %edx,%esi
+  807de3:	83 d6 00             	adc    $0x0,%esi
+  807de6:	f7 de                	neg    %esi
+  807de8:	0f 48 e8             	cmovs  %eax,%ebp
+  807deb:	0f 49 d6             	cmovns %esi,%edx
+  807dee:	6a 00                	push   $0x0
+  807df0:	8b 74 24 30          	mov    0x30(%esp),%esi
+  807df4:	f7 de                	neg    %esi
+  807df6:	8b 44 24 34          	mov    0x34(%esp),%eax
+  807dfa:	83 d0 00             	adc    $0x0,%eax
+  807dfd:	f7 d8                	neg    %eax
+  807dff:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  807e04:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  807e09:	50                   	push   %eax
+  807e0a:	56                   	push   %esi
+  807e0b:	89 e8                	mov    %ebp,%eax
+  807e0d:	e8 92 fe ff ff       	call   807ca4 <udivmod>
+  807e12:	83 c4 10             	add    $0x10,%esp
+  807e15:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  807e1a:	78 08                	js     807e24 <__divdi3+0x6a>
+  807e1c:	83 c4 0c             	add    $0xc,%esp
+  807e1f:	5b                   	pop    %ebx
+  807e20:	5e                   	pop    %esi
+  807e21:	5f                   	pop    %edi
+  807e22:	5d                   	pop    %ebp
+  807e23:	c3                   	ret
+  807e24:	f7 d8                	neg    %eax
+  807e26:	83 d2 00             	adc    $0x0,%edx
+  807e29:	f7 da                	neg    %edx
+  807e2b:	eb ef                	jmp    807e1c <__divdi3+0x62>
+
+00807e2d <__moddi3>:
+  807e2d:	55                   	push   %ebp
+  807e2e:	57                   	push   %edi
+  807e2f:	56                   	push   %esi
+  807e30:	53                   	push   %ebx
+  807e31:	83 ec 18             	sub    $0x18,%esp
+  807e34:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  807e38:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  807e3c:	89 f1                	mov    %esi,%ecx
+  807e3e:	f7 d9                	neg    %ecx
+  807e40:	89 da                	mov    %ebx,%edx
+  807e42:	83 d2 00             	adc    $0x0,%edx
+  807e45:	f7 da                	neg    %edx
+  807e47:	0f 48 ce             	cmovs  %esi,%ecx
+  807e4a:	0f 48 d3             	cmovs  %ebx,%edx
+  807e4d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  807e51:	50                   	push   %eax
+  807e52:	8b 74 24 38          	mov    0x38(%esp),%esi
+  807e56:	f7 de                	neg    %esi
+  807e58:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  807e5c:	83 d0 00             	adc    $0x0,%eax
+  807e5f:	f7 d8                	neg    %eax
+  807e61:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  807e66:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  807e6b:	50                   	push   %eax
+  807e6c:	56                   	push   %esi
+  807e6d:	89 c8                	mov    %ecx,%eax
+  807e6f:	e8 30 fe ff ff       	call   807ca4 <udivmod>
+  807e74:	83 c4 10             	add    $0x10,%esp
+  807e77:	85 db                	test   %ebx,%ebx
+  807e79:	78 10                	js     807e8b <__moddi3+0x5e>
+  807e7b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  807e7f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  807e83:	83 c4 14             	add    $0x14,%esp
+  807e86:	5b                   	pop    %ebx
+  807e87:	5e                   	pop    %esi
+  807e88:	5f                   	pop    %edi
+  807e89:	5d                   	pop    %ebp
+  807e8a:	c3                   	ret
+  807e8b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  807e8f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  807e93:	f7 d8                	neg    %eax
+  807e95:	83 d2 00             	adc    $0x0,%edx
+  807e98:	f7 da                	neg    %edx
+  807e9a:	eb e7                	jmp    807e83 <__moddi3+0x56>
@@ -0,0 +1,15273 @@
+
+obj/kern/kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+f0100000 <_start+0xeffffff4>:
+f0100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+f0100006:	00 00                	add    %al,(%eax)
+f0100008:	fe 4f 52             	decb   0x52(%edi)
+f010000b:	e4                   	.byte 0xe4
+
+f010000c <entry>:
+.globl		_start
+_start = RELOC(entry)
+
+.globl entry
+entry:
+	movw	$0x1234,0x472			# warm boot
+f010000c:	66 c7 05 72 04 00 00 	movw   $0x1234,0x472
+f0100013:	34 12 
+	# sufficient until we set up our real page table in mem_init
+	# in lab 2.
+
+	# Load the physical address of entry_pgdir into cr3.  entry_pgdir
+	# is defined in entrypgdir.c.
+	movl	$(RELOC(entry_pgdir)), %eax
+f0100015:	b8 00 30 11 00       	mov    $0x113000,%eax
+	movl	%eax, %cr3
+f010001a:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on paging.
+	movl	%cr0, %eax
+f010001d:	0f 20 c0             	mov    %cr0,%eax
+	orl	$(CR0_PE|CR0_PG|CR0_WP), %eax
+f0100020:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl	%eax, %cr0
+f0100025:	0f 22 c0             	mov    %eax,%cr0
+
+	# Now paging is enabled, but we're still running at a low EIP
+	# (why is this okay?).  Jump up above KERNBASE before entering
+	# C code.
+	mov	$relocated, %eax
+f0100028:	b8 2f 00 10 f0       	mov    $0xf010002f,%eax
+	jmp	*%eax
+f010002d:	ff e0                	jmp    *%eax
+
+f010002f <relocated>:
+relocated:
+
+	# Clear the frame pointer register (EBP)
+	# so that once we get into debugging C code,
+	# stack backtraces will be terminated properly.
+	movl	$0x0,%ebp			# nuke frame pointer
+f010002f:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Set the stack pointer
+	movl	$(bootstacktop),%esp
+f0100034:	bc 00 30 11 f0       	mov    $0xf0113000,%esp
+
+	# now to C code
+	call	i386_init
+f0100039:	e8 61 00 00 00       	call   f010009f <i386_init>
+
+f010003e <spin>:
+
+	# Should never get here, but in case we do, just spin.
+spin:	jmp	spin
+f010003e:	eb fe                	jmp    f010003e <spin>
+
+f0100040 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: mesg", and then enters the kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt,...)
+{
+f0100040:	55                   	push   %ebp
+f0100041:	89 e5                	mov    %esp,%ebp
+f0100043:	53                   	push   %ebx
+f0100044:	83 ec 04             	sub    $0x4,%esp
+	va_list ap;
+
+	if (panicstr)
+f0100047:	83 3d 44 a0 85 f0 00 	cmpl   $0x0,0xf085a044
+f010004e:	74 0f                	je     f010005f <_panic+0x1f>
+	va_end(ap);
+
+dead:
+	/* break into the kernel monitor */
+	while (1)
+		monitor(NULL);
+f0100050:	83 ec 0c             	sub    $0xc,%esp
+f0100053:	6a 00                	push   $0x0
+f0100055:	e8 85 12 00 00       	call   f01012df <monitor>
+f010005a:	83 c4 10             	add    $0x10,%esp
+f010005d:	eb f1                	jmp    f0100050 <_panic+0x10>
+	panicstr = fmt;
+f010005f:	8b 45 10             	mov    0x10(%ebp),%eax
+f0100062:	a3 44 a0 85 f0       	mov    %eax,0xf085a044
+	__asm __volatile("cli; cld");
+f0100067:	fa                   	cli
+f0100068:	fc                   	cld
+	va_start(ap, fmt);
+f0100069:	8d 5d 14             	lea    0x14(%ebp),%ebx
+	cprintf("kernel panic on CPU %d at %s:%d: ", cpunum(), file, line);
+f010006c:	e8 d2 7d 00 00       	call   f0107e43 <cpunum>
+f0100071:	ff 75 0c             	push   0xc(%ebp)
+f0100074:	ff 75 08             	push   0x8(%ebp)
+f0100077:	50                   	push   %eax
+f0100078:	68 c0 85 10 f0       	push   $0xf01085c0
+f010007d:	e8 68 44 00 00       	call   f01044ea <cprintf>
+	vcprintf(fmt, ap);
+f0100082:	83 c4 08             	add    $0x8,%esp
+f0100085:	53                   	push   %ebx
+f0100086:	ff 75 10             	push   0x10(%ebp)
+f0100089:	e8 36 44 00 00       	call   f01044c4 <vcprintf>
+	cprintf("\n");
+f010008e:	c7 04 24 8d 86 10 f0 	movl   $0xf010868d,(%esp)
+f0100095:	e8 50 44 00 00       	call   f01044ea <cprintf>
+f010009a:	83 c4 10             	add    $0x10,%esp
+f010009d:	eb b1                	jmp    f0100050 <_panic+0x10>
+
+f010009f <i386_init>:
+{
+f010009f:	55                   	push   %ebp
+f01000a0:	89 e5                	mov    %esp,%ebp
+f01000a2:	53                   	push   %ebx
+f01000a3:	83 ec 08             	sub    $0x8,%esp
+	memset(edata, 0, end - edata);
+f01000a6:	b8 08 c0 89 f0       	mov    $0xf089c008,%eax
+f01000ab:	2d 34 60 85 f0       	sub    $0xf0856034,%eax
+f01000b0:	50                   	push   %eax
+f01000b1:	6a 00                	push   $0x0
+f01000b3:	68 34 60 85 f0       	push   $0xf0856034
+f01000b8:	e8 d2 76 00 00       	call   f010778f <memset>
+	cons_init();
+f01000bd:	e8 d7 05 00 00       	call   f0100699 <cons_init>
+	cprintf("6828 decimal is %o octal!\n", 6828);
+f01000c2:	83 c4 08             	add    $0x8,%esp
+f01000c5:	68 ac 1a 00 00       	push   $0x1aac
+f01000ca:	68 2c 86 10 f0       	push   $0xf010862c
+f01000cf:	e8 16 44 00 00       	call   f01044ea <cprintf>
+	mem_init();
+f01000d4:	e8 e7 1d 00 00       	call   f0101ec0 <mem_init>
+	env_init();
+f01000d9:	e8 b4 34 00 00       	call   f0103592 <env_init>
+	trap_init();
+f01000de:	e8 11 45 00 00       	call   f01045f4 <trap_init>
+	mp_init();
+f01000e3:	e8 75 7a 00 00       	call   f0107b5d <mp_init>
+	lapic_init();
+f01000e8:	e8 6c 7d 00 00       	call   f0107e59 <lapic_init>
+	pic_init();
+f01000ed:	e8 19 43 00 00       	call   f010440b <pic_init>
+extern struct spinlock kernel_lock;
+
+static inline void
+lock_kernel(void)
+{
+	spin_lock(&kernel_lock);
+f01000f2:	c7 04 24 a0 54 11 f0 	movl   $0xf01154a0,(%esp)
+f01000f9:	e8 b5 7f 00 00       	call   f01080b3 <spin_lock>
+#define KADDR(pa) _kaddr(__FILE__, __LINE__, pa)
+
+static inline void*
+_kaddr(const char *file, int line, physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f01000fe:	83 c4 10             	add    $0x10,%esp
+f0100101:	83 3d 54 a0 85 f0 07 	cmpl   $0x7,0xf085a054
+f0100108:	76 27                	jbe    f0100131 <i386_init+0x92>
+	memmove(code, mpentry_start, mpentry_end - mpentry_start);
+f010010a:	83 ec 04             	sub    $0x4,%esp
+f010010d:	b8 ba 7a 10 f0       	mov    $0xf0107aba,%eax
+f0100112:	2d 40 7a 10 f0       	sub    $0xf0107a40,%eax
+f0100117:	50                   	push   %eax
+f0100118:	68 40 7a 10 f0       	push   $0xf0107a40
+f010011d:	68 00 70 00 f0       	push   $0xf0007000
+f0100122:	e8 9d 76 00 00       	call   f01077c4 <memmove>
+	for (c = cpus; c < cpus + ncpu; c++) {
+f0100127:	83 c4 10             	add    $0x10,%esp
+f010012a:	bb 20 b0 85 f0       	mov    $0xf085b020,%ebx
+f010012f:	eb 19                	jmp    f010014a <i386_init+0xab>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100131:	68 00 70 00 00       	push   $0x7000
+f0100136:	68 e4 85 10 f0       	push   $0xf01085e4
+f010013b:	6a 68                	push   $0x68
+f010013d:	68 47 86 10 f0       	push   $0xf0108647
+f0100142:	e8 f9 fe ff ff       	call   f0100040 <_panic>
+f0100147:	83 c3 74             	add    $0x74,%ebx
+f010014a:	6b 05 c4 b3 85 f0 74 	imul   $0x74,0xf085b3c4,%eax
+f0100151:	05 20 b0 85 f0       	add    $0xf085b020,%eax
+f0100156:	39 c3                	cmp    %eax,%ebx
+f0100158:	73 4d                	jae    f01001a7 <i386_init+0x108>
+		if (c == cpus + cpunum())  // We've started already.
+f010015a:	e8 e4 7c 00 00       	call   f0107e43 <cpunum>
+f010015f:	6b c0 74             	imul   $0x74,%eax,%eax
+f0100162:	05 20 b0 85 f0       	add    $0xf085b020,%eax
+f0100167:	39 c3                	cmp    %eax,%ebx
+f0100169:	74 dc                	je     f0100147 <i386_init+0xa8>
+		mpentry_kstack = percpu_kstacks[c - cpus] + KSTKSIZE;
+f010016b:	89 d8                	mov    %ebx,%eax
+f010016d:	2d 20 b0 85 f0       	sub    $0xf085b020,%eax
+f0100172:	c1 f8 02             	sar    $0x2,%eax
+f0100175:	69 c0 35 c2 72 4f    	imul   $0x4f72c235,%eax,%eax
+f010017b:	c1 e0 0f             	shl    $0xf,%eax
+f010017e:	8d 80 00 40 86 f0    	lea    -0xf79c000(%eax),%eax
+f0100184:	a3 48 a0 85 f0       	mov    %eax,0xf085a048
+		lapic_startap(c->cpu_id, PADDR(code));
+f0100189:	83 ec 08             	sub    $0x8,%esp
+f010018c:	68 00 70 00 00       	push   $0x7000
+f0100191:	0f b6 03             	movzbl (%ebx),%eax
+f0100194:	50                   	push   %eax
+f0100195:	e8 11 7e 00 00       	call   f0107fab <lapic_startap>
+		while(c->cpu_status != CPU_STARTED)
+f010019a:	83 c4 10             	add    $0x10,%esp
+f010019d:	8b 43 04             	mov    0x4(%ebx),%eax
+f01001a0:	83 f8 01             	cmp    $0x1,%eax
+f01001a3:	75 f8                	jne    f010019d <i386_init+0xfe>
+f01001a5:	eb a0                	jmp    f0100147 <i386_init+0xa8>
+	ENV_CREATE(fs_fs, ENV_TYPE_FS);
+f01001a7:	83 ec 04             	sub    $0x4,%esp
+f01001aa:	6a 01                	push   $0x1
+f01001ac:	68 90 8b 03 00       	push   $0x38b90
+f01001b1:	68 2c db 46 f0       	push   $0xf046db2c
+f01001b6:	e8 7a 36 00 00       	call   f0103835 <env_create>
+		ENV_CREATE(page_page, ENV_TYPE_PAGE);
+f01001bb:	83 c4 0c             	add    $0xc,%esp
+f01001be:	6a 02                	push   $0x2
+f01001c0:	68 50 c6 01 00       	push   $0x1c650
+f01001c5:	68 bc 66 4a f0       	push   $0xf04a66bc
+f01001ca:	e8 66 36 00 00       	call   f0103835 <env_create>
+f01001cf:	83 c4 0c             	add    $0xc,%esp
+f01001d2:	6a 02                	push   $0x2
+f01001d4:	68 50 c6 01 00       	push   $0x1c650
+f01001d9:	68 bc 66 4a f0       	push   $0xf04a66bc
+f01001de:	e8 52 36 00 00       	call   f0103835 <env_create>
+	RUNNING
+f01001e3:	83 c4 0c             	add    $0xc,%esp
+f01001e6:	6a 00                	push   $0x0
+f01001e8:	68 28 11 02 00       	push   $0x21128
+f01001ed:	68 38 21 64 f0       	push   $0xf0642138
+f01001f2:	e8 3e 36 00 00       	call   f0103835 <env_create>
+f01001f7:	83 c4 0c             	add    $0xc,%esp
+f01001fa:	6a 00                	push   $0x0
+f01001fc:	68 08 11 02 00       	push   $0x21108
+f0100201:	68 1c c9 72 f0       	push   $0xf072c91c
+f0100206:	e8 2a 36 00 00       	call   f0103835 <env_create>
+	kbd_intr();
+f010020b:	e8 35 04 00 00       	call   f0100645 <kbd_intr>
+	sched_yield();
+f0100210:	e8 fd 4d 00 00       	call   f0105012 <sched_yield>
+
+f0100215 <mp_main>:
+{
+f0100215:	55                   	push   %ebp
+f0100216:	89 e5                	mov    %esp,%ebp
+f0100218:	83 ec 08             	sub    $0x8,%esp
+
+static __inline uint32_t
+rcr4(void)
+{
+	uint32_t cr4;
+	__asm __volatile("movl %%cr4,%0" : "=r" (cr4));
+f010021b:	0f 20 e0             	mov    %cr4,%eax
+	lcr4(rcr4() | CR4_PSE);
+f010021e:	83 c8 10             	or     $0x10,%eax
+	__asm __volatile("movl %0,%%cr4" : : "r" (val));
+f0100221:	0f 22 e0             	mov    %eax,%cr4
+	lcr3(PADDR(kern_pgdir));
+f0100224:	a1 58 a0 85 f0       	mov    0xf085a058,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0100229:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010022e:	76 52                	jbe    f0100282 <mp_main+0x6d>
+	return (physaddr_t)kva - KERNBASE;
+f0100230:	05 00 00 00 10       	add    $0x10000000,%eax
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f0100235:	0f 22 d8             	mov    %eax,%cr3
+	cprintf("SMP: CPU %d starting\n", cpunum());
+f0100238:	e8 06 7c 00 00       	call   f0107e43 <cpunum>
+f010023d:	83 ec 08             	sub    $0x8,%esp
+f0100240:	50                   	push   %eax
+f0100241:	68 53 86 10 f0       	push   $0xf0108653
+f0100246:	e8 9f 42 00 00       	call   f01044ea <cprintf>
+	lapic_init();
+f010024b:	e8 09 7c 00 00       	call   f0107e59 <lapic_init>
+	env_init_percpu();
+f0100250:	e8 11 33 00 00       	call   f0103566 <env_init_percpu>
+	trap_init_percpu();
+f0100255:	e8 a4 42 00 00       	call   f01044fe <trap_init_percpu>
+	xchg(&thiscpu->cpu_status, CPU_STARTED); // tell boot_aps() we're up
+f010025a:	e8 e4 7b 00 00       	call   f0107e43 <cpunum>
+f010025f:	6b d0 74             	imul   $0x74,%eax,%edx
+f0100262:	83 c2 04             	add    $0x4,%edx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+f0100265:	b8 01 00 00 00       	mov    $0x1,%eax
+f010026a:	f0 87 82 20 b0 85 f0 	lock xchg %eax,-0xf7a4fe0(%edx)
+f0100271:	c7 04 24 a0 54 11 f0 	movl   $0xf01154a0,(%esp)
+f0100278:	e8 36 7e 00 00       	call   f01080b3 <spin_lock>
+	sched_yield();
+f010027d:	e8 90 4d 00 00       	call   f0105012 <sched_yield>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0100282:	50                   	push   %eax
+f0100283:	68 08 86 10 f0       	push   $0xf0108608
+f0100288:	68 81 00 00 00       	push   $0x81
+f010028d:	68 47 86 10 f0       	push   $0xf0108647
+f0100292:	e8 a9 fd ff ff       	call   f0100040 <_panic>
+
+f0100297 <_warn>:
+}
+
+/* like panic, but don't */
+void
+_warn(const char *file, int line, const char *fmt,...)
+{
+f0100297:	55                   	push   %ebp
+f0100298:	89 e5                	mov    %esp,%ebp
+f010029a:	53                   	push   %ebx
+f010029b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+
+	va_start(ap, fmt);
+f010029e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+	cprintf("kernel warning at %s:%d: ", file, line);
+f01002a1:	ff 75 0c             	push   0xc(%ebp)
+f01002a4:	ff 75 08             	push   0x8(%ebp)
+f01002a7:	68 69 86 10 f0       	push   $0xf0108669
+f01002ac:	e8 39 42 00 00       	call   f01044ea <cprintf>
+	vcprintf(fmt, ap);
+f01002b1:	83 c4 08             	add    $0x8,%esp
+f01002b4:	53                   	push   %ebx
+f01002b5:	ff 75 10             	push   0x10(%ebp)
+f01002b8:	e8 07 42 00 00       	call   f01044c4 <vcprintf>
+	cprintf("\n");
+f01002bd:	c7 04 24 8d 86 10 f0 	movl   $0xf010868d,(%esp)
+f01002c4:	e8 21 42 00 00       	call   f01044ea <cprintf>
+	va_end(ap);
+}
+f01002c9:	83 c4 10             	add    $0x10,%esp
+f01002cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01002cf:	c9                   	leave
+f01002d0:	c3                   	ret
+
+f01002d1 <serial_proc_data>:
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01002d1:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f01002d6:	ec                   	in     (%dx),%al
+static bool serial_exists;
+
+static int
+serial_proc_data(void)
+{
+	if (!(inb(COM1+COM_LSR) & COM_LSR_DATA))
+f01002d7:	a8 01                	test   $0x1,%al
+f01002d9:	74 0a                	je     f01002e5 <serial_proc_data+0x14>
+f01002db:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01002e0:	ec                   	in     (%dx),%al
+		return -1;
+	return inb(COM1+COM_RX);
+f01002e1:	0f b6 c0             	movzbl %al,%eax
+f01002e4:	c3                   	ret
+		return -1;
+f01002e5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f01002ea:	c3                   	ret
+
+f01002eb <cons_intr>:
+
+// called by device interrupt routines to feed input characters
+// into the circular console input buffer.
+static void
+cons_intr(int (*proc)(void))
+{
+f01002eb:	55                   	push   %ebp
+f01002ec:	89 e5                	mov    %esp,%ebp
+f01002ee:	53                   	push   %ebx
+f01002ef:	83 ec 04             	sub    $0x4,%esp
+f01002f2:	89 c3                	mov    %eax,%ebx
+	int c;
+
+	while ((c = (*proc)()) != -1) {
+f01002f4:	eb 23                	jmp    f0100319 <cons_intr+0x2e>
+		if (c == 0)
+			continue;
+		cons.buf[cons.wpos++] = c;
+f01002f6:	8b 0d 24 72 85 f0    	mov    0xf0857224,%ecx
+f01002fc:	8d 51 01             	lea    0x1(%ecx),%edx
+f01002ff:	88 81 20 70 85 f0    	mov    %al,-0xf7a8fe0(%ecx)
+		if (cons.wpos == CONSBUFSIZE)
+f0100305:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+			cons.wpos = 0;
+f010030b:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100310:	0f 44 d0             	cmove  %eax,%edx
+f0100313:	89 15 24 72 85 f0    	mov    %edx,0xf0857224
+	while ((c = (*proc)()) != -1) {
+f0100319:	ff d3                	call   *%ebx
+f010031b:	83 f8 ff             	cmp    $0xffffffff,%eax
+f010031e:	74 06                	je     f0100326 <cons_intr+0x3b>
+		if (c == 0)
+f0100320:	85 c0                	test   %eax,%eax
+f0100322:	75 d2                	jne    f01002f6 <cons_intr+0xb>
+f0100324:	eb f3                	jmp    f0100319 <cons_intr+0x2e>
+	}
+}
+f0100326:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100329:	c9                   	leave
+f010032a:	c3                   	ret
+
+f010032b <kbd_proc_data>:
+{
+f010032b:	55                   	push   %ebp
+f010032c:	89 e5                	mov    %esp,%ebp
+f010032e:	53                   	push   %ebx
+f010032f:	83 ec 04             	sub    $0x4,%esp
+f0100332:	ba 64 00 00 00       	mov    $0x64,%edx
+f0100337:	ec                   	in     (%dx),%al
+	if ((inb(KBSTATP) & KBS_DIB) == 0)
+f0100338:	a8 01                	test   $0x1,%al
+f010033a:	0f 84 e6 00 00 00    	je     f0100426 <kbd_proc_data+0xfb>
+f0100340:	ba 60 00 00 00       	mov    $0x60,%edx
+f0100345:	ec                   	in     (%dx),%al
+f0100346:	89 c2                	mov    %eax,%edx
+	if (data == 0xE0) {
+f0100348:	3c e0                	cmp    $0xe0,%al
+f010034a:	74 61                	je     f01003ad <kbd_proc_data+0x82>
+	} else if (data & 0x80) {
+f010034c:	84 c0                	test   %al,%al
+f010034e:	78 70                	js     f01003c0 <kbd_proc_data+0x95>
+	} else if (shift & E0ESC) {
+f0100350:	8b 0d 00 70 85 f0    	mov    0xf0857000,%ecx
+f0100356:	f6 c1 40             	test   $0x40,%cl
+f0100359:	74 0e                	je     f0100369 <kbd_proc_data+0x3e>
+		data |= 0x80;
+f010035b:	83 c8 80             	or     $0xffffff80,%eax
+f010035e:	89 c2                	mov    %eax,%edx
+		shift &= ~E0ESC;
+f0100360:	83 e1 bf             	and    $0xffffffbf,%ecx
+f0100363:	89 0d 00 70 85 f0    	mov    %ecx,0xf0857000
+	shift |= shiftcode[data];
+f0100369:	0f b6 d2             	movzbl %dl,%edx
+f010036c:	0f b6 82 e0 87 10 f0 	movzbl -0xfef7820(%edx),%eax
+f0100373:	0b 05 00 70 85 f0    	or     0xf0857000,%eax
+	shift ^= togglecode[data];
+f0100379:	0f b6 8a e0 86 10 f0 	movzbl -0xfef7920(%edx),%ecx
+f0100380:	31 c8                	xor    %ecx,%eax
+f0100382:	a3 00 70 85 f0       	mov    %eax,0xf0857000
+	c = charcode[shift & (CTL | SHIFT)][data];
+f0100387:	89 c1                	mov    %eax,%ecx
+f0100389:	83 e1 03             	and    $0x3,%ecx
+f010038c:	8b 0c 8d c0 86 10 f0 	mov    -0xfef7940(,%ecx,4),%ecx
+f0100393:	0f b6 14 11          	movzbl (%ecx,%edx,1),%edx
+f0100397:	0f b6 da             	movzbl %dl,%ebx
+	if (shift & CAPSLOCK) {
+f010039a:	a8 08                	test   $0x8,%al
+f010039c:	74 5d                	je     f01003fb <kbd_proc_data+0xd0>
+		if ('a' <= c && c <= 'z')
+f010039e:	89 da                	mov    %ebx,%edx
+f01003a0:	8d 4b 9f             	lea    -0x61(%ebx),%ecx
+f01003a3:	83 f9 19             	cmp    $0x19,%ecx
+f01003a6:	77 47                	ja     f01003ef <kbd_proc_data+0xc4>
+			c += 'A' - 'a';
+f01003a8:	83 eb 20             	sub    $0x20,%ebx
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f01003ab:	eb 0c                	jmp    f01003b9 <kbd_proc_data+0x8e>
+		shift |= E0ESC;
+f01003ad:	83 0d 00 70 85 f0 40 	orl    $0x40,0xf0857000
+		return 0;
+f01003b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f01003b9:	89 d8                	mov    %ebx,%eax
+f01003bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01003be:	c9                   	leave
+f01003bf:	c3                   	ret
+		data = (shift & E0ESC ? data : data & 0x7F);
+f01003c0:	8b 0d 00 70 85 f0    	mov    0xf0857000,%ecx
+f01003c6:	83 e0 7f             	and    $0x7f,%eax
+f01003c9:	f6 c1 40             	test   $0x40,%cl
+f01003cc:	0f 44 d0             	cmove  %eax,%edx
+		shift &= ~(shiftcode[data] | E0ESC);
+f01003cf:	0f b6 d2             	movzbl %dl,%edx
+f01003d2:	0f b6 82 e0 87 10 f0 	movzbl -0xfef7820(%edx),%eax
+f01003d9:	83 c8 40             	or     $0x40,%eax
+f01003dc:	0f b6 c0             	movzbl %al,%eax
+f01003df:	f7 d0                	not    %eax
+f01003e1:	21 c8                	and    %ecx,%eax
+f01003e3:	a3 00 70 85 f0       	mov    %eax,0xf0857000
+		return 0;
+f01003e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01003ed:	eb ca                	jmp    f01003b9 <kbd_proc_data+0x8e>
+		else if ('A' <= c && c <= 'Z')
+f01003ef:	83 ea 41             	sub    $0x41,%edx
+			c += 'a' - 'A';
+f01003f2:	8d 4b 20             	lea    0x20(%ebx),%ecx
+f01003f5:	83 fa 1a             	cmp    $0x1a,%edx
+f01003f8:	0f 42 d9             	cmovb  %ecx,%ebx
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f01003fb:	f7 d0                	not    %eax
+f01003fd:	a8 06                	test   $0x6,%al
+f01003ff:	75 b8                	jne    f01003b9 <kbd_proc_data+0x8e>
+f0100401:	81 fb e9 00 00 00    	cmp    $0xe9,%ebx
+f0100407:	75 b0                	jne    f01003b9 <kbd_proc_data+0x8e>
+		cprintf("Rebooting!\n");
+f0100409:	83 ec 0c             	sub    $0xc,%esp
+f010040c:	68 83 86 10 f0       	push   $0xf0108683
+f0100411:	e8 d4 40 00 00       	call   f01044ea <cprintf>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100416:	b8 03 00 00 00       	mov    $0x3,%eax
+f010041b:	ba 92 00 00 00       	mov    $0x92,%edx
+f0100420:	ee                   	out    %al,(%dx)
+}
+f0100421:	83 c4 10             	add    $0x10,%esp
+f0100424:	eb 93                	jmp    f01003b9 <kbd_proc_data+0x8e>
+		return -1;
+f0100426:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+f010042b:	eb 8c                	jmp    f01003b9 <kbd_proc_data+0x8e>
+
+f010042d <cons_putc>:
+}
+
+// output a character to the console
+static void
+cons_putc(int c)
+{
+f010042d:	55                   	push   %ebp
+f010042e:	89 e5                	mov    %esp,%ebp
+f0100430:	57                   	push   %edi
+f0100431:	56                   	push   %esi
+f0100432:	53                   	push   %ebx
+f0100433:	83 ec 1c             	sub    $0x1c,%esp
+f0100436:	89 c7                	mov    %eax,%edi
+	for (i = 0;
+f0100438:	bb 00 00 00 00       	mov    $0x0,%ebx
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010043d:	be fd 03 00 00       	mov    $0x3fd,%esi
+f0100442:	b9 84 00 00 00       	mov    $0x84,%ecx
+f0100447:	89 f2                	mov    %esi,%edx
+f0100449:	ec                   	in     (%dx),%al
+	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+f010044a:	a8 20                	test   $0x20,%al
+f010044c:	75 13                	jne    f0100461 <cons_putc+0x34>
+f010044e:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f0100454:	7f 0b                	jg     f0100461 <cons_putc+0x34>
+f0100456:	89 ca                	mov    %ecx,%edx
+f0100458:	ec                   	in     (%dx),%al
+f0100459:	ec                   	in     (%dx),%al
+f010045a:	ec                   	in     (%dx),%al
+f010045b:	ec                   	in     (%dx),%al
+	     i++)
+f010045c:	83 c3 01             	add    $0x1,%ebx
+f010045f:	eb e6                	jmp    f0100447 <cons_putc+0x1a>
+	outb(COM1 + COM_TX, c);
+f0100461:	89 f8                	mov    %edi,%eax
+f0100463:	88 45 e7             	mov    %al,-0x19(%ebp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100466:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f010046b:	ee                   	out    %al,(%dx)
+	for (i = 0; !(inb(0x378+1) & 0x80) && i < 12800; i++)
+f010046c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100471:	be 79 03 00 00       	mov    $0x379,%esi
+f0100476:	b9 84 00 00 00       	mov    $0x84,%ecx
+f010047b:	89 f2                	mov    %esi,%edx
+f010047d:	ec                   	in     (%dx),%al
+f010047e:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f0100484:	7f 0f                	jg     f0100495 <cons_putc+0x68>
+f0100486:	84 c0                	test   %al,%al
+f0100488:	78 0b                	js     f0100495 <cons_putc+0x68>
+f010048a:	89 ca                	mov    %ecx,%edx
+f010048c:	ec                   	in     (%dx),%al
+f010048d:	ec                   	in     (%dx),%al
+f010048e:	ec                   	in     (%dx),%al
+f010048f:	ec                   	in     (%dx),%al
+f0100490:	83 c3 01             	add    $0x1,%ebx
+f0100493:	eb e6                	jmp    f010047b <cons_putc+0x4e>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100495:	ba 78 03 00 00       	mov    $0x378,%edx
+f010049a:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+f010049e:	ee                   	out    %al,(%dx)
+f010049f:	ba 7a 03 00 00       	mov    $0x37a,%edx
+f01004a4:	b8 0d 00 00 00       	mov    $0xd,%eax
+f01004a9:	ee                   	out    %al,(%dx)
+f01004aa:	b8 08 00 00 00       	mov    $0x8,%eax
+f01004af:	ee                   	out    %al,(%dx)
+		c |= 0x0700;
+f01004b0:	89 f8                	mov    %edi,%eax
+f01004b2:	80 cc 07             	or     $0x7,%ah
+f01004b5:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+f01004bb:	0f 42 f8             	cmovb  %eax,%edi
+	switch (c & 0xff) {
+f01004be:	89 f8                	mov    %edi,%eax
+f01004c0:	0f b6 c0             	movzbl %al,%eax
+f01004c3:	89 fb                	mov    %edi,%ebx
+f01004c5:	80 fb 0a             	cmp    $0xa,%bl
+f01004c8:	0f 84 e1 00 00 00    	je     f01005af <cons_putc+0x182>
+f01004ce:	83 f8 0a             	cmp    $0xa,%eax
+f01004d1:	7f 46                	jg     f0100519 <cons_putc+0xec>
+f01004d3:	83 f8 08             	cmp    $0x8,%eax
+f01004d6:	0f 84 a7 00 00 00    	je     f0100583 <cons_putc+0x156>
+f01004dc:	83 f8 09             	cmp    $0x9,%eax
+f01004df:	0f 85 d7 00 00 00    	jne    f01005bc <cons_putc+0x18f>
+		cons_putc(' ');
+f01004e5:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004ea:	e8 3e ff ff ff       	call   f010042d <cons_putc>
+		cons_putc(' ');
+f01004ef:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004f4:	e8 34 ff ff ff       	call   f010042d <cons_putc>
+		cons_putc(' ');
+f01004f9:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004fe:	e8 2a ff ff ff       	call   f010042d <cons_putc>
+		cons_putc(' ');
+f0100503:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100508:	e8 20 ff ff ff       	call   f010042d <cons_putc>
+		cons_putc(' ');
+f010050d:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100512:	e8 16 ff ff ff       	call   f010042d <cons_putc>
+		break;
+f0100517:	eb 25                	jmp    f010053e <cons_putc+0x111>
+	switch (c & 0xff) {
+f0100519:	83 f8 0d             	cmp    $0xd,%eax
+f010051c:	0f 85 9a 00 00 00    	jne    f01005bc <cons_putc+0x18f>
+		crt_pos -= (crt_pos % CRT_COLS);
+f0100522:	0f b7 05 28 72 85 f0 	movzwl 0xf0857228,%eax
+f0100529:	69 c0 cd cc 00 00    	imul   $0xcccd,%eax,%eax
+f010052f:	c1 e8 16             	shr    $0x16,%eax
+f0100532:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0100535:	c1 e0 04             	shl    $0x4,%eax
+f0100538:	66 a3 28 72 85 f0    	mov    %ax,0xf0857228
+	if (crt_pos >= CRT_SIZE) {
+f010053e:	66 81 3d 28 72 85 f0 	cmpw   $0x7cf,0xf0857228
+f0100545:	cf 07 
+f0100547:	0f 87 92 00 00 00    	ja     f01005df <cons_putc+0x1b2>
+	outb(addr_6845, 14);
+f010054d:	8b 0d 30 72 85 f0    	mov    0xf0857230,%ecx
+f0100553:	b8 0e 00 00 00       	mov    $0xe,%eax
+f0100558:	89 ca                	mov    %ecx,%edx
+f010055a:	ee                   	out    %al,(%dx)
+	outb(addr_6845 + 1, crt_pos >> 8);
+f010055b:	0f b7 1d 28 72 85 f0 	movzwl 0xf0857228,%ebx
+f0100562:	8d 71 01             	lea    0x1(%ecx),%esi
+f0100565:	89 d8                	mov    %ebx,%eax
+f0100567:	66 c1 e8 08          	shr    $0x8,%ax
+f010056b:	89 f2                	mov    %esi,%edx
+f010056d:	ee                   	out    %al,(%dx)
+f010056e:	b8 0f 00 00 00       	mov    $0xf,%eax
+f0100573:	89 ca                	mov    %ecx,%edx
+f0100575:	ee                   	out    %al,(%dx)
+f0100576:	89 d8                	mov    %ebx,%eax
+f0100578:	89 f2                	mov    %esi,%edx
+f010057a:	ee                   	out    %al,(%dx)
+	serial_putc(c);
+	lpt_putc(c);
+	cga_putc(c);
+}
+f010057b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010057e:	5b                   	pop    %ebx
+f010057f:	5e                   	pop    %esi
+f0100580:	5f                   	pop    %edi
+f0100581:	5d                   	pop    %ebp
+f0100582:	c3                   	ret
+		if (crt_pos > 0) {
+f0100583:	0f b7 05 28 72 85 f0 	movzwl 0xf0857228,%eax
+f010058a:	66 85 c0             	test   %ax,%ax
+f010058d:	74 be                	je     f010054d <cons_putc+0x120>
+			crt_pos--;
+f010058f:	83 e8 01             	sub    $0x1,%eax
+f0100592:	66 a3 28 72 85 f0    	mov    %ax,0xf0857228
+			crt_buf[crt_pos] = (c & ~0xff) | ' ';
+f0100598:	0f b7 c0             	movzwl %ax,%eax
+f010059b:	66 81 e7 00 ff       	and    $0xff00,%di
+f01005a0:	83 cf 20             	or     $0x20,%edi
+f01005a3:	8b 15 2c 72 85 f0    	mov    0xf085722c,%edx
+f01005a9:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+f01005ad:	eb 8f                	jmp    f010053e <cons_putc+0x111>
+		crt_pos += CRT_COLS;
+f01005af:	66 83 05 28 72 85 f0 	addw   $0x50,0xf0857228
+f01005b6:	50 
+f01005b7:	e9 66 ff ff ff       	jmp    f0100522 <cons_putc+0xf5>
+		crt_buf[crt_pos++] = c;		/* write the character */
+f01005bc:	0f b7 05 28 72 85 f0 	movzwl 0xf0857228,%eax
+f01005c3:	8d 50 01             	lea    0x1(%eax),%edx
+f01005c6:	66 89 15 28 72 85 f0 	mov    %dx,0xf0857228
+f01005cd:	0f b7 c0             	movzwl %ax,%eax
+f01005d0:	8b 15 2c 72 85 f0    	mov    0xf085722c,%edx
+f01005d6:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+		break;
+f01005da:	e9 5f ff ff ff       	jmp    f010053e <cons_putc+0x111>
+		memmove(crt_buf, crt_buf + CRT_COLS, (CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
+f01005df:	a1 2c 72 85 f0       	mov    0xf085722c,%eax
+f01005e4:	83 ec 04             	sub    $0x4,%esp
+f01005e7:	68 00 0f 00 00       	push   $0xf00
+f01005ec:	8d 90 a0 00 00 00    	lea    0xa0(%eax),%edx
+f01005f2:	52                   	push   %edx
+f01005f3:	50                   	push   %eax
+f01005f4:	e8 cb 71 00 00       	call   f01077c4 <memmove>
+			crt_buf[i] = 0x0700 | ' ';
+f01005f9:	8b 15 2c 72 85 f0    	mov    0xf085722c,%edx
+f01005ff:	8d 82 00 0f 00 00    	lea    0xf00(%edx),%eax
+f0100605:	81 c2 a0 0f 00 00    	add    $0xfa0,%edx
+		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+f010060b:	83 c4 10             	add    $0x10,%esp
+f010060e:	eb 08                	jmp    f0100618 <cons_putc+0x1eb>
+			crt_buf[i] = 0x0700 | ' ';
+f0100610:	66 c7 00 20 07       	movw   $0x720,(%eax)
+		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+f0100615:	83 c0 02             	add    $0x2,%eax
+f0100618:	39 d0                	cmp    %edx,%eax
+f010061a:	75 f4                	jne    f0100610 <cons_putc+0x1e3>
+		crt_pos -= CRT_COLS;
+f010061c:	66 83 2d 28 72 85 f0 	subw   $0x50,0xf0857228
+f0100623:	50 
+f0100624:	e9 24 ff ff ff       	jmp    f010054d <cons_putc+0x120>
+
+f0100629 <serial_intr>:
+	if (serial_exists)
+f0100629:	80 3d 34 72 85 f0 00 	cmpb   $0x0,0xf0857234
+f0100630:	75 01                	jne    f0100633 <serial_intr+0xa>
+f0100632:	c3                   	ret
+{
+f0100633:	55                   	push   %ebp
+f0100634:	89 e5                	mov    %esp,%ebp
+f0100636:	83 ec 08             	sub    $0x8,%esp
+		cons_intr(serial_proc_data);
+f0100639:	b8 d1 02 10 f0       	mov    $0xf01002d1,%eax
+f010063e:	e8 a8 fc ff ff       	call   f01002eb <cons_intr>
+}
+f0100643:	c9                   	leave
+f0100644:	c3                   	ret
+
+f0100645 <kbd_intr>:
+{
+f0100645:	55                   	push   %ebp
+f0100646:	89 e5                	mov    %esp,%ebp
+f0100648:	83 ec 08             	sub    $0x8,%esp
+	cons_intr(kbd_proc_data);
+f010064b:	b8 2b 03 10 f0       	mov    $0xf010032b,%eax
+f0100650:	e8 96 fc ff ff       	call   f01002eb <cons_intr>
+}
+f0100655:	c9                   	leave
+f0100656:	c3                   	ret
+
+f0100657 <cons_getc>:
+{
+f0100657:	55                   	push   %ebp
+f0100658:	89 e5                	mov    %esp,%ebp
+f010065a:	83 ec 08             	sub    $0x8,%esp
+	serial_intr();
+f010065d:	e8 c7 ff ff ff       	call   f0100629 <serial_intr>
+	kbd_intr();
+f0100662:	e8 de ff ff ff       	call   f0100645 <kbd_intr>
+	if (cons.rpos != cons.wpos) {
+f0100667:	a1 20 72 85 f0       	mov    0xf0857220,%eax
+	return 0;
+f010066c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (cons.rpos != cons.wpos) {
+f0100671:	3b 05 24 72 85 f0    	cmp    0xf0857224,%eax
+f0100677:	74 1c                	je     f0100695 <cons_getc+0x3e>
+		c = cons.buf[cons.rpos++];
+f0100679:	8d 48 01             	lea    0x1(%eax),%ecx
+f010067c:	0f b6 90 20 70 85 f0 	movzbl -0xf7a8fe0(%eax),%edx
+			cons.rpos = 0;
+f0100683:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+f0100688:	b8 00 00 00 00       	mov    $0x0,%eax
+f010068d:	0f 45 c1             	cmovne %ecx,%eax
+f0100690:	a3 20 72 85 f0       	mov    %eax,0xf0857220
+}
+f0100695:	89 d0                	mov    %edx,%eax
+f0100697:	c9                   	leave
+f0100698:	c3                   	ret
+
+f0100699 <cons_init>:
+
+// initialize the console devices
+void
+cons_init(void)
+{
+f0100699:	55                   	push   %ebp
+f010069a:	89 e5                	mov    %esp,%ebp
+f010069c:	57                   	push   %edi
+f010069d:	56                   	push   %esi
+f010069e:	53                   	push   %ebx
+f010069f:	83 ec 0c             	sub    $0xc,%esp
+	was = *cp;
+f01006a2:	0f b7 15 00 80 0b f0 	movzwl 0xf00b8000,%edx
+	*cp = (uint16_t) 0xA55A;
+f01006a9:	66 c7 05 00 80 0b f0 	movw   $0xa55a,0xf00b8000
+f01006b0:	5a a5 
+	if (*cp != 0xA55A) {
+f01006b2:	0f b7 05 00 80 0b f0 	movzwl 0xf00b8000,%eax
+f01006b9:	bb b4 03 00 00       	mov    $0x3b4,%ebx
+		cp = (uint16_t*) (KERNBASE + MONO_BUF);
+f01006be:	be 00 00 0b f0       	mov    $0xf00b0000,%esi
+	if (*cp != 0xA55A) {
+f01006c3:	66 3d 5a a5          	cmp    $0xa55a,%ax
+f01006c7:	0f 84 cd 00 00 00    	je     f010079a <cons_init+0x101>
+		addr_6845 = MONO_BASE;
+f01006cd:	89 1d 30 72 85 f0    	mov    %ebx,0xf0857230
+f01006d3:	b8 0e 00 00 00       	mov    $0xe,%eax
+f01006d8:	89 da                	mov    %ebx,%edx
+f01006da:	ee                   	out    %al,(%dx)
+	pos = inb(addr_6845 + 1) << 8;
+f01006db:	8d 7b 01             	lea    0x1(%ebx),%edi
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01006de:	89 fa                	mov    %edi,%edx
+f01006e0:	ec                   	in     (%dx),%al
+f01006e1:	0f b6 c8             	movzbl %al,%ecx
+f01006e4:	c1 e1 08             	shl    $0x8,%ecx
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01006e7:	b8 0f 00 00 00       	mov    $0xf,%eax
+f01006ec:	89 da                	mov    %ebx,%edx
+f01006ee:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01006ef:	89 fa                	mov    %edi,%edx
+f01006f1:	ec                   	in     (%dx),%al
+	crt_buf = (uint16_t*) cp;
+f01006f2:	89 35 2c 72 85 f0    	mov    %esi,0xf085722c
+	pos |= inb(addr_6845 + 1);
+f01006f8:	0f b6 c0             	movzbl %al,%eax
+f01006fb:	09 c8                	or     %ecx,%eax
+	crt_pos = pos;
+f01006fd:	66 a3 28 72 85 f0    	mov    %ax,0xf0857228
+	kbd_intr();
+f0100703:	e8 3d ff ff ff       	call   f0100645 <kbd_intr>
+	irq_setmask_8259A(irq_mask_8259A & ~(1<<1));
+f0100708:	83 ec 0c             	sub    $0xc,%esp
+f010070b:	0f b7 05 a8 53 11 f0 	movzwl 0xf01153a8,%eax
+f0100712:	25 fd ff 00 00       	and    $0xfffd,%eax
+f0100717:	50                   	push   %eax
+f0100718:	e8 6b 3c 00 00       	call   f0104388 <irq_setmask_8259A>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010071d:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0100722:	bb fa 03 00 00       	mov    $0x3fa,%ebx
+f0100727:	89 c8                	mov    %ecx,%eax
+f0100729:	89 da                	mov    %ebx,%edx
+f010072b:	ee                   	out    %al,(%dx)
+f010072c:	bf fb 03 00 00       	mov    $0x3fb,%edi
+f0100731:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+f0100736:	89 fa                	mov    %edi,%edx
+f0100738:	ee                   	out    %al,(%dx)
+f0100739:	b8 0c 00 00 00       	mov    $0xc,%eax
+f010073e:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100743:	ee                   	out    %al,(%dx)
+f0100744:	be f9 03 00 00       	mov    $0x3f9,%esi
+f0100749:	89 c8                	mov    %ecx,%eax
+f010074b:	89 f2                	mov    %esi,%edx
+f010074d:	ee                   	out    %al,(%dx)
+f010074e:	b8 03 00 00 00       	mov    $0x3,%eax
+f0100753:	89 fa                	mov    %edi,%edx
+f0100755:	ee                   	out    %al,(%dx)
+f0100756:	ba fc 03 00 00       	mov    $0x3fc,%edx
+f010075b:	89 c8                	mov    %ecx,%eax
+f010075d:	ee                   	out    %al,(%dx)
+f010075e:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100763:	89 f2                	mov    %esi,%edx
+f0100765:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100766:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f010076b:	ec                   	in     (%dx),%al
+f010076c:	89 c1                	mov    %eax,%ecx
+	serial_exists = (inb(COM1+COM_LSR) != 0xFF);
+f010076e:	83 c4 10             	add    $0x10,%esp
+f0100771:	3c ff                	cmp    $0xff,%al
+f0100773:	0f 95 05 34 72 85 f0 	setne  0xf0857234
+f010077a:	89 da                	mov    %ebx,%edx
+f010077c:	ec                   	in     (%dx),%al
+f010077d:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100782:	ec                   	in     (%dx),%al
+	if (serial_exists)
+f0100783:	80 f9 ff             	cmp    $0xff,%cl
+f0100786:	75 28                	jne    f01007b0 <cons_init+0x117>
+	cga_init();
+	kbd_init();
+	serial_init();
+
+	if (!serial_exists)
+		cprintf("Serial port does not exist!\n");
+f0100788:	83 ec 0c             	sub    $0xc,%esp
+f010078b:	68 8f 86 10 f0       	push   $0xf010868f
+f0100790:	e8 55 3d 00 00       	call   f01044ea <cprintf>
+f0100795:	83 c4 10             	add    $0x10,%esp
+}
+f0100798:	eb 37                	jmp    f01007d1 <cons_init+0x138>
+		*cp = was;
+f010079a:	66 89 15 00 80 0b f0 	mov    %dx,0xf00b8000
+f01007a1:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+	cp = (uint16_t*) (KERNBASE + CGA_BUF);
+f01007a6:	be 00 80 0b f0       	mov    $0xf00b8000,%esi
+f01007ab:	e9 1d ff ff ff       	jmp    f01006cd <cons_init+0x34>
+		irq_setmask_8259A(irq_mask_8259A & ~(1<<4));
+f01007b0:	83 ec 0c             	sub    $0xc,%esp
+f01007b3:	0f b7 05 a8 53 11 f0 	movzwl 0xf01153a8,%eax
+f01007ba:	25 ef ff 00 00       	and    $0xffef,%eax
+f01007bf:	50                   	push   %eax
+f01007c0:	e8 c3 3b 00 00       	call   f0104388 <irq_setmask_8259A>
+	if (!serial_exists)
+f01007c5:	83 c4 10             	add    $0x10,%esp
+f01007c8:	80 3d 34 72 85 f0 00 	cmpb   $0x0,0xf0857234
+f01007cf:	74 b7                	je     f0100788 <cons_init+0xef>
+}
+f01007d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01007d4:	5b                   	pop    %ebx
+f01007d5:	5e                   	pop    %esi
+f01007d6:	5f                   	pop    %edi
+f01007d7:	5d                   	pop    %ebp
+f01007d8:	c3                   	ret
+
+f01007d9 <cputchar>:
+
+// `High'-level console I/O.  Used by readline and cprintf.
+
+void
+cputchar(int c)
+{
+f01007d9:	55                   	push   %ebp
+f01007da:	89 e5                	mov    %esp,%ebp
+f01007dc:	83 ec 08             	sub    $0x8,%esp
+	cons_putc(c);
+f01007df:	8b 45 08             	mov    0x8(%ebp),%eax
+f01007e2:	e8 46 fc ff ff       	call   f010042d <cons_putc>
+}
+f01007e7:	c9                   	leave
+f01007e8:	c3                   	ret
+
+f01007e9 <getchar>:
+
+int
+getchar(void)
+{
+f01007e9:	55                   	push   %ebp
+f01007ea:	89 e5                	mov    %esp,%ebp
+f01007ec:	83 ec 08             	sub    $0x8,%esp
+	int c;
+
+	while ((c = cons_getc()) == 0)
+f01007ef:	e8 63 fe ff ff       	call   f0100657 <cons_getc>
+f01007f4:	85 c0                	test   %eax,%eax
+f01007f6:	74 f7                	je     f01007ef <getchar+0x6>
+		/* do nothing */;
+	return c;
+}
+f01007f8:	c9                   	leave
+f01007f9:	c3                   	ret
+
+f01007fa <iscons>:
+int
+iscons(int fdnum)
+{
+	// used by readline
+	return 1;
+}
+f01007fa:	b8 01 00 00 00       	mov    $0x1,%eax
+f01007ff:	c3                   	ret
+
+f0100800 <mon_help>:
+
+/***** Implementations of basic kernel monitor commands *****/
+
+int
+mon_help(int argc, char **argv, struct Trapframe *tf)
+{
+f0100800:	55                   	push   %ebp
+f0100801:	89 e5                	mov    %esp,%ebp
+f0100803:	56                   	push   %esi
+f0100804:	53                   	push   %ebx
+	int i;
+
+	for (i = 0; i < NCOMMANDS; i++)
+f0100805:	bb 00 94 10 f0       	mov    $0xf0109400,%ebx
+f010080a:	be 60 94 10 f0       	mov    $0xf0109460,%esi
+f010080f:	eb 18                	jmp    f0100829 <mon_help+0x29>
+		cprintf("%s - %s\n", commands[i].name, commands[i].desc);
+f0100811:	83 ec 04             	sub    $0x4,%esp
+f0100814:	ff 73 04             	push   0x4(%ebx)
+f0100817:	ff 33                	push   (%ebx)
+f0100819:	68 e0 88 10 f0       	push   $0xf01088e0
+f010081e:	e8 c7 3c 00 00       	call   f01044ea <cprintf>
+	for (i = 0; i < NCOMMANDS; i++)
+f0100823:	83 c3 0c             	add    $0xc,%ebx
+f0100826:	83 c4 10             	add    $0x10,%esp
+f0100829:	39 f3                	cmp    %esi,%ebx
+f010082b:	75 e4                	jne    f0100811 <mon_help+0x11>
+	return 0;
+}
+f010082d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100832:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0100835:	5b                   	pop    %ebx
+f0100836:	5e                   	pop    %esi
+f0100837:	5d                   	pop    %ebp
+f0100838:	c3                   	ret
+
+f0100839 <mon_kerninfo>:
+
+int
+mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
+{
+f0100839:	55                   	push   %ebp
+f010083a:	89 e5                	mov    %esp,%ebp
+f010083c:	83 ec 14             	sub    $0x14,%esp
+	extern char _start[], entry[], etext[], edata[], end[];
+
+	cprintf("Special kernel symbols:\n");
+f010083f:	68 e9 88 10 f0       	push   $0xf01088e9
+f0100844:	e8 a1 3c 00 00       	call   f01044ea <cprintf>
+	cprintf("  _start                  %08x (phys)\n", _start);
+f0100849:	83 c4 08             	add    $0x8,%esp
+f010084c:	68 0c 00 10 00       	push   $0x10000c
+f0100851:	68 10 8b 10 f0       	push   $0xf0108b10
+f0100856:	e8 8f 3c 00 00       	call   f01044ea <cprintf>
+	cprintf("  entry  %08x (virt)  %08x (phys)\n", entry, entry - KERNBASE);
+f010085b:	83 c4 0c             	add    $0xc,%esp
+f010085e:	68 0c 00 10 00       	push   $0x10000c
+f0100863:	68 0c 00 10 f0       	push   $0xf010000c
+f0100868:	68 38 8b 10 f0       	push   $0xf0108b38
+f010086d:	e8 78 3c 00 00       	call   f01044ea <cprintf>
+	cprintf("  etext  %08x (virt)  %08x (phys)\n", etext, etext - KERNBASE);
+f0100872:	83 c4 0c             	add    $0xc,%esp
+f0100875:	68 ab 85 10 00       	push   $0x1085ab
+f010087a:	68 ab 85 10 f0       	push   $0xf01085ab
+f010087f:	68 5c 8b 10 f0       	push   $0xf0108b5c
+f0100884:	e8 61 3c 00 00       	call   f01044ea <cprintf>
+	cprintf("  edata  %08x (virt)  %08x (phys)\n", edata, edata - KERNBASE);
+f0100889:	83 c4 0c             	add    $0xc,%esp
+f010088c:	68 34 60 85 00       	push   $0x856034
+f0100891:	68 34 60 85 f0       	push   $0xf0856034
+f0100896:	68 80 8b 10 f0       	push   $0xf0108b80
+f010089b:	e8 4a 3c 00 00       	call   f01044ea <cprintf>
+	cprintf("  end    %08x (virt)  %08x (phys)\n", end, end - KERNBASE);
+f01008a0:	83 c4 0c             	add    $0xc,%esp
+f01008a3:	68 08 c0 89 00       	push   $0x89c008
+f01008a8:	68 08 c0 89 f0       	push   $0xf089c008
+f01008ad:	68 a4 8b 10 f0       	push   $0xf0108ba4
+f01008b2:	e8 33 3c 00 00       	call   f01044ea <cprintf>
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f01008b7:	83 c4 08             	add    $0x8,%esp
+		ROUNDUP(end - entry, 1024) / 1024);
+f01008ba:	b8 08 c0 89 f0       	mov    $0xf089c008,%eax
+f01008bf:	2d 0d fc 0f f0       	sub    $0xf00ffc0d,%eax
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f01008c4:	c1 f8 0a             	sar    $0xa,%eax
+f01008c7:	50                   	push   %eax
+f01008c8:	68 c8 8b 10 f0       	push   $0xf0108bc8
+f01008cd:	e8 18 3c 00 00       	call   f01044ea <cprintf>
+	return 0;
+}
+f01008d2:	b8 00 00 00 00       	mov    $0x0,%eax
+f01008d7:	c9                   	leave
+f01008d8:	c3                   	ret
+
+f01008d9 <mon_meminfo>:
+
+// Displays the buddy allocator's free blocks of each order, and how much
+// of free memory is in blocks too small for a large page.
+int
+mon_meminfo(int argc, char **argv, struct Trapframe *tf)
+{
+f01008d9:	55                   	push   %ebp
+f01008da:	89 e5                	mov    %esp,%ebp
+f01008dc:	57                   	push   %edi
+f01008dd:	56                   	push   %esi
+f01008de:	53                   	push   %ebx
+f01008df:	83 ec 58             	sub    $0x58,%esp
+	size_t nblocks[PAGE_MAX_ORDER + 1], nfree, nsmall = 0;
+	int order, largest = -1;
+
+	nfree = page_free_stats(nblocks);
+f01008e2:	8d 45 bc             	lea    -0x44(%ebp),%eax
+f01008e5:	50                   	push   %eax
+f01008e6:	e8 82 0f 00 00       	call   f010186d <page_free_stats>
+f01008eb:	89 c7                	mov    %eax,%edi
+f01008ed:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+	cprintf("Free memory: %u pages (%uK)\n", nfree, nfree * PGSIZE / 1024);
+f01008f0:	83 c4 0c             	add    $0xc,%esp
+f01008f3:	c1 e0 0c             	shl    $0xc,%eax
+f01008f6:	c1 e8 0a             	shr    $0xa,%eax
+f01008f9:	50                   	push   %eax
+f01008fa:	57                   	push   %edi
+f01008fb:	68 02 89 10 f0       	push   $0xf0108902
+f0100900:	e8 e5 3b 00 00       	call   f01044ea <cprintf>
+	cprintf("order   blocks    pages\n");
+f0100905:	c7 04 24 1f 89 10 f0 	movl   $0xf010891f,(%esp)
+f010090c:	e8 d9 3b 00 00       	call   f01044ea <cprintf>
+f0100911:	83 c4 10             	add    $0x10,%esp
+	int order, largest = -1;
+f0100914:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	for (order = 0; order <= PAGE_MAX_ORDER; order++) {
+f0100919:	bb 00 00 00 00       	mov    $0x0,%ebx
+	size_t nblocks[PAGE_MAX_ORDER + 1], nfree, nsmall = 0;
+f010091e:	be 00 00 00 00       	mov    $0x0,%esi
+		cprintf("%5d %8u %8u\n", order, nblocks[order], nblocks[order] << order);
+f0100923:	8b 44 9d bc          	mov    -0x44(%ebp,%ebx,4),%eax
+f0100927:	89 c2                	mov    %eax,%edx
+f0100929:	89 d9                	mov    %ebx,%ecx
+f010092b:	d3 e2                	shl    %cl,%edx
+f010092d:	52                   	push   %edx
+f010092e:	50                   	push   %eax
+f010092f:	53                   	push   %ebx
+f0100930:	68 38 89 10 f0       	push   $0xf0108938
+f0100935:	e8 b0 3b 00 00       	call   f01044ea <cprintf>
+		if (nblocks[order])
+f010093a:	8b 44 9d bc          	mov    -0x44(%ebp,%ebx,4),%eax
+f010093e:	83 c4 10             	add    $0x10,%esp
+f0100941:	85 c0                	test   %eax,%eax
+f0100943:	0f 45 fb             	cmovne %ebx,%edi
+			largest = order;
+		if (order < PAGE_MAX_ORDER)
+			nsmall += nblocks[order] << order;
+f0100946:	89 d9                	mov    %ebx,%ecx
+f0100948:	d3 e0                	shl    %cl,%eax
+f010094a:	01 f0                	add    %esi,%eax
+f010094c:	83 fb 0a             	cmp    $0xa,%ebx
+f010094f:	0f 4c f0             	cmovl  %eax,%esi
+	for (order = 0; order <= PAGE_MAX_ORDER; order++) {
+f0100952:	83 c3 01             	add    $0x1,%ebx
+f0100955:	83 fb 0b             	cmp    $0xb,%ebx
+f0100958:	75 c9                	jne    f0100923 <mon_meminfo+0x4a>
+	}
+	if (largest >= 0)
+f010095a:	85 ff                	test   %edi,%edi
+f010095c:	79 13                	jns    f0100971 <mon_meminfo+0x98>
+		cprintf("Largest free block: %uK\n", (PGSIZE << largest) / 1024);
+	// The share of free memory that no large page can come from
+	if (nfree)
+f010095e:	83 7d b4 00          	cmpl   $0x0,-0x4c(%ebp)
+f0100962:	75 37                	jne    f010099b <mon_meminfo+0xc2>
+		cprintf("Fragmentation: %u%% of free memory is in blocks under %uK\n",
+			nsmall * 100 / nfree, (PGSIZE << PAGE_MAX_ORDER) / 1024);
+	return 0;
+}
+f0100964:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100969:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010096c:	5b                   	pop    %ebx
+f010096d:	5e                   	pop    %esi
+f010096e:	5f                   	pop    %edi
+f010096f:	5d                   	pop    %ebp
+f0100970:	c3                   	ret
+		cprintf("Largest free block: %uK\n", (PGSIZE << largest) / 1024);
+f0100971:	83 ec 08             	sub    $0x8,%esp
+f0100974:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0100979:	89 f9                	mov    %edi,%ecx
+f010097b:	d3 e2                	shl    %cl,%edx
+f010097d:	8d 82 ff 03 00 00    	lea    0x3ff(%edx),%eax
+f0100983:	85 d2                	test   %edx,%edx
+f0100985:	0f 49 c2             	cmovns %edx,%eax
+f0100988:	c1 f8 0a             	sar    $0xa,%eax
+f010098b:	50                   	push   %eax
+f010098c:	68 45 89 10 f0       	push   $0xf0108945
+f0100991:	e8 54 3b 00 00       	call   f01044ea <cprintf>
+f0100996:	83 c4 10             	add    $0x10,%esp
+f0100999:	eb c3                	jmp    f010095e <mon_meminfo+0x85>
+		cprintf("Fragmentation: %u%% of free memory is in blocks under %uK\n",
+f010099b:	83 ec 04             	sub    $0x4,%esp
+f010099e:	68 00 10 00 00       	push   $0x1000
+			nsmall * 100 / nfree, (PGSIZE << PAGE_MAX_ORDER) / 1024);
+f01009a3:	6b c6 64             	imul   $0x64,%esi,%eax
+		cprintf("Fragmentation: %u%% of free memory is in blocks under %uK\n",
+f01009a6:	ba 00 00 00 00       	mov    $0x0,%edx
+f01009ab:	f7 75 b4             	divl   -0x4c(%ebp)
+f01009ae:	50                   	push   %eax
+f01009af:	68 f4 8b 10 f0       	push   $0xf0108bf4
+f01009b4:	e8 31 3b 00 00       	call   f01044ea <cprintf>
+f01009b9:	83 c4 10             	add    $0x10,%esp
+f01009bc:	eb a6                	jmp    f0100964 <mon_meminfo+0x8b>
+
+f01009be <mon_rss>:
+// has (see sys_env_set_rss), and how many of its pages the paging
+// servers have taken.  'rss <envid> <min> <max>' sets an environment's
+// guarantee and limit first, in pages; a limit of 0 means none.
+int
+mon_rss(int argc, char **argv, struct Trapframe *tf)
+{
+f01009be:	55                   	push   %ebp
+f01009bf:	89 e5                	mov    %esp,%ebp
+f01009c1:	57                   	push   %edi
+f01009c2:	56                   	push   %esi
+f01009c3:	53                   	push   %ebx
+f01009c4:	83 ec 1c             	sub    $0x1c,%esp
+f01009c7:	8b 75 08             	mov    0x8(%ebp),%esi
+f01009ca:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	long args[3];
+	struct Env *e;
+	int i, error = 0;
+
+	// expects no args, or an envid (in hex) and two page counts
+	if (argc != 1 && argc != 4) {
+f01009cd:	83 fe 01             	cmp    $0x1,%esi
+f01009d0:	0f 95 c0             	setne  %al
+f01009d3:	83 fe 04             	cmp    $0x4,%esi
+f01009d6:	0f 95 c2             	setne  %dl
+f01009d9:	0f b6 d2             	movzbl %dl,%edx
+f01009dc:	21 c2                	and    %eax,%edx
+f01009de:	bb 00 00 00 00       	mov    $0x0,%ebx
+		error = 1;
+	}
+	for (i = 0; !error && argc == 4 && i < 3; ++i) {
+f01009e3:	85 d2                	test   %edx,%edx
+f01009e5:	0f 94 c0             	sete   %al
+f01009e8:	83 fe 04             	cmp    $0x4,%esi
+f01009eb:	0f 94 c1             	sete   %cl
+f01009ee:	21 c8                	and    %ecx,%eax
+f01009f0:	83 fb 02             	cmp    $0x2,%ebx
+f01009f3:	7f 31                	jg     f0100a26 <mon_rss+0x68>
+f01009f5:	84 c0                	test   %al,%al
+f01009f7:	74 2d                	je     f0100a26 <mon_rss+0x68>
+		if (!strisl(argv[i+1], i ? 10 : 16, args+i)) {
+f01009f9:	8d 54 9d dc          	lea    -0x24(%ebp,%ebx,4),%edx
+f01009fd:	83 fb 01             	cmp    $0x1,%ebx
+f0100a00:	19 c0                	sbb    %eax,%eax
+f0100a02:	83 e0 06             	and    $0x6,%eax
+f0100a05:	83 c0 0a             	add    $0xa,%eax
+f0100a08:	83 ec 04             	sub    $0x4,%esp
+f0100a0b:	52                   	push   %edx
+f0100a0c:	50                   	push   %eax
+f0100a0d:	ff 74 9f 04          	push   0x4(%edi,%ebx,4)
+f0100a11:	e8 58 6f 00 00       	call   f010796e <strisl>
+f0100a16:	83 c4 10             	add    $0x10,%esp
+f0100a19:	85 c0                	test   %eax,%eax
+f0100a1b:	0f 94 c2             	sete   %dl
+f0100a1e:	0f b6 d2             	movzbl %dl,%edx
+	for (i = 0; !error && argc == 4 && i < 3; ++i) {
+f0100a21:	83 c3 01             	add    $0x1,%ebx
+f0100a24:	eb bd                	jmp    f01009e3 <mon_rss+0x25>
+			error = 1;
+		}
+	}
+	if (!error && argc == 4 && (!args[0] || envid2env(args[0], &e, 0) < 0 ||
+f0100a26:	84 c0                	test   %al,%al
+f0100a28:	74 61                	je     f0100a8b <mon_rss+0xcd>
+f0100a2a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0100a2d:	85 c0                	test   %eax,%eax
+f0100a2f:	75 1d                	jne    f0100a4e <mon_rss+0x90>
+	    args[1] < 0 || args[2] < 0 || (args[2] && args[2] < args[1]))) {
+		error = 1;
+	}
+	if (error) {
+		cprintf("Proper usage is 'rss' or 'rss <envid> <min> <max>' (e.g. 'rss 1001 256 0'), which first sets the (hexadecimal) environment's guarantee and limit, in pages.\n");
+f0100a31:	83 ec 0c             	sub    $0xc,%esp
+f0100a34:	68 30 8c 10 f0       	push   $0xf0108c30
+f0100a39:	e8 ac 3a 00 00       	call   f01044ea <cprintf>
+		return 0;
+f0100a3e:	83 c4 10             	add    $0x10,%esp
+	for (e = envs; e < envs + NENV; e++)
+		if (e->env_status != ENV_FREE)
+			cprintf("%08x %4d %7d %7d %7d %10u\n", e->env_id, e->env_type,
+				e->env_npages, e->env_rss_min, e->env_rss_max, e->env_rss_reclaimed);
+	return 0;
+}
+f0100a41:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100a46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100a49:	5b                   	pop    %ebx
+f0100a4a:	5e                   	pop    %esi
+f0100a4b:	5f                   	pop    %edi
+f0100a4c:	5d                   	pop    %ebp
+f0100a4d:	c3                   	ret
+	if (!error && argc == 4 && (!args[0] || envid2env(args[0], &e, 0) < 0 ||
+f0100a4e:	83 ec 04             	sub    $0x4,%esp
+f0100a51:	6a 00                	push   $0x0
+f0100a53:	8d 55 d8             	lea    -0x28(%ebp),%edx
+f0100a56:	52                   	push   %edx
+f0100a57:	50                   	push   %eax
+f0100a58:	e8 6e 2a 00 00       	call   f01034cb <envid2env>
+f0100a5d:	83 c4 10             	add    $0x10,%esp
+f0100a60:	85 c0                	test   %eax,%eax
+f0100a62:	78 cd                	js     f0100a31 <mon_rss+0x73>
+	    args[1] < 0 || args[2] < 0 || (args[2] && args[2] < args[1]))) {
+f0100a64:	8b 45 e0             	mov    -0x20(%ebp),%eax
+	if (!error && argc == 4 && (!args[0] || envid2env(args[0], &e, 0) < 0 ||
+f0100a67:	85 c0                	test   %eax,%eax
+f0100a69:	78 c6                	js     f0100a31 <mon_rss+0x73>
+	    args[1] < 0 || args[2] < 0 || (args[2] && args[2] < args[1]))) {
+f0100a6b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0100a6e:	85 d2                	test   %edx,%edx
+f0100a70:	78 bf                	js     f0100a31 <mon_rss+0x73>
+f0100a72:	39 d0                	cmp    %edx,%eax
+f0100a74:	7e 04                	jle    f0100a7a <mon_rss+0xbc>
+f0100a76:	85 d2                	test   %edx,%edx
+f0100a78:	75 b7                	jne    f0100a31 <mon_rss+0x73>
+		e->env_rss_min = args[1];
+f0100a7a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0100a7d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0100a80:	89 50 68             	mov    %edx,0x68(%eax)
+		e->env_rss_max = args[2];
+f0100a83:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0100a86:	89 50 6c             	mov    %edx,0x6c(%eax)
+f0100a89:	eb 09                	jmp    f0100a94 <mon_rss+0xd6>
+	if (error) {
+f0100a8b:	85 d2                	test   %edx,%edx
+f0100a8d:	75 a2                	jne    f0100a31 <mon_rss+0x73>
+	if (argc == 4) {
+f0100a8f:	83 fe 04             	cmp    $0x4,%esi
+f0100a92:	74 e6                	je     f0100a7a <mon_rss+0xbc>
+	cprintf("env      type   pages     min     max  reclaimed\n");
+f0100a94:	83 ec 0c             	sub    $0xc,%esp
+f0100a97:	68 d0 8c 10 f0       	push   $0xf0108cd0
+f0100a9c:	e8 49 3a 00 00       	call   f01044ea <cprintf>
+	for (e = envs; e < envs + NENV; e++)
+f0100aa1:	a1 e0 92 85 f0       	mov    0xf08592e0,%eax
+f0100aa6:	83 c4 10             	add    $0x10,%esp
+f0100aa9:	eb 08                	jmp    f0100ab3 <mon_rss+0xf5>
+f0100aab:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0100aae:	05 40 01 00 00       	add    $0x140,%eax
+f0100ab3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0100ab6:	8b 3d e0 92 85 f0    	mov    0xf08592e0,%edi
+f0100abc:	8d 97 00 00 05 00    	lea    0x50000(%edi),%edx
+f0100ac2:	39 d0                	cmp    %edx,%eax
+f0100ac4:	0f 83 77 ff ff ff    	jae    f0100a41 <mon_rss+0x83>
+		if (e->env_status != ENV_FREE)
+f0100aca:	83 78 54 00          	cmpl   $0x0,0x54(%eax)
+f0100ace:	74 db                	je     f0100aab <mon_rss+0xed>
+			cprintf("%08x %4d %7d %7d %7d %10u\n", e->env_id, e->env_type,
+f0100ad0:	83 ec 04             	sub    $0x4,%esp
+f0100ad3:	ff 70 70             	push   0x70(%eax)
+f0100ad6:	ff 70 6c             	push   0x6c(%eax)
+f0100ad9:	ff 70 68             	push   0x68(%eax)
+f0100adc:	ff 70 64             	push   0x64(%eax)
+f0100adf:	ff 70 50             	push   0x50(%eax)
+f0100ae2:	ff 70 48             	push   0x48(%eax)
+f0100ae5:	68 5e 89 10 f0       	push   $0xf010895e
+f0100aea:	e8 fb 39 00 00       	call   f01044ea <cprintf>
+f0100aef:	83 c4 20             	add    $0x20,%esp
+f0100af2:	eb b7                	jmp    f0100aab <mon_rss+0xed>
+
+f0100af4 <mon_backtrace>:
+
+// Displays a stack backtrace. Returns 0 on success.
+int
+mon_backtrace(int argc, char **argv, struct Trapframe *tf)
+{
+f0100af4:	55                   	push   %ebp
+f0100af5:	89 e5                	mov    %esp,%ebp
+f0100af7:	57                   	push   %edi
+f0100af8:	56                   	push   %esi
+f0100af9:	53                   	push   %ebx
+f0100afa:	83 ec 38             	sub    $0x38,%esp
+
+	// eip instruction pointer debugging information struct.
+	// Must be a struct, not a struct pointer, so that space for the struct is automatically allocated in memory.
+	// This space is used to store the debugging information that is computed in debuginfo_eip().
+	struct Eipdebuginfo info;
+	cprintf("Stack backtrace:\n");
+f0100afd:	68 79 89 10 f0       	push   $0xf0108979
+f0100b02:	e8 e3 39 00 00       	call   f01044ea <cprintf>
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+f0100b07:	89 e8                	mov    %ebp,%eax
+	 **                 ebp is always the ebp base pointer for that function, and eip is always the return eip instruction pointer for that function.
+	 ** condition:      ebp != 0. At the start of the stack trace, ebp is initialized to 0. Check for this, and when ebp == 0, stop traversing the stack.
+	 ** increment:      The next ebp base pointer is the value pointed to by the current ebp base pointer.
+	 **                 The next eip instruction pointer is the 1-st element in the stack above the next ebp base pointer.
+	 */
+	for (ebp = (uint32_t *) read_ebp(), eip = (uintptr_t) (ebp[1]); ebp; ebp = (uint32_t *) (ebp[0]), eip = (uintptr_t) (ebp[1])) {
+f0100b09:	89 c3                	mov    %eax,%ebx
+f0100b0b:	8b 70 04             	mov    0x4(%eax),%esi
+f0100b0e:	83 c4 10             	add    $0x10,%esp
+
+		// Print the ebp base pointer, the eip instruction pointer, and the first five arguments to the current function, all as 8-digit hexidecimal numbers (32-bit integers).
+		cprintf("  ebp %08x  eip %08x  args %08x %08x %08x %08x %08x \n", (uint32_t) ebp, (uint32_t) eip, ebp[2], ebp[3], ebp[4], ebp[5], ebp[6]);
+		debuginfo_eip(eip, &info);  // Get the eip instruction pointer debugging information for the calling function, and store it in info.
+f0100b11:	8d 7d d0             	lea    -0x30(%ebp),%edi
+		cprintf("  ebp %08x  eip %08x  args %08x %08x %08x %08x %08x \n", (uint32_t) ebp, (uint32_t) eip, ebp[2], ebp[3], ebp[4], ebp[5], ebp[6]);
+f0100b14:	ff 73 18             	push   0x18(%ebx)
+f0100b17:	ff 73 14             	push   0x14(%ebx)
+f0100b1a:	ff 73 10             	push   0x10(%ebx)
+f0100b1d:	ff 73 0c             	push   0xc(%ebx)
+f0100b20:	ff 73 08             	push   0x8(%ebx)
+f0100b23:	56                   	push   %esi
+f0100b24:	53                   	push   %ebx
+f0100b25:	68 04 8d 10 f0       	push   $0xf0108d04
+f0100b2a:	e8 bb 39 00 00       	call   f01044ea <cprintf>
+		debuginfo_eip(eip, &info);  // Get the eip instruction pointer debugging information for the calling function, and store it in info.
+f0100b2f:	83 c4 18             	add    $0x18,%esp
+f0100b32:	57                   	push   %edi
+f0100b33:	56                   	push   %esi
+f0100b34:	e8 69 61 00 00       	call   f0106ca2 <debuginfo_eip>
+
+		// Print the file name that the calling function is defined in; the line number of return instruction, the name of the calling function,
+		// and the byte offset of the return instruction from the start of the calling function.
+		cprintf("         %s:%d: %.*s+%d\n", info.eip_file, info.eip_line, info.eip_fn_namelen, info.eip_fn_name, eip-info.eip_fn_addr);
+f0100b39:	83 c4 08             	add    $0x8,%esp
+f0100b3c:	2b 75 e0             	sub    -0x20(%ebp),%esi
+f0100b3f:	56                   	push   %esi
+f0100b40:	ff 75 d8             	push   -0x28(%ebp)
+f0100b43:	ff 75 dc             	push   -0x24(%ebp)
+f0100b46:	ff 75 d4             	push   -0x2c(%ebp)
+f0100b49:	ff 75 d0             	push   -0x30(%ebp)
+f0100b4c:	68 8b 89 10 f0       	push   $0xf010898b
+f0100b51:	e8 94 39 00 00       	call   f01044ea <cprintf>
+	for (ebp = (uint32_t *) read_ebp(), eip = (uintptr_t) (ebp[1]); ebp; ebp = (uint32_t *) (ebp[0]), eip = (uintptr_t) (ebp[1])) {
+f0100b56:	8b 1b                	mov    (%ebx),%ebx
+f0100b58:	8b 73 04             	mov    0x4(%ebx),%esi
+f0100b5b:	83 c4 20             	add    $0x20,%esp
+f0100b5e:	85 db                	test   %ebx,%ebx
+f0100b60:	75 b2                	jne    f0100b14 <mon_backtrace+0x20>
+	}
+	return 0;
+}
+f0100b62:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100b67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100b6a:	5b                   	pop    %ebx
+f0100b6b:	5e                   	pop    %esi
+f0100b6c:	5f                   	pop    %edi
+f0100b6d:	5d                   	pop    %ebp
+f0100b6e:	c3                   	ret
+
+f0100b6f <mon_showmappings>:
+
+// Displays physical page mappings. Returns 0 on success.
+// On input error, displays usage message.
+int
+mon_showmappings(int argc, char **argv, struct Trapframe *tf)
+{
+f0100b6f:	55                   	push   %ebp
+f0100b70:	89 e5                	mov    %esp,%ebp
+f0100b72:	57                   	push   %edi
+f0100b73:	56                   	push   %esi
+f0100b74:	53                   	push   %ebx
+f0100b75:	83 ec 2c             	sub    $0x2c,%esp
+f0100b78:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	static char * header       = "VPN        Flags                      Physical page";
+	static char * flags_header = "           AVL G PS D A CD WT U W P";
+	static char * boundary     = "---------------------------------------------------";
+
+	// expects two args in addition to the command name
+	if (argc != 3) {
+f0100b7b:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+f0100b7f:	74 1d                	je     f0100b9e <mon_showmappings+0x2f>
+		error = 1;
+	}
+
+	// if there are any formatting errors, print usage message and return
+	if (error) {
+		cprintf("Proper usage is 'showmappings <start> <end>' (e.g. 'showmappings 0x3000 0x5000'), which displays mappings for linear (hexadecimal) addresses <start> through <end>, inclusive.\n");
+f0100b81:	83 ec 0c             	sub    $0xc,%esp
+f0100b84:	68 3c 8d 10 f0       	push   $0xf0108d3c
+f0100b89:	e8 5c 39 00 00       	call   f01044ea <cprintf>
+		return 0;
+f0100b8e:	83 c4 10             	add    $0x10,%esp
+			break;
+		}
+	}
+	cprintf("%s\n", boundary);
+	return 0;
+}
+f0100b91:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100b96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100b99:	5b                   	pop    %ebx
+f0100b9a:	5e                   	pop    %esi
+f0100b9b:	5f                   	pop    %edi
+f0100b9c:	5d                   	pop    %ebp
+f0100b9d:	c3                   	ret
+			if (strlen(argv[i+1])>10 || !strisl(argv[i+1], 16, ends+i)) {
+f0100b9e:	83 ec 0c             	sub    $0xc,%esp
+f0100ba1:	ff 73 04             	push   0x4(%ebx)
+f0100ba4:	e8 5a 6a 00 00       	call   f0107603 <strlen>
+f0100ba9:	83 c4 10             	add    $0x10,%esp
+f0100bac:	83 f8 0a             	cmp    $0xa,%eax
+f0100baf:	7f d0                	jg     f0100b81 <mon_showmappings+0x12>
+f0100bb1:	83 ec 04             	sub    $0x4,%esp
+f0100bb4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0100bb7:	50                   	push   %eax
+f0100bb8:	6a 10                	push   $0x10
+f0100bba:	ff 73 04             	push   0x4(%ebx)
+f0100bbd:	e8 ac 6d 00 00       	call   f010796e <strisl>
+f0100bc2:	83 c4 10             	add    $0x10,%esp
+f0100bc5:	85 c0                	test   %eax,%eax
+f0100bc7:	74 b8                	je     f0100b81 <mon_showmappings+0x12>
+f0100bc9:	83 ec 0c             	sub    $0xc,%esp
+f0100bcc:	ff 73 08             	push   0x8(%ebx)
+f0100bcf:	e8 2f 6a 00 00       	call   f0107603 <strlen>
+f0100bd4:	83 c4 10             	add    $0x10,%esp
+f0100bd7:	83 f8 0a             	cmp    $0xa,%eax
+f0100bda:	7f a5                	jg     f0100b81 <mon_showmappings+0x12>
+f0100bdc:	83 ec 04             	sub    $0x4,%esp
+f0100bdf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0100be2:	50                   	push   %eax
+f0100be3:	6a 10                	push   $0x10
+f0100be5:	ff 73 08             	push   0x8(%ebx)
+f0100be8:	e8 81 6d 00 00       	call   f010796e <strisl>
+f0100bed:	83 c4 10             	add    $0x10,%esp
+f0100bf0:	85 c0                	test   %eax,%eax
+f0100bf2:	74 8d                	je     f0100b81 <mon_showmappings+0x12>
+	if (!error && ends[0] > ends[1]) {
+f0100bf4:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f0100bf7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0100bfa:	39 c6                	cmp    %eax,%esi
+f0100bfc:	7f 83                	jg     f0100b81 <mon_showmappings+0x12>
+	ends[0] = ROUNDDOWN(ends[0], PGSIZE);
+f0100bfe:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f0100c04:	89 75 e0             	mov    %esi,-0x20(%ebp)
+	ends[1] = ROUNDUP(ends[1], PGSIZE);
+f0100c07:	05 ff 0f 00 00       	add    $0xfff,%eax
+f0100c0c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100c11:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (va = (uintptr_t)ends[0], i=0; ; va += PGSIZE, i = (i+1)%30) {
+f0100c14:	bf 00 00 00 00       	mov    $0x0,%edi
+f0100c19:	e9 e7 01 00 00       	jmp    f0100e05 <mon_showmappings+0x296>
+		cprintf("0x%05x    ", va>>PTXSHIFT);
+f0100c1e:	89 f0                	mov    %esi,%eax
+f0100c20:	c1 e8 0c             	shr    $0xc,%eax
+f0100c23:	83 ec 08             	sub    $0x8,%esp
+f0100c26:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0100c29:	50                   	push   %eax
+f0100c2a:	68 b0 89 10 f0       	push   $0xf01089b0
+f0100c2f:	e8 b6 38 00 00       	call   f01044ea <cprintf>
+		pte = pgdir_walk(kern_pgdir, (void *)va, 0);
+f0100c34:	83 c4 0c             	add    $0xc,%esp
+f0100c37:	6a 00                	push   $0x0
+f0100c39:	56                   	push   %esi
+f0100c3a:	ff 35 58 a0 85 f0    	push   0xf085a058
+f0100c40:	e8 a0 10 00 00       	call   f0101ce5 <pgdir_walk>
+f0100c45:	89 c3                	mov    %eax,%ebx
+		if (pte) {
+f0100c47:	83 c4 10             	add    $0x10,%esp
+f0100c4a:	85 c0                	test   %eax,%eax
+f0100c4c:	0f 84 0b 02 00 00    	je     f0100e5d <mon_showmappings+0x2ee>
+			cprintf("%01x", (PGOFF(*pte)>>11)&0x1);
+f0100c52:	83 ec 08             	sub    $0x8,%esp
+f0100c55:	8b 10                	mov    (%eax),%edx
+f0100c57:	c1 ea 0b             	shr    $0xb,%edx
+f0100c5a:	89 d0                	mov    %edx,%eax
+f0100c5c:	83 e0 01             	and    $0x1,%eax
+f0100c5f:	50                   	push   %eax
+f0100c60:	68 bb 89 10 f0       	push   $0xf01089bb
+f0100c65:	e8 80 38 00 00       	call   f01044ea <cprintf>
+			cprintf("%01x", (PGOFF(*pte)>>10)&0x1);
+f0100c6a:	83 c4 08             	add    $0x8,%esp
+f0100c6d:	8b 13                	mov    (%ebx),%edx
+f0100c6f:	c1 ea 0a             	shr    $0xa,%edx
+f0100c72:	89 d0                	mov    %edx,%eax
+f0100c74:	83 e0 01             	and    $0x1,%eax
+f0100c77:	50                   	push   %eax
+f0100c78:	68 bb 89 10 f0       	push   $0xf01089bb
+f0100c7d:	e8 68 38 00 00       	call   f01044ea <cprintf>
+			cprintf("%01x ", (PGOFF(*pte)>>9)&0x1);
+f0100c82:	83 c4 08             	add    $0x8,%esp
+f0100c85:	8b 13                	mov    (%ebx),%edx
+f0100c87:	c1 ea 09             	shr    $0x9,%edx
+f0100c8a:	89 d0                	mov    %edx,%eax
+f0100c8c:	83 e0 01             	and    $0x1,%eax
+f0100c8f:	50                   	push   %eax
+f0100c90:	68 c0 89 10 f0       	push   $0xf01089c0
+f0100c95:	e8 50 38 00 00       	call   f01044ea <cprintf>
+			cprintf("%c ", *pte & PTE_G ? 'G' : '-');
+f0100c9a:	8b 13                	mov    (%ebx),%edx
+f0100c9c:	81 e2 00 01 00 00    	and    $0x100,%edx
+f0100ca2:	83 c4 08             	add    $0x8,%esp
+f0100ca5:	83 fa 01             	cmp    $0x1,%edx
+f0100ca8:	19 c0                	sbb    %eax,%eax
+f0100caa:	83 e0 e6             	and    $0xffffffe6,%eax
+f0100cad:	83 c0 47             	add    $0x47,%eax
+f0100cb0:	50                   	push   %eax
+f0100cb1:	68 c6 89 10 f0       	push   $0xf01089c6
+f0100cb6:	e8 2f 38 00 00       	call   f01044ea <cprintf>
+			cprintf("%s ", *pte & PTE_PS ? "PS" : "--");
+f0100cbb:	83 c4 08             	add    $0x8,%esp
+f0100cbe:	f6 03 80             	testb  $0x80,(%ebx)
+f0100cc1:	b9 a4 89 10 f0       	mov    $0xf01089a4,%ecx
+f0100cc6:	ba a7 89 10 f0       	mov    $0xf01089a7,%edx
+f0100ccb:	0f 44 ca             	cmove  %edx,%ecx
+f0100cce:	51                   	push   %ecx
+f0100ccf:	68 ca 89 10 f0       	push   $0xf01089ca
+f0100cd4:	e8 11 38 00 00       	call   f01044ea <cprintf>
+			cprintf("%c ", *pte & PTE_D ? 'D' : '-');
+f0100cd9:	8b 0b                	mov    (%ebx),%ecx
+f0100cdb:	83 e1 40             	and    $0x40,%ecx
+f0100cde:	83 c4 08             	add    $0x8,%esp
+f0100ce1:	83 f9 01             	cmp    $0x1,%ecx
+f0100ce4:	19 c0                	sbb    %eax,%eax
+f0100ce6:	83 e0 e9             	and    $0xffffffe9,%eax
+f0100ce9:	83 c0 44             	add    $0x44,%eax
+f0100cec:	50                   	push   %eax
+f0100ced:	68 c6 89 10 f0       	push   $0xf01089c6
+f0100cf2:	e8 f3 37 00 00       	call   f01044ea <cprintf>
+			cprintf("%c ", *pte & PTE_A ? 'A' : '-');
+f0100cf7:	8b 0b                	mov    (%ebx),%ecx
+f0100cf9:	83 e1 20             	and    $0x20,%ecx
+f0100cfc:	83 c4 08             	add    $0x8,%esp
+f0100cff:	83 f9 01             	cmp    $0x1,%ecx
+f0100d02:	19 c0                	sbb    %eax,%eax
+f0100d04:	83 e0 ec             	and    $0xffffffec,%eax
+f0100d07:	83 c0 41             	add    $0x41,%eax
+f0100d0a:	50                   	push   %eax
+f0100d0b:	68 c6 89 10 f0       	push   $0xf01089c6
+f0100d10:	e8 d5 37 00 00       	call   f01044ea <cprintf>
+			cprintf("%s ", *pte & PTE_PCD ? "CD" : "--");
+f0100d15:	83 c4 08             	add    $0x8,%esp
+f0100d18:	f6 03 10             	testb  $0x10,(%ebx)
+f0100d1b:	b8 aa 89 10 f0       	mov    $0xf01089aa,%eax
+f0100d20:	ba a7 89 10 f0       	mov    $0xf01089a7,%edx
+f0100d25:	0f 44 c2             	cmove  %edx,%eax
+f0100d28:	50                   	push   %eax
+f0100d29:	68 ca 89 10 f0       	push   $0xf01089ca
+f0100d2e:	e8 b7 37 00 00       	call   f01044ea <cprintf>
+			cprintf("%s ", *pte & PTE_PWT ? "WT" : "--");
+f0100d33:	83 c4 08             	add    $0x8,%esp
+f0100d36:	f6 03 08             	testb  $0x8,(%ebx)
+f0100d39:	b8 ad 89 10 f0       	mov    $0xf01089ad,%eax
+f0100d3e:	ba a7 89 10 f0       	mov    $0xf01089a7,%edx
+f0100d43:	0f 44 c2             	cmove  %edx,%eax
+f0100d46:	50                   	push   %eax
+f0100d47:	68 ca 89 10 f0       	push   $0xf01089ca
+f0100d4c:	e8 99 37 00 00       	call   f01044ea <cprintf>
+			cprintf("%c ", *pte & PTE_U ? 'U' : '-');
+f0100d51:	8b 13                	mov    (%ebx),%edx
+f0100d53:	83 e2 04             	and    $0x4,%edx
+f0100d56:	83 c4 08             	add    $0x8,%esp
+f0100d59:	83 fa 01             	cmp    $0x1,%edx
+f0100d5c:	19 c0                	sbb    %eax,%eax
+f0100d5e:	83 e0 d8             	and    $0xffffffd8,%eax
+f0100d61:	83 c0 55             	add    $0x55,%eax
+f0100d64:	50                   	push   %eax
+f0100d65:	68 c6 89 10 f0       	push   $0xf01089c6
+f0100d6a:	e8 7b 37 00 00       	call   f01044ea <cprintf>
+			cprintf("%c ", *pte & PTE_W ? 'W' : '-');
+f0100d6f:	8b 13                	mov    (%ebx),%edx
+f0100d71:	83 e2 02             	and    $0x2,%edx
+f0100d74:	83 c4 08             	add    $0x8,%esp
+f0100d77:	83 fa 01             	cmp    $0x1,%edx
+f0100d7a:	19 c0                	sbb    %eax,%eax
+f0100d7c:	83 e0 d6             	and    $0xffffffd6,%eax
+f0100d7f:	83 c0 57             	add    $0x57,%eax
+f0100d82:	50                   	push   %eax
+f0100d83:	68 c6 89 10 f0       	push   $0xf01089c6
+f0100d88:	e8 5d 37 00 00       	call   f01044ea <cprintf>
+			cprintf("%c    ", *pte & PTE_P ? 'P' : '-');
+f0100d8d:	8b 13                	mov    (%ebx),%edx
+f0100d8f:	83 e2 01             	and    $0x1,%edx
+f0100d92:	83 c4 08             	add    $0x8,%esp
+f0100d95:	83 fa 01             	cmp    $0x1,%edx
+f0100d98:	19 c0                	sbb    %eax,%eax
+f0100d9a:	83 e0 dd             	and    $0xffffffdd,%eax
+f0100d9d:	83 c0 50             	add    $0x50,%eax
+f0100da0:	50                   	push   %eax
+f0100da1:	68 ce 89 10 f0       	push   $0xf01089ce
+f0100da6:	e8 3f 37 00 00       	call   f01044ea <cprintf>
+			cprintf("0x%05x\n", PGNUM(*pte) + (*pte & PTE_PS ? PTX(va) : 0));
+f0100dab:	8b 03                	mov    (%ebx),%eax
+f0100dad:	89 c2                	mov    %eax,%edx
+f0100daf:	c1 ea 0c             	shr    $0xc,%edx
+f0100db2:	83 c4 08             	add    $0x8,%esp
+f0100db5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0100db8:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+f0100dbe:	25 80 00 00 00       	and    $0x80,%eax
+f0100dc3:	0f 45 c1             	cmovne %ecx,%eax
+f0100dc6:	01 c2                	add    %eax,%edx
+f0100dc8:	52                   	push   %edx
+f0100dc9:	68 d5 89 10 f0       	push   $0xf01089d5
+f0100dce:	e8 17 37 00 00       	call   f01044ea <cprintf>
+f0100dd3:	83 c4 10             	add    $0x10,%esp
+		if (va == ends[1]) {
+f0100dd6:	3b 75 e4             	cmp    -0x1c(%ebp),%esi
+f0100dd9:	0f 84 93 00 00 00    	je     f0100e72 <mon_showmappings+0x303>
+	for (va = (uintptr_t)ends[0], i=0; ; va += PGSIZE, i = (i+1)%30) {
+f0100ddf:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0100de5:	8d 4f 01             	lea    0x1(%edi),%ecx
+f0100de8:	ba 89 88 88 88       	mov    $0x88888889,%edx
+f0100ded:	89 c8                	mov    %ecx,%eax
+f0100def:	f7 ea                	imul   %edx
+f0100df1:	8d 3c 0a             	lea    (%edx,%ecx,1),%edi
+f0100df4:	c1 ff 04             	sar    $0x4,%edi
+f0100df7:	89 c8                	mov    %ecx,%eax
+f0100df9:	c1 f8 1f             	sar    $0x1f,%eax
+f0100dfc:	29 c7                	sub    %eax,%edi
+f0100dfe:	6b c7 1e             	imul   $0x1e,%edi,%eax
+f0100e01:	29 c1                	sub    %eax,%ecx
+f0100e03:	89 cf                	mov    %ecx,%edi
+		if (!i) {
+f0100e05:	85 ff                	test   %edi,%edi
+f0100e07:	0f 85 11 fe ff ff    	jne    f0100c1e <mon_showmappings+0xaf>
+			cprintf("%s\n", boundary);
+f0100e0d:	83 ec 08             	sub    $0x8,%esp
+f0100e10:	68 ec 8d 10 f0       	push   $0xf0108dec
+f0100e15:	68 e5 88 10 f0       	push   $0xf01088e5
+f0100e1a:	e8 cb 36 00 00       	call   f01044ea <cprintf>
+			cprintf("%s\n", header);
+f0100e1f:	83 c4 08             	add    $0x8,%esp
+f0100e22:	68 20 8e 10 f0       	push   $0xf0108e20
+f0100e27:	68 e5 88 10 f0       	push   $0xf01088e5
+f0100e2c:	e8 b9 36 00 00       	call   f01044ea <cprintf>
+			cprintf("%s\n", flags_header);
+f0100e31:	83 c4 08             	add    $0x8,%esp
+f0100e34:	68 54 8e 10 f0       	push   $0xf0108e54
+f0100e39:	68 e5 88 10 f0       	push   $0xf01088e5
+f0100e3e:	e8 a7 36 00 00       	call   f01044ea <cprintf>
+			cprintf("%s\n", boundary);
+f0100e43:	83 c4 08             	add    $0x8,%esp
+f0100e46:	68 ec 8d 10 f0       	push   $0xf0108dec
+f0100e4b:	68 e5 88 10 f0       	push   $0xf01088e5
+f0100e50:	e8 95 36 00 00       	call   f01044ea <cprintf>
+f0100e55:	83 c4 10             	add    $0x10,%esp
+f0100e58:	e9 c1 fd ff ff       	jmp    f0100c1e <mon_showmappings+0xaf>
+			cprintf("<no physical page mapping>\n");
+f0100e5d:	83 ec 0c             	sub    $0xc,%esp
+f0100e60:	68 dd 89 10 f0       	push   $0xf01089dd
+f0100e65:	e8 80 36 00 00       	call   f01044ea <cprintf>
+f0100e6a:	83 c4 10             	add    $0x10,%esp
+f0100e6d:	e9 64 ff ff ff       	jmp    f0100dd6 <mon_showmappings+0x267>
+	cprintf("%s\n", boundary);
+f0100e72:	83 ec 08             	sub    $0x8,%esp
+f0100e75:	68 ec 8d 10 f0       	push   $0xf0108dec
+f0100e7a:	68 e5 88 10 f0       	push   $0xf01088e5
+f0100e7f:	e8 66 36 00 00       	call   f01044ea <cprintf>
+	return 0;
+f0100e84:	83 c4 10             	add    $0x10,%esp
+f0100e87:	e9 05 fd ff ff       	jmp    f0100b91 <mon_showmappings+0x22>
+
+f0100e8c <mon_changemappingpermissions>:
+
+int
+mon_changemappingpermissions(int argc, char **argv, struct Trapframe *tf)
+{
+f0100e8c:	55                   	push   %ebp
+f0100e8d:	89 e5                	mov    %esp,%ebp
+f0100e8f:	57                   	push   %edi
+f0100e90:	56                   	push   %esi
+f0100e91:	53                   	push   %ebx
+f0100e92:	83 ec 3c             	sub    $0x3c,%esp
+f0100e95:	8b 75 08             	mov    0x8(%ebp),%esi
+f0100e98:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char change[] = {0, 0}, new_perms[] = {0, 0}, error = 0, perm, value, perms;
+f0100e9b:	66 c7 45 e6 00 00    	movw   $0x0,-0x1a(%ebp)
+f0100ea1:	66 c7 45 e4 00 00    	movw   $0x0,-0x1c(%ebp)
+	long va_long;
+	pte_t *pte, pte_temp;
+	char *argv_new[3];
+
+	// expects 1-3 args in addition to the command name
+	if (!(2 <= argc && argc <= 4)) {
+f0100ea7:	8d 46 fe             	lea    -0x2(%esi),%eax
+f0100eaa:	83 f8 02             	cmp    $0x2,%eax
+f0100ead:	77 13                	ja     f0100ec2 <mon_changemappingpermissions+0x36>
+
+	// skip additional error checking if an error already exists
+	// otherwise, make sure that the first args is a hex strings
+	// if it is, convert it to an integer
+	if (!error) {
+		if (strlen(argv[1])>10 || !strisl(argv[1], 16, &va_long)) {
+f0100eaf:	83 ec 0c             	sub    $0xc,%esp
+f0100eb2:	ff 73 04             	push   0x4(%ebx)
+f0100eb5:	e8 49 67 00 00       	call   f0107603 <strlen>
+f0100eba:	83 c4 10             	add    $0x10,%esp
+f0100ebd:	83 f8 0a             	cmp    $0xa,%eax
+f0100ec0:	7e 1d                	jle    f0100edf <mon_changemappingpermissions+0x53>
+		}
+	}
+
+	// if there are any formatting errors, print usage message and return
+	if (error) {
+		cprintf("Proper usage is\n\
+f0100ec2:	83 ec 0c             	sub    $0xc,%esp
+f0100ec5:	68 78 8e 10 f0       	push   $0xf0108e78
+f0100eca:	e8 1b 36 00 00       	call   f01044ea <cprintf>
+(e.g. 'changemappingpermissions 0x3000 -W1 -U').\n\
+-W corresponds to the write permission, -U to the user permission.\n\
+If a permission is omitted, the value is unchanged.\n\
+If a permission is included, with a value of 1 or with no value, the permission is set.\n\
+If a permission is included with a value of 0, the permission is cleared.\n");
+		return 0;
+f0100ecf:	83 c4 10             	add    $0x10,%esp
+		*pte = pte_temp;
+		cprintf("\nNew permissions:\n");
+		mon_showmappings(3, argv_new, tf);
+	}
+	return 0;
+}
+f0100ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100ed7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100eda:	5b                   	pop    %ebx
+f0100edb:	5e                   	pop    %esi
+f0100edc:	5f                   	pop    %edi
+f0100edd:	5d                   	pop    %ebp
+f0100ede:	c3                   	ret
+		if (strlen(argv[1])>10 || !strisl(argv[1], 16, &va_long)) {
+f0100edf:	83 ec 04             	sub    $0x4,%esp
+f0100ee2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0100ee5:	50                   	push   %eax
+f0100ee6:	6a 10                	push   $0x10
+f0100ee8:	ff 73 04             	push   0x4(%ebx)
+f0100eeb:	e8 7e 6a 00 00       	call   f010796e <strisl>
+f0100ef0:	83 c4 10             	add    $0x10,%esp
+f0100ef3:	85 c0                	test   %eax,%eax
+f0100ef5:	74 cb                	je     f0100ec2 <mon_changemappingpermissions+0x36>
+			va = (uintptr_t)va_long;
+f0100ef7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+		for (i = 0; i < argc-2; ++i) {
+f0100efa:	ba 00 00 00 00       	mov    $0x0,%edx
+f0100eff:	8d 46 fe             	lea    -0x2(%esi),%eax
+f0100f02:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+f0100f05:	89 7d c0             	mov    %edi,-0x40(%ebp)
+f0100f08:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+f0100f0b:	eb 07                	jmp    f0100f14 <mon_changemappingpermissions+0x88>
+			new_perms[(perm == 'U' ? 1 : 0)] = value;
+f0100f0d:	88 44 35 e4          	mov    %al,-0x1c(%ebp,%esi,1)
+		for (i = 0; i < argc-2; ++i) {
+f0100f11:	83 c2 01             	add    $0x1,%edx
+f0100f14:	39 55 c4             	cmp    %edx,-0x3c(%ebp)
+f0100f17:	0f 8e ba 00 00 00    	jle    f0100fd7 <mon_changemappingpermissions+0x14b>
+			if (*(argv[i+2]++) != '-') {
+f0100f1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100f20:	8b 4c 90 08          	mov    0x8(%eax,%edx,4),%ecx
+f0100f24:	8d 41 01             	lea    0x1(%ecx),%eax
+f0100f27:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0100f2a:	89 44 97 08          	mov    %eax,0x8(%edi,%edx,4)
+f0100f2e:	80 39 2d             	cmpb   $0x2d,(%ecx)
+f0100f31:	75 8f                	jne    f0100ec2 <mon_changemappingpermissions+0x36>
+			perm = *(argv[i+2]++);
+f0100f33:	8d 41 02             	lea    0x2(%ecx),%eax
+f0100f36:	89 44 97 08          	mov    %eax,0x8(%edi,%edx,4)
+f0100f3a:	0f b6 41 01          	movzbl 0x1(%ecx),%eax
+			if ('a' <= perm && perm <= 'z') {
+f0100f3e:	8d 78 9f             	lea    -0x61(%eax),%edi
+				perm += 'A' - 'a';
+f0100f41:	8d 70 e0             	lea    -0x20(%eax),%esi
+f0100f44:	89 fb                	mov    %edi,%ebx
+f0100f46:	80 fb 1a             	cmp    $0x1a,%bl
+f0100f49:	0f 42 c6             	cmovb  %esi,%eax
+			if (perm == 'W' || perm == 'U') {
+f0100f4c:	3c 55                	cmp    $0x55,%al
+f0100f4e:	0f 94 c3             	sete   %bl
+f0100f51:	83 e0 fd             	and    $0xfffffffd,%eax
+f0100f54:	3c 55                	cmp    $0x55,%al
+f0100f56:	0f 85 66 ff ff ff    	jne    f0100ec2 <mon_changemappingpermissions+0x36>
+				change[(perm == 'U' ? 1 : 0)] = 1;
+f0100f5c:	0f b6 f3             	movzbl %bl,%esi
+f0100f5f:	c6 44 35 e6 01       	movb   $0x1,-0x1a(%ebp,%esi,1)
+			value = *argv[i+2];
+f0100f64:	0f b6 49 02          	movzbl 0x2(%ecx),%ecx
+			if (value && (value != '0') && (value != '1')) {
+f0100f68:	80 f9 30             	cmp    $0x30,%cl
+f0100f6b:	0f 95 c0             	setne  %al
+f0100f6e:	84 c9                	test   %cl,%cl
+f0100f70:	74 9b                	je     f0100f0d <mon_changemappingpermissions+0x81>
+f0100f72:	84 c0                	test   %al,%al
+f0100f74:	74 97                	je     f0100f0d <mon_changemappingpermissions+0x81>
+f0100f76:	80 f9 31             	cmp    $0x31,%cl
+f0100f79:	0f 85 43 ff ff ff    	jne    f0100ec2 <mon_changemappingpermissions+0x36>
+				value = 1;
+f0100f7f:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100f84:	eb 87                	jmp    f0100f0d <mon_changemappingpermissions+0x81>
+		cprintf("no physical page mapping at 0x%05x\n", va>>PTXSHIFT);
+f0100f86:	83 ec 08             	sub    $0x8,%esp
+f0100f89:	c1 ef 0c             	shr    $0xc,%edi
+f0100f8c:	57                   	push   %edi
+f0100f8d:	68 1c 90 10 f0       	push   $0xf010901c
+f0100f92:	e8 53 35 00 00       	call   f01044ea <cprintf>
+		return 0;
+f0100f97:	83 c4 10             	add    $0x10,%esp
+f0100f9a:	e9 33 ff ff ff       	jmp    f0100ed2 <mon_changemappingpermissions+0x46>
+			perms |= ((new_perms[i]<<(i+1)) & (PTE_W|PTE_U));
+f0100f9f:	0f be 4d e4          	movsbl -0x1c(%ebp),%ecx
+f0100fa3:	01 c9                	add    %ecx,%ecx
+f0100fa5:	89 d0                	mov    %edx,%eax
+f0100fa7:	83 e0 04             	and    $0x4,%eax
+f0100faa:	09 c8                	or     %ecx,%eax
+f0100fac:	83 e0 06             	and    $0x6,%eax
+f0100faf:	eb 59                	jmp    f010100a <mon_changemappingpermissions+0x17e>
+		cprintf("No change to page mapping permissions\n");
+f0100fb1:	83 ec 0c             	sub    $0xc,%esp
+f0100fb4:	68 40 90 10 f0       	push   $0xf0109040
+f0100fb9:	e8 2c 35 00 00       	call   f01044ea <cprintf>
+		mon_showmappings(3, argv_new, tf);
+f0100fbe:	83 c4 0c             	add    $0xc,%esp
+f0100fc1:	ff 75 10             	push   0x10(%ebp)
+f0100fc4:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+f0100fc7:	50                   	push   %eax
+f0100fc8:	6a 03                	push   $0x3
+f0100fca:	e8 a0 fb ff ff       	call   f0100b6f <mon_showmappings>
+f0100fcf:	83 c4 10             	add    $0x10,%esp
+f0100fd2:	e9 fb fe ff ff       	jmp    f0100ed2 <mon_changemappingpermissions+0x46>
+f0100fd7:	8b 7d c0             	mov    -0x40(%ebp),%edi
+f0100fda:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	va = ROUNDDOWN(va, PGSIZE);
+f0100fdd:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	pte = pgdir_walk(kern_pgdir, (void *)va, 0);
+f0100fe3:	83 ec 04             	sub    $0x4,%esp
+f0100fe6:	6a 00                	push   $0x0
+f0100fe8:	57                   	push   %edi
+f0100fe9:	ff 35 58 a0 85 f0    	push   0xf085a058
+f0100fef:	e8 f1 0c 00 00       	call   f0101ce5 <pgdir_walk>
+f0100ff4:	89 c6                	mov    %eax,%esi
+	if (!pte) {
+f0100ff6:	83 c4 10             	add    $0x10,%esp
+f0100ff9:	85 c0                	test   %eax,%eax
+f0100ffb:	74 89                	je     f0100f86 <mon_changemappingpermissions+0xfa>
+	perms = (*pte)&(PTE_W|PTE_U);
+f0100ffd:	8b 16                	mov    (%esi),%edx
+		if (change[i]) {
+f0100fff:	80 7d e6 00          	cmpb   $0x0,-0x1a(%ebp)
+f0101003:	75 9a                	jne    f0100f9f <mon_changemappingpermissions+0x113>
+	perms = (*pte)&(PTE_W|PTE_U);
+f0101005:	89 d0                	mov    %edx,%eax
+f0101007:	83 e0 06             	and    $0x6,%eax
+		if (change[i]) {
+f010100a:	80 7d e7 00          	cmpb   $0x0,-0x19(%ebp)
+f010100e:	74 0f                	je     f010101f <mon_changemappingpermissions+0x193>
+			perms |= ((new_perms[i]<<(i+1)) & (PTE_W|PTE_U));
+f0101010:	0f be 4d e5          	movsbl -0x1b(%ebp),%ecx
+f0101014:	c1 e1 02             	shl    $0x2,%ecx
+f0101017:	83 e0 fb             	and    $0xfffffffb,%eax
+f010101a:	09 c8                	or     %ecx,%eax
+f010101c:	83 e0 06             	and    $0x6,%eax
+	pte_temp &= ~(PTE_W|PTE_U);
+f010101f:	89 d1                	mov    %edx,%ecx
+f0101021:	83 e1 f9             	and    $0xfffffff9,%ecx
+	pte_temp |= perms;
+f0101024:	0f be f8             	movsbl %al,%edi
+f0101027:	09 cf                	or     %ecx,%edi
+	argv_new[0] = "showmappings";
+f0101029:	c7 45 d4 f9 89 10 f0 	movl   $0xf01089f9,-0x2c(%ebp)
+	argv_new[1] = argv_new[2] = argv[1];
+f0101030:	8b 43 04             	mov    0x4(%ebx),%eax
+f0101033:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0101036:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	if (pte_temp == *pte) {
+f0101039:	39 fa                	cmp    %edi,%edx
+f010103b:	0f 84 70 ff ff ff    	je     f0100fb1 <mon_changemappingpermissions+0x125>
+		cprintf("Old permissions:\n");
+f0101041:	83 ec 0c             	sub    $0xc,%esp
+f0101044:	68 06 8a 10 f0       	push   $0xf0108a06
+f0101049:	e8 9c 34 00 00       	call   f01044ea <cprintf>
+		mon_showmappings(3, argv_new, tf);
+f010104e:	83 c4 0c             	add    $0xc,%esp
+f0101051:	ff 75 10             	push   0x10(%ebp)
+f0101054:	8d 5d d4             	lea    -0x2c(%ebp),%ebx
+f0101057:	53                   	push   %ebx
+f0101058:	6a 03                	push   $0x3
+f010105a:	e8 10 fb ff ff       	call   f0100b6f <mon_showmappings>
+		*pte = pte_temp;
+f010105f:	89 3e                	mov    %edi,(%esi)
+		cprintf("\nNew permissions:\n");
+f0101061:	c7 04 24 18 8a 10 f0 	movl   $0xf0108a18,(%esp)
+f0101068:	e8 7d 34 00 00       	call   f01044ea <cprintf>
+		mon_showmappings(3, argv_new, tf);
+f010106d:	83 c4 0c             	add    $0xc,%esp
+f0101070:	ff 75 10             	push   0x10(%ebp)
+f0101073:	53                   	push   %ebx
+f0101074:	6a 03                	push   $0x3
+f0101076:	e8 f4 fa ff ff       	call   f0100b6f <mon_showmappings>
+f010107b:	83 c4 10             	add    $0x10,%esp
+f010107e:	e9 4f fe ff ff       	jmp    f0100ed2 <mon_changemappingpermissions+0x46>
+
+f0101083 <mon_dumpmemory>:
+
+// Dumps the contents of a range of memory. Returns 0 on success.
+// On input error, displays usage message.
+int
+mon_dumpmemory(int argc, char **argv, struct Trapframe *tf)
+{
+f0101083:	55                   	push   %ebp
+f0101084:	89 e5                	mov    %esp,%ebp
+f0101086:	57                   	push   %edi
+f0101087:	56                   	push   %esi
+f0101088:	53                   	push   %ebx
+f0101089:	83 ec 3c             	sub    $0x3c,%esp
+f010108c:	8b 75 08             	mov    0x8(%ebp),%esi
+f010108f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uintptr_t va, ends_rounded[2];
+	uint32_t *m, *page_end;
+	pte_t *pte;
+
+	// expects 2-3 args in addition to the command name
+	if (!(3 <= argc && argc <= 4)) {
+f0101092:	8d 46 fd             	lea    -0x3(%esi),%eax
+f0101095:	83 f8 01             	cmp    $0x1,%eax
+f0101098:	76 1d                	jbe    f01010b7 <mon_dumpmemory+0x34>
+		}
+	}
+
+	// if there are any formatting errors, print usage message and return
+	if (error) {
+		cprintf("Proper usage is\n\
+f010109a:	83 ec 0c             	sub    $0xc,%esp
+f010109d:	68 68 90 10 f0       	push   $0xf0109068
+f01010a2:	e8 43 34 00 00       	call   f01044ea <cprintf>
+		'dumpmemory <start> <end> [-P]'\n\
+(e.g. 'dumpmemory 0x3000 0x5000'),\n\
+which dumps the contents of the given range of memory.\n\
+The -P flag indicates that the addresses should be interpretted as physical addresses.\n\
+Otherwise, they will be interpretted as virtual addresses.\n");
+		return 0;
+f01010a7:	83 c4 10             	add    $0x10,%esp
+			cprintf("0x%08x    ", *m);
+		}
+		cprintf("\n");
+	}
+	return 0;
+}
+f01010aa:	b8 00 00 00 00       	mov    $0x0,%eax
+f01010af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01010b2:	5b                   	pop    %ebx
+f01010b3:	5e                   	pop    %esi
+f01010b4:	5f                   	pop    %edi
+f01010b5:	5d                   	pop    %ebp
+f01010b6:	c3                   	ret
+			if (strlen(argv[i+1])>10 || !strisl(argv[i+1], 16, ends+i)) {
+f01010b7:	83 ec 0c             	sub    $0xc,%esp
+f01010ba:	ff 73 04             	push   0x4(%ebx)
+f01010bd:	e8 41 65 00 00       	call   f0107603 <strlen>
+f01010c2:	83 c4 10             	add    $0x10,%esp
+f01010c5:	83 f8 0a             	cmp    $0xa,%eax
+f01010c8:	7f d0                	jg     f010109a <mon_dumpmemory+0x17>
+f01010ca:	83 ec 04             	sub    $0x4,%esp
+f01010cd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f01010d0:	50                   	push   %eax
+f01010d1:	6a 10                	push   $0x10
+f01010d3:	ff 73 04             	push   0x4(%ebx)
+f01010d6:	e8 93 68 00 00       	call   f010796e <strisl>
+f01010db:	83 c4 10             	add    $0x10,%esp
+f01010de:	85 c0                	test   %eax,%eax
+f01010e0:	74 b8                	je     f010109a <mon_dumpmemory+0x17>
+f01010e2:	83 ec 0c             	sub    $0xc,%esp
+f01010e5:	ff 73 08             	push   0x8(%ebx)
+f01010e8:	e8 16 65 00 00       	call   f0107603 <strlen>
+f01010ed:	83 c4 10             	add    $0x10,%esp
+f01010f0:	83 f8 0a             	cmp    $0xa,%eax
+f01010f3:	7f a5                	jg     f010109a <mon_dumpmemory+0x17>
+f01010f5:	83 ec 04             	sub    $0x4,%esp
+f01010f8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01010fb:	50                   	push   %eax
+f01010fc:	6a 10                	push   $0x10
+f01010fe:	ff 73 08             	push   0x8(%ebx)
+f0101101:	e8 68 68 00 00       	call   f010796e <strisl>
+f0101106:	83 c4 10             	add    $0x10,%esp
+f0101109:	85 c0                	test   %eax,%eax
+f010110b:	74 8d                	je     f010109a <mon_dumpmemory+0x17>
+	if (!error && ends[0] > ends[1]) {
+f010110d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101110:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+f0101113:	7f 85                	jg     f010109a <mon_dumpmemory+0x17>
+	if (!error && argc == 4) {
+f0101115:	83 fe 04             	cmp    $0x4,%esi
+f0101118:	0f 85 b5 01 00 00    	jne    f01012d3 <mon_dumpmemory+0x250>
+		if (strlen(argv[3]) != 2 || argv[3][0] != '-' || (argv[3][1]!='P' && argv[3][1]!='p')) {
+f010111e:	83 ec 0c             	sub    $0xc,%esp
+f0101121:	ff 73 0c             	push   0xc(%ebx)
+f0101124:	e8 da 64 00 00       	call   f0107603 <strlen>
+f0101129:	83 c4 10             	add    $0x10,%esp
+f010112c:	83 f8 02             	cmp    $0x2,%eax
+f010112f:	0f 85 65 ff ff ff    	jne    f010109a <mon_dumpmemory+0x17>
+f0101135:	8b 43 0c             	mov    0xc(%ebx),%eax
+f0101138:	80 38 2d             	cmpb   $0x2d,(%eax)
+f010113b:	0f 85 59 ff ff ff    	jne    f010109a <mon_dumpmemory+0x17>
+f0101141:	0f b6 40 01          	movzbl 0x1(%eax),%eax
+f0101145:	83 e0 df             	and    $0xffffffdf,%eax
+f0101148:	3c 50                	cmp    $0x50,%al
+f010114a:	0f 85 4a ff ff ff    	jne    f010109a <mon_dumpmemory+0x17>
+	if (PGNUM(pa) >= npages)
+f0101150:	8b 15 54 a0 85 f0    	mov    0xf085a054,%edx
+			ends[i] = (long)KADDR(ends[i]);
+f0101156:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0101159:	89 c1                	mov    %eax,%ecx
+f010115b:	c1 e9 0c             	shr    $0xc,%ecx
+f010115e:	39 d1                	cmp    %edx,%ecx
+f0101160:	73 5b                	jae    f01011bd <mon_dumpmemory+0x13a>
+	return (void *)(pa + KERNBASE);
+f0101162:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0101167:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010116a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+	if (PGNUM(pa) >= npages)
+f010116d:	89 c1                	mov    %eax,%ecx
+f010116f:	c1 e9 0c             	shr    $0xc,%ecx
+f0101172:	39 d1                	cmp    %edx,%ecx
+f0101174:	73 47                	jae    f01011bd <mon_dumpmemory+0x13a>
+	return (void *)(pa + KERNBASE);
+f0101176:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f010117b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			physical = 1;
+f010117e:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+	ends_rounded[0] = ROUNDDOWN(ends[0], PGSIZE);
+f0101185:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0101188:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	ends_rounded[1] = ROUNDUP(ends[1]+1, PGSIZE);
+f010118e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101191:	05 00 10 00 00       	add    $0x1000,%eax
+f0101196:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f010119b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	for (va = ends_rounded[0]; va < ends_rounded[1]; va += PGSIZE) {
+f010119e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+f01011a2:	b9 3a 8a 10 f0       	mov    $0xf0108a3a,%ecx
+f01011a7:	b8 3d 8a 10 f0       	mov    $0xf0108a3d,%eax
+f01011ac:	0f 45 c1             	cmovne %ecx,%eax
+f01011af:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01011b2:	89 55 cc             	mov    %edx,-0x34(%ebp)
+f01011b5:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+f01011b8:	e9 c2 00 00 00       	jmp    f010127f <mon_dumpmemory+0x1fc>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01011bd:	50                   	push   %eax
+f01011be:	68 e4 85 10 f0       	push   $0xf01085e4
+f01011c3:	68 a7 01 00 00       	push   $0x1a7
+f01011c8:	68 2b 8a 10 f0       	push   $0xf0108a2b
+f01011cd:	e8 6e ee ff ff       	call   f0100040 <_panic>
+			m = (uint32_t *)((va&(~0xfff))|PGOFF(ends[0]));
+f01011d2:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f01011d5:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+f01011db:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f01011de:	09 c6                	or     %eax,%esi
+f01011e0:	e9 d1 00 00 00       	jmp    f01012b6 <mon_dumpmemory+0x233>
+			page_end = (uint32_t *)((va&(~0xfff))|PGOFF(ends[1]));
+f01011e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f01011e8:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+f01011ee:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f01011f1:	09 c7                	or     %eax,%edi
+f01011f3:	e9 d1 00 00 00       	jmp    f01012c9 <mon_dumpmemory+0x246>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01011f8:	56                   	push   %esi
+f01011f9:	68 08 86 10 f0       	push   $0xf0108608
+f01011fe:	68 cb 01 00 00       	push   $0x1cb
+f0101203:	68 2b 8a 10 f0       	push   $0xf0108a2b
+f0101208:	e8 33 ee ff ff       	call   f0100040 <_panic>
+f010120d:	89 f0                	mov    %esi,%eax
+				cprintf("\n%s 0x%08x:    ", (physical ? "PA" : "VA"), (physical ? (uint32_t *)PADDR(m) : m));
+f010120f:	83 ec 04             	sub    $0x4,%esp
+f0101212:	50                   	push   %eax
+f0101213:	ff 75 d0             	push   -0x30(%ebp)
+f0101216:	68 40 8a 10 f0       	push   $0xf0108a40
+f010121b:	e8 ca 32 00 00       	call   f01044ea <cprintf>
+f0101220:	83 c4 10             	add    $0x10,%esp
+			cprintf("0x%08x    ", *m);
+f0101223:	83 ec 08             	sub    $0x8,%esp
+f0101226:	ff 36                	push   (%esi)
+f0101228:	68 50 8a 10 f0       	push   $0xf0108a50
+f010122d:	e8 b8 32 00 00       	call   f01044ea <cprintf>
+		for (i = 0; m <= page_end; ++m, i = (i+1)%4) {
+f0101232:	83 c6 04             	add    $0x4,%esi
+f0101235:	83 c3 01             	add    $0x1,%ebx
+f0101238:	89 d8                	mov    %ebx,%eax
+f010123a:	c1 f8 1f             	sar    $0x1f,%eax
+f010123d:	c1 e8 1e             	shr    $0x1e,%eax
+f0101240:	01 c3                	add    %eax,%ebx
+f0101242:	83 e3 03             	and    $0x3,%ebx
+f0101245:	29 c3                	sub    %eax,%ebx
+f0101247:	83 c4 10             	add    $0x10,%esp
+f010124a:	39 f7                	cmp    %esi,%edi
+f010124c:	72 1a                	jb     f0101268 <mon_dumpmemory+0x1e5>
+			if (!i) {
+f010124e:	85 db                	test   %ebx,%ebx
+f0101250:	75 d1                	jne    f0101223 <mon_dumpmemory+0x1a0>
+				cprintf("\n%s 0x%08x:    ", (physical ? "PA" : "VA"), (physical ? (uint32_t *)PADDR(m) : m));
+f0101252:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+f0101256:	74 b5                	je     f010120d <mon_dumpmemory+0x18a>
+	if ((uint32_t)kva < KERNBASE)
+f0101258:	81 fe ff ff ff ef    	cmp    $0xefffffff,%esi
+f010125e:	76 98                	jbe    f01011f8 <mon_dumpmemory+0x175>
+f0101260:	8d 86 00 00 00 10    	lea    0x10000000(%esi),%eax
+f0101266:	eb a7                	jmp    f010120f <mon_dumpmemory+0x18c>
+		cprintf("\n");
+f0101268:	83 ec 0c             	sub    $0xc,%esp
+f010126b:	68 8d 86 10 f0       	push   $0xf010868d
+f0101270:	e8 75 32 00 00       	call   f01044ea <cprintf>
+f0101275:	83 c4 10             	add    $0x10,%esp
+	for (va = ends_rounded[0]; va < ends_rounded[1]; va += PGSIZE) {
+f0101278:	81 45 cc 00 10 00 00 	addl   $0x1000,-0x34(%ebp)
+f010127f:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+f0101282:	39 4d cc             	cmp    %ecx,-0x34(%ebp)
+f0101285:	0f 83 1f fe ff ff    	jae    f01010aa <mon_dumpmemory+0x27>
+		pte = pgdir_walk(kern_pgdir, (void *)va, 0);
+f010128b:	8b 7d cc             	mov    -0x34(%ebp),%edi
+f010128e:	89 fe                	mov    %edi,%esi
+f0101290:	83 ec 04             	sub    $0x4,%esp
+f0101293:	6a 00                	push   $0x0
+f0101295:	57                   	push   %edi
+f0101296:	ff 35 58 a0 85 f0    	push   0xf085a058
+f010129c:	e8 44 0a 00 00       	call   f0101ce5 <pgdir_walk>
+		if (!pte || !(*pte & PTE_P)) {
+f01012a1:	83 c4 10             	add    $0x10,%esp
+f01012a4:	85 c0                	test   %eax,%eax
+f01012a6:	74 d0                	je     f0101278 <mon_dumpmemory+0x1f5>
+f01012a8:	f6 00 01             	testb  $0x1,(%eax)
+f01012ab:	74 cb                	je     f0101278 <mon_dumpmemory+0x1f5>
+		if (va == ends_rounded[0]) {
+f01012ad:	39 7d c4             	cmp    %edi,-0x3c(%ebp)
+f01012b0:	0f 84 1c ff ff ff    	je     f01011d2 <mon_dumpmemory+0x14f>
+		if (va+PGSIZE == ends_rounded[1]) {
+f01012b6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f01012b9:	05 00 10 00 00       	add    $0x1000,%eax
+			page_end = (uint32_t *)(va+PGSIZE);
+f01012be:	89 c7                	mov    %eax,%edi
+		if (va+PGSIZE == ends_rounded[1]) {
+f01012c0:	39 45 c8             	cmp    %eax,-0x38(%ebp)
+f01012c3:	0f 84 1c ff ff ff    	je     f01011e5 <mon_dumpmemory+0x162>
+		for (i = 0; m <= page_end; ++m, i = (i+1)%4) {
+f01012c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01012ce:	e9 77 ff ff ff       	jmp    f010124a <mon_dumpmemory+0x1c7>
+	if (!error && argc == 4) {
+f01012d3:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+f01012da:	e9 a6 fe ff ff       	jmp    f0101185 <mon_dumpmemory+0x102>
+
+f01012df <monitor>:
+	return 0;
+}
+
+void
+monitor(struct Trapframe *tf)
+{
+f01012df:	55                   	push   %ebp
+f01012e0:	89 e5                	mov    %esp,%ebp
+f01012e2:	57                   	push   %edi
+f01012e3:	56                   	push   %esi
+f01012e4:	53                   	push   %ebx
+f01012e5:	83 ec 58             	sub    $0x58,%esp
+	char *buf;
+
+	cprintf("Welcome to the JOS kernel monitor!\n");
+f01012e8:	68 88 91 10 f0       	push   $0xf0109188
+f01012ed:	e8 f8 31 00 00       	call   f01044ea <cprintf>
+	cprintf("Type 'help' for a list of commands.\n");
+f01012f2:	c7 04 24 ac 91 10 f0 	movl   $0xf01091ac,(%esp)
+f01012f9:	e8 ec 31 00 00       	call   f01044ea <cprintf>
+
+	if (tf != NULL)
+f01012fe:	83 c4 10             	add    $0x10,%esp
+f0101301:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f0101305:	74 57                	je     f010135e <monitor+0x7f>
+		print_trapframe(tf);
+f0101307:	83 ec 0c             	sub    $0xc,%esp
+f010130a:	ff 75 08             	push   0x8(%ebp)
+f010130d:	e8 6a 34 00 00       	call   f010477c <print_trapframe>
+f0101312:	83 c4 10             	add    $0x10,%esp
+f0101315:	eb 47                	jmp    f010135e <monitor+0x7f>
+		while (*buf && strchr(WHITESPACE, *buf))
+f0101317:	83 ec 08             	sub    $0x8,%esp
+f010131a:	0f be c0             	movsbl %al,%eax
+f010131d:	50                   	push   %eax
+f010131e:	68 5f 8a 10 f0       	push   $0xf0108a5f
+f0101323:	e8 28 64 00 00       	call   f0107750 <strchr>
+f0101328:	83 c4 10             	add    $0x10,%esp
+f010132b:	85 c0                	test   %eax,%eax
+f010132d:	74 0a                	je     f0101339 <monitor+0x5a>
+			*buf++ = 0;
+f010132f:	c6 03 00             	movb   $0x0,(%ebx)
+f0101332:	89 f7                	mov    %esi,%edi
+f0101334:	8d 5b 01             	lea    0x1(%ebx),%ebx
+f0101337:	eb 6b                	jmp    f01013a4 <monitor+0xc5>
+		if (*buf == 0)
+f0101339:	80 3b 00             	cmpb   $0x0,(%ebx)
+f010133c:	74 73                	je     f01013b1 <monitor+0xd2>
+		if (argc == MAXARGS-1) {
+f010133e:	83 fe 0f             	cmp    $0xf,%esi
+f0101341:	74 09                	je     f010134c <monitor+0x6d>
+		argv[argc++] = buf;
+f0101343:	8d 7e 01             	lea    0x1(%esi),%edi
+f0101346:	89 5c b5 a8          	mov    %ebx,-0x58(%ebp,%esi,4)
+		while (*buf && !strchr(WHITESPACE, *buf))
+f010134a:	eb 39                	jmp    f0101385 <monitor+0xa6>
+			cprintf("Too many arguments (max %d)\n", MAXARGS);
+f010134c:	83 ec 08             	sub    $0x8,%esp
+f010134f:	6a 10                	push   $0x10
+f0101351:	68 64 8a 10 f0       	push   $0xf0108a64
+f0101356:	e8 8f 31 00 00       	call   f01044ea <cprintf>
+			return 0;
+f010135b:	83 c4 10             	add    $0x10,%esp
+
+	while (1) {
+		buf = readline("K> ");
+f010135e:	83 ec 0c             	sub    $0xc,%esp
+f0101361:	68 5b 8a 10 f0       	push   $0xf0108a5b
+f0101366:	e8 aa 61 00 00       	call   f0107515 <readline>
+f010136b:	89 c3                	mov    %eax,%ebx
+		if (buf != NULL)
+f010136d:	83 c4 10             	add    $0x10,%esp
+f0101370:	85 c0                	test   %eax,%eax
+f0101372:	74 ea                	je     f010135e <monitor+0x7f>
+	argv[argc] = 0;
+f0101374:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+	argc = 0;
+f010137b:	be 00 00 00 00       	mov    $0x0,%esi
+f0101380:	eb 24                	jmp    f01013a6 <monitor+0xc7>
+			buf++;
+f0101382:	83 c3 01             	add    $0x1,%ebx
+		while (*buf && !strchr(WHITESPACE, *buf))
+f0101385:	0f b6 03             	movzbl (%ebx),%eax
+f0101388:	84 c0                	test   %al,%al
+f010138a:	74 18                	je     f01013a4 <monitor+0xc5>
+f010138c:	83 ec 08             	sub    $0x8,%esp
+f010138f:	0f be c0             	movsbl %al,%eax
+f0101392:	50                   	push   %eax
+f0101393:	68 5f 8a 10 f0       	push   $0xf0108a5f
+f0101398:	e8 b3 63 00 00       	call   f0107750 <strchr>
+f010139d:	83 c4 10             	add    $0x10,%esp
+f01013a0:	85 c0                	test   %eax,%eax
+f01013a2:	74 de                	je     f0101382 <monitor+0xa3>
+			*buf++ = 0;
+f01013a4:	89 fe                	mov    %edi,%esi
+		while (*buf && strchr(WHITESPACE, *buf))
+f01013a6:	0f b6 03             	movzbl (%ebx),%eax
+f01013a9:	84 c0                	test   %al,%al
+f01013ab:	0f 85 66 ff ff ff    	jne    f0101317 <monitor+0x38>
+	argv[argc] = 0;
+f01013b1:	c7 44 b5 a8 00 00 00 	movl   $0x0,-0x58(%ebp,%esi,4)
+f01013b8:	00 
+	if (argc == 0)
+f01013b9:	85 f6                	test   %esi,%esi
+f01013bb:	74 a1                	je     f010135e <monitor+0x7f>
+	for (i = 0; i < NCOMMANDS; i++) {
+f01013bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (strcmp(argv[0], commands[i].name) == 0)
+f01013c2:	83 ec 08             	sub    $0x8,%esp
+f01013c5:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f01013c8:	ff 34 85 00 94 10 f0 	push   -0xfef6c00(,%eax,4)
+f01013cf:	ff 75 a8             	push   -0x58(%ebp)
+f01013d2:	e8 18 63 00 00       	call   f01076ef <strcmp>
+f01013d7:	83 c4 10             	add    $0x10,%esp
+f01013da:	85 c0                	test   %eax,%eax
+f01013dc:	74 20                	je     f01013fe <monitor+0x11f>
+	for (i = 0; i < NCOMMANDS; i++) {
+f01013de:	83 c3 01             	add    $0x1,%ebx
+f01013e1:	83 fb 08             	cmp    $0x8,%ebx
+f01013e4:	75 dc                	jne    f01013c2 <monitor+0xe3>
+	cprintf("Unknown command '%s'\n", argv[0]);
+f01013e6:	83 ec 08             	sub    $0x8,%esp
+f01013e9:	ff 75 a8             	push   -0x58(%ebp)
+f01013ec:	68 81 8a 10 f0       	push   $0xf0108a81
+f01013f1:	e8 f4 30 00 00       	call   f01044ea <cprintf>
+	return 0;
+f01013f6:	83 c4 10             	add    $0x10,%esp
+f01013f9:	e9 60 ff ff ff       	jmp    f010135e <monitor+0x7f>
+			return commands[i].func(argc, argv, tf);
+f01013fe:	83 ec 04             	sub    $0x4,%esp
+f0101401:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0101404:	ff 75 08             	push   0x8(%ebp)
+f0101407:	8d 55 a8             	lea    -0x58(%ebp),%edx
+f010140a:	52                   	push   %edx
+f010140b:	56                   	push   %esi
+f010140c:	ff 14 85 08 94 10 f0 	call   *-0xfef6bf8(,%eax,4)
+			if (runcmd(buf, tf) < 0)
+f0101413:	83 c4 10             	add    $0x10,%esp
+f0101416:	85 c0                	test   %eax,%eax
+f0101418:	0f 89 40 ff ff ff    	jns    f010135e <monitor+0x7f>
+				break;
+	}
+}
+f010141e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101421:	5b                   	pop    %ebx
+f0101422:	5e                   	pop    %esi
+f0101423:	5f                   	pop    %edi
+f0101424:	5d                   	pop    %ebp
+f0101425:	c3                   	ret
+
+f0101426 <page_free_link>:
+static size_t page_free_nblocks[PAGE_MAX_ORDER + 1];
+
+static void
+page_free_link(struct PageInfo *pp, int order)
+{
+	pp->pp_order = order;
+f0101426:	88 50 08             	mov    %dl,0x8(%eax)
+	pp->pp_prev = NULL;
+f0101429:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	pp->pp_link = page_free_lists[order];
+f0101430:	8b 0c 95 a0 92 85 f0 	mov    -0xf7a6d60(,%edx,4),%ecx
+f0101437:	89 08                	mov    %ecx,(%eax)
+	if (page_free_lists[order])
+f0101439:	85 c9                	test   %ecx,%ecx
+f010143b:	74 03                	je     f0101440 <page_free_link+0x1a>
+		page_free_lists[order]->pp_prev = pp;
+f010143d:	89 41 04             	mov    %eax,0x4(%ecx)
+	page_free_lists[order] = pp;
+f0101440:	89 04 95 a0 92 85 f0 	mov    %eax,-0xf7a6d60(,%edx,4)
+	page_free_nblocks[order]++;
+f0101447:	83 04 95 60 92 85 f0 	addl   $0x1,-0xf7a6da0(,%edx,4)
+f010144e:	01 
+}
+f010144f:	c3                   	ret
+
+f0101450 <page_free_unlink>:
+
+static void
+page_free_unlink(struct PageInfo *pp, int order)
+{
+f0101450:	55                   	push   %ebp
+f0101451:	89 e5                	mov    %esp,%ebp
+f0101453:	53                   	push   %ebx
+	if (pp->pp_prev)
+f0101454:	8b 48 04             	mov    0x4(%eax),%ecx
+f0101457:	85 c9                	test   %ecx,%ecx
+f0101459:	74 2e                	je     f0101489 <page_free_unlink+0x39>
+		pp->pp_prev->pp_link = pp->pp_link;
+f010145b:	8b 18                	mov    (%eax),%ebx
+f010145d:	89 19                	mov    %ebx,(%ecx)
+	else
+		page_free_lists[order] = pp->pp_link;
+	if (pp->pp_link)
+f010145f:	8b 08                	mov    (%eax),%ecx
+f0101461:	85 c9                	test   %ecx,%ecx
+f0101463:	74 06                	je     f010146b <page_free_unlink+0x1b>
+		pp->pp_link->pp_prev = pp->pp_prev;
+f0101465:	8b 58 04             	mov    0x4(%eax),%ebx
+f0101468:	89 59 04             	mov    %ebx,0x4(%ecx)
+	pp->pp_order = -1;
+f010146b:	c6 40 08 ff          	movb   $0xff,0x8(%eax)
+	pp->pp_link = pp->pp_prev = NULL;
+f010146f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+f0101476:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	page_free_nblocks[order]--;
+f010147c:	83 2c 95 60 92 85 f0 	subl   $0x1,-0xf7a6da0(,%edx,4)
+f0101483:	01 
+}
+f0101484:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101487:	c9                   	leave
+f0101488:	c3                   	ret
+		page_free_lists[order] = pp->pp_link;
+f0101489:	8b 08                	mov    (%eax),%ecx
+f010148b:	89 0c 95 a0 92 85 f0 	mov    %ecx,-0xf7a6d60(,%edx,4)
+f0101492:	eb cb                	jmp    f010145f <page_free_unlink+0xf>
+
+f0101494 <page_free_block>:
+
+// Give back the block of 2^order pages starting at pp, merging it with
+// its buddy for as long as the buddy is free
+static void
+page_free_block(struct PageInfo *pp, int order)
+{
+f0101494:	55                   	push   %ebp
+f0101495:	89 e5                	mov    %esp,%ebp
+f0101497:	57                   	push   %edi
+f0101498:	56                   	push   %esi
+f0101499:	53                   	push   %ebx
+f010149a:	83 ec 0c             	sub    $0xc,%esp
+f010149d:	89 d3                	mov    %edx,%ebx
+	size_t pn = pp - pages, buddy;
+f010149f:	2b 05 60 a0 85 f0    	sub    0xf085a060,%eax
+f01014a5:	c1 f8 02             	sar    $0x2,%eax
+f01014a8:	69 f8 b7 6d db b6    	imul   $0xb6db6db7,%eax,%edi
+
+	num_free_pages += 1 << order;
+f01014ae:	b8 01 00 00 00       	mov    $0x1,%eax
+f01014b3:	89 d1                	mov    %edx,%ecx
+f01014b5:	d3 e0                	shl    %cl,%eax
+f01014b7:	01 05 5c a0 85 f0    	add    %eax,0xf085a05c
+	for (; order < PAGE_MAX_ORDER; order++) {
+f01014bd:	eb 0e                	jmp    f01014cd <page_free_block+0x39>
+		buddy = pn ^ (1 << order);
+		if (buddy >= npages || pages[buddy].pp_order != order)
+			break;
+		page_free_unlink(&pages[buddy], order);
+f01014bf:	89 da                	mov    %ebx,%edx
+f01014c1:	e8 8a ff ff ff       	call   f0101450 <page_free_unlink>
+		pn &= ~(1 << order);
+f01014c6:	f7 d6                	not    %esi
+f01014c8:	21 f7                	and    %esi,%edi
+	for (; order < PAGE_MAX_ORDER; order++) {
+f01014ca:	83 c3 01             	add    $0x1,%ebx
+f01014cd:	83 fb 09             	cmp    $0x9,%ebx
+f01014d0:	7f 26                	jg     f01014f8 <page_free_block+0x64>
+		buddy = pn ^ (1 << order);
+f01014d2:	be 01 00 00 00       	mov    $0x1,%esi
+f01014d7:	89 d9                	mov    %ebx,%ecx
+f01014d9:	d3 e6                	shl    %cl,%esi
+f01014db:	89 f0                	mov    %esi,%eax
+f01014dd:	31 f8                	xor    %edi,%eax
+		if (buddy >= npages || pages[buddy].pp_order != order)
+f01014df:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f01014e5:	73 11                	jae    f01014f8 <page_free_block+0x64>
+f01014e7:	6b c0 1c             	imul   $0x1c,%eax,%eax
+f01014ea:	03 05 60 a0 85 f0    	add    0xf085a060,%eax
+f01014f0:	0f be 50 08          	movsbl 0x8(%eax),%edx
+f01014f4:	39 da                	cmp    %ebx,%edx
+f01014f6:	74 c7                	je     f01014bf <page_free_block+0x2b>
+	}
+	page_free_link(&pages[pn], order);
+f01014f8:	6b c7 1c             	imul   $0x1c,%edi,%eax
+f01014fb:	03 05 60 a0 85 f0    	add    0xf085a060,%eax
+f0101501:	89 da                	mov    %ebx,%edx
+f0101503:	e8 1e ff ff ff       	call   f0101426 <page_free_link>
+}
+f0101508:	83 c4 0c             	add    $0xc,%esp
+f010150b:	5b                   	pop    %ebx
+f010150c:	5e                   	pop    %esi
+f010150d:	5f                   	pop    %edi
+f010150e:	5d                   	pop    %ebp
+f010150f:	c3                   	ret
+
+f0101510 <page_alloc_block>:
+
+// Take a block of 2^order pages off the free lists, splitting a bigger
+// block if there is none that size.  Returns its first page, or NULL.
+static struct PageInfo *
+page_alloc_block(int order)
+{
+f0101510:	55                   	push   %ebp
+f0101511:	89 e5                	mov    %esp,%ebp
+f0101513:	57                   	push   %edi
+f0101514:	56                   	push   %esi
+f0101515:	53                   	push   %ebx
+f0101516:	83 ec 0c             	sub    $0xc,%esp
+f0101519:	89 c6                	mov    %eax,%esi
+	struct PageInfo *pp;
+	int k;
+
+	for (k = order; k <= PAGE_MAX_ORDER && !page_free_lists[k]; k++)
+f010151b:	89 c3                	mov    %eax,%ebx
+f010151d:	eb 03                	jmp    f0101522 <page_alloc_block+0x12>
+f010151f:	83 c3 01             	add    $0x1,%ebx
+f0101522:	83 fb 0a             	cmp    $0xa,%ebx
+f0101525:	7f 4e                	jg     f0101575 <page_alloc_block+0x65>
+f0101527:	83 3c 9d a0 92 85 f0 	cmpl   $0x0,-0xf7a6d60(,%ebx,4)
+f010152e:	00 
+f010152f:	74 ee                	je     f010151f <page_alloc_block+0xf>
+		/* do nothing */;
+	if (k > PAGE_MAX_ORDER)
+		return NULL;
+	pp = page_free_lists[k];
+f0101531:	8b 3c 9d a0 92 85 f0 	mov    -0xf7a6d60(,%ebx,4),%edi
+	page_free_unlink(pp, k);
+f0101538:	89 da                	mov    %ebx,%edx
+f010153a:	89 f8                	mov    %edi,%eax
+f010153c:	e8 0f ff ff ff       	call   f0101450 <page_free_unlink>
+	// Give back the top half until the block is the right size
+	while (k > order) {
+f0101541:	39 f3                	cmp    %esi,%ebx
+f0101543:	7e 17                	jle    f010155c <page_alloc_block+0x4c>
+		k--;
+f0101545:	83 eb 01             	sub    $0x1,%ebx
+		page_free_link(pp + (1 << k), k);
+f0101548:	b8 1c 00 00 00       	mov    $0x1c,%eax
+f010154d:	89 d9                	mov    %ebx,%ecx
+f010154f:	d3 e0                	shl    %cl,%eax
+f0101551:	01 f8                	add    %edi,%eax
+f0101553:	89 da                	mov    %ebx,%edx
+f0101555:	e8 cc fe ff ff       	call   f0101426 <page_free_link>
+f010155a:	eb e5                	jmp    f0101541 <page_alloc_block+0x31>
+	}
+	num_free_pages -= 1 << order;
+f010155c:	b8 01 00 00 00       	mov    $0x1,%eax
+f0101561:	89 f1                	mov    %esi,%ecx
+f0101563:	d3 e0                	shl    %cl,%eax
+f0101565:	29 05 5c a0 85 f0    	sub    %eax,0xf085a05c
+	return pp;
+}
+f010156b:	89 f8                	mov    %edi,%eax
+f010156d:	83 c4 0c             	add    $0xc,%esp
+f0101570:	5b                   	pop    %ebx
+f0101571:	5e                   	pop    %esi
+f0101572:	5f                   	pop    %edi
+f0101573:	5d                   	pop    %ebp
+f0101574:	c3                   	ret
+		return NULL;
+f0101575:	bf 00 00 00 00       	mov    $0x0,%edi
+f010157a:	eb ef                	jmp    f010156b <page_alloc_block+0x5b>
+
+f010157c <boot_alloc>:
+	if (!nextfree) {
+f010157c:	83 3d 44 72 85 f0 00 	cmpl   $0x0,0xf0857244
+f0101583:	74 2d                	je     f01015b2 <boot_alloc+0x36>
+	result = nextfree;  // store the address before changing it,
+f0101585:	8b 0d 44 72 85 f0    	mov    0xf0857244,%ecx
+	nextfree = ROUNDUP(nextfree+n, PGSIZE); // increment by n bytes, then
+f010158b:	8d 94 01 ff 0f 00 00 	lea    0xfff(%ecx,%eax,1),%edx
+f0101592:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0101598:	89 15 44 72 85 f0    	mov    %edx,0xf0857244
+	if (((size_t) nextfree) >= KERNBASE + (npages * PGSIZE)) {
+f010159e:	a1 54 a0 85 f0       	mov    0xf085a054,%eax
+f01015a3:	05 00 00 0f 00       	add    $0xf0000,%eax
+f01015a8:	c1 e0 0c             	shl    $0xc,%eax
+f01015ab:	39 c2                	cmp    %eax,%edx
+f01015ad:	73 16                	jae    f01015c5 <boot_alloc+0x49>
+}
+f01015af:	89 c8                	mov    %ecx,%eax
+f01015b1:	c3                   	ret
+		nextfree = ROUNDUP((char *) end, PGSIZE);
+f01015b2:	ba 07 d0 89 f0       	mov    $0xf089d007,%edx
+f01015b7:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f01015bd:	89 15 44 72 85 f0    	mov    %edx,0xf0857244
+f01015c3:	eb c0                	jmp    f0101585 <boot_alloc+0x9>
+{
+f01015c5:	55                   	push   %ebp
+f01015c6:	89 e5                	mov    %esp,%ebp
+f01015c8:	83 ec 0c             	sub    $0xc,%esp
+		panic("boot_alloc: out of memory\n");
+f01015cb:	68 60 94 10 f0       	push   $0xf0109460
+f01015d0:	6a 76                	push   $0x76
+f01015d2:	68 7b 94 10 f0       	push   $0xf010947b
+f01015d7:	e8 64 ea ff ff       	call   f0100040 <_panic>
+
+f01015dc <page_init>:
+// allocator functions below to allocate and deallocate physical
+// memory via the free lists.
+//
+void
+page_init(void)
+{
+f01015dc:	55                   	push   %ebp
+f01015dd:	89 e5                	mov    %esp,%ebp
+f01015df:	57                   	push   %edi
+f01015e0:	56                   	push   %esi
+f01015e1:	53                   	push   %ebx
+f01015e2:	83 ec 0c             	sub    $0xc,%esp
+	// Change the code to reflect this.
+	// NB: DO NOT actually touch the physical memory corresponding to
+	// free pages!
+	size_t i;
+	size_t address = 0; // will temporarily store the address of a page
+	num_free_pages = 0; // initialize the number of free pages
+f01015e5:	c7 05 5c a0 85 f0 00 	movl   $0x0,0xf085a05c
+f01015ec:	00 00 00 
+	for (i = 0; i < npages; i++) {
+f01015ef:	ba 00 00 00 00       	mov    $0x0,%edx
+f01015f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01015f9:	eb 43                	jmp    f010163e <page_init+0x62>
+		pages[i].pp_ref = 0;
+f01015fb:	89 d0                	mov    %edx,%eax
+f01015fd:	03 05 60 a0 85 f0    	add    0xf085a060,%eax
+f0101603:	66 c7 40 0a 00 00    	movw   $0x0,0xa(%eax)
+		pages[i].pp_link = pages[i].pp_prev = 0;
+f0101609:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+f0101610:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		pages[i].pp_order = -1;
+f0101616:	89 d0                	mov    %edx,%eax
+f0101618:	03 05 60 a0 85 f0    	add    0xf085a060,%eax
+f010161e:	c6 40 08 ff          	movb   $0xff,0x8(%eax)
+		pages[i].age = PAGE_AGE_INITIAL;
+f0101622:	c6 40 0e fe          	movb   $0xfe,0xe(%eax)
+                pages[i].nfu_age = 0;
+f0101626:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+		pages[i].timestamp = 9223372036854775807;
+f010162a:	c7 40 10 ff ff ff ff 	movl   $0xffffffff,0x10(%eax)
+f0101631:	c7 40 14 ff ff ff 7f 	movl   $0x7fffffff,0x14(%eax)
+	for (i = 0; i < npages; i++) {
+f0101638:	83 c1 01             	add    $0x1,%ecx
+f010163b:	83 c2 1c             	add    $0x1c,%edx
+f010163e:	3b 0d 54 a0 85 f0    	cmp    0xf085a054,%ecx
+f0101644:	72 b5                	jb     f01015fb <page_init+0x1f>
+f0101646:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010164b:	bf 00 00 00 00       	mov    $0x0,%edi
+	}
+	// Free the free pages one at a time, and let the buddy allocator
+	// put them together into blocks.
+	for (i = 0; i < npages; i++) {
+f0101650:	be 00 00 00 00       	mov    $0x0,%esi
+f0101655:	eb 26                	jmp    f010167d <page_init+0xa1>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101657:	52                   	push   %edx
+f0101658:	68 e4 85 10 f0       	push   $0xf01085e4
+f010165d:	6a 6c                	push   $0x6c
+f010165f:	68 87 94 10 f0       	push   $0xf0109487
+f0101664:	e8 d7 e9 ff ff       	call   f0100040 <_panic>
+		// Free this page in any of these cases:
+		//  2) the address is in base memory [PGSIZE, npages_basemem * PGSIZE)
+		//  4) the address is in extended memory [EXTPHYSMEM, ...)
+		//       and isn't in the kernel memory and isn't already in use
+		//  TODO Make sure 4) is implemented correctly
+		if (((PGSIZE <= address && address < npages_basemem * PGSIZE) || (EXTPHYSMEM <= address && (boot_alloc(0) <= page2kva(&pages[i])))) && (address != MPENTRY_PADDR))
+f0101669:	81 fb 00 70 00 00    	cmp    $0x7000,%ebx
+f010166f:	75 63                	jne    f01016d4 <page_init+0xf8>
+	for (i = 0; i < npages; i++) {
+f0101671:	83 c6 01             	add    $0x1,%esi
+f0101674:	83 c7 1c             	add    $0x1c,%edi
+f0101677:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f010167d:	3b 35 54 a0 85 f0    	cmp    0xf085a054,%esi
+f0101683:	73 63                	jae    f01016e8 <page_init+0x10c>
+		if (((PGSIZE <= address && address < npages_basemem * PGSIZE) || (EXTPHYSMEM <= address && (boot_alloc(0) <= page2kva(&pages[i])))) && (address != MPENTRY_PADDR))
+f0101685:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+f010168b:	76 e4                	jbe    f0101671 <page_init+0x95>
+f010168d:	a1 cc 92 85 f0       	mov    0xf08592cc,%eax
+f0101692:	c1 e0 0c             	shl    $0xc,%eax
+f0101695:	39 c3                	cmp    %eax,%ebx
+f0101697:	72 d0                	jb     f0101669 <page_init+0x8d>
+f0101699:	81 fb ff ff 0f 00    	cmp    $0xfffff,%ebx
+f010169f:	76 d0                	jbe    f0101671 <page_init+0x95>
+f01016a1:	b8 00 00 00 00       	mov    $0x0,%eax
+f01016a6:	e8 d1 fe ff ff       	call   f010157c <boot_alloc>
+f01016ab:	89 c1                	mov    %eax,%ecx
+void	user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
+
+static inline physaddr_t
+page2pa(struct PageInfo *pp)
+{
+	return (pp - pages) << PGSHIFT;
+f01016ad:	89 f8                	mov    %edi,%eax
+f01016af:	c1 f8 02             	sar    $0x2,%eax
+f01016b2:	69 c0 b7 6d db b6    	imul   $0xb6db6db7,%eax,%eax
+f01016b8:	89 c2                	mov    %eax,%edx
+f01016ba:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01016bd:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01016c2:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f01016c8:	73 8d                	jae    f0101657 <page_init+0x7b>
+	return (void *)(pa + KERNBASE);
+f01016ca:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f01016d0:	39 ca                	cmp    %ecx,%edx
+f01016d2:	72 9d                	jb     f0101671 <page_init+0x95>
+			page_free_block(&pages[i], 0);
+f01016d4:	89 f8                	mov    %edi,%eax
+f01016d6:	03 05 60 a0 85 f0    	add    0xf085a060,%eax
+f01016dc:	ba 00 00 00 00       	mov    $0x0,%edx
+f01016e1:	e8 ae fd ff ff       	call   f0101494 <page_free_block>
+f01016e6:	eb 89                	jmp    f0101671 <page_init+0x95>
+	}
+}
+f01016e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01016eb:	5b                   	pop    %ebx
+f01016ec:	5e                   	pop    %esi
+f01016ed:	5f                   	pop    %edi
+f01016ee:	5d                   	pop    %ebp
+f01016ef:	c3                   	ret
+
+f01016f0 <page_alloc>:
+// Returns NULL if out of free memory.
+//
+// Hint: use page2kva and memset
+struct PageInfo *
+page_alloc(int alloc_flags)
+{
+f01016f0:	55                   	push   %ebp
+f01016f1:	89 e5                	mov    %esp,%ebp
+f01016f3:	53                   	push   %ebx
+f01016f4:	83 ec 04             	sub    $0x4,%esp
+	struct PageInfo *pp;
+
+	// Single pages are the common case: take one straight off the
+	// order 0 list when there is one, as cheap as popping a stack
+	if ((pp = page_free_lists[0])) {
+f01016f7:	8b 1d a0 92 85 f0    	mov    0xf08592a0,%ebx
+f01016fd:	85 db                	test   %ebx,%ebx
+f01016ff:	74 2b                	je     f010172c <page_alloc+0x3c>
+		page_free_unlink(pp, 0);
+f0101701:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101706:	89 d8                	mov    %ebx,%eax
+f0101708:	e8 43 fd ff ff       	call   f0101450 <page_free_unlink>
+		num_free_pages--;
+f010170d:	83 2d 5c a0 85 f0 01 	subl   $0x1,0xf085a05c
+	} else if (!(pp = page_alloc_block(0)))
+		return NULL;
+
+	pp->age = PAGE_AGE_INITIAL;
+f0101714:	c6 43 0e fe          	movb   $0xfe,0xe(%ebx)
+	pp->pp_refs_chain = 0;
+f0101718:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (alloc_flags & ALLOC_ZERO) { // fills page with '\0' bytes
+f010171f:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+f0101723:	75 19                	jne    f010173e <page_alloc+0x4e>
+		memset(page2kva(pp), 0, PGSIZE);
+	}
+	return pp;
+}
+f0101725:	89 d8                	mov    %ebx,%eax
+f0101727:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010172a:	c9                   	leave
+f010172b:	c3                   	ret
+	} else if (!(pp = page_alloc_block(0)))
+f010172c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101731:	e8 da fd ff ff       	call   f0101510 <page_alloc_block>
+f0101736:	89 c3                	mov    %eax,%ebx
+f0101738:	85 c0                	test   %eax,%eax
+f010173a:	75 d8                	jne    f0101714 <page_alloc+0x24>
+f010173c:	eb e7                	jmp    f0101725 <page_alloc+0x35>
+	return (pp - pages) << PGSHIFT;
+f010173e:	89 d8                	mov    %ebx,%eax
+f0101740:	2b 05 60 a0 85 f0    	sub    0xf085a060,%eax
+f0101746:	c1 f8 02             	sar    $0x2,%eax
+f0101749:	69 c0 b7 6d db b6    	imul   $0xb6db6db7,%eax,%eax
+f010174f:	89 c2                	mov    %eax,%edx
+f0101751:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0101754:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101759:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f010175f:	73 1b                	jae    f010177c <page_alloc+0x8c>
+		memset(page2kva(pp), 0, PGSIZE);
+f0101761:	83 ec 04             	sub    $0x4,%esp
+f0101764:	68 00 10 00 00       	push   $0x1000
+f0101769:	6a 00                	push   $0x0
+	return (void *)(pa + KERNBASE);
+f010176b:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0101771:	52                   	push   %edx
+f0101772:	e8 18 60 00 00       	call   f010778f <memset>
+f0101777:	83 c4 10             	add    $0x10,%esp
+f010177a:	eb a9                	jmp    f0101725 <page_alloc+0x35>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010177c:	52                   	push   %edx
+f010177d:	68 e4 85 10 f0       	push   $0xf01085e4
+f0101782:	6a 6c                	push   $0x6c
+f0101784:	68 87 94 10 f0       	push   $0xf0109487
+f0101789:	e8 b2 e8 ff ff       	call   f0100040 <_panic>
+
+f010178e <page_alloc_contig>:
+// Returns NULL if there is no free block that big, or order is more than
+// PAGE_MAX_ORDER.
+//
+struct PageInfo *
+page_alloc_contig(int order, int alloc_flags)
+{
+f010178e:	55                   	push   %ebp
+f010178f:	89 e5                	mov    %esp,%ebp
+f0101791:	56                   	push   %esi
+f0101792:	53                   	push   %ebx
+f0101793:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct PageInfo *pp;
+	size_t i;
+
+	if (order < 0 || order > PAGE_MAX_ORDER || !(pp = page_alloc_block(order)))
+f0101796:	83 fe 0a             	cmp    $0xa,%esi
+f0101799:	0f 87 90 00 00 00    	ja     f010182f <page_alloc_contig+0xa1>
+f010179f:	89 f0                	mov    %esi,%eax
+f01017a1:	e8 6a fd ff ff       	call   f0101510 <page_alloc_block>
+f01017a6:	89 c3                	mov    %eax,%ebx
+f01017a8:	85 c0                	test   %eax,%eax
+f01017aa:	74 25                	je     f01017d1 <page_alloc_contig+0x43>
+f01017ac:	ba 1c 00 00 00       	mov    $0x1c,%edx
+f01017b1:	89 f1                	mov    %esi,%ecx
+f01017b3:	d3 e2                	shl    %cl,%edx
+f01017b5:	01 c2                	add    %eax,%edx
+f01017b7:	eb 0e                	jmp    f01017c7 <page_alloc_contig+0x39>
+		return NULL;
+	for (i = 0; i < (1 << order); i++) {
+		pp[i].age = PAGE_AGE_INITIAL;
+f01017b9:	c6 40 0e fe          	movb   $0xfe,0xe(%eax)
+		pp[i].pp_refs_chain = 0;
+f01017bd:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%eax)
+	for (i = 0; i < (1 << order); i++) {
+f01017c4:	83 c0 1c             	add    $0x1c,%eax
+f01017c7:	39 d0                	cmp    %edx,%eax
+f01017c9:	75 ee                	jne    f01017b9 <page_alloc_contig+0x2b>
+	}
+	if (alloc_flags & ALLOC_ZERO)
+f01017cb:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+f01017cf:	75 09                	jne    f01017da <page_alloc_contig+0x4c>
+		memset(page2kva(pp), 0, PGSIZE << order);
+	return pp;
+}
+f01017d1:	89 d8                	mov    %ebx,%eax
+f01017d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01017d6:	5b                   	pop    %ebx
+f01017d7:	5e                   	pop    %esi
+f01017d8:	5d                   	pop    %ebp
+f01017d9:	c3                   	ret
+		memset(page2kva(pp), 0, PGSIZE << order);
+f01017da:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01017df:	89 f1                	mov    %esi,%ecx
+f01017e1:	d3 e2                	shl    %cl,%edx
+	return (pp - pages) << PGSHIFT;
+f01017e3:	89 d8                	mov    %ebx,%eax
+f01017e5:	2b 05 60 a0 85 f0    	sub    0xf085a060,%eax
+f01017eb:	c1 f8 02             	sar    $0x2,%eax
+f01017ee:	69 c0 b7 6d db b6    	imul   $0xb6db6db7,%eax,%eax
+f01017f4:	89 c1                	mov    %eax,%ecx
+f01017f6:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f01017f9:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01017fe:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f0101804:	73 17                	jae    f010181d <page_alloc_contig+0x8f>
+f0101806:	83 ec 04             	sub    $0x4,%esp
+f0101809:	52                   	push   %edx
+f010180a:	6a 00                	push   $0x0
+	return (void *)(pa + KERNBASE);
+f010180c:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f0101812:	51                   	push   %ecx
+f0101813:	e8 77 5f 00 00       	call   f010778f <memset>
+f0101818:	83 c4 10             	add    $0x10,%esp
+f010181b:	eb b4                	jmp    f01017d1 <page_alloc_contig+0x43>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010181d:	51                   	push   %ecx
+f010181e:	68 e4 85 10 f0       	push   $0xf01085e4
+f0101823:	6a 6c                	push   $0x6c
+f0101825:	68 87 94 10 f0       	push   $0xf0109487
+f010182a:	e8 11 e8 ff ff       	call   f0100040 <_panic>
+		return NULL;
+f010182f:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0101834:	eb 9b                	jmp    f01017d1 <page_alloc_contig+0x43>
+
+f0101836 <page_free>:
+// Return a page to the free list.
+// (This function should only be called when pp->pp_ref reaches 0.)
+//
+void
+page_free(struct PageInfo *pp)
+{
+f0101836:	55                   	push   %ebp
+f0101837:	89 e5                	mov    %esp,%ebp
+f0101839:	83 ec 08             	sub    $0x8,%esp
+f010183c:	8b 45 08             	mov    0x8(%ebp),%eax
+	// Fill this function in
+	if (pp->pp_ref) {
+f010183f:	66 83 78 0a 00       	cmpw   $0x0,0xa(%eax)
+f0101844:	75 10                	jne    f0101856 <page_free+0x20>
+		panic("page_free: called when pp->pp_ref != 0\n");
+	}
+	pp->age = PAGE_AGE_INITIAL;
+f0101846:	c6 40 0e fe          	movb   $0xfe,0xe(%eax)
+	page_free_block(pp, 0);
+f010184a:	ba 00 00 00 00       	mov    $0x0,%edx
+f010184f:	e8 40 fc ff ff       	call   f0101494 <page_free_block>
+}
+f0101854:	c9                   	leave
+f0101855:	c3                   	ret
+		panic("page_free: called when pp->pp_ref != 0\n");
+f0101856:	83 ec 04             	sub    $0x4,%esp
+f0101859:	68 70 95 10 f0       	push   $0xf0109570
+f010185e:	68 01 02 00 00       	push   $0x201
+f0101863:	68 7b 94 10 f0       	push   $0xf010947b
+f0101868:	e8 d3 e7 ff ff       	call   f0100040 <_panic>
+
+f010186d <page_free_stats>:
+// of free blocks of order k, for each k up to PAGE_MAX_ORDER.  Returns
+// the number of free pages.
+//
+size_t
+page_free_stats(size_t *nblocks)
+{
+f010186d:	55                   	push   %ebp
+f010186e:	89 e5                	mov    %esp,%ebp
+f0101870:	83 ec 0c             	sub    $0xc,%esp
+	memmove(nblocks, page_free_nblocks, sizeof(page_free_nblocks));
+f0101873:	6a 2c                	push   $0x2c
+f0101875:	68 60 92 85 f0       	push   $0xf0859260
+f010187a:	ff 75 08             	push   0x8(%ebp)
+f010187d:	e8 42 5f 00 00       	call   f01077c4 <memmove>
+	return num_free_pages;
+}
+f0101882:	a1 5c a0 85 f0       	mov    0xf085a05c,%eax
+f0101887:	c9                   	leave
+f0101888:	c3                   	ret
+
+f0101889 <mem_pressure_update>:
+// memory pressure level changed, wake everyone waiting for it to.
+// Called on every clock tick.
+//
+void
+mem_pressure_update(void)
+{
+f0101889:	55                   	push   %ebp
+f010188a:	89 e5                	mov    %esp,%ebp
+f010188c:	56                   	push   %esi
+f010188d:	53                   	push   %ebx
+	static const size_t watermarks[] = {
+		[MEM_PRESSURE_LOW]	MEM_PRESSURE_LOW_PAGES,
+		[MEM_PRESSURE_MEDIUM]	MEM_PRESSURE_MEDIUM_PAGES,
+		[MEM_PRESSURE_CRITICAL]	MEM_PRESSURE_CRITICAL_PAGES,
+	};
+	uint32_t level = meminfo->mi_level;
+f010188e:	8b 35 50 a0 85 f0    	mov    0xf085a050,%esi
+f0101894:	8b 06                	mov    (%esi),%eax
+
+	meminfo->mi_free_pages = num_free_pages;
+f0101896:	8b 1d 5c a0 85 f0    	mov    0xf085a05c,%ebx
+f010189c:	89 5e 04             	mov    %ebx,0x4(%esi)
+	while (level < MEM_PRESSURE_CRITICAL && num_free_pages < watermarks[level + 1])
+f010189f:	eb 02                	jmp    f01018a3 <mem_pressure_update+0x1a>
+		level++;
+f01018a1:	89 d0                	mov    %edx,%eax
+	while (level < MEM_PRESSURE_CRITICAL && num_free_pages < watermarks[level + 1])
+f01018a3:	83 f8 02             	cmp    $0x2,%eax
+f01018a6:	77 11                	ja     f01018b9 <mem_pressure_update+0x30>
+f01018a8:	8d 50 01             	lea    0x1(%eax),%edx
+f01018ab:	3b 1c 85 04 98 10 f0 	cmp    -0xfef67fc(,%eax,4),%ebx
+f01018b2:	72 ed                	jb     f01018a1 <mem_pressure_update+0x18>
+f01018b4:	eb 03                	jmp    f01018b9 <mem_pressure_update+0x30>
+	while (level > MEM_PRESSURE_NONE &&
+	       num_free_pages >= watermarks[level] + watermarks[level] / 4)
+		level--;
+f01018b6:	83 e8 01             	sub    $0x1,%eax
+	while (level > MEM_PRESSURE_NONE &&
+f01018b9:	85 c0                	test   %eax,%eax
+f01018bb:	74 12                	je     f01018cf <mem_pressure_update+0x46>
+	       num_free_pages >= watermarks[level] + watermarks[level] / 4)
+f01018bd:	8b 0c 85 00 98 10 f0 	mov    -0xfef6800(,%eax,4),%ecx
+f01018c4:	89 ca                	mov    %ecx,%edx
+f01018c6:	c1 ea 02             	shr    $0x2,%edx
+f01018c9:	01 ca                	add    %ecx,%edx
+	while (level > MEM_PRESSURE_NONE &&
+f01018cb:	39 d3                	cmp    %edx,%ebx
+f01018cd:	73 e7                	jae    f01018b6 <mem_pressure_update+0x2d>
+	if (level == meminfo->mi_level)
+f01018cf:	8b 16                	mov    (%esi),%edx
+f01018d1:	39 c2                	cmp    %eax,%edx
+f01018d3:	74 26                	je     f01018fb <mem_pressure_update+0x72>
+		return;
+	meminfo->mi_level = level;
+f01018d5:	89 06                	mov    %eax,(%esi)
+	env_futex_wake(PADDR((uint32_t *) &meminfo->mi_level), sizeof(uint32_t), NENV);
+f01018d7:	a1 50 a0 85 f0       	mov    0xf085a050,%eax
+	if ((uint32_t)kva < KERNBASE)
+f01018dc:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01018e1:	76 1f                	jbe    f0101902 <mem_pressure_update+0x79>
+f01018e3:	83 ec 04             	sub    $0x4,%esp
+f01018e6:	68 00 04 00 00       	push   $0x400
+f01018eb:	6a 04                	push   $0x4
+	return (physaddr_t)kva - KERNBASE;
+f01018ed:	05 00 00 00 10       	add    $0x10000000,%eax
+f01018f2:	50                   	push   %eax
+f01018f3:	e8 73 25 00 00       	call   f0103e6b <env_futex_wake>
+f01018f8:	83 c4 10             	add    $0x10,%esp
+}
+f01018fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01018fe:	5b                   	pop    %ebx
+f01018ff:	5e                   	pop    %esi
+f0101900:	5d                   	pop    %ebp
+f0101901:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101902:	50                   	push   %eax
+f0101903:	68 08 86 10 f0       	push   $0xf0108608
+f0101908:	68 2b 02 00 00       	push   $0x22b
+f010190d:	68 7b 94 10 f0       	push   $0xf010947b
+f0101912:	e8 29 e7 ff ff       	call   f0100040 <_panic>
+
+f0101917 <page_decref>:
+// Decrement the reference count on a page,
+// freeing it if there are no more refs.
+//
+void
+page_decref(struct PageInfo* pp)
+{
+f0101917:	55                   	push   %ebp
+f0101918:	89 e5                	mov    %esp,%ebp
+f010191a:	83 ec 08             	sub    $0x8,%esp
+f010191d:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (--pp->pp_ref == 0)
+f0101920:	0f b7 42 0a          	movzwl 0xa(%edx),%eax
+f0101924:	83 e8 01             	sub    $0x1,%eax
+f0101927:	66 89 42 0a          	mov    %ax,0xa(%edx)
+f010192b:	66 85 c0             	test   %ax,%ax
+f010192e:	74 02                	je     f0101932 <page_decref+0x1b>
+		page_free(pp);
+}
+f0101930:	c9                   	leave
+f0101931:	c3                   	ret
+		page_free(pp);
+f0101932:	83 ec 0c             	sub    $0xc,%esp
+f0101935:	52                   	push   %edx
+f0101936:	e8 fb fe ff ff       	call   f0101836 <page_free>
+f010193b:	83 c4 10             	add    $0x10,%esp
+}
+f010193e:	eb f0                	jmp    f0101930 <page_decref+0x19>
+
+f0101940 <page_remove_pte>:
+// 'pp', but leaves TLB invalidation to the caller.  This lets the range
+// functions below remove many mappings and then flush the TLB once.
+//
+static void
+page_remove_pte(struct PageInfo *pp, pte_t *pte, int *npages_store)
+{
+f0101940:	55                   	push   %ebp
+f0101941:	89 e5                	mov    %esp,%ebp
+f0101943:	57                   	push   %edi
+f0101944:	56                   	push   %esi
+f0101945:	53                   	push   %ebx
+f0101946:	83 ec 0c             	sub    $0xc,%esp
+f0101949:	89 c7                	mov    %eax,%edi
+f010194b:	89 d3                	mov    %edx,%ebx
+f010194d:	89 ce                	mov    %ecx,%esi
+	// The pg table entry corresponding to 'va' should be cleared.
+	// We leave PTE_AVAIL set to allow persistent user level map data.
+	// NOTE: this is really hacky, but makes the rest of the paging
+	// implementation cleaner.
+	*pte &= PTE_AVAIL;
+f010194f:	81 22 00 0e 00 00    	andl   $0xe00,(%edx)
+
+	// Whoever is asleep on a word in the page may be waiting for this
+	// (the other end of a pipe closing, say), so let them look again.
+	if (pp->pp_futex_waiters)
+f0101955:	66 83 78 0c 00       	cmpw   $0x0,0xc(%eax)
+f010195a:	75 14                	jne    f0101970 <page_remove_pte+0x30>
+		env_futex_wake(page2pa(pp), PGSIZE, NENV);
+
+	// The ref count on the physical page should decrement.
+	// The physical page should be freed if the refcount reaches 0.
+	page_decref(pp);
+f010195c:	83 ec 0c             	sub    $0xc,%esp
+f010195f:	57                   	push   %edi
+f0101960:	e8 b2 ff ff ff       	call   f0101917 <page_decref>
+
+	// Remove the PteChain
+	struct PteChain **pcp, *pc;
+	for (pcp = &pp->pp_refs_chain; (pc = *pcp) != NULL; pcp = &pc->pc_link)
+f0101965:	8d 57 18             	lea    0x18(%edi),%edx
+f0101968:	8b 47 18             	mov    0x18(%edi),%eax
+f010196b:	83 c4 10             	add    $0x10,%esp
+f010196e:	eb 2e                	jmp    f010199e <page_remove_pte+0x5e>
+		env_futex_wake(page2pa(pp), PGSIZE, NENV);
+f0101970:	83 ec 04             	sub    $0x4,%esp
+f0101973:	68 00 04 00 00       	push   $0x400
+f0101978:	68 00 10 00 00       	push   $0x1000
+	return (pp - pages) << PGSHIFT;
+f010197d:	2b 05 60 a0 85 f0    	sub    0xf085a060,%eax
+f0101983:	c1 f8 02             	sar    $0x2,%eax
+f0101986:	69 c0 b7 6d db b6    	imul   $0xb6db6db7,%eax,%eax
+f010198c:	c1 e0 0c             	shl    $0xc,%eax
+f010198f:	50                   	push   %eax
+f0101990:	e8 d6 24 00 00       	call   f0103e6b <env_futex_wake>
+f0101995:	83 c4 10             	add    $0x10,%esp
+f0101998:	eb c2                	jmp    f010195c <page_remove_pte+0x1c>
+	for (pcp = &pp->pp_refs_chain; (pc = *pcp) != NULL; pcp = &pc->pc_link)
+f010199a:	89 c2                	mov    %eax,%edx
+f010199c:	8b 00                	mov    (%eax),%eax
+f010199e:	85 c0                	test   %eax,%eax
+f01019a0:	74 15                	je     f01019b7 <page_remove_pte+0x77>
+		if (pc->pc_pte == pte) {
+f01019a2:	39 58 04             	cmp    %ebx,0x4(%eax)
+f01019a5:	75 f3                	jne    f010199a <page_remove_pte+0x5a>
+			*pcp = pc->pc_link;
+f01019a7:	8b 08                	mov    (%eax),%ecx
+f01019a9:	89 0a                	mov    %ecx,(%edx)
+			dealloc_pte_chain(pc);
+f01019ab:	83 ec 0c             	sub    $0xc,%esp
+f01019ae:	50                   	push   %eax
+f01019af:	e8 ea 69 00 00       	call   f010839e <dealloc_pte_chain>
+			break;
+f01019b4:	83 c4 10             	add    $0x10,%esp
+		}
+	if(npages_store)
+f01019b7:	85 f6                	test   %esi,%esi
+f01019b9:	74 03                	je     f01019be <page_remove_pte+0x7e>
+		--(*npages_store);
+f01019bb:	83 2e 01             	subl   $0x1,(%esi)
+}
+f01019be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01019c1:	5b                   	pop    %ebx
+f01019c2:	5e                   	pop    %esi
+f01019c3:	5f                   	pop    %edi
+f01019c4:	5d                   	pop    %ebp
+f01019c5:	c3                   	ret
+
+f01019c6 <page_insert_pte>:
+// pgdir_walk, without invalidating the TLB.  Returns 1 if a present
+// mapping was replaced (so the caller must flush the TLB), 0 otherwise.
+//
+static int
+page_insert_pte(pde_t *pgdir, pte_t *pte, struct PageInfo *pp, void *va, int perm, int *npages_store)
+{
+f01019c6:	55                   	push   %ebp
+f01019c7:	89 e5                	mov    %esp,%ebp
+f01019c9:	57                   	push   %edi
+f01019ca:	56                   	push   %esi
+f01019cb:	53                   	push   %ebx
+f01019cc:	83 ec 1c             	sub    $0x1c,%esp
+f01019cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f01019d2:	89 d7                	mov    %edx,%edi
+f01019d4:	89 cb                	mov    %ecx,%ebx
+
+	// Take the new reference first, so re-inserting the same page at
+	// the same address doesn't free it (see page_insert).  The new
+	// PteChain only gets its PTE once the old mapping is gone, so
+	// page_remove_pte takes the old one off the chain, not this one.
+	++(pp->pp_ref);
+f01019d6:	66 83 41 0a 01       	addw   $0x1,0xa(%ecx)
+	struct PteChain* temp_pc = alloc_pte_chain();
+f01019db:	e8 7e 69 00 00       	call   f010835e <alloc_pte_chain>
+f01019e0:	89 c6                	mov    %eax,%esi
+	temp_pc->pc_link = pp->pp_refs_chain;
+f01019e2:	8b 43 18             	mov    0x18(%ebx),%eax
+f01019e5:	89 06                	mov    %eax,(%esi)
+	pp->pp_refs_chain = temp_pc;
+f01019e7:	89 73 18             	mov    %esi,0x18(%ebx)
+	temp_pc->pc_pgdir = pgdir;
+f01019ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01019ed:	89 46 08             	mov    %eax,0x8(%esi)
+	temp_pc->pc_env_va = (uintptr_t)va;
+f01019f0:	8b 45 08             	mov    0x8(%ebp),%eax
+f01019f3:	89 46 0c             	mov    %eax,0xc(%esi)
+	temp_pc->pc_pte = NULL;
+f01019f6:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+
+	if (*pte & PTE_P) {
+f01019fd:	8b 17                	mov    (%edi),%edx
+	int replaced = 0;
+f01019ff:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (*pte & PTE_P) {
+f0101a04:	f6 c2 01             	test   $0x1,%dl
+f0101a07:	75 31                	jne    f0101a3a <page_insert_pte+0x74>
+		page_remove_pte(pa2page(PTE_ADDR(*pte)), pte, npages_store);
+		replaced = 1;
+	}
+	temp_pc->pc_pte = pte;
+f0101a09:	89 7e 04             	mov    %edi,0x4(%esi)
+f0101a0c:	2b 1d 60 a0 85 f0    	sub    0xf085a060,%ebx
+f0101a12:	c1 fb 02             	sar    $0x2,%ebx
+f0101a15:	69 db b7 6d db b6    	imul   $0xb6db6db7,%ebx,%ebx
+f0101a1b:	c1 e3 0c             	shl    $0xc,%ebx
+
+	*pte = ((pte_t)page2pa(pp))|perm|PTE_P|PTE_D;
+f0101a1e:	0b 5d 0c             	or     0xc(%ebp),%ebx
+f0101a21:	83 cb 41             	or     $0x41,%ebx
+f0101a24:	89 1f                	mov    %ebx,(%edi)
+	if(npages_store)
+f0101a26:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0101a2a:	74 06                	je     f0101a32 <page_insert_pte+0x6c>
+		++(*npages_store);
+f0101a2c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0101a2f:	83 01 01             	addl   $0x1,(%ecx)
+	return replaced;
+}
+f0101a32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101a35:	5b                   	pop    %ebx
+f0101a36:	5e                   	pop    %esi
+f0101a37:	5f                   	pop    %edi
+f0101a38:	5d                   	pop    %ebp
+f0101a39:	c3                   	ret
+}
+
+static inline struct PageInfo*
+pa2page(physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f0101a3a:	c1 ea 0c             	shr    $0xc,%edx
+f0101a3d:	3b 15 54 a0 85 f0    	cmp    0xf085a054,%edx
+f0101a43:	73 1a                	jae    f0101a5f <page_insert_pte+0x99>
+		panic("pa2page called with invalid pa");
+	return &pages[PGNUM(pa)];
+f0101a45:	6b c2 1c             	imul   $0x1c,%edx,%eax
+f0101a48:	03 05 60 a0 85 f0    	add    0xf085a060,%eax
+		page_remove_pte(pa2page(PTE_ADDR(*pte)), pte, npages_store);
+f0101a4e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0101a51:	89 fa                	mov    %edi,%edx
+f0101a53:	e8 e8 fe ff ff       	call   f0101940 <page_remove_pte>
+		replaced = 1;
+f0101a58:	b8 01 00 00 00       	mov    $0x1,%eax
+f0101a5d:	eb aa                	jmp    f0101a09 <page_insert_pte+0x43>
+		panic("pa2page called with invalid pa");
+f0101a5f:	83 ec 04             	sub    $0x4,%esp
+f0101a62:	68 98 95 10 f0       	push   $0xf0109598
+f0101a67:	6a 65                	push   $0x65
+f0101a69:	68 87 94 10 f0       	push   $0xf0109487
+f0101a6e:	e8 cd e5 ff ff       	call   f0100040 <_panic>
+
+f0101a73 <page_insert_large>:
+//   -E_NO_MEM, if there isn't 4MB of contiguous free memory, or a page
+//     for the page table
+//
+int
+page_insert_large(pde_t *pgdir, void *va, int perm, int *npages_store)
+{
+f0101a73:	55                   	push   %ebp
+f0101a74:	89 e5                	mov    %esp,%ebp
+f0101a76:	57                   	push   %edi
+f0101a77:	56                   	push   %esi
+f0101a78:	53                   	push   %ebx
+f0101a79:	83 ec 1c             	sub    $0x1c,%esp
+f0101a7c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct PageInfo *pp, *pt;
+	pte_t *ptes;
+	int i;
+
+	if ((uintptr_t) va % PTSIZE || pgdir[PDX(va)])
+f0101a7f:	a9 ff ff 3f 00       	test   $0x3fffff,%eax
+f0101a84:	0f 85 fb 00 00 00    	jne    f0101b85 <page_insert_large+0x112>
+f0101a8a:	89 c7                	mov    %eax,%edi
+f0101a8c:	c1 e8 16             	shr    $0x16,%eax
+f0101a8f:	8b 55 08             	mov    0x8(%ebp),%edx
+f0101a92:	8d 04 82             	lea    (%edx,%eax,4),%eax
+f0101a95:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0101a98:	83 38 00             	cmpl   $0x0,(%eax)
+f0101a9b:	0f 85 eb 00 00 00    	jne    f0101b8c <page_insert_large+0x119>
+		return -E_INVAL;
+	if (!(pt = page_alloc(ALLOC_ZERO)))
+f0101aa1:	83 ec 0c             	sub    $0xc,%esp
+f0101aa4:	6a 01                	push   $0x1
+f0101aa6:	e8 45 fc ff ff       	call   f01016f0 <page_alloc>
+f0101aab:	89 c3                	mov    %eax,%ebx
+f0101aad:	83 c4 10             	add    $0x10,%esp
+f0101ab0:	85 c0                	test   %eax,%eax
+f0101ab2:	0f 84 db 00 00 00    	je     f0101b93 <page_insert_large+0x120>
+		return -E_NO_MEM;
+	if (!(pp = page_alloc_contig(PAGE_MAX_ORDER, ALLOC_ZERO))) {
+f0101ab8:	83 ec 08             	sub    $0x8,%esp
+f0101abb:	6a 01                	push   $0x1
+f0101abd:	6a 0a                	push   $0xa
+f0101abf:	e8 ca fc ff ff       	call   f010178e <page_alloc_contig>
+f0101ac4:	83 c4 10             	add    $0x10,%esp
+f0101ac7:	85 c0                	test   %eax,%eax
+f0101ac9:	74 3d                	je     f0101b08 <page_insert_large+0x95>
+		page_free(pt);
+		return -E_NO_MEM;
+	}
+
+	++(pt->pp_ref);
+f0101acb:	66 83 43 0a 01       	addw   $0x1,0xa(%ebx)
+	return (pp - pages) << PGSHIFT;
+f0101ad0:	2b 1d 60 a0 85 f0    	sub    0xf085a060,%ebx
+f0101ad6:	c1 fb 02             	sar    $0x2,%ebx
+f0101ad9:	69 d3 b7 6d db b6    	imul   $0xb6db6db7,%ebx,%edx
+f0101adf:	89 d1                	mov    %edx,%ecx
+f0101ae1:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0101ae4:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f0101aea:	3b 15 54 a0 85 f0    	cmp    0xf085a054,%edx
+f0101af0:	73 29                	jae    f0101b1b <page_insert_large+0xa8>
+	return (void *)(pa + KERNBASE);
+f0101af2:	8d 99 00 00 00 f0    	lea    -0x10000000(%ecx),%ebx
+	ptes = page2kva(pt);
+	for (i = 0; i < NPTENTRIES; i++)
+f0101af8:	89 c6                	mov    %eax,%esi
+f0101afa:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+f0101b00:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f0101b03:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0101b06:	eb 4a                	jmp    f0101b52 <page_insert_large+0xdf>
+		page_free(pt);
+f0101b08:	83 ec 0c             	sub    $0xc,%esp
+f0101b0b:	53                   	push   %ebx
+f0101b0c:	e8 25 fd ff ff       	call   f0101836 <page_free>
+		return -E_NO_MEM;
+f0101b11:	83 c4 10             	add    $0x10,%esp
+f0101b14:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0101b19:	eb 62                	jmp    f0101b7d <page_insert_large+0x10a>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101b1b:	51                   	push   %ecx
+f0101b1c:	68 e4 85 10 f0       	push   $0xf01085e4
+f0101b21:	6a 6c                	push   $0x6c
+f0101b23:	68 87 94 10 f0       	push   $0xf0109487
+f0101b28:	e8 13 e5 ff ff       	call   f0100040 <_panic>
+		page_insert_pte(pgdir, &ptes[i], &pp[i], va + i*PGSIZE, perm, npages_store);
+f0101b2d:	83 ec 04             	sub    $0x4,%esp
+f0101b30:	ff 75 14             	push   0x14(%ebp)
+f0101b33:	ff 75 10             	push   0x10(%ebp)
+f0101b36:	57                   	push   %edi
+f0101b37:	89 f1                	mov    %esi,%ecx
+f0101b39:	89 da                	mov    %ebx,%edx
+f0101b3b:	8b 45 08             	mov    0x8(%ebp),%eax
+f0101b3e:	e8 83 fe ff ff       	call   f01019c6 <page_insert_pte>
+	for (i = 0; i < NPTENTRIES; i++)
+f0101b43:	83 c3 04             	add    $0x4,%ebx
+f0101b46:	83 c6 1c             	add    $0x1c,%esi
+f0101b49:	81 c7 00 10 00 00    	add    $0x1000,%edi
+f0101b4f:	83 c4 10             	add    $0x10,%esp
+f0101b52:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101b55:	39 c3                	cmp    %eax,%ebx
+f0101b57:	75 d4                	jne    f0101b2d <page_insert_large+0xba>
+	return (pp - pages) << PGSHIFT;
+f0101b59:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0101b5c:	2b 05 60 a0 85 f0    	sub    0xf085a060,%eax
+f0101b62:	c1 f8 02             	sar    $0x2,%eax
+f0101b65:	69 c0 b7 6d db b6    	imul   $0xb6db6db7,%eax,%eax
+f0101b6b:	c1 e0 0c             	shl    $0xc,%eax
+	// Nothing was mapped here, so there's nothing in the TLB to flush
+	pgdir[PDX(va)] = page2pa(pp)|perm|PTE_PS|PTE_P|PTE_D;
+f0101b6e:	0b 45 10             	or     0x10(%ebp),%eax
+f0101b71:	0c c1                	or     $0xc1,%al
+f0101b73:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0101b76:	89 02                	mov    %eax,(%edx)
+	return 0;
+f0101b78:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0101b7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101b80:	5b                   	pop    %ebx
+f0101b81:	5e                   	pop    %esi
+f0101b82:	5f                   	pop    %edi
+f0101b83:	5d                   	pop    %ebp
+f0101b84:	c3                   	ret
+		return -E_INVAL;
+f0101b85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0101b8a:	eb f1                	jmp    f0101b7d <page_insert_large+0x10a>
+f0101b8c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0101b91:	eb ea                	jmp    f0101b7d <page_insert_large+0x10a>
+		return -E_NO_MEM;
+f0101b93:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0101b98:	eb e3                	jmp    f0101b7d <page_insert_large+0x10a>
+
+f0101b9a <tlb_invalidate>:
+// Invalidate a TLB entry, but only if the page tables being
+// edited are the ones currently in use by the processor.
+//
+void
+tlb_invalidate(pde_t *pgdir, void *va)
+{
+f0101b9a:	55                   	push   %ebp
+f0101b9b:	89 e5                	mov    %esp,%ebp
+f0101b9d:	83 ec 08             	sub    $0x8,%esp
+	// Flush the entry only if we're modifying the current address space.
+	if (!curenv || curenv->env_pgdir == pgdir)
+f0101ba0:	e8 9e 62 00 00       	call   f0107e43 <cpunum>
+f0101ba5:	6b c0 74             	imul   $0x74,%eax,%eax
+f0101ba8:	83 b8 28 b0 85 f0 00 	cmpl   $0x0,-0xf7a4fd8(%eax)
+f0101baf:	74 16                	je     f0101bc7 <tlb_invalidate+0x2d>
+f0101bb1:	e8 8d 62 00 00       	call   f0107e43 <cpunum>
+f0101bb6:	6b c0 74             	imul   $0x74,%eax,%eax
+f0101bb9:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0101bbf:	8b 55 08             	mov    0x8(%ebp),%edx
+f0101bc2:	39 50 60             	cmp    %edx,0x60(%eax)
+f0101bc5:	75 06                	jne    f0101bcd <tlb_invalidate+0x33>
+	__asm __volatile("invlpg (%0)" : : "r" (addr) : "memory");
+f0101bc7:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101bca:	0f 01 38             	invlpg (%eax)
+		invlpg(va);
+}
+f0101bcd:	c9                   	leave
+f0101bce:	c3                   	ret
+
+f0101bcf <tlb_flush>:
+// are the ones currently in use by the processor.  Cheaper than many
+// tlb_invalidate calls once a batch touches more than a few pages.
+//
+void
+tlb_flush(pde_t *pgdir)
+{
+f0101bcf:	55                   	push   %ebp
+f0101bd0:	89 e5                	mov    %esp,%ebp
+f0101bd2:	83 ec 08             	sub    $0x8,%esp
+	if (!curenv || curenv->env_pgdir == pgdir)
+f0101bd5:	e8 69 62 00 00       	call   f0107e43 <cpunum>
+f0101bda:	6b c0 74             	imul   $0x74,%eax,%eax
+f0101bdd:	83 b8 28 b0 85 f0 00 	cmpl   $0x0,-0xf7a4fd8(%eax)
+f0101be4:	74 16                	je     f0101bfc <tlb_flush+0x2d>
+f0101be6:	e8 58 62 00 00       	call   f0107e43 <cpunum>
+f0101beb:	6b c0 74             	imul   $0x74,%eax,%eax
+f0101bee:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0101bf4:	8b 55 08             	mov    0x8(%ebp),%edx
+f0101bf7:	39 50 60             	cmp    %edx,0x60(%eax)
+f0101bfa:	75 06                	jne    f0101c02 <tlb_flush+0x33>
+	__asm __volatile("movl %%cr3,%0" : "=r" (val));
+f0101bfc:	0f 20 d8             	mov    %cr3,%eax
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f0101bff:	0f 22 d8             	mov    %eax,%cr3
+		lcr3(rcr3());
+}
+f0101c02:	c9                   	leave
+f0101c03:	c3                   	ret
+
+f0101c04 <page_split>:
+{
+f0101c04:	55                   	push   %ebp
+f0101c05:	89 e5                	mov    %esp,%ebp
+f0101c07:	57                   	push   %edi
+f0101c08:	56                   	push   %esi
+f0101c09:	53                   	push   %ebx
+f0101c0a:	83 ec 0c             	sub    $0xc,%esp
+f0101c0d:	8b 75 08             	mov    0x8(%ebp),%esi
+f0101c10:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	pde_t *pde = &pgdir[PDX(va)];
+f0101c13:	89 f8                	mov    %edi,%eax
+f0101c15:	c1 e8 16             	shr    $0x16,%eax
+f0101c18:	8d 1c 86             	lea    (%esi,%eax,4),%ebx
+	if ((*pde & (PTE_P|PTE_PS)) != (PTE_P|PTE_PS) || (uintptr_t) va >= UTOP)
+f0101c1b:	8b 03                	mov    (%ebx),%eax
+f0101c1d:	89 c2                	mov    %eax,%edx
+f0101c1f:	81 e2 81 00 00 00    	and    $0x81,%edx
+f0101c25:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+f0101c2b:	75 08                	jne    f0101c35 <page_split+0x31>
+f0101c2d:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+f0101c33:	76 08                	jbe    f0101c3d <page_split+0x39>
+}
+f0101c35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101c38:	5b                   	pop    %ebx
+f0101c39:	5e                   	pop    %esi
+f0101c3a:	5f                   	pop    %edi
+f0101c3b:	5d                   	pop    %ebp
+f0101c3c:	c3                   	ret
+	ptes = find_pte_va(pa2page(PTE_ADDR(*pde)), pgdir, ROUNDDOWN((uintptr_t) va, PTSIZE));
+f0101c3d:	89 fa                	mov    %edi,%edx
+f0101c3f:	81 e2 00 00 c0 ff    	and    $0xffc00000,%edx
+	if (PGNUM(pa) >= npages)
+f0101c45:	c1 e8 0c             	shr    $0xc,%eax
+f0101c48:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f0101c4e:	73 25                	jae    f0101c75 <page_split+0x71>
+f0101c50:	83 ec 04             	sub    $0x4,%esp
+f0101c53:	52                   	push   %edx
+f0101c54:	56                   	push   %esi
+	return &pages[PGNUM(pa)];
+f0101c55:	6b c0 1c             	imul   $0x1c,%eax,%eax
+f0101c58:	03 05 60 a0 85 f0    	add    0xf085a060,%eax
+f0101c5e:	50                   	push   %eax
+f0101c5f:	e8 bd 66 00 00       	call   f0108321 <find_pte_va>
+f0101c64:	89 c1                	mov    %eax,%ecx
+	if (!ptes)
+f0101c66:	83 c4 10             	add    $0x10,%esp
+f0101c69:	85 c0                	test   %eax,%eax
+f0101c6b:	74 1c                	je     f0101c89 <page_split+0x85>
+f0101c6d:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+f0101c73:	eb 33                	jmp    f0101ca8 <page_split+0xa4>
+		panic("pa2page called with invalid pa");
+f0101c75:	83 ec 04             	sub    $0x4,%esp
+f0101c78:	68 98 95 10 f0       	push   $0xf0109598
+f0101c7d:	6a 65                	push   $0x65
+f0101c7f:	68 87 94 10 f0       	push   $0xf0109487
+f0101c84:	e8 b7 e3 ff ff       	call   f0100040 <_panic>
+		panic("page_split: large page at %p has no page table", va);
+f0101c89:	57                   	push   %edi
+f0101c8a:	68 b8 95 10 f0       	push   $0xf01095b8
+f0101c8f:	68 c0 03 00 00       	push   $0x3c0
+f0101c94:	68 7b 94 10 f0       	push   $0xf010947b
+f0101c99:	e8 a2 e3 ff ff       	call   f0100040 <_panic>
+		ptes[i] |= *pde & PTE_A;
+f0101c9e:	8b 13                	mov    (%ebx),%edx
+f0101ca0:	83 e2 20             	and    $0x20,%edx
+f0101ca3:	09 10                	or     %edx,(%eax)
+	for (i = 0; i < NPTENTRIES; i++)
+f0101ca5:	83 c0 04             	add    $0x4,%eax
+f0101ca8:	39 f8                	cmp    %edi,%eax
+f0101caa:	75 f2                	jne    f0101c9e <page_split+0x9a>
+	if ((uint32_t)kva < KERNBASE)
+f0101cac:	81 f9 ff ff ff ef    	cmp    $0xefffffff,%ecx
+f0101cb2:	76 1c                	jbe    f0101cd0 <page_split+0xcc>
+	return (physaddr_t)kva - KERNBASE;
+f0101cb4:	81 c1 00 00 00 10    	add    $0x10000000,%ecx
+	*pde = PADDR(ptes)|PTE_P|PTE_W|PTE_U;
+f0101cba:	83 c9 07             	or     $0x7,%ecx
+f0101cbd:	89 0b                	mov    %ecx,(%ebx)
+	tlb_flush(pgdir);
+f0101cbf:	83 ec 0c             	sub    $0xc,%esp
+f0101cc2:	56                   	push   %esi
+f0101cc3:	e8 07 ff ff ff       	call   f0101bcf <tlb_flush>
+f0101cc8:	83 c4 10             	add    $0x10,%esp
+f0101ccb:	e9 65 ff ff ff       	jmp    f0101c35 <page_split+0x31>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101cd0:	51                   	push   %ecx
+f0101cd1:	68 08 86 10 f0       	push   $0xf0108608
+f0101cd6:	68 c3 03 00 00       	push   $0x3c3
+f0101cdb:	68 7b 94 10 f0       	push   $0xf010947b
+f0101ce0:	e8 5b e3 ff ff       	call   f0100040 <_panic>
+
+f0101ce5 <pgdir_walk>:
+{
+f0101ce5:	55                   	push   %ebp
+f0101ce6:	89 e5                	mov    %esp,%ebp
+f0101ce8:	57                   	push   %edi
+f0101ce9:	56                   	push   %esi
+f0101cea:	53                   	push   %ebx
+f0101ceb:	83 ec 0c             	sub    $0xc,%esp
+f0101cee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0101cf1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	pde = &pgdir[PDX(va)];
+f0101cf4:	89 da                	mov    %ebx,%edx
+f0101cf6:	c1 ea 16             	shr    $0x16,%edx
+f0101cf9:	8d 34 91             	lea    (%ecx,%edx,4),%esi
+	if ((*pde & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS)) {
+f0101cfc:	8b 06                	mov    (%esi),%eax
+f0101cfe:	25 81 00 00 00       	and    $0x81,%eax
+f0101d03:	3d 81 00 00 00       	cmp    $0x81,%eax
+f0101d08:	74 7d                	je     f0101d87 <pgdir_walk+0xa2>
+	if(*pde & PTE_P){
+f0101d0a:	8b 16                	mov    (%esi),%edx
+f0101d0c:	f6 c2 01             	test   $0x1,%dl
+f0101d0f:	0f 85 8c 00 00 00    	jne    f0101da1 <pgdir_walk+0xbc>
+		if(!create || (pp = page_alloc(ALLOC_ZERO)) == NULL)
+f0101d15:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0101d19:	0f 84 da 00 00 00    	je     f0101df9 <pgdir_walk+0x114>
+f0101d1f:	83 ec 0c             	sub    $0xc,%esp
+f0101d22:	6a 01                	push   $0x1
+f0101d24:	e8 c7 f9 ff ff       	call   f01016f0 <page_alloc>
+f0101d29:	89 c2                	mov    %eax,%edx
+f0101d2b:	83 c4 10             	add    $0x10,%esp
+f0101d2e:	85 c0                	test   %eax,%eax
+f0101d30:	0f 84 cd 00 00 00    	je     f0101e03 <pgdir_walk+0x11e>
+	return (pp - pages) << PGSHIFT;
+f0101d36:	2b 05 60 a0 85 f0    	sub    0xf085a060,%eax
+f0101d3c:	c1 f8 02             	sar    $0x2,%eax
+f0101d3f:	69 c0 b7 6d db b6    	imul   $0xb6db6db7,%eax,%eax
+f0101d45:	89 c1                	mov    %eax,%ecx
+f0101d47:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0101d4a:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101d4f:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f0101d55:	73 78                	jae    f0101dcf <pgdir_walk+0xea>
+	return (void *)(pa + KERNBASE);
+f0101d57:	8d b9 00 00 00 f0    	lea    -0x10000000(%ecx),%edi
+f0101d5d:	89 f8                	mov    %edi,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0101d5f:	81 ff ff ff ff ef    	cmp    $0xefffffff,%edi
+f0101d65:	76 7d                	jbe    f0101de4 <pgdir_walk+0xff>
+		*pde = PADDR(pgtab) | PTE_P | PTE_W | PTE_U;
+f0101d67:	83 c9 07             	or     $0x7,%ecx
+f0101d6a:	89 0e                	mov    %ecx,(%esi)
+		++(pp->pp_ref);
+f0101d6c:	66 83 42 0a 01       	addw   $0x1,0xa(%edx)
+	return &(pgtab[PTX(va)]);
+f0101d71:	c1 eb 0a             	shr    $0xa,%ebx
+f0101d74:	81 e3 fc 0f 00 00    	and    $0xffc,%ebx
+f0101d7a:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+}
+f0101d7d:	89 f0                	mov    %esi,%eax
+f0101d7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101d82:	5b                   	pop    %ebx
+f0101d83:	5e                   	pop    %esi
+f0101d84:	5f                   	pop    %edi
+f0101d85:	5d                   	pop    %ebp
+f0101d86:	c3                   	ret
+		if (PDX(va) >= PDX(UTOP))
+f0101d87:	81 fa ba 03 00 00    	cmp    $0x3ba,%edx
+f0101d8d:	77 ee                	ja     f0101d7d <pgdir_walk+0x98>
+		page_split(pgdir, (void *) va);
+f0101d8f:	83 ec 08             	sub    $0x8,%esp
+f0101d92:	53                   	push   %ebx
+f0101d93:	51                   	push   %ecx
+f0101d94:	e8 6b fe ff ff       	call   f0101c04 <page_split>
+f0101d99:	83 c4 10             	add    $0x10,%esp
+f0101d9c:	e9 69 ff ff ff       	jmp    f0101d0a <pgdir_walk+0x25>
+		pgtab = (pte_t*)KADDR(PTE_ADDR(*pde));
+f0101da1:	89 d0                	mov    %edx,%eax
+f0101da3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if (PGNUM(pa) >= npages)
+f0101da8:	c1 ea 0c             	shr    $0xc,%edx
+f0101dab:	3b 15 54 a0 85 f0    	cmp    0xf085a054,%edx
+f0101db1:	73 07                	jae    f0101dba <pgdir_walk+0xd5>
+	return (void *)(pa + KERNBASE);
+f0101db3:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0101db8:	eb b7                	jmp    f0101d71 <pgdir_walk+0x8c>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101dba:	50                   	push   %eax
+f0101dbb:	68 e4 85 10 f0       	push   $0xf01085e4
+f0101dc0:	68 65 02 00 00       	push   $0x265
+f0101dc5:	68 7b 94 10 f0       	push   $0xf010947b
+f0101dca:	e8 71 e2 ff ff       	call   f0100040 <_panic>
+f0101dcf:	51                   	push   %ecx
+f0101dd0:	68 e4 85 10 f0       	push   $0xf01085e4
+f0101dd5:	68 6a 02 00 00       	push   $0x26a
+f0101dda:	68 7b 94 10 f0       	push   $0xf010947b
+f0101ddf:	e8 5c e2 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101de4:	57                   	push   %edi
+f0101de5:	68 08 86 10 f0       	push   $0xf0108608
+f0101dea:	68 6b 02 00 00       	push   $0x26b
+f0101def:	68 7b 94 10 f0       	push   $0xf010947b
+f0101df4:	e8 47 e2 ff ff       	call   f0100040 <_panic>
+			return NULL;
+f0101df9:	be 00 00 00 00       	mov    $0x0,%esi
+f0101dfe:	e9 7a ff ff ff       	jmp    f0101d7d <pgdir_walk+0x98>
+f0101e03:	89 c6                	mov    %eax,%esi
+f0101e05:	e9 73 ff ff ff       	jmp    f0101d7d <pgdir_walk+0x98>
+
+f0101e0a <boot_map_region>:
+{
+f0101e0a:	55                   	push   %ebp
+f0101e0b:	89 e5                	mov    %esp,%ebp
+f0101e0d:	57                   	push   %edi
+f0101e0e:	56                   	push   %esi
+f0101e0f:	53                   	push   %ebx
+f0101e10:	83 ec 1c             	sub    $0x1c,%esp
+f0101e13:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (size % PGSIZE) {
+f0101e16:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+f0101e1c:	75 15                	jne    f0101e33 <boot_map_region+0x29>
+f0101e1e:	89 d3                	mov    %edx,%ebx
+f0101e20:	89 ce                	mov    %ecx,%esi
+	va = ROUNDDOWN(va, PGSIZE);
+f0101e22:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	pa = ROUNDDOWN(pa, PGSIZE);
+f0101e28:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0101e2b:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	while (size > 0) {
+f0101e31:	eb 48                	jmp    f0101e7b <boot_map_region+0x71>
+		panic("boot_map_region: size is not a multiple of PGSIZE");
+f0101e33:	83 ec 04             	sub    $0x4,%esp
+f0101e36:	68 e8 95 10 f0       	push   $0xf01095e8
+f0101e3b:	68 8b 02 00 00       	push   $0x28b
+f0101e40:	68 7b 94 10 f0       	push   $0xf010947b
+f0101e45:	e8 f6 e1 ff ff       	call   f0100040 <_panic>
+		if ((pte = pgdir_walk(pgdir, (void *)va, 1)) != NULL)
+f0101e4a:	83 ec 04             	sub    $0x4,%esp
+f0101e4d:	6a 01                	push   $0x1
+f0101e4f:	53                   	push   %ebx
+f0101e50:	ff 75 e4             	push   -0x1c(%ebp)
+f0101e53:	e8 8d fe ff ff       	call   f0101ce5 <pgdir_walk>
+f0101e58:	83 c4 10             	add    $0x10,%esp
+f0101e5b:	85 c0                	test   %eax,%eax
+f0101e5d:	74 0a                	je     f0101e69 <boot_map_region+0x5f>
+			*pte = pa|perm|PTE_P;
+f0101e5f:	89 fa                	mov    %edi,%edx
+f0101e61:	0b 55 0c             	or     0xc(%ebp),%edx
+f0101e64:	83 ca 01             	or     $0x1,%edx
+f0101e67:	89 10                	mov    %edx,(%eax)
+		va += PGSIZE;
+f0101e69:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		pa += PGSIZE;
+f0101e6f:	81 c7 00 10 00 00    	add    $0x1000,%edi
+		size -= PGSIZE;
+f0101e75:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+	while (size > 0) {
+f0101e7b:	85 f6                	test   %esi,%esi
+f0101e7d:	74 39                	je     f0101eb8 <boot_map_region+0xae>
+		if (va % PTSIZE == 0 && pa % PTSIZE == 0 && size >= PTSIZE) {
+f0101e7f:	89 d8                	mov    %ebx,%eax
+f0101e81:	09 f8                	or     %edi,%eax
+f0101e83:	a9 ff ff 3f 00       	test   $0x3fffff,%eax
+f0101e88:	75 c0                	jne    f0101e4a <boot_map_region+0x40>
+f0101e8a:	81 fe ff ff 3f 00    	cmp    $0x3fffff,%esi
+f0101e90:	76 b8                	jbe    f0101e4a <boot_map_region+0x40>
+			pgdir[PDX(va)] = pa|perm|PTE_PS|PTE_P;
+f0101e92:	89 da                	mov    %ebx,%edx
+f0101e94:	c1 ea 16             	shr    $0x16,%edx
+f0101e97:	89 f8                	mov    %edi,%eax
+f0101e99:	0b 45 0c             	or     0xc(%ebp),%eax
+f0101e9c:	0c 81                	or     $0x81,%al
+f0101e9e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0101ea1:	89 04 91             	mov    %eax,(%ecx,%edx,4)
+			va += PTSIZE;
+f0101ea4:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+			pa += PTSIZE;
+f0101eaa:	81 c7 00 00 40 00    	add    $0x400000,%edi
+			size -= PTSIZE;
+f0101eb0:	81 ee 00 00 40 00    	sub    $0x400000,%esi
+			continue;
+f0101eb6:	eb c3                	jmp    f0101e7b <boot_map_region+0x71>
+}
+f0101eb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101ebb:	5b                   	pop    %ebx
+f0101ebc:	5e                   	pop    %esi
+f0101ebd:	5f                   	pop    %edi
+f0101ebe:	5d                   	pop    %ebp
+f0101ebf:	c3                   	ret
+
+f0101ec0 <mem_init>:
+{
+f0101ec0:	55                   	push   %ebp
+f0101ec1:	89 e5                	mov    %esp,%ebp
+f0101ec3:	57                   	push   %edi
+f0101ec4:	56                   	push   %esi
+f0101ec5:	53                   	push   %ebx
+f0101ec6:	83 ec 48             	sub    $0x48,%esp
+	return mc146818_read(r) | (mc146818_read(r + 1) << 8);
+f0101ec9:	6a 15                	push   $0x15
+f0101ecb:	e8 8a 24 00 00       	call   f010435a <mc146818_read>
+f0101ed0:	89 c3                	mov    %eax,%ebx
+f0101ed2:	c7 04 24 16 00 00 00 	movl   $0x16,(%esp)
+f0101ed9:	e8 7c 24 00 00       	call   f010435a <mc146818_read>
+f0101ede:	c1 e0 08             	shl    $0x8,%eax
+f0101ee1:	09 d8                	or     %ebx,%eax
+	npages_basemem = (nvram_read(NVRAM_BASELO) * 1024) / PGSIZE;
+f0101ee3:	8d 50 03             	lea    0x3(%eax),%edx
+f0101ee6:	85 c0                	test   %eax,%eax
+f0101ee8:	0f 48 c2             	cmovs  %edx,%eax
+f0101eeb:	c1 f8 02             	sar    $0x2,%eax
+f0101eee:	a3 cc 92 85 f0       	mov    %eax,0xf08592cc
+	return mc146818_read(r) | (mc146818_read(r + 1) << 8);
+f0101ef3:	c7 04 24 17 00 00 00 	movl   $0x17,(%esp)
+f0101efa:	e8 5b 24 00 00       	call   f010435a <mc146818_read>
+f0101eff:	89 c3                	mov    %eax,%ebx
+f0101f01:	c7 04 24 18 00 00 00 	movl   $0x18,(%esp)
+f0101f08:	e8 4d 24 00 00       	call   f010435a <mc146818_read>
+f0101f0d:	c1 e0 08             	shl    $0x8,%eax
+f0101f10:	89 c2                	mov    %eax,%edx
+f0101f12:	09 da                	or     %ebx,%edx
+	npages_extmem = (nvram_read(NVRAM_EXTLO) * 1024) / PGSIZE;
+f0101f14:	8d 42 03             	lea    0x3(%edx),%eax
+f0101f17:	83 c4 10             	add    $0x10,%esp
+f0101f1a:	85 d2                	test   %edx,%edx
+f0101f1c:	0f 49 c2             	cmovns %edx,%eax
+f0101f1f:	c1 f8 02             	sar    $0x2,%eax
+		npages = (EXTPHYSMEM / PGSIZE) + npages_extmem;
+f0101f22:	8d 90 00 01 00 00    	lea    0x100(%eax),%edx
+f0101f28:	0f 44 15 cc 92 85 f0 	cmove  0xf08592cc,%edx
+f0101f2f:	89 15 54 a0 85 f0    	mov    %edx,0xf085a054
+		npages_extmem * PGSIZE / 1024);
+f0101f35:	c1 e0 0c             	shl    $0xc,%eax
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
+f0101f38:	c1 e8 0a             	shr    $0xa,%eax
+f0101f3b:	50                   	push   %eax
+		npages_basemem * PGSIZE / 1024,
+f0101f3c:	a1 cc 92 85 f0       	mov    0xf08592cc,%eax
+f0101f41:	c1 e0 0c             	shl    $0xc,%eax
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
+f0101f44:	c1 e8 0a             	shr    $0xa,%eax
+f0101f47:	50                   	push   %eax
+		npages * PGSIZE / 1024,
+f0101f48:	c1 e2 0c             	shl    $0xc,%edx
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
+f0101f4b:	c1 ea 0a             	shr    $0xa,%edx
+f0101f4e:	52                   	push   %edx
+f0101f4f:	68 1c 96 10 f0       	push   $0xf010961c
+f0101f54:	e8 91 25 00 00       	call   f01044ea <cprintf>
+	kern_pgdir = (pde_t *) boot_alloc(PGSIZE);
+f0101f59:	b8 00 10 00 00       	mov    $0x1000,%eax
+f0101f5e:	e8 19 f6 ff ff       	call   f010157c <boot_alloc>
+f0101f63:	a3 58 a0 85 f0       	mov    %eax,0xf085a058
+	memset(kern_pgdir, 0, PGSIZE);
+f0101f68:	83 c4 0c             	add    $0xc,%esp
+f0101f6b:	68 00 10 00 00       	push   $0x1000
+f0101f70:	6a 00                	push   $0x0
+f0101f72:	50                   	push   %eax
+f0101f73:	e8 17 58 00 00       	call   f010778f <memset>
+	kern_pgdir[PDX(UVPT)] = PADDR(kern_pgdir) | PTE_U | PTE_P;
+f0101f78:	a1 58 a0 85 f0       	mov    0xf085a058,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0101f7d:	83 c4 10             	add    $0x10,%esp
+f0101f80:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0101f85:	0f 86 0c 01 00 00    	jbe    f0102097 <mem_init+0x1d7>
+	return (physaddr_t)kva - KERNBASE;
+f0101f8b:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f0101f91:	83 ca 05             	or     $0x5,%edx
+f0101f94:	89 90 f4 0e 00 00    	mov    %edx,0xef4(%eax)
+	n = ROUNDUP(npages*sizeof(struct PageInfo), PGSIZE);
+f0101f9a:	6b 05 54 a0 85 f0 1c 	imul   $0x1c,0xf085a054,%eax
+f0101fa1:	05 ff 0f 00 00       	add    $0xfff,%eax
+f0101fa6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0101fab:	89 c6                	mov    %eax,%esi
+	pages = (struct PageInfo *) boot_alloc(n);  // allocate pages memory
+f0101fad:	e8 ca f5 ff ff       	call   f010157c <boot_alloc>
+f0101fb2:	a3 60 a0 85 f0       	mov    %eax,0xf085a060
+	memset(pages, 0, n);    // zero all the memory in pages
+f0101fb7:	83 ec 04             	sub    $0x4,%esp
+f0101fba:	56                   	push   %esi
+f0101fbb:	6a 00                	push   $0x0
+f0101fbd:	50                   	push   %eax
+f0101fbe:	e8 cc 57 00 00       	call   f010778f <memset>
+	envs = (struct Env *) boot_alloc(m);        // allocate envs memory
+f0101fc3:	b8 00 00 05 00       	mov    $0x50000,%eax
+f0101fc8:	e8 af f5 ff ff       	call   f010157c <boot_alloc>
+f0101fcd:	a3 e0 92 85 f0       	mov    %eax,0xf08592e0
+	memset(envs, 0, m);     // zero all the memory in envs
+f0101fd2:	83 c4 0c             	add    $0xc,%esp
+f0101fd5:	68 00 00 05 00       	push   $0x50000
+f0101fda:	6a 00                	push   $0x0
+f0101fdc:	50                   	push   %eax
+f0101fdd:	e8 ad 57 00 00       	call   f010778f <memset>
+	meminfo = (struct Meminfo *) boot_alloc(PGSIZE);
+f0101fe2:	b8 00 10 00 00       	mov    $0x1000,%eax
+f0101fe7:	e8 90 f5 ff ff       	call   f010157c <boot_alloc>
+f0101fec:	a3 50 a0 85 f0       	mov    %eax,0xf085a050
+	memset(meminfo, 0, PGSIZE);
+f0101ff1:	83 c4 0c             	add    $0xc,%esp
+f0101ff4:	68 00 10 00 00       	push   $0x1000
+f0101ff9:	6a 00                	push   $0x0
+f0101ffb:	50                   	push   %eax
+f0101ffc:	e8 8e 57 00 00       	call   f010778f <memset>
+	meminfo->mi_npages = npages;
+f0102001:	a1 50 a0 85 f0       	mov    0xf085a050,%eax
+f0102006:	8b 15 54 a0 85 f0    	mov    0xf085a054,%edx
+f010200c:	89 50 08             	mov    %edx,0x8(%eax)
+	boot_map_region(kern_pgdir, (uintptr_t)KERNBASE, -KERNBASE, (physaddr_t)0, PTE_W | PTE_P);
+f010200f:	83 c4 08             	add    $0x8,%esp
+f0102012:	6a 03                	push   $0x3
+f0102014:	6a 00                	push   $0x0
+f0102016:	b9 00 00 00 10       	mov    $0x10000000,%ecx
+f010201b:	ba 00 00 00 f0       	mov    $0xf0000000,%edx
+f0102020:	a1 58 a0 85 f0       	mov    0xf085a058,%eax
+f0102025:	e8 e0 fd ff ff       	call   f0101e0a <boot_map_region>
+	__asm __volatile("movl %%cr4,%0" : "=r" (cr4));
+f010202a:	0f 20 e0             	mov    %cr4,%eax
+	lcr4(rcr4() | CR4_PSE);
+f010202d:	83 c8 10             	or     $0x10,%eax
+	__asm __volatile("movl %0,%%cr4" : : "r" (val));
+f0102030:	0f 22 e0             	mov    %eax,%cr4
+	lcr3(PADDR(kern_pgdir));
+f0102033:	a1 58 a0 85 f0       	mov    0xf085a058,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0102038:	83 c4 10             	add    $0x10,%esp
+f010203b:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102040:	76 6a                	jbe    f01020ac <mem_init+0x1ec>
+	return (physaddr_t)kva - KERNBASE;
+f0102042:	05 00 00 00 10       	add    $0x10000000,%eax
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f0102047:	0f 22 d8             	mov    %eax,%cr3
+	page_init();
+f010204a:	e8 8d f5 ff ff       	call   f01015dc <page_init>
+	int nfree_basemem = 0, nfree_extmem = 0;
+	char *first_free_page;
+	size_t i, nblocks;
+	int order;
+
+	first_free_page = (char *) boot_alloc(0);
+f010204f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0102054:	e8 23 f5 ff ff       	call   f010157c <boot_alloc>
+f0102059:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	int nfree_basemem = 0, nfree_extmem = 0;
+f010205c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+f0102063:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+	for (order = 0; order <= PAGE_MAX_ORDER; order++) {
+f010206a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		nblocks = 0;
+		for (block = page_free_lists[order]; block; block = block->pp_link) {
+			// check that we didn't corrupt the free list itself
+			assert(block >= pages);
+			assert(block < pages + npages);
+			assert(((char *) block - (char *) pages) % sizeof(*block) == 0);
+f0102071:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+		for (block = page_free_lists[order]; block; block = block->pp_link) {
+f0102074:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f0102077:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+f010207a:	8b 1c 8d a0 92 85 f0 	mov    -0xf7a6d60(,%ecx,4),%ebx
+			assert(block->pp_order == order);
+			assert((block - pages) % (1 << order) == 0);
+f0102081:	b8 01 00 00 00       	mov    $0x1,%eax
+f0102086:	d3 e0                	shl    %cl,%eax
+f0102088:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		nblocks = 0;
+f010208b:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+		for (block = page_free_lists[order]; block; block = block->pp_link) {
+f0102092:	e9 57 02 00 00       	jmp    f01022ee <mem_init+0x42e>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0102097:	50                   	push   %eax
+f0102098:	68 08 86 10 f0       	push   $0xf0108608
+f010209d:	68 9c 00 00 00       	push   $0x9c
+f01020a2:	68 7b 94 10 f0       	push   $0xf010947b
+f01020a7:	e8 94 df ff ff       	call   f0100040 <_panic>
+f01020ac:	50                   	push   %eax
+f01020ad:	68 08 86 10 f0       	push   $0xf0108608
+f01020b2:	68 d3 00 00 00       	push   $0xd3
+f01020b7:	68 7b 94 10 f0       	push   $0xf010947b
+f01020bc:	e8 7f df ff ff       	call   f0100040 <_panic>
+			assert(block >= pages);
+f01020c1:	68 95 94 10 f0       	push   $0xf0109495
+f01020c6:	68 a4 94 10 f0       	push   $0xf01094a4
+f01020cb:	68 f8 05 00 00       	push   $0x5f8
+f01020d0:	68 7b 94 10 f0       	push   $0xf010947b
+f01020d5:	e8 66 df ff ff       	call   f0100040 <_panic>
+			assert(block < pages + npages);
+f01020da:	68 b9 94 10 f0       	push   $0xf01094b9
+f01020df:	68 a4 94 10 f0       	push   $0xf01094a4
+f01020e4:	68 f9 05 00 00       	push   $0x5f9
+f01020e9:	68 7b 94 10 f0       	push   $0xf010947b
+f01020ee:	e8 4d df ff ff       	call   f0100040 <_panic>
+			assert(((char *) block - (char *) pages) % sizeof(*block) == 0);
+f01020f3:	68 58 96 10 f0       	push   $0xf0109658
+f01020f8:	68 a4 94 10 f0       	push   $0xf01094a4
+f01020fd:	68 fa 05 00 00       	push   $0x5fa
+f0102102:	68 7b 94 10 f0       	push   $0xf010947b
+f0102107:	e8 34 df ff ff       	call   f0100040 <_panic>
+			assert(block->pp_order == order);
+f010210c:	68 d0 94 10 f0       	push   $0xf01094d0
+f0102111:	68 a4 94 10 f0       	push   $0xf01094a4
+f0102116:	68 fb 05 00 00       	push   $0x5fb
+f010211b:	68 7b 94 10 f0       	push   $0xf010947b
+f0102120:	e8 1b df ff ff       	call   f0100040 <_panic>
+			assert((block - pages) % (1 << order) == 0);
+f0102125:	68 90 96 10 f0       	push   $0xf0109690
+f010212a:	68 a4 94 10 f0       	push   $0xf01094a4
+f010212f:	68 fc 05 00 00       	push   $0x5fc
+f0102134:	68 7b 94 10 f0       	push   $0xf010947b
+f0102139:	e8 02 df ff ff       	call   f0100040 <_panic>
+			assert(!block->pp_link || block->pp_link->pp_prev == block);
+f010213e:	68 b4 96 10 f0       	push   $0xf01096b4
+f0102143:	68 a4 94 10 f0       	push   $0xf01094a4
+f0102148:	68 fd 05 00 00       	push   $0x5fd
+f010214d:	68 7b 94 10 f0       	push   $0xf010947b
+f0102152:	e8 e9 de ff ff       	call   f0100040 <_panic>
+	if (PGNUM(pa) >= npages)
+f0102157:	89 d0                	mov    %edx,%eax
+f0102159:	c1 e8 0c             	shr    $0xc,%eax
+f010215c:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f0102162:	73 21                	jae    f0102185 <mem_init+0x2c5>
+				pp = block + i;
+
+				// if there's a page that shouldn't be free,
+				// try to make sure it eventually causes trouble.
+				if (PDX(page2pa(pp)) < 1)
+					memset(page2kva(pp), 0x97, 128);
+f0102164:	83 ec 04             	sub    $0x4,%esp
+f0102167:	68 80 00 00 00       	push   $0x80
+f010216c:	68 97 00 00 00       	push   $0x97
+	return (void *)(pa + KERNBASE);
+f0102171:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0102177:	52                   	push   %edx
+f0102178:	e8 12 56 00 00       	call   f010778f <memset>
+f010217d:	83 c4 10             	add    $0x10,%esp
+f0102180:	e9 f7 00 00 00       	jmp    f010227c <mem_init+0x3bc>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0102185:	52                   	push   %edx
+f0102186:	68 e4 85 10 f0       	push   $0xf01085e4
+f010218b:	6a 6c                	push   $0x6c
+f010218d:	68 87 94 10 f0       	push   $0xf0109487
+f0102192:	e8 a9 de ff ff       	call   f0100040 <_panic>
+
+				// check a few pages that shouldn't be free
+				assert(page2pa(pp) != 0);
+f0102197:	68 e9 94 10 f0       	push   $0xf01094e9
+f010219c:	68 a4 94 10 f0       	push   $0xf01094a4
+f01021a1:	68 09 06 00 00       	push   $0x609
+f01021a6:	68 7b 94 10 f0       	push   $0xf010947b
+f01021ab:	e8 90 de ff ff       	call   f0100040 <_panic>
+				assert(page2pa(pp) != IOPHYSMEM);
+f01021b0:	68 fa 94 10 f0       	push   $0xf01094fa
+f01021b5:	68 a4 94 10 f0       	push   $0xf01094a4
+f01021ba:	68 0a 06 00 00       	push   $0x60a
+f01021bf:	68 7b 94 10 f0       	push   $0xf010947b
+f01021c4:	e8 77 de ff ff       	call   f0100040 <_panic>
+				assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+f01021c9:	68 e8 96 10 f0       	push   $0xf01096e8
+f01021ce:	68 a4 94 10 f0       	push   $0xf01094a4
+f01021d3:	68 0b 06 00 00       	push   $0x60b
+f01021d8:	68 7b 94 10 f0       	push   $0xf010947b
+f01021dd:	e8 5e de ff ff       	call   f0100040 <_panic>
+				assert(page2pa(pp) != EXTPHYSMEM);
+f01021e2:	68 13 95 10 f0       	push   $0xf0109513
+f01021e7:	68 a4 94 10 f0       	push   $0xf01094a4
+f01021ec:	68 0c 06 00 00       	push   $0x60c
+f01021f1:	68 7b 94 10 f0       	push   $0xf010947b
+f01021f6:	e8 45 de ff ff       	call   f0100040 <_panic>
+	if (PGNUM(pa) >= npages)
+f01021fb:	89 d8                	mov    %ebx,%eax
+f01021fd:	c1 e8 0c             	shr    $0xc,%eax
+f0102200:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f0102206:	73 13                	jae    f010221b <mem_init+0x35b>
+	return (void *)(pa + KERNBASE);
+f0102208:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+				assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f010220e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0102211:	39 c3                	cmp    %eax,%ebx
+f0102213:	72 18                	jb     f010222d <mem_init+0x36d>
+				assert(page2pa(pp) != MPENTRY_PADDR);
+
+				if (page2pa(pp) < EXTPHYSMEM)
+					++nfree_basemem;
+				else
+					++nfree_extmem;
+f0102215:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+f0102219:	eb 2f                	jmp    f010224a <mem_init+0x38a>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010221b:	53                   	push   %ebx
+f010221c:	68 e4 85 10 f0       	push   $0xf01085e4
+f0102221:	6a 6c                	push   $0x6c
+f0102223:	68 87 94 10 f0       	push   $0xf0109487
+f0102228:	e8 13 de ff ff       	call   f0100040 <_panic>
+				assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f010222d:	68 0c 97 10 f0       	push   $0xf010970c
+f0102232:	68 a4 94 10 f0       	push   $0xf01094a4
+f0102237:	68 0d 06 00 00       	push   $0x60d
+f010223c:	68 7b 94 10 f0       	push   $0xf010947b
+f0102241:	e8 fa dd ff ff       	call   f0100040 <_panic>
+					++nfree_basemem;
+f0102246:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+			for (i = 0; i < (1 << order); i++) {
+f010224a:	83 c7 01             	add    $0x1,%edi
+f010224d:	83 c6 1c             	add    $0x1c,%esi
+f0102250:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+f0102253:	0f 84 90 00 00 00    	je     f01022e9 <mem_init+0x429>
+				pp = block + i;
+f0102259:	89 f3                	mov    %esi,%ebx
+	return (pp - pages) << PGSHIFT;
+f010225b:	89 f0                	mov    %esi,%eax
+f010225d:	2b 05 60 a0 85 f0    	sub    0xf085a060,%eax
+f0102263:	c1 f8 02             	sar    $0x2,%eax
+f0102266:	69 c0 b7 6d db b6    	imul   $0xb6db6db7,%eax,%eax
+f010226c:	89 c2                	mov    %eax,%edx
+f010226e:	c1 e2 0c             	shl    $0xc,%edx
+				if (PDX(page2pa(pp)) < 1)
+f0102271:	a9 00 fc 0f 00       	test   $0xffc00,%eax
+f0102276:	0f 84 db fe ff ff    	je     f0102157 <mem_init+0x297>
+f010227c:	2b 1d 60 a0 85 f0    	sub    0xf085a060,%ebx
+f0102282:	c1 fb 02             	sar    $0x2,%ebx
+f0102285:	69 db b7 6d db b6    	imul   $0xb6db6db7,%ebx,%ebx
+				assert(page2pa(pp) != 0);
+f010228b:	c1 e3 0c             	shl    $0xc,%ebx
+f010228e:	0f 84 03 ff ff ff    	je     f0102197 <mem_init+0x2d7>
+				assert(page2pa(pp) != IOPHYSMEM);
+f0102294:	81 fb 00 00 0a 00    	cmp    $0xa0000,%ebx
+f010229a:	0f 84 10 ff ff ff    	je     f01021b0 <mem_init+0x2f0>
+				assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+f01022a0:	81 fb 00 f0 0f 00    	cmp    $0xff000,%ebx
+f01022a6:	0f 84 1d ff ff ff    	je     f01021c9 <mem_init+0x309>
+				assert(page2pa(pp) != EXTPHYSMEM);
+f01022ac:	81 fb 00 00 10 00    	cmp    $0x100000,%ebx
+f01022b2:	0f 84 2a ff ff ff    	je     f01021e2 <mem_init+0x322>
+				assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+f01022b8:	81 fb ff ff 0f 00    	cmp    $0xfffff,%ebx
+f01022be:	0f 87 37 ff ff ff    	ja     f01021fb <mem_init+0x33b>
+				assert(page2pa(pp) != MPENTRY_PADDR);
+f01022c4:	81 fb 00 70 00 00    	cmp    $0x7000,%ebx
+f01022ca:	0f 85 76 ff ff ff    	jne    f0102246 <mem_init+0x386>
+f01022d0:	68 2d 95 10 f0       	push   $0xf010952d
+f01022d5:	68 a4 94 10 f0       	push   $0xf01094a4
+f01022da:	68 0f 06 00 00       	push   $0x60f
+f01022df:	68 7b 94 10 f0       	push   $0xf010947b
+f01022e4:	e8 57 dd ff ff       	call   f0100040 <_panic>
+		for (block = page_free_lists[order]; block; block = block->pp_link) {
+f01022e9:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f01022ec:	8b 1b                	mov    (%ebx),%ebx
+f01022ee:	85 db                	test   %ebx,%ebx
+f01022f0:	74 7c                	je     f010236e <mem_init+0x4ae>
+			assert(block >= pages);
+f01022f2:	a1 60 a0 85 f0       	mov    0xf085a060,%eax
+f01022f7:	39 c3                	cmp    %eax,%ebx
+f01022f9:	0f 82 c2 fd ff ff    	jb     f01020c1 <mem_init+0x201>
+			assert(block < pages + npages);
+f01022ff:	6b 15 54 a0 85 f0 1c 	imul   $0x1c,0xf085a054,%edx
+f0102306:	01 c2                	add    %eax,%edx
+f0102308:	39 d3                	cmp    %edx,%ebx
+f010230a:	0f 83 ca fd ff ff    	jae    f01020da <mem_init+0x21a>
+			assert(((char *) block - (char *) pages) % sizeof(*block) == 0);
+f0102310:	89 d9                	mov    %ebx,%ecx
+f0102312:	29 c1                	sub    %eax,%ecx
+f0102314:	89 ca                	mov    %ecx,%edx
+f0102316:	c1 ea 02             	shr    $0x2,%edx
+f0102319:	b8 25 49 92 24       	mov    $0x24924925,%eax
+f010231e:	f7 e2                	mul    %edx
+f0102320:	6b d2 1c             	imul   $0x1c,%edx,%edx
+f0102323:	89 cf                	mov    %ecx,%edi
+f0102325:	29 d7                	sub    %edx,%edi
+f0102327:	0f 85 c6 fd ff ff    	jne    f01020f3 <mem_init+0x233>
+			assert(block->pp_order == order);
+f010232d:	0f be 43 08          	movsbl 0x8(%ebx),%eax
+f0102331:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f0102334:	39 f0                	cmp    %esi,%eax
+f0102336:	0f 85 d0 fd ff ff    	jne    f010210c <mem_init+0x24c>
+			assert((block - pages) % (1 << order) == 0);
+f010233c:	c1 f9 02             	sar    $0x2,%ecx
+f010233f:	69 c1 b7 6d db b6    	imul   $0xb6db6db7,%ecx,%eax
+f0102345:	99                   	cltd
+f0102346:	f7 7d e4             	idivl  -0x1c(%ebp)
+f0102349:	85 d2                	test   %edx,%edx
+f010234b:	0f 85 d4 fd ff ff    	jne    f0102125 <mem_init+0x265>
+			assert(!block->pp_link || block->pp_link->pp_prev == block);
+f0102351:	8b 03                	mov    (%ebx),%eax
+f0102353:	85 c0                	test   %eax,%eax
+f0102355:	74 09                	je     f0102360 <mem_init+0x4a0>
+f0102357:	3b 58 04             	cmp    0x4(%eax),%ebx
+f010235a:	0f 85 de fd ff ff    	jne    f010213e <mem_init+0x27e>
+			nblocks++;
+f0102360:	83 45 cc 01          	addl   $0x1,-0x34(%ebp)
+			for (i = 0; i < (1 << order); i++) {
+f0102364:	89 de                	mov    %ebx,%esi
+f0102366:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+f0102369:	e9 e2 fe ff ff       	jmp    f0102250 <mem_init+0x390>
+			}
+		}
+		assert(nblocks == page_free_nblocks[order]);
+f010236e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f0102371:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0102374:	3b 0c 85 60 92 85 f0 	cmp    -0xf7a6da0(,%eax,4),%ecx
+f010237b:	0f 85 13 01 00 00    	jne    f0102494 <mem_init+0x5d4>
+	for (order = 0; order <= PAGE_MAX_ORDER; order++) {
+f0102381:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+f0102385:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0102388:	83 f8 0b             	cmp    $0xb,%eax
+f010238b:	0f 85 e3 fc ff ff    	jne    f0102074 <mem_init+0x1b4>
+	}
+
+	assert(nfree_basemem > 0);
+f0102391:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+f0102394:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+f0102398:	0f 8e 0f 01 00 00    	jle    f01024ad <mem_init+0x5ed>
+	assert(nfree_extmem > 0);
+f010239e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+f01023a2:	0f 8e 1e 01 00 00    	jle    f01024c6 <mem_init+0x606>
+	assert(num_free_pages == nfree_basemem + nfree_extmem);
+f01023a8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f01023ab:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f01023ae:	01 c8                	add    %ecx,%eax
+f01023b0:	3b 05 5c a0 85 f0    	cmp    0xf085a05c,%eax
+f01023b6:	0f 85 23 01 00 00    	jne    f01024df <mem_init+0x61f>
+	boot_map_region(kern_pgdir, UPAGES, n, PADDR(pages), PTE_U | PTE_P);
+f01023bc:	a1 60 a0 85 f0       	mov    0xf085a060,%eax
+	if ((uint32_t)kva < KERNBASE)
+f01023c1:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01023c6:	0f 86 2c 01 00 00    	jbe    f01024f8 <mem_init+0x638>
+f01023cc:	83 ec 08             	sub    $0x8,%esp
+f01023cf:	6a 05                	push   $0x5
+	return (physaddr_t)kva - KERNBASE;
+f01023d1:	05 00 00 00 10       	add    $0x10000000,%eax
+f01023d6:	50                   	push   %eax
+f01023d7:	89 f1                	mov    %esi,%ecx
+f01023d9:	ba 00 00 00 ef       	mov    $0xef000000,%edx
+f01023de:	a1 58 a0 85 f0       	mov    0xf085a058,%eax
+f01023e3:	e8 22 fa ff ff       	call   f0101e0a <boot_map_region>
+	boot_map_region(kern_pgdir, UENVS, m, PADDR(envs), PTE_U | PTE_P);
+f01023e8:	a1 e0 92 85 f0       	mov    0xf08592e0,%eax
+	if ((uint32_t)kva < KERNBASE)
+f01023ed:	83 c4 10             	add    $0x10,%esp
+f01023f0:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01023f5:	0f 86 12 01 00 00    	jbe    f010250d <mem_init+0x64d>
+f01023fb:	83 ec 08             	sub    $0x8,%esp
+f01023fe:	6a 05                	push   $0x5
+	return (physaddr_t)kva - KERNBASE;
+f0102400:	05 00 00 00 10       	add    $0x10000000,%eax
+f0102405:	50                   	push   %eax
+f0102406:	b9 00 00 05 00       	mov    $0x50000,%ecx
+f010240b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+f0102410:	a1 58 a0 85 f0       	mov    0xf085a058,%eax
+f0102415:	e8 f0 f9 ff ff       	call   f0101e0a <boot_map_region>
+	boot_map_region(kern_pgdir, UMEMINFO, PGSIZE, PADDR(meminfo), PTE_U | PTE_P);
+f010241a:	a1 50 a0 85 f0       	mov    0xf085a050,%eax
+	if ((uint32_t)kva < KERNBASE)
+f010241f:	83 c4 10             	add    $0x10,%esp
+f0102422:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102427:	0f 86 f5 00 00 00    	jbe    f0102522 <mem_init+0x662>
+f010242d:	83 ec 08             	sub    $0x8,%esp
+f0102430:	6a 05                	push   $0x5
+	return (physaddr_t)kva - KERNBASE;
+f0102432:	05 00 00 00 10       	add    $0x10000000,%eax
+f0102437:	50                   	push   %eax
+f0102438:	b9 00 10 00 00       	mov    $0x1000,%ecx
+f010243d:	ba 00 f0 ff ee       	mov    $0xeefff000,%edx
+f0102442:	a1 58 a0 85 f0       	mov    0xf085a058,%eax
+f0102447:	e8 be f9 ff ff       	call   f0101e0a <boot_map_region>
+	if ((uint32_t)kva < KERNBASE)
+f010244c:	83 c4 10             	add    $0x10,%esp
+f010244f:	b8 00 b0 10 f0       	mov    $0xf010b000,%eax
+f0102454:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102459:	0f 86 d8 00 00 00    	jbe    f0102537 <mem_init+0x677>
+	boot_map_region(kern_pgdir, KSTACKTOP-KSTKSIZE, KSTKSIZE, PADDR(bootstack), PTE_W | PTE_P);
+f010245f:	83 ec 08             	sub    $0x8,%esp
+f0102462:	6a 03                	push   $0x3
+f0102464:	68 00 b0 10 00       	push   $0x10b000
+f0102469:	b9 00 80 00 00       	mov    $0x8000,%ecx
+f010246e:	ba 00 80 ff ef       	mov    $0xefff8000,%edx
+f0102473:	a1 58 a0 85 f0       	mov    0xf085a058,%eax
+f0102478:	e8 8d f9 ff ff       	call   f0101e0a <boot_map_region>
+	for (n = 0; n < NCPU; n++) {
+f010247d:	bb 00 c0 85 f0       	mov    $0xf085c000,%ebx
+f0102482:	bf 00 c0 89 f0       	mov    $0xf089c000,%edi
+f0102487:	83 c4 10             	add    $0x10,%esp
+f010248a:	be 00 80 ff ef       	mov    $0xefff8000,%esi
+f010248f:	e9 e4 00 00 00       	jmp    f0102578 <mem_init+0x6b8>
+		assert(nblocks == page_free_nblocks[order]);
+f0102494:	68 54 97 10 f0       	push   $0xf0109754
+f0102499:	68 a4 94 10 f0       	push   $0xf01094a4
+f010249e:	68 17 06 00 00       	push   $0x617
+f01024a3:	68 7b 94 10 f0       	push   $0xf010947b
+f01024a8:	e8 93 db ff ff       	call   f0100040 <_panic>
+	assert(nfree_basemem > 0);
+f01024ad:	68 4a 95 10 f0       	push   $0xf010954a
+f01024b2:	68 a4 94 10 f0       	push   $0xf01094a4
+f01024b7:	68 1a 06 00 00       	push   $0x61a
+f01024bc:	68 7b 94 10 f0       	push   $0xf010947b
+f01024c1:	e8 7a db ff ff       	call   f0100040 <_panic>
+	assert(nfree_extmem > 0);
+f01024c6:	68 5c 95 10 f0       	push   $0xf010955c
+f01024cb:	68 a4 94 10 f0       	push   $0xf01094a4
+f01024d0:	68 1b 06 00 00       	push   $0x61b
+f01024d5:	68 7b 94 10 f0       	push   $0xf010947b
+f01024da:	e8 61 db ff ff       	call   f0100040 <_panic>
+	assert(num_free_pages == nfree_basemem + nfree_extmem);
+f01024df:	68 78 97 10 f0       	push   $0xf0109778
+f01024e4:	68 a4 94 10 f0       	push   $0xf01094a4
+f01024e9:	68 1c 06 00 00       	push   $0x61c
+f01024ee:	68 7b 94 10 f0       	push   $0xf010947b
+f01024f3:	e8 48 db ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01024f8:	50                   	push   %eax
+f01024f9:	68 08 86 10 f0       	push   $0xf0108608
+f01024fe:	68 eb 00 00 00       	push   $0xeb
+f0102503:	68 7b 94 10 f0       	push   $0xf010947b
+f0102508:	e8 33 db ff ff       	call   f0100040 <_panic>
+f010250d:	50                   	push   %eax
+f010250e:	68 08 86 10 f0       	push   $0xf0108608
+f0102513:	68 f4 00 00 00       	push   $0xf4
+f0102518:	68 7b 94 10 f0       	push   $0xf010947b
+f010251d:	e8 1e db ff ff       	call   f0100040 <_panic>
+f0102522:	50                   	push   %eax
+f0102523:	68 08 86 10 f0       	push   $0xf0108608
+f0102528:	68 f5 00 00 00       	push   $0xf5
+f010252d:	68 7b 94 10 f0       	push   $0xf010947b
+f0102532:	e8 09 db ff ff       	call   f0100040 <_panic>
+f0102537:	50                   	push   %eax
+f0102538:	68 08 86 10 f0       	push   $0xf0108608
+f010253d:	68 02 01 00 00       	push   $0x102
+f0102542:	68 7b 94 10 f0       	push   $0xf010947b
+f0102547:	e8 f4 da ff ff       	call   f0100040 <_panic>
+		boot_map_region(kern_pgdir, KSTACKTOP - (KSTKSIZE + KSTKGAP) * (n + 1) + KSTKGAP, KSTKSIZE, PADDR(percpu_kstacks[n]), PTE_W | PTE_P);
+f010254c:	83 ec 08             	sub    $0x8,%esp
+f010254f:	6a 03                	push   $0x3
+	return (physaddr_t)kva - KERNBASE;
+f0102551:	8d 83 00 00 00 10    	lea    0x10000000(%ebx),%eax
+f0102557:	50                   	push   %eax
+f0102558:	b9 00 80 00 00       	mov    $0x8000,%ecx
+f010255d:	89 f2                	mov    %esi,%edx
+f010255f:	a1 58 a0 85 f0       	mov    0xf085a058,%eax
+f0102564:	e8 a1 f8 ff ff       	call   f0101e0a <boot_map_region>
+	for (n = 0; n < NCPU; n++) {
+f0102569:	81 ee 00 00 01 00    	sub    $0x10000,%esi
+f010256f:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+f0102575:	83 c4 10             	add    $0x10,%esp
+f0102578:	39 df                	cmp    %ebx,%edi
+f010257a:	74 1d                	je     f0102599 <mem_init+0x6d9>
+	if ((uint32_t)kva < KERNBASE)
+f010257c:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f0102582:	77 c8                	ja     f010254c <mem_init+0x68c>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0102584:	53                   	push   %ebx
+f0102585:	68 08 86 10 f0       	push   $0xf0108608
+f010258a:	68 2e 01 00 00       	push   $0x12e
+f010258f:	68 7b 94 10 f0       	push   $0xf010947b
+f0102594:	e8 a7 da ff ff       	call   f0100040 <_panic>
+	__asm __volatile("movl %%cr0,%0" : "=r" (val));
+f0102599:	0f 20 c0             	mov    %cr0,%eax
+	cr0 &= ~(CR0_TS|CR0_EM);
+f010259c:	83 e0 f3             	and    $0xfffffff3,%eax
+f010259f:	0d 23 00 05 80       	or     $0x80050023,%eax
+	__asm __volatile("movl %0,%%cr0" : : "r" (val));
+f01025a4:	0f 22 c0             	mov    %eax,%cr0
+}
+f01025a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01025aa:	5b                   	pop    %ebx
+f01025ab:	5e                   	pop    %esi
+f01025ac:	5f                   	pop    %edi
+f01025ad:	5d                   	pop    %ebp
+f01025ae:	c3                   	ret
+
+f01025af <page_lookup>:
+{
+f01025af:	55                   	push   %ebp
+f01025b0:	89 e5                	mov    %esp,%ebp
+f01025b2:	53                   	push   %ebx
+f01025b3:	83 ec 08             	sub    $0x8,%esp
+f01025b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	pte_t *pte = pgdir_walk(pgdir, va, 0);  // walk pgdir, get va's PTE
+f01025b9:	6a 00                	push   $0x0
+f01025bb:	ff 75 0c             	push   0xc(%ebp)
+f01025be:	ff 75 08             	push   0x8(%ebp)
+f01025c1:	e8 1f f7 ff ff       	call   f0101ce5 <pgdir_walk>
+	if (pte == NULL || !(*pte & PTE_P)) {
+f01025c6:	83 c4 10             	add    $0x10,%esp
+f01025c9:	85 c0                	test   %eax,%eax
+f01025cb:	74 21                	je     f01025ee <page_lookup+0x3f>
+f01025cd:	f6 00 01             	testb  $0x1,(%eax)
+f01025d0:	74 35                	je     f0102607 <page_lookup+0x58>
+	if (pte_store != 0) {
+f01025d2:	85 db                	test   %ebx,%ebx
+f01025d4:	74 02                	je     f01025d8 <page_lookup+0x29>
+		*pte_store = pte;
+f01025d6:	89 03                	mov    %eax,(%ebx)
+	if (PGNUM(pa) >= npages)
+f01025d8:	8b 00                	mov    (%eax),%eax
+f01025da:	c1 e8 0c             	shr    $0xc,%eax
+f01025dd:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f01025e3:	73 0e                	jae    f01025f3 <page_lookup+0x44>
+	return &pages[PGNUM(pa)];
+f01025e5:	6b c0 1c             	imul   $0x1c,%eax,%eax
+f01025e8:	03 05 60 a0 85 f0    	add    0xf085a060,%eax
+}
+f01025ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01025f1:	c9                   	leave
+f01025f2:	c3                   	ret
+		panic("pa2page called with invalid pa");
+f01025f3:	83 ec 04             	sub    $0x4,%esp
+f01025f6:	68 98 95 10 f0       	push   $0xf0109598
+f01025fb:	6a 65                	push   $0x65
+f01025fd:	68 87 94 10 f0       	push   $0xf0109487
+f0102602:	e8 39 da ff ff       	call   f0100040 <_panic>
+		return NULL;
+f0102607:	b8 00 00 00 00       	mov    $0x0,%eax
+f010260c:	eb e0                	jmp    f01025ee <page_lookup+0x3f>
+
+f010260e <page_remove>:
+{
+f010260e:	55                   	push   %ebp
+f010260f:	89 e5                	mov    %esp,%ebp
+f0102611:	56                   	push   %esi
+f0102612:	53                   	push   %ebx
+f0102613:	83 ec 14             	sub    $0x14,%esp
+f0102616:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0102619:	8b 75 0c             	mov    0xc(%ebp),%esi
+	pte_t *pte = 0;
+f010261c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+	struct PageInfo *pp = page_lookup(pgdir, va, &pte);
+f0102623:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0102626:	50                   	push   %eax
+f0102627:	56                   	push   %esi
+f0102628:	53                   	push   %ebx
+f0102629:	e8 81 ff ff ff       	call   f01025af <page_lookup>
+	if (pp) {
+f010262e:	83 c4 10             	add    $0x10,%esp
+f0102631:	85 c0                	test   %eax,%eax
+f0102633:	74 1f                	je     f0102654 <page_remove+0x46>
+		page_remove_pte(pp, pte, npages_store);
+f0102635:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0102638:	8b 55 f4             	mov    -0xc(%ebp),%edx
+f010263b:	e8 00 f3 ff ff       	call   f0101940 <page_remove_pte>
+		tlb_invalidate(pgdir, va);
+f0102640:	83 ec 08             	sub    $0x8,%esp
+f0102643:	56                   	push   %esi
+f0102644:	53                   	push   %ebx
+f0102645:	e8 50 f5 ff ff       	call   f0101b9a <tlb_invalidate>
+f010264a:	83 c4 10             	add    $0x10,%esp
+}
+f010264d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0102650:	5b                   	pop    %ebx
+f0102651:	5e                   	pop    %esi
+f0102652:	5d                   	pop    %ebp
+f0102653:	c3                   	ret
+	} else if ((pte = pgdir_walk(pgdir, va, 0)) && (*pte & PTE_SWAPPED)) {
+f0102654:	83 ec 04             	sub    $0x4,%esp
+f0102657:	6a 00                	push   $0x0
+f0102659:	56                   	push   %esi
+f010265a:	53                   	push   %ebx
+f010265b:	e8 85 f6 ff ff       	call   f0101ce5 <pgdir_walk>
+f0102660:	83 c4 10             	add    $0x10,%esp
+f0102663:	85 c0                	test   %eax,%eax
+f0102665:	74 e6                	je     f010264d <page_remove+0x3f>
+f0102667:	8b 10                	mov    (%eax),%edx
+f0102669:	f6 c2 80             	test   $0x80,%dl
+f010266c:	74 df                	je     f010264d <page_remove+0x3f>
+		*pte &= PTE_AVAIL;
+f010266e:	81 e2 00 0e 00 00    	and    $0xe00,%edx
+f0102674:	89 10                	mov    %edx,(%eax)
+}
+f0102676:	eb d5                	jmp    f010264d <page_remove+0x3f>
+
+f0102678 <page_insert>:
+{
+f0102678:	55                   	push   %ebp
+f0102679:	89 e5                	mov    %esp,%ebp
+f010267b:	57                   	push   %edi
+f010267c:	56                   	push   %esi
+f010267d:	53                   	push   %ebx
+f010267e:	83 ec 0c             	sub    $0xc,%esp
+f0102681:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0102684:	8b 7d 18             	mov    0x18(%ebp),%edi
+	++(pp->pp_ref); // new reference to pp, so increment pp_ref
+f0102687:	66 83 43 0a 01       	addw   $0x1,0xa(%ebx)
+	struct PteChain* temp_pc = alloc_pte_chain();
+f010268c:	e8 cd 5c 00 00       	call   f010835e <alloc_pte_chain>
+f0102691:	89 c6                	mov    %eax,%esi
+	temp_pc->pc_link = pp->pp_refs_chain;
+f0102693:	8b 43 18             	mov    0x18(%ebx),%eax
+f0102696:	89 06                	mov    %eax,(%esi)
+	pp->pp_refs_chain = temp_pc;
+f0102698:	89 73 18             	mov    %esi,0x18(%ebx)
+	temp_pc->pc_pgdir = pgdir;
+f010269b:	8b 45 08             	mov    0x8(%ebp),%eax
+f010269e:	89 46 08             	mov    %eax,0x8(%esi)
+	temp_pc->pc_env_va = (uintptr_t)va;
+f01026a1:	8b 45 10             	mov    0x10(%ebp),%eax
+f01026a4:	89 46 0c             	mov    %eax,0xc(%esi)
+	temp_pc->pc_pte = NULL;	// not to be mistaken for the old mapping's
+f01026a7:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	page_remove(pgdir, va, npages_store);
+f01026ae:	83 ec 04             	sub    $0x4,%esp
+f01026b1:	57                   	push   %edi
+f01026b2:	50                   	push   %eax
+f01026b3:	ff 75 08             	push   0x8(%ebp)
+f01026b6:	e8 53 ff ff ff       	call   f010260e <page_remove>
+	if (!(pte = pgdir_walk(pgdir, va, 1))) {
+f01026bb:	83 c4 0c             	add    $0xc,%esp
+f01026be:	6a 01                	push   $0x1
+f01026c0:	ff 75 10             	push   0x10(%ebp)
+f01026c3:	ff 75 08             	push   0x8(%ebp)
+f01026c6:	e8 1a f6 ff ff       	call   f0101ce5 <pgdir_walk>
+f01026cb:	83 c4 10             	add    $0x10,%esp
+f01026ce:	85 c0                	test   %eax,%eax
+f01026d0:	74 31                	je     f0102703 <page_insert+0x8b>
+	temp_pc->pc_pte = pte;
+f01026d2:	89 46 04             	mov    %eax,0x4(%esi)
+	return (pp - pages) << PGSHIFT;
+f01026d5:	2b 1d 60 a0 85 f0    	sub    0xf085a060,%ebx
+f01026db:	c1 fb 02             	sar    $0x2,%ebx
+f01026de:	69 db b7 6d db b6    	imul   $0xb6db6db7,%ebx,%ebx
+f01026e4:	c1 e3 0c             	shl    $0xc,%ebx
+	*pte = ((pte_t)page2pa(pp))|perm|PTE_P|PTE_D; // set PTE with pa, perms
+f01026e7:	0b 5d 14             	or     0x14(%ebp),%ebx
+f01026ea:	83 cb 41             	or     $0x41,%ebx
+f01026ed:	89 18                	mov    %ebx,(%eax)
+	return 0;   // indicate that insert was successful
+f01026ef:	b8 00 00 00 00       	mov    $0x0,%eax
+	if(npages_store)
+f01026f4:	85 ff                	test   %edi,%edi
+f01026f6:	74 03                	je     f01026fb <page_insert+0x83>
+		++(*npages_store);
+f01026f8:	83 07 01             	addl   $0x1,(%edi)
+}
+f01026fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01026fe:	5b                   	pop    %ebx
+f01026ff:	5e                   	pop    %esi
+f0102700:	5f                   	pop    %edi
+f0102701:	5d                   	pop    %ebp
+f0102702:	c3                   	ret
+		--(pp->pp_ref); // reset pp_ref to previous value
+f0102703:	66 83 6b 0a 01       	subw   $0x1,0xa(%ebx)
+		return -E_NO_MEM;   // don't insert page, return error code
+f0102708:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010270d:	eb ec                	jmp    f01026fb <page_insert+0x83>
+
+f010270f <page_reclaim>:
+{
+f010270f:	55                   	push   %ebp
+f0102710:	89 e5                	mov    %esp,%ebp
+f0102712:	57                   	push   %edi
+f0102713:	56                   	push   %esi
+f0102714:	53                   	push   %ebx
+f0102715:	83 ec 3c             	sub    $0x3c,%esp
+	reclaim_nenvs = 0;
+f0102718:	c7 05 4c 72 85 f0 00 	movl   $0x0,0xf085724c
+f010271f:	00 00 00 
+	for (e = envs; e < envs + NENV; e++) {
+f0102722:	8b 1d e0 92 85 f0    	mov    0xf08592e0,%ebx
+	bool over = 0;
+f0102728:	be 00 00 00 00       	mov    $0x0,%esi
+	for (e = envs; e < envs + NENV; e++) {
+f010272d:	eb 1c                	jmp    f010274b <page_reclaim+0x3c>
+	for (i = 0; i < ncpu; i++)
+f010272f:	83 c0 01             	add    $0x1,%eax
+f0102732:	39 c8                	cmp    %ecx,%eax
+f0102734:	0f 8d 8a 02 00 00    	jge    f01029c4 <page_reclaim+0x2b5>
+		if (cpus[i].cpu_env == e)
+f010273a:	6b d0 74             	imul   $0x74,%eax,%edx
+f010273d:	3b 9a 28 b0 85 f0    	cmp    -0xf7a4fd8(%edx),%ebx
+f0102743:	75 ea                	jne    f010272f <page_reclaim+0x20>
+	for (e = envs; e < envs + NENV; e++) {
+f0102745:	81 c3 40 01 00 00    	add    $0x140,%ebx
+f010274b:	a1 e0 92 85 f0       	mov    0xf08592e0,%eax
+f0102750:	05 00 00 05 00       	add    $0x50000,%eax
+f0102755:	39 c3                	cmp    %eax,%ebx
+f0102757:	73 3e                	jae    f0102797 <page_reclaim+0x88>
+		if (e->env_type != ENV_TYPE_USER || e->env_pagein_pager ||
+f0102759:	83 7b 50 00          	cmpl   $0x0,0x50(%ebx)
+f010275d:	75 e6                	jne    f0102745 <page_reclaim+0x36>
+f010275f:	8b 83 34 01 00 00    	mov    0x134(%ebx),%eax
+	for (i = 0; i < ncpu; i++)
+f0102765:	8b 0d c4 b3 85 f0    	mov    0xf085b3c4,%ecx
+		if (e->env_type != ENV_TYPE_USER || e->env_pagein_pager ||
+f010276b:	85 c0                	test   %eax,%eax
+f010276d:	74 c3                	je     f0102732 <page_reclaim+0x23>
+f010276f:	eb d4                	jmp    f0102745 <page_reclaim+0x36>
+		} else if (over)
+f0102771:	89 f0                	mov    %esi,%eax
+f0102773:	84 c0                	test   %al,%al
+f0102775:	75 ce                	jne    f0102745 <page_reclaim+0x36>
+		reclaim_envs[reclaim_nenvs].pgdir = e->env_pgdir;
+f0102777:	a1 4c 72 85 f0       	mov    0xf085724c,%eax
+f010277c:	8b 53 60             	mov    0x60(%ebx),%edx
+f010277f:	89 14 c5 60 72 85 f0 	mov    %edx,-0xf7a8da0(,%eax,8)
+		reclaim_envs[reclaim_nenvs].env = e;
+f0102786:	89 1c c5 64 72 85 f0 	mov    %ebx,-0xf7a8d9c(,%eax,8)
+		reclaim_nenvs++;
+f010278d:	83 c0 01             	add    $0x1,%eax
+f0102790:	a3 4c 72 85 f0       	mov    %eax,0xf085724c
+f0102795:	eb ae                	jmp    f0102745 <page_reclaim+0x36>
+		pp = &pages[(hand + n) % npages];
+f0102797:	8b 0d 40 72 85 f0    	mov    0xf0857240,%ecx
+	for (n = 0; n < npages; n++) {
+f010279d:	be 00 00 00 00       	mov    $0x0,%esi
+	uintptr_t owner_va = 0;
+f01027a2:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+	struct Env *e, *owner = NULL;
+f01027a9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	struct PageInfo *pp, *victim = NULL;
+f01027b0:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f01027b7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f01027ba:	e9 8f 00 00 00       	jmp    f010284e <page_reclaim+0x13f>
+	for (i = 0; i < reclaim_nenvs && reclaim_envs[i].pgdir != pgdir; i++)
+f01027bf:	83 c0 01             	add    $0x1,%eax
+f01027c2:	39 f8                	cmp    %edi,%eax
+f01027c4:	7d 30                	jge    f01027f6 <page_reclaim+0xe7>
+f01027c6:	3b 1c c5 60 72 85 f0 	cmp    -0xf7a8da0(,%eax,8),%ebx
+f01027cd:	75 f0                	jne    f01027bf <page_reclaim+0xb0>
+	for (seg = reclaim_envs[i].env->env_segs; seg < reclaim_envs[i].env->env_segs + NSEGS; seg++)
+f01027cf:	8b 1c c5 64 72 85 f0 	mov    -0xf7a8d9c(,%eax,8),%ebx
+f01027d6:	8d 83 b4 00 00 00    	lea    0xb4(%ebx),%eax
+f01027dc:	8d bb 34 01 00 00    	lea    0x134(%ebx),%edi
+f01027e2:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+f01027e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f01027e8:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+f01027eb:	89 55 bc             	mov    %edx,-0x44(%ebp)
+f01027ee:	89 5d b8             	mov    %ebx,-0x48(%ebp)
+f01027f1:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+f01027f4:	eb 0c                	jmp    f0102802 <page_reclaim+0xf3>
+	if (i == reclaim_nenvs)
+f01027f6:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+f01027f9:	39 f8                	cmp    %edi,%eax
+f01027fb:	75 d2                	jne    f01027cf <page_reclaim+0xc0>
+f01027fd:	eb 4c                	jmp    f010284b <page_reclaim+0x13c>
+	for (seg = reclaim_envs[i].env->env_segs; seg < reclaim_envs[i].env->env_segs + NSEGS; seg++)
+f01027ff:	83 c0 20             	add    $0x20,%eax
+f0102802:	39 d8                	cmp    %ebx,%eax
+f0102804:	74 15                	je     f010281b <page_reclaim+0x10c>
+		if (va >= seg->seg_va && va - seg->seg_va < seg->seg_memsz)
+f0102806:	8b 10                	mov    (%eax),%edx
+f0102808:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f010280b:	39 d1                	cmp    %edx,%ecx
+f010280d:	72 f0                	jb     f01027ff <page_reclaim+0xf0>
+f010280f:	29 d1                	sub    %edx,%ecx
+f0102811:	3b 48 04             	cmp    0x4(%eax),%ecx
+f0102814:	73 e9                	jae    f01027ff <page_reclaim+0xf0>
+f0102816:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f0102819:	eb 30                	jmp    f010284b <page_reclaim+0x13c>
+		    (pc->pc_pgdir[PDX(pc->pc_env_va)] & PTE_PS) ||
+f010281b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f010281e:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+f0102821:	8b 55 bc             	mov    -0x44(%ebp),%edx
+f0102824:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+f0102827:	85 db                	test   %ebx,%ebx
+f0102829:	74 20                	je     f010284b <page_reclaim+0x13c>
+		if (*pc->pc_pte & PTE_A) {
+f010282b:	f6 45 cc 20          	testb  $0x20,-0x34(%ebp)
+f010282f:	0f 85 b7 00 00 00    	jne    f01028ec <page_reclaim+0x1dd>
+		if (pp->age == 0)
+f0102835:	80 7d df 00          	cmpb   $0x0,-0x21(%ebp)
+f0102839:	0f 84 64 01 00 00    	je     f01029a3 <page_reclaim+0x294>
+		    pc->pc_env_va >= USTACKTOP - PGSIZE ||
+f010283f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0102842:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	return reclaim_envs[i].env;
+f0102845:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+		pp = &pages[(hand + n) % npages];
+f0102848:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	for (n = 0; n < npages; n++) {
+f010284b:	83 c6 01             	add    $0x1,%esi
+f010284e:	8b 0d 54 a0 85 f0    	mov    0xf085a054,%ecx
+f0102854:	39 ce                	cmp    %ecx,%esi
+f0102856:	0f 83 b4 00 00 00    	jae    f0102910 <page_reclaim+0x201>
+		pp = &pages[(hand + n) % npages];
+f010285c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010285f:	01 f0                	add    %esi,%eax
+f0102861:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102866:	f7 f1                	div    %ecx
+f0102868:	6b d2 1c             	imul   $0x1c,%edx,%edx
+f010286b:	03 15 60 a0 85 f0    	add    0xf085a060,%edx
+		if (pp->pp_ref != 1 || !(pc = pp->pp_refs_chain) || pc->pc_link ||
+f0102871:	66 83 7a 0a 01       	cmpw   $0x1,0xa(%edx)
+f0102876:	75 d3                	jne    f010284b <page_reclaim+0x13c>
+f0102878:	8b 42 18             	mov    0x18(%edx),%eax
+f010287b:	85 c0                	test   %eax,%eax
+f010287d:	74 cc                	je     f010284b <page_reclaim+0x13c>
+f010287f:	83 38 00             	cmpl   $0x0,(%eax)
+f0102882:	75 c7                	jne    f010284b <page_reclaim+0x13c>
+f0102884:	66 83 7a 0c 00       	cmpw   $0x0,0xc(%edx)
+f0102889:	75 c0                	jne    f010284b <page_reclaim+0x13c>
+		    pp->pp_futex_waiters || pp->age >= PAGE_AGE_COLD ||
+f010288b:	0f b6 5a 0e          	movzbl 0xe(%edx),%ebx
+f010288f:	88 5d df             	mov    %bl,-0x21(%ebp)
+f0102892:	80 fb fb             	cmp    $0xfb,%bl
+f0102895:	77 b4                	ja     f010284b <page_reclaim+0x13c>
+f0102897:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f010289a:	85 ff                	test   %edi,%edi
+f010289c:	74 05                	je     f01028a3 <page_reclaim+0x194>
+		    (victim && pp->age >= victim->age))
+f010289e:	3a 5f 0e             	cmp    0xe(%edi),%bl
+f01028a1:	73 a8                	jae    f010284b <page_reclaim+0x13c>
+		if ((*pc->pc_pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U) ||
+f01028a3:	8b 78 04             	mov    0x4(%eax),%edi
+f01028a6:	89 7d c8             	mov    %edi,-0x38(%ebp)
+f01028a9:	8b 1f                	mov    (%edi),%ebx
+f01028ab:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+f01028ae:	81 e3 05 0e 00 00    	and    $0xe05,%ebx
+f01028b4:	83 fb 05             	cmp    $0x5,%ebx
+f01028b7:	75 92                	jne    f010284b <page_reclaim+0x13c>
+		    pc->pc_env_va >= USTACKTOP - PGSIZE ||
+f01028b9:	8b 78 0c             	mov    0xc(%eax),%edi
+f01028bc:	89 7d d0             	mov    %edi,-0x30(%ebp)
+		    (*pc->pc_pte & (PTE_SHARE|PTE_NO_PAGE|PTE_COW)) ||
+f01028bf:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+f01028c5:	77 84                	ja     f010284b <page_reclaim+0x13c>
+		    (pc->pc_pgdir[PDX(pc->pc_env_va)] & PTE_PS) ||
+f01028c7:	8b 58 08             	mov    0x8(%eax),%ebx
+f01028ca:	89 f8                	mov    %edi,%eax
+f01028cc:	c1 e8 16             	shr    $0x16,%eax
+		    pc->pc_env_va >= USTACKTOP - PGSIZE ||
+f01028cf:	f6 04 83 80          	testb  $0x80,(%ebx,%eax,4)
+f01028d3:	0f 85 72 ff ff ff    	jne    f010284b <page_reclaim+0x13c>
+	for (i = 0; i < reclaim_nenvs && reclaim_envs[i].pgdir != pgdir; i++)
+f01028d9:	8b 3d 4c 72 85 f0    	mov    0xf085724c,%edi
+f01028df:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+f01028e2:	b8 00 00 00 00       	mov    $0x0,%eax
+f01028e7:	e9 d6 fe ff ff       	jmp    f01027c2 <page_reclaim+0xb3>
+			*pc->pc_pte &= ~PTE_A;
+f01028ec:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f01028ef:	83 e0 df             	and    $0xffffffdf,%eax
+f01028f2:	8b 7d c8             	mov    -0x38(%ebp),%edi
+f01028f5:	89 07                	mov    %eax,(%edi)
+			pp->age = MIN(pp->age + PAGE_AGE_INCREMENT_ON_ACCESS, MAX_PAGE_AGE);
+f01028f7:	0f b6 42 0e          	movzbl 0xe(%edx),%eax
+f01028fb:	83 c0 64             	add    $0x64,%eax
+f01028fe:	b9 fe 00 00 00       	mov    $0xfe,%ecx
+f0102903:	39 c8                	cmp    %ecx,%eax
+f0102905:	0f 4f c1             	cmovg  %ecx,%eax
+f0102908:	88 42 0e             	mov    %al,0xe(%edx)
+			continue;
+f010290b:	e9 3b ff ff ff       	jmp    f010284b <page_reclaim+0x13c>
+	if (!victim)
+f0102910:	89 ce                	mov    %ecx,%esi
+f0102912:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f0102916:	0f 84 9a 00 00 00    	je     f01029b6 <page_reclaim+0x2a7>
+	hand = (victim - pages + 1) % npages;
+f010291c:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f010291f:	89 f8                	mov    %edi,%eax
+f0102921:	2b 05 60 a0 85 f0    	sub    0xf085a060,%eax
+f0102927:	c1 f8 02             	sar    $0x2,%eax
+f010292a:	69 c0 b7 6d db b6    	imul   $0xb6db6db7,%eax,%eax
+f0102930:	83 c0 01             	add    $0x1,%eax
+f0102933:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102938:	f7 f6                	div    %esi
+f010293a:	89 15 40 72 85 f0    	mov    %edx,0xf0857240
+	pte = victim->pp_refs_chain->pc_pte;
+f0102940:	8b 47 18             	mov    0x18(%edi),%eax
+f0102943:	8b 70 04             	mov    0x4(%eax),%esi
+	perm = *pte & (PTE_SYSCALL & ~PTE_P);
+f0102946:	8b 1e                	mov    (%esi),%ebx
+f0102948:	81 e3 06 0e 00 00    	and    $0xe06,%ebx
+	if (page_insert(pager->env_pgdir, victim, va, PTE_P|PTE_U, &pager->env_npages) < 0)
+f010294e:	83 ec 0c             	sub    $0xc,%esp
+f0102951:	8b 45 08             	mov    0x8(%ebp),%eax
+f0102954:	83 c0 64             	add    $0x64,%eax
+f0102957:	50                   	push   %eax
+f0102958:	6a 05                	push   $0x5
+f010295a:	ff 75 0c             	push   0xc(%ebp)
+f010295d:	57                   	push   %edi
+f010295e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0102961:	ff 70 60             	push   0x60(%eax)
+f0102964:	e8 0f fd ff ff       	call   f0102678 <page_insert>
+f0102969:	83 c4 20             	add    $0x20,%esp
+f010296c:	85 c0                	test   %eax,%eax
+f010296e:	78 4d                	js     f01029bd <page_reclaim+0x2ae>
+	page_remove(owner->env_pgdir, (void *) owner_va, &owner->env_npages);
+f0102970:	83 ec 04             	sub    $0x4,%esp
+f0102973:	8b 7d d8             	mov    -0x28(%ebp),%edi
+f0102976:	8d 47 64             	lea    0x64(%edi),%eax
+f0102979:	50                   	push   %eax
+f010297a:	ff 75 d4             	push   -0x2c(%ebp)
+f010297d:	ff 77 60             	push   0x60(%edi)
+f0102980:	e8 89 fc ff ff       	call   f010260e <page_remove>
+	*pte = (slot << PTXSHIFT) | perm | PTE_SWAPPED;
+f0102985:	8b 45 10             	mov    0x10(%ebp),%eax
+f0102988:	c1 e0 0c             	shl    $0xc,%eax
+f010298b:	09 d8                	or     %ebx,%eax
+f010298d:	0c 80                	or     $0x80,%al
+f010298f:	89 06                	mov    %eax,(%esi)
+	owner->env_rss_reclaimed++;
+f0102991:	83 47 70 01          	addl   $0x1,0x70(%edi)
+	return owner->env_id;
+f0102995:	8b 47 48             	mov    0x48(%edi),%eax
+f0102998:	83 c4 10             	add    $0x10,%esp
+}
+f010299b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010299e:	5b                   	pop    %ebx
+f010299f:	5e                   	pop    %esi
+f01029a0:	5f                   	pop    %edi
+f01029a1:	5d                   	pop    %ebp
+f01029a2:	c3                   	ret
+		    pc->pc_env_va >= USTACKTOP - PGSIZE ||
+f01029a3:	89 ce                	mov    %ecx,%esi
+f01029a5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01029a8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	return reclaim_envs[i].env;
+f01029ab:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+		pp = &pages[(hand + n) % npages];
+f01029ae:	89 55 e0             	mov    %edx,-0x20(%ebp)
+f01029b1:	e9 66 ff ff ff       	jmp    f010291c <page_reclaim+0x20d>
+		return -E_NO_MEM;
+f01029b6:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f01029bb:	eb de                	jmp    f010299b <page_reclaim+0x28c>
+		return -E_NO_MEM;
+f01029bd:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f01029c2:	eb d7                	jmp    f010299b <page_reclaim+0x28c>
+		    !(e->env_status == ENV_RUNNABLE ||
+f01029c4:	8b 43 54             	mov    0x54(%ebx),%eax
+		    env_on_cpu(e) ||
+f01029c7:	83 f8 02             	cmp    $0x2,%eax
+f01029ca:	74 13                	je     f01029df <page_reclaim+0x2d0>
+		    !(e->env_status == ENV_RUNNABLE ||
+f01029cc:	83 f8 04             	cmp    $0x4,%eax
+f01029cf:	0f 85 70 fd ff ff    	jne    f0102745 <page_reclaim+0x36>
+		      (e->env_status == ENV_NOT_RUNNABLE && e->env_ipc_recving)) ||
+f01029d5:	80 7b 78 00          	cmpb   $0x0,0x78(%ebx)
+f01029d9:	0f 84 66 fd ff ff    	je     f0102745 <page_reclaim+0x36>
+f01029df:	8b 43 68             	mov    0x68(%ebx),%eax
+f01029e2:	39 43 64             	cmp    %eax,0x64(%ebx)
+f01029e5:	0f 8e 5a fd ff ff    	jle    f0102745 <page_reclaim+0x36>
+		    !page_lookup(e->env_pgdir, (void *) UMAPDIR, NULL))
+f01029eb:	83 ec 04             	sub    $0x4,%esp
+f01029ee:	6a 00                	push   $0x0
+f01029f0:	68 00 b0 ad de       	push   $0xdeadb000
+f01029f5:	ff 73 60             	push   0x60(%ebx)
+f01029f8:	e8 b2 fb ff ff       	call   f01025af <page_lookup>
+		    e->env_npages <= e->env_rss_min ||
+f01029fd:	83 c4 10             	add    $0x10,%esp
+f0102a00:	85 c0                	test   %eax,%eax
+f0102a02:	0f 84 3d fd ff ff    	je     f0102745 <page_reclaim+0x36>
+		if (e->env_rss_max && e->env_npages > e->env_rss_max) {
+f0102a08:	8b 43 6c             	mov    0x6c(%ebx),%eax
+f0102a0b:	85 c0                	test   %eax,%eax
+f0102a0d:	0f 84 5e fd ff ff    	je     f0102771 <page_reclaim+0x62>
+f0102a13:	3b 43 64             	cmp    0x64(%ebx),%eax
+f0102a16:	0f 8d 55 fd ff ff    	jge    f0102771 <page_reclaim+0x62>
+			if (!over)
+f0102a1c:	89 f0                	mov    %esi,%eax
+f0102a1e:	84 c0                	test   %al,%al
+f0102a20:	0f 85 51 fd ff ff    	jne    f0102777 <page_reclaim+0x68>
+				reclaim_nenvs = 0;
+f0102a26:	c7 05 4c 72 85 f0 00 	movl   $0x0,0xf085724c
+f0102a2d:	00 00 00 
+			over = 1;
+f0102a30:	be 01 00 00 00       	mov    $0x1,%esi
+f0102a35:	e9 3d fd ff ff       	jmp    f0102777 <page_reclaim+0x68>
+
+f0102a3a <page_clean>:
+{
+f0102a3a:	55                   	push   %ebp
+f0102a3b:	89 e5                	mov    %esp,%ebp
+f0102a3d:	56                   	push   %esi
+f0102a3e:	53                   	push   %ebx
+f0102a3f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0102a42:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((pte = pgdir_walk(pgdir, va, 0)) && (*pte & PTE_D)) {
+f0102a45:	83 ec 04             	sub    $0x4,%esp
+f0102a48:	6a 00                	push   $0x0
+f0102a4a:	56                   	push   %esi
+f0102a4b:	53                   	push   %ebx
+f0102a4c:	e8 94 f2 ff ff       	call   f0101ce5 <pgdir_walk>
+f0102a51:	83 c4 10             	add    $0x10,%esp
+f0102a54:	85 c0                	test   %eax,%eax
+f0102a56:	74 07                	je     f0102a5f <page_clean+0x25>
+f0102a58:	8b 10                	mov    (%eax),%edx
+f0102a5a:	f6 c2 40             	test   $0x40,%dl
+f0102a5d:	75 07                	jne    f0102a66 <page_clean+0x2c>
+}
+f0102a5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0102a62:	5b                   	pop    %ebx
+f0102a63:	5e                   	pop    %esi
+f0102a64:	5d                   	pop    %ebp
+f0102a65:	c3                   	ret
+		*pte &= ~PTE_D;
+f0102a66:	83 e2 bf             	and    $0xffffffbf,%edx
+f0102a69:	89 10                	mov    %edx,(%eax)
+		tlb_invalidate(pgdir, va);
+f0102a6b:	83 ec 08             	sub    $0x8,%esp
+f0102a6e:	56                   	push   %esi
+f0102a6f:	53                   	push   %ebx
+f0102a70:	e8 25 f1 ff ff       	call   f0101b9a <tlb_invalidate>
+f0102a75:	83 c4 10             	add    $0x10,%esp
+}
+f0102a78:	eb e5                	jmp    f0102a5f <page_clean+0x25>
+
+f0102a7a <page_cow>:
+{
+f0102a7a:	55                   	push   %ebp
+f0102a7b:	89 e5                	mov    %esp,%ebp
+f0102a7d:	57                   	push   %edi
+f0102a7e:	56                   	push   %esi
+f0102a7f:	53                   	push   %ebx
+f0102a80:	83 ec 1c             	sub    $0x1c,%esp
+	va = ROUNDDOWN(va, PGSIZE);
+f0102a83:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0102a86:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((uintptr_t) va >= UTOP || !(pte = pgdir_walk(pgdir, va, 0)))
+f0102a8c:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+f0102a92:	0f 87 78 01 00 00    	ja     f0102c10 <page_cow+0x196>
+f0102a98:	83 ec 04             	sub    $0x4,%esp
+f0102a9b:	6a 00                	push   $0x0
+f0102a9d:	56                   	push   %esi
+f0102a9e:	ff 75 08             	push   0x8(%ebp)
+f0102aa1:	e8 3f f2 ff ff       	call   f0101ce5 <pgdir_walk>
+f0102aa6:	89 c7                	mov    %eax,%edi
+f0102aa8:	83 c4 10             	add    $0x10,%esp
+f0102aab:	85 c0                	test   %eax,%eax
+f0102aad:	0f 84 64 01 00 00    	je     f0102c17 <page_cow+0x19d>
+	if ((*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+f0102ab3:	8b 00                	mov    (%eax),%eax
+f0102ab5:	89 c2                	mov    %eax,%edx
+f0102ab7:	81 e2 05 08 00 00    	and    $0x805,%edx
+f0102abd:	81 fa 05 08 00 00    	cmp    $0x805,%edx
+f0102ac3:	0f 85 55 01 00 00    	jne    f0102c1e <page_cow+0x1a4>
+	pp = pa2page(PTE_ADDR(*pte));
+f0102ac9:	89 c2                	mov    %eax,%edx
+f0102acb:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	if (PGNUM(pa) >= npages)
+f0102ad1:	89 c3                	mov    %eax,%ebx
+f0102ad3:	c1 eb 0c             	shr    $0xc,%ebx
+f0102ad6:	3b 1d 54 a0 85 f0    	cmp    0xf085a054,%ebx
+f0102adc:	0f 83 dc 00 00 00    	jae    f0102bbe <page_cow+0x144>
+	return &pages[PGNUM(pa)];
+f0102ae2:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+f0102ae5:	03 1d 60 a0 85 f0    	add    0xf085a060,%ebx
+	perm = ((*pte & PTE_SYSCALL) & ~PTE_COW) | PTE_W;
+f0102aeb:	25 05 06 00 00       	and    $0x605,%eax
+f0102af0:	83 c8 02             	or     $0x2,%eax
+f0102af3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if (pp->pp_ref == 1) {
+f0102af6:	66 83 7b 0a 01       	cmpw   $0x1,0xa(%ebx)
+f0102afb:	0f 84 d1 00 00 00    	je     f0102bd2 <page_cow+0x158>
+	if (num_free_pages < SOFT_MIN_FREE_PAGES || !(copy = page_alloc(0)))
+f0102b01:	83 3d 5c a0 85 f0 33 	cmpl   $0x33,0xf085a05c
+f0102b08:	0f 86 17 01 00 00    	jbe    f0102c25 <page_cow+0x1ab>
+f0102b0e:	83 ec 0c             	sub    $0xc,%esp
+f0102b11:	6a 00                	push   $0x0
+f0102b13:	e8 d8 eb ff ff       	call   f01016f0 <page_alloc>
+f0102b18:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0102b1b:	83 c4 10             	add    $0x10,%esp
+f0102b1e:	85 c0                	test   %eax,%eax
+f0102b20:	0f 84 06 01 00 00    	je     f0102c2c <page_cow+0x1b2>
+	return (pp - pages) << PGSHIFT;
+f0102b26:	8b 15 60 a0 85 f0    	mov    0xf085a060,%edx
+f0102b2c:	29 d3                	sub    %edx,%ebx
+f0102b2e:	c1 fb 02             	sar    $0x2,%ebx
+f0102b31:	69 db b7 6d db b6    	imul   $0xb6db6db7,%ebx,%ebx
+f0102b37:	89 d8                	mov    %ebx,%eax
+f0102b39:	c1 e0 0c             	shl    $0xc,%eax
+	if (PGNUM(pa) >= npages)
+f0102b3c:	8b 0d 54 a0 85 f0    	mov    0xf085a054,%ecx
+f0102b42:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+f0102b48:	39 cb                	cmp    %ecx,%ebx
+f0102b4a:	0f 83 9c 00 00 00    	jae    f0102bec <page_cow+0x172>
+	return (void *)(pa + KERNBASE);
+f0102b50:	2d 00 00 00 10       	sub    $0x10000000,%eax
+	return (pp - pages) << PGSHIFT;
+f0102b55:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0102b58:	29 d3                	sub    %edx,%ebx
+f0102b5a:	c1 fb 02             	sar    $0x2,%ebx
+f0102b5d:	69 d3 b7 6d db b6    	imul   $0xb6db6db7,%ebx,%edx
+f0102b63:	89 d3                	mov    %edx,%ebx
+f0102b65:	c1 e3 0c             	shl    $0xc,%ebx
+	if (PGNUM(pa) >= npages)
+f0102b68:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f0102b6e:	39 ca                	cmp    %ecx,%edx
+f0102b70:	0f 83 88 00 00 00    	jae    f0102bfe <page_cow+0x184>
+	memcpy(page2kva(copy), page2kva(pp), PGSIZE);
+f0102b76:	83 ec 04             	sub    $0x4,%esp
+f0102b79:	68 00 10 00 00       	push   $0x1000
+f0102b7e:	50                   	push   %eax
+	return (void *)(pa + KERNBASE);
+f0102b7f:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+f0102b85:	53                   	push   %ebx
+f0102b86:	e8 9b 4c 00 00       	call   f0107826 <memcpy>
+	page_insert_pte(pgdir, pte, copy, va, perm, npages_store);
+f0102b8b:	83 c4 0c             	add    $0xc,%esp
+f0102b8e:	ff 75 10             	push   0x10(%ebp)
+f0102b91:	ff 75 e0             	push   -0x20(%ebp)
+f0102b94:	56                   	push   %esi
+f0102b95:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0102b98:	89 fa                	mov    %edi,%edx
+f0102b9a:	8b 45 08             	mov    0x8(%ebp),%eax
+f0102b9d:	e8 24 ee ff ff       	call   f01019c6 <page_insert_pte>
+	tlb_invalidate(pgdir, va);
+f0102ba2:	83 c4 08             	add    $0x8,%esp
+f0102ba5:	56                   	push   %esi
+f0102ba6:	ff 75 08             	push   0x8(%ebp)
+f0102ba9:	e8 ec ef ff ff       	call   f0101b9a <tlb_invalidate>
+	return 0;
+f0102bae:	83 c4 10             	add    $0x10,%esp
+f0102bb1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0102bb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102bb9:	5b                   	pop    %ebx
+f0102bba:	5e                   	pop    %esi
+f0102bbb:	5f                   	pop    %edi
+f0102bbc:	5d                   	pop    %ebp
+f0102bbd:	c3                   	ret
+		panic("pa2page called with invalid pa");
+f0102bbe:	83 ec 04             	sub    $0x4,%esp
+f0102bc1:	68 98 95 10 f0       	push   $0xf0109598
+f0102bc6:	6a 65                	push   $0x65
+f0102bc8:	68 87 94 10 f0       	push   $0xf0109487
+f0102bcd:	e8 6e d4 ff ff       	call   f0100040 <_panic>
+		*pte = PTE_ADDR(*pte) | perm;
+f0102bd2:	09 c2                	or     %eax,%edx
+f0102bd4:	89 17                	mov    %edx,(%edi)
+		tlb_invalidate(pgdir, va);
+f0102bd6:	83 ec 08             	sub    $0x8,%esp
+f0102bd9:	56                   	push   %esi
+f0102bda:	ff 75 08             	push   0x8(%ebp)
+f0102bdd:	e8 b8 ef ff ff       	call   f0101b9a <tlb_invalidate>
+		return 0;
+f0102be2:	83 c4 10             	add    $0x10,%esp
+f0102be5:	b8 00 00 00 00       	mov    $0x0,%eax
+f0102bea:	eb ca                	jmp    f0102bb6 <page_cow+0x13c>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0102bec:	50                   	push   %eax
+f0102bed:	68 e4 85 10 f0       	push   $0xf01085e4
+f0102bf2:	6a 6c                	push   $0x6c
+f0102bf4:	68 87 94 10 f0       	push   $0xf0109487
+f0102bf9:	e8 42 d4 ff ff       	call   f0100040 <_panic>
+f0102bfe:	53                   	push   %ebx
+f0102bff:	68 e4 85 10 f0       	push   $0xf01085e4
+f0102c04:	6a 6c                	push   $0x6c
+f0102c06:	68 87 94 10 f0       	push   $0xf0109487
+f0102c0b:	e8 30 d4 ff ff       	call   f0100040 <_panic>
+		return -E_INVAL;
+f0102c10:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0102c15:	eb 9f                	jmp    f0102bb6 <page_cow+0x13c>
+f0102c17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0102c1c:	eb 98                	jmp    f0102bb6 <page_cow+0x13c>
+		return -E_INVAL;
+f0102c1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0102c23:	eb 91                	jmp    f0102bb6 <page_cow+0x13c>
+		return -E_NO_MEM;
+f0102c25:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0102c2a:	eb 8a                	jmp    f0102bb6 <page_cow+0x13c>
+f0102c2c:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0102c31:	eb 83                	jmp    f0102bb6 <page_cow+0x13c>
+
+f0102c33 <page_alloc_range>:
+{
+f0102c33:	55                   	push   %ebp
+f0102c34:	89 e5                	mov    %esp,%ebp
+f0102c36:	57                   	push   %edi
+f0102c37:	56                   	push   %esi
+f0102c38:	53                   	push   %ebx
+f0102c39:	83 ec 1c             	sub    $0x1c,%esp
+f0102c3c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	pte_t *pte = NULL;
+f0102c3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	int flush = 0;
+f0102c44:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	for (i = 0; i < npages; i++, va += PGSIZE, pte++) {
+f0102c4b:	be 00 00 00 00       	mov    $0x0,%esi
+f0102c50:	eb 50                	jmp    f0102ca2 <page_alloc_range+0x6f>
+			if (!(pte = pgdir_walk(pgdir, va, 1)))
+f0102c52:	83 ec 04             	sub    $0x4,%esp
+f0102c55:	6a 01                	push   $0x1
+f0102c57:	57                   	push   %edi
+f0102c58:	ff 75 08             	push   0x8(%ebp)
+f0102c5b:	e8 85 f0 ff ff       	call   f0101ce5 <pgdir_walk>
+f0102c60:	89 c3                	mov    %eax,%ebx
+f0102c62:	83 c4 10             	add    $0x10,%esp
+f0102c65:	85 c0                	test   %eax,%eax
+f0102c67:	74 4f                	je     f0102cb8 <page_alloc_range+0x85>
+		if (!(pp = page_alloc(ALLOC_ZERO)))
+f0102c69:	83 ec 0c             	sub    $0xc,%esp
+f0102c6c:	6a 01                	push   $0x1
+f0102c6e:	e8 7d ea ff ff       	call   f01016f0 <page_alloc>
+f0102c73:	89 c1                	mov    %eax,%ecx
+f0102c75:	83 c4 10             	add    $0x10,%esp
+f0102c78:	85 c0                	test   %eax,%eax
+f0102c7a:	74 3c                	je     f0102cb8 <page_alloc_range+0x85>
+		flush |= page_insert_pte(pgdir, pte, pp, va, perm, npages_store);
+f0102c7c:	83 ec 04             	sub    $0x4,%esp
+f0102c7f:	ff 75 18             	push   0x18(%ebp)
+f0102c82:	ff 75 14             	push   0x14(%ebp)
+f0102c85:	57                   	push   %edi
+f0102c86:	89 da                	mov    %ebx,%edx
+f0102c88:	8b 45 08             	mov    0x8(%ebp),%eax
+f0102c8b:	e8 36 ed ff ff       	call   f01019c6 <page_insert_pte>
+f0102c90:	09 45 e4             	or     %eax,-0x1c(%ebp)
+	for (i = 0; i < npages; i++, va += PGSIZE, pte++) {
+f0102c93:	83 c6 01             	add    $0x1,%esi
+f0102c96:	81 c7 00 10 00 00    	add    $0x1000,%edi
+f0102c9c:	83 c3 04             	add    $0x4,%ebx
+f0102c9f:	83 c4 10             	add    $0x10,%esp
+f0102ca2:	3b 75 10             	cmp    0x10(%ebp),%esi
+f0102ca5:	74 0e                	je     f0102cb5 <page_alloc_range+0x82>
+		if (i == 0 || PTX(va) == 0)
+f0102ca7:	85 f6                	test   %esi,%esi
+f0102ca9:	74 a7                	je     f0102c52 <page_alloc_range+0x1f>
+f0102cab:	f7 c7 00 f0 3f 00    	test   $0x3ff000,%edi
+f0102cb1:	75 b6                	jne    f0102c69 <page_alloc_range+0x36>
+f0102cb3:	eb 9d                	jmp    f0102c52 <page_alloc_range+0x1f>
+f0102cb5:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (flush)
+f0102cb8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f0102cbc:	75 12                	jne    f0102cd0 <page_alloc_range+0x9d>
+	return i ? (int)i : -E_NO_MEM;
+f0102cbe:	85 f6                	test   %esi,%esi
+f0102cc0:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0102cc5:	0f 45 c6             	cmovne %esi,%eax
+}
+f0102cc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102ccb:	5b                   	pop    %ebx
+f0102ccc:	5e                   	pop    %esi
+f0102ccd:	5f                   	pop    %edi
+f0102cce:	5d                   	pop    %ebp
+f0102ccf:	c3                   	ret
+		tlb_flush(pgdir);
+f0102cd0:	83 ec 0c             	sub    $0xc,%esp
+f0102cd3:	ff 75 08             	push   0x8(%ebp)
+f0102cd6:	e8 f4 ee ff ff       	call   f0101bcf <tlb_flush>
+f0102cdb:	83 c4 10             	add    $0x10,%esp
+f0102cde:	eb de                	jmp    f0102cbe <page_alloc_range+0x8b>
+
+f0102ce0 <page_map_range>:
+{
+f0102ce0:	55                   	push   %ebp
+f0102ce1:	89 e5                	mov    %esp,%ebp
+f0102ce3:	57                   	push   %edi
+f0102ce4:	56                   	push   %esi
+f0102ce5:	53                   	push   %ebx
+f0102ce6:	83 ec 2c             	sub    $0x2c,%esp
+	for (i = 0, va = srcva; i < npages; i++, va += PGSIZE, srcpte++) {
+f0102ce9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	pte_t *srcpte = NULL, *dstpte = NULL, dirty;
+f0102cec:	bb 00 00 00 00       	mov    $0x0,%ebx
+	for (i = 0, va = srcva; i < npages; i++, va += PGSIZE, srcpte++) {
+f0102cf1:	be 00 00 00 00       	mov    $0x0,%esi
+		if (!(*srcpte & PTE_P) || ((perm & PTE_W) && !(*srcpte & PTE_W)))
+f0102cf6:	8b 45 1c             	mov    0x1c(%ebp),%eax
+f0102cf9:	83 e0 02             	and    $0x2,%eax
+f0102cfc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0102cff:	89 d8                	mov    %ebx,%eax
+f0102d01:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	for (i = 0, va = srcva; i < npages; i++, va += PGSIZE, srcpte++) {
+f0102d04:	eb 3f                	jmp    f0102d45 <page_map_range+0x65>
+			if (!(srcpte = pgdir_walk(srcpgdir, va, 0)))
+f0102d06:	83 ec 04             	sub    $0x4,%esp
+f0102d09:	6a 00                	push   $0x0
+f0102d0b:	57                   	push   %edi
+f0102d0c:	ff 75 08             	push   0x8(%ebp)
+f0102d0f:	e8 d1 ef ff ff       	call   f0101ce5 <pgdir_walk>
+f0102d14:	83 c4 10             	add    $0x10,%esp
+f0102d17:	85 c0                	test   %eax,%eax
+f0102d19:	0f 84 0b 01 00 00    	je     f0102e2a <page_map_range+0x14a>
+		if (!(*srcpte & PTE_P) || ((perm & PTE_W) && !(*srcpte & PTE_W)))
+f0102d1f:	8b 10                	mov    (%eax),%edx
+f0102d21:	f6 c2 01             	test   $0x1,%dl
+f0102d24:	0f 84 07 01 00 00    	je     f0102e31 <page_map_range+0x151>
+f0102d2a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f0102d2e:	74 09                	je     f0102d39 <page_map_range+0x59>
+f0102d30:	f6 c2 02             	test   $0x2,%dl
+f0102d33:	0f 84 07 01 00 00    	je     f0102e40 <page_map_range+0x160>
+	for (i = 0, va = srcva; i < npages; i++, va += PGSIZE, srcpte++) {
+f0102d39:	83 c6 01             	add    $0x1,%esi
+f0102d3c:	81 c7 00 10 00 00    	add    $0x1000,%edi
+f0102d42:	83 c0 04             	add    $0x4,%eax
+f0102d45:	39 de                	cmp    %ebx,%esi
+f0102d47:	74 0e                	je     f0102d57 <page_map_range+0x77>
+		if (i == 0 || PTX(va) == 0)
+f0102d49:	85 f6                	test   %esi,%esi
+f0102d4b:	74 b9                	je     f0102d06 <page_map_range+0x26>
+f0102d4d:	f7 c7 00 f0 3f 00    	test   $0x3ff000,%edi
+f0102d53:	75 ca                	jne    f0102d1f <page_map_range+0x3f>
+f0102d55:	eb af                	jmp    f0102d06 <page_map_range+0x26>
+	bool same = (srcpgdir == dstpgdir && srcva == dstva);
+f0102d57:	89 c3                	mov    %eax,%ebx
+f0102d59:	8b 45 10             	mov    0x10(%ebp),%eax
+f0102d5c:	39 45 08             	cmp    %eax,0x8(%ebp)
+f0102d5f:	0f 94 c2             	sete   %dl
+f0102d62:	8b 45 14             	mov    0x14(%ebp),%eax
+f0102d65:	39 45 0c             	cmp    %eax,0xc(%ebp)
+f0102d68:	0f 94 c0             	sete   %al
+f0102d6b:	21 c2                	and    %eax,%edx
+f0102d6d:	88 55 df             	mov    %dl,-0x21(%ebp)
+	pte_t *srcpte = NULL, *dstpte = NULL, dirty;
+f0102d70:	be 00 00 00 00       	mov    $0x0,%esi
+	int flush = 0;
+f0102d75:	ba 00 00 00 00       	mov    $0x0,%edx
+	for (i = 0; i < npages; i++, srcva += PGSIZE, dstva += PGSIZE, srcpte++, dstpte++) {
+f0102d7a:	bf 00 00 00 00       	mov    $0x0,%edi
+		if ((perm & PTE_W) && !same)
+f0102d7f:	8b 45 1c             	mov    0x1c(%ebp),%eax
+f0102d82:	83 e0 02             	and    $0x2,%eax
+f0102d85:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0102d88:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f0102d8b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+f0102d8e:	8b 7d 14             	mov    0x14(%ebp),%edi
+f0102d91:	e9 61 01 00 00       	jmp    f0102ef7 <page_map_range+0x217>
+				if (flush)
+f0102d96:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0102d99:	85 d2                	test   %edx,%edx
+f0102d9b:	75 0a                	jne    f0102da7 <page_map_range+0xc7>
+				return -E_NO_MEM;
+f0102d9d:	ba fc ff ff ff       	mov    $0xfffffffc,%edx
+f0102da2:	e9 8f 00 00 00       	jmp    f0102e36 <page_map_range+0x156>
+					tlb_flush(dstpgdir);
+f0102da7:	83 ec 0c             	sub    $0xc,%esp
+f0102daa:	ff 75 10             	push   0x10(%ebp)
+f0102dad:	e8 1d ee ff ff       	call   f0101bcf <tlb_flush>
+f0102db2:	83 c4 10             	add    $0x10,%esp
+				return -E_NO_MEM;
+f0102db5:	ba fc ff ff ff       	mov    $0xfffffffc,%edx
+f0102dba:	eb 7a                	jmp    f0102e36 <page_map_range+0x156>
+		if ((perm & PTE_W) && !same)
+f0102dbc:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+f0102dc0:	74 03                	je     f0102dc5 <page_map_range+0xe5>
+			*srcpte |= PTE_D;
+f0102dc2:	83 0b 40             	orl    $0x40,(%ebx)
+	if (PGNUM(pa) >= npages)
+f0102dc5:	8b 0b                	mov    (%ebx),%ecx
+f0102dc7:	c1 e9 0c             	shr    $0xc,%ecx
+f0102dca:	3b 0d 54 a0 85 f0    	cmp    0xf085a054,%ecx
+f0102dd0:	73 28                	jae    f0102dfa <page_map_range+0x11a>
+	return &pages[PGNUM(pa)];
+f0102dd2:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+f0102dd5:	03 0d 60 a0 85 f0    	add    0xf085a060,%ecx
+		flush |= page_insert_pte(dstpgdir, dstpte, pa2page(PTE_ADDR(*srcpte)), dstva, perm, npages_store);
+f0102ddb:	83 ec 04             	sub    $0x4,%esp
+f0102dde:	ff 75 20             	push   0x20(%ebp)
+f0102de1:	ff 75 1c             	push   0x1c(%ebp)
+f0102de4:	57                   	push   %edi
+f0102de5:	89 f2                	mov    %esi,%edx
+f0102de7:	8b 45 10             	mov    0x10(%ebp),%eax
+f0102dea:	e8 d7 eb ff ff       	call   f01019c6 <page_insert_pte>
+f0102def:	09 45 e0             	or     %eax,-0x20(%ebp)
+f0102df2:	83 c4 10             	add    $0x10,%esp
+f0102df5:	e9 e6 00 00 00       	jmp    f0102ee0 <page_map_range+0x200>
+		panic("pa2page called with invalid pa");
+f0102dfa:	83 ec 04             	sub    $0x4,%esp
+f0102dfd:	68 98 95 10 f0       	push   $0xf0109598
+f0102e02:	6a 65                	push   $0x65
+f0102e04:	68 87 94 10 f0       	push   $0xf0109487
+f0102e09:	e8 32 d2 ff ff       	call   f0100040 <_panic>
+	if (flush)
+f0102e0e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0102e11:	85 d2                	test   %edx,%edx
+f0102e13:	74 21                	je     f0102e36 <page_map_range+0x156>
+		tlb_flush(dstpgdir);
+f0102e15:	83 ec 0c             	sub    $0xc,%esp
+f0102e18:	ff 75 10             	push   0x10(%ebp)
+f0102e1b:	e8 af ed ff ff       	call   f0101bcf <tlb_flush>
+f0102e20:	83 c4 10             	add    $0x10,%esp
+	return 0;
+f0102e23:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102e28:	eb 0c                	jmp    f0102e36 <page_map_range+0x156>
+				return -E_INVAL;
+f0102e2a:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+f0102e2f:	eb 05                	jmp    f0102e36 <page_map_range+0x156>
+			return -E_INVAL;
+f0102e31:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+}
+f0102e36:	89 d0                	mov    %edx,%eax
+f0102e38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102e3b:	5b                   	pop    %ebx
+f0102e3c:	5e                   	pop    %esi
+f0102e3d:	5f                   	pop    %edi
+f0102e3e:	5d                   	pop    %ebp
+f0102e3f:	c3                   	ret
+			return -E_INVAL;
+f0102e40:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+f0102e45:	eb ef                	jmp    f0102e36 <page_map_range+0x156>
+			srcpte = pgdir_walk(srcpgdir, srcva, 0);
+f0102e47:	83 ec 04             	sub    $0x4,%esp
+f0102e4a:	6a 00                	push   $0x0
+f0102e4c:	ff 75 0c             	push   0xc(%ebp)
+f0102e4f:	ff 75 08             	push   0x8(%ebp)
+f0102e52:	e8 8e ee ff ff       	call   f0101ce5 <pgdir_walk>
+f0102e57:	89 c3                	mov    %eax,%ebx
+f0102e59:	83 c4 10             	add    $0x10,%esp
+f0102e5c:	e9 b9 00 00 00       	jmp    f0102f1a <page_map_range+0x23a>
+f0102e61:	83 ec 04             	sub    $0x4,%esp
+f0102e64:	6a 00                	push   $0x0
+f0102e66:	ff 75 0c             	push   0xc(%ebp)
+f0102e69:	ff 75 08             	push   0x8(%ebp)
+f0102e6c:	e8 74 ee ff ff       	call   f0101ce5 <pgdir_walk>
+f0102e71:	89 c3                	mov    %eax,%ebx
+f0102e73:	83 c4 10             	add    $0x10,%esp
+			if (!(dstpte = pgdir_walk(dstpgdir, dstva, 1))) {
+f0102e76:	83 ec 04             	sub    $0x4,%esp
+f0102e79:	6a 01                	push   $0x1
+f0102e7b:	57                   	push   %edi
+f0102e7c:	ff 75 10             	push   0x10(%ebp)
+f0102e7f:	e8 61 ee ff ff       	call   f0101ce5 <pgdir_walk>
+f0102e84:	89 c6                	mov    %eax,%esi
+f0102e86:	83 c4 10             	add    $0x10,%esp
+f0102e89:	85 c0                	test   %eax,%eax
+f0102e8b:	0f 84 05 ff ff ff    	je     f0102d96 <page_map_range+0xb6>
+		dirty = same ? (*srcpte & PTE_D) : PTE_D;
+f0102e91:	80 7d df 00          	cmpb   $0x0,-0x21(%ebp)
+f0102e95:	0f 84 21 ff ff ff    	je     f0102dbc <page_map_range+0xdc>
+f0102e9b:	8b 0b                	mov    (%ebx),%ecx
+f0102e9d:	89 c8                	mov    %ecx,%eax
+f0102e9f:	83 e0 40             	and    $0x40,%eax
+f0102ea2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	if (PGNUM(pa) >= npages)
+f0102ea5:	c1 e9 0c             	shr    $0xc,%ecx
+f0102ea8:	3b 0d 54 a0 85 f0    	cmp    0xf085a054,%ecx
+f0102eae:	0f 83 46 ff ff ff    	jae    f0102dfa <page_map_range+0x11a>
+	return &pages[PGNUM(pa)];
+f0102eb4:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+f0102eb7:	03 0d 60 a0 85 f0    	add    0xf085a060,%ecx
+		flush |= page_insert_pte(dstpgdir, dstpte, pa2page(PTE_ADDR(*srcpte)), dstva, perm, npages_store);
+f0102ebd:	83 ec 04             	sub    $0x4,%esp
+f0102ec0:	ff 75 20             	push   0x20(%ebp)
+f0102ec3:	ff 75 1c             	push   0x1c(%ebp)
+f0102ec6:	57                   	push   %edi
+f0102ec7:	89 f2                	mov    %esi,%edx
+f0102ec9:	8b 45 10             	mov    0x10(%ebp),%eax
+f0102ecc:	e8 f5 ea ff ff       	call   f01019c6 <page_insert_pte>
+f0102ed1:	09 45 e0             	or     %eax,-0x20(%ebp)
+		if (!dirty)
+f0102ed4:	83 c4 10             	add    $0x10,%esp
+f0102ed7:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+f0102edb:	75 03                	jne    f0102ee0 <page_map_range+0x200>
+			*dstpte &= ~PTE_D;
+f0102edd:	83 26 bf             	andl   $0xffffffbf,(%esi)
+	for (i = 0; i < npages; i++, srcva += PGSIZE, dstva += PGSIZE, srcpte++, dstpte++) {
+f0102ee0:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+f0102ee4:	81 45 0c 00 10 00 00 	addl   $0x1000,0xc(%ebp)
+f0102eeb:	81 c7 00 10 00 00    	add    $0x1000,%edi
+f0102ef1:	83 c3 04             	add    $0x4,%ebx
+f0102ef4:	83 c6 04             	add    $0x4,%esi
+f0102ef7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0102efa:	3b 45 18             	cmp    0x18(%ebp),%eax
+f0102efd:	0f 84 0b ff ff ff    	je     f0102e0e <page_map_range+0x12e>
+		if (i == 0 || PTX(srcva) == 0)
+f0102f03:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f0102f07:	0f 84 54 ff ff ff    	je     f0102e61 <page_map_range+0x181>
+f0102f0d:	f7 45 0c 00 f0 3f 00 	testl  $0x3ff000,0xc(%ebp)
+f0102f14:	0f 84 2d ff ff ff    	je     f0102e47 <page_map_range+0x167>
+		if (i == 0 || PTX(dstva) == 0)
+f0102f1a:	f7 c7 00 f0 3f 00    	test   $0x3ff000,%edi
+f0102f20:	0f 85 6b ff ff ff    	jne    f0102e91 <page_map_range+0x1b1>
+f0102f26:	e9 4b ff ff ff       	jmp    f0102e76 <page_map_range+0x196>
+
+f0102f2b <page_remove_range>:
+{
+f0102f2b:	55                   	push   %ebp
+f0102f2c:	89 e5                	mov    %esp,%ebp
+f0102f2e:	57                   	push   %edi
+f0102f2f:	56                   	push   %esi
+f0102f30:	53                   	push   %ebx
+f0102f31:	83 ec 1c             	sub    $0x1c,%esp
+f0102f34:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	pte_t *pte = NULL;
+f0102f37:	bb 00 00 00 00       	mov    $0x0,%ebx
+	int flush = 0;
+f0102f3c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	for (i = 0; i < npages; i++, va += PGSIZE, pte++) {
+f0102f43:	be 00 00 00 00       	mov    $0x0,%esi
+f0102f48:	eb 4d                	jmp    f0102f97 <page_remove_range+0x6c>
+				i += NPTENTRIES - PTX(va) - 1;
+f0102f4a:	89 f8                	mov    %edi,%eax
+f0102f4c:	c1 e8 0c             	shr    $0xc,%eax
+f0102f4f:	f7 d0                	not    %eax
+f0102f51:	25 ff 03 00 00       	and    $0x3ff,%eax
+f0102f56:	01 c6                	add    %eax,%esi
+				va = ROUNDDOWN(va, PTSIZE) + PTSIZE - PGSIZE;
+f0102f58:	81 e7 00 00 c0 ff    	and    $0xffc00000,%edi
+f0102f5e:	81 c7 00 f0 3f 00    	add    $0x3ff000,%edi
+				continue;
+f0102f64:	eb 25                	jmp    f0102f8b <page_remove_range+0x60>
+	if (PGNUM(pa) >= npages)
+f0102f66:	c1 e8 0c             	shr    $0xc,%eax
+f0102f69:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f0102f6f:	73 61                	jae    f0102fd2 <page_remove_range+0xa7>
+	return &pages[PGNUM(pa)];
+f0102f71:	6b c0 1c             	imul   $0x1c,%eax,%eax
+f0102f74:	03 05 60 a0 85 f0    	add    0xf085a060,%eax
+			page_remove_pte(pa2page(PTE_ADDR(*pte)), pte, npages_store);
+f0102f7a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f0102f7d:	89 da                	mov    %ebx,%edx
+f0102f7f:	e8 bc e9 ff ff       	call   f0101940 <page_remove_pte>
+			flush = 1;
+f0102f84:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+	for (i = 0; i < npages; i++, va += PGSIZE, pte++) {
+f0102f8b:	83 c6 01             	add    $0x1,%esi
+f0102f8e:	81 c7 00 10 00 00    	add    $0x1000,%edi
+f0102f94:	83 c3 04             	add    $0x4,%ebx
+f0102f97:	3b 75 10             	cmp    0x10(%ebp),%esi
+f0102f9a:	73 4a                	jae    f0102fe6 <page_remove_range+0xbb>
+		if (i == 0 || PTX(va) == 0) {
+f0102f9c:	85 f6                	test   %esi,%esi
+f0102f9e:	74 08                	je     f0102fa8 <page_remove_range+0x7d>
+f0102fa0:	f7 c7 00 f0 3f 00    	test   $0x3ff000,%edi
+f0102fa6:	75 17                	jne    f0102fbf <page_remove_range+0x94>
+			if (!(pte = pgdir_walk(pgdir, va, 0))) {
+f0102fa8:	83 ec 04             	sub    $0x4,%esp
+f0102fab:	6a 00                	push   $0x0
+f0102fad:	57                   	push   %edi
+f0102fae:	ff 75 08             	push   0x8(%ebp)
+f0102fb1:	e8 2f ed ff ff       	call   f0101ce5 <pgdir_walk>
+f0102fb6:	89 c3                	mov    %eax,%ebx
+f0102fb8:	83 c4 10             	add    $0x10,%esp
+f0102fbb:	85 c0                	test   %eax,%eax
+f0102fbd:	74 8b                	je     f0102f4a <page_remove_range+0x1f>
+		if (*pte & PTE_P) {
+f0102fbf:	8b 03                	mov    (%ebx),%eax
+f0102fc1:	a8 01                	test   $0x1,%al
+f0102fc3:	75 a1                	jne    f0102f66 <page_remove_range+0x3b>
+		} else if (*pte & PTE_SWAPPED)
+f0102fc5:	a8 80                	test   $0x80,%al
+f0102fc7:	74 c2                	je     f0102f8b <page_remove_range+0x60>
+			*pte &= PTE_AVAIL;
+f0102fc9:	25 00 0e 00 00       	and    $0xe00,%eax
+f0102fce:	89 03                	mov    %eax,(%ebx)
+f0102fd0:	eb b9                	jmp    f0102f8b <page_remove_range+0x60>
+		panic("pa2page called with invalid pa");
+f0102fd2:	83 ec 04             	sub    $0x4,%esp
+f0102fd5:	68 98 95 10 f0       	push   $0xf0109598
+f0102fda:	6a 65                	push   $0x65
+f0102fdc:	68 87 94 10 f0       	push   $0xf0109487
+f0102fe1:	e8 5a d0 ff ff       	call   f0100040 <_panic>
+	if (flush)
+f0102fe6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f0102fea:	75 08                	jne    f0102ff4 <page_remove_range+0xc9>
+}
+f0102fec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102fef:	5b                   	pop    %ebx
+f0102ff0:	5e                   	pop    %esi
+f0102ff1:	5f                   	pop    %edi
+f0102ff2:	5d                   	pop    %ebp
+f0102ff3:	c3                   	ret
+		tlb_flush(pgdir);
+f0102ff4:	83 ec 0c             	sub    $0xc,%esp
+f0102ff7:	ff 75 08             	push   0x8(%ebp)
+f0102ffa:	e8 d0 eb ff ff       	call   f0101bcf <tlb_flush>
+f0102fff:	83 c4 10             	add    $0x10,%esp
+}
+f0103002:	eb e8                	jmp    f0102fec <page_remove_range+0xc1>
+
+f0103004 <page_fork>:
+{
+f0103004:	55                   	push   %ebp
+f0103005:	89 e5                	mov    %esp,%ebp
+f0103007:	57                   	push   %edi
+f0103008:	56                   	push   %esi
+f0103009:	53                   	push   %ebx
+f010300a:	83 ec 2c             	sub    $0x2c,%esp
+	uint32_t dstpdx = NPDENTRIES;
+f010300d:	c7 45 dc 00 04 00 00 	movl   $0x400,-0x24(%ebp)
+	int perm, flush = 0, r = 0;
+f0103014:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+	pte_t *srcpte, *dstpt = NULL;
+f010301b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	for (va = 0; va < limit; va += PGSIZE) {
+f0103022:	bf 00 00 00 00       	mov    $0x0,%edi
+f0103027:	eb 12                	jmp    f010303b <page_fork+0x37>
+			va = ROUNDDOWN(va, PTSIZE) + PTSIZE - PGSIZE;
+f0103029:	81 e7 00 00 c0 ff    	and    $0xffc00000,%edi
+f010302f:	81 c7 00 f0 3f 00    	add    $0x3ff000,%edi
+	for (va = 0; va < limit; va += PGSIZE) {
+f0103035:	81 c7 00 10 00 00    	add    $0x1000,%edi
+f010303b:	3b 7d 10             	cmp    0x10(%ebp),%edi
+f010303e:	0f 83 11 02 00 00    	jae    f0103255 <page_fork+0x251>
+		if ((srcpgdir[PDX(va)] & (PTE_P|PTE_U)) != (PTE_P|PTE_U)) {
+f0103044:	89 fb                	mov    %edi,%ebx
+f0103046:	c1 eb 16             	shr    $0x16,%ebx
+f0103049:	8b 45 08             	mov    0x8(%ebp),%eax
+f010304c:	8d 34 98             	lea    (%eax,%ebx,4),%esi
+f010304f:	8b 06                	mov    (%esi),%eax
+f0103051:	89 c2                	mov    %eax,%edx
+f0103053:	83 e2 05             	and    $0x5,%edx
+f0103056:	83 fa 05             	cmp    $0x5,%edx
+f0103059:	75 ce                	jne    f0103029 <page_fork+0x25>
+		if (srcpgdir[PDX(va)] & PTE_PS)
+f010305b:	a8 80                	test   $0x80,%al
+f010305d:	75 67                	jne    f01030c6 <page_fork+0xc2>
+		srcpte = (pte_t *) KADDR(PTE_ADDR(srcpgdir[PDX(va)])) + PTX(va);
+f010305f:	8b 06                	mov    (%esi),%eax
+f0103061:	89 c2                	mov    %eax,%edx
+f0103063:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	if (PGNUM(pa) >= npages)
+f0103069:	c1 e8 0c             	shr    $0xc,%eax
+f010306c:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f0103072:	73 63                	jae    f01030d7 <page_fork+0xd3>
+f0103074:	89 fe                	mov    %edi,%esi
+f0103076:	c1 ee 0c             	shr    $0xc,%esi
+f0103079:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+f010307f:	8d 04 b5 00 00 00 00 	lea    0x0(,%esi,4),%eax
+f0103086:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0103089:	8d 84 02 00 00 00 f0 	lea    -0x10000000(%edx,%eax,1),%eax
+f0103090:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		if ((*srcpte & (PTE_P|PTE_U)) != (PTE_P|PTE_U) &&
+f0103093:	8b 00                	mov    (%eax),%eax
+f0103095:	89 c2                	mov    %eax,%edx
+f0103097:	83 e2 05             	and    $0x5,%edx
+f010309a:	83 fa 05             	cmp    $0x5,%edx
+f010309d:	74 0c                	je     f01030ab <page_fork+0xa7>
+		    (*srcpte & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+f010309f:	25 81 00 00 00       	and    $0x81,%eax
+		if ((*srcpte & (PTE_P|PTE_U)) != (PTE_P|PTE_U) &&
+f01030a4:	3d 80 00 00 00       	cmp    $0x80,%eax
+f01030a9:	75 8a                	jne    f0103035 <page_fork+0x31>
+		if (PDX(va) != dstpdx) {
+f01030ab:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f01030ae:	39 c3                	cmp    %eax,%ebx
+f01030b0:	75 3a                	jne    f01030ec <page_fork+0xe8>
+		if (!(*srcpte & PTE_P)) {
+f01030b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01030b5:	8b 00                	mov    (%eax),%eax
+f01030b7:	a8 01                	test   $0x1,%al
+f01030b9:	75 57                	jne    f0103112 <page_fork+0x10e>
+			dstpt[PTX(va)] = *srcpte;
+f01030bb:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f01030be:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+			continue;
+f01030c1:	e9 6f ff ff ff       	jmp    f0103035 <page_fork+0x31>
+			page_split(srcpgdir, (void *) va);
+f01030c6:	83 ec 08             	sub    $0x8,%esp
+f01030c9:	57                   	push   %edi
+f01030ca:	ff 75 08             	push   0x8(%ebp)
+f01030cd:	e8 32 eb ff ff       	call   f0101c04 <page_split>
+f01030d2:	83 c4 10             	add    $0x10,%esp
+f01030d5:	eb 88                	jmp    f010305f <page_fork+0x5b>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01030d7:	52                   	push   %edx
+f01030d8:	68 e4 85 10 f0       	push   $0xf01085e4
+f01030dd:	68 70 04 00 00       	push   $0x470
+f01030e2:	68 7b 94 10 f0       	push   $0xf010947b
+f01030e7:	e8 54 cf ff ff       	call   f0100040 <_panic>
+			if (!(dstpt = pgdir_walk(dstpgdir, (void *) va, 1))) {
+f01030ec:	83 ec 04             	sub    $0x4,%esp
+f01030ef:	6a 01                	push   $0x1
+f01030f1:	57                   	push   %edi
+f01030f2:	ff 75 0c             	push   0xc(%ebp)
+f01030f5:	e8 eb eb ff ff       	call   f0101ce5 <pgdir_walk>
+f01030fa:	83 c4 10             	add    $0x10,%esp
+f01030fd:	85 c0                	test   %eax,%eax
+f01030ff:	0f 84 65 01 00 00    	je     f010326a <page_fork+0x266>
+			dstpt -= PTX(va);
+f0103105:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0103108:	29 c8                	sub    %ecx,%eax
+f010310a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+			dstpdx = PDX(va);
+f010310d:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+f0103110:	eb a0                	jmp    f01030b2 <page_fork+0xae>
+	if (PGNUM(pa) >= npages)
+f0103112:	89 c2                	mov    %eax,%edx
+f0103114:	c1 ea 0c             	shr    $0xc,%edx
+f0103117:	3b 15 54 a0 85 f0    	cmp    0xf085a054,%edx
+f010311d:	73 7d                	jae    f010319c <page_fork+0x198>
+	return &pages[PGNUM(pa)];
+f010311f:	6b d2 1c             	imul   $0x1c,%edx,%edx
+f0103122:	89 d6                	mov    %edx,%esi
+f0103124:	03 35 60 a0 85 f0    	add    0xf085a060,%esi
+		perm = *srcpte & PTE_SYSCALL;
+f010312a:	89 c1                	mov    %eax,%ecx
+f010312c:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+f0103132:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+		if (*srcpte & PTE_SHARE) {
+f0103135:	f6 c4 04             	test   $0x4,%ah
+f0103138:	75 2d                	jne    f0103167 <page_fork+0x163>
+		} else if (*srcpte & PTE_NO_PAGE) {
+f010313a:	f6 c4 02             	test   $0x2,%ah
+f010313d:	75 71                	jne    f01031b0 <page_fork+0x1ac>
+		} else if (*srcpte & (PTE_W|PTE_COW)) {
+f010313f:	a9 02 08 00 00       	test   $0x802,%eax
+f0103144:	74 21                	je     f0103167 <page_fork+0x163>
+			perm = (perm & ~PTE_W) | PTE_COW;
+f0103146:	89 c2                	mov    %eax,%edx
+f0103148:	81 e2 05 06 00 00    	and    $0x605,%edx
+f010314e:	80 ce 08             	or     $0x8,%dh
+f0103151:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+			*srcpte = PTE_ADDR(*srcpte) | perm | (*srcpte & PTE_D);
+f0103154:	25 40 f0 ff ff       	and    $0xfffff040,%eax
+f0103159:	09 d0                	or     %edx,%eax
+f010315b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f010315e:	89 01                	mov    %eax,(%ecx)
+			flush = 1;
+f0103160:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+		page_insert_pte(dstpgdir, dstpt + PTX(va), pp, (void *) va, perm, npages_store);
+f0103167:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f010316a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f010316d:	01 c3                	add    %eax,%ebx
+f010316f:	83 ec 04             	sub    $0x4,%esp
+f0103172:	ff 75 14             	push   0x14(%ebp)
+f0103175:	ff 75 d4             	push   -0x2c(%ebp)
+f0103178:	57                   	push   %edi
+f0103179:	89 f1                	mov    %esi,%ecx
+f010317b:	89 da                	mov    %ebx,%edx
+f010317d:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103180:	e8 41 e8 ff ff       	call   f01019c6 <page_insert_pte>
+		if (!(*srcpte & PTE_D))
+f0103185:	83 c4 10             	add    $0x10,%esp
+f0103188:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010318b:	f6 00 40             	testb  $0x40,(%eax)
+f010318e:	0f 85 a1 fe ff ff    	jne    f0103035 <page_fork+0x31>
+			dstpt[PTX(va)] &= ~PTE_D;
+f0103194:	83 23 bf             	andl   $0xffffffbf,(%ebx)
+f0103197:	e9 99 fe ff ff       	jmp    f0103035 <page_fork+0x31>
+		panic("pa2page called with invalid pa");
+f010319c:	83 ec 04             	sub    $0x4,%esp
+f010319f:	68 98 95 10 f0       	push   $0xf0109598
+f01031a4:	6a 65                	push   $0x65
+f01031a6:	68 87 94 10 f0       	push   $0xf0109487
+f01031ab:	e8 90 ce ff ff       	call   f0100040 <_panic>
+			struct PageInfo *copy = page_alloc(0);
+f01031b0:	83 ec 0c             	sub    $0xc,%esp
+f01031b3:	6a 00                	push   $0x0
+f01031b5:	e8 36 e5 ff ff       	call   f01016f0 <page_alloc>
+f01031ba:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (!copy) {
+f01031bd:	83 c4 10             	add    $0x10,%esp
+f01031c0:	85 c0                	test   %eax,%eax
+f01031c2:	0f 84 a9 00 00 00    	je     f0103271 <page_fork+0x26d>
+	return (pp - pages) << PGSHIFT;
+f01031c8:	8b 15 60 a0 85 f0    	mov    0xf085a060,%edx
+f01031ce:	89 f0                	mov    %esi,%eax
+f01031d0:	29 d0                	sub    %edx,%eax
+f01031d2:	c1 f8 02             	sar    $0x2,%eax
+f01031d5:	69 c0 b7 6d db b6    	imul   $0xb6db6db7,%eax,%eax
+f01031db:	89 c3                	mov    %eax,%ebx
+f01031dd:	c1 e3 0c             	shl    $0xc,%ebx
+	if (PGNUM(pa) >= npages)
+f01031e0:	8b 0d 54 a0 85 f0    	mov    0xf085a054,%ecx
+f01031e6:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01031eb:	39 c8                	cmp    %ecx,%eax
+f01031ed:	73 42                	jae    f0103231 <page_fork+0x22d>
+	return (void *)(pa + KERNBASE);
+f01031ef:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+	return (pp - pages) << PGSHIFT;
+f01031f5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f01031f8:	29 d0                	sub    %edx,%eax
+f01031fa:	c1 f8 02             	sar    $0x2,%eax
+f01031fd:	69 c0 b7 6d db b6    	imul   $0xb6db6db7,%eax,%eax
+f0103203:	89 c2                	mov    %eax,%edx
+f0103205:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0103208:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010320d:	39 c8                	cmp    %ecx,%eax
+f010320f:	73 32                	jae    f0103243 <page_fork+0x23f>
+			memcpy(page2kva(copy), page2kva(pp), PGSIZE);
+f0103211:	83 ec 04             	sub    $0x4,%esp
+f0103214:	68 00 10 00 00       	push   $0x1000
+f0103219:	53                   	push   %ebx
+	return (void *)(pa + KERNBASE);
+f010321a:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0103220:	52                   	push   %edx
+f0103221:	e8 00 46 00 00       	call   f0107826 <memcpy>
+			pp = copy;
+f0103226:	83 c4 10             	add    $0x10,%esp
+f0103229:	8b 75 cc             	mov    -0x34(%ebp),%esi
+f010322c:	e9 36 ff ff ff       	jmp    f0103167 <page_fork+0x163>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103231:	53                   	push   %ebx
+f0103232:	68 e4 85 10 f0       	push   $0xf01085e4
+f0103237:	6a 6c                	push   $0x6c
+f0103239:	68 87 94 10 f0       	push   $0xf0109487
+f010323e:	e8 fd cd ff ff       	call   f0100040 <_panic>
+f0103243:	52                   	push   %edx
+f0103244:	68 e4 85 10 f0       	push   $0xf01085e4
+f0103249:	6a 6c                	push   $0x6c
+f010324b:	68 87 94 10 f0       	push   $0xf0109487
+f0103250:	e8 eb cd ff ff       	call   f0100040 <_panic>
+	int perm, flush = 0, r = 0;
+f0103255:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (flush)
+f010325a:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+f010325e:	75 18                	jne    f0103278 <page_fork+0x274>
+}
+f0103260:	89 d8                	mov    %ebx,%eax
+f0103262:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103265:	5b                   	pop    %ebx
+f0103266:	5e                   	pop    %esi
+f0103267:	5f                   	pop    %edi
+f0103268:	5d                   	pop    %ebp
+f0103269:	c3                   	ret
+				r = -E_NO_MEM;
+f010326a:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f010326f:	eb e9                	jmp    f010325a <page_fork+0x256>
+				r = -E_NO_MEM;
+f0103271:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f0103276:	eb e2                	jmp    f010325a <page_fork+0x256>
+		tlb_flush(srcpgdir);
+f0103278:	83 ec 0c             	sub    $0xc,%esp
+f010327b:	ff 75 08             	push   0x8(%ebp)
+f010327e:	e8 4c e9 ff ff       	call   f0101bcf <tlb_flush>
+f0103283:	83 c4 10             	add    $0x10,%esp
+	return r;
+f0103286:	eb d8                	jmp    f0103260 <page_fork+0x25c>
+
+f0103288 <mmio_map_region>:
+{
+f0103288:	55                   	push   %ebp
+f0103289:	89 e5                	mov    %esp,%ebp
+f010328b:	53                   	push   %ebx
+f010328c:	83 ec 04             	sub    $0x4,%esp
+	size = ROUNDUP(size, PGSIZE);
+f010328f:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103292:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+f0103298:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (base + size > MMIOLIM) {
+f010329e:	8b 15 00 53 11 f0    	mov    0xf0115300,%edx
+f01032a4:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+f01032a7:	3d 00 00 c0 ef       	cmp    $0xefc00000,%eax
+f01032ac:	77 26                	ja     f01032d4 <mmio_map_region+0x4c>
+	boot_map_region(kern_pgdir, base, size, pa, PTE_PCD|PTE_PWT|PTE_W);
+f01032ae:	83 ec 08             	sub    $0x8,%esp
+f01032b1:	6a 1a                	push   $0x1a
+f01032b3:	ff 75 08             	push   0x8(%ebp)
+f01032b6:	89 d9                	mov    %ebx,%ecx
+f01032b8:	a1 58 a0 85 f0       	mov    0xf085a058,%eax
+f01032bd:	e8 48 eb ff ff       	call   f0101e0a <boot_map_region>
+	base += size;
+f01032c2:	a1 00 53 11 f0       	mov    0xf0115300,%eax
+f01032c7:	01 c3                	add    %eax,%ebx
+f01032c9:	89 1d 00 53 11 f0    	mov    %ebx,0xf0115300
+}
+f01032cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01032d2:	c9                   	leave
+f01032d3:	c3                   	ret
+		panic("mmio_map_region: MMIO overflow");
+f01032d4:	83 ec 04             	sub    $0x4,%esp
+f01032d7:	68 a8 97 10 f0       	push   $0xf01097a8
+f01032dc:	68 98 05 00 00       	push   $0x598
+f01032e1:	68 7b 94 10 f0       	push   $0xf010947b
+f01032e6:	e8 55 cd ff ff       	call   f0100040 <_panic>
+
+f01032eb <user_mem_check>:
+{
+f01032eb:	55                   	push   %ebp
+f01032ec:	89 e5                	mov    %esp,%ebp
+f01032ee:	57                   	push   %edi
+f01032ef:	56                   	push   %esi
+f01032f0:	53                   	push   %ebx
+f01032f1:	83 ec 1c             	sub    $0x1c,%esp
+f01032f4:	8b 7d 08             	mov    0x8(%ebp),%edi
+f01032f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	va_cp = (char *)ROUNDDOWN((uint32_t)va, PGSIZE);
+f01032fa:	89 cb                	mov    %ecx,%ebx
+f01032fc:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	va_last_cp = (char *)ROUNDUP(((uint32_t)va) + len, PGSIZE);
+f0103302:	8b 45 10             	mov    0x10(%ebp),%eax
+f0103305:	8d 84 01 ff 0f 00 00 	lea    0xfff(%ecx,%eax,1),%eax
+f010330c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0103311:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	perm |= PTE_P;
+f0103314:	8b 75 14             	mov    0x14(%ebp),%esi
+f0103317:	83 ce 01             	or     $0x1,%esi
+	for ( ; va_cp < va_last_cp; va_cp += PGSIZE) {
+f010331a:	eb 33                	jmp    f010334f <user_mem_check+0x64>
+			pte = pgdir_walk(env->env_pgdir, (void *)va_cp, 0);
+f010331c:	83 ec 04             	sub    $0x4,%esp
+f010331f:	6a 00                	push   $0x0
+f0103321:	53                   	push   %ebx
+f0103322:	ff 77 60             	push   0x60(%edi)
+f0103325:	e8 bb e9 ff ff       	call   f0101ce5 <pgdir_walk>
+		if ((((uintptr_t)va_cp) >= ULIM) || (!pte) || ((PGOFF(*pte) & perm) != perm)) {
+f010332a:	83 c4 10             	add    $0x10,%esp
+f010332d:	81 7d e4 ff ff 7f ef 	cmpl   $0xef7fffff,-0x1c(%ebp)
+f0103334:	77 3d                	ja     f0103373 <user_mem_check+0x88>
+f0103336:	85 c0                	test   %eax,%eax
+f0103338:	74 39                	je     f0103373 <user_mem_check+0x88>
+f010333a:	89 f1                	mov    %esi,%ecx
+f010333c:	23 08                	and    (%eax),%ecx
+f010333e:	89 c8                	mov    %ecx,%eax
+f0103340:	25 ff 0f 00 00       	and    $0xfff,%eax
+f0103345:	39 c6                	cmp    %eax,%esi
+f0103347:	75 2a                	jne    f0103373 <user_mem_check+0x88>
+	for ( ; va_cp < va_last_cp; va_cp += PGSIZE) {
+f0103349:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f010334f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0103352:	39 c3                	cmp    %eax,%ebx
+f0103354:	73 3b                	jae    f0103391 <user_mem_check+0xa6>
+		if ((uintptr_t)va_cp < UTOP && (env->env_pgdir[PDX(va_cp)] & PTE_PS))
+f0103356:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f0103359:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f010335f:	77 bb                	ja     f010331c <user_mem_check+0x31>
+f0103361:	89 da                	mov    %ebx,%edx
+f0103363:	c1 ea 16             	shr    $0x16,%edx
+f0103366:	8b 47 60             	mov    0x60(%edi),%eax
+f0103369:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f010336c:	f6 00 80             	testb  $0x80,(%eax)
+f010336f:	75 c9                	jne    f010333a <user_mem_check+0x4f>
+f0103371:	eb a9                	jmp    f010331c <user_mem_check+0x31>
+			user_mem_check_addr = ((uintptr_t)va_cp < (uintptr_t)va ? (uintptr_t)va : (uintptr_t)va_cp);
+f0103373:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0103376:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103379:	39 c1                	cmp    %eax,%ecx
+f010337b:	0f 42 c8             	cmovb  %eax,%ecx
+f010337e:	89 0d 48 72 85 f0    	mov    %ecx,0xf0857248
+			return -E_FAULT;
+f0103384:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+}
+f0103389:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010338c:	5b                   	pop    %ebx
+f010338d:	5e                   	pop    %esi
+f010338e:	5f                   	pop    %edi
+f010338f:	5d                   	pop    %ebp
+f0103390:	c3                   	ret
+	return 0;
+f0103391:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103396:	eb f1                	jmp    f0103389 <user_mem_check+0x9e>
+
+f0103398 <user_mem_assert>:
+{
+f0103398:	55                   	push   %ebp
+f0103399:	89 e5                	mov    %esp,%ebp
+f010339b:	53                   	push   %ebx
+f010339c:	83 ec 04             	sub    $0x4,%esp
+f010339f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (user_mem_check(env, va, len, perm | PTE_U) < 0) {
+f01033a2:	8b 45 14             	mov    0x14(%ebp),%eax
+f01033a5:	83 c8 04             	or     $0x4,%eax
+f01033a8:	50                   	push   %eax
+f01033a9:	ff 75 10             	push   0x10(%ebp)
+f01033ac:	ff 75 0c             	push   0xc(%ebp)
+f01033af:	53                   	push   %ebx
+f01033b0:	e8 36 ff ff ff       	call   f01032eb <user_mem_check>
+f01033b5:	83 c4 10             	add    $0x10,%esp
+f01033b8:	85 c0                	test   %eax,%eax
+f01033ba:	78 05                	js     f01033c1 <user_mem_assert+0x29>
+}
+f01033bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01033bf:	c9                   	leave
+f01033c0:	c3                   	ret
+		cprintf("[%08x] user_mem_check assertion failure for "
+f01033c1:	83 ec 04             	sub    $0x4,%esp
+f01033c4:	ff 35 48 72 85 f0    	push   0xf0857248
+f01033ca:	ff 73 48             	push   0x48(%ebx)
+f01033cd:	68 c8 97 10 f0       	push   $0xf01097c8
+f01033d2:	e8 13 11 00 00       	call   f01044ea <cprintf>
+		env_destroy(env);	// may not return
+f01033d7:	89 1c 24             	mov    %ebx,(%esp)
+f01033da:	e8 62 0d 00 00       	call   f0104141 <env_destroy>
+f01033df:	83 c4 10             	add    $0x10,%esp
+}
+f01033e2:	eb d8                	jmp    f01033bc <user_mem_assert+0x24>
+
+f01033e4 <region_alloc>:
+// Pages should be writable by user and kernel.
+// Panic if any allocation attempt fails.
+//
+static void
+region_alloc(struct Env *e, void *va, size_t len)
+{
+f01033e4:	55                   	push   %ebp
+f01033e5:	89 e5                	mov    %esp,%ebp
+f01033e7:	57                   	push   %edi
+f01033e8:	56                   	push   %esi
+f01033e9:	53                   	push   %ebx
+f01033ea:	83 ec 1c             	sub    $0x1c,%esp
+f01033ed:	89 c6                	mov    %eax,%esi
+	//   'va' and 'len' values that are not page-aligned.
+	//   You should round va down, and round (va + len) up.
+	//   (Watch out for corner-cases!)
+	char *va_cp, *va_last_cp;
+	struct PageInfo *p = NULL;
+	va_cp = (char *)ROUNDDOWN((uint32_t)va, PGSIZE);
+f01033ef:	89 d3                	mov    %edx,%ebx
+f01033f1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	va_last_cp = (char *)ROUNDUP(((uint32_t)va) + len, PGSIZE);
+f01033f7:	8d bc 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edi
+f01033fe:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	// and insert that physical page at the virtual page.
+	for ( ; va_cp < va_last_cp; va_cp += PGSIZE) {
+		if (!(p = page_alloc(0))) {
+			panic("region_alloc: failed page_alloc");
+		}
+		if (page_insert(e->env_pgdir, p, (void *)va_cp, PTE_W|PTE_U, &e->env_npages) < 0) {
+f0103404:	8d 40 64             	lea    0x64(%eax),%eax
+f0103407:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for ( ; va_cp < va_last_cp; va_cp += PGSIZE) {
+f010340a:	39 fb                	cmp    %edi,%ebx
+f010340c:	73 60                	jae    f010346e <region_alloc+0x8a>
+		if (!(p = page_alloc(0))) {
+f010340e:	83 ec 0c             	sub    $0xc,%esp
+f0103411:	6a 00                	push   $0x0
+f0103413:	e8 d8 e2 ff ff       	call   f01016f0 <page_alloc>
+f0103418:	83 c4 10             	add    $0x10,%esp
+f010341b:	85 c0                	test   %eax,%eax
+f010341d:	74 21                	je     f0103440 <region_alloc+0x5c>
+		if (page_insert(e->env_pgdir, p, (void *)va_cp, PTE_W|PTE_U, &e->env_npages) < 0) {
+f010341f:	83 ec 0c             	sub    $0xc,%esp
+f0103422:	ff 75 e4             	push   -0x1c(%ebp)
+f0103425:	6a 06                	push   $0x6
+f0103427:	53                   	push   %ebx
+f0103428:	50                   	push   %eax
+f0103429:	ff 76 60             	push   0x60(%esi)
+f010342c:	e8 47 f2 ff ff       	call   f0102678 <page_insert>
+f0103431:	83 c4 20             	add    $0x20,%esp
+f0103434:	85 c0                	test   %eax,%eax
+f0103436:	78 1f                	js     f0103457 <region_alloc+0x73>
+	for ( ; va_cp < va_last_cp; va_cp += PGSIZE) {
+f0103438:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f010343e:	eb ca                	jmp    f010340a <region_alloc+0x26>
+			panic("region_alloc: failed page_alloc");
+f0103440:	83 ec 04             	sub    $0x4,%esp
+f0103443:	68 10 98 10 f0       	push   $0xf0109810
+f0103448:	68 5d 01 00 00       	push   $0x15d
+f010344d:	68 d6 98 10 f0       	push   $0xf01098d6
+f0103452:	e8 e9 cb ff ff       	call   f0100040 <_panic>
+			panic("region_alloc: failed page_insert");
+f0103457:	83 ec 04             	sub    $0x4,%esp
+f010345a:	68 30 98 10 f0       	push   $0xf0109830
+f010345f:	68 60 01 00 00       	push   $0x160
+f0103464:	68 d6 98 10 f0       	push   $0xf01098d6
+f0103469:	e8 d2 cb ff ff       	call   f0100040 <_panic>
+		}
+	}
+}
+f010346e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103471:	5b                   	pop    %ebx
+f0103472:	5e                   	pop    %esi
+f0103473:	5f                   	pop    %edi
+f0103474:	5d                   	pop    %ebp
+f0103475:	c3                   	ret
+
+f0103476 <env_futex_unlink>:
+// runnable, if need be.
+//
+static void
+env_futex_unlink(struct Env **ep)
+{
+	struct Env *e = *ep;
+f0103476:	8b 10                	mov    (%eax),%edx
+
+	*ep = e->env_futex_link;
+f0103478:	8b 8a 3c 01 00 00    	mov    0x13c(%edx),%ecx
+f010347e:	89 08                	mov    %ecx,(%eax)
+	if (PGNUM(pa) >= npages)
+f0103480:	8b 82 38 01 00 00    	mov    0x138(%edx),%eax
+f0103486:	c1 e8 0c             	shr    $0xc,%eax
+f0103489:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f010348f:	73 23                	jae    f01034b4 <env_futex_unlink+0x3e>
+	return &pages[PGNUM(pa)];
+f0103491:	6b c0 1c             	imul   $0x1c,%eax,%eax
+f0103494:	03 05 60 a0 85 f0    	add    0xf085a060,%eax
+	pa2page(e->env_futex_addr)->pp_futex_waiters--;
+f010349a:	66 83 68 0c 01       	subw   $0x1,0xc(%eax)
+	e->env_futex_addr = 0;
+f010349f:	c7 82 38 01 00 00 00 	movl   $0x0,0x138(%edx)
+f01034a6:	00 00 00 
+	e->env_futex_link = NULL;
+f01034a9:	c7 82 3c 01 00 00 00 	movl   $0x0,0x13c(%edx)
+f01034b0:	00 00 00 
+f01034b3:	c3                   	ret
+{
+f01034b4:	55                   	push   %ebp
+f01034b5:	89 e5                	mov    %esp,%ebp
+f01034b7:	83 ec 0c             	sub    $0xc,%esp
+		panic("pa2page called with invalid pa");
+f01034ba:	68 98 95 10 f0       	push   $0xf0109598
+f01034bf:	6a 65                	push   $0x65
+f01034c1:	68 87 94 10 f0       	push   $0xf0109487
+f01034c6:	e8 75 cb ff ff       	call   f0100040 <_panic>
+
+f01034cb <envid2env>:
+{
+f01034cb:	55                   	push   %ebp
+f01034cc:	89 e5                	mov    %esp,%ebp
+f01034ce:	56                   	push   %esi
+f01034cf:	53                   	push   %ebx
+f01034d0:	8b 75 08             	mov    0x8(%ebp),%esi
+f01034d3:	8b 55 10             	mov    0x10(%ebp),%edx
+	if (envid == 0) {
+f01034d6:	85 f6                	test   %esi,%esi
+f01034d8:	74 30                	je     f010350a <envid2env+0x3f>
+	e = &envs[ENVX(envid)];
+f01034da:	89 f0                	mov    %esi,%eax
+f01034dc:	25 ff 03 00 00       	and    $0x3ff,%eax
+f01034e1:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+f01034e4:	c1 e3 06             	shl    $0x6,%ebx
+f01034e7:	03 1d e0 92 85 f0    	add    0xf08592e0,%ebx
+	if (e->env_status == ENV_FREE || e->env_id != envid) {
+f01034ed:	83 7b 54 00          	cmpl   $0x0,0x54(%ebx)
+f01034f1:	74 5b                	je     f010354e <envid2env+0x83>
+f01034f3:	39 73 48             	cmp    %esi,0x48(%ebx)
+f01034f6:	75 62                	jne    f010355a <envid2env+0x8f>
+	if (checkperm && e != curenv && e->env_parent_id != curenv->env_id) {
+f01034f8:	84 d2                	test   %dl,%dl
+f01034fa:	75 20                	jne    f010351c <envid2env+0x51>
+	return 0;
+f01034fc:	b8 00 00 00 00       	mov    $0x0,%eax
+		*env_store = curenv;
+f0103501:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0103504:	89 1a                	mov    %ebx,(%edx)
+}
+f0103506:	5b                   	pop    %ebx
+f0103507:	5e                   	pop    %esi
+f0103508:	5d                   	pop    %ebp
+f0103509:	c3                   	ret
+		*env_store = curenv;
+f010350a:	e8 34 49 00 00       	call   f0107e43 <cpunum>
+f010350f:	6b c0 74             	imul   $0x74,%eax,%eax
+f0103512:	8b 98 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%ebx
+		return 0;
+f0103518:	89 f0                	mov    %esi,%eax
+f010351a:	eb e5                	jmp    f0103501 <envid2env+0x36>
+	if (checkperm && e != curenv && e->env_parent_id != curenv->env_id) {
+f010351c:	e8 22 49 00 00       	call   f0107e43 <cpunum>
+f0103521:	6b c0 74             	imul   $0x74,%eax,%eax
+f0103524:	39 98 28 b0 85 f0    	cmp    %ebx,-0xf7a4fd8(%eax)
+f010352a:	74 d0                	je     f01034fc <envid2env+0x31>
+f010352c:	8b 73 4c             	mov    0x4c(%ebx),%esi
+f010352f:	e8 0f 49 00 00       	call   f0107e43 <cpunum>
+f0103534:	6b c0 74             	imul   $0x74,%eax,%eax
+f0103537:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f010353d:	3b 70 48             	cmp    0x48(%eax),%esi
+f0103540:	74 ba                	je     f01034fc <envid2env+0x31>
+f0103542:	bb 00 00 00 00       	mov    $0x0,%ebx
+		return -E_BAD_ENV;
+f0103547:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f010354c:	eb b3                	jmp    f0103501 <envid2env+0x36>
+f010354e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		return -E_BAD_ENV;
+f0103553:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103558:	eb a7                	jmp    f0103501 <envid2env+0x36>
+f010355a:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010355f:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103564:	eb 9b                	jmp    f0103501 <envid2env+0x36>
+
+f0103566 <env_init_percpu>:
+	__asm __volatile("lgdt (%0)" : : "r" (p));
+f0103566:	b8 20 53 11 f0       	mov    $0xf0115320,%eax
+f010356b:	0f 01 10             	lgdtl  (%eax)
+	asm volatile("movw %%ax,%%gs" :: "a" (GD_UD|3));
+f010356e:	b8 23 00 00 00       	mov    $0x23,%eax
+f0103573:	8e e8                	mov    %eax,%gs
+	asm volatile("movw %%ax,%%fs" :: "a" (GD_UD|3));
+f0103575:	8e e0                	mov    %eax,%fs
+	asm volatile("movw %%ax,%%es" :: "a" (GD_KD));
+f0103577:	b8 10 00 00 00       	mov    $0x10,%eax
+f010357c:	8e c0                	mov    %eax,%es
+	asm volatile("movw %%ax,%%ds" :: "a" (GD_KD));
+f010357e:	8e d8                	mov    %eax,%ds
+	asm volatile("movw %%ax,%%ss" :: "a" (GD_KD));
+f0103580:	8e d0                	mov    %eax,%ss
+	asm volatile("ljmp %0,$1f\n 1:\n" :: "i" (GD_KT));
+f0103582:	ea 89 35 10 f0 08 00 	ljmp   $0x8,$0xf0103589
+	__asm __volatile("lldt %0" : : "r" (sel));
+f0103589:	b8 00 00 00 00       	mov    $0x0,%eax
+f010358e:	0f 00 d0             	lldt   %ax
+}
+f0103591:	c3                   	ret
+
+f0103592 <env_init>:
+{
+f0103592:	55                   	push   %ebp
+f0103593:	89 e5                	mov    %esp,%ebp
+f0103595:	56                   	push   %esi
+f0103596:	53                   	push   %ebx
+		envs[i].env_status = ENV_FREE;
+f0103597:	8b 35 e0 92 85 f0    	mov    0xf08592e0,%esi
+f010359d:	8d 86 c0 fe 04 00    	lea    0x4fec0(%esi),%eax
+f01035a3:	b9 01 00 00 00       	mov    $0x1,%ecx
+f01035a8:	ba 00 00 00 00       	mov    $0x0,%edx
+f01035ad:	89 d3                	mov    %edx,%ebx
+f01035af:	89 c2                	mov    %eax,%edx
+f01035b1:	c7 40 54 00 00 00 00 	movl   $0x0,0x54(%eax)
+		envs[i].env_id = 0;
+f01035b8:	c7 40 48 00 00 00 00 	movl   $0x0,0x48(%eax)
+		envs[i].env_link = env_free_list;
+f01035bf:	89 58 44             	mov    %ebx,0x44(%eax)
+		if (!i) {
+f01035c2:	89 cb                	mov    %ecx,%ebx
+f01035c4:	83 c1 01             	add    $0x1,%ecx
+f01035c7:	2d 40 01 00 00       	sub    $0x140,%eax
+f01035cc:	39 f2                	cmp    %esi,%edx
+f01035ce:	75 dd                	jne    f01035ad <env_init+0x1b>
+f01035d0:	89 35 04 94 85 f0    	mov    %esi,0xf0859404
+f01035d6:	89 1d 64 a0 85 f0    	mov    %ebx,0xf085a064
+	env_init_percpu();
+f01035dc:	e8 85 ff ff ff       	call   f0103566 <env_init_percpu>
+}
+f01035e1:	5b                   	pop    %ebx
+f01035e2:	5e                   	pop    %esi
+f01035e3:	5d                   	pop    %ebp
+f01035e4:	c3                   	ret
+
+f01035e5 <env_alloc>:
+{
+f01035e5:	55                   	push   %ebp
+f01035e6:	89 e5                	mov    %esp,%ebp
+f01035e8:	56                   	push   %esi
+f01035e9:	53                   	push   %ebx
+f01035ea:	83 ec 10             	sub    $0x10,%esp
+f01035ed:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if (!(e = env_free_list))
+f01035f0:	8b 1d 04 94 85 f0    	mov    0xf0859404,%ebx
+f01035f6:	85 db                	test   %ebx,%ebx
+f01035f8:	0f 84 29 02 00 00    	je     f0103827 <env_alloc+0x242>
+	if (!(p = page_alloc(ALLOC_ZERO)))
+f01035fe:	83 ec 0c             	sub    $0xc,%esp
+f0103601:	6a 01                	push   $0x1
+f0103603:	e8 e8 e0 ff ff       	call   f01016f0 <page_alloc>
+f0103608:	89 c2                	mov    %eax,%edx
+f010360a:	83 c4 10             	add    $0x10,%esp
+f010360d:	85 c0                	test   %eax,%eax
+f010360f:	0f 84 19 02 00 00    	je     f010382e <env_alloc+0x249>
+	return (pp - pages) << PGSHIFT;
+f0103615:	2b 05 60 a0 85 f0    	sub    0xf085a060,%eax
+f010361b:	c1 f8 02             	sar    $0x2,%eax
+f010361e:	69 c0 b7 6d db b6    	imul   $0xb6db6db7,%eax,%eax
+f0103624:	89 c1                	mov    %eax,%ecx
+f0103626:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0103629:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010362e:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f0103634:	0f 83 98 01 00 00    	jae    f01037d2 <env_alloc+0x1ed>
+	return (void *)(pa + KERNBASE);
+f010363a:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f0103640:	89 4b 60             	mov    %ecx,0x60(%ebx)
+	++(p->pp_ref);
+f0103643:	66 83 42 0a 01       	addw   $0x1,0xa(%edx)
+f0103648:	b8 ec 0e 00 00       	mov    $0xeec,%eax
+		e->env_pgdir[i] = kern_pgdir[i];
+f010364d:	8b 15 58 a0 85 f0    	mov    0xf085a058,%edx
+f0103653:	8b 0c 02             	mov    (%edx,%eax,1),%ecx
+f0103656:	8b 53 60             	mov    0x60(%ebx),%edx
+f0103659:	89 0c 02             	mov    %ecx,(%edx,%eax,1)
+	for (i = PDX(UTOP); i < NPTENTRIES; ++i) {
+f010365c:	83 c0 04             	add    $0x4,%eax
+f010365f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+f0103664:	75 e7                	jne    f010364d <env_alloc+0x68>
+	e->env_pgdir[PDX(UVPT)] = PADDR(e->env_pgdir) | PTE_P | PTE_U;
+f0103666:	8b 43 60             	mov    0x60(%ebx),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103669:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010366e:	0f 86 70 01 00 00    	jbe    f01037e4 <env_alloc+0x1ff>
+	return (physaddr_t)kva - KERNBASE;
+f0103674:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f010367a:	83 ca 05             	or     $0x5,%edx
+f010367d:	89 90 f4 0e 00 00    	mov    %edx,0xef4(%eax)
+	generation = (e->env_id + (1 << ENVGENSHIFT)) & ~(NENV - 1);
+f0103683:	8b 43 48             	mov    0x48(%ebx),%eax
+f0103686:	05 00 10 00 00       	add    $0x1000,%eax
+		generation = 1 << ENVGENSHIFT;
+f010368b:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+f0103690:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0103695:	0f 4e c2             	cmovle %edx,%eax
+	e->env_id = generation | (e - envs);
+f0103698:	89 da                	mov    %ebx,%edx
+f010369a:	2b 15 e0 92 85 f0    	sub    0xf08592e0,%edx
+f01036a0:	c1 fa 06             	sar    $0x6,%edx
+f01036a3:	69 d2 cd cc cc cc    	imul   $0xcccccccd,%edx,%edx
+f01036a9:	09 d0                	or     %edx,%eax
+f01036ab:	89 43 48             	mov    %eax,0x48(%ebx)
+	e->env_parent_id = parent_id;
+f01036ae:	89 73 4c             	mov    %esi,0x4c(%ebx)
+	e->env_type = ENV_TYPE_USER;
+f01036b1:	c7 43 50 00 00 00 00 	movl   $0x0,0x50(%ebx)
+	e->env_status = ENV_RUNNABLE;
+f01036b8:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+	e->env_runs = 0;
+f01036bf:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+	memset(&e->env_tf, 0, sizeof(e->env_tf));
+f01036c6:	83 ec 04             	sub    $0x4,%esp
+f01036c9:	6a 44                	push   $0x44
+f01036cb:	6a 00                	push   $0x0
+f01036cd:	53                   	push   %ebx
+f01036ce:	e8 bc 40 00 00       	call   f010778f <memset>
+	e->env_tf.tf_ds = GD_UD | 3;
+f01036d3:	66 c7 43 24 23 00    	movw   $0x23,0x24(%ebx)
+	e->env_tf.tf_es = GD_UD | 3;
+f01036d9:	66 c7 43 20 23 00    	movw   $0x23,0x20(%ebx)
+	e->env_tf.tf_ss = GD_UD | 3;
+f01036df:	66 c7 43 40 23 00    	movw   $0x23,0x40(%ebx)
+	e->env_tf.tf_esp = USTACKTOP;
+f01036e5:	c7 43 3c 00 e0 bf ee 	movl   $0xeebfe000,0x3c(%ebx)
+	e->env_tf.tf_cs = GD_UT | 3;
+f01036ec:	66 c7 43 34 1b 00    	movw   $0x1b,0x34(%ebx)
+	e->env_tf.tf_eflags |= FL_IF;
+f01036f2:	81 4b 38 00 02 00 00 	orl    $0x200,0x38(%ebx)
+	e->env_pgfault_upcall = 0;
+f01036f9:	c7 43 74 00 00 00 00 	movl   $0x0,0x74(%ebx)
+	e->env_ipc_recving = 0;
+f0103700:	c6 43 78 00          	movb   $0x0,0x78(%ebx)
+	e->env_ipc_callee = 0;
+f0103704:	c7 83 a8 00 00 00 00 	movl   $0x0,0xa8(%ebx)
+f010370b:	00 00 00 
+	e->env_ipc_blocked_sender = 0;
+f010370e:	c7 83 ac 00 00 00 00 	movl   $0x0,0xac(%ebx)
+f0103715:	00 00 00 
+	e->env_ipc_blocked_sender_chain = 0;
+f0103718:	c7 83 b0 00 00 00 00 	movl   $0x0,0xb0(%ebx)
+f010371f:	00 00 00 
+	memset(e->env_segs, 0, sizeof(e->env_segs));
+f0103722:	83 c4 0c             	add    $0xc,%esp
+f0103725:	68 80 00 00 00       	push   $0x80
+f010372a:	6a 00                	push   $0x0
+f010372c:	8d 83 b4 00 00 00    	lea    0xb4(%ebx),%eax
+f0103732:	50                   	push   %eax
+f0103733:	e8 57 40 00 00       	call   f010778f <memset>
+	e->env_pagein_pager = 0;
+f0103738:	c7 83 34 01 00 00 00 	movl   $0x0,0x134(%ebx)
+f010373f:	00 00 00 
+	e->env_futex_addr = 0;
+f0103742:	c7 83 38 01 00 00 00 	movl   $0x0,0x138(%ebx)
+f0103749:	00 00 00 
+	e->env_futex_link = NULL;
+f010374c:	c7 83 3c 01 00 00 00 	movl   $0x0,0x13c(%ebx)
+f0103753:	00 00 00 
+	e->env_rss_min = e->env_rss_max = 0;
+f0103756:	c7 43 6c 00 00 00 00 	movl   $0x0,0x6c(%ebx)
+f010375d:	c7 43 68 00 00 00 00 	movl   $0x0,0x68(%ebx)
+	if (parent_id && envid2env(parent_id, &parent, 0) == 0) {
+f0103764:	83 c4 10             	add    $0x10,%esp
+f0103767:	85 f6                	test   %esi,%esi
+f0103769:	0f 85 8a 00 00 00    	jne    f01037f9 <env_alloc+0x214>
+	e->env_rss_reclaimed = 0;
+f010376f:	c7 43 70 00 00 00 00 	movl   $0x0,0x70(%ebx)
+	env_free_list = e->env_link;
+f0103776:	8b 43 44             	mov    0x44(%ebx),%eax
+f0103779:	a3 04 94 85 f0       	mov    %eax,0xf0859404
+	*newenv_store = e;
+f010377e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103781:	89 18                	mov    %ebx,(%eax)
+	num_free_envs--;
+f0103783:	83 2d 64 a0 85 f0 01 	subl   $0x1,0xf085a064
+	cprintf("[%08x] new env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
+f010378a:	8b 5b 48             	mov    0x48(%ebx),%ebx
+f010378d:	e8 b1 46 00 00       	call   f0107e43 <cpunum>
+f0103792:	6b c0 74             	imul   $0x74,%eax,%eax
+f0103795:	ba 00 00 00 00       	mov    $0x0,%edx
+f010379a:	83 b8 28 b0 85 f0 00 	cmpl   $0x0,-0xf7a4fd8(%eax)
+f01037a1:	74 11                	je     f01037b4 <env_alloc+0x1cf>
+f01037a3:	e8 9b 46 00 00       	call   f0107e43 <cpunum>
+f01037a8:	6b c0 74             	imul   $0x74,%eax,%eax
+f01037ab:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01037b1:	8b 50 48             	mov    0x48(%eax),%edx
+f01037b4:	83 ec 04             	sub    $0x4,%esp
+f01037b7:	53                   	push   %ebx
+f01037b8:	52                   	push   %edx
+f01037b9:	68 e1 98 10 f0       	push   $0xf01098e1
+f01037be:	e8 27 0d 00 00       	call   f01044ea <cprintf>
+	return 0;
+f01037c3:	83 c4 10             	add    $0x10,%esp
+f01037c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01037cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01037ce:	5b                   	pop    %ebx
+f01037cf:	5e                   	pop    %esi
+f01037d0:	5d                   	pop    %ebp
+f01037d1:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01037d2:	51                   	push   %ecx
+f01037d3:	68 e4 85 10 f0       	push   $0xf01085e4
+f01037d8:	6a 6c                	push   $0x6c
+f01037da:	68 87 94 10 f0       	push   $0xf0109487
+f01037df:	e8 5c c8 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01037e4:	50                   	push   %eax
+f01037e5:	68 08 86 10 f0       	push   $0xf0108608
+f01037ea:	68 dd 00 00 00       	push   $0xdd
+f01037ef:	68 d6 98 10 f0       	push   $0xf01098d6
+f01037f4:	e8 47 c8 ff ff       	call   f0100040 <_panic>
+	if (parent_id && envid2env(parent_id, &parent, 0) == 0) {
+f01037f9:	83 ec 04             	sub    $0x4,%esp
+f01037fc:	6a 00                	push   $0x0
+f01037fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0103801:	50                   	push   %eax
+f0103802:	56                   	push   %esi
+f0103803:	e8 c3 fc ff ff       	call   f01034cb <envid2env>
+f0103808:	83 c4 10             	add    $0x10,%esp
+f010380b:	85 c0                	test   %eax,%eax
+f010380d:	0f 85 5c ff ff ff    	jne    f010376f <env_alloc+0x18a>
+		e->env_rss_min = parent->env_rss_min;
+f0103813:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0103816:	8b 50 68             	mov    0x68(%eax),%edx
+f0103819:	89 53 68             	mov    %edx,0x68(%ebx)
+		e->env_rss_max = parent->env_rss_max;
+f010381c:	8b 40 6c             	mov    0x6c(%eax),%eax
+f010381f:	89 43 6c             	mov    %eax,0x6c(%ebx)
+f0103822:	e9 48 ff ff ff       	jmp    f010376f <env_alloc+0x18a>
+		return -E_NO_FREE_ENV;
+f0103827:	b8 fb ff ff ff       	mov    $0xfffffffb,%eax
+f010382c:	eb 9d                	jmp    f01037cb <env_alloc+0x1e6>
+		return -E_NO_MEM;
+f010382e:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0103833:	eb 96                	jmp    f01037cb <env_alloc+0x1e6>
+
+f0103835 <env_create>:
+{
+f0103835:	55                   	push   %ebp
+f0103836:	89 e5                	mov    %esp,%ebp
+f0103838:	57                   	push   %edi
+f0103839:	56                   	push   %esi
+f010383a:	53                   	push   %ebx
+f010383b:	83 ec 34             	sub    $0x34,%esp
+	struct Env *newenv = 0;
+f010383e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (env_alloc(&newenv, (envid_t)0) < 0) {
+f0103845:	6a 00                	push   $0x0
+f0103847:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f010384a:	50                   	push   %eax
+f010384b:	e8 95 fd ff ff       	call   f01035e5 <env_alloc>
+f0103850:	83 c4 10             	add    $0x10,%esp
+f0103853:	85 c0                	test   %eax,%eax
+f0103855:	78 3c                	js     f0103893 <env_create+0x5e>
+	load_icode(newenv, binary, size);
+f0103857:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010385a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	struct Proghdr *ph = (struct Proghdr *) (((uint32_t)elfhdr) + elfhdr->e_phoff);
+f010385d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0103860:	89 cb                	mov    %ecx,%ebx
+f0103862:	03 59 1c             	add    0x1c(%ecx),%ebx
+	struct Proghdr *eph = ph + elfhdr->e_phnum;
+f0103865:	0f b7 79 2c          	movzwl 0x2c(%ecx),%edi
+f0103869:	c1 e7 05             	shl    $0x5,%edi
+f010386c:	01 df                	add    %ebx,%edi
+	lcr3(PADDR(e->env_pgdir));
+f010386e:	8b 40 60             	mov    0x60(%eax),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103871:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103876:	76 32                	jbe    f01038aa <env_create+0x75>
+	return (physaddr_t)kva - KERNBASE;
+f0103878:	05 00 00 00 10       	add    $0x10000000,%eax
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f010387d:	0f 22 d8             	mov    %eax,%cr3
+	for (seg = e->env_segs; ph < eph; ph++) {
+f0103880:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103883:	8d b0 b4 00 00 00    	lea    0xb4(%eax),%esi
+		if (seg < e->env_segs + NSEGS) {
+f0103889:	05 34 01 00 00       	add    $0x134,%eax
+f010388e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	for (seg = e->env_segs; ph < eph; ph++) {
+f0103891:	eb 6c                	jmp    f01038ff <env_create+0xca>
+		panic("env_create: env_alloc failed");
+f0103893:	83 ec 04             	sub    $0x4,%esp
+f0103896:	68 f6 98 10 f0       	push   $0xf01098f6
+f010389b:	68 dd 01 00 00       	push   $0x1dd
+f01038a0:	68 d6 98 10 f0       	push   $0xf01098d6
+f01038a5:	e8 96 c7 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01038aa:	50                   	push   %eax
+f01038ab:	68 08 86 10 f0       	push   $0xf0108608
+f01038b0:	68 a4 01 00 00       	push   $0x1a4
+f01038b5:	68 d6 98 10 f0       	push   $0xf01098d6
+f01038ba:	e8 81 c7 ff ff       	call   f0100040 <_panic>
+			region_alloc(e, (void *)ph->p_va, (size_t)ph->p_memsz);
+f01038bf:	8b 4b 14             	mov    0x14(%ebx),%ecx
+f01038c2:	8b 53 08             	mov    0x8(%ebx),%edx
+f01038c5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01038c8:	e8 17 fb ff ff       	call   f01033e4 <region_alloc>
+			memmove((void *)ph->p_va, (void *)(binary + ph->p_offset), (size_t)ph->p_filesz);
+f01038cd:	83 ec 04             	sub    $0x4,%esp
+f01038d0:	ff 73 10             	push   0x10(%ebx)
+f01038d3:	8b 45 08             	mov    0x8(%ebp),%eax
+f01038d6:	03 43 04             	add    0x4(%ebx),%eax
+f01038d9:	50                   	push   %eax
+f01038da:	ff 73 08             	push   0x8(%ebx)
+f01038dd:	e8 e2 3e 00 00       	call   f01077c4 <memmove>
+			memset((void *)(ph->p_va + ph->p_filesz), 0, (size_t)(ph->p_memsz - ph->p_filesz));
+f01038e2:	8b 43 10             	mov    0x10(%ebx),%eax
+f01038e5:	83 c4 0c             	add    $0xc,%esp
+f01038e8:	8b 53 14             	mov    0x14(%ebx),%edx
+f01038eb:	29 c2                	sub    %eax,%edx
+f01038ed:	52                   	push   %edx
+f01038ee:	6a 00                	push   $0x0
+f01038f0:	03 43 08             	add    0x8(%ebx),%eax
+f01038f3:	50                   	push   %eax
+f01038f4:	e8 96 3e 00 00       	call   f010778f <memset>
+f01038f9:	83 c4 10             	add    $0x10,%esp
+	for (seg = e->env_segs; ph < eph; ph++) {
+f01038fc:	83 c3 20             	add    $0x20,%ebx
+f01038ff:	39 fb                	cmp    %edi,%ebx
+f0103901:	73 69                	jae    f010396c <env_create+0x137>
+		if (ph->p_type != ELF_PROG_LOAD)
+f0103903:	83 3b 01             	cmpl   $0x1,(%ebx)
+f0103906:	75 f4                	jne    f01038fc <env_create+0xc7>
+		if (seg < e->env_segs + NSEGS) {
+f0103908:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010390b:	39 c6                	cmp    %eax,%esi
+f010390d:	73 b0                	jae    f01038bf <env_create+0x8a>
+			seg->seg_va = ROUNDDOWN(ph->p_va, PGSIZE);
+f010390f:	8b 43 08             	mov    0x8(%ebx),%eax
+f0103912:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0103917:	89 06                	mov    %eax,(%esi)
+			seg->seg_memsz = ph->p_memsz + PGOFF(ph->p_va);
+f0103919:	8b 43 08             	mov    0x8(%ebx),%eax
+f010391c:	25 ff 0f 00 00       	and    $0xfff,%eax
+f0103921:	03 43 14             	add    0x14(%ebx),%eax
+f0103924:	89 46 04             	mov    %eax,0x4(%esi)
+			seg->seg_filesz = ph->p_filesz + PGOFF(ph->p_va);
+f0103927:	8b 43 08             	mov    0x8(%ebx),%eax
+f010392a:	25 ff 0f 00 00       	and    $0xfff,%eax
+f010392f:	03 43 10             	add    0x10(%ebx),%eax
+f0103932:	89 46 08             	mov    %eax,0x8(%esi)
+			seg->seg_offset = ph->p_offset - PGOFF(ph->p_va);
+f0103935:	8b 53 08             	mov    0x8(%ebx),%edx
+f0103938:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+f010393e:	8b 43 04             	mov    0x4(%ebx),%eax
+f0103941:	29 d0                	sub    %edx,%eax
+f0103943:	89 46 0c             	mov    %eax,0xc(%esi)
+			seg->seg_perm = PTE_P|PTE_U;
+f0103946:	c7 46 10 05 00 00 00 	movl   $0x5,0x10(%esi)
+			if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+f010394d:	8b 43 18             	mov    0x18(%ebx),%eax
+f0103950:	83 e0 02             	and    $0x2,%eax
+				seg->seg_perm |= PTE_W;
+f0103953:	83 f8 01             	cmp    $0x1,%eax
+f0103956:	19 c0                	sbb    %eax,%eax
+f0103958:	83 e0 fe             	and    $0xfffffffe,%eax
+f010395b:	83 c0 07             	add    $0x7,%eax
+f010395e:	89 46 10             	mov    %eax,0x10(%esi)
+			seg->seg_binary = binary;
+f0103961:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103964:	89 46 1c             	mov    %eax,0x1c(%esi)
+			seg++;
+f0103967:	83 c6 20             	add    $0x20,%esi
+f010396a:	eb 90                	jmp    f01038fc <env_create+0xc7>
+	e->env_tf.tf_eip = (uintptr_t)elfhdr->e_entry;
+f010396c:	8b 45 08             	mov    0x8(%ebp),%eax
+f010396f:	8b 40 18             	mov    0x18(%eax),%eax
+f0103972:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0103975:	89 41 30             	mov    %eax,0x30(%ecx)
+	lcr3(PADDR(kern_pgdir));    // switch back to the kernel's pgdir
+f0103978:	a1 58 a0 85 f0       	mov    0xf085a058,%eax
+	if ((uint32_t)kva < KERNBASE)
+f010397d:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103982:	76 3c                	jbe    f01039c0 <env_create+0x18b>
+	return (physaddr_t)kva - KERNBASE;
+f0103984:	05 00 00 00 10       	add    $0x10000000,%eax
+f0103989:	0f 22 d8             	mov    %eax,%cr3
+	region_alloc(e, (void *)(USTACKTOP - PGSIZE), (size_t)PGSIZE);
+f010398c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+f0103991:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+f0103996:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f0103999:	89 f8                	mov    %edi,%eax
+f010399b:	e8 44 fa ff ff       	call   f01033e4 <region_alloc>
+	newenv->env_type = type;
+f01039a0:	8b 45 10             	mov    0x10(%ebp),%eax
+f01039a3:	89 47 50             	mov    %eax,0x50(%edi)
+	if (type == ENV_TYPE_FS || type == ENV_TYPE_PAGE) {
+f01039a6:	83 e8 01             	sub    $0x1,%eax
+f01039a9:	83 f8 01             	cmp    $0x1,%eax
+f01039ac:	76 27                	jbe    f01039d5 <env_create+0x1a0>
+	else if (type == ENV_TYPE_PAGE)
+f01039ae:	83 7d 10 02          	cmpl   $0x2,0x10(%ebp)
+f01039b2:	0f 84 b3 00 00 00    	je     f0103a6b <env_create+0x236>
+}
+f01039b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01039bb:	5b                   	pop    %ebx
+f01039bc:	5e                   	pop    %esi
+f01039bd:	5f                   	pop    %edi
+f01039be:	5d                   	pop    %ebp
+f01039bf:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01039c0:	50                   	push   %eax
+f01039c1:	68 08 86 10 f0       	push   $0xf0108608
+f01039c6:	68 c5 01 00 00       	push   $0x1c5
+f01039cb:	68 d6 98 10 f0       	push   $0xf01098d6
+f01039d0:	e8 6b c6 ff ff       	call   f0100040 <_panic>
+		newenv->env_tf.tf_eflags |= FL_IOPL_3;
+f01039d5:	81 4f 38 00 30 00 00 	orl    $0x3000,0x38(%edi)
+		if (!ide_locks) {
+f01039dc:	83 3d 00 94 85 f0 00 	cmpl   $0x0,0xf0859400
+f01039e3:	74 3b                	je     f0103a20 <env_create+0x1eb>
+		if (page_insert(newenv->env_pgdir, ide_locks, (void *) UIDELOCKS,
+f01039e5:	83 ec 0c             	sub    $0xc,%esp
+f01039e8:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f01039eb:	8d 41 64             	lea    0x64(%ecx),%eax
+f01039ee:	50                   	push   %eax
+f01039ef:	68 07 06 00 00       	push   $0x607
+f01039f4:	68 00 c0 ad de       	push   $0xdeadc000
+f01039f9:	ff 35 00 94 85 f0    	push   0xf0859400
+f01039ff:	ff 71 60             	push   0x60(%ecx)
+f0103a02:	e8 71 ec ff ff       	call   f0102678 <page_insert>
+f0103a07:	83 c4 20             	add    $0x20,%esp
+f0103a0a:	85 c0                	test   %eax,%eax
+f0103a0c:	78 46                	js     f0103a54 <env_create+0x21f>
+	if (type == ENV_TYPE_FS)
+f0103a0e:	83 7d 10 01          	cmpl   $0x1,0x10(%ebp)
+f0103a12:	75 9a                	jne    f01039ae <env_create+0x179>
+		newenv->env_rss_min = ENV_RSS_MIN_FS;
+f0103a14:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103a17:	c7 40 68 00 02 00 00 	movl   $0x200,0x68(%eax)
+f0103a1e:	eb 98                	jmp    f01039b8 <env_create+0x183>
+			if (!(ide_locks = page_alloc(ALLOC_ZERO)))
+f0103a20:	83 ec 0c             	sub    $0xc,%esp
+f0103a23:	6a 01                	push   $0x1
+f0103a25:	e8 c6 dc ff ff       	call   f01016f0 <page_alloc>
+f0103a2a:	a3 00 94 85 f0       	mov    %eax,0xf0859400
+f0103a2f:	83 c4 10             	add    $0x10,%esp
+f0103a32:	85 c0                	test   %eax,%eax
+f0103a34:	74 07                	je     f0103a3d <env_create+0x208>
+			ide_locks->pp_ref++;
+f0103a36:	66 83 40 0a 01       	addw   $0x1,0xa(%eax)
+f0103a3b:	eb a8                	jmp    f01039e5 <env_create+0x1b0>
+				panic("env_create: out of memory for the IDE locks");
+f0103a3d:	83 ec 04             	sub    $0x4,%esp
+f0103a40:	68 54 98 10 f0       	push   $0xf0109854
+f0103a45:	68 eb 01 00 00       	push   $0x1eb
+f0103a4a:	68 d6 98 10 f0       	push   $0xf01098d6
+f0103a4f:	e8 ec c5 ff ff       	call   f0100040 <_panic>
+			panic("env_create: out of memory mapping the IDE locks");
+f0103a54:	83 ec 04             	sub    $0x4,%esp
+f0103a57:	68 80 98 10 f0       	push   $0xf0109880
+f0103a5c:	68 f0 01 00 00       	push   $0x1f0
+f0103a61:	68 d6 98 10 f0       	push   $0xf01098d6
+f0103a66:	e8 d5 c5 ff ff       	call   f0100040 <_panic>
+		newenv->env_rss_min = ENV_RSS_MIN_PAGE;
+f0103a6b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103a6e:	c7 40 68 80 00 00 00 	movl   $0x80,0x68(%eax)
+}
+f0103a75:	e9 3e ff ff ff       	jmp    f01039b8 <env_create+0x183>
+
+f0103a7a <env_pagein_cancel>:
+{
+f0103a7a:	55                   	push   %ebp
+f0103a7b:	89 e5                	mov    %esp,%ebp
+f0103a7d:	53                   	push   %ebx
+f0103a7e:	83 ec 04             	sub    $0x4,%esp
+f0103a81:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (e->env_ipc_page && e->env_ipc_page->pp_ref == 0)
+f0103a84:	8b 83 94 00 00 00    	mov    0x94(%ebx),%eax
+f0103a8a:	85 c0                	test   %eax,%eax
+f0103a8c:	74 07                	je     f0103a95 <env_pagein_cancel+0x1b>
+f0103a8e:	66 83 78 0a 00       	cmpw   $0x0,0xa(%eax)
+f0103a93:	74 24                	je     f0103ab9 <env_pagein_cancel+0x3f>
+	e->env_ipc_page = NULL;
+f0103a95:	c7 83 94 00 00 00 00 	movl   $0x0,0x94(%ebx)
+f0103a9c:	00 00 00 
+	e->env_pagein_pager = 0;
+f0103a9f:	c7 83 34 01 00 00 00 	movl   $0x0,0x134(%ebx)
+f0103aa6:	00 00 00 
+	e->env_ipc_recving = 0;
+f0103aa9:	c6 43 78 00          	movb   $0x0,0x78(%ebx)
+	e->env_status = ENV_RUNNABLE;
+f0103aad:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+}
+f0103ab4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103ab7:	c9                   	leave
+f0103ab8:	c3                   	ret
+		page_free(e->env_ipc_page);
+f0103ab9:	83 ec 0c             	sub    $0xc,%esp
+f0103abc:	50                   	push   %eax
+f0103abd:	e8 74 dd ff ff       	call   f0101836 <page_free>
+f0103ac2:	83 c4 10             	add    $0x10,%esp
+f0103ac5:	eb ce                	jmp    f0103a95 <env_pagein_cancel+0x1b>
+
+f0103ac7 <env_segment_fault>:
+{
+f0103ac7:	55                   	push   %ebp
+f0103ac8:	89 e5                	mov    %esp,%ebp
+f0103aca:	57                   	push   %edi
+f0103acb:	56                   	push   %esi
+f0103acc:	53                   	push   %ebx
+f0103acd:	83 ec 2c             	sub    $0x2c,%esp
+f0103ad0:	8b 7d 08             	mov    0x8(%ebp),%edi
+	va = ROUNDDOWN(va, PGSIZE);
+f0103ad3:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0103ad6:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	for (seg = e->env_segs; seg < e->env_segs + NSEGS; seg++)
+f0103adc:	8d 9f b4 00 00 00    	lea    0xb4(%edi),%ebx
+f0103ae2:	8d 97 34 01 00 00    	lea    0x134(%edi),%edx
+f0103ae8:	eb 03                	jmp    f0103aed <env_segment_fault+0x26>
+f0103aea:	83 c3 20             	add    $0x20,%ebx
+f0103aed:	39 d3                	cmp    %edx,%ebx
+f0103aef:	0f 84 a2 00 00 00    	je     f0103b97 <env_segment_fault+0xd0>
+		if (va >= seg->seg_va && va - seg->seg_va < seg->seg_memsz)
+f0103af5:	8b 03                	mov    (%ebx),%eax
+f0103af7:	39 c6                	cmp    %eax,%esi
+f0103af9:	72 ef                	jb     f0103aea <env_segment_fault+0x23>
+f0103afb:	89 f1                	mov    %esi,%ecx
+f0103afd:	29 c1                	sub    %eax,%ecx
+f0103aff:	3b 4b 04             	cmp    0x4(%ebx),%ecx
+f0103b02:	73 e6                	jae    f0103aea <env_segment_fault+0x23>
+	n = seg->seg_filesz > va - seg->seg_va ? MIN(PGSIZE, seg->seg_filesz - (va - seg->seg_va)) : 0;
+f0103b04:	8b 43 08             	mov    0x8(%ebx),%eax
+f0103b07:	8b 13                	mov    (%ebx),%edx
+f0103b09:	89 f1                	mov    %esi,%ecx
+f0103b0b:	29 d1                	sub    %edx,%ecx
+f0103b0d:	39 c1                	cmp    %eax,%ecx
+f0103b0f:	0f 83 83 02 00 00    	jae    f0103d98 <env_segment_fault+0x2d1>
+f0103b15:	01 d0                	add    %edx,%eax
+	if (n == 0 || seg->seg_binary) {
+f0103b17:	29 f0                	sub    %esi,%eax
+f0103b19:	0f 84 ca 02 00 00    	je     f0103de9 <env_segment_fault+0x322>
+	n = seg->seg_filesz > va - seg->seg_va ? MIN(PGSIZE, seg->seg_filesz - (va - seg->seg_va)) : 0;
+f0103b1f:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0103b24:	39 d0                	cmp    %edx,%eax
+f0103b26:	0f 46 d0             	cmovbe %eax,%edx
+f0103b29:	89 55 d0             	mov    %edx,-0x30(%ebp)
+	if (n == 0 || seg->seg_binary) {
+f0103b2c:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+f0103b30:	0f 84 95 00 00 00    	je     f0103bcb <env_segment_fault+0x104>
+		if (!(p = page_alloc(ALLOC_ZERO)))
+f0103b36:	83 ec 0c             	sub    $0xc,%esp
+f0103b39:	6a 01                	push   $0x1
+f0103b3b:	e8 b0 db ff ff       	call   f01016f0 <page_alloc>
+f0103b40:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0103b43:	83 c4 10             	add    $0x10,%esp
+f0103b46:	85 c0                	test   %eax,%eax
+f0103b48:	0f 84 43 02 00 00    	je     f0103d91 <env_segment_fault+0x2ca>
+			memmove(page2kva(p), seg->seg_binary + seg->seg_offset + (va - seg->seg_va), n);
+f0103b4e:	89 f2                	mov    %esi,%edx
+f0103b50:	03 53 0c             	add    0xc(%ebx),%edx
+f0103b53:	2b 13                	sub    (%ebx),%edx
+f0103b55:	03 53 1c             	add    0x1c(%ebx),%edx
+	return (pp - pages) << PGSHIFT;
+f0103b58:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103b5b:	2b 05 60 a0 85 f0    	sub    0xf085a060,%eax
+f0103b61:	c1 f8 02             	sar    $0x2,%eax
+f0103b64:	69 c0 b7 6d db b6    	imul   $0xb6db6db7,%eax,%eax
+f0103b6a:	89 c1                	mov    %eax,%ecx
+f0103b6c:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0103b6f:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103b74:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f0103b7a:	73 25                	jae    f0103ba1 <env_segment_fault+0xda>
+f0103b7c:	83 ec 04             	sub    $0x4,%esp
+f0103b7f:	ff 75 d0             	push   -0x30(%ebp)
+f0103b82:	52                   	push   %edx
+	return (void *)(pa + KERNBASE);
+f0103b83:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f0103b89:	51                   	push   %ecx
+f0103b8a:	e8 35 3c 00 00       	call   f01077c4 <memmove>
+f0103b8f:	83 c4 10             	add    $0x10,%esp
+f0103b92:	e9 15 02 00 00       	jmp    f0103dac <env_segment_fault+0x2e5>
+		return -E_INVAL;
+f0103b97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0103b9c:	e9 40 02 00 00       	jmp    f0103de1 <env_segment_fault+0x31a>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103ba1:	51                   	push   %ecx
+f0103ba2:	68 e4 85 10 f0       	push   $0xf01085e4
+f0103ba7:	6a 6c                	push   $0x6c
+f0103ba9:	68 87 94 10 f0       	push   $0xf0109487
+f0103bae:	e8 8d c4 ff ff       	call   f0100040 <_panic>
+			page_free(p);
+f0103bb3:	83 ec 0c             	sub    $0xc,%esp
+f0103bb6:	ff 75 d4             	push   -0x2c(%ebp)
+f0103bb9:	e8 78 dc ff ff       	call   f0101836 <page_free>
+			return -E_NO_MEM;
+f0103bbe:	83 c4 10             	add    $0x10,%esp
+f0103bc1:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0103bc6:	e9 16 02 00 00       	jmp    f0103de1 <env_segment_fault+0x31a>
+	if (envid2env(seg->seg_pager, &pager, 0) < 0)
+f0103bcb:	83 ec 04             	sub    $0x4,%esp
+f0103bce:	6a 00                	push   $0x0
+f0103bd0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0103bd3:	50                   	push   %eax
+f0103bd4:	ff 73 14             	push   0x14(%ebx)
+f0103bd7:	e8 ef f8 ff ff       	call   f01034cb <envid2env>
+f0103bdc:	83 c4 10             	add    $0x10,%esp
+f0103bdf:	85 c0                	test   %eax,%eax
+f0103be1:	0f 88 95 01 00 00    	js     f0103d7c <env_segment_fault+0x2b5>
+	if (!(p = page_alloc(ALLOC_ZERO)))
+f0103be7:	83 ec 0c             	sub    $0xc,%esp
+f0103bea:	6a 01                	push   $0x1
+f0103bec:	e8 ff da ff ff       	call   f01016f0 <page_alloc>
+f0103bf1:	83 c4 10             	add    $0x10,%esp
+f0103bf4:	85 c0                	test   %eax,%eax
+f0103bf6:	0f 84 87 01 00 00    	je     f0103d83 <env_segment_fault+0x2bc>
+	return (pp - pages) << PGSHIFT;
+f0103bfc:	89 c2                	mov    %eax,%edx
+f0103bfe:	2b 15 60 a0 85 f0    	sub    0xf085a060,%edx
+f0103c04:	c1 fa 02             	sar    $0x2,%edx
+f0103c07:	69 d2 b7 6d db b6    	imul   $0xb6db6db7,%edx,%edx
+f0103c0d:	89 d1                	mov    %edx,%ecx
+f0103c0f:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0103c12:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f0103c18:	3b 15 54 a0 85 f0    	cmp    0xf085a054,%edx
+f0103c1e:	0f 83 ac 00 00 00    	jae    f0103cd0 <env_segment_fault+0x209>
+	return (void *)(pa + KERNBASE);
+f0103c24:	8d 91 00 00 00 f0    	lea    -0x10000000(%ecx),%edx
+f0103c2a:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	req->pagein.req_fileid = seg->seg_fileid;
+f0103c2d:	8b 53 18             	mov    0x18(%ebx),%edx
+f0103c30:	89 91 00 00 00 f0    	mov    %edx,-0x10000000(%ecx)
+	req->pagein.req_offset = seg->seg_offset + (va - seg->seg_va);
+f0103c36:	89 f1                	mov    %esi,%ecx
+f0103c38:	03 4b 0c             	add    0xc(%ebx),%ecx
+f0103c3b:	2b 0b                	sub    (%ebx),%ecx
+f0103c3d:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0103c40:	89 4a 04             	mov    %ecx,0x4(%edx)
+	req->pagein.req_n = n;
+f0103c43:	8b 55 d0             	mov    -0x30(%ebp),%edx
+f0103c46:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0103c49:	89 51 08             	mov    %edx,0x8(%ecx)
+	req->pagein.req_perm = seg->seg_perm;
+f0103c4c:	8b 4b 10             	mov    0x10(%ebx),%ecx
+		req->pagein.req_perm = (seg->seg_perm & ~PTE_W) | PTE_COW;
+f0103c4f:	89 cb                	mov    %ecx,%ebx
+f0103c51:	81 e3 fd f7 ff ff    	and    $0xfffff7fd,%ebx
+f0103c57:	80 cf 08             	or     $0x8,%bh
+f0103c5a:	f6 c1 02             	test   $0x2,%cl
+f0103c5d:	0f 45 cb             	cmovne %ebx,%ecx
+	req->pagein.req_perm = seg->seg_perm;
+f0103c60:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0103c63:	89 4a 0c             	mov    %ecx,0xc(%edx)
+	e->env_pagein_pager = pager->env_id;
+f0103c66:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0103c69:	8b 53 48             	mov    0x48(%ebx),%edx
+f0103c6c:	89 97 34 01 00 00    	mov    %edx,0x134(%edi)
+	e->env_ipc_recving = 1;
+f0103c72:	c6 47 78 01          	movb   $0x1,0x78(%edi)
+	e->env_ipc_dstva = (void *) va;
+f0103c76:	89 77 7c             	mov    %esi,0x7c(%edi)
+	e->env_status = ENV_NOT_RUNNABLE;
+f0103c79:	c7 47 54 04 00 00 00 	movl   $0x4,0x54(%edi)
+	e->env_ipc_page = p;
+f0103c80:	89 87 94 00 00 00    	mov    %eax,0x94(%edi)
+	e->env_ipc_value_sending = FSREQ_PAGEIN;
+f0103c86:	c7 87 a0 00 00 00 09 	movl   $0x9,0xa0(%edi)
+f0103c8d:	00 00 00 
+	e->env_ipc_perm_sending = PTE_P|PTE_U|PTE_W;
+f0103c90:	c7 87 a4 00 00 00 07 	movl   $0x7,0xa4(%edi)
+f0103c97:	00 00 00 
+	if (pager->env_ipc_recving && pager->env_status == ENV_NOT_RUNNABLE && !pager->env_pagein_pager) {
+f0103c9a:	80 7b 78 00          	cmpb   $0x0,0x78(%ebx)
+f0103c9e:	74 06                	je     f0103ca6 <env_segment_fault+0x1df>
+f0103ca0:	83 7b 54 04          	cmpl   $0x4,0x54(%ebx)
+f0103ca4:	74 3c                	je     f0103ce2 <env_segment_fault+0x21b>
+	} else if (!pager->env_ipc_blocked_sender) {
+f0103ca6:	8b 83 ac 00 00 00    	mov    0xac(%ebx),%eax
+f0103cac:	85 c0                	test   %eax,%eax
+f0103cae:	0f 84 bb 00 00 00    	je     f0103d6f <env_segment_fault+0x2a8>
+		for (s = pager->env_ipc_blocked_sender; s->env_ipc_blocked_sender_chain; s = s->env_ipc_blocked_sender_chain) ;
+f0103cb4:	89 c2                	mov    %eax,%edx
+f0103cb6:	8b 80 b0 00 00 00    	mov    0xb0(%eax),%eax
+f0103cbc:	85 c0                	test   %eax,%eax
+f0103cbe:	75 f4                	jne    f0103cb4 <env_segment_fault+0x1ed>
+		s->env_ipc_blocked_sender_chain = e;
+f0103cc0:	89 ba b0 00 00 00    	mov    %edi,0xb0(%edx)
+	return 1;
+f0103cc6:	b8 01 00 00 00       	mov    $0x1,%eax
+f0103ccb:	e9 11 01 00 00       	jmp    f0103de1 <env_segment_fault+0x31a>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103cd0:	51                   	push   %ecx
+f0103cd1:	68 e4 85 10 f0       	push   $0xf01085e4
+f0103cd6:	6a 6c                	push   $0x6c
+f0103cd8:	68 87 94 10 f0       	push   $0xf0109487
+f0103cdd:	e8 5e c3 ff ff       	call   f0100040 <_panic>
+	if (pager->env_ipc_recving && pager->env_status == ENV_NOT_RUNNABLE && !pager->env_pagein_pager) {
+f0103ce2:	83 bb 34 01 00 00 00 	cmpl   $0x0,0x134(%ebx)
+f0103ce9:	75 bb                	jne    f0103ca6 <env_segment_fault+0x1df>
+		if ((uint32_t) pager->env_ipc_dstva < UTOP &&
+f0103ceb:	8b 53 7c             	mov    0x7c(%ebx),%edx
+f0103cee:	81 fa ff ff bf ee    	cmp    $0xeebfffff,%edx
+f0103cf4:	76 4c                	jbe    f0103d42 <env_segment_fault+0x27b>
+		pager->env_ipc_recving = 0;
+f0103cf6:	c6 43 78 00          	movb   $0x0,0x78(%ebx)
+		pager->env_ipc_from = e->env_id;
+f0103cfa:	8b 47 48             	mov    0x48(%edi),%eax
+f0103cfd:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+		pager->env_ipc_value = FSREQ_PAGEIN;
+f0103d03:	c7 83 84 00 00 00 09 	movl   $0x9,0x84(%ebx)
+f0103d0a:	00 00 00 
+		pager->env_ipc_perm = PTE_P|PTE_U|PTE_W;
+f0103d0d:	c7 83 8c 00 00 00 07 	movl   $0x7,0x8c(%ebx)
+f0103d14:	00 00 00 
+		pager->env_ipc_npages = (uint32_t) pager->env_ipc_dstva < UTOP;
+f0103d17:	81 7b 7c ff ff bf ee 	cmpl   $0xeebfffff,0x7c(%ebx)
+f0103d1e:	0f 96 c0             	setbe  %al
+f0103d21:	0f b6 c0             	movzbl %al,%eax
+f0103d24:	89 83 90 00 00 00    	mov    %eax,0x90(%ebx)
+		pager->env_tf.tf_regs.reg_eax = 0;
+f0103d2a:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+		pager->env_status = ENV_RUNNABLE;
+f0103d31:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+	return 1;
+f0103d38:	b8 01 00 00 00       	mov    $0x1,%eax
+		pager->env_status = ENV_RUNNABLE;
+f0103d3d:	e9 9f 00 00 00       	jmp    f0103de1 <env_segment_fault+0x31a>
+		    page_insert(pager->env_pgdir, p, pager->env_ipc_dstva, PTE_P|PTE_U|PTE_W, &pager->env_npages) < 0) {
+f0103d42:	83 ec 0c             	sub    $0xc,%esp
+f0103d45:	8d 4b 64             	lea    0x64(%ebx),%ecx
+f0103d48:	51                   	push   %ecx
+f0103d49:	6a 07                	push   $0x7
+f0103d4b:	52                   	push   %edx
+f0103d4c:	50                   	push   %eax
+f0103d4d:	ff 73 60             	push   0x60(%ebx)
+f0103d50:	e8 23 e9 ff ff       	call   f0102678 <page_insert>
+		if ((uint32_t) pager->env_ipc_dstva < UTOP &&
+f0103d55:	83 c4 20             	add    $0x20,%esp
+f0103d58:	85 c0                	test   %eax,%eax
+f0103d5a:	79 9a                	jns    f0103cf6 <env_segment_fault+0x22f>
+			env_pagein_cancel(e);
+f0103d5c:	83 ec 0c             	sub    $0xc,%esp
+f0103d5f:	57                   	push   %edi
+f0103d60:	e8 15 fd ff ff       	call   f0103a7a <env_pagein_cancel>
+			return -E_NO_MEM;
+f0103d65:	83 c4 10             	add    $0x10,%esp
+f0103d68:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0103d6d:	eb 72                	jmp    f0103de1 <env_segment_fault+0x31a>
+		pager->env_ipc_blocked_sender = e;
+f0103d6f:	89 bb ac 00 00 00    	mov    %edi,0xac(%ebx)
+	return 1;
+f0103d75:	b8 01 00 00 00       	mov    $0x1,%eax
+f0103d7a:	eb 65                	jmp    f0103de1 <env_segment_fault+0x31a>
+		return -E_BAD_ENV;
+f0103d7c:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103d81:	eb 5e                	jmp    f0103de1 <env_segment_fault+0x31a>
+		return -E_NO_MEM;
+f0103d83:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0103d88:	eb 57                	jmp    f0103de1 <env_segment_fault+0x31a>
+			return -E_NO_MEM;
+f0103d8a:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0103d8f:	eb 50                	jmp    f0103de1 <env_segment_fault+0x31a>
+f0103d91:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0103d96:	eb 49                	jmp    f0103de1 <env_segment_fault+0x31a>
+		if (!(p = page_alloc(ALLOC_ZERO)))
+f0103d98:	83 ec 0c             	sub    $0xc,%esp
+f0103d9b:	6a 01                	push   $0x1
+f0103d9d:	e8 4e d9 ff ff       	call   f01016f0 <page_alloc>
+f0103da2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0103da5:	83 c4 10             	add    $0x10,%esp
+f0103da8:	85 c0                	test   %eax,%eax
+f0103daa:	74 de                	je     f0103d8a <env_segment_fault+0x2c3>
+		if (page_insert(e->env_pgdir, p, (void *) va, seg->seg_perm, &e->env_npages) < 0) {
+f0103dac:	83 ec 0c             	sub    $0xc,%esp
+f0103daf:	8d 47 64             	lea    0x64(%edi),%eax
+f0103db2:	50                   	push   %eax
+f0103db3:	ff 73 10             	push   0x10(%ebx)
+f0103db6:	56                   	push   %esi
+f0103db7:	ff 75 d4             	push   -0x2c(%ebp)
+f0103dba:	ff 77 60             	push   0x60(%edi)
+f0103dbd:	e8 b6 e8 ff ff       	call   f0102678 <page_insert>
+f0103dc2:	83 c4 20             	add    $0x20,%esp
+f0103dc5:	85 c0                	test   %eax,%eax
+f0103dc7:	0f 88 e6 fd ff ff    	js     f0103bb3 <env_segment_fault+0xec>
+		page_clean(e->env_pgdir, (void *) va);
+f0103dcd:	83 ec 08             	sub    $0x8,%esp
+f0103dd0:	56                   	push   %esi
+f0103dd1:	ff 77 60             	push   0x60(%edi)
+f0103dd4:	e8 61 ec ff ff       	call   f0102a3a <page_clean>
+		return 0;
+f0103dd9:	83 c4 10             	add    $0x10,%esp
+f0103ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0103de1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103de4:	5b                   	pop    %ebx
+f0103de5:	5e                   	pop    %esi
+f0103de6:	5f                   	pop    %edi
+f0103de7:	5d                   	pop    %ebp
+f0103de8:	c3                   	ret
+		if (!(p = page_alloc(ALLOC_ZERO)))
+f0103de9:	83 ec 0c             	sub    $0xc,%esp
+f0103dec:	6a 01                	push   $0x1
+f0103dee:	e8 fd d8 ff ff       	call   f01016f0 <page_alloc>
+f0103df3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0103df6:	83 c4 10             	add    $0x10,%esp
+f0103df9:	85 c0                	test   %eax,%eax
+f0103dfb:	75 af                	jne    f0103dac <env_segment_fault+0x2e5>
+			return -E_NO_MEM;
+f0103dfd:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0103e02:	eb dd                	jmp    f0103de1 <env_segment_fault+0x31a>
+
+f0103e04 <env_futex_wait>:
+{
+f0103e04:	55                   	push   %ebp
+f0103e05:	89 e5                	mov    %esp,%ebp
+f0103e07:	53                   	push   %ebx
+f0103e08:	83 ec 04             	sub    $0x4,%esp
+f0103e0b:	8b 55 08             	mov    0x8(%ebp),%edx
+f0103e0e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Env **q = FUTEX_QUEUE(pa);
+f0103e11:	89 d8                	mov    %ebx,%eax
+f0103e13:	c1 e8 0c             	shr    $0xc,%eax
+f0103e16:	89 c1                	mov    %eax,%ecx
+f0103e18:	83 e1 3f             	and    $0x3f,%ecx
+	e->env_futex_addr = pa;
+f0103e1b:	89 9a 38 01 00 00    	mov    %ebx,0x138(%edx)
+	e->env_futex_link = *q;
+f0103e21:	8b 1c 8d 00 93 85 f0 	mov    -0xf7a6d00(,%ecx,4),%ebx
+f0103e28:	89 9a 3c 01 00 00    	mov    %ebx,0x13c(%edx)
+	*q = e;
+f0103e2e:	89 14 8d 00 93 85 f0 	mov    %edx,-0xf7a6d00(,%ecx,4)
+	if (PGNUM(pa) >= npages)
+f0103e35:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f0103e3b:	73 1a                	jae    f0103e57 <env_futex_wait+0x53>
+	return &pages[PGNUM(pa)];
+f0103e3d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+f0103e40:	03 05 60 a0 85 f0    	add    0xf085a060,%eax
+	pa2page(pa)->pp_futex_waiters++;
+f0103e46:	66 83 40 0c 01       	addw   $0x1,0xc(%eax)
+	e->env_status = ENV_NOT_RUNNABLE;
+f0103e4b:	c7 42 54 04 00 00 00 	movl   $0x4,0x54(%edx)
+}
+f0103e52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103e55:	c9                   	leave
+f0103e56:	c3                   	ret
+		panic("pa2page called with invalid pa");
+f0103e57:	83 ec 04             	sub    $0x4,%esp
+f0103e5a:	68 98 95 10 f0       	push   $0xf0109598
+f0103e5f:	6a 65                	push   $0x65
+f0103e61:	68 87 94 10 f0       	push   $0xf0109487
+f0103e66:	e8 d5 c1 ff ff       	call   f0100040 <_panic>
+
+f0103e6b <env_futex_wake>:
+// [pa, pa + len), which must be within one page.
+// Returns the number woken.
+//
+int
+env_futex_wake(physaddr_t pa, size_t len, int n)
+{
+f0103e6b:	55                   	push   %ebp
+f0103e6c:	89 e5                	mov    %esp,%ebp
+f0103e6e:	57                   	push   %edi
+f0103e6f:	56                   	push   %esi
+f0103e70:	53                   	push   %ebx
+f0103e71:	83 ec 1c             	sub    $0x1c,%esp
+	struct Env **ep = FUTEX_QUEUE(pa), *e;
+f0103e74:	8b 75 08             	mov    0x8(%ebp),%esi
+f0103e77:	c1 ee 0a             	shr    $0xa,%esi
+f0103e7a:	81 e6 fc 00 00 00    	and    $0xfc,%esi
+f0103e80:	81 c6 00 93 85 f0    	add    $0xf0859300,%esi
+	int woken = 0;
+f0103e86:	bf 00 00 00 00       	mov    $0x0,%edi
+
+	while ((e = *ep) && woken < n) {
+		if (e->env_futex_addr < pa || e->env_futex_addr >= pa + len) {
+f0103e8b:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103e8e:	03 45 0c             	add    0xc(%ebp),%eax
+f0103e91:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	while ((e = *ep) && woken < n) {
+f0103e94:	eb 06                	jmp    f0103e9c <env_futex_wake+0x31>
+			ep = &e->env_futex_link;
+f0103e96:	8d b3 3c 01 00 00    	lea    0x13c(%ebx),%esi
+	while ((e = *ep) && woken < n) {
+f0103e9c:	8b 1e                	mov    (%esi),%ebx
+f0103e9e:	3b 7d 10             	cmp    0x10(%ebp),%edi
+f0103ea1:	7d 31                	jge    f0103ed4 <env_futex_wake+0x69>
+f0103ea3:	85 db                	test   %ebx,%ebx
+f0103ea5:	74 2d                	je     f0103ed4 <env_futex_wake+0x69>
+		if (e->env_futex_addr < pa || e->env_futex_addr >= pa + len) {
+f0103ea7:	8b 83 38 01 00 00    	mov    0x138(%ebx),%eax
+f0103ead:	3b 45 08             	cmp    0x8(%ebp),%eax
+f0103eb0:	72 e4                	jb     f0103e96 <env_futex_wake+0x2b>
+f0103eb2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0103eb5:	39 d0                	cmp    %edx,%eax
+f0103eb7:	73 dd                	jae    f0103e96 <env_futex_wake+0x2b>
+			continue;
+		}
+		env_futex_unlink(ep);
+f0103eb9:	89 f0                	mov    %esi,%eax
+f0103ebb:	e8 b6 f5 ff ff       	call   f0103476 <env_futex_unlink>
+		if (e->env_status == ENV_NOT_RUNNABLE)
+f0103ec0:	83 7b 54 04          	cmpl   $0x4,0x54(%ebx)
+f0103ec4:	74 05                	je     f0103ecb <env_futex_wake+0x60>
+			e->env_status = ENV_RUNNABLE;
+		woken++;
+f0103ec6:	83 c7 01             	add    $0x1,%edi
+f0103ec9:	eb d1                	jmp    f0103e9c <env_futex_wake+0x31>
+			e->env_status = ENV_RUNNABLE;
+f0103ecb:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+f0103ed2:	eb f2                	jmp    f0103ec6 <env_futex_wake+0x5b>
+	}
+	return woken;
+}
+f0103ed4:	89 f8                	mov    %edi,%eax
+f0103ed6:	83 c4 1c             	add    $0x1c,%esp
+f0103ed9:	5b                   	pop    %ebx
+f0103eda:	5e                   	pop    %esi
+f0103edb:	5f                   	pop    %edi
+f0103edc:	5d                   	pop    %ebp
+f0103edd:	c3                   	ret
+
+f0103ede <env_free>:
+//
+// Frees env e and all memory it uses.
+//
+void
+env_free(struct Env *e)
+{
+f0103ede:	55                   	push   %ebp
+f0103edf:	89 e5                	mov    %esp,%ebp
+f0103ee1:	57                   	push   %edi
+f0103ee2:	56                   	push   %esi
+f0103ee3:	53                   	push   %ebx
+f0103ee4:	83 ec 1c             	sub    $0x1c,%esp
+f0103ee7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	physaddr_t pa;
+
+	// If freeing the current environment, switch to kern_pgdir
+	// before freeing the page directory, just in case the page
+	// gets reused.
+	if (e == curenv)
+f0103eea:	e8 54 3f 00 00       	call   f0107e43 <cpunum>
+f0103eef:	6b c0 74             	imul   $0x74,%eax,%eax
+f0103ef2:	39 b8 28 b0 85 f0    	cmp    %edi,-0xf7a4fd8(%eax)
+f0103ef8:	74 48                	je     f0103f42 <env_free+0x64>
+		lcr3(PADDR(kern_pgdir));
+
+	// Note the environment's demise.
+	cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
+f0103efa:	8b 5f 48             	mov    0x48(%edi),%ebx
+f0103efd:	e8 41 3f 00 00       	call   f0107e43 <cpunum>
+f0103f02:	6b c0 74             	imul   $0x74,%eax,%eax
+f0103f05:	ba 00 00 00 00       	mov    $0x0,%edx
+f0103f0a:	83 b8 28 b0 85 f0 00 	cmpl   $0x0,-0xf7a4fd8(%eax)
+f0103f11:	74 11                	je     f0103f24 <env_free+0x46>
+f0103f13:	e8 2b 3f 00 00       	call   f0107e43 <cpunum>
+f0103f18:	6b c0 74             	imul   $0x74,%eax,%eax
+f0103f1b:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0103f21:	8b 50 48             	mov    0x48(%eax),%edx
+f0103f24:	83 ec 04             	sub    $0x4,%esp
+f0103f27:	53                   	push   %ebx
+f0103f28:	52                   	push   %edx
+f0103f29:	68 13 99 10 f0       	push   $0xf0109913
+f0103f2e:	e8 b7 05 00 00       	call   f01044ea <cprintf>
+f0103f33:	83 c4 10             	add    $0x10,%esp
+f0103f36:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f0103f3d:	e9 a9 00 00 00       	jmp    f0103feb <env_free+0x10d>
+		lcr3(PADDR(kern_pgdir));
+f0103f42:	a1 58 a0 85 f0       	mov    0xf085a058,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103f47:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103f4c:	76 0a                	jbe    f0103f58 <env_free+0x7a>
+	return (physaddr_t)kva - KERNBASE;
+f0103f4e:	05 00 00 00 10       	add    $0x10000000,%eax
+f0103f53:	0f 22 d8             	mov    %eax,%cr3
+}
+f0103f56:	eb a2                	jmp    f0103efa <env_free+0x1c>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103f58:	50                   	push   %eax
+f0103f59:	68 08 86 10 f0       	push   $0xf0108608
+f0103f5e:	68 d8 02 00 00       	push   $0x2d8
+f0103f63:	68 d6 98 10 f0       	push   $0xf01098d6
+f0103f68:	e8 d3 c0 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103f6d:	56                   	push   %esi
+f0103f6e:	68 e4 85 10 f0       	push   $0xf01085e4
+f0103f73:	68 ea 02 00 00       	push   $0x2ea
+f0103f78:	68 d6 98 10 f0       	push   $0xf01098d6
+f0103f7d:	e8 be c0 ff ff       	call   f0100040 <_panic>
+		// find the pa and va of the page table
+		pa = PTE_ADDR(e->env_pgdir[pdeno]);
+		pt = (pte_t*) KADDR(pa);
+
+		// unmap all PTEs in this page table
+		for (pteno = 0; pteno <= PTX(~0); pteno++) {
+f0103f82:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103f88:	83 c6 04             	add    $0x4,%esi
+f0103f8b:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+f0103f91:	74 1d                	je     f0103fb0 <env_free+0xd2>
+			if (pt[pteno] & PTE_P)
+f0103f93:	f6 06 01             	testb  $0x1,(%esi)
+f0103f96:	74 ea                	je     f0103f82 <env_free+0xa4>
+				page_remove(e->env_pgdir, PGADDR(pdeno, pteno, 0), NULL);
+f0103f98:	83 ec 04             	sub    $0x4,%esp
+f0103f9b:	6a 00                	push   $0x0
+f0103f9d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103fa0:	09 d8                	or     %ebx,%eax
+f0103fa2:	50                   	push   %eax
+f0103fa3:	ff 77 60             	push   0x60(%edi)
+f0103fa6:	e8 63 e6 ff ff       	call   f010260e <page_remove>
+f0103fab:	83 c4 10             	add    $0x10,%esp
+f0103fae:	eb d2                	jmp    f0103f82 <env_free+0xa4>
+		}
+
+		// free the page table itself
+		e->env_pgdir[pdeno] = 0;
+f0103fb0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0103fb3:	8b 47 60             	mov    0x60(%edi),%eax
+f0103fb6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0103fb9:	c7 04 08 00 00 00 00 	movl   $0x0,(%eax,%ecx,1)
+	if (PGNUM(pa) >= npages)
+f0103fc0:	3b 15 54 a0 85 f0    	cmp    0xf085a054,%edx
+f0103fc6:	73 74                	jae    f010403c <env_free+0x15e>
+		page_decref(pa2page(pa));
+f0103fc8:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0103fcb:	6b d2 1c             	imul   $0x1c,%edx,%edx
+f0103fce:	03 15 60 a0 85 f0    	add    0xf085a060,%edx
+f0103fd4:	52                   	push   %edx
+f0103fd5:	e8 3d d9 ff ff       	call   f0101917 <page_decref>
+f0103fda:	83 c4 10             	add    $0x10,%esp
+	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+f0103fdd:	83 45 e0 04          	addl   $0x4,-0x20(%ebp)
+f0103fe1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0103fe4:	3d ec 0e 00 00       	cmp    $0xeec,%eax
+f0103fe9:	74 65                	je     f0104050 <env_free+0x172>
+		if (!(e->env_pgdir[pdeno] & PTE_P))
+f0103feb:	8b 47 60             	mov    0x60(%edi),%eax
+f0103fee:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0103ff1:	f6 04 08 01          	testb  $0x1,(%eax,%ecx,1)
+f0103ff5:	74 e6                	je     f0103fdd <env_free+0xff>
+		page_split(e->env_pgdir, PGADDR(pdeno, 0, 0));
+f0103ff7:	89 ce                	mov    %ecx,%esi
+f0103ff9:	c1 e1 14             	shl    $0x14,%ecx
+f0103ffc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f0103fff:	83 ec 08             	sub    $0x8,%esp
+f0104002:	51                   	push   %ecx
+f0104003:	50                   	push   %eax
+f0104004:	e8 fb db ff ff       	call   f0101c04 <page_split>
+		pa = PTE_ADDR(e->env_pgdir[pdeno]);
+f0104009:	8b 47 60             	mov    0x60(%edi),%eax
+f010400c:	8b 14 30             	mov    (%eax,%esi,1),%edx
+f010400f:	89 d6                	mov    %edx,%esi
+f0104011:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f0104017:	c1 ea 0c             	shr    $0xc,%edx
+f010401a:	83 c4 10             	add    $0x10,%esp
+f010401d:	3b 15 54 a0 85 f0    	cmp    0xf085a054,%edx
+f0104023:	0f 83 44 ff ff ff    	jae    f0103f6d <env_free+0x8f>
+	return (void *)(pa + KERNBASE);
+f0104029:	81 ee 00 00 00 10    	sub    $0x10000000,%esi
+f010402f:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0104034:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f0104037:	e9 57 ff ff ff       	jmp    f0103f93 <env_free+0xb5>
+		panic("pa2page called with invalid pa");
+f010403c:	83 ec 04             	sub    $0x4,%esp
+f010403f:	68 98 95 10 f0       	push   $0xf0109598
+f0104044:	6a 65                	push   $0x65
+f0104046:	68 87 94 10 f0       	push   $0xf0109487
+f010404b:	e8 f0 bf ff ff       	call   f0100040 <_panic>
+	}
+
+	// free the page directory
+	pa = PADDR(e->env_pgdir);
+f0104050:	8b 47 60             	mov    0x60(%edi),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0104053:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0104058:	76 4c                	jbe    f01040a6 <env_free+0x1c8>
+	e->env_pgdir = 0;
+f010405a:	c7 47 60 00 00 00 00 	movl   $0x0,0x60(%edi)
+	return (physaddr_t)kva - KERNBASE;
+f0104061:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f0104066:	c1 e8 0c             	shr    $0xc,%eax
+f0104069:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f010406f:	73 4a                	jae    f01040bb <env_free+0x1dd>
+	page_decref(pa2page(pa));
+f0104071:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0104074:	6b c0 1c             	imul   $0x1c,%eax,%eax
+f0104077:	03 05 60 a0 85 f0    	add    0xf085a060,%eax
+f010407d:	50                   	push   %eax
+f010407e:	e8 94 d8 ff ff       	call   f0101917 <page_decref>
+	if (!e->env_futex_addr)
+f0104083:	8b 87 38 01 00 00    	mov    0x138(%edi),%eax
+f0104089:	83 c4 10             	add    $0x10,%esp
+f010408c:	85 c0                	test   %eax,%eax
+f010408e:	74 56                	je     f01040e6 <env_free+0x208>
+	for (ep = FUTEX_QUEUE(e->env_futex_addr); *ep != e; ep = &(*ep)->env_futex_link)
+f0104090:	c1 e8 0c             	shr    $0xc,%eax
+f0104093:	83 e0 3f             	and    $0x3f,%eax
+f0104096:	8d 14 85 00 93 85 f0 	lea    -0xf7a6d00(,%eax,4),%edx
+f010409d:	8b 04 85 00 93 85 f0 	mov    -0xf7a6d00(,%eax,4),%eax
+f01040a4:	eb 35                	jmp    f01040db <env_free+0x1fd>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01040a6:	50                   	push   %eax
+f01040a7:	68 08 86 10 f0       	push   $0xf0108608
+f01040ac:	68 f8 02 00 00       	push   $0x2f8
+f01040b1:	68 d6 98 10 f0       	push   $0xf01098d6
+f01040b6:	e8 85 bf ff ff       	call   f0100040 <_panic>
+		panic("pa2page called with invalid pa");
+f01040bb:	83 ec 04             	sub    $0x4,%esp
+f01040be:	68 98 95 10 f0       	push   $0xf0109598
+f01040c3:	6a 65                	push   $0x65
+f01040c5:	68 87 94 10 f0       	push   $0xf0109487
+f01040ca:	e8 71 bf ff ff       	call   f0100040 <_panic>
+f01040cf:	8d 90 3c 01 00 00    	lea    0x13c(%eax),%edx
+f01040d5:	8b 80 3c 01 00 00    	mov    0x13c(%eax),%eax
+f01040db:	39 c7                	cmp    %eax,%edi
+f01040dd:	75 f0                	jne    f01040cf <env_free+0x1f1>
+	env_futex_unlink(ep);
+f01040df:	89 d0                	mov    %edx,%eax
+f01040e1:	e8 90 f3 ff ff       	call   f0103476 <env_futex_unlink>
+
+	// return the environment to the free list
+	env_futex_cancel(e);
+	e->env_status = ENV_FREE;
+f01040e6:	c7 47 54 00 00 00 00 	movl   $0x0,0x54(%edi)
+	e->env_link = env_free_list;
+f01040ed:	a1 04 94 85 f0       	mov    0xf0859404,%eax
+f01040f2:	89 47 44             	mov    %eax,0x44(%edi)
+	env_free_list = e;
+f01040f5:	89 3d 04 94 85 f0    	mov    %edi,0xf0859404
+	num_free_envs--;
+f01040fb:	83 2d 64 a0 85 f0 01 	subl   $0x1,0xf085a064
+
+	// wake whoever is waiting for e to exit (see lib/wait.c)
+	env_futex_wake(PADDR(&e->env_status), sizeof(e->env_status), NENV);
+f0104102:	8d 47 54             	lea    0x54(%edi),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0104105:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010410a:	76 20                	jbe    f010412c <env_free+0x24e>
+f010410c:	83 ec 04             	sub    $0x4,%esp
+f010410f:	68 00 04 00 00       	push   $0x400
+f0104114:	6a 04                	push   $0x4
+	return (physaddr_t)kva - KERNBASE;
+f0104116:	05 00 00 00 10       	add    $0x10000000,%eax
+f010411b:	50                   	push   %eax
+f010411c:	e8 4a fd ff ff       	call   f0103e6b <env_futex_wake>
+}
+f0104121:	83 c4 10             	add    $0x10,%esp
+f0104124:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104127:	5b                   	pop    %ebx
+f0104128:	5e                   	pop    %esi
+f0104129:	5f                   	pop    %edi
+f010412a:	5d                   	pop    %ebp
+f010412b:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010412c:	50                   	push   %eax
+f010412d:	68 08 86 10 f0       	push   $0xf0108608
+f0104132:	68 04 03 00 00       	push   $0x304
+f0104137:	68 d6 98 10 f0       	push   $0xf01098d6
+f010413c:	e8 ff be ff ff       	call   f0100040 <_panic>
+
+f0104141 <env_destroy>:
+// If e was the current env, then runs a new environment (and does not return
+// to the caller).
+//
+void
+env_destroy(struct Env *e)
+{
+f0104141:	55                   	push   %ebp
+f0104142:	89 e5                	mov    %esp,%ebp
+f0104144:	53                   	push   %ebx
+f0104145:	83 ec 04             	sub    $0x4,%esp
+f0104148:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	// If e is currently running on other CPUs, we change its state to
+	// ENV_DYING. A zombie environment will be freed the next time
+	// it traps to the kernel.
+	if (e->env_status == ENV_RUNNING && curenv != e) {
+f010414b:	83 7b 54 03          	cmpl   $0x3,0x54(%ebx)
+f010414f:	74 21                	je     f0104172 <env_destroy+0x31>
+		e->env_status = ENV_DYING;
+		return;
+	}
+
+	env_free(e);
+f0104151:	83 ec 0c             	sub    $0xc,%esp
+f0104154:	53                   	push   %ebx
+f0104155:	e8 84 fd ff ff       	call   f0103ede <env_free>
+
+	if (curenv == e) {
+f010415a:	e8 e4 3c 00 00       	call   f0107e43 <cpunum>
+f010415f:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104162:	83 c4 10             	add    $0x10,%esp
+f0104165:	39 98 28 b0 85 f0    	cmp    %ebx,-0xf7a4fd8(%eax)
+f010416b:	74 1e                	je     f010418b <env_destroy+0x4a>
+		curenv = NULL;
+		sched_yield();
+	}
+}
+f010416d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0104170:	c9                   	leave
+f0104171:	c3                   	ret
+	if (e->env_status == ENV_RUNNING && curenv != e) {
+f0104172:	e8 cc 3c 00 00       	call   f0107e43 <cpunum>
+f0104177:	6b c0 74             	imul   $0x74,%eax,%eax
+f010417a:	39 98 28 b0 85 f0    	cmp    %ebx,-0xf7a4fd8(%eax)
+f0104180:	74 cf                	je     f0104151 <env_destroy+0x10>
+		e->env_status = ENV_DYING;
+f0104182:	c7 43 54 01 00 00 00 	movl   $0x1,0x54(%ebx)
+		return;
+f0104189:	eb e2                	jmp    f010416d <env_destroy+0x2c>
+		curenv = NULL;
+f010418b:	e8 b3 3c 00 00       	call   f0107e43 <cpunum>
+f0104190:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104193:	c7 80 28 b0 85 f0 00 	movl   $0x0,-0xf7a4fd8(%eax)
+f010419a:	00 00 00 
+		sched_yield();
+f010419d:	e8 70 0e 00 00       	call   f0105012 <sched_yield>
+
+f01041a2 <env_pagein_done>:
+{
+f01041a2:	55                   	push   %ebp
+f01041a3:	89 e5                	mov    %esp,%ebp
+f01041a5:	53                   	push   %ebx
+f01041a6:	83 ec 04             	sub    $0x4,%esp
+f01041a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01041ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01041af:	8b 55 10             	mov    0x10(%ebp),%edx
+	e->env_pagein_pager = 0;
+f01041b2:	c7 83 34 01 00 00 00 	movl   $0x0,0x134(%ebx)
+f01041b9:	00 00 00 
+	e->env_ipc_recving = 0;
+f01041bc:	c6 43 78 00          	movb   $0x0,0x78(%ebx)
+	if (value < 0 || !pp) {
+f01041c0:	85 c0                	test   %eax,%eax
+f01041c2:	78 2a                	js     f01041ee <env_pagein_done+0x4c>
+f01041c4:	85 d2                	test   %edx,%edx
+f01041c6:	74 26                	je     f01041ee <env_pagein_done+0x4c>
+	if (page_insert(e->env_pgdir, pp, e->env_ipc_dstva, perm, &e->env_npages) == 0)
+f01041c8:	83 ec 0c             	sub    $0xc,%esp
+f01041cb:	8d 43 64             	lea    0x64(%ebx),%eax
+f01041ce:	50                   	push   %eax
+f01041cf:	ff 75 14             	push   0x14(%ebp)
+f01041d2:	ff 73 7c             	push   0x7c(%ebx)
+f01041d5:	52                   	push   %edx
+f01041d6:	ff 73 60             	push   0x60(%ebx)
+f01041d9:	e8 9a e4 ff ff       	call   f0102678 <page_insert>
+f01041de:	83 c4 20             	add    $0x20,%esp
+f01041e1:	85 c0                	test   %eax,%eax
+f01041e3:	74 34                	je     f0104219 <env_pagein_done+0x77>
+	e->env_status = ENV_RUNNABLE;
+f01041e5:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+f01041ec:	eb 26                	jmp    f0104214 <env_pagein_done+0x72>
+		cprintf("[%08x] page-in of va %08x failed: %e\n",
+f01041ee:	85 c0                	test   %eax,%eax
+f01041f0:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+f01041f5:	0f 49 c2             	cmovns %edx,%eax
+f01041f8:	50                   	push   %eax
+f01041f9:	ff 73 7c             	push   0x7c(%ebx)
+f01041fc:	ff 73 48             	push   0x48(%ebx)
+f01041ff:	68 b0 98 10 f0       	push   $0xf01098b0
+f0104204:	e8 e1 02 00 00       	call   f01044ea <cprintf>
+		env_destroy(e);
+f0104209:	89 1c 24             	mov    %ebx,(%esp)
+f010420c:	e8 30 ff ff ff       	call   f0104141 <env_destroy>
+		return;
+f0104211:	83 c4 10             	add    $0x10,%esp
+}
+f0104214:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0104217:	c9                   	leave
+f0104218:	c3                   	ret
+		page_clean(e->env_pgdir, e->env_ipc_dstva);
+f0104219:	83 ec 08             	sub    $0x8,%esp
+f010421c:	ff 73 7c             	push   0x7c(%ebx)
+f010421f:	ff 73 60             	push   0x60(%ebx)
+f0104222:	e8 13 e8 ff ff       	call   f0102a3a <page_clean>
+f0104227:	83 c4 10             	add    $0x10,%esp
+f010422a:	eb b9                	jmp    f01041e5 <env_pagein_done+0x43>
+
+f010422c <env_pop_tf>:
+//
+// This function does not return.
+//
+void
+env_pop_tf(struct Trapframe *tf)
+{
+f010422c:	55                   	push   %ebp
+f010422d:	89 e5                	mov    %esp,%ebp
+f010422f:	53                   	push   %ebx
+f0104230:	83 ec 04             	sub    $0x4,%esp
+	// Record the CPU we are running on for user-space debugging
+	curenv->env_cpunum = cpunum();
+f0104233:	e8 0b 3c 00 00       	call   f0107e43 <cpunum>
+f0104238:	6b c0 74             	imul   $0x74,%eax,%eax
+f010423b:	8b 98 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%ebx
+f0104241:	e8 fd 3b 00 00       	call   f0107e43 <cpunum>
+f0104246:	89 43 5c             	mov    %eax,0x5c(%ebx)
+
+	__asm __volatile("movl %0,%%esp\n"
+f0104249:	8b 65 08             	mov    0x8(%ebp),%esp
+f010424c:	61                   	popa
+f010424d:	07                   	pop    %es
+f010424e:	1f                   	pop    %ds
+f010424f:	83 c4 08             	add    $0x8,%esp
+f0104252:	cf                   	iret
+		"\tpopl %%es\n"
+		"\tpopl %%ds\n"
+		"\taddl $0x8,%%esp\n" /* skip tf_trapno and tf_errcode */
+		"\tiret"
+		: : "g" (tf) : "memory");
+	panic("iret failed");  /* mostly to placate the compiler */
+f0104253:	83 ec 04             	sub    $0x4,%esp
+f0104256:	68 29 99 10 f0       	push   $0xf0109929
+f010425b:	68 33 03 00 00       	push   $0x333
+f0104260:	68 d6 98 10 f0       	push   $0xf01098d6
+f0104265:	e8 d6 bd ff ff       	call   f0100040 <_panic>
+
+f010426a <env_run>:
+//
+// This function does not return.
+//
+void
+env_run(struct Env *e)
+{
+f010426a:	55                   	push   %ebp
+f010426b:	89 e5                	mov    %esp,%ebp
+f010426d:	53                   	push   %ebx
+f010426e:	83 ec 04             	sub    $0x4,%esp
+f0104271:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	//	e->env_tf.  Go back through the code you wrote above
+	//	and make sure you have set the relevant parts of
+	//	e->env_tf to sensible values.
+
+	// LAB 3: Your code here.
+	if (e && curenv != e) {
+f0104274:	85 db                	test   %ebx,%ebx
+f0104276:	0f 84 8a 00 00 00    	je     f0104306 <env_run+0x9c>
+f010427c:	e8 c2 3b 00 00       	call   f0107e43 <cpunum>
+f0104281:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104284:	39 98 28 b0 85 f0    	cmp    %ebx,-0xf7a4fd8(%eax)
+f010428a:	74 7a                	je     f0104306 <env_run+0x9c>
+		if (curenv && curenv->env_status==ENV_RUNNING) {
+f010428c:	e8 b2 3b 00 00       	call   f0107e43 <cpunum>
+f0104291:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104294:	83 b8 28 b0 85 f0 00 	cmpl   $0x0,-0xf7a4fd8(%eax)
+f010429b:	74 14                	je     f01042b1 <env_run+0x47>
+f010429d:	e8 a1 3b 00 00       	call   f0107e43 <cpunum>
+f01042a2:	6b c0 74             	imul   $0x74,%eax,%eax
+f01042a5:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01042ab:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f01042af:	74 7a                	je     f010432b <env_run+0xc1>
+			curenv->env_status = ENV_RUNNABLE;
+		}
+		curenv = e;
+f01042b1:	e8 8d 3b 00 00       	call   f0107e43 <cpunum>
+f01042b6:	6b c0 74             	imul   $0x74,%eax,%eax
+f01042b9:	89 98 28 b0 85 f0    	mov    %ebx,-0xf7a4fd8(%eax)
+		curenv->env_status = ENV_RUNNING;
+f01042bf:	e8 7f 3b 00 00       	call   f0107e43 <cpunum>
+f01042c4:	6b c0 74             	imul   $0x74,%eax,%eax
+f01042c7:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01042cd:	c7 40 54 03 00 00 00 	movl   $0x3,0x54(%eax)
+		++(curenv->env_runs);
+f01042d4:	e8 6a 3b 00 00       	call   f0107e43 <cpunum>
+f01042d9:	6b c0 74             	imul   $0x74,%eax,%eax
+f01042dc:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01042e2:	83 40 58 01          	addl   $0x1,0x58(%eax)
+		lcr3(PADDR(curenv->env_pgdir));
+f01042e6:	e8 58 3b 00 00       	call   f0107e43 <cpunum>
+f01042eb:	6b c0 74             	imul   $0x74,%eax,%eax
+f01042ee:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01042f4:	8b 40 60             	mov    0x60(%eax),%eax
+	if ((uint32_t)kva < KERNBASE)
+f01042f7:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01042fc:	76 47                	jbe    f0104345 <env_run+0xdb>
+	return (physaddr_t)kva - KERNBASE;
+f01042fe:	05 00 00 00 10       	add    $0x10000000,%eax
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f0104303:	0f 22 d8             	mov    %eax,%cr3
+}
+
+static inline void
+unlock_kernel(void)
+{
+	spin_unlock(&kernel_lock);
+f0104306:	83 ec 0c             	sub    $0xc,%esp
+f0104309:	68 a0 54 11 f0       	push   $0xf01154a0
+f010430e:	e8 3a 3e 00 00       	call   f010814d <spin_unlock>
+
+	// Normally we wouldn't need to do this, but QEMU only runs
+	// one CPU at a time and has a long time-slice.  Without the
+	// pause, this CPU is likely to reacquire the lock before
+	// another CPU has even been given a chance to acquire it.
+	asm volatile("pause");
+f0104313:	f3 90                	pause
+	}
+
+	unlock_kernel();
+	env_pop_tf(&curenv->env_tf);
+f0104315:	e8 29 3b 00 00       	call   f0107e43 <cpunum>
+f010431a:	83 c4 04             	add    $0x4,%esp
+f010431d:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104320:	ff b0 28 b0 85 f0    	push   -0xf7a4fd8(%eax)
+f0104326:	e8 01 ff ff ff       	call   f010422c <env_pop_tf>
+			curenv->env_status = ENV_RUNNABLE;
+f010432b:	e8 13 3b 00 00       	call   f0107e43 <cpunum>
+f0104330:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104333:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0104339:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+f0104340:	e9 6c ff ff ff       	jmp    f01042b1 <env_run+0x47>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0104345:	50                   	push   %eax
+f0104346:	68 08 86 10 f0       	push   $0xf0108608
+f010434b:	68 58 03 00 00       	push   $0x358
+f0104350:	68 d6 98 10 f0       	push   $0xf01098d6
+f0104355:	e8 e6 bc ff ff       	call   f0100040 <_panic>
+
+f010435a <mc146818_read>:
+#include <kern/kclock.h>
+
+
+unsigned
+mc146818_read(unsigned reg)
+{
+f010435a:	55                   	push   %ebp
+f010435b:	89 e5                	mov    %esp,%ebp
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010435d:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104360:	ba 70 00 00 00       	mov    $0x70,%edx
+f0104365:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0104366:	ba 71 00 00 00       	mov    $0x71,%edx
+f010436b:	ec                   	in     (%dx),%al
+	outb(IO_RTC, reg);
+	return inb(IO_RTC+1);
+f010436c:	0f b6 c0             	movzbl %al,%eax
+}
+f010436f:	5d                   	pop    %ebp
+f0104370:	c3                   	ret
+
+f0104371 <mc146818_write>:
+
+void
+mc146818_write(unsigned reg, unsigned datum)
+{
+f0104371:	55                   	push   %ebp
+f0104372:	89 e5                	mov    %esp,%ebp
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0104374:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104377:	ba 70 00 00 00       	mov    $0x70,%edx
+f010437c:	ee                   	out    %al,(%dx)
+f010437d:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0104380:	ba 71 00 00 00       	mov    $0x71,%edx
+f0104385:	ee                   	out    %al,(%dx)
+	outb(IO_RTC, reg);
+	outb(IO_RTC+1, datum);
+}
+f0104386:	5d                   	pop    %ebp
+f0104387:	c3                   	ret
+
+f0104388 <irq_setmask_8259A>:
+		irq_setmask_8259A(irq_mask_8259A);
+}
+
+void
+irq_setmask_8259A(uint16_t mask)
+{
+f0104388:	55                   	push   %ebp
+f0104389:	89 e5                	mov    %esp,%ebp
+f010438b:	56                   	push   %esi
+f010438c:	53                   	push   %ebx
+f010438d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	irq_mask_8259A = mask;
+f0104390:	66 89 0d a8 53 11 f0 	mov    %cx,0xf01153a8
+	if (!didinit)
+f0104397:	80 3d 08 94 85 f0 00 	cmpb   $0x0,0xf0859408
+f010439e:	75 07                	jne    f01043a7 <irq_setmask_8259A+0x1f>
+	cprintf("enabled interrupts:");
+	for (i = 0; i < 16; i++)
+		if (~mask & (1<<i))
+			cprintf(" %d", i);
+	cprintf("\n");
+}
+f01043a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01043a3:	5b                   	pop    %ebx
+f01043a4:	5e                   	pop    %esi
+f01043a5:	5d                   	pop    %ebp
+f01043a6:	c3                   	ret
+f01043a7:	89 ce                	mov    %ecx,%esi
+f01043a9:	ba 21 00 00 00       	mov    $0x21,%edx
+f01043ae:	89 c8                	mov    %ecx,%eax
+f01043b0:	ee                   	out    %al,(%dx)
+	outb(IO_PIC2+1, (char)(mask >> 8));
+f01043b1:	89 c8                	mov    %ecx,%eax
+f01043b3:	66 c1 e8 08          	shr    $0x8,%ax
+f01043b7:	ba a1 00 00 00       	mov    $0xa1,%edx
+f01043bc:	ee                   	out    %al,(%dx)
+	cprintf("enabled interrupts:");
+f01043bd:	83 ec 0c             	sub    $0xc,%esp
+f01043c0:	68 35 99 10 f0       	push   $0xf0109935
+f01043c5:	e8 20 01 00 00       	call   f01044ea <cprintf>
+f01043ca:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 16; i++)
+f01043cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (~mask & (1<<i))
+f01043d2:	0f b7 f6             	movzwl %si,%esi
+f01043d5:	f7 d6                	not    %esi
+f01043d7:	eb 08                	jmp    f01043e1 <irq_setmask_8259A+0x59>
+	for (i = 0; i < 16; i++)
+f01043d9:	83 c3 01             	add    $0x1,%ebx
+f01043dc:	83 fb 10             	cmp    $0x10,%ebx
+f01043df:	74 18                	je     f01043f9 <irq_setmask_8259A+0x71>
+		if (~mask & (1<<i))
+f01043e1:	0f a3 de             	bt     %ebx,%esi
+f01043e4:	73 f3                	jae    f01043d9 <irq_setmask_8259A+0x51>
+			cprintf(" %d", i);
+f01043e6:	83 ec 08             	sub    $0x8,%esp
+f01043e9:	53                   	push   %ebx
+f01043ea:	68 37 9f 10 f0       	push   $0xf0109f37
+f01043ef:	e8 f6 00 00 00       	call   f01044ea <cprintf>
+f01043f4:	83 c4 10             	add    $0x10,%esp
+f01043f7:	eb e0                	jmp    f01043d9 <irq_setmask_8259A+0x51>
+	cprintf("\n");
+f01043f9:	83 ec 0c             	sub    $0xc,%esp
+f01043fc:	68 8d 86 10 f0       	push   $0xf010868d
+f0104401:	e8 e4 00 00 00       	call   f01044ea <cprintf>
+f0104406:	83 c4 10             	add    $0x10,%esp
+f0104409:	eb 95                	jmp    f01043a0 <irq_setmask_8259A+0x18>
+
+f010440b <pic_init>:
+{
+f010440b:	55                   	push   %ebp
+f010440c:	89 e5                	mov    %esp,%ebp
+f010440e:	57                   	push   %edi
+f010440f:	56                   	push   %esi
+f0104410:	53                   	push   %ebx
+f0104411:	83 ec 0c             	sub    $0xc,%esp
+	didinit = 1;
+f0104414:	c6 05 08 94 85 f0 01 	movb   $0x1,0xf0859408
+f010441b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0104420:	bb 21 00 00 00       	mov    $0x21,%ebx
+f0104425:	89 da                	mov    %ebx,%edx
+f0104427:	ee                   	out    %al,(%dx)
+f0104428:	b9 a1 00 00 00       	mov    $0xa1,%ecx
+f010442d:	89 ca                	mov    %ecx,%edx
+f010442f:	ee                   	out    %al,(%dx)
+f0104430:	bf 11 00 00 00       	mov    $0x11,%edi
+f0104435:	be 20 00 00 00       	mov    $0x20,%esi
+f010443a:	89 f8                	mov    %edi,%eax
+f010443c:	89 f2                	mov    %esi,%edx
+f010443e:	ee                   	out    %al,(%dx)
+f010443f:	b8 20 00 00 00       	mov    $0x20,%eax
+f0104444:	89 da                	mov    %ebx,%edx
+f0104446:	ee                   	out    %al,(%dx)
+f0104447:	b8 04 00 00 00       	mov    $0x4,%eax
+f010444c:	ee                   	out    %al,(%dx)
+f010444d:	b8 03 00 00 00       	mov    $0x3,%eax
+f0104452:	ee                   	out    %al,(%dx)
+f0104453:	bb a0 00 00 00       	mov    $0xa0,%ebx
+f0104458:	89 f8                	mov    %edi,%eax
+f010445a:	89 da                	mov    %ebx,%edx
+f010445c:	ee                   	out    %al,(%dx)
+f010445d:	b8 28 00 00 00       	mov    $0x28,%eax
+f0104462:	89 ca                	mov    %ecx,%edx
+f0104464:	ee                   	out    %al,(%dx)
+f0104465:	b8 02 00 00 00       	mov    $0x2,%eax
+f010446a:	ee                   	out    %al,(%dx)
+f010446b:	b8 01 00 00 00       	mov    $0x1,%eax
+f0104470:	ee                   	out    %al,(%dx)
+f0104471:	bf 68 00 00 00       	mov    $0x68,%edi
+f0104476:	89 f8                	mov    %edi,%eax
+f0104478:	89 f2                	mov    %esi,%edx
+f010447a:	ee                   	out    %al,(%dx)
+f010447b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+f0104480:	89 c8                	mov    %ecx,%eax
+f0104482:	ee                   	out    %al,(%dx)
+f0104483:	89 f8                	mov    %edi,%eax
+f0104485:	89 da                	mov    %ebx,%edx
+f0104487:	ee                   	out    %al,(%dx)
+f0104488:	89 c8                	mov    %ecx,%eax
+f010448a:	ee                   	out    %al,(%dx)
+	if (irq_mask_8259A != 0xFFFF)
+f010448b:	0f b7 05 a8 53 11 f0 	movzwl 0xf01153a8,%eax
+f0104492:	66 83 f8 ff          	cmp    $0xffff,%ax
+f0104496:	75 08                	jne    f01044a0 <pic_init+0x95>
+}
+f0104498:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010449b:	5b                   	pop    %ebx
+f010449c:	5e                   	pop    %esi
+f010449d:	5f                   	pop    %edi
+f010449e:	5d                   	pop    %ebp
+f010449f:	c3                   	ret
+		irq_setmask_8259A(irq_mask_8259A);
+f01044a0:	83 ec 0c             	sub    $0xc,%esp
+f01044a3:	0f b7 c0             	movzwl %ax,%eax
+f01044a6:	50                   	push   %eax
+f01044a7:	e8 dc fe ff ff       	call   f0104388 <irq_setmask_8259A>
+f01044ac:	83 c4 10             	add    $0x10,%esp
+}
+f01044af:	eb e7                	jmp    f0104498 <pic_init+0x8d>
+
+f01044b1 <putch>:
+#include <inc/stdarg.h>
+
+
+static void
+putch(int ch, int *cnt)
+{
+f01044b1:	55                   	push   %ebp
+f01044b2:	89 e5                	mov    %esp,%ebp
+f01044b4:	83 ec 14             	sub    $0x14,%esp
+	cputchar(ch);
+f01044b7:	ff 75 08             	push   0x8(%ebp)
+f01044ba:	e8 1a c3 ff ff       	call   f01007d9 <cputchar>
+	*cnt++;
+}
+f01044bf:	83 c4 10             	add    $0x10,%esp
+f01044c2:	c9                   	leave
+f01044c3:	c3                   	ret
+
+f01044c4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+f01044c4:	55                   	push   %ebp
+f01044c5:	89 e5                	mov    %esp,%ebp
+f01044c7:	83 ec 18             	sub    $0x18,%esp
+	int cnt = 0;
+f01044ca:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	vprintfmt((void*)putch, &cnt, fmt, ap);
+f01044d1:	ff 75 0c             	push   0xc(%ebp)
+f01044d4:	ff 75 08             	push   0x8(%ebp)
+f01044d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f01044da:	50                   	push   %eax
+f01044db:	68 b1 44 10 f0       	push   $0xf01044b1
+f01044e0:	e8 7b 2b 00 00       	call   f0107060 <vprintfmt>
+	return cnt;
+}
+f01044e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f01044e8:	c9                   	leave
+f01044e9:	c3                   	ret
+
+f01044ea <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+f01044ea:	55                   	push   %ebp
+f01044eb:	89 e5                	mov    %esp,%ebp
+f01044ed:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+f01044f0:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+f01044f3:	50                   	push   %eax
+f01044f4:	ff 75 08             	push   0x8(%ebp)
+f01044f7:	e8 c8 ff ff ff       	call   f01044c4 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+f01044fc:	c9                   	leave
+f01044fd:	c3                   	ret
+
+f01044fe <trap_init_percpu>:
+}
+
+// Initialize and load the per-CPU TSS and IDT
+void
+trap_init_percpu(void)
+{
+f01044fe:	55                   	push   %ebp
+f01044ff:	89 e5                	mov    %esp,%ebp
+f0104501:	57                   	push   %edi
+f0104502:	56                   	push   %esi
+f0104503:	53                   	push   %ebx
+f0104504:	83 ec 0c             	sub    $0xc,%esp
+	//
+	// LAB 4: Your code here:
+
+	// Setup a TSS so that we get the right stack
+	// when we trap to the kernel.
+	thiscpu->cpu_ts.ts_esp0 = KSTACKTOP - (KSTKSIZE + KSTKGAP) * thiscpu->cpu_id;
+f0104507:	e8 37 39 00 00       	call   f0107e43 <cpunum>
+f010450c:	6b c0 74             	imul   $0x74,%eax,%eax
+f010450f:	0f b6 98 20 b0 85 f0 	movzbl -0xf7a4fe0(%eax),%ebx
+f0104516:	c1 e3 10             	shl    $0x10,%ebx
+f0104519:	e8 25 39 00 00       	call   f0107e43 <cpunum>
+f010451e:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104521:	ba 00 00 00 f0       	mov    $0xf0000000,%edx
+f0104526:	29 da                	sub    %ebx,%edx
+f0104528:	89 90 30 b0 85 f0    	mov    %edx,-0xf7a4fd0(%eax)
+	thiscpu->cpu_ts.ts_ss0 = GD_KD;
+f010452e:	e8 10 39 00 00       	call   f0107e43 <cpunum>
+f0104533:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104536:	66 c7 80 34 b0 85 f0 	movw   $0x10,-0xf7a4fcc(%eax)
+f010453d:	10 00 
+
+	// Initialize the TSS slot of the gdt.
+	gdt[(GD_TSS0 >> 3) + thiscpu->cpu_id] = SEG16(STS_T32A, (uint32_t) (&(thiscpu->cpu_ts)),
+f010453f:	e8 ff 38 00 00       	call   f0107e43 <cpunum>
+f0104544:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104547:	0f b6 b0 20 b0 85 f0 	movzbl -0xf7a4fe0(%eax),%esi
+f010454e:	83 c6 05             	add    $0x5,%esi
+f0104551:	e8 ed 38 00 00       	call   f0107e43 <cpunum>
+f0104556:	89 c7                	mov    %eax,%edi
+f0104558:	e8 e6 38 00 00       	call   f0107e43 <cpunum>
+f010455d:	89 c3                	mov    %eax,%ebx
+f010455f:	e8 df 38 00 00       	call   f0107e43 <cpunum>
+f0104564:	66 c7 04 f5 40 53 11 	movw   $0x68,-0xfeeacc0(,%esi,8)
+f010456b:	f0 68 00 
+f010456e:	6b ff 74             	imul   $0x74,%edi,%edi
+f0104571:	81 c7 2c b0 85 f0    	add    $0xf085b02c,%edi
+f0104577:	66 89 3c f5 42 53 11 	mov    %di,-0xfeeacbe(,%esi,8)
+f010457e:	f0 
+f010457f:	6b db 74             	imul   $0x74,%ebx,%ebx
+f0104582:	81 c3 2c b0 85 f0    	add    $0xf085b02c,%ebx
+f0104588:	c1 eb 10             	shr    $0x10,%ebx
+f010458b:	88 1c f5 44 53 11 f0 	mov    %bl,-0xfeeacbc(,%esi,8)
+f0104592:	c6 04 f5 45 53 11 f0 	movb   $0x99,-0xfeeacbb(,%esi,8)
+f0104599:	99 
+f010459a:	c6 04 f5 46 53 11 f0 	movb   $0x40,-0xfeeacba(,%esi,8)
+f01045a1:	40 
+f01045a2:	6b c0 74             	imul   $0x74,%eax,%eax
+f01045a5:	05 2c b0 85 f0       	add    $0xf085b02c,%eax
+f01045aa:	c1 e8 18             	shr    $0x18,%eax
+f01045ad:	88 04 f5 47 53 11 f0 	mov    %al,-0xfeeacb9(,%esi,8)
+					sizeof(struct Taskstate), 0);
+	gdt[(GD_TSS0 >> 3) + thiscpu->cpu_id].sd_s = 0;
+f01045b4:	e8 8a 38 00 00       	call   f0107e43 <cpunum>
+f01045b9:	6b c0 74             	imul   $0x74,%eax,%eax
+f01045bc:	0f b6 80 20 b0 85 f0 	movzbl -0xf7a4fe0(%eax),%eax
+f01045c3:	80 24 c5 6d 53 11 f0 	andb   $0xef,-0xfeeac93(,%eax,8)
+f01045ca:	ef 
+
+	// Load the TSS selector (like other segment selectors, the
+	// bottom three bits are special; we leave them 0)
+	ltr(GD_TSS0 + (thiscpu->cpu_id << 3));
+f01045cb:	e8 73 38 00 00       	call   f0107e43 <cpunum>
+f01045d0:	6b c0 74             	imul   $0x74,%eax,%eax
+f01045d3:	0f b6 80 20 b0 85 f0 	movzbl -0xf7a4fe0(%eax),%eax
+f01045da:	8d 04 c5 28 00 00 00 	lea    0x28(,%eax,8),%eax
+	__asm __volatile("ltr %0" : : "r" (sel));
+f01045e1:	0f 00 d8             	ltr    %ax
+	__asm __volatile("lidt (%0)" : : "r" (p));
+f01045e4:	b8 ac 53 11 f0       	mov    $0xf01153ac,%eax
+f01045e9:	0f 01 18             	lidtl  (%eax)
+
+	// Load the IDT
+	lidt(&idt_pd);
+}
+f01045ec:	83 c4 0c             	add    $0xc,%esp
+f01045ef:	5b                   	pop    %ebx
+f01045f0:	5e                   	pop    %esi
+f01045f1:	5f                   	pop    %edi
+f01045f2:	5d                   	pop    %ebp
+f01045f3:	c3                   	ret
+
+f01045f4 <trap_init>:
+{
+f01045f4:	55                   	push   %ebp
+f01045f5:	89 e5                	mov    %esp,%ebp
+f01045f7:	57                   	push   %edi
+f01045f8:	56                   	push   %esi
+f01045f9:	53                   	push   %ebx
+f01045fa:	83 ec 1c             	sub    $0x1c,%esp
+			SETGATE(idt[i], 0, GD_KT, &T_DEFAULT_HANDLER, 0);
+f01045fd:	bf 3e 4f 10 f0       	mov    $0xf0104f3e,%edi
+f0104602:	c1 ef 10             	shr    $0x10,%edi
+	unsigned int *vector = vectors;
+f0104605:	bb b2 53 11 f0       	mov    $0xf01153b2,%ebx
+	for(i = 0; i < 256; i++) {
+f010460a:	b8 00 00 00 00       	mov    $0x0,%eax
+			SETGATE(idt[i], 0, GD_KT, &T_DEFAULT_HANDLER, 0);
+f010460f:	ba 3e 4f 10 f0       	mov    $0xf0104f3e,%edx
+f0104614:	66 89 55 e6          	mov    %dx,-0x1a(%ebp)
+f0104618:	eb 51                	jmp    f010466b <trap_init+0x77>
+			if (i >= IRQ_OFFSET && i < IRQ_OFFSET + 16) {
+f010461a:	8d 50 e0             	lea    -0x20(%eax),%edx
+f010461d:	83 fa 0f             	cmp    $0xf,%edx
+f0104620:	76 5a                	jbe    f010467c <trap_init+0x88>
+				SETGATE(idt[i], 0, GD_KT, *(vector+1), 0);
+f0104622:	8b 4b 04             	mov    0x4(%ebx),%ecx
+f0104625:	89 ce                	mov    %ecx,%esi
+f0104627:	c1 e9 10             	shr    $0x10,%ecx
+f010462a:	ba 00 00 00 00       	mov    $0x0,%edx
+			vector += 2;	// make vector point to the next trap
+f010462f:	83 c3 08             	add    $0x8,%ebx
+				SETGATE(idt[i], 0, GD_KT, *(vector+1), 3);
+f0104632:	66 89 34 c5 20 94 85 	mov    %si,-0xf7a6be0(,%eax,8)
+f0104639:	f0 
+f010463a:	66 c7 04 c5 22 94 85 	movw   $0x8,-0xf7a6bde(,%eax,8)
+f0104641:	f0 08 00 
+f0104644:	c6 04 c5 24 94 85 f0 	movb   $0x0,-0xf7a6bdc(,%eax,8)
+f010464b:	00 
+f010464c:	c1 e2 05             	shl    $0x5,%edx
+f010464f:	83 ca 8e             	or     $0xffffff8e,%edx
+f0104652:	88 14 c5 25 94 85 f0 	mov    %dl,-0xf7a6bdb(,%eax,8)
+f0104659:	66 89 0c c5 26 94 85 	mov    %cx,-0xf7a6bda(,%eax,8)
+f0104660:	f0 
+	for(i = 0; i < 256; i++) {
+f0104661:	83 c0 01             	add    $0x1,%eax
+f0104664:	3d 00 01 00 00       	cmp    $0x100,%eax
+f0104669:	74 20                	je     f010468b <trap_init+0x97>
+		if (*vector == i) {
+f010466b:	39 03                	cmp    %eax,(%ebx)
+f010466d:	74 ab                	je     f010461a <trap_init+0x26>
+			SETGATE(idt[i], 0, GD_KT, &T_DEFAULT_HANDLER, 0);
+f010466f:	0f b7 75 e6          	movzwl -0x1a(%ebp),%esi
+f0104673:	89 f9                	mov    %edi,%ecx
+f0104675:	ba 00 00 00 00       	mov    $0x0,%edx
+f010467a:	eb b6                	jmp    f0104632 <trap_init+0x3e>
+				SETGATE(idt[i], 0, GD_KT, *(vector+1), 3);
+f010467c:	8b 4b 04             	mov    0x4(%ebx),%ecx
+f010467f:	89 ce                	mov    %ecx,%esi
+f0104681:	c1 e9 10             	shr    $0x10,%ecx
+f0104684:	ba 03 00 00 00       	mov    $0x3,%edx
+f0104689:	eb a4                	jmp    f010462f <trap_init+0x3b>
+	SETGATE(idt[T_SYSCALL], 0, GD_KT, &T_SYSCALL_HANDLER, 3);
+f010468b:	b8 34 4f 10 f0       	mov    $0xf0104f34,%eax
+f0104690:	66 a3 a0 95 85 f0    	mov    %ax,0xf08595a0
+f0104696:	66 c7 05 a2 95 85 f0 	movw   $0x8,0xf08595a2
+f010469d:	08 00 
+f010469f:	c6 05 a4 95 85 f0 00 	movb   $0x0,0xf08595a4
+f01046a6:	c6 05 a5 95 85 f0 ee 	movb   $0xee,0xf08595a5
+f01046ad:	c1 e8 10             	shr    $0x10,%eax
+f01046b0:	66 a3 a6 95 85 f0    	mov    %ax,0xf08595a6
+	SETGATE(idt[T_BRKPT], 0, GD_KT, &T_BRKPT_HANDLER, 3);
+f01046b6:	b8 7a 4e 10 f0       	mov    $0xf0104e7a,%eax
+f01046bb:	66 a3 38 94 85 f0    	mov    %ax,0xf0859438
+f01046c1:	66 c7 05 3a 94 85 f0 	movw   $0x8,0xf085943a
+f01046c8:	08 00 
+f01046ca:	c6 05 3c 94 85 f0 00 	movb   $0x0,0xf085943c
+f01046d1:	c6 05 3d 94 85 f0 ee 	movb   $0xee,0xf085943d
+f01046d8:	c1 e8 10             	shr    $0x10,%eax
+f01046db:	66 a3 3e 94 85 f0    	mov    %ax,0xf085943e
+	trap_init_percpu();
+f01046e1:	e8 18 fe ff ff       	call   f01044fe <trap_init_percpu>
+}
+f01046e6:	83 c4 1c             	add    $0x1c,%esp
+f01046e9:	5b                   	pop    %ebx
+f01046ea:	5e                   	pop    %esi
+f01046eb:	5f                   	pop    %edi
+f01046ec:	5d                   	pop    %ebp
+f01046ed:	c3                   	ret
+
+f01046ee <print_regs>:
+	}
+}
+
+void
+print_regs(struct PushRegs *regs)
+{
+f01046ee:	55                   	push   %ebp
+f01046ef:	89 e5                	mov    %esp,%ebp
+f01046f1:	53                   	push   %ebx
+f01046f2:	83 ec 0c             	sub    $0xc,%esp
+f01046f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("  edi  0x%08x\n", regs->reg_edi);
+f01046f8:	ff 33                	push   (%ebx)
+f01046fa:	68 49 99 10 f0       	push   $0xf0109949
+f01046ff:	e8 e6 fd ff ff       	call   f01044ea <cprintf>
+	cprintf("  esi  0x%08x\n", regs->reg_esi);
+f0104704:	83 c4 08             	add    $0x8,%esp
+f0104707:	ff 73 04             	push   0x4(%ebx)
+f010470a:	68 58 99 10 f0       	push   $0xf0109958
+f010470f:	e8 d6 fd ff ff       	call   f01044ea <cprintf>
+	cprintf("  ebp  0x%08x\n", regs->reg_ebp);
+f0104714:	83 c4 08             	add    $0x8,%esp
+f0104717:	ff 73 08             	push   0x8(%ebx)
+f010471a:	68 67 99 10 f0       	push   $0xf0109967
+f010471f:	e8 c6 fd ff ff       	call   f01044ea <cprintf>
+	cprintf("  oesp 0x%08x\n", regs->reg_oesp);
+f0104724:	83 c4 08             	add    $0x8,%esp
+f0104727:	ff 73 0c             	push   0xc(%ebx)
+f010472a:	68 76 99 10 f0       	push   $0xf0109976
+f010472f:	e8 b6 fd ff ff       	call   f01044ea <cprintf>
+	cprintf("  ebx  0x%08x\n", regs->reg_ebx);
+f0104734:	83 c4 08             	add    $0x8,%esp
+f0104737:	ff 73 10             	push   0x10(%ebx)
+f010473a:	68 85 99 10 f0       	push   $0xf0109985
+f010473f:	e8 a6 fd ff ff       	call   f01044ea <cprintf>
+	cprintf("  edx  0x%08x\n", regs->reg_edx);
+f0104744:	83 c4 08             	add    $0x8,%esp
+f0104747:	ff 73 14             	push   0x14(%ebx)
+f010474a:	68 94 99 10 f0       	push   $0xf0109994
+f010474f:	e8 96 fd ff ff       	call   f01044ea <cprintf>
+	cprintf("  ecx  0x%08x\n", regs->reg_ecx);
+f0104754:	83 c4 08             	add    $0x8,%esp
+f0104757:	ff 73 18             	push   0x18(%ebx)
+f010475a:	68 a3 99 10 f0       	push   $0xf01099a3
+f010475f:	e8 86 fd ff ff       	call   f01044ea <cprintf>
+	cprintf("  eax  0x%08x\n", regs->reg_eax);
+f0104764:	83 c4 08             	add    $0x8,%esp
+f0104767:	ff 73 1c             	push   0x1c(%ebx)
+f010476a:	68 b2 99 10 f0       	push   $0xf01099b2
+f010476f:	e8 76 fd ff ff       	call   f01044ea <cprintf>
+}
+f0104774:	83 c4 10             	add    $0x10,%esp
+f0104777:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010477a:	c9                   	leave
+f010477b:	c3                   	ret
+
+f010477c <print_trapframe>:
+{
+f010477c:	55                   	push   %ebp
+f010477d:	89 e5                	mov    %esp,%ebp
+f010477f:	56                   	push   %esi
+f0104780:	53                   	push   %ebx
+f0104781:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("TRAP frame at %p from CPU %d\n", tf, cpunum());
+f0104784:	e8 ba 36 00 00       	call   f0107e43 <cpunum>
+f0104789:	83 ec 04             	sub    $0x4,%esp
+f010478c:	50                   	push   %eax
+f010478d:	53                   	push   %ebx
+f010478e:	68 16 9a 10 f0       	push   $0xf0109a16
+f0104793:	e8 52 fd ff ff       	call   f01044ea <cprintf>
+	print_regs(&tf->tf_regs);
+f0104798:	89 1c 24             	mov    %ebx,(%esp)
+f010479b:	e8 4e ff ff ff       	call   f01046ee <print_regs>
+	cprintf("  es   0x----%04x\n", tf->tf_es);
+f01047a0:	83 c4 08             	add    $0x8,%esp
+f01047a3:	0f b7 43 20          	movzwl 0x20(%ebx),%eax
+f01047a7:	50                   	push   %eax
+f01047a8:	68 34 9a 10 f0       	push   $0xf0109a34
+f01047ad:	e8 38 fd ff ff       	call   f01044ea <cprintf>
+	cprintf("  ds   0x----%04x\n", tf->tf_ds);
+f01047b2:	83 c4 08             	add    $0x8,%esp
+f01047b5:	0f b7 43 24          	movzwl 0x24(%ebx),%eax
+f01047b9:	50                   	push   %eax
+f01047ba:	68 47 9a 10 f0       	push   $0xf0109a47
+f01047bf:	e8 26 fd ff ff       	call   f01044ea <cprintf>
+	cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f01047c4:	8b 43 28             	mov    0x28(%ebx),%eax
+	if (trapno < sizeof(excnames)/sizeof(excnames[0]))
+f01047c7:	83 c4 10             	add    $0x10,%esp
+f01047ca:	83 f8 13             	cmp    $0x13,%eax
+f01047cd:	0f 86 da 00 00 00    	jbe    f01048ad <print_trapframe+0x131>
+		return "System call";
+f01047d3:	ba c1 99 10 f0       	mov    $0xf01099c1,%edx
+	if (trapno == T_SYSCALL)
+f01047d8:	83 f8 30             	cmp    $0x30,%eax
+f01047db:	74 13                	je     f01047f0 <print_trapframe+0x74>
+	if (trapno >= IRQ_OFFSET && trapno < IRQ_OFFSET + 16)
+f01047dd:	8d 50 e0             	lea    -0x20(%eax),%edx
+	return "(unknown trap)";
+f01047e0:	83 fa 10             	cmp    $0x10,%edx
+f01047e3:	ba dc 99 10 f0       	mov    $0xf01099dc,%edx
+f01047e8:	b9 cd 99 10 f0       	mov    $0xf01099cd,%ecx
+f01047ed:	0f 43 d1             	cmovae %ecx,%edx
+	cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f01047f0:	83 ec 04             	sub    $0x4,%esp
+f01047f3:	52                   	push   %edx
+f01047f4:	50                   	push   %eax
+f01047f5:	68 5a 9a 10 f0       	push   $0xf0109a5a
+f01047fa:	e8 eb fc ff ff       	call   f01044ea <cprintf>
+	if (tf == last_tf && tf->tf_trapno == T_PGFLT)
+f01047ff:	83 c4 10             	add    $0x10,%esp
+f0104802:	39 1d 30 9c 85 f0    	cmp    %ebx,0xf0859c30
+f0104808:	0f 84 ab 00 00 00    	je     f01048b9 <print_trapframe+0x13d>
+	cprintf("  err  0x%08x", tf->tf_err);
+f010480e:	83 ec 08             	sub    $0x8,%esp
+f0104811:	ff 73 2c             	push   0x2c(%ebx)
+f0104814:	68 7b 9a 10 f0       	push   $0xf0109a7b
+f0104819:	e8 cc fc ff ff       	call   f01044ea <cprintf>
+	if (tf->tf_trapno == T_PGFLT)
+f010481e:	83 c4 10             	add    $0x10,%esp
+f0104821:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f0104825:	0f 85 b1 00 00 00    	jne    f01048dc <print_trapframe+0x160>
+			tf->tf_err & 1 ? "protection" : "not-present");
+f010482b:	8b 43 2c             	mov    0x2c(%ebx),%eax
+		cprintf(" [%s, %s, %s]\n",
+f010482e:	a8 01                	test   $0x1,%al
+f0104830:	b9 fa 99 10 f0       	mov    $0xf01099fa,%ecx
+f0104835:	ba ef 99 10 f0       	mov    $0xf01099ef,%edx
+f010483a:	0f 45 ca             	cmovne %edx,%ecx
+f010483d:	a8 02                	test   $0x2,%al
+f010483f:	ba 0c 9a 10 f0       	mov    $0xf0109a0c,%edx
+f0104844:	be 06 9a 10 f0       	mov    $0xf0109a06,%esi
+f0104849:	0f 45 d6             	cmovne %esi,%edx
+f010484c:	a8 04                	test   $0x4,%al
+f010484e:	b8 46 9b 10 f0       	mov    $0xf0109b46,%eax
+f0104853:	be 11 9a 10 f0       	mov    $0xf0109a11,%esi
+f0104858:	0f 45 c6             	cmovne %esi,%eax
+f010485b:	51                   	push   %ecx
+f010485c:	52                   	push   %edx
+f010485d:	50                   	push   %eax
+f010485e:	68 89 9a 10 f0       	push   $0xf0109a89
+f0104863:	e8 82 fc ff ff       	call   f01044ea <cprintf>
+f0104868:	83 c4 10             	add    $0x10,%esp
+	cprintf("  eip  0x%08x\n", tf->tf_eip);
+f010486b:	83 ec 08             	sub    $0x8,%esp
+f010486e:	ff 73 30             	push   0x30(%ebx)
+f0104871:	68 98 9a 10 f0       	push   $0xf0109a98
+f0104876:	e8 6f fc ff ff       	call   f01044ea <cprintf>
+	cprintf("  cs   0x----%04x\n", tf->tf_cs);
+f010487b:	83 c4 08             	add    $0x8,%esp
+f010487e:	0f b7 43 34          	movzwl 0x34(%ebx),%eax
+f0104882:	50                   	push   %eax
+f0104883:	68 a7 9a 10 f0       	push   $0xf0109aa7
+f0104888:	e8 5d fc ff ff       	call   f01044ea <cprintf>
+	cprintf("  flag 0x%08x\n", tf->tf_eflags);
+f010488d:	83 c4 08             	add    $0x8,%esp
+f0104890:	ff 73 38             	push   0x38(%ebx)
+f0104893:	68 ba 9a 10 f0       	push   $0xf0109aba
+f0104898:	e8 4d fc ff ff       	call   f01044ea <cprintf>
+	if ((tf->tf_cs & 3) != 0) {
+f010489d:	83 c4 10             	add    $0x10,%esp
+f01048a0:	f6 43 34 03          	testb  $0x3,0x34(%ebx)
+f01048a4:	75 4b                	jne    f01048f1 <print_trapframe+0x175>
+}
+f01048a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01048a9:	5b                   	pop    %ebx
+f01048aa:	5e                   	pop    %esi
+f01048ab:	5d                   	pop    %ebp
+f01048ac:	c3                   	ret
+		return excnames[trapno];
+f01048ad:	8b 14 85 a0 9d 10 f0 	mov    -0xfef6260(,%eax,4),%edx
+f01048b4:	e9 37 ff ff ff       	jmp    f01047f0 <print_trapframe+0x74>
+	if (tf == last_tf && tf->tf_trapno == T_PGFLT)
+f01048b9:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f01048bd:	0f 85 4b ff ff ff    	jne    f010480e <print_trapframe+0x92>
+	__asm __volatile("movl %%cr2,%0" : "=r" (val));
+f01048c3:	0f 20 d0             	mov    %cr2,%eax
+		cprintf("  cr2  0x%08x\n", rcr2());
+f01048c6:	83 ec 08             	sub    $0x8,%esp
+f01048c9:	50                   	push   %eax
+f01048ca:	68 6c 9a 10 f0       	push   $0xf0109a6c
+f01048cf:	e8 16 fc ff ff       	call   f01044ea <cprintf>
+f01048d4:	83 c4 10             	add    $0x10,%esp
+f01048d7:	e9 32 ff ff ff       	jmp    f010480e <print_trapframe+0x92>
+		cprintf("\n");
+f01048dc:	83 ec 0c             	sub    $0xc,%esp
+f01048df:	68 8d 86 10 f0       	push   $0xf010868d
+f01048e4:	e8 01 fc ff ff       	call   f01044ea <cprintf>
+f01048e9:	83 c4 10             	add    $0x10,%esp
+f01048ec:	e9 7a ff ff ff       	jmp    f010486b <print_trapframe+0xef>
+		cprintf("  esp  0x%08x\n", tf->tf_esp);
+f01048f1:	83 ec 08             	sub    $0x8,%esp
+f01048f4:	ff 73 3c             	push   0x3c(%ebx)
+f01048f7:	68 c9 9a 10 f0       	push   $0xf0109ac9
+f01048fc:	e8 e9 fb ff ff       	call   f01044ea <cprintf>
+		cprintf("  ss   0x----%04x\n", tf->tf_ss);
+f0104901:	83 c4 08             	add    $0x8,%esp
+f0104904:	0f b7 43 40          	movzwl 0x40(%ebx),%eax
+f0104908:	50                   	push   %eax
+f0104909:	68 d8 9a 10 f0       	push   $0xf0109ad8
+f010490e:	e8 d7 fb ff ff       	call   f01044ea <cprintf>
+f0104913:	83 c4 10             	add    $0x10,%esp
+}
+f0104916:	eb 8e                	jmp    f01048a6 <print_trapframe+0x12a>
+
+f0104918 <page_fault_handler>:
+}
+
+
+void
+page_fault_handler(struct Trapframe *tf)
+{
+f0104918:	55                   	push   %ebp
+f0104919:	89 e5                	mov    %esp,%ebp
+f010491b:	57                   	push   %edi
+f010491c:	56                   	push   %esi
+f010491d:	53                   	push   %ebx
+f010491e:	83 ec 1c             	sub    $0x1c,%esp
+f0104921:	8b 75 08             	mov    0x8(%ebp),%esi
+f0104924:	0f 20 d7             	mov    %cr2,%edi
+	fault_va = rcr2();
+
+	// Handle kernel-mode page faults.
+
+	// LAB 3: Your code here.
+	if ((tf->tf_cs & 3) == 0) {
+f0104927:	f6 46 34 03          	testb  $0x3,0x34(%esi)
+f010492b:	0f 84 cd 00 00 00    	je     f01049fe <page_fault_handler+0xe6>
+	// the page fault happened in user mode.
+
+	// Load pages of lazily loaded segments on first touch.  If the page
+	// has to come from a pager, wait for it.  If we're out of memory, let
+	// the user's handler page something out, as below.
+	if (!(tf->tf_err & FEC_PR) && (r = env_segment_fault(curenv, fault_va)) >= 0) {
+f0104931:	f6 46 2c 01          	testb  $0x1,0x2c(%esi)
+f0104935:	0f 84 da 00 00 00    	je     f0104a15 <page_fault_handler+0xfd>
+
+	// Resolve writes to copy-on-write pages here, without a trip
+	// through the user's handler.  If we're short on memory, page_cow
+	// fails and the user's handler gets the fault instead, since it can
+	// page something out to make room.
+	if ((tf->tf_err & (FEC_PR|FEC_WR)) == (FEC_PR|FEC_WR) &&
+f010493b:	8b 46 2c             	mov    0x2c(%esi),%eax
+f010493e:	83 e0 03             	and    $0x3,%eax
+f0104941:	83 f8 03             	cmp    $0x3,%eax
+f0104944:	0f 84 f4 00 00 00    	je     f0104a3e <page_fault_handler+0x126>
+	// utf is a pointer to the UTrapframe in the user exception stack.
+	// If this is the first fault, then the pointer is right below UXSTACKTOP.
+	// Otherwise, the pointer is right below tf->tf_esp, with a 32-bit word offset.
+	// If UXSTACKTOP-PGSIZE <= tf->tf_esp <= UXSTACKTOP-1, then it is a recursive trap, the latter case.
+	struct UTrapframe *utf = (struct UTrapframe *)(
+		(((UXSTACKTOP-PGSIZE)<=(tf->tf_esp))&&((tf->tf_esp)<=(UXSTACKTOP-1)))
+f010494a:	8b 5e 3c             	mov    0x3c(%esi),%ebx
+f010494d:	8d 83 00 10 40 11    	lea    0x11401000(%ebx),%eax
+		?
+		((tf->tf_esp)-(sizeof(struct UTrapframe)+sizeof(uint32_t)))
+f0104953:	83 eb 38             	sub    $0x38,%ebx
+f0104956:	3d 00 10 00 00       	cmp    $0x1000,%eax
+f010495b:	b8 cc ff bf ee       	mov    $0xeebfffcc,%eax
+f0104960:	0f 43 d8             	cmovae %eax,%ebx
+		:
+		(UXSTACKTOP-sizeof(struct UTrapframe))
+	);
+
+	if (!(curenv->env_pgfault_upcall)) {
+f0104963:	e8 db 34 00 00       	call   f0107e43 <cpunum>
+f0104968:	6b c0 74             	imul   $0x74,%eax,%eax
+f010496b:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0104971:	83 78 74 00          	cmpl   $0x0,0x74(%eax)
+f0104975:	0f 84 ff 00 00 00    	je     f0104a7a <page_fault_handler+0x162>
+	// page for its exception stack or can't write to it, or the exception
+	// stack overflows, then destroy the environment that caused the fault.
+	// We can do this with user_mem_assert on the portion of the stack where *utf is stored.
+	// This obviously covers the first two cases.
+	// It also takes care of the third case because the region below UXSTACKTOP-PGSIZE is unmapped.
+	user_mem_assert(curenv, (void *)utf, sizeof(struct UTrapframe), PTE_W|PTE_U|PTE_P);
+f010497b:	e8 c3 34 00 00       	call   f0107e43 <cpunum>
+f0104980:	6a 07                	push   $0x7
+f0104982:	6a 34                	push   $0x34
+f0104984:	53                   	push   %ebx
+f0104985:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104988:	ff b0 28 b0 85 f0    	push   -0xf7a4fd8(%eax)
+f010498e:	e8 05 ea ff ff       	call   f0103398 <user_mem_assert>
+
+	utf->utf_fault_va = fault_va;
+f0104993:	89 3b                	mov    %edi,(%ebx)
+
+	// Copy values from the Trapframe to the UTrapframe.
+	utf->utf_err = tf->tf_err;
+f0104995:	8b 46 2c             	mov    0x2c(%esi),%eax
+f0104998:	89 43 04             	mov    %eax,0x4(%ebx)
+	utf->utf_regs = tf->tf_regs;
+f010499b:	8b 06                	mov    (%esi),%eax
+f010499d:	89 43 08             	mov    %eax,0x8(%ebx)
+f01049a0:	8b 46 04             	mov    0x4(%esi),%eax
+f01049a3:	89 43 0c             	mov    %eax,0xc(%ebx)
+f01049a6:	8b 46 08             	mov    0x8(%esi),%eax
+f01049a9:	89 43 10             	mov    %eax,0x10(%ebx)
+f01049ac:	8b 46 0c             	mov    0xc(%esi),%eax
+f01049af:	89 43 14             	mov    %eax,0x14(%ebx)
+f01049b2:	8b 46 10             	mov    0x10(%esi),%eax
+f01049b5:	89 43 18             	mov    %eax,0x18(%ebx)
+f01049b8:	8b 46 14             	mov    0x14(%esi),%eax
+f01049bb:	89 43 1c             	mov    %eax,0x1c(%ebx)
+f01049be:	8b 46 18             	mov    0x18(%esi),%eax
+f01049c1:	89 43 20             	mov    %eax,0x20(%ebx)
+f01049c4:	8b 46 1c             	mov    0x1c(%esi),%eax
+f01049c7:	89 43 24             	mov    %eax,0x24(%ebx)
+	utf->utf_eip = tf->tf_eip;
+f01049ca:	8b 46 30             	mov    0x30(%esi),%eax
+f01049cd:	89 43 28             	mov    %eax,0x28(%ebx)
+	utf->utf_eflags = tf->tf_eflags;
+f01049d0:	8b 46 38             	mov    0x38(%esi),%eax
+f01049d3:	89 43 2c             	mov    %eax,0x2c(%ebx)
+	utf->utf_esp = tf->tf_esp;
+f01049d6:	8b 46 3c             	mov    0x3c(%esi),%eax
+f01049d9:	89 43 30             	mov    %eax,0x30(%ebx)
+
+	// Set the Trapframe to return to env_pgfault_upcall, with an exception stack at utf.
+	// NOTE I am not confident that this code is correct.
+	// TODO Test that this is correct, and correct it if necessary.
+	tf->tf_eip = (uintptr_t)curenv->env_pgfault_upcall;
+f01049dc:	e8 62 34 00 00       	call   f0107e43 <cpunum>
+f01049e1:	6b c0 74             	imul   $0x74,%eax,%eax
+f01049e4:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01049ea:	8b 40 74             	mov    0x74(%eax),%eax
+f01049ed:	89 46 30             	mov    %eax,0x30(%esi)
+	tf->tf_esp = (uintptr_t)utf;
+f01049f0:	89 5e 3c             	mov    %ebx,0x3c(%esi)
+f01049f3:	83 c4 10             	add    $0x10,%esp
+}
+f01049f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01049f9:	5b                   	pop    %ebx
+f01049fa:	5e                   	pop    %esi
+f01049fb:	5f                   	pop    %edi
+f01049fc:	5d                   	pop    %ebp
+f01049fd:	c3                   	ret
+		panic("page_fault_handler: kernel-mode page fault");
+f01049fe:	83 ec 04             	sub    $0x4,%esp
+f0104a01:	68 90 9c 10 f0       	push   $0xf0109c90
+f0104a06:	68 9b 01 00 00       	push   $0x19b
+f0104a0b:	68 eb 9a 10 f0       	push   $0xf0109aeb
+f0104a10:	e8 2b b6 ff ff       	call   f0100040 <_panic>
+	if (!(tf->tf_err & FEC_PR) && (r = env_segment_fault(curenv, fault_va)) >= 0) {
+f0104a15:	e8 29 34 00 00       	call   f0107e43 <cpunum>
+f0104a1a:	83 ec 08             	sub    $0x8,%esp
+f0104a1d:	57                   	push   %edi
+f0104a1e:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104a21:	ff b0 28 b0 85 f0    	push   -0xf7a4fd8(%eax)
+f0104a27:	e8 9b f0 ff ff       	call   f0103ac7 <env_segment_fault>
+f0104a2c:	83 c4 10             	add    $0x10,%esp
+f0104a2f:	85 c0                	test   %eax,%eax
+f0104a31:	0f 88 04 ff ff ff    	js     f010493b <page_fault_handler+0x23>
+		if (r > 0)
+f0104a37:	7e bd                	jle    f01049f6 <page_fault_handler+0xde>
+			sched_yield();
+f0104a39:	e8 d4 05 00 00       	call   f0105012 <sched_yield>
+	    page_cow(curenv->env_pgdir, (void *) fault_va, &curenv->env_npages) == 0)
+f0104a3e:	e8 00 34 00 00       	call   f0107e43 <cpunum>
+f0104a43:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104a46:	8b 98 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%ebx
+f0104a4c:	83 c3 64             	add    $0x64,%ebx
+f0104a4f:	e8 ef 33 00 00       	call   f0107e43 <cpunum>
+f0104a54:	83 ec 04             	sub    $0x4,%esp
+f0104a57:	53                   	push   %ebx
+f0104a58:	57                   	push   %edi
+f0104a59:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104a5c:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0104a62:	ff 70 60             	push   0x60(%eax)
+f0104a65:	e8 10 e0 ff ff       	call   f0102a7a <page_cow>
+	if ((tf->tf_err & (FEC_PR|FEC_WR)) == (FEC_PR|FEC_WR) &&
+f0104a6a:	83 c4 10             	add    $0x10,%esp
+f0104a6d:	85 c0                	test   %eax,%eax
+f0104a6f:	0f 85 d5 fe ff ff    	jne    f010494a <page_fault_handler+0x32>
+f0104a75:	e9 7c ff ff ff       	jmp    f01049f6 <page_fault_handler+0xde>
+		cprintf("[%08x] user fault va %08x ip %08x\n",
+f0104a7a:	8b 46 30             	mov    0x30(%esi),%eax
+f0104a7d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			curenv->env_id, fault_va, tf->tf_eip);
+f0104a80:	e8 be 33 00 00       	call   f0107e43 <cpunum>
+		cprintf("[%08x] user fault va %08x ip %08x\n",
+f0104a85:	ff 75 e4             	push   -0x1c(%ebp)
+f0104a88:	57                   	push   %edi
+			curenv->env_id, fault_va, tf->tf_eip);
+f0104a89:	6b c0 74             	imul   $0x74,%eax,%eax
+		cprintf("[%08x] user fault va %08x ip %08x\n",
+f0104a8c:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0104a92:	ff 70 48             	push   0x48(%eax)
+f0104a95:	68 bc 9c 10 f0       	push   $0xf0109cbc
+f0104a9a:	e8 4b fa ff ff       	call   f01044ea <cprintf>
+		print_trapframe(tf);
+f0104a9f:	89 34 24             	mov    %esi,(%esp)
+f0104aa2:	e8 d5 fc ff ff       	call   f010477c <print_trapframe>
+		env_destroy(curenv);
+f0104aa7:	e8 97 33 00 00       	call   f0107e43 <cpunum>
+f0104aac:	83 c4 04             	add    $0x4,%esp
+f0104aaf:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104ab2:	ff b0 28 b0 85 f0    	push   -0xf7a4fd8(%eax)
+f0104ab8:	e8 84 f6 ff ff       	call   f0104141 <env_destroy>
+f0104abd:	83 c4 10             	add    $0x10,%esp
+f0104ac0:	e9 b6 fe ff ff       	jmp    f010497b <page_fault_handler+0x63>
+
+f0104ac5 <trap>:
+{
+f0104ac5:	55                   	push   %ebp
+f0104ac6:	89 e5                	mov    %esp,%ebp
+f0104ac8:	57                   	push   %edi
+f0104ac9:	56                   	push   %esi
+f0104aca:	53                   	push   %ebx
+f0104acb:	83 ec 1c             	sub    $0x1c,%esp
+f0104ace:	8b 75 08             	mov    0x8(%ebp),%esi
+	asm volatile("cld" ::: "cc");
+f0104ad1:	fc                   	cld
+	if (panicstr)
+f0104ad2:	83 3d 44 a0 85 f0 00 	cmpl   $0x0,0xf085a044
+f0104ad9:	74 01                	je     f0104adc <trap+0x17>
+		asm volatile("hlt");
+f0104adb:	f4                   	hlt
+	if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED)
+f0104adc:	e8 62 33 00 00       	call   f0107e43 <cpunum>
+f0104ae1:	6b d0 74             	imul   $0x74,%eax,%edx
+f0104ae4:	83 c2 04             	add    $0x4,%edx
+	asm volatile("lock; xchgl %0, %1" :
+f0104ae7:	b8 01 00 00 00       	mov    $0x1,%eax
+f0104aec:	f0 87 82 20 b0 85 f0 	lock xchg %eax,-0xf7a4fe0(%edx)
+f0104af3:	83 f8 02             	cmp    $0x2,%eax
+f0104af6:	74 3f                	je     f0104b37 <trap+0x72>
+	__asm __volatile("pushfl; popl %0" : "=r" (eflags));
+f0104af8:	9c                   	pushf
+f0104af9:	58                   	pop    %eax
+	assert(!(read_eflags() & FL_IF));
+f0104afa:	f6 c4 02             	test   $0x2,%ah
+f0104afd:	75 4a                	jne    f0104b49 <trap+0x84>
+	if ((tf->tf_cs & 3) == 3) {
+f0104aff:	0f b7 46 34          	movzwl 0x34(%esi),%eax
+f0104b03:	83 e0 03             	and    $0x3,%eax
+f0104b06:	66 83 f8 03          	cmp    $0x3,%ax
+f0104b0a:	74 56                	je     f0104b62 <trap+0x9d>
+	last_tf = tf;
+f0104b0c:	89 35 30 9c 85 f0    	mov    %esi,0xf0859c30
+	int page_to_age_first = page_to_age;
+f0104b12:	8b 1d 20 9c 85 f0    	mov    0xf0859c20,%ebx
+	if (tf->tf_trapno == T_PGFLT) {
+f0104b18:	8b 46 28             	mov    0x28(%esi),%eax
+f0104b1b:	83 f8 0e             	cmp    $0xe,%eax
+f0104b1e:	0f 84 e3 00 00 00    	je     f0104c07 <trap+0x142>
+	else if (tf->tf_trapno == T_BRKPT) {
+f0104b24:	83 e8 03             	sub    $0x3,%eax
+f0104b27:	83 f8 2d             	cmp    $0x2d,%eax
+f0104b2a:	0f 87 cd 02 00 00    	ja     f0104dfd <trap+0x338>
+f0104b30:	ff 24 85 e0 9c 10 f0 	jmp    *-0xfef6320(,%eax,4)
+	spin_lock(&kernel_lock);
+f0104b37:	83 ec 0c             	sub    $0xc,%esp
+f0104b3a:	68 a0 54 11 f0       	push   $0xf01154a0
+f0104b3f:	e8 6f 35 00 00       	call   f01080b3 <spin_lock>
+}
+f0104b44:	83 c4 10             	add    $0x10,%esp
+f0104b47:	eb af                	jmp    f0104af8 <trap+0x33>
+	assert(!(read_eflags() & FL_IF));
+f0104b49:	68 f7 9a 10 f0       	push   $0xf0109af7
+f0104b4e:	68 a4 94 10 f0       	push   $0xf01094a4
+f0104b53:	68 63 01 00 00       	push   $0x163
+f0104b58:	68 eb 9a 10 f0       	push   $0xf0109aeb
+f0104b5d:	e8 de b4 ff ff       	call   f0100040 <_panic>
+	spin_lock(&kernel_lock);
+f0104b62:	83 ec 0c             	sub    $0xc,%esp
+f0104b65:	68 a0 54 11 f0       	push   $0xf01154a0
+f0104b6a:	e8 44 35 00 00       	call   f01080b3 <spin_lock>
+		assert(curenv);
+f0104b6f:	e8 cf 32 00 00       	call   f0107e43 <cpunum>
+f0104b74:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104b77:	83 c4 10             	add    $0x10,%esp
+f0104b7a:	83 b8 28 b0 85 f0 00 	cmpl   $0x0,-0xf7a4fd8(%eax)
+f0104b81:	74 3e                	je     f0104bc1 <trap+0xfc>
+		if (curenv->env_status == ENV_DYING) {
+f0104b83:	e8 bb 32 00 00       	call   f0107e43 <cpunum>
+f0104b88:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104b8b:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0104b91:	83 78 54 01          	cmpl   $0x1,0x54(%eax)
+f0104b95:	74 43                	je     f0104bda <trap+0x115>
+		curenv->env_tf = *tf;
+f0104b97:	e8 a7 32 00 00       	call   f0107e43 <cpunum>
+f0104b9c:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104b9f:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0104ba5:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0104baa:	89 c7                	mov    %eax,%edi
+f0104bac:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+		tf = &curenv->env_tf;
+f0104bae:	e8 90 32 00 00       	call   f0107e43 <cpunum>
+f0104bb3:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104bb6:	8b b0 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%esi
+f0104bbc:	e9 4b ff ff ff       	jmp    f0104b0c <trap+0x47>
+		assert(curenv);
+f0104bc1:	68 10 9b 10 f0       	push   $0xf0109b10
+f0104bc6:	68 a4 94 10 f0       	push   $0xf01094a4
+f0104bcb:	68 6b 01 00 00       	push   $0x16b
+f0104bd0:	68 eb 9a 10 f0       	push   $0xf0109aeb
+f0104bd5:	e8 66 b4 ff ff       	call   f0100040 <_panic>
+			env_free(curenv);
+f0104bda:	e8 64 32 00 00       	call   f0107e43 <cpunum>
+f0104bdf:	83 ec 0c             	sub    $0xc,%esp
+f0104be2:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104be5:	ff b0 28 b0 85 f0    	push   -0xf7a4fd8(%eax)
+f0104beb:	e8 ee f2 ff ff       	call   f0103ede <env_free>
+			curenv = NULL;
+f0104bf0:	e8 4e 32 00 00       	call   f0107e43 <cpunum>
+f0104bf5:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104bf8:	c7 80 28 b0 85 f0 00 	movl   $0x0,-0xf7a4fd8(%eax)
+f0104bff:	00 00 00 
+			sched_yield();
+f0104c02:	e8 0b 04 00 00       	call   f0105012 <sched_yield>
+		page_fault_handler(tf);
+f0104c07:	83 ec 0c             	sub    $0xc,%esp
+f0104c0a:	56                   	push   %esi
+f0104c0b:	e8 08 fd ff ff       	call   f0104918 <page_fault_handler>
+		return;
+f0104c10:	83 c4 10             	add    $0x10,%esp
+f0104c13:	eb 0c                	jmp    f0104c21 <trap+0x15c>
+		monitor(tf);    // breakpoint exceptions invoke the kernel monitor
+f0104c15:	83 ec 0c             	sub    $0xc,%esp
+f0104c18:	56                   	push   %esi
+f0104c19:	e8 c1 c6 ff ff       	call   f01012df <monitor>
+		return;
+f0104c1e:	83 c4 10             	add    $0x10,%esp
+	if (curenv && curenv->env_status == ENV_RUNNING)
+f0104c21:	e8 1d 32 00 00       	call   f0107e43 <cpunum>
+f0104c26:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104c29:	83 b8 28 b0 85 f0 00 	cmpl   $0x0,-0xf7a4fd8(%eax)
+f0104c30:	74 18                	je     f0104c4a <trap+0x185>
+f0104c32:	e8 0c 32 00 00       	call   f0107e43 <cpunum>
+f0104c37:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104c3a:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0104c40:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0104c44:	0f 84 fb 01 00 00    	je     f0104e45 <trap+0x380>
+		sched_yield();
+f0104c4a:	e8 c3 03 00 00       	call   f0105012 <sched_yield>
+		tf->tf_regs.reg_eax = syscall(tf->tf_regs.reg_eax, tf->tf_regs.reg_edx, tf->tf_regs.reg_ecx, tf->tf_regs.reg_ebx, tf->tf_regs.reg_edi, tf->tf_regs.reg_esi);
+f0104c4f:	83 ec 08             	sub    $0x8,%esp
+f0104c52:	ff 76 04             	push   0x4(%esi)
+f0104c55:	ff 36                	push   (%esi)
+f0104c57:	ff 76 10             	push   0x10(%esi)
+f0104c5a:	ff 76 18             	push   0x18(%esi)
+f0104c5d:	ff 76 14             	push   0x14(%esi)
+f0104c60:	ff 76 1c             	push   0x1c(%esi)
+f0104c63:	e8 fd 1e 00 00       	call   f0106b65 <syscall>
+f0104c68:	89 46 1c             	mov    %eax,0x1c(%esi)
+		return;
+f0104c6b:	83 c4 20             	add    $0x20,%esp
+f0104c6e:	eb b1                	jmp    f0104c21 <trap+0x15c>
+		cprintf("Spurious interrupt on irq 7\n");
+f0104c70:	83 ec 0c             	sub    $0xc,%esp
+f0104c73:	68 17 9b 10 f0       	push   $0xf0109b17
+f0104c78:	e8 6d f8 ff ff       	call   f01044ea <cprintf>
+		print_trapframe(tf);
+f0104c7d:	89 34 24             	mov    %esi,(%esp)
+f0104c80:	e8 f7 fa ff ff       	call   f010477c <print_trapframe>
+		return;
+f0104c85:	83 c4 10             	add    $0x10,%esp
+f0104c88:	eb 97                	jmp    f0104c21 <trap+0x15c>
+		lapic_eoi();
+f0104c8a:	e8 fb 32 00 00       	call   f0107f8a <lapic_eoi>
+		mem_pressure_update();
+f0104c8f:	e8 f5 cb ff ff       	call   f0101889 <mem_pressure_update>
+		if (num_free_pages <= NPAGESFREE_LOW_THRESHOLD) {
+f0104c94:	a1 5c a0 85 f0       	mov    0xf085a05c,%eax
+f0104c99:	83 f8 10             	cmp    $0x10,%eax
+f0104c9c:	76 55                	jbe    f0104cf3 <trap+0x22e>
+	int num_page_updates = NPAGEUPDATES_FACTOR*NPAGESFREE_LOW_THRESHOLD;
+f0104c9e:	c7 45 e0 20 03 00 00 	movl   $0x320,-0x20(%ebp)
+		if (num_free_pages <= NPAGESFREE_HIGH_THRESHOLD) {
+f0104ca5:	3d 00 01 00 00       	cmp    $0x100,%eax
+f0104caa:	76 40                	jbe    f0104cec <trap+0x227>
+f0104cac:	8b 3d 20 9c 85 f0    	mov    0xf0859c20,%edi
+		for ( ; num_page_updates >= 0; --num_page_updates) {
+f0104cb2:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+			while (!pages[page_to_age].pp_ref) {
+f0104cb5:	8b 35 60 a0 85 f0    	mov    0xf085a060,%esi
+				if ((page_to_age=(page_to_age+1)%npages) == page_to_age_first) {
+f0104cbb:	8b 0d 54 a0 85 f0    	mov    0xf085a054,%ecx
+f0104cc1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+			while (!pages[page_to_age].pp_ref) {
+f0104cc4:	6b c7 1c             	imul   $0x1c,%edi,%eax
+f0104cc7:	8d 14 06             	lea    (%esi,%eax,1),%edx
+f0104cca:	66 83 7a 0a 00       	cmpw   $0x0,0xa(%edx)
+f0104ccf:	75 31                	jne    f0104d02 <trap+0x23d>
+				if ((page_to_age=(page_to_age+1)%npages) == page_to_age_first) {
+f0104cd1:	8d 47 01             	lea    0x1(%edi),%eax
+f0104cd4:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104cd9:	f7 f1                	div    %ecx
+f0104cdb:	89 d7                	mov    %edx,%edi
+f0104cdd:	39 d3                	cmp    %edx,%ebx
+f0104cdf:	75 e3                	jne    f0104cc4 <trap+0x1ff>
+f0104ce1:	89 3d 20 9c 85 f0    	mov    %edi,0xf0859c20
+		sched_yield();
+f0104ce7:	e8 26 03 00 00       	call   f0105012 <sched_yield>
+	int num_page_updates = NPAGEUPDATES_FACTOR*NPAGESFREE_LOW_THRESHOLD;
+f0104cec:	b8 20 03 00 00       	mov    $0x320,%eax
+f0104cf1:	eb 05                	jmp    f0104cf8 <trap+0x233>
+			num_page_updates += NPAGEUPDATES_FACTOR*NPAGESFREE_HIGH_THRESHOLD;
+f0104cf3:	b8 20 35 00 00       	mov    $0x3520,%eax
+			num_page_updates += NPAGEUPDATES_FACTOR*NPAGESFREE_LOW_THRESHOLD;
+f0104cf8:	05 20 03 00 00       	add    $0x320,%eax
+f0104cfd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0104d00:	eb aa                	jmp    f0104cac <trap+0x1e7>
+			for (pp_refs_chain = pages[page_to_age].pp_refs_chain; pp_refs_chain; pp_refs_chain = pp_refs_chain->pc_link) {
+f0104d02:	8b 4a 18             	mov    0x18(%edx),%ecx
+f0104d05:	85 c9                	test   %ecx,%ecx
+f0104d07:	74 6e                	je     f0104d77 <trap+0x2b2>
+				if (*pp_refs_chain->pc_pte & PTE_A) {
+f0104d09:	8b 71 04             	mov    0x4(%ecx),%esi
+f0104d0c:	f6 06 20             	testb  $0x20,(%esi)
+f0104d0f:	75 04                	jne    f0104d15 <trap+0x250>
+			for (pp_refs_chain = pages[page_to_age].pp_refs_chain; pp_refs_chain; pp_refs_chain = pp_refs_chain->pc_link) {
+f0104d11:	8b 09                	mov    (%ecx),%ecx
+f0104d13:	eb f0                	jmp    f0104d05 <trap+0x240>
+					pages[page_to_age].age += PAGE_AGE_INCREMENT_ON_ACCESS;
+f0104d15:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f0104d18:	80 42 0e 64          	addb   $0x64,0xe(%edx)
+                                        pages[page_to_age].nfu_age += PAGE_AGE_INCREMENT_ON_ACCESS;
+f0104d1c:	80 42 0f 64          	addb   $0x64,0xf(%edx)
+					pages[page_to_age].timestamp = counter;
+f0104d20:	8b 1d 28 9c 85 f0    	mov    0xf0859c28,%ebx
+f0104d26:	8b 35 2c 9c 85 f0    	mov    0xf0859c2c,%esi
+f0104d2c:	89 5a 10             	mov    %ebx,0x10(%edx)
+f0104d2f:	89 72 14             	mov    %esi,0x14(%edx)
+					counter++;
+f0104d32:	83 05 28 9c 85 f0 01 	addl   $0x1,0xf0859c28
+f0104d39:	83 15 2c 9c 85 f0 00 	adcl   $0x0,0xf0859c2c
+f0104d40:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+						*(pp_refs_chain->pc_pte) &= ~PTE_A;
+f0104d43:	8b 51 04             	mov    0x4(%ecx),%edx
+f0104d46:	83 22 df             	andl   $0xffffffdf,(%edx)
+					for ( ; pp_refs_chain; pp_refs_chain = pp_refs_chain->pc_link) {
+f0104d49:	8b 09                	mov    (%ecx),%ecx
+f0104d4b:	85 c9                	test   %ecx,%ecx
+f0104d4d:	75 f4                	jne    f0104d43 <trap+0x27e>
+f0104d4f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+			pages[page_to_age].age = (pages[page_to_age].age > MAX_PAGE_AGE ? MAX_PAGE_AGE : pages[page_to_age].age);
+f0104d52:	03 05 60 a0 85 f0    	add    0xf085a060,%eax
+f0104d58:	0f b6 50 0e          	movzbl 0xe(%eax),%edx
+f0104d5c:	b9 fe ff ff ff       	mov    $0xfffffffe,%ecx
+f0104d61:	38 ca                	cmp    %cl,%dl
+f0104d63:	0f 47 d1             	cmova  %ecx,%edx
+f0104d66:	88 50 0e             	mov    %dl,0xe(%eax)
+			pages[page_to_age].nfu_age = (pages[page_to_age].nfu_age > MAX_PAGE_AGE ? MAX_PAGE_AGE : pages[page_to_age].nfu_age);
+f0104d69:	0f b6 50 0f          	movzbl 0xf(%eax),%edx
+f0104d6d:	38 ca                	cmp    %cl,%dl
+f0104d6f:	0f 47 d1             	cmova  %ecx,%edx
+f0104d72:	88 50 0f             	mov    %dl,0xf(%eax)
+			if (!page_accessed) {
+f0104d75:	eb 3a                	jmp    f0104db1 <trap+0x2ec>
+f0104d77:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+			pages[page_to_age].age = (pages[page_to_age].age > MAX_PAGE_AGE ? MAX_PAGE_AGE : pages[page_to_age].age);
+f0104d7a:	03 05 60 a0 85 f0    	add    0xf085a060,%eax
+f0104d80:	0f b6 58 0e          	movzbl 0xe(%eax),%ebx
+			pages[page_to_age].nfu_age = (pages[page_to_age].nfu_age > MAX_PAGE_AGE ? MAX_PAGE_AGE : pages[page_to_age].nfu_age);
+f0104d84:	0f b6 50 0f          	movzbl 0xf(%eax),%edx
+f0104d88:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+f0104d8d:	89 f1                	mov    %esi,%ecx
+f0104d8f:	38 ca                	cmp    %cl,%dl
+f0104d91:	0f 47 d6             	cmova  %esi,%edx
+f0104d94:	88 50 0f             	mov    %dl,0xf(%eax)
+					pages[page_to_age].age = 0;
+f0104d97:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+f0104d9c:	38 d3                	cmp    %dl,%bl
+f0104d9e:	0f 46 d3             	cmovbe %ebx,%edx
+f0104da1:	83 ea 01             	sub    $0x1,%edx
+f0104da4:	84 db                	test   %bl,%bl
+f0104da6:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0104dab:	0f 44 d1             	cmove  %ecx,%edx
+f0104dae:	88 50 0e             	mov    %dl,0xe(%eax)
+			if ((page_to_age=(page_to_age+1)%npages) == page_to_age_first) {
+f0104db1:	8d 47 01             	lea    0x1(%edi),%eax
+f0104db4:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104db9:	f7 35 54 a0 85 f0    	divl   0xf085a054
+f0104dbf:	89 d7                	mov    %edx,%edi
+f0104dc1:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+f0104dc4:	0f 84 17 ff ff ff    	je     f0104ce1 <trap+0x21c>
+		for ( ; num_page_updates >= 0; --num_page_updates) {
+f0104dca:	83 6d e0 01          	subl   $0x1,-0x20(%ebp)
+f0104dce:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0104dd1:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0104dd4:	0f 85 db fe ff ff    	jne    f0104cb5 <trap+0x1f0>
+		end_of_page_age_updates:
+f0104dda:	e9 02 ff ff ff       	jmp    f0104ce1 <trap+0x21c>
+		lapic_eoi();
+f0104ddf:	e8 a6 31 00 00       	call   f0107f8a <lapic_eoi>
+		kbd_intr();
+f0104de4:	e8 5c b8 ff ff       	call   f0100645 <kbd_intr>
+		return;
+f0104de9:	e9 33 fe ff ff       	jmp    f0104c21 <trap+0x15c>
+		lapic_eoi();
+f0104dee:	e8 97 31 00 00       	call   f0107f8a <lapic_eoi>
+		serial_intr();
+f0104df3:	e8 31 b8 ff ff       	call   f0100629 <serial_intr>
+		return;
+f0104df8:	e9 24 fe ff ff       	jmp    f0104c21 <trap+0x15c>
+	print_trapframe(tf);
+f0104dfd:	83 ec 0c             	sub    $0xc,%esp
+f0104e00:	56                   	push   %esi
+f0104e01:	e8 76 f9 ff ff       	call   f010477c <print_trapframe>
+	if (tf->tf_cs == GD_KT)
+f0104e06:	83 c4 10             	add    $0x10,%esp
+f0104e09:	66 83 7e 34 08       	cmpw   $0x8,0x34(%esi)
+f0104e0e:	74 1e                	je     f0104e2e <trap+0x369>
+		env_destroy(curenv);
+f0104e10:	e8 2e 30 00 00       	call   f0107e43 <cpunum>
+f0104e15:	83 ec 0c             	sub    $0xc,%esp
+f0104e18:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104e1b:	ff b0 28 b0 85 f0    	push   -0xf7a4fd8(%eax)
+f0104e21:	e8 1b f3 ff ff       	call   f0104141 <env_destroy>
+		return;
+f0104e26:	83 c4 10             	add    $0x10,%esp
+f0104e29:	e9 f3 fd ff ff       	jmp    f0104c21 <trap+0x15c>
+		panic("unhandled trap in kernel");
+f0104e2e:	83 ec 04             	sub    $0x4,%esp
+f0104e31:	68 34 9b 10 f0       	push   $0xf0109b34
+f0104e36:	68 49 01 00 00       	push   $0x149
+f0104e3b:	68 eb 9a 10 f0       	push   $0xf0109aeb
+f0104e40:	e8 fb b1 ff ff       	call   f0100040 <_panic>
+		env_run(curenv);
+f0104e45:	e8 f9 2f 00 00       	call   f0107e43 <cpunum>
+f0104e4a:	83 ec 0c             	sub    $0xc,%esp
+f0104e4d:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104e50:	ff b0 28 b0 85 f0    	push   -0xf7a4fd8(%eax)
+f0104e56:	e8 0f f4 ff ff       	call   f010426a <env_run>
+f0104e5b:	90                   	nop
+
+f0104e5c <T_DIVIDE_HANDLER>:
+ * To denote the end of the vectors data segment, T_DEFAULT is the last defined trap, since we can identify it by the fact that it is not a valid trap number.
+ * It is important that TRAPHANDLER be called with increasing trap numbers, otherwise initializing the IDT will require more work than is necessary.
+ * By the end of this file, 'vectors == { T_DIVIDE, &T_DIVIDE_HANDLER, T_DEBUG, &T_DEBUG_HANDLER, ... , T_DEFAULT, T_DEFAULT_HANDLER }.
+ */
+vectors:
+  TRAPHANDLER_NOEC1(T_DIVIDE)
+f0104e5c:	6a 00                	push   $0x0
+f0104e5e:	6a 00                	push   $0x0
+f0104e60:	e9 15 06 01 00       	jmp    f011547a <_alltraps>
+f0104e65:	90                   	nop
+
+f0104e66 <T_DEBUG_HANDLER>:
+  TRAPHANDLER_NOEC1(T_DEBUG)
+f0104e66:	6a 00                	push   $0x0
+f0104e68:	6a 01                	push   $0x1
+f0104e6a:	e9 0b 06 01 00       	jmp    f011547a <_alltraps>
+f0104e6f:	90                   	nop
+
+f0104e70 <T_NMI_HANDLER>:
+  TRAPHANDLER_NOEC1(T_NMI)
+f0104e70:	6a 00                	push   $0x0
+f0104e72:	6a 02                	push   $0x2
+f0104e74:	e9 01 06 01 00       	jmp    f011547a <_alltraps>
+f0104e79:	90                   	nop
+
+f0104e7a <T_BRKPT_HANDLER>:
+  TRAPHANDLER_NOEC1(T_BRKPT)
+f0104e7a:	6a 00                	push   $0x0
+f0104e7c:	6a 03                	push   $0x3
+f0104e7e:	e9 f7 05 01 00       	jmp    f011547a <_alltraps>
+f0104e83:	90                   	nop
+
+f0104e84 <T_OFLOW_HANDLER>:
+  TRAPHANDLER_NOEC1(T_OFLOW)
+f0104e84:	6a 00                	push   $0x0
+f0104e86:	6a 04                	push   $0x4
+f0104e88:	e9 ed 05 01 00       	jmp    f011547a <_alltraps>
+f0104e8d:	90                   	nop
+
+f0104e8e <T_BOUND_HANDLER>:
+  TRAPHANDLER_NOEC1(T_BOUND)
+f0104e8e:	6a 00                	push   $0x0
+f0104e90:	6a 05                	push   $0x5
+f0104e92:	e9 e3 05 01 00       	jmp    f011547a <_alltraps>
+f0104e97:	90                   	nop
+
+f0104e98 <T_ILLOP_HANDLER>:
+  TRAPHANDLER_NOEC1(T_ILLOP)
+f0104e98:	6a 00                	push   $0x0
+f0104e9a:	6a 06                	push   $0x6
+f0104e9c:	e9 d9 05 01 00       	jmp    f011547a <_alltraps>
+f0104ea1:	90                   	nop
+
+f0104ea2 <T_DEVICE_HANDLER>:
+  TRAPHANDLER_NOEC1(T_DEVICE)
+f0104ea2:	6a 00                	push   $0x0
+f0104ea4:	6a 07                	push   $0x7
+f0104ea6:	e9 cf 05 01 00       	jmp    f011547a <_alltraps>
+f0104eab:	90                   	nop
+
+f0104eac <T_DBLFLT_HANDLER>:
+  TRAPHANDLER1(T_DBLFLT)
+f0104eac:	6a 08                	push   $0x8
+f0104eae:	e9 c7 05 01 00       	jmp    f011547a <_alltraps>
+f0104eb3:	90                   	nop
+
+f0104eb4 <T_TSS_HANDLER>:
+  TRAPHANDLER1(T_TSS)
+f0104eb4:	6a 0a                	push   $0xa
+f0104eb6:	e9 bf 05 01 00       	jmp    f011547a <_alltraps>
+f0104ebb:	90                   	nop
+
+f0104ebc <T_SEGNP_HANDLER>:
+  TRAPHANDLER1(T_SEGNP)
+f0104ebc:	6a 0b                	push   $0xb
+f0104ebe:	e9 b7 05 01 00       	jmp    f011547a <_alltraps>
+f0104ec3:	90                   	nop
+
+f0104ec4 <T_STACK_HANDLER>:
+  TRAPHANDLER1(T_STACK)
+f0104ec4:	6a 0c                	push   $0xc
+f0104ec6:	e9 af 05 01 00       	jmp    f011547a <_alltraps>
+f0104ecb:	90                   	nop
+
+f0104ecc <T_GPFLT_HANDLER>:
+  TRAPHANDLER1(T_GPFLT)
+f0104ecc:	6a 0d                	push   $0xd
+f0104ece:	e9 a7 05 01 00       	jmp    f011547a <_alltraps>
+f0104ed3:	90                   	nop
+
+f0104ed4 <T_PGFLT_HANDLER>:
+  TRAPHANDLER1(T_PGFLT)
+f0104ed4:	6a 0e                	push   $0xe
+f0104ed6:	e9 9f 05 01 00       	jmp    f011547a <_alltraps>
+f0104edb:	90                   	nop
+
+f0104edc <T_FPERR_HANDLER>:
+  TRAPHANDLER_NOEC1(T_FPERR)
+f0104edc:	6a 00                	push   $0x0
+f0104ede:	6a 10                	push   $0x10
+f0104ee0:	e9 95 05 01 00       	jmp    f011547a <_alltraps>
+f0104ee5:	90                   	nop
+
+f0104ee6 <T_ALIGN_HANDLER>:
+  TRAPHANDLER1(T_ALIGN)
+f0104ee6:	6a 11                	push   $0x11
+f0104ee8:	e9 8d 05 01 00       	jmp    f011547a <_alltraps>
+f0104eed:	90                   	nop
+
+f0104eee <T_MCHK_HANDLER>:
+  TRAPHANDLER_NOEC1(T_MCHK)
+f0104eee:	6a 00                	push   $0x0
+f0104ef0:	6a 12                	push   $0x12
+f0104ef2:	e9 83 05 01 00       	jmp    f011547a <_alltraps>
+f0104ef7:	90                   	nop
+
+f0104ef8 <T_SIMDERR_HANDLER>:
+  TRAPHANDLER_NOEC1(T_SIMDERR)
+f0104ef8:	6a 00                	push   $0x0
+f0104efa:	6a 13                	push   $0x13
+f0104efc:	e9 79 05 01 00       	jmp    f011547a <_alltraps>
+f0104f01:	90                   	nop
+
+f0104f02 <IRQ_TIMER_HANDLER>:
+  TRAPHANDLER_NOEC(IRQ_TIMER_HANDLER, IRQ_OFFSET+IRQ_TIMER)
+f0104f02:	6a 00                	push   $0x0
+f0104f04:	6a 20                	push   $0x20
+f0104f06:	e9 6f 05 01 00       	jmp    f011547a <_alltraps>
+f0104f0b:	90                   	nop
+
+f0104f0c <IRQ_KBD_HANDLER>:
+  TRAPHANDLER_NOEC(IRQ_KBD_HANDLER, IRQ_OFFSET+IRQ_KBD)
+f0104f0c:	6a 00                	push   $0x0
+f0104f0e:	6a 21                	push   $0x21
+f0104f10:	e9 65 05 01 00       	jmp    f011547a <_alltraps>
+f0104f15:	90                   	nop
+
+f0104f16 <IRQ_SERIAL_HANDLER>:
+  TRAPHANDLER_NOEC(IRQ_SERIAL_HANDLER, IRQ_OFFSET+IRQ_SERIAL)
+f0104f16:	6a 00                	push   $0x0
+f0104f18:	6a 24                	push   $0x24
+f0104f1a:	e9 5b 05 01 00       	jmp    f011547a <_alltraps>
+f0104f1f:	90                   	nop
+
+f0104f20 <IRQ_SPURIOUS_HANDLER>:
+  TRAPHANDLER_NOEC(IRQ_SPURIOUS_HANDLER, IRQ_OFFSET+IRQ_SPURIOUS)
+f0104f20:	6a 00                	push   $0x0
+f0104f22:	6a 27                	push   $0x27
+f0104f24:	e9 51 05 01 00       	jmp    f011547a <_alltraps>
+f0104f29:	90                   	nop
+
+f0104f2a <IRQ_IDE_HANDLER>:
+  TRAPHANDLER_NOEC(IRQ_IDE_HANDLER, IRQ_OFFSET+IRQ_IDE)
+f0104f2a:	6a 00                	push   $0x0
+f0104f2c:	6a 2e                	push   $0x2e
+f0104f2e:	e9 47 05 01 00       	jmp    f011547a <_alltraps>
+f0104f33:	90                   	nop
+
+f0104f34 <T_SYSCALL_HANDLER>:
+  TRAPHANDLER_NOEC1(T_SYSCALL)
+f0104f34:	6a 00                	push   $0x0
+f0104f36:	6a 30                	push   $0x30
+f0104f38:	e9 3d 05 01 00       	jmp    f011547a <_alltraps>
+f0104f3d:	90                   	nop
+
+f0104f3e <T_DEFAULT_HANDLER>:
+  TRAPHANDLER_NOEC1(T_DEFAULT)
+f0104f3e:	6a 00                	push   $0x0
+f0104f40:	68 f4 01 00 00       	push   $0x1f4
+f0104f45:	e9 30 05 01 00       	jmp    f011547a <_alltraps>
+
+f0104f4a <sched_halt>:
+// Halt this CPU when there is nothing to do. Wait until the
+// timer interrupt wakes it up. This function never returns.
+//
+void
+sched_halt(void)
+{
+f0104f4a:	55                   	push   %ebp
+f0104f4b:	89 e5                	mov    %esp,%ebp
+f0104f4d:	83 ec 08             	sub    $0x8,%esp
+	int i;
+
+	// For debugging and testing purposes, if there are no runnable
+	// environments in the system, then drop into the kernel monitor.
+	for (i = 0; i < NENV; i++) {
+f0104f50:	a1 e0 92 85 f0       	mov    0xf08592e0,%eax
+f0104f55:	8d 50 54             	lea    0x54(%eax),%edx
+f0104f58:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if ((envs[i].env_status == ENV_RUNNABLE ||
+		     envs[i].env_status == ENV_RUNNING ||
+f0104f5d:	8b 02                	mov    (%edx),%eax
+f0104f5f:	83 e8 01             	sub    $0x1,%eax
+		if ((envs[i].env_status == ENV_RUNNABLE ||
+f0104f62:	81 c2 40 01 00 00    	add    $0x140,%edx
+f0104f68:	83 f8 02             	cmp    $0x2,%eax
+f0104f6b:	76 3c                	jbe    f0104fa9 <sched_halt+0x5f>
+	for (i = 0; i < NENV; i++) {
+f0104f6d:	83 c1 01             	add    $0x1,%ecx
+f0104f70:	81 f9 00 04 00 00    	cmp    $0x400,%ecx
+f0104f76:	75 e5                	jne    f0104f5d <sched_halt+0x13>
+		     envs[i].env_status == ENV_DYING))
+			break;
+	}
+	if (i == NENV) {
+		cprintf("No runnable environments in the system!\n");
+f0104f78:	83 ec 0c             	sub    $0xc,%esp
+f0104f7b:	68 f0 9d 10 f0       	push   $0xf0109df0
+f0104f80:	e8 65 f5 ff ff       	call   f01044ea <cprintf>
+f0104f85:	83 c4 10             	add    $0x10,%esp
+		while (1)
+			monitor(NULL);
+f0104f88:	83 ec 0c             	sub    $0xc,%esp
+f0104f8b:	6a 00                	push   $0x0
+f0104f8d:	e8 4d c3 ff ff       	call   f01012df <monitor>
+f0104f92:	83 c4 10             	add    $0x10,%esp
+f0104f95:	eb f1                	jmp    f0104f88 <sched_halt+0x3e>
+f0104f97:	50                   	push   %eax
+f0104f98:	68 08 86 10 f0       	push   $0xf0108608
+f0104f9d:	6a 46                	push   $0x46
+f0104f9f:	68 19 9e 10 f0       	push   $0xf0109e19
+f0104fa4:	e8 97 b0 ff ff       	call   f0100040 <_panic>
+	}
+
+	// Mark that no environment is running on this CPU
+	curenv = NULL;
+f0104fa9:	e8 95 2e 00 00       	call   f0107e43 <cpunum>
+f0104fae:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104fb1:	c7 80 28 b0 85 f0 00 	movl   $0x0,-0xf7a4fd8(%eax)
+f0104fb8:	00 00 00 
+	lcr3(PADDR(kern_pgdir));
+f0104fbb:	a1 58 a0 85 f0       	mov    0xf085a058,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0104fc0:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0104fc5:	76 d0                	jbe    f0104f97 <sched_halt+0x4d>
+	return (physaddr_t)kva - KERNBASE;
+f0104fc7:	05 00 00 00 10       	add    $0x10000000,%eax
+	__asm __volatile("movl %0,%%cr3" : : "r" (val));
+f0104fcc:	0f 22 d8             	mov    %eax,%cr3
+
+	// Mark that this CPU is in the HALT state, so that when
+	// timer interupts come in, we know we should re-acquire the
+	// big kernel lock
+	xchg(&thiscpu->cpu_status, CPU_HALTED);
+f0104fcf:	e8 6f 2e 00 00       	call   f0107e43 <cpunum>
+f0104fd4:	6b d0 74             	imul   $0x74,%eax,%edx
+f0104fd7:	83 c2 04             	add    $0x4,%edx
+	asm volatile("lock; xchgl %0, %1" :
+f0104fda:	b8 02 00 00 00       	mov    $0x2,%eax
+f0104fdf:	f0 87 82 20 b0 85 f0 	lock xchg %eax,-0xf7a4fe0(%edx)
+	spin_unlock(&kernel_lock);
+f0104fe6:	83 ec 0c             	sub    $0xc,%esp
+f0104fe9:	68 a0 54 11 f0       	push   $0xf01154a0
+f0104fee:	e8 5a 31 00 00       	call   f010814d <spin_unlock>
+	asm volatile("pause");
+f0104ff3:	f3 90                	pause
+		"movl %0, %%esp\n"
+		"pushl $0\n"
+		"pushl $0\n"
+		"sti\n"
+		"hlt\n"
+	: : "a" (thiscpu->cpu_ts.ts_esp0));
+f0104ff5:	e8 49 2e 00 00       	call   f0107e43 <cpunum>
+f0104ffa:	6b c0 74             	imul   $0x74,%eax,%eax
+	asm volatile (
+f0104ffd:	8b 80 30 b0 85 f0    	mov    -0xf7a4fd0(%eax),%eax
+f0105003:	bd 00 00 00 00       	mov    $0x0,%ebp
+f0105008:	89 c4                	mov    %eax,%esp
+f010500a:	6a 00                	push   $0x0
+f010500c:	6a 00                	push   $0x0
+f010500e:	fb                   	sti
+f010500f:	f4                   	hlt
+}
+f0105010:	c9                   	leave
+f0105011:	c3                   	ret
+
+f0105012 <sched_yield>:
+{
+f0105012:	55                   	push   %ebp
+f0105013:	89 e5                	mov    %esp,%ebp
+f0105015:	56                   	push   %esi
+f0105016:	53                   	push   %ebx
+	int i, end = (1+(curenv ? curenv-envs : -1))%NENV, is_first = 1;
+f0105017:	e8 27 2e 00 00       	call   f0107e43 <cpunum>
+f010501c:	6b c0 74             	imul   $0x74,%eax,%eax
+f010501f:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0105024:	83 b8 28 b0 85 f0 00 	cmpl   $0x0,-0xf7a4fd8(%eax)
+f010502b:	74 2f                	je     f010505c <sched_yield+0x4a>
+f010502d:	e8 11 2e 00 00       	call   f0107e43 <cpunum>
+f0105032:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105035:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f010503b:	2b 05 e0 92 85 f0    	sub    0xf08592e0,%eax
+f0105041:	c1 f8 06             	sar    $0x6,%eax
+f0105044:	69 c0 cd cc cc cc    	imul   $0xcccccccd,%eax,%eax
+f010504a:	83 c0 01             	add    $0x1,%eax
+f010504d:	99                   	cltd
+f010504e:	c1 ea 16             	shr    $0x16,%edx
+f0105051:	8d 0c 10             	lea    (%eax,%edx,1),%ecx
+f0105054:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+f010505a:	29 d1                	sub    %edx,%ecx
+		if (envs[i].env_status == ENV_RUNNABLE) {
+f010505c:	8b 1d e0 92 85 f0    	mov    0xf08592e0,%ebx
+	for (i = end; is_first || i != end; i = (i+1)%NENV, is_first = 0) {
+f0105062:	89 c8                	mov    %ecx,%eax
+	int i, end = (1+(curenv ? curenv-envs : -1))%NENV, is_first = 1;
+f0105064:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (i = end; is_first || i != end; i = (i+1)%NENV, is_first = 0) {
+f0105069:	be 00 00 00 00       	mov    $0x0,%esi
+f010506e:	eb 20                	jmp    f0105090 <sched_yield+0x7e>
+		if (envs[i].env_status == ENV_RUNNABLE) {
+f0105070:	8d 14 80             	lea    (%eax,%eax,4),%edx
+f0105073:	c1 e2 06             	shl    $0x6,%edx
+f0105076:	01 da                	add    %ebx,%edx
+f0105078:	83 7a 54 02          	cmpl   $0x2,0x54(%edx)
+f010507c:	74 4b                	je     f01050c9 <sched_yield+0xb7>
+	for (i = end; is_first || i != end; i = (i+1)%NENV, is_first = 0) {
+f010507e:	83 c0 01             	add    $0x1,%eax
+f0105081:	99                   	cltd
+f0105082:	c1 ea 16             	shr    $0x16,%edx
+f0105085:	01 d0                	add    %edx,%eax
+f0105087:	25 ff 03 00 00       	and    $0x3ff,%eax
+f010508c:	29 d0                	sub    %edx,%eax
+f010508e:	89 f2                	mov    %esi,%edx
+f0105090:	85 d2                	test   %edx,%edx
+f0105092:	75 dc                	jne    f0105070 <sched_yield+0x5e>
+f0105094:	39 c8                	cmp    %ecx,%eax
+f0105096:	75 d8                	jne    f0105070 <sched_yield+0x5e>
+	if (curenv && curenv->env_status == ENV_RUNNING) {
+f0105098:	e8 a6 2d 00 00       	call   f0107e43 <cpunum>
+f010509d:	6b c0 74             	imul   $0x74,%eax,%eax
+f01050a0:	83 b8 28 b0 85 f0 00 	cmpl   $0x0,-0xf7a4fd8(%eax)
+f01050a7:	74 14                	je     f01050bd <sched_yield+0xab>
+f01050a9:	e8 95 2d 00 00       	call   f0107e43 <cpunum>
+f01050ae:	6b c0 74             	imul   $0x74,%eax,%eax
+f01050b1:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01050b7:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f01050bb:	74 15                	je     f01050d2 <sched_yield+0xc0>
+	sched_halt();
+f01050bd:	e8 88 fe ff ff       	call   f0104f4a <sched_halt>
+}
+f01050c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01050c5:	5b                   	pop    %ebx
+f01050c6:	5e                   	pop    %esi
+f01050c7:	5d                   	pop    %ebp
+f01050c8:	c3                   	ret
+			env_run(&envs[i]);
+f01050c9:	83 ec 0c             	sub    $0xc,%esp
+f01050cc:	52                   	push   %edx
+f01050cd:	e8 98 f1 ff ff       	call   f010426a <env_run>
+		env_run(curenv);
+f01050d2:	e8 6c 2d 00 00       	call   f0107e43 <cpunum>
+f01050d7:	83 ec 0c             	sub    $0xc,%esp
+f01050da:	6b c0 74             	imul   $0x74,%eax,%eax
+f01050dd:	ff b0 28 b0 85 f0    	push   -0xf7a4fd8(%eax)
+f01050e3:	e8 82 f1 ff ff       	call   f010426a <env_run>
+
+f01050e8 <check_user_range>:
+// Return -E_INVAL unless [va, va + npg*PGSIZE) is a page-aligned,
+// non-empty range that lies entirely below UTOP.
+static int
+check_user_range(void *va, size_t npg)
+{
+	if ((((uint32_t)va) >= UTOP) || ((uint32_t)va)%PGSIZE) {
+f01050e8:	3d ff ff bf ee       	cmp    $0xeebfffff,%eax
+f01050ed:	77 1f                	ja     f010510e <check_user_range+0x26>
+f01050ef:	a9 ff 0f 00 00       	test   $0xfff,%eax
+f01050f4:	75 1e                	jne    f0105114 <check_user_range+0x2c>
+		return -E_INVAL;
+	}
+	if (npg == 0 || npg > (UTOP - (uint32_t)va) / PGSIZE) {
+f01050f6:	85 d2                	test   %edx,%edx
+f01050f8:	74 20                	je     f010511a <check_user_range+0x32>
+f01050fa:	b9 00 00 c0 ee       	mov    $0xeec00000,%ecx
+f01050ff:	29 c1                	sub    %eax,%ecx
+f0105101:	89 c8                	mov    %ecx,%eax
+f0105103:	c1 e8 0c             	shr    $0xc,%eax
+		return -E_INVAL;
+	}
+	return 0;
+f0105106:	39 d0                	cmp    %edx,%eax
+f0105108:	19 c0                	sbb    %eax,%eax
+f010510a:	83 e0 fd             	and    $0xfffffffd,%eax
+f010510d:	c3                   	ret
+		return -E_INVAL;
+f010510e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105113:	c3                   	ret
+f0105114:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105119:	c3                   	ret
+		return -E_INVAL;
+f010511a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+f010511f:	c3                   	ret
+
+f0105120 <sys_env_set_pgfault_upcall>:
+{
+f0105120:	55                   	push   %ebp
+f0105121:	89 e5                	mov    %esp,%ebp
+f0105123:	83 ec 1c             	sub    $0x1c,%esp
+	if (envid2env(envid, &e, 1) < 0) {
+f0105126:	6a 01                	push   $0x1
+f0105128:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f010512b:	50                   	push   %eax
+f010512c:	ff 75 08             	push   0x8(%ebp)
+f010512f:	e8 97 e3 ff ff       	call   f01034cb <envid2env>
+f0105134:	83 c4 10             	add    $0x10,%esp
+f0105137:	85 c0                	test   %eax,%eax
+f0105139:	78 10                	js     f010514b <sys_env_set_pgfault_upcall+0x2b>
+	e->env_pgfault_upcall = func;
+f010513b:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010513e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0105141:	89 50 74             	mov    %edx,0x74(%eax)
+	return 0;
+f0105144:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0105149:	c9                   	leave
+f010514a:	c3                   	ret
+		return -E_BAD_ENV;
+f010514b:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0105150:	eb f7                	jmp    f0105149 <sys_env_set_pgfault_upcall+0x29>
+
+f0105152 <sys_env_set_status>:
+{
+f0105152:	55                   	push   %ebp
+f0105153:	89 e5                	mov    %esp,%ebp
+f0105155:	53                   	push   %ebx
+f0105156:	83 ec 18             	sub    $0x18,%esp
+f0105159:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (envid2env(envid, &e, 1) < 0) {
+f010515c:	6a 01                	push   $0x1
+f010515e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0105161:	50                   	push   %eax
+f0105162:	ff 75 08             	push   0x8(%ebp)
+f0105165:	e8 61 e3 ff ff       	call   f01034cb <envid2env>
+f010516a:	83 c4 10             	add    $0x10,%esp
+f010516d:	85 c0                	test   %eax,%eax
+f010516f:	78 1a                	js     f010518b <sys_env_set_status+0x39>
+	if ((status != ENV_RUNNABLE) && (status != ENV_NOT_RUNNABLE)) {
+f0105171:	8d 43 fe             	lea    -0x2(%ebx),%eax
+f0105174:	a9 fd ff ff ff       	test   $0xfffffffd,%eax
+f0105179:	75 17                	jne    f0105192 <sys_env_set_status+0x40>
+	e->env_status = status;
+f010517b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010517e:	89 58 54             	mov    %ebx,0x54(%eax)
+	return 0;
+f0105181:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0105186:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0105189:	c9                   	leave
+f010518a:	c3                   	ret
+		return -E_BAD_ENV;
+f010518b:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0105190:	eb f4                	jmp    f0105186 <sys_env_set_status+0x34>
+		return -E_INVAL;
+f0105192:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105197:	eb ed                	jmp    f0105186 <sys_env_set_status+0x34>
+
+f0105199 <sys_page_clean>:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if the range isn't page-aligned, is empty, or reaches UTOP.
+static int
+sys_page_clean(envid_t envid, void *va, size_t npg)
+{
+f0105199:	55                   	push   %ebp
+f010519a:	89 e5                	mov    %esp,%ebp
+f010519c:	57                   	push   %edi
+f010519d:	56                   	push   %esi
+f010519e:	53                   	push   %ebx
+f010519f:	83 ec 20             	sub    $0x20,%esp
+f01051a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01051a5:	8b 7d 10             	mov    0x10(%ebp),%edi
+	struct Env *e;
+	size_t i;
+
+	if (envid2env(envid, &e, 1) < 0) {
+f01051a8:	6a 01                	push   $0x1
+f01051aa:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01051ad:	50                   	push   %eax
+f01051ae:	ff 75 08             	push   0x8(%ebp)
+f01051b1:	e8 15 e3 ff ff       	call   f01034cb <envid2env>
+f01051b6:	83 c4 10             	add    $0x10,%esp
+f01051b9:	85 c0                	test   %eax,%eax
+f01051bb:	78 40                	js     f01051fd <sys_page_clean+0x64>
+		return -E_BAD_ENV;
+	}
+	if (check_user_range(va, npg) < 0) {
+f01051bd:	89 fa                	mov    %edi,%edx
+f01051bf:	89 d8                	mov    %ebx,%eax
+f01051c1:	e8 22 ff ff ff       	call   f01050e8 <check_user_range>
+f01051c6:	85 c0                	test   %eax,%eax
+f01051c8:	78 3a                	js     f0105204 <sys_page_clean+0x6b>
+		return -E_INVAL;
+	}
+
+	for (i = 0; i < npg; i++, va += PGSIZE)
+f01051ca:	be 00 00 00 00       	mov    $0x0,%esi
+f01051cf:	eb 1b                	jmp    f01051ec <sys_page_clean+0x53>
+		page_clean(e->env_pgdir, va);
+f01051d1:	83 ec 08             	sub    $0x8,%esp
+f01051d4:	53                   	push   %ebx
+f01051d5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01051d8:	ff 70 60             	push   0x60(%eax)
+f01051db:	e8 5a d8 ff ff       	call   f0102a3a <page_clean>
+	for (i = 0; i < npg; i++, va += PGSIZE)
+f01051e0:	83 c6 01             	add    $0x1,%esi
+f01051e3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f01051e9:	83 c4 10             	add    $0x10,%esp
+f01051ec:	39 fe                	cmp    %edi,%esi
+f01051ee:	75 e1                	jne    f01051d1 <sys_page_clean+0x38>
+	return 0;
+f01051f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01051f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01051f8:	5b                   	pop    %ebx
+f01051f9:	5e                   	pop    %esi
+f01051fa:	5f                   	pop    %edi
+f01051fb:	5d                   	pop    %ebp
+f01051fc:	c3                   	ret
+		return -E_BAD_ENV;
+f01051fd:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0105202:	eb f1                	jmp    f01051f5 <sys_page_clean+0x5c>
+		return -E_INVAL;
+f0105204:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105209:	eb ea                	jmp    f01051f5 <sys_page_clean+0x5c>
+
+f010520b <sys_env_set_rss>:
+{
+f010520b:	55                   	push   %ebp
+f010520c:	89 e5                	mov    %esp,%ebp
+f010520e:	56                   	push   %esi
+f010520f:	53                   	push   %ebx
+f0105210:	83 ec 14             	sub    $0x14,%esp
+f0105213:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0105216:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if (envid2env(envid, &e, 1) < 0) {
+f0105219:	6a 01                	push   $0x1
+f010521b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f010521e:	50                   	push   %eax
+f010521f:	ff 75 08             	push   0x8(%ebp)
+f0105222:	e8 a4 e2 ff ff       	call   f01034cb <envid2env>
+f0105227:	83 c4 10             	add    $0x10,%esp
+f010522a:	85 c0                	test   %eax,%eax
+f010522c:	78 61                	js     f010528f <sys_env_set_rss+0x84>
+	if (min < 0 || max < 0 || (max && max < min) || min > curenv->env_rss_min ||
+f010522e:	89 f0                	mov    %esi,%eax
+f0105230:	09 d8                	or     %ebx,%eax
+f0105232:	78 62                	js     f0105296 <sys_env_set_rss+0x8b>
+f0105234:	85 db                	test   %ebx,%ebx
+f0105236:	74 04                	je     f010523c <sys_env_set_rss+0x31>
+f0105238:	39 de                	cmp    %ebx,%esi
+f010523a:	7f 61                	jg     f010529d <sys_env_set_rss+0x92>
+f010523c:	e8 02 2c 00 00       	call   f0107e43 <cpunum>
+f0105241:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105244:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f010524a:	39 70 68             	cmp    %esi,0x68(%eax)
+f010524d:	7c 55                	jl     f01052a4 <sys_env_set_rss+0x99>
+	    (curenv->env_rss_max && (!max || max > curenv->env_rss_max))) {
+f010524f:	e8 ef 2b 00 00       	call   f0107e43 <cpunum>
+f0105254:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105257:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+	if (min < 0 || max < 0 || (max && max < min) || min > curenv->env_rss_min ||
+f010525d:	83 78 6c 00          	cmpl   $0x0,0x6c(%eax)
+f0105261:	74 17                	je     f010527a <sys_env_set_rss+0x6f>
+	    (curenv->env_rss_max && (!max || max > curenv->env_rss_max))) {
+f0105263:	85 db                	test   %ebx,%ebx
+f0105265:	74 44                	je     f01052ab <sys_env_set_rss+0xa0>
+f0105267:	e8 d7 2b 00 00       	call   f0107e43 <cpunum>
+f010526c:	6b c0 74             	imul   $0x74,%eax,%eax
+f010526f:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105275:	39 58 6c             	cmp    %ebx,0x6c(%eax)
+f0105278:	7c 38                	jl     f01052b2 <sys_env_set_rss+0xa7>
+	e->env_rss_min = min;
+f010527a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010527d:	89 70 68             	mov    %esi,0x68(%eax)
+	e->env_rss_max = max;
+f0105280:	89 58 6c             	mov    %ebx,0x6c(%eax)
+	return 0;
+f0105283:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0105288:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010528b:	5b                   	pop    %ebx
+f010528c:	5e                   	pop    %esi
+f010528d:	5d                   	pop    %ebp
+f010528e:	c3                   	ret
+		return -E_BAD_ENV;
+f010528f:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0105294:	eb f2                	jmp    f0105288 <sys_env_set_rss+0x7d>
+		return -E_INVAL;
+f0105296:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010529b:	eb eb                	jmp    f0105288 <sys_env_set_rss+0x7d>
+f010529d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01052a2:	eb e4                	jmp    f0105288 <sys_env_set_rss+0x7d>
+f01052a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01052a9:	eb dd                	jmp    f0105288 <sys_env_set_rss+0x7d>
+f01052ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01052b0:	eb d6                	jmp    f0105288 <sys_env_set_rss+0x7d>
+f01052b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01052b7:	eb cf                	jmp    f0105288 <sys_env_set_rss+0x7d>
+
+f01052b9 <ipc_can_deliver>:
+static bool
+ipc_can_deliver(struct Env *dstenv)
+{
+	return dstenv->env_ipc_recving && dstenv->env_status == ENV_NOT_RUNNABLE
+		&& (!dstenv->env_pagein_pager || dstenv->env_pagein_pager == curenv->env_id)
+		&& (!dstenv->env_ipc_callee || dstenv->env_ipc_callee == curenv->env_id);
+f01052b9:	80 78 78 00          	cmpb   $0x0,0x78(%eax)
+f01052bd:	74 65                	je     f0105324 <ipc_can_deliver+0x6b>
+{
+f01052bf:	55                   	push   %ebp
+f01052c0:	89 e5                	mov    %esp,%ebp
+f01052c2:	56                   	push   %esi
+f01052c3:	53                   	push   %ebx
+f01052c4:	89 c3                	mov    %eax,%ebx
+		&& (!dstenv->env_ipc_callee || dstenv->env_ipc_callee == curenv->env_id);
+f01052c6:	b8 00 00 00 00       	mov    $0x0,%eax
+	return dstenv->env_ipc_recving && dstenv->env_status == ENV_NOT_RUNNABLE
+f01052cb:	83 7b 54 04          	cmpl   $0x4,0x54(%ebx)
+f01052cf:	74 07                	je     f01052d8 <ipc_can_deliver+0x1f>
+		&& (!dstenv->env_ipc_callee || dstenv->env_ipc_callee == curenv->env_id);
+f01052d1:	83 e0 01             	and    $0x1,%eax
+}
+f01052d4:	5b                   	pop    %ebx
+f01052d5:	5e                   	pop    %esi
+f01052d6:	5d                   	pop    %ebp
+f01052d7:	c3                   	ret
+		&& (!dstenv->env_pagein_pager || dstenv->env_pagein_pager == curenv->env_id)
+f01052d8:	8b b3 34 01 00 00    	mov    0x134(%ebx),%esi
+f01052de:	85 f6                	test   %esi,%esi
+f01052e0:	75 28                	jne    f010530a <ipc_can_deliver+0x51>
+		&& (!dstenv->env_ipc_callee || dstenv->env_ipc_callee == curenv->env_id);
+f01052e2:	8b 9b a8 00 00 00    	mov    0xa8(%ebx),%ebx
+f01052e8:	b8 01 00 00 00       	mov    $0x1,%eax
+f01052ed:	85 db                	test   %ebx,%ebx
+f01052ef:	74 e0                	je     f01052d1 <ipc_can_deliver+0x18>
+f01052f1:	e8 4d 2b 00 00       	call   f0107e43 <cpunum>
+f01052f6:	6b c0 74             	imul   $0x74,%eax,%eax
+f01052f9:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01052ff:	39 58 48             	cmp    %ebx,0x48(%eax)
+f0105302:	0f 94 c0             	sete   %al
+f0105305:	0f b6 c0             	movzbl %al,%eax
+f0105308:	eb c7                	jmp    f01052d1 <ipc_can_deliver+0x18>
+		&& (!dstenv->env_pagein_pager || dstenv->env_pagein_pager == curenv->env_id)
+f010530a:	e8 34 2b 00 00       	call   f0107e43 <cpunum>
+f010530f:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105312:	8b 90 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%edx
+		&& (!dstenv->env_ipc_callee || dstenv->env_ipc_callee == curenv->env_id);
+f0105318:	b8 00 00 00 00       	mov    $0x0,%eax
+		&& (!dstenv->env_pagein_pager || dstenv->env_pagein_pager == curenv->env_id)
+f010531d:	3b 72 48             	cmp    0x48(%edx),%esi
+f0105320:	75 af                	jne    f01052d1 <ipc_can_deliver+0x18>
+f0105322:	eb be                	jmp    f01052e2 <ipc_can_deliver+0x29>
+		&& (!dstenv->env_ipc_callee || dstenv->env_ipc_callee == curenv->env_id);
+f0105324:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105329:	83 e0 01             	and    $0x1,%eax
+}
+f010532c:	c3                   	ret
+
+f010532d <sys_getenvid>:
+{
+f010532d:	55                   	push   %ebp
+f010532e:	89 e5                	mov    %esp,%ebp
+f0105330:	83 ec 08             	sub    $0x8,%esp
+	return curenv->env_id;
+f0105333:	e8 0b 2b 00 00       	call   f0107e43 <cpunum>
+f0105338:	6b c0 74             	imul   $0x74,%eax,%eax
+f010533b:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105341:	8b 40 48             	mov    0x48(%eax),%eax
+}
+f0105344:	c9                   	leave
+f0105345:	c3                   	ret
+
+f0105346 <env_share>:
+{
+f0105346:	55                   	push   %ebp
+f0105347:	89 e5                	mov    %esp,%ebp
+f0105349:	53                   	push   %ebx
+f010534a:	83 ec 04             	sub    $0x4,%esp
+f010534d:	89 c3                	mov    %eax,%ebx
+	assert(NENV - num_free_envs > 0);
+f010534f:	a1 64 a0 85 f0       	mov    0xf085a064,%eax
+f0105354:	3d 00 04 00 00       	cmp    $0x400,%eax
+f0105359:	74 20                	je     f010537b <env_share+0x35>
+	return MAX((int) (npages / (NENV - num_free_envs)), e->env_rss_min);
+f010535b:	b9 00 04 00 00       	mov    $0x400,%ecx
+f0105360:	29 c1                	sub    %eax,%ecx
+f0105362:	a1 54 a0 85 f0       	mov    0xf085a054,%eax
+f0105367:	ba 00 00 00 00       	mov    $0x0,%edx
+f010536c:	f7 f1                	div    %ecx
+f010536e:	8b 53 68             	mov    0x68(%ebx),%edx
+f0105371:	39 d0                	cmp    %edx,%eax
+f0105373:	0f 4c c2             	cmovl  %edx,%eax
+}
+f0105376:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0105379:	c9                   	leave
+f010537a:	c3                   	ret
+	assert(NENV - num_free_envs > 0);
+f010537b:	68 26 9e 10 f0       	push   $0xf0109e26
+f0105380:	68 a4 94 10 f0       	push   $0xf01094a4
+f0105385:	68 37 01 00 00       	push   $0x137
+f010538a:	68 3f 9e 10 f0       	push   $0xf0109e3f
+f010538f:	e8 ac ac ff ff       	call   f0100040 <_panic>
+
+f0105394 <sys_page_reclaim>:
+{
+f0105394:	55                   	push   %ebp
+f0105395:	89 e5                	mov    %esp,%ebp
+f0105397:	56                   	push   %esi
+f0105398:	53                   	push   %ebx
+f0105399:	83 ec 10             	sub    $0x10,%esp
+f010539c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (curenv->env_type != ENV_TYPE_PAGE || envid2env(envid, &e, 0) < 0) {
+f010539f:	e8 9f 2a 00 00       	call   f0107e43 <cpunum>
+f01053a4:	6b c0 74             	imul   $0x74,%eax,%eax
+f01053a7:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01053ad:	83 78 50 02          	cmpl   $0x2,0x50(%eax)
+f01053b1:	75 70                	jne    f0105423 <sys_page_reclaim+0x8f>
+f01053b3:	83 ec 04             	sub    $0x4,%esp
+f01053b6:	6a 00                	push   $0x0
+f01053b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f01053bb:	50                   	push   %eax
+f01053bc:	ff 75 08             	push   0x8(%ebp)
+f01053bf:	e8 07 e1 ff ff       	call   f01034cb <envid2env>
+f01053c4:	83 c4 10             	add    $0x10,%esp
+f01053c7:	85 c0                	test   %eax,%eax
+f01053c9:	78 5f                	js     f010542a <sys_page_reclaim+0x96>
+	if ((((uint32_t)va) >= UTOP) || ((uint32_t)va)%PGSIZE) {
+f01053cb:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f01053d1:	77 5e                	ja     f0105431 <sys_page_reclaim+0x9d>
+f01053d3:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f01053d9:	75 5d                	jne    f0105438 <sys_page_reclaim+0xa4>
+	if ((e->env_rss_max && e->env_npages >= e->env_rss_max) ||
+f01053db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f01053de:	8b 50 6c             	mov    0x6c(%eax),%edx
+f01053e1:	85 d2                	test   %edx,%edx
+f01053e3:	74 05                	je     f01053ea <sys_page_reclaim+0x56>
+f01053e5:	3b 50 64             	cmp    0x64(%eax),%edx
+f01053e8:	7e 55                	jle    f010543f <sys_page_reclaim+0xab>
+f01053ea:	83 3d 5c a0 85 f0 33 	cmpl   $0x33,0xf085a05c
+f01053f1:	77 0c                	ja     f01053ff <sys_page_reclaim+0x6b>
+	    (num_free_pages < SOFT_MIN_FREE_PAGES && e->env_npages > env_share(e))) {
+f01053f3:	8b 70 64             	mov    0x64(%eax),%esi
+f01053f6:	e8 4b ff ff ff       	call   f0105346 <env_share>
+f01053fb:	39 c6                	cmp    %eax,%esi
+f01053fd:	7f 47                	jg     f0105446 <sys_page_reclaim+0xb2>
+	return page_reclaim(curenv, va, slot);
+f01053ff:	e8 3f 2a 00 00       	call   f0107e43 <cpunum>
+f0105404:	83 ec 04             	sub    $0x4,%esp
+f0105407:	ff 75 10             	push   0x10(%ebp)
+f010540a:	53                   	push   %ebx
+f010540b:	6b c0 74             	imul   $0x74,%eax,%eax
+f010540e:	ff b0 28 b0 85 f0    	push   -0xf7a4fd8(%eax)
+f0105414:	e8 f6 d2 ff ff       	call   f010270f <page_reclaim>
+f0105419:	83 c4 10             	add    $0x10,%esp
+}
+f010541c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010541f:	5b                   	pop    %ebx
+f0105420:	5e                   	pop    %esi
+f0105421:	5d                   	pop    %ebp
+f0105422:	c3                   	ret
+		return -E_BAD_ENV;
+f0105423:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0105428:	eb f2                	jmp    f010541c <sys_page_reclaim+0x88>
+f010542a:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f010542f:	eb eb                	jmp    f010541c <sys_page_reclaim+0x88>
+		return -E_INVAL;
+f0105431:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105436:	eb e4                	jmp    f010541c <sys_page_reclaim+0x88>
+f0105438:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010543d:	eb dd                	jmp    f010541c <sys_page_reclaim+0x88>
+		return -E_NO_MEM;
+f010543f:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0105444:	eb d6                	jmp    f010541c <sys_page_reclaim+0x88>
+f0105446:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010544b:	eb cf                	jmp    f010541c <sys_page_reclaim+0x88>
+
+f010544d <sys_page_split>:
+{
+f010544d:	55                   	push   %ebp
+f010544e:	89 e5                	mov    %esp,%ebp
+f0105450:	53                   	push   %ebx
+f0105451:	83 ec 18             	sub    $0x18,%esp
+f0105454:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (envid2env(envid, &e, 1) < 0) {
+f0105457:	6a 01                	push   $0x1
+f0105459:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f010545c:	50                   	push   %eax
+f010545d:	ff 75 08             	push   0x8(%ebp)
+f0105460:	e8 66 e0 ff ff       	call   f01034cb <envid2env>
+f0105465:	83 c4 10             	add    $0x10,%esp
+f0105468:	85 c0                	test   %eax,%eax
+f010546a:	78 24                	js     f0105490 <sys_page_split+0x43>
+	if ((uint32_t)va >= UTOP) {
+f010546c:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f0105472:	77 23                	ja     f0105497 <sys_page_split+0x4a>
+	page_split(e->env_pgdir, va);
+f0105474:	83 ec 08             	sub    $0x8,%esp
+f0105477:	53                   	push   %ebx
+f0105478:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010547b:	ff 70 60             	push   0x60(%eax)
+f010547e:	e8 81 c7 ff ff       	call   f0101c04 <page_split>
+	return 0;
+f0105483:	83 c4 10             	add    $0x10,%esp
+f0105486:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010548b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010548e:	c9                   	leave
+f010548f:	c3                   	ret
+		return -E_BAD_ENV;
+f0105490:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0105495:	eb f4                	jmp    f010548b <sys_page_split+0x3e>
+		return -E_INVAL;
+f0105497:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010549c:	eb ed                	jmp    f010548b <sys_page_split+0x3e>
+
+f010549e <futex_lookup>:
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+
+	// UTOP is UENVS, so this takes in the envs array
+	if ((uintptr_t) addr >= UENVS + PTSIZE || (uintptr_t) addr % 4 != 0)
+f010549e:	3d ff ff ff ee       	cmp    $0xeeffffff,%eax
+f01054a3:	77 68                	ja     f010550d <futex_lookup+0x6f>
+{
+f01054a5:	55                   	push   %ebp
+f01054a6:	89 e5                	mov    %esp,%ebp
+f01054a8:	56                   	push   %esi
+f01054a9:	53                   	push   %ebx
+f01054aa:	83 ec 10             	sub    $0x10,%esp
+f01054ad:	89 c3                	mov    %eax,%ebx
+f01054af:	89 d6                	mov    %edx,%esi
+		return NULL;
+f01054b1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uintptr_t) addr >= UENVS + PTSIZE || (uintptr_t) addr % 4 != 0)
+f01054b6:	f6 c3 03             	test   $0x3,%bl
+f01054b9:	75 4b                	jne    f0105506 <futex_lookup+0x68>
+	if (!(pp = page_lookup(curenv->env_pgdir, (void *) addr, &pte)) || !(*pte & PTE_U))
+f01054bb:	e8 83 29 00 00       	call   f0107e43 <cpunum>
+f01054c0:	83 ec 04             	sub    $0x4,%esp
+f01054c3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+f01054c6:	52                   	push   %edx
+f01054c7:	53                   	push   %ebx
+f01054c8:	6b c0 74             	imul   $0x74,%eax,%eax
+f01054cb:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01054d1:	ff 70 60             	push   0x60(%eax)
+f01054d4:	e8 d6 d0 ff ff       	call   f01025af <page_lookup>
+f01054d9:	83 c4 10             	add    $0x10,%esp
+f01054dc:	85 c0                	test   %eax,%eax
+f01054de:	74 26                	je     f0105506 <futex_lookup+0x68>
+f01054e0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+f01054e3:	f6 02 04             	testb  $0x4,(%edx)
+f01054e6:	74 2b                	je     f0105513 <futex_lookup+0x75>
+	return (pp - pages) << PGSHIFT;
+f01054e8:	89 c2                	mov    %eax,%edx
+f01054ea:	2b 15 60 a0 85 f0    	sub    0xf085a060,%edx
+f01054f0:	c1 fa 02             	sar    $0x2,%edx
+f01054f3:	69 d2 b7 6d db b6    	imul   $0xb6db6db7,%edx,%edx
+f01054f9:	c1 e2 0c             	shl    $0xc,%edx
+		return NULL;
+	*pa_store = page2pa(pp) + PGOFF(addr);
+f01054fc:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+f0105502:	01 da                	add    %ebx,%edx
+f0105504:	89 16                	mov    %edx,(%esi)
+	return pp;
+}
+f0105506:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0105509:	5b                   	pop    %ebx
+f010550a:	5e                   	pop    %esi
+f010550b:	5d                   	pop    %ebp
+f010550c:	c3                   	ret
+		return NULL;
+f010550d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0105512:	c3                   	ret
+		return NULL;
+f0105513:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105518:	eb ec                	jmp    f0105506 <futex_lookup+0x68>
+
+f010551a <sys_futex_wake>:
+// Returns the number woken, or < 0 on error.  Errors are:
+//	-E_INVAL if addr is not 4-byte aligned, or not mapped below UTOP
+//		or in the envs array (see futex_lookup).
+static int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+f010551a:	55                   	push   %ebp
+f010551b:	89 e5                	mov    %esp,%ebp
+f010551d:	83 ec 18             	sub    $0x18,%esp
+	physaddr_t pa;
+
+	if (!futex_lookup(addr, &pa))
+f0105520:	8d 55 f4             	lea    -0xc(%ebp),%edx
+f0105523:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105526:	e8 73 ff ff ff       	call   f010549e <futex_lookup>
+f010552b:	85 c0                	test   %eax,%eax
+f010552d:	74 15                	je     f0105544 <sys_futex_wake+0x2a>
+		return -E_INVAL;
+	return env_futex_wake(pa, sizeof(uint32_t), n);
+f010552f:	83 ec 04             	sub    $0x4,%esp
+f0105532:	ff 75 0c             	push   0xc(%ebp)
+f0105535:	6a 04                	push   $0x4
+f0105537:	ff 75 f4             	push   -0xc(%ebp)
+f010553a:	e8 2c e9 ff ff       	call   f0103e6b <env_futex_wake>
+f010553f:	83 c4 10             	add    $0x10,%esp
+}
+f0105542:	c9                   	leave
+f0105543:	c3                   	ret
+		return -E_INVAL;
+f0105544:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105549:	eb f7                	jmp    f0105542 <sys_futex_wake+0x28>
+
+f010554b <ipc_check_pages>:
+{
+f010554b:	55                   	push   %ebp
+f010554c:	89 e5                	mov    %esp,%ebp
+f010554e:	57                   	push   %edi
+f010554f:	56                   	push   %esi
+f0105550:	53                   	push   %ebx
+f0105551:	83 ec 2c             	sub    $0x2c,%esp
+f0105554:	89 c6                	mov    %eax,%esi
+f0105556:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f0105559:	89 d7                	mov    %edx,%edi
+f010555b:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+f010555e:	89 cb                	mov    %ecx,%ebx
+f0105560:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+	if (check_user_range(srcva, npg) < 0) {
+f0105563:	89 ca                	mov    %ecx,%edx
+f0105565:	e8 7e fb ff ff       	call   f01050e8 <check_user_range>
+f010556a:	85 c0                	test   %eax,%eax
+f010556c:	0f 88 b2 00 00 00    	js     f0105624 <ipc_check_pages+0xd9>
+	if (((perm & (PTE_U | PTE_P)) ^ (PTE_U | PTE_P)) | (perm & (~(PTE_U | PTE_P | PTE_AVAIL | PTE_W)))) {
+f0105572:	81 e7 fd f1 ff ff    	and    $0xfffff1fd,%edi
+f0105578:	83 ff 05             	cmp    $0x5,%edi
+f010557b:	0f 85 aa 00 00 00    	jne    f010562b <ipc_check_pages+0xe0>
+		if (!(*pp = page_lookup(curenv->env_pgdir, srcva + i*PGSIZE, &pte))) {
+f0105581:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+f0105584:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+f010558a:	eb 03                	jmp    f010558f <ipc_check_pages+0x44>
+f010558c:	83 eb 01             	sub    $0x1,%ebx
+	for (i = npg; i-- > 0; ) {
+f010558f:	85 db                	test   %ebx,%ebx
+f0105591:	74 43                	je     f01055d6 <ipc_check_pages+0x8b>
+		if (!(*pp = page_lookup(curenv->env_pgdir, srcva + i*PGSIZE, &pte))) {
+f0105593:	e8 ab 28 00 00       	call   f0107e43 <cpunum>
+f0105598:	83 ec 04             	sub    $0x4,%esp
+f010559b:	57                   	push   %edi
+f010559c:	89 da                	mov    %ebx,%edx
+f010559e:	c1 e2 0c             	shl    $0xc,%edx
+f01055a1:	01 f2                	add    %esi,%edx
+f01055a3:	52                   	push   %edx
+f01055a4:	6b c0 74             	imul   $0x74,%eax,%eax
+f01055a7:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01055ad:	ff 70 60             	push   0x60(%eax)
+f01055b0:	e8 fa cf ff ff       	call   f01025af <page_lookup>
+f01055b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f01055b8:	89 01                	mov    %eax,(%ecx)
+f01055ba:	83 c4 10             	add    $0x10,%esp
+f01055bd:	85 c0                	test   %eax,%eax
+f01055bf:	74 71                	je     f0105632 <ipc_check_pages+0xe7>
+		if ((perm & PTE_W) && !(*pte & PTE_W)) {
+f01055c1:	f6 45 d4 02          	testb  $0x2,-0x2c(%ebp)
+f01055c5:	74 c5                	je     f010558c <ipc_check_pages+0x41>
+f01055c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01055ca:	f6 00 02             	testb  $0x2,(%eax)
+f01055cd:	75 bd                	jne    f010558c <ipc_check_pages+0x41>
+			return -E_INVAL;
+f01055cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01055d4:	eb 61                	jmp    f0105637 <ipc_check_pages+0xec>
+	return 0;
+f01055d6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (perm & PTE_W) {
+f01055db:	f6 45 d4 02          	testb  $0x2,-0x2c(%ebp)
+f01055df:	74 56                	je     f0105637 <ipc_check_pages+0xec>
+f01055e1:	8b 75 cc             	mov    -0x34(%ebp),%esi
+			page_lookup(curenv->env_pgdir, srcva + i*PGSIZE, &pte);
+f01055e4:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+f01055e7:	eb 2d                	jmp    f0105616 <ipc_check_pages+0xcb>
+f01055e9:	e8 55 28 00 00       	call   f0107e43 <cpunum>
+f01055ee:	83 ec 04             	sub    $0x4,%esp
+f01055f1:	57                   	push   %edi
+f01055f2:	56                   	push   %esi
+f01055f3:	6b c0 74             	imul   $0x74,%eax,%eax
+f01055f6:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01055fc:	ff 70 60             	push   0x60(%eax)
+f01055ff:	e8 ab cf ff ff       	call   f01025af <page_lookup>
+			*pte |= PTE_D;
+f0105604:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105607:	83 08 40             	orl    $0x40,(%eax)
+		for (i = 0; i < npg; i++) {
+f010560a:	83 c3 01             	add    $0x1,%ebx
+f010560d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0105613:	83 c4 10             	add    $0x10,%esp
+f0105616:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0105619:	39 c3                	cmp    %eax,%ebx
+f010561b:	75 cc                	jne    f01055e9 <ipc_check_pages+0x9e>
+	return 0;
+f010561d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105622:	eb 13                	jmp    f0105637 <ipc_check_pages+0xec>
+		return -E_INVAL;
+f0105624:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105629:	eb 0c                	jmp    f0105637 <ipc_check_pages+0xec>
+		return -E_INVAL;
+f010562b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105630:	eb 05                	jmp    f0105637 <ipc_check_pages+0xec>
+			return -E_INVAL;
+f0105632:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+f0105637:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010563a:	5b                   	pop    %ebx
+f010563b:	5e                   	pop    %esi
+f010563c:	5f                   	pop    %edi
+f010563d:	5d                   	pop    %ebp
+f010563e:	c3                   	ret
+
+f010563f <sys_futex_wait>:
+{
+f010563f:	55                   	push   %ebp
+f0105640:	89 e5                	mov    %esp,%ebp
+f0105642:	53                   	push   %ebx
+f0105643:	83 ec 14             	sub    $0x14,%esp
+	if (!(pp = futex_lookup(addr, &pa)))
+f0105646:	8d 55 f4             	lea    -0xc(%ebp),%edx
+f0105649:	8b 45 08             	mov    0x8(%ebp),%eax
+f010564c:	e8 4d fe ff ff       	call   f010549e <futex_lookup>
+f0105651:	85 c0                	test   %eax,%eax
+f0105653:	74 77                	je     f01056cc <sys_futex_wait+0x8d>
+	if (*(uint32_t *) KADDR(pa) != val || (ref >= 0 && pp->pp_ref != ref))
+f0105655:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+	if (PGNUM(pa) >= npages)
+f0105658:	89 da                	mov    %ebx,%edx
+f010565a:	c1 ea 0c             	shr    $0xc,%edx
+f010565d:	3b 15 54 a0 85 f0    	cmp    0xf085a054,%edx
+f0105663:	73 21                	jae    f0105686 <sys_futex_wait+0x47>
+f0105665:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0105668:	39 8b 00 00 00 f0    	cmp    %ecx,-0x10000000(%ebx)
+f010566e:	75 63                	jne    f01056d3 <sys_futex_wait+0x94>
+f0105670:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0105674:	78 25                	js     f010569b <sys_futex_wait+0x5c>
+f0105676:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+f010567a:	3b 45 10             	cmp    0x10(%ebp),%eax
+f010567d:	74 1c                	je     f010569b <sys_futex_wait+0x5c>
+		return 0;
+f010567f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105684:	eb 52                	jmp    f01056d8 <sys_futex_wait+0x99>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0105686:	53                   	push   %ebx
+f0105687:	68 e4 85 10 f0       	push   $0xf01085e4
+f010568c:	68 da 04 00 00       	push   $0x4da
+f0105691:	68 3f 9e 10 f0       	push   $0xf0109e3f
+f0105696:	e8 a5 a9 ff ff       	call   f0100040 <_panic>
+	env_futex_wait(curenv, pa);
+f010569b:	e8 a3 27 00 00       	call   f0107e43 <cpunum>
+f01056a0:	83 ec 08             	sub    $0x8,%esp
+f01056a3:	53                   	push   %ebx
+f01056a4:	6b c0 74             	imul   $0x74,%eax,%eax
+f01056a7:	ff b0 28 b0 85 f0    	push   -0xf7a4fd8(%eax)
+f01056ad:	e8 52 e7 ff ff       	call   f0103e04 <env_futex_wait>
+	curenv->env_tf.tf_regs.reg_eax = 0;
+f01056b2:	e8 8c 27 00 00       	call   f0107e43 <cpunum>
+f01056b7:	6b c0 74             	imul   $0x74,%eax,%eax
+f01056ba:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01056c0:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+	sched_yield();
+f01056c7:	e8 46 f9 ff ff       	call   f0105012 <sched_yield>
+		return -E_INVAL;
+f01056cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01056d1:	eb 05                	jmp    f01056d8 <sys_futex_wait+0x99>
+		return 0;
+f01056d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01056d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01056db:	c9                   	leave
+f01056dc:	c3                   	ret
+
+f01056dd <ipc_block_sender>:
+{
+f01056dd:	55                   	push   %ebp
+f01056de:	89 e5                	mov    %esp,%ebp
+f01056e0:	57                   	push   %edi
+f01056e1:	56                   	push   %esi
+f01056e2:	53                   	push   %ebx
+f01056e3:	83 ec 0c             	sub    $0xc,%esp
+f01056e6:	89 c3                	mov    %eax,%ebx
+f01056e8:	89 d6                	mov    %edx,%esi
+f01056ea:	89 cf                	mov    %ecx,%edi
+	curenv->env_ipc_page = p;
+f01056ec:	e8 52 27 00 00       	call   f0107e43 <cpunum>
+f01056f1:	6b c0 74             	imul   $0x74,%eax,%eax
+f01056f4:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01056fa:	8b 55 10             	mov    0x10(%ebp),%edx
+f01056fd:	89 90 94 00 00 00    	mov    %edx,0x94(%eax)
+	curenv->env_ipc_srcva_sending = srcva;
+f0105703:	e8 3b 27 00 00       	call   f0107e43 <cpunum>
+f0105708:	6b c0 74             	imul   $0x74,%eax,%eax
+f010570b:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105711:	89 b8 98 00 00 00    	mov    %edi,0x98(%eax)
+	curenv->env_ipc_npg_sending = npg;
+f0105717:	e8 27 27 00 00       	call   f0107e43 <cpunum>
+f010571c:	6b c0 74             	imul   $0x74,%eax,%eax
+f010571f:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105725:	8b 55 08             	mov    0x8(%ebp),%edx
+f0105728:	89 90 9c 00 00 00    	mov    %edx,0x9c(%eax)
+	curenv->env_ipc_value_sending = value;
+f010572e:	e8 10 27 00 00       	call   f0107e43 <cpunum>
+f0105733:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105736:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f010573c:	89 b0 a0 00 00 00    	mov    %esi,0xa0(%eax)
+	curenv->env_ipc_perm_sending = perm;
+f0105742:	e8 fc 26 00 00       	call   f0107e43 <cpunum>
+f0105747:	6b c0 74             	imul   $0x74,%eax,%eax
+f010574a:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105750:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0105753:	89 90 a4 00 00 00    	mov    %edx,0xa4(%eax)
+	if (!dstenv->env_ipc_blocked_sender) {
+f0105759:	8b 83 ac 00 00 00    	mov    0xac(%ebx),%eax
+f010575f:	85 c0                	test   %eax,%eax
+f0105761:	74 3a                	je     f010579d <ipc_block_sender+0xc0>
+		for (e = dstenv->env_ipc_blocked_sender; e->env_ipc_blocked_sender_chain; e = e->env_ipc_blocked_sender_chain) ;
+f0105763:	89 c3                	mov    %eax,%ebx
+f0105765:	8b 80 b0 00 00 00    	mov    0xb0(%eax),%eax
+f010576b:	85 c0                	test   %eax,%eax
+f010576d:	75 f4                	jne    f0105763 <ipc_block_sender+0x86>
+		e->env_ipc_blocked_sender_chain = curenv;
+f010576f:	e8 cf 26 00 00       	call   f0107e43 <cpunum>
+f0105774:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105777:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f010577d:	89 83 b0 00 00 00    	mov    %eax,0xb0(%ebx)
+	curenv->env_status = ENV_NOT_RUNNABLE;
+f0105783:	e8 bb 26 00 00       	call   f0107e43 <cpunum>
+f0105788:	6b c0 74             	imul   $0x74,%eax,%eax
+f010578b:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105791:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+	sched_yield();
+f0105798:	e8 75 f8 ff ff       	call   f0105012 <sched_yield>
+		dstenv->env_ipc_blocked_sender = curenv;
+f010579d:	e8 a1 26 00 00       	call   f0107e43 <cpunum>
+f01057a2:	6b c0 74             	imul   $0x74,%eax,%eax
+f01057a5:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01057ab:	89 83 ac 00 00 00    	mov    %eax,0xac(%ebx)
+f01057b1:	eb d0                	jmp    f0105783 <ipc_block_sender+0xa6>
+
+f01057b3 <sys_yield>:
+{
+f01057b3:	55                   	push   %ebp
+f01057b4:	89 e5                	mov    %esp,%ebp
+f01057b6:	83 ec 08             	sub    $0x8,%esp
+	sched_yield();
+f01057b9:	e8 54 f8 ff ff       	call   f0105012 <sched_yield>
+
+f01057be <sys_page_unmap_range>:
+{
+f01057be:	55                   	push   %ebp
+f01057bf:	89 e5                	mov    %esp,%ebp
+f01057c1:	56                   	push   %esi
+f01057c2:	53                   	push   %ebx
+f01057c3:	83 ec 14             	sub    $0x14,%esp
+f01057c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01057c9:	8b 75 10             	mov    0x10(%ebp),%esi
+	if (envid2env(envid, &e, 1) < 0) {
+f01057cc:	6a 01                	push   $0x1
+f01057ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f01057d1:	50                   	push   %eax
+f01057d2:	ff 75 08             	push   0x8(%ebp)
+f01057d5:	e8 f1 dc ff ff       	call   f01034cb <envid2env>
+f01057da:	83 c4 10             	add    $0x10,%esp
+f01057dd:	85 c0                	test   %eax,%eax
+f01057df:	78 2d                	js     f010580e <sys_page_unmap_range+0x50>
+	if (check_user_range(va, npg) < 0) {
+f01057e1:	89 f2                	mov    %esi,%edx
+f01057e3:	89 d8                	mov    %ebx,%eax
+f01057e5:	e8 fe f8 ff ff       	call   f01050e8 <check_user_range>
+f01057ea:	85 c0                	test   %eax,%eax
+f01057ec:	78 27                	js     f0105815 <sys_page_unmap_range+0x57>
+	page_remove_range(e->env_pgdir, va, npg, &e->env_npages);
+f01057ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f01057f1:	8d 50 64             	lea    0x64(%eax),%edx
+f01057f4:	52                   	push   %edx
+f01057f5:	56                   	push   %esi
+f01057f6:	53                   	push   %ebx
+f01057f7:	ff 70 60             	push   0x60(%eax)
+f01057fa:	e8 2c d7 ff ff       	call   f0102f2b <page_remove_range>
+	return 0;
+f01057ff:	83 c4 10             	add    $0x10,%esp
+f0105802:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0105807:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010580a:	5b                   	pop    %ebx
+f010580b:	5e                   	pop    %esi
+f010580c:	5d                   	pop    %ebp
+f010580d:	c3                   	ret
+		return -E_BAD_ENV;
+f010580e:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0105813:	eb f2                	jmp    f0105807 <sys_page_unmap_range+0x49>
+		return -E_INVAL;
+f0105815:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010581a:	eb eb                	jmp    f0105807 <sys_page_unmap_range+0x49>
+
+f010581c <ipc_map_pages>:
+{
+f010581c:	55                   	push   %ebp
+f010581d:	89 e5                	mov    %esp,%ebp
+f010581f:	57                   	push   %edi
+f0105820:	56                   	push   %esi
+f0105821:	53                   	push   %ebx
+f0105822:	83 ec 1c             	sub    $0x1c,%esp
+f0105825:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0105828:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	for (i = 0; i < npg; i++) {
+f010582b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010582e:	89 d6                	mov    %edx,%esi
+	int r = 0;
+f0105830:	b8 00 00 00 00       	mov    $0x0,%eax
+	for (i = 0; i < npg; i++) {
+f0105835:	bf 00 00 00 00       	mov    $0x0,%edi
+		if ((r = page_insert(dstenv->env_pgdir, p, dstva + i*PGSIZE, perm, &dstenv->env_npages)) < 0) {
+f010583a:	8d 51 64             	lea    0x64(%ecx),%edx
+f010583d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+	for (i = 0; i < npg; i++) {
+f0105840:	eb 03                	jmp    f0105845 <ipc_map_pages+0x29>
+f0105842:	83 c7 01             	add    $0x1,%edi
+f0105845:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+f0105848:	74 45                	je     f010588f <ipc_map_pages+0x73>
+		if (!(p = page_lookup(srcenv->env_pgdir, srcva + i*PGSIZE, NULL))) {
+f010584a:	83 ec 04             	sub    $0x4,%esp
+f010584d:	6a 00                	push   $0x0
+f010584f:	56                   	push   %esi
+f0105850:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105853:	ff 70 60             	push   0x60(%eax)
+f0105856:	e8 54 cd ff ff       	call   f01025af <page_lookup>
+f010585b:	83 c4 10             	add    $0x10,%esp
+f010585e:	85 c0                	test   %eax,%eax
+f0105860:	74 44                	je     f01058a6 <ipc_map_pages+0x8a>
+		if ((r = page_insert(dstenv->env_pgdir, p, dstva + i*PGSIZE, perm, &dstenv->env_npages)) < 0) {
+f0105862:	83 ec 0c             	sub    $0xc,%esp
+f0105865:	ff 75 dc             	push   -0x24(%ebp)
+f0105868:	ff 75 10             	push   0x10(%ebp)
+f010586b:	53                   	push   %ebx
+f010586c:	50                   	push   %eax
+f010586d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105870:	ff 70 60             	push   0x60(%eax)
+f0105873:	e8 00 ce ff ff       	call   f0102678 <page_insert>
+f0105878:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f010587e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0105884:	83 c4 20             	add    $0x20,%esp
+f0105887:	85 c0                	test   %eax,%eax
+f0105889:	79 b7                	jns    f0105842 <ipc_map_pages+0x26>
+f010588b:	89 c3                	mov    %eax,%ebx
+f010588d:	eb 05                	jmp    f0105894 <ipc_map_pages+0x78>
+f010588f:	89 c3                	mov    %eax,%ebx
+f0105891:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (r < 0 && i > 0) {
+f0105894:	85 db                	test   %ebx,%ebx
+f0105896:	79 04                	jns    f010589c <ipc_map_pages+0x80>
+f0105898:	85 ff                	test   %edi,%edi
+f010589a:	75 11                	jne    f01058ad <ipc_map_pages+0x91>
+}
+f010589c:	89 d8                	mov    %ebx,%eax
+f010589e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01058a1:	5b                   	pop    %ebx
+f01058a2:	5e                   	pop    %esi
+f01058a3:	5f                   	pop    %edi
+f01058a4:	5d                   	pop    %ebp
+f01058a5:	c3                   	ret
+			r = -E_INVAL;
+f01058a6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f01058ab:	eb e7                	jmp    f0105894 <ipc_map_pages+0x78>
+		page_remove_range(dstenv->env_pgdir, dstva, i, &dstenv->env_npages);
+f01058ad:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f01058b0:	8d 42 64             	lea    0x64(%edx),%eax
+f01058b3:	50                   	push   %eax
+f01058b4:	57                   	push   %edi
+f01058b5:	ff 75 08             	push   0x8(%ebp)
+f01058b8:	ff 72 60             	push   0x60(%edx)
+f01058bb:	e8 6b d6 ff ff       	call   f0102f2b <page_remove_range>
+f01058c0:	83 c4 10             	add    $0x10,%esp
+	return r;
+f01058c3:	eb d7                	jmp    f010589c <ipc_map_pages+0x80>
+
+f01058c5 <ipc_deliver>:
+{
+f01058c5:	55                   	push   %ebp
+f01058c6:	89 e5                	mov    %esp,%ebp
+f01058c8:	57                   	push   %edi
+f01058c9:	56                   	push   %esi
+f01058ca:	53                   	push   %ebx
+f01058cb:	83 ec 1c             	sub    $0x1c,%esp
+f01058ce:	89 c3                	mov    %eax,%ebx
+f01058d0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f01058d3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+f01058d6:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (dstenv->env_pagein_pager) {
+f01058d9:	8b b3 34 01 00 00    	mov    0x134(%ebx),%esi
+f01058df:	85 f6                	test   %esi,%esi
+f01058e1:	75 78                	jne    f010595b <ipc_deliver+0x96>
+	npg = MIN(npg, dstenv->env_ipc_dstnpg);
+f01058e3:	8b 93 80 00 00 00    	mov    0x80(%ebx),%edx
+f01058e9:	39 d0                	cmp    %edx,%eax
+f01058eb:	89 d7                	mov    %edx,%edi
+f01058ed:	0f 46 f8             	cmovbe %eax,%edi
+	if (((uint32_t)dstenv->env_ipc_dstva < UTOP) && ((uint32_t)srcva < UTOP)) {
+f01058f0:	8b 43 7c             	mov    0x7c(%ebx),%eax
+f01058f3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f01058f6:	3d ff ff bf ee       	cmp    $0xeebfffff,%eax
+f01058fb:	77 09                	ja     f0105906 <ipc_deliver+0x41>
+f01058fd:	81 7d e0 ff ff bf ee 	cmpl   $0xeebfffff,-0x20(%ebp)
+f0105904:	76 6c                	jbe    f0105972 <ipc_deliver+0xad>
+	dstenv->env_ipc_recving = 0;
+f0105906:	c6 43 78 00          	movb   $0x0,0x78(%ebx)
+	dstenv->env_ipc_callee = 0;
+f010590a:	c7 83 a8 00 00 00 00 	movl   $0x0,0xa8(%ebx)
+f0105911:	00 00 00 
+	dstenv->env_ipc_from = curenv->env_id;
+f0105914:	e8 2a 25 00 00       	call   f0107e43 <cpunum>
+f0105919:	6b c0 74             	imul   $0x74,%eax,%eax
+f010591c:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105922:	8b 40 48             	mov    0x48(%eax),%eax
+f0105925:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	dstenv->env_ipc_value = value;
+f010592b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010592e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	dstenv->env_ipc_perm = perm;
+f0105934:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0105937:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	dstenv->env_ipc_npages = npg;
+f010593d:	89 bb 90 00 00 00    	mov    %edi,0x90(%ebx)
+	dstenv->env_tf.tf_regs.reg_eax = 0; // makes sys_ipc_recv return 0
+f0105943:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+	dstenv->env_status = ENV_RUNNABLE;
+f010594a:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+}
+f0105951:	89 f0                	mov    %esi,%eax
+f0105953:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105956:	5b                   	pop    %ebx
+f0105957:	5e                   	pop    %esi
+f0105958:	5f                   	pop    %edi
+f0105959:	5d                   	pop    %ebp
+f010595a:	c3                   	ret
+		env_pagein_done(dstenv, value, p, perm);
+f010595b:	ff 75 0c             	push   0xc(%ebp)
+f010595e:	ff 75 10             	push   0x10(%ebp)
+f0105961:	52                   	push   %edx
+f0105962:	53                   	push   %ebx
+f0105963:	e8 3a e8 ff ff       	call   f01041a2 <env_pagein_done>
+		return 0;
+f0105968:	83 c4 10             	add    $0x10,%esp
+f010596b:	be 00 00 00 00       	mov    $0x0,%esi
+f0105970:	eb df                	jmp    f0105951 <ipc_deliver+0x8c>
+		if ((r = ipc_map_pages(curenv, srcva, dstenv, dstenv->env_ipc_dstva, npg, perm)) < 0) {
+f0105972:	e8 cc 24 00 00       	call   f0107e43 <cpunum>
+f0105977:	6b c0 74             	imul   $0x74,%eax,%eax
+f010597a:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105980:	83 ec 04             	sub    $0x4,%esp
+f0105983:	ff 75 0c             	push   0xc(%ebp)
+f0105986:	57                   	push   %edi
+f0105987:	ff 75 dc             	push   -0x24(%ebp)
+f010598a:	89 d9                	mov    %ebx,%ecx
+f010598c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f010598f:	e8 88 fe ff ff       	call   f010581c <ipc_map_pages>
+f0105994:	83 c4 10             	add    $0x10,%esp
+f0105997:	85 c0                	test   %eax,%eax
+f0105999:	0f 89 67 ff ff ff    	jns    f0105906 <ipc_deliver+0x41>
+			return r;
+f010599f:	89 c6                	mov    %eax,%esi
+f01059a1:	eb ae                	jmp    f0105951 <ipc_deliver+0x8c>
+
+f01059a3 <sys_ipc_call>:
+{
+f01059a3:	55                   	push   %ebp
+f01059a4:	89 e5                	mov    %esp,%ebp
+f01059a6:	57                   	push   %edi
+f01059a7:	56                   	push   %esi
+f01059a8:	53                   	push   %ebx
+f01059a9:	83 ec 20             	sub    $0x20,%esp
+f01059ac:	8b 75 10             	mov    0x10(%ebp),%esi
+f01059af:	8b 7d 14             	mov    0x14(%ebp),%edi
+	struct PageInfo *p = 0;
+f01059b2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (envid2env(envid, &dstenv, 0) < 0 || dstenv == curenv) {
+f01059b9:	6a 00                	push   $0x0
+f01059bb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f01059be:	50                   	push   %eax
+f01059bf:	ff 75 08             	push   0x8(%ebp)
+f01059c2:	e8 04 db ff ff       	call   f01034cb <envid2env>
+f01059c7:	83 c4 10             	add    $0x10,%esp
+f01059ca:	85 c0                	test   %eax,%eax
+f01059cc:	0f 88 eb 00 00 00    	js     f0105abd <sys_ipc_call+0x11a>
+f01059d2:	e8 6c 24 00 00       	call   f0107e43 <cpunum>
+f01059d7:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f01059da:	6b c0 74             	imul   $0x74,%eax,%eax
+f01059dd:	39 98 28 b0 85 f0    	cmp    %ebx,-0xf7a4fd8(%eax)
+f01059e3:	0f 84 de 00 00 00    	je     f0105ac7 <sys_ipc_call+0x124>
+	if ((uint32_t)srcva < UTOP && check_user_range(srcva, npg) < 0) {
+f01059e9:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+f01059ef:	0f 87 e6 00 00 00    	ja     f0105adb <sys_ipc_call+0x138>
+f01059f5:	89 fa                	mov    %edi,%edx
+f01059f7:	89 f0                	mov    %esi,%eax
+f01059f9:	e8 ea f6 ff ff       	call   f01050e8 <check_user_range>
+f01059fe:	85 c0                	test   %eax,%eax
+f0105a00:	0f 88 cb 00 00 00    	js     f0105ad1 <sys_ipc_call+0x12e>
+	if ((uint32_t)srcva < UTOP && perm && (r = ipc_check_pages(srcva, perm, npg, &p)) < 0) {
+f0105a06:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+f0105a0a:	0f 84 72 01 00 00    	je     f0105b82 <sys_ipc_call+0x1df>
+f0105a10:	83 ec 0c             	sub    $0xc,%esp
+f0105a13:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105a16:	50                   	push   %eax
+f0105a17:	89 f9                	mov    %edi,%ecx
+f0105a19:	8b 55 18             	mov    0x18(%ebp),%edx
+f0105a1c:	89 f0                	mov    %esi,%eax
+f0105a1e:	e8 28 fb ff ff       	call   f010554b <ipc_check_pages>
+f0105a23:	89 c3                	mov    %eax,%ebx
+f0105a25:	83 c4 10             	add    $0x10,%esp
+f0105a28:	85 c0                	test   %eax,%eax
+f0105a2a:	0f 88 48 01 00 00    	js     f0105b78 <sys_ipc_call+0x1d5>
+	curenv->env_ipc_callee = dstenv->env_id;
+f0105a30:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0105a33:	e8 0b 24 00 00       	call   f0107e43 <cpunum>
+f0105a38:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105a3b:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105a41:	8b 53 48             	mov    0x48(%ebx),%edx
+f0105a44:	89 90 a8 00 00 00    	mov    %edx,0xa8(%eax)
+	curenv->env_ipc_dstva = srcva;
+f0105a4a:	e8 f4 23 00 00       	call   f0107e43 <cpunum>
+f0105a4f:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105a52:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105a58:	89 70 7c             	mov    %esi,0x7c(%eax)
+	curenv->env_ipc_dstnpg = (uint32_t)srcva < UTOP ? npg : 0;
+f0105a5b:	e8 e3 23 00 00       	call   f0107e43 <cpunum>
+f0105a60:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105a63:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105a69:	89 b8 80 00 00 00    	mov    %edi,0x80(%eax)
+	if ((uint32_t)srcva >= UTOP || !perm) {
+f0105a6f:	e9 b8 00 00 00       	jmp    f0105b2c <sys_ipc_call+0x189>
+		ipc_block_sender(dstenv, value, srcva, npg, perm, p);
+f0105a74:	83 ec 04             	sub    $0x4,%esp
+f0105a77:	ff 75 e4             	push   -0x1c(%ebp)
+f0105a7a:	ff 75 18             	push   0x18(%ebp)
+f0105a7d:	57                   	push   %edi
+f0105a7e:	89 f1                	mov    %esi,%ecx
+f0105a80:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0105a83:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105a86:	e8 52 fc ff ff       	call   f01056dd <ipc_block_sender>
+	curenv->env_ipc_recving = 1;
+f0105a8b:	e8 b3 23 00 00       	call   f0107e43 <cpunum>
+f0105a90:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105a93:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105a99:	c6 40 78 01          	movb   $0x1,0x78(%eax)
+	curenv->env_status = ENV_NOT_RUNNABLE;
+f0105a9d:	e8 a1 23 00 00       	call   f0107e43 <cpunum>
+f0105aa2:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105aa5:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105aab:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+	env_run(dstenv);
+f0105ab2:	83 ec 0c             	sub    $0xc,%esp
+f0105ab5:	ff 75 e0             	push   -0x20(%ebp)
+f0105ab8:	e8 ad e7 ff ff       	call   f010426a <env_run>
+		return -E_BAD_ENV;
+f0105abd:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+f0105ac2:	e9 b1 00 00 00       	jmp    f0105b78 <sys_ipc_call+0x1d5>
+f0105ac7:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+f0105acc:	e9 a7 00 00 00       	jmp    f0105b78 <sys_ipc_call+0x1d5>
+		return -E_INVAL;
+f0105ad1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0105ad6:	e9 9d 00 00 00       	jmp    f0105b78 <sys_ipc_call+0x1d5>
+	curenv->env_ipc_callee = dstenv->env_id;
+f0105adb:	e8 63 23 00 00       	call   f0107e43 <cpunum>
+f0105ae0:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105ae3:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105ae9:	8b 53 48             	mov    0x48(%ebx),%edx
+f0105aec:	89 90 a8 00 00 00    	mov    %edx,0xa8(%eax)
+	curenv->env_ipc_dstva = srcva;
+f0105af2:	e8 4c 23 00 00       	call   f0107e43 <cpunum>
+f0105af7:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105afa:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105b00:	89 70 7c             	mov    %esi,0x7c(%eax)
+	curenv->env_ipc_dstnpg = (uint32_t)srcva < UTOP ? npg : 0;
+f0105b03:	e8 3b 23 00 00       	call   f0107e43 <cpunum>
+f0105b08:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105b0b:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105b11:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%eax)
+f0105b18:	00 00 00 
+		perm = 0;
+f0105b1b:	c7 45 18 00 00 00 00 	movl   $0x0,0x18(%ebp)
+		npg = 0;
+f0105b22:	bf 00 00 00 00       	mov    $0x0,%edi
+		srcva = (void *)UTOP;
+f0105b27:	be 00 00 c0 ee       	mov    $0xeec00000,%esi
+	if (!ipc_can_deliver(dstenv)) {
+f0105b2c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105b2f:	e8 85 f7 ff ff       	call   f01052b9 <ipc_can_deliver>
+f0105b34:	84 c0                	test   %al,%al
+f0105b36:	0f 84 38 ff ff ff    	je     f0105a74 <sys_ipc_call+0xd1>
+	if ((r = ipc_deliver(dstenv, value, srcva, npg, perm, p)) < 0) {
+f0105b3c:	83 ec 04             	sub    $0x4,%esp
+f0105b3f:	ff 75 e4             	push   -0x1c(%ebp)
+f0105b42:	ff 75 18             	push   0x18(%ebp)
+f0105b45:	57                   	push   %edi
+f0105b46:	89 f1                	mov    %esi,%ecx
+f0105b48:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0105b4b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105b4e:	e8 72 fd ff ff       	call   f01058c5 <ipc_deliver>
+f0105b53:	89 c3                	mov    %eax,%ebx
+f0105b55:	83 c4 10             	add    $0x10,%esp
+f0105b58:	85 c0                	test   %eax,%eax
+f0105b5a:	0f 89 2b ff ff ff    	jns    f0105a8b <sys_ipc_call+0xe8>
+		curenv->env_ipc_callee = 0;
+f0105b60:	e8 de 22 00 00       	call   f0107e43 <cpunum>
+f0105b65:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105b68:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105b6e:	c7 80 a8 00 00 00 00 	movl   $0x0,0xa8(%eax)
+f0105b75:	00 00 00 
+}
+f0105b78:	89 d8                	mov    %ebx,%eax
+f0105b7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105b7d:	5b                   	pop    %ebx
+f0105b7e:	5e                   	pop    %esi
+f0105b7f:	5f                   	pop    %edi
+f0105b80:	5d                   	pop    %ebp
+f0105b81:	c3                   	ret
+	curenv->env_ipc_callee = dstenv->env_id;
+f0105b82:	e8 bc 22 00 00       	call   f0107e43 <cpunum>
+f0105b87:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105b8a:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105b90:	8b 53 48             	mov    0x48(%ebx),%edx
+f0105b93:	89 90 a8 00 00 00    	mov    %edx,0xa8(%eax)
+	curenv->env_ipc_dstva = srcva;
+f0105b99:	e8 a5 22 00 00       	call   f0107e43 <cpunum>
+f0105b9e:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105ba1:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105ba7:	89 70 7c             	mov    %esi,0x7c(%eax)
+	curenv->env_ipc_dstnpg = (uint32_t)srcva < UTOP ? npg : 0;
+f0105baa:	e8 94 22 00 00       	call   f0107e43 <cpunum>
+f0105baf:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105bb2:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105bb8:	89 b8 80 00 00 00    	mov    %edi,0x80(%eax)
+		npg = 0;
+f0105bbe:	8b 7d 18             	mov    0x18(%ebp),%edi
+		srcva = (void *)UTOP;
+f0105bc1:	be 00 00 c0 ee       	mov    $0xeec00000,%esi
+f0105bc6:	e9 61 ff ff ff       	jmp    f0105b2c <sys_ipc_call+0x189>
+
+f0105bcb <sys_ipc_send>:
+{
+f0105bcb:	55                   	push   %ebp
+f0105bcc:	89 e5                	mov    %esp,%ebp
+f0105bce:	57                   	push   %edi
+f0105bcf:	56                   	push   %esi
+f0105bd0:	53                   	push   %ebx
+f0105bd1:	83 ec 20             	sub    $0x20,%esp
+f0105bd4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+f0105bd7:	8b 7d 14             	mov    0x14(%ebp),%edi
+f0105bda:	8b 75 18             	mov    0x18(%ebp),%esi
+	struct PageInfo *p = 0;
+f0105bdd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (envid2env(envid, &dstenv, 0) < 0) {
+f0105be4:	6a 00                	push   $0x0
+f0105be6:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0105be9:	50                   	push   %eax
+f0105bea:	ff 75 08             	push   0x8(%ebp)
+f0105bed:	e8 d9 d8 ff ff       	call   f01034cb <envid2env>
+f0105bf2:	83 c4 10             	add    $0x10,%esp
+f0105bf5:	85 c0                	test   %eax,%eax
+f0105bf7:	78 6e                	js     f0105c67 <sys_ipc_send+0x9c>
+	if ((uint32_t)srcva < UTOP) {
+f0105bf9:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f0105bff:	77 1b                	ja     f0105c1c <sys_ipc_send+0x51>
+		if ((r = ipc_check_pages(srcva, perm, npg, &p)) < 0) {
+f0105c01:	83 ec 0c             	sub    $0xc,%esp
+f0105c04:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105c07:	50                   	push   %eax
+f0105c08:	89 f1                	mov    %esi,%ecx
+f0105c0a:	89 fa                	mov    %edi,%edx
+f0105c0c:	89 d8                	mov    %ebx,%eax
+f0105c0e:	e8 38 f9 ff ff       	call   f010554b <ipc_check_pages>
+f0105c13:	83 c4 10             	add    $0x10,%esp
+f0105c16:	85 c0                	test   %eax,%eax
+f0105c18:	79 0c                	jns    f0105c26 <sys_ipc_send+0x5b>
+f0105c1a:	eb 2e                	jmp    f0105c4a <sys_ipc_send+0x7f>
+		npg = 0;
+f0105c1c:	be 00 00 00 00       	mov    $0x0,%esi
+		perm = 0;
+f0105c21:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (!ipc_can_deliver(dstenv)) {
+f0105c26:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105c29:	e8 8b f6 ff ff       	call   f01052b9 <ipc_can_deliver>
+f0105c2e:	84 c0                	test   %al,%al
+f0105c30:	74 20                	je     f0105c52 <sys_ipc_send+0x87>
+	return ipc_deliver(dstenv, value, srcva, npg, perm, p);
+f0105c32:	83 ec 04             	sub    $0x4,%esp
+f0105c35:	ff 75 e4             	push   -0x1c(%ebp)
+f0105c38:	57                   	push   %edi
+f0105c39:	56                   	push   %esi
+f0105c3a:	89 d9                	mov    %ebx,%ecx
+f0105c3c:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0105c3f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105c42:	e8 7e fc ff ff       	call   f01058c5 <ipc_deliver>
+f0105c47:	83 c4 10             	add    $0x10,%esp
+}
+f0105c4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105c4d:	5b                   	pop    %ebx
+f0105c4e:	5e                   	pop    %esi
+f0105c4f:	5f                   	pop    %edi
+f0105c50:	5d                   	pop    %ebp
+f0105c51:	c3                   	ret
+		ipc_block_sender(dstenv, value, srcva, npg, perm, p);
+f0105c52:	83 ec 04             	sub    $0x4,%esp
+f0105c55:	ff 75 e4             	push   -0x1c(%ebp)
+f0105c58:	57                   	push   %edi
+f0105c59:	56                   	push   %esi
+f0105c5a:	89 d9                	mov    %ebx,%ecx
+f0105c5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0105c5f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105c62:	e8 76 fa ff ff       	call   f01056dd <ipc_block_sender>
+		return -E_BAD_ENV;
+f0105c67:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0105c6c:	eb dc                	jmp    f0105c4a <sys_ipc_send+0x7f>
+
+f0105c6e <sys_page_map>:
+{
+f0105c6e:	55                   	push   %ebp
+f0105c6f:	89 e5                	mov    %esp,%ebp
+f0105c71:	57                   	push   %edi
+f0105c72:	56                   	push   %esi
+f0105c73:	53                   	push   %ebx
+f0105c74:	83 ec 30             	sub    $0x30,%esp
+f0105c77:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0105c7a:	8b 75 14             	mov    0x14(%ebp),%esi
+f0105c7d:	8b 7d 18             	mov    0x18(%ebp),%edi
+	if ((envid2env(srcenvid, &srcenv, 1) < 0) || (envid2env(dstenvid, &dstenv, 1) < 0)) {
+f0105c80:	6a 01                	push   $0x1
+f0105c82:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105c85:	50                   	push   %eax
+f0105c86:	ff 75 08             	push   0x8(%ebp)
+f0105c89:	e8 3d d8 ff ff       	call   f01034cb <envid2env>
+f0105c8e:	83 c4 10             	add    $0x10,%esp
+f0105c91:	85 c0                	test   %eax,%eax
+f0105c93:	0f 88 e7 00 00 00    	js     f0105d80 <sys_page_map+0x112>
+f0105c99:	83 ec 04             	sub    $0x4,%esp
+f0105c9c:	6a 01                	push   $0x1
+f0105c9e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0105ca1:	50                   	push   %eax
+f0105ca2:	ff 75 10             	push   0x10(%ebp)
+f0105ca5:	e8 21 d8 ff ff       	call   f01034cb <envid2env>
+f0105caa:	83 c4 10             	add    $0x10,%esp
+f0105cad:	85 c0                	test   %eax,%eax
+f0105caf:	0f 88 d2 00 00 00    	js     f0105d87 <sys_page_map+0x119>
+	if ((((uint32_t)srcva) >= UTOP) || ((uint32_t)srcva)%PGSIZE || (((uint32_t)dstva) >= UTOP) || ((uint32_t)dstva)%PGSIZE) {
+f0105cb5:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f0105cbb:	0f 87 cd 00 00 00    	ja     f0105d8e <sys_page_map+0x120>
+f0105cc1:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f0105cc7:	0f 85 c8 00 00 00    	jne    f0105d95 <sys_page_map+0x127>
+f0105ccd:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+f0105cd3:	0f 87 c3 00 00 00    	ja     f0105d9c <sys_page_map+0x12e>
+f0105cd9:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+f0105cdf:	0f 85 be 00 00 00    	jne    f0105da3 <sys_page_map+0x135>
+	if (((perm & (PTE_U | PTE_P)) ^ (PTE_U | PTE_P)) | (perm & (~(PTE_U | PTE_P | PTE_AVAIL | PTE_W)))) {
+f0105ce5:	89 f8                	mov    %edi,%eax
+f0105ce7:	25 fd f1 ff ff       	and    $0xfffff1fd,%eax
+f0105cec:	83 f8 05             	cmp    $0x5,%eax
+f0105cef:	0f 85 b5 00 00 00    	jne    f0105daa <sys_page_map+0x13c>
+	if (!(p = page_lookup(srcenv->env_pgdir, srcva, &pte))) {
+f0105cf5:	83 ec 04             	sub    $0x4,%esp
+f0105cf8:	8d 45 dc             	lea    -0x24(%ebp),%eax
+f0105cfb:	50                   	push   %eax
+f0105cfc:	53                   	push   %ebx
+f0105cfd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105d00:	ff 70 60             	push   0x60(%eax)
+f0105d03:	e8 a7 c8 ff ff       	call   f01025af <page_lookup>
+f0105d08:	83 c4 10             	add    $0x10,%esp
+f0105d0b:	85 c0                	test   %eax,%eax
+f0105d0d:	0f 84 9e 00 00 00    	je     f0105db1 <sys_page_map+0x143>
+	if ((perm & PTE_W) && !(*pte & PTE_W)) {
+f0105d13:	f7 c7 02 00 00 00    	test   $0x2,%edi
+f0105d19:	0f 84 a7 00 00 00    	je     f0105dc6 <sys_page_map+0x158>
+f0105d1f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0105d22:	8b 11                	mov    (%ecx),%edx
+f0105d24:	89 55 d0             	mov    %edx,-0x30(%ebp)
+f0105d27:	f6 c2 02             	test   $0x2,%dl
+f0105d2a:	0f 84 88 00 00 00    	je     f0105db8 <sys_page_map+0x14a>
+	same = (srcenv == dstenv && srcva == dstva);
+f0105d30:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0105d33:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+f0105d36:	0f 94 45 d7          	sete   -0x29(%ebp)
+f0105d3a:	0f b6 55 d7          	movzbl -0x29(%ebp),%edx
+f0105d3e:	39 f3                	cmp    %esi,%ebx
+f0105d40:	0f 94 c3             	sete   %bl
+f0105d43:	20 d3                	and    %dl,%bl
+f0105d45:	75 0d                	jne    f0105d54 <sys_page_map+0xe6>
+		*pte |= PTE_D;
+f0105d47:	8b 55 d0             	mov    -0x30(%ebp),%edx
+f0105d4a:	83 ca 40             	or     $0x40,%edx
+f0105d4d:	89 11                	mov    %edx,(%ecx)
+f0105d4f:	e9 88 00 00 00       	jmp    f0105ddc <sys_page_map+0x16e>
+	clean = same && !(*pte & PTE_D);
+f0105d54:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0105d57:	8b 1a                	mov    (%edx),%ebx
+f0105d59:	c1 eb 06             	shr    $0x6,%ebx
+f0105d5c:	83 f3 01             	xor    $0x1,%ebx
+f0105d5f:	83 e3 01             	and    $0x1,%ebx
+	if ((perm & PTE_W) && !same) {
+f0105d62:	eb 78                	jmp    f0105ddc <sys_page_map+0x16e>
+		page_clean(dstenv->env_pgdir, dstva);
+f0105d64:	83 ec 08             	sub    $0x8,%esp
+f0105d67:	56                   	push   %esi
+f0105d68:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105d6b:	ff 70 60             	push   0x60(%eax)
+f0105d6e:	e8 c7 cc ff ff       	call   f0102a3a <page_clean>
+f0105d73:	83 c4 10             	add    $0x10,%esp
+	return 0;
+f0105d76:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105d7b:	e9 85 00 00 00       	jmp    f0105e05 <sys_page_map+0x197>
+		return -E_BAD_ENV;
+f0105d80:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0105d85:	eb 7e                	jmp    f0105e05 <sys_page_map+0x197>
+f0105d87:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0105d8c:	eb 77                	jmp    f0105e05 <sys_page_map+0x197>
+		return -E_INVAL;
+f0105d8e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105d93:	eb 70                	jmp    f0105e05 <sys_page_map+0x197>
+f0105d95:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105d9a:	eb 69                	jmp    f0105e05 <sys_page_map+0x197>
+f0105d9c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105da1:	eb 62                	jmp    f0105e05 <sys_page_map+0x197>
+f0105da3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105da8:	eb 5b                	jmp    f0105e05 <sys_page_map+0x197>
+		return -E_INVAL;
+f0105daa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105daf:	eb 54                	jmp    f0105e05 <sys_page_map+0x197>
+		return -E_INVAL;
+f0105db1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105db6:	eb 4d                	jmp    f0105e05 <sys_page_map+0x197>
+		return -E_INVAL;
+f0105db8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105dbd:	eb 46                	jmp    f0105e05 <sys_page_map+0x197>
+		return -E_NO_MEM;
+f0105dbf:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0105dc4:	eb 3f                	jmp    f0105e05 <sys_page_map+0x197>
+	same = (srcenv == dstenv && srcva == dstva);
+f0105dc6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0105dc9:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+f0105dcc:	0f 94 c2             	sete   %dl
+f0105dcf:	39 f3                	cmp    %esi,%ebx
+f0105dd1:	0f 94 c3             	sete   %bl
+f0105dd4:	20 d3                	and    %dl,%bl
+f0105dd6:	0f 85 78 ff ff ff    	jne    f0105d54 <sys_page_map+0xe6>
+	if (page_insert(dstenv->env_pgdir, p, dstva, perm, &dstenv->env_npages) < 0) {
+f0105ddc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0105ddf:	83 ec 0c             	sub    $0xc,%esp
+f0105de2:	8d 4a 64             	lea    0x64(%edx),%ecx
+f0105de5:	51                   	push   %ecx
+f0105de6:	57                   	push   %edi
+f0105de7:	56                   	push   %esi
+f0105de8:	50                   	push   %eax
+f0105de9:	ff 72 60             	push   0x60(%edx)
+f0105dec:	e8 87 c8 ff ff       	call   f0102678 <page_insert>
+f0105df1:	83 c4 20             	add    $0x20,%esp
+f0105df4:	85 c0                	test   %eax,%eax
+f0105df6:	78 c7                	js     f0105dbf <sys_page_map+0x151>
+	return 0;
+f0105df8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (clean) {
+f0105dfd:	84 db                	test   %bl,%bl
+f0105dff:	0f 85 5f ff ff ff    	jne    f0105d64 <sys_page_map+0xf6>
+}
+f0105e05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105e08:	5b                   	pop    %ebx
+f0105e09:	5e                   	pop    %esi
+f0105e0a:	5f                   	pop    %edi
+f0105e0b:	5d                   	pop    %ebp
+f0105e0c:	c3                   	ret
+
+f0105e0d <ipc_recv_blocked_sender>:
+{
+f0105e0d:	55                   	push   %ebp
+f0105e0e:	89 e5                	mov    %esp,%ebp
+f0105e10:	57                   	push   %edi
+f0105e11:	56                   	push   %esi
+f0105e12:	53                   	push   %ebx
+f0105e13:	83 ec 1c             	sub    $0x1c,%esp
+f0105e16:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f0105e19:	89 c7                	mov    %eax,%edi
+f0105e1b:	eb 0c                	jmp    f0105e29 <ipc_recv_blocked_sender+0x1c>
+			env_pagein_cancel(srcenv);
+f0105e1d:	83 ec 0c             	sub    $0xc,%esp
+f0105e20:	56                   	push   %esi
+f0105e21:	e8 54 dc ff ff       	call   f0103a7a <env_pagein_cancel>
+			goto find_sender;
+f0105e26:	83 c4 10             	add    $0x10,%esp
+	if (!(srcenv = curenv->env_ipc_blocked_sender)) {
+f0105e29:	e8 15 20 00 00       	call   f0107e43 <cpunum>
+f0105e2e:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105e31:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105e37:	8b b0 ac 00 00 00    	mov    0xac(%eax),%esi
+f0105e3d:	85 f6                	test   %esi,%esi
+f0105e3f:	0f 84 ab 01 00 00    	je     f0105ff0 <ipc_recv_blocked_sender+0x1e3>
+	curenv->env_ipc_blocked_sender = srcenv->env_ipc_blocked_sender_chain;
+f0105e45:	e8 f9 1f 00 00       	call   f0107e43 <cpunum>
+f0105e4a:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105e4d:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105e53:	8b 96 b0 00 00 00    	mov    0xb0(%esi),%edx
+f0105e59:	89 90 ac 00 00 00    	mov    %edx,0xac(%eax)
+	srcenv->env_ipc_blocked_sender_chain = 0;
+f0105e5f:	c7 86 b0 00 00 00 00 	movl   $0x0,0xb0(%esi)
+f0105e66:	00 00 00 
+	if (srcenv->env_pagein_pager) {
+f0105e69:	83 be 34 01 00 00 00 	cmpl   $0x0,0x134(%esi)
+f0105e70:	74 63                	je     f0105ed5 <ipc_recv_blocked_sender+0xc8>
+		if ((uint32_t)dstva >= UTOP || page_insert(curenv->env_pgdir, srcenv->env_ipc_page, dstva, srcenv->env_ipc_perm_sending, &curenv->env_npages) < 0) {
+f0105e72:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+f0105e78:	77 a3                	ja     f0105e1d <ipc_recv_blocked_sender+0x10>
+f0105e7a:	e8 c4 1f 00 00       	call   f0107e43 <cpunum>
+f0105e7f:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105e82:	8b 98 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%ebx
+f0105e88:	8d 43 64             	lea    0x64(%ebx),%eax
+f0105e8b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0105e8e:	8b 9e a4 00 00 00    	mov    0xa4(%esi),%ebx
+f0105e94:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+f0105e97:	8b 9e 94 00 00 00    	mov    0x94(%esi),%ebx
+f0105e9d:	e8 a1 1f 00 00       	call   f0107e43 <cpunum>
+f0105ea2:	83 ec 0c             	sub    $0xc,%esp
+f0105ea5:	ff 75 e4             	push   -0x1c(%ebp)
+f0105ea8:	ff 75 e0             	push   -0x20(%ebp)
+f0105eab:	57                   	push   %edi
+f0105eac:	53                   	push   %ebx
+f0105ead:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105eb0:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105eb6:	ff 70 60             	push   0x60(%eax)
+f0105eb9:	e8 ba c7 ff ff       	call   f0102678 <page_insert>
+f0105ebe:	83 c4 20             	add    $0x20,%esp
+f0105ec1:	85 c0                	test   %eax,%eax
+f0105ec3:	0f 88 54 ff ff ff    	js     f0105e1d <ipc_recv_blocked_sender+0x10>
+		npg = 1;
+f0105ec9:	89 f7                	mov    %esi,%edi
+f0105ecb:	bb 01 00 00 00       	mov    $0x1,%ebx
+f0105ed0:	e9 99 00 00 00       	jmp    f0105f6e <ipc_recv_blocked_sender+0x161>
+		srcenv->env_status = ENV_RUNNABLE;
+f0105ed5:	c7 46 54 02 00 00 00 	movl   $0x2,0x54(%esi)
+		if (((uint32_t)dstva < UTOP) && srcenv->env_ipc_page) {
+f0105edc:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+f0105ee2:	77 68                	ja     f0105f4c <ipc_recv_blocked_sender+0x13f>
+f0105ee4:	83 be 94 00 00 00 00 	cmpl   $0x0,0x94(%esi)
+f0105eeb:	0f 84 e9 00 00 00    	je     f0105fda <ipc_recv_blocked_sender+0x1cd>
+			npg = MIN(srcenv->env_ipc_npg_sending, dstnpg);
+f0105ef1:	8b 86 9c 00 00 00    	mov    0x9c(%esi),%eax
+f0105ef7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0105efa:	39 c1                	cmp    %eax,%ecx
+f0105efc:	0f 46 c1             	cmovbe %ecx,%eax
+f0105eff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			if (ipc_map_pages(srcenv, srcenv->env_ipc_srcva_sending, curenv, dstva, npg, srcenv->env_ipc_perm_sending) < 0) {
+f0105f02:	8b 9e a4 00 00 00    	mov    0xa4(%esi),%ebx
+f0105f08:	e8 36 1f 00 00       	call   f0107e43 <cpunum>
+f0105f0d:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105f10:	8b 88 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%ecx
+f0105f16:	8b 96 98 00 00 00    	mov    0x98(%esi),%edx
+f0105f1c:	83 ec 04             	sub    $0x4,%esp
+f0105f1f:	53                   	push   %ebx
+f0105f20:	ff 75 e4             	push   -0x1c(%ebp)
+f0105f23:	57                   	push   %edi
+f0105f24:	89 f0                	mov    %esi,%eax
+f0105f26:	e8 f1 f8 ff ff       	call   f010581c <ipc_map_pages>
+f0105f2b:	83 c4 10             	add    $0x10,%esp
+f0105f2e:	85 c0                	test   %eax,%eax
+f0105f30:	0f 89 b0 00 00 00    	jns    f0105fe6 <ipc_recv_blocked_sender+0x1d9>
+				srcenv->env_ipc_callee = 0;
+f0105f36:	c7 86 a8 00 00 00 00 	movl   $0x0,0xa8(%esi)
+f0105f3d:	00 00 00 
+				srcenv->env_tf.tf_regs.reg_eax = -E_NO_MEM; // makes sys_ipc_send return -E_NO_MEM
+f0105f40:	c7 46 1c fc ff ff ff 	movl   $0xfffffffc,0x1c(%esi)
+				goto find_sender;  // go back to the top to try again with the next blocked sender in the linked list
+f0105f47:	e9 dd fe ff ff       	jmp    f0105e29 <ipc_recv_blocked_sender+0x1c>
+		npg = 0;
+f0105f4c:	89 f7                	mov    %esi,%edi
+f0105f4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		srcenv->env_tf.tf_regs.reg_eax = 0; // makes sys_ipc_send return 0
+f0105f53:	c7 47 1c 00 00 00 00 	movl   $0x0,0x1c(%edi)
+		if (srcenv->env_ipc_callee) {
+f0105f5a:	83 bf a8 00 00 00 00 	cmpl   $0x0,0xa8(%edi)
+f0105f61:	74 0b                	je     f0105f6e <ipc_recv_blocked_sender+0x161>
+			srcenv->env_ipc_recving = 1;
+f0105f63:	c6 47 78 01          	movb   $0x1,0x78(%edi)
+			srcenv->env_status = ENV_NOT_RUNNABLE;
+f0105f67:	c7 47 54 04 00 00 00 	movl   $0x4,0x54(%edi)
+	curenv->env_ipc_from = srcenv->env_id;
+f0105f6e:	e8 d0 1e 00 00       	call   f0107e43 <cpunum>
+f0105f73:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105f76:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105f7c:	8b 57 48             	mov    0x48(%edi),%edx
+f0105f7f:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+	curenv->env_ipc_value = srcenv->env_ipc_value_sending;
+f0105f85:	e8 b9 1e 00 00       	call   f0107e43 <cpunum>
+f0105f8a:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105f8d:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105f93:	8b 97 a0 00 00 00    	mov    0xa0(%edi),%edx
+f0105f99:	89 90 84 00 00 00    	mov    %edx,0x84(%eax)
+	curenv->env_ipc_perm = srcenv->env_ipc_perm_sending;
+f0105f9f:	e8 9f 1e 00 00       	call   f0107e43 <cpunum>
+f0105fa4:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105fa7:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105fad:	8b 97 a4 00 00 00    	mov    0xa4(%edi),%edx
+f0105fb3:	89 90 8c 00 00 00    	mov    %edx,0x8c(%eax)
+	curenv->env_ipc_npages = npg;
+f0105fb9:	e8 85 1e 00 00       	call   f0107e43 <cpunum>
+f0105fbe:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105fc1:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0105fc7:	89 98 90 00 00 00    	mov    %ebx,0x90(%eax)
+	return 1;
+f0105fcd:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+f0105fd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105fd5:	5b                   	pop    %ebx
+f0105fd6:	5e                   	pop    %esi
+f0105fd7:	5f                   	pop    %edi
+f0105fd8:	5d                   	pop    %ebp
+f0105fd9:	c3                   	ret
+		npg = 0;
+f0105fda:	89 f7                	mov    %esi,%edi
+f0105fdc:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0105fe1:	e9 6d ff ff ff       	jmp    f0105f53 <ipc_recv_blocked_sender+0x146>
+f0105fe6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0105fe9:	89 f7                	mov    %esi,%edi
+f0105feb:	e9 63 ff ff ff       	jmp    f0105f53 <ipc_recv_blocked_sender+0x146>
+		return 0;
+f0105ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105ff5:	eb db                	jmp    f0105fd2 <ipc_recv_blocked_sender+0x1c5>
+
+f0105ff7 <sys_ipc_reply_recv>:
+{
+f0105ff7:	55                   	push   %ebp
+f0105ff8:	89 e5                	mov    %esp,%ebp
+f0105ffa:	57                   	push   %edi
+f0105ffb:	56                   	push   %esi
+f0105ffc:	53                   	push   %ebx
+f0105ffd:	83 ec 1c             	sub    $0x1c,%esp
+f0106000:	8b 5d 10             	mov    0x10(%ebp),%ebx
+f0106003:	8b 75 14             	mov    0x14(%ebp),%esi
+f0106006:	8b 7d 18             	mov    0x18(%ebp),%edi
+	struct PageInfo *p = 0;
+f0106009:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (((uint32_t)pg < UTOP) && check_user_range(pg, npg) < 0) {
+f0106010:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f0106016:	77 33                	ja     f010604b <sys_ipc_reply_recv+0x54>
+f0106018:	89 f2                	mov    %esi,%edx
+f010601a:	89 d8                	mov    %ebx,%eax
+f010601c:	e8 c7 f0 ff ff       	call   f01050e8 <check_user_range>
+f0106021:	85 c0                	test   %eax,%eax
+f0106023:	0f 88 0f 01 00 00    	js     f0106138 <sys_ipc_reply_recv+0x141>
+	if (perm && (r = ipc_check_pages(pg, perm, 1, &p)) < 0) {
+f0106029:	85 ff                	test   %edi,%edi
+f010602b:	74 23                	je     f0106050 <sys_ipc_reply_recv+0x59>
+f010602d:	83 ec 0c             	sub    $0xc,%esp
+f0106030:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0106033:	50                   	push   %eax
+f0106034:	b9 01 00 00 00       	mov    $0x1,%ecx
+f0106039:	89 fa                	mov    %edi,%edx
+f010603b:	89 d8                	mov    %ebx,%eax
+f010603d:	e8 09 f5 ff ff       	call   f010554b <ipc_check_pages>
+f0106042:	83 c4 10             	add    $0x10,%esp
+f0106045:	85 c0                	test   %eax,%eax
+f0106047:	79 07                	jns    f0106050 <sys_ipc_reply_recv+0x59>
+f0106049:	eb 42                	jmp    f010608d <sys_ipc_reply_recv+0x96>
+		perm = 0;
+f010604b:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (envid2env(envid, &dstenv, 0) < 0 || !ipc_can_deliver(dstenv)) {
+f0106050:	83 ec 04             	sub    $0x4,%esp
+f0106053:	6a 00                	push   $0x0
+f0106055:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0106058:	50                   	push   %eax
+f0106059:	ff 75 08             	push   0x8(%ebp)
+f010605c:	e8 6a d4 ff ff       	call   f01034cb <envid2env>
+f0106061:	83 c4 10             	add    $0x10,%esp
+f0106064:	85 c0                	test   %eax,%eax
+f0106066:	79 2d                	jns    f0106095 <sys_ipc_reply_recv+0x9e>
+		dstenv = NULL;
+f0106068:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+	if ((uint32_t)pg < UTOP) {
+f010606f:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f0106075:	76 74                	jbe    f01060eb <sys_ipc_reply_recv+0xf4>
+	if (!ipc_recv_blocked_sender(pg, npg)) {
+f0106077:	89 f2                	mov    %esi,%edx
+f0106079:	89 d8                	mov    %ebx,%eax
+f010607b:	e8 8d fd ff ff       	call   f0105e0d <ipc_recv_blocked_sender>
+f0106080:	85 c0                	test   %eax,%eax
+f0106082:	0f 84 18 01 00 00    	je     f01061a0 <sys_ipc_reply_recv+0x1a9>
+	return 0;
+f0106088:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010608d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106090:	5b                   	pop    %ebx
+f0106091:	5e                   	pop    %esi
+f0106092:	5f                   	pop    %edi
+f0106093:	5d                   	pop    %ebp
+f0106094:	c3                   	ret
+	if (envid2env(envid, &dstenv, 0) < 0 || !ipc_can_deliver(dstenv)) {
+f0106095:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0106098:	e8 1c f2 ff ff       	call   f01052b9 <ipc_can_deliver>
+f010609d:	84 c0                	test   %al,%al
+f010609f:	74 c7                	je     f0106068 <sys_ipc_reply_recv+0x71>
+	else if (ipc_deliver(dstenv, value, perm ? pg : (void *)UTOP, perm ? 1 : 0, perm, p) < 0) {
+f01060a1:	85 ff                	test   %edi,%edi
+f01060a3:	0f 95 c0             	setne  %al
+f01060a6:	0f b6 c0             	movzbl %al,%eax
+f01060a9:	b9 00 00 c0 ee       	mov    $0xeec00000,%ecx
+f01060ae:	0f 45 cb             	cmovne %ebx,%ecx
+f01060b1:	83 ec 04             	sub    $0x4,%esp
+f01060b4:	ff 75 e4             	push   -0x1c(%ebp)
+f01060b7:	57                   	push   %edi
+f01060b8:	50                   	push   %eax
+f01060b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+f01060bc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01060bf:	e8 01 f8 ff ff       	call   f01058c5 <ipc_deliver>
+f01060c4:	83 c4 10             	add    $0x10,%esp
+f01060c7:	85 c0                	test   %eax,%eax
+f01060c9:	79 a4                	jns    f010606f <sys_ipc_reply_recv+0x78>
+		ipc_deliver(dstenv, -E_NO_MEM, (void *)UTOP, 0, 0, NULL);
+f01060cb:	83 ec 04             	sub    $0x4,%esp
+f01060ce:	6a 00                	push   $0x0
+f01060d0:	6a 00                	push   $0x0
+f01060d2:	6a 00                	push   $0x0
+f01060d4:	b9 00 00 c0 ee       	mov    $0xeec00000,%ecx
+f01060d9:	ba fc ff ff ff       	mov    $0xfffffffc,%edx
+f01060de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01060e1:	e8 df f7 ff ff       	call   f01058c5 <ipc_deliver>
+f01060e6:	83 c4 10             	add    $0x10,%esp
+f01060e9:	eb 84                	jmp    f010606f <sys_ipc_reply_recv+0x78>
+		page_remove_range(curenv->env_pgdir, pg, npg, &curenv->env_npages);
+f01060eb:	e8 53 1d 00 00       	call   f0107e43 <cpunum>
+f01060f0:	6b c0 74             	imul   $0x74,%eax,%eax
+f01060f3:	8b b8 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%edi
+f01060f9:	83 c7 64             	add    $0x64,%edi
+f01060fc:	e8 42 1d 00 00       	call   f0107e43 <cpunum>
+f0106101:	57                   	push   %edi
+f0106102:	56                   	push   %esi
+f0106103:	53                   	push   %ebx
+f0106104:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106107:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f010610d:	ff 70 60             	push   0x60(%eax)
+f0106110:	e8 16 ce ff ff       	call   f0102f2b <page_remove_range>
+	if (!ipc_recv_blocked_sender(pg, npg)) {
+f0106115:	89 f2                	mov    %esi,%edx
+f0106117:	89 d8                	mov    %ebx,%eax
+f0106119:	e8 ef fc ff ff       	call   f0105e0d <ipc_recv_blocked_sender>
+f010611e:	83 c4 10             	add    $0x10,%esp
+f0106121:	85 c0                	test   %eax,%eax
+f0106123:	74 1d                	je     f0106142 <sys_ipc_reply_recv+0x14b>
+	return 0;
+f0106125:	b8 00 00 00 00       	mov    $0x0,%eax
+f010612a:	e9 5e ff ff ff       	jmp    f010608d <sys_ipc_reply_recv+0x96>
+			env_run(dstenv);
+f010612f:	83 ec 0c             	sub    $0xc,%esp
+f0106132:	50                   	push   %eax
+f0106133:	e8 32 e1 ff ff       	call   f010426a <env_run>
+		return -E_INVAL;
+f0106138:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010613d:	e9 4b ff ff ff       	jmp    f010608d <sys_ipc_reply_recv+0x96>
+		curenv->env_ipc_recving = 1;
+f0106142:	e8 fc 1c 00 00       	call   f0107e43 <cpunum>
+f0106147:	6b c0 74             	imul   $0x74,%eax,%eax
+f010614a:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0106150:	c6 40 78 01          	movb   $0x1,0x78(%eax)
+		curenv->env_ipc_dstva = pg;
+f0106154:	e8 ea 1c 00 00       	call   f0107e43 <cpunum>
+f0106159:	6b c0 74             	imul   $0x74,%eax,%eax
+f010615c:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0106162:	89 58 7c             	mov    %ebx,0x7c(%eax)
+		curenv->env_ipc_dstnpg = (uint32_t)pg < UTOP ? npg : 0;
+f0106165:	e8 d9 1c 00 00       	call   f0107e43 <cpunum>
+f010616a:	6b c0 74             	imul   $0x74,%eax,%eax
+f010616d:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0106173:	89 b0 80 00 00 00    	mov    %esi,0x80(%eax)
+		curenv->env_status = ENV_NOT_RUNNABLE;
+f0106179:	e8 c5 1c 00 00       	call   f0107e43 <cpunum>
+f010617e:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106181:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0106187:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+		if (dstenv && dstenv->env_status == ENV_RUNNABLE) {
+f010618e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0106191:	85 c0                	test   %eax,%eax
+f0106193:	74 06                	je     f010619b <sys_ipc_reply_recv+0x1a4>
+f0106195:	83 78 54 02          	cmpl   $0x2,0x54(%eax)
+f0106199:	74 94                	je     f010612f <sys_ipc_reply_recv+0x138>
+		sched_yield();
+f010619b:	e8 72 ee ff ff       	call   f0105012 <sched_yield>
+		curenv->env_ipc_recving = 1;
+f01061a0:	e8 9e 1c 00 00       	call   f0107e43 <cpunum>
+f01061a5:	6b c0 74             	imul   $0x74,%eax,%eax
+f01061a8:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01061ae:	c6 40 78 01          	movb   $0x1,0x78(%eax)
+		curenv->env_ipc_dstva = pg;
+f01061b2:	e8 8c 1c 00 00       	call   f0107e43 <cpunum>
+f01061b7:	6b c0 74             	imul   $0x74,%eax,%eax
+f01061ba:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01061c0:	89 58 7c             	mov    %ebx,0x7c(%eax)
+		curenv->env_ipc_dstnpg = (uint32_t)pg < UTOP ? npg : 0;
+f01061c3:	be 00 00 00 00       	mov    $0x0,%esi
+f01061c8:	eb 9b                	jmp    f0106165 <sys_ipc_reply_recv+0x16e>
+
+f01061ca <sys_ipc_try_recv>:
+{
+f01061ca:	55                   	push   %ebp
+f01061cb:	89 e5                	mov    %esp,%ebp
+f01061cd:	56                   	push   %esi
+f01061ce:	53                   	push   %ebx
+f01061cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01061d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if (((uint32_t)dstva < UTOP) && check_user_range(dstva, npg) < 0) {
+f01061d5:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f01061db:	77 0d                	ja     f01061ea <sys_ipc_try_recv+0x20>
+f01061dd:	89 f2                	mov    %esi,%edx
+f01061df:	89 d8                	mov    %ebx,%eax
+f01061e1:	e8 02 ef ff ff       	call   f01050e8 <check_user_range>
+f01061e6:	85 c0                	test   %eax,%eax
+f01061e8:	78 15                	js     f01061ff <sys_ipc_try_recv+0x35>
+	if (!ipc_recv_blocked_sender(dstva, npg)) {
+f01061ea:	89 f2                	mov    %esi,%edx
+f01061ec:	89 d8                	mov    %ebx,%eax
+f01061ee:	e8 1a fc ff ff       	call   f0105e0d <ipc_recv_blocked_sender>
+	return 0;
+f01061f3:	83 f8 01             	cmp    $0x1,%eax
+f01061f6:	19 c0                	sbb    %eax,%eax
+f01061f8:	83 e0 ef             	and    $0xffffffef,%eax
+}
+f01061fb:	5b                   	pop    %ebx
+f01061fc:	5e                   	pop    %esi
+f01061fd:	5d                   	pop    %ebp
+f01061fe:	c3                   	ret
+		return -E_INVAL;
+f01061ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106204:	eb f5                	jmp    f01061fb <sys_ipc_try_recv+0x31>
+
+f0106206 <sys_ipc_recv>:
+{
+f0106206:	55                   	push   %ebp
+f0106207:	89 e5                	mov    %esp,%ebp
+f0106209:	56                   	push   %esi
+f010620a:	53                   	push   %ebx
+f010620b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010620e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if (((uint32_t)dstva < UTOP) && check_user_range(dstva, npg) < 0) {
+f0106211:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f0106217:	77 54                	ja     f010626d <sys_ipc_recv+0x67>
+f0106219:	89 f2                	mov    %esi,%edx
+f010621b:	89 d8                	mov    %ebx,%eax
+f010621d:	e8 c6 ee ff ff       	call   f01050e8 <check_user_range>
+f0106222:	85 c0                	test   %eax,%eax
+f0106224:	78 16                	js     f010623c <sys_ipc_recv+0x36>
+	if (!ipc_recv_blocked_sender(dstva, npg)) {
+f0106226:	89 f2                	mov    %esi,%edx
+f0106228:	89 d8                	mov    %ebx,%eax
+f010622a:	e8 de fb ff ff       	call   f0105e0d <ipc_recv_blocked_sender>
+f010622f:	85 c0                	test   %eax,%eax
+f0106231:	74 4e                	je     f0106281 <sys_ipc_recv+0x7b>
+	return 0;
+f0106233:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0106238:	5b                   	pop    %ebx
+f0106239:	5e                   	pop    %esi
+f010623a:	5d                   	pop    %ebp
+f010623b:	c3                   	ret
+		return -E_INVAL;
+f010623c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106241:	eb f5                	jmp    f0106238 <sys_ipc_recv+0x32>
+		curenv->env_ipc_recving = 1;
+f0106243:	e8 fb 1b 00 00       	call   f0107e43 <cpunum>
+f0106248:	6b c0 74             	imul   $0x74,%eax,%eax
+f010624b:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0106251:	c6 40 78 01          	movb   $0x1,0x78(%eax)
+		curenv->env_ipc_dstva = dstva;
+f0106255:	e8 e9 1b 00 00       	call   f0107e43 <cpunum>
+f010625a:	6b c0 74             	imul   $0x74,%eax,%eax
+f010625d:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0106263:	89 58 7c             	mov    %ebx,0x7c(%eax)
+		curenv->env_ipc_dstnpg = (uint32_t)dstva < UTOP ? npg : 0;
+f0106266:	be 00 00 00 00       	mov    $0x0,%esi
+f010626b:	eb 37                	jmp    f01062a4 <sys_ipc_recv+0x9e>
+	if (!ipc_recv_blocked_sender(dstva, npg)) {
+f010626d:	89 f2                	mov    %esi,%edx
+f010626f:	89 d8                	mov    %ebx,%eax
+f0106271:	e8 97 fb ff ff       	call   f0105e0d <ipc_recv_blocked_sender>
+f0106276:	85 c0                	test   %eax,%eax
+f0106278:	74 c9                	je     f0106243 <sys_ipc_recv+0x3d>
+	return 0;
+f010627a:	b8 00 00 00 00       	mov    $0x0,%eax
+f010627f:	eb b7                	jmp    f0106238 <sys_ipc_recv+0x32>
+		curenv->env_ipc_recving = 1;
+f0106281:	e8 bd 1b 00 00       	call   f0107e43 <cpunum>
+f0106286:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106289:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f010628f:	c6 40 78 01          	movb   $0x1,0x78(%eax)
+		curenv->env_ipc_dstva = dstva;
+f0106293:	e8 ab 1b 00 00       	call   f0107e43 <cpunum>
+f0106298:	6b c0 74             	imul   $0x74,%eax,%eax
+f010629b:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01062a1:	89 58 7c             	mov    %ebx,0x7c(%eax)
+		curenv->env_ipc_dstnpg = (uint32_t)dstva < UTOP ? npg : 0;
+f01062a4:	e8 9a 1b 00 00       	call   f0107e43 <cpunum>
+f01062a9:	6b c0 74             	imul   $0x74,%eax,%eax
+f01062ac:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01062b2:	89 b0 80 00 00 00    	mov    %esi,0x80(%eax)
+		curenv->env_status = ENV_NOT_RUNNABLE;
+f01062b8:	e8 86 1b 00 00       	call   f0107e43 <cpunum>
+f01062bd:	6b c0 74             	imul   $0x74,%eax,%eax
+f01062c0:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01062c6:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+		sched_yield();
+f01062cd:	e8 40 ed ff ff       	call   f0105012 <sched_yield>
+
+f01062d2 <sys_env_set_trapframe>:
+{
+f01062d2:	55                   	push   %ebp
+f01062d3:	89 e5                	mov    %esp,%ebp
+f01062d5:	57                   	push   %edi
+f01062d6:	56                   	push   %esi
+f01062d7:	83 ec 10             	sub    $0x10,%esp
+f01062da:	8b 75 0c             	mov    0xc(%ebp),%esi
+	user_mem_assert(curenv, (void *)tf, sizeof(struct Trapframe), PTE_U);
+f01062dd:	e8 61 1b 00 00       	call   f0107e43 <cpunum>
+f01062e2:	6a 04                	push   $0x4
+f01062e4:	6a 44                	push   $0x44
+f01062e6:	56                   	push   %esi
+f01062e7:	6b c0 74             	imul   $0x74,%eax,%eax
+f01062ea:	ff b0 28 b0 85 f0    	push   -0xf7a4fd8(%eax)
+f01062f0:	e8 a3 d0 ff ff       	call   f0103398 <user_mem_assert>
+	if (envid2env(envid, &e, 1) < 0) {
+f01062f5:	83 c4 0c             	add    $0xc,%esp
+f01062f8:	6a 01                	push   $0x1
+f01062fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f01062fd:	50                   	push   %eax
+f01062fe:	ff 75 08             	push   0x8(%ebp)
+f0106301:	e8 c5 d1 ff ff       	call   f01034cb <envid2env>
+f0106306:	83 c4 10             	add    $0x10,%esp
+f0106309:	85 c0                	test   %eax,%eax
+f010630b:	78 24                	js     f0106331 <sys_env_set_trapframe+0x5f>
+	e->env_tf = *tf;
+f010630d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0106310:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0106315:	89 c7                	mov    %eax,%edi
+f0106317:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	e->env_tf.tf_cs |= 3;
+f0106319:	66 83 48 34 03       	orw    $0x3,0x34(%eax)
+	e->env_tf.tf_eflags |= FL_IF;
+f010631e:	81 48 38 00 02 00 00 	orl    $0x200,0x38(%eax)
+	return 0;
+f0106325:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010632a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010632d:	5e                   	pop    %esi
+f010632e:	5f                   	pop    %edi
+f010632f:	5d                   	pop    %ebp
+f0106330:	c3                   	ret
+		return -E_BAD_ENV;
+f0106331:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0106336:	eb f2                	jmp    f010632a <sys_env_set_trapframe+0x58>
+
+f0106338 <sys_env_set_segments>:
+{
+f0106338:	55                   	push   %ebp
+f0106339:	89 e5                	mov    %esp,%ebp
+f010633b:	57                   	push   %edi
+f010633c:	56                   	push   %esi
+f010633d:	53                   	push   %ebx
+f010633e:	83 ec 30             	sub    $0x30,%esp
+	if (envid2env(envid, &e, 1) < 0)
+f0106341:	6a 01                	push   $0x1
+f0106343:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0106346:	50                   	push   %eax
+f0106347:	ff 75 08             	push   0x8(%ebp)
+f010634a:	e8 7c d1 ff ff       	call   f01034cb <envid2env>
+f010634f:	83 c4 10             	add    $0x10,%esp
+f0106352:	85 c0                	test   %eax,%eax
+f0106354:	0f 88 44 01 00 00    	js     f010649e <sys_env_set_segments+0x166>
+	if (nsegs < 0 || nsegs > NSEGS)
+f010635a:	83 7d 10 04          	cmpl   $0x4,0x10(%ebp)
+f010635e:	0f 87 41 01 00 00    	ja     f01064a5 <sys_env_set_segments+0x16d>
+	user_mem_assert(curenv, segs, nsegs * sizeof(struct Segment), PTE_U);
+f0106364:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106367:	c1 e0 05             	shl    $0x5,%eax
+f010636a:	89 c6                	mov    %eax,%esi
+f010636c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010636f:	e8 cf 1a 00 00       	call   f0107e43 <cpunum>
+f0106374:	6a 04                	push   $0x4
+f0106376:	56                   	push   %esi
+f0106377:	ff 75 0c             	push   0xc(%ebp)
+f010637a:	6b c0 74             	imul   $0x74,%eax,%eax
+f010637d:	ff b0 28 b0 85 f0    	push   -0xf7a4fd8(%eax)
+f0106383:	e8 10 d0 ff ff       	call   f0103398 <user_mem_assert>
+	for (i = 0; i < nsegs; i++) {
+f0106388:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f010638b:	83 c4 10             	add    $0x10,%esp
+f010638e:	89 fb                	mov    %edi,%ebx
+f0106390:	be 00 00 00 00       	mov    $0x0,%esi
+f0106395:	89 7d d0             	mov    %edi,-0x30(%ebp)
+f0106398:	eb 06                	jmp    f01063a0 <sys_env_set_segments+0x68>
+f010639a:	83 c6 01             	add    $0x1,%esi
+f010639d:	83 c3 20             	add    $0x20,%ebx
+f01063a0:	3b 75 10             	cmp    0x10(%ebp),%esi
+f01063a3:	0f 84 87 00 00 00    	je     f0106430 <sys_env_set_segments+0xf8>
+		if (PGOFF(segs[i].seg_va) || PGOFF(segs[i].seg_offset)
+f01063a9:	8b 13                	mov    (%ebx),%edx
+f01063ab:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f01063b1:	0f 85 f5 00 00 00    	jne    f01064ac <sys_env_set_segments+0x174>
+		    || segs[i].seg_va >= UTOP || segs[i].seg_memsz > UTOP - segs[i].seg_va
+f01063b7:	66 f7 43 0c ff 0f    	testw  $0xfff,0xc(%ebx)
+f01063bd:	0f 85 f0 00 00 00    	jne    f01064b3 <sys_env_set_segments+0x17b>
+f01063c3:	81 fa ff ff bf ee    	cmp    $0xeebfffff,%edx
+f01063c9:	0f 87 e4 00 00 00    	ja     f01064b3 <sys_env_set_segments+0x17b>
+f01063cf:	8b 4b 04             	mov    0x4(%ebx),%ecx
+f01063d2:	bf 00 00 c0 ee       	mov    $0xeec00000,%edi
+f01063d7:	29 d7                	sub    %edx,%edi
+f01063d9:	39 cf                	cmp    %ecx,%edi
+f01063db:	0f 82 df 00 00 00    	jb     f01064c0 <sys_env_set_segments+0x188>
+		    || segs[i].seg_filesz > segs[i].seg_memsz)
+f01063e1:	8b 53 08             	mov    0x8(%ebx),%edx
+f01063e4:	39 d1                	cmp    %edx,%ecx
+f01063e6:	0f 82 db 00 00 00    	jb     f01064c7 <sys_env_set_segments+0x18f>
+		if ((segs[i].seg_perm & (PTE_U|PTE_P)) != (PTE_U|PTE_P)
+f01063ec:	8b 4b 10             	mov    0x10(%ebx),%ecx
+f01063ef:	89 cf                	mov    %ecx,%edi
+f01063f1:	83 e7 05             	and    $0x5,%edi
+f01063f4:	83 ff 05             	cmp    $0x5,%edi
+f01063f7:	0f 85 d1 00 00 00    	jne    f01064ce <sys_env_set_segments+0x196>
+		    || (segs[i].seg_perm & ~(PTE_U|PTE_P|PTE_W)))
+f01063fd:	83 f9 07             	cmp    $0x7,%ecx
+f0106400:	0f 87 cf 00 00 00    	ja     f01064d5 <sys_env_set_segments+0x19d>
+		if (segs[i].seg_filesz && envid2env(segs[i].seg_pager, &pager, 0) < 0)
+f0106406:	85 d2                	test   %edx,%edx
+f0106408:	74 90                	je     f010639a <sys_env_set_segments+0x62>
+f010640a:	83 ec 04             	sub    $0x4,%esp
+f010640d:	6a 00                	push   $0x0
+f010640f:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+f0106412:	51                   	push   %ecx
+f0106413:	ff 73 14             	push   0x14(%ebx)
+f0106416:	e8 b0 d0 ff ff       	call   f01034cb <envid2env>
+f010641b:	83 c4 10             	add    $0x10,%esp
+f010641e:	85 c0                	test   %eax,%eax
+f0106420:	0f 89 74 ff ff ff    	jns    f010639a <sys_env_set_segments+0x62>
+			return -E_BAD_ENV;
+f0106426:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f010642b:	e9 88 00 00 00       	jmp    f01064b8 <sys_env_set_segments+0x180>
+	memset(e->env_segs, 0, sizeof(e->env_segs));
+f0106430:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0106433:	83 ec 04             	sub    $0x4,%esp
+f0106436:	68 80 00 00 00       	push   $0x80
+f010643b:	6a 00                	push   $0x0
+f010643d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106440:	05 b4 00 00 00       	add    $0xb4,%eax
+f0106445:	50                   	push   %eax
+f0106446:	e8 44 13 00 00       	call   f010778f <memset>
+	for (i = 0; i < nsegs; i++) {
+f010644b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010644e:	05 d0 00 00 00       	add    $0xd0,%eax
+f0106453:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0106456:	03 4d 0c             	add    0xc(%ebp),%ecx
+f0106459:	83 c4 10             	add    $0x10,%esp
+f010645c:	eb 35                	jmp    f0106493 <sys_env_set_segments+0x15b>
+		*seg = segs[i];
+f010645e:	8b 17                	mov    (%edi),%edx
+f0106460:	89 50 e4             	mov    %edx,-0x1c(%eax)
+f0106463:	8b 57 04             	mov    0x4(%edi),%edx
+f0106466:	89 50 e8             	mov    %edx,-0x18(%eax)
+f0106469:	8b 57 08             	mov    0x8(%edi),%edx
+f010646c:	89 50 ec             	mov    %edx,-0x14(%eax)
+f010646f:	8b 57 0c             	mov    0xc(%edi),%edx
+f0106472:	89 50 f0             	mov    %edx,-0x10(%eax)
+f0106475:	8b 57 10             	mov    0x10(%edi),%edx
+f0106478:	89 50 f4             	mov    %edx,-0xc(%eax)
+f010647b:	8b 57 14             	mov    0x14(%edi),%edx
+f010647e:	89 50 f8             	mov    %edx,-0x8(%eax)
+f0106481:	8b 57 18             	mov    0x18(%edi),%edx
+f0106484:	89 50 fc             	mov    %edx,-0x4(%eax)
+		seg->seg_binary = NULL;
+f0106487:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	for (i = 0; i < nsegs; i++) {
+f010648d:	83 c7 20             	add    $0x20,%edi
+f0106490:	83 c0 20             	add    $0x20,%eax
+f0106493:	39 cf                	cmp    %ecx,%edi
+f0106495:	75 c7                	jne    f010645e <sys_env_set_segments+0x126>
+	return 0;
+f0106497:	b8 00 00 00 00       	mov    $0x0,%eax
+f010649c:	eb 1a                	jmp    f01064b8 <sys_env_set_segments+0x180>
+		return -E_BAD_ENV;
+f010649e:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f01064a3:	eb 13                	jmp    f01064b8 <sys_env_set_segments+0x180>
+		return -E_INVAL;
+f01064a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01064aa:	eb 0c                	jmp    f01064b8 <sys_env_set_segments+0x180>
+			return -E_INVAL;
+f01064ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01064b1:	eb 05                	jmp    f01064b8 <sys_env_set_segments+0x180>
+f01064b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+f01064b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01064bb:	5b                   	pop    %ebx
+f01064bc:	5e                   	pop    %esi
+f01064bd:	5f                   	pop    %edi
+f01064be:	5d                   	pop    %ebp
+f01064bf:	c3                   	ret
+			return -E_INVAL;
+f01064c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01064c5:	eb f1                	jmp    f01064b8 <sys_env_set_segments+0x180>
+f01064c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01064cc:	eb ea                	jmp    f01064b8 <sys_env_set_segments+0x180>
+			return -E_INVAL;
+f01064ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01064d3:	eb e3                	jmp    f01064b8 <sys_env_set_segments+0x180>
+f01064d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01064da:	eb dc                	jmp    f01064b8 <sys_env_set_segments+0x180>
+
+f01064dc <sys_exofork>:
+{
+f01064dc:	55                   	push   %ebp
+f01064dd:	89 e5                	mov    %esp,%ebp
+f01064df:	83 ec 18             	sub    $0x18,%esp
+	if ((r = env_alloc(&e, curenv->env_id)) < 0) {
+f01064e2:	e8 5c 19 00 00       	call   f0107e43 <cpunum>
+f01064e7:	83 ec 08             	sub    $0x8,%esp
+f01064ea:	6b c0 74             	imul   $0x74,%eax,%eax
+f01064ed:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01064f3:	ff 70 48             	push   0x48(%eax)
+f01064f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f01064f9:	50                   	push   %eax
+f01064fa:	e8 e6 d0 ff ff       	call   f01035e5 <env_alloc>
+f01064ff:	83 c4 10             	add    $0x10,%esp
+f0106502:	85 c0                	test   %eax,%eax
+f0106504:	78 62                	js     f0106568 <sys_exofork+0x8c>
+	e->env_status = ENV_NOT_RUNNABLE;
+f0106506:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0106509:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+	memmove((void *)(&(e->env_tf)), (void *)(&(curenv->env_tf)), (size_t)(sizeof(struct Trapframe)));
+f0106510:	e8 2e 19 00 00       	call   f0107e43 <cpunum>
+f0106515:	83 ec 04             	sub    $0x4,%esp
+f0106518:	6a 44                	push   $0x44
+f010651a:	6b c0 74             	imul   $0x74,%eax,%eax
+f010651d:	ff b0 28 b0 85 f0    	push   -0xf7a4fd8(%eax)
+f0106523:	ff 75 f4             	push   -0xc(%ebp)
+f0106526:	e8 99 12 00 00       	call   f01077c4 <memmove>
+	e->env_tf.tf_regs.reg_eax = 0;
+f010652b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010652e:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+	memmove(e->env_segs, curenv->env_segs, sizeof(e->env_segs));
+f0106535:	e8 09 19 00 00       	call   f0107e43 <cpunum>
+f010653a:	83 c4 0c             	add    $0xc,%esp
+f010653d:	68 80 00 00 00       	push   $0x80
+f0106542:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106545:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f010654b:	05 b4 00 00 00       	add    $0xb4,%eax
+f0106550:	50                   	push   %eax
+f0106551:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0106554:	05 b4 00 00 00       	add    $0xb4,%eax
+f0106559:	50                   	push   %eax
+f010655a:	e8 65 12 00 00       	call   f01077c4 <memmove>
+	return e->env_id;
+f010655f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0106562:	8b 40 48             	mov    0x48(%eax),%eax
+f0106565:	83 c4 10             	add    $0x10,%esp
+}
+f0106568:	c9                   	leave
+f0106569:	c3                   	ret
+
+f010656a <sys_fork>:
+{
+f010656a:	55                   	push   %ebp
+f010656b:	89 e5                	mov    %esp,%ebp
+f010656d:	57                   	push   %edi
+f010656e:	56                   	push   %esi
+f010656f:	53                   	push   %ebx
+f0106570:	83 ec 1c             	sub    $0x1c,%esp
+	if (num_free_pages < SOFT_MIN_FREE_PAGES)
+f0106573:	83 3d 5c a0 85 f0 33 	cmpl   $0x33,0xf085a05c
+f010657a:	0f 86 31 01 00 00    	jbe    f01066b1 <sys_fork+0x147>
+	if ((r = env_alloc(&e, curenv->env_id)) < 0)
+f0106580:	e8 be 18 00 00       	call   f0107e43 <cpunum>
+f0106585:	83 ec 08             	sub    $0x8,%esp
+f0106588:	6b c0 74             	imul   $0x74,%eax,%eax
+f010658b:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0106591:	ff 70 48             	push   0x48(%eax)
+f0106594:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0106597:	50                   	push   %eax
+f0106598:	e8 48 d0 ff ff       	call   f01035e5 <env_alloc>
+f010659d:	89 c3                	mov    %eax,%ebx
+f010659f:	83 c4 10             	add    $0x10,%esp
+f01065a2:	85 c0                	test   %eax,%eax
+f01065a4:	0f 88 fd 00 00 00    	js     f01066a7 <sys_fork+0x13d>
+	e->env_status = ENV_NOT_RUNNABLE;
+f01065aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01065ad:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+	e->env_tf = curenv->env_tf;
+f01065b4:	e8 8a 18 00 00       	call   f0107e43 <cpunum>
+f01065b9:	6b c0 74             	imul   $0x74,%eax,%eax
+f01065bc:	8b b0 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%esi
+f01065c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01065c5:	b9 11 00 00 00       	mov    $0x11,%ecx
+f01065ca:	89 c7                	mov    %eax,%edi
+f01065cc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	e->env_tf.tf_regs.reg_eax = 0;
+f01065ce:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+	e->env_pgfault_upcall = curenv->env_pgfault_upcall;
+f01065d5:	e8 69 18 00 00       	call   f0107e43 <cpunum>
+f01065da:	6b c0 74             	imul   $0x74,%eax,%eax
+f01065dd:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f01065e3:	8b 50 74             	mov    0x74(%eax),%edx
+f01065e6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01065e9:	89 50 74             	mov    %edx,0x74(%eax)
+	memmove(e->env_segs, curenv->env_segs, sizeof(e->env_segs));
+f01065ec:	e8 52 18 00 00       	call   f0107e43 <cpunum>
+f01065f1:	83 ec 04             	sub    $0x4,%esp
+f01065f4:	68 80 00 00 00       	push   $0x80
+f01065f9:	6b c0 74             	imul   $0x74,%eax,%eax
+f01065fc:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0106602:	05 b4 00 00 00       	add    $0xb4,%eax
+f0106607:	50                   	push   %eax
+f0106608:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010660b:	05 b4 00 00 00       	add    $0xb4,%eax
+f0106610:	50                   	push   %eax
+f0106611:	e8 ae 11 00 00       	call   f01077c4 <memmove>
+	if ((r = page_fork(curenv->env_pgdir, e->env_pgdir, USTACKTOP, &e->env_npages)) < 0)
+f0106616:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0106619:	8b 73 60             	mov    0x60(%ebx),%esi
+f010661c:	e8 22 18 00 00       	call   f0107e43 <cpunum>
+f0106621:	83 c3 64             	add    $0x64,%ebx
+f0106624:	53                   	push   %ebx
+f0106625:	68 00 e0 bf ee       	push   $0xeebfe000
+f010662a:	56                   	push   %esi
+f010662b:	6b c0 74             	imul   $0x74,%eax,%eax
+f010662e:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0106634:	ff 70 60             	push   0x60(%eax)
+f0106637:	e8 c8 c9 ff ff       	call   f0103004 <page_fork>
+f010663c:	89 c3                	mov    %eax,%ebx
+f010663e:	83 c4 20             	add    $0x20,%esp
+f0106641:	85 c0                	test   %eax,%eax
+f0106643:	78 54                	js     f0106699 <sys_fork+0x12f>
+	if (!(p = page_alloc(ALLOC_ZERO)))
+f0106645:	83 ec 0c             	sub    $0xc,%esp
+f0106648:	6a 01                	push   $0x1
+f010664a:	e8 a1 b0 ff ff       	call   f01016f0 <page_alloc>
+f010664f:	89 c3                	mov    %eax,%ebx
+f0106651:	83 c4 10             	add    $0x10,%esp
+f0106654:	85 c0                	test   %eax,%eax
+f0106656:	74 3c                	je     f0106694 <sys_fork+0x12a>
+	if (page_insert(e->env_pgdir, p, (void *) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W, &e->env_npages) < 0) {
+f0106658:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010665b:	83 ec 0c             	sub    $0xc,%esp
+f010665e:	8d 50 64             	lea    0x64(%eax),%edx
+f0106661:	52                   	push   %edx
+f0106662:	6a 07                	push   $0x7
+f0106664:	68 00 f0 bf ee       	push   $0xeebff000
+f0106669:	53                   	push   %ebx
+f010666a:	ff 70 60             	push   0x60(%eax)
+f010666d:	e8 06 c0 ff ff       	call   f0102678 <page_insert>
+f0106672:	83 c4 20             	add    $0x20,%esp
+f0106675:	85 c0                	test   %eax,%eax
+f0106677:	78 08                	js     f0106681 <sys_fork+0x117>
+	return e->env_id;
+f0106679:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010667c:	8b 58 48             	mov    0x48(%eax),%ebx
+f010667f:	eb 26                	jmp    f01066a7 <sys_fork+0x13d>
+		page_free(p);
+f0106681:	83 ec 0c             	sub    $0xc,%esp
+f0106684:	53                   	push   %ebx
+f0106685:	e8 ac b1 ff ff       	call   f0101836 <page_free>
+		goto bad;
+f010668a:	83 c4 10             	add    $0x10,%esp
+	r = -E_NO_MEM;
+f010668d:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+		goto bad;
+f0106692:	eb 05                	jmp    f0106699 <sys_fork+0x12f>
+	r = -E_NO_MEM;
+f0106694:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+	env_free(e);
+f0106699:	83 ec 0c             	sub    $0xc,%esp
+f010669c:	ff 75 e4             	push   -0x1c(%ebp)
+f010669f:	e8 3a d8 ff ff       	call   f0103ede <env_free>
+	return r;
+f01066a4:	83 c4 10             	add    $0x10,%esp
+}
+f01066a7:	89 d8                	mov    %ebx,%eax
+f01066a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01066ac:	5b                   	pop    %ebx
+f01066ad:	5e                   	pop    %esi
+f01066ae:	5f                   	pop    %edi
+f01066af:	5d                   	pop    %ebp
+f01066b0:	c3                   	ret
+		return -E_NO_MEM;
+f01066b1:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+f01066b6:	eb ef                	jmp    f01066a7 <sys_fork+0x13d>
+
+f01066b8 <sys_page_map_range>:
+{
+f01066b8:	55                   	push   %ebp
+f01066b9:	89 e5                	mov    %esp,%ebp
+f01066bb:	57                   	push   %edi
+f01066bc:	56                   	push   %esi
+f01066bd:	53                   	push   %ebx
+f01066be:	83 ec 20             	sub    $0x20,%esp
+f01066c1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	void *dstva = (void *)ROUNDDOWN(dstva_perm, PGSIZE);
+f01066c4:	89 de                	mov    %ebx,%esi
+f01066c6:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	int perm = PGOFF(dstva_perm);
+f01066cc:	89 df                	mov    %ebx,%edi
+f01066ce:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+	if ((envid2env(srcenvid, &srcenv, 1) < 0) || (envid2env(dstenvid, &dstenv, 1) < 0)) {
+f01066d4:	6a 01                	push   $0x1
+f01066d6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01066d9:	50                   	push   %eax
+f01066da:	ff 75 08             	push   0x8(%ebp)
+f01066dd:	e8 e9 cd ff ff       	call   f01034cb <envid2env>
+f01066e2:	83 c4 10             	add    $0x10,%esp
+f01066e5:	85 c0                	test   %eax,%eax
+f01066e7:	78 6b                	js     f0106754 <sys_page_map_range+0x9c>
+f01066e9:	83 ec 04             	sub    $0x4,%esp
+f01066ec:	6a 01                	push   $0x1
+f01066ee:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f01066f1:	50                   	push   %eax
+f01066f2:	ff 75 10             	push   0x10(%ebp)
+f01066f5:	e8 d1 cd ff ff       	call   f01034cb <envid2env>
+f01066fa:	83 c4 10             	add    $0x10,%esp
+f01066fd:	85 c0                	test   %eax,%eax
+f01066ff:	78 5a                	js     f010675b <sys_page_map_range+0xa3>
+	if ((check_user_range(srcva, npg) < 0) || (check_user_range(dstva, npg) < 0)) {
+f0106701:	8b 55 18             	mov    0x18(%ebp),%edx
+f0106704:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106707:	e8 dc e9 ff ff       	call   f01050e8 <check_user_range>
+f010670c:	85 c0                	test   %eax,%eax
+f010670e:	78 52                	js     f0106762 <sys_page_map_range+0xaa>
+f0106710:	8b 55 18             	mov    0x18(%ebp),%edx
+f0106713:	89 f0                	mov    %esi,%eax
+f0106715:	e8 ce e9 ff ff       	call   f01050e8 <check_user_range>
+f010671a:	85 c0                	test   %eax,%eax
+f010671c:	78 4b                	js     f0106769 <sys_page_map_range+0xb1>
+	if (((perm & (PTE_U | PTE_P)) ^ (PTE_U | PTE_P)) | (perm & (~(PTE_U | PTE_P | PTE_AVAIL | PTE_W)))) {
+f010671e:	81 e3 fd 01 00 00    	and    $0x1fd,%ebx
+f0106724:	83 fb 05             	cmp    $0x5,%ebx
+f0106727:	75 47                	jne    f0106770 <sys_page_map_range+0xb8>
+	return page_map_range(srcenv->env_pgdir, srcva, dstenv->env_pgdir, dstva, npg, perm, &dstenv->env_npages);
+f0106729:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010672c:	83 ec 04             	sub    $0x4,%esp
+f010672f:	8d 50 64             	lea    0x64(%eax),%edx
+f0106732:	52                   	push   %edx
+f0106733:	57                   	push   %edi
+f0106734:	ff 75 18             	push   0x18(%ebp)
+f0106737:	56                   	push   %esi
+f0106738:	ff 70 60             	push   0x60(%eax)
+f010673b:	ff 75 0c             	push   0xc(%ebp)
+f010673e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106741:	ff 70 60             	push   0x60(%eax)
+f0106744:	e8 97 c5 ff ff       	call   f0102ce0 <page_map_range>
+f0106749:	83 c4 20             	add    $0x20,%esp
+}
+f010674c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010674f:	5b                   	pop    %ebx
+f0106750:	5e                   	pop    %esi
+f0106751:	5f                   	pop    %edi
+f0106752:	5d                   	pop    %ebp
+f0106753:	c3                   	ret
+		return -E_BAD_ENV;
+f0106754:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0106759:	eb f1                	jmp    f010674c <sys_page_map_range+0x94>
+f010675b:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0106760:	eb ea                	jmp    f010674c <sys_page_map_range+0x94>
+		return -E_INVAL;
+f0106762:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106767:	eb e3                	jmp    f010674c <sys_page_map_range+0x94>
+f0106769:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010676e:	eb dc                	jmp    f010674c <sys_page_map_range+0x94>
+		return -E_INVAL;
+f0106770:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106775:	eb d5                	jmp    f010674c <sys_page_map_range+0x94>
+
+f0106777 <sys_page_alloc_range>:
+{
+f0106777:	55                   	push   %ebp
+f0106778:	89 e5                	mov    %esp,%ebp
+f010677a:	57                   	push   %edi
+f010677b:	56                   	push   %esi
+f010677c:	53                   	push   %ebx
+f010677d:	83 ec 20             	sub    $0x20,%esp
+	if (envid2env(envid, &e, 1) < 0) {
+f0106780:	6a 01                	push   $0x1
+f0106782:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0106785:	50                   	push   %eax
+f0106786:	ff 75 08             	push   0x8(%ebp)
+f0106789:	e8 3d cd ff ff       	call   f01034cb <envid2env>
+f010678e:	83 c4 10             	add    $0x10,%esp
+f0106791:	85 c0                	test   %eax,%eax
+f0106793:	0f 88 91 00 00 00    	js     f010682a <sys_page_alloc_range+0xb3>
+	if (check_user_range(va, npg) < 0) {
+f0106799:	8b 55 10             	mov    0x10(%ebp),%edx
+f010679c:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010679f:	e8 44 e9 ff ff       	call   f01050e8 <check_user_range>
+f01067a4:	85 c0                	test   %eax,%eax
+f01067a6:	0f 88 85 00 00 00    	js     f0106831 <sys_page_alloc_range+0xba>
+	if (((perm & (PTE_U | PTE_P)) ^ (PTE_U | PTE_P)) | (perm & (~(PTE_U | PTE_P | PTE_AVAIL | PTE_W)))) {
+f01067ac:	8b 45 14             	mov    0x14(%ebp),%eax
+f01067af:	25 fd f1 ff ff       	and    $0xfffff1fd,%eax
+f01067b4:	83 f8 05             	cmp    $0x5,%eax
+f01067b7:	75 7f                	jne    f0106838 <sys_page_alloc_range+0xc1>
+	if(num_free_pages < HARD_MIN_FREE_PAGES)
+f01067b9:	8b 1d 5c a0 85 f0    	mov    0xf085a05c,%ebx
+f01067bf:	83 fb 31             	cmp    $0x31,%ebx
+f01067c2:	76 7b                	jbe    f010683f <sys_page_alloc_range+0xc8>
+	if(e->env_npages > env_share(e))
+f01067c4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f01067c7:	8b 7e 64             	mov    0x64(%esi),%edi
+f01067ca:	89 f0                	mov    %esi,%eax
+f01067cc:	e8 75 eb ff ff       	call   f0105346 <env_share>
+f01067d1:	89 c2                	mov    %eax,%edx
+		nfree = (num_free_pages > SOFT_MIN_FREE_PAGES ? num_free_pages - SOFT_MIN_FREE_PAGES : 0);
+f01067d3:	b8 34 00 00 00       	mov    $0x34,%eax
+f01067d8:	39 c3                	cmp    %eax,%ebx
+f01067da:	0f 43 c3             	cmovae %ebx,%eax
+f01067dd:	83 e8 34             	sub    $0x34,%eax
+f01067e0:	83 eb 32             	sub    $0x32,%ebx
+f01067e3:	39 d7                	cmp    %edx,%edi
+f01067e5:	0f 4f d8             	cmovg  %eax,%ebx
+	if (e->env_rss_max)
+f01067e8:	8b 46 6c             	mov    0x6c(%esi),%eax
+f01067eb:	85 c0                	test   %eax,%eax
+f01067ed:	74 0f                	je     f01067fe <sys_page_alloc_range+0x87>
+		nfree = MIN(nfree, (size_t) MAX(e->env_rss_max - e->env_npages, 0));
+f01067ef:	29 f8                	sub    %edi,%eax
+f01067f1:	ba 00 00 00 00       	mov    $0x0,%edx
+f01067f6:	0f 48 c2             	cmovs  %edx,%eax
+f01067f9:	39 c3                	cmp    %eax,%ebx
+f01067fb:	0f 47 d8             	cmova  %eax,%ebx
+	if (nfree == 0)
+f01067fe:	85 db                	test   %ebx,%ebx
+f0106800:	74 44                	je     f0106846 <sys_page_alloc_range+0xcf>
+	return page_alloc_range(e->env_pgdir, va, MIN(npg, nfree), perm, &e->env_npages);
+f0106802:	83 ec 0c             	sub    $0xc,%esp
+f0106805:	8d 46 64             	lea    0x64(%esi),%eax
+f0106808:	50                   	push   %eax
+f0106809:	ff 75 14             	push   0x14(%ebp)
+f010680c:	3b 5d 10             	cmp    0x10(%ebp),%ebx
+f010680f:	0f 47 5d 10          	cmova  0x10(%ebp),%ebx
+f0106813:	53                   	push   %ebx
+f0106814:	ff 75 0c             	push   0xc(%ebp)
+f0106817:	ff 76 60             	push   0x60(%esi)
+f010681a:	e8 14 c4 ff ff       	call   f0102c33 <page_alloc_range>
+f010681f:	83 c4 20             	add    $0x20,%esp
+}
+f0106822:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106825:	5b                   	pop    %ebx
+f0106826:	5e                   	pop    %esi
+f0106827:	5f                   	pop    %edi
+f0106828:	5d                   	pop    %ebp
+f0106829:	c3                   	ret
+		return -E_BAD_ENV;
+f010682a:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f010682f:	eb f1                	jmp    f0106822 <sys_page_alloc_range+0xab>
+		return -E_INVAL;
+f0106831:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106836:	eb ea                	jmp    f0106822 <sys_page_alloc_range+0xab>
+		return -E_INVAL;
+f0106838:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010683d:	eb e3                	jmp    f0106822 <sys_page_alloc_range+0xab>
+		return -E_NO_MEM;
+f010683f:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0106844:	eb dc                	jmp    f0106822 <sys_page_alloc_range+0xab>
+		return -E_NO_MEM;
+f0106846:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010684b:	eb d5                	jmp    f0106822 <sys_page_alloc_range+0xab>
+
+f010684d <sys_page_unmap>:
+{
+f010684d:	55                   	push   %ebp
+f010684e:	89 e5                	mov    %esp,%ebp
+f0106850:	53                   	push   %ebx
+f0106851:	83 ec 18             	sub    $0x18,%esp
+f0106854:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (envid2env(envid, &e, 1) < 0) {
+f0106857:	6a 01                	push   $0x1
+f0106859:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f010685c:	50                   	push   %eax
+f010685d:	ff 75 08             	push   0x8(%ebp)
+f0106860:	e8 66 cc ff ff       	call   f01034cb <envid2env>
+f0106865:	83 c4 10             	add    $0x10,%esp
+f0106868:	85 c0                	test   %eax,%eax
+f010686a:	78 30                	js     f010689c <sys_page_unmap+0x4f>
+	if ((((uint32_t)va) >= UTOP) || ((uint32_t)va)%PGSIZE) {
+f010686c:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f0106872:	77 2f                	ja     f01068a3 <sys_page_unmap+0x56>
+f0106874:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f010687a:	75 2e                	jne    f01068aa <sys_page_unmap+0x5d>
+	page_remove(e->env_pgdir, va, &e->env_npages);
+f010687c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010687f:	83 ec 04             	sub    $0x4,%esp
+f0106882:	8d 50 64             	lea    0x64(%eax),%edx
+f0106885:	52                   	push   %edx
+f0106886:	53                   	push   %ebx
+f0106887:	ff 70 60             	push   0x60(%eax)
+f010688a:	e8 7f bd ff ff       	call   f010260e <page_remove>
+	return 0;
+f010688f:	83 c4 10             	add    $0x10,%esp
+f0106892:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0106897:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010689a:	c9                   	leave
+f010689b:	c3                   	ret
+		return -E_BAD_ENV;
+f010689c:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f01068a1:	eb f4                	jmp    f0106897 <sys_page_unmap+0x4a>
+		return -E_INVAL;
+f01068a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01068a8:	eb ed                	jmp    f0106897 <sys_page_unmap+0x4a>
+f01068aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01068af:	eb e6                	jmp    f0106897 <sys_page_unmap+0x4a>
+
+f01068b1 <sys_page_alloc>:
+{
+f01068b1:	55                   	push   %ebp
+f01068b2:	89 e5                	mov    %esp,%ebp
+f01068b4:	57                   	push   %edi
+f01068b5:	56                   	push   %esi
+f01068b6:	53                   	push   %ebx
+f01068b7:	83 ec 30             	sub    $0x30,%esp
+	if (envid2env(envid, &e, 1) < 0) {
+f01068ba:	6a 01                	push   $0x1
+f01068bc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01068bf:	50                   	push   %eax
+f01068c0:	ff 75 08             	push   0x8(%ebp)
+f01068c3:	e8 03 cc ff ff       	call   f01034cb <envid2env>
+f01068c8:	83 c4 10             	add    $0x10,%esp
+f01068cb:	85 c0                	test   %eax,%eax
+f01068cd:	0f 88 19 01 00 00    	js     f01069ec <sys_page_alloc+0x13b>
+	if ((((uint32_t)va) >= UTOP) || ((uint32_t)va)%PGSIZE) {
+f01068d3:	81 7d 0c ff ff bf ee 	cmpl   $0xeebfffff,0xc(%ebp)
+f01068da:	0f 87 15 01 00 00    	ja     f01069f5 <sys_page_alloc+0x144>
+f01068e0:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+f01068e7:	0f 85 14 01 00 00    	jne    f0106a01 <sys_page_alloc+0x150>
+	if (((perm & (PTE_U | PTE_P)) ^ (PTE_U | PTE_P)) | (perm & (~(PTE_U | PTE_P | PTE_AVAIL | PTE_W | PTE_PS)))) {
+f01068ed:	8b 45 10             	mov    0x10(%ebp),%eax
+f01068f0:	25 7d f1 ff ff       	and    $0xfffff17d,%eax
+f01068f5:	83 f8 05             	cmp    $0x5,%eax
+f01068f8:	0f 85 0f 01 00 00    	jne    f0106a0d <sys_page_alloc+0x15c>
+	if (e->env_rss_max && e->env_npages >= e->env_rss_max)
+f01068fe:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0106901:	8b 7b 6c             	mov    0x6c(%ebx),%edi
+f0106904:	85 ff                	test   %edi,%edi
+f0106906:	74 09                	je     f0106911 <sys_page_alloc+0x60>
+f0106908:	3b 7b 64             	cmp    0x64(%ebx),%edi
+f010690b:	0f 8e 08 01 00 00    	jle    f0106a19 <sys_page_alloc+0x168>
+	if(num_free_pages < SOFT_MIN_FREE_PAGES && e->env_npages > env_share(e))
+f0106911:	8b 35 5c a0 85 f0    	mov    0xf085a05c,%esi
+f0106917:	83 fe 33             	cmp    $0x33,%esi
+f010691a:	76 69                	jbe    f0106985 <sys_page_alloc+0xd4>
+	if(num_free_pages < HARD_MIN_FREE_PAGES)
+f010691c:	83 fe 31             	cmp    $0x31,%esi
+f010691f:	0f 86 00 01 00 00    	jbe    f0106a25 <sys_page_alloc+0x174>
+	if (perm & PTE_PS) {
+f0106925:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106928:	25 80 00 00 00       	and    $0x80,%eax
+f010692d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0106930:	74 6e                	je     f01069a0 <sys_page_alloc+0xef>
+		if (perm & PTE_AVAIL)
+f0106932:	f7 45 10 00 0e 00 00 	testl  $0xe00,0x10(%ebp)
+f0106939:	0f 85 f2 00 00 00    	jne    f0106a31 <sys_page_alloc+0x180>
+		if (num_free_pages < SOFT_MIN_FREE_PAGES + NPTENTRIES ||
+f010693f:	81 fe 33 04 00 00    	cmp    $0x433,%esi
+f0106945:	0f 86 f2 00 00 00    	jbe    f0106a3d <sys_page_alloc+0x18c>
+f010694b:	85 ff                	test   %edi,%edi
+f010694d:	74 10                	je     f010695f <sys_page_alloc+0xae>
+		    (e->env_rss_max && e->env_npages + NPTENTRIES > e->env_rss_max))
+f010694f:	8b 43 64             	mov    0x64(%ebx),%eax
+f0106952:	05 ff 03 00 00       	add    $0x3ff,%eax
+f0106957:	39 c7                	cmp    %eax,%edi
+f0106959:	0f 8e ea 00 00 00    	jle    f0106a49 <sys_page_alloc+0x198>
+		return page_insert_large(e->env_pgdir, va, perm & ~PTE_PS, &e->env_npages);
+f010695f:	8d 43 64             	lea    0x64(%ebx),%eax
+f0106962:	50                   	push   %eax
+f0106963:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106966:	24 7f                	and    $0x7f,%al
+f0106968:	50                   	push   %eax
+f0106969:	ff 75 0c             	push   0xc(%ebp)
+f010696c:	ff 73 60             	push   0x60(%ebx)
+f010696f:	e8 ff b0 ff ff       	call   f0101a73 <page_insert_large>
+f0106974:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0106977:	83 c4 10             	add    $0x10,%esp
+}
+f010697a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010697d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106980:	5b                   	pop    %ebx
+f0106981:	5e                   	pop    %esi
+f0106982:	5f                   	pop    %edi
+f0106983:	5d                   	pop    %ebp
+f0106984:	c3                   	ret
+	if(num_free_pages < SOFT_MIN_FREE_PAGES && e->env_npages > env_share(e))
+f0106985:	8b 43 64             	mov    0x64(%ebx),%eax
+f0106988:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010698b:	89 d8                	mov    %ebx,%eax
+f010698d:	e8 b4 e9 ff ff       	call   f0105346 <env_share>
+f0106992:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f0106995:	7e 85                	jle    f010691c <sys_page_alloc+0x6b>
+		return -E_NO_MEM;
+f0106997:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+f010699e:	eb da                	jmp    f010697a <sys_page_alloc+0xc9>
+	p = page_alloc(ALLOC_ZERO);
+f01069a0:	83 ec 0c             	sub    $0xc,%esp
+f01069a3:	6a 01                	push   $0x1
+f01069a5:	e8 46 ad ff ff       	call   f01016f0 <page_alloc>
+f01069aa:	89 c3                	mov    %eax,%ebx
+	if (!p) {
+f01069ac:	83 c4 10             	add    $0x10,%esp
+f01069af:	85 c0                	test   %eax,%eax
+f01069b1:	0f 84 9e 00 00 00    	je     f0106a55 <sys_page_alloc+0x1a4>
+	if (page_insert(e->env_pgdir, p, va, perm, &e->env_npages) < 0) {
+f01069b7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01069ba:	83 ec 0c             	sub    $0xc,%esp
+f01069bd:	8d 50 64             	lea    0x64(%eax),%edx
+f01069c0:	52                   	push   %edx
+f01069c1:	ff 75 10             	push   0x10(%ebp)
+f01069c4:	ff 75 0c             	push   0xc(%ebp)
+f01069c7:	53                   	push   %ebx
+f01069c8:	ff 70 60             	push   0x60(%eax)
+f01069cb:	e8 a8 bc ff ff       	call   f0102678 <page_insert>
+f01069d0:	83 c4 20             	add    $0x20,%esp
+f01069d3:	85 c0                	test   %eax,%eax
+f01069d5:	79 a3                	jns    f010697a <sys_page_alloc+0xc9>
+		page_free(p);   // free the page we allocated, since we can't use it
+f01069d7:	83 ec 0c             	sub    $0xc,%esp
+f01069da:	53                   	push   %ebx
+f01069db:	e8 56 ae ff ff       	call   f0101836 <page_free>
+		return -E_NO_MEM;
+f01069e0:	83 c4 10             	add    $0x10,%esp
+f01069e3:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+f01069ea:	eb 8e                	jmp    f010697a <sys_page_alloc+0xc9>
+		return -E_BAD_ENV;
+f01069ec:	c7 45 d4 fe ff ff ff 	movl   $0xfffffffe,-0x2c(%ebp)
+f01069f3:	eb 85                	jmp    f010697a <sys_page_alloc+0xc9>
+		return -E_INVAL;
+f01069f5:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+f01069fc:	e9 79 ff ff ff       	jmp    f010697a <sys_page_alloc+0xc9>
+f0106a01:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+f0106a08:	e9 6d ff ff ff       	jmp    f010697a <sys_page_alloc+0xc9>
+		return -E_INVAL;
+f0106a0d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+f0106a14:	e9 61 ff ff ff       	jmp    f010697a <sys_page_alloc+0xc9>
+		return -E_NO_MEM;
+f0106a19:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+f0106a20:	e9 55 ff ff ff       	jmp    f010697a <sys_page_alloc+0xc9>
+		return -E_NO_MEM;
+f0106a25:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+f0106a2c:	e9 49 ff ff ff       	jmp    f010697a <sys_page_alloc+0xc9>
+			return -E_INVAL;
+f0106a31:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+f0106a38:	e9 3d ff ff ff       	jmp    f010697a <sys_page_alloc+0xc9>
+			return -E_NO_MEM;
+f0106a3d:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+f0106a44:	e9 31 ff ff ff       	jmp    f010697a <sys_page_alloc+0xc9>
+f0106a49:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+f0106a50:	e9 25 ff ff ff       	jmp    f010697a <sys_page_alloc+0xc9>
+		return -E_NO_MEM;
+f0106a55:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+f0106a5c:	e9 19 ff ff ff       	jmp    f010697a <sys_page_alloc+0xc9>
+
+f0106a61 <sys_cputs>:
+{
+f0106a61:	55                   	push   %ebp
+f0106a62:	89 e5                	mov    %esp,%ebp
+f0106a64:	56                   	push   %esi
+f0106a65:	53                   	push   %ebx
+f0106a66:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106a69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	user_mem_assert(curenv, (void *)s, len, PTE_U);
+f0106a6c:	e8 d2 13 00 00       	call   f0107e43 <cpunum>
+f0106a71:	6a 04                	push   $0x4
+f0106a73:	53                   	push   %ebx
+f0106a74:	56                   	push   %esi
+f0106a75:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106a78:	ff b0 28 b0 85 f0    	push   -0xf7a4fd8(%eax)
+f0106a7e:	e8 15 c9 ff ff       	call   f0103398 <user_mem_assert>
+	cprintf("%.*s", len, s);
+f0106a83:	83 c4 0c             	add    $0xc,%esp
+f0106a86:	56                   	push   %esi
+f0106a87:	53                   	push   %ebx
+f0106a88:	68 4e 9e 10 f0       	push   $0xf0109e4e
+f0106a8d:	e8 58 da ff ff       	call   f01044ea <cprintf>
+}
+f0106a92:	83 c4 10             	add    $0x10,%esp
+f0106a95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0106a98:	5b                   	pop    %ebx
+f0106a99:	5e                   	pop    %esi
+f0106a9a:	5d                   	pop    %ebp
+f0106a9b:	c3                   	ret
+
+f0106a9c <sys_env_destroy>:
+{
+f0106a9c:	55                   	push   %ebp
+f0106a9d:	89 e5                	mov    %esp,%ebp
+f0106a9f:	53                   	push   %ebx
+f0106aa0:	83 ec 18             	sub    $0x18,%esp
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f0106aa3:	6a 01                	push   $0x1
+f0106aa5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0106aa8:	50                   	push   %eax
+f0106aa9:	ff 75 08             	push   0x8(%ebp)
+f0106aac:	e8 1a ca ff ff       	call   f01034cb <envid2env>
+f0106ab1:	83 c4 10             	add    $0x10,%esp
+f0106ab4:	85 c0                	test   %eax,%eax
+f0106ab6:	78 3a                	js     f0106af2 <sys_env_destroy+0x56>
+	if (e == curenv && curenv->env_type == ENV_TYPE_USER)
+f0106ab8:	e8 86 13 00 00       	call   f0107e43 <cpunum>
+f0106abd:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106ac0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+f0106ac3:	39 90 28 b0 85 f0    	cmp    %edx,-0xf7a4fd8(%eax)
+f0106ac9:	74 2c                	je     f0106af7 <sys_env_destroy+0x5b>
+	else if (curenv->env_type == ENV_TYPE_USER)
+f0106acb:	e8 73 13 00 00       	call   f0107e43 <cpunum>
+f0106ad0:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106ad3:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0106ad9:	83 78 50 00          	cmpl   $0x0,0x50(%eax)
+f0106add:	74 4f                	je     f0106b2e <sys_env_destroy+0x92>
+	env_destroy(e);
+f0106adf:	83 ec 0c             	sub    $0xc,%esp
+f0106ae2:	ff 75 f4             	push   -0xc(%ebp)
+f0106ae5:	e8 57 d6 ff ff       	call   f0104141 <env_destroy>
+	return 0;
+f0106aea:	83 c4 10             	add    $0x10,%esp
+f0106aed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0106af2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0106af5:	c9                   	leave
+f0106af6:	c3                   	ret
+	if (e == curenv && curenv->env_type == ENV_TYPE_USER)
+f0106af7:	e8 47 13 00 00       	call   f0107e43 <cpunum>
+f0106afc:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106aff:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0106b05:	83 78 50 00          	cmpl   $0x0,0x50(%eax)
+f0106b09:	75 c0                	jne    f0106acb <sys_env_destroy+0x2f>
+		cprintf("[%08x] exiting gracefully\n", curenv->env_id);
+f0106b0b:	e8 33 13 00 00       	call   f0107e43 <cpunum>
+f0106b10:	83 ec 08             	sub    $0x8,%esp
+f0106b13:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106b16:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0106b1c:	ff 70 48             	push   0x48(%eax)
+f0106b1f:	68 53 9e 10 f0       	push   $0xf0109e53
+f0106b24:	e8 c1 d9 ff ff       	call   f01044ea <cprintf>
+f0106b29:	83 c4 10             	add    $0x10,%esp
+f0106b2c:	eb b1                	jmp    f0106adf <sys_env_destroy+0x43>
+		cprintf("[%08x] destroying %08x\n", curenv->env_id, e->env_id);
+f0106b2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0106b31:	8b 58 48             	mov    0x48(%eax),%ebx
+f0106b34:	e8 0a 13 00 00       	call   f0107e43 <cpunum>
+f0106b39:	83 ec 04             	sub    $0x4,%esp
+f0106b3c:	53                   	push   %ebx
+f0106b3d:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106b40:	8b 80 28 b0 85 f0    	mov    -0xf7a4fd8(%eax),%eax
+f0106b46:	ff 70 48             	push   0x48(%eax)
+f0106b49:	68 6e 9e 10 f0       	push   $0xf0109e6e
+f0106b4e:	e8 97 d9 ff ff       	call   f01044ea <cprintf>
+f0106b53:	83 c4 10             	add    $0x10,%esp
+f0106b56:	eb 87                	jmp    f0106adf <sys_env_destroy+0x43>
+
+f0106b58 <sys_cgetc>:
+{
+f0106b58:	55                   	push   %ebp
+f0106b59:	89 e5                	mov    %esp,%ebp
+f0106b5b:	83 ec 08             	sub    $0x8,%esp
+	return cons_getc();
+f0106b5e:	e8 f4 9a ff ff       	call   f0100657 <cons_getc>
+}
+f0106b63:	c9                   	leave
+f0106b64:	c3                   	ret
+
+f0106b65 <syscall>:
+
+// Dispatches to the correct kernel function, passing the arguments.
+int32_t
+syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+f0106b65:	55                   	push   %ebp
+f0106b66:	89 e5                	mov    %esp,%ebp
+f0106b68:	8b 45 08             	mov    0x8(%ebp),%eax
+	};
+	uint32_t ret = 0, esp = 0, ebp = 0;
+
+	// return -E_INVAL if the system call number is invalid
+	// i.e., if it is not the case that 0 <= syscallno < NSYSCALLS
+	if (!(0 <= syscallno && syscallno < NSYSCALLS)) {
+f0106b6b:	83 f8 1b             	cmp    $0x1b,%eax
+f0106b6e:	77 27                	ja     f0106b97 <syscall+0x32>
+	//     so it doesn't matter that we pushed all five of the arguments a1-a5 despite the fact that the system call probably takes less than five arguments.
+	//     If the system call has a return value, it will store it in %eax. Store the value of %eax in the variable ret.
+	//  4. Pop all of the arguments off of the stack, until...
+	//  5. We pop off the base pointer that we pushed in 1. (identifiable by esp == ebp).
+	//  6. At this point, the state of the stack is exactly the same as before we started executing our asm code. So we return, with a value of ret.
+	asm volatile("push %esp");
+f0106b70:	54                   	push   %esp
+	asm volatile("pushl %0" :               : "r" (a5));
+f0106b71:	8b 55 1c             	mov    0x1c(%ebp),%edx
+f0106b74:	52                   	push   %edx
+	asm volatile("pushl %0" :               : "r" (a4));
+f0106b75:	8b 55 18             	mov    0x18(%ebp),%edx
+f0106b78:	52                   	push   %edx
+	asm volatile("pushl %0" :               : "r" (a3));
+f0106b79:	8b 55 14             	mov    0x14(%ebp),%edx
+f0106b7c:	52                   	push   %edx
+	asm volatile("pushl %0" :               : "r" (a2));
+f0106b7d:	8b 55 10             	mov    0x10(%ebp),%edx
+f0106b80:	52                   	push   %edx
+	asm volatile("pushl %0" :               : "r" (a1));
+f0106b81:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0106b84:	52                   	push   %edx
+	asm volatile("call *%0" : "=a" (ret)    : "r" (syscalls[syscallno]));
+f0106b85:	8b 04 85 a0 9e 10 f0 	mov    -0xfef6160(,%eax,4),%eax
+f0106b8c:	ff d0                	call   *%eax
+	do {
+		asm volatile("pop %0" : "=r" (ebp));
+f0106b8e:	59                   	pop    %ecx
+		asm volatile("mov %%esp,%0" : "=r" (esp));
+f0106b8f:	89 e2                	mov    %esp,%edx
+	} while (esp != ebp);
+f0106b91:	39 d1                	cmp    %edx,%ecx
+f0106b93:	75 f9                	jne    f0106b8e <syscall+0x29>
+	return ret;
+}
+f0106b95:	5d                   	pop    %ebp
+f0106b96:	c3                   	ret
+		return -E_INVAL;
+f0106b97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106b9c:	eb f7                	jmp    f0106b95 <syscall+0x30>
+
+f0106b9e <stab_binsearch>:
+//	will exit setting left = 118, right = 554.
+//
+static void
+stab_binsearch(const struct Stab *stabs, int *region_left, int *region_right,
+	       int type, uintptr_t addr)
+{
+f0106b9e:	55                   	push   %ebp
+f0106b9f:	89 e5                	mov    %esp,%ebp
+f0106ba1:	57                   	push   %edi
+f0106ba2:	56                   	push   %esi
+f0106ba3:	53                   	push   %ebx
+f0106ba4:	83 ec 14             	sub    $0x14,%esp
+f0106ba7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+f0106baa:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0106bad:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	int l = *region_left, r = *region_right, any_matches = 0;
+f0106bb0:	8b 1a                	mov    (%edx),%ebx
+f0106bb2:	8b 09                	mov    (%ecx),%ecx
+f0106bb4:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+
+	while (l <= r) {
+f0106bbb:	eb 4f                	jmp    f0106c0c <stab_binsearch+0x6e>
+		int true_m = (l + r) / 2, m = true_m;
+
+		// search for earliest stab with right type
+		while (m >= l && stabs[m].n_type != type)
+			m--;
+f0106bbd:	83 e8 01             	sub    $0x1,%eax
+		while (m >= l && stabs[m].n_type != type)
+f0106bc0:	39 c3                	cmp    %eax,%ebx
+f0106bc2:	0f 8f cc 00 00 00    	jg     f0106c94 <stab_binsearch+0xf6>
+f0106bc8:	0f b6 0a             	movzbl (%edx),%ecx
+f0106bcb:	83 ea 0c             	sub    $0xc,%edx
+f0106bce:	39 f1                	cmp    %esi,%ecx
+f0106bd0:	75 eb                	jne    f0106bbd <stab_binsearch+0x1f>
+f0106bd2:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f0106bd5:	89 75 08             	mov    %esi,0x8(%ebp)
+			continue;
+		}
+
+		// actual binary search
+		any_matches = 1;
+		if (stabs[m].n_value < addr) {
+f0106bd8:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0106bdb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+f0106bde:	8b 54 96 08          	mov    0x8(%esi,%edx,4),%edx
+f0106be2:	3b 55 0c             	cmp    0xc(%ebp),%edx
+f0106be5:	72 16                	jb     f0106bfd <stab_binsearch+0x5f>
+			*region_left = m;
+			l = true_m + 1;
+		} else if (stabs[m].n_value > addr) {
+f0106be7:	39 55 0c             	cmp    %edx,0xc(%ebp)
+f0106bea:	73 48                	jae    f0106c34 <stab_binsearch+0x96>
+			*region_right = m - 1;
+f0106bec:	8d 48 ff             	lea    -0x1(%eax),%ecx
+f0106bef:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0106bf2:	89 08                	mov    %ecx,(%eax)
+		any_matches = 1;
+f0106bf4:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0106bfb:	eb 0f                	jmp    f0106c0c <stab_binsearch+0x6e>
+			*region_left = m;
+f0106bfd:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0106c00:	89 06                	mov    %eax,(%esi)
+			l = true_m + 1;
+f0106c02:	8d 5f 01             	lea    0x1(%edi),%ebx
+		any_matches = 1;
+f0106c05:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+	while (l <= r) {
+f0106c0c:	39 cb                	cmp    %ecx,%ebx
+f0106c0e:	7f 38                	jg     f0106c48 <stab_binsearch+0xaa>
+		int true_m = (l + r) / 2, m = true_m;
+f0106c10:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+f0106c13:	89 c2                	mov    %eax,%edx
+f0106c15:	c1 ea 1f             	shr    $0x1f,%edx
+f0106c18:	01 d0                	add    %edx,%eax
+f0106c1a:	89 c7                	mov    %eax,%edi
+f0106c1c:	d1 ff                	sar    %edi
+		while (m >= l && stabs[m].n_type != type)
+f0106c1e:	83 e0 fe             	and    $0xfffffffe,%eax
+f0106c21:	01 f8                	add    %edi,%eax
+f0106c23:	8b 55 f0             	mov    -0x10(%ebp),%edx
+f0106c26:	8d 54 82 04          	lea    0x4(%edx,%eax,4),%edx
+		int true_m = (l + r) / 2, m = true_m;
+f0106c2a:	89 f8                	mov    %edi,%eax
+f0106c2c:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+f0106c2f:	8b 75 08             	mov    0x8(%ebp),%esi
+		while (m >= l && stabs[m].n_type != type)
+f0106c32:	eb 8c                	jmp    f0106bc0 <stab_binsearch+0x22>
+			r = m - 1;
+		} else {
+			// exact match for 'addr', but continue loop to find
+			// *region_right
+			*region_left = m;
+f0106c34:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0106c37:	89 07                	mov    %eax,(%edi)
+			l = m;
+			addr++;
+f0106c39:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+f0106c3d:	89 c3                	mov    %eax,%ebx
+		any_matches = 1;
+f0106c3f:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0106c46:	eb c4                	jmp    f0106c0c <stab_binsearch+0x6e>
+		}
+	}
+
+	if (!any_matches)
+f0106c48:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106c4b:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+f0106c4f:	75 15                	jne    f0106c66 <stab_binsearch+0xc8>
+		*region_right = *region_left - 1;
+f0106c51:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106c54:	8b 00                	mov    (%eax),%eax
+f0106c56:	83 e8 01             	sub    $0x1,%eax
+f0106c59:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0106c5c:	89 07                	mov    %eax,(%edi)
+		     l > *region_left && stabs[l].n_type != type;
+		     l--)
+			/* do nothing */;
+		*region_left = l;
+	}
+}
+f0106c5e:	83 c4 14             	add    $0x14,%esp
+f0106c61:	5b                   	pop    %ebx
+f0106c62:	5e                   	pop    %esi
+f0106c63:	5f                   	pop    %edi
+f0106c64:	5d                   	pop    %ebp
+f0106c65:	c3                   	ret
+		for (l = *region_right;
+f0106c66:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0106c69:	8b 00                	mov    (%eax),%eax
+		     l > *region_left && stabs[l].n_type != type;
+f0106c6b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0106c6e:	8b 0f                	mov    (%edi),%ecx
+f0106c70:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0106c73:	8b 7d f0             	mov    -0x10(%ebp),%edi
+f0106c76:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f0106c7a:	39 c1                	cmp    %eax,%ecx
+f0106c7c:	7d 0f                	jge    f0106c8d <stab_binsearch+0xef>
+f0106c7e:	0f b6 1a             	movzbl (%edx),%ebx
+f0106c81:	83 ea 0c             	sub    $0xc,%edx
+f0106c84:	39 f3                	cmp    %esi,%ebx
+f0106c86:	74 05                	je     f0106c8d <stab_binsearch+0xef>
+		     l--)
+f0106c88:	83 e8 01             	sub    $0x1,%eax
+f0106c8b:	eb ed                	jmp    f0106c7a <stab_binsearch+0xdc>
+		*region_left = l;
+f0106c8d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0106c90:	89 07                	mov    %eax,(%edi)
+}
+f0106c92:	eb ca                	jmp    f0106c5e <stab_binsearch+0xc0>
+			l = true_m + 1;
+f0106c94:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f0106c97:	89 75 08             	mov    %esi,0x8(%ebp)
+f0106c9a:	8d 5f 01             	lea    0x1(%edi),%ebx
+			continue;
+f0106c9d:	e9 6a ff ff ff       	jmp    f0106c0c <stab_binsearch+0x6e>
+
+f0106ca2 <debuginfo_eip>:
+//	negative if not.  But even if it returns negative it has stored some
+//	information into '*info'.
+//
+int
+debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
+{
+f0106ca2:	55                   	push   %ebp
+f0106ca3:	89 e5                	mov    %esp,%ebp
+f0106ca5:	57                   	push   %edi
+f0106ca6:	56                   	push   %esi
+f0106ca7:	53                   	push   %ebx
+f0106ca8:	83 ec 3c             	sub    $0x3c,%esp
+	const struct Stab *stabs, *stab_end;
+	const char *stabstr, *stabstr_end;
+	int lfile, rfile, lfun, rfun, lline, rline;
+
+	// Initialize *info
+	info->eip_file = "<unknown>";
+f0106cab:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106cae:	c7 00 10 9f 10 f0    	movl   $0xf0109f10,(%eax)
+	info->eip_line = 0;
+f0106cb4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	info->eip_fn_name = "<unknown>";
+f0106cbb:	c7 40 08 10 9f 10 f0 	movl   $0xf0109f10,0x8(%eax)
+	info->eip_fn_namelen = 9;
+f0106cc2:	c7 40 0c 09 00 00 00 	movl   $0x9,0xc(%eax)
+	info->eip_fn_addr = addr;
+f0106cc9:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0106ccc:	89 78 10             	mov    %edi,0x10(%eax)
+	info->eip_fn_narg = 0;
+f0106ccf:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+
+	// Find the relevant set of stabs
+	if (addr >= ULIM) {
+f0106cd6:	81 ff ff ff 7f ef    	cmp    $0xef7fffff,%edi
+f0106cdc:	0f 86 3c 01 00 00    	jbe    f0106e1e <debuginfo_eip+0x17c>
+		stabs = __STAB_BEGIN__;
+		stab_end = __STAB_END__;
+		stabstr = __STABSTR_BEGIN__;
+		stabstr_end = __STABSTR_END__;
+f0106ce2:	c7 45 c0 37 a5 10 f0 	movl   $0xf010a537,-0x40(%ebp)
+		stabstr = __STABSTR_BEGIN__;
+f0106ce9:	c7 45 bc 37 a5 10 f0 	movl   $0xf010a537,-0x44(%ebp)
+		stab_end = __STAB_END__;
+f0106cf0:	be 36 a5 10 f0       	mov    $0xf010a536,%esi
+		stabs = __STAB_BEGIN__;
+f0106cf5:	c7 45 c4 36 a5 10 f0 	movl   $0xf010a536,-0x3c(%ebp)
+			return -1;
+		}
+	}
+
+	// String table validity checks
+	if (stabstr_end <= stabstr || stabstr_end[-1] != 0)
+f0106cfc:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+f0106cff:	39 4d bc             	cmp    %ecx,-0x44(%ebp)
+f0106d02:	0f 83 53 02 00 00    	jae    f0106f5b <debuginfo_eip+0x2b9>
+f0106d08:	80 79 ff 00          	cmpb   $0x0,-0x1(%ecx)
+f0106d0c:	0f 85 50 02 00 00    	jne    f0106f62 <debuginfo_eip+0x2c0>
+	// 'eip'.  First, we find the basic source file containing 'eip'.
+	// Then, we look in that source file for the function.  Then we look
+	// for the line number.
+
+	// Search the entire set of stabs for the source file (type N_SO).
+	lfile = 0;
+f0106d12:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	rfile = (stab_end - stabs) - 1;
+f0106d19:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+f0106d1c:	29 fe                	sub    %edi,%esi
+f0106d1e:	c1 fe 02             	sar    $0x2,%esi
+f0106d21:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+f0106d27:	83 e8 01             	sub    $0x1,%eax
+f0106d2a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	stab_binsearch(stabs, &lfile, &rfile, N_SO, addr);
+f0106d2d:	83 ec 08             	sub    $0x8,%esp
+f0106d30:	ff 75 08             	push   0x8(%ebp)
+f0106d33:	6a 64                	push   $0x64
+f0106d35:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0106d38:	89 c1                	mov    %eax,%ecx
+f0106d3a:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0106d3d:	89 f8                	mov    %edi,%eax
+f0106d3f:	e8 5a fe ff ff       	call   f0106b9e <stab_binsearch>
+	if (lfile == 0)
+f0106d44:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0106d47:	83 c4 10             	add    $0x10,%esp
+f0106d4a:	85 f6                	test   %esi,%esi
+f0106d4c:	0f 84 17 02 00 00    	je     f0106f69 <debuginfo_eip+0x2c7>
+		return -1;
+
+	// Search within that file's stabs for the function definition
+	// (N_FUN).
+	lfun = lfile;
+f0106d52:	89 75 dc             	mov    %esi,-0x24(%ebp)
+	rfun = rfile;
+f0106d55:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0106d58:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+	stab_binsearch(stabs, &lfun, &rfun, N_FUN, addr);
+f0106d5b:	83 ec 08             	sub    $0x8,%esp
+f0106d5e:	ff 75 08             	push   0x8(%ebp)
+f0106d61:	6a 24                	push   $0x24
+f0106d63:	8d 45 d8             	lea    -0x28(%ebp),%eax
+f0106d66:	89 c1                	mov    %eax,%ecx
+f0106d68:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f0106d6b:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+f0106d6e:	89 f8                	mov    %edi,%eax
+f0106d70:	e8 29 fe ff ff       	call   f0106b9e <stab_binsearch>
+
+	if (lfun <= rfun) {
+f0106d75:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0106d78:	89 55 b8             	mov    %edx,-0x48(%ebp)
+f0106d7b:	8b 7d d8             	mov    -0x28(%ebp),%edi
+f0106d7e:	83 c4 10             	add    $0x10,%esp
+f0106d81:	39 fa                	cmp    %edi,%edx
+f0106d83:	0f 8f 3f 01 00 00    	jg     f0106ec8 <debuginfo_eip+0x226>
+		// stabs[lfun] points to the function name
+		// in the string table, but check bounds just in case.
+		if (stabs[lfun].n_strx < stabstr_end - stabstr)
+f0106d89:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f0106d8c:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+f0106d8f:	8d 14 83             	lea    (%ebx,%eax,4),%edx
+f0106d92:	8b 02                	mov    (%edx),%eax
+f0106d94:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+f0106d97:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+f0106d9a:	29 d9                	sub    %ebx,%ecx
+f0106d9c:	39 c8                	cmp    %ecx,%eax
+f0106d9e:	73 08                	jae    f0106da8 <debuginfo_eip+0x106>
+			info->eip_fn_name = stabstr + stabs[lfun].n_strx;
+f0106da0:	01 d8                	add    %ebx,%eax
+f0106da2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0106da5:	89 43 08             	mov    %eax,0x8(%ebx)
+		info->eip_fn_addr = stabs[lfun].n_value;
+f0106da8:	8b 42 08             	mov    0x8(%edx),%eax
+		addr -= info->eip_fn_addr;
+f0106dab:	29 45 08             	sub    %eax,0x8(%ebp)
+		// Search within the function definition for the line number.
+		lline = lfun;
+		rline = rfun;
+f0106dae:	8b 55 b8             	mov    -0x48(%ebp),%edx
+f0106db1:	89 fb                	mov    %edi,%ebx
+		info->eip_fn_addr = stabs[lfun].n_value;
+f0106db3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0106db6:	89 41 10             	mov    %eax,0x10(%ecx)
+		lline = lfun;
+f0106db9:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+		rline = rfun;
+f0106dbc:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+		info->eip_fn_addr = addr;
+		lline = lfile;
+		rline = rfile;
+	}
+	// Ignore stuff after the colon.
+	info->eip_fn_namelen = strfind(info->eip_fn_name, ':') - info->eip_fn_name;
+f0106dbf:	83 ec 08             	sub    $0x8,%esp
+f0106dc2:	6a 3a                	push   $0x3a
+f0106dc4:	ff 71 08             	push   0x8(%ecx)
+f0106dc7:	e8 a7 09 00 00       	call   f0107773 <strfind>
+f0106dcc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0106dcf:	2b 43 08             	sub    0x8(%ebx),%eax
+f0106dd2:	89 43 0c             	mov    %eax,0xc(%ebx)
+	// Hint:
+	//	There's a particular stabs type used for line numbers.
+	//	Look at the STABS documentation and <inc/stab.h> to find
+	//	which one.
+	// Your code here.
+	stab_binsearch(stabs, &lline, &rline, N_SLINE, addr);   // The stab we are looking for is a text segment line number type.
+f0106dd5:	83 c4 08             	add    $0x8,%esp
+f0106dd8:	ff 75 08             	push   0x8(%ebp)
+f0106ddb:	6a 44                	push   $0x44
+f0106ddd:	8d 4d d0             	lea    -0x30(%ebp),%ecx
+f0106de0:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+f0106de3:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+f0106de6:	89 d8                	mov    %ebx,%eax
+f0106de8:	e8 b1 fd ff ff       	call   f0106b9e <stab_binsearch>
+	if (lline <= rline) {
+f0106ded:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0106df0:	8b 55 d0             	mov    -0x30(%ebp),%edx
+f0106df3:	83 c4 10             	add    $0x10,%esp
+		info->eip_line = stabs[rline].n_desc;               // The line number is located in the n_desc data in the N_SLINE Stab struct.
+	}
+	else {
+		info->eip_line = -1;
+f0106df6:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+	if (lline <= rline) {
+f0106dfb:	39 d0                	cmp    %edx,%eax
+f0106dfd:	7f 08                	jg     f0106e07 <debuginfo_eip+0x165>
+		info->eip_line = stabs[rline].n_desc;               // The line number is located in the n_desc data in the N_SLINE Stab struct.
+f0106dff:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f0106e02:	0f b7 4c 93 06       	movzwl 0x6(%ebx,%edx,4),%ecx
+f0106e07:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0106e0a:	89 4b 04             	mov    %ecx,0x4(%ebx)
+f0106e0d:	89 c2                	mov    %eax,%edx
+f0106e0f:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0106e12:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+f0106e15:	8d 44 83 04          	lea    0x4(%ebx,%eax,4),%eax
+f0106e19:	e9 ba 00 00 00       	jmp    f0106ed8 <debuginfo_eip+0x236>
+		if (user_mem_check(curenv, (void *)usd, sizeof(struct UserStabData), PTE_U)) {
+f0106e1e:	e8 20 10 00 00       	call   f0107e43 <cpunum>
+f0106e23:	6a 04                	push   $0x4
+f0106e25:	6a 10                	push   $0x10
+f0106e27:	68 00 00 20 00       	push   $0x200000
+f0106e2c:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106e2f:	ff b0 28 b0 85 f0    	push   -0xf7a4fd8(%eax)
+f0106e35:	e8 b1 c4 ff ff       	call   f01032eb <user_mem_check>
+f0106e3a:	83 c4 10             	add    $0x10,%esp
+f0106e3d:	85 c0                	test   %eax,%eax
+f0106e3f:	0f 85 08 01 00 00    	jne    f0106f4d <debuginfo_eip+0x2ab>
+		stabs = usd->stabs;
+f0106e45:	8b 3d 00 00 20 00    	mov    0x200000,%edi
+f0106e4b:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+		stab_end = usd->stab_end;
+f0106e4e:	8b 35 04 00 20 00    	mov    0x200004,%esi
+		stabstr = usd->stabstr;
+f0106e54:	8b 1d 08 00 20 00    	mov    0x200008,%ebx
+f0106e5a:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+		stabstr_end = usd->stabstr_end;
+f0106e5d:	8b 15 0c 00 20 00    	mov    0x20000c,%edx
+f0106e63:	89 55 c0             	mov    %edx,-0x40(%ebp)
+		if (user_mem_check(curenv, (void *)stabs, stab_end-stabs, PTE_U) || user_mem_check(curenv, (void *)stabstr, stabstr_end-stabstr, PTE_U)) {
+f0106e66:	e8 d8 0f 00 00       	call   f0107e43 <cpunum>
+f0106e6b:	89 c2                	mov    %eax,%edx
+f0106e6d:	6a 04                	push   $0x4
+f0106e6f:	89 f0                	mov    %esi,%eax
+f0106e71:	29 f8                	sub    %edi,%eax
+f0106e73:	c1 f8 02             	sar    $0x2,%eax
+f0106e76:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0106e7c:	50                   	push   %eax
+f0106e7d:	57                   	push   %edi
+f0106e7e:	6b d2 74             	imul   $0x74,%edx,%edx
+f0106e81:	ff b2 28 b0 85 f0    	push   -0xf7a4fd8(%edx)
+f0106e87:	e8 5f c4 ff ff       	call   f01032eb <user_mem_check>
+f0106e8c:	83 c4 10             	add    $0x10,%esp
+f0106e8f:	85 c0                	test   %eax,%eax
+f0106e91:	0f 85 bd 00 00 00    	jne    f0106f54 <debuginfo_eip+0x2b2>
+f0106e97:	e8 a7 0f 00 00       	call   f0107e43 <cpunum>
+f0106e9c:	6a 04                	push   $0x4
+f0106e9e:	8b 55 c0             	mov    -0x40(%ebp),%edx
+f0106ea1:	29 da                	sub    %ebx,%edx
+f0106ea3:	52                   	push   %edx
+f0106ea4:	53                   	push   %ebx
+f0106ea5:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106ea8:	ff b0 28 b0 85 f0    	push   -0xf7a4fd8(%eax)
+f0106eae:	e8 38 c4 ff ff       	call   f01032eb <user_mem_check>
+f0106eb3:	83 c4 10             	add    $0x10,%esp
+f0106eb6:	85 c0                	test   %eax,%eax
+f0106eb8:	0f 84 3e fe ff ff    	je     f0106cfc <debuginfo_eip+0x5a>
+			return -1;
+f0106ebe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106ec3:	e9 ad 00 00 00       	jmp    f0106f75 <debuginfo_eip+0x2d3>
+f0106ec8:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106ecb:	89 f2                	mov    %esi,%edx
+f0106ecd:	e9 e1 fe ff ff       	jmp    f0106db3 <debuginfo_eip+0x111>
+	// can interpolate code from a different file!
+	// Such included source files use the N_SOL stab type.
+	while (lline >= lfile
+	       && stabs[lline].n_type != N_SOL
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+		lline--;
+f0106ed2:	83 ea 01             	sub    $0x1,%edx
+f0106ed5:	83 e8 0c             	sub    $0xc,%eax
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f0106ed8:	39 d6                	cmp    %edx,%esi
+f0106eda:	7f 34                	jg     f0106f10 <debuginfo_eip+0x26e>
+	       && stabs[lline].n_type != N_SOL
+f0106edc:	0f b6 08             	movzbl (%eax),%ecx
+f0106edf:	80 f9 84             	cmp    $0x84,%cl
+f0106ee2:	74 0b                	je     f0106eef <debuginfo_eip+0x24d>
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f0106ee4:	80 f9 64             	cmp    $0x64,%cl
+f0106ee7:	75 e9                	jne    f0106ed2 <debuginfo_eip+0x230>
+f0106ee9:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f0106eed:	74 e3                	je     f0106ed2 <debuginfo_eip+0x230>
+	if (lline >= lfile && stabs[lline].n_strx < stabstr_end - stabstr)
+f0106eef:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f0106ef2:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+f0106ef5:	8b 14 86             	mov    (%esi,%eax,4),%edx
+f0106ef8:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0106efb:	8b 75 bc             	mov    -0x44(%ebp),%esi
+f0106efe:	29 f0                	sub    %esi,%eax
+f0106f00:	39 c2                	cmp    %eax,%edx
+f0106f02:	73 0c                	jae    f0106f10 <debuginfo_eip+0x26e>
+		info->eip_file = stabstr + stabs[lline].n_strx;
+f0106f04:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f0106f07:	01 d0                	add    %edx,%eax
+f0106f09:	89 c2                	mov    %eax,%edx
+f0106f0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106f0e:	89 10                	mov    %edx,(%eax)
+		for (lline = lfun + 1;
+		     lline < rfun && stabs[lline].n_type == N_PSYM;
+		     lline++)
+			info->eip_fn_narg++;
+
+	return 0;
+f0106f10:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lfun < rfun)
+f0106f15:	8b 75 b8             	mov    -0x48(%ebp),%esi
+f0106f18:	39 fe                	cmp    %edi,%esi
+f0106f1a:	7d 59                	jge    f0106f75 <debuginfo_eip+0x2d3>
+		for (lline = lfun + 1;
+f0106f1c:	89 f0                	mov    %esi,%eax
+f0106f1e:	83 c0 01             	add    $0x1,%eax
+f0106f21:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0106f24:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+f0106f27:	8d 54 96 04          	lea    0x4(%esi,%edx,4),%edx
+f0106f2b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0106f2e:	eb 04                	jmp    f0106f34 <debuginfo_eip+0x292>
+			info->eip_fn_narg++;
+f0106f30:	83 43 14 01          	addl   $0x1,0x14(%ebx)
+		     lline < rfun && stabs[lline].n_type == N_PSYM;
+f0106f34:	39 c7                	cmp    %eax,%edi
+f0106f36:	7e 38                	jle    f0106f70 <debuginfo_eip+0x2ce>
+f0106f38:	0f b6 0a             	movzbl (%edx),%ecx
+f0106f3b:	83 c0 01             	add    $0x1,%eax
+f0106f3e:	83 c2 0c             	add    $0xc,%edx
+f0106f41:	80 f9 a0             	cmp    $0xa0,%cl
+f0106f44:	74 ea                	je     f0106f30 <debuginfo_eip+0x28e>
+	return 0;
+f0106f46:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106f4b:	eb 28                	jmp    f0106f75 <debuginfo_eip+0x2d3>
+			return -1;
+f0106f4d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106f52:	eb 21                	jmp    f0106f75 <debuginfo_eip+0x2d3>
+			return -1;
+f0106f54:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106f59:	eb 1a                	jmp    f0106f75 <debuginfo_eip+0x2d3>
+		return -1;
+f0106f5b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106f60:	eb 13                	jmp    f0106f75 <debuginfo_eip+0x2d3>
+f0106f62:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106f67:	eb 0c                	jmp    f0106f75 <debuginfo_eip+0x2d3>
+		return -1;
+f0106f69:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106f6e:	eb 05                	jmp    f0106f75 <debuginfo_eip+0x2d3>
+	return 0;
+f0106f70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0106f75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106f78:	5b                   	pop    %ebx
+f0106f79:	5e                   	pop    %esi
+f0106f7a:	5f                   	pop    %edi
+f0106f7b:	5d                   	pop    %ebp
+f0106f7c:	c3                   	ret
+
+f0106f7d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+f0106f7d:	55                   	push   %ebp
+f0106f7e:	89 e5                	mov    %esp,%ebp
+f0106f80:	57                   	push   %edi
+f0106f81:	56                   	push   %esi
+f0106f82:	53                   	push   %ebx
+f0106f83:	83 ec 1c             	sub    $0x1c,%esp
+f0106f86:	89 c7                	mov    %eax,%edi
+f0106f88:	89 d6                	mov    %edx,%esi
+f0106f8a:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106f8d:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0106f90:	89 d1                	mov    %edx,%ecx
+f0106f92:	89 c2                	mov    %eax,%edx
+f0106f94:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0106f97:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0106f9a:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106f9d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+f0106fa0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0106fa3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0106faa:	39 c2                	cmp    %eax,%edx
+f0106fac:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+f0106faf:	72 3e                	jb     f0106fef <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+f0106fb1:	83 ec 0c             	sub    $0xc,%esp
+f0106fb4:	ff 75 18             	push   0x18(%ebp)
+f0106fb7:	83 eb 01             	sub    $0x1,%ebx
+f0106fba:	53                   	push   %ebx
+f0106fbb:	50                   	push   %eax
+f0106fbc:	83 ec 08             	sub    $0x8,%esp
+f0106fbf:	ff 75 e4             	push   -0x1c(%ebp)
+f0106fc2:	ff 75 e0             	push   -0x20(%ebp)
+f0106fc5:	ff 75 dc             	push   -0x24(%ebp)
+f0106fc8:	ff 75 d8             	push   -0x28(%ebp)
+f0106fcb:	e8 b2 14 00 00       	call   f0108482 <__udivdi3>
+f0106fd0:	83 c4 18             	add    $0x18,%esp
+f0106fd3:	52                   	push   %edx
+f0106fd4:	50                   	push   %eax
+f0106fd5:	89 f2                	mov    %esi,%edx
+f0106fd7:	89 f8                	mov    %edi,%eax
+f0106fd9:	e8 9f ff ff ff       	call   f0106f7d <printnum>
+f0106fde:	83 c4 20             	add    $0x20,%esp
+f0106fe1:	eb 13                	jmp    f0106ff6 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+f0106fe3:	83 ec 08             	sub    $0x8,%esp
+f0106fe6:	56                   	push   %esi
+f0106fe7:	ff 75 18             	push   0x18(%ebp)
+f0106fea:	ff d7                	call   *%edi
+f0106fec:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+f0106fef:	83 eb 01             	sub    $0x1,%ebx
+f0106ff2:	85 db                	test   %ebx,%ebx
+f0106ff4:	7f ed                	jg     f0106fe3 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+f0106ff6:	83 ec 08             	sub    $0x8,%esp
+f0106ff9:	56                   	push   %esi
+f0106ffa:	83 ec 04             	sub    $0x4,%esp
+f0106ffd:	ff 75 e4             	push   -0x1c(%ebp)
+f0107000:	ff 75 e0             	push   -0x20(%ebp)
+f0107003:	ff 75 dc             	push   -0x24(%ebp)
+f0107006:	ff 75 d8             	push   -0x28(%ebp)
+f0107009:	e8 92 14 00 00       	call   f01084a0 <__umoddi3>
+f010700e:	83 c4 14             	add    $0x14,%esp
+f0107011:	0f be 80 1a 9f 10 f0 	movsbl -0xfef60e6(%eax),%eax
+f0107018:	50                   	push   %eax
+f0107019:	ff d7                	call   *%edi
+}
+f010701b:	83 c4 10             	add    $0x10,%esp
+f010701e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107021:	5b                   	pop    %ebx
+f0107022:	5e                   	pop    %esi
+f0107023:	5f                   	pop    %edi
+f0107024:	5d                   	pop    %ebp
+f0107025:	c3                   	ret
+
+f0107026 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+f0107026:	55                   	push   %ebp
+f0107027:	89 e5                	mov    %esp,%ebp
+f0107029:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+f010702c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+f0107030:	8b 10                	mov    (%eax),%edx
+f0107032:	3b 50 04             	cmp    0x4(%eax),%edx
+f0107035:	73 0a                	jae    f0107041 <sprintputch+0x1b>
+		*b->buf++ = ch;
+f0107037:	8d 4a 01             	lea    0x1(%edx),%ecx
+f010703a:	89 08                	mov    %ecx,(%eax)
+f010703c:	8b 45 08             	mov    0x8(%ebp),%eax
+f010703f:	88 02                	mov    %al,(%edx)
+}
+f0107041:	5d                   	pop    %ebp
+f0107042:	c3                   	ret
+
+f0107043 <printfmt>:
+{
+f0107043:	55                   	push   %ebp
+f0107044:	89 e5                	mov    %esp,%ebp
+f0107046:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+f0107049:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+f010704c:	50                   	push   %eax
+f010704d:	ff 75 10             	push   0x10(%ebp)
+f0107050:	ff 75 0c             	push   0xc(%ebp)
+f0107053:	ff 75 08             	push   0x8(%ebp)
+f0107056:	e8 05 00 00 00       	call   f0107060 <vprintfmt>
+}
+f010705b:	83 c4 10             	add    $0x10,%esp
+f010705e:	c9                   	leave
+f010705f:	c3                   	ret
+
+f0107060 <vprintfmt>:
+{
+f0107060:	55                   	push   %ebp
+f0107061:	89 e5                	mov    %esp,%ebp
+f0107063:	57                   	push   %edi
+f0107064:	56                   	push   %esi
+f0107065:	53                   	push   %ebx
+f0107066:	83 ec 2c             	sub    $0x2c,%esp
+f0107069:	8b 75 08             	mov    0x8(%ebp),%esi
+f010706c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010706f:	8b 7d 10             	mov    0x10(%ebp),%edi
+f0107072:	eb 0a                	jmp    f010707e <vprintfmt+0x1e>
+			putch(ch, putdat);
+f0107074:	83 ec 08             	sub    $0x8,%esp
+f0107077:	53                   	push   %ebx
+f0107078:	50                   	push   %eax
+f0107079:	ff d6                	call   *%esi
+f010707b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+f010707e:	83 c7 01             	add    $0x1,%edi
+f0107081:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+f0107085:	83 f8 25             	cmp    $0x25,%eax
+f0107088:	74 0c                	je     f0107096 <vprintfmt+0x36>
+			if (ch == '\0')
+f010708a:	85 c0                	test   %eax,%eax
+f010708c:	75 e6                	jne    f0107074 <vprintfmt+0x14>
+}
+f010708e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107091:	5b                   	pop    %ebx
+f0107092:	5e                   	pop    %esi
+f0107093:	5f                   	pop    %edi
+f0107094:	5d                   	pop    %ebp
+f0107095:	c3                   	ret
+		padc = ' ';
+f0107096:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+f010709a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+f01070a1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+f01070a8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+f01070af:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+f01070b4:	8d 47 01             	lea    0x1(%edi),%eax
+f01070b7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f01070ba:	0f b6 17             	movzbl (%edi),%edx
+f01070bd:	8d 42 dd             	lea    -0x23(%edx),%eax
+f01070c0:	3c 55                	cmp    $0x55,%al
+f01070c2:	0f 87 c5 03 00 00    	ja     f010748d <vprintfmt+0x42d>
+f01070c8:	0f b6 c0             	movzbl %al,%eax
+f01070cb:	ff 24 85 a0 a0 10 f0 	jmp    *-0xfef5f60(,%eax,4)
+f01070d2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+f01070d5:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+f01070d9:	eb d9                	jmp    f01070b4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+f01070db:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f01070de:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+f01070e2:	eb d0                	jmp    f01070b4 <vprintfmt+0x54>
+f01070e4:	0f b6 d2             	movzbl %dl,%edx
+f01070e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+f01070ea:	b8 00 00 00 00       	mov    $0x0,%eax
+f01070ef:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+f01070f2:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f01070f5:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+f01070f9:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+f01070fc:	8d 4a d0             	lea    -0x30(%edx),%ecx
+f01070ff:	83 f9 09             	cmp    $0x9,%ecx
+f0107102:	77 55                	ja     f0107159 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+f0107104:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+f0107107:	eb e9                	jmp    f01070f2 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+f0107109:	8b 45 14             	mov    0x14(%ebp),%eax
+f010710c:	8b 00                	mov    (%eax),%eax
+f010710e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0107111:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107114:	8d 40 04             	lea    0x4(%eax),%eax
+f0107117:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f010711a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+f010711d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f0107121:	79 91                	jns    f01070b4 <vprintfmt+0x54>
+				width = precision, precision = -1;
+f0107123:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0107126:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0107129:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+f0107130:	eb 82                	jmp    f01070b4 <vprintfmt+0x54>
+			if (width < 0)
+f0107132:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0107135:	85 d2                	test   %edx,%edx
+f0107137:	b8 00 00 00 00       	mov    $0x0,%eax
+f010713c:	0f 49 c2             	cmovns %edx,%eax
+f010713f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f0107142:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+f0107145:	e9 6a ff ff ff       	jmp    f01070b4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+f010714a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+f010714d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+f0107154:	e9 5b ff ff ff       	jmp    f01070b4 <vprintfmt+0x54>
+f0107159:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f010715c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f010715f:	eb bc                	jmp    f010711d <vprintfmt+0xbd>
+			lflag++;
+f0107161:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+f0107164:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+f0107167:	e9 48 ff ff ff       	jmp    f01070b4 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+f010716c:	8b 45 14             	mov    0x14(%ebp),%eax
+f010716f:	8d 78 04             	lea    0x4(%eax),%edi
+f0107172:	83 ec 08             	sub    $0x8,%esp
+f0107175:	53                   	push   %ebx
+f0107176:	ff 30                	push   (%eax)
+f0107178:	ff d6                	call   *%esi
+			break;
+f010717a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+f010717d:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+f0107180:	e9 63 02 00 00       	jmp    f01073e8 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+f0107185:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107188:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+f010718b:	8b 10                	mov    (%eax),%edx
+f010718d:	89 d0                	mov    %edx,%eax
+f010718f:	f7 d8                	neg    %eax
+f0107191:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+f0107194:	83 f8 12             	cmp    $0x12,%eax
+f0107197:	7f 23                	jg     f01071bc <vprintfmt+0x15c>
+f0107199:	8b 14 85 00 a2 10 f0 	mov    -0xfef5e00(,%eax,4),%edx
+f01071a0:	85 d2                	test   %edx,%edx
+f01071a2:	74 18                	je     f01071bc <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+f01071a4:	52                   	push   %edx
+f01071a5:	68 b6 94 10 f0       	push   $0xf01094b6
+f01071aa:	53                   	push   %ebx
+f01071ab:	56                   	push   %esi
+f01071ac:	e8 92 fe ff ff       	call   f0107043 <printfmt>
+f01071b1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+f01071b4:	89 7d 14             	mov    %edi,0x14(%ebp)
+f01071b7:	e9 2c 02 00 00       	jmp    f01073e8 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+f01071bc:	50                   	push   %eax
+f01071bd:	68 32 9f 10 f0       	push   $0xf0109f32
+f01071c2:	53                   	push   %ebx
+f01071c3:	56                   	push   %esi
+f01071c4:	e8 7a fe ff ff       	call   f0107043 <printfmt>
+f01071c9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+f01071cc:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+f01071cf:	e9 14 02 00 00       	jmp    f01073e8 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+f01071d4:	8b 45 14             	mov    0x14(%ebp),%eax
+f01071d7:	83 c0 04             	add    $0x4,%eax
+f01071da:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f01071dd:	8b 45 14             	mov    0x14(%ebp),%eax
+f01071e0:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+f01071e2:	85 c9                	test   %ecx,%ecx
+f01071e4:	b8 2b 9f 10 f0       	mov    $0xf0109f2b,%eax
+f01071e9:	0f 45 c1             	cmovne %ecx,%eax
+f01071ec:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+f01071ef:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f01071f3:	7e 06                	jle    f01071fb <vprintfmt+0x19b>
+f01071f5:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+f01071f9:	75 0b                	jne    f0107206 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+f01071fb:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f01071fe:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0107201:	89 75 08             	mov    %esi,0x8(%ebp)
+f0107204:	eb 5c                	jmp    f0107262 <vprintfmt+0x202>
+f0107206:	83 ec 08             	sub    $0x8,%esp
+f0107209:	ff 75 d0             	push   -0x30(%ebp)
+f010720c:	ff 75 cc             	push   -0x34(%ebp)
+f010720f:	e8 07 04 00 00       	call   f010761b <strnlen>
+f0107214:	89 c2                	mov    %eax,%edx
+f0107216:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0107219:	29 d0                	sub    %edx,%eax
+f010721b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+f010721e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+f0107222:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0107225:	89 75 08             	mov    %esi,0x8(%ebp)
+f0107228:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+f010722a:	eb 0e                	jmp    f010723a <vprintfmt+0x1da>
+					putch(padc, putdat);
+f010722c:	83 ec 08             	sub    $0x8,%esp
+f010722f:	53                   	push   %ebx
+f0107230:	57                   	push   %edi
+f0107231:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+f0107234:	83 ee 01             	sub    $0x1,%esi
+f0107237:	83 c4 10             	add    $0x10,%esp
+f010723a:	85 f6                	test   %esi,%esi
+f010723c:	7f ee                	jg     f010722c <vprintfmt+0x1cc>
+f010723e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0107241:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107244:	85 c0                	test   %eax,%eax
+f0107246:	ba 00 00 00 00       	mov    $0x0,%edx
+f010724b:	0f 49 d0             	cmovns %eax,%edx
+f010724e:	29 d0                	sub    %edx,%eax
+f0107250:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0107253:	eb a6                	jmp    f01071fb <vprintfmt+0x19b>
+					putch(ch, putdat);
+f0107255:	83 ec 08             	sub    $0x8,%esp
+f0107258:	53                   	push   %ebx
+f0107259:	52                   	push   %edx
+f010725a:	ff 55 08             	call   *0x8(%ebp)
+f010725d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+f0107260:	89 f1                	mov    %esi,%ecx
+f0107262:	8d 71 01             	lea    0x1(%ecx),%esi
+f0107265:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+f0107269:	0f be d0             	movsbl %al,%edx
+f010726c:	85 d2                	test   %edx,%edx
+f010726e:	74 28                	je     f0107298 <vprintfmt+0x238>
+f0107270:	85 ff                	test   %edi,%edi
+f0107272:	78 05                	js     f0107279 <vprintfmt+0x219>
+f0107274:	83 ef 01             	sub    $0x1,%edi
+f0107277:	78 30                	js     f01072a9 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+f0107279:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+f010727d:	74 d6                	je     f0107255 <vprintfmt+0x1f5>
+f010727f:	0f be c0             	movsbl %al,%eax
+f0107282:	83 e8 20             	sub    $0x20,%eax
+f0107285:	83 f8 5e             	cmp    $0x5e,%eax
+f0107288:	76 cb                	jbe    f0107255 <vprintfmt+0x1f5>
+					putch('?', putdat);
+f010728a:	83 ec 08             	sub    $0x8,%esp
+f010728d:	53                   	push   %ebx
+f010728e:	6a 3f                	push   $0x3f
+f0107290:	ff 55 08             	call   *0x8(%ebp)
+f0107293:	83 c4 10             	add    $0x10,%esp
+f0107296:	eb c8                	jmp    f0107260 <vprintfmt+0x200>
+f0107298:	8b 75 08             	mov    0x8(%ebp),%esi
+f010729b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f010729e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f01072a1:	01 d0                	add    %edx,%eax
+f01072a3:	29 c8                	sub    %ecx,%eax
+f01072a5:	89 c7                	mov    %eax,%edi
+f01072a7:	eb 13                	jmp    f01072bc <vprintfmt+0x25c>
+f01072a9:	8b 75 08             	mov    0x8(%ebp),%esi
+f01072ac:	eb ed                	jmp    f010729b <vprintfmt+0x23b>
+				putch(' ', putdat);
+f01072ae:	83 ec 08             	sub    $0x8,%esp
+f01072b1:	53                   	push   %ebx
+f01072b2:	6a 20                	push   $0x20
+f01072b4:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+f01072b6:	83 ef 01             	sub    $0x1,%edi
+f01072b9:	83 c4 10             	add    $0x10,%esp
+f01072bc:	85 ff                	test   %edi,%edi
+f01072be:	7f ee                	jg     f01072ae <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+f01072c0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f01072c3:	89 45 14             	mov    %eax,0x14(%ebp)
+f01072c6:	e9 1d 01 00 00       	jmp    f01073e8 <vprintfmt+0x388>
+	if (lflag >= 2)
+f01072cb:	83 f9 01             	cmp    $0x1,%ecx
+f01072ce:	7f 1b                	jg     f01072eb <vprintfmt+0x28b>
+	else if (lflag)
+f01072d0:	85 c9                	test   %ecx,%ecx
+f01072d2:	74 63                	je     f0107337 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+f01072d4:	8b 45 14             	mov    0x14(%ebp),%eax
+f01072d7:	8b 00                	mov    (%eax),%eax
+f01072d9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f01072dc:	99                   	cltd
+f01072dd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f01072e0:	8b 45 14             	mov    0x14(%ebp),%eax
+f01072e3:	8d 40 04             	lea    0x4(%eax),%eax
+f01072e6:	89 45 14             	mov    %eax,0x14(%ebp)
+f01072e9:	eb 17                	jmp    f0107302 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+f01072eb:	8b 45 14             	mov    0x14(%ebp),%eax
+f01072ee:	8b 50 04             	mov    0x4(%eax),%edx
+f01072f1:	8b 00                	mov    (%eax),%eax
+f01072f3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f01072f6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f01072f9:	8b 45 14             	mov    0x14(%ebp),%eax
+f01072fc:	8d 40 08             	lea    0x8(%eax),%eax
+f01072ff:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+f0107302:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f0107305:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+f0107308:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+f010730d:	85 c9                	test   %ecx,%ecx
+f010730f:	0f 89 b9 00 00 00    	jns    f01073ce <vprintfmt+0x36e>
+				putch('-', putdat);
+f0107315:	83 ec 08             	sub    $0x8,%esp
+f0107318:	53                   	push   %ebx
+f0107319:	6a 2d                	push   $0x2d
+f010731b:	ff d6                	call   *%esi
+				num = -(long long) num;
+f010731d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f0107320:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0107323:	f7 da                	neg    %edx
+f0107325:	83 d1 00             	adc    $0x0,%ecx
+f0107328:	f7 d9                	neg    %ecx
+f010732a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+f010732d:	bf 0a 00 00 00       	mov    $0xa,%edi
+f0107332:	e9 97 00 00 00       	jmp    f01073ce <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+f0107337:	8b 45 14             	mov    0x14(%ebp),%eax
+f010733a:	8b 00                	mov    (%eax),%eax
+f010733c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f010733f:	99                   	cltd
+f0107340:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f0107343:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107346:	8d 40 04             	lea    0x4(%eax),%eax
+f0107349:	89 45 14             	mov    %eax,0x14(%ebp)
+f010734c:	eb b4                	jmp    f0107302 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+f010734e:	83 f9 01             	cmp    $0x1,%ecx
+f0107351:	7f 1b                	jg     f010736e <vprintfmt+0x30e>
+	else if (lflag)
+f0107353:	85 c9                	test   %ecx,%ecx
+f0107355:	74 2c                	je     f0107383 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+f0107357:	8b 45 14             	mov    0x14(%ebp),%eax
+f010735a:	8b 10                	mov    (%eax),%edx
+f010735c:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0107361:	8d 40 04             	lea    0x4(%eax),%eax
+f0107364:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f0107367:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+f010736c:	eb 60                	jmp    f01073ce <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+f010736e:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107371:	8b 10                	mov    (%eax),%edx
+f0107373:	8b 48 04             	mov    0x4(%eax),%ecx
+f0107376:	8d 40 08             	lea    0x8(%eax),%eax
+f0107379:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f010737c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+f0107381:	eb 4b                	jmp    f01073ce <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+f0107383:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107386:	8b 10                	mov    (%eax),%edx
+f0107388:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010738d:	8d 40 04             	lea    0x4(%eax),%eax
+f0107390:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f0107393:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+f0107398:	eb 34                	jmp    f01073ce <vprintfmt+0x36e>
+	if (lflag >= 2)
+f010739a:	83 f9 01             	cmp    $0x1,%ecx
+f010739d:	7f 15                	jg     f01073b4 <vprintfmt+0x354>
+	else if (lflag)
+f010739f:	85 c9                	test   %ecx,%ecx
+f01073a1:	74 4d                	je     f01073f0 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+f01073a3:	8b 45 14             	mov    0x14(%ebp),%eax
+f01073a6:	8b 00                	mov    (%eax),%eax
+f01073a8:	99                   	cltd
+f01073a9:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f01073ac:	8d 49 04             	lea    0x4(%ecx),%ecx
+f01073af:	89 4d 14             	mov    %ecx,0x14(%ebp)
+f01073b2:	eb 11                	jmp    f01073c5 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+f01073b4:	8b 45 14             	mov    0x14(%ebp),%eax
+f01073b7:	8b 50 04             	mov    0x4(%eax),%edx
+f01073ba:	8b 00                	mov    (%eax),%eax
+f01073bc:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f01073bf:	8d 49 08             	lea    0x8(%ecx),%ecx
+f01073c2:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+f01073c5:	89 d1                	mov    %edx,%ecx
+f01073c7:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+f01073c9:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+f01073ce:	83 ec 0c             	sub    $0xc,%esp
+f01073d1:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+f01073d5:	50                   	push   %eax
+f01073d6:	ff 75 e0             	push   -0x20(%ebp)
+f01073d9:	57                   	push   %edi
+f01073da:	51                   	push   %ecx
+f01073db:	52                   	push   %edx
+f01073dc:	89 da                	mov    %ebx,%edx
+f01073de:	89 f0                	mov    %esi,%eax
+f01073e0:	e8 98 fb ff ff       	call   f0106f7d <printnum>
+			break;
+f01073e5:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+f01073e8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+f01073eb:	e9 8e fc ff ff       	jmp    f010707e <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+f01073f0:	8b 45 14             	mov    0x14(%ebp),%eax
+f01073f3:	8b 00                	mov    (%eax),%eax
+f01073f5:	99                   	cltd
+f01073f6:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f01073f9:	8d 49 04             	lea    0x4(%ecx),%ecx
+f01073fc:	89 4d 14             	mov    %ecx,0x14(%ebp)
+f01073ff:	eb c4                	jmp    f01073c5 <vprintfmt+0x365>
+			putch('0', putdat);
+f0107401:	83 ec 08             	sub    $0x8,%esp
+f0107404:	53                   	push   %ebx
+f0107405:	6a 30                	push   $0x30
+f0107407:	ff d6                	call   *%esi
+			putch('x', putdat);
+f0107409:	83 c4 08             	add    $0x8,%esp
+f010740c:	53                   	push   %ebx
+f010740d:	6a 78                	push   $0x78
+f010740f:	ff d6                	call   *%esi
+			num = (unsigned long long)
+f0107411:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107414:	8b 10                	mov    (%eax),%edx
+f0107416:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+f010741b:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+f010741e:	8d 40 04             	lea    0x4(%eax),%eax
+f0107421:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0107424:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+f0107429:	eb a3                	jmp    f01073ce <vprintfmt+0x36e>
+	if (lflag >= 2)
+f010742b:	83 f9 01             	cmp    $0x1,%ecx
+f010742e:	7f 1b                	jg     f010744b <vprintfmt+0x3eb>
+	else if (lflag)
+f0107430:	85 c9                	test   %ecx,%ecx
+f0107432:	74 2f                	je     f0107463 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+f0107434:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107437:	8b 10                	mov    (%eax),%edx
+f0107439:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010743e:	8d 40 04             	lea    0x4(%eax),%eax
+f0107441:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0107444:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+f0107449:	eb 83                	jmp    f01073ce <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+f010744b:	8b 45 14             	mov    0x14(%ebp),%eax
+f010744e:	8b 10                	mov    (%eax),%edx
+f0107450:	8b 48 04             	mov    0x4(%eax),%ecx
+f0107453:	8d 40 08             	lea    0x8(%eax),%eax
+f0107456:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0107459:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+f010745e:	e9 6b ff ff ff       	jmp    f01073ce <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+f0107463:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107466:	8b 10                	mov    (%eax),%edx
+f0107468:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010746d:	8d 40 04             	lea    0x4(%eax),%eax
+f0107470:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0107473:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+f0107478:	e9 51 ff ff ff       	jmp    f01073ce <vprintfmt+0x36e>
+			putch(ch, putdat);
+f010747d:	83 ec 08             	sub    $0x8,%esp
+f0107480:	53                   	push   %ebx
+f0107481:	6a 25                	push   $0x25
+f0107483:	ff d6                	call   *%esi
+			break;
+f0107485:	83 c4 10             	add    $0x10,%esp
+f0107488:	e9 5b ff ff ff       	jmp    f01073e8 <vprintfmt+0x388>
+			putch('%', putdat);
+f010748d:	83 ec 08             	sub    $0x8,%esp
+f0107490:	53                   	push   %ebx
+f0107491:	6a 25                	push   $0x25
+f0107493:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+f0107495:	83 c4 10             	add    $0x10,%esp
+f0107498:	89 f8                	mov    %edi,%eax
+f010749a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+f010749e:	74 05                	je     f01074a5 <vprintfmt+0x445>
+f01074a0:	83 e8 01             	sub    $0x1,%eax
+f01074a3:	eb f5                	jmp    f010749a <vprintfmt+0x43a>
+f01074a5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f01074a8:	e9 3b ff ff ff       	jmp    f01073e8 <vprintfmt+0x388>
+
+f01074ad <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+f01074ad:	55                   	push   %ebp
+f01074ae:	89 e5                	mov    %esp,%ebp
+f01074b0:	83 ec 18             	sub    $0x18,%esp
+f01074b3:	8b 45 08             	mov    0x8(%ebp),%eax
+f01074b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+f01074b9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f01074bc:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+f01074c0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+f01074c3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+f01074ca:	85 c0                	test   %eax,%eax
+f01074cc:	74 26                	je     f01074f4 <vsnprintf+0x47>
+f01074ce:	85 d2                	test   %edx,%edx
+f01074d0:	7e 22                	jle    f01074f4 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+f01074d2:	ff 75 14             	push   0x14(%ebp)
+f01074d5:	ff 75 10             	push   0x10(%ebp)
+f01074d8:	8d 45 ec             	lea    -0x14(%ebp),%eax
+f01074db:	50                   	push   %eax
+f01074dc:	68 26 70 10 f0       	push   $0xf0107026
+f01074e1:	e8 7a fb ff ff       	call   f0107060 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+f01074e6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f01074e9:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+f01074ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f01074ef:	83 c4 10             	add    $0x10,%esp
+}
+f01074f2:	c9                   	leave
+f01074f3:	c3                   	ret
+		return -E_INVAL;
+f01074f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01074f9:	eb f7                	jmp    f01074f2 <vsnprintf+0x45>
+
+f01074fb <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+f01074fb:	55                   	push   %ebp
+f01074fc:	89 e5                	mov    %esp,%ebp
+f01074fe:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+f0107501:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+f0107504:	50                   	push   %eax
+f0107505:	ff 75 10             	push   0x10(%ebp)
+f0107508:	ff 75 0c             	push   0xc(%ebp)
+f010750b:	ff 75 08             	push   0x8(%ebp)
+f010750e:	e8 9a ff ff ff       	call   f01074ad <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+f0107513:	c9                   	leave
+f0107514:	c3                   	ret
+
+f0107515 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+f0107515:	55                   	push   %ebp
+f0107516:	89 e5                	mov    %esp,%ebp
+f0107518:	57                   	push   %edi
+f0107519:	56                   	push   %esi
+f010751a:	53                   	push   %ebx
+f010751b:	83 ec 0c             	sub    $0xc,%esp
+f010751e:	8b 45 08             	mov    0x8(%ebp),%eax
+	int i, c, echoing;
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+f0107521:	85 c0                	test   %eax,%eax
+f0107523:	74 11                	je     f0107536 <readline+0x21>
+		cprintf("%s", prompt);
+f0107525:	83 ec 08             	sub    $0x8,%esp
+f0107528:	50                   	push   %eax
+f0107529:	68 b6 94 10 f0       	push   $0xf01094b6
+f010752e:	e8 b7 cf ff ff       	call   f01044ea <cprintf>
+f0107533:	83 c4 10             	add    $0x10,%esp
+	if (prompt != NULL)
+		fprintf(1, "%s", prompt);
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+f0107536:	83 ec 0c             	sub    $0xc,%esp
+f0107539:	6a 00                	push   $0x0
+f010753b:	e8 ba 92 ff ff       	call   f01007fa <iscons>
+f0107540:	89 c7                	mov    %eax,%edi
+f0107542:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+f0107545:	be 00 00 00 00       	mov    $0x0,%esi
+f010754a:	eb 4b                	jmp    f0107597 <readline+0x82>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+f010754c:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+f0107551:	83 fb f8             	cmp    $0xfffffff8,%ebx
+f0107554:	75 08                	jne    f010755e <readline+0x49>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+f0107556:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107559:	5b                   	pop    %ebx
+f010755a:	5e                   	pop    %esi
+f010755b:	5f                   	pop    %edi
+f010755c:	5d                   	pop    %ebp
+f010755d:	c3                   	ret
+				cprintf("read error: %e\n", c);
+f010755e:	83 ec 08             	sub    $0x8,%esp
+f0107561:	53                   	push   %ebx
+f0107562:	68 6b a2 10 f0       	push   $0xf010a26b
+f0107567:	e8 7e cf ff ff       	call   f01044ea <cprintf>
+f010756c:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+f010756f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107574:	eb e0                	jmp    f0107556 <readline+0x41>
+			if (echoing)
+f0107576:	85 ff                	test   %edi,%edi
+f0107578:	75 05                	jne    f010757f <readline+0x6a>
+			i--;
+f010757a:	83 ee 01             	sub    $0x1,%esi
+f010757d:	eb 18                	jmp    f0107597 <readline+0x82>
+				cputchar('\b');
+f010757f:	83 ec 0c             	sub    $0xc,%esp
+f0107582:	6a 08                	push   $0x8
+f0107584:	e8 50 92 ff ff       	call   f01007d9 <cputchar>
+f0107589:	83 c4 10             	add    $0x10,%esp
+f010758c:	eb ec                	jmp    f010757a <readline+0x65>
+			buf[i++] = c;
+f010758e:	88 9e 40 9c 85 f0    	mov    %bl,-0xf7a63c0(%esi)
+f0107594:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+f0107597:	e8 4d 92 ff ff       	call   f01007e9 <getchar>
+f010759c:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+f010759e:	85 c0                	test   %eax,%eax
+f01075a0:	78 aa                	js     f010754c <readline+0x37>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+f01075a2:	83 f8 08             	cmp    $0x8,%eax
+f01075a5:	0f 94 c0             	sete   %al
+f01075a8:	83 fb 7f             	cmp    $0x7f,%ebx
+f01075ab:	0f 94 c2             	sete   %dl
+f01075ae:	08 d0                	or     %dl,%al
+f01075b0:	74 04                	je     f01075b6 <readline+0xa1>
+f01075b2:	85 f6                	test   %esi,%esi
+f01075b4:	7f c0                	jg     f0107576 <readline+0x61>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+f01075b6:	83 fb 1f             	cmp    $0x1f,%ebx
+f01075b9:	7e 1a                	jle    f01075d5 <readline+0xc0>
+f01075bb:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+f01075c1:	7f 12                	jg     f01075d5 <readline+0xc0>
+			if (echoing)
+f01075c3:	85 ff                	test   %edi,%edi
+f01075c5:	74 c7                	je     f010758e <readline+0x79>
+				cputchar(c);
+f01075c7:	83 ec 0c             	sub    $0xc,%esp
+f01075ca:	53                   	push   %ebx
+f01075cb:	e8 09 92 ff ff       	call   f01007d9 <cputchar>
+f01075d0:	83 c4 10             	add    $0x10,%esp
+f01075d3:	eb b9                	jmp    f010758e <readline+0x79>
+		} else if (c == '\n' || c == '\r') {
+f01075d5:	83 fb 0a             	cmp    $0xa,%ebx
+f01075d8:	74 05                	je     f01075df <readline+0xca>
+f01075da:	83 fb 0d             	cmp    $0xd,%ebx
+f01075dd:	75 b8                	jne    f0107597 <readline+0x82>
+			if (echoing)
+f01075df:	85 ff                	test   %edi,%edi
+f01075e1:	75 11                	jne    f01075f4 <readline+0xdf>
+			buf[i] = 0;
+f01075e3:	c6 86 40 9c 85 f0 00 	movb   $0x0,-0xf7a63c0(%esi)
+			return buf;
+f01075ea:	b8 40 9c 85 f0       	mov    $0xf0859c40,%eax
+f01075ef:	e9 62 ff ff ff       	jmp    f0107556 <readline+0x41>
+				cputchar('\n');
+f01075f4:	83 ec 0c             	sub    $0xc,%esp
+f01075f7:	6a 0a                	push   $0xa
+f01075f9:	e8 db 91 ff ff       	call   f01007d9 <cputchar>
+f01075fe:	83 c4 10             	add    $0x10,%esp
+f0107601:	eb e0                	jmp    f01075e3 <readline+0xce>
+
+f0107603 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+f0107603:	55                   	push   %ebp
+f0107604:	89 e5                	mov    %esp,%ebp
+f0107606:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+f0107609:	b8 00 00 00 00       	mov    $0x0,%eax
+f010760e:	eb 03                	jmp    f0107613 <strlen+0x10>
+		n++;
+f0107610:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+f0107613:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+f0107617:	75 f7                	jne    f0107610 <strlen+0xd>
+	return n;
+}
+f0107619:	5d                   	pop    %ebp
+f010761a:	c3                   	ret
+
+f010761b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+f010761b:	55                   	push   %ebp
+f010761c:	89 e5                	mov    %esp,%ebp
+f010761e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f0107621:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0107624:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107629:	eb 03                	jmp    f010762e <strnlen+0x13>
+		n++;
+f010762b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f010762e:	39 d0                	cmp    %edx,%eax
+f0107630:	74 08                	je     f010763a <strnlen+0x1f>
+f0107632:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+f0107636:	75 f3                	jne    f010762b <strnlen+0x10>
+f0107638:	89 c2                	mov    %eax,%edx
+	return n;
+}
+f010763a:	89 d0                	mov    %edx,%eax
+f010763c:	5d                   	pop    %ebp
+f010763d:	c3                   	ret
+
+f010763e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+f010763e:	55                   	push   %ebp
+f010763f:	89 e5                	mov    %esp,%ebp
+f0107641:	53                   	push   %ebx
+f0107642:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0107645:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+f0107648:	b8 00 00 00 00       	mov    $0x0,%eax
+f010764d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+f0107651:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+f0107654:	83 c0 01             	add    $0x1,%eax
+f0107657:	84 d2                	test   %dl,%dl
+f0107659:	75 f2                	jne    f010764d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+f010765b:	89 c8                	mov    %ecx,%eax
+f010765d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107660:	c9                   	leave
+f0107661:	c3                   	ret
+
+f0107662 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+f0107662:	55                   	push   %ebp
+f0107663:	89 e5                	mov    %esp,%ebp
+f0107665:	53                   	push   %ebx
+f0107666:	83 ec 10             	sub    $0x10,%esp
+f0107669:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+f010766c:	53                   	push   %ebx
+f010766d:	e8 91 ff ff ff       	call   f0107603 <strlen>
+f0107672:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+f0107675:	ff 75 0c             	push   0xc(%ebp)
+f0107678:	01 d8                	add    %ebx,%eax
+f010767a:	50                   	push   %eax
+f010767b:	e8 be ff ff ff       	call   f010763e <strcpy>
+	return dst;
+}
+f0107680:	89 d8                	mov    %ebx,%eax
+f0107682:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107685:	c9                   	leave
+f0107686:	c3                   	ret
+
+f0107687 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+f0107687:	55                   	push   %ebp
+f0107688:	89 e5                	mov    %esp,%ebp
+f010768a:	56                   	push   %esi
+f010768b:	53                   	push   %ebx
+f010768c:	8b 75 08             	mov    0x8(%ebp),%esi
+f010768f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+f0107692:	89 f3                	mov    %esi,%ebx
+f0107694:	03 5d 10             	add    0x10(%ebp),%ebx
+f0107697:	89 f0                	mov    %esi,%eax
+f0107699:	eb 0f                	jmp    f01076aa <strncpy+0x23>
+		*dst++ = *src;
+f010769b:	83 c0 01             	add    $0x1,%eax
+f010769e:	0f b6 0a             	movzbl (%edx),%ecx
+f01076a1:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+f01076a4:	80 f9 01             	cmp    $0x1,%cl
+f01076a7:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+f01076aa:	39 d8                	cmp    %ebx,%eax
+f01076ac:	75 ed                	jne    f010769b <strncpy+0x14>
+	}
+	return ret;
+}
+f01076ae:	89 f0                	mov    %esi,%eax
+f01076b0:	5b                   	pop    %ebx
+f01076b1:	5e                   	pop    %esi
+f01076b2:	5d                   	pop    %ebp
+f01076b3:	c3                   	ret
+
+f01076b4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+f01076b4:	55                   	push   %ebp
+f01076b5:	89 e5                	mov    %esp,%ebp
+f01076b7:	56                   	push   %esi
+f01076b8:	53                   	push   %ebx
+f01076b9:	8b 75 08             	mov    0x8(%ebp),%esi
+f01076bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f01076bf:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+f01076c2:	89 f0                	mov    %esi,%eax
+f01076c4:	85 d2                	test   %edx,%edx
+f01076c6:	74 21                	je     f01076e9 <strlcpy+0x35>
+f01076c8:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+f01076cc:	89 f2                	mov    %esi,%edx
+f01076ce:	eb 09                	jmp    f01076d9 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+f01076d0:	83 c1 01             	add    $0x1,%ecx
+f01076d3:	83 c2 01             	add    $0x1,%edx
+f01076d6:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+f01076d9:	39 c2                	cmp    %eax,%edx
+f01076db:	74 09                	je     f01076e6 <strlcpy+0x32>
+f01076dd:	0f b6 19             	movzbl (%ecx),%ebx
+f01076e0:	84 db                	test   %bl,%bl
+f01076e2:	75 ec                	jne    f01076d0 <strlcpy+0x1c>
+f01076e4:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+f01076e6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+f01076e9:	29 f0                	sub    %esi,%eax
+}
+f01076eb:	5b                   	pop    %ebx
+f01076ec:	5e                   	pop    %esi
+f01076ed:	5d                   	pop    %ebp
+f01076ee:	c3                   	ret
+
+f01076ef <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+f01076ef:	55                   	push   %ebp
+f01076f0:	89 e5                	mov    %esp,%ebp
+f01076f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f01076f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+f01076f8:	eb 06                	jmp    f0107700 <strcmp+0x11>
+		p++, q++;
+f01076fa:	83 c1 01             	add    $0x1,%ecx
+f01076fd:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+f0107700:	0f b6 01             	movzbl (%ecx),%eax
+f0107703:	84 c0                	test   %al,%al
+f0107705:	74 04                	je     f010770b <strcmp+0x1c>
+f0107707:	3a 02                	cmp    (%edx),%al
+f0107709:	74 ef                	je     f01076fa <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+f010770b:	0f b6 c0             	movzbl %al,%eax
+f010770e:	0f b6 12             	movzbl (%edx),%edx
+f0107711:	29 d0                	sub    %edx,%eax
+}
+f0107713:	5d                   	pop    %ebp
+f0107714:	c3                   	ret
+
+f0107715 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+f0107715:	55                   	push   %ebp
+f0107716:	89 e5                	mov    %esp,%ebp
+f0107718:	53                   	push   %ebx
+f0107719:	8b 45 08             	mov    0x8(%ebp),%eax
+f010771c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f010771f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+f0107722:	eb 09                	jmp    f010772d <strncmp+0x18>
+		n--, p++, q++;
+f0107724:	83 ea 01             	sub    $0x1,%edx
+f0107727:	83 c0 01             	add    $0x1,%eax
+f010772a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+f010772d:	85 d2                	test   %edx,%edx
+f010772f:	74 18                	je     f0107749 <strncmp+0x34>
+f0107731:	0f b6 18             	movzbl (%eax),%ebx
+f0107734:	84 db                	test   %bl,%bl
+f0107736:	74 04                	je     f010773c <strncmp+0x27>
+f0107738:	3a 19                	cmp    (%ecx),%bl
+f010773a:	74 e8                	je     f0107724 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+f010773c:	0f b6 00             	movzbl (%eax),%eax
+f010773f:	0f b6 11             	movzbl (%ecx),%edx
+f0107742:	29 d0                	sub    %edx,%eax
+}
+f0107744:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107747:	c9                   	leave
+f0107748:	c3                   	ret
+		return 0;
+f0107749:	b8 00 00 00 00       	mov    $0x0,%eax
+f010774e:	eb f4                	jmp    f0107744 <strncmp+0x2f>
+
+f0107750 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+f0107750:	55                   	push   %ebp
+f0107751:	89 e5                	mov    %esp,%ebp
+f0107753:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107756:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+f010775a:	eb 03                	jmp    f010775f <strchr+0xf>
+f010775c:	83 c0 01             	add    $0x1,%eax
+f010775f:	0f b6 10             	movzbl (%eax),%edx
+f0107762:	84 d2                	test   %dl,%dl
+f0107764:	74 06                	je     f010776c <strchr+0x1c>
+		if (*s == c)
+f0107766:	38 ca                	cmp    %cl,%dl
+f0107768:	75 f2                	jne    f010775c <strchr+0xc>
+f010776a:	eb 05                	jmp    f0107771 <strchr+0x21>
+			return (char *) s;
+	return 0;
+f010776c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0107771:	5d                   	pop    %ebp
+f0107772:	c3                   	ret
+
+f0107773 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+f0107773:	55                   	push   %ebp
+f0107774:	89 e5                	mov    %esp,%ebp
+f0107776:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107779:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+f010777d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+f0107780:	38 ca                	cmp    %cl,%dl
+f0107782:	74 09                	je     f010778d <strfind+0x1a>
+f0107784:	84 d2                	test   %dl,%dl
+f0107786:	74 05                	je     f010778d <strfind+0x1a>
+	for (; *s; s++)
+f0107788:	83 c0 01             	add    $0x1,%eax
+f010778b:	eb f0                	jmp    f010777d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+f010778d:	5d                   	pop    %ebp
+f010778e:	c3                   	ret
+
+f010778f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+f010778f:	55                   	push   %ebp
+f0107790:	89 e5                	mov    %esp,%ebp
+f0107792:	57                   	push   %edi
+f0107793:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0107796:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+f0107799:	85 c9                	test   %ecx,%ecx
+f010779b:	74 20                	je     f01077bd <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+f010779d:	89 f8                	mov    %edi,%eax
+f010779f:	09 c8                	or     %ecx,%eax
+f01077a1:	a8 03                	test   $0x3,%al
+f01077a3:	75 12                	jne    f01077b7 <memset+0x28>
+		c &= 0xFF;
+f01077a5:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+f01077a9:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+f01077af:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+f01077b2:	fc                   	cld
+f01077b3:	f3 ab                	rep stos %eax,%es:(%edi)
+f01077b5:	eb 06                	jmp    f01077bd <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+f01077b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01077ba:	fc                   	cld
+f01077bb:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+f01077bd:	89 f8                	mov    %edi,%eax
+f01077bf:	8b 7d fc             	mov    -0x4(%ebp),%edi
+f01077c2:	c9                   	leave
+f01077c3:	c3                   	ret
+
+f01077c4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+f01077c4:	55                   	push   %ebp
+f01077c5:	89 e5                	mov    %esp,%ebp
+f01077c7:	57                   	push   %edi
+f01077c8:	56                   	push   %esi
+f01077c9:	8b 45 08             	mov    0x8(%ebp),%eax
+f01077cc:	8b 75 0c             	mov    0xc(%ebp),%esi
+f01077cf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+f01077d2:	39 c6                	cmp    %eax,%esi
+f01077d4:	73 32                	jae    f0107808 <memmove+0x44>
+f01077d6:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+f01077d9:	39 d0                	cmp    %edx,%eax
+f01077db:	73 2b                	jae    f0107808 <memmove+0x44>
+		s += n;
+		d += n;
+f01077dd:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f01077e0:	89 d6                	mov    %edx,%esi
+f01077e2:	09 fe                	or     %edi,%esi
+f01077e4:	09 ce                	or     %ecx,%esi
+f01077e6:	f7 c6 03 00 00 00    	test   $0x3,%esi
+f01077ec:	75 0e                	jne    f01077fc <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+f01077ee:	83 ef 04             	sub    $0x4,%edi
+f01077f1:	8d 72 fc             	lea    -0x4(%edx),%esi
+f01077f4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+f01077f7:	fd                   	std
+f01077f8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f01077fa:	eb 09                	jmp    f0107805 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+f01077fc:	83 ef 01             	sub    $0x1,%edi
+f01077ff:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+f0107802:	fd                   	std
+f0107803:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+f0107805:	fc                   	cld
+f0107806:	eb 1a                	jmp    f0107822 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f0107808:	89 f2                	mov    %esi,%edx
+f010780a:	09 c2                	or     %eax,%edx
+f010780c:	09 ca                	or     %ecx,%edx
+f010780e:	f6 c2 03             	test   $0x3,%dl
+f0107811:	75 0a                	jne    f010781d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+f0107813:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+f0107816:	89 c7                	mov    %eax,%edi
+f0107818:	fc                   	cld
+f0107819:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f010781b:	eb 05                	jmp    f0107822 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+f010781d:	89 c7                	mov    %eax,%edi
+f010781f:	fc                   	cld
+f0107820:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+f0107822:	5e                   	pop    %esi
+f0107823:	5f                   	pop    %edi
+f0107824:	5d                   	pop    %ebp
+f0107825:	c3                   	ret
+
+f0107826 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+f0107826:	55                   	push   %ebp
+f0107827:	89 e5                	mov    %esp,%ebp
+f0107829:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+f010782c:	ff 75 10             	push   0x10(%ebp)
+f010782f:	ff 75 0c             	push   0xc(%ebp)
+f0107832:	ff 75 08             	push   0x8(%ebp)
+f0107835:	e8 8a ff ff ff       	call   f01077c4 <memmove>
+}
+f010783a:	c9                   	leave
+f010783b:	c3                   	ret
+
+f010783c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+f010783c:	55                   	push   %ebp
+f010783d:	89 e5                	mov    %esp,%ebp
+f010783f:	56                   	push   %esi
+f0107840:	53                   	push   %ebx
+f0107841:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107844:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+f0107847:	89 c6                	mov    %eax,%esi
+f0107849:	03 75 10             	add    0x10(%ebp),%esi
+f010784c:	eb 06                	jmp    f0107854 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+f010784e:	83 c0 01             	add    $0x1,%eax
+f0107851:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+f0107854:	39 f0                	cmp    %esi,%eax
+f0107856:	74 14                	je     f010786c <memcmp+0x30>
+		if (*s1 != *s2)
+f0107858:	0f b6 08             	movzbl (%eax),%ecx
+f010785b:	0f b6 1a             	movzbl (%edx),%ebx
+f010785e:	38 d9                	cmp    %bl,%cl
+f0107860:	74 ec                	je     f010784e <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+f0107862:	0f b6 c1             	movzbl %cl,%eax
+f0107865:	0f b6 db             	movzbl %bl,%ebx
+f0107868:	29 d8                	sub    %ebx,%eax
+f010786a:	eb 05                	jmp    f0107871 <memcmp+0x35>
+	}
+
+	return 0;
+f010786c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0107871:	5b                   	pop    %ebx
+f0107872:	5e                   	pop    %esi
+f0107873:	5d                   	pop    %ebp
+f0107874:	c3                   	ret
+
+f0107875 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+f0107875:	55                   	push   %ebp
+f0107876:	89 e5                	mov    %esp,%ebp
+f0107878:	8b 45 08             	mov    0x8(%ebp),%eax
+f010787b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+f010787e:	89 c2                	mov    %eax,%edx
+f0107880:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+f0107883:	eb 03                	jmp    f0107888 <memfind+0x13>
+f0107885:	83 c0 01             	add    $0x1,%eax
+f0107888:	39 d0                	cmp    %edx,%eax
+f010788a:	73 04                	jae    f0107890 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+f010788c:	38 08                	cmp    %cl,(%eax)
+f010788e:	75 f5                	jne    f0107885 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+f0107890:	5d                   	pop    %ebp
+f0107891:	c3                   	ret
+
+f0107892 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+f0107892:	55                   	push   %ebp
+f0107893:	89 e5                	mov    %esp,%ebp
+f0107895:	57                   	push   %edi
+f0107896:	56                   	push   %esi
+f0107897:	53                   	push   %ebx
+f0107898:	8b 55 08             	mov    0x8(%ebp),%edx
+f010789b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+f010789e:	eb 03                	jmp    f01078a3 <strtol+0x11>
+		s++;
+f01078a0:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+f01078a3:	0f b6 02             	movzbl (%edx),%eax
+f01078a6:	3c 20                	cmp    $0x20,%al
+f01078a8:	74 f6                	je     f01078a0 <strtol+0xe>
+f01078aa:	3c 09                	cmp    $0x9,%al
+f01078ac:	74 f2                	je     f01078a0 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+f01078ae:	3c 2b                	cmp    $0x2b,%al
+f01078b0:	74 2a                	je     f01078dc <strtol+0x4a>
+	int neg = 0;
+f01078b2:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+f01078b7:	3c 2d                	cmp    $0x2d,%al
+f01078b9:	74 2b                	je     f01078e6 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f01078bb:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+f01078c1:	75 0f                	jne    f01078d2 <strtol+0x40>
+f01078c3:	80 3a 30             	cmpb   $0x30,(%edx)
+f01078c6:	74 28                	je     f01078f0 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+f01078c8:	85 db                	test   %ebx,%ebx
+f01078ca:	b8 0a 00 00 00       	mov    $0xa,%eax
+f01078cf:	0f 44 d8             	cmove  %eax,%ebx
+f01078d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01078d7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+f01078da:	eb 46                	jmp    f0107922 <strtol+0x90>
+		s++;
+f01078dc:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+f01078df:	bf 00 00 00 00       	mov    $0x0,%edi
+f01078e4:	eb d5                	jmp    f01078bb <strtol+0x29>
+		s++, neg = 1;
+f01078e6:	83 c2 01             	add    $0x1,%edx
+f01078e9:	bf 01 00 00 00       	mov    $0x1,%edi
+f01078ee:	eb cb                	jmp    f01078bb <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f01078f0:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+f01078f4:	74 0e                	je     f0107904 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+f01078f6:	85 db                	test   %ebx,%ebx
+f01078f8:	75 d8                	jne    f01078d2 <strtol+0x40>
+		s++, base = 8;
+f01078fa:	83 c2 01             	add    $0x1,%edx
+f01078fd:	bb 08 00 00 00       	mov    $0x8,%ebx
+f0107902:	eb ce                	jmp    f01078d2 <strtol+0x40>
+		s += 2, base = 16;
+f0107904:	83 c2 02             	add    $0x2,%edx
+f0107907:	bb 10 00 00 00       	mov    $0x10,%ebx
+f010790c:	eb c4                	jmp    f01078d2 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+f010790e:	0f be c0             	movsbl %al,%eax
+f0107911:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+f0107914:	3b 45 10             	cmp    0x10(%ebp),%eax
+f0107917:	7d 3a                	jge    f0107953 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+f0107919:	83 c2 01             	add    $0x1,%edx
+f010791c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+f0107920:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+f0107922:	0f b6 02             	movzbl (%edx),%eax
+f0107925:	8d 70 d0             	lea    -0x30(%eax),%esi
+f0107928:	89 f3                	mov    %esi,%ebx
+f010792a:	80 fb 09             	cmp    $0x9,%bl
+f010792d:	76 df                	jbe    f010790e <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+f010792f:	8d 70 9f             	lea    -0x61(%eax),%esi
+f0107932:	89 f3                	mov    %esi,%ebx
+f0107934:	80 fb 19             	cmp    $0x19,%bl
+f0107937:	77 08                	ja     f0107941 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+f0107939:	0f be c0             	movsbl %al,%eax
+f010793c:	83 e8 57             	sub    $0x57,%eax
+f010793f:	eb d3                	jmp    f0107914 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+f0107941:	8d 70 bf             	lea    -0x41(%eax),%esi
+f0107944:	89 f3                	mov    %esi,%ebx
+f0107946:	80 fb 19             	cmp    $0x19,%bl
+f0107949:	77 08                	ja     f0107953 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+f010794b:	0f be c0             	movsbl %al,%eax
+f010794e:	83 e8 37             	sub    $0x37,%eax
+f0107951:	eb c1                	jmp    f0107914 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+f0107953:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f0107957:	74 05                	je     f010795e <strtol+0xcc>
+		*endptr = (char *) s;
+f0107959:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010795c:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+f010795e:	89 c8                	mov    %ecx,%eax
+f0107960:	f7 d8                	neg    %eax
+f0107962:	85 ff                	test   %edi,%edi
+f0107964:	0f 45 c8             	cmovne %eax,%ecx
+}
+f0107967:	89 c8                	mov    %ecx,%eax
+f0107969:	5b                   	pop    %ebx
+f010796a:	5e                   	pop    %esi
+f010796b:	5f                   	pop    %edi
+f010796c:	5d                   	pop    %ebp
+f010796d:	c3                   	ret
+
+f010796e <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+f010796e:	55                   	push   %ebp
+f010796f:	89 e5                	mov    %esp,%ebp
+f0107971:	57                   	push   %edi
+f0107972:	56                   	push   %esi
+f0107973:	53                   	push   %ebx
+f0107974:	83 ec 0c             	sub    $0xc,%esp
+f0107977:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010797a:	8b 75 0c             	mov    0xc(%ebp),%esi
+f010797d:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+f0107980:	85 ff                	test   %edi,%edi
+f0107982:	74 16                	je     f010799a <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+f0107984:	83 ec 04             	sub    $0x4,%esp
+f0107987:	56                   	push   %esi
+f0107988:	6a 00                	push   $0x0
+f010798a:	53                   	push   %ebx
+f010798b:	e8 02 ff ff ff       	call   f0107892 <strtol>
+f0107990:	89 07                	mov    %eax,(%edi)
+f0107992:	83 c4 10             	add    $0x10,%esp
+f0107995:	eb 03                	jmp    f010799a <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+f0107997:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+f010799a:	0f b6 03             	movzbl (%ebx),%eax
+f010799d:	3c 20                	cmp    $0x20,%al
+f010799f:	74 f6                	je     f0107997 <strisl+0x29>
+f01079a1:	3c 09                	cmp    $0x9,%al
+f01079a3:	74 f2                	je     f0107997 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+f01079a5:	3c 2b                	cmp    $0x2b,%al
+f01079a7:	74 23                	je     f01079cc <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+f01079a9:	3c 2d                	cmp    $0x2d,%al
+f01079ab:	0f 94 c0             	sete   %al
+f01079ae:	0f b6 c0             	movzbl %al,%eax
+f01079b1:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f01079b3:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+f01079b9:	75 41                	jne    f01079fc <strisl+0x8e>
+f01079bb:	80 3b 30             	cmpb   $0x30,(%ebx)
+f01079be:	74 11                	je     f01079d1 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+f01079c0:	85 f6                	test   %esi,%esi
+f01079c2:	b8 0a 00 00 00       	mov    $0xa,%eax
+f01079c7:	0f 44 f0             	cmove  %eax,%esi
+f01079ca:	eb 30                	jmp    f01079fc <strisl+0x8e>
+		s++;
+f01079cc:	83 c3 01             	add    $0x1,%ebx
+f01079cf:	eb e2                	jmp    f01079b3 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f01079d1:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+f01079d5:	74 0e                	je     f01079e5 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+f01079d7:	85 f6                	test   %esi,%esi
+f01079d9:	75 21                	jne    f01079fc <strisl+0x8e>
+		s++, base = 8;
+f01079db:	83 c3 01             	add    $0x1,%ebx
+f01079de:	be 08 00 00 00       	mov    $0x8,%esi
+f01079e3:	eb 17                	jmp    f01079fc <strisl+0x8e>
+		s += 2, base = 16;
+f01079e5:	83 c3 02             	add    $0x2,%ebx
+f01079e8:	be 10 00 00 00       	mov    $0x10,%esi
+f01079ed:	eb 0d                	jmp    f01079fc <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+f01079ef:	0f be c0             	movsbl %al,%eax
+f01079f2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+f01079f5:	39 f0                	cmp    %esi,%eax
+f01079f7:	7d 38                	jge    f0107a31 <strisl+0xc3>
+			return 0;
+		s++;
+f01079f9:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+f01079fc:	0f b6 03             	movzbl (%ebx),%eax
+f01079ff:	8d 50 d0             	lea    -0x30(%eax),%edx
+f0107a02:	80 fa 09             	cmp    $0x9,%dl
+f0107a05:	76 e8                	jbe    f01079ef <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+f0107a07:	8d 50 9f             	lea    -0x61(%eax),%edx
+f0107a0a:	80 fa 19             	cmp    $0x19,%dl
+f0107a0d:	77 08                	ja     f0107a17 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+f0107a0f:	0f be c0             	movsbl %al,%eax
+f0107a12:	83 e8 57             	sub    $0x57,%eax
+f0107a15:	eb de                	jmp    f01079f5 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+f0107a17:	8d 50 bf             	lea    -0x41(%eax),%edx
+f0107a1a:	80 fa 19             	cmp    $0x19,%dl
+f0107a1d:	77 08                	ja     f0107a27 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+f0107a1f:	0f be c0             	movsbl %al,%eax
+f0107a22:	83 e8 37             	sub    $0x37,%eax
+f0107a25:	eb ce                	jmp    f01079f5 <strisl+0x87>
+		else if (!*s)
+f0107a27:	84 c0                	test   %al,%al
+f0107a29:	0f 94 c0             	sete   %al
+f0107a2c:	0f b6 c0             	movzbl %al,%eax
+f0107a2f:	eb 05                	jmp    f0107a36 <strisl+0xc8>
+			return 0;
+f0107a31:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+f0107a36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107a39:	5b                   	pop    %ebx
+f0107a3a:	5e                   	pop    %esi
+f0107a3b:	5f                   	pop    %edi
+f0107a3c:	5d                   	pop    %ebp
+f0107a3d:	c3                   	ret
+f0107a3e:	66 90                	xchg   %ax,%ax
+
+f0107a40 <mpentry_start>:
+.set PROT_MODE_DSEG, 0x10	# kernel data segment selector
+
+.code16           
+.globl mpentry_start
+mpentry_start:
+	cli            
+f0107a40:	fa                   	cli
+
+	xorw    %ax, %ax
+f0107a41:	31 c0                	xor    %eax,%eax
+	movw    %ax, %ds
+f0107a43:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f0107a45:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f0107a47:	8e d0                	mov    %eax,%ss
+
+	lgdt    MPBOOTPHYS(gdtdesc)
+f0107a49:	0f 01 16             	lgdtl  (%esi)
+f0107a4c:	74 70                	je     f0107abe <mpsearch1+0x3>
+	movl    %cr0, %eax
+f0107a4e:	0f 20 c0             	mov    %cr0,%eax
+	orl     $CR0_PE, %eax
+f0107a51:	66 83 c8 01          	or     $0x1,%ax
+	movl    %eax, %cr0
+f0107a55:	0f 22 c0             	mov    %eax,%cr0
+
+	ljmpl   $(PROT_MODE_CSEG), $(MPBOOTPHYS(start32))
+f0107a58:	66 ea 20 70 00 00    	ljmpw  $0x0,$0x7020
+f0107a5e:	08 00                	or     %al,(%eax)
+
+f0107a60 <start32>:
+
+.code32
+start32:
+	movw    $(PROT_MODE_DSEG), %ax
+f0107a60:	66 b8 10 00          	mov    $0x10,%ax
+	movw    %ax, %ds
+f0107a64:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f0107a66:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f0107a68:	8e d0                	mov    %eax,%ss
+	movw    $0, %ax
+f0107a6a:	66 b8 00 00          	mov    $0x0,%ax
+	movw    %ax, %fs
+f0107a6e:	8e e0                	mov    %eax,%fs
+	movw    %ax, %gs
+f0107a70:	8e e8                	mov    %eax,%gs
+
+	# Set up initial page table. We cannot use kern_pgdir yet because
+	# we are still running at a low EIP.
+	movl    $(RELOC(entry_pgdir)), %eax
+f0107a72:	b8 00 30 11 00       	mov    $0x113000,%eax
+	movl    %eax, %cr3
+f0107a77:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on paging.
+	movl    %cr0, %eax
+f0107a7a:	0f 20 c0             	mov    %cr0,%eax
+	orl     $(CR0_PE|CR0_PG|CR0_WP), %eax
+f0107a7d:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl    %eax, %cr0
+f0107a82:	0f 22 c0             	mov    %eax,%cr0
+
+	# Switch to the per-cpu stack allocated in boot_aps()
+	movl    mpentry_kstack, %esp
+f0107a85:	8b 25 48 a0 85 f0    	mov    0xf085a048,%esp
+	movl    $0x0, %ebp       # nuke frame pointer
+f0107a8b:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Call mp_main().  (Exercise for the reader: why the indirect call?)
+	movl    $mp_main, %eax
+f0107a90:	b8 15 02 10 f0       	mov    $0xf0100215,%eax
+	call    *%eax
+f0107a95:	ff d0                	call   *%eax
+
+f0107a97 <spin>:
+
+	# If mp_main returns (it shouldn't), loop.
+spin:
+	jmp     spin
+f0107a97:	eb fe                	jmp    f0107a97 <spin>
+f0107a99:	8d 76 00             	lea    0x0(%esi),%esi
+
+f0107a9c <gdt>:
+	...
+f0107aa4:	ff                   	(bad)
+f0107aa5:	ff 00                	incl   (%eax)
+f0107aa7:	00 00                	add    %al,(%eax)
+f0107aa9:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+f0107ab0:	00                   	.byte 0x0
+f0107ab1:	92                   	xchg   %eax,%edx
+f0107ab2:	cf                   	iret
+	...
+
+f0107ab4 <gdtdesc>:
+f0107ab4:	17                   	pop    %ss
+f0107ab5:	00 5c 70 00          	add    %bl,0x0(%eax,%esi,2)
+	...
+
+f0107aba <mpentry_end>:
+	.word   0x17				# sizeof(gdt) - 1
+	.long   MPBOOTPHYS(gdt)			# address gdt
+
+.globl mpentry_end
+mpentry_end:
+	nop
+f0107aba:	90                   	nop
+
+f0107abb <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at physical address addr.
+static struct mp *
+mpsearch1(physaddr_t a, int len)
+{
+f0107abb:	55                   	push   %ebp
+f0107abc:	89 e5                	mov    %esp,%ebp
+f0107abe:	57                   	push   %edi
+f0107abf:	56                   	push   %esi
+f0107ac0:	53                   	push   %ebx
+f0107ac1:	83 ec 0c             	sub    $0xc,%esp
+f0107ac4:	89 c3                	mov    %eax,%ebx
+f0107ac6:	89 d7                	mov    %edx,%edi
+	if (PGNUM(pa) >= npages)
+f0107ac8:	a1 54 a0 85 f0       	mov    0xf085a054,%eax
+f0107acd:	89 da                	mov    %ebx,%edx
+f0107acf:	c1 ea 0c             	shr    $0xc,%edx
+f0107ad2:	39 c2                	cmp    %eax,%edx
+f0107ad4:	73 1f                	jae    f0107af5 <mpsearch1+0x3a>
+	return (void *)(pa + KERNBASE);
+f0107ad6:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+	struct mp *mp = KADDR(a), *end = KADDR(a + len);
+f0107adc:	01 df                	add    %ebx,%edi
+	if (PGNUM(pa) >= npages)
+f0107ade:	89 fa                	mov    %edi,%edx
+f0107ae0:	c1 ea 0c             	shr    $0xc,%edx
+f0107ae3:	39 c2                	cmp    %eax,%edx
+f0107ae5:	73 20                	jae    f0107b07 <mpsearch1+0x4c>
+	return (void *)(pa + KERNBASE);
+f0107ae7:	81 ef 00 00 00 10    	sub    $0x10000000,%edi
+
+	for (; mp < end; mp++)
+f0107aed:	81 eb f0 ff ff 0f    	sub    $0xffffff0,%ebx
+f0107af3:	eb 3a                	jmp    f0107b2f <mpsearch1+0x74>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0107af5:	53                   	push   %ebx
+f0107af6:	68 e4 85 10 f0       	push   $0xf01085e4
+f0107afb:	6a 57                	push   $0x57
+f0107afd:	68 09 a4 10 f0       	push   $0xf010a409
+f0107b02:	e8 39 85 ff ff       	call   f0100040 <_panic>
+f0107b07:	57                   	push   %edi
+f0107b08:	68 e4 85 10 f0       	push   $0xf01085e4
+f0107b0d:	6a 57                	push   $0x57
+f0107b0f:	68 09 a4 10 f0       	push   $0xf010a409
+f0107b14:	e8 27 85 ff ff       	call   f0100040 <_panic>
+		sum += ((uint8_t *)addr)[i];
+f0107b19:	0f b6 0a             	movzbl (%edx),%ecx
+f0107b1c:	01 c8                	add    %ecx,%eax
+	for (i = 0; i < len; i++)
+f0107b1e:	83 c2 01             	add    $0x1,%edx
+f0107b21:	39 da                	cmp    %ebx,%edx
+f0107b23:	75 f4                	jne    f0107b19 <mpsearch1+0x5e>
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f0107b25:	84 c0                	test   %al,%al
+f0107b27:	74 2a                	je     f0107b53 <mpsearch1+0x98>
+	for (; mp < end; mp++)
+f0107b29:	83 c6 10             	add    $0x10,%esi
+f0107b2c:	83 c3 10             	add    $0x10,%ebx
+f0107b2f:	39 fe                	cmp    %edi,%esi
+f0107b31:	73 1b                	jae    f0107b4e <mpsearch1+0x93>
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f0107b33:	83 ec 04             	sub    $0x4,%esp
+f0107b36:	6a 04                	push   $0x4
+f0107b38:	68 19 a4 10 f0       	push   $0xf010a419
+f0107b3d:	56                   	push   %esi
+f0107b3e:	e8 f9 fc ff ff       	call   f010783c <memcmp>
+f0107b43:	83 c4 10             	add    $0x10,%esp
+f0107b46:	89 f2                	mov    %esi,%edx
+f0107b48:	85 c0                	test   %eax,%eax
+f0107b4a:	74 d5                	je     f0107b21 <mpsearch1+0x66>
+f0107b4c:	eb db                	jmp    f0107b29 <mpsearch1+0x6e>
+		    sum(mp, sizeof(*mp)) == 0)
+			return mp;
+	return NULL;
+f0107b4e:	be 00 00 00 00       	mov    $0x0,%esi
+}
+f0107b53:	89 f0                	mov    %esi,%eax
+f0107b55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107b58:	5b                   	pop    %ebx
+f0107b59:	5e                   	pop    %esi
+f0107b5a:	5f                   	pop    %edi
+f0107b5b:	5d                   	pop    %ebp
+f0107b5c:	c3                   	ret
+
+f0107b5d <mp_init>:
+	return conf;
+}
+
+void
+mp_init(void)
+{
+f0107b5d:	55                   	push   %ebp
+f0107b5e:	89 e5                	mov    %esp,%ebp
+f0107b60:	57                   	push   %edi
+f0107b61:	56                   	push   %esi
+f0107b62:	53                   	push   %ebx
+f0107b63:	83 ec 1c             	sub    $0x1c,%esp
+	struct mpconf *conf;
+	struct mpproc *proc;
+	uint8_t *p;
+	unsigned int i;
+
+	bootcpu = &cpus[0];
+f0107b66:	c7 05 c0 b3 85 f0 20 	movl   $0xf085b020,0xf085b3c0
+f0107b6d:	b0 85 f0 
+	if (PGNUM(pa) >= npages)
+f0107b70:	83 3d 54 a0 85 f0 00 	cmpl   $0x0,0xf085a054
+f0107b77:	0f 84 86 00 00 00    	je     f0107c03 <mp_init+0xa6>
+	if ((p = *(uint16_t *) (bda + 0x0E))) {
+f0107b7d:	0f b7 05 0e 04 00 f0 	movzwl 0xf000040e,%eax
+f0107b84:	85 c0                	test   %eax,%eax
+f0107b86:	0f 84 8d 00 00 00    	je     f0107c19 <mp_init+0xbc>
+		p <<= 4;	// Translate from segment to PA
+f0107b8c:	c1 e0 04             	shl    $0x4,%eax
+		if ((mp = mpsearch1(p, 1024)))
+f0107b8f:	ba 00 04 00 00       	mov    $0x400,%edx
+f0107b94:	e8 22 ff ff ff       	call   f0107abb <mpsearch1>
+f0107b99:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0107b9c:	85 c0                	test   %eax,%eax
+f0107b9e:	75 1a                	jne    f0107bba <mp_init+0x5d>
+	return mpsearch1(0xF0000, 0x10000);
+f0107ba0:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0107ba5:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+f0107baa:	e8 0c ff ff ff       	call   f0107abb <mpsearch1>
+f0107baf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((mp = mpsearch()) == 0)
+f0107bb2:	85 c0                	test   %eax,%eax
+f0107bb4:	0f 84 20 02 00 00    	je     f0107dda <mp_init+0x27d>
+	if (mp->physaddr == 0 || mp->type != 0) {
+f0107bba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0107bbd:	8b 58 04             	mov    0x4(%eax),%ebx
+f0107bc0:	85 db                	test   %ebx,%ebx
+f0107bc2:	74 7a                	je     f0107c3e <mp_init+0xe1>
+f0107bc4:	80 78 0b 00          	cmpb   $0x0,0xb(%eax)
+f0107bc8:	75 74                	jne    f0107c3e <mp_init+0xe1>
+f0107bca:	89 d8                	mov    %ebx,%eax
+f0107bcc:	c1 e8 0c             	shr    $0xc,%eax
+f0107bcf:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f0107bd5:	73 7c                	jae    f0107c53 <mp_init+0xf6>
+	return (void *)(pa + KERNBASE);
+f0107bd7:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+f0107bdd:	89 de                	mov    %ebx,%esi
+	if (memcmp(conf, "PCMP", 4) != 0) {
+f0107bdf:	83 ec 04             	sub    $0x4,%esp
+f0107be2:	6a 04                	push   $0x4
+f0107be4:	68 1e a4 10 f0       	push   $0xf010a41e
+f0107be9:	53                   	push   %ebx
+f0107bea:	e8 4d fc ff ff       	call   f010783c <memcmp>
+f0107bef:	83 c4 10             	add    $0x10,%esp
+f0107bf2:	85 c0                	test   %eax,%eax
+f0107bf4:	75 72                	jne    f0107c68 <mp_init+0x10b>
+	for (i = 0; i < len; i++)
+f0107bf6:	0f b7 7b 04          	movzwl 0x4(%ebx),%edi
+f0107bfa:	01 df                	add    %ebx,%edi
+	sum = 0;
+f0107bfc:	89 c2                	mov    %eax,%edx
+	for (i = 0; i < len; i++)
+f0107bfe:	e9 82 00 00 00       	jmp    f0107c85 <mp_init+0x128>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0107c03:	68 00 04 00 00       	push   $0x400
+f0107c08:	68 e4 85 10 f0       	push   $0xf01085e4
+f0107c0d:	6a 6f                	push   $0x6f
+f0107c0f:	68 09 a4 10 f0       	push   $0xf010a409
+f0107c14:	e8 27 84 ff ff       	call   f0100040 <_panic>
+		p = *(uint16_t *) (bda + 0x13) * 1024;
+f0107c19:	0f b7 05 13 04 00 f0 	movzwl 0xf0000413,%eax
+f0107c20:	c1 e0 0a             	shl    $0xa,%eax
+		if ((mp = mpsearch1(p - 1024, 1024)))
+f0107c23:	2d 00 04 00 00       	sub    $0x400,%eax
+f0107c28:	ba 00 04 00 00       	mov    $0x400,%edx
+f0107c2d:	e8 89 fe ff ff       	call   f0107abb <mpsearch1>
+f0107c32:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0107c35:	85 c0                	test   %eax,%eax
+f0107c37:	75 81                	jne    f0107bba <mp_init+0x5d>
+f0107c39:	e9 62 ff ff ff       	jmp    f0107ba0 <mp_init+0x43>
+		cprintf("SMP: Default configurations not implemented\n");
+f0107c3e:	83 ec 0c             	sub    $0xc,%esp
+f0107c41:	68 7c a2 10 f0       	push   $0xf010a27c
+f0107c46:	e8 9f c8 ff ff       	call   f01044ea <cprintf>
+		return NULL;
+f0107c4b:	83 c4 10             	add    $0x10,%esp
+f0107c4e:	e9 87 01 00 00       	jmp    f0107dda <mp_init+0x27d>
+f0107c53:	53                   	push   %ebx
+f0107c54:	68 e4 85 10 f0       	push   $0xf01085e4
+f0107c59:	68 90 00 00 00       	push   $0x90
+f0107c5e:	68 09 a4 10 f0       	push   $0xf010a409
+f0107c63:	e8 d8 83 ff ff       	call   f0100040 <_panic>
+		cprintf("SMP: Incorrect MP configuration table signature\n");
+f0107c68:	83 ec 0c             	sub    $0xc,%esp
+f0107c6b:	68 ac a2 10 f0       	push   $0xf010a2ac
+f0107c70:	e8 75 c8 ff ff       	call   f01044ea <cprintf>
+		return NULL;
+f0107c75:	83 c4 10             	add    $0x10,%esp
+f0107c78:	e9 5d 01 00 00       	jmp    f0107dda <mp_init+0x27d>
+		sum += ((uint8_t *)addr)[i];
+f0107c7d:	0f b6 0b             	movzbl (%ebx),%ecx
+f0107c80:	01 ca                	add    %ecx,%edx
+	for (i = 0; i < len; i++)
+f0107c82:	83 c3 01             	add    $0x1,%ebx
+f0107c85:	39 fb                	cmp    %edi,%ebx
+f0107c87:	75 f4                	jne    f0107c7d <mp_init+0x120>
+	if (sum(conf, conf->length) != 0) {
+f0107c89:	84 d2                	test   %dl,%dl
+f0107c8b:	75 16                	jne    f0107ca3 <mp_init+0x146>
+	if (conf->version != 1 && conf->version != 4) {
+f0107c8d:	0f b6 56 06          	movzbl 0x6(%esi),%edx
+f0107c91:	80 fa 01             	cmp    $0x1,%dl
+f0107c94:	74 05                	je     f0107c9b <mp_init+0x13e>
+f0107c96:	80 fa 04             	cmp    $0x4,%dl
+f0107c99:	75 1d                	jne    f0107cb8 <mp_init+0x15b>
+	for (i = 0; i < len; i++)
+f0107c9b:	0f b7 4e 28          	movzwl 0x28(%esi),%ecx
+f0107c9f:	01 d9                	add    %ebx,%ecx
+f0107ca1:	eb 36                	jmp    f0107cd9 <mp_init+0x17c>
+		cprintf("SMP: Bad MP configuration checksum\n");
+f0107ca3:	83 ec 0c             	sub    $0xc,%esp
+f0107ca6:	68 e0 a2 10 f0       	push   $0xf010a2e0
+f0107cab:	e8 3a c8 ff ff       	call   f01044ea <cprintf>
+		return NULL;
+f0107cb0:	83 c4 10             	add    $0x10,%esp
+f0107cb3:	e9 22 01 00 00       	jmp    f0107dda <mp_init+0x27d>
+		cprintf("SMP: Unsupported MP version %d\n", conf->version);
+f0107cb8:	83 ec 08             	sub    $0x8,%esp
+f0107cbb:	0f b6 d2             	movzbl %dl,%edx
+f0107cbe:	52                   	push   %edx
+f0107cbf:	68 04 a3 10 f0       	push   $0xf010a304
+f0107cc4:	e8 21 c8 ff ff       	call   f01044ea <cprintf>
+		return NULL;
+f0107cc9:	83 c4 10             	add    $0x10,%esp
+f0107ccc:	e9 09 01 00 00       	jmp    f0107dda <mp_init+0x27d>
+		sum += ((uint8_t *)addr)[i];
+f0107cd1:	0f b6 13             	movzbl (%ebx),%edx
+f0107cd4:	01 d0                	add    %edx,%eax
+	for (i = 0; i < len; i++)
+f0107cd6:	83 c3 01             	add    $0x1,%ebx
+f0107cd9:	39 d9                	cmp    %ebx,%ecx
+f0107cdb:	75 f4                	jne    f0107cd1 <mp_init+0x174>
+	if (sum((uint8_t *)conf + conf->length, conf->xlength) != conf->xchecksum) {
+f0107cdd:	38 46 2a             	cmp    %al,0x2a(%esi)
+f0107ce0:	75 1c                	jne    f0107cfe <mp_init+0x1a1>
+	if ((conf = mpconfig(&mp)) == 0)
+		return;
+	ismp = 1;
+f0107ce2:	c7 05 00 b0 85 f0 01 	movl   $0x1,0xf085b000
+f0107ce9:	00 00 00 
+	lapicaddr = conf->lapicaddr;
+f0107cec:	8b 46 24             	mov    0x24(%esi),%eax
+f0107cef:	a3 00 c0 89 f0       	mov    %eax,0xf089c000
+
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f0107cf4:	8d 7e 2c             	lea    0x2c(%esi),%edi
+f0107cf7:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0107cfc:	eb 4d                	jmp    f0107d4b <mp_init+0x1ee>
+		cprintf("SMP: Bad MP configuration extended checksum\n");
+f0107cfe:	83 ec 0c             	sub    $0xc,%esp
+f0107d01:	68 24 a3 10 f0       	push   $0xf010a324
+f0107d06:	e8 df c7 ff ff       	call   f01044ea <cprintf>
+		return NULL;
+f0107d0b:	83 c4 10             	add    $0x10,%esp
+f0107d0e:	e9 c7 00 00 00       	jmp    f0107dda <mp_init+0x27d>
+		switch (*p) {
+		case MPPROC:
+			proc = (struct mpproc *)p;
+			if (proc->flags & MPPROC_BOOT)
+f0107d13:	f6 47 03 02          	testb  $0x2,0x3(%edi)
+f0107d17:	74 11                	je     f0107d2a <mp_init+0x1cd>
+				bootcpu = &cpus[ncpu];
+f0107d19:	6b 05 c4 b3 85 f0 74 	imul   $0x74,0xf085b3c4,%eax
+f0107d20:	05 20 b0 85 f0       	add    $0xf085b020,%eax
+f0107d25:	a3 c0 b3 85 f0       	mov    %eax,0xf085b3c0
+			if (ncpu < NCPU) {
+f0107d2a:	a1 c4 b3 85 f0       	mov    0xf085b3c4,%eax
+f0107d2f:	83 f8 07             	cmp    $0x7,%eax
+f0107d32:	7f 33                	jg     f0107d67 <mp_init+0x20a>
+				cpus[ncpu].cpu_id = ncpu;
+f0107d34:	6b d0 74             	imul   $0x74,%eax,%edx
+f0107d37:	88 82 20 b0 85 f0    	mov    %al,-0xf7a4fe0(%edx)
+				ncpu++;
+f0107d3d:	83 c0 01             	add    $0x1,%eax
+f0107d40:	a3 c4 b3 85 f0       	mov    %eax,0xf085b3c4
+			} else {
+				cprintf("SMP: too many CPUs, CPU %d disabled\n",
+					proc->apicid);
+			}
+			p += sizeof(struct mpproc);
+f0107d45:	83 c7 14             	add    $0x14,%edi
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f0107d48:	83 c3 01             	add    $0x1,%ebx
+f0107d4b:	0f b7 46 22          	movzwl 0x22(%esi),%eax
+f0107d4f:	39 c3                	cmp    %eax,%ebx
+f0107d51:	73 4f                	jae    f0107da2 <mp_init+0x245>
+		switch (*p) {
+f0107d53:	0f b6 07             	movzbl (%edi),%eax
+f0107d56:	84 c0                	test   %al,%al
+f0107d58:	74 b9                	je     f0107d13 <mp_init+0x1b6>
+f0107d5a:	8d 50 ff             	lea    -0x1(%eax),%edx
+f0107d5d:	80 fa 03             	cmp    $0x3,%dl
+f0107d60:	77 1c                	ja     f0107d7e <mp_init+0x221>
+			continue;
+		case MPBUS:
+		case MPIOAPIC:
+		case MPIOINTR:
+		case MPLINTR:
+			p += 8;
+f0107d62:	83 c7 08             	add    $0x8,%edi
+			continue;
+f0107d65:	eb e1                	jmp    f0107d48 <mp_init+0x1eb>
+				cprintf("SMP: too many CPUs, CPU %d disabled\n",
+f0107d67:	83 ec 08             	sub    $0x8,%esp
+f0107d6a:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+f0107d6e:	50                   	push   %eax
+f0107d6f:	68 54 a3 10 f0       	push   $0xf010a354
+f0107d74:	e8 71 c7 ff ff       	call   f01044ea <cprintf>
+f0107d79:	83 c4 10             	add    $0x10,%esp
+f0107d7c:	eb c7                	jmp    f0107d45 <mp_init+0x1e8>
+		default:
+			cprintf("mpinit: unknown config type %x\n", *p);
+f0107d7e:	83 ec 08             	sub    $0x8,%esp
+		switch (*p) {
+f0107d81:	0f b6 c0             	movzbl %al,%eax
+			cprintf("mpinit: unknown config type %x\n", *p);
+f0107d84:	50                   	push   %eax
+f0107d85:	68 7c a3 10 f0       	push   $0xf010a37c
+f0107d8a:	e8 5b c7 ff ff       	call   f01044ea <cprintf>
+			ismp = 0;
+f0107d8f:	c7 05 00 b0 85 f0 00 	movl   $0x0,0xf085b000
+f0107d96:	00 00 00 
+			i = conf->entry;
+f0107d99:	0f b7 5e 22          	movzwl 0x22(%esi),%ebx
+f0107d9d:	83 c4 10             	add    $0x10,%esp
+f0107da0:	eb a6                	jmp    f0107d48 <mp_init+0x1eb>
+		}
+	}
+
+	bootcpu->cpu_status = CPU_STARTED;
+f0107da2:	a1 c0 b3 85 f0       	mov    0xf085b3c0,%eax
+f0107da7:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	if (!ismp) {
+f0107dae:	83 3d 00 b0 85 f0 00 	cmpl   $0x0,0xf085b000
+f0107db5:	74 2b                	je     f0107de2 <mp_init+0x285>
+		ncpu = 1;
+		lapicaddr = 0;
+		cprintf("SMP: configuration not found, SMP disabled\n");
+		return;
+	}
+	cprintf("SMP: CPU %d found %d CPU(s)\n", bootcpu->cpu_id,  ncpu);
+f0107db7:	83 ec 04             	sub    $0x4,%esp
+f0107dba:	ff 35 c4 b3 85 f0    	push   0xf085b3c4
+f0107dc0:	0f b6 00             	movzbl (%eax),%eax
+f0107dc3:	50                   	push   %eax
+f0107dc4:	68 23 a4 10 f0       	push   $0xf010a423
+f0107dc9:	e8 1c c7 ff ff       	call   f01044ea <cprintf>
+
+	if (mp->imcrp) {
+f0107dce:	83 c4 10             	add    $0x10,%esp
+f0107dd1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0107dd4:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+f0107dd8:	75 2e                	jne    f0107e08 <mp_init+0x2ab>
+		// switch to getting interrupts from the LAPIC.
+		cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+		outb(0x22, 0x70);   // Select IMCR
+		outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+	}
+}
+f0107dda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107ddd:	5b                   	pop    %ebx
+f0107dde:	5e                   	pop    %esi
+f0107ddf:	5f                   	pop    %edi
+f0107de0:	5d                   	pop    %ebp
+f0107de1:	c3                   	ret
+		ncpu = 1;
+f0107de2:	c7 05 c4 b3 85 f0 01 	movl   $0x1,0xf085b3c4
+f0107de9:	00 00 00 
+		lapicaddr = 0;
+f0107dec:	c7 05 00 c0 89 f0 00 	movl   $0x0,0xf089c000
+f0107df3:	00 00 00 
+		cprintf("SMP: configuration not found, SMP disabled\n");
+f0107df6:	83 ec 0c             	sub    $0xc,%esp
+f0107df9:	68 9c a3 10 f0       	push   $0xf010a39c
+f0107dfe:	e8 e7 c6 ff ff       	call   f01044ea <cprintf>
+		return;
+f0107e03:	83 c4 10             	add    $0x10,%esp
+f0107e06:	eb d2                	jmp    f0107dda <mp_init+0x27d>
+		cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+f0107e08:	83 ec 0c             	sub    $0xc,%esp
+f0107e0b:	68 c8 a3 10 f0       	push   $0xf010a3c8
+f0107e10:	e8 d5 c6 ff ff       	call   f01044ea <cprintf>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0107e15:	b8 70 00 00 00       	mov    $0x70,%eax
+f0107e1a:	ba 22 00 00 00       	mov    $0x22,%edx
+f0107e1f:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0107e20:	ba 23 00 00 00       	mov    $0x23,%edx
+f0107e25:	ec                   	in     (%dx),%al
+		outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+f0107e26:	83 c8 01             	or     $0x1,%eax
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0107e29:	ee                   	out    %al,(%dx)
+}
+f0107e2a:	83 c4 10             	add    $0x10,%esp
+f0107e2d:	eb ab                	jmp    f0107dda <mp_init+0x27d>
+
+f0107e2f <lapicw>:
+volatile uint32_t *lapic;
+
+static void
+lapicw(int index, int value)
+{
+	lapic[index] = value;
+f0107e2f:	8b 0d 04 c0 89 f0    	mov    0xf089c004,%ecx
+f0107e35:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+f0107e38:	89 10                	mov    %edx,(%eax)
+	lapic[ID];  // wait for write to finish, by reading
+f0107e3a:	a1 04 c0 89 f0       	mov    0xf089c004,%eax
+f0107e3f:	8b 40 20             	mov    0x20(%eax),%eax
+}
+f0107e42:	c3                   	ret
+
+f0107e43 <cpunum>:
+}
+
+int
+cpunum(void)
+{
+	if (lapic)
+f0107e43:	8b 15 04 c0 89 f0    	mov    0xf089c004,%edx
+		return lapic[ID] >> 24;
+	return 0;
+f0107e49:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lapic)
+f0107e4e:	85 d2                	test   %edx,%edx
+f0107e50:	74 06                	je     f0107e58 <cpunum+0x15>
+		return lapic[ID] >> 24;
+f0107e52:	8b 42 20             	mov    0x20(%edx),%eax
+f0107e55:	c1 e8 18             	shr    $0x18,%eax
+}
+f0107e58:	c3                   	ret
+
+f0107e59 <lapic_init>:
+	if (!lapicaddr)
+f0107e59:	a1 00 c0 89 f0       	mov    0xf089c000,%eax
+f0107e5e:	85 c0                	test   %eax,%eax
+f0107e60:	75 01                	jne    f0107e63 <lapic_init+0xa>
+f0107e62:	c3                   	ret
+{
+f0107e63:	55                   	push   %ebp
+f0107e64:	89 e5                	mov    %esp,%ebp
+f0107e66:	83 ec 10             	sub    $0x10,%esp
+	lapic = mmio_map_region(lapicaddr, 4096);
+f0107e69:	68 00 10 00 00       	push   $0x1000
+f0107e6e:	50                   	push   %eax
+f0107e6f:	e8 14 b4 ff ff       	call   f0103288 <mmio_map_region>
+f0107e74:	a3 04 c0 89 f0       	mov    %eax,0xf089c004
+	lapicw(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
+f0107e79:	ba 27 01 00 00       	mov    $0x127,%edx
+f0107e7e:	b8 3c 00 00 00       	mov    $0x3c,%eax
+f0107e83:	e8 a7 ff ff ff       	call   f0107e2f <lapicw>
+	lapicw(TDCR, X1);
+f0107e88:	ba 0b 00 00 00       	mov    $0xb,%edx
+f0107e8d:	b8 f8 00 00 00       	mov    $0xf8,%eax
+f0107e92:	e8 98 ff ff ff       	call   f0107e2f <lapicw>
+	lapicw(TIMER, PERIODIC | (IRQ_OFFSET + IRQ_TIMER));
+f0107e97:	ba 20 00 02 00       	mov    $0x20020,%edx
+f0107e9c:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f0107ea1:	e8 89 ff ff ff       	call   f0107e2f <lapicw>
+	lapicw(TICR, 10000000); 
+f0107ea6:	ba 80 96 98 00       	mov    $0x989680,%edx
+f0107eab:	b8 e0 00 00 00       	mov    $0xe0,%eax
+f0107eb0:	e8 7a ff ff ff       	call   f0107e2f <lapicw>
+	if (thiscpu != bootcpu)
+f0107eb5:	e8 89 ff ff ff       	call   f0107e43 <cpunum>
+f0107eba:	6b c0 74             	imul   $0x74,%eax,%eax
+f0107ebd:	05 20 b0 85 f0       	add    $0xf085b020,%eax
+f0107ec2:	83 c4 10             	add    $0x10,%esp
+f0107ec5:	39 05 c0 b3 85 f0    	cmp    %eax,0xf085b3c0
+f0107ecb:	74 0f                	je     f0107edc <lapic_init+0x83>
+		lapicw(LINT0, MASKED);
+f0107ecd:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0107ed2:	b8 d4 00 00 00       	mov    $0xd4,%eax
+f0107ed7:	e8 53 ff ff ff       	call   f0107e2f <lapicw>
+	lapicw(LINT1, MASKED);
+f0107edc:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0107ee1:	b8 d8 00 00 00       	mov    $0xd8,%eax
+f0107ee6:	e8 44 ff ff ff       	call   f0107e2f <lapicw>
+	if (((lapic[VER]>>16) & 0xFF) >= 4)
+f0107eeb:	a1 04 c0 89 f0       	mov    0xf089c004,%eax
+f0107ef0:	8b 40 30             	mov    0x30(%eax),%eax
+f0107ef3:	c1 e8 10             	shr    $0x10,%eax
+f0107ef6:	a8 fc                	test   $0xfc,%al
+f0107ef8:	75 7c                	jne    f0107f76 <lapic_init+0x11d>
+	lapicw(ERROR, IRQ_OFFSET + IRQ_ERROR);
+f0107efa:	ba 33 00 00 00       	mov    $0x33,%edx
+f0107eff:	b8 dc 00 00 00       	mov    $0xdc,%eax
+f0107f04:	e8 26 ff ff ff       	call   f0107e2f <lapicw>
+	lapicw(ESR, 0);
+f0107f09:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107f0e:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f0107f13:	e8 17 ff ff ff       	call   f0107e2f <lapicw>
+	lapicw(ESR, 0);
+f0107f18:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107f1d:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f0107f22:	e8 08 ff ff ff       	call   f0107e2f <lapicw>
+	lapicw(EOI, 0);
+f0107f27:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107f2c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f0107f31:	e8 f9 fe ff ff       	call   f0107e2f <lapicw>
+	lapicw(ICRHI, 0);
+f0107f36:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107f3b:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0107f40:	e8 ea fe ff ff       	call   f0107e2f <lapicw>
+	lapicw(ICRLO, BCAST | INIT | LEVEL);
+f0107f45:	ba 00 85 08 00       	mov    $0x88500,%edx
+f0107f4a:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0107f4f:	e8 db fe ff ff       	call   f0107e2f <lapicw>
+	while(lapic[ICRLO] & DELIVS)
+f0107f54:	8b 15 04 c0 89 f0    	mov    0xf089c004,%edx
+f0107f5a:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f0107f60:	f6 c4 10             	test   $0x10,%ah
+f0107f63:	75 f5                	jne    f0107f5a <lapic_init+0x101>
+	lapicw(TPR, 0);
+f0107f65:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107f6a:	b8 20 00 00 00       	mov    $0x20,%eax
+f0107f6f:	e8 bb fe ff ff       	call   f0107e2f <lapicw>
+}
+f0107f74:	c9                   	leave
+f0107f75:	c3                   	ret
+		lapicw(PCINT, MASKED);
+f0107f76:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0107f7b:	b8 d0 00 00 00       	mov    $0xd0,%eax
+f0107f80:	e8 aa fe ff ff       	call   f0107e2f <lapicw>
+f0107f85:	e9 70 ff ff ff       	jmp    f0107efa <lapic_init+0xa1>
+
+f0107f8a <lapic_eoi>:
+
+// Acknowledge interrupt.
+void
+lapic_eoi(void)
+{
+	if (lapic)
+f0107f8a:	83 3d 04 c0 89 f0 00 	cmpl   $0x0,0xf089c004
+f0107f91:	74 17                	je     f0107faa <lapic_eoi+0x20>
+{
+f0107f93:	55                   	push   %ebp
+f0107f94:	89 e5                	mov    %esp,%ebp
+f0107f96:	83 ec 08             	sub    $0x8,%esp
+		lapicw(EOI, 0);
+f0107f99:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107f9e:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f0107fa3:	e8 87 fe ff ff       	call   f0107e2f <lapicw>
+}
+f0107fa8:	c9                   	leave
+f0107fa9:	c3                   	ret
+f0107faa:	c3                   	ret
+
+f0107fab <lapic_startap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapic_startap(uint8_t apicid, uint32_t addr)
+{
+f0107fab:	55                   	push   %ebp
+f0107fac:	89 e5                	mov    %esp,%ebp
+f0107fae:	56                   	push   %esi
+f0107faf:	53                   	push   %ebx
+f0107fb0:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107fb3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0107fb6:	b8 0f 00 00 00       	mov    $0xf,%eax
+f0107fbb:	ba 70 00 00 00       	mov    $0x70,%edx
+f0107fc0:	ee                   	out    %al,(%dx)
+f0107fc1:	b8 0a 00 00 00       	mov    $0xa,%eax
+f0107fc6:	ba 71 00 00 00       	mov    $0x71,%edx
+f0107fcb:	ee                   	out    %al,(%dx)
+	if (PGNUM(pa) >= npages)
+f0107fcc:	83 3d 54 a0 85 f0 00 	cmpl   $0x0,0xf085a054
+f0107fd3:	74 7e                	je     f0108053 <lapic_startap+0xa8>
+	// and the warm reset vector (DWORD based at 40:67) to point at
+	// the AP startup code prior to the [universal startup algorithm]."
+	outb(IO_RTC, 0xF);  // offset 0xF is shutdown code
+	outb(IO_RTC+1, 0x0A);
+	wrv = (uint16_t *)KADDR((0x40 << 4 | 0x67));  // Warm reset vector
+	wrv[0] = 0;
+f0107fd5:	66 c7 05 67 04 00 f0 	movw   $0x0,0xf0000467
+f0107fdc:	00 00 
+	wrv[1] = addr >> 4;
+f0107fde:	89 d8                	mov    %ebx,%eax
+f0107fe0:	c1 e8 04             	shr    $0x4,%eax
+f0107fe3:	66 a3 69 04 00 f0    	mov    %ax,0xf0000469
+
+	// "Universal startup algorithm."
+	// Send INIT (level-triggered) interrupt to reset other CPU.
+	lapicw(ICRHI, apicid << 24);
+f0107fe9:	c1 e6 18             	shl    $0x18,%esi
+f0107fec:	89 f2                	mov    %esi,%edx
+f0107fee:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0107ff3:	e8 37 fe ff ff       	call   f0107e2f <lapicw>
+	lapicw(ICRLO, INIT | LEVEL | ASSERT);
+f0107ff8:	ba 00 c5 00 00       	mov    $0xc500,%edx
+f0107ffd:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0108002:	e8 28 fe ff ff       	call   f0107e2f <lapicw>
+	microdelay(200);
+	lapicw(ICRLO, INIT | LEVEL);
+f0108007:	ba 00 85 00 00       	mov    $0x8500,%edx
+f010800c:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0108011:	e8 19 fe ff ff       	call   f0107e2f <lapicw>
+	// when it is in the halted state due to an INIT.  So the second
+	// should be ignored, but it is part of the official Intel algorithm.
+	// Bochs complains about the second one.  Too bad for Bochs.
+	for (i = 0; i < 2; i++) {
+		lapicw(ICRHI, apicid << 24);
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f0108016:	c1 eb 0c             	shr    $0xc,%ebx
+f0108019:	80 cf 06             	or     $0x6,%bh
+		lapicw(ICRHI, apicid << 24);
+f010801c:	89 f2                	mov    %esi,%edx
+f010801e:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0108023:	e8 07 fe ff ff       	call   f0107e2f <lapicw>
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f0108028:	89 da                	mov    %ebx,%edx
+f010802a:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010802f:	e8 fb fd ff ff       	call   f0107e2f <lapicw>
+		lapicw(ICRHI, apicid << 24);
+f0108034:	89 f2                	mov    %esi,%edx
+f0108036:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f010803b:	e8 ef fd ff ff       	call   f0107e2f <lapicw>
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f0108040:	89 da                	mov    %ebx,%edx
+f0108042:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0108047:	e8 e3 fd ff ff       	call   f0107e2f <lapicw>
+		microdelay(200);
+	}
+}
+f010804c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010804f:	5b                   	pop    %ebx
+f0108050:	5e                   	pop    %esi
+f0108051:	5d                   	pop    %ebp
+f0108052:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0108053:	68 67 04 00 00       	push   $0x467
+f0108058:	68 e4 85 10 f0       	push   $0xf01085e4
+f010805d:	68 98 00 00 00       	push   $0x98
+f0108062:	68 40 a4 10 f0       	push   $0xf010a440
+f0108067:	e8 d4 7f ff ff       	call   f0100040 <_panic>
+
+f010806c <lapic_ipi>:
+
+void
+lapic_ipi(int vector)
+{
+f010806c:	55                   	push   %ebp
+f010806d:	89 e5                	mov    %esp,%ebp
+f010806f:	83 ec 08             	sub    $0x8,%esp
+	lapicw(ICRLO, OTHERS | FIXED | vector);
+f0108072:	8b 55 08             	mov    0x8(%ebp),%edx
+f0108075:	81 ca 00 00 0c 00    	or     $0xc0000,%edx
+f010807b:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0108080:	e8 aa fd ff ff       	call   f0107e2f <lapicw>
+	while (lapic[ICRLO] & DELIVS)
+f0108085:	8b 15 04 c0 89 f0    	mov    0xf089c004,%edx
+f010808b:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f0108091:	f6 c4 10             	test   $0x10,%ah
+f0108094:	75 f5                	jne    f010808b <lapic_ipi+0x1f>
+		;
+}
+f0108096:	c9                   	leave
+f0108097:	c3                   	ret
+
+f0108098 <__spin_initlock>:
+}
+#endif
+
+void
+__spin_initlock(struct spinlock *lk, char *name)
+{
+f0108098:	55                   	push   %ebp
+f0108099:	89 e5                	mov    %esp,%ebp
+f010809b:	8b 45 08             	mov    0x8(%ebp),%eax
+	lk->locked = 0;
+f010809e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+#ifdef DEBUG_SPINLOCK
+	lk->name = name;
+f01080a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+f01080a7:	89 50 04             	mov    %edx,0x4(%eax)
+	lk->cpu = 0;
+f01080aa:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+#endif
+}
+f01080b1:	5d                   	pop    %ebp
+f01080b2:	c3                   	ret
+
+f01080b3 <spin_lock>:
+// Loops (spins) until the lock is acquired.
+// Holding a lock for a long time may cause
+// other CPUs to waste time spinning to acquire it.
+void
+spin_lock(struct spinlock *lk)
+{
+f01080b3:	55                   	push   %ebp
+f01080b4:	89 e5                	mov    %esp,%ebp
+f01080b6:	56                   	push   %esi
+f01080b7:	53                   	push   %ebx
+f01080b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	return lock->locked && lock->cpu == thiscpu;
+f01080bb:	83 3b 00             	cmpl   $0x0,(%ebx)
+f01080be:	75 07                	jne    f01080c7 <spin_lock+0x14>
+	asm volatile("lock; xchgl %0, %1" :
+f01080c0:	ba 01 00 00 00       	mov    $0x1,%edx
+f01080c5:	eb 34                	jmp    f01080fb <spin_lock+0x48>
+f01080c7:	8b 73 08             	mov    0x8(%ebx),%esi
+f01080ca:	e8 74 fd ff ff       	call   f0107e43 <cpunum>
+f01080cf:	6b c0 74             	imul   $0x74,%eax,%eax
+f01080d2:	05 20 b0 85 f0       	add    $0xf085b020,%eax
+#ifdef DEBUG_SPINLOCK
+	if (holding(lk))
+f01080d7:	39 c6                	cmp    %eax,%esi
+f01080d9:	75 e5                	jne    f01080c0 <spin_lock+0xd>
+		panic("CPU %d cannot acquire %s: already holding", cpunum(), lk->name);
+f01080db:	8b 5b 04             	mov    0x4(%ebx),%ebx
+f01080de:	e8 60 fd ff ff       	call   f0107e43 <cpunum>
+f01080e3:	83 ec 0c             	sub    $0xc,%esp
+f01080e6:	53                   	push   %ebx
+f01080e7:	50                   	push   %eax
+f01080e8:	68 50 a4 10 f0       	push   $0xf010a450
+f01080ed:	6a 41                	push   $0x41
+f01080ef:	68 b2 a4 10 f0       	push   $0xf010a4b2
+f01080f4:	e8 47 7f ff ff       	call   f0100040 <_panic>
+
+	// The xchg is atomic.
+	// It also serializes, so that reads after acquire are not
+	// reordered before it. 
+	while (xchg(&lk->locked, 1) != 0)
+		asm volatile ("pause");
+f01080f9:	f3 90                	pause
+f01080fb:	89 d0                	mov    %edx,%eax
+f01080fd:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&lk->locked, 1) != 0)
+f0108100:	85 c0                	test   %eax,%eax
+f0108102:	75 f5                	jne    f01080f9 <spin_lock+0x46>
+
+	// Record info about lock acquisition for debugging.
+#ifdef DEBUG_SPINLOCK
+	lk->cpu = thiscpu;
+f0108104:	e8 3a fd ff ff       	call   f0107e43 <cpunum>
+f0108109:	6b c0 74             	imul   $0x74,%eax,%eax
+f010810c:	05 20 b0 85 f0       	add    $0xf085b020,%eax
+f0108111:	89 43 08             	mov    %eax,0x8(%ebx)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+f0108114:	89 ea                	mov    %ebp,%edx
+	for (i = 0; i < 10; i++){
+f0108116:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (ebp == 0 || ebp < (uint32_t *)ULIM)
+f010811b:	83 f8 09             	cmp    $0x9,%eax
+f010811e:	7f 21                	jg     f0108141 <spin_lock+0x8e>
+f0108120:	81 fa ff ff 7f ef    	cmp    $0xef7fffff,%edx
+f0108126:	76 19                	jbe    f0108141 <spin_lock+0x8e>
+		pcs[i] = ebp[1];          // saved %eip
+f0108128:	8b 4a 04             	mov    0x4(%edx),%ecx
+f010812b:	89 4c 83 0c          	mov    %ecx,0xc(%ebx,%eax,4)
+		ebp = (uint32_t *)ebp[0]; // saved %ebp
+f010812f:	8b 12                	mov    (%edx),%edx
+	for (i = 0; i < 10; i++){
+f0108131:	83 c0 01             	add    $0x1,%eax
+f0108134:	eb e5                	jmp    f010811b <spin_lock+0x68>
+		pcs[i] = 0;
+f0108136:	c7 44 83 0c 00 00 00 	movl   $0x0,0xc(%ebx,%eax,4)
+f010813d:	00 
+	for (; i < 10; i++)
+f010813e:	83 c0 01             	add    $0x1,%eax
+f0108141:	83 f8 09             	cmp    $0x9,%eax
+f0108144:	7e f0                	jle    f0108136 <spin_lock+0x83>
+	get_caller_pcs(lk->pcs);
+#endif
+}
+f0108146:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0108149:	5b                   	pop    %ebx
+f010814a:	5e                   	pop    %esi
+f010814b:	5d                   	pop    %ebp
+f010814c:	c3                   	ret
+
+f010814d <spin_unlock>:
+
+// Release the lock.
+void
+spin_unlock(struct spinlock *lk)
+{
+f010814d:	55                   	push   %ebp
+f010814e:	89 e5                	mov    %esp,%ebp
+f0108150:	57                   	push   %edi
+f0108151:	56                   	push   %esi
+f0108152:	53                   	push   %ebx
+f0108153:	83 ec 5c             	sub    $0x5c,%esp
+f0108156:	8b 75 08             	mov    0x8(%ebp),%esi
+	return lock->locked && lock->cpu == thiscpu;
+f0108159:	83 3e 00             	cmpl   $0x0,(%esi)
+f010815c:	75 38                	jne    f0108196 <spin_unlock+0x49>
+#ifdef DEBUG_SPINLOCK
+	if (!holding(lk)) {
+		int i;
+		uint32_t pcs[10];
+		// Nab the acquiring EIP chain before it gets released
+		memmove(pcs, lk->pcs, sizeof pcs);
+f010815e:	83 ec 04             	sub    $0x4,%esp
+f0108161:	6a 28                	push   $0x28
+f0108163:	8d 46 0c             	lea    0xc(%esi),%eax
+f0108166:	50                   	push   %eax
+f0108167:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+f010816a:	53                   	push   %ebx
+f010816b:	e8 54 f6 ff ff       	call   f01077c4 <memmove>
+		cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:", 
+			cpunum(), lk->name, lk->cpu->cpu_id);
+f0108170:	8b 46 08             	mov    0x8(%esi),%eax
+		cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:", 
+f0108173:	0f b6 38             	movzbl (%eax),%edi
+f0108176:	8b 76 04             	mov    0x4(%esi),%esi
+f0108179:	e8 c5 fc ff ff       	call   f0107e43 <cpunum>
+f010817e:	57                   	push   %edi
+f010817f:	56                   	push   %esi
+f0108180:	50                   	push   %eax
+f0108181:	68 7c a4 10 f0       	push   $0xf010a47c
+f0108186:	e8 5f c3 ff ff       	call   f01044ea <cprintf>
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f010818b:	8d 7d e8             	lea    -0x18(%ebp),%edi
+f010818e:	83 c4 20             	add    $0x20,%esp
+			struct Eipdebuginfo info;
+			if (debuginfo_eip(pcs[i], &info) >= 0)
+f0108191:	8d 75 a8             	lea    -0x58(%ebp),%esi
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f0108194:	eb 4a                	jmp    f01081e0 <spin_unlock+0x93>
+	return lock->locked && lock->cpu == thiscpu;
+f0108196:	8b 5e 08             	mov    0x8(%esi),%ebx
+f0108199:	e8 a5 fc ff ff       	call   f0107e43 <cpunum>
+f010819e:	6b c0 74             	imul   $0x74,%eax,%eax
+f01081a1:	05 20 b0 85 f0       	add    $0xf085b020,%eax
+	if (!holding(lk)) {
+f01081a6:	39 c3                	cmp    %eax,%ebx
+f01081a8:	75 b4                	jne    f010815e <spin_unlock+0x11>
+				cprintf("  %08x\n", pcs[i]);
+		}
+		panic("spin_unlock");
+	}
+
+	lk->pcs[0] = 0;
+f01081aa:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+	lk->cpu = 0;
+f01081b1:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+	asm volatile("lock; xchgl %0, %1" :
+f01081b8:	b8 00 00 00 00       	mov    $0x0,%eax
+f01081bd:	f0 87 06             	lock xchg %eax,(%esi)
+	// Paper says that Intel 64 and IA-32 will not move a load
+	// after a store. So lock->locked = 0 would work here.
+	// The xchg being asm volatile ensures gcc emits it after
+	// the above assignments (and after the critical section).
+	xchg(&lk->locked, 0);
+}
+f01081c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01081c3:	5b                   	pop    %ebx
+f01081c4:	5e                   	pop    %esi
+f01081c5:	5f                   	pop    %edi
+f01081c6:	5d                   	pop    %ebp
+f01081c7:	c3                   	ret
+				cprintf("  %08x\n", pcs[i]);
+f01081c8:	83 ec 08             	sub    $0x8,%esp
+f01081cb:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f01081ce:	ff 30                	push   (%eax)
+f01081d0:	68 d9 a4 10 f0       	push   $0xf010a4d9
+f01081d5:	e8 10 c3 ff ff       	call   f01044ea <cprintf>
+f01081da:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f01081dd:	83 c3 04             	add    $0x4,%ebx
+f01081e0:	39 fb                	cmp    %edi,%ebx
+f01081e2:	74 44                	je     f0108228 <spin_unlock+0xdb>
+f01081e4:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+f01081e7:	8b 03                	mov    (%ebx),%eax
+f01081e9:	85 c0                	test   %eax,%eax
+f01081eb:	74 3b                	je     f0108228 <spin_unlock+0xdb>
+			if (debuginfo_eip(pcs[i], &info) >= 0)
+f01081ed:	83 ec 08             	sub    $0x8,%esp
+f01081f0:	56                   	push   %esi
+f01081f1:	50                   	push   %eax
+f01081f2:	e8 ab ea ff ff       	call   f0106ca2 <debuginfo_eip>
+f01081f7:	83 c4 10             	add    $0x10,%esp
+f01081fa:	85 c0                	test   %eax,%eax
+f01081fc:	78 ca                	js     f01081c8 <spin_unlock+0x7b>
+					pcs[i] - info.eip_fn_addr);
+f01081fe:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f0108201:	8b 00                	mov    (%eax),%eax
+				cprintf("  %08x %s:%d: %.*s+%x\n", pcs[i],
+f0108203:	83 ec 04             	sub    $0x4,%esp
+f0108206:	89 c2                	mov    %eax,%edx
+f0108208:	2b 55 b8             	sub    -0x48(%ebp),%edx
+f010820b:	52                   	push   %edx
+f010820c:	ff 75 b0             	push   -0x50(%ebp)
+f010820f:	ff 75 b4             	push   -0x4c(%ebp)
+f0108212:	ff 75 ac             	push   -0x54(%ebp)
+f0108215:	ff 75 a8             	push   -0x58(%ebp)
+f0108218:	50                   	push   %eax
+f0108219:	68 c2 a4 10 f0       	push   $0xf010a4c2
+f010821e:	e8 c7 c2 ff ff       	call   f01044ea <cprintf>
+f0108223:	83 c4 20             	add    $0x20,%esp
+f0108226:	eb b5                	jmp    f01081dd <spin_unlock+0x90>
+		panic("spin_unlock");
+f0108228:	83 ec 04             	sub    $0x4,%esp
+f010822b:	68 e1 a4 10 f0       	push   $0xf010a4e1
+f0108230:	6a 67                	push   $0x67
+f0108232:	68 b2 a4 10 f0       	push   $0xf010a4b2
+f0108237:	e8 04 7e ff ff       	call   f0100040 <_panic>
+
+f010823c <alloc_pte_chain_page>:
+static struct PteChain* free_pte_chain = NULL;
+
+// Utility function to allocate a page-worth of PteChain structs
+int
+alloc_pte_chain_page()
+{
+f010823c:	55                   	push   %ebp
+f010823d:	89 e5                	mov    %esp,%ebp
+f010823f:	57                   	push   %edi
+f0108240:	56                   	push   %esi
+f0108241:	53                   	push   %ebx
+f0108242:	83 ec 18             	sub    $0x18,%esp
+	int i;
+
+	// Allocate a page worth of PteChain structs
+	struct PageInfo* pp = page_alloc(ALLOC_ZERO);
+f0108245:	6a 01                	push   $0x1
+f0108247:	e8 a4 94 ff ff       	call   f01016f0 <page_alloc>
+	if (!pp)
+f010824c:	83 c4 10             	add    $0x10,%esp
+f010824f:	85 c0                	test   %eax,%eax
+f0108251:	74 14                	je     f0108267 <alloc_pte_chain_page+0x2b>
+f0108253:	89 c6                	mov    %eax,%esi
+f0108255:	8b 1d 40 a0 85 f0    	mov    0xf085a040,%ebx
+f010825b:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108260:	bf 00 00 00 00       	mov    $0x0,%edi
+f0108265:	eb 16                	jmp    f010827d <alloc_pte_chain_page+0x41>
+		panic("Unable to allocate a page for PteChain\n");
+f0108267:	83 ec 04             	sub    $0x4,%esp
+f010826a:	68 fc a4 10 f0       	push   $0xf010a4fc
+f010826f:	6a 11                	push   $0x11
+f0108271:	68 24 a5 10 f0       	push   $0xf010a524
+f0108276:	e8 c5 7d ff ff       	call   f0100040 <_panic>
+	struct PteChain* pc;
+	for (i = 0; i < num_free; i++)
+	{
+		pc = (struct PteChain*)page2kva(pp) + i;
+		pc->pc_link = free_pte_chain;
+		free_pte_chain = pc;
+f010827b:	89 c3                	mov    %eax,%ebx
+	return (pp - pages) << PGSHIFT;
+f010827d:	89 f0                	mov    %esi,%eax
+f010827f:	2b 05 60 a0 85 f0    	sub    0xf085a060,%eax
+f0108285:	c1 f8 02             	sar    $0x2,%eax
+f0108288:	69 c0 b7 6d db b6    	imul   $0xb6db6db7,%eax,%eax
+f010828e:	89 c1                	mov    %eax,%ecx
+f0108290:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0108293:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0108298:	3b 05 54 a0 85 f0    	cmp    0xf085a054,%eax
+f010829e:	73 2b                	jae    f01082cb <alloc_pte_chain_page+0x8f>
+		pc = (struct PteChain*)page2kva(pp) + i;
+f01082a0:	8d 84 0a 00 00 00 f0 	lea    -0x10000000(%edx,%ecx,1),%eax
+		pc->pc_link = free_pte_chain;
+f01082a7:	89 18                	mov    %ebx,(%eax)
+	for (i = 0; i < num_free; i++)
+f01082a9:	83 c2 10             	add    $0x10,%edx
+f01082ac:	bf 01 00 00 00       	mov    $0x1,%edi
+f01082b1:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+f01082b7:	75 c2                	jne    f010827b <alloc_pte_chain_page+0x3f>
+f01082b9:	a3 40 a0 85 f0       	mov    %eax,0xf085a040
+	}
+
+	return 0;
+}
+f01082be:	b8 00 00 00 00       	mov    $0x0,%eax
+f01082c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01082c6:	5b                   	pop    %ebx
+f01082c7:	5e                   	pop    %esi
+f01082c8:	5f                   	pop    %edi
+f01082c9:	5d                   	pop    %ebp
+f01082ca:	c3                   	ret
+f01082cb:	89 f8                	mov    %edi,%eax
+f01082cd:	84 c0                	test   %al,%al
+f01082cf:	74 06                	je     f01082d7 <alloc_pte_chain_page+0x9b>
+f01082d1:	89 1d 40 a0 85 f0    	mov    %ebx,0xf085a040
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01082d7:	51                   	push   %ecx
+f01082d8:	68 e4 85 10 f0       	push   $0xf01085e4
+f01082dd:	6a 6c                	push   $0x6c
+f01082df:	68 87 94 10 f0       	push   $0xf0109487
+f01082e4:	e8 57 7d ff ff       	call   f0100040 <_panic>
+
+f01082e9 <find_pte>:
+// Try to find a pte that references the physical page which matches
+// the given pte filter.
+// If pc_store != NULL, store the resulting PteChain in pc_store
+int
+find_pte(struct PageInfo* pp, pte_t filter, struct PteChain** pc_store)
+{
+f01082e9:	55                   	push   %ebp
+f01082ea:	89 e5                	mov    %esp,%ebp
+f01082ec:	53                   	push   %ebx
+f01082ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	struct PteChain* pc = pp->pp_refs_chain;
+f01082f0:	8b 45 08             	mov    0x8(%ebp),%eax
+f01082f3:	8b 40 18             	mov    0x18(%eax),%eax
+	while(pc != NULL)
+f01082f6:	85 c0                	test   %eax,%eax
+f01082f8:	74 1b                	je     f0108315 <find_pte+0x2c>
+	{
+		if (filter & *(pc->pc_pte))
+f01082fa:	8b 50 04             	mov    0x4(%eax),%edx
+f01082fd:	89 cb                	mov    %ecx,%ebx
+f01082ff:	23 1a                	and    (%edx),%ebx
+f0108301:	74 f3                	je     f01082f6 <find_pte+0xd>
+		{
+			if (pc_store != NULL)
+				*pc_store = pc;
+			return 1;
+f0108303:	ba 01 00 00 00       	mov    $0x1,%edx
+			if (pc_store != NULL)
+f0108308:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f010830c:	74 0c                	je     f010831a <find_pte+0x31>
+				*pc_store = pc;
+f010830e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0108311:	89 01                	mov    %eax,(%ecx)
+f0108313:	eb 05                	jmp    f010831a <find_pte+0x31>
+		}
+		       
+	}
+
+	return 0;
+f0108315:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+f010831a:	89 d0                	mov    %edx,%eax
+f010831c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010831f:	c9                   	leave
+f0108320:	c3                   	ret
+
+f0108321 <find_pte_va>:
+
+// Find the pte that maps the physical page at va in pgdir.
+// Returns NULL if there is none.
+pte_t*
+find_pte_va(struct PageInfo* pp, pde_t* pgdir, uintptr_t va)
+{
+f0108321:	55                   	push   %ebp
+f0108322:	89 e5                	mov    %esp,%ebp
+f0108324:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0108327:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	struct PteChain* pc;
+	for (pc = pp->pp_refs_chain; pc != NULL; pc = pc->pc_link)
+f010832a:	8b 45 08             	mov    0x8(%ebp),%eax
+f010832d:	8b 40 18             	mov    0x18(%eax),%eax
+f0108330:	eb 02                	jmp    f0108334 <find_pte_va+0x13>
+f0108332:	8b 00                	mov    (%eax),%eax
+f0108334:	85 c0                	test   %eax,%eax
+f0108336:	74 0d                	je     f0108345 <find_pte_va+0x24>
+	{
+		if (pc->pc_pgdir == pgdir && pc->pc_env_va == va)
+f0108338:	39 50 08             	cmp    %edx,0x8(%eax)
+f010833b:	75 f5                	jne    f0108332 <find_pte_va+0x11>
+f010833d:	39 48 0c             	cmp    %ecx,0xc(%eax)
+f0108340:	75 f0                	jne    f0108332 <find_pte_va+0x11>
+			return pc->pc_pte;
+f0108342:	8b 40 04             	mov    0x4(%eax),%eax
+	}
+
+	return NULL;
+}
+f0108345:	5d                   	pop    %ebp
+f0108346:	c3                   	ret
+
+f0108347 <init_reverse_map>:
+// we don't need to allocate the initial page for PteChains, since
+// when we call alloc_pte_chain we allocate a page if there isn't
+// one already.
+void
+init_reverse_map()
+{
+f0108347:	55                   	push   %ebp
+f0108348:	89 e5                	mov    %esp,%ebp
+f010834a:	83 ec 08             	sub    $0x8,%esp
+	// Nullify free_pte_chain initially
+	free_pte_chain = 0;
+f010834d:	c7 05 40 a0 85 f0 00 	movl   $0x0,0xf085a040
+f0108354:	00 00 00 
+	// Allocate a page worth of PteChain
+	alloc_pte_chain_page();
+f0108357:	e8 e0 fe ff ff       	call   f010823c <alloc_pte_chain_page>
+}
+f010835c:	c9                   	leave
+f010835d:	c3                   	ret
+
+f010835e <alloc_pte_chain>:
+
+// Allocate one of the free PteChain structs, possible
+// allocating a new page for more free structs.
+struct PteChain*
+alloc_pte_chain()
+{
+f010835e:	55                   	push   %ebp
+f010835f:	89 e5                	mov    %esp,%ebp
+f0108361:	83 ec 08             	sub    $0x8,%esp
+	struct PteChain* ret;
+	if (free_pte_chain == NULL)
+f0108364:	83 3d 40 a0 85 f0 00 	cmpl   $0x0,0xf085a040
+f010836b:	74 2a                	je     f0108397 <alloc_pte_chain+0x39>
+		// If there are no more PteChain structs left,
+		// alloc another page worth
+		alloc_pte_chain_page();
+	}
+
+	ret = free_pte_chain; // Pull off the head
+f010836d:	a1 40 a0 85 f0       	mov    0xf085a040,%eax
+	free_pte_chain = ret->pc_link; // Update free_pte_chain
+f0108372:	8b 10                	mov    (%eax),%edx
+f0108374:	89 15 40 a0 85 f0    	mov    %edx,0xf085a040
+	// Clear the struct
+	ret->pc_link = NULL;
+f010837a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	ret->pc_pte = NULL;
+f0108380:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	ret->pc_pgdir = NULL;
+f0108387:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+	ret->pc_env_va = 0;
+f010838e:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+
+	return ret;
+}
+f0108395:	c9                   	leave
+f0108396:	c3                   	ret
+		alloc_pte_chain_page();
+f0108397:	e8 a0 fe ff ff       	call   f010823c <alloc_pte_chain_page>
+f010839c:	eb cf                	jmp    f010836d <alloc_pte_chain+0xf>
+
+f010839e <dealloc_pte_chain>:
+
+// Dealloc a PteChain struct (adds it to the free_pte_chain
+// linked list).
+void
+dealloc_pte_chain(struct PteChain* pc)
+{
+f010839e:	55                   	push   %ebp
+f010839f:	89 e5                	mov    %esp,%ebp
+f01083a1:	8b 45 08             	mov    0x8(%ebp),%eax
+	pc->pc_link = free_pte_chain;
+f01083a4:	8b 15 40 a0 85 f0    	mov    0xf085a040,%edx
+f01083aa:	89 10                	mov    %edx,(%eax)
+	free_pte_chain = pc;
+f01083ac:	a3 40 a0 85 f0       	mov    %eax,0xf085a040
+}
+f01083b1:	5d                   	pop    %ebp
+f01083b2:	c3                   	ret
+
+f01083b3 <udivmod>:
+f01083b3:	55                   	push   %ebp
+f01083b4:	57                   	push   %edi
+f01083b5:	56                   	push   %esi
+f01083b6:	53                   	push   %ebx
+f01083b7:	83 ec 24             	sub    $0x24,%esp
+f01083ba:	89 44 24 08          	mov    %eax,0x8(%esp)
+f01083be:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f01083c2:	8b 44 24 38          	mov    0x38(%esp),%eax
+f01083c6:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f01083ca:	89 44 24 10          	mov    %eax,0x10(%esp)
+f01083ce:	89 54 24 14          	mov    %edx,0x14(%esp)
+f01083d2:	8b 7c 24 40          	mov    0x40(%esp),%edi
+f01083d6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f01083db:	b8 00 00 00 00       	mov    $0x0,%eax
+f01083e0:	ba 00 00 00 00       	mov    $0x0,%edx
+f01083e5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+f01083ec:	00 
+f01083ed:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+f01083f4:	00 
+f01083f5:	89 fb                	mov    %edi,%ebx
+f01083f7:	eb 08                	jmp    f0108401 <udivmod+0x4e>
+f01083f9:	83 e9 01             	sub    $0x1,%ecx
+f01083fc:	83 f9 ff             	cmp    $0xffffffff,%ecx
+f01083ff:	74 68                	je     f0108469 <udivmod+0xb6>
+f0108401:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f0108405:	01 c0                	add    %eax,%eax
+f0108407:	89 c6                	mov    %eax,%esi
+f0108409:	89 d7                	mov    %edx,%edi
+f010840b:	8b 44 24 08          	mov    0x8(%esp),%eax
+f010840f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f0108413:	0f ad d0             	shrd   %cl,%edx,%eax
+f0108416:	d3 ea                	shr    %cl,%edx
+f0108418:	f6 c1 20             	test   $0x20,%cl
+f010841b:	74 04                	je     f0108421 <udivmod+0x6e>
+f010841d:	89 d0                	mov    %edx,%eax
+f010841f:	31 d2                	xor    %edx,%edx
+f0108421:	83 e0 01             	and    $0x1,%eax
+f0108424:	89 04 24             	mov    %eax,(%esp)
+f0108427:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+f010842e:	00 
+f010842f:	8b 04 24             	mov    (%esp),%eax
+f0108432:	8b 54 24 04          	mov    0x4(%esp),%edx
+f0108436:	09 f0                	or     %esi,%eax
+f0108438:	09 fa                	or     %edi,%edx
+f010843a:	8b 74 24 10          	mov    0x10(%esp),%esi
+f010843e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+f0108442:	39 f0                	cmp    %esi,%eax
+f0108444:	89 d5                	mov    %edx,%ebp
+f0108446:	19 fd                	sbb    %edi,%ebp
+f0108448:	72 af                	jb     f01083f9 <udivmod+0x46>
+f010844a:	29 f0                	sub    %esi,%eax
+f010844c:	19 fa                	sbb    %edi,%edx
+f010844e:	89 cf                	mov    %ecx,%edi
+f0108450:	c1 ef 05             	shr    $0x5,%edi
+f0108453:	83 e7 01             	and    $0x1,%edi
+f0108456:	89 fe                	mov    %edi,%esi
+f0108458:	83 f6 01             	xor    $0x1,%esi
+f010845b:	d3 e6                	shl    %cl,%esi
+f010845d:	d3 e7                	shl    %cl,%edi
+f010845f:	09 74 24 18          	or     %esi,0x18(%esp)
+f0108463:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+f0108467:	eb 90                	jmp    f01083f9 <udivmod+0x46>
+f0108469:	85 db                	test   %ebx,%ebx
+f010846b:	74 05                	je     f0108472 <udivmod+0xbf>
+f010846d:	89 03                	mov    %eax,(%ebx)
+f010846f:	89 53 04             	mov    %edx,0x4(%ebx)
+f0108472:	8b 44 24 18          	mov    0x18(%esp),%eax
+f0108476:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f010847a:	83 c4 24             	add    $0x24,%esp
+f010847d:	5b                   	pop    %ebx
+f010847e:	5e                   	pop    %esi
+f010847f:	5f                   	pop    %edi
+f0108480:	5d                   	pop    %ebp
+f0108481:	c3                   	ret
+
+f0108482 <__udivdi3>:
+f0108482:	83 ec 08             	sub    $0x8,%esp
+f0108485:	6a 00                	push   $0x0
+f0108487:	ff 74 24 1c          	push   0x1c(%esp)
+f010848b:	ff 74 24 1c          	push   0x1c(%esp)
+f010848f:	8b 44 24 18          	mov    0x18(%esp),%eax
+f0108493:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f0108497:	e8 17 ff ff ff       	call   f01083b3 <udivmod>
+f010849c:	83 c4 14             	add    $0x14,%esp
+f010849f:	c3                   	ret
+
+f01084a0 <__umoddi3>:
+f01084a0:	83 ec 18             	sub    $0x18,%esp
+f01084a3:	8d 44 24 0c          	lea    0xc(%esp),%eax
+f01084a7:	50                   	push   %eax
+f01084a8:	ff 74 24 2c          	push   0x2c(%esp)
+f01084ac:	ff 74 24 2c          	push   0x2c(%esp)
+f01084b0:	8b 44 24 28          	mov    0x28(%esp),%eax
+f01084b4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f01084b8:	e8 f6 fe ff ff       	call   f01083b3 <udivmod>
+f01084bd:	8b 44 24 18          	mov    0x18(%esp),%eax
+f01084c1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f01084c5:	83 c4 24             	add    $0x24,%esp
+f01084c8:	c3                   	ret
+
+f01084c9 <__divdi3>:
+f01084c9:	55                   	push   %ebp
+f01084ca:	57                   	push   %edi
+f01084cb:	56                   	push   %esi
+f01084cc:	53                   	push   %ebx
+f01084cd:	83 ec 10             	sub    $0x10,%esp
+f01084d0:	8b 44 24 24          	mov    0x24(%esp),%eax
+f01084d4:	8b 54 24 28          	mov    0x28(%esp),%edx
+f01084d8:	89 c6                	mov    %eax,%esi
+f01084da:	89 d7                	mov    %edx,%edi
+f01084dc:	33 74 24 2c          	xor    0x2c(%esp),%esi
+f01084e0:	33 7c 24 30          	xor    0x30(%esp),%edi
+f01084e4:	89 74 24 04          	mov    %esi,0x4(%esp)
+f01084e8:	89 7c 24 08          	mov    %edi,0x8(%esp)
+f01084ec:	89 c5                	mov    %eax,%ebp
+f01084ee:	f7 dd                	neg    %ebp
+f01084f0:	89 d6                	mov    %edx,%esi
+f01084f2:	83 d6 00             	adc    $0x0,%esi
+f01084f5:	f7 de                	neg    %esi
+f01084f7:	0f 48 e8             	cmovs  %eax,%ebp
+f01084fa:	0f 49 d6             	cmovns %esi,%edx
+f01084fd:	6a 00                	push   $0x0
+f01084ff:	8b 74 24 30          	mov    0x30(%esp),%esi
+f0108503:	f7 de                	neg    %esi
+f0108505:	8b 44 24 34          	mov    0x34(%esp),%eax
+f0108509:	83 d0 00             	adc    $0x0,%eax
+f010850c:	f7 d8                	neg    %eax
+f010850e:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+f0108513:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+f0108518:	50                   	push   %eax
+f0108519:	56                   	push   %esi
+f010851a:	89 e8                	mov    %ebp,%eax
+f010851c:	e8 92 fe ff ff       	call   f01083b3 <udivmod>
+f0108521:	83 c4 10             	add    $0x10,%esp
+f0108524:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+f0108529:	78 08                	js     f0108533 <__divdi3+0x6a>
+f010852b:	83 c4 0c             	add    $0xc,%esp
+f010852e:	5b                   	pop    %ebx
+f010852f:	5e                   	pop    %esi
+f0108530:	5f                   	pop    %edi
+f0108531:	5d                   	pop    %ebp
+f0108532:	c3                   	ret
+f0108533:	f7 d8                	neg    %eax
+f0108535:	83 d2 00             	adc    $0x0,%edx
+f0108538:	f7 da                	neg    %edx
+f010853a:	eb ef                	jmp    f010852b <__divdi3+0x62>
+
+f010853c <__moddi3>:
+f010853c:	55                   	push   %ebp
+f010853d:	57                   	push   %edi
+f010853e:	56                   	push   %esi
+f010853f:	53                   	push   %ebx
+f0108540:	83 ec 18             	sub    $0x18,%esp
+f0108543:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+f0108547:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+f010854b:	89 f1                	mov    %esi,%ecx
+f010854d:	f7 d9                	neg    %ecx
+f010854f:	89 da                	mov    %ebx,%edx
+f0108551:	83 d2 00             	adc    $0x0,%edx
+f0108554:	f7 da                	neg    %edx
+f0108556:	0f 48 ce             	cmovs  %esi,%ecx
+f0108559:	0f 48 d3             	cmovs  %ebx,%edx
+f010855c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+f0108560:	50                   	push   %eax
+f0108561:	8b 74 24 38          	mov    0x38(%esp),%esi
+f0108565:	f7 de                	neg    %esi
+f0108567:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+f010856b:	83 d0 00             	adc    $0x0,%eax
+f010856e:	f7 d8                	neg    %eax
+f0108570:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+f0108575:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+f010857a:	50                   	push   %eax
+f010857b:	56                   	push   %esi
+f010857c:	89 c8                	mov    %ecx,%eax
+f010857e:	e8 30 fe ff ff       	call   f01083b3 <udivmod>
+f0108583:	83 c4 10             	add    $0x10,%esp
+f0108586:	85 db                	test   %ebx,%ebx
+f0108588:	78 10                	js     f010859a <__moddi3+0x5e>
+f010858a:	8b 44 24 08          	mov    0x8(%esp),%eax
+f010858e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f0108592:	83 c4 14             	add    $0x14,%esp
+f0108595:	5b                   	pop    %ebx
+f0108596:	5e                   	pop    %esi
+f0108597:	5f                   	pop    %edi
+f0108598:	5d                   	pop    %ebp
+f0108599:	c3                   	ret
+f010859a:	8b 44 24 08          	mov    0x8(%esp),%eax
+f010859e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f01085a2:	f7 d8                	neg    %eax
+f01085a4:	83 d2 00             	adc    $0x0,%edx
+f01085a7:	f7 da                	neg    %edx
+f01085a9:	eb e7                	jmp    f0108592 <__moddi3+0x56>
@@ -0,0 +1,7601 @@
+
+obj/page/page:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 35 11 00 00       	call   801166 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <page_init>:
+
+// Initialize the page system
+void
+page_init(void)
+{
+}
+  800033:	c3                   	ret
+
+00800034 <serve_ring_enter>:
+// the doorbell: by the time we reply, serve has been through every ring
+int
+serve_ring_enter(envid_t envid, uint32_t blockno, struct Pageipc *ipc, void **return_page)
+{
+	return 0;
+}
+  800034:	b8 00 00 00 00       	mov    $0x0,%eax
+  800039:	c3                   	ret
+
+0080003a <serve_page_stat>:
+{
+  80003a:	55                   	push   %ebp
+  80003b:	89 e5                	mov    %esp,%ebp
+  80003d:	53                   	push   %ebx
+  80003e:	83 ec 08             	sub    $0x8,%esp
+  800041:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	memset(ipc, 0, sizeof(struct Pageipc));
+  800044:	68 00 10 00 00       	push   $0x1000
+  800049:	6a 00                	push   $0x0
+  80004b:	53                   	push   %ebx
+  80004c:	e8 8b 19 00 00       	call   8019dc <memset>
+	*((struct Pageret_stat *)ipc) = serve_stats_s;
+  800051:	a1 74 d0 80 00       	mov    0x80d074,%eax
+  800056:	89 03                	mov    %eax,(%ebx)
+  800058:	a1 78 d0 80 00       	mov    0x80d078,%eax
+  80005d:	89 43 04             	mov    %eax,0x4(%ebx)
+  800060:	a1 7c d0 80 00       	mov    0x80d07c,%eax
+  800065:	89 43 08             	mov    %eax,0x8(%ebx)
+  800068:	a1 80 d0 80 00       	mov    0x80d080,%eax
+  80006d:	89 43 0c             	mov    %eax,0xc(%ebx)
+  800070:	a1 84 d0 80 00       	mov    0x80d084,%eax
+  800075:	89 43 10             	mov    %eax,0x10(%ebx)
+	*return_page = (void *)ipc;
+  800078:	8b 45 14             	mov    0x14(%ebp),%eax
+  80007b:	89 18                	mov    %ebx,(%eax)
+}
+  80007d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800082:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800085:	c9                   	leave
+  800086:	c3                   	ret
+
+00800087 <swap_area_of>:
+{
+  800087:	55                   	push   %ebp
+  800088:	89 e5                	mov    %esp,%ebp
+  80008a:	57                   	push   %edi
+  80008b:	56                   	push   %esi
+  80008c:	53                   	push   %ebx
+  80008d:	83 ec 0c             	sub    $0xc,%esp
+  800090:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	for (i = 0; i < nswap_areas; ++i) {
+  800093:	8b 3d a4 d3 82 00    	mov    0x82d3a4,%edi
+  800099:	ba 00 00 00 00       	mov    $0x0,%edx
+  80009e:	eb 03                	jmp    8000a3 <swap_area_of+0x1c>
+  8000a0:	83 c2 01             	add    $0x1,%edx
+  8000a3:	39 d7                	cmp    %edx,%edi
+  8000a5:	7e 2e                	jle    8000d5 <swap_area_of+0x4e>
+		if (slot >= swap_areas[i].first && slot < swap_areas[i].first + swap_areas[i].nslots) {
+  8000a7:	8d 0c 52             	lea    (%edx,%edx,2),%ecx
+  8000aa:	8d 34 cd 00 00 00 00 	lea    0x0(,%ecx,8),%esi
+  8000b1:	8b 04 cd 28 d0 80 00 	mov    0x80d028(,%ecx,8),%eax
+  8000b8:	39 c3                	cmp    %eax,%ebx
+  8000ba:	72 e4                	jb     8000a0 <swap_area_of+0x19>
+  8000bc:	03 04 cd 2c d0 80 00 	add    0x80d02c(,%ecx,8),%eax
+  8000c3:	39 c3                	cmp    %eax,%ebx
+  8000c5:	73 d9                	jae    8000a0 <swap_area_of+0x19>
+			return &swap_areas[i];
+  8000c7:	8d 86 20 d0 80 00    	lea    0x80d020(%esi),%eax
+}
+  8000cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000d0:	5b                   	pop    %ebx
+  8000d1:	5e                   	pop    %esi
+  8000d2:	5f                   	pop    %edi
+  8000d3:	5d                   	pop    %ebp
+  8000d4:	c3                   	ret
+	panic("swap_area_of: slot %d is in no swap area", slot);
+  8000d5:	53                   	push   %ebx
+  8000d6:	68 c0 37 80 00       	push   $0x8037c0
+  8000db:	6a 5a                	push   $0x5a
+  8000dd:	68 ea 3a 80 00       	push   $0x803aea
+  8000e2:	e8 e2 10 00 00       	call   8011c9 <_panic>
+
+008000e7 <swap_io>:
+{
+  8000e7:	55                   	push   %ebp
+  8000e8:	89 e5                	mov    %esp,%ebp
+  8000ea:	56                   	push   %esi
+  8000eb:	53                   	push   %ebx
+  8000ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000ef:	8b 75 14             	mov    0x14(%ebp),%esi
+	struct swap_area *area = swap_area_of(slot);
+  8000f2:	83 ec 0c             	sub    $0xc,%esp
+  8000f5:	53                   	push   %ebx
+  8000f6:	e8 8c ff ff ff       	call   800087 <swap_area_of>
+  8000fb:	83 c4 04             	add    $0x4,%esp
+	uint32_t secno = (area->start + slot - area->first)*BLKSECTS;
+  8000fe:	03 58 04             	add    0x4(%eax),%ebx
+  800101:	2b 58 08             	sub    0x8(%eax),%ebx
+  800104:	c1 e3 03             	shl    $0x3,%ebx
+	ide_set_disk(area->disk);
+  800107:	ff 30                	push   (%eax)
+  800109:	e8 4a 0e 00 00       	call   800f58 <ide_set_disk>
+	if (write) {
+  80010e:	83 c4 10             	add    $0x10,%esp
+  800111:	89 f0                	mov    %esi,%eax
+  800113:	84 c0                	test   %al,%al
+  800115:	75 1d                	jne    800134 <swap_io+0x4d>
+	return ide_read(secno, pg, n*BLKSECTS);
+  800117:	83 ec 04             	sub    $0x4,%esp
+  80011a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80011d:	c1 e0 03             	shl    $0x3,%eax
+  800120:	50                   	push   %eax
+  800121:	ff 75 0c             	push   0xc(%ebp)
+  800124:	53                   	push   %ebx
+  800125:	e8 57 0e 00 00       	call   800f81 <ide_read>
+  80012a:	83 c4 10             	add    $0x10,%esp
+}
+  80012d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800130:	5b                   	pop    %ebx
+  800131:	5e                   	pop    %esi
+  800132:	5d                   	pop    %ebp
+  800133:	c3                   	ret
+		return ide_write(secno, pg, n*BLKSECTS);
+  800134:	83 ec 04             	sub    $0x4,%esp
+  800137:	8b 45 10             	mov    0x10(%ebp),%eax
+  80013a:	c1 e0 03             	shl    $0x3,%eax
+  80013d:	50                   	push   %eax
+  80013e:	ff 75 0c             	push   0xc(%ebp)
+  800141:	53                   	push   %ebx
+  800142:	e8 29 0f 00 00       	call   801070 <ide_write>
+  800147:	83 c4 10             	add    $0x10,%esp
+  80014a:	eb e1                	jmp    80012d <swap_io+0x46>
+
+0080014c <get_free_page_block>:
+{
+  80014c:	55                   	push   %ebp
+  80014d:	89 e5                	mov    %esp,%ebp
+  80014f:	57                   	push   %edi
+  800150:	56                   	push   %esi
+  800151:	53                   	push   %ebx
+  800152:	83 ec 1c             	sub    $0x1c,%esp
+	for (i = 1; i <= nswap_areas; ++i) {
+  800155:	8b 1d a4 d3 82 00    	mov    0x82d3a4,%ebx
+		struct swap_area *a = &swap_areas[(swap_rotor + i) % nswap_areas];
+  80015b:	a1 ac d3 82 00       	mov    0x82d3ac,%eax
+  800160:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	struct swap_area *area = NULL;
+  800163:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 1; i <= nswap_areas; ++i) {
+  800168:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80016d:	eb 0d                	jmp    80017c <get_free_page_block+0x30>
+		struct swap_area *a = &swap_areas[(swap_rotor + i) % nswap_areas];
+  80016f:	8d 04 52             	lea    (%edx,%edx,2),%eax
+  800172:	8d 34 c5 20 d0 80 00 	lea    0x80d020(,%eax,8),%esi
+	for (i = 1; i <= nswap_areas; ++i) {
+  800179:	83 c1 01             	add    $0x1,%ecx
+  80017c:	39 cb                	cmp    %ecx,%ebx
+  80017e:	7c 27                	jl     8001a7 <get_free_page_block+0x5b>
+		struct swap_area *a = &swap_areas[(swap_rotor + i) % nswap_areas];
+  800180:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800183:	01 c8                	add    %ecx,%eax
+  800185:	99                   	cltd
+  800186:	f7 fb                	idiv   %ebx
+		if (a->free_list && (!area || a->priority > area->priority)) {
+  800188:	8d 04 52             	lea    (%edx,%edx,2),%eax
+  80018b:	83 3c c5 34 d0 80 00 	cmpl   $0x0,0x80d034(,%eax,8)
+  800192:	00 
+  800193:	74 e4                	je     800179 <get_free_page_block+0x2d>
+  800195:	85 f6                	test   %esi,%esi
+  800197:	74 d6                	je     80016f <get_free_page_block+0x23>
+  800199:	8b 7e 10             	mov    0x10(%esi),%edi
+  80019c:	39 3c c5 30 d0 80 00 	cmp    %edi,0x80d030(,%eax,8)
+  8001a3:	7e d4                	jle    800179 <get_free_page_block+0x2d>
+  8001a5:	eb c8                	jmp    80016f <get_free_page_block+0x23>
+	if (!area) {
+  8001a7:	85 f6                	test   %esi,%esi
+  8001a9:	74 54                	je     8001ff <get_free_page_block+0xb3>
+	swap_rotor = area - swap_areas;
+  8001ab:	89 f0                	mov    %esi,%eax
+  8001ad:	2d 20 d0 80 00       	sub    $0x80d020,%eax
+  8001b2:	c1 f8 03             	sar    $0x3,%eax
+  8001b5:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+  8001bb:	a3 ac d3 82 00       	mov    %eax,0x82d3ac
+	node = area->free_list;
+  8001c0:	8b 4e 14             	mov    0x14(%esi),%ecx
+	for (i = 0, bitmap = node->bitmap; i < NBLOCKS_PER_GROUP; ++i, bitmap >>= 1) {
+  8001c3:	8b 01                	mov    (%ecx),%eax
+  8001c5:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (!(bitmap&1)) {
+  8001ca:	a8 01                	test   $0x1,%al
+  8001cc:	74 21                	je     8001ef <get_free_page_block+0xa3>
+	for (i = 0, bitmap = node->bitmap; i < NBLOCKS_PER_GROUP; ++i, bitmap >>= 1) {
+  8001ce:	83 c2 01             	add    $0x1,%edx
+  8001d1:	d1 e8                	shr    %eax
+  8001d3:	83 fa 20             	cmp    $0x20,%edx
+  8001d6:	75 f2                	jne    8001ca <get_free_page_block+0x7e>
+	panic("get_free_page_block: there is a block group in a free list that has no free blocks");
+  8001d8:	83 ec 04             	sub    $0x4,%esp
+  8001db:	68 ec 37 80 00       	push   $0x8037ec
+  8001e0:	68 8a 00 00 00       	push   $0x8a
+  8001e5:	68 ea 3a 80 00       	push   $0x803aea
+  8001ea:	e8 da 0f 00 00       	call   8011c9 <_panic>
+			return node->groupno*NBLOCKS_PER_GROUP + i;
+  8001ef:	8b 41 04             	mov    0x4(%ecx),%eax
+  8001f2:	c1 e0 05             	shl    $0x5,%eax
+  8001f5:	01 d0                	add    %edx,%eax
+}
+  8001f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fa:	5b                   	pop    %ebx
+  8001fb:	5e                   	pop    %esi
+  8001fc:	5f                   	pop    %edi
+  8001fd:	5d                   	pop    %ebp
+  8001fe:	c3                   	ret
+		return -E_SWAP_SPACE_FULL;
+  8001ff:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  800204:	eb f1                	jmp    8001f7 <get_free_page_block+0xab>
+
+00800206 <mark_page_block_as_not_free>:
+{
+  800206:	55                   	push   %ebp
+  800207:	89 e5                	mov    %esp,%ebp
+  800209:	57                   	push   %edi
+  80020a:	56                   	push   %esi
+  80020b:	53                   	push   %ebx
+  80020c:	83 ec 0c             	sub    $0xc,%esp
+  80020f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (blockno >= page_nslots) {
+  800212:	3b 1d 68 d0 80 00    	cmp    0x80d068,%ebx
+  800218:	73 40                	jae    80025a <mark_page_block_as_not_free+0x54>
+	area = swap_area_of(blockno);
+  80021a:	83 ec 0c             	sub    $0xc,%esp
+  80021d:	53                   	push   %ebx
+  80021e:	e8 64 fe ff ff       	call   800087 <swap_area_of>
+  800223:	83 c4 10             	add    $0x10,%esp
+	groupno = blockno / NBLOCKS_PER_GROUP;
+  800226:	89 d9                	mov    %ebx,%ecx
+  800228:	c1 e9 05             	shr    $0x5,%ecx
+	if (!area->free_list || groupno != area->free_list->groupno) {
+  80022b:	8b 50 14             	mov    0x14(%eax),%edx
+  80022e:	85 d2                	test   %edx,%edx
+  800230:	74 3f                	je     800271 <mark_page_block_as_not_free+0x6b>
+  800232:	39 4a 04             	cmp    %ecx,0x4(%edx)
+  800235:	75 3a                	jne    800271 <mark_page_block_as_not_free+0x6b>
+	if (area->free_list->bitmap & (1<<i)) {
+  800237:	8b 32                	mov    (%edx),%esi
+  800239:	bf 01 00 00 00       	mov    $0x1,%edi
+  80023e:	89 d9                	mov    %ebx,%ecx
+  800240:	d3 e7                	shl    %cl,%edi
+  800242:	85 fe                	test   %edi,%esi
+  800244:	75 42                	jne    800288 <mark_page_block_as_not_free+0x82>
+	area->free_list->bitmap |= (1<<i);
+  800246:	09 fe                	or     %edi,%esi
+  800248:	89 32                	mov    %esi,(%edx)
+	if (!(~(area->free_list->bitmap))) {
+  80024a:	8b 50 14             	mov    0x14(%eax),%edx
+  80024d:	83 3a ff             	cmpl   $0xffffffff,(%edx)
+  800250:	74 4d                	je     80029f <mark_page_block_as_not_free+0x99>
+}
+  800252:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800255:	5b                   	pop    %ebx
+  800256:	5e                   	pop    %esi
+  800257:	5f                   	pop    %edi
+  800258:	5d                   	pop    %ebp
+  800259:	c3                   	ret
+		panic("mark_page_block_as_not_free: invalid block number");
+  80025a:	83 ec 04             	sub    $0x4,%esp
+  80025d:	68 40 38 80 00       	push   $0x803840
+  800262:	68 9a 00 00 00       	push   $0x9a
+  800267:	68 ea 3a 80 00       	push   $0x803aea
+  80026c:	e8 58 0f 00 00       	call   8011c9 <_panic>
+		panic("mark_page_block_as_not_free: attempting to unfree block that isn't in front of its area's free list");
+  800271:	83 ec 04             	sub    $0x4,%esp
+  800274:	68 74 38 80 00       	push   $0x803874
+  800279:	68 9f 00 00 00       	push   $0x9f
+  80027e:	68 ea 3a 80 00       	push   $0x803aea
+  800283:	e8 41 0f 00 00       	call   8011c9 <_panic>
+		panic("mark_page_block_as_not_free: attempting to unfree block that is already unfree");
+  800288:	83 ec 04             	sub    $0x4,%esp
+  80028b:	68 d8 38 80 00       	push   $0x8038d8
+  800290:	68 a3 00 00 00       	push   $0xa3
+  800295:	68 ea 3a 80 00       	push   $0x803aea
+  80029a:	e8 2a 0f 00 00       	call   8011c9 <_panic>
+		area->free_list = area->free_list->link;
+  80029f:	8b 52 08             	mov    0x8(%edx),%edx
+  8002a2:	89 50 14             	mov    %edx,0x14(%eax)
+}
+  8002a5:	eb ab                	jmp    800252 <mark_page_block_as_not_free+0x4c>
+
+008002a7 <serve_page_out>:
+{
+  8002a7:	55                   	push   %ebp
+  8002a8:	89 e5                	mov    %esp,%ebp
+  8002aa:	53                   	push   %ebx
+  8002ab:	83 ec 04             	sub    $0x4,%esp
+	if ((free_blockno = get_free_page_block()) < 0) {
+  8002ae:	e8 99 fe ff ff       	call   80014c <get_free_page_block>
+  8002b3:	89 c3                	mov    %eax,%ebx
+  8002b5:	85 c0                	test   %eax,%eax
+  8002b7:	78 3b                	js     8002f4 <serve_page_out+0x4d>
+	if ((r = swap_io(free_blockno, (void *)ipc, 1, 1)) < 0) {
+  8002b9:	6a 01                	push   $0x1
+  8002bb:	6a 01                	push   $0x1
+  8002bd:	ff 75 10             	push   0x10(%ebp)
+  8002c0:	50                   	push   %eax
+  8002c1:	e8 21 fe ff ff       	call   8000e7 <swap_io>
+  8002c6:	83 c4 10             	add    $0x10,%esp
+  8002c9:	85 c0                	test   %eax,%eax
+  8002cb:	78 2e                	js     8002fb <serve_page_out+0x54>
+	mark_page_block_as_not_free(free_blockno);
+  8002cd:	83 ec 0c             	sub    $0xc,%esp
+  8002d0:	53                   	push   %ebx
+  8002d1:	e8 30 ff ff ff       	call   800206 <mark_page_block_as_not_free>
+	page_block_refs[free_blockno] = 1;
+  8002d6:	66 c7 84 1b a0 d0 80 	movw   $0x1,0x80d0a0(%ebx,%ebx,1)
+  8002dd:	00 01 00 
+	++serve_stats_s.num_page_outs;
+  8002e0:	83 05 74 d0 80 00 01 	addl   $0x1,0x80d074
+	return page_instance*PAGESERV_NSLOTS + free_blockno;
+  8002e7:	a1 a8 d3 82 00       	mov    0x82d3a8,%eax
+  8002ec:	c1 e0 10             	shl    $0x10,%eax
+  8002ef:	01 c3                	add    %eax,%ebx
+  8002f1:	83 c4 10             	add    $0x10,%esp
+}
+  8002f4:	89 d8                	mov    %ebx,%eax
+  8002f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002f9:	c9                   	leave
+  8002fa:	c3                   	ret
+		return r;   // TODO handle IDE write errors
+  8002fb:	89 c3                	mov    %eax,%ebx
+  8002fd:	eb f5                	jmp    8002f4 <serve_page_out+0x4d>
+
+008002ff <serve_page_reclaim>:
+{
+  8002ff:	55                   	push   %ebp
+  800300:	89 e5                	mov    %esp,%ebp
+  800302:	53                   	push   %ebx
+  800303:	83 ec 04             	sub    $0x4,%esp
+	if ((free_blockno = get_free_page_block()) < 0) {
+  800306:	e8 41 fe ff ff       	call   80014c <get_free_page_block>
+  80030b:	89 c3                	mov    %eax,%ebx
+  80030d:	85 c0                	test   %eax,%eax
+  80030f:	78 68                	js     800379 <serve_page_reclaim+0x7a>
+	if ((r = sys_page_reclaim(envid, (void *) RECLAIMVA, page_instance*PAGESERV_NSLOTS + free_blockno)) < 0) {
+  800311:	83 ec 04             	sub    $0x4,%esp
+  800314:	a1 a8 d3 82 00       	mov    0x82d3a8,%eax
+  800319:	c1 e0 10             	shl    $0x10,%eax
+  80031c:	01 d8                	add    %ebx,%eax
+  80031e:	50                   	push   %eax
+  80031f:	68 00 f0 ff 1f       	push   $0x1ffff000
+  800324:	ff 75 08             	push   0x8(%ebp)
+  800327:	e8 5b 1b 00 00       	call   801e87 <sys_page_reclaim>
+  80032c:	83 c4 10             	add    $0x10,%esp
+  80032f:	85 c0                	test   %eax,%eax
+  800331:	78 62                	js     800395 <serve_page_reclaim+0x96>
+	if ((r = swap_io(free_blockno, (void *) RECLAIMVA, 1, 1)) < 0) {
+  800333:	6a 01                	push   $0x1
+  800335:	6a 01                	push   $0x1
+  800337:	68 00 f0 ff 1f       	push   $0x1ffff000
+  80033c:	53                   	push   %ebx
+  80033d:	e8 a5 fd ff ff       	call   8000e7 <swap_io>
+  800342:	83 c4 10             	add    $0x10,%esp
+  800345:	85 c0                	test   %eax,%eax
+  800347:	78 37                	js     800380 <serve_page_reclaim+0x81>
+	sys_page_unmap(0, (void *) RECLAIMVA);
+  800349:	83 ec 08             	sub    $0x8,%esp
+  80034c:	68 00 f0 ff 1f       	push   $0x1ffff000
+  800351:	6a 00                	push   $0x0
+  800353:	e8 ab 1a 00 00       	call   801e03 <sys_page_unmap>
+	mark_page_block_as_not_free(free_blockno);
+  800358:	89 1c 24             	mov    %ebx,(%esp)
+  80035b:	e8 a6 fe ff ff       	call   800206 <mark_page_block_as_not_free>
+	page_block_refs[free_blockno] = 1;
+  800360:	66 c7 84 1b a0 d0 80 	movw   $0x1,0x80d0a0(%ebx,%ebx,1)
+  800367:	00 01 00 
+	++serve_stats_s.num_page_reclaims;
+  80036a:	83 05 84 d0 80 00 01 	addl   $0x1,0x80d084
+	return 0;
+  800371:	83 c4 10             	add    $0x10,%esp
+  800374:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  800379:	89 d8                	mov    %ebx,%eax
+  80037b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80037e:	c9                   	leave
+  80037f:	c3                   	ret
+		panic("serve_page_reclaim: %e", r);   // the owner has nowhere else to get its page from
+  800380:	50                   	push   %eax
+  800381:	68 f6 3a 80 00       	push   $0x803af6
+  800386:	68 9f 01 00 00       	push   $0x19f
+  80038b:	68 ea 3a 80 00       	push   $0x803aea
+  800390:	e8 34 0e 00 00       	call   8011c9 <_panic>
+		return r;
+  800395:	89 c3                	mov    %eax,%ebx
+  800397:	eb e0                	jmp    800379 <serve_page_reclaim+0x7a>
+
+00800399 <mark_page_block_as_free>:
+{
+  800399:	55                   	push   %ebp
+  80039a:	89 e5                	mov    %esp,%ebp
+  80039c:	56                   	push   %esi
+  80039d:	53                   	push   %ebx
+  80039e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (blockno >= page_nslots) {
+  8003a1:	3b 1d 68 d0 80 00    	cmp    0x80d068,%ebx
+  8003a7:	73 4a                	jae    8003f3 <mark_page_block_as_free+0x5a>
+	area = swap_area_of(blockno);
+  8003a9:	83 ec 0c             	sub    $0xc,%esp
+  8003ac:	53                   	push   %ebx
+  8003ad:	e8 d5 fc ff ff       	call   800087 <swap_area_of>
+  8003b2:	83 c4 10             	add    $0x10,%esp
+  8003b5:	89 c1                	mov    %eax,%ecx
+	groupno = blockno / NBLOCKS_PER_GROUP;
+  8003b7:	89 d8                	mov    %ebx,%eax
+  8003b9:	c1 e8 05             	shr    $0x5,%eax
+	if (!(~page_bitmap_nodes[groupno].bitmap)) {
+  8003bc:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8003bf:	83 3c 95 20 70 80 00 	cmpl   $0xffffffff,0x807020(,%edx,4)
+  8003c6:	ff 
+  8003c7:	74 41                	je     80040a <mark_page_block_as_free+0x71>
+	if (!(page_bitmap_nodes[groupno].bitmap & (1<<i))) {
+  8003c9:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8003cc:	8b 14 95 20 70 80 00 	mov    0x807020(,%edx,4),%edx
+  8003d3:	be 01 00 00 00       	mov    $0x1,%esi
+  8003d8:	89 d9                	mov    %ebx,%ecx
+  8003da:	d3 e6                	shl    %cl,%esi
+  8003dc:	85 f2                	test   %esi,%edx
+  8003de:	74 3c                	je     80041c <mark_page_block_as_free+0x83>
+	page_bitmap_nodes[groupno].bitmap ^= (1<<i);
+  8003e0:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8003e3:	31 f2                	xor    %esi,%edx
+  8003e5:	89 14 85 20 70 80 00 	mov    %edx,0x807020(,%eax,4)
+}
+  8003ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003ef:	5b                   	pop    %ebx
+  8003f0:	5e                   	pop    %esi
+  8003f1:	5d                   	pop    %ebp
+  8003f2:	c3                   	ret
+		panic("mark_page_block_as_free: invalid block number");
+  8003f3:	83 ec 04             	sub    $0x4,%esp
+  8003f6:	68 28 39 80 00       	push   $0x803928
+  8003fb:	68 b6 00 00 00       	push   $0xb6
+  800400:	68 ea 3a 80 00       	push   $0x803aea
+  800405:	e8 bf 0d 00 00       	call   8011c9 <_panic>
+		page_bitmap_nodes[groupno].link = area->free_list;
+  80040a:	8b 71 14             	mov    0x14(%ecx),%esi
+  80040d:	8d 14 95 20 70 80 00 	lea    0x807020(,%edx,4),%edx
+  800414:	89 72 08             	mov    %esi,0x8(%edx)
+		area->free_list = (page_bitmap_nodes+groupno);
+  800417:	89 51 14             	mov    %edx,0x14(%ecx)
+  80041a:	eb ad                	jmp    8003c9 <mark_page_block_as_free+0x30>
+		panic("mark_page_block_as_free: attempting to free block that is already free");
+  80041c:	83 ec 04             	sub    $0x4,%esp
+  80041f:	68 58 39 80 00       	push   $0x803958
+  800424:	68 c0 00 00 00       	push   $0xc0
+  800429:	68 ea 3a 80 00       	push   $0x803aea
+  80042e:	e8 96 0d 00 00       	call   8011c9 <_panic>
+
+00800433 <page_block_decref>:
+{
+  800433:	55                   	push   %ebp
+  800434:	89 e5                	mov    %esp,%ebp
+  800436:	83 ec 08             	sub    $0x8,%esp
+  800439:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (*refs == 0) {
+  80043c:	0f b7 84 12 a0 d0 80 	movzwl 0x80d0a0(%edx,%edx,1),%eax
+  800443:	00 
+  800444:	66 85 c0             	test   %ax,%ax
+  800447:	74 12                	je     80045b <page_block_decref+0x28>
+	if (--(*refs) == 0) {
+  800449:	83 e8 01             	sub    $0x1,%eax
+  80044c:	66 89 84 12 a0 d0 80 	mov    %ax,0x80d0a0(%edx,%edx,1)
+  800453:	00 
+  800454:	66 85 c0             	test   %ax,%ax
+  800457:	74 19                	je     800472 <page_block_decref+0x3f>
+}
+  800459:	c9                   	leave
+  80045a:	c3                   	ret
+		panic("page_block_decref: attempting to drop a reference to a free block");
+  80045b:	83 ec 04             	sub    $0x4,%esp
+  80045e:	68 a0 39 80 00       	push   $0x8039a0
+  800463:	68 cd 00 00 00       	push   $0xcd
+  800468:	68 ea 3a 80 00       	push   $0x803aea
+  80046d:	e8 57 0d 00 00       	call   8011c9 <_panic>
+		mark_page_block_as_free(blockno);
+  800472:	83 ec 0c             	sub    $0xc,%esp
+  800475:	52                   	push   %edx
+  800476:	e8 1e ff ff ff       	call   800399 <mark_page_block_as_free>
+  80047b:	83 c4 10             	add    $0x10,%esp
+}
+  80047e:	eb d9                	jmp    800459 <page_block_decref+0x26>
+
+00800480 <page_slot_ours>:
+{
+  800480:	55                   	push   %ebp
+  800481:	89 e5                	mov    %esp,%ebp
+  800483:	8b 55 08             	mov    0x8(%ebp),%edx
+	return PAGESERV_OF(slot) == page_instance && slot % PAGESERV_NSLOTS < page_nslots;
+  800486:	89 d1                	mov    %edx,%ecx
+  800488:	c1 e9 10             	shr    $0x10,%ecx
+  80048b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800490:	3b 0d a8 d3 82 00    	cmp    0x82d3a8,%ecx
+  800496:	74 05                	je     80049d <page_slot_ours+0x1d>
+  800498:	83 e0 01             	and    $0x1,%eax
+}
+  80049b:	5d                   	pop    %ebp
+  80049c:	c3                   	ret
+	return PAGESERV_OF(slot) == page_instance && slot % PAGESERV_NSLOTS < page_nslots;
+  80049d:	0f b7 d2             	movzwl %dx,%edx
+  8004a0:	3b 15 68 d0 80 00    	cmp    0x80d068,%edx
+  8004a6:	0f 92 c0             	setb   %al
+  8004a9:	0f b6 c0             	movzbl %al,%eax
+  8004ac:	eb ea                	jmp    800498 <page_slot_ours+0x18>
+
+008004ae <serve_page_in>:
+{
+  8004ae:	55                   	push   %ebp
+  8004af:	89 e5                	mov    %esp,%ebp
+  8004b1:	53                   	push   %ebx
+  8004b2:	83 ec 10             	sub    $0x10,%esp
+  8004b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (!page_slot_ours(blockno) || !page_block_refs[OURSLOT(blockno)]) {
+  8004b8:	53                   	push   %ebx
+  8004b9:	e8 c2 ff ff ff       	call   800480 <page_slot_ours>
+  8004be:	83 c4 10             	add    $0x10,%esp
+  8004c1:	84 c0                	test   %al,%al
+  8004c3:	74 3f                	je     800504 <serve_page_in+0x56>
+  8004c5:	0f b7 db             	movzwl %bx,%ebx
+  8004c8:	66 83 bc 1b a0 d0 80 	cmpw   $0x0,0x80d0a0(%ebx,%ebx,1)
+  8004cf:	00 00 
+  8004d1:	74 38                	je     80050b <serve_page_in+0x5d>
+	if ((r = swap_io(blockno, (void *)ipc, 1, 0)) < 0) {
+  8004d3:	6a 00                	push   $0x0
+  8004d5:	6a 01                	push   $0x1
+  8004d7:	ff 75 10             	push   0x10(%ebp)
+  8004da:	53                   	push   %ebx
+  8004db:	e8 07 fc ff ff       	call   8000e7 <swap_io>
+  8004e0:	83 c4 10             	add    $0x10,%esp
+  8004e3:	85 c0                	test   %eax,%eax
+  8004e5:	78 18                	js     8004ff <serve_page_in+0x51>
+	page_block_decref(blockno);    // other sharers of the block still need it
+  8004e7:	83 ec 0c             	sub    $0xc,%esp
+  8004ea:	53                   	push   %ebx
+  8004eb:	e8 43 ff ff ff       	call   800433 <page_block_decref>
+	++serve_stats_s.num_page_ins;   // the client's own page was filled in, so there's nothing to return
+  8004f0:	83 05 78 d0 80 00 01 	addl   $0x1,0x80d078
+	return 0;
+  8004f7:	83 c4 10             	add    $0x10,%esp
+  8004fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8004ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800502:	c9                   	leave
+  800503:	c3                   	ret
+		return -E_INVAL;
+  800504:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800509:	eb f4                	jmp    8004ff <serve_page_in+0x51>
+  80050b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800510:	eb ed                	jmp    8004ff <serve_page_in+0x51>
+
+00800512 <serve_page_in_range>:
+{
+  800512:	55                   	push   %ebp
+  800513:	89 e5                	mov    %esp,%ebp
+  800515:	57                   	push   %edi
+  800516:	56                   	push   %esi
+  800517:	53                   	push   %ebx
+  800518:	83 ec 5c             	sub    $0x5c,%esp
+  80051b:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct Pagereq_page_in_range req = *(struct Pagereq_page_in_range *)ipc;
+  80051e:	8b 0a                	mov    (%edx),%ecx
+  800520:	89 4d ac             	mov    %ecx,-0x54(%ebp)
+  800523:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+  800526:	8b 42 04             	mov    0x4(%edx),%eax
+  800529:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80052c:	8b 42 08             	mov    0x8(%edx),%eax
+  80052f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800532:	8b 42 0c             	mov    0xc(%edx),%eax
+  800535:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800538:	8b 42 10             	mov    0x10(%edx),%eax
+  80053b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80053e:	8b 42 14             	mov    0x14(%edx),%eax
+  800541:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800544:	8b 42 18             	mov    0x18(%edx),%eax
+  800547:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80054a:	8b 42 1c             	mov    0x1c(%edx),%eax
+  80054d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800550:	8b 42 20             	mov    0x20(%edx),%eax
+  800553:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (req.nslots == 0 || req.nslots > PAGEREQ_PAGE_IN_MAXPAGES || req.nslots > pagereq_npages) {
+  800556:	8d 41 ff             	lea    -0x1(%ecx),%eax
+  800559:	83 f8 07             	cmp    $0x7,%eax
+  80055c:	0f 87 f7 00 00 00    	ja     800659 <serve_page_in_range+0x147>
+  800562:	39 0d a0 d3 82 00    	cmp    %ecx,0x82d3a0
+  800568:	0f 82 f2 00 00 00    	jb     800660 <serve_page_in_range+0x14e>
+  80056e:	8d 5d c4             	lea    -0x3c(%ebp),%ebx
+  800571:	8d 3c 8b             	lea    (%ebx,%ecx,4),%edi
+  800574:	89 de                	mov    %ebx,%esi
+  800576:	89 5d b4             	mov    %ebx,-0x4c(%ebp)
+	for (i = 0; i < req.nslots; ++i) {
+  800579:	39 fe                	cmp    %edi,%esi
+  80057b:	74 30                	je     8005ad <serve_page_in_range+0x9b>
+		if (!page_slot_ours(req.slots[i]) || !page_block_refs[OURSLOT(req.slots[i])]) {
+  80057d:	8b 5e 04             	mov    0x4(%esi),%ebx
+  800580:	83 ec 0c             	sub    $0xc,%esp
+  800583:	53                   	push   %ebx
+  800584:	e8 f7 fe ff ff       	call   800480 <page_slot_ours>
+  800589:	83 c4 10             	add    $0x10,%esp
+  80058c:	84 c0                	test   %al,%al
+  80058e:	0f 84 d3 00 00 00    	je     800667 <serve_page_in_range+0x155>
+  800594:	0f b7 db             	movzwl %bx,%ebx
+  800597:	83 c6 04             	add    $0x4,%esi
+  80059a:	66 83 bc 1b a0 d0 80 	cmpw   $0x0,0x80d0a0(%ebx,%ebx,1)
+  8005a1:	00 00 
+  8005a3:	0f 84 cb 00 00 00    	je     800674 <serve_page_in_range+0x162>
+		req.slots[i] = OURSLOT(req.slots[i]);
+  8005a9:	89 1e                	mov    %ebx,(%esi)
+	for (i = 0; i < req.nslots; ++i) {
+  8005ab:	eb cc                	jmp    800579 <serve_page_in_range+0x67>
+	for (i = 0; i < req.nslots; i = j) {
+  8005ad:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+  8005b0:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+  8005b7:	89 5d a8             	mov    %ebx,-0x58(%ebp)
+  8005ba:	89 75 a4             	mov    %esi,-0x5c(%ebp)
+  8005bd:	8b 75 ac             	mov    -0x54(%ebp),%esi
+  8005c0:	eb 49                	jmp    80060b <serve_page_in_range+0xf9>
+			     req.slots[j] < area->first + area->nslots; ++j)
+  8005c2:	83 c3 01             	add    $0x1,%ebx
+		for (j = i + 1; j < req.nslots && req.slots[j] == req.slots[i] + (j - i) &&
+  8005c5:	39 f3                	cmp    %esi,%ebx
+  8005c7:	74 17                	je     8005e0 <serve_page_in_range+0xce>
+  8005c9:	8b 54 9d c8          	mov    -0x38(%ebp,%ebx,4),%edx
+  8005cd:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  8005d0:	39 c2                	cmp    %eax,%edx
+  8005d2:	75 0e                	jne    8005e2 <serve_page_in_range+0xd0>
+			     req.slots[j] < area->first + area->nslots; ++j)
+  8005d4:	8b 41 0c             	mov    0xc(%ecx),%eax
+  8005d7:	03 41 08             	add    0x8(%ecx),%eax
+		for (j = i + 1; j < req.nslots && req.slots[j] == req.slots[i] + (j - i) &&
+  8005da:	39 c2                	cmp    %eax,%edx
+  8005dc:	72 e4                	jb     8005c2 <serve_page_in_range+0xb0>
+  8005de:	eb 02                	jmp    8005e2 <serve_page_in_range+0xd0>
+  8005e0:	89 f3                	mov    %esi,%ebx
+		if ((r = swap_io(req.slots[i], (void *)(ipc + i), j - i, 0)) < 0) {
+  8005e2:	6a 00                	push   $0x0
+  8005e4:	89 d8                	mov    %ebx,%eax
+  8005e6:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+  8005e9:	29 c8                	sub    %ecx,%eax
+  8005eb:	50                   	push   %eax
+  8005ec:	89 c8                	mov    %ecx,%eax
+  8005ee:	c1 e0 0c             	shl    $0xc,%eax
+  8005f1:	03 45 10             	add    0x10(%ebp),%eax
+  8005f4:	50                   	push   %eax
+  8005f5:	ff 75 b0             	push   -0x50(%ebp)
+  8005f8:	e8 ea fa ff ff       	call   8000e7 <swap_io>
+  8005fd:	83 c4 10             	add    $0x10,%esp
+  800600:	85 c0                	test   %eax,%eax
+  800602:	78 68                	js     80066c <serve_page_in_range+0x15a>
+	for (i = 0; i < req.nslots; i = j) {
+  800604:	39 f3                	cmp    %esi,%ebx
+  800606:	73 24                	jae    80062c <serve_page_in_range+0x11a>
+  800608:	89 5d b4             	mov    %ebx,-0x4c(%ebp)
+		area = swap_area_of(req.slots[i]);
+  80060b:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+  80060e:	8b 7c 9d c8          	mov    -0x38(%ebp,%ebx,4),%edi
+  800612:	89 7d b0             	mov    %edi,-0x50(%ebp)
+  800615:	83 ec 0c             	sub    $0xc,%esp
+  800618:	57                   	push   %edi
+  800619:	e8 69 fa ff ff       	call   800087 <swap_area_of>
+  80061e:	83 c4 10             	add    $0x10,%esp
+  800621:	89 c1                	mov    %eax,%ecx
+		for (j = i + 1; j < req.nslots && req.slots[j] == req.slots[i] + (j - i) &&
+  800623:	89 d8                	mov    %ebx,%eax
+  800625:	8d 5b 01             	lea    0x1(%ebx),%ebx
+  800628:	29 c7                	sub    %eax,%edi
+  80062a:	eb 99                	jmp    8005c5 <serve_page_in_range+0xb3>
+  80062c:	8b 5d a8             	mov    -0x58(%ebp),%ebx
+  80062f:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  800632:	eb 11                	jmp    800645 <serve_page_in_range+0x133>
+		page_block_decref(req.slots[i]);    // other sharers of the block still need it
+  800634:	83 ec 0c             	sub    $0xc,%esp
+  800637:	ff 73 04             	push   0x4(%ebx)
+  80063a:	e8 f4 fd ff ff       	call   800433 <page_block_decref>
+	for (i = 0; i < req.nslots; ++i) {
+  80063f:	83 c3 04             	add    $0x4,%ebx
+  800642:	83 c4 10             	add    $0x10,%esp
+  800645:	39 f3                	cmp    %esi,%ebx
+  800647:	75 eb                	jne    800634 <serve_page_in_range+0x122>
+	serve_stats_s.num_page_ins += req.nslots;
+  800649:	8b 45 ac             	mov    -0x54(%ebp),%eax
+  80064c:	01 05 78 d0 80 00    	add    %eax,0x80d078
+	return 0;
+  800652:	b8 00 00 00 00       	mov    $0x0,%eax
+  800657:	eb 13                	jmp    80066c <serve_page_in_range+0x15a>
+		return -E_INVAL;
+  800659:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80065e:	eb 0c                	jmp    80066c <serve_page_in_range+0x15a>
+  800660:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800665:	eb 05                	jmp    80066c <serve_page_in_range+0x15a>
+			return -E_INVAL;
+  800667:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80066c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80066f:	5b                   	pop    %ebx
+  800670:	5e                   	pop    %esi
+  800671:	5f                   	pop    %edi
+  800672:	5d                   	pop    %ebp
+  800673:	c3                   	ret
+			return -E_INVAL;
+  800674:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800679:	eb f1                	jmp    80066c <serve_page_in_range+0x15a>
+
+0080067b <serve_page_remove>:
+{
+  80067b:	55                   	push   %ebp
+  80067c:	89 e5                	mov    %esp,%ebp
+  80067e:	53                   	push   %ebx
+  80067f:	83 ec 10             	sub    $0x10,%esp
+  800682:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (!page_slot_ours(blockno) || !page_block_refs[OURSLOT(blockno)]) {
+  800685:	53                   	push   %ebx
+  800686:	e8 f5 fd ff ff       	call   800480 <page_slot_ours>
+  80068b:	83 c4 10             	add    $0x10,%esp
+  80068e:	84 c0                	test   %al,%al
+  800690:	74 2b                	je     8006bd <serve_page_remove+0x42>
+  800692:	0f b7 db             	movzwl %bx,%ebx
+  800695:	66 83 bc 1b a0 d0 80 	cmpw   $0x0,0x80d0a0(%ebx,%ebx,1)
+  80069c:	00 00 
+  80069e:	74 24                	je     8006c4 <serve_page_remove+0x49>
+	page_block_decref(OURSLOT(blockno));
+  8006a0:	83 ec 0c             	sub    $0xc,%esp
+  8006a3:	53                   	push   %ebx
+  8006a4:	e8 8a fd ff ff       	call   800433 <page_block_decref>
+	++serve_stats_s.num_page_removes;
+  8006a9:	83 05 7c d0 80 00 01 	addl   $0x1,0x80d07c
+	return 0;
+  8006b0:	83 c4 10             	add    $0x10,%esp
+  8006b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006bb:	c9                   	leave
+  8006bc:	c3                   	ret
+		return -E_INVAL;
+  8006bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006c2:	eb f4                	jmp    8006b8 <serve_page_remove+0x3d>
+  8006c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006c9:	eb ed                	jmp    8006b8 <serve_page_remove+0x3d>
+
+008006cb <serve_page_share>:
+{
+  8006cb:	55                   	push   %ebp
+  8006cc:	89 e5                	mov    %esp,%ebp
+  8006ce:	57                   	push   %edi
+  8006cf:	56                   	push   %esi
+  8006d0:	53                   	push   %ebx
+  8006d1:	83 ec 1c             	sub    $0x1c,%esp
+  8006d4:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (req->nslots > PAGEREQ_SHARE_NSLOTS) {
+  8006d7:	8b 07                	mov    (%edi),%eax
+  8006d9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8006de:	0f 87 91 00 00 00    	ja     800775 <serve_page_share+0xaa>
+  8006e4:	8d 77 04             	lea    0x4(%edi),%esi
+  8006e7:	8d 04 86             	lea    (%esi,%eax,4),%eax
+  8006ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (i = 0; i < req->nslots; ++i) {
+  8006ed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8006f0:	39 c6                	cmp    %eax,%esi
+  8006f2:	74 2a                	je     80071e <serve_page_share+0x53>
+		if (!page_slot_ours(req->slots[i]) || !page_block_refs[OURSLOT(req->slots[i])]) {
+  8006f4:	8b 1e                	mov    (%esi),%ebx
+  8006f6:	83 ec 0c             	sub    $0xc,%esp
+  8006f9:	53                   	push   %ebx
+  8006fa:	e8 81 fd ff ff       	call   800480 <page_slot_ours>
+  8006ff:	83 c4 10             	add    $0x10,%esp
+  800702:	84 c0                	test   %al,%al
+  800704:	74 76                	je     80077c <serve_page_share+0xb1>
+  800706:	83 c6 04             	add    $0x4,%esi
+  800709:	0f b7 db             	movzwl %bx,%ebx
+  80070c:	66 83 bc 1b a0 d0 80 	cmpw   $0x0,0x80d0a0(%ebx,%ebx,1)
+  800713:	00 00 
+  800715:	75 d6                	jne    8006ed <serve_page_share+0x22>
+			return -E_INVAL;
+  800717:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80071c:	eb 4f                	jmp    80076d <serve_page_share+0xa2>
+	for (i = 0; i < req->nslots; ++i) {
+  80071e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800723:	3b 17                	cmp    (%edi),%edx
+  800725:	73 3a                	jae    800761 <serve_page_share+0x96>
+		if (page_block_refs[OURSLOT(req->slots[i])] == 0xFFFF) {
+  800727:	8b 5c 97 04          	mov    0x4(%edi,%edx,4),%ebx
+  80072b:	0f b7 cb             	movzwl %bx,%ecx
+  80072e:	0f b7 84 09 a0 d0 80 	movzwl 0x80d0a0(%ecx,%ecx,1),%eax
+  800735:	00 
+  800736:	66 83 f8 ff          	cmp    $0xffff,%ax
+  80073a:	74 10                	je     80074c <serve_page_share+0x81>
+		++page_block_refs[OURSLOT(req->slots[i])];
+  80073c:	83 c0 01             	add    $0x1,%eax
+  80073f:	66 89 84 09 a0 d0 80 	mov    %ax,0x80d0a0(%ecx,%ecx,1)
+  800746:	00 
+	for (i = 0; i < req->nslots; ++i) {
+  800747:	83 c2 01             	add    $0x1,%edx
+  80074a:	eb d7                	jmp    800723 <serve_page_share+0x58>
+			panic("serve_page_share: too many references to block %d", req->slots[i]);
+  80074c:	53                   	push   %ebx
+  80074d:	68 e4 39 80 00       	push   $0x8039e4
+  800752:	68 ba 01 00 00       	push   $0x1ba
+  800757:	68 ea 3a 80 00       	push   $0x803aea
+  80075c:	e8 68 0a 00 00       	call   8011c9 <_panic>
+	++serve_stats_s.num_page_shares;
+  800761:	83 05 80 d0 80 00 01 	addl   $0x1,0x80d080
+	return 0;
+  800768:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80076d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800770:	5b                   	pop    %ebx
+  800771:	5e                   	pop    %esi
+  800772:	5f                   	pop    %edi
+  800773:	5d                   	pop    %ebp
+  800774:	c3                   	ret
+		return -E_INVAL;
+  800775:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80077a:	eb f1                	jmp    80076d <serve_page_share+0xa2>
+			return -E_INVAL;
+  80077c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800781:	eb ea                	jmp    80076d <serve_page_share+0xa2>
+
+00800783 <swap_area_add>:
+{
+  800783:	55                   	push   %ebp
+  800784:	89 e5                	mov    %esp,%ebp
+  800786:	57                   	push   %edi
+  800787:	56                   	push   %esi
+  800788:	53                   	push   %ebx
+  800789:	83 ec 04             	sub    $0x4,%esp
+	if (share > PAGESERV_NSLOTS - page_nslots) {
+  80078c:	8b 35 68 d0 80 00    	mov    0x80d068,%esi
+	share = nslots / NPAGESERV / NBLOCKS_PER_GROUP * NBLOCKS_PER_GROUP;
+  800792:	8b 45 10             	mov    0x10(%ebp),%eax
+  800795:	c1 e8 06             	shr    $0x6,%eax
+  800798:	c1 e0 05             	shl    $0x5,%eax
+	if (share > PAGESERV_NSLOTS - page_nslots) {
+  80079b:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8007a0:	29 f2                	sub    %esi,%edx
+  8007a2:	39 d0                	cmp    %edx,%eax
+  8007a4:	0f 47 c2             	cmova  %edx,%eax
+	if (share == 0 || nswap_areas == MAXSWAPAREAS) {
+  8007a7:	85 c0                	test   %eax,%eax
+  8007a9:	0f 84 96 00 00 00    	je     800845 <swap_area_add+0xc2>
+  8007af:	8b 3d a4 d3 82 00    	mov    0x82d3a4,%edi
+  8007b5:	83 ff 03             	cmp    $0x3,%edi
+  8007b8:	0f 84 87 00 00 00    	je     800845 <swap_area_add+0xc2>
+	area = &swap_areas[nswap_areas++];
+  8007be:	8d 57 01             	lea    0x1(%edi),%edx
+  8007c1:	89 15 a4 d3 82 00    	mov    %edx,0x82d3a4
+	area->disk = disk;
+  8007c7:	8d 0c 7f             	lea    (%edi,%edi,2),%ecx
+  8007ca:	c1 e1 03             	shl    $0x3,%ecx
+  8007cd:	8d 91 20 d0 80 00    	lea    0x80d020(%ecx),%edx
+  8007d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8007d6:	89 99 20 d0 80 00    	mov    %ebx,0x80d020(%ecx)
+	area->start = start + page_instance*share;
+  8007dc:	89 c1                	mov    %eax,%ecx
+  8007de:	0f af 0d a8 d3 82 00 	imul   0x82d3a8,%ecx
+  8007e5:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8007e8:	89 4a 04             	mov    %ecx,0x4(%edx)
+	area->first = page_nslots;
+  8007eb:	89 72 08             	mov    %esi,0x8(%edx)
+	area->nslots = share;
+  8007ee:	89 42 0c             	mov    %eax,0xc(%edx)
+	area->priority = priority;
+  8007f1:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8007f4:	89 4a 10             	mov    %ecx,0x10(%edx)
+	for (i = (area->first + share)/NBLOCKS_PER_GROUP; i-- > area->first/NBLOCKS_PER_GROUP; ) {
+  8007f7:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  8007fa:	89 ca                	mov    %ecx,%edx
+  8007fc:	c1 ea 05             	shr    $0x5,%edx
+  8007ff:	c1 ee 05             	shr    $0x5,%esi
+  800802:	8d 04 52             	lea    (%edx,%edx,2),%eax
+  800805:	8d 04 85 14 70 80 00 	lea    0x807014(,%eax,4),%eax
+  80080c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800811:	89 7d f0             	mov    %edi,-0x10(%ebp)
+  800814:	eb 15                	jmp    80082b <swap_area_add+0xa8>
+		page_bitmap_nodes[i].bitmap = 0;    // every block in the page swap space starts out free (indicated by 0 bits)
+  800816:	89 c2                	mov    %eax,%edx
+  800818:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		page_bitmap_nodes[i].groupno = i;
+  80081e:	89 78 04             	mov    %edi,0x4(%eax)
+		page_bitmap_nodes[i].link = area->free_list;
+  800821:	89 58 08             	mov    %ebx,0x8(%eax)
+		area->free_list = (page_bitmap_nodes+i);
+  800824:	83 e8 0c             	sub    $0xc,%eax
+		page_bitmap_nodes[i].link = area->free_list;
+  800827:	89 d3                	mov    %edx,%ebx
+	for (i = (area->first + share)/NBLOCKS_PER_GROUP; i-- > area->first/NBLOCKS_PER_GROUP; ) {
+  800829:	89 fa                	mov    %edi,%edx
+  80082b:	8d 7a ff             	lea    -0x1(%edx),%edi
+  80082e:	39 d6                	cmp    %edx,%esi
+  800830:	72 e4                	jb     800816 <swap_area_add+0x93>
+  800832:	8b 7d f0             	mov    -0x10(%ebp),%edi
+  800835:	8d 04 7f             	lea    (%edi,%edi,2),%eax
+  800838:	89 1c c5 34 d0 80 00 	mov    %ebx,0x80d034(,%eax,8)
+	page_nslots += share;
+  80083f:	89 0d 68 d0 80 00    	mov    %ecx,0x80d068
+}
+  800845:	83 c4 04             	add    $0x4,%esp
+  800848:	5b                   	pop    %ebx
+  800849:	5e                   	pop    %esi
+  80084a:	5f                   	pop    %edi
+  80084b:	5d                   	pop    %ebp
+  80084c:	c3                   	ret
+
+0080084d <swap_init>:
+{
+  80084d:	55                   	push   %ebp
+  80084e:	89 e5                	mov    %esp,%ebp
+  800850:	57                   	push   %edi
+  800851:	56                   	push   %esi
+  800852:	53                   	push   %ebx
+  800853:	83 ec 0c             	sub    $0xc,%esp
+	for (d = 1; d < 4; ++d) {
+  800856:	bb 01 00 00 00       	mov    $0x1,%ebx
+		start = 0;
+  80085b:	be 00 00 00 00       	mov    $0x0,%esi
+  800860:	eb 34                	jmp    800896 <swap_init+0x49>
+			if (ide_read(1*BLKSECTS, buf, BLKSECTS) < 0 || super->s_magic != FS_MAGIC) {
+  800862:	83 ec 04             	sub    $0x4,%esp
+  800865:	6a 08                	push   $0x8
+  800867:	68 00 60 80 00       	push   $0x806000
+  80086c:	6a 08                	push   $0x8
+  80086e:	e8 0e 07 00 00       	call   800f81 <ide_read>
+  800873:	83 c4 10             	add    $0x10,%esp
+  800876:	85 c0                	test   %eax,%eax
+  800878:	78 14                	js     80088e <swap_init+0x41>
+  80087a:	81 3d 00 60 80 00 ae 	cmpl   $0x4a0530ae,0x806000
+  800881:	30 05 4a 
+  800884:	75 08                	jne    80088e <swap_init+0x41>
+			start = super->s_nblocks;
+  800886:	8b 3d 04 60 80 00    	mov    0x806004,%edi
+  80088c:	eb 2b                	jmp    8008b9 <swap_init+0x6c>
+	for (d = 1; d < 4; ++d) {
+  80088e:	83 c3 01             	add    $0x1,%ebx
+  800891:	83 fb 04             	cmp    $0x4,%ebx
+  800894:	74 68                	je     8008fe <swap_init+0xb1>
+		if (!ide_probe_disk(d)) {
+  800896:	83 ec 0c             	sub    $0xc,%esp
+  800899:	53                   	push   %ebx
+  80089a:	e8 01 06 00 00       	call   800ea0 <ide_probe_disk>
+  80089f:	83 c4 10             	add    $0x10,%esp
+  8008a2:	84 c0                	test   %al,%al
+  8008a4:	74 e8                	je     80088e <swap_init+0x41>
+		ide_set_disk(d);
+  8008a6:	83 ec 0c             	sub    $0xc,%esp
+  8008a9:	53                   	push   %ebx
+  8008aa:	e8 a9 06 00 00       	call   800f58 <ide_set_disk>
+		if (d == 1) {
+  8008af:	83 c4 10             	add    $0x10,%esp
+		start = 0;
+  8008b2:	89 f7                	mov    %esi,%edi
+		if (d == 1) {
+  8008b4:	83 fb 01             	cmp    $0x1,%ebx
+  8008b7:	74 a9                	je     800862 <swap_init+0x15>
+		if (ide_read(start*BLKSECTS, buf, BLKSECTS) < 0 || hdr->sh_magic != SWAP_MAGIC) {
+  8008b9:	83 ec 04             	sub    $0x4,%esp
+  8008bc:	6a 08                	push   $0x8
+  8008be:	68 00 60 80 00       	push   $0x806000
+  8008c3:	8d 04 fd 00 00 00 00 	lea    0x0(,%edi,8),%eax
+  8008ca:	50                   	push   %eax
+  8008cb:	e8 b1 06 00 00       	call   800f81 <ide_read>
+  8008d0:	83 c4 10             	add    $0x10,%esp
+  8008d3:	85 c0                	test   %eax,%eax
+  8008d5:	78 b7                	js     80088e <swap_init+0x41>
+  8008d7:	81 3d 00 60 80 00 50 	cmpl   $0x53574150,0x806000
+  8008de:	41 57 53 
+  8008e1:	75 ab                	jne    80088e <swap_init+0x41>
+		swap_area_add(d, start + 1, hdr->sh_nslots, hdr->sh_priority);
+  8008e3:	ff 35 08 60 80 00    	push   0x806008
+  8008e9:	ff 35 04 60 80 00    	push   0x806004
+  8008ef:	83 c7 01             	add    $0x1,%edi
+  8008f2:	57                   	push   %edi
+  8008f3:	53                   	push   %ebx
+  8008f4:	e8 8a fe ff ff       	call   800783 <swap_area_add>
+  8008f9:	83 c4 10             	add    $0x10,%esp
+  8008fc:	eb 90                	jmp    80088e <swap_init+0x41>
+	if (nswap_areas == 0) {
+  8008fe:	83 3d a4 d3 82 00 00 	cmpl   $0x0,0x82d3a4
+  800905:	74 08                	je     80090f <swap_init+0xc2>
+}
+  800907:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80090a:	5b                   	pop    %ebx
+  80090b:	5e                   	pop    %esi
+  80090c:	5f                   	pop    %edi
+  80090d:	5d                   	pop    %ebp
+  80090e:	c3                   	ret
+		cprintf("page server %d: no swap space\n", page_instance);
+  80090f:	83 ec 08             	sub    $0x8,%esp
+  800912:	ff 35 a8 d3 82 00    	push   0x82d3a8
+  800918:	68 18 3a 80 00       	push   $0x803a18
+  80091d:	e8 82 09 00 00       	call   8012a4 <cprintf>
+  800922:	83 c4 10             	add    $0x10,%esp
+}
+  800925:	eb e0                	jmp    800907 <swap_init+0xba>
+
+00800927 <serve_init>:
+{
+  800927:	55                   	push   %ebp
+  800928:	89 e5                	mov    %esp,%ebp
+  80092a:	57                   	push   %edi
+  80092b:	56                   	push   %esi
+  80092c:	53                   	push   %ebx
+  80092d:	83 ec 0c             	sub    $0xc,%esp
+	for (i = 0; i < ENVX(thisenv->env_id); ++i) {
+  800930:	8b 0d b0 d3 82 00    	mov    0x82d3b0,%ecx
+  800936:	8b 1d a8 d3 82 00    	mov    0x82d3a8,%ebx
+  80093c:	be 00 00 00 00       	mov    $0x0,%esi
+  800941:	ba 00 00 00 00       	mov    $0x0,%edx
+			++page_instance;
+  800946:	bf 01 00 00 00       	mov    $0x1,%edi
+	for (i = 0; i < ENVX(thisenv->env_id); ++i) {
+  80094b:	eb 03                	jmp    800950 <serve_init+0x29>
+  80094d:	83 c2 01             	add    $0x1,%edx
+  800950:	8b 41 48             	mov    0x48(%ecx),%eax
+  800953:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800958:	39 d0                	cmp    %edx,%eax
+  80095a:	7e 1a                	jle    800976 <serve_init+0x4f>
+		if (envs[i].env_type == ENV_TYPE_PAGE) {
+  80095c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80095f:	c1 e0 06             	shl    $0x6,%eax
+  800962:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800967:	8b 40 50             	mov    0x50(%eax),%eax
+  80096a:	83 f8 02             	cmp    $0x2,%eax
+  80096d:	75 de                	jne    80094d <serve_init+0x26>
+			++page_instance;
+  80096f:	83 c3 01             	add    $0x1,%ebx
+  800972:	89 fe                	mov    %edi,%esi
+  800974:	eb d7                	jmp    80094d <serve_init+0x26>
+  800976:	89 f0                	mov    %esi,%eax
+  800978:	84 c0                	test   %al,%al
+  80097a:	74 06                	je     800982 <serve_init+0x5b>
+  80097c:	89 1d a8 d3 82 00    	mov    %ebx,0x82d3a8
+	if (page_instance >= NPAGESERV) {
+  800982:	83 3d a8 d3 82 00 01 	cmpl   $0x1,0x82d3a8
+  800989:	7f 74                	jg     8009ff <serve_init+0xd8>
+	swap_init();
+  80098b:	e8 bd fe ff ff       	call   80084d <swap_init>
+	sys_page_alloc(0, pagereq, PTE_U|PTE_P|PTE_W);
+  800990:	83 ec 04             	sub    $0x4,%esp
+  800993:	6a 07                	push   $0x7
+  800995:	ff 35 24 50 80 00    	push   0x805024
+  80099b:	6a 00                	push   $0x0
+  80099d:	e8 dc 13 00 00       	call   801d7e <sys_page_alloc>
+	sys_page_alloc(0, (void *) RECLAIMVA, PTE_U|PTE_P|PTE_W);
+  8009a2:	83 c4 0c             	add    $0xc,%esp
+  8009a5:	6a 07                	push   $0x7
+  8009a7:	68 00 f0 ff 1f       	push   $0x1ffff000
+  8009ac:	6a 00                	push   $0x0
+  8009ae:	e8 cb 13 00 00       	call   801d7e <sys_page_alloc>
+	sys_page_unmap(0, (void *) RECLAIMVA);
+  8009b3:	83 c4 08             	add    $0x8,%esp
+  8009b6:	68 00 f0 ff 1f       	push   $0x1ffff000
+  8009bb:	6a 00                	push   $0x0
+  8009bd:	e8 41 14 00 00       	call   801e03 <sys_page_unmap>
+	serve_stats_s.num_page_outs = 0;
+  8009c2:	c7 05 74 d0 80 00 00 	movl   $0x0,0x80d074
+  8009c9:	00 00 00 
+	serve_stats_s.num_page_ins = 0;
+  8009cc:	c7 05 78 d0 80 00 00 	movl   $0x0,0x80d078
+  8009d3:	00 00 00 
+	serve_stats_s.num_page_removes = 0;
+  8009d6:	c7 05 7c d0 80 00 00 	movl   $0x0,0x80d07c
+  8009dd:	00 00 00 
+	serve_stats_s.num_page_shares = 0;
+  8009e0:	c7 05 80 d0 80 00 00 	movl   $0x0,0x80d080
+  8009e7:	00 00 00 
+	serve_stats_s.num_page_reclaims = 0;
+  8009ea:	c7 05 84 d0 80 00 00 	movl   $0x0,0x80d084
+  8009f1:	00 00 00 
+}
+  8009f4:	83 c4 10             	add    $0x10,%esp
+  8009f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009fa:	5b                   	pop    %ebx
+  8009fb:	5e                   	pop    %esi
+  8009fc:	5f                   	pop    %edi
+  8009fd:	5d                   	pop    %ebp
+  8009fe:	c3                   	ret
+		panic("serve_init: more than %d page servers", NPAGESERV);
+  8009ff:	6a 02                	push   $0x2
+  800a01:	68 38 3a 80 00       	push   $0x803a38
+  800a06:	68 2e 01 00 00       	push   $0x12e
+  800a0b:	68 ea 3a 80 00       	push   $0x803aea
+  800a10:	e8 b4 07 00 00       	call   8011c9 <_panic>
+
+00800a15 <serve_ring>:
+// takes every request the client has posted on ring i, and posts their
+// completions, stopping early if the client hasn't taken enough of the
+// completions posted before
+void
+serve_ring(int i)
+{
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	57                   	push   %edi
+  800a19:	56                   	push   %esi
+  800a1a:	53                   	push   %ebx
+  800a1b:	83 ec 2c             	sub    $0x2c,%esp
+  800a1e:	8b 45 08             	mov    0x8(%ebp),%eax
+	return (struct Pagering *)(RINGMAP + i*PAGERING_NPAGES*PGSIZE);
+  800a21:	8d 90 00 40 00 00    	lea    0x4000(%eax),%edx
+  800a27:	89 d6                	mov    %edx,%esi
+  800a29:	c1 e6 0f             	shl    $0xf,%esi
+	struct Pagering_cqe *cqe;
+	struct Pageipc *data;
+	void *pg;
+	int r;
+
+	while (pr->sq_head != ring->sq_tail && pr->cq_tail - ring->cq_head < PAGERING_NENTRIES) {
+  800a2c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  800a2f:	8d 1c 85 a0 d0 82 00 	lea    0x82d0a0(,%eax,4),%ebx
+  800a36:	eb 4a                	jmp    800a82 <serve_ring+0x6d>
+		data = (struct Pageipc *)ring + 1 + sqe.data;
+		if ((sqe.op != PAGEREQ_PAGE_IN && sqe.op != PAGEREQ_PAGE_OUT && sqe.op != PAGEREQ_PAGE_REMOVE) ||
+		    (sqe.op != PAGEREQ_PAGE_REMOVE && sqe.data >= PAGERING_NDATA)) {
+			r = -E_INVAL;
+		} else {
+			r = handlers[sqe.op](pr->envid, sqe.slot, data, &pg);
+  800a38:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800a3b:	52                   	push   %edx
+		data = (struct Pageipc *)ring + 1 + sqe.data;
+  800a3c:	83 c1 01             	add    $0x1,%ecx
+  800a3f:	c1 e1 0c             	shl    $0xc,%ecx
+  800a42:	01 f1                	add    %esi,%ecx
+			r = handlers[sqe.op](pr->envid, sqe.slot, data, &pg);
+  800a44:	51                   	push   %ecx
+  800a45:	ff 70 14             	push   0x14(%eax)
+  800a48:	ff 33                	push   (%ebx)
+  800a4a:	ff 14 bd 00 50 80 00 	call   *0x805000(,%edi,4)
+  800a51:	89 c2                	mov    %eax,%edx
+  800a53:	83 c4 10             	add    $0x10,%esp
+		}
+		cqe = &ring->cq[pr->cq_tail % PAGERING_NENTRIES];
+  800a56:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a59:	89 c1                	mov    %eax,%ecx
+  800a5b:	83 e1 7f             	and    $0x7f,%ecx
+		cqe->tag = sqe.tag;
+  800a5e:	81 c1 02 01 00 00    	add    $0x102,%ecx
+  800a64:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a67:	89 3c ce             	mov    %edi,(%esi,%ecx,8)
+		cqe->res = r;
+  800a6a:	89 54 ce 04          	mov    %edx,0x4(%esi,%ecx,8)
+		ring->cq_tail = ++pr->cq_tail;
+  800a6e:	83 c0 01             	add    $0x1,%eax
+  800a71:	89 43 08             	mov    %eax,0x8(%ebx)
+  800a74:	89 46 0c             	mov    %eax,0xc(%esi)
+		ring->sq_head = ++pr->sq_head;
+  800a77:	8b 43 04             	mov    0x4(%ebx),%eax
+  800a7a:	83 c0 01             	add    $0x1,%eax
+  800a7d:	89 43 04             	mov    %eax,0x4(%ebx)
+  800a80:	89 06                	mov    %eax,(%esi)
+	while (pr->sq_head != ring->sq_tail && pr->cq_tail - ring->cq_head < PAGERING_NENTRIES) {
+  800a82:	8b 43 04             	mov    0x4(%ebx),%eax
+  800a85:	8b 56 04             	mov    0x4(%esi),%edx
+  800a88:	39 d0                	cmp    %edx,%eax
+  800a8a:	74 3c                	je     800ac8 <serve_ring+0xb3>
+  800a8c:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800a8f:	8b 53 08             	mov    0x8(%ebx),%edx
+  800a92:	29 ca                	sub    %ecx,%edx
+  800a94:	83 fa 7f             	cmp    $0x7f,%edx
+  800a97:	77 2f                	ja     800ac8 <serve_ring+0xb3>
+		sqe = ring->sq[pr->sq_head % PAGERING_NENTRIES];
+  800a99:	83 e0 7f             	and    $0x7f,%eax
+  800a9c:	c1 e0 04             	shl    $0x4,%eax
+  800a9f:	01 f0                	add    %esi,%eax
+  800aa1:	8b 78 10             	mov    0x10(%eax),%edi
+  800aa4:	8b 50 1c             	mov    0x1c(%eax),%edx
+  800aa7:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+			r = -E_INVAL;
+  800aaa:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+		if ((sqe.op != PAGEREQ_PAGE_IN && sqe.op != PAGEREQ_PAGE_OUT && sqe.op != PAGEREQ_PAGE_REMOVE) ||
+  800aaf:	83 ff 02             	cmp    $0x2,%edi
+  800ab2:	77 a2                	ja     800a56 <serve_ring+0x41>
+		sqe = ring->sq[pr->sq_head % PAGERING_NENTRIES];
+  800ab4:	8b 48 18             	mov    0x18(%eax),%ecx
+		    (sqe.op != PAGEREQ_PAGE_REMOVE && sqe.data >= PAGERING_NDATA)) {
+  800ab7:	0f 84 7b ff ff ff    	je     800a38 <serve_ring+0x23>
+  800abd:	83 f9 06             	cmp    $0x6,%ecx
+  800ac0:	0f 86 72 ff ff ff    	jbe    800a38 <serve_ring+0x23>
+  800ac6:	eb 8e                	jmp    800a56 <serve_ring+0x41>
+	}
+}
+  800ac8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800acb:	5b                   	pop    %ebx
+  800acc:	5e                   	pop    %esi
+  800acd:	5f                   	pop    %edi
+  800ace:	5d                   	pop    %ebp
+  800acf:	c3                   	ret
+
+00800ad0 <serve_ring_setup>:
+{
+  800ad0:	55                   	push   %ebp
+  800ad1:	89 e5                	mov    %esp,%ebp
+  800ad3:	57                   	push   %edi
+  800ad4:	56                   	push   %esi
+  800ad5:	53                   	push   %ebx
+  800ad6:	83 ec 0c             	sub    $0xc,%esp
+  800ad9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	if (pagereq_npages != PAGERING_NPAGES) {
+  800adc:	83 3d a0 d3 82 00 08 	cmpl   $0x8,0x82d3a0
+  800ae3:	0f 85 f0 00 00 00    	jne    800bd9 <serve_ring_setup+0x109>
+	int i, r, found = -1;
+  800ae9:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+	for (i = 0; i < NRINGS; ++i) {
+  800aee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800af3:	eb 08                	jmp    800afd <serve_ring_setup+0x2d>
+  800af5:	83 c3 01             	add    $0x1,%ebx
+  800af8:	83 fb 40             	cmp    $0x40,%ebx
+  800afb:	74 19                	je     800b16 <serve_ring_setup+0x46>
+		if (page_rings[i].envid == envid) {
+  800afd:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  800b00:	8b 04 85 a0 d0 82 00 	mov    0x82d0a0(,%eax,4),%eax
+  800b07:	39 f8                	cmp    %edi,%eax
+  800b09:	74 0d                	je     800b18 <serve_ring_setup+0x48>
+		if (found < 0 && page_rings[i].envid == 0) {
+  800b0b:	85 c0                	test   %eax,%eax
+  800b0d:	75 e6                	jne    800af5 <serve_ring_setup+0x25>
+  800b0f:	85 d2                	test   %edx,%edx
+  800b11:	0f 48 d3             	cmovs  %ebx,%edx
+  800b14:	eb df                	jmp    800af5 <serve_ring_setup+0x25>
+  800b16:	89 d3                	mov    %edx,%ebx
+			found = i;
+  800b18:	be 00 00 00 00       	mov    $0x0,%esi
+  800b1d:	eb 11                	jmp    800b30 <serve_ring_setup+0x60>
+			serve_ring(i);   // what it left on its ring still counts
+  800b1f:	83 ec 0c             	sub    $0xc,%esp
+  800b22:	56                   	push   %esi
+  800b23:	e8 ed fe ff ff       	call   800a15 <serve_ring>
+  800b28:	83 c4 10             	add    $0x10,%esp
+			found = i;
+  800b2b:	89 f3                	mov    %esi,%ebx
+	for (i = 0; found < 0 && i < NRINGS; ++i) {
+  800b2d:	83 c6 01             	add    $0x1,%esi
+  800b30:	85 db                	test   %ebx,%ebx
+  800b32:	79 3d                	jns    800b71 <serve_ring_setup+0xa1>
+  800b34:	83 fe 3f             	cmp    $0x3f,%esi
+  800b37:	7f 38                	jg     800b71 <serve_ring_setup+0xa1>
+		if (envs[ENVX(page_rings[i].envid)].env_id != page_rings[i].envid ||
+  800b39:	8d 04 76             	lea    (%esi,%esi,2),%eax
+  800b3c:	8b 0c 85 a0 d0 82 00 	mov    0x82d0a0(,%eax,4),%ecx
+  800b43:	89 ca                	mov    %ecx,%edx
+  800b45:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800b4b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  800b4e:	c1 e0 06             	shl    $0x6,%eax
+  800b51:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800b56:	8b 40 48             	mov    0x48(%eax),%eax
+  800b59:	39 c1                	cmp    %eax,%ecx
+  800b5b:	75 c2                	jne    800b1f <serve_ring_setup+0x4f>
+		    envs[ENVX(page_rings[i].envid)].env_status == ENV_FREE) {
+  800b5d:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  800b60:	c1 e0 06             	shl    $0x6,%eax
+  800b63:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800b68:	8b 40 54             	mov    0x54(%eax),%eax
+		if (envs[ENVX(page_rings[i].envid)].env_id != page_rings[i].envid ||
+  800b6b:	85 c0                	test   %eax,%eax
+  800b6d:	75 be                	jne    800b2d <serve_ring_setup+0x5d>
+  800b6f:	eb ae                	jmp    800b1f <serve_ring_setup+0x4f>
+	if (found < 0) {
+  800b71:	85 db                	test   %ebx,%ebx
+  800b73:	78 6b                	js     800be0 <serve_ring_setup+0x110>
+	return (struct Pagering *)(RINGMAP + i*PAGERING_NPAGES*PGSIZE);
+  800b75:	8d b3 00 40 00 00    	lea    0x4000(%ebx),%esi
+  800b7b:	c1 e6 0f             	shl    $0xf,%esi
+	if ((r = sys_page_map_range(0, ipc, 0, page_ring_addr(found), PAGERING_NPAGES, PTE_P|PTE_U|PTE_W)) < 0) {
+  800b7e:	83 ec 08             	sub    $0x8,%esp
+  800b81:	6a 07                	push   $0x7
+  800b83:	6a 08                	push   $0x8
+  800b85:	56                   	push   %esi
+  800b86:	6a 00                	push   $0x0
+  800b88:	ff 75 10             	push   0x10(%ebp)
+  800b8b:	6a 00                	push   $0x0
+  800b8d:	e8 3a 13 00 00       	call   801ecc <sys_page_map_range>
+  800b92:	83 c4 20             	add    $0x20,%esp
+  800b95:	85 c0                	test   %eax,%eax
+  800b97:	78 38                	js     800bd1 <serve_ring_setup+0x101>
+	page_rings[found].envid = envid;
+  800b99:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+  800b9c:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  800b9f:	c1 e2 02             	shl    $0x2,%edx
+  800ba2:	89 ba a0 d0 82 00    	mov    %edi,0x82d0a0(%edx)
+	page_rings[found].sq_head = page_ring_addr(found)->sq_head = 0;
+  800ba8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  800bae:	c7 82 a4 d0 82 00 00 	movl   $0x0,0x82d0a4(%edx)
+  800bb5:	00 00 00 
+	page_rings[found].cq_tail = page_ring_addr(found)->cq_tail = 0;
+  800bb8:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  800bbf:	01 d8                	add    %ebx,%eax
+  800bc1:	c7 04 85 a8 d0 82 00 	movl   $0x0,0x82d0a8(,%eax,4)
+  800bc8:	00 00 00 00 
+	return 0;
+  800bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bd4:	5b                   	pop    %ebx
+  800bd5:	5e                   	pop    %esi
+  800bd6:	5f                   	pop    %edi
+  800bd7:	5d                   	pop    %ebp
+  800bd8:	c3                   	ret
+		return -E_INVAL;
+  800bd9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bde:	eb f1                	jmp    800bd1 <serve_ring_setup+0x101>
+		return -E_NO_MEM;
+  800be0:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  800be5:	eb ea                	jmp    800bd1 <serve_ring_setup+0x101>
+
+00800be7 <serve_rings>:
+
+// goes through every client's ring
+void
+serve_rings(void)
+{
+  800be7:	55                   	push   %ebp
+  800be8:	89 e5                	mov    %esp,%ebp
+  800bea:	53                   	push   %ebx
+  800beb:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < NRINGS; ++i) {
+  800bee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bf3:	eb 08                	jmp    800bfd <serve_rings+0x16>
+  800bf5:	83 c3 01             	add    $0x1,%ebx
+  800bf8:	83 fb 40             	cmp    $0x40,%ebx
+  800bfb:	74 1b                	je     800c18 <serve_rings+0x31>
+		if (page_rings[i].envid) {
+  800bfd:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  800c00:	83 3c 85 a0 d0 82 00 	cmpl   $0x0,0x82d0a0(,%eax,4)
+  800c07:	00 
+  800c08:	74 eb                	je     800bf5 <serve_rings+0xe>
+			serve_ring(i);
+  800c0a:	83 ec 0c             	sub    $0xc,%esp
+  800c0d:	53                   	push   %ebx
+  800c0e:	e8 02 fe ff ff       	call   800a15 <serve_ring>
+  800c13:	83 c4 10             	add    $0x10,%esp
+  800c16:	eb dd                	jmp    800bf5 <serve_rings+0xe>
+		}
+	}
+}
+  800c18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c1b:	c9                   	leave
+  800c1c:	c3                   	ret
+
+00800c1d <serve>:
+
+void
+serve(void)
+{
+  800c1d:	55                   	push   %ebp
+  800c1e:	89 e5                	mov    %esp,%ebp
+  800c20:	57                   	push   %edi
+  800c21:	56                   	push   %esi
+  800c22:	53                   	push   %ebx
+  800c23:	83 ec 28             	sub    $0x28,%esp
+	uint32_t req, whom;
+	int perm, r;
+	void *pg;
+
+	perm = 0;
+  800c26:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+	req = ipc_recv_pages((int32_t *) &whom, pagereq, PAGEREQ_PAGE_IN_MAXPAGES, &perm, &pagereq_npages);
+  800c2d:	68 a0 d3 82 00       	push   $0x82d3a0
+  800c32:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800c35:	50                   	push   %eax
+  800c36:	6a 08                	push   $0x8
+  800c38:	ff 35 24 50 80 00    	push   0x805024
+  800c3e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800c41:	50                   	push   %eax
+  800c42:	e8 d2 16 00 00       	call   802319 <ipc_recv_pages>
+  800c47:	83 c4 20             	add    $0x20,%esp
+			cprintf("page req %d from %08x [page %08x: %s]\n",
+				req, whom, uvpt[PGNUM(pagereq)], pagereq);
+
+		// All requests except PAGE_REMOVE, RING_ENTER and PAGE_RECLAIM
+		// must contain an argument page
+		if (!(perm & PTE_P) && (req&PAGEREQ_MASK) != PAGEREQ_PAGE_REMOVE &&
+  800c4a:	bb 84 01 00 00       	mov    $0x184,%ebx
+		}
+
+		// Reply, and switch straight back to the client, which is
+		// waiting in ipc_call; the next request lands in a cleared
+		// pagereq window.
+		req = ipc_reply_recv(whom, r, pagereq, PAGEREQ_PAGE_IN_MAXPAGES, pg ? perm : 0,
+  800c4f:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  800c52:	e9 8b 00 00 00       	jmp    800ce2 <serve+0xc5>
+			cprintf("Invalid request from %08x: no argument page\n",
+  800c57:	83 ec 08             	sub    $0x8,%esp
+  800c5a:	ff 75 e4             	push   -0x1c(%ebp)
+  800c5d:	68 60 3a 80 00       	push   $0x803a60
+  800c62:	e8 3d 06 00 00       	call   8012a4 <cprintf>
+			perm = 0;
+  800c67:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+			req = ipc_recv_pages((int32_t *) &whom, pagereq, PAGEREQ_PAGE_IN_MAXPAGES, &perm, &pagereq_npages);
+  800c6e:	c7 04 24 a0 d3 82 00 	movl   $0x82d3a0,(%esp)
+  800c75:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800c78:	50                   	push   %eax
+  800c79:	6a 08                	push   $0x8
+  800c7b:	ff 35 24 50 80 00    	push   0x805024
+  800c81:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800c84:	50                   	push   %eax
+  800c85:	e8 8f 16 00 00       	call   802319 <ipc_recv_pages>
+			continue;
+  800c8a:	83 c4 20             	add    $0x20,%esp
+  800c8d:	eb 53                	jmp    800ce2 <serve+0xc5>
+			cprintf("Invalid request code %d from %08x\n", req, whom);
+  800c8f:	83 ec 04             	sub    $0x4,%esp
+  800c92:	ff 75 e4             	push   -0x1c(%ebp)
+  800c95:	50                   	push   %eax
+  800c96:	68 90 3a 80 00       	push   $0x803a90
+  800c9b:	e8 04 06 00 00       	call   8012a4 <cprintf>
+  800ca0:	83 c4 10             	add    $0x10,%esp
+			r = -E_INVAL;
+  800ca3:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+		serve_rings();
+  800ca8:	e8 3a ff ff ff       	call   800be7 <serve_rings>
+		if (pg && pg != pagereq) {
+  800cad:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  800cb0:	85 c0                	test   %eax,%eax
+  800cb2:	0f 84 87 00 00 00    	je     800d3f <serve+0x122>
+  800cb8:	3b 05 24 50 80 00    	cmp    0x805024,%eax
+  800cbe:	75 68                	jne    800d28 <serve+0x10b>
+		req = ipc_reply_recv(whom, r, pagereq, PAGEREQ_PAGE_IN_MAXPAGES, pg ? perm : 0,
+  800cc0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800cc3:	68 a0 d3 82 00       	push   $0x82d3a0
+  800cc8:	56                   	push   %esi
+  800cc9:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  800ccc:	52                   	push   %edx
+  800ccd:	50                   	push   %eax
+  800cce:	6a 08                	push   $0x8
+  800cd0:	ff 35 24 50 80 00    	push   0x805024
+  800cd6:	57                   	push   %edi
+  800cd7:	ff 75 e4             	push   -0x1c(%ebp)
+  800cda:	e8 df 17 00 00       	call   8024be <ipc_reply_recv>
+  800cdf:	83 c4 20             	add    $0x20,%esp
+		if (!(perm & PTE_P) && (req&PAGEREQ_MASK) != PAGEREQ_PAGE_REMOVE &&
+  800ce2:	89 c1                	mov    %eax,%ecx
+  800ce4:	83 e1 0f             	and    $0xf,%ecx
+  800ce7:	89 da                	mov    %ebx,%edx
+  800ce9:	d3 ea                	shr    %cl,%edx
+  800ceb:	0b 55 e0             	or     -0x20(%ebp),%edx
+		    (req&PAGEREQ_MASK) != PAGEREQ_RING_ENTER &&
+  800cee:	f6 c2 01             	test   $0x1,%dl
+  800cf1:	0f 84 60 ff ff ff    	je     800c57 <serve+0x3a>
+		pg = NULL;
+  800cf7:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+		if (((req&PAGEREQ_MASK) < NHANDLERS) && handlers[req&PAGEREQ_MASK]) {
+  800cfe:	83 f9 08             	cmp    $0x8,%ecx
+  800d01:	77 8c                	ja     800c8f <serve+0x72>
+  800d03:	8b 14 8d 00 50 80 00 	mov    0x805000(,%ecx,4),%edx
+  800d0a:	85 d2                	test   %edx,%edx
+  800d0c:	74 81                	je     800c8f <serve+0x72>
+			r = handlers[req&PAGEREQ_MASK](whom, req>>PAGEREQ_SHIFT, pagereq, &pg);
+  800d0e:	8d 4d dc             	lea    -0x24(%ebp),%ecx
+  800d11:	51                   	push   %ecx
+  800d12:	ff 35 24 50 80 00    	push   0x805024
+  800d18:	c1 e8 04             	shr    $0x4,%eax
+  800d1b:	50                   	push   %eax
+  800d1c:	ff 75 e4             	push   -0x1c(%ebp)
+  800d1f:	ff d2                	call   *%edx
+  800d21:	89 c7                	mov    %eax,%edi
+  800d23:	83 c4 10             	add    $0x10,%esp
+  800d26:	eb 80                	jmp    800ca8 <serve+0x8b>
+			panic("serve: the page being returned isn't the request page");
+  800d28:	83 ec 04             	sub    $0x4,%esp
+  800d2b:	68 b4 3a 80 00       	push   $0x803ab4
+  800d30:	68 64 02 00 00       	push   $0x264
+  800d35:	68 ea 3a 80 00       	push   $0x803aea
+  800d3a:	e8 8a 04 00 00       	call   8011c9 <_panic>
+		req = ipc_reply_recv(whom, r, pagereq, PAGEREQ_PAGE_IN_MAXPAGES, pg ? perm : 0,
+  800d3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d44:	e9 7a ff ff ff       	jmp    800cc3 <serve+0xa6>
+
+00800d49 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800d49:	55                   	push   %ebp
+  800d4a:	89 e5                	mov    %esp,%ebp
+  800d4c:	83 ec 14             	sub    $0x14,%esp
+	binaryname = "page";
+  800d4f:	c7 05 2c 50 80 00 0d 	movl   $0x803b0d,0x80502c
+  800d56:	3b 80 00 
+	cprintf("Page server is running\n");
+  800d59:	68 12 3b 80 00       	push   $0x803b12
+  800d5e:	e8 41 05 00 00       	call   8012a4 <cprintf>
+
+	serve_init();
+  800d63:	e8 bf fb ff ff       	call   800927 <serve_init>
+	page_init();
+  800d68:	e8 c6 f2 ff ff       	call   800033 <page_init>
+	serve();
+  800d6d:	e8 ab fe ff ff       	call   800c1d <serve>
+
+00800d72 <ide_wait_ready>:
+		sys_futex_wake((const uint32_t *) l, 1);
+}
+
+static int
+ide_wait_ready(bool check_error)
+{
+  800d72:	55                   	push   %ebp
+  800d73:	89 e5                	mov    %esp,%ebp
+  800d75:	53                   	push   %ebx
+  800d76:	89 c3                	mov    %eax,%ebx
+	int r;
+
+	while (((r = inb(IDE_BASE(diskno) + 7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+  800d78:	83 3d 28 50 80 00 01 	cmpl   $0x1,0x805028
+  800d7f:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800d84:	b8 77 01 00 00       	mov    $0x177,%eax
+  800d89:	0f 4f d0             	cmovg  %eax,%edx
+
+static __inline uint8_t
+inb(int port)
+{
+	uint8_t data;
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800d8c:	ec                   	in     (%dx),%al
+  800d8d:	89 c1                	mov    %eax,%ecx
+  800d8f:	83 e1 c0             	and    $0xffffffc0,%ecx
+  800d92:	80 f9 40             	cmp    $0x40,%cl
+  800d95:	75 f5                	jne    800d8c <ide_wait_ready+0x1a>
+		/* do nothing */;
+
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+		return -1;
+	return 0;
+  800d97:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+  800d9c:	84 db                	test   %bl,%bl
+  800d9e:	74 0a                	je     800daa <ide_wait_ready+0x38>
+  800da0:	a8 21                	test   $0x21,%al
+  800da2:	0f 95 c2             	setne  %dl
+  800da5:	0f b6 d2             	movzbl %dl,%edx
+  800da8:	f7 da                	neg    %edx
+}
+  800daa:	89 d0                	mov    %edx,%eax
+  800dac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800daf:	c9                   	leave
+  800db0:	c3                   	ret
+
+00800db1 <ide_lock>:
+{
+  800db1:	55                   	push   %ebp
+  800db2:	89 e5                	mov    %esp,%ebp
+  800db4:	56                   	push   %esi
+  800db5:	53                   	push   %ebx
+	volatile uint32_t *l = &ide_locks[IDE_CHANNEL(d)];
+  800db6:	d1 f8                	sar    %eax
+  800db8:	89 c2                	mov    %eax,%edx
+  800dba:	8d 1c 85 00 c0 ad de 	lea    -0x21524000(,%eax,4),%ebx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  800dc1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dc6:	f0 87 04 95 00 c0 ad 	lock xchg %eax,-0x21524000(,%edx,4)
+  800dcd:	de 
+  800dce:	be 02 00 00 00       	mov    $0x2,%esi
+	if (xchg(l, 1) == 0)
+  800dd3:	85 c0                	test   %eax,%eax
+  800dd5:	75 12                	jne    800de9 <ide_lock+0x38>
+  800dd7:	eb 19                	jmp    800df2 <ide_lock+0x41>
+		sys_futex_wait((const uint32_t *) l, 2, -1);
+  800dd9:	83 ec 04             	sub    $0x4,%esp
+  800ddc:	6a ff                	push   $0xffffffff
+  800dde:	6a 02                	push   $0x2
+  800de0:	53                   	push   %ebx
+  800de1:	e8 71 14 00 00       	call   802257 <sys_futex_wait>
+  800de6:	83 c4 10             	add    $0x10,%esp
+  800de9:	89 f0                	mov    %esi,%eax
+  800deb:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(l, 2) != 0)
+  800dee:	85 c0                	test   %eax,%eax
+  800df0:	75 e7                	jne    800dd9 <ide_lock+0x28>
+}
+  800df2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800df5:	5b                   	pop    %ebx
+  800df6:	5e                   	pop    %esi
+  800df7:	5d                   	pop    %ebp
+  800df8:	c3                   	ret
+
+00800df9 <ide_unlock>:
+	volatile uint32_t *l = &ide_locks[IDE_CHANNEL(d)];
+  800df9:	d1 f8                	sar    %eax
+  800dfb:	89 c2                	mov    %eax,%edx
+  800dfd:	8d 0c 85 00 c0 ad de 	lea    -0x21524000(,%eax,4),%ecx
+  800e04:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e09:	f0 87 04 95 00 c0 ad 	lock xchg %eax,-0x21524000(,%edx,4)
+  800e10:	de 
+	if (xchg(l, 0) == 2)
+  800e11:	83 f8 02             	cmp    $0x2,%eax
+  800e14:	74 01                	je     800e17 <ide_unlock+0x1e>
+  800e16:	c3                   	ret
+{
+  800e17:	55                   	push   %ebp
+  800e18:	89 e5                	mov    %esp,%ebp
+  800e1a:	83 ec 10             	sub    $0x10,%esp
+		sys_futex_wake((const uint32_t *) l, 1);
+  800e1d:	6a 01                	push   $0x1
+  800e1f:	51                   	push   %ecx
+  800e20:	e8 82 14 00 00       	call   8022a7 <sys_futex_wake>
+  800e25:	83 c4 10             	add    $0x10,%esp
+}
+  800e28:	c9                   	leave
+  800e29:	c3                   	ret
+
+00800e2a <ide_probe_disk1>:
+
+bool
+ide_probe_disk1(void)
+{
+  800e2a:	55                   	push   %ebp
+  800e2b:	89 e5                	mov    %esp,%ebp
+  800e2d:	53                   	push   %ebx
+  800e2e:	83 ec 04             	sub    $0x4,%esp
+	int r, x;
+
+	ide_lock(0);
+  800e31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e36:	e8 76 ff ff ff       	call   800db1 <ide_lock>
+	// wait for Device 0 to be ready
+	ide_wait_ready(0);
+  800e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e40:	e8 2d ff ff ff       	call   800d72 <ide_wait_ready>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800e45:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  800e4a:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800e4f:	ee                   	out    %al,(%dx)
+
+	// switch to Device 1
+	outb(0x1F6, 0xE0 | (1<<4));
+
+	// check for Device 1 to be ready for a while
+	for (x = 0;
+  800e50:	bb 00 00 00 00       	mov    $0x0,%ebx
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800e55:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800e5a:	ec                   	in     (%dx),%al
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  800e5b:	a8 a1                	test   $0xa1,%al
+  800e5d:	74 0b                	je     800e6a <ide_probe_disk1+0x40>
+	     x++)
+  800e5f:	83 c3 01             	add    $0x1,%ebx
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  800e62:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  800e68:	75 f0                	jne    800e5a <ide_probe_disk1+0x30>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800e6a:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+  800e6f:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800e74:	ee                   	out    %al,(%dx)
+		/* do nothing */;
+
+	// switch back to Device 0
+	outb(0x1F6, 0xE0 | (0<<4));
+	ide_unlock(0);
+  800e75:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7a:	e8 7a ff ff ff       	call   800df9 <ide_unlock>
+
+	cprintf("Device 1 presence: %d\n", (x < 1000));
+  800e7f:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+  800e85:	0f 9e c3             	setle  %bl
+  800e88:	83 ec 08             	sub    $0x8,%esp
+  800e8b:	0f b6 c3             	movzbl %bl,%eax
+  800e8e:	50                   	push   %eax
+  800e8f:	68 2a 3b 80 00       	push   $0x803b2a
+  800e94:	e8 0b 04 00 00       	call   8012a4 <cprintf>
+	return (x < 1000);
+}
+  800e99:	89 d8                	mov    %ebx,%eax
+  800e9b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e9e:	c9                   	leave
+  800e9f:	c3                   	ret
+
+00800ea0 <ide_probe_disk>:
+// Is there a disk d?  Unlike ide_probe_disk1, this works for any disk,
+// including ones on a channel with nothing attached, and doesn't change
+// which disk ide_read and ide_write use.
+bool
+ide_probe_disk(int d)
+{
+  800ea0:	55                   	push   %ebp
+  800ea1:	89 e5                	mov    %esp,%ebp
+  800ea3:	57                   	push   %edi
+  800ea4:	56                   	push   %esi
+  800ea5:	53                   	push   %ebx
+  800ea6:	83 ec 1c             	sub    $0x1c,%esp
+  800ea9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	int base = IDE_BASE(d), r, x;
+  800eac:	83 ff 01             	cmp    $0x1,%edi
+  800eaf:	be 70 01 00 00       	mov    $0x170,%esi
+  800eb4:	b8 f0 01 00 00       	mov    $0x1f0,%eax
+  800eb9:	0f 4e f0             	cmovle %eax,%esi
+
+	ide_lock(d);
+  800ebc:	89 f8                	mov    %edi,%eax
+  800ebe:	e8 ee fe ff ff       	call   800db1 <ide_lock>
+	// an empty channel floats high
+	if (inb(base + 7) == 0xFF) {
+  800ec3:	8d 4e 07             	lea    0x7(%esi),%ecx
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800ec6:	89 ca                	mov    %ecx,%edx
+  800ec8:	ec                   	in     (%dx),%al
+	return data;
+  800ec9:	bb e9 03 00 00       	mov    $0x3e9,%ebx
+  800ece:	3c ff                	cmp    $0xff,%al
+  800ed0:	74 69                	je     800f3b <ide_probe_disk+0x9b>
+		ide_unlock(d);
+		return 0;
+	}
+
+	for (x = 0; x < 1000 && (inb(base + 7) & IDE_BSY) != 0; x++)
+  800ed2:	83 eb 01             	sub    $0x1,%ebx
+  800ed5:	74 05                	je     800edc <ide_probe_disk+0x3c>
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800ed7:	ec                   	in     (%dx),%al
+  800ed8:	84 c0                	test   %al,%al
+  800eda:	78 f6                	js     800ed2 <ide_probe_disk+0x32>
+		/* do nothing */;
+
+	outb(base + 6, 0xE0 | ((d&1)<<4));
+  800edc:	89 d1                	mov    %edx,%ecx
+  800ede:	8d 56 06             	lea    0x6(%esi),%edx
+  800ee1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800ee4:	89 f8                	mov    %edi,%eax
+  800ee6:	c1 e0 04             	shl    $0x4,%eax
+  800ee9:	83 e0 10             	and    $0x10,%eax
+  800eec:	83 c8 e0             	or     $0xffffffe0,%eax
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800eef:	ee                   	out    %al,(%dx)
+	for (x = 0;
+  800ef0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef5:	89 ca                	mov    %ecx,%edx
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800ef7:	ec                   	in     (%dx),%al
+	     x < 1000 && ((r = inb(base + 7)) & (IDE_BSY|IDE_DRDY|IDE_DF|IDE_ERR)) != IDE_DRDY;
+  800ef8:	83 e0 e1             	and    $0xffffffe1,%eax
+  800efb:	3c 40                	cmp    $0x40,%al
+  800efd:	74 0b                	je     800f0a <ide_probe_disk+0x6a>
+	     x++)
+  800eff:	83 c3 01             	add    $0x1,%ebx
+	     x < 1000 && ((r = inb(base + 7)) & (IDE_BSY|IDE_DRDY|IDE_DF|IDE_ERR)) != IDE_DRDY;
+  800f02:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  800f08:	75 ed                	jne    800ef7 <ide_probe_disk+0x57>
+		/* do nothing */;
+
+	// switch back to the disk we were using, if it's on this channel
+	if (IDE_BASE(diskno) == base)
+  800f0a:	a1 28 50 80 00       	mov    0x805028,%eax
+  800f0f:	83 f8 01             	cmp    $0x1,%eax
+  800f12:	b9 70 01 00 00       	mov    $0x170,%ecx
+  800f17:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  800f1c:	0f 4e ca             	cmovle %edx,%ecx
+  800f1f:	39 ce                	cmp    %ecx,%esi
+  800f21:	74 26                	je     800f49 <ide_probe_disk+0xa9>
+		outb(base + 6, 0xE0 | ((diskno&1)<<4));
+	ide_unlock(d);
+  800f23:	89 f8                	mov    %edi,%eax
+  800f25:	e8 cf fe ff ff       	call   800df9 <ide_unlock>
+
+	return (x < 1000);
+  800f2a:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+  800f30:	0f 9e c0             	setle  %al
+}
+  800f33:	83 c4 1c             	add    $0x1c,%esp
+  800f36:	5b                   	pop    %ebx
+  800f37:	5e                   	pop    %esi
+  800f38:	5f                   	pop    %edi
+  800f39:	5d                   	pop    %ebp
+  800f3a:	c3                   	ret
+		ide_unlock(d);
+  800f3b:	89 f8                	mov    %edi,%eax
+  800f3d:	e8 b7 fe ff ff       	call   800df9 <ide_unlock>
+		return 0;
+  800f42:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f47:	eb ea                	jmp    800f33 <ide_probe_disk+0x93>
+		outb(base + 6, 0xE0 | ((diskno&1)<<4));
+  800f49:	c1 e0 04             	shl    $0x4,%eax
+  800f4c:	83 e0 10             	and    $0x10,%eax
+  800f4f:	83 c8 e0             	or     $0xffffffe0,%eax
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800f52:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800f55:	ee                   	out    %al,(%dx)
+}
+  800f56:	eb cb                	jmp    800f23 <ide_probe_disk+0x83>
+
+00800f58 <ide_set_disk>:
+
+void
+ide_set_disk(int d)
+{
+  800f58:	55                   	push   %ebp
+  800f59:	89 e5                	mov    %esp,%ebp
+  800f5b:	83 ec 08             	sub    $0x8,%esp
+  800f5e:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (d < 0 || d > 3)
+  800f61:	83 f8 03             	cmp    $0x3,%eax
+  800f64:	77 07                	ja     800f6d <ide_set_disk+0x15>
+		panic("bad disk number");
+	diskno = d;
+  800f66:	a3 28 50 80 00       	mov    %eax,0x805028
+}
+  800f6b:	c9                   	leave
+  800f6c:	c3                   	ret
+		panic("bad disk number");
+  800f6d:	83 ec 04             	sub    $0x4,%esp
+  800f70:	68 41 3b 80 00       	push   $0x803b41
+  800f75:	6a 7c                	push   $0x7c
+  800f77:	68 51 3b 80 00       	push   $0x803b51
+  800f7c:	e8 48 02 00 00       	call   8011c9 <_panic>
+
+00800f81 <ide_read>:
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs)
+{
+  800f81:	55                   	push   %ebp
+  800f82:	89 e5                	mov    %esp,%ebp
+  800f84:	57                   	push   %edi
+  800f85:	56                   	push   %esi
+  800f86:	53                   	push   %ebx
+  800f87:	83 ec 1c             	sub    $0x1c,%esp
+  800f8a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800f8d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800f90:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int base = IDE_BASE(diskno), r;
+  800f93:	a1 28 50 80 00       	mov    0x805028,%eax
+  800f98:	83 f8 01             	cmp    $0x1,%eax
+  800f9b:	b9 70 01 00 00       	mov    $0x170,%ecx
+  800fa0:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  800fa5:	0f 4f d1             	cmovg  %ecx,%edx
+  800fa8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+
+	assert(nsecs <= 256);
+  800fab:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+  800fb1:	0f 87 8a 00 00 00    	ja     801041 <ide_read+0xc0>
+
+	ide_lock(diskno);
+  800fb7:	e8 f5 fd ff ff       	call   800db1 <ide_lock>
+	ide_wait_ready(0);
+  800fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc1:	e8 ac fd ff ff       	call   800d72 <ide_wait_ready>
+
+	outb(base + 2, nsecs);
+  800fc6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800fc9:	8d 51 02             	lea    0x2(%ecx),%edx
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800fcc:	89 f8                	mov    %edi,%eax
+  800fce:	ee                   	out    %al,(%dx)
+	outb(base + 3, secno & 0xFF);
+  800fcf:	8d 51 03             	lea    0x3(%ecx),%edx
+  800fd2:	89 d8                	mov    %ebx,%eax
+  800fd4:	ee                   	out    %al,(%dx)
+	outb(base + 4, (secno >> 8) & 0xFF);
+  800fd5:	89 d8                	mov    %ebx,%eax
+  800fd7:	c1 e8 08             	shr    $0x8,%eax
+  800fda:	8d 51 04             	lea    0x4(%ecx),%edx
+  800fdd:	ee                   	out    %al,(%dx)
+	outb(base + 5, (secno >> 16) & 0xFF);
+  800fde:	89 d8                	mov    %ebx,%eax
+  800fe0:	c1 e8 10             	shr    $0x10,%eax
+  800fe3:	8d 51 05             	lea    0x5(%ecx),%edx
+  800fe6:	ee                   	out    %al,(%dx)
+	outb(base + 6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  800fe7:	0f b6 05 28 50 80 00 	movzbl 0x805028,%eax
+  800fee:	c1 e0 04             	shl    $0x4,%eax
+  800ff1:	83 e0 10             	and    $0x10,%eax
+  800ff4:	c1 eb 18             	shr    $0x18,%ebx
+  800ff7:	83 e3 0f             	and    $0xf,%ebx
+  800ffa:	09 d8                	or     %ebx,%eax
+  800ffc:	83 c8 e0             	or     $0xffffffe0,%eax
+  800fff:	8d 51 06             	lea    0x6(%ecx),%edx
+  801002:	ee                   	out    %al,(%dx)
+	outb(base + 7, 0x20);	// CMD 0x20 means read sector
+  801003:	8d 51 07             	lea    0x7(%ecx),%edx
+  801006:	b8 20 00 00 00       	mov    $0x20,%eax
+  80100b:	ee                   	out    %al,(%dx)
+
+	for (r = 0; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  80100c:	c1 e7 09             	shl    $0x9,%edi
+  80100f:	01 f7                	add    %esi,%edi
+  801011:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801016:	89 d8                	mov    %ebx,%eax
+  801018:	89 fb                	mov    %edi,%ebx
+  80101a:	39 de                	cmp    %ebx,%esi
+  80101c:	74 3c                	je     80105a <ide_read+0xd9>
+		if ((r = ide_wait_ready(1)) < 0)
+  80101e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801023:	e8 4a fd ff ff       	call   800d72 <ide_wait_ready>
+  801028:	85 c0                	test   %eax,%eax
+  80102a:	78 2e                	js     80105a <ide_read+0xd9>
+	__asm __volatile("cld\n\trepne\n\tinsl"			:
+  80102c:	89 f7                	mov    %esi,%edi
+  80102e:	b9 80 00 00 00       	mov    $0x80,%ecx
+  801033:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801036:	fc                   	cld
+  801037:	f2 6d                	repnz insl (%dx),%es:(%edi)
+	for (r = 0; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  801039:	81 c6 00 02 00 00    	add    $0x200,%esi
+  80103f:	eb d9                	jmp    80101a <ide_read+0x99>
+	assert(nsecs <= 256);
+  801041:	68 5a 3b 80 00       	push   $0x803b5a
+  801046:	68 67 3b 80 00       	push   $0x803b67
+  80104b:	68 85 00 00 00       	push   $0x85
+  801050:	68 51 3b 80 00       	push   $0x803b51
+  801055:	e8 6f 01 00 00       	call   8011c9 <_panic>
+			break;
+		insl(base, dst, SECTSIZE/4);
+	}
+
+	ide_unlock(diskno);
+  80105a:	89 c3                	mov    %eax,%ebx
+  80105c:	a1 28 50 80 00       	mov    0x805028,%eax
+  801061:	e8 93 fd ff ff       	call   800df9 <ide_unlock>
+	return r;
+}
+  801066:	89 d8                	mov    %ebx,%eax
+  801068:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80106b:	5b                   	pop    %ebx
+  80106c:	5e                   	pop    %esi
+  80106d:	5f                   	pop    %edi
+  80106e:	5d                   	pop    %ebp
+  80106f:	c3                   	ret
+
+00801070 <ide_write>:
+
+int
+ide_write(uint32_t secno, const void *src, size_t nsecs)
+{
+  801070:	55                   	push   %ebp
+  801071:	89 e5                	mov    %esp,%ebp
+  801073:	57                   	push   %edi
+  801074:	56                   	push   %esi
+  801075:	53                   	push   %ebx
+  801076:	83 ec 1c             	sub    $0x1c,%esp
+  801079:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80107c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80107f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int base = IDE_BASE(diskno), r;
+  801082:	a1 28 50 80 00       	mov    0x805028,%eax
+  801087:	83 f8 01             	cmp    $0x1,%eax
+  80108a:	b9 70 01 00 00       	mov    $0x170,%ecx
+  80108f:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  801094:	0f 4f d1             	cmovg  %ecx,%edx
+  801097:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+
+	assert(nsecs <= 256);
+  80109a:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+  8010a0:	0f 87 91 00 00 00    	ja     801137 <ide_write+0xc7>
+
+	ide_lock(diskno);
+  8010a6:	e8 06 fd ff ff       	call   800db1 <ide_lock>
+	ide_wait_ready(0);
+  8010ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b0:	e8 bd fc ff ff       	call   800d72 <ide_wait_ready>
+
+	outb(base + 2, nsecs);
+  8010b5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8010b8:	8d 51 02             	lea    0x2(%ecx),%edx
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8010bb:	89 f0                	mov    %esi,%eax
+  8010bd:	ee                   	out    %al,(%dx)
+	outb(base + 3, secno & 0xFF);
+  8010be:	8d 51 03             	lea    0x3(%ecx),%edx
+  8010c1:	89 d8                	mov    %ebx,%eax
+  8010c3:	ee                   	out    %al,(%dx)
+	outb(base + 4, (secno >> 8) & 0xFF);
+  8010c4:	89 d8                	mov    %ebx,%eax
+  8010c6:	c1 e8 08             	shr    $0x8,%eax
+  8010c9:	8d 51 04             	lea    0x4(%ecx),%edx
+  8010cc:	ee                   	out    %al,(%dx)
+	outb(base + 5, (secno >> 16) & 0xFF);
+  8010cd:	89 d8                	mov    %ebx,%eax
+  8010cf:	c1 e8 10             	shr    $0x10,%eax
+  8010d2:	8d 51 05             	lea    0x5(%ecx),%edx
+  8010d5:	ee                   	out    %al,(%dx)
+	outb(base + 6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  8010d6:	8b 0d 28 50 80 00    	mov    0x805028,%ecx
+  8010dc:	89 c8                	mov    %ecx,%eax
+  8010de:	c1 e0 04             	shl    $0x4,%eax
+  8010e1:	83 e0 10             	and    $0x10,%eax
+  8010e4:	c1 eb 18             	shr    $0x18,%ebx
+  8010e7:	83 e3 0f             	and    $0xf,%ebx
+  8010ea:	09 d8                	or     %ebx,%eax
+  8010ec:	83 c8 e0             	or     $0xffffffe0,%eax
+  8010ef:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8010f2:	8d 53 06             	lea    0x6(%ebx),%edx
+  8010f5:	ee                   	out    %al,(%dx)
+	outb(base + 7, 0x30);	// CMD 0x30 means write sector
+  8010f6:	8d 53 07             	lea    0x7(%ebx),%edx
+  8010f9:	b8 30 00 00 00       	mov    $0x30,%eax
+  8010fe:	ee                   	out    %al,(%dx)
+
+	for (r = 0; nsecs > 0; nsecs--, src += SECTSIZE) {
+  8010ff:	c1 e6 09             	shl    $0x9,%esi
+  801102:	01 fe                	add    %edi,%esi
+  801104:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801109:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80110c:	89 d8                	mov    %ebx,%eax
+  80110e:	89 f3                	mov    %esi,%ebx
+  801110:	39 df                	cmp    %ebx,%edi
+  801112:	74 3c                	je     801150 <ide_write+0xe0>
+		if ((r = ide_wait_ready(1)) < 0)
+  801114:	b8 01 00 00 00       	mov    $0x1,%eax
+  801119:	e8 54 fc ff ff       	call   800d72 <ide_wait_ready>
+  80111e:	85 c0                	test   %eax,%eax
+  801120:	78 2e                	js     801150 <ide_write+0xe0>
+	__asm __volatile("cld\n\trepne\n\toutsl"		:
+  801122:	89 fe                	mov    %edi,%esi
+  801124:	b9 80 00 00 00       	mov    $0x80,%ecx
+  801129:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80112c:	fc                   	cld
+  80112d:	f2 6f                	repnz outsl %ds:(%esi),(%dx)
+	for (r = 0; nsecs > 0; nsecs--, src += SECTSIZE) {
+  80112f:	81 c7 00 02 00 00    	add    $0x200,%edi
+  801135:	eb d9                	jmp    801110 <ide_write+0xa0>
+	assert(nsecs <= 256);
+  801137:	68 5a 3b 80 00       	push   $0x803b5a
+  80113c:	68 67 3b 80 00       	push   $0x803b67
+  801141:	68 a0 00 00 00       	push   $0xa0
+  801146:	68 51 3b 80 00       	push   $0x803b51
+  80114b:	e8 79 00 00 00       	call   8011c9 <_panic>
+			break;
+		outsl(base, src, SECTSIZE/4);
+	}
+
+	ide_unlock(diskno);
+  801150:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801153:	89 c3                	mov    %eax,%ebx
+  801155:	89 c8                	mov    %ecx,%eax
+  801157:	e8 9d fc ff ff       	call   800df9 <ide_unlock>
+	return r;
+}
+  80115c:	89 d8                	mov    %ebx,%eax
+  80115e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801161:	5b                   	pop    %ebx
+  801162:	5e                   	pop    %esi
+  801163:	5f                   	pop    %edi
+  801164:	5d                   	pop    %ebp
+  801165:	c3                   	ret
+
+00801166 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  801166:	55                   	push   %ebp
+  801167:	89 e5                	mov    %esp,%ebp
+  801169:	56                   	push   %esi
+  80116a:	53                   	push   %ebx
+  80116b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80116e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  801171:	e8 ca 0b 00 00       	call   801d40 <sys_getenvid>
+  801176:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80117b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80117e:	c1 e0 06             	shl    $0x6,%eax
+  801181:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801186:	a3 b0 d3 82 00       	mov    %eax,0x82d3b0
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80118b:	85 db                	test   %ebx,%ebx
+  80118d:	7e 07                	jle    801196 <libmain+0x30>
+		binaryname = argv[0];
+  80118f:	8b 06                	mov    (%esi),%eax
+  801191:	a3 2c 50 80 00       	mov    %eax,0x80502c
+
+	// call user main routine
+	umain(argc, argv);
+  801196:	83 ec 08             	sub    $0x8,%esp
+  801199:	56                   	push   %esi
+  80119a:	53                   	push   %ebx
+  80119b:	e8 a9 fb ff ff       	call   800d49 <umain>
+
+	// exit gracefully
+	exit();
+  8011a0:	e8 0a 00 00 00       	call   8011af <exit>
+}
+  8011a5:	83 c4 10             	add    $0x10,%esp
+  8011a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011ab:	5b                   	pop    %ebx
+  8011ac:	5e                   	pop    %esi
+  8011ad:	5d                   	pop    %ebp
+  8011ae:	c3                   	ret
+
+008011af <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8011af:	55                   	push   %ebp
+  8011b0:	89 e5                	mov    %esp,%ebp
+  8011b2:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8011b5:	e8 ac 15 00 00       	call   802766 <close_all>
+	sys_env_destroy(0);
+  8011ba:	83 ec 0c             	sub    $0xc,%esp
+  8011bd:	6a 00                	push   $0x0
+  8011bf:	e8 3b 0b 00 00       	call   801cff <sys_env_destroy>
+}
+  8011c4:	83 c4 10             	add    $0x10,%esp
+  8011c7:	c9                   	leave
+  8011c8:	c3                   	ret
+
+008011c9 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8011c9:	55                   	push   %ebp
+  8011ca:	89 e5                	mov    %esp,%ebp
+  8011cc:	56                   	push   %esi
+  8011cd:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8011ce:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8011d1:	8b 35 2c 50 80 00    	mov    0x80502c,%esi
+  8011d7:	e8 64 0b 00 00       	call   801d40 <sys_getenvid>
+  8011dc:	83 ec 0c             	sub    $0xc,%esp
+  8011df:	ff 75 0c             	push   0xc(%ebp)
+  8011e2:	ff 75 08             	push   0x8(%ebp)
+  8011e5:	56                   	push   %esi
+  8011e6:	50                   	push   %eax
+  8011e7:	68 88 3b 80 00       	push   $0x803b88
+  8011ec:	e8 b3 00 00 00       	call   8012a4 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8011f1:	83 c4 18             	add    $0x18,%esp
+  8011f4:	53                   	push   %ebx
+  8011f5:	ff 75 10             	push   0x10(%ebp)
+  8011f8:	e8 56 00 00 00       	call   801253 <vcprintf>
+	cprintf("\n");
+  8011fd:	c7 04 24 3f 3b 80 00 	movl   $0x803b3f,(%esp)
+  801204:	e8 9b 00 00 00       	call   8012a4 <cprintf>
+  801209:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80120c:	cc                   	int3
+	while (1)
+  80120d:	eb fd                	jmp    80120c <_panic+0x43>
+
+0080120f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80120f:	55                   	push   %ebp
+  801210:	89 e5                	mov    %esp,%ebp
+  801212:	53                   	push   %ebx
+  801213:	83 ec 04             	sub    $0x4,%esp
+  801216:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801219:	8b 13                	mov    (%ebx),%edx
+  80121b:	8d 42 01             	lea    0x1(%edx),%eax
+  80121e:	89 03                	mov    %eax,(%ebx)
+  801220:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801223:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801227:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80122c:	74 09                	je     801237 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80122e:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801232:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801235:	c9                   	leave
+  801236:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  801237:	83 ec 08             	sub    $0x8,%esp
+  80123a:	68 ff 00 00 00       	push   $0xff
+  80123f:	8d 43 08             	lea    0x8(%ebx),%eax
+  801242:	50                   	push   %eax
+  801243:	e8 69 0a 00 00       	call   801cb1 <sys_cputs>
+		b->idx = 0;
+  801248:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80124e:	83 c4 10             	add    $0x10,%esp
+  801251:	eb db                	jmp    80122e <putch+0x1f>
+
+00801253 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  801253:	55                   	push   %ebp
+  801254:	89 e5                	mov    %esp,%ebp
+  801256:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80125c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801263:	00 00 00 
+	b.cnt = 0;
+  801266:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80126d:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  801270:	ff 75 0c             	push   0xc(%ebp)
+  801273:	ff 75 08             	push   0x8(%ebp)
+  801276:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80127c:	50                   	push   %eax
+  80127d:	68 0f 12 80 00       	push   $0x80120f
+  801282:	e8 14 01 00 00       	call   80139b <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  801287:	83 c4 08             	add    $0x8,%esp
+  80128a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801290:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  801296:	50                   	push   %eax
+  801297:	e8 15 0a 00 00       	call   801cb1 <sys_cputs>
+
+	return b.cnt;
+}
+  80129c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8012a2:	c9                   	leave
+  8012a3:	c3                   	ret
+
+008012a4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8012a4:	55                   	push   %ebp
+  8012a5:	89 e5                	mov    %esp,%ebp
+  8012a7:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8012aa:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8012ad:	50                   	push   %eax
+  8012ae:	ff 75 08             	push   0x8(%ebp)
+  8012b1:	e8 9d ff ff ff       	call   801253 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8012b6:	c9                   	leave
+  8012b7:	c3                   	ret
+
+008012b8 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8012b8:	55                   	push   %ebp
+  8012b9:	89 e5                	mov    %esp,%ebp
+  8012bb:	57                   	push   %edi
+  8012bc:	56                   	push   %esi
+  8012bd:	53                   	push   %ebx
+  8012be:	83 ec 1c             	sub    $0x1c,%esp
+  8012c1:	89 c7                	mov    %eax,%edi
+  8012c3:	89 d6                	mov    %edx,%esi
+  8012c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012cb:	89 d1                	mov    %edx,%ecx
+  8012cd:	89 c2                	mov    %eax,%edx
+  8012cf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8012d2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8012d5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8012d8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8012db:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8012de:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8012e5:	39 c2                	cmp    %eax,%edx
+  8012e7:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8012ea:	72 3e                	jb     80132a <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8012ec:	83 ec 0c             	sub    $0xc,%esp
+  8012ef:	ff 75 18             	push   0x18(%ebp)
+  8012f2:	83 eb 01             	sub    $0x1,%ebx
+  8012f5:	53                   	push   %ebx
+  8012f6:	50                   	push   %eax
+  8012f7:	83 ec 08             	sub    $0x8,%esp
+  8012fa:	ff 75 e4             	push   -0x1c(%ebp)
+  8012fd:	ff 75 e0             	push   -0x20(%ebp)
+  801300:	ff 75 dc             	push   -0x24(%ebp)
+  801303:	ff 75 d8             	push   -0x28(%ebp)
+  801306:	e8 7d 23 00 00       	call   803688 <__udivdi3>
+  80130b:	83 c4 18             	add    $0x18,%esp
+  80130e:	52                   	push   %edx
+  80130f:	50                   	push   %eax
+  801310:	89 f2                	mov    %esi,%edx
+  801312:	89 f8                	mov    %edi,%eax
+  801314:	e8 9f ff ff ff       	call   8012b8 <printnum>
+  801319:	83 c4 20             	add    $0x20,%esp
+  80131c:	eb 13                	jmp    801331 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80131e:	83 ec 08             	sub    $0x8,%esp
+  801321:	56                   	push   %esi
+  801322:	ff 75 18             	push   0x18(%ebp)
+  801325:	ff d7                	call   *%edi
+  801327:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80132a:	83 eb 01             	sub    $0x1,%ebx
+  80132d:	85 db                	test   %ebx,%ebx
+  80132f:	7f ed                	jg     80131e <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801331:	83 ec 08             	sub    $0x8,%esp
+  801334:	56                   	push   %esi
+  801335:	83 ec 04             	sub    $0x4,%esp
+  801338:	ff 75 e4             	push   -0x1c(%ebp)
+  80133b:	ff 75 e0             	push   -0x20(%ebp)
+  80133e:	ff 75 dc             	push   -0x24(%ebp)
+  801341:	ff 75 d8             	push   -0x28(%ebp)
+  801344:	e8 5d 23 00 00       	call   8036a6 <__umoddi3>
+  801349:	83 c4 14             	add    $0x14,%esp
+  80134c:	0f be 80 ab 3b 80 00 	movsbl 0x803bab(%eax),%eax
+  801353:	50                   	push   %eax
+  801354:	ff d7                	call   *%edi
+}
+  801356:	83 c4 10             	add    $0x10,%esp
+  801359:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80135c:	5b                   	pop    %ebx
+  80135d:	5e                   	pop    %esi
+  80135e:	5f                   	pop    %edi
+  80135f:	5d                   	pop    %ebp
+  801360:	c3                   	ret
+
+00801361 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801361:	55                   	push   %ebp
+  801362:	89 e5                	mov    %esp,%ebp
+  801364:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801367:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80136b:	8b 10                	mov    (%eax),%edx
+  80136d:	3b 50 04             	cmp    0x4(%eax),%edx
+  801370:	73 0a                	jae    80137c <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801372:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801375:	89 08                	mov    %ecx,(%eax)
+  801377:	8b 45 08             	mov    0x8(%ebp),%eax
+  80137a:	88 02                	mov    %al,(%edx)
+}
+  80137c:	5d                   	pop    %ebp
+  80137d:	c3                   	ret
+
+0080137e <printfmt>:
+{
+  80137e:	55                   	push   %ebp
+  80137f:	89 e5                	mov    %esp,%ebp
+  801381:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801384:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801387:	50                   	push   %eax
+  801388:	ff 75 10             	push   0x10(%ebp)
+  80138b:	ff 75 0c             	push   0xc(%ebp)
+  80138e:	ff 75 08             	push   0x8(%ebp)
+  801391:	e8 05 00 00 00       	call   80139b <vprintfmt>
+}
+  801396:	83 c4 10             	add    $0x10,%esp
+  801399:	c9                   	leave
+  80139a:	c3                   	ret
+
+0080139b <vprintfmt>:
+{
+  80139b:	55                   	push   %ebp
+  80139c:	89 e5                	mov    %esp,%ebp
+  80139e:	57                   	push   %edi
+  80139f:	56                   	push   %esi
+  8013a0:	53                   	push   %ebx
+  8013a1:	83 ec 2c             	sub    $0x2c,%esp
+  8013a4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8013aa:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8013ad:	eb 0a                	jmp    8013b9 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8013af:	83 ec 08             	sub    $0x8,%esp
+  8013b2:	53                   	push   %ebx
+  8013b3:	50                   	push   %eax
+  8013b4:	ff d6                	call   *%esi
+  8013b6:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8013b9:	83 c7 01             	add    $0x1,%edi
+  8013bc:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8013c0:	83 f8 25             	cmp    $0x25,%eax
+  8013c3:	74 0c                	je     8013d1 <vprintfmt+0x36>
+			if (ch == '\0')
+  8013c5:	85 c0                	test   %eax,%eax
+  8013c7:	75 e6                	jne    8013af <vprintfmt+0x14>
+}
+  8013c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013cc:	5b                   	pop    %ebx
+  8013cd:	5e                   	pop    %esi
+  8013ce:	5f                   	pop    %edi
+  8013cf:	5d                   	pop    %ebp
+  8013d0:	c3                   	ret
+		padc = ' ';
+  8013d1:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8013d5:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8013dc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8013e3:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8013ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8013ef:	8d 47 01             	lea    0x1(%edi),%eax
+  8013f2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8013f5:	0f b6 17             	movzbl (%edi),%edx
+  8013f8:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8013fb:	3c 55                	cmp    $0x55,%al
+  8013fd:	0f 87 c5 03 00 00    	ja     8017c8 <vprintfmt+0x42d>
+  801403:	0f b6 c0             	movzbl %al,%eax
+  801406:	ff 24 85 40 3d 80 00 	jmp    *0x803d40(,%eax,4)
+  80140d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801410:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801414:	eb d9                	jmp    8013ef <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801416:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801419:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80141d:	eb d0                	jmp    8013ef <vprintfmt+0x54>
+  80141f:	0f b6 d2             	movzbl %dl,%edx
+  801422:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801425:	b8 00 00 00 00       	mov    $0x0,%eax
+  80142a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80142d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801430:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801434:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801437:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80143a:	83 f9 09             	cmp    $0x9,%ecx
+  80143d:	77 55                	ja     801494 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80143f:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801442:	eb e9                	jmp    80142d <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801444:	8b 45 14             	mov    0x14(%ebp),%eax
+  801447:	8b 00                	mov    (%eax),%eax
+  801449:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80144c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80144f:	8d 40 04             	lea    0x4(%eax),%eax
+  801452:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801455:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801458:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80145c:	79 91                	jns    8013ef <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80145e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801461:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801464:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80146b:	eb 82                	jmp    8013ef <vprintfmt+0x54>
+			if (width < 0)
+  80146d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801470:	85 d2                	test   %edx,%edx
+  801472:	b8 00 00 00 00       	mov    $0x0,%eax
+  801477:	0f 49 c2             	cmovns %edx,%eax
+  80147a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80147d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801480:	e9 6a ff ff ff       	jmp    8013ef <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801485:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801488:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80148f:	e9 5b ff ff ff       	jmp    8013ef <vprintfmt+0x54>
+  801494:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801497:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80149a:	eb bc                	jmp    801458 <vprintfmt+0xbd>
+			lflag++;
+  80149c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80149f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8014a2:	e9 48 ff ff ff       	jmp    8013ef <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8014a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8014aa:	8d 78 04             	lea    0x4(%eax),%edi
+  8014ad:	83 ec 08             	sub    $0x8,%esp
+  8014b0:	53                   	push   %ebx
+  8014b1:	ff 30                	push   (%eax)
+  8014b3:	ff d6                	call   *%esi
+			break;
+  8014b5:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8014b8:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8014bb:	e9 63 02 00 00       	jmp    801723 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8014c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8014c3:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8014c6:	8b 10                	mov    (%eax),%edx
+  8014c8:	89 d0                	mov    %edx,%eax
+  8014ca:	f7 d8                	neg    %eax
+  8014cc:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8014cf:	83 f8 12             	cmp    $0x12,%eax
+  8014d2:	7f 23                	jg     8014f7 <vprintfmt+0x15c>
+  8014d4:	8b 14 85 a0 3e 80 00 	mov    0x803ea0(,%eax,4),%edx
+  8014db:	85 d2                	test   %edx,%edx
+  8014dd:	74 18                	je     8014f7 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8014df:	52                   	push   %edx
+  8014e0:	68 79 3b 80 00       	push   $0x803b79
+  8014e5:	53                   	push   %ebx
+  8014e6:	56                   	push   %esi
+  8014e7:	e8 92 fe ff ff       	call   80137e <printfmt>
+  8014ec:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8014ef:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8014f2:	e9 2c 02 00 00       	jmp    801723 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  8014f7:	50                   	push   %eax
+  8014f8:	68 c3 3b 80 00       	push   $0x803bc3
+  8014fd:	53                   	push   %ebx
+  8014fe:	56                   	push   %esi
+  8014ff:	e8 7a fe ff ff       	call   80137e <printfmt>
+  801504:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801507:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80150a:	e9 14 02 00 00       	jmp    801723 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80150f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801512:	83 c0 04             	add    $0x4,%eax
+  801515:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801518:	8b 45 14             	mov    0x14(%ebp),%eax
+  80151b:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80151d:	85 c9                	test   %ecx,%ecx
+  80151f:	b8 bc 3b 80 00       	mov    $0x803bbc,%eax
+  801524:	0f 45 c1             	cmovne %ecx,%eax
+  801527:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80152a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80152e:	7e 06                	jle    801536 <vprintfmt+0x19b>
+  801530:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801534:	75 0b                	jne    801541 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801536:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801539:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80153c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80153f:	eb 5c                	jmp    80159d <vprintfmt+0x202>
+  801541:	83 ec 08             	sub    $0x8,%esp
+  801544:	ff 75 d0             	push   -0x30(%ebp)
+  801547:	ff 75 cc             	push   -0x34(%ebp)
+  80154a:	e8 19 03 00 00       	call   801868 <strnlen>
+  80154f:	89 c2                	mov    %eax,%edx
+  801551:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801554:	29 d0                	sub    %edx,%eax
+  801556:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801559:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80155d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801560:	89 75 08             	mov    %esi,0x8(%ebp)
+  801563:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801565:	eb 0e                	jmp    801575 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801567:	83 ec 08             	sub    $0x8,%esp
+  80156a:	53                   	push   %ebx
+  80156b:	57                   	push   %edi
+  80156c:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80156f:	83 ee 01             	sub    $0x1,%esi
+  801572:	83 c4 10             	add    $0x10,%esp
+  801575:	85 f6                	test   %esi,%esi
+  801577:	7f ee                	jg     801567 <vprintfmt+0x1cc>
+  801579:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80157c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80157f:	85 c0                	test   %eax,%eax
+  801581:	ba 00 00 00 00       	mov    $0x0,%edx
+  801586:	0f 49 d0             	cmovns %eax,%edx
+  801589:	29 d0                	sub    %edx,%eax
+  80158b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80158e:	eb a6                	jmp    801536 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801590:	83 ec 08             	sub    $0x8,%esp
+  801593:	53                   	push   %ebx
+  801594:	52                   	push   %edx
+  801595:	ff 55 08             	call   *0x8(%ebp)
+  801598:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80159b:	89 f1                	mov    %esi,%ecx
+  80159d:	8d 71 01             	lea    0x1(%ecx),%esi
+  8015a0:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8015a4:	0f be d0             	movsbl %al,%edx
+  8015a7:	85 d2                	test   %edx,%edx
+  8015a9:	74 28                	je     8015d3 <vprintfmt+0x238>
+  8015ab:	85 ff                	test   %edi,%edi
+  8015ad:	78 05                	js     8015b4 <vprintfmt+0x219>
+  8015af:	83 ef 01             	sub    $0x1,%edi
+  8015b2:	78 30                	js     8015e4 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8015b4:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8015b8:	74 d6                	je     801590 <vprintfmt+0x1f5>
+  8015ba:	0f be c0             	movsbl %al,%eax
+  8015bd:	83 e8 20             	sub    $0x20,%eax
+  8015c0:	83 f8 5e             	cmp    $0x5e,%eax
+  8015c3:	76 cb                	jbe    801590 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8015c5:	83 ec 08             	sub    $0x8,%esp
+  8015c8:	53                   	push   %ebx
+  8015c9:	6a 3f                	push   $0x3f
+  8015cb:	ff 55 08             	call   *0x8(%ebp)
+  8015ce:	83 c4 10             	add    $0x10,%esp
+  8015d1:	eb c8                	jmp    80159b <vprintfmt+0x200>
+  8015d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8015d6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8015d9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8015dc:	01 d0                	add    %edx,%eax
+  8015de:	29 c8                	sub    %ecx,%eax
+  8015e0:	89 c7                	mov    %eax,%edi
+  8015e2:	eb 13                	jmp    8015f7 <vprintfmt+0x25c>
+  8015e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8015e7:	eb ed                	jmp    8015d6 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8015e9:	83 ec 08             	sub    $0x8,%esp
+  8015ec:	53                   	push   %ebx
+  8015ed:	6a 20                	push   $0x20
+  8015ef:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8015f1:	83 ef 01             	sub    $0x1,%edi
+  8015f4:	83 c4 10             	add    $0x10,%esp
+  8015f7:	85 ff                	test   %edi,%edi
+  8015f9:	7f ee                	jg     8015e9 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8015fb:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8015fe:	89 45 14             	mov    %eax,0x14(%ebp)
+  801601:	e9 1d 01 00 00       	jmp    801723 <vprintfmt+0x388>
+	if (lflag >= 2)
+  801606:	83 f9 01             	cmp    $0x1,%ecx
+  801609:	7f 1b                	jg     801626 <vprintfmt+0x28b>
+	else if (lflag)
+  80160b:	85 c9                	test   %ecx,%ecx
+  80160d:	74 63                	je     801672 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  80160f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801612:	8b 00                	mov    (%eax),%eax
+  801614:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801617:	99                   	cltd
+  801618:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80161b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80161e:	8d 40 04             	lea    0x4(%eax),%eax
+  801621:	89 45 14             	mov    %eax,0x14(%ebp)
+  801624:	eb 17                	jmp    80163d <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  801626:	8b 45 14             	mov    0x14(%ebp),%eax
+  801629:	8b 50 04             	mov    0x4(%eax),%edx
+  80162c:	8b 00                	mov    (%eax),%eax
+  80162e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801631:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801634:	8b 45 14             	mov    0x14(%ebp),%eax
+  801637:	8d 40 08             	lea    0x8(%eax),%eax
+  80163a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80163d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801640:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801643:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801648:	85 c9                	test   %ecx,%ecx
+  80164a:	0f 89 b9 00 00 00    	jns    801709 <vprintfmt+0x36e>
+				putch('-', putdat);
+  801650:	83 ec 08             	sub    $0x8,%esp
+  801653:	53                   	push   %ebx
+  801654:	6a 2d                	push   $0x2d
+  801656:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801658:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80165b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80165e:	f7 da                	neg    %edx
+  801660:	83 d1 00             	adc    $0x0,%ecx
+  801663:	f7 d9                	neg    %ecx
+  801665:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801668:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80166d:	e9 97 00 00 00       	jmp    801709 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  801672:	8b 45 14             	mov    0x14(%ebp),%eax
+  801675:	8b 00                	mov    (%eax),%eax
+  801677:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80167a:	99                   	cltd
+  80167b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80167e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801681:	8d 40 04             	lea    0x4(%eax),%eax
+  801684:	89 45 14             	mov    %eax,0x14(%ebp)
+  801687:	eb b4                	jmp    80163d <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  801689:	83 f9 01             	cmp    $0x1,%ecx
+  80168c:	7f 1b                	jg     8016a9 <vprintfmt+0x30e>
+	else if (lflag)
+  80168e:	85 c9                	test   %ecx,%ecx
+  801690:	74 2c                	je     8016be <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  801692:	8b 45 14             	mov    0x14(%ebp),%eax
+  801695:	8b 10                	mov    (%eax),%edx
+  801697:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80169c:	8d 40 04             	lea    0x4(%eax),%eax
+  80169f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8016a2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8016a7:	eb 60                	jmp    801709 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8016a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8016ac:	8b 10                	mov    (%eax),%edx
+  8016ae:	8b 48 04             	mov    0x4(%eax),%ecx
+  8016b1:	8d 40 08             	lea    0x8(%eax),%eax
+  8016b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8016b7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8016bc:	eb 4b                	jmp    801709 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8016be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8016c1:	8b 10                	mov    (%eax),%edx
+  8016c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8016cb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8016ce:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8016d3:	eb 34                	jmp    801709 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8016d5:	83 f9 01             	cmp    $0x1,%ecx
+  8016d8:	7f 15                	jg     8016ef <vprintfmt+0x354>
+	else if (lflag)
+  8016da:	85 c9                	test   %ecx,%ecx
+  8016dc:	74 4d                	je     80172b <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8016de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8016e1:	8b 00                	mov    (%eax),%eax
+  8016e3:	99                   	cltd
+  8016e4:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8016e7:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8016ea:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8016ed:	eb 11                	jmp    801700 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  8016ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8016f2:	8b 50 04             	mov    0x4(%eax),%edx
+  8016f5:	8b 00                	mov    (%eax),%eax
+  8016f7:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8016fa:	8d 49 08             	lea    0x8(%ecx),%ecx
+  8016fd:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  801700:	89 d1                	mov    %edx,%ecx
+  801702:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  801704:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801709:	83 ec 0c             	sub    $0xc,%esp
+  80170c:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801710:	50                   	push   %eax
+  801711:	ff 75 e0             	push   -0x20(%ebp)
+  801714:	57                   	push   %edi
+  801715:	51                   	push   %ecx
+  801716:	52                   	push   %edx
+  801717:	89 da                	mov    %ebx,%edx
+  801719:	89 f0                	mov    %esi,%eax
+  80171b:	e8 98 fb ff ff       	call   8012b8 <printnum>
+			break;
+  801720:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801723:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801726:	e9 8e fc ff ff       	jmp    8013b9 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  80172b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80172e:	8b 00                	mov    (%eax),%eax
+  801730:	99                   	cltd
+  801731:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801734:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801737:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80173a:	eb c4                	jmp    801700 <vprintfmt+0x365>
+			putch('0', putdat);
+  80173c:	83 ec 08             	sub    $0x8,%esp
+  80173f:	53                   	push   %ebx
+  801740:	6a 30                	push   $0x30
+  801742:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801744:	83 c4 08             	add    $0x8,%esp
+  801747:	53                   	push   %ebx
+  801748:	6a 78                	push   $0x78
+  80174a:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80174c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80174f:	8b 10                	mov    (%eax),%edx
+  801751:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801756:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801759:	8d 40 04             	lea    0x4(%eax),%eax
+  80175c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80175f:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  801764:	eb a3                	jmp    801709 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801766:	83 f9 01             	cmp    $0x1,%ecx
+  801769:	7f 1b                	jg     801786 <vprintfmt+0x3eb>
+	else if (lflag)
+  80176b:	85 c9                	test   %ecx,%ecx
+  80176d:	74 2f                	je     80179e <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  80176f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801772:	8b 10                	mov    (%eax),%edx
+  801774:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801779:	8d 40 04             	lea    0x4(%eax),%eax
+  80177c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80177f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801784:	eb 83                	jmp    801709 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801786:	8b 45 14             	mov    0x14(%ebp),%eax
+  801789:	8b 10                	mov    (%eax),%edx
+  80178b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80178e:	8d 40 08             	lea    0x8(%eax),%eax
+  801791:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801794:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801799:	e9 6b ff ff ff       	jmp    801709 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80179e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8017a1:	8b 10                	mov    (%eax),%edx
+  8017a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8017ab:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8017ae:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8017b3:	e9 51 ff ff ff       	jmp    801709 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8017b8:	83 ec 08             	sub    $0x8,%esp
+  8017bb:	53                   	push   %ebx
+  8017bc:	6a 25                	push   $0x25
+  8017be:	ff d6                	call   *%esi
+			break;
+  8017c0:	83 c4 10             	add    $0x10,%esp
+  8017c3:	e9 5b ff ff ff       	jmp    801723 <vprintfmt+0x388>
+			putch('%', putdat);
+  8017c8:	83 ec 08             	sub    $0x8,%esp
+  8017cb:	53                   	push   %ebx
+  8017cc:	6a 25                	push   $0x25
+  8017ce:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8017d0:	83 c4 10             	add    $0x10,%esp
+  8017d3:	89 f8                	mov    %edi,%eax
+  8017d5:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8017d9:	74 05                	je     8017e0 <vprintfmt+0x445>
+  8017db:	83 e8 01             	sub    $0x1,%eax
+  8017de:	eb f5                	jmp    8017d5 <vprintfmt+0x43a>
+  8017e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017e3:	e9 3b ff ff ff       	jmp    801723 <vprintfmt+0x388>
+
+008017e8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8017e8:	55                   	push   %ebp
+  8017e9:	89 e5                	mov    %esp,%ebp
+  8017eb:	83 ec 18             	sub    $0x18,%esp
+  8017ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8017f4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8017f7:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8017fb:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8017fe:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801805:	85 c0                	test   %eax,%eax
+  801807:	74 26                	je     80182f <vsnprintf+0x47>
+  801809:	85 d2                	test   %edx,%edx
+  80180b:	7e 22                	jle    80182f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80180d:	ff 75 14             	push   0x14(%ebp)
+  801810:	ff 75 10             	push   0x10(%ebp)
+  801813:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801816:	50                   	push   %eax
+  801817:	68 61 13 80 00       	push   $0x801361
+  80181c:	e8 7a fb ff ff       	call   80139b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801821:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801824:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801827:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80182a:	83 c4 10             	add    $0x10,%esp
+}
+  80182d:	c9                   	leave
+  80182e:	c3                   	ret
+		return -E_INVAL;
+  80182f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801834:	eb f7                	jmp    80182d <vsnprintf+0x45>
+
+00801836 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801836:	55                   	push   %ebp
+  801837:	89 e5                	mov    %esp,%ebp
+  801839:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80183c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80183f:	50                   	push   %eax
+  801840:	ff 75 10             	push   0x10(%ebp)
+  801843:	ff 75 0c             	push   0xc(%ebp)
+  801846:	ff 75 08             	push   0x8(%ebp)
+  801849:	e8 9a ff ff ff       	call   8017e8 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80184e:	c9                   	leave
+  80184f:	c3                   	ret
+
+00801850 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801850:	55                   	push   %ebp
+  801851:	89 e5                	mov    %esp,%ebp
+  801853:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185b:	eb 03                	jmp    801860 <strlen+0x10>
+		n++;
+  80185d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801860:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801864:	75 f7                	jne    80185d <strlen+0xd>
+	return n;
+}
+  801866:	5d                   	pop    %ebp
+  801867:	c3                   	ret
+
+00801868 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801868:	55                   	push   %ebp
+  801869:	89 e5                	mov    %esp,%ebp
+  80186b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80186e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801871:	b8 00 00 00 00       	mov    $0x0,%eax
+  801876:	eb 03                	jmp    80187b <strnlen+0x13>
+		n++;
+  801878:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80187b:	39 d0                	cmp    %edx,%eax
+  80187d:	74 08                	je     801887 <strnlen+0x1f>
+  80187f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801883:	75 f3                	jne    801878 <strnlen+0x10>
+  801885:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801887:	89 d0                	mov    %edx,%eax
+  801889:	5d                   	pop    %ebp
+  80188a:	c3                   	ret
+
+0080188b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80188b:	55                   	push   %ebp
+  80188c:	89 e5                	mov    %esp,%ebp
+  80188e:	53                   	push   %ebx
+  80188f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801892:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80189e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8018a1:	83 c0 01             	add    $0x1,%eax
+  8018a4:	84 d2                	test   %dl,%dl
+  8018a6:	75 f2                	jne    80189a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8018a8:	89 c8                	mov    %ecx,%eax
+  8018aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ad:	c9                   	leave
+  8018ae:	c3                   	ret
+
+008018af <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8018af:	55                   	push   %ebp
+  8018b0:	89 e5                	mov    %esp,%ebp
+  8018b2:	53                   	push   %ebx
+  8018b3:	83 ec 10             	sub    $0x10,%esp
+  8018b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8018b9:	53                   	push   %ebx
+  8018ba:	e8 91 ff ff ff       	call   801850 <strlen>
+  8018bf:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8018c2:	ff 75 0c             	push   0xc(%ebp)
+  8018c5:	01 d8                	add    %ebx,%eax
+  8018c7:	50                   	push   %eax
+  8018c8:	e8 be ff ff ff       	call   80188b <strcpy>
+	return dst;
+}
+  8018cd:	89 d8                	mov    %ebx,%eax
+  8018cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d2:	c9                   	leave
+  8018d3:	c3                   	ret
+
+008018d4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8018d4:	55                   	push   %ebp
+  8018d5:	89 e5                	mov    %esp,%ebp
+  8018d7:	56                   	push   %esi
+  8018d8:	53                   	push   %ebx
+  8018d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8018df:	89 f3                	mov    %esi,%ebx
+  8018e1:	03 5d 10             	add    0x10(%ebp),%ebx
+  8018e4:	89 f0                	mov    %esi,%eax
+  8018e6:	eb 0f                	jmp    8018f7 <strncpy+0x23>
+		*dst++ = *src;
+  8018e8:	83 c0 01             	add    $0x1,%eax
+  8018eb:	0f b6 0a             	movzbl (%edx),%ecx
+  8018ee:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8018f1:	80 f9 01             	cmp    $0x1,%cl
+  8018f4:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8018f7:	39 d8                	cmp    %ebx,%eax
+  8018f9:	75 ed                	jne    8018e8 <strncpy+0x14>
+	}
+	return ret;
+}
+  8018fb:	89 f0                	mov    %esi,%eax
+  8018fd:	5b                   	pop    %ebx
+  8018fe:	5e                   	pop    %esi
+  8018ff:	5d                   	pop    %ebp
+  801900:	c3                   	ret
+
+00801901 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801901:	55                   	push   %ebp
+  801902:	89 e5                	mov    %esp,%ebp
+  801904:	56                   	push   %esi
+  801905:	53                   	push   %ebx
+  801906:	8b 75 08             	mov    0x8(%ebp),%esi
+  801909:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80190c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80190f:	89 f0                	mov    %esi,%eax
+  801911:	85 d2                	test   %edx,%edx
+  801913:	74 21                	je     801936 <strlcpy+0x35>
+  801915:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801919:	89 f2                	mov    %esi,%edx
+  80191b:	eb 09                	jmp    801926 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80191d:	83 c1 01             	add    $0x1,%ecx
+  801920:	83 c2 01             	add    $0x1,%edx
+  801923:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801926:	39 c2                	cmp    %eax,%edx
+  801928:	74 09                	je     801933 <strlcpy+0x32>
+  80192a:	0f b6 19             	movzbl (%ecx),%ebx
+  80192d:	84 db                	test   %bl,%bl
+  80192f:	75 ec                	jne    80191d <strlcpy+0x1c>
+  801931:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801933:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801936:	29 f0                	sub    %esi,%eax
+}
+  801938:	5b                   	pop    %ebx
+  801939:	5e                   	pop    %esi
+  80193a:	5d                   	pop    %ebp
+  80193b:	c3                   	ret
+
+0080193c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80193c:	55                   	push   %ebp
+  80193d:	89 e5                	mov    %esp,%ebp
+  80193f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801942:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801945:	eb 06                	jmp    80194d <strcmp+0x11>
+		p++, q++;
+  801947:	83 c1 01             	add    $0x1,%ecx
+  80194a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80194d:	0f b6 01             	movzbl (%ecx),%eax
+  801950:	84 c0                	test   %al,%al
+  801952:	74 04                	je     801958 <strcmp+0x1c>
+  801954:	3a 02                	cmp    (%edx),%al
+  801956:	74 ef                	je     801947 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801958:	0f b6 c0             	movzbl %al,%eax
+  80195b:	0f b6 12             	movzbl (%edx),%edx
+  80195e:	29 d0                	sub    %edx,%eax
+}
+  801960:	5d                   	pop    %ebp
+  801961:	c3                   	ret
+
+00801962 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801962:	55                   	push   %ebp
+  801963:	89 e5                	mov    %esp,%ebp
+  801965:	53                   	push   %ebx
+  801966:	8b 45 08             	mov    0x8(%ebp),%eax
+  801969:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80196c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80196f:	eb 09                	jmp    80197a <strncmp+0x18>
+		n--, p++, q++;
+  801971:	83 ea 01             	sub    $0x1,%edx
+  801974:	83 c0 01             	add    $0x1,%eax
+  801977:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80197a:	85 d2                	test   %edx,%edx
+  80197c:	74 18                	je     801996 <strncmp+0x34>
+  80197e:	0f b6 18             	movzbl (%eax),%ebx
+  801981:	84 db                	test   %bl,%bl
+  801983:	74 04                	je     801989 <strncmp+0x27>
+  801985:	3a 19                	cmp    (%ecx),%bl
+  801987:	74 e8                	je     801971 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801989:	0f b6 00             	movzbl (%eax),%eax
+  80198c:	0f b6 11             	movzbl (%ecx),%edx
+  80198f:	29 d0                	sub    %edx,%eax
+}
+  801991:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801994:	c9                   	leave
+  801995:	c3                   	ret
+		return 0;
+  801996:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199b:	eb f4                	jmp    801991 <strncmp+0x2f>
+
+0080199d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80199d:	55                   	push   %ebp
+  80199e:	89 e5                	mov    %esp,%ebp
+  8019a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8019a7:	eb 03                	jmp    8019ac <strchr+0xf>
+  8019a9:	83 c0 01             	add    $0x1,%eax
+  8019ac:	0f b6 10             	movzbl (%eax),%edx
+  8019af:	84 d2                	test   %dl,%dl
+  8019b1:	74 06                	je     8019b9 <strchr+0x1c>
+		if (*s == c)
+  8019b3:	38 ca                	cmp    %cl,%dl
+  8019b5:	75 f2                	jne    8019a9 <strchr+0xc>
+  8019b7:	eb 05                	jmp    8019be <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8019b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019be:	5d                   	pop    %ebp
+  8019bf:	c3                   	ret
+
+008019c0 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8019c0:	55                   	push   %ebp
+  8019c1:	89 e5                	mov    %esp,%ebp
+  8019c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8019ca:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8019cd:	38 ca                	cmp    %cl,%dl
+  8019cf:	74 09                	je     8019da <strfind+0x1a>
+  8019d1:	84 d2                	test   %dl,%dl
+  8019d3:	74 05                	je     8019da <strfind+0x1a>
+	for (; *s; s++)
+  8019d5:	83 c0 01             	add    $0x1,%eax
+  8019d8:	eb f0                	jmp    8019ca <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8019da:	5d                   	pop    %ebp
+  8019db:	c3                   	ret
+
+008019dc <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8019dc:	55                   	push   %ebp
+  8019dd:	89 e5                	mov    %esp,%ebp
+  8019df:	57                   	push   %edi
+  8019e0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8019e3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8019e6:	85 c9                	test   %ecx,%ecx
+  8019e8:	74 20                	je     801a0a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8019ea:	89 f8                	mov    %edi,%eax
+  8019ec:	09 c8                	or     %ecx,%eax
+  8019ee:	a8 03                	test   $0x3,%al
+  8019f0:	75 12                	jne    801a04 <memset+0x28>
+		c &= 0xFF;
+  8019f2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8019f6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8019fc:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8019ff:	fc                   	cld
+  801a00:	f3 ab                	rep stos %eax,%es:(%edi)
+  801a02:	eb 06                	jmp    801a0a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801a04:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a07:	fc                   	cld
+  801a08:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801a0a:	89 f8                	mov    %edi,%eax
+  801a0c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801a0f:	c9                   	leave
+  801a10:	c3                   	ret
+
+00801a11 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801a11:	55                   	push   %ebp
+  801a12:	89 e5                	mov    %esp,%ebp
+  801a14:	57                   	push   %edi
+  801a15:	56                   	push   %esi
+  801a16:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a19:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a1c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801a1f:	39 c6                	cmp    %eax,%esi
+  801a21:	73 32                	jae    801a55 <memmove+0x44>
+  801a23:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801a26:	39 d0                	cmp    %edx,%eax
+  801a28:	73 2b                	jae    801a55 <memmove+0x44>
+		s += n;
+		d += n;
+  801a2a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801a2d:	89 d6                	mov    %edx,%esi
+  801a2f:	09 fe                	or     %edi,%esi
+  801a31:	09 ce                	or     %ecx,%esi
+  801a33:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801a39:	75 0e                	jne    801a49 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801a3b:	83 ef 04             	sub    $0x4,%edi
+  801a3e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801a41:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801a44:	fd                   	std
+  801a45:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801a47:	eb 09                	jmp    801a52 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801a49:	83 ef 01             	sub    $0x1,%edi
+  801a4c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801a4f:	fd                   	std
+  801a50:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801a52:	fc                   	cld
+  801a53:	eb 1a                	jmp    801a6f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801a55:	89 f2                	mov    %esi,%edx
+  801a57:	09 c2                	or     %eax,%edx
+  801a59:	09 ca                	or     %ecx,%edx
+  801a5b:	f6 c2 03             	test   $0x3,%dl
+  801a5e:	75 0a                	jne    801a6a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801a60:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801a63:	89 c7                	mov    %eax,%edi
+  801a65:	fc                   	cld
+  801a66:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801a68:	eb 05                	jmp    801a6f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801a6a:	89 c7                	mov    %eax,%edi
+  801a6c:	fc                   	cld
+  801a6d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801a6f:	5e                   	pop    %esi
+  801a70:	5f                   	pop    %edi
+  801a71:	5d                   	pop    %ebp
+  801a72:	c3                   	ret
+
+00801a73 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801a73:	55                   	push   %ebp
+  801a74:	89 e5                	mov    %esp,%ebp
+  801a76:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801a79:	ff 75 10             	push   0x10(%ebp)
+  801a7c:	ff 75 0c             	push   0xc(%ebp)
+  801a7f:	ff 75 08             	push   0x8(%ebp)
+  801a82:	e8 8a ff ff ff       	call   801a11 <memmove>
+}
+  801a87:	c9                   	leave
+  801a88:	c3                   	ret
+
+00801a89 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801a89:	55                   	push   %ebp
+  801a8a:	89 e5                	mov    %esp,%ebp
+  801a8c:	56                   	push   %esi
+  801a8d:	53                   	push   %ebx
+  801a8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a91:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801a94:	89 c6                	mov    %eax,%esi
+  801a96:	03 75 10             	add    0x10(%ebp),%esi
+  801a99:	eb 06                	jmp    801aa1 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801a9b:	83 c0 01             	add    $0x1,%eax
+  801a9e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801aa1:	39 f0                	cmp    %esi,%eax
+  801aa3:	74 14                	je     801ab9 <memcmp+0x30>
+		if (*s1 != *s2)
+  801aa5:	0f b6 08             	movzbl (%eax),%ecx
+  801aa8:	0f b6 1a             	movzbl (%edx),%ebx
+  801aab:	38 d9                	cmp    %bl,%cl
+  801aad:	74 ec                	je     801a9b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801aaf:	0f b6 c1             	movzbl %cl,%eax
+  801ab2:	0f b6 db             	movzbl %bl,%ebx
+  801ab5:	29 d8                	sub    %ebx,%eax
+  801ab7:	eb 05                	jmp    801abe <memcmp+0x35>
+	}
+
+	return 0;
+  801ab9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801abe:	5b                   	pop    %ebx
+  801abf:	5e                   	pop    %esi
+  801ac0:	5d                   	pop    %ebp
+  801ac1:	c3                   	ret
+
+00801ac2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801ac2:	55                   	push   %ebp
+  801ac3:	89 e5                	mov    %esp,%ebp
+  801ac5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ac8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801acb:	89 c2                	mov    %eax,%edx
+  801acd:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801ad0:	eb 03                	jmp    801ad5 <memfind+0x13>
+  801ad2:	83 c0 01             	add    $0x1,%eax
+  801ad5:	39 d0                	cmp    %edx,%eax
+  801ad7:	73 04                	jae    801add <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801ad9:	38 08                	cmp    %cl,(%eax)
+  801adb:	75 f5                	jne    801ad2 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801add:	5d                   	pop    %ebp
+  801ade:	c3                   	ret
+
+00801adf <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801adf:	55                   	push   %ebp
+  801ae0:	89 e5                	mov    %esp,%ebp
+  801ae2:	57                   	push   %edi
+  801ae3:	56                   	push   %esi
+  801ae4:	53                   	push   %ebx
+  801ae5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ae8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801aeb:	eb 03                	jmp    801af0 <strtol+0x11>
+		s++;
+  801aed:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801af0:	0f b6 02             	movzbl (%edx),%eax
+  801af3:	3c 20                	cmp    $0x20,%al
+  801af5:	74 f6                	je     801aed <strtol+0xe>
+  801af7:	3c 09                	cmp    $0x9,%al
+  801af9:	74 f2                	je     801aed <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801afb:	3c 2b                	cmp    $0x2b,%al
+  801afd:	74 2a                	je     801b29 <strtol+0x4a>
+	int neg = 0;
+  801aff:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801b04:	3c 2d                	cmp    $0x2d,%al
+  801b06:	74 2b                	je     801b33 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801b08:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801b0e:	75 0f                	jne    801b1f <strtol+0x40>
+  801b10:	80 3a 30             	cmpb   $0x30,(%edx)
+  801b13:	74 28                	je     801b3d <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801b15:	85 db                	test   %ebx,%ebx
+  801b17:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801b1c:	0f 44 d8             	cmove  %eax,%ebx
+  801b1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b24:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801b27:	eb 46                	jmp    801b6f <strtol+0x90>
+		s++;
+  801b29:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801b2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b31:	eb d5                	jmp    801b08 <strtol+0x29>
+		s++, neg = 1;
+  801b33:	83 c2 01             	add    $0x1,%edx
+  801b36:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b3b:	eb cb                	jmp    801b08 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801b3d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801b41:	74 0e                	je     801b51 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801b43:	85 db                	test   %ebx,%ebx
+  801b45:	75 d8                	jne    801b1f <strtol+0x40>
+		s++, base = 8;
+  801b47:	83 c2 01             	add    $0x1,%edx
+  801b4a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801b4f:	eb ce                	jmp    801b1f <strtol+0x40>
+		s += 2, base = 16;
+  801b51:	83 c2 02             	add    $0x2,%edx
+  801b54:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801b59:	eb c4                	jmp    801b1f <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801b5b:	0f be c0             	movsbl %al,%eax
+  801b5e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801b61:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801b64:	7d 3a                	jge    801ba0 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801b66:	83 c2 01             	add    $0x1,%edx
+  801b69:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801b6d:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801b6f:	0f b6 02             	movzbl (%edx),%eax
+  801b72:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801b75:	89 f3                	mov    %esi,%ebx
+  801b77:	80 fb 09             	cmp    $0x9,%bl
+  801b7a:	76 df                	jbe    801b5b <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801b7c:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801b7f:	89 f3                	mov    %esi,%ebx
+  801b81:	80 fb 19             	cmp    $0x19,%bl
+  801b84:	77 08                	ja     801b8e <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801b86:	0f be c0             	movsbl %al,%eax
+  801b89:	83 e8 57             	sub    $0x57,%eax
+  801b8c:	eb d3                	jmp    801b61 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801b8e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801b91:	89 f3                	mov    %esi,%ebx
+  801b93:	80 fb 19             	cmp    $0x19,%bl
+  801b96:	77 08                	ja     801ba0 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801b98:	0f be c0             	movsbl %al,%eax
+  801b9b:	83 e8 37             	sub    $0x37,%eax
+  801b9e:	eb c1                	jmp    801b61 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801ba0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801ba4:	74 05                	je     801bab <strtol+0xcc>
+		*endptr = (char *) s;
+  801ba6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ba9:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801bab:	89 c8                	mov    %ecx,%eax
+  801bad:	f7 d8                	neg    %eax
+  801baf:	85 ff                	test   %edi,%edi
+  801bb1:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801bb4:	89 c8                	mov    %ecx,%eax
+  801bb6:	5b                   	pop    %ebx
+  801bb7:	5e                   	pop    %esi
+  801bb8:	5f                   	pop    %edi
+  801bb9:	5d                   	pop    %ebp
+  801bba:	c3                   	ret
+
+00801bbb <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  801bbb:	55                   	push   %ebp
+  801bbc:	89 e5                	mov    %esp,%ebp
+  801bbe:	57                   	push   %edi
+  801bbf:	56                   	push   %esi
+  801bc0:	53                   	push   %ebx
+  801bc1:	83 ec 0c             	sub    $0xc,%esp
+  801bc4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801bc7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801bca:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  801bcd:	85 ff                	test   %edi,%edi
+  801bcf:	74 16                	je     801be7 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  801bd1:	83 ec 04             	sub    $0x4,%esp
+  801bd4:	56                   	push   %esi
+  801bd5:	6a 00                	push   $0x0
+  801bd7:	53                   	push   %ebx
+  801bd8:	e8 02 ff ff ff       	call   801adf <strtol>
+  801bdd:	89 07                	mov    %eax,(%edi)
+  801bdf:	83 c4 10             	add    $0x10,%esp
+  801be2:	eb 03                	jmp    801be7 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  801be4:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  801be7:	0f b6 03             	movzbl (%ebx),%eax
+  801bea:	3c 20                	cmp    $0x20,%al
+  801bec:	74 f6                	je     801be4 <strisl+0x29>
+  801bee:	3c 09                	cmp    $0x9,%al
+  801bf0:	74 f2                	je     801be4 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  801bf2:	3c 2b                	cmp    $0x2b,%al
+  801bf4:	74 23                	je     801c19 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  801bf6:	3c 2d                	cmp    $0x2d,%al
+  801bf8:	0f 94 c0             	sete   %al
+  801bfb:	0f b6 c0             	movzbl %al,%eax
+  801bfe:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801c00:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  801c06:	75 41                	jne    801c49 <strisl+0x8e>
+  801c08:	80 3b 30             	cmpb   $0x30,(%ebx)
+  801c0b:	74 11                	je     801c1e <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801c0d:	85 f6                	test   %esi,%esi
+  801c0f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c14:	0f 44 f0             	cmove  %eax,%esi
+  801c17:	eb 30                	jmp    801c49 <strisl+0x8e>
+		s++;
+  801c19:	83 c3 01             	add    $0x1,%ebx
+  801c1c:	eb e2                	jmp    801c00 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801c1e:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  801c22:	74 0e                	je     801c32 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  801c24:	85 f6                	test   %esi,%esi
+  801c26:	75 21                	jne    801c49 <strisl+0x8e>
+		s++, base = 8;
+  801c28:	83 c3 01             	add    $0x1,%ebx
+  801c2b:	be 08 00 00 00       	mov    $0x8,%esi
+  801c30:	eb 17                	jmp    801c49 <strisl+0x8e>
+		s += 2, base = 16;
+  801c32:	83 c3 02             	add    $0x2,%ebx
+  801c35:	be 10 00 00 00       	mov    $0x10,%esi
+  801c3a:	eb 0d                	jmp    801c49 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801c3c:	0f be c0             	movsbl %al,%eax
+  801c3f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  801c42:	39 f0                	cmp    %esi,%eax
+  801c44:	7d 38                	jge    801c7e <strisl+0xc3>
+			return 0;
+		s++;
+  801c46:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  801c49:	0f b6 03             	movzbl (%ebx),%eax
+  801c4c:	8d 50 d0             	lea    -0x30(%eax),%edx
+  801c4f:	80 fa 09             	cmp    $0x9,%dl
+  801c52:	76 e8                	jbe    801c3c <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  801c54:	8d 50 9f             	lea    -0x61(%eax),%edx
+  801c57:	80 fa 19             	cmp    $0x19,%dl
+  801c5a:	77 08                	ja     801c64 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  801c5c:	0f be c0             	movsbl %al,%eax
+  801c5f:	83 e8 57             	sub    $0x57,%eax
+  801c62:	eb de                	jmp    801c42 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  801c64:	8d 50 bf             	lea    -0x41(%eax),%edx
+  801c67:	80 fa 19             	cmp    $0x19,%dl
+  801c6a:	77 08                	ja     801c74 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  801c6c:	0f be c0             	movsbl %al,%eax
+  801c6f:	83 e8 37             	sub    $0x37,%eax
+  801c72:	eb ce                	jmp    801c42 <strisl+0x87>
+		else if (!*s)
+  801c74:	84 c0                	test   %al,%al
+  801c76:	0f 94 c0             	sete   %al
+  801c79:	0f b6 c0             	movzbl %al,%eax
+  801c7c:	eb 05                	jmp    801c83 <strisl+0xc8>
+			return 0;
+  801c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  801c83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c86:	5b                   	pop    %ebx
+  801c87:	5e                   	pop    %esi
+  801c88:	5f                   	pop    %edi
+  801c89:	5d                   	pop    %ebp
+  801c8a:	c3                   	ret
+
+00801c8b <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  801c8b:	55                   	push   %ebp
+  801c8c:	89 e5                	mov    %esp,%ebp
+  801c8e:	83 ec 10             	sub    $0x10,%esp
+  801c91:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  801c94:	89 c8                	mov    %ecx,%eax
+  801c96:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c9b:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801c9e:	eb 0b                	jmp    801cab <touch_mem+0x20>
+		c = *(char *)page;
+  801ca0:	0f b6 10             	movzbl (%eax),%edx
+  801ca3:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  801ca6:	05 00 10 00 00       	add    $0x1000,%eax
+  801cab:	39 c8                	cmp    %ecx,%eax
+  801cad:	72 f1                	jb     801ca0 <touch_mem+0x15>
+}
+  801caf:	c9                   	leave
+  801cb0:	c3                   	ret
+
+00801cb1 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801cb1:	55                   	push   %ebp
+  801cb2:	89 e5                	mov    %esp,%ebp
+  801cb4:	57                   	push   %edi
+  801cb5:	56                   	push   %esi
+  801cb6:	53                   	push   %ebx
+	touch_mem(s, len);
+  801cb7:	ff 75 0c             	push   0xc(%ebp)
+  801cba:	ff 75 08             	push   0x8(%ebp)
+  801cbd:	e8 c9 ff ff ff       	call   801c8b <touch_mem>
+	asm volatile("int %1\n"
+  801cc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ccd:	89 c3                	mov    %eax,%ebx
+  801ccf:	89 c7                	mov    %eax,%edi
+  801cd1:	89 c6                	mov    %eax,%esi
+  801cd3:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801cd5:	83 c4 08             	add    $0x8,%esp
+  801cd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cdb:	5b                   	pop    %ebx
+  801cdc:	5e                   	pop    %esi
+  801cdd:	5f                   	pop    %edi
+  801cde:	5d                   	pop    %ebp
+  801cdf:	c3                   	ret
+
+00801ce0 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801ce0:	55                   	push   %ebp
+  801ce1:	89 e5                	mov    %esp,%ebp
+  801ce3:	57                   	push   %edi
+  801ce4:	56                   	push   %esi
+  801ce5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801ce6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ceb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cf0:	89 d1                	mov    %edx,%ecx
+  801cf2:	89 d3                	mov    %edx,%ebx
+  801cf4:	89 d7                	mov    %edx,%edi
+  801cf6:	89 d6                	mov    %edx,%esi
+  801cf8:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801cfa:	5b                   	pop    %ebx
+  801cfb:	5e                   	pop    %esi
+  801cfc:	5f                   	pop    %edi
+  801cfd:	5d                   	pop    %ebp
+  801cfe:	c3                   	ret
+
+00801cff <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801cff:	55                   	push   %ebp
+  801d00:	89 e5                	mov    %esp,%ebp
+  801d02:	57                   	push   %edi
+  801d03:	56                   	push   %esi
+  801d04:	53                   	push   %ebx
+  801d05:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801d08:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d10:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d15:	89 cb                	mov    %ecx,%ebx
+  801d17:	89 cf                	mov    %ecx,%edi
+  801d19:	89 ce                	mov    %ecx,%esi
+  801d1b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801d1d:	85 c0                	test   %eax,%eax
+  801d1f:	7f 08                	jg     801d29 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801d21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d24:	5b                   	pop    %ebx
+  801d25:	5e                   	pop    %esi
+  801d26:	5f                   	pop    %edi
+  801d27:	5d                   	pop    %ebp
+  801d28:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d29:	83 ec 0c             	sub    $0xc,%esp
+  801d2c:	50                   	push   %eax
+  801d2d:	6a 03                	push   $0x3
+  801d2f:	68 0b 3f 80 00       	push   $0x803f0b
+  801d34:	6a 23                	push   $0x23
+  801d36:	68 28 3f 80 00       	push   $0x803f28
+  801d3b:	e8 89 f4 ff ff       	call   8011c9 <_panic>
+
+00801d40 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801d40:	55                   	push   %ebp
+  801d41:	89 e5                	mov    %esp,%ebp
+  801d43:	57                   	push   %edi
+  801d44:	56                   	push   %esi
+  801d45:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801d46:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d4b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d50:	89 d1                	mov    %edx,%ecx
+  801d52:	89 d3                	mov    %edx,%ebx
+  801d54:	89 d7                	mov    %edx,%edi
+  801d56:	89 d6                	mov    %edx,%esi
+  801d58:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801d5a:	5b                   	pop    %ebx
+  801d5b:	5e                   	pop    %esi
+  801d5c:	5f                   	pop    %edi
+  801d5d:	5d                   	pop    %ebp
+  801d5e:	c3                   	ret
+
+00801d5f <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801d5f:	55                   	push   %ebp
+  801d60:	89 e5                	mov    %esp,%ebp
+  801d62:	57                   	push   %edi
+  801d63:	56                   	push   %esi
+  801d64:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801d65:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d6a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801d6f:	89 d1                	mov    %edx,%ecx
+  801d71:	89 d3                	mov    %edx,%ebx
+  801d73:	89 d7                	mov    %edx,%edi
+  801d75:	89 d6                	mov    %edx,%esi
+  801d77:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801d79:	5b                   	pop    %ebx
+  801d7a:	5e                   	pop    %esi
+  801d7b:	5f                   	pop    %edi
+  801d7c:	5d                   	pop    %ebp
+  801d7d:	c3                   	ret
+
+00801d7e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801d7e:	55                   	push   %ebp
+  801d7f:	89 e5                	mov    %esp,%ebp
+  801d81:	57                   	push   %edi
+  801d82:	56                   	push   %esi
+  801d83:	53                   	push   %ebx
+  801d84:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801d87:	be 00 00 00 00       	mov    $0x0,%esi
+  801d8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d92:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d97:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d9a:	89 f7                	mov    %esi,%edi
+  801d9c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801d9e:	85 c0                	test   %eax,%eax
+  801da0:	7f 08                	jg     801daa <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801da2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801da5:	5b                   	pop    %ebx
+  801da6:	5e                   	pop    %esi
+  801da7:	5f                   	pop    %edi
+  801da8:	5d                   	pop    %ebp
+  801da9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801daa:	83 ec 0c             	sub    $0xc,%esp
+  801dad:	50                   	push   %eax
+  801dae:	6a 04                	push   $0x4
+  801db0:	68 0b 3f 80 00       	push   $0x803f0b
+  801db5:	6a 23                	push   $0x23
+  801db7:	68 28 3f 80 00       	push   $0x803f28
+  801dbc:	e8 08 f4 ff ff       	call   8011c9 <_panic>
+
+00801dc1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801dc1:	55                   	push   %ebp
+  801dc2:	89 e5                	mov    %esp,%ebp
+  801dc4:	57                   	push   %edi
+  801dc5:	56                   	push   %esi
+  801dc6:	53                   	push   %ebx
+  801dc7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801dca:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dd0:	b8 05 00 00 00       	mov    $0x5,%eax
+  801dd5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801dd8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ddb:	8b 75 18             	mov    0x18(%ebp),%esi
+  801dde:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801de0:	85 c0                	test   %eax,%eax
+  801de2:	7f 08                	jg     801dec <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801de4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801de7:	5b                   	pop    %ebx
+  801de8:	5e                   	pop    %esi
+  801de9:	5f                   	pop    %edi
+  801dea:	5d                   	pop    %ebp
+  801deb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801dec:	83 ec 0c             	sub    $0xc,%esp
+  801def:	50                   	push   %eax
+  801df0:	6a 05                	push   $0x5
+  801df2:	68 0b 3f 80 00       	push   $0x803f0b
+  801df7:	6a 23                	push   $0x23
+  801df9:	68 28 3f 80 00       	push   $0x803f28
+  801dfe:	e8 c6 f3 ff ff       	call   8011c9 <_panic>
+
+00801e03 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801e03:	55                   	push   %ebp
+  801e04:	89 e5                	mov    %esp,%ebp
+  801e06:	57                   	push   %edi
+  801e07:	56                   	push   %esi
+  801e08:	53                   	push   %ebx
+  801e09:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801e0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e11:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e14:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e17:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e1c:	89 df                	mov    %ebx,%edi
+  801e1e:	89 de                	mov    %ebx,%esi
+  801e20:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801e22:	85 c0                	test   %eax,%eax
+  801e24:	7f 08                	jg     801e2e <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801e26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e29:	5b                   	pop    %ebx
+  801e2a:	5e                   	pop    %esi
+  801e2b:	5f                   	pop    %edi
+  801e2c:	5d                   	pop    %ebp
+  801e2d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e2e:	83 ec 0c             	sub    $0xc,%esp
+  801e31:	50                   	push   %eax
+  801e32:	6a 06                	push   $0x6
+  801e34:	68 0b 3f 80 00       	push   $0x803f0b
+  801e39:	6a 23                	push   $0x23
+  801e3b:	68 28 3f 80 00       	push   $0x803f28
+  801e40:	e8 84 f3 ff ff       	call   8011c9 <_panic>
+
+00801e45 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  801e45:	55                   	push   %ebp
+  801e46:	89 e5                	mov    %esp,%ebp
+  801e48:	57                   	push   %edi
+  801e49:	56                   	push   %esi
+  801e4a:	53                   	push   %ebx
+  801e4b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801e4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e53:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e59:	b8 18 00 00 00       	mov    $0x18,%eax
+  801e5e:	89 df                	mov    %ebx,%edi
+  801e60:	89 de                	mov    %ebx,%esi
+  801e62:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801e64:	85 c0                	test   %eax,%eax
+  801e66:	7f 08                	jg     801e70 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801e68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e6b:	5b                   	pop    %ebx
+  801e6c:	5e                   	pop    %esi
+  801e6d:	5f                   	pop    %edi
+  801e6e:	5d                   	pop    %ebp
+  801e6f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e70:	83 ec 0c             	sub    $0xc,%esp
+  801e73:	50                   	push   %eax
+  801e74:	6a 18                	push   $0x18
+  801e76:	68 0b 3f 80 00       	push   $0x803f0b
+  801e7b:	6a 23                	push   $0x23
+  801e7d:	68 28 3f 80 00       	push   $0x803f28
+  801e82:	e8 42 f3 ff ff       	call   8011c9 <_panic>
+
+00801e87 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  801e87:	55                   	push   %ebp
+  801e88:	89 e5                	mov    %esp,%ebp
+  801e8a:	57                   	push   %edi
+  801e8b:	56                   	push   %esi
+  801e8c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801e8d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e92:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e98:	b8 19 00 00 00       	mov    $0x19,%eax
+  801e9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ea0:	89 f7                	mov    %esi,%edi
+  801ea2:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  801ea4:	5b                   	pop    %ebx
+  801ea5:	5e                   	pop    %esi
+  801ea6:	5f                   	pop    %edi
+  801ea7:	5d                   	pop    %ebp
+  801ea8:	c3                   	ret
+
+00801ea9 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  801ea9:	55                   	push   %ebp
+  801eaa:	89 e5                	mov    %esp,%ebp
+  801eac:	57                   	push   %edi
+  801ead:	56                   	push   %esi
+  801eae:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801eaf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eb5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801eba:	be 00 00 00 00       	mov    $0x0,%esi
+  801ebf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ec2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ec5:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  801ec7:	5b                   	pop    %ebx
+  801ec8:	5e                   	pop    %esi
+  801ec9:	5f                   	pop    %edi
+  801eca:	5d                   	pop    %ebp
+  801ecb:	c3                   	ret
+
+00801ecc <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  801ecc:	55                   	push   %ebp
+  801ecd:	89 e5                	mov    %esp,%ebp
+  801ecf:	57                   	push   %edi
+  801ed0:	56                   	push   %esi
+  801ed1:	53                   	push   %ebx
+  801ed2:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  801ed5:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  801ed8:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801ede:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  801ee1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ee4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ee7:	b8 10 00 00 00       	mov    $0x10,%eax
+  801eec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801eef:	8b 75 18             	mov    0x18(%ebp),%esi
+  801ef2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801ef4:	85 c0                	test   %eax,%eax
+  801ef6:	7f 08                	jg     801f00 <sys_page_map_range+0x34>
+}
+  801ef8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801efb:	5b                   	pop    %ebx
+  801efc:	5e                   	pop    %esi
+  801efd:	5f                   	pop    %edi
+  801efe:	5d                   	pop    %ebp
+  801eff:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f00:	83 ec 0c             	sub    $0xc,%esp
+  801f03:	50                   	push   %eax
+  801f04:	6a 10                	push   $0x10
+  801f06:	68 0b 3f 80 00       	push   $0x803f0b
+  801f0b:	6a 23                	push   $0x23
+  801f0d:	68 28 3f 80 00       	push   $0x803f28
+  801f12:	e8 b2 f2 ff ff       	call   8011c9 <_panic>
+
+00801f17 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  801f17:	55                   	push   %ebp
+  801f18:	89 e5                	mov    %esp,%ebp
+  801f1a:	57                   	push   %edi
+  801f1b:	56                   	push   %esi
+  801f1c:	53                   	push   %ebx
+  801f1d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801f20:	be 00 00 00 00       	mov    $0x0,%esi
+  801f25:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f2b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801f30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f33:	89 f7                	mov    %esi,%edi
+  801f35:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801f37:	85 c0                	test   %eax,%eax
+  801f39:	7f 08                	jg     801f43 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  801f3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f3e:	5b                   	pop    %ebx
+  801f3f:	5e                   	pop    %esi
+  801f40:	5f                   	pop    %edi
+  801f41:	5d                   	pop    %ebp
+  801f42:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f43:	83 ec 0c             	sub    $0xc,%esp
+  801f46:	50                   	push   %eax
+  801f47:	6a 11                	push   $0x11
+  801f49:	68 0b 3f 80 00       	push   $0x803f0b
+  801f4e:	6a 23                	push   $0x23
+  801f50:	68 28 3f 80 00       	push   $0x803f28
+  801f55:	e8 6f f2 ff ff       	call   8011c9 <_panic>
+
+00801f5a <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  801f5a:	55                   	push   %ebp
+  801f5b:	89 e5                	mov    %esp,%ebp
+  801f5d:	57                   	push   %edi
+  801f5e:	56                   	push   %esi
+  801f5f:	53                   	push   %ebx
+  801f60:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801f63:	be 00 00 00 00       	mov    $0x0,%esi
+  801f68:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f6e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801f73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f76:	89 f7                	mov    %esi,%edi
+  801f78:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801f7a:	85 c0                	test   %eax,%eax
+  801f7c:	7f 08                	jg     801f86 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  801f7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f81:	5b                   	pop    %ebx
+  801f82:	5e                   	pop    %esi
+  801f83:	5f                   	pop    %edi
+  801f84:	5d                   	pop    %ebp
+  801f85:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f86:	83 ec 0c             	sub    $0xc,%esp
+  801f89:	50                   	push   %eax
+  801f8a:	6a 1b                	push   $0x1b
+  801f8c:	68 0b 3f 80 00       	push   $0x803f0b
+  801f91:	6a 23                	push   $0x23
+  801f93:	68 28 3f 80 00       	push   $0x803f28
+  801f98:	e8 2c f2 ff ff       	call   8011c9 <_panic>
+
+00801f9d <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  801f9d:	55                   	push   %ebp
+  801f9e:	89 e5                	mov    %esp,%ebp
+  801fa0:	57                   	push   %edi
+  801fa1:	56                   	push   %esi
+  801fa2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801fa3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fa8:	b8 12 00 00 00       	mov    $0x12,%eax
+  801fad:	89 d1                	mov    %edx,%ecx
+  801faf:	89 d3                	mov    %edx,%ebx
+  801fb1:	89 d7                	mov    %edx,%edi
+  801fb3:	89 d6                	mov    %edx,%esi
+  801fb5:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801fb7:	5b                   	pop    %ebx
+  801fb8:	5e                   	pop    %esi
+  801fb9:	5f                   	pop    %edi
+  801fba:	5d                   	pop    %ebp
+  801fbb:	c3                   	ret
+
+00801fbc <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801fbc:	55                   	push   %ebp
+  801fbd:	89 e5                	mov    %esp,%ebp
+  801fbf:	57                   	push   %edi
+  801fc0:	56                   	push   %esi
+  801fc1:	53                   	push   %ebx
+  801fc2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801fc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fca:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fd0:	b8 08 00 00 00       	mov    $0x8,%eax
+  801fd5:	89 df                	mov    %ebx,%edi
+  801fd7:	89 de                	mov    %ebx,%esi
+  801fd9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801fdb:	85 c0                	test   %eax,%eax
+  801fdd:	7f 08                	jg     801fe7 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801fdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fe2:	5b                   	pop    %ebx
+  801fe3:	5e                   	pop    %esi
+  801fe4:	5f                   	pop    %edi
+  801fe5:	5d                   	pop    %ebp
+  801fe6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801fe7:	83 ec 0c             	sub    $0xc,%esp
+  801fea:	50                   	push   %eax
+  801feb:	6a 08                	push   $0x8
+  801fed:	68 0b 3f 80 00       	push   $0x803f0b
+  801ff2:	6a 23                	push   $0x23
+  801ff4:	68 28 3f 80 00       	push   $0x803f28
+  801ff9:	e8 cb f1 ff ff       	call   8011c9 <_panic>
+
+00801ffe <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801ffe:	55                   	push   %ebp
+  801fff:	89 e5                	mov    %esp,%ebp
+  802001:	57                   	push   %edi
+  802002:	56                   	push   %esi
+  802003:	53                   	push   %ebx
+  802004:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  802007:	6a 44                	push   $0x44
+  802009:	ff 75 0c             	push   0xc(%ebp)
+  80200c:	e8 7a fc ff ff       	call   801c8b <touch_mem>
+	asm volatile("int %1\n"
+  802011:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802016:	8b 55 08             	mov    0x8(%ebp),%edx
+  802019:	b8 09 00 00 00       	mov    $0x9,%eax
+  80201e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802021:	89 df                	mov    %ebx,%edi
+  802023:	89 de                	mov    %ebx,%esi
+  802025:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802027:	83 c4 08             	add    $0x8,%esp
+  80202a:	85 c0                	test   %eax,%eax
+  80202c:	7f 08                	jg     802036 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80202e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802031:	5b                   	pop    %ebx
+  802032:	5e                   	pop    %esi
+  802033:	5f                   	pop    %edi
+  802034:	5d                   	pop    %ebp
+  802035:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802036:	83 ec 0c             	sub    $0xc,%esp
+  802039:	50                   	push   %eax
+  80203a:	6a 09                	push   $0x9
+  80203c:	68 0b 3f 80 00       	push   $0x803f0b
+  802041:	6a 23                	push   $0x23
+  802043:	68 28 3f 80 00       	push   $0x803f28
+  802048:	e8 7c f1 ff ff       	call   8011c9 <_panic>
+
+0080204d <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  80204d:	55                   	push   %ebp
+  80204e:	89 e5                	mov    %esp,%ebp
+  802050:	57                   	push   %edi
+  802051:	56                   	push   %esi
+  802052:	53                   	push   %ebx
+  802053:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  802056:	be 00 00 00 00       	mov    $0x0,%esi
+  80205b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80205e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802061:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  802066:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802069:	89 f7                	mov    %esi,%edi
+  80206b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80206d:	85 c0                	test   %eax,%eax
+  80206f:	7f 08                	jg     802079 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  802071:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802074:	5b                   	pop    %ebx
+  802075:	5e                   	pop    %esi
+  802076:	5f                   	pop    %edi
+  802077:	5d                   	pop    %ebp
+  802078:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802079:	83 ec 0c             	sub    $0xc,%esp
+  80207c:	50                   	push   %eax
+  80207d:	6a 1a                	push   $0x1a
+  80207f:	68 0b 3f 80 00       	push   $0x803f0b
+  802084:	6a 23                	push   $0x23
+  802086:	68 28 3f 80 00       	push   $0x803f28
+  80208b:	e8 39 f1 ff ff       	call   8011c9 <_panic>
+
+00802090 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  802090:	55                   	push   %ebp
+  802091:	89 e5                	mov    %esp,%ebp
+  802093:	57                   	push   %edi
+  802094:	56                   	push   %esi
+  802095:	53                   	push   %ebx
+  802096:	83 ec 0c             	sub    $0xc,%esp
+  802099:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  80209c:	89 d8                	mov    %ebx,%eax
+  80209e:	c1 e0 05             	shl    $0x5,%eax
+  8020a1:	50                   	push   %eax
+  8020a2:	ff 75 0c             	push   0xc(%ebp)
+  8020a5:	e8 e1 fb ff ff       	call   801c8b <touch_mem>
+	asm volatile("int %1\n"
+  8020aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8020af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020b2:	b8 13 00 00 00       	mov    $0x13,%eax
+  8020b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020ba:	89 f7                	mov    %esi,%edi
+  8020bc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8020be:	83 c4 08             	add    $0x8,%esp
+  8020c1:	85 c0                	test   %eax,%eax
+  8020c3:	7f 08                	jg     8020cd <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8020c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020c8:	5b                   	pop    %ebx
+  8020c9:	5e                   	pop    %esi
+  8020ca:	5f                   	pop    %edi
+  8020cb:	5d                   	pop    %ebp
+  8020cc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020cd:	83 ec 0c             	sub    $0xc,%esp
+  8020d0:	50                   	push   %eax
+  8020d1:	6a 13                	push   $0x13
+  8020d3:	68 0b 3f 80 00       	push   $0x803f0b
+  8020d8:	6a 23                	push   $0x23
+  8020da:	68 28 3f 80 00       	push   $0x803f28
+  8020df:	e8 e5 f0 ff ff       	call   8011c9 <_panic>
+
+008020e4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8020e4:	55                   	push   %ebp
+  8020e5:	89 e5                	mov    %esp,%ebp
+  8020e7:	57                   	push   %edi
+  8020e8:	56                   	push   %esi
+  8020e9:	53                   	push   %ebx
+  8020ea:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8020ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020f8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8020fd:	89 df                	mov    %ebx,%edi
+  8020ff:	89 de                	mov    %ebx,%esi
+  802101:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802103:	85 c0                	test   %eax,%eax
+  802105:	7f 08                	jg     80210f <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  802107:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80210a:	5b                   	pop    %ebx
+  80210b:	5e                   	pop    %esi
+  80210c:	5f                   	pop    %edi
+  80210d:	5d                   	pop    %ebp
+  80210e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80210f:	83 ec 0c             	sub    $0xc,%esp
+  802112:	50                   	push   %eax
+  802113:	6a 0a                	push   $0xa
+  802115:	68 0b 3f 80 00       	push   $0x803f0b
+  80211a:	6a 23                	push   $0x23
+  80211c:	68 28 3f 80 00       	push   $0x803f28
+  802121:	e8 a3 f0 ff ff       	call   8011c9 <_panic>
+
+00802126 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  802126:	55                   	push   %ebp
+  802127:	89 e5                	mov    %esp,%ebp
+  802129:	57                   	push   %edi
+  80212a:	56                   	push   %esi
+  80212b:	53                   	push   %ebx
+  80212c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  80212f:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  802135:	76 1d                	jbe    802154 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  802137:	8b 55 08             	mov    0x8(%ebp),%edx
+  80213a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80213d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802142:	be 01 00 00 00       	mov    $0x1,%esi
+  802147:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80214a:	cd 30                	int    $0x30
+}
+  80214c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80214f:	5b                   	pop    %ebx
+  802150:	5e                   	pop    %esi
+  802151:	5f                   	pop    %edi
+  802152:	5d                   	pop    %ebp
+  802153:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  802154:	68 00 10 00 00       	push   $0x1000
+  802159:	53                   	push   %ebx
+  80215a:	e8 2c fb ff ff       	call   801c8b <touch_mem>
+  80215f:	83 c4 08             	add    $0x8,%esp
+  802162:	eb d3                	jmp    802137 <sys_ipc_send+0x11>
+
+00802164 <sys_ipc_send_pages>:
+{
+  802164:	55                   	push   %ebp
+  802165:	89 e5                	mov    %esp,%ebp
+  802167:	57                   	push   %edi
+  802168:	56                   	push   %esi
+  802169:	53                   	push   %ebx
+  80216a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80216d:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  802170:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  802176:	76 18                	jbe    802190 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  802178:	8b 55 08             	mov    0x8(%ebp),%edx
+  80217b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80217e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802183:	8b 7d 18             	mov    0x18(%ebp),%edi
+  802186:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  802188:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80218b:	5b                   	pop    %ebx
+  80218c:	5e                   	pop    %esi
+  80218d:	5f                   	pop    %edi
+  80218e:	5d                   	pop    %ebp
+  80218f:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  802190:	89 f0                	mov    %esi,%eax
+  802192:	c1 e0 0c             	shl    $0xc,%eax
+  802195:	50                   	push   %eax
+  802196:	53                   	push   %ebx
+  802197:	e8 ef fa ff ff       	call   801c8b <touch_mem>
+  80219c:	83 c4 08             	add    $0x8,%esp
+  80219f:	eb d7                	jmp    802178 <sys_ipc_send_pages+0x14>
+
+008021a1 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8021a1:	55                   	push   %ebp
+  8021a2:	89 e5                	mov    %esp,%ebp
+  8021a4:	57                   	push   %edi
+  8021a5:	56                   	push   %esi
+  8021a6:	53                   	push   %ebx
+  8021a7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8021aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021b5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8021ba:	89 df                	mov    %ebx,%edi
+  8021bc:	89 de                	mov    %ebx,%esi
+  8021be:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8021c0:	85 c0                	test   %eax,%eax
+  8021c2:	7f 08                	jg     8021cc <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8021c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021c7:	5b                   	pop    %ebx
+  8021c8:	5e                   	pop    %esi
+  8021c9:	5f                   	pop    %edi
+  8021ca:	5d                   	pop    %ebp
+  8021cb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8021cc:	83 ec 0c             	sub    $0xc,%esp
+  8021cf:	50                   	push   %eax
+  8021d0:	6a 0d                	push   $0xd
+  8021d2:	68 0b 3f 80 00       	push   $0x803f0b
+  8021d7:	6a 23                	push   $0x23
+  8021d9:	68 28 3f 80 00       	push   $0x803f28
+  8021de:	e8 e6 ef ff ff       	call   8011c9 <_panic>
+
+008021e3 <sys_ipc_recv>:
+{
+  8021e3:	55                   	push   %ebp
+  8021e4:	89 e5                	mov    %esp,%ebp
+  8021e6:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8021e9:	6a 01                	push   $0x1
+  8021eb:	ff 75 08             	push   0x8(%ebp)
+  8021ee:	e8 ae ff ff ff       	call   8021a1 <sys_ipc_recv_pages>
+}
+  8021f3:	c9                   	leave
+  8021f4:	c3                   	ret
+
+008021f5 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8021f5:	55                   	push   %ebp
+  8021f6:	89 e5                	mov    %esp,%ebp
+  8021f8:	57                   	push   %edi
+  8021f9:	56                   	push   %esi
+  8021fa:	53                   	push   %ebx
+  8021fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8021fe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802201:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  802204:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80220a:	77 04                	ja     802210 <sys_ipc_call+0x1b>
+  80220c:	85 f6                	test   %esi,%esi
+  80220e:	75 15                	jne    802225 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  802210:	8b 55 08             	mov    0x8(%ebp),%edx
+  802213:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802216:	b8 14 00 00 00       	mov    $0x14,%eax
+  80221b:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80221d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802220:	5b                   	pop    %ebx
+  802221:	5e                   	pop    %esi
+  802222:	5f                   	pop    %edi
+  802223:	5d                   	pop    %ebp
+  802224:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  802225:	89 f8                	mov    %edi,%eax
+  802227:	c1 e0 0c             	shl    $0xc,%eax
+  80222a:	50                   	push   %eax
+  80222b:	53                   	push   %ebx
+  80222c:	e8 5a fa ff ff       	call   801c8b <touch_mem>
+  802231:	83 c4 08             	add    $0x8,%esp
+  802234:	eb da                	jmp    802210 <sys_ipc_call+0x1b>
+
+00802236 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  802236:	55                   	push   %ebp
+  802237:	89 e5                	mov    %esp,%ebp
+  802239:	57                   	push   %edi
+  80223a:	56                   	push   %esi
+  80223b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80223c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80223f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802242:	b8 15 00 00 00       	mov    $0x15,%eax
+  802247:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80224a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80224d:	8b 75 18             	mov    0x18(%ebp),%esi
+  802250:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  802252:	5b                   	pop    %ebx
+  802253:	5e                   	pop    %esi
+  802254:	5f                   	pop    %edi
+  802255:	5d                   	pop    %ebp
+  802256:	c3                   	ret
+
+00802257 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  802257:	55                   	push   %ebp
+  802258:	89 e5                	mov    %esp,%ebp
+  80225a:	57                   	push   %edi
+  80225b:	56                   	push   %esi
+  80225c:	53                   	push   %ebx
+  80225d:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  802260:	6a 04                	push   $0x4
+  802262:	ff 75 08             	push   0x8(%ebp)
+  802265:	e8 21 fa ff ff       	call   801c8b <touch_mem>
+	asm volatile("int %1\n"
+  80226a:	be 00 00 00 00       	mov    $0x0,%esi
+  80226f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802272:	b8 16 00 00 00       	mov    $0x16,%eax
+  802277:	8b 55 08             	mov    0x8(%ebp),%edx
+  80227a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80227d:	89 f7                	mov    %esi,%edi
+  80227f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802281:	83 c4 08             	add    $0x8,%esp
+  802284:	85 c0                	test   %eax,%eax
+  802286:	7f 08                	jg     802290 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  802288:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80228b:	5b                   	pop    %ebx
+  80228c:	5e                   	pop    %esi
+  80228d:	5f                   	pop    %edi
+  80228e:	5d                   	pop    %ebp
+  80228f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802290:	83 ec 0c             	sub    $0xc,%esp
+  802293:	50                   	push   %eax
+  802294:	6a 16                	push   $0x16
+  802296:	68 0b 3f 80 00       	push   $0x803f0b
+  80229b:	6a 23                	push   $0x23
+  80229d:	68 28 3f 80 00       	push   $0x803f28
+  8022a2:	e8 22 ef ff ff       	call   8011c9 <_panic>
+
+008022a7 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8022a7:	55                   	push   %ebp
+  8022a8:	89 e5                	mov    %esp,%ebp
+  8022aa:	57                   	push   %edi
+  8022ab:	56                   	push   %esi
+  8022ac:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8022ad:	6a 04                	push   $0x4
+  8022af:	ff 75 08             	push   0x8(%ebp)
+  8022b2:	e8 d4 f9 ff ff       	call   801c8b <touch_mem>
+	asm volatile("int %1\n"
+  8022b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022bf:	b8 17 00 00 00       	mov    $0x17,%eax
+  8022c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022c7:	89 df                	mov    %ebx,%edi
+  8022c9:	89 de                	mov    %ebx,%esi
+  8022cb:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8022cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022d0:	5b                   	pop    %ebx
+  8022d1:	5e                   	pop    %esi
+  8022d2:	5f                   	pop    %edi
+  8022d3:	5d                   	pop    %ebp
+  8022d4:	c3                   	ret
+
+008022d5 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8022d5:	55                   	push   %ebp
+  8022d6:	89 e5                	mov    %esp,%ebp
+  8022d8:	57                   	push   %edi
+  8022d9:	56                   	push   %esi
+  8022da:	53                   	push   %ebx
+  8022db:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8022de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022e6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8022eb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022f0:	89 df                	mov    %ebx,%edi
+  8022f2:	89 de                	mov    %ebx,%esi
+  8022f4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8022f6:	85 c0                	test   %eax,%eax
+  8022f8:	7f 08                	jg     802302 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  8022fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022fd:	5b                   	pop    %ebx
+  8022fe:	5e                   	pop    %esi
+  8022ff:	5f                   	pop    %edi
+  802300:	5d                   	pop    %ebp
+  802301:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802302:	83 ec 0c             	sub    $0xc,%esp
+  802305:	50                   	push   %eax
+  802306:	6a 0e                	push   $0xe
+  802308:	68 0b 3f 80 00       	push   $0x803f0b
+  80230d:	6a 23                	push   $0x23
+  80230f:	68 28 3f 80 00       	push   $0x803f28
+  802314:	e8 b0 ee ff ff       	call   8011c9 <_panic>
+
+00802319 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  802319:	55                   	push   %ebp
+  80231a:	89 e5                	mov    %esp,%ebp
+  80231c:	57                   	push   %edi
+  80231d:	56                   	push   %esi
+  80231e:	53                   	push   %ebx
+  80231f:	83 ec 14             	sub    $0x14,%esp
+  802322:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802325:	8b 75 14             	mov    0x14(%ebp),%esi
+  802328:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  80232b:	ff 75 10             	push   0x10(%ebp)
+  80232e:	ff 75 0c             	push   0xc(%ebp)
+  802331:	e8 6b fe ff ff       	call   8021a1 <sys_ipc_recv_pages>
+  802336:	83 c4 10             	add    $0x10,%esp
+  802339:	85 c0                	test   %eax,%eax
+  80233b:	78 46                	js     802383 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80233d:	85 ff                	test   %edi,%edi
+  80233f:	74 0d                	je     80234e <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  802341:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  802346:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80234c:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80234e:	85 f6                	test   %esi,%esi
+  802350:	74 0d                	je     80235f <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  802352:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  802357:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80235d:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80235f:	85 db                	test   %ebx,%ebx
+  802361:	74 0d                	je     802370 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  802363:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  802368:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80236e:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802370:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  802375:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80237b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80237e:	5b                   	pop    %ebx
+  80237f:	5e                   	pop    %esi
+  802380:	5f                   	pop    %edi
+  802381:	5d                   	pop    %ebp
+  802382:	c3                   	ret
+		if (from_env_store) {
+  802383:	85 ff                	test   %edi,%edi
+  802385:	74 06                	je     80238d <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  802387:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80238d:	85 f6                	test   %esi,%esi
+  80238f:	74 06                	je     802397 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  802391:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802397:	85 db                	test   %ebx,%ebx
+  802399:	74 e0                	je     80237b <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  80239b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8023a1:	eb d8                	jmp    80237b <ipc_recv_pages+0x62>
+
+008023a3 <ipc_recv>:
+{
+  8023a3:	55                   	push   %ebp
+  8023a4:	89 e5                	mov    %esp,%ebp
+  8023a6:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8023a9:	6a 00                	push   $0x0
+  8023ab:	ff 75 10             	push   0x10(%ebp)
+  8023ae:	6a 01                	push   $0x1
+  8023b0:	ff 75 0c             	push   0xc(%ebp)
+  8023b3:	ff 75 08             	push   0x8(%ebp)
+  8023b6:	e8 5e ff ff ff       	call   802319 <ipc_recv_pages>
+}
+  8023bb:	c9                   	leave
+  8023bc:	c3                   	ret
+
+008023bd <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8023bd:	55                   	push   %ebp
+  8023be:	89 e5                	mov    %esp,%ebp
+  8023c0:	56                   	push   %esi
+  8023c1:	53                   	push   %ebx
+  8023c2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8023c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8023c8:	83 ec 0c             	sub    $0xc,%esp
+  8023cb:	ff 75 0c             	push   0xc(%ebp)
+  8023ce:	e8 02 ff ff ff       	call   8022d5 <sys_ipc_try_recv>
+  8023d3:	83 c4 10             	add    $0x10,%esp
+  8023d6:	85 c0                	test   %eax,%eax
+  8023d8:	78 34                	js     80240e <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8023da:	85 f6                	test   %esi,%esi
+  8023dc:	74 0d                	je     8023eb <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8023de:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  8023e3:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8023e9:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8023eb:	85 db                	test   %ebx,%ebx
+  8023ed:	74 0d                	je     8023fc <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8023ef:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  8023f4:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8023fa:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8023fc:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  802401:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802407:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80240a:	5b                   	pop    %ebx
+  80240b:	5e                   	pop    %esi
+  80240c:	5d                   	pop    %ebp
+  80240d:	c3                   	ret
+		if (from_env_store) {
+  80240e:	85 f6                	test   %esi,%esi
+  802410:	74 06                	je     802418 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  802412:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  802418:	85 db                	test   %ebx,%ebx
+  80241a:	74 eb                	je     802407 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  80241c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802422:	eb e3                	jmp    802407 <ipc_try_recv+0x4a>
+
+00802424 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802424:	55                   	push   %ebp
+  802425:	89 e5                	mov    %esp,%ebp
+  802427:	83 ec 14             	sub    $0x14,%esp
+  80242a:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80242d:	85 c0                	test   %eax,%eax
+  80242f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802434:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802437:	ff 75 18             	push   0x18(%ebp)
+  80243a:	ff 75 14             	push   0x14(%ebp)
+  80243d:	50                   	push   %eax
+  80243e:	ff 75 0c             	push   0xc(%ebp)
+  802441:	ff 75 08             	push   0x8(%ebp)
+  802444:	e8 1b fd ff ff       	call   802164 <sys_ipc_send_pages>
+  802449:	83 c4 20             	add    $0x20,%esp
+  80244c:	85 c0                	test   %eax,%eax
+  80244e:	78 02                	js     802452 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  802450:	c9                   	leave
+  802451:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  802452:	50                   	push   %eax
+  802453:	68 38 3f 80 00       	push   $0x803f38
+  802458:	68 80 00 00 00       	push   $0x80
+  80245d:	68 64 3f 80 00       	push   $0x803f64
+  802462:	e8 62 ed ff ff       	call   8011c9 <_panic>
+
+00802467 <ipc_send>:
+{
+  802467:	55                   	push   %ebp
+  802468:	89 e5                	mov    %esp,%ebp
+  80246a:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  80246d:	ff 75 14             	push   0x14(%ebp)
+  802470:	6a 01                	push   $0x1
+  802472:	ff 75 10             	push   0x10(%ebp)
+  802475:	ff 75 0c             	push   0xc(%ebp)
+  802478:	ff 75 08             	push   0x8(%ebp)
+  80247b:	e8 a4 ff ff ff       	call   802424 <ipc_send_pages>
+}
+  802480:	83 c4 20             	add    $0x20,%esp
+  802483:	c9                   	leave
+  802484:	c3                   	ret
+
+00802485 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802485:	55                   	push   %ebp
+  802486:	89 e5                	mov    %esp,%ebp
+  802488:	83 ec 14             	sub    $0x14,%esp
+  80248b:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80248e:	85 c0                	test   %eax,%eax
+  802490:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802495:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802498:	ff 75 18             	push   0x18(%ebp)
+  80249b:	ff 75 14             	push   0x14(%ebp)
+  80249e:	50                   	push   %eax
+  80249f:	ff 75 0c             	push   0xc(%ebp)
+  8024a2:	ff 75 08             	push   0x8(%ebp)
+  8024a5:	e8 4b fd ff ff       	call   8021f5 <sys_ipc_call>
+  8024aa:	83 c4 20             	add    $0x20,%esp
+  8024ad:	85 c0                	test   %eax,%eax
+  8024af:	78 0b                	js     8024bc <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  8024b1:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  8024b6:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8024bc:	c9                   	leave
+  8024bd:	c3                   	ret
+
+008024be <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  8024be:	55                   	push   %ebp
+  8024bf:	89 e5                	mov    %esp,%ebp
+  8024c1:	57                   	push   %edi
+  8024c2:	56                   	push   %esi
+  8024c3:	53                   	push   %ebx
+  8024c4:	83 ec 18             	sub    $0x18,%esp
+  8024c7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024ca:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8024cd:	8b 75 20             	mov    0x20(%ebp),%esi
+  8024d0:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8024d3:	85 c0                	test   %eax,%eax
+  8024d5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8024da:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8024dd:	ff 75 18             	push   0x18(%ebp)
+  8024e0:	ff 75 14             	push   0x14(%ebp)
+  8024e3:	50                   	push   %eax
+  8024e4:	ff 75 0c             	push   0xc(%ebp)
+  8024e7:	ff 75 08             	push   0x8(%ebp)
+  8024ea:	e8 47 fd ff ff       	call   802236 <sys_ipc_reply_recv>
+  8024ef:	83 c4 20             	add    $0x20,%esp
+  8024f2:	85 c0                	test   %eax,%eax
+  8024f4:	78 46                	js     80253c <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8024f6:	85 ff                	test   %edi,%edi
+  8024f8:	74 0d                	je     802507 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8024fa:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  8024ff:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802505:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802507:	85 f6                	test   %esi,%esi
+  802509:	74 0d                	je     802518 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  80250b:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  802510:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802516:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802518:	85 db                	test   %ebx,%ebx
+  80251a:	74 0d                	je     802529 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  80251c:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  802521:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802527:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802529:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  80252e:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802534:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802537:	5b                   	pop    %ebx
+  802538:	5e                   	pop    %esi
+  802539:	5f                   	pop    %edi
+  80253a:	5d                   	pop    %ebp
+  80253b:	c3                   	ret
+		if (from_env_store) {
+  80253c:	85 ff                	test   %edi,%edi
+  80253e:	74 06                	je     802546 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  802540:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802546:	85 f6                	test   %esi,%esi
+  802548:	74 06                	je     802550 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  80254a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802550:	85 db                	test   %ebx,%ebx
+  802552:	74 e0                	je     802534 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  802554:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80255a:	eb d8                	jmp    802534 <ipc_reply_recv+0x76>
+
+0080255c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80255c:	55                   	push   %ebp
+  80255d:	89 e5                	mov    %esp,%ebp
+  80255f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802562:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  802567:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80256a:	c1 e0 06             	shl    $0x6,%eax
+  80256d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802572:	8b 40 50             	mov    0x50(%eax),%eax
+  802575:	39 c8                	cmp    %ecx,%eax
+  802577:	74 12                	je     80258b <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802579:	83 c2 01             	add    $0x1,%edx
+  80257c:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802582:	75 e3                	jne    802567 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802584:	b8 00 00 00 00       	mov    $0x0,%eax
+  802589:	eb 0e                	jmp    802599 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80258b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80258e:	c1 e0 06             	shl    $0x6,%eax
+  802591:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802596:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802599:	5d                   	pop    %ebp
+  80259a:	c3                   	ret
+
+0080259b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80259b:	55                   	push   %ebp
+  80259c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80259e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a1:	05 00 00 00 30       	add    $0x30000000,%eax
+  8025a6:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8025a9:	5d                   	pop    %ebp
+  8025aa:	c3                   	ret
+
+008025ab <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8025ab:	55                   	push   %ebp
+  8025ac:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8025ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b1:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8025b6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8025bb:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8025c0:	5d                   	pop    %ebp
+  8025c1:	c3                   	ret
+
+008025c2 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8025c2:	55                   	push   %ebp
+  8025c3:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8025c5:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8025ca:	a8 01                	test   $0x1,%al
+  8025cc:	74 3c                	je     80260a <fd_alloc+0x48>
+  8025ce:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8025d3:	89 c2                	mov    %eax,%edx
+  8025d5:	c1 ea 0c             	shr    $0xc,%edx
+  8025d8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8025df:	89 c1                	mov    %eax,%ecx
+  8025e1:	05 00 10 00 00       	add    $0x1000,%eax
+  8025e6:	f6 c2 01             	test   $0x1,%dl
+  8025e9:	74 13                	je     8025fe <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8025eb:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8025f0:	75 e1                	jne    8025d3 <fd_alloc+0x11>
+  8025f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8025f7:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8025fc:	eb 05                	jmp    802603 <fd_alloc+0x41>
+			return 0;
+  8025fe:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  802603:	8b 55 08             	mov    0x8(%ebp),%edx
+  802606:	89 0a                	mov    %ecx,(%edx)
+}
+  802608:	5d                   	pop    %ebp
+  802609:	c3                   	ret
+  80260a:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  80260f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802614:	eb ed                	jmp    802603 <fd_alloc+0x41>
+
+00802616 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802616:	55                   	push   %ebp
+  802617:	89 e5                	mov    %esp,%ebp
+  802619:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80261c:	83 f8 1f             	cmp    $0x1f,%eax
+  80261f:	77 30                	ja     802651 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802621:	c1 e0 0c             	shl    $0xc,%eax
+  802624:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802629:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80262f:	f6 c2 01             	test   $0x1,%dl
+  802632:	74 24                	je     802658 <fd_lookup+0x42>
+  802634:	89 c2                	mov    %eax,%edx
+  802636:	c1 ea 0c             	shr    $0xc,%edx
+  802639:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802640:	f6 c2 01             	test   $0x1,%dl
+  802643:	74 1a                	je     80265f <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  802645:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802648:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80264a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80264f:	5d                   	pop    %ebp
+  802650:	c3                   	ret
+		return -E_INVAL;
+  802651:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802656:	eb f7                	jmp    80264f <fd_lookup+0x39>
+		return -E_INVAL;
+  802658:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80265d:	eb f0                	jmp    80264f <fd_lookup+0x39>
+  80265f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802664:	eb e9                	jmp    80264f <fd_lookup+0x39>
+
+00802666 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802666:	55                   	push   %ebp
+  802667:	89 e5                	mov    %esp,%ebp
+  802669:	53                   	push   %ebx
+  80266a:	83 ec 04             	sub    $0x4,%esp
+  80266d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802670:	b8 ec 3f 80 00       	mov    $0x803fec,%eax
+  802675:	8b 18                	mov    (%eax),%ebx
+  802677:	85 db                	test   %ebx,%ebx
+  802679:	74 0e                	je     802689 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  80267b:	83 c0 04             	add    $0x4,%eax
+  80267e:	39 13                	cmp    %edx,(%ebx)
+  802680:	75 f3                	jne    802675 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  802682:	b8 00 00 00 00       	mov    $0x0,%eax
+  802687:	eb 1f                	jmp    8026a8 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802689:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  80268e:	8b 40 48             	mov    0x48(%eax),%eax
+  802691:	83 ec 04             	sub    $0x4,%esp
+  802694:	52                   	push   %edx
+  802695:	50                   	push   %eax
+  802696:	68 70 3f 80 00       	push   $0x803f70
+  80269b:	e8 04 ec ff ff       	call   8012a4 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8026a0:	83 c4 10             	add    $0x10,%esp
+  8026a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8026a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8026ab:	89 1a                	mov    %ebx,(%edx)
+}
+  8026ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026b0:	c9                   	leave
+  8026b1:	c3                   	ret
+
+008026b2 <fd_close>:
+{
+  8026b2:	55                   	push   %ebp
+  8026b3:	89 e5                	mov    %esp,%ebp
+  8026b5:	57                   	push   %edi
+  8026b6:	56                   	push   %esi
+  8026b7:	53                   	push   %ebx
+  8026b8:	83 ec 24             	sub    $0x24,%esp
+  8026bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8026be:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8026c1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8026c4:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8026c5:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8026cb:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8026ce:	50                   	push   %eax
+  8026cf:	e8 42 ff ff ff       	call   802616 <fd_lookup>
+  8026d4:	89 c3                	mov    %eax,%ebx
+  8026d6:	83 c4 10             	add    $0x10,%esp
+  8026d9:	85 c0                	test   %eax,%eax
+  8026db:	78 05                	js     8026e2 <fd_close+0x30>
+	    || fd != fd2)
+  8026dd:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8026e0:	74 16                	je     8026f8 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8026e2:	89 f8                	mov    %edi,%eax
+  8026e4:	84 c0                	test   %al,%al
+  8026e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026eb:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8026ee:	89 d8                	mov    %ebx,%eax
+  8026f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026f3:	5b                   	pop    %ebx
+  8026f4:	5e                   	pop    %esi
+  8026f5:	5f                   	pop    %edi
+  8026f6:	5d                   	pop    %ebp
+  8026f7:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8026f8:	83 ec 08             	sub    $0x8,%esp
+  8026fb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8026fe:	50                   	push   %eax
+  8026ff:	ff 36                	push   (%esi)
+  802701:	e8 60 ff ff ff       	call   802666 <dev_lookup>
+  802706:	89 c3                	mov    %eax,%ebx
+  802708:	83 c4 10             	add    $0x10,%esp
+  80270b:	85 c0                	test   %eax,%eax
+  80270d:	78 1a                	js     802729 <fd_close+0x77>
+		if (dev->dev_close)
+  80270f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802712:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802715:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80271a:	85 c0                	test   %eax,%eax
+  80271c:	74 0b                	je     802729 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80271e:	83 ec 0c             	sub    $0xc,%esp
+  802721:	56                   	push   %esi
+  802722:	ff d0                	call   *%eax
+  802724:	89 c3                	mov    %eax,%ebx
+  802726:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802729:	83 ec 08             	sub    $0x8,%esp
+  80272c:	56                   	push   %esi
+  80272d:	6a 00                	push   $0x0
+  80272f:	e8 cf f6 ff ff       	call   801e03 <sys_page_unmap>
+	return r;
+  802734:	83 c4 10             	add    $0x10,%esp
+  802737:	eb b5                	jmp    8026ee <fd_close+0x3c>
+
+00802739 <close>:
+
+int
+close(int fdnum)
+{
+  802739:	55                   	push   %ebp
+  80273a:	89 e5                	mov    %esp,%ebp
+  80273c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80273f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802742:	50                   	push   %eax
+  802743:	ff 75 08             	push   0x8(%ebp)
+  802746:	e8 cb fe ff ff       	call   802616 <fd_lookup>
+  80274b:	83 c4 10             	add    $0x10,%esp
+  80274e:	85 c0                	test   %eax,%eax
+  802750:	79 02                	jns    802754 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802752:	c9                   	leave
+  802753:	c3                   	ret
+		return fd_close(fd, 1);
+  802754:	83 ec 08             	sub    $0x8,%esp
+  802757:	6a 01                	push   $0x1
+  802759:	ff 75 f4             	push   -0xc(%ebp)
+  80275c:	e8 51 ff ff ff       	call   8026b2 <fd_close>
+  802761:	83 c4 10             	add    $0x10,%esp
+  802764:	eb ec                	jmp    802752 <close+0x19>
+
+00802766 <close_all>:
+
+void
+close_all(void)
+{
+  802766:	55                   	push   %ebp
+  802767:	89 e5                	mov    %esp,%ebp
+  802769:	53                   	push   %ebx
+  80276a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80276d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802772:	83 ec 0c             	sub    $0xc,%esp
+  802775:	53                   	push   %ebx
+  802776:	e8 be ff ff ff       	call   802739 <close>
+	for (i = 0; i < MAXFD; i++)
+  80277b:	83 c3 01             	add    $0x1,%ebx
+  80277e:	83 c4 10             	add    $0x10,%esp
+  802781:	83 fb 20             	cmp    $0x20,%ebx
+  802784:	75 ec                	jne    802772 <close_all+0xc>
+}
+  802786:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802789:	c9                   	leave
+  80278a:	c3                   	ret
+
+0080278b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80278b:	55                   	push   %ebp
+  80278c:	89 e5                	mov    %esp,%ebp
+  80278e:	57                   	push   %edi
+  80278f:	56                   	push   %esi
+  802790:	53                   	push   %ebx
+  802791:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802794:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802797:	50                   	push   %eax
+  802798:	ff 75 08             	push   0x8(%ebp)
+  80279b:	e8 76 fe ff ff       	call   802616 <fd_lookup>
+  8027a0:	89 c3                	mov    %eax,%ebx
+  8027a2:	83 c4 10             	add    $0x10,%esp
+  8027a5:	85 c0                	test   %eax,%eax
+  8027a7:	78 7f                	js     802828 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8027a9:	83 ec 0c             	sub    $0xc,%esp
+  8027ac:	ff 75 0c             	push   0xc(%ebp)
+  8027af:	e8 85 ff ff ff       	call   802739 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8027b4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8027b7:	c1 e6 0c             	shl    $0xc,%esi
+  8027ba:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8027c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8027c3:	89 3c 24             	mov    %edi,(%esp)
+  8027c6:	e8 e0 fd ff ff       	call   8025ab <fd2data>
+  8027cb:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8027cd:	89 34 24             	mov    %esi,(%esp)
+  8027d0:	e8 d6 fd ff ff       	call   8025ab <fd2data>
+  8027d5:	83 c4 10             	add    $0x10,%esp
+  8027d8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8027db:	89 d8                	mov    %ebx,%eax
+  8027dd:	c1 e8 16             	shr    $0x16,%eax
+  8027e0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8027e7:	a8 01                	test   $0x1,%al
+  8027e9:	74 11                	je     8027fc <dup+0x71>
+  8027eb:	89 d8                	mov    %ebx,%eax
+  8027ed:	c1 e8 0c             	shr    $0xc,%eax
+  8027f0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8027f7:	f6 c2 01             	test   $0x1,%dl
+  8027fa:	75 36                	jne    802832 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8027fc:	89 f8                	mov    %edi,%eax
+  8027fe:	c1 e8 0c             	shr    $0xc,%eax
+  802801:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802808:	83 ec 0c             	sub    $0xc,%esp
+  80280b:	25 07 0e 00 00       	and    $0xe07,%eax
+  802810:	50                   	push   %eax
+  802811:	56                   	push   %esi
+  802812:	6a 00                	push   $0x0
+  802814:	57                   	push   %edi
+  802815:	6a 00                	push   $0x0
+  802817:	e8 a5 f5 ff ff       	call   801dc1 <sys_page_map>
+  80281c:	89 c3                	mov    %eax,%ebx
+  80281e:	83 c4 20             	add    $0x20,%esp
+  802821:	85 c0                	test   %eax,%eax
+  802823:	78 33                	js     802858 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802825:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802828:	89 d8                	mov    %ebx,%eax
+  80282a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80282d:	5b                   	pop    %ebx
+  80282e:	5e                   	pop    %esi
+  80282f:	5f                   	pop    %edi
+  802830:	5d                   	pop    %ebp
+  802831:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802832:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802839:	83 ec 0c             	sub    $0xc,%esp
+  80283c:	25 07 0e 00 00       	and    $0xe07,%eax
+  802841:	50                   	push   %eax
+  802842:	ff 75 d4             	push   -0x2c(%ebp)
+  802845:	6a 00                	push   $0x0
+  802847:	53                   	push   %ebx
+  802848:	6a 00                	push   $0x0
+  80284a:	e8 72 f5 ff ff       	call   801dc1 <sys_page_map>
+  80284f:	89 c3                	mov    %eax,%ebx
+  802851:	83 c4 20             	add    $0x20,%esp
+  802854:	85 c0                	test   %eax,%eax
+  802856:	79 a4                	jns    8027fc <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802858:	83 ec 08             	sub    $0x8,%esp
+  80285b:	56                   	push   %esi
+  80285c:	6a 00                	push   $0x0
+  80285e:	e8 a0 f5 ff ff       	call   801e03 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802863:	83 c4 08             	add    $0x8,%esp
+  802866:	ff 75 d4             	push   -0x2c(%ebp)
+  802869:	6a 00                	push   $0x0
+  80286b:	e8 93 f5 ff ff       	call   801e03 <sys_page_unmap>
+	return r;
+  802870:	83 c4 10             	add    $0x10,%esp
+  802873:	eb b3                	jmp    802828 <dup+0x9d>
+
+00802875 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802875:	55                   	push   %ebp
+  802876:	89 e5                	mov    %esp,%ebp
+  802878:	56                   	push   %esi
+  802879:	53                   	push   %ebx
+  80287a:	83 ec 18             	sub    $0x18,%esp
+  80287d:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802880:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802883:	50                   	push   %eax
+  802884:	56                   	push   %esi
+  802885:	e8 8c fd ff ff       	call   802616 <fd_lookup>
+  80288a:	83 c4 10             	add    $0x10,%esp
+  80288d:	85 c0                	test   %eax,%eax
+  80288f:	78 3c                	js     8028cd <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802891:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  802894:	83 ec 08             	sub    $0x8,%esp
+  802897:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80289a:	50                   	push   %eax
+  80289b:	ff 33                	push   (%ebx)
+  80289d:	e8 c4 fd ff ff       	call   802666 <dev_lookup>
+  8028a2:	83 c4 10             	add    $0x10,%esp
+  8028a5:	85 c0                	test   %eax,%eax
+  8028a7:	78 24                	js     8028cd <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8028a9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8028ac:	83 e0 03             	and    $0x3,%eax
+  8028af:	83 f8 01             	cmp    $0x1,%eax
+  8028b2:	74 20                	je     8028d4 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8028b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028b7:	8b 40 08             	mov    0x8(%eax),%eax
+  8028ba:	85 c0                	test   %eax,%eax
+  8028bc:	74 37                	je     8028f5 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8028be:	83 ec 04             	sub    $0x4,%esp
+  8028c1:	ff 75 10             	push   0x10(%ebp)
+  8028c4:	ff 75 0c             	push   0xc(%ebp)
+  8028c7:	53                   	push   %ebx
+  8028c8:	ff d0                	call   *%eax
+  8028ca:	83 c4 10             	add    $0x10,%esp
+}
+  8028cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028d0:	5b                   	pop    %ebx
+  8028d1:	5e                   	pop    %esi
+  8028d2:	5d                   	pop    %ebp
+  8028d3:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8028d4:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  8028d9:	8b 40 48             	mov    0x48(%eax),%eax
+  8028dc:	83 ec 04             	sub    $0x4,%esp
+  8028df:	56                   	push   %esi
+  8028e0:	50                   	push   %eax
+  8028e1:	68 b1 3f 80 00       	push   $0x803fb1
+  8028e6:	e8 b9 e9 ff ff       	call   8012a4 <cprintf>
+		return -E_INVAL;
+  8028eb:	83 c4 10             	add    $0x10,%esp
+  8028ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028f3:	eb d8                	jmp    8028cd <read+0x58>
+		return -E_NOT_SUPP;
+  8028f5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8028fa:	eb d1                	jmp    8028cd <read+0x58>
+
+008028fc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8028fc:	55                   	push   %ebp
+  8028fd:	89 e5                	mov    %esp,%ebp
+  8028ff:	57                   	push   %edi
+  802900:	56                   	push   %esi
+  802901:	53                   	push   %ebx
+  802902:	83 ec 0c             	sub    $0xc,%esp
+  802905:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802908:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80290b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802910:	eb 02                	jmp    802914 <readn+0x18>
+  802912:	01 c3                	add    %eax,%ebx
+  802914:	39 f3                	cmp    %esi,%ebx
+  802916:	73 21                	jae    802939 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802918:	83 ec 04             	sub    $0x4,%esp
+  80291b:	89 f0                	mov    %esi,%eax
+  80291d:	29 d8                	sub    %ebx,%eax
+  80291f:	50                   	push   %eax
+  802920:	89 d8                	mov    %ebx,%eax
+  802922:	03 45 0c             	add    0xc(%ebp),%eax
+  802925:	50                   	push   %eax
+  802926:	57                   	push   %edi
+  802927:	e8 49 ff ff ff       	call   802875 <read>
+		if (m < 0)
+  80292c:	83 c4 10             	add    $0x10,%esp
+  80292f:	85 c0                	test   %eax,%eax
+  802931:	78 04                	js     802937 <readn+0x3b>
+			return m;
+		if (m == 0)
+  802933:	75 dd                	jne    802912 <readn+0x16>
+  802935:	eb 02                	jmp    802939 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802937:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802939:	89 d8                	mov    %ebx,%eax
+  80293b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80293e:	5b                   	pop    %ebx
+  80293f:	5e                   	pop    %esi
+  802940:	5f                   	pop    %edi
+  802941:	5d                   	pop    %ebp
+  802942:	c3                   	ret
+
+00802943 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802943:	55                   	push   %ebp
+  802944:	89 e5                	mov    %esp,%ebp
+  802946:	56                   	push   %esi
+  802947:	53                   	push   %ebx
+  802948:	83 ec 18             	sub    $0x18,%esp
+  80294b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80294e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802951:	50                   	push   %eax
+  802952:	53                   	push   %ebx
+  802953:	e8 be fc ff ff       	call   802616 <fd_lookup>
+  802958:	83 c4 10             	add    $0x10,%esp
+  80295b:	85 c0                	test   %eax,%eax
+  80295d:	78 37                	js     802996 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80295f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802962:	83 ec 08             	sub    $0x8,%esp
+  802965:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802968:	50                   	push   %eax
+  802969:	ff 36                	push   (%esi)
+  80296b:	e8 f6 fc ff ff       	call   802666 <dev_lookup>
+  802970:	83 c4 10             	add    $0x10,%esp
+  802973:	85 c0                	test   %eax,%eax
+  802975:	78 1f                	js     802996 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802977:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80297b:	74 20                	je     80299d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80297d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802980:	8b 40 0c             	mov    0xc(%eax),%eax
+  802983:	85 c0                	test   %eax,%eax
+  802985:	74 37                	je     8029be <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802987:	83 ec 04             	sub    $0x4,%esp
+  80298a:	ff 75 10             	push   0x10(%ebp)
+  80298d:	ff 75 0c             	push   0xc(%ebp)
+  802990:	56                   	push   %esi
+  802991:	ff d0                	call   *%eax
+  802993:	83 c4 10             	add    $0x10,%esp
+}
+  802996:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802999:	5b                   	pop    %ebx
+  80299a:	5e                   	pop    %esi
+  80299b:	5d                   	pop    %ebp
+  80299c:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80299d:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  8029a2:	8b 40 48             	mov    0x48(%eax),%eax
+  8029a5:	83 ec 04             	sub    $0x4,%esp
+  8029a8:	53                   	push   %ebx
+  8029a9:	50                   	push   %eax
+  8029aa:	68 cd 3f 80 00       	push   $0x803fcd
+  8029af:	e8 f0 e8 ff ff       	call   8012a4 <cprintf>
+		return -E_INVAL;
+  8029b4:	83 c4 10             	add    $0x10,%esp
+  8029b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029bc:	eb d8                	jmp    802996 <write+0x53>
+		return -E_NOT_SUPP;
+  8029be:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8029c3:	eb d1                	jmp    802996 <write+0x53>
+
+008029c5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8029c5:	55                   	push   %ebp
+  8029c6:	89 e5                	mov    %esp,%ebp
+  8029c8:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029ce:	50                   	push   %eax
+  8029cf:	ff 75 08             	push   0x8(%ebp)
+  8029d2:	e8 3f fc ff ff       	call   802616 <fd_lookup>
+  8029d7:	83 c4 10             	add    $0x10,%esp
+  8029da:	85 c0                	test   %eax,%eax
+  8029dc:	78 0e                	js     8029ec <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8029de:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029e4:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8029e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029ec:	c9                   	leave
+  8029ed:	c3                   	ret
+
+008029ee <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8029ee:	55                   	push   %ebp
+  8029ef:	89 e5                	mov    %esp,%ebp
+  8029f1:	56                   	push   %esi
+  8029f2:	53                   	push   %ebx
+  8029f3:	83 ec 18             	sub    $0x18,%esp
+  8029f6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8029f9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8029fc:	50                   	push   %eax
+  8029fd:	53                   	push   %ebx
+  8029fe:	e8 13 fc ff ff       	call   802616 <fd_lookup>
+  802a03:	83 c4 10             	add    $0x10,%esp
+  802a06:	85 c0                	test   %eax,%eax
+  802a08:	78 34                	js     802a3e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802a0a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802a0d:	83 ec 08             	sub    $0x8,%esp
+  802a10:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a13:	50                   	push   %eax
+  802a14:	ff 36                	push   (%esi)
+  802a16:	e8 4b fc ff ff       	call   802666 <dev_lookup>
+  802a1b:	83 c4 10             	add    $0x10,%esp
+  802a1e:	85 c0                	test   %eax,%eax
+  802a20:	78 1c                	js     802a3e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802a22:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802a26:	74 1d                	je     802a45 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802a28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a2b:	8b 40 18             	mov    0x18(%eax),%eax
+  802a2e:	85 c0                	test   %eax,%eax
+  802a30:	74 34                	je     802a66 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802a32:	83 ec 08             	sub    $0x8,%esp
+  802a35:	ff 75 0c             	push   0xc(%ebp)
+  802a38:	56                   	push   %esi
+  802a39:	ff d0                	call   *%eax
+  802a3b:	83 c4 10             	add    $0x10,%esp
+}
+  802a3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a41:	5b                   	pop    %ebx
+  802a42:	5e                   	pop    %esi
+  802a43:	5d                   	pop    %ebp
+  802a44:	c3                   	ret
+			thisenv->env_id, fdnum);
+  802a45:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  802a4a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802a4d:	83 ec 04             	sub    $0x4,%esp
+  802a50:	53                   	push   %ebx
+  802a51:	50                   	push   %eax
+  802a52:	68 90 3f 80 00       	push   $0x803f90
+  802a57:	e8 48 e8 ff ff       	call   8012a4 <cprintf>
+		return -E_INVAL;
+  802a5c:	83 c4 10             	add    $0x10,%esp
+  802a5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a64:	eb d8                	jmp    802a3e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802a66:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a6b:	eb d1                	jmp    802a3e <ftruncate+0x50>
+
+00802a6d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802a6d:	55                   	push   %ebp
+  802a6e:	89 e5                	mov    %esp,%ebp
+  802a70:	56                   	push   %esi
+  802a71:	53                   	push   %ebx
+  802a72:	83 ec 18             	sub    $0x18,%esp
+  802a75:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802a78:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802a7b:	50                   	push   %eax
+  802a7c:	ff 75 08             	push   0x8(%ebp)
+  802a7f:	e8 92 fb ff ff       	call   802616 <fd_lookup>
+  802a84:	83 c4 10             	add    $0x10,%esp
+  802a87:	85 c0                	test   %eax,%eax
+  802a89:	78 49                	js     802ad4 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802a8b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802a8e:	83 ec 08             	sub    $0x8,%esp
+  802a91:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a94:	50                   	push   %eax
+  802a95:	ff 36                	push   (%esi)
+  802a97:	e8 ca fb ff ff       	call   802666 <dev_lookup>
+  802a9c:	83 c4 10             	add    $0x10,%esp
+  802a9f:	85 c0                	test   %eax,%eax
+  802aa1:	78 31                	js     802ad4 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802aa3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802aa6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802aaa:	74 2f                	je     802adb <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802aac:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802aaf:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802ab6:	00 00 00 
+	stat->st_isdir = 0;
+  802ab9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802ac0:	00 00 00 
+	stat->st_dev = dev;
+  802ac3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802ac9:	83 ec 08             	sub    $0x8,%esp
+  802acc:	53                   	push   %ebx
+  802acd:	56                   	push   %esi
+  802ace:	ff 50 14             	call   *0x14(%eax)
+  802ad1:	83 c4 10             	add    $0x10,%esp
+}
+  802ad4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ad7:	5b                   	pop    %ebx
+  802ad8:	5e                   	pop    %esi
+  802ad9:	5d                   	pop    %ebp
+  802ada:	c3                   	ret
+		return -E_NOT_SUPP;
+  802adb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802ae0:	eb f2                	jmp    802ad4 <fstat+0x67>
+
+00802ae2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802ae2:	55                   	push   %ebp
+  802ae3:	89 e5                	mov    %esp,%ebp
+  802ae5:	56                   	push   %esi
+  802ae6:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802ae7:	83 ec 08             	sub    $0x8,%esp
+  802aea:	6a 00                	push   $0x0
+  802aec:	ff 75 08             	push   0x8(%ebp)
+  802aef:	e8 bc 02 00 00       	call   802db0 <open>
+  802af4:	89 c3                	mov    %eax,%ebx
+  802af6:	83 c4 10             	add    $0x10,%esp
+  802af9:	85 c0                	test   %eax,%eax
+  802afb:	78 1b                	js     802b18 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802afd:	83 ec 08             	sub    $0x8,%esp
+  802b00:	ff 75 0c             	push   0xc(%ebp)
+  802b03:	50                   	push   %eax
+  802b04:	e8 64 ff ff ff       	call   802a6d <fstat>
+  802b09:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802b0b:	89 1c 24             	mov    %ebx,(%esp)
+  802b0e:	e8 26 fc ff ff       	call   802739 <close>
+	return r;
+  802b13:	83 c4 10             	add    $0x10,%esp
+  802b16:	89 f3                	mov    %esi,%ebx
+}
+  802b18:	89 d8                	mov    %ebx,%eax
+  802b1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b1d:	5b                   	pop    %ebx
+  802b1e:	5e                   	pop    %esi
+  802b1f:	5d                   	pop    %ebp
+  802b20:	c3                   	ret
+
+00802b21 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  802b21:	55                   	push   %ebp
+  802b22:	89 e5                	mov    %esp,%ebp
+  802b24:	57                   	push   %edi
+  802b25:	56                   	push   %esi
+  802b26:	53                   	push   %ebx
+  802b27:	83 ec 0c             	sub    $0xc,%esp
+  802b2a:	89 c7                	mov    %eax,%edi
+  802b2c:	89 d3                	mov    %edx,%ebx
+  802b2e:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802b30:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  802b37:	74 2d                	je     802b66 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802b39:	6a 07                	push   $0x7
+  802b3b:	68 00 e0 82 00       	push   $0x82e000
+  802b40:	57                   	push   %edi
+  802b41:	ff 35 00 70 80 00    	push   0x807000
+  802b47:	e8 1b f9 ff ff       	call   802467 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  802b4c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802b53:	6a 00                	push   $0x0
+  802b55:	56                   	push   %esi
+  802b56:	53                   	push   %ebx
+  802b57:	6a 00                	push   $0x0
+  802b59:	e8 bb f7 ff ff       	call   802319 <ipc_recv_pages>
+}
+  802b5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b61:	5b                   	pop    %ebx
+  802b62:	5e                   	pop    %esi
+  802b63:	5f                   	pop    %edi
+  802b64:	5d                   	pop    %ebp
+  802b65:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b66:	83 ec 0c             	sub    $0xc,%esp
+  802b69:	6a 01                	push   $0x1
+  802b6b:	e8 ec f9 ff ff       	call   80255c <ipc_find_env>
+  802b70:	a3 00 70 80 00       	mov    %eax,0x807000
+  802b75:	83 c4 10             	add    $0x10,%esp
+  802b78:	eb bf                	jmp    802b39 <fsipc_pages+0x18>
+
+00802b7a <fsipc>:
+{
+  802b7a:	55                   	push   %ebp
+  802b7b:	89 e5                	mov    %esp,%ebp
+  802b7d:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  802b80:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802b85:	e8 97 ff ff ff       	call   802b21 <fsipc_pages>
+}
+  802b8a:	c9                   	leave
+  802b8b:	c3                   	ret
+
+00802b8c <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802b8c:	55                   	push   %ebp
+  802b8d:	89 e5                	mov    %esp,%ebp
+  802b8f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802b92:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b95:	8b 40 0c             	mov    0xc(%eax),%eax
+  802b98:	a3 00 e0 82 00       	mov    %eax,0x82e000
+	fsipcbuf.set_size.req_size = newsize;
+  802b9d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ba0:	a3 04 e0 82 00       	mov    %eax,0x82e004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802ba5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802baa:	b8 02 00 00 00       	mov    $0x2,%eax
+  802baf:	e8 c6 ff ff ff       	call   802b7a <fsipc>
+}
+  802bb4:	c9                   	leave
+  802bb5:	c3                   	ret
+
+00802bb6 <devfile_flush>:
+{
+  802bb6:	55                   	push   %ebp
+  802bb7:	89 e5                	mov    %esp,%ebp
+  802bb9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802bbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bbf:	8b 40 0c             	mov    0xc(%eax),%eax
+  802bc2:	a3 00 e0 82 00       	mov    %eax,0x82e000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802bc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bcc:	b8 06 00 00 00       	mov    $0x6,%eax
+  802bd1:	e8 a4 ff ff ff       	call   802b7a <fsipc>
+}
+  802bd6:	c9                   	leave
+  802bd7:	c3                   	ret
+
+00802bd8 <devfile_stat>:
+{
+  802bd8:	55                   	push   %ebp
+  802bd9:	89 e5                	mov    %esp,%ebp
+  802bdb:	53                   	push   %ebx
+  802bdc:	83 ec 04             	sub    $0x4,%esp
+  802bdf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802be2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be5:	8b 40 0c             	mov    0xc(%eax),%eax
+  802be8:	a3 00 e0 82 00       	mov    %eax,0x82e000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802bed:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bf2:	b8 05 00 00 00       	mov    $0x5,%eax
+  802bf7:	e8 7e ff ff ff       	call   802b7a <fsipc>
+  802bfc:	85 c0                	test   %eax,%eax
+  802bfe:	78 2c                	js     802c2c <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802c00:	83 ec 08             	sub    $0x8,%esp
+  802c03:	68 00 e0 82 00       	push   $0x82e000
+  802c08:	53                   	push   %ebx
+  802c09:	e8 7d ec ff ff       	call   80188b <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802c0e:	a1 80 e0 82 00       	mov    0x82e080,%eax
+  802c13:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802c19:	a1 84 e0 82 00       	mov    0x82e084,%eax
+  802c1e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802c24:	83 c4 10             	add    $0x10,%esp
+  802c27:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c2f:	c9                   	leave
+  802c30:	c3                   	ret
+
+00802c31 <devfile_write>:
+{
+  802c31:	55                   	push   %ebp
+  802c32:	89 e5                	mov    %esp,%ebp
+  802c34:	83 ec 0c             	sub    $0xc,%esp
+  802c37:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802c3a:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802c3f:	39 d0                	cmp    %edx,%eax
+  802c41:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802c44:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c47:	8b 52 0c             	mov    0xc(%edx),%edx
+  802c4a:	89 15 00 e0 82 00    	mov    %edx,0x82e000
+	fsipcbuf.write.req_n = n;
+  802c50:	a3 04 e0 82 00       	mov    %eax,0x82e004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  802c55:	50                   	push   %eax
+  802c56:	ff 75 0c             	push   0xc(%ebp)
+  802c59:	68 08 e0 82 00       	push   $0x82e008
+  802c5e:	e8 ae ed ff ff       	call   801a11 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  802c63:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c68:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c6d:	e8 08 ff ff ff       	call   802b7a <fsipc>
+}
+  802c72:	c9                   	leave
+  802c73:	c3                   	ret
+
+00802c74 <devfile_read>:
+{
+  802c74:	55                   	push   %ebp
+  802c75:	89 e5                	mov    %esp,%ebp
+  802c77:	57                   	push   %edi
+  802c78:	56                   	push   %esi
+  802c79:	53                   	push   %ebx
+  802c7a:	83 ec 1c             	sub    $0x1c,%esp
+  802c7d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802c80:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802c83:	89 fe                	mov    %edi,%esi
+  802c85:	c1 ee 0c             	shr    $0xc,%esi
+  802c88:	b8 20 00 00 00       	mov    $0x20,%eax
+  802c8d:	39 c6                	cmp    %eax,%esi
+  802c8f:	0f 47 f0             	cmova  %eax,%esi
+  802c92:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c95:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c9a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802c9d:	eb 14                	jmp    802cb3 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802c9f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  802ca6:	05 00 10 00 00       	add    $0x1000,%eax
+  802cab:	f6 c6 06             	test   $0x6,%dh
+  802cae:	75 42                	jne    802cf2 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802cb0:	83 c1 01             	add    $0x1,%ecx
+  802cb3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802cb6:	39 f1                	cmp    %esi,%ecx
+  802cb8:	0f 84 95 00 00 00    	je     802d53 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  802cbe:	89 c2                	mov    %eax,%edx
+  802cc0:	c1 ea 16             	shr    $0x16,%edx
+  802cc3:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802cca:	f6 c2 01             	test   $0x1,%dl
+  802ccd:	74 23                	je     802cf2 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  802ccf:	89 c2                	mov    %eax,%edx
+  802cd1:	c1 ea 0c             	shr    $0xc,%edx
+  802cd4:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  802cdb:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  802ce1:	74 0f                	je     802cf2 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  802ce3:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  802cea:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  802cf0:	75 ad                	jne    802c9f <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  802cf2:	85 c9                	test   %ecx,%ecx
+  802cf4:	74 11                	je     802d07 <devfile_read+0x93>
+  802cf6:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802cfd:	75 08                	jne    802d07 <devfile_read+0x93>
+  802cff:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  802d05:	74 50                	je     802d57 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d07:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802d0a:	a3 00 e0 82 00       	mov    %eax,0x82e000
+	fsipcbuf.read.req_n = n;
+  802d0f:	89 3d 04 e0 82 00    	mov    %edi,0x82e004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802d15:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d1a:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d1f:	e8 56 fe ff ff       	call   802b7a <fsipc>
+  802d24:	89 c6                	mov    %eax,%esi
+  802d26:	85 c0                	test   %eax,%eax
+  802d28:	78 1f                	js     802d49 <devfile_read+0xd5>
+	assert(r <= n);
+  802d2a:	39 c7                	cmp    %eax,%edi
+  802d2c:	72 50                	jb     802d7e <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  802d2e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802d33:	7f 62                	jg     802d97 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  802d35:	83 ec 04             	sub    $0x4,%esp
+  802d38:	50                   	push   %eax
+  802d39:	68 00 e0 82 00       	push   $0x82e000
+  802d3e:	ff 75 0c             	push   0xc(%ebp)
+  802d41:	e8 cb ec ff ff       	call   801a11 <memmove>
+	return r;
+  802d46:	83 c4 10             	add    $0x10,%esp
+}
+  802d49:	89 f0                	mov    %esi,%eax
+  802d4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d4e:	5b                   	pop    %ebx
+  802d4f:	5e                   	pop    %esi
+  802d50:	5f                   	pop    %edi
+  802d51:	5d                   	pop    %ebp
+  802d52:	c3                   	ret
+  802d53:	89 f1                	mov    %esi,%ecx
+  802d55:	eb 9b                	jmp    802cf2 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  802d57:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802d5a:	a3 00 e0 82 00       	mov    %eax,0x82e000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  802d5f:	89 c8                	mov    %ecx,%eax
+  802d61:	c1 e0 0c             	shl    $0xc,%eax
+  802d64:	a3 04 e0 82 00       	mov    %eax,0x82e004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  802d69:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802d6c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802d71:	e8 ab fd ff ff       	call   802b21 <fsipc_pages>
+  802d76:	89 c6                	mov    %eax,%esi
+  802d78:	85 c0                	test   %eax,%eax
+  802d7a:	78 8b                	js     802d07 <devfile_read+0x93>
+  802d7c:	eb cb                	jmp    802d49 <devfile_read+0xd5>
+	assert(r <= n);
+  802d7e:	68 fc 3f 80 00       	push   $0x803ffc
+  802d83:	68 67 3b 80 00       	push   $0x803b67
+  802d88:	68 a0 00 00 00       	push   $0xa0
+  802d8d:	68 03 40 80 00       	push   $0x804003
+  802d92:	e8 32 e4 ff ff       	call   8011c9 <_panic>
+	assert(r <= PGSIZE);
+  802d97:	68 0e 40 80 00       	push   $0x80400e
+  802d9c:	68 67 3b 80 00       	push   $0x803b67
+  802da1:	68 a1 00 00 00       	push   $0xa1
+  802da6:	68 03 40 80 00       	push   $0x804003
+  802dab:	e8 19 e4 ff ff       	call   8011c9 <_panic>
+
+00802db0 <open>:
+{
+  802db0:	55                   	push   %ebp
+  802db1:	89 e5                	mov    %esp,%ebp
+  802db3:	56                   	push   %esi
+  802db4:	53                   	push   %ebx
+  802db5:	83 ec 1c             	sub    $0x1c,%esp
+  802db8:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802dbb:	56                   	push   %esi
+  802dbc:	e8 8f ea ff ff       	call   801850 <strlen>
+  802dc1:	83 c4 10             	add    $0x10,%esp
+  802dc4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802dc9:	7f 6c                	jg     802e37 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802dcb:	83 ec 0c             	sub    $0xc,%esp
+  802dce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dd1:	50                   	push   %eax
+  802dd2:	e8 eb f7 ff ff       	call   8025c2 <fd_alloc>
+  802dd7:	89 c3                	mov    %eax,%ebx
+  802dd9:	83 c4 10             	add    $0x10,%esp
+  802ddc:	85 c0                	test   %eax,%eax
+  802dde:	78 3c                	js     802e1c <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802de0:	83 ec 08             	sub    $0x8,%esp
+  802de3:	56                   	push   %esi
+  802de4:	68 00 e0 82 00       	push   $0x82e000
+  802de9:	e8 9d ea ff ff       	call   80188b <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802dee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802df1:	a3 00 e4 82 00       	mov    %eax,0x82e400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802df6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802df9:	b8 01 00 00 00       	mov    $0x1,%eax
+  802dfe:	e8 77 fd ff ff       	call   802b7a <fsipc>
+  802e03:	89 c3                	mov    %eax,%ebx
+  802e05:	83 c4 10             	add    $0x10,%esp
+  802e08:	85 c0                	test   %eax,%eax
+  802e0a:	78 19                	js     802e25 <open+0x75>
+	return fd2num(fd);
+  802e0c:	83 ec 0c             	sub    $0xc,%esp
+  802e0f:	ff 75 f4             	push   -0xc(%ebp)
+  802e12:	e8 84 f7 ff ff       	call   80259b <fd2num>
+  802e17:	89 c3                	mov    %eax,%ebx
+  802e19:	83 c4 10             	add    $0x10,%esp
+}
+  802e1c:	89 d8                	mov    %ebx,%eax
+  802e1e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e21:	5b                   	pop    %ebx
+  802e22:	5e                   	pop    %esi
+  802e23:	5d                   	pop    %ebp
+  802e24:	c3                   	ret
+		fd_close(fd, 0);
+  802e25:	83 ec 08             	sub    $0x8,%esp
+  802e28:	6a 00                	push   $0x0
+  802e2a:	ff 75 f4             	push   -0xc(%ebp)
+  802e2d:	e8 80 f8 ff ff       	call   8026b2 <fd_close>
+		return r;
+  802e32:	83 c4 10             	add    $0x10,%esp
+  802e35:	eb e5                	jmp    802e1c <open+0x6c>
+		return -E_BAD_PATH;
+  802e37:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802e3c:	eb de                	jmp    802e1c <open+0x6c>
+
+00802e3e <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802e3e:	55                   	push   %ebp
+  802e3f:	89 e5                	mov    %esp,%ebp
+  802e41:	53                   	push   %ebx
+  802e42:	83 ec 10             	sub    $0x10,%esp
+  802e45:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802e48:	53                   	push   %ebx
+  802e49:	e8 02 ea ff ff       	call   801850 <strlen>
+  802e4e:	83 c4 10             	add    $0x10,%esp
+  802e51:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802e56:	7f 25                	jg     802e7d <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802e58:	83 ec 08             	sub    $0x8,%esp
+  802e5b:	53                   	push   %ebx
+  802e5c:	68 00 e0 82 00       	push   $0x82e000
+  802e61:	e8 25 ea ff ff       	call   80188b <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802e66:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e6b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802e70:	e8 05 fd ff ff       	call   802b7a <fsipc>
+  802e75:	83 c4 10             	add    $0x10,%esp
+}
+  802e78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e7b:	c9                   	leave
+  802e7c:	c3                   	ret
+		return -E_BAD_PATH;
+  802e7d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802e82:	eb f4                	jmp    802e78 <remove+0x3a>
+
+00802e84 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802e84:	55                   	push   %ebp
+  802e85:	89 e5                	mov    %esp,%ebp
+  802e87:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802e8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e8f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e94:	e8 e1 fc ff ff       	call   802b7a <fsipc>
+}
+  802e99:	c9                   	leave
+  802e9a:	c3                   	ret
+
+00802e9b <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  802e9b:	55                   	push   %ebp
+  802e9c:	89 e5                	mov    %esp,%ebp
+  802e9e:	53                   	push   %ebx
+  802e9f:	83 ec 04             	sub    $0x4,%esp
+  802ea2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  802ea5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eaa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802eaf:	e8 c6 fc ff ff       	call   802b7a <fsipc>
+  802eb4:	85 c0                	test   %eax,%eax
+  802eb6:	78 3c                	js     802ef4 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  802eb8:	a1 00 e0 82 00       	mov    0x82e000,%eax
+  802ebd:	89 03                	mov    %eax,(%ebx)
+  802ebf:	a1 04 e0 82 00       	mov    0x82e004,%eax
+  802ec4:	89 43 04             	mov    %eax,0x4(%ebx)
+  802ec7:	a1 08 e0 82 00       	mov    0x82e008,%eax
+  802ecc:	89 43 08             	mov    %eax,0x8(%ebx)
+  802ecf:	a1 0c e0 82 00       	mov    0x82e00c,%eax
+  802ed4:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802ed7:	a1 10 e0 82 00       	mov    0x82e010,%eax
+  802edc:	89 43 10             	mov    %eax,0x10(%ebx)
+  802edf:	a1 14 e0 82 00       	mov    0x82e014,%eax
+  802ee4:	89 43 14             	mov    %eax,0x14(%ebx)
+  802ee7:	a1 18 e0 82 00       	mov    0x82e018,%eax
+  802eec:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  802eef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ef4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ef7:	c9                   	leave
+  802ef8:	c3                   	ret
+
+00802ef9 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  802ef9:	55                   	push   %ebp
+  802efa:	89 e5                	mov    %esp,%ebp
+  802efc:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  802eff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f02:	a3 00 e0 82 00       	mov    %eax,0x82e000
+	return fsipc(FSREQ_BCSET, NULL);
+  802f07:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f0c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802f11:	e8 64 fc ff ff       	call   802b7a <fsipc>
+}
+  802f16:	c9                   	leave
+  802f17:	c3                   	ret
+
+00802f18 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f18:	55                   	push   %ebp
+  802f19:	89 e5                	mov    %esp,%ebp
+  802f1b:	56                   	push   %esi
+  802f1c:	53                   	push   %ebx
+  802f1d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f20:	83 ec 0c             	sub    $0xc,%esp
+  802f23:	ff 75 08             	push   0x8(%ebp)
+  802f26:	e8 80 f6 ff ff       	call   8025ab <fd2data>
+  802f2b:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802f2d:	83 c4 08             	add    $0x8,%esp
+  802f30:	68 1a 40 80 00       	push   $0x80401a
+  802f35:	53                   	push   %ebx
+  802f36:	e8 50 e9 ff ff       	call   80188b <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802f3b:	8b 46 04             	mov    0x4(%esi),%eax
+  802f3e:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  802f44:	2b 0e                	sub    (%esi),%ecx
+  802f46:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802f4b:	89 c8                	mov    %ecx,%eax
+  802f4d:	f7 e2                	mul    %edx
+  802f4f:	c1 ea 0c             	shr    $0xc,%edx
+  802f52:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f58:	29 d1                	sub    %edx,%ecx
+  802f5a:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  802f60:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802f67:	00 00 00 
+	stat->st_dev = &devpipe;
+  802f6a:	c7 83 88 00 00 00 4c 	movl   $0x80504c,0x88(%ebx)
+  802f71:	50 80 00 
+	return 0;
+}
+  802f74:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f7c:	5b                   	pop    %ebx
+  802f7d:	5e                   	pop    %esi
+  802f7e:	5d                   	pop    %ebp
+  802f7f:	c3                   	ret
+
+00802f80 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802f80:	55                   	push   %ebp
+  802f81:	89 e5                	mov    %esp,%ebp
+  802f83:	53                   	push   %ebx
+  802f84:	83 ec 0c             	sub    $0xc,%esp
+  802f87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802f8a:	53                   	push   %ebx
+  802f8b:	6a 00                	push   $0x0
+  802f8d:	e8 71 ee ff ff       	call   801e03 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802f92:	89 1c 24             	mov    %ebx,(%esp)
+  802f95:	e8 11 f6 ff ff       	call   8025ab <fd2data>
+  802f9a:	83 c4 08             	add    $0x8,%esp
+  802f9d:	50                   	push   %eax
+  802f9e:	6a 00                	push   $0x0
+  802fa0:	e8 5e ee ff ff       	call   801e03 <sys_page_unmap>
+}
+  802fa5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fa8:	c9                   	leave
+  802fa9:	c3                   	ret
+
+00802faa <_pipeisclosed>:
+{
+  802faa:	55                   	push   %ebp
+  802fab:	89 e5                	mov    %esp,%ebp
+  802fad:	57                   	push   %edi
+  802fae:	56                   	push   %esi
+  802faf:	53                   	push   %ebx
+  802fb0:	83 ec 1c             	sub    $0x1c,%esp
+  802fb3:	89 c7                	mov    %eax,%edi
+  802fb5:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802fb7:	a1 b0 d3 82 00       	mov    0x82d3b0,%eax
+  802fbc:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802fbf:	83 ec 0c             	sub    $0xc,%esp
+  802fc2:	57                   	push   %edi
+  802fc3:	e8 b3 05 00 00       	call   80357b <pageref>
+  802fc8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802fcb:	89 34 24             	mov    %esi,(%esp)
+  802fce:	e8 a8 05 00 00       	call   80357b <pageref>
+		nn = thisenv->env_runs;
+  802fd3:	8b 15 b0 d3 82 00    	mov    0x82d3b0,%edx
+  802fd9:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802fdc:	83 c4 10             	add    $0x10,%esp
+  802fdf:	39 cb                	cmp    %ecx,%ebx
+  802fe1:	74 1b                	je     802ffe <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802fe3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802fe6:	75 cf                	jne    802fb7 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802fe8:	8b 42 58             	mov    0x58(%edx),%eax
+  802feb:	6a 01                	push   $0x1
+  802fed:	50                   	push   %eax
+  802fee:	53                   	push   %ebx
+  802fef:	68 21 40 80 00       	push   $0x804021
+  802ff4:	e8 ab e2 ff ff       	call   8012a4 <cprintf>
+  802ff9:	83 c4 10             	add    $0x10,%esp
+  802ffc:	eb b9                	jmp    802fb7 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802ffe:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803001:	0f 94 c0             	sete   %al
+  803004:	0f b6 c0             	movzbl %al,%eax
+}
+  803007:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80300a:	5b                   	pop    %ebx
+  80300b:	5e                   	pop    %esi
+  80300c:	5f                   	pop    %edi
+  80300d:	5d                   	pop    %ebp
+  80300e:	c3                   	ret
+
+0080300f <devpipe_read>:
+{
+  80300f:	55                   	push   %ebp
+  803010:	89 e5                	mov    %esp,%ebp
+  803012:	57                   	push   %edi
+  803013:	56                   	push   %esi
+  803014:	53                   	push   %ebx
+  803015:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803018:	ff 75 08             	push   0x8(%ebp)
+  80301b:	e8 8b f5 ff ff       	call   8025ab <fd2data>
+  803020:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  803022:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  803025:	8d 40 04             	lea    0x4(%eax),%eax
+  803028:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80302b:	8b 7b 04             	mov    0x4(%ebx),%edi
+  80302e:	8b 0b                	mov    (%ebx),%ecx
+  803030:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  803036:	29 ce                	sub    %ecx,%esi
+  803038:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80303d:	f7 e6                	mul    %esi
+  80303f:	c1 ea 0c             	shr    $0xc,%edx
+  803042:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  803048:	29 c6                	sub    %eax,%esi
+  80304a:	89 f2                	mov    %esi,%edx
+  80304c:	75 43                	jne    803091 <devpipe_read+0x82>
+		ref = pageref(p);
+  80304e:	83 ec 0c             	sub    $0xc,%esp
+  803051:	53                   	push   %ebx
+  803052:	e8 24 05 00 00       	call   80357b <pageref>
+  803057:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  803059:	89 da                	mov    %ebx,%edx
+  80305b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80305e:	e8 47 ff ff ff       	call   802faa <_pipeisclosed>
+  803063:	83 c4 10             	add    $0x10,%esp
+  803066:	85 c0                	test   %eax,%eax
+  803068:	0f 85 c1 00 00 00    	jne    80312f <devpipe_read+0x120>
+	*sleeping = 1;
+  80306e:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  803075:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80307a:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  80307d:	75 ac                	jne    80302b <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  80307f:	83 ec 04             	sub    $0x4,%esp
+  803082:	56                   	push   %esi
+  803083:	57                   	push   %edi
+  803084:	ff 75 e4             	push   -0x1c(%ebp)
+  803087:	e8 cb f1 ff ff       	call   802257 <sys_futex_wait>
+  80308c:	83 c4 10             	add    $0x10,%esp
+  80308f:	eb 9a                	jmp    80302b <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  803091:	39 75 10             	cmp    %esi,0x10(%ebp)
+  803094:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  803098:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80309a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80309f:	f7 e1                	mul    %ecx
+  8030a1:	c1 ea 0b             	shr    $0xb,%edx
+  8030a4:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8030aa:	29 c1                	sub    %eax,%ecx
+  8030ac:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  8030ae:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8030b3:	29 cf                	sub    %ecx,%edi
+  8030b5:	39 f7                	cmp    %esi,%edi
+  8030b7:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  8030ba:	8d 43 10             	lea    0x10(%ebx),%eax
+  8030bd:	83 ec 04             	sub    $0x4,%esp
+  8030c0:	57                   	push   %edi
+  8030c1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8030c4:	01 c2                	add    %eax,%edx
+  8030c6:	52                   	push   %edx
+  8030c7:	ff 75 0c             	push   0xc(%ebp)
+  8030ca:	e8 42 e9 ff ff       	call   801a11 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  8030cf:	83 c4 0c             	add    $0xc,%esp
+  8030d2:	89 f1                	mov    %esi,%ecx
+  8030d4:	29 f9                	sub    %edi,%ecx
+  8030d6:	51                   	push   %ecx
+  8030d7:	ff 75 e4             	push   -0x1c(%ebp)
+  8030da:	89 f8                	mov    %edi,%eax
+  8030dc:	03 45 0c             	add    0xc(%ebp),%eax
+  8030df:	50                   	push   %eax
+  8030e0:	e8 2c e9 ff ff       	call   801a11 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  8030e5:	89 f1                	mov    %esi,%ecx
+  8030e7:	03 0b                	add    (%ebx),%ecx
+  8030e9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8030ee:	f7 e1                	mul    %ecx
+  8030f0:	c1 ea 0c             	shr    $0xc,%edx
+  8030f3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8030f9:	29 d1                	sub    %edx,%ecx
+  8030fb:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  8030fd:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  803102:	83 c4 10             	add    $0x10,%esp
+  803105:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  803109:	75 0a                	jne    803115 <devpipe_read+0x106>
+	return n;
+  80310b:	89 f0                	mov    %esi,%eax
+}
+  80310d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803110:	5b                   	pop    %ebx
+  803111:	5e                   	pop    %esi
+  803112:	5f                   	pop    %edi
+  803113:	5d                   	pop    %ebp
+  803114:	c3                   	ret
+		*sleeping = 0;
+  803115:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  80311c:	83 ec 08             	sub    $0x8,%esp
+  80311f:	68 00 04 00 00       	push   $0x400
+  803124:	53                   	push   %ebx
+  803125:	e8 7d f1 ff ff       	call   8022a7 <sys_futex_wake>
+  80312a:	83 c4 10             	add    $0x10,%esp
+  80312d:	eb dc                	jmp    80310b <devpipe_read+0xfc>
+			return 0;
+  80312f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803134:	eb d7                	jmp    80310d <devpipe_read+0xfe>
+
+00803136 <devpipe_write>:
+{
+  803136:	55                   	push   %ebp
+  803137:	89 e5                	mov    %esp,%ebp
+  803139:	57                   	push   %edi
+  80313a:	56                   	push   %esi
+  80313b:	53                   	push   %ebx
+  80313c:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80313f:	ff 75 08             	push   0x8(%ebp)
+  803142:	e8 64 f4 ff ff       	call   8025ab <fd2data>
+  803147:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  803149:	83 c4 10             	add    $0x10,%esp
+  80314c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803153:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803156:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803159:	0f 83 23 01 00 00    	jae    803282 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80315f:	8b 77 04             	mov    0x4(%edi),%esi
+  803162:	8b 1f                	mov    (%edi),%ebx
+  803164:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  80316a:	29 d9                	sub    %ebx,%ecx
+  80316c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803171:	f7 e1                	mul    %ecx
+  803173:	c1 ea 0c             	shr    $0xc,%edx
+  803176:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80317c:	29 c1                	sub    %eax,%ecx
+  80317e:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803180:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803186:	75 40                	jne    8031c8 <devpipe_write+0x92>
+			ref = pageref(p);
+  803188:	83 ec 0c             	sub    $0xc,%esp
+  80318b:	57                   	push   %edi
+  80318c:	e8 ea 03 00 00       	call   80357b <pageref>
+  803191:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  803193:	89 fa                	mov    %edi,%edx
+  803195:	8b 45 08             	mov    0x8(%ebp),%eax
+  803198:	e8 0d fe ff ff       	call   802faa <_pipeisclosed>
+  80319d:	83 c4 10             	add    $0x10,%esp
+  8031a0:	85 c0                	test   %eax,%eax
+  8031a2:	0f 85 d5 00 00 00    	jne    80327d <devpipe_write+0x147>
+	*sleeping = 1;
+  8031a8:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  8031af:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8031b4:	39 1f                	cmp    %ebx,(%edi)
+  8031b6:	75 a7                	jne    80315f <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  8031b8:	83 ec 04             	sub    $0x4,%esp
+  8031bb:	56                   	push   %esi
+  8031bc:	53                   	push   %ebx
+  8031bd:	57                   	push   %edi
+  8031be:	e8 94 f0 ff ff       	call   802257 <sys_futex_wait>
+  8031c3:	83 c4 10             	add    $0x10,%esp
+  8031c6:	eb 97                	jmp    80315f <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8031c8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8031cb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8031ce:	29 c1                	sub    %eax,%ecx
+  8031d0:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8031d5:	89 d8                	mov    %ebx,%eax
+  8031d7:	29 d0                	sub    %edx,%eax
+  8031d9:	39 c1                	cmp    %eax,%ecx
+  8031db:	0f 46 c1             	cmovbe %ecx,%eax
+  8031de:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  8031e0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8031e5:	f7 e6                	mul    %esi
+  8031e7:	c1 ea 0b             	shr    $0xb,%edx
+  8031ea:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8031f0:	29 c6                	sub    %eax,%esi
+  8031f2:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8031f4:	29 f3                	sub    %esi,%ebx
+  8031f6:	39 cb                	cmp    %ecx,%ebx
+  8031f8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8031fb:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  8031fe:	8d 77 10             	lea    0x10(%edi),%esi
+  803201:	83 ec 04             	sub    $0x4,%esp
+  803204:	53                   	push   %ebx
+  803205:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803208:	03 45 0c             	add    0xc(%ebp),%eax
+  80320b:	50                   	push   %eax
+  80320c:	01 f2                	add    %esi,%edx
+  80320e:	52                   	push   %edx
+  80320f:	e8 fd e7 ff ff       	call   801a11 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803214:	83 c4 0c             	add    $0xc,%esp
+  803217:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80321a:	29 d8                	sub    %ebx,%eax
+  80321c:	50                   	push   %eax
+  80321d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803220:	01 d3                	add    %edx,%ebx
+  803222:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803225:	53                   	push   %ebx
+  803226:	56                   	push   %esi
+  803227:	e8 e5 e7 ff ff       	call   801a11 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  80322c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80322f:	03 4f 04             	add    0x4(%edi),%ecx
+  803232:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803237:	f7 e1                	mul    %ecx
+  803239:	c1 ea 0c             	shr    $0xc,%edx
+  80323c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803242:	29 d1                	sub    %edx,%ecx
+  803244:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  803247:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80324c:	83 c4 10             	add    $0x10,%esp
+  80324f:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  803253:	75 0b                	jne    803260 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  803255:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  803258:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80325b:	e9 f3 fe ff ff       	jmp    803153 <devpipe_write+0x1d>
+		*sleeping = 0;
+  803260:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  803267:	83 ec 08             	sub    $0x8,%esp
+  80326a:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  80326f:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  803272:	50                   	push   %eax
+  803273:	e8 2f f0 ff ff       	call   8022a7 <sys_futex_wake>
+  803278:	83 c4 10             	add    $0x10,%esp
+  80327b:	eb d8                	jmp    803255 <devpipe_write+0x11f>
+				return 0;
+  80327d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803282:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803285:	5b                   	pop    %ebx
+  803286:	5e                   	pop    %esi
+  803287:	5f                   	pop    %edi
+  803288:	5d                   	pop    %ebp
+  803289:	c3                   	ret
+
+0080328a <pipe>:
+{
+  80328a:	55                   	push   %ebp
+  80328b:	89 e5                	mov    %esp,%ebp
+  80328d:	56                   	push   %esi
+  80328e:	53                   	push   %ebx
+  80328f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803292:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803295:	50                   	push   %eax
+  803296:	e8 27 f3 ff ff       	call   8025c2 <fd_alloc>
+  80329b:	89 c3                	mov    %eax,%ebx
+  80329d:	83 c4 10             	add    $0x10,%esp
+  8032a0:	85 c0                	test   %eax,%eax
+  8032a2:	0f 88 23 01 00 00    	js     8033cb <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032a8:	83 ec 04             	sub    $0x4,%esp
+  8032ab:	68 07 04 00 00       	push   $0x407
+  8032b0:	ff 75 f4             	push   -0xc(%ebp)
+  8032b3:	6a 00                	push   $0x0
+  8032b5:	e8 c4 ea ff ff       	call   801d7e <sys_page_alloc>
+  8032ba:	89 c3                	mov    %eax,%ebx
+  8032bc:	83 c4 10             	add    $0x10,%esp
+  8032bf:	85 c0                	test   %eax,%eax
+  8032c1:	0f 88 04 01 00 00    	js     8033cb <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8032c7:	83 ec 0c             	sub    $0xc,%esp
+  8032ca:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8032cd:	50                   	push   %eax
+  8032ce:	e8 ef f2 ff ff       	call   8025c2 <fd_alloc>
+  8032d3:	89 c3                	mov    %eax,%ebx
+  8032d5:	83 c4 10             	add    $0x10,%esp
+  8032d8:	85 c0                	test   %eax,%eax
+  8032da:	0f 88 db 00 00 00    	js     8033bb <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032e0:	83 ec 04             	sub    $0x4,%esp
+  8032e3:	68 07 04 00 00       	push   $0x407
+  8032e8:	ff 75 f0             	push   -0x10(%ebp)
+  8032eb:	6a 00                	push   $0x0
+  8032ed:	e8 8c ea ff ff       	call   801d7e <sys_page_alloc>
+  8032f2:	89 c3                	mov    %eax,%ebx
+  8032f4:	83 c4 10             	add    $0x10,%esp
+  8032f7:	85 c0                	test   %eax,%eax
+  8032f9:	0f 88 bc 00 00 00    	js     8033bb <pipe+0x131>
+	va = fd2data(fd0);
+  8032ff:	83 ec 0c             	sub    $0xc,%esp
+  803302:	ff 75 f4             	push   -0xc(%ebp)
+  803305:	e8 a1 f2 ff ff       	call   8025ab <fd2data>
+  80330a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80330c:	83 c4 0c             	add    $0xc,%esp
+  80330f:	68 07 04 00 00       	push   $0x407
+  803314:	50                   	push   %eax
+  803315:	6a 00                	push   $0x0
+  803317:	e8 62 ea ff ff       	call   801d7e <sys_page_alloc>
+  80331c:	89 c3                	mov    %eax,%ebx
+  80331e:	83 c4 10             	add    $0x10,%esp
+  803321:	85 c0                	test   %eax,%eax
+  803323:	0f 88 82 00 00 00    	js     8033ab <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803329:	83 ec 0c             	sub    $0xc,%esp
+  80332c:	ff 75 f0             	push   -0x10(%ebp)
+  80332f:	e8 77 f2 ff ff       	call   8025ab <fd2data>
+  803334:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80333b:	50                   	push   %eax
+  80333c:	6a 00                	push   $0x0
+  80333e:	56                   	push   %esi
+  80333f:	6a 00                	push   $0x0
+  803341:	e8 7b ea ff ff       	call   801dc1 <sys_page_map>
+  803346:	89 c3                	mov    %eax,%ebx
+  803348:	83 c4 20             	add    $0x20,%esp
+  80334b:	85 c0                	test   %eax,%eax
+  80334d:	78 4e                	js     80339d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80334f:	a1 4c 50 80 00       	mov    0x80504c,%eax
+  803354:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803357:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803359:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80335c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803363:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803366:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803368:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80336b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803372:	83 ec 0c             	sub    $0xc,%esp
+  803375:	ff 75 f4             	push   -0xc(%ebp)
+  803378:	e8 1e f2 ff ff       	call   80259b <fd2num>
+  80337d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803380:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803382:	83 c4 04             	add    $0x4,%esp
+  803385:	ff 75 f0             	push   -0x10(%ebp)
+  803388:	e8 0e f2 ff ff       	call   80259b <fd2num>
+  80338d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803390:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803393:	83 c4 10             	add    $0x10,%esp
+  803396:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80339b:	eb 2e                	jmp    8033cb <pipe+0x141>
+	sys_page_unmap(0, va);
+  80339d:	83 ec 08             	sub    $0x8,%esp
+  8033a0:	56                   	push   %esi
+  8033a1:	6a 00                	push   $0x0
+  8033a3:	e8 5b ea ff ff       	call   801e03 <sys_page_unmap>
+  8033a8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8033ab:	83 ec 08             	sub    $0x8,%esp
+  8033ae:	ff 75 f0             	push   -0x10(%ebp)
+  8033b1:	6a 00                	push   $0x0
+  8033b3:	e8 4b ea ff ff       	call   801e03 <sys_page_unmap>
+  8033b8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8033bb:	83 ec 08             	sub    $0x8,%esp
+  8033be:	ff 75 f4             	push   -0xc(%ebp)
+  8033c1:	6a 00                	push   $0x0
+  8033c3:	e8 3b ea ff ff       	call   801e03 <sys_page_unmap>
+  8033c8:	83 c4 10             	add    $0x10,%esp
+}
+  8033cb:	89 d8                	mov    %ebx,%eax
+  8033cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033d0:	5b                   	pop    %ebx
+  8033d1:	5e                   	pop    %esi
+  8033d2:	5d                   	pop    %ebp
+  8033d3:	c3                   	ret
+
+008033d4 <pipeisclosed>:
+{
+  8033d4:	55                   	push   %ebp
+  8033d5:	89 e5                	mov    %esp,%ebp
+  8033d7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033dd:	50                   	push   %eax
+  8033de:	ff 75 08             	push   0x8(%ebp)
+  8033e1:	e8 30 f2 ff ff       	call   802616 <fd_lookup>
+  8033e6:	83 c4 10             	add    $0x10,%esp
+  8033e9:	85 c0                	test   %eax,%eax
+  8033eb:	78 18                	js     803405 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8033ed:	83 ec 0c             	sub    $0xc,%esp
+  8033f0:	ff 75 f4             	push   -0xc(%ebp)
+  8033f3:	e8 b3 f1 ff ff       	call   8025ab <fd2data>
+  8033f8:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8033fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033fd:	e8 a8 fb ff ff       	call   802faa <_pipeisclosed>
+  803402:	83 c4 10             	add    $0x10,%esp
+}
+  803405:	c9                   	leave
+  803406:	c3                   	ret
+
+00803407 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80340c:	c3                   	ret
+
+0080340d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80340d:	55                   	push   %ebp
+  80340e:	89 e5                	mov    %esp,%ebp
+  803410:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803413:	68 39 40 80 00       	push   $0x804039
+  803418:	ff 75 0c             	push   0xc(%ebp)
+  80341b:	e8 6b e4 ff ff       	call   80188b <strcpy>
+	return 0;
+}
+  803420:	b8 00 00 00 00       	mov    $0x0,%eax
+  803425:	c9                   	leave
+  803426:	c3                   	ret
+
+00803427 <devcons_write>:
+{
+  803427:	55                   	push   %ebp
+  803428:	89 e5                	mov    %esp,%ebp
+  80342a:	57                   	push   %edi
+  80342b:	56                   	push   %esi
+  80342c:	53                   	push   %ebx
+  80342d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803433:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803438:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80343e:	eb 2e                	jmp    80346e <devcons_write+0x47>
+		m = n - tot;
+  803440:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803443:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803445:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80344a:	39 c3                	cmp    %eax,%ebx
+  80344c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80344f:	83 ec 04             	sub    $0x4,%esp
+  803452:	53                   	push   %ebx
+  803453:	89 f0                	mov    %esi,%eax
+  803455:	03 45 0c             	add    0xc(%ebp),%eax
+  803458:	50                   	push   %eax
+  803459:	57                   	push   %edi
+  80345a:	e8 b2 e5 ff ff       	call   801a11 <memmove>
+		sys_cputs(buf, m);
+  80345f:	83 c4 08             	add    $0x8,%esp
+  803462:	53                   	push   %ebx
+  803463:	57                   	push   %edi
+  803464:	e8 48 e8 ff ff       	call   801cb1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803469:	01 de                	add    %ebx,%esi
+  80346b:	83 c4 10             	add    $0x10,%esp
+  80346e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803471:	72 cd                	jb     803440 <devcons_write+0x19>
+}
+  803473:	89 f0                	mov    %esi,%eax
+  803475:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803478:	5b                   	pop    %ebx
+  803479:	5e                   	pop    %esi
+  80347a:	5f                   	pop    %edi
+  80347b:	5d                   	pop    %ebp
+  80347c:	c3                   	ret
+
+0080347d <devcons_read>:
+{
+  80347d:	55                   	push   %ebp
+  80347e:	89 e5                	mov    %esp,%ebp
+  803480:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803483:	b8 00 00 00 00       	mov    $0x0,%eax
+  803488:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80348c:	75 07                	jne    803495 <devcons_read+0x18>
+  80348e:	eb 1f                	jmp    8034af <devcons_read+0x32>
+		sys_yield();
+  803490:	e8 ca e8 ff ff       	call   801d5f <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803495:	e8 46 e8 ff ff       	call   801ce0 <sys_cgetc>
+  80349a:	85 c0                	test   %eax,%eax
+  80349c:	74 f2                	je     803490 <devcons_read+0x13>
+	if (c < 0)
+  80349e:	78 0f                	js     8034af <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8034a0:	83 f8 04             	cmp    $0x4,%eax
+  8034a3:	74 0c                	je     8034b1 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8034a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034a8:	88 02                	mov    %al,(%edx)
+	return 1;
+  8034aa:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8034af:	c9                   	leave
+  8034b0:	c3                   	ret
+		return 0;
+  8034b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b6:	eb f7                	jmp    8034af <devcons_read+0x32>
+
+008034b8 <cputchar>:
+{
+  8034b8:	55                   	push   %ebp
+  8034b9:	89 e5                	mov    %esp,%ebp
+  8034bb:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8034be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034c1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8034c4:	6a 01                	push   $0x1
+  8034c6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8034c9:	50                   	push   %eax
+  8034ca:	e8 e2 e7 ff ff       	call   801cb1 <sys_cputs>
+}
+  8034cf:	83 c4 10             	add    $0x10,%esp
+  8034d2:	c9                   	leave
+  8034d3:	c3                   	ret
+
+008034d4 <getchar>:
+{
+  8034d4:	55                   	push   %ebp
+  8034d5:	89 e5                	mov    %esp,%ebp
+  8034d7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8034da:	6a 01                	push   $0x1
+  8034dc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8034df:	50                   	push   %eax
+  8034e0:	6a 00                	push   $0x0
+  8034e2:	e8 8e f3 ff ff       	call   802875 <read>
+	if (r < 0)
+  8034e7:	83 c4 10             	add    $0x10,%esp
+  8034ea:	85 c0                	test   %eax,%eax
+  8034ec:	78 06                	js     8034f4 <getchar+0x20>
+	if (r < 1)
+  8034ee:	74 06                	je     8034f6 <getchar+0x22>
+	return c;
+  8034f0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8034f4:	c9                   	leave
+  8034f5:	c3                   	ret
+		return -E_EOF;
+  8034f6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8034fb:	eb f7                	jmp    8034f4 <getchar+0x20>
+
+008034fd <iscons>:
+{
+  8034fd:	55                   	push   %ebp
+  8034fe:	89 e5                	mov    %esp,%ebp
+  803500:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803503:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803506:	50                   	push   %eax
+  803507:	ff 75 08             	push   0x8(%ebp)
+  80350a:	e8 07 f1 ff ff       	call   802616 <fd_lookup>
+  80350f:	83 c4 10             	add    $0x10,%esp
+  803512:	85 c0                	test   %eax,%eax
+  803514:	78 11                	js     803527 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803516:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803519:	8b 15 68 50 80 00    	mov    0x805068,%edx
+  80351f:	39 10                	cmp    %edx,(%eax)
+  803521:	0f 94 c0             	sete   %al
+  803524:	0f b6 c0             	movzbl %al,%eax
+}
+  803527:	c9                   	leave
+  803528:	c3                   	ret
+
+00803529 <opencons>:
+{
+  803529:	55                   	push   %ebp
+  80352a:	89 e5                	mov    %esp,%ebp
+  80352c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80352f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803532:	50                   	push   %eax
+  803533:	e8 8a f0 ff ff       	call   8025c2 <fd_alloc>
+  803538:	83 c4 10             	add    $0x10,%esp
+  80353b:	85 c0                	test   %eax,%eax
+  80353d:	78 3a                	js     803579 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80353f:	83 ec 04             	sub    $0x4,%esp
+  803542:	68 07 04 00 00       	push   $0x407
+  803547:	ff 75 f4             	push   -0xc(%ebp)
+  80354a:	6a 00                	push   $0x0
+  80354c:	e8 2d e8 ff ff       	call   801d7e <sys_page_alloc>
+  803551:	83 c4 10             	add    $0x10,%esp
+  803554:	85 c0                	test   %eax,%eax
+  803556:	78 21                	js     803579 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803558:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80355b:	8b 15 68 50 80 00    	mov    0x805068,%edx
+  803561:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803563:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803566:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80356d:	83 ec 0c             	sub    $0xc,%esp
+  803570:	50                   	push   %eax
+  803571:	e8 25 f0 ff ff       	call   80259b <fd2num>
+  803576:	83 c4 10             	add    $0x10,%esp
+}
+  803579:	c9                   	leave
+  80357a:	c3                   	ret
+
+0080357b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80357b:	55                   	push   %ebp
+  80357c:	89 e5                	mov    %esp,%ebp
+  80357e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803581:	89 c2                	mov    %eax,%edx
+  803583:	c1 ea 16             	shr    $0x16,%edx
+  803586:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80358d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803592:	f6 c1 01             	test   $0x1,%cl
+  803595:	74 1e                	je     8035b5 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  803597:	c1 e8 0c             	shr    $0xc,%eax
+  80359a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8035a1:	a8 01                	test   $0x1,%al
+  8035a3:	74 10                	je     8035b5 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8035a5:	c1 e8 0c             	shr    $0xc,%eax
+  8035a8:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8035ab:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  8035b2:	0f b7 d2             	movzwl %dx,%edx
+}
+  8035b5:	89 d0                	mov    %edx,%eax
+  8035b7:	5d                   	pop    %ebp
+  8035b8:	c3                   	ret
+
+008035b9 <udivmod>:
+  8035b9:	55                   	push   %ebp
+  8035ba:	57                   	push   %edi
+  8035bb:	56                   	push   %esi
+  8035bc:	53                   	push   %ebx
+  8035bd:	83 ec 24             	sub    $0x24,%esp
+  8035c0:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8035c4:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8035c8:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035cc:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035d0:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8035d4:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8035d8:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8035dc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035eb:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035f2:	00 
+  8035f3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8035fa:	00 
+  8035fb:	89 fb                	mov    %edi,%ebx
+  8035fd:	eb 08                	jmp    803607 <udivmod+0x4e>
+  8035ff:	83 e9 01             	sub    $0x1,%ecx
+  803602:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803605:	74 68                	je     80366f <udivmod+0xb6>
+  803607:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80360b:	01 c0                	add    %eax,%eax
+  80360d:	89 c6                	mov    %eax,%esi
+  80360f:	89 d7                	mov    %edx,%edi
+  803611:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803615:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803619:	0f ad d0             	shrd   %cl,%edx,%eax
+  80361c:	d3 ea                	shr    %cl,%edx
+  80361e:	f6 c1 20             	test   $0x20,%cl
+  803621:	74 04                	je     803627 <udivmod+0x6e>
+  803623:	89 d0                	mov    %edx,%eax
+  803625:	31 d2                	xor    %edx,%edx
+  803627:	83 e0 01             	and    $0x1,%eax
+  80362a:	89 04 24             	mov    %eax,(%esp)
+  80362d:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803634:	00 
+  803635:	8b 04 24             	mov    (%esp),%eax
+  803638:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80363c:	09 f0                	or     %esi,%eax
+  80363e:	09 fa                	or     %edi,%edx
+  803640:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803644:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803648:	39 f0                	cmp    %esi,%eax
+  80364a:	89 d5                	mov    %edx,%ebp
+  80364c:	19 fd                	sbb    %edi,%ebp
+  80364e:	72 af                	jb     8035ff <udivmod+0x46>
+  803650:	29 f0                	sub    %esi,%eax
+  803652:	19 fa                	sbb    %edi,%edx
+  803654:	89 cf                	mov    %ecx,%edi
+  803656:	c1 ef 05             	shr    $0x5,%edi
+  803659:	83 e7 01             	and    $0x1,%edi
+  80365c:	89 fe                	mov    %edi,%esi
+  80365e:	83 f6 01             	xor    $0x1,%esi
+  803661:	d3 e6                	shl    %cl,%esi
+  803663:	d3 e7                	shl    %cl,%edi
+  803665:	09 74 24 18          	or     %esi,0x18(%esp)
+  803669:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80366d:	eb 90                	jmp    8035ff <udivmod+0x46>
+  80366f:	85 db                	test   %ebx,%ebx
+  803671:	74 05                	je     803678 <udivmod+0xbf>
+  803673:	89 03                	mov    %eax,(%ebx)
+  803675:	89 53 04             	mov    %edx,0x4(%ebx)
+  803678:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80367c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803680:	83 c4 24             	add    $0x24,%esp
+  803683:	5b                   	pop    %ebx
+  803684:	5e                   	pop    %esi
+  803685:	5f                   	pop    %edi
+  803686:	5d                   	pop    %ebp
+  803687:	c3                   	ret
+
+00803688 <__udivdi3>:
+  803688:	83 ec 08             	sub    $0x8,%esp
+  80368b:	6a 00                	push   $0x0
+  80368d:	ff 74 24 1c          	push   0x1c(%esp)
+  803691:	ff 74 24 1c          	push   0x1c(%esp)
+  803695:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803699:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80369d:	e8 17 ff ff ff       	call   8035b9 <udivmod>
+  8036a2:	83 c4 14             	add    $0x14,%esp
+  8036a5:	c3                   	ret
+
+008036a6 <__umoddi3>:
+  8036a6:	83 ec 18             	sub    $0x18,%esp
+  8036a9:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8036ad:	50                   	push   %eax
+  8036ae:	ff 74 24 2c          	push   0x2c(%esp)
+  8036b2:	ff 74 24 2c          	push   0x2c(%esp)
+  8036b6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036ba:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036be:	e8 f6 fe ff ff       	call   8035b9 <udivmod>
+  8036c3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036c7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036cb:	83 c4 24             	add    $0x24,%esp
+  8036ce:	c3                   	ret
+
+008036cf <__divdi3>:
+  8036cf:	55                   	push   %ebp
+  8036d0:	57                   	push   %edi
+  8036d1:	56                   	push   %esi
+  8036d2:	53                   	push   %ebx
+  8036d3:	83 ec 10             	sub    $0x10,%esp
+  8036d6:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8036da:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8036de:	89 c6                	mov    %eax,%esi
+  8036e0:	89 d7                	mov    %edx,%edi
+  8036e2:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8036e6:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8036ea:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8036ee:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8036f2:	89 c5                	mov    %eax,%ebp
+  8036f4:	f7 dd                	neg    %ebp
+  8036f6:	89 d6                	mov    %edx,%esi
+  8036f8:	83 d6 00             	adc    $0x0,%esi
+  8036fb:	f7 de                	neg    %esi
+  8036fd:	0f 48 e8             	cmovs  %eax,%ebp
+  803700:	0f 49 d6             	cmovns %esi,%edx
+  803703:	6a 00                	push   $0x0
+  803705:	8b 74 24 30          	mov    0x30(%esp),%esi
+  803709:	f7 de                	neg    %esi
+  80370b:	8b 44 24 34          	mov    0x34(%esp),%eax
+  80370f:	83 d0 00             	adc    $0x0,%eax
+  803712:	f7 d8                	neg    %eax
+  803714:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  803719:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  80371e:	50                   	push   %eax
+  80371f:	56                   	push   %esi
+  803720:	89 e8                	mov    %ebp,%eax
+  803722:	e8 92 fe ff ff       	call   8035b9 <udivmod>
+  803727:	83 c4 10             	add    $0x10,%esp
+  80372a:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  80372f:	78 08                	js     803739 <__divdi3+0x6a>
+  803731:	83 c4 0c             	add    $0xc,%esp
+  803734:	5b                   	pop    %ebx
+  803735:	5e                   	pop    %esi
+  803736:	5f                   	pop    %edi
+  803737:	5d                   	pop    %ebp
+  803738:	c3                   	ret
+  803739:	f7 d8                	neg    %eax
+  80373b:	83 d2 00             	adc    $0x0,%edx
+  80373e:	f7 da                	neg    %edx
+  803740:	eb ef                	jmp    803731 <__divdi3+0x62>
+
+00803742 <__moddi3>:
+  803742:	55                   	push   %ebp
+  803743:	57                   	push   %edi
+  803744:	56                   	push   %esi
+  803745:	53                   	push   %ebx
+  803746:	83 ec 18             	sub    $0x18,%esp
+  803749:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80374d:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  803751:	89 f1                	mov    %esi,%ecx
+  803753:	f7 d9                	neg    %ecx
+  803755:	89 da                	mov    %ebx,%edx
+  803757:	83 d2 00             	adc    $0x0,%edx
+  80375a:	f7 da                	neg    %edx
+  80375c:	0f 48 ce             	cmovs  %esi,%ecx
+  80375f:	0f 48 d3             	cmovs  %ebx,%edx
+  803762:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803766:	50                   	push   %eax
+  803767:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80376b:	f7 de                	neg    %esi
+  80376d:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  803771:	83 d0 00             	adc    $0x0,%eax
+  803774:	f7 d8                	neg    %eax
+  803776:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80377b:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  803780:	50                   	push   %eax
+  803781:	56                   	push   %esi
+  803782:	89 c8                	mov    %ecx,%eax
+  803784:	e8 30 fe ff ff       	call   8035b9 <udivmod>
+  803789:	83 c4 10             	add    $0x10,%esp
+  80378c:	85 db                	test   %ebx,%ebx
+  80378e:	78 10                	js     8037a0 <__moddi3+0x5e>
+  803790:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803794:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803798:	83 c4 14             	add    $0x14,%esp
+  80379b:	5b                   	pop    %ebx
+  80379c:	5e                   	pop    %esi
+  80379d:	5f                   	pop    %edi
+  80379e:	5d                   	pop    %ebp
+  80379f:	c3                   	ret
+  8037a0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8037a4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8037a8:	f7 d8                	neg    %eax
+  8037aa:	83 d2 00             	adc    $0x0,%edx
+  8037ad:	f7 da                	neg    %edx
+  8037af:	eb e7                	jmp    803798 <__moddi3+0x56>
@@ -0,0 +1,5557 @@
+
+obj/user/badsegment.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 09 00 00 00       	call   80003a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+	// Try to load the kernel's TSS selector into the DS register.
+	asm volatile("movw $0x28,%ax; movw %ax,%ds");
+  800033:	66 b8 28 00          	mov    $0x28,%ax
+  800037:	8e d8                	mov    %eax,%ds
+}
+  800039:	c3                   	ret
+
+0080003a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80003a:	55                   	push   %ebp
+  80003b:	89 e5                	mov    %esp,%ebp
+  80003d:	56                   	push   %esi
+  80003e:	53                   	push   %ebx
+  80003f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800042:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800045:	e8 08 01 00 00       	call   800152 <sys_getenvid>
+  80004a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800052:	c1 e0 06             	shl    $0x6,%eax
+  800055:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80005a:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80005f:	85 db                	test   %ebx,%ebx
+  800061:	7e 07                	jle    80006a <libmain+0x30>
+		binaryname = argv[0];
+  800063:	8b 06                	mov    (%esi),%eax
+  800065:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80006a:	83 ec 08             	sub    $0x8,%esp
+  80006d:	56                   	push   %esi
+  80006e:	53                   	push   %ebx
+  80006f:	e8 bf ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800074:	e8 0a 00 00 00       	call   800083 <exit>
+}
+  800079:	83 c4 10             	add    $0x10,%esp
+  80007c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007f:	5b                   	pop    %ebx
+  800080:	5e                   	pop    %esi
+  800081:	5d                   	pop    %ebp
+  800082:	c3                   	ret
+
+00800083 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800083:	55                   	push   %ebp
+  800084:	89 e5                	mov    %esp,%ebp
+  800086:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800089:	e8 68 08 00 00       	call   8008f6 <close_all>
+	sys_env_destroy(0);
+  80008e:	83 ec 0c             	sub    $0xc,%esp
+  800091:	6a 00                	push   $0x0
+  800093:	e8 79 00 00 00       	call   800111 <sys_env_destroy>
+}
+  800098:	83 c4 10             	add    $0x10,%esp
+  80009b:	c9                   	leave
+  80009c:	c3                   	ret
+
+0080009d <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	83 ec 10             	sub    $0x10,%esp
+  8000a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000a6:	89 c8                	mov    %ecx,%eax
+  8000a8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8000ad:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8000b0:	eb 0b                	jmp    8000bd <touch_mem+0x20>
+		c = *(char *)page;
+  8000b2:	0f b6 10             	movzbl (%eax),%edx
+  8000b5:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000b8:	05 00 10 00 00       	add    $0x1000,%eax
+  8000bd:	39 c8                	cmp    %ecx,%eax
+  8000bf:	72 f1                	jb     8000b2 <touch_mem+0x15>
+}
+  8000c1:	c9                   	leave
+  8000c2:	c3                   	ret
+
+008000c3 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000c3:	55                   	push   %ebp
+  8000c4:	89 e5                	mov    %esp,%ebp
+  8000c6:	57                   	push   %edi
+  8000c7:	56                   	push   %esi
+  8000c8:	53                   	push   %ebx
+	touch_mem(s, len);
+  8000c9:	ff 75 0c             	push   0xc(%ebp)
+  8000cc:	ff 75 08             	push   0x8(%ebp)
+  8000cf:	e8 c9 ff ff ff       	call   80009d <touch_mem>
+	asm volatile("int %1\n"
+  8000d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000df:	89 c3                	mov    %eax,%ebx
+  8000e1:	89 c7                	mov    %eax,%edi
+  8000e3:	89 c6                	mov    %eax,%esi
+  8000e5:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000e7:	83 c4 08             	add    $0x8,%esp
+  8000ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000ed:	5b                   	pop    %ebx
+  8000ee:	5e                   	pop    %esi
+  8000ef:	5f                   	pop    %edi
+  8000f0:	5d                   	pop    %ebp
+  8000f1:	c3                   	ret
+
+008000f2 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000f2:	55                   	push   %ebp
+  8000f3:	89 e5                	mov    %esp,%ebp
+  8000f5:	57                   	push   %edi
+  8000f6:	56                   	push   %esi
+  8000f7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000fd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800102:	89 d1                	mov    %edx,%ecx
+  800104:	89 d3                	mov    %edx,%ebx
+  800106:	89 d7                	mov    %edx,%edi
+  800108:	89 d6                	mov    %edx,%esi
+  80010a:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80010c:	5b                   	pop    %ebx
+  80010d:	5e                   	pop    %esi
+  80010e:	5f                   	pop    %edi
+  80010f:	5d                   	pop    %ebp
+  800110:	c3                   	ret
+
+00800111 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800111:	55                   	push   %ebp
+  800112:	89 e5                	mov    %esp,%ebp
+  800114:	57                   	push   %edi
+  800115:	56                   	push   %esi
+  800116:	53                   	push   %ebx
+  800117:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80011a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80011f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800122:	b8 03 00 00 00       	mov    $0x3,%eax
+  800127:	89 cb                	mov    %ecx,%ebx
+  800129:	89 cf                	mov    %ecx,%edi
+  80012b:	89 ce                	mov    %ecx,%esi
+  80012d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80012f:	85 c0                	test   %eax,%eax
+  800131:	7f 08                	jg     80013b <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800133:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800136:	5b                   	pop    %ebx
+  800137:	5e                   	pop    %esi
+  800138:	5f                   	pop    %edi
+  800139:	5d                   	pop    %ebp
+  80013a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80013b:	83 ec 0c             	sub    $0xc,%esp
+  80013e:	50                   	push   %eax
+  80013f:	6a 03                	push   $0x3
+  800141:	68 aa 26 80 00       	push   $0x8026aa
+  800146:	6a 23                	push   $0x23
+  800148:	68 c7 26 80 00       	push   $0x8026c7
+  80014d:	e8 b9 15 00 00       	call   80170b <_panic>
+
+00800152 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800152:	55                   	push   %ebp
+  800153:	89 e5                	mov    %esp,%ebp
+  800155:	57                   	push   %edi
+  800156:	56                   	push   %esi
+  800157:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800158:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800162:	89 d1                	mov    %edx,%ecx
+  800164:	89 d3                	mov    %edx,%ebx
+  800166:	89 d7                	mov    %edx,%edi
+  800168:	89 d6                	mov    %edx,%esi
+  80016a:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80016c:	5b                   	pop    %ebx
+  80016d:	5e                   	pop    %esi
+  80016e:	5f                   	pop    %edi
+  80016f:	5d                   	pop    %ebp
+  800170:	c3                   	ret
+
+00800171 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800171:	55                   	push   %ebp
+  800172:	89 e5                	mov    %esp,%ebp
+  800174:	57                   	push   %edi
+  800175:	56                   	push   %esi
+  800176:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800177:	ba 00 00 00 00       	mov    $0x0,%edx
+  80017c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800181:	89 d1                	mov    %edx,%ecx
+  800183:	89 d3                	mov    %edx,%ebx
+  800185:	89 d7                	mov    %edx,%edi
+  800187:	89 d6                	mov    %edx,%esi
+  800189:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80018b:	5b                   	pop    %ebx
+  80018c:	5e                   	pop    %esi
+  80018d:	5f                   	pop    %edi
+  80018e:	5d                   	pop    %ebp
+  80018f:	c3                   	ret
+
+00800190 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800190:	55                   	push   %ebp
+  800191:	89 e5                	mov    %esp,%ebp
+  800193:	57                   	push   %edi
+  800194:	56                   	push   %esi
+  800195:	53                   	push   %ebx
+  800196:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800199:	be 00 00 00 00       	mov    $0x0,%esi
+  80019e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001a4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001ac:	89 f7                	mov    %esi,%edi
+  8001ae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001b0:	85 c0                	test   %eax,%eax
+  8001b2:	7f 08                	jg     8001bc <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001b7:	5b                   	pop    %ebx
+  8001b8:	5e                   	pop    %esi
+  8001b9:	5f                   	pop    %edi
+  8001ba:	5d                   	pop    %ebp
+  8001bb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001bc:	83 ec 0c             	sub    $0xc,%esp
+  8001bf:	50                   	push   %eax
+  8001c0:	6a 04                	push   $0x4
+  8001c2:	68 aa 26 80 00       	push   $0x8026aa
+  8001c7:	6a 23                	push   $0x23
+  8001c9:	68 c7 26 80 00       	push   $0x8026c7
+  8001ce:	e8 38 15 00 00       	call   80170b <_panic>
+
+008001d3 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001d3:	55                   	push   %ebp
+  8001d4:	89 e5                	mov    %esp,%ebp
+  8001d6:	57                   	push   %edi
+  8001d7:	56                   	push   %esi
+  8001d8:	53                   	push   %ebx
+  8001d9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001e2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001ea:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001ed:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001f0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001f2:	85 c0                	test   %eax,%eax
+  8001f4:	7f 08                	jg     8001fe <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001f9:	5b                   	pop    %ebx
+  8001fa:	5e                   	pop    %esi
+  8001fb:	5f                   	pop    %edi
+  8001fc:	5d                   	pop    %ebp
+  8001fd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001fe:	83 ec 0c             	sub    $0xc,%esp
+  800201:	50                   	push   %eax
+  800202:	6a 05                	push   $0x5
+  800204:	68 aa 26 80 00       	push   $0x8026aa
+  800209:	6a 23                	push   $0x23
+  80020b:	68 c7 26 80 00       	push   $0x8026c7
+  800210:	e8 f6 14 00 00       	call   80170b <_panic>
+
+00800215 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800215:	55                   	push   %ebp
+  800216:	89 e5                	mov    %esp,%ebp
+  800218:	57                   	push   %edi
+  800219:	56                   	push   %esi
+  80021a:	53                   	push   %ebx
+  80021b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80021e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800223:	8b 55 08             	mov    0x8(%ebp),%edx
+  800226:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800229:	b8 06 00 00 00       	mov    $0x6,%eax
+  80022e:	89 df                	mov    %ebx,%edi
+  800230:	89 de                	mov    %ebx,%esi
+  800232:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800234:	85 c0                	test   %eax,%eax
+  800236:	7f 08                	jg     800240 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800238:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80023b:	5b                   	pop    %ebx
+  80023c:	5e                   	pop    %esi
+  80023d:	5f                   	pop    %edi
+  80023e:	5d                   	pop    %ebp
+  80023f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800240:	83 ec 0c             	sub    $0xc,%esp
+  800243:	50                   	push   %eax
+  800244:	6a 06                	push   $0x6
+  800246:	68 aa 26 80 00       	push   $0x8026aa
+  80024b:	6a 23                	push   $0x23
+  80024d:	68 c7 26 80 00       	push   $0x8026c7
+  800252:	e8 b4 14 00 00       	call   80170b <_panic>
+
+00800257 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800257:	55                   	push   %ebp
+  800258:	89 e5                	mov    %esp,%ebp
+  80025a:	57                   	push   %edi
+  80025b:	56                   	push   %esi
+  80025c:	53                   	push   %ebx
+  80025d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800260:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800265:	8b 55 08             	mov    0x8(%ebp),%edx
+  800268:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80026b:	b8 18 00 00 00       	mov    $0x18,%eax
+  800270:	89 df                	mov    %ebx,%edi
+  800272:	89 de                	mov    %ebx,%esi
+  800274:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800276:	85 c0                	test   %eax,%eax
+  800278:	7f 08                	jg     800282 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80027a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027d:	5b                   	pop    %ebx
+  80027e:	5e                   	pop    %esi
+  80027f:	5f                   	pop    %edi
+  800280:	5d                   	pop    %ebp
+  800281:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800282:	83 ec 0c             	sub    $0xc,%esp
+  800285:	50                   	push   %eax
+  800286:	6a 18                	push   $0x18
+  800288:	68 aa 26 80 00       	push   $0x8026aa
+  80028d:	6a 23                	push   $0x23
+  80028f:	68 c7 26 80 00       	push   $0x8026c7
+  800294:	e8 72 14 00 00       	call   80170b <_panic>
+
+00800299 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800299:	55                   	push   %ebp
+  80029a:	89 e5                	mov    %esp,%ebp
+  80029c:	57                   	push   %edi
+  80029d:	56                   	push   %esi
+  80029e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80029f:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002aa:	b8 19 00 00 00       	mov    $0x19,%eax
+  8002af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002b2:	89 f7                	mov    %esi,%edi
+  8002b4:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  8002b6:	5b                   	pop    %ebx
+  8002b7:	5e                   	pop    %esi
+  8002b8:	5f                   	pop    %edi
+  8002b9:	5d                   	pop    %ebp
+  8002ba:	c3                   	ret
+
+008002bb <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8002bb:	55                   	push   %ebp
+  8002bc:	89 e5                	mov    %esp,%ebp
+  8002be:	57                   	push   %edi
+  8002bf:	56                   	push   %esi
+  8002c0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8002d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002d4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002d7:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8002d9:	5b                   	pop    %ebx
+  8002da:	5e                   	pop    %esi
+  8002db:	5f                   	pop    %edi
+  8002dc:	5d                   	pop    %ebp
+  8002dd:	c3                   	ret
+
+008002de <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  8002de:	55                   	push   %ebp
+  8002df:	89 e5                	mov    %esp,%ebp
+  8002e1:	57                   	push   %edi
+  8002e2:	56                   	push   %esi
+  8002e3:	53                   	push   %ebx
+  8002e4:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  8002e7:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8002ea:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8002f0:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  8002f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f9:	b8 10 00 00 00       	mov    $0x10,%eax
+  8002fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800301:	8b 75 18             	mov    0x18(%ebp),%esi
+  800304:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800306:	85 c0                	test   %eax,%eax
+  800308:	7f 08                	jg     800312 <sys_page_map_range+0x34>
+}
+  80030a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030d:	5b                   	pop    %ebx
+  80030e:	5e                   	pop    %esi
+  80030f:	5f                   	pop    %edi
+  800310:	5d                   	pop    %ebp
+  800311:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800312:	83 ec 0c             	sub    $0xc,%esp
+  800315:	50                   	push   %eax
+  800316:	6a 10                	push   $0x10
+  800318:	68 aa 26 80 00       	push   $0x8026aa
+  80031d:	6a 23                	push   $0x23
+  80031f:	68 c7 26 80 00       	push   $0x8026c7
+  800324:	e8 e2 13 00 00       	call   80170b <_panic>
+
+00800329 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800329:	55                   	push   %ebp
+  80032a:	89 e5                	mov    %esp,%ebp
+  80032c:	57                   	push   %edi
+  80032d:	56                   	push   %esi
+  80032e:	53                   	push   %ebx
+  80032f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800332:	be 00 00 00 00       	mov    $0x0,%esi
+  800337:	8b 55 08             	mov    0x8(%ebp),%edx
+  80033a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80033d:	b8 11 00 00 00       	mov    $0x11,%eax
+  800342:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800345:	89 f7                	mov    %esi,%edi
+  800347:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800349:	85 c0                	test   %eax,%eax
+  80034b:	7f 08                	jg     800355 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  80034d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800350:	5b                   	pop    %ebx
+  800351:	5e                   	pop    %esi
+  800352:	5f                   	pop    %edi
+  800353:	5d                   	pop    %ebp
+  800354:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800355:	83 ec 0c             	sub    $0xc,%esp
+  800358:	50                   	push   %eax
+  800359:	6a 11                	push   $0x11
+  80035b:	68 aa 26 80 00       	push   $0x8026aa
+  800360:	6a 23                	push   $0x23
+  800362:	68 c7 26 80 00       	push   $0x8026c7
+  800367:	e8 9f 13 00 00       	call   80170b <_panic>
+
+0080036c <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  80036c:	55                   	push   %ebp
+  80036d:	89 e5                	mov    %esp,%ebp
+  80036f:	57                   	push   %edi
+  800370:	56                   	push   %esi
+  800371:	53                   	push   %ebx
+  800372:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800375:	be 00 00 00 00       	mov    $0x0,%esi
+  80037a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80037d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800380:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800385:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800388:	89 f7                	mov    %esi,%edi
+  80038a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80038c:	85 c0                	test   %eax,%eax
+  80038e:	7f 08                	jg     800398 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800390:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800393:	5b                   	pop    %ebx
+  800394:	5e                   	pop    %esi
+  800395:	5f                   	pop    %edi
+  800396:	5d                   	pop    %ebp
+  800397:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800398:	83 ec 0c             	sub    $0xc,%esp
+  80039b:	50                   	push   %eax
+  80039c:	6a 1b                	push   $0x1b
+  80039e:	68 aa 26 80 00       	push   $0x8026aa
+  8003a3:	6a 23                	push   $0x23
+  8003a5:	68 c7 26 80 00       	push   $0x8026c7
+  8003aa:	e8 5c 13 00 00       	call   80170b <_panic>
+
+008003af <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  8003af:	55                   	push   %ebp
+  8003b0:	89 e5                	mov    %esp,%ebp
+  8003b2:	57                   	push   %edi
+  8003b3:	56                   	push   %esi
+  8003b4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003ba:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003bf:	89 d1                	mov    %edx,%ecx
+  8003c1:	89 d3                	mov    %edx,%ebx
+  8003c3:	89 d7                	mov    %edx,%edi
+  8003c5:	89 d6                	mov    %edx,%esi
+  8003c7:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8003c9:	5b                   	pop    %ebx
+  8003ca:	5e                   	pop    %esi
+  8003cb:	5f                   	pop    %edi
+  8003cc:	5d                   	pop    %ebp
+  8003cd:	c3                   	ret
+
+008003ce <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003ce:	55                   	push   %ebp
+  8003cf:	89 e5                	mov    %esp,%ebp
+  8003d1:	57                   	push   %edi
+  8003d2:	56                   	push   %esi
+  8003d3:	53                   	push   %ebx
+  8003d4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003e2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8003e7:	89 df                	mov    %ebx,%edi
+  8003e9:	89 de                	mov    %ebx,%esi
+  8003eb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003ed:	85 c0                	test   %eax,%eax
+  8003ef:	7f 08                	jg     8003f9 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f4:	5b                   	pop    %ebx
+  8003f5:	5e                   	pop    %esi
+  8003f6:	5f                   	pop    %edi
+  8003f7:	5d                   	pop    %ebp
+  8003f8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003f9:	83 ec 0c             	sub    $0xc,%esp
+  8003fc:	50                   	push   %eax
+  8003fd:	6a 08                	push   $0x8
+  8003ff:	68 aa 26 80 00       	push   $0x8026aa
+  800404:	6a 23                	push   $0x23
+  800406:	68 c7 26 80 00       	push   $0x8026c7
+  80040b:	e8 fb 12 00 00       	call   80170b <_panic>
+
+00800410 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800410:	55                   	push   %ebp
+  800411:	89 e5                	mov    %esp,%ebp
+  800413:	57                   	push   %edi
+  800414:	56                   	push   %esi
+  800415:	53                   	push   %ebx
+  800416:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800419:	6a 44                	push   $0x44
+  80041b:	ff 75 0c             	push   0xc(%ebp)
+  80041e:	e8 7a fc ff ff       	call   80009d <touch_mem>
+	asm volatile("int %1\n"
+  800423:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800428:	8b 55 08             	mov    0x8(%ebp),%edx
+  80042b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800430:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800433:	89 df                	mov    %ebx,%edi
+  800435:	89 de                	mov    %ebx,%esi
+  800437:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800439:	83 c4 08             	add    $0x8,%esp
+  80043c:	85 c0                	test   %eax,%eax
+  80043e:	7f 08                	jg     800448 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800440:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800443:	5b                   	pop    %ebx
+  800444:	5e                   	pop    %esi
+  800445:	5f                   	pop    %edi
+  800446:	5d                   	pop    %ebp
+  800447:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800448:	83 ec 0c             	sub    $0xc,%esp
+  80044b:	50                   	push   %eax
+  80044c:	6a 09                	push   $0x9
+  80044e:	68 aa 26 80 00       	push   $0x8026aa
+  800453:	6a 23                	push   $0x23
+  800455:	68 c7 26 80 00       	push   $0x8026c7
+  80045a:	e8 ac 12 00 00       	call   80170b <_panic>
+
+0080045f <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  80045f:	55                   	push   %ebp
+  800460:	89 e5                	mov    %esp,%ebp
+  800462:	57                   	push   %edi
+  800463:	56                   	push   %esi
+  800464:	53                   	push   %ebx
+  800465:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800468:	be 00 00 00 00       	mov    $0x0,%esi
+  80046d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800470:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800473:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800478:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80047b:	89 f7                	mov    %esi,%edi
+  80047d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80047f:	85 c0                	test   %eax,%eax
+  800481:	7f 08                	jg     80048b <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800483:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800486:	5b                   	pop    %ebx
+  800487:	5e                   	pop    %esi
+  800488:	5f                   	pop    %edi
+  800489:	5d                   	pop    %ebp
+  80048a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80048b:	83 ec 0c             	sub    $0xc,%esp
+  80048e:	50                   	push   %eax
+  80048f:	6a 1a                	push   $0x1a
+  800491:	68 aa 26 80 00       	push   $0x8026aa
+  800496:	6a 23                	push   $0x23
+  800498:	68 c7 26 80 00       	push   $0x8026c7
+  80049d:	e8 69 12 00 00       	call   80170b <_panic>
+
+008004a2 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8004a2:	55                   	push   %ebp
+  8004a3:	89 e5                	mov    %esp,%ebp
+  8004a5:	57                   	push   %edi
+  8004a6:	56                   	push   %esi
+  8004a7:	53                   	push   %ebx
+  8004a8:	83 ec 0c             	sub    $0xc,%esp
+  8004ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8004ae:	89 d8                	mov    %ebx,%eax
+  8004b0:	c1 e0 05             	shl    $0x5,%eax
+  8004b3:	50                   	push   %eax
+  8004b4:	ff 75 0c             	push   0xc(%ebp)
+  8004b7:	e8 e1 fb ff ff       	call   80009d <touch_mem>
+	asm volatile("int %1\n"
+  8004bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8004c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004cc:	89 f7                	mov    %esi,%edi
+  8004ce:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004d0:	83 c4 08             	add    $0x8,%esp
+  8004d3:	85 c0                	test   %eax,%eax
+  8004d5:	7f 08                	jg     8004df <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8004d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004da:	5b                   	pop    %ebx
+  8004db:	5e                   	pop    %esi
+  8004dc:	5f                   	pop    %edi
+  8004dd:	5d                   	pop    %ebp
+  8004de:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004df:	83 ec 0c             	sub    $0xc,%esp
+  8004e2:	50                   	push   %eax
+  8004e3:	6a 13                	push   $0x13
+  8004e5:	68 aa 26 80 00       	push   $0x8026aa
+  8004ea:	6a 23                	push   $0x23
+  8004ec:	68 c7 26 80 00       	push   $0x8026c7
+  8004f1:	e8 15 12 00 00       	call   80170b <_panic>
+
+008004f6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8004f6:	55                   	push   %ebp
+  8004f7:	89 e5                	mov    %esp,%ebp
+  8004f9:	57                   	push   %edi
+  8004fa:	56                   	push   %esi
+  8004fb:	53                   	push   %ebx
+  8004fc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8004ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800504:	8b 55 08             	mov    0x8(%ebp),%edx
+  800507:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80050a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80050f:	89 df                	mov    %ebx,%edi
+  800511:	89 de                	mov    %ebx,%esi
+  800513:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800515:	85 c0                	test   %eax,%eax
+  800517:	7f 08                	jg     800521 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800519:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80051c:	5b                   	pop    %ebx
+  80051d:	5e                   	pop    %esi
+  80051e:	5f                   	pop    %edi
+  80051f:	5d                   	pop    %ebp
+  800520:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800521:	83 ec 0c             	sub    $0xc,%esp
+  800524:	50                   	push   %eax
+  800525:	6a 0a                	push   $0xa
+  800527:	68 aa 26 80 00       	push   $0x8026aa
+  80052c:	6a 23                	push   $0x23
+  80052e:	68 c7 26 80 00       	push   $0x8026c7
+  800533:	e8 d3 11 00 00       	call   80170b <_panic>
+
+00800538 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800538:	55                   	push   %ebp
+  800539:	89 e5                	mov    %esp,%ebp
+  80053b:	57                   	push   %edi
+  80053c:	56                   	push   %esi
+  80053d:	53                   	push   %ebx
+  80053e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  800541:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800547:	76 1d                	jbe    800566 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  800549:	8b 55 08             	mov    0x8(%ebp),%edx
+  80054c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80054f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800554:	be 01 00 00 00       	mov    $0x1,%esi
+  800559:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80055c:	cd 30                	int    $0x30
+}
+  80055e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800561:	5b                   	pop    %ebx
+  800562:	5e                   	pop    %esi
+  800563:	5f                   	pop    %edi
+  800564:	5d                   	pop    %ebp
+  800565:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  800566:	68 00 10 00 00       	push   $0x1000
+  80056b:	53                   	push   %ebx
+  80056c:	e8 2c fb ff ff       	call   80009d <touch_mem>
+  800571:	83 c4 08             	add    $0x8,%esp
+  800574:	eb d3                	jmp    800549 <sys_ipc_send+0x11>
+
+00800576 <sys_ipc_send_pages>:
+{
+  800576:	55                   	push   %ebp
+  800577:	89 e5                	mov    %esp,%ebp
+  800579:	57                   	push   %edi
+  80057a:	56                   	push   %esi
+  80057b:	53                   	push   %ebx
+  80057c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80057f:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  800582:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800588:	76 18                	jbe    8005a2 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80058a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80058d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800590:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800595:	8b 7d 18             	mov    0x18(%ebp),%edi
+  800598:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  80059a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80059d:	5b                   	pop    %ebx
+  80059e:	5e                   	pop    %esi
+  80059f:	5f                   	pop    %edi
+  8005a0:	5d                   	pop    %ebp
+  8005a1:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8005a2:	89 f0                	mov    %esi,%eax
+  8005a4:	c1 e0 0c             	shl    $0xc,%eax
+  8005a7:	50                   	push   %eax
+  8005a8:	53                   	push   %ebx
+  8005a9:	e8 ef fa ff ff       	call   80009d <touch_mem>
+  8005ae:	83 c4 08             	add    $0x8,%esp
+  8005b1:	eb d7                	jmp    80058a <sys_ipc_send_pages+0x14>
+
+008005b3 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8005b3:	55                   	push   %ebp
+  8005b4:	89 e5                	mov    %esp,%ebp
+  8005b6:	57                   	push   %edi
+  8005b7:	56                   	push   %esi
+  8005b8:	53                   	push   %ebx
+  8005b9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8005bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005c7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8005cc:	89 df                	mov    %ebx,%edi
+  8005ce:	89 de                	mov    %ebx,%esi
+  8005d0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8005d2:	85 c0                	test   %eax,%eax
+  8005d4:	7f 08                	jg     8005de <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8005d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005d9:	5b                   	pop    %ebx
+  8005da:	5e                   	pop    %esi
+  8005db:	5f                   	pop    %edi
+  8005dc:	5d                   	pop    %ebp
+  8005dd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8005de:	83 ec 0c             	sub    $0xc,%esp
+  8005e1:	50                   	push   %eax
+  8005e2:	6a 0d                	push   $0xd
+  8005e4:	68 aa 26 80 00       	push   $0x8026aa
+  8005e9:	6a 23                	push   $0x23
+  8005eb:	68 c7 26 80 00       	push   $0x8026c7
+  8005f0:	e8 16 11 00 00       	call   80170b <_panic>
+
+008005f5 <sys_ipc_recv>:
+{
+  8005f5:	55                   	push   %ebp
+  8005f6:	89 e5                	mov    %esp,%ebp
+  8005f8:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8005fb:	6a 01                	push   $0x1
+  8005fd:	ff 75 08             	push   0x8(%ebp)
+  800600:	e8 ae ff ff ff       	call   8005b3 <sys_ipc_recv_pages>
+}
+  800605:	c9                   	leave
+  800606:	c3                   	ret
+
+00800607 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  800607:	55                   	push   %ebp
+  800608:	89 e5                	mov    %esp,%ebp
+  80060a:	57                   	push   %edi
+  80060b:	56                   	push   %esi
+  80060c:	53                   	push   %ebx
+  80060d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800610:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800613:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  800616:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80061c:	77 04                	ja     800622 <sys_ipc_call+0x1b>
+  80061e:	85 f6                	test   %esi,%esi
+  800620:	75 15                	jne    800637 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  800622:	8b 55 08             	mov    0x8(%ebp),%edx
+  800625:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800628:	b8 14 00 00 00       	mov    $0x14,%eax
+  80062d:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80062f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800632:	5b                   	pop    %ebx
+  800633:	5e                   	pop    %esi
+  800634:	5f                   	pop    %edi
+  800635:	5d                   	pop    %ebp
+  800636:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  800637:	89 f8                	mov    %edi,%eax
+  800639:	c1 e0 0c             	shl    $0xc,%eax
+  80063c:	50                   	push   %eax
+  80063d:	53                   	push   %ebx
+  80063e:	e8 5a fa ff ff       	call   80009d <touch_mem>
+  800643:	83 c4 08             	add    $0x8,%esp
+  800646:	eb da                	jmp    800622 <sys_ipc_call+0x1b>
+
+00800648 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  800648:	55                   	push   %ebp
+  800649:	89 e5                	mov    %esp,%ebp
+  80064b:	57                   	push   %edi
+  80064c:	56                   	push   %esi
+  80064d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80064e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800651:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800654:	b8 15 00 00 00       	mov    $0x15,%eax
+  800659:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80065c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80065f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800662:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  800664:	5b                   	pop    %ebx
+  800665:	5e                   	pop    %esi
+  800666:	5f                   	pop    %edi
+  800667:	5d                   	pop    %ebp
+  800668:	c3                   	ret
+
+00800669 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  800669:	55                   	push   %ebp
+  80066a:	89 e5                	mov    %esp,%ebp
+  80066c:	57                   	push   %edi
+  80066d:	56                   	push   %esi
+  80066e:	53                   	push   %ebx
+  80066f:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  800672:	6a 04                	push   $0x4
+  800674:	ff 75 08             	push   0x8(%ebp)
+  800677:	e8 21 fa ff ff       	call   80009d <touch_mem>
+	asm volatile("int %1\n"
+  80067c:	be 00 00 00 00       	mov    $0x0,%esi
+  800681:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800684:	b8 16 00 00 00       	mov    $0x16,%eax
+  800689:	8b 55 08             	mov    0x8(%ebp),%edx
+  80068c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80068f:	89 f7                	mov    %esi,%edi
+  800691:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800693:	83 c4 08             	add    $0x8,%esp
+  800696:	85 c0                	test   %eax,%eax
+  800698:	7f 08                	jg     8006a2 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  80069a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80069d:	5b                   	pop    %ebx
+  80069e:	5e                   	pop    %esi
+  80069f:	5f                   	pop    %edi
+  8006a0:	5d                   	pop    %ebp
+  8006a1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006a2:	83 ec 0c             	sub    $0xc,%esp
+  8006a5:	50                   	push   %eax
+  8006a6:	6a 16                	push   $0x16
+  8006a8:	68 aa 26 80 00       	push   $0x8026aa
+  8006ad:	6a 23                	push   $0x23
+  8006af:	68 c7 26 80 00       	push   $0x8026c7
+  8006b4:	e8 52 10 00 00       	call   80170b <_panic>
+
+008006b9 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8006b9:	55                   	push   %ebp
+  8006ba:	89 e5                	mov    %esp,%ebp
+  8006bc:	57                   	push   %edi
+  8006bd:	56                   	push   %esi
+  8006be:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8006bf:	6a 04                	push   $0x4
+  8006c1:	ff 75 08             	push   0x8(%ebp)
+  8006c4:	e8 d4 f9 ff ff       	call   80009d <touch_mem>
+	asm volatile("int %1\n"
+  8006c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006d1:	b8 17 00 00 00       	mov    $0x17,%eax
+  8006d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006d9:	89 df                	mov    %ebx,%edi
+  8006db:	89 de                	mov    %ebx,%esi
+  8006dd:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8006df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006e2:	5b                   	pop    %ebx
+  8006e3:	5e                   	pop    %esi
+  8006e4:	5f                   	pop    %edi
+  8006e5:	5d                   	pop    %ebp
+  8006e6:	c3                   	ret
+
+008006e7 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8006e7:	55                   	push   %ebp
+  8006e8:	89 e5                	mov    %esp,%ebp
+  8006ea:	57                   	push   %edi
+  8006eb:	56                   	push   %esi
+  8006ec:	53                   	push   %ebx
+  8006ed:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8006f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006f8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8006fd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800702:	89 df                	mov    %ebx,%edi
+  800704:	89 de                	mov    %ebx,%esi
+  800706:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800708:	85 c0                	test   %eax,%eax
+  80070a:	7f 08                	jg     800714 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80070c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80070f:	5b                   	pop    %ebx
+  800710:	5e                   	pop    %esi
+  800711:	5f                   	pop    %edi
+  800712:	5d                   	pop    %ebp
+  800713:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800714:	83 ec 0c             	sub    $0xc,%esp
+  800717:	50                   	push   %eax
+  800718:	6a 0e                	push   $0xe
+  80071a:	68 aa 26 80 00       	push   $0x8026aa
+  80071f:	6a 23                	push   $0x23
+  800721:	68 c7 26 80 00       	push   $0x8026c7
+  800726:	e8 e0 0f 00 00       	call   80170b <_panic>
+
+0080072b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80072b:	55                   	push   %ebp
+  80072c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80072e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800731:	05 00 00 00 30       	add    $0x30000000,%eax
+  800736:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800739:	5d                   	pop    %ebp
+  80073a:	c3                   	ret
+
+0080073b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80073b:	55                   	push   %ebp
+  80073c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80073e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800741:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800746:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80074b:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800750:	5d                   	pop    %ebp
+  800751:	c3                   	ret
+
+00800752 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800752:	55                   	push   %ebp
+  800753:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  800755:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  80075a:	a8 01                	test   $0x1,%al
+  80075c:	74 3c                	je     80079a <fd_alloc+0x48>
+  80075e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800763:	89 c2                	mov    %eax,%edx
+  800765:	c1 ea 0c             	shr    $0xc,%edx
+  800768:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80076f:	89 c1                	mov    %eax,%ecx
+  800771:	05 00 10 00 00       	add    $0x1000,%eax
+  800776:	f6 c2 01             	test   $0x1,%dl
+  800779:	74 13                	je     80078e <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80077b:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  800780:	75 e1                	jne    800763 <fd_alloc+0x11>
+  800782:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800787:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80078c:	eb 05                	jmp    800793 <fd_alloc+0x41>
+			return 0;
+  80078e:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  800793:	8b 55 08             	mov    0x8(%ebp),%edx
+  800796:	89 0a                	mov    %ecx,(%edx)
+}
+  800798:	5d                   	pop    %ebp
+  800799:	c3                   	ret
+  80079a:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  80079f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a4:	eb ed                	jmp    800793 <fd_alloc+0x41>
+
+008007a6 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8007a6:	55                   	push   %ebp
+  8007a7:	89 e5                	mov    %esp,%ebp
+  8007a9:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8007ac:	83 f8 1f             	cmp    $0x1f,%eax
+  8007af:	77 30                	ja     8007e1 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8007b1:	c1 e0 0c             	shl    $0xc,%eax
+  8007b4:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8007b9:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8007bf:	f6 c2 01             	test   $0x1,%dl
+  8007c2:	74 24                	je     8007e8 <fd_lookup+0x42>
+  8007c4:	89 c2                	mov    %eax,%edx
+  8007c6:	c1 ea 0c             	shr    $0xc,%edx
+  8007c9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8007d0:	f6 c2 01             	test   $0x1,%dl
+  8007d3:	74 1a                	je     8007ef <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8007d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007d8:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8007da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007df:	5d                   	pop    %ebp
+  8007e0:	c3                   	ret
+		return -E_INVAL;
+  8007e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007e6:	eb f7                	jmp    8007df <fd_lookup+0x39>
+		return -E_INVAL;
+  8007e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007ed:	eb f0                	jmp    8007df <fd_lookup+0x39>
+  8007ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007f4:	eb e9                	jmp    8007df <fd_lookup+0x39>
+
+008007f6 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8007f6:	55                   	push   %ebp
+  8007f7:	89 e5                	mov    %esp,%ebp
+  8007f9:	53                   	push   %ebx
+  8007fa:	83 ec 04             	sub    $0x4,%esp
+  8007fd:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800800:	b8 54 27 80 00       	mov    $0x802754,%eax
+  800805:	8b 18                	mov    (%eax),%ebx
+  800807:	85 db                	test   %ebx,%ebx
+  800809:	74 0e                	je     800819 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  80080b:	83 c0 04             	add    $0x4,%eax
+  80080e:	39 13                	cmp    %edx,(%ebx)
+  800810:	75 f3                	jne    800805 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  800812:	b8 00 00 00 00       	mov    $0x0,%eax
+  800817:	eb 1f                	jmp    800838 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800819:	a1 08 40 80 00       	mov    0x804008,%eax
+  80081e:	8b 40 48             	mov    0x48(%eax),%eax
+  800821:	83 ec 04             	sub    $0x4,%esp
+  800824:	52                   	push   %edx
+  800825:	50                   	push   %eax
+  800826:	68 d8 26 80 00       	push   $0x8026d8
+  80082b:	e8 b6 0f 00 00       	call   8017e6 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800830:	83 c4 10             	add    $0x10,%esp
+  800833:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800838:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80083b:	89 1a                	mov    %ebx,(%edx)
+}
+  80083d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800840:	c9                   	leave
+  800841:	c3                   	ret
+
+00800842 <fd_close>:
+{
+  800842:	55                   	push   %ebp
+  800843:	89 e5                	mov    %esp,%ebp
+  800845:	57                   	push   %edi
+  800846:	56                   	push   %esi
+  800847:	53                   	push   %ebx
+  800848:	83 ec 24             	sub    $0x24,%esp
+  80084b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80084e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800851:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800854:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800855:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80085b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80085e:	50                   	push   %eax
+  80085f:	e8 42 ff ff ff       	call   8007a6 <fd_lookup>
+  800864:	89 c3                	mov    %eax,%ebx
+  800866:	83 c4 10             	add    $0x10,%esp
+  800869:	85 c0                	test   %eax,%eax
+  80086b:	78 05                	js     800872 <fd_close+0x30>
+	    || fd != fd2)
+  80086d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800870:	74 16                	je     800888 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800872:	89 f8                	mov    %edi,%eax
+  800874:	84 c0                	test   %al,%al
+  800876:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80087e:	89 d8                	mov    %ebx,%eax
+  800880:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800883:	5b                   	pop    %ebx
+  800884:	5e                   	pop    %esi
+  800885:	5f                   	pop    %edi
+  800886:	5d                   	pop    %ebp
+  800887:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800888:	83 ec 08             	sub    $0x8,%esp
+  80088b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80088e:	50                   	push   %eax
+  80088f:	ff 36                	push   (%esi)
+  800891:	e8 60 ff ff ff       	call   8007f6 <dev_lookup>
+  800896:	89 c3                	mov    %eax,%ebx
+  800898:	83 c4 10             	add    $0x10,%esp
+  80089b:	85 c0                	test   %eax,%eax
+  80089d:	78 1a                	js     8008b9 <fd_close+0x77>
+		if (dev->dev_close)
+  80089f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008a2:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8008a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8008aa:	85 c0                	test   %eax,%eax
+  8008ac:	74 0b                	je     8008b9 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8008ae:	83 ec 0c             	sub    $0xc,%esp
+  8008b1:	56                   	push   %esi
+  8008b2:	ff d0                	call   *%eax
+  8008b4:	89 c3                	mov    %eax,%ebx
+  8008b6:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8008b9:	83 ec 08             	sub    $0x8,%esp
+  8008bc:	56                   	push   %esi
+  8008bd:	6a 00                	push   $0x0
+  8008bf:	e8 51 f9 ff ff       	call   800215 <sys_page_unmap>
+	return r;
+  8008c4:	83 c4 10             	add    $0x10,%esp
+  8008c7:	eb b5                	jmp    80087e <fd_close+0x3c>
+
+008008c9 <close>:
+
+int
+close(int fdnum)
+{
+  8008c9:	55                   	push   %ebp
+  8008ca:	89 e5                	mov    %esp,%ebp
+  8008cc:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8008cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008d2:	50                   	push   %eax
+  8008d3:	ff 75 08             	push   0x8(%ebp)
+  8008d6:	e8 cb fe ff ff       	call   8007a6 <fd_lookup>
+  8008db:	83 c4 10             	add    $0x10,%esp
+  8008de:	85 c0                	test   %eax,%eax
+  8008e0:	79 02                	jns    8008e4 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8008e2:	c9                   	leave
+  8008e3:	c3                   	ret
+		return fd_close(fd, 1);
+  8008e4:	83 ec 08             	sub    $0x8,%esp
+  8008e7:	6a 01                	push   $0x1
+  8008e9:	ff 75 f4             	push   -0xc(%ebp)
+  8008ec:	e8 51 ff ff ff       	call   800842 <fd_close>
+  8008f1:	83 c4 10             	add    $0x10,%esp
+  8008f4:	eb ec                	jmp    8008e2 <close+0x19>
+
+008008f6 <close_all>:
+
+void
+close_all(void)
+{
+  8008f6:	55                   	push   %ebp
+  8008f7:	89 e5                	mov    %esp,%ebp
+  8008f9:	53                   	push   %ebx
+  8008fa:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8008fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800902:	83 ec 0c             	sub    $0xc,%esp
+  800905:	53                   	push   %ebx
+  800906:	e8 be ff ff ff       	call   8008c9 <close>
+	for (i = 0; i < MAXFD; i++)
+  80090b:	83 c3 01             	add    $0x1,%ebx
+  80090e:	83 c4 10             	add    $0x10,%esp
+  800911:	83 fb 20             	cmp    $0x20,%ebx
+  800914:	75 ec                	jne    800902 <close_all+0xc>
+}
+  800916:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800919:	c9                   	leave
+  80091a:	c3                   	ret
+
+0080091b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80091b:	55                   	push   %ebp
+  80091c:	89 e5                	mov    %esp,%ebp
+  80091e:	57                   	push   %edi
+  80091f:	56                   	push   %esi
+  800920:	53                   	push   %ebx
+  800921:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800924:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800927:	50                   	push   %eax
+  800928:	ff 75 08             	push   0x8(%ebp)
+  80092b:	e8 76 fe ff ff       	call   8007a6 <fd_lookup>
+  800930:	89 c3                	mov    %eax,%ebx
+  800932:	83 c4 10             	add    $0x10,%esp
+  800935:	85 c0                	test   %eax,%eax
+  800937:	78 7f                	js     8009b8 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800939:	83 ec 0c             	sub    $0xc,%esp
+  80093c:	ff 75 0c             	push   0xc(%ebp)
+  80093f:	e8 85 ff ff ff       	call   8008c9 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800944:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800947:	c1 e6 0c             	shl    $0xc,%esi
+  80094a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800950:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800953:	89 3c 24             	mov    %edi,(%esp)
+  800956:	e8 e0 fd ff ff       	call   80073b <fd2data>
+  80095b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80095d:	89 34 24             	mov    %esi,(%esp)
+  800960:	e8 d6 fd ff ff       	call   80073b <fd2data>
+  800965:	83 c4 10             	add    $0x10,%esp
+  800968:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80096b:	89 d8                	mov    %ebx,%eax
+  80096d:	c1 e8 16             	shr    $0x16,%eax
+  800970:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800977:	a8 01                	test   $0x1,%al
+  800979:	74 11                	je     80098c <dup+0x71>
+  80097b:	89 d8                	mov    %ebx,%eax
+  80097d:	c1 e8 0c             	shr    $0xc,%eax
+  800980:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800987:	f6 c2 01             	test   $0x1,%dl
+  80098a:	75 36                	jne    8009c2 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80098c:	89 f8                	mov    %edi,%eax
+  80098e:	c1 e8 0c             	shr    $0xc,%eax
+  800991:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800998:	83 ec 0c             	sub    $0xc,%esp
+  80099b:	25 07 0e 00 00       	and    $0xe07,%eax
+  8009a0:	50                   	push   %eax
+  8009a1:	56                   	push   %esi
+  8009a2:	6a 00                	push   $0x0
+  8009a4:	57                   	push   %edi
+  8009a5:	6a 00                	push   $0x0
+  8009a7:	e8 27 f8 ff ff       	call   8001d3 <sys_page_map>
+  8009ac:	89 c3                	mov    %eax,%ebx
+  8009ae:	83 c4 20             	add    $0x20,%esp
+  8009b1:	85 c0                	test   %eax,%eax
+  8009b3:	78 33                	js     8009e8 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8009b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8009b8:	89 d8                	mov    %ebx,%eax
+  8009ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009bd:	5b                   	pop    %ebx
+  8009be:	5e                   	pop    %esi
+  8009bf:	5f                   	pop    %edi
+  8009c0:	5d                   	pop    %ebp
+  8009c1:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8009c2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8009c9:	83 ec 0c             	sub    $0xc,%esp
+  8009cc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8009d1:	50                   	push   %eax
+  8009d2:	ff 75 d4             	push   -0x2c(%ebp)
+  8009d5:	6a 00                	push   $0x0
+  8009d7:	53                   	push   %ebx
+  8009d8:	6a 00                	push   $0x0
+  8009da:	e8 f4 f7 ff ff       	call   8001d3 <sys_page_map>
+  8009df:	89 c3                	mov    %eax,%ebx
+  8009e1:	83 c4 20             	add    $0x20,%esp
+  8009e4:	85 c0                	test   %eax,%eax
+  8009e6:	79 a4                	jns    80098c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8009e8:	83 ec 08             	sub    $0x8,%esp
+  8009eb:	56                   	push   %esi
+  8009ec:	6a 00                	push   $0x0
+  8009ee:	e8 22 f8 ff ff       	call   800215 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8009f3:	83 c4 08             	add    $0x8,%esp
+  8009f6:	ff 75 d4             	push   -0x2c(%ebp)
+  8009f9:	6a 00                	push   $0x0
+  8009fb:	e8 15 f8 ff ff       	call   800215 <sys_page_unmap>
+	return r;
+  800a00:	83 c4 10             	add    $0x10,%esp
+  800a03:	eb b3                	jmp    8009b8 <dup+0x9d>
+
+00800a05 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800a05:	55                   	push   %ebp
+  800a06:	89 e5                	mov    %esp,%ebp
+  800a08:	56                   	push   %esi
+  800a09:	53                   	push   %ebx
+  800a0a:	83 ec 18             	sub    $0x18,%esp
+  800a0d:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a10:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a13:	50                   	push   %eax
+  800a14:	56                   	push   %esi
+  800a15:	e8 8c fd ff ff       	call   8007a6 <fd_lookup>
+  800a1a:	83 c4 10             	add    $0x10,%esp
+  800a1d:	85 c0                	test   %eax,%eax
+  800a1f:	78 3c                	js     800a5d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a21:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a24:	83 ec 08             	sub    $0x8,%esp
+  800a27:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a2a:	50                   	push   %eax
+  800a2b:	ff 33                	push   (%ebx)
+  800a2d:	e8 c4 fd ff ff       	call   8007f6 <dev_lookup>
+  800a32:	83 c4 10             	add    $0x10,%esp
+  800a35:	85 c0                	test   %eax,%eax
+  800a37:	78 24                	js     800a5d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a39:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a3c:	83 e0 03             	and    $0x3,%eax
+  800a3f:	83 f8 01             	cmp    $0x1,%eax
+  800a42:	74 20                	je     800a64 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800a44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a47:	8b 40 08             	mov    0x8(%eax),%eax
+  800a4a:	85 c0                	test   %eax,%eax
+  800a4c:	74 37                	je     800a85 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800a4e:	83 ec 04             	sub    $0x4,%esp
+  800a51:	ff 75 10             	push   0x10(%ebp)
+  800a54:	ff 75 0c             	push   0xc(%ebp)
+  800a57:	53                   	push   %ebx
+  800a58:	ff d0                	call   *%eax
+  800a5a:	83 c4 10             	add    $0x10,%esp
+}
+  800a5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a60:	5b                   	pop    %ebx
+  800a61:	5e                   	pop    %esi
+  800a62:	5d                   	pop    %ebp
+  800a63:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a64:	a1 08 40 80 00       	mov    0x804008,%eax
+  800a69:	8b 40 48             	mov    0x48(%eax),%eax
+  800a6c:	83 ec 04             	sub    $0x4,%esp
+  800a6f:	56                   	push   %esi
+  800a70:	50                   	push   %eax
+  800a71:	68 19 27 80 00       	push   $0x802719
+  800a76:	e8 6b 0d 00 00       	call   8017e6 <cprintf>
+		return -E_INVAL;
+  800a7b:	83 c4 10             	add    $0x10,%esp
+  800a7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a83:	eb d8                	jmp    800a5d <read+0x58>
+		return -E_NOT_SUPP;
+  800a85:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a8a:	eb d1                	jmp    800a5d <read+0x58>
+
+00800a8c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a8c:	55                   	push   %ebp
+  800a8d:	89 e5                	mov    %esp,%ebp
+  800a8f:	57                   	push   %edi
+  800a90:	56                   	push   %esi
+  800a91:	53                   	push   %ebx
+  800a92:	83 ec 0c             	sub    $0xc,%esp
+  800a95:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a98:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800a9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800aa0:	eb 02                	jmp    800aa4 <readn+0x18>
+  800aa2:	01 c3                	add    %eax,%ebx
+  800aa4:	39 f3                	cmp    %esi,%ebx
+  800aa6:	73 21                	jae    800ac9 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800aa8:	83 ec 04             	sub    $0x4,%esp
+  800aab:	89 f0                	mov    %esi,%eax
+  800aad:	29 d8                	sub    %ebx,%eax
+  800aaf:	50                   	push   %eax
+  800ab0:	89 d8                	mov    %ebx,%eax
+  800ab2:	03 45 0c             	add    0xc(%ebp),%eax
+  800ab5:	50                   	push   %eax
+  800ab6:	57                   	push   %edi
+  800ab7:	e8 49 ff ff ff       	call   800a05 <read>
+		if (m < 0)
+  800abc:	83 c4 10             	add    $0x10,%esp
+  800abf:	85 c0                	test   %eax,%eax
+  800ac1:	78 04                	js     800ac7 <readn+0x3b>
+			return m;
+		if (m == 0)
+  800ac3:	75 dd                	jne    800aa2 <readn+0x16>
+  800ac5:	eb 02                	jmp    800ac9 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800ac7:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800ac9:	89 d8                	mov    %ebx,%eax
+  800acb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ace:	5b                   	pop    %ebx
+  800acf:	5e                   	pop    %esi
+  800ad0:	5f                   	pop    %edi
+  800ad1:	5d                   	pop    %ebp
+  800ad2:	c3                   	ret
+
+00800ad3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800ad3:	55                   	push   %ebp
+  800ad4:	89 e5                	mov    %esp,%ebp
+  800ad6:	56                   	push   %esi
+  800ad7:	53                   	push   %ebx
+  800ad8:	83 ec 18             	sub    $0x18,%esp
+  800adb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800ade:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ae1:	50                   	push   %eax
+  800ae2:	53                   	push   %ebx
+  800ae3:	e8 be fc ff ff       	call   8007a6 <fd_lookup>
+  800ae8:	83 c4 10             	add    $0x10,%esp
+  800aeb:	85 c0                	test   %eax,%eax
+  800aed:	78 37                	js     800b26 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800aef:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800af2:	83 ec 08             	sub    $0x8,%esp
+  800af5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800af8:	50                   	push   %eax
+  800af9:	ff 36                	push   (%esi)
+  800afb:	e8 f6 fc ff ff       	call   8007f6 <dev_lookup>
+  800b00:	83 c4 10             	add    $0x10,%esp
+  800b03:	85 c0                	test   %eax,%eax
+  800b05:	78 1f                	js     800b26 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b07:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b0b:	74 20                	je     800b2d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800b0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b10:	8b 40 0c             	mov    0xc(%eax),%eax
+  800b13:	85 c0                	test   %eax,%eax
+  800b15:	74 37                	je     800b4e <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800b17:	83 ec 04             	sub    $0x4,%esp
+  800b1a:	ff 75 10             	push   0x10(%ebp)
+  800b1d:	ff 75 0c             	push   0xc(%ebp)
+  800b20:	56                   	push   %esi
+  800b21:	ff d0                	call   *%eax
+  800b23:	83 c4 10             	add    $0x10,%esp
+}
+  800b26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b29:	5b                   	pop    %ebx
+  800b2a:	5e                   	pop    %esi
+  800b2b:	5d                   	pop    %ebp
+  800b2c:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b2d:	a1 08 40 80 00       	mov    0x804008,%eax
+  800b32:	8b 40 48             	mov    0x48(%eax),%eax
+  800b35:	83 ec 04             	sub    $0x4,%esp
+  800b38:	53                   	push   %ebx
+  800b39:	50                   	push   %eax
+  800b3a:	68 35 27 80 00       	push   $0x802735
+  800b3f:	e8 a2 0c 00 00       	call   8017e6 <cprintf>
+		return -E_INVAL;
+  800b44:	83 c4 10             	add    $0x10,%esp
+  800b47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b4c:	eb d8                	jmp    800b26 <write+0x53>
+		return -E_NOT_SUPP;
+  800b4e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b53:	eb d1                	jmp    800b26 <write+0x53>
+
+00800b55 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b55:	55                   	push   %ebp
+  800b56:	89 e5                	mov    %esp,%ebp
+  800b58:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b5b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b5e:	50                   	push   %eax
+  800b5f:	ff 75 08             	push   0x8(%ebp)
+  800b62:	e8 3f fc ff ff       	call   8007a6 <fd_lookup>
+  800b67:	83 c4 10             	add    $0x10,%esp
+  800b6a:	85 c0                	test   %eax,%eax
+  800b6c:	78 0e                	js     800b7c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b6e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b74:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800b77:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b7c:	c9                   	leave
+  800b7d:	c3                   	ret
+
+00800b7e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b7e:	55                   	push   %ebp
+  800b7f:	89 e5                	mov    %esp,%ebp
+  800b81:	56                   	push   %esi
+  800b82:	53                   	push   %ebx
+  800b83:	83 ec 18             	sub    $0x18,%esp
+  800b86:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b89:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b8c:	50                   	push   %eax
+  800b8d:	53                   	push   %ebx
+  800b8e:	e8 13 fc ff ff       	call   8007a6 <fd_lookup>
+  800b93:	83 c4 10             	add    $0x10,%esp
+  800b96:	85 c0                	test   %eax,%eax
+  800b98:	78 34                	js     800bce <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b9a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b9d:	83 ec 08             	sub    $0x8,%esp
+  800ba0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ba3:	50                   	push   %eax
+  800ba4:	ff 36                	push   (%esi)
+  800ba6:	e8 4b fc ff ff       	call   8007f6 <dev_lookup>
+  800bab:	83 c4 10             	add    $0x10,%esp
+  800bae:	85 c0                	test   %eax,%eax
+  800bb0:	78 1c                	js     800bce <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bb2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800bb6:	74 1d                	je     800bd5 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800bb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bbb:	8b 40 18             	mov    0x18(%eax),%eax
+  800bbe:	85 c0                	test   %eax,%eax
+  800bc0:	74 34                	je     800bf6 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800bc2:	83 ec 08             	sub    $0x8,%esp
+  800bc5:	ff 75 0c             	push   0xc(%ebp)
+  800bc8:	56                   	push   %esi
+  800bc9:	ff d0                	call   *%eax
+  800bcb:	83 c4 10             	add    $0x10,%esp
+}
+  800bce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bd1:	5b                   	pop    %ebx
+  800bd2:	5e                   	pop    %esi
+  800bd3:	5d                   	pop    %ebp
+  800bd4:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800bd5:	a1 08 40 80 00       	mov    0x804008,%eax
+  800bda:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800bdd:	83 ec 04             	sub    $0x4,%esp
+  800be0:	53                   	push   %ebx
+  800be1:	50                   	push   %eax
+  800be2:	68 f8 26 80 00       	push   $0x8026f8
+  800be7:	e8 fa 0b 00 00       	call   8017e6 <cprintf>
+		return -E_INVAL;
+  800bec:	83 c4 10             	add    $0x10,%esp
+  800bef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bf4:	eb d8                	jmp    800bce <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800bf6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bfb:	eb d1                	jmp    800bce <ftruncate+0x50>
+
+00800bfd <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	56                   	push   %esi
+  800c01:	53                   	push   %ebx
+  800c02:	83 ec 18             	sub    $0x18,%esp
+  800c05:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c08:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c0b:	50                   	push   %eax
+  800c0c:	ff 75 08             	push   0x8(%ebp)
+  800c0f:	e8 92 fb ff ff       	call   8007a6 <fd_lookup>
+  800c14:	83 c4 10             	add    $0x10,%esp
+  800c17:	85 c0                	test   %eax,%eax
+  800c19:	78 49                	js     800c64 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c1b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c1e:	83 ec 08             	sub    $0x8,%esp
+  800c21:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c24:	50                   	push   %eax
+  800c25:	ff 36                	push   (%esi)
+  800c27:	e8 ca fb ff ff       	call   8007f6 <dev_lookup>
+  800c2c:	83 c4 10             	add    $0x10,%esp
+  800c2f:	85 c0                	test   %eax,%eax
+  800c31:	78 31                	js     800c64 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c36:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c3a:	74 2f                	je     800c6b <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c3c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c3f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c46:	00 00 00 
+	stat->st_isdir = 0;
+  800c49:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c50:	00 00 00 
+	stat->st_dev = dev;
+  800c53:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c59:	83 ec 08             	sub    $0x8,%esp
+  800c5c:	53                   	push   %ebx
+  800c5d:	56                   	push   %esi
+  800c5e:	ff 50 14             	call   *0x14(%eax)
+  800c61:	83 c4 10             	add    $0x10,%esp
+}
+  800c64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c67:	5b                   	pop    %ebx
+  800c68:	5e                   	pop    %esi
+  800c69:	5d                   	pop    %ebp
+  800c6a:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c6b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c70:	eb f2                	jmp    800c64 <fstat+0x67>
+
+00800c72 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c72:	55                   	push   %ebp
+  800c73:	89 e5                	mov    %esp,%ebp
+  800c75:	56                   	push   %esi
+  800c76:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c77:	83 ec 08             	sub    $0x8,%esp
+  800c7a:	6a 00                	push   $0x0
+  800c7c:	ff 75 08             	push   0x8(%ebp)
+  800c7f:	e8 bc 02 00 00       	call   800f40 <open>
+  800c84:	89 c3                	mov    %eax,%ebx
+  800c86:	83 c4 10             	add    $0x10,%esp
+  800c89:	85 c0                	test   %eax,%eax
+  800c8b:	78 1b                	js     800ca8 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c8d:	83 ec 08             	sub    $0x8,%esp
+  800c90:	ff 75 0c             	push   0xc(%ebp)
+  800c93:	50                   	push   %eax
+  800c94:	e8 64 ff ff ff       	call   800bfd <fstat>
+  800c99:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c9b:	89 1c 24             	mov    %ebx,(%esp)
+  800c9e:	e8 26 fc ff ff       	call   8008c9 <close>
+	return r;
+  800ca3:	83 c4 10             	add    $0x10,%esp
+  800ca6:	89 f3                	mov    %esi,%ebx
+}
+  800ca8:	89 d8                	mov    %ebx,%eax
+  800caa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cad:	5b                   	pop    %ebx
+  800cae:	5e                   	pop    %esi
+  800caf:	5d                   	pop    %ebp
+  800cb0:	c3                   	ret
+
+00800cb1 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  800cb1:	55                   	push   %ebp
+  800cb2:	89 e5                	mov    %esp,%ebp
+  800cb4:	57                   	push   %edi
+  800cb5:	56                   	push   %esi
+  800cb6:	53                   	push   %ebx
+  800cb7:	83 ec 0c             	sub    $0xc,%esp
+  800cba:	89 c7                	mov    %eax,%edi
+  800cbc:	89 d3                	mov    %edx,%ebx
+  800cbe:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800cc0:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800cc7:	74 2d                	je     800cf6 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cc9:	6a 07                	push   $0x7
+  800ccb:	68 00 50 80 00       	push   $0x805000
+  800cd0:	57                   	push   %edi
+  800cd1:	ff 35 00 40 80 00    	push   0x804000
+  800cd7:	e8 3f 16 00 00       	call   80231b <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  800cdc:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800ce3:	6a 00                	push   $0x0
+  800ce5:	56                   	push   %esi
+  800ce6:	53                   	push   %ebx
+  800ce7:	6a 00                	push   $0x0
+  800ce9:	e8 df 14 00 00       	call   8021cd <ipc_recv_pages>
+}
+  800cee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf1:	5b                   	pop    %ebx
+  800cf2:	5e                   	pop    %esi
+  800cf3:	5f                   	pop    %edi
+  800cf4:	5d                   	pop    %ebp
+  800cf5:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800cf6:	83 ec 0c             	sub    $0xc,%esp
+  800cf9:	6a 01                	push   $0x1
+  800cfb:	e8 10 17 00 00       	call   802410 <ipc_find_env>
+  800d00:	a3 00 40 80 00       	mov    %eax,0x804000
+  800d05:	83 c4 10             	add    $0x10,%esp
+  800d08:	eb bf                	jmp    800cc9 <fsipc_pages+0x18>
+
+00800d0a <fsipc>:
+{
+  800d0a:	55                   	push   %ebp
+  800d0b:	89 e5                	mov    %esp,%ebp
+  800d0d:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  800d10:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d15:	e8 97 ff ff ff       	call   800cb1 <fsipc_pages>
+}
+  800d1a:	c9                   	leave
+  800d1b:	c3                   	ret
+
+00800d1c <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d1c:	55                   	push   %ebp
+  800d1d:	89 e5                	mov    %esp,%ebp
+  800d1f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d22:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d25:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d28:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800d2d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d30:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800d35:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d3a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d3f:	e8 c6 ff ff ff       	call   800d0a <fsipc>
+}
+  800d44:	c9                   	leave
+  800d45:	c3                   	ret
+
+00800d46 <devfile_flush>:
+{
+  800d46:	55                   	push   %ebp
+  800d47:	89 e5                	mov    %esp,%ebp
+  800d49:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d4f:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d52:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800d57:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d61:	e8 a4 ff ff ff       	call   800d0a <fsipc>
+}
+  800d66:	c9                   	leave
+  800d67:	c3                   	ret
+
+00800d68 <devfile_stat>:
+{
+  800d68:	55                   	push   %ebp
+  800d69:	89 e5                	mov    %esp,%ebp
+  800d6b:	53                   	push   %ebx
+  800d6c:	83 ec 04             	sub    $0x4,%esp
+  800d6f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d72:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d75:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d78:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800d7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d82:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d87:	e8 7e ff ff ff       	call   800d0a <fsipc>
+  800d8c:	85 c0                	test   %eax,%eax
+  800d8e:	78 2c                	js     800dbc <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800d90:	83 ec 08             	sub    $0x8,%esp
+  800d93:	68 00 50 80 00       	push   $0x805000
+  800d98:	53                   	push   %ebx
+  800d99:	e8 2f 10 00 00       	call   801dcd <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800d9e:	a1 80 50 80 00       	mov    0x805080,%eax
+  800da3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800da9:	a1 84 50 80 00       	mov    0x805084,%eax
+  800dae:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800db4:	83 c4 10             	add    $0x10,%esp
+  800db7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dbc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dbf:	c9                   	leave
+  800dc0:	c3                   	ret
+
+00800dc1 <devfile_write>:
+{
+  800dc1:	55                   	push   %ebp
+  800dc2:	89 e5                	mov    %esp,%ebp
+  800dc4:	83 ec 0c             	sub    $0xc,%esp
+  800dc7:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800dca:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800dcf:	39 d0                	cmp    %edx,%eax
+  800dd1:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800dd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd7:	8b 52 0c             	mov    0xc(%edx),%edx
+  800dda:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  800de0:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800de5:	50                   	push   %eax
+  800de6:	ff 75 0c             	push   0xc(%ebp)
+  800de9:	68 08 50 80 00       	push   $0x805008
+  800dee:	e8 60 11 00 00       	call   801f53 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800df3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dfd:	e8 08 ff ff ff       	call   800d0a <fsipc>
+}
+  800e02:	c9                   	leave
+  800e03:	c3                   	ret
+
+00800e04 <devfile_read>:
+{
+  800e04:	55                   	push   %ebp
+  800e05:	89 e5                	mov    %esp,%ebp
+  800e07:	57                   	push   %edi
+  800e08:	56                   	push   %esi
+  800e09:	53                   	push   %ebx
+  800e0a:	83 ec 1c             	sub    $0x1c,%esp
+  800e0d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e10:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e13:	89 fe                	mov    %edi,%esi
+  800e15:	c1 ee 0c             	shr    $0xc,%esi
+  800e18:	b8 20 00 00 00       	mov    $0x20,%eax
+  800e1d:	39 c6                	cmp    %eax,%esi
+  800e1f:	0f 47 f0             	cmova  %eax,%esi
+  800e22:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e25:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e2a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  800e2d:	eb 14                	jmp    800e43 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e2f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  800e36:	05 00 10 00 00       	add    $0x1000,%eax
+  800e3b:	f6 c6 06             	test   $0x6,%dh
+  800e3e:	75 42                	jne    800e82 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e40:	83 c1 01             	add    $0x1,%ecx
+  800e43:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800e46:	39 f1                	cmp    %esi,%ecx
+  800e48:	0f 84 95 00 00 00    	je     800ee3 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e4e:	89 c2                	mov    %eax,%edx
+  800e50:	c1 ea 16             	shr    $0x16,%edx
+  800e53:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e5a:	f6 c2 01             	test   $0x1,%dl
+  800e5d:	74 23                	je     800e82 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e5f:	89 c2                	mov    %eax,%edx
+  800e61:	c1 ea 0c             	shr    $0xc,%edx
+  800e64:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800e6b:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  800e71:	74 0f                	je     800e82 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  800e73:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800e7a:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  800e80:	75 ad                	jne    800e2f <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  800e82:	85 c9                	test   %ecx,%ecx
+  800e84:	74 11                	je     800e97 <devfile_read+0x93>
+  800e86:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  800e8d:	75 08                	jne    800e97 <devfile_read+0x93>
+  800e8f:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  800e95:	74 50                	je     800ee7 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800e97:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800e9a:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  800e9f:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800ea5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eaa:	b8 03 00 00 00       	mov    $0x3,%eax
+  800eaf:	e8 56 fe ff ff       	call   800d0a <fsipc>
+  800eb4:	89 c6                	mov    %eax,%esi
+  800eb6:	85 c0                	test   %eax,%eax
+  800eb8:	78 1f                	js     800ed9 <devfile_read+0xd5>
+	assert(r <= n);
+  800eba:	39 c7                	cmp    %eax,%edi
+  800ebc:	72 50                	jb     800f0e <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  800ebe:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800ec3:	7f 62                	jg     800f27 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  800ec5:	83 ec 04             	sub    $0x4,%esp
+  800ec8:	50                   	push   %eax
+  800ec9:	68 00 50 80 00       	push   $0x805000
+  800ece:	ff 75 0c             	push   0xc(%ebp)
+  800ed1:	e8 7d 10 00 00       	call   801f53 <memmove>
+	return r;
+  800ed6:	83 c4 10             	add    $0x10,%esp
+}
+  800ed9:	89 f0                	mov    %esi,%eax
+  800edb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ede:	5b                   	pop    %ebx
+  800edf:	5e                   	pop    %esi
+  800ee0:	5f                   	pop    %edi
+  800ee1:	5d                   	pop    %ebp
+  800ee2:	c3                   	ret
+  800ee3:	89 f1                	mov    %esi,%ecx
+  800ee5:	eb 9b                	jmp    800e82 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  800ee7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800eea:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  800eef:	89 c8                	mov    %ecx,%eax
+  800ef1:	c1 e0 0c             	shl    $0xc,%eax
+  800ef4:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  800ef9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800efc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f01:	e8 ab fd ff ff       	call   800cb1 <fsipc_pages>
+  800f06:	89 c6                	mov    %eax,%esi
+  800f08:	85 c0                	test   %eax,%eax
+  800f0a:	78 8b                	js     800e97 <devfile_read+0x93>
+  800f0c:	eb cb                	jmp    800ed9 <devfile_read+0xd5>
+	assert(r <= n);
+  800f0e:	68 64 27 80 00       	push   $0x802764
+  800f13:	68 6b 27 80 00       	push   $0x80276b
+  800f18:	68 a0 00 00 00       	push   $0xa0
+  800f1d:	68 80 27 80 00       	push   $0x802780
+  800f22:	e8 e4 07 00 00       	call   80170b <_panic>
+	assert(r <= PGSIZE);
+  800f27:	68 8b 27 80 00       	push   $0x80278b
+  800f2c:	68 6b 27 80 00       	push   $0x80276b
+  800f31:	68 a1 00 00 00       	push   $0xa1
+  800f36:	68 80 27 80 00       	push   $0x802780
+  800f3b:	e8 cb 07 00 00       	call   80170b <_panic>
+
+00800f40 <open>:
+{
+  800f40:	55                   	push   %ebp
+  800f41:	89 e5                	mov    %esp,%ebp
+  800f43:	56                   	push   %esi
+  800f44:	53                   	push   %ebx
+  800f45:	83 ec 1c             	sub    $0x1c,%esp
+  800f48:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800f4b:	56                   	push   %esi
+  800f4c:	e8 41 0e 00 00       	call   801d92 <strlen>
+  800f51:	83 c4 10             	add    $0x10,%esp
+  800f54:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f59:	7f 6c                	jg     800fc7 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800f5b:	83 ec 0c             	sub    $0xc,%esp
+  800f5e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f61:	50                   	push   %eax
+  800f62:	e8 eb f7 ff ff       	call   800752 <fd_alloc>
+  800f67:	89 c3                	mov    %eax,%ebx
+  800f69:	83 c4 10             	add    $0x10,%esp
+  800f6c:	85 c0                	test   %eax,%eax
+  800f6e:	78 3c                	js     800fac <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800f70:	83 ec 08             	sub    $0x8,%esp
+  800f73:	56                   	push   %esi
+  800f74:	68 00 50 80 00       	push   $0x805000
+  800f79:	e8 4f 0e 00 00       	call   801dcd <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800f7e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f81:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800f86:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800f89:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8e:	e8 77 fd ff ff       	call   800d0a <fsipc>
+  800f93:	89 c3                	mov    %eax,%ebx
+  800f95:	83 c4 10             	add    $0x10,%esp
+  800f98:	85 c0                	test   %eax,%eax
+  800f9a:	78 19                	js     800fb5 <open+0x75>
+	return fd2num(fd);
+  800f9c:	83 ec 0c             	sub    $0xc,%esp
+  800f9f:	ff 75 f4             	push   -0xc(%ebp)
+  800fa2:	e8 84 f7 ff ff       	call   80072b <fd2num>
+  800fa7:	89 c3                	mov    %eax,%ebx
+  800fa9:	83 c4 10             	add    $0x10,%esp
+}
+  800fac:	89 d8                	mov    %ebx,%eax
+  800fae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fb1:	5b                   	pop    %ebx
+  800fb2:	5e                   	pop    %esi
+  800fb3:	5d                   	pop    %ebp
+  800fb4:	c3                   	ret
+		fd_close(fd, 0);
+  800fb5:	83 ec 08             	sub    $0x8,%esp
+  800fb8:	6a 00                	push   $0x0
+  800fba:	ff 75 f4             	push   -0xc(%ebp)
+  800fbd:	e8 80 f8 ff ff       	call   800842 <fd_close>
+		return r;
+  800fc2:	83 c4 10             	add    $0x10,%esp
+  800fc5:	eb e5                	jmp    800fac <open+0x6c>
+		return -E_BAD_PATH;
+  800fc7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800fcc:	eb de                	jmp    800fac <open+0x6c>
+
+00800fce <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	53                   	push   %ebx
+  800fd2:	83 ec 10             	sub    $0x10,%esp
+  800fd5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  800fd8:	53                   	push   %ebx
+  800fd9:	e8 b4 0d 00 00       	call   801d92 <strlen>
+  800fde:	83 c4 10             	add    $0x10,%esp
+  800fe1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800fe6:	7f 25                	jg     80100d <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  800fe8:	83 ec 08             	sub    $0x8,%esp
+  800feb:	53                   	push   %ebx
+  800fec:	68 00 50 80 00       	push   $0x805000
+  800ff1:	e8 d7 0d 00 00       	call   801dcd <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  800ff6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ffb:	b8 07 00 00 00       	mov    $0x7,%eax
+  801000:	e8 05 fd ff ff       	call   800d0a <fsipc>
+  801005:	83 c4 10             	add    $0x10,%esp
+}
+  801008:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80100b:	c9                   	leave
+  80100c:	c3                   	ret
+		return -E_BAD_PATH;
+  80100d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801012:	eb f4                	jmp    801008 <remove+0x3a>
+
+00801014 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801014:	55                   	push   %ebp
+  801015:	89 e5                	mov    %esp,%ebp
+  801017:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80101a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801024:	e8 e1 fc ff ff       	call   800d0a <fsipc>
+}
+  801029:	c9                   	leave
+  80102a:	c3                   	ret
+
+0080102b <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  80102b:	55                   	push   %ebp
+  80102c:	89 e5                	mov    %esp,%ebp
+  80102e:	53                   	push   %ebx
+  80102f:	83 ec 04             	sub    $0x4,%esp
+  801032:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801035:	ba 00 00 00 00       	mov    $0x0,%edx
+  80103a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80103f:	e8 c6 fc ff ff       	call   800d0a <fsipc>
+  801044:	85 c0                	test   %eax,%eax
+  801046:	78 3c                	js     801084 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801048:	a1 00 50 80 00       	mov    0x805000,%eax
+  80104d:	89 03                	mov    %eax,(%ebx)
+  80104f:	a1 04 50 80 00       	mov    0x805004,%eax
+  801054:	89 43 04             	mov    %eax,0x4(%ebx)
+  801057:	a1 08 50 80 00       	mov    0x805008,%eax
+  80105c:	89 43 08             	mov    %eax,0x8(%ebx)
+  80105f:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801064:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801067:	a1 10 50 80 00       	mov    0x805010,%eax
+  80106c:	89 43 10             	mov    %eax,0x10(%ebx)
+  80106f:	a1 14 50 80 00       	mov    0x805014,%eax
+  801074:	89 43 14             	mov    %eax,0x14(%ebx)
+  801077:	a1 18 50 80 00       	mov    0x805018,%eax
+  80107c:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  80107f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801084:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801087:	c9                   	leave
+  801088:	c3                   	ret
+
+00801089 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801089:	55                   	push   %ebp
+  80108a:	89 e5                	mov    %esp,%ebp
+  80108c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  80108f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801092:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  801097:	ba 00 00 00 00       	mov    $0x0,%edx
+  80109c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010a1:	e8 64 fc ff ff       	call   800d0a <fsipc>
+}
+  8010a6:	c9                   	leave
+  8010a7:	c3                   	ret
+
+008010a8 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8010a8:	55                   	push   %ebp
+  8010a9:	89 e5                	mov    %esp,%ebp
+  8010ab:	56                   	push   %esi
+  8010ac:	53                   	push   %ebx
+  8010ad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8010b0:	83 ec 0c             	sub    $0xc,%esp
+  8010b3:	ff 75 08             	push   0x8(%ebp)
+  8010b6:	e8 80 f6 ff ff       	call   80073b <fd2data>
+  8010bb:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8010bd:	83 c4 08             	add    $0x8,%esp
+  8010c0:	68 97 27 80 00       	push   $0x802797
+  8010c5:	53                   	push   %ebx
+  8010c6:	e8 02 0d 00 00       	call   801dcd <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8010cb:	8b 46 04             	mov    0x4(%esi),%eax
+  8010ce:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8010d4:	2b 0e                	sub    (%esi),%ecx
+  8010d6:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8010db:	89 c8                	mov    %ecx,%eax
+  8010dd:	f7 e2                	mul    %edx
+  8010df:	c1 ea 0c             	shr    $0xc,%edx
+  8010e2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8010e8:	29 d1                	sub    %edx,%ecx
+  8010ea:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8010f0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8010f7:	00 00 00 
+	stat->st_dev = &devpipe;
+  8010fa:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  801101:	30 80 00 
+	return 0;
+}
+  801104:	b8 00 00 00 00       	mov    $0x0,%eax
+  801109:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80110c:	5b                   	pop    %ebx
+  80110d:	5e                   	pop    %esi
+  80110e:	5d                   	pop    %ebp
+  80110f:	c3                   	ret
+
+00801110 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801110:	55                   	push   %ebp
+  801111:	89 e5                	mov    %esp,%ebp
+  801113:	53                   	push   %ebx
+  801114:	83 ec 0c             	sub    $0xc,%esp
+  801117:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80111a:	53                   	push   %ebx
+  80111b:	6a 00                	push   $0x0
+  80111d:	e8 f3 f0 ff ff       	call   800215 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801122:	89 1c 24             	mov    %ebx,(%esp)
+  801125:	e8 11 f6 ff ff       	call   80073b <fd2data>
+  80112a:	83 c4 08             	add    $0x8,%esp
+  80112d:	50                   	push   %eax
+  80112e:	6a 00                	push   $0x0
+  801130:	e8 e0 f0 ff ff       	call   800215 <sys_page_unmap>
+}
+  801135:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801138:	c9                   	leave
+  801139:	c3                   	ret
+
+0080113a <_pipeisclosed>:
+{
+  80113a:	55                   	push   %ebp
+  80113b:	89 e5                	mov    %esp,%ebp
+  80113d:	57                   	push   %edi
+  80113e:	56                   	push   %esi
+  80113f:	53                   	push   %ebx
+  801140:	83 ec 1c             	sub    $0x1c,%esp
+  801143:	89 c7                	mov    %eax,%edi
+  801145:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801147:	a1 08 40 80 00       	mov    0x804008,%eax
+  80114c:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80114f:	83 ec 0c             	sub    $0xc,%esp
+  801152:	57                   	push   %edi
+  801153:	e8 f7 12 00 00       	call   80244f <pageref>
+  801158:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80115b:	89 34 24             	mov    %esi,(%esp)
+  80115e:	e8 ec 12 00 00       	call   80244f <pageref>
+		nn = thisenv->env_runs;
+  801163:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801169:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80116c:	83 c4 10             	add    $0x10,%esp
+  80116f:	39 cb                	cmp    %ecx,%ebx
+  801171:	74 1b                	je     80118e <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801173:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801176:	75 cf                	jne    801147 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801178:	8b 42 58             	mov    0x58(%edx),%eax
+  80117b:	6a 01                	push   $0x1
+  80117d:	50                   	push   %eax
+  80117e:	53                   	push   %ebx
+  80117f:	68 9e 27 80 00       	push   $0x80279e
+  801184:	e8 5d 06 00 00       	call   8017e6 <cprintf>
+  801189:	83 c4 10             	add    $0x10,%esp
+  80118c:	eb b9                	jmp    801147 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80118e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801191:	0f 94 c0             	sete   %al
+  801194:	0f b6 c0             	movzbl %al,%eax
+}
+  801197:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80119a:	5b                   	pop    %ebx
+  80119b:	5e                   	pop    %esi
+  80119c:	5f                   	pop    %edi
+  80119d:	5d                   	pop    %ebp
+  80119e:	c3                   	ret
+
+0080119f <devpipe_read>:
+{
+  80119f:	55                   	push   %ebp
+  8011a0:	89 e5                	mov    %esp,%ebp
+  8011a2:	57                   	push   %edi
+  8011a3:	56                   	push   %esi
+  8011a4:	53                   	push   %ebx
+  8011a5:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8011a8:	ff 75 08             	push   0x8(%ebp)
+  8011ab:	e8 8b f5 ff ff       	call   80073b <fd2data>
+  8011b0:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8011b2:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8011b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8011b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8011bb:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8011be:	8b 0b                	mov    (%ebx),%ecx
+  8011c0:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8011c6:	29 ce                	sub    %ecx,%esi
+  8011c8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8011cd:	f7 e6                	mul    %esi
+  8011cf:	c1 ea 0c             	shr    $0xc,%edx
+  8011d2:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8011d8:	29 c6                	sub    %eax,%esi
+  8011da:	89 f2                	mov    %esi,%edx
+  8011dc:	75 43                	jne    801221 <devpipe_read+0x82>
+		ref = pageref(p);
+  8011de:	83 ec 0c             	sub    $0xc,%esp
+  8011e1:	53                   	push   %ebx
+  8011e2:	e8 68 12 00 00       	call   80244f <pageref>
+  8011e7:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8011e9:	89 da                	mov    %ebx,%edx
+  8011eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011ee:	e8 47 ff ff ff       	call   80113a <_pipeisclosed>
+  8011f3:	83 c4 10             	add    $0x10,%esp
+  8011f6:	85 c0                	test   %eax,%eax
+  8011f8:	0f 85 c1 00 00 00    	jne    8012bf <devpipe_read+0x120>
+	*sleeping = 1;
+  8011fe:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801205:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80120a:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  80120d:	75 ac                	jne    8011bb <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  80120f:	83 ec 04             	sub    $0x4,%esp
+  801212:	56                   	push   %esi
+  801213:	57                   	push   %edi
+  801214:	ff 75 e4             	push   -0x1c(%ebp)
+  801217:	e8 4d f4 ff ff       	call   800669 <sys_futex_wait>
+  80121c:	83 c4 10             	add    $0x10,%esp
+  80121f:	eb 9a                	jmp    8011bb <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801221:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801224:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801228:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80122a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80122f:	f7 e1                	mul    %ecx
+  801231:	c1 ea 0b             	shr    $0xb,%edx
+  801234:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80123a:	29 c1                	sub    %eax,%ecx
+  80123c:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  80123e:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801243:	29 cf                	sub    %ecx,%edi
+  801245:	39 f7                	cmp    %esi,%edi
+  801247:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  80124a:	8d 43 10             	lea    0x10(%ebx),%eax
+  80124d:	83 ec 04             	sub    $0x4,%esp
+  801250:	57                   	push   %edi
+  801251:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801254:	01 c2                	add    %eax,%edx
+  801256:	52                   	push   %edx
+  801257:	ff 75 0c             	push   0xc(%ebp)
+  80125a:	e8 f4 0c 00 00       	call   801f53 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  80125f:	83 c4 0c             	add    $0xc,%esp
+  801262:	89 f1                	mov    %esi,%ecx
+  801264:	29 f9                	sub    %edi,%ecx
+  801266:	51                   	push   %ecx
+  801267:	ff 75 e4             	push   -0x1c(%ebp)
+  80126a:	89 f8                	mov    %edi,%eax
+  80126c:	03 45 0c             	add    0xc(%ebp),%eax
+  80126f:	50                   	push   %eax
+  801270:	e8 de 0c 00 00       	call   801f53 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801275:	89 f1                	mov    %esi,%ecx
+  801277:	03 0b                	add    (%ebx),%ecx
+  801279:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80127e:	f7 e1                	mul    %ecx
+  801280:	c1 ea 0c             	shr    $0xc,%edx
+  801283:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801289:	29 d1                	sub    %edx,%ecx
+  80128b:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  80128d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801292:	83 c4 10             	add    $0x10,%esp
+  801295:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801299:	75 0a                	jne    8012a5 <devpipe_read+0x106>
+	return n;
+  80129b:	89 f0                	mov    %esi,%eax
+}
+  80129d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a0:	5b                   	pop    %ebx
+  8012a1:	5e                   	pop    %esi
+  8012a2:	5f                   	pop    %edi
+  8012a3:	5d                   	pop    %ebp
+  8012a4:	c3                   	ret
+		*sleeping = 0;
+  8012a5:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8012ac:	83 ec 08             	sub    $0x8,%esp
+  8012af:	68 00 04 00 00       	push   $0x400
+  8012b4:	53                   	push   %ebx
+  8012b5:	e8 ff f3 ff ff       	call   8006b9 <sys_futex_wake>
+  8012ba:	83 c4 10             	add    $0x10,%esp
+  8012bd:	eb dc                	jmp    80129b <devpipe_read+0xfc>
+			return 0;
+  8012bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c4:	eb d7                	jmp    80129d <devpipe_read+0xfe>
+
+008012c6 <devpipe_write>:
+{
+  8012c6:	55                   	push   %ebp
+  8012c7:	89 e5                	mov    %esp,%ebp
+  8012c9:	57                   	push   %edi
+  8012ca:	56                   	push   %esi
+  8012cb:	53                   	push   %ebx
+  8012cc:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8012cf:	ff 75 08             	push   0x8(%ebp)
+  8012d2:	e8 64 f4 ff ff       	call   80073b <fd2data>
+  8012d7:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8012d9:	83 c4 10             	add    $0x10,%esp
+  8012dc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8012e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8012e6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8012e9:	0f 83 23 01 00 00    	jae    801412 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8012ef:	8b 77 04             	mov    0x4(%edi),%esi
+  8012f2:	8b 1f                	mov    (%edi),%ebx
+  8012f4:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  8012fa:	29 d9                	sub    %ebx,%ecx
+  8012fc:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801301:	f7 e1                	mul    %ecx
+  801303:	c1 ea 0c             	shr    $0xc,%edx
+  801306:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80130c:	29 c1                	sub    %eax,%ecx
+  80130e:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801310:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801316:	75 40                	jne    801358 <devpipe_write+0x92>
+			ref = pageref(p);
+  801318:	83 ec 0c             	sub    $0xc,%esp
+  80131b:	57                   	push   %edi
+  80131c:	e8 2e 11 00 00       	call   80244f <pageref>
+  801321:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801323:	89 fa                	mov    %edi,%edx
+  801325:	8b 45 08             	mov    0x8(%ebp),%eax
+  801328:	e8 0d fe ff ff       	call   80113a <_pipeisclosed>
+  80132d:	83 c4 10             	add    $0x10,%esp
+  801330:	85 c0                	test   %eax,%eax
+  801332:	0f 85 d5 00 00 00    	jne    80140d <devpipe_write+0x147>
+	*sleeping = 1;
+  801338:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  80133f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801344:	39 1f                	cmp    %ebx,(%edi)
+  801346:	75 a7                	jne    8012ef <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801348:	83 ec 04             	sub    $0x4,%esp
+  80134b:	56                   	push   %esi
+  80134c:	53                   	push   %ebx
+  80134d:	57                   	push   %edi
+  80134e:	e8 16 f3 ff ff       	call   800669 <sys_futex_wait>
+  801353:	83 c4 10             	add    $0x10,%esp
+  801356:	eb 97                	jmp    8012ef <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801358:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80135b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80135e:	29 c1                	sub    %eax,%ecx
+  801360:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801365:	89 d8                	mov    %ebx,%eax
+  801367:	29 d0                	sub    %edx,%eax
+  801369:	39 c1                	cmp    %eax,%ecx
+  80136b:	0f 46 c1             	cmovbe %ecx,%eax
+  80136e:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801370:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801375:	f7 e6                	mul    %esi
+  801377:	c1 ea 0b             	shr    $0xb,%edx
+  80137a:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801380:	29 c6                	sub    %eax,%esi
+  801382:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801384:	29 f3                	sub    %esi,%ebx
+  801386:	39 cb                	cmp    %ecx,%ebx
+  801388:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80138b:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  80138e:	8d 77 10             	lea    0x10(%edi),%esi
+  801391:	83 ec 04             	sub    $0x4,%esp
+  801394:	53                   	push   %ebx
+  801395:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801398:	03 45 0c             	add    0xc(%ebp),%eax
+  80139b:	50                   	push   %eax
+  80139c:	01 f2                	add    %esi,%edx
+  80139e:	52                   	push   %edx
+  80139f:	e8 af 0b 00 00       	call   801f53 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8013a4:	83 c4 0c             	add    $0xc,%esp
+  8013a7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013aa:	29 d8                	sub    %ebx,%eax
+  8013ac:	50                   	push   %eax
+  8013ad:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8013b0:	01 d3                	add    %edx,%ebx
+  8013b2:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8013b5:	53                   	push   %ebx
+  8013b6:	56                   	push   %esi
+  8013b7:	e8 97 0b 00 00       	call   801f53 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8013bc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8013bf:	03 4f 04             	add    0x4(%edi),%ecx
+  8013c2:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8013c7:	f7 e1                	mul    %ecx
+  8013c9:	c1 ea 0c             	shr    $0xc,%edx
+  8013cc:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8013d2:	29 d1                	sub    %edx,%ecx
+  8013d4:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8013d7:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8013dc:	83 c4 10             	add    $0x10,%esp
+  8013df:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8013e3:	75 0b                	jne    8013f0 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8013e5:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8013e8:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8013eb:	e9 f3 fe ff ff       	jmp    8012e3 <devpipe_write+0x1d>
+		*sleeping = 0;
+  8013f0:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8013f7:	83 ec 08             	sub    $0x8,%esp
+  8013fa:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  8013ff:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  801402:	50                   	push   %eax
+  801403:	e8 b1 f2 ff ff       	call   8006b9 <sys_futex_wake>
+  801408:	83 c4 10             	add    $0x10,%esp
+  80140b:	eb d8                	jmp    8013e5 <devpipe_write+0x11f>
+				return 0;
+  80140d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801412:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801415:	5b                   	pop    %ebx
+  801416:	5e                   	pop    %esi
+  801417:	5f                   	pop    %edi
+  801418:	5d                   	pop    %ebp
+  801419:	c3                   	ret
+
+0080141a <pipe>:
+{
+  80141a:	55                   	push   %ebp
+  80141b:	89 e5                	mov    %esp,%ebp
+  80141d:	56                   	push   %esi
+  80141e:	53                   	push   %ebx
+  80141f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801422:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801425:	50                   	push   %eax
+  801426:	e8 27 f3 ff ff       	call   800752 <fd_alloc>
+  80142b:	89 c3                	mov    %eax,%ebx
+  80142d:	83 c4 10             	add    $0x10,%esp
+  801430:	85 c0                	test   %eax,%eax
+  801432:	0f 88 23 01 00 00    	js     80155b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801438:	83 ec 04             	sub    $0x4,%esp
+  80143b:	68 07 04 00 00       	push   $0x407
+  801440:	ff 75 f4             	push   -0xc(%ebp)
+  801443:	6a 00                	push   $0x0
+  801445:	e8 46 ed ff ff       	call   800190 <sys_page_alloc>
+  80144a:	89 c3                	mov    %eax,%ebx
+  80144c:	83 c4 10             	add    $0x10,%esp
+  80144f:	85 c0                	test   %eax,%eax
+  801451:	0f 88 04 01 00 00    	js     80155b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801457:	83 ec 0c             	sub    $0xc,%esp
+  80145a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80145d:	50                   	push   %eax
+  80145e:	e8 ef f2 ff ff       	call   800752 <fd_alloc>
+  801463:	89 c3                	mov    %eax,%ebx
+  801465:	83 c4 10             	add    $0x10,%esp
+  801468:	85 c0                	test   %eax,%eax
+  80146a:	0f 88 db 00 00 00    	js     80154b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801470:	83 ec 04             	sub    $0x4,%esp
+  801473:	68 07 04 00 00       	push   $0x407
+  801478:	ff 75 f0             	push   -0x10(%ebp)
+  80147b:	6a 00                	push   $0x0
+  80147d:	e8 0e ed ff ff       	call   800190 <sys_page_alloc>
+  801482:	89 c3                	mov    %eax,%ebx
+  801484:	83 c4 10             	add    $0x10,%esp
+  801487:	85 c0                	test   %eax,%eax
+  801489:	0f 88 bc 00 00 00    	js     80154b <pipe+0x131>
+	va = fd2data(fd0);
+  80148f:	83 ec 0c             	sub    $0xc,%esp
+  801492:	ff 75 f4             	push   -0xc(%ebp)
+  801495:	e8 a1 f2 ff ff       	call   80073b <fd2data>
+  80149a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80149c:	83 c4 0c             	add    $0xc,%esp
+  80149f:	68 07 04 00 00       	push   $0x407
+  8014a4:	50                   	push   %eax
+  8014a5:	6a 00                	push   $0x0
+  8014a7:	e8 e4 ec ff ff       	call   800190 <sys_page_alloc>
+  8014ac:	89 c3                	mov    %eax,%ebx
+  8014ae:	83 c4 10             	add    $0x10,%esp
+  8014b1:	85 c0                	test   %eax,%eax
+  8014b3:	0f 88 82 00 00 00    	js     80153b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014b9:	83 ec 0c             	sub    $0xc,%esp
+  8014bc:	ff 75 f0             	push   -0x10(%ebp)
+  8014bf:	e8 77 f2 ff ff       	call   80073b <fd2data>
+  8014c4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8014cb:	50                   	push   %eax
+  8014cc:	6a 00                	push   $0x0
+  8014ce:	56                   	push   %esi
+  8014cf:	6a 00                	push   $0x0
+  8014d1:	e8 fd ec ff ff       	call   8001d3 <sys_page_map>
+  8014d6:	89 c3                	mov    %eax,%ebx
+  8014d8:	83 c4 20             	add    $0x20,%esp
+  8014db:	85 c0                	test   %eax,%eax
+  8014dd:	78 4e                	js     80152d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8014df:	a1 20 30 80 00       	mov    0x803020,%eax
+  8014e4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014e7:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8014e9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014ec:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8014f3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8014f6:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8014f8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8014fb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801502:	83 ec 0c             	sub    $0xc,%esp
+  801505:	ff 75 f4             	push   -0xc(%ebp)
+  801508:	e8 1e f2 ff ff       	call   80072b <fd2num>
+  80150d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801510:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801512:	83 c4 04             	add    $0x4,%esp
+  801515:	ff 75 f0             	push   -0x10(%ebp)
+  801518:	e8 0e f2 ff ff       	call   80072b <fd2num>
+  80151d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801520:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801523:	83 c4 10             	add    $0x10,%esp
+  801526:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80152b:	eb 2e                	jmp    80155b <pipe+0x141>
+	sys_page_unmap(0, va);
+  80152d:	83 ec 08             	sub    $0x8,%esp
+  801530:	56                   	push   %esi
+  801531:	6a 00                	push   $0x0
+  801533:	e8 dd ec ff ff       	call   800215 <sys_page_unmap>
+  801538:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80153b:	83 ec 08             	sub    $0x8,%esp
+  80153e:	ff 75 f0             	push   -0x10(%ebp)
+  801541:	6a 00                	push   $0x0
+  801543:	e8 cd ec ff ff       	call   800215 <sys_page_unmap>
+  801548:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80154b:	83 ec 08             	sub    $0x8,%esp
+  80154e:	ff 75 f4             	push   -0xc(%ebp)
+  801551:	6a 00                	push   $0x0
+  801553:	e8 bd ec ff ff       	call   800215 <sys_page_unmap>
+  801558:	83 c4 10             	add    $0x10,%esp
+}
+  80155b:	89 d8                	mov    %ebx,%eax
+  80155d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801560:	5b                   	pop    %ebx
+  801561:	5e                   	pop    %esi
+  801562:	5d                   	pop    %ebp
+  801563:	c3                   	ret
+
+00801564 <pipeisclosed>:
+{
+  801564:	55                   	push   %ebp
+  801565:	89 e5                	mov    %esp,%ebp
+  801567:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80156a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80156d:	50                   	push   %eax
+  80156e:	ff 75 08             	push   0x8(%ebp)
+  801571:	e8 30 f2 ff ff       	call   8007a6 <fd_lookup>
+  801576:	83 c4 10             	add    $0x10,%esp
+  801579:	85 c0                	test   %eax,%eax
+  80157b:	78 18                	js     801595 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80157d:	83 ec 0c             	sub    $0xc,%esp
+  801580:	ff 75 f4             	push   -0xc(%ebp)
+  801583:	e8 b3 f1 ff ff       	call   80073b <fd2data>
+  801588:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80158a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80158d:	e8 a8 fb ff ff       	call   80113a <_pipeisclosed>
+  801592:	83 c4 10             	add    $0x10,%esp
+}
+  801595:	c9                   	leave
+  801596:	c3                   	ret
+
+00801597 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801597:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159c:	c3                   	ret
+
+0080159d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80159d:	55                   	push   %ebp
+  80159e:	89 e5                	mov    %esp,%ebp
+  8015a0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8015a3:	68 b6 27 80 00       	push   $0x8027b6
+  8015a8:	ff 75 0c             	push   0xc(%ebp)
+  8015ab:	e8 1d 08 00 00       	call   801dcd <strcpy>
+	return 0;
+}
+  8015b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b5:	c9                   	leave
+  8015b6:	c3                   	ret
+
+008015b7 <devcons_write>:
+{
+  8015b7:	55                   	push   %ebp
+  8015b8:	89 e5                	mov    %esp,%ebp
+  8015ba:	57                   	push   %edi
+  8015bb:	56                   	push   %esi
+  8015bc:	53                   	push   %ebx
+  8015bd:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8015c3:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8015c8:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8015ce:	eb 2e                	jmp    8015fe <devcons_write+0x47>
+		m = n - tot;
+  8015d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015d3:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8015d5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8015da:	39 c3                	cmp    %eax,%ebx
+  8015dc:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8015df:	83 ec 04             	sub    $0x4,%esp
+  8015e2:	53                   	push   %ebx
+  8015e3:	89 f0                	mov    %esi,%eax
+  8015e5:	03 45 0c             	add    0xc(%ebp),%eax
+  8015e8:	50                   	push   %eax
+  8015e9:	57                   	push   %edi
+  8015ea:	e8 64 09 00 00       	call   801f53 <memmove>
+		sys_cputs(buf, m);
+  8015ef:	83 c4 08             	add    $0x8,%esp
+  8015f2:	53                   	push   %ebx
+  8015f3:	57                   	push   %edi
+  8015f4:	e8 ca ea ff ff       	call   8000c3 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8015f9:	01 de                	add    %ebx,%esi
+  8015fb:	83 c4 10             	add    $0x10,%esp
+  8015fe:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801601:	72 cd                	jb     8015d0 <devcons_write+0x19>
+}
+  801603:	89 f0                	mov    %esi,%eax
+  801605:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801608:	5b                   	pop    %ebx
+  801609:	5e                   	pop    %esi
+  80160a:	5f                   	pop    %edi
+  80160b:	5d                   	pop    %ebp
+  80160c:	c3                   	ret
+
+0080160d <devcons_read>:
+{
+  80160d:	55                   	push   %ebp
+  80160e:	89 e5                	mov    %esp,%ebp
+  801610:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801613:	b8 00 00 00 00       	mov    $0x0,%eax
+  801618:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80161c:	75 07                	jne    801625 <devcons_read+0x18>
+  80161e:	eb 1f                	jmp    80163f <devcons_read+0x32>
+		sys_yield();
+  801620:	e8 4c eb ff ff       	call   800171 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801625:	e8 c8 ea ff ff       	call   8000f2 <sys_cgetc>
+  80162a:	85 c0                	test   %eax,%eax
+  80162c:	74 f2                	je     801620 <devcons_read+0x13>
+	if (c < 0)
+  80162e:	78 0f                	js     80163f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801630:	83 f8 04             	cmp    $0x4,%eax
+  801633:	74 0c                	je     801641 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801635:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801638:	88 02                	mov    %al,(%edx)
+	return 1;
+  80163a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80163f:	c9                   	leave
+  801640:	c3                   	ret
+		return 0;
+  801641:	b8 00 00 00 00       	mov    $0x0,%eax
+  801646:	eb f7                	jmp    80163f <devcons_read+0x32>
+
+00801648 <cputchar>:
+{
+  801648:	55                   	push   %ebp
+  801649:	89 e5                	mov    %esp,%ebp
+  80164b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80164e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801651:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801654:	6a 01                	push   $0x1
+  801656:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801659:	50                   	push   %eax
+  80165a:	e8 64 ea ff ff       	call   8000c3 <sys_cputs>
+}
+  80165f:	83 c4 10             	add    $0x10,%esp
+  801662:	c9                   	leave
+  801663:	c3                   	ret
+
+00801664 <getchar>:
+{
+  801664:	55                   	push   %ebp
+  801665:	89 e5                	mov    %esp,%ebp
+  801667:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80166a:	6a 01                	push   $0x1
+  80166c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80166f:	50                   	push   %eax
+  801670:	6a 00                	push   $0x0
+  801672:	e8 8e f3 ff ff       	call   800a05 <read>
+	if (r < 0)
+  801677:	83 c4 10             	add    $0x10,%esp
+  80167a:	85 c0                	test   %eax,%eax
+  80167c:	78 06                	js     801684 <getchar+0x20>
+	if (r < 1)
+  80167e:	74 06                	je     801686 <getchar+0x22>
+	return c;
+  801680:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801684:	c9                   	leave
+  801685:	c3                   	ret
+		return -E_EOF;
+  801686:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80168b:	eb f7                	jmp    801684 <getchar+0x20>
+
+0080168d <iscons>:
+{
+  80168d:	55                   	push   %ebp
+  80168e:	89 e5                	mov    %esp,%ebp
+  801690:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801693:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801696:	50                   	push   %eax
+  801697:	ff 75 08             	push   0x8(%ebp)
+  80169a:	e8 07 f1 ff ff       	call   8007a6 <fd_lookup>
+  80169f:	83 c4 10             	add    $0x10,%esp
+  8016a2:	85 c0                	test   %eax,%eax
+  8016a4:	78 11                	js     8016b7 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8016a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016a9:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  8016af:	39 10                	cmp    %edx,(%eax)
+  8016b1:	0f 94 c0             	sete   %al
+  8016b4:	0f b6 c0             	movzbl %al,%eax
+}
+  8016b7:	c9                   	leave
+  8016b8:	c3                   	ret
+
+008016b9 <opencons>:
+{
+  8016b9:	55                   	push   %ebp
+  8016ba:	89 e5                	mov    %esp,%ebp
+  8016bc:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8016bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c2:	50                   	push   %eax
+  8016c3:	e8 8a f0 ff ff       	call   800752 <fd_alloc>
+  8016c8:	83 c4 10             	add    $0x10,%esp
+  8016cb:	85 c0                	test   %eax,%eax
+  8016cd:	78 3a                	js     801709 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8016cf:	83 ec 04             	sub    $0x4,%esp
+  8016d2:	68 07 04 00 00       	push   $0x407
+  8016d7:	ff 75 f4             	push   -0xc(%ebp)
+  8016da:	6a 00                	push   $0x0
+  8016dc:	e8 af ea ff ff       	call   800190 <sys_page_alloc>
+  8016e1:	83 c4 10             	add    $0x10,%esp
+  8016e4:	85 c0                	test   %eax,%eax
+  8016e6:	78 21                	js     801709 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8016e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016eb:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  8016f1:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8016f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8016fd:	83 ec 0c             	sub    $0xc,%esp
+  801700:	50                   	push   %eax
+  801701:	e8 25 f0 ff ff       	call   80072b <fd2num>
+  801706:	83 c4 10             	add    $0x10,%esp
+}
+  801709:	c9                   	leave
+  80170a:	c3                   	ret
+
+0080170b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80170b:	55                   	push   %ebp
+  80170c:	89 e5                	mov    %esp,%ebp
+  80170e:	56                   	push   %esi
+  80170f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801710:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801713:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801719:	e8 34 ea ff ff       	call   800152 <sys_getenvid>
+  80171e:	83 ec 0c             	sub    $0xc,%esp
+  801721:	ff 75 0c             	push   0xc(%ebp)
+  801724:	ff 75 08             	push   0x8(%ebp)
+  801727:	56                   	push   %esi
+  801728:	50                   	push   %eax
+  801729:	68 c4 27 80 00       	push   $0x8027c4
+  80172e:	e8 b3 00 00 00       	call   8017e6 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801733:	83 c4 18             	add    $0x18,%esp
+  801736:	53                   	push   %ebx
+  801737:	ff 75 10             	push   0x10(%ebp)
+  80173a:	e8 56 00 00 00       	call   801795 <vcprintf>
+	cprintf("\n");
+  80173f:	c7 04 24 af 27 80 00 	movl   $0x8027af,(%esp)
+  801746:	e8 9b 00 00 00       	call   8017e6 <cprintf>
+  80174b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80174e:	cc                   	int3
+	while (1)
+  80174f:	eb fd                	jmp    80174e <_panic+0x43>
+
+00801751 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801751:	55                   	push   %ebp
+  801752:	89 e5                	mov    %esp,%ebp
+  801754:	53                   	push   %ebx
+  801755:	83 ec 04             	sub    $0x4,%esp
+  801758:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80175b:	8b 13                	mov    (%ebx),%edx
+  80175d:	8d 42 01             	lea    0x1(%edx),%eax
+  801760:	89 03                	mov    %eax,(%ebx)
+  801762:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801765:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801769:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80176e:	74 09                	je     801779 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  801770:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801774:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801777:	c9                   	leave
+  801778:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  801779:	83 ec 08             	sub    $0x8,%esp
+  80177c:	68 ff 00 00 00       	push   $0xff
+  801781:	8d 43 08             	lea    0x8(%ebx),%eax
+  801784:	50                   	push   %eax
+  801785:	e8 39 e9 ff ff       	call   8000c3 <sys_cputs>
+		b->idx = 0;
+  80178a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801790:	83 c4 10             	add    $0x10,%esp
+  801793:	eb db                	jmp    801770 <putch+0x1f>
+
+00801795 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  801795:	55                   	push   %ebp
+  801796:	89 e5                	mov    %esp,%ebp
+  801798:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80179e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017a5:	00 00 00 
+	b.cnt = 0;
+  8017a8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8017af:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8017b2:	ff 75 0c             	push   0xc(%ebp)
+  8017b5:	ff 75 08             	push   0x8(%ebp)
+  8017b8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8017be:	50                   	push   %eax
+  8017bf:	68 51 17 80 00       	push   $0x801751
+  8017c4:	e8 14 01 00 00       	call   8018dd <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8017c9:	83 c4 08             	add    $0x8,%esp
+  8017cc:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8017d2:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8017d8:	50                   	push   %eax
+  8017d9:	e8 e5 e8 ff ff       	call   8000c3 <sys_cputs>
+
+	return b.cnt;
+}
+  8017de:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8017e4:	c9                   	leave
+  8017e5:	c3                   	ret
+
+008017e6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8017e6:	55                   	push   %ebp
+  8017e7:	89 e5                	mov    %esp,%ebp
+  8017e9:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8017ec:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8017ef:	50                   	push   %eax
+  8017f0:	ff 75 08             	push   0x8(%ebp)
+  8017f3:	e8 9d ff ff ff       	call   801795 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8017f8:	c9                   	leave
+  8017f9:	c3                   	ret
+
+008017fa <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8017fa:	55                   	push   %ebp
+  8017fb:	89 e5                	mov    %esp,%ebp
+  8017fd:	57                   	push   %edi
+  8017fe:	56                   	push   %esi
+  8017ff:	53                   	push   %ebx
+  801800:	83 ec 1c             	sub    $0x1c,%esp
+  801803:	89 c7                	mov    %eax,%edi
+  801805:	89 d6                	mov    %edx,%esi
+  801807:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80180d:	89 d1                	mov    %edx,%ecx
+  80180f:	89 c2                	mov    %eax,%edx
+  801811:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801814:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801817:	8b 45 10             	mov    0x10(%ebp),%eax
+  80181a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80181d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801820:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801827:	39 c2                	cmp    %eax,%edx
+  801829:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80182c:	72 3e                	jb     80186c <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80182e:	83 ec 0c             	sub    $0xc,%esp
+  801831:	ff 75 18             	push   0x18(%ebp)
+  801834:	83 eb 01             	sub    $0x1,%ebx
+  801837:	53                   	push   %ebx
+  801838:	50                   	push   %eax
+  801839:	83 ec 08             	sub    $0x8,%esp
+  80183c:	ff 75 e4             	push   -0x1c(%ebp)
+  80183f:	ff 75 e0             	push   -0x20(%ebp)
+  801842:	ff 75 dc             	push   -0x24(%ebp)
+  801845:	ff 75 d8             	push   -0x28(%ebp)
+  801848:	e8 0f 0d 00 00       	call   80255c <__udivdi3>
+  80184d:	83 c4 18             	add    $0x18,%esp
+  801850:	52                   	push   %edx
+  801851:	50                   	push   %eax
+  801852:	89 f2                	mov    %esi,%edx
+  801854:	89 f8                	mov    %edi,%eax
+  801856:	e8 9f ff ff ff       	call   8017fa <printnum>
+  80185b:	83 c4 20             	add    $0x20,%esp
+  80185e:	eb 13                	jmp    801873 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801860:	83 ec 08             	sub    $0x8,%esp
+  801863:	56                   	push   %esi
+  801864:	ff 75 18             	push   0x18(%ebp)
+  801867:	ff d7                	call   *%edi
+  801869:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80186c:	83 eb 01             	sub    $0x1,%ebx
+  80186f:	85 db                	test   %ebx,%ebx
+  801871:	7f ed                	jg     801860 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801873:	83 ec 08             	sub    $0x8,%esp
+  801876:	56                   	push   %esi
+  801877:	83 ec 04             	sub    $0x4,%esp
+  80187a:	ff 75 e4             	push   -0x1c(%ebp)
+  80187d:	ff 75 e0             	push   -0x20(%ebp)
+  801880:	ff 75 dc             	push   -0x24(%ebp)
+  801883:	ff 75 d8             	push   -0x28(%ebp)
+  801886:	e8 ef 0c 00 00       	call   80257a <__umoddi3>
+  80188b:	83 c4 14             	add    $0x14,%esp
+  80188e:	0f be 80 e7 27 80 00 	movsbl 0x8027e7(%eax),%eax
+  801895:	50                   	push   %eax
+  801896:	ff d7                	call   *%edi
+}
+  801898:	83 c4 10             	add    $0x10,%esp
+  80189b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80189e:	5b                   	pop    %ebx
+  80189f:	5e                   	pop    %esi
+  8018a0:	5f                   	pop    %edi
+  8018a1:	5d                   	pop    %ebp
+  8018a2:	c3                   	ret
+
+008018a3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8018a3:	55                   	push   %ebp
+  8018a4:	89 e5                	mov    %esp,%ebp
+  8018a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8018a9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8018ad:	8b 10                	mov    (%eax),%edx
+  8018af:	3b 50 04             	cmp    0x4(%eax),%edx
+  8018b2:	73 0a                	jae    8018be <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8018b4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8018b7:	89 08                	mov    %ecx,(%eax)
+  8018b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018bc:	88 02                	mov    %al,(%edx)
+}
+  8018be:	5d                   	pop    %ebp
+  8018bf:	c3                   	ret
+
+008018c0 <printfmt>:
+{
+  8018c0:	55                   	push   %ebp
+  8018c1:	89 e5                	mov    %esp,%ebp
+  8018c3:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8018c6:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8018c9:	50                   	push   %eax
+  8018ca:	ff 75 10             	push   0x10(%ebp)
+  8018cd:	ff 75 0c             	push   0xc(%ebp)
+  8018d0:	ff 75 08             	push   0x8(%ebp)
+  8018d3:	e8 05 00 00 00       	call   8018dd <vprintfmt>
+}
+  8018d8:	83 c4 10             	add    $0x10,%esp
+  8018db:	c9                   	leave
+  8018dc:	c3                   	ret
+
+008018dd <vprintfmt>:
+{
+  8018dd:	55                   	push   %ebp
+  8018de:	89 e5                	mov    %esp,%ebp
+  8018e0:	57                   	push   %edi
+  8018e1:	56                   	push   %esi
+  8018e2:	53                   	push   %ebx
+  8018e3:	83 ec 2c             	sub    $0x2c,%esp
+  8018e6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8018ec:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8018ef:	eb 0a                	jmp    8018fb <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8018f1:	83 ec 08             	sub    $0x8,%esp
+  8018f4:	53                   	push   %ebx
+  8018f5:	50                   	push   %eax
+  8018f6:	ff d6                	call   *%esi
+  8018f8:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8018fb:	83 c7 01             	add    $0x1,%edi
+  8018fe:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801902:	83 f8 25             	cmp    $0x25,%eax
+  801905:	74 0c                	je     801913 <vprintfmt+0x36>
+			if (ch == '\0')
+  801907:	85 c0                	test   %eax,%eax
+  801909:	75 e6                	jne    8018f1 <vprintfmt+0x14>
+}
+  80190b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80190e:	5b                   	pop    %ebx
+  80190f:	5e                   	pop    %esi
+  801910:	5f                   	pop    %edi
+  801911:	5d                   	pop    %ebp
+  801912:	c3                   	ret
+		padc = ' ';
+  801913:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801917:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80191e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801925:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80192c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801931:	8d 47 01             	lea    0x1(%edi),%eax
+  801934:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801937:	0f b6 17             	movzbl (%edi),%edx
+  80193a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80193d:	3c 55                	cmp    $0x55,%al
+  80193f:	0f 87 c5 03 00 00    	ja     801d0a <vprintfmt+0x42d>
+  801945:	0f b6 c0             	movzbl %al,%eax
+  801948:	ff 24 85 60 29 80 00 	jmp    *0x802960(,%eax,4)
+  80194f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801952:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801956:	eb d9                	jmp    801931 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801958:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80195b:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80195f:	eb d0                	jmp    801931 <vprintfmt+0x54>
+  801961:	0f b6 d2             	movzbl %dl,%edx
+  801964:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801967:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80196f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801972:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801976:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801979:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80197c:	83 f9 09             	cmp    $0x9,%ecx
+  80197f:	77 55                	ja     8019d6 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801981:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801984:	eb e9                	jmp    80196f <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801986:	8b 45 14             	mov    0x14(%ebp),%eax
+  801989:	8b 00                	mov    (%eax),%eax
+  80198b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80198e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801991:	8d 40 04             	lea    0x4(%eax),%eax
+  801994:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801997:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80199a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80199e:	79 91                	jns    801931 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8019a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8019a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019a6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8019ad:	eb 82                	jmp    801931 <vprintfmt+0x54>
+			if (width < 0)
+  8019af:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8019b2:	85 d2                	test   %edx,%edx
+  8019b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b9:	0f 49 c2             	cmovns %edx,%eax
+  8019bc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019bf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019c2:	e9 6a ff ff ff       	jmp    801931 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8019c7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8019ca:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8019d1:	e9 5b ff ff ff       	jmp    801931 <vprintfmt+0x54>
+  8019d6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019d9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019dc:	eb bc                	jmp    80199a <vprintfmt+0xbd>
+			lflag++;
+  8019de:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8019e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019e4:	e9 48 ff ff ff       	jmp    801931 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8019e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019ec:	8d 78 04             	lea    0x4(%eax),%edi
+  8019ef:	83 ec 08             	sub    $0x8,%esp
+  8019f2:	53                   	push   %ebx
+  8019f3:	ff 30                	push   (%eax)
+  8019f5:	ff d6                	call   *%esi
+			break;
+  8019f7:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8019fa:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8019fd:	e9 63 02 00 00       	jmp    801c65 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  801a02:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a05:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801a08:	8b 10                	mov    (%eax),%edx
+  801a0a:	89 d0                	mov    %edx,%eax
+  801a0c:	f7 d8                	neg    %eax
+  801a0e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801a11:	83 f8 12             	cmp    $0x12,%eax
+  801a14:	7f 23                	jg     801a39 <vprintfmt+0x15c>
+  801a16:	8b 14 85 c0 2a 80 00 	mov    0x802ac0(,%eax,4),%edx
+  801a1d:	85 d2                	test   %edx,%edx
+  801a1f:	74 18                	je     801a39 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801a21:	52                   	push   %edx
+  801a22:	68 7d 27 80 00       	push   $0x80277d
+  801a27:	53                   	push   %ebx
+  801a28:	56                   	push   %esi
+  801a29:	e8 92 fe ff ff       	call   8018c0 <printfmt>
+  801a2e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a31:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801a34:	e9 2c 02 00 00       	jmp    801c65 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  801a39:	50                   	push   %eax
+  801a3a:	68 ff 27 80 00       	push   $0x8027ff
+  801a3f:	53                   	push   %ebx
+  801a40:	56                   	push   %esi
+  801a41:	e8 7a fe ff ff       	call   8018c0 <printfmt>
+  801a46:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a49:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801a4c:	e9 14 02 00 00       	jmp    801c65 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801a51:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a54:	83 c0 04             	add    $0x4,%eax
+  801a57:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801a5a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a5d:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801a5f:	85 c9                	test   %ecx,%ecx
+  801a61:	b8 f8 27 80 00       	mov    $0x8027f8,%eax
+  801a66:	0f 45 c1             	cmovne %ecx,%eax
+  801a69:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801a6c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801a70:	7e 06                	jle    801a78 <vprintfmt+0x19b>
+  801a72:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801a76:	75 0b                	jne    801a83 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801a78:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801a7b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801a7e:	89 75 08             	mov    %esi,0x8(%ebp)
+  801a81:	eb 5c                	jmp    801adf <vprintfmt+0x202>
+  801a83:	83 ec 08             	sub    $0x8,%esp
+  801a86:	ff 75 d0             	push   -0x30(%ebp)
+  801a89:	ff 75 cc             	push   -0x34(%ebp)
+  801a8c:	e8 19 03 00 00       	call   801daa <strnlen>
+  801a91:	89 c2                	mov    %eax,%edx
+  801a93:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a96:	29 d0                	sub    %edx,%eax
+  801a98:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801a9b:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801a9f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801aa2:	89 75 08             	mov    %esi,0x8(%ebp)
+  801aa5:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801aa7:	eb 0e                	jmp    801ab7 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801aa9:	83 ec 08             	sub    $0x8,%esp
+  801aac:	53                   	push   %ebx
+  801aad:	57                   	push   %edi
+  801aae:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ab1:	83 ee 01             	sub    $0x1,%esi
+  801ab4:	83 c4 10             	add    $0x10,%esp
+  801ab7:	85 f6                	test   %esi,%esi
+  801ab9:	7f ee                	jg     801aa9 <vprintfmt+0x1cc>
+  801abb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801abe:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ac1:	85 c0                	test   %eax,%eax
+  801ac3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac8:	0f 49 d0             	cmovns %eax,%edx
+  801acb:	29 d0                	sub    %edx,%eax
+  801acd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ad0:	eb a6                	jmp    801a78 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801ad2:	83 ec 08             	sub    $0x8,%esp
+  801ad5:	53                   	push   %ebx
+  801ad6:	52                   	push   %edx
+  801ad7:	ff 55 08             	call   *0x8(%ebp)
+  801ada:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801add:	89 f1                	mov    %esi,%ecx
+  801adf:	8d 71 01             	lea    0x1(%ecx),%esi
+  801ae2:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801ae6:	0f be d0             	movsbl %al,%edx
+  801ae9:	85 d2                	test   %edx,%edx
+  801aeb:	74 28                	je     801b15 <vprintfmt+0x238>
+  801aed:	85 ff                	test   %edi,%edi
+  801aef:	78 05                	js     801af6 <vprintfmt+0x219>
+  801af1:	83 ef 01             	sub    $0x1,%edi
+  801af4:	78 30                	js     801b26 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801af6:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801afa:	74 d6                	je     801ad2 <vprintfmt+0x1f5>
+  801afc:	0f be c0             	movsbl %al,%eax
+  801aff:	83 e8 20             	sub    $0x20,%eax
+  801b02:	83 f8 5e             	cmp    $0x5e,%eax
+  801b05:	76 cb                	jbe    801ad2 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801b07:	83 ec 08             	sub    $0x8,%esp
+  801b0a:	53                   	push   %ebx
+  801b0b:	6a 3f                	push   $0x3f
+  801b0d:	ff 55 08             	call   *0x8(%ebp)
+  801b10:	83 c4 10             	add    $0x10,%esp
+  801b13:	eb c8                	jmp    801add <vprintfmt+0x200>
+  801b15:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b18:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b1b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801b1e:	01 d0                	add    %edx,%eax
+  801b20:	29 c8                	sub    %ecx,%eax
+  801b22:	89 c7                	mov    %eax,%edi
+  801b24:	eb 13                	jmp    801b39 <vprintfmt+0x25c>
+  801b26:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b29:	eb ed                	jmp    801b18 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801b2b:	83 ec 08             	sub    $0x8,%esp
+  801b2e:	53                   	push   %ebx
+  801b2f:	6a 20                	push   $0x20
+  801b31:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801b33:	83 ef 01             	sub    $0x1,%edi
+  801b36:	83 c4 10             	add    $0x10,%esp
+  801b39:	85 ff                	test   %edi,%edi
+  801b3b:	7f ee                	jg     801b2b <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801b3d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b40:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b43:	e9 1d 01 00 00       	jmp    801c65 <vprintfmt+0x388>
+	if (lflag >= 2)
+  801b48:	83 f9 01             	cmp    $0x1,%ecx
+  801b4b:	7f 1b                	jg     801b68 <vprintfmt+0x28b>
+	else if (lflag)
+  801b4d:	85 c9                	test   %ecx,%ecx
+  801b4f:	74 63                	je     801bb4 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  801b51:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b54:	8b 00                	mov    (%eax),%eax
+  801b56:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b59:	99                   	cltd
+  801b5a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b5d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b60:	8d 40 04             	lea    0x4(%eax),%eax
+  801b63:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b66:	eb 17                	jmp    801b7f <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  801b68:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b6b:	8b 50 04             	mov    0x4(%eax),%edx
+  801b6e:	8b 00                	mov    (%eax),%eax
+  801b70:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b73:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b76:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b79:	8d 40 08             	lea    0x8(%eax),%eax
+  801b7c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801b7f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b82:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801b85:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801b8a:	85 c9                	test   %ecx,%ecx
+  801b8c:	0f 89 b9 00 00 00    	jns    801c4b <vprintfmt+0x36e>
+				putch('-', putdat);
+  801b92:	83 ec 08             	sub    $0x8,%esp
+  801b95:	53                   	push   %ebx
+  801b96:	6a 2d                	push   $0x2d
+  801b98:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801b9a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b9d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801ba0:	f7 da                	neg    %edx
+  801ba2:	83 d1 00             	adc    $0x0,%ecx
+  801ba5:	f7 d9                	neg    %ecx
+  801ba7:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801baa:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801baf:	e9 97 00 00 00       	jmp    801c4b <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  801bb4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bb7:	8b 00                	mov    (%eax),%eax
+  801bb9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bbc:	99                   	cltd
+  801bbd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801bc0:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bc3:	8d 40 04             	lea    0x4(%eax),%eax
+  801bc6:	89 45 14             	mov    %eax,0x14(%ebp)
+  801bc9:	eb b4                	jmp    801b7f <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  801bcb:	83 f9 01             	cmp    $0x1,%ecx
+  801bce:	7f 1b                	jg     801beb <vprintfmt+0x30e>
+	else if (lflag)
+  801bd0:	85 c9                	test   %ecx,%ecx
+  801bd2:	74 2c                	je     801c00 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  801bd4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bd7:	8b 10                	mov    (%eax),%edx
+  801bd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bde:	8d 40 04             	lea    0x4(%eax),%eax
+  801be1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801be4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801be9:	eb 60                	jmp    801c4b <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801beb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bee:	8b 10                	mov    (%eax),%edx
+  801bf0:	8b 48 04             	mov    0x4(%eax),%ecx
+  801bf3:	8d 40 08             	lea    0x8(%eax),%eax
+  801bf6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801bf9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801bfe:	eb 4b                	jmp    801c4b <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  801c00:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c03:	8b 10                	mov    (%eax),%edx
+  801c05:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c0a:	8d 40 04             	lea    0x4(%eax),%eax
+  801c0d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c10:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801c15:	eb 34                	jmp    801c4b <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801c17:	83 f9 01             	cmp    $0x1,%ecx
+  801c1a:	7f 15                	jg     801c31 <vprintfmt+0x354>
+	else if (lflag)
+  801c1c:	85 c9                	test   %ecx,%ecx
+  801c1e:	74 4d                	je     801c6d <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  801c20:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c23:	8b 00                	mov    (%eax),%eax
+  801c25:	99                   	cltd
+  801c26:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c29:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801c2c:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  801c2f:	eb 11                	jmp    801c42 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  801c31:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c34:	8b 50 04             	mov    0x4(%eax),%edx
+  801c37:	8b 00                	mov    (%eax),%eax
+  801c39:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c3c:	8d 49 08             	lea    0x8(%ecx),%ecx
+  801c3f:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  801c42:	89 d1                	mov    %edx,%ecx
+  801c44:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  801c46:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801c4b:	83 ec 0c             	sub    $0xc,%esp
+  801c4e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801c52:	50                   	push   %eax
+  801c53:	ff 75 e0             	push   -0x20(%ebp)
+  801c56:	57                   	push   %edi
+  801c57:	51                   	push   %ecx
+  801c58:	52                   	push   %edx
+  801c59:	89 da                	mov    %ebx,%edx
+  801c5b:	89 f0                	mov    %esi,%eax
+  801c5d:	e8 98 fb ff ff       	call   8017fa <printnum>
+			break;
+  801c62:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801c65:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801c68:	e9 8e fc ff ff       	jmp    8018fb <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  801c6d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c70:	8b 00                	mov    (%eax),%eax
+  801c72:	99                   	cltd
+  801c73:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c76:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801c79:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  801c7c:	eb c4                	jmp    801c42 <vprintfmt+0x365>
+			putch('0', putdat);
+  801c7e:	83 ec 08             	sub    $0x8,%esp
+  801c81:	53                   	push   %ebx
+  801c82:	6a 30                	push   $0x30
+  801c84:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801c86:	83 c4 08             	add    $0x8,%esp
+  801c89:	53                   	push   %ebx
+  801c8a:	6a 78                	push   $0x78
+  801c8c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801c8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c91:	8b 10                	mov    (%eax),%edx
+  801c93:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801c98:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801c9b:	8d 40 04             	lea    0x4(%eax),%eax
+  801c9e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ca1:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  801ca6:	eb a3                	jmp    801c4b <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801ca8:	83 f9 01             	cmp    $0x1,%ecx
+  801cab:	7f 1b                	jg     801cc8 <vprintfmt+0x3eb>
+	else if (lflag)
+  801cad:	85 c9                	test   %ecx,%ecx
+  801caf:	74 2f                	je     801ce0 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  801cb1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cb4:	8b 10                	mov    (%eax),%edx
+  801cb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cbb:	8d 40 04             	lea    0x4(%eax),%eax
+  801cbe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cc1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801cc6:	eb 83                	jmp    801c4b <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801cc8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ccb:	8b 10                	mov    (%eax),%edx
+  801ccd:	8b 48 04             	mov    0x4(%eax),%ecx
+  801cd0:	8d 40 08             	lea    0x8(%eax),%eax
+  801cd3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cd6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801cdb:	e9 6b ff ff ff       	jmp    801c4b <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  801ce0:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ce3:	8b 10                	mov    (%eax),%edx
+  801ce5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cea:	8d 40 04             	lea    0x4(%eax),%eax
+  801ced:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cf0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801cf5:	e9 51 ff ff ff       	jmp    801c4b <vprintfmt+0x36e>
+			putch(ch, putdat);
+  801cfa:	83 ec 08             	sub    $0x8,%esp
+  801cfd:	53                   	push   %ebx
+  801cfe:	6a 25                	push   $0x25
+  801d00:	ff d6                	call   *%esi
+			break;
+  801d02:	83 c4 10             	add    $0x10,%esp
+  801d05:	e9 5b ff ff ff       	jmp    801c65 <vprintfmt+0x388>
+			putch('%', putdat);
+  801d0a:	83 ec 08             	sub    $0x8,%esp
+  801d0d:	53                   	push   %ebx
+  801d0e:	6a 25                	push   $0x25
+  801d10:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801d12:	83 c4 10             	add    $0x10,%esp
+  801d15:	89 f8                	mov    %edi,%eax
+  801d17:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801d1b:	74 05                	je     801d22 <vprintfmt+0x445>
+  801d1d:	83 e8 01             	sub    $0x1,%eax
+  801d20:	eb f5                	jmp    801d17 <vprintfmt+0x43a>
+  801d22:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d25:	e9 3b ff ff ff       	jmp    801c65 <vprintfmt+0x388>
+
+00801d2a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801d2a:	55                   	push   %ebp
+  801d2b:	89 e5                	mov    %esp,%ebp
+  801d2d:	83 ec 18             	sub    $0x18,%esp
+  801d30:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d33:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801d36:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801d39:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801d3d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801d40:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	74 26                	je     801d71 <vsnprintf+0x47>
+  801d4b:	85 d2                	test   %edx,%edx
+  801d4d:	7e 22                	jle    801d71 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801d4f:	ff 75 14             	push   0x14(%ebp)
+  801d52:	ff 75 10             	push   0x10(%ebp)
+  801d55:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801d58:	50                   	push   %eax
+  801d59:	68 a3 18 80 00       	push   $0x8018a3
+  801d5e:	e8 7a fb ff ff       	call   8018dd <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801d63:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801d66:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801d69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d6c:	83 c4 10             	add    $0x10,%esp
+}
+  801d6f:	c9                   	leave
+  801d70:	c3                   	ret
+		return -E_INVAL;
+  801d71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d76:	eb f7                	jmp    801d6f <vsnprintf+0x45>
+
+00801d78 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801d78:	55                   	push   %ebp
+  801d79:	89 e5                	mov    %esp,%ebp
+  801d7b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801d7e:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801d81:	50                   	push   %eax
+  801d82:	ff 75 10             	push   0x10(%ebp)
+  801d85:	ff 75 0c             	push   0xc(%ebp)
+  801d88:	ff 75 08             	push   0x8(%ebp)
+  801d8b:	e8 9a ff ff ff       	call   801d2a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801d90:	c9                   	leave
+  801d91:	c3                   	ret
+
+00801d92 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801d92:	55                   	push   %ebp
+  801d93:	89 e5                	mov    %esp,%ebp
+  801d95:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801d98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9d:	eb 03                	jmp    801da2 <strlen+0x10>
+		n++;
+  801d9f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801da2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801da6:	75 f7                	jne    801d9f <strlen+0xd>
+	return n;
+}
+  801da8:	5d                   	pop    %ebp
+  801da9:	c3                   	ret
+
+00801daa <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801daa:	55                   	push   %ebp
+  801dab:	89 e5                	mov    %esp,%ebp
+  801dad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801db0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801db3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db8:	eb 03                	jmp    801dbd <strnlen+0x13>
+		n++;
+  801dba:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dbd:	39 d0                	cmp    %edx,%eax
+  801dbf:	74 08                	je     801dc9 <strnlen+0x1f>
+  801dc1:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801dc5:	75 f3                	jne    801dba <strnlen+0x10>
+  801dc7:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801dc9:	89 d0                	mov    %edx,%eax
+  801dcb:	5d                   	pop    %ebp
+  801dcc:	c3                   	ret
+
+00801dcd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801dcd:	55                   	push   %ebp
+  801dce:	89 e5                	mov    %esp,%ebp
+  801dd0:	53                   	push   %ebx
+  801dd1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801dd4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801dd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ddc:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801de0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801de3:	83 c0 01             	add    $0x1,%eax
+  801de6:	84 d2                	test   %dl,%dl
+  801de8:	75 f2                	jne    801ddc <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801dea:	89 c8                	mov    %ecx,%eax
+  801dec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801def:	c9                   	leave
+  801df0:	c3                   	ret
+
+00801df1 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801df1:	55                   	push   %ebp
+  801df2:	89 e5                	mov    %esp,%ebp
+  801df4:	53                   	push   %ebx
+  801df5:	83 ec 10             	sub    $0x10,%esp
+  801df8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801dfb:	53                   	push   %ebx
+  801dfc:	e8 91 ff ff ff       	call   801d92 <strlen>
+  801e01:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801e04:	ff 75 0c             	push   0xc(%ebp)
+  801e07:	01 d8                	add    %ebx,%eax
+  801e09:	50                   	push   %eax
+  801e0a:	e8 be ff ff ff       	call   801dcd <strcpy>
+	return dst;
+}
+  801e0f:	89 d8                	mov    %ebx,%eax
+  801e11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e14:	c9                   	leave
+  801e15:	c3                   	ret
+
+00801e16 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801e16:	55                   	push   %ebp
+  801e17:	89 e5                	mov    %esp,%ebp
+  801e19:	56                   	push   %esi
+  801e1a:	53                   	push   %ebx
+  801e1b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e1e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801e21:	89 f3                	mov    %esi,%ebx
+  801e23:	03 5d 10             	add    0x10(%ebp),%ebx
+  801e26:	89 f0                	mov    %esi,%eax
+  801e28:	eb 0f                	jmp    801e39 <strncpy+0x23>
+		*dst++ = *src;
+  801e2a:	83 c0 01             	add    $0x1,%eax
+  801e2d:	0f b6 0a             	movzbl (%edx),%ecx
+  801e30:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801e33:	80 f9 01             	cmp    $0x1,%cl
+  801e36:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801e39:	39 d8                	cmp    %ebx,%eax
+  801e3b:	75 ed                	jne    801e2a <strncpy+0x14>
+	}
+	return ret;
+}
+  801e3d:	89 f0                	mov    %esi,%eax
+  801e3f:	5b                   	pop    %ebx
+  801e40:	5e                   	pop    %esi
+  801e41:	5d                   	pop    %ebp
+  801e42:	c3                   	ret
+
+00801e43 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e43:	55                   	push   %ebp
+  801e44:	89 e5                	mov    %esp,%ebp
+  801e46:	56                   	push   %esi
+  801e47:	53                   	push   %ebx
+  801e48:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e4e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801e51:	89 f0                	mov    %esi,%eax
+  801e53:	85 d2                	test   %edx,%edx
+  801e55:	74 21                	je     801e78 <strlcpy+0x35>
+  801e57:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801e5b:	89 f2                	mov    %esi,%edx
+  801e5d:	eb 09                	jmp    801e68 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801e5f:	83 c1 01             	add    $0x1,%ecx
+  801e62:	83 c2 01             	add    $0x1,%edx
+  801e65:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801e68:	39 c2                	cmp    %eax,%edx
+  801e6a:	74 09                	je     801e75 <strlcpy+0x32>
+  801e6c:	0f b6 19             	movzbl (%ecx),%ebx
+  801e6f:	84 db                	test   %bl,%bl
+  801e71:	75 ec                	jne    801e5f <strlcpy+0x1c>
+  801e73:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801e75:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801e78:	29 f0                	sub    %esi,%eax
+}
+  801e7a:	5b                   	pop    %ebx
+  801e7b:	5e                   	pop    %esi
+  801e7c:	5d                   	pop    %ebp
+  801e7d:	c3                   	ret
+
+00801e7e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801e7e:	55                   	push   %ebp
+  801e7f:	89 e5                	mov    %esp,%ebp
+  801e81:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e84:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801e87:	eb 06                	jmp    801e8f <strcmp+0x11>
+		p++, q++;
+  801e89:	83 c1 01             	add    $0x1,%ecx
+  801e8c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801e8f:	0f b6 01             	movzbl (%ecx),%eax
+  801e92:	84 c0                	test   %al,%al
+  801e94:	74 04                	je     801e9a <strcmp+0x1c>
+  801e96:	3a 02                	cmp    (%edx),%al
+  801e98:	74 ef                	je     801e89 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801e9a:	0f b6 c0             	movzbl %al,%eax
+  801e9d:	0f b6 12             	movzbl (%edx),%edx
+  801ea0:	29 d0                	sub    %edx,%eax
+}
+  801ea2:	5d                   	pop    %ebp
+  801ea3:	c3                   	ret
+
+00801ea4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801ea4:	55                   	push   %ebp
+  801ea5:	89 e5                	mov    %esp,%ebp
+  801ea7:	53                   	push   %ebx
+  801ea8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eae:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801eb1:	eb 09                	jmp    801ebc <strncmp+0x18>
+		n--, p++, q++;
+  801eb3:	83 ea 01             	sub    $0x1,%edx
+  801eb6:	83 c0 01             	add    $0x1,%eax
+  801eb9:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801ebc:	85 d2                	test   %edx,%edx
+  801ebe:	74 18                	je     801ed8 <strncmp+0x34>
+  801ec0:	0f b6 18             	movzbl (%eax),%ebx
+  801ec3:	84 db                	test   %bl,%bl
+  801ec5:	74 04                	je     801ecb <strncmp+0x27>
+  801ec7:	3a 19                	cmp    (%ecx),%bl
+  801ec9:	74 e8                	je     801eb3 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ecb:	0f b6 00             	movzbl (%eax),%eax
+  801ece:	0f b6 11             	movzbl (%ecx),%edx
+  801ed1:	29 d0                	sub    %edx,%eax
+}
+  801ed3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed6:	c9                   	leave
+  801ed7:	c3                   	ret
+		return 0;
+  801ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801edd:	eb f4                	jmp    801ed3 <strncmp+0x2f>
+
+00801edf <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801edf:	55                   	push   %ebp
+  801ee0:	89 e5                	mov    %esp,%ebp
+  801ee2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801ee9:	eb 03                	jmp    801eee <strchr+0xf>
+  801eeb:	83 c0 01             	add    $0x1,%eax
+  801eee:	0f b6 10             	movzbl (%eax),%edx
+  801ef1:	84 d2                	test   %dl,%dl
+  801ef3:	74 06                	je     801efb <strchr+0x1c>
+		if (*s == c)
+  801ef5:	38 ca                	cmp    %cl,%dl
+  801ef7:	75 f2                	jne    801eeb <strchr+0xc>
+  801ef9:	eb 05                	jmp    801f00 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801efb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f00:	5d                   	pop    %ebp
+  801f01:	c3                   	ret
+
+00801f02 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801f02:	55                   	push   %ebp
+  801f03:	89 e5                	mov    %esp,%ebp
+  801f05:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f08:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f0c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801f0f:	38 ca                	cmp    %cl,%dl
+  801f11:	74 09                	je     801f1c <strfind+0x1a>
+  801f13:	84 d2                	test   %dl,%dl
+  801f15:	74 05                	je     801f1c <strfind+0x1a>
+	for (; *s; s++)
+  801f17:	83 c0 01             	add    $0x1,%eax
+  801f1a:	eb f0                	jmp    801f0c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801f1c:	5d                   	pop    %ebp
+  801f1d:	c3                   	ret
+
+00801f1e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801f1e:	55                   	push   %ebp
+  801f1f:	89 e5                	mov    %esp,%ebp
+  801f21:	57                   	push   %edi
+  801f22:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f25:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801f28:	85 c9                	test   %ecx,%ecx
+  801f2a:	74 20                	je     801f4c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801f2c:	89 f8                	mov    %edi,%eax
+  801f2e:	09 c8                	or     %ecx,%eax
+  801f30:	a8 03                	test   $0x3,%al
+  801f32:	75 12                	jne    801f46 <memset+0x28>
+		c &= 0xFF;
+  801f34:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801f38:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801f3e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801f41:	fc                   	cld
+  801f42:	f3 ab                	rep stos %eax,%es:(%edi)
+  801f44:	eb 06                	jmp    801f4c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801f46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f49:	fc                   	cld
+  801f4a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801f4c:	89 f8                	mov    %edi,%eax
+  801f4e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801f51:	c9                   	leave
+  801f52:	c3                   	ret
+
+00801f53 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801f53:	55                   	push   %ebp
+  801f54:	89 e5                	mov    %esp,%ebp
+  801f56:	57                   	push   %edi
+  801f57:	56                   	push   %esi
+  801f58:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f5e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801f61:	39 c6                	cmp    %eax,%esi
+  801f63:	73 32                	jae    801f97 <memmove+0x44>
+  801f65:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801f68:	39 d0                	cmp    %edx,%eax
+  801f6a:	73 2b                	jae    801f97 <memmove+0x44>
+		s += n;
+		d += n;
+  801f6c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f6f:	89 d6                	mov    %edx,%esi
+  801f71:	09 fe                	or     %edi,%esi
+  801f73:	09 ce                	or     %ecx,%esi
+  801f75:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801f7b:	75 0e                	jne    801f8b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801f7d:	83 ef 04             	sub    $0x4,%edi
+  801f80:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801f83:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801f86:	fd                   	std
+  801f87:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801f89:	eb 09                	jmp    801f94 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801f8b:	83 ef 01             	sub    $0x1,%edi
+  801f8e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801f91:	fd                   	std
+  801f92:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801f94:	fc                   	cld
+  801f95:	eb 1a                	jmp    801fb1 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f97:	89 f2                	mov    %esi,%edx
+  801f99:	09 c2                	or     %eax,%edx
+  801f9b:	09 ca                	or     %ecx,%edx
+  801f9d:	f6 c2 03             	test   $0x3,%dl
+  801fa0:	75 0a                	jne    801fac <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801fa2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801fa5:	89 c7                	mov    %eax,%edi
+  801fa7:	fc                   	cld
+  801fa8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801faa:	eb 05                	jmp    801fb1 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801fac:	89 c7                	mov    %eax,%edi
+  801fae:	fc                   	cld
+  801faf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801fb1:	5e                   	pop    %esi
+  801fb2:	5f                   	pop    %edi
+  801fb3:	5d                   	pop    %ebp
+  801fb4:	c3                   	ret
+
+00801fb5 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801fb5:	55                   	push   %ebp
+  801fb6:	89 e5                	mov    %esp,%ebp
+  801fb8:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801fbb:	ff 75 10             	push   0x10(%ebp)
+  801fbe:	ff 75 0c             	push   0xc(%ebp)
+  801fc1:	ff 75 08             	push   0x8(%ebp)
+  801fc4:	e8 8a ff ff ff       	call   801f53 <memmove>
+}
+  801fc9:	c9                   	leave
+  801fca:	c3                   	ret
+
+00801fcb <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801fcb:	55                   	push   %ebp
+  801fcc:	89 e5                	mov    %esp,%ebp
+  801fce:	56                   	push   %esi
+  801fcf:	53                   	push   %ebx
+  801fd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801fd6:	89 c6                	mov    %eax,%esi
+  801fd8:	03 75 10             	add    0x10(%ebp),%esi
+  801fdb:	eb 06                	jmp    801fe3 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801fdd:	83 c0 01             	add    $0x1,%eax
+  801fe0:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801fe3:	39 f0                	cmp    %esi,%eax
+  801fe5:	74 14                	je     801ffb <memcmp+0x30>
+		if (*s1 != *s2)
+  801fe7:	0f b6 08             	movzbl (%eax),%ecx
+  801fea:	0f b6 1a             	movzbl (%edx),%ebx
+  801fed:	38 d9                	cmp    %bl,%cl
+  801fef:	74 ec                	je     801fdd <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801ff1:	0f b6 c1             	movzbl %cl,%eax
+  801ff4:	0f b6 db             	movzbl %bl,%ebx
+  801ff7:	29 d8                	sub    %ebx,%eax
+  801ff9:	eb 05                	jmp    802000 <memcmp+0x35>
+	}
+
+	return 0;
+  801ffb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802000:	5b                   	pop    %ebx
+  802001:	5e                   	pop    %esi
+  802002:	5d                   	pop    %ebp
+  802003:	c3                   	ret
+
+00802004 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802004:	55                   	push   %ebp
+  802005:	89 e5                	mov    %esp,%ebp
+  802007:	8b 45 08             	mov    0x8(%ebp),%eax
+  80200a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80200d:	89 c2                	mov    %eax,%edx
+  80200f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802012:	eb 03                	jmp    802017 <memfind+0x13>
+  802014:	83 c0 01             	add    $0x1,%eax
+  802017:	39 d0                	cmp    %edx,%eax
+  802019:	73 04                	jae    80201f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80201b:	38 08                	cmp    %cl,(%eax)
+  80201d:	75 f5                	jne    802014 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80201f:	5d                   	pop    %ebp
+  802020:	c3                   	ret
+
+00802021 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802021:	55                   	push   %ebp
+  802022:	89 e5                	mov    %esp,%ebp
+  802024:	57                   	push   %edi
+  802025:	56                   	push   %esi
+  802026:	53                   	push   %ebx
+  802027:	8b 55 08             	mov    0x8(%ebp),%edx
+  80202a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80202d:	eb 03                	jmp    802032 <strtol+0x11>
+		s++;
+  80202f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802032:	0f b6 02             	movzbl (%edx),%eax
+  802035:	3c 20                	cmp    $0x20,%al
+  802037:	74 f6                	je     80202f <strtol+0xe>
+  802039:	3c 09                	cmp    $0x9,%al
+  80203b:	74 f2                	je     80202f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  80203d:	3c 2b                	cmp    $0x2b,%al
+  80203f:	74 2a                	je     80206b <strtol+0x4a>
+	int neg = 0;
+  802041:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802046:	3c 2d                	cmp    $0x2d,%al
+  802048:	74 2b                	je     802075 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80204a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802050:	75 0f                	jne    802061 <strtol+0x40>
+  802052:	80 3a 30             	cmpb   $0x30,(%edx)
+  802055:	74 28                	je     80207f <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802057:	85 db                	test   %ebx,%ebx
+  802059:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80205e:	0f 44 d8             	cmove  %eax,%ebx
+  802061:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802066:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802069:	eb 46                	jmp    8020b1 <strtol+0x90>
+		s++;
+  80206b:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  80206e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802073:	eb d5                	jmp    80204a <strtol+0x29>
+		s++, neg = 1;
+  802075:	83 c2 01             	add    $0x1,%edx
+  802078:	bf 01 00 00 00       	mov    $0x1,%edi
+  80207d:	eb cb                	jmp    80204a <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80207f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802083:	74 0e                	je     802093 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802085:	85 db                	test   %ebx,%ebx
+  802087:	75 d8                	jne    802061 <strtol+0x40>
+		s++, base = 8;
+  802089:	83 c2 01             	add    $0x1,%edx
+  80208c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802091:	eb ce                	jmp    802061 <strtol+0x40>
+		s += 2, base = 16;
+  802093:	83 c2 02             	add    $0x2,%edx
+  802096:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80209b:	eb c4                	jmp    802061 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80209d:	0f be c0             	movsbl %al,%eax
+  8020a0:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8020a3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8020a6:	7d 3a                	jge    8020e2 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8020a8:	83 c2 01             	add    $0x1,%edx
+  8020ab:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8020af:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8020b1:	0f b6 02             	movzbl (%edx),%eax
+  8020b4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8020b7:	89 f3                	mov    %esi,%ebx
+  8020b9:	80 fb 09             	cmp    $0x9,%bl
+  8020bc:	76 df                	jbe    80209d <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8020be:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8020c1:	89 f3                	mov    %esi,%ebx
+  8020c3:	80 fb 19             	cmp    $0x19,%bl
+  8020c6:	77 08                	ja     8020d0 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8020c8:	0f be c0             	movsbl %al,%eax
+  8020cb:	83 e8 57             	sub    $0x57,%eax
+  8020ce:	eb d3                	jmp    8020a3 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8020d0:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8020d3:	89 f3                	mov    %esi,%ebx
+  8020d5:	80 fb 19             	cmp    $0x19,%bl
+  8020d8:	77 08                	ja     8020e2 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8020da:	0f be c0             	movsbl %al,%eax
+  8020dd:	83 e8 37             	sub    $0x37,%eax
+  8020e0:	eb c1                	jmp    8020a3 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8020e2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8020e6:	74 05                	je     8020ed <strtol+0xcc>
+		*endptr = (char *) s;
+  8020e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020eb:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8020ed:	89 c8                	mov    %ecx,%eax
+  8020ef:	f7 d8                	neg    %eax
+  8020f1:	85 ff                	test   %edi,%edi
+  8020f3:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8020f6:	89 c8                	mov    %ecx,%eax
+  8020f8:	5b                   	pop    %ebx
+  8020f9:	5e                   	pop    %esi
+  8020fa:	5f                   	pop    %edi
+  8020fb:	5d                   	pop    %ebp
+  8020fc:	c3                   	ret
+
+008020fd <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  8020fd:	55                   	push   %ebp
+  8020fe:	89 e5                	mov    %esp,%ebp
+  802100:	57                   	push   %edi
+  802101:	56                   	push   %esi
+  802102:	53                   	push   %ebx
+  802103:	83 ec 0c             	sub    $0xc,%esp
+  802106:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802109:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80210c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  80210f:	85 ff                	test   %edi,%edi
+  802111:	74 16                	je     802129 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  802113:	83 ec 04             	sub    $0x4,%esp
+  802116:	56                   	push   %esi
+  802117:	6a 00                	push   $0x0
+  802119:	53                   	push   %ebx
+  80211a:	e8 02 ff ff ff       	call   802021 <strtol>
+  80211f:	89 07                	mov    %eax,(%edi)
+  802121:	83 c4 10             	add    $0x10,%esp
+  802124:	eb 03                	jmp    802129 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  802126:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  802129:	0f b6 03             	movzbl (%ebx),%eax
+  80212c:	3c 20                	cmp    $0x20,%al
+  80212e:	74 f6                	je     802126 <strisl+0x29>
+  802130:	3c 09                	cmp    $0x9,%al
+  802132:	74 f2                	je     802126 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  802134:	3c 2b                	cmp    $0x2b,%al
+  802136:	74 23                	je     80215b <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  802138:	3c 2d                	cmp    $0x2d,%al
+  80213a:	0f 94 c0             	sete   %al
+  80213d:	0f b6 c0             	movzbl %al,%eax
+  802140:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802142:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  802148:	75 41                	jne    80218b <strisl+0x8e>
+  80214a:	80 3b 30             	cmpb   $0x30,(%ebx)
+  80214d:	74 11                	je     802160 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80214f:	85 f6                	test   %esi,%esi
+  802151:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802156:	0f 44 f0             	cmove  %eax,%esi
+  802159:	eb 30                	jmp    80218b <strisl+0x8e>
+		s++;
+  80215b:	83 c3 01             	add    $0x1,%ebx
+  80215e:	eb e2                	jmp    802142 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802160:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  802164:	74 0e                	je     802174 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  802166:	85 f6                	test   %esi,%esi
+  802168:	75 21                	jne    80218b <strisl+0x8e>
+		s++, base = 8;
+  80216a:	83 c3 01             	add    $0x1,%ebx
+  80216d:	be 08 00 00 00       	mov    $0x8,%esi
+  802172:	eb 17                	jmp    80218b <strisl+0x8e>
+		s += 2, base = 16;
+  802174:	83 c3 02             	add    $0x2,%ebx
+  802177:	be 10 00 00 00       	mov    $0x10,%esi
+  80217c:	eb 0d                	jmp    80218b <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80217e:	0f be c0             	movsbl %al,%eax
+  802181:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  802184:	39 f0                	cmp    %esi,%eax
+  802186:	7d 38                	jge    8021c0 <strisl+0xc3>
+			return 0;
+		s++;
+  802188:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  80218b:	0f b6 03             	movzbl (%ebx),%eax
+  80218e:	8d 50 d0             	lea    -0x30(%eax),%edx
+  802191:	80 fa 09             	cmp    $0x9,%dl
+  802194:	76 e8                	jbe    80217e <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  802196:	8d 50 9f             	lea    -0x61(%eax),%edx
+  802199:	80 fa 19             	cmp    $0x19,%dl
+  80219c:	77 08                	ja     8021a6 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  80219e:	0f be c0             	movsbl %al,%eax
+  8021a1:	83 e8 57             	sub    $0x57,%eax
+  8021a4:	eb de                	jmp    802184 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  8021a6:	8d 50 bf             	lea    -0x41(%eax),%edx
+  8021a9:	80 fa 19             	cmp    $0x19,%dl
+  8021ac:	77 08                	ja     8021b6 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  8021ae:	0f be c0             	movsbl %al,%eax
+  8021b1:	83 e8 37             	sub    $0x37,%eax
+  8021b4:	eb ce                	jmp    802184 <strisl+0x87>
+		else if (!*s)
+  8021b6:	84 c0                	test   %al,%al
+  8021b8:	0f 94 c0             	sete   %al
+  8021bb:	0f b6 c0             	movzbl %al,%eax
+  8021be:	eb 05                	jmp    8021c5 <strisl+0xc8>
+			return 0;
+  8021c0:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  8021c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021c8:	5b                   	pop    %ebx
+  8021c9:	5e                   	pop    %esi
+  8021ca:	5f                   	pop    %edi
+  8021cb:	5d                   	pop    %ebp
+  8021cc:	c3                   	ret
+
+008021cd <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8021cd:	55                   	push   %ebp
+  8021ce:	89 e5                	mov    %esp,%ebp
+  8021d0:	57                   	push   %edi
+  8021d1:	56                   	push   %esi
+  8021d2:	53                   	push   %ebx
+  8021d3:	83 ec 14             	sub    $0x14,%esp
+  8021d6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021d9:	8b 75 14             	mov    0x14(%ebp),%esi
+  8021dc:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8021df:	ff 75 10             	push   0x10(%ebp)
+  8021e2:	ff 75 0c             	push   0xc(%ebp)
+  8021e5:	e8 c9 e3 ff ff       	call   8005b3 <sys_ipc_recv_pages>
+  8021ea:	83 c4 10             	add    $0x10,%esp
+  8021ed:	85 c0                	test   %eax,%eax
+  8021ef:	78 46                	js     802237 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8021f1:	85 ff                	test   %edi,%edi
+  8021f3:	74 0d                	je     802202 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  8021f5:	a1 08 40 80 00       	mov    0x804008,%eax
+  8021fa:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802200:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802202:	85 f6                	test   %esi,%esi
+  802204:	74 0d                	je     802213 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  802206:	a1 08 40 80 00       	mov    0x804008,%eax
+  80220b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802211:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802213:	85 db                	test   %ebx,%ebx
+  802215:	74 0d                	je     802224 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  802217:	a1 08 40 80 00       	mov    0x804008,%eax
+  80221c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802222:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802224:	a1 08 40 80 00       	mov    0x804008,%eax
+  802229:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80222f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802232:	5b                   	pop    %ebx
+  802233:	5e                   	pop    %esi
+  802234:	5f                   	pop    %edi
+  802235:	5d                   	pop    %ebp
+  802236:	c3                   	ret
+		if (from_env_store) {
+  802237:	85 ff                	test   %edi,%edi
+  802239:	74 06                	je     802241 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80223b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802241:	85 f6                	test   %esi,%esi
+  802243:	74 06                	je     80224b <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  802245:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80224b:	85 db                	test   %ebx,%ebx
+  80224d:	74 e0                	je     80222f <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  80224f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802255:	eb d8                	jmp    80222f <ipc_recv_pages+0x62>
+
+00802257 <ipc_recv>:
+{
+  802257:	55                   	push   %ebp
+  802258:	89 e5                	mov    %esp,%ebp
+  80225a:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  80225d:	6a 00                	push   $0x0
+  80225f:	ff 75 10             	push   0x10(%ebp)
+  802262:	6a 01                	push   $0x1
+  802264:	ff 75 0c             	push   0xc(%ebp)
+  802267:	ff 75 08             	push   0x8(%ebp)
+  80226a:	e8 5e ff ff ff       	call   8021cd <ipc_recv_pages>
+}
+  80226f:	c9                   	leave
+  802270:	c3                   	ret
+
+00802271 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802271:	55                   	push   %ebp
+  802272:	89 e5                	mov    %esp,%ebp
+  802274:	56                   	push   %esi
+  802275:	53                   	push   %ebx
+  802276:	8b 75 08             	mov    0x8(%ebp),%esi
+  802279:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  80227c:	83 ec 0c             	sub    $0xc,%esp
+  80227f:	ff 75 0c             	push   0xc(%ebp)
+  802282:	e8 60 e4 ff ff       	call   8006e7 <sys_ipc_try_recv>
+  802287:	83 c4 10             	add    $0x10,%esp
+  80228a:	85 c0                	test   %eax,%eax
+  80228c:	78 34                	js     8022c2 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80228e:	85 f6                	test   %esi,%esi
+  802290:	74 0d                	je     80229f <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  802292:	a1 08 40 80 00       	mov    0x804008,%eax
+  802297:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80229d:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  80229f:	85 db                	test   %ebx,%ebx
+  8022a1:	74 0d                	je     8022b0 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8022a3:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022a8:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8022ae:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8022b0:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022b5:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8022bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022be:	5b                   	pop    %ebx
+  8022bf:	5e                   	pop    %esi
+  8022c0:	5d                   	pop    %ebp
+  8022c1:	c3                   	ret
+		if (from_env_store) {
+  8022c2:	85 f6                	test   %esi,%esi
+  8022c4:	74 06                	je     8022cc <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8022c6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8022cc:	85 db                	test   %ebx,%ebx
+  8022ce:	74 eb                	je     8022bb <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8022d0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8022d6:	eb e3                	jmp    8022bb <ipc_try_recv+0x4a>
+
+008022d8 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8022d8:	55                   	push   %ebp
+  8022d9:	89 e5                	mov    %esp,%ebp
+  8022db:	83 ec 14             	sub    $0x14,%esp
+  8022de:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8022e1:	85 c0                	test   %eax,%eax
+  8022e3:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8022e8:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8022eb:	ff 75 18             	push   0x18(%ebp)
+  8022ee:	ff 75 14             	push   0x14(%ebp)
+  8022f1:	50                   	push   %eax
+  8022f2:	ff 75 0c             	push   0xc(%ebp)
+  8022f5:	ff 75 08             	push   0x8(%ebp)
+  8022f8:	e8 79 e2 ff ff       	call   800576 <sys_ipc_send_pages>
+  8022fd:	83 c4 20             	add    $0x20,%esp
+  802300:	85 c0                	test   %eax,%eax
+  802302:	78 02                	js     802306 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  802304:	c9                   	leave
+  802305:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  802306:	50                   	push   %eax
+  802307:	68 2c 2b 80 00       	push   $0x802b2c
+  80230c:	68 80 00 00 00       	push   $0x80
+  802311:	68 58 2b 80 00       	push   $0x802b58
+  802316:	e8 f0 f3 ff ff       	call   80170b <_panic>
+
+0080231b <ipc_send>:
+{
+  80231b:	55                   	push   %ebp
+  80231c:	89 e5                	mov    %esp,%ebp
+  80231e:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  802321:	ff 75 14             	push   0x14(%ebp)
+  802324:	6a 01                	push   $0x1
+  802326:	ff 75 10             	push   0x10(%ebp)
+  802329:	ff 75 0c             	push   0xc(%ebp)
+  80232c:	ff 75 08             	push   0x8(%ebp)
+  80232f:	e8 a4 ff ff ff       	call   8022d8 <ipc_send_pages>
+}
+  802334:	83 c4 20             	add    $0x20,%esp
+  802337:	c9                   	leave
+  802338:	c3                   	ret
+
+00802339 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802339:	55                   	push   %ebp
+  80233a:	89 e5                	mov    %esp,%ebp
+  80233c:	83 ec 14             	sub    $0x14,%esp
+  80233f:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802342:	85 c0                	test   %eax,%eax
+  802344:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802349:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80234c:	ff 75 18             	push   0x18(%ebp)
+  80234f:	ff 75 14             	push   0x14(%ebp)
+  802352:	50                   	push   %eax
+  802353:	ff 75 0c             	push   0xc(%ebp)
+  802356:	ff 75 08             	push   0x8(%ebp)
+  802359:	e8 a9 e2 ff ff       	call   800607 <sys_ipc_call>
+  80235e:	83 c4 20             	add    $0x20,%esp
+  802361:	85 c0                	test   %eax,%eax
+  802363:	78 0b                	js     802370 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  802365:	a1 08 40 80 00       	mov    0x804008,%eax
+  80236a:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802370:	c9                   	leave
+  802371:	c3                   	ret
+
+00802372 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  802372:	55                   	push   %ebp
+  802373:	89 e5                	mov    %esp,%ebp
+  802375:	57                   	push   %edi
+  802376:	56                   	push   %esi
+  802377:	53                   	push   %ebx
+  802378:	83 ec 18             	sub    $0x18,%esp
+  80237b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80237e:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  802381:	8b 75 20             	mov    0x20(%ebp),%esi
+  802384:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802387:	85 c0                	test   %eax,%eax
+  802389:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80238e:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802391:	ff 75 18             	push   0x18(%ebp)
+  802394:	ff 75 14             	push   0x14(%ebp)
+  802397:	50                   	push   %eax
+  802398:	ff 75 0c             	push   0xc(%ebp)
+  80239b:	ff 75 08             	push   0x8(%ebp)
+  80239e:	e8 a5 e2 ff ff       	call   800648 <sys_ipc_reply_recv>
+  8023a3:	83 c4 20             	add    $0x20,%esp
+  8023a6:	85 c0                	test   %eax,%eax
+  8023a8:	78 46                	js     8023f0 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8023aa:	85 ff                	test   %edi,%edi
+  8023ac:	74 0d                	je     8023bb <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8023ae:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023b3:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8023b9:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8023bb:	85 f6                	test   %esi,%esi
+  8023bd:	74 0d                	je     8023cc <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8023bf:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023c4:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8023ca:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8023cc:	85 db                	test   %ebx,%ebx
+  8023ce:	74 0d                	je     8023dd <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8023d0:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023d5:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8023db:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8023dd:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023e2:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8023e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023eb:	5b                   	pop    %ebx
+  8023ec:	5e                   	pop    %esi
+  8023ed:	5f                   	pop    %edi
+  8023ee:	5d                   	pop    %ebp
+  8023ef:	c3                   	ret
+		if (from_env_store) {
+  8023f0:	85 ff                	test   %edi,%edi
+  8023f2:	74 06                	je     8023fa <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  8023f4:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8023fa:	85 f6                	test   %esi,%esi
+  8023fc:	74 06                	je     802404 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  8023fe:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802404:	85 db                	test   %ebx,%ebx
+  802406:	74 e0                	je     8023e8 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  802408:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80240e:	eb d8                	jmp    8023e8 <ipc_reply_recv+0x76>
+
+00802410 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802410:	55                   	push   %ebp
+  802411:	89 e5                	mov    %esp,%ebp
+  802413:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802416:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80241b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80241e:	c1 e0 06             	shl    $0x6,%eax
+  802421:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802426:	8b 40 50             	mov    0x50(%eax),%eax
+  802429:	39 c8                	cmp    %ecx,%eax
+  80242b:	74 12                	je     80243f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80242d:	83 c2 01             	add    $0x1,%edx
+  802430:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802436:	75 e3                	jne    80241b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80243d:	eb 0e                	jmp    80244d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80243f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802442:	c1 e0 06             	shl    $0x6,%eax
+  802445:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80244a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80244d:	5d                   	pop    %ebp
+  80244e:	c3                   	ret
+
+0080244f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80244f:	55                   	push   %ebp
+  802450:	89 e5                	mov    %esp,%ebp
+  802452:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802455:	89 c2                	mov    %eax,%edx
+  802457:	c1 ea 16             	shr    $0x16,%edx
+  80245a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802461:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802466:	f6 c1 01             	test   $0x1,%cl
+  802469:	74 1e                	je     802489 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  80246b:	c1 e8 0c             	shr    $0xc,%eax
+  80246e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802475:	a8 01                	test   $0x1,%al
+  802477:	74 10                	je     802489 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802479:	c1 e8 0c             	shr    $0xc,%eax
+  80247c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80247f:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  802486:	0f b7 d2             	movzwl %dx,%edx
+}
+  802489:	89 d0                	mov    %edx,%eax
+  80248b:	5d                   	pop    %ebp
+  80248c:	c3                   	ret
+
+0080248d <udivmod>:
+  80248d:	55                   	push   %ebp
+  80248e:	57                   	push   %edi
+  80248f:	56                   	push   %esi
+  802490:	53                   	push   %ebx
+  802491:	83 ec 24             	sub    $0x24,%esp
+  802494:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802498:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80249c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8024a0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8024a4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024a8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024ac:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8024b0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024bf:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024c6:	00 
+  8024c7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024ce:	00 
+  8024cf:	89 fb                	mov    %edi,%ebx
+  8024d1:	eb 08                	jmp    8024db <udivmod+0x4e>
+  8024d3:	83 e9 01             	sub    $0x1,%ecx
+  8024d6:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8024d9:	74 68                	je     802543 <udivmod+0xb6>
+  8024db:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024df:	01 c0                	add    %eax,%eax
+  8024e1:	89 c6                	mov    %eax,%esi
+  8024e3:	89 d7                	mov    %edx,%edi
+  8024e5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8024e9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8024ed:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024f0:	d3 ea                	shr    %cl,%edx
+  8024f2:	f6 c1 20             	test   $0x20,%cl
+  8024f5:	74 04                	je     8024fb <udivmod+0x6e>
+  8024f7:	89 d0                	mov    %edx,%eax
+  8024f9:	31 d2                	xor    %edx,%edx
+  8024fb:	83 e0 01             	and    $0x1,%eax
+  8024fe:	89 04 24             	mov    %eax,(%esp)
+  802501:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802508:	00 
+  802509:	8b 04 24             	mov    (%esp),%eax
+  80250c:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802510:	09 f0                	or     %esi,%eax
+  802512:	09 fa                	or     %edi,%edx
+  802514:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802518:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80251c:	39 f0                	cmp    %esi,%eax
+  80251e:	89 d5                	mov    %edx,%ebp
+  802520:	19 fd                	sbb    %edi,%ebp
+  802522:	72 af                	jb     8024d3 <udivmod+0x46>
+  802524:	29 f0                	sub    %esi,%eax
+  802526:	19 fa                	sbb    %edi,%edx
+  802528:	89 cf                	mov    %ecx,%edi
+  80252a:	c1 ef 05             	shr    $0x5,%edi
+  80252d:	83 e7 01             	and    $0x1,%edi
+  802530:	89 fe                	mov    %edi,%esi
+  802532:	83 f6 01             	xor    $0x1,%esi
+  802535:	d3 e6                	shl    %cl,%esi
+  802537:	d3 e7                	shl    %cl,%edi
+  802539:	09 74 24 18          	or     %esi,0x18(%esp)
+  80253d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802541:	eb 90                	jmp    8024d3 <udivmod+0x46>
+  802543:	85 db                	test   %ebx,%ebx
+  802545:	74 05                	je     80254c <udivmod+0xbf>
+  802547:	89 03                	mov    %eax,(%ebx)
+  802549:	89 53 04             	mov    %edx,0x4(%ebx)
+  80254c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802550:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802554:	83 c4 24             	add    $0x24,%esp
+  802557:	5b                   	pop    %ebx
+  802558:	5e                   	pop    %esi
+  802559:	5f                   	pop    %edi
+  80255a:	5d                   	pop    %ebp
+  80255b:	c3                   	ret
+
+0080255c <__udivdi3>:
+  80255c:	83 ec 08             	sub    $0x8,%esp
+  80255f:	6a 00                	push   $0x0
+  802561:	ff 74 24 1c          	push   0x1c(%esp)
+  802565:	ff 74 24 1c          	push   0x1c(%esp)
+  802569:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80256d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802571:	e8 17 ff ff ff       	call   80248d <udivmod>
+  802576:	83 c4 14             	add    $0x14,%esp
+  802579:	c3                   	ret
+
+0080257a <__umoddi3>:
+  80257a:	83 ec 18             	sub    $0x18,%esp
+  80257d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802581:	50                   	push   %eax
+  802582:	ff 74 24 2c          	push   0x2c(%esp)
+  802586:	ff 74 24 2c          	push   0x2c(%esp)
+  80258a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80258e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802592:	e8 f6 fe ff ff       	call   80248d <udivmod>
+  802597:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80259b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80259f:	83 c4 24             	add    $0x24,%esp
+  8025a2:	c3                   	ret
+
+008025a3 <__divdi3>:
+  8025a3:	55                   	push   %ebp
+  8025a4:	57                   	push   %edi
+  8025a5:	56                   	push   %esi
+  8025a6:	53                   	push   %ebx
+  8025a7:	83 ec 10             	sub    $0x10,%esp
+  8025aa:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8025ae:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8025b2:	89 c6                	mov    %eax,%esi
+  8025b4:	89 d7                	mov    %edx,%edi
+  8025b6:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8025ba:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8025be:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025c2:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8025c6:	89 c5                	mov    %eax,%ebp
+  8025c8:	f7 dd                	neg    %ebp
+  8025ca:	89 d6                	mov    %edx,%esi
+  8025cc:	83 d6 00             	adc    $0x0,%esi
+  8025cf:	f7 de                	neg    %esi
+  8025d1:	0f 48 e8             	cmovs  %eax,%ebp
+  8025d4:	0f 49 d6             	cmovns %esi,%edx
+  8025d7:	6a 00                	push   $0x0
+  8025d9:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8025dd:	f7 de                	neg    %esi
+  8025df:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8025e3:	83 d0 00             	adc    $0x0,%eax
+  8025e6:	f7 d8                	neg    %eax
+  8025e8:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  8025ed:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  8025f2:	50                   	push   %eax
+  8025f3:	56                   	push   %esi
+  8025f4:	89 e8                	mov    %ebp,%eax
+  8025f6:	e8 92 fe ff ff       	call   80248d <udivmod>
+  8025fb:	83 c4 10             	add    $0x10,%esp
+  8025fe:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  802603:	78 08                	js     80260d <__divdi3+0x6a>
+  802605:	83 c4 0c             	add    $0xc,%esp
+  802608:	5b                   	pop    %ebx
+  802609:	5e                   	pop    %esi
+  80260a:	5f                   	pop    %edi
+  80260b:	5d                   	pop    %ebp
+  80260c:	c3                   	ret
+  80260d:	f7 d8                	neg    %eax
+  80260f:	83 d2 00             	adc    $0x0,%edx
+  802612:	f7 da                	neg    %edx
+  802614:	eb ef                	jmp    802605 <__divdi3+0x62>
+
+00802616 <__moddi3>:
+  802616:	55                   	push   %ebp
+  802617:	57                   	push   %edi
+  802618:	56                   	push   %esi
+  802619:	53                   	push   %ebx
+  80261a:	83 ec 18             	sub    $0x18,%esp
+  80261d:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802621:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802625:	89 f1                	mov    %esi,%ecx
+  802627:	f7 d9                	neg    %ecx
+  802629:	89 da                	mov    %ebx,%edx
+  80262b:	83 d2 00             	adc    $0x0,%edx
+  80262e:	f7 da                	neg    %edx
+  802630:	0f 48 ce             	cmovs  %esi,%ecx
+  802633:	0f 48 d3             	cmovs  %ebx,%edx
+  802636:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80263a:	50                   	push   %eax
+  80263b:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80263f:	f7 de                	neg    %esi
+  802641:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802645:	83 d0 00             	adc    $0x0,%eax
+  802648:	f7 d8                	neg    %eax
+  80264a:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80264f:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802654:	50                   	push   %eax
+  802655:	56                   	push   %esi
+  802656:	89 c8                	mov    %ecx,%eax
+  802658:	e8 30 fe ff ff       	call   80248d <udivmod>
+  80265d:	83 c4 10             	add    $0x10,%esp
+  802660:	85 db                	test   %ebx,%ebx
+  802662:	78 10                	js     802674 <__moddi3+0x5e>
+  802664:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802668:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80266c:	83 c4 14             	add    $0x14,%esp
+  80266f:	5b                   	pop    %ebx
+  802670:	5e                   	pop    %esi
+  802671:	5f                   	pop    %edi
+  802672:	5d                   	pop    %ebp
+  802673:	c3                   	ret
+  802674:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802678:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80267c:	f7 d8                	neg    %eax
+  80267e:	83 d2 00             	adc    $0x0,%edx
+  802681:	f7 da                	neg    %edx
+  802683:	eb e7                	jmp    80266c <__moddi3+0x56>
@@ -0,0 +1,9882 @@
+
+obj/user/bigmem.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 58 00 00 00       	call   800089 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+	int r;
+	uintptr_t va;
+
+	for(va = 0x10000000; va < USTACKTOP - PGSIZE; va+=PGSIZE){
+  80003a:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+		cprintf("+%x\n", va);
+  80003f:	83 ec 08             	sub    $0x8,%esp
+  800042:	53                   	push   %ebx
+  800043:	68 c0 4c 80 00       	push   $0x804cc0
+  800048:	e8 7a 01 00 00       	call   8001c7 <cprintf>
+		if((r = page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W, 1)) < 0)
+  80004d:	6a 01                	push   $0x1
+  80004f:	6a 07                	push   $0x7
+  800051:	53                   	push   %ebx
+  800052:	6a 00                	push   $0x0
+  800054:	e8 4a 34 00 00       	call   8034a3 <page_alloc>
+  800059:	83 c4 20             	add    $0x20,%esp
+  80005c:	85 c0                	test   %eax,%eax
+  80005e:	78 13                	js     800073 <umain+0x40>
+	for(va = 0x10000000; va < USTACKTOP - PGSIZE; va+=PGSIZE){
+  800060:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800066:	81 fb 00 d0 bf ee    	cmp    $0xeebfd000,%ebx
+  80006c:	75 d1                	jne    80003f <umain+0xc>
+			panic("sys_page_alloc on %p: %e", va, r);
+	}
+}
+  80006e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800071:	c9                   	leave
+  800072:	c3                   	ret
+			panic("sys_page_alloc on %p: %e", va, r);
+  800073:	83 ec 0c             	sub    $0xc,%esp
+  800076:	50                   	push   %eax
+  800077:	53                   	push   %ebx
+  800078:	68 c5 4c 80 00       	push   $0x804cc5
+  80007d:	6a 0f                	push   $0xf
+  80007f:	68 de 4c 80 00       	push   $0x804cde
+  800084:	e8 63 00 00 00       	call   8000ec <_panic>
+
+00800089 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800089:	55                   	push   %ebp
+  80008a:	89 e5                	mov    %esp,%ebp
+  80008c:	56                   	push   %esi
+  80008d:	53                   	push   %ebx
+  80008e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800091:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800094:	e8 ca 0b 00 00       	call   800c63 <sys_getenvid>
+  800099:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80009e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8000a1:	c1 e0 06             	shl    $0x6,%eax
+  8000a4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000a9:	a3 18 e9 80 00       	mov    %eax,0x80e918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000ae:	85 db                	test   %ebx,%ebx
+  8000b0:	7e 07                	jle    8000b9 <libmain+0x30>
+		binaryname = argv[0];
+  8000b2:	8b 06                	mov    (%esi),%eax
+  8000b4:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  8000b9:	83 ec 08             	sub    $0x8,%esp
+  8000bc:	56                   	push   %esi
+  8000bd:	53                   	push   %ebx
+  8000be:	e8 70 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000c3:	e8 0a 00 00 00       	call   8000d2 <exit>
+}
+  8000c8:	83 c4 10             	add    $0x10,%esp
+  8000cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000ce:	5b                   	pop    %ebx
+  8000cf:	5e                   	pop    %esi
+  8000d0:	5d                   	pop    %ebp
+  8000d1:	c3                   	ret
+
+008000d2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000d2:	55                   	push   %ebp
+  8000d3:	89 e5                	mov    %esp,%ebp
+  8000d5:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000d8:	e8 2a 13 00 00       	call   801407 <close_all>
+	sys_env_destroy(0);
+  8000dd:	83 ec 0c             	sub    $0xc,%esp
+  8000e0:	6a 00                	push   $0x0
+  8000e2:	e8 3b 0b 00 00       	call   800c22 <sys_env_destroy>
+}
+  8000e7:	83 c4 10             	add    $0x10,%esp
+  8000ea:	c9                   	leave
+  8000eb:	c3                   	ret
+
+008000ec <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8000ec:	55                   	push   %ebp
+  8000ed:	89 e5                	mov    %esp,%ebp
+  8000ef:	56                   	push   %esi
+  8000f0:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8000f1:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8000f4:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  8000fa:	e8 64 0b 00 00       	call   800c63 <sys_getenvid>
+  8000ff:	83 ec 0c             	sub    $0xc,%esp
+  800102:	ff 75 0c             	push   0xc(%ebp)
+  800105:	ff 75 08             	push   0x8(%ebp)
+  800108:	56                   	push   %esi
+  800109:	50                   	push   %eax
+  80010a:	68 f8 4c 80 00       	push   $0x804cf8
+  80010f:	e8 b3 00 00 00       	call   8001c7 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800114:	83 c4 18             	add    $0x18,%esp
+  800117:	53                   	push   %ebx
+  800118:	ff 75 10             	push   0x10(%ebp)
+  80011b:	e8 56 00 00 00       	call   800176 <vcprintf>
+	cprintf("\n");
+  800120:	c7 04 24 b1 51 80 00 	movl   $0x8051b1,(%esp)
+  800127:	e8 9b 00 00 00       	call   8001c7 <cprintf>
+  80012c:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80012f:	cc                   	int3
+	while (1)
+  800130:	eb fd                	jmp    80012f <_panic+0x43>
+
+00800132 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800132:	55                   	push   %ebp
+  800133:	89 e5                	mov    %esp,%ebp
+  800135:	53                   	push   %ebx
+  800136:	83 ec 04             	sub    $0x4,%esp
+  800139:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80013c:	8b 13                	mov    (%ebx),%edx
+  80013e:	8d 42 01             	lea    0x1(%edx),%eax
+  800141:	89 03                	mov    %eax,(%ebx)
+  800143:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800146:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80014a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80014f:	74 09                	je     80015a <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800151:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800155:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800158:	c9                   	leave
+  800159:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80015a:	83 ec 08             	sub    $0x8,%esp
+  80015d:	68 ff 00 00 00       	push   $0xff
+  800162:	8d 43 08             	lea    0x8(%ebx),%eax
+  800165:	50                   	push   %eax
+  800166:	e8 69 0a 00 00       	call   800bd4 <sys_cputs>
+		b->idx = 0;
+  80016b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800171:	83 c4 10             	add    $0x10,%esp
+  800174:	eb db                	jmp    800151 <putch+0x1f>
+
+00800176 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800176:	55                   	push   %ebp
+  800177:	89 e5                	mov    %esp,%ebp
+  800179:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80017f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800186:	00 00 00 
+	b.cnt = 0;
+  800189:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800190:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800193:	ff 75 0c             	push   0xc(%ebp)
+  800196:	ff 75 08             	push   0x8(%ebp)
+  800199:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80019f:	50                   	push   %eax
+  8001a0:	68 32 01 80 00       	push   $0x800132
+  8001a5:	e8 14 01 00 00       	call   8002be <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001aa:	83 c4 08             	add    $0x8,%esp
+  8001ad:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001b3:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001b9:	50                   	push   %eax
+  8001ba:	e8 15 0a 00 00       	call   800bd4 <sys_cputs>
+
+	return b.cnt;
+}
+  8001bf:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001c5:	c9                   	leave
+  8001c6:	c3                   	ret
+
+008001c7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001c7:	55                   	push   %ebp
+  8001c8:	89 e5                	mov    %esp,%ebp
+  8001ca:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001cd:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001d0:	50                   	push   %eax
+  8001d1:	ff 75 08             	push   0x8(%ebp)
+  8001d4:	e8 9d ff ff ff       	call   800176 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001d9:	c9                   	leave
+  8001da:	c3                   	ret
+
+008001db <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001db:	55                   	push   %ebp
+  8001dc:	89 e5                	mov    %esp,%ebp
+  8001de:	57                   	push   %edi
+  8001df:	56                   	push   %esi
+  8001e0:	53                   	push   %ebx
+  8001e1:	83 ec 1c             	sub    $0x1c,%esp
+  8001e4:	89 c7                	mov    %eax,%edi
+  8001e6:	89 d6                	mov    %edx,%esi
+  8001e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001ee:	89 d1                	mov    %edx,%ecx
+  8001f0:	89 c2                	mov    %eax,%edx
+  8001f2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001f5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001f8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001fb:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001fe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800201:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800208:	39 c2                	cmp    %eax,%edx
+  80020a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80020d:	72 3e                	jb     80024d <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80020f:	83 ec 0c             	sub    $0xc,%esp
+  800212:	ff 75 18             	push   0x18(%ebp)
+  800215:	83 eb 01             	sub    $0x1,%ebx
+  800218:	53                   	push   %ebx
+  800219:	50                   	push   %eax
+  80021a:	83 ec 08             	sub    $0x8,%esp
+  80021d:	ff 75 e4             	push   -0x1c(%ebp)
+  800220:	ff 75 e0             	push   -0x20(%ebp)
+  800223:	ff 75 dc             	push   -0x24(%ebp)
+  800226:	ff 75 d8             	push   -0x28(%ebp)
+  800229:	e8 4e 49 00 00       	call   804b7c <__udivdi3>
+  80022e:	83 c4 18             	add    $0x18,%esp
+  800231:	52                   	push   %edx
+  800232:	50                   	push   %eax
+  800233:	89 f2                	mov    %esi,%edx
+  800235:	89 f8                	mov    %edi,%eax
+  800237:	e8 9f ff ff ff       	call   8001db <printnum>
+  80023c:	83 c4 20             	add    $0x20,%esp
+  80023f:	eb 13                	jmp    800254 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800241:	83 ec 08             	sub    $0x8,%esp
+  800244:	56                   	push   %esi
+  800245:	ff 75 18             	push   0x18(%ebp)
+  800248:	ff d7                	call   *%edi
+  80024a:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80024d:	83 eb 01             	sub    $0x1,%ebx
+  800250:	85 db                	test   %ebx,%ebx
+  800252:	7f ed                	jg     800241 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800254:	83 ec 08             	sub    $0x8,%esp
+  800257:	56                   	push   %esi
+  800258:	83 ec 04             	sub    $0x4,%esp
+  80025b:	ff 75 e4             	push   -0x1c(%ebp)
+  80025e:	ff 75 e0             	push   -0x20(%ebp)
+  800261:	ff 75 dc             	push   -0x24(%ebp)
+  800264:	ff 75 d8             	push   -0x28(%ebp)
+  800267:	e8 2e 49 00 00       	call   804b9a <__umoddi3>
+  80026c:	83 c4 14             	add    $0x14,%esp
+  80026f:	0f be 80 1b 4d 80 00 	movsbl 0x804d1b(%eax),%eax
+  800276:	50                   	push   %eax
+  800277:	ff d7                	call   *%edi
+}
+  800279:	83 c4 10             	add    $0x10,%esp
+  80027c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027f:	5b                   	pop    %ebx
+  800280:	5e                   	pop    %esi
+  800281:	5f                   	pop    %edi
+  800282:	5d                   	pop    %ebp
+  800283:	c3                   	ret
+
+00800284 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800284:	55                   	push   %ebp
+  800285:	89 e5                	mov    %esp,%ebp
+  800287:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80028a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80028e:	8b 10                	mov    (%eax),%edx
+  800290:	3b 50 04             	cmp    0x4(%eax),%edx
+  800293:	73 0a                	jae    80029f <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800295:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800298:	89 08                	mov    %ecx,(%eax)
+  80029a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80029d:	88 02                	mov    %al,(%edx)
+}
+  80029f:	5d                   	pop    %ebp
+  8002a0:	c3                   	ret
+
+008002a1 <printfmt>:
+{
+  8002a1:	55                   	push   %ebp
+  8002a2:	89 e5                	mov    %esp,%ebp
+  8002a4:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002a7:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002aa:	50                   	push   %eax
+  8002ab:	ff 75 10             	push   0x10(%ebp)
+  8002ae:	ff 75 0c             	push   0xc(%ebp)
+  8002b1:	ff 75 08             	push   0x8(%ebp)
+  8002b4:	e8 05 00 00 00       	call   8002be <vprintfmt>
+}
+  8002b9:	83 c4 10             	add    $0x10,%esp
+  8002bc:	c9                   	leave
+  8002bd:	c3                   	ret
+
+008002be <vprintfmt>:
+{
+  8002be:	55                   	push   %ebp
+  8002bf:	89 e5                	mov    %esp,%ebp
+  8002c1:	57                   	push   %edi
+  8002c2:	56                   	push   %esi
+  8002c3:	53                   	push   %ebx
+  8002c4:	83 ec 2c             	sub    $0x2c,%esp
+  8002c7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002ca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002cd:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002d0:	eb 0a                	jmp    8002dc <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002d2:	83 ec 08             	sub    $0x8,%esp
+  8002d5:	53                   	push   %ebx
+  8002d6:	50                   	push   %eax
+  8002d7:	ff d6                	call   *%esi
+  8002d9:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002dc:	83 c7 01             	add    $0x1,%edi
+  8002df:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002e3:	83 f8 25             	cmp    $0x25,%eax
+  8002e6:	74 0c                	je     8002f4 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002e8:	85 c0                	test   %eax,%eax
+  8002ea:	75 e6                	jne    8002d2 <vprintfmt+0x14>
+}
+  8002ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ef:	5b                   	pop    %ebx
+  8002f0:	5e                   	pop    %esi
+  8002f1:	5f                   	pop    %edi
+  8002f2:	5d                   	pop    %ebp
+  8002f3:	c3                   	ret
+		padc = ' ';
+  8002f4:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002f8:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002ff:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800306:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80030d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800312:	8d 47 01             	lea    0x1(%edi),%eax
+  800315:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800318:	0f b6 17             	movzbl (%edi),%edx
+  80031b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80031e:	3c 55                	cmp    $0x55,%al
+  800320:	0f 87 c5 03 00 00    	ja     8006eb <vprintfmt+0x42d>
+  800326:	0f b6 c0             	movzbl %al,%eax
+  800329:	ff 24 85 a0 4e 80 00 	jmp    *0x804ea0(,%eax,4)
+  800330:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800333:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800337:	eb d9                	jmp    800312 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800339:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80033c:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800340:	eb d0                	jmp    800312 <vprintfmt+0x54>
+  800342:	0f b6 d2             	movzbl %dl,%edx
+  800345:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800348:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800350:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800353:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800357:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80035a:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80035d:	83 f9 09             	cmp    $0x9,%ecx
+  800360:	77 55                	ja     8003b7 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800362:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800365:	eb e9                	jmp    800350 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800367:	8b 45 14             	mov    0x14(%ebp),%eax
+  80036a:	8b 00                	mov    (%eax),%eax
+  80036c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80036f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800372:	8d 40 04             	lea    0x4(%eax),%eax
+  800375:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800378:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80037b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80037f:	79 91                	jns    800312 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800381:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800384:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800387:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80038e:	eb 82                	jmp    800312 <vprintfmt+0x54>
+			if (width < 0)
+  800390:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800393:	85 d2                	test   %edx,%edx
+  800395:	b8 00 00 00 00       	mov    $0x0,%eax
+  80039a:	0f 49 c2             	cmovns %edx,%eax
+  80039d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003a3:	e9 6a ff ff ff       	jmp    800312 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003ab:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003b2:	e9 5b ff ff ff       	jmp    800312 <vprintfmt+0x54>
+  8003b7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ba:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003bd:	eb bc                	jmp    80037b <vprintfmt+0xbd>
+			lflag++;
+  8003bf:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003c5:	e9 48 ff ff ff       	jmp    800312 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cd:	8d 78 04             	lea    0x4(%eax),%edi
+  8003d0:	83 ec 08             	sub    $0x8,%esp
+  8003d3:	53                   	push   %ebx
+  8003d4:	ff 30                	push   (%eax)
+  8003d6:	ff d6                	call   *%esi
+			break;
+  8003d8:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003db:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003de:	e9 63 02 00 00       	jmp    800646 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8003e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e6:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003e9:	8b 10                	mov    (%eax),%edx
+  8003eb:	89 d0                	mov    %edx,%eax
+  8003ed:	f7 d8                	neg    %eax
+  8003ef:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003f2:	83 f8 12             	cmp    $0x12,%eax
+  8003f5:	7f 23                	jg     80041a <vprintfmt+0x15c>
+  8003f7:	8b 14 85 00 50 80 00 	mov    0x805000(,%eax,4),%edx
+  8003fe:	85 d2                	test   %edx,%edx
+  800400:	74 18                	je     80041a <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800402:	52                   	push   %edx
+  800403:	68 3d 51 80 00       	push   $0x80513d
+  800408:	53                   	push   %ebx
+  800409:	56                   	push   %esi
+  80040a:	e8 92 fe ff ff       	call   8002a1 <printfmt>
+  80040f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800412:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800415:	e9 2c 02 00 00       	jmp    800646 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80041a:	50                   	push   %eax
+  80041b:	68 33 4d 80 00       	push   $0x804d33
+  800420:	53                   	push   %ebx
+  800421:	56                   	push   %esi
+  800422:	e8 7a fe ff ff       	call   8002a1 <printfmt>
+  800427:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80042a:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80042d:	e9 14 02 00 00       	jmp    800646 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800432:	8b 45 14             	mov    0x14(%ebp),%eax
+  800435:	83 c0 04             	add    $0x4,%eax
+  800438:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80043b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043e:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800440:	85 c9                	test   %ecx,%ecx
+  800442:	b8 2c 4d 80 00       	mov    $0x804d2c,%eax
+  800447:	0f 45 c1             	cmovne %ecx,%eax
+  80044a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80044d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800451:	7e 06                	jle    800459 <vprintfmt+0x19b>
+  800453:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800457:	75 0b                	jne    800464 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800459:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80045c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80045f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800462:	eb 5c                	jmp    8004c0 <vprintfmt+0x202>
+  800464:	83 ec 08             	sub    $0x8,%esp
+  800467:	ff 75 d0             	push   -0x30(%ebp)
+  80046a:	ff 75 cc             	push   -0x34(%ebp)
+  80046d:	e8 19 03 00 00       	call   80078b <strnlen>
+  800472:	89 c2                	mov    %eax,%edx
+  800474:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800477:	29 d0                	sub    %edx,%eax
+  800479:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80047c:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800480:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800483:	89 75 08             	mov    %esi,0x8(%ebp)
+  800486:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800488:	eb 0e                	jmp    800498 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80048a:	83 ec 08             	sub    $0x8,%esp
+  80048d:	53                   	push   %ebx
+  80048e:	57                   	push   %edi
+  80048f:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800492:	83 ee 01             	sub    $0x1,%esi
+  800495:	83 c4 10             	add    $0x10,%esp
+  800498:	85 f6                	test   %esi,%esi
+  80049a:	7f ee                	jg     80048a <vprintfmt+0x1cc>
+  80049c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80049f:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004a2:	85 c0                	test   %eax,%eax
+  8004a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004a9:	0f 49 d0             	cmovns %eax,%edx
+  8004ac:	29 d0                	sub    %edx,%eax
+  8004ae:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004b1:	eb a6                	jmp    800459 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004b3:	83 ec 08             	sub    $0x8,%esp
+  8004b6:	53                   	push   %ebx
+  8004b7:	52                   	push   %edx
+  8004b8:	ff 55 08             	call   *0x8(%ebp)
+  8004bb:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004be:	89 f1                	mov    %esi,%ecx
+  8004c0:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004c3:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004c7:	0f be d0             	movsbl %al,%edx
+  8004ca:	85 d2                	test   %edx,%edx
+  8004cc:	74 28                	je     8004f6 <vprintfmt+0x238>
+  8004ce:	85 ff                	test   %edi,%edi
+  8004d0:	78 05                	js     8004d7 <vprintfmt+0x219>
+  8004d2:	83 ef 01             	sub    $0x1,%edi
+  8004d5:	78 30                	js     800507 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004d7:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004db:	74 d6                	je     8004b3 <vprintfmt+0x1f5>
+  8004dd:	0f be c0             	movsbl %al,%eax
+  8004e0:	83 e8 20             	sub    $0x20,%eax
+  8004e3:	83 f8 5e             	cmp    $0x5e,%eax
+  8004e6:	76 cb                	jbe    8004b3 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004e8:	83 ec 08             	sub    $0x8,%esp
+  8004eb:	53                   	push   %ebx
+  8004ec:	6a 3f                	push   $0x3f
+  8004ee:	ff 55 08             	call   *0x8(%ebp)
+  8004f1:	83 c4 10             	add    $0x10,%esp
+  8004f4:	eb c8                	jmp    8004be <vprintfmt+0x200>
+  8004f6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f9:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004fc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004ff:	01 d0                	add    %edx,%eax
+  800501:	29 c8                	sub    %ecx,%eax
+  800503:	89 c7                	mov    %eax,%edi
+  800505:	eb 13                	jmp    80051a <vprintfmt+0x25c>
+  800507:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050a:	eb ed                	jmp    8004f9 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80050c:	83 ec 08             	sub    $0x8,%esp
+  80050f:	53                   	push   %ebx
+  800510:	6a 20                	push   $0x20
+  800512:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800514:	83 ef 01             	sub    $0x1,%edi
+  800517:	83 c4 10             	add    $0x10,%esp
+  80051a:	85 ff                	test   %edi,%edi
+  80051c:	7f ee                	jg     80050c <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80051e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800521:	89 45 14             	mov    %eax,0x14(%ebp)
+  800524:	e9 1d 01 00 00       	jmp    800646 <vprintfmt+0x388>
+	if (lflag >= 2)
+  800529:	83 f9 01             	cmp    $0x1,%ecx
+  80052c:	7f 1b                	jg     800549 <vprintfmt+0x28b>
+	else if (lflag)
+  80052e:	85 c9                	test   %ecx,%ecx
+  800530:	74 63                	je     800595 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800532:	8b 45 14             	mov    0x14(%ebp),%eax
+  800535:	8b 00                	mov    (%eax),%eax
+  800537:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80053a:	99                   	cltd
+  80053b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80053e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800541:	8d 40 04             	lea    0x4(%eax),%eax
+  800544:	89 45 14             	mov    %eax,0x14(%ebp)
+  800547:	eb 17                	jmp    800560 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  800549:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054c:	8b 50 04             	mov    0x4(%eax),%edx
+  80054f:	8b 00                	mov    (%eax),%eax
+  800551:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800554:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800557:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055a:	8d 40 08             	lea    0x8(%eax),%eax
+  80055d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800560:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800563:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800566:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80056b:	85 c9                	test   %ecx,%ecx
+  80056d:	0f 89 b9 00 00 00    	jns    80062c <vprintfmt+0x36e>
+				putch('-', putdat);
+  800573:	83 ec 08             	sub    $0x8,%esp
+  800576:	53                   	push   %ebx
+  800577:	6a 2d                	push   $0x2d
+  800579:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80057b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80057e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800581:	f7 da                	neg    %edx
+  800583:	83 d1 00             	adc    $0x0,%ecx
+  800586:	f7 d9                	neg    %ecx
+  800588:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80058b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800590:	e9 97 00 00 00       	jmp    80062c <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800595:	8b 45 14             	mov    0x14(%ebp),%eax
+  800598:	8b 00                	mov    (%eax),%eax
+  80059a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80059d:	99                   	cltd
+  80059e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005aa:	eb b4                	jmp    800560 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8005ac:	83 f9 01             	cmp    $0x1,%ecx
+  8005af:	7f 1b                	jg     8005cc <vprintfmt+0x30e>
+	else if (lflag)
+  8005b1:	85 c9                	test   %ecx,%ecx
+  8005b3:	74 2c                	je     8005e1 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8b 10                	mov    (%eax),%edx
+  8005ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005c5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005ca:	eb 60                	jmp    80062c <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8005cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cf:	8b 10                	mov    (%eax),%edx
+  8005d1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005d4:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005da:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005df:	eb 4b                	jmp    80062c <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8005e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e4:	8b 10                	mov    (%eax),%edx
+  8005e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005f6:	eb 34                	jmp    80062c <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8005f8:	83 f9 01             	cmp    $0x1,%ecx
+  8005fb:	7f 15                	jg     800612 <vprintfmt+0x354>
+	else if (lflag)
+  8005fd:	85 c9                	test   %ecx,%ecx
+  8005ff:	74 4d                	je     80064e <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800601:	8b 45 14             	mov    0x14(%ebp),%eax
+  800604:	8b 00                	mov    (%eax),%eax
+  800606:	99                   	cltd
+  800607:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80060a:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80060d:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800610:	eb 11                	jmp    800623 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800612:	8b 45 14             	mov    0x14(%ebp),%eax
+  800615:	8b 50 04             	mov    0x4(%eax),%edx
+  800618:	8b 00                	mov    (%eax),%eax
+  80061a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80061d:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800620:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800623:	89 d1                	mov    %edx,%ecx
+  800625:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800627:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80062c:	83 ec 0c             	sub    $0xc,%esp
+  80062f:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800633:	50                   	push   %eax
+  800634:	ff 75 e0             	push   -0x20(%ebp)
+  800637:	57                   	push   %edi
+  800638:	51                   	push   %ecx
+  800639:	52                   	push   %edx
+  80063a:	89 da                	mov    %ebx,%edx
+  80063c:	89 f0                	mov    %esi,%eax
+  80063e:	e8 98 fb ff ff       	call   8001db <printnum>
+			break;
+  800643:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800646:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800649:	e9 8e fc ff ff       	jmp    8002dc <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  80064e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800651:	8b 00                	mov    (%eax),%eax
+  800653:	99                   	cltd
+  800654:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800657:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80065a:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80065d:	eb c4                	jmp    800623 <vprintfmt+0x365>
+			putch('0', putdat);
+  80065f:	83 ec 08             	sub    $0x8,%esp
+  800662:	53                   	push   %ebx
+  800663:	6a 30                	push   $0x30
+  800665:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800667:	83 c4 08             	add    $0x8,%esp
+  80066a:	53                   	push   %ebx
+  80066b:	6a 78                	push   $0x78
+  80066d:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80066f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800672:	8b 10                	mov    (%eax),%edx
+  800674:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800679:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80067c:	8d 40 04             	lea    0x4(%eax),%eax
+  80067f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800682:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800687:	eb a3                	jmp    80062c <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800689:	83 f9 01             	cmp    $0x1,%ecx
+  80068c:	7f 1b                	jg     8006a9 <vprintfmt+0x3eb>
+	else if (lflag)
+  80068e:	85 c9                	test   %ecx,%ecx
+  800690:	74 2f                	je     8006c1 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800692:	8b 45 14             	mov    0x14(%ebp),%eax
+  800695:	8b 10                	mov    (%eax),%edx
+  800697:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069c:	8d 40 04             	lea    0x4(%eax),%eax
+  80069f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006a7:	eb 83                	jmp    80062c <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8006a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ac:	8b 10                	mov    (%eax),%edx
+  8006ae:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b1:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006bc:	e9 6b ff ff ff       	jmp    80062c <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8006c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c4:	8b 10                	mov    (%eax),%edx
+  8006c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006d6:	e9 51 ff ff ff       	jmp    80062c <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8006db:	83 ec 08             	sub    $0x8,%esp
+  8006de:	53                   	push   %ebx
+  8006df:	6a 25                	push   $0x25
+  8006e1:	ff d6                	call   *%esi
+			break;
+  8006e3:	83 c4 10             	add    $0x10,%esp
+  8006e6:	e9 5b ff ff ff       	jmp    800646 <vprintfmt+0x388>
+			putch('%', putdat);
+  8006eb:	83 ec 08             	sub    $0x8,%esp
+  8006ee:	53                   	push   %ebx
+  8006ef:	6a 25                	push   $0x25
+  8006f1:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006f3:	83 c4 10             	add    $0x10,%esp
+  8006f6:	89 f8                	mov    %edi,%eax
+  8006f8:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006fc:	74 05                	je     800703 <vprintfmt+0x445>
+  8006fe:	83 e8 01             	sub    $0x1,%eax
+  800701:	eb f5                	jmp    8006f8 <vprintfmt+0x43a>
+  800703:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800706:	e9 3b ff ff ff       	jmp    800646 <vprintfmt+0x388>
+
+0080070b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80070b:	55                   	push   %ebp
+  80070c:	89 e5                	mov    %esp,%ebp
+  80070e:	83 ec 18             	sub    $0x18,%esp
+  800711:	8b 45 08             	mov    0x8(%ebp),%eax
+  800714:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800717:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80071a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80071e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800721:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800728:	85 c0                	test   %eax,%eax
+  80072a:	74 26                	je     800752 <vsnprintf+0x47>
+  80072c:	85 d2                	test   %edx,%edx
+  80072e:	7e 22                	jle    800752 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800730:	ff 75 14             	push   0x14(%ebp)
+  800733:	ff 75 10             	push   0x10(%ebp)
+  800736:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800739:	50                   	push   %eax
+  80073a:	68 84 02 80 00       	push   $0x800284
+  80073f:	e8 7a fb ff ff       	call   8002be <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800744:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800747:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80074a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80074d:	83 c4 10             	add    $0x10,%esp
+}
+  800750:	c9                   	leave
+  800751:	c3                   	ret
+		return -E_INVAL;
+  800752:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800757:	eb f7                	jmp    800750 <vsnprintf+0x45>
+
+00800759 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800759:	55                   	push   %ebp
+  80075a:	89 e5                	mov    %esp,%ebp
+  80075c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80075f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800762:	50                   	push   %eax
+  800763:	ff 75 10             	push   0x10(%ebp)
+  800766:	ff 75 0c             	push   0xc(%ebp)
+  800769:	ff 75 08             	push   0x8(%ebp)
+  80076c:	e8 9a ff ff ff       	call   80070b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800771:	c9                   	leave
+  800772:	c3                   	ret
+
+00800773 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800773:	55                   	push   %ebp
+  800774:	89 e5                	mov    %esp,%ebp
+  800776:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800779:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077e:	eb 03                	jmp    800783 <strlen+0x10>
+		n++;
+  800780:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800783:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800787:	75 f7                	jne    800780 <strlen+0xd>
+	return n;
+}
+  800789:	5d                   	pop    %ebp
+  80078a:	c3                   	ret
+
+0080078b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80078b:	55                   	push   %ebp
+  80078c:	89 e5                	mov    %esp,%ebp
+  80078e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800791:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800794:	b8 00 00 00 00       	mov    $0x0,%eax
+  800799:	eb 03                	jmp    80079e <strnlen+0x13>
+		n++;
+  80079b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80079e:	39 d0                	cmp    %edx,%eax
+  8007a0:	74 08                	je     8007aa <strnlen+0x1f>
+  8007a2:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007a6:	75 f3                	jne    80079b <strnlen+0x10>
+  8007a8:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007aa:	89 d0                	mov    %edx,%eax
+  8007ac:	5d                   	pop    %ebp
+  8007ad:	c3                   	ret
+
+008007ae <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007ae:	55                   	push   %ebp
+  8007af:	89 e5                	mov    %esp,%ebp
+  8007b1:	53                   	push   %ebx
+  8007b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007bd:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007c1:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007c4:	83 c0 01             	add    $0x1,%eax
+  8007c7:	84 d2                	test   %dl,%dl
+  8007c9:	75 f2                	jne    8007bd <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007cb:	89 c8                	mov    %ecx,%eax
+  8007cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007d0:	c9                   	leave
+  8007d1:	c3                   	ret
+
+008007d2 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007d2:	55                   	push   %ebp
+  8007d3:	89 e5                	mov    %esp,%ebp
+  8007d5:	53                   	push   %ebx
+  8007d6:	83 ec 10             	sub    $0x10,%esp
+  8007d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007dc:	53                   	push   %ebx
+  8007dd:	e8 91 ff ff ff       	call   800773 <strlen>
+  8007e2:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007e5:	ff 75 0c             	push   0xc(%ebp)
+  8007e8:	01 d8                	add    %ebx,%eax
+  8007ea:	50                   	push   %eax
+  8007eb:	e8 be ff ff ff       	call   8007ae <strcpy>
+	return dst;
+}
+  8007f0:	89 d8                	mov    %ebx,%eax
+  8007f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007f5:	c9                   	leave
+  8007f6:	c3                   	ret
+
+008007f7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007f7:	55                   	push   %ebp
+  8007f8:	89 e5                	mov    %esp,%ebp
+  8007fa:	56                   	push   %esi
+  8007fb:	53                   	push   %ebx
+  8007fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800802:	89 f3                	mov    %esi,%ebx
+  800804:	03 5d 10             	add    0x10(%ebp),%ebx
+  800807:	89 f0                	mov    %esi,%eax
+  800809:	eb 0f                	jmp    80081a <strncpy+0x23>
+		*dst++ = *src;
+  80080b:	83 c0 01             	add    $0x1,%eax
+  80080e:	0f b6 0a             	movzbl (%edx),%ecx
+  800811:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800814:	80 f9 01             	cmp    $0x1,%cl
+  800817:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80081a:	39 d8                	cmp    %ebx,%eax
+  80081c:	75 ed                	jne    80080b <strncpy+0x14>
+	}
+	return ret;
+}
+  80081e:	89 f0                	mov    %esi,%eax
+  800820:	5b                   	pop    %ebx
+  800821:	5e                   	pop    %esi
+  800822:	5d                   	pop    %ebp
+  800823:	c3                   	ret
+
+00800824 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800824:	55                   	push   %ebp
+  800825:	89 e5                	mov    %esp,%ebp
+  800827:	56                   	push   %esi
+  800828:	53                   	push   %ebx
+  800829:	8b 75 08             	mov    0x8(%ebp),%esi
+  80082c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80082f:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800832:	89 f0                	mov    %esi,%eax
+  800834:	85 d2                	test   %edx,%edx
+  800836:	74 21                	je     800859 <strlcpy+0x35>
+  800838:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80083c:	89 f2                	mov    %esi,%edx
+  80083e:	eb 09                	jmp    800849 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800840:	83 c1 01             	add    $0x1,%ecx
+  800843:	83 c2 01             	add    $0x1,%edx
+  800846:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800849:	39 c2                	cmp    %eax,%edx
+  80084b:	74 09                	je     800856 <strlcpy+0x32>
+  80084d:	0f b6 19             	movzbl (%ecx),%ebx
+  800850:	84 db                	test   %bl,%bl
+  800852:	75 ec                	jne    800840 <strlcpy+0x1c>
+  800854:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800856:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800859:	29 f0                	sub    %esi,%eax
+}
+  80085b:	5b                   	pop    %ebx
+  80085c:	5e                   	pop    %esi
+  80085d:	5d                   	pop    %ebp
+  80085e:	c3                   	ret
+
+0080085f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80085f:	55                   	push   %ebp
+  800860:	89 e5                	mov    %esp,%ebp
+  800862:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800865:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800868:	eb 06                	jmp    800870 <strcmp+0x11>
+		p++, q++;
+  80086a:	83 c1 01             	add    $0x1,%ecx
+  80086d:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800870:	0f b6 01             	movzbl (%ecx),%eax
+  800873:	84 c0                	test   %al,%al
+  800875:	74 04                	je     80087b <strcmp+0x1c>
+  800877:	3a 02                	cmp    (%edx),%al
+  800879:	74 ef                	je     80086a <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80087b:	0f b6 c0             	movzbl %al,%eax
+  80087e:	0f b6 12             	movzbl (%edx),%edx
+  800881:	29 d0                	sub    %edx,%eax
+}
+  800883:	5d                   	pop    %ebp
+  800884:	c3                   	ret
+
+00800885 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800885:	55                   	push   %ebp
+  800886:	89 e5                	mov    %esp,%ebp
+  800888:	53                   	push   %ebx
+  800889:	8b 45 08             	mov    0x8(%ebp),%eax
+  80088c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80088f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800892:	eb 09                	jmp    80089d <strncmp+0x18>
+		n--, p++, q++;
+  800894:	83 ea 01             	sub    $0x1,%edx
+  800897:	83 c0 01             	add    $0x1,%eax
+  80089a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80089d:	85 d2                	test   %edx,%edx
+  80089f:	74 18                	je     8008b9 <strncmp+0x34>
+  8008a1:	0f b6 18             	movzbl (%eax),%ebx
+  8008a4:	84 db                	test   %bl,%bl
+  8008a6:	74 04                	je     8008ac <strncmp+0x27>
+  8008a8:	3a 19                	cmp    (%ecx),%bl
+  8008aa:	74 e8                	je     800894 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008ac:	0f b6 00             	movzbl (%eax),%eax
+  8008af:	0f b6 11             	movzbl (%ecx),%edx
+  8008b2:	29 d0                	sub    %edx,%eax
+}
+  8008b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008b7:	c9                   	leave
+  8008b8:	c3                   	ret
+		return 0;
+  8008b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008be:	eb f4                	jmp    8008b4 <strncmp+0x2f>
+
+008008c0 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008c0:	55                   	push   %ebp
+  8008c1:	89 e5                	mov    %esp,%ebp
+  8008c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008ca:	eb 03                	jmp    8008cf <strchr+0xf>
+  8008cc:	83 c0 01             	add    $0x1,%eax
+  8008cf:	0f b6 10             	movzbl (%eax),%edx
+  8008d2:	84 d2                	test   %dl,%dl
+  8008d4:	74 06                	je     8008dc <strchr+0x1c>
+		if (*s == c)
+  8008d6:	38 ca                	cmp    %cl,%dl
+  8008d8:	75 f2                	jne    8008cc <strchr+0xc>
+  8008da:	eb 05                	jmp    8008e1 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008e1:	5d                   	pop    %ebp
+  8008e2:	c3                   	ret
+
+008008e3 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008e3:	55                   	push   %ebp
+  8008e4:	89 e5                	mov    %esp,%ebp
+  8008e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008ed:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008f0:	38 ca                	cmp    %cl,%dl
+  8008f2:	74 09                	je     8008fd <strfind+0x1a>
+  8008f4:	84 d2                	test   %dl,%dl
+  8008f6:	74 05                	je     8008fd <strfind+0x1a>
+	for (; *s; s++)
+  8008f8:	83 c0 01             	add    $0x1,%eax
+  8008fb:	eb f0                	jmp    8008ed <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008fd:	5d                   	pop    %ebp
+  8008fe:	c3                   	ret
+
+008008ff <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008ff:	55                   	push   %ebp
+  800900:	89 e5                	mov    %esp,%ebp
+  800902:	57                   	push   %edi
+  800903:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800906:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800909:	85 c9                	test   %ecx,%ecx
+  80090b:	74 20                	je     80092d <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80090d:	89 f8                	mov    %edi,%eax
+  80090f:	09 c8                	or     %ecx,%eax
+  800911:	a8 03                	test   $0x3,%al
+  800913:	75 12                	jne    800927 <memset+0x28>
+		c &= 0xFF;
+  800915:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800919:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80091f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800922:	fc                   	cld
+  800923:	f3 ab                	rep stos %eax,%es:(%edi)
+  800925:	eb 06                	jmp    80092d <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800927:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80092a:	fc                   	cld
+  80092b:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80092d:	89 f8                	mov    %edi,%eax
+  80092f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800932:	c9                   	leave
+  800933:	c3                   	ret
+
+00800934 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800934:	55                   	push   %ebp
+  800935:	89 e5                	mov    %esp,%ebp
+  800937:	57                   	push   %edi
+  800938:	56                   	push   %esi
+  800939:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80093f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800942:	39 c6                	cmp    %eax,%esi
+  800944:	73 32                	jae    800978 <memmove+0x44>
+  800946:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800949:	39 d0                	cmp    %edx,%eax
+  80094b:	73 2b                	jae    800978 <memmove+0x44>
+		s += n;
+		d += n;
+  80094d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800950:	89 d6                	mov    %edx,%esi
+  800952:	09 fe                	or     %edi,%esi
+  800954:	09 ce                	or     %ecx,%esi
+  800956:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80095c:	75 0e                	jne    80096c <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80095e:	83 ef 04             	sub    $0x4,%edi
+  800961:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800964:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800967:	fd                   	std
+  800968:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80096a:	eb 09                	jmp    800975 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80096c:	83 ef 01             	sub    $0x1,%edi
+  80096f:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800972:	fd                   	std
+  800973:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800975:	fc                   	cld
+  800976:	eb 1a                	jmp    800992 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800978:	89 f2                	mov    %esi,%edx
+  80097a:	09 c2                	or     %eax,%edx
+  80097c:	09 ca                	or     %ecx,%edx
+  80097e:	f6 c2 03             	test   $0x3,%dl
+  800981:	75 0a                	jne    80098d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800983:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800986:	89 c7                	mov    %eax,%edi
+  800988:	fc                   	cld
+  800989:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80098b:	eb 05                	jmp    800992 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80098d:	89 c7                	mov    %eax,%edi
+  80098f:	fc                   	cld
+  800990:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800992:	5e                   	pop    %esi
+  800993:	5f                   	pop    %edi
+  800994:	5d                   	pop    %ebp
+  800995:	c3                   	ret
+
+00800996 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800996:	55                   	push   %ebp
+  800997:	89 e5                	mov    %esp,%ebp
+  800999:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80099c:	ff 75 10             	push   0x10(%ebp)
+  80099f:	ff 75 0c             	push   0xc(%ebp)
+  8009a2:	ff 75 08             	push   0x8(%ebp)
+  8009a5:	e8 8a ff ff ff       	call   800934 <memmove>
+}
+  8009aa:	c9                   	leave
+  8009ab:	c3                   	ret
+
+008009ac <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009ac:	55                   	push   %ebp
+  8009ad:	89 e5                	mov    %esp,%ebp
+  8009af:	56                   	push   %esi
+  8009b0:	53                   	push   %ebx
+  8009b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009b7:	89 c6                	mov    %eax,%esi
+  8009b9:	03 75 10             	add    0x10(%ebp),%esi
+  8009bc:	eb 06                	jmp    8009c4 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009be:	83 c0 01             	add    $0x1,%eax
+  8009c1:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009c4:	39 f0                	cmp    %esi,%eax
+  8009c6:	74 14                	je     8009dc <memcmp+0x30>
+		if (*s1 != *s2)
+  8009c8:	0f b6 08             	movzbl (%eax),%ecx
+  8009cb:	0f b6 1a             	movzbl (%edx),%ebx
+  8009ce:	38 d9                	cmp    %bl,%cl
+  8009d0:	74 ec                	je     8009be <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009d2:	0f b6 c1             	movzbl %cl,%eax
+  8009d5:	0f b6 db             	movzbl %bl,%ebx
+  8009d8:	29 d8                	sub    %ebx,%eax
+  8009da:	eb 05                	jmp    8009e1 <memcmp+0x35>
+	}
+
+	return 0;
+  8009dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009e1:	5b                   	pop    %ebx
+  8009e2:	5e                   	pop    %esi
+  8009e3:	5d                   	pop    %ebp
+  8009e4:	c3                   	ret
+
+008009e5 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009e5:	55                   	push   %ebp
+  8009e6:	89 e5                	mov    %esp,%ebp
+  8009e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009ee:	89 c2                	mov    %eax,%edx
+  8009f0:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009f3:	eb 03                	jmp    8009f8 <memfind+0x13>
+  8009f5:	83 c0 01             	add    $0x1,%eax
+  8009f8:	39 d0                	cmp    %edx,%eax
+  8009fa:	73 04                	jae    800a00 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009fc:	38 08                	cmp    %cl,(%eax)
+  8009fe:	75 f5                	jne    8009f5 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a00:	5d                   	pop    %ebp
+  800a01:	c3                   	ret
+
+00800a02 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a02:	55                   	push   %ebp
+  800a03:	89 e5                	mov    %esp,%ebp
+  800a05:	57                   	push   %edi
+  800a06:	56                   	push   %esi
+  800a07:	53                   	push   %ebx
+  800a08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a0b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a0e:	eb 03                	jmp    800a13 <strtol+0x11>
+		s++;
+  800a10:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a13:	0f b6 02             	movzbl (%edx),%eax
+  800a16:	3c 20                	cmp    $0x20,%al
+  800a18:	74 f6                	je     800a10 <strtol+0xe>
+  800a1a:	3c 09                	cmp    $0x9,%al
+  800a1c:	74 f2                	je     800a10 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a1e:	3c 2b                	cmp    $0x2b,%al
+  800a20:	74 2a                	je     800a4c <strtol+0x4a>
+	int neg = 0;
+  800a22:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a27:	3c 2d                	cmp    $0x2d,%al
+  800a29:	74 2b                	je     800a56 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a2b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a31:	75 0f                	jne    800a42 <strtol+0x40>
+  800a33:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a36:	74 28                	je     800a60 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a38:	85 db                	test   %ebx,%ebx
+  800a3a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a3f:	0f 44 d8             	cmove  %eax,%ebx
+  800a42:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a47:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a4a:	eb 46                	jmp    800a92 <strtol+0x90>
+		s++;
+  800a4c:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a54:	eb d5                	jmp    800a2b <strtol+0x29>
+		s++, neg = 1;
+  800a56:	83 c2 01             	add    $0x1,%edx
+  800a59:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a5e:	eb cb                	jmp    800a2b <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a60:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a64:	74 0e                	je     800a74 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a66:	85 db                	test   %ebx,%ebx
+  800a68:	75 d8                	jne    800a42 <strtol+0x40>
+		s++, base = 8;
+  800a6a:	83 c2 01             	add    $0x1,%edx
+  800a6d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a72:	eb ce                	jmp    800a42 <strtol+0x40>
+		s += 2, base = 16;
+  800a74:	83 c2 02             	add    $0x2,%edx
+  800a77:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a7c:	eb c4                	jmp    800a42 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a7e:	0f be c0             	movsbl %al,%eax
+  800a81:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a84:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a87:	7d 3a                	jge    800ac3 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a89:	83 c2 01             	add    $0x1,%edx
+  800a8c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a90:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a92:	0f b6 02             	movzbl (%edx),%eax
+  800a95:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a98:	89 f3                	mov    %esi,%ebx
+  800a9a:	80 fb 09             	cmp    $0x9,%bl
+  800a9d:	76 df                	jbe    800a7e <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a9f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800aa2:	89 f3                	mov    %esi,%ebx
+  800aa4:	80 fb 19             	cmp    $0x19,%bl
+  800aa7:	77 08                	ja     800ab1 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800aa9:	0f be c0             	movsbl %al,%eax
+  800aac:	83 e8 57             	sub    $0x57,%eax
+  800aaf:	eb d3                	jmp    800a84 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ab1:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ab4:	89 f3                	mov    %esi,%ebx
+  800ab6:	80 fb 19             	cmp    $0x19,%bl
+  800ab9:	77 08                	ja     800ac3 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800abb:	0f be c0             	movsbl %al,%eax
+  800abe:	83 e8 37             	sub    $0x37,%eax
+  800ac1:	eb c1                	jmp    800a84 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ac3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ac7:	74 05                	je     800ace <strtol+0xcc>
+		*endptr = (char *) s;
+  800ac9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800acc:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ace:	89 c8                	mov    %ecx,%eax
+  800ad0:	f7 d8                	neg    %eax
+  800ad2:	85 ff                	test   %edi,%edi
+  800ad4:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ad7:	89 c8                	mov    %ecx,%eax
+  800ad9:	5b                   	pop    %ebx
+  800ada:	5e                   	pop    %esi
+  800adb:	5f                   	pop    %edi
+  800adc:	5d                   	pop    %ebp
+  800add:	c3                   	ret
+
+00800ade <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	57                   	push   %edi
+  800ae2:	56                   	push   %esi
+  800ae3:	53                   	push   %ebx
+  800ae4:	83 ec 0c             	sub    $0xc,%esp
+  800ae7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800aea:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aed:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800af0:	85 ff                	test   %edi,%edi
+  800af2:	74 16                	je     800b0a <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800af4:	83 ec 04             	sub    $0x4,%esp
+  800af7:	56                   	push   %esi
+  800af8:	6a 00                	push   $0x0
+  800afa:	53                   	push   %ebx
+  800afb:	e8 02 ff ff ff       	call   800a02 <strtol>
+  800b00:	89 07                	mov    %eax,(%edi)
+  800b02:	83 c4 10             	add    $0x10,%esp
+  800b05:	eb 03                	jmp    800b0a <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800b07:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800b0a:	0f b6 03             	movzbl (%ebx),%eax
+  800b0d:	3c 20                	cmp    $0x20,%al
+  800b0f:	74 f6                	je     800b07 <strisl+0x29>
+  800b11:	3c 09                	cmp    $0x9,%al
+  800b13:	74 f2                	je     800b07 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b15:	3c 2b                	cmp    $0x2b,%al
+  800b17:	74 23                	je     800b3c <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800b19:	3c 2d                	cmp    $0x2d,%al
+  800b1b:	0f 94 c0             	sete   %al
+  800b1e:	0f b6 c0             	movzbl %al,%eax
+  800b21:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b23:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800b29:	75 41                	jne    800b6c <strisl+0x8e>
+  800b2b:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800b2e:	74 11                	je     800b41 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b30:	85 f6                	test   %esi,%esi
+  800b32:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b37:	0f 44 f0             	cmove  %eax,%esi
+  800b3a:	eb 30                	jmp    800b6c <strisl+0x8e>
+		s++;
+  800b3c:	83 c3 01             	add    $0x1,%ebx
+  800b3f:	eb e2                	jmp    800b23 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b41:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800b45:	74 0e                	je     800b55 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800b47:	85 f6                	test   %esi,%esi
+  800b49:	75 21                	jne    800b6c <strisl+0x8e>
+		s++, base = 8;
+  800b4b:	83 c3 01             	add    $0x1,%ebx
+  800b4e:	be 08 00 00 00       	mov    $0x8,%esi
+  800b53:	eb 17                	jmp    800b6c <strisl+0x8e>
+		s += 2, base = 16;
+  800b55:	83 c3 02             	add    $0x2,%ebx
+  800b58:	be 10 00 00 00       	mov    $0x10,%esi
+  800b5d:	eb 0d                	jmp    800b6c <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b5f:	0f be c0             	movsbl %al,%eax
+  800b62:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800b65:	39 f0                	cmp    %esi,%eax
+  800b67:	7d 38                	jge    800ba1 <strisl+0xc3>
+			return 0;
+		s++;
+  800b69:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800b6c:	0f b6 03             	movzbl (%ebx),%eax
+  800b6f:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800b72:	80 fa 09             	cmp    $0x9,%dl
+  800b75:	76 e8                	jbe    800b5f <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800b77:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800b7a:	80 fa 19             	cmp    $0x19,%dl
+  800b7d:	77 08                	ja     800b87 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800b7f:	0f be c0             	movsbl %al,%eax
+  800b82:	83 e8 57             	sub    $0x57,%eax
+  800b85:	eb de                	jmp    800b65 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b87:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800b8a:	80 fa 19             	cmp    $0x19,%dl
+  800b8d:	77 08                	ja     800b97 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800b8f:	0f be c0             	movsbl %al,%eax
+  800b92:	83 e8 37             	sub    $0x37,%eax
+  800b95:	eb ce                	jmp    800b65 <strisl+0x87>
+		else if (!*s)
+  800b97:	84 c0                	test   %al,%al
+  800b99:	0f 94 c0             	sete   %al
+  800b9c:	0f b6 c0             	movzbl %al,%eax
+  800b9f:	eb 05                	jmp    800ba6 <strisl+0xc8>
+			return 0;
+  800ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800ba6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ba9:	5b                   	pop    %ebx
+  800baa:	5e                   	pop    %esi
+  800bab:	5f                   	pop    %edi
+  800bac:	5d                   	pop    %ebp
+  800bad:	c3                   	ret
+
+00800bae <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800bae:	55                   	push   %ebp
+  800baf:	89 e5                	mov    %esp,%ebp
+  800bb1:	83 ec 10             	sub    $0x10,%esp
+  800bb4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800bb7:	89 c8                	mov    %ecx,%eax
+  800bb9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800bbe:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800bc1:	eb 0b                	jmp    800bce <touch_mem+0x20>
+		c = *(char *)page;
+  800bc3:	0f b6 10             	movzbl (%eax),%edx
+  800bc6:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800bc9:	05 00 10 00 00       	add    $0x1000,%eax
+  800bce:	39 c8                	cmp    %ecx,%eax
+  800bd0:	72 f1                	jb     800bc3 <touch_mem+0x15>
+}
+  800bd2:	c9                   	leave
+  800bd3:	c3                   	ret
+
+00800bd4 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bd4:	55                   	push   %ebp
+  800bd5:	89 e5                	mov    %esp,%ebp
+  800bd7:	57                   	push   %edi
+  800bd8:	56                   	push   %esi
+  800bd9:	53                   	push   %ebx
+	touch_mem(s, len);
+  800bda:	ff 75 0c             	push   0xc(%ebp)
+  800bdd:	ff 75 08             	push   0x8(%ebp)
+  800be0:	e8 c9 ff ff ff       	call   800bae <touch_mem>
+	asm volatile("int %1\n"
+  800be5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf0:	89 c3                	mov    %eax,%ebx
+  800bf2:	89 c7                	mov    %eax,%edi
+  800bf4:	89 c6                	mov    %eax,%esi
+  800bf6:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bf8:	83 c4 08             	add    $0x8,%esp
+  800bfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bfe:	5b                   	pop    %ebx
+  800bff:	5e                   	pop    %esi
+  800c00:	5f                   	pop    %edi
+  800c01:	5d                   	pop    %ebp
+  800c02:	c3                   	ret
+
+00800c03 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c03:	55                   	push   %ebp
+  800c04:	89 e5                	mov    %esp,%ebp
+  800c06:	57                   	push   %edi
+  800c07:	56                   	push   %esi
+  800c08:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c09:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c13:	89 d1                	mov    %edx,%ecx
+  800c15:	89 d3                	mov    %edx,%ebx
+  800c17:	89 d7                	mov    %edx,%edi
+  800c19:	89 d6                	mov    %edx,%esi
+  800c1b:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c1d:	5b                   	pop    %ebx
+  800c1e:	5e                   	pop    %esi
+  800c1f:	5f                   	pop    %edi
+  800c20:	5d                   	pop    %ebp
+  800c21:	c3                   	ret
+
+00800c22 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c22:	55                   	push   %ebp
+  800c23:	89 e5                	mov    %esp,%ebp
+  800c25:	57                   	push   %edi
+  800c26:	56                   	push   %esi
+  800c27:	53                   	push   %ebx
+  800c28:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c2b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c33:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c38:	89 cb                	mov    %ecx,%ebx
+  800c3a:	89 cf                	mov    %ecx,%edi
+  800c3c:	89 ce                	mov    %ecx,%esi
+  800c3e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c40:	85 c0                	test   %eax,%eax
+  800c42:	7f 08                	jg     800c4c <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c47:	5b                   	pop    %ebx
+  800c48:	5e                   	pop    %esi
+  800c49:	5f                   	pop    %edi
+  800c4a:	5d                   	pop    %ebp
+  800c4b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c4c:	83 ec 0c             	sub    $0xc,%esp
+  800c4f:	50                   	push   %eax
+  800c50:	6a 03                	push   $0x3
+  800c52:	68 6b 50 80 00       	push   $0x80506b
+  800c57:	6a 23                	push   $0x23
+  800c59:	68 88 50 80 00       	push   $0x805088
+  800c5e:	e8 89 f4 ff ff       	call   8000ec <_panic>
+
+00800c63 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c63:	55                   	push   %ebp
+  800c64:	89 e5                	mov    %esp,%ebp
+  800c66:	57                   	push   %edi
+  800c67:	56                   	push   %esi
+  800c68:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c69:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c6e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c73:	89 d1                	mov    %edx,%ecx
+  800c75:	89 d3                	mov    %edx,%ebx
+  800c77:	89 d7                	mov    %edx,%edi
+  800c79:	89 d6                	mov    %edx,%esi
+  800c7b:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c7d:	5b                   	pop    %ebx
+  800c7e:	5e                   	pop    %esi
+  800c7f:	5f                   	pop    %edi
+  800c80:	5d                   	pop    %ebp
+  800c81:	c3                   	ret
+
+00800c82 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c82:	55                   	push   %ebp
+  800c83:	89 e5                	mov    %esp,%ebp
+  800c85:	57                   	push   %edi
+  800c86:	56                   	push   %esi
+  800c87:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c88:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c8d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c92:	89 d1                	mov    %edx,%ecx
+  800c94:	89 d3                	mov    %edx,%ebx
+  800c96:	89 d7                	mov    %edx,%edi
+  800c98:	89 d6                	mov    %edx,%esi
+  800c9a:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c9c:	5b                   	pop    %ebx
+  800c9d:	5e                   	pop    %esi
+  800c9e:	5f                   	pop    %edi
+  800c9f:	5d                   	pop    %ebp
+  800ca0:	c3                   	ret
+
+00800ca1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ca1:	55                   	push   %ebp
+  800ca2:	89 e5                	mov    %esp,%ebp
+  800ca4:	57                   	push   %edi
+  800ca5:	56                   	push   %esi
+  800ca6:	53                   	push   %ebx
+  800ca7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800caa:	be 00 00 00 00       	mov    $0x0,%esi
+  800caf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb5:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cbd:	89 f7                	mov    %esi,%edi
+  800cbf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cc1:	85 c0                	test   %eax,%eax
+  800cc3:	7f 08                	jg     800ccd <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc8:	5b                   	pop    %ebx
+  800cc9:	5e                   	pop    %esi
+  800cca:	5f                   	pop    %edi
+  800ccb:	5d                   	pop    %ebp
+  800ccc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ccd:	83 ec 0c             	sub    $0xc,%esp
+  800cd0:	50                   	push   %eax
+  800cd1:	6a 04                	push   $0x4
+  800cd3:	68 6b 50 80 00       	push   $0x80506b
+  800cd8:	6a 23                	push   $0x23
+  800cda:	68 88 50 80 00       	push   $0x805088
+  800cdf:	e8 08 f4 ff ff       	call   8000ec <_panic>
+
+00800ce4 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ce4:	55                   	push   %ebp
+  800ce5:	89 e5                	mov    %esp,%ebp
+  800ce7:	57                   	push   %edi
+  800ce8:	56                   	push   %esi
+  800ce9:	53                   	push   %ebx
+  800cea:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ced:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf3:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cf8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cfb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cfe:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d01:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d03:	85 c0                	test   %eax,%eax
+  800d05:	7f 08                	jg     800d0f <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0a:	5b                   	pop    %ebx
+  800d0b:	5e                   	pop    %esi
+  800d0c:	5f                   	pop    %edi
+  800d0d:	5d                   	pop    %ebp
+  800d0e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d0f:	83 ec 0c             	sub    $0xc,%esp
+  800d12:	50                   	push   %eax
+  800d13:	6a 05                	push   $0x5
+  800d15:	68 6b 50 80 00       	push   $0x80506b
+  800d1a:	6a 23                	push   $0x23
+  800d1c:	68 88 50 80 00       	push   $0x805088
+  800d21:	e8 c6 f3 ff ff       	call   8000ec <_panic>
+
+00800d26 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d26:	55                   	push   %ebp
+  800d27:	89 e5                	mov    %esp,%ebp
+  800d29:	57                   	push   %edi
+  800d2a:	56                   	push   %esi
+  800d2b:	53                   	push   %ebx
+  800d2c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3a:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d3f:	89 df                	mov    %ebx,%edi
+  800d41:	89 de                	mov    %ebx,%esi
+  800d43:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d45:	85 c0                	test   %eax,%eax
+  800d47:	7f 08                	jg     800d51 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4c:	5b                   	pop    %ebx
+  800d4d:	5e                   	pop    %esi
+  800d4e:	5f                   	pop    %edi
+  800d4f:	5d                   	pop    %ebp
+  800d50:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d51:	83 ec 0c             	sub    $0xc,%esp
+  800d54:	50                   	push   %eax
+  800d55:	6a 06                	push   $0x6
+  800d57:	68 6b 50 80 00       	push   $0x80506b
+  800d5c:	6a 23                	push   $0x23
+  800d5e:	68 88 50 80 00       	push   $0x805088
+  800d63:	e8 84 f3 ff ff       	call   8000ec <_panic>
+
+00800d68 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800d68:	55                   	push   %ebp
+  800d69:	89 e5                	mov    %esp,%ebp
+  800d6b:	57                   	push   %edi
+  800d6c:	56                   	push   %esi
+  800d6d:	53                   	push   %ebx
+  800d6e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d71:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7c:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d81:	89 df                	mov    %ebx,%edi
+  800d83:	89 de                	mov    %ebx,%esi
+  800d85:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d87:	85 c0                	test   %eax,%eax
+  800d89:	7f 08                	jg     800d93 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8e:	5b                   	pop    %ebx
+  800d8f:	5e                   	pop    %esi
+  800d90:	5f                   	pop    %edi
+  800d91:	5d                   	pop    %ebp
+  800d92:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d93:	83 ec 0c             	sub    $0xc,%esp
+  800d96:	50                   	push   %eax
+  800d97:	6a 18                	push   $0x18
+  800d99:	68 6b 50 80 00       	push   $0x80506b
+  800d9e:	6a 23                	push   $0x23
+  800da0:	68 88 50 80 00       	push   $0x805088
+  800da5:	e8 42 f3 ff ff       	call   8000ec <_panic>
+
+00800daa <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800daa:	55                   	push   %ebp
+  800dab:	89 e5                	mov    %esp,%ebp
+  800dad:	57                   	push   %edi
+  800dae:	56                   	push   %esi
+  800daf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800db0:	be 00 00 00 00       	mov    $0x0,%esi
+  800db5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbb:	b8 19 00 00 00       	mov    $0x19,%eax
+  800dc0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc3:	89 f7                	mov    %esi,%edi
+  800dc5:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800dc7:	5b                   	pop    %ebx
+  800dc8:	5e                   	pop    %esi
+  800dc9:	5f                   	pop    %edi
+  800dca:	5d                   	pop    %ebp
+  800dcb:	c3                   	ret
+
+00800dcc <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800dcc:	55                   	push   %ebp
+  800dcd:	89 e5                	mov    %esp,%ebp
+  800dcf:	57                   	push   %edi
+  800dd0:	56                   	push   %esi
+  800dd1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ddd:	be 00 00 00 00       	mov    $0x0,%esi
+  800de2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800de8:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800dea:	5b                   	pop    %ebx
+  800deb:	5e                   	pop    %esi
+  800dec:	5f                   	pop    %edi
+  800ded:	5d                   	pop    %ebp
+  800dee:	c3                   	ret
+
+00800def <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800def:	55                   	push   %ebp
+  800df0:	89 e5                	mov    %esp,%ebp
+  800df2:	57                   	push   %edi
+  800df3:	56                   	push   %esi
+  800df4:	53                   	push   %ebx
+  800df5:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800df8:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800dfb:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800e01:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800e04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0a:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e0f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e12:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e15:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e17:	85 c0                	test   %eax,%eax
+  800e19:	7f 08                	jg     800e23 <sys_page_map_range+0x34>
+}
+  800e1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e1e:	5b                   	pop    %ebx
+  800e1f:	5e                   	pop    %esi
+  800e20:	5f                   	pop    %edi
+  800e21:	5d                   	pop    %ebp
+  800e22:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e23:	83 ec 0c             	sub    $0xc,%esp
+  800e26:	50                   	push   %eax
+  800e27:	6a 10                	push   $0x10
+  800e29:	68 6b 50 80 00       	push   $0x80506b
+  800e2e:	6a 23                	push   $0x23
+  800e30:	68 88 50 80 00       	push   $0x805088
+  800e35:	e8 b2 f2 ff ff       	call   8000ec <_panic>
+
+00800e3a <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e3a:	55                   	push   %ebp
+  800e3b:	89 e5                	mov    %esp,%ebp
+  800e3d:	57                   	push   %edi
+  800e3e:	56                   	push   %esi
+  800e3f:	53                   	push   %ebx
+  800e40:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e43:	be 00 00 00 00       	mov    $0x0,%esi
+  800e48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4e:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e56:	89 f7                	mov    %esi,%edi
+  800e58:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e5a:	85 c0                	test   %eax,%eax
+  800e5c:	7f 08                	jg     800e66 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e61:	5b                   	pop    %ebx
+  800e62:	5e                   	pop    %esi
+  800e63:	5f                   	pop    %edi
+  800e64:	5d                   	pop    %ebp
+  800e65:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e66:	83 ec 0c             	sub    $0xc,%esp
+  800e69:	50                   	push   %eax
+  800e6a:	6a 11                	push   $0x11
+  800e6c:	68 6b 50 80 00       	push   $0x80506b
+  800e71:	6a 23                	push   $0x23
+  800e73:	68 88 50 80 00       	push   $0x805088
+  800e78:	e8 6f f2 ff ff       	call   8000ec <_panic>
+
+00800e7d <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800e7d:	55                   	push   %ebp
+  800e7e:	89 e5                	mov    %esp,%ebp
+  800e80:	57                   	push   %edi
+  800e81:	56                   	push   %esi
+  800e82:	53                   	push   %ebx
+  800e83:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e86:	be 00 00 00 00       	mov    $0x0,%esi
+  800e8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e91:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800e96:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e99:	89 f7                	mov    %esi,%edi
+  800e9b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e9d:	85 c0                	test   %eax,%eax
+  800e9f:	7f 08                	jg     800ea9 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ea1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea4:	5b                   	pop    %ebx
+  800ea5:	5e                   	pop    %esi
+  800ea6:	5f                   	pop    %edi
+  800ea7:	5d                   	pop    %ebp
+  800ea8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea9:	83 ec 0c             	sub    $0xc,%esp
+  800eac:	50                   	push   %eax
+  800ead:	6a 1b                	push   $0x1b
+  800eaf:	68 6b 50 80 00       	push   $0x80506b
+  800eb4:	6a 23                	push   $0x23
+  800eb6:	68 88 50 80 00       	push   $0x805088
+  800ebb:	e8 2c f2 ff ff       	call   8000ec <_panic>
+
+00800ec0 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800ec0:	55                   	push   %ebp
+  800ec1:	89 e5                	mov    %esp,%ebp
+  800ec3:	57                   	push   %edi
+  800ec4:	56                   	push   %esi
+  800ec5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ec6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ecb:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ed0:	89 d1                	mov    %edx,%ecx
+  800ed2:	89 d3                	mov    %edx,%ebx
+  800ed4:	89 d7                	mov    %edx,%edi
+  800ed6:	89 d6                	mov    %edx,%esi
+  800ed8:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800eda:	5b                   	pop    %ebx
+  800edb:	5e                   	pop    %esi
+  800edc:	5f                   	pop    %edi
+  800edd:	5d                   	pop    %ebp
+  800ede:	c3                   	ret
+
+00800edf <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800edf:	55                   	push   %ebp
+  800ee0:	89 e5                	mov    %esp,%ebp
+  800ee2:	57                   	push   %edi
+  800ee3:	56                   	push   %esi
+  800ee4:	53                   	push   %ebx
+  800ee5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ee8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eed:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef3:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ef8:	89 df                	mov    %ebx,%edi
+  800efa:	89 de                	mov    %ebx,%esi
+  800efc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800efe:	85 c0                	test   %eax,%eax
+  800f00:	7f 08                	jg     800f0a <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f05:	5b                   	pop    %ebx
+  800f06:	5e                   	pop    %esi
+  800f07:	5f                   	pop    %edi
+  800f08:	5d                   	pop    %ebp
+  800f09:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0a:	83 ec 0c             	sub    $0xc,%esp
+  800f0d:	50                   	push   %eax
+  800f0e:	6a 08                	push   $0x8
+  800f10:	68 6b 50 80 00       	push   $0x80506b
+  800f15:	6a 23                	push   $0x23
+  800f17:	68 88 50 80 00       	push   $0x805088
+  800f1c:	e8 cb f1 ff ff       	call   8000ec <_panic>
+
+00800f21 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f21:	55                   	push   %ebp
+  800f22:	89 e5                	mov    %esp,%ebp
+  800f24:	57                   	push   %edi
+  800f25:	56                   	push   %esi
+  800f26:	53                   	push   %ebx
+  800f27:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800f2a:	6a 44                	push   $0x44
+  800f2c:	ff 75 0c             	push   0xc(%ebp)
+  800f2f:	e8 7a fc ff ff       	call   800bae <touch_mem>
+	asm volatile("int %1\n"
+  800f34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3c:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f44:	89 df                	mov    %ebx,%edi
+  800f46:	89 de                	mov    %ebx,%esi
+  800f48:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f4a:	83 c4 08             	add    $0x8,%esp
+  800f4d:	85 c0                	test   %eax,%eax
+  800f4f:	7f 08                	jg     800f59 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f54:	5b                   	pop    %ebx
+  800f55:	5e                   	pop    %esi
+  800f56:	5f                   	pop    %edi
+  800f57:	5d                   	pop    %ebp
+  800f58:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f59:	83 ec 0c             	sub    $0xc,%esp
+  800f5c:	50                   	push   %eax
+  800f5d:	6a 09                	push   $0x9
+  800f5f:	68 6b 50 80 00       	push   $0x80506b
+  800f64:	6a 23                	push   $0x23
+  800f66:	68 88 50 80 00       	push   $0x805088
+  800f6b:	e8 7c f1 ff ff       	call   8000ec <_panic>
+
+00800f70 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800f70:	55                   	push   %ebp
+  800f71:	89 e5                	mov    %esp,%ebp
+  800f73:	57                   	push   %edi
+  800f74:	56                   	push   %esi
+  800f75:	53                   	push   %ebx
+  800f76:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f79:	be 00 00 00 00       	mov    $0x0,%esi
+  800f7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f84:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800f89:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f8c:	89 f7                	mov    %esi,%edi
+  800f8e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f90:	85 c0                	test   %eax,%eax
+  800f92:	7f 08                	jg     800f9c <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800f94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f97:	5b                   	pop    %ebx
+  800f98:	5e                   	pop    %esi
+  800f99:	5f                   	pop    %edi
+  800f9a:	5d                   	pop    %ebp
+  800f9b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9c:	83 ec 0c             	sub    $0xc,%esp
+  800f9f:	50                   	push   %eax
+  800fa0:	6a 1a                	push   $0x1a
+  800fa2:	68 6b 50 80 00       	push   $0x80506b
+  800fa7:	6a 23                	push   $0x23
+  800fa9:	68 88 50 80 00       	push   $0x805088
+  800fae:	e8 39 f1 ff ff       	call   8000ec <_panic>
+
+00800fb3 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  800fb3:	55                   	push   %ebp
+  800fb4:	89 e5                	mov    %esp,%ebp
+  800fb6:	57                   	push   %edi
+  800fb7:	56                   	push   %esi
+  800fb8:	53                   	push   %ebx
+  800fb9:	83 ec 0c             	sub    $0xc,%esp
+  800fbc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  800fbf:	89 d8                	mov    %ebx,%eax
+  800fc1:	c1 e0 05             	shl    $0x5,%eax
+  800fc4:	50                   	push   %eax
+  800fc5:	ff 75 0c             	push   0xc(%ebp)
+  800fc8:	e8 e1 fb ff ff       	call   800bae <touch_mem>
+	asm volatile("int %1\n"
+  800fcd:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd5:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdd:	89 f7                	mov    %esi,%edi
+  800fdf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fe1:	83 c4 08             	add    $0x8,%esp
+  800fe4:	85 c0                	test   %eax,%eax
+  800fe6:	7f 08                	jg     800ff0 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  800fe8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800feb:	5b                   	pop    %ebx
+  800fec:	5e                   	pop    %esi
+  800fed:	5f                   	pop    %edi
+  800fee:	5d                   	pop    %ebp
+  800fef:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff0:	83 ec 0c             	sub    $0xc,%esp
+  800ff3:	50                   	push   %eax
+  800ff4:	6a 13                	push   $0x13
+  800ff6:	68 6b 50 80 00       	push   $0x80506b
+  800ffb:	6a 23                	push   $0x23
+  800ffd:	68 88 50 80 00       	push   $0x805088
+  801002:	e8 e5 f0 ff ff       	call   8000ec <_panic>
+
+00801007 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801007:	55                   	push   %ebp
+  801008:	89 e5                	mov    %esp,%ebp
+  80100a:	57                   	push   %edi
+  80100b:	56                   	push   %esi
+  80100c:	53                   	push   %ebx
+  80100d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801010:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801015:	8b 55 08             	mov    0x8(%ebp),%edx
+  801018:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801020:	89 df                	mov    %ebx,%edi
+  801022:	89 de                	mov    %ebx,%esi
+  801024:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801026:	85 c0                	test   %eax,%eax
+  801028:	7f 08                	jg     801032 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80102a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80102d:	5b                   	pop    %ebx
+  80102e:	5e                   	pop    %esi
+  80102f:	5f                   	pop    %edi
+  801030:	5d                   	pop    %ebp
+  801031:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801032:	83 ec 0c             	sub    $0xc,%esp
+  801035:	50                   	push   %eax
+  801036:	6a 0a                	push   $0xa
+  801038:	68 6b 50 80 00       	push   $0x80506b
+  80103d:	6a 23                	push   $0x23
+  80103f:	68 88 50 80 00       	push   $0x805088
+  801044:	e8 a3 f0 ff ff       	call   8000ec <_panic>
+
+00801049 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801049:	55                   	push   %ebp
+  80104a:	89 e5                	mov    %esp,%ebp
+  80104c:	57                   	push   %edi
+  80104d:	56                   	push   %esi
+  80104e:	53                   	push   %ebx
+  80104f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801052:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801058:	76 1d                	jbe    801077 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80105a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801060:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801065:	be 01 00 00 00       	mov    $0x1,%esi
+  80106a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80106d:	cd 30                	int    $0x30
+}
+  80106f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801072:	5b                   	pop    %ebx
+  801073:	5e                   	pop    %esi
+  801074:	5f                   	pop    %edi
+  801075:	5d                   	pop    %ebp
+  801076:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801077:	68 00 10 00 00       	push   $0x1000
+  80107c:	53                   	push   %ebx
+  80107d:	e8 2c fb ff ff       	call   800bae <touch_mem>
+  801082:	83 c4 08             	add    $0x8,%esp
+  801085:	eb d3                	jmp    80105a <sys_ipc_send+0x11>
+
+00801087 <sys_ipc_send_pages>:
+{
+  801087:	55                   	push   %ebp
+  801088:	89 e5                	mov    %esp,%ebp
+  80108a:	57                   	push   %edi
+  80108b:	56                   	push   %esi
+  80108c:	53                   	push   %ebx
+  80108d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801090:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801093:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801099:	76 18                	jbe    8010b3 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80109b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010a6:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8010a9:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8010ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ae:	5b                   	pop    %ebx
+  8010af:	5e                   	pop    %esi
+  8010b0:	5f                   	pop    %edi
+  8010b1:	5d                   	pop    %ebp
+  8010b2:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8010b3:	89 f0                	mov    %esi,%eax
+  8010b5:	c1 e0 0c             	shl    $0xc,%eax
+  8010b8:	50                   	push   %eax
+  8010b9:	53                   	push   %ebx
+  8010ba:	e8 ef fa ff ff       	call   800bae <touch_mem>
+  8010bf:	83 c4 08             	add    $0x8,%esp
+  8010c2:	eb d7                	jmp    80109b <sys_ipc_send_pages+0x14>
+
+008010c4 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8010c4:	55                   	push   %ebp
+  8010c5:	89 e5                	mov    %esp,%ebp
+  8010c7:	57                   	push   %edi
+  8010c8:	56                   	push   %esi
+  8010c9:	53                   	push   %ebx
+  8010ca:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010dd:	89 df                	mov    %ebx,%edi
+  8010df:	89 de                	mov    %ebx,%esi
+  8010e1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010e3:	85 c0                	test   %eax,%eax
+  8010e5:	7f 08                	jg     8010ef <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8010e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ea:	5b                   	pop    %ebx
+  8010eb:	5e                   	pop    %esi
+  8010ec:	5f                   	pop    %edi
+  8010ed:	5d                   	pop    %ebp
+  8010ee:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ef:	83 ec 0c             	sub    $0xc,%esp
+  8010f2:	50                   	push   %eax
+  8010f3:	6a 0d                	push   $0xd
+  8010f5:	68 6b 50 80 00       	push   $0x80506b
+  8010fa:	6a 23                	push   $0x23
+  8010fc:	68 88 50 80 00       	push   $0x805088
+  801101:	e8 e6 ef ff ff       	call   8000ec <_panic>
+
+00801106 <sys_ipc_recv>:
+{
+  801106:	55                   	push   %ebp
+  801107:	89 e5                	mov    %esp,%ebp
+  801109:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80110c:	6a 01                	push   $0x1
+  80110e:	ff 75 08             	push   0x8(%ebp)
+  801111:	e8 ae ff ff ff       	call   8010c4 <sys_ipc_recv_pages>
+}
+  801116:	c9                   	leave
+  801117:	c3                   	ret
+
+00801118 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801118:	55                   	push   %ebp
+  801119:	89 e5                	mov    %esp,%ebp
+  80111b:	57                   	push   %edi
+  80111c:	56                   	push   %esi
+  80111d:	53                   	push   %ebx
+  80111e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801121:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801124:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801127:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80112d:	77 04                	ja     801133 <sys_ipc_call+0x1b>
+  80112f:	85 f6                	test   %esi,%esi
+  801131:	75 15                	jne    801148 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801133:	8b 55 08             	mov    0x8(%ebp),%edx
+  801136:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801139:	b8 14 00 00 00       	mov    $0x14,%eax
+  80113e:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801140:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801143:	5b                   	pop    %ebx
+  801144:	5e                   	pop    %esi
+  801145:	5f                   	pop    %edi
+  801146:	5d                   	pop    %ebp
+  801147:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  801148:	89 f8                	mov    %edi,%eax
+  80114a:	c1 e0 0c             	shl    $0xc,%eax
+  80114d:	50                   	push   %eax
+  80114e:	53                   	push   %ebx
+  80114f:	e8 5a fa ff ff       	call   800bae <touch_mem>
+  801154:	83 c4 08             	add    $0x8,%esp
+  801157:	eb da                	jmp    801133 <sys_ipc_call+0x1b>
+
+00801159 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801159:	55                   	push   %ebp
+  80115a:	89 e5                	mov    %esp,%ebp
+  80115c:	57                   	push   %edi
+  80115d:	56                   	push   %esi
+  80115e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80115f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801162:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801165:	b8 15 00 00 00       	mov    $0x15,%eax
+  80116a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80116d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801170:	8b 75 18             	mov    0x18(%ebp),%esi
+  801173:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801175:	5b                   	pop    %ebx
+  801176:	5e                   	pop    %esi
+  801177:	5f                   	pop    %edi
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+
+0080117a <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	57                   	push   %edi
+  80117e:	56                   	push   %esi
+  80117f:	53                   	push   %ebx
+  801180:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801183:	6a 04                	push   $0x4
+  801185:	ff 75 08             	push   0x8(%ebp)
+  801188:	e8 21 fa ff ff       	call   800bae <touch_mem>
+	asm volatile("int %1\n"
+  80118d:	be 00 00 00 00       	mov    $0x0,%esi
+  801192:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801195:	b8 16 00 00 00       	mov    $0x16,%eax
+  80119a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a0:	89 f7                	mov    %esi,%edi
+  8011a2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011a4:	83 c4 08             	add    $0x8,%esp
+  8011a7:	85 c0                	test   %eax,%eax
+  8011a9:	7f 08                	jg     8011b3 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8011ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ae:	5b                   	pop    %ebx
+  8011af:	5e                   	pop    %esi
+  8011b0:	5f                   	pop    %edi
+  8011b1:	5d                   	pop    %ebp
+  8011b2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b3:	83 ec 0c             	sub    $0xc,%esp
+  8011b6:	50                   	push   %eax
+  8011b7:	6a 16                	push   $0x16
+  8011b9:	68 6b 50 80 00       	push   $0x80506b
+  8011be:	6a 23                	push   $0x23
+  8011c0:	68 88 50 80 00       	push   $0x805088
+  8011c5:	e8 22 ef ff ff       	call   8000ec <_panic>
+
+008011ca <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	57                   	push   %edi
+  8011ce:	56                   	push   %esi
+  8011cf:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8011d0:	6a 04                	push   $0x4
+  8011d2:	ff 75 08             	push   0x8(%ebp)
+  8011d5:	e8 d4 f9 ff ff       	call   800bae <touch_mem>
+	asm volatile("int %1\n"
+  8011da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e2:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ea:	89 df                	mov    %ebx,%edi
+  8011ec:	89 de                	mov    %ebx,%esi
+  8011ee:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8011f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f3:	5b                   	pop    %ebx
+  8011f4:	5e                   	pop    %esi
+  8011f5:	5f                   	pop    %edi
+  8011f6:	5d                   	pop    %ebp
+  8011f7:	c3                   	ret
+
+008011f8 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8011f8:	55                   	push   %ebp
+  8011f9:	89 e5                	mov    %esp,%ebp
+  8011fb:	57                   	push   %edi
+  8011fc:	56                   	push   %esi
+  8011fd:	53                   	push   %ebx
+  8011fe:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801201:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801206:	8b 55 08             	mov    0x8(%ebp),%edx
+  801209:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80120e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801213:	89 df                	mov    %ebx,%edi
+  801215:	89 de                	mov    %ebx,%esi
+  801217:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801219:	85 c0                	test   %eax,%eax
+  80121b:	7f 08                	jg     801225 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80121d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801220:	5b                   	pop    %ebx
+  801221:	5e                   	pop    %esi
+  801222:	5f                   	pop    %edi
+  801223:	5d                   	pop    %ebp
+  801224:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801225:	83 ec 0c             	sub    $0xc,%esp
+  801228:	50                   	push   %eax
+  801229:	6a 0e                	push   $0xe
+  80122b:	68 6b 50 80 00       	push   $0x80506b
+  801230:	6a 23                	push   $0x23
+  801232:	68 88 50 80 00       	push   $0x805088
+  801237:	e8 b0 ee ff ff       	call   8000ec <_panic>
+
+0080123c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80123f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801242:	05 00 00 00 30       	add    $0x30000000,%eax
+  801247:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80124a:	5d                   	pop    %ebp
+  80124b:	c3                   	ret
+
+0080124c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80124c:	55                   	push   %ebp
+  80124d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80124f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801252:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801257:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80125c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801261:	5d                   	pop    %ebp
+  801262:	c3                   	ret
+
+00801263 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801263:	55                   	push   %ebp
+  801264:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801266:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  80126b:	a8 01                	test   $0x1,%al
+  80126d:	74 3c                	je     8012ab <fd_alloc+0x48>
+  80126f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801274:	89 c2                	mov    %eax,%edx
+  801276:	c1 ea 0c             	shr    $0xc,%edx
+  801279:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801280:	89 c1                	mov    %eax,%ecx
+  801282:	05 00 10 00 00       	add    $0x1000,%eax
+  801287:	f6 c2 01             	test   $0x1,%dl
+  80128a:	74 13                	je     80129f <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80128c:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801291:	75 e1                	jne    801274 <fd_alloc+0x11>
+  801293:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801298:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80129d:	eb 05                	jmp    8012a4 <fd_alloc+0x41>
+			return 0;
+  80129f:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8012a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a7:	89 0a                	mov    %ecx,(%edx)
+}
+  8012a9:	5d                   	pop    %ebp
+  8012aa:	c3                   	ret
+  8012ab:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8012b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b5:	eb ed                	jmp    8012a4 <fd_alloc+0x41>
+
+008012b7 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8012b7:	55                   	push   %ebp
+  8012b8:	89 e5                	mov    %esp,%ebp
+  8012ba:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8012bd:	83 f8 1f             	cmp    $0x1f,%eax
+  8012c0:	77 30                	ja     8012f2 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8012c2:	c1 e0 0c             	shl    $0xc,%eax
+  8012c5:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8012ca:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012d0:	f6 c2 01             	test   $0x1,%dl
+  8012d3:	74 24                	je     8012f9 <fd_lookup+0x42>
+  8012d5:	89 c2                	mov    %eax,%edx
+  8012d7:	c1 ea 0c             	shr    $0xc,%edx
+  8012da:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012e1:	f6 c2 01             	test   $0x1,%dl
+  8012e4:	74 1a                	je     801300 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8012e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012e9:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8012eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012f0:	5d                   	pop    %ebp
+  8012f1:	c3                   	ret
+		return -E_INVAL;
+  8012f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012f7:	eb f7                	jmp    8012f0 <fd_lookup+0x39>
+		return -E_INVAL;
+  8012f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012fe:	eb f0                	jmp    8012f0 <fd_lookup+0x39>
+  801300:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801305:	eb e9                	jmp    8012f0 <fd_lookup+0x39>
+
+00801307 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801307:	55                   	push   %ebp
+  801308:	89 e5                	mov    %esp,%ebp
+  80130a:	53                   	push   %ebx
+  80130b:	83 ec 04             	sub    $0x4,%esp
+  80130e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801311:	b8 14 51 80 00       	mov    $0x805114,%eax
+  801316:	8b 18                	mov    (%eax),%ebx
+  801318:	85 db                	test   %ebx,%ebx
+  80131a:	74 0e                	je     80132a <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  80131c:	83 c0 04             	add    $0x4,%eax
+  80131f:	39 13                	cmp    %edx,(%ebx)
+  801321:	75 f3                	jne    801316 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801323:	b8 00 00 00 00       	mov    $0x0,%eax
+  801328:	eb 1f                	jmp    801349 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80132a:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80132f:	8b 40 48             	mov    0x48(%eax),%eax
+  801332:	83 ec 04             	sub    $0x4,%esp
+  801335:	52                   	push   %edx
+  801336:	50                   	push   %eax
+  801337:	68 98 50 80 00       	push   $0x805098
+  80133c:	e8 86 ee ff ff       	call   8001c7 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801341:	83 c4 10             	add    $0x10,%esp
+  801344:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801349:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80134c:	89 1a                	mov    %ebx,(%edx)
+}
+  80134e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801351:	c9                   	leave
+  801352:	c3                   	ret
+
+00801353 <fd_close>:
+{
+  801353:	55                   	push   %ebp
+  801354:	89 e5                	mov    %esp,%ebp
+  801356:	57                   	push   %edi
+  801357:	56                   	push   %esi
+  801358:	53                   	push   %ebx
+  801359:	83 ec 24             	sub    $0x24,%esp
+  80135c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80135f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801362:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801365:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801366:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80136c:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80136f:	50                   	push   %eax
+  801370:	e8 42 ff ff ff       	call   8012b7 <fd_lookup>
+  801375:	89 c3                	mov    %eax,%ebx
+  801377:	83 c4 10             	add    $0x10,%esp
+  80137a:	85 c0                	test   %eax,%eax
+  80137c:	78 05                	js     801383 <fd_close+0x30>
+	    || fd != fd2)
+  80137e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801381:	74 16                	je     801399 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801383:	89 f8                	mov    %edi,%eax
+  801385:	84 c0                	test   %al,%al
+  801387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80138f:	89 d8                	mov    %ebx,%eax
+  801391:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801394:	5b                   	pop    %ebx
+  801395:	5e                   	pop    %esi
+  801396:	5f                   	pop    %edi
+  801397:	5d                   	pop    %ebp
+  801398:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801399:	83 ec 08             	sub    $0x8,%esp
+  80139c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80139f:	50                   	push   %eax
+  8013a0:	ff 36                	push   (%esi)
+  8013a2:	e8 60 ff ff ff       	call   801307 <dev_lookup>
+  8013a7:	89 c3                	mov    %eax,%ebx
+  8013a9:	83 c4 10             	add    $0x10,%esp
+  8013ac:	85 c0                	test   %eax,%eax
+  8013ae:	78 1a                	js     8013ca <fd_close+0x77>
+		if (dev->dev_close)
+  8013b0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013b3:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8013b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8013bb:	85 c0                	test   %eax,%eax
+  8013bd:	74 0b                	je     8013ca <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8013bf:	83 ec 0c             	sub    $0xc,%esp
+  8013c2:	56                   	push   %esi
+  8013c3:	ff d0                	call   *%eax
+  8013c5:	89 c3                	mov    %eax,%ebx
+  8013c7:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8013ca:	83 ec 08             	sub    $0x8,%esp
+  8013cd:	56                   	push   %esi
+  8013ce:	6a 00                	push   $0x0
+  8013d0:	e8 51 f9 ff ff       	call   800d26 <sys_page_unmap>
+	return r;
+  8013d5:	83 c4 10             	add    $0x10,%esp
+  8013d8:	eb b5                	jmp    80138f <fd_close+0x3c>
+
+008013da <close>:
+
+int
+close(int fdnum)
+{
+  8013da:	55                   	push   %ebp
+  8013db:	89 e5                	mov    %esp,%ebp
+  8013dd:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013e3:	50                   	push   %eax
+  8013e4:	ff 75 08             	push   0x8(%ebp)
+  8013e7:	e8 cb fe ff ff       	call   8012b7 <fd_lookup>
+  8013ec:	83 c4 10             	add    $0x10,%esp
+  8013ef:	85 c0                	test   %eax,%eax
+  8013f1:	79 02                	jns    8013f5 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8013f3:	c9                   	leave
+  8013f4:	c3                   	ret
+		return fd_close(fd, 1);
+  8013f5:	83 ec 08             	sub    $0x8,%esp
+  8013f8:	6a 01                	push   $0x1
+  8013fa:	ff 75 f4             	push   -0xc(%ebp)
+  8013fd:	e8 51 ff ff ff       	call   801353 <fd_close>
+  801402:	83 c4 10             	add    $0x10,%esp
+  801405:	eb ec                	jmp    8013f3 <close+0x19>
+
+00801407 <close_all>:
+
+void
+close_all(void)
+{
+  801407:	55                   	push   %ebp
+  801408:	89 e5                	mov    %esp,%ebp
+  80140a:	53                   	push   %ebx
+  80140b:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80140e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801413:	83 ec 0c             	sub    $0xc,%esp
+  801416:	53                   	push   %ebx
+  801417:	e8 be ff ff ff       	call   8013da <close>
+	for (i = 0; i < MAXFD; i++)
+  80141c:	83 c3 01             	add    $0x1,%ebx
+  80141f:	83 c4 10             	add    $0x10,%esp
+  801422:	83 fb 20             	cmp    $0x20,%ebx
+  801425:	75 ec                	jne    801413 <close_all+0xc>
+}
+  801427:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80142a:	c9                   	leave
+  80142b:	c3                   	ret
+
+0080142c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80142c:	55                   	push   %ebp
+  80142d:	89 e5                	mov    %esp,%ebp
+  80142f:	57                   	push   %edi
+  801430:	56                   	push   %esi
+  801431:	53                   	push   %ebx
+  801432:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801435:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801438:	50                   	push   %eax
+  801439:	ff 75 08             	push   0x8(%ebp)
+  80143c:	e8 76 fe ff ff       	call   8012b7 <fd_lookup>
+  801441:	89 c3                	mov    %eax,%ebx
+  801443:	83 c4 10             	add    $0x10,%esp
+  801446:	85 c0                	test   %eax,%eax
+  801448:	78 7f                	js     8014c9 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80144a:	83 ec 0c             	sub    $0xc,%esp
+  80144d:	ff 75 0c             	push   0xc(%ebp)
+  801450:	e8 85 ff ff ff       	call   8013da <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801455:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801458:	c1 e6 0c             	shl    $0xc,%esi
+  80145b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801461:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801464:	89 3c 24             	mov    %edi,(%esp)
+  801467:	e8 e0 fd ff ff       	call   80124c <fd2data>
+  80146c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80146e:	89 34 24             	mov    %esi,(%esp)
+  801471:	e8 d6 fd ff ff       	call   80124c <fd2data>
+  801476:	83 c4 10             	add    $0x10,%esp
+  801479:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80147c:	89 d8                	mov    %ebx,%eax
+  80147e:	c1 e8 16             	shr    $0x16,%eax
+  801481:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801488:	a8 01                	test   $0x1,%al
+  80148a:	74 11                	je     80149d <dup+0x71>
+  80148c:	89 d8                	mov    %ebx,%eax
+  80148e:	c1 e8 0c             	shr    $0xc,%eax
+  801491:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801498:	f6 c2 01             	test   $0x1,%dl
+  80149b:	75 36                	jne    8014d3 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80149d:	89 f8                	mov    %edi,%eax
+  80149f:	c1 e8 0c             	shr    $0xc,%eax
+  8014a2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014a9:	83 ec 0c             	sub    $0xc,%esp
+  8014ac:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014b1:	50                   	push   %eax
+  8014b2:	56                   	push   %esi
+  8014b3:	6a 00                	push   $0x0
+  8014b5:	57                   	push   %edi
+  8014b6:	6a 00                	push   $0x0
+  8014b8:	e8 27 f8 ff ff       	call   800ce4 <sys_page_map>
+  8014bd:	89 c3                	mov    %eax,%ebx
+  8014bf:	83 c4 20             	add    $0x20,%esp
+  8014c2:	85 c0                	test   %eax,%eax
+  8014c4:	78 33                	js     8014f9 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8014c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8014c9:	89 d8                	mov    %ebx,%eax
+  8014cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ce:	5b                   	pop    %ebx
+  8014cf:	5e                   	pop    %esi
+  8014d0:	5f                   	pop    %edi
+  8014d1:	5d                   	pop    %ebp
+  8014d2:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8014d3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014da:	83 ec 0c             	sub    $0xc,%esp
+  8014dd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014e2:	50                   	push   %eax
+  8014e3:	ff 75 d4             	push   -0x2c(%ebp)
+  8014e6:	6a 00                	push   $0x0
+  8014e8:	53                   	push   %ebx
+  8014e9:	6a 00                	push   $0x0
+  8014eb:	e8 f4 f7 ff ff       	call   800ce4 <sys_page_map>
+  8014f0:	89 c3                	mov    %eax,%ebx
+  8014f2:	83 c4 20             	add    $0x20,%esp
+  8014f5:	85 c0                	test   %eax,%eax
+  8014f7:	79 a4                	jns    80149d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8014f9:	83 ec 08             	sub    $0x8,%esp
+  8014fc:	56                   	push   %esi
+  8014fd:	6a 00                	push   $0x0
+  8014ff:	e8 22 f8 ff ff       	call   800d26 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801504:	83 c4 08             	add    $0x8,%esp
+  801507:	ff 75 d4             	push   -0x2c(%ebp)
+  80150a:	6a 00                	push   $0x0
+  80150c:	e8 15 f8 ff ff       	call   800d26 <sys_page_unmap>
+	return r;
+  801511:	83 c4 10             	add    $0x10,%esp
+  801514:	eb b3                	jmp    8014c9 <dup+0x9d>
+
+00801516 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801516:	55                   	push   %ebp
+  801517:	89 e5                	mov    %esp,%ebp
+  801519:	56                   	push   %esi
+  80151a:	53                   	push   %ebx
+  80151b:	83 ec 18             	sub    $0x18,%esp
+  80151e:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801521:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801524:	50                   	push   %eax
+  801525:	56                   	push   %esi
+  801526:	e8 8c fd ff ff       	call   8012b7 <fd_lookup>
+  80152b:	83 c4 10             	add    $0x10,%esp
+  80152e:	85 c0                	test   %eax,%eax
+  801530:	78 3c                	js     80156e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801532:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801535:	83 ec 08             	sub    $0x8,%esp
+  801538:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80153b:	50                   	push   %eax
+  80153c:	ff 33                	push   (%ebx)
+  80153e:	e8 c4 fd ff ff       	call   801307 <dev_lookup>
+  801543:	83 c4 10             	add    $0x10,%esp
+  801546:	85 c0                	test   %eax,%eax
+  801548:	78 24                	js     80156e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80154a:	8b 43 08             	mov    0x8(%ebx),%eax
+  80154d:	83 e0 03             	and    $0x3,%eax
+  801550:	83 f8 01             	cmp    $0x1,%eax
+  801553:	74 20                	je     801575 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801555:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801558:	8b 40 08             	mov    0x8(%eax),%eax
+  80155b:	85 c0                	test   %eax,%eax
+  80155d:	74 37                	je     801596 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80155f:	83 ec 04             	sub    $0x4,%esp
+  801562:	ff 75 10             	push   0x10(%ebp)
+  801565:	ff 75 0c             	push   0xc(%ebp)
+  801568:	53                   	push   %ebx
+  801569:	ff d0                	call   *%eax
+  80156b:	83 c4 10             	add    $0x10,%esp
+}
+  80156e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801571:	5b                   	pop    %ebx
+  801572:	5e                   	pop    %esi
+  801573:	5d                   	pop    %ebp
+  801574:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801575:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80157a:	8b 40 48             	mov    0x48(%eax),%eax
+  80157d:	83 ec 04             	sub    $0x4,%esp
+  801580:	56                   	push   %esi
+  801581:	50                   	push   %eax
+  801582:	68 d9 50 80 00       	push   $0x8050d9
+  801587:	e8 3b ec ff ff       	call   8001c7 <cprintf>
+		return -E_INVAL;
+  80158c:	83 c4 10             	add    $0x10,%esp
+  80158f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801594:	eb d8                	jmp    80156e <read+0x58>
+		return -E_NOT_SUPP;
+  801596:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80159b:	eb d1                	jmp    80156e <read+0x58>
+
+0080159d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80159d:	55                   	push   %ebp
+  80159e:	89 e5                	mov    %esp,%ebp
+  8015a0:	57                   	push   %edi
+  8015a1:	56                   	push   %esi
+  8015a2:	53                   	push   %ebx
+  8015a3:	83 ec 0c             	sub    $0xc,%esp
+  8015a6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015a9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8015ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b1:	eb 02                	jmp    8015b5 <readn+0x18>
+  8015b3:	01 c3                	add    %eax,%ebx
+  8015b5:	39 f3                	cmp    %esi,%ebx
+  8015b7:	73 21                	jae    8015da <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015b9:	83 ec 04             	sub    $0x4,%esp
+  8015bc:	89 f0                	mov    %esi,%eax
+  8015be:	29 d8                	sub    %ebx,%eax
+  8015c0:	50                   	push   %eax
+  8015c1:	89 d8                	mov    %ebx,%eax
+  8015c3:	03 45 0c             	add    0xc(%ebp),%eax
+  8015c6:	50                   	push   %eax
+  8015c7:	57                   	push   %edi
+  8015c8:	e8 49 ff ff ff       	call   801516 <read>
+		if (m < 0)
+  8015cd:	83 c4 10             	add    $0x10,%esp
+  8015d0:	85 c0                	test   %eax,%eax
+  8015d2:	78 04                	js     8015d8 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8015d4:	75 dd                	jne    8015b3 <readn+0x16>
+  8015d6:	eb 02                	jmp    8015da <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015d8:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8015da:	89 d8                	mov    %ebx,%eax
+  8015dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015df:	5b                   	pop    %ebx
+  8015e0:	5e                   	pop    %esi
+  8015e1:	5f                   	pop    %edi
+  8015e2:	5d                   	pop    %ebp
+  8015e3:	c3                   	ret
+
+008015e4 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8015e4:	55                   	push   %ebp
+  8015e5:	89 e5                	mov    %esp,%ebp
+  8015e7:	56                   	push   %esi
+  8015e8:	53                   	push   %ebx
+  8015e9:	83 ec 18             	sub    $0x18,%esp
+  8015ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015ef:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015f2:	50                   	push   %eax
+  8015f3:	53                   	push   %ebx
+  8015f4:	e8 be fc ff ff       	call   8012b7 <fd_lookup>
+  8015f9:	83 c4 10             	add    $0x10,%esp
+  8015fc:	85 c0                	test   %eax,%eax
+  8015fe:	78 37                	js     801637 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801600:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801603:	83 ec 08             	sub    $0x8,%esp
+  801606:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801609:	50                   	push   %eax
+  80160a:	ff 36                	push   (%esi)
+  80160c:	e8 f6 fc ff ff       	call   801307 <dev_lookup>
+  801611:	83 c4 10             	add    $0x10,%esp
+  801614:	85 c0                	test   %eax,%eax
+  801616:	78 1f                	js     801637 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801618:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80161c:	74 20                	je     80163e <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80161e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801621:	8b 40 0c             	mov    0xc(%eax),%eax
+  801624:	85 c0                	test   %eax,%eax
+  801626:	74 37                	je     80165f <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801628:	83 ec 04             	sub    $0x4,%esp
+  80162b:	ff 75 10             	push   0x10(%ebp)
+  80162e:	ff 75 0c             	push   0xc(%ebp)
+  801631:	56                   	push   %esi
+  801632:	ff d0                	call   *%eax
+  801634:	83 c4 10             	add    $0x10,%esp
+}
+  801637:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80163a:	5b                   	pop    %ebx
+  80163b:	5e                   	pop    %esi
+  80163c:	5d                   	pop    %ebp
+  80163d:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80163e:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801643:	8b 40 48             	mov    0x48(%eax),%eax
+  801646:	83 ec 04             	sub    $0x4,%esp
+  801649:	53                   	push   %ebx
+  80164a:	50                   	push   %eax
+  80164b:	68 f5 50 80 00       	push   $0x8050f5
+  801650:	e8 72 eb ff ff       	call   8001c7 <cprintf>
+		return -E_INVAL;
+  801655:	83 c4 10             	add    $0x10,%esp
+  801658:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80165d:	eb d8                	jmp    801637 <write+0x53>
+		return -E_NOT_SUPP;
+  80165f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801664:	eb d1                	jmp    801637 <write+0x53>
+
+00801666 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801666:	55                   	push   %ebp
+  801667:	89 e5                	mov    %esp,%ebp
+  801669:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80166c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80166f:	50                   	push   %eax
+  801670:	ff 75 08             	push   0x8(%ebp)
+  801673:	e8 3f fc ff ff       	call   8012b7 <fd_lookup>
+  801678:	83 c4 10             	add    $0x10,%esp
+  80167b:	85 c0                	test   %eax,%eax
+  80167d:	78 0e                	js     80168d <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80167f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801682:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801685:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801688:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80168d:	c9                   	leave
+  80168e:	c3                   	ret
+
+0080168f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80168f:	55                   	push   %ebp
+  801690:	89 e5                	mov    %esp,%ebp
+  801692:	56                   	push   %esi
+  801693:	53                   	push   %ebx
+  801694:	83 ec 18             	sub    $0x18,%esp
+  801697:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80169a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80169d:	50                   	push   %eax
+  80169e:	53                   	push   %ebx
+  80169f:	e8 13 fc ff ff       	call   8012b7 <fd_lookup>
+  8016a4:	83 c4 10             	add    $0x10,%esp
+  8016a7:	85 c0                	test   %eax,%eax
+  8016a9:	78 34                	js     8016df <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016ab:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016ae:	83 ec 08             	sub    $0x8,%esp
+  8016b1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016b4:	50                   	push   %eax
+  8016b5:	ff 36                	push   (%esi)
+  8016b7:	e8 4b fc ff ff       	call   801307 <dev_lookup>
+  8016bc:	83 c4 10             	add    $0x10,%esp
+  8016bf:	85 c0                	test   %eax,%eax
+  8016c1:	78 1c                	js     8016df <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016c3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016c7:	74 1d                	je     8016e6 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8016c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016cc:	8b 40 18             	mov    0x18(%eax),%eax
+  8016cf:	85 c0                	test   %eax,%eax
+  8016d1:	74 34                	je     801707 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8016d3:	83 ec 08             	sub    $0x8,%esp
+  8016d6:	ff 75 0c             	push   0xc(%ebp)
+  8016d9:	56                   	push   %esi
+  8016da:	ff d0                	call   *%eax
+  8016dc:	83 c4 10             	add    $0x10,%esp
+}
+  8016df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016e2:	5b                   	pop    %ebx
+  8016e3:	5e                   	pop    %esi
+  8016e4:	5d                   	pop    %ebp
+  8016e5:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8016e6:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8016eb:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8016ee:	83 ec 04             	sub    $0x4,%esp
+  8016f1:	53                   	push   %ebx
+  8016f2:	50                   	push   %eax
+  8016f3:	68 b8 50 80 00       	push   $0x8050b8
+  8016f8:	e8 ca ea ff ff       	call   8001c7 <cprintf>
+		return -E_INVAL;
+  8016fd:	83 c4 10             	add    $0x10,%esp
+  801700:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801705:	eb d8                	jmp    8016df <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801707:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80170c:	eb d1                	jmp    8016df <ftruncate+0x50>
+
+0080170e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80170e:	55                   	push   %ebp
+  80170f:	89 e5                	mov    %esp,%ebp
+  801711:	56                   	push   %esi
+  801712:	53                   	push   %ebx
+  801713:	83 ec 18             	sub    $0x18,%esp
+  801716:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801719:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80171c:	50                   	push   %eax
+  80171d:	ff 75 08             	push   0x8(%ebp)
+  801720:	e8 92 fb ff ff       	call   8012b7 <fd_lookup>
+  801725:	83 c4 10             	add    $0x10,%esp
+  801728:	85 c0                	test   %eax,%eax
+  80172a:	78 49                	js     801775 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80172c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80172f:	83 ec 08             	sub    $0x8,%esp
+  801732:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801735:	50                   	push   %eax
+  801736:	ff 36                	push   (%esi)
+  801738:	e8 ca fb ff ff       	call   801307 <dev_lookup>
+  80173d:	83 c4 10             	add    $0x10,%esp
+  801740:	85 c0                	test   %eax,%eax
+  801742:	78 31                	js     801775 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801744:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801747:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80174b:	74 2f                	je     80177c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80174d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801750:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801757:	00 00 00 
+	stat->st_isdir = 0;
+  80175a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801761:	00 00 00 
+	stat->st_dev = dev;
+  801764:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80176a:	83 ec 08             	sub    $0x8,%esp
+  80176d:	53                   	push   %ebx
+  80176e:	56                   	push   %esi
+  80176f:	ff 50 14             	call   *0x14(%eax)
+  801772:	83 c4 10             	add    $0x10,%esp
+}
+  801775:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801778:	5b                   	pop    %ebx
+  801779:	5e                   	pop    %esi
+  80177a:	5d                   	pop    %ebp
+  80177b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80177c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801781:	eb f2                	jmp    801775 <fstat+0x67>
+
+00801783 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801783:	55                   	push   %ebp
+  801784:	89 e5                	mov    %esp,%ebp
+  801786:	56                   	push   %esi
+  801787:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801788:	83 ec 08             	sub    $0x8,%esp
+  80178b:	6a 00                	push   $0x0
+  80178d:	ff 75 08             	push   0x8(%ebp)
+  801790:	e8 bc 02 00 00       	call   801a51 <open>
+  801795:	89 c3                	mov    %eax,%ebx
+  801797:	83 c4 10             	add    $0x10,%esp
+  80179a:	85 c0                	test   %eax,%eax
+  80179c:	78 1b                	js     8017b9 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80179e:	83 ec 08             	sub    $0x8,%esp
+  8017a1:	ff 75 0c             	push   0xc(%ebp)
+  8017a4:	50                   	push   %eax
+  8017a5:	e8 64 ff ff ff       	call   80170e <fstat>
+  8017aa:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8017ac:	89 1c 24             	mov    %ebx,(%esp)
+  8017af:	e8 26 fc ff ff       	call   8013da <close>
+	return r;
+  8017b4:	83 c4 10             	add    $0x10,%esp
+  8017b7:	89 f3                	mov    %esi,%ebx
+}
+  8017b9:	89 d8                	mov    %ebx,%eax
+  8017bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017be:	5b                   	pop    %ebx
+  8017bf:	5e                   	pop    %esi
+  8017c0:	5d                   	pop    %ebp
+  8017c1:	c3                   	ret
+
+008017c2 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  8017c2:	55                   	push   %ebp
+  8017c3:	89 e5                	mov    %esp,%ebp
+  8017c5:	57                   	push   %edi
+  8017c6:	56                   	push   %esi
+  8017c7:	53                   	push   %ebx
+  8017c8:	83 ec 0c             	sub    $0xc,%esp
+  8017cb:	89 c7                	mov    %eax,%edi
+  8017cd:	89 d3                	mov    %edx,%ebx
+  8017cf:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8017d1:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8017d8:	74 2d                	je     801807 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017da:	6a 07                	push   $0x7
+  8017dc:	68 00 f0 80 00       	push   $0x80f000
+  8017e1:	57                   	push   %edi
+  8017e2:	ff 35 00 70 80 00    	push   0x807000
+  8017e8:	e8 4e 31 00 00       	call   80493b <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  8017ed:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8017f4:	6a 00                	push   $0x0
+  8017f6:	56                   	push   %esi
+  8017f7:	53                   	push   %ebx
+  8017f8:	6a 00                	push   $0x0
+  8017fa:	e8 ee 2f 00 00       	call   8047ed <ipc_recv_pages>
+}
+  8017ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801802:	5b                   	pop    %ebx
+  801803:	5e                   	pop    %esi
+  801804:	5f                   	pop    %edi
+  801805:	5d                   	pop    %ebp
+  801806:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801807:	83 ec 0c             	sub    $0xc,%esp
+  80180a:	6a 01                	push   $0x1
+  80180c:	e8 1f 32 00 00       	call   804a30 <ipc_find_env>
+  801811:	a3 00 70 80 00       	mov    %eax,0x807000
+  801816:	83 c4 10             	add    $0x10,%esp
+  801819:	eb bf                	jmp    8017da <fsipc_pages+0x18>
+
+0080181b <fsipc>:
+{
+  80181b:	55                   	push   %ebp
+  80181c:	89 e5                	mov    %esp,%ebp
+  80181e:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801821:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801826:	e8 97 ff ff ff       	call   8017c2 <fsipc_pages>
+}
+  80182b:	c9                   	leave
+  80182c:	c3                   	ret
+
+0080182d <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80182d:	55                   	push   %ebp
+  80182e:	89 e5                	mov    %esp,%ebp
+  801830:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801833:	8b 45 08             	mov    0x8(%ebp),%eax
+  801836:	8b 40 0c             	mov    0xc(%eax),%eax
+  801839:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  80183e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801841:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801846:	ba 00 00 00 00       	mov    $0x0,%edx
+  80184b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801850:	e8 c6 ff ff ff       	call   80181b <fsipc>
+}
+  801855:	c9                   	leave
+  801856:	c3                   	ret
+
+00801857 <devfile_flush>:
+{
+  801857:	55                   	push   %ebp
+  801858:	89 e5                	mov    %esp,%ebp
+  80185a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80185d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801860:	8b 40 0c             	mov    0xc(%eax),%eax
+  801863:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801868:	ba 00 00 00 00       	mov    $0x0,%edx
+  80186d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801872:	e8 a4 ff ff ff       	call   80181b <fsipc>
+}
+  801877:	c9                   	leave
+  801878:	c3                   	ret
+
+00801879 <devfile_stat>:
+{
+  801879:	55                   	push   %ebp
+  80187a:	89 e5                	mov    %esp,%ebp
+  80187c:	53                   	push   %ebx
+  80187d:	83 ec 04             	sub    $0x4,%esp
+  801880:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801883:	8b 45 08             	mov    0x8(%ebp),%eax
+  801886:	8b 40 0c             	mov    0xc(%eax),%eax
+  801889:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80188e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801893:	b8 05 00 00 00       	mov    $0x5,%eax
+  801898:	e8 7e ff ff ff       	call   80181b <fsipc>
+  80189d:	85 c0                	test   %eax,%eax
+  80189f:	78 2c                	js     8018cd <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018a1:	83 ec 08             	sub    $0x8,%esp
+  8018a4:	68 00 f0 80 00       	push   $0x80f000
+  8018a9:	53                   	push   %ebx
+  8018aa:	e8 ff ee ff ff       	call   8007ae <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8018af:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  8018b4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018ba:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  8018bf:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8018c5:	83 c4 10             	add    $0x10,%esp
+  8018c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d0:	c9                   	leave
+  8018d1:	c3                   	ret
+
+008018d2 <devfile_write>:
+{
+  8018d2:	55                   	push   %ebp
+  8018d3:	89 e5                	mov    %esp,%ebp
+  8018d5:	83 ec 0c             	sub    $0xc,%esp
+  8018d8:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8018db:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8018e0:	39 d0                	cmp    %edx,%eax
+  8018e2:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8018e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e8:	8b 52 0c             	mov    0xc(%edx),%edx
+  8018eb:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  8018f1:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8018f6:	50                   	push   %eax
+  8018f7:	ff 75 0c             	push   0xc(%ebp)
+  8018fa:	68 08 f0 80 00       	push   $0x80f008
+  8018ff:	e8 30 f0 ff ff       	call   800934 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801904:	ba 00 00 00 00       	mov    $0x0,%edx
+  801909:	b8 04 00 00 00       	mov    $0x4,%eax
+  80190e:	e8 08 ff ff ff       	call   80181b <fsipc>
+}
+  801913:	c9                   	leave
+  801914:	c3                   	ret
+
+00801915 <devfile_read>:
+{
+  801915:	55                   	push   %ebp
+  801916:	89 e5                	mov    %esp,%ebp
+  801918:	57                   	push   %edi
+  801919:	56                   	push   %esi
+  80191a:	53                   	push   %ebx
+  80191b:	83 ec 1c             	sub    $0x1c,%esp
+  80191e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801921:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801924:	89 fe                	mov    %edi,%esi
+  801926:	c1 ee 0c             	shr    $0xc,%esi
+  801929:	b8 20 00 00 00       	mov    $0x20,%eax
+  80192e:	39 c6                	cmp    %eax,%esi
+  801930:	0f 47 f0             	cmova  %eax,%esi
+  801933:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801936:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80193b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80193e:	eb 14                	jmp    801954 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801940:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801947:	05 00 10 00 00       	add    $0x1000,%eax
+  80194c:	f6 c6 06             	test   $0x6,%dh
+  80194f:	75 42                	jne    801993 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801951:	83 c1 01             	add    $0x1,%ecx
+  801954:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801957:	39 f1                	cmp    %esi,%ecx
+  801959:	0f 84 95 00 00 00    	je     8019f4 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  80195f:	89 c2                	mov    %eax,%edx
+  801961:	c1 ea 16             	shr    $0x16,%edx
+  801964:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  80196b:	f6 c2 01             	test   $0x1,%dl
+  80196e:	74 23                	je     801993 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801970:	89 c2                	mov    %eax,%edx
+  801972:	c1 ea 0c             	shr    $0xc,%edx
+  801975:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  80197c:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801982:	74 0f                	je     801993 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801984:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  80198b:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801991:	75 ad                	jne    801940 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801993:	85 c9                	test   %ecx,%ecx
+  801995:	74 11                	je     8019a8 <devfile_read+0x93>
+  801997:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80199e:	75 08                	jne    8019a8 <devfile_read+0x93>
+  8019a0:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  8019a6:	74 50                	je     8019f8 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019a8:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8019ab:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  8019b0:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8019b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019bb:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019c0:	e8 56 fe ff ff       	call   80181b <fsipc>
+  8019c5:	89 c6                	mov    %eax,%esi
+  8019c7:	85 c0                	test   %eax,%eax
+  8019c9:	78 1f                	js     8019ea <devfile_read+0xd5>
+	assert(r <= n);
+  8019cb:	39 c7                	cmp    %eax,%edi
+  8019cd:	72 50                	jb     801a1f <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  8019cf:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8019d4:	7f 62                	jg     801a38 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  8019d6:	83 ec 04             	sub    $0x4,%esp
+  8019d9:	50                   	push   %eax
+  8019da:	68 00 f0 80 00       	push   $0x80f000
+  8019df:	ff 75 0c             	push   0xc(%ebp)
+  8019e2:	e8 4d ef ff ff       	call   800934 <memmove>
+	return r;
+  8019e7:	83 c4 10             	add    $0x10,%esp
+}
+  8019ea:	89 f0                	mov    %esi,%eax
+  8019ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ef:	5b                   	pop    %ebx
+  8019f0:	5e                   	pop    %esi
+  8019f1:	5f                   	pop    %edi
+  8019f2:	5d                   	pop    %ebp
+  8019f3:	c3                   	ret
+  8019f4:	89 f1                	mov    %esi,%ecx
+  8019f6:	eb 9b                	jmp    801993 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  8019f8:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8019fb:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801a00:	89 c8                	mov    %ecx,%eax
+  801a02:	c1 e0 0c             	shl    $0xc,%eax
+  801a05:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801a0a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a0d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801a12:	e8 ab fd ff ff       	call   8017c2 <fsipc_pages>
+  801a17:	89 c6                	mov    %eax,%esi
+  801a19:	85 c0                	test   %eax,%eax
+  801a1b:	78 8b                	js     8019a8 <devfile_read+0x93>
+  801a1d:	eb cb                	jmp    8019ea <devfile_read+0xd5>
+	assert(r <= n);
+  801a1f:	68 24 51 80 00       	push   $0x805124
+  801a24:	68 2b 51 80 00       	push   $0x80512b
+  801a29:	68 a0 00 00 00       	push   $0xa0
+  801a2e:	68 40 51 80 00       	push   $0x805140
+  801a33:	e8 b4 e6 ff ff       	call   8000ec <_panic>
+	assert(r <= PGSIZE);
+  801a38:	68 4b 51 80 00       	push   $0x80514b
+  801a3d:	68 2b 51 80 00       	push   $0x80512b
+  801a42:	68 a1 00 00 00       	push   $0xa1
+  801a47:	68 40 51 80 00       	push   $0x805140
+  801a4c:	e8 9b e6 ff ff       	call   8000ec <_panic>
+
+00801a51 <open>:
+{
+  801a51:	55                   	push   %ebp
+  801a52:	89 e5                	mov    %esp,%ebp
+  801a54:	56                   	push   %esi
+  801a55:	53                   	push   %ebx
+  801a56:	83 ec 1c             	sub    $0x1c,%esp
+  801a59:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801a5c:	56                   	push   %esi
+  801a5d:	e8 11 ed ff ff       	call   800773 <strlen>
+  801a62:	83 c4 10             	add    $0x10,%esp
+  801a65:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a6a:	7f 6c                	jg     801ad8 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801a6c:	83 ec 0c             	sub    $0xc,%esp
+  801a6f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a72:	50                   	push   %eax
+  801a73:	e8 eb f7 ff ff       	call   801263 <fd_alloc>
+  801a78:	89 c3                	mov    %eax,%ebx
+  801a7a:	83 c4 10             	add    $0x10,%esp
+  801a7d:	85 c0                	test   %eax,%eax
+  801a7f:	78 3c                	js     801abd <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801a81:	83 ec 08             	sub    $0x8,%esp
+  801a84:	56                   	push   %esi
+  801a85:	68 00 f0 80 00       	push   $0x80f000
+  801a8a:	e8 1f ed ff ff       	call   8007ae <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a92:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801a97:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a9a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a9f:	e8 77 fd ff ff       	call   80181b <fsipc>
+  801aa4:	89 c3                	mov    %eax,%ebx
+  801aa6:	83 c4 10             	add    $0x10,%esp
+  801aa9:	85 c0                	test   %eax,%eax
+  801aab:	78 19                	js     801ac6 <open+0x75>
+	return fd2num(fd);
+  801aad:	83 ec 0c             	sub    $0xc,%esp
+  801ab0:	ff 75 f4             	push   -0xc(%ebp)
+  801ab3:	e8 84 f7 ff ff       	call   80123c <fd2num>
+  801ab8:	89 c3                	mov    %eax,%ebx
+  801aba:	83 c4 10             	add    $0x10,%esp
+}
+  801abd:	89 d8                	mov    %ebx,%eax
+  801abf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ac2:	5b                   	pop    %ebx
+  801ac3:	5e                   	pop    %esi
+  801ac4:	5d                   	pop    %ebp
+  801ac5:	c3                   	ret
+		fd_close(fd, 0);
+  801ac6:	83 ec 08             	sub    $0x8,%esp
+  801ac9:	6a 00                	push   $0x0
+  801acb:	ff 75 f4             	push   -0xc(%ebp)
+  801ace:	e8 80 f8 ff ff       	call   801353 <fd_close>
+		return r;
+  801ad3:	83 c4 10             	add    $0x10,%esp
+  801ad6:	eb e5                	jmp    801abd <open+0x6c>
+		return -E_BAD_PATH;
+  801ad8:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801add:	eb de                	jmp    801abd <open+0x6c>
+
+00801adf <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801adf:	55                   	push   %ebp
+  801ae0:	89 e5                	mov    %esp,%ebp
+  801ae2:	53                   	push   %ebx
+  801ae3:	83 ec 10             	sub    $0x10,%esp
+  801ae6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801ae9:	53                   	push   %ebx
+  801aea:	e8 84 ec ff ff       	call   800773 <strlen>
+  801aef:	83 c4 10             	add    $0x10,%esp
+  801af2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801af7:	7f 25                	jg     801b1e <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801af9:	83 ec 08             	sub    $0x8,%esp
+  801afc:	53                   	push   %ebx
+  801afd:	68 00 f0 80 00       	push   $0x80f000
+  801b02:	e8 a7 ec ff ff       	call   8007ae <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b07:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b0c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b11:	e8 05 fd ff ff       	call   80181b <fsipc>
+  801b16:	83 c4 10             	add    $0x10,%esp
+}
+  801b19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b1c:	c9                   	leave
+  801b1d:	c3                   	ret
+		return -E_BAD_PATH;
+  801b1e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b23:	eb f4                	jmp    801b19 <remove+0x3a>
+
+00801b25 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b25:	55                   	push   %ebp
+  801b26:	89 e5                	mov    %esp,%ebp
+  801b28:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b30:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b35:	e8 e1 fc ff ff       	call   80181b <fsipc>
+}
+  801b3a:	c9                   	leave
+  801b3b:	c3                   	ret
+
+00801b3c <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801b3c:	55                   	push   %ebp
+  801b3d:	89 e5                	mov    %esp,%ebp
+  801b3f:	53                   	push   %ebx
+  801b40:	83 ec 04             	sub    $0x4,%esp
+  801b43:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801b46:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b4b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801b50:	e8 c6 fc ff ff       	call   80181b <fsipc>
+  801b55:	85 c0                	test   %eax,%eax
+  801b57:	78 3c                	js     801b95 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801b59:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  801b5e:	89 03                	mov    %eax,(%ebx)
+  801b60:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  801b65:	89 43 04             	mov    %eax,0x4(%ebx)
+  801b68:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  801b6d:	89 43 08             	mov    %eax,0x8(%ebx)
+  801b70:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  801b75:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801b78:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  801b7d:	89 43 10             	mov    %eax,0x10(%ebx)
+  801b80:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  801b85:	89 43 14             	mov    %eax,0x14(%ebx)
+  801b88:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  801b8d:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801b90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b98:	c9                   	leave
+  801b99:	c3                   	ret
+
+00801b9a <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801b9a:	55                   	push   %ebp
+  801b9b:	89 e5                	mov    %esp,%ebp
+  801b9d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801ba0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ba3:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  801ba8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bad:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801bb2:	e8 64 fc ff ff       	call   80181b <fsipc>
+}
+  801bb7:	c9                   	leave
+  801bb8:	c3                   	ret
+
+00801bb9 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801bb9:	55                   	push   %ebp
+  801bba:	89 e5                	mov    %esp,%ebp
+  801bbc:	56                   	push   %esi
+  801bbd:	53                   	push   %ebx
+  801bbe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801bc1:	83 ec 0c             	sub    $0xc,%esp
+  801bc4:	ff 75 08             	push   0x8(%ebp)
+  801bc7:	e8 80 f6 ff ff       	call   80124c <fd2data>
+  801bcc:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801bce:	83 c4 08             	add    $0x8,%esp
+  801bd1:	68 57 51 80 00       	push   $0x805157
+  801bd6:	53                   	push   %ebx
+  801bd7:	e8 d2 eb ff ff       	call   8007ae <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801bdc:	8b 46 04             	mov    0x4(%esi),%eax
+  801bdf:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801be5:	2b 0e                	sub    (%esi),%ecx
+  801be7:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801bec:	89 c8                	mov    %ecx,%eax
+  801bee:	f7 e2                	mul    %edx
+  801bf0:	c1 ea 0c             	shr    $0xc,%edx
+  801bf3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801bf9:	29 d1                	sub    %edx,%ecx
+  801bfb:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801c01:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c08:	00 00 00 
+	stat->st_dev = &devpipe;
+  801c0b:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  801c12:	60 80 00 
+	return 0;
+}
+  801c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c1d:	5b                   	pop    %ebx
+  801c1e:	5e                   	pop    %esi
+  801c1f:	5d                   	pop    %ebp
+  801c20:	c3                   	ret
+
+00801c21 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801c21:	55                   	push   %ebp
+  801c22:	89 e5                	mov    %esp,%ebp
+  801c24:	53                   	push   %ebx
+  801c25:	83 ec 0c             	sub    $0xc,%esp
+  801c28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801c2b:	53                   	push   %ebx
+  801c2c:	6a 00                	push   $0x0
+  801c2e:	e8 f3 f0 ff ff       	call   800d26 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801c33:	89 1c 24             	mov    %ebx,(%esp)
+  801c36:	e8 11 f6 ff ff       	call   80124c <fd2data>
+  801c3b:	83 c4 08             	add    $0x8,%esp
+  801c3e:	50                   	push   %eax
+  801c3f:	6a 00                	push   $0x0
+  801c41:	e8 e0 f0 ff ff       	call   800d26 <sys_page_unmap>
+}
+  801c46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c49:	c9                   	leave
+  801c4a:	c3                   	ret
+
+00801c4b <_pipeisclosed>:
+{
+  801c4b:	55                   	push   %ebp
+  801c4c:	89 e5                	mov    %esp,%ebp
+  801c4e:	57                   	push   %edi
+  801c4f:	56                   	push   %esi
+  801c50:	53                   	push   %ebx
+  801c51:	83 ec 1c             	sub    $0x1c,%esp
+  801c54:	89 c7                	mov    %eax,%edi
+  801c56:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801c58:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801c5d:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801c60:	83 ec 0c             	sub    $0xc,%esp
+  801c63:	57                   	push   %edi
+  801c64:	e8 06 2e 00 00       	call   804a6f <pageref>
+  801c69:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c6c:	89 34 24             	mov    %esi,(%esp)
+  801c6f:	e8 fb 2d 00 00       	call   804a6f <pageref>
+		nn = thisenv->env_runs;
+  801c74:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  801c7a:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801c7d:	83 c4 10             	add    $0x10,%esp
+  801c80:	39 cb                	cmp    %ecx,%ebx
+  801c82:	74 1b                	je     801c9f <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801c84:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801c87:	75 cf                	jne    801c58 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801c89:	8b 42 58             	mov    0x58(%edx),%eax
+  801c8c:	6a 01                	push   $0x1
+  801c8e:	50                   	push   %eax
+  801c8f:	53                   	push   %ebx
+  801c90:	68 5e 51 80 00       	push   $0x80515e
+  801c95:	e8 2d e5 ff ff       	call   8001c7 <cprintf>
+  801c9a:	83 c4 10             	add    $0x10,%esp
+  801c9d:	eb b9                	jmp    801c58 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801c9f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ca2:	0f 94 c0             	sete   %al
+  801ca5:	0f b6 c0             	movzbl %al,%eax
+}
+  801ca8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cab:	5b                   	pop    %ebx
+  801cac:	5e                   	pop    %esi
+  801cad:	5f                   	pop    %edi
+  801cae:	5d                   	pop    %ebp
+  801caf:	c3                   	ret
+
+00801cb0 <devpipe_read>:
+{
+  801cb0:	55                   	push   %ebp
+  801cb1:	89 e5                	mov    %esp,%ebp
+  801cb3:	57                   	push   %edi
+  801cb4:	56                   	push   %esi
+  801cb5:	53                   	push   %ebx
+  801cb6:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801cb9:	ff 75 08             	push   0x8(%ebp)
+  801cbc:	e8 8b f5 ff ff       	call   80124c <fd2data>
+  801cc1:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801cc3:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801cc6:	8d 40 04             	lea    0x4(%eax),%eax
+  801cc9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801ccc:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801ccf:	8b 0b                	mov    (%ebx),%ecx
+  801cd1:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801cd7:	29 ce                	sub    %ecx,%esi
+  801cd9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801cde:	f7 e6                	mul    %esi
+  801ce0:	c1 ea 0c             	shr    $0xc,%edx
+  801ce3:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801ce9:	29 c6                	sub    %eax,%esi
+  801ceb:	89 f2                	mov    %esi,%edx
+  801ced:	75 43                	jne    801d32 <devpipe_read+0x82>
+		ref = pageref(p);
+  801cef:	83 ec 0c             	sub    $0xc,%esp
+  801cf2:	53                   	push   %ebx
+  801cf3:	e8 77 2d 00 00       	call   804a6f <pageref>
+  801cf8:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801cfa:	89 da                	mov    %ebx,%edx
+  801cfc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cff:	e8 47 ff ff ff       	call   801c4b <_pipeisclosed>
+  801d04:	83 c4 10             	add    $0x10,%esp
+  801d07:	85 c0                	test   %eax,%eax
+  801d09:	0f 85 c1 00 00 00    	jne    801dd0 <devpipe_read+0x120>
+	*sleeping = 1;
+  801d0f:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801d16:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801d1b:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801d1e:	75 ac                	jne    801ccc <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801d20:	83 ec 04             	sub    $0x4,%esp
+  801d23:	56                   	push   %esi
+  801d24:	57                   	push   %edi
+  801d25:	ff 75 e4             	push   -0x1c(%ebp)
+  801d28:	e8 4d f4 ff ff       	call   80117a <sys_futex_wait>
+  801d2d:	83 c4 10             	add    $0x10,%esp
+  801d30:	eb 9a                	jmp    801ccc <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801d32:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801d35:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801d39:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801d3b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801d40:	f7 e1                	mul    %ecx
+  801d42:	c1 ea 0b             	shr    $0xb,%edx
+  801d45:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801d4b:	29 c1                	sub    %eax,%ecx
+  801d4d:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801d4f:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801d54:	29 cf                	sub    %ecx,%edi
+  801d56:	39 f7                	cmp    %esi,%edi
+  801d58:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801d5b:	8d 43 10             	lea    0x10(%ebx),%eax
+  801d5e:	83 ec 04             	sub    $0x4,%esp
+  801d61:	57                   	push   %edi
+  801d62:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d65:	01 c2                	add    %eax,%edx
+  801d67:	52                   	push   %edx
+  801d68:	ff 75 0c             	push   0xc(%ebp)
+  801d6b:	e8 c4 eb ff ff       	call   800934 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801d70:	83 c4 0c             	add    $0xc,%esp
+  801d73:	89 f1                	mov    %esi,%ecx
+  801d75:	29 f9                	sub    %edi,%ecx
+  801d77:	51                   	push   %ecx
+  801d78:	ff 75 e4             	push   -0x1c(%ebp)
+  801d7b:	89 f8                	mov    %edi,%eax
+  801d7d:	03 45 0c             	add    0xc(%ebp),%eax
+  801d80:	50                   	push   %eax
+  801d81:	e8 ae eb ff ff       	call   800934 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801d86:	89 f1                	mov    %esi,%ecx
+  801d88:	03 0b                	add    (%ebx),%ecx
+  801d8a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801d8f:	f7 e1                	mul    %ecx
+  801d91:	c1 ea 0c             	shr    $0xc,%edx
+  801d94:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801d9a:	29 d1                	sub    %edx,%ecx
+  801d9c:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801d9e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801da3:	83 c4 10             	add    $0x10,%esp
+  801da6:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801daa:	75 0a                	jne    801db6 <devpipe_read+0x106>
+	return n;
+  801dac:	89 f0                	mov    %esi,%eax
+}
+  801dae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801db1:	5b                   	pop    %ebx
+  801db2:	5e                   	pop    %esi
+  801db3:	5f                   	pop    %edi
+  801db4:	5d                   	pop    %ebp
+  801db5:	c3                   	ret
+		*sleeping = 0;
+  801db6:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801dbd:	83 ec 08             	sub    $0x8,%esp
+  801dc0:	68 00 04 00 00       	push   $0x400
+  801dc5:	53                   	push   %ebx
+  801dc6:	e8 ff f3 ff ff       	call   8011ca <sys_futex_wake>
+  801dcb:	83 c4 10             	add    $0x10,%esp
+  801dce:	eb dc                	jmp    801dac <devpipe_read+0xfc>
+			return 0;
+  801dd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd5:	eb d7                	jmp    801dae <devpipe_read+0xfe>
+
+00801dd7 <devpipe_write>:
+{
+  801dd7:	55                   	push   %ebp
+  801dd8:	89 e5                	mov    %esp,%ebp
+  801dda:	57                   	push   %edi
+  801ddb:	56                   	push   %esi
+  801ddc:	53                   	push   %ebx
+  801ddd:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801de0:	ff 75 08             	push   0x8(%ebp)
+  801de3:	e8 64 f4 ff ff       	call   80124c <fd2data>
+  801de8:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801dea:	83 c4 10             	add    $0x10,%esp
+  801ded:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801df4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801df7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801dfa:	0f 83 23 01 00 00    	jae    801f23 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801e00:	8b 77 04             	mov    0x4(%edi),%esi
+  801e03:	8b 1f                	mov    (%edi),%ebx
+  801e05:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801e0b:	29 d9                	sub    %ebx,%ecx
+  801e0d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e12:	f7 e1                	mul    %ecx
+  801e14:	c1 ea 0c             	shr    $0xc,%edx
+  801e17:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801e1d:	29 c1                	sub    %eax,%ecx
+  801e1f:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801e21:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801e27:	75 40                	jne    801e69 <devpipe_write+0x92>
+			ref = pageref(p);
+  801e29:	83 ec 0c             	sub    $0xc,%esp
+  801e2c:	57                   	push   %edi
+  801e2d:	e8 3d 2c 00 00       	call   804a6f <pageref>
+  801e32:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801e34:	89 fa                	mov    %edi,%edx
+  801e36:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e39:	e8 0d fe ff ff       	call   801c4b <_pipeisclosed>
+  801e3e:	83 c4 10             	add    $0x10,%esp
+  801e41:	85 c0                	test   %eax,%eax
+  801e43:	0f 85 d5 00 00 00    	jne    801f1e <devpipe_write+0x147>
+	*sleeping = 1;
+  801e49:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801e50:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801e55:	39 1f                	cmp    %ebx,(%edi)
+  801e57:	75 a7                	jne    801e00 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801e59:	83 ec 04             	sub    $0x4,%esp
+  801e5c:	56                   	push   %esi
+  801e5d:	53                   	push   %ebx
+  801e5e:	57                   	push   %edi
+  801e5f:	e8 16 f3 ff ff       	call   80117a <sys_futex_wait>
+  801e64:	83 c4 10             	add    $0x10,%esp
+  801e67:	eb 97                	jmp    801e00 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801e69:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801e6c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e6f:	29 c1                	sub    %eax,%ecx
+  801e71:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801e76:	89 d8                	mov    %ebx,%eax
+  801e78:	29 d0                	sub    %edx,%eax
+  801e7a:	39 c1                	cmp    %eax,%ecx
+  801e7c:	0f 46 c1             	cmovbe %ecx,%eax
+  801e7f:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801e81:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e86:	f7 e6                	mul    %esi
+  801e88:	c1 ea 0b             	shr    $0xb,%edx
+  801e8b:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801e91:	29 c6                	sub    %eax,%esi
+  801e93:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801e95:	29 f3                	sub    %esi,%ebx
+  801e97:	39 cb                	cmp    %ecx,%ebx
+  801e99:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801e9c:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801e9f:	8d 77 10             	lea    0x10(%edi),%esi
+  801ea2:	83 ec 04             	sub    $0x4,%esp
+  801ea5:	53                   	push   %ebx
+  801ea6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ea9:	03 45 0c             	add    0xc(%ebp),%eax
+  801eac:	50                   	push   %eax
+  801ead:	01 f2                	add    %esi,%edx
+  801eaf:	52                   	push   %edx
+  801eb0:	e8 7f ea ff ff       	call   800934 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  801eb5:	83 c4 0c             	add    $0xc,%esp
+  801eb8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ebb:	29 d8                	sub    %ebx,%eax
+  801ebd:	50                   	push   %eax
+  801ebe:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ec1:	01 d3                	add    %edx,%ebx
+  801ec3:	03 5d 0c             	add    0xc(%ebp),%ebx
+  801ec6:	53                   	push   %ebx
+  801ec7:	56                   	push   %esi
+  801ec8:	e8 67 ea ff ff       	call   800934 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  801ecd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801ed0:	03 4f 04             	add    0x4(%edi),%ecx
+  801ed3:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801ed8:	f7 e1                	mul    %ecx
+  801eda:	c1 ea 0c             	shr    $0xc,%edx
+  801edd:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801ee3:	29 d1                	sub    %edx,%ecx
+  801ee5:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  801ee8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801eed:	83 c4 10             	add    $0x10,%esp
+  801ef0:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  801ef4:	75 0b                	jne    801f01 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  801ef6:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  801ef9:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801efc:	e9 f3 fe ff ff       	jmp    801df4 <devpipe_write+0x1d>
+		*sleeping = 0;
+  801f01:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  801f08:	83 ec 08             	sub    $0x8,%esp
+  801f0b:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  801f10:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  801f13:	50                   	push   %eax
+  801f14:	e8 b1 f2 ff ff       	call   8011ca <sys_futex_wake>
+  801f19:	83 c4 10             	add    $0x10,%esp
+  801f1c:	eb d8                	jmp    801ef6 <devpipe_write+0x11f>
+				return 0;
+  801f1e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f26:	5b                   	pop    %ebx
+  801f27:	5e                   	pop    %esi
+  801f28:	5f                   	pop    %edi
+  801f29:	5d                   	pop    %ebp
+  801f2a:	c3                   	ret
+
+00801f2b <pipe>:
+{
+  801f2b:	55                   	push   %ebp
+  801f2c:	89 e5                	mov    %esp,%ebp
+  801f2e:	56                   	push   %esi
+  801f2f:	53                   	push   %ebx
+  801f30:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801f33:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f36:	50                   	push   %eax
+  801f37:	e8 27 f3 ff ff       	call   801263 <fd_alloc>
+  801f3c:	89 c3                	mov    %eax,%ebx
+  801f3e:	83 c4 10             	add    $0x10,%esp
+  801f41:	85 c0                	test   %eax,%eax
+  801f43:	0f 88 23 01 00 00    	js     80206c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f49:	83 ec 04             	sub    $0x4,%esp
+  801f4c:	68 07 04 00 00       	push   $0x407
+  801f51:	ff 75 f4             	push   -0xc(%ebp)
+  801f54:	6a 00                	push   $0x0
+  801f56:	e8 46 ed ff ff       	call   800ca1 <sys_page_alloc>
+  801f5b:	89 c3                	mov    %eax,%ebx
+  801f5d:	83 c4 10             	add    $0x10,%esp
+  801f60:	85 c0                	test   %eax,%eax
+  801f62:	0f 88 04 01 00 00    	js     80206c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801f68:	83 ec 0c             	sub    $0xc,%esp
+  801f6b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f6e:	50                   	push   %eax
+  801f6f:	e8 ef f2 ff ff       	call   801263 <fd_alloc>
+  801f74:	89 c3                	mov    %eax,%ebx
+  801f76:	83 c4 10             	add    $0x10,%esp
+  801f79:	85 c0                	test   %eax,%eax
+  801f7b:	0f 88 db 00 00 00    	js     80205c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f81:	83 ec 04             	sub    $0x4,%esp
+  801f84:	68 07 04 00 00       	push   $0x407
+  801f89:	ff 75 f0             	push   -0x10(%ebp)
+  801f8c:	6a 00                	push   $0x0
+  801f8e:	e8 0e ed ff ff       	call   800ca1 <sys_page_alloc>
+  801f93:	89 c3                	mov    %eax,%ebx
+  801f95:	83 c4 10             	add    $0x10,%esp
+  801f98:	85 c0                	test   %eax,%eax
+  801f9a:	0f 88 bc 00 00 00    	js     80205c <pipe+0x131>
+	va = fd2data(fd0);
+  801fa0:	83 ec 0c             	sub    $0xc,%esp
+  801fa3:	ff 75 f4             	push   -0xc(%ebp)
+  801fa6:	e8 a1 f2 ff ff       	call   80124c <fd2data>
+  801fab:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801fad:	83 c4 0c             	add    $0xc,%esp
+  801fb0:	68 07 04 00 00       	push   $0x407
+  801fb5:	50                   	push   %eax
+  801fb6:	6a 00                	push   $0x0
+  801fb8:	e8 e4 ec ff ff       	call   800ca1 <sys_page_alloc>
+  801fbd:	89 c3                	mov    %eax,%ebx
+  801fbf:	83 c4 10             	add    $0x10,%esp
+  801fc2:	85 c0                	test   %eax,%eax
+  801fc4:	0f 88 82 00 00 00    	js     80204c <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801fca:	83 ec 0c             	sub    $0xc,%esp
+  801fcd:	ff 75 f0             	push   -0x10(%ebp)
+  801fd0:	e8 77 f2 ff ff       	call   80124c <fd2data>
+  801fd5:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801fdc:	50                   	push   %eax
+  801fdd:	6a 00                	push   $0x0
+  801fdf:	56                   	push   %esi
+  801fe0:	6a 00                	push   $0x0
+  801fe2:	e8 fd ec ff ff       	call   800ce4 <sys_page_map>
+  801fe7:	89 c3                	mov    %eax,%ebx
+  801fe9:	83 c4 20             	add    $0x20,%esp
+  801fec:	85 c0                	test   %eax,%eax
+  801fee:	78 4e                	js     80203e <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801ff0:	a1 20 60 80 00       	mov    0x806020,%eax
+  801ff5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ff8:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801ffa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ffd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802004:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802007:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802009:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80200c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802013:	83 ec 0c             	sub    $0xc,%esp
+  802016:	ff 75 f4             	push   -0xc(%ebp)
+  802019:	e8 1e f2 ff ff       	call   80123c <fd2num>
+  80201e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802021:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802023:	83 c4 04             	add    $0x4,%esp
+  802026:	ff 75 f0             	push   -0x10(%ebp)
+  802029:	e8 0e f2 ff ff       	call   80123c <fd2num>
+  80202e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802031:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802034:	83 c4 10             	add    $0x10,%esp
+  802037:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80203c:	eb 2e                	jmp    80206c <pipe+0x141>
+	sys_page_unmap(0, va);
+  80203e:	83 ec 08             	sub    $0x8,%esp
+  802041:	56                   	push   %esi
+  802042:	6a 00                	push   $0x0
+  802044:	e8 dd ec ff ff       	call   800d26 <sys_page_unmap>
+  802049:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80204c:	83 ec 08             	sub    $0x8,%esp
+  80204f:	ff 75 f0             	push   -0x10(%ebp)
+  802052:	6a 00                	push   $0x0
+  802054:	e8 cd ec ff ff       	call   800d26 <sys_page_unmap>
+  802059:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80205c:	83 ec 08             	sub    $0x8,%esp
+  80205f:	ff 75 f4             	push   -0xc(%ebp)
+  802062:	6a 00                	push   $0x0
+  802064:	e8 bd ec ff ff       	call   800d26 <sys_page_unmap>
+  802069:	83 c4 10             	add    $0x10,%esp
+}
+  80206c:	89 d8                	mov    %ebx,%eax
+  80206e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802071:	5b                   	pop    %ebx
+  802072:	5e                   	pop    %esi
+  802073:	5d                   	pop    %ebp
+  802074:	c3                   	ret
+
+00802075 <pipeisclosed>:
+{
+  802075:	55                   	push   %ebp
+  802076:	89 e5                	mov    %esp,%ebp
+  802078:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80207b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80207e:	50                   	push   %eax
+  80207f:	ff 75 08             	push   0x8(%ebp)
+  802082:	e8 30 f2 ff ff       	call   8012b7 <fd_lookup>
+  802087:	83 c4 10             	add    $0x10,%esp
+  80208a:	85 c0                	test   %eax,%eax
+  80208c:	78 18                	js     8020a6 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80208e:	83 ec 0c             	sub    $0xc,%esp
+  802091:	ff 75 f4             	push   -0xc(%ebp)
+  802094:	e8 b3 f1 ff ff       	call   80124c <fd2data>
+  802099:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80209b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80209e:	e8 a8 fb ff ff       	call   801c4b <_pipeisclosed>
+  8020a3:	83 c4 10             	add    $0x10,%esp
+}
+  8020a6:	c9                   	leave
+  8020a7:	c3                   	ret
+
+008020a8 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  8020a8:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8020aa:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  8020b0:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  8020b6:	81 c2 34 01 00 00    	add    $0x134,%edx
+  8020bc:	39 d0                	cmp    %edx,%eax
+  8020be:	74 2e                	je     8020ee <segment_lookup+0x46>
+{
+  8020c0:	55                   	push   %ebp
+  8020c1:	89 e5                	mov    %esp,%ebp
+  8020c3:	57                   	push   %edi
+  8020c4:	56                   	push   %esi
+  8020c5:	53                   	push   %ebx
+  8020c6:	eb 07                	jmp    8020cf <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8020c8:	83 c0 20             	add    $0x20,%eax
+  8020cb:	39 d0                	cmp    %edx,%eax
+  8020cd:	74 15                	je     8020e4 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  8020cf:	8b 18                	mov    (%eax),%ebx
+  8020d1:	39 d9                	cmp    %ebx,%ecx
+  8020d3:	72 f3                	jb     8020c8 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  8020d5:	8b 38                	mov    (%eax),%edi
+  8020d7:	8b 58 04             	mov    0x4(%eax),%ebx
+  8020da:	89 ce                	mov    %ecx,%esi
+  8020dc:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  8020de:	39 de                	cmp    %ebx,%esi
+  8020e0:	73 e6                	jae    8020c8 <segment_lookup+0x20>
+  8020e2:	eb 05                	jmp    8020e9 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  8020e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020e9:	5b                   	pop    %ebx
+  8020ea:	5e                   	pop    %esi
+  8020eb:	5f                   	pop    %edi
+  8020ec:	5d                   	pop    %ebp
+  8020ed:	c3                   	ret
+	return NULL;
+  8020ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020f3:	c3                   	ret
+
+008020f4 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  8020f4:	55                   	push   %ebp
+  8020f5:	89 e5                	mov    %esp,%ebp
+  8020f7:	53                   	push   %ebx
+  8020f8:	83 ec 04             	sub    $0x4,%esp
+  8020fb:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8020fd:	c1 e8 16             	shr    $0x16,%eax
+  802100:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802107:	25 81 00 00 00       	and    $0x81,%eax
+  80210c:	83 f8 01             	cmp    $0x1,%eax
+  80210f:	75 6b                	jne    80217c <page_is_clean+0x88>
+  802111:	89 da                	mov    %ebx,%edx
+  802113:	c1 ea 0c             	shr    $0xc,%edx
+  802116:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  80211d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802122:	f6 c1 01             	test   $0x1,%cl
+  802125:	74 5a                	je     802181 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802127:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80212e:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802134:	75 4b                	jne    802181 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  802136:	89 d8                	mov    %ebx,%eax
+  802138:	e8 6b ff ff ff       	call   8020a8 <segment_lookup>
+  80213d:	89 c2                	mov    %eax,%edx
+		return 1;
+  80213f:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  802144:	85 d2                	test   %edx,%edx
+  802146:	75 39                	jne    802181 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  802148:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  80214e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802153:	eb 03                	jmp    802158 <page_is_clean+0x64>
+  802155:	83 c0 01             	add    $0x1,%eax
+  802158:	39 c2                	cmp    %eax,%edx
+  80215a:	7e 19                	jle    802175 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  80215c:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  802163:	72 f0                	jb     802155 <page_is_clean+0x61>
+  802165:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  80216c:	73 e7                	jae    802155 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  80216e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802173:	eb 0c                	jmp    802181 <page_is_clean+0x8d>
+	return 0;
+  802175:	b8 00 00 00 00       	mov    $0x0,%eax
+  80217a:	eb 05                	jmp    802181 <page_is_clean+0x8d>
+		return 0;
+  80217c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802184:	c9                   	leave
+  802185:	c3                   	ret
+
+00802186 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  802186:	55                   	push   %ebp
+  802187:	89 e5                	mov    %esp,%ebp
+  802189:	57                   	push   %edi
+  80218a:	56                   	push   %esi
+  80218b:	53                   	push   %ebx
+  80218c:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80218f:	be 00 00 00 00       	mov    $0x0,%esi
+  802194:	eb 19                	jmp    8021af <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802196:	f7 d3                	not    %ebx
+  802198:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80219e:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8021a0:	83 c6 01             	add    $0x1,%esi
+  8021a3:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8021a9:	0f 87 97 00 00 00    	ja     802246 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8021af:	89 f3                	mov    %esi,%ebx
+  8021b1:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  8021b7:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8021bd:	89 d8                	mov    %ebx,%eax
+  8021bf:	c1 e8 0a             	shr    $0xa,%eax
+  8021c2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8021c9:	25 81 00 00 00       	and    $0x81,%eax
+  8021ce:	83 f8 01             	cmp    $0x1,%eax
+  8021d1:	75 c3                	jne    802196 <linear_walk+0x10>
+  8021d3:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8021d9:	77 bb                	ja     802196 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8021db:	89 df                	mov    %ebx,%edi
+  8021dd:	c1 e7 0c             	shl    $0xc,%edi
+  8021e0:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8021e3:	89 f8                	mov    %edi,%eax
+  8021e5:	e8 0a ff ff ff       	call   8020f4 <page_is_clean>
+  8021ea:	84 c0                	test   %al,%al
+  8021ec:	75 64                	jne    802252 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8021ee:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  8021f4:	77 aa                	ja     8021a0 <linear_walk+0x1a>
+  8021f6:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  8021fc:	72 a2                	jb     8021a0 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8021fe:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802205:	a8 01                	test   $0x1,%al
+  802207:	74 97                	je     8021a0 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802209:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802210:	f6 c4 04             	test   $0x4,%ah
+  802213:	75 8b                	jne    8021a0 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802215:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80221c:	f6 c4 02             	test   $0x2,%ah
+  80221f:	0f 85 7b ff ff ff    	jne    8021a0 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802225:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80222c:	c1 e8 0c             	shr    $0xc,%eax
+  80222f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802232:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802237:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80223b:	66 83 f8 01          	cmp    $0x1,%ax
+  80223f:	76 11                	jbe    802252 <linear_walk+0xcc>
+  802241:	e9 5a ff ff ff       	jmp    8021a0 <linear_walk+0x1a>
+  802246:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  80224b:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802252:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  802258:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80225b:	83 c4 1c             	add    $0x1c,%esp
+  80225e:	5b                   	pop    %ebx
+  80225f:	5e                   	pop    %esi
+  802260:	5f                   	pop    %edi
+  802261:	5d                   	pop    %ebp
+  802262:	c3                   	ret
+
+00802263 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802263:	55                   	push   %ebp
+  802264:	89 e5                	mov    %esp,%ebp
+  802266:	56                   	push   %esi
+  802267:	53                   	push   %ebx
+  802268:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  80226a:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80226f:	83 e0 7f             	and    $0x7f,%eax
+  802272:	c1 e0 04             	shl    $0x4,%eax
+  802275:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  80227b:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802281:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802287:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  80228d:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802292:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  802295:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80229a:	83 c0 01             	add    $0x1,%eax
+  80229d:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  8022a2:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  8022a5:	5b                   	pop    %ebx
+  8022a6:	5e                   	pop    %esi
+  8022a7:	5d                   	pop    %ebp
+  8022a8:	c3                   	ret
+
+008022a9 <page_ring_enter>:
+{
+  8022a9:	55                   	push   %ebp
+  8022aa:	89 e5                	mov    %esp,%ebp
+  8022ac:	57                   	push   %edi
+  8022ad:	56                   	push   %esi
+  8022ae:	53                   	push   %ebx
+  8022af:	83 ec 18             	sub    $0x18,%esp
+  8022b2:	89 c6                	mov    %eax,%esi
+  8022b4:	89 d7                	mov    %edx,%edi
+  8022b6:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  8022b8:	6a 00                	push   $0x0
+  8022ba:	6a 00                	push   $0x0
+  8022bc:	6a 00                	push   $0x0
+  8022be:	6a 07                	push   $0x7
+  8022c0:	ff 35 40 b0 80 00    	push   0x80b040
+  8022c6:	e8 8e 26 00 00       	call   804959 <ipc_call>
+  8022cb:	83 c4 20             	add    $0x20,%esp
+  8022ce:	85 c0                	test   %eax,%eax
+  8022d0:	79 22                	jns    8022f4 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  8022d2:	50                   	push   %eax
+  8022d3:	68 76 51 80 00       	push   $0x805176
+  8022d8:	68 13 02 00 00       	push   $0x213
+  8022dd:	68 8a 51 80 00       	push   $0x80518a
+  8022e2:	e8 05 de ff ff       	call   8000ec <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  8022e7:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8022ec:	83 c0 01             	add    $0x1,%eax
+  8022ef:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  8022f4:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  8022fa:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  8022ff:	39 c2                	cmp    %eax,%edx
+  802301:	74 24                	je     802327 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802303:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802308:	83 e0 7f             	and    $0x7f,%eax
+  80230b:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802312:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802319:	29 f0                	sub    %esi,%eax
+  80231b:	39 d8                	cmp    %ebx,%eax
+  80231d:	73 c8                	jae    8022e7 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  80231f:	8b 52 04             	mov    0x4(%edx),%edx
+  802322:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802325:	eb c0                	jmp    8022e7 <page_ring_enter+0x3e>
+}
+  802327:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80232a:	5b                   	pop    %ebx
+  80232b:	5e                   	pop    %esi
+  80232c:	5f                   	pop    %edi
+  80232d:	5d                   	pop    %ebp
+  80232e:	c3                   	ret
+
+0080232f <page_ring_reserve>:
+{
+  80232f:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802331:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802336:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  80233c:	29 d0                	sub    %edx,%eax
+  80233e:	ba 80 00 00 00       	mov    $0x80,%edx
+  802343:	29 ca                	sub    %ecx,%edx
+  802345:	39 c2                	cmp    %eax,%edx
+  802347:	72 01                	jb     80234a <page_ring_reserve+0x1b>
+  802349:	c3                   	ret
+{
+  80234a:	55                   	push   %ebp
+  80234b:	89 e5                	mov    %esp,%ebp
+  80234d:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802350:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802355:	ba 00 00 00 00       	mov    $0x0,%edx
+  80235a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80235f:	e8 45 ff ff ff       	call   8022a9 <page_ring_enter>
+}
+  802364:	c9                   	leave
+  802365:	c3                   	ret
+
+00802366 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802366:	55                   	push   %ebp
+  802367:	89 e5                	mov    %esp,%ebp
+  802369:	53                   	push   %ebx
+  80236a:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  80236d:	6a 07                	push   $0x7
+  80236f:	6a 01                	push   $0x1
+  802371:	89 c3                	mov    %eax,%ebx
+  802373:	c1 e3 0c             	shl    $0xc,%ebx
+  802376:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  80237c:	52                   	push   %edx
+  80237d:	6a 04                	push   $0x4
+  80237f:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  802386:	e8 ce 25 00 00       	call   804959 <ipc_call>
+	sharereqs[i].nslots = 0;
+  80238b:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  802392:	00 00 00 
+	return r;
+}
+  802395:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802398:	c9                   	leave
+  802399:	c3                   	ret
+
+0080239a <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  80239a:	55                   	push   %ebp
+  80239b:	89 e5                	mov    %esp,%ebp
+  80239d:	56                   	push   %esi
+  80239e:	53                   	push   %ebx
+  80239f:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  8023a1:	c1 e8 10             	shr    $0x10,%eax
+  8023a4:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  8023a7:	89 c2                	mov    %eax,%edx
+  8023a9:	c1 e2 0c             	shl    $0xc,%edx
+  8023ac:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  8023b2:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8023b5:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  8023bb:	89 c2                	mov    %eax,%edx
+  8023bd:	c1 e2 0a             	shl    $0xa,%edx
+  8023c0:	01 f2                	add    %esi,%edx
+  8023c2:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  8023c9:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  8023cf:	74 09                	je     8023da <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  8023d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023d6:	5b                   	pop    %ebx
+  8023d7:	5e                   	pop    %esi
+  8023d8:	5d                   	pop    %ebp
+  8023d9:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  8023da:	e8 87 ff ff ff       	call   802366 <page_share_send>
+  8023df:	eb f5                	jmp    8023d6 <page_share_slot+0x3c>
+
+008023e1 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  8023e1:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8023e6:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  8023e9:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  8023ee:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  8023f4:	74 09                	je     8023ff <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  8023f6:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  8023fb:	85 c0                	test   %eax,%eax
+  8023fd:	75 01                	jne    802400 <page_ring_ready+0x1f>
+}
+  8023ff:	c3                   	ret
+{
+  802400:	55                   	push   %ebp
+  802401:	89 e5                	mov    %esp,%ebp
+  802403:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802406:	68 07 06 00 00       	push   $0x607
+  80240b:	6a 08                	push   $0x8
+  80240d:	68 00 30 ad de       	push   $0xdead3000
+  802412:	6a 00                	push   $0x0
+  802414:	e8 b3 e9 ff ff       	call   800dcc <sys_page_alloc_range>
+  802419:	83 c4 10             	add    $0x10,%esp
+  80241c:	83 f8 08             	cmp    $0x8,%eax
+  80241f:	74 1b                	je     80243c <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802421:	83 ec 04             	sub    $0x4,%esp
+  802424:	6a 08                	push   $0x8
+  802426:	68 00 30 ad de       	push   $0xdead3000
+  80242b:	6a 00                	push   $0x0
+  80242d:	e8 08 ea ff ff       	call   800e3a <sys_page_unmap_range>
+		return 0;
+  802432:	83 c4 10             	add    $0x10,%esp
+  802435:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80243a:	c9                   	leave
+  80243b:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  80243c:	83 ec 0c             	sub    $0xc,%esp
+  80243f:	68 07 04 00 00       	push   $0x407
+  802444:	6a 08                	push   $0x8
+  802446:	68 00 30 ad de       	push   $0xdead3000
+  80244b:	6a 06                	push   $0x6
+  80244d:	ff 35 40 b0 80 00    	push   0x80b040
+  802453:	e8 01 25 00 00       	call   804959 <ipc_call>
+  802458:	83 c4 20             	add    $0x20,%esp
+  80245b:	85 c0                	test   %eax,%eax
+  80245d:	78 14                	js     802473 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  80245f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802464:	8b 40 48             	mov    0x48(%eax),%eax
+  802467:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  80246c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802471:	eb c7                	jmp    80243a <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802473:	83 ec 04             	sub    $0x4,%esp
+  802476:	6a 08                	push   $0x8
+  802478:	68 00 30 ad de       	push   $0xdead3000
+  80247d:	6a 00                	push   $0x0
+  80247f:	e8 b6 e9 ff ff       	call   800e3a <sys_page_unmap_range>
+		return 0;
+  802484:	83 c4 10             	add    $0x10,%esp
+  802487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80248c:	eb ac                	jmp    80243a <page_ring_ready+0x59>
+
+0080248e <page_remove_slot>:
+{
+  80248e:	55                   	push   %ebp
+  80248f:	89 e5                	mov    %esp,%ebp
+  802491:	56                   	push   %esi
+  802492:	53                   	push   %ebx
+  802493:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802495:	89 c6                	mov    %eax,%esi
+  802497:	c1 ee 10             	shr    $0x10,%esi
+  80249a:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  80249d:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  8024a4:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  8024aa:	74 2a                	je     8024d6 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8024ac:	83 ec 0c             	sub    $0xc,%esp
+  8024af:	6a 00                	push   $0x0
+  8024b1:	6a 00                	push   $0x0
+  8024b3:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  8024b5:	c1 e3 04             	shl    $0x4,%ebx
+  8024b8:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8024bb:	53                   	push   %ebx
+  8024bc:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8024c3:	e8 91 24 00 00       	call   804959 <ipc_call>
+  8024c8:	83 c4 20             	add    $0x20,%esp
+  8024cb:	85 c0                	test   %eax,%eax
+  8024cd:	78 2d                	js     8024fc <page_remove_slot+0x6e>
+}
+  8024cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024d2:	5b                   	pop    %ebx
+  8024d3:	5e                   	pop    %esi
+  8024d4:	5d                   	pop    %ebp
+  8024d5:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8024d6:	e8 06 ff ff ff       	call   8023e1 <page_ring_ready>
+  8024db:	85 c0                	test   %eax,%eax
+  8024dd:	74 cd                	je     8024ac <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  8024df:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024e4:	e8 46 fe ff ff       	call   80232f <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  8024e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024ee:	89 da                	mov    %ebx,%edx
+  8024f0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8024f5:	e8 69 fd ff ff       	call   802263 <page_ring_post>
+		return;
+  8024fa:	eb d3                	jmp    8024cf <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  8024fc:	50                   	push   %eax
+  8024fd:	68 e4 51 80 00       	push   $0x8051e4
+  802502:	68 ac 03 00 00       	push   $0x3ac
+  802507:	68 8a 51 80 00       	push   $0x80518a
+  80250c:	e8 db db ff ff       	call   8000ec <_panic>
+
+00802511 <find_paging_env>:
+	if(pagingenv)
+  802511:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802516:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802518:	85 c0                	test   %eax,%eax
+  80251a:	74 05                	je     802521 <find_paging_env+0x10>
+  80251c:	eb 56                	jmp    802574 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  80251e:	83 c0 01             	add    $0x1,%eax
+  802521:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802526:	7f 47                	jg     80256f <find_paging_env+0x5e>
+  802528:	83 f9 01             	cmp    $0x1,%ecx
+  80252b:	7f 42                	jg     80256f <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  80252d:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802530:	c1 e2 06             	shl    $0x6,%edx
+  802533:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802539:	8b 52 50             	mov    0x50(%edx),%edx
+  80253c:	83 fa 02             	cmp    $0x2,%edx
+  80253f:	75 dd                	jne    80251e <find_paging_env+0xd>
+  802541:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802544:	c1 e2 06             	shl    $0x6,%edx
+  802547:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80254d:	8b 52 54             	mov    0x54(%edx),%edx
+  802550:	85 d2                	test   %edx,%edx
+  802552:	74 ca                	je     80251e <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802554:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802557:	c1 e2 06             	shl    $0x6,%edx
+  80255a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802560:	8b 52 48             	mov    0x48(%edx),%edx
+  802563:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  80256a:	8d 49 01             	lea    0x1(%ecx),%ecx
+  80256d:	eb af                	jmp    80251e <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  80256f:	83 f9 02             	cmp    $0x2,%ecx
+  802572:	74 01                	je     802575 <find_paging_env+0x64>
+}
+  802574:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802575:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80257a:	8b 40 48             	mov    0x48(%eax),%eax
+  80257d:	83 e0 01             	and    $0x1,%eax
+  802580:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  802587:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  80258c:	eb e6                	jmp    802574 <find_paging_env+0x63>
+
+0080258e <page_add_backed>:
+{
+  80258e:	55                   	push   %ebp
+  80258f:	89 e5                	mov    %esp,%ebp
+  802591:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802594:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  802599:	83 f8 04             	cmp    $0x4,%eax
+  80259c:	74 35                	je     8025d3 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  80259e:	89 d1                	mov    %edx,%ecx
+  8025a0:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  8025a6:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  8025ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025b0:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  8025b7:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8025bd:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  8025c4:	83 c0 01             	add    $0x1,%eax
+  8025c7:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  8025cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025d1:	5d                   	pop    %ebp
+  8025d2:	c3                   	ret
+		return -E_NO_MEM;
+  8025d3:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8025d8:	eb f7                	jmp    8025d1 <page_add_backed+0x43>
+
+008025da <percentage_of_pgdir_to_walk>:
+{
+  8025da:	55                   	push   %ebp
+  8025db:	89 e5                	mov    %esp,%ebp
+  8025dd:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  8025e0:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  8025e4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  8025e7:	db 45 fc             	fildl  -0x4(%ebp)
+  8025ea:	d8 35 70 56 80 00    	fdivs  0x805670
+	return ret*ret;
+  8025f0:	d8 c8                	fmul   %st(0),%st
+}
+  8025f2:	c9                   	leave
+  8025f3:	c3                   	ret
+
+008025f4 <nfu_with_aging_page_choice_func>:
+{
+  8025f4:	55                   	push   %ebp
+  8025f5:	89 e5                	mov    %esp,%ebp
+  8025f7:	57                   	push   %edi
+  8025f8:	56                   	push   %esi
+  8025f9:	53                   	push   %ebx
+  8025fa:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8025fd:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  802603:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802605:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80260a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80260f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802616:	ba 00 00 00 00       	mov    $0x0,%edx
+  80261b:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  80261e:	eb 18                	jmp    802638 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802620:	f7 d0                	not    %eax
+  802622:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802627:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802629:	83 c2 01             	add    $0x1,%edx
+  80262c:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802632:	0f 87 13 01 00 00    	ja     80274b <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802638:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80263c:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  80263f:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802644:	89 c1                	mov    %eax,%ecx
+  802646:	c1 e9 0a             	shr    $0xa,%ecx
+  802649:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802650:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802656:	83 f9 01             	cmp    $0x1,%ecx
+  802659:	75 c5                	jne    802620 <nfu_with_aging_page_choice_func+0x2c>
+  80265b:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802660:	77 be                	ja     802620 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802662:	89 c1                	mov    %eax,%ecx
+  802664:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802667:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  80266d:	0f 82 a5 00 00 00    	jb     802718 <nfu_with_aging_page_choice_func+0x124>
+  802673:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802679:	0f 87 99 00 00 00    	ja     802718 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80267f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802686:	f6 c1 01             	test   $0x1,%cl
+  802689:	0f 84 89 00 00 00    	je     802718 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80268f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802696:	f6 c5 04             	test   $0x4,%ch
+  802699:	75 7d                	jne    802718 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80269b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8026a2:	f6 c5 02             	test   $0x2,%ch
+  8026a5:	75 71                	jne    802718 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8026a7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8026ae:	c1 e9 0c             	shr    $0xc,%ecx
+  8026b1:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8026b4:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8026ba:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8026be:	66 83 f9 01          	cmp    $0x1,%cx
+  8026c2:	77 54                	ja     802718 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  8026c4:	89 f9                	mov    %edi,%ecx
+  8026c6:	80 f9 ff             	cmp    $0xff,%cl
+  8026c9:	74 21                	je     8026ec <nfu_with_aging_page_choice_func+0xf8>
+  8026cb:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8026d2:	c1 e9 0c             	shr    $0xc,%ecx
+  8026d5:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8026d8:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8026de:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  8026e2:	89 fb                	mov    %edi,%ebx
+  8026e4:	38 d9                	cmp    %bl,%cl
+  8026e6:	73 30                	jae    802718 <nfu_with_aging_page_choice_func+0x124>
+  8026e8:	dd d8                	fstp   %st(0)
+  8026ea:	eb 02                	jmp    8026ee <nfu_with_aging_page_choice_func+0xfa>
+  8026ec:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  8026ee:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8026f5:	c1 e9 0c             	shr    $0xc,%ecx
+  8026f8:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8026fb:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802702:	89 fb                	mov    %edi,%ebx
+  802704:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802707:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80270a:	db 45 e0             	fildl  -0x20(%ebp)
+  80270d:	d8 35 70 56 80 00    	fdivs  0x805670
+	return ret*ret;
+  802713:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802715:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802718:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80271b:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80271e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802725:	df 6d e0             	fildll -0x20(%ebp)
+  802728:	d9 c1                	fld    %st(1)
+  80272a:	d8 0d 74 56 80 00    	fmuls  0x805674
+  802730:	d9 c9                	fxch   %st(1)
+  802732:	df f1                	fcomip %st(1),%st
+  802734:	dd d8                	fstp   %st(0)
+  802736:	0f 82 ed fe ff ff    	jb     802629 <nfu_with_aging_page_choice_func+0x35>
+  80273c:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  80273e:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  802743:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802746:	c1 e0 0c             	shl    $0xc,%eax
+  802749:	eb 0e                	jmp    802759 <nfu_with_aging_page_choice_func+0x165>
+  80274b:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  80274d:	89 f8                	mov    %edi,%eax
+  80274f:	3c ff                	cmp    $0xff,%al
+  802751:	74 0e                	je     802761 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802753:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802756:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802759:	83 c4 14             	add    $0x14,%esp
+  80275c:	5b                   	pop    %ebx
+  80275d:	5e                   	pop    %esi
+  80275e:	5f                   	pop    %edi
+  80275f:	5d                   	pop    %ebp
+  802760:	c3                   	ret
+	pgnum = 0;
+  802761:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  802768:	00 00 00 
+	return (void*)UTOP;
+  80276b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802770:	eb e7                	jmp    802759 <nfu_with_aging_page_choice_func+0x165>
+
+00802772 <myRand>:
+    state = state * 1664525 + 1013904223;
+  802772:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  802779:	66 19 00 
+  80277c:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802781:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  802786:	c1 e8 18             	shr    $0x18,%eax
+}
+  802789:	c3                   	ret
+
+0080278a <random_page_choice_func>:
+{
+  80278a:	55                   	push   %ebp
+  80278b:	89 e5                	mov    %esp,%ebp
+  80278d:	57                   	push   %edi
+  80278e:	56                   	push   %esi
+  80278f:	53                   	push   %ebx
+  802790:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802793:	be 00 00 00 00       	mov    $0x0,%esi
+  802798:	eb 19                	jmp    8027b3 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80279a:	f7 d3                	not    %ebx
+  80279c:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8027a2:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8027a4:	83 c6 01             	add    $0x1,%esi
+  8027a7:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8027ad:	0f 87 a0 00 00 00    	ja     802853 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8027b3:	89 f3                	mov    %esi,%ebx
+  8027b5:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  8027bb:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8027c1:	89 d8                	mov    %ebx,%eax
+  8027c3:	c1 e8 0a             	shr    $0xa,%eax
+  8027c6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8027cd:	25 81 00 00 00       	and    $0x81,%eax
+  8027d2:	83 f8 01             	cmp    $0x1,%eax
+  8027d5:	75 c3                	jne    80279a <random_page_choice_func+0x10>
+  8027d7:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8027dd:	77 bb                	ja     80279a <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8027df:	89 df                	mov    %ebx,%edi
+  8027e1:	c1 e7 0c             	shl    $0xc,%edi
+  8027e4:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8027e7:	89 f8                	mov    %edi,%eax
+  8027e9:	e8 06 f9 ff ff       	call   8020f4 <page_is_clean>
+  8027ee:	84 c0                	test   %al,%al
+  8027f0:	0f 85 82 00 00 00    	jne    802878 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8027f6:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  8027fc:	72 a6                	jb     8027a4 <random_page_choice_func+0x1a>
+  8027fe:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802804:	77 9e                	ja     8027a4 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802806:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80280d:	a8 01                	test   $0x1,%al
+  80280f:	74 93                	je     8027a4 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802811:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802818:	f6 c4 04             	test   $0x4,%ah
+  80281b:	75 87                	jne    8027a4 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80281d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802824:	f6 c4 02             	test   $0x2,%ah
+  802827:	0f 85 77 ff ff ff    	jne    8027a4 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80282d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802834:	c1 e8 0c             	shr    $0xc,%eax
+  802837:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80283a:	05 00 00 00 ef       	add    $0xef000000,%eax
+  80283f:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802843:	66 83 f8 01          	cmp    $0x1,%ax
+  802847:	0f 87 57 ff ff ff    	ja     8027a4 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  80284d:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802853:	e8 1a ff ff ff       	call   802772 <myRand>
+  802858:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  80285e:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  802863:	29 fe                	sub    %edi,%esi
+  802865:	0f be c0             	movsbl %al,%eax
+  802868:	ba 00 00 00 00       	mov    $0x0,%edx
+  80286d:	f7 f6                	div    %esi
+  80286f:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802871:	bb 15 00 00 00       	mov    $0x15,%ebx
+  802876:	eb 1c                	jmp    802894 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  802878:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  80287e:	e9 8f 00 00 00       	jmp    802912 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802883:	e8 ea fe ff ff       	call   802772 <myRand>
+  802888:	0f be c0             	movsbl %al,%eax
+  80288b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802890:	f7 f6                	div    %esi
+  802892:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802894:	83 eb 01             	sub    $0x1,%ebx
+  802897:	0f 84 c2 00 00 00    	je     80295f <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  80289d:	89 d0                	mov    %edx,%eax
+  80289f:	c1 e8 0a             	shr    $0xa,%eax
+  8028a2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8028a9:	25 81 00 00 00       	and    $0x81,%eax
+  8028ae:	83 f8 01             	cmp    $0x1,%eax
+  8028b1:	75 d0                	jne    802883 <random_page_choice_func+0xf9>
+  8028b3:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  8028b9:	77 c8                	ja     802883 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  8028bb:	89 d0                	mov    %edx,%eax
+  8028bd:	c1 e0 0c             	shl    $0xc,%eax
+  8028c0:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  8028c5:	72 56                	jb     80291d <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8028c7:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  8028cc:	77 65                	ja     802933 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8028ce:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8028d5:	f6 c1 01             	test   $0x1,%cl
+  8028d8:	74 59                	je     802933 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8028da:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8028e1:	f6 c5 04             	test   $0x4,%ch
+  8028e4:	75 4d                	jne    802933 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  8028e6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8028ed:	f6 c5 02             	test   $0x2,%ch
+  8028f0:	75 41                	jne    802933 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  8028f2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8028f9:	c1 ea 0c             	shr    $0xc,%edx
+  8028fc:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  8028ff:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  802905:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  802909:	66 83 fa 01          	cmp    $0x1,%dx
+  80290d:	77 3a                	ja     802949 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  80290f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  802912:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802915:	83 c4 1c             	add    $0x1c,%esp
+  802918:	5b                   	pop    %ebx
+  802919:	5e                   	pop    %esi
+  80291a:	5f                   	pop    %edi
+  80291b:	5d                   	pop    %ebp
+  80291c:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  80291d:	e8 50 fe ff ff       	call   802772 <myRand>
+  802922:	0f be c0             	movsbl %al,%eax
+  802925:	ba 00 00 00 00       	mov    $0x0,%edx
+  80292a:	f7 f6                	div    %esi
+  80292c:	01 fa                	add    %edi,%edx
+			continue;
+  80292e:	e9 61 ff ff ff       	jmp    802894 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802933:	e8 3a fe ff ff       	call   802772 <myRand>
+  802938:	0f be c0             	movsbl %al,%eax
+  80293b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802940:	f7 f6                	div    %esi
+  802942:	01 fa                	add    %edi,%edx
+			continue;
+  802944:	e9 4b ff ff ff       	jmp    802894 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802949:	e8 24 fe ff ff       	call   802772 <myRand>
+  80294e:	0f be c0             	movsbl %al,%eax
+  802951:	ba 00 00 00 00       	mov    $0x0,%edx
+  802956:	f7 f6                	div    %esi
+  802958:	01 fa                	add    %edi,%edx
+			continue;
+  80295a:	e9 35 ff ff ff       	jmp    802894 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  80295f:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  802966:	00 00 00 
+	return (void*)UTOP;
+  802969:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  802970:	eb a0                	jmp    802912 <random_page_choice_func+0x188>
+
+00802972 <nfu>:
+{
+  802972:	55                   	push   %ebp
+  802973:	89 e5                	mov    %esp,%ebp
+  802975:	57                   	push   %edi
+  802976:	56                   	push   %esi
+  802977:	53                   	push   %ebx
+  802978:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80297b:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  802981:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802983:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802988:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80298d:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802994:	ba 00 00 00 00       	mov    $0x0,%edx
+  802999:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  80299c:	eb 18                	jmp    8029b6 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80299e:	f7 d0                	not    %eax
+  8029a0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8029a5:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8029a7:	83 c2 01             	add    $0x1,%edx
+  8029aa:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  8029b0:	0f 87 13 01 00 00    	ja     802ac9 <nfu+0x157>
+		++num_searched_ptes;
+  8029b6:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8029ba:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8029bd:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8029c2:	89 c1                	mov    %eax,%ecx
+  8029c4:	c1 e9 0a             	shr    $0xa,%ecx
+  8029c7:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8029ce:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8029d4:	83 f9 01             	cmp    $0x1,%ecx
+  8029d7:	75 c5                	jne    80299e <nfu+0x2c>
+  8029d9:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8029de:	77 be                	ja     80299e <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8029e0:	89 c1                	mov    %eax,%ecx
+  8029e2:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8029e5:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  8029eb:	0f 82 a5 00 00 00    	jb     802a96 <nfu+0x124>
+  8029f1:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8029f7:	0f 87 99 00 00 00    	ja     802a96 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8029fd:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a04:	f6 c1 01             	test   $0x1,%cl
+  802a07:	0f 84 89 00 00 00    	je     802a96 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802a0d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802a14:	f6 c5 04             	test   $0x4,%ch
+  802a17:	75 7d                	jne    802a96 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802a19:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802a20:	f6 c5 02             	test   $0x2,%ch
+  802a23:	75 71                	jne    802a96 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802a25:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802a2c:	c1 e9 0c             	shr    $0xc,%ecx
+  802a2f:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802a32:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802a38:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802a3c:	66 83 f9 01          	cmp    $0x1,%cx
+  802a40:	77 54                	ja     802a96 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  802a42:	89 f9                	mov    %edi,%ecx
+  802a44:	80 f9 ff             	cmp    $0xff,%cl
+  802a47:	74 21                	je     802a6a <nfu+0xf8>
+  802a49:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802a50:	c1 e9 0c             	shr    $0xc,%ecx
+  802a53:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802a56:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802a5c:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  802a60:	89 fb                	mov    %edi,%ebx
+  802a62:	38 d9                	cmp    %bl,%cl
+  802a64:	73 30                	jae    802a96 <nfu+0x124>
+  802a66:	dd d8                	fstp   %st(0)
+  802a68:	eb 02                	jmp    802a6c <nfu+0xfa>
+  802a6a:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  802a6c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802a73:	c1 e9 0c             	shr    $0xc,%ecx
+  802a76:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802a79:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802a80:	89 fb                	mov    %edi,%ebx
+  802a82:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802a85:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802a88:	db 45 e0             	fildl  -0x20(%ebp)
+  802a8b:	d8 35 70 56 80 00    	fdivs  0x805670
+	return ret*ret;
+  802a91:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802a93:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802a96:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802a99:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802a9c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802aa3:	df 6d e0             	fildll -0x20(%ebp)
+  802aa6:	d9 c1                	fld    %st(1)
+  802aa8:	d8 0d 74 56 80 00    	fmuls  0x805674
+  802aae:	d9 c9                	fxch   %st(1)
+  802ab0:	df f1                	fcomip %st(1),%st
+  802ab2:	dd d8                	fstp   %st(0)
+  802ab4:	0f 82 ed fe ff ff    	jb     8029a7 <nfu+0x35>
+  802aba:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802abc:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  802ac1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802ac4:	c1 e0 0c             	shl    $0xc,%eax
+  802ac7:	eb 0e                	jmp    802ad7 <nfu+0x165>
+  802ac9:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802acb:	89 f8                	mov    %edi,%eax
+  802acd:	3c ff                	cmp    $0xff,%al
+  802acf:	74 0e                	je     802adf <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802ad1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802ad4:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802ad7:	83 c4 14             	add    $0x14,%esp
+  802ada:	5b                   	pop    %ebx
+  802adb:	5e                   	pop    %esi
+  802adc:	5f                   	pop    %edi
+  802add:	5d                   	pop    %ebp
+  802ade:	c3                   	ret
+	pgnum = 0;
+  802adf:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  802ae6:	00 00 00 
+	return (void*)UTOP;
+  802ae9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802aee:	eb e7                	jmp    802ad7 <nfu+0x165>
+
+00802af0 <lru>:
+{
+  802af0:	55                   	push   %ebp
+  802af1:	89 e5                	mov    %esp,%ebp
+  802af3:	57                   	push   %edi
+  802af4:	56                   	push   %esi
+  802af5:	53                   	push   %ebx
+  802af6:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802af9:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  802aff:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  802b06:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802b0d:	be 00 00 00 00       	mov    $0x0,%esi
+  802b12:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802b19:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b1e:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  802b21:	eb 18                	jmp    802b3b <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802b23:	f7 d0                	not    %eax
+  802b25:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802b2a:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802b2c:	83 c2 01             	add    $0x1,%edx
+  802b2f:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802b35:	0f 87 fa 00 00 00    	ja     802c35 <lru+0x145>
+		++num_searched_ptes;
+  802b3b:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802b3e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802b41:	01 d0                	add    %edx,%eax
+  802b43:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802b48:	89 c1                	mov    %eax,%ecx
+  802b4a:	c1 e9 0a             	shr    $0xa,%ecx
+  802b4d:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802b54:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802b5a:	83 f9 01             	cmp    $0x1,%ecx
+  802b5d:	75 c4                	jne    802b23 <lru+0x33>
+  802b5f:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802b64:	77 bd                	ja     802b23 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802b66:	89 c1                	mov    %eax,%ecx
+  802b68:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b6b:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802b71:	0f 87 92 00 00 00    	ja     802c09 <lru+0x119>
+  802b77:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802b7d:	0f 82 86 00 00 00    	jb     802c09 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b83:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b8a:	f6 c1 01             	test   $0x1,%cl
+  802b8d:	74 7a                	je     802c09 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802b8f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b96:	f6 c5 04             	test   $0x4,%ch
+  802b99:	75 6e                	jne    802c09 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802b9b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802ba2:	f6 c5 02             	test   $0x2,%ch
+  802ba5:	75 62                	jne    802c09 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802ba7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802bae:	c1 e9 0c             	shr    $0xc,%ecx
+  802bb1:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802bb4:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802bba:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802bbe:	66 83 f9 01          	cmp    $0x1,%cx
+  802bc2:	77 45                	ja     802c09 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  802bc4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802bcb:	c1 e9 0c             	shr    $0xc,%ecx
+  802bce:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802bd1:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802bd7:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802bda:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802bdd:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  802be0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802be3:	19 df                	sbb    %ebx,%edi
+  802be5:	7c 22                	jl     802c09 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  802be7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802bee:	c1 e9 0c             	shr    $0xc,%ecx
+  802bf1:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802bf4:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802bfa:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802bfd:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802c00:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802c03:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c06:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802c09:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  802c0c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802c13:	df 6d e0             	fildll -0x20(%ebp)
+  802c16:	d9 05 74 56 80 00    	flds   0x805674
+  802c1c:	d9 c9                	fxch   %st(1)
+  802c1e:	df f1                	fcomip %st(1),%st
+  802c20:	dd d8                	fstp   %st(0)
+  802c22:	0f 82 04 ff ff ff    	jb     802b2c <lru+0x3c>
+			pgnum = pgnum_actual;
+  802c28:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  802c2d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802c30:	c1 e0 0c             	shl    $0xc,%eax
+  802c33:	eb 06                	jmp    802c3b <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  802c35:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802c38:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802c3b:	83 c4 1c             	add    $0x1c,%esp
+  802c3e:	5b                   	pop    %ebx
+  802c3f:	5e                   	pop    %esi
+  802c40:	5f                   	pop    %edi
+  802c41:	5d                   	pop    %ebp
+  802c42:	c3                   	ret
+
+00802c43 <set_page_choice_func>:
+{
+  802c43:	55                   	push   %ebp
+  802c44:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  802c46:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c49:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  802c4e:	5d                   	pop    %ebp
+  802c4f:	c3                   	ret
+
+00802c50 <get_page_choice>:
+{
+  802c50:	55                   	push   %ebp
+  802c51:	89 e5                	mov    %esp,%ebp
+  802c53:	57                   	push   %edi
+  802c54:	56                   	push   %esi
+  802c55:	53                   	push   %ebx
+  802c56:	83 ec 24             	sub    $0x24,%esp
+  802c59:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c5c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  802c5f:	57                   	push   %edi
+  802c60:	56                   	push   %esi
+  802c61:	ff 15 3c 60 80 00    	call   *0x80603c
+  802c67:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802c69:	83 c4 10             	add    $0x10,%esp
+  802c6c:	eb 25                	jmp    802c93 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  802c6e:	83 ec 08             	sub    $0x8,%esp
+  802c71:	c1 e0 16             	shl    $0x16,%eax
+  802c74:	50                   	push   %eax
+  802c75:	6a 00                	push   $0x0
+  802c77:	e8 ec e0 ff ff       	call   800d68 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802c7c:	83 c4 10             	add    $0x10,%esp
+  802c7f:	85 c0                	test   %eax,%eax
+  802c81:	75 43                	jne    802cc6 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  802c83:	83 ec 08             	sub    $0x8,%esp
+  802c86:	57                   	push   %edi
+  802c87:	56                   	push   %esi
+  802c88:	ff 15 3c 60 80 00    	call   *0x80603c
+  802c8e:	89 c3                	mov    %eax,%ebx
+  802c90:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802c93:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802c96:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  802c9c:	0f 86 ae 00 00 00    	jbe    802d50 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  802ca7:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802cae:	81 e2 81 00 00 00    	and    $0x81,%edx
+  802cb4:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  802cba:	74 b2                	je     802c6e <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802cbc:	83 c0 01             	add    $0x1,%eax
+  802cbf:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  802cc4:	75 e1                	jne    802ca7 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802cc6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802cc9:	05 00 10 40 11       	add    $0x11401000,%eax
+  802cce:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802cd3:	76 1f                	jbe    802cf4 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  802cd5:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  802cda:	89 d8                	mov    %ebx,%eax
+  802cdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cdf:	5b                   	pop    %ebx
+  802ce0:	5e                   	pop    %esi
+  802ce1:	5f                   	pop    %edi
+  802ce2:	5d                   	pop    %ebp
+  802ce3:	c3                   	ret
+		sys_page_split(0, pg_out);
+  802ce4:	83 ec 08             	sub    $0x8,%esp
+  802ce7:	53                   	push   %ebx
+  802ce8:	6a 00                	push   $0x0
+  802cea:	e8 79 e0 ff ff       	call   800d68 <sys_page_split>
+  802cef:	83 c4 10             	add    $0x10,%esp
+  802cf2:	eb 6c                	jmp    802d60 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  802cf4:	83 ec 04             	sub    $0x4,%esp
+  802cf7:	68 1c 52 80 00       	push   $0x80521c
+  802cfc:	68 cc 01 00 00       	push   $0x1cc
+  802d01:	68 8a 51 80 00       	push   $0x80518a
+  802d06:	e8 e1 d3 ff ff       	call   8000ec <_panic>
+		panic("We tried to page out code pages\n");
+  802d0b:	83 ec 04             	sub    $0x4,%esp
+  802d0e:	68 4c 52 80 00       	push   $0x80524c
+  802d13:	68 d6 01 00 00       	push   $0x1d6
+  802d18:	68 8a 51 80 00       	push   $0x80518a
+  802d1d:	e8 ca d3 ff ff       	call   8000ec <_panic>
+		panic("Invalid mapping for the va\n");
+  802d22:	83 ec 04             	sub    $0x4,%esp
+  802d25:	68 97 51 80 00       	push   $0x805197
+  802d2a:	68 da 01 00 00       	push   $0x1da
+  802d2f:	68 8a 51 80 00       	push   $0x80518a
+  802d34:	e8 b3 d3 ff ff       	call   8000ec <_panic>
+		panic("We tried to page out a shared page\n");
+  802d39:	83 ec 04             	sub    $0x4,%esp
+  802d3c:	68 70 52 80 00       	push   $0x805270
+  802d41:	68 e0 01 00 00       	push   $0x1e0
+  802d46:	68 8a 51 80 00       	push   $0x80518a
+  802d4b:	e8 9c d3 ff ff       	call   8000ec <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  802d50:	89 de                	mov    %ebx,%esi
+  802d52:	c1 ee 16             	shr    $0x16,%esi
+  802d55:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802d5c:	a8 80                	test   $0x80,%al
+  802d5e:	75 84                	jne    802ce4 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802d60:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d63:	05 00 10 40 11       	add    $0x11401000,%eax
+  802d68:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802d6d:	76 85                	jbe    802cf4 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  802d6f:	89 d8                	mov    %ebx,%eax
+  802d71:	e8 7e f3 ff ff       	call   8020f4 <page_is_clean>
+  802d76:	84 c0                	test   %al,%al
+  802d78:	0f 85 5c ff ff ff    	jne    802cda <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  802d7e:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  802d85:	76 84                	jbe    802d0b <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  802d87:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802d8e:	a8 01                	test   $0x1,%al
+  802d90:	74 90                	je     802d22 <get_page_choice+0xd2>
+  802d92:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d95:	c1 e8 0c             	shr    $0xc,%eax
+  802d98:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802d9f:	f6 c2 01             	test   $0x1,%dl
+  802da2:	0f 84 7a ff ff ff    	je     802d22 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802da8:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  802daf:	f6 c2 01             	test   $0x1,%dl
+  802db2:	74 85                	je     802d39 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802db4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802dbb:	f6 c2 01             	test   $0x1,%dl
+  802dbe:	0f 84 75 ff ff ff    	je     802d39 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802dc4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802dcb:	f6 c6 04             	test   $0x4,%dh
+  802dce:	0f 85 65 ff ff ff    	jne    802d39 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  802dd4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802ddb:	f6 c6 02             	test   $0x2,%dh
+  802dde:	0f 85 55 ff ff ff    	jne    802d39 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  802de4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802deb:	c1 e8 0c             	shr    $0xc,%eax
+  802dee:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802df1:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802df6:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802dfa:	66 83 f8 01          	cmp    $0x1,%ax
+  802dfe:	0f 86 d6 fe ff ff    	jbe    802cda <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  802e04:	83 ec 04             	sub    $0x4,%esp
+  802e07:	68 94 52 80 00       	push   $0x805294
+  802e0c:	68 e2 01 00 00       	push   $0x1e2
+  802e11:	68 8a 51 80 00       	push   $0x80518a
+  802e16:	e8 d1 d2 ff ff       	call   8000ec <_panic>
+
+00802e1b <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  802e1b:	55                   	push   %ebp
+  802e1c:	89 e5                	mov    %esp,%ebp
+  802e1e:	57                   	push   %edi
+  802e1f:	56                   	push   %esi
+  802e20:	53                   	push   %ebx
+  802e21:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  802e24:	e8 e8 f6 ff ff       	call   802511 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  802e29:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802e2e:	85 c0                	test   %eax,%eax
+  802e30:	74 41                	je     802e73 <page_share_paged_out+0x58>
+  802e32:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  802e39:	0f 84 fd 00 00 00    	je     802f3c <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  802e3f:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802e46:	00 00 00 
+  802e49:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  802e50:	00 00 00 
+  802e53:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e58:	eb 2c                	jmp    802e86 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802e5a:	83 c3 04             	add    $0x4,%ebx
+  802e5d:	39 f3                	cmp    %esi,%ebx
+  802e5f:	74 1a                	je     802e7b <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  802e61:	8b 03                	mov    (%ebx),%eax
+  802e63:	a8 01                	test   $0x1,%al
+  802e65:	74 f3                	je     802e5a <page_share_paged_out+0x3f>
+  802e67:	c1 e8 0c             	shr    $0xc,%eax
+  802e6a:	e8 2b f5 ff ff       	call   80239a <page_share_slot>
+  802e6f:	85 c0                	test   %eax,%eax
+  802e71:	79 e7                	jns    802e5a <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  802e73:	83 c4 0c             	add    $0xc,%esp
+  802e76:	5b                   	pop    %ebx
+  802e77:	5e                   	pop    %esi
+  802e78:	5f                   	pop    %edi
+  802e79:	5d                   	pop    %ebp
+  802e7a:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  802e7b:	83 c7 04             	add    $0x4,%edi
+  802e7e:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  802e84:	74 1b                	je     802ea1 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  802e86:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  802e8b:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  802e8e:	f6 c3 01             	test   $0x1,%bl
+  802e91:	74 e8                	je     802e7b <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  802e93:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802e99:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  802e9f:	eb bc                	jmp    802e5d <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802ea1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ea6:	eb 11                	jmp    802eb9 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  802ea8:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802eae:	83 c3 01             	add    $0x1,%ebx
+  802eb1:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802eb7:	77 41                	ja     802efa <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  802eb9:	89 d8                	mov    %ebx,%eax
+  802ebb:	c1 e8 0a             	shr    $0xa,%eax
+  802ebe:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802ec5:	25 81 00 00 00       	and    $0x81,%eax
+  802eca:	83 f8 01             	cmp    $0x1,%eax
+  802ecd:	75 d9                	jne    802ea8 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  802ecf:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802ed6:	25 81 00 00 00       	and    $0x81,%eax
+  802edb:	3d 80 00 00 00       	cmp    $0x80,%eax
+  802ee0:	75 cc                	jne    802eae <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  802ee2:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802ee9:	c1 e8 0c             	shr    $0xc,%eax
+  802eec:	e8 a9 f4 ff ff       	call   80239a <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  802ef1:	85 c0                	test   %eax,%eax
+  802ef3:	79 b9                	jns    802eae <page_share_paged_out+0x93>
+  802ef5:	e9 79 ff ff ff       	jmp    802e73 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  802efa:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802f01:	75 13                	jne    802f16 <page_share_paged_out+0xfb>
+  802f03:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802f0a:	75 1d                	jne    802f29 <page_share_paged_out+0x10e>
+	return 0;
+  802f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f11:	e9 5d ff ff ff       	jmp    802e73 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  802f16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f1b:	e8 46 f4 ff ff       	call   802366 <page_share_send>
+  802f20:	85 c0                	test   %eax,%eax
+  802f22:	79 df                	jns    802f03 <page_share_paged_out+0xe8>
+  802f24:	e9 4a ff ff ff       	jmp    802e73 <page_share_paged_out+0x58>
+  802f29:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f2e:	e8 33 f4 ff ff       	call   802366 <page_share_send>
+  802f33:	85 c0                	test   %eax,%eax
+  802f35:	79 d5                	jns    802f0c <page_share_paged_out+0xf1>
+  802f37:	e9 37 ff ff ff       	jmp    802e73 <page_share_paged_out+0x58>
+		return 0;
+  802f3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f41:	e9 2d ff ff ff       	jmp    802e73 <page_share_paged_out+0x58>
+
+00802f46 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  802f46:	55                   	push   %ebp
+  802f47:	89 e5                	mov    %esp,%ebp
+  802f49:	56                   	push   %esi
+  802f4a:	53                   	push   %ebx
+  802f4b:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  802f4e:	e8 be f5 ff ff       	call   802511 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  802f53:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  802f58:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  802f5f:	0f 84 82 00 00 00    	je     802fe7 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  802f65:	83 ec 0c             	sub    $0xc,%esp
+  802f68:	68 00 10 00 00       	push   $0x1000
+  802f6d:	e8 84 11 00 00       	call   8040f6 <malloc>
+  802f72:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  802f74:	83 c4 0c             	add    $0xc,%esp
+  802f77:	6a 14                	push   $0x14
+  802f79:	6a 00                	push   $0x0
+  802f7b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802f7e:	50                   	push   %eax
+  802f7f:	e8 7b d9 ff ff       	call   8008ff <memset>
+  802f84:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  802f87:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  802f8c:	83 ec 0c             	sub    $0xc,%esp
+  802f8f:	6a 07                	push   $0x7
+  802f91:	6a 01                	push   $0x1
+  802f93:	53                   	push   %ebx
+  802f94:	6a 03                	push   $0x3
+  802f96:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  802f9d:	e8 b7 19 00 00       	call   804959 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  802fa2:	8b 03                	mov    (%ebx),%eax
+  802fa4:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  802fa7:	8b 43 04             	mov    0x4(%ebx),%eax
+  802faa:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  802fad:	8b 43 08             	mov    0x8(%ebx),%eax
+  802fb0:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  802fb3:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802fb6:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  802fb9:	8b 43 10             	mov    0x10(%ebx),%eax
+  802fbc:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  802fbf:	83 c6 01             	add    $0x1,%esi
+  802fc2:	83 c4 20             	add    $0x20,%esp
+  802fc5:	83 fe 02             	cmp    $0x2,%esi
+  802fc8:	75 c2                	jne    802f8c <get_paging_stats+0x46>
+	}
+	*stats = total;
+  802fca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fcd:	89 03                	mov    %eax,(%ebx)
+  802fcf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802fd2:	89 43 04             	mov    %eax,0x4(%ebx)
+  802fd5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802fd8:	89 43 08             	mov    %eax,0x8(%ebx)
+  802fdb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802fde:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802fe1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fe4:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  802fe7:	89 d8                	mov    %ebx,%eax
+  802fe9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fec:	5b                   	pop    %ebx
+  802fed:	5e                   	pop    %esi
+  802fee:	5d                   	pop    %ebp
+  802fef:	c3                   	ret
+
+00802ff0 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  802ff0:	55                   	push   %ebp
+  802ff1:	89 e5                	mov    %esp,%ebp
+  802ff3:	53                   	push   %ebx
+  802ff4:	83 ec 10             	sub    $0x10,%esp
+  802ff7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  802ffa:	68 b1 51 80 00       	push   $0x8051b1
+  802fff:	e8 c3 d1 ff ff       	call   8001c7 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  803004:	83 c4 08             	add    $0x8,%esp
+  803007:	ff 33                	push   (%ebx)
+  803009:	68 c8 52 80 00       	push   $0x8052c8
+  80300e:	e8 b4 d1 ff ff       	call   8001c7 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  803013:	83 c4 08             	add    $0x8,%esp
+  803016:	ff 73 04             	push   0x4(%ebx)
+  803019:	68 b3 51 80 00       	push   $0x8051b3
+  80301e:	e8 a4 d1 ff ff       	call   8001c7 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  803023:	83 c4 08             	add    $0x8,%esp
+  803026:	ff 73 08             	push   0x8(%ebx)
+  803029:	68 e8 52 80 00       	push   $0x8052e8
+  80302e:	e8 94 d1 ff ff       	call   8001c7 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  803033:	83 c4 08             	add    $0x8,%esp
+  803036:	ff 73 0c             	push   0xc(%ebx)
+  803039:	68 0c 53 80 00       	push   $0x80530c
+  80303e:	e8 84 d1 ff ff       	call   8001c7 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  803043:	83 c4 08             	add    $0x8,%esp
+  803046:	ff 73 10             	push   0x10(%ebx)
+  803049:	68 30 53 80 00       	push   $0x805330
+  80304e:	e8 74 d1 ff ff       	call   8001c7 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  803053:	83 c4 08             	add    $0x8,%esp
+  803056:	ff 35 08 b0 80 00    	push   0x80b008
+  80305c:	68 6c 53 80 00       	push   $0x80536c
+  803061:	e8 61 d1 ff ff       	call   8001c7 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  803066:	83 c4 08             	add    $0x8,%esp
+  803069:	ff 35 04 b0 80 00    	push   0x80b004
+  80306f:	68 a0 53 80 00       	push   $0x8053a0
+  803074:	e8 4e d1 ff ff       	call   8001c7 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  803079:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80307e:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  803081:	8b 50 68             	mov    0x68(%eax),%edx
+  803084:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  803087:	51                   	push   %ecx
+  803088:	52                   	push   %edx
+  803089:	50                   	push   %eax
+  80308a:	68 e0 53 80 00       	push   $0x8053e0
+  80308f:	e8 33 d1 ff ff       	call   8001c7 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  803094:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803099:	8b 40 70             	mov    0x70(%eax),%eax
+  80309c:	83 c4 18             	add    $0x18,%esp
+  80309f:	50                   	push   %eax
+  8030a0:	68 14 54 80 00       	push   $0x805414
+  8030a5:	e8 1d d1 ff ff       	call   8001c7 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  8030aa:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  8030b0:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  8030b6:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  8030bb:	51                   	push   %ecx
+  8030bc:	52                   	push   %edx
+  8030bd:	50                   	push   %eax
+  8030be:	68 44 54 80 00       	push   $0x805444
+  8030c3:	e8 ff d0 ff ff       	call   8001c7 <cprintf>
+	cprintf("\n");
+  8030c8:	83 c4 14             	add    $0x14,%esp
+  8030cb:	68 b1 51 80 00       	push   $0x8051b1
+  8030d0:	e8 f2 d0 ff ff       	call   8001c7 <cprintf>
+}
+  8030d5:	83 c4 10             	add    $0x10,%esp
+  8030d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030db:	c9                   	leave
+  8030dc:	c3                   	ret
+
+008030dd <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  8030dd:	55                   	push   %ebp
+  8030de:	89 e5                	mov    %esp,%ebp
+  8030e0:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  8030e3:	e8 5e fe ff ff       	call   802f46 <get_paging_stats>
+  8030e8:	83 ec 0c             	sub    $0xc,%esp
+  8030eb:	50                   	push   %eax
+  8030ec:	e8 ff fe ff ff       	call   802ff0 <print_paging_stats>
+}
+  8030f1:	83 c4 10             	add    $0x10,%esp
+  8030f4:	c9                   	leave
+  8030f5:	c3                   	ret
+
+008030f6 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  8030f6:	55                   	push   %ebp
+  8030f7:	89 e5                	mov    %esp,%ebp
+  8030f9:	53                   	push   %ebx
+  8030fa:	83 ec 04             	sub    $0x4,%esp
+  8030fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803100:	eb 13                	jmp    803115 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803102:	83 ec 04             	sub    $0x4,%esp
+  803105:	6a ff                	push   $0xffffffff
+  803107:	53                   	push   %ebx
+  803108:	68 00 f0 ff ee       	push   $0xeefff000
+  80310d:	e8 68 e0 ff ff       	call   80117a <sys_futex_wait>
+  803112:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803115:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  80311a:	39 d8                	cmp    %ebx,%eax
+  80311c:	74 e4                	je     803102 <mem_pressure_wait+0xc>
+	return now;
+}
+  80311e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803121:	c9                   	leave
+  803122:	c3                   	ret
+
+00803123 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803123:	55                   	push   %ebp
+  803124:	89 e5                	mov    %esp,%ebp
+  803126:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  803129:	68 95 3d 80 00       	push   $0x803d95
+  80312e:	e8 32 16 00 00       	call   804765 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803133:	c7 05 14 e9 80 00 00 	movl   $0xdeadb000,0x80e914
+  80313a:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  80313d:	83 c4 0c             	add    $0xc,%esp
+  803140:	68 07 02 00 00       	push   $0x207
+  803145:	68 00 b0 ad de       	push   $0xdeadb000
+  80314a:	6a 00                	push   $0x0
+  80314c:	e8 50 db ff ff       	call   800ca1 <sys_page_alloc>
+  803151:	83 c4 10             	add    $0x10,%esp
+  803154:	85 c0                	test   %eax,%eax
+  803156:	78 0c                	js     803164 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  803158:	e8 b4 f3 ff ff       	call   802511 <find_paging_env>
+	page_ring_ready();
+  80315d:	e8 7f f2 ff ff       	call   8023e1 <page_ring_ready>
+}
+  803162:	c9                   	leave
+  803163:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  803164:	50                   	push   %eax
+  803165:	68 d1 51 80 00       	push   $0x8051d1
+  80316a:	68 13 05 00 00       	push   $0x513
+  80316f:	68 8a 51 80 00       	push   $0x80518a
+  803174:	e8 73 cf ff ff       	call   8000ec <_panic>
+
+00803179 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  803179:	55                   	push   %ebp
+  80317a:	89 e5                	mov    %esp,%ebp
+  80317c:	57                   	push   %edi
+  80317d:	56                   	push   %esi
+  80317e:	53                   	push   %ebx
+  80317f:	83 ec 0c             	sub    $0xc,%esp
+  803182:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  803185:	89 fa                	mov    %edi,%edx
+  803187:	c1 ea 16             	shr    $0x16,%edx
+  80318a:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  80318f:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  803192:	f6 06 01             	testb  $0x1,(%esi)
+  803195:	75 3e                	jne    8031d5 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803197:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  80319c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8031a0:	74 47                	je     8031e9 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  8031a2:	83 ec 0c             	sub    $0xc,%esp
+  8031a5:	6a 01                	push   $0x1
+  8031a7:	e8 f2 11 00 00       	call   80439e <va_alloc>
+  8031ac:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  8031ae:	83 c4 10             	add    $0x10,%esp
+  8031b1:	85 c0                	test   %eax,%eax
+  8031b3:	74 34                	je     8031e9 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  8031b5:	6a 00                	push   $0x0
+  8031b7:	68 07 02 00 00       	push   $0x207
+  8031bc:	50                   	push   %eax
+  8031bd:	6a 00                	push   $0x0
+  8031bf:	e8 df 02 00 00       	call   8034a3 <page_alloc>
+  8031c4:	83 c4 10             	add    $0x10,%esp
+  8031c7:	85 c0                	test   %eax,%eax
+  8031c9:	78 28                	js     8031f3 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  8031cb:	f6 06 01             	testb  $0x1,(%esi)
+  8031ce:	75 38                	jne    803208 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  8031d0:	83 cb 01             	or     $0x1,%ebx
+  8031d3:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  8031d5:	89 f8                	mov    %edi,%eax
+  8031d7:	c1 e8 0a             	shr    $0xa,%eax
+  8031da:	25 fc 0f 00 00       	and    $0xffc,%eax
+  8031df:	8b 1e                	mov    (%esi),%ebx
+  8031e1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8031e7:	01 c3                	add    %eax,%ebx
+}
+  8031e9:	89 d8                	mov    %ebx,%eax
+  8031eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031ee:	5b                   	pop    %ebx
+  8031ef:	5e                   	pop    %esi
+  8031f0:	5f                   	pop    %edi
+  8031f1:	5d                   	pop    %ebp
+  8031f2:	c3                   	ret
+			va_free(page, 1);
+  8031f3:	83 ec 08             	sub    $0x8,%esp
+  8031f6:	6a 01                	push   $0x1
+  8031f8:	53                   	push   %ebx
+  8031f9:	e8 d8 12 00 00       	call   8044d6 <va_free>
+			return NULL;
+  8031fe:	83 c4 10             	add    $0x10,%esp
+  803201:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803206:	eb e1                	jmp    8031e9 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  803208:	83 ec 08             	sub    $0x8,%esp
+  80320b:	53                   	push   %ebx
+  80320c:	6a 00                	push   $0x0
+  80320e:	e8 13 db ff ff       	call   800d26 <sys_page_unmap>
+			va_free(page, 1);
+  803213:	83 c4 08             	add    $0x8,%esp
+  803216:	6a 01                	push   $0x1
+  803218:	53                   	push   %ebx
+  803219:	e8 b8 12 00 00       	call   8044d6 <va_free>
+  80321e:	83 c4 10             	add    $0x10,%esp
+  803221:	eb b2                	jmp    8031d5 <umapdir_walk+0x5c>
+
+00803223 <page_out>:
+{
+  803223:	55                   	push   %ebp
+  803224:	89 e5                	mov    %esp,%ebp
+  803226:	57                   	push   %edi
+  803227:	56                   	push   %esi
+  803228:	53                   	push   %ebx
+  803229:	83 ec 5c             	sub    $0x5c,%esp
+  80322c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  80322f:	e8 dd f2 ff ff       	call   802511 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803234:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803239:	85 c0                	test   %eax,%eax
+  80323b:	74 1e                	je     80325b <page_out+0x38>
+  80323d:	83 ec 0c             	sub    $0xc,%esp
+  803240:	6a 00                	push   $0x0
+  803242:	6a 00                	push   $0x0
+  803244:	6a 00                	push   $0x0
+  803246:	6a 08                	push   $0x8
+  803248:	50                   	push   %eax
+  803249:	e8 0b 17 00 00       	call   804959 <ipc_call>
+  80324e:	89 c3                	mov    %eax,%ebx
+  803250:	83 c4 20             	add    $0x20,%esp
+  803253:	85 c0                	test   %eax,%eax
+  803255:	0f 84 ac 00 00 00    	je     803307 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  80325b:	83 ec 08             	sub    $0x8,%esp
+  80325e:	ff 75 0c             	push   0xc(%ebp)
+  803261:	57                   	push   %edi
+  803262:	e8 e9 f9 ff ff       	call   802c50 <get_page_choice>
+  803267:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  803269:	83 c4 10             	add    $0x10,%esp
+  80326c:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803271:	0f 84 18 02 00 00    	je     80348f <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803277:	e8 78 ee ff ff       	call   8020f4 <page_is_clean>
+  80327c:	84 c0                	test   %al,%al
+  80327e:	0f 85 8c 00 00 00    	jne    803310 <page_out+0xed>
+	if (pagingenv == 0)
+  803284:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  80328b:	0f 84 08 02 00 00    	je     803499 <page_out+0x276>
+	if (page_ring_ready())
+  803291:	e8 4b f1 ff ff       	call   8023e1 <page_ring_ready>
+  803296:	89 c3                	mov    %eax,%ebx
+  803298:	85 c0                	test   %eax,%eax
+  80329a:	0f 85 89 00 00 00    	jne    803329 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  8032a0:	83 ec 0c             	sub    $0xc,%esp
+  8032a3:	6a 05                	push   $0x5
+  8032a5:	6a 01                	push   $0x1
+  8032a7:	56                   	push   %esi
+  8032a8:	6a 01                	push   $0x1
+  8032aa:	ff 35 40 b0 80 00    	push   0x80b040
+  8032b0:	e8 a4 16 00 00       	call   804959 <ipc_call>
+  8032b5:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  8032b7:	83 c4 20             	add    $0x20,%esp
+  8032ba:	85 c0                	test   %eax,%eax
+  8032bc:	0f 88 b8 01 00 00    	js     80347a <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  8032c2:	89 f0                	mov    %esi,%eax
+  8032c4:	c1 e8 0c             	shr    $0xc,%eax
+  8032c7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8032ce:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  8032d1:	83 ec 08             	sub    $0x8,%esp
+  8032d4:	56                   	push   %esi
+  8032d5:	6a 00                	push   $0x0
+  8032d7:	e8 4a da ff ff       	call   800d26 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  8032dc:	83 c4 08             	add    $0x8,%esp
+  8032df:	6a 01                	push   $0x1
+  8032e1:	56                   	push   %esi
+  8032e2:	e8 92 fe ff ff       	call   803179 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  8032e7:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  8032ea:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  8032f0:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  8032f3:	09 fe                	or     %edi,%esi
+  8032f5:	83 ce 01             	or     $0x1,%esi
+  8032f8:	89 30                	mov    %esi,(%eax)
+	return 0;
+  8032fa:	83 c4 10             	add    $0x10,%esp
+}
+  8032fd:	89 d8                	mov    %ebx,%eax
+  8032ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803302:	5b                   	pop    %ebx
+  803303:	5e                   	pop    %esi
+  803304:	5f                   	pop    %edi
+  803305:	5d                   	pop    %ebp
+  803306:	c3                   	ret
+		num_page_reclaims++;
+  803307:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  80330e:	eb ed                	jmp    8032fd <page_out+0xda>
+		num_page_drops++;
+  803310:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  803317:	83 ec 08             	sub    $0x8,%esp
+  80331a:	56                   	push   %esi
+  80331b:	6a 00                	push   $0x0
+  80331d:	e8 04 da ff ff       	call   800d26 <sys_page_unmap>
+  803322:	89 c3                	mov    %eax,%ebx
+  803324:	83 c4 10             	add    $0x10,%esp
+  803327:	eb d4                	jmp    8032fd <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803329:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  80332b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803330:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803335:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803338:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  80333a:	83 c0 08             	add    $0x8,%eax
+  80333d:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803340:	b8 07 00 00 00       	mov    $0x7,%eax
+  803345:	e8 e5 ef ff ff       	call   80232f <page_ring_reserve>
+	first = ring->sq_tail;
+  80334a:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80334f:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803352:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803357:	83 ec 04             	sub    $0x4,%esp
+  80335a:	68 00 10 00 00       	push   $0x1000
+  80335f:	56                   	push   %esi
+  803360:	89 d8                	mov    %ebx,%eax
+  803362:	c1 e0 0c             	shl    $0xc,%eax
+  803365:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  80336a:	50                   	push   %eax
+  80336b:	e8 26 d6 ff ff       	call   800996 <memcpy>
+		vas[n] = va;
+  803370:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803374:	89 d9                	mov    %ebx,%ecx
+  803376:	ba 00 00 00 00       	mov    $0x0,%edx
+  80337b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803380:	e8 de ee ff ff       	call   802263 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803385:	8d 43 01             	lea    0x1(%ebx),%eax
+  803388:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  80338b:	83 c4 10             	add    $0x10,%esp
+  80338e:	83 fb 06             	cmp    $0x6,%ebx
+  803391:	74 62                	je     8033f5 <page_out+0x1d2>
+  803393:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803396:	eb 15                	jmp    8033ad <page_out+0x18a>
+			num_page_drops++;
+  803398:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  80339f:	83 ec 08             	sub    $0x8,%esp
+  8033a2:	56                   	push   %esi
+  8033a3:	6a 00                	push   $0x0
+  8033a5:	e8 7c d9 ff ff       	call   800d26 <sys_page_unmap>
+  8033aa:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  8033ad:	83 ec 08             	sub    $0x8,%esp
+  8033b0:	53                   	push   %ebx
+  8033b1:	57                   	push   %edi
+  8033b2:	e8 99 f8 ff ff       	call   802c50 <get_page_choice>
+  8033b7:	89 c6                	mov    %eax,%esi
+  8033b9:	83 c4 10             	add    $0x10,%esp
+  8033bc:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8033c1:	74 32                	je     8033f5 <page_out+0x1d2>
+  8033c3:	e8 2c ed ff ff       	call   8020f4 <page_is_clean>
+  8033c8:	84 c0                	test   %al,%al
+  8033ca:	75 cc                	jne    803398 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  8033cc:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  8033cf:	39 c6                	cmp    %eax,%esi
+  8033d1:	72 07                	jb     8033da <page_out+0x1b7>
+  8033d3:	8b 45 98             	mov    -0x68(%ebp),%eax
+  8033d6:	39 c6                	cmp    %eax,%esi
+  8033d8:	72 1b                	jb     8033f5 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  8033da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033df:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  8033e2:	eb 03                	jmp    8033e7 <page_out+0x1c4>
+  8033e4:	83 c3 01             	add    $0x1,%ebx
+  8033e7:	39 da                	cmp    %ebx,%edx
+  8033e9:	0f 84 68 ff ff ff    	je     803357 <page_out+0x134>
+  8033ef:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  8033f3:	75 ef                	jne    8033e4 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  8033f5:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  8033f8:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  8033fb:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  8033fe:	e8 a6 ee ff ff       	call   8022a9 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803403:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803408:	eb 42                	jmp    80344c <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  80340a:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  80340e:	89 f8                	mov    %edi,%eax
+  803410:	c1 e8 0c             	shr    $0xc,%eax
+  803413:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80341a:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  80341d:	83 ec 08             	sub    $0x8,%esp
+  803420:	57                   	push   %edi
+  803421:	6a 00                	push   $0x0
+  803423:	e8 fe d8 ff ff       	call   800d26 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803428:	83 c4 08             	add    $0x8,%esp
+  80342b:	6a 01                	push   $0x1
+  80342d:	57                   	push   %edi
+  80342e:	e8 46 fd ff ff       	call   803179 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803433:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803436:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  80343c:	c1 e6 0c             	shl    $0xc,%esi
+  80343f:	09 d6                	or     %edx,%esi
+  803441:	83 ce 01             	or     $0x1,%esi
+  803444:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803446:	83 c3 01             	add    $0x1,%ebx
+  803449:	83 c4 10             	add    $0x10,%esp
+  80344c:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  80344f:	39 c3                	cmp    %eax,%ebx
+  803451:	74 1d                	je     803470 <page_out+0x24d>
+		if (res[i] < 0)
+  803453:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803457:	85 f6                	test   %esi,%esi
+  803459:	79 af                	jns    80340a <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  80345b:	56                   	push   %esi
+  80345c:	68 74 54 80 00       	push   $0x805474
+  803461:	68 d1 02 00 00       	push   $0x2d1
+  803466:	68 8a 51 80 00       	push   $0x80518a
+  80346b:	e8 7c cc ff ff       	call   8000ec <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803470:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803475:	e9 83 fe ff ff       	jmp    8032fd <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  80347a:	50                   	push   %eax
+  80347b:	68 74 54 80 00       	push   $0x805474
+  803480:	68 0a 03 00 00       	push   $0x30a
+  803485:	68 8a 51 80 00       	push   $0x80518a
+  80348a:	e8 5d cc ff ff       	call   8000ec <_panic>
+		return -E_NO_MEM;
+  80348f:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803494:	e9 64 fe ff ff       	jmp    8032fd <page_out+0xda>
+		return -E_PAGING;
+  803499:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80349e:	e9 5a fe ff ff       	jmp    8032fd <page_out+0xda>
+
+008034a3 <page_alloc>:
+{
+  8034a3:	55                   	push   %ebp
+  8034a4:	89 e5                	mov    %esp,%ebp
+  8034a6:	57                   	push   %edi
+  8034a7:	56                   	push   %esi
+  8034a8:	53                   	push   %ebx
+  8034a9:	83 ec 0c             	sub    $0xc,%esp
+  8034ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8034af:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  8034b2:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  8034b9:	74 34                	je     8034ef <page_alloc+0x4c>
+	if (check_mte)
+  8034bb:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8034bf:	75 35                	jne    8034f6 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  8034c1:	83 ec 04             	sub    $0x4,%esp
+  8034c4:	ff 75 10             	push   0x10(%ebp)
+  8034c7:	56                   	push   %esi
+  8034c8:	57                   	push   %edi
+  8034c9:	e8 d3 d7 ff ff       	call   800ca1 <sys_page_alloc>
+  8034ce:	89 c3                	mov    %eax,%ebx
+  8034d0:	83 c4 10             	add    $0x10,%esp
+  8034d3:	85 c0                	test   %eax,%eax
+  8034d5:	79 52                	jns    803529 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  8034d7:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8034da:	75 52                	jne    80352e <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  8034dc:	83 ec 08             	sub    $0x8,%esp
+  8034df:	56                   	push   %esi
+  8034e0:	57                   	push   %edi
+  8034e1:	e8 3d fd ff ff       	call   803223 <page_out>
+  8034e6:	83 c4 10             	add    $0x10,%esp
+  8034e9:	85 c0                	test   %eax,%eax
+  8034eb:	79 d4                	jns    8034c1 <page_alloc+0x1e>
+  8034ed:	eb 3f                	jmp    80352e <page_alloc+0x8b>
+		init_map_dir();
+  8034ef:	e8 2f fc ff ff       	call   803123 <init_map_dir>
+  8034f4:	eb c5                	jmp    8034bb <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  8034f6:	83 ec 08             	sub    $0x8,%esp
+  8034f9:	6a 00                	push   $0x0
+  8034fb:	56                   	push   %esi
+  8034fc:	e8 78 fc ff ff       	call   803179 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803501:	83 c4 10             	add    $0x10,%esp
+  803504:	85 c0                	test   %eax,%eax
+  803506:	74 b9                	je     8034c1 <page_alloc+0x1e>
+  803508:	8b 10                	mov    (%eax),%edx
+  80350a:	f6 c2 01             	test   $0x1,%dl
+  80350d:	74 b2                	je     8034c1 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  80350f:	83 ec 08             	sub    $0x8,%esp
+  803512:	56                   	push   %esi
+  803513:	52                   	push   %edx
+  803514:	50                   	push   %eax
+  803515:	68 98 54 80 00       	push   $0x805498
+  80351a:	68 34 03 00 00       	push   $0x334
+  80351f:	68 8a 51 80 00       	push   $0x80518a
+  803524:	e8 c3 cb ff ff       	call   8000ec <_panic>
+	return 0;
+  803529:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80352e:	89 d8                	mov    %ebx,%eax
+  803530:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803533:	5b                   	pop    %ebx
+  803534:	5e                   	pop    %esi
+  803535:	5f                   	pop    %edi
+  803536:	5d                   	pop    %ebp
+  803537:	c3                   	ret
+
+00803538 <page_adopt>:
+{
+  803538:	55                   	push   %ebp
+  803539:	89 e5                	mov    %esp,%ebp
+  80353b:	56                   	push   %esi
+  80353c:	53                   	push   %ebx
+  80353d:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  80353f:	c1 e8 16             	shr    $0x16,%eax
+  803542:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803549:	25 81 00 00 00       	and    $0x81,%eax
+  80354e:	83 f8 01             	cmp    $0x1,%eax
+  803551:	75 53                	jne    8035a6 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803553:	89 d8                	mov    %ebx,%eax
+  803555:	c1 e8 0c             	shr    $0xc,%eax
+  803558:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  80355f:	89 f2                	mov    %esi,%edx
+  803561:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803567:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  80356c:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803572:	75 37                	jne    8035ab <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803574:	83 ec 08             	sub    $0x8,%esp
+  803577:	6a 01                	push   $0x1
+  803579:	53                   	push   %ebx
+  80357a:	e8 fa fb ff ff       	call   803179 <umapdir_walk>
+  80357f:	83 c4 10             	add    $0x10,%esp
+  803582:	85 c0                	test   %eax,%eax
+  803584:	74 2c                	je     8035b2 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803586:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  80358c:	83 ce 01             	or     $0x1,%esi
+  80358f:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803591:	83 ec 08             	sub    $0x8,%esp
+  803594:	53                   	push   %ebx
+  803595:	6a 00                	push   $0x0
+  803597:	e8 8a d7 ff ff       	call   800d26 <sys_page_unmap>
+	return 1;
+  80359c:	83 c4 10             	add    $0x10,%esp
+  80359f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8035a4:	eb 05                	jmp    8035ab <page_adopt+0x73>
+		return 0;
+  8035a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035ae:	5b                   	pop    %ebx
+  8035af:	5e                   	pop    %esi
+  8035b0:	5d                   	pop    %ebp
+  8035b1:	c3                   	ret
+		return -E_NO_MEM;
+  8035b2:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8035b7:	eb f2                	jmp    8035ab <page_adopt+0x73>
+
+008035b9 <page_forget>:
+{
+  8035b9:	55                   	push   %ebp
+  8035ba:	89 e5                	mov    %esp,%ebp
+  8035bc:	53                   	push   %ebx
+  8035bd:	83 ec 04             	sub    $0x4,%esp
+  8035c0:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  8035c2:	e8 4a ef ff ff       	call   802511 <find_paging_env>
+	if (pagingenv == 0)
+  8035c7:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8035ce:	74 39                	je     803609 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  8035d0:	89 d8                	mov    %ebx,%eax
+  8035d2:	c1 e8 16             	shr    $0x16,%eax
+  8035d5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8035dc:	25 81 00 00 00       	and    $0x81,%eax
+  8035e1:	83 f8 01             	cmp    $0x1,%eax
+  8035e4:	74 28                	je     80360e <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  8035e6:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  8035ed:	74 1a                	je     803609 <page_forget+0x50>
+  8035ef:	83 ec 08             	sub    $0x8,%esp
+  8035f2:	6a 00                	push   $0x0
+  8035f4:	53                   	push   %ebx
+  8035f5:	e8 7f fb ff ff       	call   803179 <umapdir_walk>
+  8035fa:	89 c3                	mov    %eax,%ebx
+  8035fc:	83 c4 10             	add    $0x10,%esp
+  8035ff:	85 c0                	test   %eax,%eax
+  803601:	74 06                	je     803609 <page_forget+0x50>
+  803603:	8b 00                	mov    (%eax),%eax
+  803605:	a8 01                	test   $0x1,%al
+  803607:	75 2b                	jne    803634 <page_forget+0x7b>
+}
+  803609:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80360c:	c9                   	leave
+  80360d:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  80360e:	89 d8                	mov    %ebx,%eax
+  803610:	c1 e8 0c             	shr    $0xc,%eax
+  803613:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80361a:	89 c2                	mov    %eax,%edx
+  80361c:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803622:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803628:	75 bc                	jne    8035e6 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  80362a:	c1 e8 0c             	shr    $0xc,%eax
+  80362d:	e8 5c ee ff ff       	call   80248e <page_remove_slot>
+		return;
+  803632:	eb d5                	jmp    803609 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803634:	c1 e8 0c             	shr    $0xc,%eax
+  803637:	e8 52 ee ff ff       	call   80248e <page_remove_slot>
+	*mte = 0;
+  80363c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803642:	eb c5                	jmp    803609 <page_forget+0x50>
+
+00803644 <page_unmap>:
+{
+  803644:	55                   	push   %ebp
+  803645:	89 e5                	mov    %esp,%ebp
+  803647:	57                   	push   %edi
+  803648:	56                   	push   %esi
+  803649:	53                   	push   %ebx
+  80364a:	83 ec 0c             	sub    $0xc,%esp
+  80364d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803650:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803653:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803658:	8b 40 48             	mov    0x48(%eax),%eax
+  80365b:	85 db                	test   %ebx,%ebx
+  80365d:	0f 8e b4 00 00 00    	jle    803717 <page_unmap+0xd3>
+  803663:	39 d8                	cmp    %ebx,%eax
+  803665:	0f 84 ac 00 00 00    	je     803717 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  80366b:	83 ec 08             	sub    $0x8,%esp
+  80366e:	57                   	push   %edi
+  80366f:	53                   	push   %ebx
+  803670:	e8 b1 d6 ff ff       	call   800d26 <sys_page_unmap>
+  803675:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803677:	e8 95 ee ff ff       	call   802511 <find_paging_env>
+	if (pagingenv == 0)
+  80367c:	83 c4 10             	add    $0x10,%esp
+  80367f:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803686:	0f 84 a1 00 00 00    	je     80372d <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80368c:	83 ec 0c             	sub    $0xc,%esp
+  80368f:	6a 05                	push   $0x5
+  803691:	68 00 00 40 00       	push   $0x400000
+  803696:	6a 00                	push   $0x0
+  803698:	68 00 b0 ad de       	push   $0xdeadb000
+  80369d:	53                   	push   %ebx
+  80369e:	e8 41 d6 ff ff       	call   800ce4 <sys_page_map>
+  8036a3:	83 c4 20             	add    $0x20,%esp
+  8036a6:	85 c0                	test   %eax,%eax
+  8036a8:	0f 88 89 00 00 00    	js     803737 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  8036ae:	89 f8                	mov    %edi,%eax
+  8036b0:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8036b3:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  8036ba:	a8 01                	test   $0x1,%al
+  8036bc:	74 6f                	je     80372d <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8036be:	83 ec 0c             	sub    $0xc,%esp
+  8036c1:	6a 05                	push   $0x5
+  8036c3:	68 00 00 40 00       	push   $0x400000
+  8036c8:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8036ca:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8036cf:	50                   	push   %eax
+  8036d0:	53                   	push   %ebx
+  8036d1:	e8 0e d6 ff ff       	call   800ce4 <sys_page_map>
+  8036d6:	83 c4 20             	add    $0x20,%esp
+  8036d9:	85 c0                	test   %eax,%eax
+  8036db:	78 6f                	js     80374c <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  8036dd:	c1 ef 0c             	shr    $0xc,%edi
+  8036e0:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8036e6:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  8036ed:	01 
+  8036ee:	74 3d                	je     80372d <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  8036f0:	83 ec 08             	sub    $0x8,%esp
+  8036f3:	68 00 00 40 00       	push   $0x400000
+  8036f8:	6a 00                	push   $0x0
+  8036fa:	e8 27 d6 ff ff       	call   800d26 <sys_page_unmap>
+  8036ff:	83 c4 10             	add    $0x10,%esp
+  803702:	85 c0                	test   %eax,%eax
+  803704:	78 5b                	js     803761 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803706:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  80370d:	c1 e8 0c             	shr    $0xc,%eax
+  803710:	e8 79 ed ff ff       	call   80248e <page_remove_slot>
+	return r;
+  803715:	eb 16                	jmp    80372d <page_unmap+0xe9>
+		page_forget(va);
+  803717:	89 f8                	mov    %edi,%eax
+  803719:	e8 9b fe ff ff       	call   8035b9 <page_forget>
+		return sys_page_unmap(envid, va);
+  80371e:	83 ec 08             	sub    $0x8,%esp
+  803721:	57                   	push   %edi
+  803722:	53                   	push   %ebx
+  803723:	e8 fe d5 ff ff       	call   800d26 <sys_page_unmap>
+  803728:	89 c6                	mov    %eax,%esi
+  80372a:	83 c4 10             	add    $0x10,%esp
+}
+  80372d:	89 f0                	mov    %esi,%eax
+  80372f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803732:	5b                   	pop    %ebx
+  803733:	5e                   	pop    %esi
+  803734:	5f                   	pop    %edi
+  803735:	5d                   	pop    %ebp
+  803736:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803737:	50                   	push   %eax
+  803738:	68 d4 54 80 00       	push   $0x8054d4
+  80373d:	68 e4 03 00 00       	push   $0x3e4
+  803742:	68 8a 51 80 00       	push   $0x80518a
+  803747:	e8 a0 c9 ff ff       	call   8000ec <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  80374c:	50                   	push   %eax
+  80374d:	68 00 55 80 00       	push   $0x805500
+  803752:	68 ea 03 00 00       	push   $0x3ea
+  803757:	68 8a 51 80 00       	push   $0x80518a
+  80375c:	e8 8b c9 ff ff       	call   8000ec <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803761:	50                   	push   %eax
+  803762:	68 2c 55 80 00       	push   $0x80552c
+  803767:	68 ef 03 00 00       	push   $0x3ef
+  80376c:	68 8a 51 80 00       	push   $0x80518a
+  803771:	e8 76 c9 ff ff       	call   8000ec <_panic>
+
+00803776 <page_unmap_range>:
+{
+  803776:	55                   	push   %ebp
+  803777:	89 e5                	mov    %esp,%ebp
+  803779:	57                   	push   %edi
+  80377a:	56                   	push   %esi
+  80377b:	53                   	push   %ebx
+  80377c:	83 ec 0c             	sub    $0xc,%esp
+  80377f:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803782:	e8 8a ed ff ff       	call   802511 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803787:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80378c:	8b 40 48             	mov    0x48(%eax),%eax
+  80378f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803793:	7e 38                	jle    8037cd <page_unmap_range+0x57>
+  803795:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803798:	74 33                	je     8037cd <page_unmap_range+0x57>
+  80379a:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8037a1:	74 2a                	je     8037cd <page_unmap_range+0x57>
+  8037a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  8037a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8037ab:	39 fe                	cmp    %edi,%esi
+  8037ad:	74 56                	je     803805 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  8037af:	83 ec 08             	sub    $0x8,%esp
+  8037b2:	53                   	push   %ebx
+  8037b3:	ff 75 08             	push   0x8(%ebp)
+  8037b6:	e8 89 fe ff ff       	call   803644 <page_unmap>
+  8037bb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8037c1:	83 c4 10             	add    $0x10,%esp
+  8037c4:	85 c0                	test   %eax,%eax
+  8037c6:	78 35                	js     8037fd <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  8037c8:	83 c6 01             	add    $0x1,%esi
+  8037cb:	eb de                	jmp    8037ab <page_unmap_range+0x35>
+  8037cd:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  8037d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037d5:	eb 10                	jmp    8037e7 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  8037d7:	89 f0                	mov    %esi,%eax
+  8037d9:	e8 db fd ff ff       	call   8035b9 <page_forget>
+		for (i = 0; i < npages; i++)
+  8037de:	83 c3 01             	add    $0x1,%ebx
+  8037e1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8037e7:	39 fb                	cmp    %edi,%ebx
+  8037e9:	75 ec                	jne    8037d7 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  8037eb:	83 ec 04             	sub    $0x4,%esp
+  8037ee:	57                   	push   %edi
+  8037ef:	ff 75 0c             	push   0xc(%ebp)
+  8037f2:	ff 75 08             	push   0x8(%ebp)
+  8037f5:	e8 40 d6 ff ff       	call   800e3a <sys_page_unmap_range>
+  8037fa:	83 c4 10             	add    $0x10,%esp
+}
+  8037fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803800:	5b                   	pop    %ebx
+  803801:	5e                   	pop    %esi
+  803802:	5f                   	pop    %edi
+  803803:	5d                   	pop    %ebp
+  803804:	c3                   	ret
+	return 0;
+  803805:	b8 00 00 00 00       	mov    $0x0,%eax
+  80380a:	eb f1                	jmp    8037fd <page_unmap_range+0x87>
+
+0080380c <page_alloc_range>:
+{
+  80380c:	55                   	push   %ebp
+  80380d:	89 e5                	mov    %esp,%ebp
+  80380f:	57                   	push   %edi
+  803810:	56                   	push   %esi
+  803811:	53                   	push   %ebx
+  803812:	83 ec 1c             	sub    $0x1c,%esp
+  803815:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803818:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  80381b:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803822:	74 14                	je     803838 <page_alloc_range+0x2c>
+	if (check_mte)
+  803824:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803828:	74 66                	je     803890 <page_alloc_range+0x84>
+  80382a:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  80382c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803831:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803834:	89 c7                	mov    %eax,%edi
+  803836:	eb 10                	jmp    803848 <page_alloc_range+0x3c>
+		init_map_dir();
+  803838:	e8 e6 f8 ff ff       	call   803123 <init_map_dir>
+  80383d:	eb e5                	jmp    803824 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  80383f:	83 c7 01             	add    $0x1,%edi
+  803842:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803848:	39 df                	cmp    %ebx,%edi
+  80384a:	74 38                	je     803884 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  80384c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80384f:	83 ec 08             	sub    $0x8,%esp
+  803852:	6a 00                	push   $0x0
+  803854:	56                   	push   %esi
+  803855:	e8 1f f9 ff ff       	call   803179 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  80385a:	83 c4 10             	add    $0x10,%esp
+  80385d:	85 c0                	test   %eax,%eax
+  80385f:	74 de                	je     80383f <page_alloc_range+0x33>
+  803861:	8b 10                	mov    (%eax),%edx
+  803863:	f6 c2 01             	test   $0x1,%dl
+  803866:	74 d7                	je     80383f <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  803868:	83 ec 08             	sub    $0x8,%esp
+  80386b:	ff 75 e4             	push   -0x1c(%ebp)
+  80386e:	52                   	push   %edx
+  80386f:	50                   	push   %eax
+  803870:	68 98 54 80 00       	push   $0x805498
+  803875:	68 0b 04 00 00       	push   $0x40b
+  80387a:	68 8a 51 80 00       	push   $0x80518a
+  80387f:	e8 68 c8 ff ff       	call   8000ec <_panic>
+  803884:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803887:	eb 07                	jmp    803890 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  803889:	c1 e0 0c             	shl    $0xc,%eax
+  80388c:	01 c7                	add    %eax,%edi
+			npages -= r;
+  80388e:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  803890:	85 db                	test   %ebx,%ebx
+  803892:	74 30                	je     8038c4 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  803894:	ff 75 14             	push   0x14(%ebp)
+  803897:	53                   	push   %ebx
+  803898:	57                   	push   %edi
+  803899:	ff 75 08             	push   0x8(%ebp)
+  80389c:	e8 2b d5 ff ff       	call   800dcc <sys_page_alloc_range>
+  8038a1:	89 c6                	mov    %eax,%esi
+  8038a3:	83 c4 10             	add    $0x10,%esp
+  8038a6:	85 c0                	test   %eax,%eax
+  8038a8:	7f df                	jg     803889 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  8038aa:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8038ad:	75 1a                	jne    8038c9 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  8038af:	83 ec 08             	sub    $0x8,%esp
+  8038b2:	57                   	push   %edi
+  8038b3:	ff 75 08             	push   0x8(%ebp)
+  8038b6:	e8 68 f9 ff ff       	call   803223 <page_out>
+  8038bb:	83 c4 10             	add    $0x10,%esp
+  8038be:	85 c0                	test   %eax,%eax
+  8038c0:	79 ce                	jns    803890 <page_alloc_range+0x84>
+  8038c2:	eb 05                	jmp    8038c9 <page_alloc_range+0xbd>
+	return 0;
+  8038c4:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8038c9:	89 f0                	mov    %esi,%eax
+  8038cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038ce:	5b                   	pop    %ebx
+  8038cf:	5e                   	pop    %esi
+  8038d0:	5f                   	pop    %edi
+  8038d1:	5d                   	pop    %ebp
+  8038d2:	c3                   	ret
+
+008038d3 <page_in>:
+{
+  8038d3:	55                   	push   %ebp
+  8038d4:	89 e5                	mov    %esp,%ebp
+  8038d6:	57                   	push   %edi
+  8038d7:	56                   	push   %esi
+  8038d8:	53                   	push   %ebx
+  8038d9:	83 ec 3c             	sub    $0x3c,%esp
+  8038dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  8038df:	e8 2d ec ff ff       	call   802511 <find_paging_env>
+	if (pagingenv == 0)
+  8038e4:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8038eb:	0f 84 09 02 00 00    	je     803afa <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  8038f1:	83 ec 08             	sub    $0x8,%esp
+  8038f4:	6a 00                	push   $0x0
+  8038f6:	56                   	push   %esi
+  8038f7:	e8 7d f8 ff ff       	call   803179 <umapdir_walk>
+  8038fc:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8038fe:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803904:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  803907:	83 c4 10             	add    $0x10,%esp
+  80390a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80390e:	74 0d                	je     80391d <page_in+0x4a>
+  803910:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803915:	8b 40 48             	mov    0x48(%eax),%eax
+  803918:	3b 45 08             	cmp    0x8(%ebp),%eax
+  80391b:	75 06                	jne    803923 <page_in+0x50>
+  80391d:	8b 03                	mov    (%ebx),%eax
+  80391f:	a8 02                	test   $0x2,%al
+  803921:	75 63                	jne    803986 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  803923:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803925:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803927:	89 f0                	mov    %esi,%eax
+  803929:	25 06 0e 00 00       	and    $0xe06,%eax
+  80392e:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803931:	50                   	push   %eax
+  803932:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803935:	57                   	push   %edi
+  803936:	ff 75 08             	push   0x8(%ebp)
+  803939:	e8 65 fb ff ff       	call   8034a3 <page_alloc>
+  80393e:	83 c4 10             	add    $0x10,%esp
+  803941:	85 c0                	test   %eax,%eax
+  803943:	78 39                	js     80397e <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  803945:	89 f0                	mov    %esi,%eax
+  803947:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  80394a:	83 ec 0c             	sub    $0xc,%esp
+  80394d:	6a 07                	push   $0x7
+  80394f:	6a 01                	push   $0x1
+  803951:	57                   	push   %edi
+  803952:	c1 e0 04             	shl    $0x4,%eax
+  803955:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803956:	c1 ee 1c             	shr    $0x1c,%esi
+  803959:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  80395c:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803963:	e8 f1 0f 00 00       	call   804959 <ipc_call>
+  803968:	83 c4 20             	add    $0x20,%esp
+  80396b:	85 c0                	test   %eax,%eax
+  80396d:	0f 88 72 01 00 00    	js     803ae5 <page_in+0x212>
+	*mte = 0;
+  803973:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  803979:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80397e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803981:	5b                   	pop    %ebx
+  803982:	5e                   	pop    %esi
+  803983:	5f                   	pop    %edi
+  803984:	5d                   	pop    %ebp
+  803985:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803986:	25 06 0e 00 00       	and    $0xe06,%eax
+  80398b:	83 c8 01             	or     $0x1,%eax
+  80398e:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  803991:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803994:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  803997:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  80399d:	be 01 00 00 00       	mov    $0x1,%esi
+  8039a2:	eb 46                	jmp    8039ea <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  8039a4:	83 ec 08             	sub    $0x8,%esp
+  8039a7:	6a 00                	push   $0x0
+  8039a9:	51                   	push   %ecx
+  8039aa:	e8 ca f7 ff ff       	call   803179 <umapdir_walk>
+  8039af:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  8039b3:	83 c4 10             	add    $0x10,%esp
+  8039b6:	85 c0                	test   %eax,%eax
+  8039b8:	74 66                	je     803a20 <page_in+0x14d>
+  8039ba:	8b 00                	mov    (%eax),%eax
+  8039bc:	a8 01                	test   $0x1,%al
+  8039be:	74 60                	je     803a20 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  8039c0:	89 c2                	mov    %eax,%edx
+  8039c2:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  8039c8:	83 ca 01             	or     $0x1,%edx
+  8039cb:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  8039ce:	75 50                	jne    803a20 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  8039d0:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8039d6:	c1 e8 1c             	shr    $0x1c,%eax
+  8039d9:	8b 13                	mov    (%ebx),%edx
+  8039db:	c1 ea 1c             	shr    $0x1c,%edx
+  8039de:	39 d0                	cmp    %edx,%eax
+  8039e0:	75 3e                	jne    803a20 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  8039e2:	83 c6 01             	add    $0x1,%esi
+  8039e5:	83 fe 08             	cmp    $0x8,%esi
+  8039e8:	74 3f                	je     803a29 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  8039ea:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8039ec:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  8039f2:	77 2c                	ja     803a20 <page_in+0x14d>
+  8039f4:	89 f8                	mov    %edi,%eax
+  8039f6:	c1 e8 16             	shr    $0x16,%eax
+  8039f9:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803a00:	f6 c2 01             	test   $0x1,%dl
+  803a03:	74 9f                	je     8039a4 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803a05:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803a0c:	a8 80                	test   $0x80,%al
+  803a0e:	75 10                	jne    803a20 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803a10:	89 f8                	mov    %edi,%eax
+  803a12:	c1 e8 0c             	shr    $0xc,%eax
+  803a15:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803a1c:	a8 01                	test   $0x1,%al
+  803a1e:	74 84                	je     8039a4 <page_in+0xd1>
+	if (n == 1)
+  803a20:	83 fe 01             	cmp    $0x1,%esi
+  803a23:	0f 84 fa fe ff ff    	je     803923 <page_in+0x50>
+	req.nslots = n;
+  803a29:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  803a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a34:	eb 13                	jmp    803a49 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  803a36:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  803a3a:	8b 12                	mov    (%edx),%edx
+  803a3c:	c1 ea 0c             	shr    $0xc,%edx
+  803a3f:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  803a46:	83 c0 01             	add    $0x1,%eax
+  803a49:	39 c6                	cmp    %eax,%esi
+  803a4b:	75 e9                	jne    803a36 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  803a4d:	83 ec 0c             	sub    $0xc,%esp
+  803a50:	6a 00                	push   $0x0
+  803a52:	ff 75 c0             	push   -0x40(%ebp)
+  803a55:	56                   	push   %esi
+  803a56:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803a59:	57                   	push   %edi
+  803a5a:	6a 00                	push   $0x0
+  803a5c:	e8 ab fd ff ff       	call   80380c <page_alloc_range>
+  803a61:	83 c4 20             	add    $0x20,%esp
+  803a64:	85 c0                	test   %eax,%eax
+  803a66:	78 6e                	js     803ad6 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  803a68:	83 ec 04             	sub    $0x4,%esp
+  803a6b:	6a 24                	push   $0x24
+  803a6d:	68 00 80 80 00       	push   $0x808000
+  803a72:	57                   	push   %edi
+  803a73:	e8 bc ce ff ff       	call   800934 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803a78:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803a7f:	56                   	push   %esi
+  803a80:	57                   	push   %edi
+  803a81:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803a83:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  803a8a:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803a8d:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  803a94:	e8 c0 0e 00 00       	call   804959 <ipc_call>
+  803a99:	83 c4 20             	add    $0x20,%esp
+  803a9c:	85 c0                	test   %eax,%eax
+  803a9e:	78 08                	js     803aa8 <page_in+0x1d5>
+  803aa0:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  803aa3:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  803aa6:	eb 20                	jmp    803ac8 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  803aa8:	50                   	push   %eax
+  803aa9:	68 58 55 80 00       	push   $0x805558
+  803aae:	68 59 02 00 00       	push   $0x259
+  803ab3:	68 8a 51 80 00       	push   $0x80518a
+  803ab8:	e8 2f c6 ff ff       	call   8000ec <_panic>
+		*mtes[i] = 0;
+  803abd:	8b 10                	mov    (%eax),%edx
+  803abf:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  803ac5:	83 c0 04             	add    $0x4,%eax
+  803ac8:	39 c8                	cmp    %ecx,%eax
+  803aca:	75 f1                	jne    803abd <page_in+0x1ea>
+	return n;
+  803acc:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  803ace:	85 f6                	test   %esi,%esi
+  803ad0:	0f 84 4d fe ff ff    	je     803923 <page_in+0x50>
+		return r < 0 ? r : 0;
+  803ad6:	85 c0                	test   %eax,%eax
+  803ad8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803add:	0f 4f c2             	cmovg  %edx,%eax
+  803ae0:	e9 99 fe ff ff       	jmp    80397e <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  803ae5:	50                   	push   %eax
+  803ae6:	68 90 55 80 00       	push   $0x805590
+  803aeb:	68 9a 02 00 00       	push   $0x29a
+  803af0:	68 8a 51 80 00       	push   $0x80518a
+  803af5:	e8 f2 c5 ff ff       	call   8000ec <_panic>
+		return -E_PAGING;
+  803afa:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803aff:	e9 7a fe ff ff       	jmp    80397e <page_in+0xab>
+
+00803b04 <page_map>:
+{
+  803b04:	55                   	push   %ebp
+  803b05:	89 e5                	mov    %esp,%ebp
+  803b07:	57                   	push   %edi
+  803b08:	56                   	push   %esi
+  803b09:	53                   	push   %ebx
+  803b0a:	83 ec 1c             	sub    $0x1c,%esp
+  803b0d:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803b10:	83 ec 0c             	sub    $0xc,%esp
+  803b13:	ff 75 18             	push   0x18(%ebp)
+  803b16:	ff 75 14             	push   0x14(%ebp)
+  803b19:	ff 75 10             	push   0x10(%ebp)
+  803b1c:	ff 75 0c             	push   0xc(%ebp)
+  803b1f:	56                   	push   %esi
+  803b20:	e8 bf d1 ff ff       	call   800ce4 <sys_page_map>
+  803b25:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803b28:	83 c4 20             	add    $0x20,%esp
+  803b2b:	85 c0                	test   %eax,%eax
+  803b2d:	0f 89 a9 01 00 00    	jns    803cdc <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  803b33:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  803b37:	74 5f                	je     803b98 <page_map+0x94>
+		if (r != -E_INVAL)
+  803b39:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  803b3d:	0f 85 a0 01 00 00    	jne    803ce3 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803b43:	85 f6                	test   %esi,%esi
+  803b45:	74 70                	je     803bb7 <page_map+0xb3>
+  803b47:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803b4c:	8b 40 48             	mov    0x48(%eax),%eax
+  803b4f:	39 f0                	cmp    %esi,%eax
+  803b51:	74 64                	je     803bb7 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803b53:	83 ec 0c             	sub    $0xc,%esp
+  803b56:	6a 05                	push   $0x5
+  803b58:	68 00 00 40 00       	push   $0x400000
+  803b5d:	6a 00                	push   $0x0
+  803b5f:	68 00 b0 ad de       	push   $0xdeadb000
+  803b64:	56                   	push   %esi
+  803b65:	e8 7a d1 ff ff       	call   800ce4 <sys_page_map>
+  803b6a:	89 c3                	mov    %eax,%ebx
+  803b6c:	83 c4 20             	add    $0x20,%esp
+  803b6f:	85 c0                	test   %eax,%eax
+  803b71:	79 6a                	jns    803bdd <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  803b73:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803b76:	75 50                	jne    803bc8 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  803b78:	83 ec 08             	sub    $0x8,%esp
+  803b7b:	68 00 00 40 00       	push   $0x400000
+  803b80:	6a fc                	push   $0xfffffffc
+  803b82:	e8 9c f6 ff ff       	call   803223 <page_out>
+  803b87:	83 c4 10             	add    $0x10,%esp
+  803b8a:	85 c0                	test   %eax,%eax
+  803b8c:	79 c5                	jns    803b53 <page_map+0x4f>
+}
+  803b8e:	89 d8                	mov    %ebx,%eax
+  803b90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b93:	5b                   	pop    %ebx
+  803b94:	5e                   	pop    %esi
+  803b95:	5f                   	pop    %edi
+  803b96:	5d                   	pop    %ebp
+  803b97:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  803b98:	83 ec 08             	sub    $0x8,%esp
+  803b9b:	68 00 00 40 00       	push   $0x400000
+  803ba0:	6a 00                	push   $0x0
+  803ba2:	e8 7c f6 ff ff       	call   803223 <page_out>
+  803ba7:	83 c4 10             	add    $0x10,%esp
+  803baa:	85 c0                	test   %eax,%eax
+  803bac:	0f 89 5e ff ff ff    	jns    803b10 <page_map+0xc>
+				return r;
+  803bb2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803bb5:	eb d7                	jmp    803b8e <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803bb7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803bba:	e8 79 f9 ff ff       	call   803538 <page_adopt>
+  803bbf:	85 c0                	test   %eax,%eax
+  803bc1:	79 90                	jns    803b53 <page_map+0x4f>
+			return r;
+  803bc3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803bc6:	eb c6                	jmp    803b8e <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  803bc8:	53                   	push   %ebx
+  803bc9:	68 c4 55 80 00       	push   $0x8055c4
+  803bce:	68 77 03 00 00       	push   $0x377
+  803bd3:	68 8a 51 80 00       	push   $0x80518a
+  803bd8:	e8 0f c5 ff ff       	call   8000ec <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  803bdd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803be0:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803be3:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  803bea:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  803bf0:	0f 84 f5 00 00 00    	je     803ceb <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803bf6:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803bfc:	83 ec 0c             	sub    $0xc,%esp
+  803bff:	6a 05                	push   $0x5
+  803c01:	68 00 00 40 00       	push   $0x400000
+  803c06:	6a 00                	push   $0x0
+  803c08:	57                   	push   %edi
+  803c09:	56                   	push   %esi
+  803c0a:	e8 d5 d0 ff ff       	call   800ce4 <sys_page_map>
+  803c0f:	89 c3                	mov    %eax,%ebx
+  803c11:	83 c4 20             	add    $0x20,%esp
+  803c14:	85 c0                	test   %eax,%eax
+  803c16:	79 35                	jns    803c4d <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  803c18:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803c1b:	75 1b                	jne    803c38 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803c1d:	83 ec 08             	sub    $0x8,%esp
+  803c20:	68 00 00 40 00       	push   $0x400000
+  803c25:	6a 00                	push   $0x0
+  803c27:	e8 f7 f5 ff ff       	call   803223 <page_out>
+  803c2c:	83 c4 10             	add    $0x10,%esp
+  803c2f:	85 c0                	test   %eax,%eax
+  803c31:	79 c9                	jns    803bfc <page_map+0xf8>
+  803c33:	e9 56 ff ff ff       	jmp    803b8e <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  803c38:	53                   	push   %ebx
+  803c39:	68 ec 55 80 00       	push   $0x8055ec
+  803c3e:	68 83 03 00 00       	push   $0x383
+  803c43:	68 8a 51 80 00       	push   $0x80518a
+  803c48:	e8 9f c4 ff ff       	call   8000ec <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  803c4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803c50:	c1 e8 0c             	shr    $0xc,%eax
+  803c53:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803c58:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  803c5f:	01 
+  803c60:	0f 84 8d 00 00 00    	je     803cf3 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803c66:	83 ec 08             	sub    $0x8,%esp
+  803c69:	68 00 00 40 00       	push   $0x400000
+  803c6e:	6a 00                	push   $0x0
+  803c70:	e8 b1 d0 ff ff       	call   800d26 <sys_page_unmap>
+  803c75:	83 c4 10             	add    $0x10,%esp
+  803c78:	85 c0                	test   %eax,%eax
+  803c7a:	78 36                	js     803cb2 <page_map+0x1ae>
+  803c7c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  803c7f:	83 ec 08             	sub    $0x8,%esp
+  803c82:	57                   	push   %edi
+  803c83:	56                   	push   %esi
+  803c84:	e8 4a fc ff ff       	call   8038d3 <page_in>
+  803c89:	89 c3                	mov    %eax,%ebx
+  803c8b:	83 c4 10             	add    $0x10,%esp
+  803c8e:	85 c0                	test   %eax,%eax
+  803c90:	0f 89 7a fe ff ff    	jns    803b10 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  803c96:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803c99:	75 2c                	jne    803cc7 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  803c9b:	83 ec 08             	sub    $0x8,%esp
+  803c9e:	57                   	push   %edi
+  803c9f:	6a 00                	push   $0x0
+  803ca1:	e8 7d f5 ff ff       	call   803223 <page_out>
+  803ca6:	83 c4 10             	add    $0x10,%esp
+  803ca9:	85 c0                	test   %eax,%eax
+  803cab:	79 d2                	jns    803c7f <page_map+0x17b>
+  803cad:	e9 dc fe ff ff       	jmp    803b8e <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  803cb2:	50                   	push   %eax
+  803cb3:	68 18 56 80 00       	push   $0x805618
+  803cb8:	68 8b 03 00 00       	push   $0x38b
+  803cbd:	68 8a 51 80 00       	push   $0x80518a
+  803cc2:	e8 25 c4 ff ff       	call   8000ec <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  803cc7:	53                   	push   %ebx
+  803cc8:	68 40 56 80 00       	push   $0x805640
+  803ccd:	68 91 03 00 00       	push   $0x391
+  803cd2:	68 8a 51 80 00       	push   $0x80518a
+  803cd7:	e8 10 c4 ff ff       	call   8000ec <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803cdc:	89 c3                	mov    %eax,%ebx
+  803cde:	e9 ab fe ff ff       	jmp    803b8e <page_map+0x8a>
+  803ce3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803ce6:	e9 a3 fe ff ff       	jmp    803b8e <page_map+0x8a>
+			return r; // Pass through the error
+  803ceb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803cee:	e9 9b fe ff ff       	jmp    803b8e <page_map+0x8a>
+			return r; // Pass through the error
+  803cf3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803cf6:	e9 93 fe ff ff       	jmp    803b8e <page_map+0x8a>
+
+00803cfb <page_map_range>:
+{
+  803cfb:	55                   	push   %ebp
+  803cfc:	89 e5                	mov    %esp,%ebp
+  803cfe:	57                   	push   %edi
+  803cff:	56                   	push   %esi
+  803d00:	53                   	push   %ebx
+  803d01:	83 ec 0c             	sub    $0xc,%esp
+  803d04:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803d07:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  803d0a:	83 ec 08             	sub    $0x8,%esp
+  803d0d:	ff 75 1c             	push   0x1c(%ebp)
+  803d10:	ff 75 18             	push   0x18(%ebp)
+  803d13:	56                   	push   %esi
+  803d14:	ff 75 10             	push   0x10(%ebp)
+  803d17:	57                   	push   %edi
+  803d18:	ff 75 08             	push   0x8(%ebp)
+  803d1b:	e8 cf d0 ff ff       	call   800def <sys_page_map_range>
+  803d20:	89 c3                	mov    %eax,%ebx
+  803d22:	83 c4 20             	add    $0x20,%esp
+  803d25:	85 c0                	test   %eax,%eax
+  803d27:	79 1b                	jns    803d44 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  803d29:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803d2c:	75 20                	jne    803d4e <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803d2e:	83 ec 08             	sub    $0x8,%esp
+  803d31:	68 00 00 40 00       	push   $0x400000
+  803d36:	6a 00                	push   $0x0
+  803d38:	e8 e6 f4 ff ff       	call   803223 <page_out>
+  803d3d:	83 c4 10             	add    $0x10,%esp
+  803d40:	85 c0                	test   %eax,%eax
+  803d42:	79 c6                	jns    803d0a <page_map_range+0xf>
+}
+  803d44:	89 d8                	mov    %ebx,%eax
+  803d46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d49:	5b                   	pop    %ebx
+  803d4a:	5e                   	pop    %esi
+  803d4b:	5f                   	pop    %edi
+  803d4c:	5d                   	pop    %ebp
+  803d4d:	c3                   	ret
+		if (r != -E_INVAL)
+  803d4e:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  803d51:	75 f1                	jne    803d44 <page_map_range+0x49>
+  803d53:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  803d55:	be 00 00 00 00       	mov    $0x0,%esi
+  803d5a:	eb 03                	jmp    803d5f <page_map_range+0x64>
+  803d5c:	83 c6 01             	add    $0x1,%esi
+  803d5f:	3b 75 18             	cmp    0x18(%ebp),%esi
+  803d62:	74 2a                	je     803d8e <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  803d64:	83 ec 0c             	sub    $0xc,%esp
+  803d67:	ff 75 1c             	push   0x1c(%ebp)
+  803d6a:	53                   	push   %ebx
+  803d6b:	ff 75 10             	push   0x10(%ebp)
+  803d6e:	57                   	push   %edi
+  803d6f:	ff 75 08             	push   0x8(%ebp)
+  803d72:	e8 8d fd ff ff       	call   803b04 <page_map>
+  803d77:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803d7d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803d83:	83 c4 20             	add    $0x20,%esp
+  803d86:	85 c0                	test   %eax,%eax
+  803d88:	79 d2                	jns    803d5c <page_map_range+0x61>
+  803d8a:	89 c3                	mov    %eax,%ebx
+  803d8c:	eb b6                	jmp    803d44 <page_map_range+0x49>
+		return 0;
+  803d8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d93:	eb af                	jmp    803d44 <page_map_range+0x49>
+
+00803d95 <paging_pgfault_handler>:
+{
+  803d95:	55                   	push   %ebp
+  803d96:	89 e5                	mov    %esp,%ebp
+  803d98:	56                   	push   %esi
+  803d99:	53                   	push   %ebx
+  803d9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  803d9d:	e8 6f e7 ff ff       	call   802511 <find_paging_env>
+	if (pagingenv == 0)
+  803da2:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803da7:	85 c0                	test   %eax,%eax
+  803da9:	74 3c                	je     803de7 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  803dab:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803dad:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803db1:	75 12                	jne    803dc5 <paging_pgfault_handler+0x30>
+  803db3:	89 f0                	mov    %esi,%eax
+  803db5:	e8 7e f7 ff ff       	call   803538 <page_adopt>
+  803dba:	89 c2                	mov    %eax,%edx
+		return 0;
+  803dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803dc1:	85 d2                	test   %edx,%edx
+  803dc3:	78 22                	js     803de7 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  803dc5:	83 ec 08             	sub    $0x8,%esp
+  803dc8:	6a 00                	push   $0x0
+  803dca:	56                   	push   %esi
+  803dcb:	e8 a9 f3 ff ff       	call   803179 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  803dd0:	83 c4 10             	add    $0x10,%esp
+  803dd3:	85 c0                	test   %eax,%eax
+  803dd5:	74 05                	je     803ddc <paging_pgfault_handler+0x47>
+  803dd7:	f6 00 01             	testb  $0x1,(%eax)
+  803dda:	75 12                	jne    803dee <paging_pgfault_handler+0x59>
+	return 0;
+  803ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803de1:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803de5:	74 23                	je     803e0a <paging_pgfault_handler+0x75>
+}
+  803de7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803dea:	5b                   	pop    %ebx
+  803deb:	5e                   	pop    %esi
+  803dec:	5d                   	pop    %ebp
+  803ded:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  803dee:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803df3:	8b 40 48             	mov    0x48(%eax),%eax
+  803df6:	83 ec 08             	sub    $0x8,%esp
+  803df9:	56                   	push   %esi
+  803dfa:	50                   	push   %eax
+  803dfb:	e8 d3 fa ff ff       	call   8038d3 <page_in>
+  803e00:	f7 d0                	not    %eax
+  803e02:	c1 e8 1f             	shr    $0x1f,%eax
+  803e05:	83 c4 10             	add    $0x10,%esp
+  803e08:	eb dd                	jmp    803de7 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803e0a:	89 f0                	mov    %esi,%eax
+  803e0c:	e8 97 e2 ff ff       	call   8020a8 <segment_lookup>
+  803e11:	89 c2                	mov    %eax,%edx
+	return 0;
+  803e13:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803e18:	85 d2                	test   %edx,%edx
+  803e1a:	74 cb                	je     803de7 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  803e1c:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803e21:	8b 40 48             	mov    0x48(%eax),%eax
+  803e24:	83 ec 08             	sub    $0x8,%esp
+  803e27:	56                   	push   %esi
+  803e28:	50                   	push   %eax
+  803e29:	e8 f5 f3 ff ff       	call   803223 <page_out>
+  803e2e:	f7 d0                	not    %eax
+  803e30:	c1 e8 1f             	shr    $0x1f,%eax
+  803e33:	83 c4 10             	add    $0x10,%esp
+  803e36:	eb af                	jmp    803de7 <paging_pgfault_handler+0x52>
+
+00803e38 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  803e38:	55                   	push   %ebp
+  803e39:	89 e5                	mov    %esp,%ebp
+  803e3b:	57                   	push   %edi
+  803e3c:	56                   	push   %esi
+  803e3d:	53                   	push   %ebx
+  803e3e:	83 ec 2c             	sub    $0x2c,%esp
+  803e41:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  803e44:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  803e49:	89 c1                	mov    %eax,%ecx
+  803e4b:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  803e4e:	c1 e8 11             	shr    $0x11,%eax
+  803e51:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803e54:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  803e5b:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  803e5e:	b8 01 00 00 00       	mov    $0x1,%eax
+  803e63:	d3 e0                	shl    %cl,%eax
+  803e65:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803e68:	85 c7                	test   %eax,%edi
+  803e6a:	74 12                	je     803e7e <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803e6c:	bb 01 00 00 00       	mov    $0x1,%ebx
+  803e71:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  803e74:	bf 01 00 00 00       	mov    $0x1,%edi
+  803e79:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803e7c:	eb 17                	jmp    803e95 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  803e7e:	ff 75 e0             	push   -0x20(%ebp)
+  803e81:	68 78 56 80 00       	push   $0x805678
+  803e86:	6a 48                	push   $0x48
+  803e88:	68 92 56 80 00       	push   $0x805692
+  803e8d:	e8 5a c2 ff ff       	call   8000ec <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803e92:	83 c3 01             	add    $0x1,%ebx
+  803e95:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803e98:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  803e9b:	89 c8                	mov    %ecx,%eax
+  803e9d:	c1 e8 05             	shr    $0x5,%eax
+  803ea0:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  803ea7:	89 fe                	mov    %edi,%esi
+  803ea9:	d3 e6                	shl    %cl,%esi
+  803eab:	89 f1                	mov    %esi,%ecx
+  803ead:	85 d6                	test   %edx,%esi
+  803eaf:	74 e1                	je     803e92 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  803eb1:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  803eb4:	f7 d6                	not    %esi
+  803eb6:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  803eb9:	21 fe                	and    %edi,%esi
+  803ebb:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803ebe:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  803ec5:	f7 d1                	not    %ecx
+  803ec7:	21 d1                	and    %edx,%ecx
+  803ec9:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  803ed0:	83 ec 04             	sub    $0x4,%esp
+  803ed3:	53                   	push   %ebx
+  803ed4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803ed7:	57                   	push   %edi
+  803ed8:	6a 00                	push   $0x0
+  803eda:	e8 97 f8 ff ff       	call   803776 <page_unmap_range>
+	va_free(va, n);
+  803edf:	83 c4 08             	add    $0x8,%esp
+  803ee2:	53                   	push   %ebx
+  803ee3:	57                   	push   %edi
+  803ee4:	e8 ed 05 00 00       	call   8044d6 <va_free>
+}
+  803ee9:	83 c4 10             	add    $0x10,%esp
+  803eec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803eef:	5b                   	pop    %ebx
+  803ef0:	5e                   	pop    %esi
+  803ef1:	5f                   	pop    %edi
+  803ef2:	5d                   	pop    %ebp
+  803ef3:	c3                   	ret
+
+00803ef4 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  803ef4:	55                   	push   %ebp
+  803ef5:	89 e5                	mov    %esp,%ebp
+  803ef7:	57                   	push   %edi
+  803ef8:	56                   	push   %esi
+  803ef9:	53                   	push   %ebx
+  803efa:	83 ec 1c             	sub    $0x1c,%esp
+  803efd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  803f00:	85 db                	test   %ebx,%ebx
+  803f02:	74 34                	je     803f38 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  803f04:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803f0a:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  803f0f:	77 2f                	ja     803f40 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  803f11:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  803f17:	75 51                	jne    803f6a <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  803f19:	89 c1                	mov    %eax,%ecx
+  803f1b:	c1 e9 0c             	shr    $0xc,%ecx
+  803f1e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803f23:	d3 e2                	shl    %cl,%edx
+  803f25:	c1 e8 11             	shr    $0x11,%eax
+  803f28:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  803f2f:	75 24                	jne    803f55 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  803f31:	89 d8                	mov    %ebx,%eax
+  803f33:	e8 00 ff ff ff       	call   803e38 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  803f38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f3b:	5b                   	pop    %ebx
+  803f3c:	5e                   	pop    %esi
+  803f3d:	5f                   	pop    %edi
+  803f3e:	5d                   	pop    %ebp
+  803f3f:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  803f40:	53                   	push   %ebx
+  803f41:	68 9f 56 80 00       	push   $0x80569f
+  803f46:	68 a2 00 00 00       	push   $0xa2
+  803f4b:	68 92 56 80 00       	push   $0x805692
+  803f50:	e8 97 c1 ff ff       	call   8000ec <_panic>
+			panic("free: %p is not allocated", va);
+  803f55:	53                   	push   %ebx
+  803f56:	68 78 56 80 00       	push   $0x805678
+  803f5b:	68 a5 00 00 00       	push   $0xa5
+  803f60:	68 92 56 80 00       	push   $0x805692
+  803f65:	e8 82 c1 ff ff       	call   8000ec <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  803f6a:	89 de                	mov    %ebx,%esi
+  803f6c:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  803f72:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  803f78:	89 c8                	mov    %ecx,%eax
+  803f7a:	c1 e8 11             	shr    $0x11,%eax
+  803f7d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803f80:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  803f87:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  803f8a:	c1 e9 0c             	shr    $0xc,%ecx
+  803f8d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f92:	d3 e0                	shl    %cl,%eax
+  803f94:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803f97:	85 c7                	test   %eax,%edi
+  803f99:	74 1b                	je     803fb6 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  803f9b:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  803f9f:	89 d8                	mov    %ebx,%eax
+  803fa1:	29 f0                	sub    %esi,%eax
+  803fa3:	83 e8 10             	sub    $0x10,%eax
+  803fa6:	99                   	cltd
+  803fa7:	f7 ff                	idiv   %edi
+  803fa9:	89 d1                	mov    %edx,%ecx
+  803fab:	85 d2                	test   %edx,%edx
+  803fad:	75 07                	jne    803fb6 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  803faf:	ba 10 00 00 00       	mov    $0x10,%edx
+  803fb4:	eb 18                	jmp    803fce <free+0xda>
+		panic("free: %p is not allocated", va);
+  803fb6:	53                   	push   %ebx
+  803fb7:	68 78 56 80 00       	push   $0x805678
+  803fbc:	68 ad 00 00 00       	push   $0xad
+  803fc1:	68 92 56 80 00       	push   $0x805692
+  803fc6:	e8 21 c1 ff ff       	call   8000ec <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  803fcb:	83 c1 01             	add    $0x1,%ecx
+  803fce:	89 d0                	mov    %edx,%eax
+  803fd0:	d3 e0                	shl    %cl,%eax
+  803fd2:	39 c7                	cmp    %eax,%edi
+  803fd4:	7f f5                	jg     803fcb <free+0xd7>
+	*(void **) va = s->free;
+  803fd6:	8b 46 08             	mov    0x8(%esi),%eax
+  803fd9:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  803fdb:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  803fde:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  803fe2:	8d 58 01             	lea    0x1(%eax),%ebx
+  803fe5:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  803fe9:	66 85 c0             	test   %ax,%ax
+  803fec:	74 52                	je     804040 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  803fee:	0f b7 db             	movzwl %bx,%ebx
+  803ff1:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  803ff5:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  803ffa:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fff:	f7 ff                	idiv   %edi
+  804001:	39 c3                	cmp    %eax,%ebx
+  804003:	0f 85 2f ff ff ff    	jne    803f38 <free+0x44>
+  804009:	8b 46 04             	mov    0x4(%esi),%eax
+  80400c:	85 c0                	test   %eax,%eax
+  80400e:	74 53                	je     804063 <free+0x16f>
+		s->prev->next = s->next;
+  804010:	8b 16                	mov    (%esi),%edx
+  804012:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804014:	8b 06                	mov    (%esi),%eax
+  804016:	85 c0                	test   %eax,%eax
+  804018:	74 06                	je     804020 <free+0x12c>
+		s->next->prev = s->prev;
+  80401a:	8b 56 04             	mov    0x4(%esi),%edx
+  80401d:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804020:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804023:	f7 d0                	not    %eax
+  804025:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804028:	21 d0                	and    %edx,%eax
+  80402a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80402d:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  804034:	89 f0                	mov    %esi,%eax
+  804036:	e8 fd fd ff ff       	call   803e38 <heap_free_pages>
+  80403b:	e9 f8 fe ff ff       	jmp    803f38 <free+0x44>
+	s->prev = NULL;
+  804040:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  804047:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  80404e:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  804050:	85 c0                	test   %eax,%eax
+  804052:	74 03                	je     804057 <free+0x163>
+		slabs[c]->prev = s;
+  804054:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  804057:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  80405e:	e9 d5 fe ff ff       	jmp    803f38 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804063:	8b 06                	mov    (%esi),%eax
+  804065:	85 c0                	test   %eax,%eax
+  804067:	0f 84 cb fe ff ff    	je     803f38 <free+0x44>
+		slabs[c] = s->next;
+  80406d:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  804074:	8b 06                	mov    (%esi),%eax
+  804076:	eb a2                	jmp    80401a <free+0x126>
+
+00804078 <heap_alloc_pages>:
+{
+  804078:	55                   	push   %ebp
+  804079:	89 e5                	mov    %esp,%ebp
+  80407b:	57                   	push   %edi
+  80407c:	56                   	push   %esi
+  80407d:	53                   	push   %ebx
+  80407e:	83 ec 18             	sub    $0x18,%esp
+  804081:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  804083:	50                   	push   %eax
+  804084:	e8 15 03 00 00       	call   80439e <va_alloc>
+  804089:	89 c3                	mov    %eax,%ebx
+  80408b:	83 c4 10             	add    $0x10,%esp
+  80408e:	85 c0                	test   %eax,%eax
+  804090:	74 47                	je     8040d9 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804092:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804098:	89 c1                	mov    %eax,%ecx
+  80409a:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  80409d:	c1 e8 11             	shr    $0x11,%eax
+  8040a0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8040a5:	89 d7                	mov    %edx,%edi
+  8040a7:	d3 e7                	shl    %cl,%edi
+  8040a9:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  8040b0:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  8040b4:	89 c8                	mov    %ecx,%eax
+  8040b6:	c1 e8 05             	shr    $0x5,%eax
+  8040b9:	d3 e2                	shl    %cl,%edx
+  8040bb:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  8040c2:	83 ec 0c             	sub    $0xc,%esp
+  8040c5:	6a 00                	push   $0x0
+  8040c7:	6a 07                	push   $0x7
+  8040c9:	56                   	push   %esi
+  8040ca:	53                   	push   %ebx
+  8040cb:	6a 00                	push   $0x0
+  8040cd:	e8 3a f7 ff ff       	call   80380c <page_alloc_range>
+  8040d2:	83 c4 20             	add    $0x20,%esp
+  8040d5:	85 c0                	test   %eax,%eax
+  8040d7:	78 0a                	js     8040e3 <heap_alloc_pages+0x6b>
+}
+  8040d9:	89 d8                	mov    %ebx,%eax
+  8040db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040de:	5b                   	pop    %ebx
+  8040df:	5e                   	pop    %esi
+  8040e0:	5f                   	pop    %edi
+  8040e1:	5d                   	pop    %ebp
+  8040e2:	c3                   	ret
+		free(va);
+  8040e3:	83 ec 0c             	sub    $0xc,%esp
+  8040e6:	53                   	push   %ebx
+  8040e7:	e8 08 fe ff ff       	call   803ef4 <free>
+		return NULL;
+  8040ec:	83 c4 10             	add    $0x10,%esp
+  8040ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8040f4:	eb e3                	jmp    8040d9 <heap_alloc_pages+0x61>
+
+008040f6 <malloc>:
+{
+  8040f6:	55                   	push   %ebp
+  8040f7:	89 e5                	mov    %esp,%ebp
+  8040f9:	57                   	push   %edi
+  8040fa:	56                   	push   %esi
+  8040fb:	53                   	push   %ebx
+  8040fc:	83 ec 1c             	sub    $0x1c,%esp
+  8040ff:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804102:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804105:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  80410b:	0f 87 21 01 00 00    	ja     804232 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804111:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804116:	ba 10 00 00 00       	mov    $0x10,%edx
+  80411b:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  80411d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804122:	76 15                	jbe    804139 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804124:	05 ff 0f 00 00       	add    $0xfff,%eax
+  804129:	c1 e8 0c             	shr    $0xc,%eax
+  80412c:	e8 47 ff ff ff       	call   804078 <heap_alloc_pages>
+  804131:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804134:	eb 37                	jmp    80416d <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804136:	83 c1 01             	add    $0x1,%ecx
+  804139:	89 d6                	mov    %edx,%esi
+  80413b:	d3 e6                	shl    %cl,%esi
+  80413d:	39 c6                	cmp    %eax,%esi
+  80413f:	72 f5                	jb     804136 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804141:	89 cb                	mov    %ecx,%ebx
+  804143:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  80414a:	85 ff                	test   %edi,%edi
+  80414c:	74 2a                	je     804178 <malloc+0x82>
+	v = s->free;
+  80414e:	8b 47 08             	mov    0x8(%edi),%eax
+  804151:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  804154:	8b 00                	mov    (%eax),%eax
+  804156:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  804159:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  80415d:	83 e8 01             	sub    $0x1,%eax
+  804160:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  804164:	66 85 c0             	test   %ax,%ax
+  804167:	0f 84 9a 00 00 00    	je     804207 <malloc+0x111>
+}
+  80416d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804170:	83 c4 1c             	add    $0x1c,%esp
+  804173:	5b                   	pop    %ebx
+  804174:	5e                   	pop    %esi
+  804175:	5f                   	pop    %edi
+  804176:	5d                   	pop    %ebp
+  804177:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  804178:	b8 01 00 00 00       	mov    $0x1,%eax
+  80417d:	e8 f6 fe ff ff       	call   804078 <heap_alloc_pages>
+  804182:	89 c1                	mov    %eax,%ecx
+  804184:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804187:	85 c0                	test   %eax,%eax
+  804189:	74 e2                	je     80416d <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  80418b:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  804191:	89 c8                	mov    %ecx,%eax
+  804193:	c1 e8 11             	shr    $0x11,%eax
+  804196:	c1 e9 0c             	shr    $0xc,%ecx
+  804199:	ba 01 00 00 00       	mov    $0x1,%edx
+  80419e:	d3 e2                	shl    %cl,%edx
+  8041a0:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  8041a7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8041aa:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  8041ae:	0f b7 f6             	movzwl %si,%esi
+  8041b1:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8041b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041bb:	f7 fe                	idiv   %esi
+  8041bd:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  8041c1:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  8041c4:	85 c0                	test   %eax,%eax
+  8041c6:	74 14                	je     8041dc <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  8041c8:	83 e8 01             	sub    $0x1,%eax
+  8041cb:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  8041cf:	0f af d0             	imul   %eax,%edx
+  8041d2:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  8041d6:	89 3a                	mov    %edi,(%edx)
+  8041d8:	89 d7                	mov    %edx,%edi
+  8041da:	eb e5                	jmp    8041c1 <malloc+0xcb>
+	s->prev = NULL;
+  8041dc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8041df:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  8041e6:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  8041ed:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  8041ef:	85 c0                	test   %eax,%eax
+  8041f1:	74 03                	je     8041f6 <malloc+0x100>
+		slabs[c]->prev = s;
+  8041f3:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  8041f6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8041f9:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  804200:	89 c7                	mov    %eax,%edi
+  804202:	e9 47 ff ff ff       	jmp    80414e <malloc+0x58>
+	if (s->prev)
+  804207:	8b 47 04             	mov    0x4(%edi),%eax
+  80420a:	85 c0                	test   %eax,%eax
+  80420c:	74 19                	je     804227 <malloc+0x131>
+		s->prev->next = s->next;
+  80420e:	8b 17                	mov    (%edi),%edx
+  804210:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804212:	8b 07                	mov    (%edi),%eax
+  804214:	85 c0                	test   %eax,%eax
+  804216:	0f 84 51 ff ff ff    	je     80416d <malloc+0x77>
+		s->next->prev = s->prev;
+  80421c:	8b 57 04             	mov    0x4(%edi),%edx
+  80421f:	89 50 04             	mov    %edx,0x4(%eax)
+  804222:	e9 46 ff ff ff       	jmp    80416d <malloc+0x77>
+		slabs[c] = s->next;
+  804227:	8b 07                	mov    (%edi),%eax
+  804229:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  804230:	eb e0                	jmp    804212 <malloc+0x11c>
+		return NULL;
+  804232:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804239:	e9 2f ff ff ff       	jmp    80416d <malloc+0x77>
+
+0080423e <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  80423e:	55                   	push   %ebp
+  80423f:	89 e5                	mov    %esp,%ebp
+  804241:	57                   	push   %edi
+  804242:	56                   	push   %esi
+  804243:	53                   	push   %ebx
+  804244:	83 ec 0c             	sub    $0xc,%esp
+  804247:	89 c6                	mov    %eax,%esi
+  804249:	89 d7                	mov    %edx,%edi
+  80424b:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  80424e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804253:	ba 00 00 00 00       	mov    $0x0,%edx
+  804258:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  80425d:	83 ef 01             	sub    $0x1,%edi
+  804260:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804263:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  804266:	eb 34                	jmp    80429c <va_chunk_scan+0x5e>
+			i += 31;
+  804268:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  80426b:	89 ca                	mov    %ecx,%edx
+			continue;
+  80426d:	eb 23                	jmp    804292 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  80426f:	89 c7                	mov    %eax,%edi
+  804271:	c1 ef 05             	shr    $0x5,%edi
+  804274:	be 01 00 00 00       	mov    $0x1,%esi
+  804279:	d3 e6                	shl    %cl,%esi
+  80427b:	89 f1                	mov    %esi,%ecx
+  80427d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804280:	23 0c be             	and    (%esi,%edi,4),%ecx
+  804283:	75 41                	jne    8042c6 <va_chunk_scan+0x88>
+			len++;
+  804285:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804288:	39 d3                	cmp    %edx,%ebx
+  80428a:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  80428d:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  804290:	72 2d                	jb     8042bf <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804292:	83 c0 01             	add    $0x1,%eax
+  804295:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80429a:	77 31                	ja     8042cd <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  80429c:	89 c1                	mov    %eax,%ecx
+  80429e:	83 e1 1f             	and    $0x1f,%ecx
+  8042a1:	75 cc                	jne    80426f <va_chunk_scan+0x31>
+  8042a3:	89 c7                	mov    %eax,%edi
+  8042a5:	c1 ef 05             	shr    $0x5,%edi
+  8042a8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8042ab:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  8042ae:	83 ff ff             	cmp    $0xffffffff,%edi
+  8042b1:	74 b5                	je     804268 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  8042b3:	85 ff                	test   %edi,%edi
+  8042b5:	75 b8                	jne    80426f <va_chunk_scan+0x31>
+			i += 31;
+  8042b7:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  8042ba:	83 c2 20             	add    $0x20,%edx
+  8042bd:	eb c9                	jmp    804288 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  8042bf:	83 c0 01             	add    $0x1,%eax
+  8042c2:	29 d0                	sub    %edx,%eax
+  8042c4:	eb 15                	jmp    8042db <va_chunk_scan+0x9d>
+			len = 0;
+  8042c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042cb:	eb c5                	jmp    804292 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  8042cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  8042d2:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  8042d5:	85 d2                	test   %edx,%edx
+  8042d7:	74 02                	je     8042db <va_chunk_scan+0x9d>
+		*run_store = best;
+  8042d9:	89 1a                	mov    %ebx,(%edx)
+}
+  8042db:	83 c4 0c             	add    $0xc,%esp
+  8042de:	5b                   	pop    %ebx
+  8042df:	5e                   	pop    %esi
+  8042e0:	5f                   	pop    %edi
+  8042e1:	5d                   	pop    %ebp
+  8042e2:	c3                   	ret
+
+008042e3 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  8042e3:	55                   	push   %ebp
+  8042e4:	89 e5                	mov    %esp,%ebp
+  8042e6:	57                   	push   %edi
+  8042e7:	56                   	push   %esi
+  8042e8:	53                   	push   %ebx
+  8042e9:	83 ec 14             	sub    $0x14,%esp
+  8042ec:	89 c3                	mov    %eax,%ebx
+  8042ee:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  8042f0:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  8042f6:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  8042fc:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  8042ff:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804302:	89 d6                	mov    %edx,%esi
+  804304:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  80430a:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  80430c:	eb 34                	jmp    804342 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  80430e:	89 c8                	mov    %ecx,%eax
+  804310:	c1 e8 05             	shr    $0x5,%eax
+  804313:	89 da                	mov    %ebx,%edx
+  804315:	c1 e2 05             	shl    $0x5,%edx
+  804318:	01 da                	add    %ebx,%edx
+  80431a:	01 c2                	add    %eax,%edx
+  80431c:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804321:	d3 c0                	rol    %cl,%eax
+  804323:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  80432a:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804331:	b8 01 00 00 00       	mov    $0x1,%eax
+  804336:	01 d0                	add    %edx,%eax
+  804338:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  80433f:	83 c1 01             	add    $0x1,%ecx
+  804342:	39 f9                	cmp    %edi,%ecx
+  804344:	74 30                	je     804376 <va_chunk_mark+0x93>
+		if (alloc)
+  804346:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80434a:	74 c2                	je     80430e <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  80434c:	89 c8                	mov    %ecx,%eax
+  80434e:	c1 e8 05             	shr    $0x5,%eax
+  804351:	89 da                	mov    %ebx,%edx
+  804353:	c1 e2 05             	shl    $0x5,%edx
+  804356:	01 da                	add    %ebx,%edx
+  804358:	01 c2                	add    %eax,%edx
+  80435a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80435f:	d3 e0                	shl    %cl,%eax
+  804361:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804368:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  80436f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804374:	eb c0                	jmp    804336 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804376:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804379:	ba 00 00 00 00       	mov    $0x0,%edx
+  80437e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804381:	e8 b8 fe ff ff       	call   80423e <va_chunk_scan>
+	ch->run = run;
+  804386:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  80438c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80438f:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  804396:	83 c4 14             	add    $0x14,%esp
+  804399:	5b                   	pop    %ebx
+  80439a:	5e                   	pop    %esi
+  80439b:	5f                   	pop    %edi
+  80439c:	5d                   	pop    %ebp
+  80439d:	c3                   	ret
+
+0080439e <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  80439e:	55                   	push   %ebp
+  80439f:	89 e5                	mov    %esp,%ebp
+  8043a1:	57                   	push   %edi
+  8043a2:	56                   	push   %esi
+  8043a3:	53                   	push   %ebx
+  8043a4:	83 ec 04             	sub    $0x4,%esp
+  8043a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  8043aa:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  8043af:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  8043b4:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  8043bb:	74 4f                	je     80440c <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  8043bd:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8043c0:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  8043c5:	0f 87 01 01 00 00    	ja     8044cc <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  8043cb:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  8043d1:	0f 87 80 00 00 00    	ja     804457 <va_alloc+0xb9>
+  8043d7:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  8043dc:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  8043e1:	0f b7 10             	movzwl (%eax),%edx
+  8043e4:	05 84 00 00 00       	add    $0x84,%eax
+  8043e9:	39 da                	cmp    %ebx,%edx
+  8043eb:	73 2c                	jae    804419 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  8043ed:	83 c6 01             	add    $0x1,%esi
+  8043f0:	83 fe 1c             	cmp    $0x1c,%esi
+  8043f3:	75 ec                	jne    8043e1 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  8043f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043fa:	eb 53                	jmp    80444f <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  8043fc:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804402:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804407:	05 84 00 00 00       	add    $0x84,%eax
+  80440c:	39 d0                	cmp    %edx,%eax
+  80440e:	75 ec                	jne    8043fc <va_alloc+0x5e>
+	va_inited = 1;
+  804410:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  804417:	eb a4                	jmp    8043bd <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804419:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  80441f:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  804424:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804429:	89 da                	mov    %ebx,%edx
+  80442b:	e8 0e fe ff ff       	call   80423e <va_chunk_scan>
+  804430:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804432:	6a 01                	push   $0x1
+  804434:	89 d9                	mov    %ebx,%ecx
+  804436:	89 c2                	mov    %eax,%edx
+  804438:	89 f0                	mov    %esi,%eax
+  80443a:	e8 a4 fe ff ff       	call   8042e3 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  80443f:	c1 e6 16             	shl    $0x16,%esi
+  804442:	c1 e7 0c             	shl    $0xc,%edi
+  804445:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  80444c:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  80444f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804452:	5b                   	pop    %ebx
+  804453:	5e                   	pop    %esi
+  804454:	5f                   	pop    %edi
+  804455:	5d                   	pop    %ebp
+  804456:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804457:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  80445d:	c1 ee 0a             	shr    $0xa,%esi
+  804460:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80446a:	eb 0a                	jmp    804476 <va_alloc+0xd8>
+			first = c + 1;
+  80446c:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  80446e:	83 c2 01             	add    $0x1,%edx
+  804471:	83 fa 1d             	cmp    $0x1d,%edx
+  804474:	74 4f                	je     8044c5 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804476:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  80447c:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  804483:	00 04 
+  804485:	75 e5                	jne    80446c <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804487:	89 d1                	mov    %edx,%ecx
+  804489:	29 c1                	sub    %eax,%ecx
+  80448b:	39 f1                	cmp    %esi,%ecx
+  80448d:	75 df                	jne    80446e <va_alloc+0xd0>
+  80448f:	89 c7                	mov    %eax,%edi
+  804491:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804494:	be 00 04 00 00       	mov    $0x400,%esi
+  804499:	39 f3                	cmp    %esi,%ebx
+  80449b:	0f 46 f3             	cmovbe %ebx,%esi
+  80449e:	6a 01                	push   $0x1
+  8044a0:	89 f1                	mov    %esi,%ecx
+  8044a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044a7:	89 f8                	mov    %edi,%eax
+  8044a9:	e8 35 fe ff ff       	call   8042e3 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  8044ae:	83 c7 01             	add    $0x1,%edi
+  8044b1:	83 c4 04             	add    $0x4,%esp
+  8044b4:	29 f3                	sub    %esi,%ebx
+  8044b6:	75 dc                	jne    804494 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  8044b8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8044bb:	c1 e0 16             	shl    $0x16,%eax
+  8044be:	05 00 00 00 08       	add    $0x8000000,%eax
+  8044c3:	eb 8a                	jmp    80444f <va_alloc+0xb1>
+	return NULL;
+  8044c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044ca:	eb 83                	jmp    80444f <va_alloc+0xb1>
+		return NULL;
+  8044cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d1:	e9 79 ff ff ff       	jmp    80444f <va_alloc+0xb1>
+
+008044d6 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  8044d6:	55                   	push   %ebp
+  8044d7:	89 e5                	mov    %esp,%ebp
+  8044d9:	57                   	push   %edi
+  8044da:	56                   	push   %esi
+  8044db:	53                   	push   %ebx
+  8044dc:	83 ec 0c             	sub    $0xc,%esp
+  8044df:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8044e2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  8044e5:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  8044eb:	76 21                	jbe    80450e <va_free+0x38>
+  8044ed:	89 f0                	mov    %esi,%eax
+  8044ef:	c1 e0 0c             	shl    $0xc,%eax
+  8044f2:	01 f8                	add    %edi,%eax
+  8044f4:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  8044f9:	77 13                	ja     80450e <va_free+0x38>
+	    || PGOFF(va))
+  8044fb:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804501:	75 0b                	jne    80450e <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804503:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804509:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  80450c:	eb 45                	jmp    804553 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  80450e:	83 ec 0c             	sub    $0xc,%esp
+  804511:	56                   	push   %esi
+  804512:	57                   	push   %edi
+  804513:	68 bc 56 80 00       	push   $0x8056bc
+  804518:	68 8e 00 00 00       	push   $0x8e
+  80451d:	68 dc 56 80 00       	push   $0x8056dc
+  804522:	e8 c5 bb ff ff       	call   8000ec <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804527:	89 fa                	mov    %edi,%edx
+  804529:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80452f:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804534:	29 d3                	sub    %edx,%ebx
+  804536:	39 f3                	cmp    %esi,%ebx
+  804538:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  80453b:	89 f8                	mov    %edi,%eax
+  80453d:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804540:	83 ec 0c             	sub    $0xc,%esp
+  804543:	6a 00                	push   $0x0
+  804545:	89 d9                	mov    %ebx,%ecx
+  804547:	e8 97 fd ff ff       	call   8042e3 <va_chunk_mark>
+		i += n;
+  80454c:	01 df                	add    %ebx,%edi
+		npages -= n;
+  80454e:	29 de                	sub    %ebx,%esi
+  804550:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804553:	85 f6                	test   %esi,%esi
+  804555:	75 d0                	jne    804527 <va_free+0x51>
+	}
+}
+  804557:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80455a:	5b                   	pop    %ebx
+  80455b:	5e                   	pop    %esi
+  80455c:	5f                   	pop    %edi
+  80455d:	5d                   	pop    %ebp
+  80455e:	c3                   	ret
+
+0080455f <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80455f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804564:	c3                   	ret
+
+00804565 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804565:	55                   	push   %ebp
+  804566:	89 e5                	mov    %esp,%ebp
+  804568:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80456b:	68 e9 56 80 00       	push   $0x8056e9
+  804570:	ff 75 0c             	push   0xc(%ebp)
+  804573:	e8 36 c2 ff ff       	call   8007ae <strcpy>
+	return 0;
+}
+  804578:	b8 00 00 00 00       	mov    $0x0,%eax
+  80457d:	c9                   	leave
+  80457e:	c3                   	ret
+
+0080457f <devcons_write>:
+{
+  80457f:	55                   	push   %ebp
+  804580:	89 e5                	mov    %esp,%ebp
+  804582:	57                   	push   %edi
+  804583:	56                   	push   %esi
+  804584:	53                   	push   %ebx
+  804585:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80458b:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804590:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804596:	eb 2e                	jmp    8045c6 <devcons_write+0x47>
+		m = n - tot;
+  804598:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80459b:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80459d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8045a2:	39 c3                	cmp    %eax,%ebx
+  8045a4:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8045a7:	83 ec 04             	sub    $0x4,%esp
+  8045aa:	53                   	push   %ebx
+  8045ab:	89 f0                	mov    %esi,%eax
+  8045ad:	03 45 0c             	add    0xc(%ebp),%eax
+  8045b0:	50                   	push   %eax
+  8045b1:	57                   	push   %edi
+  8045b2:	e8 7d c3 ff ff       	call   800934 <memmove>
+		sys_cputs(buf, m);
+  8045b7:	83 c4 08             	add    $0x8,%esp
+  8045ba:	53                   	push   %ebx
+  8045bb:	57                   	push   %edi
+  8045bc:	e8 13 c6 ff ff       	call   800bd4 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8045c1:	01 de                	add    %ebx,%esi
+  8045c3:	83 c4 10             	add    $0x10,%esp
+  8045c6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8045c9:	72 cd                	jb     804598 <devcons_write+0x19>
+}
+  8045cb:	89 f0                	mov    %esi,%eax
+  8045cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045d0:	5b                   	pop    %ebx
+  8045d1:	5e                   	pop    %esi
+  8045d2:	5f                   	pop    %edi
+  8045d3:	5d                   	pop    %ebp
+  8045d4:	c3                   	ret
+
+008045d5 <devcons_read>:
+{
+  8045d5:	55                   	push   %ebp
+  8045d6:	89 e5                	mov    %esp,%ebp
+  8045d8:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8045db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045e0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8045e4:	75 07                	jne    8045ed <devcons_read+0x18>
+  8045e6:	eb 1f                	jmp    804607 <devcons_read+0x32>
+		sys_yield();
+  8045e8:	e8 95 c6 ff ff       	call   800c82 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8045ed:	e8 11 c6 ff ff       	call   800c03 <sys_cgetc>
+  8045f2:	85 c0                	test   %eax,%eax
+  8045f4:	74 f2                	je     8045e8 <devcons_read+0x13>
+	if (c < 0)
+  8045f6:	78 0f                	js     804607 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8045f8:	83 f8 04             	cmp    $0x4,%eax
+  8045fb:	74 0c                	je     804609 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8045fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804600:	88 02                	mov    %al,(%edx)
+	return 1;
+  804602:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804607:	c9                   	leave
+  804608:	c3                   	ret
+		return 0;
+  804609:	b8 00 00 00 00       	mov    $0x0,%eax
+  80460e:	eb f7                	jmp    804607 <devcons_read+0x32>
+
+00804610 <cputchar>:
+{
+  804610:	55                   	push   %ebp
+  804611:	89 e5                	mov    %esp,%ebp
+  804613:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804616:	8b 45 08             	mov    0x8(%ebp),%eax
+  804619:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80461c:	6a 01                	push   $0x1
+  80461e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804621:	50                   	push   %eax
+  804622:	e8 ad c5 ff ff       	call   800bd4 <sys_cputs>
+}
+  804627:	83 c4 10             	add    $0x10,%esp
+  80462a:	c9                   	leave
+  80462b:	c3                   	ret
+
+0080462c <getchar>:
+{
+  80462c:	55                   	push   %ebp
+  80462d:	89 e5                	mov    %esp,%ebp
+  80462f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804632:	6a 01                	push   $0x1
+  804634:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804637:	50                   	push   %eax
+  804638:	6a 00                	push   $0x0
+  80463a:	e8 d7 ce ff ff       	call   801516 <read>
+	if (r < 0)
+  80463f:	83 c4 10             	add    $0x10,%esp
+  804642:	85 c0                	test   %eax,%eax
+  804644:	78 06                	js     80464c <getchar+0x20>
+	if (r < 1)
+  804646:	74 06                	je     80464e <getchar+0x22>
+	return c;
+  804648:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80464c:	c9                   	leave
+  80464d:	c3                   	ret
+		return -E_EOF;
+  80464e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804653:	eb f7                	jmp    80464c <getchar+0x20>
+
+00804655 <iscons>:
+{
+  804655:	55                   	push   %ebp
+  804656:	89 e5                	mov    %esp,%ebp
+  804658:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80465b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80465e:	50                   	push   %eax
+  80465f:	ff 75 08             	push   0x8(%ebp)
+  804662:	e8 50 cc ff ff       	call   8012b7 <fd_lookup>
+  804667:	83 c4 10             	add    $0x10,%esp
+  80466a:	85 c0                	test   %eax,%eax
+  80466c:	78 11                	js     80467f <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80466e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804671:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804677:	39 10                	cmp    %edx,(%eax)
+  804679:	0f 94 c0             	sete   %al
+  80467c:	0f b6 c0             	movzbl %al,%eax
+}
+  80467f:	c9                   	leave
+  804680:	c3                   	ret
+
+00804681 <opencons>:
+{
+  804681:	55                   	push   %ebp
+  804682:	89 e5                	mov    %esp,%ebp
+  804684:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804687:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80468a:	50                   	push   %eax
+  80468b:	e8 d3 cb ff ff       	call   801263 <fd_alloc>
+  804690:	83 c4 10             	add    $0x10,%esp
+  804693:	85 c0                	test   %eax,%eax
+  804695:	78 3a                	js     8046d1 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804697:	83 ec 04             	sub    $0x4,%esp
+  80469a:	68 07 04 00 00       	push   $0x407
+  80469f:	ff 75 f4             	push   -0xc(%ebp)
+  8046a2:	6a 00                	push   $0x0
+  8046a4:	e8 f8 c5 ff ff       	call   800ca1 <sys_page_alloc>
+  8046a9:	83 c4 10             	add    $0x10,%esp
+  8046ac:	85 c0                	test   %eax,%eax
+  8046ae:	78 21                	js     8046d1 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8046b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8046b3:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  8046b9:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8046bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8046be:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8046c5:	83 ec 0c             	sub    $0xc,%esp
+  8046c8:	50                   	push   %eax
+  8046c9:	e8 6e cb ff ff       	call   80123c <fd2num>
+  8046ce:	83 c4 10             	add    $0x10,%esp
+}
+  8046d1:	c9                   	leave
+  8046d2:	c3                   	ret
+
+008046d3 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  8046d3:	55                   	push   %ebp
+  8046d4:	89 e5                	mov    %esp,%ebp
+  8046d6:	56                   	push   %esi
+  8046d7:	53                   	push   %ebx
+  8046d8:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8046db:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  8046e0:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  8046e3:	85 db                	test   %ebx,%ebx
+  8046e5:	78 17                	js     8046fe <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  8046e7:	83 ec 0c             	sub    $0xc,%esp
+  8046ea:	56                   	push   %esi
+  8046eb:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  8046f2:	83 c4 10             	add    $0x10,%esp
+  8046f5:	85 c0                	test   %eax,%eax
+  8046f7:	75 27                	jne    804720 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8046f9:	83 eb 01             	sub    $0x1,%ebx
+  8046fc:	eb e5                	jmp    8046e3 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  8046fe:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804703:	8b 40 48             	mov    0x48(%eax),%eax
+  804706:	83 ec 08             	sub    $0x8,%esp
+  804709:	ff 76 28             	push   0x28(%esi)
+  80470c:	ff 36                	push   (%esi)
+  80470e:	50                   	push   %eax
+  80470f:	68 f8 56 80 00       	push   $0x8056f8
+  804714:	6a 1d                	push   $0x1d
+  804716:	68 1b 57 80 00       	push   $0x80571b
+  80471b:	e8 cc b9 ff ff       	call   8000ec <_panic>
+}
+  804720:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804723:	5b                   	pop    %ebx
+  804724:	5e                   	pop    %esi
+  804725:	5d                   	pop    %ebp
+  804726:	c3                   	ret
+
+00804727 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804727:	55                   	push   %ebp
+  804728:	89 e5                	mov    %esp,%ebp
+  80472a:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  80472d:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  804734:	74 0a                	je     804740 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804736:	8b 45 08             	mov    0x8(%ebp),%eax
+  804739:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  80473e:	c9                   	leave
+  80473f:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804740:	83 ec 04             	sub    $0x4,%esp
+  804743:	6a 07                	push   $0x7
+  804745:	68 00 f0 bf ee       	push   $0xeebff000
+  80474a:	6a 00                	push   $0x0
+  80474c:	e8 50 c5 ff ff       	call   800ca1 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804751:	83 c4 08             	add    $0x8,%esp
+  804754:	68 c7 47 80 00       	push   $0x8047c7
+  804759:	6a 00                	push   $0x0
+  80475b:	e8 a7 c8 ff ff       	call   801007 <sys_env_set_pgfault_upcall>
+  804760:	83 c4 10             	add    $0x10,%esp
+  804763:	eb d1                	jmp    804736 <set_pgfault_handler+0xf>
+
+00804765 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804765:	55                   	push   %ebp
+  804766:	89 e5                	mov    %esp,%ebp
+  804768:	83 ec 08             	sub    $0x8,%esp
+  80476b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  80476e:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  804774:	b8 00 00 00 00       	mov    $0x0,%eax
+  804779:	eb 03                	jmp    80477e <add_pgfault_handler+0x19>
+  80477b:	83 c0 01             	add    $0x1,%eax
+  80477e:	39 d0                	cmp    %edx,%eax
+  804780:	74 0b                	je     80478d <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804782:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  804789:	75 f0                	jne    80477b <add_pgfault_handler+0x16>
+  80478b:	eb 24                	jmp    8047b1 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  80478d:	83 fa 0a             	cmp    $0xa,%edx
+  804790:	74 21                	je     8047b3 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  804792:	8d 42 01             	lea    0x1(%edx),%eax
+  804795:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  80479a:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  8047a1:	83 ec 0c             	sub    $0xc,%esp
+  8047a4:	68 d3 46 80 00       	push   $0x8046d3
+  8047a9:	e8 79 ff ff ff       	call   804727 <set_pgfault_handler>
+  8047ae:	83 c4 10             	add    $0x10,%esp
+}
+  8047b1:	c9                   	leave
+  8047b2:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  8047b3:	83 ec 04             	sub    $0x4,%esp
+  8047b6:	68 29 57 80 00       	push   $0x805729
+  8047bb:	6a 44                	push   $0x44
+  8047bd:	68 1b 57 80 00       	push   $0x80571b
+  8047c2:	e8 25 b9 ff ff       	call   8000ec <_panic>
+
+008047c7 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8047c7:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8047c8:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  8047cd:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8047cf:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  8047d2:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  8047d6:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  8047da:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  8047dd:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  8047df:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  8047e3:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  8047e6:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  8047e7:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  8047ea:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  8047eb:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8047ec:	c3                   	ret
+
+008047ed <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8047ed:	55                   	push   %ebp
+  8047ee:	89 e5                	mov    %esp,%ebp
+  8047f0:	57                   	push   %edi
+  8047f1:	56                   	push   %esi
+  8047f2:	53                   	push   %ebx
+  8047f3:	83 ec 14             	sub    $0x14,%esp
+  8047f6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8047f9:	8b 75 14             	mov    0x14(%ebp),%esi
+  8047fc:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8047ff:	ff 75 10             	push   0x10(%ebp)
+  804802:	ff 75 0c             	push   0xc(%ebp)
+  804805:	e8 ba c8 ff ff       	call   8010c4 <sys_ipc_recv_pages>
+  80480a:	83 c4 10             	add    $0x10,%esp
+  80480d:	85 c0                	test   %eax,%eax
+  80480f:	78 46                	js     804857 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804811:	85 ff                	test   %edi,%edi
+  804813:	74 0d                	je     804822 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804815:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80481a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804820:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804822:	85 f6                	test   %esi,%esi
+  804824:	74 0d                	je     804833 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804826:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80482b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804831:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804833:	85 db                	test   %ebx,%ebx
+  804835:	74 0d                	je     804844 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804837:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80483c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804842:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804844:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804849:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80484f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804852:	5b                   	pop    %ebx
+  804853:	5e                   	pop    %esi
+  804854:	5f                   	pop    %edi
+  804855:	5d                   	pop    %ebp
+  804856:	c3                   	ret
+		if (from_env_store) {
+  804857:	85 ff                	test   %edi,%edi
+  804859:	74 06                	je     804861 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80485b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804861:	85 f6                	test   %esi,%esi
+  804863:	74 06                	je     80486b <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804865:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80486b:	85 db                	test   %ebx,%ebx
+  80486d:	74 e0                	je     80484f <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  80486f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804875:	eb d8                	jmp    80484f <ipc_recv_pages+0x62>
+
+00804877 <ipc_recv>:
+{
+  804877:	55                   	push   %ebp
+  804878:	89 e5                	mov    %esp,%ebp
+  80487a:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  80487d:	6a 00                	push   $0x0
+  80487f:	ff 75 10             	push   0x10(%ebp)
+  804882:	6a 01                	push   $0x1
+  804884:	ff 75 0c             	push   0xc(%ebp)
+  804887:	ff 75 08             	push   0x8(%ebp)
+  80488a:	e8 5e ff ff ff       	call   8047ed <ipc_recv_pages>
+}
+  80488f:	c9                   	leave
+  804890:	c3                   	ret
+
+00804891 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804891:	55                   	push   %ebp
+  804892:	89 e5                	mov    %esp,%ebp
+  804894:	56                   	push   %esi
+  804895:	53                   	push   %ebx
+  804896:	8b 75 08             	mov    0x8(%ebp),%esi
+  804899:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  80489c:	83 ec 0c             	sub    $0xc,%esp
+  80489f:	ff 75 0c             	push   0xc(%ebp)
+  8048a2:	e8 51 c9 ff ff       	call   8011f8 <sys_ipc_try_recv>
+  8048a7:	83 c4 10             	add    $0x10,%esp
+  8048aa:	85 c0                	test   %eax,%eax
+  8048ac:	78 34                	js     8048e2 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8048ae:	85 f6                	test   %esi,%esi
+  8048b0:	74 0d                	je     8048bf <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8048b2:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8048b7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8048bd:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8048bf:	85 db                	test   %ebx,%ebx
+  8048c1:	74 0d                	je     8048d0 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8048c3:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8048c8:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8048ce:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8048d0:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8048d5:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8048db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8048de:	5b                   	pop    %ebx
+  8048df:	5e                   	pop    %esi
+  8048e0:	5d                   	pop    %ebp
+  8048e1:	c3                   	ret
+		if (from_env_store) {
+  8048e2:	85 f6                	test   %esi,%esi
+  8048e4:	74 06                	je     8048ec <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8048e6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8048ec:	85 db                	test   %ebx,%ebx
+  8048ee:	74 eb                	je     8048db <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8048f0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8048f6:	eb e3                	jmp    8048db <ipc_try_recv+0x4a>
+
+008048f8 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8048f8:	55                   	push   %ebp
+  8048f9:	89 e5                	mov    %esp,%ebp
+  8048fb:	83 ec 14             	sub    $0x14,%esp
+  8048fe:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804901:	85 c0                	test   %eax,%eax
+  804903:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804908:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80490b:	ff 75 18             	push   0x18(%ebp)
+  80490e:	ff 75 14             	push   0x14(%ebp)
+  804911:	50                   	push   %eax
+  804912:	ff 75 0c             	push   0xc(%ebp)
+  804915:	ff 75 08             	push   0x8(%ebp)
+  804918:	e8 6a c7 ff ff       	call   801087 <sys_ipc_send_pages>
+  80491d:	83 c4 20             	add    $0x20,%esp
+  804920:	85 c0                	test   %eax,%eax
+  804922:	78 02                	js     804926 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804924:	c9                   	leave
+  804925:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804926:	50                   	push   %eax
+  804927:	68 44 57 80 00       	push   $0x805744
+  80492c:	68 80 00 00 00       	push   $0x80
+  804931:	68 70 57 80 00       	push   $0x805770
+  804936:	e8 b1 b7 ff ff       	call   8000ec <_panic>
+
+0080493b <ipc_send>:
+{
+  80493b:	55                   	push   %ebp
+  80493c:	89 e5                	mov    %esp,%ebp
+  80493e:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  804941:	ff 75 14             	push   0x14(%ebp)
+  804944:	6a 01                	push   $0x1
+  804946:	ff 75 10             	push   0x10(%ebp)
+  804949:	ff 75 0c             	push   0xc(%ebp)
+  80494c:	ff 75 08             	push   0x8(%ebp)
+  80494f:	e8 a4 ff ff ff       	call   8048f8 <ipc_send_pages>
+}
+  804954:	83 c4 20             	add    $0x20,%esp
+  804957:	c9                   	leave
+  804958:	c3                   	ret
+
+00804959 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804959:	55                   	push   %ebp
+  80495a:	89 e5                	mov    %esp,%ebp
+  80495c:	83 ec 14             	sub    $0x14,%esp
+  80495f:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804962:	85 c0                	test   %eax,%eax
+  804964:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804969:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80496c:	ff 75 18             	push   0x18(%ebp)
+  80496f:	ff 75 14             	push   0x14(%ebp)
+  804972:	50                   	push   %eax
+  804973:	ff 75 0c             	push   0xc(%ebp)
+  804976:	ff 75 08             	push   0x8(%ebp)
+  804979:	e8 9a c7 ff ff       	call   801118 <sys_ipc_call>
+  80497e:	83 c4 20             	add    $0x20,%esp
+  804981:	85 c0                	test   %eax,%eax
+  804983:	78 0b                	js     804990 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  804985:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80498a:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804990:	c9                   	leave
+  804991:	c3                   	ret
+
+00804992 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  804992:	55                   	push   %ebp
+  804993:	89 e5                	mov    %esp,%ebp
+  804995:	57                   	push   %edi
+  804996:	56                   	push   %esi
+  804997:	53                   	push   %ebx
+  804998:	83 ec 18             	sub    $0x18,%esp
+  80499b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80499e:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8049a1:	8b 75 20             	mov    0x20(%ebp),%esi
+  8049a4:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8049a7:	85 c0                	test   %eax,%eax
+  8049a9:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8049ae:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8049b1:	ff 75 18             	push   0x18(%ebp)
+  8049b4:	ff 75 14             	push   0x14(%ebp)
+  8049b7:	50                   	push   %eax
+  8049b8:	ff 75 0c             	push   0xc(%ebp)
+  8049bb:	ff 75 08             	push   0x8(%ebp)
+  8049be:	e8 96 c7 ff ff       	call   801159 <sys_ipc_reply_recv>
+  8049c3:	83 c4 20             	add    $0x20,%esp
+  8049c6:	85 c0                	test   %eax,%eax
+  8049c8:	78 46                	js     804a10 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8049ca:	85 ff                	test   %edi,%edi
+  8049cc:	74 0d                	je     8049db <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8049ce:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049d3:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8049d9:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8049db:	85 f6                	test   %esi,%esi
+  8049dd:	74 0d                	je     8049ec <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8049df:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049e4:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8049ea:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8049ec:	85 db                	test   %ebx,%ebx
+  8049ee:	74 0d                	je     8049fd <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8049f0:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049f5:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8049fb:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8049fd:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804a02:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804a08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a0b:	5b                   	pop    %ebx
+  804a0c:	5e                   	pop    %esi
+  804a0d:	5f                   	pop    %edi
+  804a0e:	5d                   	pop    %ebp
+  804a0f:	c3                   	ret
+		if (from_env_store) {
+  804a10:	85 ff                	test   %edi,%edi
+  804a12:	74 06                	je     804a1a <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  804a14:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804a1a:	85 f6                	test   %esi,%esi
+  804a1c:	74 06                	je     804a24 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  804a1e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804a24:	85 db                	test   %ebx,%ebx
+  804a26:	74 e0                	je     804a08 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  804a28:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804a2e:	eb d8                	jmp    804a08 <ipc_reply_recv+0x76>
+
+00804a30 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804a30:	55                   	push   %ebp
+  804a31:	89 e5                	mov    %esp,%ebp
+  804a33:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804a36:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804a3b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804a3e:	c1 e0 06             	shl    $0x6,%eax
+  804a41:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804a46:	8b 40 50             	mov    0x50(%eax),%eax
+  804a49:	39 c8                	cmp    %ecx,%eax
+  804a4b:	74 12                	je     804a5f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804a4d:	83 c2 01             	add    $0x1,%edx
+  804a50:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804a56:	75 e3                	jne    804a3b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804a58:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a5d:	eb 0e                	jmp    804a6d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804a5f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804a62:	c1 e0 06             	shl    $0x6,%eax
+  804a65:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804a6a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804a6d:	5d                   	pop    %ebp
+  804a6e:	c3                   	ret
+
+00804a6f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804a6f:	55                   	push   %ebp
+  804a70:	89 e5                	mov    %esp,%ebp
+  804a72:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804a75:	89 c2                	mov    %eax,%edx
+  804a77:	c1 ea 16             	shr    $0x16,%edx
+  804a7a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804a81:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804a86:	f6 c1 01             	test   $0x1,%cl
+  804a89:	74 1e                	je     804aa9 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  804a8b:	c1 e8 0c             	shr    $0xc,%eax
+  804a8e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804a95:	a8 01                	test   $0x1,%al
+  804a97:	74 10                	je     804aa9 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804a99:	c1 e8 0c             	shr    $0xc,%eax
+  804a9c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  804a9f:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  804aa6:	0f b7 d2             	movzwl %dx,%edx
+}
+  804aa9:	89 d0                	mov    %edx,%eax
+  804aab:	5d                   	pop    %ebp
+  804aac:	c3                   	ret
+
+00804aad <udivmod>:
+  804aad:	55                   	push   %ebp
+  804aae:	57                   	push   %edi
+  804aaf:	56                   	push   %esi
+  804ab0:	53                   	push   %ebx
+  804ab1:	83 ec 24             	sub    $0x24,%esp
+  804ab4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804ab8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804abc:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804ac0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804ac4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804ac8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804acc:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  804ad0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ada:	ba 00 00 00 00       	mov    $0x0,%edx
+  804adf:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804ae6:	00 
+  804ae7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804aee:	00 
+  804aef:	89 fb                	mov    %edi,%ebx
+  804af1:	eb 08                	jmp    804afb <udivmod+0x4e>
+  804af3:	83 e9 01             	sub    $0x1,%ecx
+  804af6:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804af9:	74 68                	je     804b63 <udivmod+0xb6>
+  804afb:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804aff:	01 c0                	add    %eax,%eax
+  804b01:	89 c6                	mov    %eax,%esi
+  804b03:	89 d7                	mov    %edx,%edi
+  804b05:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804b09:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804b0d:	0f ad d0             	shrd   %cl,%edx,%eax
+  804b10:	d3 ea                	shr    %cl,%edx
+  804b12:	f6 c1 20             	test   $0x20,%cl
+  804b15:	74 04                	je     804b1b <udivmod+0x6e>
+  804b17:	89 d0                	mov    %edx,%eax
+  804b19:	31 d2                	xor    %edx,%edx
+  804b1b:	83 e0 01             	and    $0x1,%eax
+  804b1e:	89 04 24             	mov    %eax,(%esp)
+  804b21:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804b28:	00 
+  804b29:	8b 04 24             	mov    (%esp),%eax
+  804b2c:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804b30:	09 f0                	or     %esi,%eax
+  804b32:	09 fa                	or     %edi,%edx
+  804b34:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804b38:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804b3c:	39 f0                	cmp    %esi,%eax
+  804b3e:	89 d5                	mov    %edx,%ebp
+  804b40:	19 fd                	sbb    %edi,%ebp
+  804b42:	72 af                	jb     804af3 <udivmod+0x46>
+  804b44:	29 f0                	sub    %esi,%eax
+  804b46:	19 fa                	sbb    %edi,%edx
+  804b48:	89 cf                	mov    %ecx,%edi
+  804b4a:	c1 ef 05             	shr    $0x5,%edi
+  804b4d:	83 e7 01             	and    $0x1,%edi
+  804b50:	89 fe                	mov    %edi,%esi
+  804b52:	83 f6 01             	xor    $0x1,%esi
+  804b55:	d3 e6                	shl    %cl,%esi
+  804b57:	d3 e7                	shl    %cl,%edi
+  804b59:	09 74 24 18          	or     %esi,0x18(%esp)
+  804b5d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804b61:	eb 90                	jmp    804af3 <udivmod+0x46>
+  804b63:	85 db                	test   %ebx,%ebx
+  804b65:	74 05                	je     804b6c <udivmod+0xbf>
+  804b67:	89 03                	mov    %eax,(%ebx)
+  804b69:	89 53 04             	mov    %edx,0x4(%ebx)
+  804b6c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804b70:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804b74:	83 c4 24             	add    $0x24,%esp
+  804b77:	5b                   	pop    %ebx
+  804b78:	5e                   	pop    %esi
+  804b79:	5f                   	pop    %edi
+  804b7a:	5d                   	pop    %ebp
+  804b7b:	c3                   	ret
+
+00804b7c <__udivdi3>:
+  804b7c:	83 ec 08             	sub    $0x8,%esp
+  804b7f:	6a 00                	push   $0x0
+  804b81:	ff 74 24 1c          	push   0x1c(%esp)
+  804b85:	ff 74 24 1c          	push   0x1c(%esp)
+  804b89:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804b8d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804b91:	e8 17 ff ff ff       	call   804aad <udivmod>
+  804b96:	83 c4 14             	add    $0x14,%esp
+  804b99:	c3                   	ret
+
+00804b9a <__umoddi3>:
+  804b9a:	83 ec 18             	sub    $0x18,%esp
+  804b9d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804ba1:	50                   	push   %eax
+  804ba2:	ff 74 24 2c          	push   0x2c(%esp)
+  804ba6:	ff 74 24 2c          	push   0x2c(%esp)
+  804baa:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804bae:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804bb2:	e8 f6 fe ff ff       	call   804aad <udivmod>
+  804bb7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804bbb:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804bbf:	83 c4 24             	add    $0x24,%esp
+  804bc2:	c3                   	ret
+
+00804bc3 <__divdi3>:
+  804bc3:	55                   	push   %ebp
+  804bc4:	57                   	push   %edi
+  804bc5:	56                   	push   %esi
+  804bc6:	53                   	push   %ebx
+  804bc7:	83 ec 10             	sub    $0x10,%esp
+  804bca:	8b 44 24 24          	mov    0x24(%esp),%eax
+  804bce:	8b 54 24 28          	mov    0x28(%esp),%edx
+  804bd2:	89 c6                	mov    %eax,%esi
+  804bd4:	89 d7                	mov    %edx,%edi
+  804bd6:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  804bda:	33 7c 24 30          	xor    0x30(%esp),%edi
+  804bde:	89 74 24 04          	mov    %esi,0x4(%esp)
+  804be2:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  804be6:	89 c5                	mov    %eax,%ebp
+  804be8:	f7 dd                	neg    %ebp
+  804bea:	89 d6                	mov    %edx,%esi
+  804bec:	83 d6 00             	adc    $0x0,%esi
+  804bef:	f7 de                	neg    %esi
+  804bf1:	0f 48 e8             	cmovs  %eax,%ebp
+  804bf4:	0f 49 d6             	cmovns %esi,%edx
+  804bf7:	6a 00                	push   $0x0
+  804bf9:	8b 74 24 30          	mov    0x30(%esp),%esi
+  804bfd:	f7 de                	neg    %esi
+  804bff:	8b 44 24 34          	mov    0x34(%esp),%eax
+  804c03:	83 d0 00             	adc    $0x0,%eax
+  804c06:	f7 d8                	neg    %eax
+  804c08:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  804c0d:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  804c12:	50                   	push   %eax
+  804c13:	56                   	push   %esi
+  804c14:	89 e8                	mov    %ebp,%eax
+  804c16:	e8 92 fe ff ff       	call   804aad <udivmod>
+  804c1b:	83 c4 10             	add    $0x10,%esp
+  804c1e:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  804c23:	78 08                	js     804c2d <__divdi3+0x6a>
+  804c25:	83 c4 0c             	add    $0xc,%esp
+  804c28:	5b                   	pop    %ebx
+  804c29:	5e                   	pop    %esi
+  804c2a:	5f                   	pop    %edi
+  804c2b:	5d                   	pop    %ebp
+  804c2c:	c3                   	ret
+  804c2d:	f7 d8                	neg    %eax
+  804c2f:	83 d2 00             	adc    $0x0,%edx
+  804c32:	f7 da                	neg    %edx
+  804c34:	eb ef                	jmp    804c25 <__divdi3+0x62>
+
+00804c36 <__moddi3>:
+  804c36:	55                   	push   %ebp
+  804c37:	57                   	push   %edi
+  804c38:	56                   	push   %esi
+  804c39:	53                   	push   %ebx
+  804c3a:	83 ec 18             	sub    $0x18,%esp
+  804c3d:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  804c41:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  804c45:	89 f1                	mov    %esi,%ecx
+  804c47:	f7 d9                	neg    %ecx
+  804c49:	89 da                	mov    %ebx,%edx
+  804c4b:	83 d2 00             	adc    $0x0,%edx
+  804c4e:	f7 da                	neg    %edx
+  804c50:	0f 48 ce             	cmovs  %esi,%ecx
+  804c53:	0f 48 d3             	cmovs  %ebx,%edx
+  804c56:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804c5a:	50                   	push   %eax
+  804c5b:	8b 74 24 38          	mov    0x38(%esp),%esi
+  804c5f:	f7 de                	neg    %esi
+  804c61:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  804c65:	83 d0 00             	adc    $0x0,%eax
+  804c68:	f7 d8                	neg    %eax
+  804c6a:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  804c6f:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  804c74:	50                   	push   %eax
+  804c75:	56                   	push   %esi
+  804c76:	89 c8                	mov    %ecx,%eax
+  804c78:	e8 30 fe ff ff       	call   804aad <udivmod>
+  804c7d:	83 c4 10             	add    $0x10,%esp
+  804c80:	85 db                	test   %ebx,%ebx
+  804c82:	78 10                	js     804c94 <__moddi3+0x5e>
+  804c84:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804c88:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804c8c:	83 c4 14             	add    $0x14,%esp
+  804c8f:	5b                   	pop    %ebx
+  804c90:	5e                   	pop    %esi
+  804c91:	5f                   	pop    %edi
+  804c92:	5d                   	pop    %ebp
+  804c93:	c3                   	ret
+  804c94:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804c98:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804c9c:	f7 d8                	neg    %eax
+  804c9e:	83 d2 00             	adc    $0x0,%edx
+  804ca1:	f7 da                	neg    %edx
+  804ca3:	eb e7                	jmp    804c8c <__moddi3+0x56>
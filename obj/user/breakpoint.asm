@@ -0,0 +1,5556 @@
+
+obj/user/breakpoint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 04 00 00 00       	call   800035 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $3");
+  800033:	cc                   	int3
+}
+  800034:	c3                   	ret
+
+00800035 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800040:	e8 08 01 00 00       	call   80014d <sys_getenvid>
+  800045:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80004d:	c1 e0 06             	shl    $0x6,%eax
+  800050:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800055:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80005a:	85 db                	test   %ebx,%ebx
+  80005c:	7e 07                	jle    800065 <libmain+0x30>
+		binaryname = argv[0];
+  80005e:	8b 06                	mov    (%esi),%eax
+  800060:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800065:	83 ec 08             	sub    $0x8,%esp
+  800068:	56                   	push   %esi
+  800069:	53                   	push   %ebx
+  80006a:	e8 c4 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80006f:	e8 0a 00 00 00       	call   80007e <exit>
+}
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007a:	5b                   	pop    %ebx
+  80007b:	5e                   	pop    %esi
+  80007c:	5d                   	pop    %ebp
+  80007d:	c3                   	ret
+
+0080007e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80007e:	55                   	push   %ebp
+  80007f:	89 e5                	mov    %esp,%ebp
+  800081:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800084:	e8 68 08 00 00       	call   8008f1 <close_all>
+	sys_env_destroy(0);
+  800089:	83 ec 0c             	sub    $0xc,%esp
+  80008c:	6a 00                	push   $0x0
+  80008e:	e8 79 00 00 00       	call   80010c <sys_env_destroy>
+}
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	c9                   	leave
+  800097:	c3                   	ret
+
+00800098 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800098:	55                   	push   %ebp
+  800099:	89 e5                	mov    %esp,%ebp
+  80009b:	83 ec 10             	sub    $0x10,%esp
+  80009e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000a1:	89 c8                	mov    %ecx,%eax
+  8000a3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8000a8:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8000ab:	eb 0b                	jmp    8000b8 <touch_mem+0x20>
+		c = *(char *)page;
+  8000ad:	0f b6 10             	movzbl (%eax),%edx
+  8000b0:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000b3:	05 00 10 00 00       	add    $0x1000,%eax
+  8000b8:	39 c8                	cmp    %ecx,%eax
+  8000ba:	72 f1                	jb     8000ad <touch_mem+0x15>
+}
+  8000bc:	c9                   	leave
+  8000bd:	c3                   	ret
+
+008000be <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000be:	55                   	push   %ebp
+  8000bf:	89 e5                	mov    %esp,%ebp
+  8000c1:	57                   	push   %edi
+  8000c2:	56                   	push   %esi
+  8000c3:	53                   	push   %ebx
+	touch_mem(s, len);
+  8000c4:	ff 75 0c             	push   0xc(%ebp)
+  8000c7:	ff 75 08             	push   0x8(%ebp)
+  8000ca:	e8 c9 ff ff ff       	call   800098 <touch_mem>
+	asm volatile("int %1\n"
+  8000cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000da:	89 c3                	mov    %eax,%ebx
+  8000dc:	89 c7                	mov    %eax,%edi
+  8000de:	89 c6                	mov    %eax,%esi
+  8000e0:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000e2:	83 c4 08             	add    $0x8,%esp
+  8000e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e8:	5b                   	pop    %ebx
+  8000e9:	5e                   	pop    %esi
+  8000ea:	5f                   	pop    %edi
+  8000eb:	5d                   	pop    %ebp
+  8000ec:	c3                   	ret
+
+008000ed <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000ed:	55                   	push   %ebp
+  8000ee:	89 e5                	mov    %esp,%ebp
+  8000f0:	57                   	push   %edi
+  8000f1:	56                   	push   %esi
+  8000f2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000f8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000fd:	89 d1                	mov    %edx,%ecx
+  8000ff:	89 d3                	mov    %edx,%ebx
+  800101:	89 d7                	mov    %edx,%edi
+  800103:	89 d6                	mov    %edx,%esi
+  800105:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800107:	5b                   	pop    %ebx
+  800108:	5e                   	pop    %esi
+  800109:	5f                   	pop    %edi
+  80010a:	5d                   	pop    %ebp
+  80010b:	c3                   	ret
+
+0080010c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80010c:	55                   	push   %ebp
+  80010d:	89 e5                	mov    %esp,%ebp
+  80010f:	57                   	push   %edi
+  800110:	56                   	push   %esi
+  800111:	53                   	push   %ebx
+  800112:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800115:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80011a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80011d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800122:	89 cb                	mov    %ecx,%ebx
+  800124:	89 cf                	mov    %ecx,%edi
+  800126:	89 ce                	mov    %ecx,%esi
+  800128:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80012a:	85 c0                	test   %eax,%eax
+  80012c:	7f 08                	jg     800136 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80012e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800131:	5b                   	pop    %ebx
+  800132:	5e                   	pop    %esi
+  800133:	5f                   	pop    %edi
+  800134:	5d                   	pop    %ebp
+  800135:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800136:	83 ec 0c             	sub    $0xc,%esp
+  800139:	50                   	push   %eax
+  80013a:	6a 03                	push   $0x3
+  80013c:	68 8a 26 80 00       	push   $0x80268a
+  800141:	6a 23                	push   $0x23
+  800143:	68 a7 26 80 00       	push   $0x8026a7
+  800148:	e8 b9 15 00 00       	call   801706 <_panic>
+
+0080014d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80014d:	55                   	push   %ebp
+  80014e:	89 e5                	mov    %esp,%ebp
+  800150:	57                   	push   %edi
+  800151:	56                   	push   %esi
+  800152:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800153:	ba 00 00 00 00       	mov    $0x0,%edx
+  800158:	b8 02 00 00 00       	mov    $0x2,%eax
+  80015d:	89 d1                	mov    %edx,%ecx
+  80015f:	89 d3                	mov    %edx,%ebx
+  800161:	89 d7                	mov    %edx,%edi
+  800163:	89 d6                	mov    %edx,%esi
+  800165:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800167:	5b                   	pop    %ebx
+  800168:	5e                   	pop    %esi
+  800169:	5f                   	pop    %edi
+  80016a:	5d                   	pop    %ebp
+  80016b:	c3                   	ret
+
+0080016c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80016c:	55                   	push   %ebp
+  80016d:	89 e5                	mov    %esp,%ebp
+  80016f:	57                   	push   %edi
+  800170:	56                   	push   %esi
+  800171:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800172:	ba 00 00 00 00       	mov    $0x0,%edx
+  800177:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80017c:	89 d1                	mov    %edx,%ecx
+  80017e:	89 d3                	mov    %edx,%ebx
+  800180:	89 d7                	mov    %edx,%edi
+  800182:	89 d6                	mov    %edx,%esi
+  800184:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800186:	5b                   	pop    %ebx
+  800187:	5e                   	pop    %esi
+  800188:	5f                   	pop    %edi
+  800189:	5d                   	pop    %ebp
+  80018a:	c3                   	ret
+
+0080018b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80018b:	55                   	push   %ebp
+  80018c:	89 e5                	mov    %esp,%ebp
+  80018e:	57                   	push   %edi
+  80018f:	56                   	push   %esi
+  800190:	53                   	push   %ebx
+  800191:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800194:	be 00 00 00 00       	mov    $0x0,%esi
+  800199:	8b 55 08             	mov    0x8(%ebp),%edx
+  80019c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80019f:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001a4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001a7:	89 f7                	mov    %esi,%edi
+  8001a9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001ab:	85 c0                	test   %eax,%eax
+  8001ad:	7f 08                	jg     8001b7 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001b2:	5b                   	pop    %ebx
+  8001b3:	5e                   	pop    %esi
+  8001b4:	5f                   	pop    %edi
+  8001b5:	5d                   	pop    %ebp
+  8001b6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001b7:	83 ec 0c             	sub    $0xc,%esp
+  8001ba:	50                   	push   %eax
+  8001bb:	6a 04                	push   $0x4
+  8001bd:	68 8a 26 80 00       	push   $0x80268a
+  8001c2:	6a 23                	push   $0x23
+  8001c4:	68 a7 26 80 00       	push   $0x8026a7
+  8001c9:	e8 38 15 00 00       	call   801706 <_panic>
+
+008001ce <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001ce:	55                   	push   %ebp
+  8001cf:	89 e5                	mov    %esp,%ebp
+  8001d1:	57                   	push   %edi
+  8001d2:	56                   	push   %esi
+  8001d3:	53                   	push   %ebx
+  8001d4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001dd:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001e5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001e8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001eb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001ed:	85 c0                	test   %eax,%eax
+  8001ef:	7f 08                	jg     8001f9 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001f4:	5b                   	pop    %ebx
+  8001f5:	5e                   	pop    %esi
+  8001f6:	5f                   	pop    %edi
+  8001f7:	5d                   	pop    %ebp
+  8001f8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001f9:	83 ec 0c             	sub    $0xc,%esp
+  8001fc:	50                   	push   %eax
+  8001fd:	6a 05                	push   $0x5
+  8001ff:	68 8a 26 80 00       	push   $0x80268a
+  800204:	6a 23                	push   $0x23
+  800206:	68 a7 26 80 00       	push   $0x8026a7
+  80020b:	e8 f6 14 00 00       	call   801706 <_panic>
+
+00800210 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800210:	55                   	push   %ebp
+  800211:	89 e5                	mov    %esp,%ebp
+  800213:	57                   	push   %edi
+  800214:	56                   	push   %esi
+  800215:	53                   	push   %ebx
+  800216:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800219:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80021e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800221:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800224:	b8 06 00 00 00       	mov    $0x6,%eax
+  800229:	89 df                	mov    %ebx,%edi
+  80022b:	89 de                	mov    %ebx,%esi
+  80022d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80022f:	85 c0                	test   %eax,%eax
+  800231:	7f 08                	jg     80023b <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800233:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800236:	5b                   	pop    %ebx
+  800237:	5e                   	pop    %esi
+  800238:	5f                   	pop    %edi
+  800239:	5d                   	pop    %ebp
+  80023a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	50                   	push   %eax
+  80023f:	6a 06                	push   $0x6
+  800241:	68 8a 26 80 00       	push   $0x80268a
+  800246:	6a 23                	push   $0x23
+  800248:	68 a7 26 80 00       	push   $0x8026a7
+  80024d:	e8 b4 14 00 00       	call   801706 <_panic>
+
+00800252 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800252:	55                   	push   %ebp
+  800253:	89 e5                	mov    %esp,%ebp
+  800255:	57                   	push   %edi
+  800256:	56                   	push   %esi
+  800257:	53                   	push   %ebx
+  800258:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80025b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800260:	8b 55 08             	mov    0x8(%ebp),%edx
+  800263:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800266:	b8 18 00 00 00       	mov    $0x18,%eax
+  80026b:	89 df                	mov    %ebx,%edi
+  80026d:	89 de                	mov    %ebx,%esi
+  80026f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800271:	85 c0                	test   %eax,%eax
+  800273:	7f 08                	jg     80027d <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800275:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800278:	5b                   	pop    %ebx
+  800279:	5e                   	pop    %esi
+  80027a:	5f                   	pop    %edi
+  80027b:	5d                   	pop    %ebp
+  80027c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80027d:	83 ec 0c             	sub    $0xc,%esp
+  800280:	50                   	push   %eax
+  800281:	6a 18                	push   $0x18
+  800283:	68 8a 26 80 00       	push   $0x80268a
+  800288:	6a 23                	push   $0x23
+  80028a:	68 a7 26 80 00       	push   $0x8026a7
+  80028f:	e8 72 14 00 00       	call   801706 <_panic>
+
+00800294 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800294:	55                   	push   %ebp
+  800295:	89 e5                	mov    %esp,%ebp
+  800297:	57                   	push   %edi
+  800298:	56                   	push   %esi
+  800299:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80029a:	be 00 00 00 00       	mov    $0x0,%esi
+  80029f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002a5:	b8 19 00 00 00       	mov    $0x19,%eax
+  8002aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002ad:	89 f7                	mov    %esi,%edi
+  8002af:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  8002b1:	5b                   	pop    %ebx
+  8002b2:	5e                   	pop    %esi
+  8002b3:	5f                   	pop    %edi
+  8002b4:	5d                   	pop    %ebp
+  8002b5:	c3                   	ret
+
+008002b6 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8002b6:	55                   	push   %ebp
+  8002b7:	89 e5                	mov    %esp,%ebp
+  8002b9:	57                   	push   %edi
+  8002ba:	56                   	push   %esi
+  8002bb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8002cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002cf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002d2:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8002d4:	5b                   	pop    %ebx
+  8002d5:	5e                   	pop    %esi
+  8002d6:	5f                   	pop    %edi
+  8002d7:	5d                   	pop    %ebp
+  8002d8:	c3                   	ret
+
+008002d9 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  8002d9:	55                   	push   %ebp
+  8002da:	89 e5                	mov    %esp,%ebp
+  8002dc:	57                   	push   %edi
+  8002dd:	56                   	push   %esi
+  8002de:	53                   	push   %ebx
+  8002df:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  8002e2:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8002e5:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8002eb:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  8002ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f4:	b8 10 00 00 00       	mov    $0x10,%eax
+  8002f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002fc:	8b 75 18             	mov    0x18(%ebp),%esi
+  8002ff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800301:	85 c0                	test   %eax,%eax
+  800303:	7f 08                	jg     80030d <sys_page_map_range+0x34>
+}
+  800305:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800308:	5b                   	pop    %ebx
+  800309:	5e                   	pop    %esi
+  80030a:	5f                   	pop    %edi
+  80030b:	5d                   	pop    %ebp
+  80030c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80030d:	83 ec 0c             	sub    $0xc,%esp
+  800310:	50                   	push   %eax
+  800311:	6a 10                	push   $0x10
+  800313:	68 8a 26 80 00       	push   $0x80268a
+  800318:	6a 23                	push   $0x23
+  80031a:	68 a7 26 80 00       	push   $0x8026a7
+  80031f:	e8 e2 13 00 00       	call   801706 <_panic>
+
+00800324 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800324:	55                   	push   %ebp
+  800325:	89 e5                	mov    %esp,%ebp
+  800327:	57                   	push   %edi
+  800328:	56                   	push   %esi
+  800329:	53                   	push   %ebx
+  80032a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80032d:	be 00 00 00 00       	mov    $0x0,%esi
+  800332:	8b 55 08             	mov    0x8(%ebp),%edx
+  800335:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800338:	b8 11 00 00 00       	mov    $0x11,%eax
+  80033d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800340:	89 f7                	mov    %esi,%edi
+  800342:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800344:	85 c0                	test   %eax,%eax
+  800346:	7f 08                	jg     800350 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800348:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80034b:	5b                   	pop    %ebx
+  80034c:	5e                   	pop    %esi
+  80034d:	5f                   	pop    %edi
+  80034e:	5d                   	pop    %ebp
+  80034f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800350:	83 ec 0c             	sub    $0xc,%esp
+  800353:	50                   	push   %eax
+  800354:	6a 11                	push   $0x11
+  800356:	68 8a 26 80 00       	push   $0x80268a
+  80035b:	6a 23                	push   $0x23
+  80035d:	68 a7 26 80 00       	push   $0x8026a7
+  800362:	e8 9f 13 00 00       	call   801706 <_panic>
+
+00800367 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800367:	55                   	push   %ebp
+  800368:	89 e5                	mov    %esp,%ebp
+  80036a:	57                   	push   %edi
+  80036b:	56                   	push   %esi
+  80036c:	53                   	push   %ebx
+  80036d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800370:	be 00 00 00 00       	mov    $0x0,%esi
+  800375:	8b 55 08             	mov    0x8(%ebp),%edx
+  800378:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80037b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800380:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800383:	89 f7                	mov    %esi,%edi
+  800385:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800387:	85 c0                	test   %eax,%eax
+  800389:	7f 08                	jg     800393 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  80038b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80038e:	5b                   	pop    %ebx
+  80038f:	5e                   	pop    %esi
+  800390:	5f                   	pop    %edi
+  800391:	5d                   	pop    %ebp
+  800392:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800393:	83 ec 0c             	sub    $0xc,%esp
+  800396:	50                   	push   %eax
+  800397:	6a 1b                	push   $0x1b
+  800399:	68 8a 26 80 00       	push   $0x80268a
+  80039e:	6a 23                	push   $0x23
+  8003a0:	68 a7 26 80 00       	push   $0x8026a7
+  8003a5:	e8 5c 13 00 00       	call   801706 <_panic>
+
+008003aa <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  8003aa:	55                   	push   %ebp
+  8003ab:	89 e5                	mov    %esp,%ebp
+  8003ad:	57                   	push   %edi
+  8003ae:	56                   	push   %esi
+  8003af:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b5:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003ba:	89 d1                	mov    %edx,%ecx
+  8003bc:	89 d3                	mov    %edx,%ebx
+  8003be:	89 d7                	mov    %edx,%edi
+  8003c0:	89 d6                	mov    %edx,%esi
+  8003c2:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8003c4:	5b                   	pop    %ebx
+  8003c5:	5e                   	pop    %esi
+  8003c6:	5f                   	pop    %edi
+  8003c7:	5d                   	pop    %ebp
+  8003c8:	c3                   	ret
+
+008003c9 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003c9:	55                   	push   %ebp
+  8003ca:	89 e5                	mov    %esp,%ebp
+  8003cc:	57                   	push   %edi
+  8003cd:	56                   	push   %esi
+  8003ce:	53                   	push   %ebx
+  8003cf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003dd:	b8 08 00 00 00       	mov    $0x8,%eax
+  8003e2:	89 df                	mov    %ebx,%edi
+  8003e4:	89 de                	mov    %ebx,%esi
+  8003e6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003e8:	85 c0                	test   %eax,%eax
+  8003ea:	7f 08                	jg     8003f4 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ef:	5b                   	pop    %ebx
+  8003f0:	5e                   	pop    %esi
+  8003f1:	5f                   	pop    %edi
+  8003f2:	5d                   	pop    %ebp
+  8003f3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003f4:	83 ec 0c             	sub    $0xc,%esp
+  8003f7:	50                   	push   %eax
+  8003f8:	6a 08                	push   $0x8
+  8003fa:	68 8a 26 80 00       	push   $0x80268a
+  8003ff:	6a 23                	push   $0x23
+  800401:	68 a7 26 80 00       	push   $0x8026a7
+  800406:	e8 fb 12 00 00       	call   801706 <_panic>
+
+0080040b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80040b:	55                   	push   %ebp
+  80040c:	89 e5                	mov    %esp,%ebp
+  80040e:	57                   	push   %edi
+  80040f:	56                   	push   %esi
+  800410:	53                   	push   %ebx
+  800411:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800414:	6a 44                	push   $0x44
+  800416:	ff 75 0c             	push   0xc(%ebp)
+  800419:	e8 7a fc ff ff       	call   800098 <touch_mem>
+	asm volatile("int %1\n"
+  80041e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800423:	8b 55 08             	mov    0x8(%ebp),%edx
+  800426:	b8 09 00 00 00       	mov    $0x9,%eax
+  80042b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80042e:	89 df                	mov    %ebx,%edi
+  800430:	89 de                	mov    %ebx,%esi
+  800432:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800434:	83 c4 08             	add    $0x8,%esp
+  800437:	85 c0                	test   %eax,%eax
+  800439:	7f 08                	jg     800443 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80043b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80043e:	5b                   	pop    %ebx
+  80043f:	5e                   	pop    %esi
+  800440:	5f                   	pop    %edi
+  800441:	5d                   	pop    %ebp
+  800442:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800443:	83 ec 0c             	sub    $0xc,%esp
+  800446:	50                   	push   %eax
+  800447:	6a 09                	push   $0x9
+  800449:	68 8a 26 80 00       	push   $0x80268a
+  80044e:	6a 23                	push   $0x23
+  800450:	68 a7 26 80 00       	push   $0x8026a7
+  800455:	e8 ac 12 00 00       	call   801706 <_panic>
+
+0080045a <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  80045a:	55                   	push   %ebp
+  80045b:	89 e5                	mov    %esp,%ebp
+  80045d:	57                   	push   %edi
+  80045e:	56                   	push   %esi
+  80045f:	53                   	push   %ebx
+  800460:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800463:	be 00 00 00 00       	mov    $0x0,%esi
+  800468:	8b 55 08             	mov    0x8(%ebp),%edx
+  80046b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80046e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800473:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800476:	89 f7                	mov    %esi,%edi
+  800478:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80047a:	85 c0                	test   %eax,%eax
+  80047c:	7f 08                	jg     800486 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  80047e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800481:	5b                   	pop    %ebx
+  800482:	5e                   	pop    %esi
+  800483:	5f                   	pop    %edi
+  800484:	5d                   	pop    %ebp
+  800485:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800486:	83 ec 0c             	sub    $0xc,%esp
+  800489:	50                   	push   %eax
+  80048a:	6a 1a                	push   $0x1a
+  80048c:	68 8a 26 80 00       	push   $0x80268a
+  800491:	6a 23                	push   $0x23
+  800493:	68 a7 26 80 00       	push   $0x8026a7
+  800498:	e8 69 12 00 00       	call   801706 <_panic>
+
+0080049d <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  80049d:	55                   	push   %ebp
+  80049e:	89 e5                	mov    %esp,%ebp
+  8004a0:	57                   	push   %edi
+  8004a1:	56                   	push   %esi
+  8004a2:	53                   	push   %ebx
+  8004a3:	83 ec 0c             	sub    $0xc,%esp
+  8004a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8004a9:	89 d8                	mov    %ebx,%eax
+  8004ab:	c1 e0 05             	shl    $0x5,%eax
+  8004ae:	50                   	push   %eax
+  8004af:	ff 75 0c             	push   0xc(%ebp)
+  8004b2:	e8 e1 fb ff ff       	call   800098 <touch_mem>
+	asm volatile("int %1\n"
+  8004b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8004bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004bf:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004c7:	89 f7                	mov    %esi,%edi
+  8004c9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004cb:	83 c4 08             	add    $0x8,%esp
+  8004ce:	85 c0                	test   %eax,%eax
+  8004d0:	7f 08                	jg     8004da <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8004d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004d5:	5b                   	pop    %ebx
+  8004d6:	5e                   	pop    %esi
+  8004d7:	5f                   	pop    %edi
+  8004d8:	5d                   	pop    %ebp
+  8004d9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004da:	83 ec 0c             	sub    $0xc,%esp
+  8004dd:	50                   	push   %eax
+  8004de:	6a 13                	push   $0x13
+  8004e0:	68 8a 26 80 00       	push   $0x80268a
+  8004e5:	6a 23                	push   $0x23
+  8004e7:	68 a7 26 80 00       	push   $0x8026a7
+  8004ec:	e8 15 12 00 00       	call   801706 <_panic>
+
+008004f1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8004f1:	55                   	push   %ebp
+  8004f2:	89 e5                	mov    %esp,%ebp
+  8004f4:	57                   	push   %edi
+  8004f5:	56                   	push   %esi
+  8004f6:	53                   	push   %ebx
+  8004f7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8004fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800502:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800505:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80050a:	89 df                	mov    %ebx,%edi
+  80050c:	89 de                	mov    %ebx,%esi
+  80050e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800510:	85 c0                	test   %eax,%eax
+  800512:	7f 08                	jg     80051c <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800514:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800517:	5b                   	pop    %ebx
+  800518:	5e                   	pop    %esi
+  800519:	5f                   	pop    %edi
+  80051a:	5d                   	pop    %ebp
+  80051b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80051c:	83 ec 0c             	sub    $0xc,%esp
+  80051f:	50                   	push   %eax
+  800520:	6a 0a                	push   $0xa
+  800522:	68 8a 26 80 00       	push   $0x80268a
+  800527:	6a 23                	push   $0x23
+  800529:	68 a7 26 80 00       	push   $0x8026a7
+  80052e:	e8 d3 11 00 00       	call   801706 <_panic>
+
+00800533 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800533:	55                   	push   %ebp
+  800534:	89 e5                	mov    %esp,%ebp
+  800536:	57                   	push   %edi
+  800537:	56                   	push   %esi
+  800538:	53                   	push   %ebx
+  800539:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  80053c:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800542:	76 1d                	jbe    800561 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  800544:	8b 55 08             	mov    0x8(%ebp),%edx
+  800547:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80054a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80054f:	be 01 00 00 00       	mov    $0x1,%esi
+  800554:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800557:	cd 30                	int    $0x30
+}
+  800559:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80055c:	5b                   	pop    %ebx
+  80055d:	5e                   	pop    %esi
+  80055e:	5f                   	pop    %edi
+  80055f:	5d                   	pop    %ebp
+  800560:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  800561:	68 00 10 00 00       	push   $0x1000
+  800566:	53                   	push   %ebx
+  800567:	e8 2c fb ff ff       	call   800098 <touch_mem>
+  80056c:	83 c4 08             	add    $0x8,%esp
+  80056f:	eb d3                	jmp    800544 <sys_ipc_send+0x11>
+
+00800571 <sys_ipc_send_pages>:
+{
+  800571:	55                   	push   %ebp
+  800572:	89 e5                	mov    %esp,%ebp
+  800574:	57                   	push   %edi
+  800575:	56                   	push   %esi
+  800576:	53                   	push   %ebx
+  800577:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80057a:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  80057d:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800583:	76 18                	jbe    80059d <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  800585:	8b 55 08             	mov    0x8(%ebp),%edx
+  800588:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80058b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800590:	8b 7d 18             	mov    0x18(%ebp),%edi
+  800593:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  800595:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800598:	5b                   	pop    %ebx
+  800599:	5e                   	pop    %esi
+  80059a:	5f                   	pop    %edi
+  80059b:	5d                   	pop    %ebp
+  80059c:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80059d:	89 f0                	mov    %esi,%eax
+  80059f:	c1 e0 0c             	shl    $0xc,%eax
+  8005a2:	50                   	push   %eax
+  8005a3:	53                   	push   %ebx
+  8005a4:	e8 ef fa ff ff       	call   800098 <touch_mem>
+  8005a9:	83 c4 08             	add    $0x8,%esp
+  8005ac:	eb d7                	jmp    800585 <sys_ipc_send_pages+0x14>
+
+008005ae <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8005ae:	55                   	push   %ebp
+  8005af:	89 e5                	mov    %esp,%ebp
+  8005b1:	57                   	push   %edi
+  8005b2:	56                   	push   %esi
+  8005b3:	53                   	push   %ebx
+  8005b4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8005b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005c2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8005c7:	89 df                	mov    %ebx,%edi
+  8005c9:	89 de                	mov    %ebx,%esi
+  8005cb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8005cd:	85 c0                	test   %eax,%eax
+  8005cf:	7f 08                	jg     8005d9 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8005d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005d4:	5b                   	pop    %ebx
+  8005d5:	5e                   	pop    %esi
+  8005d6:	5f                   	pop    %edi
+  8005d7:	5d                   	pop    %ebp
+  8005d8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8005d9:	83 ec 0c             	sub    $0xc,%esp
+  8005dc:	50                   	push   %eax
+  8005dd:	6a 0d                	push   $0xd
+  8005df:	68 8a 26 80 00       	push   $0x80268a
+  8005e4:	6a 23                	push   $0x23
+  8005e6:	68 a7 26 80 00       	push   $0x8026a7
+  8005eb:	e8 16 11 00 00       	call   801706 <_panic>
+
+008005f0 <sys_ipc_recv>:
+{
+  8005f0:	55                   	push   %ebp
+  8005f1:	89 e5                	mov    %esp,%ebp
+  8005f3:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8005f6:	6a 01                	push   $0x1
+  8005f8:	ff 75 08             	push   0x8(%ebp)
+  8005fb:	e8 ae ff ff ff       	call   8005ae <sys_ipc_recv_pages>
+}
+  800600:	c9                   	leave
+  800601:	c3                   	ret
+
+00800602 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  800602:	55                   	push   %ebp
+  800603:	89 e5                	mov    %esp,%ebp
+  800605:	57                   	push   %edi
+  800606:	56                   	push   %esi
+  800607:	53                   	push   %ebx
+  800608:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80060b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80060e:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  800611:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800617:	77 04                	ja     80061d <sys_ipc_call+0x1b>
+  800619:	85 f6                	test   %esi,%esi
+  80061b:	75 15                	jne    800632 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  80061d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800620:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800623:	b8 14 00 00 00       	mov    $0x14,%eax
+  800628:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80062a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80062d:	5b                   	pop    %ebx
+  80062e:	5e                   	pop    %esi
+  80062f:	5f                   	pop    %edi
+  800630:	5d                   	pop    %ebp
+  800631:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  800632:	89 f8                	mov    %edi,%eax
+  800634:	c1 e0 0c             	shl    $0xc,%eax
+  800637:	50                   	push   %eax
+  800638:	53                   	push   %ebx
+  800639:	e8 5a fa ff ff       	call   800098 <touch_mem>
+  80063e:	83 c4 08             	add    $0x8,%esp
+  800641:	eb da                	jmp    80061d <sys_ipc_call+0x1b>
+
+00800643 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  800643:	55                   	push   %ebp
+  800644:	89 e5                	mov    %esp,%ebp
+  800646:	57                   	push   %edi
+  800647:	56                   	push   %esi
+  800648:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800649:	8b 55 08             	mov    0x8(%ebp),%edx
+  80064c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80064f:	b8 15 00 00 00       	mov    $0x15,%eax
+  800654:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800657:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80065a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80065d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80065f:	5b                   	pop    %ebx
+  800660:	5e                   	pop    %esi
+  800661:	5f                   	pop    %edi
+  800662:	5d                   	pop    %ebp
+  800663:	c3                   	ret
+
+00800664 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  800664:	55                   	push   %ebp
+  800665:	89 e5                	mov    %esp,%ebp
+  800667:	57                   	push   %edi
+  800668:	56                   	push   %esi
+  800669:	53                   	push   %ebx
+  80066a:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  80066d:	6a 04                	push   $0x4
+  80066f:	ff 75 08             	push   0x8(%ebp)
+  800672:	e8 21 fa ff ff       	call   800098 <touch_mem>
+	asm volatile("int %1\n"
+  800677:	be 00 00 00 00       	mov    $0x0,%esi
+  80067c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80067f:	b8 16 00 00 00       	mov    $0x16,%eax
+  800684:	8b 55 08             	mov    0x8(%ebp),%edx
+  800687:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80068a:	89 f7                	mov    %esi,%edi
+  80068c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80068e:	83 c4 08             	add    $0x8,%esp
+  800691:	85 c0                	test   %eax,%eax
+  800693:	7f 08                	jg     80069d <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  800695:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800698:	5b                   	pop    %ebx
+  800699:	5e                   	pop    %esi
+  80069a:	5f                   	pop    %edi
+  80069b:	5d                   	pop    %ebp
+  80069c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80069d:	83 ec 0c             	sub    $0xc,%esp
+  8006a0:	50                   	push   %eax
+  8006a1:	6a 16                	push   $0x16
+  8006a3:	68 8a 26 80 00       	push   $0x80268a
+  8006a8:	6a 23                	push   $0x23
+  8006aa:	68 a7 26 80 00       	push   $0x8026a7
+  8006af:	e8 52 10 00 00       	call   801706 <_panic>
+
+008006b4 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8006b4:	55                   	push   %ebp
+  8006b5:	89 e5                	mov    %esp,%ebp
+  8006b7:	57                   	push   %edi
+  8006b8:	56                   	push   %esi
+  8006b9:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8006ba:	6a 04                	push   $0x4
+  8006bc:	ff 75 08             	push   0x8(%ebp)
+  8006bf:	e8 d4 f9 ff ff       	call   800098 <touch_mem>
+	asm volatile("int %1\n"
+  8006c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006cc:	b8 17 00 00 00       	mov    $0x17,%eax
+  8006d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006d4:	89 df                	mov    %ebx,%edi
+  8006d6:	89 de                	mov    %ebx,%esi
+  8006d8:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8006da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006dd:	5b                   	pop    %ebx
+  8006de:	5e                   	pop    %esi
+  8006df:	5f                   	pop    %edi
+  8006e0:	5d                   	pop    %ebp
+  8006e1:	c3                   	ret
+
+008006e2 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8006e2:	55                   	push   %ebp
+  8006e3:	89 e5                	mov    %esp,%ebp
+  8006e5:	57                   	push   %edi
+  8006e6:	56                   	push   %esi
+  8006e7:	53                   	push   %ebx
+  8006e8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8006eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006f3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8006f8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8006fd:	89 df                	mov    %ebx,%edi
+  8006ff:	89 de                	mov    %ebx,%esi
+  800701:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800703:	85 c0                	test   %eax,%eax
+  800705:	7f 08                	jg     80070f <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  800707:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80070a:	5b                   	pop    %ebx
+  80070b:	5e                   	pop    %esi
+  80070c:	5f                   	pop    %edi
+  80070d:	5d                   	pop    %ebp
+  80070e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80070f:	83 ec 0c             	sub    $0xc,%esp
+  800712:	50                   	push   %eax
+  800713:	6a 0e                	push   $0xe
+  800715:	68 8a 26 80 00       	push   $0x80268a
+  80071a:	6a 23                	push   $0x23
+  80071c:	68 a7 26 80 00       	push   $0x8026a7
+  800721:	e8 e0 0f 00 00       	call   801706 <_panic>
+
+00800726 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800726:	55                   	push   %ebp
+  800727:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800729:	8b 45 08             	mov    0x8(%ebp),%eax
+  80072c:	05 00 00 00 30       	add    $0x30000000,%eax
+  800731:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800734:	5d                   	pop    %ebp
+  800735:	c3                   	ret
+
+00800736 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800736:	55                   	push   %ebp
+  800737:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800739:	8b 45 08             	mov    0x8(%ebp),%eax
+  80073c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800741:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800746:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80074b:	5d                   	pop    %ebp
+  80074c:	c3                   	ret
+
+0080074d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80074d:	55                   	push   %ebp
+  80074e:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  800750:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  800755:	a8 01                	test   $0x1,%al
+  800757:	74 3c                	je     800795 <fd_alloc+0x48>
+  800759:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80075e:	89 c2                	mov    %eax,%edx
+  800760:	c1 ea 0c             	shr    $0xc,%edx
+  800763:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80076a:	89 c1                	mov    %eax,%ecx
+  80076c:	05 00 10 00 00       	add    $0x1000,%eax
+  800771:	f6 c2 01             	test   $0x1,%dl
+  800774:	74 13                	je     800789 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  800776:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80077b:	75 e1                	jne    80075e <fd_alloc+0x11>
+  80077d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800782:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  800787:	eb 05                	jmp    80078e <fd_alloc+0x41>
+			return 0;
+  800789:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  80078e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800791:	89 0a                	mov    %ecx,(%edx)
+}
+  800793:	5d                   	pop    %ebp
+  800794:	c3                   	ret
+  800795:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  80079a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079f:	eb ed                	jmp    80078e <fd_alloc+0x41>
+
+008007a1 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8007a1:	55                   	push   %ebp
+  8007a2:	89 e5                	mov    %esp,%ebp
+  8007a4:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8007a7:	83 f8 1f             	cmp    $0x1f,%eax
+  8007aa:	77 30                	ja     8007dc <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8007ac:	c1 e0 0c             	shl    $0xc,%eax
+  8007af:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8007b4:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8007ba:	f6 c2 01             	test   $0x1,%dl
+  8007bd:	74 24                	je     8007e3 <fd_lookup+0x42>
+  8007bf:	89 c2                	mov    %eax,%edx
+  8007c1:	c1 ea 0c             	shr    $0xc,%edx
+  8007c4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8007cb:	f6 c2 01             	test   $0x1,%dl
+  8007ce:	74 1a                	je     8007ea <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8007d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007d3:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8007d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007da:	5d                   	pop    %ebp
+  8007db:	c3                   	ret
+		return -E_INVAL;
+  8007dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007e1:	eb f7                	jmp    8007da <fd_lookup+0x39>
+		return -E_INVAL;
+  8007e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007e8:	eb f0                	jmp    8007da <fd_lookup+0x39>
+  8007ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007ef:	eb e9                	jmp    8007da <fd_lookup+0x39>
+
+008007f1 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8007f1:	55                   	push   %ebp
+  8007f2:	89 e5                	mov    %esp,%ebp
+  8007f4:	53                   	push   %ebx
+  8007f5:	83 ec 04             	sub    $0x4,%esp
+  8007f8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8007fb:	b8 34 27 80 00       	mov    $0x802734,%eax
+  800800:	8b 18                	mov    (%eax),%ebx
+  800802:	85 db                	test   %ebx,%ebx
+  800804:	74 0e                	je     800814 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  800806:	83 c0 04             	add    $0x4,%eax
+  800809:	39 13                	cmp    %edx,(%ebx)
+  80080b:	75 f3                	jne    800800 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  80080d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800812:	eb 1f                	jmp    800833 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800814:	a1 08 40 80 00       	mov    0x804008,%eax
+  800819:	8b 40 48             	mov    0x48(%eax),%eax
+  80081c:	83 ec 04             	sub    $0x4,%esp
+  80081f:	52                   	push   %edx
+  800820:	50                   	push   %eax
+  800821:	68 b8 26 80 00       	push   $0x8026b8
+  800826:	e8 b6 0f 00 00       	call   8017e1 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80082b:	83 c4 10             	add    $0x10,%esp
+  80082e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800833:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800836:	89 1a                	mov    %ebx,(%edx)
+}
+  800838:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083b:	c9                   	leave
+  80083c:	c3                   	ret
+
+0080083d <fd_close>:
+{
+  80083d:	55                   	push   %ebp
+  80083e:	89 e5                	mov    %esp,%ebp
+  800840:	57                   	push   %edi
+  800841:	56                   	push   %esi
+  800842:	53                   	push   %ebx
+  800843:	83 ec 24             	sub    $0x24,%esp
+  800846:	8b 75 08             	mov    0x8(%ebp),%esi
+  800849:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80084c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80084f:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800850:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800856:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800859:	50                   	push   %eax
+  80085a:	e8 42 ff ff ff       	call   8007a1 <fd_lookup>
+  80085f:	89 c3                	mov    %eax,%ebx
+  800861:	83 c4 10             	add    $0x10,%esp
+  800864:	85 c0                	test   %eax,%eax
+  800866:	78 05                	js     80086d <fd_close+0x30>
+	    || fd != fd2)
+  800868:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80086b:	74 16                	je     800883 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80086d:	89 f8                	mov    %edi,%eax
+  80086f:	84 c0                	test   %al,%al
+  800871:	b8 00 00 00 00       	mov    $0x0,%eax
+  800876:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800879:	89 d8                	mov    %ebx,%eax
+  80087b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80087e:	5b                   	pop    %ebx
+  80087f:	5e                   	pop    %esi
+  800880:	5f                   	pop    %edi
+  800881:	5d                   	pop    %ebp
+  800882:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800883:	83 ec 08             	sub    $0x8,%esp
+  800886:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800889:	50                   	push   %eax
+  80088a:	ff 36                	push   (%esi)
+  80088c:	e8 60 ff ff ff       	call   8007f1 <dev_lookup>
+  800891:	89 c3                	mov    %eax,%ebx
+  800893:	83 c4 10             	add    $0x10,%esp
+  800896:	85 c0                	test   %eax,%eax
+  800898:	78 1a                	js     8008b4 <fd_close+0x77>
+		if (dev->dev_close)
+  80089a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80089d:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8008a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8008a5:	85 c0                	test   %eax,%eax
+  8008a7:	74 0b                	je     8008b4 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8008a9:	83 ec 0c             	sub    $0xc,%esp
+  8008ac:	56                   	push   %esi
+  8008ad:	ff d0                	call   *%eax
+  8008af:	89 c3                	mov    %eax,%ebx
+  8008b1:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8008b4:	83 ec 08             	sub    $0x8,%esp
+  8008b7:	56                   	push   %esi
+  8008b8:	6a 00                	push   $0x0
+  8008ba:	e8 51 f9 ff ff       	call   800210 <sys_page_unmap>
+	return r;
+  8008bf:	83 c4 10             	add    $0x10,%esp
+  8008c2:	eb b5                	jmp    800879 <fd_close+0x3c>
+
+008008c4 <close>:
+
+int
+close(int fdnum)
+{
+  8008c4:	55                   	push   %ebp
+  8008c5:	89 e5                	mov    %esp,%ebp
+  8008c7:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8008ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008cd:	50                   	push   %eax
+  8008ce:	ff 75 08             	push   0x8(%ebp)
+  8008d1:	e8 cb fe ff ff       	call   8007a1 <fd_lookup>
+  8008d6:	83 c4 10             	add    $0x10,%esp
+  8008d9:	85 c0                	test   %eax,%eax
+  8008db:	79 02                	jns    8008df <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8008dd:	c9                   	leave
+  8008de:	c3                   	ret
+		return fd_close(fd, 1);
+  8008df:	83 ec 08             	sub    $0x8,%esp
+  8008e2:	6a 01                	push   $0x1
+  8008e4:	ff 75 f4             	push   -0xc(%ebp)
+  8008e7:	e8 51 ff ff ff       	call   80083d <fd_close>
+  8008ec:	83 c4 10             	add    $0x10,%esp
+  8008ef:	eb ec                	jmp    8008dd <close+0x19>
+
+008008f1 <close_all>:
+
+void
+close_all(void)
+{
+  8008f1:	55                   	push   %ebp
+  8008f2:	89 e5                	mov    %esp,%ebp
+  8008f4:	53                   	push   %ebx
+  8008f5:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8008f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8008fd:	83 ec 0c             	sub    $0xc,%esp
+  800900:	53                   	push   %ebx
+  800901:	e8 be ff ff ff       	call   8008c4 <close>
+	for (i = 0; i < MAXFD; i++)
+  800906:	83 c3 01             	add    $0x1,%ebx
+  800909:	83 c4 10             	add    $0x10,%esp
+  80090c:	83 fb 20             	cmp    $0x20,%ebx
+  80090f:	75 ec                	jne    8008fd <close_all+0xc>
+}
+  800911:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800914:	c9                   	leave
+  800915:	c3                   	ret
+
+00800916 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800916:	55                   	push   %ebp
+  800917:	89 e5                	mov    %esp,%ebp
+  800919:	57                   	push   %edi
+  80091a:	56                   	push   %esi
+  80091b:	53                   	push   %ebx
+  80091c:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80091f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800922:	50                   	push   %eax
+  800923:	ff 75 08             	push   0x8(%ebp)
+  800926:	e8 76 fe ff ff       	call   8007a1 <fd_lookup>
+  80092b:	89 c3                	mov    %eax,%ebx
+  80092d:	83 c4 10             	add    $0x10,%esp
+  800930:	85 c0                	test   %eax,%eax
+  800932:	78 7f                	js     8009b3 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800934:	83 ec 0c             	sub    $0xc,%esp
+  800937:	ff 75 0c             	push   0xc(%ebp)
+  80093a:	e8 85 ff ff ff       	call   8008c4 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80093f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800942:	c1 e6 0c             	shl    $0xc,%esi
+  800945:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80094b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80094e:	89 3c 24             	mov    %edi,(%esp)
+  800951:	e8 e0 fd ff ff       	call   800736 <fd2data>
+  800956:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800958:	89 34 24             	mov    %esi,(%esp)
+  80095b:	e8 d6 fd ff ff       	call   800736 <fd2data>
+  800960:	83 c4 10             	add    $0x10,%esp
+  800963:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800966:	89 d8                	mov    %ebx,%eax
+  800968:	c1 e8 16             	shr    $0x16,%eax
+  80096b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800972:	a8 01                	test   $0x1,%al
+  800974:	74 11                	je     800987 <dup+0x71>
+  800976:	89 d8                	mov    %ebx,%eax
+  800978:	c1 e8 0c             	shr    $0xc,%eax
+  80097b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800982:	f6 c2 01             	test   $0x1,%dl
+  800985:	75 36                	jne    8009bd <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800987:	89 f8                	mov    %edi,%eax
+  800989:	c1 e8 0c             	shr    $0xc,%eax
+  80098c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800993:	83 ec 0c             	sub    $0xc,%esp
+  800996:	25 07 0e 00 00       	and    $0xe07,%eax
+  80099b:	50                   	push   %eax
+  80099c:	56                   	push   %esi
+  80099d:	6a 00                	push   $0x0
+  80099f:	57                   	push   %edi
+  8009a0:	6a 00                	push   $0x0
+  8009a2:	e8 27 f8 ff ff       	call   8001ce <sys_page_map>
+  8009a7:	89 c3                	mov    %eax,%ebx
+  8009a9:	83 c4 20             	add    $0x20,%esp
+  8009ac:	85 c0                	test   %eax,%eax
+  8009ae:	78 33                	js     8009e3 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8009b0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8009b3:	89 d8                	mov    %ebx,%eax
+  8009b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009b8:	5b                   	pop    %ebx
+  8009b9:	5e                   	pop    %esi
+  8009ba:	5f                   	pop    %edi
+  8009bb:	5d                   	pop    %ebp
+  8009bc:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8009bd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8009c4:	83 ec 0c             	sub    $0xc,%esp
+  8009c7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8009cc:	50                   	push   %eax
+  8009cd:	ff 75 d4             	push   -0x2c(%ebp)
+  8009d0:	6a 00                	push   $0x0
+  8009d2:	53                   	push   %ebx
+  8009d3:	6a 00                	push   $0x0
+  8009d5:	e8 f4 f7 ff ff       	call   8001ce <sys_page_map>
+  8009da:	89 c3                	mov    %eax,%ebx
+  8009dc:	83 c4 20             	add    $0x20,%esp
+  8009df:	85 c0                	test   %eax,%eax
+  8009e1:	79 a4                	jns    800987 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8009e3:	83 ec 08             	sub    $0x8,%esp
+  8009e6:	56                   	push   %esi
+  8009e7:	6a 00                	push   $0x0
+  8009e9:	e8 22 f8 ff ff       	call   800210 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8009ee:	83 c4 08             	add    $0x8,%esp
+  8009f1:	ff 75 d4             	push   -0x2c(%ebp)
+  8009f4:	6a 00                	push   $0x0
+  8009f6:	e8 15 f8 ff ff       	call   800210 <sys_page_unmap>
+	return r;
+  8009fb:	83 c4 10             	add    $0x10,%esp
+  8009fe:	eb b3                	jmp    8009b3 <dup+0x9d>
+
+00800a00 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800a00:	55                   	push   %ebp
+  800a01:	89 e5                	mov    %esp,%ebp
+  800a03:	56                   	push   %esi
+  800a04:	53                   	push   %ebx
+  800a05:	83 ec 18             	sub    $0x18,%esp
+  800a08:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a0b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a0e:	50                   	push   %eax
+  800a0f:	56                   	push   %esi
+  800a10:	e8 8c fd ff ff       	call   8007a1 <fd_lookup>
+  800a15:	83 c4 10             	add    $0x10,%esp
+  800a18:	85 c0                	test   %eax,%eax
+  800a1a:	78 3c                	js     800a58 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a1c:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a1f:	83 ec 08             	sub    $0x8,%esp
+  800a22:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a25:	50                   	push   %eax
+  800a26:	ff 33                	push   (%ebx)
+  800a28:	e8 c4 fd ff ff       	call   8007f1 <dev_lookup>
+  800a2d:	83 c4 10             	add    $0x10,%esp
+  800a30:	85 c0                	test   %eax,%eax
+  800a32:	78 24                	js     800a58 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a34:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a37:	83 e0 03             	and    $0x3,%eax
+  800a3a:	83 f8 01             	cmp    $0x1,%eax
+  800a3d:	74 20                	je     800a5f <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800a3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a42:	8b 40 08             	mov    0x8(%eax),%eax
+  800a45:	85 c0                	test   %eax,%eax
+  800a47:	74 37                	je     800a80 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800a49:	83 ec 04             	sub    $0x4,%esp
+  800a4c:	ff 75 10             	push   0x10(%ebp)
+  800a4f:	ff 75 0c             	push   0xc(%ebp)
+  800a52:	53                   	push   %ebx
+  800a53:	ff d0                	call   *%eax
+  800a55:	83 c4 10             	add    $0x10,%esp
+}
+  800a58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a5b:	5b                   	pop    %ebx
+  800a5c:	5e                   	pop    %esi
+  800a5d:	5d                   	pop    %ebp
+  800a5e:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a5f:	a1 08 40 80 00       	mov    0x804008,%eax
+  800a64:	8b 40 48             	mov    0x48(%eax),%eax
+  800a67:	83 ec 04             	sub    $0x4,%esp
+  800a6a:	56                   	push   %esi
+  800a6b:	50                   	push   %eax
+  800a6c:	68 f9 26 80 00       	push   $0x8026f9
+  800a71:	e8 6b 0d 00 00       	call   8017e1 <cprintf>
+		return -E_INVAL;
+  800a76:	83 c4 10             	add    $0x10,%esp
+  800a79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a7e:	eb d8                	jmp    800a58 <read+0x58>
+		return -E_NOT_SUPP;
+  800a80:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a85:	eb d1                	jmp    800a58 <read+0x58>
+
+00800a87 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a87:	55                   	push   %ebp
+  800a88:	89 e5                	mov    %esp,%ebp
+  800a8a:	57                   	push   %edi
+  800a8b:	56                   	push   %esi
+  800a8c:	53                   	push   %ebx
+  800a8d:	83 ec 0c             	sub    $0xc,%esp
+  800a90:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a93:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800a96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a9b:	eb 02                	jmp    800a9f <readn+0x18>
+  800a9d:	01 c3                	add    %eax,%ebx
+  800a9f:	39 f3                	cmp    %esi,%ebx
+  800aa1:	73 21                	jae    800ac4 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800aa3:	83 ec 04             	sub    $0x4,%esp
+  800aa6:	89 f0                	mov    %esi,%eax
+  800aa8:	29 d8                	sub    %ebx,%eax
+  800aaa:	50                   	push   %eax
+  800aab:	89 d8                	mov    %ebx,%eax
+  800aad:	03 45 0c             	add    0xc(%ebp),%eax
+  800ab0:	50                   	push   %eax
+  800ab1:	57                   	push   %edi
+  800ab2:	e8 49 ff ff ff       	call   800a00 <read>
+		if (m < 0)
+  800ab7:	83 c4 10             	add    $0x10,%esp
+  800aba:	85 c0                	test   %eax,%eax
+  800abc:	78 04                	js     800ac2 <readn+0x3b>
+			return m;
+		if (m == 0)
+  800abe:	75 dd                	jne    800a9d <readn+0x16>
+  800ac0:	eb 02                	jmp    800ac4 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800ac2:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800ac4:	89 d8                	mov    %ebx,%eax
+  800ac6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ac9:	5b                   	pop    %ebx
+  800aca:	5e                   	pop    %esi
+  800acb:	5f                   	pop    %edi
+  800acc:	5d                   	pop    %ebp
+  800acd:	c3                   	ret
+
+00800ace <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800ace:	55                   	push   %ebp
+  800acf:	89 e5                	mov    %esp,%ebp
+  800ad1:	56                   	push   %esi
+  800ad2:	53                   	push   %ebx
+  800ad3:	83 ec 18             	sub    $0x18,%esp
+  800ad6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800ad9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800adc:	50                   	push   %eax
+  800add:	53                   	push   %ebx
+  800ade:	e8 be fc ff ff       	call   8007a1 <fd_lookup>
+  800ae3:	83 c4 10             	add    $0x10,%esp
+  800ae6:	85 c0                	test   %eax,%eax
+  800ae8:	78 37                	js     800b21 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800aea:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800aed:	83 ec 08             	sub    $0x8,%esp
+  800af0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800af3:	50                   	push   %eax
+  800af4:	ff 36                	push   (%esi)
+  800af6:	e8 f6 fc ff ff       	call   8007f1 <dev_lookup>
+  800afb:	83 c4 10             	add    $0x10,%esp
+  800afe:	85 c0                	test   %eax,%eax
+  800b00:	78 1f                	js     800b21 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b02:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b06:	74 20                	je     800b28 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800b08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b0b:	8b 40 0c             	mov    0xc(%eax),%eax
+  800b0e:	85 c0                	test   %eax,%eax
+  800b10:	74 37                	je     800b49 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800b12:	83 ec 04             	sub    $0x4,%esp
+  800b15:	ff 75 10             	push   0x10(%ebp)
+  800b18:	ff 75 0c             	push   0xc(%ebp)
+  800b1b:	56                   	push   %esi
+  800b1c:	ff d0                	call   *%eax
+  800b1e:	83 c4 10             	add    $0x10,%esp
+}
+  800b21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b24:	5b                   	pop    %ebx
+  800b25:	5e                   	pop    %esi
+  800b26:	5d                   	pop    %ebp
+  800b27:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b28:	a1 08 40 80 00       	mov    0x804008,%eax
+  800b2d:	8b 40 48             	mov    0x48(%eax),%eax
+  800b30:	83 ec 04             	sub    $0x4,%esp
+  800b33:	53                   	push   %ebx
+  800b34:	50                   	push   %eax
+  800b35:	68 15 27 80 00       	push   $0x802715
+  800b3a:	e8 a2 0c 00 00       	call   8017e1 <cprintf>
+		return -E_INVAL;
+  800b3f:	83 c4 10             	add    $0x10,%esp
+  800b42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b47:	eb d8                	jmp    800b21 <write+0x53>
+		return -E_NOT_SUPP;
+  800b49:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b4e:	eb d1                	jmp    800b21 <write+0x53>
+
+00800b50 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b50:	55                   	push   %ebp
+  800b51:	89 e5                	mov    %esp,%ebp
+  800b53:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b56:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b59:	50                   	push   %eax
+  800b5a:	ff 75 08             	push   0x8(%ebp)
+  800b5d:	e8 3f fc ff ff       	call   8007a1 <fd_lookup>
+  800b62:	83 c4 10             	add    $0x10,%esp
+  800b65:	85 c0                	test   %eax,%eax
+  800b67:	78 0e                	js     800b77 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b69:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b6f:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800b72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b77:	c9                   	leave
+  800b78:	c3                   	ret
+
+00800b79 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b79:	55                   	push   %ebp
+  800b7a:	89 e5                	mov    %esp,%ebp
+  800b7c:	56                   	push   %esi
+  800b7d:	53                   	push   %ebx
+  800b7e:	83 ec 18             	sub    $0x18,%esp
+  800b81:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b84:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b87:	50                   	push   %eax
+  800b88:	53                   	push   %ebx
+  800b89:	e8 13 fc ff ff       	call   8007a1 <fd_lookup>
+  800b8e:	83 c4 10             	add    $0x10,%esp
+  800b91:	85 c0                	test   %eax,%eax
+  800b93:	78 34                	js     800bc9 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b95:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b98:	83 ec 08             	sub    $0x8,%esp
+  800b9b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b9e:	50                   	push   %eax
+  800b9f:	ff 36                	push   (%esi)
+  800ba1:	e8 4b fc ff ff       	call   8007f1 <dev_lookup>
+  800ba6:	83 c4 10             	add    $0x10,%esp
+  800ba9:	85 c0                	test   %eax,%eax
+  800bab:	78 1c                	js     800bc9 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bad:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800bb1:	74 1d                	je     800bd0 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800bb3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bb6:	8b 40 18             	mov    0x18(%eax),%eax
+  800bb9:	85 c0                	test   %eax,%eax
+  800bbb:	74 34                	je     800bf1 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800bbd:	83 ec 08             	sub    $0x8,%esp
+  800bc0:	ff 75 0c             	push   0xc(%ebp)
+  800bc3:	56                   	push   %esi
+  800bc4:	ff d0                	call   *%eax
+  800bc6:	83 c4 10             	add    $0x10,%esp
+}
+  800bc9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bcc:	5b                   	pop    %ebx
+  800bcd:	5e                   	pop    %esi
+  800bce:	5d                   	pop    %ebp
+  800bcf:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800bd0:	a1 08 40 80 00       	mov    0x804008,%eax
+  800bd5:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800bd8:	83 ec 04             	sub    $0x4,%esp
+  800bdb:	53                   	push   %ebx
+  800bdc:	50                   	push   %eax
+  800bdd:	68 d8 26 80 00       	push   $0x8026d8
+  800be2:	e8 fa 0b 00 00       	call   8017e1 <cprintf>
+		return -E_INVAL;
+  800be7:	83 c4 10             	add    $0x10,%esp
+  800bea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bef:	eb d8                	jmp    800bc9 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800bf1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bf6:	eb d1                	jmp    800bc9 <ftruncate+0x50>
+
+00800bf8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800bf8:	55                   	push   %ebp
+  800bf9:	89 e5                	mov    %esp,%ebp
+  800bfb:	56                   	push   %esi
+  800bfc:	53                   	push   %ebx
+  800bfd:	83 ec 18             	sub    $0x18,%esp
+  800c00:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c03:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c06:	50                   	push   %eax
+  800c07:	ff 75 08             	push   0x8(%ebp)
+  800c0a:	e8 92 fb ff ff       	call   8007a1 <fd_lookup>
+  800c0f:	83 c4 10             	add    $0x10,%esp
+  800c12:	85 c0                	test   %eax,%eax
+  800c14:	78 49                	js     800c5f <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c16:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c19:	83 ec 08             	sub    $0x8,%esp
+  800c1c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c1f:	50                   	push   %eax
+  800c20:	ff 36                	push   (%esi)
+  800c22:	e8 ca fb ff ff       	call   8007f1 <dev_lookup>
+  800c27:	83 c4 10             	add    $0x10,%esp
+  800c2a:	85 c0                	test   %eax,%eax
+  800c2c:	78 31                	js     800c5f <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c31:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c35:	74 2f                	je     800c66 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c37:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c3a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c41:	00 00 00 
+	stat->st_isdir = 0;
+  800c44:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c4b:	00 00 00 
+	stat->st_dev = dev;
+  800c4e:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c54:	83 ec 08             	sub    $0x8,%esp
+  800c57:	53                   	push   %ebx
+  800c58:	56                   	push   %esi
+  800c59:	ff 50 14             	call   *0x14(%eax)
+  800c5c:	83 c4 10             	add    $0x10,%esp
+}
+  800c5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c62:	5b                   	pop    %ebx
+  800c63:	5e                   	pop    %esi
+  800c64:	5d                   	pop    %ebp
+  800c65:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c66:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c6b:	eb f2                	jmp    800c5f <fstat+0x67>
+
+00800c6d <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c6d:	55                   	push   %ebp
+  800c6e:	89 e5                	mov    %esp,%ebp
+  800c70:	56                   	push   %esi
+  800c71:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c72:	83 ec 08             	sub    $0x8,%esp
+  800c75:	6a 00                	push   $0x0
+  800c77:	ff 75 08             	push   0x8(%ebp)
+  800c7a:	e8 bc 02 00 00       	call   800f3b <open>
+  800c7f:	89 c3                	mov    %eax,%ebx
+  800c81:	83 c4 10             	add    $0x10,%esp
+  800c84:	85 c0                	test   %eax,%eax
+  800c86:	78 1b                	js     800ca3 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c88:	83 ec 08             	sub    $0x8,%esp
+  800c8b:	ff 75 0c             	push   0xc(%ebp)
+  800c8e:	50                   	push   %eax
+  800c8f:	e8 64 ff ff ff       	call   800bf8 <fstat>
+  800c94:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c96:	89 1c 24             	mov    %ebx,(%esp)
+  800c99:	e8 26 fc ff ff       	call   8008c4 <close>
+	return r;
+  800c9e:	83 c4 10             	add    $0x10,%esp
+  800ca1:	89 f3                	mov    %esi,%ebx
+}
+  800ca3:	89 d8                	mov    %ebx,%eax
+  800ca5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ca8:	5b                   	pop    %ebx
+  800ca9:	5e                   	pop    %esi
+  800caa:	5d                   	pop    %ebp
+  800cab:	c3                   	ret
+
+00800cac <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  800cac:	55                   	push   %ebp
+  800cad:	89 e5                	mov    %esp,%ebp
+  800caf:	57                   	push   %edi
+  800cb0:	56                   	push   %esi
+  800cb1:	53                   	push   %ebx
+  800cb2:	83 ec 0c             	sub    $0xc,%esp
+  800cb5:	89 c7                	mov    %eax,%edi
+  800cb7:	89 d3                	mov    %edx,%ebx
+  800cb9:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800cbb:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800cc2:	74 2d                	je     800cf1 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cc4:	6a 07                	push   $0x7
+  800cc6:	68 00 50 80 00       	push   $0x805000
+  800ccb:	57                   	push   %edi
+  800ccc:	ff 35 00 40 80 00    	push   0x804000
+  800cd2:	e8 3f 16 00 00       	call   802316 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  800cd7:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800cde:	6a 00                	push   $0x0
+  800ce0:	56                   	push   %esi
+  800ce1:	53                   	push   %ebx
+  800ce2:	6a 00                	push   $0x0
+  800ce4:	e8 df 14 00 00       	call   8021c8 <ipc_recv_pages>
+}
+  800ce9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cec:	5b                   	pop    %ebx
+  800ced:	5e                   	pop    %esi
+  800cee:	5f                   	pop    %edi
+  800cef:	5d                   	pop    %ebp
+  800cf0:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800cf1:	83 ec 0c             	sub    $0xc,%esp
+  800cf4:	6a 01                	push   $0x1
+  800cf6:	e8 10 17 00 00       	call   80240b <ipc_find_env>
+  800cfb:	a3 00 40 80 00       	mov    %eax,0x804000
+  800d00:	83 c4 10             	add    $0x10,%esp
+  800d03:	eb bf                	jmp    800cc4 <fsipc_pages+0x18>
+
+00800d05 <fsipc>:
+{
+  800d05:	55                   	push   %ebp
+  800d06:	89 e5                	mov    %esp,%ebp
+  800d08:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  800d0b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d10:	e8 97 ff ff ff       	call   800cac <fsipc_pages>
+}
+  800d15:	c9                   	leave
+  800d16:	c3                   	ret
+
+00800d17 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d17:	55                   	push   %ebp
+  800d18:	89 e5                	mov    %esp,%ebp
+  800d1a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d20:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d23:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800d28:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d2b:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800d30:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d35:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d3a:	e8 c6 ff ff ff       	call   800d05 <fsipc>
+}
+  800d3f:	c9                   	leave
+  800d40:	c3                   	ret
+
+00800d41 <devfile_flush>:
+{
+  800d41:	55                   	push   %ebp
+  800d42:	89 e5                	mov    %esp,%ebp
+  800d44:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d47:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d4a:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d4d:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800d52:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d57:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d5c:	e8 a4 ff ff ff       	call   800d05 <fsipc>
+}
+  800d61:	c9                   	leave
+  800d62:	c3                   	ret
+
+00800d63 <devfile_stat>:
+{
+  800d63:	55                   	push   %ebp
+  800d64:	89 e5                	mov    %esp,%ebp
+  800d66:	53                   	push   %ebx
+  800d67:	83 ec 04             	sub    $0x4,%esp
+  800d6a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d70:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d73:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800d78:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d82:	e8 7e ff ff ff       	call   800d05 <fsipc>
+  800d87:	85 c0                	test   %eax,%eax
+  800d89:	78 2c                	js     800db7 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800d8b:	83 ec 08             	sub    $0x8,%esp
+  800d8e:	68 00 50 80 00       	push   $0x805000
+  800d93:	53                   	push   %ebx
+  800d94:	e8 2f 10 00 00       	call   801dc8 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800d99:	a1 80 50 80 00       	mov    0x805080,%eax
+  800d9e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800da4:	a1 84 50 80 00       	mov    0x805084,%eax
+  800da9:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800daf:	83 c4 10             	add    $0x10,%esp
+  800db2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800db7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dba:	c9                   	leave
+  800dbb:	c3                   	ret
+
+00800dbc <devfile_write>:
+{
+  800dbc:	55                   	push   %ebp
+  800dbd:	89 e5                	mov    %esp,%ebp
+  800dbf:	83 ec 0c             	sub    $0xc,%esp
+  800dc2:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800dc5:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800dca:	39 d0                	cmp    %edx,%eax
+  800dcc:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800dcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd2:	8b 52 0c             	mov    0xc(%edx),%edx
+  800dd5:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  800ddb:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800de0:	50                   	push   %eax
+  800de1:	ff 75 0c             	push   0xc(%ebp)
+  800de4:	68 08 50 80 00       	push   $0x805008
+  800de9:	e8 60 11 00 00       	call   801f4e <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800dee:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df3:	b8 04 00 00 00       	mov    $0x4,%eax
+  800df8:	e8 08 ff ff ff       	call   800d05 <fsipc>
+}
+  800dfd:	c9                   	leave
+  800dfe:	c3                   	ret
+
+00800dff <devfile_read>:
+{
+  800dff:	55                   	push   %ebp
+  800e00:	89 e5                	mov    %esp,%ebp
+  800e02:	57                   	push   %edi
+  800e03:	56                   	push   %esi
+  800e04:	53                   	push   %ebx
+  800e05:	83 ec 1c             	sub    $0x1c,%esp
+  800e08:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e0b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e0e:	89 fe                	mov    %edi,%esi
+  800e10:	c1 ee 0c             	shr    $0xc,%esi
+  800e13:	b8 20 00 00 00       	mov    $0x20,%eax
+  800e18:	39 c6                	cmp    %eax,%esi
+  800e1a:	0f 47 f0             	cmova  %eax,%esi
+  800e1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e20:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e25:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  800e28:	eb 14                	jmp    800e3e <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e2a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  800e31:	05 00 10 00 00       	add    $0x1000,%eax
+  800e36:	f6 c6 06             	test   $0x6,%dh
+  800e39:	75 42                	jne    800e7d <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e3b:	83 c1 01             	add    $0x1,%ecx
+  800e3e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800e41:	39 f1                	cmp    %esi,%ecx
+  800e43:	0f 84 95 00 00 00    	je     800ede <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e49:	89 c2                	mov    %eax,%edx
+  800e4b:	c1 ea 16             	shr    $0x16,%edx
+  800e4e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e55:	f6 c2 01             	test   $0x1,%dl
+  800e58:	74 23                	je     800e7d <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e5a:	89 c2                	mov    %eax,%edx
+  800e5c:	c1 ea 0c             	shr    $0xc,%edx
+  800e5f:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800e66:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  800e6c:	74 0f                	je     800e7d <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  800e6e:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800e75:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  800e7b:	75 ad                	jne    800e2a <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  800e7d:	85 c9                	test   %ecx,%ecx
+  800e7f:	74 11                	je     800e92 <devfile_read+0x93>
+  800e81:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  800e88:	75 08                	jne    800e92 <devfile_read+0x93>
+  800e8a:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  800e90:	74 50                	je     800ee2 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800e92:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800e95:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  800e9a:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800ea0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800eaa:	e8 56 fe ff ff       	call   800d05 <fsipc>
+  800eaf:	89 c6                	mov    %eax,%esi
+  800eb1:	85 c0                	test   %eax,%eax
+  800eb3:	78 1f                	js     800ed4 <devfile_read+0xd5>
+	assert(r <= n);
+  800eb5:	39 c7                	cmp    %eax,%edi
+  800eb7:	72 50                	jb     800f09 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  800eb9:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800ebe:	7f 62                	jg     800f22 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  800ec0:	83 ec 04             	sub    $0x4,%esp
+  800ec3:	50                   	push   %eax
+  800ec4:	68 00 50 80 00       	push   $0x805000
+  800ec9:	ff 75 0c             	push   0xc(%ebp)
+  800ecc:	e8 7d 10 00 00       	call   801f4e <memmove>
+	return r;
+  800ed1:	83 c4 10             	add    $0x10,%esp
+}
+  800ed4:	89 f0                	mov    %esi,%eax
+  800ed6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed9:	5b                   	pop    %ebx
+  800eda:	5e                   	pop    %esi
+  800edb:	5f                   	pop    %edi
+  800edc:	5d                   	pop    %ebp
+  800edd:	c3                   	ret
+  800ede:	89 f1                	mov    %esi,%ecx
+  800ee0:	eb 9b                	jmp    800e7d <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  800ee2:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800ee5:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  800eea:	89 c8                	mov    %ecx,%eax
+  800eec:	c1 e0 0c             	shl    $0xc,%eax
+  800eef:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  800ef4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ef7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800efc:	e8 ab fd ff ff       	call   800cac <fsipc_pages>
+  800f01:	89 c6                	mov    %eax,%esi
+  800f03:	85 c0                	test   %eax,%eax
+  800f05:	78 8b                	js     800e92 <devfile_read+0x93>
+  800f07:	eb cb                	jmp    800ed4 <devfile_read+0xd5>
+	assert(r <= n);
+  800f09:	68 44 27 80 00       	push   $0x802744
+  800f0e:	68 4b 27 80 00       	push   $0x80274b
+  800f13:	68 a0 00 00 00       	push   $0xa0
+  800f18:	68 60 27 80 00       	push   $0x802760
+  800f1d:	e8 e4 07 00 00       	call   801706 <_panic>
+	assert(r <= PGSIZE);
+  800f22:	68 6b 27 80 00       	push   $0x80276b
+  800f27:	68 4b 27 80 00       	push   $0x80274b
+  800f2c:	68 a1 00 00 00       	push   $0xa1
+  800f31:	68 60 27 80 00       	push   $0x802760
+  800f36:	e8 cb 07 00 00       	call   801706 <_panic>
+
+00800f3b <open>:
+{
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	56                   	push   %esi
+  800f3f:	53                   	push   %ebx
+  800f40:	83 ec 1c             	sub    $0x1c,%esp
+  800f43:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800f46:	56                   	push   %esi
+  800f47:	e8 41 0e 00 00       	call   801d8d <strlen>
+  800f4c:	83 c4 10             	add    $0x10,%esp
+  800f4f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f54:	7f 6c                	jg     800fc2 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800f56:	83 ec 0c             	sub    $0xc,%esp
+  800f59:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f5c:	50                   	push   %eax
+  800f5d:	e8 eb f7 ff ff       	call   80074d <fd_alloc>
+  800f62:	89 c3                	mov    %eax,%ebx
+  800f64:	83 c4 10             	add    $0x10,%esp
+  800f67:	85 c0                	test   %eax,%eax
+  800f69:	78 3c                	js     800fa7 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800f6b:	83 ec 08             	sub    $0x8,%esp
+  800f6e:	56                   	push   %esi
+  800f6f:	68 00 50 80 00       	push   $0x805000
+  800f74:	e8 4f 0e 00 00       	call   801dc8 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800f79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f7c:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800f81:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800f84:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f89:	e8 77 fd ff ff       	call   800d05 <fsipc>
+  800f8e:	89 c3                	mov    %eax,%ebx
+  800f90:	83 c4 10             	add    $0x10,%esp
+  800f93:	85 c0                	test   %eax,%eax
+  800f95:	78 19                	js     800fb0 <open+0x75>
+	return fd2num(fd);
+  800f97:	83 ec 0c             	sub    $0xc,%esp
+  800f9a:	ff 75 f4             	push   -0xc(%ebp)
+  800f9d:	e8 84 f7 ff ff       	call   800726 <fd2num>
+  800fa2:	89 c3                	mov    %eax,%ebx
+  800fa4:	83 c4 10             	add    $0x10,%esp
+}
+  800fa7:	89 d8                	mov    %ebx,%eax
+  800fa9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fac:	5b                   	pop    %ebx
+  800fad:	5e                   	pop    %esi
+  800fae:	5d                   	pop    %ebp
+  800faf:	c3                   	ret
+		fd_close(fd, 0);
+  800fb0:	83 ec 08             	sub    $0x8,%esp
+  800fb3:	6a 00                	push   $0x0
+  800fb5:	ff 75 f4             	push   -0xc(%ebp)
+  800fb8:	e8 80 f8 ff ff       	call   80083d <fd_close>
+		return r;
+  800fbd:	83 c4 10             	add    $0x10,%esp
+  800fc0:	eb e5                	jmp    800fa7 <open+0x6c>
+		return -E_BAD_PATH;
+  800fc2:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800fc7:	eb de                	jmp    800fa7 <open+0x6c>
+
+00800fc9 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800fc9:	55                   	push   %ebp
+  800fca:	89 e5                	mov    %esp,%ebp
+  800fcc:	53                   	push   %ebx
+  800fcd:	83 ec 10             	sub    $0x10,%esp
+  800fd0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  800fd3:	53                   	push   %ebx
+  800fd4:	e8 b4 0d 00 00       	call   801d8d <strlen>
+  800fd9:	83 c4 10             	add    $0x10,%esp
+  800fdc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800fe1:	7f 25                	jg     801008 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  800fe3:	83 ec 08             	sub    $0x8,%esp
+  800fe6:	53                   	push   %ebx
+  800fe7:	68 00 50 80 00       	push   $0x805000
+  800fec:	e8 d7 0d 00 00       	call   801dc8 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  800ff1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff6:	b8 07 00 00 00       	mov    $0x7,%eax
+  800ffb:	e8 05 fd ff ff       	call   800d05 <fsipc>
+  801000:	83 c4 10             	add    $0x10,%esp
+}
+  801003:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801006:	c9                   	leave
+  801007:	c3                   	ret
+		return -E_BAD_PATH;
+  801008:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80100d:	eb f4                	jmp    801003 <remove+0x3a>
+
+0080100f <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801015:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80101f:	e8 e1 fc ff ff       	call   800d05 <fsipc>
+}
+  801024:	c9                   	leave
+  801025:	c3                   	ret
+
+00801026 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801026:	55                   	push   %ebp
+  801027:	89 e5                	mov    %esp,%ebp
+  801029:	53                   	push   %ebx
+  80102a:	83 ec 04             	sub    $0x4,%esp
+  80102d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801030:	ba 00 00 00 00       	mov    $0x0,%edx
+  801035:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80103a:	e8 c6 fc ff ff       	call   800d05 <fsipc>
+  80103f:	85 c0                	test   %eax,%eax
+  801041:	78 3c                	js     80107f <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801043:	a1 00 50 80 00       	mov    0x805000,%eax
+  801048:	89 03                	mov    %eax,(%ebx)
+  80104a:	a1 04 50 80 00       	mov    0x805004,%eax
+  80104f:	89 43 04             	mov    %eax,0x4(%ebx)
+  801052:	a1 08 50 80 00       	mov    0x805008,%eax
+  801057:	89 43 08             	mov    %eax,0x8(%ebx)
+  80105a:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  80105f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801062:	a1 10 50 80 00       	mov    0x805010,%eax
+  801067:	89 43 10             	mov    %eax,0x10(%ebx)
+  80106a:	a1 14 50 80 00       	mov    0x805014,%eax
+  80106f:	89 43 14             	mov    %eax,0x14(%ebx)
+  801072:	a1 18 50 80 00       	mov    0x805018,%eax
+  801077:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  80107a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80107f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801082:	c9                   	leave
+  801083:	c3                   	ret
+
+00801084 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801084:	55                   	push   %ebp
+  801085:	89 e5                	mov    %esp,%ebp
+  801087:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  80108a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80108d:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  801092:	ba 00 00 00 00       	mov    $0x0,%edx
+  801097:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80109c:	e8 64 fc ff ff       	call   800d05 <fsipc>
+}
+  8010a1:	c9                   	leave
+  8010a2:	c3                   	ret
+
+008010a3 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8010a3:	55                   	push   %ebp
+  8010a4:	89 e5                	mov    %esp,%ebp
+  8010a6:	56                   	push   %esi
+  8010a7:	53                   	push   %ebx
+  8010a8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8010ab:	83 ec 0c             	sub    $0xc,%esp
+  8010ae:	ff 75 08             	push   0x8(%ebp)
+  8010b1:	e8 80 f6 ff ff       	call   800736 <fd2data>
+  8010b6:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8010b8:	83 c4 08             	add    $0x8,%esp
+  8010bb:	68 77 27 80 00       	push   $0x802777
+  8010c0:	53                   	push   %ebx
+  8010c1:	e8 02 0d 00 00       	call   801dc8 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8010c6:	8b 46 04             	mov    0x4(%esi),%eax
+  8010c9:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8010cf:	2b 0e                	sub    (%esi),%ecx
+  8010d1:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8010d6:	89 c8                	mov    %ecx,%eax
+  8010d8:	f7 e2                	mul    %edx
+  8010da:	c1 ea 0c             	shr    $0xc,%edx
+  8010dd:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8010e3:	29 d1                	sub    %edx,%ecx
+  8010e5:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8010eb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8010f2:	00 00 00 
+	stat->st_dev = &devpipe;
+  8010f5:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  8010fc:	30 80 00 
+	return 0;
+}
+  8010ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801104:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801107:	5b                   	pop    %ebx
+  801108:	5e                   	pop    %esi
+  801109:	5d                   	pop    %ebp
+  80110a:	c3                   	ret
+
+0080110b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80110b:	55                   	push   %ebp
+  80110c:	89 e5                	mov    %esp,%ebp
+  80110e:	53                   	push   %ebx
+  80110f:	83 ec 0c             	sub    $0xc,%esp
+  801112:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801115:	53                   	push   %ebx
+  801116:	6a 00                	push   $0x0
+  801118:	e8 f3 f0 ff ff       	call   800210 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80111d:	89 1c 24             	mov    %ebx,(%esp)
+  801120:	e8 11 f6 ff ff       	call   800736 <fd2data>
+  801125:	83 c4 08             	add    $0x8,%esp
+  801128:	50                   	push   %eax
+  801129:	6a 00                	push   $0x0
+  80112b:	e8 e0 f0 ff ff       	call   800210 <sys_page_unmap>
+}
+  801130:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801133:	c9                   	leave
+  801134:	c3                   	ret
+
+00801135 <_pipeisclosed>:
+{
+  801135:	55                   	push   %ebp
+  801136:	89 e5                	mov    %esp,%ebp
+  801138:	57                   	push   %edi
+  801139:	56                   	push   %esi
+  80113a:	53                   	push   %ebx
+  80113b:	83 ec 1c             	sub    $0x1c,%esp
+  80113e:	89 c7                	mov    %eax,%edi
+  801140:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801142:	a1 08 40 80 00       	mov    0x804008,%eax
+  801147:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80114a:	83 ec 0c             	sub    $0xc,%esp
+  80114d:	57                   	push   %edi
+  80114e:	e8 f7 12 00 00       	call   80244a <pageref>
+  801153:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801156:	89 34 24             	mov    %esi,(%esp)
+  801159:	e8 ec 12 00 00       	call   80244a <pageref>
+		nn = thisenv->env_runs;
+  80115e:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801164:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801167:	83 c4 10             	add    $0x10,%esp
+  80116a:	39 cb                	cmp    %ecx,%ebx
+  80116c:	74 1b                	je     801189 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80116e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801171:	75 cf                	jne    801142 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801173:	8b 42 58             	mov    0x58(%edx),%eax
+  801176:	6a 01                	push   $0x1
+  801178:	50                   	push   %eax
+  801179:	53                   	push   %ebx
+  80117a:	68 7e 27 80 00       	push   $0x80277e
+  80117f:	e8 5d 06 00 00       	call   8017e1 <cprintf>
+  801184:	83 c4 10             	add    $0x10,%esp
+  801187:	eb b9                	jmp    801142 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801189:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80118c:	0f 94 c0             	sete   %al
+  80118f:	0f b6 c0             	movzbl %al,%eax
+}
+  801192:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+
+0080119a <devpipe_read>:
+{
+  80119a:	55                   	push   %ebp
+  80119b:	89 e5                	mov    %esp,%ebp
+  80119d:	57                   	push   %edi
+  80119e:	56                   	push   %esi
+  80119f:	53                   	push   %ebx
+  8011a0:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8011a3:	ff 75 08             	push   0x8(%ebp)
+  8011a6:	e8 8b f5 ff ff       	call   800736 <fd2data>
+  8011ab:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8011ad:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8011b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8011b3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8011b6:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8011b9:	8b 0b                	mov    (%ebx),%ecx
+  8011bb:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8011c1:	29 ce                	sub    %ecx,%esi
+  8011c3:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8011c8:	f7 e6                	mul    %esi
+  8011ca:	c1 ea 0c             	shr    $0xc,%edx
+  8011cd:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8011d3:	29 c6                	sub    %eax,%esi
+  8011d5:	89 f2                	mov    %esi,%edx
+  8011d7:	75 43                	jne    80121c <devpipe_read+0x82>
+		ref = pageref(p);
+  8011d9:	83 ec 0c             	sub    $0xc,%esp
+  8011dc:	53                   	push   %ebx
+  8011dd:	e8 68 12 00 00       	call   80244a <pageref>
+  8011e2:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8011e4:	89 da                	mov    %ebx,%edx
+  8011e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011e9:	e8 47 ff ff ff       	call   801135 <_pipeisclosed>
+  8011ee:	83 c4 10             	add    $0x10,%esp
+  8011f1:	85 c0                	test   %eax,%eax
+  8011f3:	0f 85 c1 00 00 00    	jne    8012ba <devpipe_read+0x120>
+	*sleeping = 1;
+  8011f9:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801200:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801205:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801208:	75 ac                	jne    8011b6 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  80120a:	83 ec 04             	sub    $0x4,%esp
+  80120d:	56                   	push   %esi
+  80120e:	57                   	push   %edi
+  80120f:	ff 75 e4             	push   -0x1c(%ebp)
+  801212:	e8 4d f4 ff ff       	call   800664 <sys_futex_wait>
+  801217:	83 c4 10             	add    $0x10,%esp
+  80121a:	eb 9a                	jmp    8011b6 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  80121c:	39 75 10             	cmp    %esi,0x10(%ebp)
+  80121f:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801223:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801225:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80122a:	f7 e1                	mul    %ecx
+  80122c:	c1 ea 0b             	shr    $0xb,%edx
+  80122f:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801235:	29 c1                	sub    %eax,%ecx
+  801237:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801239:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80123e:	29 cf                	sub    %ecx,%edi
+  801240:	39 f7                	cmp    %esi,%edi
+  801242:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801245:	8d 43 10             	lea    0x10(%ebx),%eax
+  801248:	83 ec 04             	sub    $0x4,%esp
+  80124b:	57                   	push   %edi
+  80124c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80124f:	01 c2                	add    %eax,%edx
+  801251:	52                   	push   %edx
+  801252:	ff 75 0c             	push   0xc(%ebp)
+  801255:	e8 f4 0c 00 00       	call   801f4e <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  80125a:	83 c4 0c             	add    $0xc,%esp
+  80125d:	89 f1                	mov    %esi,%ecx
+  80125f:	29 f9                	sub    %edi,%ecx
+  801261:	51                   	push   %ecx
+  801262:	ff 75 e4             	push   -0x1c(%ebp)
+  801265:	89 f8                	mov    %edi,%eax
+  801267:	03 45 0c             	add    0xc(%ebp),%eax
+  80126a:	50                   	push   %eax
+  80126b:	e8 de 0c 00 00       	call   801f4e <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801270:	89 f1                	mov    %esi,%ecx
+  801272:	03 0b                	add    (%ebx),%ecx
+  801274:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801279:	f7 e1                	mul    %ecx
+  80127b:	c1 ea 0c             	shr    $0xc,%edx
+  80127e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801284:	29 d1                	sub    %edx,%ecx
+  801286:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801288:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80128d:	83 c4 10             	add    $0x10,%esp
+  801290:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801294:	75 0a                	jne    8012a0 <devpipe_read+0x106>
+	return n;
+  801296:	89 f0                	mov    %esi,%eax
+}
+  801298:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129b:	5b                   	pop    %ebx
+  80129c:	5e                   	pop    %esi
+  80129d:	5f                   	pop    %edi
+  80129e:	5d                   	pop    %ebp
+  80129f:	c3                   	ret
+		*sleeping = 0;
+  8012a0:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8012a7:	83 ec 08             	sub    $0x8,%esp
+  8012aa:	68 00 04 00 00       	push   $0x400
+  8012af:	53                   	push   %ebx
+  8012b0:	e8 ff f3 ff ff       	call   8006b4 <sys_futex_wake>
+  8012b5:	83 c4 10             	add    $0x10,%esp
+  8012b8:	eb dc                	jmp    801296 <devpipe_read+0xfc>
+			return 0;
+  8012ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012bf:	eb d7                	jmp    801298 <devpipe_read+0xfe>
+
+008012c1 <devpipe_write>:
+{
+  8012c1:	55                   	push   %ebp
+  8012c2:	89 e5                	mov    %esp,%ebp
+  8012c4:	57                   	push   %edi
+  8012c5:	56                   	push   %esi
+  8012c6:	53                   	push   %ebx
+  8012c7:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8012ca:	ff 75 08             	push   0x8(%ebp)
+  8012cd:	e8 64 f4 ff ff       	call   800736 <fd2data>
+  8012d2:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8012d4:	83 c4 10             	add    $0x10,%esp
+  8012d7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8012de:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8012e1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8012e4:	0f 83 23 01 00 00    	jae    80140d <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8012ea:	8b 77 04             	mov    0x4(%edi),%esi
+  8012ed:	8b 1f                	mov    (%edi),%ebx
+  8012ef:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  8012f5:	29 d9                	sub    %ebx,%ecx
+  8012f7:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8012fc:	f7 e1                	mul    %ecx
+  8012fe:	c1 ea 0c             	shr    $0xc,%edx
+  801301:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801307:	29 c1                	sub    %eax,%ecx
+  801309:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80130b:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801311:	75 40                	jne    801353 <devpipe_write+0x92>
+			ref = pageref(p);
+  801313:	83 ec 0c             	sub    $0xc,%esp
+  801316:	57                   	push   %edi
+  801317:	e8 2e 11 00 00       	call   80244a <pageref>
+  80131c:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  80131e:	89 fa                	mov    %edi,%edx
+  801320:	8b 45 08             	mov    0x8(%ebp),%eax
+  801323:	e8 0d fe ff ff       	call   801135 <_pipeisclosed>
+  801328:	83 c4 10             	add    $0x10,%esp
+  80132b:	85 c0                	test   %eax,%eax
+  80132d:	0f 85 d5 00 00 00    	jne    801408 <devpipe_write+0x147>
+	*sleeping = 1;
+  801333:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  80133a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80133f:	39 1f                	cmp    %ebx,(%edi)
+  801341:	75 a7                	jne    8012ea <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801343:	83 ec 04             	sub    $0x4,%esp
+  801346:	56                   	push   %esi
+  801347:	53                   	push   %ebx
+  801348:	57                   	push   %edi
+  801349:	e8 16 f3 ff ff       	call   800664 <sys_futex_wait>
+  80134e:	83 c4 10             	add    $0x10,%esp
+  801351:	eb 97                	jmp    8012ea <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801353:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801356:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801359:	29 c1                	sub    %eax,%ecx
+  80135b:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801360:	89 d8                	mov    %ebx,%eax
+  801362:	29 d0                	sub    %edx,%eax
+  801364:	39 c1                	cmp    %eax,%ecx
+  801366:	0f 46 c1             	cmovbe %ecx,%eax
+  801369:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  80136b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801370:	f7 e6                	mul    %esi
+  801372:	c1 ea 0b             	shr    $0xb,%edx
+  801375:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80137b:	29 c6                	sub    %eax,%esi
+  80137d:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80137f:	29 f3                	sub    %esi,%ebx
+  801381:	39 cb                	cmp    %ecx,%ebx
+  801383:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801386:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801389:	8d 77 10             	lea    0x10(%edi),%esi
+  80138c:	83 ec 04             	sub    $0x4,%esp
+  80138f:	53                   	push   %ebx
+  801390:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801393:	03 45 0c             	add    0xc(%ebp),%eax
+  801396:	50                   	push   %eax
+  801397:	01 f2                	add    %esi,%edx
+  801399:	52                   	push   %edx
+  80139a:	e8 af 0b 00 00       	call   801f4e <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80139f:	83 c4 0c             	add    $0xc,%esp
+  8013a2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013a5:	29 d8                	sub    %ebx,%eax
+  8013a7:	50                   	push   %eax
+  8013a8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8013ab:	01 d3                	add    %edx,%ebx
+  8013ad:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8013b0:	53                   	push   %ebx
+  8013b1:	56                   	push   %esi
+  8013b2:	e8 97 0b 00 00       	call   801f4e <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8013b7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8013ba:	03 4f 04             	add    0x4(%edi),%ecx
+  8013bd:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8013c2:	f7 e1                	mul    %ecx
+  8013c4:	c1 ea 0c             	shr    $0xc,%edx
+  8013c7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8013cd:	29 d1                	sub    %edx,%ecx
+  8013cf:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8013d2:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8013d7:	83 c4 10             	add    $0x10,%esp
+  8013da:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8013de:	75 0b                	jne    8013eb <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8013e0:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8013e3:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8013e6:	e9 f3 fe ff ff       	jmp    8012de <devpipe_write+0x1d>
+		*sleeping = 0;
+  8013eb:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8013f2:	83 ec 08             	sub    $0x8,%esp
+  8013f5:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  8013fa:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  8013fd:	50                   	push   %eax
+  8013fe:	e8 b1 f2 ff ff       	call   8006b4 <sys_futex_wake>
+  801403:	83 c4 10             	add    $0x10,%esp
+  801406:	eb d8                	jmp    8013e0 <devpipe_write+0x11f>
+				return 0;
+  801408:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80140d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801410:	5b                   	pop    %ebx
+  801411:	5e                   	pop    %esi
+  801412:	5f                   	pop    %edi
+  801413:	5d                   	pop    %ebp
+  801414:	c3                   	ret
+
+00801415 <pipe>:
+{
+  801415:	55                   	push   %ebp
+  801416:	89 e5                	mov    %esp,%ebp
+  801418:	56                   	push   %esi
+  801419:	53                   	push   %ebx
+  80141a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80141d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801420:	50                   	push   %eax
+  801421:	e8 27 f3 ff ff       	call   80074d <fd_alloc>
+  801426:	89 c3                	mov    %eax,%ebx
+  801428:	83 c4 10             	add    $0x10,%esp
+  80142b:	85 c0                	test   %eax,%eax
+  80142d:	0f 88 23 01 00 00    	js     801556 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801433:	83 ec 04             	sub    $0x4,%esp
+  801436:	68 07 04 00 00       	push   $0x407
+  80143b:	ff 75 f4             	push   -0xc(%ebp)
+  80143e:	6a 00                	push   $0x0
+  801440:	e8 46 ed ff ff       	call   80018b <sys_page_alloc>
+  801445:	89 c3                	mov    %eax,%ebx
+  801447:	83 c4 10             	add    $0x10,%esp
+  80144a:	85 c0                	test   %eax,%eax
+  80144c:	0f 88 04 01 00 00    	js     801556 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801452:	83 ec 0c             	sub    $0xc,%esp
+  801455:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801458:	50                   	push   %eax
+  801459:	e8 ef f2 ff ff       	call   80074d <fd_alloc>
+  80145e:	89 c3                	mov    %eax,%ebx
+  801460:	83 c4 10             	add    $0x10,%esp
+  801463:	85 c0                	test   %eax,%eax
+  801465:	0f 88 db 00 00 00    	js     801546 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80146b:	83 ec 04             	sub    $0x4,%esp
+  80146e:	68 07 04 00 00       	push   $0x407
+  801473:	ff 75 f0             	push   -0x10(%ebp)
+  801476:	6a 00                	push   $0x0
+  801478:	e8 0e ed ff ff       	call   80018b <sys_page_alloc>
+  80147d:	89 c3                	mov    %eax,%ebx
+  80147f:	83 c4 10             	add    $0x10,%esp
+  801482:	85 c0                	test   %eax,%eax
+  801484:	0f 88 bc 00 00 00    	js     801546 <pipe+0x131>
+	va = fd2data(fd0);
+  80148a:	83 ec 0c             	sub    $0xc,%esp
+  80148d:	ff 75 f4             	push   -0xc(%ebp)
+  801490:	e8 a1 f2 ff ff       	call   800736 <fd2data>
+  801495:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801497:	83 c4 0c             	add    $0xc,%esp
+  80149a:	68 07 04 00 00       	push   $0x407
+  80149f:	50                   	push   %eax
+  8014a0:	6a 00                	push   $0x0
+  8014a2:	e8 e4 ec ff ff       	call   80018b <sys_page_alloc>
+  8014a7:	89 c3                	mov    %eax,%ebx
+  8014a9:	83 c4 10             	add    $0x10,%esp
+  8014ac:	85 c0                	test   %eax,%eax
+  8014ae:	0f 88 82 00 00 00    	js     801536 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014b4:	83 ec 0c             	sub    $0xc,%esp
+  8014b7:	ff 75 f0             	push   -0x10(%ebp)
+  8014ba:	e8 77 f2 ff ff       	call   800736 <fd2data>
+  8014bf:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8014c6:	50                   	push   %eax
+  8014c7:	6a 00                	push   $0x0
+  8014c9:	56                   	push   %esi
+  8014ca:	6a 00                	push   $0x0
+  8014cc:	e8 fd ec ff ff       	call   8001ce <sys_page_map>
+  8014d1:	89 c3                	mov    %eax,%ebx
+  8014d3:	83 c4 20             	add    $0x20,%esp
+  8014d6:	85 c0                	test   %eax,%eax
+  8014d8:	78 4e                	js     801528 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8014da:	a1 20 30 80 00       	mov    0x803020,%eax
+  8014df:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014e2:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8014e4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014e7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8014ee:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8014f1:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8014f3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8014f6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8014fd:	83 ec 0c             	sub    $0xc,%esp
+  801500:	ff 75 f4             	push   -0xc(%ebp)
+  801503:	e8 1e f2 ff ff       	call   800726 <fd2num>
+  801508:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80150b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80150d:	83 c4 04             	add    $0x4,%esp
+  801510:	ff 75 f0             	push   -0x10(%ebp)
+  801513:	e8 0e f2 ff ff       	call   800726 <fd2num>
+  801518:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80151b:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80151e:	83 c4 10             	add    $0x10,%esp
+  801521:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801526:	eb 2e                	jmp    801556 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801528:	83 ec 08             	sub    $0x8,%esp
+  80152b:	56                   	push   %esi
+  80152c:	6a 00                	push   $0x0
+  80152e:	e8 dd ec ff ff       	call   800210 <sys_page_unmap>
+  801533:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801536:	83 ec 08             	sub    $0x8,%esp
+  801539:	ff 75 f0             	push   -0x10(%ebp)
+  80153c:	6a 00                	push   $0x0
+  80153e:	e8 cd ec ff ff       	call   800210 <sys_page_unmap>
+  801543:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801546:	83 ec 08             	sub    $0x8,%esp
+  801549:	ff 75 f4             	push   -0xc(%ebp)
+  80154c:	6a 00                	push   $0x0
+  80154e:	e8 bd ec ff ff       	call   800210 <sys_page_unmap>
+  801553:	83 c4 10             	add    $0x10,%esp
+}
+  801556:	89 d8                	mov    %ebx,%eax
+  801558:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80155b:	5b                   	pop    %ebx
+  80155c:	5e                   	pop    %esi
+  80155d:	5d                   	pop    %ebp
+  80155e:	c3                   	ret
+
+0080155f <pipeisclosed>:
+{
+  80155f:	55                   	push   %ebp
+  801560:	89 e5                	mov    %esp,%ebp
+  801562:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801565:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801568:	50                   	push   %eax
+  801569:	ff 75 08             	push   0x8(%ebp)
+  80156c:	e8 30 f2 ff ff       	call   8007a1 <fd_lookup>
+  801571:	83 c4 10             	add    $0x10,%esp
+  801574:	85 c0                	test   %eax,%eax
+  801576:	78 18                	js     801590 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801578:	83 ec 0c             	sub    $0xc,%esp
+  80157b:	ff 75 f4             	push   -0xc(%ebp)
+  80157e:	e8 b3 f1 ff ff       	call   800736 <fd2data>
+  801583:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801585:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801588:	e8 a8 fb ff ff       	call   801135 <_pipeisclosed>
+  80158d:	83 c4 10             	add    $0x10,%esp
+}
+  801590:	c9                   	leave
+  801591:	c3                   	ret
+
+00801592 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801592:	b8 00 00 00 00       	mov    $0x0,%eax
+  801597:	c3                   	ret
+
+00801598 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801598:	55                   	push   %ebp
+  801599:	89 e5                	mov    %esp,%ebp
+  80159b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80159e:	68 96 27 80 00       	push   $0x802796
+  8015a3:	ff 75 0c             	push   0xc(%ebp)
+  8015a6:	e8 1d 08 00 00       	call   801dc8 <strcpy>
+	return 0;
+}
+  8015ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b0:	c9                   	leave
+  8015b1:	c3                   	ret
+
+008015b2 <devcons_write>:
+{
+  8015b2:	55                   	push   %ebp
+  8015b3:	89 e5                	mov    %esp,%ebp
+  8015b5:	57                   	push   %edi
+  8015b6:	56                   	push   %esi
+  8015b7:	53                   	push   %ebx
+  8015b8:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8015be:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8015c3:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8015c9:	eb 2e                	jmp    8015f9 <devcons_write+0x47>
+		m = n - tot;
+  8015cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ce:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8015d0:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8015d5:	39 c3                	cmp    %eax,%ebx
+  8015d7:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8015da:	83 ec 04             	sub    $0x4,%esp
+  8015dd:	53                   	push   %ebx
+  8015de:	89 f0                	mov    %esi,%eax
+  8015e0:	03 45 0c             	add    0xc(%ebp),%eax
+  8015e3:	50                   	push   %eax
+  8015e4:	57                   	push   %edi
+  8015e5:	e8 64 09 00 00       	call   801f4e <memmove>
+		sys_cputs(buf, m);
+  8015ea:	83 c4 08             	add    $0x8,%esp
+  8015ed:	53                   	push   %ebx
+  8015ee:	57                   	push   %edi
+  8015ef:	e8 ca ea ff ff       	call   8000be <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8015f4:	01 de                	add    %ebx,%esi
+  8015f6:	83 c4 10             	add    $0x10,%esp
+  8015f9:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8015fc:	72 cd                	jb     8015cb <devcons_write+0x19>
+}
+  8015fe:	89 f0                	mov    %esi,%eax
+  801600:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801603:	5b                   	pop    %ebx
+  801604:	5e                   	pop    %esi
+  801605:	5f                   	pop    %edi
+  801606:	5d                   	pop    %ebp
+  801607:	c3                   	ret
+
+00801608 <devcons_read>:
+{
+  801608:	55                   	push   %ebp
+  801609:	89 e5                	mov    %esp,%ebp
+  80160b:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80160e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801613:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801617:	75 07                	jne    801620 <devcons_read+0x18>
+  801619:	eb 1f                	jmp    80163a <devcons_read+0x32>
+		sys_yield();
+  80161b:	e8 4c eb ff ff       	call   80016c <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801620:	e8 c8 ea ff ff       	call   8000ed <sys_cgetc>
+  801625:	85 c0                	test   %eax,%eax
+  801627:	74 f2                	je     80161b <devcons_read+0x13>
+	if (c < 0)
+  801629:	78 0f                	js     80163a <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80162b:	83 f8 04             	cmp    $0x4,%eax
+  80162e:	74 0c                	je     80163c <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801630:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801633:	88 02                	mov    %al,(%edx)
+	return 1;
+  801635:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80163a:	c9                   	leave
+  80163b:	c3                   	ret
+		return 0;
+  80163c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801641:	eb f7                	jmp    80163a <devcons_read+0x32>
+
+00801643 <cputchar>:
+{
+  801643:	55                   	push   %ebp
+  801644:	89 e5                	mov    %esp,%ebp
+  801646:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801649:	8b 45 08             	mov    0x8(%ebp),%eax
+  80164c:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80164f:	6a 01                	push   $0x1
+  801651:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801654:	50                   	push   %eax
+  801655:	e8 64 ea ff ff       	call   8000be <sys_cputs>
+}
+  80165a:	83 c4 10             	add    $0x10,%esp
+  80165d:	c9                   	leave
+  80165e:	c3                   	ret
+
+0080165f <getchar>:
+{
+  80165f:	55                   	push   %ebp
+  801660:	89 e5                	mov    %esp,%ebp
+  801662:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801665:	6a 01                	push   $0x1
+  801667:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80166a:	50                   	push   %eax
+  80166b:	6a 00                	push   $0x0
+  80166d:	e8 8e f3 ff ff       	call   800a00 <read>
+	if (r < 0)
+  801672:	83 c4 10             	add    $0x10,%esp
+  801675:	85 c0                	test   %eax,%eax
+  801677:	78 06                	js     80167f <getchar+0x20>
+	if (r < 1)
+  801679:	74 06                	je     801681 <getchar+0x22>
+	return c;
+  80167b:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80167f:	c9                   	leave
+  801680:	c3                   	ret
+		return -E_EOF;
+  801681:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801686:	eb f7                	jmp    80167f <getchar+0x20>
+
+00801688 <iscons>:
+{
+  801688:	55                   	push   %ebp
+  801689:	89 e5                	mov    %esp,%ebp
+  80168b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80168e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801691:	50                   	push   %eax
+  801692:	ff 75 08             	push   0x8(%ebp)
+  801695:	e8 07 f1 ff ff       	call   8007a1 <fd_lookup>
+  80169a:	83 c4 10             	add    $0x10,%esp
+  80169d:	85 c0                	test   %eax,%eax
+  80169f:	78 11                	js     8016b2 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8016a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016a4:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  8016aa:	39 10                	cmp    %edx,(%eax)
+  8016ac:	0f 94 c0             	sete   %al
+  8016af:	0f b6 c0             	movzbl %al,%eax
+}
+  8016b2:	c9                   	leave
+  8016b3:	c3                   	ret
+
+008016b4 <opencons>:
+{
+  8016b4:	55                   	push   %ebp
+  8016b5:	89 e5                	mov    %esp,%ebp
+  8016b7:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8016ba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016bd:	50                   	push   %eax
+  8016be:	e8 8a f0 ff ff       	call   80074d <fd_alloc>
+  8016c3:	83 c4 10             	add    $0x10,%esp
+  8016c6:	85 c0                	test   %eax,%eax
+  8016c8:	78 3a                	js     801704 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8016ca:	83 ec 04             	sub    $0x4,%esp
+  8016cd:	68 07 04 00 00       	push   $0x407
+  8016d2:	ff 75 f4             	push   -0xc(%ebp)
+  8016d5:	6a 00                	push   $0x0
+  8016d7:	e8 af ea ff ff       	call   80018b <sys_page_alloc>
+  8016dc:	83 c4 10             	add    $0x10,%esp
+  8016df:	85 c0                	test   %eax,%eax
+  8016e1:	78 21                	js     801704 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8016e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e6:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  8016ec:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8016ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8016f8:	83 ec 0c             	sub    $0xc,%esp
+  8016fb:	50                   	push   %eax
+  8016fc:	e8 25 f0 ff ff       	call   800726 <fd2num>
+  801701:	83 c4 10             	add    $0x10,%esp
+}
+  801704:	c9                   	leave
+  801705:	c3                   	ret
+
+00801706 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801706:	55                   	push   %ebp
+  801707:	89 e5                	mov    %esp,%ebp
+  801709:	56                   	push   %esi
+  80170a:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80170b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80170e:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801714:	e8 34 ea ff ff       	call   80014d <sys_getenvid>
+  801719:	83 ec 0c             	sub    $0xc,%esp
+  80171c:	ff 75 0c             	push   0xc(%ebp)
+  80171f:	ff 75 08             	push   0x8(%ebp)
+  801722:	56                   	push   %esi
+  801723:	50                   	push   %eax
+  801724:	68 a4 27 80 00       	push   $0x8027a4
+  801729:	e8 b3 00 00 00       	call   8017e1 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80172e:	83 c4 18             	add    $0x18,%esp
+  801731:	53                   	push   %ebx
+  801732:	ff 75 10             	push   0x10(%ebp)
+  801735:	e8 56 00 00 00       	call   801790 <vcprintf>
+	cprintf("\n");
+  80173a:	c7 04 24 8f 27 80 00 	movl   $0x80278f,(%esp)
+  801741:	e8 9b 00 00 00       	call   8017e1 <cprintf>
+  801746:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801749:	cc                   	int3
+	while (1)
+  80174a:	eb fd                	jmp    801749 <_panic+0x43>
+
+0080174c <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80174c:	55                   	push   %ebp
+  80174d:	89 e5                	mov    %esp,%ebp
+  80174f:	53                   	push   %ebx
+  801750:	83 ec 04             	sub    $0x4,%esp
+  801753:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801756:	8b 13                	mov    (%ebx),%edx
+  801758:	8d 42 01             	lea    0x1(%edx),%eax
+  80175b:	89 03                	mov    %eax,(%ebx)
+  80175d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801760:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801764:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801769:	74 09                	je     801774 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80176b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80176f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801772:	c9                   	leave
+  801773:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  801774:	83 ec 08             	sub    $0x8,%esp
+  801777:	68 ff 00 00 00       	push   $0xff
+  80177c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80177f:	50                   	push   %eax
+  801780:	e8 39 e9 ff ff       	call   8000be <sys_cputs>
+		b->idx = 0;
+  801785:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80178b:	83 c4 10             	add    $0x10,%esp
+  80178e:	eb db                	jmp    80176b <putch+0x1f>
+
+00801790 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  801790:	55                   	push   %ebp
+  801791:	89 e5                	mov    %esp,%ebp
+  801793:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  801799:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017a0:	00 00 00 
+	b.cnt = 0;
+  8017a3:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8017aa:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8017ad:	ff 75 0c             	push   0xc(%ebp)
+  8017b0:	ff 75 08             	push   0x8(%ebp)
+  8017b3:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8017b9:	50                   	push   %eax
+  8017ba:	68 4c 17 80 00       	push   $0x80174c
+  8017bf:	e8 14 01 00 00       	call   8018d8 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8017c4:	83 c4 08             	add    $0x8,%esp
+  8017c7:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8017cd:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8017d3:	50                   	push   %eax
+  8017d4:	e8 e5 e8 ff ff       	call   8000be <sys_cputs>
+
+	return b.cnt;
+}
+  8017d9:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8017df:	c9                   	leave
+  8017e0:	c3                   	ret
+
+008017e1 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8017e1:	55                   	push   %ebp
+  8017e2:	89 e5                	mov    %esp,%ebp
+  8017e4:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8017e7:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8017ea:	50                   	push   %eax
+  8017eb:	ff 75 08             	push   0x8(%ebp)
+  8017ee:	e8 9d ff ff ff       	call   801790 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8017f3:	c9                   	leave
+  8017f4:	c3                   	ret
+
+008017f5 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8017f5:	55                   	push   %ebp
+  8017f6:	89 e5                	mov    %esp,%ebp
+  8017f8:	57                   	push   %edi
+  8017f9:	56                   	push   %esi
+  8017fa:	53                   	push   %ebx
+  8017fb:	83 ec 1c             	sub    $0x1c,%esp
+  8017fe:	89 c7                	mov    %eax,%edi
+  801800:	89 d6                	mov    %edx,%esi
+  801802:	8b 45 08             	mov    0x8(%ebp),%eax
+  801805:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801808:	89 d1                	mov    %edx,%ecx
+  80180a:	89 c2                	mov    %eax,%edx
+  80180c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80180f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801812:	8b 45 10             	mov    0x10(%ebp),%eax
+  801815:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801818:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80181b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801822:	39 c2                	cmp    %eax,%edx
+  801824:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801827:	72 3e                	jb     801867 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801829:	83 ec 0c             	sub    $0xc,%esp
+  80182c:	ff 75 18             	push   0x18(%ebp)
+  80182f:	83 eb 01             	sub    $0x1,%ebx
+  801832:	53                   	push   %ebx
+  801833:	50                   	push   %eax
+  801834:	83 ec 08             	sub    $0x8,%esp
+  801837:	ff 75 e4             	push   -0x1c(%ebp)
+  80183a:	ff 75 e0             	push   -0x20(%ebp)
+  80183d:	ff 75 dc             	push   -0x24(%ebp)
+  801840:	ff 75 d8             	push   -0x28(%ebp)
+  801843:	e8 0f 0d 00 00       	call   802557 <__udivdi3>
+  801848:	83 c4 18             	add    $0x18,%esp
+  80184b:	52                   	push   %edx
+  80184c:	50                   	push   %eax
+  80184d:	89 f2                	mov    %esi,%edx
+  80184f:	89 f8                	mov    %edi,%eax
+  801851:	e8 9f ff ff ff       	call   8017f5 <printnum>
+  801856:	83 c4 20             	add    $0x20,%esp
+  801859:	eb 13                	jmp    80186e <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80185b:	83 ec 08             	sub    $0x8,%esp
+  80185e:	56                   	push   %esi
+  80185f:	ff 75 18             	push   0x18(%ebp)
+  801862:	ff d7                	call   *%edi
+  801864:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801867:	83 eb 01             	sub    $0x1,%ebx
+  80186a:	85 db                	test   %ebx,%ebx
+  80186c:	7f ed                	jg     80185b <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80186e:	83 ec 08             	sub    $0x8,%esp
+  801871:	56                   	push   %esi
+  801872:	83 ec 04             	sub    $0x4,%esp
+  801875:	ff 75 e4             	push   -0x1c(%ebp)
+  801878:	ff 75 e0             	push   -0x20(%ebp)
+  80187b:	ff 75 dc             	push   -0x24(%ebp)
+  80187e:	ff 75 d8             	push   -0x28(%ebp)
+  801881:	e8 ef 0c 00 00       	call   802575 <__umoddi3>
+  801886:	83 c4 14             	add    $0x14,%esp
+  801889:	0f be 80 c7 27 80 00 	movsbl 0x8027c7(%eax),%eax
+  801890:	50                   	push   %eax
+  801891:	ff d7                	call   *%edi
+}
+  801893:	83 c4 10             	add    $0x10,%esp
+  801896:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801899:	5b                   	pop    %ebx
+  80189a:	5e                   	pop    %esi
+  80189b:	5f                   	pop    %edi
+  80189c:	5d                   	pop    %ebp
+  80189d:	c3                   	ret
+
+0080189e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80189e:	55                   	push   %ebp
+  80189f:	89 e5                	mov    %esp,%ebp
+  8018a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8018a4:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8018a8:	8b 10                	mov    (%eax),%edx
+  8018aa:	3b 50 04             	cmp    0x4(%eax),%edx
+  8018ad:	73 0a                	jae    8018b9 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8018af:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8018b2:	89 08                	mov    %ecx,(%eax)
+  8018b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b7:	88 02                	mov    %al,(%edx)
+}
+  8018b9:	5d                   	pop    %ebp
+  8018ba:	c3                   	ret
+
+008018bb <printfmt>:
+{
+  8018bb:	55                   	push   %ebp
+  8018bc:	89 e5                	mov    %esp,%ebp
+  8018be:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8018c1:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8018c4:	50                   	push   %eax
+  8018c5:	ff 75 10             	push   0x10(%ebp)
+  8018c8:	ff 75 0c             	push   0xc(%ebp)
+  8018cb:	ff 75 08             	push   0x8(%ebp)
+  8018ce:	e8 05 00 00 00       	call   8018d8 <vprintfmt>
+}
+  8018d3:	83 c4 10             	add    $0x10,%esp
+  8018d6:	c9                   	leave
+  8018d7:	c3                   	ret
+
+008018d8 <vprintfmt>:
+{
+  8018d8:	55                   	push   %ebp
+  8018d9:	89 e5                	mov    %esp,%ebp
+  8018db:	57                   	push   %edi
+  8018dc:	56                   	push   %esi
+  8018dd:	53                   	push   %ebx
+  8018de:	83 ec 2c             	sub    $0x2c,%esp
+  8018e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8018e7:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8018ea:	eb 0a                	jmp    8018f6 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8018ec:	83 ec 08             	sub    $0x8,%esp
+  8018ef:	53                   	push   %ebx
+  8018f0:	50                   	push   %eax
+  8018f1:	ff d6                	call   *%esi
+  8018f3:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8018f6:	83 c7 01             	add    $0x1,%edi
+  8018f9:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8018fd:	83 f8 25             	cmp    $0x25,%eax
+  801900:	74 0c                	je     80190e <vprintfmt+0x36>
+			if (ch == '\0')
+  801902:	85 c0                	test   %eax,%eax
+  801904:	75 e6                	jne    8018ec <vprintfmt+0x14>
+}
+  801906:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801909:	5b                   	pop    %ebx
+  80190a:	5e                   	pop    %esi
+  80190b:	5f                   	pop    %edi
+  80190c:	5d                   	pop    %ebp
+  80190d:	c3                   	ret
+		padc = ' ';
+  80190e:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801912:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801919:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801920:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801927:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80192c:	8d 47 01             	lea    0x1(%edi),%eax
+  80192f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801932:	0f b6 17             	movzbl (%edi),%edx
+  801935:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801938:	3c 55                	cmp    $0x55,%al
+  80193a:	0f 87 c5 03 00 00    	ja     801d05 <vprintfmt+0x42d>
+  801940:	0f b6 c0             	movzbl %al,%eax
+  801943:	ff 24 85 40 29 80 00 	jmp    *0x802940(,%eax,4)
+  80194a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80194d:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801951:	eb d9                	jmp    80192c <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801953:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801956:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80195a:	eb d0                	jmp    80192c <vprintfmt+0x54>
+  80195c:	0f b6 d2             	movzbl %dl,%edx
+  80195f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801962:	b8 00 00 00 00       	mov    $0x0,%eax
+  801967:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80196a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80196d:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801971:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801974:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801977:	83 f9 09             	cmp    $0x9,%ecx
+  80197a:	77 55                	ja     8019d1 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80197c:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80197f:	eb e9                	jmp    80196a <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801981:	8b 45 14             	mov    0x14(%ebp),%eax
+  801984:	8b 00                	mov    (%eax),%eax
+  801986:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801989:	8b 45 14             	mov    0x14(%ebp),%eax
+  80198c:	8d 40 04             	lea    0x4(%eax),%eax
+  80198f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801992:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801995:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801999:	79 91                	jns    80192c <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80199b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80199e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019a1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8019a8:	eb 82                	jmp    80192c <vprintfmt+0x54>
+			if (width < 0)
+  8019aa:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8019ad:	85 d2                	test   %edx,%edx
+  8019af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b4:	0f 49 c2             	cmovns %edx,%eax
+  8019b7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019ba:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019bd:	e9 6a ff ff ff       	jmp    80192c <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8019c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8019c5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8019cc:	e9 5b ff ff ff       	jmp    80192c <vprintfmt+0x54>
+  8019d1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019d4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019d7:	eb bc                	jmp    801995 <vprintfmt+0xbd>
+			lflag++;
+  8019d9:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8019dc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019df:	e9 48 ff ff ff       	jmp    80192c <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8019e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019e7:	8d 78 04             	lea    0x4(%eax),%edi
+  8019ea:	83 ec 08             	sub    $0x8,%esp
+  8019ed:	53                   	push   %ebx
+  8019ee:	ff 30                	push   (%eax)
+  8019f0:	ff d6                	call   *%esi
+			break;
+  8019f2:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8019f5:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8019f8:	e9 63 02 00 00       	jmp    801c60 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8019fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a00:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801a03:	8b 10                	mov    (%eax),%edx
+  801a05:	89 d0                	mov    %edx,%eax
+  801a07:	f7 d8                	neg    %eax
+  801a09:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801a0c:	83 f8 12             	cmp    $0x12,%eax
+  801a0f:	7f 23                	jg     801a34 <vprintfmt+0x15c>
+  801a11:	8b 14 85 a0 2a 80 00 	mov    0x802aa0(,%eax,4),%edx
+  801a18:	85 d2                	test   %edx,%edx
+  801a1a:	74 18                	je     801a34 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801a1c:	52                   	push   %edx
+  801a1d:	68 5d 27 80 00       	push   $0x80275d
+  801a22:	53                   	push   %ebx
+  801a23:	56                   	push   %esi
+  801a24:	e8 92 fe ff ff       	call   8018bb <printfmt>
+  801a29:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a2c:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801a2f:	e9 2c 02 00 00       	jmp    801c60 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  801a34:	50                   	push   %eax
+  801a35:	68 df 27 80 00       	push   $0x8027df
+  801a3a:	53                   	push   %ebx
+  801a3b:	56                   	push   %esi
+  801a3c:	e8 7a fe ff ff       	call   8018bb <printfmt>
+  801a41:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a44:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801a47:	e9 14 02 00 00       	jmp    801c60 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801a4c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a4f:	83 c0 04             	add    $0x4,%eax
+  801a52:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801a55:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a58:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801a5a:	85 c9                	test   %ecx,%ecx
+  801a5c:	b8 d8 27 80 00       	mov    $0x8027d8,%eax
+  801a61:	0f 45 c1             	cmovne %ecx,%eax
+  801a64:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801a67:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801a6b:	7e 06                	jle    801a73 <vprintfmt+0x19b>
+  801a6d:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801a71:	75 0b                	jne    801a7e <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801a73:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801a76:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801a79:	89 75 08             	mov    %esi,0x8(%ebp)
+  801a7c:	eb 5c                	jmp    801ada <vprintfmt+0x202>
+  801a7e:	83 ec 08             	sub    $0x8,%esp
+  801a81:	ff 75 d0             	push   -0x30(%ebp)
+  801a84:	ff 75 cc             	push   -0x34(%ebp)
+  801a87:	e8 19 03 00 00       	call   801da5 <strnlen>
+  801a8c:	89 c2                	mov    %eax,%edx
+  801a8e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a91:	29 d0                	sub    %edx,%eax
+  801a93:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801a96:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801a9a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801a9d:	89 75 08             	mov    %esi,0x8(%ebp)
+  801aa0:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801aa2:	eb 0e                	jmp    801ab2 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801aa4:	83 ec 08             	sub    $0x8,%esp
+  801aa7:	53                   	push   %ebx
+  801aa8:	57                   	push   %edi
+  801aa9:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801aac:	83 ee 01             	sub    $0x1,%esi
+  801aaf:	83 c4 10             	add    $0x10,%esp
+  801ab2:	85 f6                	test   %esi,%esi
+  801ab4:	7f ee                	jg     801aa4 <vprintfmt+0x1cc>
+  801ab6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ab9:	8b 75 08             	mov    0x8(%ebp),%esi
+  801abc:	85 c0                	test   %eax,%eax
+  801abe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac3:	0f 49 d0             	cmovns %eax,%edx
+  801ac6:	29 d0                	sub    %edx,%eax
+  801ac8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801acb:	eb a6                	jmp    801a73 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801acd:	83 ec 08             	sub    $0x8,%esp
+  801ad0:	53                   	push   %ebx
+  801ad1:	52                   	push   %edx
+  801ad2:	ff 55 08             	call   *0x8(%ebp)
+  801ad5:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801ad8:	89 f1                	mov    %esi,%ecx
+  801ada:	8d 71 01             	lea    0x1(%ecx),%esi
+  801add:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801ae1:	0f be d0             	movsbl %al,%edx
+  801ae4:	85 d2                	test   %edx,%edx
+  801ae6:	74 28                	je     801b10 <vprintfmt+0x238>
+  801ae8:	85 ff                	test   %edi,%edi
+  801aea:	78 05                	js     801af1 <vprintfmt+0x219>
+  801aec:	83 ef 01             	sub    $0x1,%edi
+  801aef:	78 30                	js     801b21 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801af1:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801af5:	74 d6                	je     801acd <vprintfmt+0x1f5>
+  801af7:	0f be c0             	movsbl %al,%eax
+  801afa:	83 e8 20             	sub    $0x20,%eax
+  801afd:	83 f8 5e             	cmp    $0x5e,%eax
+  801b00:	76 cb                	jbe    801acd <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801b02:	83 ec 08             	sub    $0x8,%esp
+  801b05:	53                   	push   %ebx
+  801b06:	6a 3f                	push   $0x3f
+  801b08:	ff 55 08             	call   *0x8(%ebp)
+  801b0b:	83 c4 10             	add    $0x10,%esp
+  801b0e:	eb c8                	jmp    801ad8 <vprintfmt+0x200>
+  801b10:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b13:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b16:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801b19:	01 d0                	add    %edx,%eax
+  801b1b:	29 c8                	sub    %ecx,%eax
+  801b1d:	89 c7                	mov    %eax,%edi
+  801b1f:	eb 13                	jmp    801b34 <vprintfmt+0x25c>
+  801b21:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b24:	eb ed                	jmp    801b13 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801b26:	83 ec 08             	sub    $0x8,%esp
+  801b29:	53                   	push   %ebx
+  801b2a:	6a 20                	push   $0x20
+  801b2c:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801b2e:	83 ef 01             	sub    $0x1,%edi
+  801b31:	83 c4 10             	add    $0x10,%esp
+  801b34:	85 ff                	test   %edi,%edi
+  801b36:	7f ee                	jg     801b26 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801b38:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b3b:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b3e:	e9 1d 01 00 00       	jmp    801c60 <vprintfmt+0x388>
+	if (lflag >= 2)
+  801b43:	83 f9 01             	cmp    $0x1,%ecx
+  801b46:	7f 1b                	jg     801b63 <vprintfmt+0x28b>
+	else if (lflag)
+  801b48:	85 c9                	test   %ecx,%ecx
+  801b4a:	74 63                	je     801baf <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  801b4c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b4f:	8b 00                	mov    (%eax),%eax
+  801b51:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b54:	99                   	cltd
+  801b55:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b58:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b5b:	8d 40 04             	lea    0x4(%eax),%eax
+  801b5e:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b61:	eb 17                	jmp    801b7a <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  801b63:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b66:	8b 50 04             	mov    0x4(%eax),%edx
+  801b69:	8b 00                	mov    (%eax),%eax
+  801b6b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b6e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b71:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b74:	8d 40 08             	lea    0x8(%eax),%eax
+  801b77:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801b7a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b7d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801b80:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801b85:	85 c9                	test   %ecx,%ecx
+  801b87:	0f 89 b9 00 00 00    	jns    801c46 <vprintfmt+0x36e>
+				putch('-', putdat);
+  801b8d:	83 ec 08             	sub    $0x8,%esp
+  801b90:	53                   	push   %ebx
+  801b91:	6a 2d                	push   $0x2d
+  801b93:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801b95:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b98:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801b9b:	f7 da                	neg    %edx
+  801b9d:	83 d1 00             	adc    $0x0,%ecx
+  801ba0:	f7 d9                	neg    %ecx
+  801ba2:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801ba5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801baa:	e9 97 00 00 00       	jmp    801c46 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  801baf:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bb2:	8b 00                	mov    (%eax),%eax
+  801bb4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bb7:	99                   	cltd
+  801bb8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801bbb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bbe:	8d 40 04             	lea    0x4(%eax),%eax
+  801bc1:	89 45 14             	mov    %eax,0x14(%ebp)
+  801bc4:	eb b4                	jmp    801b7a <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  801bc6:	83 f9 01             	cmp    $0x1,%ecx
+  801bc9:	7f 1b                	jg     801be6 <vprintfmt+0x30e>
+	else if (lflag)
+  801bcb:	85 c9                	test   %ecx,%ecx
+  801bcd:	74 2c                	je     801bfb <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  801bcf:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bd2:	8b 10                	mov    (%eax),%edx
+  801bd4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bd9:	8d 40 04             	lea    0x4(%eax),%eax
+  801bdc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801bdf:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801be4:	eb 60                	jmp    801c46 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801be6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801be9:	8b 10                	mov    (%eax),%edx
+  801beb:	8b 48 04             	mov    0x4(%eax),%ecx
+  801bee:	8d 40 08             	lea    0x8(%eax),%eax
+  801bf1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801bf4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801bf9:	eb 4b                	jmp    801c46 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  801bfb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bfe:	8b 10                	mov    (%eax),%edx
+  801c00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c05:	8d 40 04             	lea    0x4(%eax),%eax
+  801c08:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c0b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801c10:	eb 34                	jmp    801c46 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801c12:	83 f9 01             	cmp    $0x1,%ecx
+  801c15:	7f 15                	jg     801c2c <vprintfmt+0x354>
+	else if (lflag)
+  801c17:	85 c9                	test   %ecx,%ecx
+  801c19:	74 4d                	je     801c68 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  801c1b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c1e:	8b 00                	mov    (%eax),%eax
+  801c20:	99                   	cltd
+  801c21:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c24:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801c27:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  801c2a:	eb 11                	jmp    801c3d <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  801c2c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c2f:	8b 50 04             	mov    0x4(%eax),%edx
+  801c32:	8b 00                	mov    (%eax),%eax
+  801c34:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c37:	8d 49 08             	lea    0x8(%ecx),%ecx
+  801c3a:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  801c3d:	89 d1                	mov    %edx,%ecx
+  801c3f:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  801c41:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801c46:	83 ec 0c             	sub    $0xc,%esp
+  801c49:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801c4d:	50                   	push   %eax
+  801c4e:	ff 75 e0             	push   -0x20(%ebp)
+  801c51:	57                   	push   %edi
+  801c52:	51                   	push   %ecx
+  801c53:	52                   	push   %edx
+  801c54:	89 da                	mov    %ebx,%edx
+  801c56:	89 f0                	mov    %esi,%eax
+  801c58:	e8 98 fb ff ff       	call   8017f5 <printnum>
+			break;
+  801c5d:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801c60:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801c63:	e9 8e fc ff ff       	jmp    8018f6 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  801c68:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c6b:	8b 00                	mov    (%eax),%eax
+  801c6d:	99                   	cltd
+  801c6e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c71:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801c74:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  801c77:	eb c4                	jmp    801c3d <vprintfmt+0x365>
+			putch('0', putdat);
+  801c79:	83 ec 08             	sub    $0x8,%esp
+  801c7c:	53                   	push   %ebx
+  801c7d:	6a 30                	push   $0x30
+  801c7f:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801c81:	83 c4 08             	add    $0x8,%esp
+  801c84:	53                   	push   %ebx
+  801c85:	6a 78                	push   $0x78
+  801c87:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801c89:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c8c:	8b 10                	mov    (%eax),%edx
+  801c8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801c93:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801c96:	8d 40 04             	lea    0x4(%eax),%eax
+  801c99:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801c9c:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  801ca1:	eb a3                	jmp    801c46 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801ca3:	83 f9 01             	cmp    $0x1,%ecx
+  801ca6:	7f 1b                	jg     801cc3 <vprintfmt+0x3eb>
+	else if (lflag)
+  801ca8:	85 c9                	test   %ecx,%ecx
+  801caa:	74 2f                	je     801cdb <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  801cac:	8b 45 14             	mov    0x14(%ebp),%eax
+  801caf:	8b 10                	mov    (%eax),%edx
+  801cb1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cb6:	8d 40 04             	lea    0x4(%eax),%eax
+  801cb9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cbc:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801cc1:	eb 83                	jmp    801c46 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801cc3:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cc6:	8b 10                	mov    (%eax),%edx
+  801cc8:	8b 48 04             	mov    0x4(%eax),%ecx
+  801ccb:	8d 40 08             	lea    0x8(%eax),%eax
+  801cce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cd1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801cd6:	e9 6b ff ff ff       	jmp    801c46 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  801cdb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cde:	8b 10                	mov    (%eax),%edx
+  801ce0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ce5:	8d 40 04             	lea    0x4(%eax),%eax
+  801ce8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ceb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801cf0:	e9 51 ff ff ff       	jmp    801c46 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  801cf5:	83 ec 08             	sub    $0x8,%esp
+  801cf8:	53                   	push   %ebx
+  801cf9:	6a 25                	push   $0x25
+  801cfb:	ff d6                	call   *%esi
+			break;
+  801cfd:	83 c4 10             	add    $0x10,%esp
+  801d00:	e9 5b ff ff ff       	jmp    801c60 <vprintfmt+0x388>
+			putch('%', putdat);
+  801d05:	83 ec 08             	sub    $0x8,%esp
+  801d08:	53                   	push   %ebx
+  801d09:	6a 25                	push   $0x25
+  801d0b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801d0d:	83 c4 10             	add    $0x10,%esp
+  801d10:	89 f8                	mov    %edi,%eax
+  801d12:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801d16:	74 05                	je     801d1d <vprintfmt+0x445>
+  801d18:	83 e8 01             	sub    $0x1,%eax
+  801d1b:	eb f5                	jmp    801d12 <vprintfmt+0x43a>
+  801d1d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d20:	e9 3b ff ff ff       	jmp    801c60 <vprintfmt+0x388>
+
+00801d25 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801d25:	55                   	push   %ebp
+  801d26:	89 e5                	mov    %esp,%ebp
+  801d28:	83 ec 18             	sub    $0x18,%esp
+  801d2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d2e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801d31:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801d34:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801d38:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801d3b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801d42:	85 c0                	test   %eax,%eax
+  801d44:	74 26                	je     801d6c <vsnprintf+0x47>
+  801d46:	85 d2                	test   %edx,%edx
+  801d48:	7e 22                	jle    801d6c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801d4a:	ff 75 14             	push   0x14(%ebp)
+  801d4d:	ff 75 10             	push   0x10(%ebp)
+  801d50:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801d53:	50                   	push   %eax
+  801d54:	68 9e 18 80 00       	push   $0x80189e
+  801d59:	e8 7a fb ff ff       	call   8018d8 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801d5e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801d61:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801d64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d67:	83 c4 10             	add    $0x10,%esp
+}
+  801d6a:	c9                   	leave
+  801d6b:	c3                   	ret
+		return -E_INVAL;
+  801d6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d71:	eb f7                	jmp    801d6a <vsnprintf+0x45>
+
+00801d73 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801d73:	55                   	push   %ebp
+  801d74:	89 e5                	mov    %esp,%ebp
+  801d76:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801d79:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801d7c:	50                   	push   %eax
+  801d7d:	ff 75 10             	push   0x10(%ebp)
+  801d80:	ff 75 0c             	push   0xc(%ebp)
+  801d83:	ff 75 08             	push   0x8(%ebp)
+  801d86:	e8 9a ff ff ff       	call   801d25 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801d8b:	c9                   	leave
+  801d8c:	c3                   	ret
+
+00801d8d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801d8d:	55                   	push   %ebp
+  801d8e:	89 e5                	mov    %esp,%ebp
+  801d90:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801d93:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d98:	eb 03                	jmp    801d9d <strlen+0x10>
+		n++;
+  801d9a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801d9d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801da1:	75 f7                	jne    801d9a <strlen+0xd>
+	return n;
+}
+  801da3:	5d                   	pop    %ebp
+  801da4:	c3                   	ret
+
+00801da5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801da5:	55                   	push   %ebp
+  801da6:	89 e5                	mov    %esp,%ebp
+  801da8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dae:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db3:	eb 03                	jmp    801db8 <strnlen+0x13>
+		n++;
+  801db5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801db8:	39 d0                	cmp    %edx,%eax
+  801dba:	74 08                	je     801dc4 <strnlen+0x1f>
+  801dbc:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801dc0:	75 f3                	jne    801db5 <strnlen+0x10>
+  801dc2:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801dc4:	89 d0                	mov    %edx,%eax
+  801dc6:	5d                   	pop    %ebp
+  801dc7:	c3                   	ret
+
+00801dc8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801dc8:	55                   	push   %ebp
+  801dc9:	89 e5                	mov    %esp,%ebp
+  801dcb:	53                   	push   %ebx
+  801dcc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801dcf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801dd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801ddb:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801dde:	83 c0 01             	add    $0x1,%eax
+  801de1:	84 d2                	test   %dl,%dl
+  801de3:	75 f2                	jne    801dd7 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801de5:	89 c8                	mov    %ecx,%eax
+  801de7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dea:	c9                   	leave
+  801deb:	c3                   	ret
+
+00801dec <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801dec:	55                   	push   %ebp
+  801ded:	89 e5                	mov    %esp,%ebp
+  801def:	53                   	push   %ebx
+  801df0:	83 ec 10             	sub    $0x10,%esp
+  801df3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801df6:	53                   	push   %ebx
+  801df7:	e8 91 ff ff ff       	call   801d8d <strlen>
+  801dfc:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801dff:	ff 75 0c             	push   0xc(%ebp)
+  801e02:	01 d8                	add    %ebx,%eax
+  801e04:	50                   	push   %eax
+  801e05:	e8 be ff ff ff       	call   801dc8 <strcpy>
+	return dst;
+}
+  801e0a:	89 d8                	mov    %ebx,%eax
+  801e0c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e0f:	c9                   	leave
+  801e10:	c3                   	ret
+
+00801e11 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801e11:	55                   	push   %ebp
+  801e12:	89 e5                	mov    %esp,%ebp
+  801e14:	56                   	push   %esi
+  801e15:	53                   	push   %ebx
+  801e16:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e19:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801e1c:	89 f3                	mov    %esi,%ebx
+  801e1e:	03 5d 10             	add    0x10(%ebp),%ebx
+  801e21:	89 f0                	mov    %esi,%eax
+  801e23:	eb 0f                	jmp    801e34 <strncpy+0x23>
+		*dst++ = *src;
+  801e25:	83 c0 01             	add    $0x1,%eax
+  801e28:	0f b6 0a             	movzbl (%edx),%ecx
+  801e2b:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801e2e:	80 f9 01             	cmp    $0x1,%cl
+  801e31:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801e34:	39 d8                	cmp    %ebx,%eax
+  801e36:	75 ed                	jne    801e25 <strncpy+0x14>
+	}
+	return ret;
+}
+  801e38:	89 f0                	mov    %esi,%eax
+  801e3a:	5b                   	pop    %ebx
+  801e3b:	5e                   	pop    %esi
+  801e3c:	5d                   	pop    %ebp
+  801e3d:	c3                   	ret
+
+00801e3e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e3e:	55                   	push   %ebp
+  801e3f:	89 e5                	mov    %esp,%ebp
+  801e41:	56                   	push   %esi
+  801e42:	53                   	push   %ebx
+  801e43:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e49:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801e4c:	89 f0                	mov    %esi,%eax
+  801e4e:	85 d2                	test   %edx,%edx
+  801e50:	74 21                	je     801e73 <strlcpy+0x35>
+  801e52:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801e56:	89 f2                	mov    %esi,%edx
+  801e58:	eb 09                	jmp    801e63 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801e5a:	83 c1 01             	add    $0x1,%ecx
+  801e5d:	83 c2 01             	add    $0x1,%edx
+  801e60:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801e63:	39 c2                	cmp    %eax,%edx
+  801e65:	74 09                	je     801e70 <strlcpy+0x32>
+  801e67:	0f b6 19             	movzbl (%ecx),%ebx
+  801e6a:	84 db                	test   %bl,%bl
+  801e6c:	75 ec                	jne    801e5a <strlcpy+0x1c>
+  801e6e:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801e70:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801e73:	29 f0                	sub    %esi,%eax
+}
+  801e75:	5b                   	pop    %ebx
+  801e76:	5e                   	pop    %esi
+  801e77:	5d                   	pop    %ebp
+  801e78:	c3                   	ret
+
+00801e79 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801e79:	55                   	push   %ebp
+  801e7a:	89 e5                	mov    %esp,%ebp
+  801e7c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e7f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801e82:	eb 06                	jmp    801e8a <strcmp+0x11>
+		p++, q++;
+  801e84:	83 c1 01             	add    $0x1,%ecx
+  801e87:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801e8a:	0f b6 01             	movzbl (%ecx),%eax
+  801e8d:	84 c0                	test   %al,%al
+  801e8f:	74 04                	je     801e95 <strcmp+0x1c>
+  801e91:	3a 02                	cmp    (%edx),%al
+  801e93:	74 ef                	je     801e84 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801e95:	0f b6 c0             	movzbl %al,%eax
+  801e98:	0f b6 12             	movzbl (%edx),%edx
+  801e9b:	29 d0                	sub    %edx,%eax
+}
+  801e9d:	5d                   	pop    %ebp
+  801e9e:	c3                   	ret
+
+00801e9f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801e9f:	55                   	push   %ebp
+  801ea0:	89 e5                	mov    %esp,%ebp
+  801ea2:	53                   	push   %ebx
+  801ea3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ea9:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801eac:	eb 09                	jmp    801eb7 <strncmp+0x18>
+		n--, p++, q++;
+  801eae:	83 ea 01             	sub    $0x1,%edx
+  801eb1:	83 c0 01             	add    $0x1,%eax
+  801eb4:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801eb7:	85 d2                	test   %edx,%edx
+  801eb9:	74 18                	je     801ed3 <strncmp+0x34>
+  801ebb:	0f b6 18             	movzbl (%eax),%ebx
+  801ebe:	84 db                	test   %bl,%bl
+  801ec0:	74 04                	je     801ec6 <strncmp+0x27>
+  801ec2:	3a 19                	cmp    (%ecx),%bl
+  801ec4:	74 e8                	je     801eae <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ec6:	0f b6 00             	movzbl (%eax),%eax
+  801ec9:	0f b6 11             	movzbl (%ecx),%edx
+  801ecc:	29 d0                	sub    %edx,%eax
+}
+  801ece:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed1:	c9                   	leave
+  801ed2:	c3                   	ret
+		return 0;
+  801ed3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed8:	eb f4                	jmp    801ece <strncmp+0x2f>
+
+00801eda <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801eda:	55                   	push   %ebp
+  801edb:	89 e5                	mov    %esp,%ebp
+  801edd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801ee4:	eb 03                	jmp    801ee9 <strchr+0xf>
+  801ee6:	83 c0 01             	add    $0x1,%eax
+  801ee9:	0f b6 10             	movzbl (%eax),%edx
+  801eec:	84 d2                	test   %dl,%dl
+  801eee:	74 06                	je     801ef6 <strchr+0x1c>
+		if (*s == c)
+  801ef0:	38 ca                	cmp    %cl,%dl
+  801ef2:	75 f2                	jne    801ee6 <strchr+0xc>
+  801ef4:	eb 05                	jmp    801efb <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801efb:	5d                   	pop    %ebp
+  801efc:	c3                   	ret
+
+00801efd <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801efd:	55                   	push   %ebp
+  801efe:	89 e5                	mov    %esp,%ebp
+  801f00:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f03:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f07:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801f0a:	38 ca                	cmp    %cl,%dl
+  801f0c:	74 09                	je     801f17 <strfind+0x1a>
+  801f0e:	84 d2                	test   %dl,%dl
+  801f10:	74 05                	je     801f17 <strfind+0x1a>
+	for (; *s; s++)
+  801f12:	83 c0 01             	add    $0x1,%eax
+  801f15:	eb f0                	jmp    801f07 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801f17:	5d                   	pop    %ebp
+  801f18:	c3                   	ret
+
+00801f19 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801f19:	55                   	push   %ebp
+  801f1a:	89 e5                	mov    %esp,%ebp
+  801f1c:	57                   	push   %edi
+  801f1d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f20:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801f23:	85 c9                	test   %ecx,%ecx
+  801f25:	74 20                	je     801f47 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801f27:	89 f8                	mov    %edi,%eax
+  801f29:	09 c8                	or     %ecx,%eax
+  801f2b:	a8 03                	test   $0x3,%al
+  801f2d:	75 12                	jne    801f41 <memset+0x28>
+		c &= 0xFF;
+  801f2f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801f33:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801f39:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801f3c:	fc                   	cld
+  801f3d:	f3 ab                	rep stos %eax,%es:(%edi)
+  801f3f:	eb 06                	jmp    801f47 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801f41:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f44:	fc                   	cld
+  801f45:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801f47:	89 f8                	mov    %edi,%eax
+  801f49:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801f4c:	c9                   	leave
+  801f4d:	c3                   	ret
+
+00801f4e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801f4e:	55                   	push   %ebp
+  801f4f:	89 e5                	mov    %esp,%ebp
+  801f51:	57                   	push   %edi
+  801f52:	56                   	push   %esi
+  801f53:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f56:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f59:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801f5c:	39 c6                	cmp    %eax,%esi
+  801f5e:	73 32                	jae    801f92 <memmove+0x44>
+  801f60:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801f63:	39 d0                	cmp    %edx,%eax
+  801f65:	73 2b                	jae    801f92 <memmove+0x44>
+		s += n;
+		d += n;
+  801f67:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f6a:	89 d6                	mov    %edx,%esi
+  801f6c:	09 fe                	or     %edi,%esi
+  801f6e:	09 ce                	or     %ecx,%esi
+  801f70:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801f76:	75 0e                	jne    801f86 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801f78:	83 ef 04             	sub    $0x4,%edi
+  801f7b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801f7e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801f81:	fd                   	std
+  801f82:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801f84:	eb 09                	jmp    801f8f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801f86:	83 ef 01             	sub    $0x1,%edi
+  801f89:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801f8c:	fd                   	std
+  801f8d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801f8f:	fc                   	cld
+  801f90:	eb 1a                	jmp    801fac <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f92:	89 f2                	mov    %esi,%edx
+  801f94:	09 c2                	or     %eax,%edx
+  801f96:	09 ca                	or     %ecx,%edx
+  801f98:	f6 c2 03             	test   $0x3,%dl
+  801f9b:	75 0a                	jne    801fa7 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801f9d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801fa0:	89 c7                	mov    %eax,%edi
+  801fa2:	fc                   	cld
+  801fa3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fa5:	eb 05                	jmp    801fac <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801fa7:	89 c7                	mov    %eax,%edi
+  801fa9:	fc                   	cld
+  801faa:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801fac:	5e                   	pop    %esi
+  801fad:	5f                   	pop    %edi
+  801fae:	5d                   	pop    %ebp
+  801faf:	c3                   	ret
+
+00801fb0 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801fb0:	55                   	push   %ebp
+  801fb1:	89 e5                	mov    %esp,%ebp
+  801fb3:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801fb6:	ff 75 10             	push   0x10(%ebp)
+  801fb9:	ff 75 0c             	push   0xc(%ebp)
+  801fbc:	ff 75 08             	push   0x8(%ebp)
+  801fbf:	e8 8a ff ff ff       	call   801f4e <memmove>
+}
+  801fc4:	c9                   	leave
+  801fc5:	c3                   	ret
+
+00801fc6 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801fc6:	55                   	push   %ebp
+  801fc7:	89 e5                	mov    %esp,%ebp
+  801fc9:	56                   	push   %esi
+  801fca:	53                   	push   %ebx
+  801fcb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fce:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801fd1:	89 c6                	mov    %eax,%esi
+  801fd3:	03 75 10             	add    0x10(%ebp),%esi
+  801fd6:	eb 06                	jmp    801fde <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801fd8:	83 c0 01             	add    $0x1,%eax
+  801fdb:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801fde:	39 f0                	cmp    %esi,%eax
+  801fe0:	74 14                	je     801ff6 <memcmp+0x30>
+		if (*s1 != *s2)
+  801fe2:	0f b6 08             	movzbl (%eax),%ecx
+  801fe5:	0f b6 1a             	movzbl (%edx),%ebx
+  801fe8:	38 d9                	cmp    %bl,%cl
+  801fea:	74 ec                	je     801fd8 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801fec:	0f b6 c1             	movzbl %cl,%eax
+  801fef:	0f b6 db             	movzbl %bl,%ebx
+  801ff2:	29 d8                	sub    %ebx,%eax
+  801ff4:	eb 05                	jmp    801ffb <memcmp+0x35>
+	}
+
+	return 0;
+  801ff6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ffb:	5b                   	pop    %ebx
+  801ffc:	5e                   	pop    %esi
+  801ffd:	5d                   	pop    %ebp
+  801ffe:	c3                   	ret
+
+00801fff <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801fff:	55                   	push   %ebp
+  802000:	89 e5                	mov    %esp,%ebp
+  802002:	8b 45 08             	mov    0x8(%ebp),%eax
+  802005:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802008:	89 c2                	mov    %eax,%edx
+  80200a:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80200d:	eb 03                	jmp    802012 <memfind+0x13>
+  80200f:	83 c0 01             	add    $0x1,%eax
+  802012:	39 d0                	cmp    %edx,%eax
+  802014:	73 04                	jae    80201a <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802016:	38 08                	cmp    %cl,(%eax)
+  802018:	75 f5                	jne    80200f <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80201a:	5d                   	pop    %ebp
+  80201b:	c3                   	ret
+
+0080201c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80201c:	55                   	push   %ebp
+  80201d:	89 e5                	mov    %esp,%ebp
+  80201f:	57                   	push   %edi
+  802020:	56                   	push   %esi
+  802021:	53                   	push   %ebx
+  802022:	8b 55 08             	mov    0x8(%ebp),%edx
+  802025:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802028:	eb 03                	jmp    80202d <strtol+0x11>
+		s++;
+  80202a:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80202d:	0f b6 02             	movzbl (%edx),%eax
+  802030:	3c 20                	cmp    $0x20,%al
+  802032:	74 f6                	je     80202a <strtol+0xe>
+  802034:	3c 09                	cmp    $0x9,%al
+  802036:	74 f2                	je     80202a <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802038:	3c 2b                	cmp    $0x2b,%al
+  80203a:	74 2a                	je     802066 <strtol+0x4a>
+	int neg = 0;
+  80203c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802041:	3c 2d                	cmp    $0x2d,%al
+  802043:	74 2b                	je     802070 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802045:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80204b:	75 0f                	jne    80205c <strtol+0x40>
+  80204d:	80 3a 30             	cmpb   $0x30,(%edx)
+  802050:	74 28                	je     80207a <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802052:	85 db                	test   %ebx,%ebx
+  802054:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802059:	0f 44 d8             	cmove  %eax,%ebx
+  80205c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802061:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802064:	eb 46                	jmp    8020ac <strtol+0x90>
+		s++;
+  802066:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802069:	bf 00 00 00 00       	mov    $0x0,%edi
+  80206e:	eb d5                	jmp    802045 <strtol+0x29>
+		s++, neg = 1;
+  802070:	83 c2 01             	add    $0x1,%edx
+  802073:	bf 01 00 00 00       	mov    $0x1,%edi
+  802078:	eb cb                	jmp    802045 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80207a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80207e:	74 0e                	je     80208e <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802080:	85 db                	test   %ebx,%ebx
+  802082:	75 d8                	jne    80205c <strtol+0x40>
+		s++, base = 8;
+  802084:	83 c2 01             	add    $0x1,%edx
+  802087:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80208c:	eb ce                	jmp    80205c <strtol+0x40>
+		s += 2, base = 16;
+  80208e:	83 c2 02             	add    $0x2,%edx
+  802091:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802096:	eb c4                	jmp    80205c <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802098:	0f be c0             	movsbl %al,%eax
+  80209b:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  80209e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8020a1:	7d 3a                	jge    8020dd <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8020a3:	83 c2 01             	add    $0x1,%edx
+  8020a6:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8020aa:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8020ac:	0f b6 02             	movzbl (%edx),%eax
+  8020af:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8020b2:	89 f3                	mov    %esi,%ebx
+  8020b4:	80 fb 09             	cmp    $0x9,%bl
+  8020b7:	76 df                	jbe    802098 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8020b9:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8020bc:	89 f3                	mov    %esi,%ebx
+  8020be:	80 fb 19             	cmp    $0x19,%bl
+  8020c1:	77 08                	ja     8020cb <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8020c3:	0f be c0             	movsbl %al,%eax
+  8020c6:	83 e8 57             	sub    $0x57,%eax
+  8020c9:	eb d3                	jmp    80209e <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8020cb:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8020ce:	89 f3                	mov    %esi,%ebx
+  8020d0:	80 fb 19             	cmp    $0x19,%bl
+  8020d3:	77 08                	ja     8020dd <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8020d5:	0f be c0             	movsbl %al,%eax
+  8020d8:	83 e8 37             	sub    $0x37,%eax
+  8020db:	eb c1                	jmp    80209e <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8020dd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8020e1:	74 05                	je     8020e8 <strtol+0xcc>
+		*endptr = (char *) s;
+  8020e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020e6:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8020e8:	89 c8                	mov    %ecx,%eax
+  8020ea:	f7 d8                	neg    %eax
+  8020ec:	85 ff                	test   %edi,%edi
+  8020ee:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8020f1:	89 c8                	mov    %ecx,%eax
+  8020f3:	5b                   	pop    %ebx
+  8020f4:	5e                   	pop    %esi
+  8020f5:	5f                   	pop    %edi
+  8020f6:	5d                   	pop    %ebp
+  8020f7:	c3                   	ret
+
+008020f8 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  8020f8:	55                   	push   %ebp
+  8020f9:	89 e5                	mov    %esp,%ebp
+  8020fb:	57                   	push   %edi
+  8020fc:	56                   	push   %esi
+  8020fd:	53                   	push   %ebx
+  8020fe:	83 ec 0c             	sub    $0xc,%esp
+  802101:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802104:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802107:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  80210a:	85 ff                	test   %edi,%edi
+  80210c:	74 16                	je     802124 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  80210e:	83 ec 04             	sub    $0x4,%esp
+  802111:	56                   	push   %esi
+  802112:	6a 00                	push   $0x0
+  802114:	53                   	push   %ebx
+  802115:	e8 02 ff ff ff       	call   80201c <strtol>
+  80211a:	89 07                	mov    %eax,(%edi)
+  80211c:	83 c4 10             	add    $0x10,%esp
+  80211f:	eb 03                	jmp    802124 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  802121:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  802124:	0f b6 03             	movzbl (%ebx),%eax
+  802127:	3c 20                	cmp    $0x20,%al
+  802129:	74 f6                	je     802121 <strisl+0x29>
+  80212b:	3c 09                	cmp    $0x9,%al
+  80212d:	74 f2                	je     802121 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  80212f:	3c 2b                	cmp    $0x2b,%al
+  802131:	74 23                	je     802156 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  802133:	3c 2d                	cmp    $0x2d,%al
+  802135:	0f 94 c0             	sete   %al
+  802138:	0f b6 c0             	movzbl %al,%eax
+  80213b:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80213d:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  802143:	75 41                	jne    802186 <strisl+0x8e>
+  802145:	80 3b 30             	cmpb   $0x30,(%ebx)
+  802148:	74 11                	je     80215b <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80214a:	85 f6                	test   %esi,%esi
+  80214c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802151:	0f 44 f0             	cmove  %eax,%esi
+  802154:	eb 30                	jmp    802186 <strisl+0x8e>
+		s++;
+  802156:	83 c3 01             	add    $0x1,%ebx
+  802159:	eb e2                	jmp    80213d <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80215b:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  80215f:	74 0e                	je     80216f <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  802161:	85 f6                	test   %esi,%esi
+  802163:	75 21                	jne    802186 <strisl+0x8e>
+		s++, base = 8;
+  802165:	83 c3 01             	add    $0x1,%ebx
+  802168:	be 08 00 00 00       	mov    $0x8,%esi
+  80216d:	eb 17                	jmp    802186 <strisl+0x8e>
+		s += 2, base = 16;
+  80216f:	83 c3 02             	add    $0x2,%ebx
+  802172:	be 10 00 00 00       	mov    $0x10,%esi
+  802177:	eb 0d                	jmp    802186 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802179:	0f be c0             	movsbl %al,%eax
+  80217c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  80217f:	39 f0                	cmp    %esi,%eax
+  802181:	7d 38                	jge    8021bb <strisl+0xc3>
+			return 0;
+		s++;
+  802183:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  802186:	0f b6 03             	movzbl (%ebx),%eax
+  802189:	8d 50 d0             	lea    -0x30(%eax),%edx
+  80218c:	80 fa 09             	cmp    $0x9,%dl
+  80218f:	76 e8                	jbe    802179 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  802191:	8d 50 9f             	lea    -0x61(%eax),%edx
+  802194:	80 fa 19             	cmp    $0x19,%dl
+  802197:	77 08                	ja     8021a1 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  802199:	0f be c0             	movsbl %al,%eax
+  80219c:	83 e8 57             	sub    $0x57,%eax
+  80219f:	eb de                	jmp    80217f <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  8021a1:	8d 50 bf             	lea    -0x41(%eax),%edx
+  8021a4:	80 fa 19             	cmp    $0x19,%dl
+  8021a7:	77 08                	ja     8021b1 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  8021a9:	0f be c0             	movsbl %al,%eax
+  8021ac:	83 e8 37             	sub    $0x37,%eax
+  8021af:	eb ce                	jmp    80217f <strisl+0x87>
+		else if (!*s)
+  8021b1:	84 c0                	test   %al,%al
+  8021b3:	0f 94 c0             	sete   %al
+  8021b6:	0f b6 c0             	movzbl %al,%eax
+  8021b9:	eb 05                	jmp    8021c0 <strisl+0xc8>
+			return 0;
+  8021bb:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  8021c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021c3:	5b                   	pop    %ebx
+  8021c4:	5e                   	pop    %esi
+  8021c5:	5f                   	pop    %edi
+  8021c6:	5d                   	pop    %ebp
+  8021c7:	c3                   	ret
+
+008021c8 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8021c8:	55                   	push   %ebp
+  8021c9:	89 e5                	mov    %esp,%ebp
+  8021cb:	57                   	push   %edi
+  8021cc:	56                   	push   %esi
+  8021cd:	53                   	push   %ebx
+  8021ce:	83 ec 14             	sub    $0x14,%esp
+  8021d1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021d4:	8b 75 14             	mov    0x14(%ebp),%esi
+  8021d7:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8021da:	ff 75 10             	push   0x10(%ebp)
+  8021dd:	ff 75 0c             	push   0xc(%ebp)
+  8021e0:	e8 c9 e3 ff ff       	call   8005ae <sys_ipc_recv_pages>
+  8021e5:	83 c4 10             	add    $0x10,%esp
+  8021e8:	85 c0                	test   %eax,%eax
+  8021ea:	78 46                	js     802232 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8021ec:	85 ff                	test   %edi,%edi
+  8021ee:	74 0d                	je     8021fd <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  8021f0:	a1 08 40 80 00       	mov    0x804008,%eax
+  8021f5:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8021fb:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8021fd:	85 f6                	test   %esi,%esi
+  8021ff:	74 0d                	je     80220e <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  802201:	a1 08 40 80 00       	mov    0x804008,%eax
+  802206:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80220c:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80220e:	85 db                	test   %ebx,%ebx
+  802210:	74 0d                	je     80221f <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  802212:	a1 08 40 80 00       	mov    0x804008,%eax
+  802217:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80221d:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80221f:	a1 08 40 80 00       	mov    0x804008,%eax
+  802224:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80222a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80222d:	5b                   	pop    %ebx
+  80222e:	5e                   	pop    %esi
+  80222f:	5f                   	pop    %edi
+  802230:	5d                   	pop    %ebp
+  802231:	c3                   	ret
+		if (from_env_store) {
+  802232:	85 ff                	test   %edi,%edi
+  802234:	74 06                	je     80223c <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  802236:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80223c:	85 f6                	test   %esi,%esi
+  80223e:	74 06                	je     802246 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  802240:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802246:	85 db                	test   %ebx,%ebx
+  802248:	74 e0                	je     80222a <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  80224a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802250:	eb d8                	jmp    80222a <ipc_recv_pages+0x62>
+
+00802252 <ipc_recv>:
+{
+  802252:	55                   	push   %ebp
+  802253:	89 e5                	mov    %esp,%ebp
+  802255:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  802258:	6a 00                	push   $0x0
+  80225a:	ff 75 10             	push   0x10(%ebp)
+  80225d:	6a 01                	push   $0x1
+  80225f:	ff 75 0c             	push   0xc(%ebp)
+  802262:	ff 75 08             	push   0x8(%ebp)
+  802265:	e8 5e ff ff ff       	call   8021c8 <ipc_recv_pages>
+}
+  80226a:	c9                   	leave
+  80226b:	c3                   	ret
+
+0080226c <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80226c:	55                   	push   %ebp
+  80226d:	89 e5                	mov    %esp,%ebp
+  80226f:	56                   	push   %esi
+  802270:	53                   	push   %ebx
+  802271:	8b 75 08             	mov    0x8(%ebp),%esi
+  802274:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  802277:	83 ec 0c             	sub    $0xc,%esp
+  80227a:	ff 75 0c             	push   0xc(%ebp)
+  80227d:	e8 60 e4 ff ff       	call   8006e2 <sys_ipc_try_recv>
+  802282:	83 c4 10             	add    $0x10,%esp
+  802285:	85 c0                	test   %eax,%eax
+  802287:	78 34                	js     8022bd <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802289:	85 f6                	test   %esi,%esi
+  80228b:	74 0d                	je     80229a <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  80228d:	a1 08 40 80 00       	mov    0x804008,%eax
+  802292:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802298:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  80229a:	85 db                	test   %ebx,%ebx
+  80229c:	74 0d                	je     8022ab <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  80229e:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022a3:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8022a9:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8022ab:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022b0:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8022b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022b9:	5b                   	pop    %ebx
+  8022ba:	5e                   	pop    %esi
+  8022bb:	5d                   	pop    %ebp
+  8022bc:	c3                   	ret
+		if (from_env_store) {
+  8022bd:	85 f6                	test   %esi,%esi
+  8022bf:	74 06                	je     8022c7 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8022c1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8022c7:	85 db                	test   %ebx,%ebx
+  8022c9:	74 eb                	je     8022b6 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8022cb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8022d1:	eb e3                	jmp    8022b6 <ipc_try_recv+0x4a>
+
+008022d3 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8022d3:	55                   	push   %ebp
+  8022d4:	89 e5                	mov    %esp,%ebp
+  8022d6:	83 ec 14             	sub    $0x14,%esp
+  8022d9:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8022dc:	85 c0                	test   %eax,%eax
+  8022de:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8022e3:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8022e6:	ff 75 18             	push   0x18(%ebp)
+  8022e9:	ff 75 14             	push   0x14(%ebp)
+  8022ec:	50                   	push   %eax
+  8022ed:	ff 75 0c             	push   0xc(%ebp)
+  8022f0:	ff 75 08             	push   0x8(%ebp)
+  8022f3:	e8 79 e2 ff ff       	call   800571 <sys_ipc_send_pages>
+  8022f8:	83 c4 20             	add    $0x20,%esp
+  8022fb:	85 c0                	test   %eax,%eax
+  8022fd:	78 02                	js     802301 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  8022ff:	c9                   	leave
+  802300:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  802301:	50                   	push   %eax
+  802302:	68 0c 2b 80 00       	push   $0x802b0c
+  802307:	68 80 00 00 00       	push   $0x80
+  80230c:	68 38 2b 80 00       	push   $0x802b38
+  802311:	e8 f0 f3 ff ff       	call   801706 <_panic>
+
+00802316 <ipc_send>:
+{
+  802316:	55                   	push   %ebp
+  802317:	89 e5                	mov    %esp,%ebp
+  802319:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  80231c:	ff 75 14             	push   0x14(%ebp)
+  80231f:	6a 01                	push   $0x1
+  802321:	ff 75 10             	push   0x10(%ebp)
+  802324:	ff 75 0c             	push   0xc(%ebp)
+  802327:	ff 75 08             	push   0x8(%ebp)
+  80232a:	e8 a4 ff ff ff       	call   8022d3 <ipc_send_pages>
+}
+  80232f:	83 c4 20             	add    $0x20,%esp
+  802332:	c9                   	leave
+  802333:	c3                   	ret
+
+00802334 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802334:	55                   	push   %ebp
+  802335:	89 e5                	mov    %esp,%ebp
+  802337:	83 ec 14             	sub    $0x14,%esp
+  80233a:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80233d:	85 c0                	test   %eax,%eax
+  80233f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802344:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802347:	ff 75 18             	push   0x18(%ebp)
+  80234a:	ff 75 14             	push   0x14(%ebp)
+  80234d:	50                   	push   %eax
+  80234e:	ff 75 0c             	push   0xc(%ebp)
+  802351:	ff 75 08             	push   0x8(%ebp)
+  802354:	e8 a9 e2 ff ff       	call   800602 <sys_ipc_call>
+  802359:	83 c4 20             	add    $0x20,%esp
+  80235c:	85 c0                	test   %eax,%eax
+  80235e:	78 0b                	js     80236b <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  802360:	a1 08 40 80 00       	mov    0x804008,%eax
+  802365:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80236b:	c9                   	leave
+  80236c:	c3                   	ret
+
+0080236d <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  80236d:	55                   	push   %ebp
+  80236e:	89 e5                	mov    %esp,%ebp
+  802370:	57                   	push   %edi
+  802371:	56                   	push   %esi
+  802372:	53                   	push   %ebx
+  802373:	83 ec 18             	sub    $0x18,%esp
+  802376:	8b 45 10             	mov    0x10(%ebp),%eax
+  802379:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  80237c:	8b 75 20             	mov    0x20(%ebp),%esi
+  80237f:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802382:	85 c0                	test   %eax,%eax
+  802384:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802389:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80238c:	ff 75 18             	push   0x18(%ebp)
+  80238f:	ff 75 14             	push   0x14(%ebp)
+  802392:	50                   	push   %eax
+  802393:	ff 75 0c             	push   0xc(%ebp)
+  802396:	ff 75 08             	push   0x8(%ebp)
+  802399:	e8 a5 e2 ff ff       	call   800643 <sys_ipc_reply_recv>
+  80239e:	83 c4 20             	add    $0x20,%esp
+  8023a1:	85 c0                	test   %eax,%eax
+  8023a3:	78 46                	js     8023eb <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8023a5:	85 ff                	test   %edi,%edi
+  8023a7:	74 0d                	je     8023b6 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8023a9:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023ae:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8023b4:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8023b6:	85 f6                	test   %esi,%esi
+  8023b8:	74 0d                	je     8023c7 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8023ba:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023bf:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8023c5:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8023c7:	85 db                	test   %ebx,%ebx
+  8023c9:	74 0d                	je     8023d8 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8023cb:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023d0:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8023d6:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8023d8:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023dd:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8023e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023e6:	5b                   	pop    %ebx
+  8023e7:	5e                   	pop    %esi
+  8023e8:	5f                   	pop    %edi
+  8023e9:	5d                   	pop    %ebp
+  8023ea:	c3                   	ret
+		if (from_env_store) {
+  8023eb:	85 ff                	test   %edi,%edi
+  8023ed:	74 06                	je     8023f5 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  8023ef:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8023f5:	85 f6                	test   %esi,%esi
+  8023f7:	74 06                	je     8023ff <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  8023f9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8023ff:	85 db                	test   %ebx,%ebx
+  802401:	74 e0                	je     8023e3 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  802403:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802409:	eb d8                	jmp    8023e3 <ipc_reply_recv+0x76>
+
+0080240b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80240b:	55                   	push   %ebp
+  80240c:	89 e5                	mov    %esp,%ebp
+  80240e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802411:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  802416:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802419:	c1 e0 06             	shl    $0x6,%eax
+  80241c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802421:	8b 40 50             	mov    0x50(%eax),%eax
+  802424:	39 c8                	cmp    %ecx,%eax
+  802426:	74 12                	je     80243a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802428:	83 c2 01             	add    $0x1,%edx
+  80242b:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802431:	75 e3                	jne    802416 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802433:	b8 00 00 00 00       	mov    $0x0,%eax
+  802438:	eb 0e                	jmp    802448 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80243a:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80243d:	c1 e0 06             	shl    $0x6,%eax
+  802440:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802445:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802448:	5d                   	pop    %ebp
+  802449:	c3                   	ret
+
+0080244a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80244a:	55                   	push   %ebp
+  80244b:	89 e5                	mov    %esp,%ebp
+  80244d:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802450:	89 c2                	mov    %eax,%edx
+  802452:	c1 ea 16             	shr    $0x16,%edx
+  802455:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80245c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802461:	f6 c1 01             	test   $0x1,%cl
+  802464:	74 1e                	je     802484 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  802466:	c1 e8 0c             	shr    $0xc,%eax
+  802469:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802470:	a8 01                	test   $0x1,%al
+  802472:	74 10                	je     802484 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802474:	c1 e8 0c             	shr    $0xc,%eax
+  802477:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80247a:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  802481:	0f b7 d2             	movzwl %dx,%edx
+}
+  802484:	89 d0                	mov    %edx,%eax
+  802486:	5d                   	pop    %ebp
+  802487:	c3                   	ret
+
+00802488 <udivmod>:
+  802488:	55                   	push   %ebp
+  802489:	57                   	push   %edi
+  80248a:	56                   	push   %esi
+  80248b:	53                   	push   %ebx
+  80248c:	83 ec 24             	sub    $0x24,%esp
+  80248f:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802493:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802497:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80249b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80249f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024a3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024a7:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8024ab:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ba:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024c1:	00 
+  8024c2:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024c9:	00 
+  8024ca:	89 fb                	mov    %edi,%ebx
+  8024cc:	eb 08                	jmp    8024d6 <udivmod+0x4e>
+  8024ce:	83 e9 01             	sub    $0x1,%ecx
+  8024d1:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8024d4:	74 68                	je     80253e <udivmod+0xb6>
+  8024d6:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024da:	01 c0                	add    %eax,%eax
+  8024dc:	89 c6                	mov    %eax,%esi
+  8024de:	89 d7                	mov    %edx,%edi
+  8024e0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8024e4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8024e8:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024eb:	d3 ea                	shr    %cl,%edx
+  8024ed:	f6 c1 20             	test   $0x20,%cl
+  8024f0:	74 04                	je     8024f6 <udivmod+0x6e>
+  8024f2:	89 d0                	mov    %edx,%eax
+  8024f4:	31 d2                	xor    %edx,%edx
+  8024f6:	83 e0 01             	and    $0x1,%eax
+  8024f9:	89 04 24             	mov    %eax,(%esp)
+  8024fc:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802503:	00 
+  802504:	8b 04 24             	mov    (%esp),%eax
+  802507:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80250b:	09 f0                	or     %esi,%eax
+  80250d:	09 fa                	or     %edi,%edx
+  80250f:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802513:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802517:	39 f0                	cmp    %esi,%eax
+  802519:	89 d5                	mov    %edx,%ebp
+  80251b:	19 fd                	sbb    %edi,%ebp
+  80251d:	72 af                	jb     8024ce <udivmod+0x46>
+  80251f:	29 f0                	sub    %esi,%eax
+  802521:	19 fa                	sbb    %edi,%edx
+  802523:	89 cf                	mov    %ecx,%edi
+  802525:	c1 ef 05             	shr    $0x5,%edi
+  802528:	83 e7 01             	and    $0x1,%edi
+  80252b:	89 fe                	mov    %edi,%esi
+  80252d:	83 f6 01             	xor    $0x1,%esi
+  802530:	d3 e6                	shl    %cl,%esi
+  802532:	d3 e7                	shl    %cl,%edi
+  802534:	09 74 24 18          	or     %esi,0x18(%esp)
+  802538:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80253c:	eb 90                	jmp    8024ce <udivmod+0x46>
+  80253e:	85 db                	test   %ebx,%ebx
+  802540:	74 05                	je     802547 <udivmod+0xbf>
+  802542:	89 03                	mov    %eax,(%ebx)
+  802544:	89 53 04             	mov    %edx,0x4(%ebx)
+  802547:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80254b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80254f:	83 c4 24             	add    $0x24,%esp
+  802552:	5b                   	pop    %ebx
+  802553:	5e                   	pop    %esi
+  802554:	5f                   	pop    %edi
+  802555:	5d                   	pop    %ebp
+  802556:	c3                   	ret
+
+00802557 <__udivdi3>:
+  802557:	83 ec 08             	sub    $0x8,%esp
+  80255a:	6a 00                	push   $0x0
+  80255c:	ff 74 24 1c          	push   0x1c(%esp)
+  802560:	ff 74 24 1c          	push   0x1c(%esp)
+  802564:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802568:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80256c:	e8 17 ff ff ff       	call   802488 <udivmod>
+  802571:	83 c4 14             	add    $0x14,%esp
+  802574:	c3                   	ret
+
+00802575 <__umoddi3>:
+  802575:	83 ec 18             	sub    $0x18,%esp
+  802578:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80257c:	50                   	push   %eax
+  80257d:	ff 74 24 2c          	push   0x2c(%esp)
+  802581:	ff 74 24 2c          	push   0x2c(%esp)
+  802585:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802589:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80258d:	e8 f6 fe ff ff       	call   802488 <udivmod>
+  802592:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802596:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80259a:	83 c4 24             	add    $0x24,%esp
+  80259d:	c3                   	ret
+
+0080259e <__divdi3>:
+  80259e:	55                   	push   %ebp
+  80259f:	57                   	push   %edi
+  8025a0:	56                   	push   %esi
+  8025a1:	53                   	push   %ebx
+  8025a2:	83 ec 10             	sub    $0x10,%esp
+  8025a5:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8025a9:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8025ad:	89 c6                	mov    %eax,%esi
+  8025af:	89 d7                	mov    %edx,%edi
+  8025b1:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8025b5:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8025b9:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025bd:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8025c1:	89 c5                	mov    %eax,%ebp
+  8025c3:	f7 dd                	neg    %ebp
+  8025c5:	89 d6                	mov    %edx,%esi
+  8025c7:	83 d6 00             	adc    $0x0,%esi
+  8025ca:	f7 de                	neg    %esi
+  8025cc:	0f 48 e8             	cmovs  %eax,%ebp
+  8025cf:	0f 49 d6             	cmovns %esi,%edx
+  8025d2:	6a 00                	push   $0x0
+  8025d4:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8025d8:	f7 de                	neg    %esi
+  8025da:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8025de:	83 d0 00             	adc    $0x0,%eax
+  8025e1:	f7 d8                	neg    %eax
+  8025e3:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  8025e8:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  8025ed:	50                   	push   %eax
+  8025ee:	56                   	push   %esi
+  8025ef:	89 e8                	mov    %ebp,%eax
+  8025f1:	e8 92 fe ff ff       	call   802488 <udivmod>
+  8025f6:	83 c4 10             	add    $0x10,%esp
+  8025f9:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  8025fe:	78 08                	js     802608 <__divdi3+0x6a>
+  802600:	83 c4 0c             	add    $0xc,%esp
+  802603:	5b                   	pop    %ebx
+  802604:	5e                   	pop    %esi
+  802605:	5f                   	pop    %edi
+  802606:	5d                   	pop    %ebp
+  802607:	c3                   	ret
+  802608:	f7 d8                	neg    %eax
+  80260a:	83 d2 00             	adc    $0x0,%edx
+  80260d:	f7 da                	neg    %edx
+  80260f:	eb ef                	jmp    802600 <__divdi3+0x62>
+
+00802611 <__moddi3>:
+  802611:	55                   	push   %ebp
+  802612:	57                   	push   %edi
+  802613:	56                   	push   %esi
+  802614:	53                   	push   %ebx
+  802615:	83 ec 18             	sub    $0x18,%esp
+  802618:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80261c:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802620:	89 f1                	mov    %esi,%ecx
+  802622:	f7 d9                	neg    %ecx
+  802624:	89 da                	mov    %ebx,%edx
+  802626:	83 d2 00             	adc    $0x0,%edx
+  802629:	f7 da                	neg    %edx
+  80262b:	0f 48 ce             	cmovs  %esi,%ecx
+  80262e:	0f 48 d3             	cmovs  %ebx,%edx
+  802631:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802635:	50                   	push   %eax
+  802636:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80263a:	f7 de                	neg    %esi
+  80263c:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802640:	83 d0 00             	adc    $0x0,%eax
+  802643:	f7 d8                	neg    %eax
+  802645:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80264a:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  80264f:	50                   	push   %eax
+  802650:	56                   	push   %esi
+  802651:	89 c8                	mov    %ecx,%eax
+  802653:	e8 30 fe ff ff       	call   802488 <udivmod>
+  802658:	83 c4 10             	add    $0x10,%esp
+  80265b:	85 db                	test   %ebx,%ebx
+  80265d:	78 10                	js     80266f <__moddi3+0x5e>
+  80265f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802663:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802667:	83 c4 14             	add    $0x14,%esp
+  80266a:	5b                   	pop    %ebx
+  80266b:	5e                   	pop    %esi
+  80266c:	5f                   	pop    %edi
+  80266d:	5d                   	pop    %ebp
+  80266e:	c3                   	ret
+  80266f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802673:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802677:	f7 d8                	neg    %eax
+  802679:	83 d2 00             	adc    $0x0,%edx
+  80267c:	f7 da                	neg    %edx
+  80267e:	eb e7                	jmp    802667 <__moddi3+0x56>
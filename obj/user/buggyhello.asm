@@ -0,0 +1,5564 @@
+
+obj/user/buggyhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 16 00 00 00       	call   800047 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_cputs((char*)1, 1);
+  800039:	6a 01                	push   $0x1
+  80003b:	6a 01                	push   $0x1
+  80003d:	e8 8e 00 00 00       	call   8000d0 <sys_cputs>
+}
+  800042:	83 c4 10             	add    $0x10,%esp
+  800045:	c9                   	leave
+  800046:	c3                   	ret
+
+00800047 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800047:	55                   	push   %ebp
+  800048:	89 e5                	mov    %esp,%ebp
+  80004a:	56                   	push   %esi
+  80004b:	53                   	push   %ebx
+  80004c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80004f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800052:	e8 08 01 00 00       	call   80015f <sys_getenvid>
+  800057:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80005c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80005f:	c1 e0 06             	shl    $0x6,%eax
+  800062:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800067:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80006c:	85 db                	test   %ebx,%ebx
+  80006e:	7e 07                	jle    800077 <libmain+0x30>
+		binaryname = argv[0];
+  800070:	8b 06                	mov    (%esi),%eax
+  800072:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800077:	83 ec 08             	sub    $0x8,%esp
+  80007a:	56                   	push   %esi
+  80007b:	53                   	push   %ebx
+  80007c:	e8 b2 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800081:	e8 0a 00 00 00       	call   800090 <exit>
+}
+  800086:	83 c4 10             	add    $0x10,%esp
+  800089:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008c:	5b                   	pop    %ebx
+  80008d:	5e                   	pop    %esi
+  80008e:	5d                   	pop    %ebp
+  80008f:	c3                   	ret
+
+00800090 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800090:	55                   	push   %ebp
+  800091:	89 e5                	mov    %esp,%ebp
+  800093:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800096:	e8 68 08 00 00       	call   800903 <close_all>
+	sys_env_destroy(0);
+  80009b:	83 ec 0c             	sub    $0xc,%esp
+  80009e:	6a 00                	push   $0x0
+  8000a0:	e8 79 00 00 00       	call   80011e <sys_env_destroy>
+}
+  8000a5:	83 c4 10             	add    $0x10,%esp
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+
+008000aa <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  8000aa:	55                   	push   %ebp
+  8000ab:	89 e5                	mov    %esp,%ebp
+  8000ad:	83 ec 10             	sub    $0x10,%esp
+  8000b0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000b3:	89 c8                	mov    %ecx,%eax
+  8000b5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8000ba:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8000bd:	eb 0b                	jmp    8000ca <touch_mem+0x20>
+		c = *(char *)page;
+  8000bf:	0f b6 10             	movzbl (%eax),%edx
+  8000c2:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000c5:	05 00 10 00 00       	add    $0x1000,%eax
+  8000ca:	39 c8                	cmp    %ecx,%eax
+  8000cc:	72 f1                	jb     8000bf <touch_mem+0x15>
+}
+  8000ce:	c9                   	leave
+  8000cf:	c3                   	ret
+
+008000d0 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000d0:	55                   	push   %ebp
+  8000d1:	89 e5                	mov    %esp,%ebp
+  8000d3:	57                   	push   %edi
+  8000d4:	56                   	push   %esi
+  8000d5:	53                   	push   %ebx
+	touch_mem(s, len);
+  8000d6:	ff 75 0c             	push   0xc(%ebp)
+  8000d9:	ff 75 08             	push   0x8(%ebp)
+  8000dc:	e8 c9 ff ff ff       	call   8000aa <touch_mem>
+	asm volatile("int %1\n"
+  8000e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000ec:	89 c3                	mov    %eax,%ebx
+  8000ee:	89 c7                	mov    %eax,%edi
+  8000f0:	89 c6                	mov    %eax,%esi
+  8000f2:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000f4:	83 c4 08             	add    $0x8,%esp
+  8000f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000fa:	5b                   	pop    %ebx
+  8000fb:	5e                   	pop    %esi
+  8000fc:	5f                   	pop    %edi
+  8000fd:	5d                   	pop    %ebp
+  8000fe:	c3                   	ret
+
+008000ff <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000ff:	55                   	push   %ebp
+  800100:	89 e5                	mov    %esp,%ebp
+  800102:	57                   	push   %edi
+  800103:	56                   	push   %esi
+  800104:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800105:	ba 00 00 00 00       	mov    $0x0,%edx
+  80010a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80010f:	89 d1                	mov    %edx,%ecx
+  800111:	89 d3                	mov    %edx,%ebx
+  800113:	89 d7                	mov    %edx,%edi
+  800115:	89 d6                	mov    %edx,%esi
+  800117:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800119:	5b                   	pop    %ebx
+  80011a:	5e                   	pop    %esi
+  80011b:	5f                   	pop    %edi
+  80011c:	5d                   	pop    %ebp
+  80011d:	c3                   	ret
+
+0080011e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80011e:	55                   	push   %ebp
+  80011f:	89 e5                	mov    %esp,%ebp
+  800121:	57                   	push   %edi
+  800122:	56                   	push   %esi
+  800123:	53                   	push   %ebx
+  800124:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800127:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80012c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80012f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800134:	89 cb                	mov    %ecx,%ebx
+  800136:	89 cf                	mov    %ecx,%edi
+  800138:	89 ce                	mov    %ecx,%esi
+  80013a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80013c:	85 c0                	test   %eax,%eax
+  80013e:	7f 08                	jg     800148 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800140:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800143:	5b                   	pop    %ebx
+  800144:	5e                   	pop    %esi
+  800145:	5f                   	pop    %edi
+  800146:	5d                   	pop    %ebp
+  800147:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800148:	83 ec 0c             	sub    $0xc,%esp
+  80014b:	50                   	push   %eax
+  80014c:	6a 03                	push   $0x3
+  80014e:	68 aa 26 80 00       	push   $0x8026aa
+  800153:	6a 23                	push   $0x23
+  800155:	68 c7 26 80 00       	push   $0x8026c7
+  80015a:	e8 b9 15 00 00       	call   801718 <_panic>
+
+0080015f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80015f:	55                   	push   %ebp
+  800160:	89 e5                	mov    %esp,%ebp
+  800162:	57                   	push   %edi
+  800163:	56                   	push   %esi
+  800164:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800165:	ba 00 00 00 00       	mov    $0x0,%edx
+  80016a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80016f:	89 d1                	mov    %edx,%ecx
+  800171:	89 d3                	mov    %edx,%ebx
+  800173:	89 d7                	mov    %edx,%edi
+  800175:	89 d6                	mov    %edx,%esi
+  800177:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800179:	5b                   	pop    %ebx
+  80017a:	5e                   	pop    %esi
+  80017b:	5f                   	pop    %edi
+  80017c:	5d                   	pop    %ebp
+  80017d:	c3                   	ret
+
+0080017e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80017e:	55                   	push   %ebp
+  80017f:	89 e5                	mov    %esp,%ebp
+  800181:	57                   	push   %edi
+  800182:	56                   	push   %esi
+  800183:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800184:	ba 00 00 00 00       	mov    $0x0,%edx
+  800189:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80018e:	89 d1                	mov    %edx,%ecx
+  800190:	89 d3                	mov    %edx,%ebx
+  800192:	89 d7                	mov    %edx,%edi
+  800194:	89 d6                	mov    %edx,%esi
+  800196:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800198:	5b                   	pop    %ebx
+  800199:	5e                   	pop    %esi
+  80019a:	5f                   	pop    %edi
+  80019b:	5d                   	pop    %ebp
+  80019c:	c3                   	ret
+
+0080019d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80019d:	55                   	push   %ebp
+  80019e:	89 e5                	mov    %esp,%ebp
+  8001a0:	57                   	push   %edi
+  8001a1:	56                   	push   %esi
+  8001a2:	53                   	push   %ebx
+  8001a3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001b1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001b9:	89 f7                	mov    %esi,%edi
+  8001bb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001bd:	85 c0                	test   %eax,%eax
+  8001bf:	7f 08                	jg     8001c9 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c4:	5b                   	pop    %ebx
+  8001c5:	5e                   	pop    %esi
+  8001c6:	5f                   	pop    %edi
+  8001c7:	5d                   	pop    %ebp
+  8001c8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001c9:	83 ec 0c             	sub    $0xc,%esp
+  8001cc:	50                   	push   %eax
+  8001cd:	6a 04                	push   $0x4
+  8001cf:	68 aa 26 80 00       	push   $0x8026aa
+  8001d4:	6a 23                	push   $0x23
+  8001d6:	68 c7 26 80 00       	push   $0x8026c7
+  8001db:	e8 38 15 00 00       	call   801718 <_panic>
+
+008001e0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001e0:	55                   	push   %ebp
+  8001e1:	89 e5                	mov    %esp,%ebp
+  8001e3:	57                   	push   %edi
+  8001e4:	56                   	push   %esi
+  8001e5:	53                   	push   %ebx
+  8001e6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ef:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001f7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001fa:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001fd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001ff:	85 c0                	test   %eax,%eax
+  800201:	7f 08                	jg     80020b <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800203:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800206:	5b                   	pop    %ebx
+  800207:	5e                   	pop    %esi
+  800208:	5f                   	pop    %edi
+  800209:	5d                   	pop    %ebp
+  80020a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80020b:	83 ec 0c             	sub    $0xc,%esp
+  80020e:	50                   	push   %eax
+  80020f:	6a 05                	push   $0x5
+  800211:	68 aa 26 80 00       	push   $0x8026aa
+  800216:	6a 23                	push   $0x23
+  800218:	68 c7 26 80 00       	push   $0x8026c7
+  80021d:	e8 f6 14 00 00       	call   801718 <_panic>
+
+00800222 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800222:	55                   	push   %ebp
+  800223:	89 e5                	mov    %esp,%ebp
+  800225:	57                   	push   %edi
+  800226:	56                   	push   %esi
+  800227:	53                   	push   %ebx
+  800228:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80022b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800230:	8b 55 08             	mov    0x8(%ebp),%edx
+  800233:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800236:	b8 06 00 00 00       	mov    $0x6,%eax
+  80023b:	89 df                	mov    %ebx,%edi
+  80023d:	89 de                	mov    %ebx,%esi
+  80023f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800241:	85 c0                	test   %eax,%eax
+  800243:	7f 08                	jg     80024d <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800245:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800248:	5b                   	pop    %ebx
+  800249:	5e                   	pop    %esi
+  80024a:	5f                   	pop    %edi
+  80024b:	5d                   	pop    %ebp
+  80024c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80024d:	83 ec 0c             	sub    $0xc,%esp
+  800250:	50                   	push   %eax
+  800251:	6a 06                	push   $0x6
+  800253:	68 aa 26 80 00       	push   $0x8026aa
+  800258:	6a 23                	push   $0x23
+  80025a:	68 c7 26 80 00       	push   $0x8026c7
+  80025f:	e8 b4 14 00 00       	call   801718 <_panic>
+
+00800264 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800264:	55                   	push   %ebp
+  800265:	89 e5                	mov    %esp,%ebp
+  800267:	57                   	push   %edi
+  800268:	56                   	push   %esi
+  800269:	53                   	push   %ebx
+  80026a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80026d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800272:	8b 55 08             	mov    0x8(%ebp),%edx
+  800275:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800278:	b8 18 00 00 00       	mov    $0x18,%eax
+  80027d:	89 df                	mov    %ebx,%edi
+  80027f:	89 de                	mov    %ebx,%esi
+  800281:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800283:	85 c0                	test   %eax,%eax
+  800285:	7f 08                	jg     80028f <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800287:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028a:	5b                   	pop    %ebx
+  80028b:	5e                   	pop    %esi
+  80028c:	5f                   	pop    %edi
+  80028d:	5d                   	pop    %ebp
+  80028e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80028f:	83 ec 0c             	sub    $0xc,%esp
+  800292:	50                   	push   %eax
+  800293:	6a 18                	push   $0x18
+  800295:	68 aa 26 80 00       	push   $0x8026aa
+  80029a:	6a 23                	push   $0x23
+  80029c:	68 c7 26 80 00       	push   $0x8026c7
+  8002a1:	e8 72 14 00 00       	call   801718 <_panic>
+
+008002a6 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  8002a6:	55                   	push   %ebp
+  8002a7:	89 e5                	mov    %esp,%ebp
+  8002a9:	57                   	push   %edi
+  8002aa:	56                   	push   %esi
+  8002ab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002b7:	b8 19 00 00 00       	mov    $0x19,%eax
+  8002bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002bf:	89 f7                	mov    %esi,%edi
+  8002c1:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  8002c3:	5b                   	pop    %ebx
+  8002c4:	5e                   	pop    %esi
+  8002c5:	5f                   	pop    %edi
+  8002c6:	5d                   	pop    %ebp
+  8002c7:	c3                   	ret
+
+008002c8 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8002c8:	55                   	push   %ebp
+  8002c9:	89 e5                	mov    %esp,%ebp
+  8002cb:	57                   	push   %edi
+  8002cc:	56                   	push   %esi
+  8002cd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002d4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8002de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002e1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002e4:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8002e6:	5b                   	pop    %ebx
+  8002e7:	5e                   	pop    %esi
+  8002e8:	5f                   	pop    %edi
+  8002e9:	5d                   	pop    %ebp
+  8002ea:	c3                   	ret
+
+008002eb <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  8002eb:	55                   	push   %ebp
+  8002ec:	89 e5                	mov    %esp,%ebp
+  8002ee:	57                   	push   %edi
+  8002ef:	56                   	push   %esi
+  8002f0:	53                   	push   %ebx
+  8002f1:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  8002f4:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8002f7:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8002fd:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800300:	8b 55 08             	mov    0x8(%ebp),%edx
+  800303:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800306:	b8 10 00 00 00       	mov    $0x10,%eax
+  80030b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80030e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800311:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800313:	85 c0                	test   %eax,%eax
+  800315:	7f 08                	jg     80031f <sys_page_map_range+0x34>
+}
+  800317:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80031a:	5b                   	pop    %ebx
+  80031b:	5e                   	pop    %esi
+  80031c:	5f                   	pop    %edi
+  80031d:	5d                   	pop    %ebp
+  80031e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80031f:	83 ec 0c             	sub    $0xc,%esp
+  800322:	50                   	push   %eax
+  800323:	6a 10                	push   $0x10
+  800325:	68 aa 26 80 00       	push   $0x8026aa
+  80032a:	6a 23                	push   $0x23
+  80032c:	68 c7 26 80 00       	push   $0x8026c7
+  800331:	e8 e2 13 00 00       	call   801718 <_panic>
+
+00800336 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800336:	55                   	push   %ebp
+  800337:	89 e5                	mov    %esp,%ebp
+  800339:	57                   	push   %edi
+  80033a:	56                   	push   %esi
+  80033b:	53                   	push   %ebx
+  80033c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80033f:	be 00 00 00 00       	mov    $0x0,%esi
+  800344:	8b 55 08             	mov    0x8(%ebp),%edx
+  800347:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80034a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80034f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800352:	89 f7                	mov    %esi,%edi
+  800354:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800356:	85 c0                	test   %eax,%eax
+  800358:	7f 08                	jg     800362 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  80035a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80035d:	5b                   	pop    %ebx
+  80035e:	5e                   	pop    %esi
+  80035f:	5f                   	pop    %edi
+  800360:	5d                   	pop    %ebp
+  800361:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800362:	83 ec 0c             	sub    $0xc,%esp
+  800365:	50                   	push   %eax
+  800366:	6a 11                	push   $0x11
+  800368:	68 aa 26 80 00       	push   $0x8026aa
+  80036d:	6a 23                	push   $0x23
+  80036f:	68 c7 26 80 00       	push   $0x8026c7
+  800374:	e8 9f 13 00 00       	call   801718 <_panic>
+
+00800379 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800379:	55                   	push   %ebp
+  80037a:	89 e5                	mov    %esp,%ebp
+  80037c:	57                   	push   %edi
+  80037d:	56                   	push   %esi
+  80037e:	53                   	push   %ebx
+  80037f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800382:	be 00 00 00 00       	mov    $0x0,%esi
+  800387:	8b 55 08             	mov    0x8(%ebp),%edx
+  80038a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80038d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800392:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800395:	89 f7                	mov    %esi,%edi
+  800397:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800399:	85 c0                	test   %eax,%eax
+  80039b:	7f 08                	jg     8003a5 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  80039d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a0:	5b                   	pop    %ebx
+  8003a1:	5e                   	pop    %esi
+  8003a2:	5f                   	pop    %edi
+  8003a3:	5d                   	pop    %ebp
+  8003a4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003a5:	83 ec 0c             	sub    $0xc,%esp
+  8003a8:	50                   	push   %eax
+  8003a9:	6a 1b                	push   $0x1b
+  8003ab:	68 aa 26 80 00       	push   $0x8026aa
+  8003b0:	6a 23                	push   $0x23
+  8003b2:	68 c7 26 80 00       	push   $0x8026c7
+  8003b7:	e8 5c 13 00 00       	call   801718 <_panic>
+
+008003bc <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  8003bc:	55                   	push   %ebp
+  8003bd:	89 e5                	mov    %esp,%ebp
+  8003bf:	57                   	push   %edi
+  8003c0:	56                   	push   %esi
+  8003c1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003c7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003cc:	89 d1                	mov    %edx,%ecx
+  8003ce:	89 d3                	mov    %edx,%ebx
+  8003d0:	89 d7                	mov    %edx,%edi
+  8003d2:	89 d6                	mov    %edx,%esi
+  8003d4:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8003d6:	5b                   	pop    %ebx
+  8003d7:	5e                   	pop    %esi
+  8003d8:	5f                   	pop    %edi
+  8003d9:	5d                   	pop    %ebp
+  8003da:	c3                   	ret
+
+008003db <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003db:	55                   	push   %ebp
+  8003dc:	89 e5                	mov    %esp,%ebp
+  8003de:	57                   	push   %edi
+  8003df:	56                   	push   %esi
+  8003e0:	53                   	push   %ebx
+  8003e1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003ef:	b8 08 00 00 00       	mov    $0x8,%eax
+  8003f4:	89 df                	mov    %ebx,%edi
+  8003f6:	89 de                	mov    %ebx,%esi
+  8003f8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003fa:	85 c0                	test   %eax,%eax
+  8003fc:	7f 08                	jg     800406 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800401:	5b                   	pop    %ebx
+  800402:	5e                   	pop    %esi
+  800403:	5f                   	pop    %edi
+  800404:	5d                   	pop    %ebp
+  800405:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800406:	83 ec 0c             	sub    $0xc,%esp
+  800409:	50                   	push   %eax
+  80040a:	6a 08                	push   $0x8
+  80040c:	68 aa 26 80 00       	push   $0x8026aa
+  800411:	6a 23                	push   $0x23
+  800413:	68 c7 26 80 00       	push   $0x8026c7
+  800418:	e8 fb 12 00 00       	call   801718 <_panic>
+
+0080041d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80041d:	55                   	push   %ebp
+  80041e:	89 e5                	mov    %esp,%ebp
+  800420:	57                   	push   %edi
+  800421:	56                   	push   %esi
+  800422:	53                   	push   %ebx
+  800423:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800426:	6a 44                	push   $0x44
+  800428:	ff 75 0c             	push   0xc(%ebp)
+  80042b:	e8 7a fc ff ff       	call   8000aa <touch_mem>
+	asm volatile("int %1\n"
+  800430:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800435:	8b 55 08             	mov    0x8(%ebp),%edx
+  800438:	b8 09 00 00 00       	mov    $0x9,%eax
+  80043d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800440:	89 df                	mov    %ebx,%edi
+  800442:	89 de                	mov    %ebx,%esi
+  800444:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800446:	83 c4 08             	add    $0x8,%esp
+  800449:	85 c0                	test   %eax,%eax
+  80044b:	7f 08                	jg     800455 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80044d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800450:	5b                   	pop    %ebx
+  800451:	5e                   	pop    %esi
+  800452:	5f                   	pop    %edi
+  800453:	5d                   	pop    %ebp
+  800454:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800455:	83 ec 0c             	sub    $0xc,%esp
+  800458:	50                   	push   %eax
+  800459:	6a 09                	push   $0x9
+  80045b:	68 aa 26 80 00       	push   $0x8026aa
+  800460:	6a 23                	push   $0x23
+  800462:	68 c7 26 80 00       	push   $0x8026c7
+  800467:	e8 ac 12 00 00       	call   801718 <_panic>
+
+0080046c <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  80046c:	55                   	push   %ebp
+  80046d:	89 e5                	mov    %esp,%ebp
+  80046f:	57                   	push   %edi
+  800470:	56                   	push   %esi
+  800471:	53                   	push   %ebx
+  800472:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800475:	be 00 00 00 00       	mov    $0x0,%esi
+  80047a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80047d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800480:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800485:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800488:	89 f7                	mov    %esi,%edi
+  80048a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80048c:	85 c0                	test   %eax,%eax
+  80048e:	7f 08                	jg     800498 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800490:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800493:	5b                   	pop    %ebx
+  800494:	5e                   	pop    %esi
+  800495:	5f                   	pop    %edi
+  800496:	5d                   	pop    %ebp
+  800497:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800498:	83 ec 0c             	sub    $0xc,%esp
+  80049b:	50                   	push   %eax
+  80049c:	6a 1a                	push   $0x1a
+  80049e:	68 aa 26 80 00       	push   $0x8026aa
+  8004a3:	6a 23                	push   $0x23
+  8004a5:	68 c7 26 80 00       	push   $0x8026c7
+  8004aa:	e8 69 12 00 00       	call   801718 <_panic>
+
+008004af <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8004af:	55                   	push   %ebp
+  8004b0:	89 e5                	mov    %esp,%ebp
+  8004b2:	57                   	push   %edi
+  8004b3:	56                   	push   %esi
+  8004b4:	53                   	push   %ebx
+  8004b5:	83 ec 0c             	sub    $0xc,%esp
+  8004b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8004bb:	89 d8                	mov    %ebx,%eax
+  8004bd:	c1 e0 05             	shl    $0x5,%eax
+  8004c0:	50                   	push   %eax
+  8004c1:	ff 75 0c             	push   0xc(%ebp)
+  8004c4:	e8 e1 fb ff ff       	call   8000aa <touch_mem>
+	asm volatile("int %1\n"
+  8004c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8004ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004d1:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004d9:	89 f7                	mov    %esi,%edi
+  8004db:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004dd:	83 c4 08             	add    $0x8,%esp
+  8004e0:	85 c0                	test   %eax,%eax
+  8004e2:	7f 08                	jg     8004ec <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8004e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004e7:	5b                   	pop    %ebx
+  8004e8:	5e                   	pop    %esi
+  8004e9:	5f                   	pop    %edi
+  8004ea:	5d                   	pop    %ebp
+  8004eb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004ec:	83 ec 0c             	sub    $0xc,%esp
+  8004ef:	50                   	push   %eax
+  8004f0:	6a 13                	push   $0x13
+  8004f2:	68 aa 26 80 00       	push   $0x8026aa
+  8004f7:	6a 23                	push   $0x23
+  8004f9:	68 c7 26 80 00       	push   $0x8026c7
+  8004fe:	e8 15 12 00 00       	call   801718 <_panic>
+
+00800503 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800503:	55                   	push   %ebp
+  800504:	89 e5                	mov    %esp,%ebp
+  800506:	57                   	push   %edi
+  800507:	56                   	push   %esi
+  800508:	53                   	push   %ebx
+  800509:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80050c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800511:	8b 55 08             	mov    0x8(%ebp),%edx
+  800514:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800517:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80051c:	89 df                	mov    %ebx,%edi
+  80051e:	89 de                	mov    %ebx,%esi
+  800520:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800522:	85 c0                	test   %eax,%eax
+  800524:	7f 08                	jg     80052e <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800526:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800529:	5b                   	pop    %ebx
+  80052a:	5e                   	pop    %esi
+  80052b:	5f                   	pop    %edi
+  80052c:	5d                   	pop    %ebp
+  80052d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80052e:	83 ec 0c             	sub    $0xc,%esp
+  800531:	50                   	push   %eax
+  800532:	6a 0a                	push   $0xa
+  800534:	68 aa 26 80 00       	push   $0x8026aa
+  800539:	6a 23                	push   $0x23
+  80053b:	68 c7 26 80 00       	push   $0x8026c7
+  800540:	e8 d3 11 00 00       	call   801718 <_panic>
+
+00800545 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800545:	55                   	push   %ebp
+  800546:	89 e5                	mov    %esp,%ebp
+  800548:	57                   	push   %edi
+  800549:	56                   	push   %esi
+  80054a:	53                   	push   %ebx
+  80054b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  80054e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800554:	76 1d                	jbe    800573 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  800556:	8b 55 08             	mov    0x8(%ebp),%edx
+  800559:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80055c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800561:	be 01 00 00 00       	mov    $0x1,%esi
+  800566:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800569:	cd 30                	int    $0x30
+}
+  80056b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80056e:	5b                   	pop    %ebx
+  80056f:	5e                   	pop    %esi
+  800570:	5f                   	pop    %edi
+  800571:	5d                   	pop    %ebp
+  800572:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  800573:	68 00 10 00 00       	push   $0x1000
+  800578:	53                   	push   %ebx
+  800579:	e8 2c fb ff ff       	call   8000aa <touch_mem>
+  80057e:	83 c4 08             	add    $0x8,%esp
+  800581:	eb d3                	jmp    800556 <sys_ipc_send+0x11>
+
+00800583 <sys_ipc_send_pages>:
+{
+  800583:	55                   	push   %ebp
+  800584:	89 e5                	mov    %esp,%ebp
+  800586:	57                   	push   %edi
+  800587:	56                   	push   %esi
+  800588:	53                   	push   %ebx
+  800589:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80058c:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  80058f:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800595:	76 18                	jbe    8005af <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  800597:	8b 55 08             	mov    0x8(%ebp),%edx
+  80059a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80059d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8005a2:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8005a5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8005a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005aa:	5b                   	pop    %ebx
+  8005ab:	5e                   	pop    %esi
+  8005ac:	5f                   	pop    %edi
+  8005ad:	5d                   	pop    %ebp
+  8005ae:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8005af:	89 f0                	mov    %esi,%eax
+  8005b1:	c1 e0 0c             	shl    $0xc,%eax
+  8005b4:	50                   	push   %eax
+  8005b5:	53                   	push   %ebx
+  8005b6:	e8 ef fa ff ff       	call   8000aa <touch_mem>
+  8005bb:	83 c4 08             	add    $0x8,%esp
+  8005be:	eb d7                	jmp    800597 <sys_ipc_send_pages+0x14>
+
+008005c0 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8005c0:	55                   	push   %ebp
+  8005c1:	89 e5                	mov    %esp,%ebp
+  8005c3:	57                   	push   %edi
+  8005c4:	56                   	push   %esi
+  8005c5:	53                   	push   %ebx
+  8005c6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8005c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005d4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8005d9:	89 df                	mov    %ebx,%edi
+  8005db:	89 de                	mov    %ebx,%esi
+  8005dd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8005df:	85 c0                	test   %eax,%eax
+  8005e1:	7f 08                	jg     8005eb <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8005e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005e6:	5b                   	pop    %ebx
+  8005e7:	5e                   	pop    %esi
+  8005e8:	5f                   	pop    %edi
+  8005e9:	5d                   	pop    %ebp
+  8005ea:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8005eb:	83 ec 0c             	sub    $0xc,%esp
+  8005ee:	50                   	push   %eax
+  8005ef:	6a 0d                	push   $0xd
+  8005f1:	68 aa 26 80 00       	push   $0x8026aa
+  8005f6:	6a 23                	push   $0x23
+  8005f8:	68 c7 26 80 00       	push   $0x8026c7
+  8005fd:	e8 16 11 00 00       	call   801718 <_panic>
+
+00800602 <sys_ipc_recv>:
+{
+  800602:	55                   	push   %ebp
+  800603:	89 e5                	mov    %esp,%ebp
+  800605:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  800608:	6a 01                	push   $0x1
+  80060a:	ff 75 08             	push   0x8(%ebp)
+  80060d:	e8 ae ff ff ff       	call   8005c0 <sys_ipc_recv_pages>
+}
+  800612:	c9                   	leave
+  800613:	c3                   	ret
+
+00800614 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  800614:	55                   	push   %ebp
+  800615:	89 e5                	mov    %esp,%ebp
+  800617:	57                   	push   %edi
+  800618:	56                   	push   %esi
+  800619:	53                   	push   %ebx
+  80061a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80061d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800620:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  800623:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800629:	77 04                	ja     80062f <sys_ipc_call+0x1b>
+  80062b:	85 f6                	test   %esi,%esi
+  80062d:	75 15                	jne    800644 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  80062f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800632:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800635:	b8 14 00 00 00       	mov    $0x14,%eax
+  80063a:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80063c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80063f:	5b                   	pop    %ebx
+  800640:	5e                   	pop    %esi
+  800641:	5f                   	pop    %edi
+  800642:	5d                   	pop    %ebp
+  800643:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  800644:	89 f8                	mov    %edi,%eax
+  800646:	c1 e0 0c             	shl    $0xc,%eax
+  800649:	50                   	push   %eax
+  80064a:	53                   	push   %ebx
+  80064b:	e8 5a fa ff ff       	call   8000aa <touch_mem>
+  800650:	83 c4 08             	add    $0x8,%esp
+  800653:	eb da                	jmp    80062f <sys_ipc_call+0x1b>
+
+00800655 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  800655:	55                   	push   %ebp
+  800656:	89 e5                	mov    %esp,%ebp
+  800658:	57                   	push   %edi
+  800659:	56                   	push   %esi
+  80065a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80065b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80065e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800661:	b8 15 00 00 00       	mov    $0x15,%eax
+  800666:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800669:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80066c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80066f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  800671:	5b                   	pop    %ebx
+  800672:	5e                   	pop    %esi
+  800673:	5f                   	pop    %edi
+  800674:	5d                   	pop    %ebp
+  800675:	c3                   	ret
+
+00800676 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  800676:	55                   	push   %ebp
+  800677:	89 e5                	mov    %esp,%ebp
+  800679:	57                   	push   %edi
+  80067a:	56                   	push   %esi
+  80067b:	53                   	push   %ebx
+  80067c:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  80067f:	6a 04                	push   $0x4
+  800681:	ff 75 08             	push   0x8(%ebp)
+  800684:	e8 21 fa ff ff       	call   8000aa <touch_mem>
+	asm volatile("int %1\n"
+  800689:	be 00 00 00 00       	mov    $0x0,%esi
+  80068e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800691:	b8 16 00 00 00       	mov    $0x16,%eax
+  800696:	8b 55 08             	mov    0x8(%ebp),%edx
+  800699:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80069c:	89 f7                	mov    %esi,%edi
+  80069e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8006a0:	83 c4 08             	add    $0x8,%esp
+  8006a3:	85 c0                	test   %eax,%eax
+  8006a5:	7f 08                	jg     8006af <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8006a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006aa:	5b                   	pop    %ebx
+  8006ab:	5e                   	pop    %esi
+  8006ac:	5f                   	pop    %edi
+  8006ad:	5d                   	pop    %ebp
+  8006ae:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006af:	83 ec 0c             	sub    $0xc,%esp
+  8006b2:	50                   	push   %eax
+  8006b3:	6a 16                	push   $0x16
+  8006b5:	68 aa 26 80 00       	push   $0x8026aa
+  8006ba:	6a 23                	push   $0x23
+  8006bc:	68 c7 26 80 00       	push   $0x8026c7
+  8006c1:	e8 52 10 00 00       	call   801718 <_panic>
+
+008006c6 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8006c6:	55                   	push   %ebp
+  8006c7:	89 e5                	mov    %esp,%ebp
+  8006c9:	57                   	push   %edi
+  8006ca:	56                   	push   %esi
+  8006cb:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8006cc:	6a 04                	push   $0x4
+  8006ce:	ff 75 08             	push   0x8(%ebp)
+  8006d1:	e8 d4 f9 ff ff       	call   8000aa <touch_mem>
+	asm volatile("int %1\n"
+  8006d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006de:	b8 17 00 00 00       	mov    $0x17,%eax
+  8006e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006e6:	89 df                	mov    %ebx,%edi
+  8006e8:	89 de                	mov    %ebx,%esi
+  8006ea:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8006ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006ef:	5b                   	pop    %ebx
+  8006f0:	5e                   	pop    %esi
+  8006f1:	5f                   	pop    %edi
+  8006f2:	5d                   	pop    %ebp
+  8006f3:	c3                   	ret
+
+008006f4 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8006f4:	55                   	push   %ebp
+  8006f5:	89 e5                	mov    %esp,%ebp
+  8006f7:	57                   	push   %edi
+  8006f8:	56                   	push   %esi
+  8006f9:	53                   	push   %ebx
+  8006fa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8006fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800702:	8b 55 08             	mov    0x8(%ebp),%edx
+  800705:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80070a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80070f:	89 df                	mov    %ebx,%edi
+  800711:	89 de                	mov    %ebx,%esi
+  800713:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800715:	85 c0                	test   %eax,%eax
+  800717:	7f 08                	jg     800721 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  800719:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80071c:	5b                   	pop    %ebx
+  80071d:	5e                   	pop    %esi
+  80071e:	5f                   	pop    %edi
+  80071f:	5d                   	pop    %ebp
+  800720:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800721:	83 ec 0c             	sub    $0xc,%esp
+  800724:	50                   	push   %eax
+  800725:	6a 0e                	push   $0xe
+  800727:	68 aa 26 80 00       	push   $0x8026aa
+  80072c:	6a 23                	push   $0x23
+  80072e:	68 c7 26 80 00       	push   $0x8026c7
+  800733:	e8 e0 0f 00 00       	call   801718 <_panic>
+
+00800738 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800738:	55                   	push   %ebp
+  800739:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80073b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80073e:	05 00 00 00 30       	add    $0x30000000,%eax
+  800743:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800746:	5d                   	pop    %ebp
+  800747:	c3                   	ret
+
+00800748 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800748:	55                   	push   %ebp
+  800749:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80074b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80074e:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800753:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800758:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80075d:	5d                   	pop    %ebp
+  80075e:	c3                   	ret
+
+0080075f <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80075f:	55                   	push   %ebp
+  800760:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  800762:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  800767:	a8 01                	test   $0x1,%al
+  800769:	74 3c                	je     8007a7 <fd_alloc+0x48>
+  80076b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800770:	89 c2                	mov    %eax,%edx
+  800772:	c1 ea 0c             	shr    $0xc,%edx
+  800775:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80077c:	89 c1                	mov    %eax,%ecx
+  80077e:	05 00 10 00 00       	add    $0x1000,%eax
+  800783:	f6 c2 01             	test   $0x1,%dl
+  800786:	74 13                	je     80079b <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  800788:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80078d:	75 e1                	jne    800770 <fd_alloc+0x11>
+  80078f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800794:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  800799:	eb 05                	jmp    8007a0 <fd_alloc+0x41>
+			return 0;
+  80079b:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8007a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007a3:	89 0a                	mov    %ecx,(%edx)
+}
+  8007a5:	5d                   	pop    %ebp
+  8007a6:	c3                   	ret
+  8007a7:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8007ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b1:	eb ed                	jmp    8007a0 <fd_alloc+0x41>
+
+008007b3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8007b3:	55                   	push   %ebp
+  8007b4:	89 e5                	mov    %esp,%ebp
+  8007b6:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8007b9:	83 f8 1f             	cmp    $0x1f,%eax
+  8007bc:	77 30                	ja     8007ee <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8007be:	c1 e0 0c             	shl    $0xc,%eax
+  8007c1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8007c6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8007cc:	f6 c2 01             	test   $0x1,%dl
+  8007cf:	74 24                	je     8007f5 <fd_lookup+0x42>
+  8007d1:	89 c2                	mov    %eax,%edx
+  8007d3:	c1 ea 0c             	shr    $0xc,%edx
+  8007d6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8007dd:	f6 c2 01             	test   $0x1,%dl
+  8007e0:	74 1a                	je     8007fc <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8007e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007e5:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8007e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007ec:	5d                   	pop    %ebp
+  8007ed:	c3                   	ret
+		return -E_INVAL;
+  8007ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007f3:	eb f7                	jmp    8007ec <fd_lookup+0x39>
+		return -E_INVAL;
+  8007f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007fa:	eb f0                	jmp    8007ec <fd_lookup+0x39>
+  8007fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800801:	eb e9                	jmp    8007ec <fd_lookup+0x39>
+
+00800803 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800803:	55                   	push   %ebp
+  800804:	89 e5                	mov    %esp,%ebp
+  800806:	53                   	push   %ebx
+  800807:	83 ec 04             	sub    $0x4,%esp
+  80080a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80080d:	b8 54 27 80 00       	mov    $0x802754,%eax
+  800812:	8b 18                	mov    (%eax),%ebx
+  800814:	85 db                	test   %ebx,%ebx
+  800816:	74 0e                	je     800826 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  800818:	83 c0 04             	add    $0x4,%eax
+  80081b:	39 13                	cmp    %edx,(%ebx)
+  80081d:	75 f3                	jne    800812 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  80081f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800824:	eb 1f                	jmp    800845 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800826:	a1 08 40 80 00       	mov    0x804008,%eax
+  80082b:	8b 40 48             	mov    0x48(%eax),%eax
+  80082e:	83 ec 04             	sub    $0x4,%esp
+  800831:	52                   	push   %edx
+  800832:	50                   	push   %eax
+  800833:	68 d8 26 80 00       	push   $0x8026d8
+  800838:	e8 b6 0f 00 00       	call   8017f3 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80083d:	83 c4 10             	add    $0x10,%esp
+  800840:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800845:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800848:	89 1a                	mov    %ebx,(%edx)
+}
+  80084a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80084d:	c9                   	leave
+  80084e:	c3                   	ret
+
+0080084f <fd_close>:
+{
+  80084f:	55                   	push   %ebp
+  800850:	89 e5                	mov    %esp,%ebp
+  800852:	57                   	push   %edi
+  800853:	56                   	push   %esi
+  800854:	53                   	push   %ebx
+  800855:	83 ec 24             	sub    $0x24,%esp
+  800858:	8b 75 08             	mov    0x8(%ebp),%esi
+  80085b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80085e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800861:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800862:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800868:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80086b:	50                   	push   %eax
+  80086c:	e8 42 ff ff ff       	call   8007b3 <fd_lookup>
+  800871:	89 c3                	mov    %eax,%ebx
+  800873:	83 c4 10             	add    $0x10,%esp
+  800876:	85 c0                	test   %eax,%eax
+  800878:	78 05                	js     80087f <fd_close+0x30>
+	    || fd != fd2)
+  80087a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80087d:	74 16                	je     800895 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80087f:	89 f8                	mov    %edi,%eax
+  800881:	84 c0                	test   %al,%al
+  800883:	b8 00 00 00 00       	mov    $0x0,%eax
+  800888:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80088b:	89 d8                	mov    %ebx,%eax
+  80088d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800890:	5b                   	pop    %ebx
+  800891:	5e                   	pop    %esi
+  800892:	5f                   	pop    %edi
+  800893:	5d                   	pop    %ebp
+  800894:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800895:	83 ec 08             	sub    $0x8,%esp
+  800898:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80089b:	50                   	push   %eax
+  80089c:	ff 36                	push   (%esi)
+  80089e:	e8 60 ff ff ff       	call   800803 <dev_lookup>
+  8008a3:	89 c3                	mov    %eax,%ebx
+  8008a5:	83 c4 10             	add    $0x10,%esp
+  8008a8:	85 c0                	test   %eax,%eax
+  8008aa:	78 1a                	js     8008c6 <fd_close+0x77>
+		if (dev->dev_close)
+  8008ac:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008af:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8008b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8008b7:	85 c0                	test   %eax,%eax
+  8008b9:	74 0b                	je     8008c6 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8008bb:	83 ec 0c             	sub    $0xc,%esp
+  8008be:	56                   	push   %esi
+  8008bf:	ff d0                	call   *%eax
+  8008c1:	89 c3                	mov    %eax,%ebx
+  8008c3:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8008c6:	83 ec 08             	sub    $0x8,%esp
+  8008c9:	56                   	push   %esi
+  8008ca:	6a 00                	push   $0x0
+  8008cc:	e8 51 f9 ff ff       	call   800222 <sys_page_unmap>
+	return r;
+  8008d1:	83 c4 10             	add    $0x10,%esp
+  8008d4:	eb b5                	jmp    80088b <fd_close+0x3c>
+
+008008d6 <close>:
+
+int
+close(int fdnum)
+{
+  8008d6:	55                   	push   %ebp
+  8008d7:	89 e5                	mov    %esp,%ebp
+  8008d9:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8008dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008df:	50                   	push   %eax
+  8008e0:	ff 75 08             	push   0x8(%ebp)
+  8008e3:	e8 cb fe ff ff       	call   8007b3 <fd_lookup>
+  8008e8:	83 c4 10             	add    $0x10,%esp
+  8008eb:	85 c0                	test   %eax,%eax
+  8008ed:	79 02                	jns    8008f1 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8008ef:	c9                   	leave
+  8008f0:	c3                   	ret
+		return fd_close(fd, 1);
+  8008f1:	83 ec 08             	sub    $0x8,%esp
+  8008f4:	6a 01                	push   $0x1
+  8008f6:	ff 75 f4             	push   -0xc(%ebp)
+  8008f9:	e8 51 ff ff ff       	call   80084f <fd_close>
+  8008fe:	83 c4 10             	add    $0x10,%esp
+  800901:	eb ec                	jmp    8008ef <close+0x19>
+
+00800903 <close_all>:
+
+void
+close_all(void)
+{
+  800903:	55                   	push   %ebp
+  800904:	89 e5                	mov    %esp,%ebp
+  800906:	53                   	push   %ebx
+  800907:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80090a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80090f:	83 ec 0c             	sub    $0xc,%esp
+  800912:	53                   	push   %ebx
+  800913:	e8 be ff ff ff       	call   8008d6 <close>
+	for (i = 0; i < MAXFD; i++)
+  800918:	83 c3 01             	add    $0x1,%ebx
+  80091b:	83 c4 10             	add    $0x10,%esp
+  80091e:	83 fb 20             	cmp    $0x20,%ebx
+  800921:	75 ec                	jne    80090f <close_all+0xc>
+}
+  800923:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800926:	c9                   	leave
+  800927:	c3                   	ret
+
+00800928 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800928:	55                   	push   %ebp
+  800929:	89 e5                	mov    %esp,%ebp
+  80092b:	57                   	push   %edi
+  80092c:	56                   	push   %esi
+  80092d:	53                   	push   %ebx
+  80092e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800931:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800934:	50                   	push   %eax
+  800935:	ff 75 08             	push   0x8(%ebp)
+  800938:	e8 76 fe ff ff       	call   8007b3 <fd_lookup>
+  80093d:	89 c3                	mov    %eax,%ebx
+  80093f:	83 c4 10             	add    $0x10,%esp
+  800942:	85 c0                	test   %eax,%eax
+  800944:	78 7f                	js     8009c5 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800946:	83 ec 0c             	sub    $0xc,%esp
+  800949:	ff 75 0c             	push   0xc(%ebp)
+  80094c:	e8 85 ff ff ff       	call   8008d6 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800951:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800954:	c1 e6 0c             	shl    $0xc,%esi
+  800957:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80095d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800960:	89 3c 24             	mov    %edi,(%esp)
+  800963:	e8 e0 fd ff ff       	call   800748 <fd2data>
+  800968:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80096a:	89 34 24             	mov    %esi,(%esp)
+  80096d:	e8 d6 fd ff ff       	call   800748 <fd2data>
+  800972:	83 c4 10             	add    $0x10,%esp
+  800975:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800978:	89 d8                	mov    %ebx,%eax
+  80097a:	c1 e8 16             	shr    $0x16,%eax
+  80097d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800984:	a8 01                	test   $0x1,%al
+  800986:	74 11                	je     800999 <dup+0x71>
+  800988:	89 d8                	mov    %ebx,%eax
+  80098a:	c1 e8 0c             	shr    $0xc,%eax
+  80098d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800994:	f6 c2 01             	test   $0x1,%dl
+  800997:	75 36                	jne    8009cf <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800999:	89 f8                	mov    %edi,%eax
+  80099b:	c1 e8 0c             	shr    $0xc,%eax
+  80099e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8009a5:	83 ec 0c             	sub    $0xc,%esp
+  8009a8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8009ad:	50                   	push   %eax
+  8009ae:	56                   	push   %esi
+  8009af:	6a 00                	push   $0x0
+  8009b1:	57                   	push   %edi
+  8009b2:	6a 00                	push   $0x0
+  8009b4:	e8 27 f8 ff ff       	call   8001e0 <sys_page_map>
+  8009b9:	89 c3                	mov    %eax,%ebx
+  8009bb:	83 c4 20             	add    $0x20,%esp
+  8009be:	85 c0                	test   %eax,%eax
+  8009c0:	78 33                	js     8009f5 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8009c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8009c5:	89 d8                	mov    %ebx,%eax
+  8009c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009ca:	5b                   	pop    %ebx
+  8009cb:	5e                   	pop    %esi
+  8009cc:	5f                   	pop    %edi
+  8009cd:	5d                   	pop    %ebp
+  8009ce:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8009cf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8009d6:	83 ec 0c             	sub    $0xc,%esp
+  8009d9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8009de:	50                   	push   %eax
+  8009df:	ff 75 d4             	push   -0x2c(%ebp)
+  8009e2:	6a 00                	push   $0x0
+  8009e4:	53                   	push   %ebx
+  8009e5:	6a 00                	push   $0x0
+  8009e7:	e8 f4 f7 ff ff       	call   8001e0 <sys_page_map>
+  8009ec:	89 c3                	mov    %eax,%ebx
+  8009ee:	83 c4 20             	add    $0x20,%esp
+  8009f1:	85 c0                	test   %eax,%eax
+  8009f3:	79 a4                	jns    800999 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8009f5:	83 ec 08             	sub    $0x8,%esp
+  8009f8:	56                   	push   %esi
+  8009f9:	6a 00                	push   $0x0
+  8009fb:	e8 22 f8 ff ff       	call   800222 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800a00:	83 c4 08             	add    $0x8,%esp
+  800a03:	ff 75 d4             	push   -0x2c(%ebp)
+  800a06:	6a 00                	push   $0x0
+  800a08:	e8 15 f8 ff ff       	call   800222 <sys_page_unmap>
+	return r;
+  800a0d:	83 c4 10             	add    $0x10,%esp
+  800a10:	eb b3                	jmp    8009c5 <dup+0x9d>
+
+00800a12 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800a12:	55                   	push   %ebp
+  800a13:	89 e5                	mov    %esp,%ebp
+  800a15:	56                   	push   %esi
+  800a16:	53                   	push   %ebx
+  800a17:	83 ec 18             	sub    $0x18,%esp
+  800a1a:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a1d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a20:	50                   	push   %eax
+  800a21:	56                   	push   %esi
+  800a22:	e8 8c fd ff ff       	call   8007b3 <fd_lookup>
+  800a27:	83 c4 10             	add    $0x10,%esp
+  800a2a:	85 c0                	test   %eax,%eax
+  800a2c:	78 3c                	js     800a6a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a2e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a31:	83 ec 08             	sub    $0x8,%esp
+  800a34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a37:	50                   	push   %eax
+  800a38:	ff 33                	push   (%ebx)
+  800a3a:	e8 c4 fd ff ff       	call   800803 <dev_lookup>
+  800a3f:	83 c4 10             	add    $0x10,%esp
+  800a42:	85 c0                	test   %eax,%eax
+  800a44:	78 24                	js     800a6a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a46:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a49:	83 e0 03             	and    $0x3,%eax
+  800a4c:	83 f8 01             	cmp    $0x1,%eax
+  800a4f:	74 20                	je     800a71 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800a51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a54:	8b 40 08             	mov    0x8(%eax),%eax
+  800a57:	85 c0                	test   %eax,%eax
+  800a59:	74 37                	je     800a92 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800a5b:	83 ec 04             	sub    $0x4,%esp
+  800a5e:	ff 75 10             	push   0x10(%ebp)
+  800a61:	ff 75 0c             	push   0xc(%ebp)
+  800a64:	53                   	push   %ebx
+  800a65:	ff d0                	call   *%eax
+  800a67:	83 c4 10             	add    $0x10,%esp
+}
+  800a6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a6d:	5b                   	pop    %ebx
+  800a6e:	5e                   	pop    %esi
+  800a6f:	5d                   	pop    %ebp
+  800a70:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a71:	a1 08 40 80 00       	mov    0x804008,%eax
+  800a76:	8b 40 48             	mov    0x48(%eax),%eax
+  800a79:	83 ec 04             	sub    $0x4,%esp
+  800a7c:	56                   	push   %esi
+  800a7d:	50                   	push   %eax
+  800a7e:	68 19 27 80 00       	push   $0x802719
+  800a83:	e8 6b 0d 00 00       	call   8017f3 <cprintf>
+		return -E_INVAL;
+  800a88:	83 c4 10             	add    $0x10,%esp
+  800a8b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a90:	eb d8                	jmp    800a6a <read+0x58>
+		return -E_NOT_SUPP;
+  800a92:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a97:	eb d1                	jmp    800a6a <read+0x58>
+
+00800a99 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a99:	55                   	push   %ebp
+  800a9a:	89 e5                	mov    %esp,%ebp
+  800a9c:	57                   	push   %edi
+  800a9d:	56                   	push   %esi
+  800a9e:	53                   	push   %ebx
+  800a9f:	83 ec 0c             	sub    $0xc,%esp
+  800aa2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800aa5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800aa8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800aad:	eb 02                	jmp    800ab1 <readn+0x18>
+  800aaf:	01 c3                	add    %eax,%ebx
+  800ab1:	39 f3                	cmp    %esi,%ebx
+  800ab3:	73 21                	jae    800ad6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800ab5:	83 ec 04             	sub    $0x4,%esp
+  800ab8:	89 f0                	mov    %esi,%eax
+  800aba:	29 d8                	sub    %ebx,%eax
+  800abc:	50                   	push   %eax
+  800abd:	89 d8                	mov    %ebx,%eax
+  800abf:	03 45 0c             	add    0xc(%ebp),%eax
+  800ac2:	50                   	push   %eax
+  800ac3:	57                   	push   %edi
+  800ac4:	e8 49 ff ff ff       	call   800a12 <read>
+		if (m < 0)
+  800ac9:	83 c4 10             	add    $0x10,%esp
+  800acc:	85 c0                	test   %eax,%eax
+  800ace:	78 04                	js     800ad4 <readn+0x3b>
+			return m;
+		if (m == 0)
+  800ad0:	75 dd                	jne    800aaf <readn+0x16>
+  800ad2:	eb 02                	jmp    800ad6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800ad4:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800ad6:	89 d8                	mov    %ebx,%eax
+  800ad8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800adb:	5b                   	pop    %ebx
+  800adc:	5e                   	pop    %esi
+  800add:	5f                   	pop    %edi
+  800ade:	5d                   	pop    %ebp
+  800adf:	c3                   	ret
+
+00800ae0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800ae0:	55                   	push   %ebp
+  800ae1:	89 e5                	mov    %esp,%ebp
+  800ae3:	56                   	push   %esi
+  800ae4:	53                   	push   %ebx
+  800ae5:	83 ec 18             	sub    $0x18,%esp
+  800ae8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800aeb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800aee:	50                   	push   %eax
+  800aef:	53                   	push   %ebx
+  800af0:	e8 be fc ff ff       	call   8007b3 <fd_lookup>
+  800af5:	83 c4 10             	add    $0x10,%esp
+  800af8:	85 c0                	test   %eax,%eax
+  800afa:	78 37                	js     800b33 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800afc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800aff:	83 ec 08             	sub    $0x8,%esp
+  800b02:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b05:	50                   	push   %eax
+  800b06:	ff 36                	push   (%esi)
+  800b08:	e8 f6 fc ff ff       	call   800803 <dev_lookup>
+  800b0d:	83 c4 10             	add    $0x10,%esp
+  800b10:	85 c0                	test   %eax,%eax
+  800b12:	78 1f                	js     800b33 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b14:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b18:	74 20                	je     800b3a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800b1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b1d:	8b 40 0c             	mov    0xc(%eax),%eax
+  800b20:	85 c0                	test   %eax,%eax
+  800b22:	74 37                	je     800b5b <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800b24:	83 ec 04             	sub    $0x4,%esp
+  800b27:	ff 75 10             	push   0x10(%ebp)
+  800b2a:	ff 75 0c             	push   0xc(%ebp)
+  800b2d:	56                   	push   %esi
+  800b2e:	ff d0                	call   *%eax
+  800b30:	83 c4 10             	add    $0x10,%esp
+}
+  800b33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b36:	5b                   	pop    %ebx
+  800b37:	5e                   	pop    %esi
+  800b38:	5d                   	pop    %ebp
+  800b39:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b3a:	a1 08 40 80 00       	mov    0x804008,%eax
+  800b3f:	8b 40 48             	mov    0x48(%eax),%eax
+  800b42:	83 ec 04             	sub    $0x4,%esp
+  800b45:	53                   	push   %ebx
+  800b46:	50                   	push   %eax
+  800b47:	68 35 27 80 00       	push   $0x802735
+  800b4c:	e8 a2 0c 00 00       	call   8017f3 <cprintf>
+		return -E_INVAL;
+  800b51:	83 c4 10             	add    $0x10,%esp
+  800b54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b59:	eb d8                	jmp    800b33 <write+0x53>
+		return -E_NOT_SUPP;
+  800b5b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b60:	eb d1                	jmp    800b33 <write+0x53>
+
+00800b62 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b62:	55                   	push   %ebp
+  800b63:	89 e5                	mov    %esp,%ebp
+  800b65:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b68:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b6b:	50                   	push   %eax
+  800b6c:	ff 75 08             	push   0x8(%ebp)
+  800b6f:	e8 3f fc ff ff       	call   8007b3 <fd_lookup>
+  800b74:	83 c4 10             	add    $0x10,%esp
+  800b77:	85 c0                	test   %eax,%eax
+  800b79:	78 0e                	js     800b89 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b7b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b81:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800b84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b89:	c9                   	leave
+  800b8a:	c3                   	ret
+
+00800b8b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b8b:	55                   	push   %ebp
+  800b8c:	89 e5                	mov    %esp,%ebp
+  800b8e:	56                   	push   %esi
+  800b8f:	53                   	push   %ebx
+  800b90:	83 ec 18             	sub    $0x18,%esp
+  800b93:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b96:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b99:	50                   	push   %eax
+  800b9a:	53                   	push   %ebx
+  800b9b:	e8 13 fc ff ff       	call   8007b3 <fd_lookup>
+  800ba0:	83 c4 10             	add    $0x10,%esp
+  800ba3:	85 c0                	test   %eax,%eax
+  800ba5:	78 34                	js     800bdb <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800ba7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800baa:	83 ec 08             	sub    $0x8,%esp
+  800bad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bb0:	50                   	push   %eax
+  800bb1:	ff 36                	push   (%esi)
+  800bb3:	e8 4b fc ff ff       	call   800803 <dev_lookup>
+  800bb8:	83 c4 10             	add    $0x10,%esp
+  800bbb:	85 c0                	test   %eax,%eax
+  800bbd:	78 1c                	js     800bdb <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bbf:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800bc3:	74 1d                	je     800be2 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800bc5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bc8:	8b 40 18             	mov    0x18(%eax),%eax
+  800bcb:	85 c0                	test   %eax,%eax
+  800bcd:	74 34                	je     800c03 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800bcf:	83 ec 08             	sub    $0x8,%esp
+  800bd2:	ff 75 0c             	push   0xc(%ebp)
+  800bd5:	56                   	push   %esi
+  800bd6:	ff d0                	call   *%eax
+  800bd8:	83 c4 10             	add    $0x10,%esp
+}
+  800bdb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bde:	5b                   	pop    %ebx
+  800bdf:	5e                   	pop    %esi
+  800be0:	5d                   	pop    %ebp
+  800be1:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800be2:	a1 08 40 80 00       	mov    0x804008,%eax
+  800be7:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800bea:	83 ec 04             	sub    $0x4,%esp
+  800bed:	53                   	push   %ebx
+  800bee:	50                   	push   %eax
+  800bef:	68 f8 26 80 00       	push   $0x8026f8
+  800bf4:	e8 fa 0b 00 00       	call   8017f3 <cprintf>
+		return -E_INVAL;
+  800bf9:	83 c4 10             	add    $0x10,%esp
+  800bfc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c01:	eb d8                	jmp    800bdb <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800c03:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c08:	eb d1                	jmp    800bdb <ftruncate+0x50>
+
+00800c0a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800c0a:	55                   	push   %ebp
+  800c0b:	89 e5                	mov    %esp,%ebp
+  800c0d:	56                   	push   %esi
+  800c0e:	53                   	push   %ebx
+  800c0f:	83 ec 18             	sub    $0x18,%esp
+  800c12:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c15:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c18:	50                   	push   %eax
+  800c19:	ff 75 08             	push   0x8(%ebp)
+  800c1c:	e8 92 fb ff ff       	call   8007b3 <fd_lookup>
+  800c21:	83 c4 10             	add    $0x10,%esp
+  800c24:	85 c0                	test   %eax,%eax
+  800c26:	78 49                	js     800c71 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c28:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c2b:	83 ec 08             	sub    $0x8,%esp
+  800c2e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c31:	50                   	push   %eax
+  800c32:	ff 36                	push   (%esi)
+  800c34:	e8 ca fb ff ff       	call   800803 <dev_lookup>
+  800c39:	83 c4 10             	add    $0x10,%esp
+  800c3c:	85 c0                	test   %eax,%eax
+  800c3e:	78 31                	js     800c71 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c43:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c47:	74 2f                	je     800c78 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c49:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c4c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c53:	00 00 00 
+	stat->st_isdir = 0;
+  800c56:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c5d:	00 00 00 
+	stat->st_dev = dev;
+  800c60:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c66:	83 ec 08             	sub    $0x8,%esp
+  800c69:	53                   	push   %ebx
+  800c6a:	56                   	push   %esi
+  800c6b:	ff 50 14             	call   *0x14(%eax)
+  800c6e:	83 c4 10             	add    $0x10,%esp
+}
+  800c71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c74:	5b                   	pop    %ebx
+  800c75:	5e                   	pop    %esi
+  800c76:	5d                   	pop    %ebp
+  800c77:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c78:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c7d:	eb f2                	jmp    800c71 <fstat+0x67>
+
+00800c7f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c7f:	55                   	push   %ebp
+  800c80:	89 e5                	mov    %esp,%ebp
+  800c82:	56                   	push   %esi
+  800c83:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c84:	83 ec 08             	sub    $0x8,%esp
+  800c87:	6a 00                	push   $0x0
+  800c89:	ff 75 08             	push   0x8(%ebp)
+  800c8c:	e8 bc 02 00 00       	call   800f4d <open>
+  800c91:	89 c3                	mov    %eax,%ebx
+  800c93:	83 c4 10             	add    $0x10,%esp
+  800c96:	85 c0                	test   %eax,%eax
+  800c98:	78 1b                	js     800cb5 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c9a:	83 ec 08             	sub    $0x8,%esp
+  800c9d:	ff 75 0c             	push   0xc(%ebp)
+  800ca0:	50                   	push   %eax
+  800ca1:	e8 64 ff ff ff       	call   800c0a <fstat>
+  800ca6:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800ca8:	89 1c 24             	mov    %ebx,(%esp)
+  800cab:	e8 26 fc ff ff       	call   8008d6 <close>
+	return r;
+  800cb0:	83 c4 10             	add    $0x10,%esp
+  800cb3:	89 f3                	mov    %esi,%ebx
+}
+  800cb5:	89 d8                	mov    %ebx,%eax
+  800cb7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cba:	5b                   	pop    %ebx
+  800cbb:	5e                   	pop    %esi
+  800cbc:	5d                   	pop    %ebp
+  800cbd:	c3                   	ret
+
+00800cbe <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  800cbe:	55                   	push   %ebp
+  800cbf:	89 e5                	mov    %esp,%ebp
+  800cc1:	57                   	push   %edi
+  800cc2:	56                   	push   %esi
+  800cc3:	53                   	push   %ebx
+  800cc4:	83 ec 0c             	sub    $0xc,%esp
+  800cc7:	89 c7                	mov    %eax,%edi
+  800cc9:	89 d3                	mov    %edx,%ebx
+  800ccb:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800ccd:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800cd4:	74 2d                	je     800d03 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cd6:	6a 07                	push   $0x7
+  800cd8:	68 00 50 80 00       	push   $0x805000
+  800cdd:	57                   	push   %edi
+  800cde:	ff 35 00 40 80 00    	push   0x804000
+  800ce4:	e8 3f 16 00 00       	call   802328 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  800ce9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800cf0:	6a 00                	push   $0x0
+  800cf2:	56                   	push   %esi
+  800cf3:	53                   	push   %ebx
+  800cf4:	6a 00                	push   $0x0
+  800cf6:	e8 df 14 00 00       	call   8021da <ipc_recv_pages>
+}
+  800cfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cfe:	5b                   	pop    %ebx
+  800cff:	5e                   	pop    %esi
+  800d00:	5f                   	pop    %edi
+  800d01:	5d                   	pop    %ebp
+  800d02:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800d03:	83 ec 0c             	sub    $0xc,%esp
+  800d06:	6a 01                	push   $0x1
+  800d08:	e8 10 17 00 00       	call   80241d <ipc_find_env>
+  800d0d:	a3 00 40 80 00       	mov    %eax,0x804000
+  800d12:	83 c4 10             	add    $0x10,%esp
+  800d15:	eb bf                	jmp    800cd6 <fsipc_pages+0x18>
+
+00800d17 <fsipc>:
+{
+  800d17:	55                   	push   %ebp
+  800d18:	89 e5                	mov    %esp,%ebp
+  800d1a:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  800d1d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d22:	e8 97 ff ff ff       	call   800cbe <fsipc_pages>
+}
+  800d27:	c9                   	leave
+  800d28:	c3                   	ret
+
+00800d29 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d32:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d35:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800d3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d3d:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800d42:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d47:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d4c:	e8 c6 ff ff ff       	call   800d17 <fsipc>
+}
+  800d51:	c9                   	leave
+  800d52:	c3                   	ret
+
+00800d53 <devfile_flush>:
+{
+  800d53:	55                   	push   %ebp
+  800d54:	89 e5                	mov    %esp,%ebp
+  800d56:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d59:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d5c:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d5f:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800d64:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d69:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d6e:	e8 a4 ff ff ff       	call   800d17 <fsipc>
+}
+  800d73:	c9                   	leave
+  800d74:	c3                   	ret
+
+00800d75 <devfile_stat>:
+{
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	53                   	push   %ebx
+  800d79:	83 ec 04             	sub    $0x4,%esp
+  800d7c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d82:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d85:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800d8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d8f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d94:	e8 7e ff ff ff       	call   800d17 <fsipc>
+  800d99:	85 c0                	test   %eax,%eax
+  800d9b:	78 2c                	js     800dc9 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800d9d:	83 ec 08             	sub    $0x8,%esp
+  800da0:	68 00 50 80 00       	push   $0x805000
+  800da5:	53                   	push   %ebx
+  800da6:	e8 2f 10 00 00       	call   801dda <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800dab:	a1 80 50 80 00       	mov    0x805080,%eax
+  800db0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800db6:	a1 84 50 80 00       	mov    0x805084,%eax
+  800dbb:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800dc1:	83 c4 10             	add    $0x10,%esp
+  800dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dc9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dcc:	c9                   	leave
+  800dcd:	c3                   	ret
+
+00800dce <devfile_write>:
+{
+  800dce:	55                   	push   %ebp
+  800dcf:	89 e5                	mov    %esp,%ebp
+  800dd1:	83 ec 0c             	sub    $0xc,%esp
+  800dd4:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800dd7:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800ddc:	39 d0                	cmp    %edx,%eax
+  800dde:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800de1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de4:	8b 52 0c             	mov    0xc(%edx),%edx
+  800de7:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  800ded:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800df2:	50                   	push   %eax
+  800df3:	ff 75 0c             	push   0xc(%ebp)
+  800df6:	68 08 50 80 00       	push   $0x805008
+  800dfb:	e8 60 11 00 00       	call   801f60 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800e00:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e05:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e0a:	e8 08 ff ff ff       	call   800d17 <fsipc>
+}
+  800e0f:	c9                   	leave
+  800e10:	c3                   	ret
+
+00800e11 <devfile_read>:
+{
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	57                   	push   %edi
+  800e15:	56                   	push   %esi
+  800e16:	53                   	push   %ebx
+  800e17:	83 ec 1c             	sub    $0x1c,%esp
+  800e1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e1d:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e20:	89 fe                	mov    %edi,%esi
+  800e22:	c1 ee 0c             	shr    $0xc,%esi
+  800e25:	b8 20 00 00 00       	mov    $0x20,%eax
+  800e2a:	39 c6                	cmp    %eax,%esi
+  800e2c:	0f 47 f0             	cmova  %eax,%esi
+  800e2f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e37:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  800e3a:	eb 14                	jmp    800e50 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e3c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  800e43:	05 00 10 00 00       	add    $0x1000,%eax
+  800e48:	f6 c6 06             	test   $0x6,%dh
+  800e4b:	75 42                	jne    800e8f <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e4d:	83 c1 01             	add    $0x1,%ecx
+  800e50:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800e53:	39 f1                	cmp    %esi,%ecx
+  800e55:	0f 84 95 00 00 00    	je     800ef0 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e5b:	89 c2                	mov    %eax,%edx
+  800e5d:	c1 ea 16             	shr    $0x16,%edx
+  800e60:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e67:	f6 c2 01             	test   $0x1,%dl
+  800e6a:	74 23                	je     800e8f <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e6c:	89 c2                	mov    %eax,%edx
+  800e6e:	c1 ea 0c             	shr    $0xc,%edx
+  800e71:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800e78:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  800e7e:	74 0f                	je     800e8f <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  800e80:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800e87:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  800e8d:	75 ad                	jne    800e3c <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  800e8f:	85 c9                	test   %ecx,%ecx
+  800e91:	74 11                	je     800ea4 <devfile_read+0x93>
+  800e93:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  800e9a:	75 08                	jne    800ea4 <devfile_read+0x93>
+  800e9c:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  800ea2:	74 50                	je     800ef4 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800ea4:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800ea7:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  800eac:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800eb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb7:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ebc:	e8 56 fe ff ff       	call   800d17 <fsipc>
+  800ec1:	89 c6                	mov    %eax,%esi
+  800ec3:	85 c0                	test   %eax,%eax
+  800ec5:	78 1f                	js     800ee6 <devfile_read+0xd5>
+	assert(r <= n);
+  800ec7:	39 c7                	cmp    %eax,%edi
+  800ec9:	72 50                	jb     800f1b <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  800ecb:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800ed0:	7f 62                	jg     800f34 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  800ed2:	83 ec 04             	sub    $0x4,%esp
+  800ed5:	50                   	push   %eax
+  800ed6:	68 00 50 80 00       	push   $0x805000
+  800edb:	ff 75 0c             	push   0xc(%ebp)
+  800ede:	e8 7d 10 00 00       	call   801f60 <memmove>
+	return r;
+  800ee3:	83 c4 10             	add    $0x10,%esp
+}
+  800ee6:	89 f0                	mov    %esi,%eax
+  800ee8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eeb:	5b                   	pop    %ebx
+  800eec:	5e                   	pop    %esi
+  800eed:	5f                   	pop    %edi
+  800eee:	5d                   	pop    %ebp
+  800eef:	c3                   	ret
+  800ef0:	89 f1                	mov    %esi,%ecx
+  800ef2:	eb 9b                	jmp    800e8f <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  800ef4:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800ef7:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  800efc:	89 c8                	mov    %ecx,%eax
+  800efe:	c1 e0 0c             	shl    $0xc,%eax
+  800f01:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  800f06:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f09:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f0e:	e8 ab fd ff ff       	call   800cbe <fsipc_pages>
+  800f13:	89 c6                	mov    %eax,%esi
+  800f15:	85 c0                	test   %eax,%eax
+  800f17:	78 8b                	js     800ea4 <devfile_read+0x93>
+  800f19:	eb cb                	jmp    800ee6 <devfile_read+0xd5>
+	assert(r <= n);
+  800f1b:	68 64 27 80 00       	push   $0x802764
+  800f20:	68 6b 27 80 00       	push   $0x80276b
+  800f25:	68 a0 00 00 00       	push   $0xa0
+  800f2a:	68 80 27 80 00       	push   $0x802780
+  800f2f:	e8 e4 07 00 00       	call   801718 <_panic>
+	assert(r <= PGSIZE);
+  800f34:	68 8b 27 80 00       	push   $0x80278b
+  800f39:	68 6b 27 80 00       	push   $0x80276b
+  800f3e:	68 a1 00 00 00       	push   $0xa1
+  800f43:	68 80 27 80 00       	push   $0x802780
+  800f48:	e8 cb 07 00 00       	call   801718 <_panic>
+
+00800f4d <open>:
+{
+  800f4d:	55                   	push   %ebp
+  800f4e:	89 e5                	mov    %esp,%ebp
+  800f50:	56                   	push   %esi
+  800f51:	53                   	push   %ebx
+  800f52:	83 ec 1c             	sub    $0x1c,%esp
+  800f55:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800f58:	56                   	push   %esi
+  800f59:	e8 41 0e 00 00       	call   801d9f <strlen>
+  800f5e:	83 c4 10             	add    $0x10,%esp
+  800f61:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f66:	7f 6c                	jg     800fd4 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800f68:	83 ec 0c             	sub    $0xc,%esp
+  800f6b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f6e:	50                   	push   %eax
+  800f6f:	e8 eb f7 ff ff       	call   80075f <fd_alloc>
+  800f74:	89 c3                	mov    %eax,%ebx
+  800f76:	83 c4 10             	add    $0x10,%esp
+  800f79:	85 c0                	test   %eax,%eax
+  800f7b:	78 3c                	js     800fb9 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800f7d:	83 ec 08             	sub    $0x8,%esp
+  800f80:	56                   	push   %esi
+  800f81:	68 00 50 80 00       	push   $0x805000
+  800f86:	e8 4f 0e 00 00       	call   801dda <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800f8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f8e:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800f93:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800f96:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f9b:	e8 77 fd ff ff       	call   800d17 <fsipc>
+  800fa0:	89 c3                	mov    %eax,%ebx
+  800fa2:	83 c4 10             	add    $0x10,%esp
+  800fa5:	85 c0                	test   %eax,%eax
+  800fa7:	78 19                	js     800fc2 <open+0x75>
+	return fd2num(fd);
+  800fa9:	83 ec 0c             	sub    $0xc,%esp
+  800fac:	ff 75 f4             	push   -0xc(%ebp)
+  800faf:	e8 84 f7 ff ff       	call   800738 <fd2num>
+  800fb4:	89 c3                	mov    %eax,%ebx
+  800fb6:	83 c4 10             	add    $0x10,%esp
+}
+  800fb9:	89 d8                	mov    %ebx,%eax
+  800fbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fbe:	5b                   	pop    %ebx
+  800fbf:	5e                   	pop    %esi
+  800fc0:	5d                   	pop    %ebp
+  800fc1:	c3                   	ret
+		fd_close(fd, 0);
+  800fc2:	83 ec 08             	sub    $0x8,%esp
+  800fc5:	6a 00                	push   $0x0
+  800fc7:	ff 75 f4             	push   -0xc(%ebp)
+  800fca:	e8 80 f8 ff ff       	call   80084f <fd_close>
+		return r;
+  800fcf:	83 c4 10             	add    $0x10,%esp
+  800fd2:	eb e5                	jmp    800fb9 <open+0x6c>
+		return -E_BAD_PATH;
+  800fd4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800fd9:	eb de                	jmp    800fb9 <open+0x6c>
+
+00800fdb <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800fdb:	55                   	push   %ebp
+  800fdc:	89 e5                	mov    %esp,%ebp
+  800fde:	53                   	push   %ebx
+  800fdf:	83 ec 10             	sub    $0x10,%esp
+  800fe2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  800fe5:	53                   	push   %ebx
+  800fe6:	e8 b4 0d 00 00       	call   801d9f <strlen>
+  800feb:	83 c4 10             	add    $0x10,%esp
+  800fee:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800ff3:	7f 25                	jg     80101a <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  800ff5:	83 ec 08             	sub    $0x8,%esp
+  800ff8:	53                   	push   %ebx
+  800ff9:	68 00 50 80 00       	push   $0x805000
+  800ffe:	e8 d7 0d 00 00       	call   801dda <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801003:	ba 00 00 00 00       	mov    $0x0,%edx
+  801008:	b8 07 00 00 00       	mov    $0x7,%eax
+  80100d:	e8 05 fd ff ff       	call   800d17 <fsipc>
+  801012:	83 c4 10             	add    $0x10,%esp
+}
+  801015:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801018:	c9                   	leave
+  801019:	c3                   	ret
+		return -E_BAD_PATH;
+  80101a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80101f:	eb f4                	jmp    801015 <remove+0x3a>
+
+00801021 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801021:	55                   	push   %ebp
+  801022:	89 e5                	mov    %esp,%ebp
+  801024:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801027:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801031:	e8 e1 fc ff ff       	call   800d17 <fsipc>
+}
+  801036:	c9                   	leave
+  801037:	c3                   	ret
+
+00801038 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801038:	55                   	push   %ebp
+  801039:	89 e5                	mov    %esp,%ebp
+  80103b:	53                   	push   %ebx
+  80103c:	83 ec 04             	sub    $0x4,%esp
+  80103f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801042:	ba 00 00 00 00       	mov    $0x0,%edx
+  801047:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80104c:	e8 c6 fc ff ff       	call   800d17 <fsipc>
+  801051:	85 c0                	test   %eax,%eax
+  801053:	78 3c                	js     801091 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801055:	a1 00 50 80 00       	mov    0x805000,%eax
+  80105a:	89 03                	mov    %eax,(%ebx)
+  80105c:	a1 04 50 80 00       	mov    0x805004,%eax
+  801061:	89 43 04             	mov    %eax,0x4(%ebx)
+  801064:	a1 08 50 80 00       	mov    0x805008,%eax
+  801069:	89 43 08             	mov    %eax,0x8(%ebx)
+  80106c:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801071:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801074:	a1 10 50 80 00       	mov    0x805010,%eax
+  801079:	89 43 10             	mov    %eax,0x10(%ebx)
+  80107c:	a1 14 50 80 00       	mov    0x805014,%eax
+  801081:	89 43 14             	mov    %eax,0x14(%ebx)
+  801084:	a1 18 50 80 00       	mov    0x805018,%eax
+  801089:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  80108c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801091:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801094:	c9                   	leave
+  801095:	c3                   	ret
+
+00801096 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801096:	55                   	push   %ebp
+  801097:	89 e5                	mov    %esp,%ebp
+  801099:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  80109c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80109f:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  8010a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010ae:	e8 64 fc ff ff       	call   800d17 <fsipc>
+}
+  8010b3:	c9                   	leave
+  8010b4:	c3                   	ret
+
+008010b5 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8010b5:	55                   	push   %ebp
+  8010b6:	89 e5                	mov    %esp,%ebp
+  8010b8:	56                   	push   %esi
+  8010b9:	53                   	push   %ebx
+  8010ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8010bd:	83 ec 0c             	sub    $0xc,%esp
+  8010c0:	ff 75 08             	push   0x8(%ebp)
+  8010c3:	e8 80 f6 ff ff       	call   800748 <fd2data>
+  8010c8:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8010ca:	83 c4 08             	add    $0x8,%esp
+  8010cd:	68 97 27 80 00       	push   $0x802797
+  8010d2:	53                   	push   %ebx
+  8010d3:	e8 02 0d 00 00       	call   801dda <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8010d8:	8b 46 04             	mov    0x4(%esi),%eax
+  8010db:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8010e1:	2b 0e                	sub    (%esi),%ecx
+  8010e3:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8010e8:	89 c8                	mov    %ecx,%eax
+  8010ea:	f7 e2                	mul    %edx
+  8010ec:	c1 ea 0c             	shr    $0xc,%edx
+  8010ef:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8010f5:	29 d1                	sub    %edx,%ecx
+  8010f7:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8010fd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801104:	00 00 00 
+	stat->st_dev = &devpipe;
+  801107:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  80110e:	30 80 00 
+	return 0;
+}
+  801111:	b8 00 00 00 00       	mov    $0x0,%eax
+  801116:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801119:	5b                   	pop    %ebx
+  80111a:	5e                   	pop    %esi
+  80111b:	5d                   	pop    %ebp
+  80111c:	c3                   	ret
+
+0080111d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80111d:	55                   	push   %ebp
+  80111e:	89 e5                	mov    %esp,%ebp
+  801120:	53                   	push   %ebx
+  801121:	83 ec 0c             	sub    $0xc,%esp
+  801124:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801127:	53                   	push   %ebx
+  801128:	6a 00                	push   $0x0
+  80112a:	e8 f3 f0 ff ff       	call   800222 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80112f:	89 1c 24             	mov    %ebx,(%esp)
+  801132:	e8 11 f6 ff ff       	call   800748 <fd2data>
+  801137:	83 c4 08             	add    $0x8,%esp
+  80113a:	50                   	push   %eax
+  80113b:	6a 00                	push   $0x0
+  80113d:	e8 e0 f0 ff ff       	call   800222 <sys_page_unmap>
+}
+  801142:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801145:	c9                   	leave
+  801146:	c3                   	ret
+
+00801147 <_pipeisclosed>:
+{
+  801147:	55                   	push   %ebp
+  801148:	89 e5                	mov    %esp,%ebp
+  80114a:	57                   	push   %edi
+  80114b:	56                   	push   %esi
+  80114c:	53                   	push   %ebx
+  80114d:	83 ec 1c             	sub    $0x1c,%esp
+  801150:	89 c7                	mov    %eax,%edi
+  801152:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801154:	a1 08 40 80 00       	mov    0x804008,%eax
+  801159:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80115c:	83 ec 0c             	sub    $0xc,%esp
+  80115f:	57                   	push   %edi
+  801160:	e8 f7 12 00 00       	call   80245c <pageref>
+  801165:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801168:	89 34 24             	mov    %esi,(%esp)
+  80116b:	e8 ec 12 00 00       	call   80245c <pageref>
+		nn = thisenv->env_runs;
+  801170:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801176:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801179:	83 c4 10             	add    $0x10,%esp
+  80117c:	39 cb                	cmp    %ecx,%ebx
+  80117e:	74 1b                	je     80119b <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801180:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801183:	75 cf                	jne    801154 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801185:	8b 42 58             	mov    0x58(%edx),%eax
+  801188:	6a 01                	push   $0x1
+  80118a:	50                   	push   %eax
+  80118b:	53                   	push   %ebx
+  80118c:	68 9e 27 80 00       	push   $0x80279e
+  801191:	e8 5d 06 00 00       	call   8017f3 <cprintf>
+  801196:	83 c4 10             	add    $0x10,%esp
+  801199:	eb b9                	jmp    801154 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80119b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80119e:	0f 94 c0             	sete   %al
+  8011a1:	0f b6 c0             	movzbl %al,%eax
+}
+  8011a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a7:	5b                   	pop    %ebx
+  8011a8:	5e                   	pop    %esi
+  8011a9:	5f                   	pop    %edi
+  8011aa:	5d                   	pop    %ebp
+  8011ab:	c3                   	ret
+
+008011ac <devpipe_read>:
+{
+  8011ac:	55                   	push   %ebp
+  8011ad:	89 e5                	mov    %esp,%ebp
+  8011af:	57                   	push   %edi
+  8011b0:	56                   	push   %esi
+  8011b1:	53                   	push   %ebx
+  8011b2:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8011b5:	ff 75 08             	push   0x8(%ebp)
+  8011b8:	e8 8b f5 ff ff       	call   800748 <fd2data>
+  8011bd:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8011bf:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8011c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8011c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8011c8:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8011cb:	8b 0b                	mov    (%ebx),%ecx
+  8011cd:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8011d3:	29 ce                	sub    %ecx,%esi
+  8011d5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8011da:	f7 e6                	mul    %esi
+  8011dc:	c1 ea 0c             	shr    $0xc,%edx
+  8011df:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8011e5:	29 c6                	sub    %eax,%esi
+  8011e7:	89 f2                	mov    %esi,%edx
+  8011e9:	75 43                	jne    80122e <devpipe_read+0x82>
+		ref = pageref(p);
+  8011eb:	83 ec 0c             	sub    $0xc,%esp
+  8011ee:	53                   	push   %ebx
+  8011ef:	e8 68 12 00 00       	call   80245c <pageref>
+  8011f4:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8011f6:	89 da                	mov    %ebx,%edx
+  8011f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011fb:	e8 47 ff ff ff       	call   801147 <_pipeisclosed>
+  801200:	83 c4 10             	add    $0x10,%esp
+  801203:	85 c0                	test   %eax,%eax
+  801205:	0f 85 c1 00 00 00    	jne    8012cc <devpipe_read+0x120>
+	*sleeping = 1;
+  80120b:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801212:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801217:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  80121a:	75 ac                	jne    8011c8 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  80121c:	83 ec 04             	sub    $0x4,%esp
+  80121f:	56                   	push   %esi
+  801220:	57                   	push   %edi
+  801221:	ff 75 e4             	push   -0x1c(%ebp)
+  801224:	e8 4d f4 ff ff       	call   800676 <sys_futex_wait>
+  801229:	83 c4 10             	add    $0x10,%esp
+  80122c:	eb 9a                	jmp    8011c8 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  80122e:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801231:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801235:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801237:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80123c:	f7 e1                	mul    %ecx
+  80123e:	c1 ea 0b             	shr    $0xb,%edx
+  801241:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801247:	29 c1                	sub    %eax,%ecx
+  801249:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  80124b:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801250:	29 cf                	sub    %ecx,%edi
+  801252:	39 f7                	cmp    %esi,%edi
+  801254:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801257:	8d 43 10             	lea    0x10(%ebx),%eax
+  80125a:	83 ec 04             	sub    $0x4,%esp
+  80125d:	57                   	push   %edi
+  80125e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801261:	01 c2                	add    %eax,%edx
+  801263:	52                   	push   %edx
+  801264:	ff 75 0c             	push   0xc(%ebp)
+  801267:	e8 f4 0c 00 00       	call   801f60 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  80126c:	83 c4 0c             	add    $0xc,%esp
+  80126f:	89 f1                	mov    %esi,%ecx
+  801271:	29 f9                	sub    %edi,%ecx
+  801273:	51                   	push   %ecx
+  801274:	ff 75 e4             	push   -0x1c(%ebp)
+  801277:	89 f8                	mov    %edi,%eax
+  801279:	03 45 0c             	add    0xc(%ebp),%eax
+  80127c:	50                   	push   %eax
+  80127d:	e8 de 0c 00 00       	call   801f60 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801282:	89 f1                	mov    %esi,%ecx
+  801284:	03 0b                	add    (%ebx),%ecx
+  801286:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80128b:	f7 e1                	mul    %ecx
+  80128d:	c1 ea 0c             	shr    $0xc,%edx
+  801290:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801296:	29 d1                	sub    %edx,%ecx
+  801298:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  80129a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80129f:	83 c4 10             	add    $0x10,%esp
+  8012a2:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  8012a6:	75 0a                	jne    8012b2 <devpipe_read+0x106>
+	return n;
+  8012a8:	89 f0                	mov    %esi,%eax
+}
+  8012aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ad:	5b                   	pop    %ebx
+  8012ae:	5e                   	pop    %esi
+  8012af:	5f                   	pop    %edi
+  8012b0:	5d                   	pop    %ebp
+  8012b1:	c3                   	ret
+		*sleeping = 0;
+  8012b2:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8012b9:	83 ec 08             	sub    $0x8,%esp
+  8012bc:	68 00 04 00 00       	push   $0x400
+  8012c1:	53                   	push   %ebx
+  8012c2:	e8 ff f3 ff ff       	call   8006c6 <sys_futex_wake>
+  8012c7:	83 c4 10             	add    $0x10,%esp
+  8012ca:	eb dc                	jmp    8012a8 <devpipe_read+0xfc>
+			return 0;
+  8012cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d1:	eb d7                	jmp    8012aa <devpipe_read+0xfe>
+
+008012d3 <devpipe_write>:
+{
+  8012d3:	55                   	push   %ebp
+  8012d4:	89 e5                	mov    %esp,%ebp
+  8012d6:	57                   	push   %edi
+  8012d7:	56                   	push   %esi
+  8012d8:	53                   	push   %ebx
+  8012d9:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8012dc:	ff 75 08             	push   0x8(%ebp)
+  8012df:	e8 64 f4 ff ff       	call   800748 <fd2data>
+  8012e4:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8012e6:	83 c4 10             	add    $0x10,%esp
+  8012e9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8012f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8012f3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8012f6:	0f 83 23 01 00 00    	jae    80141f <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8012fc:	8b 77 04             	mov    0x4(%edi),%esi
+  8012ff:	8b 1f                	mov    (%edi),%ebx
+  801301:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801307:	29 d9                	sub    %ebx,%ecx
+  801309:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80130e:	f7 e1                	mul    %ecx
+  801310:	c1 ea 0c             	shr    $0xc,%edx
+  801313:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801319:	29 c1                	sub    %eax,%ecx
+  80131b:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80131d:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801323:	75 40                	jne    801365 <devpipe_write+0x92>
+			ref = pageref(p);
+  801325:	83 ec 0c             	sub    $0xc,%esp
+  801328:	57                   	push   %edi
+  801329:	e8 2e 11 00 00       	call   80245c <pageref>
+  80132e:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801330:	89 fa                	mov    %edi,%edx
+  801332:	8b 45 08             	mov    0x8(%ebp),%eax
+  801335:	e8 0d fe ff ff       	call   801147 <_pipeisclosed>
+  80133a:	83 c4 10             	add    $0x10,%esp
+  80133d:	85 c0                	test   %eax,%eax
+  80133f:	0f 85 d5 00 00 00    	jne    80141a <devpipe_write+0x147>
+	*sleeping = 1;
+  801345:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  80134c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801351:	39 1f                	cmp    %ebx,(%edi)
+  801353:	75 a7                	jne    8012fc <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801355:	83 ec 04             	sub    $0x4,%esp
+  801358:	56                   	push   %esi
+  801359:	53                   	push   %ebx
+  80135a:	57                   	push   %edi
+  80135b:	e8 16 f3 ff ff       	call   800676 <sys_futex_wait>
+  801360:	83 c4 10             	add    $0x10,%esp
+  801363:	eb 97                	jmp    8012fc <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801365:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801368:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80136b:	29 c1                	sub    %eax,%ecx
+  80136d:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801372:	89 d8                	mov    %ebx,%eax
+  801374:	29 d0                	sub    %edx,%eax
+  801376:	39 c1                	cmp    %eax,%ecx
+  801378:	0f 46 c1             	cmovbe %ecx,%eax
+  80137b:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  80137d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801382:	f7 e6                	mul    %esi
+  801384:	c1 ea 0b             	shr    $0xb,%edx
+  801387:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80138d:	29 c6                	sub    %eax,%esi
+  80138f:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801391:	29 f3                	sub    %esi,%ebx
+  801393:	39 cb                	cmp    %ecx,%ebx
+  801395:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801398:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  80139b:	8d 77 10             	lea    0x10(%edi),%esi
+  80139e:	83 ec 04             	sub    $0x4,%esp
+  8013a1:	53                   	push   %ebx
+  8013a2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8013a5:	03 45 0c             	add    0xc(%ebp),%eax
+  8013a8:	50                   	push   %eax
+  8013a9:	01 f2                	add    %esi,%edx
+  8013ab:	52                   	push   %edx
+  8013ac:	e8 af 0b 00 00       	call   801f60 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8013b1:	83 c4 0c             	add    $0xc,%esp
+  8013b4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013b7:	29 d8                	sub    %ebx,%eax
+  8013b9:	50                   	push   %eax
+  8013ba:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8013bd:	01 d3                	add    %edx,%ebx
+  8013bf:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8013c2:	53                   	push   %ebx
+  8013c3:	56                   	push   %esi
+  8013c4:	e8 97 0b 00 00       	call   801f60 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8013c9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8013cc:	03 4f 04             	add    0x4(%edi),%ecx
+  8013cf:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8013d4:	f7 e1                	mul    %ecx
+  8013d6:	c1 ea 0c             	shr    $0xc,%edx
+  8013d9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8013df:	29 d1                	sub    %edx,%ecx
+  8013e1:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8013e4:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8013e9:	83 c4 10             	add    $0x10,%esp
+  8013ec:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8013f0:	75 0b                	jne    8013fd <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8013f2:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8013f5:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8013f8:	e9 f3 fe ff ff       	jmp    8012f0 <devpipe_write+0x1d>
+		*sleeping = 0;
+  8013fd:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  801404:	83 ec 08             	sub    $0x8,%esp
+  801407:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  80140c:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  80140f:	50                   	push   %eax
+  801410:	e8 b1 f2 ff ff       	call   8006c6 <sys_futex_wake>
+  801415:	83 c4 10             	add    $0x10,%esp
+  801418:	eb d8                	jmp    8013f2 <devpipe_write+0x11f>
+				return 0;
+  80141a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80141f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801422:	5b                   	pop    %ebx
+  801423:	5e                   	pop    %esi
+  801424:	5f                   	pop    %edi
+  801425:	5d                   	pop    %ebp
+  801426:	c3                   	ret
+
+00801427 <pipe>:
+{
+  801427:	55                   	push   %ebp
+  801428:	89 e5                	mov    %esp,%ebp
+  80142a:	56                   	push   %esi
+  80142b:	53                   	push   %ebx
+  80142c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80142f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801432:	50                   	push   %eax
+  801433:	e8 27 f3 ff ff       	call   80075f <fd_alloc>
+  801438:	89 c3                	mov    %eax,%ebx
+  80143a:	83 c4 10             	add    $0x10,%esp
+  80143d:	85 c0                	test   %eax,%eax
+  80143f:	0f 88 23 01 00 00    	js     801568 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801445:	83 ec 04             	sub    $0x4,%esp
+  801448:	68 07 04 00 00       	push   $0x407
+  80144d:	ff 75 f4             	push   -0xc(%ebp)
+  801450:	6a 00                	push   $0x0
+  801452:	e8 46 ed ff ff       	call   80019d <sys_page_alloc>
+  801457:	89 c3                	mov    %eax,%ebx
+  801459:	83 c4 10             	add    $0x10,%esp
+  80145c:	85 c0                	test   %eax,%eax
+  80145e:	0f 88 04 01 00 00    	js     801568 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801464:	83 ec 0c             	sub    $0xc,%esp
+  801467:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80146a:	50                   	push   %eax
+  80146b:	e8 ef f2 ff ff       	call   80075f <fd_alloc>
+  801470:	89 c3                	mov    %eax,%ebx
+  801472:	83 c4 10             	add    $0x10,%esp
+  801475:	85 c0                	test   %eax,%eax
+  801477:	0f 88 db 00 00 00    	js     801558 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80147d:	83 ec 04             	sub    $0x4,%esp
+  801480:	68 07 04 00 00       	push   $0x407
+  801485:	ff 75 f0             	push   -0x10(%ebp)
+  801488:	6a 00                	push   $0x0
+  80148a:	e8 0e ed ff ff       	call   80019d <sys_page_alloc>
+  80148f:	89 c3                	mov    %eax,%ebx
+  801491:	83 c4 10             	add    $0x10,%esp
+  801494:	85 c0                	test   %eax,%eax
+  801496:	0f 88 bc 00 00 00    	js     801558 <pipe+0x131>
+	va = fd2data(fd0);
+  80149c:	83 ec 0c             	sub    $0xc,%esp
+  80149f:	ff 75 f4             	push   -0xc(%ebp)
+  8014a2:	e8 a1 f2 ff ff       	call   800748 <fd2data>
+  8014a7:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014a9:	83 c4 0c             	add    $0xc,%esp
+  8014ac:	68 07 04 00 00       	push   $0x407
+  8014b1:	50                   	push   %eax
+  8014b2:	6a 00                	push   $0x0
+  8014b4:	e8 e4 ec ff ff       	call   80019d <sys_page_alloc>
+  8014b9:	89 c3                	mov    %eax,%ebx
+  8014bb:	83 c4 10             	add    $0x10,%esp
+  8014be:	85 c0                	test   %eax,%eax
+  8014c0:	0f 88 82 00 00 00    	js     801548 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014c6:	83 ec 0c             	sub    $0xc,%esp
+  8014c9:	ff 75 f0             	push   -0x10(%ebp)
+  8014cc:	e8 77 f2 ff ff       	call   800748 <fd2data>
+  8014d1:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8014d8:	50                   	push   %eax
+  8014d9:	6a 00                	push   $0x0
+  8014db:	56                   	push   %esi
+  8014dc:	6a 00                	push   $0x0
+  8014de:	e8 fd ec ff ff       	call   8001e0 <sys_page_map>
+  8014e3:	89 c3                	mov    %eax,%ebx
+  8014e5:	83 c4 20             	add    $0x20,%esp
+  8014e8:	85 c0                	test   %eax,%eax
+  8014ea:	78 4e                	js     80153a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8014ec:	a1 20 30 80 00       	mov    0x803020,%eax
+  8014f1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014f4:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8014f6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014f9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801500:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801503:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801505:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801508:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80150f:	83 ec 0c             	sub    $0xc,%esp
+  801512:	ff 75 f4             	push   -0xc(%ebp)
+  801515:	e8 1e f2 ff ff       	call   800738 <fd2num>
+  80151a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80151d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80151f:	83 c4 04             	add    $0x4,%esp
+  801522:	ff 75 f0             	push   -0x10(%ebp)
+  801525:	e8 0e f2 ff ff       	call   800738 <fd2num>
+  80152a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80152d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801530:	83 c4 10             	add    $0x10,%esp
+  801533:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801538:	eb 2e                	jmp    801568 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80153a:	83 ec 08             	sub    $0x8,%esp
+  80153d:	56                   	push   %esi
+  80153e:	6a 00                	push   $0x0
+  801540:	e8 dd ec ff ff       	call   800222 <sys_page_unmap>
+  801545:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801548:	83 ec 08             	sub    $0x8,%esp
+  80154b:	ff 75 f0             	push   -0x10(%ebp)
+  80154e:	6a 00                	push   $0x0
+  801550:	e8 cd ec ff ff       	call   800222 <sys_page_unmap>
+  801555:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801558:	83 ec 08             	sub    $0x8,%esp
+  80155b:	ff 75 f4             	push   -0xc(%ebp)
+  80155e:	6a 00                	push   $0x0
+  801560:	e8 bd ec ff ff       	call   800222 <sys_page_unmap>
+  801565:	83 c4 10             	add    $0x10,%esp
+}
+  801568:	89 d8                	mov    %ebx,%eax
+  80156a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80156d:	5b                   	pop    %ebx
+  80156e:	5e                   	pop    %esi
+  80156f:	5d                   	pop    %ebp
+  801570:	c3                   	ret
+
+00801571 <pipeisclosed>:
+{
+  801571:	55                   	push   %ebp
+  801572:	89 e5                	mov    %esp,%ebp
+  801574:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801577:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80157a:	50                   	push   %eax
+  80157b:	ff 75 08             	push   0x8(%ebp)
+  80157e:	e8 30 f2 ff ff       	call   8007b3 <fd_lookup>
+  801583:	83 c4 10             	add    $0x10,%esp
+  801586:	85 c0                	test   %eax,%eax
+  801588:	78 18                	js     8015a2 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80158a:	83 ec 0c             	sub    $0xc,%esp
+  80158d:	ff 75 f4             	push   -0xc(%ebp)
+  801590:	e8 b3 f1 ff ff       	call   800748 <fd2data>
+  801595:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801597:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80159a:	e8 a8 fb ff ff       	call   801147 <_pipeisclosed>
+  80159f:	83 c4 10             	add    $0x10,%esp
+}
+  8015a2:	c9                   	leave
+  8015a3:	c3                   	ret
+
+008015a4 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8015a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a9:	c3                   	ret
+
+008015aa <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015aa:	55                   	push   %ebp
+  8015ab:	89 e5                	mov    %esp,%ebp
+  8015ad:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8015b0:	68 b6 27 80 00       	push   $0x8027b6
+  8015b5:	ff 75 0c             	push   0xc(%ebp)
+  8015b8:	e8 1d 08 00 00       	call   801dda <strcpy>
+	return 0;
+}
+  8015bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c2:	c9                   	leave
+  8015c3:	c3                   	ret
+
+008015c4 <devcons_write>:
+{
+  8015c4:	55                   	push   %ebp
+  8015c5:	89 e5                	mov    %esp,%ebp
+  8015c7:	57                   	push   %edi
+  8015c8:	56                   	push   %esi
+  8015c9:	53                   	push   %ebx
+  8015ca:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8015d0:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8015d5:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8015db:	eb 2e                	jmp    80160b <devcons_write+0x47>
+		m = n - tot;
+  8015dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e0:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8015e2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8015e7:	39 c3                	cmp    %eax,%ebx
+  8015e9:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8015ec:	83 ec 04             	sub    $0x4,%esp
+  8015ef:	53                   	push   %ebx
+  8015f0:	89 f0                	mov    %esi,%eax
+  8015f2:	03 45 0c             	add    0xc(%ebp),%eax
+  8015f5:	50                   	push   %eax
+  8015f6:	57                   	push   %edi
+  8015f7:	e8 64 09 00 00       	call   801f60 <memmove>
+		sys_cputs(buf, m);
+  8015fc:	83 c4 08             	add    $0x8,%esp
+  8015ff:	53                   	push   %ebx
+  801600:	57                   	push   %edi
+  801601:	e8 ca ea ff ff       	call   8000d0 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801606:	01 de                	add    %ebx,%esi
+  801608:	83 c4 10             	add    $0x10,%esp
+  80160b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80160e:	72 cd                	jb     8015dd <devcons_write+0x19>
+}
+  801610:	89 f0                	mov    %esi,%eax
+  801612:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801615:	5b                   	pop    %ebx
+  801616:	5e                   	pop    %esi
+  801617:	5f                   	pop    %edi
+  801618:	5d                   	pop    %ebp
+  801619:	c3                   	ret
+
+0080161a <devcons_read>:
+{
+  80161a:	55                   	push   %ebp
+  80161b:	89 e5                	mov    %esp,%ebp
+  80161d:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801620:	b8 00 00 00 00       	mov    $0x0,%eax
+  801625:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801629:	75 07                	jne    801632 <devcons_read+0x18>
+  80162b:	eb 1f                	jmp    80164c <devcons_read+0x32>
+		sys_yield();
+  80162d:	e8 4c eb ff ff       	call   80017e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801632:	e8 c8 ea ff ff       	call   8000ff <sys_cgetc>
+  801637:	85 c0                	test   %eax,%eax
+  801639:	74 f2                	je     80162d <devcons_read+0x13>
+	if (c < 0)
+  80163b:	78 0f                	js     80164c <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80163d:	83 f8 04             	cmp    $0x4,%eax
+  801640:	74 0c                	je     80164e <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801642:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801645:	88 02                	mov    %al,(%edx)
+	return 1;
+  801647:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80164c:	c9                   	leave
+  80164d:	c3                   	ret
+		return 0;
+  80164e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801653:	eb f7                	jmp    80164c <devcons_read+0x32>
+
+00801655 <cputchar>:
+{
+  801655:	55                   	push   %ebp
+  801656:	89 e5                	mov    %esp,%ebp
+  801658:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80165b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80165e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801661:	6a 01                	push   $0x1
+  801663:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801666:	50                   	push   %eax
+  801667:	e8 64 ea ff ff       	call   8000d0 <sys_cputs>
+}
+  80166c:	83 c4 10             	add    $0x10,%esp
+  80166f:	c9                   	leave
+  801670:	c3                   	ret
+
+00801671 <getchar>:
+{
+  801671:	55                   	push   %ebp
+  801672:	89 e5                	mov    %esp,%ebp
+  801674:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801677:	6a 01                	push   $0x1
+  801679:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80167c:	50                   	push   %eax
+  80167d:	6a 00                	push   $0x0
+  80167f:	e8 8e f3 ff ff       	call   800a12 <read>
+	if (r < 0)
+  801684:	83 c4 10             	add    $0x10,%esp
+  801687:	85 c0                	test   %eax,%eax
+  801689:	78 06                	js     801691 <getchar+0x20>
+	if (r < 1)
+  80168b:	74 06                	je     801693 <getchar+0x22>
+	return c;
+  80168d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801691:	c9                   	leave
+  801692:	c3                   	ret
+		return -E_EOF;
+  801693:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801698:	eb f7                	jmp    801691 <getchar+0x20>
+
+0080169a <iscons>:
+{
+  80169a:	55                   	push   %ebp
+  80169b:	89 e5                	mov    %esp,%ebp
+  80169d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016a0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016a3:	50                   	push   %eax
+  8016a4:	ff 75 08             	push   0x8(%ebp)
+  8016a7:	e8 07 f1 ff ff       	call   8007b3 <fd_lookup>
+  8016ac:	83 c4 10             	add    $0x10,%esp
+  8016af:	85 c0                	test   %eax,%eax
+  8016b1:	78 11                	js     8016c4 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8016b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b6:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  8016bc:	39 10                	cmp    %edx,(%eax)
+  8016be:	0f 94 c0             	sete   %al
+  8016c1:	0f b6 c0             	movzbl %al,%eax
+}
+  8016c4:	c9                   	leave
+  8016c5:	c3                   	ret
+
+008016c6 <opencons>:
+{
+  8016c6:	55                   	push   %ebp
+  8016c7:	89 e5                	mov    %esp,%ebp
+  8016c9:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8016cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016cf:	50                   	push   %eax
+  8016d0:	e8 8a f0 ff ff       	call   80075f <fd_alloc>
+  8016d5:	83 c4 10             	add    $0x10,%esp
+  8016d8:	85 c0                	test   %eax,%eax
+  8016da:	78 3a                	js     801716 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8016dc:	83 ec 04             	sub    $0x4,%esp
+  8016df:	68 07 04 00 00       	push   $0x407
+  8016e4:	ff 75 f4             	push   -0xc(%ebp)
+  8016e7:	6a 00                	push   $0x0
+  8016e9:	e8 af ea ff ff       	call   80019d <sys_page_alloc>
+  8016ee:	83 c4 10             	add    $0x10,%esp
+  8016f1:	85 c0                	test   %eax,%eax
+  8016f3:	78 21                	js     801716 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8016f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f8:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  8016fe:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801700:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801703:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80170a:	83 ec 0c             	sub    $0xc,%esp
+  80170d:	50                   	push   %eax
+  80170e:	e8 25 f0 ff ff       	call   800738 <fd2num>
+  801713:	83 c4 10             	add    $0x10,%esp
+}
+  801716:	c9                   	leave
+  801717:	c3                   	ret
+
+00801718 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801718:	55                   	push   %ebp
+  801719:	89 e5                	mov    %esp,%ebp
+  80171b:	56                   	push   %esi
+  80171c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80171d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801720:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801726:	e8 34 ea ff ff       	call   80015f <sys_getenvid>
+  80172b:	83 ec 0c             	sub    $0xc,%esp
+  80172e:	ff 75 0c             	push   0xc(%ebp)
+  801731:	ff 75 08             	push   0x8(%ebp)
+  801734:	56                   	push   %esi
+  801735:	50                   	push   %eax
+  801736:	68 c4 27 80 00       	push   $0x8027c4
+  80173b:	e8 b3 00 00 00       	call   8017f3 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801740:	83 c4 18             	add    $0x18,%esp
+  801743:	53                   	push   %ebx
+  801744:	ff 75 10             	push   0x10(%ebp)
+  801747:	e8 56 00 00 00       	call   8017a2 <vcprintf>
+	cprintf("\n");
+  80174c:	c7 04 24 af 27 80 00 	movl   $0x8027af,(%esp)
+  801753:	e8 9b 00 00 00       	call   8017f3 <cprintf>
+  801758:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80175b:	cc                   	int3
+	while (1)
+  80175c:	eb fd                	jmp    80175b <_panic+0x43>
+
+0080175e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80175e:	55                   	push   %ebp
+  80175f:	89 e5                	mov    %esp,%ebp
+  801761:	53                   	push   %ebx
+  801762:	83 ec 04             	sub    $0x4,%esp
+  801765:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801768:	8b 13                	mov    (%ebx),%edx
+  80176a:	8d 42 01             	lea    0x1(%edx),%eax
+  80176d:	89 03                	mov    %eax,(%ebx)
+  80176f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801772:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801776:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80177b:	74 09                	je     801786 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80177d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801781:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801784:	c9                   	leave
+  801785:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  801786:	83 ec 08             	sub    $0x8,%esp
+  801789:	68 ff 00 00 00       	push   $0xff
+  80178e:	8d 43 08             	lea    0x8(%ebx),%eax
+  801791:	50                   	push   %eax
+  801792:	e8 39 e9 ff ff       	call   8000d0 <sys_cputs>
+		b->idx = 0;
+  801797:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80179d:	83 c4 10             	add    $0x10,%esp
+  8017a0:	eb db                	jmp    80177d <putch+0x1f>
+
+008017a2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8017a2:	55                   	push   %ebp
+  8017a3:	89 e5                	mov    %esp,%ebp
+  8017a5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8017ab:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017b2:	00 00 00 
+	b.cnt = 0;
+  8017b5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8017bc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8017bf:	ff 75 0c             	push   0xc(%ebp)
+  8017c2:	ff 75 08             	push   0x8(%ebp)
+  8017c5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8017cb:	50                   	push   %eax
+  8017cc:	68 5e 17 80 00       	push   $0x80175e
+  8017d1:	e8 14 01 00 00       	call   8018ea <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8017d6:	83 c4 08             	add    $0x8,%esp
+  8017d9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8017df:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8017e5:	50                   	push   %eax
+  8017e6:	e8 e5 e8 ff ff       	call   8000d0 <sys_cputs>
+
+	return b.cnt;
+}
+  8017eb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8017f1:	c9                   	leave
+  8017f2:	c3                   	ret
+
+008017f3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8017f3:	55                   	push   %ebp
+  8017f4:	89 e5                	mov    %esp,%ebp
+  8017f6:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8017f9:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8017fc:	50                   	push   %eax
+  8017fd:	ff 75 08             	push   0x8(%ebp)
+  801800:	e8 9d ff ff ff       	call   8017a2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801805:	c9                   	leave
+  801806:	c3                   	ret
+
+00801807 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801807:	55                   	push   %ebp
+  801808:	89 e5                	mov    %esp,%ebp
+  80180a:	57                   	push   %edi
+  80180b:	56                   	push   %esi
+  80180c:	53                   	push   %ebx
+  80180d:	83 ec 1c             	sub    $0x1c,%esp
+  801810:	89 c7                	mov    %eax,%edi
+  801812:	89 d6                	mov    %edx,%esi
+  801814:	8b 45 08             	mov    0x8(%ebp),%eax
+  801817:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80181a:	89 d1                	mov    %edx,%ecx
+  80181c:	89 c2                	mov    %eax,%edx
+  80181e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801821:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801824:	8b 45 10             	mov    0x10(%ebp),%eax
+  801827:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80182a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80182d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801834:	39 c2                	cmp    %eax,%edx
+  801836:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801839:	72 3e                	jb     801879 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80183b:	83 ec 0c             	sub    $0xc,%esp
+  80183e:	ff 75 18             	push   0x18(%ebp)
+  801841:	83 eb 01             	sub    $0x1,%ebx
+  801844:	53                   	push   %ebx
+  801845:	50                   	push   %eax
+  801846:	83 ec 08             	sub    $0x8,%esp
+  801849:	ff 75 e4             	push   -0x1c(%ebp)
+  80184c:	ff 75 e0             	push   -0x20(%ebp)
+  80184f:	ff 75 dc             	push   -0x24(%ebp)
+  801852:	ff 75 d8             	push   -0x28(%ebp)
+  801855:	e8 0f 0d 00 00       	call   802569 <__udivdi3>
+  80185a:	83 c4 18             	add    $0x18,%esp
+  80185d:	52                   	push   %edx
+  80185e:	50                   	push   %eax
+  80185f:	89 f2                	mov    %esi,%edx
+  801861:	89 f8                	mov    %edi,%eax
+  801863:	e8 9f ff ff ff       	call   801807 <printnum>
+  801868:	83 c4 20             	add    $0x20,%esp
+  80186b:	eb 13                	jmp    801880 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80186d:	83 ec 08             	sub    $0x8,%esp
+  801870:	56                   	push   %esi
+  801871:	ff 75 18             	push   0x18(%ebp)
+  801874:	ff d7                	call   *%edi
+  801876:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801879:	83 eb 01             	sub    $0x1,%ebx
+  80187c:	85 db                	test   %ebx,%ebx
+  80187e:	7f ed                	jg     80186d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801880:	83 ec 08             	sub    $0x8,%esp
+  801883:	56                   	push   %esi
+  801884:	83 ec 04             	sub    $0x4,%esp
+  801887:	ff 75 e4             	push   -0x1c(%ebp)
+  80188a:	ff 75 e0             	push   -0x20(%ebp)
+  80188d:	ff 75 dc             	push   -0x24(%ebp)
+  801890:	ff 75 d8             	push   -0x28(%ebp)
+  801893:	e8 ef 0c 00 00       	call   802587 <__umoddi3>
+  801898:	83 c4 14             	add    $0x14,%esp
+  80189b:	0f be 80 e7 27 80 00 	movsbl 0x8027e7(%eax),%eax
+  8018a2:	50                   	push   %eax
+  8018a3:	ff d7                	call   *%edi
+}
+  8018a5:	83 c4 10             	add    $0x10,%esp
+  8018a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ab:	5b                   	pop    %ebx
+  8018ac:	5e                   	pop    %esi
+  8018ad:	5f                   	pop    %edi
+  8018ae:	5d                   	pop    %ebp
+  8018af:	c3                   	ret
+
+008018b0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8018b0:	55                   	push   %ebp
+  8018b1:	89 e5                	mov    %esp,%ebp
+  8018b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8018b6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8018ba:	8b 10                	mov    (%eax),%edx
+  8018bc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8018bf:	73 0a                	jae    8018cb <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8018c1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8018c4:	89 08                	mov    %ecx,(%eax)
+  8018c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c9:	88 02                	mov    %al,(%edx)
+}
+  8018cb:	5d                   	pop    %ebp
+  8018cc:	c3                   	ret
+
+008018cd <printfmt>:
+{
+  8018cd:	55                   	push   %ebp
+  8018ce:	89 e5                	mov    %esp,%ebp
+  8018d0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8018d3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8018d6:	50                   	push   %eax
+  8018d7:	ff 75 10             	push   0x10(%ebp)
+  8018da:	ff 75 0c             	push   0xc(%ebp)
+  8018dd:	ff 75 08             	push   0x8(%ebp)
+  8018e0:	e8 05 00 00 00       	call   8018ea <vprintfmt>
+}
+  8018e5:	83 c4 10             	add    $0x10,%esp
+  8018e8:	c9                   	leave
+  8018e9:	c3                   	ret
+
+008018ea <vprintfmt>:
+{
+  8018ea:	55                   	push   %ebp
+  8018eb:	89 e5                	mov    %esp,%ebp
+  8018ed:	57                   	push   %edi
+  8018ee:	56                   	push   %esi
+  8018ef:	53                   	push   %ebx
+  8018f0:	83 ec 2c             	sub    $0x2c,%esp
+  8018f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018f6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8018f9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8018fc:	eb 0a                	jmp    801908 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8018fe:	83 ec 08             	sub    $0x8,%esp
+  801901:	53                   	push   %ebx
+  801902:	50                   	push   %eax
+  801903:	ff d6                	call   *%esi
+  801905:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801908:	83 c7 01             	add    $0x1,%edi
+  80190b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80190f:	83 f8 25             	cmp    $0x25,%eax
+  801912:	74 0c                	je     801920 <vprintfmt+0x36>
+			if (ch == '\0')
+  801914:	85 c0                	test   %eax,%eax
+  801916:	75 e6                	jne    8018fe <vprintfmt+0x14>
+}
+  801918:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80191b:	5b                   	pop    %ebx
+  80191c:	5e                   	pop    %esi
+  80191d:	5f                   	pop    %edi
+  80191e:	5d                   	pop    %ebp
+  80191f:	c3                   	ret
+		padc = ' ';
+  801920:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801924:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80192b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801932:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801939:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80193e:	8d 47 01             	lea    0x1(%edi),%eax
+  801941:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801944:	0f b6 17             	movzbl (%edi),%edx
+  801947:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80194a:	3c 55                	cmp    $0x55,%al
+  80194c:	0f 87 c5 03 00 00    	ja     801d17 <vprintfmt+0x42d>
+  801952:	0f b6 c0             	movzbl %al,%eax
+  801955:	ff 24 85 60 29 80 00 	jmp    *0x802960(,%eax,4)
+  80195c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80195f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801963:	eb d9                	jmp    80193e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801965:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801968:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80196c:	eb d0                	jmp    80193e <vprintfmt+0x54>
+  80196e:	0f b6 d2             	movzbl %dl,%edx
+  801971:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801974:	b8 00 00 00 00       	mov    $0x0,%eax
+  801979:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80197c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80197f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801983:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801986:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801989:	83 f9 09             	cmp    $0x9,%ecx
+  80198c:	77 55                	ja     8019e3 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80198e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801991:	eb e9                	jmp    80197c <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801993:	8b 45 14             	mov    0x14(%ebp),%eax
+  801996:	8b 00                	mov    (%eax),%eax
+  801998:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80199b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80199e:	8d 40 04             	lea    0x4(%eax),%eax
+  8019a1:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8019a7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8019ab:	79 91                	jns    80193e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8019ad:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8019b0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019b3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8019ba:	eb 82                	jmp    80193e <vprintfmt+0x54>
+			if (width < 0)
+  8019bc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8019bf:	85 d2                	test   %edx,%edx
+  8019c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c6:	0f 49 c2             	cmovns %edx,%eax
+  8019c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019cf:	e9 6a ff ff ff       	jmp    80193e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8019d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8019d7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8019de:	e9 5b ff ff ff       	jmp    80193e <vprintfmt+0x54>
+  8019e3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019e6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019e9:	eb bc                	jmp    8019a7 <vprintfmt+0xbd>
+			lflag++;
+  8019eb:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8019ee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019f1:	e9 48 ff ff ff       	jmp    80193e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8019f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019f9:	8d 78 04             	lea    0x4(%eax),%edi
+  8019fc:	83 ec 08             	sub    $0x8,%esp
+  8019ff:	53                   	push   %ebx
+  801a00:	ff 30                	push   (%eax)
+  801a02:	ff d6                	call   *%esi
+			break;
+  801a04:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801a07:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801a0a:	e9 63 02 00 00       	jmp    801c72 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  801a0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a12:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801a15:	8b 10                	mov    (%eax),%edx
+  801a17:	89 d0                	mov    %edx,%eax
+  801a19:	f7 d8                	neg    %eax
+  801a1b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801a1e:	83 f8 12             	cmp    $0x12,%eax
+  801a21:	7f 23                	jg     801a46 <vprintfmt+0x15c>
+  801a23:	8b 14 85 c0 2a 80 00 	mov    0x802ac0(,%eax,4),%edx
+  801a2a:	85 d2                	test   %edx,%edx
+  801a2c:	74 18                	je     801a46 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801a2e:	52                   	push   %edx
+  801a2f:	68 7d 27 80 00       	push   $0x80277d
+  801a34:	53                   	push   %ebx
+  801a35:	56                   	push   %esi
+  801a36:	e8 92 fe ff ff       	call   8018cd <printfmt>
+  801a3b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a3e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801a41:	e9 2c 02 00 00       	jmp    801c72 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  801a46:	50                   	push   %eax
+  801a47:	68 ff 27 80 00       	push   $0x8027ff
+  801a4c:	53                   	push   %ebx
+  801a4d:	56                   	push   %esi
+  801a4e:	e8 7a fe ff ff       	call   8018cd <printfmt>
+  801a53:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a56:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801a59:	e9 14 02 00 00       	jmp    801c72 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801a5e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a61:	83 c0 04             	add    $0x4,%eax
+  801a64:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801a67:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a6a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801a6c:	85 c9                	test   %ecx,%ecx
+  801a6e:	b8 f8 27 80 00       	mov    $0x8027f8,%eax
+  801a73:	0f 45 c1             	cmovne %ecx,%eax
+  801a76:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801a79:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801a7d:	7e 06                	jle    801a85 <vprintfmt+0x19b>
+  801a7f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801a83:	75 0b                	jne    801a90 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801a85:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801a88:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801a8b:	89 75 08             	mov    %esi,0x8(%ebp)
+  801a8e:	eb 5c                	jmp    801aec <vprintfmt+0x202>
+  801a90:	83 ec 08             	sub    $0x8,%esp
+  801a93:	ff 75 d0             	push   -0x30(%ebp)
+  801a96:	ff 75 cc             	push   -0x34(%ebp)
+  801a99:	e8 19 03 00 00       	call   801db7 <strnlen>
+  801a9e:	89 c2                	mov    %eax,%edx
+  801aa0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801aa3:	29 d0                	sub    %edx,%eax
+  801aa5:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801aa8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801aac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801aaf:	89 75 08             	mov    %esi,0x8(%ebp)
+  801ab2:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ab4:	eb 0e                	jmp    801ac4 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801ab6:	83 ec 08             	sub    $0x8,%esp
+  801ab9:	53                   	push   %ebx
+  801aba:	57                   	push   %edi
+  801abb:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801abe:	83 ee 01             	sub    $0x1,%esi
+  801ac1:	83 c4 10             	add    $0x10,%esp
+  801ac4:	85 f6                	test   %esi,%esi
+  801ac6:	7f ee                	jg     801ab6 <vprintfmt+0x1cc>
+  801ac8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801acb:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ace:	85 c0                	test   %eax,%eax
+  801ad0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad5:	0f 49 d0             	cmovns %eax,%edx
+  801ad8:	29 d0                	sub    %edx,%eax
+  801ada:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801add:	eb a6                	jmp    801a85 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801adf:	83 ec 08             	sub    $0x8,%esp
+  801ae2:	53                   	push   %ebx
+  801ae3:	52                   	push   %edx
+  801ae4:	ff 55 08             	call   *0x8(%ebp)
+  801ae7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801aea:	89 f1                	mov    %esi,%ecx
+  801aec:	8d 71 01             	lea    0x1(%ecx),%esi
+  801aef:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801af3:	0f be d0             	movsbl %al,%edx
+  801af6:	85 d2                	test   %edx,%edx
+  801af8:	74 28                	je     801b22 <vprintfmt+0x238>
+  801afa:	85 ff                	test   %edi,%edi
+  801afc:	78 05                	js     801b03 <vprintfmt+0x219>
+  801afe:	83 ef 01             	sub    $0x1,%edi
+  801b01:	78 30                	js     801b33 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801b03:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801b07:	74 d6                	je     801adf <vprintfmt+0x1f5>
+  801b09:	0f be c0             	movsbl %al,%eax
+  801b0c:	83 e8 20             	sub    $0x20,%eax
+  801b0f:	83 f8 5e             	cmp    $0x5e,%eax
+  801b12:	76 cb                	jbe    801adf <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801b14:	83 ec 08             	sub    $0x8,%esp
+  801b17:	53                   	push   %ebx
+  801b18:	6a 3f                	push   $0x3f
+  801b1a:	ff 55 08             	call   *0x8(%ebp)
+  801b1d:	83 c4 10             	add    $0x10,%esp
+  801b20:	eb c8                	jmp    801aea <vprintfmt+0x200>
+  801b22:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b25:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b28:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801b2b:	01 d0                	add    %edx,%eax
+  801b2d:	29 c8                	sub    %ecx,%eax
+  801b2f:	89 c7                	mov    %eax,%edi
+  801b31:	eb 13                	jmp    801b46 <vprintfmt+0x25c>
+  801b33:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b36:	eb ed                	jmp    801b25 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801b38:	83 ec 08             	sub    $0x8,%esp
+  801b3b:	53                   	push   %ebx
+  801b3c:	6a 20                	push   $0x20
+  801b3e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801b40:	83 ef 01             	sub    $0x1,%edi
+  801b43:	83 c4 10             	add    $0x10,%esp
+  801b46:	85 ff                	test   %edi,%edi
+  801b48:	7f ee                	jg     801b38 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801b4a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b4d:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b50:	e9 1d 01 00 00       	jmp    801c72 <vprintfmt+0x388>
+	if (lflag >= 2)
+  801b55:	83 f9 01             	cmp    $0x1,%ecx
+  801b58:	7f 1b                	jg     801b75 <vprintfmt+0x28b>
+	else if (lflag)
+  801b5a:	85 c9                	test   %ecx,%ecx
+  801b5c:	74 63                	je     801bc1 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  801b5e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b61:	8b 00                	mov    (%eax),%eax
+  801b63:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b66:	99                   	cltd
+  801b67:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b6a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b6d:	8d 40 04             	lea    0x4(%eax),%eax
+  801b70:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b73:	eb 17                	jmp    801b8c <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  801b75:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b78:	8b 50 04             	mov    0x4(%eax),%edx
+  801b7b:	8b 00                	mov    (%eax),%eax
+  801b7d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b80:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b83:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b86:	8d 40 08             	lea    0x8(%eax),%eax
+  801b89:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801b8c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b8f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801b92:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801b97:	85 c9                	test   %ecx,%ecx
+  801b99:	0f 89 b9 00 00 00    	jns    801c58 <vprintfmt+0x36e>
+				putch('-', putdat);
+  801b9f:	83 ec 08             	sub    $0x8,%esp
+  801ba2:	53                   	push   %ebx
+  801ba3:	6a 2d                	push   $0x2d
+  801ba5:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801ba7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801baa:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801bad:	f7 da                	neg    %edx
+  801baf:	83 d1 00             	adc    $0x0,%ecx
+  801bb2:	f7 d9                	neg    %ecx
+  801bb4:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801bb7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801bbc:	e9 97 00 00 00       	jmp    801c58 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  801bc1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bc4:	8b 00                	mov    (%eax),%eax
+  801bc6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bc9:	99                   	cltd
+  801bca:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801bcd:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bd0:	8d 40 04             	lea    0x4(%eax),%eax
+  801bd3:	89 45 14             	mov    %eax,0x14(%ebp)
+  801bd6:	eb b4                	jmp    801b8c <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  801bd8:	83 f9 01             	cmp    $0x1,%ecx
+  801bdb:	7f 1b                	jg     801bf8 <vprintfmt+0x30e>
+	else if (lflag)
+  801bdd:	85 c9                	test   %ecx,%ecx
+  801bdf:	74 2c                	je     801c0d <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  801be1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801be4:	8b 10                	mov    (%eax),%edx
+  801be6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801beb:	8d 40 04             	lea    0x4(%eax),%eax
+  801bee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801bf1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801bf6:	eb 60                	jmp    801c58 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801bf8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bfb:	8b 10                	mov    (%eax),%edx
+  801bfd:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c00:	8d 40 08             	lea    0x8(%eax),%eax
+  801c03:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c06:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801c0b:	eb 4b                	jmp    801c58 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  801c0d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c10:	8b 10                	mov    (%eax),%edx
+  801c12:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c17:	8d 40 04             	lea    0x4(%eax),%eax
+  801c1a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c1d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801c22:	eb 34                	jmp    801c58 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801c24:	83 f9 01             	cmp    $0x1,%ecx
+  801c27:	7f 15                	jg     801c3e <vprintfmt+0x354>
+	else if (lflag)
+  801c29:	85 c9                	test   %ecx,%ecx
+  801c2b:	74 4d                	je     801c7a <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  801c2d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c30:	8b 00                	mov    (%eax),%eax
+  801c32:	99                   	cltd
+  801c33:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c36:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801c39:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  801c3c:	eb 11                	jmp    801c4f <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  801c3e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c41:	8b 50 04             	mov    0x4(%eax),%edx
+  801c44:	8b 00                	mov    (%eax),%eax
+  801c46:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c49:	8d 49 08             	lea    0x8(%ecx),%ecx
+  801c4c:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  801c4f:	89 d1                	mov    %edx,%ecx
+  801c51:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  801c53:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801c58:	83 ec 0c             	sub    $0xc,%esp
+  801c5b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801c5f:	50                   	push   %eax
+  801c60:	ff 75 e0             	push   -0x20(%ebp)
+  801c63:	57                   	push   %edi
+  801c64:	51                   	push   %ecx
+  801c65:	52                   	push   %edx
+  801c66:	89 da                	mov    %ebx,%edx
+  801c68:	89 f0                	mov    %esi,%eax
+  801c6a:	e8 98 fb ff ff       	call   801807 <printnum>
+			break;
+  801c6f:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801c72:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801c75:	e9 8e fc ff ff       	jmp    801908 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  801c7a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c7d:	8b 00                	mov    (%eax),%eax
+  801c7f:	99                   	cltd
+  801c80:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c83:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801c86:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  801c89:	eb c4                	jmp    801c4f <vprintfmt+0x365>
+			putch('0', putdat);
+  801c8b:	83 ec 08             	sub    $0x8,%esp
+  801c8e:	53                   	push   %ebx
+  801c8f:	6a 30                	push   $0x30
+  801c91:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801c93:	83 c4 08             	add    $0x8,%esp
+  801c96:	53                   	push   %ebx
+  801c97:	6a 78                	push   $0x78
+  801c99:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801c9b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c9e:	8b 10                	mov    (%eax),%edx
+  801ca0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801ca5:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801ca8:	8d 40 04             	lea    0x4(%eax),%eax
+  801cab:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cae:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  801cb3:	eb a3                	jmp    801c58 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801cb5:	83 f9 01             	cmp    $0x1,%ecx
+  801cb8:	7f 1b                	jg     801cd5 <vprintfmt+0x3eb>
+	else if (lflag)
+  801cba:	85 c9                	test   %ecx,%ecx
+  801cbc:	74 2f                	je     801ced <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  801cbe:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cc1:	8b 10                	mov    (%eax),%edx
+  801cc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cc8:	8d 40 04             	lea    0x4(%eax),%eax
+  801ccb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cce:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801cd3:	eb 83                	jmp    801c58 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801cd5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cd8:	8b 10                	mov    (%eax),%edx
+  801cda:	8b 48 04             	mov    0x4(%eax),%ecx
+  801cdd:	8d 40 08             	lea    0x8(%eax),%eax
+  801ce0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ce3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801ce8:	e9 6b ff ff ff       	jmp    801c58 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  801ced:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cf0:	8b 10                	mov    (%eax),%edx
+  801cf2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cf7:	8d 40 04             	lea    0x4(%eax),%eax
+  801cfa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cfd:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801d02:	e9 51 ff ff ff       	jmp    801c58 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  801d07:	83 ec 08             	sub    $0x8,%esp
+  801d0a:	53                   	push   %ebx
+  801d0b:	6a 25                	push   $0x25
+  801d0d:	ff d6                	call   *%esi
+			break;
+  801d0f:	83 c4 10             	add    $0x10,%esp
+  801d12:	e9 5b ff ff ff       	jmp    801c72 <vprintfmt+0x388>
+			putch('%', putdat);
+  801d17:	83 ec 08             	sub    $0x8,%esp
+  801d1a:	53                   	push   %ebx
+  801d1b:	6a 25                	push   $0x25
+  801d1d:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801d1f:	83 c4 10             	add    $0x10,%esp
+  801d22:	89 f8                	mov    %edi,%eax
+  801d24:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801d28:	74 05                	je     801d2f <vprintfmt+0x445>
+  801d2a:	83 e8 01             	sub    $0x1,%eax
+  801d2d:	eb f5                	jmp    801d24 <vprintfmt+0x43a>
+  801d2f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d32:	e9 3b ff ff ff       	jmp    801c72 <vprintfmt+0x388>
+
+00801d37 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801d37:	55                   	push   %ebp
+  801d38:	89 e5                	mov    %esp,%ebp
+  801d3a:	83 ec 18             	sub    $0x18,%esp
+  801d3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d40:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801d43:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801d46:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801d4a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801d4d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801d54:	85 c0                	test   %eax,%eax
+  801d56:	74 26                	je     801d7e <vsnprintf+0x47>
+  801d58:	85 d2                	test   %edx,%edx
+  801d5a:	7e 22                	jle    801d7e <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801d5c:	ff 75 14             	push   0x14(%ebp)
+  801d5f:	ff 75 10             	push   0x10(%ebp)
+  801d62:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801d65:	50                   	push   %eax
+  801d66:	68 b0 18 80 00       	push   $0x8018b0
+  801d6b:	e8 7a fb ff ff       	call   8018ea <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801d70:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801d73:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801d76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d79:	83 c4 10             	add    $0x10,%esp
+}
+  801d7c:	c9                   	leave
+  801d7d:	c3                   	ret
+		return -E_INVAL;
+  801d7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d83:	eb f7                	jmp    801d7c <vsnprintf+0x45>
+
+00801d85 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801d85:	55                   	push   %ebp
+  801d86:	89 e5                	mov    %esp,%ebp
+  801d88:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801d8b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801d8e:	50                   	push   %eax
+  801d8f:	ff 75 10             	push   0x10(%ebp)
+  801d92:	ff 75 0c             	push   0xc(%ebp)
+  801d95:	ff 75 08             	push   0x8(%ebp)
+  801d98:	e8 9a ff ff ff       	call   801d37 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801d9d:	c9                   	leave
+  801d9e:	c3                   	ret
+
+00801d9f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801d9f:	55                   	push   %ebp
+  801da0:	89 e5                	mov    %esp,%ebp
+  801da2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801da5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801daa:	eb 03                	jmp    801daf <strlen+0x10>
+		n++;
+  801dac:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801daf:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801db3:	75 f7                	jne    801dac <strlen+0xd>
+	return n;
+}
+  801db5:	5d                   	pop    %ebp
+  801db6:	c3                   	ret
+
+00801db7 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801db7:	55                   	push   %ebp
+  801db8:	89 e5                	mov    %esp,%ebp
+  801dba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dbd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc5:	eb 03                	jmp    801dca <strnlen+0x13>
+		n++;
+  801dc7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dca:	39 d0                	cmp    %edx,%eax
+  801dcc:	74 08                	je     801dd6 <strnlen+0x1f>
+  801dce:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801dd2:	75 f3                	jne    801dc7 <strnlen+0x10>
+  801dd4:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801dd6:	89 d0                	mov    %edx,%eax
+  801dd8:	5d                   	pop    %ebp
+  801dd9:	c3                   	ret
+
+00801dda <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801dda:	55                   	push   %ebp
+  801ddb:	89 e5                	mov    %esp,%ebp
+  801ddd:	53                   	push   %ebx
+  801dde:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801de1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801de4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801ded:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801df0:	83 c0 01             	add    $0x1,%eax
+  801df3:	84 d2                	test   %dl,%dl
+  801df5:	75 f2                	jne    801de9 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801df7:	89 c8                	mov    %ecx,%eax
+  801df9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dfc:	c9                   	leave
+  801dfd:	c3                   	ret
+
+00801dfe <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801dfe:	55                   	push   %ebp
+  801dff:	89 e5                	mov    %esp,%ebp
+  801e01:	53                   	push   %ebx
+  801e02:	83 ec 10             	sub    $0x10,%esp
+  801e05:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801e08:	53                   	push   %ebx
+  801e09:	e8 91 ff ff ff       	call   801d9f <strlen>
+  801e0e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801e11:	ff 75 0c             	push   0xc(%ebp)
+  801e14:	01 d8                	add    %ebx,%eax
+  801e16:	50                   	push   %eax
+  801e17:	e8 be ff ff ff       	call   801dda <strcpy>
+	return dst;
+}
+  801e1c:	89 d8                	mov    %ebx,%eax
+  801e1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e21:	c9                   	leave
+  801e22:	c3                   	ret
+
+00801e23 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801e23:	55                   	push   %ebp
+  801e24:	89 e5                	mov    %esp,%ebp
+  801e26:	56                   	push   %esi
+  801e27:	53                   	push   %ebx
+  801e28:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e2b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801e2e:	89 f3                	mov    %esi,%ebx
+  801e30:	03 5d 10             	add    0x10(%ebp),%ebx
+  801e33:	89 f0                	mov    %esi,%eax
+  801e35:	eb 0f                	jmp    801e46 <strncpy+0x23>
+		*dst++ = *src;
+  801e37:	83 c0 01             	add    $0x1,%eax
+  801e3a:	0f b6 0a             	movzbl (%edx),%ecx
+  801e3d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801e40:	80 f9 01             	cmp    $0x1,%cl
+  801e43:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801e46:	39 d8                	cmp    %ebx,%eax
+  801e48:	75 ed                	jne    801e37 <strncpy+0x14>
+	}
+	return ret;
+}
+  801e4a:	89 f0                	mov    %esi,%eax
+  801e4c:	5b                   	pop    %ebx
+  801e4d:	5e                   	pop    %esi
+  801e4e:	5d                   	pop    %ebp
+  801e4f:	c3                   	ret
+
+00801e50 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e50:	55                   	push   %ebp
+  801e51:	89 e5                	mov    %esp,%ebp
+  801e53:	56                   	push   %esi
+  801e54:	53                   	push   %ebx
+  801e55:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e5b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801e5e:	89 f0                	mov    %esi,%eax
+  801e60:	85 d2                	test   %edx,%edx
+  801e62:	74 21                	je     801e85 <strlcpy+0x35>
+  801e64:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801e68:	89 f2                	mov    %esi,%edx
+  801e6a:	eb 09                	jmp    801e75 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801e6c:	83 c1 01             	add    $0x1,%ecx
+  801e6f:	83 c2 01             	add    $0x1,%edx
+  801e72:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801e75:	39 c2                	cmp    %eax,%edx
+  801e77:	74 09                	je     801e82 <strlcpy+0x32>
+  801e79:	0f b6 19             	movzbl (%ecx),%ebx
+  801e7c:	84 db                	test   %bl,%bl
+  801e7e:	75 ec                	jne    801e6c <strlcpy+0x1c>
+  801e80:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801e82:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801e85:	29 f0                	sub    %esi,%eax
+}
+  801e87:	5b                   	pop    %ebx
+  801e88:	5e                   	pop    %esi
+  801e89:	5d                   	pop    %ebp
+  801e8a:	c3                   	ret
+
+00801e8b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801e8b:	55                   	push   %ebp
+  801e8c:	89 e5                	mov    %esp,%ebp
+  801e8e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e91:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801e94:	eb 06                	jmp    801e9c <strcmp+0x11>
+		p++, q++;
+  801e96:	83 c1 01             	add    $0x1,%ecx
+  801e99:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801e9c:	0f b6 01             	movzbl (%ecx),%eax
+  801e9f:	84 c0                	test   %al,%al
+  801ea1:	74 04                	je     801ea7 <strcmp+0x1c>
+  801ea3:	3a 02                	cmp    (%edx),%al
+  801ea5:	74 ef                	je     801e96 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ea7:	0f b6 c0             	movzbl %al,%eax
+  801eaa:	0f b6 12             	movzbl (%edx),%edx
+  801ead:	29 d0                	sub    %edx,%eax
+}
+  801eaf:	5d                   	pop    %ebp
+  801eb0:	c3                   	ret
+
+00801eb1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801eb1:	55                   	push   %ebp
+  801eb2:	89 e5                	mov    %esp,%ebp
+  801eb4:	53                   	push   %ebx
+  801eb5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ebb:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801ebe:	eb 09                	jmp    801ec9 <strncmp+0x18>
+		n--, p++, q++;
+  801ec0:	83 ea 01             	sub    $0x1,%edx
+  801ec3:	83 c0 01             	add    $0x1,%eax
+  801ec6:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801ec9:	85 d2                	test   %edx,%edx
+  801ecb:	74 18                	je     801ee5 <strncmp+0x34>
+  801ecd:	0f b6 18             	movzbl (%eax),%ebx
+  801ed0:	84 db                	test   %bl,%bl
+  801ed2:	74 04                	je     801ed8 <strncmp+0x27>
+  801ed4:	3a 19                	cmp    (%ecx),%bl
+  801ed6:	74 e8                	je     801ec0 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ed8:	0f b6 00             	movzbl (%eax),%eax
+  801edb:	0f b6 11             	movzbl (%ecx),%edx
+  801ede:	29 d0                	sub    %edx,%eax
+}
+  801ee0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee3:	c9                   	leave
+  801ee4:	c3                   	ret
+		return 0;
+  801ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eea:	eb f4                	jmp    801ee0 <strncmp+0x2f>
+
+00801eec <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801eec:	55                   	push   %ebp
+  801eed:	89 e5                	mov    %esp,%ebp
+  801eef:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801ef6:	eb 03                	jmp    801efb <strchr+0xf>
+  801ef8:	83 c0 01             	add    $0x1,%eax
+  801efb:	0f b6 10             	movzbl (%eax),%edx
+  801efe:	84 d2                	test   %dl,%dl
+  801f00:	74 06                	je     801f08 <strchr+0x1c>
+		if (*s == c)
+  801f02:	38 ca                	cmp    %cl,%dl
+  801f04:	75 f2                	jne    801ef8 <strchr+0xc>
+  801f06:	eb 05                	jmp    801f0d <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801f08:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f0d:	5d                   	pop    %ebp
+  801f0e:	c3                   	ret
+
+00801f0f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801f0f:	55                   	push   %ebp
+  801f10:	89 e5                	mov    %esp,%ebp
+  801f12:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f15:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f19:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801f1c:	38 ca                	cmp    %cl,%dl
+  801f1e:	74 09                	je     801f29 <strfind+0x1a>
+  801f20:	84 d2                	test   %dl,%dl
+  801f22:	74 05                	je     801f29 <strfind+0x1a>
+	for (; *s; s++)
+  801f24:	83 c0 01             	add    $0x1,%eax
+  801f27:	eb f0                	jmp    801f19 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801f29:	5d                   	pop    %ebp
+  801f2a:	c3                   	ret
+
+00801f2b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801f2b:	55                   	push   %ebp
+  801f2c:	89 e5                	mov    %esp,%ebp
+  801f2e:	57                   	push   %edi
+  801f2f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f32:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801f35:	85 c9                	test   %ecx,%ecx
+  801f37:	74 20                	je     801f59 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801f39:	89 f8                	mov    %edi,%eax
+  801f3b:	09 c8                	or     %ecx,%eax
+  801f3d:	a8 03                	test   $0x3,%al
+  801f3f:	75 12                	jne    801f53 <memset+0x28>
+		c &= 0xFF;
+  801f41:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801f45:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801f4b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801f4e:	fc                   	cld
+  801f4f:	f3 ab                	rep stos %eax,%es:(%edi)
+  801f51:	eb 06                	jmp    801f59 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801f53:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f56:	fc                   	cld
+  801f57:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801f59:	89 f8                	mov    %edi,%eax
+  801f5b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801f5e:	c9                   	leave
+  801f5f:	c3                   	ret
+
+00801f60 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801f60:	55                   	push   %ebp
+  801f61:	89 e5                	mov    %esp,%ebp
+  801f63:	57                   	push   %edi
+  801f64:	56                   	push   %esi
+  801f65:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f68:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f6b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801f6e:	39 c6                	cmp    %eax,%esi
+  801f70:	73 32                	jae    801fa4 <memmove+0x44>
+  801f72:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801f75:	39 d0                	cmp    %edx,%eax
+  801f77:	73 2b                	jae    801fa4 <memmove+0x44>
+		s += n;
+		d += n;
+  801f79:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f7c:	89 d6                	mov    %edx,%esi
+  801f7e:	09 fe                	or     %edi,%esi
+  801f80:	09 ce                	or     %ecx,%esi
+  801f82:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801f88:	75 0e                	jne    801f98 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801f8a:	83 ef 04             	sub    $0x4,%edi
+  801f8d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801f90:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801f93:	fd                   	std
+  801f94:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801f96:	eb 09                	jmp    801fa1 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801f98:	83 ef 01             	sub    $0x1,%edi
+  801f9b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801f9e:	fd                   	std
+  801f9f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801fa1:	fc                   	cld
+  801fa2:	eb 1a                	jmp    801fbe <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801fa4:	89 f2                	mov    %esi,%edx
+  801fa6:	09 c2                	or     %eax,%edx
+  801fa8:	09 ca                	or     %ecx,%edx
+  801faa:	f6 c2 03             	test   $0x3,%dl
+  801fad:	75 0a                	jne    801fb9 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801faf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801fb2:	89 c7                	mov    %eax,%edi
+  801fb4:	fc                   	cld
+  801fb5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fb7:	eb 05                	jmp    801fbe <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801fb9:	89 c7                	mov    %eax,%edi
+  801fbb:	fc                   	cld
+  801fbc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801fbe:	5e                   	pop    %esi
+  801fbf:	5f                   	pop    %edi
+  801fc0:	5d                   	pop    %ebp
+  801fc1:	c3                   	ret
+
+00801fc2 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801fc2:	55                   	push   %ebp
+  801fc3:	89 e5                	mov    %esp,%ebp
+  801fc5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801fc8:	ff 75 10             	push   0x10(%ebp)
+  801fcb:	ff 75 0c             	push   0xc(%ebp)
+  801fce:	ff 75 08             	push   0x8(%ebp)
+  801fd1:	e8 8a ff ff ff       	call   801f60 <memmove>
+}
+  801fd6:	c9                   	leave
+  801fd7:	c3                   	ret
+
+00801fd8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801fd8:	55                   	push   %ebp
+  801fd9:	89 e5                	mov    %esp,%ebp
+  801fdb:	56                   	push   %esi
+  801fdc:	53                   	push   %ebx
+  801fdd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801fe3:	89 c6                	mov    %eax,%esi
+  801fe5:	03 75 10             	add    0x10(%ebp),%esi
+  801fe8:	eb 06                	jmp    801ff0 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801fea:	83 c0 01             	add    $0x1,%eax
+  801fed:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801ff0:	39 f0                	cmp    %esi,%eax
+  801ff2:	74 14                	je     802008 <memcmp+0x30>
+		if (*s1 != *s2)
+  801ff4:	0f b6 08             	movzbl (%eax),%ecx
+  801ff7:	0f b6 1a             	movzbl (%edx),%ebx
+  801ffa:	38 d9                	cmp    %bl,%cl
+  801ffc:	74 ec                	je     801fea <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801ffe:	0f b6 c1             	movzbl %cl,%eax
+  802001:	0f b6 db             	movzbl %bl,%ebx
+  802004:	29 d8                	sub    %ebx,%eax
+  802006:	eb 05                	jmp    80200d <memcmp+0x35>
+	}
+
+	return 0;
+  802008:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80200d:	5b                   	pop    %ebx
+  80200e:	5e                   	pop    %esi
+  80200f:	5d                   	pop    %ebp
+  802010:	c3                   	ret
+
+00802011 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802011:	55                   	push   %ebp
+  802012:	89 e5                	mov    %esp,%ebp
+  802014:	8b 45 08             	mov    0x8(%ebp),%eax
+  802017:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80201a:	89 c2                	mov    %eax,%edx
+  80201c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80201f:	eb 03                	jmp    802024 <memfind+0x13>
+  802021:	83 c0 01             	add    $0x1,%eax
+  802024:	39 d0                	cmp    %edx,%eax
+  802026:	73 04                	jae    80202c <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802028:	38 08                	cmp    %cl,(%eax)
+  80202a:	75 f5                	jne    802021 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80202c:	5d                   	pop    %ebp
+  80202d:	c3                   	ret
+
+0080202e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80202e:	55                   	push   %ebp
+  80202f:	89 e5                	mov    %esp,%ebp
+  802031:	57                   	push   %edi
+  802032:	56                   	push   %esi
+  802033:	53                   	push   %ebx
+  802034:	8b 55 08             	mov    0x8(%ebp),%edx
+  802037:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80203a:	eb 03                	jmp    80203f <strtol+0x11>
+		s++;
+  80203c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80203f:	0f b6 02             	movzbl (%edx),%eax
+  802042:	3c 20                	cmp    $0x20,%al
+  802044:	74 f6                	je     80203c <strtol+0xe>
+  802046:	3c 09                	cmp    $0x9,%al
+  802048:	74 f2                	je     80203c <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  80204a:	3c 2b                	cmp    $0x2b,%al
+  80204c:	74 2a                	je     802078 <strtol+0x4a>
+	int neg = 0;
+  80204e:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802053:	3c 2d                	cmp    $0x2d,%al
+  802055:	74 2b                	je     802082 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802057:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80205d:	75 0f                	jne    80206e <strtol+0x40>
+  80205f:	80 3a 30             	cmpb   $0x30,(%edx)
+  802062:	74 28                	je     80208c <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802064:	85 db                	test   %ebx,%ebx
+  802066:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80206b:	0f 44 d8             	cmove  %eax,%ebx
+  80206e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802073:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802076:	eb 46                	jmp    8020be <strtol+0x90>
+		s++;
+  802078:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  80207b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802080:	eb d5                	jmp    802057 <strtol+0x29>
+		s++, neg = 1;
+  802082:	83 c2 01             	add    $0x1,%edx
+  802085:	bf 01 00 00 00       	mov    $0x1,%edi
+  80208a:	eb cb                	jmp    802057 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80208c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802090:	74 0e                	je     8020a0 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802092:	85 db                	test   %ebx,%ebx
+  802094:	75 d8                	jne    80206e <strtol+0x40>
+		s++, base = 8;
+  802096:	83 c2 01             	add    $0x1,%edx
+  802099:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80209e:	eb ce                	jmp    80206e <strtol+0x40>
+		s += 2, base = 16;
+  8020a0:	83 c2 02             	add    $0x2,%edx
+  8020a3:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8020a8:	eb c4                	jmp    80206e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8020aa:	0f be c0             	movsbl %al,%eax
+  8020ad:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8020b0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8020b3:	7d 3a                	jge    8020ef <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8020b5:	83 c2 01             	add    $0x1,%edx
+  8020b8:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8020bc:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8020be:	0f b6 02             	movzbl (%edx),%eax
+  8020c1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8020c4:	89 f3                	mov    %esi,%ebx
+  8020c6:	80 fb 09             	cmp    $0x9,%bl
+  8020c9:	76 df                	jbe    8020aa <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8020cb:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8020ce:	89 f3                	mov    %esi,%ebx
+  8020d0:	80 fb 19             	cmp    $0x19,%bl
+  8020d3:	77 08                	ja     8020dd <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8020d5:	0f be c0             	movsbl %al,%eax
+  8020d8:	83 e8 57             	sub    $0x57,%eax
+  8020db:	eb d3                	jmp    8020b0 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8020dd:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8020e0:	89 f3                	mov    %esi,%ebx
+  8020e2:	80 fb 19             	cmp    $0x19,%bl
+  8020e5:	77 08                	ja     8020ef <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8020e7:	0f be c0             	movsbl %al,%eax
+  8020ea:	83 e8 37             	sub    $0x37,%eax
+  8020ed:	eb c1                	jmp    8020b0 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8020ef:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8020f3:	74 05                	je     8020fa <strtol+0xcc>
+		*endptr = (char *) s;
+  8020f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020f8:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8020fa:	89 c8                	mov    %ecx,%eax
+  8020fc:	f7 d8                	neg    %eax
+  8020fe:	85 ff                	test   %edi,%edi
+  802100:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802103:	89 c8                	mov    %ecx,%eax
+  802105:	5b                   	pop    %ebx
+  802106:	5e                   	pop    %esi
+  802107:	5f                   	pop    %edi
+  802108:	5d                   	pop    %ebp
+  802109:	c3                   	ret
+
+0080210a <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  80210a:	55                   	push   %ebp
+  80210b:	89 e5                	mov    %esp,%ebp
+  80210d:	57                   	push   %edi
+  80210e:	56                   	push   %esi
+  80210f:	53                   	push   %ebx
+  802110:	83 ec 0c             	sub    $0xc,%esp
+  802113:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802116:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802119:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  80211c:	85 ff                	test   %edi,%edi
+  80211e:	74 16                	je     802136 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  802120:	83 ec 04             	sub    $0x4,%esp
+  802123:	56                   	push   %esi
+  802124:	6a 00                	push   $0x0
+  802126:	53                   	push   %ebx
+  802127:	e8 02 ff ff ff       	call   80202e <strtol>
+  80212c:	89 07                	mov    %eax,(%edi)
+  80212e:	83 c4 10             	add    $0x10,%esp
+  802131:	eb 03                	jmp    802136 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  802133:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  802136:	0f b6 03             	movzbl (%ebx),%eax
+  802139:	3c 20                	cmp    $0x20,%al
+  80213b:	74 f6                	je     802133 <strisl+0x29>
+  80213d:	3c 09                	cmp    $0x9,%al
+  80213f:	74 f2                	je     802133 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  802141:	3c 2b                	cmp    $0x2b,%al
+  802143:	74 23                	je     802168 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  802145:	3c 2d                	cmp    $0x2d,%al
+  802147:	0f 94 c0             	sete   %al
+  80214a:	0f b6 c0             	movzbl %al,%eax
+  80214d:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80214f:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  802155:	75 41                	jne    802198 <strisl+0x8e>
+  802157:	80 3b 30             	cmpb   $0x30,(%ebx)
+  80215a:	74 11                	je     80216d <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80215c:	85 f6                	test   %esi,%esi
+  80215e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802163:	0f 44 f0             	cmove  %eax,%esi
+  802166:	eb 30                	jmp    802198 <strisl+0x8e>
+		s++;
+  802168:	83 c3 01             	add    $0x1,%ebx
+  80216b:	eb e2                	jmp    80214f <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80216d:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  802171:	74 0e                	je     802181 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  802173:	85 f6                	test   %esi,%esi
+  802175:	75 21                	jne    802198 <strisl+0x8e>
+		s++, base = 8;
+  802177:	83 c3 01             	add    $0x1,%ebx
+  80217a:	be 08 00 00 00       	mov    $0x8,%esi
+  80217f:	eb 17                	jmp    802198 <strisl+0x8e>
+		s += 2, base = 16;
+  802181:	83 c3 02             	add    $0x2,%ebx
+  802184:	be 10 00 00 00       	mov    $0x10,%esi
+  802189:	eb 0d                	jmp    802198 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80218b:	0f be c0             	movsbl %al,%eax
+  80218e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  802191:	39 f0                	cmp    %esi,%eax
+  802193:	7d 38                	jge    8021cd <strisl+0xc3>
+			return 0;
+		s++;
+  802195:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  802198:	0f b6 03             	movzbl (%ebx),%eax
+  80219b:	8d 50 d0             	lea    -0x30(%eax),%edx
+  80219e:	80 fa 09             	cmp    $0x9,%dl
+  8021a1:	76 e8                	jbe    80218b <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  8021a3:	8d 50 9f             	lea    -0x61(%eax),%edx
+  8021a6:	80 fa 19             	cmp    $0x19,%dl
+  8021a9:	77 08                	ja     8021b3 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  8021ab:	0f be c0             	movsbl %al,%eax
+  8021ae:	83 e8 57             	sub    $0x57,%eax
+  8021b1:	eb de                	jmp    802191 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  8021b3:	8d 50 bf             	lea    -0x41(%eax),%edx
+  8021b6:	80 fa 19             	cmp    $0x19,%dl
+  8021b9:	77 08                	ja     8021c3 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  8021bb:	0f be c0             	movsbl %al,%eax
+  8021be:	83 e8 37             	sub    $0x37,%eax
+  8021c1:	eb ce                	jmp    802191 <strisl+0x87>
+		else if (!*s)
+  8021c3:	84 c0                	test   %al,%al
+  8021c5:	0f 94 c0             	sete   %al
+  8021c8:	0f b6 c0             	movzbl %al,%eax
+  8021cb:	eb 05                	jmp    8021d2 <strisl+0xc8>
+			return 0;
+  8021cd:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  8021d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021d5:	5b                   	pop    %ebx
+  8021d6:	5e                   	pop    %esi
+  8021d7:	5f                   	pop    %edi
+  8021d8:	5d                   	pop    %ebp
+  8021d9:	c3                   	ret
+
+008021da <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8021da:	55                   	push   %ebp
+  8021db:	89 e5                	mov    %esp,%ebp
+  8021dd:	57                   	push   %edi
+  8021de:	56                   	push   %esi
+  8021df:	53                   	push   %ebx
+  8021e0:	83 ec 14             	sub    $0x14,%esp
+  8021e3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021e6:	8b 75 14             	mov    0x14(%ebp),%esi
+  8021e9:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8021ec:	ff 75 10             	push   0x10(%ebp)
+  8021ef:	ff 75 0c             	push   0xc(%ebp)
+  8021f2:	e8 c9 e3 ff ff       	call   8005c0 <sys_ipc_recv_pages>
+  8021f7:	83 c4 10             	add    $0x10,%esp
+  8021fa:	85 c0                	test   %eax,%eax
+  8021fc:	78 46                	js     802244 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8021fe:	85 ff                	test   %edi,%edi
+  802200:	74 0d                	je     80220f <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  802202:	a1 08 40 80 00       	mov    0x804008,%eax
+  802207:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80220d:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80220f:	85 f6                	test   %esi,%esi
+  802211:	74 0d                	je     802220 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  802213:	a1 08 40 80 00       	mov    0x804008,%eax
+  802218:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80221e:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802220:	85 db                	test   %ebx,%ebx
+  802222:	74 0d                	je     802231 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  802224:	a1 08 40 80 00       	mov    0x804008,%eax
+  802229:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80222f:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802231:	a1 08 40 80 00       	mov    0x804008,%eax
+  802236:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80223c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80223f:	5b                   	pop    %ebx
+  802240:	5e                   	pop    %esi
+  802241:	5f                   	pop    %edi
+  802242:	5d                   	pop    %ebp
+  802243:	c3                   	ret
+		if (from_env_store) {
+  802244:	85 ff                	test   %edi,%edi
+  802246:	74 06                	je     80224e <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  802248:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80224e:	85 f6                	test   %esi,%esi
+  802250:	74 06                	je     802258 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  802252:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802258:	85 db                	test   %ebx,%ebx
+  80225a:	74 e0                	je     80223c <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  80225c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802262:	eb d8                	jmp    80223c <ipc_recv_pages+0x62>
+
+00802264 <ipc_recv>:
+{
+  802264:	55                   	push   %ebp
+  802265:	89 e5                	mov    %esp,%ebp
+  802267:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  80226a:	6a 00                	push   $0x0
+  80226c:	ff 75 10             	push   0x10(%ebp)
+  80226f:	6a 01                	push   $0x1
+  802271:	ff 75 0c             	push   0xc(%ebp)
+  802274:	ff 75 08             	push   0x8(%ebp)
+  802277:	e8 5e ff ff ff       	call   8021da <ipc_recv_pages>
+}
+  80227c:	c9                   	leave
+  80227d:	c3                   	ret
+
+0080227e <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80227e:	55                   	push   %ebp
+  80227f:	89 e5                	mov    %esp,%ebp
+  802281:	56                   	push   %esi
+  802282:	53                   	push   %ebx
+  802283:	8b 75 08             	mov    0x8(%ebp),%esi
+  802286:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  802289:	83 ec 0c             	sub    $0xc,%esp
+  80228c:	ff 75 0c             	push   0xc(%ebp)
+  80228f:	e8 60 e4 ff ff       	call   8006f4 <sys_ipc_try_recv>
+  802294:	83 c4 10             	add    $0x10,%esp
+  802297:	85 c0                	test   %eax,%eax
+  802299:	78 34                	js     8022cf <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80229b:	85 f6                	test   %esi,%esi
+  80229d:	74 0d                	je     8022ac <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  80229f:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022a4:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8022aa:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8022ac:	85 db                	test   %ebx,%ebx
+  8022ae:	74 0d                	je     8022bd <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8022b0:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022b5:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8022bb:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8022bd:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022c2:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8022c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022cb:	5b                   	pop    %ebx
+  8022cc:	5e                   	pop    %esi
+  8022cd:	5d                   	pop    %ebp
+  8022ce:	c3                   	ret
+		if (from_env_store) {
+  8022cf:	85 f6                	test   %esi,%esi
+  8022d1:	74 06                	je     8022d9 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8022d3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8022d9:	85 db                	test   %ebx,%ebx
+  8022db:	74 eb                	je     8022c8 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8022dd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8022e3:	eb e3                	jmp    8022c8 <ipc_try_recv+0x4a>
+
+008022e5 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8022e5:	55                   	push   %ebp
+  8022e6:	89 e5                	mov    %esp,%ebp
+  8022e8:	83 ec 14             	sub    $0x14,%esp
+  8022eb:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8022ee:	85 c0                	test   %eax,%eax
+  8022f0:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8022f5:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8022f8:	ff 75 18             	push   0x18(%ebp)
+  8022fb:	ff 75 14             	push   0x14(%ebp)
+  8022fe:	50                   	push   %eax
+  8022ff:	ff 75 0c             	push   0xc(%ebp)
+  802302:	ff 75 08             	push   0x8(%ebp)
+  802305:	e8 79 e2 ff ff       	call   800583 <sys_ipc_send_pages>
+  80230a:	83 c4 20             	add    $0x20,%esp
+  80230d:	85 c0                	test   %eax,%eax
+  80230f:	78 02                	js     802313 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  802311:	c9                   	leave
+  802312:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  802313:	50                   	push   %eax
+  802314:	68 2c 2b 80 00       	push   $0x802b2c
+  802319:	68 80 00 00 00       	push   $0x80
+  80231e:	68 58 2b 80 00       	push   $0x802b58
+  802323:	e8 f0 f3 ff ff       	call   801718 <_panic>
+
+00802328 <ipc_send>:
+{
+  802328:	55                   	push   %ebp
+  802329:	89 e5                	mov    %esp,%ebp
+  80232b:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  80232e:	ff 75 14             	push   0x14(%ebp)
+  802331:	6a 01                	push   $0x1
+  802333:	ff 75 10             	push   0x10(%ebp)
+  802336:	ff 75 0c             	push   0xc(%ebp)
+  802339:	ff 75 08             	push   0x8(%ebp)
+  80233c:	e8 a4 ff ff ff       	call   8022e5 <ipc_send_pages>
+}
+  802341:	83 c4 20             	add    $0x20,%esp
+  802344:	c9                   	leave
+  802345:	c3                   	ret
+
+00802346 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802346:	55                   	push   %ebp
+  802347:	89 e5                	mov    %esp,%ebp
+  802349:	83 ec 14             	sub    $0x14,%esp
+  80234c:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80234f:	85 c0                	test   %eax,%eax
+  802351:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802356:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802359:	ff 75 18             	push   0x18(%ebp)
+  80235c:	ff 75 14             	push   0x14(%ebp)
+  80235f:	50                   	push   %eax
+  802360:	ff 75 0c             	push   0xc(%ebp)
+  802363:	ff 75 08             	push   0x8(%ebp)
+  802366:	e8 a9 e2 ff ff       	call   800614 <sys_ipc_call>
+  80236b:	83 c4 20             	add    $0x20,%esp
+  80236e:	85 c0                	test   %eax,%eax
+  802370:	78 0b                	js     80237d <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  802372:	a1 08 40 80 00       	mov    0x804008,%eax
+  802377:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80237d:	c9                   	leave
+  80237e:	c3                   	ret
+
+0080237f <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  80237f:	55                   	push   %ebp
+  802380:	89 e5                	mov    %esp,%ebp
+  802382:	57                   	push   %edi
+  802383:	56                   	push   %esi
+  802384:	53                   	push   %ebx
+  802385:	83 ec 18             	sub    $0x18,%esp
+  802388:	8b 45 10             	mov    0x10(%ebp),%eax
+  80238b:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  80238e:	8b 75 20             	mov    0x20(%ebp),%esi
+  802391:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802394:	85 c0                	test   %eax,%eax
+  802396:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80239b:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80239e:	ff 75 18             	push   0x18(%ebp)
+  8023a1:	ff 75 14             	push   0x14(%ebp)
+  8023a4:	50                   	push   %eax
+  8023a5:	ff 75 0c             	push   0xc(%ebp)
+  8023a8:	ff 75 08             	push   0x8(%ebp)
+  8023ab:	e8 a5 e2 ff ff       	call   800655 <sys_ipc_reply_recv>
+  8023b0:	83 c4 20             	add    $0x20,%esp
+  8023b3:	85 c0                	test   %eax,%eax
+  8023b5:	78 46                	js     8023fd <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8023b7:	85 ff                	test   %edi,%edi
+  8023b9:	74 0d                	je     8023c8 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8023bb:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023c0:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8023c6:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8023c8:	85 f6                	test   %esi,%esi
+  8023ca:	74 0d                	je     8023d9 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8023cc:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023d1:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8023d7:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8023d9:	85 db                	test   %ebx,%ebx
+  8023db:	74 0d                	je     8023ea <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8023dd:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023e2:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8023e8:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8023ea:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023ef:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8023f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023f8:	5b                   	pop    %ebx
+  8023f9:	5e                   	pop    %esi
+  8023fa:	5f                   	pop    %edi
+  8023fb:	5d                   	pop    %ebp
+  8023fc:	c3                   	ret
+		if (from_env_store) {
+  8023fd:	85 ff                	test   %edi,%edi
+  8023ff:	74 06                	je     802407 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  802401:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802407:	85 f6                	test   %esi,%esi
+  802409:	74 06                	je     802411 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  80240b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802411:	85 db                	test   %ebx,%ebx
+  802413:	74 e0                	je     8023f5 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  802415:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80241b:	eb d8                	jmp    8023f5 <ipc_reply_recv+0x76>
+
+0080241d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80241d:	55                   	push   %ebp
+  80241e:	89 e5                	mov    %esp,%ebp
+  802420:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802423:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  802428:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80242b:	c1 e0 06             	shl    $0x6,%eax
+  80242e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802433:	8b 40 50             	mov    0x50(%eax),%eax
+  802436:	39 c8                	cmp    %ecx,%eax
+  802438:	74 12                	je     80244c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80243a:	83 c2 01             	add    $0x1,%edx
+  80243d:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802443:	75 e3                	jne    802428 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802445:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244a:	eb 0e                	jmp    80245a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80244c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80244f:	c1 e0 06             	shl    $0x6,%eax
+  802452:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802457:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80245a:	5d                   	pop    %ebp
+  80245b:	c3                   	ret
+
+0080245c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80245c:	55                   	push   %ebp
+  80245d:	89 e5                	mov    %esp,%ebp
+  80245f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802462:	89 c2                	mov    %eax,%edx
+  802464:	c1 ea 16             	shr    $0x16,%edx
+  802467:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80246e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802473:	f6 c1 01             	test   $0x1,%cl
+  802476:	74 1e                	je     802496 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  802478:	c1 e8 0c             	shr    $0xc,%eax
+  80247b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802482:	a8 01                	test   $0x1,%al
+  802484:	74 10                	je     802496 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802486:	c1 e8 0c             	shr    $0xc,%eax
+  802489:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80248c:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  802493:	0f b7 d2             	movzwl %dx,%edx
+}
+  802496:	89 d0                	mov    %edx,%eax
+  802498:	5d                   	pop    %ebp
+  802499:	c3                   	ret
+
+0080249a <udivmod>:
+  80249a:	55                   	push   %ebp
+  80249b:	57                   	push   %edi
+  80249c:	56                   	push   %esi
+  80249d:	53                   	push   %ebx
+  80249e:	83 ec 24             	sub    $0x24,%esp
+  8024a1:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8024a5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8024a9:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8024ad:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8024b1:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024b5:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024b9:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8024bd:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024cc:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024d3:	00 
+  8024d4:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024db:	00 
+  8024dc:	89 fb                	mov    %edi,%ebx
+  8024de:	eb 08                	jmp    8024e8 <udivmod+0x4e>
+  8024e0:	83 e9 01             	sub    $0x1,%ecx
+  8024e3:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8024e6:	74 68                	je     802550 <udivmod+0xb6>
+  8024e8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024ec:	01 c0                	add    %eax,%eax
+  8024ee:	89 c6                	mov    %eax,%esi
+  8024f0:	89 d7                	mov    %edx,%edi
+  8024f2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8024f6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8024fa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024fd:	d3 ea                	shr    %cl,%edx
+  8024ff:	f6 c1 20             	test   $0x20,%cl
+  802502:	74 04                	je     802508 <udivmod+0x6e>
+  802504:	89 d0                	mov    %edx,%eax
+  802506:	31 d2                	xor    %edx,%edx
+  802508:	83 e0 01             	and    $0x1,%eax
+  80250b:	89 04 24             	mov    %eax,(%esp)
+  80250e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802515:	00 
+  802516:	8b 04 24             	mov    (%esp),%eax
+  802519:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80251d:	09 f0                	or     %esi,%eax
+  80251f:	09 fa                	or     %edi,%edx
+  802521:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802525:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802529:	39 f0                	cmp    %esi,%eax
+  80252b:	89 d5                	mov    %edx,%ebp
+  80252d:	19 fd                	sbb    %edi,%ebp
+  80252f:	72 af                	jb     8024e0 <udivmod+0x46>
+  802531:	29 f0                	sub    %esi,%eax
+  802533:	19 fa                	sbb    %edi,%edx
+  802535:	89 cf                	mov    %ecx,%edi
+  802537:	c1 ef 05             	shr    $0x5,%edi
+  80253a:	83 e7 01             	and    $0x1,%edi
+  80253d:	89 fe                	mov    %edi,%esi
+  80253f:	83 f6 01             	xor    $0x1,%esi
+  802542:	d3 e6                	shl    %cl,%esi
+  802544:	d3 e7                	shl    %cl,%edi
+  802546:	09 74 24 18          	or     %esi,0x18(%esp)
+  80254a:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80254e:	eb 90                	jmp    8024e0 <udivmod+0x46>
+  802550:	85 db                	test   %ebx,%ebx
+  802552:	74 05                	je     802559 <udivmod+0xbf>
+  802554:	89 03                	mov    %eax,(%ebx)
+  802556:	89 53 04             	mov    %edx,0x4(%ebx)
+  802559:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80255d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802561:	83 c4 24             	add    $0x24,%esp
+  802564:	5b                   	pop    %ebx
+  802565:	5e                   	pop    %esi
+  802566:	5f                   	pop    %edi
+  802567:	5d                   	pop    %ebp
+  802568:	c3                   	ret
+
+00802569 <__udivdi3>:
+  802569:	83 ec 08             	sub    $0x8,%esp
+  80256c:	6a 00                	push   $0x0
+  80256e:	ff 74 24 1c          	push   0x1c(%esp)
+  802572:	ff 74 24 1c          	push   0x1c(%esp)
+  802576:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80257a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80257e:	e8 17 ff ff ff       	call   80249a <udivmod>
+  802583:	83 c4 14             	add    $0x14,%esp
+  802586:	c3                   	ret
+
+00802587 <__umoddi3>:
+  802587:	83 ec 18             	sub    $0x18,%esp
+  80258a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80258e:	50                   	push   %eax
+  80258f:	ff 74 24 2c          	push   0x2c(%esp)
+  802593:	ff 74 24 2c          	push   0x2c(%esp)
+  802597:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80259b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80259f:	e8 f6 fe ff ff       	call   80249a <udivmod>
+  8025a4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025a8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025ac:	83 c4 24             	add    $0x24,%esp
+  8025af:	c3                   	ret
+
+008025b0 <__divdi3>:
+  8025b0:	55                   	push   %ebp
+  8025b1:	57                   	push   %edi
+  8025b2:	56                   	push   %esi
+  8025b3:	53                   	push   %ebx
+  8025b4:	83 ec 10             	sub    $0x10,%esp
+  8025b7:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8025bb:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8025bf:	89 c6                	mov    %eax,%esi
+  8025c1:	89 d7                	mov    %edx,%edi
+  8025c3:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8025c7:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8025cb:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025cf:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8025d3:	89 c5                	mov    %eax,%ebp
+  8025d5:	f7 dd                	neg    %ebp
+  8025d7:	89 d6                	mov    %edx,%esi
+  8025d9:	83 d6 00             	adc    $0x0,%esi
+  8025dc:	f7 de                	neg    %esi
+  8025de:	0f 48 e8             	cmovs  %eax,%ebp
+  8025e1:	0f 49 d6             	cmovns %esi,%edx
+  8025e4:	6a 00                	push   $0x0
+  8025e6:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8025ea:	f7 de                	neg    %esi
+  8025ec:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8025f0:	83 d0 00             	adc    $0x0,%eax
+  8025f3:	f7 d8                	neg    %eax
+  8025f5:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  8025fa:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  8025ff:	50                   	push   %eax
+  802600:	56                   	push   %esi
+  802601:	89 e8                	mov    %ebp,%eax
+  802603:	e8 92 fe ff ff       	call   80249a <udivmod>
+  802608:	83 c4 10             	add    $0x10,%esp
+  80260b:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  802610:	78 08                	js     80261a <__divdi3+0x6a>
+  802612:	83 c4 0c             	add    $0xc,%esp
+  802615:	5b                   	pop    %ebx
+  802616:	5e                   	pop    %esi
+  802617:	5f                   	pop    %edi
+  802618:	5d                   	pop    %ebp
+  802619:	c3                   	ret
+  80261a:	f7 d8                	neg    %eax
+  80261c:	83 d2 00             	adc    $0x0,%edx
+  80261f:	f7 da                	neg    %edx
+  802621:	eb ef                	jmp    802612 <__divdi3+0x62>
+
+00802623 <__moddi3>:
+  802623:	55                   	push   %ebp
+  802624:	57                   	push   %edi
+  802625:	56                   	push   %esi
+  802626:	53                   	push   %ebx
+  802627:	83 ec 18             	sub    $0x18,%esp
+  80262a:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80262e:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802632:	89 f1                	mov    %esi,%ecx
+  802634:	f7 d9                	neg    %ecx
+  802636:	89 da                	mov    %ebx,%edx
+  802638:	83 d2 00             	adc    $0x0,%edx
+  80263b:	f7 da                	neg    %edx
+  80263d:	0f 48 ce             	cmovs  %esi,%ecx
+  802640:	0f 48 d3             	cmovs  %ebx,%edx
+  802643:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802647:	50                   	push   %eax
+  802648:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80264c:	f7 de                	neg    %esi
+  80264e:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802652:	83 d0 00             	adc    $0x0,%eax
+  802655:	f7 d8                	neg    %eax
+  802657:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80265c:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802661:	50                   	push   %eax
+  802662:	56                   	push   %esi
+  802663:	89 c8                	mov    %ecx,%eax
+  802665:	e8 30 fe ff ff       	call   80249a <udivmod>
+  80266a:	83 c4 10             	add    $0x10,%esp
+  80266d:	85 db                	test   %ebx,%ebx
+  80266f:	78 10                	js     802681 <__moddi3+0x5e>
+  802671:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802675:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802679:	83 c4 14             	add    $0x14,%esp
+  80267c:	5b                   	pop    %ebx
+  80267d:	5e                   	pop    %esi
+  80267e:	5f                   	pop    %edi
+  80267f:	5d                   	pop    %ebp
+  802680:	c3                   	ret
+  802681:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802685:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802689:	f7 d8                	neg    %eax
+  80268b:	83 d2 00             	adc    $0x0,%edx
+  80268e:	f7 da                	neg    %edx
+  802690:	eb e7                	jmp    802679 <__moddi3+0x56>
@@ -0,0 +1,5564 @@
+
+obj/user/buggyhello2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_cputs(hello, 1024*1024);
+  800039:	68 00 00 10 00       	push   $0x100000
+  80003e:	ff 35 00 30 80 00    	push   0x803000
+  800044:	e8 8e 00 00 00       	call   8000d7 <sys_cputs>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800059:	e8 08 01 00 00       	call   800166 <sys_getenvid>
+  80005e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800063:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800066:	c1 e0 06             	shl    $0x6,%eax
+  800069:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006e:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800073:	85 db                	test   %ebx,%ebx
+  800075:	7e 07                	jle    80007e <libmain+0x30>
+		binaryname = argv[0];
+  800077:	8b 06                	mov    (%esi),%eax
+  800079:	a3 04 30 80 00       	mov    %eax,0x803004
+
+	// call user main routine
+	umain(argc, argv);
+  80007e:	83 ec 08             	sub    $0x8,%esp
+  800081:	56                   	push   %esi
+  800082:	53                   	push   %ebx
+  800083:	e8 ab ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800088:	e8 0a 00 00 00       	call   800097 <exit>
+}
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800093:	5b                   	pop    %ebx
+  800094:	5e                   	pop    %esi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+
+00800097 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800097:	55                   	push   %ebp
+  800098:	89 e5                	mov    %esp,%ebp
+  80009a:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80009d:	e8 68 08 00 00       	call   80090a <close_all>
+	sys_env_destroy(0);
+  8000a2:	83 ec 0c             	sub    $0xc,%esp
+  8000a5:	6a 00                	push   $0x0
+  8000a7:	e8 79 00 00 00       	call   800125 <sys_env_destroy>
+}
+  8000ac:	83 c4 10             	add    $0x10,%esp
+  8000af:	c9                   	leave
+  8000b0:	c3                   	ret
+
+008000b1 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  8000b1:	55                   	push   %ebp
+  8000b2:	89 e5                	mov    %esp,%ebp
+  8000b4:	83 ec 10             	sub    $0x10,%esp
+  8000b7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000ba:	89 c8                	mov    %ecx,%eax
+  8000bc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8000c1:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8000c4:	eb 0b                	jmp    8000d1 <touch_mem+0x20>
+		c = *(char *)page;
+  8000c6:	0f b6 10             	movzbl (%eax),%edx
+  8000c9:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000cc:	05 00 10 00 00       	add    $0x1000,%eax
+  8000d1:	39 c8                	cmp    %ecx,%eax
+  8000d3:	72 f1                	jb     8000c6 <touch_mem+0x15>
+}
+  8000d5:	c9                   	leave
+  8000d6:	c3                   	ret
+
+008000d7 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000d7:	55                   	push   %ebp
+  8000d8:	89 e5                	mov    %esp,%ebp
+  8000da:	57                   	push   %edi
+  8000db:	56                   	push   %esi
+  8000dc:	53                   	push   %ebx
+	touch_mem(s, len);
+  8000dd:	ff 75 0c             	push   0xc(%ebp)
+  8000e0:	ff 75 08             	push   0x8(%ebp)
+  8000e3:	e8 c9 ff ff ff       	call   8000b1 <touch_mem>
+	asm volatile("int %1\n"
+  8000e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000f3:	89 c3                	mov    %eax,%ebx
+  8000f5:	89 c7                	mov    %eax,%edi
+  8000f7:	89 c6                	mov    %eax,%esi
+  8000f9:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000fb:	83 c4 08             	add    $0x8,%esp
+  8000fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800101:	5b                   	pop    %ebx
+  800102:	5e                   	pop    %esi
+  800103:	5f                   	pop    %edi
+  800104:	5d                   	pop    %ebp
+  800105:	c3                   	ret
+
+00800106 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800106:	55                   	push   %ebp
+  800107:	89 e5                	mov    %esp,%ebp
+  800109:	57                   	push   %edi
+  80010a:	56                   	push   %esi
+  80010b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80010c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800111:	b8 01 00 00 00       	mov    $0x1,%eax
+  800116:	89 d1                	mov    %edx,%ecx
+  800118:	89 d3                	mov    %edx,%ebx
+  80011a:	89 d7                	mov    %edx,%edi
+  80011c:	89 d6                	mov    %edx,%esi
+  80011e:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800120:	5b                   	pop    %ebx
+  800121:	5e                   	pop    %esi
+  800122:	5f                   	pop    %edi
+  800123:	5d                   	pop    %ebp
+  800124:	c3                   	ret
+
+00800125 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800125:	55                   	push   %ebp
+  800126:	89 e5                	mov    %esp,%ebp
+  800128:	57                   	push   %edi
+  800129:	56                   	push   %esi
+  80012a:	53                   	push   %ebx
+  80012b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80012e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800133:	8b 55 08             	mov    0x8(%ebp),%edx
+  800136:	b8 03 00 00 00       	mov    $0x3,%eax
+  80013b:	89 cb                	mov    %ecx,%ebx
+  80013d:	89 cf                	mov    %ecx,%edi
+  80013f:	89 ce                	mov    %ecx,%esi
+  800141:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800143:	85 c0                	test   %eax,%eax
+  800145:	7f 08                	jg     80014f <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800147:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80014a:	5b                   	pop    %ebx
+  80014b:	5e                   	pop    %esi
+  80014c:	5f                   	pop    %edi
+  80014d:	5d                   	pop    %ebp
+  80014e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80014f:	83 ec 0c             	sub    $0xc,%esp
+  800152:	50                   	push   %eax
+  800153:	6a 03                	push   $0x3
+  800155:	68 b8 26 80 00       	push   $0x8026b8
+  80015a:	6a 23                	push   $0x23
+  80015c:	68 d5 26 80 00       	push   $0x8026d5
+  800161:	e8 b9 15 00 00       	call   80171f <_panic>
+
+00800166 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800166:	55                   	push   %ebp
+  800167:	89 e5                	mov    %esp,%ebp
+  800169:	57                   	push   %edi
+  80016a:	56                   	push   %esi
+  80016b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80016c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800171:	b8 02 00 00 00       	mov    $0x2,%eax
+  800176:	89 d1                	mov    %edx,%ecx
+  800178:	89 d3                	mov    %edx,%ebx
+  80017a:	89 d7                	mov    %edx,%edi
+  80017c:	89 d6                	mov    %edx,%esi
+  80017e:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800180:	5b                   	pop    %ebx
+  800181:	5e                   	pop    %esi
+  800182:	5f                   	pop    %edi
+  800183:	5d                   	pop    %ebp
+  800184:	c3                   	ret
+
+00800185 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800185:	55                   	push   %ebp
+  800186:	89 e5                	mov    %esp,%ebp
+  800188:	57                   	push   %edi
+  800189:	56                   	push   %esi
+  80018a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80018b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800190:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800195:	89 d1                	mov    %edx,%ecx
+  800197:	89 d3                	mov    %edx,%ebx
+  800199:	89 d7                	mov    %edx,%edi
+  80019b:	89 d6                	mov    %edx,%esi
+  80019d:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80019f:	5b                   	pop    %ebx
+  8001a0:	5e                   	pop    %esi
+  8001a1:	5f                   	pop    %edi
+  8001a2:	5d                   	pop    %ebp
+  8001a3:	c3                   	ret
+
+008001a4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001a4:	55                   	push   %ebp
+  8001a5:	89 e5                	mov    %esp,%ebp
+  8001a7:	57                   	push   %edi
+  8001a8:	56                   	push   %esi
+  8001a9:	53                   	push   %ebx
+  8001aa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8001b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001b8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001c0:	89 f7                	mov    %esi,%edi
+  8001c2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001c4:	85 c0                	test   %eax,%eax
+  8001c6:	7f 08                	jg     8001d0 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001cb:	5b                   	pop    %ebx
+  8001cc:	5e                   	pop    %esi
+  8001cd:	5f                   	pop    %edi
+  8001ce:	5d                   	pop    %ebp
+  8001cf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001d0:	83 ec 0c             	sub    $0xc,%esp
+  8001d3:	50                   	push   %eax
+  8001d4:	6a 04                	push   $0x4
+  8001d6:	68 b8 26 80 00       	push   $0x8026b8
+  8001db:	6a 23                	push   $0x23
+  8001dd:	68 d5 26 80 00       	push   $0x8026d5
+  8001e2:	e8 38 15 00 00       	call   80171f <_panic>
+
+008001e7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001e7:	55                   	push   %ebp
+  8001e8:	89 e5                	mov    %esp,%ebp
+  8001ea:	57                   	push   %edi
+  8001eb:	56                   	push   %esi
+  8001ec:	53                   	push   %ebx
+  8001ed:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001f6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001fe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800201:	8b 75 18             	mov    0x18(%ebp),%esi
+  800204:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800206:	85 c0                	test   %eax,%eax
+  800208:	7f 08                	jg     800212 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80020a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020d:	5b                   	pop    %ebx
+  80020e:	5e                   	pop    %esi
+  80020f:	5f                   	pop    %edi
+  800210:	5d                   	pop    %ebp
+  800211:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800212:	83 ec 0c             	sub    $0xc,%esp
+  800215:	50                   	push   %eax
+  800216:	6a 05                	push   $0x5
+  800218:	68 b8 26 80 00       	push   $0x8026b8
+  80021d:	6a 23                	push   $0x23
+  80021f:	68 d5 26 80 00       	push   $0x8026d5
+  800224:	e8 f6 14 00 00       	call   80171f <_panic>
+
+00800229 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800229:	55                   	push   %ebp
+  80022a:	89 e5                	mov    %esp,%ebp
+  80022c:	57                   	push   %edi
+  80022d:	56                   	push   %esi
+  80022e:	53                   	push   %ebx
+  80022f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800232:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800237:	8b 55 08             	mov    0x8(%ebp),%edx
+  80023a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80023d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800242:	89 df                	mov    %ebx,%edi
+  800244:	89 de                	mov    %ebx,%esi
+  800246:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800248:	85 c0                	test   %eax,%eax
+  80024a:	7f 08                	jg     800254 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80024c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024f:	5b                   	pop    %ebx
+  800250:	5e                   	pop    %esi
+  800251:	5f                   	pop    %edi
+  800252:	5d                   	pop    %ebp
+  800253:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800254:	83 ec 0c             	sub    $0xc,%esp
+  800257:	50                   	push   %eax
+  800258:	6a 06                	push   $0x6
+  80025a:	68 b8 26 80 00       	push   $0x8026b8
+  80025f:	6a 23                	push   $0x23
+  800261:	68 d5 26 80 00       	push   $0x8026d5
+  800266:	e8 b4 14 00 00       	call   80171f <_panic>
+
+0080026b <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  80026b:	55                   	push   %ebp
+  80026c:	89 e5                	mov    %esp,%ebp
+  80026e:	57                   	push   %edi
+  80026f:	56                   	push   %esi
+  800270:	53                   	push   %ebx
+  800271:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800274:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800279:	8b 55 08             	mov    0x8(%ebp),%edx
+  80027c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80027f:	b8 18 00 00 00       	mov    $0x18,%eax
+  800284:	89 df                	mov    %ebx,%edi
+  800286:	89 de                	mov    %ebx,%esi
+  800288:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80028a:	85 c0                	test   %eax,%eax
+  80028c:	7f 08                	jg     800296 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80028e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800291:	5b                   	pop    %ebx
+  800292:	5e                   	pop    %esi
+  800293:	5f                   	pop    %edi
+  800294:	5d                   	pop    %ebp
+  800295:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800296:	83 ec 0c             	sub    $0xc,%esp
+  800299:	50                   	push   %eax
+  80029a:	6a 18                	push   $0x18
+  80029c:	68 b8 26 80 00       	push   $0x8026b8
+  8002a1:	6a 23                	push   $0x23
+  8002a3:	68 d5 26 80 00       	push   $0x8026d5
+  8002a8:	e8 72 14 00 00       	call   80171f <_panic>
+
+008002ad <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  8002ad:	55                   	push   %ebp
+  8002ae:	89 e5                	mov    %esp,%ebp
+  8002b0:	57                   	push   %edi
+  8002b1:	56                   	push   %esi
+  8002b2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002be:	b8 19 00 00 00       	mov    $0x19,%eax
+  8002c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002c6:	89 f7                	mov    %esi,%edi
+  8002c8:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  8002ca:	5b                   	pop    %ebx
+  8002cb:	5e                   	pop    %esi
+  8002cc:	5f                   	pop    %edi
+  8002cd:	5d                   	pop    %ebp
+  8002ce:	c3                   	ret
+
+008002cf <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8002cf:	55                   	push   %ebp
+  8002d0:	89 e5                	mov    %esp,%ebp
+  8002d2:	57                   	push   %edi
+  8002d3:	56                   	push   %esi
+  8002d4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002db:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8002e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002e8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002eb:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8002ed:	5b                   	pop    %ebx
+  8002ee:	5e                   	pop    %esi
+  8002ef:	5f                   	pop    %edi
+  8002f0:	5d                   	pop    %ebp
+  8002f1:	c3                   	ret
+
+008002f2 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  8002f2:	55                   	push   %ebp
+  8002f3:	89 e5                	mov    %esp,%ebp
+  8002f5:	57                   	push   %edi
+  8002f6:	56                   	push   %esi
+  8002f7:	53                   	push   %ebx
+  8002f8:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  8002fb:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8002fe:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800304:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800307:	8b 55 08             	mov    0x8(%ebp),%edx
+  80030a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80030d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800312:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800315:	8b 75 18             	mov    0x18(%ebp),%esi
+  800318:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80031a:	85 c0                	test   %eax,%eax
+  80031c:	7f 08                	jg     800326 <sys_page_map_range+0x34>
+}
+  80031e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800321:	5b                   	pop    %ebx
+  800322:	5e                   	pop    %esi
+  800323:	5f                   	pop    %edi
+  800324:	5d                   	pop    %ebp
+  800325:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800326:	83 ec 0c             	sub    $0xc,%esp
+  800329:	50                   	push   %eax
+  80032a:	6a 10                	push   $0x10
+  80032c:	68 b8 26 80 00       	push   $0x8026b8
+  800331:	6a 23                	push   $0x23
+  800333:	68 d5 26 80 00       	push   $0x8026d5
+  800338:	e8 e2 13 00 00       	call   80171f <_panic>
+
+0080033d <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  80033d:	55                   	push   %ebp
+  80033e:	89 e5                	mov    %esp,%ebp
+  800340:	57                   	push   %edi
+  800341:	56                   	push   %esi
+  800342:	53                   	push   %ebx
+  800343:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800346:	be 00 00 00 00       	mov    $0x0,%esi
+  80034b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80034e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800351:	b8 11 00 00 00       	mov    $0x11,%eax
+  800356:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800359:	89 f7                	mov    %esi,%edi
+  80035b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80035d:	85 c0                	test   %eax,%eax
+  80035f:	7f 08                	jg     800369 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800361:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800364:	5b                   	pop    %ebx
+  800365:	5e                   	pop    %esi
+  800366:	5f                   	pop    %edi
+  800367:	5d                   	pop    %ebp
+  800368:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800369:	83 ec 0c             	sub    $0xc,%esp
+  80036c:	50                   	push   %eax
+  80036d:	6a 11                	push   $0x11
+  80036f:	68 b8 26 80 00       	push   $0x8026b8
+  800374:	6a 23                	push   $0x23
+  800376:	68 d5 26 80 00       	push   $0x8026d5
+  80037b:	e8 9f 13 00 00       	call   80171f <_panic>
+
+00800380 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800380:	55                   	push   %ebp
+  800381:	89 e5                	mov    %esp,%ebp
+  800383:	57                   	push   %edi
+  800384:	56                   	push   %esi
+  800385:	53                   	push   %ebx
+  800386:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800389:	be 00 00 00 00       	mov    $0x0,%esi
+  80038e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800391:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800394:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800399:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80039c:	89 f7                	mov    %esi,%edi
+  80039e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003a0:	85 c0                	test   %eax,%eax
+  8003a2:	7f 08                	jg     8003ac <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8003a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a7:	5b                   	pop    %ebx
+  8003a8:	5e                   	pop    %esi
+  8003a9:	5f                   	pop    %edi
+  8003aa:	5d                   	pop    %ebp
+  8003ab:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003ac:	83 ec 0c             	sub    $0xc,%esp
+  8003af:	50                   	push   %eax
+  8003b0:	6a 1b                	push   $0x1b
+  8003b2:	68 b8 26 80 00       	push   $0x8026b8
+  8003b7:	6a 23                	push   $0x23
+  8003b9:	68 d5 26 80 00       	push   $0x8026d5
+  8003be:	e8 5c 13 00 00       	call   80171f <_panic>
+
+008003c3 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  8003c3:	55                   	push   %ebp
+  8003c4:	89 e5                	mov    %esp,%ebp
+  8003c6:	57                   	push   %edi
+  8003c7:	56                   	push   %esi
+  8003c8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003ce:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003d3:	89 d1                	mov    %edx,%ecx
+  8003d5:	89 d3                	mov    %edx,%ebx
+  8003d7:	89 d7                	mov    %edx,%edi
+  8003d9:	89 d6                	mov    %edx,%esi
+  8003db:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8003dd:	5b                   	pop    %ebx
+  8003de:	5e                   	pop    %esi
+  8003df:	5f                   	pop    %edi
+  8003e0:	5d                   	pop    %ebp
+  8003e1:	c3                   	ret
+
+008003e2 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003e2:	55                   	push   %ebp
+  8003e3:	89 e5                	mov    %esp,%ebp
+  8003e5:	57                   	push   %edi
+  8003e6:	56                   	push   %esi
+  8003e7:	53                   	push   %ebx
+  8003e8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003f6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8003fb:	89 df                	mov    %ebx,%edi
+  8003fd:	89 de                	mov    %ebx,%esi
+  8003ff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800401:	85 c0                	test   %eax,%eax
+  800403:	7f 08                	jg     80040d <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800405:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800408:	5b                   	pop    %ebx
+  800409:	5e                   	pop    %esi
+  80040a:	5f                   	pop    %edi
+  80040b:	5d                   	pop    %ebp
+  80040c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80040d:	83 ec 0c             	sub    $0xc,%esp
+  800410:	50                   	push   %eax
+  800411:	6a 08                	push   $0x8
+  800413:	68 b8 26 80 00       	push   $0x8026b8
+  800418:	6a 23                	push   $0x23
+  80041a:	68 d5 26 80 00       	push   $0x8026d5
+  80041f:	e8 fb 12 00 00       	call   80171f <_panic>
+
+00800424 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800424:	55                   	push   %ebp
+  800425:	89 e5                	mov    %esp,%ebp
+  800427:	57                   	push   %edi
+  800428:	56                   	push   %esi
+  800429:	53                   	push   %ebx
+  80042a:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  80042d:	6a 44                	push   $0x44
+  80042f:	ff 75 0c             	push   0xc(%ebp)
+  800432:	e8 7a fc ff ff       	call   8000b1 <touch_mem>
+	asm volatile("int %1\n"
+  800437:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80043c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80043f:	b8 09 00 00 00       	mov    $0x9,%eax
+  800444:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800447:	89 df                	mov    %ebx,%edi
+  800449:	89 de                	mov    %ebx,%esi
+  80044b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80044d:	83 c4 08             	add    $0x8,%esp
+  800450:	85 c0                	test   %eax,%eax
+  800452:	7f 08                	jg     80045c <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800454:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800457:	5b                   	pop    %ebx
+  800458:	5e                   	pop    %esi
+  800459:	5f                   	pop    %edi
+  80045a:	5d                   	pop    %ebp
+  80045b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80045c:	83 ec 0c             	sub    $0xc,%esp
+  80045f:	50                   	push   %eax
+  800460:	6a 09                	push   $0x9
+  800462:	68 b8 26 80 00       	push   $0x8026b8
+  800467:	6a 23                	push   $0x23
+  800469:	68 d5 26 80 00       	push   $0x8026d5
+  80046e:	e8 ac 12 00 00       	call   80171f <_panic>
+
+00800473 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800473:	55                   	push   %ebp
+  800474:	89 e5                	mov    %esp,%ebp
+  800476:	57                   	push   %edi
+  800477:	56                   	push   %esi
+  800478:	53                   	push   %ebx
+  800479:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80047c:	be 00 00 00 00       	mov    $0x0,%esi
+  800481:	8b 55 08             	mov    0x8(%ebp),%edx
+  800484:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800487:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80048c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80048f:	89 f7                	mov    %esi,%edi
+  800491:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800493:	85 c0                	test   %eax,%eax
+  800495:	7f 08                	jg     80049f <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800497:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80049a:	5b                   	pop    %ebx
+  80049b:	5e                   	pop    %esi
+  80049c:	5f                   	pop    %edi
+  80049d:	5d                   	pop    %ebp
+  80049e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80049f:	83 ec 0c             	sub    $0xc,%esp
+  8004a2:	50                   	push   %eax
+  8004a3:	6a 1a                	push   $0x1a
+  8004a5:	68 b8 26 80 00       	push   $0x8026b8
+  8004aa:	6a 23                	push   $0x23
+  8004ac:	68 d5 26 80 00       	push   $0x8026d5
+  8004b1:	e8 69 12 00 00       	call   80171f <_panic>
+
+008004b6 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8004b6:	55                   	push   %ebp
+  8004b7:	89 e5                	mov    %esp,%ebp
+  8004b9:	57                   	push   %edi
+  8004ba:	56                   	push   %esi
+  8004bb:	53                   	push   %ebx
+  8004bc:	83 ec 0c             	sub    $0xc,%esp
+  8004bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8004c2:	89 d8                	mov    %ebx,%eax
+  8004c4:	c1 e0 05             	shl    $0x5,%eax
+  8004c7:	50                   	push   %eax
+  8004c8:	ff 75 0c             	push   0xc(%ebp)
+  8004cb:	e8 e1 fb ff ff       	call   8000b1 <touch_mem>
+	asm volatile("int %1\n"
+  8004d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8004d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004d8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004e0:	89 f7                	mov    %esi,%edi
+  8004e2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004e4:	83 c4 08             	add    $0x8,%esp
+  8004e7:	85 c0                	test   %eax,%eax
+  8004e9:	7f 08                	jg     8004f3 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8004eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004ee:	5b                   	pop    %ebx
+  8004ef:	5e                   	pop    %esi
+  8004f0:	5f                   	pop    %edi
+  8004f1:	5d                   	pop    %ebp
+  8004f2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004f3:	83 ec 0c             	sub    $0xc,%esp
+  8004f6:	50                   	push   %eax
+  8004f7:	6a 13                	push   $0x13
+  8004f9:	68 b8 26 80 00       	push   $0x8026b8
+  8004fe:	6a 23                	push   $0x23
+  800500:	68 d5 26 80 00       	push   $0x8026d5
+  800505:	e8 15 12 00 00       	call   80171f <_panic>
+
+0080050a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80050a:	55                   	push   %ebp
+  80050b:	89 e5                	mov    %esp,%ebp
+  80050d:	57                   	push   %edi
+  80050e:	56                   	push   %esi
+  80050f:	53                   	push   %ebx
+  800510:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800513:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800518:	8b 55 08             	mov    0x8(%ebp),%edx
+  80051b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80051e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800523:	89 df                	mov    %ebx,%edi
+  800525:	89 de                	mov    %ebx,%esi
+  800527:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800529:	85 c0                	test   %eax,%eax
+  80052b:	7f 08                	jg     800535 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80052d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800530:	5b                   	pop    %ebx
+  800531:	5e                   	pop    %esi
+  800532:	5f                   	pop    %edi
+  800533:	5d                   	pop    %ebp
+  800534:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800535:	83 ec 0c             	sub    $0xc,%esp
+  800538:	50                   	push   %eax
+  800539:	6a 0a                	push   $0xa
+  80053b:	68 b8 26 80 00       	push   $0x8026b8
+  800540:	6a 23                	push   $0x23
+  800542:	68 d5 26 80 00       	push   $0x8026d5
+  800547:	e8 d3 11 00 00       	call   80171f <_panic>
+
+0080054c <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80054c:	55                   	push   %ebp
+  80054d:	89 e5                	mov    %esp,%ebp
+  80054f:	57                   	push   %edi
+  800550:	56                   	push   %esi
+  800551:	53                   	push   %ebx
+  800552:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  800555:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80055b:	76 1d                	jbe    80057a <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80055d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800560:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800563:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800568:	be 01 00 00 00       	mov    $0x1,%esi
+  80056d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800570:	cd 30                	int    $0x30
+}
+  800572:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800575:	5b                   	pop    %ebx
+  800576:	5e                   	pop    %esi
+  800577:	5f                   	pop    %edi
+  800578:	5d                   	pop    %ebp
+  800579:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80057a:	68 00 10 00 00       	push   $0x1000
+  80057f:	53                   	push   %ebx
+  800580:	e8 2c fb ff ff       	call   8000b1 <touch_mem>
+  800585:	83 c4 08             	add    $0x8,%esp
+  800588:	eb d3                	jmp    80055d <sys_ipc_send+0x11>
+
+0080058a <sys_ipc_send_pages>:
+{
+  80058a:	55                   	push   %ebp
+  80058b:	89 e5                	mov    %esp,%ebp
+  80058d:	57                   	push   %edi
+  80058e:	56                   	push   %esi
+  80058f:	53                   	push   %ebx
+  800590:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800593:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  800596:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80059c:	76 18                	jbe    8005b6 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80059e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005a4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8005a9:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8005ac:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8005ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005b1:	5b                   	pop    %ebx
+  8005b2:	5e                   	pop    %esi
+  8005b3:	5f                   	pop    %edi
+  8005b4:	5d                   	pop    %ebp
+  8005b5:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8005b6:	89 f0                	mov    %esi,%eax
+  8005b8:	c1 e0 0c             	shl    $0xc,%eax
+  8005bb:	50                   	push   %eax
+  8005bc:	53                   	push   %ebx
+  8005bd:	e8 ef fa ff ff       	call   8000b1 <touch_mem>
+  8005c2:	83 c4 08             	add    $0x8,%esp
+  8005c5:	eb d7                	jmp    80059e <sys_ipc_send_pages+0x14>
+
+008005c7 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8005c7:	55                   	push   %ebp
+  8005c8:	89 e5                	mov    %esp,%ebp
+  8005ca:	57                   	push   %edi
+  8005cb:	56                   	push   %esi
+  8005cc:	53                   	push   %ebx
+  8005cd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8005d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005db:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8005e0:	89 df                	mov    %ebx,%edi
+  8005e2:	89 de                	mov    %ebx,%esi
+  8005e4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8005e6:	85 c0                	test   %eax,%eax
+  8005e8:	7f 08                	jg     8005f2 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8005ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005ed:	5b                   	pop    %ebx
+  8005ee:	5e                   	pop    %esi
+  8005ef:	5f                   	pop    %edi
+  8005f0:	5d                   	pop    %ebp
+  8005f1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8005f2:	83 ec 0c             	sub    $0xc,%esp
+  8005f5:	50                   	push   %eax
+  8005f6:	6a 0d                	push   $0xd
+  8005f8:	68 b8 26 80 00       	push   $0x8026b8
+  8005fd:	6a 23                	push   $0x23
+  8005ff:	68 d5 26 80 00       	push   $0x8026d5
+  800604:	e8 16 11 00 00       	call   80171f <_panic>
+
+00800609 <sys_ipc_recv>:
+{
+  800609:	55                   	push   %ebp
+  80060a:	89 e5                	mov    %esp,%ebp
+  80060c:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80060f:	6a 01                	push   $0x1
+  800611:	ff 75 08             	push   0x8(%ebp)
+  800614:	e8 ae ff ff ff       	call   8005c7 <sys_ipc_recv_pages>
+}
+  800619:	c9                   	leave
+  80061a:	c3                   	ret
+
+0080061b <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80061b:	55                   	push   %ebp
+  80061c:	89 e5                	mov    %esp,%ebp
+  80061e:	57                   	push   %edi
+  80061f:	56                   	push   %esi
+  800620:	53                   	push   %ebx
+  800621:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800624:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800627:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  80062a:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800630:	77 04                	ja     800636 <sys_ipc_call+0x1b>
+  800632:	85 f6                	test   %esi,%esi
+  800634:	75 15                	jne    80064b <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  800636:	8b 55 08             	mov    0x8(%ebp),%edx
+  800639:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80063c:	b8 14 00 00 00       	mov    $0x14,%eax
+  800641:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  800643:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800646:	5b                   	pop    %ebx
+  800647:	5e                   	pop    %esi
+  800648:	5f                   	pop    %edi
+  800649:	5d                   	pop    %ebp
+  80064a:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80064b:	89 f8                	mov    %edi,%eax
+  80064d:	c1 e0 0c             	shl    $0xc,%eax
+  800650:	50                   	push   %eax
+  800651:	53                   	push   %ebx
+  800652:	e8 5a fa ff ff       	call   8000b1 <touch_mem>
+  800657:	83 c4 08             	add    $0x8,%esp
+  80065a:	eb da                	jmp    800636 <sys_ipc_call+0x1b>
+
+0080065c <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80065c:	55                   	push   %ebp
+  80065d:	89 e5                	mov    %esp,%ebp
+  80065f:	57                   	push   %edi
+  800660:	56                   	push   %esi
+  800661:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800662:	8b 55 08             	mov    0x8(%ebp),%edx
+  800665:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800668:	b8 15 00 00 00       	mov    $0x15,%eax
+  80066d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800670:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800673:	8b 75 18             	mov    0x18(%ebp),%esi
+  800676:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  800678:	5b                   	pop    %ebx
+  800679:	5e                   	pop    %esi
+  80067a:	5f                   	pop    %edi
+  80067b:	5d                   	pop    %ebp
+  80067c:	c3                   	ret
+
+0080067d <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  80067d:	55                   	push   %ebp
+  80067e:	89 e5                	mov    %esp,%ebp
+  800680:	57                   	push   %edi
+  800681:	56                   	push   %esi
+  800682:	53                   	push   %ebx
+  800683:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  800686:	6a 04                	push   $0x4
+  800688:	ff 75 08             	push   0x8(%ebp)
+  80068b:	e8 21 fa ff ff       	call   8000b1 <touch_mem>
+	asm volatile("int %1\n"
+  800690:	be 00 00 00 00       	mov    $0x0,%esi
+  800695:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800698:	b8 16 00 00 00       	mov    $0x16,%eax
+  80069d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8006a3:	89 f7                	mov    %esi,%edi
+  8006a5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8006a7:	83 c4 08             	add    $0x8,%esp
+  8006aa:	85 c0                	test   %eax,%eax
+  8006ac:	7f 08                	jg     8006b6 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8006ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006b1:	5b                   	pop    %ebx
+  8006b2:	5e                   	pop    %esi
+  8006b3:	5f                   	pop    %edi
+  8006b4:	5d                   	pop    %ebp
+  8006b5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006b6:	83 ec 0c             	sub    $0xc,%esp
+  8006b9:	50                   	push   %eax
+  8006ba:	6a 16                	push   $0x16
+  8006bc:	68 b8 26 80 00       	push   $0x8026b8
+  8006c1:	6a 23                	push   $0x23
+  8006c3:	68 d5 26 80 00       	push   $0x8026d5
+  8006c8:	e8 52 10 00 00       	call   80171f <_panic>
+
+008006cd <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8006cd:	55                   	push   %ebp
+  8006ce:	89 e5                	mov    %esp,%ebp
+  8006d0:	57                   	push   %edi
+  8006d1:	56                   	push   %esi
+  8006d2:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8006d3:	6a 04                	push   $0x4
+  8006d5:	ff 75 08             	push   0x8(%ebp)
+  8006d8:	e8 d4 f9 ff ff       	call   8000b1 <touch_mem>
+	asm volatile("int %1\n"
+  8006dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006e5:	b8 17 00 00 00       	mov    $0x17,%eax
+  8006ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006ed:	89 df                	mov    %ebx,%edi
+  8006ef:	89 de                	mov    %ebx,%esi
+  8006f1:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8006f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006f6:	5b                   	pop    %ebx
+  8006f7:	5e                   	pop    %esi
+  8006f8:	5f                   	pop    %edi
+  8006f9:	5d                   	pop    %ebp
+  8006fa:	c3                   	ret
+
+008006fb <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8006fb:	55                   	push   %ebp
+  8006fc:	89 e5                	mov    %esp,%ebp
+  8006fe:	57                   	push   %edi
+  8006ff:	56                   	push   %esi
+  800700:	53                   	push   %ebx
+  800701:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800704:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800709:	8b 55 08             	mov    0x8(%ebp),%edx
+  80070c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800711:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800716:	89 df                	mov    %ebx,%edi
+  800718:	89 de                	mov    %ebx,%esi
+  80071a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80071c:	85 c0                	test   %eax,%eax
+  80071e:	7f 08                	jg     800728 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  800720:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800723:	5b                   	pop    %ebx
+  800724:	5e                   	pop    %esi
+  800725:	5f                   	pop    %edi
+  800726:	5d                   	pop    %ebp
+  800727:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800728:	83 ec 0c             	sub    $0xc,%esp
+  80072b:	50                   	push   %eax
+  80072c:	6a 0e                	push   $0xe
+  80072e:	68 b8 26 80 00       	push   $0x8026b8
+  800733:	6a 23                	push   $0x23
+  800735:	68 d5 26 80 00       	push   $0x8026d5
+  80073a:	e8 e0 0f 00 00       	call   80171f <_panic>
+
+0080073f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80073f:	55                   	push   %ebp
+  800740:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800742:	8b 45 08             	mov    0x8(%ebp),%eax
+  800745:	05 00 00 00 30       	add    $0x30000000,%eax
+  80074a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80074d:	5d                   	pop    %ebp
+  80074e:	c3                   	ret
+
+0080074f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80074f:	55                   	push   %ebp
+  800750:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800752:	8b 45 08             	mov    0x8(%ebp),%eax
+  800755:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80075a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80075f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800764:	5d                   	pop    %ebp
+  800765:	c3                   	ret
+
+00800766 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800766:	55                   	push   %ebp
+  800767:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  800769:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  80076e:	a8 01                	test   $0x1,%al
+  800770:	74 3c                	je     8007ae <fd_alloc+0x48>
+  800772:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800777:	89 c2                	mov    %eax,%edx
+  800779:	c1 ea 0c             	shr    $0xc,%edx
+  80077c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800783:	89 c1                	mov    %eax,%ecx
+  800785:	05 00 10 00 00       	add    $0x1000,%eax
+  80078a:	f6 c2 01             	test   $0x1,%dl
+  80078d:	74 13                	je     8007a2 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80078f:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  800794:	75 e1                	jne    800777 <fd_alloc+0x11>
+  800796:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80079b:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8007a0:	eb 05                	jmp    8007a7 <fd_alloc+0x41>
+			return 0;
+  8007a2:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8007a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007aa:	89 0a                	mov    %ecx,(%edx)
+}
+  8007ac:	5d                   	pop    %ebp
+  8007ad:	c3                   	ret
+  8007ae:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8007b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b8:	eb ed                	jmp    8007a7 <fd_alloc+0x41>
+
+008007ba <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8007ba:	55                   	push   %ebp
+  8007bb:	89 e5                	mov    %esp,%ebp
+  8007bd:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8007c0:	83 f8 1f             	cmp    $0x1f,%eax
+  8007c3:	77 30                	ja     8007f5 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8007c5:	c1 e0 0c             	shl    $0xc,%eax
+  8007c8:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8007cd:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8007d3:	f6 c2 01             	test   $0x1,%dl
+  8007d6:	74 24                	je     8007fc <fd_lookup+0x42>
+  8007d8:	89 c2                	mov    %eax,%edx
+  8007da:	c1 ea 0c             	shr    $0xc,%edx
+  8007dd:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8007e4:	f6 c2 01             	test   $0x1,%dl
+  8007e7:	74 1a                	je     800803 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8007e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007ec:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8007ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007f3:	5d                   	pop    %ebp
+  8007f4:	c3                   	ret
+		return -E_INVAL;
+  8007f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007fa:	eb f7                	jmp    8007f3 <fd_lookup+0x39>
+		return -E_INVAL;
+  8007fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800801:	eb f0                	jmp    8007f3 <fd_lookup+0x39>
+  800803:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800808:	eb e9                	jmp    8007f3 <fd_lookup+0x39>
+
+0080080a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80080a:	55                   	push   %ebp
+  80080b:	89 e5                	mov    %esp,%ebp
+  80080d:	53                   	push   %ebx
+  80080e:	83 ec 04             	sub    $0x4,%esp
+  800811:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800814:	b8 60 27 80 00       	mov    $0x802760,%eax
+  800819:	8b 18                	mov    (%eax),%ebx
+  80081b:	85 db                	test   %ebx,%ebx
+  80081d:	74 0e                	je     80082d <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  80081f:	83 c0 04             	add    $0x4,%eax
+  800822:	39 13                	cmp    %edx,(%ebx)
+  800824:	75 f3                	jne    800819 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  800826:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082b:	eb 1f                	jmp    80084c <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80082d:	a1 08 40 80 00       	mov    0x804008,%eax
+  800832:	8b 40 48             	mov    0x48(%eax),%eax
+  800835:	83 ec 04             	sub    $0x4,%esp
+  800838:	52                   	push   %edx
+  800839:	50                   	push   %eax
+  80083a:	68 e4 26 80 00       	push   $0x8026e4
+  80083f:	e8 b6 0f 00 00       	call   8017fa <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800844:	83 c4 10             	add    $0x10,%esp
+  800847:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80084c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80084f:	89 1a                	mov    %ebx,(%edx)
+}
+  800851:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800854:	c9                   	leave
+  800855:	c3                   	ret
+
+00800856 <fd_close>:
+{
+  800856:	55                   	push   %ebp
+  800857:	89 e5                	mov    %esp,%ebp
+  800859:	57                   	push   %edi
+  80085a:	56                   	push   %esi
+  80085b:	53                   	push   %ebx
+  80085c:	83 ec 24             	sub    $0x24,%esp
+  80085f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800862:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800865:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800868:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800869:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80086f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800872:	50                   	push   %eax
+  800873:	e8 42 ff ff ff       	call   8007ba <fd_lookup>
+  800878:	89 c3                	mov    %eax,%ebx
+  80087a:	83 c4 10             	add    $0x10,%esp
+  80087d:	85 c0                	test   %eax,%eax
+  80087f:	78 05                	js     800886 <fd_close+0x30>
+	    || fd != fd2)
+  800881:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800884:	74 16                	je     80089c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800886:	89 f8                	mov    %edi,%eax
+  800888:	84 c0                	test   %al,%al
+  80088a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800892:	89 d8                	mov    %ebx,%eax
+  800894:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800897:	5b                   	pop    %ebx
+  800898:	5e                   	pop    %esi
+  800899:	5f                   	pop    %edi
+  80089a:	5d                   	pop    %ebp
+  80089b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80089c:	83 ec 08             	sub    $0x8,%esp
+  80089f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8008a2:	50                   	push   %eax
+  8008a3:	ff 36                	push   (%esi)
+  8008a5:	e8 60 ff ff ff       	call   80080a <dev_lookup>
+  8008aa:	89 c3                	mov    %eax,%ebx
+  8008ac:	83 c4 10             	add    $0x10,%esp
+  8008af:	85 c0                	test   %eax,%eax
+  8008b1:	78 1a                	js     8008cd <fd_close+0x77>
+		if (dev->dev_close)
+  8008b3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008b6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8008b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8008be:	85 c0                	test   %eax,%eax
+  8008c0:	74 0b                	je     8008cd <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8008c2:	83 ec 0c             	sub    $0xc,%esp
+  8008c5:	56                   	push   %esi
+  8008c6:	ff d0                	call   *%eax
+  8008c8:	89 c3                	mov    %eax,%ebx
+  8008ca:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8008cd:	83 ec 08             	sub    $0x8,%esp
+  8008d0:	56                   	push   %esi
+  8008d1:	6a 00                	push   $0x0
+  8008d3:	e8 51 f9 ff ff       	call   800229 <sys_page_unmap>
+	return r;
+  8008d8:	83 c4 10             	add    $0x10,%esp
+  8008db:	eb b5                	jmp    800892 <fd_close+0x3c>
+
+008008dd <close>:
+
+int
+close(int fdnum)
+{
+  8008dd:	55                   	push   %ebp
+  8008de:	89 e5                	mov    %esp,%ebp
+  8008e0:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8008e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008e6:	50                   	push   %eax
+  8008e7:	ff 75 08             	push   0x8(%ebp)
+  8008ea:	e8 cb fe ff ff       	call   8007ba <fd_lookup>
+  8008ef:	83 c4 10             	add    $0x10,%esp
+  8008f2:	85 c0                	test   %eax,%eax
+  8008f4:	79 02                	jns    8008f8 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8008f6:	c9                   	leave
+  8008f7:	c3                   	ret
+		return fd_close(fd, 1);
+  8008f8:	83 ec 08             	sub    $0x8,%esp
+  8008fb:	6a 01                	push   $0x1
+  8008fd:	ff 75 f4             	push   -0xc(%ebp)
+  800900:	e8 51 ff ff ff       	call   800856 <fd_close>
+  800905:	83 c4 10             	add    $0x10,%esp
+  800908:	eb ec                	jmp    8008f6 <close+0x19>
+
+0080090a <close_all>:
+
+void
+close_all(void)
+{
+  80090a:	55                   	push   %ebp
+  80090b:	89 e5                	mov    %esp,%ebp
+  80090d:	53                   	push   %ebx
+  80090e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800911:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800916:	83 ec 0c             	sub    $0xc,%esp
+  800919:	53                   	push   %ebx
+  80091a:	e8 be ff ff ff       	call   8008dd <close>
+	for (i = 0; i < MAXFD; i++)
+  80091f:	83 c3 01             	add    $0x1,%ebx
+  800922:	83 c4 10             	add    $0x10,%esp
+  800925:	83 fb 20             	cmp    $0x20,%ebx
+  800928:	75 ec                	jne    800916 <close_all+0xc>
+}
+  80092a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80092d:	c9                   	leave
+  80092e:	c3                   	ret
+
+0080092f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80092f:	55                   	push   %ebp
+  800930:	89 e5                	mov    %esp,%ebp
+  800932:	57                   	push   %edi
+  800933:	56                   	push   %esi
+  800934:	53                   	push   %ebx
+  800935:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800938:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80093b:	50                   	push   %eax
+  80093c:	ff 75 08             	push   0x8(%ebp)
+  80093f:	e8 76 fe ff ff       	call   8007ba <fd_lookup>
+  800944:	89 c3                	mov    %eax,%ebx
+  800946:	83 c4 10             	add    $0x10,%esp
+  800949:	85 c0                	test   %eax,%eax
+  80094b:	78 7f                	js     8009cc <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80094d:	83 ec 0c             	sub    $0xc,%esp
+  800950:	ff 75 0c             	push   0xc(%ebp)
+  800953:	e8 85 ff ff ff       	call   8008dd <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800958:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80095b:	c1 e6 0c             	shl    $0xc,%esi
+  80095e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800964:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800967:	89 3c 24             	mov    %edi,(%esp)
+  80096a:	e8 e0 fd ff ff       	call   80074f <fd2data>
+  80096f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800971:	89 34 24             	mov    %esi,(%esp)
+  800974:	e8 d6 fd ff ff       	call   80074f <fd2data>
+  800979:	83 c4 10             	add    $0x10,%esp
+  80097c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80097f:	89 d8                	mov    %ebx,%eax
+  800981:	c1 e8 16             	shr    $0x16,%eax
+  800984:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80098b:	a8 01                	test   $0x1,%al
+  80098d:	74 11                	je     8009a0 <dup+0x71>
+  80098f:	89 d8                	mov    %ebx,%eax
+  800991:	c1 e8 0c             	shr    $0xc,%eax
+  800994:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80099b:	f6 c2 01             	test   $0x1,%dl
+  80099e:	75 36                	jne    8009d6 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8009a0:	89 f8                	mov    %edi,%eax
+  8009a2:	c1 e8 0c             	shr    $0xc,%eax
+  8009a5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8009ac:	83 ec 0c             	sub    $0xc,%esp
+  8009af:	25 07 0e 00 00       	and    $0xe07,%eax
+  8009b4:	50                   	push   %eax
+  8009b5:	56                   	push   %esi
+  8009b6:	6a 00                	push   $0x0
+  8009b8:	57                   	push   %edi
+  8009b9:	6a 00                	push   $0x0
+  8009bb:	e8 27 f8 ff ff       	call   8001e7 <sys_page_map>
+  8009c0:	89 c3                	mov    %eax,%ebx
+  8009c2:	83 c4 20             	add    $0x20,%esp
+  8009c5:	85 c0                	test   %eax,%eax
+  8009c7:	78 33                	js     8009fc <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8009c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8009cc:	89 d8                	mov    %ebx,%eax
+  8009ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009d1:	5b                   	pop    %ebx
+  8009d2:	5e                   	pop    %esi
+  8009d3:	5f                   	pop    %edi
+  8009d4:	5d                   	pop    %ebp
+  8009d5:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8009d6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8009dd:	83 ec 0c             	sub    $0xc,%esp
+  8009e0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8009e5:	50                   	push   %eax
+  8009e6:	ff 75 d4             	push   -0x2c(%ebp)
+  8009e9:	6a 00                	push   $0x0
+  8009eb:	53                   	push   %ebx
+  8009ec:	6a 00                	push   $0x0
+  8009ee:	e8 f4 f7 ff ff       	call   8001e7 <sys_page_map>
+  8009f3:	89 c3                	mov    %eax,%ebx
+  8009f5:	83 c4 20             	add    $0x20,%esp
+  8009f8:	85 c0                	test   %eax,%eax
+  8009fa:	79 a4                	jns    8009a0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8009fc:	83 ec 08             	sub    $0x8,%esp
+  8009ff:	56                   	push   %esi
+  800a00:	6a 00                	push   $0x0
+  800a02:	e8 22 f8 ff ff       	call   800229 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800a07:	83 c4 08             	add    $0x8,%esp
+  800a0a:	ff 75 d4             	push   -0x2c(%ebp)
+  800a0d:	6a 00                	push   $0x0
+  800a0f:	e8 15 f8 ff ff       	call   800229 <sys_page_unmap>
+	return r;
+  800a14:	83 c4 10             	add    $0x10,%esp
+  800a17:	eb b3                	jmp    8009cc <dup+0x9d>
+
+00800a19 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800a19:	55                   	push   %ebp
+  800a1a:	89 e5                	mov    %esp,%ebp
+  800a1c:	56                   	push   %esi
+  800a1d:	53                   	push   %ebx
+  800a1e:	83 ec 18             	sub    $0x18,%esp
+  800a21:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a24:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a27:	50                   	push   %eax
+  800a28:	56                   	push   %esi
+  800a29:	e8 8c fd ff ff       	call   8007ba <fd_lookup>
+  800a2e:	83 c4 10             	add    $0x10,%esp
+  800a31:	85 c0                	test   %eax,%eax
+  800a33:	78 3c                	js     800a71 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a35:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a38:	83 ec 08             	sub    $0x8,%esp
+  800a3b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a3e:	50                   	push   %eax
+  800a3f:	ff 33                	push   (%ebx)
+  800a41:	e8 c4 fd ff ff       	call   80080a <dev_lookup>
+  800a46:	83 c4 10             	add    $0x10,%esp
+  800a49:	85 c0                	test   %eax,%eax
+  800a4b:	78 24                	js     800a71 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a4d:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a50:	83 e0 03             	and    $0x3,%eax
+  800a53:	83 f8 01             	cmp    $0x1,%eax
+  800a56:	74 20                	je     800a78 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800a58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a5b:	8b 40 08             	mov    0x8(%eax),%eax
+  800a5e:	85 c0                	test   %eax,%eax
+  800a60:	74 37                	je     800a99 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800a62:	83 ec 04             	sub    $0x4,%esp
+  800a65:	ff 75 10             	push   0x10(%ebp)
+  800a68:	ff 75 0c             	push   0xc(%ebp)
+  800a6b:	53                   	push   %ebx
+  800a6c:	ff d0                	call   *%eax
+  800a6e:	83 c4 10             	add    $0x10,%esp
+}
+  800a71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a74:	5b                   	pop    %ebx
+  800a75:	5e                   	pop    %esi
+  800a76:	5d                   	pop    %ebp
+  800a77:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a78:	a1 08 40 80 00       	mov    0x804008,%eax
+  800a7d:	8b 40 48             	mov    0x48(%eax),%eax
+  800a80:	83 ec 04             	sub    $0x4,%esp
+  800a83:	56                   	push   %esi
+  800a84:	50                   	push   %eax
+  800a85:	68 25 27 80 00       	push   $0x802725
+  800a8a:	e8 6b 0d 00 00       	call   8017fa <cprintf>
+		return -E_INVAL;
+  800a8f:	83 c4 10             	add    $0x10,%esp
+  800a92:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a97:	eb d8                	jmp    800a71 <read+0x58>
+		return -E_NOT_SUPP;
+  800a99:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a9e:	eb d1                	jmp    800a71 <read+0x58>
+
+00800aa0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800aa0:	55                   	push   %ebp
+  800aa1:	89 e5                	mov    %esp,%ebp
+  800aa3:	57                   	push   %edi
+  800aa4:	56                   	push   %esi
+  800aa5:	53                   	push   %ebx
+  800aa6:	83 ec 0c             	sub    $0xc,%esp
+  800aa9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800aac:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800aaf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ab4:	eb 02                	jmp    800ab8 <readn+0x18>
+  800ab6:	01 c3                	add    %eax,%ebx
+  800ab8:	39 f3                	cmp    %esi,%ebx
+  800aba:	73 21                	jae    800add <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800abc:	83 ec 04             	sub    $0x4,%esp
+  800abf:	89 f0                	mov    %esi,%eax
+  800ac1:	29 d8                	sub    %ebx,%eax
+  800ac3:	50                   	push   %eax
+  800ac4:	89 d8                	mov    %ebx,%eax
+  800ac6:	03 45 0c             	add    0xc(%ebp),%eax
+  800ac9:	50                   	push   %eax
+  800aca:	57                   	push   %edi
+  800acb:	e8 49 ff ff ff       	call   800a19 <read>
+		if (m < 0)
+  800ad0:	83 c4 10             	add    $0x10,%esp
+  800ad3:	85 c0                	test   %eax,%eax
+  800ad5:	78 04                	js     800adb <readn+0x3b>
+			return m;
+		if (m == 0)
+  800ad7:	75 dd                	jne    800ab6 <readn+0x16>
+  800ad9:	eb 02                	jmp    800add <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800adb:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800add:	89 d8                	mov    %ebx,%eax
+  800adf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ae2:	5b                   	pop    %ebx
+  800ae3:	5e                   	pop    %esi
+  800ae4:	5f                   	pop    %edi
+  800ae5:	5d                   	pop    %ebp
+  800ae6:	c3                   	ret
+
+00800ae7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800ae7:	55                   	push   %ebp
+  800ae8:	89 e5                	mov    %esp,%ebp
+  800aea:	56                   	push   %esi
+  800aeb:	53                   	push   %ebx
+  800aec:	83 ec 18             	sub    $0x18,%esp
+  800aef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800af2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800af5:	50                   	push   %eax
+  800af6:	53                   	push   %ebx
+  800af7:	e8 be fc ff ff       	call   8007ba <fd_lookup>
+  800afc:	83 c4 10             	add    $0x10,%esp
+  800aff:	85 c0                	test   %eax,%eax
+  800b01:	78 37                	js     800b3a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b03:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b06:	83 ec 08             	sub    $0x8,%esp
+  800b09:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b0c:	50                   	push   %eax
+  800b0d:	ff 36                	push   (%esi)
+  800b0f:	e8 f6 fc ff ff       	call   80080a <dev_lookup>
+  800b14:	83 c4 10             	add    $0x10,%esp
+  800b17:	85 c0                	test   %eax,%eax
+  800b19:	78 1f                	js     800b3a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b1b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b1f:	74 20                	je     800b41 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800b21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b24:	8b 40 0c             	mov    0xc(%eax),%eax
+  800b27:	85 c0                	test   %eax,%eax
+  800b29:	74 37                	je     800b62 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800b2b:	83 ec 04             	sub    $0x4,%esp
+  800b2e:	ff 75 10             	push   0x10(%ebp)
+  800b31:	ff 75 0c             	push   0xc(%ebp)
+  800b34:	56                   	push   %esi
+  800b35:	ff d0                	call   *%eax
+  800b37:	83 c4 10             	add    $0x10,%esp
+}
+  800b3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b3d:	5b                   	pop    %ebx
+  800b3e:	5e                   	pop    %esi
+  800b3f:	5d                   	pop    %ebp
+  800b40:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b41:	a1 08 40 80 00       	mov    0x804008,%eax
+  800b46:	8b 40 48             	mov    0x48(%eax),%eax
+  800b49:	83 ec 04             	sub    $0x4,%esp
+  800b4c:	53                   	push   %ebx
+  800b4d:	50                   	push   %eax
+  800b4e:	68 41 27 80 00       	push   $0x802741
+  800b53:	e8 a2 0c 00 00       	call   8017fa <cprintf>
+		return -E_INVAL;
+  800b58:	83 c4 10             	add    $0x10,%esp
+  800b5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b60:	eb d8                	jmp    800b3a <write+0x53>
+		return -E_NOT_SUPP;
+  800b62:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b67:	eb d1                	jmp    800b3a <write+0x53>
+
+00800b69 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b69:	55                   	push   %ebp
+  800b6a:	89 e5                	mov    %esp,%ebp
+  800b6c:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b6f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b72:	50                   	push   %eax
+  800b73:	ff 75 08             	push   0x8(%ebp)
+  800b76:	e8 3f fc ff ff       	call   8007ba <fd_lookup>
+  800b7b:	83 c4 10             	add    $0x10,%esp
+  800b7e:	85 c0                	test   %eax,%eax
+  800b80:	78 0e                	js     800b90 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b82:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b88:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800b8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b90:	c9                   	leave
+  800b91:	c3                   	ret
+
+00800b92 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b92:	55                   	push   %ebp
+  800b93:	89 e5                	mov    %esp,%ebp
+  800b95:	56                   	push   %esi
+  800b96:	53                   	push   %ebx
+  800b97:	83 ec 18             	sub    $0x18,%esp
+  800b9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b9d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ba0:	50                   	push   %eax
+  800ba1:	53                   	push   %ebx
+  800ba2:	e8 13 fc ff ff       	call   8007ba <fd_lookup>
+  800ba7:	83 c4 10             	add    $0x10,%esp
+  800baa:	85 c0                	test   %eax,%eax
+  800bac:	78 34                	js     800be2 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800bae:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800bb1:	83 ec 08             	sub    $0x8,%esp
+  800bb4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bb7:	50                   	push   %eax
+  800bb8:	ff 36                	push   (%esi)
+  800bba:	e8 4b fc ff ff       	call   80080a <dev_lookup>
+  800bbf:	83 c4 10             	add    $0x10,%esp
+  800bc2:	85 c0                	test   %eax,%eax
+  800bc4:	78 1c                	js     800be2 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bc6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800bca:	74 1d                	je     800be9 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800bcc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bcf:	8b 40 18             	mov    0x18(%eax),%eax
+  800bd2:	85 c0                	test   %eax,%eax
+  800bd4:	74 34                	je     800c0a <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800bd6:	83 ec 08             	sub    $0x8,%esp
+  800bd9:	ff 75 0c             	push   0xc(%ebp)
+  800bdc:	56                   	push   %esi
+  800bdd:	ff d0                	call   *%eax
+  800bdf:	83 c4 10             	add    $0x10,%esp
+}
+  800be2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800be5:	5b                   	pop    %ebx
+  800be6:	5e                   	pop    %esi
+  800be7:	5d                   	pop    %ebp
+  800be8:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800be9:	a1 08 40 80 00       	mov    0x804008,%eax
+  800bee:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800bf1:	83 ec 04             	sub    $0x4,%esp
+  800bf4:	53                   	push   %ebx
+  800bf5:	50                   	push   %eax
+  800bf6:	68 04 27 80 00       	push   $0x802704
+  800bfb:	e8 fa 0b 00 00       	call   8017fa <cprintf>
+		return -E_INVAL;
+  800c00:	83 c4 10             	add    $0x10,%esp
+  800c03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c08:	eb d8                	jmp    800be2 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800c0a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c0f:	eb d1                	jmp    800be2 <ftruncate+0x50>
+
+00800c11 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800c11:	55                   	push   %ebp
+  800c12:	89 e5                	mov    %esp,%ebp
+  800c14:	56                   	push   %esi
+  800c15:	53                   	push   %ebx
+  800c16:	83 ec 18             	sub    $0x18,%esp
+  800c19:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c1c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c1f:	50                   	push   %eax
+  800c20:	ff 75 08             	push   0x8(%ebp)
+  800c23:	e8 92 fb ff ff       	call   8007ba <fd_lookup>
+  800c28:	83 c4 10             	add    $0x10,%esp
+  800c2b:	85 c0                	test   %eax,%eax
+  800c2d:	78 49                	js     800c78 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c2f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c32:	83 ec 08             	sub    $0x8,%esp
+  800c35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c38:	50                   	push   %eax
+  800c39:	ff 36                	push   (%esi)
+  800c3b:	e8 ca fb ff ff       	call   80080a <dev_lookup>
+  800c40:	83 c4 10             	add    $0x10,%esp
+  800c43:	85 c0                	test   %eax,%eax
+  800c45:	78 31                	js     800c78 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c4a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c4e:	74 2f                	je     800c7f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c50:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c53:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c5a:	00 00 00 
+	stat->st_isdir = 0;
+  800c5d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c64:	00 00 00 
+	stat->st_dev = dev;
+  800c67:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c6d:	83 ec 08             	sub    $0x8,%esp
+  800c70:	53                   	push   %ebx
+  800c71:	56                   	push   %esi
+  800c72:	ff 50 14             	call   *0x14(%eax)
+  800c75:	83 c4 10             	add    $0x10,%esp
+}
+  800c78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c7b:	5b                   	pop    %ebx
+  800c7c:	5e                   	pop    %esi
+  800c7d:	5d                   	pop    %ebp
+  800c7e:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c7f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c84:	eb f2                	jmp    800c78 <fstat+0x67>
+
+00800c86 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c86:	55                   	push   %ebp
+  800c87:	89 e5                	mov    %esp,%ebp
+  800c89:	56                   	push   %esi
+  800c8a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c8b:	83 ec 08             	sub    $0x8,%esp
+  800c8e:	6a 00                	push   $0x0
+  800c90:	ff 75 08             	push   0x8(%ebp)
+  800c93:	e8 bc 02 00 00       	call   800f54 <open>
+  800c98:	89 c3                	mov    %eax,%ebx
+  800c9a:	83 c4 10             	add    $0x10,%esp
+  800c9d:	85 c0                	test   %eax,%eax
+  800c9f:	78 1b                	js     800cbc <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800ca1:	83 ec 08             	sub    $0x8,%esp
+  800ca4:	ff 75 0c             	push   0xc(%ebp)
+  800ca7:	50                   	push   %eax
+  800ca8:	e8 64 ff ff ff       	call   800c11 <fstat>
+  800cad:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800caf:	89 1c 24             	mov    %ebx,(%esp)
+  800cb2:	e8 26 fc ff ff       	call   8008dd <close>
+	return r;
+  800cb7:	83 c4 10             	add    $0x10,%esp
+  800cba:	89 f3                	mov    %esi,%ebx
+}
+  800cbc:	89 d8                	mov    %ebx,%eax
+  800cbe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cc1:	5b                   	pop    %ebx
+  800cc2:	5e                   	pop    %esi
+  800cc3:	5d                   	pop    %ebp
+  800cc4:	c3                   	ret
+
+00800cc5 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  800cc5:	55                   	push   %ebp
+  800cc6:	89 e5                	mov    %esp,%ebp
+  800cc8:	57                   	push   %edi
+  800cc9:	56                   	push   %esi
+  800cca:	53                   	push   %ebx
+  800ccb:	83 ec 0c             	sub    $0xc,%esp
+  800cce:	89 c7                	mov    %eax,%edi
+  800cd0:	89 d3                	mov    %edx,%ebx
+  800cd2:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800cd4:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800cdb:	74 2d                	je     800d0a <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cdd:	6a 07                	push   $0x7
+  800cdf:	68 00 50 80 00       	push   $0x805000
+  800ce4:	57                   	push   %edi
+  800ce5:	ff 35 00 40 80 00    	push   0x804000
+  800ceb:	e8 3f 16 00 00       	call   80232f <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  800cf0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800cf7:	6a 00                	push   $0x0
+  800cf9:	56                   	push   %esi
+  800cfa:	53                   	push   %ebx
+  800cfb:	6a 00                	push   $0x0
+  800cfd:	e8 df 14 00 00       	call   8021e1 <ipc_recv_pages>
+}
+  800d02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d05:	5b                   	pop    %ebx
+  800d06:	5e                   	pop    %esi
+  800d07:	5f                   	pop    %edi
+  800d08:	5d                   	pop    %ebp
+  800d09:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800d0a:	83 ec 0c             	sub    $0xc,%esp
+  800d0d:	6a 01                	push   $0x1
+  800d0f:	e8 10 17 00 00       	call   802424 <ipc_find_env>
+  800d14:	a3 00 40 80 00       	mov    %eax,0x804000
+  800d19:	83 c4 10             	add    $0x10,%esp
+  800d1c:	eb bf                	jmp    800cdd <fsipc_pages+0x18>
+
+00800d1e <fsipc>:
+{
+  800d1e:	55                   	push   %ebp
+  800d1f:	89 e5                	mov    %esp,%ebp
+  800d21:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  800d24:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d29:	e8 97 ff ff ff       	call   800cc5 <fsipc_pages>
+}
+  800d2e:	c9                   	leave
+  800d2f:	c3                   	ret
+
+00800d30 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d30:	55                   	push   %ebp
+  800d31:	89 e5                	mov    %esp,%ebp
+  800d33:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d36:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d39:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d3c:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800d41:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d44:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800d49:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d53:	e8 c6 ff ff ff       	call   800d1e <fsipc>
+}
+  800d58:	c9                   	leave
+  800d59:	c3                   	ret
+
+00800d5a <devfile_flush>:
+{
+  800d5a:	55                   	push   %ebp
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d60:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d63:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d66:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800d6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d70:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d75:	e8 a4 ff ff ff       	call   800d1e <fsipc>
+}
+  800d7a:	c9                   	leave
+  800d7b:	c3                   	ret
+
+00800d7c <devfile_stat>:
+{
+  800d7c:	55                   	push   %ebp
+  800d7d:	89 e5                	mov    %esp,%ebp
+  800d7f:	53                   	push   %ebx
+  800d80:	83 ec 04             	sub    $0x4,%esp
+  800d83:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d86:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d89:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d8c:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800d91:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d96:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d9b:	e8 7e ff ff ff       	call   800d1e <fsipc>
+  800da0:	85 c0                	test   %eax,%eax
+  800da2:	78 2c                	js     800dd0 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800da4:	83 ec 08             	sub    $0x8,%esp
+  800da7:	68 00 50 80 00       	push   $0x805000
+  800dac:	53                   	push   %ebx
+  800dad:	e8 2f 10 00 00       	call   801de1 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800db2:	a1 80 50 80 00       	mov    0x805080,%eax
+  800db7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800dbd:	a1 84 50 80 00       	mov    0x805084,%eax
+  800dc2:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800dc8:	83 c4 10             	add    $0x10,%esp
+  800dcb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dd0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dd3:	c9                   	leave
+  800dd4:	c3                   	ret
+
+00800dd5 <devfile_write>:
+{
+  800dd5:	55                   	push   %ebp
+  800dd6:	89 e5                	mov    %esp,%ebp
+  800dd8:	83 ec 0c             	sub    $0xc,%esp
+  800ddb:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800dde:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800de3:	39 d0                	cmp    %edx,%eax
+  800de5:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800de8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800deb:	8b 52 0c             	mov    0xc(%edx),%edx
+  800dee:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  800df4:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800df9:	50                   	push   %eax
+  800dfa:	ff 75 0c             	push   0xc(%ebp)
+  800dfd:	68 08 50 80 00       	push   $0x805008
+  800e02:	e8 60 11 00 00       	call   801f67 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800e07:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e0c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e11:	e8 08 ff ff ff       	call   800d1e <fsipc>
+}
+  800e16:	c9                   	leave
+  800e17:	c3                   	ret
+
+00800e18 <devfile_read>:
+{
+  800e18:	55                   	push   %ebp
+  800e19:	89 e5                	mov    %esp,%ebp
+  800e1b:	57                   	push   %edi
+  800e1c:	56                   	push   %esi
+  800e1d:	53                   	push   %ebx
+  800e1e:	83 ec 1c             	sub    $0x1c,%esp
+  800e21:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e24:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e27:	89 fe                	mov    %edi,%esi
+  800e29:	c1 ee 0c             	shr    $0xc,%esi
+  800e2c:	b8 20 00 00 00       	mov    $0x20,%eax
+  800e31:	39 c6                	cmp    %eax,%esi
+  800e33:	0f 47 f0             	cmova  %eax,%esi
+  800e36:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e3e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  800e41:	eb 14                	jmp    800e57 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e43:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  800e4a:	05 00 10 00 00       	add    $0x1000,%eax
+  800e4f:	f6 c6 06             	test   $0x6,%dh
+  800e52:	75 42                	jne    800e96 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e54:	83 c1 01             	add    $0x1,%ecx
+  800e57:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800e5a:	39 f1                	cmp    %esi,%ecx
+  800e5c:	0f 84 95 00 00 00    	je     800ef7 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e62:	89 c2                	mov    %eax,%edx
+  800e64:	c1 ea 16             	shr    $0x16,%edx
+  800e67:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e6e:	f6 c2 01             	test   $0x1,%dl
+  800e71:	74 23                	je     800e96 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e73:	89 c2                	mov    %eax,%edx
+  800e75:	c1 ea 0c             	shr    $0xc,%edx
+  800e78:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800e7f:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  800e85:	74 0f                	je     800e96 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  800e87:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800e8e:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  800e94:	75 ad                	jne    800e43 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  800e96:	85 c9                	test   %ecx,%ecx
+  800e98:	74 11                	je     800eab <devfile_read+0x93>
+  800e9a:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  800ea1:	75 08                	jne    800eab <devfile_read+0x93>
+  800ea3:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  800ea9:	74 50                	je     800efb <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800eab:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800eae:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  800eb3:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800eb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ebe:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ec3:	e8 56 fe ff ff       	call   800d1e <fsipc>
+  800ec8:	89 c6                	mov    %eax,%esi
+  800eca:	85 c0                	test   %eax,%eax
+  800ecc:	78 1f                	js     800eed <devfile_read+0xd5>
+	assert(r <= n);
+  800ece:	39 c7                	cmp    %eax,%edi
+  800ed0:	72 50                	jb     800f22 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  800ed2:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800ed7:	7f 62                	jg     800f3b <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  800ed9:	83 ec 04             	sub    $0x4,%esp
+  800edc:	50                   	push   %eax
+  800edd:	68 00 50 80 00       	push   $0x805000
+  800ee2:	ff 75 0c             	push   0xc(%ebp)
+  800ee5:	e8 7d 10 00 00       	call   801f67 <memmove>
+	return r;
+  800eea:	83 c4 10             	add    $0x10,%esp
+}
+  800eed:	89 f0                	mov    %esi,%eax
+  800eef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef2:	5b                   	pop    %ebx
+  800ef3:	5e                   	pop    %esi
+  800ef4:	5f                   	pop    %edi
+  800ef5:	5d                   	pop    %ebp
+  800ef6:	c3                   	ret
+  800ef7:	89 f1                	mov    %esi,%ecx
+  800ef9:	eb 9b                	jmp    800e96 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  800efb:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800efe:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  800f03:	89 c8                	mov    %ecx,%eax
+  800f05:	c1 e0 0c             	shl    $0xc,%eax
+  800f08:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  800f0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f10:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f15:	e8 ab fd ff ff       	call   800cc5 <fsipc_pages>
+  800f1a:	89 c6                	mov    %eax,%esi
+  800f1c:	85 c0                	test   %eax,%eax
+  800f1e:	78 8b                	js     800eab <devfile_read+0x93>
+  800f20:	eb cb                	jmp    800eed <devfile_read+0xd5>
+	assert(r <= n);
+  800f22:	68 70 27 80 00       	push   $0x802770
+  800f27:	68 77 27 80 00       	push   $0x802777
+  800f2c:	68 a0 00 00 00       	push   $0xa0
+  800f31:	68 8c 27 80 00       	push   $0x80278c
+  800f36:	e8 e4 07 00 00       	call   80171f <_panic>
+	assert(r <= PGSIZE);
+  800f3b:	68 97 27 80 00       	push   $0x802797
+  800f40:	68 77 27 80 00       	push   $0x802777
+  800f45:	68 a1 00 00 00       	push   $0xa1
+  800f4a:	68 8c 27 80 00       	push   $0x80278c
+  800f4f:	e8 cb 07 00 00       	call   80171f <_panic>
+
+00800f54 <open>:
+{
+  800f54:	55                   	push   %ebp
+  800f55:	89 e5                	mov    %esp,%ebp
+  800f57:	56                   	push   %esi
+  800f58:	53                   	push   %ebx
+  800f59:	83 ec 1c             	sub    $0x1c,%esp
+  800f5c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800f5f:	56                   	push   %esi
+  800f60:	e8 41 0e 00 00       	call   801da6 <strlen>
+  800f65:	83 c4 10             	add    $0x10,%esp
+  800f68:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f6d:	7f 6c                	jg     800fdb <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800f6f:	83 ec 0c             	sub    $0xc,%esp
+  800f72:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f75:	50                   	push   %eax
+  800f76:	e8 eb f7 ff ff       	call   800766 <fd_alloc>
+  800f7b:	89 c3                	mov    %eax,%ebx
+  800f7d:	83 c4 10             	add    $0x10,%esp
+  800f80:	85 c0                	test   %eax,%eax
+  800f82:	78 3c                	js     800fc0 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800f84:	83 ec 08             	sub    $0x8,%esp
+  800f87:	56                   	push   %esi
+  800f88:	68 00 50 80 00       	push   $0x805000
+  800f8d:	e8 4f 0e 00 00       	call   801de1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800f92:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f95:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800f9a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800f9d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fa2:	e8 77 fd ff ff       	call   800d1e <fsipc>
+  800fa7:	89 c3                	mov    %eax,%ebx
+  800fa9:	83 c4 10             	add    $0x10,%esp
+  800fac:	85 c0                	test   %eax,%eax
+  800fae:	78 19                	js     800fc9 <open+0x75>
+	return fd2num(fd);
+  800fb0:	83 ec 0c             	sub    $0xc,%esp
+  800fb3:	ff 75 f4             	push   -0xc(%ebp)
+  800fb6:	e8 84 f7 ff ff       	call   80073f <fd2num>
+  800fbb:	89 c3                	mov    %eax,%ebx
+  800fbd:	83 c4 10             	add    $0x10,%esp
+}
+  800fc0:	89 d8                	mov    %ebx,%eax
+  800fc2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fc5:	5b                   	pop    %ebx
+  800fc6:	5e                   	pop    %esi
+  800fc7:	5d                   	pop    %ebp
+  800fc8:	c3                   	ret
+		fd_close(fd, 0);
+  800fc9:	83 ec 08             	sub    $0x8,%esp
+  800fcc:	6a 00                	push   $0x0
+  800fce:	ff 75 f4             	push   -0xc(%ebp)
+  800fd1:	e8 80 f8 ff ff       	call   800856 <fd_close>
+		return r;
+  800fd6:	83 c4 10             	add    $0x10,%esp
+  800fd9:	eb e5                	jmp    800fc0 <open+0x6c>
+		return -E_BAD_PATH;
+  800fdb:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800fe0:	eb de                	jmp    800fc0 <open+0x6c>
+
+00800fe2 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800fe2:	55                   	push   %ebp
+  800fe3:	89 e5                	mov    %esp,%ebp
+  800fe5:	53                   	push   %ebx
+  800fe6:	83 ec 10             	sub    $0x10,%esp
+  800fe9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  800fec:	53                   	push   %ebx
+  800fed:	e8 b4 0d 00 00       	call   801da6 <strlen>
+  800ff2:	83 c4 10             	add    $0x10,%esp
+  800ff5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800ffa:	7f 25                	jg     801021 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  800ffc:	83 ec 08             	sub    $0x8,%esp
+  800fff:	53                   	push   %ebx
+  801000:	68 00 50 80 00       	push   $0x805000
+  801005:	e8 d7 0d 00 00       	call   801de1 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80100a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100f:	b8 07 00 00 00       	mov    $0x7,%eax
+  801014:	e8 05 fd ff ff       	call   800d1e <fsipc>
+  801019:	83 c4 10             	add    $0x10,%esp
+}
+  80101c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80101f:	c9                   	leave
+  801020:	c3                   	ret
+		return -E_BAD_PATH;
+  801021:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801026:	eb f4                	jmp    80101c <remove+0x3a>
+
+00801028 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801028:	55                   	push   %ebp
+  801029:	89 e5                	mov    %esp,%ebp
+  80102b:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80102e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801033:	b8 08 00 00 00       	mov    $0x8,%eax
+  801038:	e8 e1 fc ff ff       	call   800d1e <fsipc>
+}
+  80103d:	c9                   	leave
+  80103e:	c3                   	ret
+
+0080103f <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  80103f:	55                   	push   %ebp
+  801040:	89 e5                	mov    %esp,%ebp
+  801042:	53                   	push   %ebx
+  801043:	83 ec 04             	sub    $0x4,%esp
+  801046:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801049:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801053:	e8 c6 fc ff ff       	call   800d1e <fsipc>
+  801058:	85 c0                	test   %eax,%eax
+  80105a:	78 3c                	js     801098 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  80105c:	a1 00 50 80 00       	mov    0x805000,%eax
+  801061:	89 03                	mov    %eax,(%ebx)
+  801063:	a1 04 50 80 00       	mov    0x805004,%eax
+  801068:	89 43 04             	mov    %eax,0x4(%ebx)
+  80106b:	a1 08 50 80 00       	mov    0x805008,%eax
+  801070:	89 43 08             	mov    %eax,0x8(%ebx)
+  801073:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801078:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80107b:	a1 10 50 80 00       	mov    0x805010,%eax
+  801080:	89 43 10             	mov    %eax,0x10(%ebx)
+  801083:	a1 14 50 80 00       	mov    0x805014,%eax
+  801088:	89 43 14             	mov    %eax,0x14(%ebx)
+  80108b:	a1 18 50 80 00       	mov    0x805018,%eax
+  801090:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801093:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801098:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80109b:	c9                   	leave
+  80109c:	c3                   	ret
+
+0080109d <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  80109d:	55                   	push   %ebp
+  80109e:	89 e5                	mov    %esp,%ebp
+  8010a0:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  8010a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010a6:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  8010ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010b5:	e8 64 fc ff ff       	call   800d1e <fsipc>
+}
+  8010ba:	c9                   	leave
+  8010bb:	c3                   	ret
+
+008010bc <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	56                   	push   %esi
+  8010c0:	53                   	push   %ebx
+  8010c1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8010c4:	83 ec 0c             	sub    $0xc,%esp
+  8010c7:	ff 75 08             	push   0x8(%ebp)
+  8010ca:	e8 80 f6 ff ff       	call   80074f <fd2data>
+  8010cf:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8010d1:	83 c4 08             	add    $0x8,%esp
+  8010d4:	68 a3 27 80 00       	push   $0x8027a3
+  8010d9:	53                   	push   %ebx
+  8010da:	e8 02 0d 00 00       	call   801de1 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8010df:	8b 46 04             	mov    0x4(%esi),%eax
+  8010e2:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8010e8:	2b 0e                	sub    (%esi),%ecx
+  8010ea:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8010ef:	89 c8                	mov    %ecx,%eax
+  8010f1:	f7 e2                	mul    %edx
+  8010f3:	c1 ea 0c             	shr    $0xc,%edx
+  8010f6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8010fc:	29 d1                	sub    %edx,%ecx
+  8010fe:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801104:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80110b:	00 00 00 
+	stat->st_dev = &devpipe;
+  80110e:	c7 83 88 00 00 00 24 	movl   $0x803024,0x88(%ebx)
+  801115:	30 80 00 
+	return 0;
+}
+  801118:	b8 00 00 00 00       	mov    $0x0,%eax
+  80111d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801120:	5b                   	pop    %ebx
+  801121:	5e                   	pop    %esi
+  801122:	5d                   	pop    %ebp
+  801123:	c3                   	ret
+
+00801124 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801124:	55                   	push   %ebp
+  801125:	89 e5                	mov    %esp,%ebp
+  801127:	53                   	push   %ebx
+  801128:	83 ec 0c             	sub    $0xc,%esp
+  80112b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80112e:	53                   	push   %ebx
+  80112f:	6a 00                	push   $0x0
+  801131:	e8 f3 f0 ff ff       	call   800229 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801136:	89 1c 24             	mov    %ebx,(%esp)
+  801139:	e8 11 f6 ff ff       	call   80074f <fd2data>
+  80113e:	83 c4 08             	add    $0x8,%esp
+  801141:	50                   	push   %eax
+  801142:	6a 00                	push   $0x0
+  801144:	e8 e0 f0 ff ff       	call   800229 <sys_page_unmap>
+}
+  801149:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80114c:	c9                   	leave
+  80114d:	c3                   	ret
+
+0080114e <_pipeisclosed>:
+{
+  80114e:	55                   	push   %ebp
+  80114f:	89 e5                	mov    %esp,%ebp
+  801151:	57                   	push   %edi
+  801152:	56                   	push   %esi
+  801153:	53                   	push   %ebx
+  801154:	83 ec 1c             	sub    $0x1c,%esp
+  801157:	89 c7                	mov    %eax,%edi
+  801159:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80115b:	a1 08 40 80 00       	mov    0x804008,%eax
+  801160:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801163:	83 ec 0c             	sub    $0xc,%esp
+  801166:	57                   	push   %edi
+  801167:	e8 f7 12 00 00       	call   802463 <pageref>
+  80116c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80116f:	89 34 24             	mov    %esi,(%esp)
+  801172:	e8 ec 12 00 00       	call   802463 <pageref>
+		nn = thisenv->env_runs;
+  801177:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80117d:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801180:	83 c4 10             	add    $0x10,%esp
+  801183:	39 cb                	cmp    %ecx,%ebx
+  801185:	74 1b                	je     8011a2 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801187:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80118a:	75 cf                	jne    80115b <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80118c:	8b 42 58             	mov    0x58(%edx),%eax
+  80118f:	6a 01                	push   $0x1
+  801191:	50                   	push   %eax
+  801192:	53                   	push   %ebx
+  801193:	68 aa 27 80 00       	push   $0x8027aa
+  801198:	e8 5d 06 00 00       	call   8017fa <cprintf>
+  80119d:	83 c4 10             	add    $0x10,%esp
+  8011a0:	eb b9                	jmp    80115b <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8011a2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8011a5:	0f 94 c0             	sete   %al
+  8011a8:	0f b6 c0             	movzbl %al,%eax
+}
+  8011ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ae:	5b                   	pop    %ebx
+  8011af:	5e                   	pop    %esi
+  8011b0:	5f                   	pop    %edi
+  8011b1:	5d                   	pop    %ebp
+  8011b2:	c3                   	ret
+
+008011b3 <devpipe_read>:
+{
+  8011b3:	55                   	push   %ebp
+  8011b4:	89 e5                	mov    %esp,%ebp
+  8011b6:	57                   	push   %edi
+  8011b7:	56                   	push   %esi
+  8011b8:	53                   	push   %ebx
+  8011b9:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8011bc:	ff 75 08             	push   0x8(%ebp)
+  8011bf:	e8 8b f5 ff ff       	call   80074f <fd2data>
+  8011c4:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8011c6:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8011c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8011cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8011cf:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8011d2:	8b 0b                	mov    (%ebx),%ecx
+  8011d4:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8011da:	29 ce                	sub    %ecx,%esi
+  8011dc:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8011e1:	f7 e6                	mul    %esi
+  8011e3:	c1 ea 0c             	shr    $0xc,%edx
+  8011e6:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8011ec:	29 c6                	sub    %eax,%esi
+  8011ee:	89 f2                	mov    %esi,%edx
+  8011f0:	75 43                	jne    801235 <devpipe_read+0x82>
+		ref = pageref(p);
+  8011f2:	83 ec 0c             	sub    $0xc,%esp
+  8011f5:	53                   	push   %ebx
+  8011f6:	e8 68 12 00 00       	call   802463 <pageref>
+  8011fb:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8011fd:	89 da                	mov    %ebx,%edx
+  8011ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801202:	e8 47 ff ff ff       	call   80114e <_pipeisclosed>
+  801207:	83 c4 10             	add    $0x10,%esp
+  80120a:	85 c0                	test   %eax,%eax
+  80120c:	0f 85 c1 00 00 00    	jne    8012d3 <devpipe_read+0x120>
+	*sleeping = 1;
+  801212:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801219:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80121e:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801221:	75 ac                	jne    8011cf <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801223:	83 ec 04             	sub    $0x4,%esp
+  801226:	56                   	push   %esi
+  801227:	57                   	push   %edi
+  801228:	ff 75 e4             	push   -0x1c(%ebp)
+  80122b:	e8 4d f4 ff ff       	call   80067d <sys_futex_wait>
+  801230:	83 c4 10             	add    $0x10,%esp
+  801233:	eb 9a                	jmp    8011cf <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801235:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801238:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  80123c:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80123e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801243:	f7 e1                	mul    %ecx
+  801245:	c1 ea 0b             	shr    $0xb,%edx
+  801248:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80124e:	29 c1                	sub    %eax,%ecx
+  801250:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801252:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801257:	29 cf                	sub    %ecx,%edi
+  801259:	39 f7                	cmp    %esi,%edi
+  80125b:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  80125e:	8d 43 10             	lea    0x10(%ebx),%eax
+  801261:	83 ec 04             	sub    $0x4,%esp
+  801264:	57                   	push   %edi
+  801265:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801268:	01 c2                	add    %eax,%edx
+  80126a:	52                   	push   %edx
+  80126b:	ff 75 0c             	push   0xc(%ebp)
+  80126e:	e8 f4 0c 00 00       	call   801f67 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801273:	83 c4 0c             	add    $0xc,%esp
+  801276:	89 f1                	mov    %esi,%ecx
+  801278:	29 f9                	sub    %edi,%ecx
+  80127a:	51                   	push   %ecx
+  80127b:	ff 75 e4             	push   -0x1c(%ebp)
+  80127e:	89 f8                	mov    %edi,%eax
+  801280:	03 45 0c             	add    0xc(%ebp),%eax
+  801283:	50                   	push   %eax
+  801284:	e8 de 0c 00 00       	call   801f67 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801289:	89 f1                	mov    %esi,%ecx
+  80128b:	03 0b                	add    (%ebx),%ecx
+  80128d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801292:	f7 e1                	mul    %ecx
+  801294:	c1 ea 0c             	shr    $0xc,%edx
+  801297:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80129d:	29 d1                	sub    %edx,%ecx
+  80129f:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  8012a1:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8012a6:	83 c4 10             	add    $0x10,%esp
+  8012a9:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  8012ad:	75 0a                	jne    8012b9 <devpipe_read+0x106>
+	return n;
+  8012af:	89 f0                	mov    %esi,%eax
+}
+  8012b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b4:	5b                   	pop    %ebx
+  8012b5:	5e                   	pop    %esi
+  8012b6:	5f                   	pop    %edi
+  8012b7:	5d                   	pop    %ebp
+  8012b8:	c3                   	ret
+		*sleeping = 0;
+  8012b9:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8012c0:	83 ec 08             	sub    $0x8,%esp
+  8012c3:	68 00 04 00 00       	push   $0x400
+  8012c8:	53                   	push   %ebx
+  8012c9:	e8 ff f3 ff ff       	call   8006cd <sys_futex_wake>
+  8012ce:	83 c4 10             	add    $0x10,%esp
+  8012d1:	eb dc                	jmp    8012af <devpipe_read+0xfc>
+			return 0;
+  8012d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d8:	eb d7                	jmp    8012b1 <devpipe_read+0xfe>
+
+008012da <devpipe_write>:
+{
+  8012da:	55                   	push   %ebp
+  8012db:	89 e5                	mov    %esp,%ebp
+  8012dd:	57                   	push   %edi
+  8012de:	56                   	push   %esi
+  8012df:	53                   	push   %ebx
+  8012e0:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8012e3:	ff 75 08             	push   0x8(%ebp)
+  8012e6:	e8 64 f4 ff ff       	call   80074f <fd2data>
+  8012eb:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8012ed:	83 c4 10             	add    $0x10,%esp
+  8012f0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8012f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8012fa:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8012fd:	0f 83 23 01 00 00    	jae    801426 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801303:	8b 77 04             	mov    0x4(%edi),%esi
+  801306:	8b 1f                	mov    (%edi),%ebx
+  801308:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  80130e:	29 d9                	sub    %ebx,%ecx
+  801310:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801315:	f7 e1                	mul    %ecx
+  801317:	c1 ea 0c             	shr    $0xc,%edx
+  80131a:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801320:	29 c1                	sub    %eax,%ecx
+  801322:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801324:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80132a:	75 40                	jne    80136c <devpipe_write+0x92>
+			ref = pageref(p);
+  80132c:	83 ec 0c             	sub    $0xc,%esp
+  80132f:	57                   	push   %edi
+  801330:	e8 2e 11 00 00       	call   802463 <pageref>
+  801335:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801337:	89 fa                	mov    %edi,%edx
+  801339:	8b 45 08             	mov    0x8(%ebp),%eax
+  80133c:	e8 0d fe ff ff       	call   80114e <_pipeisclosed>
+  801341:	83 c4 10             	add    $0x10,%esp
+  801344:	85 c0                	test   %eax,%eax
+  801346:	0f 85 d5 00 00 00    	jne    801421 <devpipe_write+0x147>
+	*sleeping = 1;
+  80134c:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801353:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801358:	39 1f                	cmp    %ebx,(%edi)
+  80135a:	75 a7                	jne    801303 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  80135c:	83 ec 04             	sub    $0x4,%esp
+  80135f:	56                   	push   %esi
+  801360:	53                   	push   %ebx
+  801361:	57                   	push   %edi
+  801362:	e8 16 f3 ff ff       	call   80067d <sys_futex_wait>
+  801367:	83 c4 10             	add    $0x10,%esp
+  80136a:	eb 97                	jmp    801303 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80136c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80136f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801372:	29 c1                	sub    %eax,%ecx
+  801374:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801379:	89 d8                	mov    %ebx,%eax
+  80137b:	29 d0                	sub    %edx,%eax
+  80137d:	39 c1                	cmp    %eax,%ecx
+  80137f:	0f 46 c1             	cmovbe %ecx,%eax
+  801382:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801384:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801389:	f7 e6                	mul    %esi
+  80138b:	c1 ea 0b             	shr    $0xb,%edx
+  80138e:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801394:	29 c6                	sub    %eax,%esi
+  801396:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801398:	29 f3                	sub    %esi,%ebx
+  80139a:	39 cb                	cmp    %ecx,%ebx
+  80139c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80139f:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  8013a2:	8d 77 10             	lea    0x10(%edi),%esi
+  8013a5:	83 ec 04             	sub    $0x4,%esp
+  8013a8:	53                   	push   %ebx
+  8013a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8013ac:	03 45 0c             	add    0xc(%ebp),%eax
+  8013af:	50                   	push   %eax
+  8013b0:	01 f2                	add    %esi,%edx
+  8013b2:	52                   	push   %edx
+  8013b3:	e8 af 0b 00 00       	call   801f67 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8013b8:	83 c4 0c             	add    $0xc,%esp
+  8013bb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013be:	29 d8                	sub    %ebx,%eax
+  8013c0:	50                   	push   %eax
+  8013c1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8013c4:	01 d3                	add    %edx,%ebx
+  8013c6:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8013c9:	53                   	push   %ebx
+  8013ca:	56                   	push   %esi
+  8013cb:	e8 97 0b 00 00       	call   801f67 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8013d0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8013d3:	03 4f 04             	add    0x4(%edi),%ecx
+  8013d6:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8013db:	f7 e1                	mul    %ecx
+  8013dd:	c1 ea 0c             	shr    $0xc,%edx
+  8013e0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8013e6:	29 d1                	sub    %edx,%ecx
+  8013e8:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8013eb:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8013f0:	83 c4 10             	add    $0x10,%esp
+  8013f3:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8013f7:	75 0b                	jne    801404 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8013f9:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8013fc:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8013ff:	e9 f3 fe ff ff       	jmp    8012f7 <devpipe_write+0x1d>
+		*sleeping = 0;
+  801404:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  80140b:	83 ec 08             	sub    $0x8,%esp
+  80140e:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  801413:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  801416:	50                   	push   %eax
+  801417:	e8 b1 f2 ff ff       	call   8006cd <sys_futex_wake>
+  80141c:	83 c4 10             	add    $0x10,%esp
+  80141f:	eb d8                	jmp    8013f9 <devpipe_write+0x11f>
+				return 0;
+  801421:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801426:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801429:	5b                   	pop    %ebx
+  80142a:	5e                   	pop    %esi
+  80142b:	5f                   	pop    %edi
+  80142c:	5d                   	pop    %ebp
+  80142d:	c3                   	ret
+
+0080142e <pipe>:
+{
+  80142e:	55                   	push   %ebp
+  80142f:	89 e5                	mov    %esp,%ebp
+  801431:	56                   	push   %esi
+  801432:	53                   	push   %ebx
+  801433:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801436:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801439:	50                   	push   %eax
+  80143a:	e8 27 f3 ff ff       	call   800766 <fd_alloc>
+  80143f:	89 c3                	mov    %eax,%ebx
+  801441:	83 c4 10             	add    $0x10,%esp
+  801444:	85 c0                	test   %eax,%eax
+  801446:	0f 88 23 01 00 00    	js     80156f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80144c:	83 ec 04             	sub    $0x4,%esp
+  80144f:	68 07 04 00 00       	push   $0x407
+  801454:	ff 75 f4             	push   -0xc(%ebp)
+  801457:	6a 00                	push   $0x0
+  801459:	e8 46 ed ff ff       	call   8001a4 <sys_page_alloc>
+  80145e:	89 c3                	mov    %eax,%ebx
+  801460:	83 c4 10             	add    $0x10,%esp
+  801463:	85 c0                	test   %eax,%eax
+  801465:	0f 88 04 01 00 00    	js     80156f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80146b:	83 ec 0c             	sub    $0xc,%esp
+  80146e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801471:	50                   	push   %eax
+  801472:	e8 ef f2 ff ff       	call   800766 <fd_alloc>
+  801477:	89 c3                	mov    %eax,%ebx
+  801479:	83 c4 10             	add    $0x10,%esp
+  80147c:	85 c0                	test   %eax,%eax
+  80147e:	0f 88 db 00 00 00    	js     80155f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801484:	83 ec 04             	sub    $0x4,%esp
+  801487:	68 07 04 00 00       	push   $0x407
+  80148c:	ff 75 f0             	push   -0x10(%ebp)
+  80148f:	6a 00                	push   $0x0
+  801491:	e8 0e ed ff ff       	call   8001a4 <sys_page_alloc>
+  801496:	89 c3                	mov    %eax,%ebx
+  801498:	83 c4 10             	add    $0x10,%esp
+  80149b:	85 c0                	test   %eax,%eax
+  80149d:	0f 88 bc 00 00 00    	js     80155f <pipe+0x131>
+	va = fd2data(fd0);
+  8014a3:	83 ec 0c             	sub    $0xc,%esp
+  8014a6:	ff 75 f4             	push   -0xc(%ebp)
+  8014a9:	e8 a1 f2 ff ff       	call   80074f <fd2data>
+  8014ae:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014b0:	83 c4 0c             	add    $0xc,%esp
+  8014b3:	68 07 04 00 00       	push   $0x407
+  8014b8:	50                   	push   %eax
+  8014b9:	6a 00                	push   $0x0
+  8014bb:	e8 e4 ec ff ff       	call   8001a4 <sys_page_alloc>
+  8014c0:	89 c3                	mov    %eax,%ebx
+  8014c2:	83 c4 10             	add    $0x10,%esp
+  8014c5:	85 c0                	test   %eax,%eax
+  8014c7:	0f 88 82 00 00 00    	js     80154f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014cd:	83 ec 0c             	sub    $0xc,%esp
+  8014d0:	ff 75 f0             	push   -0x10(%ebp)
+  8014d3:	e8 77 f2 ff ff       	call   80074f <fd2data>
+  8014d8:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8014df:	50                   	push   %eax
+  8014e0:	6a 00                	push   $0x0
+  8014e2:	56                   	push   %esi
+  8014e3:	6a 00                	push   $0x0
+  8014e5:	e8 fd ec ff ff       	call   8001e7 <sys_page_map>
+  8014ea:	89 c3                	mov    %eax,%ebx
+  8014ec:	83 c4 20             	add    $0x20,%esp
+  8014ef:	85 c0                	test   %eax,%eax
+  8014f1:	78 4e                	js     801541 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8014f3:	a1 24 30 80 00       	mov    0x803024,%eax
+  8014f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014fb:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8014fd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801500:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801507:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80150a:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80150c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80150f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801516:	83 ec 0c             	sub    $0xc,%esp
+  801519:	ff 75 f4             	push   -0xc(%ebp)
+  80151c:	e8 1e f2 ff ff       	call   80073f <fd2num>
+  801521:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801524:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801526:	83 c4 04             	add    $0x4,%esp
+  801529:	ff 75 f0             	push   -0x10(%ebp)
+  80152c:	e8 0e f2 ff ff       	call   80073f <fd2num>
+  801531:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801534:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801537:	83 c4 10             	add    $0x10,%esp
+  80153a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80153f:	eb 2e                	jmp    80156f <pipe+0x141>
+	sys_page_unmap(0, va);
+  801541:	83 ec 08             	sub    $0x8,%esp
+  801544:	56                   	push   %esi
+  801545:	6a 00                	push   $0x0
+  801547:	e8 dd ec ff ff       	call   800229 <sys_page_unmap>
+  80154c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80154f:	83 ec 08             	sub    $0x8,%esp
+  801552:	ff 75 f0             	push   -0x10(%ebp)
+  801555:	6a 00                	push   $0x0
+  801557:	e8 cd ec ff ff       	call   800229 <sys_page_unmap>
+  80155c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80155f:	83 ec 08             	sub    $0x8,%esp
+  801562:	ff 75 f4             	push   -0xc(%ebp)
+  801565:	6a 00                	push   $0x0
+  801567:	e8 bd ec ff ff       	call   800229 <sys_page_unmap>
+  80156c:	83 c4 10             	add    $0x10,%esp
+}
+  80156f:	89 d8                	mov    %ebx,%eax
+  801571:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801574:	5b                   	pop    %ebx
+  801575:	5e                   	pop    %esi
+  801576:	5d                   	pop    %ebp
+  801577:	c3                   	ret
+
+00801578 <pipeisclosed>:
+{
+  801578:	55                   	push   %ebp
+  801579:	89 e5                	mov    %esp,%ebp
+  80157b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80157e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801581:	50                   	push   %eax
+  801582:	ff 75 08             	push   0x8(%ebp)
+  801585:	e8 30 f2 ff ff       	call   8007ba <fd_lookup>
+  80158a:	83 c4 10             	add    $0x10,%esp
+  80158d:	85 c0                	test   %eax,%eax
+  80158f:	78 18                	js     8015a9 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801591:	83 ec 0c             	sub    $0xc,%esp
+  801594:	ff 75 f4             	push   -0xc(%ebp)
+  801597:	e8 b3 f1 ff ff       	call   80074f <fd2data>
+  80159c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80159e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015a1:	e8 a8 fb ff ff       	call   80114e <_pipeisclosed>
+  8015a6:	83 c4 10             	add    $0x10,%esp
+}
+  8015a9:	c9                   	leave
+  8015aa:	c3                   	ret
+
+008015ab <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8015ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b0:	c3                   	ret
+
+008015b1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015b1:	55                   	push   %ebp
+  8015b2:	89 e5                	mov    %esp,%ebp
+  8015b4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8015b7:	68 c2 27 80 00       	push   $0x8027c2
+  8015bc:	ff 75 0c             	push   0xc(%ebp)
+  8015bf:	e8 1d 08 00 00       	call   801de1 <strcpy>
+	return 0;
+}
+  8015c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c9:	c9                   	leave
+  8015ca:	c3                   	ret
+
+008015cb <devcons_write>:
+{
+  8015cb:	55                   	push   %ebp
+  8015cc:	89 e5                	mov    %esp,%ebp
+  8015ce:	57                   	push   %edi
+  8015cf:	56                   	push   %esi
+  8015d0:	53                   	push   %ebx
+  8015d1:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8015d7:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8015dc:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8015e2:	eb 2e                	jmp    801612 <devcons_write+0x47>
+		m = n - tot;
+  8015e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e7:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8015e9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8015ee:	39 c3                	cmp    %eax,%ebx
+  8015f0:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8015f3:	83 ec 04             	sub    $0x4,%esp
+  8015f6:	53                   	push   %ebx
+  8015f7:	89 f0                	mov    %esi,%eax
+  8015f9:	03 45 0c             	add    0xc(%ebp),%eax
+  8015fc:	50                   	push   %eax
+  8015fd:	57                   	push   %edi
+  8015fe:	e8 64 09 00 00       	call   801f67 <memmove>
+		sys_cputs(buf, m);
+  801603:	83 c4 08             	add    $0x8,%esp
+  801606:	53                   	push   %ebx
+  801607:	57                   	push   %edi
+  801608:	e8 ca ea ff ff       	call   8000d7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80160d:	01 de                	add    %ebx,%esi
+  80160f:	83 c4 10             	add    $0x10,%esp
+  801612:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801615:	72 cd                	jb     8015e4 <devcons_write+0x19>
+}
+  801617:	89 f0                	mov    %esi,%eax
+  801619:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80161c:	5b                   	pop    %ebx
+  80161d:	5e                   	pop    %esi
+  80161e:	5f                   	pop    %edi
+  80161f:	5d                   	pop    %ebp
+  801620:	c3                   	ret
+
+00801621 <devcons_read>:
+{
+  801621:	55                   	push   %ebp
+  801622:	89 e5                	mov    %esp,%ebp
+  801624:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801627:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801630:	75 07                	jne    801639 <devcons_read+0x18>
+  801632:	eb 1f                	jmp    801653 <devcons_read+0x32>
+		sys_yield();
+  801634:	e8 4c eb ff ff       	call   800185 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801639:	e8 c8 ea ff ff       	call   800106 <sys_cgetc>
+  80163e:	85 c0                	test   %eax,%eax
+  801640:	74 f2                	je     801634 <devcons_read+0x13>
+	if (c < 0)
+  801642:	78 0f                	js     801653 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801644:	83 f8 04             	cmp    $0x4,%eax
+  801647:	74 0c                	je     801655 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801649:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80164c:	88 02                	mov    %al,(%edx)
+	return 1;
+  80164e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801653:	c9                   	leave
+  801654:	c3                   	ret
+		return 0;
+  801655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165a:	eb f7                	jmp    801653 <devcons_read+0x32>
+
+0080165c <cputchar>:
+{
+  80165c:	55                   	push   %ebp
+  80165d:	89 e5                	mov    %esp,%ebp
+  80165f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801662:	8b 45 08             	mov    0x8(%ebp),%eax
+  801665:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801668:	6a 01                	push   $0x1
+  80166a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80166d:	50                   	push   %eax
+  80166e:	e8 64 ea ff ff       	call   8000d7 <sys_cputs>
+}
+  801673:	83 c4 10             	add    $0x10,%esp
+  801676:	c9                   	leave
+  801677:	c3                   	ret
+
+00801678 <getchar>:
+{
+  801678:	55                   	push   %ebp
+  801679:	89 e5                	mov    %esp,%ebp
+  80167b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80167e:	6a 01                	push   $0x1
+  801680:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801683:	50                   	push   %eax
+  801684:	6a 00                	push   $0x0
+  801686:	e8 8e f3 ff ff       	call   800a19 <read>
+	if (r < 0)
+  80168b:	83 c4 10             	add    $0x10,%esp
+  80168e:	85 c0                	test   %eax,%eax
+  801690:	78 06                	js     801698 <getchar+0x20>
+	if (r < 1)
+  801692:	74 06                	je     80169a <getchar+0x22>
+	return c;
+  801694:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801698:	c9                   	leave
+  801699:	c3                   	ret
+		return -E_EOF;
+  80169a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80169f:	eb f7                	jmp    801698 <getchar+0x20>
+
+008016a1 <iscons>:
+{
+  8016a1:	55                   	push   %ebp
+  8016a2:	89 e5                	mov    %esp,%ebp
+  8016a4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016a7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016aa:	50                   	push   %eax
+  8016ab:	ff 75 08             	push   0x8(%ebp)
+  8016ae:	e8 07 f1 ff ff       	call   8007ba <fd_lookup>
+  8016b3:	83 c4 10             	add    $0x10,%esp
+  8016b6:	85 c0                	test   %eax,%eax
+  8016b8:	78 11                	js     8016cb <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8016ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016bd:	8b 15 40 30 80 00    	mov    0x803040,%edx
+  8016c3:	39 10                	cmp    %edx,(%eax)
+  8016c5:	0f 94 c0             	sete   %al
+  8016c8:	0f b6 c0             	movzbl %al,%eax
+}
+  8016cb:	c9                   	leave
+  8016cc:	c3                   	ret
+
+008016cd <opencons>:
+{
+  8016cd:	55                   	push   %ebp
+  8016ce:	89 e5                	mov    %esp,%ebp
+  8016d0:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8016d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d6:	50                   	push   %eax
+  8016d7:	e8 8a f0 ff ff       	call   800766 <fd_alloc>
+  8016dc:	83 c4 10             	add    $0x10,%esp
+  8016df:	85 c0                	test   %eax,%eax
+  8016e1:	78 3a                	js     80171d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8016e3:	83 ec 04             	sub    $0x4,%esp
+  8016e6:	68 07 04 00 00       	push   $0x407
+  8016eb:	ff 75 f4             	push   -0xc(%ebp)
+  8016ee:	6a 00                	push   $0x0
+  8016f0:	e8 af ea ff ff       	call   8001a4 <sys_page_alloc>
+  8016f5:	83 c4 10             	add    $0x10,%esp
+  8016f8:	85 c0                	test   %eax,%eax
+  8016fa:	78 21                	js     80171d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8016fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ff:	8b 15 40 30 80 00    	mov    0x803040,%edx
+  801705:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801707:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80170a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801711:	83 ec 0c             	sub    $0xc,%esp
+  801714:	50                   	push   %eax
+  801715:	e8 25 f0 ff ff       	call   80073f <fd2num>
+  80171a:	83 c4 10             	add    $0x10,%esp
+}
+  80171d:	c9                   	leave
+  80171e:	c3                   	ret
+
+0080171f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80171f:	55                   	push   %ebp
+  801720:	89 e5                	mov    %esp,%ebp
+  801722:	56                   	push   %esi
+  801723:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801724:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801727:	8b 35 04 30 80 00    	mov    0x803004,%esi
+  80172d:	e8 34 ea ff ff       	call   800166 <sys_getenvid>
+  801732:	83 ec 0c             	sub    $0xc,%esp
+  801735:	ff 75 0c             	push   0xc(%ebp)
+  801738:	ff 75 08             	push   0x8(%ebp)
+  80173b:	56                   	push   %esi
+  80173c:	50                   	push   %eax
+  80173d:	68 d0 27 80 00       	push   $0x8027d0
+  801742:	e8 b3 00 00 00       	call   8017fa <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801747:	83 c4 18             	add    $0x18,%esp
+  80174a:	53                   	push   %ebx
+  80174b:	ff 75 10             	push   0x10(%ebp)
+  80174e:	e8 56 00 00 00       	call   8017a9 <vcprintf>
+	cprintf("\n");
+  801753:	c7 04 24 bb 27 80 00 	movl   $0x8027bb,(%esp)
+  80175a:	e8 9b 00 00 00       	call   8017fa <cprintf>
+  80175f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801762:	cc                   	int3
+	while (1)
+  801763:	eb fd                	jmp    801762 <_panic+0x43>
+
+00801765 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801765:	55                   	push   %ebp
+  801766:	89 e5                	mov    %esp,%ebp
+  801768:	53                   	push   %ebx
+  801769:	83 ec 04             	sub    $0x4,%esp
+  80176c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80176f:	8b 13                	mov    (%ebx),%edx
+  801771:	8d 42 01             	lea    0x1(%edx),%eax
+  801774:	89 03                	mov    %eax,(%ebx)
+  801776:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801779:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80177d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801782:	74 09                	je     80178d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  801784:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801788:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80178b:	c9                   	leave
+  80178c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80178d:	83 ec 08             	sub    $0x8,%esp
+  801790:	68 ff 00 00 00       	push   $0xff
+  801795:	8d 43 08             	lea    0x8(%ebx),%eax
+  801798:	50                   	push   %eax
+  801799:	e8 39 e9 ff ff       	call   8000d7 <sys_cputs>
+		b->idx = 0;
+  80179e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8017a4:	83 c4 10             	add    $0x10,%esp
+  8017a7:	eb db                	jmp    801784 <putch+0x1f>
+
+008017a9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8017a9:	55                   	push   %ebp
+  8017aa:	89 e5                	mov    %esp,%ebp
+  8017ac:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8017b2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017b9:	00 00 00 
+	b.cnt = 0;
+  8017bc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8017c3:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8017c6:	ff 75 0c             	push   0xc(%ebp)
+  8017c9:	ff 75 08             	push   0x8(%ebp)
+  8017cc:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8017d2:	50                   	push   %eax
+  8017d3:	68 65 17 80 00       	push   $0x801765
+  8017d8:	e8 14 01 00 00       	call   8018f1 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8017dd:	83 c4 08             	add    $0x8,%esp
+  8017e0:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8017e6:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8017ec:	50                   	push   %eax
+  8017ed:	e8 e5 e8 ff ff       	call   8000d7 <sys_cputs>
+
+	return b.cnt;
+}
+  8017f2:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8017f8:	c9                   	leave
+  8017f9:	c3                   	ret
+
+008017fa <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8017fa:	55                   	push   %ebp
+  8017fb:	89 e5                	mov    %esp,%ebp
+  8017fd:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801800:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  801803:	50                   	push   %eax
+  801804:	ff 75 08             	push   0x8(%ebp)
+  801807:	e8 9d ff ff ff       	call   8017a9 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80180c:	c9                   	leave
+  80180d:	c3                   	ret
+
+0080180e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80180e:	55                   	push   %ebp
+  80180f:	89 e5                	mov    %esp,%ebp
+  801811:	57                   	push   %edi
+  801812:	56                   	push   %esi
+  801813:	53                   	push   %ebx
+  801814:	83 ec 1c             	sub    $0x1c,%esp
+  801817:	89 c7                	mov    %eax,%edi
+  801819:	89 d6                	mov    %edx,%esi
+  80181b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80181e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801821:	89 d1                	mov    %edx,%ecx
+  801823:	89 c2                	mov    %eax,%edx
+  801825:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801828:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80182b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80182e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801831:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801834:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80183b:	39 c2                	cmp    %eax,%edx
+  80183d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801840:	72 3e                	jb     801880 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801842:	83 ec 0c             	sub    $0xc,%esp
+  801845:	ff 75 18             	push   0x18(%ebp)
+  801848:	83 eb 01             	sub    $0x1,%ebx
+  80184b:	53                   	push   %ebx
+  80184c:	50                   	push   %eax
+  80184d:	83 ec 08             	sub    $0x8,%esp
+  801850:	ff 75 e4             	push   -0x1c(%ebp)
+  801853:	ff 75 e0             	push   -0x20(%ebp)
+  801856:	ff 75 dc             	push   -0x24(%ebp)
+  801859:	ff 75 d8             	push   -0x28(%ebp)
+  80185c:	e8 0f 0d 00 00       	call   802570 <__udivdi3>
+  801861:	83 c4 18             	add    $0x18,%esp
+  801864:	52                   	push   %edx
+  801865:	50                   	push   %eax
+  801866:	89 f2                	mov    %esi,%edx
+  801868:	89 f8                	mov    %edi,%eax
+  80186a:	e8 9f ff ff ff       	call   80180e <printnum>
+  80186f:	83 c4 20             	add    $0x20,%esp
+  801872:	eb 13                	jmp    801887 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801874:	83 ec 08             	sub    $0x8,%esp
+  801877:	56                   	push   %esi
+  801878:	ff 75 18             	push   0x18(%ebp)
+  80187b:	ff d7                	call   *%edi
+  80187d:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801880:	83 eb 01             	sub    $0x1,%ebx
+  801883:	85 db                	test   %ebx,%ebx
+  801885:	7f ed                	jg     801874 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801887:	83 ec 08             	sub    $0x8,%esp
+  80188a:	56                   	push   %esi
+  80188b:	83 ec 04             	sub    $0x4,%esp
+  80188e:	ff 75 e4             	push   -0x1c(%ebp)
+  801891:	ff 75 e0             	push   -0x20(%ebp)
+  801894:	ff 75 dc             	push   -0x24(%ebp)
+  801897:	ff 75 d8             	push   -0x28(%ebp)
+  80189a:	e8 ef 0c 00 00       	call   80258e <__umoddi3>
+  80189f:	83 c4 14             	add    $0x14,%esp
+  8018a2:	0f be 80 f3 27 80 00 	movsbl 0x8027f3(%eax),%eax
+  8018a9:	50                   	push   %eax
+  8018aa:	ff d7                	call   *%edi
+}
+  8018ac:	83 c4 10             	add    $0x10,%esp
+  8018af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018b2:	5b                   	pop    %ebx
+  8018b3:	5e                   	pop    %esi
+  8018b4:	5f                   	pop    %edi
+  8018b5:	5d                   	pop    %ebp
+  8018b6:	c3                   	ret
+
+008018b7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8018b7:	55                   	push   %ebp
+  8018b8:	89 e5                	mov    %esp,%ebp
+  8018ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8018bd:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8018c1:	8b 10                	mov    (%eax),%edx
+  8018c3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8018c6:	73 0a                	jae    8018d2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8018c8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8018cb:	89 08                	mov    %ecx,(%eax)
+  8018cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d0:	88 02                	mov    %al,(%edx)
+}
+  8018d2:	5d                   	pop    %ebp
+  8018d3:	c3                   	ret
+
+008018d4 <printfmt>:
+{
+  8018d4:	55                   	push   %ebp
+  8018d5:	89 e5                	mov    %esp,%ebp
+  8018d7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8018da:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8018dd:	50                   	push   %eax
+  8018de:	ff 75 10             	push   0x10(%ebp)
+  8018e1:	ff 75 0c             	push   0xc(%ebp)
+  8018e4:	ff 75 08             	push   0x8(%ebp)
+  8018e7:	e8 05 00 00 00       	call   8018f1 <vprintfmt>
+}
+  8018ec:	83 c4 10             	add    $0x10,%esp
+  8018ef:	c9                   	leave
+  8018f0:	c3                   	ret
+
+008018f1 <vprintfmt>:
+{
+  8018f1:	55                   	push   %ebp
+  8018f2:	89 e5                	mov    %esp,%ebp
+  8018f4:	57                   	push   %edi
+  8018f5:	56                   	push   %esi
+  8018f6:	53                   	push   %ebx
+  8018f7:	83 ec 2c             	sub    $0x2c,%esp
+  8018fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801900:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801903:	eb 0a                	jmp    80190f <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801905:	83 ec 08             	sub    $0x8,%esp
+  801908:	53                   	push   %ebx
+  801909:	50                   	push   %eax
+  80190a:	ff d6                	call   *%esi
+  80190c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80190f:	83 c7 01             	add    $0x1,%edi
+  801912:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801916:	83 f8 25             	cmp    $0x25,%eax
+  801919:	74 0c                	je     801927 <vprintfmt+0x36>
+			if (ch == '\0')
+  80191b:	85 c0                	test   %eax,%eax
+  80191d:	75 e6                	jne    801905 <vprintfmt+0x14>
+}
+  80191f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801922:	5b                   	pop    %ebx
+  801923:	5e                   	pop    %esi
+  801924:	5f                   	pop    %edi
+  801925:	5d                   	pop    %ebp
+  801926:	c3                   	ret
+		padc = ' ';
+  801927:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80192b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801932:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801939:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801940:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801945:	8d 47 01             	lea    0x1(%edi),%eax
+  801948:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80194b:	0f b6 17             	movzbl (%edi),%edx
+  80194e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801951:	3c 55                	cmp    $0x55,%al
+  801953:	0f 87 c5 03 00 00    	ja     801d1e <vprintfmt+0x42d>
+  801959:	0f b6 c0             	movzbl %al,%eax
+  80195c:	ff 24 85 80 29 80 00 	jmp    *0x802980(,%eax,4)
+  801963:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801966:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80196a:	eb d9                	jmp    801945 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80196c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80196f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801973:	eb d0                	jmp    801945 <vprintfmt+0x54>
+  801975:	0f b6 d2             	movzbl %dl,%edx
+  801978:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80197b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801980:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801983:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801986:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80198a:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80198d:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801990:	83 f9 09             	cmp    $0x9,%ecx
+  801993:	77 55                	ja     8019ea <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801995:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801998:	eb e9                	jmp    801983 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80199a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80199d:	8b 00                	mov    (%eax),%eax
+  80199f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8019a8:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019ab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8019ae:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8019b2:	79 91                	jns    801945 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8019b4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8019b7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019ba:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8019c1:	eb 82                	jmp    801945 <vprintfmt+0x54>
+			if (width < 0)
+  8019c3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8019c6:	85 d2                	test   %edx,%edx
+  8019c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cd:	0f 49 c2             	cmovns %edx,%eax
+  8019d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019d6:	e9 6a ff ff ff       	jmp    801945 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8019db:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8019de:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8019e5:	e9 5b ff ff ff       	jmp    801945 <vprintfmt+0x54>
+  8019ea:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019ed:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019f0:	eb bc                	jmp    8019ae <vprintfmt+0xbd>
+			lflag++;
+  8019f2:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8019f5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019f8:	e9 48 ff ff ff       	jmp    801945 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8019fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a00:	8d 78 04             	lea    0x4(%eax),%edi
+  801a03:	83 ec 08             	sub    $0x8,%esp
+  801a06:	53                   	push   %ebx
+  801a07:	ff 30                	push   (%eax)
+  801a09:	ff d6                	call   *%esi
+			break;
+  801a0b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801a0e:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801a11:	e9 63 02 00 00       	jmp    801c79 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  801a16:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a19:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801a1c:	8b 10                	mov    (%eax),%edx
+  801a1e:	89 d0                	mov    %edx,%eax
+  801a20:	f7 d8                	neg    %eax
+  801a22:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801a25:	83 f8 12             	cmp    $0x12,%eax
+  801a28:	7f 23                	jg     801a4d <vprintfmt+0x15c>
+  801a2a:	8b 14 85 e0 2a 80 00 	mov    0x802ae0(,%eax,4),%edx
+  801a31:	85 d2                	test   %edx,%edx
+  801a33:	74 18                	je     801a4d <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801a35:	52                   	push   %edx
+  801a36:	68 89 27 80 00       	push   $0x802789
+  801a3b:	53                   	push   %ebx
+  801a3c:	56                   	push   %esi
+  801a3d:	e8 92 fe ff ff       	call   8018d4 <printfmt>
+  801a42:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a45:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801a48:	e9 2c 02 00 00       	jmp    801c79 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  801a4d:	50                   	push   %eax
+  801a4e:	68 0b 28 80 00       	push   $0x80280b
+  801a53:	53                   	push   %ebx
+  801a54:	56                   	push   %esi
+  801a55:	e8 7a fe ff ff       	call   8018d4 <printfmt>
+  801a5a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a5d:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801a60:	e9 14 02 00 00       	jmp    801c79 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801a65:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a68:	83 c0 04             	add    $0x4,%eax
+  801a6b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801a6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a71:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801a73:	85 c9                	test   %ecx,%ecx
+  801a75:	b8 04 28 80 00       	mov    $0x802804,%eax
+  801a7a:	0f 45 c1             	cmovne %ecx,%eax
+  801a7d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801a80:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801a84:	7e 06                	jle    801a8c <vprintfmt+0x19b>
+  801a86:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801a8a:	75 0b                	jne    801a97 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801a8c:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801a8f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801a92:	89 75 08             	mov    %esi,0x8(%ebp)
+  801a95:	eb 5c                	jmp    801af3 <vprintfmt+0x202>
+  801a97:	83 ec 08             	sub    $0x8,%esp
+  801a9a:	ff 75 d0             	push   -0x30(%ebp)
+  801a9d:	ff 75 cc             	push   -0x34(%ebp)
+  801aa0:	e8 19 03 00 00       	call   801dbe <strnlen>
+  801aa5:	89 c2                	mov    %eax,%edx
+  801aa7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801aaa:	29 d0                	sub    %edx,%eax
+  801aac:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801aaf:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801ab3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ab6:	89 75 08             	mov    %esi,0x8(%ebp)
+  801ab9:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801abb:	eb 0e                	jmp    801acb <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801abd:	83 ec 08             	sub    $0x8,%esp
+  801ac0:	53                   	push   %ebx
+  801ac1:	57                   	push   %edi
+  801ac2:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ac5:	83 ee 01             	sub    $0x1,%esi
+  801ac8:	83 c4 10             	add    $0x10,%esp
+  801acb:	85 f6                	test   %esi,%esi
+  801acd:	7f ee                	jg     801abd <vprintfmt+0x1cc>
+  801acf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ad2:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ad5:	85 c0                	test   %eax,%eax
+  801ad7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801adc:	0f 49 d0             	cmovns %eax,%edx
+  801adf:	29 d0                	sub    %edx,%eax
+  801ae1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ae4:	eb a6                	jmp    801a8c <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801ae6:	83 ec 08             	sub    $0x8,%esp
+  801ae9:	53                   	push   %ebx
+  801aea:	52                   	push   %edx
+  801aeb:	ff 55 08             	call   *0x8(%ebp)
+  801aee:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801af1:	89 f1                	mov    %esi,%ecx
+  801af3:	8d 71 01             	lea    0x1(%ecx),%esi
+  801af6:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801afa:	0f be d0             	movsbl %al,%edx
+  801afd:	85 d2                	test   %edx,%edx
+  801aff:	74 28                	je     801b29 <vprintfmt+0x238>
+  801b01:	85 ff                	test   %edi,%edi
+  801b03:	78 05                	js     801b0a <vprintfmt+0x219>
+  801b05:	83 ef 01             	sub    $0x1,%edi
+  801b08:	78 30                	js     801b3a <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801b0a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801b0e:	74 d6                	je     801ae6 <vprintfmt+0x1f5>
+  801b10:	0f be c0             	movsbl %al,%eax
+  801b13:	83 e8 20             	sub    $0x20,%eax
+  801b16:	83 f8 5e             	cmp    $0x5e,%eax
+  801b19:	76 cb                	jbe    801ae6 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801b1b:	83 ec 08             	sub    $0x8,%esp
+  801b1e:	53                   	push   %ebx
+  801b1f:	6a 3f                	push   $0x3f
+  801b21:	ff 55 08             	call   *0x8(%ebp)
+  801b24:	83 c4 10             	add    $0x10,%esp
+  801b27:	eb c8                	jmp    801af1 <vprintfmt+0x200>
+  801b29:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b2c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b2f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801b32:	01 d0                	add    %edx,%eax
+  801b34:	29 c8                	sub    %ecx,%eax
+  801b36:	89 c7                	mov    %eax,%edi
+  801b38:	eb 13                	jmp    801b4d <vprintfmt+0x25c>
+  801b3a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b3d:	eb ed                	jmp    801b2c <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801b3f:	83 ec 08             	sub    $0x8,%esp
+  801b42:	53                   	push   %ebx
+  801b43:	6a 20                	push   $0x20
+  801b45:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801b47:	83 ef 01             	sub    $0x1,%edi
+  801b4a:	83 c4 10             	add    $0x10,%esp
+  801b4d:	85 ff                	test   %edi,%edi
+  801b4f:	7f ee                	jg     801b3f <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801b51:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b54:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b57:	e9 1d 01 00 00       	jmp    801c79 <vprintfmt+0x388>
+	if (lflag >= 2)
+  801b5c:	83 f9 01             	cmp    $0x1,%ecx
+  801b5f:	7f 1b                	jg     801b7c <vprintfmt+0x28b>
+	else if (lflag)
+  801b61:	85 c9                	test   %ecx,%ecx
+  801b63:	74 63                	je     801bc8 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  801b65:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b68:	8b 00                	mov    (%eax),%eax
+  801b6a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b6d:	99                   	cltd
+  801b6e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b71:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b74:	8d 40 04             	lea    0x4(%eax),%eax
+  801b77:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b7a:	eb 17                	jmp    801b93 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  801b7c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b7f:	8b 50 04             	mov    0x4(%eax),%edx
+  801b82:	8b 00                	mov    (%eax),%eax
+  801b84:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b87:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b8a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b8d:	8d 40 08             	lea    0x8(%eax),%eax
+  801b90:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801b93:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b96:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801b99:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801b9e:	85 c9                	test   %ecx,%ecx
+  801ba0:	0f 89 b9 00 00 00    	jns    801c5f <vprintfmt+0x36e>
+				putch('-', putdat);
+  801ba6:	83 ec 08             	sub    $0x8,%esp
+  801ba9:	53                   	push   %ebx
+  801baa:	6a 2d                	push   $0x2d
+  801bac:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801bae:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801bb1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801bb4:	f7 da                	neg    %edx
+  801bb6:	83 d1 00             	adc    $0x0,%ecx
+  801bb9:	f7 d9                	neg    %ecx
+  801bbb:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801bbe:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801bc3:	e9 97 00 00 00       	jmp    801c5f <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  801bc8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bcb:	8b 00                	mov    (%eax),%eax
+  801bcd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bd0:	99                   	cltd
+  801bd1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801bd4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bd7:	8d 40 04             	lea    0x4(%eax),%eax
+  801bda:	89 45 14             	mov    %eax,0x14(%ebp)
+  801bdd:	eb b4                	jmp    801b93 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  801bdf:	83 f9 01             	cmp    $0x1,%ecx
+  801be2:	7f 1b                	jg     801bff <vprintfmt+0x30e>
+	else if (lflag)
+  801be4:	85 c9                	test   %ecx,%ecx
+  801be6:	74 2c                	je     801c14 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  801be8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801beb:	8b 10                	mov    (%eax),%edx
+  801bed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bf2:	8d 40 04             	lea    0x4(%eax),%eax
+  801bf5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801bf8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801bfd:	eb 60                	jmp    801c5f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801bff:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c02:	8b 10                	mov    (%eax),%edx
+  801c04:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c07:	8d 40 08             	lea    0x8(%eax),%eax
+  801c0a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c0d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801c12:	eb 4b                	jmp    801c5f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  801c14:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c17:	8b 10                	mov    (%eax),%edx
+  801c19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c1e:	8d 40 04             	lea    0x4(%eax),%eax
+  801c21:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c24:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801c29:	eb 34                	jmp    801c5f <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801c2b:	83 f9 01             	cmp    $0x1,%ecx
+  801c2e:	7f 15                	jg     801c45 <vprintfmt+0x354>
+	else if (lflag)
+  801c30:	85 c9                	test   %ecx,%ecx
+  801c32:	74 4d                	je     801c81 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  801c34:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c37:	8b 00                	mov    (%eax),%eax
+  801c39:	99                   	cltd
+  801c3a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c3d:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801c40:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  801c43:	eb 11                	jmp    801c56 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  801c45:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c48:	8b 50 04             	mov    0x4(%eax),%edx
+  801c4b:	8b 00                	mov    (%eax),%eax
+  801c4d:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c50:	8d 49 08             	lea    0x8(%ecx),%ecx
+  801c53:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  801c56:	89 d1                	mov    %edx,%ecx
+  801c58:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  801c5a:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801c5f:	83 ec 0c             	sub    $0xc,%esp
+  801c62:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801c66:	50                   	push   %eax
+  801c67:	ff 75 e0             	push   -0x20(%ebp)
+  801c6a:	57                   	push   %edi
+  801c6b:	51                   	push   %ecx
+  801c6c:	52                   	push   %edx
+  801c6d:	89 da                	mov    %ebx,%edx
+  801c6f:	89 f0                	mov    %esi,%eax
+  801c71:	e8 98 fb ff ff       	call   80180e <printnum>
+			break;
+  801c76:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801c79:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801c7c:	e9 8e fc ff ff       	jmp    80190f <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  801c81:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c84:	8b 00                	mov    (%eax),%eax
+  801c86:	99                   	cltd
+  801c87:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c8a:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801c8d:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  801c90:	eb c4                	jmp    801c56 <vprintfmt+0x365>
+			putch('0', putdat);
+  801c92:	83 ec 08             	sub    $0x8,%esp
+  801c95:	53                   	push   %ebx
+  801c96:	6a 30                	push   $0x30
+  801c98:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801c9a:	83 c4 08             	add    $0x8,%esp
+  801c9d:	53                   	push   %ebx
+  801c9e:	6a 78                	push   $0x78
+  801ca0:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801ca2:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ca5:	8b 10                	mov    (%eax),%edx
+  801ca7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801cac:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801caf:	8d 40 04             	lea    0x4(%eax),%eax
+  801cb2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cb5:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  801cba:	eb a3                	jmp    801c5f <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801cbc:	83 f9 01             	cmp    $0x1,%ecx
+  801cbf:	7f 1b                	jg     801cdc <vprintfmt+0x3eb>
+	else if (lflag)
+  801cc1:	85 c9                	test   %ecx,%ecx
+  801cc3:	74 2f                	je     801cf4 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  801cc5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cc8:	8b 10                	mov    (%eax),%edx
+  801cca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ccf:	8d 40 04             	lea    0x4(%eax),%eax
+  801cd2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cd5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801cda:	eb 83                	jmp    801c5f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801cdc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cdf:	8b 10                	mov    (%eax),%edx
+  801ce1:	8b 48 04             	mov    0x4(%eax),%ecx
+  801ce4:	8d 40 08             	lea    0x8(%eax),%eax
+  801ce7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cea:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801cef:	e9 6b ff ff ff       	jmp    801c5f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  801cf4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cf7:	8b 10                	mov    (%eax),%edx
+  801cf9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cfe:	8d 40 04             	lea    0x4(%eax),%eax
+  801d01:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801d04:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801d09:	e9 51 ff ff ff       	jmp    801c5f <vprintfmt+0x36e>
+			putch(ch, putdat);
+  801d0e:	83 ec 08             	sub    $0x8,%esp
+  801d11:	53                   	push   %ebx
+  801d12:	6a 25                	push   $0x25
+  801d14:	ff d6                	call   *%esi
+			break;
+  801d16:	83 c4 10             	add    $0x10,%esp
+  801d19:	e9 5b ff ff ff       	jmp    801c79 <vprintfmt+0x388>
+			putch('%', putdat);
+  801d1e:	83 ec 08             	sub    $0x8,%esp
+  801d21:	53                   	push   %ebx
+  801d22:	6a 25                	push   $0x25
+  801d24:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801d26:	83 c4 10             	add    $0x10,%esp
+  801d29:	89 f8                	mov    %edi,%eax
+  801d2b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801d2f:	74 05                	je     801d36 <vprintfmt+0x445>
+  801d31:	83 e8 01             	sub    $0x1,%eax
+  801d34:	eb f5                	jmp    801d2b <vprintfmt+0x43a>
+  801d36:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d39:	e9 3b ff ff ff       	jmp    801c79 <vprintfmt+0x388>
+
+00801d3e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801d3e:	55                   	push   %ebp
+  801d3f:	89 e5                	mov    %esp,%ebp
+  801d41:	83 ec 18             	sub    $0x18,%esp
+  801d44:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d47:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801d4a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801d4d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801d51:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801d54:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801d5b:	85 c0                	test   %eax,%eax
+  801d5d:	74 26                	je     801d85 <vsnprintf+0x47>
+  801d5f:	85 d2                	test   %edx,%edx
+  801d61:	7e 22                	jle    801d85 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801d63:	ff 75 14             	push   0x14(%ebp)
+  801d66:	ff 75 10             	push   0x10(%ebp)
+  801d69:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801d6c:	50                   	push   %eax
+  801d6d:	68 b7 18 80 00       	push   $0x8018b7
+  801d72:	e8 7a fb ff ff       	call   8018f1 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801d77:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801d7a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801d7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d80:	83 c4 10             	add    $0x10,%esp
+}
+  801d83:	c9                   	leave
+  801d84:	c3                   	ret
+		return -E_INVAL;
+  801d85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d8a:	eb f7                	jmp    801d83 <vsnprintf+0x45>
+
+00801d8c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801d8c:	55                   	push   %ebp
+  801d8d:	89 e5                	mov    %esp,%ebp
+  801d8f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801d92:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801d95:	50                   	push   %eax
+  801d96:	ff 75 10             	push   0x10(%ebp)
+  801d99:	ff 75 0c             	push   0xc(%ebp)
+  801d9c:	ff 75 08             	push   0x8(%ebp)
+  801d9f:	e8 9a ff ff ff       	call   801d3e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801da4:	c9                   	leave
+  801da5:	c3                   	ret
+
+00801da6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801da6:	55                   	push   %ebp
+  801da7:	89 e5                	mov    %esp,%ebp
+  801da9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801dac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db1:	eb 03                	jmp    801db6 <strlen+0x10>
+		n++;
+  801db3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801db6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801dba:	75 f7                	jne    801db3 <strlen+0xd>
+	return n;
+}
+  801dbc:	5d                   	pop    %ebp
+  801dbd:	c3                   	ret
+
+00801dbe <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801dbe:	55                   	push   %ebp
+  801dbf:	89 e5                	mov    %esp,%ebp
+  801dc1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dc4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dcc:	eb 03                	jmp    801dd1 <strnlen+0x13>
+		n++;
+  801dce:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dd1:	39 d0                	cmp    %edx,%eax
+  801dd3:	74 08                	je     801ddd <strnlen+0x1f>
+  801dd5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801dd9:	75 f3                	jne    801dce <strnlen+0x10>
+  801ddb:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801ddd:	89 d0                	mov    %edx,%eax
+  801ddf:	5d                   	pop    %ebp
+  801de0:	c3                   	ret
+
+00801de1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801de1:	55                   	push   %ebp
+  801de2:	89 e5                	mov    %esp,%ebp
+  801de4:	53                   	push   %ebx
+  801de5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801de8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801deb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801df4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801df7:	83 c0 01             	add    $0x1,%eax
+  801dfa:	84 d2                	test   %dl,%dl
+  801dfc:	75 f2                	jne    801df0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801dfe:	89 c8                	mov    %ecx,%eax
+  801e00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e03:	c9                   	leave
+  801e04:	c3                   	ret
+
+00801e05 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801e05:	55                   	push   %ebp
+  801e06:	89 e5                	mov    %esp,%ebp
+  801e08:	53                   	push   %ebx
+  801e09:	83 ec 10             	sub    $0x10,%esp
+  801e0c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801e0f:	53                   	push   %ebx
+  801e10:	e8 91 ff ff ff       	call   801da6 <strlen>
+  801e15:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801e18:	ff 75 0c             	push   0xc(%ebp)
+  801e1b:	01 d8                	add    %ebx,%eax
+  801e1d:	50                   	push   %eax
+  801e1e:	e8 be ff ff ff       	call   801de1 <strcpy>
+	return dst;
+}
+  801e23:	89 d8                	mov    %ebx,%eax
+  801e25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e28:	c9                   	leave
+  801e29:	c3                   	ret
+
+00801e2a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801e2a:	55                   	push   %ebp
+  801e2b:	89 e5                	mov    %esp,%ebp
+  801e2d:	56                   	push   %esi
+  801e2e:	53                   	push   %ebx
+  801e2f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e32:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801e35:	89 f3                	mov    %esi,%ebx
+  801e37:	03 5d 10             	add    0x10(%ebp),%ebx
+  801e3a:	89 f0                	mov    %esi,%eax
+  801e3c:	eb 0f                	jmp    801e4d <strncpy+0x23>
+		*dst++ = *src;
+  801e3e:	83 c0 01             	add    $0x1,%eax
+  801e41:	0f b6 0a             	movzbl (%edx),%ecx
+  801e44:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801e47:	80 f9 01             	cmp    $0x1,%cl
+  801e4a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801e4d:	39 d8                	cmp    %ebx,%eax
+  801e4f:	75 ed                	jne    801e3e <strncpy+0x14>
+	}
+	return ret;
+}
+  801e51:	89 f0                	mov    %esi,%eax
+  801e53:	5b                   	pop    %ebx
+  801e54:	5e                   	pop    %esi
+  801e55:	5d                   	pop    %ebp
+  801e56:	c3                   	ret
+
+00801e57 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e57:	55                   	push   %ebp
+  801e58:	89 e5                	mov    %esp,%ebp
+  801e5a:	56                   	push   %esi
+  801e5b:	53                   	push   %ebx
+  801e5c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e62:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801e65:	89 f0                	mov    %esi,%eax
+  801e67:	85 d2                	test   %edx,%edx
+  801e69:	74 21                	je     801e8c <strlcpy+0x35>
+  801e6b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801e6f:	89 f2                	mov    %esi,%edx
+  801e71:	eb 09                	jmp    801e7c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801e73:	83 c1 01             	add    $0x1,%ecx
+  801e76:	83 c2 01             	add    $0x1,%edx
+  801e79:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801e7c:	39 c2                	cmp    %eax,%edx
+  801e7e:	74 09                	je     801e89 <strlcpy+0x32>
+  801e80:	0f b6 19             	movzbl (%ecx),%ebx
+  801e83:	84 db                	test   %bl,%bl
+  801e85:	75 ec                	jne    801e73 <strlcpy+0x1c>
+  801e87:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801e89:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801e8c:	29 f0                	sub    %esi,%eax
+}
+  801e8e:	5b                   	pop    %ebx
+  801e8f:	5e                   	pop    %esi
+  801e90:	5d                   	pop    %ebp
+  801e91:	c3                   	ret
+
+00801e92 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801e92:	55                   	push   %ebp
+  801e93:	89 e5                	mov    %esp,%ebp
+  801e95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e98:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801e9b:	eb 06                	jmp    801ea3 <strcmp+0x11>
+		p++, q++;
+  801e9d:	83 c1 01             	add    $0x1,%ecx
+  801ea0:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801ea3:	0f b6 01             	movzbl (%ecx),%eax
+  801ea6:	84 c0                	test   %al,%al
+  801ea8:	74 04                	je     801eae <strcmp+0x1c>
+  801eaa:	3a 02                	cmp    (%edx),%al
+  801eac:	74 ef                	je     801e9d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801eae:	0f b6 c0             	movzbl %al,%eax
+  801eb1:	0f b6 12             	movzbl (%edx),%edx
+  801eb4:	29 d0                	sub    %edx,%eax
+}
+  801eb6:	5d                   	pop    %ebp
+  801eb7:	c3                   	ret
+
+00801eb8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801eb8:	55                   	push   %ebp
+  801eb9:	89 e5                	mov    %esp,%ebp
+  801ebb:	53                   	push   %ebx
+  801ebc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ebf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ec2:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801ec5:	eb 09                	jmp    801ed0 <strncmp+0x18>
+		n--, p++, q++;
+  801ec7:	83 ea 01             	sub    $0x1,%edx
+  801eca:	83 c0 01             	add    $0x1,%eax
+  801ecd:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801ed0:	85 d2                	test   %edx,%edx
+  801ed2:	74 18                	je     801eec <strncmp+0x34>
+  801ed4:	0f b6 18             	movzbl (%eax),%ebx
+  801ed7:	84 db                	test   %bl,%bl
+  801ed9:	74 04                	je     801edf <strncmp+0x27>
+  801edb:	3a 19                	cmp    (%ecx),%bl
+  801edd:	74 e8                	je     801ec7 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801edf:	0f b6 00             	movzbl (%eax),%eax
+  801ee2:	0f b6 11             	movzbl (%ecx),%edx
+  801ee5:	29 d0                	sub    %edx,%eax
+}
+  801ee7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eea:	c9                   	leave
+  801eeb:	c3                   	ret
+		return 0;
+  801eec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef1:	eb f4                	jmp    801ee7 <strncmp+0x2f>
+
+00801ef3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801ef3:	55                   	push   %ebp
+  801ef4:	89 e5                	mov    %esp,%ebp
+  801ef6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801efd:	eb 03                	jmp    801f02 <strchr+0xf>
+  801eff:	83 c0 01             	add    $0x1,%eax
+  801f02:	0f b6 10             	movzbl (%eax),%edx
+  801f05:	84 d2                	test   %dl,%dl
+  801f07:	74 06                	je     801f0f <strchr+0x1c>
+		if (*s == c)
+  801f09:	38 ca                	cmp    %cl,%dl
+  801f0b:	75 f2                	jne    801eff <strchr+0xc>
+  801f0d:	eb 05                	jmp    801f14 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801f0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f14:	5d                   	pop    %ebp
+  801f15:	c3                   	ret
+
+00801f16 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801f16:	55                   	push   %ebp
+  801f17:	89 e5                	mov    %esp,%ebp
+  801f19:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f20:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801f23:	38 ca                	cmp    %cl,%dl
+  801f25:	74 09                	je     801f30 <strfind+0x1a>
+  801f27:	84 d2                	test   %dl,%dl
+  801f29:	74 05                	je     801f30 <strfind+0x1a>
+	for (; *s; s++)
+  801f2b:	83 c0 01             	add    $0x1,%eax
+  801f2e:	eb f0                	jmp    801f20 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801f30:	5d                   	pop    %ebp
+  801f31:	c3                   	ret
+
+00801f32 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801f32:	55                   	push   %ebp
+  801f33:	89 e5                	mov    %esp,%ebp
+  801f35:	57                   	push   %edi
+  801f36:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f39:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801f3c:	85 c9                	test   %ecx,%ecx
+  801f3e:	74 20                	je     801f60 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801f40:	89 f8                	mov    %edi,%eax
+  801f42:	09 c8                	or     %ecx,%eax
+  801f44:	a8 03                	test   $0x3,%al
+  801f46:	75 12                	jne    801f5a <memset+0x28>
+		c &= 0xFF;
+  801f48:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801f4c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801f52:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801f55:	fc                   	cld
+  801f56:	f3 ab                	rep stos %eax,%es:(%edi)
+  801f58:	eb 06                	jmp    801f60 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801f5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f5d:	fc                   	cld
+  801f5e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801f60:	89 f8                	mov    %edi,%eax
+  801f62:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801f65:	c9                   	leave
+  801f66:	c3                   	ret
+
+00801f67 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801f67:	55                   	push   %ebp
+  801f68:	89 e5                	mov    %esp,%ebp
+  801f6a:	57                   	push   %edi
+  801f6b:	56                   	push   %esi
+  801f6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f72:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801f75:	39 c6                	cmp    %eax,%esi
+  801f77:	73 32                	jae    801fab <memmove+0x44>
+  801f79:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801f7c:	39 d0                	cmp    %edx,%eax
+  801f7e:	73 2b                	jae    801fab <memmove+0x44>
+		s += n;
+		d += n;
+  801f80:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f83:	89 d6                	mov    %edx,%esi
+  801f85:	09 fe                	or     %edi,%esi
+  801f87:	09 ce                	or     %ecx,%esi
+  801f89:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801f8f:	75 0e                	jne    801f9f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801f91:	83 ef 04             	sub    $0x4,%edi
+  801f94:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801f97:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801f9a:	fd                   	std
+  801f9b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801f9d:	eb 09                	jmp    801fa8 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801f9f:	83 ef 01             	sub    $0x1,%edi
+  801fa2:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801fa5:	fd                   	std
+  801fa6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801fa8:	fc                   	cld
+  801fa9:	eb 1a                	jmp    801fc5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801fab:	89 f2                	mov    %esi,%edx
+  801fad:	09 c2                	or     %eax,%edx
+  801faf:	09 ca                	or     %ecx,%edx
+  801fb1:	f6 c2 03             	test   $0x3,%dl
+  801fb4:	75 0a                	jne    801fc0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801fb6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801fb9:	89 c7                	mov    %eax,%edi
+  801fbb:	fc                   	cld
+  801fbc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fbe:	eb 05                	jmp    801fc5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801fc0:	89 c7                	mov    %eax,%edi
+  801fc2:	fc                   	cld
+  801fc3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801fc5:	5e                   	pop    %esi
+  801fc6:	5f                   	pop    %edi
+  801fc7:	5d                   	pop    %ebp
+  801fc8:	c3                   	ret
+
+00801fc9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801fc9:	55                   	push   %ebp
+  801fca:	89 e5                	mov    %esp,%ebp
+  801fcc:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801fcf:	ff 75 10             	push   0x10(%ebp)
+  801fd2:	ff 75 0c             	push   0xc(%ebp)
+  801fd5:	ff 75 08             	push   0x8(%ebp)
+  801fd8:	e8 8a ff ff ff       	call   801f67 <memmove>
+}
+  801fdd:	c9                   	leave
+  801fde:	c3                   	ret
+
+00801fdf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801fdf:	55                   	push   %ebp
+  801fe0:	89 e5                	mov    %esp,%ebp
+  801fe2:	56                   	push   %esi
+  801fe3:	53                   	push   %ebx
+  801fe4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801fea:	89 c6                	mov    %eax,%esi
+  801fec:	03 75 10             	add    0x10(%ebp),%esi
+  801fef:	eb 06                	jmp    801ff7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801ff1:	83 c0 01             	add    $0x1,%eax
+  801ff4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801ff7:	39 f0                	cmp    %esi,%eax
+  801ff9:	74 14                	je     80200f <memcmp+0x30>
+		if (*s1 != *s2)
+  801ffb:	0f b6 08             	movzbl (%eax),%ecx
+  801ffe:	0f b6 1a             	movzbl (%edx),%ebx
+  802001:	38 d9                	cmp    %bl,%cl
+  802003:	74 ec                	je     801ff1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802005:	0f b6 c1             	movzbl %cl,%eax
+  802008:	0f b6 db             	movzbl %bl,%ebx
+  80200b:	29 d8                	sub    %ebx,%eax
+  80200d:	eb 05                	jmp    802014 <memcmp+0x35>
+	}
+
+	return 0;
+  80200f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802014:	5b                   	pop    %ebx
+  802015:	5e                   	pop    %esi
+  802016:	5d                   	pop    %ebp
+  802017:	c3                   	ret
+
+00802018 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802018:	55                   	push   %ebp
+  802019:	89 e5                	mov    %esp,%ebp
+  80201b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80201e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802021:	89 c2                	mov    %eax,%edx
+  802023:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802026:	eb 03                	jmp    80202b <memfind+0x13>
+  802028:	83 c0 01             	add    $0x1,%eax
+  80202b:	39 d0                	cmp    %edx,%eax
+  80202d:	73 04                	jae    802033 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80202f:	38 08                	cmp    %cl,(%eax)
+  802031:	75 f5                	jne    802028 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802033:	5d                   	pop    %ebp
+  802034:	c3                   	ret
+
+00802035 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802035:	55                   	push   %ebp
+  802036:	89 e5                	mov    %esp,%ebp
+  802038:	57                   	push   %edi
+  802039:	56                   	push   %esi
+  80203a:	53                   	push   %ebx
+  80203b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80203e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802041:	eb 03                	jmp    802046 <strtol+0x11>
+		s++;
+  802043:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802046:	0f b6 02             	movzbl (%edx),%eax
+  802049:	3c 20                	cmp    $0x20,%al
+  80204b:	74 f6                	je     802043 <strtol+0xe>
+  80204d:	3c 09                	cmp    $0x9,%al
+  80204f:	74 f2                	je     802043 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802051:	3c 2b                	cmp    $0x2b,%al
+  802053:	74 2a                	je     80207f <strtol+0x4a>
+	int neg = 0;
+  802055:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80205a:	3c 2d                	cmp    $0x2d,%al
+  80205c:	74 2b                	je     802089 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80205e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802064:	75 0f                	jne    802075 <strtol+0x40>
+  802066:	80 3a 30             	cmpb   $0x30,(%edx)
+  802069:	74 28                	je     802093 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80206b:	85 db                	test   %ebx,%ebx
+  80206d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802072:	0f 44 d8             	cmove  %eax,%ebx
+  802075:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80207a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80207d:	eb 46                	jmp    8020c5 <strtol+0x90>
+		s++;
+  80207f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802082:	bf 00 00 00 00       	mov    $0x0,%edi
+  802087:	eb d5                	jmp    80205e <strtol+0x29>
+		s++, neg = 1;
+  802089:	83 c2 01             	add    $0x1,%edx
+  80208c:	bf 01 00 00 00       	mov    $0x1,%edi
+  802091:	eb cb                	jmp    80205e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802093:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802097:	74 0e                	je     8020a7 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802099:	85 db                	test   %ebx,%ebx
+  80209b:	75 d8                	jne    802075 <strtol+0x40>
+		s++, base = 8;
+  80209d:	83 c2 01             	add    $0x1,%edx
+  8020a0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8020a5:	eb ce                	jmp    802075 <strtol+0x40>
+		s += 2, base = 16;
+  8020a7:	83 c2 02             	add    $0x2,%edx
+  8020aa:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8020af:	eb c4                	jmp    802075 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8020b1:	0f be c0             	movsbl %al,%eax
+  8020b4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8020b7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8020ba:	7d 3a                	jge    8020f6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8020bc:	83 c2 01             	add    $0x1,%edx
+  8020bf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8020c3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8020c5:	0f b6 02             	movzbl (%edx),%eax
+  8020c8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8020cb:	89 f3                	mov    %esi,%ebx
+  8020cd:	80 fb 09             	cmp    $0x9,%bl
+  8020d0:	76 df                	jbe    8020b1 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8020d2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8020d5:	89 f3                	mov    %esi,%ebx
+  8020d7:	80 fb 19             	cmp    $0x19,%bl
+  8020da:	77 08                	ja     8020e4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8020dc:	0f be c0             	movsbl %al,%eax
+  8020df:	83 e8 57             	sub    $0x57,%eax
+  8020e2:	eb d3                	jmp    8020b7 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8020e4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8020e7:	89 f3                	mov    %esi,%ebx
+  8020e9:	80 fb 19             	cmp    $0x19,%bl
+  8020ec:	77 08                	ja     8020f6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8020ee:	0f be c0             	movsbl %al,%eax
+  8020f1:	83 e8 37             	sub    $0x37,%eax
+  8020f4:	eb c1                	jmp    8020b7 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8020f6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8020fa:	74 05                	je     802101 <strtol+0xcc>
+		*endptr = (char *) s;
+  8020fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020ff:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802101:	89 c8                	mov    %ecx,%eax
+  802103:	f7 d8                	neg    %eax
+  802105:	85 ff                	test   %edi,%edi
+  802107:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80210a:	89 c8                	mov    %ecx,%eax
+  80210c:	5b                   	pop    %ebx
+  80210d:	5e                   	pop    %esi
+  80210e:	5f                   	pop    %edi
+  80210f:	5d                   	pop    %ebp
+  802110:	c3                   	ret
+
+00802111 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  802111:	55                   	push   %ebp
+  802112:	89 e5                	mov    %esp,%ebp
+  802114:	57                   	push   %edi
+  802115:	56                   	push   %esi
+  802116:	53                   	push   %ebx
+  802117:	83 ec 0c             	sub    $0xc,%esp
+  80211a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80211d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802120:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  802123:	85 ff                	test   %edi,%edi
+  802125:	74 16                	je     80213d <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  802127:	83 ec 04             	sub    $0x4,%esp
+  80212a:	56                   	push   %esi
+  80212b:	6a 00                	push   $0x0
+  80212d:	53                   	push   %ebx
+  80212e:	e8 02 ff ff ff       	call   802035 <strtol>
+  802133:	89 07                	mov    %eax,(%edi)
+  802135:	83 c4 10             	add    $0x10,%esp
+  802138:	eb 03                	jmp    80213d <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  80213a:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  80213d:	0f b6 03             	movzbl (%ebx),%eax
+  802140:	3c 20                	cmp    $0x20,%al
+  802142:	74 f6                	je     80213a <strisl+0x29>
+  802144:	3c 09                	cmp    $0x9,%al
+  802146:	74 f2                	je     80213a <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  802148:	3c 2b                	cmp    $0x2b,%al
+  80214a:	74 23                	je     80216f <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  80214c:	3c 2d                	cmp    $0x2d,%al
+  80214e:	0f 94 c0             	sete   %al
+  802151:	0f b6 c0             	movzbl %al,%eax
+  802154:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802156:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  80215c:	75 41                	jne    80219f <strisl+0x8e>
+  80215e:	80 3b 30             	cmpb   $0x30,(%ebx)
+  802161:	74 11                	je     802174 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802163:	85 f6                	test   %esi,%esi
+  802165:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80216a:	0f 44 f0             	cmove  %eax,%esi
+  80216d:	eb 30                	jmp    80219f <strisl+0x8e>
+		s++;
+  80216f:	83 c3 01             	add    $0x1,%ebx
+  802172:	eb e2                	jmp    802156 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802174:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  802178:	74 0e                	je     802188 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  80217a:	85 f6                	test   %esi,%esi
+  80217c:	75 21                	jne    80219f <strisl+0x8e>
+		s++, base = 8;
+  80217e:	83 c3 01             	add    $0x1,%ebx
+  802181:	be 08 00 00 00       	mov    $0x8,%esi
+  802186:	eb 17                	jmp    80219f <strisl+0x8e>
+		s += 2, base = 16;
+  802188:	83 c3 02             	add    $0x2,%ebx
+  80218b:	be 10 00 00 00       	mov    $0x10,%esi
+  802190:	eb 0d                	jmp    80219f <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802192:	0f be c0             	movsbl %al,%eax
+  802195:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  802198:	39 f0                	cmp    %esi,%eax
+  80219a:	7d 38                	jge    8021d4 <strisl+0xc3>
+			return 0;
+		s++;
+  80219c:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  80219f:	0f b6 03             	movzbl (%ebx),%eax
+  8021a2:	8d 50 d0             	lea    -0x30(%eax),%edx
+  8021a5:	80 fa 09             	cmp    $0x9,%dl
+  8021a8:	76 e8                	jbe    802192 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  8021aa:	8d 50 9f             	lea    -0x61(%eax),%edx
+  8021ad:	80 fa 19             	cmp    $0x19,%dl
+  8021b0:	77 08                	ja     8021ba <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  8021b2:	0f be c0             	movsbl %al,%eax
+  8021b5:	83 e8 57             	sub    $0x57,%eax
+  8021b8:	eb de                	jmp    802198 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  8021ba:	8d 50 bf             	lea    -0x41(%eax),%edx
+  8021bd:	80 fa 19             	cmp    $0x19,%dl
+  8021c0:	77 08                	ja     8021ca <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  8021c2:	0f be c0             	movsbl %al,%eax
+  8021c5:	83 e8 37             	sub    $0x37,%eax
+  8021c8:	eb ce                	jmp    802198 <strisl+0x87>
+		else if (!*s)
+  8021ca:	84 c0                	test   %al,%al
+  8021cc:	0f 94 c0             	sete   %al
+  8021cf:	0f b6 c0             	movzbl %al,%eax
+  8021d2:	eb 05                	jmp    8021d9 <strisl+0xc8>
+			return 0;
+  8021d4:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  8021d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021dc:	5b                   	pop    %ebx
+  8021dd:	5e                   	pop    %esi
+  8021de:	5f                   	pop    %edi
+  8021df:	5d                   	pop    %ebp
+  8021e0:	c3                   	ret
+
+008021e1 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8021e1:	55                   	push   %ebp
+  8021e2:	89 e5                	mov    %esp,%ebp
+  8021e4:	57                   	push   %edi
+  8021e5:	56                   	push   %esi
+  8021e6:	53                   	push   %ebx
+  8021e7:	83 ec 14             	sub    $0x14,%esp
+  8021ea:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021ed:	8b 75 14             	mov    0x14(%ebp),%esi
+  8021f0:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8021f3:	ff 75 10             	push   0x10(%ebp)
+  8021f6:	ff 75 0c             	push   0xc(%ebp)
+  8021f9:	e8 c9 e3 ff ff       	call   8005c7 <sys_ipc_recv_pages>
+  8021fe:	83 c4 10             	add    $0x10,%esp
+  802201:	85 c0                	test   %eax,%eax
+  802203:	78 46                	js     80224b <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802205:	85 ff                	test   %edi,%edi
+  802207:	74 0d                	je     802216 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  802209:	a1 08 40 80 00       	mov    0x804008,%eax
+  80220e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802214:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802216:	85 f6                	test   %esi,%esi
+  802218:	74 0d                	je     802227 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  80221a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80221f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802225:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802227:	85 db                	test   %ebx,%ebx
+  802229:	74 0d                	je     802238 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  80222b:	a1 08 40 80 00       	mov    0x804008,%eax
+  802230:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802236:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802238:	a1 08 40 80 00       	mov    0x804008,%eax
+  80223d:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802243:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802246:	5b                   	pop    %ebx
+  802247:	5e                   	pop    %esi
+  802248:	5f                   	pop    %edi
+  802249:	5d                   	pop    %ebp
+  80224a:	c3                   	ret
+		if (from_env_store) {
+  80224b:	85 ff                	test   %edi,%edi
+  80224d:	74 06                	je     802255 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80224f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802255:	85 f6                	test   %esi,%esi
+  802257:	74 06                	je     80225f <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  802259:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80225f:	85 db                	test   %ebx,%ebx
+  802261:	74 e0                	je     802243 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  802263:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802269:	eb d8                	jmp    802243 <ipc_recv_pages+0x62>
+
+0080226b <ipc_recv>:
+{
+  80226b:	55                   	push   %ebp
+  80226c:	89 e5                	mov    %esp,%ebp
+  80226e:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  802271:	6a 00                	push   $0x0
+  802273:	ff 75 10             	push   0x10(%ebp)
+  802276:	6a 01                	push   $0x1
+  802278:	ff 75 0c             	push   0xc(%ebp)
+  80227b:	ff 75 08             	push   0x8(%ebp)
+  80227e:	e8 5e ff ff ff       	call   8021e1 <ipc_recv_pages>
+}
+  802283:	c9                   	leave
+  802284:	c3                   	ret
+
+00802285 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802285:	55                   	push   %ebp
+  802286:	89 e5                	mov    %esp,%ebp
+  802288:	56                   	push   %esi
+  802289:	53                   	push   %ebx
+  80228a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80228d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  802290:	83 ec 0c             	sub    $0xc,%esp
+  802293:	ff 75 0c             	push   0xc(%ebp)
+  802296:	e8 60 e4 ff ff       	call   8006fb <sys_ipc_try_recv>
+  80229b:	83 c4 10             	add    $0x10,%esp
+  80229e:	85 c0                	test   %eax,%eax
+  8022a0:	78 34                	js     8022d6 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8022a2:	85 f6                	test   %esi,%esi
+  8022a4:	74 0d                	je     8022b3 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8022a6:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022ab:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8022b1:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8022b3:	85 db                	test   %ebx,%ebx
+  8022b5:	74 0d                	je     8022c4 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8022b7:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022bc:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8022c2:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8022c4:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022c9:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8022cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022d2:	5b                   	pop    %ebx
+  8022d3:	5e                   	pop    %esi
+  8022d4:	5d                   	pop    %ebp
+  8022d5:	c3                   	ret
+		if (from_env_store) {
+  8022d6:	85 f6                	test   %esi,%esi
+  8022d8:	74 06                	je     8022e0 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8022da:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8022e0:	85 db                	test   %ebx,%ebx
+  8022e2:	74 eb                	je     8022cf <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8022e4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8022ea:	eb e3                	jmp    8022cf <ipc_try_recv+0x4a>
+
+008022ec <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8022ec:	55                   	push   %ebp
+  8022ed:	89 e5                	mov    %esp,%ebp
+  8022ef:	83 ec 14             	sub    $0x14,%esp
+  8022f2:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8022f5:	85 c0                	test   %eax,%eax
+  8022f7:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8022fc:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8022ff:	ff 75 18             	push   0x18(%ebp)
+  802302:	ff 75 14             	push   0x14(%ebp)
+  802305:	50                   	push   %eax
+  802306:	ff 75 0c             	push   0xc(%ebp)
+  802309:	ff 75 08             	push   0x8(%ebp)
+  80230c:	e8 79 e2 ff ff       	call   80058a <sys_ipc_send_pages>
+  802311:	83 c4 20             	add    $0x20,%esp
+  802314:	85 c0                	test   %eax,%eax
+  802316:	78 02                	js     80231a <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  802318:	c9                   	leave
+  802319:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  80231a:	50                   	push   %eax
+  80231b:	68 4c 2b 80 00       	push   $0x802b4c
+  802320:	68 80 00 00 00       	push   $0x80
+  802325:	68 78 2b 80 00       	push   $0x802b78
+  80232a:	e8 f0 f3 ff ff       	call   80171f <_panic>
+
+0080232f <ipc_send>:
+{
+  80232f:	55                   	push   %ebp
+  802330:	89 e5                	mov    %esp,%ebp
+  802332:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  802335:	ff 75 14             	push   0x14(%ebp)
+  802338:	6a 01                	push   $0x1
+  80233a:	ff 75 10             	push   0x10(%ebp)
+  80233d:	ff 75 0c             	push   0xc(%ebp)
+  802340:	ff 75 08             	push   0x8(%ebp)
+  802343:	e8 a4 ff ff ff       	call   8022ec <ipc_send_pages>
+}
+  802348:	83 c4 20             	add    $0x20,%esp
+  80234b:	c9                   	leave
+  80234c:	c3                   	ret
+
+0080234d <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80234d:	55                   	push   %ebp
+  80234e:	89 e5                	mov    %esp,%ebp
+  802350:	83 ec 14             	sub    $0x14,%esp
+  802353:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802356:	85 c0                	test   %eax,%eax
+  802358:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80235d:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802360:	ff 75 18             	push   0x18(%ebp)
+  802363:	ff 75 14             	push   0x14(%ebp)
+  802366:	50                   	push   %eax
+  802367:	ff 75 0c             	push   0xc(%ebp)
+  80236a:	ff 75 08             	push   0x8(%ebp)
+  80236d:	e8 a9 e2 ff ff       	call   80061b <sys_ipc_call>
+  802372:	83 c4 20             	add    $0x20,%esp
+  802375:	85 c0                	test   %eax,%eax
+  802377:	78 0b                	js     802384 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  802379:	a1 08 40 80 00       	mov    0x804008,%eax
+  80237e:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802384:	c9                   	leave
+  802385:	c3                   	ret
+
+00802386 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  802386:	55                   	push   %ebp
+  802387:	89 e5                	mov    %esp,%ebp
+  802389:	57                   	push   %edi
+  80238a:	56                   	push   %esi
+  80238b:	53                   	push   %ebx
+  80238c:	83 ec 18             	sub    $0x18,%esp
+  80238f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802392:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  802395:	8b 75 20             	mov    0x20(%ebp),%esi
+  802398:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80239b:	85 c0                	test   %eax,%eax
+  80239d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8023a2:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8023a5:	ff 75 18             	push   0x18(%ebp)
+  8023a8:	ff 75 14             	push   0x14(%ebp)
+  8023ab:	50                   	push   %eax
+  8023ac:	ff 75 0c             	push   0xc(%ebp)
+  8023af:	ff 75 08             	push   0x8(%ebp)
+  8023b2:	e8 a5 e2 ff ff       	call   80065c <sys_ipc_reply_recv>
+  8023b7:	83 c4 20             	add    $0x20,%esp
+  8023ba:	85 c0                	test   %eax,%eax
+  8023bc:	78 46                	js     802404 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8023be:	85 ff                	test   %edi,%edi
+  8023c0:	74 0d                	je     8023cf <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8023c2:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023c7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8023cd:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8023cf:	85 f6                	test   %esi,%esi
+  8023d1:	74 0d                	je     8023e0 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8023d3:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023d8:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8023de:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8023e0:	85 db                	test   %ebx,%ebx
+  8023e2:	74 0d                	je     8023f1 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8023e4:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023e9:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8023ef:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8023f1:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023f6:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8023fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023ff:	5b                   	pop    %ebx
+  802400:	5e                   	pop    %esi
+  802401:	5f                   	pop    %edi
+  802402:	5d                   	pop    %ebp
+  802403:	c3                   	ret
+		if (from_env_store) {
+  802404:	85 ff                	test   %edi,%edi
+  802406:	74 06                	je     80240e <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  802408:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80240e:	85 f6                	test   %esi,%esi
+  802410:	74 06                	je     802418 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  802412:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802418:	85 db                	test   %ebx,%ebx
+  80241a:	74 e0                	je     8023fc <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  80241c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802422:	eb d8                	jmp    8023fc <ipc_reply_recv+0x76>
+
+00802424 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802424:	55                   	push   %ebp
+  802425:	89 e5                	mov    %esp,%ebp
+  802427:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80242a:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80242f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802432:	c1 e0 06             	shl    $0x6,%eax
+  802435:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80243a:	8b 40 50             	mov    0x50(%eax),%eax
+  80243d:	39 c8                	cmp    %ecx,%eax
+  80243f:	74 12                	je     802453 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802441:	83 c2 01             	add    $0x1,%edx
+  802444:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80244a:	75 e3                	jne    80242f <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80244c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802451:	eb 0e                	jmp    802461 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802453:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802456:	c1 e0 06             	shl    $0x6,%eax
+  802459:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80245e:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802461:	5d                   	pop    %ebp
+  802462:	c3                   	ret
+
+00802463 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802463:	55                   	push   %ebp
+  802464:	89 e5                	mov    %esp,%ebp
+  802466:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802469:	89 c2                	mov    %eax,%edx
+  80246b:	c1 ea 16             	shr    $0x16,%edx
+  80246e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802475:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80247a:	f6 c1 01             	test   $0x1,%cl
+  80247d:	74 1e                	je     80249d <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  80247f:	c1 e8 0c             	shr    $0xc,%eax
+  802482:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802489:	a8 01                	test   $0x1,%al
+  80248b:	74 10                	je     80249d <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80248d:	c1 e8 0c             	shr    $0xc,%eax
+  802490:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802493:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  80249a:	0f b7 d2             	movzwl %dx,%edx
+}
+  80249d:	89 d0                	mov    %edx,%eax
+  80249f:	5d                   	pop    %ebp
+  8024a0:	c3                   	ret
+
+008024a1 <udivmod>:
+  8024a1:	55                   	push   %ebp
+  8024a2:	57                   	push   %edi
+  8024a3:	56                   	push   %esi
+  8024a4:	53                   	push   %ebx
+  8024a5:	83 ec 24             	sub    $0x24,%esp
+  8024a8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8024ac:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8024b0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8024b4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8024b8:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024bc:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024c0:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8024c4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024da:	00 
+  8024db:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024e2:	00 
+  8024e3:	89 fb                	mov    %edi,%ebx
+  8024e5:	eb 08                	jmp    8024ef <udivmod+0x4e>
+  8024e7:	83 e9 01             	sub    $0x1,%ecx
+  8024ea:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8024ed:	74 68                	je     802557 <udivmod+0xb6>
+  8024ef:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024f3:	01 c0                	add    %eax,%eax
+  8024f5:	89 c6                	mov    %eax,%esi
+  8024f7:	89 d7                	mov    %edx,%edi
+  8024f9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8024fd:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802501:	0f ad d0             	shrd   %cl,%edx,%eax
+  802504:	d3 ea                	shr    %cl,%edx
+  802506:	f6 c1 20             	test   $0x20,%cl
+  802509:	74 04                	je     80250f <udivmod+0x6e>
+  80250b:	89 d0                	mov    %edx,%eax
+  80250d:	31 d2                	xor    %edx,%edx
+  80250f:	83 e0 01             	and    $0x1,%eax
+  802512:	89 04 24             	mov    %eax,(%esp)
+  802515:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80251c:	00 
+  80251d:	8b 04 24             	mov    (%esp),%eax
+  802520:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802524:	09 f0                	or     %esi,%eax
+  802526:	09 fa                	or     %edi,%edx
+  802528:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80252c:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802530:	39 f0                	cmp    %esi,%eax
+  802532:	89 d5                	mov    %edx,%ebp
+  802534:	19 fd                	sbb    %edi,%ebp
+  802536:	72 af                	jb     8024e7 <udivmod+0x46>
+  802538:	29 f0                	sub    %esi,%eax
+  80253a:	19 fa                	sbb    %edi,%edx
+  80253c:	89 cf                	mov    %ecx,%edi
+  80253e:	c1 ef 05             	shr    $0x5,%edi
+  802541:	83 e7 01             	and    $0x1,%edi
+  802544:	89 fe                	mov    %edi,%esi
+  802546:	83 f6 01             	xor    $0x1,%esi
+  802549:	d3 e6                	shl    %cl,%esi
+  80254b:	d3 e7                	shl    %cl,%edi
+  80254d:	09 74 24 18          	or     %esi,0x18(%esp)
+  802551:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802555:	eb 90                	jmp    8024e7 <udivmod+0x46>
+  802557:	85 db                	test   %ebx,%ebx
+  802559:	74 05                	je     802560 <udivmod+0xbf>
+  80255b:	89 03                	mov    %eax,(%ebx)
+  80255d:	89 53 04             	mov    %edx,0x4(%ebx)
+  802560:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802564:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802568:	83 c4 24             	add    $0x24,%esp
+  80256b:	5b                   	pop    %ebx
+  80256c:	5e                   	pop    %esi
+  80256d:	5f                   	pop    %edi
+  80256e:	5d                   	pop    %ebp
+  80256f:	c3                   	ret
+
+00802570 <__udivdi3>:
+  802570:	83 ec 08             	sub    $0x8,%esp
+  802573:	6a 00                	push   $0x0
+  802575:	ff 74 24 1c          	push   0x1c(%esp)
+  802579:	ff 74 24 1c          	push   0x1c(%esp)
+  80257d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802581:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802585:	e8 17 ff ff ff       	call   8024a1 <udivmod>
+  80258a:	83 c4 14             	add    $0x14,%esp
+  80258d:	c3                   	ret
+
+0080258e <__umoddi3>:
+  80258e:	83 ec 18             	sub    $0x18,%esp
+  802591:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802595:	50                   	push   %eax
+  802596:	ff 74 24 2c          	push   0x2c(%esp)
+  80259a:	ff 74 24 2c          	push   0x2c(%esp)
+  80259e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025a2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025a6:	e8 f6 fe ff ff       	call   8024a1 <udivmod>
+  8025ab:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025af:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025b3:	83 c4 24             	add    $0x24,%esp
+  8025b6:	c3                   	ret
+
+008025b7 <__divdi3>:
+  8025b7:	55                   	push   %ebp
+  8025b8:	57                   	push   %edi
+  8025b9:	56                   	push   %esi
+  8025ba:	53                   	push   %ebx
+  8025bb:	83 ec 10             	sub    $0x10,%esp
+  8025be:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8025c2:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8025c6:	89 c6                	mov    %eax,%esi
+  8025c8:	89 d7                	mov    %edx,%edi
+  8025ca:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8025ce:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8025d2:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025d6:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8025da:	89 c5                	mov    %eax,%ebp
+  8025dc:	f7 dd                	neg    %ebp
+  8025de:	89 d6                	mov    %edx,%esi
+  8025e0:	83 d6 00             	adc    $0x0,%esi
+  8025e3:	f7 de                	neg    %esi
+  8025e5:	0f 48 e8             	cmovs  %eax,%ebp
+  8025e8:	0f 49 d6             	cmovns %esi,%edx
+  8025eb:	6a 00                	push   $0x0
+  8025ed:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8025f1:	f7 de                	neg    %esi
+  8025f3:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8025f7:	83 d0 00             	adc    $0x0,%eax
+  8025fa:	f7 d8                	neg    %eax
+  8025fc:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  802601:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  802606:	50                   	push   %eax
+  802607:	56                   	push   %esi
+  802608:	89 e8                	mov    %ebp,%eax
+  80260a:	e8 92 fe ff ff       	call   8024a1 <udivmod>
+  80260f:	83 c4 10             	add    $0x10,%esp
+  802612:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  802617:	78 08                	js     802621 <__divdi3+0x6a>
+  802619:	83 c4 0c             	add    $0xc,%esp
+  80261c:	5b                   	pop    %ebx
+  80261d:	5e                   	pop    %esi
+  80261e:	5f                   	pop    %edi
+  80261f:	5d                   	pop    %ebp
+  802620:	c3                   	ret
+  802621:	f7 d8                	neg    %eax
+  802623:	83 d2 00             	adc    $0x0,%edx
+  802626:	f7 da                	neg    %edx
+  802628:	eb ef                	jmp    802619 <__divdi3+0x62>
+
+0080262a <__moddi3>:
+  80262a:	55                   	push   %ebp
+  80262b:	57                   	push   %edi
+  80262c:	56                   	push   %esi
+  80262d:	53                   	push   %ebx
+  80262e:	83 ec 18             	sub    $0x18,%esp
+  802631:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802635:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802639:	89 f1                	mov    %esi,%ecx
+  80263b:	f7 d9                	neg    %ecx
+  80263d:	89 da                	mov    %ebx,%edx
+  80263f:	83 d2 00             	adc    $0x0,%edx
+  802642:	f7 da                	neg    %edx
+  802644:	0f 48 ce             	cmovs  %esi,%ecx
+  802647:	0f 48 d3             	cmovs  %ebx,%edx
+  80264a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80264e:	50                   	push   %eax
+  80264f:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802653:	f7 de                	neg    %esi
+  802655:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802659:	83 d0 00             	adc    $0x0,%eax
+  80265c:	f7 d8                	neg    %eax
+  80265e:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802663:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802668:	50                   	push   %eax
+  802669:	56                   	push   %esi
+  80266a:	89 c8                	mov    %ecx,%eax
+  80266c:	e8 30 fe ff ff       	call   8024a1 <udivmod>
+  802671:	83 c4 10             	add    $0x10,%esp
+  802674:	85 db                	test   %ebx,%ebx
+  802676:	78 10                	js     802688 <__moddi3+0x5e>
+  802678:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80267c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802680:	83 c4 14             	add    $0x14,%esp
+  802683:	5b                   	pop    %ebx
+  802684:	5e                   	pop    %esi
+  802685:	5f                   	pop    %edi
+  802686:	5d                   	pop    %ebp
+  802687:	c3                   	ret
+  802688:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80268c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802690:	f7 d8                	neg    %eax
+  802692:	83 d2 00             	adc    $0x0,%edx
+  802695:	f7 da                	neg    %edx
+  802697:	eb e7                	jmp    802680 <__moddi3+0x56>
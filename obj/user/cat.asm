@@ -0,0 +1,5855 @@
+
+obj/user/cat.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 fc 00 00 00       	call   80012d <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <cat>:
+
+char buf[8192];
+
+void
+cat(int f, char *s)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+	long n;
+	int r;
+
+	while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  80003b:	83 ec 04             	sub    $0x4,%esp
+  80003e:	68 00 20 00 00       	push   $0x2000
+  800043:	68 20 40 80 00       	push   $0x804020
+  800048:	56                   	push   %esi
+  800049:	e8 6c 15 00 00       	call   8015ba <read>
+  80004e:	89 c3                	mov    %eax,%ebx
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	7e 2f                	jle    800086 <cat+0x53>
+		if ((r = write(1, buf, n)) != n)
+  800057:	83 ec 04             	sub    $0x4,%esp
+  80005a:	53                   	push   %ebx
+  80005b:	68 20 40 80 00       	push   $0x804020
+  800060:	6a 01                	push   $0x1
+  800062:	e8 21 16 00 00       	call   801688 <write>
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	39 c3                	cmp    %eax,%ebx
+  80006c:	74 cd                	je     80003b <cat+0x8>
+			panic("write error copying %s: %e", s, r);
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	50                   	push   %eax
+  800072:	ff 75 0c             	push   0xc(%ebp)
+  800075:	68 a0 28 80 00       	push   $0x8028a0
+  80007a:	6a 0d                	push   $0xd
+  80007c:	68 bb 28 80 00       	push   $0x8028bb
+  800081:	e8 0a 01 00 00       	call   800190 <_panic>
+	if (n < 0)
+  800086:	78 07                	js     80008f <cat+0x5c>
+		panic("error reading %s: %e", s, n);
+}
+  800088:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008b:	5b                   	pop    %ebx
+  80008c:	5e                   	pop    %esi
+  80008d:	5d                   	pop    %ebp
+  80008e:	c3                   	ret
+		panic("error reading %s: %e", s, n);
+  80008f:	83 ec 0c             	sub    $0xc,%esp
+  800092:	50                   	push   %eax
+  800093:	ff 75 0c             	push   0xc(%ebp)
+  800096:	68 c6 28 80 00       	push   $0x8028c6
+  80009b:	6a 0f                	push   $0xf
+  80009d:	68 bb 28 80 00       	push   $0x8028bb
+  8000a2:	e8 e9 00 00 00       	call   800190 <_panic>
+
+008000a7 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	57                   	push   %edi
+  8000ab:	56                   	push   %esi
+  8000ac:	53                   	push   %ebx
+  8000ad:	83 ec 0c             	sub    $0xc,%esp
+  8000b0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int f, i;
+
+	binaryname = "cat";
+  8000b3:	c7 05 00 30 80 00 db 	movl   $0x8028db,0x803000
+  8000ba:	28 80 00 
+	if (argc == 1)
+		cat(0, "<stdin>");
+	else
+		for (i = 1; i < argc; i++) {
+  8000bd:	be 01 00 00 00       	mov    $0x1,%esi
+	if (argc == 1)
+  8000c2:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8000c6:	75 31                	jne    8000f9 <umain+0x52>
+		cat(0, "<stdin>");
+  8000c8:	83 ec 08             	sub    $0x8,%esp
+  8000cb:	68 df 28 80 00       	push   $0x8028df
+  8000d0:	6a 00                	push   $0x0
+  8000d2:	e8 5c ff ff ff       	call   800033 <cat>
+  8000d7:	83 c4 10             	add    $0x10,%esp
+			else {
+				cat(f, argv[i]);
+				close(f);
+			}
+		}
+}
+  8000da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000dd:	5b                   	pop    %ebx
+  8000de:	5e                   	pop    %esi
+  8000df:	5f                   	pop    %edi
+  8000e0:	5d                   	pop    %ebp
+  8000e1:	c3                   	ret
+				printf("can't open %s: %e\n", argv[i], f);
+  8000e2:	83 ec 04             	sub    $0x4,%esp
+  8000e5:	50                   	push   %eax
+  8000e6:	ff 34 b7             	push   (%edi,%esi,4)
+  8000e9:	68 e7 28 80 00       	push   $0x8028e7
+  8000ee:	e8 68 1c 00 00       	call   801d5b <printf>
+  8000f3:	83 c4 10             	add    $0x10,%esp
+		for (i = 1; i < argc; i++) {
+  8000f6:	83 c6 01             	add    $0x1,%esi
+  8000f9:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8000fc:	7d dc                	jge    8000da <umain+0x33>
+			f = open(argv[i], O_RDONLY);
+  8000fe:	83 ec 08             	sub    $0x8,%esp
+  800101:	6a 00                	push   $0x0
+  800103:	ff 34 b7             	push   (%edi,%esi,4)
+  800106:	e8 ea 19 00 00       	call   801af5 <open>
+  80010b:	89 c3                	mov    %eax,%ebx
+			if (f < 0)
+  80010d:	83 c4 10             	add    $0x10,%esp
+  800110:	85 c0                	test   %eax,%eax
+  800112:	78 ce                	js     8000e2 <umain+0x3b>
+				cat(f, argv[i]);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	ff 34 b7             	push   (%edi,%esi,4)
+  80011a:	50                   	push   %eax
+  80011b:	e8 13 ff ff ff       	call   800033 <cat>
+				close(f);
+  800120:	89 1c 24             	mov    %ebx,(%esp)
+  800123:	e8 56 13 00 00       	call   80147e <close>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	eb c9                	jmp    8000f6 <umain+0x4f>
+
+0080012d <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	56                   	push   %esi
+  800131:	53                   	push   %ebx
+  800132:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800135:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800138:	e8 ca 0b 00 00       	call   800d07 <sys_getenvid>
+  80013d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800142:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800145:	c1 e0 06             	shl    $0x6,%eax
+  800148:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80014d:	a3 24 60 80 00       	mov    %eax,0x806024
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800152:	85 db                	test   %ebx,%ebx
+  800154:	7e 07                	jle    80015d <libmain+0x30>
+		binaryname = argv[0];
+  800156:	8b 06                	mov    (%esi),%eax
+  800158:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80015d:	83 ec 08             	sub    $0x8,%esp
+  800160:	56                   	push   %esi
+  800161:	53                   	push   %ebx
+  800162:	e8 40 ff ff ff       	call   8000a7 <umain>
+
+	// exit gracefully
+	exit();
+  800167:	e8 0a 00 00 00       	call   800176 <exit>
+}
+  80016c:	83 c4 10             	add    $0x10,%esp
+  80016f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800172:	5b                   	pop    %ebx
+  800173:	5e                   	pop    %esi
+  800174:	5d                   	pop    %ebp
+  800175:	c3                   	ret
+
+00800176 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800176:	55                   	push   %ebp
+  800177:	89 e5                	mov    %esp,%ebp
+  800179:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80017c:	e8 2a 13 00 00       	call   8014ab <close_all>
+	sys_env_destroy(0);
+  800181:	83 ec 0c             	sub    $0xc,%esp
+  800184:	6a 00                	push   $0x0
+  800186:	e8 3b 0b 00 00       	call   800cc6 <sys_env_destroy>
+}
+  80018b:	83 c4 10             	add    $0x10,%esp
+  80018e:	c9                   	leave
+  80018f:	c3                   	ret
+
+00800190 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800190:	55                   	push   %ebp
+  800191:	89 e5                	mov    %esp,%ebp
+  800193:	56                   	push   %esi
+  800194:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800195:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800198:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80019e:	e8 64 0b 00 00       	call   800d07 <sys_getenvid>
+  8001a3:	83 ec 0c             	sub    $0xc,%esp
+  8001a6:	ff 75 0c             	push   0xc(%ebp)
+  8001a9:	ff 75 08             	push   0x8(%ebp)
+  8001ac:	56                   	push   %esi
+  8001ad:	50                   	push   %eax
+  8001ae:	68 04 29 80 00       	push   $0x802904
+  8001b3:	e8 b3 00 00 00       	call   80026b <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001b8:	83 c4 18             	add    $0x18,%esp
+  8001bb:	53                   	push   %ebx
+  8001bc:	ff 75 10             	push   0x10(%ebp)
+  8001bf:	e8 56 00 00 00       	call   80021a <vcprintf>
+	cprintf("\n");
+  8001c4:	c7 04 24 6f 2d 80 00 	movl   $0x802d6f,(%esp)
+  8001cb:	e8 9b 00 00 00       	call   80026b <cprintf>
+  8001d0:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001d3:	cc                   	int3
+	while (1)
+  8001d4:	eb fd                	jmp    8001d3 <_panic+0x43>
+
+008001d6 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001d6:	55                   	push   %ebp
+  8001d7:	89 e5                	mov    %esp,%ebp
+  8001d9:	53                   	push   %ebx
+  8001da:	83 ec 04             	sub    $0x4,%esp
+  8001dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001e0:	8b 13                	mov    (%ebx),%edx
+  8001e2:	8d 42 01             	lea    0x1(%edx),%eax
+  8001e5:	89 03                	mov    %eax,(%ebx)
+  8001e7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001ea:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001ee:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001f3:	74 09                	je     8001fe <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001f5:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001fc:	c9                   	leave
+  8001fd:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001fe:	83 ec 08             	sub    $0x8,%esp
+  800201:	68 ff 00 00 00       	push   $0xff
+  800206:	8d 43 08             	lea    0x8(%ebx),%eax
+  800209:	50                   	push   %eax
+  80020a:	e8 69 0a 00 00       	call   800c78 <sys_cputs>
+		b->idx = 0;
+  80020f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800215:	83 c4 10             	add    $0x10,%esp
+  800218:	eb db                	jmp    8001f5 <putch+0x1f>
+
+0080021a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80021a:	55                   	push   %ebp
+  80021b:	89 e5                	mov    %esp,%ebp
+  80021d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800223:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80022a:	00 00 00 
+	b.cnt = 0;
+  80022d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800234:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800237:	ff 75 0c             	push   0xc(%ebp)
+  80023a:	ff 75 08             	push   0x8(%ebp)
+  80023d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800243:	50                   	push   %eax
+  800244:	68 d6 01 80 00       	push   $0x8001d6
+  800249:	e8 14 01 00 00       	call   800362 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80024e:	83 c4 08             	add    $0x8,%esp
+  800251:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800257:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80025d:	50                   	push   %eax
+  80025e:	e8 15 0a 00 00       	call   800c78 <sys_cputs>
+
+	return b.cnt;
+}
+  800263:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800269:	c9                   	leave
+  80026a:	c3                   	ret
+
+0080026b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80026b:	55                   	push   %ebp
+  80026c:	89 e5                	mov    %esp,%ebp
+  80026e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800271:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800274:	50                   	push   %eax
+  800275:	ff 75 08             	push   0x8(%ebp)
+  800278:	e8 9d ff ff ff       	call   80021a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80027d:	c9                   	leave
+  80027e:	c3                   	ret
+
+0080027f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80027f:	55                   	push   %ebp
+  800280:	89 e5                	mov    %esp,%ebp
+  800282:	57                   	push   %edi
+  800283:	56                   	push   %esi
+  800284:	53                   	push   %ebx
+  800285:	83 ec 1c             	sub    $0x1c,%esp
+  800288:	89 c7                	mov    %eax,%edi
+  80028a:	89 d6                	mov    %edx,%esi
+  80028c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800292:	89 d1                	mov    %edx,%ecx
+  800294:	89 c2                	mov    %eax,%edx
+  800296:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800299:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80029c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80029f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002a2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002a5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002ac:	39 c2                	cmp    %eax,%edx
+  8002ae:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002b1:	72 3e                	jb     8002f1 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002b3:	83 ec 0c             	sub    $0xc,%esp
+  8002b6:	ff 75 18             	push   0x18(%ebp)
+  8002b9:	83 eb 01             	sub    $0x1,%ebx
+  8002bc:	53                   	push   %ebx
+  8002bd:	50                   	push   %eax
+  8002be:	83 ec 08             	sub    $0x8,%esp
+  8002c1:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c4:	ff 75 e0             	push   -0x20(%ebp)
+  8002c7:	ff 75 dc             	push   -0x24(%ebp)
+  8002ca:	ff 75 d8             	push   -0x28(%ebp)
+  8002cd:	e8 91 24 00 00       	call   802763 <__udivdi3>
+  8002d2:	83 c4 18             	add    $0x18,%esp
+  8002d5:	52                   	push   %edx
+  8002d6:	50                   	push   %eax
+  8002d7:	89 f2                	mov    %esi,%edx
+  8002d9:	89 f8                	mov    %edi,%eax
+  8002db:	e8 9f ff ff ff       	call   80027f <printnum>
+  8002e0:	83 c4 20             	add    $0x20,%esp
+  8002e3:	eb 13                	jmp    8002f8 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002e5:	83 ec 08             	sub    $0x8,%esp
+  8002e8:	56                   	push   %esi
+  8002e9:	ff 75 18             	push   0x18(%ebp)
+  8002ec:	ff d7                	call   *%edi
+  8002ee:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002f1:	83 eb 01             	sub    $0x1,%ebx
+  8002f4:	85 db                	test   %ebx,%ebx
+  8002f6:	7f ed                	jg     8002e5 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002f8:	83 ec 08             	sub    $0x8,%esp
+  8002fb:	56                   	push   %esi
+  8002fc:	83 ec 04             	sub    $0x4,%esp
+  8002ff:	ff 75 e4             	push   -0x1c(%ebp)
+  800302:	ff 75 e0             	push   -0x20(%ebp)
+  800305:	ff 75 dc             	push   -0x24(%ebp)
+  800308:	ff 75 d8             	push   -0x28(%ebp)
+  80030b:	e8 71 24 00 00       	call   802781 <__umoddi3>
+  800310:	83 c4 14             	add    $0x14,%esp
+  800313:	0f be 80 27 29 80 00 	movsbl 0x802927(%eax),%eax
+  80031a:	50                   	push   %eax
+  80031b:	ff d7                	call   *%edi
+}
+  80031d:	83 c4 10             	add    $0x10,%esp
+  800320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800323:	5b                   	pop    %ebx
+  800324:	5e                   	pop    %esi
+  800325:	5f                   	pop    %edi
+  800326:	5d                   	pop    %ebp
+  800327:	c3                   	ret
+
+00800328 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800328:	55                   	push   %ebp
+  800329:	89 e5                	mov    %esp,%ebp
+  80032b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80032e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800332:	8b 10                	mov    (%eax),%edx
+  800334:	3b 50 04             	cmp    0x4(%eax),%edx
+  800337:	73 0a                	jae    800343 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800339:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80033c:	89 08                	mov    %ecx,(%eax)
+  80033e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800341:	88 02                	mov    %al,(%edx)
+}
+  800343:	5d                   	pop    %ebp
+  800344:	c3                   	ret
+
+00800345 <printfmt>:
+{
+  800345:	55                   	push   %ebp
+  800346:	89 e5                	mov    %esp,%ebp
+  800348:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80034b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80034e:	50                   	push   %eax
+  80034f:	ff 75 10             	push   0x10(%ebp)
+  800352:	ff 75 0c             	push   0xc(%ebp)
+  800355:	ff 75 08             	push   0x8(%ebp)
+  800358:	e8 05 00 00 00       	call   800362 <vprintfmt>
+}
+  80035d:	83 c4 10             	add    $0x10,%esp
+  800360:	c9                   	leave
+  800361:	c3                   	ret
+
+00800362 <vprintfmt>:
+{
+  800362:	55                   	push   %ebp
+  800363:	89 e5                	mov    %esp,%ebp
+  800365:	57                   	push   %edi
+  800366:	56                   	push   %esi
+  800367:	53                   	push   %ebx
+  800368:	83 ec 2c             	sub    $0x2c,%esp
+  80036b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80036e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800371:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800374:	eb 0a                	jmp    800380 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800376:	83 ec 08             	sub    $0x8,%esp
+  800379:	53                   	push   %ebx
+  80037a:	50                   	push   %eax
+  80037b:	ff d6                	call   *%esi
+  80037d:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800380:	83 c7 01             	add    $0x1,%edi
+  800383:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800387:	83 f8 25             	cmp    $0x25,%eax
+  80038a:	74 0c                	je     800398 <vprintfmt+0x36>
+			if (ch == '\0')
+  80038c:	85 c0                	test   %eax,%eax
+  80038e:	75 e6                	jne    800376 <vprintfmt+0x14>
+}
+  800390:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800393:	5b                   	pop    %ebx
+  800394:	5e                   	pop    %esi
+  800395:	5f                   	pop    %edi
+  800396:	5d                   	pop    %ebp
+  800397:	c3                   	ret
+		padc = ' ';
+  800398:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80039c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003a3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003aa:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b6:	8d 47 01             	lea    0x1(%edi),%eax
+  8003b9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003bc:	0f b6 17             	movzbl (%edi),%edx
+  8003bf:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003c2:	3c 55                	cmp    $0x55,%al
+  8003c4:	0f 87 c5 03 00 00    	ja     80078f <vprintfmt+0x42d>
+  8003ca:	0f b6 c0             	movzbl %al,%eax
+  8003cd:	ff 24 85 a0 2a 80 00 	jmp    *0x802aa0(,%eax,4)
+  8003d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003d7:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003db:	eb d9                	jmp    8003b6 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003dd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003e0:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003e4:	eb d0                	jmp    8003b6 <vprintfmt+0x54>
+  8003e6:	0f b6 d2             	movzbl %dl,%edx
+  8003e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f1:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003f4:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003f7:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003fb:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003fe:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800401:	83 f9 09             	cmp    $0x9,%ecx
+  800404:	77 55                	ja     80045b <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800406:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800409:	eb e9                	jmp    8003f4 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80040b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040e:	8b 00                	mov    (%eax),%eax
+  800410:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800413:	8b 45 14             	mov    0x14(%ebp),%eax
+  800416:	8d 40 04             	lea    0x4(%eax),%eax
+  800419:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80041c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80041f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800423:	79 91                	jns    8003b6 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800425:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800428:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80042b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800432:	eb 82                	jmp    8003b6 <vprintfmt+0x54>
+			if (width < 0)
+  800434:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800437:	85 d2                	test   %edx,%edx
+  800439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043e:	0f 49 c2             	cmovns %edx,%eax
+  800441:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800444:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800447:	e9 6a ff ff ff       	jmp    8003b6 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80044c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80044f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800456:	e9 5b ff ff ff       	jmp    8003b6 <vprintfmt+0x54>
+  80045b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80045e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800461:	eb bc                	jmp    80041f <vprintfmt+0xbd>
+			lflag++;
+  800463:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800466:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800469:	e9 48 ff ff ff       	jmp    8003b6 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80046e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800471:	8d 78 04             	lea    0x4(%eax),%edi
+  800474:	83 ec 08             	sub    $0x8,%esp
+  800477:	53                   	push   %ebx
+  800478:	ff 30                	push   (%eax)
+  80047a:	ff d6                	call   *%esi
+			break;
+  80047c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80047f:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800482:	e9 63 02 00 00       	jmp    8006ea <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800487:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048a:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80048d:	8b 10                	mov    (%eax),%edx
+  80048f:	89 d0                	mov    %edx,%eax
+  800491:	f7 d8                	neg    %eax
+  800493:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800496:	83 f8 12             	cmp    $0x12,%eax
+  800499:	7f 23                	jg     8004be <vprintfmt+0x15c>
+  80049b:	8b 14 85 00 2c 80 00 	mov    0x802c00(,%eax,4),%edx
+  8004a2:	85 d2                	test   %edx,%edx
+  8004a4:	74 18                	je     8004be <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004a6:	52                   	push   %edx
+  8004a7:	68 3d 2d 80 00       	push   $0x802d3d
+  8004ac:	53                   	push   %ebx
+  8004ad:	56                   	push   %esi
+  8004ae:	e8 92 fe ff ff       	call   800345 <printfmt>
+  8004b3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004b6:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004b9:	e9 2c 02 00 00       	jmp    8006ea <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  8004be:	50                   	push   %eax
+  8004bf:	68 3f 29 80 00       	push   $0x80293f
+  8004c4:	53                   	push   %ebx
+  8004c5:	56                   	push   %esi
+  8004c6:	e8 7a fe ff ff       	call   800345 <printfmt>
+  8004cb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004ce:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004d1:	e9 14 02 00 00       	jmp    8006ea <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d9:	83 c0 04             	add    $0x4,%eax
+  8004dc:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e2:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004e4:	85 c9                	test   %ecx,%ecx
+  8004e6:	b8 38 29 80 00       	mov    $0x802938,%eax
+  8004eb:	0f 45 c1             	cmovne %ecx,%eax
+  8004ee:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004f1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004f5:	7e 06                	jle    8004fd <vprintfmt+0x19b>
+  8004f7:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004fb:	75 0b                	jne    800508 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004fd:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800500:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800503:	89 75 08             	mov    %esi,0x8(%ebp)
+  800506:	eb 5c                	jmp    800564 <vprintfmt+0x202>
+  800508:	83 ec 08             	sub    $0x8,%esp
+  80050b:	ff 75 d0             	push   -0x30(%ebp)
+  80050e:	ff 75 cc             	push   -0x34(%ebp)
+  800511:	e8 19 03 00 00       	call   80082f <strnlen>
+  800516:	89 c2                	mov    %eax,%edx
+  800518:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80051b:	29 d0                	sub    %edx,%eax
+  80051d:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800520:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800524:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800527:	89 75 08             	mov    %esi,0x8(%ebp)
+  80052a:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80052c:	eb 0e                	jmp    80053c <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80052e:	83 ec 08             	sub    $0x8,%esp
+  800531:	53                   	push   %ebx
+  800532:	57                   	push   %edi
+  800533:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800536:	83 ee 01             	sub    $0x1,%esi
+  800539:	83 c4 10             	add    $0x10,%esp
+  80053c:	85 f6                	test   %esi,%esi
+  80053e:	7f ee                	jg     80052e <vprintfmt+0x1cc>
+  800540:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800543:	8b 75 08             	mov    0x8(%ebp),%esi
+  800546:	85 c0                	test   %eax,%eax
+  800548:	ba 00 00 00 00       	mov    $0x0,%edx
+  80054d:	0f 49 d0             	cmovns %eax,%edx
+  800550:	29 d0                	sub    %edx,%eax
+  800552:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800555:	eb a6                	jmp    8004fd <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800557:	83 ec 08             	sub    $0x8,%esp
+  80055a:	53                   	push   %ebx
+  80055b:	52                   	push   %edx
+  80055c:	ff 55 08             	call   *0x8(%ebp)
+  80055f:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800562:	89 f1                	mov    %esi,%ecx
+  800564:	8d 71 01             	lea    0x1(%ecx),%esi
+  800567:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80056b:	0f be d0             	movsbl %al,%edx
+  80056e:	85 d2                	test   %edx,%edx
+  800570:	74 28                	je     80059a <vprintfmt+0x238>
+  800572:	85 ff                	test   %edi,%edi
+  800574:	78 05                	js     80057b <vprintfmt+0x219>
+  800576:	83 ef 01             	sub    $0x1,%edi
+  800579:	78 30                	js     8005ab <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80057b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80057f:	74 d6                	je     800557 <vprintfmt+0x1f5>
+  800581:	0f be c0             	movsbl %al,%eax
+  800584:	83 e8 20             	sub    $0x20,%eax
+  800587:	83 f8 5e             	cmp    $0x5e,%eax
+  80058a:	76 cb                	jbe    800557 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80058c:	83 ec 08             	sub    $0x8,%esp
+  80058f:	53                   	push   %ebx
+  800590:	6a 3f                	push   $0x3f
+  800592:	ff 55 08             	call   *0x8(%ebp)
+  800595:	83 c4 10             	add    $0x10,%esp
+  800598:	eb c8                	jmp    800562 <vprintfmt+0x200>
+  80059a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80059d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005a0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005a3:	01 d0                	add    %edx,%eax
+  8005a5:	29 c8                	sub    %ecx,%eax
+  8005a7:	89 c7                	mov    %eax,%edi
+  8005a9:	eb 13                	jmp    8005be <vprintfmt+0x25c>
+  8005ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ae:	eb ed                	jmp    80059d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005b0:	83 ec 08             	sub    $0x8,%esp
+  8005b3:	53                   	push   %ebx
+  8005b4:	6a 20                	push   $0x20
+  8005b6:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005b8:	83 ef 01             	sub    $0x1,%edi
+  8005bb:	83 c4 10             	add    $0x10,%esp
+  8005be:	85 ff                	test   %edi,%edi
+  8005c0:	7f ee                	jg     8005b0 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005c2:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005c5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c8:	e9 1d 01 00 00       	jmp    8006ea <vprintfmt+0x388>
+	if (lflag >= 2)
+  8005cd:	83 f9 01             	cmp    $0x1,%ecx
+  8005d0:	7f 1b                	jg     8005ed <vprintfmt+0x28b>
+	else if (lflag)
+  8005d2:	85 c9                	test   %ecx,%ecx
+  8005d4:	74 63                	je     800639 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  8005d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d9:	8b 00                	mov    (%eax),%eax
+  8005db:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005de:	99                   	cltd
+  8005df:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005eb:	eb 17                	jmp    800604 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  8005ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f0:	8b 50 04             	mov    0x4(%eax),%edx
+  8005f3:	8b 00                	mov    (%eax),%eax
+  8005f5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fe:	8d 40 08             	lea    0x8(%eax),%eax
+  800601:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800604:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800607:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80060a:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80060f:	85 c9                	test   %ecx,%ecx
+  800611:	0f 89 b9 00 00 00    	jns    8006d0 <vprintfmt+0x36e>
+				putch('-', putdat);
+  800617:	83 ec 08             	sub    $0x8,%esp
+  80061a:	53                   	push   %ebx
+  80061b:	6a 2d                	push   $0x2d
+  80061d:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80061f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800622:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800625:	f7 da                	neg    %edx
+  800627:	83 d1 00             	adc    $0x0,%ecx
+  80062a:	f7 d9                	neg    %ecx
+  80062c:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80062f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800634:	e9 97 00 00 00       	jmp    8006d0 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800639:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063c:	8b 00                	mov    (%eax),%eax
+  80063e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800641:	99                   	cltd
+  800642:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800645:	8b 45 14             	mov    0x14(%ebp),%eax
+  800648:	8d 40 04             	lea    0x4(%eax),%eax
+  80064b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80064e:	eb b4                	jmp    800604 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  800650:	83 f9 01             	cmp    $0x1,%ecx
+  800653:	7f 1b                	jg     800670 <vprintfmt+0x30e>
+	else if (lflag)
+  800655:	85 c9                	test   %ecx,%ecx
+  800657:	74 2c                	je     800685 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800659:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065c:	8b 10                	mov    (%eax),%edx
+  80065e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800663:	8d 40 04             	lea    0x4(%eax),%eax
+  800666:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800669:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80066e:	eb 60                	jmp    8006d0 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800670:	8b 45 14             	mov    0x14(%ebp),%eax
+  800673:	8b 10                	mov    (%eax),%edx
+  800675:	8b 48 04             	mov    0x4(%eax),%ecx
+  800678:	8d 40 08             	lea    0x8(%eax),%eax
+  80067b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80067e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800683:	eb 4b                	jmp    8006d0 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800685:	8b 45 14             	mov    0x14(%ebp),%eax
+  800688:	8b 10                	mov    (%eax),%edx
+  80068a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068f:	8d 40 04             	lea    0x4(%eax),%eax
+  800692:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800695:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80069a:	eb 34                	jmp    8006d0 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80069c:	83 f9 01             	cmp    $0x1,%ecx
+  80069f:	7f 15                	jg     8006b6 <vprintfmt+0x354>
+	else if (lflag)
+  8006a1:	85 c9                	test   %ecx,%ecx
+  8006a3:	74 4d                	je     8006f2 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8006a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a8:	8b 00                	mov    (%eax),%eax
+  8006aa:	99                   	cltd
+  8006ab:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006ae:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8006b1:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8006b4:	eb 11                	jmp    8006c7 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  8006b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b9:	8b 50 04             	mov    0x4(%eax),%edx
+  8006bc:	8b 00                	mov    (%eax),%eax
+  8006be:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006c1:	8d 49 08             	lea    0x8(%ecx),%ecx
+  8006c4:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  8006c7:	89 d1                	mov    %edx,%ecx
+  8006c9:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  8006cb:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006d0:	83 ec 0c             	sub    $0xc,%esp
+  8006d3:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006d7:	50                   	push   %eax
+  8006d8:	ff 75 e0             	push   -0x20(%ebp)
+  8006db:	57                   	push   %edi
+  8006dc:	51                   	push   %ecx
+  8006dd:	52                   	push   %edx
+  8006de:	89 da                	mov    %ebx,%edx
+  8006e0:	89 f0                	mov    %esi,%eax
+  8006e2:	e8 98 fb ff ff       	call   80027f <printnum>
+			break;
+  8006e7:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006ed:	e9 8e fc ff ff       	jmp    800380 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  8006f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f5:	8b 00                	mov    (%eax),%eax
+  8006f7:	99                   	cltd
+  8006f8:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006fb:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8006fe:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800701:	eb c4                	jmp    8006c7 <vprintfmt+0x365>
+			putch('0', putdat);
+  800703:	83 ec 08             	sub    $0x8,%esp
+  800706:	53                   	push   %ebx
+  800707:	6a 30                	push   $0x30
+  800709:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80070b:	83 c4 08             	add    $0x8,%esp
+  80070e:	53                   	push   %ebx
+  80070f:	6a 78                	push   $0x78
+  800711:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800713:	8b 45 14             	mov    0x14(%ebp),%eax
+  800716:	8b 10                	mov    (%eax),%edx
+  800718:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80071d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800720:	8d 40 04             	lea    0x4(%eax),%eax
+  800723:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800726:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  80072b:	eb a3                	jmp    8006d0 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80072d:	83 f9 01             	cmp    $0x1,%ecx
+  800730:	7f 1b                	jg     80074d <vprintfmt+0x3eb>
+	else if (lflag)
+  800732:	85 c9                	test   %ecx,%ecx
+  800734:	74 2f                	je     800765 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800736:	8b 45 14             	mov    0x14(%ebp),%eax
+  800739:	8b 10                	mov    (%eax),%edx
+  80073b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800740:	8d 40 04             	lea    0x4(%eax),%eax
+  800743:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800746:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80074b:	eb 83                	jmp    8006d0 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80074d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800750:	8b 10                	mov    (%eax),%edx
+  800752:	8b 48 04             	mov    0x4(%eax),%ecx
+  800755:	8d 40 08             	lea    0x8(%eax),%eax
+  800758:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80075b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800760:	e9 6b ff ff ff       	jmp    8006d0 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800765:	8b 45 14             	mov    0x14(%ebp),%eax
+  800768:	8b 10                	mov    (%eax),%edx
+  80076a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076f:	8d 40 04             	lea    0x4(%eax),%eax
+  800772:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800775:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80077a:	e9 51 ff ff ff       	jmp    8006d0 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  80077f:	83 ec 08             	sub    $0x8,%esp
+  800782:	53                   	push   %ebx
+  800783:	6a 25                	push   $0x25
+  800785:	ff d6                	call   *%esi
+			break;
+  800787:	83 c4 10             	add    $0x10,%esp
+  80078a:	e9 5b ff ff ff       	jmp    8006ea <vprintfmt+0x388>
+			putch('%', putdat);
+  80078f:	83 ec 08             	sub    $0x8,%esp
+  800792:	53                   	push   %ebx
+  800793:	6a 25                	push   $0x25
+  800795:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800797:	83 c4 10             	add    $0x10,%esp
+  80079a:	89 f8                	mov    %edi,%eax
+  80079c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007a0:	74 05                	je     8007a7 <vprintfmt+0x445>
+  8007a2:	83 e8 01             	sub    $0x1,%eax
+  8007a5:	eb f5                	jmp    80079c <vprintfmt+0x43a>
+  8007a7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007aa:	e9 3b ff ff ff       	jmp    8006ea <vprintfmt+0x388>
+
+008007af <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007af:	55                   	push   %ebp
+  8007b0:	89 e5                	mov    %esp,%ebp
+  8007b2:	83 ec 18             	sub    $0x18,%esp
+  8007b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007bb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007be:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007c2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007c5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007cc:	85 c0                	test   %eax,%eax
+  8007ce:	74 26                	je     8007f6 <vsnprintf+0x47>
+  8007d0:	85 d2                	test   %edx,%edx
+  8007d2:	7e 22                	jle    8007f6 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007d4:	ff 75 14             	push   0x14(%ebp)
+  8007d7:	ff 75 10             	push   0x10(%ebp)
+  8007da:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007dd:	50                   	push   %eax
+  8007de:	68 28 03 80 00       	push   $0x800328
+  8007e3:	e8 7a fb ff ff       	call   800362 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007e8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007eb:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007f1:	83 c4 10             	add    $0x10,%esp
+}
+  8007f4:	c9                   	leave
+  8007f5:	c3                   	ret
+		return -E_INVAL;
+  8007f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007fb:	eb f7                	jmp    8007f4 <vsnprintf+0x45>
+
+008007fd <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007fd:	55                   	push   %ebp
+  8007fe:	89 e5                	mov    %esp,%ebp
+  800800:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800803:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800806:	50                   	push   %eax
+  800807:	ff 75 10             	push   0x10(%ebp)
+  80080a:	ff 75 0c             	push   0xc(%ebp)
+  80080d:	ff 75 08             	push   0x8(%ebp)
+  800810:	e8 9a ff ff ff       	call   8007af <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800815:	c9                   	leave
+  800816:	c3                   	ret
+
+00800817 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800817:	55                   	push   %ebp
+  800818:	89 e5                	mov    %esp,%ebp
+  80081a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80081d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800822:	eb 03                	jmp    800827 <strlen+0x10>
+		n++;
+  800824:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800827:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80082b:	75 f7                	jne    800824 <strlen+0xd>
+	return n;
+}
+  80082d:	5d                   	pop    %ebp
+  80082e:	c3                   	ret
+
+0080082f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80082f:	55                   	push   %ebp
+  800830:	89 e5                	mov    %esp,%ebp
+  800832:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800835:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800838:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083d:	eb 03                	jmp    800842 <strnlen+0x13>
+		n++;
+  80083f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800842:	39 d0                	cmp    %edx,%eax
+  800844:	74 08                	je     80084e <strnlen+0x1f>
+  800846:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80084a:	75 f3                	jne    80083f <strnlen+0x10>
+  80084c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80084e:	89 d0                	mov    %edx,%eax
+  800850:	5d                   	pop    %ebp
+  800851:	c3                   	ret
+
+00800852 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800852:	55                   	push   %ebp
+  800853:	89 e5                	mov    %esp,%ebp
+  800855:	53                   	push   %ebx
+  800856:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800859:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80085c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800861:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800865:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800868:	83 c0 01             	add    $0x1,%eax
+  80086b:	84 d2                	test   %dl,%dl
+  80086d:	75 f2                	jne    800861 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80086f:	89 c8                	mov    %ecx,%eax
+  800871:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800874:	c9                   	leave
+  800875:	c3                   	ret
+
+00800876 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800876:	55                   	push   %ebp
+  800877:	89 e5                	mov    %esp,%ebp
+  800879:	53                   	push   %ebx
+  80087a:	83 ec 10             	sub    $0x10,%esp
+  80087d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800880:	53                   	push   %ebx
+  800881:	e8 91 ff ff ff       	call   800817 <strlen>
+  800886:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800889:	ff 75 0c             	push   0xc(%ebp)
+  80088c:	01 d8                	add    %ebx,%eax
+  80088e:	50                   	push   %eax
+  80088f:	e8 be ff ff ff       	call   800852 <strcpy>
+	return dst;
+}
+  800894:	89 d8                	mov    %ebx,%eax
+  800896:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800899:	c9                   	leave
+  80089a:	c3                   	ret
+
+0080089b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80089b:	55                   	push   %ebp
+  80089c:	89 e5                	mov    %esp,%ebp
+  80089e:	56                   	push   %esi
+  80089f:	53                   	push   %ebx
+  8008a0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008a6:	89 f3                	mov    %esi,%ebx
+  8008a8:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008ab:	89 f0                	mov    %esi,%eax
+  8008ad:	eb 0f                	jmp    8008be <strncpy+0x23>
+		*dst++ = *src;
+  8008af:	83 c0 01             	add    $0x1,%eax
+  8008b2:	0f b6 0a             	movzbl (%edx),%ecx
+  8008b5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008b8:	80 f9 01             	cmp    $0x1,%cl
+  8008bb:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008be:	39 d8                	cmp    %ebx,%eax
+  8008c0:	75 ed                	jne    8008af <strncpy+0x14>
+	}
+	return ret;
+}
+  8008c2:	89 f0                	mov    %esi,%eax
+  8008c4:	5b                   	pop    %ebx
+  8008c5:	5e                   	pop    %esi
+  8008c6:	5d                   	pop    %ebp
+  8008c7:	c3                   	ret
+
+008008c8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008c8:	55                   	push   %ebp
+  8008c9:	89 e5                	mov    %esp,%ebp
+  8008cb:	56                   	push   %esi
+  8008cc:	53                   	push   %ebx
+  8008cd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008d3:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008d6:	89 f0                	mov    %esi,%eax
+  8008d8:	85 d2                	test   %edx,%edx
+  8008da:	74 21                	je     8008fd <strlcpy+0x35>
+  8008dc:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008e0:	89 f2                	mov    %esi,%edx
+  8008e2:	eb 09                	jmp    8008ed <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008e4:	83 c1 01             	add    $0x1,%ecx
+  8008e7:	83 c2 01             	add    $0x1,%edx
+  8008ea:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008ed:	39 c2                	cmp    %eax,%edx
+  8008ef:	74 09                	je     8008fa <strlcpy+0x32>
+  8008f1:	0f b6 19             	movzbl (%ecx),%ebx
+  8008f4:	84 db                	test   %bl,%bl
+  8008f6:	75 ec                	jne    8008e4 <strlcpy+0x1c>
+  8008f8:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008fa:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008fd:	29 f0                	sub    %esi,%eax
+}
+  8008ff:	5b                   	pop    %ebx
+  800900:	5e                   	pop    %esi
+  800901:	5d                   	pop    %ebp
+  800902:	c3                   	ret
+
+00800903 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800903:	55                   	push   %ebp
+  800904:	89 e5                	mov    %esp,%ebp
+  800906:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800909:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80090c:	eb 06                	jmp    800914 <strcmp+0x11>
+		p++, q++;
+  80090e:	83 c1 01             	add    $0x1,%ecx
+  800911:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800914:	0f b6 01             	movzbl (%ecx),%eax
+  800917:	84 c0                	test   %al,%al
+  800919:	74 04                	je     80091f <strcmp+0x1c>
+  80091b:	3a 02                	cmp    (%edx),%al
+  80091d:	74 ef                	je     80090e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80091f:	0f b6 c0             	movzbl %al,%eax
+  800922:	0f b6 12             	movzbl (%edx),%edx
+  800925:	29 d0                	sub    %edx,%eax
+}
+  800927:	5d                   	pop    %ebp
+  800928:	c3                   	ret
+
+00800929 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800929:	55                   	push   %ebp
+  80092a:	89 e5                	mov    %esp,%ebp
+  80092c:	53                   	push   %ebx
+  80092d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800930:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800933:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800936:	eb 09                	jmp    800941 <strncmp+0x18>
+		n--, p++, q++;
+  800938:	83 ea 01             	sub    $0x1,%edx
+  80093b:	83 c0 01             	add    $0x1,%eax
+  80093e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800941:	85 d2                	test   %edx,%edx
+  800943:	74 18                	je     80095d <strncmp+0x34>
+  800945:	0f b6 18             	movzbl (%eax),%ebx
+  800948:	84 db                	test   %bl,%bl
+  80094a:	74 04                	je     800950 <strncmp+0x27>
+  80094c:	3a 19                	cmp    (%ecx),%bl
+  80094e:	74 e8                	je     800938 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800950:	0f b6 00             	movzbl (%eax),%eax
+  800953:	0f b6 11             	movzbl (%ecx),%edx
+  800956:	29 d0                	sub    %edx,%eax
+}
+  800958:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80095b:	c9                   	leave
+  80095c:	c3                   	ret
+		return 0;
+  80095d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800962:	eb f4                	jmp    800958 <strncmp+0x2f>
+
+00800964 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800964:	55                   	push   %ebp
+  800965:	89 e5                	mov    %esp,%ebp
+  800967:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80096e:	eb 03                	jmp    800973 <strchr+0xf>
+  800970:	83 c0 01             	add    $0x1,%eax
+  800973:	0f b6 10             	movzbl (%eax),%edx
+  800976:	84 d2                	test   %dl,%dl
+  800978:	74 06                	je     800980 <strchr+0x1c>
+		if (*s == c)
+  80097a:	38 ca                	cmp    %cl,%dl
+  80097c:	75 f2                	jne    800970 <strchr+0xc>
+  80097e:	eb 05                	jmp    800985 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800980:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800985:	5d                   	pop    %ebp
+  800986:	c3                   	ret
+
+00800987 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800987:	55                   	push   %ebp
+  800988:	89 e5                	mov    %esp,%ebp
+  80098a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800991:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800994:	38 ca                	cmp    %cl,%dl
+  800996:	74 09                	je     8009a1 <strfind+0x1a>
+  800998:	84 d2                	test   %dl,%dl
+  80099a:	74 05                	je     8009a1 <strfind+0x1a>
+	for (; *s; s++)
+  80099c:	83 c0 01             	add    $0x1,%eax
+  80099f:	eb f0                	jmp    800991 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009a1:	5d                   	pop    %ebp
+  8009a2:	c3                   	ret
+
+008009a3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009a3:	55                   	push   %ebp
+  8009a4:	89 e5                	mov    %esp,%ebp
+  8009a6:	57                   	push   %edi
+  8009a7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009aa:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009ad:	85 c9                	test   %ecx,%ecx
+  8009af:	74 20                	je     8009d1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009b1:	89 f8                	mov    %edi,%eax
+  8009b3:	09 c8                	or     %ecx,%eax
+  8009b5:	a8 03                	test   $0x3,%al
+  8009b7:	75 12                	jne    8009cb <memset+0x28>
+		c &= 0xFF;
+  8009b9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009bd:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009c3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009c6:	fc                   	cld
+  8009c7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009c9:	eb 06                	jmp    8009d1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009ce:	fc                   	cld
+  8009cf:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009d1:	89 f8                	mov    %edi,%eax
+  8009d3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009d6:	c9                   	leave
+  8009d7:	c3                   	ret
+
+008009d8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009d8:	55                   	push   %ebp
+  8009d9:	89 e5                	mov    %esp,%ebp
+  8009db:	57                   	push   %edi
+  8009dc:	56                   	push   %esi
+  8009dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009e3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009e6:	39 c6                	cmp    %eax,%esi
+  8009e8:	73 32                	jae    800a1c <memmove+0x44>
+  8009ea:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009ed:	39 d0                	cmp    %edx,%eax
+  8009ef:	73 2b                	jae    800a1c <memmove+0x44>
+		s += n;
+		d += n;
+  8009f1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009f4:	89 d6                	mov    %edx,%esi
+  8009f6:	09 fe                	or     %edi,%esi
+  8009f8:	09 ce                	or     %ecx,%esi
+  8009fa:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a00:	75 0e                	jne    800a10 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a02:	83 ef 04             	sub    $0x4,%edi
+  800a05:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a08:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a0b:	fd                   	std
+  800a0c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a0e:	eb 09                	jmp    800a19 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a10:	83 ef 01             	sub    $0x1,%edi
+  800a13:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a16:	fd                   	std
+  800a17:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a19:	fc                   	cld
+  800a1a:	eb 1a                	jmp    800a36 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a1c:	89 f2                	mov    %esi,%edx
+  800a1e:	09 c2                	or     %eax,%edx
+  800a20:	09 ca                	or     %ecx,%edx
+  800a22:	f6 c2 03             	test   $0x3,%dl
+  800a25:	75 0a                	jne    800a31 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a27:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a2a:	89 c7                	mov    %eax,%edi
+  800a2c:	fc                   	cld
+  800a2d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a2f:	eb 05                	jmp    800a36 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a31:	89 c7                	mov    %eax,%edi
+  800a33:	fc                   	cld
+  800a34:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a36:	5e                   	pop    %esi
+  800a37:	5f                   	pop    %edi
+  800a38:	5d                   	pop    %ebp
+  800a39:	c3                   	ret
+
+00800a3a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a3a:	55                   	push   %ebp
+  800a3b:	89 e5                	mov    %esp,%ebp
+  800a3d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a40:	ff 75 10             	push   0x10(%ebp)
+  800a43:	ff 75 0c             	push   0xc(%ebp)
+  800a46:	ff 75 08             	push   0x8(%ebp)
+  800a49:	e8 8a ff ff ff       	call   8009d8 <memmove>
+}
+  800a4e:	c9                   	leave
+  800a4f:	c3                   	ret
+
+00800a50 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a50:	55                   	push   %ebp
+  800a51:	89 e5                	mov    %esp,%ebp
+  800a53:	56                   	push   %esi
+  800a54:	53                   	push   %ebx
+  800a55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a58:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a5b:	89 c6                	mov    %eax,%esi
+  800a5d:	03 75 10             	add    0x10(%ebp),%esi
+  800a60:	eb 06                	jmp    800a68 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a62:	83 c0 01             	add    $0x1,%eax
+  800a65:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a68:	39 f0                	cmp    %esi,%eax
+  800a6a:	74 14                	je     800a80 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a6c:	0f b6 08             	movzbl (%eax),%ecx
+  800a6f:	0f b6 1a             	movzbl (%edx),%ebx
+  800a72:	38 d9                	cmp    %bl,%cl
+  800a74:	74 ec                	je     800a62 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a76:	0f b6 c1             	movzbl %cl,%eax
+  800a79:	0f b6 db             	movzbl %bl,%ebx
+  800a7c:	29 d8                	sub    %ebx,%eax
+  800a7e:	eb 05                	jmp    800a85 <memcmp+0x35>
+	}
+
+	return 0;
+  800a80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a85:	5b                   	pop    %ebx
+  800a86:	5e                   	pop    %esi
+  800a87:	5d                   	pop    %ebp
+  800a88:	c3                   	ret
+
+00800a89 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a89:	55                   	push   %ebp
+  800a8a:	89 e5                	mov    %esp,%ebp
+  800a8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a92:	89 c2                	mov    %eax,%edx
+  800a94:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a97:	eb 03                	jmp    800a9c <memfind+0x13>
+  800a99:	83 c0 01             	add    $0x1,%eax
+  800a9c:	39 d0                	cmp    %edx,%eax
+  800a9e:	73 04                	jae    800aa4 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800aa0:	38 08                	cmp    %cl,(%eax)
+  800aa2:	75 f5                	jne    800a99 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800aa4:	5d                   	pop    %ebp
+  800aa5:	c3                   	ret
+
+00800aa6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800aa6:	55                   	push   %ebp
+  800aa7:	89 e5                	mov    %esp,%ebp
+  800aa9:	57                   	push   %edi
+  800aaa:	56                   	push   %esi
+  800aab:	53                   	push   %ebx
+  800aac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aaf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ab2:	eb 03                	jmp    800ab7 <strtol+0x11>
+		s++;
+  800ab4:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800ab7:	0f b6 02             	movzbl (%edx),%eax
+  800aba:	3c 20                	cmp    $0x20,%al
+  800abc:	74 f6                	je     800ab4 <strtol+0xe>
+  800abe:	3c 09                	cmp    $0x9,%al
+  800ac0:	74 f2                	je     800ab4 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ac2:	3c 2b                	cmp    $0x2b,%al
+  800ac4:	74 2a                	je     800af0 <strtol+0x4a>
+	int neg = 0;
+  800ac6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800acb:	3c 2d                	cmp    $0x2d,%al
+  800acd:	74 2b                	je     800afa <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800acf:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ad5:	75 0f                	jne    800ae6 <strtol+0x40>
+  800ad7:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ada:	74 28                	je     800b04 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800adc:	85 db                	test   %ebx,%ebx
+  800ade:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ae3:	0f 44 d8             	cmove  %eax,%ebx
+  800ae6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aeb:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800aee:	eb 46                	jmp    800b36 <strtol+0x90>
+		s++;
+  800af0:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800af3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800af8:	eb d5                	jmp    800acf <strtol+0x29>
+		s++, neg = 1;
+  800afa:	83 c2 01             	add    $0x1,%edx
+  800afd:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b02:	eb cb                	jmp    800acf <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b04:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b08:	74 0e                	je     800b18 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b0a:	85 db                	test   %ebx,%ebx
+  800b0c:	75 d8                	jne    800ae6 <strtol+0x40>
+		s++, base = 8;
+  800b0e:	83 c2 01             	add    $0x1,%edx
+  800b11:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b16:	eb ce                	jmp    800ae6 <strtol+0x40>
+		s += 2, base = 16;
+  800b18:	83 c2 02             	add    $0x2,%edx
+  800b1b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b20:	eb c4                	jmp    800ae6 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b22:	0f be c0             	movsbl %al,%eax
+  800b25:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b28:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b2b:	7d 3a                	jge    800b67 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b2d:	83 c2 01             	add    $0x1,%edx
+  800b30:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b34:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b36:	0f b6 02             	movzbl (%edx),%eax
+  800b39:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b3c:	89 f3                	mov    %esi,%ebx
+  800b3e:	80 fb 09             	cmp    $0x9,%bl
+  800b41:	76 df                	jbe    800b22 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b43:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b46:	89 f3                	mov    %esi,%ebx
+  800b48:	80 fb 19             	cmp    $0x19,%bl
+  800b4b:	77 08                	ja     800b55 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b4d:	0f be c0             	movsbl %al,%eax
+  800b50:	83 e8 57             	sub    $0x57,%eax
+  800b53:	eb d3                	jmp    800b28 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b55:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b58:	89 f3                	mov    %esi,%ebx
+  800b5a:	80 fb 19             	cmp    $0x19,%bl
+  800b5d:	77 08                	ja     800b67 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b5f:	0f be c0             	movsbl %al,%eax
+  800b62:	83 e8 37             	sub    $0x37,%eax
+  800b65:	eb c1                	jmp    800b28 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b67:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b6b:	74 05                	je     800b72 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b70:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b72:	89 c8                	mov    %ecx,%eax
+  800b74:	f7 d8                	neg    %eax
+  800b76:	85 ff                	test   %edi,%edi
+  800b78:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b7b:	89 c8                	mov    %ecx,%eax
+  800b7d:	5b                   	pop    %ebx
+  800b7e:	5e                   	pop    %esi
+  800b7f:	5f                   	pop    %edi
+  800b80:	5d                   	pop    %ebp
+  800b81:	c3                   	ret
+
+00800b82 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	57                   	push   %edi
+  800b86:	56                   	push   %esi
+  800b87:	53                   	push   %ebx
+  800b88:	83 ec 0c             	sub    $0xc,%esp
+  800b8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b8e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b91:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800b94:	85 ff                	test   %edi,%edi
+  800b96:	74 16                	je     800bae <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800b98:	83 ec 04             	sub    $0x4,%esp
+  800b9b:	56                   	push   %esi
+  800b9c:	6a 00                	push   $0x0
+  800b9e:	53                   	push   %ebx
+  800b9f:	e8 02 ff ff ff       	call   800aa6 <strtol>
+  800ba4:	89 07                	mov    %eax,(%edi)
+  800ba6:	83 c4 10             	add    $0x10,%esp
+  800ba9:	eb 03                	jmp    800bae <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800bab:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800bae:	0f b6 03             	movzbl (%ebx),%eax
+  800bb1:	3c 20                	cmp    $0x20,%al
+  800bb3:	74 f6                	je     800bab <strisl+0x29>
+  800bb5:	3c 09                	cmp    $0x9,%al
+  800bb7:	74 f2                	je     800bab <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bb9:	3c 2b                	cmp    $0x2b,%al
+  800bbb:	74 23                	je     800be0 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800bbd:	3c 2d                	cmp    $0x2d,%al
+  800bbf:	0f 94 c0             	sete   %al
+  800bc2:	0f b6 c0             	movzbl %al,%eax
+  800bc5:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bc7:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800bcd:	75 41                	jne    800c10 <strisl+0x8e>
+  800bcf:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800bd2:	74 11                	je     800be5 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bd4:	85 f6                	test   %esi,%esi
+  800bd6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bdb:	0f 44 f0             	cmove  %eax,%esi
+  800bde:	eb 30                	jmp    800c10 <strisl+0x8e>
+		s++;
+  800be0:	83 c3 01             	add    $0x1,%ebx
+  800be3:	eb e2                	jmp    800bc7 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800be5:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800be9:	74 0e                	je     800bf9 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800beb:	85 f6                	test   %esi,%esi
+  800bed:	75 21                	jne    800c10 <strisl+0x8e>
+		s++, base = 8;
+  800bef:	83 c3 01             	add    $0x1,%ebx
+  800bf2:	be 08 00 00 00       	mov    $0x8,%esi
+  800bf7:	eb 17                	jmp    800c10 <strisl+0x8e>
+		s += 2, base = 16;
+  800bf9:	83 c3 02             	add    $0x2,%ebx
+  800bfc:	be 10 00 00 00       	mov    $0x10,%esi
+  800c01:	eb 0d                	jmp    800c10 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c03:	0f be c0             	movsbl %al,%eax
+  800c06:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800c09:	39 f0                	cmp    %esi,%eax
+  800c0b:	7d 38                	jge    800c45 <strisl+0xc3>
+			return 0;
+		s++;
+  800c0d:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800c10:	0f b6 03             	movzbl (%ebx),%eax
+  800c13:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800c16:	80 fa 09             	cmp    $0x9,%dl
+  800c19:	76 e8                	jbe    800c03 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800c1b:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800c1e:	80 fa 19             	cmp    $0x19,%dl
+  800c21:	77 08                	ja     800c2b <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800c23:	0f be c0             	movsbl %al,%eax
+  800c26:	83 e8 57             	sub    $0x57,%eax
+  800c29:	eb de                	jmp    800c09 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c2b:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800c2e:	80 fa 19             	cmp    $0x19,%dl
+  800c31:	77 08                	ja     800c3b <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800c33:	0f be c0             	movsbl %al,%eax
+  800c36:	83 e8 37             	sub    $0x37,%eax
+  800c39:	eb ce                	jmp    800c09 <strisl+0x87>
+		else if (!*s)
+  800c3b:	84 c0                	test   %al,%al
+  800c3d:	0f 94 c0             	sete   %al
+  800c40:	0f b6 c0             	movzbl %al,%eax
+  800c43:	eb 05                	jmp    800c4a <strisl+0xc8>
+			return 0;
+  800c45:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800c4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c4d:	5b                   	pop    %ebx
+  800c4e:	5e                   	pop    %esi
+  800c4f:	5f                   	pop    %edi
+  800c50:	5d                   	pop    %ebp
+  800c51:	c3                   	ret
+
+00800c52 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800c52:	55                   	push   %ebp
+  800c53:	89 e5                	mov    %esp,%ebp
+  800c55:	83 ec 10             	sub    $0x10,%esp
+  800c58:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c5b:	89 c8                	mov    %ecx,%eax
+  800c5d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800c62:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800c65:	eb 0b                	jmp    800c72 <touch_mem+0x20>
+		c = *(char *)page;
+  800c67:	0f b6 10             	movzbl (%eax),%edx
+  800c6a:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c6d:	05 00 10 00 00       	add    $0x1000,%eax
+  800c72:	39 c8                	cmp    %ecx,%eax
+  800c74:	72 f1                	jb     800c67 <touch_mem+0x15>
+}
+  800c76:	c9                   	leave
+  800c77:	c3                   	ret
+
+00800c78 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c78:	55                   	push   %ebp
+  800c79:	89 e5                	mov    %esp,%ebp
+  800c7b:	57                   	push   %edi
+  800c7c:	56                   	push   %esi
+  800c7d:	53                   	push   %ebx
+	touch_mem(s, len);
+  800c7e:	ff 75 0c             	push   0xc(%ebp)
+  800c81:	ff 75 08             	push   0x8(%ebp)
+  800c84:	e8 c9 ff ff ff       	call   800c52 <touch_mem>
+	asm volatile("int %1\n"
+  800c89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c94:	89 c3                	mov    %eax,%ebx
+  800c96:	89 c7                	mov    %eax,%edi
+  800c98:	89 c6                	mov    %eax,%esi
+  800c9a:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c9c:	83 c4 08             	add    $0x8,%esp
+  800c9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca2:	5b                   	pop    %ebx
+  800ca3:	5e                   	pop    %esi
+  800ca4:	5f                   	pop    %edi
+  800ca5:	5d                   	pop    %ebp
+  800ca6:	c3                   	ret
+
+00800ca7 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ca7:	55                   	push   %ebp
+  800ca8:	89 e5                	mov    %esp,%ebp
+  800caa:	57                   	push   %edi
+  800cab:	56                   	push   %esi
+  800cac:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cad:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb2:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cb7:	89 d1                	mov    %edx,%ecx
+  800cb9:	89 d3                	mov    %edx,%ebx
+  800cbb:	89 d7                	mov    %edx,%edi
+  800cbd:	89 d6                	mov    %edx,%esi
+  800cbf:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cc1:	5b                   	pop    %ebx
+  800cc2:	5e                   	pop    %esi
+  800cc3:	5f                   	pop    %edi
+  800cc4:	5d                   	pop    %ebp
+  800cc5:	c3                   	ret
+
+00800cc6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800cc6:	55                   	push   %ebp
+  800cc7:	89 e5                	mov    %esp,%ebp
+  800cc9:	57                   	push   %edi
+  800cca:	56                   	push   %esi
+  800ccb:	53                   	push   %ebx
+  800ccc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ccf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd7:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cdc:	89 cb                	mov    %ecx,%ebx
+  800cde:	89 cf                	mov    %ecx,%edi
+  800ce0:	89 ce                	mov    %ecx,%esi
+  800ce2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ce4:	85 c0                	test   %eax,%eax
+  800ce6:	7f 08                	jg     800cf0 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ce8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ceb:	5b                   	pop    %ebx
+  800cec:	5e                   	pop    %esi
+  800ced:	5f                   	pop    %edi
+  800cee:	5d                   	pop    %ebp
+  800cef:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf0:	83 ec 0c             	sub    $0xc,%esp
+  800cf3:	50                   	push   %eax
+  800cf4:	6a 03                	push   $0x3
+  800cf6:	68 6b 2c 80 00       	push   $0x802c6b
+  800cfb:	6a 23                	push   $0x23
+  800cfd:	68 88 2c 80 00       	push   $0x802c88
+  800d02:	e8 89 f4 ff ff       	call   800190 <_panic>
+
+00800d07 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d07:	55                   	push   %ebp
+  800d08:	89 e5                	mov    %esp,%ebp
+  800d0a:	57                   	push   %edi
+  800d0b:	56                   	push   %esi
+  800d0c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d12:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d17:	89 d1                	mov    %edx,%ecx
+  800d19:	89 d3                	mov    %edx,%ebx
+  800d1b:	89 d7                	mov    %edx,%edi
+  800d1d:	89 d6                	mov    %edx,%esi
+  800d1f:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d21:	5b                   	pop    %ebx
+  800d22:	5e                   	pop    %esi
+  800d23:	5f                   	pop    %edi
+  800d24:	5d                   	pop    %ebp
+  800d25:	c3                   	ret
+
+00800d26 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d26:	55                   	push   %ebp
+  800d27:	89 e5                	mov    %esp,%ebp
+  800d29:	57                   	push   %edi
+  800d2a:	56                   	push   %esi
+  800d2b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d31:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d36:	89 d1                	mov    %edx,%ecx
+  800d38:	89 d3                	mov    %edx,%ebx
+  800d3a:	89 d7                	mov    %edx,%edi
+  800d3c:	89 d6                	mov    %edx,%esi
+  800d3e:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d40:	5b                   	pop    %ebx
+  800d41:	5e                   	pop    %esi
+  800d42:	5f                   	pop    %edi
+  800d43:	5d                   	pop    %ebp
+  800d44:	c3                   	ret
+
+00800d45 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d45:	55                   	push   %ebp
+  800d46:	89 e5                	mov    %esp,%ebp
+  800d48:	57                   	push   %edi
+  800d49:	56                   	push   %esi
+  800d4a:	53                   	push   %ebx
+  800d4b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d4e:	be 00 00 00 00       	mov    $0x0,%esi
+  800d53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d59:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d61:	89 f7                	mov    %esi,%edi
+  800d63:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d65:	85 c0                	test   %eax,%eax
+  800d67:	7f 08                	jg     800d71 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6c:	5b                   	pop    %ebx
+  800d6d:	5e                   	pop    %esi
+  800d6e:	5f                   	pop    %edi
+  800d6f:	5d                   	pop    %ebp
+  800d70:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d71:	83 ec 0c             	sub    $0xc,%esp
+  800d74:	50                   	push   %eax
+  800d75:	6a 04                	push   $0x4
+  800d77:	68 6b 2c 80 00       	push   $0x802c6b
+  800d7c:	6a 23                	push   $0x23
+  800d7e:	68 88 2c 80 00       	push   $0x802c88
+  800d83:	e8 08 f4 ff ff       	call   800190 <_panic>
+
+00800d88 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d88:	55                   	push   %ebp
+  800d89:	89 e5                	mov    %esp,%ebp
+  800d8b:	57                   	push   %edi
+  800d8c:	56                   	push   %esi
+  800d8d:	53                   	push   %ebx
+  800d8e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d97:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d9f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800da2:	8b 75 18             	mov    0x18(%ebp),%esi
+  800da5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800da7:	85 c0                	test   %eax,%eax
+  800da9:	7f 08                	jg     800db3 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800dab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dae:	5b                   	pop    %ebx
+  800daf:	5e                   	pop    %esi
+  800db0:	5f                   	pop    %edi
+  800db1:	5d                   	pop    %ebp
+  800db2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db3:	83 ec 0c             	sub    $0xc,%esp
+  800db6:	50                   	push   %eax
+  800db7:	6a 05                	push   $0x5
+  800db9:	68 6b 2c 80 00       	push   $0x802c6b
+  800dbe:	6a 23                	push   $0x23
+  800dc0:	68 88 2c 80 00       	push   $0x802c88
+  800dc5:	e8 c6 f3 ff ff       	call   800190 <_panic>
+
+00800dca <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dca:	55                   	push   %ebp
+  800dcb:	89 e5                	mov    %esp,%ebp
+  800dcd:	57                   	push   %edi
+  800dce:	56                   	push   %esi
+  800dcf:	53                   	push   %ebx
+  800dd0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dde:	b8 06 00 00 00       	mov    $0x6,%eax
+  800de3:	89 df                	mov    %ebx,%edi
+  800de5:	89 de                	mov    %ebx,%esi
+  800de7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de9:	85 c0                	test   %eax,%eax
+  800deb:	7f 08                	jg     800df5 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ded:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df0:	5b                   	pop    %ebx
+  800df1:	5e                   	pop    %esi
+  800df2:	5f                   	pop    %edi
+  800df3:	5d                   	pop    %ebp
+  800df4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df5:	83 ec 0c             	sub    $0xc,%esp
+  800df8:	50                   	push   %eax
+  800df9:	6a 06                	push   $0x6
+  800dfb:	68 6b 2c 80 00       	push   $0x802c6b
+  800e00:	6a 23                	push   $0x23
+  800e02:	68 88 2c 80 00       	push   $0x802c88
+  800e07:	e8 84 f3 ff ff       	call   800190 <_panic>
+
+00800e0c <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800e0c:	55                   	push   %ebp
+  800e0d:	89 e5                	mov    %esp,%ebp
+  800e0f:	57                   	push   %edi
+  800e10:	56                   	push   %esi
+  800e11:	53                   	push   %ebx
+  800e12:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e20:	b8 18 00 00 00       	mov    $0x18,%eax
+  800e25:	89 df                	mov    %ebx,%edi
+  800e27:	89 de                	mov    %ebx,%esi
+  800e29:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e2b:	85 c0                	test   %eax,%eax
+  800e2d:	7f 08                	jg     800e37 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e32:	5b                   	pop    %ebx
+  800e33:	5e                   	pop    %esi
+  800e34:	5f                   	pop    %edi
+  800e35:	5d                   	pop    %ebp
+  800e36:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e37:	83 ec 0c             	sub    $0xc,%esp
+  800e3a:	50                   	push   %eax
+  800e3b:	6a 18                	push   $0x18
+  800e3d:	68 6b 2c 80 00       	push   $0x802c6b
+  800e42:	6a 23                	push   $0x23
+  800e44:	68 88 2c 80 00       	push   $0x802c88
+  800e49:	e8 42 f3 ff ff       	call   800190 <_panic>
+
+00800e4e <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800e4e:	55                   	push   %ebp
+  800e4f:	89 e5                	mov    %esp,%ebp
+  800e51:	57                   	push   %edi
+  800e52:	56                   	push   %esi
+  800e53:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e54:	be 00 00 00 00       	mov    $0x0,%esi
+  800e59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5f:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e67:	89 f7                	mov    %esi,%edi
+  800e69:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800e6b:	5b                   	pop    %ebx
+  800e6c:	5e                   	pop    %esi
+  800e6d:	5f                   	pop    %edi
+  800e6e:	5d                   	pop    %ebp
+  800e6f:	c3                   	ret
+
+00800e70 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800e70:	55                   	push   %ebp
+  800e71:	89 e5                	mov    %esp,%ebp
+  800e73:	57                   	push   %edi
+  800e74:	56                   	push   %esi
+  800e75:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e81:	be 00 00 00 00       	mov    $0x0,%esi
+  800e86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e89:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e8c:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e8e:	5b                   	pop    %ebx
+  800e8f:	5e                   	pop    %esi
+  800e90:	5f                   	pop    %edi
+  800e91:	5d                   	pop    %ebp
+  800e92:	c3                   	ret
+
+00800e93 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e93:	55                   	push   %ebp
+  800e94:	89 e5                	mov    %esp,%ebp
+  800e96:	57                   	push   %edi
+  800e97:	56                   	push   %esi
+  800e98:	53                   	push   %ebx
+  800e99:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800e9c:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800e9f:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800ea5:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800ea8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eae:	b8 10 00 00 00       	mov    $0x10,%eax
+  800eb3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eb6:	8b 75 18             	mov    0x18(%ebp),%esi
+  800eb9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ebb:	85 c0                	test   %eax,%eax
+  800ebd:	7f 08                	jg     800ec7 <sys_page_map_range+0x34>
+}
+  800ebf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec2:	5b                   	pop    %ebx
+  800ec3:	5e                   	pop    %esi
+  800ec4:	5f                   	pop    %edi
+  800ec5:	5d                   	pop    %ebp
+  800ec6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec7:	83 ec 0c             	sub    $0xc,%esp
+  800eca:	50                   	push   %eax
+  800ecb:	6a 10                	push   $0x10
+  800ecd:	68 6b 2c 80 00       	push   $0x802c6b
+  800ed2:	6a 23                	push   $0x23
+  800ed4:	68 88 2c 80 00       	push   $0x802c88
+  800ed9:	e8 b2 f2 ff ff       	call   800190 <_panic>
+
+00800ede <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800ede:	55                   	push   %ebp
+  800edf:	89 e5                	mov    %esp,%ebp
+  800ee1:	57                   	push   %edi
+  800ee2:	56                   	push   %esi
+  800ee3:	53                   	push   %ebx
+  800ee4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ee7:	be 00 00 00 00       	mov    $0x0,%esi
+  800eec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef2:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ef7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800efa:	89 f7                	mov    %esi,%edi
+  800efc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800efe:	85 c0                	test   %eax,%eax
+  800f00:	7f 08                	jg     800f0a <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f05:	5b                   	pop    %ebx
+  800f06:	5e                   	pop    %esi
+  800f07:	5f                   	pop    %edi
+  800f08:	5d                   	pop    %ebp
+  800f09:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0a:	83 ec 0c             	sub    $0xc,%esp
+  800f0d:	50                   	push   %eax
+  800f0e:	6a 11                	push   $0x11
+  800f10:	68 6b 2c 80 00       	push   $0x802c6b
+  800f15:	6a 23                	push   $0x23
+  800f17:	68 88 2c 80 00       	push   $0x802c88
+  800f1c:	e8 6f f2 ff ff       	call   800190 <_panic>
+
+00800f21 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800f21:	55                   	push   %ebp
+  800f22:	89 e5                	mov    %esp,%ebp
+  800f24:	57                   	push   %edi
+  800f25:	56                   	push   %esi
+  800f26:	53                   	push   %ebx
+  800f27:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f2a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f35:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800f3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f3d:	89 f7                	mov    %esi,%edi
+  800f3f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f41:	85 c0                	test   %eax,%eax
+  800f43:	7f 08                	jg     800f4d <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f48:	5b                   	pop    %ebx
+  800f49:	5e                   	pop    %esi
+  800f4a:	5f                   	pop    %edi
+  800f4b:	5d                   	pop    %ebp
+  800f4c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f4d:	83 ec 0c             	sub    $0xc,%esp
+  800f50:	50                   	push   %eax
+  800f51:	6a 1b                	push   $0x1b
+  800f53:	68 6b 2c 80 00       	push   $0x802c6b
+  800f58:	6a 23                	push   $0x23
+  800f5a:	68 88 2c 80 00       	push   $0x802c88
+  800f5f:	e8 2c f2 ff ff       	call   800190 <_panic>
+
+00800f64 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800f64:	55                   	push   %ebp
+  800f65:	89 e5                	mov    %esp,%ebp
+  800f67:	57                   	push   %edi
+  800f68:	56                   	push   %esi
+  800f69:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6f:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f74:	89 d1                	mov    %edx,%ecx
+  800f76:	89 d3                	mov    %edx,%ebx
+  800f78:	89 d7                	mov    %edx,%edi
+  800f7a:	89 d6                	mov    %edx,%esi
+  800f7c:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f7e:	5b                   	pop    %ebx
+  800f7f:	5e                   	pop    %esi
+  800f80:	5f                   	pop    %edi
+  800f81:	5d                   	pop    %ebp
+  800f82:	c3                   	ret
+
+00800f83 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	57                   	push   %edi
+  800f87:	56                   	push   %esi
+  800f88:	53                   	push   %ebx
+  800f89:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f97:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f9c:	89 df                	mov    %ebx,%edi
+  800f9e:	89 de                	mov    %ebx,%esi
+  800fa0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa2:	85 c0                	test   %eax,%eax
+  800fa4:	7f 08                	jg     800fae <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800fa6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa9:	5b                   	pop    %ebx
+  800faa:	5e                   	pop    %esi
+  800fab:	5f                   	pop    %edi
+  800fac:	5d                   	pop    %ebp
+  800fad:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fae:	83 ec 0c             	sub    $0xc,%esp
+  800fb1:	50                   	push   %eax
+  800fb2:	6a 08                	push   $0x8
+  800fb4:	68 6b 2c 80 00       	push   $0x802c6b
+  800fb9:	6a 23                	push   $0x23
+  800fbb:	68 88 2c 80 00       	push   $0x802c88
+  800fc0:	e8 cb f1 ff ff       	call   800190 <_panic>
+
+00800fc5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fc5:	55                   	push   %ebp
+  800fc6:	89 e5                	mov    %esp,%ebp
+  800fc8:	57                   	push   %edi
+  800fc9:	56                   	push   %esi
+  800fca:	53                   	push   %ebx
+  800fcb:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800fce:	6a 44                	push   $0x44
+  800fd0:	ff 75 0c             	push   0xc(%ebp)
+  800fd3:	e8 7a fc ff ff       	call   800c52 <touch_mem>
+	asm volatile("int %1\n"
+  800fd8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe0:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fe5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe8:	89 df                	mov    %ebx,%edi
+  800fea:	89 de                	mov    %ebx,%esi
+  800fec:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fee:	83 c4 08             	add    $0x8,%esp
+  800ff1:	85 c0                	test   %eax,%eax
+  800ff3:	7f 08                	jg     800ffd <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ff5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff8:	5b                   	pop    %ebx
+  800ff9:	5e                   	pop    %esi
+  800ffa:	5f                   	pop    %edi
+  800ffb:	5d                   	pop    %ebp
+  800ffc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ffd:	83 ec 0c             	sub    $0xc,%esp
+  801000:	50                   	push   %eax
+  801001:	6a 09                	push   $0x9
+  801003:	68 6b 2c 80 00       	push   $0x802c6b
+  801008:	6a 23                	push   $0x23
+  80100a:	68 88 2c 80 00       	push   $0x802c88
+  80100f:	e8 7c f1 ff ff       	call   800190 <_panic>
+
+00801014 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  801014:	55                   	push   %ebp
+  801015:	89 e5                	mov    %esp,%ebp
+  801017:	57                   	push   %edi
+  801018:	56                   	push   %esi
+  801019:	53                   	push   %ebx
+  80101a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80101d:	be 00 00 00 00       	mov    $0x0,%esi
+  801022:	8b 55 08             	mov    0x8(%ebp),%edx
+  801025:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801028:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80102d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801030:	89 f7                	mov    %esi,%edi
+  801032:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801034:	85 c0                	test   %eax,%eax
+  801036:	7f 08                	jg     801040 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  801038:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103b:	5b                   	pop    %ebx
+  80103c:	5e                   	pop    %esi
+  80103d:	5f                   	pop    %edi
+  80103e:	5d                   	pop    %ebp
+  80103f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801040:	83 ec 0c             	sub    $0xc,%esp
+  801043:	50                   	push   %eax
+  801044:	6a 1a                	push   $0x1a
+  801046:	68 6b 2c 80 00       	push   $0x802c6b
+  80104b:	6a 23                	push   $0x23
+  80104d:	68 88 2c 80 00       	push   $0x802c88
+  801052:	e8 39 f1 ff ff       	call   800190 <_panic>
+
+00801057 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  801057:	55                   	push   %ebp
+  801058:	89 e5                	mov    %esp,%ebp
+  80105a:	57                   	push   %edi
+  80105b:	56                   	push   %esi
+  80105c:	53                   	push   %ebx
+  80105d:	83 ec 0c             	sub    $0xc,%esp
+  801060:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801063:	89 d8                	mov    %ebx,%eax
+  801065:	c1 e0 05             	shl    $0x5,%eax
+  801068:	50                   	push   %eax
+  801069:	ff 75 0c             	push   0xc(%ebp)
+  80106c:	e8 e1 fb ff ff       	call   800c52 <touch_mem>
+	asm volatile("int %1\n"
+  801071:	be 00 00 00 00       	mov    $0x0,%esi
+  801076:	8b 55 08             	mov    0x8(%ebp),%edx
+  801079:	b8 13 00 00 00       	mov    $0x13,%eax
+  80107e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801081:	89 f7                	mov    %esi,%edi
+  801083:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801085:	83 c4 08             	add    $0x8,%esp
+  801088:	85 c0                	test   %eax,%eax
+  80108a:	7f 08                	jg     801094 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  80108c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108f:	5b                   	pop    %ebx
+  801090:	5e                   	pop    %esi
+  801091:	5f                   	pop    %edi
+  801092:	5d                   	pop    %ebp
+  801093:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801094:	83 ec 0c             	sub    $0xc,%esp
+  801097:	50                   	push   %eax
+  801098:	6a 13                	push   $0x13
+  80109a:	68 6b 2c 80 00       	push   $0x802c6b
+  80109f:	6a 23                	push   $0x23
+  8010a1:	68 88 2c 80 00       	push   $0x802c88
+  8010a6:	e8 e5 f0 ff ff       	call   800190 <_panic>
+
+008010ab <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010ab:	55                   	push   %ebp
+  8010ac:	89 e5                	mov    %esp,%ebp
+  8010ae:	57                   	push   %edi
+  8010af:	56                   	push   %esi
+  8010b0:	53                   	push   %ebx
+  8010b1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010c4:	89 df                	mov    %ebx,%edi
+  8010c6:	89 de                	mov    %ebx,%esi
+  8010c8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ca:	85 c0                	test   %eax,%eax
+  8010cc:	7f 08                	jg     8010d6 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d1:	5b                   	pop    %ebx
+  8010d2:	5e                   	pop    %esi
+  8010d3:	5f                   	pop    %edi
+  8010d4:	5d                   	pop    %ebp
+  8010d5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d6:	83 ec 0c             	sub    $0xc,%esp
+  8010d9:	50                   	push   %eax
+  8010da:	6a 0a                	push   $0xa
+  8010dc:	68 6b 2c 80 00       	push   $0x802c6b
+  8010e1:	6a 23                	push   $0x23
+  8010e3:	68 88 2c 80 00       	push   $0x802c88
+  8010e8:	e8 a3 f0 ff ff       	call   800190 <_panic>
+
+008010ed <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010ed:	55                   	push   %ebp
+  8010ee:	89 e5                	mov    %esp,%ebp
+  8010f0:	57                   	push   %edi
+  8010f1:	56                   	push   %esi
+  8010f2:	53                   	push   %ebx
+  8010f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  8010f6:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010fc:	76 1d                	jbe    80111b <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  8010fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801101:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801104:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801109:	be 01 00 00 00       	mov    $0x1,%esi
+  80110e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801111:	cd 30                	int    $0x30
+}
+  801113:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801116:	5b                   	pop    %ebx
+  801117:	5e                   	pop    %esi
+  801118:	5f                   	pop    %edi
+  801119:	5d                   	pop    %ebp
+  80111a:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80111b:	68 00 10 00 00       	push   $0x1000
+  801120:	53                   	push   %ebx
+  801121:	e8 2c fb ff ff       	call   800c52 <touch_mem>
+  801126:	83 c4 08             	add    $0x8,%esp
+  801129:	eb d3                	jmp    8010fe <sys_ipc_send+0x11>
+
+0080112b <sys_ipc_send_pages>:
+{
+  80112b:	55                   	push   %ebp
+  80112c:	89 e5                	mov    %esp,%ebp
+  80112e:	57                   	push   %edi
+  80112f:	56                   	push   %esi
+  801130:	53                   	push   %ebx
+  801131:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801134:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801137:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80113d:	76 18                	jbe    801157 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80113f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801142:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801145:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80114a:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80114d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  80114f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801152:	5b                   	pop    %ebx
+  801153:	5e                   	pop    %esi
+  801154:	5f                   	pop    %edi
+  801155:	5d                   	pop    %ebp
+  801156:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801157:	89 f0                	mov    %esi,%eax
+  801159:	c1 e0 0c             	shl    $0xc,%eax
+  80115c:	50                   	push   %eax
+  80115d:	53                   	push   %ebx
+  80115e:	e8 ef fa ff ff       	call   800c52 <touch_mem>
+  801163:	83 c4 08             	add    $0x8,%esp
+  801166:	eb d7                	jmp    80113f <sys_ipc_send_pages+0x14>
+
+00801168 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801168:	55                   	push   %ebp
+  801169:	89 e5                	mov    %esp,%ebp
+  80116b:	57                   	push   %edi
+  80116c:	56                   	push   %esi
+  80116d:	53                   	push   %ebx
+  80116e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801171:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801176:	8b 55 08             	mov    0x8(%ebp),%edx
+  801179:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801181:	89 df                	mov    %ebx,%edi
+  801183:	89 de                	mov    %ebx,%esi
+  801185:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801187:	85 c0                	test   %eax,%eax
+  801189:	7f 08                	jg     801193 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  80118b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80118e:	5b                   	pop    %ebx
+  80118f:	5e                   	pop    %esi
+  801190:	5f                   	pop    %edi
+  801191:	5d                   	pop    %ebp
+  801192:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801193:	83 ec 0c             	sub    $0xc,%esp
+  801196:	50                   	push   %eax
+  801197:	6a 0d                	push   $0xd
+  801199:	68 6b 2c 80 00       	push   $0x802c6b
+  80119e:	6a 23                	push   $0x23
+  8011a0:	68 88 2c 80 00       	push   $0x802c88
+  8011a5:	e8 e6 ef ff ff       	call   800190 <_panic>
+
+008011aa <sys_ipc_recv>:
+{
+  8011aa:	55                   	push   %ebp
+  8011ab:	89 e5                	mov    %esp,%ebp
+  8011ad:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8011b0:	6a 01                	push   $0x1
+  8011b2:	ff 75 08             	push   0x8(%ebp)
+  8011b5:	e8 ae ff ff ff       	call   801168 <sys_ipc_recv_pages>
+}
+  8011ba:	c9                   	leave
+  8011bb:	c3                   	ret
+
+008011bc <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	57                   	push   %edi
+  8011c0:	56                   	push   %esi
+  8011c1:	53                   	push   %ebx
+  8011c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011c8:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  8011cb:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011d1:	77 04                	ja     8011d7 <sys_ipc_call+0x1b>
+  8011d3:	85 f6                	test   %esi,%esi
+  8011d5:	75 15                	jne    8011ec <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8011d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011dd:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011e2:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8011e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e7:	5b                   	pop    %ebx
+  8011e8:	5e                   	pop    %esi
+  8011e9:	5f                   	pop    %edi
+  8011ea:	5d                   	pop    %ebp
+  8011eb:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8011ec:	89 f8                	mov    %edi,%eax
+  8011ee:	c1 e0 0c             	shl    $0xc,%eax
+  8011f1:	50                   	push   %eax
+  8011f2:	53                   	push   %ebx
+  8011f3:	e8 5a fa ff ff       	call   800c52 <touch_mem>
+  8011f8:	83 c4 08             	add    $0x8,%esp
+  8011fb:	eb da                	jmp    8011d7 <sys_ipc_call+0x1b>
+
+008011fd <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8011fd:	55                   	push   %ebp
+  8011fe:	89 e5                	mov    %esp,%ebp
+  801200:	57                   	push   %edi
+  801201:	56                   	push   %esi
+  801202:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801203:	8b 55 08             	mov    0x8(%ebp),%edx
+  801206:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801209:	b8 15 00 00 00       	mov    $0x15,%eax
+  80120e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801211:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801214:	8b 75 18             	mov    0x18(%ebp),%esi
+  801217:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801219:	5b                   	pop    %ebx
+  80121a:	5e                   	pop    %esi
+  80121b:	5f                   	pop    %edi
+  80121c:	5d                   	pop    %ebp
+  80121d:	c3                   	ret
+
+0080121e <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  80121e:	55                   	push   %ebp
+  80121f:	89 e5                	mov    %esp,%ebp
+  801221:	57                   	push   %edi
+  801222:	56                   	push   %esi
+  801223:	53                   	push   %ebx
+  801224:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801227:	6a 04                	push   $0x4
+  801229:	ff 75 08             	push   0x8(%ebp)
+  80122c:	e8 21 fa ff ff       	call   800c52 <touch_mem>
+	asm volatile("int %1\n"
+  801231:	be 00 00 00 00       	mov    $0x0,%esi
+  801236:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801239:	b8 16 00 00 00       	mov    $0x16,%eax
+  80123e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801241:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801244:	89 f7                	mov    %esi,%edi
+  801246:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801248:	83 c4 08             	add    $0x8,%esp
+  80124b:	85 c0                	test   %eax,%eax
+  80124d:	7f 08                	jg     801257 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  80124f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801252:	5b                   	pop    %ebx
+  801253:	5e                   	pop    %esi
+  801254:	5f                   	pop    %edi
+  801255:	5d                   	pop    %ebp
+  801256:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801257:	83 ec 0c             	sub    $0xc,%esp
+  80125a:	50                   	push   %eax
+  80125b:	6a 16                	push   $0x16
+  80125d:	68 6b 2c 80 00       	push   $0x802c6b
+  801262:	6a 23                	push   $0x23
+  801264:	68 88 2c 80 00       	push   $0x802c88
+  801269:	e8 22 ef ff ff       	call   800190 <_panic>
+
+0080126e <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80126e:	55                   	push   %ebp
+  80126f:	89 e5                	mov    %esp,%ebp
+  801271:	57                   	push   %edi
+  801272:	56                   	push   %esi
+  801273:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801274:	6a 04                	push   $0x4
+  801276:	ff 75 08             	push   0x8(%ebp)
+  801279:	e8 d4 f9 ff ff       	call   800c52 <touch_mem>
+	asm volatile("int %1\n"
+  80127e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801283:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801286:	b8 17 00 00 00       	mov    $0x17,%eax
+  80128b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128e:	89 df                	mov    %ebx,%edi
+  801290:	89 de                	mov    %ebx,%esi
+  801292:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801294:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801297:	5b                   	pop    %ebx
+  801298:	5e                   	pop    %esi
+  801299:	5f                   	pop    %edi
+  80129a:	5d                   	pop    %ebp
+  80129b:	c3                   	ret
+
+0080129c <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80129c:	55                   	push   %ebp
+  80129d:	89 e5                	mov    %esp,%ebp
+  80129f:	57                   	push   %edi
+  8012a0:	56                   	push   %esi
+  8012a1:	53                   	push   %ebx
+  8012a2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ad:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012b2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012b7:	89 df                	mov    %ebx,%edi
+  8012b9:	89 de                	mov    %ebx,%esi
+  8012bb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012bd:	85 c0                	test   %eax,%eax
+  8012bf:	7f 08                	jg     8012c9 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  8012c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c4:	5b                   	pop    %ebx
+  8012c5:	5e                   	pop    %esi
+  8012c6:	5f                   	pop    %edi
+  8012c7:	5d                   	pop    %ebp
+  8012c8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012c9:	83 ec 0c             	sub    $0xc,%esp
+  8012cc:	50                   	push   %eax
+  8012cd:	6a 0e                	push   $0xe
+  8012cf:	68 6b 2c 80 00       	push   $0x802c6b
+  8012d4:	6a 23                	push   $0x23
+  8012d6:	68 88 2c 80 00       	push   $0x802c88
+  8012db:	e8 b0 ee ff ff       	call   800190 <_panic>
+
+008012e0 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8012e0:	55                   	push   %ebp
+  8012e1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012e6:	05 00 00 00 30       	add    $0x30000000,%eax
+  8012eb:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012ee:	5d                   	pop    %ebp
+  8012ef:	c3                   	ret
+
+008012f0 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012f0:	55                   	push   %ebp
+  8012f1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012f6:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8012fb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801300:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801305:	5d                   	pop    %ebp
+  801306:	c3                   	ret
+
+00801307 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801307:	55                   	push   %ebp
+  801308:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  80130a:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  80130f:	a8 01                	test   $0x1,%al
+  801311:	74 3c                	je     80134f <fd_alloc+0x48>
+  801313:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801318:	89 c2                	mov    %eax,%edx
+  80131a:	c1 ea 0c             	shr    $0xc,%edx
+  80131d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801324:	89 c1                	mov    %eax,%ecx
+  801326:	05 00 10 00 00       	add    $0x1000,%eax
+  80132b:	f6 c2 01             	test   $0x1,%dl
+  80132e:	74 13                	je     801343 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801330:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801335:	75 e1                	jne    801318 <fd_alloc+0x11>
+  801337:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80133c:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801341:	eb 05                	jmp    801348 <fd_alloc+0x41>
+			return 0;
+  801343:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801348:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134b:	89 0a                	mov    %ecx,(%edx)
+}
+  80134d:	5d                   	pop    %ebp
+  80134e:	c3                   	ret
+  80134f:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801354:	b8 00 00 00 00       	mov    $0x0,%eax
+  801359:	eb ed                	jmp    801348 <fd_alloc+0x41>
+
+0080135b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80135b:	55                   	push   %ebp
+  80135c:	89 e5                	mov    %esp,%ebp
+  80135e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801361:	83 f8 1f             	cmp    $0x1f,%eax
+  801364:	77 30                	ja     801396 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801366:	c1 e0 0c             	shl    $0xc,%eax
+  801369:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80136e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801374:	f6 c2 01             	test   $0x1,%dl
+  801377:	74 24                	je     80139d <fd_lookup+0x42>
+  801379:	89 c2                	mov    %eax,%edx
+  80137b:	c1 ea 0c             	shr    $0xc,%edx
+  80137e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801385:	f6 c2 01             	test   $0x1,%dl
+  801388:	74 1a                	je     8013a4 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80138a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80138d:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80138f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801394:	5d                   	pop    %ebp
+  801395:	c3                   	ret
+		return -E_INVAL;
+  801396:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80139b:	eb f7                	jmp    801394 <fd_lookup+0x39>
+		return -E_INVAL;
+  80139d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013a2:	eb f0                	jmp    801394 <fd_lookup+0x39>
+  8013a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013a9:	eb e9                	jmp    801394 <fd_lookup+0x39>
+
+008013ab <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013ab:	55                   	push   %ebp
+  8013ac:	89 e5                	mov    %esp,%ebp
+  8013ae:	53                   	push   %ebx
+  8013af:	83 ec 04             	sub    $0x4,%esp
+  8013b2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8013b5:	b8 14 2d 80 00       	mov    $0x802d14,%eax
+  8013ba:	8b 18                	mov    (%eax),%ebx
+  8013bc:	85 db                	test   %ebx,%ebx
+  8013be:	74 0e                	je     8013ce <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  8013c0:	83 c0 04             	add    $0x4,%eax
+  8013c3:	39 13                	cmp    %edx,(%ebx)
+  8013c5:	75 f3                	jne    8013ba <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  8013c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013cc:	eb 1f                	jmp    8013ed <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013ce:	a1 24 60 80 00       	mov    0x806024,%eax
+  8013d3:	8b 40 48             	mov    0x48(%eax),%eax
+  8013d6:	83 ec 04             	sub    $0x4,%esp
+  8013d9:	52                   	push   %edx
+  8013da:	50                   	push   %eax
+  8013db:	68 98 2c 80 00       	push   $0x802c98
+  8013e0:	e8 86 ee ff ff       	call   80026b <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8013e5:	83 c4 10             	add    $0x10,%esp
+  8013e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8013ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013f0:	89 1a                	mov    %ebx,(%edx)
+}
+  8013f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013f5:	c9                   	leave
+  8013f6:	c3                   	ret
+
+008013f7 <fd_close>:
+{
+  8013f7:	55                   	push   %ebp
+  8013f8:	89 e5                	mov    %esp,%ebp
+  8013fa:	57                   	push   %edi
+  8013fb:	56                   	push   %esi
+  8013fc:	53                   	push   %ebx
+  8013fd:	83 ec 24             	sub    $0x24,%esp
+  801400:	8b 75 08             	mov    0x8(%ebp),%esi
+  801403:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801406:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801409:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80140a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801410:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801413:	50                   	push   %eax
+  801414:	e8 42 ff ff ff       	call   80135b <fd_lookup>
+  801419:	89 c3                	mov    %eax,%ebx
+  80141b:	83 c4 10             	add    $0x10,%esp
+  80141e:	85 c0                	test   %eax,%eax
+  801420:	78 05                	js     801427 <fd_close+0x30>
+	    || fd != fd2)
+  801422:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801425:	74 16                	je     80143d <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801427:	89 f8                	mov    %edi,%eax
+  801429:	84 c0                	test   %al,%al
+  80142b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801430:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801433:	89 d8                	mov    %ebx,%eax
+  801435:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801438:	5b                   	pop    %ebx
+  801439:	5e                   	pop    %esi
+  80143a:	5f                   	pop    %edi
+  80143b:	5d                   	pop    %ebp
+  80143c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80143d:	83 ec 08             	sub    $0x8,%esp
+  801440:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801443:	50                   	push   %eax
+  801444:	ff 36                	push   (%esi)
+  801446:	e8 60 ff ff ff       	call   8013ab <dev_lookup>
+  80144b:	89 c3                	mov    %eax,%ebx
+  80144d:	83 c4 10             	add    $0x10,%esp
+  801450:	85 c0                	test   %eax,%eax
+  801452:	78 1a                	js     80146e <fd_close+0x77>
+		if (dev->dev_close)
+  801454:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801457:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80145a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80145f:	85 c0                	test   %eax,%eax
+  801461:	74 0b                	je     80146e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801463:	83 ec 0c             	sub    $0xc,%esp
+  801466:	56                   	push   %esi
+  801467:	ff d0                	call   *%eax
+  801469:	89 c3                	mov    %eax,%ebx
+  80146b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80146e:	83 ec 08             	sub    $0x8,%esp
+  801471:	56                   	push   %esi
+  801472:	6a 00                	push   $0x0
+  801474:	e8 51 f9 ff ff       	call   800dca <sys_page_unmap>
+	return r;
+  801479:	83 c4 10             	add    $0x10,%esp
+  80147c:	eb b5                	jmp    801433 <fd_close+0x3c>
+
+0080147e <close>:
+
+int
+close(int fdnum)
+{
+  80147e:	55                   	push   %ebp
+  80147f:	89 e5                	mov    %esp,%ebp
+  801481:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801484:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801487:	50                   	push   %eax
+  801488:	ff 75 08             	push   0x8(%ebp)
+  80148b:	e8 cb fe ff ff       	call   80135b <fd_lookup>
+  801490:	83 c4 10             	add    $0x10,%esp
+  801493:	85 c0                	test   %eax,%eax
+  801495:	79 02                	jns    801499 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801497:	c9                   	leave
+  801498:	c3                   	ret
+		return fd_close(fd, 1);
+  801499:	83 ec 08             	sub    $0x8,%esp
+  80149c:	6a 01                	push   $0x1
+  80149e:	ff 75 f4             	push   -0xc(%ebp)
+  8014a1:	e8 51 ff ff ff       	call   8013f7 <fd_close>
+  8014a6:	83 c4 10             	add    $0x10,%esp
+  8014a9:	eb ec                	jmp    801497 <close+0x19>
+
+008014ab <close_all>:
+
+void
+close_all(void)
+{
+  8014ab:	55                   	push   %ebp
+  8014ac:	89 e5                	mov    %esp,%ebp
+  8014ae:	53                   	push   %ebx
+  8014af:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8014b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8014b7:	83 ec 0c             	sub    $0xc,%esp
+  8014ba:	53                   	push   %ebx
+  8014bb:	e8 be ff ff ff       	call   80147e <close>
+	for (i = 0; i < MAXFD; i++)
+  8014c0:	83 c3 01             	add    $0x1,%ebx
+  8014c3:	83 c4 10             	add    $0x10,%esp
+  8014c6:	83 fb 20             	cmp    $0x20,%ebx
+  8014c9:	75 ec                	jne    8014b7 <close_all+0xc>
+}
+  8014cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014ce:	c9                   	leave
+  8014cf:	c3                   	ret
+
+008014d0 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014d0:	55                   	push   %ebp
+  8014d1:	89 e5                	mov    %esp,%ebp
+  8014d3:	57                   	push   %edi
+  8014d4:	56                   	push   %esi
+  8014d5:	53                   	push   %ebx
+  8014d6:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8014d9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014dc:	50                   	push   %eax
+  8014dd:	ff 75 08             	push   0x8(%ebp)
+  8014e0:	e8 76 fe ff ff       	call   80135b <fd_lookup>
+  8014e5:	89 c3                	mov    %eax,%ebx
+  8014e7:	83 c4 10             	add    $0x10,%esp
+  8014ea:	85 c0                	test   %eax,%eax
+  8014ec:	78 7f                	js     80156d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8014ee:	83 ec 0c             	sub    $0xc,%esp
+  8014f1:	ff 75 0c             	push   0xc(%ebp)
+  8014f4:	e8 85 ff ff ff       	call   80147e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8014f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014fc:	c1 e6 0c             	shl    $0xc,%esi
+  8014ff:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801505:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801508:	89 3c 24             	mov    %edi,(%esp)
+  80150b:	e8 e0 fd ff ff       	call   8012f0 <fd2data>
+  801510:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801512:	89 34 24             	mov    %esi,(%esp)
+  801515:	e8 d6 fd ff ff       	call   8012f0 <fd2data>
+  80151a:	83 c4 10             	add    $0x10,%esp
+  80151d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801520:	89 d8                	mov    %ebx,%eax
+  801522:	c1 e8 16             	shr    $0x16,%eax
+  801525:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80152c:	a8 01                	test   $0x1,%al
+  80152e:	74 11                	je     801541 <dup+0x71>
+  801530:	89 d8                	mov    %ebx,%eax
+  801532:	c1 e8 0c             	shr    $0xc,%eax
+  801535:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80153c:	f6 c2 01             	test   $0x1,%dl
+  80153f:	75 36                	jne    801577 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801541:	89 f8                	mov    %edi,%eax
+  801543:	c1 e8 0c             	shr    $0xc,%eax
+  801546:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80154d:	83 ec 0c             	sub    $0xc,%esp
+  801550:	25 07 0e 00 00       	and    $0xe07,%eax
+  801555:	50                   	push   %eax
+  801556:	56                   	push   %esi
+  801557:	6a 00                	push   $0x0
+  801559:	57                   	push   %edi
+  80155a:	6a 00                	push   $0x0
+  80155c:	e8 27 f8 ff ff       	call   800d88 <sys_page_map>
+  801561:	89 c3                	mov    %eax,%ebx
+  801563:	83 c4 20             	add    $0x20,%esp
+  801566:	85 c0                	test   %eax,%eax
+  801568:	78 33                	js     80159d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80156a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80156d:	89 d8                	mov    %ebx,%eax
+  80156f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801572:	5b                   	pop    %ebx
+  801573:	5e                   	pop    %esi
+  801574:	5f                   	pop    %edi
+  801575:	5d                   	pop    %ebp
+  801576:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801577:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80157e:	83 ec 0c             	sub    $0xc,%esp
+  801581:	25 07 0e 00 00       	and    $0xe07,%eax
+  801586:	50                   	push   %eax
+  801587:	ff 75 d4             	push   -0x2c(%ebp)
+  80158a:	6a 00                	push   $0x0
+  80158c:	53                   	push   %ebx
+  80158d:	6a 00                	push   $0x0
+  80158f:	e8 f4 f7 ff ff       	call   800d88 <sys_page_map>
+  801594:	89 c3                	mov    %eax,%ebx
+  801596:	83 c4 20             	add    $0x20,%esp
+  801599:	85 c0                	test   %eax,%eax
+  80159b:	79 a4                	jns    801541 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80159d:	83 ec 08             	sub    $0x8,%esp
+  8015a0:	56                   	push   %esi
+  8015a1:	6a 00                	push   $0x0
+  8015a3:	e8 22 f8 ff ff       	call   800dca <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8015a8:	83 c4 08             	add    $0x8,%esp
+  8015ab:	ff 75 d4             	push   -0x2c(%ebp)
+  8015ae:	6a 00                	push   $0x0
+  8015b0:	e8 15 f8 ff ff       	call   800dca <sys_page_unmap>
+	return r;
+  8015b5:	83 c4 10             	add    $0x10,%esp
+  8015b8:	eb b3                	jmp    80156d <dup+0x9d>
+
+008015ba <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015ba:	55                   	push   %ebp
+  8015bb:	89 e5                	mov    %esp,%ebp
+  8015bd:	56                   	push   %esi
+  8015be:	53                   	push   %ebx
+  8015bf:	83 ec 18             	sub    $0x18,%esp
+  8015c2:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015c5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015c8:	50                   	push   %eax
+  8015c9:	56                   	push   %esi
+  8015ca:	e8 8c fd ff ff       	call   80135b <fd_lookup>
+  8015cf:	83 c4 10             	add    $0x10,%esp
+  8015d2:	85 c0                	test   %eax,%eax
+  8015d4:	78 3c                	js     801612 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015d6:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8015d9:	83 ec 08             	sub    $0x8,%esp
+  8015dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015df:	50                   	push   %eax
+  8015e0:	ff 33                	push   (%ebx)
+  8015e2:	e8 c4 fd ff ff       	call   8013ab <dev_lookup>
+  8015e7:	83 c4 10             	add    $0x10,%esp
+  8015ea:	85 c0                	test   %eax,%eax
+  8015ec:	78 24                	js     801612 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8015ee:	8b 43 08             	mov    0x8(%ebx),%eax
+  8015f1:	83 e0 03             	and    $0x3,%eax
+  8015f4:	83 f8 01             	cmp    $0x1,%eax
+  8015f7:	74 20                	je     801619 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8015f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015fc:	8b 40 08             	mov    0x8(%eax),%eax
+  8015ff:	85 c0                	test   %eax,%eax
+  801601:	74 37                	je     80163a <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801603:	83 ec 04             	sub    $0x4,%esp
+  801606:	ff 75 10             	push   0x10(%ebp)
+  801609:	ff 75 0c             	push   0xc(%ebp)
+  80160c:	53                   	push   %ebx
+  80160d:	ff d0                	call   *%eax
+  80160f:	83 c4 10             	add    $0x10,%esp
+}
+  801612:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801615:	5b                   	pop    %ebx
+  801616:	5e                   	pop    %esi
+  801617:	5d                   	pop    %ebp
+  801618:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801619:	a1 24 60 80 00       	mov    0x806024,%eax
+  80161e:	8b 40 48             	mov    0x48(%eax),%eax
+  801621:	83 ec 04             	sub    $0x4,%esp
+  801624:	56                   	push   %esi
+  801625:	50                   	push   %eax
+  801626:	68 d9 2c 80 00       	push   $0x802cd9
+  80162b:	e8 3b ec ff ff       	call   80026b <cprintf>
+		return -E_INVAL;
+  801630:	83 c4 10             	add    $0x10,%esp
+  801633:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801638:	eb d8                	jmp    801612 <read+0x58>
+		return -E_NOT_SUPP;
+  80163a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80163f:	eb d1                	jmp    801612 <read+0x58>
+
+00801641 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801641:	55                   	push   %ebp
+  801642:	89 e5                	mov    %esp,%ebp
+  801644:	57                   	push   %edi
+  801645:	56                   	push   %esi
+  801646:	53                   	push   %ebx
+  801647:	83 ec 0c             	sub    $0xc,%esp
+  80164a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80164d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801650:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801655:	eb 02                	jmp    801659 <readn+0x18>
+  801657:	01 c3                	add    %eax,%ebx
+  801659:	39 f3                	cmp    %esi,%ebx
+  80165b:	73 21                	jae    80167e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80165d:	83 ec 04             	sub    $0x4,%esp
+  801660:	89 f0                	mov    %esi,%eax
+  801662:	29 d8                	sub    %ebx,%eax
+  801664:	50                   	push   %eax
+  801665:	89 d8                	mov    %ebx,%eax
+  801667:	03 45 0c             	add    0xc(%ebp),%eax
+  80166a:	50                   	push   %eax
+  80166b:	57                   	push   %edi
+  80166c:	e8 49 ff ff ff       	call   8015ba <read>
+		if (m < 0)
+  801671:	83 c4 10             	add    $0x10,%esp
+  801674:	85 c0                	test   %eax,%eax
+  801676:	78 04                	js     80167c <readn+0x3b>
+			return m;
+		if (m == 0)
+  801678:	75 dd                	jne    801657 <readn+0x16>
+  80167a:	eb 02                	jmp    80167e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80167c:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80167e:	89 d8                	mov    %ebx,%eax
+  801680:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801683:	5b                   	pop    %ebx
+  801684:	5e                   	pop    %esi
+  801685:	5f                   	pop    %edi
+  801686:	5d                   	pop    %ebp
+  801687:	c3                   	ret
+
+00801688 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801688:	55                   	push   %ebp
+  801689:	89 e5                	mov    %esp,%ebp
+  80168b:	56                   	push   %esi
+  80168c:	53                   	push   %ebx
+  80168d:	83 ec 18             	sub    $0x18,%esp
+  801690:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801693:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801696:	50                   	push   %eax
+  801697:	53                   	push   %ebx
+  801698:	e8 be fc ff ff       	call   80135b <fd_lookup>
+  80169d:	83 c4 10             	add    $0x10,%esp
+  8016a0:	85 c0                	test   %eax,%eax
+  8016a2:	78 37                	js     8016db <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016a4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016a7:	83 ec 08             	sub    $0x8,%esp
+  8016aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ad:	50                   	push   %eax
+  8016ae:	ff 36                	push   (%esi)
+  8016b0:	e8 f6 fc ff ff       	call   8013ab <dev_lookup>
+  8016b5:	83 c4 10             	add    $0x10,%esp
+  8016b8:	85 c0                	test   %eax,%eax
+  8016ba:	78 1f                	js     8016db <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016bc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016c0:	74 20                	je     8016e2 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8016c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016c5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016c8:	85 c0                	test   %eax,%eax
+  8016ca:	74 37                	je     801703 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8016cc:	83 ec 04             	sub    $0x4,%esp
+  8016cf:	ff 75 10             	push   0x10(%ebp)
+  8016d2:	ff 75 0c             	push   0xc(%ebp)
+  8016d5:	56                   	push   %esi
+  8016d6:	ff d0                	call   *%eax
+  8016d8:	83 c4 10             	add    $0x10,%esp
+}
+  8016db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016de:	5b                   	pop    %ebx
+  8016df:	5e                   	pop    %esi
+  8016e0:	5d                   	pop    %ebp
+  8016e1:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016e2:	a1 24 60 80 00       	mov    0x806024,%eax
+  8016e7:	8b 40 48             	mov    0x48(%eax),%eax
+  8016ea:	83 ec 04             	sub    $0x4,%esp
+  8016ed:	53                   	push   %ebx
+  8016ee:	50                   	push   %eax
+  8016ef:	68 f5 2c 80 00       	push   $0x802cf5
+  8016f4:	e8 72 eb ff ff       	call   80026b <cprintf>
+		return -E_INVAL;
+  8016f9:	83 c4 10             	add    $0x10,%esp
+  8016fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801701:	eb d8                	jmp    8016db <write+0x53>
+		return -E_NOT_SUPP;
+  801703:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801708:	eb d1                	jmp    8016db <write+0x53>
+
+0080170a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80170a:	55                   	push   %ebp
+  80170b:	89 e5                	mov    %esp,%ebp
+  80170d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801710:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801713:	50                   	push   %eax
+  801714:	ff 75 08             	push   0x8(%ebp)
+  801717:	e8 3f fc ff ff       	call   80135b <fd_lookup>
+  80171c:	83 c4 10             	add    $0x10,%esp
+  80171f:	85 c0                	test   %eax,%eax
+  801721:	78 0e                	js     801731 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801723:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801726:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801729:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80172c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801731:	c9                   	leave
+  801732:	c3                   	ret
+
+00801733 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801733:	55                   	push   %ebp
+  801734:	89 e5                	mov    %esp,%ebp
+  801736:	56                   	push   %esi
+  801737:	53                   	push   %ebx
+  801738:	83 ec 18             	sub    $0x18,%esp
+  80173b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80173e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801741:	50                   	push   %eax
+  801742:	53                   	push   %ebx
+  801743:	e8 13 fc ff ff       	call   80135b <fd_lookup>
+  801748:	83 c4 10             	add    $0x10,%esp
+  80174b:	85 c0                	test   %eax,%eax
+  80174d:	78 34                	js     801783 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80174f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801752:	83 ec 08             	sub    $0x8,%esp
+  801755:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801758:	50                   	push   %eax
+  801759:	ff 36                	push   (%esi)
+  80175b:	e8 4b fc ff ff       	call   8013ab <dev_lookup>
+  801760:	83 c4 10             	add    $0x10,%esp
+  801763:	85 c0                	test   %eax,%eax
+  801765:	78 1c                	js     801783 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801767:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80176b:	74 1d                	je     80178a <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80176d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801770:	8b 40 18             	mov    0x18(%eax),%eax
+  801773:	85 c0                	test   %eax,%eax
+  801775:	74 34                	je     8017ab <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801777:	83 ec 08             	sub    $0x8,%esp
+  80177a:	ff 75 0c             	push   0xc(%ebp)
+  80177d:	56                   	push   %esi
+  80177e:	ff d0                	call   *%eax
+  801780:	83 c4 10             	add    $0x10,%esp
+}
+  801783:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801786:	5b                   	pop    %ebx
+  801787:	5e                   	pop    %esi
+  801788:	5d                   	pop    %ebp
+  801789:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80178a:	a1 24 60 80 00       	mov    0x806024,%eax
+  80178f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801792:	83 ec 04             	sub    $0x4,%esp
+  801795:	53                   	push   %ebx
+  801796:	50                   	push   %eax
+  801797:	68 b8 2c 80 00       	push   $0x802cb8
+  80179c:	e8 ca ea ff ff       	call   80026b <cprintf>
+		return -E_INVAL;
+  8017a1:	83 c4 10             	add    $0x10,%esp
+  8017a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a9:	eb d8                	jmp    801783 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017ab:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017b0:	eb d1                	jmp    801783 <ftruncate+0x50>
+
+008017b2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017b2:	55                   	push   %ebp
+  8017b3:	89 e5                	mov    %esp,%ebp
+  8017b5:	56                   	push   %esi
+  8017b6:	53                   	push   %ebx
+  8017b7:	83 ec 18             	sub    $0x18,%esp
+  8017ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017bd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017c0:	50                   	push   %eax
+  8017c1:	ff 75 08             	push   0x8(%ebp)
+  8017c4:	e8 92 fb ff ff       	call   80135b <fd_lookup>
+  8017c9:	83 c4 10             	add    $0x10,%esp
+  8017cc:	85 c0                	test   %eax,%eax
+  8017ce:	78 49                	js     801819 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017d0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017d3:	83 ec 08             	sub    $0x8,%esp
+  8017d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017d9:	50                   	push   %eax
+  8017da:	ff 36                	push   (%esi)
+  8017dc:	e8 ca fb ff ff       	call   8013ab <dev_lookup>
+  8017e1:	83 c4 10             	add    $0x10,%esp
+  8017e4:	85 c0                	test   %eax,%eax
+  8017e6:	78 31                	js     801819 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8017e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017eb:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8017ef:	74 2f                	je     801820 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8017f1:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8017f4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8017fb:	00 00 00 
+	stat->st_isdir = 0;
+  8017fe:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801805:	00 00 00 
+	stat->st_dev = dev;
+  801808:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80180e:	83 ec 08             	sub    $0x8,%esp
+  801811:	53                   	push   %ebx
+  801812:	56                   	push   %esi
+  801813:	ff 50 14             	call   *0x14(%eax)
+  801816:	83 c4 10             	add    $0x10,%esp
+}
+  801819:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80181c:	5b                   	pop    %ebx
+  80181d:	5e                   	pop    %esi
+  80181e:	5d                   	pop    %ebp
+  80181f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801820:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801825:	eb f2                	jmp    801819 <fstat+0x67>
+
+00801827 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801827:	55                   	push   %ebp
+  801828:	89 e5                	mov    %esp,%ebp
+  80182a:	56                   	push   %esi
+  80182b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80182c:	83 ec 08             	sub    $0x8,%esp
+  80182f:	6a 00                	push   $0x0
+  801831:	ff 75 08             	push   0x8(%ebp)
+  801834:	e8 bc 02 00 00       	call   801af5 <open>
+  801839:	89 c3                	mov    %eax,%ebx
+  80183b:	83 c4 10             	add    $0x10,%esp
+  80183e:	85 c0                	test   %eax,%eax
+  801840:	78 1b                	js     80185d <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801842:	83 ec 08             	sub    $0x8,%esp
+  801845:	ff 75 0c             	push   0xc(%ebp)
+  801848:	50                   	push   %eax
+  801849:	e8 64 ff ff ff       	call   8017b2 <fstat>
+  80184e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801850:	89 1c 24             	mov    %ebx,(%esp)
+  801853:	e8 26 fc ff ff       	call   80147e <close>
+	return r;
+  801858:	83 c4 10             	add    $0x10,%esp
+  80185b:	89 f3                	mov    %esi,%ebx
+}
+  80185d:	89 d8                	mov    %ebx,%eax
+  80185f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801862:	5b                   	pop    %ebx
+  801863:	5e                   	pop    %esi
+  801864:	5d                   	pop    %ebp
+  801865:	c3                   	ret
+
+00801866 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801866:	55                   	push   %ebp
+  801867:	89 e5                	mov    %esp,%ebp
+  801869:	57                   	push   %edi
+  80186a:	56                   	push   %esi
+  80186b:	53                   	push   %ebx
+  80186c:	83 ec 0c             	sub    $0xc,%esp
+  80186f:	89 c7                	mov    %eax,%edi
+  801871:	89 d3                	mov    %edx,%ebx
+  801873:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801875:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  80187c:	74 2d                	je     8018ab <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80187e:	6a 07                	push   $0x7
+  801880:	68 00 70 80 00       	push   $0x807000
+  801885:	57                   	push   %edi
+  801886:	ff 35 00 40 80 00    	push   0x804000
+  80188c:	e8 91 0c 00 00       	call   802522 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801891:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801898:	6a 00                	push   $0x0
+  80189a:	56                   	push   %esi
+  80189b:	53                   	push   %ebx
+  80189c:	6a 00                	push   $0x0
+  80189e:	e8 31 0b 00 00       	call   8023d4 <ipc_recv_pages>
+}
+  8018a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018a6:	5b                   	pop    %ebx
+  8018a7:	5e                   	pop    %esi
+  8018a8:	5f                   	pop    %edi
+  8018a9:	5d                   	pop    %ebp
+  8018aa:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018ab:	83 ec 0c             	sub    $0xc,%esp
+  8018ae:	6a 01                	push   $0x1
+  8018b0:	e8 62 0d 00 00       	call   802617 <ipc_find_env>
+  8018b5:	a3 00 40 80 00       	mov    %eax,0x804000
+  8018ba:	83 c4 10             	add    $0x10,%esp
+  8018bd:	eb bf                	jmp    80187e <fsipc_pages+0x18>
+
+008018bf <fsipc>:
+{
+  8018bf:	55                   	push   %ebp
+  8018c0:	89 e5                	mov    %esp,%ebp
+  8018c2:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  8018c5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018ca:	e8 97 ff ff ff       	call   801866 <fsipc_pages>
+}
+  8018cf:	c9                   	leave
+  8018d0:	c3                   	ret
+
+008018d1 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018d1:	55                   	push   %ebp
+  8018d2:	89 e5                	mov    %esp,%ebp
+  8018d4:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018da:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018dd:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8018e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018e5:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8018ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ef:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018f4:	e8 c6 ff ff ff       	call   8018bf <fsipc>
+}
+  8018f9:	c9                   	leave
+  8018fa:	c3                   	ret
+
+008018fb <devfile_flush>:
+{
+  8018fb:	55                   	push   %ebp
+  8018fc:	89 e5                	mov    %esp,%ebp
+  8018fe:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801901:	8b 45 08             	mov    0x8(%ebp),%eax
+  801904:	8b 40 0c             	mov    0xc(%eax),%eax
+  801907:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80190c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801911:	b8 06 00 00 00       	mov    $0x6,%eax
+  801916:	e8 a4 ff ff ff       	call   8018bf <fsipc>
+}
+  80191b:	c9                   	leave
+  80191c:	c3                   	ret
+
+0080191d <devfile_stat>:
+{
+  80191d:	55                   	push   %ebp
+  80191e:	89 e5                	mov    %esp,%ebp
+  801920:	53                   	push   %ebx
+  801921:	83 ec 04             	sub    $0x4,%esp
+  801924:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801927:	8b 45 08             	mov    0x8(%ebp),%eax
+  80192a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80192d:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801932:	ba 00 00 00 00       	mov    $0x0,%edx
+  801937:	b8 05 00 00 00       	mov    $0x5,%eax
+  80193c:	e8 7e ff ff ff       	call   8018bf <fsipc>
+  801941:	85 c0                	test   %eax,%eax
+  801943:	78 2c                	js     801971 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801945:	83 ec 08             	sub    $0x8,%esp
+  801948:	68 00 70 80 00       	push   $0x807000
+  80194d:	53                   	push   %ebx
+  80194e:	e8 ff ee ff ff       	call   800852 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801953:	a1 80 70 80 00       	mov    0x807080,%eax
+  801958:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80195e:	a1 84 70 80 00       	mov    0x807084,%eax
+  801963:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801969:	83 c4 10             	add    $0x10,%esp
+  80196c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801971:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801974:	c9                   	leave
+  801975:	c3                   	ret
+
+00801976 <devfile_write>:
+{
+  801976:	55                   	push   %ebp
+  801977:	89 e5                	mov    %esp,%ebp
+  801979:	83 ec 0c             	sub    $0xc,%esp
+  80197c:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80197f:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801984:	39 d0                	cmp    %edx,%eax
+  801986:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801989:	8b 55 08             	mov    0x8(%ebp),%edx
+  80198c:	8b 52 0c             	mov    0xc(%edx),%edx
+  80198f:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = n;
+  801995:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80199a:	50                   	push   %eax
+  80199b:	ff 75 0c             	push   0xc(%ebp)
+  80199e:	68 08 70 80 00       	push   $0x807008
+  8019a3:	e8 30 f0 ff ff       	call   8009d8 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8019a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ad:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019b2:	e8 08 ff ff ff       	call   8018bf <fsipc>
+}
+  8019b7:	c9                   	leave
+  8019b8:	c3                   	ret
+
+008019b9 <devfile_read>:
+{
+  8019b9:	55                   	push   %ebp
+  8019ba:	89 e5                	mov    %esp,%ebp
+  8019bc:	57                   	push   %edi
+  8019bd:	56                   	push   %esi
+  8019be:	53                   	push   %ebx
+  8019bf:	83 ec 1c             	sub    $0x1c,%esp
+  8019c2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019c5:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8019c8:	89 fe                	mov    %edi,%esi
+  8019ca:	c1 ee 0c             	shr    $0xc,%esi
+  8019cd:	b8 20 00 00 00       	mov    $0x20,%eax
+  8019d2:	39 c6                	cmp    %eax,%esi
+  8019d4:	0f 47 f0             	cmova  %eax,%esi
+  8019d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019df:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8019e2:	eb 14                	jmp    8019f8 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8019e4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  8019eb:	05 00 10 00 00       	add    $0x1000,%eax
+  8019f0:	f6 c6 06             	test   $0x6,%dh
+  8019f3:	75 42                	jne    801a37 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8019f5:	83 c1 01             	add    $0x1,%ecx
+  8019f8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8019fb:	39 f1                	cmp    %esi,%ecx
+  8019fd:	0f 84 95 00 00 00    	je     801a98 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801a03:	89 c2                	mov    %eax,%edx
+  801a05:	c1 ea 16             	shr    $0x16,%edx
+  801a08:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a0f:	f6 c2 01             	test   $0x1,%dl
+  801a12:	74 23                	je     801a37 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801a14:	89 c2                	mov    %eax,%edx
+  801a16:	c1 ea 0c             	shr    $0xc,%edx
+  801a19:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801a20:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801a26:	74 0f                	je     801a37 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801a28:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801a2f:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801a35:	75 ad                	jne    8019e4 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801a37:	85 c9                	test   %ecx,%ecx
+  801a39:	74 11                	je     801a4c <devfile_read+0x93>
+  801a3b:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801a42:	75 08                	jne    801a4c <devfile_read+0x93>
+  801a44:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801a4a:	74 50                	je     801a9c <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a4c:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a4f:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801a54:	89 3d 04 70 80 00    	mov    %edi,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a5f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a64:	e8 56 fe ff ff       	call   8018bf <fsipc>
+  801a69:	89 c6                	mov    %eax,%esi
+  801a6b:	85 c0                	test   %eax,%eax
+  801a6d:	78 1f                	js     801a8e <devfile_read+0xd5>
+	assert(r <= n);
+  801a6f:	39 c7                	cmp    %eax,%edi
+  801a71:	72 50                	jb     801ac3 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801a73:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a78:	7f 62                	jg     801adc <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801a7a:	83 ec 04             	sub    $0x4,%esp
+  801a7d:	50                   	push   %eax
+  801a7e:	68 00 70 80 00       	push   $0x807000
+  801a83:	ff 75 0c             	push   0xc(%ebp)
+  801a86:	e8 4d ef ff ff       	call   8009d8 <memmove>
+	return r;
+  801a8b:	83 c4 10             	add    $0x10,%esp
+}
+  801a8e:	89 f0                	mov    %esi,%eax
+  801a90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a93:	5b                   	pop    %ebx
+  801a94:	5e                   	pop    %esi
+  801a95:	5f                   	pop    %edi
+  801a96:	5d                   	pop    %ebp
+  801a97:	c3                   	ret
+  801a98:	89 f1                	mov    %esi,%ecx
+  801a9a:	eb 9b                	jmp    801a37 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801a9c:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a9f:	a3 00 70 80 00       	mov    %eax,0x807000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801aa4:	89 c8                	mov    %ecx,%eax
+  801aa6:	c1 e0 0c             	shl    $0xc,%eax
+  801aa9:	a3 04 70 80 00       	mov    %eax,0x807004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801aae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ab1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801ab6:	e8 ab fd ff ff       	call   801866 <fsipc_pages>
+  801abb:	89 c6                	mov    %eax,%esi
+  801abd:	85 c0                	test   %eax,%eax
+  801abf:	78 8b                	js     801a4c <devfile_read+0x93>
+  801ac1:	eb cb                	jmp    801a8e <devfile_read+0xd5>
+	assert(r <= n);
+  801ac3:	68 24 2d 80 00       	push   $0x802d24
+  801ac8:	68 2b 2d 80 00       	push   $0x802d2b
+  801acd:	68 a0 00 00 00       	push   $0xa0
+  801ad2:	68 40 2d 80 00       	push   $0x802d40
+  801ad7:	e8 b4 e6 ff ff       	call   800190 <_panic>
+	assert(r <= PGSIZE);
+  801adc:	68 4b 2d 80 00       	push   $0x802d4b
+  801ae1:	68 2b 2d 80 00       	push   $0x802d2b
+  801ae6:	68 a1 00 00 00       	push   $0xa1
+  801aeb:	68 40 2d 80 00       	push   $0x802d40
+  801af0:	e8 9b e6 ff ff       	call   800190 <_panic>
+
+00801af5 <open>:
+{
+  801af5:	55                   	push   %ebp
+  801af6:	89 e5                	mov    %esp,%ebp
+  801af8:	56                   	push   %esi
+  801af9:	53                   	push   %ebx
+  801afa:	83 ec 1c             	sub    $0x1c,%esp
+  801afd:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801b00:	56                   	push   %esi
+  801b01:	e8 11 ed ff ff       	call   800817 <strlen>
+  801b06:	83 c4 10             	add    $0x10,%esp
+  801b09:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b0e:	7f 6c                	jg     801b7c <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801b10:	83 ec 0c             	sub    $0xc,%esp
+  801b13:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b16:	50                   	push   %eax
+  801b17:	e8 eb f7 ff ff       	call   801307 <fd_alloc>
+  801b1c:	89 c3                	mov    %eax,%ebx
+  801b1e:	83 c4 10             	add    $0x10,%esp
+  801b21:	85 c0                	test   %eax,%eax
+  801b23:	78 3c                	js     801b61 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801b25:	83 ec 08             	sub    $0x8,%esp
+  801b28:	56                   	push   %esi
+  801b29:	68 00 70 80 00       	push   $0x807000
+  801b2e:	e8 1f ed ff ff       	call   800852 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b33:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b36:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b3b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b3e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b43:	e8 77 fd ff ff       	call   8018bf <fsipc>
+  801b48:	89 c3                	mov    %eax,%ebx
+  801b4a:	83 c4 10             	add    $0x10,%esp
+  801b4d:	85 c0                	test   %eax,%eax
+  801b4f:	78 19                	js     801b6a <open+0x75>
+	return fd2num(fd);
+  801b51:	83 ec 0c             	sub    $0xc,%esp
+  801b54:	ff 75 f4             	push   -0xc(%ebp)
+  801b57:	e8 84 f7 ff ff       	call   8012e0 <fd2num>
+  801b5c:	89 c3                	mov    %eax,%ebx
+  801b5e:	83 c4 10             	add    $0x10,%esp
+}
+  801b61:	89 d8                	mov    %ebx,%eax
+  801b63:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b66:	5b                   	pop    %ebx
+  801b67:	5e                   	pop    %esi
+  801b68:	5d                   	pop    %ebp
+  801b69:	c3                   	ret
+		fd_close(fd, 0);
+  801b6a:	83 ec 08             	sub    $0x8,%esp
+  801b6d:	6a 00                	push   $0x0
+  801b6f:	ff 75 f4             	push   -0xc(%ebp)
+  801b72:	e8 80 f8 ff ff       	call   8013f7 <fd_close>
+		return r;
+  801b77:	83 c4 10             	add    $0x10,%esp
+  801b7a:	eb e5                	jmp    801b61 <open+0x6c>
+		return -E_BAD_PATH;
+  801b7c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b81:	eb de                	jmp    801b61 <open+0x6c>
+
+00801b83 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801b83:	55                   	push   %ebp
+  801b84:	89 e5                	mov    %esp,%ebp
+  801b86:	53                   	push   %ebx
+  801b87:	83 ec 10             	sub    $0x10,%esp
+  801b8a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801b8d:	53                   	push   %ebx
+  801b8e:	e8 84 ec ff ff       	call   800817 <strlen>
+  801b93:	83 c4 10             	add    $0x10,%esp
+  801b96:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b9b:	7f 25                	jg     801bc2 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b9d:	83 ec 08             	sub    $0x8,%esp
+  801ba0:	53                   	push   %ebx
+  801ba1:	68 00 70 80 00       	push   $0x807000
+  801ba6:	e8 a7 ec ff ff       	call   800852 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801bab:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb0:	b8 07 00 00 00       	mov    $0x7,%eax
+  801bb5:	e8 05 fd ff ff       	call   8018bf <fsipc>
+  801bba:	83 c4 10             	add    $0x10,%esp
+}
+  801bbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bc0:	c9                   	leave
+  801bc1:	c3                   	ret
+		return -E_BAD_PATH;
+  801bc2:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801bc7:	eb f4                	jmp    801bbd <remove+0x3a>
+
+00801bc9 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801bc9:	55                   	push   %ebp
+  801bca:	89 e5                	mov    %esp,%ebp
+  801bcc:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801bcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd4:	b8 08 00 00 00       	mov    $0x8,%eax
+  801bd9:	e8 e1 fc ff ff       	call   8018bf <fsipc>
+}
+  801bde:	c9                   	leave
+  801bdf:	c3                   	ret
+
+00801be0 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801be0:	55                   	push   %ebp
+  801be1:	89 e5                	mov    %esp,%ebp
+  801be3:	53                   	push   %ebx
+  801be4:	83 ec 04             	sub    $0x4,%esp
+  801be7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801bea:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bef:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801bf4:	e8 c6 fc ff ff       	call   8018bf <fsipc>
+  801bf9:	85 c0                	test   %eax,%eax
+  801bfb:	78 3c                	js     801c39 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801bfd:	a1 00 70 80 00       	mov    0x807000,%eax
+  801c02:	89 03                	mov    %eax,(%ebx)
+  801c04:	a1 04 70 80 00       	mov    0x807004,%eax
+  801c09:	89 43 04             	mov    %eax,0x4(%ebx)
+  801c0c:	a1 08 70 80 00       	mov    0x807008,%eax
+  801c11:	89 43 08             	mov    %eax,0x8(%ebx)
+  801c14:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  801c19:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801c1c:	a1 10 70 80 00       	mov    0x807010,%eax
+  801c21:	89 43 10             	mov    %eax,0x10(%ebx)
+  801c24:	a1 14 70 80 00       	mov    0x807014,%eax
+  801c29:	89 43 14             	mov    %eax,0x14(%ebx)
+  801c2c:	a1 18 70 80 00       	mov    0x807018,%eax
+  801c31:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801c34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c3c:	c9                   	leave
+  801c3d:	c3                   	ret
+
+00801c3e <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801c3e:	55                   	push   %ebp
+  801c3f:	89 e5                	mov    %esp,%ebp
+  801c41:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801c44:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c47:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_BCSET, NULL);
+  801c4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c51:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c56:	e8 64 fc ff ff       	call   8018bf <fsipc>
+}
+  801c5b:	c9                   	leave
+  801c5c:	c3                   	ret
+
+00801c5d <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  801c5d:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801c61:	7f 01                	jg     801c64 <writebuf+0x7>
+  801c63:	c3                   	ret
+{
+  801c64:	55                   	push   %ebp
+  801c65:	89 e5                	mov    %esp,%ebp
+  801c67:	53                   	push   %ebx
+  801c68:	83 ec 08             	sub    $0x8,%esp
+  801c6b:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  801c6d:	ff 70 04             	push   0x4(%eax)
+  801c70:	8d 40 10             	lea    0x10(%eax),%eax
+  801c73:	50                   	push   %eax
+  801c74:	ff 33                	push   (%ebx)
+  801c76:	e8 0d fa ff ff       	call   801688 <write>
+		if (result > 0)
+  801c7b:	83 c4 10             	add    $0x10,%esp
+  801c7e:	85 c0                	test   %eax,%eax
+  801c80:	7e 03                	jle    801c85 <writebuf+0x28>
+			b->result += result;
+  801c82:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  801c85:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801c88:	74 0d                	je     801c97 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  801c8a:	85 c0                	test   %eax,%eax
+  801c8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c91:	0f 4f c2             	cmovg  %edx,%eax
+  801c94:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  801c97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c9a:	c9                   	leave
+  801c9b:	c3                   	ret
+
+00801c9c <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801c9c:	55                   	push   %ebp
+  801c9d:	89 e5                	mov    %esp,%ebp
+  801c9f:	53                   	push   %ebx
+  801ca0:	83 ec 04             	sub    $0x4,%esp
+  801ca3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801ca6:	8b 53 04             	mov    0x4(%ebx),%edx
+  801ca9:	8d 42 01             	lea    0x1(%edx),%eax
+  801cac:	89 43 04             	mov    %eax,0x4(%ebx)
+  801caf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801cb2:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801cb6:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801cbb:	74 05                	je     801cc2 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801cbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cc0:	c9                   	leave
+  801cc1:	c3                   	ret
+		writebuf(b);
+  801cc2:	89 d8                	mov    %ebx,%eax
+  801cc4:	e8 94 ff ff ff       	call   801c5d <writebuf>
+		b->idx = 0;
+  801cc9:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801cd0:	eb eb                	jmp    801cbd <putch+0x21>
+
+00801cd2 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801cd2:	55                   	push   %ebp
+  801cd3:	89 e5                	mov    %esp,%ebp
+  801cd5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cde:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801ce4:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801ceb:	00 00 00 
+	b.result = 0;
+  801cee:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801cf5:	00 00 00 
+	b.error = 1;
+  801cf8:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801cff:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801d02:	ff 75 10             	push   0x10(%ebp)
+  801d05:	ff 75 0c             	push   0xc(%ebp)
+  801d08:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801d0e:	50                   	push   %eax
+  801d0f:	68 9c 1c 80 00       	push   $0x801c9c
+  801d14:	e8 49 e6 ff ff       	call   800362 <vprintfmt>
+	if (b.idx > 0)
+  801d19:	83 c4 10             	add    $0x10,%esp
+  801d1c:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801d23:	7f 12                	jg     801d37 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801d25:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801d2b:	85 c0                	test   %eax,%eax
+  801d2d:	75 06                	jne    801d35 <vfprintf+0x63>
+  801d2f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  801d35:	c9                   	leave
+  801d36:	c3                   	ret
+		writebuf(&b);
+  801d37:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801d3d:	e8 1b ff ff ff       	call   801c5d <writebuf>
+  801d42:	eb e1                	jmp    801d25 <vfprintf+0x53>
+
+00801d44 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  801d44:	55                   	push   %ebp
+  801d45:	89 e5                	mov    %esp,%ebp
+  801d47:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801d4a:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  801d4d:	50                   	push   %eax
+  801d4e:	ff 75 0c             	push   0xc(%ebp)
+  801d51:	ff 75 08             	push   0x8(%ebp)
+  801d54:	e8 79 ff ff ff       	call   801cd2 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801d59:	c9                   	leave
+  801d5a:	c3                   	ret
+
+00801d5b <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  801d5b:	55                   	push   %ebp
+  801d5c:	89 e5                	mov    %esp,%ebp
+  801d5e:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801d61:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  801d64:	50                   	push   %eax
+  801d65:	ff 75 08             	push   0x8(%ebp)
+  801d68:	6a 01                	push   $0x1
+  801d6a:	e8 63 ff ff ff       	call   801cd2 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801d6f:	c9                   	leave
+  801d70:	c3                   	ret
+
+00801d71 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d71:	55                   	push   %ebp
+  801d72:	89 e5                	mov    %esp,%ebp
+  801d74:	56                   	push   %esi
+  801d75:	53                   	push   %ebx
+  801d76:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801d79:	83 ec 0c             	sub    $0xc,%esp
+  801d7c:	ff 75 08             	push   0x8(%ebp)
+  801d7f:	e8 6c f5 ff ff       	call   8012f0 <fd2data>
+  801d84:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801d86:	83 c4 08             	add    $0x8,%esp
+  801d89:	68 57 2d 80 00       	push   $0x802d57
+  801d8e:	53                   	push   %ebx
+  801d8f:	e8 be ea ff ff       	call   800852 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801d94:	8b 46 04             	mov    0x4(%esi),%eax
+  801d97:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801d9d:	2b 0e                	sub    (%esi),%ecx
+  801d9f:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801da4:	89 c8                	mov    %ecx,%eax
+  801da6:	f7 e2                	mul    %edx
+  801da8:	c1 ea 0c             	shr    $0xc,%edx
+  801dab:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801db1:	29 d1                	sub    %edx,%ecx
+  801db3:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801db9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801dc0:	00 00 00 
+	stat->st_dev = &devpipe;
+  801dc3:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  801dca:	30 80 00 
+	return 0;
+}
+  801dcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dd5:	5b                   	pop    %ebx
+  801dd6:	5e                   	pop    %esi
+  801dd7:	5d                   	pop    %ebp
+  801dd8:	c3                   	ret
+
+00801dd9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801dd9:	55                   	push   %ebp
+  801dda:	89 e5                	mov    %esp,%ebp
+  801ddc:	53                   	push   %ebx
+  801ddd:	83 ec 0c             	sub    $0xc,%esp
+  801de0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801de3:	53                   	push   %ebx
+  801de4:	6a 00                	push   $0x0
+  801de6:	e8 df ef ff ff       	call   800dca <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801deb:	89 1c 24             	mov    %ebx,(%esp)
+  801dee:	e8 fd f4 ff ff       	call   8012f0 <fd2data>
+  801df3:	83 c4 08             	add    $0x8,%esp
+  801df6:	50                   	push   %eax
+  801df7:	6a 00                	push   $0x0
+  801df9:	e8 cc ef ff ff       	call   800dca <sys_page_unmap>
+}
+  801dfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e01:	c9                   	leave
+  801e02:	c3                   	ret
+
+00801e03 <_pipeisclosed>:
+{
+  801e03:	55                   	push   %ebp
+  801e04:	89 e5                	mov    %esp,%ebp
+  801e06:	57                   	push   %edi
+  801e07:	56                   	push   %esi
+  801e08:	53                   	push   %ebx
+  801e09:	83 ec 1c             	sub    $0x1c,%esp
+  801e0c:	89 c7                	mov    %eax,%edi
+  801e0e:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801e10:	a1 24 60 80 00       	mov    0x806024,%eax
+  801e15:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801e18:	83 ec 0c             	sub    $0xc,%esp
+  801e1b:	57                   	push   %edi
+  801e1c:	e8 35 08 00 00       	call   802656 <pageref>
+  801e21:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e24:	89 34 24             	mov    %esi,(%esp)
+  801e27:	e8 2a 08 00 00       	call   802656 <pageref>
+		nn = thisenv->env_runs;
+  801e2c:	8b 15 24 60 80 00    	mov    0x806024,%edx
+  801e32:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801e35:	83 c4 10             	add    $0x10,%esp
+  801e38:	39 cb                	cmp    %ecx,%ebx
+  801e3a:	74 1b                	je     801e57 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801e3c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801e3f:	75 cf                	jne    801e10 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801e41:	8b 42 58             	mov    0x58(%edx),%eax
+  801e44:	6a 01                	push   $0x1
+  801e46:	50                   	push   %eax
+  801e47:	53                   	push   %ebx
+  801e48:	68 5e 2d 80 00       	push   $0x802d5e
+  801e4d:	e8 19 e4 ff ff       	call   80026b <cprintf>
+  801e52:	83 c4 10             	add    $0x10,%esp
+  801e55:	eb b9                	jmp    801e10 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801e57:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801e5a:	0f 94 c0             	sete   %al
+  801e5d:	0f b6 c0             	movzbl %al,%eax
+}
+  801e60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e63:	5b                   	pop    %ebx
+  801e64:	5e                   	pop    %esi
+  801e65:	5f                   	pop    %edi
+  801e66:	5d                   	pop    %ebp
+  801e67:	c3                   	ret
+
+00801e68 <devpipe_read>:
+{
+  801e68:	55                   	push   %ebp
+  801e69:	89 e5                	mov    %esp,%ebp
+  801e6b:	57                   	push   %edi
+  801e6c:	56                   	push   %esi
+  801e6d:	53                   	push   %ebx
+  801e6e:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801e71:	ff 75 08             	push   0x8(%ebp)
+  801e74:	e8 77 f4 ff ff       	call   8012f0 <fd2data>
+  801e79:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801e7b:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801e7e:	8d 40 04             	lea    0x4(%eax),%eax
+  801e81:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801e84:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801e87:	8b 0b                	mov    (%ebx),%ecx
+  801e89:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801e8f:	29 ce                	sub    %ecx,%esi
+  801e91:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e96:	f7 e6                	mul    %esi
+  801e98:	c1 ea 0c             	shr    $0xc,%edx
+  801e9b:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801ea1:	29 c6                	sub    %eax,%esi
+  801ea3:	89 f2                	mov    %esi,%edx
+  801ea5:	75 43                	jne    801eea <devpipe_read+0x82>
+		ref = pageref(p);
+  801ea7:	83 ec 0c             	sub    $0xc,%esp
+  801eaa:	53                   	push   %ebx
+  801eab:	e8 a6 07 00 00       	call   802656 <pageref>
+  801eb0:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801eb2:	89 da                	mov    %ebx,%edx
+  801eb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb7:	e8 47 ff ff ff       	call   801e03 <_pipeisclosed>
+  801ebc:	83 c4 10             	add    $0x10,%esp
+  801ebf:	85 c0                	test   %eax,%eax
+  801ec1:	0f 85 c1 00 00 00    	jne    801f88 <devpipe_read+0x120>
+	*sleeping = 1;
+  801ec7:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801ece:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801ed3:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801ed6:	75 ac                	jne    801e84 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801ed8:	83 ec 04             	sub    $0x4,%esp
+  801edb:	56                   	push   %esi
+  801edc:	57                   	push   %edi
+  801edd:	ff 75 e4             	push   -0x1c(%ebp)
+  801ee0:	e8 39 f3 ff ff       	call   80121e <sys_futex_wait>
+  801ee5:	83 c4 10             	add    $0x10,%esp
+  801ee8:	eb 9a                	jmp    801e84 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801eea:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801eed:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801ef1:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801ef3:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801ef8:	f7 e1                	mul    %ecx
+  801efa:	c1 ea 0b             	shr    $0xb,%edx
+  801efd:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801f03:	29 c1                	sub    %eax,%ecx
+  801f05:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801f07:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801f0c:	29 cf                	sub    %ecx,%edi
+  801f0e:	39 f7                	cmp    %esi,%edi
+  801f10:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801f13:	8d 43 10             	lea    0x10(%ebx),%eax
+  801f16:	83 ec 04             	sub    $0x4,%esp
+  801f19:	57                   	push   %edi
+  801f1a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f1d:	01 c2                	add    %eax,%edx
+  801f1f:	52                   	push   %edx
+  801f20:	ff 75 0c             	push   0xc(%ebp)
+  801f23:	e8 b0 ea ff ff       	call   8009d8 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801f28:	83 c4 0c             	add    $0xc,%esp
+  801f2b:	89 f1                	mov    %esi,%ecx
+  801f2d:	29 f9                	sub    %edi,%ecx
+  801f2f:	51                   	push   %ecx
+  801f30:	ff 75 e4             	push   -0x1c(%ebp)
+  801f33:	89 f8                	mov    %edi,%eax
+  801f35:	03 45 0c             	add    0xc(%ebp),%eax
+  801f38:	50                   	push   %eax
+  801f39:	e8 9a ea ff ff       	call   8009d8 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801f3e:	89 f1                	mov    %esi,%ecx
+  801f40:	03 0b                	add    (%ebx),%ecx
+  801f42:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f47:	f7 e1                	mul    %ecx
+  801f49:	c1 ea 0c             	shr    $0xc,%edx
+  801f4c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801f52:	29 d1                	sub    %edx,%ecx
+  801f54:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801f56:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801f5b:	83 c4 10             	add    $0x10,%esp
+  801f5e:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801f62:	75 0a                	jne    801f6e <devpipe_read+0x106>
+	return n;
+  801f64:	89 f0                	mov    %esi,%eax
+}
+  801f66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f69:	5b                   	pop    %ebx
+  801f6a:	5e                   	pop    %esi
+  801f6b:	5f                   	pop    %edi
+  801f6c:	5d                   	pop    %ebp
+  801f6d:	c3                   	ret
+		*sleeping = 0;
+  801f6e:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801f75:	83 ec 08             	sub    $0x8,%esp
+  801f78:	68 00 04 00 00       	push   $0x400
+  801f7d:	53                   	push   %ebx
+  801f7e:	e8 eb f2 ff ff       	call   80126e <sys_futex_wake>
+  801f83:	83 c4 10             	add    $0x10,%esp
+  801f86:	eb dc                	jmp    801f64 <devpipe_read+0xfc>
+			return 0;
+  801f88:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f8d:	eb d7                	jmp    801f66 <devpipe_read+0xfe>
+
+00801f8f <devpipe_write>:
+{
+  801f8f:	55                   	push   %ebp
+  801f90:	89 e5                	mov    %esp,%ebp
+  801f92:	57                   	push   %edi
+  801f93:	56                   	push   %esi
+  801f94:	53                   	push   %ebx
+  801f95:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801f98:	ff 75 08             	push   0x8(%ebp)
+  801f9b:	e8 50 f3 ff ff       	call   8012f0 <fd2data>
+  801fa0:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801fa2:	83 c4 10             	add    $0x10,%esp
+  801fa5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801fac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801faf:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801fb2:	0f 83 23 01 00 00    	jae    8020db <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801fb8:	8b 77 04             	mov    0x4(%edi),%esi
+  801fbb:	8b 1f                	mov    (%edi),%ebx
+  801fbd:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801fc3:	29 d9                	sub    %ebx,%ecx
+  801fc5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801fca:	f7 e1                	mul    %ecx
+  801fcc:	c1 ea 0c             	shr    $0xc,%edx
+  801fcf:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801fd5:	29 c1                	sub    %eax,%ecx
+  801fd7:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801fd9:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801fdf:	75 40                	jne    802021 <devpipe_write+0x92>
+			ref = pageref(p);
+  801fe1:	83 ec 0c             	sub    $0xc,%esp
+  801fe4:	57                   	push   %edi
+  801fe5:	e8 6c 06 00 00       	call   802656 <pageref>
+  801fea:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801fec:	89 fa                	mov    %edi,%edx
+  801fee:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff1:	e8 0d fe ff ff       	call   801e03 <_pipeisclosed>
+  801ff6:	83 c4 10             	add    $0x10,%esp
+  801ff9:	85 c0                	test   %eax,%eax
+  801ffb:	0f 85 d5 00 00 00    	jne    8020d6 <devpipe_write+0x147>
+	*sleeping = 1;
+  802001:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  802008:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80200d:	39 1f                	cmp    %ebx,(%edi)
+  80200f:	75 a7                	jne    801fb8 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  802011:	83 ec 04             	sub    $0x4,%esp
+  802014:	56                   	push   %esi
+  802015:	53                   	push   %ebx
+  802016:	57                   	push   %edi
+  802017:	e8 02 f2 ff ff       	call   80121e <sys_futex_wait>
+  80201c:	83 c4 10             	add    $0x10,%esp
+  80201f:	eb 97                	jmp    801fb8 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802021:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802024:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802027:	29 c1                	sub    %eax,%ecx
+  802029:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80202e:	89 d8                	mov    %ebx,%eax
+  802030:	29 d0                	sub    %edx,%eax
+  802032:	39 c1                	cmp    %eax,%ecx
+  802034:	0f 46 c1             	cmovbe %ecx,%eax
+  802037:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  802039:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80203e:	f7 e6                	mul    %esi
+  802040:	c1 ea 0b             	shr    $0xb,%edx
+  802043:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802049:	29 c6                	sub    %eax,%esi
+  80204b:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80204d:	29 f3                	sub    %esi,%ebx
+  80204f:	39 cb                	cmp    %ecx,%ebx
+  802051:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802054:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  802057:	8d 77 10             	lea    0x10(%edi),%esi
+  80205a:	83 ec 04             	sub    $0x4,%esp
+  80205d:	53                   	push   %ebx
+  80205e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802061:	03 45 0c             	add    0xc(%ebp),%eax
+  802064:	50                   	push   %eax
+  802065:	01 f2                	add    %esi,%edx
+  802067:	52                   	push   %edx
+  802068:	e8 6b e9 ff ff       	call   8009d8 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80206d:	83 c4 0c             	add    $0xc,%esp
+  802070:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802073:	29 d8                	sub    %ebx,%eax
+  802075:	50                   	push   %eax
+  802076:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802079:	01 d3                	add    %edx,%ebx
+  80207b:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80207e:	53                   	push   %ebx
+  80207f:	56                   	push   %esi
+  802080:	e8 53 e9 ff ff       	call   8009d8 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802085:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802088:	03 4f 04             	add    0x4(%edi),%ecx
+  80208b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802090:	f7 e1                	mul    %ecx
+  802092:	c1 ea 0c             	shr    $0xc,%edx
+  802095:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80209b:	29 d1                	sub    %edx,%ecx
+  80209d:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8020a0:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8020a5:	83 c4 10             	add    $0x10,%esp
+  8020a8:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8020ac:	75 0b                	jne    8020b9 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8020ae:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8020b1:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8020b4:	e9 f3 fe ff ff       	jmp    801fac <devpipe_write+0x1d>
+		*sleeping = 0;
+  8020b9:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8020c0:	83 ec 08             	sub    $0x8,%esp
+  8020c3:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  8020c8:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  8020cb:	50                   	push   %eax
+  8020cc:	e8 9d f1 ff ff       	call   80126e <sys_futex_wake>
+  8020d1:	83 c4 10             	add    $0x10,%esp
+  8020d4:	eb d8                	jmp    8020ae <devpipe_write+0x11f>
+				return 0;
+  8020d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020de:	5b                   	pop    %ebx
+  8020df:	5e                   	pop    %esi
+  8020e0:	5f                   	pop    %edi
+  8020e1:	5d                   	pop    %ebp
+  8020e2:	c3                   	ret
+
+008020e3 <pipe>:
+{
+  8020e3:	55                   	push   %ebp
+  8020e4:	89 e5                	mov    %esp,%ebp
+  8020e6:	56                   	push   %esi
+  8020e7:	53                   	push   %ebx
+  8020e8:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8020eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020ee:	50                   	push   %eax
+  8020ef:	e8 13 f2 ff ff       	call   801307 <fd_alloc>
+  8020f4:	89 c3                	mov    %eax,%ebx
+  8020f6:	83 c4 10             	add    $0x10,%esp
+  8020f9:	85 c0                	test   %eax,%eax
+  8020fb:	0f 88 23 01 00 00    	js     802224 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802101:	83 ec 04             	sub    $0x4,%esp
+  802104:	68 07 04 00 00       	push   $0x407
+  802109:	ff 75 f4             	push   -0xc(%ebp)
+  80210c:	6a 00                	push   $0x0
+  80210e:	e8 32 ec ff ff       	call   800d45 <sys_page_alloc>
+  802113:	89 c3                	mov    %eax,%ebx
+  802115:	83 c4 10             	add    $0x10,%esp
+  802118:	85 c0                	test   %eax,%eax
+  80211a:	0f 88 04 01 00 00    	js     802224 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802120:	83 ec 0c             	sub    $0xc,%esp
+  802123:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802126:	50                   	push   %eax
+  802127:	e8 db f1 ff ff       	call   801307 <fd_alloc>
+  80212c:	89 c3                	mov    %eax,%ebx
+  80212e:	83 c4 10             	add    $0x10,%esp
+  802131:	85 c0                	test   %eax,%eax
+  802133:	0f 88 db 00 00 00    	js     802214 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802139:	83 ec 04             	sub    $0x4,%esp
+  80213c:	68 07 04 00 00       	push   $0x407
+  802141:	ff 75 f0             	push   -0x10(%ebp)
+  802144:	6a 00                	push   $0x0
+  802146:	e8 fa eb ff ff       	call   800d45 <sys_page_alloc>
+  80214b:	89 c3                	mov    %eax,%ebx
+  80214d:	83 c4 10             	add    $0x10,%esp
+  802150:	85 c0                	test   %eax,%eax
+  802152:	0f 88 bc 00 00 00    	js     802214 <pipe+0x131>
+	va = fd2data(fd0);
+  802158:	83 ec 0c             	sub    $0xc,%esp
+  80215b:	ff 75 f4             	push   -0xc(%ebp)
+  80215e:	e8 8d f1 ff ff       	call   8012f0 <fd2data>
+  802163:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802165:	83 c4 0c             	add    $0xc,%esp
+  802168:	68 07 04 00 00       	push   $0x407
+  80216d:	50                   	push   %eax
+  80216e:	6a 00                	push   $0x0
+  802170:	e8 d0 eb ff ff       	call   800d45 <sys_page_alloc>
+  802175:	89 c3                	mov    %eax,%ebx
+  802177:	83 c4 10             	add    $0x10,%esp
+  80217a:	85 c0                	test   %eax,%eax
+  80217c:	0f 88 82 00 00 00    	js     802204 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802182:	83 ec 0c             	sub    $0xc,%esp
+  802185:	ff 75 f0             	push   -0x10(%ebp)
+  802188:	e8 63 f1 ff ff       	call   8012f0 <fd2data>
+  80218d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802194:	50                   	push   %eax
+  802195:	6a 00                	push   $0x0
+  802197:	56                   	push   %esi
+  802198:	6a 00                	push   $0x0
+  80219a:	e8 e9 eb ff ff       	call   800d88 <sys_page_map>
+  80219f:	89 c3                	mov    %eax,%ebx
+  8021a1:	83 c4 20             	add    $0x20,%esp
+  8021a4:	85 c0                	test   %eax,%eax
+  8021a6:	78 4e                	js     8021f6 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8021a8:	a1 20 30 80 00       	mov    0x803020,%eax
+  8021ad:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021b0:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8021b2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021b5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8021bc:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8021bf:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8021c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8021c4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8021cb:	83 ec 0c             	sub    $0xc,%esp
+  8021ce:	ff 75 f4             	push   -0xc(%ebp)
+  8021d1:	e8 0a f1 ff ff       	call   8012e0 <fd2num>
+  8021d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021d9:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8021db:	83 c4 04             	add    $0x4,%esp
+  8021de:	ff 75 f0             	push   -0x10(%ebp)
+  8021e1:	e8 fa f0 ff ff       	call   8012e0 <fd2num>
+  8021e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021e9:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8021ec:	83 c4 10             	add    $0x10,%esp
+  8021ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021f4:	eb 2e                	jmp    802224 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8021f6:	83 ec 08             	sub    $0x8,%esp
+  8021f9:	56                   	push   %esi
+  8021fa:	6a 00                	push   $0x0
+  8021fc:	e8 c9 eb ff ff       	call   800dca <sys_page_unmap>
+  802201:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802204:	83 ec 08             	sub    $0x8,%esp
+  802207:	ff 75 f0             	push   -0x10(%ebp)
+  80220a:	6a 00                	push   $0x0
+  80220c:	e8 b9 eb ff ff       	call   800dca <sys_page_unmap>
+  802211:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802214:	83 ec 08             	sub    $0x8,%esp
+  802217:	ff 75 f4             	push   -0xc(%ebp)
+  80221a:	6a 00                	push   $0x0
+  80221c:	e8 a9 eb ff ff       	call   800dca <sys_page_unmap>
+  802221:	83 c4 10             	add    $0x10,%esp
+}
+  802224:	89 d8                	mov    %ebx,%eax
+  802226:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802229:	5b                   	pop    %ebx
+  80222a:	5e                   	pop    %esi
+  80222b:	5d                   	pop    %ebp
+  80222c:	c3                   	ret
+
+0080222d <pipeisclosed>:
+{
+  80222d:	55                   	push   %ebp
+  80222e:	89 e5                	mov    %esp,%ebp
+  802230:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802233:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802236:	50                   	push   %eax
+  802237:	ff 75 08             	push   0x8(%ebp)
+  80223a:	e8 1c f1 ff ff       	call   80135b <fd_lookup>
+  80223f:	83 c4 10             	add    $0x10,%esp
+  802242:	85 c0                	test   %eax,%eax
+  802244:	78 18                	js     80225e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802246:	83 ec 0c             	sub    $0xc,%esp
+  802249:	ff 75 f4             	push   -0xc(%ebp)
+  80224c:	e8 9f f0 ff ff       	call   8012f0 <fd2data>
+  802251:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802253:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802256:	e8 a8 fb ff ff       	call   801e03 <_pipeisclosed>
+  80225b:	83 c4 10             	add    $0x10,%esp
+}
+  80225e:	c9                   	leave
+  80225f:	c3                   	ret
+
+00802260 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802260:	b8 00 00 00 00       	mov    $0x0,%eax
+  802265:	c3                   	ret
+
+00802266 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802266:	55                   	push   %ebp
+  802267:	89 e5                	mov    %esp,%ebp
+  802269:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80226c:	68 76 2d 80 00       	push   $0x802d76
+  802271:	ff 75 0c             	push   0xc(%ebp)
+  802274:	e8 d9 e5 ff ff       	call   800852 <strcpy>
+	return 0;
+}
+  802279:	b8 00 00 00 00       	mov    $0x0,%eax
+  80227e:	c9                   	leave
+  80227f:	c3                   	ret
+
+00802280 <devcons_write>:
+{
+  802280:	55                   	push   %ebp
+  802281:	89 e5                	mov    %esp,%ebp
+  802283:	57                   	push   %edi
+  802284:	56                   	push   %esi
+  802285:	53                   	push   %ebx
+  802286:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80228c:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802291:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802297:	eb 2e                	jmp    8022c7 <devcons_write+0x47>
+		m = n - tot;
+  802299:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80229c:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80229e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8022a3:	39 c3                	cmp    %eax,%ebx
+  8022a5:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8022a8:	83 ec 04             	sub    $0x4,%esp
+  8022ab:	53                   	push   %ebx
+  8022ac:	89 f0                	mov    %esi,%eax
+  8022ae:	03 45 0c             	add    0xc(%ebp),%eax
+  8022b1:	50                   	push   %eax
+  8022b2:	57                   	push   %edi
+  8022b3:	e8 20 e7 ff ff       	call   8009d8 <memmove>
+		sys_cputs(buf, m);
+  8022b8:	83 c4 08             	add    $0x8,%esp
+  8022bb:	53                   	push   %ebx
+  8022bc:	57                   	push   %edi
+  8022bd:	e8 b6 e9 ff ff       	call   800c78 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8022c2:	01 de                	add    %ebx,%esi
+  8022c4:	83 c4 10             	add    $0x10,%esp
+  8022c7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8022ca:	72 cd                	jb     802299 <devcons_write+0x19>
+}
+  8022cc:	89 f0                	mov    %esi,%eax
+  8022ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022d1:	5b                   	pop    %ebx
+  8022d2:	5e                   	pop    %esi
+  8022d3:	5f                   	pop    %edi
+  8022d4:	5d                   	pop    %ebp
+  8022d5:	c3                   	ret
+
+008022d6 <devcons_read>:
+{
+  8022d6:	55                   	push   %ebp
+  8022d7:	89 e5                	mov    %esp,%ebp
+  8022d9:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8022dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8022e5:	75 07                	jne    8022ee <devcons_read+0x18>
+  8022e7:	eb 1f                	jmp    802308 <devcons_read+0x32>
+		sys_yield();
+  8022e9:	e8 38 ea ff ff       	call   800d26 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8022ee:	e8 b4 e9 ff ff       	call   800ca7 <sys_cgetc>
+  8022f3:	85 c0                	test   %eax,%eax
+  8022f5:	74 f2                	je     8022e9 <devcons_read+0x13>
+	if (c < 0)
+  8022f7:	78 0f                	js     802308 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8022f9:	83 f8 04             	cmp    $0x4,%eax
+  8022fc:	74 0c                	je     80230a <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8022fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802301:	88 02                	mov    %al,(%edx)
+	return 1;
+  802303:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802308:	c9                   	leave
+  802309:	c3                   	ret
+		return 0;
+  80230a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80230f:	eb f7                	jmp    802308 <devcons_read+0x32>
+
+00802311 <cputchar>:
+{
+  802311:	55                   	push   %ebp
+  802312:	89 e5                	mov    %esp,%ebp
+  802314:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802317:	8b 45 08             	mov    0x8(%ebp),%eax
+  80231a:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80231d:	6a 01                	push   $0x1
+  80231f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802322:	50                   	push   %eax
+  802323:	e8 50 e9 ff ff       	call   800c78 <sys_cputs>
+}
+  802328:	83 c4 10             	add    $0x10,%esp
+  80232b:	c9                   	leave
+  80232c:	c3                   	ret
+
+0080232d <getchar>:
+{
+  80232d:	55                   	push   %ebp
+  80232e:	89 e5                	mov    %esp,%ebp
+  802330:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802333:	6a 01                	push   $0x1
+  802335:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802338:	50                   	push   %eax
+  802339:	6a 00                	push   $0x0
+  80233b:	e8 7a f2 ff ff       	call   8015ba <read>
+	if (r < 0)
+  802340:	83 c4 10             	add    $0x10,%esp
+  802343:	85 c0                	test   %eax,%eax
+  802345:	78 06                	js     80234d <getchar+0x20>
+	if (r < 1)
+  802347:	74 06                	je     80234f <getchar+0x22>
+	return c;
+  802349:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80234d:	c9                   	leave
+  80234e:	c3                   	ret
+		return -E_EOF;
+  80234f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802354:	eb f7                	jmp    80234d <getchar+0x20>
+
+00802356 <iscons>:
+{
+  802356:	55                   	push   %ebp
+  802357:	89 e5                	mov    %esp,%ebp
+  802359:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80235c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80235f:	50                   	push   %eax
+  802360:	ff 75 08             	push   0x8(%ebp)
+  802363:	e8 f3 ef ff ff       	call   80135b <fd_lookup>
+  802368:	83 c4 10             	add    $0x10,%esp
+  80236b:	85 c0                	test   %eax,%eax
+  80236d:	78 11                	js     802380 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80236f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802372:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  802378:	39 10                	cmp    %edx,(%eax)
+  80237a:	0f 94 c0             	sete   %al
+  80237d:	0f b6 c0             	movzbl %al,%eax
+}
+  802380:	c9                   	leave
+  802381:	c3                   	ret
+
+00802382 <opencons>:
+{
+  802382:	55                   	push   %ebp
+  802383:	89 e5                	mov    %esp,%ebp
+  802385:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802388:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80238b:	50                   	push   %eax
+  80238c:	e8 76 ef ff ff       	call   801307 <fd_alloc>
+  802391:	83 c4 10             	add    $0x10,%esp
+  802394:	85 c0                	test   %eax,%eax
+  802396:	78 3a                	js     8023d2 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802398:	83 ec 04             	sub    $0x4,%esp
+  80239b:	68 07 04 00 00       	push   $0x407
+  8023a0:	ff 75 f4             	push   -0xc(%ebp)
+  8023a3:	6a 00                	push   $0x0
+  8023a5:	e8 9b e9 ff ff       	call   800d45 <sys_page_alloc>
+  8023aa:	83 c4 10             	add    $0x10,%esp
+  8023ad:	85 c0                	test   %eax,%eax
+  8023af:	78 21                	js     8023d2 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8023b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023b4:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  8023ba:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8023bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023bf:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8023c6:	83 ec 0c             	sub    $0xc,%esp
+  8023c9:	50                   	push   %eax
+  8023ca:	e8 11 ef ff ff       	call   8012e0 <fd2num>
+  8023cf:	83 c4 10             	add    $0x10,%esp
+}
+  8023d2:	c9                   	leave
+  8023d3:	c3                   	ret
+
+008023d4 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8023d4:	55                   	push   %ebp
+  8023d5:	89 e5                	mov    %esp,%ebp
+  8023d7:	57                   	push   %edi
+  8023d8:	56                   	push   %esi
+  8023d9:	53                   	push   %ebx
+  8023da:	83 ec 14             	sub    $0x14,%esp
+  8023dd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023e0:	8b 75 14             	mov    0x14(%ebp),%esi
+  8023e3:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8023e6:	ff 75 10             	push   0x10(%ebp)
+  8023e9:	ff 75 0c             	push   0xc(%ebp)
+  8023ec:	e8 77 ed ff ff       	call   801168 <sys_ipc_recv_pages>
+  8023f1:	83 c4 10             	add    $0x10,%esp
+  8023f4:	85 c0                	test   %eax,%eax
+  8023f6:	78 46                	js     80243e <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8023f8:	85 ff                	test   %edi,%edi
+  8023fa:	74 0d                	je     802409 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  8023fc:	a1 24 60 80 00       	mov    0x806024,%eax
+  802401:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802407:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802409:	85 f6                	test   %esi,%esi
+  80240b:	74 0d                	je     80241a <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  80240d:	a1 24 60 80 00       	mov    0x806024,%eax
+  802412:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802418:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80241a:	85 db                	test   %ebx,%ebx
+  80241c:	74 0d                	je     80242b <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  80241e:	a1 24 60 80 00       	mov    0x806024,%eax
+  802423:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802429:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80242b:	a1 24 60 80 00       	mov    0x806024,%eax
+  802430:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802436:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802439:	5b                   	pop    %ebx
+  80243a:	5e                   	pop    %esi
+  80243b:	5f                   	pop    %edi
+  80243c:	5d                   	pop    %ebp
+  80243d:	c3                   	ret
+		if (from_env_store) {
+  80243e:	85 ff                	test   %edi,%edi
+  802440:	74 06                	je     802448 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  802442:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802448:	85 f6                	test   %esi,%esi
+  80244a:	74 06                	je     802452 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  80244c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802452:	85 db                	test   %ebx,%ebx
+  802454:	74 e0                	je     802436 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  802456:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80245c:	eb d8                	jmp    802436 <ipc_recv_pages+0x62>
+
+0080245e <ipc_recv>:
+{
+  80245e:	55                   	push   %ebp
+  80245f:	89 e5                	mov    %esp,%ebp
+  802461:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  802464:	6a 00                	push   $0x0
+  802466:	ff 75 10             	push   0x10(%ebp)
+  802469:	6a 01                	push   $0x1
+  80246b:	ff 75 0c             	push   0xc(%ebp)
+  80246e:	ff 75 08             	push   0x8(%ebp)
+  802471:	e8 5e ff ff ff       	call   8023d4 <ipc_recv_pages>
+}
+  802476:	c9                   	leave
+  802477:	c3                   	ret
+
+00802478 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802478:	55                   	push   %ebp
+  802479:	89 e5                	mov    %esp,%ebp
+  80247b:	56                   	push   %esi
+  80247c:	53                   	push   %ebx
+  80247d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802480:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  802483:	83 ec 0c             	sub    $0xc,%esp
+  802486:	ff 75 0c             	push   0xc(%ebp)
+  802489:	e8 0e ee ff ff       	call   80129c <sys_ipc_try_recv>
+  80248e:	83 c4 10             	add    $0x10,%esp
+  802491:	85 c0                	test   %eax,%eax
+  802493:	78 34                	js     8024c9 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802495:	85 f6                	test   %esi,%esi
+  802497:	74 0d                	je     8024a6 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  802499:	a1 24 60 80 00       	mov    0x806024,%eax
+  80249e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8024a4:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8024a6:	85 db                	test   %ebx,%ebx
+  8024a8:	74 0d                	je     8024b7 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8024aa:	a1 24 60 80 00       	mov    0x806024,%eax
+  8024af:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8024b5:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8024b7:	a1 24 60 80 00       	mov    0x806024,%eax
+  8024bc:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8024c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024c5:	5b                   	pop    %ebx
+  8024c6:	5e                   	pop    %esi
+  8024c7:	5d                   	pop    %ebp
+  8024c8:	c3                   	ret
+		if (from_env_store) {
+  8024c9:	85 f6                	test   %esi,%esi
+  8024cb:	74 06                	je     8024d3 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8024cd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8024d3:	85 db                	test   %ebx,%ebx
+  8024d5:	74 eb                	je     8024c2 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8024d7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8024dd:	eb e3                	jmp    8024c2 <ipc_try_recv+0x4a>
+
+008024df <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8024df:	55                   	push   %ebp
+  8024e0:	89 e5                	mov    %esp,%ebp
+  8024e2:	83 ec 14             	sub    $0x14,%esp
+  8024e5:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8024e8:	85 c0                	test   %eax,%eax
+  8024ea:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8024ef:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8024f2:	ff 75 18             	push   0x18(%ebp)
+  8024f5:	ff 75 14             	push   0x14(%ebp)
+  8024f8:	50                   	push   %eax
+  8024f9:	ff 75 0c             	push   0xc(%ebp)
+  8024fc:	ff 75 08             	push   0x8(%ebp)
+  8024ff:	e8 27 ec ff ff       	call   80112b <sys_ipc_send_pages>
+  802504:	83 c4 20             	add    $0x20,%esp
+  802507:	85 c0                	test   %eax,%eax
+  802509:	78 02                	js     80250d <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  80250b:	c9                   	leave
+  80250c:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  80250d:	50                   	push   %eax
+  80250e:	68 84 2d 80 00       	push   $0x802d84
+  802513:	68 80 00 00 00       	push   $0x80
+  802518:	68 b0 2d 80 00       	push   $0x802db0
+  80251d:	e8 6e dc ff ff       	call   800190 <_panic>
+
+00802522 <ipc_send>:
+{
+  802522:	55                   	push   %ebp
+  802523:	89 e5                	mov    %esp,%ebp
+  802525:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  802528:	ff 75 14             	push   0x14(%ebp)
+  80252b:	6a 01                	push   $0x1
+  80252d:	ff 75 10             	push   0x10(%ebp)
+  802530:	ff 75 0c             	push   0xc(%ebp)
+  802533:	ff 75 08             	push   0x8(%ebp)
+  802536:	e8 a4 ff ff ff       	call   8024df <ipc_send_pages>
+}
+  80253b:	83 c4 20             	add    $0x20,%esp
+  80253e:	c9                   	leave
+  80253f:	c3                   	ret
+
+00802540 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802540:	55                   	push   %ebp
+  802541:	89 e5                	mov    %esp,%ebp
+  802543:	83 ec 14             	sub    $0x14,%esp
+  802546:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802549:	85 c0                	test   %eax,%eax
+  80254b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802550:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802553:	ff 75 18             	push   0x18(%ebp)
+  802556:	ff 75 14             	push   0x14(%ebp)
+  802559:	50                   	push   %eax
+  80255a:	ff 75 0c             	push   0xc(%ebp)
+  80255d:	ff 75 08             	push   0x8(%ebp)
+  802560:	e8 57 ec ff ff       	call   8011bc <sys_ipc_call>
+  802565:	83 c4 20             	add    $0x20,%esp
+  802568:	85 c0                	test   %eax,%eax
+  80256a:	78 0b                	js     802577 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  80256c:	a1 24 60 80 00       	mov    0x806024,%eax
+  802571:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802577:	c9                   	leave
+  802578:	c3                   	ret
+
+00802579 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  802579:	55                   	push   %ebp
+  80257a:	89 e5                	mov    %esp,%ebp
+  80257c:	57                   	push   %edi
+  80257d:	56                   	push   %esi
+  80257e:	53                   	push   %ebx
+  80257f:	83 ec 18             	sub    $0x18,%esp
+  802582:	8b 45 10             	mov    0x10(%ebp),%eax
+  802585:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  802588:	8b 75 20             	mov    0x20(%ebp),%esi
+  80258b:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80258e:	85 c0                	test   %eax,%eax
+  802590:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802595:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802598:	ff 75 18             	push   0x18(%ebp)
+  80259b:	ff 75 14             	push   0x14(%ebp)
+  80259e:	50                   	push   %eax
+  80259f:	ff 75 0c             	push   0xc(%ebp)
+  8025a2:	ff 75 08             	push   0x8(%ebp)
+  8025a5:	e8 53 ec ff ff       	call   8011fd <sys_ipc_reply_recv>
+  8025aa:	83 c4 20             	add    $0x20,%esp
+  8025ad:	85 c0                	test   %eax,%eax
+  8025af:	78 46                	js     8025f7 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8025b1:	85 ff                	test   %edi,%edi
+  8025b3:	74 0d                	je     8025c2 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8025b5:	a1 24 60 80 00       	mov    0x806024,%eax
+  8025ba:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8025c0:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8025c2:	85 f6                	test   %esi,%esi
+  8025c4:	74 0d                	je     8025d3 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8025c6:	a1 24 60 80 00       	mov    0x806024,%eax
+  8025cb:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8025d1:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8025d3:	85 db                	test   %ebx,%ebx
+  8025d5:	74 0d                	je     8025e4 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8025d7:	a1 24 60 80 00       	mov    0x806024,%eax
+  8025dc:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8025e2:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8025e4:	a1 24 60 80 00       	mov    0x806024,%eax
+  8025e9:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8025ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025f2:	5b                   	pop    %ebx
+  8025f3:	5e                   	pop    %esi
+  8025f4:	5f                   	pop    %edi
+  8025f5:	5d                   	pop    %ebp
+  8025f6:	c3                   	ret
+		if (from_env_store) {
+  8025f7:	85 ff                	test   %edi,%edi
+  8025f9:	74 06                	je     802601 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  8025fb:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802601:	85 f6                	test   %esi,%esi
+  802603:	74 06                	je     80260b <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  802605:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80260b:	85 db                	test   %ebx,%ebx
+  80260d:	74 e0                	je     8025ef <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  80260f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802615:	eb d8                	jmp    8025ef <ipc_reply_recv+0x76>
+
+00802617 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802617:	55                   	push   %ebp
+  802618:	89 e5                	mov    %esp,%ebp
+  80261a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80261d:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  802622:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802625:	c1 e0 06             	shl    $0x6,%eax
+  802628:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80262d:	8b 40 50             	mov    0x50(%eax),%eax
+  802630:	39 c8                	cmp    %ecx,%eax
+  802632:	74 12                	je     802646 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802634:	83 c2 01             	add    $0x1,%edx
+  802637:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80263d:	75 e3                	jne    802622 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80263f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802644:	eb 0e                	jmp    802654 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802646:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802649:	c1 e0 06             	shl    $0x6,%eax
+  80264c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802651:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802654:	5d                   	pop    %ebp
+  802655:	c3                   	ret
+
+00802656 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802656:	55                   	push   %ebp
+  802657:	89 e5                	mov    %esp,%ebp
+  802659:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80265c:	89 c2                	mov    %eax,%edx
+  80265e:	c1 ea 16             	shr    $0x16,%edx
+  802661:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802668:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80266d:	f6 c1 01             	test   $0x1,%cl
+  802670:	74 1e                	je     802690 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  802672:	c1 e8 0c             	shr    $0xc,%eax
+  802675:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80267c:	a8 01                	test   $0x1,%al
+  80267e:	74 10                	je     802690 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802680:	c1 e8 0c             	shr    $0xc,%eax
+  802683:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802686:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  80268d:	0f b7 d2             	movzwl %dx,%edx
+}
+  802690:	89 d0                	mov    %edx,%eax
+  802692:	5d                   	pop    %ebp
+  802693:	c3                   	ret
+
+00802694 <udivmod>:
+  802694:	55                   	push   %ebp
+  802695:	57                   	push   %edi
+  802696:	56                   	push   %esi
+  802697:	53                   	push   %ebx
+  802698:	83 ec 24             	sub    $0x24,%esp
+  80269b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80269f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8026a3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8026a7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8026ab:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8026af:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8026b3:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8026b7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8026bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026c6:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8026cd:	00 
+  8026ce:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8026d5:	00 
+  8026d6:	89 fb                	mov    %edi,%ebx
+  8026d8:	eb 08                	jmp    8026e2 <udivmod+0x4e>
+  8026da:	83 e9 01             	sub    $0x1,%ecx
+  8026dd:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8026e0:	74 68                	je     80274a <udivmod+0xb6>
+  8026e2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8026e6:	01 c0                	add    %eax,%eax
+  8026e8:	89 c6                	mov    %eax,%esi
+  8026ea:	89 d7                	mov    %edx,%edi
+  8026ec:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026f0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026f4:	0f ad d0             	shrd   %cl,%edx,%eax
+  8026f7:	d3 ea                	shr    %cl,%edx
+  8026f9:	f6 c1 20             	test   $0x20,%cl
+  8026fc:	74 04                	je     802702 <udivmod+0x6e>
+  8026fe:	89 d0                	mov    %edx,%eax
+  802700:	31 d2                	xor    %edx,%edx
+  802702:	83 e0 01             	and    $0x1,%eax
+  802705:	89 04 24             	mov    %eax,(%esp)
+  802708:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80270f:	00 
+  802710:	8b 04 24             	mov    (%esp),%eax
+  802713:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802717:	09 f0                	or     %esi,%eax
+  802719:	09 fa                	or     %edi,%edx
+  80271b:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80271f:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802723:	39 f0                	cmp    %esi,%eax
+  802725:	89 d5                	mov    %edx,%ebp
+  802727:	19 fd                	sbb    %edi,%ebp
+  802729:	72 af                	jb     8026da <udivmod+0x46>
+  80272b:	29 f0                	sub    %esi,%eax
+  80272d:	19 fa                	sbb    %edi,%edx
+  80272f:	89 cf                	mov    %ecx,%edi
+  802731:	c1 ef 05             	shr    $0x5,%edi
+  802734:	83 e7 01             	and    $0x1,%edi
+  802737:	89 fe                	mov    %edi,%esi
+  802739:	83 f6 01             	xor    $0x1,%esi
+  80273c:	d3 e6                	shl    %cl,%esi
+  80273e:	d3 e7                	shl    %cl,%edi
+  802740:	09 74 24 18          	or     %esi,0x18(%esp)
+  802744:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802748:	eb 90                	jmp    8026da <udivmod+0x46>
+  80274a:	85 db                	test   %ebx,%ebx
+  80274c:	74 05                	je     802753 <udivmod+0xbf>
+  80274e:	89 03                	mov    %eax,(%ebx)
+  802750:	89 53 04             	mov    %edx,0x4(%ebx)
+  802753:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802757:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80275b:	83 c4 24             	add    $0x24,%esp
+  80275e:	5b                   	pop    %ebx
+  80275f:	5e                   	pop    %esi
+  802760:	5f                   	pop    %edi
+  802761:	5d                   	pop    %ebp
+  802762:	c3                   	ret
+
+00802763 <__udivdi3>:
+  802763:	83 ec 08             	sub    $0x8,%esp
+  802766:	6a 00                	push   $0x0
+  802768:	ff 74 24 1c          	push   0x1c(%esp)
+  80276c:	ff 74 24 1c          	push   0x1c(%esp)
+  802770:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802774:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802778:	e8 17 ff ff ff       	call   802694 <udivmod>
+  80277d:	83 c4 14             	add    $0x14,%esp
+  802780:	c3                   	ret
+
+00802781 <__umoddi3>:
+  802781:	83 ec 18             	sub    $0x18,%esp
+  802784:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802788:	50                   	push   %eax
+  802789:	ff 74 24 2c          	push   0x2c(%esp)
+  80278d:	ff 74 24 2c          	push   0x2c(%esp)
+  802791:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802795:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802799:	e8 f6 fe ff ff       	call   802694 <udivmod>
+  80279e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027a2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027a6:	83 c4 24             	add    $0x24,%esp
+  8027a9:	c3                   	ret
+
+008027aa <__divdi3>:
+  8027aa:	55                   	push   %ebp
+  8027ab:	57                   	push   %edi
+  8027ac:	56                   	push   %esi
+  8027ad:	53                   	push   %ebx
+  8027ae:	83 ec 10             	sub    $0x10,%esp
+  8027b1:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8027b5:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8027b9:	89 c6                	mov    %eax,%esi
+  8027bb:	89 d7                	mov    %edx,%edi
+  8027bd:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8027c1:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8027c5:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8027c9:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8027cd:	89 c5                	mov    %eax,%ebp
+  8027cf:	f7 dd                	neg    %ebp
+  8027d1:	89 d6                	mov    %edx,%esi
+  8027d3:	83 d6 00             	adc    $0x0,%esi
+  8027d6:	f7 de                	neg    %esi
+  8027d8:	0f 48 e8             	cmovs  %eax,%ebp
+  8027db:	0f 49 d6             	cmovns %esi,%edx
+  8027de:	6a 00                	push   $0x0
+  8027e0:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8027e4:	f7 de                	neg    %esi
+  8027e6:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8027ea:	83 d0 00             	adc    $0x0,%eax
+  8027ed:	f7 d8                	neg    %eax
+  8027ef:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  8027f4:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  8027f9:	50                   	push   %eax
+  8027fa:	56                   	push   %esi
+  8027fb:	89 e8                	mov    %ebp,%eax
+  8027fd:	e8 92 fe ff ff       	call   802694 <udivmod>
+  802802:	83 c4 10             	add    $0x10,%esp
+  802805:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  80280a:	78 08                	js     802814 <__divdi3+0x6a>
+  80280c:	83 c4 0c             	add    $0xc,%esp
+  80280f:	5b                   	pop    %ebx
+  802810:	5e                   	pop    %esi
+  802811:	5f                   	pop    %edi
+  802812:	5d                   	pop    %ebp
+  802813:	c3                   	ret
+  802814:	f7 d8                	neg    %eax
+  802816:	83 d2 00             	adc    $0x0,%edx
+  802819:	f7 da                	neg    %edx
+  80281b:	eb ef                	jmp    80280c <__divdi3+0x62>
+
+0080281d <__moddi3>:
+  80281d:	55                   	push   %ebp
+  80281e:	57                   	push   %edi
+  80281f:	56                   	push   %esi
+  802820:	53                   	push   %ebx
+  802821:	83 ec 18             	sub    $0x18,%esp
+  802824:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802828:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80282c:	89 f1                	mov    %esi,%ecx
+  80282e:	f7 d9                	neg    %ecx
+  802830:	89 da                	mov    %ebx,%edx
+  802832:	83 d2 00             	adc    $0x0,%edx
+  802835:	f7 da                	neg    %edx
+  802837:	0f 48 ce             	cmovs  %esi,%ecx
+  80283a:	0f 48 d3             	cmovs  %ebx,%edx
+  80283d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802841:	50                   	push   %eax
+  802842:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802846:	f7 de                	neg    %esi
+  802848:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  80284c:	83 d0 00             	adc    $0x0,%eax
+  80284f:	f7 d8                	neg    %eax
+  802851:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802856:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  80285b:	50                   	push   %eax
+  80285c:	56                   	push   %esi
+  80285d:	89 c8                	mov    %ecx,%eax
+  80285f:	e8 30 fe ff ff       	call   802694 <udivmod>
+  802864:	83 c4 10             	add    $0x10,%esp
+  802867:	85 db                	test   %ebx,%ebx
+  802869:	78 10                	js     80287b <__moddi3+0x5e>
+  80286b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80286f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802873:	83 c4 14             	add    $0x14,%esp
+  802876:	5b                   	pop    %ebx
+  802877:	5e                   	pop    %esi
+  802878:	5f                   	pop    %edi
+  802879:	5d                   	pop    %ebp
+  80287a:	c3                   	ret
+  80287b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80287f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802883:	f7 d8                	neg    %eax
+  802885:	83 d2 00             	adc    $0x0,%edx
+  802888:	f7 da                	neg    %edx
+  80288a:	eb e7                	jmp    802873 <__moddi3+0x56>
@@ -0,0 +1,5567 @@
+
+obj/user/divzero.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+int zero;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	zero = 0;
+  800039:	c7 05 04 40 80 00 00 	movl   $0x0,0x804004
+  800040:	00 00 00 
+	cprintf("1/0 is %08x!\n", 1/zero);
+  800043:	6a 00                	push   $0x0
+  800045:	68 a0 26 80 00       	push   $0x8026a0
+  80004a:	e8 fd 00 00 00       	call   80014c <cprintf>
+}
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	56                   	push   %esi
+  800058:	53                   	push   %ebx
+  800059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  80005f:	e8 84 0b 00 00       	call   800be8 <sys_getenvid>
+  800064:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800069:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80006c:	c1 e0 06             	shl    $0x6,%eax
+  80006f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800074:	a3 0c 40 80 00       	mov    %eax,0x80400c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800079:	85 db                	test   %ebx,%ebx
+  80007b:	7e 07                	jle    800084 <libmain+0x30>
+		binaryname = argv[0];
+  80007d:	8b 06                	mov    (%esi),%eax
+  80007f:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	56                   	push   %esi
+  800088:	53                   	push   %ebx
+  800089:	e8 a5 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80008e:	e8 0a 00 00 00       	call   80009d <exit>
+}
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800099:	5b                   	pop    %ebx
+  80009a:	5e                   	pop    %esi
+  80009b:	5d                   	pop    %ebp
+  80009c:	c3                   	ret
+
+0080009d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000a3:	e8 e4 12 00 00       	call   80138c <close_all>
+	sys_env_destroy(0);
+  8000a8:	83 ec 0c             	sub    $0xc,%esp
+  8000ab:	6a 00                	push   $0x0
+  8000ad:	e8 f5 0a 00 00       	call   800ba7 <sys_env_destroy>
+}
+  8000b2:	83 c4 10             	add    $0x10,%esp
+  8000b5:	c9                   	leave
+  8000b6:	c3                   	ret
+
+008000b7 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000b7:	55                   	push   %ebp
+  8000b8:	89 e5                	mov    %esp,%ebp
+  8000ba:	53                   	push   %ebx
+  8000bb:	83 ec 04             	sub    $0x4,%esp
+  8000be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000c1:	8b 13                	mov    (%ebx),%edx
+  8000c3:	8d 42 01             	lea    0x1(%edx),%eax
+  8000c6:	89 03                	mov    %eax,(%ebx)
+  8000c8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000cb:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000cf:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000d4:	74 09                	je     8000df <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000d6:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000dd:	c9                   	leave
+  8000de:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000df:	83 ec 08             	sub    $0x8,%esp
+  8000e2:	68 ff 00 00 00       	push   $0xff
+  8000e7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000ea:	50                   	push   %eax
+  8000eb:	e8 69 0a 00 00       	call   800b59 <sys_cputs>
+		b->idx = 0;
+  8000f0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8000f6:	83 c4 10             	add    $0x10,%esp
+  8000f9:	eb db                	jmp    8000d6 <putch+0x1f>
+
+008000fb <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8000fb:	55                   	push   %ebp
+  8000fc:	89 e5                	mov    %esp,%ebp
+  8000fe:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800104:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80010b:	00 00 00 
+	b.cnt = 0;
+  80010e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800115:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800118:	ff 75 0c             	push   0xc(%ebp)
+  80011b:	ff 75 08             	push   0x8(%ebp)
+  80011e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800124:	50                   	push   %eax
+  800125:	68 b7 00 80 00       	push   $0x8000b7
+  80012a:	e8 14 01 00 00       	call   800243 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80012f:	83 c4 08             	add    $0x8,%esp
+  800132:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800138:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80013e:	50                   	push   %eax
+  80013f:	e8 15 0a 00 00       	call   800b59 <sys_cputs>
+
+	return b.cnt;
+}
+  800144:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80014a:	c9                   	leave
+  80014b:	c3                   	ret
+
+0080014c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80014c:	55                   	push   %ebp
+  80014d:	89 e5                	mov    %esp,%ebp
+  80014f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800152:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800155:	50                   	push   %eax
+  800156:	ff 75 08             	push   0x8(%ebp)
+  800159:	e8 9d ff ff ff       	call   8000fb <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80015e:	c9                   	leave
+  80015f:	c3                   	ret
+
+00800160 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800160:	55                   	push   %ebp
+  800161:	89 e5                	mov    %esp,%ebp
+  800163:	57                   	push   %edi
+  800164:	56                   	push   %esi
+  800165:	53                   	push   %ebx
+  800166:	83 ec 1c             	sub    $0x1c,%esp
+  800169:	89 c7                	mov    %eax,%edi
+  80016b:	89 d6                	mov    %edx,%esi
+  80016d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800170:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800173:	89 d1                	mov    %edx,%ecx
+  800175:	89 c2                	mov    %eax,%edx
+  800177:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80017a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80017d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800180:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800183:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800186:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80018d:	39 c2                	cmp    %eax,%edx
+  80018f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800192:	72 3e                	jb     8001d2 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800194:	83 ec 0c             	sub    $0xc,%esp
+  800197:	ff 75 18             	push   0x18(%ebp)
+  80019a:	83 eb 01             	sub    $0x1,%ebx
+  80019d:	53                   	push   %ebx
+  80019e:	50                   	push   %eax
+  80019f:	83 ec 08             	sub    $0x8,%esp
+  8001a2:	ff 75 e4             	push   -0x1c(%ebp)
+  8001a5:	ff 75 e0             	push   -0x20(%ebp)
+  8001a8:	ff 75 dc             	push   -0x24(%ebp)
+  8001ab:	ff 75 d8             	push   -0x28(%ebp)
+  8001ae:	e8 c3 23 00 00       	call   802576 <__udivdi3>
+  8001b3:	83 c4 18             	add    $0x18,%esp
+  8001b6:	52                   	push   %edx
+  8001b7:	50                   	push   %eax
+  8001b8:	89 f2                	mov    %esi,%edx
+  8001ba:	89 f8                	mov    %edi,%eax
+  8001bc:	e8 9f ff ff ff       	call   800160 <printnum>
+  8001c1:	83 c4 20             	add    $0x20,%esp
+  8001c4:	eb 13                	jmp    8001d9 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001c6:	83 ec 08             	sub    $0x8,%esp
+  8001c9:	56                   	push   %esi
+  8001ca:	ff 75 18             	push   0x18(%ebp)
+  8001cd:	ff d7                	call   *%edi
+  8001cf:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001d2:	83 eb 01             	sub    $0x1,%ebx
+  8001d5:	85 db                	test   %ebx,%ebx
+  8001d7:	7f ed                	jg     8001c6 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001d9:	83 ec 08             	sub    $0x8,%esp
+  8001dc:	56                   	push   %esi
+  8001dd:	83 ec 04             	sub    $0x4,%esp
+  8001e0:	ff 75 e4             	push   -0x1c(%ebp)
+  8001e3:	ff 75 e0             	push   -0x20(%ebp)
+  8001e6:	ff 75 dc             	push   -0x24(%ebp)
+  8001e9:	ff 75 d8             	push   -0x28(%ebp)
+  8001ec:	e8 a3 23 00 00       	call   802594 <__umoddi3>
+  8001f1:	83 c4 14             	add    $0x14,%esp
+  8001f4:	0f be 80 b8 26 80 00 	movsbl 0x8026b8(%eax),%eax
+  8001fb:	50                   	push   %eax
+  8001fc:	ff d7                	call   *%edi
+}
+  8001fe:	83 c4 10             	add    $0x10,%esp
+  800201:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800204:	5b                   	pop    %ebx
+  800205:	5e                   	pop    %esi
+  800206:	5f                   	pop    %edi
+  800207:	5d                   	pop    %ebp
+  800208:	c3                   	ret
+
+00800209 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80020f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800213:	8b 10                	mov    (%eax),%edx
+  800215:	3b 50 04             	cmp    0x4(%eax),%edx
+  800218:	73 0a                	jae    800224 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80021a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80021d:	89 08                	mov    %ecx,(%eax)
+  80021f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800222:	88 02                	mov    %al,(%edx)
+}
+  800224:	5d                   	pop    %ebp
+  800225:	c3                   	ret
+
+00800226 <printfmt>:
+{
+  800226:	55                   	push   %ebp
+  800227:	89 e5                	mov    %esp,%ebp
+  800229:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80022c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80022f:	50                   	push   %eax
+  800230:	ff 75 10             	push   0x10(%ebp)
+  800233:	ff 75 0c             	push   0xc(%ebp)
+  800236:	ff 75 08             	push   0x8(%ebp)
+  800239:	e8 05 00 00 00       	call   800243 <vprintfmt>
+}
+  80023e:	83 c4 10             	add    $0x10,%esp
+  800241:	c9                   	leave
+  800242:	c3                   	ret
+
+00800243 <vprintfmt>:
+{
+  800243:	55                   	push   %ebp
+  800244:	89 e5                	mov    %esp,%ebp
+  800246:	57                   	push   %edi
+  800247:	56                   	push   %esi
+  800248:	53                   	push   %ebx
+  800249:	83 ec 2c             	sub    $0x2c,%esp
+  80024c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80024f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800252:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800255:	eb 0a                	jmp    800261 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800257:	83 ec 08             	sub    $0x8,%esp
+  80025a:	53                   	push   %ebx
+  80025b:	50                   	push   %eax
+  80025c:	ff d6                	call   *%esi
+  80025e:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800261:	83 c7 01             	add    $0x1,%edi
+  800264:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800268:	83 f8 25             	cmp    $0x25,%eax
+  80026b:	74 0c                	je     800279 <vprintfmt+0x36>
+			if (ch == '\0')
+  80026d:	85 c0                	test   %eax,%eax
+  80026f:	75 e6                	jne    800257 <vprintfmt+0x14>
+}
+  800271:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800274:	5b                   	pop    %ebx
+  800275:	5e                   	pop    %esi
+  800276:	5f                   	pop    %edi
+  800277:	5d                   	pop    %ebp
+  800278:	c3                   	ret
+		padc = ' ';
+  800279:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80027d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800284:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80028b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800292:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800297:	8d 47 01             	lea    0x1(%edi),%eax
+  80029a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80029d:	0f b6 17             	movzbl (%edi),%edx
+  8002a0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002a3:	3c 55                	cmp    $0x55,%al
+  8002a5:	0f 87 c5 03 00 00    	ja     800670 <vprintfmt+0x42d>
+  8002ab:	0f b6 c0             	movzbl %al,%eax
+  8002ae:	ff 24 85 40 28 80 00 	jmp    *0x802840(,%eax,4)
+  8002b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002b8:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002bc:	eb d9                	jmp    800297 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002be:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002c1:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002c5:	eb d0                	jmp    800297 <vprintfmt+0x54>
+  8002c7:	0f b6 d2             	movzbl %dl,%edx
+  8002ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002d5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002d8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002dc:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002df:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002e2:	83 f9 09             	cmp    $0x9,%ecx
+  8002e5:	77 55                	ja     80033c <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8002e7:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8002ea:	eb e9                	jmp    8002d5 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8002ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002ef:	8b 00                	mov    (%eax),%eax
+  8002f1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8002fa:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8002fd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800300:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800304:	79 91                	jns    800297 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800306:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800309:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80030c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800313:	eb 82                	jmp    800297 <vprintfmt+0x54>
+			if (width < 0)
+  800315:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800318:	85 d2                	test   %edx,%edx
+  80031a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031f:	0f 49 c2             	cmovns %edx,%eax
+  800322:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800325:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800328:	e9 6a ff ff ff       	jmp    800297 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80032d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800330:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800337:	e9 5b ff ff ff       	jmp    800297 <vprintfmt+0x54>
+  80033c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80033f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800342:	eb bc                	jmp    800300 <vprintfmt+0xbd>
+			lflag++;
+  800344:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800347:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80034a:	e9 48 ff ff ff       	jmp    800297 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80034f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800352:	8d 78 04             	lea    0x4(%eax),%edi
+  800355:	83 ec 08             	sub    $0x8,%esp
+  800358:	53                   	push   %ebx
+  800359:	ff 30                	push   (%eax)
+  80035b:	ff d6                	call   *%esi
+			break;
+  80035d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800360:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800363:	e9 63 02 00 00       	jmp    8005cb <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800368:	8b 45 14             	mov    0x14(%ebp),%eax
+  80036b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80036e:	8b 10                	mov    (%eax),%edx
+  800370:	89 d0                	mov    %edx,%eax
+  800372:	f7 d8                	neg    %eax
+  800374:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800377:	83 f8 12             	cmp    $0x12,%eax
+  80037a:	7f 23                	jg     80039f <vprintfmt+0x15c>
+  80037c:	8b 14 85 a0 29 80 00 	mov    0x8029a0(,%eax,4),%edx
+  800383:	85 d2                	test   %edx,%edx
+  800385:	74 18                	je     80039f <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800387:	52                   	push   %edx
+  800388:	68 dd 2a 80 00       	push   $0x802add
+  80038d:	53                   	push   %ebx
+  80038e:	56                   	push   %esi
+  80038f:	e8 92 fe ff ff       	call   800226 <printfmt>
+  800394:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800397:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80039a:	e9 2c 02 00 00       	jmp    8005cb <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80039f:	50                   	push   %eax
+  8003a0:	68 d0 26 80 00       	push   $0x8026d0
+  8003a5:	53                   	push   %ebx
+  8003a6:	56                   	push   %esi
+  8003a7:	e8 7a fe ff ff       	call   800226 <printfmt>
+  8003ac:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003af:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003b2:	e9 14 02 00 00       	jmp    8005cb <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ba:	83 c0 04             	add    $0x4,%eax
+  8003bd:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c3:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003c5:	85 c9                	test   %ecx,%ecx
+  8003c7:	b8 c9 26 80 00       	mov    $0x8026c9,%eax
+  8003cc:	0f 45 c1             	cmovne %ecx,%eax
+  8003cf:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003d2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d6:	7e 06                	jle    8003de <vprintfmt+0x19b>
+  8003d8:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003dc:	75 0b                	jne    8003e9 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003de:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003e1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003e4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003e7:	eb 5c                	jmp    800445 <vprintfmt+0x202>
+  8003e9:	83 ec 08             	sub    $0x8,%esp
+  8003ec:	ff 75 d0             	push   -0x30(%ebp)
+  8003ef:	ff 75 cc             	push   -0x34(%ebp)
+  8003f2:	e8 19 03 00 00       	call   800710 <strnlen>
+  8003f7:	89 c2                	mov    %eax,%edx
+  8003f9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003fc:	29 d0                	sub    %edx,%eax
+  8003fe:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800401:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800405:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800408:	89 75 08             	mov    %esi,0x8(%ebp)
+  80040b:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80040d:	eb 0e                	jmp    80041d <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80040f:	83 ec 08             	sub    $0x8,%esp
+  800412:	53                   	push   %ebx
+  800413:	57                   	push   %edi
+  800414:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800417:	83 ee 01             	sub    $0x1,%esi
+  80041a:	83 c4 10             	add    $0x10,%esp
+  80041d:	85 f6                	test   %esi,%esi
+  80041f:	7f ee                	jg     80040f <vprintfmt+0x1cc>
+  800421:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800424:	8b 75 08             	mov    0x8(%ebp),%esi
+  800427:	85 c0                	test   %eax,%eax
+  800429:	ba 00 00 00 00       	mov    $0x0,%edx
+  80042e:	0f 49 d0             	cmovns %eax,%edx
+  800431:	29 d0                	sub    %edx,%eax
+  800433:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800436:	eb a6                	jmp    8003de <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800438:	83 ec 08             	sub    $0x8,%esp
+  80043b:	53                   	push   %ebx
+  80043c:	52                   	push   %edx
+  80043d:	ff 55 08             	call   *0x8(%ebp)
+  800440:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800443:	89 f1                	mov    %esi,%ecx
+  800445:	8d 71 01             	lea    0x1(%ecx),%esi
+  800448:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80044c:	0f be d0             	movsbl %al,%edx
+  80044f:	85 d2                	test   %edx,%edx
+  800451:	74 28                	je     80047b <vprintfmt+0x238>
+  800453:	85 ff                	test   %edi,%edi
+  800455:	78 05                	js     80045c <vprintfmt+0x219>
+  800457:	83 ef 01             	sub    $0x1,%edi
+  80045a:	78 30                	js     80048c <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80045c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800460:	74 d6                	je     800438 <vprintfmt+0x1f5>
+  800462:	0f be c0             	movsbl %al,%eax
+  800465:	83 e8 20             	sub    $0x20,%eax
+  800468:	83 f8 5e             	cmp    $0x5e,%eax
+  80046b:	76 cb                	jbe    800438 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80046d:	83 ec 08             	sub    $0x8,%esp
+  800470:	53                   	push   %ebx
+  800471:	6a 3f                	push   $0x3f
+  800473:	ff 55 08             	call   *0x8(%ebp)
+  800476:	83 c4 10             	add    $0x10,%esp
+  800479:	eb c8                	jmp    800443 <vprintfmt+0x200>
+  80047b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80047e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800481:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800484:	01 d0                	add    %edx,%eax
+  800486:	29 c8                	sub    %ecx,%eax
+  800488:	89 c7                	mov    %eax,%edi
+  80048a:	eb 13                	jmp    80049f <vprintfmt+0x25c>
+  80048c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80048f:	eb ed                	jmp    80047e <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800491:	83 ec 08             	sub    $0x8,%esp
+  800494:	53                   	push   %ebx
+  800495:	6a 20                	push   $0x20
+  800497:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800499:	83 ef 01             	sub    $0x1,%edi
+  80049c:	83 c4 10             	add    $0x10,%esp
+  80049f:	85 ff                	test   %edi,%edi
+  8004a1:	7f ee                	jg     800491 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004a3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004a6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004a9:	e9 1d 01 00 00       	jmp    8005cb <vprintfmt+0x388>
+	if (lflag >= 2)
+  8004ae:	83 f9 01             	cmp    $0x1,%ecx
+  8004b1:	7f 1b                	jg     8004ce <vprintfmt+0x28b>
+	else if (lflag)
+  8004b3:	85 c9                	test   %ecx,%ecx
+  8004b5:	74 63                	je     80051a <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  8004b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ba:	8b 00                	mov    (%eax),%eax
+  8004bc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004bf:	99                   	cltd
+  8004c0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c6:	8d 40 04             	lea    0x4(%eax),%eax
+  8004c9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004cc:	eb 17                	jmp    8004e5 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  8004ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d1:	8b 50 04             	mov    0x4(%eax),%edx
+  8004d4:	8b 00                	mov    (%eax),%eax
+  8004d6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004d9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004df:	8d 40 08             	lea    0x8(%eax),%eax
+  8004e2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8004e5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004e8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8004eb:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8004f0:	85 c9                	test   %ecx,%ecx
+  8004f2:	0f 89 b9 00 00 00    	jns    8005b1 <vprintfmt+0x36e>
+				putch('-', putdat);
+  8004f8:	83 ec 08             	sub    $0x8,%esp
+  8004fb:	53                   	push   %ebx
+  8004fc:	6a 2d                	push   $0x2d
+  8004fe:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800500:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800503:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800506:	f7 da                	neg    %edx
+  800508:	83 d1 00             	adc    $0x0,%ecx
+  80050b:	f7 d9                	neg    %ecx
+  80050d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800510:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800515:	e9 97 00 00 00       	jmp    8005b1 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  80051a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051d:	8b 00                	mov    (%eax),%eax
+  80051f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800522:	99                   	cltd
+  800523:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800526:	8b 45 14             	mov    0x14(%ebp),%eax
+  800529:	8d 40 04             	lea    0x4(%eax),%eax
+  80052c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80052f:	eb b4                	jmp    8004e5 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  800531:	83 f9 01             	cmp    $0x1,%ecx
+  800534:	7f 1b                	jg     800551 <vprintfmt+0x30e>
+	else if (lflag)
+  800536:	85 c9                	test   %ecx,%ecx
+  800538:	74 2c                	je     800566 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  80053a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053d:	8b 10                	mov    (%eax),%edx
+  80053f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800544:	8d 40 04             	lea    0x4(%eax),%eax
+  800547:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80054a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80054f:	eb 60                	jmp    8005b1 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800551:	8b 45 14             	mov    0x14(%ebp),%eax
+  800554:	8b 10                	mov    (%eax),%edx
+  800556:	8b 48 04             	mov    0x4(%eax),%ecx
+  800559:	8d 40 08             	lea    0x8(%eax),%eax
+  80055c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80055f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800564:	eb 4b                	jmp    8005b1 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800566:	8b 45 14             	mov    0x14(%ebp),%eax
+  800569:	8b 10                	mov    (%eax),%edx
+  80056b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800570:	8d 40 04             	lea    0x4(%eax),%eax
+  800573:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800576:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80057b:	eb 34                	jmp    8005b1 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80057d:	83 f9 01             	cmp    $0x1,%ecx
+  800580:	7f 15                	jg     800597 <vprintfmt+0x354>
+	else if (lflag)
+  800582:	85 c9                	test   %ecx,%ecx
+  800584:	74 4d                	je     8005d3 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800586:	8b 45 14             	mov    0x14(%ebp),%eax
+  800589:	8b 00                	mov    (%eax),%eax
+  80058b:	99                   	cltd
+  80058c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80058f:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800592:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800595:	eb 11                	jmp    8005a8 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800597:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059a:	8b 50 04             	mov    0x4(%eax),%edx
+  80059d:	8b 00                	mov    (%eax),%eax
+  80059f:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005a2:	8d 49 08             	lea    0x8(%ecx),%ecx
+  8005a5:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  8005a8:	89 d1                	mov    %edx,%ecx
+  8005aa:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  8005ac:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005b1:	83 ec 0c             	sub    $0xc,%esp
+  8005b4:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8005b8:	50                   	push   %eax
+  8005b9:	ff 75 e0             	push   -0x20(%ebp)
+  8005bc:	57                   	push   %edi
+  8005bd:	51                   	push   %ecx
+  8005be:	52                   	push   %edx
+  8005bf:	89 da                	mov    %ebx,%edx
+  8005c1:	89 f0                	mov    %esi,%eax
+  8005c3:	e8 98 fb ff ff       	call   800160 <printnum>
+			break;
+  8005c8:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8005cb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005ce:	e9 8e fc ff ff       	jmp    800261 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  8005d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d6:	8b 00                	mov    (%eax),%eax
+  8005d8:	99                   	cltd
+  8005d9:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005dc:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8005df:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8005e2:	eb c4                	jmp    8005a8 <vprintfmt+0x365>
+			putch('0', putdat);
+  8005e4:	83 ec 08             	sub    $0x8,%esp
+  8005e7:	53                   	push   %ebx
+  8005e8:	6a 30                	push   $0x30
+  8005ea:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005ec:	83 c4 08             	add    $0x8,%esp
+  8005ef:	53                   	push   %ebx
+  8005f0:	6a 78                	push   $0x78
+  8005f2:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f7:	8b 10                	mov    (%eax),%edx
+  8005f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005fe:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800601:	8d 40 04             	lea    0x4(%eax),%eax
+  800604:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800607:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  80060c:	eb a3                	jmp    8005b1 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80060e:	83 f9 01             	cmp    $0x1,%ecx
+  800611:	7f 1b                	jg     80062e <vprintfmt+0x3eb>
+	else if (lflag)
+  800613:	85 c9                	test   %ecx,%ecx
+  800615:	74 2f                	je     800646 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800617:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061a:	8b 10                	mov    (%eax),%edx
+  80061c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800621:	8d 40 04             	lea    0x4(%eax),%eax
+  800624:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800627:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80062c:	eb 83                	jmp    8005b1 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80062e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800631:	8b 10                	mov    (%eax),%edx
+  800633:	8b 48 04             	mov    0x4(%eax),%ecx
+  800636:	8d 40 08             	lea    0x8(%eax),%eax
+  800639:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80063c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800641:	e9 6b ff ff ff       	jmp    8005b1 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800646:	8b 45 14             	mov    0x14(%ebp),%eax
+  800649:	8b 10                	mov    (%eax),%edx
+  80064b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800650:	8d 40 04             	lea    0x4(%eax),%eax
+  800653:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800656:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80065b:	e9 51 ff ff ff       	jmp    8005b1 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800660:	83 ec 08             	sub    $0x8,%esp
+  800663:	53                   	push   %ebx
+  800664:	6a 25                	push   $0x25
+  800666:	ff d6                	call   *%esi
+			break;
+  800668:	83 c4 10             	add    $0x10,%esp
+  80066b:	e9 5b ff ff ff       	jmp    8005cb <vprintfmt+0x388>
+			putch('%', putdat);
+  800670:	83 ec 08             	sub    $0x8,%esp
+  800673:	53                   	push   %ebx
+  800674:	6a 25                	push   $0x25
+  800676:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800678:	83 c4 10             	add    $0x10,%esp
+  80067b:	89 f8                	mov    %edi,%eax
+  80067d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800681:	74 05                	je     800688 <vprintfmt+0x445>
+  800683:	83 e8 01             	sub    $0x1,%eax
+  800686:	eb f5                	jmp    80067d <vprintfmt+0x43a>
+  800688:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80068b:	e9 3b ff ff ff       	jmp    8005cb <vprintfmt+0x388>
+
+00800690 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800690:	55                   	push   %ebp
+  800691:	89 e5                	mov    %esp,%ebp
+  800693:	83 ec 18             	sub    $0x18,%esp
+  800696:	8b 45 08             	mov    0x8(%ebp),%eax
+  800699:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80069c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80069f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006a3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006a6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006ad:	85 c0                	test   %eax,%eax
+  8006af:	74 26                	je     8006d7 <vsnprintf+0x47>
+  8006b1:	85 d2                	test   %edx,%edx
+  8006b3:	7e 22                	jle    8006d7 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006b5:	ff 75 14             	push   0x14(%ebp)
+  8006b8:	ff 75 10             	push   0x10(%ebp)
+  8006bb:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006be:	50                   	push   %eax
+  8006bf:	68 09 02 80 00       	push   $0x800209
+  8006c4:	e8 7a fb ff ff       	call   800243 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006c9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006cc:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006d2:	83 c4 10             	add    $0x10,%esp
+}
+  8006d5:	c9                   	leave
+  8006d6:	c3                   	ret
+		return -E_INVAL;
+  8006d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006dc:	eb f7                	jmp    8006d5 <vsnprintf+0x45>
+
+008006de <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006de:	55                   	push   %ebp
+  8006df:	89 e5                	mov    %esp,%ebp
+  8006e1:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006e4:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006e7:	50                   	push   %eax
+  8006e8:	ff 75 10             	push   0x10(%ebp)
+  8006eb:	ff 75 0c             	push   0xc(%ebp)
+  8006ee:	ff 75 08             	push   0x8(%ebp)
+  8006f1:	e8 9a ff ff ff       	call   800690 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8006f6:	c9                   	leave
+  8006f7:	c3                   	ret
+
+008006f8 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8006f8:	55                   	push   %ebp
+  8006f9:	89 e5                	mov    %esp,%ebp
+  8006fb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8006fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800703:	eb 03                	jmp    800708 <strlen+0x10>
+		n++;
+  800705:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800708:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80070c:	75 f7                	jne    800705 <strlen+0xd>
+	return n;
+}
+  80070e:	5d                   	pop    %ebp
+  80070f:	c3                   	ret
+
+00800710 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800710:	55                   	push   %ebp
+  800711:	89 e5                	mov    %esp,%ebp
+  800713:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800716:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800719:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071e:	eb 03                	jmp    800723 <strnlen+0x13>
+		n++;
+  800720:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800723:	39 d0                	cmp    %edx,%eax
+  800725:	74 08                	je     80072f <strnlen+0x1f>
+  800727:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80072b:	75 f3                	jne    800720 <strnlen+0x10>
+  80072d:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80072f:	89 d0                	mov    %edx,%eax
+  800731:	5d                   	pop    %ebp
+  800732:	c3                   	ret
+
+00800733 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800733:	55                   	push   %ebp
+  800734:	89 e5                	mov    %esp,%ebp
+  800736:	53                   	push   %ebx
+  800737:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80073a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80073d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800742:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800746:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800749:	83 c0 01             	add    $0x1,%eax
+  80074c:	84 d2                	test   %dl,%dl
+  80074e:	75 f2                	jne    800742 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800750:	89 c8                	mov    %ecx,%eax
+  800752:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800755:	c9                   	leave
+  800756:	c3                   	ret
+
+00800757 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800757:	55                   	push   %ebp
+  800758:	89 e5                	mov    %esp,%ebp
+  80075a:	53                   	push   %ebx
+  80075b:	83 ec 10             	sub    $0x10,%esp
+  80075e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800761:	53                   	push   %ebx
+  800762:	e8 91 ff ff ff       	call   8006f8 <strlen>
+  800767:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80076a:	ff 75 0c             	push   0xc(%ebp)
+  80076d:	01 d8                	add    %ebx,%eax
+  80076f:	50                   	push   %eax
+  800770:	e8 be ff ff ff       	call   800733 <strcpy>
+	return dst;
+}
+  800775:	89 d8                	mov    %ebx,%eax
+  800777:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80077a:	c9                   	leave
+  80077b:	c3                   	ret
+
+0080077c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80077c:	55                   	push   %ebp
+  80077d:	89 e5                	mov    %esp,%ebp
+  80077f:	56                   	push   %esi
+  800780:	53                   	push   %ebx
+  800781:	8b 75 08             	mov    0x8(%ebp),%esi
+  800784:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800787:	89 f3                	mov    %esi,%ebx
+  800789:	03 5d 10             	add    0x10(%ebp),%ebx
+  80078c:	89 f0                	mov    %esi,%eax
+  80078e:	eb 0f                	jmp    80079f <strncpy+0x23>
+		*dst++ = *src;
+  800790:	83 c0 01             	add    $0x1,%eax
+  800793:	0f b6 0a             	movzbl (%edx),%ecx
+  800796:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800799:	80 f9 01             	cmp    $0x1,%cl
+  80079c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80079f:	39 d8                	cmp    %ebx,%eax
+  8007a1:	75 ed                	jne    800790 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007a3:	89 f0                	mov    %esi,%eax
+  8007a5:	5b                   	pop    %ebx
+  8007a6:	5e                   	pop    %esi
+  8007a7:	5d                   	pop    %ebp
+  8007a8:	c3                   	ret
+
+008007a9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007a9:	55                   	push   %ebp
+  8007aa:	89 e5                	mov    %esp,%ebp
+  8007ac:	56                   	push   %esi
+  8007ad:	53                   	push   %ebx
+  8007ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007b4:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007b7:	89 f0                	mov    %esi,%eax
+  8007b9:	85 d2                	test   %edx,%edx
+  8007bb:	74 21                	je     8007de <strlcpy+0x35>
+  8007bd:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007c1:	89 f2                	mov    %esi,%edx
+  8007c3:	eb 09                	jmp    8007ce <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007c5:	83 c1 01             	add    $0x1,%ecx
+  8007c8:	83 c2 01             	add    $0x1,%edx
+  8007cb:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007ce:	39 c2                	cmp    %eax,%edx
+  8007d0:	74 09                	je     8007db <strlcpy+0x32>
+  8007d2:	0f b6 19             	movzbl (%ecx),%ebx
+  8007d5:	84 db                	test   %bl,%bl
+  8007d7:	75 ec                	jne    8007c5 <strlcpy+0x1c>
+  8007d9:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007db:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007de:	29 f0                	sub    %esi,%eax
+}
+  8007e0:	5b                   	pop    %ebx
+  8007e1:	5e                   	pop    %esi
+  8007e2:	5d                   	pop    %ebp
+  8007e3:	c3                   	ret
+
+008007e4 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007e4:	55                   	push   %ebp
+  8007e5:	89 e5                	mov    %esp,%ebp
+  8007e7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007ed:	eb 06                	jmp    8007f5 <strcmp+0x11>
+		p++, q++;
+  8007ef:	83 c1 01             	add    $0x1,%ecx
+  8007f2:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8007f5:	0f b6 01             	movzbl (%ecx),%eax
+  8007f8:	84 c0                	test   %al,%al
+  8007fa:	74 04                	je     800800 <strcmp+0x1c>
+  8007fc:	3a 02                	cmp    (%edx),%al
+  8007fe:	74 ef                	je     8007ef <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800800:	0f b6 c0             	movzbl %al,%eax
+  800803:	0f b6 12             	movzbl (%edx),%edx
+  800806:	29 d0                	sub    %edx,%eax
+}
+  800808:	5d                   	pop    %ebp
+  800809:	c3                   	ret
+
+0080080a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80080a:	55                   	push   %ebp
+  80080b:	89 e5                	mov    %esp,%ebp
+  80080d:	53                   	push   %ebx
+  80080e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800811:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800814:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800817:	eb 09                	jmp    800822 <strncmp+0x18>
+		n--, p++, q++;
+  800819:	83 ea 01             	sub    $0x1,%edx
+  80081c:	83 c0 01             	add    $0x1,%eax
+  80081f:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800822:	85 d2                	test   %edx,%edx
+  800824:	74 18                	je     80083e <strncmp+0x34>
+  800826:	0f b6 18             	movzbl (%eax),%ebx
+  800829:	84 db                	test   %bl,%bl
+  80082b:	74 04                	je     800831 <strncmp+0x27>
+  80082d:	3a 19                	cmp    (%ecx),%bl
+  80082f:	74 e8                	je     800819 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800831:	0f b6 00             	movzbl (%eax),%eax
+  800834:	0f b6 11             	movzbl (%ecx),%edx
+  800837:	29 d0                	sub    %edx,%eax
+}
+  800839:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083c:	c9                   	leave
+  80083d:	c3                   	ret
+		return 0;
+  80083e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800843:	eb f4                	jmp    800839 <strncmp+0x2f>
+
+00800845 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800845:	55                   	push   %ebp
+  800846:	89 e5                	mov    %esp,%ebp
+  800848:	8b 45 08             	mov    0x8(%ebp),%eax
+  80084b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80084f:	eb 03                	jmp    800854 <strchr+0xf>
+  800851:	83 c0 01             	add    $0x1,%eax
+  800854:	0f b6 10             	movzbl (%eax),%edx
+  800857:	84 d2                	test   %dl,%dl
+  800859:	74 06                	je     800861 <strchr+0x1c>
+		if (*s == c)
+  80085b:	38 ca                	cmp    %cl,%dl
+  80085d:	75 f2                	jne    800851 <strchr+0xc>
+  80085f:	eb 05                	jmp    800866 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800861:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800866:	5d                   	pop    %ebp
+  800867:	c3                   	ret
+
+00800868 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800868:	55                   	push   %ebp
+  800869:	89 e5                	mov    %esp,%ebp
+  80086b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80086e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800872:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800875:	38 ca                	cmp    %cl,%dl
+  800877:	74 09                	je     800882 <strfind+0x1a>
+  800879:	84 d2                	test   %dl,%dl
+  80087b:	74 05                	je     800882 <strfind+0x1a>
+	for (; *s; s++)
+  80087d:	83 c0 01             	add    $0x1,%eax
+  800880:	eb f0                	jmp    800872 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800882:	5d                   	pop    %ebp
+  800883:	c3                   	ret
+
+00800884 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800884:	55                   	push   %ebp
+  800885:	89 e5                	mov    %esp,%ebp
+  800887:	57                   	push   %edi
+  800888:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80088b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80088e:	85 c9                	test   %ecx,%ecx
+  800890:	74 20                	je     8008b2 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800892:	89 f8                	mov    %edi,%eax
+  800894:	09 c8                	or     %ecx,%eax
+  800896:	a8 03                	test   $0x3,%al
+  800898:	75 12                	jne    8008ac <memset+0x28>
+		c &= 0xFF;
+  80089a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80089e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008a4:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008a7:	fc                   	cld
+  8008a8:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008aa:	eb 06                	jmp    8008b2 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008af:	fc                   	cld
+  8008b0:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008b2:	89 f8                	mov    %edi,%eax
+  8008b4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008b7:	c9                   	leave
+  8008b8:	c3                   	ret
+
+008008b9 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008b9:	55                   	push   %ebp
+  8008ba:	89 e5                	mov    %esp,%ebp
+  8008bc:	57                   	push   %edi
+  8008bd:	56                   	push   %esi
+  8008be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008c4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008c7:	39 c6                	cmp    %eax,%esi
+  8008c9:	73 32                	jae    8008fd <memmove+0x44>
+  8008cb:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008ce:	39 d0                	cmp    %edx,%eax
+  8008d0:	73 2b                	jae    8008fd <memmove+0x44>
+		s += n;
+		d += n;
+  8008d2:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008d5:	89 d6                	mov    %edx,%esi
+  8008d7:	09 fe                	or     %edi,%esi
+  8008d9:	09 ce                	or     %ecx,%esi
+  8008db:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008e1:	75 0e                	jne    8008f1 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008e3:	83 ef 04             	sub    $0x4,%edi
+  8008e6:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008e9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008ec:	fd                   	std
+  8008ed:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008ef:	eb 09                	jmp    8008fa <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008f1:	83 ef 01             	sub    $0x1,%edi
+  8008f4:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8008f7:	fd                   	std
+  8008f8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8008fa:	fc                   	cld
+  8008fb:	eb 1a                	jmp    800917 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008fd:	89 f2                	mov    %esi,%edx
+  8008ff:	09 c2                	or     %eax,%edx
+  800901:	09 ca                	or     %ecx,%edx
+  800903:	f6 c2 03             	test   $0x3,%dl
+  800906:	75 0a                	jne    800912 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800908:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80090b:	89 c7                	mov    %eax,%edi
+  80090d:	fc                   	cld
+  80090e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800910:	eb 05                	jmp    800917 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800912:	89 c7                	mov    %eax,%edi
+  800914:	fc                   	cld
+  800915:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800917:	5e                   	pop    %esi
+  800918:	5f                   	pop    %edi
+  800919:	5d                   	pop    %ebp
+  80091a:	c3                   	ret
+
+0080091b <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80091b:	55                   	push   %ebp
+  80091c:	89 e5                	mov    %esp,%ebp
+  80091e:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800921:	ff 75 10             	push   0x10(%ebp)
+  800924:	ff 75 0c             	push   0xc(%ebp)
+  800927:	ff 75 08             	push   0x8(%ebp)
+  80092a:	e8 8a ff ff ff       	call   8008b9 <memmove>
+}
+  80092f:	c9                   	leave
+  800930:	c3                   	ret
+
+00800931 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800931:	55                   	push   %ebp
+  800932:	89 e5                	mov    %esp,%ebp
+  800934:	56                   	push   %esi
+  800935:	53                   	push   %ebx
+  800936:	8b 45 08             	mov    0x8(%ebp),%eax
+  800939:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80093c:	89 c6                	mov    %eax,%esi
+  80093e:	03 75 10             	add    0x10(%ebp),%esi
+  800941:	eb 06                	jmp    800949 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800943:	83 c0 01             	add    $0x1,%eax
+  800946:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800949:	39 f0                	cmp    %esi,%eax
+  80094b:	74 14                	je     800961 <memcmp+0x30>
+		if (*s1 != *s2)
+  80094d:	0f b6 08             	movzbl (%eax),%ecx
+  800950:	0f b6 1a             	movzbl (%edx),%ebx
+  800953:	38 d9                	cmp    %bl,%cl
+  800955:	74 ec                	je     800943 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800957:	0f b6 c1             	movzbl %cl,%eax
+  80095a:	0f b6 db             	movzbl %bl,%ebx
+  80095d:	29 d8                	sub    %ebx,%eax
+  80095f:	eb 05                	jmp    800966 <memcmp+0x35>
+	}
+
+	return 0;
+  800961:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800966:	5b                   	pop    %ebx
+  800967:	5e                   	pop    %esi
+  800968:	5d                   	pop    %ebp
+  800969:	c3                   	ret
+
+0080096a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80096a:	55                   	push   %ebp
+  80096b:	89 e5                	mov    %esp,%ebp
+  80096d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800970:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800973:	89 c2                	mov    %eax,%edx
+  800975:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800978:	eb 03                	jmp    80097d <memfind+0x13>
+  80097a:	83 c0 01             	add    $0x1,%eax
+  80097d:	39 d0                	cmp    %edx,%eax
+  80097f:	73 04                	jae    800985 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800981:	38 08                	cmp    %cl,(%eax)
+  800983:	75 f5                	jne    80097a <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800985:	5d                   	pop    %ebp
+  800986:	c3                   	ret
+
+00800987 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800987:	55                   	push   %ebp
+  800988:	89 e5                	mov    %esp,%ebp
+  80098a:	57                   	push   %edi
+  80098b:	56                   	push   %esi
+  80098c:	53                   	push   %ebx
+  80098d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800990:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800993:	eb 03                	jmp    800998 <strtol+0x11>
+		s++;
+  800995:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800998:	0f b6 02             	movzbl (%edx),%eax
+  80099b:	3c 20                	cmp    $0x20,%al
+  80099d:	74 f6                	je     800995 <strtol+0xe>
+  80099f:	3c 09                	cmp    $0x9,%al
+  8009a1:	74 f2                	je     800995 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009a3:	3c 2b                	cmp    $0x2b,%al
+  8009a5:	74 2a                	je     8009d1 <strtol+0x4a>
+	int neg = 0;
+  8009a7:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009ac:	3c 2d                	cmp    $0x2d,%al
+  8009ae:	74 2b                	je     8009db <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009b0:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009b6:	75 0f                	jne    8009c7 <strtol+0x40>
+  8009b8:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009bb:	74 28                	je     8009e5 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009bd:	85 db                	test   %ebx,%ebx
+  8009bf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009c4:	0f 44 d8             	cmove  %eax,%ebx
+  8009c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009cc:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009cf:	eb 46                	jmp    800a17 <strtol+0x90>
+		s++;
+  8009d1:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d9:	eb d5                	jmp    8009b0 <strtol+0x29>
+		s++, neg = 1;
+  8009db:	83 c2 01             	add    $0x1,%edx
+  8009de:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009e3:	eb cb                	jmp    8009b0 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009e5:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009e9:	74 0e                	je     8009f9 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009eb:	85 db                	test   %ebx,%ebx
+  8009ed:	75 d8                	jne    8009c7 <strtol+0x40>
+		s++, base = 8;
+  8009ef:	83 c2 01             	add    $0x1,%edx
+  8009f2:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8009f7:	eb ce                	jmp    8009c7 <strtol+0x40>
+		s += 2, base = 16;
+  8009f9:	83 c2 02             	add    $0x2,%edx
+  8009fc:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a01:	eb c4                	jmp    8009c7 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a03:	0f be c0             	movsbl %al,%eax
+  800a06:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a09:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a0c:	7d 3a                	jge    800a48 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a0e:	83 c2 01             	add    $0x1,%edx
+  800a11:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a15:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a17:	0f b6 02             	movzbl (%edx),%eax
+  800a1a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a1d:	89 f3                	mov    %esi,%ebx
+  800a1f:	80 fb 09             	cmp    $0x9,%bl
+  800a22:	76 df                	jbe    800a03 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a24:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a27:	89 f3                	mov    %esi,%ebx
+  800a29:	80 fb 19             	cmp    $0x19,%bl
+  800a2c:	77 08                	ja     800a36 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a2e:	0f be c0             	movsbl %al,%eax
+  800a31:	83 e8 57             	sub    $0x57,%eax
+  800a34:	eb d3                	jmp    800a09 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a36:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a39:	89 f3                	mov    %esi,%ebx
+  800a3b:	80 fb 19             	cmp    $0x19,%bl
+  800a3e:	77 08                	ja     800a48 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a40:	0f be c0             	movsbl %al,%eax
+  800a43:	83 e8 37             	sub    $0x37,%eax
+  800a46:	eb c1                	jmp    800a09 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a48:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a4c:	74 05                	je     800a53 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a4e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a51:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a53:	89 c8                	mov    %ecx,%eax
+  800a55:	f7 d8                	neg    %eax
+  800a57:	85 ff                	test   %edi,%edi
+  800a59:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a5c:	89 c8                	mov    %ecx,%eax
+  800a5e:	5b                   	pop    %ebx
+  800a5f:	5e                   	pop    %esi
+  800a60:	5f                   	pop    %edi
+  800a61:	5d                   	pop    %ebp
+  800a62:	c3                   	ret
+
+00800a63 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800a63:	55                   	push   %ebp
+  800a64:	89 e5                	mov    %esp,%ebp
+  800a66:	57                   	push   %edi
+  800a67:	56                   	push   %esi
+  800a68:	53                   	push   %ebx
+  800a69:	83 ec 0c             	sub    $0xc,%esp
+  800a6c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a6f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a72:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800a75:	85 ff                	test   %edi,%edi
+  800a77:	74 16                	je     800a8f <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800a79:	83 ec 04             	sub    $0x4,%esp
+  800a7c:	56                   	push   %esi
+  800a7d:	6a 00                	push   $0x0
+  800a7f:	53                   	push   %ebx
+  800a80:	e8 02 ff ff ff       	call   800987 <strtol>
+  800a85:	89 07                	mov    %eax,(%edi)
+  800a87:	83 c4 10             	add    $0x10,%esp
+  800a8a:	eb 03                	jmp    800a8f <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800a8c:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800a8f:	0f b6 03             	movzbl (%ebx),%eax
+  800a92:	3c 20                	cmp    $0x20,%al
+  800a94:	74 f6                	je     800a8c <strisl+0x29>
+  800a96:	3c 09                	cmp    $0x9,%al
+  800a98:	74 f2                	je     800a8c <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a9a:	3c 2b                	cmp    $0x2b,%al
+  800a9c:	74 23                	je     800ac1 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800a9e:	3c 2d                	cmp    $0x2d,%al
+  800aa0:	0f 94 c0             	sete   %al
+  800aa3:	0f b6 c0             	movzbl %al,%eax
+  800aa6:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aa8:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800aae:	75 41                	jne    800af1 <strisl+0x8e>
+  800ab0:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800ab3:	74 11                	je     800ac6 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ab5:	85 f6                	test   %esi,%esi
+  800ab7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800abc:	0f 44 f0             	cmove  %eax,%esi
+  800abf:	eb 30                	jmp    800af1 <strisl+0x8e>
+		s++;
+  800ac1:	83 c3 01             	add    $0x1,%ebx
+  800ac4:	eb e2                	jmp    800aa8 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ac6:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800aca:	74 0e                	je     800ada <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800acc:	85 f6                	test   %esi,%esi
+  800ace:	75 21                	jne    800af1 <strisl+0x8e>
+		s++, base = 8;
+  800ad0:	83 c3 01             	add    $0x1,%ebx
+  800ad3:	be 08 00 00 00       	mov    $0x8,%esi
+  800ad8:	eb 17                	jmp    800af1 <strisl+0x8e>
+		s += 2, base = 16;
+  800ada:	83 c3 02             	add    $0x2,%ebx
+  800add:	be 10 00 00 00       	mov    $0x10,%esi
+  800ae2:	eb 0d                	jmp    800af1 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ae4:	0f be c0             	movsbl %al,%eax
+  800ae7:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800aea:	39 f0                	cmp    %esi,%eax
+  800aec:	7d 38                	jge    800b26 <strisl+0xc3>
+			return 0;
+		s++;
+  800aee:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800af1:	0f b6 03             	movzbl (%ebx),%eax
+  800af4:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800af7:	80 fa 09             	cmp    $0x9,%dl
+  800afa:	76 e8                	jbe    800ae4 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800afc:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800aff:	80 fa 19             	cmp    $0x19,%dl
+  800b02:	77 08                	ja     800b0c <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800b04:	0f be c0             	movsbl %al,%eax
+  800b07:	83 e8 57             	sub    $0x57,%eax
+  800b0a:	eb de                	jmp    800aea <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b0c:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800b0f:	80 fa 19             	cmp    $0x19,%dl
+  800b12:	77 08                	ja     800b1c <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800b14:	0f be c0             	movsbl %al,%eax
+  800b17:	83 e8 37             	sub    $0x37,%eax
+  800b1a:	eb ce                	jmp    800aea <strisl+0x87>
+		else if (!*s)
+  800b1c:	84 c0                	test   %al,%al
+  800b1e:	0f 94 c0             	sete   %al
+  800b21:	0f b6 c0             	movzbl %al,%eax
+  800b24:	eb 05                	jmp    800b2b <strisl+0xc8>
+			return 0;
+  800b26:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800b2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b2e:	5b                   	pop    %ebx
+  800b2f:	5e                   	pop    %esi
+  800b30:	5f                   	pop    %edi
+  800b31:	5d                   	pop    %ebp
+  800b32:	c3                   	ret
+
+00800b33 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800b33:	55                   	push   %ebp
+  800b34:	89 e5                	mov    %esp,%ebp
+  800b36:	83 ec 10             	sub    $0x10,%esp
+  800b39:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800b3c:	89 c8                	mov    %ecx,%eax
+  800b3e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800b43:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800b46:	eb 0b                	jmp    800b53 <touch_mem+0x20>
+		c = *(char *)page;
+  800b48:	0f b6 10             	movzbl (%eax),%edx
+  800b4b:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800b4e:	05 00 10 00 00       	add    $0x1000,%eax
+  800b53:	39 c8                	cmp    %ecx,%eax
+  800b55:	72 f1                	jb     800b48 <touch_mem+0x15>
+}
+  800b57:	c9                   	leave
+  800b58:	c3                   	ret
+
+00800b59 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b59:	55                   	push   %ebp
+  800b5a:	89 e5                	mov    %esp,%ebp
+  800b5c:	57                   	push   %edi
+  800b5d:	56                   	push   %esi
+  800b5e:	53                   	push   %ebx
+	touch_mem(s, len);
+  800b5f:	ff 75 0c             	push   0xc(%ebp)
+  800b62:	ff 75 08             	push   0x8(%ebp)
+  800b65:	e8 c9 ff ff ff       	call   800b33 <touch_mem>
+	asm volatile("int %1\n"
+  800b6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b75:	89 c3                	mov    %eax,%ebx
+  800b77:	89 c7                	mov    %eax,%edi
+  800b79:	89 c6                	mov    %eax,%esi
+  800b7b:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b7d:	83 c4 08             	add    $0x8,%esp
+  800b80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b83:	5b                   	pop    %ebx
+  800b84:	5e                   	pop    %esi
+  800b85:	5f                   	pop    %edi
+  800b86:	5d                   	pop    %ebp
+  800b87:	c3                   	ret
+
+00800b88 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b88:	55                   	push   %ebp
+  800b89:	89 e5                	mov    %esp,%ebp
+  800b8b:	57                   	push   %edi
+  800b8c:	56                   	push   %esi
+  800b8d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b93:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b98:	89 d1                	mov    %edx,%ecx
+  800b9a:	89 d3                	mov    %edx,%ebx
+  800b9c:	89 d7                	mov    %edx,%edi
+  800b9e:	89 d6                	mov    %edx,%esi
+  800ba0:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ba2:	5b                   	pop    %ebx
+  800ba3:	5e                   	pop    %esi
+  800ba4:	5f                   	pop    %edi
+  800ba5:	5d                   	pop    %ebp
+  800ba6:	c3                   	ret
+
+00800ba7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ba7:	55                   	push   %ebp
+  800ba8:	89 e5                	mov    %esp,%ebp
+  800baa:	57                   	push   %edi
+  800bab:	56                   	push   %esi
+  800bac:	53                   	push   %ebx
+  800bad:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb8:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bbd:	89 cb                	mov    %ecx,%ebx
+  800bbf:	89 cf                	mov    %ecx,%edi
+  800bc1:	89 ce                	mov    %ecx,%esi
+  800bc3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bc5:	85 c0                	test   %eax,%eax
+  800bc7:	7f 08                	jg     800bd1 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bcc:	5b                   	pop    %ebx
+  800bcd:	5e                   	pop    %esi
+  800bce:	5f                   	pop    %edi
+  800bcf:	5d                   	pop    %ebp
+  800bd0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bd1:	83 ec 0c             	sub    $0xc,%esp
+  800bd4:	50                   	push   %eax
+  800bd5:	6a 03                	push   $0x3
+  800bd7:	68 0b 2a 80 00       	push   $0x802a0b
+  800bdc:	6a 23                	push   $0x23
+  800bde:	68 28 2a 80 00       	push   $0x802a28
+  800be3:	e8 b9 15 00 00       	call   8021a1 <_panic>
+
+00800be8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800be8:	55                   	push   %ebp
+  800be9:	89 e5                	mov    %esp,%ebp
+  800beb:	57                   	push   %edi
+  800bec:	56                   	push   %esi
+  800bed:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bee:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf3:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bf8:	89 d1                	mov    %edx,%ecx
+  800bfa:	89 d3                	mov    %edx,%ebx
+  800bfc:	89 d7                	mov    %edx,%edi
+  800bfe:	89 d6                	mov    %edx,%esi
+  800c00:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c02:	5b                   	pop    %ebx
+  800c03:	5e                   	pop    %esi
+  800c04:	5f                   	pop    %edi
+  800c05:	5d                   	pop    %ebp
+  800c06:	c3                   	ret
+
+00800c07 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c07:	55                   	push   %ebp
+  800c08:	89 e5                	mov    %esp,%ebp
+  800c0a:	57                   	push   %edi
+  800c0b:	56                   	push   %esi
+  800c0c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c12:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c17:	89 d1                	mov    %edx,%ecx
+  800c19:	89 d3                	mov    %edx,%ebx
+  800c1b:	89 d7                	mov    %edx,%edi
+  800c1d:	89 d6                	mov    %edx,%esi
+  800c1f:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c21:	5b                   	pop    %ebx
+  800c22:	5e                   	pop    %esi
+  800c23:	5f                   	pop    %edi
+  800c24:	5d                   	pop    %ebp
+  800c25:	c3                   	ret
+
+00800c26 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c26:	55                   	push   %ebp
+  800c27:	89 e5                	mov    %esp,%ebp
+  800c29:	57                   	push   %edi
+  800c2a:	56                   	push   %esi
+  800c2b:	53                   	push   %ebx
+  800c2c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c2f:	be 00 00 00 00       	mov    $0x0,%esi
+  800c34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3a:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c42:	89 f7                	mov    %esi,%edi
+  800c44:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c46:	85 c0                	test   %eax,%eax
+  800c48:	7f 08                	jg     800c52 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c4d:	5b                   	pop    %ebx
+  800c4e:	5e                   	pop    %esi
+  800c4f:	5f                   	pop    %edi
+  800c50:	5d                   	pop    %ebp
+  800c51:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c52:	83 ec 0c             	sub    $0xc,%esp
+  800c55:	50                   	push   %eax
+  800c56:	6a 04                	push   $0x4
+  800c58:	68 0b 2a 80 00       	push   $0x802a0b
+  800c5d:	6a 23                	push   $0x23
+  800c5f:	68 28 2a 80 00       	push   $0x802a28
+  800c64:	e8 38 15 00 00       	call   8021a1 <_panic>
+
+00800c69 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c69:	55                   	push   %ebp
+  800c6a:	89 e5                	mov    %esp,%ebp
+  800c6c:	57                   	push   %edi
+  800c6d:	56                   	push   %esi
+  800c6e:	53                   	push   %ebx
+  800c6f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c78:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c7d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c80:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c83:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c86:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c88:	85 c0                	test   %eax,%eax
+  800c8a:	7f 08                	jg     800c94 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c8f:	5b                   	pop    %ebx
+  800c90:	5e                   	pop    %esi
+  800c91:	5f                   	pop    %edi
+  800c92:	5d                   	pop    %ebp
+  800c93:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c94:	83 ec 0c             	sub    $0xc,%esp
+  800c97:	50                   	push   %eax
+  800c98:	6a 05                	push   $0x5
+  800c9a:	68 0b 2a 80 00       	push   $0x802a0b
+  800c9f:	6a 23                	push   $0x23
+  800ca1:	68 28 2a 80 00       	push   $0x802a28
+  800ca6:	e8 f6 14 00 00       	call   8021a1 <_panic>
+
+00800cab <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cab:	55                   	push   %ebp
+  800cac:	89 e5                	mov    %esp,%ebp
+  800cae:	57                   	push   %edi
+  800caf:	56                   	push   %esi
+  800cb0:	53                   	push   %ebx
+  800cb1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cbf:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cc4:	89 df                	mov    %ebx,%edi
+  800cc6:	89 de                	mov    %ebx,%esi
+  800cc8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cca:	85 c0                	test   %eax,%eax
+  800ccc:	7f 08                	jg     800cd6 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800cce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd1:	5b                   	pop    %ebx
+  800cd2:	5e                   	pop    %esi
+  800cd3:	5f                   	pop    %edi
+  800cd4:	5d                   	pop    %ebp
+  800cd5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cd6:	83 ec 0c             	sub    $0xc,%esp
+  800cd9:	50                   	push   %eax
+  800cda:	6a 06                	push   $0x6
+  800cdc:	68 0b 2a 80 00       	push   $0x802a0b
+  800ce1:	6a 23                	push   $0x23
+  800ce3:	68 28 2a 80 00       	push   $0x802a28
+  800ce8:	e8 b4 14 00 00       	call   8021a1 <_panic>
+
+00800ced <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800ced:	55                   	push   %ebp
+  800cee:	89 e5                	mov    %esp,%ebp
+  800cf0:	57                   	push   %edi
+  800cf1:	56                   	push   %esi
+  800cf2:	53                   	push   %ebx
+  800cf3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cf6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d01:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d06:	89 df                	mov    %ebx,%edi
+  800d08:	89 de                	mov    %ebx,%esi
+  800d0a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d0c:	85 c0                	test   %eax,%eax
+  800d0e:	7f 08                	jg     800d18 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d13:	5b                   	pop    %ebx
+  800d14:	5e                   	pop    %esi
+  800d15:	5f                   	pop    %edi
+  800d16:	5d                   	pop    %ebp
+  800d17:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d18:	83 ec 0c             	sub    $0xc,%esp
+  800d1b:	50                   	push   %eax
+  800d1c:	6a 18                	push   $0x18
+  800d1e:	68 0b 2a 80 00       	push   $0x802a0b
+  800d23:	6a 23                	push   $0x23
+  800d25:	68 28 2a 80 00       	push   $0x802a28
+  800d2a:	e8 72 14 00 00       	call   8021a1 <_panic>
+
+00800d2f <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800d2f:	55                   	push   %ebp
+  800d30:	89 e5                	mov    %esp,%ebp
+  800d32:	57                   	push   %edi
+  800d33:	56                   	push   %esi
+  800d34:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d35:	be 00 00 00 00       	mov    $0x0,%esi
+  800d3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d40:	b8 19 00 00 00       	mov    $0x19,%eax
+  800d45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d48:	89 f7                	mov    %esi,%edi
+  800d4a:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800d4c:	5b                   	pop    %ebx
+  800d4d:	5e                   	pop    %esi
+  800d4e:	5f                   	pop    %edi
+  800d4f:	5d                   	pop    %ebp
+  800d50:	c3                   	ret
+
+00800d51 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d51:	55                   	push   %ebp
+  800d52:	89 e5                	mov    %esp,%ebp
+  800d54:	57                   	push   %edi
+  800d55:	56                   	push   %esi
+  800d56:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d62:	be 00 00 00 00       	mov    $0x0,%esi
+  800d67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d6a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d6d:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800d6f:	5b                   	pop    %ebx
+  800d70:	5e                   	pop    %esi
+  800d71:	5f                   	pop    %edi
+  800d72:	5d                   	pop    %ebp
+  800d73:	c3                   	ret
+
+00800d74 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800d74:	55                   	push   %ebp
+  800d75:	89 e5                	mov    %esp,%ebp
+  800d77:	57                   	push   %edi
+  800d78:	56                   	push   %esi
+  800d79:	53                   	push   %ebx
+  800d7a:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800d7d:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800d80:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800d86:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800d89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d97:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d9a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d9c:	85 c0                	test   %eax,%eax
+  800d9e:	7f 08                	jg     800da8 <sys_page_map_range+0x34>
+}
+  800da0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da3:	5b                   	pop    %ebx
+  800da4:	5e                   	pop    %esi
+  800da5:	5f                   	pop    %edi
+  800da6:	5d                   	pop    %ebp
+  800da7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da8:	83 ec 0c             	sub    $0xc,%esp
+  800dab:	50                   	push   %eax
+  800dac:	6a 10                	push   $0x10
+  800dae:	68 0b 2a 80 00       	push   $0x802a0b
+  800db3:	6a 23                	push   $0x23
+  800db5:	68 28 2a 80 00       	push   $0x802a28
+  800dba:	e8 e2 13 00 00       	call   8021a1 <_panic>
+
+00800dbf <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800dbf:	55                   	push   %ebp
+  800dc0:	89 e5                	mov    %esp,%ebp
+  800dc2:	57                   	push   %edi
+  800dc3:	56                   	push   %esi
+  800dc4:	53                   	push   %ebx
+  800dc5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dc8:	be 00 00 00 00       	mov    $0x0,%esi
+  800dcd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd3:	b8 11 00 00 00       	mov    $0x11,%eax
+  800dd8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ddb:	89 f7                	mov    %esi,%edi
+  800ddd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ddf:	85 c0                	test   %eax,%eax
+  800de1:	7f 08                	jg     800deb <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800de3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de6:	5b                   	pop    %ebx
+  800de7:	5e                   	pop    %esi
+  800de8:	5f                   	pop    %edi
+  800de9:	5d                   	pop    %ebp
+  800dea:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800deb:	83 ec 0c             	sub    $0xc,%esp
+  800dee:	50                   	push   %eax
+  800def:	6a 11                	push   $0x11
+  800df1:	68 0b 2a 80 00       	push   $0x802a0b
+  800df6:	6a 23                	push   $0x23
+  800df8:	68 28 2a 80 00       	push   $0x802a28
+  800dfd:	e8 9f 13 00 00       	call   8021a1 <_panic>
+
+00800e02 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800e02:	55                   	push   %ebp
+  800e03:	89 e5                	mov    %esp,%ebp
+  800e05:	57                   	push   %edi
+  800e06:	56                   	push   %esi
+  800e07:	53                   	push   %ebx
+  800e08:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e0b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e16:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800e1b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e1e:	89 f7                	mov    %esi,%edi
+  800e20:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e22:	85 c0                	test   %eax,%eax
+  800e24:	7f 08                	jg     800e2e <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e29:	5b                   	pop    %ebx
+  800e2a:	5e                   	pop    %esi
+  800e2b:	5f                   	pop    %edi
+  800e2c:	5d                   	pop    %ebp
+  800e2d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e2e:	83 ec 0c             	sub    $0xc,%esp
+  800e31:	50                   	push   %eax
+  800e32:	6a 1b                	push   $0x1b
+  800e34:	68 0b 2a 80 00       	push   $0x802a0b
+  800e39:	6a 23                	push   $0x23
+  800e3b:	68 28 2a 80 00       	push   $0x802a28
+  800e40:	e8 5c 13 00 00       	call   8021a1 <_panic>
+
+00800e45 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800e45:	55                   	push   %ebp
+  800e46:	89 e5                	mov    %esp,%ebp
+  800e48:	57                   	push   %edi
+  800e49:	56                   	push   %esi
+  800e4a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e50:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e55:	89 d1                	mov    %edx,%ecx
+  800e57:	89 d3                	mov    %edx,%ebx
+  800e59:	89 d7                	mov    %edx,%edi
+  800e5b:	89 d6                	mov    %edx,%esi
+  800e5d:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800e5f:	5b                   	pop    %ebx
+  800e60:	5e                   	pop    %esi
+  800e61:	5f                   	pop    %edi
+  800e62:	5d                   	pop    %ebp
+  800e63:	c3                   	ret
+
+00800e64 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e64:	55                   	push   %ebp
+  800e65:	89 e5                	mov    %esp,%ebp
+  800e67:	57                   	push   %edi
+  800e68:	56                   	push   %esi
+  800e69:	53                   	push   %ebx
+  800e6a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e78:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e7d:	89 df                	mov    %ebx,%edi
+  800e7f:	89 de                	mov    %ebx,%esi
+  800e81:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e83:	85 c0                	test   %eax,%eax
+  800e85:	7f 08                	jg     800e8f <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8a:	5b                   	pop    %ebx
+  800e8b:	5e                   	pop    %esi
+  800e8c:	5f                   	pop    %edi
+  800e8d:	5d                   	pop    %ebp
+  800e8e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8f:	83 ec 0c             	sub    $0xc,%esp
+  800e92:	50                   	push   %eax
+  800e93:	6a 08                	push   $0x8
+  800e95:	68 0b 2a 80 00       	push   $0x802a0b
+  800e9a:	6a 23                	push   $0x23
+  800e9c:	68 28 2a 80 00       	push   $0x802a28
+  800ea1:	e8 fb 12 00 00       	call   8021a1 <_panic>
+
+00800ea6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ea6:	55                   	push   %ebp
+  800ea7:	89 e5                	mov    %esp,%ebp
+  800ea9:	57                   	push   %edi
+  800eaa:	56                   	push   %esi
+  800eab:	53                   	push   %ebx
+  800eac:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800eaf:	6a 44                	push   $0x44
+  800eb1:	ff 75 0c             	push   0xc(%ebp)
+  800eb4:	e8 7a fc ff ff       	call   800b33 <touch_mem>
+	asm volatile("int %1\n"
+  800eb9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec1:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ec6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec9:	89 df                	mov    %ebx,%edi
+  800ecb:	89 de                	mov    %ebx,%esi
+  800ecd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ecf:	83 c4 08             	add    $0x8,%esp
+  800ed2:	85 c0                	test   %eax,%eax
+  800ed4:	7f 08                	jg     800ede <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ed6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed9:	5b                   	pop    %ebx
+  800eda:	5e                   	pop    %esi
+  800edb:	5f                   	pop    %edi
+  800edc:	5d                   	pop    %ebp
+  800edd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ede:	83 ec 0c             	sub    $0xc,%esp
+  800ee1:	50                   	push   %eax
+  800ee2:	6a 09                	push   $0x9
+  800ee4:	68 0b 2a 80 00       	push   $0x802a0b
+  800ee9:	6a 23                	push   $0x23
+  800eeb:	68 28 2a 80 00       	push   $0x802a28
+  800ef0:	e8 ac 12 00 00       	call   8021a1 <_panic>
+
+00800ef5 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	57                   	push   %edi
+  800ef9:	56                   	push   %esi
+  800efa:	53                   	push   %ebx
+  800efb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800efe:	be 00 00 00 00       	mov    $0x0,%esi
+  800f03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f09:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800f0e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f11:	89 f7                	mov    %esi,%edi
+  800f13:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f15:	85 c0                	test   %eax,%eax
+  800f17:	7f 08                	jg     800f21 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800f19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1c:	5b                   	pop    %ebx
+  800f1d:	5e                   	pop    %esi
+  800f1e:	5f                   	pop    %edi
+  800f1f:	5d                   	pop    %ebp
+  800f20:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f21:	83 ec 0c             	sub    $0xc,%esp
+  800f24:	50                   	push   %eax
+  800f25:	6a 1a                	push   $0x1a
+  800f27:	68 0b 2a 80 00       	push   $0x802a0b
+  800f2c:	6a 23                	push   $0x23
+  800f2e:	68 28 2a 80 00       	push   $0x802a28
+  800f33:	e8 69 12 00 00       	call   8021a1 <_panic>
+
+00800f38 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  800f38:	55                   	push   %ebp
+  800f39:	89 e5                	mov    %esp,%ebp
+  800f3b:	57                   	push   %edi
+  800f3c:	56                   	push   %esi
+  800f3d:	53                   	push   %ebx
+  800f3e:	83 ec 0c             	sub    $0xc,%esp
+  800f41:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  800f44:	89 d8                	mov    %ebx,%eax
+  800f46:	c1 e0 05             	shl    $0x5,%eax
+  800f49:	50                   	push   %eax
+  800f4a:	ff 75 0c             	push   0xc(%ebp)
+  800f4d:	e8 e1 fb ff ff       	call   800b33 <touch_mem>
+	asm volatile("int %1\n"
+  800f52:	be 00 00 00 00       	mov    $0x0,%esi
+  800f57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5a:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f62:	89 f7                	mov    %esi,%edi
+  800f64:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f66:	83 c4 08             	add    $0x8,%esp
+  800f69:	85 c0                	test   %eax,%eax
+  800f6b:	7f 08                	jg     800f75 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  800f6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f70:	5b                   	pop    %ebx
+  800f71:	5e                   	pop    %esi
+  800f72:	5f                   	pop    %edi
+  800f73:	5d                   	pop    %ebp
+  800f74:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f75:	83 ec 0c             	sub    $0xc,%esp
+  800f78:	50                   	push   %eax
+  800f79:	6a 13                	push   $0x13
+  800f7b:	68 0b 2a 80 00       	push   $0x802a0b
+  800f80:	6a 23                	push   $0x23
+  800f82:	68 28 2a 80 00       	push   $0x802a28
+  800f87:	e8 15 12 00 00       	call   8021a1 <_panic>
+
+00800f8c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	57                   	push   %edi
+  800f90:	56                   	push   %esi
+  800f91:	53                   	push   %ebx
+  800f92:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fa5:	89 df                	mov    %ebx,%edi
+  800fa7:	89 de                	mov    %ebx,%esi
+  800fa9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fab:	85 c0                	test   %eax,%eax
+  800fad:	7f 08                	jg     800fb7 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800faf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb2:	5b                   	pop    %ebx
+  800fb3:	5e                   	pop    %esi
+  800fb4:	5f                   	pop    %edi
+  800fb5:	5d                   	pop    %ebp
+  800fb6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb7:	83 ec 0c             	sub    $0xc,%esp
+  800fba:	50                   	push   %eax
+  800fbb:	6a 0a                	push   $0xa
+  800fbd:	68 0b 2a 80 00       	push   $0x802a0b
+  800fc2:	6a 23                	push   $0x23
+  800fc4:	68 28 2a 80 00       	push   $0x802a28
+  800fc9:	e8 d3 11 00 00       	call   8021a1 <_panic>
+
+00800fce <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	57                   	push   %edi
+  800fd2:	56                   	push   %esi
+  800fd3:	53                   	push   %ebx
+  800fd4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  800fd7:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800fdd:	76 1d                	jbe    800ffc <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  800fdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fea:	be 01 00 00 00       	mov    $0x1,%esi
+  800fef:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ff2:	cd 30                	int    $0x30
+}
+  800ff4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff7:	5b                   	pop    %ebx
+  800ff8:	5e                   	pop    %esi
+  800ff9:	5f                   	pop    %edi
+  800ffa:	5d                   	pop    %ebp
+  800ffb:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  800ffc:	68 00 10 00 00       	push   $0x1000
+  801001:	53                   	push   %ebx
+  801002:	e8 2c fb ff ff       	call   800b33 <touch_mem>
+  801007:	83 c4 08             	add    $0x8,%esp
+  80100a:	eb d3                	jmp    800fdf <sys_ipc_send+0x11>
+
+0080100c <sys_ipc_send_pages>:
+{
+  80100c:	55                   	push   %ebp
+  80100d:	89 e5                	mov    %esp,%ebp
+  80100f:	57                   	push   %edi
+  801010:	56                   	push   %esi
+  801011:	53                   	push   %ebx
+  801012:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801015:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801018:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80101e:	76 18                	jbe    801038 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  801020:	8b 55 08             	mov    0x8(%ebp),%edx
+  801023:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801026:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80102b:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80102e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  801030:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801033:	5b                   	pop    %ebx
+  801034:	5e                   	pop    %esi
+  801035:	5f                   	pop    %edi
+  801036:	5d                   	pop    %ebp
+  801037:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801038:	89 f0                	mov    %esi,%eax
+  80103a:	c1 e0 0c             	shl    $0xc,%eax
+  80103d:	50                   	push   %eax
+  80103e:	53                   	push   %ebx
+  80103f:	e8 ef fa ff ff       	call   800b33 <touch_mem>
+  801044:	83 c4 08             	add    $0x8,%esp
+  801047:	eb d7                	jmp    801020 <sys_ipc_send_pages+0x14>
+
+00801049 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801049:	55                   	push   %ebp
+  80104a:	89 e5                	mov    %esp,%ebp
+  80104c:	57                   	push   %edi
+  80104d:	56                   	push   %esi
+  80104e:	53                   	push   %ebx
+  80104f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801052:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801057:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801062:	89 df                	mov    %ebx,%edi
+  801064:	89 de                	mov    %ebx,%esi
+  801066:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801068:	85 c0                	test   %eax,%eax
+  80106a:	7f 08                	jg     801074 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  80106c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80106f:	5b                   	pop    %ebx
+  801070:	5e                   	pop    %esi
+  801071:	5f                   	pop    %edi
+  801072:	5d                   	pop    %ebp
+  801073:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801074:	83 ec 0c             	sub    $0xc,%esp
+  801077:	50                   	push   %eax
+  801078:	6a 0d                	push   $0xd
+  80107a:	68 0b 2a 80 00       	push   $0x802a0b
+  80107f:	6a 23                	push   $0x23
+  801081:	68 28 2a 80 00       	push   $0x802a28
+  801086:	e8 16 11 00 00       	call   8021a1 <_panic>
+
+0080108b <sys_ipc_recv>:
+{
+  80108b:	55                   	push   %ebp
+  80108c:	89 e5                	mov    %esp,%ebp
+  80108e:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801091:	6a 01                	push   $0x1
+  801093:	ff 75 08             	push   0x8(%ebp)
+  801096:	e8 ae ff ff ff       	call   801049 <sys_ipc_recv_pages>
+}
+  80109b:	c9                   	leave
+  80109c:	c3                   	ret
+
+0080109d <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80109d:	55                   	push   %ebp
+  80109e:	89 e5                	mov    %esp,%ebp
+  8010a0:	57                   	push   %edi
+  8010a1:	56                   	push   %esi
+  8010a2:	53                   	push   %ebx
+  8010a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010a9:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  8010ac:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010b2:	77 04                	ja     8010b8 <sys_ipc_call+0x1b>
+  8010b4:	85 f6                	test   %esi,%esi
+  8010b6:	75 15                	jne    8010cd <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8010b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010be:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010c3:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8010c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c8:	5b                   	pop    %ebx
+  8010c9:	5e                   	pop    %esi
+  8010ca:	5f                   	pop    %edi
+  8010cb:	5d                   	pop    %ebp
+  8010cc:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8010cd:	89 f8                	mov    %edi,%eax
+  8010cf:	c1 e0 0c             	shl    $0xc,%eax
+  8010d2:	50                   	push   %eax
+  8010d3:	53                   	push   %ebx
+  8010d4:	e8 5a fa ff ff       	call   800b33 <touch_mem>
+  8010d9:	83 c4 08             	add    $0x8,%esp
+  8010dc:	eb da                	jmp    8010b8 <sys_ipc_call+0x1b>
+
+008010de <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8010de:	55                   	push   %ebp
+  8010df:	89 e5                	mov    %esp,%ebp
+  8010e1:	57                   	push   %edi
+  8010e2:	56                   	push   %esi
+  8010e3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ea:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010f5:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010f8:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8010fa:	5b                   	pop    %ebx
+  8010fb:	5e                   	pop    %esi
+  8010fc:	5f                   	pop    %edi
+  8010fd:	5d                   	pop    %ebp
+  8010fe:	c3                   	ret
+
+008010ff <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8010ff:	55                   	push   %ebp
+  801100:	89 e5                	mov    %esp,%ebp
+  801102:	57                   	push   %edi
+  801103:	56                   	push   %esi
+  801104:	53                   	push   %ebx
+  801105:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801108:	6a 04                	push   $0x4
+  80110a:	ff 75 08             	push   0x8(%ebp)
+  80110d:	e8 21 fa ff ff       	call   800b33 <touch_mem>
+	asm volatile("int %1\n"
+  801112:	be 00 00 00 00       	mov    $0x0,%esi
+  801117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111a:	b8 16 00 00 00       	mov    $0x16,%eax
+  80111f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801122:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801125:	89 f7                	mov    %esi,%edi
+  801127:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801129:	83 c4 08             	add    $0x8,%esp
+  80112c:	85 c0                	test   %eax,%eax
+  80112e:	7f 08                	jg     801138 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  801130:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801133:	5b                   	pop    %ebx
+  801134:	5e                   	pop    %esi
+  801135:	5f                   	pop    %edi
+  801136:	5d                   	pop    %ebp
+  801137:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801138:	83 ec 0c             	sub    $0xc,%esp
+  80113b:	50                   	push   %eax
+  80113c:	6a 16                	push   $0x16
+  80113e:	68 0b 2a 80 00       	push   $0x802a0b
+  801143:	6a 23                	push   $0x23
+  801145:	68 28 2a 80 00       	push   $0x802a28
+  80114a:	e8 52 10 00 00       	call   8021a1 <_panic>
+
+0080114f <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80114f:	55                   	push   %ebp
+  801150:	89 e5                	mov    %esp,%ebp
+  801152:	57                   	push   %edi
+  801153:	56                   	push   %esi
+  801154:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801155:	6a 04                	push   $0x4
+  801157:	ff 75 08             	push   0x8(%ebp)
+  80115a:	e8 d4 f9 ff ff       	call   800b33 <touch_mem>
+	asm volatile("int %1\n"
+  80115f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801164:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801167:	b8 17 00 00 00       	mov    $0x17,%eax
+  80116c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116f:	89 df                	mov    %ebx,%edi
+  801171:	89 de                	mov    %ebx,%esi
+  801173:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801178:	5b                   	pop    %ebx
+  801179:	5e                   	pop    %esi
+  80117a:	5f                   	pop    %edi
+  80117b:	5d                   	pop    %ebp
+  80117c:	c3                   	ret
+
+0080117d <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80117d:	55                   	push   %ebp
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	57                   	push   %edi
+  801181:	56                   	push   %esi
+  801182:	53                   	push   %ebx
+  801183:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801186:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801193:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801198:	89 df                	mov    %ebx,%edi
+  80119a:	89 de                	mov    %ebx,%esi
+  80119c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80119e:	85 c0                	test   %eax,%eax
+  8011a0:	7f 08                	jg     8011aa <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  8011a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a5:	5b                   	pop    %ebx
+  8011a6:	5e                   	pop    %esi
+  8011a7:	5f                   	pop    %edi
+  8011a8:	5d                   	pop    %ebp
+  8011a9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011aa:	83 ec 0c             	sub    $0xc,%esp
+  8011ad:	50                   	push   %eax
+  8011ae:	6a 0e                	push   $0xe
+  8011b0:	68 0b 2a 80 00       	push   $0x802a0b
+  8011b5:	6a 23                	push   $0x23
+  8011b7:	68 28 2a 80 00       	push   $0x802a28
+  8011bc:	e8 e0 0f 00 00       	call   8021a1 <_panic>
+
+008011c1 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8011c1:	55                   	push   %ebp
+  8011c2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011c7:	05 00 00 00 30       	add    $0x30000000,%eax
+  8011cc:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8011cf:	5d                   	pop    %ebp
+  8011d0:	c3                   	ret
+
+008011d1 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8011d1:	55                   	push   %ebp
+  8011d2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d7:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8011dc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011e1:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8011e6:	5d                   	pop    %ebp
+  8011e7:	c3                   	ret
+
+008011e8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8011e8:	55                   	push   %ebp
+  8011e9:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8011eb:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8011f0:	a8 01                	test   $0x1,%al
+  8011f2:	74 3c                	je     801230 <fd_alloc+0x48>
+  8011f4:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8011f9:	89 c2                	mov    %eax,%edx
+  8011fb:	c1 ea 0c             	shr    $0xc,%edx
+  8011fe:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801205:	89 c1                	mov    %eax,%ecx
+  801207:	05 00 10 00 00       	add    $0x1000,%eax
+  80120c:	f6 c2 01             	test   $0x1,%dl
+  80120f:	74 13                	je     801224 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801211:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801216:	75 e1                	jne    8011f9 <fd_alloc+0x11>
+  801218:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80121d:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801222:	eb 05                	jmp    801229 <fd_alloc+0x41>
+			return 0;
+  801224:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801229:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122c:	89 0a                	mov    %ecx,(%edx)
+}
+  80122e:	5d                   	pop    %ebp
+  80122f:	c3                   	ret
+  801230:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801235:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123a:	eb ed                	jmp    801229 <fd_alloc+0x41>
+
+0080123c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+  80123f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801242:	83 f8 1f             	cmp    $0x1f,%eax
+  801245:	77 30                	ja     801277 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801247:	c1 e0 0c             	shl    $0xc,%eax
+  80124a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80124f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801255:	f6 c2 01             	test   $0x1,%dl
+  801258:	74 24                	je     80127e <fd_lookup+0x42>
+  80125a:	89 c2                	mov    %eax,%edx
+  80125c:	c1 ea 0c             	shr    $0xc,%edx
+  80125f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801266:	f6 c2 01             	test   $0x1,%dl
+  801269:	74 1a                	je     801285 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80126b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80126e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801270:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801275:	5d                   	pop    %ebp
+  801276:	c3                   	ret
+		return -E_INVAL;
+  801277:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80127c:	eb f7                	jmp    801275 <fd_lookup+0x39>
+		return -E_INVAL;
+  80127e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801283:	eb f0                	jmp    801275 <fd_lookup+0x39>
+  801285:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80128a:	eb e9                	jmp    801275 <fd_lookup+0x39>
+
+0080128c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80128c:	55                   	push   %ebp
+  80128d:	89 e5                	mov    %esp,%ebp
+  80128f:	53                   	push   %ebx
+  801290:	83 ec 04             	sub    $0x4,%esp
+  801293:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801296:	b8 b4 2a 80 00       	mov    $0x802ab4,%eax
+  80129b:	8b 18                	mov    (%eax),%ebx
+  80129d:	85 db                	test   %ebx,%ebx
+  80129f:	74 0e                	je     8012af <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  8012a1:	83 c0 04             	add    $0x4,%eax
+  8012a4:	39 13                	cmp    %edx,(%ebx)
+  8012a6:	75 f3                	jne    80129b <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  8012a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ad:	eb 1f                	jmp    8012ce <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8012af:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8012b4:	8b 40 48             	mov    0x48(%eax),%eax
+  8012b7:	83 ec 04             	sub    $0x4,%esp
+  8012ba:	52                   	push   %edx
+  8012bb:	50                   	push   %eax
+  8012bc:	68 38 2a 80 00       	push   $0x802a38
+  8012c1:	e8 86 ee ff ff       	call   80014c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8012c6:	83 c4 10             	add    $0x10,%esp
+  8012c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8012ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012d1:	89 1a                	mov    %ebx,(%edx)
+}
+  8012d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012d6:	c9                   	leave
+  8012d7:	c3                   	ret
+
+008012d8 <fd_close>:
+{
+  8012d8:	55                   	push   %ebp
+  8012d9:	89 e5                	mov    %esp,%ebp
+  8012db:	57                   	push   %edi
+  8012dc:	56                   	push   %esi
+  8012dd:	53                   	push   %ebx
+  8012de:	83 ec 24             	sub    $0x24,%esp
+  8012e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012e4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012e7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012ea:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012eb:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8012f1:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012f4:	50                   	push   %eax
+  8012f5:	e8 42 ff ff ff       	call   80123c <fd_lookup>
+  8012fa:	89 c3                	mov    %eax,%ebx
+  8012fc:	83 c4 10             	add    $0x10,%esp
+  8012ff:	85 c0                	test   %eax,%eax
+  801301:	78 05                	js     801308 <fd_close+0x30>
+	    || fd != fd2)
+  801303:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801306:	74 16                	je     80131e <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801308:	89 f8                	mov    %edi,%eax
+  80130a:	84 c0                	test   %al,%al
+  80130c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801311:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801314:	89 d8                	mov    %ebx,%eax
+  801316:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801319:	5b                   	pop    %ebx
+  80131a:	5e                   	pop    %esi
+  80131b:	5f                   	pop    %edi
+  80131c:	5d                   	pop    %ebp
+  80131d:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80131e:	83 ec 08             	sub    $0x8,%esp
+  801321:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801324:	50                   	push   %eax
+  801325:	ff 36                	push   (%esi)
+  801327:	e8 60 ff ff ff       	call   80128c <dev_lookup>
+  80132c:	89 c3                	mov    %eax,%ebx
+  80132e:	83 c4 10             	add    $0x10,%esp
+  801331:	85 c0                	test   %eax,%eax
+  801333:	78 1a                	js     80134f <fd_close+0x77>
+		if (dev->dev_close)
+  801335:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801338:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80133b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801340:	85 c0                	test   %eax,%eax
+  801342:	74 0b                	je     80134f <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801344:	83 ec 0c             	sub    $0xc,%esp
+  801347:	56                   	push   %esi
+  801348:	ff d0                	call   *%eax
+  80134a:	89 c3                	mov    %eax,%ebx
+  80134c:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80134f:	83 ec 08             	sub    $0x8,%esp
+  801352:	56                   	push   %esi
+  801353:	6a 00                	push   $0x0
+  801355:	e8 51 f9 ff ff       	call   800cab <sys_page_unmap>
+	return r;
+  80135a:	83 c4 10             	add    $0x10,%esp
+  80135d:	eb b5                	jmp    801314 <fd_close+0x3c>
+
+0080135f <close>:
+
+int
+close(int fdnum)
+{
+  80135f:	55                   	push   %ebp
+  801360:	89 e5                	mov    %esp,%ebp
+  801362:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801365:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801368:	50                   	push   %eax
+  801369:	ff 75 08             	push   0x8(%ebp)
+  80136c:	e8 cb fe ff ff       	call   80123c <fd_lookup>
+  801371:	83 c4 10             	add    $0x10,%esp
+  801374:	85 c0                	test   %eax,%eax
+  801376:	79 02                	jns    80137a <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801378:	c9                   	leave
+  801379:	c3                   	ret
+		return fd_close(fd, 1);
+  80137a:	83 ec 08             	sub    $0x8,%esp
+  80137d:	6a 01                	push   $0x1
+  80137f:	ff 75 f4             	push   -0xc(%ebp)
+  801382:	e8 51 ff ff ff       	call   8012d8 <fd_close>
+  801387:	83 c4 10             	add    $0x10,%esp
+  80138a:	eb ec                	jmp    801378 <close+0x19>
+
+0080138c <close_all>:
+
+void
+close_all(void)
+{
+  80138c:	55                   	push   %ebp
+  80138d:	89 e5                	mov    %esp,%ebp
+  80138f:	53                   	push   %ebx
+  801390:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801393:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801398:	83 ec 0c             	sub    $0xc,%esp
+  80139b:	53                   	push   %ebx
+  80139c:	e8 be ff ff ff       	call   80135f <close>
+	for (i = 0; i < MAXFD; i++)
+  8013a1:	83 c3 01             	add    $0x1,%ebx
+  8013a4:	83 c4 10             	add    $0x10,%esp
+  8013a7:	83 fb 20             	cmp    $0x20,%ebx
+  8013aa:	75 ec                	jne    801398 <close_all+0xc>
+}
+  8013ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013af:	c9                   	leave
+  8013b0:	c3                   	ret
+
+008013b1 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8013b1:	55                   	push   %ebp
+  8013b2:	89 e5                	mov    %esp,%ebp
+  8013b4:	57                   	push   %edi
+  8013b5:	56                   	push   %esi
+  8013b6:	53                   	push   %ebx
+  8013b7:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8013ba:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013bd:	50                   	push   %eax
+  8013be:	ff 75 08             	push   0x8(%ebp)
+  8013c1:	e8 76 fe ff ff       	call   80123c <fd_lookup>
+  8013c6:	89 c3                	mov    %eax,%ebx
+  8013c8:	83 c4 10             	add    $0x10,%esp
+  8013cb:	85 c0                	test   %eax,%eax
+  8013cd:	78 7f                	js     80144e <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8013cf:	83 ec 0c             	sub    $0xc,%esp
+  8013d2:	ff 75 0c             	push   0xc(%ebp)
+  8013d5:	e8 85 ff ff ff       	call   80135f <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8013da:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013dd:	c1 e6 0c             	shl    $0xc,%esi
+  8013e0:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8013e6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8013e9:	89 3c 24             	mov    %edi,(%esp)
+  8013ec:	e8 e0 fd ff ff       	call   8011d1 <fd2data>
+  8013f1:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8013f3:	89 34 24             	mov    %esi,(%esp)
+  8013f6:	e8 d6 fd ff ff       	call   8011d1 <fd2data>
+  8013fb:	83 c4 10             	add    $0x10,%esp
+  8013fe:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801401:	89 d8                	mov    %ebx,%eax
+  801403:	c1 e8 16             	shr    $0x16,%eax
+  801406:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80140d:	a8 01                	test   $0x1,%al
+  80140f:	74 11                	je     801422 <dup+0x71>
+  801411:	89 d8                	mov    %ebx,%eax
+  801413:	c1 e8 0c             	shr    $0xc,%eax
+  801416:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80141d:	f6 c2 01             	test   $0x1,%dl
+  801420:	75 36                	jne    801458 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801422:	89 f8                	mov    %edi,%eax
+  801424:	c1 e8 0c             	shr    $0xc,%eax
+  801427:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80142e:	83 ec 0c             	sub    $0xc,%esp
+  801431:	25 07 0e 00 00       	and    $0xe07,%eax
+  801436:	50                   	push   %eax
+  801437:	56                   	push   %esi
+  801438:	6a 00                	push   $0x0
+  80143a:	57                   	push   %edi
+  80143b:	6a 00                	push   $0x0
+  80143d:	e8 27 f8 ff ff       	call   800c69 <sys_page_map>
+  801442:	89 c3                	mov    %eax,%ebx
+  801444:	83 c4 20             	add    $0x20,%esp
+  801447:	85 c0                	test   %eax,%eax
+  801449:	78 33                	js     80147e <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80144b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80144e:	89 d8                	mov    %ebx,%eax
+  801450:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801453:	5b                   	pop    %ebx
+  801454:	5e                   	pop    %esi
+  801455:	5f                   	pop    %edi
+  801456:	5d                   	pop    %ebp
+  801457:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801458:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80145f:	83 ec 0c             	sub    $0xc,%esp
+  801462:	25 07 0e 00 00       	and    $0xe07,%eax
+  801467:	50                   	push   %eax
+  801468:	ff 75 d4             	push   -0x2c(%ebp)
+  80146b:	6a 00                	push   $0x0
+  80146d:	53                   	push   %ebx
+  80146e:	6a 00                	push   $0x0
+  801470:	e8 f4 f7 ff ff       	call   800c69 <sys_page_map>
+  801475:	89 c3                	mov    %eax,%ebx
+  801477:	83 c4 20             	add    $0x20,%esp
+  80147a:	85 c0                	test   %eax,%eax
+  80147c:	79 a4                	jns    801422 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80147e:	83 ec 08             	sub    $0x8,%esp
+  801481:	56                   	push   %esi
+  801482:	6a 00                	push   $0x0
+  801484:	e8 22 f8 ff ff       	call   800cab <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801489:	83 c4 08             	add    $0x8,%esp
+  80148c:	ff 75 d4             	push   -0x2c(%ebp)
+  80148f:	6a 00                	push   $0x0
+  801491:	e8 15 f8 ff ff       	call   800cab <sys_page_unmap>
+	return r;
+  801496:	83 c4 10             	add    $0x10,%esp
+  801499:	eb b3                	jmp    80144e <dup+0x9d>
+
+0080149b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80149b:	55                   	push   %ebp
+  80149c:	89 e5                	mov    %esp,%ebp
+  80149e:	56                   	push   %esi
+  80149f:	53                   	push   %ebx
+  8014a0:	83 ec 18             	sub    $0x18,%esp
+  8014a3:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014a6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014a9:	50                   	push   %eax
+  8014aa:	56                   	push   %esi
+  8014ab:	e8 8c fd ff ff       	call   80123c <fd_lookup>
+  8014b0:	83 c4 10             	add    $0x10,%esp
+  8014b3:	85 c0                	test   %eax,%eax
+  8014b5:	78 3c                	js     8014f3 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014b7:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014ba:	83 ec 08             	sub    $0x8,%esp
+  8014bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c0:	50                   	push   %eax
+  8014c1:	ff 33                	push   (%ebx)
+  8014c3:	e8 c4 fd ff ff       	call   80128c <dev_lookup>
+  8014c8:	83 c4 10             	add    $0x10,%esp
+  8014cb:	85 c0                	test   %eax,%eax
+  8014cd:	78 24                	js     8014f3 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014cf:	8b 43 08             	mov    0x8(%ebx),%eax
+  8014d2:	83 e0 03             	and    $0x3,%eax
+  8014d5:	83 f8 01             	cmp    $0x1,%eax
+  8014d8:	74 20                	je     8014fa <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8014da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014dd:	8b 40 08             	mov    0x8(%eax),%eax
+  8014e0:	85 c0                	test   %eax,%eax
+  8014e2:	74 37                	je     80151b <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8014e4:	83 ec 04             	sub    $0x4,%esp
+  8014e7:	ff 75 10             	push   0x10(%ebp)
+  8014ea:	ff 75 0c             	push   0xc(%ebp)
+  8014ed:	53                   	push   %ebx
+  8014ee:	ff d0                	call   *%eax
+  8014f0:	83 c4 10             	add    $0x10,%esp
+}
+  8014f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014f6:	5b                   	pop    %ebx
+  8014f7:	5e                   	pop    %esi
+  8014f8:	5d                   	pop    %ebp
+  8014f9:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014fa:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8014ff:	8b 40 48             	mov    0x48(%eax),%eax
+  801502:	83 ec 04             	sub    $0x4,%esp
+  801505:	56                   	push   %esi
+  801506:	50                   	push   %eax
+  801507:	68 79 2a 80 00       	push   $0x802a79
+  80150c:	e8 3b ec ff ff       	call   80014c <cprintf>
+		return -E_INVAL;
+  801511:	83 c4 10             	add    $0x10,%esp
+  801514:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801519:	eb d8                	jmp    8014f3 <read+0x58>
+		return -E_NOT_SUPP;
+  80151b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801520:	eb d1                	jmp    8014f3 <read+0x58>
+
+00801522 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801522:	55                   	push   %ebp
+  801523:	89 e5                	mov    %esp,%ebp
+  801525:	57                   	push   %edi
+  801526:	56                   	push   %esi
+  801527:	53                   	push   %ebx
+  801528:	83 ec 0c             	sub    $0xc,%esp
+  80152b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80152e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801531:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801536:	eb 02                	jmp    80153a <readn+0x18>
+  801538:	01 c3                	add    %eax,%ebx
+  80153a:	39 f3                	cmp    %esi,%ebx
+  80153c:	73 21                	jae    80155f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80153e:	83 ec 04             	sub    $0x4,%esp
+  801541:	89 f0                	mov    %esi,%eax
+  801543:	29 d8                	sub    %ebx,%eax
+  801545:	50                   	push   %eax
+  801546:	89 d8                	mov    %ebx,%eax
+  801548:	03 45 0c             	add    0xc(%ebp),%eax
+  80154b:	50                   	push   %eax
+  80154c:	57                   	push   %edi
+  80154d:	e8 49 ff ff ff       	call   80149b <read>
+		if (m < 0)
+  801552:	83 c4 10             	add    $0x10,%esp
+  801555:	85 c0                	test   %eax,%eax
+  801557:	78 04                	js     80155d <readn+0x3b>
+			return m;
+		if (m == 0)
+  801559:	75 dd                	jne    801538 <readn+0x16>
+  80155b:	eb 02                	jmp    80155f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80155d:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80155f:	89 d8                	mov    %ebx,%eax
+  801561:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801564:	5b                   	pop    %ebx
+  801565:	5e                   	pop    %esi
+  801566:	5f                   	pop    %edi
+  801567:	5d                   	pop    %ebp
+  801568:	c3                   	ret
+
+00801569 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801569:	55                   	push   %ebp
+  80156a:	89 e5                	mov    %esp,%ebp
+  80156c:	56                   	push   %esi
+  80156d:	53                   	push   %ebx
+  80156e:	83 ec 18             	sub    $0x18,%esp
+  801571:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801574:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801577:	50                   	push   %eax
+  801578:	53                   	push   %ebx
+  801579:	e8 be fc ff ff       	call   80123c <fd_lookup>
+  80157e:	83 c4 10             	add    $0x10,%esp
+  801581:	85 c0                	test   %eax,%eax
+  801583:	78 37                	js     8015bc <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801585:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801588:	83 ec 08             	sub    $0x8,%esp
+  80158b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80158e:	50                   	push   %eax
+  80158f:	ff 36                	push   (%esi)
+  801591:	e8 f6 fc ff ff       	call   80128c <dev_lookup>
+  801596:	83 c4 10             	add    $0x10,%esp
+  801599:	85 c0                	test   %eax,%eax
+  80159b:	78 1f                	js     8015bc <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80159d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015a1:	74 20                	je     8015c3 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8015a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015a6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015a9:	85 c0                	test   %eax,%eax
+  8015ab:	74 37                	je     8015e4 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8015ad:	83 ec 04             	sub    $0x4,%esp
+  8015b0:	ff 75 10             	push   0x10(%ebp)
+  8015b3:	ff 75 0c             	push   0xc(%ebp)
+  8015b6:	56                   	push   %esi
+  8015b7:	ff d0                	call   *%eax
+  8015b9:	83 c4 10             	add    $0x10,%esp
+}
+  8015bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015bf:	5b                   	pop    %ebx
+  8015c0:	5e                   	pop    %esi
+  8015c1:	5d                   	pop    %ebp
+  8015c2:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015c3:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8015c8:	8b 40 48             	mov    0x48(%eax),%eax
+  8015cb:	83 ec 04             	sub    $0x4,%esp
+  8015ce:	53                   	push   %ebx
+  8015cf:	50                   	push   %eax
+  8015d0:	68 95 2a 80 00       	push   $0x802a95
+  8015d5:	e8 72 eb ff ff       	call   80014c <cprintf>
+		return -E_INVAL;
+  8015da:	83 c4 10             	add    $0x10,%esp
+  8015dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e2:	eb d8                	jmp    8015bc <write+0x53>
+		return -E_NOT_SUPP;
+  8015e4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015e9:	eb d1                	jmp    8015bc <write+0x53>
+
+008015eb <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+  8015ee:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015f4:	50                   	push   %eax
+  8015f5:	ff 75 08             	push   0x8(%ebp)
+  8015f8:	e8 3f fc ff ff       	call   80123c <fd_lookup>
+  8015fd:	83 c4 10             	add    $0x10,%esp
+  801600:	85 c0                	test   %eax,%eax
+  801602:	78 0e                	js     801612 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801604:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801607:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80160a:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80160d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801612:	c9                   	leave
+  801613:	c3                   	ret
+
+00801614 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801614:	55                   	push   %ebp
+  801615:	89 e5                	mov    %esp,%ebp
+  801617:	56                   	push   %esi
+  801618:	53                   	push   %ebx
+  801619:	83 ec 18             	sub    $0x18,%esp
+  80161c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80161f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801622:	50                   	push   %eax
+  801623:	53                   	push   %ebx
+  801624:	e8 13 fc ff ff       	call   80123c <fd_lookup>
+  801629:	83 c4 10             	add    $0x10,%esp
+  80162c:	85 c0                	test   %eax,%eax
+  80162e:	78 34                	js     801664 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801630:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801633:	83 ec 08             	sub    $0x8,%esp
+  801636:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801639:	50                   	push   %eax
+  80163a:	ff 36                	push   (%esi)
+  80163c:	e8 4b fc ff ff       	call   80128c <dev_lookup>
+  801641:	83 c4 10             	add    $0x10,%esp
+  801644:	85 c0                	test   %eax,%eax
+  801646:	78 1c                	js     801664 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801648:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80164c:	74 1d                	je     80166b <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80164e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801651:	8b 40 18             	mov    0x18(%eax),%eax
+  801654:	85 c0                	test   %eax,%eax
+  801656:	74 34                	je     80168c <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801658:	83 ec 08             	sub    $0x8,%esp
+  80165b:	ff 75 0c             	push   0xc(%ebp)
+  80165e:	56                   	push   %esi
+  80165f:	ff d0                	call   *%eax
+  801661:	83 c4 10             	add    $0x10,%esp
+}
+  801664:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801667:	5b                   	pop    %ebx
+  801668:	5e                   	pop    %esi
+  801669:	5d                   	pop    %ebp
+  80166a:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80166b:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801670:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801673:	83 ec 04             	sub    $0x4,%esp
+  801676:	53                   	push   %ebx
+  801677:	50                   	push   %eax
+  801678:	68 58 2a 80 00       	push   $0x802a58
+  80167d:	e8 ca ea ff ff       	call   80014c <cprintf>
+		return -E_INVAL;
+  801682:	83 c4 10             	add    $0x10,%esp
+  801685:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80168a:	eb d8                	jmp    801664 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80168c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801691:	eb d1                	jmp    801664 <ftruncate+0x50>
+
+00801693 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801693:	55                   	push   %ebp
+  801694:	89 e5                	mov    %esp,%ebp
+  801696:	56                   	push   %esi
+  801697:	53                   	push   %ebx
+  801698:	83 ec 18             	sub    $0x18,%esp
+  80169b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80169e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016a1:	50                   	push   %eax
+  8016a2:	ff 75 08             	push   0x8(%ebp)
+  8016a5:	e8 92 fb ff ff       	call   80123c <fd_lookup>
+  8016aa:	83 c4 10             	add    $0x10,%esp
+  8016ad:	85 c0                	test   %eax,%eax
+  8016af:	78 49                	js     8016fa <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016b1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016b4:	83 ec 08             	sub    $0x8,%esp
+  8016b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ba:	50                   	push   %eax
+  8016bb:	ff 36                	push   (%esi)
+  8016bd:	e8 ca fb ff ff       	call   80128c <dev_lookup>
+  8016c2:	83 c4 10             	add    $0x10,%esp
+  8016c5:	85 c0                	test   %eax,%eax
+  8016c7:	78 31                	js     8016fa <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8016c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016cc:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016d0:	74 2f                	je     801701 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8016d2:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8016d5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016dc:	00 00 00 
+	stat->st_isdir = 0;
+  8016df:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016e6:	00 00 00 
+	stat->st_dev = dev;
+  8016e9:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8016ef:	83 ec 08             	sub    $0x8,%esp
+  8016f2:	53                   	push   %ebx
+  8016f3:	56                   	push   %esi
+  8016f4:	ff 50 14             	call   *0x14(%eax)
+  8016f7:	83 c4 10             	add    $0x10,%esp
+}
+  8016fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016fd:	5b                   	pop    %ebx
+  8016fe:	5e                   	pop    %esi
+  8016ff:	5d                   	pop    %ebp
+  801700:	c3                   	ret
+		return -E_NOT_SUPP;
+  801701:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801706:	eb f2                	jmp    8016fa <fstat+0x67>
+
+00801708 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801708:	55                   	push   %ebp
+  801709:	89 e5                	mov    %esp,%ebp
+  80170b:	56                   	push   %esi
+  80170c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80170d:	83 ec 08             	sub    $0x8,%esp
+  801710:	6a 00                	push   $0x0
+  801712:	ff 75 08             	push   0x8(%ebp)
+  801715:	e8 bc 02 00 00       	call   8019d6 <open>
+  80171a:	89 c3                	mov    %eax,%ebx
+  80171c:	83 c4 10             	add    $0x10,%esp
+  80171f:	85 c0                	test   %eax,%eax
+  801721:	78 1b                	js     80173e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801723:	83 ec 08             	sub    $0x8,%esp
+  801726:	ff 75 0c             	push   0xc(%ebp)
+  801729:	50                   	push   %eax
+  80172a:	e8 64 ff ff ff       	call   801693 <fstat>
+  80172f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801731:	89 1c 24             	mov    %ebx,(%esp)
+  801734:	e8 26 fc ff ff       	call   80135f <close>
+	return r;
+  801739:	83 c4 10             	add    $0x10,%esp
+  80173c:	89 f3                	mov    %esi,%ebx
+}
+  80173e:	89 d8                	mov    %ebx,%eax
+  801740:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801743:	5b                   	pop    %ebx
+  801744:	5e                   	pop    %esi
+  801745:	5d                   	pop    %ebp
+  801746:	c3                   	ret
+
+00801747 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801747:	55                   	push   %ebp
+  801748:	89 e5                	mov    %esp,%ebp
+  80174a:	57                   	push   %edi
+  80174b:	56                   	push   %esi
+  80174c:	53                   	push   %ebx
+  80174d:	83 ec 0c             	sub    $0xc,%esp
+  801750:	89 c7                	mov    %eax,%edi
+  801752:	89 d3                	mov    %edx,%ebx
+  801754:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801756:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  80175d:	74 2d                	je     80178c <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80175f:	6a 07                	push   $0x7
+  801761:	68 00 50 80 00       	push   $0x805000
+  801766:	57                   	push   %edi
+  801767:	ff 35 00 40 80 00    	push   0x804000
+  80176d:	e8 c3 0b 00 00       	call   802335 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801772:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801779:	6a 00                	push   $0x0
+  80177b:	56                   	push   %esi
+  80177c:	53                   	push   %ebx
+  80177d:	6a 00                	push   $0x0
+  80177f:	e8 63 0a 00 00       	call   8021e7 <ipc_recv_pages>
+}
+  801784:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801787:	5b                   	pop    %ebx
+  801788:	5e                   	pop    %esi
+  801789:	5f                   	pop    %edi
+  80178a:	5d                   	pop    %ebp
+  80178b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80178c:	83 ec 0c             	sub    $0xc,%esp
+  80178f:	6a 01                	push   $0x1
+  801791:	e8 94 0c 00 00       	call   80242a <ipc_find_env>
+  801796:	a3 00 40 80 00       	mov    %eax,0x804000
+  80179b:	83 c4 10             	add    $0x10,%esp
+  80179e:	eb bf                	jmp    80175f <fsipc_pages+0x18>
+
+008017a0 <fsipc>:
+{
+  8017a0:	55                   	push   %ebp
+  8017a1:	89 e5                	mov    %esp,%ebp
+  8017a3:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  8017a6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017ab:	e8 97 ff ff ff       	call   801747 <fsipc_pages>
+}
+  8017b0:	c9                   	leave
+  8017b1:	c3                   	ret
+
+008017b2 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017b2:	55                   	push   %ebp
+  8017b3:	89 e5                	mov    %esp,%ebp
+  8017b5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8017b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017bb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017be:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  8017c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017c6:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8017cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017d0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8017d5:	e8 c6 ff ff ff       	call   8017a0 <fsipc>
+}
+  8017da:	c9                   	leave
+  8017db:	c3                   	ret
+
+008017dc <devfile_flush>:
+{
+  8017dc:	55                   	push   %ebp
+  8017dd:	89 e5                	mov    %esp,%ebp
+  8017df:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8017e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017e8:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8017ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017f2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8017f7:	e8 a4 ff ff ff       	call   8017a0 <fsipc>
+}
+  8017fc:	c9                   	leave
+  8017fd:	c3                   	ret
+
+008017fe <devfile_stat>:
+{
+  8017fe:	55                   	push   %ebp
+  8017ff:	89 e5                	mov    %esp,%ebp
+  801801:	53                   	push   %ebx
+  801802:	83 ec 04             	sub    $0x4,%esp
+  801805:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801808:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80180e:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801813:	ba 00 00 00 00       	mov    $0x0,%edx
+  801818:	b8 05 00 00 00       	mov    $0x5,%eax
+  80181d:	e8 7e ff ff ff       	call   8017a0 <fsipc>
+  801822:	85 c0                	test   %eax,%eax
+  801824:	78 2c                	js     801852 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801826:	83 ec 08             	sub    $0x8,%esp
+  801829:	68 00 50 80 00       	push   $0x805000
+  80182e:	53                   	push   %ebx
+  80182f:	e8 ff ee ff ff       	call   800733 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801834:	a1 80 50 80 00       	mov    0x805080,%eax
+  801839:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80183f:	a1 84 50 80 00       	mov    0x805084,%eax
+  801844:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  80184a:	83 c4 10             	add    $0x10,%esp
+  80184d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801852:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801855:	c9                   	leave
+  801856:	c3                   	ret
+
+00801857 <devfile_write>:
+{
+  801857:	55                   	push   %ebp
+  801858:	89 e5                	mov    %esp,%ebp
+  80185a:	83 ec 0c             	sub    $0xc,%esp
+  80185d:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801860:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801865:	39 d0                	cmp    %edx,%eax
+  801867:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80186a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80186d:	8b 52 0c             	mov    0xc(%edx),%edx
+  801870:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  801876:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80187b:	50                   	push   %eax
+  80187c:	ff 75 0c             	push   0xc(%ebp)
+  80187f:	68 08 50 80 00       	push   $0x805008
+  801884:	e8 30 f0 ff ff       	call   8008b9 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801889:	ba 00 00 00 00       	mov    $0x0,%edx
+  80188e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801893:	e8 08 ff ff ff       	call   8017a0 <fsipc>
+}
+  801898:	c9                   	leave
+  801899:	c3                   	ret
+
+0080189a <devfile_read>:
+{
+  80189a:	55                   	push   %ebp
+  80189b:	89 e5                	mov    %esp,%ebp
+  80189d:	57                   	push   %edi
+  80189e:	56                   	push   %esi
+  80189f:	53                   	push   %ebx
+  8018a0:	83 ec 1c             	sub    $0x1c,%esp
+  8018a3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8018a6:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8018a9:	89 fe                	mov    %edi,%esi
+  8018ab:	c1 ee 0c             	shr    $0xc,%esi
+  8018ae:	b8 20 00 00 00       	mov    $0x20,%eax
+  8018b3:	39 c6                	cmp    %eax,%esi
+  8018b5:	0f 47 f0             	cmova  %eax,%esi
+  8018b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018c0:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8018c3:	eb 14                	jmp    8018d9 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8018c5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  8018cc:	05 00 10 00 00       	add    $0x1000,%eax
+  8018d1:	f6 c6 06             	test   $0x6,%dh
+  8018d4:	75 42                	jne    801918 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8018d6:	83 c1 01             	add    $0x1,%ecx
+  8018d9:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8018dc:	39 f1                	cmp    %esi,%ecx
+  8018de:	0f 84 95 00 00 00    	je     801979 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8018e4:	89 c2                	mov    %eax,%edx
+  8018e6:	c1 ea 16             	shr    $0x16,%edx
+  8018e9:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8018f0:	f6 c2 01             	test   $0x1,%dl
+  8018f3:	74 23                	je     801918 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8018f5:	89 c2                	mov    %eax,%edx
+  8018f7:	c1 ea 0c             	shr    $0xc,%edx
+  8018fa:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801901:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801907:	74 0f                	je     801918 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801909:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801910:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801916:	75 ad                	jne    8018c5 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801918:	85 c9                	test   %ecx,%ecx
+  80191a:	74 11                	je     80192d <devfile_read+0x93>
+  80191c:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801923:	75 08                	jne    80192d <devfile_read+0x93>
+  801925:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  80192b:	74 50                	je     80197d <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80192d:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801930:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  801935:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80193b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801940:	b8 03 00 00 00       	mov    $0x3,%eax
+  801945:	e8 56 fe ff ff       	call   8017a0 <fsipc>
+  80194a:	89 c6                	mov    %eax,%esi
+  80194c:	85 c0                	test   %eax,%eax
+  80194e:	78 1f                	js     80196f <devfile_read+0xd5>
+	assert(r <= n);
+  801950:	39 c7                	cmp    %eax,%edi
+  801952:	72 50                	jb     8019a4 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801954:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801959:	7f 62                	jg     8019bd <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  80195b:	83 ec 04             	sub    $0x4,%esp
+  80195e:	50                   	push   %eax
+  80195f:	68 00 50 80 00       	push   $0x805000
+  801964:	ff 75 0c             	push   0xc(%ebp)
+  801967:	e8 4d ef ff ff       	call   8008b9 <memmove>
+	return r;
+  80196c:	83 c4 10             	add    $0x10,%esp
+}
+  80196f:	89 f0                	mov    %esi,%eax
+  801971:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801974:	5b                   	pop    %ebx
+  801975:	5e                   	pop    %esi
+  801976:	5f                   	pop    %edi
+  801977:	5d                   	pop    %ebp
+  801978:	c3                   	ret
+  801979:	89 f1                	mov    %esi,%ecx
+  80197b:	eb 9b                	jmp    801918 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  80197d:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801980:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801985:	89 c8                	mov    %ecx,%eax
+  801987:	c1 e0 0c             	shl    $0xc,%eax
+  80198a:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  80198f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801992:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801997:	e8 ab fd ff ff       	call   801747 <fsipc_pages>
+  80199c:	89 c6                	mov    %eax,%esi
+  80199e:	85 c0                	test   %eax,%eax
+  8019a0:	78 8b                	js     80192d <devfile_read+0x93>
+  8019a2:	eb cb                	jmp    80196f <devfile_read+0xd5>
+	assert(r <= n);
+  8019a4:	68 c4 2a 80 00       	push   $0x802ac4
+  8019a9:	68 cb 2a 80 00       	push   $0x802acb
+  8019ae:	68 a0 00 00 00       	push   $0xa0
+  8019b3:	68 e0 2a 80 00       	push   $0x802ae0
+  8019b8:	e8 e4 07 00 00       	call   8021a1 <_panic>
+	assert(r <= PGSIZE);
+  8019bd:	68 eb 2a 80 00       	push   $0x802aeb
+  8019c2:	68 cb 2a 80 00       	push   $0x802acb
+  8019c7:	68 a1 00 00 00       	push   $0xa1
+  8019cc:	68 e0 2a 80 00       	push   $0x802ae0
+  8019d1:	e8 cb 07 00 00       	call   8021a1 <_panic>
+
+008019d6 <open>:
+{
+  8019d6:	55                   	push   %ebp
+  8019d7:	89 e5                	mov    %esp,%ebp
+  8019d9:	56                   	push   %esi
+  8019da:	53                   	push   %ebx
+  8019db:	83 ec 1c             	sub    $0x1c,%esp
+  8019de:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8019e1:	56                   	push   %esi
+  8019e2:	e8 11 ed ff ff       	call   8006f8 <strlen>
+  8019e7:	83 c4 10             	add    $0x10,%esp
+  8019ea:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019ef:	7f 6c                	jg     801a5d <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8019f1:	83 ec 0c             	sub    $0xc,%esp
+  8019f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019f7:	50                   	push   %eax
+  8019f8:	e8 eb f7 ff ff       	call   8011e8 <fd_alloc>
+  8019fd:	89 c3                	mov    %eax,%ebx
+  8019ff:	83 c4 10             	add    $0x10,%esp
+  801a02:	85 c0                	test   %eax,%eax
+  801a04:	78 3c                	js     801a42 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801a06:	83 ec 08             	sub    $0x8,%esp
+  801a09:	56                   	push   %esi
+  801a0a:	68 00 50 80 00       	push   $0x805000
+  801a0f:	e8 1f ed ff ff       	call   800733 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a14:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a17:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801a1c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a1f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a24:	e8 77 fd ff ff       	call   8017a0 <fsipc>
+  801a29:	89 c3                	mov    %eax,%ebx
+  801a2b:	83 c4 10             	add    $0x10,%esp
+  801a2e:	85 c0                	test   %eax,%eax
+  801a30:	78 19                	js     801a4b <open+0x75>
+	return fd2num(fd);
+  801a32:	83 ec 0c             	sub    $0xc,%esp
+  801a35:	ff 75 f4             	push   -0xc(%ebp)
+  801a38:	e8 84 f7 ff ff       	call   8011c1 <fd2num>
+  801a3d:	89 c3                	mov    %eax,%ebx
+  801a3f:	83 c4 10             	add    $0x10,%esp
+}
+  801a42:	89 d8                	mov    %ebx,%eax
+  801a44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a47:	5b                   	pop    %ebx
+  801a48:	5e                   	pop    %esi
+  801a49:	5d                   	pop    %ebp
+  801a4a:	c3                   	ret
+		fd_close(fd, 0);
+  801a4b:	83 ec 08             	sub    $0x8,%esp
+  801a4e:	6a 00                	push   $0x0
+  801a50:	ff 75 f4             	push   -0xc(%ebp)
+  801a53:	e8 80 f8 ff ff       	call   8012d8 <fd_close>
+		return r;
+  801a58:	83 c4 10             	add    $0x10,%esp
+  801a5b:	eb e5                	jmp    801a42 <open+0x6c>
+		return -E_BAD_PATH;
+  801a5d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a62:	eb de                	jmp    801a42 <open+0x6c>
+
+00801a64 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801a64:	55                   	push   %ebp
+  801a65:	89 e5                	mov    %esp,%ebp
+  801a67:	53                   	push   %ebx
+  801a68:	83 ec 10             	sub    $0x10,%esp
+  801a6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801a6e:	53                   	push   %ebx
+  801a6f:	e8 84 ec ff ff       	call   8006f8 <strlen>
+  801a74:	83 c4 10             	add    $0x10,%esp
+  801a77:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a7c:	7f 25                	jg     801aa3 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801a7e:	83 ec 08             	sub    $0x8,%esp
+  801a81:	53                   	push   %ebx
+  801a82:	68 00 50 80 00       	push   $0x805000
+  801a87:	e8 a7 ec ff ff       	call   800733 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801a8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a91:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a96:	e8 05 fd ff ff       	call   8017a0 <fsipc>
+  801a9b:	83 c4 10             	add    $0x10,%esp
+}
+  801a9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801aa1:	c9                   	leave
+  801aa2:	c3                   	ret
+		return -E_BAD_PATH;
+  801aa3:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801aa8:	eb f4                	jmp    801a9e <remove+0x3a>
+
+00801aaa <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801aaa:	55                   	push   %ebp
+  801aab:	89 e5                	mov    %esp,%ebp
+  801aad:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801ab0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab5:	b8 08 00 00 00       	mov    $0x8,%eax
+  801aba:	e8 e1 fc ff ff       	call   8017a0 <fsipc>
+}
+  801abf:	c9                   	leave
+  801ac0:	c3                   	ret
+
+00801ac1 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801ac1:	55                   	push   %ebp
+  801ac2:	89 e5                	mov    %esp,%ebp
+  801ac4:	53                   	push   %ebx
+  801ac5:	83 ec 04             	sub    $0x4,%esp
+  801ac8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801acb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801ad5:	e8 c6 fc ff ff       	call   8017a0 <fsipc>
+  801ada:	85 c0                	test   %eax,%eax
+  801adc:	78 3c                	js     801b1a <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801ade:	a1 00 50 80 00       	mov    0x805000,%eax
+  801ae3:	89 03                	mov    %eax,(%ebx)
+  801ae5:	a1 04 50 80 00       	mov    0x805004,%eax
+  801aea:	89 43 04             	mov    %eax,0x4(%ebx)
+  801aed:	a1 08 50 80 00       	mov    0x805008,%eax
+  801af2:	89 43 08             	mov    %eax,0x8(%ebx)
+  801af5:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801afa:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801afd:	a1 10 50 80 00       	mov    0x805010,%eax
+  801b02:	89 43 10             	mov    %eax,0x10(%ebx)
+  801b05:	a1 14 50 80 00       	mov    0x805014,%eax
+  801b0a:	89 43 14             	mov    %eax,0x14(%ebx)
+  801b0d:	a1 18 50 80 00       	mov    0x805018,%eax
+  801b12:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801b15:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b1d:	c9                   	leave
+  801b1e:	c3                   	ret
+
+00801b1f <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801b1f:	55                   	push   %ebp
+  801b20:	89 e5                	mov    %esp,%ebp
+  801b22:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801b25:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b28:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  801b2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b32:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801b37:	e8 64 fc ff ff       	call   8017a0 <fsipc>
+}
+  801b3c:	c9                   	leave
+  801b3d:	c3                   	ret
+
+00801b3e <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b3e:	55                   	push   %ebp
+  801b3f:	89 e5                	mov    %esp,%ebp
+  801b41:	56                   	push   %esi
+  801b42:	53                   	push   %ebx
+  801b43:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801b46:	83 ec 0c             	sub    $0xc,%esp
+  801b49:	ff 75 08             	push   0x8(%ebp)
+  801b4c:	e8 80 f6 ff ff       	call   8011d1 <fd2data>
+  801b51:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801b53:	83 c4 08             	add    $0x8,%esp
+  801b56:	68 f7 2a 80 00       	push   $0x802af7
+  801b5b:	53                   	push   %ebx
+  801b5c:	e8 d2 eb ff ff       	call   800733 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801b61:	8b 46 04             	mov    0x4(%esi),%eax
+  801b64:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801b6a:	2b 0e                	sub    (%esi),%ecx
+  801b6c:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801b71:	89 c8                	mov    %ecx,%eax
+  801b73:	f7 e2                	mul    %edx
+  801b75:	c1 ea 0c             	shr    $0xc,%edx
+  801b78:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801b7e:	29 d1                	sub    %edx,%ecx
+  801b80:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801b86:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b8d:	00 00 00 
+	stat->st_dev = &devpipe;
+  801b90:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  801b97:	30 80 00 
+	return 0;
+}
+  801b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ba2:	5b                   	pop    %ebx
+  801ba3:	5e                   	pop    %esi
+  801ba4:	5d                   	pop    %ebp
+  801ba5:	c3                   	ret
+
+00801ba6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801ba6:	55                   	push   %ebp
+  801ba7:	89 e5                	mov    %esp,%ebp
+  801ba9:	53                   	push   %ebx
+  801baa:	83 ec 0c             	sub    $0xc,%esp
+  801bad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801bb0:	53                   	push   %ebx
+  801bb1:	6a 00                	push   $0x0
+  801bb3:	e8 f3 f0 ff ff       	call   800cab <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801bb8:	89 1c 24             	mov    %ebx,(%esp)
+  801bbb:	e8 11 f6 ff ff       	call   8011d1 <fd2data>
+  801bc0:	83 c4 08             	add    $0x8,%esp
+  801bc3:	50                   	push   %eax
+  801bc4:	6a 00                	push   $0x0
+  801bc6:	e8 e0 f0 ff ff       	call   800cab <sys_page_unmap>
+}
+  801bcb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bce:	c9                   	leave
+  801bcf:	c3                   	ret
+
+00801bd0 <_pipeisclosed>:
+{
+  801bd0:	55                   	push   %ebp
+  801bd1:	89 e5                	mov    %esp,%ebp
+  801bd3:	57                   	push   %edi
+  801bd4:	56                   	push   %esi
+  801bd5:	53                   	push   %ebx
+  801bd6:	83 ec 1c             	sub    $0x1c,%esp
+  801bd9:	89 c7                	mov    %eax,%edi
+  801bdb:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801bdd:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801be2:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801be5:	83 ec 0c             	sub    $0xc,%esp
+  801be8:	57                   	push   %edi
+  801be9:	e8 7b 08 00 00       	call   802469 <pageref>
+  801bee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801bf1:	89 34 24             	mov    %esi,(%esp)
+  801bf4:	e8 70 08 00 00       	call   802469 <pageref>
+		nn = thisenv->env_runs;
+  801bf9:	8b 15 0c 40 80 00    	mov    0x80400c,%edx
+  801bff:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801c02:	83 c4 10             	add    $0x10,%esp
+  801c05:	39 cb                	cmp    %ecx,%ebx
+  801c07:	74 1b                	je     801c24 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801c09:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801c0c:	75 cf                	jne    801bdd <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801c0e:	8b 42 58             	mov    0x58(%edx),%eax
+  801c11:	6a 01                	push   $0x1
+  801c13:	50                   	push   %eax
+  801c14:	53                   	push   %ebx
+  801c15:	68 fe 2a 80 00       	push   $0x802afe
+  801c1a:	e8 2d e5 ff ff       	call   80014c <cprintf>
+  801c1f:	83 c4 10             	add    $0x10,%esp
+  801c22:	eb b9                	jmp    801bdd <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801c24:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801c27:	0f 94 c0             	sete   %al
+  801c2a:	0f b6 c0             	movzbl %al,%eax
+}
+  801c2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c30:	5b                   	pop    %ebx
+  801c31:	5e                   	pop    %esi
+  801c32:	5f                   	pop    %edi
+  801c33:	5d                   	pop    %ebp
+  801c34:	c3                   	ret
+
+00801c35 <devpipe_read>:
+{
+  801c35:	55                   	push   %ebp
+  801c36:	89 e5                	mov    %esp,%ebp
+  801c38:	57                   	push   %edi
+  801c39:	56                   	push   %esi
+  801c3a:	53                   	push   %ebx
+  801c3b:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801c3e:	ff 75 08             	push   0x8(%ebp)
+  801c41:	e8 8b f5 ff ff       	call   8011d1 <fd2data>
+  801c46:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801c48:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801c4b:	8d 40 04             	lea    0x4(%eax),%eax
+  801c4e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801c51:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801c54:	8b 0b                	mov    (%ebx),%ecx
+  801c56:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801c5c:	29 ce                	sub    %ecx,%esi
+  801c5e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801c63:	f7 e6                	mul    %esi
+  801c65:	c1 ea 0c             	shr    $0xc,%edx
+  801c68:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801c6e:	29 c6                	sub    %eax,%esi
+  801c70:	89 f2                	mov    %esi,%edx
+  801c72:	75 43                	jne    801cb7 <devpipe_read+0x82>
+		ref = pageref(p);
+  801c74:	83 ec 0c             	sub    $0xc,%esp
+  801c77:	53                   	push   %ebx
+  801c78:	e8 ec 07 00 00       	call   802469 <pageref>
+  801c7d:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801c7f:	89 da                	mov    %ebx,%edx
+  801c81:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c84:	e8 47 ff ff ff       	call   801bd0 <_pipeisclosed>
+  801c89:	83 c4 10             	add    $0x10,%esp
+  801c8c:	85 c0                	test   %eax,%eax
+  801c8e:	0f 85 c1 00 00 00    	jne    801d55 <devpipe_read+0x120>
+	*sleeping = 1;
+  801c94:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801c9b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801ca0:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801ca3:	75 ac                	jne    801c51 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801ca5:	83 ec 04             	sub    $0x4,%esp
+  801ca8:	56                   	push   %esi
+  801ca9:	57                   	push   %edi
+  801caa:	ff 75 e4             	push   -0x1c(%ebp)
+  801cad:	e8 4d f4 ff ff       	call   8010ff <sys_futex_wait>
+  801cb2:	83 c4 10             	add    $0x10,%esp
+  801cb5:	eb 9a                	jmp    801c51 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801cb7:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801cba:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801cbe:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801cc0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801cc5:	f7 e1                	mul    %ecx
+  801cc7:	c1 ea 0b             	shr    $0xb,%edx
+  801cca:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801cd0:	29 c1                	sub    %eax,%ecx
+  801cd2:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801cd4:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801cd9:	29 cf                	sub    %ecx,%edi
+  801cdb:	39 f7                	cmp    %esi,%edi
+  801cdd:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801ce0:	8d 43 10             	lea    0x10(%ebx),%eax
+  801ce3:	83 ec 04             	sub    $0x4,%esp
+  801ce6:	57                   	push   %edi
+  801ce7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801cea:	01 c2                	add    %eax,%edx
+  801cec:	52                   	push   %edx
+  801ced:	ff 75 0c             	push   0xc(%ebp)
+  801cf0:	e8 c4 eb ff ff       	call   8008b9 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801cf5:	83 c4 0c             	add    $0xc,%esp
+  801cf8:	89 f1                	mov    %esi,%ecx
+  801cfa:	29 f9                	sub    %edi,%ecx
+  801cfc:	51                   	push   %ecx
+  801cfd:	ff 75 e4             	push   -0x1c(%ebp)
+  801d00:	89 f8                	mov    %edi,%eax
+  801d02:	03 45 0c             	add    0xc(%ebp),%eax
+  801d05:	50                   	push   %eax
+  801d06:	e8 ae eb ff ff       	call   8008b9 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801d0b:	89 f1                	mov    %esi,%ecx
+  801d0d:	03 0b                	add    (%ebx),%ecx
+  801d0f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801d14:	f7 e1                	mul    %ecx
+  801d16:	c1 ea 0c             	shr    $0xc,%edx
+  801d19:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801d1f:	29 d1                	sub    %edx,%ecx
+  801d21:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801d23:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801d28:	83 c4 10             	add    $0x10,%esp
+  801d2b:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801d2f:	75 0a                	jne    801d3b <devpipe_read+0x106>
+	return n;
+  801d31:	89 f0                	mov    %esi,%eax
+}
+  801d33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d36:	5b                   	pop    %ebx
+  801d37:	5e                   	pop    %esi
+  801d38:	5f                   	pop    %edi
+  801d39:	5d                   	pop    %ebp
+  801d3a:	c3                   	ret
+		*sleeping = 0;
+  801d3b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801d42:	83 ec 08             	sub    $0x8,%esp
+  801d45:	68 00 04 00 00       	push   $0x400
+  801d4a:	53                   	push   %ebx
+  801d4b:	e8 ff f3 ff ff       	call   80114f <sys_futex_wake>
+  801d50:	83 c4 10             	add    $0x10,%esp
+  801d53:	eb dc                	jmp    801d31 <devpipe_read+0xfc>
+			return 0;
+  801d55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d5a:	eb d7                	jmp    801d33 <devpipe_read+0xfe>
+
+00801d5c <devpipe_write>:
+{
+  801d5c:	55                   	push   %ebp
+  801d5d:	89 e5                	mov    %esp,%ebp
+  801d5f:	57                   	push   %edi
+  801d60:	56                   	push   %esi
+  801d61:	53                   	push   %ebx
+  801d62:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801d65:	ff 75 08             	push   0x8(%ebp)
+  801d68:	e8 64 f4 ff ff       	call   8011d1 <fd2data>
+  801d6d:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801d6f:	83 c4 10             	add    $0x10,%esp
+  801d72:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801d79:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d7c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801d7f:	0f 83 23 01 00 00    	jae    801ea8 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801d85:	8b 77 04             	mov    0x4(%edi),%esi
+  801d88:	8b 1f                	mov    (%edi),%ebx
+  801d8a:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801d90:	29 d9                	sub    %ebx,%ecx
+  801d92:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801d97:	f7 e1                	mul    %ecx
+  801d99:	c1 ea 0c             	shr    $0xc,%edx
+  801d9c:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801da2:	29 c1                	sub    %eax,%ecx
+  801da4:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801da6:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801dac:	75 40                	jne    801dee <devpipe_write+0x92>
+			ref = pageref(p);
+  801dae:	83 ec 0c             	sub    $0xc,%esp
+  801db1:	57                   	push   %edi
+  801db2:	e8 b2 06 00 00       	call   802469 <pageref>
+  801db7:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801db9:	89 fa                	mov    %edi,%edx
+  801dbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dbe:	e8 0d fe ff ff       	call   801bd0 <_pipeisclosed>
+  801dc3:	83 c4 10             	add    $0x10,%esp
+  801dc6:	85 c0                	test   %eax,%eax
+  801dc8:	0f 85 d5 00 00 00    	jne    801ea3 <devpipe_write+0x147>
+	*sleeping = 1;
+  801dce:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801dd5:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801dda:	39 1f                	cmp    %ebx,(%edi)
+  801ddc:	75 a7                	jne    801d85 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801dde:	83 ec 04             	sub    $0x4,%esp
+  801de1:	56                   	push   %esi
+  801de2:	53                   	push   %ebx
+  801de3:	57                   	push   %edi
+  801de4:	e8 16 f3 ff ff       	call   8010ff <sys_futex_wait>
+  801de9:	83 c4 10             	add    $0x10,%esp
+  801dec:	eb 97                	jmp    801d85 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801dee:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801df1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801df4:	29 c1                	sub    %eax,%ecx
+  801df6:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801dfb:	89 d8                	mov    %ebx,%eax
+  801dfd:	29 d0                	sub    %edx,%eax
+  801dff:	39 c1                	cmp    %eax,%ecx
+  801e01:	0f 46 c1             	cmovbe %ecx,%eax
+  801e04:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801e06:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e0b:	f7 e6                	mul    %esi
+  801e0d:	c1 ea 0b             	shr    $0xb,%edx
+  801e10:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801e16:	29 c6                	sub    %eax,%esi
+  801e18:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801e1a:	29 f3                	sub    %esi,%ebx
+  801e1c:	39 cb                	cmp    %ecx,%ebx
+  801e1e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801e21:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801e24:	8d 77 10             	lea    0x10(%edi),%esi
+  801e27:	83 ec 04             	sub    $0x4,%esp
+  801e2a:	53                   	push   %ebx
+  801e2b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e2e:	03 45 0c             	add    0xc(%ebp),%eax
+  801e31:	50                   	push   %eax
+  801e32:	01 f2                	add    %esi,%edx
+  801e34:	52                   	push   %edx
+  801e35:	e8 7f ea ff ff       	call   8008b9 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  801e3a:	83 c4 0c             	add    $0xc,%esp
+  801e3d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801e40:	29 d8                	sub    %ebx,%eax
+  801e42:	50                   	push   %eax
+  801e43:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801e46:	01 d3                	add    %edx,%ebx
+  801e48:	03 5d 0c             	add    0xc(%ebp),%ebx
+  801e4b:	53                   	push   %ebx
+  801e4c:	56                   	push   %esi
+  801e4d:	e8 67 ea ff ff       	call   8008b9 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  801e52:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801e55:	03 4f 04             	add    0x4(%edi),%ecx
+  801e58:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e5d:	f7 e1                	mul    %ecx
+  801e5f:	c1 ea 0c             	shr    $0xc,%edx
+  801e62:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801e68:	29 d1                	sub    %edx,%ecx
+  801e6a:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  801e6d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801e72:	83 c4 10             	add    $0x10,%esp
+  801e75:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  801e79:	75 0b                	jne    801e86 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  801e7b:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  801e7e:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801e81:	e9 f3 fe ff ff       	jmp    801d79 <devpipe_write+0x1d>
+		*sleeping = 0;
+  801e86:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  801e8d:	83 ec 08             	sub    $0x8,%esp
+  801e90:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  801e95:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  801e98:	50                   	push   %eax
+  801e99:	e8 b1 f2 ff ff       	call   80114f <sys_futex_wake>
+  801e9e:	83 c4 10             	add    $0x10,%esp
+  801ea1:	eb d8                	jmp    801e7b <devpipe_write+0x11f>
+				return 0;
+  801ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ea8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eab:	5b                   	pop    %ebx
+  801eac:	5e                   	pop    %esi
+  801ead:	5f                   	pop    %edi
+  801eae:	5d                   	pop    %ebp
+  801eaf:	c3                   	ret
+
+00801eb0 <pipe>:
+{
+  801eb0:	55                   	push   %ebp
+  801eb1:	89 e5                	mov    %esp,%ebp
+  801eb3:	56                   	push   %esi
+  801eb4:	53                   	push   %ebx
+  801eb5:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801eb8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ebb:	50                   	push   %eax
+  801ebc:	e8 27 f3 ff ff       	call   8011e8 <fd_alloc>
+  801ec1:	89 c3                	mov    %eax,%ebx
+  801ec3:	83 c4 10             	add    $0x10,%esp
+  801ec6:	85 c0                	test   %eax,%eax
+  801ec8:	0f 88 23 01 00 00    	js     801ff1 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801ece:	83 ec 04             	sub    $0x4,%esp
+  801ed1:	68 07 04 00 00       	push   $0x407
+  801ed6:	ff 75 f4             	push   -0xc(%ebp)
+  801ed9:	6a 00                	push   $0x0
+  801edb:	e8 46 ed ff ff       	call   800c26 <sys_page_alloc>
+  801ee0:	89 c3                	mov    %eax,%ebx
+  801ee2:	83 c4 10             	add    $0x10,%esp
+  801ee5:	85 c0                	test   %eax,%eax
+  801ee7:	0f 88 04 01 00 00    	js     801ff1 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801eed:	83 ec 0c             	sub    $0xc,%esp
+  801ef0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ef3:	50                   	push   %eax
+  801ef4:	e8 ef f2 ff ff       	call   8011e8 <fd_alloc>
+  801ef9:	89 c3                	mov    %eax,%ebx
+  801efb:	83 c4 10             	add    $0x10,%esp
+  801efe:	85 c0                	test   %eax,%eax
+  801f00:	0f 88 db 00 00 00    	js     801fe1 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f06:	83 ec 04             	sub    $0x4,%esp
+  801f09:	68 07 04 00 00       	push   $0x407
+  801f0e:	ff 75 f0             	push   -0x10(%ebp)
+  801f11:	6a 00                	push   $0x0
+  801f13:	e8 0e ed ff ff       	call   800c26 <sys_page_alloc>
+  801f18:	89 c3                	mov    %eax,%ebx
+  801f1a:	83 c4 10             	add    $0x10,%esp
+  801f1d:	85 c0                	test   %eax,%eax
+  801f1f:	0f 88 bc 00 00 00    	js     801fe1 <pipe+0x131>
+	va = fd2data(fd0);
+  801f25:	83 ec 0c             	sub    $0xc,%esp
+  801f28:	ff 75 f4             	push   -0xc(%ebp)
+  801f2b:	e8 a1 f2 ff ff       	call   8011d1 <fd2data>
+  801f30:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f32:	83 c4 0c             	add    $0xc,%esp
+  801f35:	68 07 04 00 00       	push   $0x407
+  801f3a:	50                   	push   %eax
+  801f3b:	6a 00                	push   $0x0
+  801f3d:	e8 e4 ec ff ff       	call   800c26 <sys_page_alloc>
+  801f42:	89 c3                	mov    %eax,%ebx
+  801f44:	83 c4 10             	add    $0x10,%esp
+  801f47:	85 c0                	test   %eax,%eax
+  801f49:	0f 88 82 00 00 00    	js     801fd1 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f4f:	83 ec 0c             	sub    $0xc,%esp
+  801f52:	ff 75 f0             	push   -0x10(%ebp)
+  801f55:	e8 77 f2 ff ff       	call   8011d1 <fd2data>
+  801f5a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801f61:	50                   	push   %eax
+  801f62:	6a 00                	push   $0x0
+  801f64:	56                   	push   %esi
+  801f65:	6a 00                	push   $0x0
+  801f67:	e8 fd ec ff ff       	call   800c69 <sys_page_map>
+  801f6c:	89 c3                	mov    %eax,%ebx
+  801f6e:	83 c4 20             	add    $0x20,%esp
+  801f71:	85 c0                	test   %eax,%eax
+  801f73:	78 4e                	js     801fc3 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801f75:	a1 20 30 80 00       	mov    0x803020,%eax
+  801f7a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f7d:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801f7f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f82:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801f89:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801f8c:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801f8e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801f91:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801f98:	83 ec 0c             	sub    $0xc,%esp
+  801f9b:	ff 75 f4             	push   -0xc(%ebp)
+  801f9e:	e8 1e f2 ff ff       	call   8011c1 <fd2num>
+  801fa3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fa6:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801fa8:	83 c4 04             	add    $0x4,%esp
+  801fab:	ff 75 f0             	push   -0x10(%ebp)
+  801fae:	e8 0e f2 ff ff       	call   8011c1 <fd2num>
+  801fb3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fb6:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801fb9:	83 c4 10             	add    $0x10,%esp
+  801fbc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fc1:	eb 2e                	jmp    801ff1 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801fc3:	83 ec 08             	sub    $0x8,%esp
+  801fc6:	56                   	push   %esi
+  801fc7:	6a 00                	push   $0x0
+  801fc9:	e8 dd ec ff ff       	call   800cab <sys_page_unmap>
+  801fce:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801fd1:	83 ec 08             	sub    $0x8,%esp
+  801fd4:	ff 75 f0             	push   -0x10(%ebp)
+  801fd7:	6a 00                	push   $0x0
+  801fd9:	e8 cd ec ff ff       	call   800cab <sys_page_unmap>
+  801fde:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801fe1:	83 ec 08             	sub    $0x8,%esp
+  801fe4:	ff 75 f4             	push   -0xc(%ebp)
+  801fe7:	6a 00                	push   $0x0
+  801fe9:	e8 bd ec ff ff       	call   800cab <sys_page_unmap>
+  801fee:	83 c4 10             	add    $0x10,%esp
+}
+  801ff1:	89 d8                	mov    %ebx,%eax
+  801ff3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ff6:	5b                   	pop    %ebx
+  801ff7:	5e                   	pop    %esi
+  801ff8:	5d                   	pop    %ebp
+  801ff9:	c3                   	ret
+
+00801ffa <pipeisclosed>:
+{
+  801ffa:	55                   	push   %ebp
+  801ffb:	89 e5                	mov    %esp,%ebp
+  801ffd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802000:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802003:	50                   	push   %eax
+  802004:	ff 75 08             	push   0x8(%ebp)
+  802007:	e8 30 f2 ff ff       	call   80123c <fd_lookup>
+  80200c:	83 c4 10             	add    $0x10,%esp
+  80200f:	85 c0                	test   %eax,%eax
+  802011:	78 18                	js     80202b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802013:	83 ec 0c             	sub    $0xc,%esp
+  802016:	ff 75 f4             	push   -0xc(%ebp)
+  802019:	e8 b3 f1 ff ff       	call   8011d1 <fd2data>
+  80201e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802020:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802023:	e8 a8 fb ff ff       	call   801bd0 <_pipeisclosed>
+  802028:	83 c4 10             	add    $0x10,%esp
+}
+  80202b:	c9                   	leave
+  80202c:	c3                   	ret
+
+0080202d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80202d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802032:	c3                   	ret
+
+00802033 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802033:	55                   	push   %ebp
+  802034:	89 e5                	mov    %esp,%ebp
+  802036:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802039:	68 16 2b 80 00       	push   $0x802b16
+  80203e:	ff 75 0c             	push   0xc(%ebp)
+  802041:	e8 ed e6 ff ff       	call   800733 <strcpy>
+	return 0;
+}
+  802046:	b8 00 00 00 00       	mov    $0x0,%eax
+  80204b:	c9                   	leave
+  80204c:	c3                   	ret
+
+0080204d <devcons_write>:
+{
+  80204d:	55                   	push   %ebp
+  80204e:	89 e5                	mov    %esp,%ebp
+  802050:	57                   	push   %edi
+  802051:	56                   	push   %esi
+  802052:	53                   	push   %ebx
+  802053:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802059:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80205e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802064:	eb 2e                	jmp    802094 <devcons_write+0x47>
+		m = n - tot;
+  802066:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802069:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80206b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802070:	39 c3                	cmp    %eax,%ebx
+  802072:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802075:	83 ec 04             	sub    $0x4,%esp
+  802078:	53                   	push   %ebx
+  802079:	89 f0                	mov    %esi,%eax
+  80207b:	03 45 0c             	add    0xc(%ebp),%eax
+  80207e:	50                   	push   %eax
+  80207f:	57                   	push   %edi
+  802080:	e8 34 e8 ff ff       	call   8008b9 <memmove>
+		sys_cputs(buf, m);
+  802085:	83 c4 08             	add    $0x8,%esp
+  802088:	53                   	push   %ebx
+  802089:	57                   	push   %edi
+  80208a:	e8 ca ea ff ff       	call   800b59 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80208f:	01 de                	add    %ebx,%esi
+  802091:	83 c4 10             	add    $0x10,%esp
+  802094:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802097:	72 cd                	jb     802066 <devcons_write+0x19>
+}
+  802099:	89 f0                	mov    %esi,%eax
+  80209b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80209e:	5b                   	pop    %ebx
+  80209f:	5e                   	pop    %esi
+  8020a0:	5f                   	pop    %edi
+  8020a1:	5d                   	pop    %ebp
+  8020a2:	c3                   	ret
+
+008020a3 <devcons_read>:
+{
+  8020a3:	55                   	push   %ebp
+  8020a4:	89 e5                	mov    %esp,%ebp
+  8020a6:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8020a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ae:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8020b2:	75 07                	jne    8020bb <devcons_read+0x18>
+  8020b4:	eb 1f                	jmp    8020d5 <devcons_read+0x32>
+		sys_yield();
+  8020b6:	e8 4c eb ff ff       	call   800c07 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8020bb:	e8 c8 ea ff ff       	call   800b88 <sys_cgetc>
+  8020c0:	85 c0                	test   %eax,%eax
+  8020c2:	74 f2                	je     8020b6 <devcons_read+0x13>
+	if (c < 0)
+  8020c4:	78 0f                	js     8020d5 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8020c6:	83 f8 04             	cmp    $0x4,%eax
+  8020c9:	74 0c                	je     8020d7 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8020cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020ce:	88 02                	mov    %al,(%edx)
+	return 1;
+  8020d0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8020d5:	c9                   	leave
+  8020d6:	c3                   	ret
+		return 0;
+  8020d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020dc:	eb f7                	jmp    8020d5 <devcons_read+0x32>
+
+008020de <cputchar>:
+{
+  8020de:	55                   	push   %ebp
+  8020df:	89 e5                	mov    %esp,%ebp
+  8020e1:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8020e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020e7:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8020ea:	6a 01                	push   $0x1
+  8020ec:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020ef:	50                   	push   %eax
+  8020f0:	e8 64 ea ff ff       	call   800b59 <sys_cputs>
+}
+  8020f5:	83 c4 10             	add    $0x10,%esp
+  8020f8:	c9                   	leave
+  8020f9:	c3                   	ret
+
+008020fa <getchar>:
+{
+  8020fa:	55                   	push   %ebp
+  8020fb:	89 e5                	mov    %esp,%ebp
+  8020fd:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802100:	6a 01                	push   $0x1
+  802102:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802105:	50                   	push   %eax
+  802106:	6a 00                	push   $0x0
+  802108:	e8 8e f3 ff ff       	call   80149b <read>
+	if (r < 0)
+  80210d:	83 c4 10             	add    $0x10,%esp
+  802110:	85 c0                	test   %eax,%eax
+  802112:	78 06                	js     80211a <getchar+0x20>
+	if (r < 1)
+  802114:	74 06                	je     80211c <getchar+0x22>
+	return c;
+  802116:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80211a:	c9                   	leave
+  80211b:	c3                   	ret
+		return -E_EOF;
+  80211c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802121:	eb f7                	jmp    80211a <getchar+0x20>
+
+00802123 <iscons>:
+{
+  802123:	55                   	push   %ebp
+  802124:	89 e5                	mov    %esp,%ebp
+  802126:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802129:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80212c:	50                   	push   %eax
+  80212d:	ff 75 08             	push   0x8(%ebp)
+  802130:	e8 07 f1 ff ff       	call   80123c <fd_lookup>
+  802135:	83 c4 10             	add    $0x10,%esp
+  802138:	85 c0                	test   %eax,%eax
+  80213a:	78 11                	js     80214d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80213c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80213f:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  802145:	39 10                	cmp    %edx,(%eax)
+  802147:	0f 94 c0             	sete   %al
+  80214a:	0f b6 c0             	movzbl %al,%eax
+}
+  80214d:	c9                   	leave
+  80214e:	c3                   	ret
+
+0080214f <opencons>:
+{
+  80214f:	55                   	push   %ebp
+  802150:	89 e5                	mov    %esp,%ebp
+  802152:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802155:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802158:	50                   	push   %eax
+  802159:	e8 8a f0 ff ff       	call   8011e8 <fd_alloc>
+  80215e:	83 c4 10             	add    $0x10,%esp
+  802161:	85 c0                	test   %eax,%eax
+  802163:	78 3a                	js     80219f <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802165:	83 ec 04             	sub    $0x4,%esp
+  802168:	68 07 04 00 00       	push   $0x407
+  80216d:	ff 75 f4             	push   -0xc(%ebp)
+  802170:	6a 00                	push   $0x0
+  802172:	e8 af ea ff ff       	call   800c26 <sys_page_alloc>
+  802177:	83 c4 10             	add    $0x10,%esp
+  80217a:	85 c0                	test   %eax,%eax
+  80217c:	78 21                	js     80219f <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80217e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802181:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  802187:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802189:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80218c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802193:	83 ec 0c             	sub    $0xc,%esp
+  802196:	50                   	push   %eax
+  802197:	e8 25 f0 ff ff       	call   8011c1 <fd2num>
+  80219c:	83 c4 10             	add    $0x10,%esp
+}
+  80219f:	c9                   	leave
+  8021a0:	c3                   	ret
+
+008021a1 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8021a1:	55                   	push   %ebp
+  8021a2:	89 e5                	mov    %esp,%ebp
+  8021a4:	56                   	push   %esi
+  8021a5:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8021a6:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8021a9:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  8021af:	e8 34 ea ff ff       	call   800be8 <sys_getenvid>
+  8021b4:	83 ec 0c             	sub    $0xc,%esp
+  8021b7:	ff 75 0c             	push   0xc(%ebp)
+  8021ba:	ff 75 08             	push   0x8(%ebp)
+  8021bd:	56                   	push   %esi
+  8021be:	50                   	push   %eax
+  8021bf:	68 24 2b 80 00       	push   $0x802b24
+  8021c4:	e8 83 df ff ff       	call   80014c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8021c9:	83 c4 18             	add    $0x18,%esp
+  8021cc:	53                   	push   %ebx
+  8021cd:	ff 75 10             	push   0x10(%ebp)
+  8021d0:	e8 26 df ff ff       	call   8000fb <vcprintf>
+	cprintf("\n");
+  8021d5:	c7 04 24 ac 26 80 00 	movl   $0x8026ac,(%esp)
+  8021dc:	e8 6b df ff ff       	call   80014c <cprintf>
+  8021e1:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8021e4:	cc                   	int3
+	while (1)
+  8021e5:	eb fd                	jmp    8021e4 <_panic+0x43>
+
+008021e7 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8021e7:	55                   	push   %ebp
+  8021e8:	89 e5                	mov    %esp,%ebp
+  8021ea:	57                   	push   %edi
+  8021eb:	56                   	push   %esi
+  8021ec:	53                   	push   %ebx
+  8021ed:	83 ec 14             	sub    $0x14,%esp
+  8021f0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021f3:	8b 75 14             	mov    0x14(%ebp),%esi
+  8021f6:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8021f9:	ff 75 10             	push   0x10(%ebp)
+  8021fc:	ff 75 0c             	push   0xc(%ebp)
+  8021ff:	e8 45 ee ff ff       	call   801049 <sys_ipc_recv_pages>
+  802204:	83 c4 10             	add    $0x10,%esp
+  802207:	85 c0                	test   %eax,%eax
+  802209:	78 46                	js     802251 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80220b:	85 ff                	test   %edi,%edi
+  80220d:	74 0d                	je     80221c <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  80220f:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802214:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80221a:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80221c:	85 f6                	test   %esi,%esi
+  80221e:	74 0d                	je     80222d <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  802220:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802225:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80222b:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80222d:	85 db                	test   %ebx,%ebx
+  80222f:	74 0d                	je     80223e <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  802231:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802236:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80223c:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80223e:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802243:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802249:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80224c:	5b                   	pop    %ebx
+  80224d:	5e                   	pop    %esi
+  80224e:	5f                   	pop    %edi
+  80224f:	5d                   	pop    %ebp
+  802250:	c3                   	ret
+		if (from_env_store) {
+  802251:	85 ff                	test   %edi,%edi
+  802253:	74 06                	je     80225b <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  802255:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80225b:	85 f6                	test   %esi,%esi
+  80225d:	74 06                	je     802265 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  80225f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802265:	85 db                	test   %ebx,%ebx
+  802267:	74 e0                	je     802249 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  802269:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80226f:	eb d8                	jmp    802249 <ipc_recv_pages+0x62>
+
+00802271 <ipc_recv>:
+{
+  802271:	55                   	push   %ebp
+  802272:	89 e5                	mov    %esp,%ebp
+  802274:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  802277:	6a 00                	push   $0x0
+  802279:	ff 75 10             	push   0x10(%ebp)
+  80227c:	6a 01                	push   $0x1
+  80227e:	ff 75 0c             	push   0xc(%ebp)
+  802281:	ff 75 08             	push   0x8(%ebp)
+  802284:	e8 5e ff ff ff       	call   8021e7 <ipc_recv_pages>
+}
+  802289:	c9                   	leave
+  80228a:	c3                   	ret
+
+0080228b <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80228b:	55                   	push   %ebp
+  80228c:	89 e5                	mov    %esp,%ebp
+  80228e:	56                   	push   %esi
+  80228f:	53                   	push   %ebx
+  802290:	8b 75 08             	mov    0x8(%ebp),%esi
+  802293:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  802296:	83 ec 0c             	sub    $0xc,%esp
+  802299:	ff 75 0c             	push   0xc(%ebp)
+  80229c:	e8 dc ee ff ff       	call   80117d <sys_ipc_try_recv>
+  8022a1:	83 c4 10             	add    $0x10,%esp
+  8022a4:	85 c0                	test   %eax,%eax
+  8022a6:	78 34                	js     8022dc <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8022a8:	85 f6                	test   %esi,%esi
+  8022aa:	74 0d                	je     8022b9 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8022ac:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8022b1:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8022b7:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8022b9:	85 db                	test   %ebx,%ebx
+  8022bb:	74 0d                	je     8022ca <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8022bd:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8022c2:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8022c8:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8022ca:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8022cf:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8022d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022d8:	5b                   	pop    %ebx
+  8022d9:	5e                   	pop    %esi
+  8022da:	5d                   	pop    %ebp
+  8022db:	c3                   	ret
+		if (from_env_store) {
+  8022dc:	85 f6                	test   %esi,%esi
+  8022de:	74 06                	je     8022e6 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8022e0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8022e6:	85 db                	test   %ebx,%ebx
+  8022e8:	74 eb                	je     8022d5 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8022ea:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8022f0:	eb e3                	jmp    8022d5 <ipc_try_recv+0x4a>
+
+008022f2 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8022f2:	55                   	push   %ebp
+  8022f3:	89 e5                	mov    %esp,%ebp
+  8022f5:	83 ec 14             	sub    $0x14,%esp
+  8022f8:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8022fb:	85 c0                	test   %eax,%eax
+  8022fd:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802302:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802305:	ff 75 18             	push   0x18(%ebp)
+  802308:	ff 75 14             	push   0x14(%ebp)
+  80230b:	50                   	push   %eax
+  80230c:	ff 75 0c             	push   0xc(%ebp)
+  80230f:	ff 75 08             	push   0x8(%ebp)
+  802312:	e8 f5 ec ff ff       	call   80100c <sys_ipc_send_pages>
+  802317:	83 c4 20             	add    $0x20,%esp
+  80231a:	85 c0                	test   %eax,%eax
+  80231c:	78 02                	js     802320 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  80231e:	c9                   	leave
+  80231f:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  802320:	50                   	push   %eax
+  802321:	68 48 2b 80 00       	push   $0x802b48
+  802326:	68 80 00 00 00       	push   $0x80
+  80232b:	68 74 2b 80 00       	push   $0x802b74
+  802330:	e8 6c fe ff ff       	call   8021a1 <_panic>
+
+00802335 <ipc_send>:
+{
+  802335:	55                   	push   %ebp
+  802336:	89 e5                	mov    %esp,%ebp
+  802338:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  80233b:	ff 75 14             	push   0x14(%ebp)
+  80233e:	6a 01                	push   $0x1
+  802340:	ff 75 10             	push   0x10(%ebp)
+  802343:	ff 75 0c             	push   0xc(%ebp)
+  802346:	ff 75 08             	push   0x8(%ebp)
+  802349:	e8 a4 ff ff ff       	call   8022f2 <ipc_send_pages>
+}
+  80234e:	83 c4 20             	add    $0x20,%esp
+  802351:	c9                   	leave
+  802352:	c3                   	ret
+
+00802353 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802353:	55                   	push   %ebp
+  802354:	89 e5                	mov    %esp,%ebp
+  802356:	83 ec 14             	sub    $0x14,%esp
+  802359:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80235c:	85 c0                	test   %eax,%eax
+  80235e:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802363:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802366:	ff 75 18             	push   0x18(%ebp)
+  802369:	ff 75 14             	push   0x14(%ebp)
+  80236c:	50                   	push   %eax
+  80236d:	ff 75 0c             	push   0xc(%ebp)
+  802370:	ff 75 08             	push   0x8(%ebp)
+  802373:	e8 25 ed ff ff       	call   80109d <sys_ipc_call>
+  802378:	83 c4 20             	add    $0x20,%esp
+  80237b:	85 c0                	test   %eax,%eax
+  80237d:	78 0b                	js     80238a <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  80237f:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802384:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80238a:	c9                   	leave
+  80238b:	c3                   	ret
+
+0080238c <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  80238c:	55                   	push   %ebp
+  80238d:	89 e5                	mov    %esp,%ebp
+  80238f:	57                   	push   %edi
+  802390:	56                   	push   %esi
+  802391:	53                   	push   %ebx
+  802392:	83 ec 18             	sub    $0x18,%esp
+  802395:	8b 45 10             	mov    0x10(%ebp),%eax
+  802398:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  80239b:	8b 75 20             	mov    0x20(%ebp),%esi
+  80239e:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8023a1:	85 c0                	test   %eax,%eax
+  8023a3:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8023a8:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8023ab:	ff 75 18             	push   0x18(%ebp)
+  8023ae:	ff 75 14             	push   0x14(%ebp)
+  8023b1:	50                   	push   %eax
+  8023b2:	ff 75 0c             	push   0xc(%ebp)
+  8023b5:	ff 75 08             	push   0x8(%ebp)
+  8023b8:	e8 21 ed ff ff       	call   8010de <sys_ipc_reply_recv>
+  8023bd:	83 c4 20             	add    $0x20,%esp
+  8023c0:	85 c0                	test   %eax,%eax
+  8023c2:	78 46                	js     80240a <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8023c4:	85 ff                	test   %edi,%edi
+  8023c6:	74 0d                	je     8023d5 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8023c8:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8023cd:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8023d3:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8023d5:	85 f6                	test   %esi,%esi
+  8023d7:	74 0d                	je     8023e6 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8023d9:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8023de:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8023e4:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8023e6:	85 db                	test   %ebx,%ebx
+  8023e8:	74 0d                	je     8023f7 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8023ea:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8023ef:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8023f5:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8023f7:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8023fc:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802402:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802405:	5b                   	pop    %ebx
+  802406:	5e                   	pop    %esi
+  802407:	5f                   	pop    %edi
+  802408:	5d                   	pop    %ebp
+  802409:	c3                   	ret
+		if (from_env_store) {
+  80240a:	85 ff                	test   %edi,%edi
+  80240c:	74 06                	je     802414 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  80240e:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802414:	85 f6                	test   %esi,%esi
+  802416:	74 06                	je     80241e <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  802418:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80241e:	85 db                	test   %ebx,%ebx
+  802420:	74 e0                	je     802402 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  802422:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802428:	eb d8                	jmp    802402 <ipc_reply_recv+0x76>
+
+0080242a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80242a:	55                   	push   %ebp
+  80242b:	89 e5                	mov    %esp,%ebp
+  80242d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802430:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  802435:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802438:	c1 e0 06             	shl    $0x6,%eax
+  80243b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802440:	8b 40 50             	mov    0x50(%eax),%eax
+  802443:	39 c8                	cmp    %ecx,%eax
+  802445:	74 12                	je     802459 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802447:	83 c2 01             	add    $0x1,%edx
+  80244a:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802450:	75 e3                	jne    802435 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802452:	b8 00 00 00 00       	mov    $0x0,%eax
+  802457:	eb 0e                	jmp    802467 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802459:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80245c:	c1 e0 06             	shl    $0x6,%eax
+  80245f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802464:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802467:	5d                   	pop    %ebp
+  802468:	c3                   	ret
+
+00802469 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802469:	55                   	push   %ebp
+  80246a:	89 e5                	mov    %esp,%ebp
+  80246c:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80246f:	89 c2                	mov    %eax,%edx
+  802471:	c1 ea 16             	shr    $0x16,%edx
+  802474:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80247b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802480:	f6 c1 01             	test   $0x1,%cl
+  802483:	74 1e                	je     8024a3 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  802485:	c1 e8 0c             	shr    $0xc,%eax
+  802488:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80248f:	a8 01                	test   $0x1,%al
+  802491:	74 10                	je     8024a3 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802493:	c1 e8 0c             	shr    $0xc,%eax
+  802496:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802499:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  8024a0:	0f b7 d2             	movzwl %dx,%edx
+}
+  8024a3:	89 d0                	mov    %edx,%eax
+  8024a5:	5d                   	pop    %ebp
+  8024a6:	c3                   	ret
+
+008024a7 <udivmod>:
+  8024a7:	55                   	push   %ebp
+  8024a8:	57                   	push   %edi
+  8024a9:	56                   	push   %esi
+  8024aa:	53                   	push   %ebx
+  8024ab:	83 ec 24             	sub    $0x24,%esp
+  8024ae:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8024b2:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8024b6:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8024ba:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8024be:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024c2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024c6:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8024ca:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d9:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024e0:	00 
+  8024e1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024e8:	00 
+  8024e9:	89 fb                	mov    %edi,%ebx
+  8024eb:	eb 08                	jmp    8024f5 <udivmod+0x4e>
+  8024ed:	83 e9 01             	sub    $0x1,%ecx
+  8024f0:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8024f3:	74 68                	je     80255d <udivmod+0xb6>
+  8024f5:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024f9:	01 c0                	add    %eax,%eax
+  8024fb:	89 c6                	mov    %eax,%esi
+  8024fd:	89 d7                	mov    %edx,%edi
+  8024ff:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802503:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802507:	0f ad d0             	shrd   %cl,%edx,%eax
+  80250a:	d3 ea                	shr    %cl,%edx
+  80250c:	f6 c1 20             	test   $0x20,%cl
+  80250f:	74 04                	je     802515 <udivmod+0x6e>
+  802511:	89 d0                	mov    %edx,%eax
+  802513:	31 d2                	xor    %edx,%edx
+  802515:	83 e0 01             	and    $0x1,%eax
+  802518:	89 04 24             	mov    %eax,(%esp)
+  80251b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802522:	00 
+  802523:	8b 04 24             	mov    (%esp),%eax
+  802526:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80252a:	09 f0                	or     %esi,%eax
+  80252c:	09 fa                	or     %edi,%edx
+  80252e:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802532:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802536:	39 f0                	cmp    %esi,%eax
+  802538:	89 d5                	mov    %edx,%ebp
+  80253a:	19 fd                	sbb    %edi,%ebp
+  80253c:	72 af                	jb     8024ed <udivmod+0x46>
+  80253e:	29 f0                	sub    %esi,%eax
+  802540:	19 fa                	sbb    %edi,%edx
+  802542:	89 cf                	mov    %ecx,%edi
+  802544:	c1 ef 05             	shr    $0x5,%edi
+  802547:	83 e7 01             	and    $0x1,%edi
+  80254a:	89 fe                	mov    %edi,%esi
+  80254c:	83 f6 01             	xor    $0x1,%esi
+  80254f:	d3 e6                	shl    %cl,%esi
+  802551:	d3 e7                	shl    %cl,%edi
+  802553:	09 74 24 18          	or     %esi,0x18(%esp)
+  802557:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80255b:	eb 90                	jmp    8024ed <udivmod+0x46>
+  80255d:	85 db                	test   %ebx,%ebx
+  80255f:	74 05                	je     802566 <udivmod+0xbf>
+  802561:	89 03                	mov    %eax,(%ebx)
+  802563:	89 53 04             	mov    %edx,0x4(%ebx)
+  802566:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80256a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80256e:	83 c4 24             	add    $0x24,%esp
+  802571:	5b                   	pop    %ebx
+  802572:	5e                   	pop    %esi
+  802573:	5f                   	pop    %edi
+  802574:	5d                   	pop    %ebp
+  802575:	c3                   	ret
+
+00802576 <__udivdi3>:
+  802576:	83 ec 08             	sub    $0x8,%esp
+  802579:	6a 00                	push   $0x0
+  80257b:	ff 74 24 1c          	push   0x1c(%esp)
+  80257f:	ff 74 24 1c          	push   0x1c(%esp)
+  802583:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802587:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80258b:	e8 17 ff ff ff       	call   8024a7 <udivmod>
+  802590:	83 c4 14             	add    $0x14,%esp
+  802593:	c3                   	ret
+
+00802594 <__umoddi3>:
+  802594:	83 ec 18             	sub    $0x18,%esp
+  802597:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80259b:	50                   	push   %eax
+  80259c:	ff 74 24 2c          	push   0x2c(%esp)
+  8025a0:	ff 74 24 2c          	push   0x2c(%esp)
+  8025a4:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025a8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025ac:	e8 f6 fe ff ff       	call   8024a7 <udivmod>
+  8025b1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025b5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025b9:	83 c4 24             	add    $0x24,%esp
+  8025bc:	c3                   	ret
+
+008025bd <__divdi3>:
+  8025bd:	55                   	push   %ebp
+  8025be:	57                   	push   %edi
+  8025bf:	56                   	push   %esi
+  8025c0:	53                   	push   %ebx
+  8025c1:	83 ec 10             	sub    $0x10,%esp
+  8025c4:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8025c8:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8025cc:	89 c6                	mov    %eax,%esi
+  8025ce:	89 d7                	mov    %edx,%edi
+  8025d0:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8025d4:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8025d8:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025dc:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8025e0:	89 c5                	mov    %eax,%ebp
+  8025e2:	f7 dd                	neg    %ebp
+  8025e4:	89 d6                	mov    %edx,%esi
+  8025e6:	83 d6 00             	adc    $0x0,%esi
+  8025e9:	f7 de                	neg    %esi
+  8025eb:	0f 48 e8             	cmovs  %eax,%ebp
+  8025ee:	0f 49 d6             	cmovns %esi,%edx
+  8025f1:	6a 00                	push   $0x0
+  8025f3:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8025f7:	f7 de                	neg    %esi
+  8025f9:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8025fd:	83 d0 00             	adc    $0x0,%eax
+  802600:	f7 d8                	neg    %eax
+  802602:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  802607:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  80260c:	50                   	push   %eax
+  80260d:	56                   	push   %esi
+  80260e:	89 e8                	mov    %ebp,%eax
+  802610:	e8 92 fe ff ff       	call   8024a7 <udivmod>
+  802615:	83 c4 10             	add    $0x10,%esp
+  802618:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  80261d:	78 08                	js     802627 <__divdi3+0x6a>
+  80261f:	83 c4 0c             	add    $0xc,%esp
+  802622:	5b                   	pop    %ebx
+  802623:	5e                   	pop    %esi
+  802624:	5f                   	pop    %edi
+  802625:	5d                   	pop    %ebp
+  802626:	c3                   	ret
+  802627:	f7 d8                	neg    %eax
+  802629:	83 d2 00             	adc    $0x0,%edx
+  80262c:	f7 da                	neg    %edx
+  80262e:	eb ef                	jmp    80261f <__divdi3+0x62>
+
+00802630 <__moddi3>:
+  802630:	55                   	push   %ebp
+  802631:	57                   	push   %edi
+  802632:	56                   	push   %esi
+  802633:	53                   	push   %ebx
+  802634:	83 ec 18             	sub    $0x18,%esp
+  802637:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80263b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80263f:	89 f1                	mov    %esi,%ecx
+  802641:	f7 d9                	neg    %ecx
+  802643:	89 da                	mov    %ebx,%edx
+  802645:	83 d2 00             	adc    $0x0,%edx
+  802648:	f7 da                	neg    %edx
+  80264a:	0f 48 ce             	cmovs  %esi,%ecx
+  80264d:	0f 48 d3             	cmovs  %ebx,%edx
+  802650:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802654:	50                   	push   %eax
+  802655:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802659:	f7 de                	neg    %esi
+  80265b:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  80265f:	83 d0 00             	adc    $0x0,%eax
+  802662:	f7 d8                	neg    %eax
+  802664:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802669:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  80266e:	50                   	push   %eax
+  80266f:	56                   	push   %esi
+  802670:	89 c8                	mov    %ecx,%eax
+  802672:	e8 30 fe ff ff       	call   8024a7 <udivmod>
+  802677:	83 c4 10             	add    $0x10,%esp
+  80267a:	85 db                	test   %ebx,%ebx
+  80267c:	78 10                	js     80268e <__moddi3+0x5e>
+  80267e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802682:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802686:	83 c4 14             	add    $0x14,%esp
+  802689:	5b                   	pop    %ebx
+  80268a:	5e                   	pop    %esi
+  80268b:	5f                   	pop    %edi
+  80268c:	5d                   	pop    %ebp
+  80268d:	c3                   	ret
+  80268e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802692:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802696:	f7 d8                	neg    %eax
+  802698:	83 d2 00             	adc    $0x0,%edx
+  80269b:	f7 da                	neg    %edx
+  80269d:	eb e7                	jmp    802686 <__moddi3+0x56>
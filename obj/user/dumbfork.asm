@@ -0,0 +1,10054 @@
+
+obj/user/dumbfork.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9c 01 00 00       	call   8001cd <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <duppage>:
+	}
+}
+
+void
+duppage(envid_t dstenv, void *addr)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	// This is NOT what you should do in your fork.
+	if ((r = page_alloc(dstenv, addr, PTE_P|PTE_U|PTE_W, 1)) < 0)
+  80003e:	6a 01                	push   $0x1
+  800040:	6a 07                	push   $0x7
+  800042:	53                   	push   %ebx
+  800043:	56                   	push   %esi
+  800044:	e8 9e 35 00 00       	call   8035e7 <page_alloc>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	85 c0                	test   %eax,%eax
+  80004e:	78 4a                	js     80009a <duppage+0x67>
+		panic("page_alloc: %e", r);
+	if ((r = page_map(dstenv, addr, 0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  800050:	83 ec 0c             	sub    $0xc,%esp
+  800053:	6a 07                	push   $0x7
+  800055:	68 00 00 40 00       	push   $0x400000
+  80005a:	6a 00                	push   $0x0
+  80005c:	53                   	push   %ebx
+  80005d:	56                   	push   %esi
+  80005e:	e8 e5 3b 00 00       	call   803c48 <page_map>
+  800063:	83 c4 20             	add    $0x20,%esp
+  800066:	85 c0                	test   %eax,%eax
+  800068:	78 42                	js     8000ac <duppage+0x79>
+		panic("page_map: %e", r);
+	memmove(UTEMP, addr, PGSIZE);
+  80006a:	83 ec 04             	sub    $0x4,%esp
+  80006d:	68 00 10 00 00       	push   $0x1000
+  800072:	53                   	push   %ebx
+  800073:	68 00 00 40 00       	push   $0x400000
+  800078:	e8 fb 09 00 00       	call   800a78 <memmove>
+	if ((r = page_unmap(0, UTEMP)) < 0)
+  80007d:	83 c4 08             	add    $0x8,%esp
+  800080:	68 00 00 40 00       	push   $0x400000
+  800085:	6a 00                	push   $0x0
+  800087:	e8 fc 36 00 00       	call   803788 <page_unmap>
+  80008c:	83 c4 10             	add    $0x10,%esp
+  80008f:	85 c0                	test   %eax,%eax
+  800091:	78 2b                	js     8000be <duppage+0x8b>
+		panic("page_unmap: %e", r);
+}
+  800093:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800096:	5b                   	pop    %ebx
+  800097:	5e                   	pop    %esi
+  800098:	5d                   	pop    %ebp
+  800099:	c3                   	ret
+		panic("page_alloc: %e", r);
+  80009a:	50                   	push   %eax
+  80009b:	68 00 4e 80 00       	push   $0x804e00
+  8000a0:	6a 20                	push   $0x20
+  8000a2:	68 0f 4e 80 00       	push   $0x804e0f
+  8000a7:	e8 84 01 00 00       	call   800230 <_panic>
+		panic("page_map: %e", r);
+  8000ac:	50                   	push   %eax
+  8000ad:	68 1f 4e 80 00       	push   $0x804e1f
+  8000b2:	6a 22                	push   $0x22
+  8000b4:	68 0f 4e 80 00       	push   $0x804e0f
+  8000b9:	e8 72 01 00 00       	call   800230 <_panic>
+		panic("page_unmap: %e", r);
+  8000be:	50                   	push   %eax
+  8000bf:	68 2c 4e 80 00       	push   $0x804e2c
+  8000c4:	6a 25                	push   $0x25
+  8000c6:	68 0f 4e 80 00       	push   $0x804e0f
+  8000cb:	e8 60 01 00 00       	call   800230 <_panic>
+
+008000d0 <dumbfork>:
+
+envid_t
+dumbfork(void)
+{
+  8000d0:	55                   	push   %ebp
+  8000d1:	89 e5                	mov    %esp,%ebp
+  8000d3:	53                   	push   %ebx
+  8000d4:	83 ec 14             	sub    $0x14,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8000d7:	b8 07 00 00 00       	mov    $0x7,%eax
+  8000dc:	cd 30                	int    $0x30
+  8000de:	89 c3                	mov    %eax,%ebx
+	// The kernel will initialize it with a copy of our register state,
+	// so that the child will appear to have called sys_exofork() too -
+	// except that in the child, this "fake" call to sys_exofork()
+	// will return 0 instead of the envid of the child.
+	envid = sys_exofork();
+	if (envid < 0)
+  8000e0:	85 c0                	test   %eax,%eax
+  8000e2:	78 23                	js     800107 <dumbfork+0x37>
+		panic("sys_exofork: %e", envid);
+	if (envid == 0) {
+  8000e4:	ba 00 00 80 00       	mov    $0x800000,%edx
+  8000e9:	75 44                	jne    80012f <dumbfork+0x5f>
+		// We're the child.
+		// The copied value of the global variable 'thisenv'
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8000eb:	e8 b7 0c 00 00       	call   800da7 <sys_getenvid>
+  8000f0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8000f8:	c1 e0 06             	shl    $0x6,%eax
+  8000fb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800100:	a3 18 e9 80 00       	mov    %eax,0x80e918
+		return 0;
+  800105:	eb 57                	jmp    80015e <dumbfork+0x8e>
+		panic("sys_exofork: %e", envid);
+  800107:	50                   	push   %eax
+  800108:	68 3b 4e 80 00       	push   $0x804e3b
+  80010d:	6a 37                	push   $0x37
+  80010f:	68 0f 4e 80 00       	push   $0x804e0f
+  800114:	e8 17 01 00 00       	call   800230 <_panic>
+
+	// We're the parent.
+	// Eagerly copy our entire address space into the child.
+	// This is NOT what you should do in your fork implementation.
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+		duppage(envid, addr);
+  800119:	83 ec 08             	sub    $0x8,%esp
+  80011c:	52                   	push   %edx
+  80011d:	53                   	push   %ebx
+  80011e:	e8 10 ff ff ff       	call   800033 <duppage>
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+  800123:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800126:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80012c:	83 c4 10             	add    $0x10,%esp
+  80012f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  800132:	81 fa 2c 00 81 00    	cmp    $0x81002c,%edx
+  800138:	72 df                	jb     800119 <dumbfork+0x49>
+
+	// Also copy the stack we are currently running on.
+	duppage(envid, ROUNDDOWN(&addr, PGSIZE));
+  80013a:	83 ec 08             	sub    $0x8,%esp
+  80013d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800140:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800145:	50                   	push   %eax
+  800146:	53                   	push   %ebx
+  800147:	e8 e7 fe ff ff       	call   800033 <duppage>
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80014c:	83 c4 08             	add    $0x8,%esp
+  80014f:	6a 02                	push   $0x2
+  800151:	53                   	push   %ebx
+  800152:	e8 cc 0e 00 00       	call   801023 <sys_env_set_status>
+  800157:	83 c4 10             	add    $0x10,%esp
+  80015a:	85 c0                	test   %eax,%eax
+  80015c:	78 07                	js     800165 <dumbfork+0x95>
+		panic("sys_env_set_status: %e", r);
+
+	return envid;
+}
+  80015e:	89 d8                	mov    %ebx,%eax
+  800160:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800163:	c9                   	leave
+  800164:	c3                   	ret
+		panic("sys_env_set_status: %e", r);
+  800165:	50                   	push   %eax
+  800166:	68 4b 4e 80 00       	push   $0x804e4b
+  80016b:	6a 4c                	push   $0x4c
+  80016d:	68 0f 4e 80 00       	push   $0x804e0f
+  800172:	e8 b9 00 00 00       	call   800230 <_panic>
+
+00800177 <umain>:
+{
+  800177:	55                   	push   %ebp
+  800178:	89 e5                	mov    %esp,%ebp
+  80017a:	57                   	push   %edi
+  80017b:	56                   	push   %esi
+  80017c:	53                   	push   %ebx
+  80017d:	83 ec 0c             	sub    $0xc,%esp
+	who = dumbfork();
+  800180:	e8 4b ff ff ff       	call   8000d0 <dumbfork>
+  800185:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  800187:	85 c0                	test   %eax,%eax
+  800189:	bf 62 4e 80 00       	mov    $0x804e62,%edi
+  80018e:	b8 69 4e 80 00       	mov    $0x804e69,%eax
+  800193:	0f 44 f8             	cmove  %eax,%edi
+  800196:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80019b:	eb 1f                	jmp    8001bc <umain+0x45>
+  80019d:	83 fb 13             	cmp    $0x13,%ebx
+  8001a0:	7f 23                	jg     8001c5 <umain+0x4e>
+		cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  8001a2:	83 ec 04             	sub    $0x4,%esp
+  8001a5:	57                   	push   %edi
+  8001a6:	53                   	push   %ebx
+  8001a7:	68 6f 4e 80 00       	push   $0x804e6f
+  8001ac:	e8 5a 01 00 00       	call   80030b <cprintf>
+		sys_yield();
+  8001b1:	e8 10 0c 00 00       	call   800dc6 <sys_yield>
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  8001b6:	83 c3 01             	add    $0x1,%ebx
+  8001b9:	83 c4 10             	add    $0x10,%esp
+  8001bc:	85 f6                	test   %esi,%esi
+  8001be:	74 dd                	je     80019d <umain+0x26>
+  8001c0:	83 fb 09             	cmp    $0x9,%ebx
+  8001c3:	7e dd                	jle    8001a2 <umain+0x2b>
+}
+  8001c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c8:	5b                   	pop    %ebx
+  8001c9:	5e                   	pop    %esi
+  8001ca:	5f                   	pop    %edi
+  8001cb:	5d                   	pop    %ebp
+  8001cc:	c3                   	ret
+
+008001cd <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001cd:	55                   	push   %ebp
+  8001ce:	89 e5                	mov    %esp,%ebp
+  8001d0:	56                   	push   %esi
+  8001d1:	53                   	push   %ebx
+  8001d2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d5:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8001d8:	e8 ca 0b 00 00       	call   800da7 <sys_getenvid>
+  8001dd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001e2:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8001e5:	c1 e0 06             	shl    $0x6,%eax
+  8001e8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001ed:	a3 18 e9 80 00       	mov    %eax,0x80e918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001f2:	85 db                	test   %ebx,%ebx
+  8001f4:	7e 07                	jle    8001fd <libmain+0x30>
+		binaryname = argv[0];
+  8001f6:	8b 06                	mov    (%esi),%eax
+  8001f8:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  8001fd:	83 ec 08             	sub    $0x8,%esp
+  800200:	56                   	push   %esi
+  800201:	53                   	push   %ebx
+  800202:	e8 70 ff ff ff       	call   800177 <umain>
+
+	// exit gracefully
+	exit();
+  800207:	e8 0a 00 00 00       	call   800216 <exit>
+}
+  80020c:	83 c4 10             	add    $0x10,%esp
+  80020f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800212:	5b                   	pop    %ebx
+  800213:	5e                   	pop    %esi
+  800214:	5d                   	pop    %ebp
+  800215:	c3                   	ret
+
+00800216 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800216:	55                   	push   %ebp
+  800217:	89 e5                	mov    %esp,%ebp
+  800219:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80021c:	e8 2a 13 00 00       	call   80154b <close_all>
+	sys_env_destroy(0);
+  800221:	83 ec 0c             	sub    $0xc,%esp
+  800224:	6a 00                	push   $0x0
+  800226:	e8 3b 0b 00 00       	call   800d66 <sys_env_destroy>
+}
+  80022b:	83 c4 10             	add    $0x10,%esp
+  80022e:	c9                   	leave
+  80022f:	c3                   	ret
+
+00800230 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800230:	55                   	push   %ebp
+  800231:	89 e5                	mov    %esp,%ebp
+  800233:	56                   	push   %esi
+  800234:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800235:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800238:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80023e:	e8 64 0b 00 00       	call   800da7 <sys_getenvid>
+  800243:	83 ec 0c             	sub    $0xc,%esp
+  800246:	ff 75 0c             	push   0xc(%ebp)
+  800249:	ff 75 08             	push   0x8(%ebp)
+  80024c:	56                   	push   %esi
+  80024d:	50                   	push   %eax
+  80024e:	68 8c 4e 80 00       	push   $0x804e8c
+  800253:	e8 b3 00 00 00       	call   80030b <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800258:	83 c4 18             	add    $0x18,%esp
+  80025b:	53                   	push   %ebx
+  80025c:	ff 75 10             	push   0x10(%ebp)
+  80025f:	e8 56 00 00 00       	call   8002ba <vcprintf>
+	cprintf("\n");
+  800264:	c7 04 24 7f 4e 80 00 	movl   $0x804e7f,(%esp)
+  80026b:	e8 9b 00 00 00       	call   80030b <cprintf>
+  800270:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800273:	cc                   	int3
+	while (1)
+  800274:	eb fd                	jmp    800273 <_panic+0x43>
+
+00800276 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800276:	55                   	push   %ebp
+  800277:	89 e5                	mov    %esp,%ebp
+  800279:	53                   	push   %ebx
+  80027a:	83 ec 04             	sub    $0x4,%esp
+  80027d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800280:	8b 13                	mov    (%ebx),%edx
+  800282:	8d 42 01             	lea    0x1(%edx),%eax
+  800285:	89 03                	mov    %eax,(%ebx)
+  800287:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80028a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80028e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800293:	74 09                	je     80029e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800295:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800299:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80029c:	c9                   	leave
+  80029d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80029e:	83 ec 08             	sub    $0x8,%esp
+  8002a1:	68 ff 00 00 00       	push   $0xff
+  8002a6:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002a9:	50                   	push   %eax
+  8002aa:	e8 69 0a 00 00       	call   800d18 <sys_cputs>
+		b->idx = 0;
+  8002af:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002b5:	83 c4 10             	add    $0x10,%esp
+  8002b8:	eb db                	jmp    800295 <putch+0x1f>
+
+008002ba <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002ba:	55                   	push   %ebp
+  8002bb:	89 e5                	mov    %esp,%ebp
+  8002bd:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002c3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002ca:	00 00 00 
+	b.cnt = 0;
+  8002cd:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002d4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002d7:	ff 75 0c             	push   0xc(%ebp)
+  8002da:	ff 75 08             	push   0x8(%ebp)
+  8002dd:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002e3:	50                   	push   %eax
+  8002e4:	68 76 02 80 00       	push   $0x800276
+  8002e9:	e8 14 01 00 00       	call   800402 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002ee:	83 c4 08             	add    $0x8,%esp
+  8002f1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002f7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002fd:	50                   	push   %eax
+  8002fe:	e8 15 0a 00 00       	call   800d18 <sys_cputs>
+
+	return b.cnt;
+}
+  800303:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800309:	c9                   	leave
+  80030a:	c3                   	ret
+
+0080030b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80030b:	55                   	push   %ebp
+  80030c:	89 e5                	mov    %esp,%ebp
+  80030e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800311:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800314:	50                   	push   %eax
+  800315:	ff 75 08             	push   0x8(%ebp)
+  800318:	e8 9d ff ff ff       	call   8002ba <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80031d:	c9                   	leave
+  80031e:	c3                   	ret
+
+0080031f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80031f:	55                   	push   %ebp
+  800320:	89 e5                	mov    %esp,%ebp
+  800322:	57                   	push   %edi
+  800323:	56                   	push   %esi
+  800324:	53                   	push   %ebx
+  800325:	83 ec 1c             	sub    $0x1c,%esp
+  800328:	89 c7                	mov    %eax,%edi
+  80032a:	89 d6                	mov    %edx,%esi
+  80032c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80032f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800332:	89 d1                	mov    %edx,%ecx
+  800334:	89 c2                	mov    %eax,%edx
+  800336:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800339:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80033c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80033f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800342:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800345:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80034c:	39 c2                	cmp    %eax,%edx
+  80034e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800351:	72 3e                	jb     800391 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800353:	83 ec 0c             	sub    $0xc,%esp
+  800356:	ff 75 18             	push   0x18(%ebp)
+  800359:	83 eb 01             	sub    $0x1,%ebx
+  80035c:	53                   	push   %ebx
+  80035d:	50                   	push   %eax
+  80035e:	83 ec 08             	sub    $0x8,%esp
+  800361:	ff 75 e4             	push   -0x1c(%ebp)
+  800364:	ff 75 e0             	push   -0x20(%ebp)
+  800367:	ff 75 dc             	push   -0x24(%ebp)
+  80036a:	ff 75 d8             	push   -0x28(%ebp)
+  80036d:	e8 4e 49 00 00       	call   804cc0 <__udivdi3>
+  800372:	83 c4 18             	add    $0x18,%esp
+  800375:	52                   	push   %edx
+  800376:	50                   	push   %eax
+  800377:	89 f2                	mov    %esi,%edx
+  800379:	89 f8                	mov    %edi,%eax
+  80037b:	e8 9f ff ff ff       	call   80031f <printnum>
+  800380:	83 c4 20             	add    $0x20,%esp
+  800383:	eb 13                	jmp    800398 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800385:	83 ec 08             	sub    $0x8,%esp
+  800388:	56                   	push   %esi
+  800389:	ff 75 18             	push   0x18(%ebp)
+  80038c:	ff d7                	call   *%edi
+  80038e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800391:	83 eb 01             	sub    $0x1,%ebx
+  800394:	85 db                	test   %ebx,%ebx
+  800396:	7f ed                	jg     800385 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800398:	83 ec 08             	sub    $0x8,%esp
+  80039b:	56                   	push   %esi
+  80039c:	83 ec 04             	sub    $0x4,%esp
+  80039f:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a2:	ff 75 e0             	push   -0x20(%ebp)
+  8003a5:	ff 75 dc             	push   -0x24(%ebp)
+  8003a8:	ff 75 d8             	push   -0x28(%ebp)
+  8003ab:	e8 2e 49 00 00       	call   804cde <__umoddi3>
+  8003b0:	83 c4 14             	add    $0x14,%esp
+  8003b3:	0f be 80 af 4e 80 00 	movsbl 0x804eaf(%eax),%eax
+  8003ba:	50                   	push   %eax
+  8003bb:	ff d7                	call   *%edi
+}
+  8003bd:	83 c4 10             	add    $0x10,%esp
+  8003c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c3:	5b                   	pop    %ebx
+  8003c4:	5e                   	pop    %esi
+  8003c5:	5f                   	pop    %edi
+  8003c6:	5d                   	pop    %ebp
+  8003c7:	c3                   	ret
+
+008003c8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003c8:	55                   	push   %ebp
+  8003c9:	89 e5                	mov    %esp,%ebp
+  8003cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003ce:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003d2:	8b 10                	mov    (%eax),%edx
+  8003d4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003d7:	73 0a                	jae    8003e3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003d9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003dc:	89 08                	mov    %ecx,(%eax)
+  8003de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003e1:	88 02                	mov    %al,(%edx)
+}
+  8003e3:	5d                   	pop    %ebp
+  8003e4:	c3                   	ret
+
+008003e5 <printfmt>:
+{
+  8003e5:	55                   	push   %ebp
+  8003e6:	89 e5                	mov    %esp,%ebp
+  8003e8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003eb:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003ee:	50                   	push   %eax
+  8003ef:	ff 75 10             	push   0x10(%ebp)
+  8003f2:	ff 75 0c             	push   0xc(%ebp)
+  8003f5:	ff 75 08             	push   0x8(%ebp)
+  8003f8:	e8 05 00 00 00       	call   800402 <vprintfmt>
+}
+  8003fd:	83 c4 10             	add    $0x10,%esp
+  800400:	c9                   	leave
+  800401:	c3                   	ret
+
+00800402 <vprintfmt>:
+{
+  800402:	55                   	push   %ebp
+  800403:	89 e5                	mov    %esp,%ebp
+  800405:	57                   	push   %edi
+  800406:	56                   	push   %esi
+  800407:	53                   	push   %ebx
+  800408:	83 ec 2c             	sub    $0x2c,%esp
+  80040b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80040e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800411:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800414:	eb 0a                	jmp    800420 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800416:	83 ec 08             	sub    $0x8,%esp
+  800419:	53                   	push   %ebx
+  80041a:	50                   	push   %eax
+  80041b:	ff d6                	call   *%esi
+  80041d:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800420:	83 c7 01             	add    $0x1,%edi
+  800423:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800427:	83 f8 25             	cmp    $0x25,%eax
+  80042a:	74 0c                	je     800438 <vprintfmt+0x36>
+			if (ch == '\0')
+  80042c:	85 c0                	test   %eax,%eax
+  80042e:	75 e6                	jne    800416 <vprintfmt+0x14>
+}
+  800430:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800433:	5b                   	pop    %ebx
+  800434:	5e                   	pop    %esi
+  800435:	5f                   	pop    %edi
+  800436:	5d                   	pop    %ebp
+  800437:	c3                   	ret
+		padc = ' ';
+  800438:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80043c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800443:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80044a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800451:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800456:	8d 47 01             	lea    0x1(%edi),%eax
+  800459:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80045c:	0f b6 17             	movzbl (%edi),%edx
+  80045f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800462:	3c 55                	cmp    $0x55,%al
+  800464:	0f 87 c5 03 00 00    	ja     80082f <vprintfmt+0x42d>
+  80046a:	0f b6 c0             	movzbl %al,%eax
+  80046d:	ff 24 85 40 50 80 00 	jmp    *0x805040(,%eax,4)
+  800474:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800477:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80047b:	eb d9                	jmp    800456 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800480:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800484:	eb d0                	jmp    800456 <vprintfmt+0x54>
+  800486:	0f b6 d2             	movzbl %dl,%edx
+  800489:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80048c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800491:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800494:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800497:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80049b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80049e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004a1:	83 f9 09             	cmp    $0x9,%ecx
+  8004a4:	77 55                	ja     8004fb <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004a6:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004a9:	eb e9                	jmp    800494 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ae:	8b 00                	mov    (%eax),%eax
+  8004b0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8004b9:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004bf:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c3:	79 91                	jns    800456 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004c5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004cb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004d2:	eb 82                	jmp    800456 <vprintfmt+0x54>
+			if (width < 0)
+  8004d4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d7:	85 d2                	test   %edx,%edx
+  8004d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004de:	0f 49 c2             	cmovns %edx,%eax
+  8004e1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004e7:	e9 6a ff ff ff       	jmp    800456 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004ef:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004f6:	e9 5b ff ff ff       	jmp    800456 <vprintfmt+0x54>
+  8004fb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004fe:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800501:	eb bc                	jmp    8004bf <vprintfmt+0xbd>
+			lflag++;
+  800503:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800506:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800509:	e9 48 ff ff ff       	jmp    800456 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80050e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800511:	8d 78 04             	lea    0x4(%eax),%edi
+  800514:	83 ec 08             	sub    $0x8,%esp
+  800517:	53                   	push   %ebx
+  800518:	ff 30                	push   (%eax)
+  80051a:	ff d6                	call   *%esi
+			break;
+  80051c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80051f:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800522:	e9 63 02 00 00       	jmp    80078a <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800527:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052a:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80052d:	8b 10                	mov    (%eax),%edx
+  80052f:	89 d0                	mov    %edx,%eax
+  800531:	f7 d8                	neg    %eax
+  800533:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800536:	83 f8 12             	cmp    $0x12,%eax
+  800539:	7f 23                	jg     80055e <vprintfmt+0x15c>
+  80053b:	8b 14 85 a0 51 80 00 	mov    0x8051a0(,%eax,4),%edx
+  800542:	85 d2                	test   %edx,%edx
+  800544:	74 18                	je     80055e <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800546:	52                   	push   %edx
+  800547:	68 dd 52 80 00       	push   $0x8052dd
+  80054c:	53                   	push   %ebx
+  80054d:	56                   	push   %esi
+  80054e:	e8 92 fe ff ff       	call   8003e5 <printfmt>
+  800553:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800556:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800559:	e9 2c 02 00 00       	jmp    80078a <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80055e:	50                   	push   %eax
+  80055f:	68 c7 4e 80 00       	push   $0x804ec7
+  800564:	53                   	push   %ebx
+  800565:	56                   	push   %esi
+  800566:	e8 7a fe ff ff       	call   8003e5 <printfmt>
+  80056b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80056e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800571:	e9 14 02 00 00       	jmp    80078a <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800576:	8b 45 14             	mov    0x14(%ebp),%eax
+  800579:	83 c0 04             	add    $0x4,%eax
+  80057c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80057f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800582:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800584:	85 c9                	test   %ecx,%ecx
+  800586:	b8 c0 4e 80 00       	mov    $0x804ec0,%eax
+  80058b:	0f 45 c1             	cmovne %ecx,%eax
+  80058e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800591:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800595:	7e 06                	jle    80059d <vprintfmt+0x19b>
+  800597:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80059b:	75 0b                	jne    8005a8 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005a0:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005a3:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005a6:	eb 5c                	jmp    800604 <vprintfmt+0x202>
+  8005a8:	83 ec 08             	sub    $0x8,%esp
+  8005ab:	ff 75 d0             	push   -0x30(%ebp)
+  8005ae:	ff 75 cc             	push   -0x34(%ebp)
+  8005b1:	e8 19 03 00 00       	call   8008cf <strnlen>
+  8005b6:	89 c2                	mov    %eax,%edx
+  8005b8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005bb:	29 d0                	sub    %edx,%eax
+  8005bd:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005c0:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005c4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005ca:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005cc:	eb 0e                	jmp    8005dc <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005ce:	83 ec 08             	sub    $0x8,%esp
+  8005d1:	53                   	push   %ebx
+  8005d2:	57                   	push   %edi
+  8005d3:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d6:	83 ee 01             	sub    $0x1,%esi
+  8005d9:	83 c4 10             	add    $0x10,%esp
+  8005dc:	85 f6                	test   %esi,%esi
+  8005de:	7f ee                	jg     8005ce <vprintfmt+0x1cc>
+  8005e0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e6:	85 c0                	test   %eax,%eax
+  8005e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ed:	0f 49 d0             	cmovns %eax,%edx
+  8005f0:	29 d0                	sub    %edx,%eax
+  8005f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f5:	eb a6                	jmp    80059d <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005f7:	83 ec 08             	sub    $0x8,%esp
+  8005fa:	53                   	push   %ebx
+  8005fb:	52                   	push   %edx
+  8005fc:	ff 55 08             	call   *0x8(%ebp)
+  8005ff:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800602:	89 f1                	mov    %esi,%ecx
+  800604:	8d 71 01             	lea    0x1(%ecx),%esi
+  800607:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80060b:	0f be d0             	movsbl %al,%edx
+  80060e:	85 d2                	test   %edx,%edx
+  800610:	74 28                	je     80063a <vprintfmt+0x238>
+  800612:	85 ff                	test   %edi,%edi
+  800614:	78 05                	js     80061b <vprintfmt+0x219>
+  800616:	83 ef 01             	sub    $0x1,%edi
+  800619:	78 30                	js     80064b <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80061b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80061f:	74 d6                	je     8005f7 <vprintfmt+0x1f5>
+  800621:	0f be c0             	movsbl %al,%eax
+  800624:	83 e8 20             	sub    $0x20,%eax
+  800627:	83 f8 5e             	cmp    $0x5e,%eax
+  80062a:	76 cb                	jbe    8005f7 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80062c:	83 ec 08             	sub    $0x8,%esp
+  80062f:	53                   	push   %ebx
+  800630:	6a 3f                	push   $0x3f
+  800632:	ff 55 08             	call   *0x8(%ebp)
+  800635:	83 c4 10             	add    $0x10,%esp
+  800638:	eb c8                	jmp    800602 <vprintfmt+0x200>
+  80063a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80063d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800640:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800643:	01 d0                	add    %edx,%eax
+  800645:	29 c8                	sub    %ecx,%eax
+  800647:	89 c7                	mov    %eax,%edi
+  800649:	eb 13                	jmp    80065e <vprintfmt+0x25c>
+  80064b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80064e:	eb ed                	jmp    80063d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800650:	83 ec 08             	sub    $0x8,%esp
+  800653:	53                   	push   %ebx
+  800654:	6a 20                	push   $0x20
+  800656:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800658:	83 ef 01             	sub    $0x1,%edi
+  80065b:	83 c4 10             	add    $0x10,%esp
+  80065e:	85 ff                	test   %edi,%edi
+  800660:	7f ee                	jg     800650 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800662:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800665:	89 45 14             	mov    %eax,0x14(%ebp)
+  800668:	e9 1d 01 00 00       	jmp    80078a <vprintfmt+0x388>
+	if (lflag >= 2)
+  80066d:	83 f9 01             	cmp    $0x1,%ecx
+  800670:	7f 1b                	jg     80068d <vprintfmt+0x28b>
+	else if (lflag)
+  800672:	85 c9                	test   %ecx,%ecx
+  800674:	74 63                	je     8006d9 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800676:	8b 45 14             	mov    0x14(%ebp),%eax
+  800679:	8b 00                	mov    (%eax),%eax
+  80067b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80067e:	99                   	cltd
+  80067f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800682:	8b 45 14             	mov    0x14(%ebp),%eax
+  800685:	8d 40 04             	lea    0x4(%eax),%eax
+  800688:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068b:	eb 17                	jmp    8006a4 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80068d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800690:	8b 50 04             	mov    0x4(%eax),%edx
+  800693:	8b 00                	mov    (%eax),%eax
+  800695:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800698:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80069b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069e:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a1:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006a4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006a7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006aa:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006af:	85 c9                	test   %ecx,%ecx
+  8006b1:	0f 89 b9 00 00 00    	jns    800770 <vprintfmt+0x36e>
+				putch('-', putdat);
+  8006b7:	83 ec 08             	sub    $0x8,%esp
+  8006ba:	53                   	push   %ebx
+  8006bb:	6a 2d                	push   $0x2d
+  8006bd:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006bf:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006c2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006c5:	f7 da                	neg    %edx
+  8006c7:	83 d1 00             	adc    $0x0,%ecx
+  8006ca:	f7 d9                	neg    %ecx
+  8006cc:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006cf:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006d4:	e9 97 00 00 00       	jmp    800770 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8006d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dc:	8b 00                	mov    (%eax),%eax
+  8006de:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e1:	99                   	cltd
+  8006e2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ee:	eb b4                	jmp    8006a4 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8006f0:	83 f9 01             	cmp    $0x1,%ecx
+  8006f3:	7f 1b                	jg     800710 <vprintfmt+0x30e>
+	else if (lflag)
+  8006f5:	85 c9                	test   %ecx,%ecx
+  8006f7:	74 2c                	je     800725 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8006f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fc:	8b 10                	mov    (%eax),%edx
+  8006fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800703:	8d 40 04             	lea    0x4(%eax),%eax
+  800706:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800709:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80070e:	eb 60                	jmp    800770 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800710:	8b 45 14             	mov    0x14(%ebp),%eax
+  800713:	8b 10                	mov    (%eax),%edx
+  800715:	8b 48 04             	mov    0x4(%eax),%ecx
+  800718:	8d 40 08             	lea    0x8(%eax),%eax
+  80071b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80071e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800723:	eb 4b                	jmp    800770 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800725:	8b 45 14             	mov    0x14(%ebp),%eax
+  800728:	8b 10                	mov    (%eax),%edx
+  80072a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80072f:	8d 40 04             	lea    0x4(%eax),%eax
+  800732:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800735:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80073a:	eb 34                	jmp    800770 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80073c:	83 f9 01             	cmp    $0x1,%ecx
+  80073f:	7f 15                	jg     800756 <vprintfmt+0x354>
+	else if (lflag)
+  800741:	85 c9                	test   %ecx,%ecx
+  800743:	74 4d                	je     800792 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800745:	8b 45 14             	mov    0x14(%ebp),%eax
+  800748:	8b 00                	mov    (%eax),%eax
+  80074a:	99                   	cltd
+  80074b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80074e:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800751:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800754:	eb 11                	jmp    800767 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800756:	8b 45 14             	mov    0x14(%ebp),%eax
+  800759:	8b 50 04             	mov    0x4(%eax),%edx
+  80075c:	8b 00                	mov    (%eax),%eax
+  80075e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800761:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800764:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800767:	89 d1                	mov    %edx,%ecx
+  800769:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  80076b:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800770:	83 ec 0c             	sub    $0xc,%esp
+  800773:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800777:	50                   	push   %eax
+  800778:	ff 75 e0             	push   -0x20(%ebp)
+  80077b:	57                   	push   %edi
+  80077c:	51                   	push   %ecx
+  80077d:	52                   	push   %edx
+  80077e:	89 da                	mov    %ebx,%edx
+  800780:	89 f0                	mov    %esi,%eax
+  800782:	e8 98 fb ff ff       	call   80031f <printnum>
+			break;
+  800787:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80078a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80078d:	e9 8e fc ff ff       	jmp    800420 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800792:	8b 45 14             	mov    0x14(%ebp),%eax
+  800795:	8b 00                	mov    (%eax),%eax
+  800797:	99                   	cltd
+  800798:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80079b:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80079e:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8007a1:	eb c4                	jmp    800767 <vprintfmt+0x365>
+			putch('0', putdat);
+  8007a3:	83 ec 08             	sub    $0x8,%esp
+  8007a6:	53                   	push   %ebx
+  8007a7:	6a 30                	push   $0x30
+  8007a9:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007ab:	83 c4 08             	add    $0x8,%esp
+  8007ae:	53                   	push   %ebx
+  8007af:	6a 78                	push   $0x78
+  8007b1:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b6:	8b 10                	mov    (%eax),%edx
+  8007b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007bd:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c6:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8007cb:	eb a3                	jmp    800770 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8007cd:	83 f9 01             	cmp    $0x1,%ecx
+  8007d0:	7f 1b                	jg     8007ed <vprintfmt+0x3eb>
+	else if (lflag)
+  8007d2:	85 c9                	test   %ecx,%ecx
+  8007d4:	74 2f                	je     800805 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8007d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d9:	8b 10                	mov    (%eax),%edx
+  8007db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007e6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007eb:	eb 83                	jmp    800770 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8007ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f0:	8b 10                	mov    (%eax),%edx
+  8007f2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007f5:	8d 40 08             	lea    0x8(%eax),%eax
+  8007f8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007fb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800800:	e9 6b ff ff ff       	jmp    800770 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800805:	8b 45 14             	mov    0x14(%ebp),%eax
+  800808:	8b 10                	mov    (%eax),%edx
+  80080a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80080f:	8d 40 04             	lea    0x4(%eax),%eax
+  800812:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800815:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80081a:	e9 51 ff ff ff       	jmp    800770 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  80081f:	83 ec 08             	sub    $0x8,%esp
+  800822:	53                   	push   %ebx
+  800823:	6a 25                	push   $0x25
+  800825:	ff d6                	call   *%esi
+			break;
+  800827:	83 c4 10             	add    $0x10,%esp
+  80082a:	e9 5b ff ff ff       	jmp    80078a <vprintfmt+0x388>
+			putch('%', putdat);
+  80082f:	83 ec 08             	sub    $0x8,%esp
+  800832:	53                   	push   %ebx
+  800833:	6a 25                	push   $0x25
+  800835:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800837:	83 c4 10             	add    $0x10,%esp
+  80083a:	89 f8                	mov    %edi,%eax
+  80083c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800840:	74 05                	je     800847 <vprintfmt+0x445>
+  800842:	83 e8 01             	sub    $0x1,%eax
+  800845:	eb f5                	jmp    80083c <vprintfmt+0x43a>
+  800847:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80084a:	e9 3b ff ff ff       	jmp    80078a <vprintfmt+0x388>
+
+0080084f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80084f:	55                   	push   %ebp
+  800850:	89 e5                	mov    %esp,%ebp
+  800852:	83 ec 18             	sub    $0x18,%esp
+  800855:	8b 45 08             	mov    0x8(%ebp),%eax
+  800858:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80085b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80085e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800862:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800865:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80086c:	85 c0                	test   %eax,%eax
+  80086e:	74 26                	je     800896 <vsnprintf+0x47>
+  800870:	85 d2                	test   %edx,%edx
+  800872:	7e 22                	jle    800896 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800874:	ff 75 14             	push   0x14(%ebp)
+  800877:	ff 75 10             	push   0x10(%ebp)
+  80087a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80087d:	50                   	push   %eax
+  80087e:	68 c8 03 80 00       	push   $0x8003c8
+  800883:	e8 7a fb ff ff       	call   800402 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800888:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80088b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80088e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800891:	83 c4 10             	add    $0x10,%esp
+}
+  800894:	c9                   	leave
+  800895:	c3                   	ret
+		return -E_INVAL;
+  800896:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80089b:	eb f7                	jmp    800894 <vsnprintf+0x45>
+
+0080089d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80089d:	55                   	push   %ebp
+  80089e:	89 e5                	mov    %esp,%ebp
+  8008a0:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008a3:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008a6:	50                   	push   %eax
+  8008a7:	ff 75 10             	push   0x10(%ebp)
+  8008aa:	ff 75 0c             	push   0xc(%ebp)
+  8008ad:	ff 75 08             	push   0x8(%ebp)
+  8008b0:	e8 9a ff ff ff       	call   80084f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008b5:	c9                   	leave
+  8008b6:	c3                   	ret
+
+008008b7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008b7:	55                   	push   %ebp
+  8008b8:	89 e5                	mov    %esp,%ebp
+  8008ba:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c2:	eb 03                	jmp    8008c7 <strlen+0x10>
+		n++;
+  8008c4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008c7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008cb:	75 f7                	jne    8008c4 <strlen+0xd>
+	return n;
+}
+  8008cd:	5d                   	pop    %ebp
+  8008ce:	c3                   	ret
+
+008008cf <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008cf:	55                   	push   %ebp
+  8008d0:	89 e5                	mov    %esp,%ebp
+  8008d2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008dd:	eb 03                	jmp    8008e2 <strnlen+0x13>
+		n++;
+  8008df:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e2:	39 d0                	cmp    %edx,%eax
+  8008e4:	74 08                	je     8008ee <strnlen+0x1f>
+  8008e6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008ea:	75 f3                	jne    8008df <strnlen+0x10>
+  8008ec:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008ee:	89 d0                	mov    %edx,%eax
+  8008f0:	5d                   	pop    %ebp
+  8008f1:	c3                   	ret
+
+008008f2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008f2:	55                   	push   %ebp
+  8008f3:	89 e5                	mov    %esp,%ebp
+  8008f5:	53                   	push   %ebx
+  8008f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800901:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800905:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800908:	83 c0 01             	add    $0x1,%eax
+  80090b:	84 d2                	test   %dl,%dl
+  80090d:	75 f2                	jne    800901 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80090f:	89 c8                	mov    %ecx,%eax
+  800911:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800914:	c9                   	leave
+  800915:	c3                   	ret
+
+00800916 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800916:	55                   	push   %ebp
+  800917:	89 e5                	mov    %esp,%ebp
+  800919:	53                   	push   %ebx
+  80091a:	83 ec 10             	sub    $0x10,%esp
+  80091d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800920:	53                   	push   %ebx
+  800921:	e8 91 ff ff ff       	call   8008b7 <strlen>
+  800926:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800929:	ff 75 0c             	push   0xc(%ebp)
+  80092c:	01 d8                	add    %ebx,%eax
+  80092e:	50                   	push   %eax
+  80092f:	e8 be ff ff ff       	call   8008f2 <strcpy>
+	return dst;
+}
+  800934:	89 d8                	mov    %ebx,%eax
+  800936:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800939:	c9                   	leave
+  80093a:	c3                   	ret
+
+0080093b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80093b:	55                   	push   %ebp
+  80093c:	89 e5                	mov    %esp,%ebp
+  80093e:	56                   	push   %esi
+  80093f:	53                   	push   %ebx
+  800940:	8b 75 08             	mov    0x8(%ebp),%esi
+  800943:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800946:	89 f3                	mov    %esi,%ebx
+  800948:	03 5d 10             	add    0x10(%ebp),%ebx
+  80094b:	89 f0                	mov    %esi,%eax
+  80094d:	eb 0f                	jmp    80095e <strncpy+0x23>
+		*dst++ = *src;
+  80094f:	83 c0 01             	add    $0x1,%eax
+  800952:	0f b6 0a             	movzbl (%edx),%ecx
+  800955:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800958:	80 f9 01             	cmp    $0x1,%cl
+  80095b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80095e:	39 d8                	cmp    %ebx,%eax
+  800960:	75 ed                	jne    80094f <strncpy+0x14>
+	}
+	return ret;
+}
+  800962:	89 f0                	mov    %esi,%eax
+  800964:	5b                   	pop    %ebx
+  800965:	5e                   	pop    %esi
+  800966:	5d                   	pop    %ebp
+  800967:	c3                   	ret
+
+00800968 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800968:	55                   	push   %ebp
+  800969:	89 e5                	mov    %esp,%ebp
+  80096b:	56                   	push   %esi
+  80096c:	53                   	push   %ebx
+  80096d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800970:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800973:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800976:	89 f0                	mov    %esi,%eax
+  800978:	85 d2                	test   %edx,%edx
+  80097a:	74 21                	je     80099d <strlcpy+0x35>
+  80097c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800980:	89 f2                	mov    %esi,%edx
+  800982:	eb 09                	jmp    80098d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800984:	83 c1 01             	add    $0x1,%ecx
+  800987:	83 c2 01             	add    $0x1,%edx
+  80098a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80098d:	39 c2                	cmp    %eax,%edx
+  80098f:	74 09                	je     80099a <strlcpy+0x32>
+  800991:	0f b6 19             	movzbl (%ecx),%ebx
+  800994:	84 db                	test   %bl,%bl
+  800996:	75 ec                	jne    800984 <strlcpy+0x1c>
+  800998:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80099a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80099d:	29 f0                	sub    %esi,%eax
+}
+  80099f:	5b                   	pop    %ebx
+  8009a0:	5e                   	pop    %esi
+  8009a1:	5d                   	pop    %ebp
+  8009a2:	c3                   	ret
+
+008009a3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009a3:	55                   	push   %ebp
+  8009a4:	89 e5                	mov    %esp,%ebp
+  8009a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009ac:	eb 06                	jmp    8009b4 <strcmp+0x11>
+		p++, q++;
+  8009ae:	83 c1 01             	add    $0x1,%ecx
+  8009b1:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009b4:	0f b6 01             	movzbl (%ecx),%eax
+  8009b7:	84 c0                	test   %al,%al
+  8009b9:	74 04                	je     8009bf <strcmp+0x1c>
+  8009bb:	3a 02                	cmp    (%edx),%al
+  8009bd:	74 ef                	je     8009ae <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009bf:	0f b6 c0             	movzbl %al,%eax
+  8009c2:	0f b6 12             	movzbl (%edx),%edx
+  8009c5:	29 d0                	sub    %edx,%eax
+}
+  8009c7:	5d                   	pop    %ebp
+  8009c8:	c3                   	ret
+
+008009c9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009c9:	55                   	push   %ebp
+  8009ca:	89 e5                	mov    %esp,%ebp
+  8009cc:	53                   	push   %ebx
+  8009cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009d3:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009d6:	eb 09                	jmp    8009e1 <strncmp+0x18>
+		n--, p++, q++;
+  8009d8:	83 ea 01             	sub    $0x1,%edx
+  8009db:	83 c0 01             	add    $0x1,%eax
+  8009de:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009e1:	85 d2                	test   %edx,%edx
+  8009e3:	74 18                	je     8009fd <strncmp+0x34>
+  8009e5:	0f b6 18             	movzbl (%eax),%ebx
+  8009e8:	84 db                	test   %bl,%bl
+  8009ea:	74 04                	je     8009f0 <strncmp+0x27>
+  8009ec:	3a 19                	cmp    (%ecx),%bl
+  8009ee:	74 e8                	je     8009d8 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009f0:	0f b6 00             	movzbl (%eax),%eax
+  8009f3:	0f b6 11             	movzbl (%ecx),%edx
+  8009f6:	29 d0                	sub    %edx,%eax
+}
+  8009f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009fb:	c9                   	leave
+  8009fc:	c3                   	ret
+		return 0;
+  8009fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a02:	eb f4                	jmp    8009f8 <strncmp+0x2f>
+
+00800a04 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a04:	55                   	push   %ebp
+  800a05:	89 e5                	mov    %esp,%ebp
+  800a07:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a0e:	eb 03                	jmp    800a13 <strchr+0xf>
+  800a10:	83 c0 01             	add    $0x1,%eax
+  800a13:	0f b6 10             	movzbl (%eax),%edx
+  800a16:	84 d2                	test   %dl,%dl
+  800a18:	74 06                	je     800a20 <strchr+0x1c>
+		if (*s == c)
+  800a1a:	38 ca                	cmp    %cl,%dl
+  800a1c:	75 f2                	jne    800a10 <strchr+0xc>
+  800a1e:	eb 05                	jmp    800a25 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a20:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a25:	5d                   	pop    %ebp
+  800a26:	c3                   	ret
+
+00800a27 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a27:	55                   	push   %ebp
+  800a28:	89 e5                	mov    %esp,%ebp
+  800a2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a31:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a34:	38 ca                	cmp    %cl,%dl
+  800a36:	74 09                	je     800a41 <strfind+0x1a>
+  800a38:	84 d2                	test   %dl,%dl
+  800a3a:	74 05                	je     800a41 <strfind+0x1a>
+	for (; *s; s++)
+  800a3c:	83 c0 01             	add    $0x1,%eax
+  800a3f:	eb f0                	jmp    800a31 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a41:	5d                   	pop    %ebp
+  800a42:	c3                   	ret
+
+00800a43 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a43:	55                   	push   %ebp
+  800a44:	89 e5                	mov    %esp,%ebp
+  800a46:	57                   	push   %edi
+  800a47:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a4a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a4d:	85 c9                	test   %ecx,%ecx
+  800a4f:	74 20                	je     800a71 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a51:	89 f8                	mov    %edi,%eax
+  800a53:	09 c8                	or     %ecx,%eax
+  800a55:	a8 03                	test   $0x3,%al
+  800a57:	75 12                	jne    800a6b <memset+0x28>
+		c &= 0xFF;
+  800a59:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a5d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a63:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a66:	fc                   	cld
+  800a67:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a69:	eb 06                	jmp    800a71 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a6e:	fc                   	cld
+  800a6f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a71:	89 f8                	mov    %edi,%eax
+  800a73:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a76:	c9                   	leave
+  800a77:	c3                   	ret
+
+00800a78 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a78:	55                   	push   %ebp
+  800a79:	89 e5                	mov    %esp,%ebp
+  800a7b:	57                   	push   %edi
+  800a7c:	56                   	push   %esi
+  800a7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a80:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a83:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a86:	39 c6                	cmp    %eax,%esi
+  800a88:	73 32                	jae    800abc <memmove+0x44>
+  800a8a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a8d:	39 d0                	cmp    %edx,%eax
+  800a8f:	73 2b                	jae    800abc <memmove+0x44>
+		s += n;
+		d += n;
+  800a91:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a94:	89 d6                	mov    %edx,%esi
+  800a96:	09 fe                	or     %edi,%esi
+  800a98:	09 ce                	or     %ecx,%esi
+  800a9a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aa0:	75 0e                	jne    800ab0 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800aa2:	83 ef 04             	sub    $0x4,%edi
+  800aa5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aa8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800aab:	fd                   	std
+  800aac:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aae:	eb 09                	jmp    800ab9 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ab0:	83 ef 01             	sub    $0x1,%edi
+  800ab3:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ab6:	fd                   	std
+  800ab7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ab9:	fc                   	cld
+  800aba:	eb 1a                	jmp    800ad6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800abc:	89 f2                	mov    %esi,%edx
+  800abe:	09 c2                	or     %eax,%edx
+  800ac0:	09 ca                	or     %ecx,%edx
+  800ac2:	f6 c2 03             	test   $0x3,%dl
+  800ac5:	75 0a                	jne    800ad1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ac7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800aca:	89 c7                	mov    %eax,%edi
+  800acc:	fc                   	cld
+  800acd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800acf:	eb 05                	jmp    800ad6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ad1:	89 c7                	mov    %eax,%edi
+  800ad3:	fc                   	cld
+  800ad4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ad6:	5e                   	pop    %esi
+  800ad7:	5f                   	pop    %edi
+  800ad8:	5d                   	pop    %ebp
+  800ad9:	c3                   	ret
+
+00800ada <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ada:	55                   	push   %ebp
+  800adb:	89 e5                	mov    %esp,%ebp
+  800add:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ae0:	ff 75 10             	push   0x10(%ebp)
+  800ae3:	ff 75 0c             	push   0xc(%ebp)
+  800ae6:	ff 75 08             	push   0x8(%ebp)
+  800ae9:	e8 8a ff ff ff       	call   800a78 <memmove>
+}
+  800aee:	c9                   	leave
+  800aef:	c3                   	ret
+
+00800af0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800af0:	55                   	push   %ebp
+  800af1:	89 e5                	mov    %esp,%ebp
+  800af3:	56                   	push   %esi
+  800af4:	53                   	push   %ebx
+  800af5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800afb:	89 c6                	mov    %eax,%esi
+  800afd:	03 75 10             	add    0x10(%ebp),%esi
+  800b00:	eb 06                	jmp    800b08 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b02:	83 c0 01             	add    $0x1,%eax
+  800b05:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b08:	39 f0                	cmp    %esi,%eax
+  800b0a:	74 14                	je     800b20 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b0c:	0f b6 08             	movzbl (%eax),%ecx
+  800b0f:	0f b6 1a             	movzbl (%edx),%ebx
+  800b12:	38 d9                	cmp    %bl,%cl
+  800b14:	74 ec                	je     800b02 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b16:	0f b6 c1             	movzbl %cl,%eax
+  800b19:	0f b6 db             	movzbl %bl,%ebx
+  800b1c:	29 d8                	sub    %ebx,%eax
+  800b1e:	eb 05                	jmp    800b25 <memcmp+0x35>
+	}
+
+	return 0;
+  800b20:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b25:	5b                   	pop    %ebx
+  800b26:	5e                   	pop    %esi
+  800b27:	5d                   	pop    %ebp
+  800b28:	c3                   	ret
+
+00800b29 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b29:	55                   	push   %ebp
+  800b2a:	89 e5                	mov    %esp,%ebp
+  800b2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b32:	89 c2                	mov    %eax,%edx
+  800b34:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b37:	eb 03                	jmp    800b3c <memfind+0x13>
+  800b39:	83 c0 01             	add    $0x1,%eax
+  800b3c:	39 d0                	cmp    %edx,%eax
+  800b3e:	73 04                	jae    800b44 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b40:	38 08                	cmp    %cl,(%eax)
+  800b42:	75 f5                	jne    800b39 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b44:	5d                   	pop    %ebp
+  800b45:	c3                   	ret
+
+00800b46 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b46:	55                   	push   %ebp
+  800b47:	89 e5                	mov    %esp,%ebp
+  800b49:	57                   	push   %edi
+  800b4a:	56                   	push   %esi
+  800b4b:	53                   	push   %ebx
+  800b4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b4f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b52:	eb 03                	jmp    800b57 <strtol+0x11>
+		s++;
+  800b54:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b57:	0f b6 02             	movzbl (%edx),%eax
+  800b5a:	3c 20                	cmp    $0x20,%al
+  800b5c:	74 f6                	je     800b54 <strtol+0xe>
+  800b5e:	3c 09                	cmp    $0x9,%al
+  800b60:	74 f2                	je     800b54 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b62:	3c 2b                	cmp    $0x2b,%al
+  800b64:	74 2a                	je     800b90 <strtol+0x4a>
+	int neg = 0;
+  800b66:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b6b:	3c 2d                	cmp    $0x2d,%al
+  800b6d:	74 2b                	je     800b9a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b6f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b75:	75 0f                	jne    800b86 <strtol+0x40>
+  800b77:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b7a:	74 28                	je     800ba4 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b7c:	85 db                	test   %ebx,%ebx
+  800b7e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b83:	0f 44 d8             	cmove  %eax,%ebx
+  800b86:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b8b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b8e:	eb 46                	jmp    800bd6 <strtol+0x90>
+		s++;
+  800b90:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b93:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b98:	eb d5                	jmp    800b6f <strtol+0x29>
+		s++, neg = 1;
+  800b9a:	83 c2 01             	add    $0x1,%edx
+  800b9d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ba2:	eb cb                	jmp    800b6f <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ba4:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ba8:	74 0e                	je     800bb8 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800baa:	85 db                	test   %ebx,%ebx
+  800bac:	75 d8                	jne    800b86 <strtol+0x40>
+		s++, base = 8;
+  800bae:	83 c2 01             	add    $0x1,%edx
+  800bb1:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bb6:	eb ce                	jmp    800b86 <strtol+0x40>
+		s += 2, base = 16;
+  800bb8:	83 c2 02             	add    $0x2,%edx
+  800bbb:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bc0:	eb c4                	jmp    800b86 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bc2:	0f be c0             	movsbl %al,%eax
+  800bc5:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bc8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bcb:	7d 3a                	jge    800c07 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bcd:	83 c2 01             	add    $0x1,%edx
+  800bd0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bd4:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bd6:	0f b6 02             	movzbl (%edx),%eax
+  800bd9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bdc:	89 f3                	mov    %esi,%ebx
+  800bde:	80 fb 09             	cmp    $0x9,%bl
+  800be1:	76 df                	jbe    800bc2 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800be3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800be6:	89 f3                	mov    %esi,%ebx
+  800be8:	80 fb 19             	cmp    $0x19,%bl
+  800beb:	77 08                	ja     800bf5 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bed:	0f be c0             	movsbl %al,%eax
+  800bf0:	83 e8 57             	sub    $0x57,%eax
+  800bf3:	eb d3                	jmp    800bc8 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bf5:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bf8:	89 f3                	mov    %esi,%ebx
+  800bfa:	80 fb 19             	cmp    $0x19,%bl
+  800bfd:	77 08                	ja     800c07 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bff:	0f be c0             	movsbl %al,%eax
+  800c02:	83 e8 37             	sub    $0x37,%eax
+  800c05:	eb c1                	jmp    800bc8 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c07:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c0b:	74 05                	je     800c12 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c0d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c10:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c12:	89 c8                	mov    %ecx,%eax
+  800c14:	f7 d8                	neg    %eax
+  800c16:	85 ff                	test   %edi,%edi
+  800c18:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c1b:	89 c8                	mov    %ecx,%eax
+  800c1d:	5b                   	pop    %ebx
+  800c1e:	5e                   	pop    %esi
+  800c1f:	5f                   	pop    %edi
+  800c20:	5d                   	pop    %ebp
+  800c21:	c3                   	ret
+
+00800c22 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800c22:	55                   	push   %ebp
+  800c23:	89 e5                	mov    %esp,%ebp
+  800c25:	57                   	push   %edi
+  800c26:	56                   	push   %esi
+  800c27:	53                   	push   %ebx
+  800c28:	83 ec 0c             	sub    $0xc,%esp
+  800c2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800c2e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c31:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800c34:	85 ff                	test   %edi,%edi
+  800c36:	74 16                	je     800c4e <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800c38:	83 ec 04             	sub    $0x4,%esp
+  800c3b:	56                   	push   %esi
+  800c3c:	6a 00                	push   $0x0
+  800c3e:	53                   	push   %ebx
+  800c3f:	e8 02 ff ff ff       	call   800b46 <strtol>
+  800c44:	89 07                	mov    %eax,(%edi)
+  800c46:	83 c4 10             	add    $0x10,%esp
+  800c49:	eb 03                	jmp    800c4e <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800c4b:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800c4e:	0f b6 03             	movzbl (%ebx),%eax
+  800c51:	3c 20                	cmp    $0x20,%al
+  800c53:	74 f6                	je     800c4b <strisl+0x29>
+  800c55:	3c 09                	cmp    $0x9,%al
+  800c57:	74 f2                	je     800c4b <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c59:	3c 2b                	cmp    $0x2b,%al
+  800c5b:	74 23                	je     800c80 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800c5d:	3c 2d                	cmp    $0x2d,%al
+  800c5f:	0f 94 c0             	sete   %al
+  800c62:	0f b6 c0             	movzbl %al,%eax
+  800c65:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c67:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800c6d:	75 41                	jne    800cb0 <strisl+0x8e>
+  800c6f:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800c72:	74 11                	je     800c85 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c74:	85 f6                	test   %esi,%esi
+  800c76:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c7b:	0f 44 f0             	cmove  %eax,%esi
+  800c7e:	eb 30                	jmp    800cb0 <strisl+0x8e>
+		s++;
+  800c80:	83 c3 01             	add    $0x1,%ebx
+  800c83:	eb e2                	jmp    800c67 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c85:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800c89:	74 0e                	je     800c99 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800c8b:	85 f6                	test   %esi,%esi
+  800c8d:	75 21                	jne    800cb0 <strisl+0x8e>
+		s++, base = 8;
+  800c8f:	83 c3 01             	add    $0x1,%ebx
+  800c92:	be 08 00 00 00       	mov    $0x8,%esi
+  800c97:	eb 17                	jmp    800cb0 <strisl+0x8e>
+		s += 2, base = 16;
+  800c99:	83 c3 02             	add    $0x2,%ebx
+  800c9c:	be 10 00 00 00       	mov    $0x10,%esi
+  800ca1:	eb 0d                	jmp    800cb0 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ca3:	0f be c0             	movsbl %al,%eax
+  800ca6:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800ca9:	39 f0                	cmp    %esi,%eax
+  800cab:	7d 38                	jge    800ce5 <strisl+0xc3>
+			return 0;
+		s++;
+  800cad:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800cb0:	0f b6 03             	movzbl (%ebx),%eax
+  800cb3:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800cb6:	80 fa 09             	cmp    $0x9,%dl
+  800cb9:	76 e8                	jbe    800ca3 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800cbb:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800cbe:	80 fa 19             	cmp    $0x19,%dl
+  800cc1:	77 08                	ja     800ccb <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800cc3:	0f be c0             	movsbl %al,%eax
+  800cc6:	83 e8 57             	sub    $0x57,%eax
+  800cc9:	eb de                	jmp    800ca9 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ccb:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800cce:	80 fa 19             	cmp    $0x19,%dl
+  800cd1:	77 08                	ja     800cdb <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800cd3:	0f be c0             	movsbl %al,%eax
+  800cd6:	83 e8 37             	sub    $0x37,%eax
+  800cd9:	eb ce                	jmp    800ca9 <strisl+0x87>
+		else if (!*s)
+  800cdb:	84 c0                	test   %al,%al
+  800cdd:	0f 94 c0             	sete   %al
+  800ce0:	0f b6 c0             	movzbl %al,%eax
+  800ce3:	eb 05                	jmp    800cea <strisl+0xc8>
+			return 0;
+  800ce5:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800cea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ced:	5b                   	pop    %ebx
+  800cee:	5e                   	pop    %esi
+  800cef:	5f                   	pop    %edi
+  800cf0:	5d                   	pop    %ebp
+  800cf1:	c3                   	ret
+
+00800cf2 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800cf2:	55                   	push   %ebp
+  800cf3:	89 e5                	mov    %esp,%ebp
+  800cf5:	83 ec 10             	sub    $0x10,%esp
+  800cf8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800cfb:	89 c8                	mov    %ecx,%eax
+  800cfd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800d02:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800d05:	eb 0b                	jmp    800d12 <touch_mem+0x20>
+		c = *(char *)page;
+  800d07:	0f b6 10             	movzbl (%eax),%edx
+  800d0a:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800d0d:	05 00 10 00 00       	add    $0x1000,%eax
+  800d12:	39 c8                	cmp    %ecx,%eax
+  800d14:	72 f1                	jb     800d07 <touch_mem+0x15>
+}
+  800d16:	c9                   	leave
+  800d17:	c3                   	ret
+
+00800d18 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d18:	55                   	push   %ebp
+  800d19:	89 e5                	mov    %esp,%ebp
+  800d1b:	57                   	push   %edi
+  800d1c:	56                   	push   %esi
+  800d1d:	53                   	push   %ebx
+	touch_mem(s, len);
+  800d1e:	ff 75 0c             	push   0xc(%ebp)
+  800d21:	ff 75 08             	push   0x8(%ebp)
+  800d24:	e8 c9 ff ff ff       	call   800cf2 <touch_mem>
+	asm volatile("int %1\n"
+  800d29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d34:	89 c3                	mov    %eax,%ebx
+  800d36:	89 c7                	mov    %eax,%edi
+  800d38:	89 c6                	mov    %eax,%esi
+  800d3a:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d3c:	83 c4 08             	add    $0x8,%esp
+  800d3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d42:	5b                   	pop    %ebx
+  800d43:	5e                   	pop    %esi
+  800d44:	5f                   	pop    %edi
+  800d45:	5d                   	pop    %ebp
+  800d46:	c3                   	ret
+
+00800d47 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d47:	55                   	push   %ebp
+  800d48:	89 e5                	mov    %esp,%ebp
+  800d4a:	57                   	push   %edi
+  800d4b:	56                   	push   %esi
+  800d4c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d52:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d57:	89 d1                	mov    %edx,%ecx
+  800d59:	89 d3                	mov    %edx,%ebx
+  800d5b:	89 d7                	mov    %edx,%edi
+  800d5d:	89 d6                	mov    %edx,%esi
+  800d5f:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d61:	5b                   	pop    %ebx
+  800d62:	5e                   	pop    %esi
+  800d63:	5f                   	pop    %edi
+  800d64:	5d                   	pop    %ebp
+  800d65:	c3                   	ret
+
+00800d66 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d66:	55                   	push   %ebp
+  800d67:	89 e5                	mov    %esp,%ebp
+  800d69:	57                   	push   %edi
+  800d6a:	56                   	push   %esi
+  800d6b:	53                   	push   %ebx
+  800d6c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d77:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d7c:	89 cb                	mov    %ecx,%ebx
+  800d7e:	89 cf                	mov    %ecx,%edi
+  800d80:	89 ce                	mov    %ecx,%esi
+  800d82:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d84:	85 c0                	test   %eax,%eax
+  800d86:	7f 08                	jg     800d90 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8b:	5b                   	pop    %ebx
+  800d8c:	5e                   	pop    %esi
+  800d8d:	5f                   	pop    %edi
+  800d8e:	5d                   	pop    %ebp
+  800d8f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d90:	83 ec 0c             	sub    $0xc,%esp
+  800d93:	50                   	push   %eax
+  800d94:	6a 03                	push   $0x3
+  800d96:	68 0b 52 80 00       	push   $0x80520b
+  800d9b:	6a 23                	push   $0x23
+  800d9d:	68 28 52 80 00       	push   $0x805228
+  800da2:	e8 89 f4 ff ff       	call   800230 <_panic>
+
+00800da7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800da7:	55                   	push   %ebp
+  800da8:	89 e5                	mov    %esp,%ebp
+  800daa:	57                   	push   %edi
+  800dab:	56                   	push   %esi
+  800dac:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dad:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db2:	b8 02 00 00 00       	mov    $0x2,%eax
+  800db7:	89 d1                	mov    %edx,%ecx
+  800db9:	89 d3                	mov    %edx,%ebx
+  800dbb:	89 d7                	mov    %edx,%edi
+  800dbd:	89 d6                	mov    %edx,%esi
+  800dbf:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dc1:	5b                   	pop    %ebx
+  800dc2:	5e                   	pop    %esi
+  800dc3:	5f                   	pop    %edi
+  800dc4:	5d                   	pop    %ebp
+  800dc5:	c3                   	ret
+
+00800dc6 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dc6:	55                   	push   %ebp
+  800dc7:	89 e5                	mov    %esp,%ebp
+  800dc9:	57                   	push   %edi
+  800dca:	56                   	push   %esi
+  800dcb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dcc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dd6:	89 d1                	mov    %edx,%ecx
+  800dd8:	89 d3                	mov    %edx,%ebx
+  800dda:	89 d7                	mov    %edx,%edi
+  800ddc:	89 d6                	mov    %edx,%esi
+  800dde:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800de0:	5b                   	pop    %ebx
+  800de1:	5e                   	pop    %esi
+  800de2:	5f                   	pop    %edi
+  800de3:	5d                   	pop    %ebp
+  800de4:	c3                   	ret
+
+00800de5 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+  800de8:	57                   	push   %edi
+  800de9:	56                   	push   %esi
+  800dea:	53                   	push   %ebx
+  800deb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dee:	be 00 00 00 00       	mov    $0x0,%esi
+  800df3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df9:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dfe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e01:	89 f7                	mov    %esi,%edi
+  800e03:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e05:	85 c0                	test   %eax,%eax
+  800e07:	7f 08                	jg     800e11 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0c:	5b                   	pop    %ebx
+  800e0d:	5e                   	pop    %esi
+  800e0e:	5f                   	pop    %edi
+  800e0f:	5d                   	pop    %ebp
+  800e10:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e11:	83 ec 0c             	sub    $0xc,%esp
+  800e14:	50                   	push   %eax
+  800e15:	6a 04                	push   $0x4
+  800e17:	68 0b 52 80 00       	push   $0x80520b
+  800e1c:	6a 23                	push   $0x23
+  800e1e:	68 28 52 80 00       	push   $0x805228
+  800e23:	e8 08 f4 ff ff       	call   800230 <_panic>
+
+00800e28 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e28:	55                   	push   %ebp
+  800e29:	89 e5                	mov    %esp,%ebp
+  800e2b:	57                   	push   %edi
+  800e2c:	56                   	push   %esi
+  800e2d:	53                   	push   %ebx
+  800e2e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e37:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e3c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e3f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e42:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e45:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e47:	85 c0                	test   %eax,%eax
+  800e49:	7f 08                	jg     800e53 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4e:	5b                   	pop    %ebx
+  800e4f:	5e                   	pop    %esi
+  800e50:	5f                   	pop    %edi
+  800e51:	5d                   	pop    %ebp
+  800e52:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e53:	83 ec 0c             	sub    $0xc,%esp
+  800e56:	50                   	push   %eax
+  800e57:	6a 05                	push   $0x5
+  800e59:	68 0b 52 80 00       	push   $0x80520b
+  800e5e:	6a 23                	push   $0x23
+  800e60:	68 28 52 80 00       	push   $0x805228
+  800e65:	e8 c6 f3 ff ff       	call   800230 <_panic>
+
+00800e6a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	57                   	push   %edi
+  800e6e:	56                   	push   %esi
+  800e6f:	53                   	push   %ebx
+  800e70:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e83:	89 df                	mov    %ebx,%edi
+  800e85:	89 de                	mov    %ebx,%esi
+  800e87:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e89:	85 c0                	test   %eax,%eax
+  800e8b:	7f 08                	jg     800e95 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e90:	5b                   	pop    %ebx
+  800e91:	5e                   	pop    %esi
+  800e92:	5f                   	pop    %edi
+  800e93:	5d                   	pop    %ebp
+  800e94:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e95:	83 ec 0c             	sub    $0xc,%esp
+  800e98:	50                   	push   %eax
+  800e99:	6a 06                	push   $0x6
+  800e9b:	68 0b 52 80 00       	push   $0x80520b
+  800ea0:	6a 23                	push   $0x23
+  800ea2:	68 28 52 80 00       	push   $0x805228
+  800ea7:	e8 84 f3 ff ff       	call   800230 <_panic>
+
+00800eac <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800eac:	55                   	push   %ebp
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	57                   	push   %edi
+  800eb0:	56                   	push   %esi
+  800eb1:	53                   	push   %ebx
+  800eb2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec0:	b8 18 00 00 00       	mov    $0x18,%eax
+  800ec5:	89 df                	mov    %ebx,%edi
+  800ec7:	89 de                	mov    %ebx,%esi
+  800ec9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ecb:	85 c0                	test   %eax,%eax
+  800ecd:	7f 08                	jg     800ed7 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ecf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed2:	5b                   	pop    %ebx
+  800ed3:	5e                   	pop    %esi
+  800ed4:	5f                   	pop    %edi
+  800ed5:	5d                   	pop    %ebp
+  800ed6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed7:	83 ec 0c             	sub    $0xc,%esp
+  800eda:	50                   	push   %eax
+  800edb:	6a 18                	push   $0x18
+  800edd:	68 0b 52 80 00       	push   $0x80520b
+  800ee2:	6a 23                	push   $0x23
+  800ee4:	68 28 52 80 00       	push   $0x805228
+  800ee9:	e8 42 f3 ff ff       	call   800230 <_panic>
+
+00800eee <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800eee:	55                   	push   %ebp
+  800eef:	89 e5                	mov    %esp,%ebp
+  800ef1:	57                   	push   %edi
+  800ef2:	56                   	push   %esi
+  800ef3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ef4:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eff:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f07:	89 f7                	mov    %esi,%edi
+  800f09:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800f0b:	5b                   	pop    %ebx
+  800f0c:	5e                   	pop    %esi
+  800f0d:	5f                   	pop    %edi
+  800f0e:	5d                   	pop    %ebp
+  800f0f:	c3                   	ret
+
+00800f10 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800f10:	55                   	push   %ebp
+  800f11:	89 e5                	mov    %esp,%ebp
+  800f13:	57                   	push   %edi
+  800f14:	56                   	push   %esi
+  800f15:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f21:	be 00 00 00 00       	mov    $0x0,%esi
+  800f26:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f29:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f2c:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800f2e:	5b                   	pop    %ebx
+  800f2f:	5e                   	pop    %esi
+  800f30:	5f                   	pop    %edi
+  800f31:	5d                   	pop    %ebp
+  800f32:	c3                   	ret
+
+00800f33 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800f33:	55                   	push   %ebp
+  800f34:	89 e5                	mov    %esp,%ebp
+  800f36:	57                   	push   %edi
+  800f37:	56                   	push   %esi
+  800f38:	53                   	push   %ebx
+  800f39:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800f3c:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800f3f:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800f45:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800f48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f56:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f59:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f5b:	85 c0                	test   %eax,%eax
+  800f5d:	7f 08                	jg     800f67 <sys_page_map_range+0x34>
+}
+  800f5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f62:	5b                   	pop    %ebx
+  800f63:	5e                   	pop    %esi
+  800f64:	5f                   	pop    %edi
+  800f65:	5d                   	pop    %ebp
+  800f66:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f67:	83 ec 0c             	sub    $0xc,%esp
+  800f6a:	50                   	push   %eax
+  800f6b:	6a 10                	push   $0x10
+  800f6d:	68 0b 52 80 00       	push   $0x80520b
+  800f72:	6a 23                	push   $0x23
+  800f74:	68 28 52 80 00       	push   $0x805228
+  800f79:	e8 b2 f2 ff ff       	call   800230 <_panic>
+
+00800f7e <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f7e:	55                   	push   %ebp
+  800f7f:	89 e5                	mov    %esp,%ebp
+  800f81:	57                   	push   %edi
+  800f82:	56                   	push   %esi
+  800f83:	53                   	push   %ebx
+  800f84:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f87:	be 00 00 00 00       	mov    $0x0,%esi
+  800f8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f92:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f97:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f9a:	89 f7                	mov    %esi,%edi
+  800f9c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f9e:	85 c0                	test   %eax,%eax
+  800fa0:	7f 08                	jg     800faa <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800fa2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa5:	5b                   	pop    %ebx
+  800fa6:	5e                   	pop    %esi
+  800fa7:	5f                   	pop    %edi
+  800fa8:	5d                   	pop    %ebp
+  800fa9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800faa:	83 ec 0c             	sub    $0xc,%esp
+  800fad:	50                   	push   %eax
+  800fae:	6a 11                	push   $0x11
+  800fb0:	68 0b 52 80 00       	push   $0x80520b
+  800fb5:	6a 23                	push   $0x23
+  800fb7:	68 28 52 80 00       	push   $0x805228
+  800fbc:	e8 6f f2 ff ff       	call   800230 <_panic>
+
+00800fc1 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800fc1:	55                   	push   %ebp
+  800fc2:	89 e5                	mov    %esp,%ebp
+  800fc4:	57                   	push   %edi
+  800fc5:	56                   	push   %esi
+  800fc6:	53                   	push   %ebx
+  800fc7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fca:	be 00 00 00 00       	mov    $0x0,%esi
+  800fcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800fda:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fdd:	89 f7                	mov    %esi,%edi
+  800fdf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fe1:	85 c0                	test   %eax,%eax
+  800fe3:	7f 08                	jg     800fed <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800fe5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe8:	5b                   	pop    %ebx
+  800fe9:	5e                   	pop    %esi
+  800fea:	5f                   	pop    %edi
+  800feb:	5d                   	pop    %ebp
+  800fec:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fed:	83 ec 0c             	sub    $0xc,%esp
+  800ff0:	50                   	push   %eax
+  800ff1:	6a 1b                	push   $0x1b
+  800ff3:	68 0b 52 80 00       	push   $0x80520b
+  800ff8:	6a 23                	push   $0x23
+  800ffa:	68 28 52 80 00       	push   $0x805228
+  800fff:	e8 2c f2 ff ff       	call   800230 <_panic>
+
+00801004 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  801004:	55                   	push   %ebp
+  801005:	89 e5                	mov    %esp,%ebp
+  801007:	57                   	push   %edi
+  801008:	56                   	push   %esi
+  801009:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80100a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801014:	89 d1                	mov    %edx,%ecx
+  801016:	89 d3                	mov    %edx,%ebx
+  801018:	89 d7                	mov    %edx,%edi
+  80101a:	89 d6                	mov    %edx,%esi
+  80101c:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80101e:	5b                   	pop    %ebx
+  80101f:	5e                   	pop    %esi
+  801020:	5f                   	pop    %edi
+  801021:	5d                   	pop    %ebp
+  801022:	c3                   	ret
+
+00801023 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801023:	55                   	push   %ebp
+  801024:	89 e5                	mov    %esp,%ebp
+  801026:	57                   	push   %edi
+  801027:	56                   	push   %esi
+  801028:	53                   	push   %ebx
+  801029:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80102c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801031:	8b 55 08             	mov    0x8(%ebp),%edx
+  801034:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801037:	b8 08 00 00 00       	mov    $0x8,%eax
+  80103c:	89 df                	mov    %ebx,%edi
+  80103e:	89 de                	mov    %ebx,%esi
+  801040:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801042:	85 c0                	test   %eax,%eax
+  801044:	7f 08                	jg     80104e <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801046:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801049:	5b                   	pop    %ebx
+  80104a:	5e                   	pop    %esi
+  80104b:	5f                   	pop    %edi
+  80104c:	5d                   	pop    %ebp
+  80104d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80104e:	83 ec 0c             	sub    $0xc,%esp
+  801051:	50                   	push   %eax
+  801052:	6a 08                	push   $0x8
+  801054:	68 0b 52 80 00       	push   $0x80520b
+  801059:	6a 23                	push   $0x23
+  80105b:	68 28 52 80 00       	push   $0x805228
+  801060:	e8 cb f1 ff ff       	call   800230 <_panic>
+
+00801065 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801065:	55                   	push   %ebp
+  801066:	89 e5                	mov    %esp,%ebp
+  801068:	57                   	push   %edi
+  801069:	56                   	push   %esi
+  80106a:	53                   	push   %ebx
+  80106b:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  80106e:	6a 44                	push   $0x44
+  801070:	ff 75 0c             	push   0xc(%ebp)
+  801073:	e8 7a fc ff ff       	call   800cf2 <touch_mem>
+	asm volatile("int %1\n"
+  801078:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801080:	b8 09 00 00 00       	mov    $0x9,%eax
+  801085:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801088:	89 df                	mov    %ebx,%edi
+  80108a:	89 de                	mov    %ebx,%esi
+  80108c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80108e:	83 c4 08             	add    $0x8,%esp
+  801091:	85 c0                	test   %eax,%eax
+  801093:	7f 08                	jg     80109d <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801095:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801098:	5b                   	pop    %ebx
+  801099:	5e                   	pop    %esi
+  80109a:	5f                   	pop    %edi
+  80109b:	5d                   	pop    %ebp
+  80109c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109d:	83 ec 0c             	sub    $0xc,%esp
+  8010a0:	50                   	push   %eax
+  8010a1:	6a 09                	push   $0x9
+  8010a3:	68 0b 52 80 00       	push   $0x80520b
+  8010a8:	6a 23                	push   $0x23
+  8010aa:	68 28 52 80 00       	push   $0x805228
+  8010af:	e8 7c f1 ff ff       	call   800230 <_panic>
+
+008010b4 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  8010b4:	55                   	push   %ebp
+  8010b5:	89 e5                	mov    %esp,%ebp
+  8010b7:	57                   	push   %edi
+  8010b8:	56                   	push   %esi
+  8010b9:	53                   	push   %ebx
+  8010ba:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8010cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d0:	89 f7                	mov    %esi,%edi
+  8010d2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010d4:	85 c0                	test   %eax,%eax
+  8010d6:	7f 08                	jg     8010e0 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  8010d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010db:	5b                   	pop    %ebx
+  8010dc:	5e                   	pop    %esi
+  8010dd:	5f                   	pop    %edi
+  8010de:	5d                   	pop    %ebp
+  8010df:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e0:	83 ec 0c             	sub    $0xc,%esp
+  8010e3:	50                   	push   %eax
+  8010e4:	6a 1a                	push   $0x1a
+  8010e6:	68 0b 52 80 00       	push   $0x80520b
+  8010eb:	6a 23                	push   $0x23
+  8010ed:	68 28 52 80 00       	push   $0x805228
+  8010f2:	e8 39 f1 ff ff       	call   800230 <_panic>
+
+008010f7 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8010f7:	55                   	push   %ebp
+  8010f8:	89 e5                	mov    %esp,%ebp
+  8010fa:	57                   	push   %edi
+  8010fb:	56                   	push   %esi
+  8010fc:	53                   	push   %ebx
+  8010fd:	83 ec 0c             	sub    $0xc,%esp
+  801100:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801103:	89 d8                	mov    %ebx,%eax
+  801105:	c1 e0 05             	shl    $0x5,%eax
+  801108:	50                   	push   %eax
+  801109:	ff 75 0c             	push   0xc(%ebp)
+  80110c:	e8 e1 fb ff ff       	call   800cf2 <touch_mem>
+	asm volatile("int %1\n"
+  801111:	be 00 00 00 00       	mov    $0x0,%esi
+  801116:	8b 55 08             	mov    0x8(%ebp),%edx
+  801119:	b8 13 00 00 00       	mov    $0x13,%eax
+  80111e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801121:	89 f7                	mov    %esi,%edi
+  801123:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801125:	83 c4 08             	add    $0x8,%esp
+  801128:	85 c0                	test   %eax,%eax
+  80112a:	7f 08                	jg     801134 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  80112c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112f:	5b                   	pop    %ebx
+  801130:	5e                   	pop    %esi
+  801131:	5f                   	pop    %edi
+  801132:	5d                   	pop    %ebp
+  801133:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801134:	83 ec 0c             	sub    $0xc,%esp
+  801137:	50                   	push   %eax
+  801138:	6a 13                	push   $0x13
+  80113a:	68 0b 52 80 00       	push   $0x80520b
+  80113f:	6a 23                	push   $0x23
+  801141:	68 28 52 80 00       	push   $0x805228
+  801146:	e8 e5 f0 ff ff       	call   800230 <_panic>
+
+0080114b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80114b:	55                   	push   %ebp
+  80114c:	89 e5                	mov    %esp,%ebp
+  80114e:	57                   	push   %edi
+  80114f:	56                   	push   %esi
+  801150:	53                   	push   %ebx
+  801151:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801154:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801159:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801164:	89 df                	mov    %ebx,%edi
+  801166:	89 de                	mov    %ebx,%esi
+  801168:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80116a:	85 c0                	test   %eax,%eax
+  80116c:	7f 08                	jg     801176 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80116e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801171:	5b                   	pop    %ebx
+  801172:	5e                   	pop    %esi
+  801173:	5f                   	pop    %edi
+  801174:	5d                   	pop    %ebp
+  801175:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801176:	83 ec 0c             	sub    $0xc,%esp
+  801179:	50                   	push   %eax
+  80117a:	6a 0a                	push   $0xa
+  80117c:	68 0b 52 80 00       	push   $0x80520b
+  801181:	6a 23                	push   $0x23
+  801183:	68 28 52 80 00       	push   $0x805228
+  801188:	e8 a3 f0 ff ff       	call   800230 <_panic>
+
+0080118d <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80118d:	55                   	push   %ebp
+  80118e:	89 e5                	mov    %esp,%ebp
+  801190:	57                   	push   %edi
+  801191:	56                   	push   %esi
+  801192:	53                   	push   %ebx
+  801193:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801196:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80119c:	76 1d                	jbe    8011bb <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80119e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8011ae:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011b1:	cd 30                	int    $0x30
+}
+  8011b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b6:	5b                   	pop    %ebx
+  8011b7:	5e                   	pop    %esi
+  8011b8:	5f                   	pop    %edi
+  8011b9:	5d                   	pop    %ebp
+  8011ba:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011bb:	68 00 10 00 00       	push   $0x1000
+  8011c0:	53                   	push   %ebx
+  8011c1:	e8 2c fb ff ff       	call   800cf2 <touch_mem>
+  8011c6:	83 c4 08             	add    $0x8,%esp
+  8011c9:	eb d3                	jmp    80119e <sys_ipc_send+0x11>
+
+008011cb <sys_ipc_send_pages>:
+{
+  8011cb:	55                   	push   %ebp
+  8011cc:	89 e5                	mov    %esp,%ebp
+  8011ce:	57                   	push   %edi
+  8011cf:	56                   	push   %esi
+  8011d0:	53                   	push   %ebx
+  8011d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d4:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8011d7:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011dd:	76 18                	jbe    8011f7 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8011df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011ea:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8011ed:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8011ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f2:	5b                   	pop    %ebx
+  8011f3:	5e                   	pop    %esi
+  8011f4:	5f                   	pop    %edi
+  8011f5:	5d                   	pop    %ebp
+  8011f6:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011f7:	89 f0                	mov    %esi,%eax
+  8011f9:	c1 e0 0c             	shl    $0xc,%eax
+  8011fc:	50                   	push   %eax
+  8011fd:	53                   	push   %ebx
+  8011fe:	e8 ef fa ff ff       	call   800cf2 <touch_mem>
+  801203:	83 c4 08             	add    $0x8,%esp
+  801206:	eb d7                	jmp    8011df <sys_ipc_send_pages+0x14>
+
+00801208 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801208:	55                   	push   %ebp
+  801209:	89 e5                	mov    %esp,%ebp
+  80120b:	57                   	push   %edi
+  80120c:	56                   	push   %esi
+  80120d:	53                   	push   %ebx
+  80120e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801211:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801216:	8b 55 08             	mov    0x8(%ebp),%edx
+  801219:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801221:	89 df                	mov    %ebx,%edi
+  801223:	89 de                	mov    %ebx,%esi
+  801225:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801227:	85 c0                	test   %eax,%eax
+  801229:	7f 08                	jg     801233 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  80122b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80122e:	5b                   	pop    %ebx
+  80122f:	5e                   	pop    %esi
+  801230:	5f                   	pop    %edi
+  801231:	5d                   	pop    %ebp
+  801232:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801233:	83 ec 0c             	sub    $0xc,%esp
+  801236:	50                   	push   %eax
+  801237:	6a 0d                	push   $0xd
+  801239:	68 0b 52 80 00       	push   $0x80520b
+  80123e:	6a 23                	push   $0x23
+  801240:	68 28 52 80 00       	push   $0x805228
+  801245:	e8 e6 ef ff ff       	call   800230 <_panic>
+
+0080124a <sys_ipc_recv>:
+{
+  80124a:	55                   	push   %ebp
+  80124b:	89 e5                	mov    %esp,%ebp
+  80124d:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801250:	6a 01                	push   $0x1
+  801252:	ff 75 08             	push   0x8(%ebp)
+  801255:	e8 ae ff ff ff       	call   801208 <sys_ipc_recv_pages>
+}
+  80125a:	c9                   	leave
+  80125b:	c3                   	ret
+
+0080125c <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80125c:	55                   	push   %ebp
+  80125d:	89 e5                	mov    %esp,%ebp
+  80125f:	57                   	push   %edi
+  801260:	56                   	push   %esi
+  801261:	53                   	push   %ebx
+  801262:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801265:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801268:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  80126b:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801271:	77 04                	ja     801277 <sys_ipc_call+0x1b>
+  801273:	85 f6                	test   %esi,%esi
+  801275:	75 15                	jne    80128c <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801277:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801282:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801284:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801287:	5b                   	pop    %ebx
+  801288:	5e                   	pop    %esi
+  801289:	5f                   	pop    %edi
+  80128a:	5d                   	pop    %ebp
+  80128b:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80128c:	89 f8                	mov    %edi,%eax
+  80128e:	c1 e0 0c             	shl    $0xc,%eax
+  801291:	50                   	push   %eax
+  801292:	53                   	push   %ebx
+  801293:	e8 5a fa ff ff       	call   800cf2 <touch_mem>
+  801298:	83 c4 08             	add    $0x8,%esp
+  80129b:	eb da                	jmp    801277 <sys_ipc_call+0x1b>
+
+0080129d <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80129d:	55                   	push   %ebp
+  80129e:	89 e5                	mov    %esp,%ebp
+  8012a0:	57                   	push   %edi
+  8012a1:	56                   	push   %esi
+  8012a2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a9:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012b1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012b4:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012b7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8012b9:	5b                   	pop    %ebx
+  8012ba:	5e                   	pop    %esi
+  8012bb:	5f                   	pop    %edi
+  8012bc:	5d                   	pop    %ebp
+  8012bd:	c3                   	ret
+
+008012be <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8012be:	55                   	push   %ebp
+  8012bf:	89 e5                	mov    %esp,%ebp
+  8012c1:	57                   	push   %edi
+  8012c2:	56                   	push   %esi
+  8012c3:	53                   	push   %ebx
+  8012c4:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8012c7:	6a 04                	push   $0x4
+  8012c9:	ff 75 08             	push   0x8(%ebp)
+  8012cc:	e8 21 fa ff ff       	call   800cf2 <touch_mem>
+	asm volatile("int %1\n"
+  8012d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d9:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012e4:	89 f7                	mov    %esi,%edi
+  8012e6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012e8:	83 c4 08             	add    $0x8,%esp
+  8012eb:	85 c0                	test   %eax,%eax
+  8012ed:	7f 08                	jg     8012f7 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8012ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f2:	5b                   	pop    %ebx
+  8012f3:	5e                   	pop    %esi
+  8012f4:	5f                   	pop    %edi
+  8012f5:	5d                   	pop    %ebp
+  8012f6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012f7:	83 ec 0c             	sub    $0xc,%esp
+  8012fa:	50                   	push   %eax
+  8012fb:	6a 16                	push   $0x16
+  8012fd:	68 0b 52 80 00       	push   $0x80520b
+  801302:	6a 23                	push   $0x23
+  801304:	68 28 52 80 00       	push   $0x805228
+  801309:	e8 22 ef ff ff       	call   800230 <_panic>
+
+0080130e <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80130e:	55                   	push   %ebp
+  80130f:	89 e5                	mov    %esp,%ebp
+  801311:	57                   	push   %edi
+  801312:	56                   	push   %esi
+  801313:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801314:	6a 04                	push   $0x4
+  801316:	ff 75 08             	push   0x8(%ebp)
+  801319:	e8 d4 f9 ff ff       	call   800cf2 <touch_mem>
+	asm volatile("int %1\n"
+  80131e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801323:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801326:	b8 17 00 00 00       	mov    $0x17,%eax
+  80132b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132e:	89 df                	mov    %ebx,%edi
+  801330:	89 de                	mov    %ebx,%esi
+  801332:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801334:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801337:	5b                   	pop    %ebx
+  801338:	5e                   	pop    %esi
+  801339:	5f                   	pop    %edi
+  80133a:	5d                   	pop    %ebp
+  80133b:	c3                   	ret
+
+0080133c <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80133c:	55                   	push   %ebp
+  80133d:	89 e5                	mov    %esp,%ebp
+  80133f:	57                   	push   %edi
+  801340:	56                   	push   %esi
+  801341:	53                   	push   %ebx
+  801342:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801345:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801352:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801357:	89 df                	mov    %ebx,%edi
+  801359:	89 de                	mov    %ebx,%esi
+  80135b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80135d:	85 c0                	test   %eax,%eax
+  80135f:	7f 08                	jg     801369 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801361:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801364:	5b                   	pop    %ebx
+  801365:	5e                   	pop    %esi
+  801366:	5f                   	pop    %edi
+  801367:	5d                   	pop    %ebp
+  801368:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801369:	83 ec 0c             	sub    $0xc,%esp
+  80136c:	50                   	push   %eax
+  80136d:	6a 0e                	push   $0xe
+  80136f:	68 0b 52 80 00       	push   $0x80520b
+  801374:	6a 23                	push   $0x23
+  801376:	68 28 52 80 00       	push   $0x805228
+  80137b:	e8 b0 ee ff ff       	call   800230 <_panic>
+
+00801380 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801380:	55                   	push   %ebp
+  801381:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801383:	8b 45 08             	mov    0x8(%ebp),%eax
+  801386:	05 00 00 00 30       	add    $0x30000000,%eax
+  80138b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80138e:	5d                   	pop    %ebp
+  80138f:	c3                   	ret
+
+00801390 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801390:	55                   	push   %ebp
+  801391:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801393:	8b 45 08             	mov    0x8(%ebp),%eax
+  801396:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80139b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8013a0:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013a5:	5d                   	pop    %ebp
+  8013a6:	c3                   	ret
+
+008013a7 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013a7:	55                   	push   %ebp
+  8013a8:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8013aa:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8013af:	a8 01                	test   $0x1,%al
+  8013b1:	74 3c                	je     8013ef <fd_alloc+0x48>
+  8013b3:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013b8:	89 c2                	mov    %eax,%edx
+  8013ba:	c1 ea 0c             	shr    $0xc,%edx
+  8013bd:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013c4:	89 c1                	mov    %eax,%ecx
+  8013c6:	05 00 10 00 00       	add    $0x1000,%eax
+  8013cb:	f6 c2 01             	test   $0x1,%dl
+  8013ce:	74 13                	je     8013e3 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8013d0:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8013d5:	75 e1                	jne    8013b8 <fd_alloc+0x11>
+  8013d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8013dc:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8013e1:	eb 05                	jmp    8013e8 <fd_alloc+0x41>
+			return 0;
+  8013e3:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8013e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013eb:	89 0a                	mov    %ecx,(%edx)
+}
+  8013ed:	5d                   	pop    %ebp
+  8013ee:	c3                   	ret
+  8013ef:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8013f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f9:	eb ed                	jmp    8013e8 <fd_alloc+0x41>
+
+008013fb <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013fb:	55                   	push   %ebp
+  8013fc:	89 e5                	mov    %esp,%ebp
+  8013fe:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801401:	83 f8 1f             	cmp    $0x1f,%eax
+  801404:	77 30                	ja     801436 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801406:	c1 e0 0c             	shl    $0xc,%eax
+  801409:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80140e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801414:	f6 c2 01             	test   $0x1,%dl
+  801417:	74 24                	je     80143d <fd_lookup+0x42>
+  801419:	89 c2                	mov    %eax,%edx
+  80141b:	c1 ea 0c             	shr    $0xc,%edx
+  80141e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801425:	f6 c2 01             	test   $0x1,%dl
+  801428:	74 1a                	je     801444 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80142a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80142d:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80142f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801434:	5d                   	pop    %ebp
+  801435:	c3                   	ret
+		return -E_INVAL;
+  801436:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80143b:	eb f7                	jmp    801434 <fd_lookup+0x39>
+		return -E_INVAL;
+  80143d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801442:	eb f0                	jmp    801434 <fd_lookup+0x39>
+  801444:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801449:	eb e9                	jmp    801434 <fd_lookup+0x39>
+
+0080144b <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80144b:	55                   	push   %ebp
+  80144c:	89 e5                	mov    %esp,%ebp
+  80144e:	53                   	push   %ebx
+  80144f:	83 ec 04             	sub    $0x4,%esp
+  801452:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801455:	b8 b4 52 80 00       	mov    $0x8052b4,%eax
+  80145a:	8b 18                	mov    (%eax),%ebx
+  80145c:	85 db                	test   %ebx,%ebx
+  80145e:	74 0e                	je     80146e <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801460:	83 c0 04             	add    $0x4,%eax
+  801463:	39 13                	cmp    %edx,(%ebx)
+  801465:	75 f3                	jne    80145a <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801467:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146c:	eb 1f                	jmp    80148d <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80146e:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801473:	8b 40 48             	mov    0x48(%eax),%eax
+  801476:	83 ec 04             	sub    $0x4,%esp
+  801479:	52                   	push   %edx
+  80147a:	50                   	push   %eax
+  80147b:	68 38 52 80 00       	push   $0x805238
+  801480:	e8 86 ee ff ff       	call   80030b <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801485:	83 c4 10             	add    $0x10,%esp
+  801488:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80148d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801490:	89 1a                	mov    %ebx,(%edx)
+}
+  801492:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801495:	c9                   	leave
+  801496:	c3                   	ret
+
+00801497 <fd_close>:
+{
+  801497:	55                   	push   %ebp
+  801498:	89 e5                	mov    %esp,%ebp
+  80149a:	57                   	push   %edi
+  80149b:	56                   	push   %esi
+  80149c:	53                   	push   %ebx
+  80149d:	83 ec 24             	sub    $0x24,%esp
+  8014a0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014a3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014a6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014a9:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014aa:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014b0:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014b3:	50                   	push   %eax
+  8014b4:	e8 42 ff ff ff       	call   8013fb <fd_lookup>
+  8014b9:	89 c3                	mov    %eax,%ebx
+  8014bb:	83 c4 10             	add    $0x10,%esp
+  8014be:	85 c0                	test   %eax,%eax
+  8014c0:	78 05                	js     8014c7 <fd_close+0x30>
+	    || fd != fd2)
+  8014c2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8014c5:	74 16                	je     8014dd <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8014c7:	89 f8                	mov    %edi,%eax
+  8014c9:	84 c0                	test   %al,%al
+  8014cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014d3:	89 d8                	mov    %ebx,%eax
+  8014d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d8:	5b                   	pop    %ebx
+  8014d9:	5e                   	pop    %esi
+  8014da:	5f                   	pop    %edi
+  8014db:	5d                   	pop    %ebp
+  8014dc:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014dd:	83 ec 08             	sub    $0x8,%esp
+  8014e0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014e3:	50                   	push   %eax
+  8014e4:	ff 36                	push   (%esi)
+  8014e6:	e8 60 ff ff ff       	call   80144b <dev_lookup>
+  8014eb:	89 c3                	mov    %eax,%ebx
+  8014ed:	83 c4 10             	add    $0x10,%esp
+  8014f0:	85 c0                	test   %eax,%eax
+  8014f2:	78 1a                	js     80150e <fd_close+0x77>
+		if (dev->dev_close)
+  8014f4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014f7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8014fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8014ff:	85 c0                	test   %eax,%eax
+  801501:	74 0b                	je     80150e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801503:	83 ec 0c             	sub    $0xc,%esp
+  801506:	56                   	push   %esi
+  801507:	ff d0                	call   *%eax
+  801509:	89 c3                	mov    %eax,%ebx
+  80150b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80150e:	83 ec 08             	sub    $0x8,%esp
+  801511:	56                   	push   %esi
+  801512:	6a 00                	push   $0x0
+  801514:	e8 51 f9 ff ff       	call   800e6a <sys_page_unmap>
+	return r;
+  801519:	83 c4 10             	add    $0x10,%esp
+  80151c:	eb b5                	jmp    8014d3 <fd_close+0x3c>
+
+0080151e <close>:
+
+int
+close(int fdnum)
+{
+  80151e:	55                   	push   %ebp
+  80151f:	89 e5                	mov    %esp,%ebp
+  801521:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801524:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801527:	50                   	push   %eax
+  801528:	ff 75 08             	push   0x8(%ebp)
+  80152b:	e8 cb fe ff ff       	call   8013fb <fd_lookup>
+  801530:	83 c4 10             	add    $0x10,%esp
+  801533:	85 c0                	test   %eax,%eax
+  801535:	79 02                	jns    801539 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801537:	c9                   	leave
+  801538:	c3                   	ret
+		return fd_close(fd, 1);
+  801539:	83 ec 08             	sub    $0x8,%esp
+  80153c:	6a 01                	push   $0x1
+  80153e:	ff 75 f4             	push   -0xc(%ebp)
+  801541:	e8 51 ff ff ff       	call   801497 <fd_close>
+  801546:	83 c4 10             	add    $0x10,%esp
+  801549:	eb ec                	jmp    801537 <close+0x19>
+
+0080154b <close_all>:
+
+void
+close_all(void)
+{
+  80154b:	55                   	push   %ebp
+  80154c:	89 e5                	mov    %esp,%ebp
+  80154e:	53                   	push   %ebx
+  80154f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801552:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801557:	83 ec 0c             	sub    $0xc,%esp
+  80155a:	53                   	push   %ebx
+  80155b:	e8 be ff ff ff       	call   80151e <close>
+	for (i = 0; i < MAXFD; i++)
+  801560:	83 c3 01             	add    $0x1,%ebx
+  801563:	83 c4 10             	add    $0x10,%esp
+  801566:	83 fb 20             	cmp    $0x20,%ebx
+  801569:	75 ec                	jne    801557 <close_all+0xc>
+}
+  80156b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80156e:	c9                   	leave
+  80156f:	c3                   	ret
+
+00801570 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801570:	55                   	push   %ebp
+  801571:	89 e5                	mov    %esp,%ebp
+  801573:	57                   	push   %edi
+  801574:	56                   	push   %esi
+  801575:	53                   	push   %ebx
+  801576:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801579:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80157c:	50                   	push   %eax
+  80157d:	ff 75 08             	push   0x8(%ebp)
+  801580:	e8 76 fe ff ff       	call   8013fb <fd_lookup>
+  801585:	89 c3                	mov    %eax,%ebx
+  801587:	83 c4 10             	add    $0x10,%esp
+  80158a:	85 c0                	test   %eax,%eax
+  80158c:	78 7f                	js     80160d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80158e:	83 ec 0c             	sub    $0xc,%esp
+  801591:	ff 75 0c             	push   0xc(%ebp)
+  801594:	e8 85 ff ff ff       	call   80151e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801599:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80159c:	c1 e6 0c             	shl    $0xc,%esi
+  80159f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8015a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015a8:	89 3c 24             	mov    %edi,(%esp)
+  8015ab:	e8 e0 fd ff ff       	call   801390 <fd2data>
+  8015b0:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8015b2:	89 34 24             	mov    %esi,(%esp)
+  8015b5:	e8 d6 fd ff ff       	call   801390 <fd2data>
+  8015ba:	83 c4 10             	add    $0x10,%esp
+  8015bd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8015c0:	89 d8                	mov    %ebx,%eax
+  8015c2:	c1 e8 16             	shr    $0x16,%eax
+  8015c5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015cc:	a8 01                	test   $0x1,%al
+  8015ce:	74 11                	je     8015e1 <dup+0x71>
+  8015d0:	89 d8                	mov    %ebx,%eax
+  8015d2:	c1 e8 0c             	shr    $0xc,%eax
+  8015d5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015dc:	f6 c2 01             	test   $0x1,%dl
+  8015df:	75 36                	jne    801617 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015e1:	89 f8                	mov    %edi,%eax
+  8015e3:	c1 e8 0c             	shr    $0xc,%eax
+  8015e6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015ed:	83 ec 0c             	sub    $0xc,%esp
+  8015f0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015f5:	50                   	push   %eax
+  8015f6:	56                   	push   %esi
+  8015f7:	6a 00                	push   $0x0
+  8015f9:	57                   	push   %edi
+  8015fa:	6a 00                	push   $0x0
+  8015fc:	e8 27 f8 ff ff       	call   800e28 <sys_page_map>
+  801601:	89 c3                	mov    %eax,%ebx
+  801603:	83 c4 20             	add    $0x20,%esp
+  801606:	85 c0                	test   %eax,%eax
+  801608:	78 33                	js     80163d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80160a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80160d:	89 d8                	mov    %ebx,%eax
+  80160f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801612:	5b                   	pop    %ebx
+  801613:	5e                   	pop    %esi
+  801614:	5f                   	pop    %edi
+  801615:	5d                   	pop    %ebp
+  801616:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801617:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80161e:	83 ec 0c             	sub    $0xc,%esp
+  801621:	25 07 0e 00 00       	and    $0xe07,%eax
+  801626:	50                   	push   %eax
+  801627:	ff 75 d4             	push   -0x2c(%ebp)
+  80162a:	6a 00                	push   $0x0
+  80162c:	53                   	push   %ebx
+  80162d:	6a 00                	push   $0x0
+  80162f:	e8 f4 f7 ff ff       	call   800e28 <sys_page_map>
+  801634:	89 c3                	mov    %eax,%ebx
+  801636:	83 c4 20             	add    $0x20,%esp
+  801639:	85 c0                	test   %eax,%eax
+  80163b:	79 a4                	jns    8015e1 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80163d:	83 ec 08             	sub    $0x8,%esp
+  801640:	56                   	push   %esi
+  801641:	6a 00                	push   $0x0
+  801643:	e8 22 f8 ff ff       	call   800e6a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801648:	83 c4 08             	add    $0x8,%esp
+  80164b:	ff 75 d4             	push   -0x2c(%ebp)
+  80164e:	6a 00                	push   $0x0
+  801650:	e8 15 f8 ff ff       	call   800e6a <sys_page_unmap>
+	return r;
+  801655:	83 c4 10             	add    $0x10,%esp
+  801658:	eb b3                	jmp    80160d <dup+0x9d>
+
+0080165a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80165a:	55                   	push   %ebp
+  80165b:	89 e5                	mov    %esp,%ebp
+  80165d:	56                   	push   %esi
+  80165e:	53                   	push   %ebx
+  80165f:	83 ec 18             	sub    $0x18,%esp
+  801662:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801665:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801668:	50                   	push   %eax
+  801669:	56                   	push   %esi
+  80166a:	e8 8c fd ff ff       	call   8013fb <fd_lookup>
+  80166f:	83 c4 10             	add    $0x10,%esp
+  801672:	85 c0                	test   %eax,%eax
+  801674:	78 3c                	js     8016b2 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801676:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801679:	83 ec 08             	sub    $0x8,%esp
+  80167c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80167f:	50                   	push   %eax
+  801680:	ff 33                	push   (%ebx)
+  801682:	e8 c4 fd ff ff       	call   80144b <dev_lookup>
+  801687:	83 c4 10             	add    $0x10,%esp
+  80168a:	85 c0                	test   %eax,%eax
+  80168c:	78 24                	js     8016b2 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80168e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801691:	83 e0 03             	and    $0x3,%eax
+  801694:	83 f8 01             	cmp    $0x1,%eax
+  801697:	74 20                	je     8016b9 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801699:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80169c:	8b 40 08             	mov    0x8(%eax),%eax
+  80169f:	85 c0                	test   %eax,%eax
+  8016a1:	74 37                	je     8016da <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8016a3:	83 ec 04             	sub    $0x4,%esp
+  8016a6:	ff 75 10             	push   0x10(%ebp)
+  8016a9:	ff 75 0c             	push   0xc(%ebp)
+  8016ac:	53                   	push   %ebx
+  8016ad:	ff d0                	call   *%eax
+  8016af:	83 c4 10             	add    $0x10,%esp
+}
+  8016b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016b5:	5b                   	pop    %ebx
+  8016b6:	5e                   	pop    %esi
+  8016b7:	5d                   	pop    %ebp
+  8016b8:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016b9:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8016be:	8b 40 48             	mov    0x48(%eax),%eax
+  8016c1:	83 ec 04             	sub    $0x4,%esp
+  8016c4:	56                   	push   %esi
+  8016c5:	50                   	push   %eax
+  8016c6:	68 79 52 80 00       	push   $0x805279
+  8016cb:	e8 3b ec ff ff       	call   80030b <cprintf>
+		return -E_INVAL;
+  8016d0:	83 c4 10             	add    $0x10,%esp
+  8016d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016d8:	eb d8                	jmp    8016b2 <read+0x58>
+		return -E_NOT_SUPP;
+  8016da:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016df:	eb d1                	jmp    8016b2 <read+0x58>
+
+008016e1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016e1:	55                   	push   %ebp
+  8016e2:	89 e5                	mov    %esp,%ebp
+  8016e4:	57                   	push   %edi
+  8016e5:	56                   	push   %esi
+  8016e6:	53                   	push   %ebx
+  8016e7:	83 ec 0c             	sub    $0xc,%esp
+  8016ea:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016ed:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f5:	eb 02                	jmp    8016f9 <readn+0x18>
+  8016f7:	01 c3                	add    %eax,%ebx
+  8016f9:	39 f3                	cmp    %esi,%ebx
+  8016fb:	73 21                	jae    80171e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016fd:	83 ec 04             	sub    $0x4,%esp
+  801700:	89 f0                	mov    %esi,%eax
+  801702:	29 d8                	sub    %ebx,%eax
+  801704:	50                   	push   %eax
+  801705:	89 d8                	mov    %ebx,%eax
+  801707:	03 45 0c             	add    0xc(%ebp),%eax
+  80170a:	50                   	push   %eax
+  80170b:	57                   	push   %edi
+  80170c:	e8 49 ff ff ff       	call   80165a <read>
+		if (m < 0)
+  801711:	83 c4 10             	add    $0x10,%esp
+  801714:	85 c0                	test   %eax,%eax
+  801716:	78 04                	js     80171c <readn+0x3b>
+			return m;
+		if (m == 0)
+  801718:	75 dd                	jne    8016f7 <readn+0x16>
+  80171a:	eb 02                	jmp    80171e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80171c:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80171e:	89 d8                	mov    %ebx,%eax
+  801720:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801723:	5b                   	pop    %ebx
+  801724:	5e                   	pop    %esi
+  801725:	5f                   	pop    %edi
+  801726:	5d                   	pop    %ebp
+  801727:	c3                   	ret
+
+00801728 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801728:	55                   	push   %ebp
+  801729:	89 e5                	mov    %esp,%ebp
+  80172b:	56                   	push   %esi
+  80172c:	53                   	push   %ebx
+  80172d:	83 ec 18             	sub    $0x18,%esp
+  801730:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801733:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801736:	50                   	push   %eax
+  801737:	53                   	push   %ebx
+  801738:	e8 be fc ff ff       	call   8013fb <fd_lookup>
+  80173d:	83 c4 10             	add    $0x10,%esp
+  801740:	85 c0                	test   %eax,%eax
+  801742:	78 37                	js     80177b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801744:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801747:	83 ec 08             	sub    $0x8,%esp
+  80174a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80174d:	50                   	push   %eax
+  80174e:	ff 36                	push   (%esi)
+  801750:	e8 f6 fc ff ff       	call   80144b <dev_lookup>
+  801755:	83 c4 10             	add    $0x10,%esp
+  801758:	85 c0                	test   %eax,%eax
+  80175a:	78 1f                	js     80177b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80175c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801760:	74 20                	je     801782 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801762:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801765:	8b 40 0c             	mov    0xc(%eax),%eax
+  801768:	85 c0                	test   %eax,%eax
+  80176a:	74 37                	je     8017a3 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80176c:	83 ec 04             	sub    $0x4,%esp
+  80176f:	ff 75 10             	push   0x10(%ebp)
+  801772:	ff 75 0c             	push   0xc(%ebp)
+  801775:	56                   	push   %esi
+  801776:	ff d0                	call   *%eax
+  801778:	83 c4 10             	add    $0x10,%esp
+}
+  80177b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80177e:	5b                   	pop    %ebx
+  80177f:	5e                   	pop    %esi
+  801780:	5d                   	pop    %ebp
+  801781:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801782:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801787:	8b 40 48             	mov    0x48(%eax),%eax
+  80178a:	83 ec 04             	sub    $0x4,%esp
+  80178d:	53                   	push   %ebx
+  80178e:	50                   	push   %eax
+  80178f:	68 95 52 80 00       	push   $0x805295
+  801794:	e8 72 eb ff ff       	call   80030b <cprintf>
+		return -E_INVAL;
+  801799:	83 c4 10             	add    $0x10,%esp
+  80179c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a1:	eb d8                	jmp    80177b <write+0x53>
+		return -E_NOT_SUPP;
+  8017a3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017a8:	eb d1                	jmp    80177b <write+0x53>
+
+008017aa <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017aa:	55                   	push   %ebp
+  8017ab:	89 e5                	mov    %esp,%ebp
+  8017ad:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b3:	50                   	push   %eax
+  8017b4:	ff 75 08             	push   0x8(%ebp)
+  8017b7:	e8 3f fc ff ff       	call   8013fb <fd_lookup>
+  8017bc:	83 c4 10             	add    $0x10,%esp
+  8017bf:	85 c0                	test   %eax,%eax
+  8017c1:	78 0e                	js     8017d1 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8017c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017c9:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8017cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017d1:	c9                   	leave
+  8017d2:	c3                   	ret
+
+008017d3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017d3:	55                   	push   %ebp
+  8017d4:	89 e5                	mov    %esp,%ebp
+  8017d6:	56                   	push   %esi
+  8017d7:	53                   	push   %ebx
+  8017d8:	83 ec 18             	sub    $0x18,%esp
+  8017db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017de:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017e1:	50                   	push   %eax
+  8017e2:	53                   	push   %ebx
+  8017e3:	e8 13 fc ff ff       	call   8013fb <fd_lookup>
+  8017e8:	83 c4 10             	add    $0x10,%esp
+  8017eb:	85 c0                	test   %eax,%eax
+  8017ed:	78 34                	js     801823 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017ef:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017f2:	83 ec 08             	sub    $0x8,%esp
+  8017f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017f8:	50                   	push   %eax
+  8017f9:	ff 36                	push   (%esi)
+  8017fb:	e8 4b fc ff ff       	call   80144b <dev_lookup>
+  801800:	83 c4 10             	add    $0x10,%esp
+  801803:	85 c0                	test   %eax,%eax
+  801805:	78 1c                	js     801823 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801807:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80180b:	74 1d                	je     80182a <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80180d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801810:	8b 40 18             	mov    0x18(%eax),%eax
+  801813:	85 c0                	test   %eax,%eax
+  801815:	74 34                	je     80184b <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801817:	83 ec 08             	sub    $0x8,%esp
+  80181a:	ff 75 0c             	push   0xc(%ebp)
+  80181d:	56                   	push   %esi
+  80181e:	ff d0                	call   *%eax
+  801820:	83 c4 10             	add    $0x10,%esp
+}
+  801823:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801826:	5b                   	pop    %ebx
+  801827:	5e                   	pop    %esi
+  801828:	5d                   	pop    %ebp
+  801829:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80182a:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80182f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801832:	83 ec 04             	sub    $0x4,%esp
+  801835:	53                   	push   %ebx
+  801836:	50                   	push   %eax
+  801837:	68 58 52 80 00       	push   $0x805258
+  80183c:	e8 ca ea ff ff       	call   80030b <cprintf>
+		return -E_INVAL;
+  801841:	83 c4 10             	add    $0x10,%esp
+  801844:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801849:	eb d8                	jmp    801823 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80184b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801850:	eb d1                	jmp    801823 <ftruncate+0x50>
+
+00801852 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801852:	55                   	push   %ebp
+  801853:	89 e5                	mov    %esp,%ebp
+  801855:	56                   	push   %esi
+  801856:	53                   	push   %ebx
+  801857:	83 ec 18             	sub    $0x18,%esp
+  80185a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80185d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801860:	50                   	push   %eax
+  801861:	ff 75 08             	push   0x8(%ebp)
+  801864:	e8 92 fb ff ff       	call   8013fb <fd_lookup>
+  801869:	83 c4 10             	add    $0x10,%esp
+  80186c:	85 c0                	test   %eax,%eax
+  80186e:	78 49                	js     8018b9 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801870:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801873:	83 ec 08             	sub    $0x8,%esp
+  801876:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801879:	50                   	push   %eax
+  80187a:	ff 36                	push   (%esi)
+  80187c:	e8 ca fb ff ff       	call   80144b <dev_lookup>
+  801881:	83 c4 10             	add    $0x10,%esp
+  801884:	85 c0                	test   %eax,%eax
+  801886:	78 31                	js     8018b9 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801888:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80188b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80188f:	74 2f                	je     8018c0 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801891:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801894:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80189b:	00 00 00 
+	stat->st_isdir = 0;
+  80189e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018a5:	00 00 00 
+	stat->st_dev = dev;
+  8018a8:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8018ae:	83 ec 08             	sub    $0x8,%esp
+  8018b1:	53                   	push   %ebx
+  8018b2:	56                   	push   %esi
+  8018b3:	ff 50 14             	call   *0x14(%eax)
+  8018b6:	83 c4 10             	add    $0x10,%esp
+}
+  8018b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018bc:	5b                   	pop    %ebx
+  8018bd:	5e                   	pop    %esi
+  8018be:	5d                   	pop    %ebp
+  8018bf:	c3                   	ret
+		return -E_NOT_SUPP;
+  8018c0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018c5:	eb f2                	jmp    8018b9 <fstat+0x67>
+
+008018c7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018c7:	55                   	push   %ebp
+  8018c8:	89 e5                	mov    %esp,%ebp
+  8018ca:	56                   	push   %esi
+  8018cb:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8018cc:	83 ec 08             	sub    $0x8,%esp
+  8018cf:	6a 00                	push   $0x0
+  8018d1:	ff 75 08             	push   0x8(%ebp)
+  8018d4:	e8 bc 02 00 00       	call   801b95 <open>
+  8018d9:	89 c3                	mov    %eax,%ebx
+  8018db:	83 c4 10             	add    $0x10,%esp
+  8018de:	85 c0                	test   %eax,%eax
+  8018e0:	78 1b                	js     8018fd <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8018e2:	83 ec 08             	sub    $0x8,%esp
+  8018e5:	ff 75 0c             	push   0xc(%ebp)
+  8018e8:	50                   	push   %eax
+  8018e9:	e8 64 ff ff ff       	call   801852 <fstat>
+  8018ee:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8018f0:	89 1c 24             	mov    %ebx,(%esp)
+  8018f3:	e8 26 fc ff ff       	call   80151e <close>
+	return r;
+  8018f8:	83 c4 10             	add    $0x10,%esp
+  8018fb:	89 f3                	mov    %esi,%ebx
+}
+  8018fd:	89 d8                	mov    %ebx,%eax
+  8018ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801902:	5b                   	pop    %ebx
+  801903:	5e                   	pop    %esi
+  801904:	5d                   	pop    %ebp
+  801905:	c3                   	ret
+
+00801906 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801906:	55                   	push   %ebp
+  801907:	89 e5                	mov    %esp,%ebp
+  801909:	57                   	push   %edi
+  80190a:	56                   	push   %esi
+  80190b:	53                   	push   %ebx
+  80190c:	83 ec 0c             	sub    $0xc,%esp
+  80190f:	89 c7                	mov    %eax,%edi
+  801911:	89 d3                	mov    %edx,%ebx
+  801913:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801915:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80191c:	74 2d                	je     80194b <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80191e:	6a 07                	push   $0x7
+  801920:	68 00 f0 80 00       	push   $0x80f000
+  801925:	57                   	push   %edi
+  801926:	ff 35 00 70 80 00    	push   0x807000
+  80192c:	e8 4e 31 00 00       	call   804a7f <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801931:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801938:	6a 00                	push   $0x0
+  80193a:	56                   	push   %esi
+  80193b:	53                   	push   %ebx
+  80193c:	6a 00                	push   $0x0
+  80193e:	e8 ee 2f 00 00       	call   804931 <ipc_recv_pages>
+}
+  801943:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801946:	5b                   	pop    %ebx
+  801947:	5e                   	pop    %esi
+  801948:	5f                   	pop    %edi
+  801949:	5d                   	pop    %ebp
+  80194a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80194b:	83 ec 0c             	sub    $0xc,%esp
+  80194e:	6a 01                	push   $0x1
+  801950:	e8 1f 32 00 00       	call   804b74 <ipc_find_env>
+  801955:	a3 00 70 80 00       	mov    %eax,0x807000
+  80195a:	83 c4 10             	add    $0x10,%esp
+  80195d:	eb bf                	jmp    80191e <fsipc_pages+0x18>
+
+0080195f <fsipc>:
+{
+  80195f:	55                   	push   %ebp
+  801960:	89 e5                	mov    %esp,%ebp
+  801962:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801965:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80196a:	e8 97 ff ff ff       	call   801906 <fsipc_pages>
+}
+  80196f:	c9                   	leave
+  801970:	c3                   	ret
+
+00801971 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801971:	55                   	push   %ebp
+  801972:	89 e5                	mov    %esp,%ebp
+  801974:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801977:	8b 45 08             	mov    0x8(%ebp),%eax
+  80197a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80197d:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  801982:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801985:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80198a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80198f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801994:	e8 c6 ff ff ff       	call   80195f <fsipc>
+}
+  801999:	c9                   	leave
+  80199a:	c3                   	ret
+
+0080199b <devfile_flush>:
+{
+  80199b:	55                   	push   %ebp
+  80199c:	89 e5                	mov    %esp,%ebp
+  80199e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019a7:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8019ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b1:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019b6:	e8 a4 ff ff ff       	call   80195f <fsipc>
+}
+  8019bb:	c9                   	leave
+  8019bc:	c3                   	ret
+
+008019bd <devfile_stat>:
+{
+  8019bd:	55                   	push   %ebp
+  8019be:	89 e5                	mov    %esp,%ebp
+  8019c0:	53                   	push   %ebx
+  8019c1:	83 ec 04             	sub    $0x4,%esp
+  8019c4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ca:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019cd:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019d7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019dc:	e8 7e ff ff ff       	call   80195f <fsipc>
+  8019e1:	85 c0                	test   %eax,%eax
+  8019e3:	78 2c                	js     801a11 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019e5:	83 ec 08             	sub    $0x8,%esp
+  8019e8:	68 00 f0 80 00       	push   $0x80f000
+  8019ed:	53                   	push   %ebx
+  8019ee:	e8 ff ee ff ff       	call   8008f2 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8019f3:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  8019f8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019fe:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  801a03:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801a09:	83 c4 10             	add    $0x10,%esp
+  801a0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a14:	c9                   	leave
+  801a15:	c3                   	ret
+
+00801a16 <devfile_write>:
+{
+  801a16:	55                   	push   %ebp
+  801a17:	89 e5                	mov    %esp,%ebp
+  801a19:	83 ec 0c             	sub    $0xc,%esp
+  801a1c:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801a1f:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a24:	39 d0                	cmp    %edx,%eax
+  801a26:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a29:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a2c:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a2f:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  801a35:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801a3a:	50                   	push   %eax
+  801a3b:	ff 75 0c             	push   0xc(%ebp)
+  801a3e:	68 08 f0 80 00       	push   $0x80f008
+  801a43:	e8 30 f0 ff ff       	call   800a78 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801a48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a4d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a52:	e8 08 ff ff ff       	call   80195f <fsipc>
+}
+  801a57:	c9                   	leave
+  801a58:	c3                   	ret
+
+00801a59 <devfile_read>:
+{
+  801a59:	55                   	push   %ebp
+  801a5a:	89 e5                	mov    %esp,%ebp
+  801a5c:	57                   	push   %edi
+  801a5d:	56                   	push   %esi
+  801a5e:	53                   	push   %ebx
+  801a5f:	83 ec 1c             	sub    $0x1c,%esp
+  801a62:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a65:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a68:	89 fe                	mov    %edi,%esi
+  801a6a:	c1 ee 0c             	shr    $0xc,%esi
+  801a6d:	b8 20 00 00 00       	mov    $0x20,%eax
+  801a72:	39 c6                	cmp    %eax,%esi
+  801a74:	0f 47 f0             	cmova  %eax,%esi
+  801a77:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a7f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801a82:	eb 14                	jmp    801a98 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a84:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801a8b:	05 00 10 00 00       	add    $0x1000,%eax
+  801a90:	f6 c6 06             	test   $0x6,%dh
+  801a93:	75 42                	jne    801ad7 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a95:	83 c1 01             	add    $0x1,%ecx
+  801a98:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801a9b:	39 f1                	cmp    %esi,%ecx
+  801a9d:	0f 84 95 00 00 00    	je     801b38 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801aa3:	89 c2                	mov    %eax,%edx
+  801aa5:	c1 ea 16             	shr    $0x16,%edx
+  801aa8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801aaf:	f6 c2 01             	test   $0x1,%dl
+  801ab2:	74 23                	je     801ad7 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801ab4:	89 c2                	mov    %eax,%edx
+  801ab6:	c1 ea 0c             	shr    $0xc,%edx
+  801ab9:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801ac0:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801ac6:	74 0f                	je     801ad7 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801ac8:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801acf:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801ad5:	75 ad                	jne    801a84 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801ad7:	85 c9                	test   %ecx,%ecx
+  801ad9:	74 11                	je     801aec <devfile_read+0x93>
+  801adb:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801ae2:	75 08                	jne    801aec <devfile_read+0x93>
+  801ae4:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801aea:	74 50                	je     801b3c <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801aec:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801aef:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  801af4:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801afa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aff:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b04:	e8 56 fe ff ff       	call   80195f <fsipc>
+  801b09:	89 c6                	mov    %eax,%esi
+  801b0b:	85 c0                	test   %eax,%eax
+  801b0d:	78 1f                	js     801b2e <devfile_read+0xd5>
+	assert(r <= n);
+  801b0f:	39 c7                	cmp    %eax,%edi
+  801b11:	72 50                	jb     801b63 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801b13:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b18:	7f 62                	jg     801b7c <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801b1a:	83 ec 04             	sub    $0x4,%esp
+  801b1d:	50                   	push   %eax
+  801b1e:	68 00 f0 80 00       	push   $0x80f000
+  801b23:	ff 75 0c             	push   0xc(%ebp)
+  801b26:	e8 4d ef ff ff       	call   800a78 <memmove>
+	return r;
+  801b2b:	83 c4 10             	add    $0x10,%esp
+}
+  801b2e:	89 f0                	mov    %esi,%eax
+  801b30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b33:	5b                   	pop    %ebx
+  801b34:	5e                   	pop    %esi
+  801b35:	5f                   	pop    %edi
+  801b36:	5d                   	pop    %ebp
+  801b37:	c3                   	ret
+  801b38:	89 f1                	mov    %esi,%ecx
+  801b3a:	eb 9b                	jmp    801ad7 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801b3c:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b3f:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801b44:	89 c8                	mov    %ecx,%eax
+  801b46:	c1 e0 0c             	shl    $0xc,%eax
+  801b49:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801b4e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b51:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801b56:	e8 ab fd ff ff       	call   801906 <fsipc_pages>
+  801b5b:	89 c6                	mov    %eax,%esi
+  801b5d:	85 c0                	test   %eax,%eax
+  801b5f:	78 8b                	js     801aec <devfile_read+0x93>
+  801b61:	eb cb                	jmp    801b2e <devfile_read+0xd5>
+	assert(r <= n);
+  801b63:	68 c4 52 80 00       	push   $0x8052c4
+  801b68:	68 cb 52 80 00       	push   $0x8052cb
+  801b6d:	68 a0 00 00 00       	push   $0xa0
+  801b72:	68 e0 52 80 00       	push   $0x8052e0
+  801b77:	e8 b4 e6 ff ff       	call   800230 <_panic>
+	assert(r <= PGSIZE);
+  801b7c:	68 eb 52 80 00       	push   $0x8052eb
+  801b81:	68 cb 52 80 00       	push   $0x8052cb
+  801b86:	68 a1 00 00 00       	push   $0xa1
+  801b8b:	68 e0 52 80 00       	push   $0x8052e0
+  801b90:	e8 9b e6 ff ff       	call   800230 <_panic>
+
+00801b95 <open>:
+{
+  801b95:	55                   	push   %ebp
+  801b96:	89 e5                	mov    %esp,%ebp
+  801b98:	56                   	push   %esi
+  801b99:	53                   	push   %ebx
+  801b9a:	83 ec 1c             	sub    $0x1c,%esp
+  801b9d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801ba0:	56                   	push   %esi
+  801ba1:	e8 11 ed ff ff       	call   8008b7 <strlen>
+  801ba6:	83 c4 10             	add    $0x10,%esp
+  801ba9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bae:	7f 6c                	jg     801c1c <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801bb0:	83 ec 0c             	sub    $0xc,%esp
+  801bb3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bb6:	50                   	push   %eax
+  801bb7:	e8 eb f7 ff ff       	call   8013a7 <fd_alloc>
+  801bbc:	89 c3                	mov    %eax,%ebx
+  801bbe:	83 c4 10             	add    $0x10,%esp
+  801bc1:	85 c0                	test   %eax,%eax
+  801bc3:	78 3c                	js     801c01 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801bc5:	83 ec 08             	sub    $0x8,%esp
+  801bc8:	56                   	push   %esi
+  801bc9:	68 00 f0 80 00       	push   $0x80f000
+  801bce:	e8 1f ed ff ff       	call   8008f2 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801bd3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bd6:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bdb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801bde:	b8 01 00 00 00       	mov    $0x1,%eax
+  801be3:	e8 77 fd ff ff       	call   80195f <fsipc>
+  801be8:	89 c3                	mov    %eax,%ebx
+  801bea:	83 c4 10             	add    $0x10,%esp
+  801bed:	85 c0                	test   %eax,%eax
+  801bef:	78 19                	js     801c0a <open+0x75>
+	return fd2num(fd);
+  801bf1:	83 ec 0c             	sub    $0xc,%esp
+  801bf4:	ff 75 f4             	push   -0xc(%ebp)
+  801bf7:	e8 84 f7 ff ff       	call   801380 <fd2num>
+  801bfc:	89 c3                	mov    %eax,%ebx
+  801bfe:	83 c4 10             	add    $0x10,%esp
+}
+  801c01:	89 d8                	mov    %ebx,%eax
+  801c03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c06:	5b                   	pop    %ebx
+  801c07:	5e                   	pop    %esi
+  801c08:	5d                   	pop    %ebp
+  801c09:	c3                   	ret
+		fd_close(fd, 0);
+  801c0a:	83 ec 08             	sub    $0x8,%esp
+  801c0d:	6a 00                	push   $0x0
+  801c0f:	ff 75 f4             	push   -0xc(%ebp)
+  801c12:	e8 80 f8 ff ff       	call   801497 <fd_close>
+		return r;
+  801c17:	83 c4 10             	add    $0x10,%esp
+  801c1a:	eb e5                	jmp    801c01 <open+0x6c>
+		return -E_BAD_PATH;
+  801c1c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c21:	eb de                	jmp    801c01 <open+0x6c>
+
+00801c23 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801c23:	55                   	push   %ebp
+  801c24:	89 e5                	mov    %esp,%ebp
+  801c26:	53                   	push   %ebx
+  801c27:	83 ec 10             	sub    $0x10,%esp
+  801c2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801c2d:	53                   	push   %ebx
+  801c2e:	e8 84 ec ff ff       	call   8008b7 <strlen>
+  801c33:	83 c4 10             	add    $0x10,%esp
+  801c36:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c3b:	7f 25                	jg     801c62 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801c3d:	83 ec 08             	sub    $0x8,%esp
+  801c40:	53                   	push   %ebx
+  801c41:	68 00 f0 80 00       	push   $0x80f000
+  801c46:	e8 a7 ec ff ff       	call   8008f2 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801c4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c50:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c55:	e8 05 fd ff ff       	call   80195f <fsipc>
+  801c5a:	83 c4 10             	add    $0x10,%esp
+}
+  801c5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c60:	c9                   	leave
+  801c61:	c3                   	ret
+		return -E_BAD_PATH;
+  801c62:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801c67:	eb f4                	jmp    801c5d <remove+0x3a>
+
+00801c69 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c69:	55                   	push   %ebp
+  801c6a:	89 e5                	mov    %esp,%ebp
+  801c6c:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c74:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c79:	e8 e1 fc ff ff       	call   80195f <fsipc>
+}
+  801c7e:	c9                   	leave
+  801c7f:	c3                   	ret
+
+00801c80 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801c80:	55                   	push   %ebp
+  801c81:	89 e5                	mov    %esp,%ebp
+  801c83:	53                   	push   %ebx
+  801c84:	83 ec 04             	sub    $0x4,%esp
+  801c87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801c8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c8f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c94:	e8 c6 fc ff ff       	call   80195f <fsipc>
+  801c99:	85 c0                	test   %eax,%eax
+  801c9b:	78 3c                	js     801cd9 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801c9d:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  801ca2:	89 03                	mov    %eax,(%ebx)
+  801ca4:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  801ca9:	89 43 04             	mov    %eax,0x4(%ebx)
+  801cac:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  801cb1:	89 43 08             	mov    %eax,0x8(%ebx)
+  801cb4:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  801cb9:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801cbc:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  801cc1:	89 43 10             	mov    %eax,0x10(%ebx)
+  801cc4:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  801cc9:	89 43 14             	mov    %eax,0x14(%ebx)
+  801ccc:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  801cd1:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801cd4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cd9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cdc:	c9                   	leave
+  801cdd:	c3                   	ret
+
+00801cde <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801cde:	55                   	push   %ebp
+  801cdf:	89 e5                	mov    %esp,%ebp
+  801ce1:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801ce4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce7:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  801cec:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cf1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801cf6:	e8 64 fc ff ff       	call   80195f <fsipc>
+}
+  801cfb:	c9                   	leave
+  801cfc:	c3                   	ret
+
+00801cfd <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801cfd:	55                   	push   %ebp
+  801cfe:	89 e5                	mov    %esp,%ebp
+  801d00:	56                   	push   %esi
+  801d01:	53                   	push   %ebx
+  801d02:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801d05:	83 ec 0c             	sub    $0xc,%esp
+  801d08:	ff 75 08             	push   0x8(%ebp)
+  801d0b:	e8 80 f6 ff ff       	call   801390 <fd2data>
+  801d10:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801d12:	83 c4 08             	add    $0x8,%esp
+  801d15:	68 f7 52 80 00       	push   $0x8052f7
+  801d1a:	53                   	push   %ebx
+  801d1b:	e8 d2 eb ff ff       	call   8008f2 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801d20:	8b 46 04             	mov    0x4(%esi),%eax
+  801d23:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801d29:	2b 0e                	sub    (%esi),%ecx
+  801d2b:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801d30:	89 c8                	mov    %ecx,%eax
+  801d32:	f7 e2                	mul    %edx
+  801d34:	c1 ea 0c             	shr    $0xc,%edx
+  801d37:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801d3d:	29 d1                	sub    %edx,%ecx
+  801d3f:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801d45:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d4c:	00 00 00 
+	stat->st_dev = &devpipe;
+  801d4f:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  801d56:	60 80 00 
+	return 0;
+}
+  801d59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d61:	5b                   	pop    %ebx
+  801d62:	5e                   	pop    %esi
+  801d63:	5d                   	pop    %ebp
+  801d64:	c3                   	ret
+
+00801d65 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801d65:	55                   	push   %ebp
+  801d66:	89 e5                	mov    %esp,%ebp
+  801d68:	53                   	push   %ebx
+  801d69:	83 ec 0c             	sub    $0xc,%esp
+  801d6c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801d6f:	53                   	push   %ebx
+  801d70:	6a 00                	push   $0x0
+  801d72:	e8 f3 f0 ff ff       	call   800e6a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801d77:	89 1c 24             	mov    %ebx,(%esp)
+  801d7a:	e8 11 f6 ff ff       	call   801390 <fd2data>
+  801d7f:	83 c4 08             	add    $0x8,%esp
+  801d82:	50                   	push   %eax
+  801d83:	6a 00                	push   $0x0
+  801d85:	e8 e0 f0 ff ff       	call   800e6a <sys_page_unmap>
+}
+  801d8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d8d:	c9                   	leave
+  801d8e:	c3                   	ret
+
+00801d8f <_pipeisclosed>:
+{
+  801d8f:	55                   	push   %ebp
+  801d90:	89 e5                	mov    %esp,%ebp
+  801d92:	57                   	push   %edi
+  801d93:	56                   	push   %esi
+  801d94:	53                   	push   %ebx
+  801d95:	83 ec 1c             	sub    $0x1c,%esp
+  801d98:	89 c7                	mov    %eax,%edi
+  801d9a:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801d9c:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801da1:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801da4:	83 ec 0c             	sub    $0xc,%esp
+  801da7:	57                   	push   %edi
+  801da8:	e8 06 2e 00 00       	call   804bb3 <pageref>
+  801dad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801db0:	89 34 24             	mov    %esi,(%esp)
+  801db3:	e8 fb 2d 00 00       	call   804bb3 <pageref>
+		nn = thisenv->env_runs;
+  801db8:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  801dbe:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801dc1:	83 c4 10             	add    $0x10,%esp
+  801dc4:	39 cb                	cmp    %ecx,%ebx
+  801dc6:	74 1b                	je     801de3 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801dc8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801dcb:	75 cf                	jne    801d9c <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801dcd:	8b 42 58             	mov    0x58(%edx),%eax
+  801dd0:	6a 01                	push   $0x1
+  801dd2:	50                   	push   %eax
+  801dd3:	53                   	push   %ebx
+  801dd4:	68 fe 52 80 00       	push   $0x8052fe
+  801dd9:	e8 2d e5 ff ff       	call   80030b <cprintf>
+  801dde:	83 c4 10             	add    $0x10,%esp
+  801de1:	eb b9                	jmp    801d9c <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801de3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801de6:	0f 94 c0             	sete   %al
+  801de9:	0f b6 c0             	movzbl %al,%eax
+}
+  801dec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801def:	5b                   	pop    %ebx
+  801df0:	5e                   	pop    %esi
+  801df1:	5f                   	pop    %edi
+  801df2:	5d                   	pop    %ebp
+  801df3:	c3                   	ret
+
+00801df4 <devpipe_read>:
+{
+  801df4:	55                   	push   %ebp
+  801df5:	89 e5                	mov    %esp,%ebp
+  801df7:	57                   	push   %edi
+  801df8:	56                   	push   %esi
+  801df9:	53                   	push   %ebx
+  801dfa:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801dfd:	ff 75 08             	push   0x8(%ebp)
+  801e00:	e8 8b f5 ff ff       	call   801390 <fd2data>
+  801e05:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801e07:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801e0a:	8d 40 04             	lea    0x4(%eax),%eax
+  801e0d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801e10:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801e13:	8b 0b                	mov    (%ebx),%ecx
+  801e15:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801e1b:	29 ce                	sub    %ecx,%esi
+  801e1d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e22:	f7 e6                	mul    %esi
+  801e24:	c1 ea 0c             	shr    $0xc,%edx
+  801e27:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801e2d:	29 c6                	sub    %eax,%esi
+  801e2f:	89 f2                	mov    %esi,%edx
+  801e31:	75 43                	jne    801e76 <devpipe_read+0x82>
+		ref = pageref(p);
+  801e33:	83 ec 0c             	sub    $0xc,%esp
+  801e36:	53                   	push   %ebx
+  801e37:	e8 77 2d 00 00       	call   804bb3 <pageref>
+  801e3c:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801e3e:	89 da                	mov    %ebx,%edx
+  801e40:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e43:	e8 47 ff ff ff       	call   801d8f <_pipeisclosed>
+  801e48:	83 c4 10             	add    $0x10,%esp
+  801e4b:	85 c0                	test   %eax,%eax
+  801e4d:	0f 85 c1 00 00 00    	jne    801f14 <devpipe_read+0x120>
+	*sleeping = 1;
+  801e53:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801e5a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801e5f:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801e62:	75 ac                	jne    801e10 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801e64:	83 ec 04             	sub    $0x4,%esp
+  801e67:	56                   	push   %esi
+  801e68:	57                   	push   %edi
+  801e69:	ff 75 e4             	push   -0x1c(%ebp)
+  801e6c:	e8 4d f4 ff ff       	call   8012be <sys_futex_wait>
+  801e71:	83 c4 10             	add    $0x10,%esp
+  801e74:	eb 9a                	jmp    801e10 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801e76:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801e79:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801e7d:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801e7f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e84:	f7 e1                	mul    %ecx
+  801e86:	c1 ea 0b             	shr    $0xb,%edx
+  801e89:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801e8f:	29 c1                	sub    %eax,%ecx
+  801e91:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801e93:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801e98:	29 cf                	sub    %ecx,%edi
+  801e9a:	39 f7                	cmp    %esi,%edi
+  801e9c:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801e9f:	8d 43 10             	lea    0x10(%ebx),%eax
+  801ea2:	83 ec 04             	sub    $0x4,%esp
+  801ea5:	57                   	push   %edi
+  801ea6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ea9:	01 c2                	add    %eax,%edx
+  801eab:	52                   	push   %edx
+  801eac:	ff 75 0c             	push   0xc(%ebp)
+  801eaf:	e8 c4 eb ff ff       	call   800a78 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801eb4:	83 c4 0c             	add    $0xc,%esp
+  801eb7:	89 f1                	mov    %esi,%ecx
+  801eb9:	29 f9                	sub    %edi,%ecx
+  801ebb:	51                   	push   %ecx
+  801ebc:	ff 75 e4             	push   -0x1c(%ebp)
+  801ebf:	89 f8                	mov    %edi,%eax
+  801ec1:	03 45 0c             	add    0xc(%ebp),%eax
+  801ec4:	50                   	push   %eax
+  801ec5:	e8 ae eb ff ff       	call   800a78 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801eca:	89 f1                	mov    %esi,%ecx
+  801ecc:	03 0b                	add    (%ebx),%ecx
+  801ece:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801ed3:	f7 e1                	mul    %ecx
+  801ed5:	c1 ea 0c             	shr    $0xc,%edx
+  801ed8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801ede:	29 d1                	sub    %edx,%ecx
+  801ee0:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801ee2:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801ee7:	83 c4 10             	add    $0x10,%esp
+  801eea:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801eee:	75 0a                	jne    801efa <devpipe_read+0x106>
+	return n;
+  801ef0:	89 f0                	mov    %esi,%eax
+}
+  801ef2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ef5:	5b                   	pop    %ebx
+  801ef6:	5e                   	pop    %esi
+  801ef7:	5f                   	pop    %edi
+  801ef8:	5d                   	pop    %ebp
+  801ef9:	c3                   	ret
+		*sleeping = 0;
+  801efa:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801f01:	83 ec 08             	sub    $0x8,%esp
+  801f04:	68 00 04 00 00       	push   $0x400
+  801f09:	53                   	push   %ebx
+  801f0a:	e8 ff f3 ff ff       	call   80130e <sys_futex_wake>
+  801f0f:	83 c4 10             	add    $0x10,%esp
+  801f12:	eb dc                	jmp    801ef0 <devpipe_read+0xfc>
+			return 0;
+  801f14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f19:	eb d7                	jmp    801ef2 <devpipe_read+0xfe>
+
+00801f1b <devpipe_write>:
+{
+  801f1b:	55                   	push   %ebp
+  801f1c:	89 e5                	mov    %esp,%ebp
+  801f1e:	57                   	push   %edi
+  801f1f:	56                   	push   %esi
+  801f20:	53                   	push   %ebx
+  801f21:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801f24:	ff 75 08             	push   0x8(%ebp)
+  801f27:	e8 64 f4 ff ff       	call   801390 <fd2data>
+  801f2c:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801f2e:	83 c4 10             	add    $0x10,%esp
+  801f31:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801f38:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f3b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801f3e:	0f 83 23 01 00 00    	jae    802067 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801f44:	8b 77 04             	mov    0x4(%edi),%esi
+  801f47:	8b 1f                	mov    (%edi),%ebx
+  801f49:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801f4f:	29 d9                	sub    %ebx,%ecx
+  801f51:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f56:	f7 e1                	mul    %ecx
+  801f58:	c1 ea 0c             	shr    $0xc,%edx
+  801f5b:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801f61:	29 c1                	sub    %eax,%ecx
+  801f63:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801f65:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801f6b:	75 40                	jne    801fad <devpipe_write+0x92>
+			ref = pageref(p);
+  801f6d:	83 ec 0c             	sub    $0xc,%esp
+  801f70:	57                   	push   %edi
+  801f71:	e8 3d 2c 00 00       	call   804bb3 <pageref>
+  801f76:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801f78:	89 fa                	mov    %edi,%edx
+  801f7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f7d:	e8 0d fe ff ff       	call   801d8f <_pipeisclosed>
+  801f82:	83 c4 10             	add    $0x10,%esp
+  801f85:	85 c0                	test   %eax,%eax
+  801f87:	0f 85 d5 00 00 00    	jne    802062 <devpipe_write+0x147>
+	*sleeping = 1;
+  801f8d:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801f94:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801f99:	39 1f                	cmp    %ebx,(%edi)
+  801f9b:	75 a7                	jne    801f44 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801f9d:	83 ec 04             	sub    $0x4,%esp
+  801fa0:	56                   	push   %esi
+  801fa1:	53                   	push   %ebx
+  801fa2:	57                   	push   %edi
+  801fa3:	e8 16 f3 ff ff       	call   8012be <sys_futex_wait>
+  801fa8:	83 c4 10             	add    $0x10,%esp
+  801fab:	eb 97                	jmp    801f44 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801fad:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801fb0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fb3:	29 c1                	sub    %eax,%ecx
+  801fb5:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801fba:	89 d8                	mov    %ebx,%eax
+  801fbc:	29 d0                	sub    %edx,%eax
+  801fbe:	39 c1                	cmp    %eax,%ecx
+  801fc0:	0f 46 c1             	cmovbe %ecx,%eax
+  801fc3:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801fc5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801fca:	f7 e6                	mul    %esi
+  801fcc:	c1 ea 0b             	shr    $0xb,%edx
+  801fcf:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801fd5:	29 c6                	sub    %eax,%esi
+  801fd7:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801fd9:	29 f3                	sub    %esi,%ebx
+  801fdb:	39 cb                	cmp    %ecx,%ebx
+  801fdd:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801fe0:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801fe3:	8d 77 10             	lea    0x10(%edi),%esi
+  801fe6:	83 ec 04             	sub    $0x4,%esp
+  801fe9:	53                   	push   %ebx
+  801fea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fed:	03 45 0c             	add    0xc(%ebp),%eax
+  801ff0:	50                   	push   %eax
+  801ff1:	01 f2                	add    %esi,%edx
+  801ff3:	52                   	push   %edx
+  801ff4:	e8 7f ea ff ff       	call   800a78 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  801ff9:	83 c4 0c             	add    $0xc,%esp
+  801ffc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801fff:	29 d8                	sub    %ebx,%eax
+  802001:	50                   	push   %eax
+  802002:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802005:	01 d3                	add    %edx,%ebx
+  802007:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80200a:	53                   	push   %ebx
+  80200b:	56                   	push   %esi
+  80200c:	e8 67 ea ff ff       	call   800a78 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802011:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802014:	03 4f 04             	add    0x4(%edi),%ecx
+  802017:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80201c:	f7 e1                	mul    %ecx
+  80201e:	c1 ea 0c             	shr    $0xc,%edx
+  802021:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802027:	29 d1                	sub    %edx,%ecx
+  802029:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  80202c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802031:	83 c4 10             	add    $0x10,%esp
+  802034:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802038:	75 0b                	jne    802045 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  80203a:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  80203d:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802040:	e9 f3 fe ff ff       	jmp    801f38 <devpipe_write+0x1d>
+		*sleeping = 0;
+  802045:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  80204c:	83 ec 08             	sub    $0x8,%esp
+  80204f:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802054:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802057:	50                   	push   %eax
+  802058:	e8 b1 f2 ff ff       	call   80130e <sys_futex_wake>
+  80205d:	83 c4 10             	add    $0x10,%esp
+  802060:	eb d8                	jmp    80203a <devpipe_write+0x11f>
+				return 0;
+  802062:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802067:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206a:	5b                   	pop    %ebx
+  80206b:	5e                   	pop    %esi
+  80206c:	5f                   	pop    %edi
+  80206d:	5d                   	pop    %ebp
+  80206e:	c3                   	ret
+
+0080206f <pipe>:
+{
+  80206f:	55                   	push   %ebp
+  802070:	89 e5                	mov    %esp,%ebp
+  802072:	56                   	push   %esi
+  802073:	53                   	push   %ebx
+  802074:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802077:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80207a:	50                   	push   %eax
+  80207b:	e8 27 f3 ff ff       	call   8013a7 <fd_alloc>
+  802080:	89 c3                	mov    %eax,%ebx
+  802082:	83 c4 10             	add    $0x10,%esp
+  802085:	85 c0                	test   %eax,%eax
+  802087:	0f 88 23 01 00 00    	js     8021b0 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80208d:	83 ec 04             	sub    $0x4,%esp
+  802090:	68 07 04 00 00       	push   $0x407
+  802095:	ff 75 f4             	push   -0xc(%ebp)
+  802098:	6a 00                	push   $0x0
+  80209a:	e8 46 ed ff ff       	call   800de5 <sys_page_alloc>
+  80209f:	89 c3                	mov    %eax,%ebx
+  8020a1:	83 c4 10             	add    $0x10,%esp
+  8020a4:	85 c0                	test   %eax,%eax
+  8020a6:	0f 88 04 01 00 00    	js     8021b0 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8020ac:	83 ec 0c             	sub    $0xc,%esp
+  8020af:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020b2:	50                   	push   %eax
+  8020b3:	e8 ef f2 ff ff       	call   8013a7 <fd_alloc>
+  8020b8:	89 c3                	mov    %eax,%ebx
+  8020ba:	83 c4 10             	add    $0x10,%esp
+  8020bd:	85 c0                	test   %eax,%eax
+  8020bf:	0f 88 db 00 00 00    	js     8021a0 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020c5:	83 ec 04             	sub    $0x4,%esp
+  8020c8:	68 07 04 00 00       	push   $0x407
+  8020cd:	ff 75 f0             	push   -0x10(%ebp)
+  8020d0:	6a 00                	push   $0x0
+  8020d2:	e8 0e ed ff ff       	call   800de5 <sys_page_alloc>
+  8020d7:	89 c3                	mov    %eax,%ebx
+  8020d9:	83 c4 10             	add    $0x10,%esp
+  8020dc:	85 c0                	test   %eax,%eax
+  8020de:	0f 88 bc 00 00 00    	js     8021a0 <pipe+0x131>
+	va = fd2data(fd0);
+  8020e4:	83 ec 0c             	sub    $0xc,%esp
+  8020e7:	ff 75 f4             	push   -0xc(%ebp)
+  8020ea:	e8 a1 f2 ff ff       	call   801390 <fd2data>
+  8020ef:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020f1:	83 c4 0c             	add    $0xc,%esp
+  8020f4:	68 07 04 00 00       	push   $0x407
+  8020f9:	50                   	push   %eax
+  8020fa:	6a 00                	push   $0x0
+  8020fc:	e8 e4 ec ff ff       	call   800de5 <sys_page_alloc>
+  802101:	89 c3                	mov    %eax,%ebx
+  802103:	83 c4 10             	add    $0x10,%esp
+  802106:	85 c0                	test   %eax,%eax
+  802108:	0f 88 82 00 00 00    	js     802190 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80210e:	83 ec 0c             	sub    $0xc,%esp
+  802111:	ff 75 f0             	push   -0x10(%ebp)
+  802114:	e8 77 f2 ff ff       	call   801390 <fd2data>
+  802119:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802120:	50                   	push   %eax
+  802121:	6a 00                	push   $0x0
+  802123:	56                   	push   %esi
+  802124:	6a 00                	push   $0x0
+  802126:	e8 fd ec ff ff       	call   800e28 <sys_page_map>
+  80212b:	89 c3                	mov    %eax,%ebx
+  80212d:	83 c4 20             	add    $0x20,%esp
+  802130:	85 c0                	test   %eax,%eax
+  802132:	78 4e                	js     802182 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802134:	a1 20 60 80 00       	mov    0x806020,%eax
+  802139:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80213c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80213e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802141:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802148:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80214b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80214d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802150:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802157:	83 ec 0c             	sub    $0xc,%esp
+  80215a:	ff 75 f4             	push   -0xc(%ebp)
+  80215d:	e8 1e f2 ff ff       	call   801380 <fd2num>
+  802162:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802165:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802167:	83 c4 04             	add    $0x4,%esp
+  80216a:	ff 75 f0             	push   -0x10(%ebp)
+  80216d:	e8 0e f2 ff ff       	call   801380 <fd2num>
+  802172:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802175:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802178:	83 c4 10             	add    $0x10,%esp
+  80217b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802180:	eb 2e                	jmp    8021b0 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802182:	83 ec 08             	sub    $0x8,%esp
+  802185:	56                   	push   %esi
+  802186:	6a 00                	push   $0x0
+  802188:	e8 dd ec ff ff       	call   800e6a <sys_page_unmap>
+  80218d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802190:	83 ec 08             	sub    $0x8,%esp
+  802193:	ff 75 f0             	push   -0x10(%ebp)
+  802196:	6a 00                	push   $0x0
+  802198:	e8 cd ec ff ff       	call   800e6a <sys_page_unmap>
+  80219d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8021a0:	83 ec 08             	sub    $0x8,%esp
+  8021a3:	ff 75 f4             	push   -0xc(%ebp)
+  8021a6:	6a 00                	push   $0x0
+  8021a8:	e8 bd ec ff ff       	call   800e6a <sys_page_unmap>
+  8021ad:	83 c4 10             	add    $0x10,%esp
+}
+  8021b0:	89 d8                	mov    %ebx,%eax
+  8021b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b5:	5b                   	pop    %ebx
+  8021b6:	5e                   	pop    %esi
+  8021b7:	5d                   	pop    %ebp
+  8021b8:	c3                   	ret
+
+008021b9 <pipeisclosed>:
+{
+  8021b9:	55                   	push   %ebp
+  8021ba:	89 e5                	mov    %esp,%ebp
+  8021bc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c2:	50                   	push   %eax
+  8021c3:	ff 75 08             	push   0x8(%ebp)
+  8021c6:	e8 30 f2 ff ff       	call   8013fb <fd_lookup>
+  8021cb:	83 c4 10             	add    $0x10,%esp
+  8021ce:	85 c0                	test   %eax,%eax
+  8021d0:	78 18                	js     8021ea <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8021d2:	83 ec 0c             	sub    $0xc,%esp
+  8021d5:	ff 75 f4             	push   -0xc(%ebp)
+  8021d8:	e8 b3 f1 ff ff       	call   801390 <fd2data>
+  8021dd:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8021df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021e2:	e8 a8 fb ff ff       	call   801d8f <_pipeisclosed>
+  8021e7:	83 c4 10             	add    $0x10,%esp
+}
+  8021ea:	c9                   	leave
+  8021eb:	c3                   	ret
+
+008021ec <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  8021ec:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8021ee:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  8021f4:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  8021fa:	81 c2 34 01 00 00    	add    $0x134,%edx
+  802200:	39 d0                	cmp    %edx,%eax
+  802202:	74 2e                	je     802232 <segment_lookup+0x46>
+{
+  802204:	55                   	push   %ebp
+  802205:	89 e5                	mov    %esp,%ebp
+  802207:	57                   	push   %edi
+  802208:	56                   	push   %esi
+  802209:	53                   	push   %ebx
+  80220a:	eb 07                	jmp    802213 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  80220c:	83 c0 20             	add    $0x20,%eax
+  80220f:	39 d0                	cmp    %edx,%eax
+  802211:	74 15                	je     802228 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802213:	8b 18                	mov    (%eax),%ebx
+  802215:	39 d9                	cmp    %ebx,%ecx
+  802217:	72 f3                	jb     80220c <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  802219:	8b 38                	mov    (%eax),%edi
+  80221b:	8b 58 04             	mov    0x4(%eax),%ebx
+  80221e:	89 ce                	mov    %ecx,%esi
+  802220:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  802222:	39 de                	cmp    %ebx,%esi
+  802224:	73 e6                	jae    80220c <segment_lookup+0x20>
+  802226:	eb 05                	jmp    80222d <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  802228:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80222d:	5b                   	pop    %ebx
+  80222e:	5e                   	pop    %esi
+  80222f:	5f                   	pop    %edi
+  802230:	5d                   	pop    %ebp
+  802231:	c3                   	ret
+	return NULL;
+  802232:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802237:	c3                   	ret
+
+00802238 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802238:	55                   	push   %ebp
+  802239:	89 e5                	mov    %esp,%ebp
+  80223b:	53                   	push   %ebx
+  80223c:	83 ec 04             	sub    $0x4,%esp
+  80223f:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802241:	c1 e8 16             	shr    $0x16,%eax
+  802244:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80224b:	25 81 00 00 00       	and    $0x81,%eax
+  802250:	83 f8 01             	cmp    $0x1,%eax
+  802253:	75 6b                	jne    8022c0 <page_is_clean+0x88>
+  802255:	89 da                	mov    %ebx,%edx
+  802257:	c1 ea 0c             	shr    $0xc,%edx
+  80225a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  802261:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802266:	f6 c1 01             	test   $0x1,%cl
+  802269:	74 5a                	je     8022c5 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  80226b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802272:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802278:	75 4b                	jne    8022c5 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  80227a:	89 d8                	mov    %ebx,%eax
+  80227c:	e8 6b ff ff ff       	call   8021ec <segment_lookup>
+  802281:	89 c2                	mov    %eax,%edx
+		return 1;
+  802283:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  802288:	85 d2                	test   %edx,%edx
+  80228a:	75 39                	jne    8022c5 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  80228c:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  802292:	b8 00 00 00 00       	mov    $0x0,%eax
+  802297:	eb 03                	jmp    80229c <page_is_clean+0x64>
+  802299:	83 c0 01             	add    $0x1,%eax
+  80229c:	39 c2                	cmp    %eax,%edx
+  80229e:	7e 19                	jle    8022b9 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  8022a0:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  8022a7:	72 f0                	jb     802299 <page_is_clean+0x61>
+  8022a9:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  8022b0:	73 e7                	jae    802299 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  8022b2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022b7:	eb 0c                	jmp    8022c5 <page_is_clean+0x8d>
+	return 0;
+  8022b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022be:	eb 05                	jmp    8022c5 <page_is_clean+0x8d>
+		return 0;
+  8022c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022c8:	c9                   	leave
+  8022c9:	c3                   	ret
+
+008022ca <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  8022ca:	55                   	push   %ebp
+  8022cb:	89 e5                	mov    %esp,%ebp
+  8022cd:	57                   	push   %edi
+  8022ce:	56                   	push   %esi
+  8022cf:	53                   	push   %ebx
+  8022d0:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8022d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8022d8:	eb 19                	jmp    8022f3 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8022da:	f7 d3                	not    %ebx
+  8022dc:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8022e2:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8022e4:	83 c6 01             	add    $0x1,%esi
+  8022e7:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8022ed:	0f 87 97 00 00 00    	ja     80238a <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8022f3:	89 f3                	mov    %esi,%ebx
+  8022f5:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  8022fb:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802301:	89 d8                	mov    %ebx,%eax
+  802303:	c1 e8 0a             	shr    $0xa,%eax
+  802306:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80230d:	25 81 00 00 00       	and    $0x81,%eax
+  802312:	83 f8 01             	cmp    $0x1,%eax
+  802315:	75 c3                	jne    8022da <linear_walk+0x10>
+  802317:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80231d:	77 bb                	ja     8022da <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  80231f:	89 df                	mov    %ebx,%edi
+  802321:	c1 e7 0c             	shl    $0xc,%edi
+  802324:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802327:	89 f8                	mov    %edi,%eax
+  802329:	e8 0a ff ff ff       	call   802238 <page_is_clean>
+  80232e:	84 c0                	test   %al,%al
+  802330:	75 64                	jne    802396 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802332:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802338:	77 aa                	ja     8022e4 <linear_walk+0x1a>
+  80233a:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  802340:	72 a2                	jb     8022e4 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802342:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802349:	a8 01                	test   $0x1,%al
+  80234b:	74 97                	je     8022e4 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80234d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802354:	f6 c4 04             	test   $0x4,%ah
+  802357:	75 8b                	jne    8022e4 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802359:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802360:	f6 c4 02             	test   $0x2,%ah
+  802363:	0f 85 7b ff ff ff    	jne    8022e4 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802369:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802370:	c1 e8 0c             	shr    $0xc,%eax
+  802373:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802376:	05 00 00 00 ef       	add    $0xef000000,%eax
+  80237b:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80237f:	66 83 f8 01          	cmp    $0x1,%ax
+  802383:	76 11                	jbe    802396 <linear_walk+0xcc>
+  802385:	e9 5a ff ff ff       	jmp    8022e4 <linear_walk+0x1a>
+  80238a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  80238f:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802396:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  80239c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80239f:	83 c4 1c             	add    $0x1c,%esp
+  8023a2:	5b                   	pop    %ebx
+  8023a3:	5e                   	pop    %esi
+  8023a4:	5f                   	pop    %edi
+  8023a5:	5d                   	pop    %ebp
+  8023a6:	c3                   	ret
+
+008023a7 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  8023a7:	55                   	push   %ebp
+  8023a8:	89 e5                	mov    %esp,%ebp
+  8023aa:	56                   	push   %esi
+  8023ab:	53                   	push   %ebx
+  8023ac:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  8023ae:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023b3:	83 e0 7f             	and    $0x7f,%eax
+  8023b6:	c1 e0 04             	shl    $0x4,%eax
+  8023b9:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  8023bf:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  8023c5:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  8023cb:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  8023d1:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023d6:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  8023d9:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023de:	83 c0 01             	add    $0x1,%eax
+  8023e1:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  8023e6:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  8023e9:	5b                   	pop    %ebx
+  8023ea:	5e                   	pop    %esi
+  8023eb:	5d                   	pop    %ebp
+  8023ec:	c3                   	ret
+
+008023ed <page_ring_enter>:
+{
+  8023ed:	55                   	push   %ebp
+  8023ee:	89 e5                	mov    %esp,%ebp
+  8023f0:	57                   	push   %edi
+  8023f1:	56                   	push   %esi
+  8023f2:	53                   	push   %ebx
+  8023f3:	83 ec 18             	sub    $0x18,%esp
+  8023f6:	89 c6                	mov    %eax,%esi
+  8023f8:	89 d7                	mov    %edx,%edi
+  8023fa:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  8023fc:	6a 00                	push   $0x0
+  8023fe:	6a 00                	push   $0x0
+  802400:	6a 00                	push   $0x0
+  802402:	6a 07                	push   $0x7
+  802404:	ff 35 40 b0 80 00    	push   0x80b040
+  80240a:	e8 8e 26 00 00       	call   804a9d <ipc_call>
+  80240f:	83 c4 20             	add    $0x20,%esp
+  802412:	85 c0                	test   %eax,%eax
+  802414:	79 22                	jns    802438 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802416:	50                   	push   %eax
+  802417:	68 16 53 80 00       	push   $0x805316
+  80241c:	68 13 02 00 00       	push   $0x213
+  802421:	68 2a 53 80 00       	push   $0x80532a
+  802426:	e8 05 de ff ff       	call   800230 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  80242b:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802430:	83 c0 01             	add    $0x1,%eax
+  802433:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802438:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  80243e:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802443:	39 c2                	cmp    %eax,%edx
+  802445:	74 24                	je     80246b <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802447:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  80244c:	83 e0 7f             	and    $0x7f,%eax
+  80244f:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802456:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  80245d:	29 f0                	sub    %esi,%eax
+  80245f:	39 d8                	cmp    %ebx,%eax
+  802461:	73 c8                	jae    80242b <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802463:	8b 52 04             	mov    0x4(%edx),%edx
+  802466:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802469:	eb c0                	jmp    80242b <page_ring_enter+0x3e>
+}
+  80246b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80246e:	5b                   	pop    %ebx
+  80246f:	5e                   	pop    %esi
+  802470:	5f                   	pop    %edi
+  802471:	5d                   	pop    %ebp
+  802472:	c3                   	ret
+
+00802473 <page_ring_reserve>:
+{
+  802473:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802475:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80247a:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802480:	29 d0                	sub    %edx,%eax
+  802482:	ba 80 00 00 00       	mov    $0x80,%edx
+  802487:	29 ca                	sub    %ecx,%edx
+  802489:	39 c2                	cmp    %eax,%edx
+  80248b:	72 01                	jb     80248e <page_ring_reserve+0x1b>
+  80248d:	c3                   	ret
+{
+  80248e:	55                   	push   %ebp
+  80248f:	89 e5                	mov    %esp,%ebp
+  802491:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802494:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802499:	ba 00 00 00 00       	mov    $0x0,%edx
+  80249e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a3:	e8 45 ff ff ff       	call   8023ed <page_ring_enter>
+}
+  8024a8:	c9                   	leave
+  8024a9:	c3                   	ret
+
+008024aa <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  8024aa:	55                   	push   %ebp
+  8024ab:	89 e5                	mov    %esp,%ebp
+  8024ad:	53                   	push   %ebx
+  8024ae:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  8024b1:	6a 07                	push   $0x7
+  8024b3:	6a 01                	push   $0x1
+  8024b5:	89 c3                	mov    %eax,%ebx
+  8024b7:	c1 e3 0c             	shl    $0xc,%ebx
+  8024ba:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  8024c0:	52                   	push   %edx
+  8024c1:	6a 04                	push   $0x4
+  8024c3:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  8024ca:	e8 ce 25 00 00       	call   804a9d <ipc_call>
+	sharereqs[i].nslots = 0;
+  8024cf:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  8024d6:	00 00 00 
+	return r;
+}
+  8024d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024dc:	c9                   	leave
+  8024dd:	c3                   	ret
+
+008024de <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  8024de:	55                   	push   %ebp
+  8024df:	89 e5                	mov    %esp,%ebp
+  8024e1:	56                   	push   %esi
+  8024e2:	53                   	push   %ebx
+  8024e3:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  8024e5:	c1 e8 10             	shr    $0x10,%eax
+  8024e8:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  8024eb:	89 c2                	mov    %eax,%edx
+  8024ed:	c1 e2 0c             	shl    $0xc,%edx
+  8024f0:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  8024f6:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8024f9:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  8024ff:	89 c2                	mov    %eax,%edx
+  802501:	c1 e2 0a             	shl    $0xa,%edx
+  802504:	01 f2                	add    %esi,%edx
+  802506:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  80250d:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802513:	74 09                	je     80251e <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802515:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80251a:	5b                   	pop    %ebx
+  80251b:	5e                   	pop    %esi
+  80251c:	5d                   	pop    %ebp
+  80251d:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  80251e:	e8 87 ff ff ff       	call   8024aa <page_share_send>
+  802523:	eb f5                	jmp    80251a <page_share_slot+0x3c>
+
+00802525 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802525:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80252a:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  80252d:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802532:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  802538:	74 09                	je     802543 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  80253a:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80253f:	85 c0                	test   %eax,%eax
+  802541:	75 01                	jne    802544 <page_ring_ready+0x1f>
+}
+  802543:	c3                   	ret
+{
+  802544:	55                   	push   %ebp
+  802545:	89 e5                	mov    %esp,%ebp
+  802547:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  80254a:	68 07 06 00 00       	push   $0x607
+  80254f:	6a 08                	push   $0x8
+  802551:	68 00 30 ad de       	push   $0xdead3000
+  802556:	6a 00                	push   $0x0
+  802558:	e8 b3 e9 ff ff       	call   800f10 <sys_page_alloc_range>
+  80255d:	83 c4 10             	add    $0x10,%esp
+  802560:	83 f8 08             	cmp    $0x8,%eax
+  802563:	74 1b                	je     802580 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802565:	83 ec 04             	sub    $0x4,%esp
+  802568:	6a 08                	push   $0x8
+  80256a:	68 00 30 ad de       	push   $0xdead3000
+  80256f:	6a 00                	push   $0x0
+  802571:	e8 08 ea ff ff       	call   800f7e <sys_page_unmap_range>
+		return 0;
+  802576:	83 c4 10             	add    $0x10,%esp
+  802579:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80257e:	c9                   	leave
+  80257f:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802580:	83 ec 0c             	sub    $0xc,%esp
+  802583:	68 07 04 00 00       	push   $0x407
+  802588:	6a 08                	push   $0x8
+  80258a:	68 00 30 ad de       	push   $0xdead3000
+  80258f:	6a 06                	push   $0x6
+  802591:	ff 35 40 b0 80 00    	push   0x80b040
+  802597:	e8 01 25 00 00       	call   804a9d <ipc_call>
+  80259c:	83 c4 20             	add    $0x20,%esp
+  80259f:	85 c0                	test   %eax,%eax
+  8025a1:	78 14                	js     8025b7 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  8025a3:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8025a8:	8b 40 48             	mov    0x48(%eax),%eax
+  8025ab:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  8025b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025b5:	eb c7                	jmp    80257e <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  8025b7:	83 ec 04             	sub    $0x4,%esp
+  8025ba:	6a 08                	push   $0x8
+  8025bc:	68 00 30 ad de       	push   $0xdead3000
+  8025c1:	6a 00                	push   $0x0
+  8025c3:	e8 b6 e9 ff ff       	call   800f7e <sys_page_unmap_range>
+		return 0;
+  8025c8:	83 c4 10             	add    $0x10,%esp
+  8025cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d0:	eb ac                	jmp    80257e <page_ring_ready+0x59>
+
+008025d2 <page_remove_slot>:
+{
+  8025d2:	55                   	push   %ebp
+  8025d3:	89 e5                	mov    %esp,%ebp
+  8025d5:	56                   	push   %esi
+  8025d6:	53                   	push   %ebx
+  8025d7:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8025d9:	89 c6                	mov    %eax,%esi
+  8025db:	c1 ee 10             	shr    $0x10,%esi
+  8025de:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8025e1:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  8025e8:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  8025ee:	74 2a                	je     80261a <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8025f0:	83 ec 0c             	sub    $0xc,%esp
+  8025f3:	6a 00                	push   $0x0
+  8025f5:	6a 00                	push   $0x0
+  8025f7:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  8025f9:	c1 e3 04             	shl    $0x4,%ebx
+  8025fc:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8025ff:	53                   	push   %ebx
+  802600:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  802607:	e8 91 24 00 00       	call   804a9d <ipc_call>
+  80260c:	83 c4 20             	add    $0x20,%esp
+  80260f:	85 c0                	test   %eax,%eax
+  802611:	78 2d                	js     802640 <page_remove_slot+0x6e>
+}
+  802613:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802616:	5b                   	pop    %ebx
+  802617:	5e                   	pop    %esi
+  802618:	5d                   	pop    %ebp
+  802619:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  80261a:	e8 06 ff ff ff       	call   802525 <page_ring_ready>
+  80261f:	85 c0                	test   %eax,%eax
+  802621:	74 cd                	je     8025f0 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802623:	b8 01 00 00 00       	mov    $0x1,%eax
+  802628:	e8 46 fe ff ff       	call   802473 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  80262d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802632:	89 da                	mov    %ebx,%edx
+  802634:	b8 02 00 00 00       	mov    $0x2,%eax
+  802639:	e8 69 fd ff ff       	call   8023a7 <page_ring_post>
+		return;
+  80263e:	eb d3                	jmp    802613 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802640:	50                   	push   %eax
+  802641:	68 84 53 80 00       	push   $0x805384
+  802646:	68 ac 03 00 00       	push   $0x3ac
+  80264b:	68 2a 53 80 00       	push   $0x80532a
+  802650:	e8 db db ff ff       	call   800230 <_panic>
+
+00802655 <find_paging_env>:
+	if(pagingenv)
+  802655:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  80265a:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  80265c:	85 c0                	test   %eax,%eax
+  80265e:	74 05                	je     802665 <find_paging_env+0x10>
+  802660:	eb 56                	jmp    8026b8 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802662:	83 c0 01             	add    $0x1,%eax
+  802665:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80266a:	7f 47                	jg     8026b3 <find_paging_env+0x5e>
+  80266c:	83 f9 01             	cmp    $0x1,%ecx
+  80266f:	7f 42                	jg     8026b3 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802671:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802674:	c1 e2 06             	shl    $0x6,%edx
+  802677:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80267d:	8b 52 50             	mov    0x50(%edx),%edx
+  802680:	83 fa 02             	cmp    $0x2,%edx
+  802683:	75 dd                	jne    802662 <find_paging_env+0xd>
+  802685:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802688:	c1 e2 06             	shl    $0x6,%edx
+  80268b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802691:	8b 52 54             	mov    0x54(%edx),%edx
+  802694:	85 d2                	test   %edx,%edx
+  802696:	74 ca                	je     802662 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802698:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  80269b:	c1 e2 06             	shl    $0x6,%edx
+  80269e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8026a4:	8b 52 48             	mov    0x48(%edx),%edx
+  8026a7:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  8026ae:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8026b1:	eb af                	jmp    802662 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  8026b3:	83 f9 02             	cmp    $0x2,%ecx
+  8026b6:	74 01                	je     8026b9 <find_paging_env+0x64>
+}
+  8026b8:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  8026b9:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8026be:	8b 40 48             	mov    0x48(%eax),%eax
+  8026c1:	83 e0 01             	and    $0x1,%eax
+  8026c4:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  8026cb:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  8026d0:	eb e6                	jmp    8026b8 <find_paging_env+0x63>
+
+008026d2 <page_add_backed>:
+{
+  8026d2:	55                   	push   %ebp
+  8026d3:	89 e5                	mov    %esp,%ebp
+  8026d5:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  8026d8:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  8026dd:	83 f8 04             	cmp    $0x4,%eax
+  8026e0:	74 35                	je     802717 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  8026e2:	89 d1                	mov    %edx,%ecx
+  8026e4:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  8026ea:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  8026f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026f4:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  8026fb:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802701:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  802708:	83 c0 01             	add    $0x1,%eax
+  80270b:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  802710:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802715:	5d                   	pop    %ebp
+  802716:	c3                   	ret
+		return -E_NO_MEM;
+  802717:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80271c:	eb f7                	jmp    802715 <page_add_backed+0x43>
+
+0080271e <percentage_of_pgdir_to_walk>:
+{
+  80271e:	55                   	push   %ebp
+  80271f:	89 e5                	mov    %esp,%ebp
+  802721:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802724:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802728:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  80272b:	db 45 fc             	fildl  -0x4(%ebp)
+  80272e:	d8 35 10 58 80 00    	fdivs  0x805810
+	return ret*ret;
+  802734:	d8 c8                	fmul   %st(0),%st
+}
+  802736:	c9                   	leave
+  802737:	c3                   	ret
+
+00802738 <nfu_with_aging_page_choice_func>:
+{
+  802738:	55                   	push   %ebp
+  802739:	89 e5                	mov    %esp,%ebp
+  80273b:	57                   	push   %edi
+  80273c:	56                   	push   %esi
+  80273d:	53                   	push   %ebx
+  80273e:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802741:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  802747:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802749:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80274e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802753:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80275a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80275f:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802762:	eb 18                	jmp    80277c <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802764:	f7 d0                	not    %eax
+  802766:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80276b:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80276d:	83 c2 01             	add    $0x1,%edx
+  802770:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802776:	0f 87 13 01 00 00    	ja     80288f <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  80277c:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802780:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802783:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802788:	89 c1                	mov    %eax,%ecx
+  80278a:	c1 e9 0a             	shr    $0xa,%ecx
+  80278d:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802794:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  80279a:	83 f9 01             	cmp    $0x1,%ecx
+  80279d:	75 c5                	jne    802764 <nfu_with_aging_page_choice_func+0x2c>
+  80279f:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8027a4:	77 be                	ja     802764 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8027a6:	89 c1                	mov    %eax,%ecx
+  8027a8:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8027ab:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  8027b1:	0f 82 a5 00 00 00    	jb     80285c <nfu_with_aging_page_choice_func+0x124>
+  8027b7:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8027bd:	0f 87 99 00 00 00    	ja     80285c <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8027c3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8027ca:	f6 c1 01             	test   $0x1,%cl
+  8027cd:	0f 84 89 00 00 00    	je     80285c <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027d3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8027da:	f6 c5 04             	test   $0x4,%ch
+  8027dd:	75 7d                	jne    80285c <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8027df:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027e6:	f6 c5 02             	test   $0x2,%ch
+  8027e9:	75 71                	jne    80285c <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8027eb:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8027f2:	c1 e9 0c             	shr    $0xc,%ecx
+  8027f5:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8027f8:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8027fe:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802802:	66 83 f9 01          	cmp    $0x1,%cx
+  802806:	77 54                	ja     80285c <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802808:	89 f9                	mov    %edi,%ecx
+  80280a:	80 f9 ff             	cmp    $0xff,%cl
+  80280d:	74 21                	je     802830 <nfu_with_aging_page_choice_func+0xf8>
+  80280f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802816:	c1 e9 0c             	shr    $0xc,%ecx
+  802819:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80281c:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802822:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802826:	89 fb                	mov    %edi,%ebx
+  802828:	38 d9                	cmp    %bl,%cl
+  80282a:	73 30                	jae    80285c <nfu_with_aging_page_choice_func+0x124>
+  80282c:	dd d8                	fstp   %st(0)
+  80282e:	eb 02                	jmp    802832 <nfu_with_aging_page_choice_func+0xfa>
+  802830:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802832:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802839:	c1 e9 0c             	shr    $0xc,%ecx
+  80283c:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80283f:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802846:	89 fb                	mov    %edi,%ebx
+  802848:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  80284b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80284e:	db 45 e0             	fildl  -0x20(%ebp)
+  802851:	d8 35 10 58 80 00    	fdivs  0x805810
+	return ret*ret;
+  802857:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802859:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  80285c:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80285f:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802862:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802869:	df 6d e0             	fildll -0x20(%ebp)
+  80286c:	d9 c1                	fld    %st(1)
+  80286e:	d8 0d 14 58 80 00    	fmuls  0x805814
+  802874:	d9 c9                	fxch   %st(1)
+  802876:	df f1                	fcomip %st(1),%st
+  802878:	dd d8                	fstp   %st(0)
+  80287a:	0f 82 ed fe ff ff    	jb     80276d <nfu_with_aging_page_choice_func+0x35>
+  802880:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802882:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  802887:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80288a:	c1 e0 0c             	shl    $0xc,%eax
+  80288d:	eb 0e                	jmp    80289d <nfu_with_aging_page_choice_func+0x165>
+  80288f:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802891:	89 f8                	mov    %edi,%eax
+  802893:	3c ff                	cmp    $0xff,%al
+  802895:	74 0e                	je     8028a5 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802897:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80289a:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80289d:	83 c4 14             	add    $0x14,%esp
+  8028a0:	5b                   	pop    %ebx
+  8028a1:	5e                   	pop    %esi
+  8028a2:	5f                   	pop    %edi
+  8028a3:	5d                   	pop    %ebp
+  8028a4:	c3                   	ret
+	pgnum = 0;
+  8028a5:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  8028ac:	00 00 00 
+	return (void*)UTOP;
+  8028af:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8028b4:	eb e7                	jmp    80289d <nfu_with_aging_page_choice_func+0x165>
+
+008028b6 <myRand>:
+    state = state * 1664525 + 1013904223;
+  8028b6:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  8028bd:	66 19 00 
+  8028c0:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  8028c5:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  8028ca:	c1 e8 18             	shr    $0x18,%eax
+}
+  8028cd:	c3                   	ret
+
+008028ce <random_page_choice_func>:
+{
+  8028ce:	55                   	push   %ebp
+  8028cf:	89 e5                	mov    %esp,%ebp
+  8028d1:	57                   	push   %edi
+  8028d2:	56                   	push   %esi
+  8028d3:	53                   	push   %ebx
+  8028d4:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8028d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8028dc:	eb 19                	jmp    8028f7 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8028de:	f7 d3                	not    %ebx
+  8028e0:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8028e6:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8028e8:	83 c6 01             	add    $0x1,%esi
+  8028eb:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8028f1:	0f 87 a0 00 00 00    	ja     802997 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8028f7:	89 f3                	mov    %esi,%ebx
+  8028f9:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  8028ff:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802905:	89 d8                	mov    %ebx,%eax
+  802907:	c1 e8 0a             	shr    $0xa,%eax
+  80290a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802911:	25 81 00 00 00       	and    $0x81,%eax
+  802916:	83 f8 01             	cmp    $0x1,%eax
+  802919:	75 c3                	jne    8028de <random_page_choice_func+0x10>
+  80291b:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802921:	77 bb                	ja     8028de <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802923:	89 df                	mov    %ebx,%edi
+  802925:	c1 e7 0c             	shl    $0xc,%edi
+  802928:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80292b:	89 f8                	mov    %edi,%eax
+  80292d:	e8 06 f9 ff ff       	call   802238 <page_is_clean>
+  802932:	84 c0                	test   %al,%al
+  802934:	0f 85 82 00 00 00    	jne    8029bc <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80293a:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  802940:	72 a6                	jb     8028e8 <random_page_choice_func+0x1a>
+  802942:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802948:	77 9e                	ja     8028e8 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80294a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802951:	a8 01                	test   $0x1,%al
+  802953:	74 93                	je     8028e8 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802955:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80295c:	f6 c4 04             	test   $0x4,%ah
+  80295f:	75 87                	jne    8028e8 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802961:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802968:	f6 c4 02             	test   $0x2,%ah
+  80296b:	0f 85 77 ff ff ff    	jne    8028e8 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802971:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802978:	c1 e8 0c             	shr    $0xc,%eax
+  80297b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80297e:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802983:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802987:	66 83 f8 01          	cmp    $0x1,%ax
+  80298b:	0f 87 57 ff ff ff    	ja     8028e8 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  802991:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802997:	e8 1a ff ff ff       	call   8028b6 <myRand>
+  80299c:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  8029a2:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  8029a7:	29 fe                	sub    %edi,%esi
+  8029a9:	0f be c0             	movsbl %al,%eax
+  8029ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b1:	f7 f6                	div    %esi
+  8029b3:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8029b5:	bb 15 00 00 00       	mov    $0x15,%ebx
+  8029ba:	eb 1c                	jmp    8029d8 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  8029bc:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  8029c2:	e9 8f 00 00 00       	jmp    802a56 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8029c7:	e8 ea fe ff ff       	call   8028b6 <myRand>
+  8029cc:	0f be c0             	movsbl %al,%eax
+  8029cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029d4:	f7 f6                	div    %esi
+  8029d6:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8029d8:	83 eb 01             	sub    $0x1,%ebx
+  8029db:	0f 84 c2 00 00 00    	je     802aa3 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  8029e1:	89 d0                	mov    %edx,%eax
+  8029e3:	c1 e8 0a             	shr    $0xa,%eax
+  8029e6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8029ed:	25 81 00 00 00       	and    $0x81,%eax
+  8029f2:	83 f8 01             	cmp    $0x1,%eax
+  8029f5:	75 d0                	jne    8029c7 <random_page_choice_func+0xf9>
+  8029f7:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  8029fd:	77 c8                	ja     8029c7 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  8029ff:	89 d0                	mov    %edx,%eax
+  802a01:	c1 e0 0c             	shl    $0xc,%eax
+  802a04:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  802a09:	72 56                	jb     802a61 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a0b:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  802a10:	77 65                	ja     802a77 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802a12:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a19:	f6 c1 01             	test   $0x1,%cl
+  802a1c:	74 59                	je     802a77 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802a1e:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802a25:	f6 c5 04             	test   $0x4,%ch
+  802a28:	75 4d                	jne    802a77 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  802a2a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802a31:	f6 c5 02             	test   $0x2,%ch
+  802a34:	75 41                	jne    802a77 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  802a36:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802a3d:	c1 ea 0c             	shr    $0xc,%edx
+  802a40:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  802a43:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  802a49:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  802a4d:	66 83 fa 01          	cmp    $0x1,%dx
+  802a51:	77 3a                	ja     802a8d <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  802a53:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  802a56:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a59:	83 c4 1c             	add    $0x1c,%esp
+  802a5c:	5b                   	pop    %ebx
+  802a5d:	5e                   	pop    %esi
+  802a5e:	5f                   	pop    %edi
+  802a5f:	5d                   	pop    %ebp
+  802a60:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802a61:	e8 50 fe ff ff       	call   8028b6 <myRand>
+  802a66:	0f be c0             	movsbl %al,%eax
+  802a69:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a6e:	f7 f6                	div    %esi
+  802a70:	01 fa                	add    %edi,%edx
+			continue;
+  802a72:	e9 61 ff ff ff       	jmp    8029d8 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802a77:	e8 3a fe ff ff       	call   8028b6 <myRand>
+  802a7c:	0f be c0             	movsbl %al,%eax
+  802a7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a84:	f7 f6                	div    %esi
+  802a86:	01 fa                	add    %edi,%edx
+			continue;
+  802a88:	e9 4b ff ff ff       	jmp    8029d8 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802a8d:	e8 24 fe ff ff       	call   8028b6 <myRand>
+  802a92:	0f be c0             	movsbl %al,%eax
+  802a95:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a9a:	f7 f6                	div    %esi
+  802a9c:	01 fa                	add    %edi,%edx
+			continue;
+  802a9e:	e9 35 ff ff ff       	jmp    8029d8 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  802aa3:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  802aaa:	00 00 00 
+	return (void*)UTOP;
+  802aad:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  802ab4:	eb a0                	jmp    802a56 <random_page_choice_func+0x188>
+
+00802ab6 <nfu>:
+{
+  802ab6:	55                   	push   %ebp
+  802ab7:	89 e5                	mov    %esp,%ebp
+  802ab9:	57                   	push   %edi
+  802aba:	56                   	push   %esi
+  802abb:	53                   	push   %ebx
+  802abc:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802abf:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  802ac5:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802ac7:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802acc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ad1:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802ad8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802add:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802ae0:	eb 18                	jmp    802afa <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802ae2:	f7 d0                	not    %eax
+  802ae4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802ae9:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802aeb:	83 c2 01             	add    $0x1,%edx
+  802aee:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802af4:	0f 87 13 01 00 00    	ja     802c0d <nfu+0x157>
+		++num_searched_ptes;
+  802afa:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802afe:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802b01:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802b06:	89 c1                	mov    %eax,%ecx
+  802b08:	c1 e9 0a             	shr    $0xa,%ecx
+  802b0b:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802b12:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802b18:	83 f9 01             	cmp    $0x1,%ecx
+  802b1b:	75 c5                	jne    802ae2 <nfu+0x2c>
+  802b1d:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802b22:	77 be                	ja     802ae2 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802b24:	89 c1                	mov    %eax,%ecx
+  802b26:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b29:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802b2f:	0f 82 a5 00 00 00    	jb     802bda <nfu+0x124>
+  802b35:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802b3b:	0f 87 99 00 00 00    	ja     802bda <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b41:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b48:	f6 c1 01             	test   $0x1,%cl
+  802b4b:	0f 84 89 00 00 00    	je     802bda <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802b51:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b58:	f6 c5 04             	test   $0x4,%ch
+  802b5b:	75 7d                	jne    802bda <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802b5d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802b64:	f6 c5 02             	test   $0x2,%ch
+  802b67:	75 71                	jne    802bda <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802b69:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b70:	c1 e9 0c             	shr    $0xc,%ecx
+  802b73:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b76:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802b7c:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802b80:	66 83 f9 01          	cmp    $0x1,%cx
+  802b84:	77 54                	ja     802bda <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  802b86:	89 f9                	mov    %edi,%ecx
+  802b88:	80 f9 ff             	cmp    $0xff,%cl
+  802b8b:	74 21                	je     802bae <nfu+0xf8>
+  802b8d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b94:	c1 e9 0c             	shr    $0xc,%ecx
+  802b97:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b9a:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802ba0:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  802ba4:	89 fb                	mov    %edi,%ebx
+  802ba6:	38 d9                	cmp    %bl,%cl
+  802ba8:	73 30                	jae    802bda <nfu+0x124>
+  802baa:	dd d8                	fstp   %st(0)
+  802bac:	eb 02                	jmp    802bb0 <nfu+0xfa>
+  802bae:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  802bb0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802bb7:	c1 e9 0c             	shr    $0xc,%ecx
+  802bba:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802bbd:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802bc4:	89 fb                	mov    %edi,%ebx
+  802bc6:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802bc9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802bcc:	db 45 e0             	fildl  -0x20(%ebp)
+  802bcf:	d8 35 10 58 80 00    	fdivs  0x805810
+	return ret*ret;
+  802bd5:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802bd7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802bda:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802bdd:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802be0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802be7:	df 6d e0             	fildll -0x20(%ebp)
+  802bea:	d9 c1                	fld    %st(1)
+  802bec:	d8 0d 14 58 80 00    	fmuls  0x805814
+  802bf2:	d9 c9                	fxch   %st(1)
+  802bf4:	df f1                	fcomip %st(1),%st
+  802bf6:	dd d8                	fstp   %st(0)
+  802bf8:	0f 82 ed fe ff ff    	jb     802aeb <nfu+0x35>
+  802bfe:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802c00:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  802c05:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802c08:	c1 e0 0c             	shl    $0xc,%eax
+  802c0b:	eb 0e                	jmp    802c1b <nfu+0x165>
+  802c0d:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802c0f:	89 f8                	mov    %edi,%eax
+  802c11:	3c ff                	cmp    $0xff,%al
+  802c13:	74 0e                	je     802c23 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802c15:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802c18:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802c1b:	83 c4 14             	add    $0x14,%esp
+  802c1e:	5b                   	pop    %ebx
+  802c1f:	5e                   	pop    %esi
+  802c20:	5f                   	pop    %edi
+  802c21:	5d                   	pop    %ebp
+  802c22:	c3                   	ret
+	pgnum = 0;
+  802c23:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  802c2a:	00 00 00 
+	return (void*)UTOP;
+  802c2d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802c32:	eb e7                	jmp    802c1b <nfu+0x165>
+
+00802c34 <lru>:
+{
+  802c34:	55                   	push   %ebp
+  802c35:	89 e5                	mov    %esp,%ebp
+  802c37:	57                   	push   %edi
+  802c38:	56                   	push   %esi
+  802c39:	53                   	push   %ebx
+  802c3a:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c3d:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  802c43:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  802c4a:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802c51:	be 00 00 00 00       	mov    $0x0,%esi
+  802c56:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c62:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  802c65:	eb 18                	jmp    802c7f <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802c67:	f7 d0                	not    %eax
+  802c69:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802c6e:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c70:	83 c2 01             	add    $0x1,%edx
+  802c73:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802c79:	0f 87 fa 00 00 00    	ja     802d79 <lru+0x145>
+		++num_searched_ptes;
+  802c7f:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c82:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802c85:	01 d0                	add    %edx,%eax
+  802c87:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802c8c:	89 c1                	mov    %eax,%ecx
+  802c8e:	c1 e9 0a             	shr    $0xa,%ecx
+  802c91:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802c98:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802c9e:	83 f9 01             	cmp    $0x1,%ecx
+  802ca1:	75 c4                	jne    802c67 <lru+0x33>
+  802ca3:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802ca8:	77 bd                	ja     802c67 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802caa:	89 c1                	mov    %eax,%ecx
+  802cac:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802caf:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802cb5:	0f 87 92 00 00 00    	ja     802d4d <lru+0x119>
+  802cbb:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802cc1:	0f 82 86 00 00 00    	jb     802d4d <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802cc7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802cce:	f6 c1 01             	test   $0x1,%cl
+  802cd1:	74 7a                	je     802d4d <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802cd3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802cda:	f6 c5 04             	test   $0x4,%ch
+  802cdd:	75 6e                	jne    802d4d <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802cdf:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802ce6:	f6 c5 02             	test   $0x2,%ch
+  802ce9:	75 62                	jne    802d4d <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802ceb:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802cf2:	c1 e9 0c             	shr    $0xc,%ecx
+  802cf5:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802cf8:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802cfe:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802d02:	66 83 f9 01          	cmp    $0x1,%cx
+  802d06:	77 45                	ja     802d4d <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  802d08:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d0f:	c1 e9 0c             	shr    $0xc,%ecx
+  802d12:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d15:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d1b:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802d1e:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802d21:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  802d24:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802d27:	19 df                	sbb    %ebx,%edi
+  802d29:	7c 22                	jl     802d4d <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  802d2b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d32:	c1 e9 0c             	shr    $0xc,%ecx
+  802d35:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d38:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d3e:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802d41:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802d44:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802d47:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d4a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802d4d:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  802d50:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802d57:	df 6d e0             	fildll -0x20(%ebp)
+  802d5a:	d9 05 14 58 80 00    	flds   0x805814
+  802d60:	d9 c9                	fxch   %st(1)
+  802d62:	df f1                	fcomip %st(1),%st
+  802d64:	dd d8                	fstp   %st(0)
+  802d66:	0f 82 04 ff ff ff    	jb     802c70 <lru+0x3c>
+			pgnum = pgnum_actual;
+  802d6c:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  802d71:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d74:	c1 e0 0c             	shl    $0xc,%eax
+  802d77:	eb 06                	jmp    802d7f <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  802d79:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d7c:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802d7f:	83 c4 1c             	add    $0x1c,%esp
+  802d82:	5b                   	pop    %ebx
+  802d83:	5e                   	pop    %esi
+  802d84:	5f                   	pop    %edi
+  802d85:	5d                   	pop    %ebp
+  802d86:	c3                   	ret
+
+00802d87 <set_page_choice_func>:
+{
+  802d87:	55                   	push   %ebp
+  802d88:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  802d8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d8d:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  802d92:	5d                   	pop    %ebp
+  802d93:	c3                   	ret
+
+00802d94 <get_page_choice>:
+{
+  802d94:	55                   	push   %ebp
+  802d95:	89 e5                	mov    %esp,%ebp
+  802d97:	57                   	push   %edi
+  802d98:	56                   	push   %esi
+  802d99:	53                   	push   %ebx
+  802d9a:	83 ec 24             	sub    $0x24,%esp
+  802d9d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802da0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  802da3:	57                   	push   %edi
+  802da4:	56                   	push   %esi
+  802da5:	ff 15 3c 60 80 00    	call   *0x80603c
+  802dab:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802dad:	83 c4 10             	add    $0x10,%esp
+  802db0:	eb 25                	jmp    802dd7 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  802db2:	83 ec 08             	sub    $0x8,%esp
+  802db5:	c1 e0 16             	shl    $0x16,%eax
+  802db8:	50                   	push   %eax
+  802db9:	6a 00                	push   $0x0
+  802dbb:	e8 ec e0 ff ff       	call   800eac <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802dc0:	83 c4 10             	add    $0x10,%esp
+  802dc3:	85 c0                	test   %eax,%eax
+  802dc5:	75 43                	jne    802e0a <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  802dc7:	83 ec 08             	sub    $0x8,%esp
+  802dca:	57                   	push   %edi
+  802dcb:	56                   	push   %esi
+  802dcc:	ff 15 3c 60 80 00    	call   *0x80603c
+  802dd2:	89 c3                	mov    %eax,%ebx
+  802dd4:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802dd7:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802dda:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  802de0:	0f 86 ae 00 00 00    	jbe    802e94 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802de6:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  802deb:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802df2:	81 e2 81 00 00 00    	and    $0x81,%edx
+  802df8:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  802dfe:	74 b2                	je     802db2 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802e00:	83 c0 01             	add    $0x1,%eax
+  802e03:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  802e08:	75 e1                	jne    802deb <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802e0a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e0d:	05 00 10 40 11       	add    $0x11401000,%eax
+  802e12:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802e17:	76 1f                	jbe    802e38 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  802e19:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  802e1e:	89 d8                	mov    %ebx,%eax
+  802e20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e23:	5b                   	pop    %ebx
+  802e24:	5e                   	pop    %esi
+  802e25:	5f                   	pop    %edi
+  802e26:	5d                   	pop    %ebp
+  802e27:	c3                   	ret
+		sys_page_split(0, pg_out);
+  802e28:	83 ec 08             	sub    $0x8,%esp
+  802e2b:	53                   	push   %ebx
+  802e2c:	6a 00                	push   $0x0
+  802e2e:	e8 79 e0 ff ff       	call   800eac <sys_page_split>
+  802e33:	83 c4 10             	add    $0x10,%esp
+  802e36:	eb 6c                	jmp    802ea4 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  802e38:	83 ec 04             	sub    $0x4,%esp
+  802e3b:	68 bc 53 80 00       	push   $0x8053bc
+  802e40:	68 cc 01 00 00       	push   $0x1cc
+  802e45:	68 2a 53 80 00       	push   $0x80532a
+  802e4a:	e8 e1 d3 ff ff       	call   800230 <_panic>
+		panic("We tried to page out code pages\n");
+  802e4f:	83 ec 04             	sub    $0x4,%esp
+  802e52:	68 ec 53 80 00       	push   $0x8053ec
+  802e57:	68 d6 01 00 00       	push   $0x1d6
+  802e5c:	68 2a 53 80 00       	push   $0x80532a
+  802e61:	e8 ca d3 ff ff       	call   800230 <_panic>
+		panic("Invalid mapping for the va\n");
+  802e66:	83 ec 04             	sub    $0x4,%esp
+  802e69:	68 37 53 80 00       	push   $0x805337
+  802e6e:	68 da 01 00 00       	push   $0x1da
+  802e73:	68 2a 53 80 00       	push   $0x80532a
+  802e78:	e8 b3 d3 ff ff       	call   800230 <_panic>
+		panic("We tried to page out a shared page\n");
+  802e7d:	83 ec 04             	sub    $0x4,%esp
+  802e80:	68 10 54 80 00       	push   $0x805410
+  802e85:	68 e0 01 00 00       	push   $0x1e0
+  802e8a:	68 2a 53 80 00       	push   $0x80532a
+  802e8f:	e8 9c d3 ff ff       	call   800230 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  802e94:	89 de                	mov    %ebx,%esi
+  802e96:	c1 ee 16             	shr    $0x16,%esi
+  802e99:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802ea0:	a8 80                	test   $0x80,%al
+  802ea2:	75 84                	jne    802e28 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802ea4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ea7:	05 00 10 40 11       	add    $0x11401000,%eax
+  802eac:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802eb1:	76 85                	jbe    802e38 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  802eb3:	89 d8                	mov    %ebx,%eax
+  802eb5:	e8 7e f3 ff ff       	call   802238 <page_is_clean>
+  802eba:	84 c0                	test   %al,%al
+  802ebc:	0f 85 5c ff ff ff    	jne    802e1e <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  802ec2:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  802ec9:	76 84                	jbe    802e4f <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  802ecb:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802ed2:	a8 01                	test   $0x1,%al
+  802ed4:	74 90                	je     802e66 <get_page_choice+0xd2>
+  802ed6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ed9:	c1 e8 0c             	shr    $0xc,%eax
+  802edc:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802ee3:	f6 c2 01             	test   $0x1,%dl
+  802ee6:	0f 84 7a ff ff ff    	je     802e66 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802eec:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  802ef3:	f6 c2 01             	test   $0x1,%dl
+  802ef6:	74 85                	je     802e7d <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802ef8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802eff:	f6 c2 01             	test   $0x1,%dl
+  802f02:	0f 84 75 ff ff ff    	je     802e7d <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802f08:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802f0f:	f6 c6 04             	test   $0x4,%dh
+  802f12:	0f 85 65 ff ff ff    	jne    802e7d <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  802f18:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802f1f:	f6 c6 02             	test   $0x2,%dh
+  802f22:	0f 85 55 ff ff ff    	jne    802e7d <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  802f28:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f2f:	c1 e8 0c             	shr    $0xc,%eax
+  802f32:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802f35:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802f3a:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802f3e:	66 83 f8 01          	cmp    $0x1,%ax
+  802f42:	0f 86 d6 fe ff ff    	jbe    802e1e <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  802f48:	83 ec 04             	sub    $0x4,%esp
+  802f4b:	68 34 54 80 00       	push   $0x805434
+  802f50:	68 e2 01 00 00       	push   $0x1e2
+  802f55:	68 2a 53 80 00       	push   $0x80532a
+  802f5a:	e8 d1 d2 ff ff       	call   800230 <_panic>
+
+00802f5f <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  802f5f:	55                   	push   %ebp
+  802f60:	89 e5                	mov    %esp,%ebp
+  802f62:	57                   	push   %edi
+  802f63:	56                   	push   %esi
+  802f64:	53                   	push   %ebx
+  802f65:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  802f68:	e8 e8 f6 ff ff       	call   802655 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  802f6d:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802f72:	85 c0                	test   %eax,%eax
+  802f74:	74 41                	je     802fb7 <page_share_paged_out+0x58>
+  802f76:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  802f7d:	0f 84 fd 00 00 00    	je     803080 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  802f83:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802f8a:	00 00 00 
+  802f8d:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  802f94:	00 00 00 
+  802f97:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f9c:	eb 2c                	jmp    802fca <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802f9e:	83 c3 04             	add    $0x4,%ebx
+  802fa1:	39 f3                	cmp    %esi,%ebx
+  802fa3:	74 1a                	je     802fbf <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  802fa5:	8b 03                	mov    (%ebx),%eax
+  802fa7:	a8 01                	test   $0x1,%al
+  802fa9:	74 f3                	je     802f9e <page_share_paged_out+0x3f>
+  802fab:	c1 e8 0c             	shr    $0xc,%eax
+  802fae:	e8 2b f5 ff ff       	call   8024de <page_share_slot>
+  802fb3:	85 c0                	test   %eax,%eax
+  802fb5:	79 e7                	jns    802f9e <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  802fb7:	83 c4 0c             	add    $0xc,%esp
+  802fba:	5b                   	pop    %ebx
+  802fbb:	5e                   	pop    %esi
+  802fbc:	5f                   	pop    %edi
+  802fbd:	5d                   	pop    %ebp
+  802fbe:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  802fbf:	83 c7 04             	add    $0x4,%edi
+  802fc2:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  802fc8:	74 1b                	je     802fe5 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  802fca:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  802fcf:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  802fd2:	f6 c3 01             	test   $0x1,%bl
+  802fd5:	74 e8                	je     802fbf <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  802fd7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802fdd:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  802fe3:	eb bc                	jmp    802fa1 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802fe5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fea:	eb 11                	jmp    802ffd <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  802fec:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802ff2:	83 c3 01             	add    $0x1,%ebx
+  802ff5:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802ffb:	77 41                	ja     80303e <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  802ffd:	89 d8                	mov    %ebx,%eax
+  802fff:	c1 e8 0a             	shr    $0xa,%eax
+  803002:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803009:	25 81 00 00 00       	and    $0x81,%eax
+  80300e:	83 f8 01             	cmp    $0x1,%eax
+  803011:	75 d9                	jne    802fec <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803013:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80301a:	25 81 00 00 00       	and    $0x81,%eax
+  80301f:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803024:	75 cc                	jne    802ff2 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803026:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80302d:	c1 e8 0c             	shr    $0xc,%eax
+  803030:	e8 a9 f4 ff ff       	call   8024de <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803035:	85 c0                	test   %eax,%eax
+  803037:	79 b9                	jns    802ff2 <page_share_paged_out+0x93>
+  803039:	e9 79 ff ff ff       	jmp    802fb7 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80303e:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803045:	75 13                	jne    80305a <page_share_paged_out+0xfb>
+  803047:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80304e:	75 1d                	jne    80306d <page_share_paged_out+0x10e>
+	return 0;
+  803050:	b8 00 00 00 00       	mov    $0x0,%eax
+  803055:	e9 5d ff ff ff       	jmp    802fb7 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80305a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305f:	e8 46 f4 ff ff       	call   8024aa <page_share_send>
+  803064:	85 c0                	test   %eax,%eax
+  803066:	79 df                	jns    803047 <page_share_paged_out+0xe8>
+  803068:	e9 4a ff ff ff       	jmp    802fb7 <page_share_paged_out+0x58>
+  80306d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803072:	e8 33 f4 ff ff       	call   8024aa <page_share_send>
+  803077:	85 c0                	test   %eax,%eax
+  803079:	79 d5                	jns    803050 <page_share_paged_out+0xf1>
+  80307b:	e9 37 ff ff ff       	jmp    802fb7 <page_share_paged_out+0x58>
+		return 0;
+  803080:	b8 00 00 00 00       	mov    $0x0,%eax
+  803085:	e9 2d ff ff ff       	jmp    802fb7 <page_share_paged_out+0x58>
+
+0080308a <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  80308a:	55                   	push   %ebp
+  80308b:	89 e5                	mov    %esp,%ebp
+  80308d:	56                   	push   %esi
+  80308e:	53                   	push   %ebx
+  80308f:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  803092:	e8 be f5 ff ff       	call   802655 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  803097:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  80309c:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8030a3:	0f 84 82 00 00 00    	je     80312b <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  8030a9:	83 ec 0c             	sub    $0xc,%esp
+  8030ac:	68 00 10 00 00       	push   $0x1000
+  8030b1:	e8 84 11 00 00       	call   80423a <malloc>
+  8030b6:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  8030b8:	83 c4 0c             	add    $0xc,%esp
+  8030bb:	6a 14                	push   $0x14
+  8030bd:	6a 00                	push   $0x0
+  8030bf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8030c2:	50                   	push   %eax
+  8030c3:	e8 7b d9 ff ff       	call   800a43 <memset>
+  8030c8:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  8030cb:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  8030d0:	83 ec 0c             	sub    $0xc,%esp
+  8030d3:	6a 07                	push   $0x7
+  8030d5:	6a 01                	push   $0x1
+  8030d7:	53                   	push   %ebx
+  8030d8:	6a 03                	push   $0x3
+  8030da:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8030e1:	e8 b7 19 00 00       	call   804a9d <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  8030e6:	8b 03                	mov    (%ebx),%eax
+  8030e8:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  8030eb:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030ee:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  8030f1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8030f4:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  8030f7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8030fa:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  8030fd:	8b 43 10             	mov    0x10(%ebx),%eax
+  803100:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803103:	83 c6 01             	add    $0x1,%esi
+  803106:	83 c4 20             	add    $0x20,%esp
+  803109:	83 fe 02             	cmp    $0x2,%esi
+  80310c:	75 c2                	jne    8030d0 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  80310e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803111:	89 03                	mov    %eax,(%ebx)
+  803113:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803116:	89 43 04             	mov    %eax,0x4(%ebx)
+  803119:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80311c:	89 43 08             	mov    %eax,0x8(%ebx)
+  80311f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803122:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803125:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803128:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  80312b:	89 d8                	mov    %ebx,%eax
+  80312d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803130:	5b                   	pop    %ebx
+  803131:	5e                   	pop    %esi
+  803132:	5d                   	pop    %ebp
+  803133:	c3                   	ret
+
+00803134 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803134:	55                   	push   %ebp
+  803135:	89 e5                	mov    %esp,%ebp
+  803137:	53                   	push   %ebx
+  803138:	83 ec 10             	sub    $0x10,%esp
+  80313b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  80313e:	68 7f 4e 80 00       	push   $0x804e7f
+  803143:	e8 c3 d1 ff ff       	call   80030b <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  803148:	83 c4 08             	add    $0x8,%esp
+  80314b:	ff 33                	push   (%ebx)
+  80314d:	68 68 54 80 00       	push   $0x805468
+  803152:	e8 b4 d1 ff ff       	call   80030b <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  803157:	83 c4 08             	add    $0x8,%esp
+  80315a:	ff 73 04             	push   0x4(%ebx)
+  80315d:	68 53 53 80 00       	push   $0x805353
+  803162:	e8 a4 d1 ff ff       	call   80030b <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  803167:	83 c4 08             	add    $0x8,%esp
+  80316a:	ff 73 08             	push   0x8(%ebx)
+  80316d:	68 88 54 80 00       	push   $0x805488
+  803172:	e8 94 d1 ff ff       	call   80030b <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  803177:	83 c4 08             	add    $0x8,%esp
+  80317a:	ff 73 0c             	push   0xc(%ebx)
+  80317d:	68 ac 54 80 00       	push   $0x8054ac
+  803182:	e8 84 d1 ff ff       	call   80030b <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  803187:	83 c4 08             	add    $0x8,%esp
+  80318a:	ff 73 10             	push   0x10(%ebx)
+  80318d:	68 d0 54 80 00       	push   $0x8054d0
+  803192:	e8 74 d1 ff ff       	call   80030b <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  803197:	83 c4 08             	add    $0x8,%esp
+  80319a:	ff 35 08 b0 80 00    	push   0x80b008
+  8031a0:	68 0c 55 80 00       	push   $0x80550c
+  8031a5:	e8 61 d1 ff ff       	call   80030b <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  8031aa:	83 c4 08             	add    $0x8,%esp
+  8031ad:	ff 35 04 b0 80 00    	push   0x80b004
+  8031b3:	68 40 55 80 00       	push   $0x805540
+  8031b8:	e8 4e d1 ff ff       	call   80030b <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  8031bd:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8031c2:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  8031c5:	8b 50 68             	mov    0x68(%eax),%edx
+  8031c8:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  8031cb:	51                   	push   %ecx
+  8031cc:	52                   	push   %edx
+  8031cd:	50                   	push   %eax
+  8031ce:	68 80 55 80 00       	push   $0x805580
+  8031d3:	e8 33 d1 ff ff       	call   80030b <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  8031d8:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8031dd:	8b 40 70             	mov    0x70(%eax),%eax
+  8031e0:	83 c4 18             	add    $0x18,%esp
+  8031e3:	50                   	push   %eax
+  8031e4:	68 b4 55 80 00       	push   $0x8055b4
+  8031e9:	e8 1d d1 ff ff       	call   80030b <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  8031ee:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  8031f4:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  8031fa:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  8031ff:	51                   	push   %ecx
+  803200:	52                   	push   %edx
+  803201:	50                   	push   %eax
+  803202:	68 e4 55 80 00       	push   $0x8055e4
+  803207:	e8 ff d0 ff ff       	call   80030b <cprintf>
+	cprintf("\n");
+  80320c:	83 c4 14             	add    $0x14,%esp
+  80320f:	68 7f 4e 80 00       	push   $0x804e7f
+  803214:	e8 f2 d0 ff ff       	call   80030b <cprintf>
+}
+  803219:	83 c4 10             	add    $0x10,%esp
+  80321c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80321f:	c9                   	leave
+  803220:	c3                   	ret
+
+00803221 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  803221:	55                   	push   %ebp
+  803222:	89 e5                	mov    %esp,%ebp
+  803224:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  803227:	e8 5e fe ff ff       	call   80308a <get_paging_stats>
+  80322c:	83 ec 0c             	sub    $0xc,%esp
+  80322f:	50                   	push   %eax
+  803230:	e8 ff fe ff ff       	call   803134 <print_paging_stats>
+}
+  803235:	83 c4 10             	add    $0x10,%esp
+  803238:	c9                   	leave
+  803239:	c3                   	ret
+
+0080323a <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  80323a:	55                   	push   %ebp
+  80323b:	89 e5                	mov    %esp,%ebp
+  80323d:	53                   	push   %ebx
+  80323e:	83 ec 04             	sub    $0x4,%esp
+  803241:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803244:	eb 13                	jmp    803259 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803246:	83 ec 04             	sub    $0x4,%esp
+  803249:	6a ff                	push   $0xffffffff
+  80324b:	53                   	push   %ebx
+  80324c:	68 00 f0 ff ee       	push   $0xeefff000
+  803251:	e8 68 e0 ff ff       	call   8012be <sys_futex_wait>
+  803256:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803259:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  80325e:	39 d8                	cmp    %ebx,%eax
+  803260:	74 e4                	je     803246 <mem_pressure_wait+0xc>
+	return now;
+}
+  803262:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803265:	c9                   	leave
+  803266:	c3                   	ret
+
+00803267 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803267:	55                   	push   %ebp
+  803268:	89 e5                	mov    %esp,%ebp
+  80326a:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  80326d:	68 d9 3e 80 00       	push   $0x803ed9
+  803272:	e8 32 16 00 00       	call   8048a9 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803277:	c7 05 14 e9 80 00 00 	movl   $0xdeadb000,0x80e914
+  80327e:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  803281:	83 c4 0c             	add    $0xc,%esp
+  803284:	68 07 02 00 00       	push   $0x207
+  803289:	68 00 b0 ad de       	push   $0xdeadb000
+  80328e:	6a 00                	push   $0x0
+  803290:	e8 50 db ff ff       	call   800de5 <sys_page_alloc>
+  803295:	83 c4 10             	add    $0x10,%esp
+  803298:	85 c0                	test   %eax,%eax
+  80329a:	78 0c                	js     8032a8 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  80329c:	e8 b4 f3 ff ff       	call   802655 <find_paging_env>
+	page_ring_ready();
+  8032a1:	e8 7f f2 ff ff       	call   802525 <page_ring_ready>
+}
+  8032a6:	c9                   	leave
+  8032a7:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  8032a8:	50                   	push   %eax
+  8032a9:	68 71 53 80 00       	push   $0x805371
+  8032ae:	68 13 05 00 00       	push   $0x513
+  8032b3:	68 2a 53 80 00       	push   $0x80532a
+  8032b8:	e8 73 cf ff ff       	call   800230 <_panic>
+
+008032bd <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  8032bd:	55                   	push   %ebp
+  8032be:	89 e5                	mov    %esp,%ebp
+  8032c0:	57                   	push   %edi
+  8032c1:	56                   	push   %esi
+  8032c2:	53                   	push   %ebx
+  8032c3:	83 ec 0c             	sub    $0xc,%esp
+  8032c6:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  8032c9:	89 fa                	mov    %edi,%edx
+  8032cb:	c1 ea 16             	shr    $0x16,%edx
+  8032ce:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8032d3:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  8032d6:	f6 06 01             	testb  $0x1,(%esi)
+  8032d9:	75 3e                	jne    803319 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  8032db:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  8032e0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8032e4:	74 47                	je     80332d <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  8032e6:	83 ec 0c             	sub    $0xc,%esp
+  8032e9:	6a 01                	push   $0x1
+  8032eb:	e8 f2 11 00 00       	call   8044e2 <va_alloc>
+  8032f0:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  8032f2:	83 c4 10             	add    $0x10,%esp
+  8032f5:	85 c0                	test   %eax,%eax
+  8032f7:	74 34                	je     80332d <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  8032f9:	6a 00                	push   $0x0
+  8032fb:	68 07 02 00 00       	push   $0x207
+  803300:	50                   	push   %eax
+  803301:	6a 00                	push   $0x0
+  803303:	e8 df 02 00 00       	call   8035e7 <page_alloc>
+  803308:	83 c4 10             	add    $0x10,%esp
+  80330b:	85 c0                	test   %eax,%eax
+  80330d:	78 28                	js     803337 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  80330f:	f6 06 01             	testb  $0x1,(%esi)
+  803312:	75 38                	jne    80334c <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803314:	83 cb 01             	or     $0x1,%ebx
+  803317:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803319:	89 f8                	mov    %edi,%eax
+  80331b:	c1 e8 0a             	shr    $0xa,%eax
+  80331e:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803323:	8b 1e                	mov    (%esi),%ebx
+  803325:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  80332b:	01 c3                	add    %eax,%ebx
+}
+  80332d:	89 d8                	mov    %ebx,%eax
+  80332f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803332:	5b                   	pop    %ebx
+  803333:	5e                   	pop    %esi
+  803334:	5f                   	pop    %edi
+  803335:	5d                   	pop    %ebp
+  803336:	c3                   	ret
+			va_free(page, 1);
+  803337:	83 ec 08             	sub    $0x8,%esp
+  80333a:	6a 01                	push   $0x1
+  80333c:	53                   	push   %ebx
+  80333d:	e8 d8 12 00 00       	call   80461a <va_free>
+			return NULL;
+  803342:	83 c4 10             	add    $0x10,%esp
+  803345:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80334a:	eb e1                	jmp    80332d <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  80334c:	83 ec 08             	sub    $0x8,%esp
+  80334f:	53                   	push   %ebx
+  803350:	6a 00                	push   $0x0
+  803352:	e8 13 db ff ff       	call   800e6a <sys_page_unmap>
+			va_free(page, 1);
+  803357:	83 c4 08             	add    $0x8,%esp
+  80335a:	6a 01                	push   $0x1
+  80335c:	53                   	push   %ebx
+  80335d:	e8 b8 12 00 00       	call   80461a <va_free>
+  803362:	83 c4 10             	add    $0x10,%esp
+  803365:	eb b2                	jmp    803319 <umapdir_walk+0x5c>
+
+00803367 <page_out>:
+{
+  803367:	55                   	push   %ebp
+  803368:	89 e5                	mov    %esp,%ebp
+  80336a:	57                   	push   %edi
+  80336b:	56                   	push   %esi
+  80336c:	53                   	push   %ebx
+  80336d:	83 ec 5c             	sub    $0x5c,%esp
+  803370:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803373:	e8 dd f2 ff ff       	call   802655 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803378:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80337d:	85 c0                	test   %eax,%eax
+  80337f:	74 1e                	je     80339f <page_out+0x38>
+  803381:	83 ec 0c             	sub    $0xc,%esp
+  803384:	6a 00                	push   $0x0
+  803386:	6a 00                	push   $0x0
+  803388:	6a 00                	push   $0x0
+  80338a:	6a 08                	push   $0x8
+  80338c:	50                   	push   %eax
+  80338d:	e8 0b 17 00 00       	call   804a9d <ipc_call>
+  803392:	89 c3                	mov    %eax,%ebx
+  803394:	83 c4 20             	add    $0x20,%esp
+  803397:	85 c0                	test   %eax,%eax
+  803399:	0f 84 ac 00 00 00    	je     80344b <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  80339f:	83 ec 08             	sub    $0x8,%esp
+  8033a2:	ff 75 0c             	push   0xc(%ebp)
+  8033a5:	57                   	push   %edi
+  8033a6:	e8 e9 f9 ff ff       	call   802d94 <get_page_choice>
+  8033ab:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  8033ad:	83 c4 10             	add    $0x10,%esp
+  8033b0:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8033b5:	0f 84 18 02 00 00    	je     8035d3 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  8033bb:	e8 78 ee ff ff       	call   802238 <page_is_clean>
+  8033c0:	84 c0                	test   %al,%al
+  8033c2:	0f 85 8c 00 00 00    	jne    803454 <page_out+0xed>
+	if (pagingenv == 0)
+  8033c8:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8033cf:	0f 84 08 02 00 00    	je     8035dd <page_out+0x276>
+	if (page_ring_ready())
+  8033d5:	e8 4b f1 ff ff       	call   802525 <page_ring_ready>
+  8033da:	89 c3                	mov    %eax,%ebx
+  8033dc:	85 c0                	test   %eax,%eax
+  8033de:	0f 85 89 00 00 00    	jne    80346d <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  8033e4:	83 ec 0c             	sub    $0xc,%esp
+  8033e7:	6a 05                	push   $0x5
+  8033e9:	6a 01                	push   $0x1
+  8033eb:	56                   	push   %esi
+  8033ec:	6a 01                	push   $0x1
+  8033ee:	ff 35 40 b0 80 00    	push   0x80b040
+  8033f4:	e8 a4 16 00 00       	call   804a9d <ipc_call>
+  8033f9:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  8033fb:	83 c4 20             	add    $0x20,%esp
+  8033fe:	85 c0                	test   %eax,%eax
+  803400:	0f 88 b8 01 00 00    	js     8035be <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803406:	89 f0                	mov    %esi,%eax
+  803408:	c1 e8 0c             	shr    $0xc,%eax
+  80340b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803412:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803415:	83 ec 08             	sub    $0x8,%esp
+  803418:	56                   	push   %esi
+  803419:	6a 00                	push   $0x0
+  80341b:	e8 4a da ff ff       	call   800e6a <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803420:	83 c4 08             	add    $0x8,%esp
+  803423:	6a 01                	push   $0x1
+  803425:	56                   	push   %esi
+  803426:	e8 92 fe ff ff       	call   8032bd <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  80342b:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  80342e:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803434:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803437:	09 fe                	or     %edi,%esi
+  803439:	83 ce 01             	or     $0x1,%esi
+  80343c:	89 30                	mov    %esi,(%eax)
+	return 0;
+  80343e:	83 c4 10             	add    $0x10,%esp
+}
+  803441:	89 d8                	mov    %ebx,%eax
+  803443:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803446:	5b                   	pop    %ebx
+  803447:	5e                   	pop    %esi
+  803448:	5f                   	pop    %edi
+  803449:	5d                   	pop    %ebp
+  80344a:	c3                   	ret
+		num_page_reclaims++;
+  80344b:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  803452:	eb ed                	jmp    803441 <page_out+0xda>
+		num_page_drops++;
+  803454:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  80345b:	83 ec 08             	sub    $0x8,%esp
+  80345e:	56                   	push   %esi
+  80345f:	6a 00                	push   $0x0
+  803461:	e8 04 da ff ff       	call   800e6a <sys_page_unmap>
+  803466:	89 c3                	mov    %eax,%ebx
+  803468:	83 c4 10             	add    $0x10,%esp
+  80346b:	eb d4                	jmp    803441 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80346d:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  80346f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803474:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803479:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  80347c:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  80347e:	83 c0 08             	add    $0x8,%eax
+  803481:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803484:	b8 07 00 00 00       	mov    $0x7,%eax
+  803489:	e8 e5 ef ff ff       	call   802473 <page_ring_reserve>
+	first = ring->sq_tail;
+  80348e:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803493:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803496:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  80349b:	83 ec 04             	sub    $0x4,%esp
+  80349e:	68 00 10 00 00       	push   $0x1000
+  8034a3:	56                   	push   %esi
+  8034a4:	89 d8                	mov    %ebx,%eax
+  8034a6:	c1 e0 0c             	shl    $0xc,%eax
+  8034a9:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  8034ae:	50                   	push   %eax
+  8034af:	e8 26 d6 ff ff       	call   800ada <memcpy>
+		vas[n] = va;
+  8034b4:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  8034b8:	89 d9                	mov    %ebx,%ecx
+  8034ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034c4:	e8 de ee ff ff       	call   8023a7 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  8034c9:	8d 43 01             	lea    0x1(%ebx),%eax
+  8034cc:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  8034cf:	83 c4 10             	add    $0x10,%esp
+  8034d2:	83 fb 06             	cmp    $0x6,%ebx
+  8034d5:	74 62                	je     803539 <page_out+0x1d2>
+  8034d7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8034da:	eb 15                	jmp    8034f1 <page_out+0x18a>
+			num_page_drops++;
+  8034dc:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  8034e3:	83 ec 08             	sub    $0x8,%esp
+  8034e6:	56                   	push   %esi
+  8034e7:	6a 00                	push   $0x0
+  8034e9:	e8 7c d9 ff ff       	call   800e6a <sys_page_unmap>
+  8034ee:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  8034f1:	83 ec 08             	sub    $0x8,%esp
+  8034f4:	53                   	push   %ebx
+  8034f5:	57                   	push   %edi
+  8034f6:	e8 99 f8 ff ff       	call   802d94 <get_page_choice>
+  8034fb:	89 c6                	mov    %eax,%esi
+  8034fd:	83 c4 10             	add    $0x10,%esp
+  803500:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803505:	74 32                	je     803539 <page_out+0x1d2>
+  803507:	e8 2c ed ff ff       	call   802238 <page_is_clean>
+  80350c:	84 c0                	test   %al,%al
+  80350e:	75 cc                	jne    8034dc <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803510:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803513:	39 c6                	cmp    %eax,%esi
+  803515:	72 07                	jb     80351e <page_out+0x1b7>
+  803517:	8b 45 98             	mov    -0x68(%ebp),%eax
+  80351a:	39 c6                	cmp    %eax,%esi
+  80351c:	72 1b                	jb     803539 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  80351e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803523:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803526:	eb 03                	jmp    80352b <page_out+0x1c4>
+  803528:	83 c3 01             	add    $0x1,%ebx
+  80352b:	39 da                	cmp    %ebx,%edx
+  80352d:	0f 84 68 ff ff ff    	je     80349b <page_out+0x134>
+  803533:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803537:	75 ef                	jne    803528 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803539:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  80353c:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  80353f:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803542:	e8 a6 ee ff ff       	call   8023ed <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803547:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80354c:	eb 42                	jmp    803590 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  80354e:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803552:	89 f8                	mov    %edi,%eax
+  803554:	c1 e8 0c             	shr    $0xc,%eax
+  803557:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80355e:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803561:	83 ec 08             	sub    $0x8,%esp
+  803564:	57                   	push   %edi
+  803565:	6a 00                	push   $0x0
+  803567:	e8 fe d8 ff ff       	call   800e6a <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  80356c:	83 c4 08             	add    $0x8,%esp
+  80356f:	6a 01                	push   $0x1
+  803571:	57                   	push   %edi
+  803572:	e8 46 fd ff ff       	call   8032bd <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803577:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  80357a:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803580:	c1 e6 0c             	shl    $0xc,%esi
+  803583:	09 d6                	or     %edx,%esi
+  803585:	83 ce 01             	or     $0x1,%esi
+  803588:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  80358a:	83 c3 01             	add    $0x1,%ebx
+  80358d:	83 c4 10             	add    $0x10,%esp
+  803590:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803593:	39 c3                	cmp    %eax,%ebx
+  803595:	74 1d                	je     8035b4 <page_out+0x24d>
+		if (res[i] < 0)
+  803597:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  80359b:	85 f6                	test   %esi,%esi
+  80359d:	79 af                	jns    80354e <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  80359f:	56                   	push   %esi
+  8035a0:	68 14 56 80 00       	push   $0x805614
+  8035a5:	68 d1 02 00 00       	push   $0x2d1
+  8035aa:	68 2a 53 80 00       	push   $0x80532a
+  8035af:	e8 7c cc ff ff       	call   800230 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  8035b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035b9:	e9 83 fe ff ff       	jmp    803441 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  8035be:	50                   	push   %eax
+  8035bf:	68 14 56 80 00       	push   $0x805614
+  8035c4:	68 0a 03 00 00       	push   $0x30a
+  8035c9:	68 2a 53 80 00       	push   $0x80532a
+  8035ce:	e8 5d cc ff ff       	call   800230 <_panic>
+		return -E_NO_MEM;
+  8035d3:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  8035d8:	e9 64 fe ff ff       	jmp    803441 <page_out+0xda>
+		return -E_PAGING;
+  8035dd:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8035e2:	e9 5a fe ff ff       	jmp    803441 <page_out+0xda>
+
+008035e7 <page_alloc>:
+{
+  8035e7:	55                   	push   %ebp
+  8035e8:	89 e5                	mov    %esp,%ebp
+  8035ea:	57                   	push   %edi
+  8035eb:	56                   	push   %esi
+  8035ec:	53                   	push   %ebx
+  8035ed:	83 ec 0c             	sub    $0xc,%esp
+  8035f0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035f3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  8035f6:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  8035fd:	74 34                	je     803633 <page_alloc+0x4c>
+	if (check_mte)
+  8035ff:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803603:	75 35                	jne    80363a <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803605:	83 ec 04             	sub    $0x4,%esp
+  803608:	ff 75 10             	push   0x10(%ebp)
+  80360b:	56                   	push   %esi
+  80360c:	57                   	push   %edi
+  80360d:	e8 d3 d7 ff ff       	call   800de5 <sys_page_alloc>
+  803612:	89 c3                	mov    %eax,%ebx
+  803614:	83 c4 10             	add    $0x10,%esp
+  803617:	85 c0                	test   %eax,%eax
+  803619:	79 52                	jns    80366d <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  80361b:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80361e:	75 52                	jne    803672 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803620:	83 ec 08             	sub    $0x8,%esp
+  803623:	56                   	push   %esi
+  803624:	57                   	push   %edi
+  803625:	e8 3d fd ff ff       	call   803367 <page_out>
+  80362a:	83 c4 10             	add    $0x10,%esp
+  80362d:	85 c0                	test   %eax,%eax
+  80362f:	79 d4                	jns    803605 <page_alloc+0x1e>
+  803631:	eb 3f                	jmp    803672 <page_alloc+0x8b>
+		init_map_dir();
+  803633:	e8 2f fc ff ff       	call   803267 <init_map_dir>
+  803638:	eb c5                	jmp    8035ff <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  80363a:	83 ec 08             	sub    $0x8,%esp
+  80363d:	6a 00                	push   $0x0
+  80363f:	56                   	push   %esi
+  803640:	e8 78 fc ff ff       	call   8032bd <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803645:	83 c4 10             	add    $0x10,%esp
+  803648:	85 c0                	test   %eax,%eax
+  80364a:	74 b9                	je     803605 <page_alloc+0x1e>
+  80364c:	8b 10                	mov    (%eax),%edx
+  80364e:	f6 c2 01             	test   $0x1,%dl
+  803651:	74 b2                	je     803605 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803653:	83 ec 08             	sub    $0x8,%esp
+  803656:	56                   	push   %esi
+  803657:	52                   	push   %edx
+  803658:	50                   	push   %eax
+  803659:	68 38 56 80 00       	push   $0x805638
+  80365e:	68 34 03 00 00       	push   $0x334
+  803663:	68 2a 53 80 00       	push   $0x80532a
+  803668:	e8 c3 cb ff ff       	call   800230 <_panic>
+	return 0;
+  80366d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803672:	89 d8                	mov    %ebx,%eax
+  803674:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803677:	5b                   	pop    %ebx
+  803678:	5e                   	pop    %esi
+  803679:	5f                   	pop    %edi
+  80367a:	5d                   	pop    %ebp
+  80367b:	c3                   	ret
+
+0080367c <page_adopt>:
+{
+  80367c:	55                   	push   %ebp
+  80367d:	89 e5                	mov    %esp,%ebp
+  80367f:	56                   	push   %esi
+  803680:	53                   	push   %ebx
+  803681:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803683:	c1 e8 16             	shr    $0x16,%eax
+  803686:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80368d:	25 81 00 00 00       	and    $0x81,%eax
+  803692:	83 f8 01             	cmp    $0x1,%eax
+  803695:	75 53                	jne    8036ea <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803697:	89 d8                	mov    %ebx,%eax
+  803699:	c1 e8 0c             	shr    $0xc,%eax
+  80369c:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  8036a3:	89 f2                	mov    %esi,%edx
+  8036a5:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  8036ab:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  8036b0:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  8036b6:	75 37                	jne    8036ef <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  8036b8:	83 ec 08             	sub    $0x8,%esp
+  8036bb:	6a 01                	push   $0x1
+  8036bd:	53                   	push   %ebx
+  8036be:	e8 fa fb ff ff       	call   8032bd <umapdir_walk>
+  8036c3:	83 c4 10             	add    $0x10,%esp
+  8036c6:	85 c0                	test   %eax,%eax
+  8036c8:	74 2c                	je     8036f6 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  8036ca:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  8036d0:	83 ce 01             	or     $0x1,%esi
+  8036d3:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  8036d5:	83 ec 08             	sub    $0x8,%esp
+  8036d8:	53                   	push   %ebx
+  8036d9:	6a 00                	push   $0x0
+  8036db:	e8 8a d7 ff ff       	call   800e6a <sys_page_unmap>
+	return 1;
+  8036e0:	83 c4 10             	add    $0x10,%esp
+  8036e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036e8:	eb 05                	jmp    8036ef <page_adopt+0x73>
+		return 0;
+  8036ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036f2:	5b                   	pop    %ebx
+  8036f3:	5e                   	pop    %esi
+  8036f4:	5d                   	pop    %ebp
+  8036f5:	c3                   	ret
+		return -E_NO_MEM;
+  8036f6:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8036fb:	eb f2                	jmp    8036ef <page_adopt+0x73>
+
+008036fd <page_forget>:
+{
+  8036fd:	55                   	push   %ebp
+  8036fe:	89 e5                	mov    %esp,%ebp
+  803700:	53                   	push   %ebx
+  803701:	83 ec 04             	sub    $0x4,%esp
+  803704:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803706:	e8 4a ef ff ff       	call   802655 <find_paging_env>
+	if (pagingenv == 0)
+  80370b:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803712:	74 39                	je     80374d <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803714:	89 d8                	mov    %ebx,%eax
+  803716:	c1 e8 16             	shr    $0x16,%eax
+  803719:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803720:	25 81 00 00 00       	and    $0x81,%eax
+  803725:	83 f8 01             	cmp    $0x1,%eax
+  803728:	74 28                	je     803752 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  80372a:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803731:	74 1a                	je     80374d <page_forget+0x50>
+  803733:	83 ec 08             	sub    $0x8,%esp
+  803736:	6a 00                	push   $0x0
+  803738:	53                   	push   %ebx
+  803739:	e8 7f fb ff ff       	call   8032bd <umapdir_walk>
+  80373e:	89 c3                	mov    %eax,%ebx
+  803740:	83 c4 10             	add    $0x10,%esp
+  803743:	85 c0                	test   %eax,%eax
+  803745:	74 06                	je     80374d <page_forget+0x50>
+  803747:	8b 00                	mov    (%eax),%eax
+  803749:	a8 01                	test   $0x1,%al
+  80374b:	75 2b                	jne    803778 <page_forget+0x7b>
+}
+  80374d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803750:	c9                   	leave
+  803751:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803752:	89 d8                	mov    %ebx,%eax
+  803754:	c1 e8 0c             	shr    $0xc,%eax
+  803757:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80375e:	89 c2                	mov    %eax,%edx
+  803760:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803766:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  80376c:	75 bc                	jne    80372a <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  80376e:	c1 e8 0c             	shr    $0xc,%eax
+  803771:	e8 5c ee ff ff       	call   8025d2 <page_remove_slot>
+		return;
+  803776:	eb d5                	jmp    80374d <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803778:	c1 e8 0c             	shr    $0xc,%eax
+  80377b:	e8 52 ee ff ff       	call   8025d2 <page_remove_slot>
+	*mte = 0;
+  803780:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803786:	eb c5                	jmp    80374d <page_forget+0x50>
+
+00803788 <page_unmap>:
+{
+  803788:	55                   	push   %ebp
+  803789:	89 e5                	mov    %esp,%ebp
+  80378b:	57                   	push   %edi
+  80378c:	56                   	push   %esi
+  80378d:	53                   	push   %ebx
+  80378e:	83 ec 0c             	sub    $0xc,%esp
+  803791:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803794:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803797:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80379c:	8b 40 48             	mov    0x48(%eax),%eax
+  80379f:	85 db                	test   %ebx,%ebx
+  8037a1:	0f 8e b4 00 00 00    	jle    80385b <page_unmap+0xd3>
+  8037a7:	39 d8                	cmp    %ebx,%eax
+  8037a9:	0f 84 ac 00 00 00    	je     80385b <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  8037af:	83 ec 08             	sub    $0x8,%esp
+  8037b2:	57                   	push   %edi
+  8037b3:	53                   	push   %ebx
+  8037b4:	e8 b1 d6 ff ff       	call   800e6a <sys_page_unmap>
+  8037b9:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  8037bb:	e8 95 ee ff ff       	call   802655 <find_paging_env>
+	if (pagingenv == 0)
+  8037c0:	83 c4 10             	add    $0x10,%esp
+  8037c3:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8037ca:	0f 84 a1 00 00 00    	je     803871 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8037d0:	83 ec 0c             	sub    $0xc,%esp
+  8037d3:	6a 05                	push   $0x5
+  8037d5:	68 00 00 40 00       	push   $0x400000
+  8037da:	6a 00                	push   $0x0
+  8037dc:	68 00 b0 ad de       	push   $0xdeadb000
+  8037e1:	53                   	push   %ebx
+  8037e2:	e8 41 d6 ff ff       	call   800e28 <sys_page_map>
+  8037e7:	83 c4 20             	add    $0x20,%esp
+  8037ea:	85 c0                	test   %eax,%eax
+  8037ec:	0f 88 89 00 00 00    	js     80387b <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  8037f2:	89 f8                	mov    %edi,%eax
+  8037f4:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8037f7:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  8037fe:	a8 01                	test   $0x1,%al
+  803800:	74 6f                	je     803871 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803802:	83 ec 0c             	sub    $0xc,%esp
+  803805:	6a 05                	push   $0x5
+  803807:	68 00 00 40 00       	push   $0x400000
+  80380c:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  80380e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803813:	50                   	push   %eax
+  803814:	53                   	push   %ebx
+  803815:	e8 0e d6 ff ff       	call   800e28 <sys_page_map>
+  80381a:	83 c4 20             	add    $0x20,%esp
+  80381d:	85 c0                	test   %eax,%eax
+  80381f:	78 6f                	js     803890 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803821:	c1 ef 0c             	shr    $0xc,%edi
+  803824:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  80382a:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803831:	01 
+  803832:	74 3d                	je     803871 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803834:	83 ec 08             	sub    $0x8,%esp
+  803837:	68 00 00 40 00       	push   $0x400000
+  80383c:	6a 00                	push   $0x0
+  80383e:	e8 27 d6 ff ff       	call   800e6a <sys_page_unmap>
+  803843:	83 c4 10             	add    $0x10,%esp
+  803846:	85 c0                	test   %eax,%eax
+  803848:	78 5b                	js     8038a5 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  80384a:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803851:	c1 e8 0c             	shr    $0xc,%eax
+  803854:	e8 79 ed ff ff       	call   8025d2 <page_remove_slot>
+	return r;
+  803859:	eb 16                	jmp    803871 <page_unmap+0xe9>
+		page_forget(va);
+  80385b:	89 f8                	mov    %edi,%eax
+  80385d:	e8 9b fe ff ff       	call   8036fd <page_forget>
+		return sys_page_unmap(envid, va);
+  803862:	83 ec 08             	sub    $0x8,%esp
+  803865:	57                   	push   %edi
+  803866:	53                   	push   %ebx
+  803867:	e8 fe d5 ff ff       	call   800e6a <sys_page_unmap>
+  80386c:	89 c6                	mov    %eax,%esi
+  80386e:	83 c4 10             	add    $0x10,%esp
+}
+  803871:	89 f0                	mov    %esi,%eax
+  803873:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803876:	5b                   	pop    %ebx
+  803877:	5e                   	pop    %esi
+  803878:	5f                   	pop    %edi
+  803879:	5d                   	pop    %ebp
+  80387a:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  80387b:	50                   	push   %eax
+  80387c:	68 74 56 80 00       	push   $0x805674
+  803881:	68 e4 03 00 00       	push   $0x3e4
+  803886:	68 2a 53 80 00       	push   $0x80532a
+  80388b:	e8 a0 c9 ff ff       	call   800230 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803890:	50                   	push   %eax
+  803891:	68 a0 56 80 00       	push   $0x8056a0
+  803896:	68 ea 03 00 00       	push   $0x3ea
+  80389b:	68 2a 53 80 00       	push   $0x80532a
+  8038a0:	e8 8b c9 ff ff       	call   800230 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  8038a5:	50                   	push   %eax
+  8038a6:	68 cc 56 80 00       	push   $0x8056cc
+  8038ab:	68 ef 03 00 00       	push   $0x3ef
+  8038b0:	68 2a 53 80 00       	push   $0x80532a
+  8038b5:	e8 76 c9 ff ff       	call   800230 <_panic>
+
+008038ba <page_unmap_range>:
+{
+  8038ba:	55                   	push   %ebp
+  8038bb:	89 e5                	mov    %esp,%ebp
+  8038bd:	57                   	push   %edi
+  8038be:	56                   	push   %esi
+  8038bf:	53                   	push   %ebx
+  8038c0:	83 ec 0c             	sub    $0xc,%esp
+  8038c3:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  8038c6:	e8 8a ed ff ff       	call   802655 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  8038cb:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8038d0:	8b 40 48             	mov    0x48(%eax),%eax
+  8038d3:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8038d7:	7e 38                	jle    803911 <page_unmap_range+0x57>
+  8038d9:	3b 45 08             	cmp    0x8(%ebp),%eax
+  8038dc:	74 33                	je     803911 <page_unmap_range+0x57>
+  8038de:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8038e5:	74 2a                	je     803911 <page_unmap_range+0x57>
+  8038e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  8038ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8038ef:	39 fe                	cmp    %edi,%esi
+  8038f1:	74 56                	je     803949 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  8038f3:	83 ec 08             	sub    $0x8,%esp
+  8038f6:	53                   	push   %ebx
+  8038f7:	ff 75 08             	push   0x8(%ebp)
+  8038fa:	e8 89 fe ff ff       	call   803788 <page_unmap>
+  8038ff:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803905:	83 c4 10             	add    $0x10,%esp
+  803908:	85 c0                	test   %eax,%eax
+  80390a:	78 35                	js     803941 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  80390c:	83 c6 01             	add    $0x1,%esi
+  80390f:	eb de                	jmp    8038ef <page_unmap_range+0x35>
+  803911:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803914:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803919:	eb 10                	jmp    80392b <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  80391b:	89 f0                	mov    %esi,%eax
+  80391d:	e8 db fd ff ff       	call   8036fd <page_forget>
+		for (i = 0; i < npages; i++)
+  803922:	83 c3 01             	add    $0x1,%ebx
+  803925:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80392b:	39 fb                	cmp    %edi,%ebx
+  80392d:	75 ec                	jne    80391b <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  80392f:	83 ec 04             	sub    $0x4,%esp
+  803932:	57                   	push   %edi
+  803933:	ff 75 0c             	push   0xc(%ebp)
+  803936:	ff 75 08             	push   0x8(%ebp)
+  803939:	e8 40 d6 ff ff       	call   800f7e <sys_page_unmap_range>
+  80393e:	83 c4 10             	add    $0x10,%esp
+}
+  803941:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803944:	5b                   	pop    %ebx
+  803945:	5e                   	pop    %esi
+  803946:	5f                   	pop    %edi
+  803947:	5d                   	pop    %ebp
+  803948:	c3                   	ret
+	return 0;
+  803949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394e:	eb f1                	jmp    803941 <page_unmap_range+0x87>
+
+00803950 <page_alloc_range>:
+{
+  803950:	55                   	push   %ebp
+  803951:	89 e5                	mov    %esp,%ebp
+  803953:	57                   	push   %edi
+  803954:	56                   	push   %esi
+  803955:	53                   	push   %ebx
+  803956:	83 ec 1c             	sub    $0x1c,%esp
+  803959:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80395c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  80395f:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803966:	74 14                	je     80397c <page_alloc_range+0x2c>
+	if (check_mte)
+  803968:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80396c:	74 66                	je     8039d4 <page_alloc_range+0x84>
+  80396e:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  803970:	b8 00 00 00 00       	mov    $0x0,%eax
+  803975:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803978:	89 c7                	mov    %eax,%edi
+  80397a:	eb 10                	jmp    80398c <page_alloc_range+0x3c>
+		init_map_dir();
+  80397c:	e8 e6 f8 ff ff       	call   803267 <init_map_dir>
+  803981:	eb e5                	jmp    803968 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803983:	83 c7 01             	add    $0x1,%edi
+  803986:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80398c:	39 df                	cmp    %ebx,%edi
+  80398e:	74 38                	je     8039c8 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  803990:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803993:	83 ec 08             	sub    $0x8,%esp
+  803996:	6a 00                	push   $0x0
+  803998:	56                   	push   %esi
+  803999:	e8 1f f9 ff ff       	call   8032bd <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  80399e:	83 c4 10             	add    $0x10,%esp
+  8039a1:	85 c0                	test   %eax,%eax
+  8039a3:	74 de                	je     803983 <page_alloc_range+0x33>
+  8039a5:	8b 10                	mov    (%eax),%edx
+  8039a7:	f6 c2 01             	test   $0x1,%dl
+  8039aa:	74 d7                	je     803983 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  8039ac:	83 ec 08             	sub    $0x8,%esp
+  8039af:	ff 75 e4             	push   -0x1c(%ebp)
+  8039b2:	52                   	push   %edx
+  8039b3:	50                   	push   %eax
+  8039b4:	68 38 56 80 00       	push   $0x805638
+  8039b9:	68 0b 04 00 00       	push   $0x40b
+  8039be:	68 2a 53 80 00       	push   $0x80532a
+  8039c3:	e8 68 c8 ff ff       	call   800230 <_panic>
+  8039c8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8039cb:	eb 07                	jmp    8039d4 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  8039cd:	c1 e0 0c             	shl    $0xc,%eax
+  8039d0:	01 c7                	add    %eax,%edi
+			npages -= r;
+  8039d2:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  8039d4:	85 db                	test   %ebx,%ebx
+  8039d6:	74 30                	je     803a08 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  8039d8:	ff 75 14             	push   0x14(%ebp)
+  8039db:	53                   	push   %ebx
+  8039dc:	57                   	push   %edi
+  8039dd:	ff 75 08             	push   0x8(%ebp)
+  8039e0:	e8 2b d5 ff ff       	call   800f10 <sys_page_alloc_range>
+  8039e5:	89 c6                	mov    %eax,%esi
+  8039e7:	83 c4 10             	add    $0x10,%esp
+  8039ea:	85 c0                	test   %eax,%eax
+  8039ec:	7f df                	jg     8039cd <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  8039ee:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8039f1:	75 1a                	jne    803a0d <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  8039f3:	83 ec 08             	sub    $0x8,%esp
+  8039f6:	57                   	push   %edi
+  8039f7:	ff 75 08             	push   0x8(%ebp)
+  8039fa:	e8 68 f9 ff ff       	call   803367 <page_out>
+  8039ff:	83 c4 10             	add    $0x10,%esp
+  803a02:	85 c0                	test   %eax,%eax
+  803a04:	79 ce                	jns    8039d4 <page_alloc_range+0x84>
+  803a06:	eb 05                	jmp    803a0d <page_alloc_range+0xbd>
+	return 0;
+  803a08:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803a0d:	89 f0                	mov    %esi,%eax
+  803a0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a12:	5b                   	pop    %ebx
+  803a13:	5e                   	pop    %esi
+  803a14:	5f                   	pop    %edi
+  803a15:	5d                   	pop    %ebp
+  803a16:	c3                   	ret
+
+00803a17 <page_in>:
+{
+  803a17:	55                   	push   %ebp
+  803a18:	89 e5                	mov    %esp,%ebp
+  803a1a:	57                   	push   %edi
+  803a1b:	56                   	push   %esi
+  803a1c:	53                   	push   %ebx
+  803a1d:	83 ec 3c             	sub    $0x3c,%esp
+  803a20:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  803a23:	e8 2d ec ff ff       	call   802655 <find_paging_env>
+	if (pagingenv == 0)
+  803a28:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803a2f:	0f 84 09 02 00 00    	je     803c3e <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  803a35:	83 ec 08             	sub    $0x8,%esp
+  803a38:	6a 00                	push   $0x0
+  803a3a:	56                   	push   %esi
+  803a3b:	e8 7d f8 ff ff       	call   8032bd <umapdir_walk>
+  803a40:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803a42:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803a48:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  803a4b:	83 c4 10             	add    $0x10,%esp
+  803a4e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803a52:	74 0d                	je     803a61 <page_in+0x4a>
+  803a54:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803a59:	8b 40 48             	mov    0x48(%eax),%eax
+  803a5c:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803a5f:	75 06                	jne    803a67 <page_in+0x50>
+  803a61:	8b 03                	mov    (%ebx),%eax
+  803a63:	a8 02                	test   $0x2,%al
+  803a65:	75 63                	jne    803aca <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  803a67:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803a69:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803a6b:	89 f0                	mov    %esi,%eax
+  803a6d:	25 06 0e 00 00       	and    $0xe06,%eax
+  803a72:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803a75:	50                   	push   %eax
+  803a76:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803a79:	57                   	push   %edi
+  803a7a:	ff 75 08             	push   0x8(%ebp)
+  803a7d:	e8 65 fb ff ff       	call   8035e7 <page_alloc>
+  803a82:	83 c4 10             	add    $0x10,%esp
+  803a85:	85 c0                	test   %eax,%eax
+  803a87:	78 39                	js     803ac2 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  803a89:	89 f0                	mov    %esi,%eax
+  803a8b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803a8e:	83 ec 0c             	sub    $0xc,%esp
+  803a91:	6a 07                	push   $0x7
+  803a93:	6a 01                	push   $0x1
+  803a95:	57                   	push   %edi
+  803a96:	c1 e0 04             	shl    $0x4,%eax
+  803a99:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803a9a:	c1 ee 1c             	shr    $0x1c,%esi
+  803a9d:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803aa0:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803aa7:	e8 f1 0f 00 00       	call   804a9d <ipc_call>
+  803aac:	83 c4 20             	add    $0x20,%esp
+  803aaf:	85 c0                	test   %eax,%eax
+  803ab1:	0f 88 72 01 00 00    	js     803c29 <page_in+0x212>
+	*mte = 0;
+  803ab7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  803abd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ac2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ac5:	5b                   	pop    %ebx
+  803ac6:	5e                   	pop    %esi
+  803ac7:	5f                   	pop    %edi
+  803ac8:	5d                   	pop    %ebp
+  803ac9:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803aca:	25 06 0e 00 00       	and    $0xe06,%eax
+  803acf:	83 c8 01             	or     $0x1,%eax
+  803ad2:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  803ad5:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803ad8:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  803adb:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  803ae1:	be 01 00 00 00       	mov    $0x1,%esi
+  803ae6:	eb 46                	jmp    803b2e <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  803ae8:	83 ec 08             	sub    $0x8,%esp
+  803aeb:	6a 00                	push   $0x0
+  803aed:	51                   	push   %ecx
+  803aee:	e8 ca f7 ff ff       	call   8032bd <umapdir_walk>
+  803af3:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  803af7:	83 c4 10             	add    $0x10,%esp
+  803afa:	85 c0                	test   %eax,%eax
+  803afc:	74 66                	je     803b64 <page_in+0x14d>
+  803afe:	8b 00                	mov    (%eax),%eax
+  803b00:	a8 01                	test   $0x1,%al
+  803b02:	74 60                	je     803b64 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  803b04:	89 c2                	mov    %eax,%edx
+  803b06:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  803b0c:	83 ca 01             	or     $0x1,%edx
+  803b0f:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  803b12:	75 50                	jne    803b64 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  803b14:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803b1a:	c1 e8 1c             	shr    $0x1c,%eax
+  803b1d:	8b 13                	mov    (%ebx),%edx
+  803b1f:	c1 ea 1c             	shr    $0x1c,%edx
+  803b22:	39 d0                	cmp    %edx,%eax
+  803b24:	75 3e                	jne    803b64 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803b26:	83 c6 01             	add    $0x1,%esi
+  803b29:	83 fe 08             	cmp    $0x8,%esi
+  803b2c:	74 3f                	je     803b6d <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  803b2e:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803b30:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  803b36:	77 2c                	ja     803b64 <page_in+0x14d>
+  803b38:	89 f8                	mov    %edi,%eax
+  803b3a:	c1 e8 16             	shr    $0x16,%eax
+  803b3d:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803b44:	f6 c2 01             	test   $0x1,%dl
+  803b47:	74 9f                	je     803ae8 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803b49:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803b50:	a8 80                	test   $0x80,%al
+  803b52:	75 10                	jne    803b64 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803b54:	89 f8                	mov    %edi,%eax
+  803b56:	c1 e8 0c             	shr    $0xc,%eax
+  803b59:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b60:	a8 01                	test   $0x1,%al
+  803b62:	74 84                	je     803ae8 <page_in+0xd1>
+	if (n == 1)
+  803b64:	83 fe 01             	cmp    $0x1,%esi
+  803b67:	0f 84 fa fe ff ff    	je     803a67 <page_in+0x50>
+	req.nslots = n;
+  803b6d:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  803b73:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b78:	eb 13                	jmp    803b8d <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  803b7a:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  803b7e:	8b 12                	mov    (%edx),%edx
+  803b80:	c1 ea 0c             	shr    $0xc,%edx
+  803b83:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  803b8a:	83 c0 01             	add    $0x1,%eax
+  803b8d:	39 c6                	cmp    %eax,%esi
+  803b8f:	75 e9                	jne    803b7a <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  803b91:	83 ec 0c             	sub    $0xc,%esp
+  803b94:	6a 00                	push   $0x0
+  803b96:	ff 75 c0             	push   -0x40(%ebp)
+  803b99:	56                   	push   %esi
+  803b9a:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803b9d:	57                   	push   %edi
+  803b9e:	6a 00                	push   $0x0
+  803ba0:	e8 ab fd ff ff       	call   803950 <page_alloc_range>
+  803ba5:	83 c4 20             	add    $0x20,%esp
+  803ba8:	85 c0                	test   %eax,%eax
+  803baa:	78 6e                	js     803c1a <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  803bac:	83 ec 04             	sub    $0x4,%esp
+  803baf:	6a 24                	push   $0x24
+  803bb1:	68 00 80 80 00       	push   $0x808000
+  803bb6:	57                   	push   %edi
+  803bb7:	e8 bc ce ff ff       	call   800a78 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803bbc:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803bc3:	56                   	push   %esi
+  803bc4:	57                   	push   %edi
+  803bc5:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803bc7:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  803bce:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803bd1:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  803bd8:	e8 c0 0e 00 00       	call   804a9d <ipc_call>
+  803bdd:	83 c4 20             	add    $0x20,%esp
+  803be0:	85 c0                	test   %eax,%eax
+  803be2:	78 08                	js     803bec <page_in+0x1d5>
+  803be4:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  803be7:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  803bea:	eb 20                	jmp    803c0c <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  803bec:	50                   	push   %eax
+  803bed:	68 f8 56 80 00       	push   $0x8056f8
+  803bf2:	68 59 02 00 00       	push   $0x259
+  803bf7:	68 2a 53 80 00       	push   $0x80532a
+  803bfc:	e8 2f c6 ff ff       	call   800230 <_panic>
+		*mtes[i] = 0;
+  803c01:	8b 10                	mov    (%eax),%edx
+  803c03:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  803c09:	83 c0 04             	add    $0x4,%eax
+  803c0c:	39 c8                	cmp    %ecx,%eax
+  803c0e:	75 f1                	jne    803c01 <page_in+0x1ea>
+	return n;
+  803c10:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  803c12:	85 f6                	test   %esi,%esi
+  803c14:	0f 84 4d fe ff ff    	je     803a67 <page_in+0x50>
+		return r < 0 ? r : 0;
+  803c1a:	85 c0                	test   %eax,%eax
+  803c1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c21:	0f 4f c2             	cmovg  %edx,%eax
+  803c24:	e9 99 fe ff ff       	jmp    803ac2 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  803c29:	50                   	push   %eax
+  803c2a:	68 30 57 80 00       	push   $0x805730
+  803c2f:	68 9a 02 00 00       	push   $0x29a
+  803c34:	68 2a 53 80 00       	push   $0x80532a
+  803c39:	e8 f2 c5 ff ff       	call   800230 <_panic>
+		return -E_PAGING;
+  803c3e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803c43:	e9 7a fe ff ff       	jmp    803ac2 <page_in+0xab>
+
+00803c48 <page_map>:
+{
+  803c48:	55                   	push   %ebp
+  803c49:	89 e5                	mov    %esp,%ebp
+  803c4b:	57                   	push   %edi
+  803c4c:	56                   	push   %esi
+  803c4d:	53                   	push   %ebx
+  803c4e:	83 ec 1c             	sub    $0x1c,%esp
+  803c51:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803c54:	83 ec 0c             	sub    $0xc,%esp
+  803c57:	ff 75 18             	push   0x18(%ebp)
+  803c5a:	ff 75 14             	push   0x14(%ebp)
+  803c5d:	ff 75 10             	push   0x10(%ebp)
+  803c60:	ff 75 0c             	push   0xc(%ebp)
+  803c63:	56                   	push   %esi
+  803c64:	e8 bf d1 ff ff       	call   800e28 <sys_page_map>
+  803c69:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803c6c:	83 c4 20             	add    $0x20,%esp
+  803c6f:	85 c0                	test   %eax,%eax
+  803c71:	0f 89 a9 01 00 00    	jns    803e20 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  803c77:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  803c7b:	74 5f                	je     803cdc <page_map+0x94>
+		if (r != -E_INVAL)
+  803c7d:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  803c81:	0f 85 a0 01 00 00    	jne    803e27 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803c87:	85 f6                	test   %esi,%esi
+  803c89:	74 70                	je     803cfb <page_map+0xb3>
+  803c8b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803c90:	8b 40 48             	mov    0x48(%eax),%eax
+  803c93:	39 f0                	cmp    %esi,%eax
+  803c95:	74 64                	je     803cfb <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803c97:	83 ec 0c             	sub    $0xc,%esp
+  803c9a:	6a 05                	push   $0x5
+  803c9c:	68 00 00 40 00       	push   $0x400000
+  803ca1:	6a 00                	push   $0x0
+  803ca3:	68 00 b0 ad de       	push   $0xdeadb000
+  803ca8:	56                   	push   %esi
+  803ca9:	e8 7a d1 ff ff       	call   800e28 <sys_page_map>
+  803cae:	89 c3                	mov    %eax,%ebx
+  803cb0:	83 c4 20             	add    $0x20,%esp
+  803cb3:	85 c0                	test   %eax,%eax
+  803cb5:	79 6a                	jns    803d21 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  803cb7:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803cba:	75 50                	jne    803d0c <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  803cbc:	83 ec 08             	sub    $0x8,%esp
+  803cbf:	68 00 00 40 00       	push   $0x400000
+  803cc4:	6a fc                	push   $0xfffffffc
+  803cc6:	e8 9c f6 ff ff       	call   803367 <page_out>
+  803ccb:	83 c4 10             	add    $0x10,%esp
+  803cce:	85 c0                	test   %eax,%eax
+  803cd0:	79 c5                	jns    803c97 <page_map+0x4f>
+}
+  803cd2:	89 d8                	mov    %ebx,%eax
+  803cd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cd7:	5b                   	pop    %ebx
+  803cd8:	5e                   	pop    %esi
+  803cd9:	5f                   	pop    %edi
+  803cda:	5d                   	pop    %ebp
+  803cdb:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  803cdc:	83 ec 08             	sub    $0x8,%esp
+  803cdf:	68 00 00 40 00       	push   $0x400000
+  803ce4:	6a 00                	push   $0x0
+  803ce6:	e8 7c f6 ff ff       	call   803367 <page_out>
+  803ceb:	83 c4 10             	add    $0x10,%esp
+  803cee:	85 c0                	test   %eax,%eax
+  803cf0:	0f 89 5e ff ff ff    	jns    803c54 <page_map+0xc>
+				return r;
+  803cf6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803cf9:	eb d7                	jmp    803cd2 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803cfb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803cfe:	e8 79 f9 ff ff       	call   80367c <page_adopt>
+  803d03:	85 c0                	test   %eax,%eax
+  803d05:	79 90                	jns    803c97 <page_map+0x4f>
+			return r;
+  803d07:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803d0a:	eb c6                	jmp    803cd2 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  803d0c:	53                   	push   %ebx
+  803d0d:	68 64 57 80 00       	push   $0x805764
+  803d12:	68 77 03 00 00       	push   $0x377
+  803d17:	68 2a 53 80 00       	push   $0x80532a
+  803d1c:	e8 0f c5 ff ff       	call   800230 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  803d21:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d24:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803d27:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  803d2e:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  803d34:	0f 84 f5 00 00 00    	je     803e2f <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803d3a:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803d40:	83 ec 0c             	sub    $0xc,%esp
+  803d43:	6a 05                	push   $0x5
+  803d45:	68 00 00 40 00       	push   $0x400000
+  803d4a:	6a 00                	push   $0x0
+  803d4c:	57                   	push   %edi
+  803d4d:	56                   	push   %esi
+  803d4e:	e8 d5 d0 ff ff       	call   800e28 <sys_page_map>
+  803d53:	89 c3                	mov    %eax,%ebx
+  803d55:	83 c4 20             	add    $0x20,%esp
+  803d58:	85 c0                	test   %eax,%eax
+  803d5a:	79 35                	jns    803d91 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  803d5c:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803d5f:	75 1b                	jne    803d7c <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803d61:	83 ec 08             	sub    $0x8,%esp
+  803d64:	68 00 00 40 00       	push   $0x400000
+  803d69:	6a 00                	push   $0x0
+  803d6b:	e8 f7 f5 ff ff       	call   803367 <page_out>
+  803d70:	83 c4 10             	add    $0x10,%esp
+  803d73:	85 c0                	test   %eax,%eax
+  803d75:	79 c9                	jns    803d40 <page_map+0xf8>
+  803d77:	e9 56 ff ff ff       	jmp    803cd2 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  803d7c:	53                   	push   %ebx
+  803d7d:	68 8c 57 80 00       	push   $0x80578c
+  803d82:	68 83 03 00 00       	push   $0x383
+  803d87:	68 2a 53 80 00       	push   $0x80532a
+  803d8c:	e8 9f c4 ff ff       	call   800230 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  803d91:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d94:	c1 e8 0c             	shr    $0xc,%eax
+  803d97:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803d9c:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  803da3:	01 
+  803da4:	0f 84 8d 00 00 00    	je     803e37 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803daa:	83 ec 08             	sub    $0x8,%esp
+  803dad:	68 00 00 40 00       	push   $0x400000
+  803db2:	6a 00                	push   $0x0
+  803db4:	e8 b1 d0 ff ff       	call   800e6a <sys_page_unmap>
+  803db9:	83 c4 10             	add    $0x10,%esp
+  803dbc:	85 c0                	test   %eax,%eax
+  803dbe:	78 36                	js     803df6 <page_map+0x1ae>
+  803dc0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  803dc3:	83 ec 08             	sub    $0x8,%esp
+  803dc6:	57                   	push   %edi
+  803dc7:	56                   	push   %esi
+  803dc8:	e8 4a fc ff ff       	call   803a17 <page_in>
+  803dcd:	89 c3                	mov    %eax,%ebx
+  803dcf:	83 c4 10             	add    $0x10,%esp
+  803dd2:	85 c0                	test   %eax,%eax
+  803dd4:	0f 89 7a fe ff ff    	jns    803c54 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  803dda:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803ddd:	75 2c                	jne    803e0b <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  803ddf:	83 ec 08             	sub    $0x8,%esp
+  803de2:	57                   	push   %edi
+  803de3:	6a 00                	push   $0x0
+  803de5:	e8 7d f5 ff ff       	call   803367 <page_out>
+  803dea:	83 c4 10             	add    $0x10,%esp
+  803ded:	85 c0                	test   %eax,%eax
+  803def:	79 d2                	jns    803dc3 <page_map+0x17b>
+  803df1:	e9 dc fe ff ff       	jmp    803cd2 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  803df6:	50                   	push   %eax
+  803df7:	68 b8 57 80 00       	push   $0x8057b8
+  803dfc:	68 8b 03 00 00       	push   $0x38b
+  803e01:	68 2a 53 80 00       	push   $0x80532a
+  803e06:	e8 25 c4 ff ff       	call   800230 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  803e0b:	53                   	push   %ebx
+  803e0c:	68 e0 57 80 00       	push   $0x8057e0
+  803e11:	68 91 03 00 00       	push   $0x391
+  803e16:	68 2a 53 80 00       	push   $0x80532a
+  803e1b:	e8 10 c4 ff ff       	call   800230 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803e20:	89 c3                	mov    %eax,%ebx
+  803e22:	e9 ab fe ff ff       	jmp    803cd2 <page_map+0x8a>
+  803e27:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e2a:	e9 a3 fe ff ff       	jmp    803cd2 <page_map+0x8a>
+			return r; // Pass through the error
+  803e2f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e32:	e9 9b fe ff ff       	jmp    803cd2 <page_map+0x8a>
+			return r; // Pass through the error
+  803e37:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e3a:	e9 93 fe ff ff       	jmp    803cd2 <page_map+0x8a>
+
+00803e3f <page_map_range>:
+{
+  803e3f:	55                   	push   %ebp
+  803e40:	89 e5                	mov    %esp,%ebp
+  803e42:	57                   	push   %edi
+  803e43:	56                   	push   %esi
+  803e44:	53                   	push   %ebx
+  803e45:	83 ec 0c             	sub    $0xc,%esp
+  803e48:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803e4b:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  803e4e:	83 ec 08             	sub    $0x8,%esp
+  803e51:	ff 75 1c             	push   0x1c(%ebp)
+  803e54:	ff 75 18             	push   0x18(%ebp)
+  803e57:	56                   	push   %esi
+  803e58:	ff 75 10             	push   0x10(%ebp)
+  803e5b:	57                   	push   %edi
+  803e5c:	ff 75 08             	push   0x8(%ebp)
+  803e5f:	e8 cf d0 ff ff       	call   800f33 <sys_page_map_range>
+  803e64:	89 c3                	mov    %eax,%ebx
+  803e66:	83 c4 20             	add    $0x20,%esp
+  803e69:	85 c0                	test   %eax,%eax
+  803e6b:	79 1b                	jns    803e88 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  803e6d:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803e70:	75 20                	jne    803e92 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803e72:	83 ec 08             	sub    $0x8,%esp
+  803e75:	68 00 00 40 00       	push   $0x400000
+  803e7a:	6a 00                	push   $0x0
+  803e7c:	e8 e6 f4 ff ff       	call   803367 <page_out>
+  803e81:	83 c4 10             	add    $0x10,%esp
+  803e84:	85 c0                	test   %eax,%eax
+  803e86:	79 c6                	jns    803e4e <page_map_range+0xf>
+}
+  803e88:	89 d8                	mov    %ebx,%eax
+  803e8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e8d:	5b                   	pop    %ebx
+  803e8e:	5e                   	pop    %esi
+  803e8f:	5f                   	pop    %edi
+  803e90:	5d                   	pop    %ebp
+  803e91:	c3                   	ret
+		if (r != -E_INVAL)
+  803e92:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  803e95:	75 f1                	jne    803e88 <page_map_range+0x49>
+  803e97:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  803e99:	be 00 00 00 00       	mov    $0x0,%esi
+  803e9e:	eb 03                	jmp    803ea3 <page_map_range+0x64>
+  803ea0:	83 c6 01             	add    $0x1,%esi
+  803ea3:	3b 75 18             	cmp    0x18(%ebp),%esi
+  803ea6:	74 2a                	je     803ed2 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  803ea8:	83 ec 0c             	sub    $0xc,%esp
+  803eab:	ff 75 1c             	push   0x1c(%ebp)
+  803eae:	53                   	push   %ebx
+  803eaf:	ff 75 10             	push   0x10(%ebp)
+  803eb2:	57                   	push   %edi
+  803eb3:	ff 75 08             	push   0x8(%ebp)
+  803eb6:	e8 8d fd ff ff       	call   803c48 <page_map>
+  803ebb:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803ec1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803ec7:	83 c4 20             	add    $0x20,%esp
+  803eca:	85 c0                	test   %eax,%eax
+  803ecc:	79 d2                	jns    803ea0 <page_map_range+0x61>
+  803ece:	89 c3                	mov    %eax,%ebx
+  803ed0:	eb b6                	jmp    803e88 <page_map_range+0x49>
+		return 0;
+  803ed2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ed7:	eb af                	jmp    803e88 <page_map_range+0x49>
+
+00803ed9 <paging_pgfault_handler>:
+{
+  803ed9:	55                   	push   %ebp
+  803eda:	89 e5                	mov    %esp,%ebp
+  803edc:	56                   	push   %esi
+  803edd:	53                   	push   %ebx
+  803ede:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  803ee1:	e8 6f e7 ff ff       	call   802655 <find_paging_env>
+	if (pagingenv == 0)
+  803ee6:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803eeb:	85 c0                	test   %eax,%eax
+  803eed:	74 3c                	je     803f2b <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  803eef:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803ef1:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803ef5:	75 12                	jne    803f09 <paging_pgfault_handler+0x30>
+  803ef7:	89 f0                	mov    %esi,%eax
+  803ef9:	e8 7e f7 ff ff       	call   80367c <page_adopt>
+  803efe:	89 c2                	mov    %eax,%edx
+		return 0;
+  803f00:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803f05:	85 d2                	test   %edx,%edx
+  803f07:	78 22                	js     803f2b <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  803f09:	83 ec 08             	sub    $0x8,%esp
+  803f0c:	6a 00                	push   $0x0
+  803f0e:	56                   	push   %esi
+  803f0f:	e8 a9 f3 ff ff       	call   8032bd <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  803f14:	83 c4 10             	add    $0x10,%esp
+  803f17:	85 c0                	test   %eax,%eax
+  803f19:	74 05                	je     803f20 <paging_pgfault_handler+0x47>
+  803f1b:	f6 00 01             	testb  $0x1,(%eax)
+  803f1e:	75 12                	jne    803f32 <paging_pgfault_handler+0x59>
+	return 0;
+  803f20:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f25:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803f29:	74 23                	je     803f4e <paging_pgfault_handler+0x75>
+}
+  803f2b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f2e:	5b                   	pop    %ebx
+  803f2f:	5e                   	pop    %esi
+  803f30:	5d                   	pop    %ebp
+  803f31:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  803f32:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803f37:	8b 40 48             	mov    0x48(%eax),%eax
+  803f3a:	83 ec 08             	sub    $0x8,%esp
+  803f3d:	56                   	push   %esi
+  803f3e:	50                   	push   %eax
+  803f3f:	e8 d3 fa ff ff       	call   803a17 <page_in>
+  803f44:	f7 d0                	not    %eax
+  803f46:	c1 e8 1f             	shr    $0x1f,%eax
+  803f49:	83 c4 10             	add    $0x10,%esp
+  803f4c:	eb dd                	jmp    803f2b <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f4e:	89 f0                	mov    %esi,%eax
+  803f50:	e8 97 e2 ff ff       	call   8021ec <segment_lookup>
+  803f55:	89 c2                	mov    %eax,%edx
+	return 0;
+  803f57:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f5c:	85 d2                	test   %edx,%edx
+  803f5e:	74 cb                	je     803f2b <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  803f60:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803f65:	8b 40 48             	mov    0x48(%eax),%eax
+  803f68:	83 ec 08             	sub    $0x8,%esp
+  803f6b:	56                   	push   %esi
+  803f6c:	50                   	push   %eax
+  803f6d:	e8 f5 f3 ff ff       	call   803367 <page_out>
+  803f72:	f7 d0                	not    %eax
+  803f74:	c1 e8 1f             	shr    $0x1f,%eax
+  803f77:	83 c4 10             	add    $0x10,%esp
+  803f7a:	eb af                	jmp    803f2b <paging_pgfault_handler+0x52>
+
+00803f7c <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  803f7c:	55                   	push   %ebp
+  803f7d:	89 e5                	mov    %esp,%ebp
+  803f7f:	57                   	push   %edi
+  803f80:	56                   	push   %esi
+  803f81:	53                   	push   %ebx
+  803f82:	83 ec 2c             	sub    $0x2c,%esp
+  803f85:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  803f88:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  803f8d:	89 c1                	mov    %eax,%ecx
+  803f8f:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  803f92:	c1 e8 11             	shr    $0x11,%eax
+  803f95:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803f98:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  803f9f:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  803fa2:	b8 01 00 00 00       	mov    $0x1,%eax
+  803fa7:	d3 e0                	shl    %cl,%eax
+  803fa9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803fac:	85 c7                	test   %eax,%edi
+  803fae:	74 12                	je     803fc2 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803fb0:	bb 01 00 00 00       	mov    $0x1,%ebx
+  803fb5:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  803fb8:	bf 01 00 00 00       	mov    $0x1,%edi
+  803fbd:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803fc0:	eb 17                	jmp    803fd9 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  803fc2:	ff 75 e0             	push   -0x20(%ebp)
+  803fc5:	68 18 58 80 00       	push   $0x805818
+  803fca:	6a 48                	push   $0x48
+  803fcc:	68 32 58 80 00       	push   $0x805832
+  803fd1:	e8 5a c2 ff ff       	call   800230 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803fd6:	83 c3 01             	add    $0x1,%ebx
+  803fd9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803fdc:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  803fdf:	89 c8                	mov    %ecx,%eax
+  803fe1:	c1 e8 05             	shr    $0x5,%eax
+  803fe4:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  803feb:	89 fe                	mov    %edi,%esi
+  803fed:	d3 e6                	shl    %cl,%esi
+  803fef:	89 f1                	mov    %esi,%ecx
+  803ff1:	85 d6                	test   %edx,%esi
+  803ff3:	74 e1                	je     803fd6 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  803ff5:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  803ff8:	f7 d6                	not    %esi
+  803ffa:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  803ffd:	21 fe                	and    %edi,%esi
+  803fff:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804002:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  804009:	f7 d1                	not    %ecx
+  80400b:	21 d1                	and    %edx,%ecx
+  80400d:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804014:	83 ec 04             	sub    $0x4,%esp
+  804017:	53                   	push   %ebx
+  804018:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80401b:	57                   	push   %edi
+  80401c:	6a 00                	push   $0x0
+  80401e:	e8 97 f8 ff ff       	call   8038ba <page_unmap_range>
+	va_free(va, n);
+  804023:	83 c4 08             	add    $0x8,%esp
+  804026:	53                   	push   %ebx
+  804027:	57                   	push   %edi
+  804028:	e8 ed 05 00 00       	call   80461a <va_free>
+}
+  80402d:	83 c4 10             	add    $0x10,%esp
+  804030:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804033:	5b                   	pop    %ebx
+  804034:	5e                   	pop    %esi
+  804035:	5f                   	pop    %edi
+  804036:	5d                   	pop    %ebp
+  804037:	c3                   	ret
+
+00804038 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  804038:	55                   	push   %ebp
+  804039:	89 e5                	mov    %esp,%ebp
+  80403b:	57                   	push   %edi
+  80403c:	56                   	push   %esi
+  80403d:	53                   	push   %ebx
+  80403e:	83 ec 1c             	sub    $0x1c,%esp
+  804041:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804044:	85 db                	test   %ebx,%ebx
+  804046:	74 34                	je     80407c <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  804048:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80404e:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  804053:	77 2f                	ja     804084 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  804055:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80405b:	75 51                	jne    8040ae <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  80405d:	89 c1                	mov    %eax,%ecx
+  80405f:	c1 e9 0c             	shr    $0xc,%ecx
+  804062:	ba 01 00 00 00       	mov    $0x1,%edx
+  804067:	d3 e2                	shl    %cl,%edx
+  804069:	c1 e8 11             	shr    $0x11,%eax
+  80406c:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  804073:	75 24                	jne    804099 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  804075:	89 d8                	mov    %ebx,%eax
+  804077:	e8 00 ff ff ff       	call   803f7c <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  80407c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80407f:	5b                   	pop    %ebx
+  804080:	5e                   	pop    %esi
+  804081:	5f                   	pop    %edi
+  804082:	5d                   	pop    %ebp
+  804083:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  804084:	53                   	push   %ebx
+  804085:	68 3f 58 80 00       	push   $0x80583f
+  80408a:	68 a2 00 00 00       	push   $0xa2
+  80408f:	68 32 58 80 00       	push   $0x805832
+  804094:	e8 97 c1 ff ff       	call   800230 <_panic>
+			panic("free: %p is not allocated", va);
+  804099:	53                   	push   %ebx
+  80409a:	68 18 58 80 00       	push   $0x805818
+  80409f:	68 a5 00 00 00       	push   $0xa5
+  8040a4:	68 32 58 80 00       	push   $0x805832
+  8040a9:	e8 82 c1 ff ff       	call   800230 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  8040ae:	89 de                	mov    %ebx,%esi
+  8040b0:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  8040b6:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  8040bc:	89 c8                	mov    %ecx,%eax
+  8040be:	c1 e8 11             	shr    $0x11,%eax
+  8040c1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8040c4:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  8040cb:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8040ce:	c1 e9 0c             	shr    $0xc,%ecx
+  8040d1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8040d6:	d3 e0                	shl    %cl,%eax
+  8040d8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8040db:	85 c7                	test   %eax,%edi
+  8040dd:	74 1b                	je     8040fa <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  8040df:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8040e3:	89 d8                	mov    %ebx,%eax
+  8040e5:	29 f0                	sub    %esi,%eax
+  8040e7:	83 e8 10             	sub    $0x10,%eax
+  8040ea:	99                   	cltd
+  8040eb:	f7 ff                	idiv   %edi
+  8040ed:	89 d1                	mov    %edx,%ecx
+  8040ef:	85 d2                	test   %edx,%edx
+  8040f1:	75 07                	jne    8040fa <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8040f3:	ba 10 00 00 00       	mov    $0x10,%edx
+  8040f8:	eb 18                	jmp    804112 <free+0xda>
+		panic("free: %p is not allocated", va);
+  8040fa:	53                   	push   %ebx
+  8040fb:	68 18 58 80 00       	push   $0x805818
+  804100:	68 ad 00 00 00       	push   $0xad
+  804105:	68 32 58 80 00       	push   $0x805832
+  80410a:	e8 21 c1 ff ff       	call   800230 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80410f:	83 c1 01             	add    $0x1,%ecx
+  804112:	89 d0                	mov    %edx,%eax
+  804114:	d3 e0                	shl    %cl,%eax
+  804116:	39 c7                	cmp    %eax,%edi
+  804118:	7f f5                	jg     80410f <free+0xd7>
+	*(void **) va = s->free;
+  80411a:	8b 46 08             	mov    0x8(%esi),%eax
+  80411d:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  80411f:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  804122:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  804126:	8d 58 01             	lea    0x1(%eax),%ebx
+  804129:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  80412d:	66 85 c0             	test   %ax,%ax
+  804130:	74 52                	je     804184 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804132:	0f b7 db             	movzwl %bx,%ebx
+  804135:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804139:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80413e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804143:	f7 ff                	idiv   %edi
+  804145:	39 c3                	cmp    %eax,%ebx
+  804147:	0f 85 2f ff ff ff    	jne    80407c <free+0x44>
+  80414d:	8b 46 04             	mov    0x4(%esi),%eax
+  804150:	85 c0                	test   %eax,%eax
+  804152:	74 53                	je     8041a7 <free+0x16f>
+		s->prev->next = s->next;
+  804154:	8b 16                	mov    (%esi),%edx
+  804156:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804158:	8b 06                	mov    (%esi),%eax
+  80415a:	85 c0                	test   %eax,%eax
+  80415c:	74 06                	je     804164 <free+0x12c>
+		s->next->prev = s->prev;
+  80415e:	8b 56 04             	mov    0x4(%esi),%edx
+  804161:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804164:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804167:	f7 d0                	not    %eax
+  804169:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80416c:	21 d0                	and    %edx,%eax
+  80416e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  804171:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  804178:	89 f0                	mov    %esi,%eax
+  80417a:	e8 fd fd ff ff       	call   803f7c <heap_free_pages>
+  80417f:	e9 f8 fe ff ff       	jmp    80407c <free+0x44>
+	s->prev = NULL;
+  804184:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  80418b:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  804192:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  804194:	85 c0                	test   %eax,%eax
+  804196:	74 03                	je     80419b <free+0x163>
+		slabs[c]->prev = s;
+  804198:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  80419b:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  8041a2:	e9 d5 fe ff ff       	jmp    80407c <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8041a7:	8b 06                	mov    (%esi),%eax
+  8041a9:	85 c0                	test   %eax,%eax
+  8041ab:	0f 84 cb fe ff ff    	je     80407c <free+0x44>
+		slabs[c] = s->next;
+  8041b1:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  8041b8:	8b 06                	mov    (%esi),%eax
+  8041ba:	eb a2                	jmp    80415e <free+0x126>
+
+008041bc <heap_alloc_pages>:
+{
+  8041bc:	55                   	push   %ebp
+  8041bd:	89 e5                	mov    %esp,%ebp
+  8041bf:	57                   	push   %edi
+  8041c0:	56                   	push   %esi
+  8041c1:	53                   	push   %ebx
+  8041c2:	83 ec 18             	sub    $0x18,%esp
+  8041c5:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  8041c7:	50                   	push   %eax
+  8041c8:	e8 15 03 00 00       	call   8044e2 <va_alloc>
+  8041cd:	89 c3                	mov    %eax,%ebx
+  8041cf:	83 c4 10             	add    $0x10,%esp
+  8041d2:	85 c0                	test   %eax,%eax
+  8041d4:	74 47                	je     80421d <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8041d6:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  8041dc:	89 c1                	mov    %eax,%ecx
+  8041de:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  8041e1:	c1 e8 11             	shr    $0x11,%eax
+  8041e4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8041e9:	89 d7                	mov    %edx,%edi
+  8041eb:	d3 e7                	shl    %cl,%edi
+  8041ed:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  8041f4:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  8041f8:	89 c8                	mov    %ecx,%eax
+  8041fa:	c1 e8 05             	shr    $0x5,%eax
+  8041fd:	d3 e2                	shl    %cl,%edx
+  8041ff:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  804206:	83 ec 0c             	sub    $0xc,%esp
+  804209:	6a 00                	push   $0x0
+  80420b:	6a 07                	push   $0x7
+  80420d:	56                   	push   %esi
+  80420e:	53                   	push   %ebx
+  80420f:	6a 00                	push   $0x0
+  804211:	e8 3a f7 ff ff       	call   803950 <page_alloc_range>
+  804216:	83 c4 20             	add    $0x20,%esp
+  804219:	85 c0                	test   %eax,%eax
+  80421b:	78 0a                	js     804227 <heap_alloc_pages+0x6b>
+}
+  80421d:	89 d8                	mov    %ebx,%eax
+  80421f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804222:	5b                   	pop    %ebx
+  804223:	5e                   	pop    %esi
+  804224:	5f                   	pop    %edi
+  804225:	5d                   	pop    %ebp
+  804226:	c3                   	ret
+		free(va);
+  804227:	83 ec 0c             	sub    $0xc,%esp
+  80422a:	53                   	push   %ebx
+  80422b:	e8 08 fe ff ff       	call   804038 <free>
+		return NULL;
+  804230:	83 c4 10             	add    $0x10,%esp
+  804233:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804238:	eb e3                	jmp    80421d <heap_alloc_pages+0x61>
+
+0080423a <malloc>:
+{
+  80423a:	55                   	push   %ebp
+  80423b:	89 e5                	mov    %esp,%ebp
+  80423d:	57                   	push   %edi
+  80423e:	56                   	push   %esi
+  80423f:	53                   	push   %ebx
+  804240:	83 ec 1c             	sub    $0x1c,%esp
+  804243:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804246:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804249:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  80424f:	0f 87 21 01 00 00    	ja     804376 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804255:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80425a:	ba 10 00 00 00       	mov    $0x10,%edx
+  80425f:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  804261:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804266:	76 15                	jbe    80427d <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804268:	05 ff 0f 00 00       	add    $0xfff,%eax
+  80426d:	c1 e8 0c             	shr    $0xc,%eax
+  804270:	e8 47 ff ff ff       	call   8041bc <heap_alloc_pages>
+  804275:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804278:	eb 37                	jmp    8042b1 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  80427a:	83 c1 01             	add    $0x1,%ecx
+  80427d:	89 d6                	mov    %edx,%esi
+  80427f:	d3 e6                	shl    %cl,%esi
+  804281:	39 c6                	cmp    %eax,%esi
+  804283:	72 f5                	jb     80427a <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804285:	89 cb                	mov    %ecx,%ebx
+  804287:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  80428e:	85 ff                	test   %edi,%edi
+  804290:	74 2a                	je     8042bc <malloc+0x82>
+	v = s->free;
+  804292:	8b 47 08             	mov    0x8(%edi),%eax
+  804295:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  804298:	8b 00                	mov    (%eax),%eax
+  80429a:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  80429d:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  8042a1:	83 e8 01             	sub    $0x1,%eax
+  8042a4:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  8042a8:	66 85 c0             	test   %ax,%ax
+  8042ab:	0f 84 9a 00 00 00    	je     80434b <malloc+0x111>
+}
+  8042b1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8042b4:	83 c4 1c             	add    $0x1c,%esp
+  8042b7:	5b                   	pop    %ebx
+  8042b8:	5e                   	pop    %esi
+  8042b9:	5f                   	pop    %edi
+  8042ba:	5d                   	pop    %ebp
+  8042bb:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  8042bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8042c1:	e8 f6 fe ff ff       	call   8041bc <heap_alloc_pages>
+  8042c6:	89 c1                	mov    %eax,%ecx
+  8042c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8042cb:	85 c0                	test   %eax,%eax
+  8042cd:	74 e2                	je     8042b1 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8042cf:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  8042d5:	89 c8                	mov    %ecx,%eax
+  8042d7:	c1 e8 11             	shr    $0x11,%eax
+  8042da:	c1 e9 0c             	shr    $0xc,%ecx
+  8042dd:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042e2:	d3 e2                	shl    %cl,%edx
+  8042e4:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  8042eb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8042ee:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  8042f2:	0f b7 f6             	movzwl %si,%esi
+  8042f5:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8042fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042ff:	f7 fe                	idiv   %esi
+  804301:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804305:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  804308:	85 c0                	test   %eax,%eax
+  80430a:	74 14                	je     804320 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  80430c:	83 e8 01             	sub    $0x1,%eax
+  80430f:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804313:	0f af d0             	imul   %eax,%edx
+  804316:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  80431a:	89 3a                	mov    %edi,(%edx)
+  80431c:	89 d7                	mov    %edx,%edi
+  80431e:	eb e5                	jmp    804305 <malloc+0xcb>
+	s->prev = NULL;
+  804320:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804323:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  80432a:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  804331:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804333:	85 c0                	test   %eax,%eax
+  804335:	74 03                	je     80433a <malloc+0x100>
+		slabs[c]->prev = s;
+  804337:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  80433a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80433d:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  804344:	89 c7                	mov    %eax,%edi
+  804346:	e9 47 ff ff ff       	jmp    804292 <malloc+0x58>
+	if (s->prev)
+  80434b:	8b 47 04             	mov    0x4(%edi),%eax
+  80434e:	85 c0                	test   %eax,%eax
+  804350:	74 19                	je     80436b <malloc+0x131>
+		s->prev->next = s->next;
+  804352:	8b 17                	mov    (%edi),%edx
+  804354:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804356:	8b 07                	mov    (%edi),%eax
+  804358:	85 c0                	test   %eax,%eax
+  80435a:	0f 84 51 ff ff ff    	je     8042b1 <malloc+0x77>
+		s->next->prev = s->prev;
+  804360:	8b 57 04             	mov    0x4(%edi),%edx
+  804363:	89 50 04             	mov    %edx,0x4(%eax)
+  804366:	e9 46 ff ff ff       	jmp    8042b1 <malloc+0x77>
+		slabs[c] = s->next;
+  80436b:	8b 07                	mov    (%edi),%eax
+  80436d:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  804374:	eb e0                	jmp    804356 <malloc+0x11c>
+		return NULL;
+  804376:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80437d:	e9 2f ff ff ff       	jmp    8042b1 <malloc+0x77>
+
+00804382 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804382:	55                   	push   %ebp
+  804383:	89 e5                	mov    %esp,%ebp
+  804385:	57                   	push   %edi
+  804386:	56                   	push   %esi
+  804387:	53                   	push   %ebx
+  804388:	83 ec 0c             	sub    $0xc,%esp
+  80438b:	89 c6                	mov    %eax,%esi
+  80438d:	89 d7                	mov    %edx,%edi
+  80438f:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804392:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804397:	ba 00 00 00 00       	mov    $0x0,%edx
+  80439c:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  8043a1:	83 ef 01             	sub    $0x1,%edi
+  8043a4:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8043a7:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8043aa:	eb 34                	jmp    8043e0 <va_chunk_scan+0x5e>
+			i += 31;
+  8043ac:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  8043af:	89 ca                	mov    %ecx,%edx
+			continue;
+  8043b1:	eb 23                	jmp    8043d6 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8043b3:	89 c7                	mov    %eax,%edi
+  8043b5:	c1 ef 05             	shr    $0x5,%edi
+  8043b8:	be 01 00 00 00       	mov    $0x1,%esi
+  8043bd:	d3 e6                	shl    %cl,%esi
+  8043bf:	89 f1                	mov    %esi,%ecx
+  8043c1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8043c4:	23 0c be             	and    (%esi,%edi,4),%ecx
+  8043c7:	75 41                	jne    80440a <va_chunk_scan+0x88>
+			len++;
+  8043c9:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  8043cc:	39 d3                	cmp    %edx,%ebx
+  8043ce:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  8043d1:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  8043d4:	72 2d                	jb     804403 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8043d6:	83 c0 01             	add    $0x1,%eax
+  8043d9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8043de:	77 31                	ja     804411 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  8043e0:	89 c1                	mov    %eax,%ecx
+  8043e2:	83 e1 1f             	and    $0x1f,%ecx
+  8043e5:	75 cc                	jne    8043b3 <va_chunk_scan+0x31>
+  8043e7:	89 c7                	mov    %eax,%edi
+  8043e9:	c1 ef 05             	shr    $0x5,%edi
+  8043ec:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8043ef:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  8043f2:	83 ff ff             	cmp    $0xffffffff,%edi
+  8043f5:	74 b5                	je     8043ac <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  8043f7:	85 ff                	test   %edi,%edi
+  8043f9:	75 b8                	jne    8043b3 <va_chunk_scan+0x31>
+			i += 31;
+  8043fb:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  8043fe:	83 c2 20             	add    $0x20,%edx
+  804401:	eb c9                	jmp    8043cc <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804403:	83 c0 01             	add    $0x1,%eax
+  804406:	29 d0                	sub    %edx,%eax
+  804408:	eb 15                	jmp    80441f <va_chunk_scan+0x9d>
+			len = 0;
+  80440a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80440f:	eb c5                	jmp    8043d6 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804411:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804416:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804419:	85 d2                	test   %edx,%edx
+  80441b:	74 02                	je     80441f <va_chunk_scan+0x9d>
+		*run_store = best;
+  80441d:	89 1a                	mov    %ebx,(%edx)
+}
+  80441f:	83 c4 0c             	add    $0xc,%esp
+  804422:	5b                   	pop    %ebx
+  804423:	5e                   	pop    %esi
+  804424:	5f                   	pop    %edi
+  804425:	5d                   	pop    %ebp
+  804426:	c3                   	ret
+
+00804427 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804427:	55                   	push   %ebp
+  804428:	89 e5                	mov    %esp,%ebp
+  80442a:	57                   	push   %edi
+  80442b:	56                   	push   %esi
+  80442c:	53                   	push   %ebx
+  80442d:	83 ec 14             	sub    $0x14,%esp
+  804430:	89 c3                	mov    %eax,%ebx
+  804432:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804434:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  80443a:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  804440:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804443:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804446:	89 d6                	mov    %edx,%esi
+  804448:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  80444e:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804450:	eb 34                	jmp    804486 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804452:	89 c8                	mov    %ecx,%eax
+  804454:	c1 e8 05             	shr    $0x5,%eax
+  804457:	89 da                	mov    %ebx,%edx
+  804459:	c1 e2 05             	shl    $0x5,%edx
+  80445c:	01 da                	add    %ebx,%edx
+  80445e:	01 c2                	add    %eax,%edx
+  804460:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804465:	d3 c0                	rol    %cl,%eax
+  804467:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  80446e:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804475:	b8 01 00 00 00       	mov    $0x1,%eax
+  80447a:	01 d0                	add    %edx,%eax
+  80447c:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804483:	83 c1 01             	add    $0x1,%ecx
+  804486:	39 f9                	cmp    %edi,%ecx
+  804488:	74 30                	je     8044ba <va_chunk_mark+0x93>
+		if (alloc)
+  80448a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80448e:	74 c2                	je     804452 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804490:	89 c8                	mov    %ecx,%eax
+  804492:	c1 e8 05             	shr    $0x5,%eax
+  804495:	89 da                	mov    %ebx,%edx
+  804497:	c1 e2 05             	shl    $0x5,%edx
+  80449a:	01 da                	add    %ebx,%edx
+  80449c:	01 c2                	add    %eax,%edx
+  80449e:	b8 01 00 00 00       	mov    $0x1,%eax
+  8044a3:	d3 e0                	shl    %cl,%eax
+  8044a5:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  8044ac:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  8044b3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8044b8:	eb c0                	jmp    80447a <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  8044ba:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  8044bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044c2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8044c5:	e8 b8 fe ff ff       	call   804382 <va_chunk_scan>
+	ch->run = run;
+  8044ca:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  8044d0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8044d3:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  8044da:	83 c4 14             	add    $0x14,%esp
+  8044dd:	5b                   	pop    %ebx
+  8044de:	5e                   	pop    %esi
+  8044df:	5f                   	pop    %edi
+  8044e0:	5d                   	pop    %ebp
+  8044e1:	c3                   	ret
+
+008044e2 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  8044e2:	55                   	push   %ebp
+  8044e3:	89 e5                	mov    %esp,%ebp
+  8044e5:	57                   	push   %edi
+  8044e6:	56                   	push   %esi
+  8044e7:	53                   	push   %ebx
+  8044e8:	83 ec 04             	sub    $0x4,%esp
+  8044eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  8044ee:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  8044f3:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  8044f8:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  8044ff:	74 4f                	je     804550 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804501:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804504:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804509:	0f 87 01 01 00 00    	ja     804610 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  80450f:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804515:	0f 87 80 00 00 00    	ja     80459b <va_alloc+0xb9>
+  80451b:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804520:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804525:	0f b7 10             	movzwl (%eax),%edx
+  804528:	05 84 00 00 00       	add    $0x84,%eax
+  80452d:	39 da                	cmp    %ebx,%edx
+  80452f:	73 2c                	jae    80455d <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804531:	83 c6 01             	add    $0x1,%esi
+  804534:	83 fe 1c             	cmp    $0x1c,%esi
+  804537:	75 ec                	jne    804525 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804539:	b8 00 00 00 00       	mov    $0x0,%eax
+  80453e:	eb 53                	jmp    804593 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804540:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804546:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  80454b:	05 84 00 00 00       	add    $0x84,%eax
+  804550:	39 d0                	cmp    %edx,%eax
+  804552:	75 ec                	jne    804540 <va_alloc+0x5e>
+	va_inited = 1;
+  804554:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  80455b:	eb a4                	jmp    804501 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  80455d:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804563:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  804568:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80456d:	89 da                	mov    %ebx,%edx
+  80456f:	e8 0e fe ff ff       	call   804382 <va_chunk_scan>
+  804574:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804576:	6a 01                	push   $0x1
+  804578:	89 d9                	mov    %ebx,%ecx
+  80457a:	89 c2                	mov    %eax,%edx
+  80457c:	89 f0                	mov    %esi,%eax
+  80457e:	e8 a4 fe ff ff       	call   804427 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804583:	c1 e6 16             	shl    $0x16,%esi
+  804586:	c1 e7 0c             	shl    $0xc,%edi
+  804589:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804590:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804593:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804596:	5b                   	pop    %ebx
+  804597:	5e                   	pop    %esi
+  804598:	5f                   	pop    %edi
+  804599:	5d                   	pop    %ebp
+  80459a:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  80459b:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  8045a1:	c1 ee 0a             	shr    $0xa,%esi
+  8045a4:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  8045a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045ae:	eb 0a                	jmp    8045ba <va_alloc+0xd8>
+			first = c + 1;
+  8045b0:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  8045b2:	83 c2 01             	add    $0x1,%edx
+  8045b5:	83 fa 1d             	cmp    $0x1d,%edx
+  8045b8:	74 4f                	je     804609 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  8045ba:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  8045c0:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  8045c7:	00 04 
+  8045c9:	75 e5                	jne    8045b0 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  8045cb:	89 d1                	mov    %edx,%ecx
+  8045cd:	29 c1                	sub    %eax,%ecx
+  8045cf:	39 f1                	cmp    %esi,%ecx
+  8045d1:	75 df                	jne    8045b2 <va_alloc+0xd0>
+  8045d3:	89 c7                	mov    %eax,%edi
+  8045d5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  8045d8:	be 00 04 00 00       	mov    $0x400,%esi
+  8045dd:	39 f3                	cmp    %esi,%ebx
+  8045df:	0f 46 f3             	cmovbe %ebx,%esi
+  8045e2:	6a 01                	push   $0x1
+  8045e4:	89 f1                	mov    %esi,%ecx
+  8045e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045eb:	89 f8                	mov    %edi,%eax
+  8045ed:	e8 35 fe ff ff       	call   804427 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  8045f2:	83 c7 01             	add    $0x1,%edi
+  8045f5:	83 c4 04             	add    $0x4,%esp
+  8045f8:	29 f3                	sub    %esi,%ebx
+  8045fa:	75 dc                	jne    8045d8 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  8045fc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8045ff:	c1 e0 16             	shl    $0x16,%eax
+  804602:	05 00 00 00 08       	add    $0x8000000,%eax
+  804607:	eb 8a                	jmp    804593 <va_alloc+0xb1>
+	return NULL;
+  804609:	b8 00 00 00 00       	mov    $0x0,%eax
+  80460e:	eb 83                	jmp    804593 <va_alloc+0xb1>
+		return NULL;
+  804610:	b8 00 00 00 00       	mov    $0x0,%eax
+  804615:	e9 79 ff ff ff       	jmp    804593 <va_alloc+0xb1>
+
+0080461a <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  80461a:	55                   	push   %ebp
+  80461b:	89 e5                	mov    %esp,%ebp
+  80461d:	57                   	push   %edi
+  80461e:	56                   	push   %esi
+  80461f:	53                   	push   %ebx
+  804620:	83 ec 0c             	sub    $0xc,%esp
+  804623:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804626:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804629:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  80462f:	76 21                	jbe    804652 <va_free+0x38>
+  804631:	89 f0                	mov    %esi,%eax
+  804633:	c1 e0 0c             	shl    $0xc,%eax
+  804636:	01 f8                	add    %edi,%eax
+  804638:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  80463d:	77 13                	ja     804652 <va_free+0x38>
+	    || PGOFF(va))
+  80463f:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804645:	75 0b                	jne    804652 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804647:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  80464d:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804650:	eb 45                	jmp    804697 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804652:	83 ec 0c             	sub    $0xc,%esp
+  804655:	56                   	push   %esi
+  804656:	57                   	push   %edi
+  804657:	68 5c 58 80 00       	push   $0x80585c
+  80465c:	68 8e 00 00 00       	push   $0x8e
+  804661:	68 7c 58 80 00       	push   $0x80587c
+  804666:	e8 c5 bb ff ff       	call   800230 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  80466b:	89 fa                	mov    %edi,%edx
+  80466d:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804673:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804678:	29 d3                	sub    %edx,%ebx
+  80467a:	39 f3                	cmp    %esi,%ebx
+  80467c:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  80467f:	89 f8                	mov    %edi,%eax
+  804681:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804684:	83 ec 0c             	sub    $0xc,%esp
+  804687:	6a 00                	push   $0x0
+  804689:	89 d9                	mov    %ebx,%ecx
+  80468b:	e8 97 fd ff ff       	call   804427 <va_chunk_mark>
+		i += n;
+  804690:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804692:	29 de                	sub    %ebx,%esi
+  804694:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804697:	85 f6                	test   %esi,%esi
+  804699:	75 d0                	jne    80466b <va_free+0x51>
+	}
+}
+  80469b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80469e:	5b                   	pop    %ebx
+  80469f:	5e                   	pop    %esi
+  8046a0:	5f                   	pop    %edi
+  8046a1:	5d                   	pop    %ebp
+  8046a2:	c3                   	ret
+
+008046a3 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8046a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046a8:	c3                   	ret
+
+008046a9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8046a9:	55                   	push   %ebp
+  8046aa:	89 e5                	mov    %esp,%ebp
+  8046ac:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8046af:	68 89 58 80 00       	push   $0x805889
+  8046b4:	ff 75 0c             	push   0xc(%ebp)
+  8046b7:	e8 36 c2 ff ff       	call   8008f2 <strcpy>
+	return 0;
+}
+  8046bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046c1:	c9                   	leave
+  8046c2:	c3                   	ret
+
+008046c3 <devcons_write>:
+{
+  8046c3:	55                   	push   %ebp
+  8046c4:	89 e5                	mov    %esp,%ebp
+  8046c6:	57                   	push   %edi
+  8046c7:	56                   	push   %esi
+  8046c8:	53                   	push   %ebx
+  8046c9:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8046cf:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8046d4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8046da:	eb 2e                	jmp    80470a <devcons_write+0x47>
+		m = n - tot;
+  8046dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8046df:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8046e1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8046e6:	39 c3                	cmp    %eax,%ebx
+  8046e8:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8046eb:	83 ec 04             	sub    $0x4,%esp
+  8046ee:	53                   	push   %ebx
+  8046ef:	89 f0                	mov    %esi,%eax
+  8046f1:	03 45 0c             	add    0xc(%ebp),%eax
+  8046f4:	50                   	push   %eax
+  8046f5:	57                   	push   %edi
+  8046f6:	e8 7d c3 ff ff       	call   800a78 <memmove>
+		sys_cputs(buf, m);
+  8046fb:	83 c4 08             	add    $0x8,%esp
+  8046fe:	53                   	push   %ebx
+  8046ff:	57                   	push   %edi
+  804700:	e8 13 c6 ff ff       	call   800d18 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804705:	01 de                	add    %ebx,%esi
+  804707:	83 c4 10             	add    $0x10,%esp
+  80470a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80470d:	72 cd                	jb     8046dc <devcons_write+0x19>
+}
+  80470f:	89 f0                	mov    %esi,%eax
+  804711:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804714:	5b                   	pop    %ebx
+  804715:	5e                   	pop    %esi
+  804716:	5f                   	pop    %edi
+  804717:	5d                   	pop    %ebp
+  804718:	c3                   	ret
+
+00804719 <devcons_read>:
+{
+  804719:	55                   	push   %ebp
+  80471a:	89 e5                	mov    %esp,%ebp
+  80471c:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80471f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804724:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804728:	75 07                	jne    804731 <devcons_read+0x18>
+  80472a:	eb 1f                	jmp    80474b <devcons_read+0x32>
+		sys_yield();
+  80472c:	e8 95 c6 ff ff       	call   800dc6 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804731:	e8 11 c6 ff ff       	call   800d47 <sys_cgetc>
+  804736:	85 c0                	test   %eax,%eax
+  804738:	74 f2                	je     80472c <devcons_read+0x13>
+	if (c < 0)
+  80473a:	78 0f                	js     80474b <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80473c:	83 f8 04             	cmp    $0x4,%eax
+  80473f:	74 0c                	je     80474d <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804741:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804744:	88 02                	mov    %al,(%edx)
+	return 1;
+  804746:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80474b:	c9                   	leave
+  80474c:	c3                   	ret
+		return 0;
+  80474d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804752:	eb f7                	jmp    80474b <devcons_read+0x32>
+
+00804754 <cputchar>:
+{
+  804754:	55                   	push   %ebp
+  804755:	89 e5                	mov    %esp,%ebp
+  804757:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80475a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80475d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804760:	6a 01                	push   $0x1
+  804762:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804765:	50                   	push   %eax
+  804766:	e8 ad c5 ff ff       	call   800d18 <sys_cputs>
+}
+  80476b:	83 c4 10             	add    $0x10,%esp
+  80476e:	c9                   	leave
+  80476f:	c3                   	ret
+
+00804770 <getchar>:
+{
+  804770:	55                   	push   %ebp
+  804771:	89 e5                	mov    %esp,%ebp
+  804773:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804776:	6a 01                	push   $0x1
+  804778:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80477b:	50                   	push   %eax
+  80477c:	6a 00                	push   $0x0
+  80477e:	e8 d7 ce ff ff       	call   80165a <read>
+	if (r < 0)
+  804783:	83 c4 10             	add    $0x10,%esp
+  804786:	85 c0                	test   %eax,%eax
+  804788:	78 06                	js     804790 <getchar+0x20>
+	if (r < 1)
+  80478a:	74 06                	je     804792 <getchar+0x22>
+	return c;
+  80478c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804790:	c9                   	leave
+  804791:	c3                   	ret
+		return -E_EOF;
+  804792:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804797:	eb f7                	jmp    804790 <getchar+0x20>
+
+00804799 <iscons>:
+{
+  804799:	55                   	push   %ebp
+  80479a:	89 e5                	mov    %esp,%ebp
+  80479c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80479f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8047a2:	50                   	push   %eax
+  8047a3:	ff 75 08             	push   0x8(%ebp)
+  8047a6:	e8 50 cc ff ff       	call   8013fb <fd_lookup>
+  8047ab:	83 c4 10             	add    $0x10,%esp
+  8047ae:	85 c0                	test   %eax,%eax
+  8047b0:	78 11                	js     8047c3 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8047b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047b5:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  8047bb:	39 10                	cmp    %edx,(%eax)
+  8047bd:	0f 94 c0             	sete   %al
+  8047c0:	0f b6 c0             	movzbl %al,%eax
+}
+  8047c3:	c9                   	leave
+  8047c4:	c3                   	ret
+
+008047c5 <opencons>:
+{
+  8047c5:	55                   	push   %ebp
+  8047c6:	89 e5                	mov    %esp,%ebp
+  8047c8:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8047cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8047ce:	50                   	push   %eax
+  8047cf:	e8 d3 cb ff ff       	call   8013a7 <fd_alloc>
+  8047d4:	83 c4 10             	add    $0x10,%esp
+  8047d7:	85 c0                	test   %eax,%eax
+  8047d9:	78 3a                	js     804815 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8047db:	83 ec 04             	sub    $0x4,%esp
+  8047de:	68 07 04 00 00       	push   $0x407
+  8047e3:	ff 75 f4             	push   -0xc(%ebp)
+  8047e6:	6a 00                	push   $0x0
+  8047e8:	e8 f8 c5 ff ff       	call   800de5 <sys_page_alloc>
+  8047ed:	83 c4 10             	add    $0x10,%esp
+  8047f0:	85 c0                	test   %eax,%eax
+  8047f2:	78 21                	js     804815 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8047f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047f7:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  8047fd:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8047ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804802:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804809:	83 ec 0c             	sub    $0xc,%esp
+  80480c:	50                   	push   %eax
+  80480d:	e8 6e cb ff ff       	call   801380 <fd2num>
+  804812:	83 c4 10             	add    $0x10,%esp
+}
+  804815:	c9                   	leave
+  804816:	c3                   	ret
+
+00804817 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804817:	55                   	push   %ebp
+  804818:	89 e5                	mov    %esp,%ebp
+  80481a:	56                   	push   %esi
+  80481b:	53                   	push   %ebx
+  80481c:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  80481f:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  804824:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804827:	85 db                	test   %ebx,%ebx
+  804829:	78 17                	js     804842 <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  80482b:	83 ec 0c             	sub    $0xc,%esp
+  80482e:	56                   	push   %esi
+  80482f:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  804836:	83 c4 10             	add    $0x10,%esp
+  804839:	85 c0                	test   %eax,%eax
+  80483b:	75 27                	jne    804864 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  80483d:	83 eb 01             	sub    $0x1,%ebx
+  804840:	eb e5                	jmp    804827 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804842:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804847:	8b 40 48             	mov    0x48(%eax),%eax
+  80484a:	83 ec 08             	sub    $0x8,%esp
+  80484d:	ff 76 28             	push   0x28(%esi)
+  804850:	ff 36                	push   (%esi)
+  804852:	50                   	push   %eax
+  804853:	68 98 58 80 00       	push   $0x805898
+  804858:	6a 1d                	push   $0x1d
+  80485a:	68 bb 58 80 00       	push   $0x8058bb
+  80485f:	e8 cc b9 ff ff       	call   800230 <_panic>
+}
+  804864:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804867:	5b                   	pop    %ebx
+  804868:	5e                   	pop    %esi
+  804869:	5d                   	pop    %ebp
+  80486a:	c3                   	ret
+
+0080486b <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80486b:	55                   	push   %ebp
+  80486c:	89 e5                	mov    %esp,%ebp
+  80486e:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804871:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  804878:	74 0a                	je     804884 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80487a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80487d:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  804882:	c9                   	leave
+  804883:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804884:	83 ec 04             	sub    $0x4,%esp
+  804887:	6a 07                	push   $0x7
+  804889:	68 00 f0 bf ee       	push   $0xeebff000
+  80488e:	6a 00                	push   $0x0
+  804890:	e8 50 c5 ff ff       	call   800de5 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804895:	83 c4 08             	add    $0x8,%esp
+  804898:	68 0b 49 80 00       	push   $0x80490b
+  80489d:	6a 00                	push   $0x0
+  80489f:	e8 a7 c8 ff ff       	call   80114b <sys_env_set_pgfault_upcall>
+  8048a4:	83 c4 10             	add    $0x10,%esp
+  8048a7:	eb d1                	jmp    80487a <set_pgfault_handler+0xf>
+
+008048a9 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  8048a9:	55                   	push   %ebp
+  8048aa:	89 e5                	mov    %esp,%ebp
+  8048ac:	83 ec 08             	sub    $0x8,%esp
+  8048af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  8048b2:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  8048b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048bd:	eb 03                	jmp    8048c2 <add_pgfault_handler+0x19>
+  8048bf:	83 c0 01             	add    $0x1,%eax
+  8048c2:	39 d0                	cmp    %edx,%eax
+  8048c4:	74 0b                	je     8048d1 <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  8048c6:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  8048cd:	75 f0                	jne    8048bf <add_pgfault_handler+0x16>
+  8048cf:	eb 24                	jmp    8048f5 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  8048d1:	83 fa 0a             	cmp    $0xa,%edx
+  8048d4:	74 21                	je     8048f7 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  8048d6:	8d 42 01             	lea    0x1(%edx),%eax
+  8048d9:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  8048de:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  8048e5:	83 ec 0c             	sub    $0xc,%esp
+  8048e8:	68 17 48 80 00       	push   $0x804817
+  8048ed:	e8 79 ff ff ff       	call   80486b <set_pgfault_handler>
+  8048f2:	83 c4 10             	add    $0x10,%esp
+}
+  8048f5:	c9                   	leave
+  8048f6:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  8048f7:	83 ec 04             	sub    $0x4,%esp
+  8048fa:	68 c9 58 80 00       	push   $0x8058c9
+  8048ff:	6a 44                	push   $0x44
+  804901:	68 bb 58 80 00       	push   $0x8058bb
+  804906:	e8 25 b9 ff ff       	call   800230 <_panic>
+
+0080490b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80490b:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80490c:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  804911:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804913:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  804916:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  80491a:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  80491e:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  804921:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  804923:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  804927:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  80492a:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  80492b:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  80492e:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  80492f:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  804930:	c3                   	ret
+
+00804931 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  804931:	55                   	push   %ebp
+  804932:	89 e5                	mov    %esp,%ebp
+  804934:	57                   	push   %edi
+  804935:	56                   	push   %esi
+  804936:	53                   	push   %ebx
+  804937:	83 ec 14             	sub    $0x14,%esp
+  80493a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80493d:	8b 75 14             	mov    0x14(%ebp),%esi
+  804940:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804943:	ff 75 10             	push   0x10(%ebp)
+  804946:	ff 75 0c             	push   0xc(%ebp)
+  804949:	e8 ba c8 ff ff       	call   801208 <sys_ipc_recv_pages>
+  80494e:	83 c4 10             	add    $0x10,%esp
+  804951:	85 c0                	test   %eax,%eax
+  804953:	78 46                	js     80499b <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804955:	85 ff                	test   %edi,%edi
+  804957:	74 0d                	je     804966 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804959:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80495e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804964:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804966:	85 f6                	test   %esi,%esi
+  804968:	74 0d                	je     804977 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  80496a:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80496f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804975:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804977:	85 db                	test   %ebx,%ebx
+  804979:	74 0d                	je     804988 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  80497b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804980:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804986:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804988:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80498d:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804993:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804996:	5b                   	pop    %ebx
+  804997:	5e                   	pop    %esi
+  804998:	5f                   	pop    %edi
+  804999:	5d                   	pop    %ebp
+  80499a:	c3                   	ret
+		if (from_env_store) {
+  80499b:	85 ff                	test   %edi,%edi
+  80499d:	74 06                	je     8049a5 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80499f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8049a5:	85 f6                	test   %esi,%esi
+  8049a7:	74 06                	je     8049af <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  8049a9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8049af:	85 db                	test   %ebx,%ebx
+  8049b1:	74 e0                	je     804993 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8049b3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8049b9:	eb d8                	jmp    804993 <ipc_recv_pages+0x62>
+
+008049bb <ipc_recv>:
+{
+  8049bb:	55                   	push   %ebp
+  8049bc:	89 e5                	mov    %esp,%ebp
+  8049be:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8049c1:	6a 00                	push   $0x0
+  8049c3:	ff 75 10             	push   0x10(%ebp)
+  8049c6:	6a 01                	push   $0x1
+  8049c8:	ff 75 0c             	push   0xc(%ebp)
+  8049cb:	ff 75 08             	push   0x8(%ebp)
+  8049ce:	e8 5e ff ff ff       	call   804931 <ipc_recv_pages>
+}
+  8049d3:	c9                   	leave
+  8049d4:	c3                   	ret
+
+008049d5 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8049d5:	55                   	push   %ebp
+  8049d6:	89 e5                	mov    %esp,%ebp
+  8049d8:	56                   	push   %esi
+  8049d9:	53                   	push   %ebx
+  8049da:	8b 75 08             	mov    0x8(%ebp),%esi
+  8049dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8049e0:	83 ec 0c             	sub    $0xc,%esp
+  8049e3:	ff 75 0c             	push   0xc(%ebp)
+  8049e6:	e8 51 c9 ff ff       	call   80133c <sys_ipc_try_recv>
+  8049eb:	83 c4 10             	add    $0x10,%esp
+  8049ee:	85 c0                	test   %eax,%eax
+  8049f0:	78 34                	js     804a26 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8049f2:	85 f6                	test   %esi,%esi
+  8049f4:	74 0d                	je     804a03 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8049f6:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049fb:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804a01:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  804a03:	85 db                	test   %ebx,%ebx
+  804a05:	74 0d                	je     804a14 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  804a07:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804a0c:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804a12:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804a14:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804a19:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804a1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804a22:	5b                   	pop    %ebx
+  804a23:	5e                   	pop    %esi
+  804a24:	5d                   	pop    %ebp
+  804a25:	c3                   	ret
+		if (from_env_store) {
+  804a26:	85 f6                	test   %esi,%esi
+  804a28:	74 06                	je     804a30 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  804a2a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  804a30:	85 db                	test   %ebx,%ebx
+  804a32:	74 eb                	je     804a1f <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  804a34:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804a3a:	eb e3                	jmp    804a1f <ipc_try_recv+0x4a>
+
+00804a3c <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804a3c:	55                   	push   %ebp
+  804a3d:	89 e5                	mov    %esp,%ebp
+  804a3f:	83 ec 14             	sub    $0x14,%esp
+  804a42:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804a45:	85 c0                	test   %eax,%eax
+  804a47:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804a4c:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804a4f:	ff 75 18             	push   0x18(%ebp)
+  804a52:	ff 75 14             	push   0x14(%ebp)
+  804a55:	50                   	push   %eax
+  804a56:	ff 75 0c             	push   0xc(%ebp)
+  804a59:	ff 75 08             	push   0x8(%ebp)
+  804a5c:	e8 6a c7 ff ff       	call   8011cb <sys_ipc_send_pages>
+  804a61:	83 c4 20             	add    $0x20,%esp
+  804a64:	85 c0                	test   %eax,%eax
+  804a66:	78 02                	js     804a6a <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804a68:	c9                   	leave
+  804a69:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804a6a:	50                   	push   %eax
+  804a6b:	68 e4 58 80 00       	push   $0x8058e4
+  804a70:	68 80 00 00 00       	push   $0x80
+  804a75:	68 10 59 80 00       	push   $0x805910
+  804a7a:	e8 b1 b7 ff ff       	call   800230 <_panic>
+
+00804a7f <ipc_send>:
+{
+  804a7f:	55                   	push   %ebp
+  804a80:	89 e5                	mov    %esp,%ebp
+  804a82:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  804a85:	ff 75 14             	push   0x14(%ebp)
+  804a88:	6a 01                	push   $0x1
+  804a8a:	ff 75 10             	push   0x10(%ebp)
+  804a8d:	ff 75 0c             	push   0xc(%ebp)
+  804a90:	ff 75 08             	push   0x8(%ebp)
+  804a93:	e8 a4 ff ff ff       	call   804a3c <ipc_send_pages>
+}
+  804a98:	83 c4 20             	add    $0x20,%esp
+  804a9b:	c9                   	leave
+  804a9c:	c3                   	ret
+
+00804a9d <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804a9d:	55                   	push   %ebp
+  804a9e:	89 e5                	mov    %esp,%ebp
+  804aa0:	83 ec 14             	sub    $0x14,%esp
+  804aa3:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804aa6:	85 c0                	test   %eax,%eax
+  804aa8:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804aad:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804ab0:	ff 75 18             	push   0x18(%ebp)
+  804ab3:	ff 75 14             	push   0x14(%ebp)
+  804ab6:	50                   	push   %eax
+  804ab7:	ff 75 0c             	push   0xc(%ebp)
+  804aba:	ff 75 08             	push   0x8(%ebp)
+  804abd:	e8 9a c7 ff ff       	call   80125c <sys_ipc_call>
+  804ac2:	83 c4 20             	add    $0x20,%esp
+  804ac5:	85 c0                	test   %eax,%eax
+  804ac7:	78 0b                	js     804ad4 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  804ac9:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804ace:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804ad4:	c9                   	leave
+  804ad5:	c3                   	ret
+
+00804ad6 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  804ad6:	55                   	push   %ebp
+  804ad7:	89 e5                	mov    %esp,%ebp
+  804ad9:	57                   	push   %edi
+  804ada:	56                   	push   %esi
+  804adb:	53                   	push   %ebx
+  804adc:	83 ec 18             	sub    $0x18,%esp
+  804adf:	8b 45 10             	mov    0x10(%ebp),%eax
+  804ae2:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  804ae5:	8b 75 20             	mov    0x20(%ebp),%esi
+  804ae8:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804aeb:	85 c0                	test   %eax,%eax
+  804aed:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804af2:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804af5:	ff 75 18             	push   0x18(%ebp)
+  804af8:	ff 75 14             	push   0x14(%ebp)
+  804afb:	50                   	push   %eax
+  804afc:	ff 75 0c             	push   0xc(%ebp)
+  804aff:	ff 75 08             	push   0x8(%ebp)
+  804b02:	e8 96 c7 ff ff       	call   80129d <sys_ipc_reply_recv>
+  804b07:	83 c4 20             	add    $0x20,%esp
+  804b0a:	85 c0                	test   %eax,%eax
+  804b0c:	78 46                	js     804b54 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804b0e:	85 ff                	test   %edi,%edi
+  804b10:	74 0d                	je     804b1f <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  804b12:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b17:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804b1d:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804b1f:	85 f6                	test   %esi,%esi
+  804b21:	74 0d                	je     804b30 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  804b23:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b28:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804b2e:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804b30:	85 db                	test   %ebx,%ebx
+  804b32:	74 0d                	je     804b41 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  804b34:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b39:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804b3f:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804b41:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b46:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804b4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b4f:	5b                   	pop    %ebx
+  804b50:	5e                   	pop    %esi
+  804b51:	5f                   	pop    %edi
+  804b52:	5d                   	pop    %ebp
+  804b53:	c3                   	ret
+		if (from_env_store) {
+  804b54:	85 ff                	test   %edi,%edi
+  804b56:	74 06                	je     804b5e <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  804b58:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804b5e:	85 f6                	test   %esi,%esi
+  804b60:	74 06                	je     804b68 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  804b62:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804b68:	85 db                	test   %ebx,%ebx
+  804b6a:	74 e0                	je     804b4c <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  804b6c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804b72:	eb d8                	jmp    804b4c <ipc_reply_recv+0x76>
+
+00804b74 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804b74:	55                   	push   %ebp
+  804b75:	89 e5                	mov    %esp,%ebp
+  804b77:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804b7a:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804b7f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804b82:	c1 e0 06             	shl    $0x6,%eax
+  804b85:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804b8a:	8b 40 50             	mov    0x50(%eax),%eax
+  804b8d:	39 c8                	cmp    %ecx,%eax
+  804b8f:	74 12                	je     804ba3 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804b91:	83 c2 01             	add    $0x1,%edx
+  804b94:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804b9a:	75 e3                	jne    804b7f <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804b9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ba1:	eb 0e                	jmp    804bb1 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804ba3:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804ba6:	c1 e0 06             	shl    $0x6,%eax
+  804ba9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804bae:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804bb1:	5d                   	pop    %ebp
+  804bb2:	c3                   	ret
+
+00804bb3 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804bb3:	55                   	push   %ebp
+  804bb4:	89 e5                	mov    %esp,%ebp
+  804bb6:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804bb9:	89 c2                	mov    %eax,%edx
+  804bbb:	c1 ea 16             	shr    $0x16,%edx
+  804bbe:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804bc5:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804bca:	f6 c1 01             	test   $0x1,%cl
+  804bcd:	74 1e                	je     804bed <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  804bcf:	c1 e8 0c             	shr    $0xc,%eax
+  804bd2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804bd9:	a8 01                	test   $0x1,%al
+  804bdb:	74 10                	je     804bed <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804bdd:	c1 e8 0c             	shr    $0xc,%eax
+  804be0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  804be3:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  804bea:	0f b7 d2             	movzwl %dx,%edx
+}
+  804bed:	89 d0                	mov    %edx,%eax
+  804bef:	5d                   	pop    %ebp
+  804bf0:	c3                   	ret
+
+00804bf1 <udivmod>:
+  804bf1:	55                   	push   %ebp
+  804bf2:	57                   	push   %edi
+  804bf3:	56                   	push   %esi
+  804bf4:	53                   	push   %ebx
+  804bf5:	83 ec 24             	sub    $0x24,%esp
+  804bf8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804bfc:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804c00:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804c04:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804c08:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804c0c:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804c10:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  804c14:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804c19:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c23:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804c2a:	00 
+  804c2b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804c32:	00 
+  804c33:	89 fb                	mov    %edi,%ebx
+  804c35:	eb 08                	jmp    804c3f <udivmod+0x4e>
+  804c37:	83 e9 01             	sub    $0x1,%ecx
+  804c3a:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804c3d:	74 68                	je     804ca7 <udivmod+0xb6>
+  804c3f:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804c43:	01 c0                	add    %eax,%eax
+  804c45:	89 c6                	mov    %eax,%esi
+  804c47:	89 d7                	mov    %edx,%edi
+  804c49:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804c4d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804c51:	0f ad d0             	shrd   %cl,%edx,%eax
+  804c54:	d3 ea                	shr    %cl,%edx
+  804c56:	f6 c1 20             	test   $0x20,%cl
+  804c59:	74 04                	je     804c5f <udivmod+0x6e>
+  804c5b:	89 d0                	mov    %edx,%eax
+  804c5d:	31 d2                	xor    %edx,%edx
+  804c5f:	83 e0 01             	and    $0x1,%eax
+  804c62:	89 04 24             	mov    %eax,(%esp)
+  804c65:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804c6c:	00 
+  804c6d:	8b 04 24             	mov    (%esp),%eax
+  804c70:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804c74:	09 f0                	or     %esi,%eax
+  804c76:	09 fa                	or     %edi,%edx
+  804c78:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804c7c:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804c80:	39 f0                	cmp    %esi,%eax
+  804c82:	89 d5                	mov    %edx,%ebp
+  804c84:	19 fd                	sbb    %edi,%ebp
+  804c86:	72 af                	jb     804c37 <udivmod+0x46>
+  804c88:	29 f0                	sub    %esi,%eax
+  804c8a:	19 fa                	sbb    %edi,%edx
+  804c8c:	89 cf                	mov    %ecx,%edi
+  804c8e:	c1 ef 05             	shr    $0x5,%edi
+  804c91:	83 e7 01             	and    $0x1,%edi
+  804c94:	89 fe                	mov    %edi,%esi
+  804c96:	83 f6 01             	xor    $0x1,%esi
+  804c99:	d3 e6                	shl    %cl,%esi
+  804c9b:	d3 e7                	shl    %cl,%edi
+  804c9d:	09 74 24 18          	or     %esi,0x18(%esp)
+  804ca1:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804ca5:	eb 90                	jmp    804c37 <udivmod+0x46>
+  804ca7:	85 db                	test   %ebx,%ebx
+  804ca9:	74 05                	je     804cb0 <udivmod+0xbf>
+  804cab:	89 03                	mov    %eax,(%ebx)
+  804cad:	89 53 04             	mov    %edx,0x4(%ebx)
+  804cb0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804cb4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804cb8:	83 c4 24             	add    $0x24,%esp
+  804cbb:	5b                   	pop    %ebx
+  804cbc:	5e                   	pop    %esi
+  804cbd:	5f                   	pop    %edi
+  804cbe:	5d                   	pop    %ebp
+  804cbf:	c3                   	ret
+
+00804cc0 <__udivdi3>:
+  804cc0:	83 ec 08             	sub    $0x8,%esp
+  804cc3:	6a 00                	push   $0x0
+  804cc5:	ff 74 24 1c          	push   0x1c(%esp)
+  804cc9:	ff 74 24 1c          	push   0x1c(%esp)
+  804ccd:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804cd1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804cd5:	e8 17 ff ff ff       	call   804bf1 <udivmod>
+  804cda:	83 c4 14             	add    $0x14,%esp
+  804cdd:	c3                   	ret
+
+00804cde <__umoddi3>:
+  804cde:	83 ec 18             	sub    $0x18,%esp
+  804ce1:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804ce5:	50                   	push   %eax
+  804ce6:	ff 74 24 2c          	push   0x2c(%esp)
+  804cea:	ff 74 24 2c          	push   0x2c(%esp)
+  804cee:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804cf2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804cf6:	e8 f6 fe ff ff       	call   804bf1 <udivmod>
+  804cfb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804cff:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804d03:	83 c4 24             	add    $0x24,%esp
+  804d06:	c3                   	ret
+
+00804d07 <__divdi3>:
+  804d07:	55                   	push   %ebp
+  804d08:	57                   	push   %edi
+  804d09:	56                   	push   %esi
+  804d0a:	53                   	push   %ebx
+  804d0b:	83 ec 10             	sub    $0x10,%esp
+  804d0e:	8b 44 24 24          	mov    0x24(%esp),%eax
+  804d12:	8b 54 24 28          	mov    0x28(%esp),%edx
+  804d16:	89 c6                	mov    %eax,%esi
+  804d18:	89 d7                	mov    %edx,%edi
+  804d1a:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  804d1e:	33 7c 24 30          	xor    0x30(%esp),%edi
+  804d22:	89 74 24 04          	mov    %esi,0x4(%esp)
+  804d26:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  804d2a:	89 c5                	mov    %eax,%ebp
+  804d2c:	f7 dd                	neg    %ebp
+  804d2e:	89 d6                	mov    %edx,%esi
+  804d30:	83 d6 00             	adc    $0x0,%esi
+  804d33:	f7 de                	neg    %esi
+  804d35:	0f 48 e8             	cmovs  %eax,%ebp
+  804d38:	0f 49 d6             	cmovns %esi,%edx
+  804d3b:	6a 00                	push   $0x0
+  804d3d:	8b 74 24 30          	mov    0x30(%esp),%esi
+  804d41:	f7 de                	neg    %esi
+  804d43:	8b 44 24 34          	mov    0x34(%esp),%eax
+  804d47:	83 d0 00             	adc    $0x0,%eax
+  804d4a:	f7 d8                	neg    %eax
+  804d4c:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  804d51:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  804d56:	50                   	push   %eax
+  804d57:	56                   	push   %esi
+  804d58:	89 e8                	mov    %ebp,%eax
+  804d5a:	e8 92 fe ff ff       	call   804bf1 <udivmod>
+  804d5f:	83 c4 10             	add    $0x10,%esp
+  804d62:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  804d67:	78 08                	js     804d71 <__divdi3+0x6a>
+  804d69:	83 c4 0c             	add    $0xc,%esp
+  804d6c:	5b                   	pop    %ebx
+  804d6d:	5e                   	pop    %esi
+  804d6e:	5f                   	pop    %edi
+  804d6f:	5d                   	pop    %ebp
+  804d70:	c3                   	ret
+  804d71:	f7 d8                	neg    %eax
+  804d73:	83 d2 00             	adc    $0x0,%edx
+  804d76:	f7 da                	neg    %edx
+  804d78:	eb ef                	jmp    804d69 <__divdi3+0x62>
+
+00804d7a <__moddi3>:
+  804d7a:	55                   	push   %ebp
+  804d7b:	57                   	push   %edi
+  804d7c:	56                   	push   %esi
+  804d7d:	53                   	push   %ebx
+  804d7e:	83 ec 18             	sub    $0x18,%esp
+  804d81:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  804d85:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  804d89:	89 f1                	mov    %esi,%ecx
+  804d8b:	f7 d9                	neg    %ecx
+  804d8d:	89 da                	mov    %ebx,%edx
+  804d8f:	83 d2 00             	adc    $0x0,%edx
+  804d92:	f7 da                	neg    %edx
+  804d94:	0f 48 ce             	cmovs  %esi,%ecx
+  804d97:	0f 48 d3             	cmovs  %ebx,%edx
+  804d9a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804d9e:	50                   	push   %eax
+  804d9f:	8b 74 24 38          	mov    0x38(%esp),%esi
+  804da3:	f7 de                	neg    %esi
+  804da5:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  804da9:	83 d0 00             	adc    $0x0,%eax
+  804dac:	f7 d8                	neg    %eax
+  804dae:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  804db3:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  804db8:	50                   	push   %eax
+  804db9:	56                   	push   %esi
+  804dba:	89 c8                	mov    %ecx,%eax
+  804dbc:	e8 30 fe ff ff       	call   804bf1 <udivmod>
+  804dc1:	83 c4 10             	add    $0x10,%esp
+  804dc4:	85 db                	test   %ebx,%ebx
+  804dc6:	78 10                	js     804dd8 <__moddi3+0x5e>
+  804dc8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804dcc:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804dd0:	83 c4 14             	add    $0x14,%esp
+  804dd3:	5b                   	pop    %ebx
+  804dd4:	5e                   	pop    %esi
+  804dd5:	5f                   	pop    %edi
+  804dd6:	5d                   	pop    %ebp
+  804dd7:	c3                   	ret
+  804dd8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804ddc:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804de0:	f7 d8                	neg    %eax
+  804de2:	83 d2 00             	adc    $0x0,%edx
+  804de5:	f7 da                	neg    %edx
+  804de7:	eb e7                	jmp    804dd0 <__moddi3+0x56>
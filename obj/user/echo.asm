@@ -0,0 +1,5640 @@
+
+obj/user/echo.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b3 00 00 00       	call   8000e4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80003f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int i, nflag;
+
+	nflag = 0;
+  800042:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800049:	83 ff 01             	cmp    $0x1,%edi
+  80004c:	7f 07                	jg     800055 <umain+0x22>
+		nflag = 1;
+		argc--;
+		argv++;
+	}
+	for (i = 1; i < argc; i++) {
+  80004e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800053:	eb 4c                	jmp    8000a1 <umain+0x6e>
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	68 40 27 80 00       	push   $0x802740
+  80005d:	ff 76 04             	push   0x4(%esi)
+  800060:	e8 ce 01 00 00       	call   800233 <strcmp>
+  800065:	83 c4 10             	add    $0x10,%esp
+	nflag = 0;
+  800068:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	75 db                	jne    80004e <umain+0x1b>
+		argc--;
+  800073:	83 ef 01             	sub    $0x1,%edi
+		argv++;
+  800076:	83 c6 04             	add    $0x4,%esi
+		nflag = 1;
+  800079:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  800080:	eb cc                	jmp    80004e <umain+0x1b>
+		if (i > 1)
+			write(1, " ", 1);
+		write(1, argv[i], strlen(argv[i]));
+  800082:	83 ec 0c             	sub    $0xc,%esp
+  800085:	ff 34 9e             	push   (%esi,%ebx,4)
+  800088:	e8 ba 00 00 00       	call   800147 <strlen>
+  80008d:	83 c4 0c             	add    $0xc,%esp
+  800090:	50                   	push   %eax
+  800091:	ff 34 9e             	push   (%esi,%ebx,4)
+  800094:	6a 01                	push   $0x1
+  800096:	e8 1d 0f 00 00       	call   800fb8 <write>
+	for (i = 1; i < argc; i++) {
+  80009b:	83 c3 01             	add    $0x1,%ebx
+  80009e:	83 c4 10             	add    $0x10,%esp
+  8000a1:	39 df                	cmp    %ebx,%edi
+  8000a3:	7e 1b                	jle    8000c0 <umain+0x8d>
+		if (i > 1)
+  8000a5:	83 fb 01             	cmp    $0x1,%ebx
+  8000a8:	7e d8                	jle    800082 <umain+0x4f>
+			write(1, " ", 1);
+  8000aa:	83 ec 04             	sub    $0x4,%esp
+  8000ad:	6a 01                	push   $0x1
+  8000af:	68 43 27 80 00       	push   $0x802743
+  8000b4:	6a 01                	push   $0x1
+  8000b6:	e8 fd 0e 00 00       	call   800fb8 <write>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	eb c2                	jmp    800082 <umain+0x4f>
+	}
+	if (!nflag)
+  8000c0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8000c4:	74 08                	je     8000ce <umain+0x9b>
+		write(1, "\n", 1);
+}
+  8000c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000c9:	5b                   	pop    %ebx
+  8000ca:	5e                   	pop    %esi
+  8000cb:	5f                   	pop    %edi
+  8000cc:	5d                   	pop    %ebp
+  8000cd:	c3                   	ret
+		write(1, "\n", 1);
+  8000ce:	83 ec 04             	sub    $0x4,%esp
+  8000d1:	6a 01                	push   $0x1
+  8000d3:	68 53 28 80 00       	push   $0x802853
+  8000d8:	6a 01                	push   $0x1
+  8000da:	e8 d9 0e 00 00       	call   800fb8 <write>
+  8000df:	83 c4 10             	add    $0x10,%esp
+}
+  8000e2:	eb e2                	jmp    8000c6 <umain+0x93>
+
+008000e4 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e4:	55                   	push   %ebp
+  8000e5:	89 e5                	mov    %esp,%ebp
+  8000e7:	56                   	push   %esi
+  8000e8:	53                   	push   %ebx
+  8000e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8000ef:	e8 43 05 00 00       	call   800637 <sys_getenvid>
+  8000f4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8000fc:	c1 e0 06             	shl    $0x6,%eax
+  8000ff:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800104:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800109:	85 db                	test   %ebx,%ebx
+  80010b:	7e 07                	jle    800114 <libmain+0x30>
+		binaryname = argv[0];
+  80010d:	8b 06                	mov    (%esi),%eax
+  80010f:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	56                   	push   %esi
+  800118:	53                   	push   %ebx
+  800119:	e8 15 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80011e:	e8 0a 00 00 00       	call   80012d <exit>
+}
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800129:	5b                   	pop    %ebx
+  80012a:	5e                   	pop    %esi
+  80012b:	5d                   	pop    %ebp
+  80012c:	c3                   	ret
+
+0080012d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800133:	e8 a3 0c 00 00       	call   800ddb <close_all>
+	sys_env_destroy(0);
+  800138:	83 ec 0c             	sub    $0xc,%esp
+  80013b:	6a 00                	push   $0x0
+  80013d:	e8 b4 04 00 00       	call   8005f6 <sys_env_destroy>
+}
+  800142:	83 c4 10             	add    $0x10,%esp
+  800145:	c9                   	leave
+  800146:	c3                   	ret
+
+00800147 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800147:	55                   	push   %ebp
+  800148:	89 e5                	mov    %esp,%ebp
+  80014a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80014d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800152:	eb 03                	jmp    800157 <strlen+0x10>
+		n++;
+  800154:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800157:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80015b:	75 f7                	jne    800154 <strlen+0xd>
+	return n;
+}
+  80015d:	5d                   	pop    %ebp
+  80015e:	c3                   	ret
+
+0080015f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80015f:	55                   	push   %ebp
+  800160:	89 e5                	mov    %esp,%ebp
+  800162:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800165:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800168:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016d:	eb 03                	jmp    800172 <strnlen+0x13>
+		n++;
+  80016f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800172:	39 d0                	cmp    %edx,%eax
+  800174:	74 08                	je     80017e <strnlen+0x1f>
+  800176:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80017a:	75 f3                	jne    80016f <strnlen+0x10>
+  80017c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80017e:	89 d0                	mov    %edx,%eax
+  800180:	5d                   	pop    %ebp
+  800181:	c3                   	ret
+
+00800182 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800182:	55                   	push   %ebp
+  800183:	89 e5                	mov    %esp,%ebp
+  800185:	53                   	push   %ebx
+  800186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800195:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800198:	83 c0 01             	add    $0x1,%eax
+  80019b:	84 d2                	test   %dl,%dl
+  80019d:	75 f2                	jne    800191 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80019f:	89 c8                	mov    %ecx,%eax
+  8001a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001a4:	c9                   	leave
+  8001a5:	c3                   	ret
+
+008001a6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8001a6:	55                   	push   %ebp
+  8001a7:	89 e5                	mov    %esp,%ebp
+  8001a9:	53                   	push   %ebx
+  8001aa:	83 ec 10             	sub    $0x10,%esp
+  8001ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8001b0:	53                   	push   %ebx
+  8001b1:	e8 91 ff ff ff       	call   800147 <strlen>
+  8001b6:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8001b9:	ff 75 0c             	push   0xc(%ebp)
+  8001bc:	01 d8                	add    %ebx,%eax
+  8001be:	50                   	push   %eax
+  8001bf:	e8 be ff ff ff       	call   800182 <strcpy>
+	return dst;
+}
+  8001c4:	89 d8                	mov    %ebx,%eax
+  8001c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001c9:	c9                   	leave
+  8001ca:	c3                   	ret
+
+008001cb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8001cb:	55                   	push   %ebp
+  8001cc:	89 e5                	mov    %esp,%ebp
+  8001ce:	56                   	push   %esi
+  8001cf:	53                   	push   %ebx
+  8001d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8001d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8001d6:	89 f3                	mov    %esi,%ebx
+  8001d8:	03 5d 10             	add    0x10(%ebp),%ebx
+  8001db:	89 f0                	mov    %esi,%eax
+  8001dd:	eb 0f                	jmp    8001ee <strncpy+0x23>
+		*dst++ = *src;
+  8001df:	83 c0 01             	add    $0x1,%eax
+  8001e2:	0f b6 0a             	movzbl (%edx),%ecx
+  8001e5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8001e8:	80 f9 01             	cmp    $0x1,%cl
+  8001eb:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8001ee:	39 d8                	cmp    %ebx,%eax
+  8001f0:	75 ed                	jne    8001df <strncpy+0x14>
+	}
+	return ret;
+}
+  8001f2:	89 f0                	mov    %esi,%eax
+  8001f4:	5b                   	pop    %ebx
+  8001f5:	5e                   	pop    %esi
+  8001f6:	5d                   	pop    %ebp
+  8001f7:	c3                   	ret
+
+008001f8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8001f8:	55                   	push   %ebp
+  8001f9:	89 e5                	mov    %esp,%ebp
+  8001fb:	56                   	push   %esi
+  8001fc:	53                   	push   %ebx
+  8001fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800200:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800203:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800206:	89 f0                	mov    %esi,%eax
+  800208:	85 d2                	test   %edx,%edx
+  80020a:	74 21                	je     80022d <strlcpy+0x35>
+  80020c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800210:	89 f2                	mov    %esi,%edx
+  800212:	eb 09                	jmp    80021d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800214:	83 c1 01             	add    $0x1,%ecx
+  800217:	83 c2 01             	add    $0x1,%edx
+  80021a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80021d:	39 c2                	cmp    %eax,%edx
+  80021f:	74 09                	je     80022a <strlcpy+0x32>
+  800221:	0f b6 19             	movzbl (%ecx),%ebx
+  800224:	84 db                	test   %bl,%bl
+  800226:	75 ec                	jne    800214 <strlcpy+0x1c>
+  800228:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80022a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80022d:	29 f0                	sub    %esi,%eax
+}
+  80022f:	5b                   	pop    %ebx
+  800230:	5e                   	pop    %esi
+  800231:	5d                   	pop    %ebp
+  800232:	c3                   	ret
+
+00800233 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800233:	55                   	push   %ebp
+  800234:	89 e5                	mov    %esp,%ebp
+  800236:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800239:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80023c:	eb 06                	jmp    800244 <strcmp+0x11>
+		p++, q++;
+  80023e:	83 c1 01             	add    $0x1,%ecx
+  800241:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800244:	0f b6 01             	movzbl (%ecx),%eax
+  800247:	84 c0                	test   %al,%al
+  800249:	74 04                	je     80024f <strcmp+0x1c>
+  80024b:	3a 02                	cmp    (%edx),%al
+  80024d:	74 ef                	je     80023e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80024f:	0f b6 c0             	movzbl %al,%eax
+  800252:	0f b6 12             	movzbl (%edx),%edx
+  800255:	29 d0                	sub    %edx,%eax
+}
+  800257:	5d                   	pop    %ebp
+  800258:	c3                   	ret
+
+00800259 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800259:	55                   	push   %ebp
+  80025a:	89 e5                	mov    %esp,%ebp
+  80025c:	53                   	push   %ebx
+  80025d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800260:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800263:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800266:	eb 09                	jmp    800271 <strncmp+0x18>
+		n--, p++, q++;
+  800268:	83 ea 01             	sub    $0x1,%edx
+  80026b:	83 c0 01             	add    $0x1,%eax
+  80026e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800271:	85 d2                	test   %edx,%edx
+  800273:	74 18                	je     80028d <strncmp+0x34>
+  800275:	0f b6 18             	movzbl (%eax),%ebx
+  800278:	84 db                	test   %bl,%bl
+  80027a:	74 04                	je     800280 <strncmp+0x27>
+  80027c:	3a 19                	cmp    (%ecx),%bl
+  80027e:	74 e8                	je     800268 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800280:	0f b6 00             	movzbl (%eax),%eax
+  800283:	0f b6 11             	movzbl (%ecx),%edx
+  800286:	29 d0                	sub    %edx,%eax
+}
+  800288:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80028b:	c9                   	leave
+  80028c:	c3                   	ret
+		return 0;
+  80028d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800292:	eb f4                	jmp    800288 <strncmp+0x2f>
+
+00800294 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800294:	55                   	push   %ebp
+  800295:	89 e5                	mov    %esp,%ebp
+  800297:	8b 45 08             	mov    0x8(%ebp),%eax
+  80029a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80029e:	eb 03                	jmp    8002a3 <strchr+0xf>
+  8002a0:	83 c0 01             	add    $0x1,%eax
+  8002a3:	0f b6 10             	movzbl (%eax),%edx
+  8002a6:	84 d2                	test   %dl,%dl
+  8002a8:	74 06                	je     8002b0 <strchr+0x1c>
+		if (*s == c)
+  8002aa:	38 ca                	cmp    %cl,%dl
+  8002ac:	75 f2                	jne    8002a0 <strchr+0xc>
+  8002ae:	eb 05                	jmp    8002b5 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8002b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8002b5:	5d                   	pop    %ebp
+  8002b6:	c3                   	ret
+
+008002b7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8002b7:	55                   	push   %ebp
+  8002b8:	89 e5                	mov    %esp,%ebp
+  8002ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002bd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8002c1:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8002c4:	38 ca                	cmp    %cl,%dl
+  8002c6:	74 09                	je     8002d1 <strfind+0x1a>
+  8002c8:	84 d2                	test   %dl,%dl
+  8002ca:	74 05                	je     8002d1 <strfind+0x1a>
+	for (; *s; s++)
+  8002cc:	83 c0 01             	add    $0x1,%eax
+  8002cf:	eb f0                	jmp    8002c1 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8002d1:	5d                   	pop    %ebp
+  8002d2:	c3                   	ret
+
+008002d3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8002d3:	55                   	push   %ebp
+  8002d4:	89 e5                	mov    %esp,%ebp
+  8002d6:	57                   	push   %edi
+  8002d7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002da:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8002dd:	85 c9                	test   %ecx,%ecx
+  8002df:	74 20                	je     800301 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8002e1:	89 f8                	mov    %edi,%eax
+  8002e3:	09 c8                	or     %ecx,%eax
+  8002e5:	a8 03                	test   $0x3,%al
+  8002e7:	75 12                	jne    8002fb <memset+0x28>
+		c &= 0xFF;
+  8002e9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8002ed:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8002f3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8002f6:	fc                   	cld
+  8002f7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8002f9:	eb 06                	jmp    800301 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8002fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002fe:	fc                   	cld
+  8002ff:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800301:	89 f8                	mov    %edi,%eax
+  800303:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800306:	c9                   	leave
+  800307:	c3                   	ret
+
+00800308 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800308:	55                   	push   %ebp
+  800309:	89 e5                	mov    %esp,%ebp
+  80030b:	57                   	push   %edi
+  80030c:	56                   	push   %esi
+  80030d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800310:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800313:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800316:	39 c6                	cmp    %eax,%esi
+  800318:	73 32                	jae    80034c <memmove+0x44>
+  80031a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80031d:	39 d0                	cmp    %edx,%eax
+  80031f:	73 2b                	jae    80034c <memmove+0x44>
+		s += n;
+		d += n;
+  800321:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800324:	89 d6                	mov    %edx,%esi
+  800326:	09 fe                	or     %edi,%esi
+  800328:	09 ce                	or     %ecx,%esi
+  80032a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800330:	75 0e                	jne    800340 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800332:	83 ef 04             	sub    $0x4,%edi
+  800335:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800338:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80033b:	fd                   	std
+  80033c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80033e:	eb 09                	jmp    800349 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800340:	83 ef 01             	sub    $0x1,%edi
+  800343:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800346:	fd                   	std
+  800347:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800349:	fc                   	cld
+  80034a:	eb 1a                	jmp    800366 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80034c:	89 f2                	mov    %esi,%edx
+  80034e:	09 c2                	or     %eax,%edx
+  800350:	09 ca                	or     %ecx,%edx
+  800352:	f6 c2 03             	test   $0x3,%dl
+  800355:	75 0a                	jne    800361 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800357:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80035a:	89 c7                	mov    %eax,%edi
+  80035c:	fc                   	cld
+  80035d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80035f:	eb 05                	jmp    800366 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800361:	89 c7                	mov    %eax,%edi
+  800363:	fc                   	cld
+  800364:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800366:	5e                   	pop    %esi
+  800367:	5f                   	pop    %edi
+  800368:	5d                   	pop    %ebp
+  800369:	c3                   	ret
+
+0080036a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80036a:	55                   	push   %ebp
+  80036b:	89 e5                	mov    %esp,%ebp
+  80036d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800370:	ff 75 10             	push   0x10(%ebp)
+  800373:	ff 75 0c             	push   0xc(%ebp)
+  800376:	ff 75 08             	push   0x8(%ebp)
+  800379:	e8 8a ff ff ff       	call   800308 <memmove>
+}
+  80037e:	c9                   	leave
+  80037f:	c3                   	ret
+
+00800380 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800380:	55                   	push   %ebp
+  800381:	89 e5                	mov    %esp,%ebp
+  800383:	56                   	push   %esi
+  800384:	53                   	push   %ebx
+  800385:	8b 45 08             	mov    0x8(%ebp),%eax
+  800388:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80038b:	89 c6                	mov    %eax,%esi
+  80038d:	03 75 10             	add    0x10(%ebp),%esi
+  800390:	eb 06                	jmp    800398 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800392:	83 c0 01             	add    $0x1,%eax
+  800395:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800398:	39 f0                	cmp    %esi,%eax
+  80039a:	74 14                	je     8003b0 <memcmp+0x30>
+		if (*s1 != *s2)
+  80039c:	0f b6 08             	movzbl (%eax),%ecx
+  80039f:	0f b6 1a             	movzbl (%edx),%ebx
+  8003a2:	38 d9                	cmp    %bl,%cl
+  8003a4:	74 ec                	je     800392 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8003a6:	0f b6 c1             	movzbl %cl,%eax
+  8003a9:	0f b6 db             	movzbl %bl,%ebx
+  8003ac:	29 d8                	sub    %ebx,%eax
+  8003ae:	eb 05                	jmp    8003b5 <memcmp+0x35>
+	}
+
+	return 0;
+  8003b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003b5:	5b                   	pop    %ebx
+  8003b6:	5e                   	pop    %esi
+  8003b7:	5d                   	pop    %ebp
+  8003b8:	c3                   	ret
+
+008003b9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8003b9:	55                   	push   %ebp
+  8003ba:	89 e5                	mov    %esp,%ebp
+  8003bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8003c2:	89 c2                	mov    %eax,%edx
+  8003c4:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8003c7:	eb 03                	jmp    8003cc <memfind+0x13>
+  8003c9:	83 c0 01             	add    $0x1,%eax
+  8003cc:	39 d0                	cmp    %edx,%eax
+  8003ce:	73 04                	jae    8003d4 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8003d0:	38 08                	cmp    %cl,(%eax)
+  8003d2:	75 f5                	jne    8003c9 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8003d4:	5d                   	pop    %ebp
+  8003d5:	c3                   	ret
+
+008003d6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8003d6:	55                   	push   %ebp
+  8003d7:	89 e5                	mov    %esp,%ebp
+  8003d9:	57                   	push   %edi
+  8003da:	56                   	push   %esi
+  8003db:	53                   	push   %ebx
+  8003dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8003e2:	eb 03                	jmp    8003e7 <strtol+0x11>
+		s++;
+  8003e4:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8003e7:	0f b6 02             	movzbl (%edx),%eax
+  8003ea:	3c 20                	cmp    $0x20,%al
+  8003ec:	74 f6                	je     8003e4 <strtol+0xe>
+  8003ee:	3c 09                	cmp    $0x9,%al
+  8003f0:	74 f2                	je     8003e4 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8003f2:	3c 2b                	cmp    $0x2b,%al
+  8003f4:	74 2a                	je     800420 <strtol+0x4a>
+	int neg = 0;
+  8003f6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8003fb:	3c 2d                	cmp    $0x2d,%al
+  8003fd:	74 2b                	je     80042a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8003ff:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800405:	75 0f                	jne    800416 <strtol+0x40>
+  800407:	80 3a 30             	cmpb   $0x30,(%edx)
+  80040a:	74 28                	je     800434 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80040c:	85 db                	test   %ebx,%ebx
+  80040e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800413:	0f 44 d8             	cmove  %eax,%ebx
+  800416:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80041b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80041e:	eb 46                	jmp    800466 <strtol+0x90>
+		s++;
+  800420:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800423:	bf 00 00 00 00       	mov    $0x0,%edi
+  800428:	eb d5                	jmp    8003ff <strtol+0x29>
+		s++, neg = 1;
+  80042a:	83 c2 01             	add    $0x1,%edx
+  80042d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800432:	eb cb                	jmp    8003ff <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800434:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800438:	74 0e                	je     800448 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  80043a:	85 db                	test   %ebx,%ebx
+  80043c:	75 d8                	jne    800416 <strtol+0x40>
+		s++, base = 8;
+  80043e:	83 c2 01             	add    $0x1,%edx
+  800441:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800446:	eb ce                	jmp    800416 <strtol+0x40>
+		s += 2, base = 16;
+  800448:	83 c2 02             	add    $0x2,%edx
+  80044b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800450:	eb c4                	jmp    800416 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800452:	0f be c0             	movsbl %al,%eax
+  800455:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800458:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80045b:	7d 3a                	jge    800497 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  80045d:	83 c2 01             	add    $0x1,%edx
+  800460:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800464:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800466:	0f b6 02             	movzbl (%edx),%eax
+  800469:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80046c:	89 f3                	mov    %esi,%ebx
+  80046e:	80 fb 09             	cmp    $0x9,%bl
+  800471:	76 df                	jbe    800452 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800473:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800476:	89 f3                	mov    %esi,%ebx
+  800478:	80 fb 19             	cmp    $0x19,%bl
+  80047b:	77 08                	ja     800485 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  80047d:	0f be c0             	movsbl %al,%eax
+  800480:	83 e8 57             	sub    $0x57,%eax
+  800483:	eb d3                	jmp    800458 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800485:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800488:	89 f3                	mov    %esi,%ebx
+  80048a:	80 fb 19             	cmp    $0x19,%bl
+  80048d:	77 08                	ja     800497 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80048f:	0f be c0             	movsbl %al,%eax
+  800492:	83 e8 37             	sub    $0x37,%eax
+  800495:	eb c1                	jmp    800458 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800497:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80049b:	74 05                	je     8004a2 <strtol+0xcc>
+		*endptr = (char *) s;
+  80049d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8004a0:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8004a2:	89 c8                	mov    %ecx,%eax
+  8004a4:	f7 d8                	neg    %eax
+  8004a6:	85 ff                	test   %edi,%edi
+  8004a8:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8004ab:	89 c8                	mov    %ecx,%eax
+  8004ad:	5b                   	pop    %ebx
+  8004ae:	5e                   	pop    %esi
+  8004af:	5f                   	pop    %edi
+  8004b0:	5d                   	pop    %ebp
+  8004b1:	c3                   	ret
+
+008004b2 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  8004b2:	55                   	push   %ebp
+  8004b3:	89 e5                	mov    %esp,%ebp
+  8004b5:	57                   	push   %edi
+  8004b6:	56                   	push   %esi
+  8004b7:	53                   	push   %ebx
+  8004b8:	83 ec 0c             	sub    $0xc,%esp
+  8004bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004be:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8004c1:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  8004c4:	85 ff                	test   %edi,%edi
+  8004c6:	74 16                	je     8004de <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  8004c8:	83 ec 04             	sub    $0x4,%esp
+  8004cb:	56                   	push   %esi
+  8004cc:	6a 00                	push   $0x0
+  8004ce:	53                   	push   %ebx
+  8004cf:	e8 02 ff ff ff       	call   8003d6 <strtol>
+  8004d4:	89 07                	mov    %eax,(%edi)
+  8004d6:	83 c4 10             	add    $0x10,%esp
+  8004d9:	eb 03                	jmp    8004de <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  8004db:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  8004de:	0f b6 03             	movzbl (%ebx),%eax
+  8004e1:	3c 20                	cmp    $0x20,%al
+  8004e3:	74 f6                	je     8004db <strisl+0x29>
+  8004e5:	3c 09                	cmp    $0x9,%al
+  8004e7:	74 f2                	je     8004db <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  8004e9:	3c 2b                	cmp    $0x2b,%al
+  8004eb:	74 23                	je     800510 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  8004ed:	3c 2d                	cmp    $0x2d,%al
+  8004ef:	0f 94 c0             	sete   %al
+  8004f2:	0f b6 c0             	movzbl %al,%eax
+  8004f5:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8004f7:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  8004fd:	75 41                	jne    800540 <strisl+0x8e>
+  8004ff:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800502:	74 11                	je     800515 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800504:	85 f6                	test   %esi,%esi
+  800506:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80050b:	0f 44 f0             	cmove  %eax,%esi
+  80050e:	eb 30                	jmp    800540 <strisl+0x8e>
+		s++;
+  800510:	83 c3 01             	add    $0x1,%ebx
+  800513:	eb e2                	jmp    8004f7 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800515:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800519:	74 0e                	je     800529 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  80051b:	85 f6                	test   %esi,%esi
+  80051d:	75 21                	jne    800540 <strisl+0x8e>
+		s++, base = 8;
+  80051f:	83 c3 01             	add    $0x1,%ebx
+  800522:	be 08 00 00 00       	mov    $0x8,%esi
+  800527:	eb 17                	jmp    800540 <strisl+0x8e>
+		s += 2, base = 16;
+  800529:	83 c3 02             	add    $0x2,%ebx
+  80052c:	be 10 00 00 00       	mov    $0x10,%esi
+  800531:	eb 0d                	jmp    800540 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800533:	0f be c0             	movsbl %al,%eax
+  800536:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800539:	39 f0                	cmp    %esi,%eax
+  80053b:	7d 38                	jge    800575 <strisl+0xc3>
+			return 0;
+		s++;
+  80053d:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800540:	0f b6 03             	movzbl (%ebx),%eax
+  800543:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800546:	80 fa 09             	cmp    $0x9,%dl
+  800549:	76 e8                	jbe    800533 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  80054b:	8d 50 9f             	lea    -0x61(%eax),%edx
+  80054e:	80 fa 19             	cmp    $0x19,%dl
+  800551:	77 08                	ja     80055b <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800553:	0f be c0             	movsbl %al,%eax
+  800556:	83 e8 57             	sub    $0x57,%eax
+  800559:	eb de                	jmp    800539 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  80055b:	8d 50 bf             	lea    -0x41(%eax),%edx
+  80055e:	80 fa 19             	cmp    $0x19,%dl
+  800561:	77 08                	ja     80056b <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800563:	0f be c0             	movsbl %al,%eax
+  800566:	83 e8 37             	sub    $0x37,%eax
+  800569:	eb ce                	jmp    800539 <strisl+0x87>
+		else if (!*s)
+  80056b:	84 c0                	test   %al,%al
+  80056d:	0f 94 c0             	sete   %al
+  800570:	0f b6 c0             	movzbl %al,%eax
+  800573:	eb 05                	jmp    80057a <strisl+0xc8>
+			return 0;
+  800575:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  80057a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80057d:	5b                   	pop    %ebx
+  80057e:	5e                   	pop    %esi
+  80057f:	5f                   	pop    %edi
+  800580:	5d                   	pop    %ebp
+  800581:	c3                   	ret
+
+00800582 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800582:	55                   	push   %ebp
+  800583:	89 e5                	mov    %esp,%ebp
+  800585:	83 ec 10             	sub    $0x10,%esp
+  800588:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  80058b:	89 c8                	mov    %ecx,%eax
+  80058d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800592:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800595:	eb 0b                	jmp    8005a2 <touch_mem+0x20>
+		c = *(char *)page;
+  800597:	0f b6 10             	movzbl (%eax),%edx
+  80059a:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  80059d:	05 00 10 00 00       	add    $0x1000,%eax
+  8005a2:	39 c8                	cmp    %ecx,%eax
+  8005a4:	72 f1                	jb     800597 <touch_mem+0x15>
+}
+  8005a6:	c9                   	leave
+  8005a7:	c3                   	ret
+
+008005a8 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8005a8:	55                   	push   %ebp
+  8005a9:	89 e5                	mov    %esp,%ebp
+  8005ab:	57                   	push   %edi
+  8005ac:	56                   	push   %esi
+  8005ad:	53                   	push   %ebx
+	touch_mem(s, len);
+  8005ae:	ff 75 0c             	push   0xc(%ebp)
+  8005b1:	ff 75 08             	push   0x8(%ebp)
+  8005b4:	e8 c9 ff ff ff       	call   800582 <touch_mem>
+	asm volatile("int %1\n"
+  8005b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005c4:	89 c3                	mov    %eax,%ebx
+  8005c6:	89 c7                	mov    %eax,%edi
+  8005c8:	89 c6                	mov    %eax,%esi
+  8005ca:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8005cc:	83 c4 08             	add    $0x8,%esp
+  8005cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005d2:	5b                   	pop    %ebx
+  8005d3:	5e                   	pop    %esi
+  8005d4:	5f                   	pop    %edi
+  8005d5:	5d                   	pop    %ebp
+  8005d6:	c3                   	ret
+
+008005d7 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8005d7:	55                   	push   %ebp
+  8005d8:	89 e5                	mov    %esp,%ebp
+  8005da:	57                   	push   %edi
+  8005db:	56                   	push   %esi
+  8005dc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005e2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005e7:	89 d1                	mov    %edx,%ecx
+  8005e9:	89 d3                	mov    %edx,%ebx
+  8005eb:	89 d7                	mov    %edx,%edi
+  8005ed:	89 d6                	mov    %edx,%esi
+  8005ef:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8005f1:	5b                   	pop    %ebx
+  8005f2:	5e                   	pop    %esi
+  8005f3:	5f                   	pop    %edi
+  8005f4:	5d                   	pop    %ebp
+  8005f5:	c3                   	ret
+
+008005f6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8005f6:	55                   	push   %ebp
+  8005f7:	89 e5                	mov    %esp,%ebp
+  8005f9:	57                   	push   %edi
+  8005fa:	56                   	push   %esi
+  8005fb:	53                   	push   %ebx
+  8005fc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8005ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800604:	8b 55 08             	mov    0x8(%ebp),%edx
+  800607:	b8 03 00 00 00       	mov    $0x3,%eax
+  80060c:	89 cb                	mov    %ecx,%ebx
+  80060e:	89 cf                	mov    %ecx,%edi
+  800610:	89 ce                	mov    %ecx,%esi
+  800612:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800614:	85 c0                	test   %eax,%eax
+  800616:	7f 08                	jg     800620 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800618:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80061b:	5b                   	pop    %ebx
+  80061c:	5e                   	pop    %esi
+  80061d:	5f                   	pop    %edi
+  80061e:	5d                   	pop    %ebp
+  80061f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800620:	83 ec 0c             	sub    $0xc,%esp
+  800623:	50                   	push   %eax
+  800624:	6a 03                	push   $0x3
+  800626:	68 4f 27 80 00       	push   $0x80274f
+  80062b:	6a 23                	push   $0x23
+  80062d:	68 6c 27 80 00       	push   $0x80276c
+  800632:	e8 b9 15 00 00       	call   801bf0 <_panic>
+
+00800637 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800637:	55                   	push   %ebp
+  800638:	89 e5                	mov    %esp,%ebp
+  80063a:	57                   	push   %edi
+  80063b:	56                   	push   %esi
+  80063c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80063d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800642:	b8 02 00 00 00       	mov    $0x2,%eax
+  800647:	89 d1                	mov    %edx,%ecx
+  800649:	89 d3                	mov    %edx,%ebx
+  80064b:	89 d7                	mov    %edx,%edi
+  80064d:	89 d6                	mov    %edx,%esi
+  80064f:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800651:	5b                   	pop    %ebx
+  800652:	5e                   	pop    %esi
+  800653:	5f                   	pop    %edi
+  800654:	5d                   	pop    %ebp
+  800655:	c3                   	ret
+
+00800656 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800656:	55                   	push   %ebp
+  800657:	89 e5                	mov    %esp,%ebp
+  800659:	57                   	push   %edi
+  80065a:	56                   	push   %esi
+  80065b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80065c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800661:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800666:	89 d1                	mov    %edx,%ecx
+  800668:	89 d3                	mov    %edx,%ebx
+  80066a:	89 d7                	mov    %edx,%edi
+  80066c:	89 d6                	mov    %edx,%esi
+  80066e:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800670:	5b                   	pop    %ebx
+  800671:	5e                   	pop    %esi
+  800672:	5f                   	pop    %edi
+  800673:	5d                   	pop    %ebp
+  800674:	c3                   	ret
+
+00800675 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800675:	55                   	push   %ebp
+  800676:	89 e5                	mov    %esp,%ebp
+  800678:	57                   	push   %edi
+  800679:	56                   	push   %esi
+  80067a:	53                   	push   %ebx
+  80067b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80067e:	be 00 00 00 00       	mov    $0x0,%esi
+  800683:	8b 55 08             	mov    0x8(%ebp),%edx
+  800686:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800689:	b8 04 00 00 00       	mov    $0x4,%eax
+  80068e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800691:	89 f7                	mov    %esi,%edi
+  800693:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800695:	85 c0                	test   %eax,%eax
+  800697:	7f 08                	jg     8006a1 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800699:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80069c:	5b                   	pop    %ebx
+  80069d:	5e                   	pop    %esi
+  80069e:	5f                   	pop    %edi
+  80069f:	5d                   	pop    %ebp
+  8006a0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006a1:	83 ec 0c             	sub    $0xc,%esp
+  8006a4:	50                   	push   %eax
+  8006a5:	6a 04                	push   $0x4
+  8006a7:	68 4f 27 80 00       	push   $0x80274f
+  8006ac:	6a 23                	push   $0x23
+  8006ae:	68 6c 27 80 00       	push   $0x80276c
+  8006b3:	e8 38 15 00 00       	call   801bf0 <_panic>
+
+008006b8 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8006b8:	55                   	push   %ebp
+  8006b9:	89 e5                	mov    %esp,%ebp
+  8006bb:	57                   	push   %edi
+  8006bc:	56                   	push   %esi
+  8006bd:	53                   	push   %ebx
+  8006be:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8006c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006c7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8006cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8006cf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006d2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8006d5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8006d7:	85 c0                	test   %eax,%eax
+  8006d9:	7f 08                	jg     8006e3 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8006db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006de:	5b                   	pop    %ebx
+  8006df:	5e                   	pop    %esi
+  8006e0:	5f                   	pop    %edi
+  8006e1:	5d                   	pop    %ebp
+  8006e2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006e3:	83 ec 0c             	sub    $0xc,%esp
+  8006e6:	50                   	push   %eax
+  8006e7:	6a 05                	push   $0x5
+  8006e9:	68 4f 27 80 00       	push   $0x80274f
+  8006ee:	6a 23                	push   $0x23
+  8006f0:	68 6c 27 80 00       	push   $0x80276c
+  8006f5:	e8 f6 14 00 00       	call   801bf0 <_panic>
+
+008006fa <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8006fa:	55                   	push   %ebp
+  8006fb:	89 e5                	mov    %esp,%ebp
+  8006fd:	57                   	push   %edi
+  8006fe:	56                   	push   %esi
+  8006ff:	53                   	push   %ebx
+  800700:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800703:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800708:	8b 55 08             	mov    0x8(%ebp),%edx
+  80070b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80070e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800713:	89 df                	mov    %ebx,%edi
+  800715:	89 de                	mov    %ebx,%esi
+  800717:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800719:	85 c0                	test   %eax,%eax
+  80071b:	7f 08                	jg     800725 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80071d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800720:	5b                   	pop    %ebx
+  800721:	5e                   	pop    %esi
+  800722:	5f                   	pop    %edi
+  800723:	5d                   	pop    %ebp
+  800724:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800725:	83 ec 0c             	sub    $0xc,%esp
+  800728:	50                   	push   %eax
+  800729:	6a 06                	push   $0x6
+  80072b:	68 4f 27 80 00       	push   $0x80274f
+  800730:	6a 23                	push   $0x23
+  800732:	68 6c 27 80 00       	push   $0x80276c
+  800737:	e8 b4 14 00 00       	call   801bf0 <_panic>
+
+0080073c <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  80073c:	55                   	push   %ebp
+  80073d:	89 e5                	mov    %esp,%ebp
+  80073f:	57                   	push   %edi
+  800740:	56                   	push   %esi
+  800741:	53                   	push   %ebx
+  800742:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800745:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80074a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80074d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800750:	b8 18 00 00 00       	mov    $0x18,%eax
+  800755:	89 df                	mov    %ebx,%edi
+  800757:	89 de                	mov    %ebx,%esi
+  800759:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80075b:	85 c0                	test   %eax,%eax
+  80075d:	7f 08                	jg     800767 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80075f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800762:	5b                   	pop    %ebx
+  800763:	5e                   	pop    %esi
+  800764:	5f                   	pop    %edi
+  800765:	5d                   	pop    %ebp
+  800766:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800767:	83 ec 0c             	sub    $0xc,%esp
+  80076a:	50                   	push   %eax
+  80076b:	6a 18                	push   $0x18
+  80076d:	68 4f 27 80 00       	push   $0x80274f
+  800772:	6a 23                	push   $0x23
+  800774:	68 6c 27 80 00       	push   $0x80276c
+  800779:	e8 72 14 00 00       	call   801bf0 <_panic>
+
+0080077e <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  80077e:	55                   	push   %ebp
+  80077f:	89 e5                	mov    %esp,%ebp
+  800781:	57                   	push   %edi
+  800782:	56                   	push   %esi
+  800783:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800784:	be 00 00 00 00       	mov    $0x0,%esi
+  800789:	8b 55 08             	mov    0x8(%ebp),%edx
+  80078c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80078f:	b8 19 00 00 00       	mov    $0x19,%eax
+  800794:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800797:	89 f7                	mov    %esi,%edi
+  800799:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  80079b:	5b                   	pop    %ebx
+  80079c:	5e                   	pop    %esi
+  80079d:	5f                   	pop    %edi
+  80079e:	5d                   	pop    %ebp
+  80079f:	c3                   	ret
+
+008007a0 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8007a0:	55                   	push   %ebp
+  8007a1:	89 e5                	mov    %esp,%ebp
+  8007a3:	57                   	push   %edi
+  8007a4:	56                   	push   %esi
+  8007a5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8007a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007ac:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8007b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8007b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007b9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8007bc:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8007be:	5b                   	pop    %ebx
+  8007bf:	5e                   	pop    %esi
+  8007c0:	5f                   	pop    %edi
+  8007c1:	5d                   	pop    %ebp
+  8007c2:	c3                   	ret
+
+008007c3 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  8007c3:	55                   	push   %ebp
+  8007c4:	89 e5                	mov    %esp,%ebp
+  8007c6:	57                   	push   %edi
+  8007c7:	56                   	push   %esi
+  8007c8:	53                   	push   %ebx
+  8007c9:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  8007cc:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8007cf:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8007d5:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  8007d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007de:	b8 10 00 00 00       	mov    $0x10,%eax
+  8007e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007e6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8007e9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8007eb:	85 c0                	test   %eax,%eax
+  8007ed:	7f 08                	jg     8007f7 <sys_page_map_range+0x34>
+}
+  8007ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007f2:	5b                   	pop    %ebx
+  8007f3:	5e                   	pop    %esi
+  8007f4:	5f                   	pop    %edi
+  8007f5:	5d                   	pop    %ebp
+  8007f6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007f7:	83 ec 0c             	sub    $0xc,%esp
+  8007fa:	50                   	push   %eax
+  8007fb:	6a 10                	push   $0x10
+  8007fd:	68 4f 27 80 00       	push   $0x80274f
+  800802:	6a 23                	push   $0x23
+  800804:	68 6c 27 80 00       	push   $0x80276c
+  800809:	e8 e2 13 00 00       	call   801bf0 <_panic>
+
+0080080e <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  80080e:	55                   	push   %ebp
+  80080f:	89 e5                	mov    %esp,%ebp
+  800811:	57                   	push   %edi
+  800812:	56                   	push   %esi
+  800813:	53                   	push   %ebx
+  800814:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800817:	be 00 00 00 00       	mov    $0x0,%esi
+  80081c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80081f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800822:	b8 11 00 00 00       	mov    $0x11,%eax
+  800827:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80082a:	89 f7                	mov    %esi,%edi
+  80082c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80082e:	85 c0                	test   %eax,%eax
+  800830:	7f 08                	jg     80083a <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800832:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800835:	5b                   	pop    %ebx
+  800836:	5e                   	pop    %esi
+  800837:	5f                   	pop    %edi
+  800838:	5d                   	pop    %ebp
+  800839:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80083a:	83 ec 0c             	sub    $0xc,%esp
+  80083d:	50                   	push   %eax
+  80083e:	6a 11                	push   $0x11
+  800840:	68 4f 27 80 00       	push   $0x80274f
+  800845:	6a 23                	push   $0x23
+  800847:	68 6c 27 80 00       	push   $0x80276c
+  80084c:	e8 9f 13 00 00       	call   801bf0 <_panic>
+
+00800851 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800851:	55                   	push   %ebp
+  800852:	89 e5                	mov    %esp,%ebp
+  800854:	57                   	push   %edi
+  800855:	56                   	push   %esi
+  800856:	53                   	push   %ebx
+  800857:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80085a:	be 00 00 00 00       	mov    $0x0,%esi
+  80085f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800862:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800865:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80086a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80086d:	89 f7                	mov    %esi,%edi
+  80086f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800871:	85 c0                	test   %eax,%eax
+  800873:	7f 08                	jg     80087d <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800875:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800878:	5b                   	pop    %ebx
+  800879:	5e                   	pop    %esi
+  80087a:	5f                   	pop    %edi
+  80087b:	5d                   	pop    %ebp
+  80087c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80087d:	83 ec 0c             	sub    $0xc,%esp
+  800880:	50                   	push   %eax
+  800881:	6a 1b                	push   $0x1b
+  800883:	68 4f 27 80 00       	push   $0x80274f
+  800888:	6a 23                	push   $0x23
+  80088a:	68 6c 27 80 00       	push   $0x80276c
+  80088f:	e8 5c 13 00 00       	call   801bf0 <_panic>
+
+00800894 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800894:	55                   	push   %ebp
+  800895:	89 e5                	mov    %esp,%ebp
+  800897:	57                   	push   %edi
+  800898:	56                   	push   %esi
+  800899:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80089a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80089f:	b8 12 00 00 00       	mov    $0x12,%eax
+  8008a4:	89 d1                	mov    %edx,%ecx
+  8008a6:	89 d3                	mov    %edx,%ebx
+  8008a8:	89 d7                	mov    %edx,%edi
+  8008aa:	89 d6                	mov    %edx,%esi
+  8008ac:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8008ae:	5b                   	pop    %ebx
+  8008af:	5e                   	pop    %esi
+  8008b0:	5f                   	pop    %edi
+  8008b1:	5d                   	pop    %ebp
+  8008b2:	c3                   	ret
+
+008008b3 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8008b3:	55                   	push   %ebp
+  8008b4:	89 e5                	mov    %esp,%ebp
+  8008b6:	57                   	push   %edi
+  8008b7:	56                   	push   %esi
+  8008b8:	53                   	push   %ebx
+  8008b9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8008bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008c7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8008cc:	89 df                	mov    %ebx,%edi
+  8008ce:	89 de                	mov    %ebx,%esi
+  8008d0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8008d2:	85 c0                	test   %eax,%eax
+  8008d4:	7f 08                	jg     8008de <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8008d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008d9:	5b                   	pop    %ebx
+  8008da:	5e                   	pop    %esi
+  8008db:	5f                   	pop    %edi
+  8008dc:	5d                   	pop    %ebp
+  8008dd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8008de:	83 ec 0c             	sub    $0xc,%esp
+  8008e1:	50                   	push   %eax
+  8008e2:	6a 08                	push   $0x8
+  8008e4:	68 4f 27 80 00       	push   $0x80274f
+  8008e9:	6a 23                	push   $0x23
+  8008eb:	68 6c 27 80 00       	push   $0x80276c
+  8008f0:	e8 fb 12 00 00       	call   801bf0 <_panic>
+
+008008f5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8008f5:	55                   	push   %ebp
+  8008f6:	89 e5                	mov    %esp,%ebp
+  8008f8:	57                   	push   %edi
+  8008f9:	56                   	push   %esi
+  8008fa:	53                   	push   %ebx
+  8008fb:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  8008fe:	6a 44                	push   $0x44
+  800900:	ff 75 0c             	push   0xc(%ebp)
+  800903:	e8 7a fc ff ff       	call   800582 <touch_mem>
+	asm volatile("int %1\n"
+  800908:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80090d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800910:	b8 09 00 00 00       	mov    $0x9,%eax
+  800915:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800918:	89 df                	mov    %ebx,%edi
+  80091a:	89 de                	mov    %ebx,%esi
+  80091c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80091e:	83 c4 08             	add    $0x8,%esp
+  800921:	85 c0                	test   %eax,%eax
+  800923:	7f 08                	jg     80092d <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800925:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800928:	5b                   	pop    %ebx
+  800929:	5e                   	pop    %esi
+  80092a:	5f                   	pop    %edi
+  80092b:	5d                   	pop    %ebp
+  80092c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80092d:	83 ec 0c             	sub    $0xc,%esp
+  800930:	50                   	push   %eax
+  800931:	6a 09                	push   $0x9
+  800933:	68 4f 27 80 00       	push   $0x80274f
+  800938:	6a 23                	push   $0x23
+  80093a:	68 6c 27 80 00       	push   $0x80276c
+  80093f:	e8 ac 12 00 00       	call   801bf0 <_panic>
+
+00800944 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800944:	55                   	push   %ebp
+  800945:	89 e5                	mov    %esp,%ebp
+  800947:	57                   	push   %edi
+  800948:	56                   	push   %esi
+  800949:	53                   	push   %ebx
+  80094a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80094d:	be 00 00 00 00       	mov    $0x0,%esi
+  800952:	8b 55 08             	mov    0x8(%ebp),%edx
+  800955:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800958:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80095d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800960:	89 f7                	mov    %esi,%edi
+  800962:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800964:	85 c0                	test   %eax,%eax
+  800966:	7f 08                	jg     800970 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800968:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80096b:	5b                   	pop    %ebx
+  80096c:	5e                   	pop    %esi
+  80096d:	5f                   	pop    %edi
+  80096e:	5d                   	pop    %ebp
+  80096f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800970:	83 ec 0c             	sub    $0xc,%esp
+  800973:	50                   	push   %eax
+  800974:	6a 1a                	push   $0x1a
+  800976:	68 4f 27 80 00       	push   $0x80274f
+  80097b:	6a 23                	push   $0x23
+  80097d:	68 6c 27 80 00       	push   $0x80276c
+  800982:	e8 69 12 00 00       	call   801bf0 <_panic>
+
+00800987 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  800987:	55                   	push   %ebp
+  800988:	89 e5                	mov    %esp,%ebp
+  80098a:	57                   	push   %edi
+  80098b:	56                   	push   %esi
+  80098c:	53                   	push   %ebx
+  80098d:	83 ec 0c             	sub    $0xc,%esp
+  800990:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  800993:	89 d8                	mov    %ebx,%eax
+  800995:	c1 e0 05             	shl    $0x5,%eax
+  800998:	50                   	push   %eax
+  800999:	ff 75 0c             	push   0xc(%ebp)
+  80099c:	e8 e1 fb ff ff       	call   800582 <touch_mem>
+	asm volatile("int %1\n"
+  8009a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8009a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009a9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8009ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009b1:	89 f7                	mov    %esi,%edi
+  8009b3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8009b5:	83 c4 08             	add    $0x8,%esp
+  8009b8:	85 c0                	test   %eax,%eax
+  8009ba:	7f 08                	jg     8009c4 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8009bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009bf:	5b                   	pop    %ebx
+  8009c0:	5e                   	pop    %esi
+  8009c1:	5f                   	pop    %edi
+  8009c2:	5d                   	pop    %ebp
+  8009c3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8009c4:	83 ec 0c             	sub    $0xc,%esp
+  8009c7:	50                   	push   %eax
+  8009c8:	6a 13                	push   $0x13
+  8009ca:	68 4f 27 80 00       	push   $0x80274f
+  8009cf:	6a 23                	push   $0x23
+  8009d1:	68 6c 27 80 00       	push   $0x80276c
+  8009d6:	e8 15 12 00 00       	call   801bf0 <_panic>
+
+008009db <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	57                   	push   %edi
+  8009df:	56                   	push   %esi
+  8009e0:	53                   	push   %ebx
+  8009e1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8009e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009ef:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009f4:	89 df                	mov    %ebx,%edi
+  8009f6:	89 de                	mov    %ebx,%esi
+  8009f8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8009fa:	85 c0                	test   %eax,%eax
+  8009fc:	7f 08                	jg     800a06 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8009fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a01:	5b                   	pop    %ebx
+  800a02:	5e                   	pop    %esi
+  800a03:	5f                   	pop    %edi
+  800a04:	5d                   	pop    %ebp
+  800a05:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800a06:	83 ec 0c             	sub    $0xc,%esp
+  800a09:	50                   	push   %eax
+  800a0a:	6a 0a                	push   $0xa
+  800a0c:	68 4f 27 80 00       	push   $0x80274f
+  800a11:	6a 23                	push   $0x23
+  800a13:	68 6c 27 80 00       	push   $0x80276c
+  800a18:	e8 d3 11 00 00       	call   801bf0 <_panic>
+
+00800a1d <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800a1d:	55                   	push   %ebp
+  800a1e:	89 e5                	mov    %esp,%ebp
+  800a20:	57                   	push   %edi
+  800a21:	56                   	push   %esi
+  800a22:	53                   	push   %ebx
+  800a23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  800a26:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800a2c:	76 1d                	jbe    800a4b <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  800a2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a34:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800a39:	be 01 00 00 00       	mov    $0x1,%esi
+  800a3e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800a41:	cd 30                	int    $0x30
+}
+  800a43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a46:	5b                   	pop    %ebx
+  800a47:	5e                   	pop    %esi
+  800a48:	5f                   	pop    %edi
+  800a49:	5d                   	pop    %ebp
+  800a4a:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  800a4b:	68 00 10 00 00       	push   $0x1000
+  800a50:	53                   	push   %ebx
+  800a51:	e8 2c fb ff ff       	call   800582 <touch_mem>
+  800a56:	83 c4 08             	add    $0x8,%esp
+  800a59:	eb d3                	jmp    800a2e <sys_ipc_send+0x11>
+
+00800a5b <sys_ipc_send_pages>:
+{
+  800a5b:	55                   	push   %ebp
+  800a5c:	89 e5                	mov    %esp,%ebp
+  800a5e:	57                   	push   %edi
+  800a5f:	56                   	push   %esi
+  800a60:	53                   	push   %ebx
+  800a61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a64:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  800a67:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800a6d:	76 18                	jbe    800a87 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  800a6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a75:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800a7a:	8b 7d 18             	mov    0x18(%ebp),%edi
+  800a7d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  800a7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a82:	5b                   	pop    %ebx
+  800a83:	5e                   	pop    %esi
+  800a84:	5f                   	pop    %edi
+  800a85:	5d                   	pop    %ebp
+  800a86:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  800a87:	89 f0                	mov    %esi,%eax
+  800a89:	c1 e0 0c             	shl    $0xc,%eax
+  800a8c:	50                   	push   %eax
+  800a8d:	53                   	push   %ebx
+  800a8e:	e8 ef fa ff ff       	call   800582 <touch_mem>
+  800a93:	83 c4 08             	add    $0x8,%esp
+  800a96:	eb d7                	jmp    800a6f <sys_ipc_send_pages+0x14>
+
+00800a98 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  800a98:	55                   	push   %ebp
+  800a99:	89 e5                	mov    %esp,%ebp
+  800a9b:	57                   	push   %edi
+  800a9c:	56                   	push   %esi
+  800a9d:	53                   	push   %ebx
+  800a9e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800aa1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800aa6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aa9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aac:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ab1:	89 df                	mov    %ebx,%edi
+  800ab3:	89 de                	mov    %ebx,%esi
+  800ab5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ab7:	85 c0                	test   %eax,%eax
+  800ab9:	7f 08                	jg     800ac3 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  800abb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800abe:	5b                   	pop    %ebx
+  800abf:	5e                   	pop    %esi
+  800ac0:	5f                   	pop    %edi
+  800ac1:	5d                   	pop    %ebp
+  800ac2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ac3:	83 ec 0c             	sub    $0xc,%esp
+  800ac6:	50                   	push   %eax
+  800ac7:	6a 0d                	push   $0xd
+  800ac9:	68 4f 27 80 00       	push   $0x80274f
+  800ace:	6a 23                	push   $0x23
+  800ad0:	68 6c 27 80 00       	push   $0x80276c
+  800ad5:	e8 16 11 00 00       	call   801bf0 <_panic>
+
+00800ada <sys_ipc_recv>:
+{
+  800ada:	55                   	push   %ebp
+  800adb:	89 e5                	mov    %esp,%ebp
+  800add:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  800ae0:	6a 01                	push   $0x1
+  800ae2:	ff 75 08             	push   0x8(%ebp)
+  800ae5:	e8 ae ff ff ff       	call   800a98 <sys_ipc_recv_pages>
+}
+  800aea:	c9                   	leave
+  800aeb:	c3                   	ret
+
+00800aec <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  800aec:	55                   	push   %ebp
+  800aed:	89 e5                	mov    %esp,%ebp
+  800aef:	57                   	push   %edi
+  800af0:	56                   	push   %esi
+  800af1:	53                   	push   %ebx
+  800af2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800af5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800af8:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  800afb:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800b01:	77 04                	ja     800b07 <sys_ipc_call+0x1b>
+  800b03:	85 f6                	test   %esi,%esi
+  800b05:	75 15                	jne    800b1c <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  800b07:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b0d:	b8 14 00 00 00       	mov    $0x14,%eax
+  800b12:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  800b14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b17:	5b                   	pop    %ebx
+  800b18:	5e                   	pop    %esi
+  800b19:	5f                   	pop    %edi
+  800b1a:	5d                   	pop    %ebp
+  800b1b:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  800b1c:	89 f8                	mov    %edi,%eax
+  800b1e:	c1 e0 0c             	shl    $0xc,%eax
+  800b21:	50                   	push   %eax
+  800b22:	53                   	push   %ebx
+  800b23:	e8 5a fa ff ff       	call   800582 <touch_mem>
+  800b28:	83 c4 08             	add    $0x8,%esp
+  800b2b:	eb da                	jmp    800b07 <sys_ipc_call+0x1b>
+
+00800b2d <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  800b2d:	55                   	push   %ebp
+  800b2e:	89 e5                	mov    %esp,%ebp
+  800b30:	57                   	push   %edi
+  800b31:	56                   	push   %esi
+  800b32:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b39:	b8 15 00 00 00       	mov    $0x15,%eax
+  800b3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b41:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800b44:	8b 75 18             	mov    0x18(%ebp),%esi
+  800b47:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  800b49:	5b                   	pop    %ebx
+  800b4a:	5e                   	pop    %esi
+  800b4b:	5f                   	pop    %edi
+  800b4c:	5d                   	pop    %ebp
+  800b4d:	c3                   	ret
+
+00800b4e <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  800b4e:	55                   	push   %ebp
+  800b4f:	89 e5                	mov    %esp,%ebp
+  800b51:	57                   	push   %edi
+  800b52:	56                   	push   %esi
+  800b53:	53                   	push   %ebx
+  800b54:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  800b57:	6a 04                	push   $0x4
+  800b59:	ff 75 08             	push   0x8(%ebp)
+  800b5c:	e8 21 fa ff ff       	call   800582 <touch_mem>
+	asm volatile("int %1\n"
+  800b61:	be 00 00 00 00       	mov    $0x0,%esi
+  800b66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b69:	b8 16 00 00 00       	mov    $0x16,%eax
+  800b6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b74:	89 f7                	mov    %esi,%edi
+  800b76:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800b78:	83 c4 08             	add    $0x8,%esp
+  800b7b:	85 c0                	test   %eax,%eax
+  800b7d:	7f 08                	jg     800b87 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  800b7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b82:	5b                   	pop    %ebx
+  800b83:	5e                   	pop    %esi
+  800b84:	5f                   	pop    %edi
+  800b85:	5d                   	pop    %ebp
+  800b86:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b87:	83 ec 0c             	sub    $0xc,%esp
+  800b8a:	50                   	push   %eax
+  800b8b:	6a 16                	push   $0x16
+  800b8d:	68 4f 27 80 00       	push   $0x80274f
+  800b92:	6a 23                	push   $0x23
+  800b94:	68 6c 27 80 00       	push   $0x80276c
+  800b99:	e8 52 10 00 00       	call   801bf0 <_panic>
+
+00800b9e <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  800b9e:	55                   	push   %ebp
+  800b9f:	89 e5                	mov    %esp,%ebp
+  800ba1:	57                   	push   %edi
+  800ba2:	56                   	push   %esi
+  800ba3:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  800ba4:	6a 04                	push   $0x4
+  800ba6:	ff 75 08             	push   0x8(%ebp)
+  800ba9:	e8 d4 f9 ff ff       	call   800582 <touch_mem>
+	asm volatile("int %1\n"
+  800bae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb6:	b8 17 00 00 00       	mov    $0x17,%eax
+  800bbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bbe:	89 df                	mov    %ebx,%edi
+  800bc0:	89 de                	mov    %ebx,%esi
+  800bc2:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  800bc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc7:	5b                   	pop    %ebx
+  800bc8:	5e                   	pop    %esi
+  800bc9:	5f                   	pop    %edi
+  800bca:	5d                   	pop    %ebp
+  800bcb:	c3                   	ret
+
+00800bcc <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  800bcc:	55                   	push   %ebp
+  800bcd:	89 e5                	mov    %esp,%ebp
+  800bcf:	57                   	push   %edi
+  800bd0:	56                   	push   %esi
+  800bd1:	53                   	push   %ebx
+  800bd2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bd5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bdd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800be2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800be7:	89 df                	mov    %ebx,%edi
+  800be9:	89 de                	mov    %ebx,%esi
+  800beb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bed:	85 c0                	test   %eax,%eax
+  800bef:	7f 08                	jg     800bf9 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  800bf1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bf4:	5b                   	pop    %ebx
+  800bf5:	5e                   	pop    %esi
+  800bf6:	5f                   	pop    %edi
+  800bf7:	5d                   	pop    %ebp
+  800bf8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bf9:	83 ec 0c             	sub    $0xc,%esp
+  800bfc:	50                   	push   %eax
+  800bfd:	6a 0e                	push   $0xe
+  800bff:	68 4f 27 80 00       	push   $0x80274f
+  800c04:	6a 23                	push   $0x23
+  800c06:	68 6c 27 80 00       	push   $0x80276c
+  800c0b:	e8 e0 0f 00 00       	call   801bf0 <_panic>
+
+00800c10 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800c10:	55                   	push   %ebp
+  800c11:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800c13:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c16:	05 00 00 00 30       	add    $0x30000000,%eax
+  800c1b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800c1e:	5d                   	pop    %ebp
+  800c1f:	c3                   	ret
+
+00800c20 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800c20:	55                   	push   %ebp
+  800c21:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800c23:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c26:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800c2b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800c30:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800c35:	5d                   	pop    %ebp
+  800c36:	c3                   	ret
+
+00800c37 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800c37:	55                   	push   %ebp
+  800c38:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  800c3a:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  800c3f:	a8 01                	test   $0x1,%al
+  800c41:	74 3c                	je     800c7f <fd_alloc+0x48>
+  800c43:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800c48:	89 c2                	mov    %eax,%edx
+  800c4a:	c1 ea 0c             	shr    $0xc,%edx
+  800c4d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800c54:	89 c1                	mov    %eax,%ecx
+  800c56:	05 00 10 00 00       	add    $0x1000,%eax
+  800c5b:	f6 c2 01             	test   $0x1,%dl
+  800c5e:	74 13                	je     800c73 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  800c60:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  800c65:	75 e1                	jne    800c48 <fd_alloc+0x11>
+  800c67:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800c6c:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  800c71:	eb 05                	jmp    800c78 <fd_alloc+0x41>
+			return 0;
+  800c73:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  800c78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7b:	89 0a                	mov    %ecx,(%edx)
+}
+  800c7d:	5d                   	pop    %ebp
+  800c7e:	c3                   	ret
+  800c7f:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  800c84:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c89:	eb ed                	jmp    800c78 <fd_alloc+0x41>
+
+00800c8b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800c8b:	55                   	push   %ebp
+  800c8c:	89 e5                	mov    %esp,%ebp
+  800c8e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800c91:	83 f8 1f             	cmp    $0x1f,%eax
+  800c94:	77 30                	ja     800cc6 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800c96:	c1 e0 0c             	shl    $0xc,%eax
+  800c99:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800c9e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800ca4:	f6 c2 01             	test   $0x1,%dl
+  800ca7:	74 24                	je     800ccd <fd_lookup+0x42>
+  800ca9:	89 c2                	mov    %eax,%edx
+  800cab:	c1 ea 0c             	shr    $0xc,%edx
+  800cae:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800cb5:	f6 c2 01             	test   $0x1,%dl
+  800cb8:	74 1a                	je     800cd4 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800cba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cbd:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800cbf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cc4:	5d                   	pop    %ebp
+  800cc5:	c3                   	ret
+		return -E_INVAL;
+  800cc6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ccb:	eb f7                	jmp    800cc4 <fd_lookup+0x39>
+		return -E_INVAL;
+  800ccd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cd2:	eb f0                	jmp    800cc4 <fd_lookup+0x39>
+  800cd4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cd9:	eb e9                	jmp    800cc4 <fd_lookup+0x39>
+
+00800cdb <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800cdb:	55                   	push   %ebp
+  800cdc:	89 e5                	mov    %esp,%ebp
+  800cde:	53                   	push   %ebx
+  800cdf:	83 ec 04             	sub    $0x4,%esp
+  800ce2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800ce5:	b8 f8 27 80 00       	mov    $0x8027f8,%eax
+  800cea:	8b 18                	mov    (%eax),%ebx
+  800cec:	85 db                	test   %ebx,%ebx
+  800cee:	74 0e                	je     800cfe <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  800cf0:	83 c0 04             	add    $0x4,%eax
+  800cf3:	39 13                	cmp    %edx,(%ebx)
+  800cf5:	75 f3                	jne    800cea <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  800cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfc:	eb 1f                	jmp    800d1d <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800cfe:	a1 08 40 80 00       	mov    0x804008,%eax
+  800d03:	8b 40 48             	mov    0x48(%eax),%eax
+  800d06:	83 ec 04             	sub    $0x4,%esp
+  800d09:	52                   	push   %edx
+  800d0a:	50                   	push   %eax
+  800d0b:	68 7c 27 80 00       	push   $0x80277c
+  800d10:	e8 b6 0f 00 00       	call   801ccb <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800d15:	83 c4 10             	add    $0x10,%esp
+  800d18:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800d1d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d20:	89 1a                	mov    %ebx,(%edx)
+}
+  800d22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d25:	c9                   	leave
+  800d26:	c3                   	ret
+
+00800d27 <fd_close>:
+{
+  800d27:	55                   	push   %ebp
+  800d28:	89 e5                	mov    %esp,%ebp
+  800d2a:	57                   	push   %edi
+  800d2b:	56                   	push   %esi
+  800d2c:	53                   	push   %ebx
+  800d2d:	83 ec 24             	sub    $0x24,%esp
+  800d30:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d33:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800d36:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800d39:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800d3a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800d40:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800d43:	50                   	push   %eax
+  800d44:	e8 42 ff ff ff       	call   800c8b <fd_lookup>
+  800d49:	89 c3                	mov    %eax,%ebx
+  800d4b:	83 c4 10             	add    $0x10,%esp
+  800d4e:	85 c0                	test   %eax,%eax
+  800d50:	78 05                	js     800d57 <fd_close+0x30>
+	    || fd != fd2)
+  800d52:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800d55:	74 16                	je     800d6d <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800d57:	89 f8                	mov    %edi,%eax
+  800d59:	84 c0                	test   %al,%al
+  800d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d60:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800d63:	89 d8                	mov    %ebx,%eax
+  800d65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d68:	5b                   	pop    %ebx
+  800d69:	5e                   	pop    %esi
+  800d6a:	5f                   	pop    %edi
+  800d6b:	5d                   	pop    %ebp
+  800d6c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800d6d:	83 ec 08             	sub    $0x8,%esp
+  800d70:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800d73:	50                   	push   %eax
+  800d74:	ff 36                	push   (%esi)
+  800d76:	e8 60 ff ff ff       	call   800cdb <dev_lookup>
+  800d7b:	89 c3                	mov    %eax,%ebx
+  800d7d:	83 c4 10             	add    $0x10,%esp
+  800d80:	85 c0                	test   %eax,%eax
+  800d82:	78 1a                	js     800d9e <fd_close+0x77>
+		if (dev->dev_close)
+  800d84:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800d87:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800d8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800d8f:	85 c0                	test   %eax,%eax
+  800d91:	74 0b                	je     800d9e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800d93:	83 ec 0c             	sub    $0xc,%esp
+  800d96:	56                   	push   %esi
+  800d97:	ff d0                	call   *%eax
+  800d99:	89 c3                	mov    %eax,%ebx
+  800d9b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800d9e:	83 ec 08             	sub    $0x8,%esp
+  800da1:	56                   	push   %esi
+  800da2:	6a 00                	push   $0x0
+  800da4:	e8 51 f9 ff ff       	call   8006fa <sys_page_unmap>
+	return r;
+  800da9:	83 c4 10             	add    $0x10,%esp
+  800dac:	eb b5                	jmp    800d63 <fd_close+0x3c>
+
+00800dae <close>:
+
+int
+close(int fdnum)
+{
+  800dae:	55                   	push   %ebp
+  800daf:	89 e5                	mov    %esp,%ebp
+  800db1:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800db4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800db7:	50                   	push   %eax
+  800db8:	ff 75 08             	push   0x8(%ebp)
+  800dbb:	e8 cb fe ff ff       	call   800c8b <fd_lookup>
+  800dc0:	83 c4 10             	add    $0x10,%esp
+  800dc3:	85 c0                	test   %eax,%eax
+  800dc5:	79 02                	jns    800dc9 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800dc7:	c9                   	leave
+  800dc8:	c3                   	ret
+		return fd_close(fd, 1);
+  800dc9:	83 ec 08             	sub    $0x8,%esp
+  800dcc:	6a 01                	push   $0x1
+  800dce:	ff 75 f4             	push   -0xc(%ebp)
+  800dd1:	e8 51 ff ff ff       	call   800d27 <fd_close>
+  800dd6:	83 c4 10             	add    $0x10,%esp
+  800dd9:	eb ec                	jmp    800dc7 <close+0x19>
+
+00800ddb <close_all>:
+
+void
+close_all(void)
+{
+  800ddb:	55                   	push   %ebp
+  800ddc:	89 e5                	mov    %esp,%ebp
+  800dde:	53                   	push   %ebx
+  800ddf:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800de2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800de7:	83 ec 0c             	sub    $0xc,%esp
+  800dea:	53                   	push   %ebx
+  800deb:	e8 be ff ff ff       	call   800dae <close>
+	for (i = 0; i < MAXFD; i++)
+  800df0:	83 c3 01             	add    $0x1,%ebx
+  800df3:	83 c4 10             	add    $0x10,%esp
+  800df6:	83 fb 20             	cmp    $0x20,%ebx
+  800df9:	75 ec                	jne    800de7 <close_all+0xc>
+}
+  800dfb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dfe:	c9                   	leave
+  800dff:	c3                   	ret
+
+00800e00 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800e00:	55                   	push   %ebp
+  800e01:	89 e5                	mov    %esp,%ebp
+  800e03:	57                   	push   %edi
+  800e04:	56                   	push   %esi
+  800e05:	53                   	push   %ebx
+  800e06:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800e09:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800e0c:	50                   	push   %eax
+  800e0d:	ff 75 08             	push   0x8(%ebp)
+  800e10:	e8 76 fe ff ff       	call   800c8b <fd_lookup>
+  800e15:	89 c3                	mov    %eax,%ebx
+  800e17:	83 c4 10             	add    $0x10,%esp
+  800e1a:	85 c0                	test   %eax,%eax
+  800e1c:	78 7f                	js     800e9d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800e1e:	83 ec 0c             	sub    $0xc,%esp
+  800e21:	ff 75 0c             	push   0xc(%ebp)
+  800e24:	e8 85 ff ff ff       	call   800dae <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800e29:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e2c:	c1 e6 0c             	shl    $0xc,%esi
+  800e2f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800e35:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800e38:	89 3c 24             	mov    %edi,(%esp)
+  800e3b:	e8 e0 fd ff ff       	call   800c20 <fd2data>
+  800e40:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800e42:	89 34 24             	mov    %esi,(%esp)
+  800e45:	e8 d6 fd ff ff       	call   800c20 <fd2data>
+  800e4a:	83 c4 10             	add    $0x10,%esp
+  800e4d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800e50:	89 d8                	mov    %ebx,%eax
+  800e52:	c1 e8 16             	shr    $0x16,%eax
+  800e55:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800e5c:	a8 01                	test   $0x1,%al
+  800e5e:	74 11                	je     800e71 <dup+0x71>
+  800e60:	89 d8                	mov    %ebx,%eax
+  800e62:	c1 e8 0c             	shr    $0xc,%eax
+  800e65:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800e6c:	f6 c2 01             	test   $0x1,%dl
+  800e6f:	75 36                	jne    800ea7 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800e71:	89 f8                	mov    %edi,%eax
+  800e73:	c1 e8 0c             	shr    $0xc,%eax
+  800e76:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800e7d:	83 ec 0c             	sub    $0xc,%esp
+  800e80:	25 07 0e 00 00       	and    $0xe07,%eax
+  800e85:	50                   	push   %eax
+  800e86:	56                   	push   %esi
+  800e87:	6a 00                	push   $0x0
+  800e89:	57                   	push   %edi
+  800e8a:	6a 00                	push   $0x0
+  800e8c:	e8 27 f8 ff ff       	call   8006b8 <sys_page_map>
+  800e91:	89 c3                	mov    %eax,%ebx
+  800e93:	83 c4 20             	add    $0x20,%esp
+  800e96:	85 c0                	test   %eax,%eax
+  800e98:	78 33                	js     800ecd <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800e9a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800e9d:	89 d8                	mov    %ebx,%eax
+  800e9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea2:	5b                   	pop    %ebx
+  800ea3:	5e                   	pop    %esi
+  800ea4:	5f                   	pop    %edi
+  800ea5:	5d                   	pop    %ebp
+  800ea6:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800ea7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800eae:	83 ec 0c             	sub    $0xc,%esp
+  800eb1:	25 07 0e 00 00       	and    $0xe07,%eax
+  800eb6:	50                   	push   %eax
+  800eb7:	ff 75 d4             	push   -0x2c(%ebp)
+  800eba:	6a 00                	push   $0x0
+  800ebc:	53                   	push   %ebx
+  800ebd:	6a 00                	push   $0x0
+  800ebf:	e8 f4 f7 ff ff       	call   8006b8 <sys_page_map>
+  800ec4:	89 c3                	mov    %eax,%ebx
+  800ec6:	83 c4 20             	add    $0x20,%esp
+  800ec9:	85 c0                	test   %eax,%eax
+  800ecb:	79 a4                	jns    800e71 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800ecd:	83 ec 08             	sub    $0x8,%esp
+  800ed0:	56                   	push   %esi
+  800ed1:	6a 00                	push   $0x0
+  800ed3:	e8 22 f8 ff ff       	call   8006fa <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800ed8:	83 c4 08             	add    $0x8,%esp
+  800edb:	ff 75 d4             	push   -0x2c(%ebp)
+  800ede:	6a 00                	push   $0x0
+  800ee0:	e8 15 f8 ff ff       	call   8006fa <sys_page_unmap>
+	return r;
+  800ee5:	83 c4 10             	add    $0x10,%esp
+  800ee8:	eb b3                	jmp    800e9d <dup+0x9d>
+
+00800eea <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800eea:	55                   	push   %ebp
+  800eeb:	89 e5                	mov    %esp,%ebp
+  800eed:	56                   	push   %esi
+  800eee:	53                   	push   %ebx
+  800eef:	83 ec 18             	sub    $0x18,%esp
+  800ef2:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800ef5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ef8:	50                   	push   %eax
+  800ef9:	56                   	push   %esi
+  800efa:	e8 8c fd ff ff       	call   800c8b <fd_lookup>
+  800eff:	83 c4 10             	add    $0x10,%esp
+  800f02:	85 c0                	test   %eax,%eax
+  800f04:	78 3c                	js     800f42 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800f06:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800f09:	83 ec 08             	sub    $0x8,%esp
+  800f0c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f0f:	50                   	push   %eax
+  800f10:	ff 33                	push   (%ebx)
+  800f12:	e8 c4 fd ff ff       	call   800cdb <dev_lookup>
+  800f17:	83 c4 10             	add    $0x10,%esp
+  800f1a:	85 c0                	test   %eax,%eax
+  800f1c:	78 24                	js     800f42 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800f1e:	8b 43 08             	mov    0x8(%ebx),%eax
+  800f21:	83 e0 03             	and    $0x3,%eax
+  800f24:	83 f8 01             	cmp    $0x1,%eax
+  800f27:	74 20                	je     800f49 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800f29:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f2c:	8b 40 08             	mov    0x8(%eax),%eax
+  800f2f:	85 c0                	test   %eax,%eax
+  800f31:	74 37                	je     800f6a <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800f33:	83 ec 04             	sub    $0x4,%esp
+  800f36:	ff 75 10             	push   0x10(%ebp)
+  800f39:	ff 75 0c             	push   0xc(%ebp)
+  800f3c:	53                   	push   %ebx
+  800f3d:	ff d0                	call   *%eax
+  800f3f:	83 c4 10             	add    $0x10,%esp
+}
+  800f42:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f45:	5b                   	pop    %ebx
+  800f46:	5e                   	pop    %esi
+  800f47:	5d                   	pop    %ebp
+  800f48:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800f49:	a1 08 40 80 00       	mov    0x804008,%eax
+  800f4e:	8b 40 48             	mov    0x48(%eax),%eax
+  800f51:	83 ec 04             	sub    $0x4,%esp
+  800f54:	56                   	push   %esi
+  800f55:	50                   	push   %eax
+  800f56:	68 bd 27 80 00       	push   $0x8027bd
+  800f5b:	e8 6b 0d 00 00       	call   801ccb <cprintf>
+		return -E_INVAL;
+  800f60:	83 c4 10             	add    $0x10,%esp
+  800f63:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f68:	eb d8                	jmp    800f42 <read+0x58>
+		return -E_NOT_SUPP;
+  800f6a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f6f:	eb d1                	jmp    800f42 <read+0x58>
+
+00800f71 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800f71:	55                   	push   %ebp
+  800f72:	89 e5                	mov    %esp,%ebp
+  800f74:	57                   	push   %edi
+  800f75:	56                   	push   %esi
+  800f76:	53                   	push   %ebx
+  800f77:	83 ec 0c             	sub    $0xc,%esp
+  800f7a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800f7d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800f80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f85:	eb 02                	jmp    800f89 <readn+0x18>
+  800f87:	01 c3                	add    %eax,%ebx
+  800f89:	39 f3                	cmp    %esi,%ebx
+  800f8b:	73 21                	jae    800fae <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800f8d:	83 ec 04             	sub    $0x4,%esp
+  800f90:	89 f0                	mov    %esi,%eax
+  800f92:	29 d8                	sub    %ebx,%eax
+  800f94:	50                   	push   %eax
+  800f95:	89 d8                	mov    %ebx,%eax
+  800f97:	03 45 0c             	add    0xc(%ebp),%eax
+  800f9a:	50                   	push   %eax
+  800f9b:	57                   	push   %edi
+  800f9c:	e8 49 ff ff ff       	call   800eea <read>
+		if (m < 0)
+  800fa1:	83 c4 10             	add    $0x10,%esp
+  800fa4:	85 c0                	test   %eax,%eax
+  800fa6:	78 04                	js     800fac <readn+0x3b>
+			return m;
+		if (m == 0)
+  800fa8:	75 dd                	jne    800f87 <readn+0x16>
+  800faa:	eb 02                	jmp    800fae <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800fac:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800fae:	89 d8                	mov    %ebx,%eax
+  800fb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb3:	5b                   	pop    %ebx
+  800fb4:	5e                   	pop    %esi
+  800fb5:	5f                   	pop    %edi
+  800fb6:	5d                   	pop    %ebp
+  800fb7:	c3                   	ret
+
+00800fb8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800fb8:	55                   	push   %ebp
+  800fb9:	89 e5                	mov    %esp,%ebp
+  800fbb:	56                   	push   %esi
+  800fbc:	53                   	push   %ebx
+  800fbd:	83 ec 18             	sub    $0x18,%esp
+  800fc0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800fc3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800fc6:	50                   	push   %eax
+  800fc7:	53                   	push   %ebx
+  800fc8:	e8 be fc ff ff       	call   800c8b <fd_lookup>
+  800fcd:	83 c4 10             	add    $0x10,%esp
+  800fd0:	85 c0                	test   %eax,%eax
+  800fd2:	78 37                	js     80100b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800fd4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800fd7:	83 ec 08             	sub    $0x8,%esp
+  800fda:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800fdd:	50                   	push   %eax
+  800fde:	ff 36                	push   (%esi)
+  800fe0:	e8 f6 fc ff ff       	call   800cdb <dev_lookup>
+  800fe5:	83 c4 10             	add    $0x10,%esp
+  800fe8:	85 c0                	test   %eax,%eax
+  800fea:	78 1f                	js     80100b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800fec:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800ff0:	74 20                	je     801012 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800ff2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ff5:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ff8:	85 c0                	test   %eax,%eax
+  800ffa:	74 37                	je     801033 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800ffc:	83 ec 04             	sub    $0x4,%esp
+  800fff:	ff 75 10             	push   0x10(%ebp)
+  801002:	ff 75 0c             	push   0xc(%ebp)
+  801005:	56                   	push   %esi
+  801006:	ff d0                	call   *%eax
+  801008:	83 c4 10             	add    $0x10,%esp
+}
+  80100b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80100e:	5b                   	pop    %ebx
+  80100f:	5e                   	pop    %esi
+  801010:	5d                   	pop    %ebp
+  801011:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801012:	a1 08 40 80 00       	mov    0x804008,%eax
+  801017:	8b 40 48             	mov    0x48(%eax),%eax
+  80101a:	83 ec 04             	sub    $0x4,%esp
+  80101d:	53                   	push   %ebx
+  80101e:	50                   	push   %eax
+  80101f:	68 d9 27 80 00       	push   $0x8027d9
+  801024:	e8 a2 0c 00 00       	call   801ccb <cprintf>
+		return -E_INVAL;
+  801029:	83 c4 10             	add    $0x10,%esp
+  80102c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801031:	eb d8                	jmp    80100b <write+0x53>
+		return -E_NOT_SUPP;
+  801033:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801038:	eb d1                	jmp    80100b <write+0x53>
+
+0080103a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80103a:	55                   	push   %ebp
+  80103b:	89 e5                	mov    %esp,%ebp
+  80103d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801040:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801043:	50                   	push   %eax
+  801044:	ff 75 08             	push   0x8(%ebp)
+  801047:	e8 3f fc ff ff       	call   800c8b <fd_lookup>
+  80104c:	83 c4 10             	add    $0x10,%esp
+  80104f:	85 c0                	test   %eax,%eax
+  801051:	78 0e                	js     801061 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801053:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801056:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801059:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80105c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801061:	c9                   	leave
+  801062:	c3                   	ret
+
+00801063 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801063:	55                   	push   %ebp
+  801064:	89 e5                	mov    %esp,%ebp
+  801066:	56                   	push   %esi
+  801067:	53                   	push   %ebx
+  801068:	83 ec 18             	sub    $0x18,%esp
+  80106b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80106e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801071:	50                   	push   %eax
+  801072:	53                   	push   %ebx
+  801073:	e8 13 fc ff ff       	call   800c8b <fd_lookup>
+  801078:	83 c4 10             	add    $0x10,%esp
+  80107b:	85 c0                	test   %eax,%eax
+  80107d:	78 34                	js     8010b3 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80107f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801082:	83 ec 08             	sub    $0x8,%esp
+  801085:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801088:	50                   	push   %eax
+  801089:	ff 36                	push   (%esi)
+  80108b:	e8 4b fc ff ff       	call   800cdb <dev_lookup>
+  801090:	83 c4 10             	add    $0x10,%esp
+  801093:	85 c0                	test   %eax,%eax
+  801095:	78 1c                	js     8010b3 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801097:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80109b:	74 1d                	je     8010ba <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80109d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010a0:	8b 40 18             	mov    0x18(%eax),%eax
+  8010a3:	85 c0                	test   %eax,%eax
+  8010a5:	74 34                	je     8010db <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8010a7:	83 ec 08             	sub    $0x8,%esp
+  8010aa:	ff 75 0c             	push   0xc(%ebp)
+  8010ad:	56                   	push   %esi
+  8010ae:	ff d0                	call   *%eax
+  8010b0:	83 c4 10             	add    $0x10,%esp
+}
+  8010b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010b6:	5b                   	pop    %ebx
+  8010b7:	5e                   	pop    %esi
+  8010b8:	5d                   	pop    %ebp
+  8010b9:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8010ba:	a1 08 40 80 00       	mov    0x804008,%eax
+  8010bf:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8010c2:	83 ec 04             	sub    $0x4,%esp
+  8010c5:	53                   	push   %ebx
+  8010c6:	50                   	push   %eax
+  8010c7:	68 9c 27 80 00       	push   $0x80279c
+  8010cc:	e8 fa 0b 00 00       	call   801ccb <cprintf>
+		return -E_INVAL;
+  8010d1:	83 c4 10             	add    $0x10,%esp
+  8010d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010d9:	eb d8                	jmp    8010b3 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8010db:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8010e0:	eb d1                	jmp    8010b3 <ftruncate+0x50>
+
+008010e2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8010e2:	55                   	push   %ebp
+  8010e3:	89 e5                	mov    %esp,%ebp
+  8010e5:	56                   	push   %esi
+  8010e6:	53                   	push   %ebx
+  8010e7:	83 ec 18             	sub    $0x18,%esp
+  8010ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8010ed:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8010f0:	50                   	push   %eax
+  8010f1:	ff 75 08             	push   0x8(%ebp)
+  8010f4:	e8 92 fb ff ff       	call   800c8b <fd_lookup>
+  8010f9:	83 c4 10             	add    $0x10,%esp
+  8010fc:	85 c0                	test   %eax,%eax
+  8010fe:	78 49                	js     801149 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801100:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801103:	83 ec 08             	sub    $0x8,%esp
+  801106:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801109:	50                   	push   %eax
+  80110a:	ff 36                	push   (%esi)
+  80110c:	e8 ca fb ff ff       	call   800cdb <dev_lookup>
+  801111:	83 c4 10             	add    $0x10,%esp
+  801114:	85 c0                	test   %eax,%eax
+  801116:	78 31                	js     801149 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801118:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80111b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80111f:	74 2f                	je     801150 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801121:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801124:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80112b:	00 00 00 
+	stat->st_isdir = 0;
+  80112e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801135:	00 00 00 
+	stat->st_dev = dev;
+  801138:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80113e:	83 ec 08             	sub    $0x8,%esp
+  801141:	53                   	push   %ebx
+  801142:	56                   	push   %esi
+  801143:	ff 50 14             	call   *0x14(%eax)
+  801146:	83 c4 10             	add    $0x10,%esp
+}
+  801149:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80114c:	5b                   	pop    %ebx
+  80114d:	5e                   	pop    %esi
+  80114e:	5d                   	pop    %ebp
+  80114f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801150:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801155:	eb f2                	jmp    801149 <fstat+0x67>
+
+00801157 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801157:	55                   	push   %ebp
+  801158:	89 e5                	mov    %esp,%ebp
+  80115a:	56                   	push   %esi
+  80115b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80115c:	83 ec 08             	sub    $0x8,%esp
+  80115f:	6a 00                	push   $0x0
+  801161:	ff 75 08             	push   0x8(%ebp)
+  801164:	e8 bc 02 00 00       	call   801425 <open>
+  801169:	89 c3                	mov    %eax,%ebx
+  80116b:	83 c4 10             	add    $0x10,%esp
+  80116e:	85 c0                	test   %eax,%eax
+  801170:	78 1b                	js     80118d <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801172:	83 ec 08             	sub    $0x8,%esp
+  801175:	ff 75 0c             	push   0xc(%ebp)
+  801178:	50                   	push   %eax
+  801179:	e8 64 ff ff ff       	call   8010e2 <fstat>
+  80117e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801180:	89 1c 24             	mov    %ebx,(%esp)
+  801183:	e8 26 fc ff ff       	call   800dae <close>
+	return r;
+  801188:	83 c4 10             	add    $0x10,%esp
+  80118b:	89 f3                	mov    %esi,%ebx
+}
+  80118d:	89 d8                	mov    %ebx,%eax
+  80118f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801192:	5b                   	pop    %ebx
+  801193:	5e                   	pop    %esi
+  801194:	5d                   	pop    %ebp
+  801195:	c3                   	ret
+
+00801196 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801196:	55                   	push   %ebp
+  801197:	89 e5                	mov    %esp,%ebp
+  801199:	57                   	push   %edi
+  80119a:	56                   	push   %esi
+  80119b:	53                   	push   %ebx
+  80119c:	83 ec 0c             	sub    $0xc,%esp
+  80119f:	89 c7                	mov    %eax,%edi
+  8011a1:	89 d3                	mov    %edx,%ebx
+  8011a3:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8011a5:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8011ac:	74 2d                	je     8011db <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8011ae:	6a 07                	push   $0x7
+  8011b0:	68 00 50 80 00       	push   $0x805000
+  8011b5:	57                   	push   %edi
+  8011b6:	ff 35 00 40 80 00    	push   0x804000
+  8011bc:	e8 04 12 00 00       	call   8023c5 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  8011c1:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8011c8:	6a 00                	push   $0x0
+  8011ca:	56                   	push   %esi
+  8011cb:	53                   	push   %ebx
+  8011cc:	6a 00                	push   $0x0
+  8011ce:	e8 a4 10 00 00       	call   802277 <ipc_recv_pages>
+}
+  8011d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d6:	5b                   	pop    %ebx
+  8011d7:	5e                   	pop    %esi
+  8011d8:	5f                   	pop    %edi
+  8011d9:	5d                   	pop    %ebp
+  8011da:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8011db:	83 ec 0c             	sub    $0xc,%esp
+  8011de:	6a 01                	push   $0x1
+  8011e0:	e8 d5 12 00 00       	call   8024ba <ipc_find_env>
+  8011e5:	a3 00 40 80 00       	mov    %eax,0x804000
+  8011ea:	83 c4 10             	add    $0x10,%esp
+  8011ed:	eb bf                	jmp    8011ae <fsipc_pages+0x18>
+
+008011ef <fsipc>:
+{
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  8011f5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011fa:	e8 97 ff ff ff       	call   801196 <fsipc_pages>
+}
+  8011ff:	c9                   	leave
+  801200:	c3                   	ret
+
+00801201 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801201:	55                   	push   %ebp
+  801202:	89 e5                	mov    %esp,%ebp
+  801204:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801207:	8b 45 08             	mov    0x8(%ebp),%eax
+  80120a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80120d:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  801212:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801215:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80121a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80121f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801224:	e8 c6 ff ff ff       	call   8011ef <fsipc>
+}
+  801229:	c9                   	leave
+  80122a:	c3                   	ret
+
+0080122b <devfile_flush>:
+{
+  80122b:	55                   	push   %ebp
+  80122c:	89 e5                	mov    %esp,%ebp
+  80122e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801231:	8b 45 08             	mov    0x8(%ebp),%eax
+  801234:	8b 40 0c             	mov    0xc(%eax),%eax
+  801237:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80123c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801241:	b8 06 00 00 00       	mov    $0x6,%eax
+  801246:	e8 a4 ff ff ff       	call   8011ef <fsipc>
+}
+  80124b:	c9                   	leave
+  80124c:	c3                   	ret
+
+0080124d <devfile_stat>:
+{
+  80124d:	55                   	push   %ebp
+  80124e:	89 e5                	mov    %esp,%ebp
+  801250:	53                   	push   %ebx
+  801251:	83 ec 04             	sub    $0x4,%esp
+  801254:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801257:	8b 45 08             	mov    0x8(%ebp),%eax
+  80125a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80125d:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801262:	ba 00 00 00 00       	mov    $0x0,%edx
+  801267:	b8 05 00 00 00       	mov    $0x5,%eax
+  80126c:	e8 7e ff ff ff       	call   8011ef <fsipc>
+  801271:	85 c0                	test   %eax,%eax
+  801273:	78 2c                	js     8012a1 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801275:	83 ec 08             	sub    $0x8,%esp
+  801278:	68 00 50 80 00       	push   $0x805000
+  80127d:	53                   	push   %ebx
+  80127e:	e8 ff ee ff ff       	call   800182 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801283:	a1 80 50 80 00       	mov    0x805080,%eax
+  801288:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80128e:	a1 84 50 80 00       	mov    0x805084,%eax
+  801293:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801299:	83 c4 10             	add    $0x10,%esp
+  80129c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012a4:	c9                   	leave
+  8012a5:	c3                   	ret
+
+008012a6 <devfile_write>:
+{
+  8012a6:	55                   	push   %ebp
+  8012a7:	89 e5                	mov    %esp,%ebp
+  8012a9:	83 ec 0c             	sub    $0xc,%esp
+  8012ac:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8012af:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8012b4:	39 d0                	cmp    %edx,%eax
+  8012b6:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8012b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012bc:	8b 52 0c             	mov    0xc(%edx),%edx
+  8012bf:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  8012c5:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8012ca:	50                   	push   %eax
+  8012cb:	ff 75 0c             	push   0xc(%ebp)
+  8012ce:	68 08 50 80 00       	push   $0x805008
+  8012d3:	e8 30 f0 ff ff       	call   800308 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8012d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012dd:	b8 04 00 00 00       	mov    $0x4,%eax
+  8012e2:	e8 08 ff ff ff       	call   8011ef <fsipc>
+}
+  8012e7:	c9                   	leave
+  8012e8:	c3                   	ret
+
+008012e9 <devfile_read>:
+{
+  8012e9:	55                   	push   %ebp
+  8012ea:	89 e5                	mov    %esp,%ebp
+  8012ec:	57                   	push   %edi
+  8012ed:	56                   	push   %esi
+  8012ee:	53                   	push   %ebx
+  8012ef:	83 ec 1c             	sub    $0x1c,%esp
+  8012f2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8012f5:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8012f8:	89 fe                	mov    %edi,%esi
+  8012fa:	c1 ee 0c             	shr    $0xc,%esi
+  8012fd:	b8 20 00 00 00       	mov    $0x20,%eax
+  801302:	39 c6                	cmp    %eax,%esi
+  801304:	0f 47 f0             	cmova  %eax,%esi
+  801307:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80130a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80130f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801312:	eb 14                	jmp    801328 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801314:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  80131b:	05 00 10 00 00       	add    $0x1000,%eax
+  801320:	f6 c6 06             	test   $0x6,%dh
+  801323:	75 42                	jne    801367 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801325:	83 c1 01             	add    $0x1,%ecx
+  801328:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80132b:	39 f1                	cmp    %esi,%ecx
+  80132d:	0f 84 95 00 00 00    	je     8013c8 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801333:	89 c2                	mov    %eax,%edx
+  801335:	c1 ea 16             	shr    $0x16,%edx
+  801338:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  80133f:	f6 c2 01             	test   $0x1,%dl
+  801342:	74 23                	je     801367 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801344:	89 c2                	mov    %eax,%edx
+  801346:	c1 ea 0c             	shr    $0xc,%edx
+  801349:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801350:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801356:	74 0f                	je     801367 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801358:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  80135f:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801365:	75 ad                	jne    801314 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801367:	85 c9                	test   %ecx,%ecx
+  801369:	74 11                	je     80137c <devfile_read+0x93>
+  80136b:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801372:	75 08                	jne    80137c <devfile_read+0x93>
+  801374:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  80137a:	74 50                	je     8013cc <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80137c:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80137f:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  801384:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80138a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80138f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801394:	e8 56 fe ff ff       	call   8011ef <fsipc>
+  801399:	89 c6                	mov    %eax,%esi
+  80139b:	85 c0                	test   %eax,%eax
+  80139d:	78 1f                	js     8013be <devfile_read+0xd5>
+	assert(r <= n);
+  80139f:	39 c7                	cmp    %eax,%edi
+  8013a1:	72 50                	jb     8013f3 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  8013a3:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8013a8:	7f 62                	jg     80140c <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  8013aa:	83 ec 04             	sub    $0x4,%esp
+  8013ad:	50                   	push   %eax
+  8013ae:	68 00 50 80 00       	push   $0x805000
+  8013b3:	ff 75 0c             	push   0xc(%ebp)
+  8013b6:	e8 4d ef ff ff       	call   800308 <memmove>
+	return r;
+  8013bb:	83 c4 10             	add    $0x10,%esp
+}
+  8013be:	89 f0                	mov    %esi,%eax
+  8013c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c3:	5b                   	pop    %ebx
+  8013c4:	5e                   	pop    %esi
+  8013c5:	5f                   	pop    %edi
+  8013c6:	5d                   	pop    %ebp
+  8013c7:	c3                   	ret
+  8013c8:	89 f1                	mov    %esi,%ecx
+  8013ca:	eb 9b                	jmp    801367 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  8013cc:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8013cf:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  8013d4:	89 c8                	mov    %ecx,%eax
+  8013d6:	c1 e0 0c             	shl    $0xc,%eax
+  8013d9:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  8013de:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013e1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8013e6:	e8 ab fd ff ff       	call   801196 <fsipc_pages>
+  8013eb:	89 c6                	mov    %eax,%esi
+  8013ed:	85 c0                	test   %eax,%eax
+  8013ef:	78 8b                	js     80137c <devfile_read+0x93>
+  8013f1:	eb cb                	jmp    8013be <devfile_read+0xd5>
+	assert(r <= n);
+  8013f3:	68 08 28 80 00       	push   $0x802808
+  8013f8:	68 0f 28 80 00       	push   $0x80280f
+  8013fd:	68 a0 00 00 00       	push   $0xa0
+  801402:	68 24 28 80 00       	push   $0x802824
+  801407:	e8 e4 07 00 00       	call   801bf0 <_panic>
+	assert(r <= PGSIZE);
+  80140c:	68 2f 28 80 00       	push   $0x80282f
+  801411:	68 0f 28 80 00       	push   $0x80280f
+  801416:	68 a1 00 00 00       	push   $0xa1
+  80141b:	68 24 28 80 00       	push   $0x802824
+  801420:	e8 cb 07 00 00       	call   801bf0 <_panic>
+
+00801425 <open>:
+{
+  801425:	55                   	push   %ebp
+  801426:	89 e5                	mov    %esp,%ebp
+  801428:	56                   	push   %esi
+  801429:	53                   	push   %ebx
+  80142a:	83 ec 1c             	sub    $0x1c,%esp
+  80142d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801430:	56                   	push   %esi
+  801431:	e8 11 ed ff ff       	call   800147 <strlen>
+  801436:	83 c4 10             	add    $0x10,%esp
+  801439:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80143e:	7f 6c                	jg     8014ac <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801440:	83 ec 0c             	sub    $0xc,%esp
+  801443:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801446:	50                   	push   %eax
+  801447:	e8 eb f7 ff ff       	call   800c37 <fd_alloc>
+  80144c:	89 c3                	mov    %eax,%ebx
+  80144e:	83 c4 10             	add    $0x10,%esp
+  801451:	85 c0                	test   %eax,%eax
+  801453:	78 3c                	js     801491 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801455:	83 ec 08             	sub    $0x8,%esp
+  801458:	56                   	push   %esi
+  801459:	68 00 50 80 00       	push   $0x805000
+  80145e:	e8 1f ed ff ff       	call   800182 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801463:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801466:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80146b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80146e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801473:	e8 77 fd ff ff       	call   8011ef <fsipc>
+  801478:	89 c3                	mov    %eax,%ebx
+  80147a:	83 c4 10             	add    $0x10,%esp
+  80147d:	85 c0                	test   %eax,%eax
+  80147f:	78 19                	js     80149a <open+0x75>
+	return fd2num(fd);
+  801481:	83 ec 0c             	sub    $0xc,%esp
+  801484:	ff 75 f4             	push   -0xc(%ebp)
+  801487:	e8 84 f7 ff ff       	call   800c10 <fd2num>
+  80148c:	89 c3                	mov    %eax,%ebx
+  80148e:	83 c4 10             	add    $0x10,%esp
+}
+  801491:	89 d8                	mov    %ebx,%eax
+  801493:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801496:	5b                   	pop    %ebx
+  801497:	5e                   	pop    %esi
+  801498:	5d                   	pop    %ebp
+  801499:	c3                   	ret
+		fd_close(fd, 0);
+  80149a:	83 ec 08             	sub    $0x8,%esp
+  80149d:	6a 00                	push   $0x0
+  80149f:	ff 75 f4             	push   -0xc(%ebp)
+  8014a2:	e8 80 f8 ff ff       	call   800d27 <fd_close>
+		return r;
+  8014a7:	83 c4 10             	add    $0x10,%esp
+  8014aa:	eb e5                	jmp    801491 <open+0x6c>
+		return -E_BAD_PATH;
+  8014ac:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8014b1:	eb de                	jmp    801491 <open+0x6c>
+
+008014b3 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8014b3:	55                   	push   %ebp
+  8014b4:	89 e5                	mov    %esp,%ebp
+  8014b6:	53                   	push   %ebx
+  8014b7:	83 ec 10             	sub    $0x10,%esp
+  8014ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8014bd:	53                   	push   %ebx
+  8014be:	e8 84 ec ff ff       	call   800147 <strlen>
+  8014c3:	83 c4 10             	add    $0x10,%esp
+  8014c6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8014cb:	7f 25                	jg     8014f2 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8014cd:	83 ec 08             	sub    $0x8,%esp
+  8014d0:	53                   	push   %ebx
+  8014d1:	68 00 50 80 00       	push   $0x805000
+  8014d6:	e8 a7 ec ff ff       	call   800182 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8014db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8014e5:	e8 05 fd ff ff       	call   8011ef <fsipc>
+  8014ea:	83 c4 10             	add    $0x10,%esp
+}
+  8014ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014f0:	c9                   	leave
+  8014f1:	c3                   	ret
+		return -E_BAD_PATH;
+  8014f2:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8014f7:	eb f4                	jmp    8014ed <remove+0x3a>
+
+008014f9 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8014f9:	55                   	push   %ebp
+  8014fa:	89 e5                	mov    %esp,%ebp
+  8014fc:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8014ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801504:	b8 08 00 00 00       	mov    $0x8,%eax
+  801509:	e8 e1 fc ff ff       	call   8011ef <fsipc>
+}
+  80150e:	c9                   	leave
+  80150f:	c3                   	ret
+
+00801510 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801510:	55                   	push   %ebp
+  801511:	89 e5                	mov    %esp,%ebp
+  801513:	53                   	push   %ebx
+  801514:	83 ec 04             	sub    $0x4,%esp
+  801517:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  80151a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80151f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801524:	e8 c6 fc ff ff       	call   8011ef <fsipc>
+  801529:	85 c0                	test   %eax,%eax
+  80152b:	78 3c                	js     801569 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  80152d:	a1 00 50 80 00       	mov    0x805000,%eax
+  801532:	89 03                	mov    %eax,(%ebx)
+  801534:	a1 04 50 80 00       	mov    0x805004,%eax
+  801539:	89 43 04             	mov    %eax,0x4(%ebx)
+  80153c:	a1 08 50 80 00       	mov    0x805008,%eax
+  801541:	89 43 08             	mov    %eax,0x8(%ebx)
+  801544:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801549:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80154c:	a1 10 50 80 00       	mov    0x805010,%eax
+  801551:	89 43 10             	mov    %eax,0x10(%ebx)
+  801554:	a1 14 50 80 00       	mov    0x805014,%eax
+  801559:	89 43 14             	mov    %eax,0x14(%ebx)
+  80155c:	a1 18 50 80 00       	mov    0x805018,%eax
+  801561:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801564:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801569:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80156c:	c9                   	leave
+  80156d:	c3                   	ret
+
+0080156e <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  80156e:	55                   	push   %ebp
+  80156f:	89 e5                	mov    %esp,%ebp
+  801571:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801574:	8b 45 08             	mov    0x8(%ebp),%eax
+  801577:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  80157c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801581:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801586:	e8 64 fc ff ff       	call   8011ef <fsipc>
+}
+  80158b:	c9                   	leave
+  80158c:	c3                   	ret
+
+0080158d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80158d:	55                   	push   %ebp
+  80158e:	89 e5                	mov    %esp,%ebp
+  801590:	56                   	push   %esi
+  801591:	53                   	push   %ebx
+  801592:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801595:	83 ec 0c             	sub    $0xc,%esp
+  801598:	ff 75 08             	push   0x8(%ebp)
+  80159b:	e8 80 f6 ff ff       	call   800c20 <fd2data>
+  8015a0:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8015a2:	83 c4 08             	add    $0x8,%esp
+  8015a5:	68 3b 28 80 00       	push   $0x80283b
+  8015aa:	53                   	push   %ebx
+  8015ab:	e8 d2 eb ff ff       	call   800182 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8015b0:	8b 46 04             	mov    0x4(%esi),%eax
+  8015b3:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8015b9:	2b 0e                	sub    (%esi),%ecx
+  8015bb:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8015c0:	89 c8                	mov    %ecx,%eax
+  8015c2:	f7 e2                	mul    %edx
+  8015c4:	c1 ea 0c             	shr    $0xc,%edx
+  8015c7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8015cd:	29 d1                	sub    %edx,%ecx
+  8015cf:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8015d5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8015dc:	00 00 00 
+	stat->st_dev = &devpipe;
+  8015df:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  8015e6:	30 80 00 
+	return 0;
+}
+  8015e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015f1:	5b                   	pop    %ebx
+  8015f2:	5e                   	pop    %esi
+  8015f3:	5d                   	pop    %ebp
+  8015f4:	c3                   	ret
+
+008015f5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8015f5:	55                   	push   %ebp
+  8015f6:	89 e5                	mov    %esp,%ebp
+  8015f8:	53                   	push   %ebx
+  8015f9:	83 ec 0c             	sub    $0xc,%esp
+  8015fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8015ff:	53                   	push   %ebx
+  801600:	6a 00                	push   $0x0
+  801602:	e8 f3 f0 ff ff       	call   8006fa <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801607:	89 1c 24             	mov    %ebx,(%esp)
+  80160a:	e8 11 f6 ff ff       	call   800c20 <fd2data>
+  80160f:	83 c4 08             	add    $0x8,%esp
+  801612:	50                   	push   %eax
+  801613:	6a 00                	push   $0x0
+  801615:	e8 e0 f0 ff ff       	call   8006fa <sys_page_unmap>
+}
+  80161a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80161d:	c9                   	leave
+  80161e:	c3                   	ret
+
+0080161f <_pipeisclosed>:
+{
+  80161f:	55                   	push   %ebp
+  801620:	89 e5                	mov    %esp,%ebp
+  801622:	57                   	push   %edi
+  801623:	56                   	push   %esi
+  801624:	53                   	push   %ebx
+  801625:	83 ec 1c             	sub    $0x1c,%esp
+  801628:	89 c7                	mov    %eax,%edi
+  80162a:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80162c:	a1 08 40 80 00       	mov    0x804008,%eax
+  801631:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801634:	83 ec 0c             	sub    $0xc,%esp
+  801637:	57                   	push   %edi
+  801638:	e8 bc 0e 00 00       	call   8024f9 <pageref>
+  80163d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801640:	89 34 24             	mov    %esi,(%esp)
+  801643:	e8 b1 0e 00 00       	call   8024f9 <pageref>
+		nn = thisenv->env_runs;
+  801648:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80164e:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801651:	83 c4 10             	add    $0x10,%esp
+  801654:	39 cb                	cmp    %ecx,%ebx
+  801656:	74 1b                	je     801673 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801658:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80165b:	75 cf                	jne    80162c <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80165d:	8b 42 58             	mov    0x58(%edx),%eax
+  801660:	6a 01                	push   $0x1
+  801662:	50                   	push   %eax
+  801663:	53                   	push   %ebx
+  801664:	68 42 28 80 00       	push   $0x802842
+  801669:	e8 5d 06 00 00       	call   801ccb <cprintf>
+  80166e:	83 c4 10             	add    $0x10,%esp
+  801671:	eb b9                	jmp    80162c <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801673:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801676:	0f 94 c0             	sete   %al
+  801679:	0f b6 c0             	movzbl %al,%eax
+}
+  80167c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80167f:	5b                   	pop    %ebx
+  801680:	5e                   	pop    %esi
+  801681:	5f                   	pop    %edi
+  801682:	5d                   	pop    %ebp
+  801683:	c3                   	ret
+
+00801684 <devpipe_read>:
+{
+  801684:	55                   	push   %ebp
+  801685:	89 e5                	mov    %esp,%ebp
+  801687:	57                   	push   %edi
+  801688:	56                   	push   %esi
+  801689:	53                   	push   %ebx
+  80168a:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80168d:	ff 75 08             	push   0x8(%ebp)
+  801690:	e8 8b f5 ff ff       	call   800c20 <fd2data>
+  801695:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801697:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  80169a:	8d 40 04             	lea    0x4(%eax),%eax
+  80169d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8016a0:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8016a3:	8b 0b                	mov    (%ebx),%ecx
+  8016a5:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8016ab:	29 ce                	sub    %ecx,%esi
+  8016ad:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8016b2:	f7 e6                	mul    %esi
+  8016b4:	c1 ea 0c             	shr    $0xc,%edx
+  8016b7:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8016bd:	29 c6                	sub    %eax,%esi
+  8016bf:	89 f2                	mov    %esi,%edx
+  8016c1:	75 43                	jne    801706 <devpipe_read+0x82>
+		ref = pageref(p);
+  8016c3:	83 ec 0c             	sub    $0xc,%esp
+  8016c6:	53                   	push   %ebx
+  8016c7:	e8 2d 0e 00 00       	call   8024f9 <pageref>
+  8016cc:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8016ce:	89 da                	mov    %ebx,%edx
+  8016d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016d3:	e8 47 ff ff ff       	call   80161f <_pipeisclosed>
+  8016d8:	83 c4 10             	add    $0x10,%esp
+  8016db:	85 c0                	test   %eax,%eax
+  8016dd:	0f 85 c1 00 00 00    	jne    8017a4 <devpipe_read+0x120>
+	*sleeping = 1;
+  8016e3:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  8016ea:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8016ef:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  8016f2:	75 ac                	jne    8016a0 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  8016f4:	83 ec 04             	sub    $0x4,%esp
+  8016f7:	56                   	push   %esi
+  8016f8:	57                   	push   %edi
+  8016f9:	ff 75 e4             	push   -0x1c(%ebp)
+  8016fc:	e8 4d f4 ff ff       	call   800b4e <sys_futex_wait>
+  801701:	83 c4 10             	add    $0x10,%esp
+  801704:	eb 9a                	jmp    8016a0 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801706:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801709:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  80170d:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80170f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801714:	f7 e1                	mul    %ecx
+  801716:	c1 ea 0b             	shr    $0xb,%edx
+  801719:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80171f:	29 c1                	sub    %eax,%ecx
+  801721:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801723:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801728:	29 cf                	sub    %ecx,%edi
+  80172a:	39 f7                	cmp    %esi,%edi
+  80172c:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  80172f:	8d 43 10             	lea    0x10(%ebx),%eax
+  801732:	83 ec 04             	sub    $0x4,%esp
+  801735:	57                   	push   %edi
+  801736:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801739:	01 c2                	add    %eax,%edx
+  80173b:	52                   	push   %edx
+  80173c:	ff 75 0c             	push   0xc(%ebp)
+  80173f:	e8 c4 eb ff ff       	call   800308 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801744:	83 c4 0c             	add    $0xc,%esp
+  801747:	89 f1                	mov    %esi,%ecx
+  801749:	29 f9                	sub    %edi,%ecx
+  80174b:	51                   	push   %ecx
+  80174c:	ff 75 e4             	push   -0x1c(%ebp)
+  80174f:	89 f8                	mov    %edi,%eax
+  801751:	03 45 0c             	add    0xc(%ebp),%eax
+  801754:	50                   	push   %eax
+  801755:	e8 ae eb ff ff       	call   800308 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  80175a:	89 f1                	mov    %esi,%ecx
+  80175c:	03 0b                	add    (%ebx),%ecx
+  80175e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801763:	f7 e1                	mul    %ecx
+  801765:	c1 ea 0c             	shr    $0xc,%edx
+  801768:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80176e:	29 d1                	sub    %edx,%ecx
+  801770:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801772:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801777:	83 c4 10             	add    $0x10,%esp
+  80177a:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  80177e:	75 0a                	jne    80178a <devpipe_read+0x106>
+	return n;
+  801780:	89 f0                	mov    %esi,%eax
+}
+  801782:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801785:	5b                   	pop    %ebx
+  801786:	5e                   	pop    %esi
+  801787:	5f                   	pop    %edi
+  801788:	5d                   	pop    %ebp
+  801789:	c3                   	ret
+		*sleeping = 0;
+  80178a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801791:	83 ec 08             	sub    $0x8,%esp
+  801794:	68 00 04 00 00       	push   $0x400
+  801799:	53                   	push   %ebx
+  80179a:	e8 ff f3 ff ff       	call   800b9e <sys_futex_wake>
+  80179f:	83 c4 10             	add    $0x10,%esp
+  8017a2:	eb dc                	jmp    801780 <devpipe_read+0xfc>
+			return 0;
+  8017a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a9:	eb d7                	jmp    801782 <devpipe_read+0xfe>
+
+008017ab <devpipe_write>:
+{
+  8017ab:	55                   	push   %ebp
+  8017ac:	89 e5                	mov    %esp,%ebp
+  8017ae:	57                   	push   %edi
+  8017af:	56                   	push   %esi
+  8017b0:	53                   	push   %ebx
+  8017b1:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8017b4:	ff 75 08             	push   0x8(%ebp)
+  8017b7:	e8 64 f4 ff ff       	call   800c20 <fd2data>
+  8017bc:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8017be:	83 c4 10             	add    $0x10,%esp
+  8017c1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8017c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8017cb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8017ce:	0f 83 23 01 00 00    	jae    8018f7 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8017d4:	8b 77 04             	mov    0x4(%edi),%esi
+  8017d7:	8b 1f                	mov    (%edi),%ebx
+  8017d9:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  8017df:	29 d9                	sub    %ebx,%ecx
+  8017e1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8017e6:	f7 e1                	mul    %ecx
+  8017e8:	c1 ea 0c             	shr    $0xc,%edx
+  8017eb:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8017f1:	29 c1                	sub    %eax,%ecx
+  8017f3:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8017f5:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8017fb:	75 40                	jne    80183d <devpipe_write+0x92>
+			ref = pageref(p);
+  8017fd:	83 ec 0c             	sub    $0xc,%esp
+  801800:	57                   	push   %edi
+  801801:	e8 f3 0c 00 00       	call   8024f9 <pageref>
+  801806:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801808:	89 fa                	mov    %edi,%edx
+  80180a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180d:	e8 0d fe ff ff       	call   80161f <_pipeisclosed>
+  801812:	83 c4 10             	add    $0x10,%esp
+  801815:	85 c0                	test   %eax,%eax
+  801817:	0f 85 d5 00 00 00    	jne    8018f2 <devpipe_write+0x147>
+	*sleeping = 1;
+  80181d:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801824:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801829:	39 1f                	cmp    %ebx,(%edi)
+  80182b:	75 a7                	jne    8017d4 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  80182d:	83 ec 04             	sub    $0x4,%esp
+  801830:	56                   	push   %esi
+  801831:	53                   	push   %ebx
+  801832:	57                   	push   %edi
+  801833:	e8 16 f3 ff ff       	call   800b4e <sys_futex_wait>
+  801838:	83 c4 10             	add    $0x10,%esp
+  80183b:	eb 97                	jmp    8017d4 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80183d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801840:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801843:	29 c1                	sub    %eax,%ecx
+  801845:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80184a:	89 d8                	mov    %ebx,%eax
+  80184c:	29 d0                	sub    %edx,%eax
+  80184e:	39 c1                	cmp    %eax,%ecx
+  801850:	0f 46 c1             	cmovbe %ecx,%eax
+  801853:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801855:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80185a:	f7 e6                	mul    %esi
+  80185c:	c1 ea 0b             	shr    $0xb,%edx
+  80185f:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801865:	29 c6                	sub    %eax,%esi
+  801867:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801869:	29 f3                	sub    %esi,%ebx
+  80186b:	39 cb                	cmp    %ecx,%ebx
+  80186d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801870:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801873:	8d 77 10             	lea    0x10(%edi),%esi
+  801876:	83 ec 04             	sub    $0x4,%esp
+  801879:	53                   	push   %ebx
+  80187a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80187d:	03 45 0c             	add    0xc(%ebp),%eax
+  801880:	50                   	push   %eax
+  801881:	01 f2                	add    %esi,%edx
+  801883:	52                   	push   %edx
+  801884:	e8 7f ea ff ff       	call   800308 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  801889:	83 c4 0c             	add    $0xc,%esp
+  80188c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80188f:	29 d8                	sub    %ebx,%eax
+  801891:	50                   	push   %eax
+  801892:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801895:	01 d3                	add    %edx,%ebx
+  801897:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80189a:	53                   	push   %ebx
+  80189b:	56                   	push   %esi
+  80189c:	e8 67 ea ff ff       	call   800308 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8018a1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8018a4:	03 4f 04             	add    0x4(%edi),%ecx
+  8018a7:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8018ac:	f7 e1                	mul    %ecx
+  8018ae:	c1 ea 0c             	shr    $0xc,%edx
+  8018b1:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8018b7:	29 d1                	sub    %edx,%ecx
+  8018b9:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8018bc:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8018c1:	83 c4 10             	add    $0x10,%esp
+  8018c4:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8018c8:	75 0b                	jne    8018d5 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8018ca:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8018cd:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8018d0:	e9 f3 fe ff ff       	jmp    8017c8 <devpipe_write+0x1d>
+		*sleeping = 0;
+  8018d5:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8018dc:	83 ec 08             	sub    $0x8,%esp
+  8018df:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  8018e4:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  8018e7:	50                   	push   %eax
+  8018e8:	e8 b1 f2 ff ff       	call   800b9e <sys_futex_wake>
+  8018ed:	83 c4 10             	add    $0x10,%esp
+  8018f0:	eb d8                	jmp    8018ca <devpipe_write+0x11f>
+				return 0;
+  8018f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018fa:	5b                   	pop    %ebx
+  8018fb:	5e                   	pop    %esi
+  8018fc:	5f                   	pop    %edi
+  8018fd:	5d                   	pop    %ebp
+  8018fe:	c3                   	ret
+
+008018ff <pipe>:
+{
+  8018ff:	55                   	push   %ebp
+  801900:	89 e5                	mov    %esp,%ebp
+  801902:	56                   	push   %esi
+  801903:	53                   	push   %ebx
+  801904:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801907:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80190a:	50                   	push   %eax
+  80190b:	e8 27 f3 ff ff       	call   800c37 <fd_alloc>
+  801910:	89 c3                	mov    %eax,%ebx
+  801912:	83 c4 10             	add    $0x10,%esp
+  801915:	85 c0                	test   %eax,%eax
+  801917:	0f 88 23 01 00 00    	js     801a40 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80191d:	83 ec 04             	sub    $0x4,%esp
+  801920:	68 07 04 00 00       	push   $0x407
+  801925:	ff 75 f4             	push   -0xc(%ebp)
+  801928:	6a 00                	push   $0x0
+  80192a:	e8 46 ed ff ff       	call   800675 <sys_page_alloc>
+  80192f:	89 c3                	mov    %eax,%ebx
+  801931:	83 c4 10             	add    $0x10,%esp
+  801934:	85 c0                	test   %eax,%eax
+  801936:	0f 88 04 01 00 00    	js     801a40 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80193c:	83 ec 0c             	sub    $0xc,%esp
+  80193f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801942:	50                   	push   %eax
+  801943:	e8 ef f2 ff ff       	call   800c37 <fd_alloc>
+  801948:	89 c3                	mov    %eax,%ebx
+  80194a:	83 c4 10             	add    $0x10,%esp
+  80194d:	85 c0                	test   %eax,%eax
+  80194f:	0f 88 db 00 00 00    	js     801a30 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801955:	83 ec 04             	sub    $0x4,%esp
+  801958:	68 07 04 00 00       	push   $0x407
+  80195d:	ff 75 f0             	push   -0x10(%ebp)
+  801960:	6a 00                	push   $0x0
+  801962:	e8 0e ed ff ff       	call   800675 <sys_page_alloc>
+  801967:	89 c3                	mov    %eax,%ebx
+  801969:	83 c4 10             	add    $0x10,%esp
+  80196c:	85 c0                	test   %eax,%eax
+  80196e:	0f 88 bc 00 00 00    	js     801a30 <pipe+0x131>
+	va = fd2data(fd0);
+  801974:	83 ec 0c             	sub    $0xc,%esp
+  801977:	ff 75 f4             	push   -0xc(%ebp)
+  80197a:	e8 a1 f2 ff ff       	call   800c20 <fd2data>
+  80197f:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801981:	83 c4 0c             	add    $0xc,%esp
+  801984:	68 07 04 00 00       	push   $0x407
+  801989:	50                   	push   %eax
+  80198a:	6a 00                	push   $0x0
+  80198c:	e8 e4 ec ff ff       	call   800675 <sys_page_alloc>
+  801991:	89 c3                	mov    %eax,%ebx
+  801993:	83 c4 10             	add    $0x10,%esp
+  801996:	85 c0                	test   %eax,%eax
+  801998:	0f 88 82 00 00 00    	js     801a20 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80199e:	83 ec 0c             	sub    $0xc,%esp
+  8019a1:	ff 75 f0             	push   -0x10(%ebp)
+  8019a4:	e8 77 f2 ff ff       	call   800c20 <fd2data>
+  8019a9:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8019b0:	50                   	push   %eax
+  8019b1:	6a 00                	push   $0x0
+  8019b3:	56                   	push   %esi
+  8019b4:	6a 00                	push   $0x0
+  8019b6:	e8 fd ec ff ff       	call   8006b8 <sys_page_map>
+  8019bb:	89 c3                	mov    %eax,%ebx
+  8019bd:	83 c4 20             	add    $0x20,%esp
+  8019c0:	85 c0                	test   %eax,%eax
+  8019c2:	78 4e                	js     801a12 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8019c4:	a1 20 30 80 00       	mov    0x803020,%eax
+  8019c9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8019cc:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8019ce:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8019d1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8019d8:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8019db:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8019dd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8019e0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8019e7:	83 ec 0c             	sub    $0xc,%esp
+  8019ea:	ff 75 f4             	push   -0xc(%ebp)
+  8019ed:	e8 1e f2 ff ff       	call   800c10 <fd2num>
+  8019f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8019f5:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8019f7:	83 c4 04             	add    $0x4,%esp
+  8019fa:	ff 75 f0             	push   -0x10(%ebp)
+  8019fd:	e8 0e f2 ff ff       	call   800c10 <fd2num>
+  801a02:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801a05:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801a08:	83 c4 10             	add    $0x10,%esp
+  801a0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a10:	eb 2e                	jmp    801a40 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801a12:	83 ec 08             	sub    $0x8,%esp
+  801a15:	56                   	push   %esi
+  801a16:	6a 00                	push   $0x0
+  801a18:	e8 dd ec ff ff       	call   8006fa <sys_page_unmap>
+  801a1d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801a20:	83 ec 08             	sub    $0x8,%esp
+  801a23:	ff 75 f0             	push   -0x10(%ebp)
+  801a26:	6a 00                	push   $0x0
+  801a28:	e8 cd ec ff ff       	call   8006fa <sys_page_unmap>
+  801a2d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801a30:	83 ec 08             	sub    $0x8,%esp
+  801a33:	ff 75 f4             	push   -0xc(%ebp)
+  801a36:	6a 00                	push   $0x0
+  801a38:	e8 bd ec ff ff       	call   8006fa <sys_page_unmap>
+  801a3d:	83 c4 10             	add    $0x10,%esp
+}
+  801a40:	89 d8                	mov    %ebx,%eax
+  801a42:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a45:	5b                   	pop    %ebx
+  801a46:	5e                   	pop    %esi
+  801a47:	5d                   	pop    %ebp
+  801a48:	c3                   	ret
+
+00801a49 <pipeisclosed>:
+{
+  801a49:	55                   	push   %ebp
+  801a4a:	89 e5                	mov    %esp,%ebp
+  801a4c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a4f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a52:	50                   	push   %eax
+  801a53:	ff 75 08             	push   0x8(%ebp)
+  801a56:	e8 30 f2 ff ff       	call   800c8b <fd_lookup>
+  801a5b:	83 c4 10             	add    $0x10,%esp
+  801a5e:	85 c0                	test   %eax,%eax
+  801a60:	78 18                	js     801a7a <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801a62:	83 ec 0c             	sub    $0xc,%esp
+  801a65:	ff 75 f4             	push   -0xc(%ebp)
+  801a68:	e8 b3 f1 ff ff       	call   800c20 <fd2data>
+  801a6d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801a6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a72:	e8 a8 fb ff ff       	call   80161f <_pipeisclosed>
+  801a77:	83 c4 10             	add    $0x10,%esp
+}
+  801a7a:	c9                   	leave
+  801a7b:	c3                   	ret
+
+00801a7c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a81:	c3                   	ret
+
+00801a82 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801a82:	55                   	push   %ebp
+  801a83:	89 e5                	mov    %esp,%ebp
+  801a85:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  801a88:	68 5a 28 80 00       	push   $0x80285a
+  801a8d:	ff 75 0c             	push   0xc(%ebp)
+  801a90:	e8 ed e6 ff ff       	call   800182 <strcpy>
+	return 0;
+}
+  801a95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9a:	c9                   	leave
+  801a9b:	c3                   	ret
+
+00801a9c <devcons_write>:
+{
+  801a9c:	55                   	push   %ebp
+  801a9d:	89 e5                	mov    %esp,%ebp
+  801a9f:	57                   	push   %edi
+  801aa0:	56                   	push   %esi
+  801aa1:	53                   	push   %ebx
+  801aa2:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801aa8:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801aad:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  801ab3:	eb 2e                	jmp    801ae3 <devcons_write+0x47>
+		m = n - tot;
+  801ab5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ab8:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801aba:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801abf:	39 c3                	cmp    %eax,%ebx
+  801ac1:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  801ac4:	83 ec 04             	sub    $0x4,%esp
+  801ac7:	53                   	push   %ebx
+  801ac8:	89 f0                	mov    %esi,%eax
+  801aca:	03 45 0c             	add    0xc(%ebp),%eax
+  801acd:	50                   	push   %eax
+  801ace:	57                   	push   %edi
+  801acf:	e8 34 e8 ff ff       	call   800308 <memmove>
+		sys_cputs(buf, m);
+  801ad4:	83 c4 08             	add    $0x8,%esp
+  801ad7:	53                   	push   %ebx
+  801ad8:	57                   	push   %edi
+  801ad9:	e8 ca ea ff ff       	call   8005a8 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801ade:	01 de                	add    %ebx,%esi
+  801ae0:	83 c4 10             	add    $0x10,%esp
+  801ae3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801ae6:	72 cd                	jb     801ab5 <devcons_write+0x19>
+}
+  801ae8:	89 f0                	mov    %esi,%eax
+  801aea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aed:	5b                   	pop    %ebx
+  801aee:	5e                   	pop    %esi
+  801aef:	5f                   	pop    %edi
+  801af0:	5d                   	pop    %ebp
+  801af1:	c3                   	ret
+
+00801af2 <devcons_read>:
+{
+  801af2:	55                   	push   %ebp
+  801af3:	89 e5                	mov    %esp,%ebp
+  801af5:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801af8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801b01:	75 07                	jne    801b0a <devcons_read+0x18>
+  801b03:	eb 1f                	jmp    801b24 <devcons_read+0x32>
+		sys_yield();
+  801b05:	e8 4c eb ff ff       	call   800656 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801b0a:	e8 c8 ea ff ff       	call   8005d7 <sys_cgetc>
+  801b0f:	85 c0                	test   %eax,%eax
+  801b11:	74 f2                	je     801b05 <devcons_read+0x13>
+	if (c < 0)
+  801b13:	78 0f                	js     801b24 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801b15:	83 f8 04             	cmp    $0x4,%eax
+  801b18:	74 0c                	je     801b26 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801b1a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b1d:	88 02                	mov    %al,(%edx)
+	return 1;
+  801b1f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801b24:	c9                   	leave
+  801b25:	c3                   	ret
+		return 0;
+  801b26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2b:	eb f7                	jmp    801b24 <devcons_read+0x32>
+
+00801b2d <cputchar>:
+{
+  801b2d:	55                   	push   %ebp
+  801b2e:	89 e5                	mov    %esp,%ebp
+  801b30:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801b33:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b36:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801b39:	6a 01                	push   $0x1
+  801b3b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801b3e:	50                   	push   %eax
+  801b3f:	e8 64 ea ff ff       	call   8005a8 <sys_cputs>
+}
+  801b44:	83 c4 10             	add    $0x10,%esp
+  801b47:	c9                   	leave
+  801b48:	c3                   	ret
+
+00801b49 <getchar>:
+{
+  801b49:	55                   	push   %ebp
+  801b4a:	89 e5                	mov    %esp,%ebp
+  801b4c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801b4f:	6a 01                	push   $0x1
+  801b51:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801b54:	50                   	push   %eax
+  801b55:	6a 00                	push   $0x0
+  801b57:	e8 8e f3 ff ff       	call   800eea <read>
+	if (r < 0)
+  801b5c:	83 c4 10             	add    $0x10,%esp
+  801b5f:	85 c0                	test   %eax,%eax
+  801b61:	78 06                	js     801b69 <getchar+0x20>
+	if (r < 1)
+  801b63:	74 06                	je     801b6b <getchar+0x22>
+	return c;
+  801b65:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801b69:	c9                   	leave
+  801b6a:	c3                   	ret
+		return -E_EOF;
+  801b6b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801b70:	eb f7                	jmp    801b69 <getchar+0x20>
+
+00801b72 <iscons>:
+{
+  801b72:	55                   	push   %ebp
+  801b73:	89 e5                	mov    %esp,%ebp
+  801b75:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b78:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b7b:	50                   	push   %eax
+  801b7c:	ff 75 08             	push   0x8(%ebp)
+  801b7f:	e8 07 f1 ff ff       	call   800c8b <fd_lookup>
+  801b84:	83 c4 10             	add    $0x10,%esp
+  801b87:	85 c0                	test   %eax,%eax
+  801b89:	78 11                	js     801b9c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  801b8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b8e:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  801b94:	39 10                	cmp    %edx,(%eax)
+  801b96:	0f 94 c0             	sete   %al
+  801b99:	0f b6 c0             	movzbl %al,%eax
+}
+  801b9c:	c9                   	leave
+  801b9d:	c3                   	ret
+
+00801b9e <opencons>:
+{
+  801b9e:	55                   	push   %ebp
+  801b9f:	89 e5                	mov    %esp,%ebp
+  801ba1:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  801ba4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ba7:	50                   	push   %eax
+  801ba8:	e8 8a f0 ff ff       	call   800c37 <fd_alloc>
+  801bad:	83 c4 10             	add    $0x10,%esp
+  801bb0:	85 c0                	test   %eax,%eax
+  801bb2:	78 3a                	js     801bee <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801bb4:	83 ec 04             	sub    $0x4,%esp
+  801bb7:	68 07 04 00 00       	push   $0x407
+  801bbc:	ff 75 f4             	push   -0xc(%ebp)
+  801bbf:	6a 00                	push   $0x0
+  801bc1:	e8 af ea ff ff       	call   800675 <sys_page_alloc>
+  801bc6:	83 c4 10             	add    $0x10,%esp
+  801bc9:	85 c0                	test   %eax,%eax
+  801bcb:	78 21                	js     801bee <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801bcd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bd0:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  801bd6:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801bd8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bdb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801be2:	83 ec 0c             	sub    $0xc,%esp
+  801be5:	50                   	push   %eax
+  801be6:	e8 25 f0 ff ff       	call   800c10 <fd2num>
+  801beb:	83 c4 10             	add    $0x10,%esp
+}
+  801bee:	c9                   	leave
+  801bef:	c3                   	ret
+
+00801bf0 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801bf0:	55                   	push   %ebp
+  801bf1:	89 e5                	mov    %esp,%ebp
+  801bf3:	56                   	push   %esi
+  801bf4:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801bf5:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801bf8:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801bfe:	e8 34 ea ff ff       	call   800637 <sys_getenvid>
+  801c03:	83 ec 0c             	sub    $0xc,%esp
+  801c06:	ff 75 0c             	push   0xc(%ebp)
+  801c09:	ff 75 08             	push   0x8(%ebp)
+  801c0c:	56                   	push   %esi
+  801c0d:	50                   	push   %eax
+  801c0e:	68 68 28 80 00       	push   $0x802868
+  801c13:	e8 b3 00 00 00       	call   801ccb <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801c18:	83 c4 18             	add    $0x18,%esp
+  801c1b:	53                   	push   %ebx
+  801c1c:	ff 75 10             	push   0x10(%ebp)
+  801c1f:	e8 56 00 00 00       	call   801c7a <vcprintf>
+	cprintf("\n");
+  801c24:	c7 04 24 53 28 80 00 	movl   $0x802853,(%esp)
+  801c2b:	e8 9b 00 00 00       	call   801ccb <cprintf>
+  801c30:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801c33:	cc                   	int3
+	while (1)
+  801c34:	eb fd                	jmp    801c33 <_panic+0x43>
+
+00801c36 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801c36:	55                   	push   %ebp
+  801c37:	89 e5                	mov    %esp,%ebp
+  801c39:	53                   	push   %ebx
+  801c3a:	83 ec 04             	sub    $0x4,%esp
+  801c3d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801c40:	8b 13                	mov    (%ebx),%edx
+  801c42:	8d 42 01             	lea    0x1(%edx),%eax
+  801c45:	89 03                	mov    %eax,(%ebx)
+  801c47:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c4a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801c4e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801c53:	74 09                	je     801c5e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  801c55:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801c59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c5c:	c9                   	leave
+  801c5d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  801c5e:	83 ec 08             	sub    $0x8,%esp
+  801c61:	68 ff 00 00 00       	push   $0xff
+  801c66:	8d 43 08             	lea    0x8(%ebx),%eax
+  801c69:	50                   	push   %eax
+  801c6a:	e8 39 e9 ff ff       	call   8005a8 <sys_cputs>
+		b->idx = 0;
+  801c6f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801c75:	83 c4 10             	add    $0x10,%esp
+  801c78:	eb db                	jmp    801c55 <putch+0x1f>
+
+00801c7a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  801c7a:	55                   	push   %ebp
+  801c7b:	89 e5                	mov    %esp,%ebp
+  801c7d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  801c83:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801c8a:	00 00 00 
+	b.cnt = 0;
+  801c8d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  801c94:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  801c97:	ff 75 0c             	push   0xc(%ebp)
+  801c9a:	ff 75 08             	push   0x8(%ebp)
+  801c9d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  801ca3:	50                   	push   %eax
+  801ca4:	68 36 1c 80 00       	push   $0x801c36
+  801ca9:	e8 14 01 00 00       	call   801dc2 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  801cae:	83 c4 08             	add    $0x8,%esp
+  801cb1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801cb7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  801cbd:	50                   	push   %eax
+  801cbe:	e8 e5 e8 ff ff       	call   8005a8 <sys_cputs>
+
+	return b.cnt;
+}
+  801cc3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801cc9:	c9                   	leave
+  801cca:	c3                   	ret
+
+00801ccb <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801ccb:	55                   	push   %ebp
+  801ccc:	89 e5                	mov    %esp,%ebp
+  801cce:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801cd1:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  801cd4:	50                   	push   %eax
+  801cd5:	ff 75 08             	push   0x8(%ebp)
+  801cd8:	e8 9d ff ff ff       	call   801c7a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801cdd:	c9                   	leave
+  801cde:	c3                   	ret
+
+00801cdf <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801cdf:	55                   	push   %ebp
+  801ce0:	89 e5                	mov    %esp,%ebp
+  801ce2:	57                   	push   %edi
+  801ce3:	56                   	push   %esi
+  801ce4:	53                   	push   %ebx
+  801ce5:	83 ec 1c             	sub    $0x1c,%esp
+  801ce8:	89 c7                	mov    %eax,%edi
+  801cea:	89 d6                	mov    %edx,%esi
+  801cec:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cf2:	89 d1                	mov    %edx,%ecx
+  801cf4:	89 c2                	mov    %eax,%edx
+  801cf6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801cf9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801cfc:	8b 45 10             	mov    0x10(%ebp),%eax
+  801cff:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801d02:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801d05:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801d0c:	39 c2                	cmp    %eax,%edx
+  801d0e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801d11:	72 3e                	jb     801d51 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801d13:	83 ec 0c             	sub    $0xc,%esp
+  801d16:	ff 75 18             	push   0x18(%ebp)
+  801d19:	83 eb 01             	sub    $0x1,%ebx
+  801d1c:	53                   	push   %ebx
+  801d1d:	50                   	push   %eax
+  801d1e:	83 ec 08             	sub    $0x8,%esp
+  801d21:	ff 75 e4             	push   -0x1c(%ebp)
+  801d24:	ff 75 e0             	push   -0x20(%ebp)
+  801d27:	ff 75 dc             	push   -0x24(%ebp)
+  801d2a:	ff 75 d8             	push   -0x28(%ebp)
+  801d2d:	e8 d4 08 00 00       	call   802606 <__udivdi3>
+  801d32:	83 c4 18             	add    $0x18,%esp
+  801d35:	52                   	push   %edx
+  801d36:	50                   	push   %eax
+  801d37:	89 f2                	mov    %esi,%edx
+  801d39:	89 f8                	mov    %edi,%eax
+  801d3b:	e8 9f ff ff ff       	call   801cdf <printnum>
+  801d40:	83 c4 20             	add    $0x20,%esp
+  801d43:	eb 13                	jmp    801d58 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801d45:	83 ec 08             	sub    $0x8,%esp
+  801d48:	56                   	push   %esi
+  801d49:	ff 75 18             	push   0x18(%ebp)
+  801d4c:	ff d7                	call   *%edi
+  801d4e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801d51:	83 eb 01             	sub    $0x1,%ebx
+  801d54:	85 db                	test   %ebx,%ebx
+  801d56:	7f ed                	jg     801d45 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801d58:	83 ec 08             	sub    $0x8,%esp
+  801d5b:	56                   	push   %esi
+  801d5c:	83 ec 04             	sub    $0x4,%esp
+  801d5f:	ff 75 e4             	push   -0x1c(%ebp)
+  801d62:	ff 75 e0             	push   -0x20(%ebp)
+  801d65:	ff 75 dc             	push   -0x24(%ebp)
+  801d68:	ff 75 d8             	push   -0x28(%ebp)
+  801d6b:	e8 b4 08 00 00       	call   802624 <__umoddi3>
+  801d70:	83 c4 14             	add    $0x14,%esp
+  801d73:	0f be 80 8b 28 80 00 	movsbl 0x80288b(%eax),%eax
+  801d7a:	50                   	push   %eax
+  801d7b:	ff d7                	call   *%edi
+}
+  801d7d:	83 c4 10             	add    $0x10,%esp
+  801d80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d83:	5b                   	pop    %ebx
+  801d84:	5e                   	pop    %esi
+  801d85:	5f                   	pop    %edi
+  801d86:	5d                   	pop    %ebp
+  801d87:	c3                   	ret
+
+00801d88 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801d88:	55                   	push   %ebp
+  801d89:	89 e5                	mov    %esp,%ebp
+  801d8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801d8e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801d92:	8b 10                	mov    (%eax),%edx
+  801d94:	3b 50 04             	cmp    0x4(%eax),%edx
+  801d97:	73 0a                	jae    801da3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801d99:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801d9c:	89 08                	mov    %ecx,(%eax)
+  801d9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da1:	88 02                	mov    %al,(%edx)
+}
+  801da3:	5d                   	pop    %ebp
+  801da4:	c3                   	ret
+
+00801da5 <printfmt>:
+{
+  801da5:	55                   	push   %ebp
+  801da6:	89 e5                	mov    %esp,%ebp
+  801da8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801dab:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801dae:	50                   	push   %eax
+  801daf:	ff 75 10             	push   0x10(%ebp)
+  801db2:	ff 75 0c             	push   0xc(%ebp)
+  801db5:	ff 75 08             	push   0x8(%ebp)
+  801db8:	e8 05 00 00 00       	call   801dc2 <vprintfmt>
+}
+  801dbd:	83 c4 10             	add    $0x10,%esp
+  801dc0:	c9                   	leave
+  801dc1:	c3                   	ret
+
+00801dc2 <vprintfmt>:
+{
+  801dc2:	55                   	push   %ebp
+  801dc3:	89 e5                	mov    %esp,%ebp
+  801dc5:	57                   	push   %edi
+  801dc6:	56                   	push   %esi
+  801dc7:	53                   	push   %ebx
+  801dc8:	83 ec 2c             	sub    $0x2c,%esp
+  801dcb:	8b 75 08             	mov    0x8(%ebp),%esi
+  801dce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801dd1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801dd4:	eb 0a                	jmp    801de0 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801dd6:	83 ec 08             	sub    $0x8,%esp
+  801dd9:	53                   	push   %ebx
+  801dda:	50                   	push   %eax
+  801ddb:	ff d6                	call   *%esi
+  801ddd:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801de0:	83 c7 01             	add    $0x1,%edi
+  801de3:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801de7:	83 f8 25             	cmp    $0x25,%eax
+  801dea:	74 0c                	je     801df8 <vprintfmt+0x36>
+			if (ch == '\0')
+  801dec:	85 c0                	test   %eax,%eax
+  801dee:	75 e6                	jne    801dd6 <vprintfmt+0x14>
+}
+  801df0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801df3:	5b                   	pop    %ebx
+  801df4:	5e                   	pop    %esi
+  801df5:	5f                   	pop    %edi
+  801df6:	5d                   	pop    %ebp
+  801df7:	c3                   	ret
+		padc = ' ';
+  801df8:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801dfc:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801e03:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801e0a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801e11:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801e16:	8d 47 01             	lea    0x1(%edi),%eax
+  801e19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e1c:	0f b6 17             	movzbl (%edi),%edx
+  801e1f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801e22:	3c 55                	cmp    $0x55,%al
+  801e24:	0f 87 c5 03 00 00    	ja     8021ef <vprintfmt+0x42d>
+  801e2a:	0f b6 c0             	movzbl %al,%eax
+  801e2d:	ff 24 85 20 2a 80 00 	jmp    *0x802a20(,%eax,4)
+  801e34:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801e37:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801e3b:	eb d9                	jmp    801e16 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801e3d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801e40:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801e44:	eb d0                	jmp    801e16 <vprintfmt+0x54>
+  801e46:	0f b6 d2             	movzbl %dl,%edx
+  801e49:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801e4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e51:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801e54:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801e57:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801e5b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801e5e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801e61:	83 f9 09             	cmp    $0x9,%ecx
+  801e64:	77 55                	ja     801ebb <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801e66:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801e69:	eb e9                	jmp    801e54 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801e6b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e6e:	8b 00                	mov    (%eax),%eax
+  801e70:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e73:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e76:	8d 40 04             	lea    0x4(%eax),%eax
+  801e79:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e7c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801e7f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801e83:	79 91                	jns    801e16 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  801e85:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801e88:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801e8b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  801e92:	eb 82                	jmp    801e16 <vprintfmt+0x54>
+			if (width < 0)
+  801e94:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801e97:	85 d2                	test   %edx,%edx
+  801e99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e9e:	0f 49 c2             	cmovns %edx,%eax
+  801ea1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801ea4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801ea7:	e9 6a ff ff ff       	jmp    801e16 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801eac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801eaf:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801eb6:	e9 5b ff ff ff       	jmp    801e16 <vprintfmt+0x54>
+  801ebb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801ebe:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801ec1:	eb bc                	jmp    801e7f <vprintfmt+0xbd>
+			lflag++;
+  801ec3:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801ec6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801ec9:	e9 48 ff ff ff       	jmp    801e16 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801ece:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ed1:	8d 78 04             	lea    0x4(%eax),%edi
+  801ed4:	83 ec 08             	sub    $0x8,%esp
+  801ed7:	53                   	push   %ebx
+  801ed8:	ff 30                	push   (%eax)
+  801eda:	ff d6                	call   *%esi
+			break;
+  801edc:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801edf:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801ee2:	e9 63 02 00 00       	jmp    80214a <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  801ee7:	8b 45 14             	mov    0x14(%ebp),%eax
+  801eea:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801eed:	8b 10                	mov    (%eax),%edx
+  801eef:	89 d0                	mov    %edx,%eax
+  801ef1:	f7 d8                	neg    %eax
+  801ef3:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801ef6:	83 f8 12             	cmp    $0x12,%eax
+  801ef9:	7f 23                	jg     801f1e <vprintfmt+0x15c>
+  801efb:	8b 14 85 80 2b 80 00 	mov    0x802b80(,%eax,4),%edx
+  801f02:	85 d2                	test   %edx,%edx
+  801f04:	74 18                	je     801f1e <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801f06:	52                   	push   %edx
+  801f07:	68 21 28 80 00       	push   $0x802821
+  801f0c:	53                   	push   %ebx
+  801f0d:	56                   	push   %esi
+  801f0e:	e8 92 fe ff ff       	call   801da5 <printfmt>
+  801f13:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801f16:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801f19:	e9 2c 02 00 00       	jmp    80214a <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  801f1e:	50                   	push   %eax
+  801f1f:	68 a3 28 80 00       	push   $0x8028a3
+  801f24:	53                   	push   %ebx
+  801f25:	56                   	push   %esi
+  801f26:	e8 7a fe ff ff       	call   801da5 <printfmt>
+  801f2b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801f2e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801f31:	e9 14 02 00 00       	jmp    80214a <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801f36:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f39:	83 c0 04             	add    $0x4,%eax
+  801f3c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801f3f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f42:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801f44:	85 c9                	test   %ecx,%ecx
+  801f46:	b8 9c 28 80 00       	mov    $0x80289c,%eax
+  801f4b:	0f 45 c1             	cmovne %ecx,%eax
+  801f4e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801f51:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801f55:	7e 06                	jle    801f5d <vprintfmt+0x19b>
+  801f57:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801f5b:	75 0b                	jne    801f68 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f5d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801f60:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801f63:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f66:	eb 5c                	jmp    801fc4 <vprintfmt+0x202>
+  801f68:	83 ec 08             	sub    $0x8,%esp
+  801f6b:	ff 75 d0             	push   -0x30(%ebp)
+  801f6e:	ff 75 cc             	push   -0x34(%ebp)
+  801f71:	e8 e9 e1 ff ff       	call   80015f <strnlen>
+  801f76:	89 c2                	mov    %eax,%edx
+  801f78:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f7b:	29 d0                	sub    %edx,%eax
+  801f7d:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801f80:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801f84:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f87:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f8a:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f8c:	eb 0e                	jmp    801f9c <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801f8e:	83 ec 08             	sub    $0x8,%esp
+  801f91:	53                   	push   %ebx
+  801f92:	57                   	push   %edi
+  801f93:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f96:	83 ee 01             	sub    $0x1,%esi
+  801f99:	83 c4 10             	add    $0x10,%esp
+  801f9c:	85 f6                	test   %esi,%esi
+  801f9e:	7f ee                	jg     801f8e <vprintfmt+0x1cc>
+  801fa0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801fa3:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fa6:	85 c0                	test   %eax,%eax
+  801fa8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fad:	0f 49 d0             	cmovns %eax,%edx
+  801fb0:	29 d0                	sub    %edx,%eax
+  801fb2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801fb5:	eb a6                	jmp    801f5d <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801fb7:	83 ec 08             	sub    $0x8,%esp
+  801fba:	53                   	push   %ebx
+  801fbb:	52                   	push   %edx
+  801fbc:	ff 55 08             	call   *0x8(%ebp)
+  801fbf:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801fc2:	89 f1                	mov    %esi,%ecx
+  801fc4:	8d 71 01             	lea    0x1(%ecx),%esi
+  801fc7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801fcb:	0f be d0             	movsbl %al,%edx
+  801fce:	85 d2                	test   %edx,%edx
+  801fd0:	74 28                	je     801ffa <vprintfmt+0x238>
+  801fd2:	85 ff                	test   %edi,%edi
+  801fd4:	78 05                	js     801fdb <vprintfmt+0x219>
+  801fd6:	83 ef 01             	sub    $0x1,%edi
+  801fd9:	78 30                	js     80200b <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801fdb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801fdf:	74 d6                	je     801fb7 <vprintfmt+0x1f5>
+  801fe1:	0f be c0             	movsbl %al,%eax
+  801fe4:	83 e8 20             	sub    $0x20,%eax
+  801fe7:	83 f8 5e             	cmp    $0x5e,%eax
+  801fea:	76 cb                	jbe    801fb7 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801fec:	83 ec 08             	sub    $0x8,%esp
+  801fef:	53                   	push   %ebx
+  801ff0:	6a 3f                	push   $0x3f
+  801ff2:	ff 55 08             	call   *0x8(%ebp)
+  801ff5:	83 c4 10             	add    $0x10,%esp
+  801ff8:	eb c8                	jmp    801fc2 <vprintfmt+0x200>
+  801ffa:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ffd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802000:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802003:	01 d0                	add    %edx,%eax
+  802005:	29 c8                	sub    %ecx,%eax
+  802007:	89 c7                	mov    %eax,%edi
+  802009:	eb 13                	jmp    80201e <vprintfmt+0x25c>
+  80200b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80200e:	eb ed                	jmp    801ffd <vprintfmt+0x23b>
+				putch(' ', putdat);
+  802010:	83 ec 08             	sub    $0x8,%esp
+  802013:	53                   	push   %ebx
+  802014:	6a 20                	push   $0x20
+  802016:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  802018:	83 ef 01             	sub    $0x1,%edi
+  80201b:	83 c4 10             	add    $0x10,%esp
+  80201e:	85 ff                	test   %edi,%edi
+  802020:	7f ee                	jg     802010 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802022:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  802025:	89 45 14             	mov    %eax,0x14(%ebp)
+  802028:	e9 1d 01 00 00       	jmp    80214a <vprintfmt+0x388>
+	if (lflag >= 2)
+  80202d:	83 f9 01             	cmp    $0x1,%ecx
+  802030:	7f 1b                	jg     80204d <vprintfmt+0x28b>
+	else if (lflag)
+  802032:	85 c9                	test   %ecx,%ecx
+  802034:	74 63                	je     802099 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  802036:	8b 45 14             	mov    0x14(%ebp),%eax
+  802039:	8b 00                	mov    (%eax),%eax
+  80203b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80203e:	99                   	cltd
+  80203f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802042:	8b 45 14             	mov    0x14(%ebp),%eax
+  802045:	8d 40 04             	lea    0x4(%eax),%eax
+  802048:	89 45 14             	mov    %eax,0x14(%ebp)
+  80204b:	eb 17                	jmp    802064 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80204d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802050:	8b 50 04             	mov    0x4(%eax),%edx
+  802053:	8b 00                	mov    (%eax),%eax
+  802055:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802058:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80205b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80205e:	8d 40 08             	lea    0x8(%eax),%eax
+  802061:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  802064:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802067:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80206a:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80206f:	85 c9                	test   %ecx,%ecx
+  802071:	0f 89 b9 00 00 00    	jns    802130 <vprintfmt+0x36e>
+				putch('-', putdat);
+  802077:	83 ec 08             	sub    $0x8,%esp
+  80207a:	53                   	push   %ebx
+  80207b:	6a 2d                	push   $0x2d
+  80207d:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80207f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802082:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802085:	f7 da                	neg    %edx
+  802087:	83 d1 00             	adc    $0x0,%ecx
+  80208a:	f7 d9                	neg    %ecx
+  80208c:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80208f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802094:	e9 97 00 00 00       	jmp    802130 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  802099:	8b 45 14             	mov    0x14(%ebp),%eax
+  80209c:	8b 00                	mov    (%eax),%eax
+  80209e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8020a1:	99                   	cltd
+  8020a2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8020a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8020ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8020ae:	eb b4                	jmp    802064 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8020b0:	83 f9 01             	cmp    $0x1,%ecx
+  8020b3:	7f 1b                	jg     8020d0 <vprintfmt+0x30e>
+	else if (lflag)
+  8020b5:	85 c9                	test   %ecx,%ecx
+  8020b7:	74 2c                	je     8020e5 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8020b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020bc:	8b 10                	mov    (%eax),%edx
+  8020be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8020c6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020c9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8020ce:	eb 60                	jmp    802130 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8020d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020d3:	8b 10                	mov    (%eax),%edx
+  8020d5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8020d8:	8d 40 08             	lea    0x8(%eax),%eax
+  8020db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020de:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8020e3:	eb 4b                	jmp    802130 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8020e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020e8:	8b 10                	mov    (%eax),%edx
+  8020ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8020f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020f5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8020fa:	eb 34                	jmp    802130 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8020fc:	83 f9 01             	cmp    $0x1,%ecx
+  8020ff:	7f 15                	jg     802116 <vprintfmt+0x354>
+	else if (lflag)
+  802101:	85 c9                	test   %ecx,%ecx
+  802103:	74 4d                	je     802152 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  802105:	8b 45 14             	mov    0x14(%ebp),%eax
+  802108:	8b 00                	mov    (%eax),%eax
+  80210a:	99                   	cltd
+  80210b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80210e:	8d 49 04             	lea    0x4(%ecx),%ecx
+  802111:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  802114:	eb 11                	jmp    802127 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  802116:	8b 45 14             	mov    0x14(%ebp),%eax
+  802119:	8b 50 04             	mov    0x4(%eax),%edx
+  80211c:	8b 00                	mov    (%eax),%eax
+  80211e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802121:	8d 49 08             	lea    0x8(%ecx),%ecx
+  802124:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  802127:	89 d1                	mov    %edx,%ecx
+  802129:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  80212b:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802130:	83 ec 0c             	sub    $0xc,%esp
+  802133:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802137:	50                   	push   %eax
+  802138:	ff 75 e0             	push   -0x20(%ebp)
+  80213b:	57                   	push   %edi
+  80213c:	51                   	push   %ecx
+  80213d:	52                   	push   %edx
+  80213e:	89 da                	mov    %ebx,%edx
+  802140:	89 f0                	mov    %esi,%eax
+  802142:	e8 98 fb ff ff       	call   801cdf <printnum>
+			break;
+  802147:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80214a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80214d:	e9 8e fc ff ff       	jmp    801de0 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  802152:	8b 45 14             	mov    0x14(%ebp),%eax
+  802155:	8b 00                	mov    (%eax),%eax
+  802157:	99                   	cltd
+  802158:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80215b:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80215e:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  802161:	eb c4                	jmp    802127 <vprintfmt+0x365>
+			putch('0', putdat);
+  802163:	83 ec 08             	sub    $0x8,%esp
+  802166:	53                   	push   %ebx
+  802167:	6a 30                	push   $0x30
+  802169:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80216b:	83 c4 08             	add    $0x8,%esp
+  80216e:	53                   	push   %ebx
+  80216f:	6a 78                	push   $0x78
+  802171:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  802173:	8b 45 14             	mov    0x14(%ebp),%eax
+  802176:	8b 10                	mov    (%eax),%edx
+  802178:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80217d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802180:	8d 40 04             	lea    0x4(%eax),%eax
+  802183:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802186:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  80218b:	eb a3                	jmp    802130 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80218d:	83 f9 01             	cmp    $0x1,%ecx
+  802190:	7f 1b                	jg     8021ad <vprintfmt+0x3eb>
+	else if (lflag)
+  802192:	85 c9                	test   %ecx,%ecx
+  802194:	74 2f                	je     8021c5 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  802196:	8b 45 14             	mov    0x14(%ebp),%eax
+  802199:	8b 10                	mov    (%eax),%edx
+  80219b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8021a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8021a6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8021ab:	eb 83                	jmp    802130 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8021ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021b0:	8b 10                	mov    (%eax),%edx
+  8021b2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8021b5:	8d 40 08             	lea    0x8(%eax),%eax
+  8021b8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8021bb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8021c0:	e9 6b ff ff ff       	jmp    802130 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8021c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021c8:	8b 10                	mov    (%eax),%edx
+  8021ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8021d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8021d5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8021da:	e9 51 ff ff ff       	jmp    802130 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8021df:	83 ec 08             	sub    $0x8,%esp
+  8021e2:	53                   	push   %ebx
+  8021e3:	6a 25                	push   $0x25
+  8021e5:	ff d6                	call   *%esi
+			break;
+  8021e7:	83 c4 10             	add    $0x10,%esp
+  8021ea:	e9 5b ff ff ff       	jmp    80214a <vprintfmt+0x388>
+			putch('%', putdat);
+  8021ef:	83 ec 08             	sub    $0x8,%esp
+  8021f2:	53                   	push   %ebx
+  8021f3:	6a 25                	push   $0x25
+  8021f5:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8021f7:	83 c4 10             	add    $0x10,%esp
+  8021fa:	89 f8                	mov    %edi,%eax
+  8021fc:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802200:	74 05                	je     802207 <vprintfmt+0x445>
+  802202:	83 e8 01             	sub    $0x1,%eax
+  802205:	eb f5                	jmp    8021fc <vprintfmt+0x43a>
+  802207:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80220a:	e9 3b ff ff ff       	jmp    80214a <vprintfmt+0x388>
+
+0080220f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80220f:	55                   	push   %ebp
+  802210:	89 e5                	mov    %esp,%ebp
+  802212:	83 ec 18             	sub    $0x18,%esp
+  802215:	8b 45 08             	mov    0x8(%ebp),%eax
+  802218:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80221b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80221e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802222:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802225:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80222c:	85 c0                	test   %eax,%eax
+  80222e:	74 26                	je     802256 <vsnprintf+0x47>
+  802230:	85 d2                	test   %edx,%edx
+  802232:	7e 22                	jle    802256 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  802234:	ff 75 14             	push   0x14(%ebp)
+  802237:	ff 75 10             	push   0x10(%ebp)
+  80223a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80223d:	50                   	push   %eax
+  80223e:	68 88 1d 80 00       	push   $0x801d88
+  802243:	e8 7a fb ff ff       	call   801dc2 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802248:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80224b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80224e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802251:	83 c4 10             	add    $0x10,%esp
+}
+  802254:	c9                   	leave
+  802255:	c3                   	ret
+		return -E_INVAL;
+  802256:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80225b:	eb f7                	jmp    802254 <vsnprintf+0x45>
+
+0080225d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80225d:	55                   	push   %ebp
+  80225e:	89 e5                	mov    %esp,%ebp
+  802260:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  802263:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802266:	50                   	push   %eax
+  802267:	ff 75 10             	push   0x10(%ebp)
+  80226a:	ff 75 0c             	push   0xc(%ebp)
+  80226d:	ff 75 08             	push   0x8(%ebp)
+  802270:	e8 9a ff ff ff       	call   80220f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802275:	c9                   	leave
+  802276:	c3                   	ret
+
+00802277 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  802277:	55                   	push   %ebp
+  802278:	89 e5                	mov    %esp,%ebp
+  80227a:	57                   	push   %edi
+  80227b:	56                   	push   %esi
+  80227c:	53                   	push   %ebx
+  80227d:	83 ec 14             	sub    $0x14,%esp
+  802280:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802283:	8b 75 14             	mov    0x14(%ebp),%esi
+  802286:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  802289:	ff 75 10             	push   0x10(%ebp)
+  80228c:	ff 75 0c             	push   0xc(%ebp)
+  80228f:	e8 04 e8 ff ff       	call   800a98 <sys_ipc_recv_pages>
+  802294:	83 c4 10             	add    $0x10,%esp
+  802297:	85 c0                	test   %eax,%eax
+  802299:	78 46                	js     8022e1 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80229b:	85 ff                	test   %edi,%edi
+  80229d:	74 0d                	je     8022ac <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  80229f:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022a4:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8022aa:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8022ac:	85 f6                	test   %esi,%esi
+  8022ae:	74 0d                	je     8022bd <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  8022b0:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022b5:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8022bb:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8022bd:	85 db                	test   %ebx,%ebx
+  8022bf:	74 0d                	je     8022ce <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  8022c1:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022c6:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8022cc:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8022ce:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022d3:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8022d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022dc:	5b                   	pop    %ebx
+  8022dd:	5e                   	pop    %esi
+  8022de:	5f                   	pop    %edi
+  8022df:	5d                   	pop    %ebp
+  8022e0:	c3                   	ret
+		if (from_env_store) {
+  8022e1:	85 ff                	test   %edi,%edi
+  8022e3:	74 06                	je     8022eb <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  8022e5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8022eb:	85 f6                	test   %esi,%esi
+  8022ed:	74 06                	je     8022f5 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  8022ef:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8022f5:	85 db                	test   %ebx,%ebx
+  8022f7:	74 e0                	je     8022d9 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8022f9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8022ff:	eb d8                	jmp    8022d9 <ipc_recv_pages+0x62>
+
+00802301 <ipc_recv>:
+{
+  802301:	55                   	push   %ebp
+  802302:	89 e5                	mov    %esp,%ebp
+  802304:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  802307:	6a 00                	push   $0x0
+  802309:	ff 75 10             	push   0x10(%ebp)
+  80230c:	6a 01                	push   $0x1
+  80230e:	ff 75 0c             	push   0xc(%ebp)
+  802311:	ff 75 08             	push   0x8(%ebp)
+  802314:	e8 5e ff ff ff       	call   802277 <ipc_recv_pages>
+}
+  802319:	c9                   	leave
+  80231a:	c3                   	ret
+
+0080231b <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80231b:	55                   	push   %ebp
+  80231c:	89 e5                	mov    %esp,%ebp
+  80231e:	56                   	push   %esi
+  80231f:	53                   	push   %ebx
+  802320:	8b 75 08             	mov    0x8(%ebp),%esi
+  802323:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  802326:	83 ec 0c             	sub    $0xc,%esp
+  802329:	ff 75 0c             	push   0xc(%ebp)
+  80232c:	e8 9b e8 ff ff       	call   800bcc <sys_ipc_try_recv>
+  802331:	83 c4 10             	add    $0x10,%esp
+  802334:	85 c0                	test   %eax,%eax
+  802336:	78 34                	js     80236c <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802338:	85 f6                	test   %esi,%esi
+  80233a:	74 0d                	je     802349 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  80233c:	a1 08 40 80 00       	mov    0x804008,%eax
+  802341:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802347:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  802349:	85 db                	test   %ebx,%ebx
+  80234b:	74 0d                	je     80235a <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  80234d:	a1 08 40 80 00       	mov    0x804008,%eax
+  802352:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802358:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80235a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80235f:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802365:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802368:	5b                   	pop    %ebx
+  802369:	5e                   	pop    %esi
+  80236a:	5d                   	pop    %ebp
+  80236b:	c3                   	ret
+		if (from_env_store) {
+  80236c:	85 f6                	test   %esi,%esi
+  80236e:	74 06                	je     802376 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  802370:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  802376:	85 db                	test   %ebx,%ebx
+  802378:	74 eb                	je     802365 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  80237a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802380:	eb e3                	jmp    802365 <ipc_try_recv+0x4a>
+
+00802382 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802382:	55                   	push   %ebp
+  802383:	89 e5                	mov    %esp,%ebp
+  802385:	83 ec 14             	sub    $0x14,%esp
+  802388:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80238b:	85 c0                	test   %eax,%eax
+  80238d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802392:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802395:	ff 75 18             	push   0x18(%ebp)
+  802398:	ff 75 14             	push   0x14(%ebp)
+  80239b:	50                   	push   %eax
+  80239c:	ff 75 0c             	push   0xc(%ebp)
+  80239f:	ff 75 08             	push   0x8(%ebp)
+  8023a2:	e8 b4 e6 ff ff       	call   800a5b <sys_ipc_send_pages>
+  8023a7:	83 c4 20             	add    $0x20,%esp
+  8023aa:	85 c0                	test   %eax,%eax
+  8023ac:	78 02                	js     8023b0 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  8023ae:	c9                   	leave
+  8023af:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  8023b0:	50                   	push   %eax
+  8023b1:	68 ec 2b 80 00       	push   $0x802bec
+  8023b6:	68 80 00 00 00       	push   $0x80
+  8023bb:	68 18 2c 80 00       	push   $0x802c18
+  8023c0:	e8 2b f8 ff ff       	call   801bf0 <_panic>
+
+008023c5 <ipc_send>:
+{
+  8023c5:	55                   	push   %ebp
+  8023c6:	89 e5                	mov    %esp,%ebp
+  8023c8:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  8023cb:	ff 75 14             	push   0x14(%ebp)
+  8023ce:	6a 01                	push   $0x1
+  8023d0:	ff 75 10             	push   0x10(%ebp)
+  8023d3:	ff 75 0c             	push   0xc(%ebp)
+  8023d6:	ff 75 08             	push   0x8(%ebp)
+  8023d9:	e8 a4 ff ff ff       	call   802382 <ipc_send_pages>
+}
+  8023de:	83 c4 20             	add    $0x20,%esp
+  8023e1:	c9                   	leave
+  8023e2:	c3                   	ret
+
+008023e3 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8023e3:	55                   	push   %ebp
+  8023e4:	89 e5                	mov    %esp,%ebp
+  8023e6:	83 ec 14             	sub    $0x14,%esp
+  8023e9:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8023ec:	85 c0                	test   %eax,%eax
+  8023ee:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8023f3:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8023f6:	ff 75 18             	push   0x18(%ebp)
+  8023f9:	ff 75 14             	push   0x14(%ebp)
+  8023fc:	50                   	push   %eax
+  8023fd:	ff 75 0c             	push   0xc(%ebp)
+  802400:	ff 75 08             	push   0x8(%ebp)
+  802403:	e8 e4 e6 ff ff       	call   800aec <sys_ipc_call>
+  802408:	83 c4 20             	add    $0x20,%esp
+  80240b:	85 c0                	test   %eax,%eax
+  80240d:	78 0b                	js     80241a <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  80240f:	a1 08 40 80 00       	mov    0x804008,%eax
+  802414:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80241a:	c9                   	leave
+  80241b:	c3                   	ret
+
+0080241c <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  80241c:	55                   	push   %ebp
+  80241d:	89 e5                	mov    %esp,%ebp
+  80241f:	57                   	push   %edi
+  802420:	56                   	push   %esi
+  802421:	53                   	push   %ebx
+  802422:	83 ec 18             	sub    $0x18,%esp
+  802425:	8b 45 10             	mov    0x10(%ebp),%eax
+  802428:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  80242b:	8b 75 20             	mov    0x20(%ebp),%esi
+  80242e:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802431:	85 c0                	test   %eax,%eax
+  802433:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802438:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80243b:	ff 75 18             	push   0x18(%ebp)
+  80243e:	ff 75 14             	push   0x14(%ebp)
+  802441:	50                   	push   %eax
+  802442:	ff 75 0c             	push   0xc(%ebp)
+  802445:	ff 75 08             	push   0x8(%ebp)
+  802448:	e8 e0 e6 ff ff       	call   800b2d <sys_ipc_reply_recv>
+  80244d:	83 c4 20             	add    $0x20,%esp
+  802450:	85 c0                	test   %eax,%eax
+  802452:	78 46                	js     80249a <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802454:	85 ff                	test   %edi,%edi
+  802456:	74 0d                	je     802465 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  802458:	a1 08 40 80 00       	mov    0x804008,%eax
+  80245d:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802463:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802465:	85 f6                	test   %esi,%esi
+  802467:	74 0d                	je     802476 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  802469:	a1 08 40 80 00       	mov    0x804008,%eax
+  80246e:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802474:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802476:	85 db                	test   %ebx,%ebx
+  802478:	74 0d                	je     802487 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  80247a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80247f:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802485:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802487:	a1 08 40 80 00       	mov    0x804008,%eax
+  80248c:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802492:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802495:	5b                   	pop    %ebx
+  802496:	5e                   	pop    %esi
+  802497:	5f                   	pop    %edi
+  802498:	5d                   	pop    %ebp
+  802499:	c3                   	ret
+		if (from_env_store) {
+  80249a:	85 ff                	test   %edi,%edi
+  80249c:	74 06                	je     8024a4 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  80249e:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8024a4:	85 f6                	test   %esi,%esi
+  8024a6:	74 06                	je     8024ae <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  8024a8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8024ae:	85 db                	test   %ebx,%ebx
+  8024b0:	74 e0                	je     802492 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  8024b2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8024b8:	eb d8                	jmp    802492 <ipc_reply_recv+0x76>
+
+008024ba <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8024ba:	55                   	push   %ebp
+  8024bb:	89 e5                	mov    %esp,%ebp
+  8024bd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8024c0:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8024c5:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8024c8:	c1 e0 06             	shl    $0x6,%eax
+  8024cb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8024d0:	8b 40 50             	mov    0x50(%eax),%eax
+  8024d3:	39 c8                	cmp    %ecx,%eax
+  8024d5:	74 12                	je     8024e9 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8024d7:	83 c2 01             	add    $0x1,%edx
+  8024da:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8024e0:	75 e3                	jne    8024c5 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8024e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e7:	eb 0e                	jmp    8024f7 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8024e9:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8024ec:	c1 e0 06             	shl    $0x6,%eax
+  8024ef:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8024f4:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8024f7:	5d                   	pop    %ebp
+  8024f8:	c3                   	ret
+
+008024f9 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8024f9:	55                   	push   %ebp
+  8024fa:	89 e5                	mov    %esp,%ebp
+  8024fc:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8024ff:	89 c2                	mov    %eax,%edx
+  802501:	c1 ea 16             	shr    $0x16,%edx
+  802504:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80250b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802510:	f6 c1 01             	test   $0x1,%cl
+  802513:	74 1e                	je     802533 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  802515:	c1 e8 0c             	shr    $0xc,%eax
+  802518:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80251f:	a8 01                	test   $0x1,%al
+  802521:	74 10                	je     802533 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802523:	c1 e8 0c             	shr    $0xc,%eax
+  802526:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802529:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  802530:	0f b7 d2             	movzwl %dx,%edx
+}
+  802533:	89 d0                	mov    %edx,%eax
+  802535:	5d                   	pop    %ebp
+  802536:	c3                   	ret
+
+00802537 <udivmod>:
+  802537:	55                   	push   %ebp
+  802538:	57                   	push   %edi
+  802539:	56                   	push   %esi
+  80253a:	53                   	push   %ebx
+  80253b:	83 ec 24             	sub    $0x24,%esp
+  80253e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802542:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802546:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80254a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80254e:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802552:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802556:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80255a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80255f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802564:	ba 00 00 00 00       	mov    $0x0,%edx
+  802569:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802570:	00 
+  802571:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802578:	00 
+  802579:	89 fb                	mov    %edi,%ebx
+  80257b:	eb 08                	jmp    802585 <udivmod+0x4e>
+  80257d:	83 e9 01             	sub    $0x1,%ecx
+  802580:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802583:	74 68                	je     8025ed <udivmod+0xb6>
+  802585:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802589:	01 c0                	add    %eax,%eax
+  80258b:	89 c6                	mov    %eax,%esi
+  80258d:	89 d7                	mov    %edx,%edi
+  80258f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802593:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802597:	0f ad d0             	shrd   %cl,%edx,%eax
+  80259a:	d3 ea                	shr    %cl,%edx
+  80259c:	f6 c1 20             	test   $0x20,%cl
+  80259f:	74 04                	je     8025a5 <udivmod+0x6e>
+  8025a1:	89 d0                	mov    %edx,%eax
+  8025a3:	31 d2                	xor    %edx,%edx
+  8025a5:	83 e0 01             	and    $0x1,%eax
+  8025a8:	89 04 24             	mov    %eax,(%esp)
+  8025ab:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8025b2:	00 
+  8025b3:	8b 04 24             	mov    (%esp),%eax
+  8025b6:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8025ba:	09 f0                	or     %esi,%eax
+  8025bc:	09 fa                	or     %edi,%edx
+  8025be:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8025c2:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8025c6:	39 f0                	cmp    %esi,%eax
+  8025c8:	89 d5                	mov    %edx,%ebp
+  8025ca:	19 fd                	sbb    %edi,%ebp
+  8025cc:	72 af                	jb     80257d <udivmod+0x46>
+  8025ce:	29 f0                	sub    %esi,%eax
+  8025d0:	19 fa                	sbb    %edi,%edx
+  8025d2:	89 cf                	mov    %ecx,%edi
+  8025d4:	c1 ef 05             	shr    $0x5,%edi
+  8025d7:	83 e7 01             	and    $0x1,%edi
+  8025da:	89 fe                	mov    %edi,%esi
+  8025dc:	83 f6 01             	xor    $0x1,%esi
+  8025df:	d3 e6                	shl    %cl,%esi
+  8025e1:	d3 e7                	shl    %cl,%edi
+  8025e3:	09 74 24 18          	or     %esi,0x18(%esp)
+  8025e7:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8025eb:	eb 90                	jmp    80257d <udivmod+0x46>
+  8025ed:	85 db                	test   %ebx,%ebx
+  8025ef:	74 05                	je     8025f6 <udivmod+0xbf>
+  8025f1:	89 03                	mov    %eax,(%ebx)
+  8025f3:	89 53 04             	mov    %edx,0x4(%ebx)
+  8025f6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025fa:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025fe:	83 c4 24             	add    $0x24,%esp
+  802601:	5b                   	pop    %ebx
+  802602:	5e                   	pop    %esi
+  802603:	5f                   	pop    %edi
+  802604:	5d                   	pop    %ebp
+  802605:	c3                   	ret
+
+00802606 <__udivdi3>:
+  802606:	83 ec 08             	sub    $0x8,%esp
+  802609:	6a 00                	push   $0x0
+  80260b:	ff 74 24 1c          	push   0x1c(%esp)
+  80260f:	ff 74 24 1c          	push   0x1c(%esp)
+  802613:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802617:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80261b:	e8 17 ff ff ff       	call   802537 <udivmod>
+  802620:	83 c4 14             	add    $0x14,%esp
+  802623:	c3                   	ret
+
+00802624 <__umoddi3>:
+  802624:	83 ec 18             	sub    $0x18,%esp
+  802627:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80262b:	50                   	push   %eax
+  80262c:	ff 74 24 2c          	push   0x2c(%esp)
+  802630:	ff 74 24 2c          	push   0x2c(%esp)
+  802634:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802638:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80263c:	e8 f6 fe ff ff       	call   802537 <udivmod>
+  802641:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802645:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802649:	83 c4 24             	add    $0x24,%esp
+  80264c:	c3                   	ret
+
+0080264d <__divdi3>:
+  80264d:	55                   	push   %ebp
+  80264e:	57                   	push   %edi
+  80264f:	56                   	push   %esi
+  802650:	53                   	push   %ebx
+  802651:	83 ec 10             	sub    $0x10,%esp
+  802654:	8b 44 24 24          	mov    0x24(%esp),%eax
+  802658:	8b 54 24 28          	mov    0x28(%esp),%edx
+  80265c:	89 c6                	mov    %eax,%esi
+  80265e:	89 d7                	mov    %edx,%edi
+  802660:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  802664:	33 7c 24 30          	xor    0x30(%esp),%edi
+  802668:	89 74 24 04          	mov    %esi,0x4(%esp)
+  80266c:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  802670:	89 c5                	mov    %eax,%ebp
+  802672:	f7 dd                	neg    %ebp
+  802674:	89 d6                	mov    %edx,%esi
+  802676:	83 d6 00             	adc    $0x0,%esi
+  802679:	f7 de                	neg    %esi
+  80267b:	0f 48 e8             	cmovs  %eax,%ebp
+  80267e:	0f 49 d6             	cmovns %esi,%edx
+  802681:	6a 00                	push   $0x0
+  802683:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802687:	f7 de                	neg    %esi
+  802689:	8b 44 24 34          	mov    0x34(%esp),%eax
+  80268d:	83 d0 00             	adc    $0x0,%eax
+  802690:	f7 d8                	neg    %eax
+  802692:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  802697:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  80269c:	50                   	push   %eax
+  80269d:	56                   	push   %esi
+  80269e:	89 e8                	mov    %ebp,%eax
+  8026a0:	e8 92 fe ff ff       	call   802537 <udivmod>
+  8026a5:	83 c4 10             	add    $0x10,%esp
+  8026a8:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  8026ad:	78 08                	js     8026b7 <__divdi3+0x6a>
+  8026af:	83 c4 0c             	add    $0xc,%esp
+  8026b2:	5b                   	pop    %ebx
+  8026b3:	5e                   	pop    %esi
+  8026b4:	5f                   	pop    %edi
+  8026b5:	5d                   	pop    %ebp
+  8026b6:	c3                   	ret
+  8026b7:	f7 d8                	neg    %eax
+  8026b9:	83 d2 00             	adc    $0x0,%edx
+  8026bc:	f7 da                	neg    %edx
+  8026be:	eb ef                	jmp    8026af <__divdi3+0x62>
+
+008026c0 <__moddi3>:
+  8026c0:	55                   	push   %ebp
+  8026c1:	57                   	push   %edi
+  8026c2:	56                   	push   %esi
+  8026c3:	53                   	push   %ebx
+  8026c4:	83 ec 18             	sub    $0x18,%esp
+  8026c7:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8026cb:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8026cf:	89 f1                	mov    %esi,%ecx
+  8026d1:	f7 d9                	neg    %ecx
+  8026d3:	89 da                	mov    %ebx,%edx
+  8026d5:	83 d2 00             	adc    $0x0,%edx
+  8026d8:	f7 da                	neg    %edx
+  8026da:	0f 48 ce             	cmovs  %esi,%ecx
+  8026dd:	0f 48 d3             	cmovs  %ebx,%edx
+  8026e0:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8026e4:	50                   	push   %eax
+  8026e5:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8026e9:	f7 de                	neg    %esi
+  8026eb:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8026ef:	83 d0 00             	adc    $0x0,%eax
+  8026f2:	f7 d8                	neg    %eax
+  8026f4:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8026f9:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8026fe:	50                   	push   %eax
+  8026ff:	56                   	push   %esi
+  802700:	89 c8                	mov    %ecx,%eax
+  802702:	e8 30 fe ff ff       	call   802537 <udivmod>
+  802707:	83 c4 10             	add    $0x10,%esp
+  80270a:	85 db                	test   %ebx,%ebx
+  80270c:	78 10                	js     80271e <__moddi3+0x5e>
+  80270e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802712:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802716:	83 c4 14             	add    $0x14,%esp
+  802719:	5b                   	pop    %ebx
+  80271a:	5e                   	pop    %esi
+  80271b:	5f                   	pop    %edi
+  80271c:	5d                   	pop    %ebp
+  80271d:	c3                   	ret
+  80271e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802722:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802726:	f7 d8                	neg    %eax
+  802728:	83 d2 00             	adc    $0x0,%edx
+  80272b:	f7 da                	neg    %edx
+  80272d:	eb e7                	jmp    802716 <__moddi3+0x56>
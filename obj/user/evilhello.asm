@@ -0,0 +1,5565 @@
+
+obj/user/evilhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 19 00 00 00       	call   80004a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	// try to print the kernel entry point as a string!  mua ha ha!
+	sys_cputs((char*)0xf010000c, 100);
+  800039:	6a 64                	push   $0x64
+  80003b:	68 0c 00 10 f0       	push   $0xf010000c
+  800040:	e8 8e 00 00 00       	call   8000d3 <sys_cputs>
+}
+  800045:	83 c4 10             	add    $0x10,%esp
+  800048:	c9                   	leave
+  800049:	c3                   	ret
+
+0080004a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004a:	55                   	push   %ebp
+  80004b:	89 e5                	mov    %esp,%ebp
+  80004d:	56                   	push   %esi
+  80004e:	53                   	push   %ebx
+  80004f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800052:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800055:	e8 08 01 00 00       	call   800162 <sys_getenvid>
+  80005a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80005f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800062:	c1 e0 06             	shl    $0x6,%eax
+  800065:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006a:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80006f:	85 db                	test   %ebx,%ebx
+  800071:	7e 07                	jle    80007a <libmain+0x30>
+		binaryname = argv[0];
+  800073:	8b 06                	mov    (%esi),%eax
+  800075:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80007a:	83 ec 08             	sub    $0x8,%esp
+  80007d:	56                   	push   %esi
+  80007e:	53                   	push   %ebx
+  80007f:	e8 af ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800084:	e8 0a 00 00 00       	call   800093 <exit>
+}
+  800089:	83 c4 10             	add    $0x10,%esp
+  80008c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008f:	5b                   	pop    %ebx
+  800090:	5e                   	pop    %esi
+  800091:	5d                   	pop    %ebp
+  800092:	c3                   	ret
+
+00800093 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800093:	55                   	push   %ebp
+  800094:	89 e5                	mov    %esp,%ebp
+  800096:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800099:	e8 68 08 00 00       	call   800906 <close_all>
+	sys_env_destroy(0);
+  80009e:	83 ec 0c             	sub    $0xc,%esp
+  8000a1:	6a 00                	push   $0x0
+  8000a3:	e8 79 00 00 00       	call   800121 <sys_env_destroy>
+}
+  8000a8:	83 c4 10             	add    $0x10,%esp
+  8000ab:	c9                   	leave
+  8000ac:	c3                   	ret
+
+008000ad <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  8000ad:	55                   	push   %ebp
+  8000ae:	89 e5                	mov    %esp,%ebp
+  8000b0:	83 ec 10             	sub    $0x10,%esp
+  8000b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000b6:	89 c8                	mov    %ecx,%eax
+  8000b8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8000bd:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8000c0:	eb 0b                	jmp    8000cd <touch_mem+0x20>
+		c = *(char *)page;
+  8000c2:	0f b6 10             	movzbl (%eax),%edx
+  8000c5:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000c8:	05 00 10 00 00       	add    $0x1000,%eax
+  8000cd:	39 c8                	cmp    %ecx,%eax
+  8000cf:	72 f1                	jb     8000c2 <touch_mem+0x15>
+}
+  8000d1:	c9                   	leave
+  8000d2:	c3                   	ret
+
+008000d3 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000d3:	55                   	push   %ebp
+  8000d4:	89 e5                	mov    %esp,%ebp
+  8000d6:	57                   	push   %edi
+  8000d7:	56                   	push   %esi
+  8000d8:	53                   	push   %ebx
+	touch_mem(s, len);
+  8000d9:	ff 75 0c             	push   0xc(%ebp)
+  8000dc:	ff 75 08             	push   0x8(%ebp)
+  8000df:	e8 c9 ff ff ff       	call   8000ad <touch_mem>
+	asm volatile("int %1\n"
+  8000e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000ef:	89 c3                	mov    %eax,%ebx
+  8000f1:	89 c7                	mov    %eax,%edi
+  8000f3:	89 c6                	mov    %eax,%esi
+  8000f5:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000f7:	83 c4 08             	add    $0x8,%esp
+  8000fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000fd:	5b                   	pop    %ebx
+  8000fe:	5e                   	pop    %esi
+  8000ff:	5f                   	pop    %edi
+  800100:	5d                   	pop    %ebp
+  800101:	c3                   	ret
+
+00800102 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800102:	55                   	push   %ebp
+  800103:	89 e5                	mov    %esp,%ebp
+  800105:	57                   	push   %edi
+  800106:	56                   	push   %esi
+  800107:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800108:	ba 00 00 00 00       	mov    $0x0,%edx
+  80010d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800112:	89 d1                	mov    %edx,%ecx
+  800114:	89 d3                	mov    %edx,%ebx
+  800116:	89 d7                	mov    %edx,%edi
+  800118:	89 d6                	mov    %edx,%esi
+  80011a:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80011c:	5b                   	pop    %ebx
+  80011d:	5e                   	pop    %esi
+  80011e:	5f                   	pop    %edi
+  80011f:	5d                   	pop    %ebp
+  800120:	c3                   	ret
+
+00800121 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800121:	55                   	push   %ebp
+  800122:	89 e5                	mov    %esp,%ebp
+  800124:	57                   	push   %edi
+  800125:	56                   	push   %esi
+  800126:	53                   	push   %ebx
+  800127:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80012a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80012f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800132:	b8 03 00 00 00       	mov    $0x3,%eax
+  800137:	89 cb                	mov    %ecx,%ebx
+  800139:	89 cf                	mov    %ecx,%edi
+  80013b:	89 ce                	mov    %ecx,%esi
+  80013d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80013f:	85 c0                	test   %eax,%eax
+  800141:	7f 08                	jg     80014b <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800143:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800146:	5b                   	pop    %ebx
+  800147:	5e                   	pop    %esi
+  800148:	5f                   	pop    %edi
+  800149:	5d                   	pop    %ebp
+  80014a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80014b:	83 ec 0c             	sub    $0xc,%esp
+  80014e:	50                   	push   %eax
+  80014f:	6a 03                	push   $0x3
+  800151:	68 aa 26 80 00       	push   $0x8026aa
+  800156:	6a 23                	push   $0x23
+  800158:	68 c7 26 80 00       	push   $0x8026c7
+  80015d:	e8 b9 15 00 00       	call   80171b <_panic>
+
+00800162 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800162:	55                   	push   %ebp
+  800163:	89 e5                	mov    %esp,%ebp
+  800165:	57                   	push   %edi
+  800166:	56                   	push   %esi
+  800167:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800168:	ba 00 00 00 00       	mov    $0x0,%edx
+  80016d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800172:	89 d1                	mov    %edx,%ecx
+  800174:	89 d3                	mov    %edx,%ebx
+  800176:	89 d7                	mov    %edx,%edi
+  800178:	89 d6                	mov    %edx,%esi
+  80017a:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80017c:	5b                   	pop    %ebx
+  80017d:	5e                   	pop    %esi
+  80017e:	5f                   	pop    %edi
+  80017f:	5d                   	pop    %ebp
+  800180:	c3                   	ret
+
+00800181 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800181:	55                   	push   %ebp
+  800182:	89 e5                	mov    %esp,%ebp
+  800184:	57                   	push   %edi
+  800185:	56                   	push   %esi
+  800186:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800187:	ba 00 00 00 00       	mov    $0x0,%edx
+  80018c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800191:	89 d1                	mov    %edx,%ecx
+  800193:	89 d3                	mov    %edx,%ebx
+  800195:	89 d7                	mov    %edx,%edi
+  800197:	89 d6                	mov    %edx,%esi
+  800199:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80019b:	5b                   	pop    %ebx
+  80019c:	5e                   	pop    %esi
+  80019d:	5f                   	pop    %edi
+  80019e:	5d                   	pop    %ebp
+  80019f:	c3                   	ret
+
+008001a0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001a0:	55                   	push   %ebp
+  8001a1:	89 e5                	mov    %esp,%ebp
+  8001a3:	57                   	push   %edi
+  8001a4:	56                   	push   %esi
+  8001a5:	53                   	push   %ebx
+  8001a6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001b4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001bc:	89 f7                	mov    %esi,%edi
+  8001be:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001c0:	85 c0                	test   %eax,%eax
+  8001c2:	7f 08                	jg     8001cc <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c7:	5b                   	pop    %ebx
+  8001c8:	5e                   	pop    %esi
+  8001c9:	5f                   	pop    %edi
+  8001ca:	5d                   	pop    %ebp
+  8001cb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001cc:	83 ec 0c             	sub    $0xc,%esp
+  8001cf:	50                   	push   %eax
+  8001d0:	6a 04                	push   $0x4
+  8001d2:	68 aa 26 80 00       	push   $0x8026aa
+  8001d7:	6a 23                	push   $0x23
+  8001d9:	68 c7 26 80 00       	push   $0x8026c7
+  8001de:	e8 38 15 00 00       	call   80171b <_panic>
+
+008001e3 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001e3:	55                   	push   %ebp
+  8001e4:	89 e5                	mov    %esp,%ebp
+  8001e6:	57                   	push   %edi
+  8001e7:	56                   	push   %esi
+  8001e8:	53                   	push   %ebx
+  8001e9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001f2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001fa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001fd:	8b 75 18             	mov    0x18(%ebp),%esi
+  800200:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800202:	85 c0                	test   %eax,%eax
+  800204:	7f 08                	jg     80020e <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800206:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800209:	5b                   	pop    %ebx
+  80020a:	5e                   	pop    %esi
+  80020b:	5f                   	pop    %edi
+  80020c:	5d                   	pop    %ebp
+  80020d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80020e:	83 ec 0c             	sub    $0xc,%esp
+  800211:	50                   	push   %eax
+  800212:	6a 05                	push   $0x5
+  800214:	68 aa 26 80 00       	push   $0x8026aa
+  800219:	6a 23                	push   $0x23
+  80021b:	68 c7 26 80 00       	push   $0x8026c7
+  800220:	e8 f6 14 00 00       	call   80171b <_panic>
+
+00800225 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800225:	55                   	push   %ebp
+  800226:	89 e5                	mov    %esp,%ebp
+  800228:	57                   	push   %edi
+  800229:	56                   	push   %esi
+  80022a:	53                   	push   %ebx
+  80022b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80022e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800233:	8b 55 08             	mov    0x8(%ebp),%edx
+  800236:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800239:	b8 06 00 00 00       	mov    $0x6,%eax
+  80023e:	89 df                	mov    %ebx,%edi
+  800240:	89 de                	mov    %ebx,%esi
+  800242:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800244:	85 c0                	test   %eax,%eax
+  800246:	7f 08                	jg     800250 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800248:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024b:	5b                   	pop    %ebx
+  80024c:	5e                   	pop    %esi
+  80024d:	5f                   	pop    %edi
+  80024e:	5d                   	pop    %ebp
+  80024f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800250:	83 ec 0c             	sub    $0xc,%esp
+  800253:	50                   	push   %eax
+  800254:	6a 06                	push   $0x6
+  800256:	68 aa 26 80 00       	push   $0x8026aa
+  80025b:	6a 23                	push   $0x23
+  80025d:	68 c7 26 80 00       	push   $0x8026c7
+  800262:	e8 b4 14 00 00       	call   80171b <_panic>
+
+00800267 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800267:	55                   	push   %ebp
+  800268:	89 e5                	mov    %esp,%ebp
+  80026a:	57                   	push   %edi
+  80026b:	56                   	push   %esi
+  80026c:	53                   	push   %ebx
+  80026d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800270:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800275:	8b 55 08             	mov    0x8(%ebp),%edx
+  800278:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80027b:	b8 18 00 00 00       	mov    $0x18,%eax
+  800280:	89 df                	mov    %ebx,%edi
+  800282:	89 de                	mov    %ebx,%esi
+  800284:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800286:	85 c0                	test   %eax,%eax
+  800288:	7f 08                	jg     800292 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80028a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028d:	5b                   	pop    %ebx
+  80028e:	5e                   	pop    %esi
+  80028f:	5f                   	pop    %edi
+  800290:	5d                   	pop    %ebp
+  800291:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800292:	83 ec 0c             	sub    $0xc,%esp
+  800295:	50                   	push   %eax
+  800296:	6a 18                	push   $0x18
+  800298:	68 aa 26 80 00       	push   $0x8026aa
+  80029d:	6a 23                	push   $0x23
+  80029f:	68 c7 26 80 00       	push   $0x8026c7
+  8002a4:	e8 72 14 00 00       	call   80171b <_panic>
+
+008002a9 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  8002a9:	55                   	push   %ebp
+  8002aa:	89 e5                	mov    %esp,%ebp
+  8002ac:	57                   	push   %edi
+  8002ad:	56                   	push   %esi
+  8002ae:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002af:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002ba:	b8 19 00 00 00       	mov    $0x19,%eax
+  8002bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002c2:	89 f7                	mov    %esi,%edi
+  8002c4:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  8002c6:	5b                   	pop    %ebx
+  8002c7:	5e                   	pop    %esi
+  8002c8:	5f                   	pop    %edi
+  8002c9:	5d                   	pop    %ebp
+  8002ca:	c3                   	ret
+
+008002cb <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8002cb:	55                   	push   %ebp
+  8002cc:	89 e5                	mov    %esp,%ebp
+  8002ce:	57                   	push   %edi
+  8002cf:	56                   	push   %esi
+  8002d0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002d7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8002e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002e4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002e7:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8002e9:	5b                   	pop    %ebx
+  8002ea:	5e                   	pop    %esi
+  8002eb:	5f                   	pop    %edi
+  8002ec:	5d                   	pop    %ebp
+  8002ed:	c3                   	ret
+
+008002ee <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  8002ee:	55                   	push   %ebp
+  8002ef:	89 e5                	mov    %esp,%ebp
+  8002f1:	57                   	push   %edi
+  8002f2:	56                   	push   %esi
+  8002f3:	53                   	push   %ebx
+  8002f4:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  8002f7:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8002fa:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800300:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800303:	8b 55 08             	mov    0x8(%ebp),%edx
+  800306:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800309:	b8 10 00 00 00       	mov    $0x10,%eax
+  80030e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800311:	8b 75 18             	mov    0x18(%ebp),%esi
+  800314:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800316:	85 c0                	test   %eax,%eax
+  800318:	7f 08                	jg     800322 <sys_page_map_range+0x34>
+}
+  80031a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80031d:	5b                   	pop    %ebx
+  80031e:	5e                   	pop    %esi
+  80031f:	5f                   	pop    %edi
+  800320:	5d                   	pop    %ebp
+  800321:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800322:	83 ec 0c             	sub    $0xc,%esp
+  800325:	50                   	push   %eax
+  800326:	6a 10                	push   $0x10
+  800328:	68 aa 26 80 00       	push   $0x8026aa
+  80032d:	6a 23                	push   $0x23
+  80032f:	68 c7 26 80 00       	push   $0x8026c7
+  800334:	e8 e2 13 00 00       	call   80171b <_panic>
+
+00800339 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800339:	55                   	push   %ebp
+  80033a:	89 e5                	mov    %esp,%ebp
+  80033c:	57                   	push   %edi
+  80033d:	56                   	push   %esi
+  80033e:	53                   	push   %ebx
+  80033f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800342:	be 00 00 00 00       	mov    $0x0,%esi
+  800347:	8b 55 08             	mov    0x8(%ebp),%edx
+  80034a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80034d:	b8 11 00 00 00       	mov    $0x11,%eax
+  800352:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800355:	89 f7                	mov    %esi,%edi
+  800357:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800359:	85 c0                	test   %eax,%eax
+  80035b:	7f 08                	jg     800365 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  80035d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800360:	5b                   	pop    %ebx
+  800361:	5e                   	pop    %esi
+  800362:	5f                   	pop    %edi
+  800363:	5d                   	pop    %ebp
+  800364:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800365:	83 ec 0c             	sub    $0xc,%esp
+  800368:	50                   	push   %eax
+  800369:	6a 11                	push   $0x11
+  80036b:	68 aa 26 80 00       	push   $0x8026aa
+  800370:	6a 23                	push   $0x23
+  800372:	68 c7 26 80 00       	push   $0x8026c7
+  800377:	e8 9f 13 00 00       	call   80171b <_panic>
+
+0080037c <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  80037c:	55                   	push   %ebp
+  80037d:	89 e5                	mov    %esp,%ebp
+  80037f:	57                   	push   %edi
+  800380:	56                   	push   %esi
+  800381:	53                   	push   %ebx
+  800382:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800385:	be 00 00 00 00       	mov    $0x0,%esi
+  80038a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80038d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800390:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800395:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800398:	89 f7                	mov    %esi,%edi
+  80039a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80039c:	85 c0                	test   %eax,%eax
+  80039e:	7f 08                	jg     8003a8 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8003a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a3:	5b                   	pop    %ebx
+  8003a4:	5e                   	pop    %esi
+  8003a5:	5f                   	pop    %edi
+  8003a6:	5d                   	pop    %ebp
+  8003a7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003a8:	83 ec 0c             	sub    $0xc,%esp
+  8003ab:	50                   	push   %eax
+  8003ac:	6a 1b                	push   $0x1b
+  8003ae:	68 aa 26 80 00       	push   $0x8026aa
+  8003b3:	6a 23                	push   $0x23
+  8003b5:	68 c7 26 80 00       	push   $0x8026c7
+  8003ba:	e8 5c 13 00 00       	call   80171b <_panic>
+
+008003bf <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  8003bf:	55                   	push   %ebp
+  8003c0:	89 e5                	mov    %esp,%ebp
+  8003c2:	57                   	push   %edi
+  8003c3:	56                   	push   %esi
+  8003c4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003ca:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003cf:	89 d1                	mov    %edx,%ecx
+  8003d1:	89 d3                	mov    %edx,%ebx
+  8003d3:	89 d7                	mov    %edx,%edi
+  8003d5:	89 d6                	mov    %edx,%esi
+  8003d7:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8003d9:	5b                   	pop    %ebx
+  8003da:	5e                   	pop    %esi
+  8003db:	5f                   	pop    %edi
+  8003dc:	5d                   	pop    %ebp
+  8003dd:	c3                   	ret
+
+008003de <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003de:	55                   	push   %ebp
+  8003df:	89 e5                	mov    %esp,%ebp
+  8003e1:	57                   	push   %edi
+  8003e2:	56                   	push   %esi
+  8003e3:	53                   	push   %ebx
+  8003e4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003f2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8003f7:	89 df                	mov    %ebx,%edi
+  8003f9:	89 de                	mov    %ebx,%esi
+  8003fb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003fd:	85 c0                	test   %eax,%eax
+  8003ff:	7f 08                	jg     800409 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800401:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800404:	5b                   	pop    %ebx
+  800405:	5e                   	pop    %esi
+  800406:	5f                   	pop    %edi
+  800407:	5d                   	pop    %ebp
+  800408:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800409:	83 ec 0c             	sub    $0xc,%esp
+  80040c:	50                   	push   %eax
+  80040d:	6a 08                	push   $0x8
+  80040f:	68 aa 26 80 00       	push   $0x8026aa
+  800414:	6a 23                	push   $0x23
+  800416:	68 c7 26 80 00       	push   $0x8026c7
+  80041b:	e8 fb 12 00 00       	call   80171b <_panic>
+
+00800420 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800420:	55                   	push   %ebp
+  800421:	89 e5                	mov    %esp,%ebp
+  800423:	57                   	push   %edi
+  800424:	56                   	push   %esi
+  800425:	53                   	push   %ebx
+  800426:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800429:	6a 44                	push   $0x44
+  80042b:	ff 75 0c             	push   0xc(%ebp)
+  80042e:	e8 7a fc ff ff       	call   8000ad <touch_mem>
+	asm volatile("int %1\n"
+  800433:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800438:	8b 55 08             	mov    0x8(%ebp),%edx
+  80043b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800440:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800443:	89 df                	mov    %ebx,%edi
+  800445:	89 de                	mov    %ebx,%esi
+  800447:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800449:	83 c4 08             	add    $0x8,%esp
+  80044c:	85 c0                	test   %eax,%eax
+  80044e:	7f 08                	jg     800458 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800450:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800453:	5b                   	pop    %ebx
+  800454:	5e                   	pop    %esi
+  800455:	5f                   	pop    %edi
+  800456:	5d                   	pop    %ebp
+  800457:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800458:	83 ec 0c             	sub    $0xc,%esp
+  80045b:	50                   	push   %eax
+  80045c:	6a 09                	push   $0x9
+  80045e:	68 aa 26 80 00       	push   $0x8026aa
+  800463:	6a 23                	push   $0x23
+  800465:	68 c7 26 80 00       	push   $0x8026c7
+  80046a:	e8 ac 12 00 00       	call   80171b <_panic>
+
+0080046f <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  80046f:	55                   	push   %ebp
+  800470:	89 e5                	mov    %esp,%ebp
+  800472:	57                   	push   %edi
+  800473:	56                   	push   %esi
+  800474:	53                   	push   %ebx
+  800475:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800478:	be 00 00 00 00       	mov    $0x0,%esi
+  80047d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800480:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800483:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800488:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80048b:	89 f7                	mov    %esi,%edi
+  80048d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80048f:	85 c0                	test   %eax,%eax
+  800491:	7f 08                	jg     80049b <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800493:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800496:	5b                   	pop    %ebx
+  800497:	5e                   	pop    %esi
+  800498:	5f                   	pop    %edi
+  800499:	5d                   	pop    %ebp
+  80049a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80049b:	83 ec 0c             	sub    $0xc,%esp
+  80049e:	50                   	push   %eax
+  80049f:	6a 1a                	push   $0x1a
+  8004a1:	68 aa 26 80 00       	push   $0x8026aa
+  8004a6:	6a 23                	push   $0x23
+  8004a8:	68 c7 26 80 00       	push   $0x8026c7
+  8004ad:	e8 69 12 00 00       	call   80171b <_panic>
+
+008004b2 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8004b2:	55                   	push   %ebp
+  8004b3:	89 e5                	mov    %esp,%ebp
+  8004b5:	57                   	push   %edi
+  8004b6:	56                   	push   %esi
+  8004b7:	53                   	push   %ebx
+  8004b8:	83 ec 0c             	sub    $0xc,%esp
+  8004bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8004be:	89 d8                	mov    %ebx,%eax
+  8004c0:	c1 e0 05             	shl    $0x5,%eax
+  8004c3:	50                   	push   %eax
+  8004c4:	ff 75 0c             	push   0xc(%ebp)
+  8004c7:	e8 e1 fb ff ff       	call   8000ad <touch_mem>
+	asm volatile("int %1\n"
+  8004cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8004d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004d4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004dc:	89 f7                	mov    %esi,%edi
+  8004de:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004e0:	83 c4 08             	add    $0x8,%esp
+  8004e3:	85 c0                	test   %eax,%eax
+  8004e5:	7f 08                	jg     8004ef <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8004e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004ea:	5b                   	pop    %ebx
+  8004eb:	5e                   	pop    %esi
+  8004ec:	5f                   	pop    %edi
+  8004ed:	5d                   	pop    %ebp
+  8004ee:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004ef:	83 ec 0c             	sub    $0xc,%esp
+  8004f2:	50                   	push   %eax
+  8004f3:	6a 13                	push   $0x13
+  8004f5:	68 aa 26 80 00       	push   $0x8026aa
+  8004fa:	6a 23                	push   $0x23
+  8004fc:	68 c7 26 80 00       	push   $0x8026c7
+  800501:	e8 15 12 00 00       	call   80171b <_panic>
+
+00800506 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800506:	55                   	push   %ebp
+  800507:	89 e5                	mov    %esp,%ebp
+  800509:	57                   	push   %edi
+  80050a:	56                   	push   %esi
+  80050b:	53                   	push   %ebx
+  80050c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80050f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800514:	8b 55 08             	mov    0x8(%ebp),%edx
+  800517:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80051a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80051f:	89 df                	mov    %ebx,%edi
+  800521:	89 de                	mov    %ebx,%esi
+  800523:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800525:	85 c0                	test   %eax,%eax
+  800527:	7f 08                	jg     800531 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800529:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80052c:	5b                   	pop    %ebx
+  80052d:	5e                   	pop    %esi
+  80052e:	5f                   	pop    %edi
+  80052f:	5d                   	pop    %ebp
+  800530:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800531:	83 ec 0c             	sub    $0xc,%esp
+  800534:	50                   	push   %eax
+  800535:	6a 0a                	push   $0xa
+  800537:	68 aa 26 80 00       	push   $0x8026aa
+  80053c:	6a 23                	push   $0x23
+  80053e:	68 c7 26 80 00       	push   $0x8026c7
+  800543:	e8 d3 11 00 00       	call   80171b <_panic>
+
+00800548 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800548:	55                   	push   %ebp
+  800549:	89 e5                	mov    %esp,%ebp
+  80054b:	57                   	push   %edi
+  80054c:	56                   	push   %esi
+  80054d:	53                   	push   %ebx
+  80054e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  800551:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800557:	76 1d                	jbe    800576 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  800559:	8b 55 08             	mov    0x8(%ebp),%edx
+  80055c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80055f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800564:	be 01 00 00 00       	mov    $0x1,%esi
+  800569:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80056c:	cd 30                	int    $0x30
+}
+  80056e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800571:	5b                   	pop    %ebx
+  800572:	5e                   	pop    %esi
+  800573:	5f                   	pop    %edi
+  800574:	5d                   	pop    %ebp
+  800575:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  800576:	68 00 10 00 00       	push   $0x1000
+  80057b:	53                   	push   %ebx
+  80057c:	e8 2c fb ff ff       	call   8000ad <touch_mem>
+  800581:	83 c4 08             	add    $0x8,%esp
+  800584:	eb d3                	jmp    800559 <sys_ipc_send+0x11>
+
+00800586 <sys_ipc_send_pages>:
+{
+  800586:	55                   	push   %ebp
+  800587:	89 e5                	mov    %esp,%ebp
+  800589:	57                   	push   %edi
+  80058a:	56                   	push   %esi
+  80058b:	53                   	push   %ebx
+  80058c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80058f:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  800592:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800598:	76 18                	jbe    8005b2 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80059a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80059d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005a0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8005a5:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8005a8:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8005aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005ad:	5b                   	pop    %ebx
+  8005ae:	5e                   	pop    %esi
+  8005af:	5f                   	pop    %edi
+  8005b0:	5d                   	pop    %ebp
+  8005b1:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8005b2:	89 f0                	mov    %esi,%eax
+  8005b4:	c1 e0 0c             	shl    $0xc,%eax
+  8005b7:	50                   	push   %eax
+  8005b8:	53                   	push   %ebx
+  8005b9:	e8 ef fa ff ff       	call   8000ad <touch_mem>
+  8005be:	83 c4 08             	add    $0x8,%esp
+  8005c1:	eb d7                	jmp    80059a <sys_ipc_send_pages+0x14>
+
+008005c3 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8005c3:	55                   	push   %ebp
+  8005c4:	89 e5                	mov    %esp,%ebp
+  8005c6:	57                   	push   %edi
+  8005c7:	56                   	push   %esi
+  8005c8:	53                   	push   %ebx
+  8005c9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8005cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005d7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8005dc:	89 df                	mov    %ebx,%edi
+  8005de:	89 de                	mov    %ebx,%esi
+  8005e0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8005e2:	85 c0                	test   %eax,%eax
+  8005e4:	7f 08                	jg     8005ee <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8005e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005e9:	5b                   	pop    %ebx
+  8005ea:	5e                   	pop    %esi
+  8005eb:	5f                   	pop    %edi
+  8005ec:	5d                   	pop    %ebp
+  8005ed:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8005ee:	83 ec 0c             	sub    $0xc,%esp
+  8005f1:	50                   	push   %eax
+  8005f2:	6a 0d                	push   $0xd
+  8005f4:	68 aa 26 80 00       	push   $0x8026aa
+  8005f9:	6a 23                	push   $0x23
+  8005fb:	68 c7 26 80 00       	push   $0x8026c7
+  800600:	e8 16 11 00 00       	call   80171b <_panic>
+
+00800605 <sys_ipc_recv>:
+{
+  800605:	55                   	push   %ebp
+  800606:	89 e5                	mov    %esp,%ebp
+  800608:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80060b:	6a 01                	push   $0x1
+  80060d:	ff 75 08             	push   0x8(%ebp)
+  800610:	e8 ae ff ff ff       	call   8005c3 <sys_ipc_recv_pages>
+}
+  800615:	c9                   	leave
+  800616:	c3                   	ret
+
+00800617 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  800617:	55                   	push   %ebp
+  800618:	89 e5                	mov    %esp,%ebp
+  80061a:	57                   	push   %edi
+  80061b:	56                   	push   %esi
+  80061c:	53                   	push   %ebx
+  80061d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800620:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800623:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  800626:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80062c:	77 04                	ja     800632 <sys_ipc_call+0x1b>
+  80062e:	85 f6                	test   %esi,%esi
+  800630:	75 15                	jne    800647 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  800632:	8b 55 08             	mov    0x8(%ebp),%edx
+  800635:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800638:	b8 14 00 00 00       	mov    $0x14,%eax
+  80063d:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80063f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800642:	5b                   	pop    %ebx
+  800643:	5e                   	pop    %esi
+  800644:	5f                   	pop    %edi
+  800645:	5d                   	pop    %ebp
+  800646:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  800647:	89 f8                	mov    %edi,%eax
+  800649:	c1 e0 0c             	shl    $0xc,%eax
+  80064c:	50                   	push   %eax
+  80064d:	53                   	push   %ebx
+  80064e:	e8 5a fa ff ff       	call   8000ad <touch_mem>
+  800653:	83 c4 08             	add    $0x8,%esp
+  800656:	eb da                	jmp    800632 <sys_ipc_call+0x1b>
+
+00800658 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  800658:	55                   	push   %ebp
+  800659:	89 e5                	mov    %esp,%ebp
+  80065b:	57                   	push   %edi
+  80065c:	56                   	push   %esi
+  80065d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80065e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800661:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800664:	b8 15 00 00 00       	mov    $0x15,%eax
+  800669:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80066c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80066f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800672:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  800674:	5b                   	pop    %ebx
+  800675:	5e                   	pop    %esi
+  800676:	5f                   	pop    %edi
+  800677:	5d                   	pop    %ebp
+  800678:	c3                   	ret
+
+00800679 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  800679:	55                   	push   %ebp
+  80067a:	89 e5                	mov    %esp,%ebp
+  80067c:	57                   	push   %edi
+  80067d:	56                   	push   %esi
+  80067e:	53                   	push   %ebx
+  80067f:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  800682:	6a 04                	push   $0x4
+  800684:	ff 75 08             	push   0x8(%ebp)
+  800687:	e8 21 fa ff ff       	call   8000ad <touch_mem>
+	asm volatile("int %1\n"
+  80068c:	be 00 00 00 00       	mov    $0x0,%esi
+  800691:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800694:	b8 16 00 00 00       	mov    $0x16,%eax
+  800699:	8b 55 08             	mov    0x8(%ebp),%edx
+  80069c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80069f:	89 f7                	mov    %esi,%edi
+  8006a1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8006a3:	83 c4 08             	add    $0x8,%esp
+  8006a6:	85 c0                	test   %eax,%eax
+  8006a8:	7f 08                	jg     8006b2 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8006aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006ad:	5b                   	pop    %ebx
+  8006ae:	5e                   	pop    %esi
+  8006af:	5f                   	pop    %edi
+  8006b0:	5d                   	pop    %ebp
+  8006b1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006b2:	83 ec 0c             	sub    $0xc,%esp
+  8006b5:	50                   	push   %eax
+  8006b6:	6a 16                	push   $0x16
+  8006b8:	68 aa 26 80 00       	push   $0x8026aa
+  8006bd:	6a 23                	push   $0x23
+  8006bf:	68 c7 26 80 00       	push   $0x8026c7
+  8006c4:	e8 52 10 00 00       	call   80171b <_panic>
+
+008006c9 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8006c9:	55                   	push   %ebp
+  8006ca:	89 e5                	mov    %esp,%ebp
+  8006cc:	57                   	push   %edi
+  8006cd:	56                   	push   %esi
+  8006ce:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8006cf:	6a 04                	push   $0x4
+  8006d1:	ff 75 08             	push   0x8(%ebp)
+  8006d4:	e8 d4 f9 ff ff       	call   8000ad <touch_mem>
+	asm volatile("int %1\n"
+  8006d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006e1:	b8 17 00 00 00       	mov    $0x17,%eax
+  8006e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006e9:	89 df                	mov    %ebx,%edi
+  8006eb:	89 de                	mov    %ebx,%esi
+  8006ed:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8006ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006f2:	5b                   	pop    %ebx
+  8006f3:	5e                   	pop    %esi
+  8006f4:	5f                   	pop    %edi
+  8006f5:	5d                   	pop    %ebp
+  8006f6:	c3                   	ret
+
+008006f7 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8006f7:	55                   	push   %ebp
+  8006f8:	89 e5                	mov    %esp,%ebp
+  8006fa:	57                   	push   %edi
+  8006fb:	56                   	push   %esi
+  8006fc:	53                   	push   %ebx
+  8006fd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800700:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800705:	8b 55 08             	mov    0x8(%ebp),%edx
+  800708:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80070d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800712:	89 df                	mov    %ebx,%edi
+  800714:	89 de                	mov    %ebx,%esi
+  800716:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800718:	85 c0                	test   %eax,%eax
+  80071a:	7f 08                	jg     800724 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80071c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80071f:	5b                   	pop    %ebx
+  800720:	5e                   	pop    %esi
+  800721:	5f                   	pop    %edi
+  800722:	5d                   	pop    %ebp
+  800723:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800724:	83 ec 0c             	sub    $0xc,%esp
+  800727:	50                   	push   %eax
+  800728:	6a 0e                	push   $0xe
+  80072a:	68 aa 26 80 00       	push   $0x8026aa
+  80072f:	6a 23                	push   $0x23
+  800731:	68 c7 26 80 00       	push   $0x8026c7
+  800736:	e8 e0 0f 00 00       	call   80171b <_panic>
+
+0080073b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80073b:	55                   	push   %ebp
+  80073c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80073e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800741:	05 00 00 00 30       	add    $0x30000000,%eax
+  800746:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800749:	5d                   	pop    %ebp
+  80074a:	c3                   	ret
+
+0080074b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80074b:	55                   	push   %ebp
+  80074c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80074e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800751:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800756:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80075b:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800760:	5d                   	pop    %ebp
+  800761:	c3                   	ret
+
+00800762 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800762:	55                   	push   %ebp
+  800763:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  800765:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  80076a:	a8 01                	test   $0x1,%al
+  80076c:	74 3c                	je     8007aa <fd_alloc+0x48>
+  80076e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800773:	89 c2                	mov    %eax,%edx
+  800775:	c1 ea 0c             	shr    $0xc,%edx
+  800778:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80077f:	89 c1                	mov    %eax,%ecx
+  800781:	05 00 10 00 00       	add    $0x1000,%eax
+  800786:	f6 c2 01             	test   $0x1,%dl
+  800789:	74 13                	je     80079e <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80078b:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  800790:	75 e1                	jne    800773 <fd_alloc+0x11>
+  800792:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800797:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80079c:	eb 05                	jmp    8007a3 <fd_alloc+0x41>
+			return 0;
+  80079e:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8007a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007a6:	89 0a                	mov    %ecx,(%edx)
+}
+  8007a8:	5d                   	pop    %ebp
+  8007a9:	c3                   	ret
+  8007aa:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8007af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b4:	eb ed                	jmp    8007a3 <fd_alloc+0x41>
+
+008007b6 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8007b6:	55                   	push   %ebp
+  8007b7:	89 e5                	mov    %esp,%ebp
+  8007b9:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8007bc:	83 f8 1f             	cmp    $0x1f,%eax
+  8007bf:	77 30                	ja     8007f1 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8007c1:	c1 e0 0c             	shl    $0xc,%eax
+  8007c4:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8007c9:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8007cf:	f6 c2 01             	test   $0x1,%dl
+  8007d2:	74 24                	je     8007f8 <fd_lookup+0x42>
+  8007d4:	89 c2                	mov    %eax,%edx
+  8007d6:	c1 ea 0c             	shr    $0xc,%edx
+  8007d9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8007e0:	f6 c2 01             	test   $0x1,%dl
+  8007e3:	74 1a                	je     8007ff <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8007e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007e8:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8007ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007ef:	5d                   	pop    %ebp
+  8007f0:	c3                   	ret
+		return -E_INVAL;
+  8007f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007f6:	eb f7                	jmp    8007ef <fd_lookup+0x39>
+		return -E_INVAL;
+  8007f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007fd:	eb f0                	jmp    8007ef <fd_lookup+0x39>
+  8007ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800804:	eb e9                	jmp    8007ef <fd_lookup+0x39>
+
+00800806 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800806:	55                   	push   %ebp
+  800807:	89 e5                	mov    %esp,%ebp
+  800809:	53                   	push   %ebx
+  80080a:	83 ec 04             	sub    $0x4,%esp
+  80080d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800810:	b8 54 27 80 00       	mov    $0x802754,%eax
+  800815:	8b 18                	mov    (%eax),%ebx
+  800817:	85 db                	test   %ebx,%ebx
+  800819:	74 0e                	je     800829 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  80081b:	83 c0 04             	add    $0x4,%eax
+  80081e:	39 13                	cmp    %edx,(%ebx)
+  800820:	75 f3                	jne    800815 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  800822:	b8 00 00 00 00       	mov    $0x0,%eax
+  800827:	eb 1f                	jmp    800848 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800829:	a1 08 40 80 00       	mov    0x804008,%eax
+  80082e:	8b 40 48             	mov    0x48(%eax),%eax
+  800831:	83 ec 04             	sub    $0x4,%esp
+  800834:	52                   	push   %edx
+  800835:	50                   	push   %eax
+  800836:	68 d8 26 80 00       	push   $0x8026d8
+  80083b:	e8 b6 0f 00 00       	call   8017f6 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800840:	83 c4 10             	add    $0x10,%esp
+  800843:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800848:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80084b:	89 1a                	mov    %ebx,(%edx)
+}
+  80084d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800850:	c9                   	leave
+  800851:	c3                   	ret
+
+00800852 <fd_close>:
+{
+  800852:	55                   	push   %ebp
+  800853:	89 e5                	mov    %esp,%ebp
+  800855:	57                   	push   %edi
+  800856:	56                   	push   %esi
+  800857:	53                   	push   %ebx
+  800858:	83 ec 24             	sub    $0x24,%esp
+  80085b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80085e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800861:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800864:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800865:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80086b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80086e:	50                   	push   %eax
+  80086f:	e8 42 ff ff ff       	call   8007b6 <fd_lookup>
+  800874:	89 c3                	mov    %eax,%ebx
+  800876:	83 c4 10             	add    $0x10,%esp
+  800879:	85 c0                	test   %eax,%eax
+  80087b:	78 05                	js     800882 <fd_close+0x30>
+	    || fd != fd2)
+  80087d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800880:	74 16                	je     800898 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800882:	89 f8                	mov    %edi,%eax
+  800884:	84 c0                	test   %al,%al
+  800886:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80088e:	89 d8                	mov    %ebx,%eax
+  800890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800893:	5b                   	pop    %ebx
+  800894:	5e                   	pop    %esi
+  800895:	5f                   	pop    %edi
+  800896:	5d                   	pop    %ebp
+  800897:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800898:	83 ec 08             	sub    $0x8,%esp
+  80089b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80089e:	50                   	push   %eax
+  80089f:	ff 36                	push   (%esi)
+  8008a1:	e8 60 ff ff ff       	call   800806 <dev_lookup>
+  8008a6:	89 c3                	mov    %eax,%ebx
+  8008a8:	83 c4 10             	add    $0x10,%esp
+  8008ab:	85 c0                	test   %eax,%eax
+  8008ad:	78 1a                	js     8008c9 <fd_close+0x77>
+		if (dev->dev_close)
+  8008af:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008b2:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8008b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8008ba:	85 c0                	test   %eax,%eax
+  8008bc:	74 0b                	je     8008c9 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8008be:	83 ec 0c             	sub    $0xc,%esp
+  8008c1:	56                   	push   %esi
+  8008c2:	ff d0                	call   *%eax
+  8008c4:	89 c3                	mov    %eax,%ebx
+  8008c6:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8008c9:	83 ec 08             	sub    $0x8,%esp
+  8008cc:	56                   	push   %esi
+  8008cd:	6a 00                	push   $0x0
+  8008cf:	e8 51 f9 ff ff       	call   800225 <sys_page_unmap>
+	return r;
+  8008d4:	83 c4 10             	add    $0x10,%esp
+  8008d7:	eb b5                	jmp    80088e <fd_close+0x3c>
+
+008008d9 <close>:
+
+int
+close(int fdnum)
+{
+  8008d9:	55                   	push   %ebp
+  8008da:	89 e5                	mov    %esp,%ebp
+  8008dc:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8008df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008e2:	50                   	push   %eax
+  8008e3:	ff 75 08             	push   0x8(%ebp)
+  8008e6:	e8 cb fe ff ff       	call   8007b6 <fd_lookup>
+  8008eb:	83 c4 10             	add    $0x10,%esp
+  8008ee:	85 c0                	test   %eax,%eax
+  8008f0:	79 02                	jns    8008f4 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8008f2:	c9                   	leave
+  8008f3:	c3                   	ret
+		return fd_close(fd, 1);
+  8008f4:	83 ec 08             	sub    $0x8,%esp
+  8008f7:	6a 01                	push   $0x1
+  8008f9:	ff 75 f4             	push   -0xc(%ebp)
+  8008fc:	e8 51 ff ff ff       	call   800852 <fd_close>
+  800901:	83 c4 10             	add    $0x10,%esp
+  800904:	eb ec                	jmp    8008f2 <close+0x19>
+
+00800906 <close_all>:
+
+void
+close_all(void)
+{
+  800906:	55                   	push   %ebp
+  800907:	89 e5                	mov    %esp,%ebp
+  800909:	53                   	push   %ebx
+  80090a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80090d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800912:	83 ec 0c             	sub    $0xc,%esp
+  800915:	53                   	push   %ebx
+  800916:	e8 be ff ff ff       	call   8008d9 <close>
+	for (i = 0; i < MAXFD; i++)
+  80091b:	83 c3 01             	add    $0x1,%ebx
+  80091e:	83 c4 10             	add    $0x10,%esp
+  800921:	83 fb 20             	cmp    $0x20,%ebx
+  800924:	75 ec                	jne    800912 <close_all+0xc>
+}
+  800926:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800929:	c9                   	leave
+  80092a:	c3                   	ret
+
+0080092b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80092b:	55                   	push   %ebp
+  80092c:	89 e5                	mov    %esp,%ebp
+  80092e:	57                   	push   %edi
+  80092f:	56                   	push   %esi
+  800930:	53                   	push   %ebx
+  800931:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800934:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800937:	50                   	push   %eax
+  800938:	ff 75 08             	push   0x8(%ebp)
+  80093b:	e8 76 fe ff ff       	call   8007b6 <fd_lookup>
+  800940:	89 c3                	mov    %eax,%ebx
+  800942:	83 c4 10             	add    $0x10,%esp
+  800945:	85 c0                	test   %eax,%eax
+  800947:	78 7f                	js     8009c8 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800949:	83 ec 0c             	sub    $0xc,%esp
+  80094c:	ff 75 0c             	push   0xc(%ebp)
+  80094f:	e8 85 ff ff ff       	call   8008d9 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800954:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800957:	c1 e6 0c             	shl    $0xc,%esi
+  80095a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800960:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800963:	89 3c 24             	mov    %edi,(%esp)
+  800966:	e8 e0 fd ff ff       	call   80074b <fd2data>
+  80096b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80096d:	89 34 24             	mov    %esi,(%esp)
+  800970:	e8 d6 fd ff ff       	call   80074b <fd2data>
+  800975:	83 c4 10             	add    $0x10,%esp
+  800978:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80097b:	89 d8                	mov    %ebx,%eax
+  80097d:	c1 e8 16             	shr    $0x16,%eax
+  800980:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800987:	a8 01                	test   $0x1,%al
+  800989:	74 11                	je     80099c <dup+0x71>
+  80098b:	89 d8                	mov    %ebx,%eax
+  80098d:	c1 e8 0c             	shr    $0xc,%eax
+  800990:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800997:	f6 c2 01             	test   $0x1,%dl
+  80099a:	75 36                	jne    8009d2 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80099c:	89 f8                	mov    %edi,%eax
+  80099e:	c1 e8 0c             	shr    $0xc,%eax
+  8009a1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8009a8:	83 ec 0c             	sub    $0xc,%esp
+  8009ab:	25 07 0e 00 00       	and    $0xe07,%eax
+  8009b0:	50                   	push   %eax
+  8009b1:	56                   	push   %esi
+  8009b2:	6a 00                	push   $0x0
+  8009b4:	57                   	push   %edi
+  8009b5:	6a 00                	push   $0x0
+  8009b7:	e8 27 f8 ff ff       	call   8001e3 <sys_page_map>
+  8009bc:	89 c3                	mov    %eax,%ebx
+  8009be:	83 c4 20             	add    $0x20,%esp
+  8009c1:	85 c0                	test   %eax,%eax
+  8009c3:	78 33                	js     8009f8 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8009c5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8009c8:	89 d8                	mov    %ebx,%eax
+  8009ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009cd:	5b                   	pop    %ebx
+  8009ce:	5e                   	pop    %esi
+  8009cf:	5f                   	pop    %edi
+  8009d0:	5d                   	pop    %ebp
+  8009d1:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8009d2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8009d9:	83 ec 0c             	sub    $0xc,%esp
+  8009dc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8009e1:	50                   	push   %eax
+  8009e2:	ff 75 d4             	push   -0x2c(%ebp)
+  8009e5:	6a 00                	push   $0x0
+  8009e7:	53                   	push   %ebx
+  8009e8:	6a 00                	push   $0x0
+  8009ea:	e8 f4 f7 ff ff       	call   8001e3 <sys_page_map>
+  8009ef:	89 c3                	mov    %eax,%ebx
+  8009f1:	83 c4 20             	add    $0x20,%esp
+  8009f4:	85 c0                	test   %eax,%eax
+  8009f6:	79 a4                	jns    80099c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8009f8:	83 ec 08             	sub    $0x8,%esp
+  8009fb:	56                   	push   %esi
+  8009fc:	6a 00                	push   $0x0
+  8009fe:	e8 22 f8 ff ff       	call   800225 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800a03:	83 c4 08             	add    $0x8,%esp
+  800a06:	ff 75 d4             	push   -0x2c(%ebp)
+  800a09:	6a 00                	push   $0x0
+  800a0b:	e8 15 f8 ff ff       	call   800225 <sys_page_unmap>
+	return r;
+  800a10:	83 c4 10             	add    $0x10,%esp
+  800a13:	eb b3                	jmp    8009c8 <dup+0x9d>
+
+00800a15 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	56                   	push   %esi
+  800a19:	53                   	push   %ebx
+  800a1a:	83 ec 18             	sub    $0x18,%esp
+  800a1d:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a20:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a23:	50                   	push   %eax
+  800a24:	56                   	push   %esi
+  800a25:	e8 8c fd ff ff       	call   8007b6 <fd_lookup>
+  800a2a:	83 c4 10             	add    $0x10,%esp
+  800a2d:	85 c0                	test   %eax,%eax
+  800a2f:	78 3c                	js     800a6d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a31:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a34:	83 ec 08             	sub    $0x8,%esp
+  800a37:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a3a:	50                   	push   %eax
+  800a3b:	ff 33                	push   (%ebx)
+  800a3d:	e8 c4 fd ff ff       	call   800806 <dev_lookup>
+  800a42:	83 c4 10             	add    $0x10,%esp
+  800a45:	85 c0                	test   %eax,%eax
+  800a47:	78 24                	js     800a6d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a49:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a4c:	83 e0 03             	and    $0x3,%eax
+  800a4f:	83 f8 01             	cmp    $0x1,%eax
+  800a52:	74 20                	je     800a74 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800a54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a57:	8b 40 08             	mov    0x8(%eax),%eax
+  800a5a:	85 c0                	test   %eax,%eax
+  800a5c:	74 37                	je     800a95 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800a5e:	83 ec 04             	sub    $0x4,%esp
+  800a61:	ff 75 10             	push   0x10(%ebp)
+  800a64:	ff 75 0c             	push   0xc(%ebp)
+  800a67:	53                   	push   %ebx
+  800a68:	ff d0                	call   *%eax
+  800a6a:	83 c4 10             	add    $0x10,%esp
+}
+  800a6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a70:	5b                   	pop    %ebx
+  800a71:	5e                   	pop    %esi
+  800a72:	5d                   	pop    %ebp
+  800a73:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a74:	a1 08 40 80 00       	mov    0x804008,%eax
+  800a79:	8b 40 48             	mov    0x48(%eax),%eax
+  800a7c:	83 ec 04             	sub    $0x4,%esp
+  800a7f:	56                   	push   %esi
+  800a80:	50                   	push   %eax
+  800a81:	68 19 27 80 00       	push   $0x802719
+  800a86:	e8 6b 0d 00 00       	call   8017f6 <cprintf>
+		return -E_INVAL;
+  800a8b:	83 c4 10             	add    $0x10,%esp
+  800a8e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a93:	eb d8                	jmp    800a6d <read+0x58>
+		return -E_NOT_SUPP;
+  800a95:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a9a:	eb d1                	jmp    800a6d <read+0x58>
+
+00800a9c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a9c:	55                   	push   %ebp
+  800a9d:	89 e5                	mov    %esp,%ebp
+  800a9f:	57                   	push   %edi
+  800aa0:	56                   	push   %esi
+  800aa1:	53                   	push   %ebx
+  800aa2:	83 ec 0c             	sub    $0xc,%esp
+  800aa5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800aa8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800aab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ab0:	eb 02                	jmp    800ab4 <readn+0x18>
+  800ab2:	01 c3                	add    %eax,%ebx
+  800ab4:	39 f3                	cmp    %esi,%ebx
+  800ab6:	73 21                	jae    800ad9 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800ab8:	83 ec 04             	sub    $0x4,%esp
+  800abb:	89 f0                	mov    %esi,%eax
+  800abd:	29 d8                	sub    %ebx,%eax
+  800abf:	50                   	push   %eax
+  800ac0:	89 d8                	mov    %ebx,%eax
+  800ac2:	03 45 0c             	add    0xc(%ebp),%eax
+  800ac5:	50                   	push   %eax
+  800ac6:	57                   	push   %edi
+  800ac7:	e8 49 ff ff ff       	call   800a15 <read>
+		if (m < 0)
+  800acc:	83 c4 10             	add    $0x10,%esp
+  800acf:	85 c0                	test   %eax,%eax
+  800ad1:	78 04                	js     800ad7 <readn+0x3b>
+			return m;
+		if (m == 0)
+  800ad3:	75 dd                	jne    800ab2 <readn+0x16>
+  800ad5:	eb 02                	jmp    800ad9 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800ad7:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800ad9:	89 d8                	mov    %ebx,%eax
+  800adb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ade:	5b                   	pop    %ebx
+  800adf:	5e                   	pop    %esi
+  800ae0:	5f                   	pop    %edi
+  800ae1:	5d                   	pop    %ebp
+  800ae2:	c3                   	ret
+
+00800ae3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800ae3:	55                   	push   %ebp
+  800ae4:	89 e5                	mov    %esp,%ebp
+  800ae6:	56                   	push   %esi
+  800ae7:	53                   	push   %ebx
+  800ae8:	83 ec 18             	sub    $0x18,%esp
+  800aeb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800aee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800af1:	50                   	push   %eax
+  800af2:	53                   	push   %ebx
+  800af3:	e8 be fc ff ff       	call   8007b6 <fd_lookup>
+  800af8:	83 c4 10             	add    $0x10,%esp
+  800afb:	85 c0                	test   %eax,%eax
+  800afd:	78 37                	js     800b36 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800aff:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b02:	83 ec 08             	sub    $0x8,%esp
+  800b05:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b08:	50                   	push   %eax
+  800b09:	ff 36                	push   (%esi)
+  800b0b:	e8 f6 fc ff ff       	call   800806 <dev_lookup>
+  800b10:	83 c4 10             	add    $0x10,%esp
+  800b13:	85 c0                	test   %eax,%eax
+  800b15:	78 1f                	js     800b36 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b17:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b1b:	74 20                	je     800b3d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800b1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b20:	8b 40 0c             	mov    0xc(%eax),%eax
+  800b23:	85 c0                	test   %eax,%eax
+  800b25:	74 37                	je     800b5e <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800b27:	83 ec 04             	sub    $0x4,%esp
+  800b2a:	ff 75 10             	push   0x10(%ebp)
+  800b2d:	ff 75 0c             	push   0xc(%ebp)
+  800b30:	56                   	push   %esi
+  800b31:	ff d0                	call   *%eax
+  800b33:	83 c4 10             	add    $0x10,%esp
+}
+  800b36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b39:	5b                   	pop    %ebx
+  800b3a:	5e                   	pop    %esi
+  800b3b:	5d                   	pop    %ebp
+  800b3c:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b3d:	a1 08 40 80 00       	mov    0x804008,%eax
+  800b42:	8b 40 48             	mov    0x48(%eax),%eax
+  800b45:	83 ec 04             	sub    $0x4,%esp
+  800b48:	53                   	push   %ebx
+  800b49:	50                   	push   %eax
+  800b4a:	68 35 27 80 00       	push   $0x802735
+  800b4f:	e8 a2 0c 00 00       	call   8017f6 <cprintf>
+		return -E_INVAL;
+  800b54:	83 c4 10             	add    $0x10,%esp
+  800b57:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b5c:	eb d8                	jmp    800b36 <write+0x53>
+		return -E_NOT_SUPP;
+  800b5e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b63:	eb d1                	jmp    800b36 <write+0x53>
+
+00800b65 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b65:	55                   	push   %ebp
+  800b66:	89 e5                	mov    %esp,%ebp
+  800b68:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b6b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b6e:	50                   	push   %eax
+  800b6f:	ff 75 08             	push   0x8(%ebp)
+  800b72:	e8 3f fc ff ff       	call   8007b6 <fd_lookup>
+  800b77:	83 c4 10             	add    $0x10,%esp
+  800b7a:	85 c0                	test   %eax,%eax
+  800b7c:	78 0e                	js     800b8c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b7e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b84:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800b87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b8c:	c9                   	leave
+  800b8d:	c3                   	ret
+
+00800b8e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b8e:	55                   	push   %ebp
+  800b8f:	89 e5                	mov    %esp,%ebp
+  800b91:	56                   	push   %esi
+  800b92:	53                   	push   %ebx
+  800b93:	83 ec 18             	sub    $0x18,%esp
+  800b96:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b99:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b9c:	50                   	push   %eax
+  800b9d:	53                   	push   %ebx
+  800b9e:	e8 13 fc ff ff       	call   8007b6 <fd_lookup>
+  800ba3:	83 c4 10             	add    $0x10,%esp
+  800ba6:	85 c0                	test   %eax,%eax
+  800ba8:	78 34                	js     800bde <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800baa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800bad:	83 ec 08             	sub    $0x8,%esp
+  800bb0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bb3:	50                   	push   %eax
+  800bb4:	ff 36                	push   (%esi)
+  800bb6:	e8 4b fc ff ff       	call   800806 <dev_lookup>
+  800bbb:	83 c4 10             	add    $0x10,%esp
+  800bbe:	85 c0                	test   %eax,%eax
+  800bc0:	78 1c                	js     800bde <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bc2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800bc6:	74 1d                	je     800be5 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800bc8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bcb:	8b 40 18             	mov    0x18(%eax),%eax
+  800bce:	85 c0                	test   %eax,%eax
+  800bd0:	74 34                	je     800c06 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800bd2:	83 ec 08             	sub    $0x8,%esp
+  800bd5:	ff 75 0c             	push   0xc(%ebp)
+  800bd8:	56                   	push   %esi
+  800bd9:	ff d0                	call   *%eax
+  800bdb:	83 c4 10             	add    $0x10,%esp
+}
+  800bde:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800be1:	5b                   	pop    %ebx
+  800be2:	5e                   	pop    %esi
+  800be3:	5d                   	pop    %ebp
+  800be4:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800be5:	a1 08 40 80 00       	mov    0x804008,%eax
+  800bea:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800bed:	83 ec 04             	sub    $0x4,%esp
+  800bf0:	53                   	push   %ebx
+  800bf1:	50                   	push   %eax
+  800bf2:	68 f8 26 80 00       	push   $0x8026f8
+  800bf7:	e8 fa 0b 00 00       	call   8017f6 <cprintf>
+		return -E_INVAL;
+  800bfc:	83 c4 10             	add    $0x10,%esp
+  800bff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c04:	eb d8                	jmp    800bde <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800c06:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c0b:	eb d1                	jmp    800bde <ftruncate+0x50>
+
+00800c0d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800c0d:	55                   	push   %ebp
+  800c0e:	89 e5                	mov    %esp,%ebp
+  800c10:	56                   	push   %esi
+  800c11:	53                   	push   %ebx
+  800c12:	83 ec 18             	sub    $0x18,%esp
+  800c15:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c18:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c1b:	50                   	push   %eax
+  800c1c:	ff 75 08             	push   0x8(%ebp)
+  800c1f:	e8 92 fb ff ff       	call   8007b6 <fd_lookup>
+  800c24:	83 c4 10             	add    $0x10,%esp
+  800c27:	85 c0                	test   %eax,%eax
+  800c29:	78 49                	js     800c74 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c2b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c2e:	83 ec 08             	sub    $0x8,%esp
+  800c31:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c34:	50                   	push   %eax
+  800c35:	ff 36                	push   (%esi)
+  800c37:	e8 ca fb ff ff       	call   800806 <dev_lookup>
+  800c3c:	83 c4 10             	add    $0x10,%esp
+  800c3f:	85 c0                	test   %eax,%eax
+  800c41:	78 31                	js     800c74 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c46:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c4a:	74 2f                	je     800c7b <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c4c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c4f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c56:	00 00 00 
+	stat->st_isdir = 0;
+  800c59:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c60:	00 00 00 
+	stat->st_dev = dev;
+  800c63:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c69:	83 ec 08             	sub    $0x8,%esp
+  800c6c:	53                   	push   %ebx
+  800c6d:	56                   	push   %esi
+  800c6e:	ff 50 14             	call   *0x14(%eax)
+  800c71:	83 c4 10             	add    $0x10,%esp
+}
+  800c74:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c77:	5b                   	pop    %ebx
+  800c78:	5e                   	pop    %esi
+  800c79:	5d                   	pop    %ebp
+  800c7a:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c7b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c80:	eb f2                	jmp    800c74 <fstat+0x67>
+
+00800c82 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c82:	55                   	push   %ebp
+  800c83:	89 e5                	mov    %esp,%ebp
+  800c85:	56                   	push   %esi
+  800c86:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c87:	83 ec 08             	sub    $0x8,%esp
+  800c8a:	6a 00                	push   $0x0
+  800c8c:	ff 75 08             	push   0x8(%ebp)
+  800c8f:	e8 bc 02 00 00       	call   800f50 <open>
+  800c94:	89 c3                	mov    %eax,%ebx
+  800c96:	83 c4 10             	add    $0x10,%esp
+  800c99:	85 c0                	test   %eax,%eax
+  800c9b:	78 1b                	js     800cb8 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c9d:	83 ec 08             	sub    $0x8,%esp
+  800ca0:	ff 75 0c             	push   0xc(%ebp)
+  800ca3:	50                   	push   %eax
+  800ca4:	e8 64 ff ff ff       	call   800c0d <fstat>
+  800ca9:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800cab:	89 1c 24             	mov    %ebx,(%esp)
+  800cae:	e8 26 fc ff ff       	call   8008d9 <close>
+	return r;
+  800cb3:	83 c4 10             	add    $0x10,%esp
+  800cb6:	89 f3                	mov    %esi,%ebx
+}
+  800cb8:	89 d8                	mov    %ebx,%eax
+  800cba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cbd:	5b                   	pop    %ebx
+  800cbe:	5e                   	pop    %esi
+  800cbf:	5d                   	pop    %ebp
+  800cc0:	c3                   	ret
+
+00800cc1 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  800cc1:	55                   	push   %ebp
+  800cc2:	89 e5                	mov    %esp,%ebp
+  800cc4:	57                   	push   %edi
+  800cc5:	56                   	push   %esi
+  800cc6:	53                   	push   %ebx
+  800cc7:	83 ec 0c             	sub    $0xc,%esp
+  800cca:	89 c7                	mov    %eax,%edi
+  800ccc:	89 d3                	mov    %edx,%ebx
+  800cce:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800cd0:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800cd7:	74 2d                	je     800d06 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cd9:	6a 07                	push   $0x7
+  800cdb:	68 00 50 80 00       	push   $0x805000
+  800ce0:	57                   	push   %edi
+  800ce1:	ff 35 00 40 80 00    	push   0x804000
+  800ce7:	e8 3f 16 00 00       	call   80232b <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  800cec:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800cf3:	6a 00                	push   $0x0
+  800cf5:	56                   	push   %esi
+  800cf6:	53                   	push   %ebx
+  800cf7:	6a 00                	push   $0x0
+  800cf9:	e8 df 14 00 00       	call   8021dd <ipc_recv_pages>
+}
+  800cfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d01:	5b                   	pop    %ebx
+  800d02:	5e                   	pop    %esi
+  800d03:	5f                   	pop    %edi
+  800d04:	5d                   	pop    %ebp
+  800d05:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800d06:	83 ec 0c             	sub    $0xc,%esp
+  800d09:	6a 01                	push   $0x1
+  800d0b:	e8 10 17 00 00       	call   802420 <ipc_find_env>
+  800d10:	a3 00 40 80 00       	mov    %eax,0x804000
+  800d15:	83 c4 10             	add    $0x10,%esp
+  800d18:	eb bf                	jmp    800cd9 <fsipc_pages+0x18>
+
+00800d1a <fsipc>:
+{
+  800d1a:	55                   	push   %ebp
+  800d1b:	89 e5                	mov    %esp,%ebp
+  800d1d:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  800d20:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d25:	e8 97 ff ff ff       	call   800cc1 <fsipc_pages>
+}
+  800d2a:	c9                   	leave
+  800d2b:	c3                   	ret
+
+00800d2c <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d2c:	55                   	push   %ebp
+  800d2d:	89 e5                	mov    %esp,%ebp
+  800d2f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d32:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d35:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d38:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800d3d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d40:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800d45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d4f:	e8 c6 ff ff ff       	call   800d1a <fsipc>
+}
+  800d54:	c9                   	leave
+  800d55:	c3                   	ret
+
+00800d56 <devfile_flush>:
+{
+  800d56:	55                   	push   %ebp
+  800d57:	89 e5                	mov    %esp,%ebp
+  800d59:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d5f:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d62:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800d67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d6c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d71:	e8 a4 ff ff ff       	call   800d1a <fsipc>
+}
+  800d76:	c9                   	leave
+  800d77:	c3                   	ret
+
+00800d78 <devfile_stat>:
+{
+  800d78:	55                   	push   %ebp
+  800d79:	89 e5                	mov    %esp,%ebp
+  800d7b:	53                   	push   %ebx
+  800d7c:	83 ec 04             	sub    $0x4,%esp
+  800d7f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d82:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d85:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d88:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800d8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d92:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d97:	e8 7e ff ff ff       	call   800d1a <fsipc>
+  800d9c:	85 c0                	test   %eax,%eax
+  800d9e:	78 2c                	js     800dcc <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800da0:	83 ec 08             	sub    $0x8,%esp
+  800da3:	68 00 50 80 00       	push   $0x805000
+  800da8:	53                   	push   %ebx
+  800da9:	e8 2f 10 00 00       	call   801ddd <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800dae:	a1 80 50 80 00       	mov    0x805080,%eax
+  800db3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800db9:	a1 84 50 80 00       	mov    0x805084,%eax
+  800dbe:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800dc4:	83 c4 10             	add    $0x10,%esp
+  800dc7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dcc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dcf:	c9                   	leave
+  800dd0:	c3                   	ret
+
+00800dd1 <devfile_write>:
+{
+  800dd1:	55                   	push   %ebp
+  800dd2:	89 e5                	mov    %esp,%ebp
+  800dd4:	83 ec 0c             	sub    $0xc,%esp
+  800dd7:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800dda:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800ddf:	39 d0                	cmp    %edx,%eax
+  800de1:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800de4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de7:	8b 52 0c             	mov    0xc(%edx),%edx
+  800dea:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  800df0:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800df5:	50                   	push   %eax
+  800df6:	ff 75 0c             	push   0xc(%ebp)
+  800df9:	68 08 50 80 00       	push   $0x805008
+  800dfe:	e8 60 11 00 00       	call   801f63 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800e03:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e08:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e0d:	e8 08 ff ff ff       	call   800d1a <fsipc>
+}
+  800e12:	c9                   	leave
+  800e13:	c3                   	ret
+
+00800e14 <devfile_read>:
+{
+  800e14:	55                   	push   %ebp
+  800e15:	89 e5                	mov    %esp,%ebp
+  800e17:	57                   	push   %edi
+  800e18:	56                   	push   %esi
+  800e19:	53                   	push   %ebx
+  800e1a:	83 ec 1c             	sub    $0x1c,%esp
+  800e1d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e20:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e23:	89 fe                	mov    %edi,%esi
+  800e25:	c1 ee 0c             	shr    $0xc,%esi
+  800e28:	b8 20 00 00 00       	mov    $0x20,%eax
+  800e2d:	39 c6                	cmp    %eax,%esi
+  800e2f:	0f 47 f0             	cmova  %eax,%esi
+  800e32:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e3a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  800e3d:	eb 14                	jmp    800e53 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e3f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  800e46:	05 00 10 00 00       	add    $0x1000,%eax
+  800e4b:	f6 c6 06             	test   $0x6,%dh
+  800e4e:	75 42                	jne    800e92 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e50:	83 c1 01             	add    $0x1,%ecx
+  800e53:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800e56:	39 f1                	cmp    %esi,%ecx
+  800e58:	0f 84 95 00 00 00    	je     800ef3 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e5e:	89 c2                	mov    %eax,%edx
+  800e60:	c1 ea 16             	shr    $0x16,%edx
+  800e63:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e6a:	f6 c2 01             	test   $0x1,%dl
+  800e6d:	74 23                	je     800e92 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e6f:	89 c2                	mov    %eax,%edx
+  800e71:	c1 ea 0c             	shr    $0xc,%edx
+  800e74:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800e7b:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  800e81:	74 0f                	je     800e92 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  800e83:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800e8a:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  800e90:	75 ad                	jne    800e3f <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  800e92:	85 c9                	test   %ecx,%ecx
+  800e94:	74 11                	je     800ea7 <devfile_read+0x93>
+  800e96:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  800e9d:	75 08                	jne    800ea7 <devfile_read+0x93>
+  800e9f:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  800ea5:	74 50                	je     800ef7 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800ea7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800eaa:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  800eaf:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800eb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eba:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ebf:	e8 56 fe ff ff       	call   800d1a <fsipc>
+  800ec4:	89 c6                	mov    %eax,%esi
+  800ec6:	85 c0                	test   %eax,%eax
+  800ec8:	78 1f                	js     800ee9 <devfile_read+0xd5>
+	assert(r <= n);
+  800eca:	39 c7                	cmp    %eax,%edi
+  800ecc:	72 50                	jb     800f1e <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  800ece:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800ed3:	7f 62                	jg     800f37 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  800ed5:	83 ec 04             	sub    $0x4,%esp
+  800ed8:	50                   	push   %eax
+  800ed9:	68 00 50 80 00       	push   $0x805000
+  800ede:	ff 75 0c             	push   0xc(%ebp)
+  800ee1:	e8 7d 10 00 00       	call   801f63 <memmove>
+	return r;
+  800ee6:	83 c4 10             	add    $0x10,%esp
+}
+  800ee9:	89 f0                	mov    %esi,%eax
+  800eeb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eee:	5b                   	pop    %ebx
+  800eef:	5e                   	pop    %esi
+  800ef0:	5f                   	pop    %edi
+  800ef1:	5d                   	pop    %ebp
+  800ef2:	c3                   	ret
+  800ef3:	89 f1                	mov    %esi,%ecx
+  800ef5:	eb 9b                	jmp    800e92 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  800ef7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800efa:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  800eff:	89 c8                	mov    %ecx,%eax
+  800f01:	c1 e0 0c             	shl    $0xc,%eax
+  800f04:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  800f09:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f0c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f11:	e8 ab fd ff ff       	call   800cc1 <fsipc_pages>
+  800f16:	89 c6                	mov    %eax,%esi
+  800f18:	85 c0                	test   %eax,%eax
+  800f1a:	78 8b                	js     800ea7 <devfile_read+0x93>
+  800f1c:	eb cb                	jmp    800ee9 <devfile_read+0xd5>
+	assert(r <= n);
+  800f1e:	68 64 27 80 00       	push   $0x802764
+  800f23:	68 6b 27 80 00       	push   $0x80276b
+  800f28:	68 a0 00 00 00       	push   $0xa0
+  800f2d:	68 80 27 80 00       	push   $0x802780
+  800f32:	e8 e4 07 00 00       	call   80171b <_panic>
+	assert(r <= PGSIZE);
+  800f37:	68 8b 27 80 00       	push   $0x80278b
+  800f3c:	68 6b 27 80 00       	push   $0x80276b
+  800f41:	68 a1 00 00 00       	push   $0xa1
+  800f46:	68 80 27 80 00       	push   $0x802780
+  800f4b:	e8 cb 07 00 00       	call   80171b <_panic>
+
+00800f50 <open>:
+{
+  800f50:	55                   	push   %ebp
+  800f51:	89 e5                	mov    %esp,%ebp
+  800f53:	56                   	push   %esi
+  800f54:	53                   	push   %ebx
+  800f55:	83 ec 1c             	sub    $0x1c,%esp
+  800f58:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800f5b:	56                   	push   %esi
+  800f5c:	e8 41 0e 00 00       	call   801da2 <strlen>
+  800f61:	83 c4 10             	add    $0x10,%esp
+  800f64:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f69:	7f 6c                	jg     800fd7 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800f6b:	83 ec 0c             	sub    $0xc,%esp
+  800f6e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f71:	50                   	push   %eax
+  800f72:	e8 eb f7 ff ff       	call   800762 <fd_alloc>
+  800f77:	89 c3                	mov    %eax,%ebx
+  800f79:	83 c4 10             	add    $0x10,%esp
+  800f7c:	85 c0                	test   %eax,%eax
+  800f7e:	78 3c                	js     800fbc <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800f80:	83 ec 08             	sub    $0x8,%esp
+  800f83:	56                   	push   %esi
+  800f84:	68 00 50 80 00       	push   $0x805000
+  800f89:	e8 4f 0e 00 00       	call   801ddd <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800f8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f91:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800f96:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800f99:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f9e:	e8 77 fd ff ff       	call   800d1a <fsipc>
+  800fa3:	89 c3                	mov    %eax,%ebx
+  800fa5:	83 c4 10             	add    $0x10,%esp
+  800fa8:	85 c0                	test   %eax,%eax
+  800faa:	78 19                	js     800fc5 <open+0x75>
+	return fd2num(fd);
+  800fac:	83 ec 0c             	sub    $0xc,%esp
+  800faf:	ff 75 f4             	push   -0xc(%ebp)
+  800fb2:	e8 84 f7 ff ff       	call   80073b <fd2num>
+  800fb7:	89 c3                	mov    %eax,%ebx
+  800fb9:	83 c4 10             	add    $0x10,%esp
+}
+  800fbc:	89 d8                	mov    %ebx,%eax
+  800fbe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fc1:	5b                   	pop    %ebx
+  800fc2:	5e                   	pop    %esi
+  800fc3:	5d                   	pop    %ebp
+  800fc4:	c3                   	ret
+		fd_close(fd, 0);
+  800fc5:	83 ec 08             	sub    $0x8,%esp
+  800fc8:	6a 00                	push   $0x0
+  800fca:	ff 75 f4             	push   -0xc(%ebp)
+  800fcd:	e8 80 f8 ff ff       	call   800852 <fd_close>
+		return r;
+  800fd2:	83 c4 10             	add    $0x10,%esp
+  800fd5:	eb e5                	jmp    800fbc <open+0x6c>
+		return -E_BAD_PATH;
+  800fd7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800fdc:	eb de                	jmp    800fbc <open+0x6c>
+
+00800fde <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800fde:	55                   	push   %ebp
+  800fdf:	89 e5                	mov    %esp,%ebp
+  800fe1:	53                   	push   %ebx
+  800fe2:	83 ec 10             	sub    $0x10,%esp
+  800fe5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  800fe8:	53                   	push   %ebx
+  800fe9:	e8 b4 0d 00 00       	call   801da2 <strlen>
+  800fee:	83 c4 10             	add    $0x10,%esp
+  800ff1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800ff6:	7f 25                	jg     80101d <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  800ff8:	83 ec 08             	sub    $0x8,%esp
+  800ffb:	53                   	push   %ebx
+  800ffc:	68 00 50 80 00       	push   $0x805000
+  801001:	e8 d7 0d 00 00       	call   801ddd <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801006:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801010:	e8 05 fd ff ff       	call   800d1a <fsipc>
+  801015:	83 c4 10             	add    $0x10,%esp
+}
+  801018:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80101b:	c9                   	leave
+  80101c:	c3                   	ret
+		return -E_BAD_PATH;
+  80101d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801022:	eb f4                	jmp    801018 <remove+0x3a>
+
+00801024 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801024:	55                   	push   %ebp
+  801025:	89 e5                	mov    %esp,%ebp
+  801027:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80102a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801034:	e8 e1 fc ff ff       	call   800d1a <fsipc>
+}
+  801039:	c9                   	leave
+  80103a:	c3                   	ret
+
+0080103b <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  80103b:	55                   	push   %ebp
+  80103c:	89 e5                	mov    %esp,%ebp
+  80103e:	53                   	push   %ebx
+  80103f:	83 ec 04             	sub    $0x4,%esp
+  801042:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801045:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80104f:	e8 c6 fc ff ff       	call   800d1a <fsipc>
+  801054:	85 c0                	test   %eax,%eax
+  801056:	78 3c                	js     801094 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801058:	a1 00 50 80 00       	mov    0x805000,%eax
+  80105d:	89 03                	mov    %eax,(%ebx)
+  80105f:	a1 04 50 80 00       	mov    0x805004,%eax
+  801064:	89 43 04             	mov    %eax,0x4(%ebx)
+  801067:	a1 08 50 80 00       	mov    0x805008,%eax
+  80106c:	89 43 08             	mov    %eax,0x8(%ebx)
+  80106f:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801074:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801077:	a1 10 50 80 00       	mov    0x805010,%eax
+  80107c:	89 43 10             	mov    %eax,0x10(%ebx)
+  80107f:	a1 14 50 80 00       	mov    0x805014,%eax
+  801084:	89 43 14             	mov    %eax,0x14(%ebx)
+  801087:	a1 18 50 80 00       	mov    0x805018,%eax
+  80108c:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  80108f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801094:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801097:	c9                   	leave
+  801098:	c3                   	ret
+
+00801099 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801099:	55                   	push   %ebp
+  80109a:	89 e5                	mov    %esp,%ebp
+  80109c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  80109f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010a2:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  8010a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ac:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010b1:	e8 64 fc ff ff       	call   800d1a <fsipc>
+}
+  8010b6:	c9                   	leave
+  8010b7:	c3                   	ret
+
+008010b8 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8010b8:	55                   	push   %ebp
+  8010b9:	89 e5                	mov    %esp,%ebp
+  8010bb:	56                   	push   %esi
+  8010bc:	53                   	push   %ebx
+  8010bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8010c0:	83 ec 0c             	sub    $0xc,%esp
+  8010c3:	ff 75 08             	push   0x8(%ebp)
+  8010c6:	e8 80 f6 ff ff       	call   80074b <fd2data>
+  8010cb:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8010cd:	83 c4 08             	add    $0x8,%esp
+  8010d0:	68 97 27 80 00       	push   $0x802797
+  8010d5:	53                   	push   %ebx
+  8010d6:	e8 02 0d 00 00       	call   801ddd <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8010db:	8b 46 04             	mov    0x4(%esi),%eax
+  8010de:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8010e4:	2b 0e                	sub    (%esi),%ecx
+  8010e6:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8010eb:	89 c8                	mov    %ecx,%eax
+  8010ed:	f7 e2                	mul    %edx
+  8010ef:	c1 ea 0c             	shr    $0xc,%edx
+  8010f2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8010f8:	29 d1                	sub    %edx,%ecx
+  8010fa:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801100:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801107:	00 00 00 
+	stat->st_dev = &devpipe;
+  80110a:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  801111:	30 80 00 
+	return 0;
+}
+  801114:	b8 00 00 00 00       	mov    $0x0,%eax
+  801119:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80111c:	5b                   	pop    %ebx
+  80111d:	5e                   	pop    %esi
+  80111e:	5d                   	pop    %ebp
+  80111f:	c3                   	ret
+
+00801120 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801120:	55                   	push   %ebp
+  801121:	89 e5                	mov    %esp,%ebp
+  801123:	53                   	push   %ebx
+  801124:	83 ec 0c             	sub    $0xc,%esp
+  801127:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80112a:	53                   	push   %ebx
+  80112b:	6a 00                	push   $0x0
+  80112d:	e8 f3 f0 ff ff       	call   800225 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801132:	89 1c 24             	mov    %ebx,(%esp)
+  801135:	e8 11 f6 ff ff       	call   80074b <fd2data>
+  80113a:	83 c4 08             	add    $0x8,%esp
+  80113d:	50                   	push   %eax
+  80113e:	6a 00                	push   $0x0
+  801140:	e8 e0 f0 ff ff       	call   800225 <sys_page_unmap>
+}
+  801145:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801148:	c9                   	leave
+  801149:	c3                   	ret
+
+0080114a <_pipeisclosed>:
+{
+  80114a:	55                   	push   %ebp
+  80114b:	89 e5                	mov    %esp,%ebp
+  80114d:	57                   	push   %edi
+  80114e:	56                   	push   %esi
+  80114f:	53                   	push   %ebx
+  801150:	83 ec 1c             	sub    $0x1c,%esp
+  801153:	89 c7                	mov    %eax,%edi
+  801155:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801157:	a1 08 40 80 00       	mov    0x804008,%eax
+  80115c:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80115f:	83 ec 0c             	sub    $0xc,%esp
+  801162:	57                   	push   %edi
+  801163:	e8 f7 12 00 00       	call   80245f <pageref>
+  801168:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80116b:	89 34 24             	mov    %esi,(%esp)
+  80116e:	e8 ec 12 00 00       	call   80245f <pageref>
+		nn = thisenv->env_runs;
+  801173:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801179:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80117c:	83 c4 10             	add    $0x10,%esp
+  80117f:	39 cb                	cmp    %ecx,%ebx
+  801181:	74 1b                	je     80119e <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801183:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801186:	75 cf                	jne    801157 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801188:	8b 42 58             	mov    0x58(%edx),%eax
+  80118b:	6a 01                	push   $0x1
+  80118d:	50                   	push   %eax
+  80118e:	53                   	push   %ebx
+  80118f:	68 9e 27 80 00       	push   $0x80279e
+  801194:	e8 5d 06 00 00       	call   8017f6 <cprintf>
+  801199:	83 c4 10             	add    $0x10,%esp
+  80119c:	eb b9                	jmp    801157 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80119e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8011a1:	0f 94 c0             	sete   %al
+  8011a4:	0f b6 c0             	movzbl %al,%eax
+}
+  8011a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011aa:	5b                   	pop    %ebx
+  8011ab:	5e                   	pop    %esi
+  8011ac:	5f                   	pop    %edi
+  8011ad:	5d                   	pop    %ebp
+  8011ae:	c3                   	ret
+
+008011af <devpipe_read>:
+{
+  8011af:	55                   	push   %ebp
+  8011b0:	89 e5                	mov    %esp,%ebp
+  8011b2:	57                   	push   %edi
+  8011b3:	56                   	push   %esi
+  8011b4:	53                   	push   %ebx
+  8011b5:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8011b8:	ff 75 08             	push   0x8(%ebp)
+  8011bb:	e8 8b f5 ff ff       	call   80074b <fd2data>
+  8011c0:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8011c2:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8011c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8011c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8011cb:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8011ce:	8b 0b                	mov    (%ebx),%ecx
+  8011d0:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8011d6:	29 ce                	sub    %ecx,%esi
+  8011d8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8011dd:	f7 e6                	mul    %esi
+  8011df:	c1 ea 0c             	shr    $0xc,%edx
+  8011e2:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8011e8:	29 c6                	sub    %eax,%esi
+  8011ea:	89 f2                	mov    %esi,%edx
+  8011ec:	75 43                	jne    801231 <devpipe_read+0x82>
+		ref = pageref(p);
+  8011ee:	83 ec 0c             	sub    $0xc,%esp
+  8011f1:	53                   	push   %ebx
+  8011f2:	e8 68 12 00 00       	call   80245f <pageref>
+  8011f7:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8011f9:	89 da                	mov    %ebx,%edx
+  8011fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011fe:	e8 47 ff ff ff       	call   80114a <_pipeisclosed>
+  801203:	83 c4 10             	add    $0x10,%esp
+  801206:	85 c0                	test   %eax,%eax
+  801208:	0f 85 c1 00 00 00    	jne    8012cf <devpipe_read+0x120>
+	*sleeping = 1;
+  80120e:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801215:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80121a:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  80121d:	75 ac                	jne    8011cb <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  80121f:	83 ec 04             	sub    $0x4,%esp
+  801222:	56                   	push   %esi
+  801223:	57                   	push   %edi
+  801224:	ff 75 e4             	push   -0x1c(%ebp)
+  801227:	e8 4d f4 ff ff       	call   800679 <sys_futex_wait>
+  80122c:	83 c4 10             	add    $0x10,%esp
+  80122f:	eb 9a                	jmp    8011cb <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801231:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801234:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801238:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80123a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80123f:	f7 e1                	mul    %ecx
+  801241:	c1 ea 0b             	shr    $0xb,%edx
+  801244:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80124a:	29 c1                	sub    %eax,%ecx
+  80124c:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  80124e:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801253:	29 cf                	sub    %ecx,%edi
+  801255:	39 f7                	cmp    %esi,%edi
+  801257:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  80125a:	8d 43 10             	lea    0x10(%ebx),%eax
+  80125d:	83 ec 04             	sub    $0x4,%esp
+  801260:	57                   	push   %edi
+  801261:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801264:	01 c2                	add    %eax,%edx
+  801266:	52                   	push   %edx
+  801267:	ff 75 0c             	push   0xc(%ebp)
+  80126a:	e8 f4 0c 00 00       	call   801f63 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  80126f:	83 c4 0c             	add    $0xc,%esp
+  801272:	89 f1                	mov    %esi,%ecx
+  801274:	29 f9                	sub    %edi,%ecx
+  801276:	51                   	push   %ecx
+  801277:	ff 75 e4             	push   -0x1c(%ebp)
+  80127a:	89 f8                	mov    %edi,%eax
+  80127c:	03 45 0c             	add    0xc(%ebp),%eax
+  80127f:	50                   	push   %eax
+  801280:	e8 de 0c 00 00       	call   801f63 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801285:	89 f1                	mov    %esi,%ecx
+  801287:	03 0b                	add    (%ebx),%ecx
+  801289:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80128e:	f7 e1                	mul    %ecx
+  801290:	c1 ea 0c             	shr    $0xc,%edx
+  801293:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801299:	29 d1                	sub    %edx,%ecx
+  80129b:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  80129d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8012a2:	83 c4 10             	add    $0x10,%esp
+  8012a5:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  8012a9:	75 0a                	jne    8012b5 <devpipe_read+0x106>
+	return n;
+  8012ab:	89 f0                	mov    %esi,%eax
+}
+  8012ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b0:	5b                   	pop    %ebx
+  8012b1:	5e                   	pop    %esi
+  8012b2:	5f                   	pop    %edi
+  8012b3:	5d                   	pop    %ebp
+  8012b4:	c3                   	ret
+		*sleeping = 0;
+  8012b5:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8012bc:	83 ec 08             	sub    $0x8,%esp
+  8012bf:	68 00 04 00 00       	push   $0x400
+  8012c4:	53                   	push   %ebx
+  8012c5:	e8 ff f3 ff ff       	call   8006c9 <sys_futex_wake>
+  8012ca:	83 c4 10             	add    $0x10,%esp
+  8012cd:	eb dc                	jmp    8012ab <devpipe_read+0xfc>
+			return 0;
+  8012cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d4:	eb d7                	jmp    8012ad <devpipe_read+0xfe>
+
+008012d6 <devpipe_write>:
+{
+  8012d6:	55                   	push   %ebp
+  8012d7:	89 e5                	mov    %esp,%ebp
+  8012d9:	57                   	push   %edi
+  8012da:	56                   	push   %esi
+  8012db:	53                   	push   %ebx
+  8012dc:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8012df:	ff 75 08             	push   0x8(%ebp)
+  8012e2:	e8 64 f4 ff ff       	call   80074b <fd2data>
+  8012e7:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8012e9:	83 c4 10             	add    $0x10,%esp
+  8012ec:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8012f3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8012f6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8012f9:	0f 83 23 01 00 00    	jae    801422 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8012ff:	8b 77 04             	mov    0x4(%edi),%esi
+  801302:	8b 1f                	mov    (%edi),%ebx
+  801304:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  80130a:	29 d9                	sub    %ebx,%ecx
+  80130c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801311:	f7 e1                	mul    %ecx
+  801313:	c1 ea 0c             	shr    $0xc,%edx
+  801316:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80131c:	29 c1                	sub    %eax,%ecx
+  80131e:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801320:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801326:	75 40                	jne    801368 <devpipe_write+0x92>
+			ref = pageref(p);
+  801328:	83 ec 0c             	sub    $0xc,%esp
+  80132b:	57                   	push   %edi
+  80132c:	e8 2e 11 00 00       	call   80245f <pageref>
+  801331:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801333:	89 fa                	mov    %edi,%edx
+  801335:	8b 45 08             	mov    0x8(%ebp),%eax
+  801338:	e8 0d fe ff ff       	call   80114a <_pipeisclosed>
+  80133d:	83 c4 10             	add    $0x10,%esp
+  801340:	85 c0                	test   %eax,%eax
+  801342:	0f 85 d5 00 00 00    	jne    80141d <devpipe_write+0x147>
+	*sleeping = 1;
+  801348:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  80134f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801354:	39 1f                	cmp    %ebx,(%edi)
+  801356:	75 a7                	jne    8012ff <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801358:	83 ec 04             	sub    $0x4,%esp
+  80135b:	56                   	push   %esi
+  80135c:	53                   	push   %ebx
+  80135d:	57                   	push   %edi
+  80135e:	e8 16 f3 ff ff       	call   800679 <sys_futex_wait>
+  801363:	83 c4 10             	add    $0x10,%esp
+  801366:	eb 97                	jmp    8012ff <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801368:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80136b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80136e:	29 c1                	sub    %eax,%ecx
+  801370:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801375:	89 d8                	mov    %ebx,%eax
+  801377:	29 d0                	sub    %edx,%eax
+  801379:	39 c1                	cmp    %eax,%ecx
+  80137b:	0f 46 c1             	cmovbe %ecx,%eax
+  80137e:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801380:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801385:	f7 e6                	mul    %esi
+  801387:	c1 ea 0b             	shr    $0xb,%edx
+  80138a:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801390:	29 c6                	sub    %eax,%esi
+  801392:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801394:	29 f3                	sub    %esi,%ebx
+  801396:	39 cb                	cmp    %ecx,%ebx
+  801398:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80139b:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  80139e:	8d 77 10             	lea    0x10(%edi),%esi
+  8013a1:	83 ec 04             	sub    $0x4,%esp
+  8013a4:	53                   	push   %ebx
+  8013a5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8013a8:	03 45 0c             	add    0xc(%ebp),%eax
+  8013ab:	50                   	push   %eax
+  8013ac:	01 f2                	add    %esi,%edx
+  8013ae:	52                   	push   %edx
+  8013af:	e8 af 0b 00 00       	call   801f63 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8013b4:	83 c4 0c             	add    $0xc,%esp
+  8013b7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013ba:	29 d8                	sub    %ebx,%eax
+  8013bc:	50                   	push   %eax
+  8013bd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8013c0:	01 d3                	add    %edx,%ebx
+  8013c2:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8013c5:	53                   	push   %ebx
+  8013c6:	56                   	push   %esi
+  8013c7:	e8 97 0b 00 00       	call   801f63 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8013cc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8013cf:	03 4f 04             	add    0x4(%edi),%ecx
+  8013d2:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8013d7:	f7 e1                	mul    %ecx
+  8013d9:	c1 ea 0c             	shr    $0xc,%edx
+  8013dc:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8013e2:	29 d1                	sub    %edx,%ecx
+  8013e4:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8013e7:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8013ec:	83 c4 10             	add    $0x10,%esp
+  8013ef:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8013f3:	75 0b                	jne    801400 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8013f5:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8013f8:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8013fb:	e9 f3 fe ff ff       	jmp    8012f3 <devpipe_write+0x1d>
+		*sleeping = 0;
+  801400:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  801407:	83 ec 08             	sub    $0x8,%esp
+  80140a:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  80140f:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  801412:	50                   	push   %eax
+  801413:	e8 b1 f2 ff ff       	call   8006c9 <sys_futex_wake>
+  801418:	83 c4 10             	add    $0x10,%esp
+  80141b:	eb d8                	jmp    8013f5 <devpipe_write+0x11f>
+				return 0;
+  80141d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801422:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801425:	5b                   	pop    %ebx
+  801426:	5e                   	pop    %esi
+  801427:	5f                   	pop    %edi
+  801428:	5d                   	pop    %ebp
+  801429:	c3                   	ret
+
+0080142a <pipe>:
+{
+  80142a:	55                   	push   %ebp
+  80142b:	89 e5                	mov    %esp,%ebp
+  80142d:	56                   	push   %esi
+  80142e:	53                   	push   %ebx
+  80142f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801432:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801435:	50                   	push   %eax
+  801436:	e8 27 f3 ff ff       	call   800762 <fd_alloc>
+  80143b:	89 c3                	mov    %eax,%ebx
+  80143d:	83 c4 10             	add    $0x10,%esp
+  801440:	85 c0                	test   %eax,%eax
+  801442:	0f 88 23 01 00 00    	js     80156b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801448:	83 ec 04             	sub    $0x4,%esp
+  80144b:	68 07 04 00 00       	push   $0x407
+  801450:	ff 75 f4             	push   -0xc(%ebp)
+  801453:	6a 00                	push   $0x0
+  801455:	e8 46 ed ff ff       	call   8001a0 <sys_page_alloc>
+  80145a:	89 c3                	mov    %eax,%ebx
+  80145c:	83 c4 10             	add    $0x10,%esp
+  80145f:	85 c0                	test   %eax,%eax
+  801461:	0f 88 04 01 00 00    	js     80156b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801467:	83 ec 0c             	sub    $0xc,%esp
+  80146a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80146d:	50                   	push   %eax
+  80146e:	e8 ef f2 ff ff       	call   800762 <fd_alloc>
+  801473:	89 c3                	mov    %eax,%ebx
+  801475:	83 c4 10             	add    $0x10,%esp
+  801478:	85 c0                	test   %eax,%eax
+  80147a:	0f 88 db 00 00 00    	js     80155b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801480:	83 ec 04             	sub    $0x4,%esp
+  801483:	68 07 04 00 00       	push   $0x407
+  801488:	ff 75 f0             	push   -0x10(%ebp)
+  80148b:	6a 00                	push   $0x0
+  80148d:	e8 0e ed ff ff       	call   8001a0 <sys_page_alloc>
+  801492:	89 c3                	mov    %eax,%ebx
+  801494:	83 c4 10             	add    $0x10,%esp
+  801497:	85 c0                	test   %eax,%eax
+  801499:	0f 88 bc 00 00 00    	js     80155b <pipe+0x131>
+	va = fd2data(fd0);
+  80149f:	83 ec 0c             	sub    $0xc,%esp
+  8014a2:	ff 75 f4             	push   -0xc(%ebp)
+  8014a5:	e8 a1 f2 ff ff       	call   80074b <fd2data>
+  8014aa:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014ac:	83 c4 0c             	add    $0xc,%esp
+  8014af:	68 07 04 00 00       	push   $0x407
+  8014b4:	50                   	push   %eax
+  8014b5:	6a 00                	push   $0x0
+  8014b7:	e8 e4 ec ff ff       	call   8001a0 <sys_page_alloc>
+  8014bc:	89 c3                	mov    %eax,%ebx
+  8014be:	83 c4 10             	add    $0x10,%esp
+  8014c1:	85 c0                	test   %eax,%eax
+  8014c3:	0f 88 82 00 00 00    	js     80154b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014c9:	83 ec 0c             	sub    $0xc,%esp
+  8014cc:	ff 75 f0             	push   -0x10(%ebp)
+  8014cf:	e8 77 f2 ff ff       	call   80074b <fd2data>
+  8014d4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8014db:	50                   	push   %eax
+  8014dc:	6a 00                	push   $0x0
+  8014de:	56                   	push   %esi
+  8014df:	6a 00                	push   $0x0
+  8014e1:	e8 fd ec ff ff       	call   8001e3 <sys_page_map>
+  8014e6:	89 c3                	mov    %eax,%ebx
+  8014e8:	83 c4 20             	add    $0x20,%esp
+  8014eb:	85 c0                	test   %eax,%eax
+  8014ed:	78 4e                	js     80153d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8014ef:	a1 20 30 80 00       	mov    0x803020,%eax
+  8014f4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014f7:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8014f9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014fc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801503:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801506:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801508:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80150b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801512:	83 ec 0c             	sub    $0xc,%esp
+  801515:	ff 75 f4             	push   -0xc(%ebp)
+  801518:	e8 1e f2 ff ff       	call   80073b <fd2num>
+  80151d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801520:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801522:	83 c4 04             	add    $0x4,%esp
+  801525:	ff 75 f0             	push   -0x10(%ebp)
+  801528:	e8 0e f2 ff ff       	call   80073b <fd2num>
+  80152d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801530:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801533:	83 c4 10             	add    $0x10,%esp
+  801536:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80153b:	eb 2e                	jmp    80156b <pipe+0x141>
+	sys_page_unmap(0, va);
+  80153d:	83 ec 08             	sub    $0x8,%esp
+  801540:	56                   	push   %esi
+  801541:	6a 00                	push   $0x0
+  801543:	e8 dd ec ff ff       	call   800225 <sys_page_unmap>
+  801548:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80154b:	83 ec 08             	sub    $0x8,%esp
+  80154e:	ff 75 f0             	push   -0x10(%ebp)
+  801551:	6a 00                	push   $0x0
+  801553:	e8 cd ec ff ff       	call   800225 <sys_page_unmap>
+  801558:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80155b:	83 ec 08             	sub    $0x8,%esp
+  80155e:	ff 75 f4             	push   -0xc(%ebp)
+  801561:	6a 00                	push   $0x0
+  801563:	e8 bd ec ff ff       	call   800225 <sys_page_unmap>
+  801568:	83 c4 10             	add    $0x10,%esp
+}
+  80156b:	89 d8                	mov    %ebx,%eax
+  80156d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801570:	5b                   	pop    %ebx
+  801571:	5e                   	pop    %esi
+  801572:	5d                   	pop    %ebp
+  801573:	c3                   	ret
+
+00801574 <pipeisclosed>:
+{
+  801574:	55                   	push   %ebp
+  801575:	89 e5                	mov    %esp,%ebp
+  801577:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80157a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80157d:	50                   	push   %eax
+  80157e:	ff 75 08             	push   0x8(%ebp)
+  801581:	e8 30 f2 ff ff       	call   8007b6 <fd_lookup>
+  801586:	83 c4 10             	add    $0x10,%esp
+  801589:	85 c0                	test   %eax,%eax
+  80158b:	78 18                	js     8015a5 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80158d:	83 ec 0c             	sub    $0xc,%esp
+  801590:	ff 75 f4             	push   -0xc(%ebp)
+  801593:	e8 b3 f1 ff ff       	call   80074b <fd2data>
+  801598:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80159a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80159d:	e8 a8 fb ff ff       	call   80114a <_pipeisclosed>
+  8015a2:	83 c4 10             	add    $0x10,%esp
+}
+  8015a5:	c9                   	leave
+  8015a6:	c3                   	ret
+
+008015a7 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8015a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ac:	c3                   	ret
+
+008015ad <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015ad:	55                   	push   %ebp
+  8015ae:	89 e5                	mov    %esp,%ebp
+  8015b0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8015b3:	68 b6 27 80 00       	push   $0x8027b6
+  8015b8:	ff 75 0c             	push   0xc(%ebp)
+  8015bb:	e8 1d 08 00 00       	call   801ddd <strcpy>
+	return 0;
+}
+  8015c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c5:	c9                   	leave
+  8015c6:	c3                   	ret
+
+008015c7 <devcons_write>:
+{
+  8015c7:	55                   	push   %ebp
+  8015c8:	89 e5                	mov    %esp,%ebp
+  8015ca:	57                   	push   %edi
+  8015cb:	56                   	push   %esi
+  8015cc:	53                   	push   %ebx
+  8015cd:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8015d3:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8015d8:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8015de:	eb 2e                	jmp    80160e <devcons_write+0x47>
+		m = n - tot;
+  8015e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e3:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8015e5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8015ea:	39 c3                	cmp    %eax,%ebx
+  8015ec:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8015ef:	83 ec 04             	sub    $0x4,%esp
+  8015f2:	53                   	push   %ebx
+  8015f3:	89 f0                	mov    %esi,%eax
+  8015f5:	03 45 0c             	add    0xc(%ebp),%eax
+  8015f8:	50                   	push   %eax
+  8015f9:	57                   	push   %edi
+  8015fa:	e8 64 09 00 00       	call   801f63 <memmove>
+		sys_cputs(buf, m);
+  8015ff:	83 c4 08             	add    $0x8,%esp
+  801602:	53                   	push   %ebx
+  801603:	57                   	push   %edi
+  801604:	e8 ca ea ff ff       	call   8000d3 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801609:	01 de                	add    %ebx,%esi
+  80160b:	83 c4 10             	add    $0x10,%esp
+  80160e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801611:	72 cd                	jb     8015e0 <devcons_write+0x19>
+}
+  801613:	89 f0                	mov    %esi,%eax
+  801615:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801618:	5b                   	pop    %ebx
+  801619:	5e                   	pop    %esi
+  80161a:	5f                   	pop    %edi
+  80161b:	5d                   	pop    %ebp
+  80161c:	c3                   	ret
+
+0080161d <devcons_read>:
+{
+  80161d:	55                   	push   %ebp
+  80161e:	89 e5                	mov    %esp,%ebp
+  801620:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801623:	b8 00 00 00 00       	mov    $0x0,%eax
+  801628:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80162c:	75 07                	jne    801635 <devcons_read+0x18>
+  80162e:	eb 1f                	jmp    80164f <devcons_read+0x32>
+		sys_yield();
+  801630:	e8 4c eb ff ff       	call   800181 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801635:	e8 c8 ea ff ff       	call   800102 <sys_cgetc>
+  80163a:	85 c0                	test   %eax,%eax
+  80163c:	74 f2                	je     801630 <devcons_read+0x13>
+	if (c < 0)
+  80163e:	78 0f                	js     80164f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801640:	83 f8 04             	cmp    $0x4,%eax
+  801643:	74 0c                	je     801651 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801645:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801648:	88 02                	mov    %al,(%edx)
+	return 1;
+  80164a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80164f:	c9                   	leave
+  801650:	c3                   	ret
+		return 0;
+  801651:	b8 00 00 00 00       	mov    $0x0,%eax
+  801656:	eb f7                	jmp    80164f <devcons_read+0x32>
+
+00801658 <cputchar>:
+{
+  801658:	55                   	push   %ebp
+  801659:	89 e5                	mov    %esp,%ebp
+  80165b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80165e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801661:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801664:	6a 01                	push   $0x1
+  801666:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801669:	50                   	push   %eax
+  80166a:	e8 64 ea ff ff       	call   8000d3 <sys_cputs>
+}
+  80166f:	83 c4 10             	add    $0x10,%esp
+  801672:	c9                   	leave
+  801673:	c3                   	ret
+
+00801674 <getchar>:
+{
+  801674:	55                   	push   %ebp
+  801675:	89 e5                	mov    %esp,%ebp
+  801677:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80167a:	6a 01                	push   $0x1
+  80167c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80167f:	50                   	push   %eax
+  801680:	6a 00                	push   $0x0
+  801682:	e8 8e f3 ff ff       	call   800a15 <read>
+	if (r < 0)
+  801687:	83 c4 10             	add    $0x10,%esp
+  80168a:	85 c0                	test   %eax,%eax
+  80168c:	78 06                	js     801694 <getchar+0x20>
+	if (r < 1)
+  80168e:	74 06                	je     801696 <getchar+0x22>
+	return c;
+  801690:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801694:	c9                   	leave
+  801695:	c3                   	ret
+		return -E_EOF;
+  801696:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80169b:	eb f7                	jmp    801694 <getchar+0x20>
+
+0080169d <iscons>:
+{
+  80169d:	55                   	push   %ebp
+  80169e:	89 e5                	mov    %esp,%ebp
+  8016a0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016a6:	50                   	push   %eax
+  8016a7:	ff 75 08             	push   0x8(%ebp)
+  8016aa:	e8 07 f1 ff ff       	call   8007b6 <fd_lookup>
+  8016af:	83 c4 10             	add    $0x10,%esp
+  8016b2:	85 c0                	test   %eax,%eax
+  8016b4:	78 11                	js     8016c7 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8016b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b9:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  8016bf:	39 10                	cmp    %edx,(%eax)
+  8016c1:	0f 94 c0             	sete   %al
+  8016c4:	0f b6 c0             	movzbl %al,%eax
+}
+  8016c7:	c9                   	leave
+  8016c8:	c3                   	ret
+
+008016c9 <opencons>:
+{
+  8016c9:	55                   	push   %ebp
+  8016ca:	89 e5                	mov    %esp,%ebp
+  8016cc:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8016cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d2:	50                   	push   %eax
+  8016d3:	e8 8a f0 ff ff       	call   800762 <fd_alloc>
+  8016d8:	83 c4 10             	add    $0x10,%esp
+  8016db:	85 c0                	test   %eax,%eax
+  8016dd:	78 3a                	js     801719 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8016df:	83 ec 04             	sub    $0x4,%esp
+  8016e2:	68 07 04 00 00       	push   $0x407
+  8016e7:	ff 75 f4             	push   -0xc(%ebp)
+  8016ea:	6a 00                	push   $0x0
+  8016ec:	e8 af ea ff ff       	call   8001a0 <sys_page_alloc>
+  8016f1:	83 c4 10             	add    $0x10,%esp
+  8016f4:	85 c0                	test   %eax,%eax
+  8016f6:	78 21                	js     801719 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8016f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016fb:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  801701:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801703:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801706:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80170d:	83 ec 0c             	sub    $0xc,%esp
+  801710:	50                   	push   %eax
+  801711:	e8 25 f0 ff ff       	call   80073b <fd2num>
+  801716:	83 c4 10             	add    $0x10,%esp
+}
+  801719:	c9                   	leave
+  80171a:	c3                   	ret
+
+0080171b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80171b:	55                   	push   %ebp
+  80171c:	89 e5                	mov    %esp,%ebp
+  80171e:	56                   	push   %esi
+  80171f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801720:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801723:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801729:	e8 34 ea ff ff       	call   800162 <sys_getenvid>
+  80172e:	83 ec 0c             	sub    $0xc,%esp
+  801731:	ff 75 0c             	push   0xc(%ebp)
+  801734:	ff 75 08             	push   0x8(%ebp)
+  801737:	56                   	push   %esi
+  801738:	50                   	push   %eax
+  801739:	68 c4 27 80 00       	push   $0x8027c4
+  80173e:	e8 b3 00 00 00       	call   8017f6 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801743:	83 c4 18             	add    $0x18,%esp
+  801746:	53                   	push   %ebx
+  801747:	ff 75 10             	push   0x10(%ebp)
+  80174a:	e8 56 00 00 00       	call   8017a5 <vcprintf>
+	cprintf("\n");
+  80174f:	c7 04 24 af 27 80 00 	movl   $0x8027af,(%esp)
+  801756:	e8 9b 00 00 00       	call   8017f6 <cprintf>
+  80175b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80175e:	cc                   	int3
+	while (1)
+  80175f:	eb fd                	jmp    80175e <_panic+0x43>
+
+00801761 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801761:	55                   	push   %ebp
+  801762:	89 e5                	mov    %esp,%ebp
+  801764:	53                   	push   %ebx
+  801765:	83 ec 04             	sub    $0x4,%esp
+  801768:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80176b:	8b 13                	mov    (%ebx),%edx
+  80176d:	8d 42 01             	lea    0x1(%edx),%eax
+  801770:	89 03                	mov    %eax,(%ebx)
+  801772:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801775:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801779:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80177e:	74 09                	je     801789 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  801780:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801784:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801787:	c9                   	leave
+  801788:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  801789:	83 ec 08             	sub    $0x8,%esp
+  80178c:	68 ff 00 00 00       	push   $0xff
+  801791:	8d 43 08             	lea    0x8(%ebx),%eax
+  801794:	50                   	push   %eax
+  801795:	e8 39 e9 ff ff       	call   8000d3 <sys_cputs>
+		b->idx = 0;
+  80179a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8017a0:	83 c4 10             	add    $0x10,%esp
+  8017a3:	eb db                	jmp    801780 <putch+0x1f>
+
+008017a5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8017a5:	55                   	push   %ebp
+  8017a6:	89 e5                	mov    %esp,%ebp
+  8017a8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8017ae:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017b5:	00 00 00 
+	b.cnt = 0;
+  8017b8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8017bf:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8017c2:	ff 75 0c             	push   0xc(%ebp)
+  8017c5:	ff 75 08             	push   0x8(%ebp)
+  8017c8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8017ce:	50                   	push   %eax
+  8017cf:	68 61 17 80 00       	push   $0x801761
+  8017d4:	e8 14 01 00 00       	call   8018ed <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8017d9:	83 c4 08             	add    $0x8,%esp
+  8017dc:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8017e2:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8017e8:	50                   	push   %eax
+  8017e9:	e8 e5 e8 ff ff       	call   8000d3 <sys_cputs>
+
+	return b.cnt;
+}
+  8017ee:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8017f4:	c9                   	leave
+  8017f5:	c3                   	ret
+
+008017f6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8017f6:	55                   	push   %ebp
+  8017f7:	89 e5                	mov    %esp,%ebp
+  8017f9:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8017fc:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8017ff:	50                   	push   %eax
+  801800:	ff 75 08             	push   0x8(%ebp)
+  801803:	e8 9d ff ff ff       	call   8017a5 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801808:	c9                   	leave
+  801809:	c3                   	ret
+
+0080180a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80180a:	55                   	push   %ebp
+  80180b:	89 e5                	mov    %esp,%ebp
+  80180d:	57                   	push   %edi
+  80180e:	56                   	push   %esi
+  80180f:	53                   	push   %ebx
+  801810:	83 ec 1c             	sub    $0x1c,%esp
+  801813:	89 c7                	mov    %eax,%edi
+  801815:	89 d6                	mov    %edx,%esi
+  801817:	8b 45 08             	mov    0x8(%ebp),%eax
+  80181a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80181d:	89 d1                	mov    %edx,%ecx
+  80181f:	89 c2                	mov    %eax,%edx
+  801821:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801824:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801827:	8b 45 10             	mov    0x10(%ebp),%eax
+  80182a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80182d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801830:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801837:	39 c2                	cmp    %eax,%edx
+  801839:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80183c:	72 3e                	jb     80187c <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80183e:	83 ec 0c             	sub    $0xc,%esp
+  801841:	ff 75 18             	push   0x18(%ebp)
+  801844:	83 eb 01             	sub    $0x1,%ebx
+  801847:	53                   	push   %ebx
+  801848:	50                   	push   %eax
+  801849:	83 ec 08             	sub    $0x8,%esp
+  80184c:	ff 75 e4             	push   -0x1c(%ebp)
+  80184f:	ff 75 e0             	push   -0x20(%ebp)
+  801852:	ff 75 dc             	push   -0x24(%ebp)
+  801855:	ff 75 d8             	push   -0x28(%ebp)
+  801858:	e8 0f 0d 00 00       	call   80256c <__udivdi3>
+  80185d:	83 c4 18             	add    $0x18,%esp
+  801860:	52                   	push   %edx
+  801861:	50                   	push   %eax
+  801862:	89 f2                	mov    %esi,%edx
+  801864:	89 f8                	mov    %edi,%eax
+  801866:	e8 9f ff ff ff       	call   80180a <printnum>
+  80186b:	83 c4 20             	add    $0x20,%esp
+  80186e:	eb 13                	jmp    801883 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801870:	83 ec 08             	sub    $0x8,%esp
+  801873:	56                   	push   %esi
+  801874:	ff 75 18             	push   0x18(%ebp)
+  801877:	ff d7                	call   *%edi
+  801879:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80187c:	83 eb 01             	sub    $0x1,%ebx
+  80187f:	85 db                	test   %ebx,%ebx
+  801881:	7f ed                	jg     801870 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801883:	83 ec 08             	sub    $0x8,%esp
+  801886:	56                   	push   %esi
+  801887:	83 ec 04             	sub    $0x4,%esp
+  80188a:	ff 75 e4             	push   -0x1c(%ebp)
+  80188d:	ff 75 e0             	push   -0x20(%ebp)
+  801890:	ff 75 dc             	push   -0x24(%ebp)
+  801893:	ff 75 d8             	push   -0x28(%ebp)
+  801896:	e8 ef 0c 00 00       	call   80258a <__umoddi3>
+  80189b:	83 c4 14             	add    $0x14,%esp
+  80189e:	0f be 80 e7 27 80 00 	movsbl 0x8027e7(%eax),%eax
+  8018a5:	50                   	push   %eax
+  8018a6:	ff d7                	call   *%edi
+}
+  8018a8:	83 c4 10             	add    $0x10,%esp
+  8018ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ae:	5b                   	pop    %ebx
+  8018af:	5e                   	pop    %esi
+  8018b0:	5f                   	pop    %edi
+  8018b1:	5d                   	pop    %ebp
+  8018b2:	c3                   	ret
+
+008018b3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8018b3:	55                   	push   %ebp
+  8018b4:	89 e5                	mov    %esp,%ebp
+  8018b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8018b9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8018bd:	8b 10                	mov    (%eax),%edx
+  8018bf:	3b 50 04             	cmp    0x4(%eax),%edx
+  8018c2:	73 0a                	jae    8018ce <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8018c4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8018c7:	89 08                	mov    %ecx,(%eax)
+  8018c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018cc:	88 02                	mov    %al,(%edx)
+}
+  8018ce:	5d                   	pop    %ebp
+  8018cf:	c3                   	ret
+
+008018d0 <printfmt>:
+{
+  8018d0:	55                   	push   %ebp
+  8018d1:	89 e5                	mov    %esp,%ebp
+  8018d3:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8018d6:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8018d9:	50                   	push   %eax
+  8018da:	ff 75 10             	push   0x10(%ebp)
+  8018dd:	ff 75 0c             	push   0xc(%ebp)
+  8018e0:	ff 75 08             	push   0x8(%ebp)
+  8018e3:	e8 05 00 00 00       	call   8018ed <vprintfmt>
+}
+  8018e8:	83 c4 10             	add    $0x10,%esp
+  8018eb:	c9                   	leave
+  8018ec:	c3                   	ret
+
+008018ed <vprintfmt>:
+{
+  8018ed:	55                   	push   %ebp
+  8018ee:	89 e5                	mov    %esp,%ebp
+  8018f0:	57                   	push   %edi
+  8018f1:	56                   	push   %esi
+  8018f2:	53                   	push   %ebx
+  8018f3:	83 ec 2c             	sub    $0x2c,%esp
+  8018f6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8018fc:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8018ff:	eb 0a                	jmp    80190b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801901:	83 ec 08             	sub    $0x8,%esp
+  801904:	53                   	push   %ebx
+  801905:	50                   	push   %eax
+  801906:	ff d6                	call   *%esi
+  801908:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80190b:	83 c7 01             	add    $0x1,%edi
+  80190e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801912:	83 f8 25             	cmp    $0x25,%eax
+  801915:	74 0c                	je     801923 <vprintfmt+0x36>
+			if (ch == '\0')
+  801917:	85 c0                	test   %eax,%eax
+  801919:	75 e6                	jne    801901 <vprintfmt+0x14>
+}
+  80191b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80191e:	5b                   	pop    %ebx
+  80191f:	5e                   	pop    %esi
+  801920:	5f                   	pop    %edi
+  801921:	5d                   	pop    %ebp
+  801922:	c3                   	ret
+		padc = ' ';
+  801923:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801927:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80192e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801935:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80193c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801941:	8d 47 01             	lea    0x1(%edi),%eax
+  801944:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801947:	0f b6 17             	movzbl (%edi),%edx
+  80194a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80194d:	3c 55                	cmp    $0x55,%al
+  80194f:	0f 87 c5 03 00 00    	ja     801d1a <vprintfmt+0x42d>
+  801955:	0f b6 c0             	movzbl %al,%eax
+  801958:	ff 24 85 60 29 80 00 	jmp    *0x802960(,%eax,4)
+  80195f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801962:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801966:	eb d9                	jmp    801941 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801968:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80196b:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80196f:	eb d0                	jmp    801941 <vprintfmt+0x54>
+  801971:	0f b6 d2             	movzbl %dl,%edx
+  801974:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801977:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80197f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801982:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801986:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801989:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80198c:	83 f9 09             	cmp    $0x9,%ecx
+  80198f:	77 55                	ja     8019e6 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801991:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801994:	eb e9                	jmp    80197f <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801996:	8b 45 14             	mov    0x14(%ebp),%eax
+  801999:	8b 00                	mov    (%eax),%eax
+  80199b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80199e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019a1:	8d 40 04             	lea    0x4(%eax),%eax
+  8019a4:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019a7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8019aa:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8019ae:	79 91                	jns    801941 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8019b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8019b3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019b6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8019bd:	eb 82                	jmp    801941 <vprintfmt+0x54>
+			if (width < 0)
+  8019bf:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8019c2:	85 d2                	test   %edx,%edx
+  8019c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c9:	0f 49 c2             	cmovns %edx,%eax
+  8019cc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019cf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019d2:	e9 6a ff ff ff       	jmp    801941 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8019d7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8019da:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8019e1:	e9 5b ff ff ff       	jmp    801941 <vprintfmt+0x54>
+  8019e6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019e9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019ec:	eb bc                	jmp    8019aa <vprintfmt+0xbd>
+			lflag++;
+  8019ee:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8019f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019f4:	e9 48 ff ff ff       	jmp    801941 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8019f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019fc:	8d 78 04             	lea    0x4(%eax),%edi
+  8019ff:	83 ec 08             	sub    $0x8,%esp
+  801a02:	53                   	push   %ebx
+  801a03:	ff 30                	push   (%eax)
+  801a05:	ff d6                	call   *%esi
+			break;
+  801a07:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801a0a:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801a0d:	e9 63 02 00 00       	jmp    801c75 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  801a12:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a15:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801a18:	8b 10                	mov    (%eax),%edx
+  801a1a:	89 d0                	mov    %edx,%eax
+  801a1c:	f7 d8                	neg    %eax
+  801a1e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801a21:	83 f8 12             	cmp    $0x12,%eax
+  801a24:	7f 23                	jg     801a49 <vprintfmt+0x15c>
+  801a26:	8b 14 85 c0 2a 80 00 	mov    0x802ac0(,%eax,4),%edx
+  801a2d:	85 d2                	test   %edx,%edx
+  801a2f:	74 18                	je     801a49 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801a31:	52                   	push   %edx
+  801a32:	68 7d 27 80 00       	push   $0x80277d
+  801a37:	53                   	push   %ebx
+  801a38:	56                   	push   %esi
+  801a39:	e8 92 fe ff ff       	call   8018d0 <printfmt>
+  801a3e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a41:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801a44:	e9 2c 02 00 00       	jmp    801c75 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  801a49:	50                   	push   %eax
+  801a4a:	68 ff 27 80 00       	push   $0x8027ff
+  801a4f:	53                   	push   %ebx
+  801a50:	56                   	push   %esi
+  801a51:	e8 7a fe ff ff       	call   8018d0 <printfmt>
+  801a56:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a59:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801a5c:	e9 14 02 00 00       	jmp    801c75 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801a61:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a64:	83 c0 04             	add    $0x4,%eax
+  801a67:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801a6a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a6d:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801a6f:	85 c9                	test   %ecx,%ecx
+  801a71:	b8 f8 27 80 00       	mov    $0x8027f8,%eax
+  801a76:	0f 45 c1             	cmovne %ecx,%eax
+  801a79:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801a7c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801a80:	7e 06                	jle    801a88 <vprintfmt+0x19b>
+  801a82:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801a86:	75 0b                	jne    801a93 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801a88:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801a8b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801a8e:	89 75 08             	mov    %esi,0x8(%ebp)
+  801a91:	eb 5c                	jmp    801aef <vprintfmt+0x202>
+  801a93:	83 ec 08             	sub    $0x8,%esp
+  801a96:	ff 75 d0             	push   -0x30(%ebp)
+  801a99:	ff 75 cc             	push   -0x34(%ebp)
+  801a9c:	e8 19 03 00 00       	call   801dba <strnlen>
+  801aa1:	89 c2                	mov    %eax,%edx
+  801aa3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801aa6:	29 d0                	sub    %edx,%eax
+  801aa8:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801aab:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801aaf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ab2:	89 75 08             	mov    %esi,0x8(%ebp)
+  801ab5:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ab7:	eb 0e                	jmp    801ac7 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801ab9:	83 ec 08             	sub    $0x8,%esp
+  801abc:	53                   	push   %ebx
+  801abd:	57                   	push   %edi
+  801abe:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ac1:	83 ee 01             	sub    $0x1,%esi
+  801ac4:	83 c4 10             	add    $0x10,%esp
+  801ac7:	85 f6                	test   %esi,%esi
+  801ac9:	7f ee                	jg     801ab9 <vprintfmt+0x1cc>
+  801acb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ace:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ad1:	85 c0                	test   %eax,%eax
+  801ad3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad8:	0f 49 d0             	cmovns %eax,%edx
+  801adb:	29 d0                	sub    %edx,%eax
+  801add:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ae0:	eb a6                	jmp    801a88 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801ae2:	83 ec 08             	sub    $0x8,%esp
+  801ae5:	53                   	push   %ebx
+  801ae6:	52                   	push   %edx
+  801ae7:	ff 55 08             	call   *0x8(%ebp)
+  801aea:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801aed:	89 f1                	mov    %esi,%ecx
+  801aef:	8d 71 01             	lea    0x1(%ecx),%esi
+  801af2:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801af6:	0f be d0             	movsbl %al,%edx
+  801af9:	85 d2                	test   %edx,%edx
+  801afb:	74 28                	je     801b25 <vprintfmt+0x238>
+  801afd:	85 ff                	test   %edi,%edi
+  801aff:	78 05                	js     801b06 <vprintfmt+0x219>
+  801b01:	83 ef 01             	sub    $0x1,%edi
+  801b04:	78 30                	js     801b36 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801b06:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801b0a:	74 d6                	je     801ae2 <vprintfmt+0x1f5>
+  801b0c:	0f be c0             	movsbl %al,%eax
+  801b0f:	83 e8 20             	sub    $0x20,%eax
+  801b12:	83 f8 5e             	cmp    $0x5e,%eax
+  801b15:	76 cb                	jbe    801ae2 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801b17:	83 ec 08             	sub    $0x8,%esp
+  801b1a:	53                   	push   %ebx
+  801b1b:	6a 3f                	push   $0x3f
+  801b1d:	ff 55 08             	call   *0x8(%ebp)
+  801b20:	83 c4 10             	add    $0x10,%esp
+  801b23:	eb c8                	jmp    801aed <vprintfmt+0x200>
+  801b25:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b28:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b2b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801b2e:	01 d0                	add    %edx,%eax
+  801b30:	29 c8                	sub    %ecx,%eax
+  801b32:	89 c7                	mov    %eax,%edi
+  801b34:	eb 13                	jmp    801b49 <vprintfmt+0x25c>
+  801b36:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b39:	eb ed                	jmp    801b28 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801b3b:	83 ec 08             	sub    $0x8,%esp
+  801b3e:	53                   	push   %ebx
+  801b3f:	6a 20                	push   $0x20
+  801b41:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801b43:	83 ef 01             	sub    $0x1,%edi
+  801b46:	83 c4 10             	add    $0x10,%esp
+  801b49:	85 ff                	test   %edi,%edi
+  801b4b:	7f ee                	jg     801b3b <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801b4d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b50:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b53:	e9 1d 01 00 00       	jmp    801c75 <vprintfmt+0x388>
+	if (lflag >= 2)
+  801b58:	83 f9 01             	cmp    $0x1,%ecx
+  801b5b:	7f 1b                	jg     801b78 <vprintfmt+0x28b>
+	else if (lflag)
+  801b5d:	85 c9                	test   %ecx,%ecx
+  801b5f:	74 63                	je     801bc4 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  801b61:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b64:	8b 00                	mov    (%eax),%eax
+  801b66:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b69:	99                   	cltd
+  801b6a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b6d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b70:	8d 40 04             	lea    0x4(%eax),%eax
+  801b73:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b76:	eb 17                	jmp    801b8f <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  801b78:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b7b:	8b 50 04             	mov    0x4(%eax),%edx
+  801b7e:	8b 00                	mov    (%eax),%eax
+  801b80:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b83:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b86:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b89:	8d 40 08             	lea    0x8(%eax),%eax
+  801b8c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801b8f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b92:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801b95:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801b9a:	85 c9                	test   %ecx,%ecx
+  801b9c:	0f 89 b9 00 00 00    	jns    801c5b <vprintfmt+0x36e>
+				putch('-', putdat);
+  801ba2:	83 ec 08             	sub    $0x8,%esp
+  801ba5:	53                   	push   %ebx
+  801ba6:	6a 2d                	push   $0x2d
+  801ba8:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801baa:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801bad:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801bb0:	f7 da                	neg    %edx
+  801bb2:	83 d1 00             	adc    $0x0,%ecx
+  801bb5:	f7 d9                	neg    %ecx
+  801bb7:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801bba:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801bbf:	e9 97 00 00 00       	jmp    801c5b <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  801bc4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bc7:	8b 00                	mov    (%eax),%eax
+  801bc9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bcc:	99                   	cltd
+  801bcd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801bd0:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bd3:	8d 40 04             	lea    0x4(%eax),%eax
+  801bd6:	89 45 14             	mov    %eax,0x14(%ebp)
+  801bd9:	eb b4                	jmp    801b8f <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  801bdb:	83 f9 01             	cmp    $0x1,%ecx
+  801bde:	7f 1b                	jg     801bfb <vprintfmt+0x30e>
+	else if (lflag)
+  801be0:	85 c9                	test   %ecx,%ecx
+  801be2:	74 2c                	je     801c10 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  801be4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801be7:	8b 10                	mov    (%eax),%edx
+  801be9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bee:	8d 40 04             	lea    0x4(%eax),%eax
+  801bf1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801bf4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801bf9:	eb 60                	jmp    801c5b <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801bfb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bfe:	8b 10                	mov    (%eax),%edx
+  801c00:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c03:	8d 40 08             	lea    0x8(%eax),%eax
+  801c06:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c09:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801c0e:	eb 4b                	jmp    801c5b <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  801c10:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c13:	8b 10                	mov    (%eax),%edx
+  801c15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c1a:	8d 40 04             	lea    0x4(%eax),%eax
+  801c1d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c20:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801c25:	eb 34                	jmp    801c5b <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801c27:	83 f9 01             	cmp    $0x1,%ecx
+  801c2a:	7f 15                	jg     801c41 <vprintfmt+0x354>
+	else if (lflag)
+  801c2c:	85 c9                	test   %ecx,%ecx
+  801c2e:	74 4d                	je     801c7d <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  801c30:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c33:	8b 00                	mov    (%eax),%eax
+  801c35:	99                   	cltd
+  801c36:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c39:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801c3c:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  801c3f:	eb 11                	jmp    801c52 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  801c41:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c44:	8b 50 04             	mov    0x4(%eax),%edx
+  801c47:	8b 00                	mov    (%eax),%eax
+  801c49:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c4c:	8d 49 08             	lea    0x8(%ecx),%ecx
+  801c4f:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  801c52:	89 d1                	mov    %edx,%ecx
+  801c54:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  801c56:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801c5b:	83 ec 0c             	sub    $0xc,%esp
+  801c5e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801c62:	50                   	push   %eax
+  801c63:	ff 75 e0             	push   -0x20(%ebp)
+  801c66:	57                   	push   %edi
+  801c67:	51                   	push   %ecx
+  801c68:	52                   	push   %edx
+  801c69:	89 da                	mov    %ebx,%edx
+  801c6b:	89 f0                	mov    %esi,%eax
+  801c6d:	e8 98 fb ff ff       	call   80180a <printnum>
+			break;
+  801c72:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801c75:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801c78:	e9 8e fc ff ff       	jmp    80190b <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  801c7d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c80:	8b 00                	mov    (%eax),%eax
+  801c82:	99                   	cltd
+  801c83:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c86:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801c89:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  801c8c:	eb c4                	jmp    801c52 <vprintfmt+0x365>
+			putch('0', putdat);
+  801c8e:	83 ec 08             	sub    $0x8,%esp
+  801c91:	53                   	push   %ebx
+  801c92:	6a 30                	push   $0x30
+  801c94:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801c96:	83 c4 08             	add    $0x8,%esp
+  801c99:	53                   	push   %ebx
+  801c9a:	6a 78                	push   $0x78
+  801c9c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801c9e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ca1:	8b 10                	mov    (%eax),%edx
+  801ca3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801ca8:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801cab:	8d 40 04             	lea    0x4(%eax),%eax
+  801cae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cb1:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  801cb6:	eb a3                	jmp    801c5b <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801cb8:	83 f9 01             	cmp    $0x1,%ecx
+  801cbb:	7f 1b                	jg     801cd8 <vprintfmt+0x3eb>
+	else if (lflag)
+  801cbd:	85 c9                	test   %ecx,%ecx
+  801cbf:	74 2f                	je     801cf0 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  801cc1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cc4:	8b 10                	mov    (%eax),%edx
+  801cc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ccb:	8d 40 04             	lea    0x4(%eax),%eax
+  801cce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cd1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801cd6:	eb 83                	jmp    801c5b <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801cd8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cdb:	8b 10                	mov    (%eax),%edx
+  801cdd:	8b 48 04             	mov    0x4(%eax),%ecx
+  801ce0:	8d 40 08             	lea    0x8(%eax),%eax
+  801ce3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ce6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801ceb:	e9 6b ff ff ff       	jmp    801c5b <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  801cf0:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cf3:	8b 10                	mov    (%eax),%edx
+  801cf5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cfa:	8d 40 04             	lea    0x4(%eax),%eax
+  801cfd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801d00:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801d05:	e9 51 ff ff ff       	jmp    801c5b <vprintfmt+0x36e>
+			putch(ch, putdat);
+  801d0a:	83 ec 08             	sub    $0x8,%esp
+  801d0d:	53                   	push   %ebx
+  801d0e:	6a 25                	push   $0x25
+  801d10:	ff d6                	call   *%esi
+			break;
+  801d12:	83 c4 10             	add    $0x10,%esp
+  801d15:	e9 5b ff ff ff       	jmp    801c75 <vprintfmt+0x388>
+			putch('%', putdat);
+  801d1a:	83 ec 08             	sub    $0x8,%esp
+  801d1d:	53                   	push   %ebx
+  801d1e:	6a 25                	push   $0x25
+  801d20:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801d22:	83 c4 10             	add    $0x10,%esp
+  801d25:	89 f8                	mov    %edi,%eax
+  801d27:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801d2b:	74 05                	je     801d32 <vprintfmt+0x445>
+  801d2d:	83 e8 01             	sub    $0x1,%eax
+  801d30:	eb f5                	jmp    801d27 <vprintfmt+0x43a>
+  801d32:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d35:	e9 3b ff ff ff       	jmp    801c75 <vprintfmt+0x388>
+
+00801d3a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801d3a:	55                   	push   %ebp
+  801d3b:	89 e5                	mov    %esp,%ebp
+  801d3d:	83 ec 18             	sub    $0x18,%esp
+  801d40:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d43:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801d46:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801d49:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801d4d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801d50:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801d57:	85 c0                	test   %eax,%eax
+  801d59:	74 26                	je     801d81 <vsnprintf+0x47>
+  801d5b:	85 d2                	test   %edx,%edx
+  801d5d:	7e 22                	jle    801d81 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801d5f:	ff 75 14             	push   0x14(%ebp)
+  801d62:	ff 75 10             	push   0x10(%ebp)
+  801d65:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801d68:	50                   	push   %eax
+  801d69:	68 b3 18 80 00       	push   $0x8018b3
+  801d6e:	e8 7a fb ff ff       	call   8018ed <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801d73:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801d76:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801d79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d7c:	83 c4 10             	add    $0x10,%esp
+}
+  801d7f:	c9                   	leave
+  801d80:	c3                   	ret
+		return -E_INVAL;
+  801d81:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d86:	eb f7                	jmp    801d7f <vsnprintf+0x45>
+
+00801d88 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801d88:	55                   	push   %ebp
+  801d89:	89 e5                	mov    %esp,%ebp
+  801d8b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801d8e:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801d91:	50                   	push   %eax
+  801d92:	ff 75 10             	push   0x10(%ebp)
+  801d95:	ff 75 0c             	push   0xc(%ebp)
+  801d98:	ff 75 08             	push   0x8(%ebp)
+  801d9b:	e8 9a ff ff ff       	call   801d3a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801da0:	c9                   	leave
+  801da1:	c3                   	ret
+
+00801da2 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801da2:	55                   	push   %ebp
+  801da3:	89 e5                	mov    %esp,%ebp
+  801da5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801da8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dad:	eb 03                	jmp    801db2 <strlen+0x10>
+		n++;
+  801daf:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801db2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801db6:	75 f7                	jne    801daf <strlen+0xd>
+	return n;
+}
+  801db8:	5d                   	pop    %ebp
+  801db9:	c3                   	ret
+
+00801dba <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801dba:	55                   	push   %ebp
+  801dbb:	89 e5                	mov    %esp,%ebp
+  801dbd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dc0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc8:	eb 03                	jmp    801dcd <strnlen+0x13>
+		n++;
+  801dca:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dcd:	39 d0                	cmp    %edx,%eax
+  801dcf:	74 08                	je     801dd9 <strnlen+0x1f>
+  801dd1:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801dd5:	75 f3                	jne    801dca <strnlen+0x10>
+  801dd7:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801dd9:	89 d0                	mov    %edx,%eax
+  801ddb:	5d                   	pop    %ebp
+  801ddc:	c3                   	ret
+
+00801ddd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801ddd:	55                   	push   %ebp
+  801dde:	89 e5                	mov    %esp,%ebp
+  801de0:	53                   	push   %ebx
+  801de1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801de4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801de7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dec:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801df0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801df3:	83 c0 01             	add    $0x1,%eax
+  801df6:	84 d2                	test   %dl,%dl
+  801df8:	75 f2                	jne    801dec <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801dfa:	89 c8                	mov    %ecx,%eax
+  801dfc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dff:	c9                   	leave
+  801e00:	c3                   	ret
+
+00801e01 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801e01:	55                   	push   %ebp
+  801e02:	89 e5                	mov    %esp,%ebp
+  801e04:	53                   	push   %ebx
+  801e05:	83 ec 10             	sub    $0x10,%esp
+  801e08:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801e0b:	53                   	push   %ebx
+  801e0c:	e8 91 ff ff ff       	call   801da2 <strlen>
+  801e11:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801e14:	ff 75 0c             	push   0xc(%ebp)
+  801e17:	01 d8                	add    %ebx,%eax
+  801e19:	50                   	push   %eax
+  801e1a:	e8 be ff ff ff       	call   801ddd <strcpy>
+	return dst;
+}
+  801e1f:	89 d8                	mov    %ebx,%eax
+  801e21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e24:	c9                   	leave
+  801e25:	c3                   	ret
+
+00801e26 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801e26:	55                   	push   %ebp
+  801e27:	89 e5                	mov    %esp,%ebp
+  801e29:	56                   	push   %esi
+  801e2a:	53                   	push   %ebx
+  801e2b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e2e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801e31:	89 f3                	mov    %esi,%ebx
+  801e33:	03 5d 10             	add    0x10(%ebp),%ebx
+  801e36:	89 f0                	mov    %esi,%eax
+  801e38:	eb 0f                	jmp    801e49 <strncpy+0x23>
+		*dst++ = *src;
+  801e3a:	83 c0 01             	add    $0x1,%eax
+  801e3d:	0f b6 0a             	movzbl (%edx),%ecx
+  801e40:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801e43:	80 f9 01             	cmp    $0x1,%cl
+  801e46:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801e49:	39 d8                	cmp    %ebx,%eax
+  801e4b:	75 ed                	jne    801e3a <strncpy+0x14>
+	}
+	return ret;
+}
+  801e4d:	89 f0                	mov    %esi,%eax
+  801e4f:	5b                   	pop    %ebx
+  801e50:	5e                   	pop    %esi
+  801e51:	5d                   	pop    %ebp
+  801e52:	c3                   	ret
+
+00801e53 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e53:	55                   	push   %ebp
+  801e54:	89 e5                	mov    %esp,%ebp
+  801e56:	56                   	push   %esi
+  801e57:	53                   	push   %ebx
+  801e58:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e5e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801e61:	89 f0                	mov    %esi,%eax
+  801e63:	85 d2                	test   %edx,%edx
+  801e65:	74 21                	je     801e88 <strlcpy+0x35>
+  801e67:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801e6b:	89 f2                	mov    %esi,%edx
+  801e6d:	eb 09                	jmp    801e78 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801e6f:	83 c1 01             	add    $0x1,%ecx
+  801e72:	83 c2 01             	add    $0x1,%edx
+  801e75:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801e78:	39 c2                	cmp    %eax,%edx
+  801e7a:	74 09                	je     801e85 <strlcpy+0x32>
+  801e7c:	0f b6 19             	movzbl (%ecx),%ebx
+  801e7f:	84 db                	test   %bl,%bl
+  801e81:	75 ec                	jne    801e6f <strlcpy+0x1c>
+  801e83:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801e85:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801e88:	29 f0                	sub    %esi,%eax
+}
+  801e8a:	5b                   	pop    %ebx
+  801e8b:	5e                   	pop    %esi
+  801e8c:	5d                   	pop    %ebp
+  801e8d:	c3                   	ret
+
+00801e8e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801e8e:	55                   	push   %ebp
+  801e8f:	89 e5                	mov    %esp,%ebp
+  801e91:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e94:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801e97:	eb 06                	jmp    801e9f <strcmp+0x11>
+		p++, q++;
+  801e99:	83 c1 01             	add    $0x1,%ecx
+  801e9c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801e9f:	0f b6 01             	movzbl (%ecx),%eax
+  801ea2:	84 c0                	test   %al,%al
+  801ea4:	74 04                	je     801eaa <strcmp+0x1c>
+  801ea6:	3a 02                	cmp    (%edx),%al
+  801ea8:	74 ef                	je     801e99 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801eaa:	0f b6 c0             	movzbl %al,%eax
+  801ead:	0f b6 12             	movzbl (%edx),%edx
+  801eb0:	29 d0                	sub    %edx,%eax
+}
+  801eb2:	5d                   	pop    %ebp
+  801eb3:	c3                   	ret
+
+00801eb4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801eb4:	55                   	push   %ebp
+  801eb5:	89 e5                	mov    %esp,%ebp
+  801eb7:	53                   	push   %ebx
+  801eb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ebb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ebe:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801ec1:	eb 09                	jmp    801ecc <strncmp+0x18>
+		n--, p++, q++;
+  801ec3:	83 ea 01             	sub    $0x1,%edx
+  801ec6:	83 c0 01             	add    $0x1,%eax
+  801ec9:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801ecc:	85 d2                	test   %edx,%edx
+  801ece:	74 18                	je     801ee8 <strncmp+0x34>
+  801ed0:	0f b6 18             	movzbl (%eax),%ebx
+  801ed3:	84 db                	test   %bl,%bl
+  801ed5:	74 04                	je     801edb <strncmp+0x27>
+  801ed7:	3a 19                	cmp    (%ecx),%bl
+  801ed9:	74 e8                	je     801ec3 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801edb:	0f b6 00             	movzbl (%eax),%eax
+  801ede:	0f b6 11             	movzbl (%ecx),%edx
+  801ee1:	29 d0                	sub    %edx,%eax
+}
+  801ee3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee6:	c9                   	leave
+  801ee7:	c3                   	ret
+		return 0;
+  801ee8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eed:	eb f4                	jmp    801ee3 <strncmp+0x2f>
+
+00801eef <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801eef:	55                   	push   %ebp
+  801ef0:	89 e5                	mov    %esp,%ebp
+  801ef2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801ef9:	eb 03                	jmp    801efe <strchr+0xf>
+  801efb:	83 c0 01             	add    $0x1,%eax
+  801efe:	0f b6 10             	movzbl (%eax),%edx
+  801f01:	84 d2                	test   %dl,%dl
+  801f03:	74 06                	je     801f0b <strchr+0x1c>
+		if (*s == c)
+  801f05:	38 ca                	cmp    %cl,%dl
+  801f07:	75 f2                	jne    801efb <strchr+0xc>
+  801f09:	eb 05                	jmp    801f10 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f10:	5d                   	pop    %ebp
+  801f11:	c3                   	ret
+
+00801f12 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801f12:	55                   	push   %ebp
+  801f13:	89 e5                	mov    %esp,%ebp
+  801f15:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f18:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f1c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801f1f:	38 ca                	cmp    %cl,%dl
+  801f21:	74 09                	je     801f2c <strfind+0x1a>
+  801f23:	84 d2                	test   %dl,%dl
+  801f25:	74 05                	je     801f2c <strfind+0x1a>
+	for (; *s; s++)
+  801f27:	83 c0 01             	add    $0x1,%eax
+  801f2a:	eb f0                	jmp    801f1c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801f2c:	5d                   	pop    %ebp
+  801f2d:	c3                   	ret
+
+00801f2e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801f2e:	55                   	push   %ebp
+  801f2f:	89 e5                	mov    %esp,%ebp
+  801f31:	57                   	push   %edi
+  801f32:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f35:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801f38:	85 c9                	test   %ecx,%ecx
+  801f3a:	74 20                	je     801f5c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801f3c:	89 f8                	mov    %edi,%eax
+  801f3e:	09 c8                	or     %ecx,%eax
+  801f40:	a8 03                	test   $0x3,%al
+  801f42:	75 12                	jne    801f56 <memset+0x28>
+		c &= 0xFF;
+  801f44:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801f48:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801f4e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801f51:	fc                   	cld
+  801f52:	f3 ab                	rep stos %eax,%es:(%edi)
+  801f54:	eb 06                	jmp    801f5c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801f56:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f59:	fc                   	cld
+  801f5a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801f5c:	89 f8                	mov    %edi,%eax
+  801f5e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801f61:	c9                   	leave
+  801f62:	c3                   	ret
+
+00801f63 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801f63:	55                   	push   %ebp
+  801f64:	89 e5                	mov    %esp,%ebp
+  801f66:	57                   	push   %edi
+  801f67:	56                   	push   %esi
+  801f68:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f6e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801f71:	39 c6                	cmp    %eax,%esi
+  801f73:	73 32                	jae    801fa7 <memmove+0x44>
+  801f75:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801f78:	39 d0                	cmp    %edx,%eax
+  801f7a:	73 2b                	jae    801fa7 <memmove+0x44>
+		s += n;
+		d += n;
+  801f7c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f7f:	89 d6                	mov    %edx,%esi
+  801f81:	09 fe                	or     %edi,%esi
+  801f83:	09 ce                	or     %ecx,%esi
+  801f85:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801f8b:	75 0e                	jne    801f9b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801f8d:	83 ef 04             	sub    $0x4,%edi
+  801f90:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801f93:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801f96:	fd                   	std
+  801f97:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801f99:	eb 09                	jmp    801fa4 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801f9b:	83 ef 01             	sub    $0x1,%edi
+  801f9e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801fa1:	fd                   	std
+  801fa2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801fa4:	fc                   	cld
+  801fa5:	eb 1a                	jmp    801fc1 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801fa7:	89 f2                	mov    %esi,%edx
+  801fa9:	09 c2                	or     %eax,%edx
+  801fab:	09 ca                	or     %ecx,%edx
+  801fad:	f6 c2 03             	test   $0x3,%dl
+  801fb0:	75 0a                	jne    801fbc <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801fb2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801fb5:	89 c7                	mov    %eax,%edi
+  801fb7:	fc                   	cld
+  801fb8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fba:	eb 05                	jmp    801fc1 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801fbc:	89 c7                	mov    %eax,%edi
+  801fbe:	fc                   	cld
+  801fbf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801fc1:	5e                   	pop    %esi
+  801fc2:	5f                   	pop    %edi
+  801fc3:	5d                   	pop    %ebp
+  801fc4:	c3                   	ret
+
+00801fc5 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801fc5:	55                   	push   %ebp
+  801fc6:	89 e5                	mov    %esp,%ebp
+  801fc8:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801fcb:	ff 75 10             	push   0x10(%ebp)
+  801fce:	ff 75 0c             	push   0xc(%ebp)
+  801fd1:	ff 75 08             	push   0x8(%ebp)
+  801fd4:	e8 8a ff ff ff       	call   801f63 <memmove>
+}
+  801fd9:	c9                   	leave
+  801fda:	c3                   	ret
+
+00801fdb <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801fdb:	55                   	push   %ebp
+  801fdc:	89 e5                	mov    %esp,%ebp
+  801fde:	56                   	push   %esi
+  801fdf:	53                   	push   %ebx
+  801fe0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801fe6:	89 c6                	mov    %eax,%esi
+  801fe8:	03 75 10             	add    0x10(%ebp),%esi
+  801feb:	eb 06                	jmp    801ff3 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801fed:	83 c0 01             	add    $0x1,%eax
+  801ff0:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801ff3:	39 f0                	cmp    %esi,%eax
+  801ff5:	74 14                	je     80200b <memcmp+0x30>
+		if (*s1 != *s2)
+  801ff7:	0f b6 08             	movzbl (%eax),%ecx
+  801ffa:	0f b6 1a             	movzbl (%edx),%ebx
+  801ffd:	38 d9                	cmp    %bl,%cl
+  801fff:	74 ec                	je     801fed <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802001:	0f b6 c1             	movzbl %cl,%eax
+  802004:	0f b6 db             	movzbl %bl,%ebx
+  802007:	29 d8                	sub    %ebx,%eax
+  802009:	eb 05                	jmp    802010 <memcmp+0x35>
+	}
+
+	return 0;
+  80200b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802010:	5b                   	pop    %ebx
+  802011:	5e                   	pop    %esi
+  802012:	5d                   	pop    %ebp
+  802013:	c3                   	ret
+
+00802014 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802014:	55                   	push   %ebp
+  802015:	89 e5                	mov    %esp,%ebp
+  802017:	8b 45 08             	mov    0x8(%ebp),%eax
+  80201a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80201d:	89 c2                	mov    %eax,%edx
+  80201f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802022:	eb 03                	jmp    802027 <memfind+0x13>
+  802024:	83 c0 01             	add    $0x1,%eax
+  802027:	39 d0                	cmp    %edx,%eax
+  802029:	73 04                	jae    80202f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80202b:	38 08                	cmp    %cl,(%eax)
+  80202d:	75 f5                	jne    802024 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80202f:	5d                   	pop    %ebp
+  802030:	c3                   	ret
+
+00802031 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802031:	55                   	push   %ebp
+  802032:	89 e5                	mov    %esp,%ebp
+  802034:	57                   	push   %edi
+  802035:	56                   	push   %esi
+  802036:	53                   	push   %ebx
+  802037:	8b 55 08             	mov    0x8(%ebp),%edx
+  80203a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80203d:	eb 03                	jmp    802042 <strtol+0x11>
+		s++;
+  80203f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802042:	0f b6 02             	movzbl (%edx),%eax
+  802045:	3c 20                	cmp    $0x20,%al
+  802047:	74 f6                	je     80203f <strtol+0xe>
+  802049:	3c 09                	cmp    $0x9,%al
+  80204b:	74 f2                	je     80203f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  80204d:	3c 2b                	cmp    $0x2b,%al
+  80204f:	74 2a                	je     80207b <strtol+0x4a>
+	int neg = 0;
+  802051:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802056:	3c 2d                	cmp    $0x2d,%al
+  802058:	74 2b                	je     802085 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80205a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802060:	75 0f                	jne    802071 <strtol+0x40>
+  802062:	80 3a 30             	cmpb   $0x30,(%edx)
+  802065:	74 28                	je     80208f <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802067:	85 db                	test   %ebx,%ebx
+  802069:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80206e:	0f 44 d8             	cmove  %eax,%ebx
+  802071:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802076:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802079:	eb 46                	jmp    8020c1 <strtol+0x90>
+		s++;
+  80207b:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  80207e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802083:	eb d5                	jmp    80205a <strtol+0x29>
+		s++, neg = 1;
+  802085:	83 c2 01             	add    $0x1,%edx
+  802088:	bf 01 00 00 00       	mov    $0x1,%edi
+  80208d:	eb cb                	jmp    80205a <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80208f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802093:	74 0e                	je     8020a3 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802095:	85 db                	test   %ebx,%ebx
+  802097:	75 d8                	jne    802071 <strtol+0x40>
+		s++, base = 8;
+  802099:	83 c2 01             	add    $0x1,%edx
+  80209c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8020a1:	eb ce                	jmp    802071 <strtol+0x40>
+		s += 2, base = 16;
+  8020a3:	83 c2 02             	add    $0x2,%edx
+  8020a6:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8020ab:	eb c4                	jmp    802071 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8020ad:	0f be c0             	movsbl %al,%eax
+  8020b0:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8020b3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8020b6:	7d 3a                	jge    8020f2 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8020b8:	83 c2 01             	add    $0x1,%edx
+  8020bb:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8020bf:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8020c1:	0f b6 02             	movzbl (%edx),%eax
+  8020c4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8020c7:	89 f3                	mov    %esi,%ebx
+  8020c9:	80 fb 09             	cmp    $0x9,%bl
+  8020cc:	76 df                	jbe    8020ad <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8020ce:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8020d1:	89 f3                	mov    %esi,%ebx
+  8020d3:	80 fb 19             	cmp    $0x19,%bl
+  8020d6:	77 08                	ja     8020e0 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8020d8:	0f be c0             	movsbl %al,%eax
+  8020db:	83 e8 57             	sub    $0x57,%eax
+  8020de:	eb d3                	jmp    8020b3 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8020e0:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8020e3:	89 f3                	mov    %esi,%ebx
+  8020e5:	80 fb 19             	cmp    $0x19,%bl
+  8020e8:	77 08                	ja     8020f2 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8020ea:	0f be c0             	movsbl %al,%eax
+  8020ed:	83 e8 37             	sub    $0x37,%eax
+  8020f0:	eb c1                	jmp    8020b3 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8020f2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8020f6:	74 05                	je     8020fd <strtol+0xcc>
+		*endptr = (char *) s;
+  8020f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020fb:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8020fd:	89 c8                	mov    %ecx,%eax
+  8020ff:	f7 d8                	neg    %eax
+  802101:	85 ff                	test   %edi,%edi
+  802103:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802106:	89 c8                	mov    %ecx,%eax
+  802108:	5b                   	pop    %ebx
+  802109:	5e                   	pop    %esi
+  80210a:	5f                   	pop    %edi
+  80210b:	5d                   	pop    %ebp
+  80210c:	c3                   	ret
+
+0080210d <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  80210d:	55                   	push   %ebp
+  80210e:	89 e5                	mov    %esp,%ebp
+  802110:	57                   	push   %edi
+  802111:	56                   	push   %esi
+  802112:	53                   	push   %ebx
+  802113:	83 ec 0c             	sub    $0xc,%esp
+  802116:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802119:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80211c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  80211f:	85 ff                	test   %edi,%edi
+  802121:	74 16                	je     802139 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  802123:	83 ec 04             	sub    $0x4,%esp
+  802126:	56                   	push   %esi
+  802127:	6a 00                	push   $0x0
+  802129:	53                   	push   %ebx
+  80212a:	e8 02 ff ff ff       	call   802031 <strtol>
+  80212f:	89 07                	mov    %eax,(%edi)
+  802131:	83 c4 10             	add    $0x10,%esp
+  802134:	eb 03                	jmp    802139 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  802136:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  802139:	0f b6 03             	movzbl (%ebx),%eax
+  80213c:	3c 20                	cmp    $0x20,%al
+  80213e:	74 f6                	je     802136 <strisl+0x29>
+  802140:	3c 09                	cmp    $0x9,%al
+  802142:	74 f2                	je     802136 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  802144:	3c 2b                	cmp    $0x2b,%al
+  802146:	74 23                	je     80216b <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  802148:	3c 2d                	cmp    $0x2d,%al
+  80214a:	0f 94 c0             	sete   %al
+  80214d:	0f b6 c0             	movzbl %al,%eax
+  802150:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802152:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  802158:	75 41                	jne    80219b <strisl+0x8e>
+  80215a:	80 3b 30             	cmpb   $0x30,(%ebx)
+  80215d:	74 11                	je     802170 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80215f:	85 f6                	test   %esi,%esi
+  802161:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802166:	0f 44 f0             	cmove  %eax,%esi
+  802169:	eb 30                	jmp    80219b <strisl+0x8e>
+		s++;
+  80216b:	83 c3 01             	add    $0x1,%ebx
+  80216e:	eb e2                	jmp    802152 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802170:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  802174:	74 0e                	je     802184 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  802176:	85 f6                	test   %esi,%esi
+  802178:	75 21                	jne    80219b <strisl+0x8e>
+		s++, base = 8;
+  80217a:	83 c3 01             	add    $0x1,%ebx
+  80217d:	be 08 00 00 00       	mov    $0x8,%esi
+  802182:	eb 17                	jmp    80219b <strisl+0x8e>
+		s += 2, base = 16;
+  802184:	83 c3 02             	add    $0x2,%ebx
+  802187:	be 10 00 00 00       	mov    $0x10,%esi
+  80218c:	eb 0d                	jmp    80219b <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80218e:	0f be c0             	movsbl %al,%eax
+  802191:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  802194:	39 f0                	cmp    %esi,%eax
+  802196:	7d 38                	jge    8021d0 <strisl+0xc3>
+			return 0;
+		s++;
+  802198:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  80219b:	0f b6 03             	movzbl (%ebx),%eax
+  80219e:	8d 50 d0             	lea    -0x30(%eax),%edx
+  8021a1:	80 fa 09             	cmp    $0x9,%dl
+  8021a4:	76 e8                	jbe    80218e <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  8021a6:	8d 50 9f             	lea    -0x61(%eax),%edx
+  8021a9:	80 fa 19             	cmp    $0x19,%dl
+  8021ac:	77 08                	ja     8021b6 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  8021ae:	0f be c0             	movsbl %al,%eax
+  8021b1:	83 e8 57             	sub    $0x57,%eax
+  8021b4:	eb de                	jmp    802194 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  8021b6:	8d 50 bf             	lea    -0x41(%eax),%edx
+  8021b9:	80 fa 19             	cmp    $0x19,%dl
+  8021bc:	77 08                	ja     8021c6 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  8021be:	0f be c0             	movsbl %al,%eax
+  8021c1:	83 e8 37             	sub    $0x37,%eax
+  8021c4:	eb ce                	jmp    802194 <strisl+0x87>
+		else if (!*s)
+  8021c6:	84 c0                	test   %al,%al
+  8021c8:	0f 94 c0             	sete   %al
+  8021cb:	0f b6 c0             	movzbl %al,%eax
+  8021ce:	eb 05                	jmp    8021d5 <strisl+0xc8>
+			return 0;
+  8021d0:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  8021d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021d8:	5b                   	pop    %ebx
+  8021d9:	5e                   	pop    %esi
+  8021da:	5f                   	pop    %edi
+  8021db:	5d                   	pop    %ebp
+  8021dc:	c3                   	ret
+
+008021dd <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8021dd:	55                   	push   %ebp
+  8021de:	89 e5                	mov    %esp,%ebp
+  8021e0:	57                   	push   %edi
+  8021e1:	56                   	push   %esi
+  8021e2:	53                   	push   %ebx
+  8021e3:	83 ec 14             	sub    $0x14,%esp
+  8021e6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021e9:	8b 75 14             	mov    0x14(%ebp),%esi
+  8021ec:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8021ef:	ff 75 10             	push   0x10(%ebp)
+  8021f2:	ff 75 0c             	push   0xc(%ebp)
+  8021f5:	e8 c9 e3 ff ff       	call   8005c3 <sys_ipc_recv_pages>
+  8021fa:	83 c4 10             	add    $0x10,%esp
+  8021fd:	85 c0                	test   %eax,%eax
+  8021ff:	78 46                	js     802247 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802201:	85 ff                	test   %edi,%edi
+  802203:	74 0d                	je     802212 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  802205:	a1 08 40 80 00       	mov    0x804008,%eax
+  80220a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802210:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802212:	85 f6                	test   %esi,%esi
+  802214:	74 0d                	je     802223 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  802216:	a1 08 40 80 00       	mov    0x804008,%eax
+  80221b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802221:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802223:	85 db                	test   %ebx,%ebx
+  802225:	74 0d                	je     802234 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  802227:	a1 08 40 80 00       	mov    0x804008,%eax
+  80222c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802232:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802234:	a1 08 40 80 00       	mov    0x804008,%eax
+  802239:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80223f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802242:	5b                   	pop    %ebx
+  802243:	5e                   	pop    %esi
+  802244:	5f                   	pop    %edi
+  802245:	5d                   	pop    %ebp
+  802246:	c3                   	ret
+		if (from_env_store) {
+  802247:	85 ff                	test   %edi,%edi
+  802249:	74 06                	je     802251 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80224b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802251:	85 f6                	test   %esi,%esi
+  802253:	74 06                	je     80225b <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  802255:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80225b:	85 db                	test   %ebx,%ebx
+  80225d:	74 e0                	je     80223f <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  80225f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802265:	eb d8                	jmp    80223f <ipc_recv_pages+0x62>
+
+00802267 <ipc_recv>:
+{
+  802267:	55                   	push   %ebp
+  802268:	89 e5                	mov    %esp,%ebp
+  80226a:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  80226d:	6a 00                	push   $0x0
+  80226f:	ff 75 10             	push   0x10(%ebp)
+  802272:	6a 01                	push   $0x1
+  802274:	ff 75 0c             	push   0xc(%ebp)
+  802277:	ff 75 08             	push   0x8(%ebp)
+  80227a:	e8 5e ff ff ff       	call   8021dd <ipc_recv_pages>
+}
+  80227f:	c9                   	leave
+  802280:	c3                   	ret
+
+00802281 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802281:	55                   	push   %ebp
+  802282:	89 e5                	mov    %esp,%ebp
+  802284:	56                   	push   %esi
+  802285:	53                   	push   %ebx
+  802286:	8b 75 08             	mov    0x8(%ebp),%esi
+  802289:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  80228c:	83 ec 0c             	sub    $0xc,%esp
+  80228f:	ff 75 0c             	push   0xc(%ebp)
+  802292:	e8 60 e4 ff ff       	call   8006f7 <sys_ipc_try_recv>
+  802297:	83 c4 10             	add    $0x10,%esp
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	78 34                	js     8022d2 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80229e:	85 f6                	test   %esi,%esi
+  8022a0:	74 0d                	je     8022af <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8022a2:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022a7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8022ad:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8022af:	85 db                	test   %ebx,%ebx
+  8022b1:	74 0d                	je     8022c0 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8022b3:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022b8:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8022be:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8022c0:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022c5:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8022cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022ce:	5b                   	pop    %ebx
+  8022cf:	5e                   	pop    %esi
+  8022d0:	5d                   	pop    %ebp
+  8022d1:	c3                   	ret
+		if (from_env_store) {
+  8022d2:	85 f6                	test   %esi,%esi
+  8022d4:	74 06                	je     8022dc <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8022d6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8022dc:	85 db                	test   %ebx,%ebx
+  8022de:	74 eb                	je     8022cb <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8022e0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8022e6:	eb e3                	jmp    8022cb <ipc_try_recv+0x4a>
+
+008022e8 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8022e8:	55                   	push   %ebp
+  8022e9:	89 e5                	mov    %esp,%ebp
+  8022eb:	83 ec 14             	sub    $0x14,%esp
+  8022ee:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8022f1:	85 c0                	test   %eax,%eax
+  8022f3:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8022f8:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8022fb:	ff 75 18             	push   0x18(%ebp)
+  8022fe:	ff 75 14             	push   0x14(%ebp)
+  802301:	50                   	push   %eax
+  802302:	ff 75 0c             	push   0xc(%ebp)
+  802305:	ff 75 08             	push   0x8(%ebp)
+  802308:	e8 79 e2 ff ff       	call   800586 <sys_ipc_send_pages>
+  80230d:	83 c4 20             	add    $0x20,%esp
+  802310:	85 c0                	test   %eax,%eax
+  802312:	78 02                	js     802316 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  802314:	c9                   	leave
+  802315:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  802316:	50                   	push   %eax
+  802317:	68 2c 2b 80 00       	push   $0x802b2c
+  80231c:	68 80 00 00 00       	push   $0x80
+  802321:	68 58 2b 80 00       	push   $0x802b58
+  802326:	e8 f0 f3 ff ff       	call   80171b <_panic>
+
+0080232b <ipc_send>:
+{
+  80232b:	55                   	push   %ebp
+  80232c:	89 e5                	mov    %esp,%ebp
+  80232e:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  802331:	ff 75 14             	push   0x14(%ebp)
+  802334:	6a 01                	push   $0x1
+  802336:	ff 75 10             	push   0x10(%ebp)
+  802339:	ff 75 0c             	push   0xc(%ebp)
+  80233c:	ff 75 08             	push   0x8(%ebp)
+  80233f:	e8 a4 ff ff ff       	call   8022e8 <ipc_send_pages>
+}
+  802344:	83 c4 20             	add    $0x20,%esp
+  802347:	c9                   	leave
+  802348:	c3                   	ret
+
+00802349 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802349:	55                   	push   %ebp
+  80234a:	89 e5                	mov    %esp,%ebp
+  80234c:	83 ec 14             	sub    $0x14,%esp
+  80234f:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802352:	85 c0                	test   %eax,%eax
+  802354:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802359:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80235c:	ff 75 18             	push   0x18(%ebp)
+  80235f:	ff 75 14             	push   0x14(%ebp)
+  802362:	50                   	push   %eax
+  802363:	ff 75 0c             	push   0xc(%ebp)
+  802366:	ff 75 08             	push   0x8(%ebp)
+  802369:	e8 a9 e2 ff ff       	call   800617 <sys_ipc_call>
+  80236e:	83 c4 20             	add    $0x20,%esp
+  802371:	85 c0                	test   %eax,%eax
+  802373:	78 0b                	js     802380 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  802375:	a1 08 40 80 00       	mov    0x804008,%eax
+  80237a:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802380:	c9                   	leave
+  802381:	c3                   	ret
+
+00802382 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  802382:	55                   	push   %ebp
+  802383:	89 e5                	mov    %esp,%ebp
+  802385:	57                   	push   %edi
+  802386:	56                   	push   %esi
+  802387:	53                   	push   %ebx
+  802388:	83 ec 18             	sub    $0x18,%esp
+  80238b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80238e:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  802391:	8b 75 20             	mov    0x20(%ebp),%esi
+  802394:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802397:	85 c0                	test   %eax,%eax
+  802399:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80239e:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8023a1:	ff 75 18             	push   0x18(%ebp)
+  8023a4:	ff 75 14             	push   0x14(%ebp)
+  8023a7:	50                   	push   %eax
+  8023a8:	ff 75 0c             	push   0xc(%ebp)
+  8023ab:	ff 75 08             	push   0x8(%ebp)
+  8023ae:	e8 a5 e2 ff ff       	call   800658 <sys_ipc_reply_recv>
+  8023b3:	83 c4 20             	add    $0x20,%esp
+  8023b6:	85 c0                	test   %eax,%eax
+  8023b8:	78 46                	js     802400 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8023ba:	85 ff                	test   %edi,%edi
+  8023bc:	74 0d                	je     8023cb <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8023be:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023c3:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8023c9:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8023cb:	85 f6                	test   %esi,%esi
+  8023cd:	74 0d                	je     8023dc <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8023cf:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023d4:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8023da:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8023dc:	85 db                	test   %ebx,%ebx
+  8023de:	74 0d                	je     8023ed <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8023e0:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023e5:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8023eb:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8023ed:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023f2:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8023f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023fb:	5b                   	pop    %ebx
+  8023fc:	5e                   	pop    %esi
+  8023fd:	5f                   	pop    %edi
+  8023fe:	5d                   	pop    %ebp
+  8023ff:	c3                   	ret
+		if (from_env_store) {
+  802400:	85 ff                	test   %edi,%edi
+  802402:	74 06                	je     80240a <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  802404:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80240a:	85 f6                	test   %esi,%esi
+  80240c:	74 06                	je     802414 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  80240e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802414:	85 db                	test   %ebx,%ebx
+  802416:	74 e0                	je     8023f8 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  802418:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80241e:	eb d8                	jmp    8023f8 <ipc_reply_recv+0x76>
+
+00802420 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802420:	55                   	push   %ebp
+  802421:	89 e5                	mov    %esp,%ebp
+  802423:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802426:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80242b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80242e:	c1 e0 06             	shl    $0x6,%eax
+  802431:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802436:	8b 40 50             	mov    0x50(%eax),%eax
+  802439:	39 c8                	cmp    %ecx,%eax
+  80243b:	74 12                	je     80244f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80243d:	83 c2 01             	add    $0x1,%edx
+  802440:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802446:	75 e3                	jne    80242b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802448:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244d:	eb 0e                	jmp    80245d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80244f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802452:	c1 e0 06             	shl    $0x6,%eax
+  802455:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80245a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80245d:	5d                   	pop    %ebp
+  80245e:	c3                   	ret
+
+0080245f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80245f:	55                   	push   %ebp
+  802460:	89 e5                	mov    %esp,%ebp
+  802462:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802465:	89 c2                	mov    %eax,%edx
+  802467:	c1 ea 16             	shr    $0x16,%edx
+  80246a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802471:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802476:	f6 c1 01             	test   $0x1,%cl
+  802479:	74 1e                	je     802499 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  80247b:	c1 e8 0c             	shr    $0xc,%eax
+  80247e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802485:	a8 01                	test   $0x1,%al
+  802487:	74 10                	je     802499 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802489:	c1 e8 0c             	shr    $0xc,%eax
+  80248c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80248f:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  802496:	0f b7 d2             	movzwl %dx,%edx
+}
+  802499:	89 d0                	mov    %edx,%eax
+  80249b:	5d                   	pop    %ebp
+  80249c:	c3                   	ret
+
+0080249d <udivmod>:
+  80249d:	55                   	push   %ebp
+  80249e:	57                   	push   %edi
+  80249f:	56                   	push   %esi
+  8024a0:	53                   	push   %ebx
+  8024a1:	83 ec 24             	sub    $0x24,%esp
+  8024a4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8024a8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8024ac:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8024b0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8024b4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024b8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024bc:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8024c0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024cf:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024d6:	00 
+  8024d7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024de:	00 
+  8024df:	89 fb                	mov    %edi,%ebx
+  8024e1:	eb 08                	jmp    8024eb <udivmod+0x4e>
+  8024e3:	83 e9 01             	sub    $0x1,%ecx
+  8024e6:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8024e9:	74 68                	je     802553 <udivmod+0xb6>
+  8024eb:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024ef:	01 c0                	add    %eax,%eax
+  8024f1:	89 c6                	mov    %eax,%esi
+  8024f3:	89 d7                	mov    %edx,%edi
+  8024f5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8024f9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8024fd:	0f ad d0             	shrd   %cl,%edx,%eax
+  802500:	d3 ea                	shr    %cl,%edx
+  802502:	f6 c1 20             	test   $0x20,%cl
+  802505:	74 04                	je     80250b <udivmod+0x6e>
+  802507:	89 d0                	mov    %edx,%eax
+  802509:	31 d2                	xor    %edx,%edx
+  80250b:	83 e0 01             	and    $0x1,%eax
+  80250e:	89 04 24             	mov    %eax,(%esp)
+  802511:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802518:	00 
+  802519:	8b 04 24             	mov    (%esp),%eax
+  80251c:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802520:	09 f0                	or     %esi,%eax
+  802522:	09 fa                	or     %edi,%edx
+  802524:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802528:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80252c:	39 f0                	cmp    %esi,%eax
+  80252e:	89 d5                	mov    %edx,%ebp
+  802530:	19 fd                	sbb    %edi,%ebp
+  802532:	72 af                	jb     8024e3 <udivmod+0x46>
+  802534:	29 f0                	sub    %esi,%eax
+  802536:	19 fa                	sbb    %edi,%edx
+  802538:	89 cf                	mov    %ecx,%edi
+  80253a:	c1 ef 05             	shr    $0x5,%edi
+  80253d:	83 e7 01             	and    $0x1,%edi
+  802540:	89 fe                	mov    %edi,%esi
+  802542:	83 f6 01             	xor    $0x1,%esi
+  802545:	d3 e6                	shl    %cl,%esi
+  802547:	d3 e7                	shl    %cl,%edi
+  802549:	09 74 24 18          	or     %esi,0x18(%esp)
+  80254d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802551:	eb 90                	jmp    8024e3 <udivmod+0x46>
+  802553:	85 db                	test   %ebx,%ebx
+  802555:	74 05                	je     80255c <udivmod+0xbf>
+  802557:	89 03                	mov    %eax,(%ebx)
+  802559:	89 53 04             	mov    %edx,0x4(%ebx)
+  80255c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802560:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802564:	83 c4 24             	add    $0x24,%esp
+  802567:	5b                   	pop    %ebx
+  802568:	5e                   	pop    %esi
+  802569:	5f                   	pop    %edi
+  80256a:	5d                   	pop    %ebp
+  80256b:	c3                   	ret
+
+0080256c <__udivdi3>:
+  80256c:	83 ec 08             	sub    $0x8,%esp
+  80256f:	6a 00                	push   $0x0
+  802571:	ff 74 24 1c          	push   0x1c(%esp)
+  802575:	ff 74 24 1c          	push   0x1c(%esp)
+  802579:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80257d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802581:	e8 17 ff ff ff       	call   80249d <udivmod>
+  802586:	83 c4 14             	add    $0x14,%esp
+  802589:	c3                   	ret
+
+0080258a <__umoddi3>:
+  80258a:	83 ec 18             	sub    $0x18,%esp
+  80258d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802591:	50                   	push   %eax
+  802592:	ff 74 24 2c          	push   0x2c(%esp)
+  802596:	ff 74 24 2c          	push   0x2c(%esp)
+  80259a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80259e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025a2:	e8 f6 fe ff ff       	call   80249d <udivmod>
+  8025a7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025ab:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025af:	83 c4 24             	add    $0x24,%esp
+  8025b2:	c3                   	ret
+
+008025b3 <__divdi3>:
+  8025b3:	55                   	push   %ebp
+  8025b4:	57                   	push   %edi
+  8025b5:	56                   	push   %esi
+  8025b6:	53                   	push   %ebx
+  8025b7:	83 ec 10             	sub    $0x10,%esp
+  8025ba:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8025be:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8025c2:	89 c6                	mov    %eax,%esi
+  8025c4:	89 d7                	mov    %edx,%edi
+  8025c6:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8025ca:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8025ce:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025d2:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8025d6:	89 c5                	mov    %eax,%ebp
+  8025d8:	f7 dd                	neg    %ebp
+  8025da:	89 d6                	mov    %edx,%esi
+  8025dc:	83 d6 00             	adc    $0x0,%esi
+  8025df:	f7 de                	neg    %esi
+  8025e1:	0f 48 e8             	cmovs  %eax,%ebp
+  8025e4:	0f 49 d6             	cmovns %esi,%edx
+  8025e7:	6a 00                	push   $0x0
+  8025e9:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8025ed:	f7 de                	neg    %esi
+  8025ef:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8025f3:	83 d0 00             	adc    $0x0,%eax
+  8025f6:	f7 d8                	neg    %eax
+  8025f8:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  8025fd:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  802602:	50                   	push   %eax
+  802603:	56                   	push   %esi
+  802604:	89 e8                	mov    %ebp,%eax
+  802606:	e8 92 fe ff ff       	call   80249d <udivmod>
+  80260b:	83 c4 10             	add    $0x10,%esp
+  80260e:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  802613:	78 08                	js     80261d <__divdi3+0x6a>
+  802615:	83 c4 0c             	add    $0xc,%esp
+  802618:	5b                   	pop    %ebx
+  802619:	5e                   	pop    %esi
+  80261a:	5f                   	pop    %edi
+  80261b:	5d                   	pop    %ebp
+  80261c:	c3                   	ret
+  80261d:	f7 d8                	neg    %eax
+  80261f:	83 d2 00             	adc    $0x0,%edx
+  802622:	f7 da                	neg    %edx
+  802624:	eb ef                	jmp    802615 <__divdi3+0x62>
+
+00802626 <__moddi3>:
+  802626:	55                   	push   %ebp
+  802627:	57                   	push   %edi
+  802628:	56                   	push   %esi
+  802629:	53                   	push   %ebx
+  80262a:	83 ec 18             	sub    $0x18,%esp
+  80262d:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802631:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802635:	89 f1                	mov    %esi,%ecx
+  802637:	f7 d9                	neg    %ecx
+  802639:	89 da                	mov    %ebx,%edx
+  80263b:	83 d2 00             	adc    $0x0,%edx
+  80263e:	f7 da                	neg    %edx
+  802640:	0f 48 ce             	cmovs  %esi,%ecx
+  802643:	0f 48 d3             	cmovs  %ebx,%edx
+  802646:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80264a:	50                   	push   %eax
+  80264b:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80264f:	f7 de                	neg    %esi
+  802651:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802655:	83 d0 00             	adc    $0x0,%eax
+  802658:	f7 d8                	neg    %eax
+  80265a:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80265f:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802664:	50                   	push   %eax
+  802665:	56                   	push   %esi
+  802666:	89 c8                	mov    %ecx,%eax
+  802668:	e8 30 fe ff ff       	call   80249d <udivmod>
+  80266d:	83 c4 10             	add    $0x10,%esp
+  802670:	85 db                	test   %ebx,%ebx
+  802672:	78 10                	js     802684 <__moddi3+0x5e>
+  802674:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802678:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80267c:	83 c4 14             	add    $0x14,%esp
+  80267f:	5b                   	pop    %ebx
+  802680:	5e                   	pop    %esi
+  802681:	5f                   	pop    %edi
+  802682:	5d                   	pop    %ebp
+  802683:	c3                   	ret
+  802684:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802688:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80268c:	f7 d8                	neg    %eax
+  80268e:	83 d2 00             	adc    $0x0,%edx
+  802691:	f7 da                	neg    %edx
+  802693:	eb e7                	jmp    80267c <__moddi3+0x56>
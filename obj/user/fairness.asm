@@ -0,0 +1,5606 @@
+
+obj/user/fairness.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 70 00 00 00       	call   8000a1 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+	envid_t who, id;
+
+	id = sys_getenvid();
+  80003b:	e8 f5 0b 00 00       	call   800c35 <sys_getenvid>
+  800040:	89 c3                	mov    %eax,%ebx
+
+	if (thisenv == &envs[1]) {
+  800042:	81 3d 08 40 80 00 40 	cmpl   $0xeec00140,0x804008
+  800049:	01 c0 ee 
+  80004c:	74 2d                	je     80007b <umain+0x48>
+		while (1) {
+			ipc_recv(&who, 0, 0);
+			cprintf("%x recv from %x\n", id, who);
+		}
+	} else {
+		cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  80004e:	a1 88 01 c0 ee       	mov    0xeec00188,%eax
+  800053:	83 ec 04             	sub    $0x4,%esp
+  800056:	50                   	push   %eax
+  800057:	53                   	push   %ebx
+  800058:	68 11 27 80 00       	push   $0x802711
+  80005d:	e8 37 01 00 00       	call   800199 <cprintf>
+  800062:	83 c4 10             	add    $0x10,%esp
+		while (1)
+			ipc_send(envs[1].env_id, 0, 0, 0);
+  800065:	a1 88 01 c0 ee       	mov    0xeec00188,%eax
+  80006a:	6a 00                	push   $0x0
+  80006c:	6a 00                	push   $0x0
+  80006e:	6a 00                	push   $0x0
+  800070:	50                   	push   %eax
+  800071:	e8 e6 12 00 00       	call   80135c <ipc_send>
+  800076:	83 c4 10             	add    $0x10,%esp
+  800079:	eb ea                	jmp    800065 <umain+0x32>
+			ipc_recv(&who, 0, 0);
+  80007b:	8d 75 f4             	lea    -0xc(%ebp),%esi
+  80007e:	83 ec 04             	sub    $0x4,%esp
+  800081:	6a 00                	push   $0x0
+  800083:	6a 00                	push   $0x0
+  800085:	56                   	push   %esi
+  800086:	e8 0d 12 00 00       	call   801298 <ipc_recv>
+			cprintf("%x recv from %x\n", id, who);
+  80008b:	83 c4 0c             	add    $0xc,%esp
+  80008e:	ff 75 f4             	push   -0xc(%ebp)
+  800091:	53                   	push   %ebx
+  800092:	68 00 27 80 00       	push   $0x802700
+  800097:	e8 fd 00 00 00       	call   800199 <cprintf>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	eb dd                	jmp    80007e <umain+0x4b>
+
+008000a1 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000a1:	55                   	push   %ebp
+  8000a2:	89 e5                	mov    %esp,%ebp
+  8000a4:	56                   	push   %esi
+  8000a5:	53                   	push   %ebx
+  8000a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8000ac:	e8 84 0b 00 00       	call   800c35 <sys_getenvid>
+  8000b1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000b6:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8000b9:	c1 e0 06             	shl    $0x6,%eax
+  8000bc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000c1:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000c6:	85 db                	test   %ebx,%ebx
+  8000c8:	7e 07                	jle    8000d1 <libmain+0x30>
+		binaryname = argv[0];
+  8000ca:	8b 06                	mov    (%esi),%eax
+  8000cc:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8000d1:	83 ec 08             	sub    $0x8,%esp
+  8000d4:	56                   	push   %esi
+  8000d5:	53                   	push   %ebx
+  8000d6:	e8 58 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000db:	e8 0a 00 00 00       	call   8000ea <exit>
+}
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5d                   	pop    %ebp
+  8000e9:	c3                   	ret
+
+008000ea <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000ea:	55                   	push   %ebp
+  8000eb:	89 e5                	mov    %esp,%ebp
+  8000ed:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000f0:	e8 66 15 00 00       	call   80165b <close_all>
+	sys_env_destroy(0);
+  8000f5:	83 ec 0c             	sub    $0xc,%esp
+  8000f8:	6a 00                	push   $0x0
+  8000fa:	e8 f5 0a 00 00       	call   800bf4 <sys_env_destroy>
+}
+  8000ff:	83 c4 10             	add    $0x10,%esp
+  800102:	c9                   	leave
+  800103:	c3                   	ret
+
+00800104 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800104:	55                   	push   %ebp
+  800105:	89 e5                	mov    %esp,%ebp
+  800107:	53                   	push   %ebx
+  800108:	83 ec 04             	sub    $0x4,%esp
+  80010b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80010e:	8b 13                	mov    (%ebx),%edx
+  800110:	8d 42 01             	lea    0x1(%edx),%eax
+  800113:	89 03                	mov    %eax,(%ebx)
+  800115:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800118:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80011c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800121:	74 09                	je     80012c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800123:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800127:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80012a:	c9                   	leave
+  80012b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80012c:	83 ec 08             	sub    $0x8,%esp
+  80012f:	68 ff 00 00 00       	push   $0xff
+  800134:	8d 43 08             	lea    0x8(%ebx),%eax
+  800137:	50                   	push   %eax
+  800138:	e8 69 0a 00 00       	call   800ba6 <sys_cputs>
+		b->idx = 0;
+  80013d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800143:	83 c4 10             	add    $0x10,%esp
+  800146:	eb db                	jmp    800123 <putch+0x1f>
+
+00800148 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800148:	55                   	push   %ebp
+  800149:	89 e5                	mov    %esp,%ebp
+  80014b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800151:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800158:	00 00 00 
+	b.cnt = 0;
+  80015b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800162:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800165:	ff 75 0c             	push   0xc(%ebp)
+  800168:	ff 75 08             	push   0x8(%ebp)
+  80016b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800171:	50                   	push   %eax
+  800172:	68 04 01 80 00       	push   $0x800104
+  800177:	e8 14 01 00 00       	call   800290 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80017c:	83 c4 08             	add    $0x8,%esp
+  80017f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800185:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80018b:	50                   	push   %eax
+  80018c:	e8 15 0a 00 00       	call   800ba6 <sys_cputs>
+
+	return b.cnt;
+}
+  800191:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800197:	c9                   	leave
+  800198:	c3                   	ret
+
+00800199 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800199:	55                   	push   %ebp
+  80019a:	89 e5                	mov    %esp,%ebp
+  80019c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80019f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001a2:	50                   	push   %eax
+  8001a3:	ff 75 08             	push   0x8(%ebp)
+  8001a6:	e8 9d ff ff ff       	call   800148 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001ab:	c9                   	leave
+  8001ac:	c3                   	ret
+
+008001ad <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001ad:	55                   	push   %ebp
+  8001ae:	89 e5                	mov    %esp,%ebp
+  8001b0:	57                   	push   %edi
+  8001b1:	56                   	push   %esi
+  8001b2:	53                   	push   %ebx
+  8001b3:	83 ec 1c             	sub    $0x1c,%esp
+  8001b6:	89 c7                	mov    %eax,%edi
+  8001b8:	89 d6                	mov    %edx,%esi
+  8001ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001bd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001c0:	89 d1                	mov    %edx,%ecx
+  8001c2:	89 c2                	mov    %eax,%edx
+  8001c4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001c7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001ca:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001cd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001d3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001da:	39 c2                	cmp    %eax,%edx
+  8001dc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001df:	72 3e                	jb     80021f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001e1:	83 ec 0c             	sub    $0xc,%esp
+  8001e4:	ff 75 18             	push   0x18(%ebp)
+  8001e7:	83 eb 01             	sub    $0x1,%ebx
+  8001ea:	53                   	push   %ebx
+  8001eb:	50                   	push   %eax
+  8001ec:	83 ec 08             	sub    $0x8,%esp
+  8001ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8001f2:	ff 75 e0             	push   -0x20(%ebp)
+  8001f5:	ff 75 dc             	push   -0x24(%ebp)
+  8001f8:	ff 75 d8             	push   -0x28(%ebp)
+  8001fb:	e8 c3 23 00 00       	call   8025c3 <__udivdi3>
+  800200:	83 c4 18             	add    $0x18,%esp
+  800203:	52                   	push   %edx
+  800204:	50                   	push   %eax
+  800205:	89 f2                	mov    %esi,%edx
+  800207:	89 f8                	mov    %edi,%eax
+  800209:	e8 9f ff ff ff       	call   8001ad <printnum>
+  80020e:	83 c4 20             	add    $0x20,%esp
+  800211:	eb 13                	jmp    800226 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800213:	83 ec 08             	sub    $0x8,%esp
+  800216:	56                   	push   %esi
+  800217:	ff 75 18             	push   0x18(%ebp)
+  80021a:	ff d7                	call   *%edi
+  80021c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80021f:	83 eb 01             	sub    $0x1,%ebx
+  800222:	85 db                	test   %ebx,%ebx
+  800224:	7f ed                	jg     800213 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800226:	83 ec 08             	sub    $0x8,%esp
+  800229:	56                   	push   %esi
+  80022a:	83 ec 04             	sub    $0x4,%esp
+  80022d:	ff 75 e4             	push   -0x1c(%ebp)
+  800230:	ff 75 e0             	push   -0x20(%ebp)
+  800233:	ff 75 dc             	push   -0x24(%ebp)
+  800236:	ff 75 d8             	push   -0x28(%ebp)
+  800239:	e8 a3 23 00 00       	call   8025e1 <__umoddi3>
+  80023e:	83 c4 14             	add    $0x14,%esp
+  800241:	0f be 80 32 27 80 00 	movsbl 0x802732(%eax),%eax
+  800248:	50                   	push   %eax
+  800249:	ff d7                	call   *%edi
+}
+  80024b:	83 c4 10             	add    $0x10,%esp
+  80024e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800251:	5b                   	pop    %ebx
+  800252:	5e                   	pop    %esi
+  800253:	5f                   	pop    %edi
+  800254:	5d                   	pop    %ebp
+  800255:	c3                   	ret
+
+00800256 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800256:	55                   	push   %ebp
+  800257:	89 e5                	mov    %esp,%ebp
+  800259:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80025c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800260:	8b 10                	mov    (%eax),%edx
+  800262:	3b 50 04             	cmp    0x4(%eax),%edx
+  800265:	73 0a                	jae    800271 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800267:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80026a:	89 08                	mov    %ecx,(%eax)
+  80026c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80026f:	88 02                	mov    %al,(%edx)
+}
+  800271:	5d                   	pop    %ebp
+  800272:	c3                   	ret
+
+00800273 <printfmt>:
+{
+  800273:	55                   	push   %ebp
+  800274:	89 e5                	mov    %esp,%ebp
+  800276:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800279:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80027c:	50                   	push   %eax
+  80027d:	ff 75 10             	push   0x10(%ebp)
+  800280:	ff 75 0c             	push   0xc(%ebp)
+  800283:	ff 75 08             	push   0x8(%ebp)
+  800286:	e8 05 00 00 00       	call   800290 <vprintfmt>
+}
+  80028b:	83 c4 10             	add    $0x10,%esp
+  80028e:	c9                   	leave
+  80028f:	c3                   	ret
+
+00800290 <vprintfmt>:
+{
+  800290:	55                   	push   %ebp
+  800291:	89 e5                	mov    %esp,%ebp
+  800293:	57                   	push   %edi
+  800294:	56                   	push   %esi
+  800295:	53                   	push   %ebx
+  800296:	83 ec 2c             	sub    $0x2c,%esp
+  800299:	8b 75 08             	mov    0x8(%ebp),%esi
+  80029c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80029f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002a2:	eb 0a                	jmp    8002ae <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002a4:	83 ec 08             	sub    $0x8,%esp
+  8002a7:	53                   	push   %ebx
+  8002a8:	50                   	push   %eax
+  8002a9:	ff d6                	call   *%esi
+  8002ab:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002ae:	83 c7 01             	add    $0x1,%edi
+  8002b1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002b5:	83 f8 25             	cmp    $0x25,%eax
+  8002b8:	74 0c                	je     8002c6 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002ba:	85 c0                	test   %eax,%eax
+  8002bc:	75 e6                	jne    8002a4 <vprintfmt+0x14>
+}
+  8002be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c1:	5b                   	pop    %ebx
+  8002c2:	5e                   	pop    %esi
+  8002c3:	5f                   	pop    %edi
+  8002c4:	5d                   	pop    %ebp
+  8002c5:	c3                   	ret
+		padc = ' ';
+  8002c6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002ca:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002d1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002d8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002df:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002e4:	8d 47 01             	lea    0x1(%edi),%eax
+  8002e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002ea:	0f b6 17             	movzbl (%edi),%edx
+  8002ed:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002f0:	3c 55                	cmp    $0x55,%al
+  8002f2:	0f 87 c5 03 00 00    	ja     8006bd <vprintfmt+0x42d>
+  8002f8:	0f b6 c0             	movzbl %al,%eax
+  8002fb:	ff 24 85 c0 28 80 00 	jmp    *0x8028c0(,%eax,4)
+  800302:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800305:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800309:	eb d9                	jmp    8002e4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80030b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80030e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800312:	eb d0                	jmp    8002e4 <vprintfmt+0x54>
+  800314:	0f b6 d2             	movzbl %dl,%edx
+  800317:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80031a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800322:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800325:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800329:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80032c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80032f:	83 f9 09             	cmp    $0x9,%ecx
+  800332:	77 55                	ja     800389 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800334:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800337:	eb e9                	jmp    800322 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800339:	8b 45 14             	mov    0x14(%ebp),%eax
+  80033c:	8b 00                	mov    (%eax),%eax
+  80033e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800341:	8b 45 14             	mov    0x14(%ebp),%eax
+  800344:	8d 40 04             	lea    0x4(%eax),%eax
+  800347:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80034a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80034d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800351:	79 91                	jns    8002e4 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800353:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800356:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800359:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800360:	eb 82                	jmp    8002e4 <vprintfmt+0x54>
+			if (width < 0)
+  800362:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800365:	85 d2                	test   %edx,%edx
+  800367:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036c:	0f 49 c2             	cmovns %edx,%eax
+  80036f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800372:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800375:	e9 6a ff ff ff       	jmp    8002e4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80037a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80037d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800384:	e9 5b ff ff ff       	jmp    8002e4 <vprintfmt+0x54>
+  800389:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80038c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80038f:	eb bc                	jmp    80034d <vprintfmt+0xbd>
+			lflag++;
+  800391:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800394:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800397:	e9 48 ff ff ff       	jmp    8002e4 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80039c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039f:	8d 78 04             	lea    0x4(%eax),%edi
+  8003a2:	83 ec 08             	sub    $0x8,%esp
+  8003a5:	53                   	push   %ebx
+  8003a6:	ff 30                	push   (%eax)
+  8003a8:	ff d6                	call   *%esi
+			break;
+  8003aa:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003ad:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003b0:	e9 63 02 00 00       	jmp    800618 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8003b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b8:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003bb:	8b 10                	mov    (%eax),%edx
+  8003bd:	89 d0                	mov    %edx,%eax
+  8003bf:	f7 d8                	neg    %eax
+  8003c1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003c4:	83 f8 12             	cmp    $0x12,%eax
+  8003c7:	7f 23                	jg     8003ec <vprintfmt+0x15c>
+  8003c9:	8b 14 85 20 2a 80 00 	mov    0x802a20(,%eax,4),%edx
+  8003d0:	85 d2                	test   %edx,%edx
+  8003d2:	74 18                	je     8003ec <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003d4:	52                   	push   %edx
+  8003d5:	68 95 2b 80 00       	push   $0x802b95
+  8003da:	53                   	push   %ebx
+  8003db:	56                   	push   %esi
+  8003dc:	e8 92 fe ff ff       	call   800273 <printfmt>
+  8003e1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003e4:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003e7:	e9 2c 02 00 00       	jmp    800618 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  8003ec:	50                   	push   %eax
+  8003ed:	68 4a 27 80 00       	push   $0x80274a
+  8003f2:	53                   	push   %ebx
+  8003f3:	56                   	push   %esi
+  8003f4:	e8 7a fe ff ff       	call   800273 <printfmt>
+  8003f9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003fc:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003ff:	e9 14 02 00 00       	jmp    800618 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800404:	8b 45 14             	mov    0x14(%ebp),%eax
+  800407:	83 c0 04             	add    $0x4,%eax
+  80040a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80040d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800410:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800412:	85 c9                	test   %ecx,%ecx
+  800414:	b8 43 27 80 00       	mov    $0x802743,%eax
+  800419:	0f 45 c1             	cmovne %ecx,%eax
+  80041c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80041f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800423:	7e 06                	jle    80042b <vprintfmt+0x19b>
+  800425:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800429:	75 0b                	jne    800436 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80042b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80042e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800431:	89 75 08             	mov    %esi,0x8(%ebp)
+  800434:	eb 5c                	jmp    800492 <vprintfmt+0x202>
+  800436:	83 ec 08             	sub    $0x8,%esp
+  800439:	ff 75 d0             	push   -0x30(%ebp)
+  80043c:	ff 75 cc             	push   -0x34(%ebp)
+  80043f:	e8 19 03 00 00       	call   80075d <strnlen>
+  800444:	89 c2                	mov    %eax,%edx
+  800446:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800449:	29 d0                	sub    %edx,%eax
+  80044b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80044e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800452:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800455:	89 75 08             	mov    %esi,0x8(%ebp)
+  800458:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80045a:	eb 0e                	jmp    80046a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80045c:	83 ec 08             	sub    $0x8,%esp
+  80045f:	53                   	push   %ebx
+  800460:	57                   	push   %edi
+  800461:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800464:	83 ee 01             	sub    $0x1,%esi
+  800467:	83 c4 10             	add    $0x10,%esp
+  80046a:	85 f6                	test   %esi,%esi
+  80046c:	7f ee                	jg     80045c <vprintfmt+0x1cc>
+  80046e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800471:	8b 75 08             	mov    0x8(%ebp),%esi
+  800474:	85 c0                	test   %eax,%eax
+  800476:	ba 00 00 00 00       	mov    $0x0,%edx
+  80047b:	0f 49 d0             	cmovns %eax,%edx
+  80047e:	29 d0                	sub    %edx,%eax
+  800480:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800483:	eb a6                	jmp    80042b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800485:	83 ec 08             	sub    $0x8,%esp
+  800488:	53                   	push   %ebx
+  800489:	52                   	push   %edx
+  80048a:	ff 55 08             	call   *0x8(%ebp)
+  80048d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800490:	89 f1                	mov    %esi,%ecx
+  800492:	8d 71 01             	lea    0x1(%ecx),%esi
+  800495:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800499:	0f be d0             	movsbl %al,%edx
+  80049c:	85 d2                	test   %edx,%edx
+  80049e:	74 28                	je     8004c8 <vprintfmt+0x238>
+  8004a0:	85 ff                	test   %edi,%edi
+  8004a2:	78 05                	js     8004a9 <vprintfmt+0x219>
+  8004a4:	83 ef 01             	sub    $0x1,%edi
+  8004a7:	78 30                	js     8004d9 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004a9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004ad:	74 d6                	je     800485 <vprintfmt+0x1f5>
+  8004af:	0f be c0             	movsbl %al,%eax
+  8004b2:	83 e8 20             	sub    $0x20,%eax
+  8004b5:	83 f8 5e             	cmp    $0x5e,%eax
+  8004b8:	76 cb                	jbe    800485 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004ba:	83 ec 08             	sub    $0x8,%esp
+  8004bd:	53                   	push   %ebx
+  8004be:	6a 3f                	push   $0x3f
+  8004c0:	ff 55 08             	call   *0x8(%ebp)
+  8004c3:	83 c4 10             	add    $0x10,%esp
+  8004c6:	eb c8                	jmp    800490 <vprintfmt+0x200>
+  8004c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004cb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ce:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d1:	01 d0                	add    %edx,%eax
+  8004d3:	29 c8                	sub    %ecx,%eax
+  8004d5:	89 c7                	mov    %eax,%edi
+  8004d7:	eb 13                	jmp    8004ec <vprintfmt+0x25c>
+  8004d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004dc:	eb ed                	jmp    8004cb <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004de:	83 ec 08             	sub    $0x8,%esp
+  8004e1:	53                   	push   %ebx
+  8004e2:	6a 20                	push   $0x20
+  8004e4:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004e6:	83 ef 01             	sub    $0x1,%edi
+  8004e9:	83 c4 10             	add    $0x10,%esp
+  8004ec:	85 ff                	test   %edi,%edi
+  8004ee:	7f ee                	jg     8004de <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004f0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004f6:	e9 1d 01 00 00       	jmp    800618 <vprintfmt+0x388>
+	if (lflag >= 2)
+  8004fb:	83 f9 01             	cmp    $0x1,%ecx
+  8004fe:	7f 1b                	jg     80051b <vprintfmt+0x28b>
+	else if (lflag)
+  800500:	85 c9                	test   %ecx,%ecx
+  800502:	74 63                	je     800567 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800504:	8b 45 14             	mov    0x14(%ebp),%eax
+  800507:	8b 00                	mov    (%eax),%eax
+  800509:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80050c:	99                   	cltd
+  80050d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800510:	8b 45 14             	mov    0x14(%ebp),%eax
+  800513:	8d 40 04             	lea    0x4(%eax),%eax
+  800516:	89 45 14             	mov    %eax,0x14(%ebp)
+  800519:	eb 17                	jmp    800532 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80051b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051e:	8b 50 04             	mov    0x4(%eax),%edx
+  800521:	8b 00                	mov    (%eax),%eax
+  800523:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800526:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800529:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052c:	8d 40 08             	lea    0x8(%eax),%eax
+  80052f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800532:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800535:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800538:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80053d:	85 c9                	test   %ecx,%ecx
+  80053f:	0f 89 b9 00 00 00    	jns    8005fe <vprintfmt+0x36e>
+				putch('-', putdat);
+  800545:	83 ec 08             	sub    $0x8,%esp
+  800548:	53                   	push   %ebx
+  800549:	6a 2d                	push   $0x2d
+  80054b:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80054d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800550:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800553:	f7 da                	neg    %edx
+  800555:	83 d1 00             	adc    $0x0,%ecx
+  800558:	f7 d9                	neg    %ecx
+  80055a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80055d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800562:	e9 97 00 00 00       	jmp    8005fe <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800567:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056a:	8b 00                	mov    (%eax),%eax
+  80056c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80056f:	99                   	cltd
+  800570:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800573:	8b 45 14             	mov    0x14(%ebp),%eax
+  800576:	8d 40 04             	lea    0x4(%eax),%eax
+  800579:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057c:	eb b4                	jmp    800532 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  80057e:	83 f9 01             	cmp    $0x1,%ecx
+  800581:	7f 1b                	jg     80059e <vprintfmt+0x30e>
+	else if (lflag)
+  800583:	85 c9                	test   %ecx,%ecx
+  800585:	74 2c                	je     8005b3 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800587:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058a:	8b 10                	mov    (%eax),%edx
+  80058c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800591:	8d 40 04             	lea    0x4(%eax),%eax
+  800594:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800597:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80059c:	eb 60                	jmp    8005fe <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80059e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a1:	8b 10                	mov    (%eax),%edx
+  8005a3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005a6:	8d 40 08             	lea    0x8(%eax),%eax
+  8005a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005ac:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005b1:	eb 4b                	jmp    8005fe <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8005b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b6:	8b 10                	mov    (%eax),%edx
+  8005b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005c3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005c8:	eb 34                	jmp    8005fe <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8005ca:	83 f9 01             	cmp    $0x1,%ecx
+  8005cd:	7f 15                	jg     8005e4 <vprintfmt+0x354>
+	else if (lflag)
+  8005cf:	85 c9                	test   %ecx,%ecx
+  8005d1:	74 4d                	je     800620 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8005d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d6:	8b 00                	mov    (%eax),%eax
+  8005d8:	99                   	cltd
+  8005d9:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005dc:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8005df:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8005e2:	eb 11                	jmp    8005f5 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  8005e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e7:	8b 50 04             	mov    0x4(%eax),%edx
+  8005ea:	8b 00                	mov    (%eax),%eax
+  8005ec:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005ef:	8d 49 08             	lea    0x8(%ecx),%ecx
+  8005f2:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  8005f5:	89 d1                	mov    %edx,%ecx
+  8005f7:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  8005f9:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005fe:	83 ec 0c             	sub    $0xc,%esp
+  800601:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800605:	50                   	push   %eax
+  800606:	ff 75 e0             	push   -0x20(%ebp)
+  800609:	57                   	push   %edi
+  80060a:	51                   	push   %ecx
+  80060b:	52                   	push   %edx
+  80060c:	89 da                	mov    %ebx,%edx
+  80060e:	89 f0                	mov    %esi,%eax
+  800610:	e8 98 fb ff ff       	call   8001ad <printnum>
+			break;
+  800615:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800618:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80061b:	e9 8e fc ff ff       	jmp    8002ae <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800620:	8b 45 14             	mov    0x14(%ebp),%eax
+  800623:	8b 00                	mov    (%eax),%eax
+  800625:	99                   	cltd
+  800626:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800629:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80062c:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80062f:	eb c4                	jmp    8005f5 <vprintfmt+0x365>
+			putch('0', putdat);
+  800631:	83 ec 08             	sub    $0x8,%esp
+  800634:	53                   	push   %ebx
+  800635:	6a 30                	push   $0x30
+  800637:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800639:	83 c4 08             	add    $0x8,%esp
+  80063c:	53                   	push   %ebx
+  80063d:	6a 78                	push   $0x78
+  80063f:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800641:	8b 45 14             	mov    0x14(%ebp),%eax
+  800644:	8b 10                	mov    (%eax),%edx
+  800646:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80064b:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80064e:	8d 40 04             	lea    0x4(%eax),%eax
+  800651:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800654:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800659:	eb a3                	jmp    8005fe <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80065b:	83 f9 01             	cmp    $0x1,%ecx
+  80065e:	7f 1b                	jg     80067b <vprintfmt+0x3eb>
+	else if (lflag)
+  800660:	85 c9                	test   %ecx,%ecx
+  800662:	74 2f                	je     800693 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800664:	8b 45 14             	mov    0x14(%ebp),%eax
+  800667:	8b 10                	mov    (%eax),%edx
+  800669:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066e:	8d 40 04             	lea    0x4(%eax),%eax
+  800671:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800674:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800679:	eb 83                	jmp    8005fe <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	8b 10                	mov    (%eax),%edx
+  800680:	8b 48 04             	mov    0x4(%eax),%ecx
+  800683:	8d 40 08             	lea    0x8(%eax),%eax
+  800686:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800689:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80068e:	e9 6b ff ff ff       	jmp    8005fe <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800693:	8b 45 14             	mov    0x14(%ebp),%eax
+  800696:	8b 10                	mov    (%eax),%edx
+  800698:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069d:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006a8:	e9 51 ff ff ff       	jmp    8005fe <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8006ad:	83 ec 08             	sub    $0x8,%esp
+  8006b0:	53                   	push   %ebx
+  8006b1:	6a 25                	push   $0x25
+  8006b3:	ff d6                	call   *%esi
+			break;
+  8006b5:	83 c4 10             	add    $0x10,%esp
+  8006b8:	e9 5b ff ff ff       	jmp    800618 <vprintfmt+0x388>
+			putch('%', putdat);
+  8006bd:	83 ec 08             	sub    $0x8,%esp
+  8006c0:	53                   	push   %ebx
+  8006c1:	6a 25                	push   $0x25
+  8006c3:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006c5:	83 c4 10             	add    $0x10,%esp
+  8006c8:	89 f8                	mov    %edi,%eax
+  8006ca:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006ce:	74 05                	je     8006d5 <vprintfmt+0x445>
+  8006d0:	83 e8 01             	sub    $0x1,%eax
+  8006d3:	eb f5                	jmp    8006ca <vprintfmt+0x43a>
+  8006d5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006d8:	e9 3b ff ff ff       	jmp    800618 <vprintfmt+0x388>
+
+008006dd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006dd:	55                   	push   %ebp
+  8006de:	89 e5                	mov    %esp,%ebp
+  8006e0:	83 ec 18             	sub    $0x18,%esp
+  8006e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006e9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006ec:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006f0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006f3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006fa:	85 c0                	test   %eax,%eax
+  8006fc:	74 26                	je     800724 <vsnprintf+0x47>
+  8006fe:	85 d2                	test   %edx,%edx
+  800700:	7e 22                	jle    800724 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800702:	ff 75 14             	push   0x14(%ebp)
+  800705:	ff 75 10             	push   0x10(%ebp)
+  800708:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80070b:	50                   	push   %eax
+  80070c:	68 56 02 80 00       	push   $0x800256
+  800711:	e8 7a fb ff ff       	call   800290 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800716:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800719:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80071c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80071f:	83 c4 10             	add    $0x10,%esp
+}
+  800722:	c9                   	leave
+  800723:	c3                   	ret
+		return -E_INVAL;
+  800724:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800729:	eb f7                	jmp    800722 <vsnprintf+0x45>
+
+0080072b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80072b:	55                   	push   %ebp
+  80072c:	89 e5                	mov    %esp,%ebp
+  80072e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800731:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800734:	50                   	push   %eax
+  800735:	ff 75 10             	push   0x10(%ebp)
+  800738:	ff 75 0c             	push   0xc(%ebp)
+  80073b:	ff 75 08             	push   0x8(%ebp)
+  80073e:	e8 9a ff ff ff       	call   8006dd <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800743:	c9                   	leave
+  800744:	c3                   	ret
+
+00800745 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800745:	55                   	push   %ebp
+  800746:	89 e5                	mov    %esp,%ebp
+  800748:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80074b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800750:	eb 03                	jmp    800755 <strlen+0x10>
+		n++;
+  800752:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800755:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800759:	75 f7                	jne    800752 <strlen+0xd>
+	return n;
+}
+  80075b:	5d                   	pop    %ebp
+  80075c:	c3                   	ret
+
+0080075d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80075d:	55                   	push   %ebp
+  80075e:	89 e5                	mov    %esp,%ebp
+  800760:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800763:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800766:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076b:	eb 03                	jmp    800770 <strnlen+0x13>
+		n++;
+  80076d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800770:	39 d0                	cmp    %edx,%eax
+  800772:	74 08                	je     80077c <strnlen+0x1f>
+  800774:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800778:	75 f3                	jne    80076d <strnlen+0x10>
+  80077a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80077c:	89 d0                	mov    %edx,%eax
+  80077e:	5d                   	pop    %ebp
+  80077f:	c3                   	ret
+
+00800780 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800780:	55                   	push   %ebp
+  800781:	89 e5                	mov    %esp,%ebp
+  800783:	53                   	push   %ebx
+  800784:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800787:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80078a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800793:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800796:	83 c0 01             	add    $0x1,%eax
+  800799:	84 d2                	test   %dl,%dl
+  80079b:	75 f2                	jne    80078f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80079d:	89 c8                	mov    %ecx,%eax
+  80079f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007a2:	c9                   	leave
+  8007a3:	c3                   	ret
+
+008007a4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007a4:	55                   	push   %ebp
+  8007a5:	89 e5                	mov    %esp,%ebp
+  8007a7:	53                   	push   %ebx
+  8007a8:	83 ec 10             	sub    $0x10,%esp
+  8007ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007ae:	53                   	push   %ebx
+  8007af:	e8 91 ff ff ff       	call   800745 <strlen>
+  8007b4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007b7:	ff 75 0c             	push   0xc(%ebp)
+  8007ba:	01 d8                	add    %ebx,%eax
+  8007bc:	50                   	push   %eax
+  8007bd:	e8 be ff ff ff       	call   800780 <strcpy>
+	return dst;
+}
+  8007c2:	89 d8                	mov    %ebx,%eax
+  8007c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c7:	c9                   	leave
+  8007c8:	c3                   	ret
+
+008007c9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007c9:	55                   	push   %ebp
+  8007ca:	89 e5                	mov    %esp,%ebp
+  8007cc:	56                   	push   %esi
+  8007cd:	53                   	push   %ebx
+  8007ce:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007d4:	89 f3                	mov    %esi,%ebx
+  8007d6:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007d9:	89 f0                	mov    %esi,%eax
+  8007db:	eb 0f                	jmp    8007ec <strncpy+0x23>
+		*dst++ = *src;
+  8007dd:	83 c0 01             	add    $0x1,%eax
+  8007e0:	0f b6 0a             	movzbl (%edx),%ecx
+  8007e3:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007e6:	80 f9 01             	cmp    $0x1,%cl
+  8007e9:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007ec:	39 d8                	cmp    %ebx,%eax
+  8007ee:	75 ed                	jne    8007dd <strncpy+0x14>
+	}
+	return ret;
+}
+  8007f0:	89 f0                	mov    %esi,%eax
+  8007f2:	5b                   	pop    %ebx
+  8007f3:	5e                   	pop    %esi
+  8007f4:	5d                   	pop    %ebp
+  8007f5:	c3                   	ret
+
+008007f6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007f6:	55                   	push   %ebp
+  8007f7:	89 e5                	mov    %esp,%ebp
+  8007f9:	56                   	push   %esi
+  8007fa:	53                   	push   %ebx
+  8007fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800801:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800804:	89 f0                	mov    %esi,%eax
+  800806:	85 d2                	test   %edx,%edx
+  800808:	74 21                	je     80082b <strlcpy+0x35>
+  80080a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80080e:	89 f2                	mov    %esi,%edx
+  800810:	eb 09                	jmp    80081b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800812:	83 c1 01             	add    $0x1,%ecx
+  800815:	83 c2 01             	add    $0x1,%edx
+  800818:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80081b:	39 c2                	cmp    %eax,%edx
+  80081d:	74 09                	je     800828 <strlcpy+0x32>
+  80081f:	0f b6 19             	movzbl (%ecx),%ebx
+  800822:	84 db                	test   %bl,%bl
+  800824:	75 ec                	jne    800812 <strlcpy+0x1c>
+  800826:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800828:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80082b:	29 f0                	sub    %esi,%eax
+}
+  80082d:	5b                   	pop    %ebx
+  80082e:	5e                   	pop    %esi
+  80082f:	5d                   	pop    %ebp
+  800830:	c3                   	ret
+
+00800831 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800831:	55                   	push   %ebp
+  800832:	89 e5                	mov    %esp,%ebp
+  800834:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800837:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80083a:	eb 06                	jmp    800842 <strcmp+0x11>
+		p++, q++;
+  80083c:	83 c1 01             	add    $0x1,%ecx
+  80083f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800842:	0f b6 01             	movzbl (%ecx),%eax
+  800845:	84 c0                	test   %al,%al
+  800847:	74 04                	je     80084d <strcmp+0x1c>
+  800849:	3a 02                	cmp    (%edx),%al
+  80084b:	74 ef                	je     80083c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80084d:	0f b6 c0             	movzbl %al,%eax
+  800850:	0f b6 12             	movzbl (%edx),%edx
+  800853:	29 d0                	sub    %edx,%eax
+}
+  800855:	5d                   	pop    %ebp
+  800856:	c3                   	ret
+
+00800857 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800857:	55                   	push   %ebp
+  800858:	89 e5                	mov    %esp,%ebp
+  80085a:	53                   	push   %ebx
+  80085b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80085e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800861:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800864:	eb 09                	jmp    80086f <strncmp+0x18>
+		n--, p++, q++;
+  800866:	83 ea 01             	sub    $0x1,%edx
+  800869:	83 c0 01             	add    $0x1,%eax
+  80086c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80086f:	85 d2                	test   %edx,%edx
+  800871:	74 18                	je     80088b <strncmp+0x34>
+  800873:	0f b6 18             	movzbl (%eax),%ebx
+  800876:	84 db                	test   %bl,%bl
+  800878:	74 04                	je     80087e <strncmp+0x27>
+  80087a:	3a 19                	cmp    (%ecx),%bl
+  80087c:	74 e8                	je     800866 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80087e:	0f b6 00             	movzbl (%eax),%eax
+  800881:	0f b6 11             	movzbl (%ecx),%edx
+  800884:	29 d0                	sub    %edx,%eax
+}
+  800886:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800889:	c9                   	leave
+  80088a:	c3                   	ret
+		return 0;
+  80088b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800890:	eb f4                	jmp    800886 <strncmp+0x2f>
+
+00800892 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800892:	55                   	push   %ebp
+  800893:	89 e5                	mov    %esp,%ebp
+  800895:	8b 45 08             	mov    0x8(%ebp),%eax
+  800898:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80089c:	eb 03                	jmp    8008a1 <strchr+0xf>
+  80089e:	83 c0 01             	add    $0x1,%eax
+  8008a1:	0f b6 10             	movzbl (%eax),%edx
+  8008a4:	84 d2                	test   %dl,%dl
+  8008a6:	74 06                	je     8008ae <strchr+0x1c>
+		if (*s == c)
+  8008a8:	38 ca                	cmp    %cl,%dl
+  8008aa:	75 f2                	jne    80089e <strchr+0xc>
+  8008ac:	eb 05                	jmp    8008b3 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008b3:	5d                   	pop    %ebp
+  8008b4:	c3                   	ret
+
+008008b5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008b5:	55                   	push   %ebp
+  8008b6:	89 e5                	mov    %esp,%ebp
+  8008b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008bb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008bf:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008c2:	38 ca                	cmp    %cl,%dl
+  8008c4:	74 09                	je     8008cf <strfind+0x1a>
+  8008c6:	84 d2                	test   %dl,%dl
+  8008c8:	74 05                	je     8008cf <strfind+0x1a>
+	for (; *s; s++)
+  8008ca:	83 c0 01             	add    $0x1,%eax
+  8008cd:	eb f0                	jmp    8008bf <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008cf:	5d                   	pop    %ebp
+  8008d0:	c3                   	ret
+
+008008d1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008d1:	55                   	push   %ebp
+  8008d2:	89 e5                	mov    %esp,%ebp
+  8008d4:	57                   	push   %edi
+  8008d5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008d8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008db:	85 c9                	test   %ecx,%ecx
+  8008dd:	74 20                	je     8008ff <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008df:	89 f8                	mov    %edi,%eax
+  8008e1:	09 c8                	or     %ecx,%eax
+  8008e3:	a8 03                	test   $0x3,%al
+  8008e5:	75 12                	jne    8008f9 <memset+0x28>
+		c &= 0xFF;
+  8008e7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008eb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008f1:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008f4:	fc                   	cld
+  8008f5:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008f7:	eb 06                	jmp    8008ff <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008fc:	fc                   	cld
+  8008fd:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008ff:	89 f8                	mov    %edi,%eax
+  800901:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800904:	c9                   	leave
+  800905:	c3                   	ret
+
+00800906 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800906:	55                   	push   %ebp
+  800907:	89 e5                	mov    %esp,%ebp
+  800909:	57                   	push   %edi
+  80090a:	56                   	push   %esi
+  80090b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800911:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800914:	39 c6                	cmp    %eax,%esi
+  800916:	73 32                	jae    80094a <memmove+0x44>
+  800918:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80091b:	39 d0                	cmp    %edx,%eax
+  80091d:	73 2b                	jae    80094a <memmove+0x44>
+		s += n;
+		d += n;
+  80091f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800922:	89 d6                	mov    %edx,%esi
+  800924:	09 fe                	or     %edi,%esi
+  800926:	09 ce                	or     %ecx,%esi
+  800928:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80092e:	75 0e                	jne    80093e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800930:	83 ef 04             	sub    $0x4,%edi
+  800933:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800936:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800939:	fd                   	std
+  80093a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80093c:	eb 09                	jmp    800947 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80093e:	83 ef 01             	sub    $0x1,%edi
+  800941:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800944:	fd                   	std
+  800945:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800947:	fc                   	cld
+  800948:	eb 1a                	jmp    800964 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80094a:	89 f2                	mov    %esi,%edx
+  80094c:	09 c2                	or     %eax,%edx
+  80094e:	09 ca                	or     %ecx,%edx
+  800950:	f6 c2 03             	test   $0x3,%dl
+  800953:	75 0a                	jne    80095f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800955:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800958:	89 c7                	mov    %eax,%edi
+  80095a:	fc                   	cld
+  80095b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80095d:	eb 05                	jmp    800964 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80095f:	89 c7                	mov    %eax,%edi
+  800961:	fc                   	cld
+  800962:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800964:	5e                   	pop    %esi
+  800965:	5f                   	pop    %edi
+  800966:	5d                   	pop    %ebp
+  800967:	c3                   	ret
+
+00800968 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800968:	55                   	push   %ebp
+  800969:	89 e5                	mov    %esp,%ebp
+  80096b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80096e:	ff 75 10             	push   0x10(%ebp)
+  800971:	ff 75 0c             	push   0xc(%ebp)
+  800974:	ff 75 08             	push   0x8(%ebp)
+  800977:	e8 8a ff ff ff       	call   800906 <memmove>
+}
+  80097c:	c9                   	leave
+  80097d:	c3                   	ret
+
+0080097e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80097e:	55                   	push   %ebp
+  80097f:	89 e5                	mov    %esp,%ebp
+  800981:	56                   	push   %esi
+  800982:	53                   	push   %ebx
+  800983:	8b 45 08             	mov    0x8(%ebp),%eax
+  800986:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800989:	89 c6                	mov    %eax,%esi
+  80098b:	03 75 10             	add    0x10(%ebp),%esi
+  80098e:	eb 06                	jmp    800996 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800990:	83 c0 01             	add    $0x1,%eax
+  800993:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800996:	39 f0                	cmp    %esi,%eax
+  800998:	74 14                	je     8009ae <memcmp+0x30>
+		if (*s1 != *s2)
+  80099a:	0f b6 08             	movzbl (%eax),%ecx
+  80099d:	0f b6 1a             	movzbl (%edx),%ebx
+  8009a0:	38 d9                	cmp    %bl,%cl
+  8009a2:	74 ec                	je     800990 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009a4:	0f b6 c1             	movzbl %cl,%eax
+  8009a7:	0f b6 db             	movzbl %bl,%ebx
+  8009aa:	29 d8                	sub    %ebx,%eax
+  8009ac:	eb 05                	jmp    8009b3 <memcmp+0x35>
+	}
+
+	return 0;
+  8009ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009b3:	5b                   	pop    %ebx
+  8009b4:	5e                   	pop    %esi
+  8009b5:	5d                   	pop    %ebp
+  8009b6:	c3                   	ret
+
+008009b7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009b7:	55                   	push   %ebp
+  8009b8:	89 e5                	mov    %esp,%ebp
+  8009ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009c0:	89 c2                	mov    %eax,%edx
+  8009c2:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009c5:	eb 03                	jmp    8009ca <memfind+0x13>
+  8009c7:	83 c0 01             	add    $0x1,%eax
+  8009ca:	39 d0                	cmp    %edx,%eax
+  8009cc:	73 04                	jae    8009d2 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009ce:	38 08                	cmp    %cl,(%eax)
+  8009d0:	75 f5                	jne    8009c7 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009d2:	5d                   	pop    %ebp
+  8009d3:	c3                   	ret
+
+008009d4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009d4:	55                   	push   %ebp
+  8009d5:	89 e5                	mov    %esp,%ebp
+  8009d7:	57                   	push   %edi
+  8009d8:	56                   	push   %esi
+  8009d9:	53                   	push   %ebx
+  8009da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009e0:	eb 03                	jmp    8009e5 <strtol+0x11>
+		s++;
+  8009e2:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009e5:	0f b6 02             	movzbl (%edx),%eax
+  8009e8:	3c 20                	cmp    $0x20,%al
+  8009ea:	74 f6                	je     8009e2 <strtol+0xe>
+  8009ec:	3c 09                	cmp    $0x9,%al
+  8009ee:	74 f2                	je     8009e2 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009f0:	3c 2b                	cmp    $0x2b,%al
+  8009f2:	74 2a                	je     800a1e <strtol+0x4a>
+	int neg = 0;
+  8009f4:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009f9:	3c 2d                	cmp    $0x2d,%al
+  8009fb:	74 2b                	je     800a28 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009fd:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a03:	75 0f                	jne    800a14 <strtol+0x40>
+  800a05:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a08:	74 28                	je     800a32 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a0a:	85 db                	test   %ebx,%ebx
+  800a0c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a11:	0f 44 d8             	cmove  %eax,%ebx
+  800a14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a19:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a1c:	eb 46                	jmp    800a64 <strtol+0x90>
+		s++;
+  800a1e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a21:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a26:	eb d5                	jmp    8009fd <strtol+0x29>
+		s++, neg = 1;
+  800a28:	83 c2 01             	add    $0x1,%edx
+  800a2b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a30:	eb cb                	jmp    8009fd <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a32:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a36:	74 0e                	je     800a46 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a38:	85 db                	test   %ebx,%ebx
+  800a3a:	75 d8                	jne    800a14 <strtol+0x40>
+		s++, base = 8;
+  800a3c:	83 c2 01             	add    $0x1,%edx
+  800a3f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a44:	eb ce                	jmp    800a14 <strtol+0x40>
+		s += 2, base = 16;
+  800a46:	83 c2 02             	add    $0x2,%edx
+  800a49:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a4e:	eb c4                	jmp    800a14 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a50:	0f be c0             	movsbl %al,%eax
+  800a53:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a56:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a59:	7d 3a                	jge    800a95 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a5b:	83 c2 01             	add    $0x1,%edx
+  800a5e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a62:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a64:	0f b6 02             	movzbl (%edx),%eax
+  800a67:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a6a:	89 f3                	mov    %esi,%ebx
+  800a6c:	80 fb 09             	cmp    $0x9,%bl
+  800a6f:	76 df                	jbe    800a50 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a71:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a74:	89 f3                	mov    %esi,%ebx
+  800a76:	80 fb 19             	cmp    $0x19,%bl
+  800a79:	77 08                	ja     800a83 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a7b:	0f be c0             	movsbl %al,%eax
+  800a7e:	83 e8 57             	sub    $0x57,%eax
+  800a81:	eb d3                	jmp    800a56 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a83:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a86:	89 f3                	mov    %esi,%ebx
+  800a88:	80 fb 19             	cmp    $0x19,%bl
+  800a8b:	77 08                	ja     800a95 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a8d:	0f be c0             	movsbl %al,%eax
+  800a90:	83 e8 37             	sub    $0x37,%eax
+  800a93:	eb c1                	jmp    800a56 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a95:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a99:	74 05                	je     800aa0 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a9e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800aa0:	89 c8                	mov    %ecx,%eax
+  800aa2:	f7 d8                	neg    %eax
+  800aa4:	85 ff                	test   %edi,%edi
+  800aa6:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800aa9:	89 c8                	mov    %ecx,%eax
+  800aab:	5b                   	pop    %ebx
+  800aac:	5e                   	pop    %esi
+  800aad:	5f                   	pop    %edi
+  800aae:	5d                   	pop    %ebp
+  800aaf:	c3                   	ret
+
+00800ab0 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800ab0:	55                   	push   %ebp
+  800ab1:	89 e5                	mov    %esp,%ebp
+  800ab3:	57                   	push   %edi
+  800ab4:	56                   	push   %esi
+  800ab5:	53                   	push   %ebx
+  800ab6:	83 ec 0c             	sub    $0xc,%esp
+  800ab9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800abc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800abf:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800ac2:	85 ff                	test   %edi,%edi
+  800ac4:	74 16                	je     800adc <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800ac6:	83 ec 04             	sub    $0x4,%esp
+  800ac9:	56                   	push   %esi
+  800aca:	6a 00                	push   $0x0
+  800acc:	53                   	push   %ebx
+  800acd:	e8 02 ff ff ff       	call   8009d4 <strtol>
+  800ad2:	89 07                	mov    %eax,(%edi)
+  800ad4:	83 c4 10             	add    $0x10,%esp
+  800ad7:	eb 03                	jmp    800adc <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800ad9:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800adc:	0f b6 03             	movzbl (%ebx),%eax
+  800adf:	3c 20                	cmp    $0x20,%al
+  800ae1:	74 f6                	je     800ad9 <strisl+0x29>
+  800ae3:	3c 09                	cmp    $0x9,%al
+  800ae5:	74 f2                	je     800ad9 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ae7:	3c 2b                	cmp    $0x2b,%al
+  800ae9:	74 23                	je     800b0e <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800aeb:	3c 2d                	cmp    $0x2d,%al
+  800aed:	0f 94 c0             	sete   %al
+  800af0:	0f b6 c0             	movzbl %al,%eax
+  800af3:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800af5:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800afb:	75 41                	jne    800b3e <strisl+0x8e>
+  800afd:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800b00:	74 11                	je     800b13 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b02:	85 f6                	test   %esi,%esi
+  800b04:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b09:	0f 44 f0             	cmove  %eax,%esi
+  800b0c:	eb 30                	jmp    800b3e <strisl+0x8e>
+		s++;
+  800b0e:	83 c3 01             	add    $0x1,%ebx
+  800b11:	eb e2                	jmp    800af5 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b13:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800b17:	74 0e                	je     800b27 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800b19:	85 f6                	test   %esi,%esi
+  800b1b:	75 21                	jne    800b3e <strisl+0x8e>
+		s++, base = 8;
+  800b1d:	83 c3 01             	add    $0x1,%ebx
+  800b20:	be 08 00 00 00       	mov    $0x8,%esi
+  800b25:	eb 17                	jmp    800b3e <strisl+0x8e>
+		s += 2, base = 16;
+  800b27:	83 c3 02             	add    $0x2,%ebx
+  800b2a:	be 10 00 00 00       	mov    $0x10,%esi
+  800b2f:	eb 0d                	jmp    800b3e <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b31:	0f be c0             	movsbl %al,%eax
+  800b34:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800b37:	39 f0                	cmp    %esi,%eax
+  800b39:	7d 38                	jge    800b73 <strisl+0xc3>
+			return 0;
+		s++;
+  800b3b:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800b3e:	0f b6 03             	movzbl (%ebx),%eax
+  800b41:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800b44:	80 fa 09             	cmp    $0x9,%dl
+  800b47:	76 e8                	jbe    800b31 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800b49:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800b4c:	80 fa 19             	cmp    $0x19,%dl
+  800b4f:	77 08                	ja     800b59 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800b51:	0f be c0             	movsbl %al,%eax
+  800b54:	83 e8 57             	sub    $0x57,%eax
+  800b57:	eb de                	jmp    800b37 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b59:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800b5c:	80 fa 19             	cmp    $0x19,%dl
+  800b5f:	77 08                	ja     800b69 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800b61:	0f be c0             	movsbl %al,%eax
+  800b64:	83 e8 37             	sub    $0x37,%eax
+  800b67:	eb ce                	jmp    800b37 <strisl+0x87>
+		else if (!*s)
+  800b69:	84 c0                	test   %al,%al
+  800b6b:	0f 94 c0             	sete   %al
+  800b6e:	0f b6 c0             	movzbl %al,%eax
+  800b71:	eb 05                	jmp    800b78 <strisl+0xc8>
+			return 0;
+  800b73:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800b78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b7b:	5b                   	pop    %ebx
+  800b7c:	5e                   	pop    %esi
+  800b7d:	5f                   	pop    %edi
+  800b7e:	5d                   	pop    %ebp
+  800b7f:	c3                   	ret
+
+00800b80 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800b80:	55                   	push   %ebp
+  800b81:	89 e5                	mov    %esp,%ebp
+  800b83:	83 ec 10             	sub    $0x10,%esp
+  800b86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800b89:	89 c8                	mov    %ecx,%eax
+  800b8b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800b90:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800b93:	eb 0b                	jmp    800ba0 <touch_mem+0x20>
+		c = *(char *)page;
+  800b95:	0f b6 10             	movzbl (%eax),%edx
+  800b98:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800b9b:	05 00 10 00 00       	add    $0x1000,%eax
+  800ba0:	39 c8                	cmp    %ecx,%eax
+  800ba2:	72 f1                	jb     800b95 <touch_mem+0x15>
+}
+  800ba4:	c9                   	leave
+  800ba5:	c3                   	ret
+
+00800ba6 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ba6:	55                   	push   %ebp
+  800ba7:	89 e5                	mov    %esp,%ebp
+  800ba9:	57                   	push   %edi
+  800baa:	56                   	push   %esi
+  800bab:	53                   	push   %ebx
+	touch_mem(s, len);
+  800bac:	ff 75 0c             	push   0xc(%ebp)
+  800baf:	ff 75 08             	push   0x8(%ebp)
+  800bb2:	e8 c9 ff ff ff       	call   800b80 <touch_mem>
+	asm volatile("int %1\n"
+  800bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc2:	89 c3                	mov    %eax,%ebx
+  800bc4:	89 c7                	mov    %eax,%edi
+  800bc6:	89 c6                	mov    %eax,%esi
+  800bc8:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bca:	83 c4 08             	add    $0x8,%esp
+  800bcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bd0:	5b                   	pop    %ebx
+  800bd1:	5e                   	pop    %esi
+  800bd2:	5f                   	pop    %edi
+  800bd3:	5d                   	pop    %ebp
+  800bd4:	c3                   	ret
+
+00800bd5 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bd5:	55                   	push   %ebp
+  800bd6:	89 e5                	mov    %esp,%ebp
+  800bd8:	57                   	push   %edi
+  800bd9:	56                   	push   %esi
+  800bda:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800be0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800be5:	89 d1                	mov    %edx,%ecx
+  800be7:	89 d3                	mov    %edx,%ebx
+  800be9:	89 d7                	mov    %edx,%edi
+  800beb:	89 d6                	mov    %edx,%esi
+  800bed:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bef:	5b                   	pop    %ebx
+  800bf0:	5e                   	pop    %esi
+  800bf1:	5f                   	pop    %edi
+  800bf2:	5d                   	pop    %ebp
+  800bf3:	c3                   	ret
+
+00800bf4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bf4:	55                   	push   %ebp
+  800bf5:	89 e5                	mov    %esp,%ebp
+  800bf7:	57                   	push   %edi
+  800bf8:	56                   	push   %esi
+  800bf9:	53                   	push   %ebx
+  800bfa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bfd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c05:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c0a:	89 cb                	mov    %ecx,%ebx
+  800c0c:	89 cf                	mov    %ecx,%edi
+  800c0e:	89 ce                	mov    %ecx,%esi
+  800c10:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c12:	85 c0                	test   %eax,%eax
+  800c14:	7f 08                	jg     800c1e <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c19:	5b                   	pop    %ebx
+  800c1a:	5e                   	pop    %esi
+  800c1b:	5f                   	pop    %edi
+  800c1c:	5d                   	pop    %ebp
+  800c1d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c1e:	83 ec 0c             	sub    $0xc,%esp
+  800c21:	50                   	push   %eax
+  800c22:	6a 03                	push   $0x3
+  800c24:	68 8b 2a 80 00       	push   $0x802a8b
+  800c29:	6a 23                	push   $0x23
+  800c2b:	68 a8 2a 80 00       	push   $0x802aa8
+  800c30:	e8 3b 18 00 00       	call   802470 <_panic>
+
+00800c35 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c35:	55                   	push   %ebp
+  800c36:	89 e5                	mov    %esp,%ebp
+  800c38:	57                   	push   %edi
+  800c39:	56                   	push   %esi
+  800c3a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c40:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c45:	89 d1                	mov    %edx,%ecx
+  800c47:	89 d3                	mov    %edx,%ebx
+  800c49:	89 d7                	mov    %edx,%edi
+  800c4b:	89 d6                	mov    %edx,%esi
+  800c4d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c4f:	5b                   	pop    %ebx
+  800c50:	5e                   	pop    %esi
+  800c51:	5f                   	pop    %edi
+  800c52:	5d                   	pop    %ebp
+  800c53:	c3                   	ret
+
+00800c54 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c54:	55                   	push   %ebp
+  800c55:	89 e5                	mov    %esp,%ebp
+  800c57:	57                   	push   %edi
+  800c58:	56                   	push   %esi
+  800c59:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c5f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c64:	89 d1                	mov    %edx,%ecx
+  800c66:	89 d3                	mov    %edx,%ebx
+  800c68:	89 d7                	mov    %edx,%edi
+  800c6a:	89 d6                	mov    %edx,%esi
+  800c6c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c6e:	5b                   	pop    %ebx
+  800c6f:	5e                   	pop    %esi
+  800c70:	5f                   	pop    %edi
+  800c71:	5d                   	pop    %ebp
+  800c72:	c3                   	ret
+
+00800c73 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c73:	55                   	push   %ebp
+  800c74:	89 e5                	mov    %esp,%ebp
+  800c76:	57                   	push   %edi
+  800c77:	56                   	push   %esi
+  800c78:	53                   	push   %ebx
+  800c79:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c7c:	be 00 00 00 00       	mov    $0x0,%esi
+  800c81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c87:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c8f:	89 f7                	mov    %esi,%edi
+  800c91:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c93:	85 c0                	test   %eax,%eax
+  800c95:	7f 08                	jg     800c9f <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9a:	5b                   	pop    %ebx
+  800c9b:	5e                   	pop    %esi
+  800c9c:	5f                   	pop    %edi
+  800c9d:	5d                   	pop    %ebp
+  800c9e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c9f:	83 ec 0c             	sub    $0xc,%esp
+  800ca2:	50                   	push   %eax
+  800ca3:	6a 04                	push   $0x4
+  800ca5:	68 8b 2a 80 00       	push   $0x802a8b
+  800caa:	6a 23                	push   $0x23
+  800cac:	68 a8 2a 80 00       	push   $0x802aa8
+  800cb1:	e8 ba 17 00 00       	call   802470 <_panic>
+
+00800cb6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cb6:	55                   	push   %ebp
+  800cb7:	89 e5                	mov    %esp,%ebp
+  800cb9:	57                   	push   %edi
+  800cba:	56                   	push   %esi
+  800cbb:	53                   	push   %ebx
+  800cbc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc5:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ccd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cd0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cd3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cd5:	85 c0                	test   %eax,%eax
+  800cd7:	7f 08                	jg     800ce1 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdc:	5b                   	pop    %ebx
+  800cdd:	5e                   	pop    %esi
+  800cde:	5f                   	pop    %edi
+  800cdf:	5d                   	pop    %ebp
+  800ce0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ce1:	83 ec 0c             	sub    $0xc,%esp
+  800ce4:	50                   	push   %eax
+  800ce5:	6a 05                	push   $0x5
+  800ce7:	68 8b 2a 80 00       	push   $0x802a8b
+  800cec:	6a 23                	push   $0x23
+  800cee:	68 a8 2a 80 00       	push   $0x802aa8
+  800cf3:	e8 78 17 00 00       	call   802470 <_panic>
+
+00800cf8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cf8:	55                   	push   %ebp
+  800cf9:	89 e5                	mov    %esp,%ebp
+  800cfb:	57                   	push   %edi
+  800cfc:	56                   	push   %esi
+  800cfd:	53                   	push   %ebx
+  800cfe:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d11:	89 df                	mov    %ebx,%edi
+  800d13:	89 de                	mov    %ebx,%esi
+  800d15:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d17:	85 c0                	test   %eax,%eax
+  800d19:	7f 08                	jg     800d23 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1e:	5b                   	pop    %ebx
+  800d1f:	5e                   	pop    %esi
+  800d20:	5f                   	pop    %edi
+  800d21:	5d                   	pop    %ebp
+  800d22:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d23:	83 ec 0c             	sub    $0xc,%esp
+  800d26:	50                   	push   %eax
+  800d27:	6a 06                	push   $0x6
+  800d29:	68 8b 2a 80 00       	push   $0x802a8b
+  800d2e:	6a 23                	push   $0x23
+  800d30:	68 a8 2a 80 00       	push   $0x802aa8
+  800d35:	e8 36 17 00 00       	call   802470 <_panic>
+
+00800d3a <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800d3a:	55                   	push   %ebp
+  800d3b:	89 e5                	mov    %esp,%ebp
+  800d3d:	57                   	push   %edi
+  800d3e:	56                   	push   %esi
+  800d3f:	53                   	push   %ebx
+  800d40:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4e:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d53:	89 df                	mov    %ebx,%edi
+  800d55:	89 de                	mov    %ebx,%esi
+  800d57:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d59:	85 c0                	test   %eax,%eax
+  800d5b:	7f 08                	jg     800d65 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d60:	5b                   	pop    %ebx
+  800d61:	5e                   	pop    %esi
+  800d62:	5f                   	pop    %edi
+  800d63:	5d                   	pop    %ebp
+  800d64:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d65:	83 ec 0c             	sub    $0xc,%esp
+  800d68:	50                   	push   %eax
+  800d69:	6a 18                	push   $0x18
+  800d6b:	68 8b 2a 80 00       	push   $0x802a8b
+  800d70:	6a 23                	push   $0x23
+  800d72:	68 a8 2a 80 00       	push   $0x802aa8
+  800d77:	e8 f4 16 00 00       	call   802470 <_panic>
+
+00800d7c <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800d7c:	55                   	push   %ebp
+  800d7d:	89 e5                	mov    %esp,%ebp
+  800d7f:	57                   	push   %edi
+  800d80:	56                   	push   %esi
+  800d81:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d82:	be 00 00 00 00       	mov    $0x0,%esi
+  800d87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8d:	b8 19 00 00 00       	mov    $0x19,%eax
+  800d92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d95:	89 f7                	mov    %esi,%edi
+  800d97:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800d99:	5b                   	pop    %ebx
+  800d9a:	5e                   	pop    %esi
+  800d9b:	5f                   	pop    %edi
+  800d9c:	5d                   	pop    %ebp
+  800d9d:	c3                   	ret
+
+00800d9e <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d9e:	55                   	push   %ebp
+  800d9f:	89 e5                	mov    %esp,%ebp
+  800da1:	57                   	push   %edi
+  800da2:	56                   	push   %esi
+  800da3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800da4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800daa:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800daf:	be 00 00 00 00       	mov    $0x0,%esi
+  800db4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dba:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800dbc:	5b                   	pop    %ebx
+  800dbd:	5e                   	pop    %esi
+  800dbe:	5f                   	pop    %edi
+  800dbf:	5d                   	pop    %ebp
+  800dc0:	c3                   	ret
+
+00800dc1 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800dc1:	55                   	push   %ebp
+  800dc2:	89 e5                	mov    %esp,%ebp
+  800dc4:	57                   	push   %edi
+  800dc5:	56                   	push   %esi
+  800dc6:	53                   	push   %ebx
+  800dc7:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800dca:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800dcd:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800dd3:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800dd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ddc:	b8 10 00 00 00       	mov    $0x10,%eax
+  800de1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de4:	8b 75 18             	mov    0x18(%ebp),%esi
+  800de7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de9:	85 c0                	test   %eax,%eax
+  800deb:	7f 08                	jg     800df5 <sys_page_map_range+0x34>
+}
+  800ded:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df0:	5b                   	pop    %ebx
+  800df1:	5e                   	pop    %esi
+  800df2:	5f                   	pop    %edi
+  800df3:	5d                   	pop    %ebp
+  800df4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df5:	83 ec 0c             	sub    $0xc,%esp
+  800df8:	50                   	push   %eax
+  800df9:	6a 10                	push   $0x10
+  800dfb:	68 8b 2a 80 00       	push   $0x802a8b
+  800e00:	6a 23                	push   $0x23
+  800e02:	68 a8 2a 80 00       	push   $0x802aa8
+  800e07:	e8 64 16 00 00       	call   802470 <_panic>
+
+00800e0c <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e0c:	55                   	push   %ebp
+  800e0d:	89 e5                	mov    %esp,%ebp
+  800e0f:	57                   	push   %edi
+  800e10:	56                   	push   %esi
+  800e11:	53                   	push   %ebx
+  800e12:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e15:	be 00 00 00 00       	mov    $0x0,%esi
+  800e1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e20:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e28:	89 f7                	mov    %esi,%edi
+  800e2a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e2c:	85 c0                	test   %eax,%eax
+  800e2e:	7f 08                	jg     800e38 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e33:	5b                   	pop    %ebx
+  800e34:	5e                   	pop    %esi
+  800e35:	5f                   	pop    %edi
+  800e36:	5d                   	pop    %ebp
+  800e37:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e38:	83 ec 0c             	sub    $0xc,%esp
+  800e3b:	50                   	push   %eax
+  800e3c:	6a 11                	push   $0x11
+  800e3e:	68 8b 2a 80 00       	push   $0x802a8b
+  800e43:	6a 23                	push   $0x23
+  800e45:	68 a8 2a 80 00       	push   $0x802aa8
+  800e4a:	e8 21 16 00 00       	call   802470 <_panic>
+
+00800e4f <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800e4f:	55                   	push   %ebp
+  800e50:	89 e5                	mov    %esp,%ebp
+  800e52:	57                   	push   %edi
+  800e53:	56                   	push   %esi
+  800e54:	53                   	push   %ebx
+  800e55:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e58:	be 00 00 00 00       	mov    $0x0,%esi
+  800e5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e63:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800e68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e6b:	89 f7                	mov    %esi,%edi
+  800e6d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e6f:	85 c0                	test   %eax,%eax
+  800e71:	7f 08                	jg     800e7b <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e76:	5b                   	pop    %ebx
+  800e77:	5e                   	pop    %esi
+  800e78:	5f                   	pop    %edi
+  800e79:	5d                   	pop    %ebp
+  800e7a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e7b:	83 ec 0c             	sub    $0xc,%esp
+  800e7e:	50                   	push   %eax
+  800e7f:	6a 1b                	push   $0x1b
+  800e81:	68 8b 2a 80 00       	push   $0x802a8b
+  800e86:	6a 23                	push   $0x23
+  800e88:	68 a8 2a 80 00       	push   $0x802aa8
+  800e8d:	e8 de 15 00 00       	call   802470 <_panic>
+
+00800e92 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800e92:	55                   	push   %ebp
+  800e93:	89 e5                	mov    %esp,%ebp
+  800e95:	57                   	push   %edi
+  800e96:	56                   	push   %esi
+  800e97:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e98:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e9d:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ea2:	89 d1                	mov    %edx,%ecx
+  800ea4:	89 d3                	mov    %edx,%ebx
+  800ea6:	89 d7                	mov    %edx,%edi
+  800ea8:	89 d6                	mov    %edx,%esi
+  800eaa:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800eac:	5b                   	pop    %ebx
+  800ead:	5e                   	pop    %esi
+  800eae:	5f                   	pop    %edi
+  800eaf:	5d                   	pop    %ebp
+  800eb0:	c3                   	ret
+
+00800eb1 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800eb1:	55                   	push   %ebp
+  800eb2:	89 e5                	mov    %esp,%ebp
+  800eb4:	57                   	push   %edi
+  800eb5:	56                   	push   %esi
+  800eb6:	53                   	push   %ebx
+  800eb7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec5:	b8 08 00 00 00       	mov    $0x8,%eax
+  800eca:	89 df                	mov    %ebx,%edi
+  800ecc:	89 de                	mov    %ebx,%esi
+  800ece:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ed0:	85 c0                	test   %eax,%eax
+  800ed2:	7f 08                	jg     800edc <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ed4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed7:	5b                   	pop    %ebx
+  800ed8:	5e                   	pop    %esi
+  800ed9:	5f                   	pop    %edi
+  800eda:	5d                   	pop    %ebp
+  800edb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800edc:	83 ec 0c             	sub    $0xc,%esp
+  800edf:	50                   	push   %eax
+  800ee0:	6a 08                	push   $0x8
+  800ee2:	68 8b 2a 80 00       	push   $0x802a8b
+  800ee7:	6a 23                	push   $0x23
+  800ee9:	68 a8 2a 80 00       	push   $0x802aa8
+  800eee:	e8 7d 15 00 00       	call   802470 <_panic>
+
+00800ef3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ef3:	55                   	push   %ebp
+  800ef4:	89 e5                	mov    %esp,%ebp
+  800ef6:	57                   	push   %edi
+  800ef7:	56                   	push   %esi
+  800ef8:	53                   	push   %ebx
+  800ef9:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800efc:	6a 44                	push   $0x44
+  800efe:	ff 75 0c             	push   0xc(%ebp)
+  800f01:	e8 7a fc ff ff       	call   800b80 <touch_mem>
+	asm volatile("int %1\n"
+  800f06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0e:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f16:	89 df                	mov    %ebx,%edi
+  800f18:	89 de                	mov    %ebx,%esi
+  800f1a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f1c:	83 c4 08             	add    $0x8,%esp
+  800f1f:	85 c0                	test   %eax,%eax
+  800f21:	7f 08                	jg     800f2b <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f26:	5b                   	pop    %ebx
+  800f27:	5e                   	pop    %esi
+  800f28:	5f                   	pop    %edi
+  800f29:	5d                   	pop    %ebp
+  800f2a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f2b:	83 ec 0c             	sub    $0xc,%esp
+  800f2e:	50                   	push   %eax
+  800f2f:	6a 09                	push   $0x9
+  800f31:	68 8b 2a 80 00       	push   $0x802a8b
+  800f36:	6a 23                	push   $0x23
+  800f38:	68 a8 2a 80 00       	push   $0x802aa8
+  800f3d:	e8 2e 15 00 00       	call   802470 <_panic>
+
+00800f42 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800f42:	55                   	push   %ebp
+  800f43:	89 e5                	mov    %esp,%ebp
+  800f45:	57                   	push   %edi
+  800f46:	56                   	push   %esi
+  800f47:	53                   	push   %ebx
+  800f48:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f4b:	be 00 00 00 00       	mov    $0x0,%esi
+  800f50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f56:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800f5b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f5e:	89 f7                	mov    %esi,%edi
+  800f60:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f62:	85 c0                	test   %eax,%eax
+  800f64:	7f 08                	jg     800f6e <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800f66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f69:	5b                   	pop    %ebx
+  800f6a:	5e                   	pop    %esi
+  800f6b:	5f                   	pop    %edi
+  800f6c:	5d                   	pop    %ebp
+  800f6d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6e:	83 ec 0c             	sub    $0xc,%esp
+  800f71:	50                   	push   %eax
+  800f72:	6a 1a                	push   $0x1a
+  800f74:	68 8b 2a 80 00       	push   $0x802a8b
+  800f79:	6a 23                	push   $0x23
+  800f7b:	68 a8 2a 80 00       	push   $0x802aa8
+  800f80:	e8 eb 14 00 00       	call   802470 <_panic>
+
+00800f85 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  800f85:	55                   	push   %ebp
+  800f86:	89 e5                	mov    %esp,%ebp
+  800f88:	57                   	push   %edi
+  800f89:	56                   	push   %esi
+  800f8a:	53                   	push   %ebx
+  800f8b:	83 ec 0c             	sub    $0xc,%esp
+  800f8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  800f91:	89 d8                	mov    %ebx,%eax
+  800f93:	c1 e0 05             	shl    $0x5,%eax
+  800f96:	50                   	push   %eax
+  800f97:	ff 75 0c             	push   0xc(%ebp)
+  800f9a:	e8 e1 fb ff ff       	call   800b80 <touch_mem>
+	asm volatile("int %1\n"
+  800f9f:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa7:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faf:	89 f7                	mov    %esi,%edi
+  800fb1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb3:	83 c4 08             	add    $0x8,%esp
+  800fb6:	85 c0                	test   %eax,%eax
+  800fb8:	7f 08                	jg     800fc2 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  800fba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbd:	5b                   	pop    %ebx
+  800fbe:	5e                   	pop    %esi
+  800fbf:	5f                   	pop    %edi
+  800fc0:	5d                   	pop    %ebp
+  800fc1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc2:	83 ec 0c             	sub    $0xc,%esp
+  800fc5:	50                   	push   %eax
+  800fc6:	6a 13                	push   $0x13
+  800fc8:	68 8b 2a 80 00       	push   $0x802a8b
+  800fcd:	6a 23                	push   $0x23
+  800fcf:	68 a8 2a 80 00       	push   $0x802aa8
+  800fd4:	e8 97 14 00 00       	call   802470 <_panic>
+
+00800fd9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fd9:	55                   	push   %ebp
+  800fda:	89 e5                	mov    %esp,%ebp
+  800fdc:	57                   	push   %edi
+  800fdd:	56                   	push   %esi
+  800fde:	53                   	push   %ebx
+  800fdf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fe2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fed:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ff2:	89 df                	mov    %ebx,%edi
+  800ff4:	89 de                	mov    %ebx,%esi
+  800ff6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff8:	85 c0                	test   %eax,%eax
+  800ffa:	7f 08                	jg     801004 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ffc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fff:	5b                   	pop    %ebx
+  801000:	5e                   	pop    %esi
+  801001:	5f                   	pop    %edi
+  801002:	5d                   	pop    %ebp
+  801003:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801004:	83 ec 0c             	sub    $0xc,%esp
+  801007:	50                   	push   %eax
+  801008:	6a 0a                	push   $0xa
+  80100a:	68 8b 2a 80 00       	push   $0x802a8b
+  80100f:	6a 23                	push   $0x23
+  801011:	68 a8 2a 80 00       	push   $0x802aa8
+  801016:	e8 55 14 00 00       	call   802470 <_panic>
+
+0080101b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	57                   	push   %edi
+  80101f:	56                   	push   %esi
+  801020:	53                   	push   %ebx
+  801021:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801024:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80102a:	76 1d                	jbe    801049 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80102c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801032:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801037:	be 01 00 00 00       	mov    $0x1,%esi
+  80103c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80103f:	cd 30                	int    $0x30
+}
+  801041:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801044:	5b                   	pop    %ebx
+  801045:	5e                   	pop    %esi
+  801046:	5f                   	pop    %edi
+  801047:	5d                   	pop    %ebp
+  801048:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801049:	68 00 10 00 00       	push   $0x1000
+  80104e:	53                   	push   %ebx
+  80104f:	e8 2c fb ff ff       	call   800b80 <touch_mem>
+  801054:	83 c4 08             	add    $0x8,%esp
+  801057:	eb d3                	jmp    80102c <sys_ipc_send+0x11>
+
+00801059 <sys_ipc_send_pages>:
+{
+  801059:	55                   	push   %ebp
+  80105a:	89 e5                	mov    %esp,%ebp
+  80105c:	57                   	push   %edi
+  80105d:	56                   	push   %esi
+  80105e:	53                   	push   %ebx
+  80105f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801062:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801065:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80106b:	76 18                	jbe    801085 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80106d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801070:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801073:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801078:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80107b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  80107d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801080:	5b                   	pop    %ebx
+  801081:	5e                   	pop    %esi
+  801082:	5f                   	pop    %edi
+  801083:	5d                   	pop    %ebp
+  801084:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801085:	89 f0                	mov    %esi,%eax
+  801087:	c1 e0 0c             	shl    $0xc,%eax
+  80108a:	50                   	push   %eax
+  80108b:	53                   	push   %ebx
+  80108c:	e8 ef fa ff ff       	call   800b80 <touch_mem>
+  801091:	83 c4 08             	add    $0x8,%esp
+  801094:	eb d7                	jmp    80106d <sys_ipc_send_pages+0x14>
+
+00801096 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801096:	55                   	push   %ebp
+  801097:	89 e5                	mov    %esp,%ebp
+  801099:	57                   	push   %edi
+  80109a:	56                   	push   %esi
+  80109b:	53                   	push   %ebx
+  80109c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80109f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010aa:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010af:	89 df                	mov    %ebx,%edi
+  8010b1:	89 de                	mov    %ebx,%esi
+  8010b3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010b5:	85 c0                	test   %eax,%eax
+  8010b7:	7f 08                	jg     8010c1 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8010b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010bc:	5b                   	pop    %ebx
+  8010bd:	5e                   	pop    %esi
+  8010be:	5f                   	pop    %edi
+  8010bf:	5d                   	pop    %ebp
+  8010c0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c1:	83 ec 0c             	sub    $0xc,%esp
+  8010c4:	50                   	push   %eax
+  8010c5:	6a 0d                	push   $0xd
+  8010c7:	68 8b 2a 80 00       	push   $0x802a8b
+  8010cc:	6a 23                	push   $0x23
+  8010ce:	68 a8 2a 80 00       	push   $0x802aa8
+  8010d3:	e8 98 13 00 00       	call   802470 <_panic>
+
+008010d8 <sys_ipc_recv>:
+{
+  8010d8:	55                   	push   %ebp
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8010de:	6a 01                	push   $0x1
+  8010e0:	ff 75 08             	push   0x8(%ebp)
+  8010e3:	e8 ae ff ff ff       	call   801096 <sys_ipc_recv_pages>
+}
+  8010e8:	c9                   	leave
+  8010e9:	c3                   	ret
+
+008010ea <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8010ea:	55                   	push   %ebp
+  8010eb:	89 e5                	mov    %esp,%ebp
+  8010ed:	57                   	push   %edi
+  8010ee:	56                   	push   %esi
+  8010ef:	53                   	push   %ebx
+  8010f0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010f6:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  8010f9:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010ff:	77 04                	ja     801105 <sys_ipc_call+0x1b>
+  801101:	85 f6                	test   %esi,%esi
+  801103:	75 15                	jne    80111a <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801105:	8b 55 08             	mov    0x8(%ebp),%edx
+  801108:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801110:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801112:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801115:	5b                   	pop    %ebx
+  801116:	5e                   	pop    %esi
+  801117:	5f                   	pop    %edi
+  801118:	5d                   	pop    %ebp
+  801119:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80111a:	89 f8                	mov    %edi,%eax
+  80111c:	c1 e0 0c             	shl    $0xc,%eax
+  80111f:	50                   	push   %eax
+  801120:	53                   	push   %ebx
+  801121:	e8 5a fa ff ff       	call   800b80 <touch_mem>
+  801126:	83 c4 08             	add    $0x8,%esp
+  801129:	eb da                	jmp    801105 <sys_ipc_call+0x1b>
+
+0080112b <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80112b:	55                   	push   %ebp
+  80112c:	89 e5                	mov    %esp,%ebp
+  80112e:	57                   	push   %edi
+  80112f:	56                   	push   %esi
+  801130:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801131:	8b 55 08             	mov    0x8(%ebp),%edx
+  801134:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801137:	b8 15 00 00 00       	mov    $0x15,%eax
+  80113c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80113f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801142:	8b 75 18             	mov    0x18(%ebp),%esi
+  801145:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801147:	5b                   	pop    %ebx
+  801148:	5e                   	pop    %esi
+  801149:	5f                   	pop    %edi
+  80114a:	5d                   	pop    %ebp
+  80114b:	c3                   	ret
+
+0080114c <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  80114c:	55                   	push   %ebp
+  80114d:	89 e5                	mov    %esp,%ebp
+  80114f:	57                   	push   %edi
+  801150:	56                   	push   %esi
+  801151:	53                   	push   %ebx
+  801152:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801155:	6a 04                	push   $0x4
+  801157:	ff 75 08             	push   0x8(%ebp)
+  80115a:	e8 21 fa ff ff       	call   800b80 <touch_mem>
+	asm volatile("int %1\n"
+  80115f:	be 00 00 00 00       	mov    $0x0,%esi
+  801164:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801167:	b8 16 00 00 00       	mov    $0x16,%eax
+  80116c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801172:	89 f7                	mov    %esi,%edi
+  801174:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801176:	83 c4 08             	add    $0x8,%esp
+  801179:	85 c0                	test   %eax,%eax
+  80117b:	7f 08                	jg     801185 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  80117d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801180:	5b                   	pop    %ebx
+  801181:	5e                   	pop    %esi
+  801182:	5f                   	pop    %edi
+  801183:	5d                   	pop    %ebp
+  801184:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801185:	83 ec 0c             	sub    $0xc,%esp
+  801188:	50                   	push   %eax
+  801189:	6a 16                	push   $0x16
+  80118b:	68 8b 2a 80 00       	push   $0x802a8b
+  801190:	6a 23                	push   $0x23
+  801192:	68 a8 2a 80 00       	push   $0x802aa8
+  801197:	e8 d4 12 00 00       	call   802470 <_panic>
+
+0080119c <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80119c:	55                   	push   %ebp
+  80119d:	89 e5                	mov    %esp,%ebp
+  80119f:	57                   	push   %edi
+  8011a0:	56                   	push   %esi
+  8011a1:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8011a2:	6a 04                	push   $0x4
+  8011a4:	ff 75 08             	push   0x8(%ebp)
+  8011a7:	e8 d4 f9 ff ff       	call   800b80 <touch_mem>
+	asm volatile("int %1\n"
+  8011ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b4:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bc:	89 df                	mov    %ebx,%edi
+  8011be:	89 de                	mov    %ebx,%esi
+  8011c0:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8011c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c5:	5b                   	pop    %ebx
+  8011c6:	5e                   	pop    %esi
+  8011c7:	5f                   	pop    %edi
+  8011c8:	5d                   	pop    %ebp
+  8011c9:	c3                   	ret
+
+008011ca <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	57                   	push   %edi
+  8011ce:	56                   	push   %esi
+  8011cf:	53                   	push   %ebx
+  8011d0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011db:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011e0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011e5:	89 df                	mov    %ebx,%edi
+  8011e7:	89 de                	mov    %ebx,%esi
+  8011e9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011eb:	85 c0                	test   %eax,%eax
+  8011ed:	7f 08                	jg     8011f7 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  8011ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f2:	5b                   	pop    %ebx
+  8011f3:	5e                   	pop    %esi
+  8011f4:	5f                   	pop    %edi
+  8011f5:	5d                   	pop    %ebp
+  8011f6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f7:	83 ec 0c             	sub    $0xc,%esp
+  8011fa:	50                   	push   %eax
+  8011fb:	6a 0e                	push   $0xe
+  8011fd:	68 8b 2a 80 00       	push   $0x802a8b
+  801202:	6a 23                	push   $0x23
+  801204:	68 a8 2a 80 00       	push   $0x802aa8
+  801209:	e8 62 12 00 00       	call   802470 <_panic>
+
+0080120e <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  80120e:	55                   	push   %ebp
+  80120f:	89 e5                	mov    %esp,%ebp
+  801211:	57                   	push   %edi
+  801212:	56                   	push   %esi
+  801213:	53                   	push   %ebx
+  801214:	83 ec 14             	sub    $0x14,%esp
+  801217:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80121a:	8b 75 14             	mov    0x14(%ebp),%esi
+  80121d:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  801220:	ff 75 10             	push   0x10(%ebp)
+  801223:	ff 75 0c             	push   0xc(%ebp)
+  801226:	e8 6b fe ff ff       	call   801096 <sys_ipc_recv_pages>
+  80122b:	83 c4 10             	add    $0x10,%esp
+  80122e:	85 c0                	test   %eax,%eax
+  801230:	78 46                	js     801278 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  801232:	85 ff                	test   %edi,%edi
+  801234:	74 0d                	je     801243 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  801236:	a1 08 40 80 00       	mov    0x804008,%eax
+  80123b:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  801241:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  801243:	85 f6                	test   %esi,%esi
+  801245:	74 0d                	je     801254 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  801247:	a1 08 40 80 00       	mov    0x804008,%eax
+  80124c:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801252:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  801254:	85 db                	test   %ebx,%ebx
+  801256:	74 0d                	je     801265 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  801258:	a1 08 40 80 00       	mov    0x804008,%eax
+  80125d:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801263:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  801265:	a1 08 40 80 00       	mov    0x804008,%eax
+  80126a:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  801270:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801273:	5b                   	pop    %ebx
+  801274:	5e                   	pop    %esi
+  801275:	5f                   	pop    %edi
+  801276:	5d                   	pop    %ebp
+  801277:	c3                   	ret
+		if (from_env_store) {
+  801278:	85 ff                	test   %edi,%edi
+  80127a:	74 06                	je     801282 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80127c:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  801282:	85 f6                	test   %esi,%esi
+  801284:	74 06                	je     80128c <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  801286:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80128c:	85 db                	test   %ebx,%ebx
+  80128e:	74 e0                	je     801270 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  801290:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801296:	eb d8                	jmp    801270 <ipc_recv_pages+0x62>
+
+00801298 <ipc_recv>:
+{
+  801298:	55                   	push   %ebp
+  801299:	89 e5                	mov    %esp,%ebp
+  80129b:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  80129e:	6a 00                	push   $0x0
+  8012a0:	ff 75 10             	push   0x10(%ebp)
+  8012a3:	6a 01                	push   $0x1
+  8012a5:	ff 75 0c             	push   0xc(%ebp)
+  8012a8:	ff 75 08             	push   0x8(%ebp)
+  8012ab:	e8 5e ff ff ff       	call   80120e <ipc_recv_pages>
+}
+  8012b0:	c9                   	leave
+  8012b1:	c3                   	ret
+
+008012b2 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8012b2:	55                   	push   %ebp
+  8012b3:	89 e5                	mov    %esp,%ebp
+  8012b5:	56                   	push   %esi
+  8012b6:	53                   	push   %ebx
+  8012b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8012bd:	83 ec 0c             	sub    $0xc,%esp
+  8012c0:	ff 75 0c             	push   0xc(%ebp)
+  8012c3:	e8 02 ff ff ff       	call   8011ca <sys_ipc_try_recv>
+  8012c8:	83 c4 10             	add    $0x10,%esp
+  8012cb:	85 c0                	test   %eax,%eax
+  8012cd:	78 34                	js     801303 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8012cf:	85 f6                	test   %esi,%esi
+  8012d1:	74 0d                	je     8012e0 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8012d3:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012d8:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8012de:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8012e0:	85 db                	test   %ebx,%ebx
+  8012e2:	74 0d                	je     8012f1 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8012e4:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012e9:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8012ef:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8012f1:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012f6:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8012fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012ff:	5b                   	pop    %ebx
+  801300:	5e                   	pop    %esi
+  801301:	5d                   	pop    %ebp
+  801302:	c3                   	ret
+		if (from_env_store) {
+  801303:	85 f6                	test   %esi,%esi
+  801305:	74 06                	je     80130d <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  801307:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  80130d:	85 db                	test   %ebx,%ebx
+  80130f:	74 eb                	je     8012fc <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  801311:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801317:	eb e3                	jmp    8012fc <ipc_try_recv+0x4a>
+
+00801319 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  801319:	55                   	push   %ebp
+  80131a:	89 e5                	mov    %esp,%ebp
+  80131c:	83 ec 14             	sub    $0x14,%esp
+  80131f:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  801322:	85 c0                	test   %eax,%eax
+  801324:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801329:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80132c:	ff 75 18             	push   0x18(%ebp)
+  80132f:	ff 75 14             	push   0x14(%ebp)
+  801332:	50                   	push   %eax
+  801333:	ff 75 0c             	push   0xc(%ebp)
+  801336:	ff 75 08             	push   0x8(%ebp)
+  801339:	e8 1b fd ff ff       	call   801059 <sys_ipc_send_pages>
+  80133e:	83 c4 20             	add    $0x20,%esp
+  801341:	85 c0                	test   %eax,%eax
+  801343:	78 02                	js     801347 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  801345:	c9                   	leave
+  801346:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  801347:	50                   	push   %eax
+  801348:	68 b8 2a 80 00       	push   $0x802ab8
+  80134d:	68 80 00 00 00       	push   $0x80
+  801352:	68 e4 2a 80 00       	push   $0x802ae4
+  801357:	e8 14 11 00 00       	call   802470 <_panic>
+
+0080135c <ipc_send>:
+{
+  80135c:	55                   	push   %ebp
+  80135d:	89 e5                	mov    %esp,%ebp
+  80135f:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  801362:	ff 75 14             	push   0x14(%ebp)
+  801365:	6a 01                	push   $0x1
+  801367:	ff 75 10             	push   0x10(%ebp)
+  80136a:	ff 75 0c             	push   0xc(%ebp)
+  80136d:	ff 75 08             	push   0x8(%ebp)
+  801370:	e8 a4 ff ff ff       	call   801319 <ipc_send_pages>
+}
+  801375:	83 c4 20             	add    $0x20,%esp
+  801378:	c9                   	leave
+  801379:	c3                   	ret
+
+0080137a <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80137a:	55                   	push   %ebp
+  80137b:	89 e5                	mov    %esp,%ebp
+  80137d:	83 ec 14             	sub    $0x14,%esp
+  801380:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  801383:	85 c0                	test   %eax,%eax
+  801385:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80138a:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80138d:	ff 75 18             	push   0x18(%ebp)
+  801390:	ff 75 14             	push   0x14(%ebp)
+  801393:	50                   	push   %eax
+  801394:	ff 75 0c             	push   0xc(%ebp)
+  801397:	ff 75 08             	push   0x8(%ebp)
+  80139a:	e8 4b fd ff ff       	call   8010ea <sys_ipc_call>
+  80139f:	83 c4 20             	add    $0x20,%esp
+  8013a2:	85 c0                	test   %eax,%eax
+  8013a4:	78 0b                	js     8013b1 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  8013a6:	a1 08 40 80 00       	mov    0x804008,%eax
+  8013ab:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8013b1:	c9                   	leave
+  8013b2:	c3                   	ret
+
+008013b3 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  8013b3:	55                   	push   %ebp
+  8013b4:	89 e5                	mov    %esp,%ebp
+  8013b6:	57                   	push   %edi
+  8013b7:	56                   	push   %esi
+  8013b8:	53                   	push   %ebx
+  8013b9:	83 ec 18             	sub    $0x18,%esp
+  8013bc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8013bf:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8013c2:	8b 75 20             	mov    0x20(%ebp),%esi
+  8013c5:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8013c8:	85 c0                	test   %eax,%eax
+  8013ca:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8013cf:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8013d2:	ff 75 18             	push   0x18(%ebp)
+  8013d5:	ff 75 14             	push   0x14(%ebp)
+  8013d8:	50                   	push   %eax
+  8013d9:	ff 75 0c             	push   0xc(%ebp)
+  8013dc:	ff 75 08             	push   0x8(%ebp)
+  8013df:	e8 47 fd ff ff       	call   80112b <sys_ipc_reply_recv>
+  8013e4:	83 c4 20             	add    $0x20,%esp
+  8013e7:	85 c0                	test   %eax,%eax
+  8013e9:	78 46                	js     801431 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8013eb:	85 ff                	test   %edi,%edi
+  8013ed:	74 0d                	je     8013fc <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8013ef:	a1 08 40 80 00       	mov    0x804008,%eax
+  8013f4:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8013fa:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8013fc:	85 f6                	test   %esi,%esi
+  8013fe:	74 0d                	je     80140d <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  801400:	a1 08 40 80 00       	mov    0x804008,%eax
+  801405:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80140b:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80140d:	85 db                	test   %ebx,%ebx
+  80140f:	74 0d                	je     80141e <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  801411:	a1 08 40 80 00       	mov    0x804008,%eax
+  801416:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80141c:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80141e:	a1 08 40 80 00       	mov    0x804008,%eax
+  801423:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  801429:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142c:	5b                   	pop    %ebx
+  80142d:	5e                   	pop    %esi
+  80142e:	5f                   	pop    %edi
+  80142f:	5d                   	pop    %ebp
+  801430:	c3                   	ret
+		if (from_env_store) {
+  801431:	85 ff                	test   %edi,%edi
+  801433:	74 06                	je     80143b <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  801435:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80143b:	85 f6                	test   %esi,%esi
+  80143d:	74 06                	je     801445 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  80143f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  801445:	85 db                	test   %ebx,%ebx
+  801447:	74 e0                	je     801429 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  801449:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80144f:	eb d8                	jmp    801429 <ipc_reply_recv+0x76>
+
+00801451 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801451:	55                   	push   %ebp
+  801452:	89 e5                	mov    %esp,%ebp
+  801454:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801457:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80145c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80145f:	c1 e0 06             	shl    $0x6,%eax
+  801462:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801467:	8b 40 50             	mov    0x50(%eax),%eax
+  80146a:	39 c8                	cmp    %ecx,%eax
+  80146c:	74 12                	je     801480 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80146e:	83 c2 01             	add    $0x1,%edx
+  801471:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801477:	75 e3                	jne    80145c <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801479:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147e:	eb 0e                	jmp    80148e <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801480:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  801483:	c1 e0 06             	shl    $0x6,%eax
+  801486:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80148b:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80148e:	5d                   	pop    %ebp
+  80148f:	c3                   	ret
+
+00801490 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801490:	55                   	push   %ebp
+  801491:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801493:	8b 45 08             	mov    0x8(%ebp),%eax
+  801496:	05 00 00 00 30       	add    $0x30000000,%eax
+  80149b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80149e:	5d                   	pop    %ebp
+  80149f:	c3                   	ret
+
+008014a0 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014a0:	55                   	push   %ebp
+  8014a1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014a6:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8014ab:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8014b0:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8014b5:	5d                   	pop    %ebp
+  8014b6:	c3                   	ret
+
+008014b7 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8014b7:	55                   	push   %ebp
+  8014b8:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8014ba:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8014bf:	a8 01                	test   $0x1,%al
+  8014c1:	74 3c                	je     8014ff <fd_alloc+0x48>
+  8014c3:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8014c8:	89 c2                	mov    %eax,%edx
+  8014ca:	c1 ea 0c             	shr    $0xc,%edx
+  8014cd:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8014d4:	89 c1                	mov    %eax,%ecx
+  8014d6:	05 00 10 00 00       	add    $0x1000,%eax
+  8014db:	f6 c2 01             	test   $0x1,%dl
+  8014de:	74 13                	je     8014f3 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8014e0:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8014e5:	75 e1                	jne    8014c8 <fd_alloc+0x11>
+  8014e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8014ec:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8014f1:	eb 05                	jmp    8014f8 <fd_alloc+0x41>
+			return 0;
+  8014f3:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8014f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fb:	89 0a                	mov    %ecx,(%edx)
+}
+  8014fd:	5d                   	pop    %ebp
+  8014fe:	c3                   	ret
+  8014ff:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801504:	b8 00 00 00 00       	mov    $0x0,%eax
+  801509:	eb ed                	jmp    8014f8 <fd_alloc+0x41>
+
+0080150b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80150b:	55                   	push   %ebp
+  80150c:	89 e5                	mov    %esp,%ebp
+  80150e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801511:	83 f8 1f             	cmp    $0x1f,%eax
+  801514:	77 30                	ja     801546 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801516:	c1 e0 0c             	shl    $0xc,%eax
+  801519:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80151e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801524:	f6 c2 01             	test   $0x1,%dl
+  801527:	74 24                	je     80154d <fd_lookup+0x42>
+  801529:	89 c2                	mov    %eax,%edx
+  80152b:	c1 ea 0c             	shr    $0xc,%edx
+  80152e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801535:	f6 c2 01             	test   $0x1,%dl
+  801538:	74 1a                	je     801554 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80153a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80153d:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80153f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801544:	5d                   	pop    %ebp
+  801545:	c3                   	ret
+		return -E_INVAL;
+  801546:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80154b:	eb f7                	jmp    801544 <fd_lookup+0x39>
+		return -E_INVAL;
+  80154d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801552:	eb f0                	jmp    801544 <fd_lookup+0x39>
+  801554:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801559:	eb e9                	jmp    801544 <fd_lookup+0x39>
+
+0080155b <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80155b:	55                   	push   %ebp
+  80155c:	89 e5                	mov    %esp,%ebp
+  80155e:	53                   	push   %ebx
+  80155f:	83 ec 04             	sub    $0x4,%esp
+  801562:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801565:	b8 6c 2b 80 00       	mov    $0x802b6c,%eax
+  80156a:	8b 18                	mov    (%eax),%ebx
+  80156c:	85 db                	test   %ebx,%ebx
+  80156e:	74 0e                	je     80157e <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801570:	83 c0 04             	add    $0x4,%eax
+  801573:	39 13                	cmp    %edx,(%ebx)
+  801575:	75 f3                	jne    80156a <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801577:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157c:	eb 1f                	jmp    80159d <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80157e:	a1 08 40 80 00       	mov    0x804008,%eax
+  801583:	8b 40 48             	mov    0x48(%eax),%eax
+  801586:	83 ec 04             	sub    $0x4,%esp
+  801589:	52                   	push   %edx
+  80158a:	50                   	push   %eax
+  80158b:	68 f0 2a 80 00       	push   $0x802af0
+  801590:	e8 04 ec ff ff       	call   800199 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801595:	83 c4 10             	add    $0x10,%esp
+  801598:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80159d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015a0:	89 1a                	mov    %ebx,(%edx)
+}
+  8015a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015a5:	c9                   	leave
+  8015a6:	c3                   	ret
+
+008015a7 <fd_close>:
+{
+  8015a7:	55                   	push   %ebp
+  8015a8:	89 e5                	mov    %esp,%ebp
+  8015aa:	57                   	push   %edi
+  8015ab:	56                   	push   %esi
+  8015ac:	53                   	push   %ebx
+  8015ad:	83 ec 24             	sub    $0x24,%esp
+  8015b0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8015b3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015b6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015b9:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015ba:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8015c0:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015c3:	50                   	push   %eax
+  8015c4:	e8 42 ff ff ff       	call   80150b <fd_lookup>
+  8015c9:	89 c3                	mov    %eax,%ebx
+  8015cb:	83 c4 10             	add    $0x10,%esp
+  8015ce:	85 c0                	test   %eax,%eax
+  8015d0:	78 05                	js     8015d7 <fd_close+0x30>
+	    || fd != fd2)
+  8015d2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8015d5:	74 16                	je     8015ed <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8015d7:	89 f8                	mov    %edi,%eax
+  8015d9:	84 c0                	test   %al,%al
+  8015db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8015e3:	89 d8                	mov    %ebx,%eax
+  8015e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e8:	5b                   	pop    %ebx
+  8015e9:	5e                   	pop    %esi
+  8015ea:	5f                   	pop    %edi
+  8015eb:	5d                   	pop    %ebp
+  8015ec:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8015ed:	83 ec 08             	sub    $0x8,%esp
+  8015f0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8015f3:	50                   	push   %eax
+  8015f4:	ff 36                	push   (%esi)
+  8015f6:	e8 60 ff ff ff       	call   80155b <dev_lookup>
+  8015fb:	89 c3                	mov    %eax,%ebx
+  8015fd:	83 c4 10             	add    $0x10,%esp
+  801600:	85 c0                	test   %eax,%eax
+  801602:	78 1a                	js     80161e <fd_close+0x77>
+		if (dev->dev_close)
+  801604:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801607:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80160a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80160f:	85 c0                	test   %eax,%eax
+  801611:	74 0b                	je     80161e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801613:	83 ec 0c             	sub    $0xc,%esp
+  801616:	56                   	push   %esi
+  801617:	ff d0                	call   *%eax
+  801619:	89 c3                	mov    %eax,%ebx
+  80161b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80161e:	83 ec 08             	sub    $0x8,%esp
+  801621:	56                   	push   %esi
+  801622:	6a 00                	push   $0x0
+  801624:	e8 cf f6 ff ff       	call   800cf8 <sys_page_unmap>
+	return r;
+  801629:	83 c4 10             	add    $0x10,%esp
+  80162c:	eb b5                	jmp    8015e3 <fd_close+0x3c>
+
+0080162e <close>:
+
+int
+close(int fdnum)
+{
+  80162e:	55                   	push   %ebp
+  80162f:	89 e5                	mov    %esp,%ebp
+  801631:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801634:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801637:	50                   	push   %eax
+  801638:	ff 75 08             	push   0x8(%ebp)
+  80163b:	e8 cb fe ff ff       	call   80150b <fd_lookup>
+  801640:	83 c4 10             	add    $0x10,%esp
+  801643:	85 c0                	test   %eax,%eax
+  801645:	79 02                	jns    801649 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801647:	c9                   	leave
+  801648:	c3                   	ret
+		return fd_close(fd, 1);
+  801649:	83 ec 08             	sub    $0x8,%esp
+  80164c:	6a 01                	push   $0x1
+  80164e:	ff 75 f4             	push   -0xc(%ebp)
+  801651:	e8 51 ff ff ff       	call   8015a7 <fd_close>
+  801656:	83 c4 10             	add    $0x10,%esp
+  801659:	eb ec                	jmp    801647 <close+0x19>
+
+0080165b <close_all>:
+
+void
+close_all(void)
+{
+  80165b:	55                   	push   %ebp
+  80165c:	89 e5                	mov    %esp,%ebp
+  80165e:	53                   	push   %ebx
+  80165f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801662:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801667:	83 ec 0c             	sub    $0xc,%esp
+  80166a:	53                   	push   %ebx
+  80166b:	e8 be ff ff ff       	call   80162e <close>
+	for (i = 0; i < MAXFD; i++)
+  801670:	83 c3 01             	add    $0x1,%ebx
+  801673:	83 c4 10             	add    $0x10,%esp
+  801676:	83 fb 20             	cmp    $0x20,%ebx
+  801679:	75 ec                	jne    801667 <close_all+0xc>
+}
+  80167b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80167e:	c9                   	leave
+  80167f:	c3                   	ret
+
+00801680 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801680:	55                   	push   %ebp
+  801681:	89 e5                	mov    %esp,%ebp
+  801683:	57                   	push   %edi
+  801684:	56                   	push   %esi
+  801685:	53                   	push   %ebx
+  801686:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801689:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80168c:	50                   	push   %eax
+  80168d:	ff 75 08             	push   0x8(%ebp)
+  801690:	e8 76 fe ff ff       	call   80150b <fd_lookup>
+  801695:	89 c3                	mov    %eax,%ebx
+  801697:	83 c4 10             	add    $0x10,%esp
+  80169a:	85 c0                	test   %eax,%eax
+  80169c:	78 7f                	js     80171d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80169e:	83 ec 0c             	sub    $0xc,%esp
+  8016a1:	ff 75 0c             	push   0xc(%ebp)
+  8016a4:	e8 85 ff ff ff       	call   80162e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8016a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8016ac:	c1 e6 0c             	shl    $0xc,%esi
+  8016af:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8016b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8016b8:	89 3c 24             	mov    %edi,(%esp)
+  8016bb:	e8 e0 fd ff ff       	call   8014a0 <fd2data>
+  8016c0:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8016c2:	89 34 24             	mov    %esi,(%esp)
+  8016c5:	e8 d6 fd ff ff       	call   8014a0 <fd2data>
+  8016ca:	83 c4 10             	add    $0x10,%esp
+  8016cd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8016d0:	89 d8                	mov    %ebx,%eax
+  8016d2:	c1 e8 16             	shr    $0x16,%eax
+  8016d5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8016dc:	a8 01                	test   $0x1,%al
+  8016de:	74 11                	je     8016f1 <dup+0x71>
+  8016e0:	89 d8                	mov    %ebx,%eax
+  8016e2:	c1 e8 0c             	shr    $0xc,%eax
+  8016e5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016ec:	f6 c2 01             	test   $0x1,%dl
+  8016ef:	75 36                	jne    801727 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8016f1:	89 f8                	mov    %edi,%eax
+  8016f3:	c1 e8 0c             	shr    $0xc,%eax
+  8016f6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016fd:	83 ec 0c             	sub    $0xc,%esp
+  801700:	25 07 0e 00 00       	and    $0xe07,%eax
+  801705:	50                   	push   %eax
+  801706:	56                   	push   %esi
+  801707:	6a 00                	push   $0x0
+  801709:	57                   	push   %edi
+  80170a:	6a 00                	push   $0x0
+  80170c:	e8 a5 f5 ff ff       	call   800cb6 <sys_page_map>
+  801711:	89 c3                	mov    %eax,%ebx
+  801713:	83 c4 20             	add    $0x20,%esp
+  801716:	85 c0                	test   %eax,%eax
+  801718:	78 33                	js     80174d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80171a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80171d:	89 d8                	mov    %ebx,%eax
+  80171f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801722:	5b                   	pop    %ebx
+  801723:	5e                   	pop    %esi
+  801724:	5f                   	pop    %edi
+  801725:	5d                   	pop    %ebp
+  801726:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801727:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80172e:	83 ec 0c             	sub    $0xc,%esp
+  801731:	25 07 0e 00 00       	and    $0xe07,%eax
+  801736:	50                   	push   %eax
+  801737:	ff 75 d4             	push   -0x2c(%ebp)
+  80173a:	6a 00                	push   $0x0
+  80173c:	53                   	push   %ebx
+  80173d:	6a 00                	push   $0x0
+  80173f:	e8 72 f5 ff ff       	call   800cb6 <sys_page_map>
+  801744:	89 c3                	mov    %eax,%ebx
+  801746:	83 c4 20             	add    $0x20,%esp
+  801749:	85 c0                	test   %eax,%eax
+  80174b:	79 a4                	jns    8016f1 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80174d:	83 ec 08             	sub    $0x8,%esp
+  801750:	56                   	push   %esi
+  801751:	6a 00                	push   $0x0
+  801753:	e8 a0 f5 ff ff       	call   800cf8 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801758:	83 c4 08             	add    $0x8,%esp
+  80175b:	ff 75 d4             	push   -0x2c(%ebp)
+  80175e:	6a 00                	push   $0x0
+  801760:	e8 93 f5 ff ff       	call   800cf8 <sys_page_unmap>
+	return r;
+  801765:	83 c4 10             	add    $0x10,%esp
+  801768:	eb b3                	jmp    80171d <dup+0x9d>
+
+0080176a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80176a:	55                   	push   %ebp
+  80176b:	89 e5                	mov    %esp,%ebp
+  80176d:	56                   	push   %esi
+  80176e:	53                   	push   %ebx
+  80176f:	83 ec 18             	sub    $0x18,%esp
+  801772:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801775:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801778:	50                   	push   %eax
+  801779:	56                   	push   %esi
+  80177a:	e8 8c fd ff ff       	call   80150b <fd_lookup>
+  80177f:	83 c4 10             	add    $0x10,%esp
+  801782:	85 c0                	test   %eax,%eax
+  801784:	78 3c                	js     8017c2 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801786:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801789:	83 ec 08             	sub    $0x8,%esp
+  80178c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80178f:	50                   	push   %eax
+  801790:	ff 33                	push   (%ebx)
+  801792:	e8 c4 fd ff ff       	call   80155b <dev_lookup>
+  801797:	83 c4 10             	add    $0x10,%esp
+  80179a:	85 c0                	test   %eax,%eax
+  80179c:	78 24                	js     8017c2 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80179e:	8b 43 08             	mov    0x8(%ebx),%eax
+  8017a1:	83 e0 03             	and    $0x3,%eax
+  8017a4:	83 f8 01             	cmp    $0x1,%eax
+  8017a7:	74 20                	je     8017c9 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8017a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017ac:	8b 40 08             	mov    0x8(%eax),%eax
+  8017af:	85 c0                	test   %eax,%eax
+  8017b1:	74 37                	je     8017ea <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8017b3:	83 ec 04             	sub    $0x4,%esp
+  8017b6:	ff 75 10             	push   0x10(%ebp)
+  8017b9:	ff 75 0c             	push   0xc(%ebp)
+  8017bc:	53                   	push   %ebx
+  8017bd:	ff d0                	call   *%eax
+  8017bf:	83 c4 10             	add    $0x10,%esp
+}
+  8017c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017c5:	5b                   	pop    %ebx
+  8017c6:	5e                   	pop    %esi
+  8017c7:	5d                   	pop    %ebp
+  8017c8:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017c9:	a1 08 40 80 00       	mov    0x804008,%eax
+  8017ce:	8b 40 48             	mov    0x48(%eax),%eax
+  8017d1:	83 ec 04             	sub    $0x4,%esp
+  8017d4:	56                   	push   %esi
+  8017d5:	50                   	push   %eax
+  8017d6:	68 31 2b 80 00       	push   $0x802b31
+  8017db:	e8 b9 e9 ff ff       	call   800199 <cprintf>
+		return -E_INVAL;
+  8017e0:	83 c4 10             	add    $0x10,%esp
+  8017e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017e8:	eb d8                	jmp    8017c2 <read+0x58>
+		return -E_NOT_SUPP;
+  8017ea:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017ef:	eb d1                	jmp    8017c2 <read+0x58>
+
+008017f1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8017f1:	55                   	push   %ebp
+  8017f2:	89 e5                	mov    %esp,%ebp
+  8017f4:	57                   	push   %edi
+  8017f5:	56                   	push   %esi
+  8017f6:	53                   	push   %ebx
+  8017f7:	83 ec 0c             	sub    $0xc,%esp
+  8017fa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8017fd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801800:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801805:	eb 02                	jmp    801809 <readn+0x18>
+  801807:	01 c3                	add    %eax,%ebx
+  801809:	39 f3                	cmp    %esi,%ebx
+  80180b:	73 21                	jae    80182e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80180d:	83 ec 04             	sub    $0x4,%esp
+  801810:	89 f0                	mov    %esi,%eax
+  801812:	29 d8                	sub    %ebx,%eax
+  801814:	50                   	push   %eax
+  801815:	89 d8                	mov    %ebx,%eax
+  801817:	03 45 0c             	add    0xc(%ebp),%eax
+  80181a:	50                   	push   %eax
+  80181b:	57                   	push   %edi
+  80181c:	e8 49 ff ff ff       	call   80176a <read>
+		if (m < 0)
+  801821:	83 c4 10             	add    $0x10,%esp
+  801824:	85 c0                	test   %eax,%eax
+  801826:	78 04                	js     80182c <readn+0x3b>
+			return m;
+		if (m == 0)
+  801828:	75 dd                	jne    801807 <readn+0x16>
+  80182a:	eb 02                	jmp    80182e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80182c:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80182e:	89 d8                	mov    %ebx,%eax
+  801830:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801833:	5b                   	pop    %ebx
+  801834:	5e                   	pop    %esi
+  801835:	5f                   	pop    %edi
+  801836:	5d                   	pop    %ebp
+  801837:	c3                   	ret
+
+00801838 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801838:	55                   	push   %ebp
+  801839:	89 e5                	mov    %esp,%ebp
+  80183b:	56                   	push   %esi
+  80183c:	53                   	push   %ebx
+  80183d:	83 ec 18             	sub    $0x18,%esp
+  801840:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801843:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801846:	50                   	push   %eax
+  801847:	53                   	push   %ebx
+  801848:	e8 be fc ff ff       	call   80150b <fd_lookup>
+  80184d:	83 c4 10             	add    $0x10,%esp
+  801850:	85 c0                	test   %eax,%eax
+  801852:	78 37                	js     80188b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801854:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801857:	83 ec 08             	sub    $0x8,%esp
+  80185a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80185d:	50                   	push   %eax
+  80185e:	ff 36                	push   (%esi)
+  801860:	e8 f6 fc ff ff       	call   80155b <dev_lookup>
+  801865:	83 c4 10             	add    $0x10,%esp
+  801868:	85 c0                	test   %eax,%eax
+  80186a:	78 1f                	js     80188b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80186c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801870:	74 20                	je     801892 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801872:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801875:	8b 40 0c             	mov    0xc(%eax),%eax
+  801878:	85 c0                	test   %eax,%eax
+  80187a:	74 37                	je     8018b3 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80187c:	83 ec 04             	sub    $0x4,%esp
+  80187f:	ff 75 10             	push   0x10(%ebp)
+  801882:	ff 75 0c             	push   0xc(%ebp)
+  801885:	56                   	push   %esi
+  801886:	ff d0                	call   *%eax
+  801888:	83 c4 10             	add    $0x10,%esp
+}
+  80188b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80188e:	5b                   	pop    %ebx
+  80188f:	5e                   	pop    %esi
+  801890:	5d                   	pop    %ebp
+  801891:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801892:	a1 08 40 80 00       	mov    0x804008,%eax
+  801897:	8b 40 48             	mov    0x48(%eax),%eax
+  80189a:	83 ec 04             	sub    $0x4,%esp
+  80189d:	53                   	push   %ebx
+  80189e:	50                   	push   %eax
+  80189f:	68 4d 2b 80 00       	push   $0x802b4d
+  8018a4:	e8 f0 e8 ff ff       	call   800199 <cprintf>
+		return -E_INVAL;
+  8018a9:	83 c4 10             	add    $0x10,%esp
+  8018ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b1:	eb d8                	jmp    80188b <write+0x53>
+		return -E_NOT_SUPP;
+  8018b3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018b8:	eb d1                	jmp    80188b <write+0x53>
+
+008018ba <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8018ba:	55                   	push   %ebp
+  8018bb:	89 e5                	mov    %esp,%ebp
+  8018bd:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8018c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018c3:	50                   	push   %eax
+  8018c4:	ff 75 08             	push   0x8(%ebp)
+  8018c7:	e8 3f fc ff ff       	call   80150b <fd_lookup>
+  8018cc:	83 c4 10             	add    $0x10,%esp
+  8018cf:	85 c0                	test   %eax,%eax
+  8018d1:	78 0e                	js     8018e1 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8018d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018d9:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8018dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018e1:	c9                   	leave
+  8018e2:	c3                   	ret
+
+008018e3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018e3:	55                   	push   %ebp
+  8018e4:	89 e5                	mov    %esp,%ebp
+  8018e6:	56                   	push   %esi
+  8018e7:	53                   	push   %ebx
+  8018e8:	83 ec 18             	sub    $0x18,%esp
+  8018eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018ee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018f1:	50                   	push   %eax
+  8018f2:	53                   	push   %ebx
+  8018f3:	e8 13 fc ff ff       	call   80150b <fd_lookup>
+  8018f8:	83 c4 10             	add    $0x10,%esp
+  8018fb:	85 c0                	test   %eax,%eax
+  8018fd:	78 34                	js     801933 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018ff:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801902:	83 ec 08             	sub    $0x8,%esp
+  801905:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801908:	50                   	push   %eax
+  801909:	ff 36                	push   (%esi)
+  80190b:	e8 4b fc ff ff       	call   80155b <dev_lookup>
+  801910:	83 c4 10             	add    $0x10,%esp
+  801913:	85 c0                	test   %eax,%eax
+  801915:	78 1c                	js     801933 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801917:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80191b:	74 1d                	je     80193a <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80191d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801920:	8b 40 18             	mov    0x18(%eax),%eax
+  801923:	85 c0                	test   %eax,%eax
+  801925:	74 34                	je     80195b <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801927:	83 ec 08             	sub    $0x8,%esp
+  80192a:	ff 75 0c             	push   0xc(%ebp)
+  80192d:	56                   	push   %esi
+  80192e:	ff d0                	call   *%eax
+  801930:	83 c4 10             	add    $0x10,%esp
+}
+  801933:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801936:	5b                   	pop    %ebx
+  801937:	5e                   	pop    %esi
+  801938:	5d                   	pop    %ebp
+  801939:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80193a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80193f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801942:	83 ec 04             	sub    $0x4,%esp
+  801945:	53                   	push   %ebx
+  801946:	50                   	push   %eax
+  801947:	68 10 2b 80 00       	push   $0x802b10
+  80194c:	e8 48 e8 ff ff       	call   800199 <cprintf>
+		return -E_INVAL;
+  801951:	83 c4 10             	add    $0x10,%esp
+  801954:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801959:	eb d8                	jmp    801933 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80195b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801960:	eb d1                	jmp    801933 <ftruncate+0x50>
+
+00801962 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801962:	55                   	push   %ebp
+  801963:	89 e5                	mov    %esp,%ebp
+  801965:	56                   	push   %esi
+  801966:	53                   	push   %ebx
+  801967:	83 ec 18             	sub    $0x18,%esp
+  80196a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80196d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801970:	50                   	push   %eax
+  801971:	ff 75 08             	push   0x8(%ebp)
+  801974:	e8 92 fb ff ff       	call   80150b <fd_lookup>
+  801979:	83 c4 10             	add    $0x10,%esp
+  80197c:	85 c0                	test   %eax,%eax
+  80197e:	78 49                	js     8019c9 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801980:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801983:	83 ec 08             	sub    $0x8,%esp
+  801986:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801989:	50                   	push   %eax
+  80198a:	ff 36                	push   (%esi)
+  80198c:	e8 ca fb ff ff       	call   80155b <dev_lookup>
+  801991:	83 c4 10             	add    $0x10,%esp
+  801994:	85 c0                	test   %eax,%eax
+  801996:	78 31                	js     8019c9 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801998:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80199b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80199f:	74 2f                	je     8019d0 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8019a1:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8019a4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8019ab:	00 00 00 
+	stat->st_isdir = 0;
+  8019ae:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8019b5:	00 00 00 
+	stat->st_dev = dev;
+  8019b8:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8019be:	83 ec 08             	sub    $0x8,%esp
+  8019c1:	53                   	push   %ebx
+  8019c2:	56                   	push   %esi
+  8019c3:	ff 50 14             	call   *0x14(%eax)
+  8019c6:	83 c4 10             	add    $0x10,%esp
+}
+  8019c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019cc:	5b                   	pop    %ebx
+  8019cd:	5e                   	pop    %esi
+  8019ce:	5d                   	pop    %ebp
+  8019cf:	c3                   	ret
+		return -E_NOT_SUPP;
+  8019d0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019d5:	eb f2                	jmp    8019c9 <fstat+0x67>
+
+008019d7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8019d7:	55                   	push   %ebp
+  8019d8:	89 e5                	mov    %esp,%ebp
+  8019da:	56                   	push   %esi
+  8019db:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8019dc:	83 ec 08             	sub    $0x8,%esp
+  8019df:	6a 00                	push   $0x0
+  8019e1:	ff 75 08             	push   0x8(%ebp)
+  8019e4:	e8 bc 02 00 00       	call   801ca5 <open>
+  8019e9:	89 c3                	mov    %eax,%ebx
+  8019eb:	83 c4 10             	add    $0x10,%esp
+  8019ee:	85 c0                	test   %eax,%eax
+  8019f0:	78 1b                	js     801a0d <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8019f2:	83 ec 08             	sub    $0x8,%esp
+  8019f5:	ff 75 0c             	push   0xc(%ebp)
+  8019f8:	50                   	push   %eax
+  8019f9:	e8 64 ff ff ff       	call   801962 <fstat>
+  8019fe:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801a00:	89 1c 24             	mov    %ebx,(%esp)
+  801a03:	e8 26 fc ff ff       	call   80162e <close>
+	return r;
+  801a08:	83 c4 10             	add    $0x10,%esp
+  801a0b:	89 f3                	mov    %esi,%ebx
+}
+  801a0d:	89 d8                	mov    %ebx,%eax
+  801a0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a12:	5b                   	pop    %ebx
+  801a13:	5e                   	pop    %esi
+  801a14:	5d                   	pop    %ebp
+  801a15:	c3                   	ret
+
+00801a16 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801a16:	55                   	push   %ebp
+  801a17:	89 e5                	mov    %esp,%ebp
+  801a19:	57                   	push   %edi
+  801a1a:	56                   	push   %esi
+  801a1b:	53                   	push   %ebx
+  801a1c:	83 ec 0c             	sub    $0xc,%esp
+  801a1f:	89 c7                	mov    %eax,%edi
+  801a21:	89 d3                	mov    %edx,%ebx
+  801a23:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801a25:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801a2c:	74 2d                	je     801a5b <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a2e:	6a 07                	push   $0x7
+  801a30:	68 00 50 80 00       	push   $0x805000
+  801a35:	57                   	push   %edi
+  801a36:	ff 35 00 40 80 00    	push   0x804000
+  801a3c:	e8 1b f9 ff ff       	call   80135c <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801a41:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801a48:	6a 00                	push   $0x0
+  801a4a:	56                   	push   %esi
+  801a4b:	53                   	push   %ebx
+  801a4c:	6a 00                	push   $0x0
+  801a4e:	e8 bb f7 ff ff       	call   80120e <ipc_recv_pages>
+}
+  801a53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a56:	5b                   	pop    %ebx
+  801a57:	5e                   	pop    %esi
+  801a58:	5f                   	pop    %edi
+  801a59:	5d                   	pop    %ebp
+  801a5a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a5b:	83 ec 0c             	sub    $0xc,%esp
+  801a5e:	6a 01                	push   $0x1
+  801a60:	e8 ec f9 ff ff       	call   801451 <ipc_find_env>
+  801a65:	a3 00 40 80 00       	mov    %eax,0x804000
+  801a6a:	83 c4 10             	add    $0x10,%esp
+  801a6d:	eb bf                	jmp    801a2e <fsipc_pages+0x18>
+
+00801a6f <fsipc>:
+{
+  801a6f:	55                   	push   %ebp
+  801a70:	89 e5                	mov    %esp,%ebp
+  801a72:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801a75:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a7a:	e8 97 ff ff ff       	call   801a16 <fsipc_pages>
+}
+  801a7f:	c9                   	leave
+  801a80:	c3                   	ret
+
+00801a81 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a81:	55                   	push   %ebp
+  801a82:	89 e5                	mov    %esp,%ebp
+  801a84:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a87:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a8a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a8d:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  801a92:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a95:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801a9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a9f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801aa4:	e8 c6 ff ff ff       	call   801a6f <fsipc>
+}
+  801aa9:	c9                   	leave
+  801aaa:	c3                   	ret
+
+00801aab <devfile_flush>:
+{
+  801aab:	55                   	push   %ebp
+  801aac:	89 e5                	mov    %esp,%ebp
+  801aae:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ab1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ab4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ab7:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801abc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac1:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ac6:	e8 a4 ff ff ff       	call   801a6f <fsipc>
+}
+  801acb:	c9                   	leave
+  801acc:	c3                   	ret
+
+00801acd <devfile_stat>:
+{
+  801acd:	55                   	push   %ebp
+  801ace:	89 e5                	mov    %esp,%ebp
+  801ad0:	53                   	push   %ebx
+  801ad1:	83 ec 04             	sub    $0x4,%esp
+  801ad4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ad7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ada:	8b 40 0c             	mov    0xc(%eax),%eax
+  801add:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801ae2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ae7:	b8 05 00 00 00       	mov    $0x5,%eax
+  801aec:	e8 7e ff ff ff       	call   801a6f <fsipc>
+  801af1:	85 c0                	test   %eax,%eax
+  801af3:	78 2c                	js     801b21 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801af5:	83 ec 08             	sub    $0x8,%esp
+  801af8:	68 00 50 80 00       	push   $0x805000
+  801afd:	53                   	push   %ebx
+  801afe:	e8 7d ec ff ff       	call   800780 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801b03:	a1 80 50 80 00       	mov    0x805080,%eax
+  801b08:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b0e:	a1 84 50 80 00       	mov    0x805084,%eax
+  801b13:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801b19:	83 c4 10             	add    $0x10,%esp
+  801b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b24:	c9                   	leave
+  801b25:	c3                   	ret
+
+00801b26 <devfile_write>:
+{
+  801b26:	55                   	push   %ebp
+  801b27:	89 e5                	mov    %esp,%ebp
+  801b29:	83 ec 0c             	sub    $0xc,%esp
+  801b2c:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801b2f:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801b34:	39 d0                	cmp    %edx,%eax
+  801b36:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b39:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b3c:	8b 52 0c             	mov    0xc(%edx),%edx
+  801b3f:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  801b45:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801b4a:	50                   	push   %eax
+  801b4b:	ff 75 0c             	push   0xc(%ebp)
+  801b4e:	68 08 50 80 00       	push   $0x805008
+  801b53:	e8 ae ed ff ff       	call   800906 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801b58:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b62:	e8 08 ff ff ff       	call   801a6f <fsipc>
+}
+  801b67:	c9                   	leave
+  801b68:	c3                   	ret
+
+00801b69 <devfile_read>:
+{
+  801b69:	55                   	push   %ebp
+  801b6a:	89 e5                	mov    %esp,%ebp
+  801b6c:	57                   	push   %edi
+  801b6d:	56                   	push   %esi
+  801b6e:	53                   	push   %ebx
+  801b6f:	83 ec 1c             	sub    $0x1c,%esp
+  801b72:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801b75:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801b78:	89 fe                	mov    %edi,%esi
+  801b7a:	c1 ee 0c             	shr    $0xc,%esi
+  801b7d:	b8 20 00 00 00       	mov    $0x20,%eax
+  801b82:	39 c6                	cmp    %eax,%esi
+  801b84:	0f 47 f0             	cmova  %eax,%esi
+  801b87:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b8f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801b92:	eb 14                	jmp    801ba8 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801b94:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801b9b:	05 00 10 00 00       	add    $0x1000,%eax
+  801ba0:	f6 c6 06             	test   $0x6,%dh
+  801ba3:	75 42                	jne    801be7 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801ba5:	83 c1 01             	add    $0x1,%ecx
+  801ba8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801bab:	39 f1                	cmp    %esi,%ecx
+  801bad:	0f 84 95 00 00 00    	je     801c48 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801bb3:	89 c2                	mov    %eax,%edx
+  801bb5:	c1 ea 16             	shr    $0x16,%edx
+  801bb8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801bbf:	f6 c2 01             	test   $0x1,%dl
+  801bc2:	74 23                	je     801be7 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801bc4:	89 c2                	mov    %eax,%edx
+  801bc6:	c1 ea 0c             	shr    $0xc,%edx
+  801bc9:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801bd0:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801bd6:	74 0f                	je     801be7 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801bd8:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801bdf:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801be5:	75 ad                	jne    801b94 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801be7:	85 c9                	test   %ecx,%ecx
+  801be9:	74 11                	je     801bfc <devfile_read+0x93>
+  801beb:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801bf2:	75 08                	jne    801bfc <devfile_read+0x93>
+  801bf4:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801bfa:	74 50                	je     801c4c <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bfc:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801bff:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  801c04:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801c0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c14:	e8 56 fe ff ff       	call   801a6f <fsipc>
+  801c19:	89 c6                	mov    %eax,%esi
+  801c1b:	85 c0                	test   %eax,%eax
+  801c1d:	78 1f                	js     801c3e <devfile_read+0xd5>
+	assert(r <= n);
+  801c1f:	39 c7                	cmp    %eax,%edi
+  801c21:	72 50                	jb     801c73 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801c23:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801c28:	7f 62                	jg     801c8c <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801c2a:	83 ec 04             	sub    $0x4,%esp
+  801c2d:	50                   	push   %eax
+  801c2e:	68 00 50 80 00       	push   $0x805000
+  801c33:	ff 75 0c             	push   0xc(%ebp)
+  801c36:	e8 cb ec ff ff       	call   800906 <memmove>
+	return r;
+  801c3b:	83 c4 10             	add    $0x10,%esp
+}
+  801c3e:	89 f0                	mov    %esi,%eax
+  801c40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c43:	5b                   	pop    %ebx
+  801c44:	5e                   	pop    %esi
+  801c45:	5f                   	pop    %edi
+  801c46:	5d                   	pop    %ebp
+  801c47:	c3                   	ret
+  801c48:	89 f1                	mov    %esi,%ecx
+  801c4a:	eb 9b                	jmp    801be7 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801c4c:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c4f:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801c54:	89 c8                	mov    %ecx,%eax
+  801c56:	c1 e0 0c             	shl    $0xc,%eax
+  801c59:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801c5e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c61:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801c66:	e8 ab fd ff ff       	call   801a16 <fsipc_pages>
+  801c6b:	89 c6                	mov    %eax,%esi
+  801c6d:	85 c0                	test   %eax,%eax
+  801c6f:	78 8b                	js     801bfc <devfile_read+0x93>
+  801c71:	eb cb                	jmp    801c3e <devfile_read+0xd5>
+	assert(r <= n);
+  801c73:	68 7c 2b 80 00       	push   $0x802b7c
+  801c78:	68 83 2b 80 00       	push   $0x802b83
+  801c7d:	68 a0 00 00 00       	push   $0xa0
+  801c82:	68 98 2b 80 00       	push   $0x802b98
+  801c87:	e8 e4 07 00 00       	call   802470 <_panic>
+	assert(r <= PGSIZE);
+  801c8c:	68 a3 2b 80 00       	push   $0x802ba3
+  801c91:	68 83 2b 80 00       	push   $0x802b83
+  801c96:	68 a1 00 00 00       	push   $0xa1
+  801c9b:	68 98 2b 80 00       	push   $0x802b98
+  801ca0:	e8 cb 07 00 00       	call   802470 <_panic>
+
+00801ca5 <open>:
+{
+  801ca5:	55                   	push   %ebp
+  801ca6:	89 e5                	mov    %esp,%ebp
+  801ca8:	56                   	push   %esi
+  801ca9:	53                   	push   %ebx
+  801caa:	83 ec 1c             	sub    $0x1c,%esp
+  801cad:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801cb0:	56                   	push   %esi
+  801cb1:	e8 8f ea ff ff       	call   800745 <strlen>
+  801cb6:	83 c4 10             	add    $0x10,%esp
+  801cb9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801cbe:	7f 6c                	jg     801d2c <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801cc0:	83 ec 0c             	sub    $0xc,%esp
+  801cc3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cc6:	50                   	push   %eax
+  801cc7:	e8 eb f7 ff ff       	call   8014b7 <fd_alloc>
+  801ccc:	89 c3                	mov    %eax,%ebx
+  801cce:	83 c4 10             	add    $0x10,%esp
+  801cd1:	85 c0                	test   %eax,%eax
+  801cd3:	78 3c                	js     801d11 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801cd5:	83 ec 08             	sub    $0x8,%esp
+  801cd8:	56                   	push   %esi
+  801cd9:	68 00 50 80 00       	push   $0x805000
+  801cde:	e8 9d ea ff ff       	call   800780 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801ce3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ce6:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ceb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801cee:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cf3:	e8 77 fd ff ff       	call   801a6f <fsipc>
+  801cf8:	89 c3                	mov    %eax,%ebx
+  801cfa:	83 c4 10             	add    $0x10,%esp
+  801cfd:	85 c0                	test   %eax,%eax
+  801cff:	78 19                	js     801d1a <open+0x75>
+	return fd2num(fd);
+  801d01:	83 ec 0c             	sub    $0xc,%esp
+  801d04:	ff 75 f4             	push   -0xc(%ebp)
+  801d07:	e8 84 f7 ff ff       	call   801490 <fd2num>
+  801d0c:	89 c3                	mov    %eax,%ebx
+  801d0e:	83 c4 10             	add    $0x10,%esp
+}
+  801d11:	89 d8                	mov    %ebx,%eax
+  801d13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d16:	5b                   	pop    %ebx
+  801d17:	5e                   	pop    %esi
+  801d18:	5d                   	pop    %ebp
+  801d19:	c3                   	ret
+		fd_close(fd, 0);
+  801d1a:	83 ec 08             	sub    $0x8,%esp
+  801d1d:	6a 00                	push   $0x0
+  801d1f:	ff 75 f4             	push   -0xc(%ebp)
+  801d22:	e8 80 f8 ff ff       	call   8015a7 <fd_close>
+		return r;
+  801d27:	83 c4 10             	add    $0x10,%esp
+  801d2a:	eb e5                	jmp    801d11 <open+0x6c>
+		return -E_BAD_PATH;
+  801d2c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d31:	eb de                	jmp    801d11 <open+0x6c>
+
+00801d33 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801d33:	55                   	push   %ebp
+  801d34:	89 e5                	mov    %esp,%ebp
+  801d36:	53                   	push   %ebx
+  801d37:	83 ec 10             	sub    $0x10,%esp
+  801d3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801d3d:	53                   	push   %ebx
+  801d3e:	e8 02 ea ff ff       	call   800745 <strlen>
+  801d43:	83 c4 10             	add    $0x10,%esp
+  801d46:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d4b:	7f 25                	jg     801d72 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801d4d:	83 ec 08             	sub    $0x8,%esp
+  801d50:	53                   	push   %ebx
+  801d51:	68 00 50 80 00       	push   $0x805000
+  801d56:	e8 25 ea ff ff       	call   800780 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801d5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d60:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d65:	e8 05 fd ff ff       	call   801a6f <fsipc>
+  801d6a:	83 c4 10             	add    $0x10,%esp
+}
+  801d6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d70:	c9                   	leave
+  801d71:	c3                   	ret
+		return -E_BAD_PATH;
+  801d72:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801d77:	eb f4                	jmp    801d6d <remove+0x3a>
+
+00801d79 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801d79:	55                   	push   %ebp
+  801d7a:	89 e5                	mov    %esp,%ebp
+  801d7c:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801d7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d84:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d89:	e8 e1 fc ff ff       	call   801a6f <fsipc>
+}
+  801d8e:	c9                   	leave
+  801d8f:	c3                   	ret
+
+00801d90 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801d90:	55                   	push   %ebp
+  801d91:	89 e5                	mov    %esp,%ebp
+  801d93:	53                   	push   %ebx
+  801d94:	83 ec 04             	sub    $0x4,%esp
+  801d97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801d9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801da4:	e8 c6 fc ff ff       	call   801a6f <fsipc>
+  801da9:	85 c0                	test   %eax,%eax
+  801dab:	78 3c                	js     801de9 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801dad:	a1 00 50 80 00       	mov    0x805000,%eax
+  801db2:	89 03                	mov    %eax,(%ebx)
+  801db4:	a1 04 50 80 00       	mov    0x805004,%eax
+  801db9:	89 43 04             	mov    %eax,0x4(%ebx)
+  801dbc:	a1 08 50 80 00       	mov    0x805008,%eax
+  801dc1:	89 43 08             	mov    %eax,0x8(%ebx)
+  801dc4:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801dc9:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801dcc:	a1 10 50 80 00       	mov    0x805010,%eax
+  801dd1:	89 43 10             	mov    %eax,0x10(%ebx)
+  801dd4:	a1 14 50 80 00       	mov    0x805014,%eax
+  801dd9:	89 43 14             	mov    %eax,0x14(%ebx)
+  801ddc:	a1 18 50 80 00       	mov    0x805018,%eax
+  801de1:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801de4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801de9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dec:	c9                   	leave
+  801ded:	c3                   	ret
+
+00801dee <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801dee:	55                   	push   %ebp
+  801def:	89 e5                	mov    %esp,%ebp
+  801df1:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801df4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df7:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  801dfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e01:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801e06:	e8 64 fc ff ff       	call   801a6f <fsipc>
+}
+  801e0b:	c9                   	leave
+  801e0c:	c3                   	ret
+
+00801e0d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e0d:	55                   	push   %ebp
+  801e0e:	89 e5                	mov    %esp,%ebp
+  801e10:	56                   	push   %esi
+  801e11:	53                   	push   %ebx
+  801e12:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801e15:	83 ec 0c             	sub    $0xc,%esp
+  801e18:	ff 75 08             	push   0x8(%ebp)
+  801e1b:	e8 80 f6 ff ff       	call   8014a0 <fd2data>
+  801e20:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801e22:	83 c4 08             	add    $0x8,%esp
+  801e25:	68 af 2b 80 00       	push   $0x802baf
+  801e2a:	53                   	push   %ebx
+  801e2b:	e8 50 e9 ff ff       	call   800780 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801e30:	8b 46 04             	mov    0x4(%esi),%eax
+  801e33:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801e39:	2b 0e                	sub    (%esi),%ecx
+  801e3b:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801e40:	89 c8                	mov    %ecx,%eax
+  801e42:	f7 e2                	mul    %edx
+  801e44:	c1 ea 0c             	shr    $0xc,%edx
+  801e47:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801e4d:	29 d1                	sub    %edx,%ecx
+  801e4f:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801e55:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e5c:	00 00 00 
+	stat->st_dev = &devpipe;
+  801e5f:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  801e66:	30 80 00 
+	return 0;
+}
+  801e69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e71:	5b                   	pop    %ebx
+  801e72:	5e                   	pop    %esi
+  801e73:	5d                   	pop    %ebp
+  801e74:	c3                   	ret
+
+00801e75 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801e75:	55                   	push   %ebp
+  801e76:	89 e5                	mov    %esp,%ebp
+  801e78:	53                   	push   %ebx
+  801e79:	83 ec 0c             	sub    $0xc,%esp
+  801e7c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801e7f:	53                   	push   %ebx
+  801e80:	6a 00                	push   $0x0
+  801e82:	e8 71 ee ff ff       	call   800cf8 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801e87:	89 1c 24             	mov    %ebx,(%esp)
+  801e8a:	e8 11 f6 ff ff       	call   8014a0 <fd2data>
+  801e8f:	83 c4 08             	add    $0x8,%esp
+  801e92:	50                   	push   %eax
+  801e93:	6a 00                	push   $0x0
+  801e95:	e8 5e ee ff ff       	call   800cf8 <sys_page_unmap>
+}
+  801e9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e9d:	c9                   	leave
+  801e9e:	c3                   	ret
+
+00801e9f <_pipeisclosed>:
+{
+  801e9f:	55                   	push   %ebp
+  801ea0:	89 e5                	mov    %esp,%ebp
+  801ea2:	57                   	push   %edi
+  801ea3:	56                   	push   %esi
+  801ea4:	53                   	push   %ebx
+  801ea5:	83 ec 1c             	sub    $0x1c,%esp
+  801ea8:	89 c7                	mov    %eax,%edi
+  801eaa:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801eac:	a1 08 40 80 00       	mov    0x804008,%eax
+  801eb1:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801eb4:	83 ec 0c             	sub    $0xc,%esp
+  801eb7:	57                   	push   %edi
+  801eb8:	e8 f9 05 00 00       	call   8024b6 <pageref>
+  801ebd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ec0:	89 34 24             	mov    %esi,(%esp)
+  801ec3:	e8 ee 05 00 00       	call   8024b6 <pageref>
+		nn = thisenv->env_runs;
+  801ec8:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801ece:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801ed1:	83 c4 10             	add    $0x10,%esp
+  801ed4:	39 cb                	cmp    %ecx,%ebx
+  801ed6:	74 1b                	je     801ef3 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801ed8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801edb:	75 cf                	jne    801eac <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801edd:	8b 42 58             	mov    0x58(%edx),%eax
+  801ee0:	6a 01                	push   $0x1
+  801ee2:	50                   	push   %eax
+  801ee3:	53                   	push   %ebx
+  801ee4:	68 b6 2b 80 00       	push   $0x802bb6
+  801ee9:	e8 ab e2 ff ff       	call   800199 <cprintf>
+  801eee:	83 c4 10             	add    $0x10,%esp
+  801ef1:	eb b9                	jmp    801eac <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801ef3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ef6:	0f 94 c0             	sete   %al
+  801ef9:	0f b6 c0             	movzbl %al,%eax
+}
+  801efc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eff:	5b                   	pop    %ebx
+  801f00:	5e                   	pop    %esi
+  801f01:	5f                   	pop    %edi
+  801f02:	5d                   	pop    %ebp
+  801f03:	c3                   	ret
+
+00801f04 <devpipe_read>:
+{
+  801f04:	55                   	push   %ebp
+  801f05:	89 e5                	mov    %esp,%ebp
+  801f07:	57                   	push   %edi
+  801f08:	56                   	push   %esi
+  801f09:	53                   	push   %ebx
+  801f0a:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801f0d:	ff 75 08             	push   0x8(%ebp)
+  801f10:	e8 8b f5 ff ff       	call   8014a0 <fd2data>
+  801f15:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801f17:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801f1a:	8d 40 04             	lea    0x4(%eax),%eax
+  801f1d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801f20:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801f23:	8b 0b                	mov    (%ebx),%ecx
+  801f25:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801f2b:	29 ce                	sub    %ecx,%esi
+  801f2d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f32:	f7 e6                	mul    %esi
+  801f34:	c1 ea 0c             	shr    $0xc,%edx
+  801f37:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801f3d:	29 c6                	sub    %eax,%esi
+  801f3f:	89 f2                	mov    %esi,%edx
+  801f41:	75 43                	jne    801f86 <devpipe_read+0x82>
+		ref = pageref(p);
+  801f43:	83 ec 0c             	sub    $0xc,%esp
+  801f46:	53                   	push   %ebx
+  801f47:	e8 6a 05 00 00       	call   8024b6 <pageref>
+  801f4c:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801f4e:	89 da                	mov    %ebx,%edx
+  801f50:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f53:	e8 47 ff ff ff       	call   801e9f <_pipeisclosed>
+  801f58:	83 c4 10             	add    $0x10,%esp
+  801f5b:	85 c0                	test   %eax,%eax
+  801f5d:	0f 85 c1 00 00 00    	jne    802024 <devpipe_read+0x120>
+	*sleeping = 1;
+  801f63:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801f6a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801f6f:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801f72:	75 ac                	jne    801f20 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801f74:	83 ec 04             	sub    $0x4,%esp
+  801f77:	56                   	push   %esi
+  801f78:	57                   	push   %edi
+  801f79:	ff 75 e4             	push   -0x1c(%ebp)
+  801f7c:	e8 cb f1 ff ff       	call   80114c <sys_futex_wait>
+  801f81:	83 c4 10             	add    $0x10,%esp
+  801f84:	eb 9a                	jmp    801f20 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801f86:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801f89:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801f8d:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801f8f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f94:	f7 e1                	mul    %ecx
+  801f96:	c1 ea 0b             	shr    $0xb,%edx
+  801f99:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801f9f:	29 c1                	sub    %eax,%ecx
+  801fa1:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801fa3:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801fa8:	29 cf                	sub    %ecx,%edi
+  801faa:	39 f7                	cmp    %esi,%edi
+  801fac:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801faf:	8d 43 10             	lea    0x10(%ebx),%eax
+  801fb2:	83 ec 04             	sub    $0x4,%esp
+  801fb5:	57                   	push   %edi
+  801fb6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801fb9:	01 c2                	add    %eax,%edx
+  801fbb:	52                   	push   %edx
+  801fbc:	ff 75 0c             	push   0xc(%ebp)
+  801fbf:	e8 42 e9 ff ff       	call   800906 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801fc4:	83 c4 0c             	add    $0xc,%esp
+  801fc7:	89 f1                	mov    %esi,%ecx
+  801fc9:	29 f9                	sub    %edi,%ecx
+  801fcb:	51                   	push   %ecx
+  801fcc:	ff 75 e4             	push   -0x1c(%ebp)
+  801fcf:	89 f8                	mov    %edi,%eax
+  801fd1:	03 45 0c             	add    0xc(%ebp),%eax
+  801fd4:	50                   	push   %eax
+  801fd5:	e8 2c e9 ff ff       	call   800906 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801fda:	89 f1                	mov    %esi,%ecx
+  801fdc:	03 0b                	add    (%ebx),%ecx
+  801fde:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801fe3:	f7 e1                	mul    %ecx
+  801fe5:	c1 ea 0c             	shr    $0xc,%edx
+  801fe8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801fee:	29 d1                	sub    %edx,%ecx
+  801ff0:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801ff2:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801ff7:	83 c4 10             	add    $0x10,%esp
+  801ffa:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801ffe:	75 0a                	jne    80200a <devpipe_read+0x106>
+	return n;
+  802000:	89 f0                	mov    %esi,%eax
+}
+  802002:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802005:	5b                   	pop    %ebx
+  802006:	5e                   	pop    %esi
+  802007:	5f                   	pop    %edi
+  802008:	5d                   	pop    %ebp
+  802009:	c3                   	ret
+		*sleeping = 0;
+  80200a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  802011:	83 ec 08             	sub    $0x8,%esp
+  802014:	68 00 04 00 00       	push   $0x400
+  802019:	53                   	push   %ebx
+  80201a:	e8 7d f1 ff ff       	call   80119c <sys_futex_wake>
+  80201f:	83 c4 10             	add    $0x10,%esp
+  802022:	eb dc                	jmp    802000 <devpipe_read+0xfc>
+			return 0;
+  802024:	b8 00 00 00 00       	mov    $0x0,%eax
+  802029:	eb d7                	jmp    802002 <devpipe_read+0xfe>
+
+0080202b <devpipe_write>:
+{
+  80202b:	55                   	push   %ebp
+  80202c:	89 e5                	mov    %esp,%ebp
+  80202e:	57                   	push   %edi
+  80202f:	56                   	push   %esi
+  802030:	53                   	push   %ebx
+  802031:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802034:	ff 75 08             	push   0x8(%ebp)
+  802037:	e8 64 f4 ff ff       	call   8014a0 <fd2data>
+  80203c:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  80203e:	83 c4 10             	add    $0x10,%esp
+  802041:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802048:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80204b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80204e:	0f 83 23 01 00 00    	jae    802177 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802054:	8b 77 04             	mov    0x4(%edi),%esi
+  802057:	8b 1f                	mov    (%edi),%ebx
+  802059:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  80205f:	29 d9                	sub    %ebx,%ecx
+  802061:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802066:	f7 e1                	mul    %ecx
+  802068:	c1 ea 0c             	shr    $0xc,%edx
+  80206b:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802071:	29 c1                	sub    %eax,%ecx
+  802073:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802075:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80207b:	75 40                	jne    8020bd <devpipe_write+0x92>
+			ref = pageref(p);
+  80207d:	83 ec 0c             	sub    $0xc,%esp
+  802080:	57                   	push   %edi
+  802081:	e8 30 04 00 00       	call   8024b6 <pageref>
+  802086:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  802088:	89 fa                	mov    %edi,%edx
+  80208a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80208d:	e8 0d fe ff ff       	call   801e9f <_pipeisclosed>
+  802092:	83 c4 10             	add    $0x10,%esp
+  802095:	85 c0                	test   %eax,%eax
+  802097:	0f 85 d5 00 00 00    	jne    802172 <devpipe_write+0x147>
+	*sleeping = 1;
+  80209d:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  8020a4:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8020a9:	39 1f                	cmp    %ebx,(%edi)
+  8020ab:	75 a7                	jne    802054 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  8020ad:	83 ec 04             	sub    $0x4,%esp
+  8020b0:	56                   	push   %esi
+  8020b1:	53                   	push   %ebx
+  8020b2:	57                   	push   %edi
+  8020b3:	e8 94 f0 ff ff       	call   80114c <sys_futex_wait>
+  8020b8:	83 c4 10             	add    $0x10,%esp
+  8020bb:	eb 97                	jmp    802054 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8020bd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8020c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8020c3:	29 c1                	sub    %eax,%ecx
+  8020c5:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8020ca:	89 d8                	mov    %ebx,%eax
+  8020cc:	29 d0                	sub    %edx,%eax
+  8020ce:	39 c1                	cmp    %eax,%ecx
+  8020d0:	0f 46 c1             	cmovbe %ecx,%eax
+  8020d3:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  8020d5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8020da:	f7 e6                	mul    %esi
+  8020dc:	c1 ea 0b             	shr    $0xb,%edx
+  8020df:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8020e5:	29 c6                	sub    %eax,%esi
+  8020e7:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8020e9:	29 f3                	sub    %esi,%ebx
+  8020eb:	39 cb                	cmp    %ecx,%ebx
+  8020ed:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8020f0:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  8020f3:	8d 77 10             	lea    0x10(%edi),%esi
+  8020f6:	83 ec 04             	sub    $0x4,%esp
+  8020f9:	53                   	push   %ebx
+  8020fa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8020fd:	03 45 0c             	add    0xc(%ebp),%eax
+  802100:	50                   	push   %eax
+  802101:	01 f2                	add    %esi,%edx
+  802103:	52                   	push   %edx
+  802104:	e8 fd e7 ff ff       	call   800906 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802109:	83 c4 0c             	add    $0xc,%esp
+  80210c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80210f:	29 d8                	sub    %ebx,%eax
+  802111:	50                   	push   %eax
+  802112:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802115:	01 d3                	add    %edx,%ebx
+  802117:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80211a:	53                   	push   %ebx
+  80211b:	56                   	push   %esi
+  80211c:	e8 e5 e7 ff ff       	call   800906 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802121:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802124:	03 4f 04             	add    0x4(%edi),%ecx
+  802127:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80212c:	f7 e1                	mul    %ecx
+  80212e:	c1 ea 0c             	shr    $0xc,%edx
+  802131:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802137:	29 d1                	sub    %edx,%ecx
+  802139:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  80213c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802141:	83 c4 10             	add    $0x10,%esp
+  802144:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802148:	75 0b                	jne    802155 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  80214a:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  80214d:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802150:	e9 f3 fe ff ff       	jmp    802048 <devpipe_write+0x1d>
+		*sleeping = 0;
+  802155:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  80215c:	83 ec 08             	sub    $0x8,%esp
+  80215f:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802164:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802167:	50                   	push   %eax
+  802168:	e8 2f f0 ff ff       	call   80119c <sys_futex_wake>
+  80216d:	83 c4 10             	add    $0x10,%esp
+  802170:	eb d8                	jmp    80214a <devpipe_write+0x11f>
+				return 0;
+  802172:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802177:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80217a:	5b                   	pop    %ebx
+  80217b:	5e                   	pop    %esi
+  80217c:	5f                   	pop    %edi
+  80217d:	5d                   	pop    %ebp
+  80217e:	c3                   	ret
+
+0080217f <pipe>:
+{
+  80217f:	55                   	push   %ebp
+  802180:	89 e5                	mov    %esp,%ebp
+  802182:	56                   	push   %esi
+  802183:	53                   	push   %ebx
+  802184:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802187:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80218a:	50                   	push   %eax
+  80218b:	e8 27 f3 ff ff       	call   8014b7 <fd_alloc>
+  802190:	89 c3                	mov    %eax,%ebx
+  802192:	83 c4 10             	add    $0x10,%esp
+  802195:	85 c0                	test   %eax,%eax
+  802197:	0f 88 23 01 00 00    	js     8022c0 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80219d:	83 ec 04             	sub    $0x4,%esp
+  8021a0:	68 07 04 00 00       	push   $0x407
+  8021a5:	ff 75 f4             	push   -0xc(%ebp)
+  8021a8:	6a 00                	push   $0x0
+  8021aa:	e8 c4 ea ff ff       	call   800c73 <sys_page_alloc>
+  8021af:	89 c3                	mov    %eax,%ebx
+  8021b1:	83 c4 10             	add    $0x10,%esp
+  8021b4:	85 c0                	test   %eax,%eax
+  8021b6:	0f 88 04 01 00 00    	js     8022c0 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8021bc:	83 ec 0c             	sub    $0xc,%esp
+  8021bf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021c2:	50                   	push   %eax
+  8021c3:	e8 ef f2 ff ff       	call   8014b7 <fd_alloc>
+  8021c8:	89 c3                	mov    %eax,%ebx
+  8021ca:	83 c4 10             	add    $0x10,%esp
+  8021cd:	85 c0                	test   %eax,%eax
+  8021cf:	0f 88 db 00 00 00    	js     8022b0 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8021d5:	83 ec 04             	sub    $0x4,%esp
+  8021d8:	68 07 04 00 00       	push   $0x407
+  8021dd:	ff 75 f0             	push   -0x10(%ebp)
+  8021e0:	6a 00                	push   $0x0
+  8021e2:	e8 8c ea ff ff       	call   800c73 <sys_page_alloc>
+  8021e7:	89 c3                	mov    %eax,%ebx
+  8021e9:	83 c4 10             	add    $0x10,%esp
+  8021ec:	85 c0                	test   %eax,%eax
+  8021ee:	0f 88 bc 00 00 00    	js     8022b0 <pipe+0x131>
+	va = fd2data(fd0);
+  8021f4:	83 ec 0c             	sub    $0xc,%esp
+  8021f7:	ff 75 f4             	push   -0xc(%ebp)
+  8021fa:	e8 a1 f2 ff ff       	call   8014a0 <fd2data>
+  8021ff:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802201:	83 c4 0c             	add    $0xc,%esp
+  802204:	68 07 04 00 00       	push   $0x407
+  802209:	50                   	push   %eax
+  80220a:	6a 00                	push   $0x0
+  80220c:	e8 62 ea ff ff       	call   800c73 <sys_page_alloc>
+  802211:	89 c3                	mov    %eax,%ebx
+  802213:	83 c4 10             	add    $0x10,%esp
+  802216:	85 c0                	test   %eax,%eax
+  802218:	0f 88 82 00 00 00    	js     8022a0 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80221e:	83 ec 0c             	sub    $0xc,%esp
+  802221:	ff 75 f0             	push   -0x10(%ebp)
+  802224:	e8 77 f2 ff ff       	call   8014a0 <fd2data>
+  802229:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802230:	50                   	push   %eax
+  802231:	6a 00                	push   $0x0
+  802233:	56                   	push   %esi
+  802234:	6a 00                	push   $0x0
+  802236:	e8 7b ea ff ff       	call   800cb6 <sys_page_map>
+  80223b:	89 c3                	mov    %eax,%ebx
+  80223d:	83 c4 20             	add    $0x20,%esp
+  802240:	85 c0                	test   %eax,%eax
+  802242:	78 4e                	js     802292 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802244:	a1 20 30 80 00       	mov    0x803020,%eax
+  802249:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80224c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80224e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802251:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802258:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80225b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80225d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802260:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802267:	83 ec 0c             	sub    $0xc,%esp
+  80226a:	ff 75 f4             	push   -0xc(%ebp)
+  80226d:	e8 1e f2 ff ff       	call   801490 <fd2num>
+  802272:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802275:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802277:	83 c4 04             	add    $0x4,%esp
+  80227a:	ff 75 f0             	push   -0x10(%ebp)
+  80227d:	e8 0e f2 ff ff       	call   801490 <fd2num>
+  802282:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802285:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802288:	83 c4 10             	add    $0x10,%esp
+  80228b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802290:	eb 2e                	jmp    8022c0 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802292:	83 ec 08             	sub    $0x8,%esp
+  802295:	56                   	push   %esi
+  802296:	6a 00                	push   $0x0
+  802298:	e8 5b ea ff ff       	call   800cf8 <sys_page_unmap>
+  80229d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8022a0:	83 ec 08             	sub    $0x8,%esp
+  8022a3:	ff 75 f0             	push   -0x10(%ebp)
+  8022a6:	6a 00                	push   $0x0
+  8022a8:	e8 4b ea ff ff       	call   800cf8 <sys_page_unmap>
+  8022ad:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8022b0:	83 ec 08             	sub    $0x8,%esp
+  8022b3:	ff 75 f4             	push   -0xc(%ebp)
+  8022b6:	6a 00                	push   $0x0
+  8022b8:	e8 3b ea ff ff       	call   800cf8 <sys_page_unmap>
+  8022bd:	83 c4 10             	add    $0x10,%esp
+}
+  8022c0:	89 d8                	mov    %ebx,%eax
+  8022c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022c5:	5b                   	pop    %ebx
+  8022c6:	5e                   	pop    %esi
+  8022c7:	5d                   	pop    %ebp
+  8022c8:	c3                   	ret
+
+008022c9 <pipeisclosed>:
+{
+  8022c9:	55                   	push   %ebp
+  8022ca:	89 e5                	mov    %esp,%ebp
+  8022cc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022d2:	50                   	push   %eax
+  8022d3:	ff 75 08             	push   0x8(%ebp)
+  8022d6:	e8 30 f2 ff ff       	call   80150b <fd_lookup>
+  8022db:	83 c4 10             	add    $0x10,%esp
+  8022de:	85 c0                	test   %eax,%eax
+  8022e0:	78 18                	js     8022fa <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8022e2:	83 ec 0c             	sub    $0xc,%esp
+  8022e5:	ff 75 f4             	push   -0xc(%ebp)
+  8022e8:	e8 b3 f1 ff ff       	call   8014a0 <fd2data>
+  8022ed:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8022ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022f2:	e8 a8 fb ff ff       	call   801e9f <_pipeisclosed>
+  8022f7:	83 c4 10             	add    $0x10,%esp
+}
+  8022fa:	c9                   	leave
+  8022fb:	c3                   	ret
+
+008022fc <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8022fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802301:	c3                   	ret
+
+00802302 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802302:	55                   	push   %ebp
+  802303:	89 e5                	mov    %esp,%ebp
+  802305:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802308:	68 ce 2b 80 00       	push   $0x802bce
+  80230d:	ff 75 0c             	push   0xc(%ebp)
+  802310:	e8 6b e4 ff ff       	call   800780 <strcpy>
+	return 0;
+}
+  802315:	b8 00 00 00 00       	mov    $0x0,%eax
+  80231a:	c9                   	leave
+  80231b:	c3                   	ret
+
+0080231c <devcons_write>:
+{
+  80231c:	55                   	push   %ebp
+  80231d:	89 e5                	mov    %esp,%ebp
+  80231f:	57                   	push   %edi
+  802320:	56                   	push   %esi
+  802321:	53                   	push   %ebx
+  802322:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802328:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80232d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802333:	eb 2e                	jmp    802363 <devcons_write+0x47>
+		m = n - tot;
+  802335:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802338:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80233a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80233f:	39 c3                	cmp    %eax,%ebx
+  802341:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802344:	83 ec 04             	sub    $0x4,%esp
+  802347:	53                   	push   %ebx
+  802348:	89 f0                	mov    %esi,%eax
+  80234a:	03 45 0c             	add    0xc(%ebp),%eax
+  80234d:	50                   	push   %eax
+  80234e:	57                   	push   %edi
+  80234f:	e8 b2 e5 ff ff       	call   800906 <memmove>
+		sys_cputs(buf, m);
+  802354:	83 c4 08             	add    $0x8,%esp
+  802357:	53                   	push   %ebx
+  802358:	57                   	push   %edi
+  802359:	e8 48 e8 ff ff       	call   800ba6 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80235e:	01 de                	add    %ebx,%esi
+  802360:	83 c4 10             	add    $0x10,%esp
+  802363:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802366:	72 cd                	jb     802335 <devcons_write+0x19>
+}
+  802368:	89 f0                	mov    %esi,%eax
+  80236a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80236d:	5b                   	pop    %ebx
+  80236e:	5e                   	pop    %esi
+  80236f:	5f                   	pop    %edi
+  802370:	5d                   	pop    %ebp
+  802371:	c3                   	ret
+
+00802372 <devcons_read>:
+{
+  802372:	55                   	push   %ebp
+  802373:	89 e5                	mov    %esp,%ebp
+  802375:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802378:	b8 00 00 00 00       	mov    $0x0,%eax
+  80237d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802381:	75 07                	jne    80238a <devcons_read+0x18>
+  802383:	eb 1f                	jmp    8023a4 <devcons_read+0x32>
+		sys_yield();
+  802385:	e8 ca e8 ff ff       	call   800c54 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80238a:	e8 46 e8 ff ff       	call   800bd5 <sys_cgetc>
+  80238f:	85 c0                	test   %eax,%eax
+  802391:	74 f2                	je     802385 <devcons_read+0x13>
+	if (c < 0)
+  802393:	78 0f                	js     8023a4 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802395:	83 f8 04             	cmp    $0x4,%eax
+  802398:	74 0c                	je     8023a6 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80239a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80239d:	88 02                	mov    %al,(%edx)
+	return 1;
+  80239f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8023a4:	c9                   	leave
+  8023a5:	c3                   	ret
+		return 0;
+  8023a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ab:	eb f7                	jmp    8023a4 <devcons_read+0x32>
+
+008023ad <cputchar>:
+{
+  8023ad:	55                   	push   %ebp
+  8023ae:	89 e5                	mov    %esp,%ebp
+  8023b0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8023b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023b6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8023b9:	6a 01                	push   $0x1
+  8023bb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8023be:	50                   	push   %eax
+  8023bf:	e8 e2 e7 ff ff       	call   800ba6 <sys_cputs>
+}
+  8023c4:	83 c4 10             	add    $0x10,%esp
+  8023c7:	c9                   	leave
+  8023c8:	c3                   	ret
+
+008023c9 <getchar>:
+{
+  8023c9:	55                   	push   %ebp
+  8023ca:	89 e5                	mov    %esp,%ebp
+  8023cc:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8023cf:	6a 01                	push   $0x1
+  8023d1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8023d4:	50                   	push   %eax
+  8023d5:	6a 00                	push   $0x0
+  8023d7:	e8 8e f3 ff ff       	call   80176a <read>
+	if (r < 0)
+  8023dc:	83 c4 10             	add    $0x10,%esp
+  8023df:	85 c0                	test   %eax,%eax
+  8023e1:	78 06                	js     8023e9 <getchar+0x20>
+	if (r < 1)
+  8023e3:	74 06                	je     8023eb <getchar+0x22>
+	return c;
+  8023e5:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8023e9:	c9                   	leave
+  8023ea:	c3                   	ret
+		return -E_EOF;
+  8023eb:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8023f0:	eb f7                	jmp    8023e9 <getchar+0x20>
+
+008023f2 <iscons>:
+{
+  8023f2:	55                   	push   %ebp
+  8023f3:	89 e5                	mov    %esp,%ebp
+  8023f5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023fb:	50                   	push   %eax
+  8023fc:	ff 75 08             	push   0x8(%ebp)
+  8023ff:	e8 07 f1 ff ff       	call   80150b <fd_lookup>
+  802404:	83 c4 10             	add    $0x10,%esp
+  802407:	85 c0                	test   %eax,%eax
+  802409:	78 11                	js     80241c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80240b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80240e:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  802414:	39 10                	cmp    %edx,(%eax)
+  802416:	0f 94 c0             	sete   %al
+  802419:	0f b6 c0             	movzbl %al,%eax
+}
+  80241c:	c9                   	leave
+  80241d:	c3                   	ret
+
+0080241e <opencons>:
+{
+  80241e:	55                   	push   %ebp
+  80241f:	89 e5                	mov    %esp,%ebp
+  802421:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802424:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802427:	50                   	push   %eax
+  802428:	e8 8a f0 ff ff       	call   8014b7 <fd_alloc>
+  80242d:	83 c4 10             	add    $0x10,%esp
+  802430:	85 c0                	test   %eax,%eax
+  802432:	78 3a                	js     80246e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802434:	83 ec 04             	sub    $0x4,%esp
+  802437:	68 07 04 00 00       	push   $0x407
+  80243c:	ff 75 f4             	push   -0xc(%ebp)
+  80243f:	6a 00                	push   $0x0
+  802441:	e8 2d e8 ff ff       	call   800c73 <sys_page_alloc>
+  802446:	83 c4 10             	add    $0x10,%esp
+  802449:	85 c0                	test   %eax,%eax
+  80244b:	78 21                	js     80246e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80244d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802450:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  802456:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802458:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80245b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802462:	83 ec 0c             	sub    $0xc,%esp
+  802465:	50                   	push   %eax
+  802466:	e8 25 f0 ff ff       	call   801490 <fd2num>
+  80246b:	83 c4 10             	add    $0x10,%esp
+}
+  80246e:	c9                   	leave
+  80246f:	c3                   	ret
+
+00802470 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802470:	55                   	push   %ebp
+  802471:	89 e5                	mov    %esp,%ebp
+  802473:	56                   	push   %esi
+  802474:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802475:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802478:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80247e:	e8 b2 e7 ff ff       	call   800c35 <sys_getenvid>
+  802483:	83 ec 0c             	sub    $0xc,%esp
+  802486:	ff 75 0c             	push   0xc(%ebp)
+  802489:	ff 75 08             	push   0x8(%ebp)
+  80248c:	56                   	push   %esi
+  80248d:	50                   	push   %eax
+  80248e:	68 dc 2b 80 00       	push   $0x802bdc
+  802493:	e8 01 dd ff ff       	call   800199 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802498:	83 c4 18             	add    $0x18,%esp
+  80249b:	53                   	push   %ebx
+  80249c:	ff 75 10             	push   0x10(%ebp)
+  80249f:	e8 a4 dc ff ff       	call   800148 <vcprintf>
+	cprintf("\n");
+  8024a4:	c7 04 24 c7 2b 80 00 	movl   $0x802bc7,(%esp)
+  8024ab:	e8 e9 dc ff ff       	call   800199 <cprintf>
+  8024b0:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8024b3:	cc                   	int3
+	while (1)
+  8024b4:	eb fd                	jmp    8024b3 <_panic+0x43>
+
+008024b6 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8024b6:	55                   	push   %ebp
+  8024b7:	89 e5                	mov    %esp,%ebp
+  8024b9:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8024bc:	89 c2                	mov    %eax,%edx
+  8024be:	c1 ea 16             	shr    $0x16,%edx
+  8024c1:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8024c8:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8024cd:	f6 c1 01             	test   $0x1,%cl
+  8024d0:	74 1e                	je     8024f0 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  8024d2:	c1 e8 0c             	shr    $0xc,%eax
+  8024d5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8024dc:	a8 01                	test   $0x1,%al
+  8024de:	74 10                	je     8024f0 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8024e0:	c1 e8 0c             	shr    $0xc,%eax
+  8024e3:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8024e6:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  8024ed:	0f b7 d2             	movzwl %dx,%edx
+}
+  8024f0:	89 d0                	mov    %edx,%eax
+  8024f2:	5d                   	pop    %ebp
+  8024f3:	c3                   	ret
+
+008024f4 <udivmod>:
+  8024f4:	55                   	push   %ebp
+  8024f5:	57                   	push   %edi
+  8024f6:	56                   	push   %esi
+  8024f7:	53                   	push   %ebx
+  8024f8:	83 ec 24             	sub    $0x24,%esp
+  8024fb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8024ff:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802503:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802507:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80250b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80250f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802513:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802517:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80251c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802521:	ba 00 00 00 00       	mov    $0x0,%edx
+  802526:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80252d:	00 
+  80252e:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802535:	00 
+  802536:	89 fb                	mov    %edi,%ebx
+  802538:	eb 08                	jmp    802542 <udivmod+0x4e>
+  80253a:	83 e9 01             	sub    $0x1,%ecx
+  80253d:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802540:	74 68                	je     8025aa <udivmod+0xb6>
+  802542:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802546:	01 c0                	add    %eax,%eax
+  802548:	89 c6                	mov    %eax,%esi
+  80254a:	89 d7                	mov    %edx,%edi
+  80254c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802550:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802554:	0f ad d0             	shrd   %cl,%edx,%eax
+  802557:	d3 ea                	shr    %cl,%edx
+  802559:	f6 c1 20             	test   $0x20,%cl
+  80255c:	74 04                	je     802562 <udivmod+0x6e>
+  80255e:	89 d0                	mov    %edx,%eax
+  802560:	31 d2                	xor    %edx,%edx
+  802562:	83 e0 01             	and    $0x1,%eax
+  802565:	89 04 24             	mov    %eax,(%esp)
+  802568:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80256f:	00 
+  802570:	8b 04 24             	mov    (%esp),%eax
+  802573:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802577:	09 f0                	or     %esi,%eax
+  802579:	09 fa                	or     %edi,%edx
+  80257b:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80257f:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802583:	39 f0                	cmp    %esi,%eax
+  802585:	89 d5                	mov    %edx,%ebp
+  802587:	19 fd                	sbb    %edi,%ebp
+  802589:	72 af                	jb     80253a <udivmod+0x46>
+  80258b:	29 f0                	sub    %esi,%eax
+  80258d:	19 fa                	sbb    %edi,%edx
+  80258f:	89 cf                	mov    %ecx,%edi
+  802591:	c1 ef 05             	shr    $0x5,%edi
+  802594:	83 e7 01             	and    $0x1,%edi
+  802597:	89 fe                	mov    %edi,%esi
+  802599:	83 f6 01             	xor    $0x1,%esi
+  80259c:	d3 e6                	shl    %cl,%esi
+  80259e:	d3 e7                	shl    %cl,%edi
+  8025a0:	09 74 24 18          	or     %esi,0x18(%esp)
+  8025a4:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8025a8:	eb 90                	jmp    80253a <udivmod+0x46>
+  8025aa:	85 db                	test   %ebx,%ebx
+  8025ac:	74 05                	je     8025b3 <udivmod+0xbf>
+  8025ae:	89 03                	mov    %eax,(%ebx)
+  8025b0:	89 53 04             	mov    %edx,0x4(%ebx)
+  8025b3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025b7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025bb:	83 c4 24             	add    $0x24,%esp
+  8025be:	5b                   	pop    %ebx
+  8025bf:	5e                   	pop    %esi
+  8025c0:	5f                   	pop    %edi
+  8025c1:	5d                   	pop    %ebp
+  8025c2:	c3                   	ret
+
+008025c3 <__udivdi3>:
+  8025c3:	83 ec 08             	sub    $0x8,%esp
+  8025c6:	6a 00                	push   $0x0
+  8025c8:	ff 74 24 1c          	push   0x1c(%esp)
+  8025cc:	ff 74 24 1c          	push   0x1c(%esp)
+  8025d0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025d4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025d8:	e8 17 ff ff ff       	call   8024f4 <udivmod>
+  8025dd:	83 c4 14             	add    $0x14,%esp
+  8025e0:	c3                   	ret
+
+008025e1 <__umoddi3>:
+  8025e1:	83 ec 18             	sub    $0x18,%esp
+  8025e4:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8025e8:	50                   	push   %eax
+  8025e9:	ff 74 24 2c          	push   0x2c(%esp)
+  8025ed:	ff 74 24 2c          	push   0x2c(%esp)
+  8025f1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025f5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025f9:	e8 f6 fe ff ff       	call   8024f4 <udivmod>
+  8025fe:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802602:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802606:	83 c4 24             	add    $0x24,%esp
+  802609:	c3                   	ret
+
+0080260a <__divdi3>:
+  80260a:	55                   	push   %ebp
+  80260b:	57                   	push   %edi
+  80260c:	56                   	push   %esi
+  80260d:	53                   	push   %ebx
+  80260e:	83 ec 10             	sub    $0x10,%esp
+  802611:	8b 44 24 24          	mov    0x24(%esp),%eax
+  802615:	8b 54 24 28          	mov    0x28(%esp),%edx
+  802619:	89 c6                	mov    %eax,%esi
+  80261b:	89 d7                	mov    %edx,%edi
+  80261d:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  802621:	33 7c 24 30          	xor    0x30(%esp),%edi
+  802625:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802629:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  80262d:	89 c5                	mov    %eax,%ebp
+  80262f:	f7 dd                	neg    %ebp
+  802631:	89 d6                	mov    %edx,%esi
+  802633:	83 d6 00             	adc    $0x0,%esi
+  802636:	f7 de                	neg    %esi
+  802638:	0f 48 e8             	cmovs  %eax,%ebp
+  80263b:	0f 49 d6             	cmovns %esi,%edx
+  80263e:	6a 00                	push   $0x0
+  802640:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802644:	f7 de                	neg    %esi
+  802646:	8b 44 24 34          	mov    0x34(%esp),%eax
+  80264a:	83 d0 00             	adc    $0x0,%eax
+  80264d:	f7 d8                	neg    %eax
+  80264f:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  802654:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  802659:	50                   	push   %eax
+  80265a:	56                   	push   %esi
+  80265b:	89 e8                	mov    %ebp,%eax
+  80265d:	e8 92 fe ff ff       	call   8024f4 <udivmod>
+  802662:	83 c4 10             	add    $0x10,%esp
+  802665:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  80266a:	78 08                	js     802674 <__divdi3+0x6a>
+  80266c:	83 c4 0c             	add    $0xc,%esp
+  80266f:	5b                   	pop    %ebx
+  802670:	5e                   	pop    %esi
+  802671:	5f                   	pop    %edi
+  802672:	5d                   	pop    %ebp
+  802673:	c3                   	ret
+  802674:	f7 d8                	neg    %eax
+  802676:	83 d2 00             	adc    $0x0,%edx
+  802679:	f7 da                	neg    %edx
+  80267b:	eb ef                	jmp    80266c <__divdi3+0x62>
+
+0080267d <__moddi3>:
+  80267d:	55                   	push   %ebp
+  80267e:	57                   	push   %edi
+  80267f:	56                   	push   %esi
+  802680:	53                   	push   %ebx
+  802681:	83 ec 18             	sub    $0x18,%esp
+  802684:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802688:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80268c:	89 f1                	mov    %esi,%ecx
+  80268e:	f7 d9                	neg    %ecx
+  802690:	89 da                	mov    %ebx,%edx
+  802692:	83 d2 00             	adc    $0x0,%edx
+  802695:	f7 da                	neg    %edx
+  802697:	0f 48 ce             	cmovs  %esi,%ecx
+  80269a:	0f 48 d3             	cmovs  %ebx,%edx
+  80269d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8026a1:	50                   	push   %eax
+  8026a2:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8026a6:	f7 de                	neg    %esi
+  8026a8:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8026ac:	83 d0 00             	adc    $0x0,%eax
+  8026af:	f7 d8                	neg    %eax
+  8026b1:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8026b6:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8026bb:	50                   	push   %eax
+  8026bc:	56                   	push   %esi
+  8026bd:	89 c8                	mov    %ecx,%eax
+  8026bf:	e8 30 fe ff ff       	call   8024f4 <udivmod>
+  8026c4:	83 c4 10             	add    $0x10,%esp
+  8026c7:	85 db                	test   %ebx,%ebx
+  8026c9:	78 10                	js     8026db <__moddi3+0x5e>
+  8026cb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026cf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026d3:	83 c4 14             	add    $0x14,%esp
+  8026d6:	5b                   	pop    %ebx
+  8026d7:	5e                   	pop    %esi
+  8026d8:	5f                   	pop    %edi
+  8026d9:	5d                   	pop    %ebp
+  8026da:	c3                   	ret
+  8026db:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026df:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026e3:	f7 d8                	neg    %eax
+  8026e5:	83 d2 00             	adc    $0x0,%edx
+  8026e8:	f7 da                	neg    %edx
+  8026ea:	eb e7                	jmp    8026d3 <__moddi3+0x56>
@@ -0,0 +1,9913 @@
+
+obj/user/faultalloc.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9a 00 00 00       	call   8000cb <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+int
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+
+	cprintf("fault %x\n", addr);
+  80003f:	53                   	push   %ebx
+  800040:	68 00 4d 80 00       	push   $0x804d00
+  800045:	e8 bf 01 00 00       	call   800209 <cprintf>
+	if ((r = page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004a:	6a 01                	push   $0x1
+  80004c:	6a 07                	push   $0x7
+  80004e:	89 d8                	mov    %ebx,%eax
+  800050:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800055:	50                   	push   %eax
+  800056:	6a 00                	push   $0x0
+  800058:	e8 a2 35 00 00       	call   8035ff <page_alloc>
+  80005d:	83 c4 20             	add    $0x20,%esp
+  800060:	85 c0                	test   %eax,%eax
+  800062:	78 18                	js     80007c <handler+0x49>
+				PTE_P|PTE_U|PTE_W, 1)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800064:	53                   	push   %ebx
+  800065:	68 4c 4d 80 00       	push   $0x804d4c
+  80006a:	6a 64                	push   $0x64
+  80006c:	53                   	push   %ebx
+  80006d:	e8 29 07 00 00       	call   80079b <snprintf>
+	return 1;
+}
+  800072:	b8 01 00 00 00       	mov    $0x1,%eax
+  800077:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80007a:	c9                   	leave
+  80007b:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  80007c:	83 ec 0c             	sub    $0xc,%esp
+  80007f:	50                   	push   %eax
+  800080:	53                   	push   %ebx
+  800081:	68 20 4d 80 00       	push   $0x804d20
+  800086:	6a 0e                	push   $0xe
+  800088:	68 0a 4d 80 00       	push   $0x804d0a
+  80008d:	e8 9c 00 00 00       	call   80012e <_panic>
+
+00800092 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800092:	55                   	push   %ebp
+  800093:	89 e5                	mov    %esp,%ebp
+  800095:	83 ec 14             	sub    $0x14,%esp
+	add_pgfault_handler(handler);
+  800098:	68 33 00 80 00       	push   $0x800033
+  80009d:	e8 6e 12 00 00       	call   801310 <add_pgfault_handler>
+	cprintf("%s\n", (char*)0xDeadBeef);
+  8000a2:	83 c4 08             	add    $0x8,%esp
+  8000a5:	68 ef be ad de       	push   $0xdeadbeef
+  8000aa:	68 1c 4d 80 00       	push   $0x804d1c
+  8000af:	e8 55 01 00 00       	call   800209 <cprintf>
+	cprintf("%s\n", (char*)0xCafeBffe);
+  8000b4:	83 c4 08             	add    $0x8,%esp
+  8000b7:	68 fe bf fe ca       	push   $0xcafebffe
+  8000bc:	68 1c 4d 80 00       	push   $0x804d1c
+  8000c1:	e8 43 01 00 00       	call   800209 <cprintf>
+}
+  8000c6:	83 c4 10             	add    $0x10,%esp
+  8000c9:	c9                   	leave
+  8000ca:	c3                   	ret
+
+008000cb <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000cb:	55                   	push   %ebp
+  8000cc:	89 e5                	mov    %esp,%ebp
+  8000ce:	56                   	push   %esi
+  8000cf:	53                   	push   %ebx
+  8000d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000d3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8000d6:	e8 ca 0b 00 00       	call   800ca5 <sys_getenvid>
+  8000db:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000e0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8000e3:	c1 e0 06             	shl    $0x6,%eax
+  8000e6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000eb:	a3 14 e9 80 00       	mov    %eax,0x80e914
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000f0:	85 db                	test   %ebx,%ebx
+  8000f2:	7e 07                	jle    8000fb <libmain+0x30>
+		binaryname = argv[0];
+  8000f4:	8b 06                	mov    (%esi),%eax
+  8000f6:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  8000fb:	83 ec 08             	sub    $0x8,%esp
+  8000fe:	56                   	push   %esi
+  8000ff:	53                   	push   %ebx
+  800100:	e8 8d ff ff ff       	call   800092 <umain>
+
+	// exit gracefully
+	exit();
+  800105:	e8 0a 00 00 00       	call   800114 <exit>
+}
+  80010a:	83 c4 10             	add    $0x10,%esp
+  80010d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800110:	5b                   	pop    %ebx
+  800111:	5e                   	pop    %esi
+  800112:	5d                   	pop    %ebp
+  800113:	c3                   	ret
+
+00800114 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800114:	55                   	push   %ebp
+  800115:	89 e5                	mov    %esp,%ebp
+  800117:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80011a:	e8 44 14 00 00       	call   801563 <close_all>
+	sys_env_destroy(0);
+  80011f:	83 ec 0c             	sub    $0xc,%esp
+  800122:	6a 00                	push   $0x0
+  800124:	e8 3b 0b 00 00       	call   800c64 <sys_env_destroy>
+}
+  800129:	83 c4 10             	add    $0x10,%esp
+  80012c:	c9                   	leave
+  80012d:	c3                   	ret
+
+0080012e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80012e:	55                   	push   %ebp
+  80012f:	89 e5                	mov    %esp,%ebp
+  800131:	56                   	push   %esi
+  800132:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800133:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800136:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80013c:	e8 64 0b 00 00       	call   800ca5 <sys_getenvid>
+  800141:	83 ec 0c             	sub    $0xc,%esp
+  800144:	ff 75 0c             	push   0xc(%ebp)
+  800147:	ff 75 08             	push   0x8(%ebp)
+  80014a:	56                   	push   %esi
+  80014b:	50                   	push   %eax
+  80014c:	68 78 4d 80 00       	push   $0x804d78
+  800151:	e8 b3 00 00 00       	call   800209 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800156:	83 c4 18             	add    $0x18,%esp
+  800159:	53                   	push   %ebx
+  80015a:	ff 75 10             	push   0x10(%ebp)
+  80015d:	e8 56 00 00 00       	call   8001b8 <vcprintf>
+	cprintf("\n");
+  800162:	c7 04 24 7d 52 80 00 	movl   $0x80527d,(%esp)
+  800169:	e8 9b 00 00 00       	call   800209 <cprintf>
+  80016e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800171:	cc                   	int3
+	while (1)
+  800172:	eb fd                	jmp    800171 <_panic+0x43>
+
+00800174 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800174:	55                   	push   %ebp
+  800175:	89 e5                	mov    %esp,%ebp
+  800177:	53                   	push   %ebx
+  800178:	83 ec 04             	sub    $0x4,%esp
+  80017b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80017e:	8b 13                	mov    (%ebx),%edx
+  800180:	8d 42 01             	lea    0x1(%edx),%eax
+  800183:	89 03                	mov    %eax,(%ebx)
+  800185:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800188:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80018c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800191:	74 09                	je     80019c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800193:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800197:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80019a:	c9                   	leave
+  80019b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80019c:	83 ec 08             	sub    $0x8,%esp
+  80019f:	68 ff 00 00 00       	push   $0xff
+  8001a4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001a7:	50                   	push   %eax
+  8001a8:	e8 69 0a 00 00       	call   800c16 <sys_cputs>
+		b->idx = 0;
+  8001ad:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001b3:	83 c4 10             	add    $0x10,%esp
+  8001b6:	eb db                	jmp    800193 <putch+0x1f>
+
+008001b8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001b8:	55                   	push   %ebp
+  8001b9:	89 e5                	mov    %esp,%ebp
+  8001bb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001c1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001c8:	00 00 00 
+	b.cnt = 0;
+  8001cb:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001d2:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001d5:	ff 75 0c             	push   0xc(%ebp)
+  8001d8:	ff 75 08             	push   0x8(%ebp)
+  8001db:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001e1:	50                   	push   %eax
+  8001e2:	68 74 01 80 00       	push   $0x800174
+  8001e7:	e8 14 01 00 00       	call   800300 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001ec:	83 c4 08             	add    $0x8,%esp
+  8001ef:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001f5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001fb:	50                   	push   %eax
+  8001fc:	e8 15 0a 00 00       	call   800c16 <sys_cputs>
+
+	return b.cnt;
+}
+  800201:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+00800209 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80020f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800212:	50                   	push   %eax
+  800213:	ff 75 08             	push   0x8(%ebp)
+  800216:	e8 9d ff ff ff       	call   8001b8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80021b:	c9                   	leave
+  80021c:	c3                   	ret
+
+0080021d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80021d:	55                   	push   %ebp
+  80021e:	89 e5                	mov    %esp,%ebp
+  800220:	57                   	push   %edi
+  800221:	56                   	push   %esi
+  800222:	53                   	push   %ebx
+  800223:	83 ec 1c             	sub    $0x1c,%esp
+  800226:	89 c7                	mov    %eax,%edi
+  800228:	89 d6                	mov    %edx,%esi
+  80022a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80022d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800230:	89 d1                	mov    %edx,%ecx
+  800232:	89 c2                	mov    %eax,%edx
+  800234:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800237:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80023a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80023d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800240:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800243:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80024a:	39 c2                	cmp    %eax,%edx
+  80024c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80024f:	72 3e                	jb     80028f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800251:	83 ec 0c             	sub    $0xc,%esp
+  800254:	ff 75 18             	push   0x18(%ebp)
+  800257:	83 eb 01             	sub    $0x1,%ebx
+  80025a:	53                   	push   %ebx
+  80025b:	50                   	push   %eax
+  80025c:	83 ec 08             	sub    $0x8,%esp
+  80025f:	ff 75 e4             	push   -0x1c(%ebp)
+  800262:	ff 75 e0             	push   -0x20(%ebp)
+  800265:	ff 75 dc             	push   -0x24(%ebp)
+  800268:	ff 75 d8             	push   -0x28(%ebp)
+  80026b:	e8 4e 49 00 00       	call   804bbe <__udivdi3>
+  800270:	83 c4 18             	add    $0x18,%esp
+  800273:	52                   	push   %edx
+  800274:	50                   	push   %eax
+  800275:	89 f2                	mov    %esi,%edx
+  800277:	89 f8                	mov    %edi,%eax
+  800279:	e8 9f ff ff ff       	call   80021d <printnum>
+  80027e:	83 c4 20             	add    $0x20,%esp
+  800281:	eb 13                	jmp    800296 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800283:	83 ec 08             	sub    $0x8,%esp
+  800286:	56                   	push   %esi
+  800287:	ff 75 18             	push   0x18(%ebp)
+  80028a:	ff d7                	call   *%edi
+  80028c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80028f:	83 eb 01             	sub    $0x1,%ebx
+  800292:	85 db                	test   %ebx,%ebx
+  800294:	7f ed                	jg     800283 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800296:	83 ec 08             	sub    $0x8,%esp
+  800299:	56                   	push   %esi
+  80029a:	83 ec 04             	sub    $0x4,%esp
+  80029d:	ff 75 e4             	push   -0x1c(%ebp)
+  8002a0:	ff 75 e0             	push   -0x20(%ebp)
+  8002a3:	ff 75 dc             	push   -0x24(%ebp)
+  8002a6:	ff 75 d8             	push   -0x28(%ebp)
+  8002a9:	e8 2e 49 00 00       	call   804bdc <__umoddi3>
+  8002ae:	83 c4 14             	add    $0x14,%esp
+  8002b1:	0f be 80 9b 4d 80 00 	movsbl 0x804d9b(%eax),%eax
+  8002b8:	50                   	push   %eax
+  8002b9:	ff d7                	call   *%edi
+}
+  8002bb:	83 c4 10             	add    $0x10,%esp
+  8002be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c1:	5b                   	pop    %ebx
+  8002c2:	5e                   	pop    %esi
+  8002c3:	5f                   	pop    %edi
+  8002c4:	5d                   	pop    %ebp
+  8002c5:	c3                   	ret
+
+008002c6 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002c6:	55                   	push   %ebp
+  8002c7:	89 e5                	mov    %esp,%ebp
+  8002c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002cc:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002d0:	8b 10                	mov    (%eax),%edx
+  8002d2:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002d5:	73 0a                	jae    8002e1 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002d7:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002da:	89 08                	mov    %ecx,(%eax)
+  8002dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002df:	88 02                	mov    %al,(%edx)
+}
+  8002e1:	5d                   	pop    %ebp
+  8002e2:	c3                   	ret
+
+008002e3 <printfmt>:
+{
+  8002e3:	55                   	push   %ebp
+  8002e4:	89 e5                	mov    %esp,%ebp
+  8002e6:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002e9:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002ec:	50                   	push   %eax
+  8002ed:	ff 75 10             	push   0x10(%ebp)
+  8002f0:	ff 75 0c             	push   0xc(%ebp)
+  8002f3:	ff 75 08             	push   0x8(%ebp)
+  8002f6:	e8 05 00 00 00       	call   800300 <vprintfmt>
+}
+  8002fb:	83 c4 10             	add    $0x10,%esp
+  8002fe:	c9                   	leave
+  8002ff:	c3                   	ret
+
+00800300 <vprintfmt>:
+{
+  800300:	55                   	push   %ebp
+  800301:	89 e5                	mov    %esp,%ebp
+  800303:	57                   	push   %edi
+  800304:	56                   	push   %esi
+  800305:	53                   	push   %ebx
+  800306:	83 ec 2c             	sub    $0x2c,%esp
+  800309:	8b 75 08             	mov    0x8(%ebp),%esi
+  80030c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80030f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800312:	eb 0a                	jmp    80031e <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800314:	83 ec 08             	sub    $0x8,%esp
+  800317:	53                   	push   %ebx
+  800318:	50                   	push   %eax
+  800319:	ff d6                	call   *%esi
+  80031b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80031e:	83 c7 01             	add    $0x1,%edi
+  800321:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800325:	83 f8 25             	cmp    $0x25,%eax
+  800328:	74 0c                	je     800336 <vprintfmt+0x36>
+			if (ch == '\0')
+  80032a:	85 c0                	test   %eax,%eax
+  80032c:	75 e6                	jne    800314 <vprintfmt+0x14>
+}
+  80032e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800331:	5b                   	pop    %ebx
+  800332:	5e                   	pop    %esi
+  800333:	5f                   	pop    %edi
+  800334:	5d                   	pop    %ebp
+  800335:	c3                   	ret
+		padc = ' ';
+  800336:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80033a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800341:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800348:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80034f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800354:	8d 47 01             	lea    0x1(%edi),%eax
+  800357:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80035a:	0f b6 17             	movzbl (%edi),%edx
+  80035d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800360:	3c 55                	cmp    $0x55,%al
+  800362:	0f 87 c5 03 00 00    	ja     80072d <vprintfmt+0x42d>
+  800368:	0f b6 c0             	movzbl %al,%eax
+  80036b:	ff 24 85 20 4f 80 00 	jmp    *0x804f20(,%eax,4)
+  800372:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800375:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800379:	eb d9                	jmp    800354 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80037b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80037e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800382:	eb d0                	jmp    800354 <vprintfmt+0x54>
+  800384:	0f b6 d2             	movzbl %dl,%edx
+  800387:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80038a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800392:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800395:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800399:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80039c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80039f:	83 f9 09             	cmp    $0x9,%ecx
+  8003a2:	77 55                	ja     8003f9 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003a4:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003a7:	eb e9                	jmp    800392 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ac:	8b 00                	mov    (%eax),%eax
+  8003ae:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8003b7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ba:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003bd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003c1:	79 91                	jns    800354 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003c3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003c9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003d0:	eb 82                	jmp    800354 <vprintfmt+0x54>
+			if (width < 0)
+  8003d2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003d5:	85 d2                	test   %edx,%edx
+  8003d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003dc:	0f 49 c2             	cmovns %edx,%eax
+  8003df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003e5:	e9 6a ff ff ff       	jmp    800354 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003ed:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003f4:	e9 5b ff ff ff       	jmp    800354 <vprintfmt+0x54>
+  8003f9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003fc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ff:	eb bc                	jmp    8003bd <vprintfmt+0xbd>
+			lflag++;
+  800401:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800404:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800407:	e9 48 ff ff ff       	jmp    800354 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80040c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040f:	8d 78 04             	lea    0x4(%eax),%edi
+  800412:	83 ec 08             	sub    $0x8,%esp
+  800415:	53                   	push   %ebx
+  800416:	ff 30                	push   (%eax)
+  800418:	ff d6                	call   *%esi
+			break;
+  80041a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80041d:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800420:	e9 63 02 00 00       	jmp    800688 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800425:	8b 45 14             	mov    0x14(%ebp),%eax
+  800428:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80042b:	8b 10                	mov    (%eax),%edx
+  80042d:	89 d0                	mov    %edx,%eax
+  80042f:	f7 d8                	neg    %eax
+  800431:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800434:	83 f8 12             	cmp    $0x12,%eax
+  800437:	7f 23                	jg     80045c <vprintfmt+0x15c>
+  800439:	8b 14 85 80 50 80 00 	mov    0x805080(,%eax,4),%edx
+  800440:	85 d2                	test   %edx,%edx
+  800442:	74 18                	je     80045c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800444:	52                   	push   %edx
+  800445:	68 09 52 80 00       	push   $0x805209
+  80044a:	53                   	push   %ebx
+  80044b:	56                   	push   %esi
+  80044c:	e8 92 fe ff ff       	call   8002e3 <printfmt>
+  800451:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800454:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800457:	e9 2c 02 00 00       	jmp    800688 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80045c:	50                   	push   %eax
+  80045d:	68 b3 4d 80 00       	push   $0x804db3
+  800462:	53                   	push   %ebx
+  800463:	56                   	push   %esi
+  800464:	e8 7a fe ff ff       	call   8002e3 <printfmt>
+  800469:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80046c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80046f:	e9 14 02 00 00       	jmp    800688 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800474:	8b 45 14             	mov    0x14(%ebp),%eax
+  800477:	83 c0 04             	add    $0x4,%eax
+  80047a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80047d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800480:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800482:	85 c9                	test   %ecx,%ecx
+  800484:	b8 ac 4d 80 00       	mov    $0x804dac,%eax
+  800489:	0f 45 c1             	cmovne %ecx,%eax
+  80048c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80048f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800493:	7e 06                	jle    80049b <vprintfmt+0x19b>
+  800495:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800499:	75 0b                	jne    8004a6 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80049b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80049e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004a1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004a4:	eb 5c                	jmp    800502 <vprintfmt+0x202>
+  8004a6:	83 ec 08             	sub    $0x8,%esp
+  8004a9:	ff 75 d0             	push   -0x30(%ebp)
+  8004ac:	ff 75 cc             	push   -0x34(%ebp)
+  8004af:	e8 19 03 00 00       	call   8007cd <strnlen>
+  8004b4:	89 c2                	mov    %eax,%edx
+  8004b6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004b9:	29 d0                	sub    %edx,%eax
+  8004bb:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004be:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004c8:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ca:	eb 0e                	jmp    8004da <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004cc:	83 ec 08             	sub    $0x8,%esp
+  8004cf:	53                   	push   %ebx
+  8004d0:	57                   	push   %edi
+  8004d1:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d4:	83 ee 01             	sub    $0x1,%esi
+  8004d7:	83 c4 10             	add    $0x10,%esp
+  8004da:	85 f6                	test   %esi,%esi
+  8004dc:	7f ee                	jg     8004cc <vprintfmt+0x1cc>
+  8004de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e4:	85 c0                	test   %eax,%eax
+  8004e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004eb:	0f 49 d0             	cmovns %eax,%edx
+  8004ee:	29 d0                	sub    %edx,%eax
+  8004f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f3:	eb a6                	jmp    80049b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004f5:	83 ec 08             	sub    $0x8,%esp
+  8004f8:	53                   	push   %ebx
+  8004f9:	52                   	push   %edx
+  8004fa:	ff 55 08             	call   *0x8(%ebp)
+  8004fd:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800500:	89 f1                	mov    %esi,%ecx
+  800502:	8d 71 01             	lea    0x1(%ecx),%esi
+  800505:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800509:	0f be d0             	movsbl %al,%edx
+  80050c:	85 d2                	test   %edx,%edx
+  80050e:	74 28                	je     800538 <vprintfmt+0x238>
+  800510:	85 ff                	test   %edi,%edi
+  800512:	78 05                	js     800519 <vprintfmt+0x219>
+  800514:	83 ef 01             	sub    $0x1,%edi
+  800517:	78 30                	js     800549 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800519:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80051d:	74 d6                	je     8004f5 <vprintfmt+0x1f5>
+  80051f:	0f be c0             	movsbl %al,%eax
+  800522:	83 e8 20             	sub    $0x20,%eax
+  800525:	83 f8 5e             	cmp    $0x5e,%eax
+  800528:	76 cb                	jbe    8004f5 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80052a:	83 ec 08             	sub    $0x8,%esp
+  80052d:	53                   	push   %ebx
+  80052e:	6a 3f                	push   $0x3f
+  800530:	ff 55 08             	call   *0x8(%ebp)
+  800533:	83 c4 10             	add    $0x10,%esp
+  800536:	eb c8                	jmp    800500 <vprintfmt+0x200>
+  800538:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80053e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800541:	01 d0                	add    %edx,%eax
+  800543:	29 c8                	sub    %ecx,%eax
+  800545:	89 c7                	mov    %eax,%edi
+  800547:	eb 13                	jmp    80055c <vprintfmt+0x25c>
+  800549:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054c:	eb ed                	jmp    80053b <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80054e:	83 ec 08             	sub    $0x8,%esp
+  800551:	53                   	push   %ebx
+  800552:	6a 20                	push   $0x20
+  800554:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800556:	83 ef 01             	sub    $0x1,%edi
+  800559:	83 c4 10             	add    $0x10,%esp
+  80055c:	85 ff                	test   %edi,%edi
+  80055e:	7f ee                	jg     80054e <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800560:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800563:	89 45 14             	mov    %eax,0x14(%ebp)
+  800566:	e9 1d 01 00 00       	jmp    800688 <vprintfmt+0x388>
+	if (lflag >= 2)
+  80056b:	83 f9 01             	cmp    $0x1,%ecx
+  80056e:	7f 1b                	jg     80058b <vprintfmt+0x28b>
+	else if (lflag)
+  800570:	85 c9                	test   %ecx,%ecx
+  800572:	74 63                	je     8005d7 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800574:	8b 45 14             	mov    0x14(%ebp),%eax
+  800577:	8b 00                	mov    (%eax),%eax
+  800579:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80057c:	99                   	cltd
+  80057d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800580:	8b 45 14             	mov    0x14(%ebp),%eax
+  800583:	8d 40 04             	lea    0x4(%eax),%eax
+  800586:	89 45 14             	mov    %eax,0x14(%ebp)
+  800589:	eb 17                	jmp    8005a2 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80058b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058e:	8b 50 04             	mov    0x4(%eax),%edx
+  800591:	8b 00                	mov    (%eax),%eax
+  800593:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800596:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800599:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059c:	8d 40 08             	lea    0x8(%eax),%eax
+  80059f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005a2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005a5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005a8:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005ad:	85 c9                	test   %ecx,%ecx
+  8005af:	0f 89 b9 00 00 00    	jns    80066e <vprintfmt+0x36e>
+				putch('-', putdat);
+  8005b5:	83 ec 08             	sub    $0x8,%esp
+  8005b8:	53                   	push   %ebx
+  8005b9:	6a 2d                	push   $0x2d
+  8005bb:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005bd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005c3:	f7 da                	neg    %edx
+  8005c5:	83 d1 00             	adc    $0x0,%ecx
+  8005c8:	f7 d9                	neg    %ecx
+  8005ca:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005cd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005d2:	e9 97 00 00 00       	jmp    80066e <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8005d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005da:	8b 00                	mov    (%eax),%eax
+  8005dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005df:	99                   	cltd
+  8005e0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ec:	eb b4                	jmp    8005a2 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8005ee:	83 f9 01             	cmp    $0x1,%ecx
+  8005f1:	7f 1b                	jg     80060e <vprintfmt+0x30e>
+	else if (lflag)
+  8005f3:	85 c9                	test   %ecx,%ecx
+  8005f5:	74 2c                	je     800623 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8005f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fa:	8b 10                	mov    (%eax),%edx
+  8005fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800601:	8d 40 04             	lea    0x4(%eax),%eax
+  800604:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800607:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80060c:	eb 60                	jmp    80066e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80060e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800611:	8b 10                	mov    (%eax),%edx
+  800613:	8b 48 04             	mov    0x4(%eax),%ecx
+  800616:	8d 40 08             	lea    0x8(%eax),%eax
+  800619:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80061c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800621:	eb 4b                	jmp    80066e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800623:	8b 45 14             	mov    0x14(%ebp),%eax
+  800626:	8b 10                	mov    (%eax),%edx
+  800628:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062d:	8d 40 04             	lea    0x4(%eax),%eax
+  800630:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800633:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800638:	eb 34                	jmp    80066e <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80063a:	83 f9 01             	cmp    $0x1,%ecx
+  80063d:	7f 15                	jg     800654 <vprintfmt+0x354>
+	else if (lflag)
+  80063f:	85 c9                	test   %ecx,%ecx
+  800641:	74 4d                	je     800690 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800643:	8b 45 14             	mov    0x14(%ebp),%eax
+  800646:	8b 00                	mov    (%eax),%eax
+  800648:	99                   	cltd
+  800649:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80064c:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80064f:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800652:	eb 11                	jmp    800665 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800654:	8b 45 14             	mov    0x14(%ebp),%eax
+  800657:	8b 50 04             	mov    0x4(%eax),%edx
+  80065a:	8b 00                	mov    (%eax),%eax
+  80065c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80065f:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800662:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800665:	89 d1                	mov    %edx,%ecx
+  800667:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800669:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80066e:	83 ec 0c             	sub    $0xc,%esp
+  800671:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800675:	50                   	push   %eax
+  800676:	ff 75 e0             	push   -0x20(%ebp)
+  800679:	57                   	push   %edi
+  80067a:	51                   	push   %ecx
+  80067b:	52                   	push   %edx
+  80067c:	89 da                	mov    %ebx,%edx
+  80067e:	89 f0                	mov    %esi,%eax
+  800680:	e8 98 fb ff ff       	call   80021d <printnum>
+			break;
+  800685:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800688:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80068b:	e9 8e fc ff ff       	jmp    80031e <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800690:	8b 45 14             	mov    0x14(%ebp),%eax
+  800693:	8b 00                	mov    (%eax),%eax
+  800695:	99                   	cltd
+  800696:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800699:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80069c:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80069f:	eb c4                	jmp    800665 <vprintfmt+0x365>
+			putch('0', putdat);
+  8006a1:	83 ec 08             	sub    $0x8,%esp
+  8006a4:	53                   	push   %ebx
+  8006a5:	6a 30                	push   $0x30
+  8006a7:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006a9:	83 c4 08             	add    $0x8,%esp
+  8006ac:	53                   	push   %ebx
+  8006ad:	6a 78                	push   $0x78
+  8006af:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b4:	8b 10                	mov    (%eax),%edx
+  8006b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006bb:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006be:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c4:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8006c9:	eb a3                	jmp    80066e <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8006cb:	83 f9 01             	cmp    $0x1,%ecx
+  8006ce:	7f 1b                	jg     8006eb <vprintfmt+0x3eb>
+	else if (lflag)
+  8006d0:	85 c9                	test   %ecx,%ecx
+  8006d2:	74 2f                	je     800703 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8006d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d7:	8b 10                	mov    (%eax),%edx
+  8006d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006de:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006e9:	eb 83                	jmp    80066e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8006eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ee:	8b 10                	mov    (%eax),%edx
+  8006f0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f3:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006fe:	e9 6b ff ff ff       	jmp    80066e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800703:	8b 45 14             	mov    0x14(%ebp),%eax
+  800706:	8b 10                	mov    (%eax),%edx
+  800708:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070d:	8d 40 04             	lea    0x4(%eax),%eax
+  800710:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800713:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800718:	e9 51 ff ff ff       	jmp    80066e <vprintfmt+0x36e>
+			putch(ch, putdat);
+  80071d:	83 ec 08             	sub    $0x8,%esp
+  800720:	53                   	push   %ebx
+  800721:	6a 25                	push   $0x25
+  800723:	ff d6                	call   *%esi
+			break;
+  800725:	83 c4 10             	add    $0x10,%esp
+  800728:	e9 5b ff ff ff       	jmp    800688 <vprintfmt+0x388>
+			putch('%', putdat);
+  80072d:	83 ec 08             	sub    $0x8,%esp
+  800730:	53                   	push   %ebx
+  800731:	6a 25                	push   $0x25
+  800733:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800735:	83 c4 10             	add    $0x10,%esp
+  800738:	89 f8                	mov    %edi,%eax
+  80073a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80073e:	74 05                	je     800745 <vprintfmt+0x445>
+  800740:	83 e8 01             	sub    $0x1,%eax
+  800743:	eb f5                	jmp    80073a <vprintfmt+0x43a>
+  800745:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800748:	e9 3b ff ff ff       	jmp    800688 <vprintfmt+0x388>
+
+0080074d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80074d:	55                   	push   %ebp
+  80074e:	89 e5                	mov    %esp,%ebp
+  800750:	83 ec 18             	sub    $0x18,%esp
+  800753:	8b 45 08             	mov    0x8(%ebp),%eax
+  800756:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800759:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80075c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800760:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800763:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80076a:	85 c0                	test   %eax,%eax
+  80076c:	74 26                	je     800794 <vsnprintf+0x47>
+  80076e:	85 d2                	test   %edx,%edx
+  800770:	7e 22                	jle    800794 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800772:	ff 75 14             	push   0x14(%ebp)
+  800775:	ff 75 10             	push   0x10(%ebp)
+  800778:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80077b:	50                   	push   %eax
+  80077c:	68 c6 02 80 00       	push   $0x8002c6
+  800781:	e8 7a fb ff ff       	call   800300 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800786:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800789:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80078c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80078f:	83 c4 10             	add    $0x10,%esp
+}
+  800792:	c9                   	leave
+  800793:	c3                   	ret
+		return -E_INVAL;
+  800794:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800799:	eb f7                	jmp    800792 <vsnprintf+0x45>
+
+0080079b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80079b:	55                   	push   %ebp
+  80079c:	89 e5                	mov    %esp,%ebp
+  80079e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007a1:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007a4:	50                   	push   %eax
+  8007a5:	ff 75 10             	push   0x10(%ebp)
+  8007a8:	ff 75 0c             	push   0xc(%ebp)
+  8007ab:	ff 75 08             	push   0x8(%ebp)
+  8007ae:	e8 9a ff ff ff       	call   80074d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007b3:	c9                   	leave
+  8007b4:	c3                   	ret
+
+008007b5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007b5:	55                   	push   %ebp
+  8007b6:	89 e5                	mov    %esp,%ebp
+  8007b8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c0:	eb 03                	jmp    8007c5 <strlen+0x10>
+		n++;
+  8007c2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007c5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007c9:	75 f7                	jne    8007c2 <strlen+0xd>
+	return n;
+}
+  8007cb:	5d                   	pop    %ebp
+  8007cc:	c3                   	ret
+
+008007cd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007cd:	55                   	push   %ebp
+  8007ce:	89 e5                	mov    %esp,%ebp
+  8007d0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007db:	eb 03                	jmp    8007e0 <strnlen+0x13>
+		n++;
+  8007dd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007e0:	39 d0                	cmp    %edx,%eax
+  8007e2:	74 08                	je     8007ec <strnlen+0x1f>
+  8007e4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007e8:	75 f3                	jne    8007dd <strnlen+0x10>
+  8007ea:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007ec:	89 d0                	mov    %edx,%eax
+  8007ee:	5d                   	pop    %ebp
+  8007ef:	c3                   	ret
+
+008007f0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007f0:	55                   	push   %ebp
+  8007f1:	89 e5                	mov    %esp,%ebp
+  8007f3:	53                   	push   %ebx
+  8007f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007f7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ff:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800803:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800806:	83 c0 01             	add    $0x1,%eax
+  800809:	84 d2                	test   %dl,%dl
+  80080b:	75 f2                	jne    8007ff <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80080d:	89 c8                	mov    %ecx,%eax
+  80080f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800812:	c9                   	leave
+  800813:	c3                   	ret
+
+00800814 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800814:	55                   	push   %ebp
+  800815:	89 e5                	mov    %esp,%ebp
+  800817:	53                   	push   %ebx
+  800818:	83 ec 10             	sub    $0x10,%esp
+  80081b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80081e:	53                   	push   %ebx
+  80081f:	e8 91 ff ff ff       	call   8007b5 <strlen>
+  800824:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800827:	ff 75 0c             	push   0xc(%ebp)
+  80082a:	01 d8                	add    %ebx,%eax
+  80082c:	50                   	push   %eax
+  80082d:	e8 be ff ff ff       	call   8007f0 <strcpy>
+	return dst;
+}
+  800832:	89 d8                	mov    %ebx,%eax
+  800834:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800837:	c9                   	leave
+  800838:	c3                   	ret
+
+00800839 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800839:	55                   	push   %ebp
+  80083a:	89 e5                	mov    %esp,%ebp
+  80083c:	56                   	push   %esi
+  80083d:	53                   	push   %ebx
+  80083e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800841:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800844:	89 f3                	mov    %esi,%ebx
+  800846:	03 5d 10             	add    0x10(%ebp),%ebx
+  800849:	89 f0                	mov    %esi,%eax
+  80084b:	eb 0f                	jmp    80085c <strncpy+0x23>
+		*dst++ = *src;
+  80084d:	83 c0 01             	add    $0x1,%eax
+  800850:	0f b6 0a             	movzbl (%edx),%ecx
+  800853:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800856:	80 f9 01             	cmp    $0x1,%cl
+  800859:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80085c:	39 d8                	cmp    %ebx,%eax
+  80085e:	75 ed                	jne    80084d <strncpy+0x14>
+	}
+	return ret;
+}
+  800860:	89 f0                	mov    %esi,%eax
+  800862:	5b                   	pop    %ebx
+  800863:	5e                   	pop    %esi
+  800864:	5d                   	pop    %ebp
+  800865:	c3                   	ret
+
+00800866 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800866:	55                   	push   %ebp
+  800867:	89 e5                	mov    %esp,%ebp
+  800869:	56                   	push   %esi
+  80086a:	53                   	push   %ebx
+  80086b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80086e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800871:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800874:	89 f0                	mov    %esi,%eax
+  800876:	85 d2                	test   %edx,%edx
+  800878:	74 21                	je     80089b <strlcpy+0x35>
+  80087a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80087e:	89 f2                	mov    %esi,%edx
+  800880:	eb 09                	jmp    80088b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800882:	83 c1 01             	add    $0x1,%ecx
+  800885:	83 c2 01             	add    $0x1,%edx
+  800888:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80088b:	39 c2                	cmp    %eax,%edx
+  80088d:	74 09                	je     800898 <strlcpy+0x32>
+  80088f:	0f b6 19             	movzbl (%ecx),%ebx
+  800892:	84 db                	test   %bl,%bl
+  800894:	75 ec                	jne    800882 <strlcpy+0x1c>
+  800896:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800898:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80089b:	29 f0                	sub    %esi,%eax
+}
+  80089d:	5b                   	pop    %ebx
+  80089e:	5e                   	pop    %esi
+  80089f:	5d                   	pop    %ebp
+  8008a0:	c3                   	ret
+
+008008a1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008a1:	55                   	push   %ebp
+  8008a2:	89 e5                	mov    %esp,%ebp
+  8008a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008aa:	eb 06                	jmp    8008b2 <strcmp+0x11>
+		p++, q++;
+  8008ac:	83 c1 01             	add    $0x1,%ecx
+  8008af:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008b2:	0f b6 01             	movzbl (%ecx),%eax
+  8008b5:	84 c0                	test   %al,%al
+  8008b7:	74 04                	je     8008bd <strcmp+0x1c>
+  8008b9:	3a 02                	cmp    (%edx),%al
+  8008bb:	74 ef                	je     8008ac <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008bd:	0f b6 c0             	movzbl %al,%eax
+  8008c0:	0f b6 12             	movzbl (%edx),%edx
+  8008c3:	29 d0                	sub    %edx,%eax
+}
+  8008c5:	5d                   	pop    %ebp
+  8008c6:	c3                   	ret
+
+008008c7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008c7:	55                   	push   %ebp
+  8008c8:	89 e5                	mov    %esp,%ebp
+  8008ca:	53                   	push   %ebx
+  8008cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008d1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008d4:	eb 09                	jmp    8008df <strncmp+0x18>
+		n--, p++, q++;
+  8008d6:	83 ea 01             	sub    $0x1,%edx
+  8008d9:	83 c0 01             	add    $0x1,%eax
+  8008dc:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008df:	85 d2                	test   %edx,%edx
+  8008e1:	74 18                	je     8008fb <strncmp+0x34>
+  8008e3:	0f b6 18             	movzbl (%eax),%ebx
+  8008e6:	84 db                	test   %bl,%bl
+  8008e8:	74 04                	je     8008ee <strncmp+0x27>
+  8008ea:	3a 19                	cmp    (%ecx),%bl
+  8008ec:	74 e8                	je     8008d6 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008ee:	0f b6 00             	movzbl (%eax),%eax
+  8008f1:	0f b6 11             	movzbl (%ecx),%edx
+  8008f4:	29 d0                	sub    %edx,%eax
+}
+  8008f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008f9:	c9                   	leave
+  8008fa:	c3                   	ret
+		return 0;
+  8008fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800900:	eb f4                	jmp    8008f6 <strncmp+0x2f>
+
+00800902 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800902:	55                   	push   %ebp
+  800903:	89 e5                	mov    %esp,%ebp
+  800905:	8b 45 08             	mov    0x8(%ebp),%eax
+  800908:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80090c:	eb 03                	jmp    800911 <strchr+0xf>
+  80090e:	83 c0 01             	add    $0x1,%eax
+  800911:	0f b6 10             	movzbl (%eax),%edx
+  800914:	84 d2                	test   %dl,%dl
+  800916:	74 06                	je     80091e <strchr+0x1c>
+		if (*s == c)
+  800918:	38 ca                	cmp    %cl,%dl
+  80091a:	75 f2                	jne    80090e <strchr+0xc>
+  80091c:	eb 05                	jmp    800923 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80091e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800923:	5d                   	pop    %ebp
+  800924:	c3                   	ret
+
+00800925 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800925:	55                   	push   %ebp
+  800926:	89 e5                	mov    %esp,%ebp
+  800928:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80092f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800932:	38 ca                	cmp    %cl,%dl
+  800934:	74 09                	je     80093f <strfind+0x1a>
+  800936:	84 d2                	test   %dl,%dl
+  800938:	74 05                	je     80093f <strfind+0x1a>
+	for (; *s; s++)
+  80093a:	83 c0 01             	add    $0x1,%eax
+  80093d:	eb f0                	jmp    80092f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80093f:	5d                   	pop    %ebp
+  800940:	c3                   	ret
+
+00800941 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800941:	55                   	push   %ebp
+  800942:	89 e5                	mov    %esp,%ebp
+  800944:	57                   	push   %edi
+  800945:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800948:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80094b:	85 c9                	test   %ecx,%ecx
+  80094d:	74 20                	je     80096f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80094f:	89 f8                	mov    %edi,%eax
+  800951:	09 c8                	or     %ecx,%eax
+  800953:	a8 03                	test   $0x3,%al
+  800955:	75 12                	jne    800969 <memset+0x28>
+		c &= 0xFF;
+  800957:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80095b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800961:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800964:	fc                   	cld
+  800965:	f3 ab                	rep stos %eax,%es:(%edi)
+  800967:	eb 06                	jmp    80096f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800969:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80096c:	fc                   	cld
+  80096d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80096f:	89 f8                	mov    %edi,%eax
+  800971:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800974:	c9                   	leave
+  800975:	c3                   	ret
+
+00800976 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800976:	55                   	push   %ebp
+  800977:	89 e5                	mov    %esp,%ebp
+  800979:	57                   	push   %edi
+  80097a:	56                   	push   %esi
+  80097b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800981:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800984:	39 c6                	cmp    %eax,%esi
+  800986:	73 32                	jae    8009ba <memmove+0x44>
+  800988:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80098b:	39 d0                	cmp    %edx,%eax
+  80098d:	73 2b                	jae    8009ba <memmove+0x44>
+		s += n;
+		d += n;
+  80098f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800992:	89 d6                	mov    %edx,%esi
+  800994:	09 fe                	or     %edi,%esi
+  800996:	09 ce                	or     %ecx,%esi
+  800998:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80099e:	75 0e                	jne    8009ae <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009a0:	83 ef 04             	sub    $0x4,%edi
+  8009a3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009a6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009a9:	fd                   	std
+  8009aa:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009ac:	eb 09                	jmp    8009b7 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009ae:	83 ef 01             	sub    $0x1,%edi
+  8009b1:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009b4:	fd                   	std
+  8009b5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009b7:	fc                   	cld
+  8009b8:	eb 1a                	jmp    8009d4 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ba:	89 f2                	mov    %esi,%edx
+  8009bc:	09 c2                	or     %eax,%edx
+  8009be:	09 ca                	or     %ecx,%edx
+  8009c0:	f6 c2 03             	test   $0x3,%dl
+  8009c3:	75 0a                	jne    8009cf <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009c5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009c8:	89 c7                	mov    %eax,%edi
+  8009ca:	fc                   	cld
+  8009cb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009cd:	eb 05                	jmp    8009d4 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009cf:	89 c7                	mov    %eax,%edi
+  8009d1:	fc                   	cld
+  8009d2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009d4:	5e                   	pop    %esi
+  8009d5:	5f                   	pop    %edi
+  8009d6:	5d                   	pop    %ebp
+  8009d7:	c3                   	ret
+
+008009d8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009d8:	55                   	push   %ebp
+  8009d9:	89 e5                	mov    %esp,%ebp
+  8009db:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009de:	ff 75 10             	push   0x10(%ebp)
+  8009e1:	ff 75 0c             	push   0xc(%ebp)
+  8009e4:	ff 75 08             	push   0x8(%ebp)
+  8009e7:	e8 8a ff ff ff       	call   800976 <memmove>
+}
+  8009ec:	c9                   	leave
+  8009ed:	c3                   	ret
+
+008009ee <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009ee:	55                   	push   %ebp
+  8009ef:	89 e5                	mov    %esp,%ebp
+  8009f1:	56                   	push   %esi
+  8009f2:	53                   	push   %ebx
+  8009f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009f9:	89 c6                	mov    %eax,%esi
+  8009fb:	03 75 10             	add    0x10(%ebp),%esi
+  8009fe:	eb 06                	jmp    800a06 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a00:	83 c0 01             	add    $0x1,%eax
+  800a03:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a06:	39 f0                	cmp    %esi,%eax
+  800a08:	74 14                	je     800a1e <memcmp+0x30>
+		if (*s1 != *s2)
+  800a0a:	0f b6 08             	movzbl (%eax),%ecx
+  800a0d:	0f b6 1a             	movzbl (%edx),%ebx
+  800a10:	38 d9                	cmp    %bl,%cl
+  800a12:	74 ec                	je     800a00 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a14:	0f b6 c1             	movzbl %cl,%eax
+  800a17:	0f b6 db             	movzbl %bl,%ebx
+  800a1a:	29 d8                	sub    %ebx,%eax
+  800a1c:	eb 05                	jmp    800a23 <memcmp+0x35>
+	}
+
+	return 0;
+  800a1e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a23:	5b                   	pop    %ebx
+  800a24:	5e                   	pop    %esi
+  800a25:	5d                   	pop    %ebp
+  800a26:	c3                   	ret
+
+00800a27 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a27:	55                   	push   %ebp
+  800a28:	89 e5                	mov    %esp,%ebp
+  800a2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a30:	89 c2                	mov    %eax,%edx
+  800a32:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a35:	eb 03                	jmp    800a3a <memfind+0x13>
+  800a37:	83 c0 01             	add    $0x1,%eax
+  800a3a:	39 d0                	cmp    %edx,%eax
+  800a3c:	73 04                	jae    800a42 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a3e:	38 08                	cmp    %cl,(%eax)
+  800a40:	75 f5                	jne    800a37 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a42:	5d                   	pop    %ebp
+  800a43:	c3                   	ret
+
+00800a44 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a44:	55                   	push   %ebp
+  800a45:	89 e5                	mov    %esp,%ebp
+  800a47:	57                   	push   %edi
+  800a48:	56                   	push   %esi
+  800a49:	53                   	push   %ebx
+  800a4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a4d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a50:	eb 03                	jmp    800a55 <strtol+0x11>
+		s++;
+  800a52:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a55:	0f b6 02             	movzbl (%edx),%eax
+  800a58:	3c 20                	cmp    $0x20,%al
+  800a5a:	74 f6                	je     800a52 <strtol+0xe>
+  800a5c:	3c 09                	cmp    $0x9,%al
+  800a5e:	74 f2                	je     800a52 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a60:	3c 2b                	cmp    $0x2b,%al
+  800a62:	74 2a                	je     800a8e <strtol+0x4a>
+	int neg = 0;
+  800a64:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a69:	3c 2d                	cmp    $0x2d,%al
+  800a6b:	74 2b                	je     800a98 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a6d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a73:	75 0f                	jne    800a84 <strtol+0x40>
+  800a75:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a78:	74 28                	je     800aa2 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a7a:	85 db                	test   %ebx,%ebx
+  800a7c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a81:	0f 44 d8             	cmove  %eax,%ebx
+  800a84:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a89:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a8c:	eb 46                	jmp    800ad4 <strtol+0x90>
+		s++;
+  800a8e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a91:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a96:	eb d5                	jmp    800a6d <strtol+0x29>
+		s++, neg = 1;
+  800a98:	83 c2 01             	add    $0x1,%edx
+  800a9b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800aa0:	eb cb                	jmp    800a6d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aa2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800aa6:	74 0e                	je     800ab6 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800aa8:	85 db                	test   %ebx,%ebx
+  800aaa:	75 d8                	jne    800a84 <strtol+0x40>
+		s++, base = 8;
+  800aac:	83 c2 01             	add    $0x1,%edx
+  800aaf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ab4:	eb ce                	jmp    800a84 <strtol+0x40>
+		s += 2, base = 16;
+  800ab6:	83 c2 02             	add    $0x2,%edx
+  800ab9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800abe:	eb c4                	jmp    800a84 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ac0:	0f be c0             	movsbl %al,%eax
+  800ac3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ac6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ac9:	7d 3a                	jge    800b05 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800acb:	83 c2 01             	add    $0x1,%edx
+  800ace:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ad2:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ad4:	0f b6 02             	movzbl (%edx),%eax
+  800ad7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ada:	89 f3                	mov    %esi,%ebx
+  800adc:	80 fb 09             	cmp    $0x9,%bl
+  800adf:	76 df                	jbe    800ac0 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ae1:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ae4:	89 f3                	mov    %esi,%ebx
+  800ae6:	80 fb 19             	cmp    $0x19,%bl
+  800ae9:	77 08                	ja     800af3 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800aeb:	0f be c0             	movsbl %al,%eax
+  800aee:	83 e8 57             	sub    $0x57,%eax
+  800af1:	eb d3                	jmp    800ac6 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800af3:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800af6:	89 f3                	mov    %esi,%ebx
+  800af8:	80 fb 19             	cmp    $0x19,%bl
+  800afb:	77 08                	ja     800b05 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800afd:	0f be c0             	movsbl %al,%eax
+  800b00:	83 e8 37             	sub    $0x37,%eax
+  800b03:	eb c1                	jmp    800ac6 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b05:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b09:	74 05                	je     800b10 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b0e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b10:	89 c8                	mov    %ecx,%eax
+  800b12:	f7 d8                	neg    %eax
+  800b14:	85 ff                	test   %edi,%edi
+  800b16:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b19:	89 c8                	mov    %ecx,%eax
+  800b1b:	5b                   	pop    %ebx
+  800b1c:	5e                   	pop    %esi
+  800b1d:	5f                   	pop    %edi
+  800b1e:	5d                   	pop    %ebp
+  800b1f:	c3                   	ret
+
+00800b20 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800b20:	55                   	push   %ebp
+  800b21:	89 e5                	mov    %esp,%ebp
+  800b23:	57                   	push   %edi
+  800b24:	56                   	push   %esi
+  800b25:	53                   	push   %ebx
+  800b26:	83 ec 0c             	sub    $0xc,%esp
+  800b29:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b2c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b2f:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800b32:	85 ff                	test   %edi,%edi
+  800b34:	74 16                	je     800b4c <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800b36:	83 ec 04             	sub    $0x4,%esp
+  800b39:	56                   	push   %esi
+  800b3a:	6a 00                	push   $0x0
+  800b3c:	53                   	push   %ebx
+  800b3d:	e8 02 ff ff ff       	call   800a44 <strtol>
+  800b42:	89 07                	mov    %eax,(%edi)
+  800b44:	83 c4 10             	add    $0x10,%esp
+  800b47:	eb 03                	jmp    800b4c <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800b49:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800b4c:	0f b6 03             	movzbl (%ebx),%eax
+  800b4f:	3c 20                	cmp    $0x20,%al
+  800b51:	74 f6                	je     800b49 <strisl+0x29>
+  800b53:	3c 09                	cmp    $0x9,%al
+  800b55:	74 f2                	je     800b49 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b57:	3c 2b                	cmp    $0x2b,%al
+  800b59:	74 23                	je     800b7e <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800b5b:	3c 2d                	cmp    $0x2d,%al
+  800b5d:	0f 94 c0             	sete   %al
+  800b60:	0f b6 c0             	movzbl %al,%eax
+  800b63:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b65:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800b6b:	75 41                	jne    800bae <strisl+0x8e>
+  800b6d:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800b70:	74 11                	je     800b83 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b72:	85 f6                	test   %esi,%esi
+  800b74:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b79:	0f 44 f0             	cmove  %eax,%esi
+  800b7c:	eb 30                	jmp    800bae <strisl+0x8e>
+		s++;
+  800b7e:	83 c3 01             	add    $0x1,%ebx
+  800b81:	eb e2                	jmp    800b65 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b83:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800b87:	74 0e                	je     800b97 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800b89:	85 f6                	test   %esi,%esi
+  800b8b:	75 21                	jne    800bae <strisl+0x8e>
+		s++, base = 8;
+  800b8d:	83 c3 01             	add    $0x1,%ebx
+  800b90:	be 08 00 00 00       	mov    $0x8,%esi
+  800b95:	eb 17                	jmp    800bae <strisl+0x8e>
+		s += 2, base = 16;
+  800b97:	83 c3 02             	add    $0x2,%ebx
+  800b9a:	be 10 00 00 00       	mov    $0x10,%esi
+  800b9f:	eb 0d                	jmp    800bae <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ba1:	0f be c0             	movsbl %al,%eax
+  800ba4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800ba7:	39 f0                	cmp    %esi,%eax
+  800ba9:	7d 38                	jge    800be3 <strisl+0xc3>
+			return 0;
+		s++;
+  800bab:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800bae:	0f b6 03             	movzbl (%ebx),%eax
+  800bb1:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800bb4:	80 fa 09             	cmp    $0x9,%dl
+  800bb7:	76 e8                	jbe    800ba1 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800bb9:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800bbc:	80 fa 19             	cmp    $0x19,%dl
+  800bbf:	77 08                	ja     800bc9 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800bc1:	0f be c0             	movsbl %al,%eax
+  800bc4:	83 e8 57             	sub    $0x57,%eax
+  800bc7:	eb de                	jmp    800ba7 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bc9:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800bcc:	80 fa 19             	cmp    $0x19,%dl
+  800bcf:	77 08                	ja     800bd9 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800bd1:	0f be c0             	movsbl %al,%eax
+  800bd4:	83 e8 37             	sub    $0x37,%eax
+  800bd7:	eb ce                	jmp    800ba7 <strisl+0x87>
+		else if (!*s)
+  800bd9:	84 c0                	test   %al,%al
+  800bdb:	0f 94 c0             	sete   %al
+  800bde:	0f b6 c0             	movzbl %al,%eax
+  800be1:	eb 05                	jmp    800be8 <strisl+0xc8>
+			return 0;
+  800be3:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800be8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800beb:	5b                   	pop    %ebx
+  800bec:	5e                   	pop    %esi
+  800bed:	5f                   	pop    %edi
+  800bee:	5d                   	pop    %ebp
+  800bef:	c3                   	ret
+
+00800bf0 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800bf0:	55                   	push   %ebp
+  800bf1:	89 e5                	mov    %esp,%ebp
+  800bf3:	83 ec 10             	sub    $0x10,%esp
+  800bf6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800bf9:	89 c8                	mov    %ecx,%eax
+  800bfb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800c00:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800c03:	eb 0b                	jmp    800c10 <touch_mem+0x20>
+		c = *(char *)page;
+  800c05:	0f b6 10             	movzbl (%eax),%edx
+  800c08:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c0b:	05 00 10 00 00       	add    $0x1000,%eax
+  800c10:	39 c8                	cmp    %ecx,%eax
+  800c12:	72 f1                	jb     800c05 <touch_mem+0x15>
+}
+  800c14:	c9                   	leave
+  800c15:	c3                   	ret
+
+00800c16 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c16:	55                   	push   %ebp
+  800c17:	89 e5                	mov    %esp,%ebp
+  800c19:	57                   	push   %edi
+  800c1a:	56                   	push   %esi
+  800c1b:	53                   	push   %ebx
+	touch_mem(s, len);
+  800c1c:	ff 75 0c             	push   0xc(%ebp)
+  800c1f:	ff 75 08             	push   0x8(%ebp)
+  800c22:	e8 c9 ff ff ff       	call   800bf0 <touch_mem>
+	asm volatile("int %1\n"
+  800c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c32:	89 c3                	mov    %eax,%ebx
+  800c34:	89 c7                	mov    %eax,%edi
+  800c36:	89 c6                	mov    %eax,%esi
+  800c38:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c3a:	83 c4 08             	add    $0x8,%esp
+  800c3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c40:	5b                   	pop    %ebx
+  800c41:	5e                   	pop    %esi
+  800c42:	5f                   	pop    %edi
+  800c43:	5d                   	pop    %ebp
+  800c44:	c3                   	ret
+
+00800c45 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c45:	55                   	push   %ebp
+  800c46:	89 e5                	mov    %esp,%ebp
+  800c48:	57                   	push   %edi
+  800c49:	56                   	push   %esi
+  800c4a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c50:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c55:	89 d1                	mov    %edx,%ecx
+  800c57:	89 d3                	mov    %edx,%ebx
+  800c59:	89 d7                	mov    %edx,%edi
+  800c5b:	89 d6                	mov    %edx,%esi
+  800c5d:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c5f:	5b                   	pop    %ebx
+  800c60:	5e                   	pop    %esi
+  800c61:	5f                   	pop    %edi
+  800c62:	5d                   	pop    %ebp
+  800c63:	c3                   	ret
+
+00800c64 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c64:	55                   	push   %ebp
+  800c65:	89 e5                	mov    %esp,%ebp
+  800c67:	57                   	push   %edi
+  800c68:	56                   	push   %esi
+  800c69:	53                   	push   %ebx
+  800c6a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c75:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c7a:	89 cb                	mov    %ecx,%ebx
+  800c7c:	89 cf                	mov    %ecx,%edi
+  800c7e:	89 ce                	mov    %ecx,%esi
+  800c80:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c82:	85 c0                	test   %eax,%eax
+  800c84:	7f 08                	jg     800c8e <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c89:	5b                   	pop    %ebx
+  800c8a:	5e                   	pop    %esi
+  800c8b:	5f                   	pop    %edi
+  800c8c:	5d                   	pop    %ebp
+  800c8d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c8e:	83 ec 0c             	sub    $0xc,%esp
+  800c91:	50                   	push   %eax
+  800c92:	6a 03                	push   $0x3
+  800c94:	68 eb 50 80 00       	push   $0x8050eb
+  800c99:	6a 23                	push   $0x23
+  800c9b:	68 08 51 80 00       	push   $0x805108
+  800ca0:	e8 89 f4 ff ff       	call   80012e <_panic>
+
+00800ca5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ca5:	55                   	push   %ebp
+  800ca6:	89 e5                	mov    %esp,%ebp
+  800ca8:	57                   	push   %edi
+  800ca9:	56                   	push   %esi
+  800caa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cab:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb0:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cb5:	89 d1                	mov    %edx,%ecx
+  800cb7:	89 d3                	mov    %edx,%ebx
+  800cb9:	89 d7                	mov    %edx,%edi
+  800cbb:	89 d6                	mov    %edx,%esi
+  800cbd:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cbf:	5b                   	pop    %ebx
+  800cc0:	5e                   	pop    %esi
+  800cc1:	5f                   	pop    %edi
+  800cc2:	5d                   	pop    %ebp
+  800cc3:	c3                   	ret
+
+00800cc4 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cc4:	55                   	push   %ebp
+  800cc5:	89 e5                	mov    %esp,%ebp
+  800cc7:	57                   	push   %edi
+  800cc8:	56                   	push   %esi
+  800cc9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cca:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ccf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cd4:	89 d1                	mov    %edx,%ecx
+  800cd6:	89 d3                	mov    %edx,%ebx
+  800cd8:	89 d7                	mov    %edx,%edi
+  800cda:	89 d6                	mov    %edx,%esi
+  800cdc:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cde:	5b                   	pop    %ebx
+  800cdf:	5e                   	pop    %esi
+  800ce0:	5f                   	pop    %edi
+  800ce1:	5d                   	pop    %ebp
+  800ce2:	c3                   	ret
+
+00800ce3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ce3:	55                   	push   %ebp
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	57                   	push   %edi
+  800ce7:	56                   	push   %esi
+  800ce8:	53                   	push   %ebx
+  800ce9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cec:	be 00 00 00 00       	mov    $0x0,%esi
+  800cf1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf7:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cfc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cff:	89 f7                	mov    %esi,%edi
+  800d01:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d03:	85 c0                	test   %eax,%eax
+  800d05:	7f 08                	jg     800d0f <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0a:	5b                   	pop    %ebx
+  800d0b:	5e                   	pop    %esi
+  800d0c:	5f                   	pop    %edi
+  800d0d:	5d                   	pop    %ebp
+  800d0e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d0f:	83 ec 0c             	sub    $0xc,%esp
+  800d12:	50                   	push   %eax
+  800d13:	6a 04                	push   $0x4
+  800d15:	68 eb 50 80 00       	push   $0x8050eb
+  800d1a:	6a 23                	push   $0x23
+  800d1c:	68 08 51 80 00       	push   $0x805108
+  800d21:	e8 08 f4 ff ff       	call   80012e <_panic>
+
+00800d26 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d26:	55                   	push   %ebp
+  800d27:	89 e5                	mov    %esp,%ebp
+  800d29:	57                   	push   %edi
+  800d2a:	56                   	push   %esi
+  800d2b:	53                   	push   %ebx
+  800d2c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d35:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d3d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d40:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d43:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d45:	85 c0                	test   %eax,%eax
+  800d47:	7f 08                	jg     800d51 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4c:	5b                   	pop    %ebx
+  800d4d:	5e                   	pop    %esi
+  800d4e:	5f                   	pop    %edi
+  800d4f:	5d                   	pop    %ebp
+  800d50:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d51:	83 ec 0c             	sub    $0xc,%esp
+  800d54:	50                   	push   %eax
+  800d55:	6a 05                	push   $0x5
+  800d57:	68 eb 50 80 00       	push   $0x8050eb
+  800d5c:	6a 23                	push   $0x23
+  800d5e:	68 08 51 80 00       	push   $0x805108
+  800d63:	e8 c6 f3 ff ff       	call   80012e <_panic>
+
+00800d68 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d68:	55                   	push   %ebp
+  800d69:	89 e5                	mov    %esp,%ebp
+  800d6b:	57                   	push   %edi
+  800d6c:	56                   	push   %esi
+  800d6d:	53                   	push   %ebx
+  800d6e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d71:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d81:	89 df                	mov    %ebx,%edi
+  800d83:	89 de                	mov    %ebx,%esi
+  800d85:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d87:	85 c0                	test   %eax,%eax
+  800d89:	7f 08                	jg     800d93 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8e:	5b                   	pop    %ebx
+  800d8f:	5e                   	pop    %esi
+  800d90:	5f                   	pop    %edi
+  800d91:	5d                   	pop    %ebp
+  800d92:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d93:	83 ec 0c             	sub    $0xc,%esp
+  800d96:	50                   	push   %eax
+  800d97:	6a 06                	push   $0x6
+  800d99:	68 eb 50 80 00       	push   $0x8050eb
+  800d9e:	6a 23                	push   $0x23
+  800da0:	68 08 51 80 00       	push   $0x805108
+  800da5:	e8 84 f3 ff ff       	call   80012e <_panic>
+
+00800daa <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800daa:	55                   	push   %ebp
+  800dab:	89 e5                	mov    %esp,%ebp
+  800dad:	57                   	push   %edi
+  800dae:	56                   	push   %esi
+  800daf:	53                   	push   %ebx
+  800db0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800db3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbe:	b8 18 00 00 00       	mov    $0x18,%eax
+  800dc3:	89 df                	mov    %ebx,%edi
+  800dc5:	89 de                	mov    %ebx,%esi
+  800dc7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dc9:	85 c0                	test   %eax,%eax
+  800dcb:	7f 08                	jg     800dd5 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800dcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd0:	5b                   	pop    %ebx
+  800dd1:	5e                   	pop    %esi
+  800dd2:	5f                   	pop    %edi
+  800dd3:	5d                   	pop    %ebp
+  800dd4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd5:	83 ec 0c             	sub    $0xc,%esp
+  800dd8:	50                   	push   %eax
+  800dd9:	6a 18                	push   $0x18
+  800ddb:	68 eb 50 80 00       	push   $0x8050eb
+  800de0:	6a 23                	push   $0x23
+  800de2:	68 08 51 80 00       	push   $0x805108
+  800de7:	e8 42 f3 ff ff       	call   80012e <_panic>
+
+00800dec <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800dec:	55                   	push   %ebp
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	57                   	push   %edi
+  800df0:	56                   	push   %esi
+  800df1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800df2:	be 00 00 00 00       	mov    $0x0,%esi
+  800df7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfd:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e05:	89 f7                	mov    %esi,%edi
+  800e07:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800e09:	5b                   	pop    %ebx
+  800e0a:	5e                   	pop    %esi
+  800e0b:	5f                   	pop    %edi
+  800e0c:	5d                   	pop    %ebp
+  800e0d:	c3                   	ret
+
+00800e0e <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800e0e:	55                   	push   %ebp
+  800e0f:	89 e5                	mov    %esp,%ebp
+  800e11:	57                   	push   %edi
+  800e12:	56                   	push   %esi
+  800e13:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e1f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e24:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e27:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e2a:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e2c:	5b                   	pop    %ebx
+  800e2d:	5e                   	pop    %esi
+  800e2e:	5f                   	pop    %edi
+  800e2f:	5d                   	pop    %ebp
+  800e30:	c3                   	ret
+
+00800e31 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	57                   	push   %edi
+  800e35:	56                   	push   %esi
+  800e36:	53                   	push   %ebx
+  800e37:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800e3a:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800e3d:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800e43:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800e46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e54:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e57:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e59:	85 c0                	test   %eax,%eax
+  800e5b:	7f 08                	jg     800e65 <sys_page_map_range+0x34>
+}
+  800e5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e60:	5b                   	pop    %ebx
+  800e61:	5e                   	pop    %esi
+  800e62:	5f                   	pop    %edi
+  800e63:	5d                   	pop    %ebp
+  800e64:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e65:	83 ec 0c             	sub    $0xc,%esp
+  800e68:	50                   	push   %eax
+  800e69:	6a 10                	push   $0x10
+  800e6b:	68 eb 50 80 00       	push   $0x8050eb
+  800e70:	6a 23                	push   $0x23
+  800e72:	68 08 51 80 00       	push   $0x805108
+  800e77:	e8 b2 f2 ff ff       	call   80012e <_panic>
+
+00800e7c <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e7c:	55                   	push   %ebp
+  800e7d:	89 e5                	mov    %esp,%ebp
+  800e7f:	57                   	push   %edi
+  800e80:	56                   	push   %esi
+  800e81:	53                   	push   %ebx
+  800e82:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e85:	be 00 00 00 00       	mov    $0x0,%esi
+  800e8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e90:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e98:	89 f7                	mov    %esi,%edi
+  800e9a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e9c:	85 c0                	test   %eax,%eax
+  800e9e:	7f 08                	jg     800ea8 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ea0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea3:	5b                   	pop    %ebx
+  800ea4:	5e                   	pop    %esi
+  800ea5:	5f                   	pop    %edi
+  800ea6:	5d                   	pop    %ebp
+  800ea7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea8:	83 ec 0c             	sub    $0xc,%esp
+  800eab:	50                   	push   %eax
+  800eac:	6a 11                	push   $0x11
+  800eae:	68 eb 50 80 00       	push   $0x8050eb
+  800eb3:	6a 23                	push   $0x23
+  800eb5:	68 08 51 80 00       	push   $0x805108
+  800eba:	e8 6f f2 ff ff       	call   80012e <_panic>
+
+00800ebf <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800ebf:	55                   	push   %ebp
+  800ec0:	89 e5                	mov    %esp,%ebp
+  800ec2:	57                   	push   %edi
+  800ec3:	56                   	push   %esi
+  800ec4:	53                   	push   %ebx
+  800ec5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ec8:	be 00 00 00 00       	mov    $0x0,%esi
+  800ecd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800ed8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800edb:	89 f7                	mov    %esi,%edi
+  800edd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800edf:	85 c0                	test   %eax,%eax
+  800ee1:	7f 08                	jg     800eeb <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ee3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee6:	5b                   	pop    %ebx
+  800ee7:	5e                   	pop    %esi
+  800ee8:	5f                   	pop    %edi
+  800ee9:	5d                   	pop    %ebp
+  800eea:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eeb:	83 ec 0c             	sub    $0xc,%esp
+  800eee:	50                   	push   %eax
+  800eef:	6a 1b                	push   $0x1b
+  800ef1:	68 eb 50 80 00       	push   $0x8050eb
+  800ef6:	6a 23                	push   $0x23
+  800ef8:	68 08 51 80 00       	push   $0x805108
+  800efd:	e8 2c f2 ff ff       	call   80012e <_panic>
+
+00800f02 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800f02:	55                   	push   %ebp
+  800f03:	89 e5                	mov    %esp,%ebp
+  800f05:	57                   	push   %edi
+  800f06:	56                   	push   %esi
+  800f07:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f08:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f0d:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f12:	89 d1                	mov    %edx,%ecx
+  800f14:	89 d3                	mov    %edx,%ebx
+  800f16:	89 d7                	mov    %edx,%edi
+  800f18:	89 d6                	mov    %edx,%esi
+  800f1a:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f1c:	5b                   	pop    %ebx
+  800f1d:	5e                   	pop    %esi
+  800f1e:	5f                   	pop    %edi
+  800f1f:	5d                   	pop    %ebp
+  800f20:	c3                   	ret
+
+00800f21 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f21:	55                   	push   %ebp
+  800f22:	89 e5                	mov    %esp,%ebp
+  800f24:	57                   	push   %edi
+  800f25:	56                   	push   %esi
+  800f26:	53                   	push   %ebx
+  800f27:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f35:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f3a:	89 df                	mov    %ebx,%edi
+  800f3c:	89 de                	mov    %ebx,%esi
+  800f3e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f40:	85 c0                	test   %eax,%eax
+  800f42:	7f 08                	jg     800f4c <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f47:	5b                   	pop    %ebx
+  800f48:	5e                   	pop    %esi
+  800f49:	5f                   	pop    %edi
+  800f4a:	5d                   	pop    %ebp
+  800f4b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f4c:	83 ec 0c             	sub    $0xc,%esp
+  800f4f:	50                   	push   %eax
+  800f50:	6a 08                	push   $0x8
+  800f52:	68 eb 50 80 00       	push   $0x8050eb
+  800f57:	6a 23                	push   $0x23
+  800f59:	68 08 51 80 00       	push   $0x805108
+  800f5e:	e8 cb f1 ff ff       	call   80012e <_panic>
+
+00800f63 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f63:	55                   	push   %ebp
+  800f64:	89 e5                	mov    %esp,%ebp
+  800f66:	57                   	push   %edi
+  800f67:	56                   	push   %esi
+  800f68:	53                   	push   %ebx
+  800f69:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800f6c:	6a 44                	push   $0x44
+  800f6e:	ff 75 0c             	push   0xc(%ebp)
+  800f71:	e8 7a fc ff ff       	call   800bf0 <touch_mem>
+	asm volatile("int %1\n"
+  800f76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7e:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f86:	89 df                	mov    %ebx,%edi
+  800f88:	89 de                	mov    %ebx,%esi
+  800f8a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f8c:	83 c4 08             	add    $0x8,%esp
+  800f8f:	85 c0                	test   %eax,%eax
+  800f91:	7f 08                	jg     800f9b <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f96:	5b                   	pop    %ebx
+  800f97:	5e                   	pop    %esi
+  800f98:	5f                   	pop    %edi
+  800f99:	5d                   	pop    %ebp
+  800f9a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9b:	83 ec 0c             	sub    $0xc,%esp
+  800f9e:	50                   	push   %eax
+  800f9f:	6a 09                	push   $0x9
+  800fa1:	68 eb 50 80 00       	push   $0x8050eb
+  800fa6:	6a 23                	push   $0x23
+  800fa8:	68 08 51 80 00       	push   $0x805108
+  800fad:	e8 7c f1 ff ff       	call   80012e <_panic>
+
+00800fb2 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800fb2:	55                   	push   %ebp
+  800fb3:	89 e5                	mov    %esp,%ebp
+  800fb5:	57                   	push   %edi
+  800fb6:	56                   	push   %esi
+  800fb7:	53                   	push   %ebx
+  800fb8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fbb:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800fcb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fce:	89 f7                	mov    %esi,%edi
+  800fd0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd2:	85 c0                	test   %eax,%eax
+  800fd4:	7f 08                	jg     800fde <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800fd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd9:	5b                   	pop    %ebx
+  800fda:	5e                   	pop    %esi
+  800fdb:	5f                   	pop    %edi
+  800fdc:	5d                   	pop    %ebp
+  800fdd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fde:	83 ec 0c             	sub    $0xc,%esp
+  800fe1:	50                   	push   %eax
+  800fe2:	6a 1a                	push   $0x1a
+  800fe4:	68 eb 50 80 00       	push   $0x8050eb
+  800fe9:	6a 23                	push   $0x23
+  800feb:	68 08 51 80 00       	push   $0x805108
+  800ff0:	e8 39 f1 ff ff       	call   80012e <_panic>
+
+00800ff5 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  800ff5:	55                   	push   %ebp
+  800ff6:	89 e5                	mov    %esp,%ebp
+  800ff8:	57                   	push   %edi
+  800ff9:	56                   	push   %esi
+  800ffa:	53                   	push   %ebx
+  800ffb:	83 ec 0c             	sub    $0xc,%esp
+  800ffe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801001:	89 d8                	mov    %ebx,%eax
+  801003:	c1 e0 05             	shl    $0x5,%eax
+  801006:	50                   	push   %eax
+  801007:	ff 75 0c             	push   0xc(%ebp)
+  80100a:	e8 e1 fb ff ff       	call   800bf0 <touch_mem>
+	asm volatile("int %1\n"
+  80100f:	be 00 00 00 00       	mov    $0x0,%esi
+  801014:	8b 55 08             	mov    0x8(%ebp),%edx
+  801017:	b8 13 00 00 00       	mov    $0x13,%eax
+  80101c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101f:	89 f7                	mov    %esi,%edi
+  801021:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801023:	83 c4 08             	add    $0x8,%esp
+  801026:	85 c0                	test   %eax,%eax
+  801028:	7f 08                	jg     801032 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  80102a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80102d:	5b                   	pop    %ebx
+  80102e:	5e                   	pop    %esi
+  80102f:	5f                   	pop    %edi
+  801030:	5d                   	pop    %ebp
+  801031:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801032:	83 ec 0c             	sub    $0xc,%esp
+  801035:	50                   	push   %eax
+  801036:	6a 13                	push   $0x13
+  801038:	68 eb 50 80 00       	push   $0x8050eb
+  80103d:	6a 23                	push   $0x23
+  80103f:	68 08 51 80 00       	push   $0x805108
+  801044:	e8 e5 f0 ff ff       	call   80012e <_panic>
+
+00801049 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801049:	55                   	push   %ebp
+  80104a:	89 e5                	mov    %esp,%ebp
+  80104c:	57                   	push   %edi
+  80104d:	56                   	push   %esi
+  80104e:	53                   	push   %ebx
+  80104f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801052:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801057:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801062:	89 df                	mov    %ebx,%edi
+  801064:	89 de                	mov    %ebx,%esi
+  801066:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801068:	85 c0                	test   %eax,%eax
+  80106a:	7f 08                	jg     801074 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80106c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80106f:	5b                   	pop    %ebx
+  801070:	5e                   	pop    %esi
+  801071:	5f                   	pop    %edi
+  801072:	5d                   	pop    %ebp
+  801073:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801074:	83 ec 0c             	sub    $0xc,%esp
+  801077:	50                   	push   %eax
+  801078:	6a 0a                	push   $0xa
+  80107a:	68 eb 50 80 00       	push   $0x8050eb
+  80107f:	6a 23                	push   $0x23
+  801081:	68 08 51 80 00       	push   $0x805108
+  801086:	e8 a3 f0 ff ff       	call   80012e <_panic>
+
+0080108b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80108b:	55                   	push   %ebp
+  80108c:	89 e5                	mov    %esp,%ebp
+  80108e:	57                   	push   %edi
+  80108f:	56                   	push   %esi
+  801090:	53                   	push   %ebx
+  801091:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801094:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80109a:	76 1d                	jbe    8010b9 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80109c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010a7:	be 01 00 00 00       	mov    $0x1,%esi
+  8010ac:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010af:	cd 30                	int    $0x30
+}
+  8010b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b4:	5b                   	pop    %ebx
+  8010b5:	5e                   	pop    %esi
+  8010b6:	5f                   	pop    %edi
+  8010b7:	5d                   	pop    %ebp
+  8010b8:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8010b9:	68 00 10 00 00       	push   $0x1000
+  8010be:	53                   	push   %ebx
+  8010bf:	e8 2c fb ff ff       	call   800bf0 <touch_mem>
+  8010c4:	83 c4 08             	add    $0x8,%esp
+  8010c7:	eb d3                	jmp    80109c <sys_ipc_send+0x11>
+
+008010c9 <sys_ipc_send_pages>:
+{
+  8010c9:	55                   	push   %ebp
+  8010ca:	89 e5                	mov    %esp,%ebp
+  8010cc:	57                   	push   %edi
+  8010cd:	56                   	push   %esi
+  8010ce:	53                   	push   %ebx
+  8010cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d2:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8010d5:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010db:	76 18                	jbe    8010f5 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8010dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010e8:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8010eb:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8010ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f0:	5b                   	pop    %ebx
+  8010f1:	5e                   	pop    %esi
+  8010f2:	5f                   	pop    %edi
+  8010f3:	5d                   	pop    %ebp
+  8010f4:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8010f5:	89 f0                	mov    %esi,%eax
+  8010f7:	c1 e0 0c             	shl    $0xc,%eax
+  8010fa:	50                   	push   %eax
+  8010fb:	53                   	push   %ebx
+  8010fc:	e8 ef fa ff ff       	call   800bf0 <touch_mem>
+  801101:	83 c4 08             	add    $0x8,%esp
+  801104:	eb d7                	jmp    8010dd <sys_ipc_send_pages+0x14>
+
+00801106 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801106:	55                   	push   %ebp
+  801107:	89 e5                	mov    %esp,%ebp
+  801109:	57                   	push   %edi
+  80110a:	56                   	push   %esi
+  80110b:	53                   	push   %ebx
+  80110c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80110f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801114:	8b 55 08             	mov    0x8(%ebp),%edx
+  801117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80111f:	89 df                	mov    %ebx,%edi
+  801121:	89 de                	mov    %ebx,%esi
+  801123:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801125:	85 c0                	test   %eax,%eax
+  801127:	7f 08                	jg     801131 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801129:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112c:	5b                   	pop    %ebx
+  80112d:	5e                   	pop    %esi
+  80112e:	5f                   	pop    %edi
+  80112f:	5d                   	pop    %ebp
+  801130:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801131:	83 ec 0c             	sub    $0xc,%esp
+  801134:	50                   	push   %eax
+  801135:	6a 0d                	push   $0xd
+  801137:	68 eb 50 80 00       	push   $0x8050eb
+  80113c:	6a 23                	push   $0x23
+  80113e:	68 08 51 80 00       	push   $0x805108
+  801143:	e8 e6 ef ff ff       	call   80012e <_panic>
+
+00801148 <sys_ipc_recv>:
+{
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80114e:	6a 01                	push   $0x1
+  801150:	ff 75 08             	push   0x8(%ebp)
+  801153:	e8 ae ff ff ff       	call   801106 <sys_ipc_recv_pages>
+}
+  801158:	c9                   	leave
+  801159:	c3                   	ret
+
+0080115a <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80115a:	55                   	push   %ebp
+  80115b:	89 e5                	mov    %esp,%ebp
+  80115d:	57                   	push   %edi
+  80115e:	56                   	push   %esi
+  80115f:	53                   	push   %ebx
+  801160:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801163:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801166:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801169:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80116f:	77 04                	ja     801175 <sys_ipc_call+0x1b>
+  801171:	85 f6                	test   %esi,%esi
+  801173:	75 15                	jne    80118a <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801175:	8b 55 08             	mov    0x8(%ebp),%edx
+  801178:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801180:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801182:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801185:	5b                   	pop    %ebx
+  801186:	5e                   	pop    %esi
+  801187:	5f                   	pop    %edi
+  801188:	5d                   	pop    %ebp
+  801189:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80118a:	89 f8                	mov    %edi,%eax
+  80118c:	c1 e0 0c             	shl    $0xc,%eax
+  80118f:	50                   	push   %eax
+  801190:	53                   	push   %ebx
+  801191:	e8 5a fa ff ff       	call   800bf0 <touch_mem>
+  801196:	83 c4 08             	add    $0x8,%esp
+  801199:	eb da                	jmp    801175 <sys_ipc_call+0x1b>
+
+0080119b <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80119b:	55                   	push   %ebp
+  80119c:	89 e5                	mov    %esp,%ebp
+  80119e:	57                   	push   %edi
+  80119f:	56                   	push   %esi
+  8011a0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011af:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011b2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011b5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8011b7:	5b                   	pop    %ebx
+  8011b8:	5e                   	pop    %esi
+  8011b9:	5f                   	pop    %edi
+  8011ba:	5d                   	pop    %ebp
+  8011bb:	c3                   	ret
+
+008011bc <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	57                   	push   %edi
+  8011c0:	56                   	push   %esi
+  8011c1:	53                   	push   %ebx
+  8011c2:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8011c5:	6a 04                	push   $0x4
+  8011c7:	ff 75 08             	push   0x8(%ebp)
+  8011ca:	e8 21 fa ff ff       	call   800bf0 <touch_mem>
+	asm volatile("int %1\n"
+  8011cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d7:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e2:	89 f7                	mov    %esi,%edi
+  8011e4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011e6:	83 c4 08             	add    $0x8,%esp
+  8011e9:	85 c0                	test   %eax,%eax
+  8011eb:	7f 08                	jg     8011f5 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8011ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f0:	5b                   	pop    %ebx
+  8011f1:	5e                   	pop    %esi
+  8011f2:	5f                   	pop    %edi
+  8011f3:	5d                   	pop    %ebp
+  8011f4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f5:	83 ec 0c             	sub    $0xc,%esp
+  8011f8:	50                   	push   %eax
+  8011f9:	6a 16                	push   $0x16
+  8011fb:	68 eb 50 80 00       	push   $0x8050eb
+  801200:	6a 23                	push   $0x23
+  801202:	68 08 51 80 00       	push   $0x805108
+  801207:	e8 22 ef ff ff       	call   80012e <_panic>
+
+0080120c <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80120c:	55                   	push   %ebp
+  80120d:	89 e5                	mov    %esp,%ebp
+  80120f:	57                   	push   %edi
+  801210:	56                   	push   %esi
+  801211:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801212:	6a 04                	push   $0x4
+  801214:	ff 75 08             	push   0x8(%ebp)
+  801217:	e8 d4 f9 ff ff       	call   800bf0 <touch_mem>
+	asm volatile("int %1\n"
+  80121c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801221:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801224:	b8 17 00 00 00       	mov    $0x17,%eax
+  801229:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122c:	89 df                	mov    %ebx,%edi
+  80122e:	89 de                	mov    %ebx,%esi
+  801230:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801232:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801235:	5b                   	pop    %ebx
+  801236:	5e                   	pop    %esi
+  801237:	5f                   	pop    %edi
+  801238:	5d                   	pop    %ebp
+  801239:	c3                   	ret
+
+0080123a <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80123a:	55                   	push   %ebp
+  80123b:	89 e5                	mov    %esp,%ebp
+  80123d:	57                   	push   %edi
+  80123e:	56                   	push   %esi
+  80123f:	53                   	push   %ebx
+  801240:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801243:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801248:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801250:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801255:	89 df                	mov    %ebx,%edi
+  801257:	89 de                	mov    %ebx,%esi
+  801259:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80125b:	85 c0                	test   %eax,%eax
+  80125d:	7f 08                	jg     801267 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80125f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801262:	5b                   	pop    %ebx
+  801263:	5e                   	pop    %esi
+  801264:	5f                   	pop    %edi
+  801265:	5d                   	pop    %ebp
+  801266:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801267:	83 ec 0c             	sub    $0xc,%esp
+  80126a:	50                   	push   %eax
+  80126b:	6a 0e                	push   $0xe
+  80126d:	68 eb 50 80 00       	push   $0x8050eb
+  801272:	6a 23                	push   $0x23
+  801274:	68 08 51 80 00       	push   $0x805108
+  801279:	e8 b0 ee ff ff       	call   80012e <_panic>
+
+0080127e <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  80127e:	55                   	push   %ebp
+  80127f:	89 e5                	mov    %esp,%ebp
+  801281:	56                   	push   %esi
+  801282:	53                   	push   %ebx
+  801283:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  801286:	a1 00 70 80 00       	mov    0x807000,%eax
+  80128b:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  80128e:	85 db                	test   %ebx,%ebx
+  801290:	78 17                	js     8012a9 <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  801292:	83 ec 0c             	sub    $0xc,%esp
+  801295:	56                   	push   %esi
+  801296:	ff 14 9d 20 e9 80 00 	call   *0x80e920(,%ebx,4)
+  80129d:	83 c4 10             	add    $0x10,%esp
+  8012a0:	85 c0                	test   %eax,%eax
+  8012a2:	75 27                	jne    8012cb <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8012a4:	83 eb 01             	sub    $0x1,%ebx
+  8012a7:	eb e5                	jmp    80128e <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  8012a9:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8012ae:	8b 40 48             	mov    0x48(%eax),%eax
+  8012b1:	83 ec 08             	sub    $0x8,%esp
+  8012b4:	ff 76 28             	push   0x28(%esi)
+  8012b7:	ff 36                	push   (%esi)
+  8012b9:	50                   	push   %eax
+  8012ba:	68 18 51 80 00       	push   $0x805118
+  8012bf:	6a 1d                	push   $0x1d
+  8012c1:	68 3b 51 80 00       	push   $0x80513b
+  8012c6:	e8 63 ee ff ff       	call   80012e <_panic>
+}
+  8012cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012ce:	5b                   	pop    %ebx
+  8012cf:	5e                   	pop    %esi
+  8012d0:	5d                   	pop    %ebp
+  8012d1:	c3                   	ret
+
+008012d2 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8012d2:	55                   	push   %ebp
+  8012d3:	89 e5                	mov    %esp,%ebp
+  8012d5:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  8012d8:	83 3d 48 e9 80 00 00 	cmpl   $0x0,0x80e948
+  8012df:	74 0a                	je     8012eb <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8012e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012e4:	a3 48 e9 80 00       	mov    %eax,0x80e948
+}
+  8012e9:	c9                   	leave
+  8012ea:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  8012eb:	83 ec 04             	sub    $0x4,%esp
+  8012ee:	6a 07                	push   $0x7
+  8012f0:	68 00 f0 bf ee       	push   $0xeebff000
+  8012f5:	6a 00                	push   $0x0
+  8012f7:	e8 e7 f9 ff ff       	call   800ce3 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8012fc:	83 c4 08             	add    $0x8,%esp
+  8012ff:	68 72 13 80 00       	push   $0x801372
+  801304:	6a 00                	push   $0x0
+  801306:	e8 3e fd ff ff       	call   801049 <sys_env_set_pgfault_upcall>
+  80130b:	83 c4 10             	add    $0x10,%esp
+  80130e:	eb d1                	jmp    8012e1 <set_pgfault_handler+0xf>
+
+00801310 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  801310:	55                   	push   %ebp
+  801311:	89 e5                	mov    %esp,%ebp
+  801313:	83 ec 08             	sub    $0x8,%esp
+  801316:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  801319:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  80131f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801324:	eb 03                	jmp    801329 <add_pgfault_handler+0x19>
+  801326:	83 c0 01             	add    $0x1,%eax
+  801329:	39 d0                	cmp    %edx,%eax
+  80132b:	74 0b                	je     801338 <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  80132d:	39 0c 85 20 e9 80 00 	cmp    %ecx,0x80e920(,%eax,4)
+  801334:	75 f0                	jne    801326 <add_pgfault_handler+0x16>
+  801336:	eb 24                	jmp    80135c <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  801338:	83 fa 0a             	cmp    $0xa,%edx
+  80133b:	74 21                	je     80135e <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  80133d:	8d 42 01             	lea    0x1(%edx),%eax
+  801340:	a3 00 70 80 00       	mov    %eax,0x807000
+  801345:	89 0c 95 20 e9 80 00 	mov    %ecx,0x80e920(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  80134c:	83 ec 0c             	sub    $0xc,%esp
+  80134f:	68 7e 12 80 00       	push   $0x80127e
+  801354:	e8 79 ff ff ff       	call   8012d2 <set_pgfault_handler>
+  801359:	83 c4 10             	add    $0x10,%esp
+}
+  80135c:	c9                   	leave
+  80135d:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  80135e:	83 ec 04             	sub    $0x4,%esp
+  801361:	68 49 51 80 00       	push   $0x805149
+  801366:	6a 44                	push   $0x44
+  801368:	68 3b 51 80 00       	push   $0x80513b
+  80136d:	e8 bc ed ff ff       	call   80012e <_panic>
+
+00801372 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801372:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801373:	a1 48 e9 80 00       	mov    0x80e948,%eax
+	call *%eax
+  801378:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80137a:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  80137d:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  801381:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  801385:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  801388:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  80138a:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  80138e:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  801391:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  801392:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  801395:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  801396:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  801397:	c3                   	ret
+
+00801398 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801398:	55                   	push   %ebp
+  801399:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80139b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80139e:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013a3:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013a6:	5d                   	pop    %ebp
+  8013a7:	c3                   	ret
+
+008013a8 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013a8:	55                   	push   %ebp
+  8013a9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013ae:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8013b3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8013b8:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013bd:	5d                   	pop    %ebp
+  8013be:	c3                   	ret
+
+008013bf <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013bf:	55                   	push   %ebp
+  8013c0:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8013c2:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8013c7:	a8 01                	test   $0x1,%al
+  8013c9:	74 3c                	je     801407 <fd_alloc+0x48>
+  8013cb:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013d0:	89 c2                	mov    %eax,%edx
+  8013d2:	c1 ea 0c             	shr    $0xc,%edx
+  8013d5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013dc:	89 c1                	mov    %eax,%ecx
+  8013de:	05 00 10 00 00       	add    $0x1000,%eax
+  8013e3:	f6 c2 01             	test   $0x1,%dl
+  8013e6:	74 13                	je     8013fb <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8013e8:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8013ed:	75 e1                	jne    8013d0 <fd_alloc+0x11>
+  8013ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8013f4:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8013f9:	eb 05                	jmp    801400 <fd_alloc+0x41>
+			return 0;
+  8013fb:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801400:	8b 55 08             	mov    0x8(%ebp),%edx
+  801403:	89 0a                	mov    %ecx,(%edx)
+}
+  801405:	5d                   	pop    %ebp
+  801406:	c3                   	ret
+  801407:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  80140c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801411:	eb ed                	jmp    801400 <fd_alloc+0x41>
+
+00801413 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801413:	55                   	push   %ebp
+  801414:	89 e5                	mov    %esp,%ebp
+  801416:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801419:	83 f8 1f             	cmp    $0x1f,%eax
+  80141c:	77 30                	ja     80144e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80141e:	c1 e0 0c             	shl    $0xc,%eax
+  801421:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801426:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80142c:	f6 c2 01             	test   $0x1,%dl
+  80142f:	74 24                	je     801455 <fd_lookup+0x42>
+  801431:	89 c2                	mov    %eax,%edx
+  801433:	c1 ea 0c             	shr    $0xc,%edx
+  801436:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80143d:	f6 c2 01             	test   $0x1,%dl
+  801440:	74 1a                	je     80145c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801442:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801445:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801447:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80144c:	5d                   	pop    %ebp
+  80144d:	c3                   	ret
+		return -E_INVAL;
+  80144e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801453:	eb f7                	jmp    80144c <fd_lookup+0x39>
+		return -E_INVAL;
+  801455:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80145a:	eb f0                	jmp    80144c <fd_lookup+0x39>
+  80145c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801461:	eb e9                	jmp    80144c <fd_lookup+0x39>
+
+00801463 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801463:	55                   	push   %ebp
+  801464:	89 e5                	mov    %esp,%ebp
+  801466:	53                   	push   %ebx
+  801467:	83 ec 04             	sub    $0x4,%esp
+  80146a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80146d:	b8 e0 51 80 00       	mov    $0x8051e0,%eax
+  801472:	8b 18                	mov    (%eax),%ebx
+  801474:	85 db                	test   %ebx,%ebx
+  801476:	74 0e                	je     801486 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801478:	83 c0 04             	add    $0x4,%eax
+  80147b:	39 13                	cmp    %edx,(%ebx)
+  80147d:	75 f3                	jne    801472 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  80147f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801484:	eb 1f                	jmp    8014a5 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801486:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  80148b:	8b 40 48             	mov    0x48(%eax),%eax
+  80148e:	83 ec 04             	sub    $0x4,%esp
+  801491:	52                   	push   %edx
+  801492:	50                   	push   %eax
+  801493:	68 64 51 80 00       	push   $0x805164
+  801498:	e8 6c ed ff ff       	call   800209 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80149d:	83 c4 10             	add    $0x10,%esp
+  8014a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8014a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014a8:	89 1a                	mov    %ebx,(%edx)
+}
+  8014aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014ad:	c9                   	leave
+  8014ae:	c3                   	ret
+
+008014af <fd_close>:
+{
+  8014af:	55                   	push   %ebp
+  8014b0:	89 e5                	mov    %esp,%ebp
+  8014b2:	57                   	push   %edi
+  8014b3:	56                   	push   %esi
+  8014b4:	53                   	push   %ebx
+  8014b5:	83 ec 24             	sub    $0x24,%esp
+  8014b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014bb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014be:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014c1:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014c2:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014c8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014cb:	50                   	push   %eax
+  8014cc:	e8 42 ff ff ff       	call   801413 <fd_lookup>
+  8014d1:	89 c3                	mov    %eax,%ebx
+  8014d3:	83 c4 10             	add    $0x10,%esp
+  8014d6:	85 c0                	test   %eax,%eax
+  8014d8:	78 05                	js     8014df <fd_close+0x30>
+	    || fd != fd2)
+  8014da:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8014dd:	74 16                	je     8014f5 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8014df:	89 f8                	mov    %edi,%eax
+  8014e1:	84 c0                	test   %al,%al
+  8014e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e8:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014eb:	89 d8                	mov    %ebx,%eax
+  8014ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f0:	5b                   	pop    %ebx
+  8014f1:	5e                   	pop    %esi
+  8014f2:	5f                   	pop    %edi
+  8014f3:	5d                   	pop    %ebp
+  8014f4:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014f5:	83 ec 08             	sub    $0x8,%esp
+  8014f8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014fb:	50                   	push   %eax
+  8014fc:	ff 36                	push   (%esi)
+  8014fe:	e8 60 ff ff ff       	call   801463 <dev_lookup>
+  801503:	89 c3                	mov    %eax,%ebx
+  801505:	83 c4 10             	add    $0x10,%esp
+  801508:	85 c0                	test   %eax,%eax
+  80150a:	78 1a                	js     801526 <fd_close+0x77>
+		if (dev->dev_close)
+  80150c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80150f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801512:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801517:	85 c0                	test   %eax,%eax
+  801519:	74 0b                	je     801526 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80151b:	83 ec 0c             	sub    $0xc,%esp
+  80151e:	56                   	push   %esi
+  80151f:	ff d0                	call   *%eax
+  801521:	89 c3                	mov    %eax,%ebx
+  801523:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801526:	83 ec 08             	sub    $0x8,%esp
+  801529:	56                   	push   %esi
+  80152a:	6a 00                	push   $0x0
+  80152c:	e8 37 f8 ff ff       	call   800d68 <sys_page_unmap>
+	return r;
+  801531:	83 c4 10             	add    $0x10,%esp
+  801534:	eb b5                	jmp    8014eb <fd_close+0x3c>
+
+00801536 <close>:
+
+int
+close(int fdnum)
+{
+  801536:	55                   	push   %ebp
+  801537:	89 e5                	mov    %esp,%ebp
+  801539:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80153c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80153f:	50                   	push   %eax
+  801540:	ff 75 08             	push   0x8(%ebp)
+  801543:	e8 cb fe ff ff       	call   801413 <fd_lookup>
+  801548:	83 c4 10             	add    $0x10,%esp
+  80154b:	85 c0                	test   %eax,%eax
+  80154d:	79 02                	jns    801551 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80154f:	c9                   	leave
+  801550:	c3                   	ret
+		return fd_close(fd, 1);
+  801551:	83 ec 08             	sub    $0x8,%esp
+  801554:	6a 01                	push   $0x1
+  801556:	ff 75 f4             	push   -0xc(%ebp)
+  801559:	e8 51 ff ff ff       	call   8014af <fd_close>
+  80155e:	83 c4 10             	add    $0x10,%esp
+  801561:	eb ec                	jmp    80154f <close+0x19>
+
+00801563 <close_all>:
+
+void
+close_all(void)
+{
+  801563:	55                   	push   %ebp
+  801564:	89 e5                	mov    %esp,%ebp
+  801566:	53                   	push   %ebx
+  801567:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80156a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80156f:	83 ec 0c             	sub    $0xc,%esp
+  801572:	53                   	push   %ebx
+  801573:	e8 be ff ff ff       	call   801536 <close>
+	for (i = 0; i < MAXFD; i++)
+  801578:	83 c3 01             	add    $0x1,%ebx
+  80157b:	83 c4 10             	add    $0x10,%esp
+  80157e:	83 fb 20             	cmp    $0x20,%ebx
+  801581:	75 ec                	jne    80156f <close_all+0xc>
+}
+  801583:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801586:	c9                   	leave
+  801587:	c3                   	ret
+
+00801588 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801588:	55                   	push   %ebp
+  801589:	89 e5                	mov    %esp,%ebp
+  80158b:	57                   	push   %edi
+  80158c:	56                   	push   %esi
+  80158d:	53                   	push   %ebx
+  80158e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801591:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801594:	50                   	push   %eax
+  801595:	ff 75 08             	push   0x8(%ebp)
+  801598:	e8 76 fe ff ff       	call   801413 <fd_lookup>
+  80159d:	89 c3                	mov    %eax,%ebx
+  80159f:	83 c4 10             	add    $0x10,%esp
+  8015a2:	85 c0                	test   %eax,%eax
+  8015a4:	78 7f                	js     801625 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8015a6:	83 ec 0c             	sub    $0xc,%esp
+  8015a9:	ff 75 0c             	push   0xc(%ebp)
+  8015ac:	e8 85 ff ff ff       	call   801536 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8015b1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8015b4:	c1 e6 0c             	shl    $0xc,%esi
+  8015b7:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8015bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015c0:	89 3c 24             	mov    %edi,(%esp)
+  8015c3:	e8 e0 fd ff ff       	call   8013a8 <fd2data>
+  8015c8:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8015ca:	89 34 24             	mov    %esi,(%esp)
+  8015cd:	e8 d6 fd ff ff       	call   8013a8 <fd2data>
+  8015d2:	83 c4 10             	add    $0x10,%esp
+  8015d5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8015d8:	89 d8                	mov    %ebx,%eax
+  8015da:	c1 e8 16             	shr    $0x16,%eax
+  8015dd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015e4:	a8 01                	test   $0x1,%al
+  8015e6:	74 11                	je     8015f9 <dup+0x71>
+  8015e8:	89 d8                	mov    %ebx,%eax
+  8015ea:	c1 e8 0c             	shr    $0xc,%eax
+  8015ed:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015f4:	f6 c2 01             	test   $0x1,%dl
+  8015f7:	75 36                	jne    80162f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015f9:	89 f8                	mov    %edi,%eax
+  8015fb:	c1 e8 0c             	shr    $0xc,%eax
+  8015fe:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801605:	83 ec 0c             	sub    $0xc,%esp
+  801608:	25 07 0e 00 00       	and    $0xe07,%eax
+  80160d:	50                   	push   %eax
+  80160e:	56                   	push   %esi
+  80160f:	6a 00                	push   $0x0
+  801611:	57                   	push   %edi
+  801612:	6a 00                	push   $0x0
+  801614:	e8 0d f7 ff ff       	call   800d26 <sys_page_map>
+  801619:	89 c3                	mov    %eax,%ebx
+  80161b:	83 c4 20             	add    $0x20,%esp
+  80161e:	85 c0                	test   %eax,%eax
+  801620:	78 33                	js     801655 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801622:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801625:	89 d8                	mov    %ebx,%eax
+  801627:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80162a:	5b                   	pop    %ebx
+  80162b:	5e                   	pop    %esi
+  80162c:	5f                   	pop    %edi
+  80162d:	5d                   	pop    %ebp
+  80162e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80162f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801636:	83 ec 0c             	sub    $0xc,%esp
+  801639:	25 07 0e 00 00       	and    $0xe07,%eax
+  80163e:	50                   	push   %eax
+  80163f:	ff 75 d4             	push   -0x2c(%ebp)
+  801642:	6a 00                	push   $0x0
+  801644:	53                   	push   %ebx
+  801645:	6a 00                	push   $0x0
+  801647:	e8 da f6 ff ff       	call   800d26 <sys_page_map>
+  80164c:	89 c3                	mov    %eax,%ebx
+  80164e:	83 c4 20             	add    $0x20,%esp
+  801651:	85 c0                	test   %eax,%eax
+  801653:	79 a4                	jns    8015f9 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801655:	83 ec 08             	sub    $0x8,%esp
+  801658:	56                   	push   %esi
+  801659:	6a 00                	push   $0x0
+  80165b:	e8 08 f7 ff ff       	call   800d68 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801660:	83 c4 08             	add    $0x8,%esp
+  801663:	ff 75 d4             	push   -0x2c(%ebp)
+  801666:	6a 00                	push   $0x0
+  801668:	e8 fb f6 ff ff       	call   800d68 <sys_page_unmap>
+	return r;
+  80166d:	83 c4 10             	add    $0x10,%esp
+  801670:	eb b3                	jmp    801625 <dup+0x9d>
+
+00801672 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801672:	55                   	push   %ebp
+  801673:	89 e5                	mov    %esp,%ebp
+  801675:	56                   	push   %esi
+  801676:	53                   	push   %ebx
+  801677:	83 ec 18             	sub    $0x18,%esp
+  80167a:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80167d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801680:	50                   	push   %eax
+  801681:	56                   	push   %esi
+  801682:	e8 8c fd ff ff       	call   801413 <fd_lookup>
+  801687:	83 c4 10             	add    $0x10,%esp
+  80168a:	85 c0                	test   %eax,%eax
+  80168c:	78 3c                	js     8016ca <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80168e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801691:	83 ec 08             	sub    $0x8,%esp
+  801694:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801697:	50                   	push   %eax
+  801698:	ff 33                	push   (%ebx)
+  80169a:	e8 c4 fd ff ff       	call   801463 <dev_lookup>
+  80169f:	83 c4 10             	add    $0x10,%esp
+  8016a2:	85 c0                	test   %eax,%eax
+  8016a4:	78 24                	js     8016ca <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016a6:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016a9:	83 e0 03             	and    $0x3,%eax
+  8016ac:	83 f8 01             	cmp    $0x1,%eax
+  8016af:	74 20                	je     8016d1 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8016b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b4:	8b 40 08             	mov    0x8(%eax),%eax
+  8016b7:	85 c0                	test   %eax,%eax
+  8016b9:	74 37                	je     8016f2 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8016bb:	83 ec 04             	sub    $0x4,%esp
+  8016be:	ff 75 10             	push   0x10(%ebp)
+  8016c1:	ff 75 0c             	push   0xc(%ebp)
+  8016c4:	53                   	push   %ebx
+  8016c5:	ff d0                	call   *%eax
+  8016c7:	83 c4 10             	add    $0x10,%esp
+}
+  8016ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016cd:	5b                   	pop    %ebx
+  8016ce:	5e                   	pop    %esi
+  8016cf:	5d                   	pop    %ebp
+  8016d0:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016d1:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8016d6:	8b 40 48             	mov    0x48(%eax),%eax
+  8016d9:	83 ec 04             	sub    $0x4,%esp
+  8016dc:	56                   	push   %esi
+  8016dd:	50                   	push   %eax
+  8016de:	68 a5 51 80 00       	push   $0x8051a5
+  8016e3:	e8 21 eb ff ff       	call   800209 <cprintf>
+		return -E_INVAL;
+  8016e8:	83 c4 10             	add    $0x10,%esp
+  8016eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016f0:	eb d8                	jmp    8016ca <read+0x58>
+		return -E_NOT_SUPP;
+  8016f2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016f7:	eb d1                	jmp    8016ca <read+0x58>
+
+008016f9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016f9:	55                   	push   %ebp
+  8016fa:	89 e5                	mov    %esp,%ebp
+  8016fc:	57                   	push   %edi
+  8016fd:	56                   	push   %esi
+  8016fe:	53                   	push   %ebx
+  8016ff:	83 ec 0c             	sub    $0xc,%esp
+  801702:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801705:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801708:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170d:	eb 02                	jmp    801711 <readn+0x18>
+  80170f:	01 c3                	add    %eax,%ebx
+  801711:	39 f3                	cmp    %esi,%ebx
+  801713:	73 21                	jae    801736 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801715:	83 ec 04             	sub    $0x4,%esp
+  801718:	89 f0                	mov    %esi,%eax
+  80171a:	29 d8                	sub    %ebx,%eax
+  80171c:	50                   	push   %eax
+  80171d:	89 d8                	mov    %ebx,%eax
+  80171f:	03 45 0c             	add    0xc(%ebp),%eax
+  801722:	50                   	push   %eax
+  801723:	57                   	push   %edi
+  801724:	e8 49 ff ff ff       	call   801672 <read>
+		if (m < 0)
+  801729:	83 c4 10             	add    $0x10,%esp
+  80172c:	85 c0                	test   %eax,%eax
+  80172e:	78 04                	js     801734 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801730:	75 dd                	jne    80170f <readn+0x16>
+  801732:	eb 02                	jmp    801736 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801734:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801736:	89 d8                	mov    %ebx,%eax
+  801738:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80173b:	5b                   	pop    %ebx
+  80173c:	5e                   	pop    %esi
+  80173d:	5f                   	pop    %edi
+  80173e:	5d                   	pop    %ebp
+  80173f:	c3                   	ret
+
+00801740 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801740:	55                   	push   %ebp
+  801741:	89 e5                	mov    %esp,%ebp
+  801743:	56                   	push   %esi
+  801744:	53                   	push   %ebx
+  801745:	83 ec 18             	sub    $0x18,%esp
+  801748:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80174b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80174e:	50                   	push   %eax
+  80174f:	53                   	push   %ebx
+  801750:	e8 be fc ff ff       	call   801413 <fd_lookup>
+  801755:	83 c4 10             	add    $0x10,%esp
+  801758:	85 c0                	test   %eax,%eax
+  80175a:	78 37                	js     801793 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80175c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80175f:	83 ec 08             	sub    $0x8,%esp
+  801762:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801765:	50                   	push   %eax
+  801766:	ff 36                	push   (%esi)
+  801768:	e8 f6 fc ff ff       	call   801463 <dev_lookup>
+  80176d:	83 c4 10             	add    $0x10,%esp
+  801770:	85 c0                	test   %eax,%eax
+  801772:	78 1f                	js     801793 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801774:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801778:	74 20                	je     80179a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80177a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80177d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801780:	85 c0                	test   %eax,%eax
+  801782:	74 37                	je     8017bb <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801784:	83 ec 04             	sub    $0x4,%esp
+  801787:	ff 75 10             	push   0x10(%ebp)
+  80178a:	ff 75 0c             	push   0xc(%ebp)
+  80178d:	56                   	push   %esi
+  80178e:	ff d0                	call   *%eax
+  801790:	83 c4 10             	add    $0x10,%esp
+}
+  801793:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801796:	5b                   	pop    %ebx
+  801797:	5e                   	pop    %esi
+  801798:	5d                   	pop    %ebp
+  801799:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80179a:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  80179f:	8b 40 48             	mov    0x48(%eax),%eax
+  8017a2:	83 ec 04             	sub    $0x4,%esp
+  8017a5:	53                   	push   %ebx
+  8017a6:	50                   	push   %eax
+  8017a7:	68 c1 51 80 00       	push   $0x8051c1
+  8017ac:	e8 58 ea ff ff       	call   800209 <cprintf>
+		return -E_INVAL;
+  8017b1:	83 c4 10             	add    $0x10,%esp
+  8017b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b9:	eb d8                	jmp    801793 <write+0x53>
+		return -E_NOT_SUPP;
+  8017bb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017c0:	eb d1                	jmp    801793 <write+0x53>
+
+008017c2 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017c2:	55                   	push   %ebp
+  8017c3:	89 e5                	mov    %esp,%ebp
+  8017c5:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017cb:	50                   	push   %eax
+  8017cc:	ff 75 08             	push   0x8(%ebp)
+  8017cf:	e8 3f fc ff ff       	call   801413 <fd_lookup>
+  8017d4:	83 c4 10             	add    $0x10,%esp
+  8017d7:	85 c0                	test   %eax,%eax
+  8017d9:	78 0e                	js     8017e9 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8017db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017e1:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8017e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017e9:	c9                   	leave
+  8017ea:	c3                   	ret
+
+008017eb <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017eb:	55                   	push   %ebp
+  8017ec:	89 e5                	mov    %esp,%ebp
+  8017ee:	56                   	push   %esi
+  8017ef:	53                   	push   %ebx
+  8017f0:	83 ec 18             	sub    $0x18,%esp
+  8017f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017f6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017f9:	50                   	push   %eax
+  8017fa:	53                   	push   %ebx
+  8017fb:	e8 13 fc ff ff       	call   801413 <fd_lookup>
+  801800:	83 c4 10             	add    $0x10,%esp
+  801803:	85 c0                	test   %eax,%eax
+  801805:	78 34                	js     80183b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801807:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80180a:	83 ec 08             	sub    $0x8,%esp
+  80180d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801810:	50                   	push   %eax
+  801811:	ff 36                	push   (%esi)
+  801813:	e8 4b fc ff ff       	call   801463 <dev_lookup>
+  801818:	83 c4 10             	add    $0x10,%esp
+  80181b:	85 c0                	test   %eax,%eax
+  80181d:	78 1c                	js     80183b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80181f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801823:	74 1d                	je     801842 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801825:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801828:	8b 40 18             	mov    0x18(%eax),%eax
+  80182b:	85 c0                	test   %eax,%eax
+  80182d:	74 34                	je     801863 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80182f:	83 ec 08             	sub    $0x8,%esp
+  801832:	ff 75 0c             	push   0xc(%ebp)
+  801835:	56                   	push   %esi
+  801836:	ff d0                	call   *%eax
+  801838:	83 c4 10             	add    $0x10,%esp
+}
+  80183b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80183e:	5b                   	pop    %ebx
+  80183f:	5e                   	pop    %esi
+  801840:	5d                   	pop    %ebp
+  801841:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801842:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  801847:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80184a:	83 ec 04             	sub    $0x4,%esp
+  80184d:	53                   	push   %ebx
+  80184e:	50                   	push   %eax
+  80184f:	68 84 51 80 00       	push   $0x805184
+  801854:	e8 b0 e9 ff ff       	call   800209 <cprintf>
+		return -E_INVAL;
+  801859:	83 c4 10             	add    $0x10,%esp
+  80185c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801861:	eb d8                	jmp    80183b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801863:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801868:	eb d1                	jmp    80183b <ftruncate+0x50>
+
+0080186a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80186a:	55                   	push   %ebp
+  80186b:	89 e5                	mov    %esp,%ebp
+  80186d:	56                   	push   %esi
+  80186e:	53                   	push   %ebx
+  80186f:	83 ec 18             	sub    $0x18,%esp
+  801872:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801875:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801878:	50                   	push   %eax
+  801879:	ff 75 08             	push   0x8(%ebp)
+  80187c:	e8 92 fb ff ff       	call   801413 <fd_lookup>
+  801881:	83 c4 10             	add    $0x10,%esp
+  801884:	85 c0                	test   %eax,%eax
+  801886:	78 49                	js     8018d1 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801888:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80188b:	83 ec 08             	sub    $0x8,%esp
+  80188e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801891:	50                   	push   %eax
+  801892:	ff 36                	push   (%esi)
+  801894:	e8 ca fb ff ff       	call   801463 <dev_lookup>
+  801899:	83 c4 10             	add    $0x10,%esp
+  80189c:	85 c0                	test   %eax,%eax
+  80189e:	78 31                	js     8018d1 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8018a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018a3:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018a7:	74 2f                	je     8018d8 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8018a9:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8018ac:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8018b3:	00 00 00 
+	stat->st_isdir = 0;
+  8018b6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018bd:	00 00 00 
+	stat->st_dev = dev;
+  8018c0:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8018c6:	83 ec 08             	sub    $0x8,%esp
+  8018c9:	53                   	push   %ebx
+  8018ca:	56                   	push   %esi
+  8018cb:	ff 50 14             	call   *0x14(%eax)
+  8018ce:	83 c4 10             	add    $0x10,%esp
+}
+  8018d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018d4:	5b                   	pop    %ebx
+  8018d5:	5e                   	pop    %esi
+  8018d6:	5d                   	pop    %ebp
+  8018d7:	c3                   	ret
+		return -E_NOT_SUPP;
+  8018d8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018dd:	eb f2                	jmp    8018d1 <fstat+0x67>
+
+008018df <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018df:	55                   	push   %ebp
+  8018e0:	89 e5                	mov    %esp,%ebp
+  8018e2:	56                   	push   %esi
+  8018e3:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8018e4:	83 ec 08             	sub    $0x8,%esp
+  8018e7:	6a 00                	push   $0x0
+  8018e9:	ff 75 08             	push   0x8(%ebp)
+  8018ec:	e8 bc 02 00 00       	call   801bad <open>
+  8018f1:	89 c3                	mov    %eax,%ebx
+  8018f3:	83 c4 10             	add    $0x10,%esp
+  8018f6:	85 c0                	test   %eax,%eax
+  8018f8:	78 1b                	js     801915 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8018fa:	83 ec 08             	sub    $0x8,%esp
+  8018fd:	ff 75 0c             	push   0xc(%ebp)
+  801900:	50                   	push   %eax
+  801901:	e8 64 ff ff ff       	call   80186a <fstat>
+  801906:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801908:	89 1c 24             	mov    %ebx,(%esp)
+  80190b:	e8 26 fc ff ff       	call   801536 <close>
+	return r;
+  801910:	83 c4 10             	add    $0x10,%esp
+  801913:	89 f3                	mov    %esi,%ebx
+}
+  801915:	89 d8                	mov    %ebx,%eax
+  801917:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80191a:	5b                   	pop    %ebx
+  80191b:	5e                   	pop    %esi
+  80191c:	5d                   	pop    %ebp
+  80191d:	c3                   	ret
+
+0080191e <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  80191e:	55                   	push   %ebp
+  80191f:	89 e5                	mov    %esp,%ebp
+  801921:	57                   	push   %edi
+  801922:	56                   	push   %esi
+  801923:	53                   	push   %ebx
+  801924:	83 ec 0c             	sub    $0xc,%esp
+  801927:	89 c7                	mov    %eax,%edi
+  801929:	89 d3                	mov    %edx,%ebx
+  80192b:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80192d:	83 3d 04 70 80 00 00 	cmpl   $0x0,0x807004
+  801934:	74 2d                	je     801963 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801936:	6a 07                	push   $0x7
+  801938:	68 00 f0 80 00       	push   $0x80f000
+  80193d:	57                   	push   %edi
+  80193e:	ff 35 04 70 80 00    	push   0x807004
+  801944:	e8 34 30 00 00       	call   80497d <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801949:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801950:	6a 00                	push   $0x0
+  801952:	56                   	push   %esi
+  801953:	53                   	push   %ebx
+  801954:	6a 00                	push   $0x0
+  801956:	e8 d4 2e 00 00       	call   80482f <ipc_recv_pages>
+}
+  80195b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80195e:	5b                   	pop    %ebx
+  80195f:	5e                   	pop    %esi
+  801960:	5f                   	pop    %edi
+  801961:	5d                   	pop    %ebp
+  801962:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801963:	83 ec 0c             	sub    $0xc,%esp
+  801966:	6a 01                	push   $0x1
+  801968:	e8 05 31 00 00       	call   804a72 <ipc_find_env>
+  80196d:	a3 04 70 80 00       	mov    %eax,0x807004
+  801972:	83 c4 10             	add    $0x10,%esp
+  801975:	eb bf                	jmp    801936 <fsipc_pages+0x18>
+
+00801977 <fsipc>:
+{
+  801977:	55                   	push   %ebp
+  801978:	89 e5                	mov    %esp,%ebp
+  80197a:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  80197d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801982:	e8 97 ff ff ff       	call   80191e <fsipc_pages>
+}
+  801987:	c9                   	leave
+  801988:	c3                   	ret
+
+00801989 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801989:	55                   	push   %ebp
+  80198a:	89 e5                	mov    %esp,%ebp
+  80198c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80198f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801992:	8b 40 0c             	mov    0xc(%eax),%eax
+  801995:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  80199a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80199d:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8019a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a7:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019ac:	e8 c6 ff ff ff       	call   801977 <fsipc>
+}
+  8019b1:	c9                   	leave
+  8019b2:	c3                   	ret
+
+008019b3 <devfile_flush>:
+{
+  8019b3:	55                   	push   %ebp
+  8019b4:	89 e5                	mov    %esp,%ebp
+  8019b6:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019bc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019bf:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8019c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019c9:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019ce:	e8 a4 ff ff ff       	call   801977 <fsipc>
+}
+  8019d3:	c9                   	leave
+  8019d4:	c3                   	ret
+
+008019d5 <devfile_stat>:
+{
+  8019d5:	55                   	push   %ebp
+  8019d6:	89 e5                	mov    %esp,%ebp
+  8019d8:	53                   	push   %ebx
+  8019d9:	83 ec 04             	sub    $0x4,%esp
+  8019dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019e2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019e5:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ef:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019f4:	e8 7e ff ff ff       	call   801977 <fsipc>
+  8019f9:	85 c0                	test   %eax,%eax
+  8019fb:	78 2c                	js     801a29 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019fd:	83 ec 08             	sub    $0x8,%esp
+  801a00:	68 00 f0 80 00       	push   $0x80f000
+  801a05:	53                   	push   %ebx
+  801a06:	e8 e5 ed ff ff       	call   8007f0 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801a0b:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  801a10:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a16:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  801a1b:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801a21:	83 c4 10             	add    $0x10,%esp
+  801a24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a2c:	c9                   	leave
+  801a2d:	c3                   	ret
+
+00801a2e <devfile_write>:
+{
+  801a2e:	55                   	push   %ebp
+  801a2f:	89 e5                	mov    %esp,%ebp
+  801a31:	83 ec 0c             	sub    $0xc,%esp
+  801a34:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801a37:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a3c:	39 d0                	cmp    %edx,%eax
+  801a3e:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a41:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a44:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a47:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  801a4d:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801a52:	50                   	push   %eax
+  801a53:	ff 75 0c             	push   0xc(%ebp)
+  801a56:	68 08 f0 80 00       	push   $0x80f008
+  801a5b:	e8 16 ef ff ff       	call   800976 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801a60:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a65:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a6a:	e8 08 ff ff ff       	call   801977 <fsipc>
+}
+  801a6f:	c9                   	leave
+  801a70:	c3                   	ret
+
+00801a71 <devfile_read>:
+{
+  801a71:	55                   	push   %ebp
+  801a72:	89 e5                	mov    %esp,%ebp
+  801a74:	57                   	push   %edi
+  801a75:	56                   	push   %esi
+  801a76:	53                   	push   %ebx
+  801a77:	83 ec 1c             	sub    $0x1c,%esp
+  801a7a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a7d:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a80:	89 fe                	mov    %edi,%esi
+  801a82:	c1 ee 0c             	shr    $0xc,%esi
+  801a85:	b8 20 00 00 00       	mov    $0x20,%eax
+  801a8a:	39 c6                	cmp    %eax,%esi
+  801a8c:	0f 47 f0             	cmova  %eax,%esi
+  801a8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a92:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a97:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801a9a:	eb 14                	jmp    801ab0 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a9c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801aa3:	05 00 10 00 00       	add    $0x1000,%eax
+  801aa8:	f6 c6 06             	test   $0x6,%dh
+  801aab:	75 42                	jne    801aef <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801aad:	83 c1 01             	add    $0x1,%ecx
+  801ab0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801ab3:	39 f1                	cmp    %esi,%ecx
+  801ab5:	0f 84 95 00 00 00    	je     801b50 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801abb:	89 c2                	mov    %eax,%edx
+  801abd:	c1 ea 16             	shr    $0x16,%edx
+  801ac0:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801ac7:	f6 c2 01             	test   $0x1,%dl
+  801aca:	74 23                	je     801aef <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801acc:	89 c2                	mov    %eax,%edx
+  801ace:	c1 ea 0c             	shr    $0xc,%edx
+  801ad1:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801ad8:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801ade:	74 0f                	je     801aef <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801ae0:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801ae7:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801aed:	75 ad                	jne    801a9c <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801aef:	85 c9                	test   %ecx,%ecx
+  801af1:	74 11                	je     801b04 <devfile_read+0x93>
+  801af3:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801afa:	75 08                	jne    801b04 <devfile_read+0x93>
+  801afc:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801b02:	74 50                	je     801b54 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b04:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b07:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  801b0c:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b12:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b17:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b1c:	e8 56 fe ff ff       	call   801977 <fsipc>
+  801b21:	89 c6                	mov    %eax,%esi
+  801b23:	85 c0                	test   %eax,%eax
+  801b25:	78 1f                	js     801b46 <devfile_read+0xd5>
+	assert(r <= n);
+  801b27:	39 c7                	cmp    %eax,%edi
+  801b29:	72 50                	jb     801b7b <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801b2b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b30:	7f 62                	jg     801b94 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801b32:	83 ec 04             	sub    $0x4,%esp
+  801b35:	50                   	push   %eax
+  801b36:	68 00 f0 80 00       	push   $0x80f000
+  801b3b:	ff 75 0c             	push   0xc(%ebp)
+  801b3e:	e8 33 ee ff ff       	call   800976 <memmove>
+	return r;
+  801b43:	83 c4 10             	add    $0x10,%esp
+}
+  801b46:	89 f0                	mov    %esi,%eax
+  801b48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b4b:	5b                   	pop    %ebx
+  801b4c:	5e                   	pop    %esi
+  801b4d:	5f                   	pop    %edi
+  801b4e:	5d                   	pop    %ebp
+  801b4f:	c3                   	ret
+  801b50:	89 f1                	mov    %esi,%ecx
+  801b52:	eb 9b                	jmp    801aef <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801b54:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b57:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801b5c:	89 c8                	mov    %ecx,%eax
+  801b5e:	c1 e0 0c             	shl    $0xc,%eax
+  801b61:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801b66:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b69:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801b6e:	e8 ab fd ff ff       	call   80191e <fsipc_pages>
+  801b73:	89 c6                	mov    %eax,%esi
+  801b75:	85 c0                	test   %eax,%eax
+  801b77:	78 8b                	js     801b04 <devfile_read+0x93>
+  801b79:	eb cb                	jmp    801b46 <devfile_read+0xd5>
+	assert(r <= n);
+  801b7b:	68 f0 51 80 00       	push   $0x8051f0
+  801b80:	68 f7 51 80 00       	push   $0x8051f7
+  801b85:	68 a0 00 00 00       	push   $0xa0
+  801b8a:	68 0c 52 80 00       	push   $0x80520c
+  801b8f:	e8 9a e5 ff ff       	call   80012e <_panic>
+	assert(r <= PGSIZE);
+  801b94:	68 17 52 80 00       	push   $0x805217
+  801b99:	68 f7 51 80 00       	push   $0x8051f7
+  801b9e:	68 a1 00 00 00       	push   $0xa1
+  801ba3:	68 0c 52 80 00       	push   $0x80520c
+  801ba8:	e8 81 e5 ff ff       	call   80012e <_panic>
+
+00801bad <open>:
+{
+  801bad:	55                   	push   %ebp
+  801bae:	89 e5                	mov    %esp,%ebp
+  801bb0:	56                   	push   %esi
+  801bb1:	53                   	push   %ebx
+  801bb2:	83 ec 1c             	sub    $0x1c,%esp
+  801bb5:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801bb8:	56                   	push   %esi
+  801bb9:	e8 f7 eb ff ff       	call   8007b5 <strlen>
+  801bbe:	83 c4 10             	add    $0x10,%esp
+  801bc1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bc6:	7f 6c                	jg     801c34 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801bc8:	83 ec 0c             	sub    $0xc,%esp
+  801bcb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bce:	50                   	push   %eax
+  801bcf:	e8 eb f7 ff ff       	call   8013bf <fd_alloc>
+  801bd4:	89 c3                	mov    %eax,%ebx
+  801bd6:	83 c4 10             	add    $0x10,%esp
+  801bd9:	85 c0                	test   %eax,%eax
+  801bdb:	78 3c                	js     801c19 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801bdd:	83 ec 08             	sub    $0x8,%esp
+  801be0:	56                   	push   %esi
+  801be1:	68 00 f0 80 00       	push   $0x80f000
+  801be6:	e8 05 ec ff ff       	call   8007f0 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801beb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bee:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bf3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801bf6:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bfb:	e8 77 fd ff ff       	call   801977 <fsipc>
+  801c00:	89 c3                	mov    %eax,%ebx
+  801c02:	83 c4 10             	add    $0x10,%esp
+  801c05:	85 c0                	test   %eax,%eax
+  801c07:	78 19                	js     801c22 <open+0x75>
+	return fd2num(fd);
+  801c09:	83 ec 0c             	sub    $0xc,%esp
+  801c0c:	ff 75 f4             	push   -0xc(%ebp)
+  801c0f:	e8 84 f7 ff ff       	call   801398 <fd2num>
+  801c14:	89 c3                	mov    %eax,%ebx
+  801c16:	83 c4 10             	add    $0x10,%esp
+}
+  801c19:	89 d8                	mov    %ebx,%eax
+  801c1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c1e:	5b                   	pop    %ebx
+  801c1f:	5e                   	pop    %esi
+  801c20:	5d                   	pop    %ebp
+  801c21:	c3                   	ret
+		fd_close(fd, 0);
+  801c22:	83 ec 08             	sub    $0x8,%esp
+  801c25:	6a 00                	push   $0x0
+  801c27:	ff 75 f4             	push   -0xc(%ebp)
+  801c2a:	e8 80 f8 ff ff       	call   8014af <fd_close>
+		return r;
+  801c2f:	83 c4 10             	add    $0x10,%esp
+  801c32:	eb e5                	jmp    801c19 <open+0x6c>
+		return -E_BAD_PATH;
+  801c34:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c39:	eb de                	jmp    801c19 <open+0x6c>
+
+00801c3b <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801c3b:	55                   	push   %ebp
+  801c3c:	89 e5                	mov    %esp,%ebp
+  801c3e:	53                   	push   %ebx
+  801c3f:	83 ec 10             	sub    $0x10,%esp
+  801c42:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801c45:	53                   	push   %ebx
+  801c46:	e8 6a eb ff ff       	call   8007b5 <strlen>
+  801c4b:	83 c4 10             	add    $0x10,%esp
+  801c4e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c53:	7f 25                	jg     801c7a <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801c55:	83 ec 08             	sub    $0x8,%esp
+  801c58:	53                   	push   %ebx
+  801c59:	68 00 f0 80 00       	push   $0x80f000
+  801c5e:	e8 8d eb ff ff       	call   8007f0 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801c63:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c68:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c6d:	e8 05 fd ff ff       	call   801977 <fsipc>
+  801c72:	83 c4 10             	add    $0x10,%esp
+}
+  801c75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c78:	c9                   	leave
+  801c79:	c3                   	ret
+		return -E_BAD_PATH;
+  801c7a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801c7f:	eb f4                	jmp    801c75 <remove+0x3a>
+
+00801c81 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c81:	55                   	push   %ebp
+  801c82:	89 e5                	mov    %esp,%ebp
+  801c84:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c87:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c8c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c91:	e8 e1 fc ff ff       	call   801977 <fsipc>
+}
+  801c96:	c9                   	leave
+  801c97:	c3                   	ret
+
+00801c98 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801c98:	55                   	push   %ebp
+  801c99:	89 e5                	mov    %esp,%ebp
+  801c9b:	53                   	push   %ebx
+  801c9c:	83 ec 04             	sub    $0x4,%esp
+  801c9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801ca2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ca7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801cac:	e8 c6 fc ff ff       	call   801977 <fsipc>
+  801cb1:	85 c0                	test   %eax,%eax
+  801cb3:	78 3c                	js     801cf1 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801cb5:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  801cba:	89 03                	mov    %eax,(%ebx)
+  801cbc:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  801cc1:	89 43 04             	mov    %eax,0x4(%ebx)
+  801cc4:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  801cc9:	89 43 08             	mov    %eax,0x8(%ebx)
+  801ccc:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  801cd1:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801cd4:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  801cd9:	89 43 10             	mov    %eax,0x10(%ebx)
+  801cdc:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  801ce1:	89 43 14             	mov    %eax,0x14(%ebx)
+  801ce4:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  801ce9:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801cec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cf1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cf4:	c9                   	leave
+  801cf5:	c3                   	ret
+
+00801cf6 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801cf6:	55                   	push   %ebp
+  801cf7:	89 e5                	mov    %esp,%ebp
+  801cf9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801cfc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cff:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  801d04:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d09:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801d0e:	e8 64 fc ff ff       	call   801977 <fsipc>
+}
+  801d13:	c9                   	leave
+  801d14:	c3                   	ret
+
+00801d15 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d15:	55                   	push   %ebp
+  801d16:	89 e5                	mov    %esp,%ebp
+  801d18:	56                   	push   %esi
+  801d19:	53                   	push   %ebx
+  801d1a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801d1d:	83 ec 0c             	sub    $0xc,%esp
+  801d20:	ff 75 08             	push   0x8(%ebp)
+  801d23:	e8 80 f6 ff ff       	call   8013a8 <fd2data>
+  801d28:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801d2a:	83 c4 08             	add    $0x8,%esp
+  801d2d:	68 23 52 80 00       	push   $0x805223
+  801d32:	53                   	push   %ebx
+  801d33:	e8 b8 ea ff ff       	call   8007f0 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801d38:	8b 46 04             	mov    0x4(%esi),%eax
+  801d3b:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801d41:	2b 0e                	sub    (%esi),%ecx
+  801d43:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801d48:	89 c8                	mov    %ecx,%eax
+  801d4a:	f7 e2                	mul    %edx
+  801d4c:	c1 ea 0c             	shr    $0xc,%edx
+  801d4f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801d55:	29 d1                	sub    %edx,%ecx
+  801d57:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801d5d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d64:	00 00 00 
+	stat->st_dev = &devpipe;
+  801d67:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  801d6e:	60 80 00 
+	return 0;
+}
+  801d71:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d79:	5b                   	pop    %ebx
+  801d7a:	5e                   	pop    %esi
+  801d7b:	5d                   	pop    %ebp
+  801d7c:	c3                   	ret
+
+00801d7d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801d7d:	55                   	push   %ebp
+  801d7e:	89 e5                	mov    %esp,%ebp
+  801d80:	53                   	push   %ebx
+  801d81:	83 ec 0c             	sub    $0xc,%esp
+  801d84:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801d87:	53                   	push   %ebx
+  801d88:	6a 00                	push   $0x0
+  801d8a:	e8 d9 ef ff ff       	call   800d68 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801d8f:	89 1c 24             	mov    %ebx,(%esp)
+  801d92:	e8 11 f6 ff ff       	call   8013a8 <fd2data>
+  801d97:	83 c4 08             	add    $0x8,%esp
+  801d9a:	50                   	push   %eax
+  801d9b:	6a 00                	push   $0x0
+  801d9d:	e8 c6 ef ff ff       	call   800d68 <sys_page_unmap>
+}
+  801da2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801da5:	c9                   	leave
+  801da6:	c3                   	ret
+
+00801da7 <_pipeisclosed>:
+{
+  801da7:	55                   	push   %ebp
+  801da8:	89 e5                	mov    %esp,%ebp
+  801daa:	57                   	push   %edi
+  801dab:	56                   	push   %esi
+  801dac:	53                   	push   %ebx
+  801dad:	83 ec 1c             	sub    $0x1c,%esp
+  801db0:	89 c7                	mov    %eax,%edi
+  801db2:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801db4:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  801db9:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801dbc:	83 ec 0c             	sub    $0xc,%esp
+  801dbf:	57                   	push   %edi
+  801dc0:	e8 ec 2c 00 00       	call   804ab1 <pageref>
+  801dc5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801dc8:	89 34 24             	mov    %esi,(%esp)
+  801dcb:	e8 e1 2c 00 00       	call   804ab1 <pageref>
+		nn = thisenv->env_runs;
+  801dd0:	8b 15 14 e9 80 00    	mov    0x80e914,%edx
+  801dd6:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801dd9:	83 c4 10             	add    $0x10,%esp
+  801ddc:	39 cb                	cmp    %ecx,%ebx
+  801dde:	74 1b                	je     801dfb <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801de0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801de3:	75 cf                	jne    801db4 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801de5:	8b 42 58             	mov    0x58(%edx),%eax
+  801de8:	6a 01                	push   $0x1
+  801dea:	50                   	push   %eax
+  801deb:	53                   	push   %ebx
+  801dec:	68 2a 52 80 00       	push   $0x80522a
+  801df1:	e8 13 e4 ff ff       	call   800209 <cprintf>
+  801df6:	83 c4 10             	add    $0x10,%esp
+  801df9:	eb b9                	jmp    801db4 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801dfb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801dfe:	0f 94 c0             	sete   %al
+  801e01:	0f b6 c0             	movzbl %al,%eax
+}
+  801e04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e07:	5b                   	pop    %ebx
+  801e08:	5e                   	pop    %esi
+  801e09:	5f                   	pop    %edi
+  801e0a:	5d                   	pop    %ebp
+  801e0b:	c3                   	ret
+
+00801e0c <devpipe_read>:
+{
+  801e0c:	55                   	push   %ebp
+  801e0d:	89 e5                	mov    %esp,%ebp
+  801e0f:	57                   	push   %edi
+  801e10:	56                   	push   %esi
+  801e11:	53                   	push   %ebx
+  801e12:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801e15:	ff 75 08             	push   0x8(%ebp)
+  801e18:	e8 8b f5 ff ff       	call   8013a8 <fd2data>
+  801e1d:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801e1f:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801e22:	8d 40 04             	lea    0x4(%eax),%eax
+  801e25:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801e28:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801e2b:	8b 0b                	mov    (%ebx),%ecx
+  801e2d:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801e33:	29 ce                	sub    %ecx,%esi
+  801e35:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e3a:	f7 e6                	mul    %esi
+  801e3c:	c1 ea 0c             	shr    $0xc,%edx
+  801e3f:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801e45:	29 c6                	sub    %eax,%esi
+  801e47:	89 f2                	mov    %esi,%edx
+  801e49:	75 43                	jne    801e8e <devpipe_read+0x82>
+		ref = pageref(p);
+  801e4b:	83 ec 0c             	sub    $0xc,%esp
+  801e4e:	53                   	push   %ebx
+  801e4f:	e8 5d 2c 00 00       	call   804ab1 <pageref>
+  801e54:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801e56:	89 da                	mov    %ebx,%edx
+  801e58:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e5b:	e8 47 ff ff ff       	call   801da7 <_pipeisclosed>
+  801e60:	83 c4 10             	add    $0x10,%esp
+  801e63:	85 c0                	test   %eax,%eax
+  801e65:	0f 85 c1 00 00 00    	jne    801f2c <devpipe_read+0x120>
+	*sleeping = 1;
+  801e6b:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801e72:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801e77:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801e7a:	75 ac                	jne    801e28 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801e7c:	83 ec 04             	sub    $0x4,%esp
+  801e7f:	56                   	push   %esi
+  801e80:	57                   	push   %edi
+  801e81:	ff 75 e4             	push   -0x1c(%ebp)
+  801e84:	e8 33 f3 ff ff       	call   8011bc <sys_futex_wait>
+  801e89:	83 c4 10             	add    $0x10,%esp
+  801e8c:	eb 9a                	jmp    801e28 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801e8e:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801e91:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801e95:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801e97:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e9c:	f7 e1                	mul    %ecx
+  801e9e:	c1 ea 0b             	shr    $0xb,%edx
+  801ea1:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801ea7:	29 c1                	sub    %eax,%ecx
+  801ea9:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801eab:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801eb0:	29 cf                	sub    %ecx,%edi
+  801eb2:	39 f7                	cmp    %esi,%edi
+  801eb4:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801eb7:	8d 43 10             	lea    0x10(%ebx),%eax
+  801eba:	83 ec 04             	sub    $0x4,%esp
+  801ebd:	57                   	push   %edi
+  801ebe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ec1:	01 c2                	add    %eax,%edx
+  801ec3:	52                   	push   %edx
+  801ec4:	ff 75 0c             	push   0xc(%ebp)
+  801ec7:	e8 aa ea ff ff       	call   800976 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801ecc:	83 c4 0c             	add    $0xc,%esp
+  801ecf:	89 f1                	mov    %esi,%ecx
+  801ed1:	29 f9                	sub    %edi,%ecx
+  801ed3:	51                   	push   %ecx
+  801ed4:	ff 75 e4             	push   -0x1c(%ebp)
+  801ed7:	89 f8                	mov    %edi,%eax
+  801ed9:	03 45 0c             	add    0xc(%ebp),%eax
+  801edc:	50                   	push   %eax
+  801edd:	e8 94 ea ff ff       	call   800976 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801ee2:	89 f1                	mov    %esi,%ecx
+  801ee4:	03 0b                	add    (%ebx),%ecx
+  801ee6:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801eeb:	f7 e1                	mul    %ecx
+  801eed:	c1 ea 0c             	shr    $0xc,%edx
+  801ef0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801ef6:	29 d1                	sub    %edx,%ecx
+  801ef8:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801efa:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801eff:	83 c4 10             	add    $0x10,%esp
+  801f02:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801f06:	75 0a                	jne    801f12 <devpipe_read+0x106>
+	return n;
+  801f08:	89 f0                	mov    %esi,%eax
+}
+  801f0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f0d:	5b                   	pop    %ebx
+  801f0e:	5e                   	pop    %esi
+  801f0f:	5f                   	pop    %edi
+  801f10:	5d                   	pop    %ebp
+  801f11:	c3                   	ret
+		*sleeping = 0;
+  801f12:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801f19:	83 ec 08             	sub    $0x8,%esp
+  801f1c:	68 00 04 00 00       	push   $0x400
+  801f21:	53                   	push   %ebx
+  801f22:	e8 e5 f2 ff ff       	call   80120c <sys_futex_wake>
+  801f27:	83 c4 10             	add    $0x10,%esp
+  801f2a:	eb dc                	jmp    801f08 <devpipe_read+0xfc>
+			return 0;
+  801f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f31:	eb d7                	jmp    801f0a <devpipe_read+0xfe>
+
+00801f33 <devpipe_write>:
+{
+  801f33:	55                   	push   %ebp
+  801f34:	89 e5                	mov    %esp,%ebp
+  801f36:	57                   	push   %edi
+  801f37:	56                   	push   %esi
+  801f38:	53                   	push   %ebx
+  801f39:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801f3c:	ff 75 08             	push   0x8(%ebp)
+  801f3f:	e8 64 f4 ff ff       	call   8013a8 <fd2data>
+  801f44:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801f46:	83 c4 10             	add    $0x10,%esp
+  801f49:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801f50:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f53:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801f56:	0f 83 23 01 00 00    	jae    80207f <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801f5c:	8b 77 04             	mov    0x4(%edi),%esi
+  801f5f:	8b 1f                	mov    (%edi),%ebx
+  801f61:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801f67:	29 d9                	sub    %ebx,%ecx
+  801f69:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f6e:	f7 e1                	mul    %ecx
+  801f70:	c1 ea 0c             	shr    $0xc,%edx
+  801f73:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801f79:	29 c1                	sub    %eax,%ecx
+  801f7b:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801f7d:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801f83:	75 40                	jne    801fc5 <devpipe_write+0x92>
+			ref = pageref(p);
+  801f85:	83 ec 0c             	sub    $0xc,%esp
+  801f88:	57                   	push   %edi
+  801f89:	e8 23 2b 00 00       	call   804ab1 <pageref>
+  801f8e:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801f90:	89 fa                	mov    %edi,%edx
+  801f92:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f95:	e8 0d fe ff ff       	call   801da7 <_pipeisclosed>
+  801f9a:	83 c4 10             	add    $0x10,%esp
+  801f9d:	85 c0                	test   %eax,%eax
+  801f9f:	0f 85 d5 00 00 00    	jne    80207a <devpipe_write+0x147>
+	*sleeping = 1;
+  801fa5:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801fac:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801fb1:	39 1f                	cmp    %ebx,(%edi)
+  801fb3:	75 a7                	jne    801f5c <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801fb5:	83 ec 04             	sub    $0x4,%esp
+  801fb8:	56                   	push   %esi
+  801fb9:	53                   	push   %ebx
+  801fba:	57                   	push   %edi
+  801fbb:	e8 fc f1 ff ff       	call   8011bc <sys_futex_wait>
+  801fc0:	83 c4 10             	add    $0x10,%esp
+  801fc3:	eb 97                	jmp    801f5c <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801fc5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801fc8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fcb:	29 c1                	sub    %eax,%ecx
+  801fcd:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801fd2:	89 d8                	mov    %ebx,%eax
+  801fd4:	29 d0                	sub    %edx,%eax
+  801fd6:	39 c1                	cmp    %eax,%ecx
+  801fd8:	0f 46 c1             	cmovbe %ecx,%eax
+  801fdb:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801fdd:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801fe2:	f7 e6                	mul    %esi
+  801fe4:	c1 ea 0b             	shr    $0xb,%edx
+  801fe7:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801fed:	29 c6                	sub    %eax,%esi
+  801fef:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801ff1:	29 f3                	sub    %esi,%ebx
+  801ff3:	39 cb                	cmp    %ecx,%ebx
+  801ff5:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801ff8:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801ffb:	8d 77 10             	lea    0x10(%edi),%esi
+  801ffe:	83 ec 04             	sub    $0x4,%esp
+  802001:	53                   	push   %ebx
+  802002:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802005:	03 45 0c             	add    0xc(%ebp),%eax
+  802008:	50                   	push   %eax
+  802009:	01 f2                	add    %esi,%edx
+  80200b:	52                   	push   %edx
+  80200c:	e8 65 e9 ff ff       	call   800976 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802011:	83 c4 0c             	add    $0xc,%esp
+  802014:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802017:	29 d8                	sub    %ebx,%eax
+  802019:	50                   	push   %eax
+  80201a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80201d:	01 d3                	add    %edx,%ebx
+  80201f:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802022:	53                   	push   %ebx
+  802023:	56                   	push   %esi
+  802024:	e8 4d e9 ff ff       	call   800976 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802029:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80202c:	03 4f 04             	add    0x4(%edi),%ecx
+  80202f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802034:	f7 e1                	mul    %ecx
+  802036:	c1 ea 0c             	shr    $0xc,%edx
+  802039:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80203f:	29 d1                	sub    %edx,%ecx
+  802041:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  802044:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802049:	83 c4 10             	add    $0x10,%esp
+  80204c:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802050:	75 0b                	jne    80205d <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802052:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  802055:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802058:	e9 f3 fe ff ff       	jmp    801f50 <devpipe_write+0x1d>
+		*sleeping = 0;
+  80205d:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  802064:	83 ec 08             	sub    $0x8,%esp
+  802067:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  80206c:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  80206f:	50                   	push   %eax
+  802070:	e8 97 f1 ff ff       	call   80120c <sys_futex_wake>
+  802075:	83 c4 10             	add    $0x10,%esp
+  802078:	eb d8                	jmp    802052 <devpipe_write+0x11f>
+				return 0;
+  80207a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80207f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802082:	5b                   	pop    %ebx
+  802083:	5e                   	pop    %esi
+  802084:	5f                   	pop    %edi
+  802085:	5d                   	pop    %ebp
+  802086:	c3                   	ret
+
+00802087 <pipe>:
+{
+  802087:	55                   	push   %ebp
+  802088:	89 e5                	mov    %esp,%ebp
+  80208a:	56                   	push   %esi
+  80208b:	53                   	push   %ebx
+  80208c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80208f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802092:	50                   	push   %eax
+  802093:	e8 27 f3 ff ff       	call   8013bf <fd_alloc>
+  802098:	89 c3                	mov    %eax,%ebx
+  80209a:	83 c4 10             	add    $0x10,%esp
+  80209d:	85 c0                	test   %eax,%eax
+  80209f:	0f 88 23 01 00 00    	js     8021c8 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020a5:	83 ec 04             	sub    $0x4,%esp
+  8020a8:	68 07 04 00 00       	push   $0x407
+  8020ad:	ff 75 f4             	push   -0xc(%ebp)
+  8020b0:	6a 00                	push   $0x0
+  8020b2:	e8 2c ec ff ff       	call   800ce3 <sys_page_alloc>
+  8020b7:	89 c3                	mov    %eax,%ebx
+  8020b9:	83 c4 10             	add    $0x10,%esp
+  8020bc:	85 c0                	test   %eax,%eax
+  8020be:	0f 88 04 01 00 00    	js     8021c8 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8020c4:	83 ec 0c             	sub    $0xc,%esp
+  8020c7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020ca:	50                   	push   %eax
+  8020cb:	e8 ef f2 ff ff       	call   8013bf <fd_alloc>
+  8020d0:	89 c3                	mov    %eax,%ebx
+  8020d2:	83 c4 10             	add    $0x10,%esp
+  8020d5:	85 c0                	test   %eax,%eax
+  8020d7:	0f 88 db 00 00 00    	js     8021b8 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020dd:	83 ec 04             	sub    $0x4,%esp
+  8020e0:	68 07 04 00 00       	push   $0x407
+  8020e5:	ff 75 f0             	push   -0x10(%ebp)
+  8020e8:	6a 00                	push   $0x0
+  8020ea:	e8 f4 eb ff ff       	call   800ce3 <sys_page_alloc>
+  8020ef:	89 c3                	mov    %eax,%ebx
+  8020f1:	83 c4 10             	add    $0x10,%esp
+  8020f4:	85 c0                	test   %eax,%eax
+  8020f6:	0f 88 bc 00 00 00    	js     8021b8 <pipe+0x131>
+	va = fd2data(fd0);
+  8020fc:	83 ec 0c             	sub    $0xc,%esp
+  8020ff:	ff 75 f4             	push   -0xc(%ebp)
+  802102:	e8 a1 f2 ff ff       	call   8013a8 <fd2data>
+  802107:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802109:	83 c4 0c             	add    $0xc,%esp
+  80210c:	68 07 04 00 00       	push   $0x407
+  802111:	50                   	push   %eax
+  802112:	6a 00                	push   $0x0
+  802114:	e8 ca eb ff ff       	call   800ce3 <sys_page_alloc>
+  802119:	89 c3                	mov    %eax,%ebx
+  80211b:	83 c4 10             	add    $0x10,%esp
+  80211e:	85 c0                	test   %eax,%eax
+  802120:	0f 88 82 00 00 00    	js     8021a8 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802126:	83 ec 0c             	sub    $0xc,%esp
+  802129:	ff 75 f0             	push   -0x10(%ebp)
+  80212c:	e8 77 f2 ff ff       	call   8013a8 <fd2data>
+  802131:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802138:	50                   	push   %eax
+  802139:	6a 00                	push   $0x0
+  80213b:	56                   	push   %esi
+  80213c:	6a 00                	push   $0x0
+  80213e:	e8 e3 eb ff ff       	call   800d26 <sys_page_map>
+  802143:	89 c3                	mov    %eax,%ebx
+  802145:	83 c4 20             	add    $0x20,%esp
+  802148:	85 c0                	test   %eax,%eax
+  80214a:	78 4e                	js     80219a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80214c:	a1 20 60 80 00       	mov    0x806020,%eax
+  802151:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802154:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802156:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802159:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802160:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802163:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802165:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802168:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80216f:	83 ec 0c             	sub    $0xc,%esp
+  802172:	ff 75 f4             	push   -0xc(%ebp)
+  802175:	e8 1e f2 ff ff       	call   801398 <fd2num>
+  80217a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80217d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80217f:	83 c4 04             	add    $0x4,%esp
+  802182:	ff 75 f0             	push   -0x10(%ebp)
+  802185:	e8 0e f2 ff ff       	call   801398 <fd2num>
+  80218a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80218d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802190:	83 c4 10             	add    $0x10,%esp
+  802193:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802198:	eb 2e                	jmp    8021c8 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80219a:	83 ec 08             	sub    $0x8,%esp
+  80219d:	56                   	push   %esi
+  80219e:	6a 00                	push   $0x0
+  8021a0:	e8 c3 eb ff ff       	call   800d68 <sys_page_unmap>
+  8021a5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8021a8:	83 ec 08             	sub    $0x8,%esp
+  8021ab:	ff 75 f0             	push   -0x10(%ebp)
+  8021ae:	6a 00                	push   $0x0
+  8021b0:	e8 b3 eb ff ff       	call   800d68 <sys_page_unmap>
+  8021b5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8021b8:	83 ec 08             	sub    $0x8,%esp
+  8021bb:	ff 75 f4             	push   -0xc(%ebp)
+  8021be:	6a 00                	push   $0x0
+  8021c0:	e8 a3 eb ff ff       	call   800d68 <sys_page_unmap>
+  8021c5:	83 c4 10             	add    $0x10,%esp
+}
+  8021c8:	89 d8                	mov    %ebx,%eax
+  8021ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021cd:	5b                   	pop    %ebx
+  8021ce:	5e                   	pop    %esi
+  8021cf:	5d                   	pop    %ebp
+  8021d0:	c3                   	ret
+
+008021d1 <pipeisclosed>:
+{
+  8021d1:	55                   	push   %ebp
+  8021d2:	89 e5                	mov    %esp,%ebp
+  8021d4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021da:	50                   	push   %eax
+  8021db:	ff 75 08             	push   0x8(%ebp)
+  8021de:	e8 30 f2 ff ff       	call   801413 <fd_lookup>
+  8021e3:	83 c4 10             	add    $0x10,%esp
+  8021e6:	85 c0                	test   %eax,%eax
+  8021e8:	78 18                	js     802202 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8021ea:	83 ec 0c             	sub    $0xc,%esp
+  8021ed:	ff 75 f4             	push   -0xc(%ebp)
+  8021f0:	e8 b3 f1 ff ff       	call   8013a8 <fd2data>
+  8021f5:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8021f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021fa:	e8 a8 fb ff ff       	call   801da7 <_pipeisclosed>
+  8021ff:	83 c4 10             	add    $0x10,%esp
+}
+  802202:	c9                   	leave
+  802203:	c3                   	ret
+
+00802204 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802204:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802206:	8b 15 14 e9 80 00    	mov    0x80e914,%edx
+  80220c:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802212:	81 c2 34 01 00 00    	add    $0x134,%edx
+  802218:	39 d0                	cmp    %edx,%eax
+  80221a:	74 2e                	je     80224a <segment_lookup+0x46>
+{
+  80221c:	55                   	push   %ebp
+  80221d:	89 e5                	mov    %esp,%ebp
+  80221f:	57                   	push   %edi
+  802220:	56                   	push   %esi
+  802221:	53                   	push   %ebx
+  802222:	eb 07                	jmp    80222b <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802224:	83 c0 20             	add    $0x20,%eax
+  802227:	39 d0                	cmp    %edx,%eax
+  802229:	74 15                	je     802240 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  80222b:	8b 18                	mov    (%eax),%ebx
+  80222d:	39 d9                	cmp    %ebx,%ecx
+  80222f:	72 f3                	jb     802224 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  802231:	8b 38                	mov    (%eax),%edi
+  802233:	8b 58 04             	mov    0x4(%eax),%ebx
+  802236:	89 ce                	mov    %ecx,%esi
+  802238:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  80223a:	39 de                	cmp    %ebx,%esi
+  80223c:	73 e6                	jae    802224 <segment_lookup+0x20>
+  80223e:	eb 05                	jmp    802245 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  802240:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802245:	5b                   	pop    %ebx
+  802246:	5e                   	pop    %esi
+  802247:	5f                   	pop    %edi
+  802248:	5d                   	pop    %ebp
+  802249:	c3                   	ret
+	return NULL;
+  80224a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80224f:	c3                   	ret
+
+00802250 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802250:	55                   	push   %ebp
+  802251:	89 e5                	mov    %esp,%ebp
+  802253:	53                   	push   %ebx
+  802254:	83 ec 04             	sub    $0x4,%esp
+  802257:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802259:	c1 e8 16             	shr    $0x16,%eax
+  80225c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802263:	25 81 00 00 00       	and    $0x81,%eax
+  802268:	83 f8 01             	cmp    $0x1,%eax
+  80226b:	75 6b                	jne    8022d8 <page_is_clean+0x88>
+  80226d:	89 da                	mov    %ebx,%edx
+  80226f:	c1 ea 0c             	shr    $0xc,%edx
+  802272:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  802279:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80227e:	f6 c1 01             	test   $0x1,%cl
+  802281:	74 5a                	je     8022dd <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802283:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80228a:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802290:	75 4b                	jne    8022dd <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  802292:	89 d8                	mov    %ebx,%eax
+  802294:	e8 6b ff ff ff       	call   802204 <segment_lookup>
+  802299:	89 c2                	mov    %eax,%edx
+		return 1;
+  80229b:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  8022a0:	85 d2                	test   %edx,%edx
+  8022a2:	75 39                	jne    8022dd <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  8022a4:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  8022aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022af:	eb 03                	jmp    8022b4 <page_is_clean+0x64>
+  8022b1:	83 c0 01             	add    $0x1,%eax
+  8022b4:	39 c2                	cmp    %eax,%edx
+  8022b6:	7e 19                	jle    8022d1 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  8022b8:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  8022bf:	72 f0                	jb     8022b1 <page_is_clean+0x61>
+  8022c1:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  8022c8:	73 e7                	jae    8022b1 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  8022ca:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022cf:	eb 0c                	jmp    8022dd <page_is_clean+0x8d>
+	return 0;
+  8022d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d6:	eb 05                	jmp    8022dd <page_is_clean+0x8d>
+		return 0;
+  8022d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022e0:	c9                   	leave
+  8022e1:	c3                   	ret
+
+008022e2 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  8022e2:	55                   	push   %ebp
+  8022e3:	89 e5                	mov    %esp,%ebp
+  8022e5:	57                   	push   %edi
+  8022e6:	56                   	push   %esi
+  8022e7:	53                   	push   %ebx
+  8022e8:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8022eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f0:	eb 19                	jmp    80230b <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8022f2:	f7 d3                	not    %ebx
+  8022f4:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8022fa:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8022fc:	83 c6 01             	add    $0x1,%esi
+  8022ff:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802305:	0f 87 97 00 00 00    	ja     8023a2 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80230b:	89 f3                	mov    %esi,%ebx
+  80230d:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  802313:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802319:	89 d8                	mov    %ebx,%eax
+  80231b:	c1 e8 0a             	shr    $0xa,%eax
+  80231e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802325:	25 81 00 00 00       	and    $0x81,%eax
+  80232a:	83 f8 01             	cmp    $0x1,%eax
+  80232d:	75 c3                	jne    8022f2 <linear_walk+0x10>
+  80232f:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802335:	77 bb                	ja     8022f2 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802337:	89 df                	mov    %ebx,%edi
+  802339:	c1 e7 0c             	shl    $0xc,%edi
+  80233c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80233f:	89 f8                	mov    %edi,%eax
+  802341:	e8 0a ff ff ff       	call   802250 <page_is_clean>
+  802346:	84 c0                	test   %al,%al
+  802348:	75 64                	jne    8023ae <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80234a:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802350:	77 aa                	ja     8022fc <linear_walk+0x1a>
+  802352:	81 ff 00 00 81 00    	cmp    $0x810000,%edi
+  802358:	72 a2                	jb     8022fc <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80235a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802361:	a8 01                	test   $0x1,%al
+  802363:	74 97                	je     8022fc <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802365:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80236c:	f6 c4 04             	test   $0x4,%ah
+  80236f:	75 8b                	jne    8022fc <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802371:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802378:	f6 c4 02             	test   $0x2,%ah
+  80237b:	0f 85 7b ff ff ff    	jne    8022fc <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802381:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802388:	c1 e8 0c             	shr    $0xc,%eax
+  80238b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80238e:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802393:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802397:	66 83 f8 01          	cmp    $0x1,%ax
+  80239b:	76 11                	jbe    8023ae <linear_walk+0xcc>
+  80239d:	e9 5a ff ff ff       	jmp    8022fc <linear_walk+0x1a>
+  8023a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  8023a7:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  8023ae:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  8023b4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023b7:	83 c4 1c             	add    $0x1c,%esp
+  8023ba:	5b                   	pop    %ebx
+  8023bb:	5e                   	pop    %esi
+  8023bc:	5f                   	pop    %edi
+  8023bd:	5d                   	pop    %ebp
+  8023be:	c3                   	ret
+
+008023bf <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  8023bf:	55                   	push   %ebp
+  8023c0:	89 e5                	mov    %esp,%ebp
+  8023c2:	56                   	push   %esi
+  8023c3:	53                   	push   %ebx
+  8023c4:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  8023c6:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023cb:	83 e0 7f             	and    $0x7f,%eax
+  8023ce:	c1 e0 04             	shl    $0x4,%eax
+  8023d1:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  8023d7:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  8023dd:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  8023e3:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  8023e9:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023ee:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  8023f1:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023f6:	83 c0 01             	add    $0x1,%eax
+  8023f9:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  8023fe:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802401:	5b                   	pop    %ebx
+  802402:	5e                   	pop    %esi
+  802403:	5d                   	pop    %ebp
+  802404:	c3                   	ret
+
+00802405 <page_ring_enter>:
+{
+  802405:	55                   	push   %ebp
+  802406:	89 e5                	mov    %esp,%ebp
+  802408:	57                   	push   %edi
+  802409:	56                   	push   %esi
+  80240a:	53                   	push   %ebx
+  80240b:	83 ec 18             	sub    $0x18,%esp
+  80240e:	89 c6                	mov    %eax,%esi
+  802410:	89 d7                	mov    %edx,%edi
+  802412:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802414:	6a 00                	push   $0x0
+  802416:	6a 00                	push   $0x0
+  802418:	6a 00                	push   $0x0
+  80241a:	6a 07                	push   $0x7
+  80241c:	ff 35 40 b0 80 00    	push   0x80b040
+  802422:	e8 74 25 00 00       	call   80499b <ipc_call>
+  802427:	83 c4 20             	add    $0x20,%esp
+  80242a:	85 c0                	test   %eax,%eax
+  80242c:	79 22                	jns    802450 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  80242e:	50                   	push   %eax
+  80242f:	68 42 52 80 00       	push   $0x805242
+  802434:	68 13 02 00 00       	push   $0x213
+  802439:	68 56 52 80 00       	push   $0x805256
+  80243e:	e8 eb dc ff ff       	call   80012e <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802443:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802448:	83 c0 01             	add    $0x1,%eax
+  80244b:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802450:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802456:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  80245b:	39 c2                	cmp    %eax,%edx
+  80245d:	74 24                	je     802483 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  80245f:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802464:	83 e0 7f             	and    $0x7f,%eax
+  802467:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  80246e:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802475:	29 f0                	sub    %esi,%eax
+  802477:	39 d8                	cmp    %ebx,%eax
+  802479:	73 c8                	jae    802443 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  80247b:	8b 52 04             	mov    0x4(%edx),%edx
+  80247e:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802481:	eb c0                	jmp    802443 <page_ring_enter+0x3e>
+}
+  802483:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802486:	5b                   	pop    %ebx
+  802487:	5e                   	pop    %esi
+  802488:	5f                   	pop    %edi
+  802489:	5d                   	pop    %ebp
+  80248a:	c3                   	ret
+
+0080248b <page_ring_reserve>:
+{
+  80248b:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  80248d:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802492:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802498:	29 d0                	sub    %edx,%eax
+  80249a:	ba 80 00 00 00       	mov    $0x80,%edx
+  80249f:	29 ca                	sub    %ecx,%edx
+  8024a1:	39 c2                	cmp    %eax,%edx
+  8024a3:	72 01                	jb     8024a6 <page_ring_reserve+0x1b>
+  8024a5:	c3                   	ret
+{
+  8024a6:	55                   	push   %ebp
+  8024a7:	89 e5                	mov    %esp,%ebp
+  8024a9:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  8024ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024bb:	e8 45 ff ff ff       	call   802405 <page_ring_enter>
+}
+  8024c0:	c9                   	leave
+  8024c1:	c3                   	ret
+
+008024c2 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  8024c2:	55                   	push   %ebp
+  8024c3:	89 e5                	mov    %esp,%ebp
+  8024c5:	53                   	push   %ebx
+  8024c6:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  8024c9:	6a 07                	push   $0x7
+  8024cb:	6a 01                	push   $0x1
+  8024cd:	89 c3                	mov    %eax,%ebx
+  8024cf:	c1 e3 0c             	shl    $0xc,%ebx
+  8024d2:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  8024d8:	52                   	push   %edx
+  8024d9:	6a 04                	push   $0x4
+  8024db:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  8024e2:	e8 b4 24 00 00       	call   80499b <ipc_call>
+	sharereqs[i].nslots = 0;
+  8024e7:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  8024ee:	00 00 00 
+	return r;
+}
+  8024f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024f4:	c9                   	leave
+  8024f5:	c3                   	ret
+
+008024f6 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  8024f6:	55                   	push   %ebp
+  8024f7:	89 e5                	mov    %esp,%ebp
+  8024f9:	56                   	push   %esi
+  8024fa:	53                   	push   %ebx
+  8024fb:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  8024fd:	c1 e8 10             	shr    $0x10,%eax
+  802500:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802503:	89 c2                	mov    %eax,%edx
+  802505:	c1 e2 0c             	shl    $0xc,%edx
+  802508:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  80250e:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802511:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  802517:	89 c2                	mov    %eax,%edx
+  802519:	c1 e2 0a             	shl    $0xa,%edx
+  80251c:	01 f2                	add    %esi,%edx
+  80251e:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802525:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  80252b:	74 09                	je     802536 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  80252d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802532:	5b                   	pop    %ebx
+  802533:	5e                   	pop    %esi
+  802534:	5d                   	pop    %ebp
+  802535:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802536:	e8 87 ff ff ff       	call   8024c2 <page_share_send>
+  80253b:	eb f5                	jmp    802532 <page_share_slot+0x3c>
+
+0080253d <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  80253d:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  802542:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802545:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  80254a:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  802550:	74 09                	je     80255b <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802552:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802557:	85 c0                	test   %eax,%eax
+  802559:	75 01                	jne    80255c <page_ring_ready+0x1f>
+}
+  80255b:	c3                   	ret
+{
+  80255c:	55                   	push   %ebp
+  80255d:	89 e5                	mov    %esp,%ebp
+  80255f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802562:	68 07 06 00 00       	push   $0x607
+  802567:	6a 08                	push   $0x8
+  802569:	68 00 30 ad de       	push   $0xdead3000
+  80256e:	6a 00                	push   $0x0
+  802570:	e8 99 e8 ff ff       	call   800e0e <sys_page_alloc_range>
+  802575:	83 c4 10             	add    $0x10,%esp
+  802578:	83 f8 08             	cmp    $0x8,%eax
+  80257b:	74 1b                	je     802598 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  80257d:	83 ec 04             	sub    $0x4,%esp
+  802580:	6a 08                	push   $0x8
+  802582:	68 00 30 ad de       	push   $0xdead3000
+  802587:	6a 00                	push   $0x0
+  802589:	e8 ee e8 ff ff       	call   800e7c <sys_page_unmap_range>
+		return 0;
+  80258e:	83 c4 10             	add    $0x10,%esp
+  802591:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802596:	c9                   	leave
+  802597:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802598:	83 ec 0c             	sub    $0xc,%esp
+  80259b:	68 07 04 00 00       	push   $0x407
+  8025a0:	6a 08                	push   $0x8
+  8025a2:	68 00 30 ad de       	push   $0xdead3000
+  8025a7:	6a 06                	push   $0x6
+  8025a9:	ff 35 40 b0 80 00    	push   0x80b040
+  8025af:	e8 e7 23 00 00       	call   80499b <ipc_call>
+  8025b4:	83 c4 20             	add    $0x20,%esp
+  8025b7:	85 c0                	test   %eax,%eax
+  8025b9:	78 14                	js     8025cf <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  8025bb:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8025c0:	8b 40 48             	mov    0x48(%eax),%eax
+  8025c3:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  8025c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025cd:	eb c7                	jmp    802596 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  8025cf:	83 ec 04             	sub    $0x4,%esp
+  8025d2:	6a 08                	push   $0x8
+  8025d4:	68 00 30 ad de       	push   $0xdead3000
+  8025d9:	6a 00                	push   $0x0
+  8025db:	e8 9c e8 ff ff       	call   800e7c <sys_page_unmap_range>
+		return 0;
+  8025e0:	83 c4 10             	add    $0x10,%esp
+  8025e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e8:	eb ac                	jmp    802596 <page_ring_ready+0x59>
+
+008025ea <page_remove_slot>:
+{
+  8025ea:	55                   	push   %ebp
+  8025eb:	89 e5                	mov    %esp,%ebp
+  8025ed:	56                   	push   %esi
+  8025ee:	53                   	push   %ebx
+  8025ef:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8025f1:	89 c6                	mov    %eax,%esi
+  8025f3:	c1 ee 10             	shr    $0x10,%esi
+  8025f6:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8025f9:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  802600:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  802606:	74 2a                	je     802632 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802608:	83 ec 0c             	sub    $0xc,%esp
+  80260b:	6a 00                	push   $0x0
+  80260d:	6a 00                	push   $0x0
+  80260f:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802611:	c1 e3 04             	shl    $0x4,%ebx
+  802614:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802617:	53                   	push   %ebx
+  802618:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  80261f:	e8 77 23 00 00       	call   80499b <ipc_call>
+  802624:	83 c4 20             	add    $0x20,%esp
+  802627:	85 c0                	test   %eax,%eax
+  802629:	78 2d                	js     802658 <page_remove_slot+0x6e>
+}
+  80262b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80262e:	5b                   	pop    %ebx
+  80262f:	5e                   	pop    %esi
+  802630:	5d                   	pop    %ebp
+  802631:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802632:	e8 06 ff ff ff       	call   80253d <page_ring_ready>
+  802637:	85 c0                	test   %eax,%eax
+  802639:	74 cd                	je     802608 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  80263b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802640:	e8 46 fe ff ff       	call   80248b <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802645:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80264a:	89 da                	mov    %ebx,%edx
+  80264c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802651:	e8 69 fd ff ff       	call   8023bf <page_ring_post>
+		return;
+  802656:	eb d3                	jmp    80262b <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802658:	50                   	push   %eax
+  802659:	68 b0 52 80 00       	push   $0x8052b0
+  80265e:	68 ac 03 00 00       	push   $0x3ac
+  802663:	68 56 52 80 00       	push   $0x805256
+  802668:	e8 c1 da ff ff       	call   80012e <_panic>
+
+0080266d <find_paging_env>:
+	if(pagingenv)
+  80266d:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802672:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802674:	85 c0                	test   %eax,%eax
+  802676:	74 05                	je     80267d <find_paging_env+0x10>
+  802678:	eb 56                	jmp    8026d0 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  80267a:	83 c0 01             	add    $0x1,%eax
+  80267d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802682:	7f 47                	jg     8026cb <find_paging_env+0x5e>
+  802684:	83 f9 01             	cmp    $0x1,%ecx
+  802687:	7f 42                	jg     8026cb <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802689:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  80268c:	c1 e2 06             	shl    $0x6,%edx
+  80268f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802695:	8b 52 50             	mov    0x50(%edx),%edx
+  802698:	83 fa 02             	cmp    $0x2,%edx
+  80269b:	75 dd                	jne    80267a <find_paging_env+0xd>
+  80269d:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  8026a0:	c1 e2 06             	shl    $0x6,%edx
+  8026a3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8026a9:	8b 52 54             	mov    0x54(%edx),%edx
+  8026ac:	85 d2                	test   %edx,%edx
+  8026ae:	74 ca                	je     80267a <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  8026b0:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  8026b3:	c1 e2 06             	shl    $0x6,%edx
+  8026b6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8026bc:	8b 52 48             	mov    0x48(%edx),%edx
+  8026bf:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  8026c6:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8026c9:	eb af                	jmp    80267a <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  8026cb:	83 f9 02             	cmp    $0x2,%ecx
+  8026ce:	74 01                	je     8026d1 <find_paging_env+0x64>
+}
+  8026d0:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  8026d1:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8026d6:	8b 40 48             	mov    0x48(%eax),%eax
+  8026d9:	83 e0 01             	and    $0x1,%eax
+  8026dc:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  8026e3:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  8026e8:	eb e6                	jmp    8026d0 <find_paging_env+0x63>
+
+008026ea <page_add_backed>:
+{
+  8026ea:	55                   	push   %ebp
+  8026eb:	89 e5                	mov    %esp,%ebp
+  8026ed:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  8026f0:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  8026f5:	83 f8 04             	cmp    $0x4,%eax
+  8026f8:	74 35                	je     80272f <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  8026fa:	89 d1                	mov    %edx,%ecx
+  8026fc:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802702:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802709:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80270c:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802713:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802719:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  802720:	83 c0 01             	add    $0x1,%eax
+  802723:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  802728:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80272d:	5d                   	pop    %ebp
+  80272e:	c3                   	ret
+		return -E_NO_MEM;
+  80272f:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802734:	eb f7                	jmp    80272d <page_add_backed+0x43>
+
+00802736 <percentage_of_pgdir_to_walk>:
+{
+  802736:	55                   	push   %ebp
+  802737:	89 e5                	mov    %esp,%ebp
+  802739:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  80273c:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802740:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802743:	db 45 fc             	fildl  -0x4(%ebp)
+  802746:	d8 35 3c 57 80 00    	fdivs  0x80573c
+	return ret*ret;
+  80274c:	d8 c8                	fmul   %st(0),%st
+}
+  80274e:	c9                   	leave
+  80274f:	c3                   	ret
+
+00802750 <nfu_with_aging_page_choice_func>:
+{
+  802750:	55                   	push   %ebp
+  802751:	89 e5                	mov    %esp,%ebp
+  802753:	57                   	push   %edi
+  802754:	56                   	push   %esi
+  802755:	53                   	push   %ebx
+  802756:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802759:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  80275f:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802761:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802766:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80276b:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802772:	ba 00 00 00 00       	mov    $0x0,%edx
+  802777:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  80277a:	eb 18                	jmp    802794 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80277c:	f7 d0                	not    %eax
+  80277e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802783:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802785:	83 c2 01             	add    $0x1,%edx
+  802788:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  80278e:	0f 87 13 01 00 00    	ja     8028a7 <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802794:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802798:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  80279b:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8027a0:	89 c1                	mov    %eax,%ecx
+  8027a2:	c1 e9 0a             	shr    $0xa,%ecx
+  8027a5:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8027ac:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8027b2:	83 f9 01             	cmp    $0x1,%ecx
+  8027b5:	75 c5                	jne    80277c <nfu_with_aging_page_choice_func+0x2c>
+  8027b7:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8027bc:	77 be                	ja     80277c <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8027be:	89 c1                	mov    %eax,%ecx
+  8027c0:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8027c3:	81 f9 00 00 81 00    	cmp    $0x810000,%ecx
+  8027c9:	0f 82 a5 00 00 00    	jb     802874 <nfu_with_aging_page_choice_func+0x124>
+  8027cf:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8027d5:	0f 87 99 00 00 00    	ja     802874 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8027db:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8027e2:	f6 c1 01             	test   $0x1,%cl
+  8027e5:	0f 84 89 00 00 00    	je     802874 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027eb:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8027f2:	f6 c5 04             	test   $0x4,%ch
+  8027f5:	75 7d                	jne    802874 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8027f7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027fe:	f6 c5 02             	test   $0x2,%ch
+  802801:	75 71                	jne    802874 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802803:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80280a:	c1 e9 0c             	shr    $0xc,%ecx
+  80280d:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802810:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802816:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  80281a:	66 83 f9 01          	cmp    $0x1,%cx
+  80281e:	77 54                	ja     802874 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802820:	89 f9                	mov    %edi,%ecx
+  802822:	80 f9 ff             	cmp    $0xff,%cl
+  802825:	74 21                	je     802848 <nfu_with_aging_page_choice_func+0xf8>
+  802827:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80282e:	c1 e9 0c             	shr    $0xc,%ecx
+  802831:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802834:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80283a:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  80283e:	89 fb                	mov    %edi,%ebx
+  802840:	38 d9                	cmp    %bl,%cl
+  802842:	73 30                	jae    802874 <nfu_with_aging_page_choice_func+0x124>
+  802844:	dd d8                	fstp   %st(0)
+  802846:	eb 02                	jmp    80284a <nfu_with_aging_page_choice_func+0xfa>
+  802848:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  80284a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802851:	c1 e9 0c             	shr    $0xc,%ecx
+  802854:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802857:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  80285e:	89 fb                	mov    %edi,%ebx
+  802860:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802863:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802866:	db 45 e0             	fildl  -0x20(%ebp)
+  802869:	d8 35 3c 57 80 00    	fdivs  0x80573c
+	return ret*ret;
+  80286f:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802871:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802874:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802877:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80287a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802881:	df 6d e0             	fildll -0x20(%ebp)
+  802884:	d9 c1                	fld    %st(1)
+  802886:	d8 0d 40 57 80 00    	fmuls  0x805740
+  80288c:	d9 c9                	fxch   %st(1)
+  80288e:	df f1                	fcomip %st(1),%st
+  802890:	dd d8                	fstp   %st(0)
+  802892:	0f 82 ed fe ff ff    	jb     802785 <nfu_with_aging_page_choice_func+0x35>
+  802898:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  80289a:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  80289f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8028a2:	c1 e0 0c             	shl    $0xc,%eax
+  8028a5:	eb 0e                	jmp    8028b5 <nfu_with_aging_page_choice_func+0x165>
+  8028a7:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  8028a9:	89 f8                	mov    %edi,%eax
+  8028ab:	3c ff                	cmp    $0xff,%al
+  8028ad:	74 0e                	je     8028bd <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  8028af:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8028b2:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8028b5:	83 c4 14             	add    $0x14,%esp
+  8028b8:	5b                   	pop    %ebx
+  8028b9:	5e                   	pop    %esi
+  8028ba:	5f                   	pop    %edi
+  8028bb:	5d                   	pop    %ebp
+  8028bc:	c3                   	ret
+	pgnum = 0;
+  8028bd:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  8028c4:	00 00 00 
+	return (void*)UTOP;
+  8028c7:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8028cc:	eb e7                	jmp    8028b5 <nfu_with_aging_page_choice_func+0x165>
+
+008028ce <myRand>:
+    state = state * 1664525 + 1013904223;
+  8028ce:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  8028d5:	66 19 00 
+  8028d8:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  8028dd:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  8028e2:	c1 e8 18             	shr    $0x18,%eax
+}
+  8028e5:	c3                   	ret
+
+008028e6 <random_page_choice_func>:
+{
+  8028e6:	55                   	push   %ebp
+  8028e7:	89 e5                	mov    %esp,%ebp
+  8028e9:	57                   	push   %edi
+  8028ea:	56                   	push   %esi
+  8028eb:	53                   	push   %ebx
+  8028ec:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8028ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8028f4:	eb 19                	jmp    80290f <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8028f6:	f7 d3                	not    %ebx
+  8028f8:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8028fe:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802900:	83 c6 01             	add    $0x1,%esi
+  802903:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802909:	0f 87 a0 00 00 00    	ja     8029af <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80290f:	89 f3                	mov    %esi,%ebx
+  802911:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  802917:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80291d:	89 d8                	mov    %ebx,%eax
+  80291f:	c1 e8 0a             	shr    $0xa,%eax
+  802922:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802929:	25 81 00 00 00       	and    $0x81,%eax
+  80292e:	83 f8 01             	cmp    $0x1,%eax
+  802931:	75 c3                	jne    8028f6 <random_page_choice_func+0x10>
+  802933:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802939:	77 bb                	ja     8028f6 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  80293b:	89 df                	mov    %ebx,%edi
+  80293d:	c1 e7 0c             	shl    $0xc,%edi
+  802940:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802943:	89 f8                	mov    %edi,%eax
+  802945:	e8 06 f9 ff ff       	call   802250 <page_is_clean>
+  80294a:	84 c0                	test   %al,%al
+  80294c:	0f 85 82 00 00 00    	jne    8029d4 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802952:	81 ff 00 00 81 00    	cmp    $0x810000,%edi
+  802958:	72 a6                	jb     802900 <random_page_choice_func+0x1a>
+  80295a:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802960:	77 9e                	ja     802900 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802962:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802969:	a8 01                	test   $0x1,%al
+  80296b:	74 93                	je     802900 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80296d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802974:	f6 c4 04             	test   $0x4,%ah
+  802977:	75 87                	jne    802900 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802979:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802980:	f6 c4 02             	test   $0x2,%ah
+  802983:	0f 85 77 ff ff ff    	jne    802900 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802989:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802990:	c1 e8 0c             	shr    $0xc,%eax
+  802993:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802996:	05 00 00 00 ef       	add    $0xef000000,%eax
+  80299b:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80299f:	66 83 f8 01          	cmp    $0x1,%ax
+  8029a3:	0f 87 57 ff ff ff    	ja     802900 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  8029a9:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8029af:	e8 1a ff ff ff       	call   8028ce <myRand>
+  8029b4:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  8029ba:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  8029bf:	29 fe                	sub    %edi,%esi
+  8029c1:	0f be c0             	movsbl %al,%eax
+  8029c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029c9:	f7 f6                	div    %esi
+  8029cb:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8029cd:	bb 15 00 00 00       	mov    $0x15,%ebx
+  8029d2:	eb 1c                	jmp    8029f0 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  8029d4:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  8029da:	e9 8f 00 00 00       	jmp    802a6e <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8029df:	e8 ea fe ff ff       	call   8028ce <myRand>
+  8029e4:	0f be c0             	movsbl %al,%eax
+  8029e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029ec:	f7 f6                	div    %esi
+  8029ee:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8029f0:	83 eb 01             	sub    $0x1,%ebx
+  8029f3:	0f 84 c2 00 00 00    	je     802abb <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  8029f9:	89 d0                	mov    %edx,%eax
+  8029fb:	c1 e8 0a             	shr    $0xa,%eax
+  8029fe:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802a05:	25 81 00 00 00       	and    $0x81,%eax
+  802a0a:	83 f8 01             	cmp    $0x1,%eax
+  802a0d:	75 d0                	jne    8029df <random_page_choice_func+0xf9>
+  802a0f:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  802a15:	77 c8                	ja     8029df <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  802a17:	89 d0                	mov    %edx,%eax
+  802a19:	c1 e0 0c             	shl    $0xc,%eax
+  802a1c:	3d 00 00 81 00       	cmp    $0x810000,%eax
+  802a21:	72 56                	jb     802a79 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a23:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  802a28:	77 65                	ja     802a8f <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802a2a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a31:	f6 c1 01             	test   $0x1,%cl
+  802a34:	74 59                	je     802a8f <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802a36:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802a3d:	f6 c5 04             	test   $0x4,%ch
+  802a40:	75 4d                	jne    802a8f <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  802a42:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802a49:	f6 c5 02             	test   $0x2,%ch
+  802a4c:	75 41                	jne    802a8f <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  802a4e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802a55:	c1 ea 0c             	shr    $0xc,%edx
+  802a58:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  802a5b:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  802a61:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  802a65:	66 83 fa 01          	cmp    $0x1,%dx
+  802a69:	77 3a                	ja     802aa5 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  802a6b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  802a6e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a71:	83 c4 1c             	add    $0x1c,%esp
+  802a74:	5b                   	pop    %ebx
+  802a75:	5e                   	pop    %esi
+  802a76:	5f                   	pop    %edi
+  802a77:	5d                   	pop    %ebp
+  802a78:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802a79:	e8 50 fe ff ff       	call   8028ce <myRand>
+  802a7e:	0f be c0             	movsbl %al,%eax
+  802a81:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a86:	f7 f6                	div    %esi
+  802a88:	01 fa                	add    %edi,%edx
+			continue;
+  802a8a:	e9 61 ff ff ff       	jmp    8029f0 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802a8f:	e8 3a fe ff ff       	call   8028ce <myRand>
+  802a94:	0f be c0             	movsbl %al,%eax
+  802a97:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a9c:	f7 f6                	div    %esi
+  802a9e:	01 fa                	add    %edi,%edx
+			continue;
+  802aa0:	e9 4b ff ff ff       	jmp    8029f0 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802aa5:	e8 24 fe ff ff       	call   8028ce <myRand>
+  802aaa:	0f be c0             	movsbl %al,%eax
+  802aad:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ab2:	f7 f6                	div    %esi
+  802ab4:	01 fa                	add    %edi,%edx
+			continue;
+  802ab6:	e9 35 ff ff ff       	jmp    8029f0 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  802abb:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  802ac2:	00 00 00 
+	return (void*)UTOP;
+  802ac5:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  802acc:	eb a0                	jmp    802a6e <random_page_choice_func+0x188>
+
+00802ace <nfu>:
+{
+  802ace:	55                   	push   %ebp
+  802acf:	89 e5                	mov    %esp,%ebp
+  802ad1:	57                   	push   %edi
+  802ad2:	56                   	push   %esi
+  802ad3:	53                   	push   %ebx
+  802ad4:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802ad7:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  802add:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802adf:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802ae4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ae9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802af0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802af5:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802af8:	eb 18                	jmp    802b12 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802afa:	f7 d0                	not    %eax
+  802afc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802b01:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802b03:	83 c2 01             	add    $0x1,%edx
+  802b06:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802b0c:	0f 87 13 01 00 00    	ja     802c25 <nfu+0x157>
+		++num_searched_ptes;
+  802b12:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802b16:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802b19:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802b1e:	89 c1                	mov    %eax,%ecx
+  802b20:	c1 e9 0a             	shr    $0xa,%ecx
+  802b23:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802b2a:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802b30:	83 f9 01             	cmp    $0x1,%ecx
+  802b33:	75 c5                	jne    802afa <nfu+0x2c>
+  802b35:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802b3a:	77 be                	ja     802afa <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802b3c:	89 c1                	mov    %eax,%ecx
+  802b3e:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b41:	81 f9 00 00 81 00    	cmp    $0x810000,%ecx
+  802b47:	0f 82 a5 00 00 00    	jb     802bf2 <nfu+0x124>
+  802b4d:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802b53:	0f 87 99 00 00 00    	ja     802bf2 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b59:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b60:	f6 c1 01             	test   $0x1,%cl
+  802b63:	0f 84 89 00 00 00    	je     802bf2 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802b69:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b70:	f6 c5 04             	test   $0x4,%ch
+  802b73:	75 7d                	jne    802bf2 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802b75:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802b7c:	f6 c5 02             	test   $0x2,%ch
+  802b7f:	75 71                	jne    802bf2 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802b81:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b88:	c1 e9 0c             	shr    $0xc,%ecx
+  802b8b:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b8e:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802b94:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802b98:	66 83 f9 01          	cmp    $0x1,%cx
+  802b9c:	77 54                	ja     802bf2 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  802b9e:	89 f9                	mov    %edi,%ecx
+  802ba0:	80 f9 ff             	cmp    $0xff,%cl
+  802ba3:	74 21                	je     802bc6 <nfu+0xf8>
+  802ba5:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802bac:	c1 e9 0c             	shr    $0xc,%ecx
+  802baf:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802bb2:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802bb8:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  802bbc:	89 fb                	mov    %edi,%ebx
+  802bbe:	38 d9                	cmp    %bl,%cl
+  802bc0:	73 30                	jae    802bf2 <nfu+0x124>
+  802bc2:	dd d8                	fstp   %st(0)
+  802bc4:	eb 02                	jmp    802bc8 <nfu+0xfa>
+  802bc6:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  802bc8:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802bcf:	c1 e9 0c             	shr    $0xc,%ecx
+  802bd2:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802bd5:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802bdc:	89 fb                	mov    %edi,%ebx
+  802bde:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802be1:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802be4:	db 45 e0             	fildl  -0x20(%ebp)
+  802be7:	d8 35 3c 57 80 00    	fdivs  0x80573c
+	return ret*ret;
+  802bed:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802bef:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802bf2:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802bf5:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802bf8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802bff:	df 6d e0             	fildll -0x20(%ebp)
+  802c02:	d9 c1                	fld    %st(1)
+  802c04:	d8 0d 40 57 80 00    	fmuls  0x805740
+  802c0a:	d9 c9                	fxch   %st(1)
+  802c0c:	df f1                	fcomip %st(1),%st
+  802c0e:	dd d8                	fstp   %st(0)
+  802c10:	0f 82 ed fe ff ff    	jb     802b03 <nfu+0x35>
+  802c16:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802c18:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  802c1d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802c20:	c1 e0 0c             	shl    $0xc,%eax
+  802c23:	eb 0e                	jmp    802c33 <nfu+0x165>
+  802c25:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802c27:	89 f8                	mov    %edi,%eax
+  802c29:	3c ff                	cmp    $0xff,%al
+  802c2b:	74 0e                	je     802c3b <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802c2d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802c30:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802c33:	83 c4 14             	add    $0x14,%esp
+  802c36:	5b                   	pop    %ebx
+  802c37:	5e                   	pop    %esi
+  802c38:	5f                   	pop    %edi
+  802c39:	5d                   	pop    %ebp
+  802c3a:	c3                   	ret
+	pgnum = 0;
+  802c3b:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  802c42:	00 00 00 
+	return (void*)UTOP;
+  802c45:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802c4a:	eb e7                	jmp    802c33 <nfu+0x165>
+
+00802c4c <lru>:
+{
+  802c4c:	55                   	push   %ebp
+  802c4d:	89 e5                	mov    %esp,%ebp
+  802c4f:	57                   	push   %edi
+  802c50:	56                   	push   %esi
+  802c51:	53                   	push   %ebx
+  802c52:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c55:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  802c5b:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  802c62:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802c69:	be 00 00 00 00       	mov    $0x0,%esi
+  802c6e:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c75:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c7a:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  802c7d:	eb 18                	jmp    802c97 <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802c7f:	f7 d0                	not    %eax
+  802c81:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802c86:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c88:	83 c2 01             	add    $0x1,%edx
+  802c8b:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802c91:	0f 87 fa 00 00 00    	ja     802d91 <lru+0x145>
+		++num_searched_ptes;
+  802c97:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c9a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802c9d:	01 d0                	add    %edx,%eax
+  802c9f:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802ca4:	89 c1                	mov    %eax,%ecx
+  802ca6:	c1 e9 0a             	shr    $0xa,%ecx
+  802ca9:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802cb0:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802cb6:	83 f9 01             	cmp    $0x1,%ecx
+  802cb9:	75 c4                	jne    802c7f <lru+0x33>
+  802cbb:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802cc0:	77 bd                	ja     802c7f <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802cc2:	89 c1                	mov    %eax,%ecx
+  802cc4:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802cc7:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802ccd:	0f 87 92 00 00 00    	ja     802d65 <lru+0x119>
+  802cd3:	81 f9 00 00 81 00    	cmp    $0x810000,%ecx
+  802cd9:	0f 82 86 00 00 00    	jb     802d65 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802cdf:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802ce6:	f6 c1 01             	test   $0x1,%cl
+  802ce9:	74 7a                	je     802d65 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802ceb:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802cf2:	f6 c5 04             	test   $0x4,%ch
+  802cf5:	75 6e                	jne    802d65 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802cf7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802cfe:	f6 c5 02             	test   $0x2,%ch
+  802d01:	75 62                	jne    802d65 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802d03:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d0a:	c1 e9 0c             	shr    $0xc,%ecx
+  802d0d:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d10:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d16:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802d1a:	66 83 f9 01          	cmp    $0x1,%cx
+  802d1e:	77 45                	ja     802d65 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  802d20:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d27:	c1 e9 0c             	shr    $0xc,%ecx
+  802d2a:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d2d:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d33:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802d36:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802d39:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  802d3c:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802d3f:	19 df                	sbb    %ebx,%edi
+  802d41:	7c 22                	jl     802d65 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  802d43:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d4a:	c1 e9 0c             	shr    $0xc,%ecx
+  802d4d:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d50:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d56:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802d59:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802d5c:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802d5f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d62:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802d65:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  802d68:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802d6f:	df 6d e0             	fildll -0x20(%ebp)
+  802d72:	d9 05 40 57 80 00    	flds   0x805740
+  802d78:	d9 c9                	fxch   %st(1)
+  802d7a:	df f1                	fcomip %st(1),%st
+  802d7c:	dd d8                	fstp   %st(0)
+  802d7e:	0f 82 04 ff ff ff    	jb     802c88 <lru+0x3c>
+			pgnum = pgnum_actual;
+  802d84:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  802d89:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d8c:	c1 e0 0c             	shl    $0xc,%eax
+  802d8f:	eb 06                	jmp    802d97 <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  802d91:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d94:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802d97:	83 c4 1c             	add    $0x1c,%esp
+  802d9a:	5b                   	pop    %ebx
+  802d9b:	5e                   	pop    %esi
+  802d9c:	5f                   	pop    %edi
+  802d9d:	5d                   	pop    %ebp
+  802d9e:	c3                   	ret
+
+00802d9f <set_page_choice_func>:
+{
+  802d9f:	55                   	push   %ebp
+  802da0:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  802da2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da5:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  802daa:	5d                   	pop    %ebp
+  802dab:	c3                   	ret
+
+00802dac <get_page_choice>:
+{
+  802dac:	55                   	push   %ebp
+  802dad:	89 e5                	mov    %esp,%ebp
+  802daf:	57                   	push   %edi
+  802db0:	56                   	push   %esi
+  802db1:	53                   	push   %ebx
+  802db2:	83 ec 24             	sub    $0x24,%esp
+  802db5:	8b 75 08             	mov    0x8(%ebp),%esi
+  802db8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  802dbb:	57                   	push   %edi
+  802dbc:	56                   	push   %esi
+  802dbd:	ff 15 3c 60 80 00    	call   *0x80603c
+  802dc3:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802dc5:	83 c4 10             	add    $0x10,%esp
+  802dc8:	eb 25                	jmp    802def <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  802dca:	83 ec 08             	sub    $0x8,%esp
+  802dcd:	c1 e0 16             	shl    $0x16,%eax
+  802dd0:	50                   	push   %eax
+  802dd1:	6a 00                	push   $0x0
+  802dd3:	e8 d2 df ff ff       	call   800daa <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802dd8:	83 c4 10             	add    $0x10,%esp
+  802ddb:	85 c0                	test   %eax,%eax
+  802ddd:	75 43                	jne    802e22 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  802ddf:	83 ec 08             	sub    $0x8,%esp
+  802de2:	57                   	push   %edi
+  802de3:	56                   	push   %esi
+  802de4:	ff 15 3c 60 80 00    	call   *0x80603c
+  802dea:	89 c3                	mov    %eax,%ebx
+  802dec:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802def:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802df2:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  802df8:	0f 86 ae 00 00 00    	jbe    802eac <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802dfe:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  802e03:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802e0a:	81 e2 81 00 00 00    	and    $0x81,%edx
+  802e10:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  802e16:	74 b2                	je     802dca <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802e18:	83 c0 01             	add    $0x1,%eax
+  802e1b:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  802e20:	75 e1                	jne    802e03 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802e22:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e25:	05 00 10 40 11       	add    $0x11401000,%eax
+  802e2a:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802e2f:	76 1f                	jbe    802e50 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  802e31:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  802e36:	89 d8                	mov    %ebx,%eax
+  802e38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e3b:	5b                   	pop    %ebx
+  802e3c:	5e                   	pop    %esi
+  802e3d:	5f                   	pop    %edi
+  802e3e:	5d                   	pop    %ebp
+  802e3f:	c3                   	ret
+		sys_page_split(0, pg_out);
+  802e40:	83 ec 08             	sub    $0x8,%esp
+  802e43:	53                   	push   %ebx
+  802e44:	6a 00                	push   $0x0
+  802e46:	e8 5f df ff ff       	call   800daa <sys_page_split>
+  802e4b:	83 c4 10             	add    $0x10,%esp
+  802e4e:	eb 6c                	jmp    802ebc <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  802e50:	83 ec 04             	sub    $0x4,%esp
+  802e53:	68 e8 52 80 00       	push   $0x8052e8
+  802e58:	68 cc 01 00 00       	push   $0x1cc
+  802e5d:	68 56 52 80 00       	push   $0x805256
+  802e62:	e8 c7 d2 ff ff       	call   80012e <_panic>
+		panic("We tried to page out code pages\n");
+  802e67:	83 ec 04             	sub    $0x4,%esp
+  802e6a:	68 18 53 80 00       	push   $0x805318
+  802e6f:	68 d6 01 00 00       	push   $0x1d6
+  802e74:	68 56 52 80 00       	push   $0x805256
+  802e79:	e8 b0 d2 ff ff       	call   80012e <_panic>
+		panic("Invalid mapping for the va\n");
+  802e7e:	83 ec 04             	sub    $0x4,%esp
+  802e81:	68 63 52 80 00       	push   $0x805263
+  802e86:	68 da 01 00 00       	push   $0x1da
+  802e8b:	68 56 52 80 00       	push   $0x805256
+  802e90:	e8 99 d2 ff ff       	call   80012e <_panic>
+		panic("We tried to page out a shared page\n");
+  802e95:	83 ec 04             	sub    $0x4,%esp
+  802e98:	68 3c 53 80 00       	push   $0x80533c
+  802e9d:	68 e0 01 00 00       	push   $0x1e0
+  802ea2:	68 56 52 80 00       	push   $0x805256
+  802ea7:	e8 82 d2 ff ff       	call   80012e <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  802eac:	89 de                	mov    %ebx,%esi
+  802eae:	c1 ee 16             	shr    $0x16,%esi
+  802eb1:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802eb8:	a8 80                	test   $0x80,%al
+  802eba:	75 84                	jne    802e40 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802ebc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ebf:	05 00 10 40 11       	add    $0x11401000,%eax
+  802ec4:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802ec9:	76 85                	jbe    802e50 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  802ecb:	89 d8                	mov    %ebx,%eax
+  802ecd:	e8 7e f3 ff ff       	call   802250 <page_is_clean>
+  802ed2:	84 c0                	test   %al,%al
+  802ed4:	0f 85 5c ff ff ff    	jne    802e36 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  802eda:	81 7d e4 00 00 81 00 	cmpl   $0x810000,-0x1c(%ebp)
+  802ee1:	76 84                	jbe    802e67 <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  802ee3:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802eea:	a8 01                	test   $0x1,%al
+  802eec:	74 90                	je     802e7e <get_page_choice+0xd2>
+  802eee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ef1:	c1 e8 0c             	shr    $0xc,%eax
+  802ef4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802efb:	f6 c2 01             	test   $0x1,%dl
+  802efe:	0f 84 7a ff ff ff    	je     802e7e <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802f04:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  802f0b:	f6 c2 01             	test   $0x1,%dl
+  802f0e:	74 85                	je     802e95 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802f10:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802f17:	f6 c2 01             	test   $0x1,%dl
+  802f1a:	0f 84 75 ff ff ff    	je     802e95 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802f20:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802f27:	f6 c6 04             	test   $0x4,%dh
+  802f2a:	0f 85 65 ff ff ff    	jne    802e95 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  802f30:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802f37:	f6 c6 02             	test   $0x2,%dh
+  802f3a:	0f 85 55 ff ff ff    	jne    802e95 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  802f40:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f47:	c1 e8 0c             	shr    $0xc,%eax
+  802f4a:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802f4d:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802f52:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802f56:	66 83 f8 01          	cmp    $0x1,%ax
+  802f5a:	0f 86 d6 fe ff ff    	jbe    802e36 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  802f60:	83 ec 04             	sub    $0x4,%esp
+  802f63:	68 60 53 80 00       	push   $0x805360
+  802f68:	68 e2 01 00 00       	push   $0x1e2
+  802f6d:	68 56 52 80 00       	push   $0x805256
+  802f72:	e8 b7 d1 ff ff       	call   80012e <_panic>
+
+00802f77 <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  802f77:	55                   	push   %ebp
+  802f78:	89 e5                	mov    %esp,%ebp
+  802f7a:	57                   	push   %edi
+  802f7b:	56                   	push   %esi
+  802f7c:	53                   	push   %ebx
+  802f7d:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  802f80:	e8 e8 f6 ff ff       	call   80266d <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  802f85:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802f8a:	85 c0                	test   %eax,%eax
+  802f8c:	74 41                	je     802fcf <page_share_paged_out+0x58>
+  802f8e:	83 3d 10 e9 80 00 00 	cmpl   $0x0,0x80e910
+  802f95:	0f 84 fd 00 00 00    	je     803098 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  802f9b:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802fa2:	00 00 00 
+  802fa5:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  802fac:	00 00 00 
+  802faf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fb4:	eb 2c                	jmp    802fe2 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802fb6:	83 c3 04             	add    $0x4,%ebx
+  802fb9:	39 f3                	cmp    %esi,%ebx
+  802fbb:	74 1a                	je     802fd7 <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  802fbd:	8b 03                	mov    (%ebx),%eax
+  802fbf:	a8 01                	test   $0x1,%al
+  802fc1:	74 f3                	je     802fb6 <page_share_paged_out+0x3f>
+  802fc3:	c1 e8 0c             	shr    $0xc,%eax
+  802fc6:	e8 2b f5 ff ff       	call   8024f6 <page_share_slot>
+  802fcb:	85 c0                	test   %eax,%eax
+  802fcd:	79 e7                	jns    802fb6 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  802fcf:	83 c4 0c             	add    $0xc,%esp
+  802fd2:	5b                   	pop    %ebx
+  802fd3:	5e                   	pop    %esi
+  802fd4:	5f                   	pop    %edi
+  802fd5:	5d                   	pop    %ebp
+  802fd6:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  802fd7:	83 c7 04             	add    $0x4,%edi
+  802fda:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  802fe0:	74 1b                	je     802ffd <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  802fe2:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  802fe7:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  802fea:	f6 c3 01             	test   $0x1,%bl
+  802fed:	74 e8                	je     802fd7 <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  802fef:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802ff5:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  802ffb:	eb bc                	jmp    802fb9 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802ffd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803002:	eb 11                	jmp    803015 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  803004:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80300a:	83 c3 01             	add    $0x1,%ebx
+  80300d:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803013:	77 41                	ja     803056 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  803015:	89 d8                	mov    %ebx,%eax
+  803017:	c1 e8 0a             	shr    $0xa,%eax
+  80301a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803021:	25 81 00 00 00       	and    $0x81,%eax
+  803026:	83 f8 01             	cmp    $0x1,%eax
+  803029:	75 d9                	jne    803004 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  80302b:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803032:	25 81 00 00 00       	and    $0x81,%eax
+  803037:	3d 80 00 00 00       	cmp    $0x80,%eax
+  80303c:	75 cc                	jne    80300a <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  80303e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803045:	c1 e8 0c             	shr    $0xc,%eax
+  803048:	e8 a9 f4 ff ff       	call   8024f6 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  80304d:	85 c0                	test   %eax,%eax
+  80304f:	79 b9                	jns    80300a <page_share_paged_out+0x93>
+  803051:	e9 79 ff ff ff       	jmp    802fcf <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803056:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80305d:	75 13                	jne    803072 <page_share_paged_out+0xfb>
+  80305f:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  803066:	75 1d                	jne    803085 <page_share_paged_out+0x10e>
+	return 0;
+  803068:	b8 00 00 00 00       	mov    $0x0,%eax
+  80306d:	e9 5d ff ff ff       	jmp    802fcf <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803072:	b8 00 00 00 00       	mov    $0x0,%eax
+  803077:	e8 46 f4 ff ff       	call   8024c2 <page_share_send>
+  80307c:	85 c0                	test   %eax,%eax
+  80307e:	79 df                	jns    80305f <page_share_paged_out+0xe8>
+  803080:	e9 4a ff ff ff       	jmp    802fcf <page_share_paged_out+0x58>
+  803085:	b8 01 00 00 00       	mov    $0x1,%eax
+  80308a:	e8 33 f4 ff ff       	call   8024c2 <page_share_send>
+  80308f:	85 c0                	test   %eax,%eax
+  803091:	79 d5                	jns    803068 <page_share_paged_out+0xf1>
+  803093:	e9 37 ff ff ff       	jmp    802fcf <page_share_paged_out+0x58>
+		return 0;
+  803098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80309d:	e9 2d ff ff ff       	jmp    802fcf <page_share_paged_out+0x58>
+
+008030a2 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  8030a2:	55                   	push   %ebp
+  8030a3:	89 e5                	mov    %esp,%ebp
+  8030a5:	56                   	push   %esi
+  8030a6:	53                   	push   %ebx
+  8030a7:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  8030aa:	e8 be f5 ff ff       	call   80266d <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  8030af:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  8030b4:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8030bb:	0f 84 82 00 00 00    	je     803143 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  8030c1:	83 ec 0c             	sub    $0xc,%esp
+  8030c4:	68 00 10 00 00       	push   $0x1000
+  8030c9:	e8 84 11 00 00       	call   804252 <malloc>
+  8030ce:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  8030d0:	83 c4 0c             	add    $0xc,%esp
+  8030d3:	6a 14                	push   $0x14
+  8030d5:	6a 00                	push   $0x0
+  8030d7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8030da:	50                   	push   %eax
+  8030db:	e8 61 d8 ff ff       	call   800941 <memset>
+  8030e0:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  8030e3:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  8030e8:	83 ec 0c             	sub    $0xc,%esp
+  8030eb:	6a 07                	push   $0x7
+  8030ed:	6a 01                	push   $0x1
+  8030ef:	53                   	push   %ebx
+  8030f0:	6a 03                	push   $0x3
+  8030f2:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8030f9:	e8 9d 18 00 00       	call   80499b <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  8030fe:	8b 03                	mov    (%ebx),%eax
+  803100:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803103:	8b 43 04             	mov    0x4(%ebx),%eax
+  803106:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  803109:	8b 43 08             	mov    0x8(%ebx),%eax
+  80310c:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  80310f:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803112:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  803115:	8b 43 10             	mov    0x10(%ebx),%eax
+  803118:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  80311b:	83 c6 01             	add    $0x1,%esi
+  80311e:	83 c4 20             	add    $0x20,%esp
+  803121:	83 fe 02             	cmp    $0x2,%esi
+  803124:	75 c2                	jne    8030e8 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  803126:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803129:	89 03                	mov    %eax,(%ebx)
+  80312b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80312e:	89 43 04             	mov    %eax,0x4(%ebx)
+  803131:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803134:	89 43 08             	mov    %eax,0x8(%ebx)
+  803137:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80313a:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80313d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803140:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  803143:	89 d8                	mov    %ebx,%eax
+  803145:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803148:	5b                   	pop    %ebx
+  803149:	5e                   	pop    %esi
+  80314a:	5d                   	pop    %ebp
+  80314b:	c3                   	ret
+
+0080314c <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  80314c:	55                   	push   %ebp
+  80314d:	89 e5                	mov    %esp,%ebp
+  80314f:	53                   	push   %ebx
+  803150:	83 ec 10             	sub    $0x10,%esp
+  803153:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  803156:	68 7d 52 80 00       	push   $0x80527d
+  80315b:	e8 a9 d0 ff ff       	call   800209 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  803160:	83 c4 08             	add    $0x8,%esp
+  803163:	ff 33                	push   (%ebx)
+  803165:	68 94 53 80 00       	push   $0x805394
+  80316a:	e8 9a d0 ff ff       	call   800209 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  80316f:	83 c4 08             	add    $0x8,%esp
+  803172:	ff 73 04             	push   0x4(%ebx)
+  803175:	68 7f 52 80 00       	push   $0x80527f
+  80317a:	e8 8a d0 ff ff       	call   800209 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  80317f:	83 c4 08             	add    $0x8,%esp
+  803182:	ff 73 08             	push   0x8(%ebx)
+  803185:	68 b4 53 80 00       	push   $0x8053b4
+  80318a:	e8 7a d0 ff ff       	call   800209 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  80318f:	83 c4 08             	add    $0x8,%esp
+  803192:	ff 73 0c             	push   0xc(%ebx)
+  803195:	68 d8 53 80 00       	push   $0x8053d8
+  80319a:	e8 6a d0 ff ff       	call   800209 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  80319f:	83 c4 08             	add    $0x8,%esp
+  8031a2:	ff 73 10             	push   0x10(%ebx)
+  8031a5:	68 fc 53 80 00       	push   $0x8053fc
+  8031aa:	e8 5a d0 ff ff       	call   800209 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  8031af:	83 c4 08             	add    $0x8,%esp
+  8031b2:	ff 35 08 b0 80 00    	push   0x80b008
+  8031b8:	68 38 54 80 00       	push   $0x805438
+  8031bd:	e8 47 d0 ff ff       	call   800209 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  8031c2:	83 c4 08             	add    $0x8,%esp
+  8031c5:	ff 35 04 b0 80 00    	push   0x80b004
+  8031cb:	68 6c 54 80 00       	push   $0x80546c
+  8031d0:	e8 34 d0 ff ff       	call   800209 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  8031d5:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8031da:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  8031dd:	8b 50 68             	mov    0x68(%eax),%edx
+  8031e0:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  8031e3:	51                   	push   %ecx
+  8031e4:	52                   	push   %edx
+  8031e5:	50                   	push   %eax
+  8031e6:	68 ac 54 80 00       	push   $0x8054ac
+  8031eb:	e8 19 d0 ff ff       	call   800209 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  8031f0:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8031f5:	8b 40 70             	mov    0x70(%eax),%eax
+  8031f8:	83 c4 18             	add    $0x18,%esp
+  8031fb:	50                   	push   %eax
+  8031fc:	68 e0 54 80 00       	push   $0x8054e0
+  803201:	e8 03 d0 ff ff       	call   800209 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  803206:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  80320c:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803212:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  803217:	51                   	push   %ecx
+  803218:	52                   	push   %edx
+  803219:	50                   	push   %eax
+  80321a:	68 10 55 80 00       	push   $0x805510
+  80321f:	e8 e5 cf ff ff       	call   800209 <cprintf>
+	cprintf("\n");
+  803224:	83 c4 14             	add    $0x14,%esp
+  803227:	68 7d 52 80 00       	push   $0x80527d
+  80322c:	e8 d8 cf ff ff       	call   800209 <cprintf>
+}
+  803231:	83 c4 10             	add    $0x10,%esp
+  803234:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803237:	c9                   	leave
+  803238:	c3                   	ret
+
+00803239 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  803239:	55                   	push   %ebp
+  80323a:	89 e5                	mov    %esp,%ebp
+  80323c:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  80323f:	e8 5e fe ff ff       	call   8030a2 <get_paging_stats>
+  803244:	83 ec 0c             	sub    $0xc,%esp
+  803247:	50                   	push   %eax
+  803248:	e8 ff fe ff ff       	call   80314c <print_paging_stats>
+}
+  80324d:	83 c4 10             	add    $0x10,%esp
+  803250:	c9                   	leave
+  803251:	c3                   	ret
+
+00803252 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803252:	55                   	push   %ebp
+  803253:	89 e5                	mov    %esp,%ebp
+  803255:	53                   	push   %ebx
+  803256:	83 ec 04             	sub    $0x4,%esp
+  803259:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  80325c:	eb 13                	jmp    803271 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  80325e:	83 ec 04             	sub    $0x4,%esp
+  803261:	6a ff                	push   $0xffffffff
+  803263:	53                   	push   %ebx
+  803264:	68 00 f0 ff ee       	push   $0xeefff000
+  803269:	e8 4e df ff ff       	call   8011bc <sys_futex_wait>
+  80326e:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803271:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  803276:	39 d8                	cmp    %ebx,%eax
+  803278:	74 e4                	je     80325e <mem_pressure_wait+0xc>
+	return now;
+}
+  80327a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80327d:	c9                   	leave
+  80327e:	c3                   	ret
+
+0080327f <init_map_dir>:
+
+void
+init_map_dir()
+{
+  80327f:	55                   	push   %ebp
+  803280:	89 e5                	mov    %esp,%ebp
+  803282:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  803285:	68 f1 3e 80 00       	push   $0x803ef1
+  80328a:	e8 81 e0 ff ff       	call   801310 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  80328f:	c7 05 10 e9 80 00 00 	movl   $0xdeadb000,0x80e910
+  803296:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  803299:	83 c4 0c             	add    $0xc,%esp
+  80329c:	68 07 02 00 00       	push   $0x207
+  8032a1:	68 00 b0 ad de       	push   $0xdeadb000
+  8032a6:	6a 00                	push   $0x0
+  8032a8:	e8 36 da ff ff       	call   800ce3 <sys_page_alloc>
+  8032ad:	83 c4 10             	add    $0x10,%esp
+  8032b0:	85 c0                	test   %eax,%eax
+  8032b2:	78 0c                	js     8032c0 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  8032b4:	e8 b4 f3 ff ff       	call   80266d <find_paging_env>
+	page_ring_ready();
+  8032b9:	e8 7f f2 ff ff       	call   80253d <page_ring_ready>
+}
+  8032be:	c9                   	leave
+  8032bf:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  8032c0:	50                   	push   %eax
+  8032c1:	68 9d 52 80 00       	push   $0x80529d
+  8032c6:	68 13 05 00 00       	push   $0x513
+  8032cb:	68 56 52 80 00       	push   $0x805256
+  8032d0:	e8 59 ce ff ff       	call   80012e <_panic>
+
+008032d5 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  8032d5:	55                   	push   %ebp
+  8032d6:	89 e5                	mov    %esp,%ebp
+  8032d8:	57                   	push   %edi
+  8032d9:	56                   	push   %esi
+  8032da:	53                   	push   %ebx
+  8032db:	83 ec 0c             	sub    $0xc,%esp
+  8032de:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  8032e1:	89 fa                	mov    %edi,%edx
+  8032e3:	c1 ea 16             	shr    $0x16,%edx
+  8032e6:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  8032eb:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  8032ee:	f6 06 01             	testb  $0x1,(%esi)
+  8032f1:	75 3e                	jne    803331 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  8032f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  8032f8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8032fc:	74 47                	je     803345 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  8032fe:	83 ec 0c             	sub    $0xc,%esp
+  803301:	6a 01                	push   $0x1
+  803303:	e8 f2 11 00 00       	call   8044fa <va_alloc>
+  803308:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  80330a:	83 c4 10             	add    $0x10,%esp
+  80330d:	85 c0                	test   %eax,%eax
+  80330f:	74 34                	je     803345 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803311:	6a 00                	push   $0x0
+  803313:	68 07 02 00 00       	push   $0x207
+  803318:	50                   	push   %eax
+  803319:	6a 00                	push   $0x0
+  80331b:	e8 df 02 00 00       	call   8035ff <page_alloc>
+  803320:	83 c4 10             	add    $0x10,%esp
+  803323:	85 c0                	test   %eax,%eax
+  803325:	78 28                	js     80334f <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  803327:	f6 06 01             	testb  $0x1,(%esi)
+  80332a:	75 38                	jne    803364 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  80332c:	83 cb 01             	or     $0x1,%ebx
+  80332f:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803331:	89 f8                	mov    %edi,%eax
+  803333:	c1 e8 0a             	shr    $0xa,%eax
+  803336:	25 fc 0f 00 00       	and    $0xffc,%eax
+  80333b:	8b 1e                	mov    (%esi),%ebx
+  80333d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803343:	01 c3                	add    %eax,%ebx
+}
+  803345:	89 d8                	mov    %ebx,%eax
+  803347:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80334a:	5b                   	pop    %ebx
+  80334b:	5e                   	pop    %esi
+  80334c:	5f                   	pop    %edi
+  80334d:	5d                   	pop    %ebp
+  80334e:	c3                   	ret
+			va_free(page, 1);
+  80334f:	83 ec 08             	sub    $0x8,%esp
+  803352:	6a 01                	push   $0x1
+  803354:	53                   	push   %ebx
+  803355:	e8 d8 12 00 00       	call   804632 <va_free>
+			return NULL;
+  80335a:	83 c4 10             	add    $0x10,%esp
+  80335d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803362:	eb e1                	jmp    803345 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  803364:	83 ec 08             	sub    $0x8,%esp
+  803367:	53                   	push   %ebx
+  803368:	6a 00                	push   $0x0
+  80336a:	e8 f9 d9 ff ff       	call   800d68 <sys_page_unmap>
+			va_free(page, 1);
+  80336f:	83 c4 08             	add    $0x8,%esp
+  803372:	6a 01                	push   $0x1
+  803374:	53                   	push   %ebx
+  803375:	e8 b8 12 00 00       	call   804632 <va_free>
+  80337a:	83 c4 10             	add    $0x10,%esp
+  80337d:	eb b2                	jmp    803331 <umapdir_walk+0x5c>
+
+0080337f <page_out>:
+{
+  80337f:	55                   	push   %ebp
+  803380:	89 e5                	mov    %esp,%ebp
+  803382:	57                   	push   %edi
+  803383:	56                   	push   %esi
+  803384:	53                   	push   %ebx
+  803385:	83 ec 5c             	sub    $0x5c,%esp
+  803388:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  80338b:	e8 dd f2 ff ff       	call   80266d <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803390:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803395:	85 c0                	test   %eax,%eax
+  803397:	74 1e                	je     8033b7 <page_out+0x38>
+  803399:	83 ec 0c             	sub    $0xc,%esp
+  80339c:	6a 00                	push   $0x0
+  80339e:	6a 00                	push   $0x0
+  8033a0:	6a 00                	push   $0x0
+  8033a2:	6a 08                	push   $0x8
+  8033a4:	50                   	push   %eax
+  8033a5:	e8 f1 15 00 00       	call   80499b <ipc_call>
+  8033aa:	89 c3                	mov    %eax,%ebx
+  8033ac:	83 c4 20             	add    $0x20,%esp
+  8033af:	85 c0                	test   %eax,%eax
+  8033b1:	0f 84 ac 00 00 00    	je     803463 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  8033b7:	83 ec 08             	sub    $0x8,%esp
+  8033ba:	ff 75 0c             	push   0xc(%ebp)
+  8033bd:	57                   	push   %edi
+  8033be:	e8 e9 f9 ff ff       	call   802dac <get_page_choice>
+  8033c3:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  8033c5:	83 c4 10             	add    $0x10,%esp
+  8033c8:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8033cd:	0f 84 18 02 00 00    	je     8035eb <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  8033d3:	e8 78 ee ff ff       	call   802250 <page_is_clean>
+  8033d8:	84 c0                	test   %al,%al
+  8033da:	0f 85 8c 00 00 00    	jne    80346c <page_out+0xed>
+	if (pagingenv == 0)
+  8033e0:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8033e7:	0f 84 08 02 00 00    	je     8035f5 <page_out+0x276>
+	if (page_ring_ready())
+  8033ed:	e8 4b f1 ff ff       	call   80253d <page_ring_ready>
+  8033f2:	89 c3                	mov    %eax,%ebx
+  8033f4:	85 c0                	test   %eax,%eax
+  8033f6:	0f 85 89 00 00 00    	jne    803485 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  8033fc:	83 ec 0c             	sub    $0xc,%esp
+  8033ff:	6a 05                	push   $0x5
+  803401:	6a 01                	push   $0x1
+  803403:	56                   	push   %esi
+  803404:	6a 01                	push   $0x1
+  803406:	ff 35 40 b0 80 00    	push   0x80b040
+  80340c:	e8 8a 15 00 00       	call   80499b <ipc_call>
+  803411:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803413:	83 c4 20             	add    $0x20,%esp
+  803416:	85 c0                	test   %eax,%eax
+  803418:	0f 88 b8 01 00 00    	js     8035d6 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  80341e:	89 f0                	mov    %esi,%eax
+  803420:	c1 e8 0c             	shr    $0xc,%eax
+  803423:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80342a:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  80342d:	83 ec 08             	sub    $0x8,%esp
+  803430:	56                   	push   %esi
+  803431:	6a 00                	push   $0x0
+  803433:	e8 30 d9 ff ff       	call   800d68 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803438:	83 c4 08             	add    $0x8,%esp
+  80343b:	6a 01                	push   $0x1
+  80343d:	56                   	push   %esi
+  80343e:	e8 92 fe ff ff       	call   8032d5 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803443:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803446:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  80344c:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  80344f:	09 fe                	or     %edi,%esi
+  803451:	83 ce 01             	or     $0x1,%esi
+  803454:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803456:	83 c4 10             	add    $0x10,%esp
+}
+  803459:	89 d8                	mov    %ebx,%eax
+  80345b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80345e:	5b                   	pop    %ebx
+  80345f:	5e                   	pop    %esi
+  803460:	5f                   	pop    %edi
+  803461:	5d                   	pop    %ebp
+  803462:	c3                   	ret
+		num_page_reclaims++;
+  803463:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  80346a:	eb ed                	jmp    803459 <page_out+0xda>
+		num_page_drops++;
+  80346c:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  803473:	83 ec 08             	sub    $0x8,%esp
+  803476:	56                   	push   %esi
+  803477:	6a 00                	push   $0x0
+  803479:	e8 ea d8 ff ff       	call   800d68 <sys_page_unmap>
+  80347e:	89 c3                	mov    %eax,%ebx
+  803480:	83 c4 10             	add    $0x10,%esp
+  803483:	eb d4                	jmp    803459 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803485:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803487:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80348c:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803491:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803494:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803496:	83 c0 08             	add    $0x8,%eax
+  803499:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  80349c:	b8 07 00 00 00       	mov    $0x7,%eax
+  8034a1:	e8 e5 ef ff ff       	call   80248b <page_ring_reserve>
+	first = ring->sq_tail;
+  8034a6:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8034ab:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  8034ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  8034b3:	83 ec 04             	sub    $0x4,%esp
+  8034b6:	68 00 10 00 00       	push   $0x1000
+  8034bb:	56                   	push   %esi
+  8034bc:	89 d8                	mov    %ebx,%eax
+  8034be:	c1 e0 0c             	shl    $0xc,%eax
+  8034c1:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  8034c6:	50                   	push   %eax
+  8034c7:	e8 0c d5 ff ff       	call   8009d8 <memcpy>
+		vas[n] = va;
+  8034cc:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  8034d0:	89 d9                	mov    %ebx,%ecx
+  8034d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034dc:	e8 de ee ff ff       	call   8023bf <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  8034e1:	8d 43 01             	lea    0x1(%ebx),%eax
+  8034e4:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  8034e7:	83 c4 10             	add    $0x10,%esp
+  8034ea:	83 fb 06             	cmp    $0x6,%ebx
+  8034ed:	74 62                	je     803551 <page_out+0x1d2>
+  8034ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8034f2:	eb 15                	jmp    803509 <page_out+0x18a>
+			num_page_drops++;
+  8034f4:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  8034fb:	83 ec 08             	sub    $0x8,%esp
+  8034fe:	56                   	push   %esi
+  8034ff:	6a 00                	push   $0x0
+  803501:	e8 62 d8 ff ff       	call   800d68 <sys_page_unmap>
+  803506:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803509:	83 ec 08             	sub    $0x8,%esp
+  80350c:	53                   	push   %ebx
+  80350d:	57                   	push   %edi
+  80350e:	e8 99 f8 ff ff       	call   802dac <get_page_choice>
+  803513:	89 c6                	mov    %eax,%esi
+  803515:	83 c4 10             	add    $0x10,%esp
+  803518:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  80351d:	74 32                	je     803551 <page_out+0x1d2>
+  80351f:	e8 2c ed ff ff       	call   802250 <page_is_clean>
+  803524:	84 c0                	test   %al,%al
+  803526:	75 cc                	jne    8034f4 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803528:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  80352b:	39 c6                	cmp    %eax,%esi
+  80352d:	72 07                	jb     803536 <page_out+0x1b7>
+  80352f:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803532:	39 c6                	cmp    %eax,%esi
+  803534:	72 1b                	jb     803551 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803536:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80353b:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  80353e:	eb 03                	jmp    803543 <page_out+0x1c4>
+  803540:	83 c3 01             	add    $0x1,%ebx
+  803543:	39 da                	cmp    %ebx,%edx
+  803545:	0f 84 68 ff ff ff    	je     8034b3 <page_out+0x134>
+  80354b:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  80354f:	75 ef                	jne    803540 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803551:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803554:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803557:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  80355a:	e8 a6 ee ff ff       	call   802405 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  80355f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803564:	eb 42                	jmp    8035a8 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803566:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  80356a:	89 f8                	mov    %edi,%eax
+  80356c:	c1 e8 0c             	shr    $0xc,%eax
+  80356f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803576:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803579:	83 ec 08             	sub    $0x8,%esp
+  80357c:	57                   	push   %edi
+  80357d:	6a 00                	push   $0x0
+  80357f:	e8 e4 d7 ff ff       	call   800d68 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803584:	83 c4 08             	add    $0x8,%esp
+  803587:	6a 01                	push   $0x1
+  803589:	57                   	push   %edi
+  80358a:	e8 46 fd ff ff       	call   8032d5 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  80358f:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803592:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803598:	c1 e6 0c             	shl    $0xc,%esi
+  80359b:	09 d6                	or     %edx,%esi
+  80359d:	83 ce 01             	or     $0x1,%esi
+  8035a0:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  8035a2:	83 c3 01             	add    $0x1,%ebx
+  8035a5:	83 c4 10             	add    $0x10,%esp
+  8035a8:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  8035ab:	39 c3                	cmp    %eax,%ebx
+  8035ad:	74 1d                	je     8035cc <page_out+0x24d>
+		if (res[i] < 0)
+  8035af:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  8035b3:	85 f6                	test   %esi,%esi
+  8035b5:	79 af                	jns    803566 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  8035b7:	56                   	push   %esi
+  8035b8:	68 40 55 80 00       	push   $0x805540
+  8035bd:	68 d1 02 00 00       	push   $0x2d1
+  8035c2:	68 56 52 80 00       	push   $0x805256
+  8035c7:	e8 62 cb ff ff       	call   80012e <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  8035cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035d1:	e9 83 fe ff ff       	jmp    803459 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  8035d6:	50                   	push   %eax
+  8035d7:	68 40 55 80 00       	push   $0x805540
+  8035dc:	68 0a 03 00 00       	push   $0x30a
+  8035e1:	68 56 52 80 00       	push   $0x805256
+  8035e6:	e8 43 cb ff ff       	call   80012e <_panic>
+		return -E_NO_MEM;
+  8035eb:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  8035f0:	e9 64 fe ff ff       	jmp    803459 <page_out+0xda>
+		return -E_PAGING;
+  8035f5:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8035fa:	e9 5a fe ff ff       	jmp    803459 <page_out+0xda>
+
+008035ff <page_alloc>:
+{
+  8035ff:	55                   	push   %ebp
+  803600:	89 e5                	mov    %esp,%ebp
+  803602:	57                   	push   %edi
+  803603:	56                   	push   %esi
+  803604:	53                   	push   %ebx
+  803605:	83 ec 0c             	sub    $0xc,%esp
+  803608:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80360b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  80360e:	83 3d 10 e9 80 00 00 	cmpl   $0x0,0x80e910
+  803615:	74 34                	je     80364b <page_alloc+0x4c>
+	if (check_mte)
+  803617:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  80361b:	75 35                	jne    803652 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  80361d:	83 ec 04             	sub    $0x4,%esp
+  803620:	ff 75 10             	push   0x10(%ebp)
+  803623:	56                   	push   %esi
+  803624:	57                   	push   %edi
+  803625:	e8 b9 d6 ff ff       	call   800ce3 <sys_page_alloc>
+  80362a:	89 c3                	mov    %eax,%ebx
+  80362c:	83 c4 10             	add    $0x10,%esp
+  80362f:	85 c0                	test   %eax,%eax
+  803631:	79 52                	jns    803685 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803633:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803636:	75 52                	jne    80368a <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803638:	83 ec 08             	sub    $0x8,%esp
+  80363b:	56                   	push   %esi
+  80363c:	57                   	push   %edi
+  80363d:	e8 3d fd ff ff       	call   80337f <page_out>
+  803642:	83 c4 10             	add    $0x10,%esp
+  803645:	85 c0                	test   %eax,%eax
+  803647:	79 d4                	jns    80361d <page_alloc+0x1e>
+  803649:	eb 3f                	jmp    80368a <page_alloc+0x8b>
+		init_map_dir();
+  80364b:	e8 2f fc ff ff       	call   80327f <init_map_dir>
+  803650:	eb c5                	jmp    803617 <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803652:	83 ec 08             	sub    $0x8,%esp
+  803655:	6a 00                	push   $0x0
+  803657:	56                   	push   %esi
+  803658:	e8 78 fc ff ff       	call   8032d5 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  80365d:	83 c4 10             	add    $0x10,%esp
+  803660:	85 c0                	test   %eax,%eax
+  803662:	74 b9                	je     80361d <page_alloc+0x1e>
+  803664:	8b 10                	mov    (%eax),%edx
+  803666:	f6 c2 01             	test   $0x1,%dl
+  803669:	74 b2                	je     80361d <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  80366b:	83 ec 08             	sub    $0x8,%esp
+  80366e:	56                   	push   %esi
+  80366f:	52                   	push   %edx
+  803670:	50                   	push   %eax
+  803671:	68 64 55 80 00       	push   $0x805564
+  803676:	68 34 03 00 00       	push   $0x334
+  80367b:	68 56 52 80 00       	push   $0x805256
+  803680:	e8 a9 ca ff ff       	call   80012e <_panic>
+	return 0;
+  803685:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80368a:	89 d8                	mov    %ebx,%eax
+  80368c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80368f:	5b                   	pop    %ebx
+  803690:	5e                   	pop    %esi
+  803691:	5f                   	pop    %edi
+  803692:	5d                   	pop    %ebp
+  803693:	c3                   	ret
+
+00803694 <page_adopt>:
+{
+  803694:	55                   	push   %ebp
+  803695:	89 e5                	mov    %esp,%ebp
+  803697:	56                   	push   %esi
+  803698:	53                   	push   %ebx
+  803699:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  80369b:	c1 e8 16             	shr    $0x16,%eax
+  80369e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8036a5:	25 81 00 00 00       	and    $0x81,%eax
+  8036aa:	83 f8 01             	cmp    $0x1,%eax
+  8036ad:	75 53                	jne    803702 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  8036af:	89 d8                	mov    %ebx,%eax
+  8036b1:	c1 e8 0c             	shr    $0xc,%eax
+  8036b4:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  8036bb:	89 f2                	mov    %esi,%edx
+  8036bd:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  8036c3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  8036c8:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  8036ce:	75 37                	jne    803707 <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  8036d0:	83 ec 08             	sub    $0x8,%esp
+  8036d3:	6a 01                	push   $0x1
+  8036d5:	53                   	push   %ebx
+  8036d6:	e8 fa fb ff ff       	call   8032d5 <umapdir_walk>
+  8036db:	83 c4 10             	add    $0x10,%esp
+  8036de:	85 c0                	test   %eax,%eax
+  8036e0:	74 2c                	je     80370e <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  8036e2:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  8036e8:	83 ce 01             	or     $0x1,%esi
+  8036eb:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  8036ed:	83 ec 08             	sub    $0x8,%esp
+  8036f0:	53                   	push   %ebx
+  8036f1:	6a 00                	push   $0x0
+  8036f3:	e8 70 d6 ff ff       	call   800d68 <sys_page_unmap>
+	return 1;
+  8036f8:	83 c4 10             	add    $0x10,%esp
+  8036fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  803700:	eb 05                	jmp    803707 <page_adopt+0x73>
+		return 0;
+  803702:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803707:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80370a:	5b                   	pop    %ebx
+  80370b:	5e                   	pop    %esi
+  80370c:	5d                   	pop    %ebp
+  80370d:	c3                   	ret
+		return -E_NO_MEM;
+  80370e:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803713:	eb f2                	jmp    803707 <page_adopt+0x73>
+
+00803715 <page_forget>:
+{
+  803715:	55                   	push   %ebp
+  803716:	89 e5                	mov    %esp,%ebp
+  803718:	53                   	push   %ebx
+  803719:	83 ec 04             	sub    $0x4,%esp
+  80371c:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  80371e:	e8 4a ef ff ff       	call   80266d <find_paging_env>
+	if (pagingenv == 0)
+  803723:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  80372a:	74 39                	je     803765 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  80372c:	89 d8                	mov    %ebx,%eax
+  80372e:	c1 e8 16             	shr    $0x16,%eax
+  803731:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803738:	25 81 00 00 00       	and    $0x81,%eax
+  80373d:	83 f8 01             	cmp    $0x1,%eax
+  803740:	74 28                	je     80376a <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803742:	83 3d 10 e9 80 00 00 	cmpl   $0x0,0x80e910
+  803749:	74 1a                	je     803765 <page_forget+0x50>
+  80374b:	83 ec 08             	sub    $0x8,%esp
+  80374e:	6a 00                	push   $0x0
+  803750:	53                   	push   %ebx
+  803751:	e8 7f fb ff ff       	call   8032d5 <umapdir_walk>
+  803756:	89 c3                	mov    %eax,%ebx
+  803758:	83 c4 10             	add    $0x10,%esp
+  80375b:	85 c0                	test   %eax,%eax
+  80375d:	74 06                	je     803765 <page_forget+0x50>
+  80375f:	8b 00                	mov    (%eax),%eax
+  803761:	a8 01                	test   $0x1,%al
+  803763:	75 2b                	jne    803790 <page_forget+0x7b>
+}
+  803765:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803768:	c9                   	leave
+  803769:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  80376a:	89 d8                	mov    %ebx,%eax
+  80376c:	c1 e8 0c             	shr    $0xc,%eax
+  80376f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803776:	89 c2                	mov    %eax,%edx
+  803778:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  80377e:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803784:	75 bc                	jne    803742 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803786:	c1 e8 0c             	shr    $0xc,%eax
+  803789:	e8 5c ee ff ff       	call   8025ea <page_remove_slot>
+		return;
+  80378e:	eb d5                	jmp    803765 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803790:	c1 e8 0c             	shr    $0xc,%eax
+  803793:	e8 52 ee ff ff       	call   8025ea <page_remove_slot>
+	*mte = 0;
+  803798:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80379e:	eb c5                	jmp    803765 <page_forget+0x50>
+
+008037a0 <page_unmap>:
+{
+  8037a0:	55                   	push   %ebp
+  8037a1:	89 e5                	mov    %esp,%ebp
+  8037a3:	57                   	push   %edi
+  8037a4:	56                   	push   %esi
+  8037a5:	53                   	push   %ebx
+  8037a6:	83 ec 0c             	sub    $0xc,%esp
+  8037a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8037ac:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  8037af:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8037b4:	8b 40 48             	mov    0x48(%eax),%eax
+  8037b7:	85 db                	test   %ebx,%ebx
+  8037b9:	0f 8e b4 00 00 00    	jle    803873 <page_unmap+0xd3>
+  8037bf:	39 d8                	cmp    %ebx,%eax
+  8037c1:	0f 84 ac 00 00 00    	je     803873 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  8037c7:	83 ec 08             	sub    $0x8,%esp
+  8037ca:	57                   	push   %edi
+  8037cb:	53                   	push   %ebx
+  8037cc:	e8 97 d5 ff ff       	call   800d68 <sys_page_unmap>
+  8037d1:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  8037d3:	e8 95 ee ff ff       	call   80266d <find_paging_env>
+	if (pagingenv == 0)
+  8037d8:	83 c4 10             	add    $0x10,%esp
+  8037db:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8037e2:	0f 84 a1 00 00 00    	je     803889 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8037e8:	83 ec 0c             	sub    $0xc,%esp
+  8037eb:	6a 05                	push   $0x5
+  8037ed:	68 00 00 40 00       	push   $0x400000
+  8037f2:	6a 00                	push   $0x0
+  8037f4:	68 00 b0 ad de       	push   $0xdeadb000
+  8037f9:	53                   	push   %ebx
+  8037fa:	e8 27 d5 ff ff       	call   800d26 <sys_page_map>
+  8037ff:	83 c4 20             	add    $0x20,%esp
+  803802:	85 c0                	test   %eax,%eax
+  803804:	0f 88 89 00 00 00    	js     803893 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  80380a:	89 f8                	mov    %edi,%eax
+  80380c:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  80380f:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803816:	a8 01                	test   $0x1,%al
+  803818:	74 6f                	je     803889 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80381a:	83 ec 0c             	sub    $0xc,%esp
+  80381d:	6a 05                	push   $0x5
+  80381f:	68 00 00 40 00       	push   $0x400000
+  803824:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803826:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80382b:	50                   	push   %eax
+  80382c:	53                   	push   %ebx
+  80382d:	e8 f4 d4 ff ff       	call   800d26 <sys_page_map>
+  803832:	83 c4 20             	add    $0x20,%esp
+  803835:	85 c0                	test   %eax,%eax
+  803837:	78 6f                	js     8038a8 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803839:	c1 ef 0c             	shr    $0xc,%edi
+  80383c:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803842:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803849:	01 
+  80384a:	74 3d                	je     803889 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  80384c:	83 ec 08             	sub    $0x8,%esp
+  80384f:	68 00 00 40 00       	push   $0x400000
+  803854:	6a 00                	push   $0x0
+  803856:	e8 0d d5 ff ff       	call   800d68 <sys_page_unmap>
+  80385b:	83 c4 10             	add    $0x10,%esp
+  80385e:	85 c0                	test   %eax,%eax
+  803860:	78 5b                	js     8038bd <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803862:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803869:	c1 e8 0c             	shr    $0xc,%eax
+  80386c:	e8 79 ed ff ff       	call   8025ea <page_remove_slot>
+	return r;
+  803871:	eb 16                	jmp    803889 <page_unmap+0xe9>
+		page_forget(va);
+  803873:	89 f8                	mov    %edi,%eax
+  803875:	e8 9b fe ff ff       	call   803715 <page_forget>
+		return sys_page_unmap(envid, va);
+  80387a:	83 ec 08             	sub    $0x8,%esp
+  80387d:	57                   	push   %edi
+  80387e:	53                   	push   %ebx
+  80387f:	e8 e4 d4 ff ff       	call   800d68 <sys_page_unmap>
+  803884:	89 c6                	mov    %eax,%esi
+  803886:	83 c4 10             	add    $0x10,%esp
+}
+  803889:	89 f0                	mov    %esi,%eax
+  80388b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80388e:	5b                   	pop    %ebx
+  80388f:	5e                   	pop    %esi
+  803890:	5f                   	pop    %edi
+  803891:	5d                   	pop    %ebp
+  803892:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803893:	50                   	push   %eax
+  803894:	68 a0 55 80 00       	push   $0x8055a0
+  803899:	68 e4 03 00 00       	push   $0x3e4
+  80389e:	68 56 52 80 00       	push   $0x805256
+  8038a3:	e8 86 c8 ff ff       	call   80012e <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  8038a8:	50                   	push   %eax
+  8038a9:	68 cc 55 80 00       	push   $0x8055cc
+  8038ae:	68 ea 03 00 00       	push   $0x3ea
+  8038b3:	68 56 52 80 00       	push   $0x805256
+  8038b8:	e8 71 c8 ff ff       	call   80012e <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  8038bd:	50                   	push   %eax
+  8038be:	68 f8 55 80 00       	push   $0x8055f8
+  8038c3:	68 ef 03 00 00       	push   $0x3ef
+  8038c8:	68 56 52 80 00       	push   $0x805256
+  8038cd:	e8 5c c8 ff ff       	call   80012e <_panic>
+
+008038d2 <page_unmap_range>:
+{
+  8038d2:	55                   	push   %ebp
+  8038d3:	89 e5                	mov    %esp,%ebp
+  8038d5:	57                   	push   %edi
+  8038d6:	56                   	push   %esi
+  8038d7:	53                   	push   %ebx
+  8038d8:	83 ec 0c             	sub    $0xc,%esp
+  8038db:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  8038de:	e8 8a ed ff ff       	call   80266d <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  8038e3:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8038e8:	8b 40 48             	mov    0x48(%eax),%eax
+  8038eb:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8038ef:	7e 38                	jle    803929 <page_unmap_range+0x57>
+  8038f1:	3b 45 08             	cmp    0x8(%ebp),%eax
+  8038f4:	74 33                	je     803929 <page_unmap_range+0x57>
+  8038f6:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8038fd:	74 2a                	je     803929 <page_unmap_range+0x57>
+  8038ff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  803902:	be 00 00 00 00       	mov    $0x0,%esi
+  803907:	39 fe                	cmp    %edi,%esi
+  803909:	74 56                	je     803961 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  80390b:	83 ec 08             	sub    $0x8,%esp
+  80390e:	53                   	push   %ebx
+  80390f:	ff 75 08             	push   0x8(%ebp)
+  803912:	e8 89 fe ff ff       	call   8037a0 <page_unmap>
+  803917:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80391d:	83 c4 10             	add    $0x10,%esp
+  803920:	85 c0                	test   %eax,%eax
+  803922:	78 35                	js     803959 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  803924:	83 c6 01             	add    $0x1,%esi
+  803927:	eb de                	jmp    803907 <page_unmap_range+0x35>
+  803929:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  80392c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803931:	eb 10                	jmp    803943 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803933:	89 f0                	mov    %esi,%eax
+  803935:	e8 db fd ff ff       	call   803715 <page_forget>
+		for (i = 0; i < npages; i++)
+  80393a:	83 c3 01             	add    $0x1,%ebx
+  80393d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803943:	39 fb                	cmp    %edi,%ebx
+  803945:	75 ec                	jne    803933 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  803947:	83 ec 04             	sub    $0x4,%esp
+  80394a:	57                   	push   %edi
+  80394b:	ff 75 0c             	push   0xc(%ebp)
+  80394e:	ff 75 08             	push   0x8(%ebp)
+  803951:	e8 26 d5 ff ff       	call   800e7c <sys_page_unmap_range>
+  803956:	83 c4 10             	add    $0x10,%esp
+}
+  803959:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80395c:	5b                   	pop    %ebx
+  80395d:	5e                   	pop    %esi
+  80395e:	5f                   	pop    %edi
+  80395f:	5d                   	pop    %ebp
+  803960:	c3                   	ret
+	return 0;
+  803961:	b8 00 00 00 00       	mov    $0x0,%eax
+  803966:	eb f1                	jmp    803959 <page_unmap_range+0x87>
+
+00803968 <page_alloc_range>:
+{
+  803968:	55                   	push   %ebp
+  803969:	89 e5                	mov    %esp,%ebp
+  80396b:	57                   	push   %edi
+  80396c:	56                   	push   %esi
+  80396d:	53                   	push   %ebx
+  80396e:	83 ec 1c             	sub    $0x1c,%esp
+  803971:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803974:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  803977:	83 3d 10 e9 80 00 00 	cmpl   $0x0,0x80e910
+  80397e:	74 14                	je     803994 <page_alloc_range+0x2c>
+	if (check_mte)
+  803980:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803984:	74 66                	je     8039ec <page_alloc_range+0x84>
+  803986:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  803988:	b8 00 00 00 00       	mov    $0x0,%eax
+  80398d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803990:	89 c7                	mov    %eax,%edi
+  803992:	eb 10                	jmp    8039a4 <page_alloc_range+0x3c>
+		init_map_dir();
+  803994:	e8 e6 f8 ff ff       	call   80327f <init_map_dir>
+  803999:	eb e5                	jmp    803980 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  80399b:	83 c7 01             	add    $0x1,%edi
+  80399e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8039a4:	39 df                	cmp    %ebx,%edi
+  8039a6:	74 38                	je     8039e0 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  8039a8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8039ab:	83 ec 08             	sub    $0x8,%esp
+  8039ae:	6a 00                	push   $0x0
+  8039b0:	56                   	push   %esi
+  8039b1:	e8 1f f9 ff ff       	call   8032d5 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  8039b6:	83 c4 10             	add    $0x10,%esp
+  8039b9:	85 c0                	test   %eax,%eax
+  8039bb:	74 de                	je     80399b <page_alloc_range+0x33>
+  8039bd:	8b 10                	mov    (%eax),%edx
+  8039bf:	f6 c2 01             	test   $0x1,%dl
+  8039c2:	74 d7                	je     80399b <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  8039c4:	83 ec 08             	sub    $0x8,%esp
+  8039c7:	ff 75 e4             	push   -0x1c(%ebp)
+  8039ca:	52                   	push   %edx
+  8039cb:	50                   	push   %eax
+  8039cc:	68 64 55 80 00       	push   $0x805564
+  8039d1:	68 0b 04 00 00       	push   $0x40b
+  8039d6:	68 56 52 80 00       	push   $0x805256
+  8039db:	e8 4e c7 ff ff       	call   80012e <_panic>
+  8039e0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8039e3:	eb 07                	jmp    8039ec <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  8039e5:	c1 e0 0c             	shl    $0xc,%eax
+  8039e8:	01 c7                	add    %eax,%edi
+			npages -= r;
+  8039ea:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  8039ec:	85 db                	test   %ebx,%ebx
+  8039ee:	74 30                	je     803a20 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  8039f0:	ff 75 14             	push   0x14(%ebp)
+  8039f3:	53                   	push   %ebx
+  8039f4:	57                   	push   %edi
+  8039f5:	ff 75 08             	push   0x8(%ebp)
+  8039f8:	e8 11 d4 ff ff       	call   800e0e <sys_page_alloc_range>
+  8039fd:	89 c6                	mov    %eax,%esi
+  8039ff:	83 c4 10             	add    $0x10,%esp
+  803a02:	85 c0                	test   %eax,%eax
+  803a04:	7f df                	jg     8039e5 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  803a06:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  803a09:	75 1a                	jne    803a25 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  803a0b:	83 ec 08             	sub    $0x8,%esp
+  803a0e:	57                   	push   %edi
+  803a0f:	ff 75 08             	push   0x8(%ebp)
+  803a12:	e8 68 f9 ff ff       	call   80337f <page_out>
+  803a17:	83 c4 10             	add    $0x10,%esp
+  803a1a:	85 c0                	test   %eax,%eax
+  803a1c:	79 ce                	jns    8039ec <page_alloc_range+0x84>
+  803a1e:	eb 05                	jmp    803a25 <page_alloc_range+0xbd>
+	return 0;
+  803a20:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803a25:	89 f0                	mov    %esi,%eax
+  803a27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a2a:	5b                   	pop    %ebx
+  803a2b:	5e                   	pop    %esi
+  803a2c:	5f                   	pop    %edi
+  803a2d:	5d                   	pop    %ebp
+  803a2e:	c3                   	ret
+
+00803a2f <page_in>:
+{
+  803a2f:	55                   	push   %ebp
+  803a30:	89 e5                	mov    %esp,%ebp
+  803a32:	57                   	push   %edi
+  803a33:	56                   	push   %esi
+  803a34:	53                   	push   %ebx
+  803a35:	83 ec 3c             	sub    $0x3c,%esp
+  803a38:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  803a3b:	e8 2d ec ff ff       	call   80266d <find_paging_env>
+	if (pagingenv == 0)
+  803a40:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803a47:	0f 84 09 02 00 00    	je     803c56 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  803a4d:	83 ec 08             	sub    $0x8,%esp
+  803a50:	6a 00                	push   $0x0
+  803a52:	56                   	push   %esi
+  803a53:	e8 7d f8 ff ff       	call   8032d5 <umapdir_walk>
+  803a58:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803a5a:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803a60:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  803a63:	83 c4 10             	add    $0x10,%esp
+  803a66:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803a6a:	74 0d                	je     803a79 <page_in+0x4a>
+  803a6c:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803a71:	8b 40 48             	mov    0x48(%eax),%eax
+  803a74:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803a77:	75 06                	jne    803a7f <page_in+0x50>
+  803a79:	8b 03                	mov    (%ebx),%eax
+  803a7b:	a8 02                	test   $0x2,%al
+  803a7d:	75 63                	jne    803ae2 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  803a7f:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803a81:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803a83:	89 f0                	mov    %esi,%eax
+  803a85:	25 06 0e 00 00       	and    $0xe06,%eax
+  803a8a:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803a8d:	50                   	push   %eax
+  803a8e:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803a91:	57                   	push   %edi
+  803a92:	ff 75 08             	push   0x8(%ebp)
+  803a95:	e8 65 fb ff ff       	call   8035ff <page_alloc>
+  803a9a:	83 c4 10             	add    $0x10,%esp
+  803a9d:	85 c0                	test   %eax,%eax
+  803a9f:	78 39                	js     803ada <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  803aa1:	89 f0                	mov    %esi,%eax
+  803aa3:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803aa6:	83 ec 0c             	sub    $0xc,%esp
+  803aa9:	6a 07                	push   $0x7
+  803aab:	6a 01                	push   $0x1
+  803aad:	57                   	push   %edi
+  803aae:	c1 e0 04             	shl    $0x4,%eax
+  803ab1:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803ab2:	c1 ee 1c             	shr    $0x1c,%esi
+  803ab5:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803ab8:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803abf:	e8 d7 0e 00 00       	call   80499b <ipc_call>
+  803ac4:	83 c4 20             	add    $0x20,%esp
+  803ac7:	85 c0                	test   %eax,%eax
+  803ac9:	0f 88 72 01 00 00    	js     803c41 <page_in+0x212>
+	*mte = 0;
+  803acf:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  803ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ada:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803add:	5b                   	pop    %ebx
+  803ade:	5e                   	pop    %esi
+  803adf:	5f                   	pop    %edi
+  803ae0:	5d                   	pop    %ebp
+  803ae1:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803ae2:	25 06 0e 00 00       	and    $0xe06,%eax
+  803ae7:	83 c8 01             	or     $0x1,%eax
+  803aea:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  803aed:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803af0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  803af3:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  803af9:	be 01 00 00 00       	mov    $0x1,%esi
+  803afe:	eb 46                	jmp    803b46 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  803b00:	83 ec 08             	sub    $0x8,%esp
+  803b03:	6a 00                	push   $0x0
+  803b05:	51                   	push   %ecx
+  803b06:	e8 ca f7 ff ff       	call   8032d5 <umapdir_walk>
+  803b0b:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  803b0f:	83 c4 10             	add    $0x10,%esp
+  803b12:	85 c0                	test   %eax,%eax
+  803b14:	74 66                	je     803b7c <page_in+0x14d>
+  803b16:	8b 00                	mov    (%eax),%eax
+  803b18:	a8 01                	test   $0x1,%al
+  803b1a:	74 60                	je     803b7c <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  803b1c:	89 c2                	mov    %eax,%edx
+  803b1e:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  803b24:	83 ca 01             	or     $0x1,%edx
+  803b27:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  803b2a:	75 50                	jne    803b7c <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  803b2c:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803b32:	c1 e8 1c             	shr    $0x1c,%eax
+  803b35:	8b 13                	mov    (%ebx),%edx
+  803b37:	c1 ea 1c             	shr    $0x1c,%edx
+  803b3a:	39 d0                	cmp    %edx,%eax
+  803b3c:	75 3e                	jne    803b7c <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803b3e:	83 c6 01             	add    $0x1,%esi
+  803b41:	83 fe 08             	cmp    $0x8,%esi
+  803b44:	74 3f                	je     803b85 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  803b46:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803b48:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  803b4e:	77 2c                	ja     803b7c <page_in+0x14d>
+  803b50:	89 f8                	mov    %edi,%eax
+  803b52:	c1 e8 16             	shr    $0x16,%eax
+  803b55:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803b5c:	f6 c2 01             	test   $0x1,%dl
+  803b5f:	74 9f                	je     803b00 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803b61:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803b68:	a8 80                	test   $0x80,%al
+  803b6a:	75 10                	jne    803b7c <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803b6c:	89 f8                	mov    %edi,%eax
+  803b6e:	c1 e8 0c             	shr    $0xc,%eax
+  803b71:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b78:	a8 01                	test   $0x1,%al
+  803b7a:	74 84                	je     803b00 <page_in+0xd1>
+	if (n == 1)
+  803b7c:	83 fe 01             	cmp    $0x1,%esi
+  803b7f:	0f 84 fa fe ff ff    	je     803a7f <page_in+0x50>
+	req.nslots = n;
+  803b85:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  803b8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b90:	eb 13                	jmp    803ba5 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  803b92:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  803b96:	8b 12                	mov    (%edx),%edx
+  803b98:	c1 ea 0c             	shr    $0xc,%edx
+  803b9b:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  803ba2:	83 c0 01             	add    $0x1,%eax
+  803ba5:	39 c6                	cmp    %eax,%esi
+  803ba7:	75 e9                	jne    803b92 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  803ba9:	83 ec 0c             	sub    $0xc,%esp
+  803bac:	6a 00                	push   $0x0
+  803bae:	ff 75 c0             	push   -0x40(%ebp)
+  803bb1:	56                   	push   %esi
+  803bb2:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803bb5:	57                   	push   %edi
+  803bb6:	6a 00                	push   $0x0
+  803bb8:	e8 ab fd ff ff       	call   803968 <page_alloc_range>
+  803bbd:	83 c4 20             	add    $0x20,%esp
+  803bc0:	85 c0                	test   %eax,%eax
+  803bc2:	78 6e                	js     803c32 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  803bc4:	83 ec 04             	sub    $0x4,%esp
+  803bc7:	6a 24                	push   $0x24
+  803bc9:	68 00 80 80 00       	push   $0x808000
+  803bce:	57                   	push   %edi
+  803bcf:	e8 a2 cd ff ff       	call   800976 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803bd4:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803bdb:	56                   	push   %esi
+  803bdc:	57                   	push   %edi
+  803bdd:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803bdf:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  803be6:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803be9:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  803bf0:	e8 a6 0d 00 00       	call   80499b <ipc_call>
+  803bf5:	83 c4 20             	add    $0x20,%esp
+  803bf8:	85 c0                	test   %eax,%eax
+  803bfa:	78 08                	js     803c04 <page_in+0x1d5>
+  803bfc:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  803bff:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  803c02:	eb 20                	jmp    803c24 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  803c04:	50                   	push   %eax
+  803c05:	68 24 56 80 00       	push   $0x805624
+  803c0a:	68 59 02 00 00       	push   $0x259
+  803c0f:	68 56 52 80 00       	push   $0x805256
+  803c14:	e8 15 c5 ff ff       	call   80012e <_panic>
+		*mtes[i] = 0;
+  803c19:	8b 10                	mov    (%eax),%edx
+  803c1b:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  803c21:	83 c0 04             	add    $0x4,%eax
+  803c24:	39 c8                	cmp    %ecx,%eax
+  803c26:	75 f1                	jne    803c19 <page_in+0x1ea>
+	return n;
+  803c28:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  803c2a:	85 f6                	test   %esi,%esi
+  803c2c:	0f 84 4d fe ff ff    	je     803a7f <page_in+0x50>
+		return r < 0 ? r : 0;
+  803c32:	85 c0                	test   %eax,%eax
+  803c34:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c39:	0f 4f c2             	cmovg  %edx,%eax
+  803c3c:	e9 99 fe ff ff       	jmp    803ada <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  803c41:	50                   	push   %eax
+  803c42:	68 5c 56 80 00       	push   $0x80565c
+  803c47:	68 9a 02 00 00       	push   $0x29a
+  803c4c:	68 56 52 80 00       	push   $0x805256
+  803c51:	e8 d8 c4 ff ff       	call   80012e <_panic>
+		return -E_PAGING;
+  803c56:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803c5b:	e9 7a fe ff ff       	jmp    803ada <page_in+0xab>
+
+00803c60 <page_map>:
+{
+  803c60:	55                   	push   %ebp
+  803c61:	89 e5                	mov    %esp,%ebp
+  803c63:	57                   	push   %edi
+  803c64:	56                   	push   %esi
+  803c65:	53                   	push   %ebx
+  803c66:	83 ec 1c             	sub    $0x1c,%esp
+  803c69:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803c6c:	83 ec 0c             	sub    $0xc,%esp
+  803c6f:	ff 75 18             	push   0x18(%ebp)
+  803c72:	ff 75 14             	push   0x14(%ebp)
+  803c75:	ff 75 10             	push   0x10(%ebp)
+  803c78:	ff 75 0c             	push   0xc(%ebp)
+  803c7b:	56                   	push   %esi
+  803c7c:	e8 a5 d0 ff ff       	call   800d26 <sys_page_map>
+  803c81:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803c84:	83 c4 20             	add    $0x20,%esp
+  803c87:	85 c0                	test   %eax,%eax
+  803c89:	0f 89 a9 01 00 00    	jns    803e38 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  803c8f:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  803c93:	74 5f                	je     803cf4 <page_map+0x94>
+		if (r != -E_INVAL)
+  803c95:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  803c99:	0f 85 a0 01 00 00    	jne    803e3f <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803c9f:	85 f6                	test   %esi,%esi
+  803ca1:	74 70                	je     803d13 <page_map+0xb3>
+  803ca3:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803ca8:	8b 40 48             	mov    0x48(%eax),%eax
+  803cab:	39 f0                	cmp    %esi,%eax
+  803cad:	74 64                	je     803d13 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803caf:	83 ec 0c             	sub    $0xc,%esp
+  803cb2:	6a 05                	push   $0x5
+  803cb4:	68 00 00 40 00       	push   $0x400000
+  803cb9:	6a 00                	push   $0x0
+  803cbb:	68 00 b0 ad de       	push   $0xdeadb000
+  803cc0:	56                   	push   %esi
+  803cc1:	e8 60 d0 ff ff       	call   800d26 <sys_page_map>
+  803cc6:	89 c3                	mov    %eax,%ebx
+  803cc8:	83 c4 20             	add    $0x20,%esp
+  803ccb:	85 c0                	test   %eax,%eax
+  803ccd:	79 6a                	jns    803d39 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  803ccf:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803cd2:	75 50                	jne    803d24 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  803cd4:	83 ec 08             	sub    $0x8,%esp
+  803cd7:	68 00 00 40 00       	push   $0x400000
+  803cdc:	6a fc                	push   $0xfffffffc
+  803cde:	e8 9c f6 ff ff       	call   80337f <page_out>
+  803ce3:	83 c4 10             	add    $0x10,%esp
+  803ce6:	85 c0                	test   %eax,%eax
+  803ce8:	79 c5                	jns    803caf <page_map+0x4f>
+}
+  803cea:	89 d8                	mov    %ebx,%eax
+  803cec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cef:	5b                   	pop    %ebx
+  803cf0:	5e                   	pop    %esi
+  803cf1:	5f                   	pop    %edi
+  803cf2:	5d                   	pop    %ebp
+  803cf3:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  803cf4:	83 ec 08             	sub    $0x8,%esp
+  803cf7:	68 00 00 40 00       	push   $0x400000
+  803cfc:	6a 00                	push   $0x0
+  803cfe:	e8 7c f6 ff ff       	call   80337f <page_out>
+  803d03:	83 c4 10             	add    $0x10,%esp
+  803d06:	85 c0                	test   %eax,%eax
+  803d08:	0f 89 5e ff ff ff    	jns    803c6c <page_map+0xc>
+				return r;
+  803d0e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803d11:	eb d7                	jmp    803cea <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803d13:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d16:	e8 79 f9 ff ff       	call   803694 <page_adopt>
+  803d1b:	85 c0                	test   %eax,%eax
+  803d1d:	79 90                	jns    803caf <page_map+0x4f>
+			return r;
+  803d1f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803d22:	eb c6                	jmp    803cea <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  803d24:	53                   	push   %ebx
+  803d25:	68 90 56 80 00       	push   $0x805690
+  803d2a:	68 77 03 00 00       	push   $0x377
+  803d2f:	68 56 52 80 00       	push   $0x805256
+  803d34:	e8 f5 c3 ff ff       	call   80012e <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  803d39:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d3c:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803d3f:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  803d46:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  803d4c:	0f 84 f5 00 00 00    	je     803e47 <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803d52:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803d58:	83 ec 0c             	sub    $0xc,%esp
+  803d5b:	6a 05                	push   $0x5
+  803d5d:	68 00 00 40 00       	push   $0x400000
+  803d62:	6a 00                	push   $0x0
+  803d64:	57                   	push   %edi
+  803d65:	56                   	push   %esi
+  803d66:	e8 bb cf ff ff       	call   800d26 <sys_page_map>
+  803d6b:	89 c3                	mov    %eax,%ebx
+  803d6d:	83 c4 20             	add    $0x20,%esp
+  803d70:	85 c0                	test   %eax,%eax
+  803d72:	79 35                	jns    803da9 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  803d74:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803d77:	75 1b                	jne    803d94 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803d79:	83 ec 08             	sub    $0x8,%esp
+  803d7c:	68 00 00 40 00       	push   $0x400000
+  803d81:	6a 00                	push   $0x0
+  803d83:	e8 f7 f5 ff ff       	call   80337f <page_out>
+  803d88:	83 c4 10             	add    $0x10,%esp
+  803d8b:	85 c0                	test   %eax,%eax
+  803d8d:	79 c9                	jns    803d58 <page_map+0xf8>
+  803d8f:	e9 56 ff ff ff       	jmp    803cea <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  803d94:	53                   	push   %ebx
+  803d95:	68 b8 56 80 00       	push   $0x8056b8
+  803d9a:	68 83 03 00 00       	push   $0x383
+  803d9f:	68 56 52 80 00       	push   $0x805256
+  803da4:	e8 85 c3 ff ff       	call   80012e <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  803da9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803dac:	c1 e8 0c             	shr    $0xc,%eax
+  803daf:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803db4:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  803dbb:	01 
+  803dbc:	0f 84 8d 00 00 00    	je     803e4f <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803dc2:	83 ec 08             	sub    $0x8,%esp
+  803dc5:	68 00 00 40 00       	push   $0x400000
+  803dca:	6a 00                	push   $0x0
+  803dcc:	e8 97 cf ff ff       	call   800d68 <sys_page_unmap>
+  803dd1:	83 c4 10             	add    $0x10,%esp
+  803dd4:	85 c0                	test   %eax,%eax
+  803dd6:	78 36                	js     803e0e <page_map+0x1ae>
+  803dd8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  803ddb:	83 ec 08             	sub    $0x8,%esp
+  803dde:	57                   	push   %edi
+  803ddf:	56                   	push   %esi
+  803de0:	e8 4a fc ff ff       	call   803a2f <page_in>
+  803de5:	89 c3                	mov    %eax,%ebx
+  803de7:	83 c4 10             	add    $0x10,%esp
+  803dea:	85 c0                	test   %eax,%eax
+  803dec:	0f 89 7a fe ff ff    	jns    803c6c <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  803df2:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803df5:	75 2c                	jne    803e23 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  803df7:	83 ec 08             	sub    $0x8,%esp
+  803dfa:	57                   	push   %edi
+  803dfb:	6a 00                	push   $0x0
+  803dfd:	e8 7d f5 ff ff       	call   80337f <page_out>
+  803e02:	83 c4 10             	add    $0x10,%esp
+  803e05:	85 c0                	test   %eax,%eax
+  803e07:	79 d2                	jns    803ddb <page_map+0x17b>
+  803e09:	e9 dc fe ff ff       	jmp    803cea <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  803e0e:	50                   	push   %eax
+  803e0f:	68 e4 56 80 00       	push   $0x8056e4
+  803e14:	68 8b 03 00 00       	push   $0x38b
+  803e19:	68 56 52 80 00       	push   $0x805256
+  803e1e:	e8 0b c3 ff ff       	call   80012e <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  803e23:	53                   	push   %ebx
+  803e24:	68 0c 57 80 00       	push   $0x80570c
+  803e29:	68 91 03 00 00       	push   $0x391
+  803e2e:	68 56 52 80 00       	push   $0x805256
+  803e33:	e8 f6 c2 ff ff       	call   80012e <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803e38:	89 c3                	mov    %eax,%ebx
+  803e3a:	e9 ab fe ff ff       	jmp    803cea <page_map+0x8a>
+  803e3f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e42:	e9 a3 fe ff ff       	jmp    803cea <page_map+0x8a>
+			return r; // Pass through the error
+  803e47:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e4a:	e9 9b fe ff ff       	jmp    803cea <page_map+0x8a>
+			return r; // Pass through the error
+  803e4f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e52:	e9 93 fe ff ff       	jmp    803cea <page_map+0x8a>
+
+00803e57 <page_map_range>:
+{
+  803e57:	55                   	push   %ebp
+  803e58:	89 e5                	mov    %esp,%ebp
+  803e5a:	57                   	push   %edi
+  803e5b:	56                   	push   %esi
+  803e5c:	53                   	push   %ebx
+  803e5d:	83 ec 0c             	sub    $0xc,%esp
+  803e60:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803e63:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  803e66:	83 ec 08             	sub    $0x8,%esp
+  803e69:	ff 75 1c             	push   0x1c(%ebp)
+  803e6c:	ff 75 18             	push   0x18(%ebp)
+  803e6f:	56                   	push   %esi
+  803e70:	ff 75 10             	push   0x10(%ebp)
+  803e73:	57                   	push   %edi
+  803e74:	ff 75 08             	push   0x8(%ebp)
+  803e77:	e8 b5 cf ff ff       	call   800e31 <sys_page_map_range>
+  803e7c:	89 c3                	mov    %eax,%ebx
+  803e7e:	83 c4 20             	add    $0x20,%esp
+  803e81:	85 c0                	test   %eax,%eax
+  803e83:	79 1b                	jns    803ea0 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  803e85:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803e88:	75 20                	jne    803eaa <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803e8a:	83 ec 08             	sub    $0x8,%esp
+  803e8d:	68 00 00 40 00       	push   $0x400000
+  803e92:	6a 00                	push   $0x0
+  803e94:	e8 e6 f4 ff ff       	call   80337f <page_out>
+  803e99:	83 c4 10             	add    $0x10,%esp
+  803e9c:	85 c0                	test   %eax,%eax
+  803e9e:	79 c6                	jns    803e66 <page_map_range+0xf>
+}
+  803ea0:	89 d8                	mov    %ebx,%eax
+  803ea2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ea5:	5b                   	pop    %ebx
+  803ea6:	5e                   	pop    %esi
+  803ea7:	5f                   	pop    %edi
+  803ea8:	5d                   	pop    %ebp
+  803ea9:	c3                   	ret
+		if (r != -E_INVAL)
+  803eaa:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  803ead:	75 f1                	jne    803ea0 <page_map_range+0x49>
+  803eaf:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  803eb1:	be 00 00 00 00       	mov    $0x0,%esi
+  803eb6:	eb 03                	jmp    803ebb <page_map_range+0x64>
+  803eb8:	83 c6 01             	add    $0x1,%esi
+  803ebb:	3b 75 18             	cmp    0x18(%ebp),%esi
+  803ebe:	74 2a                	je     803eea <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  803ec0:	83 ec 0c             	sub    $0xc,%esp
+  803ec3:	ff 75 1c             	push   0x1c(%ebp)
+  803ec6:	53                   	push   %ebx
+  803ec7:	ff 75 10             	push   0x10(%ebp)
+  803eca:	57                   	push   %edi
+  803ecb:	ff 75 08             	push   0x8(%ebp)
+  803ece:	e8 8d fd ff ff       	call   803c60 <page_map>
+  803ed3:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803ed9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803edf:	83 c4 20             	add    $0x20,%esp
+  803ee2:	85 c0                	test   %eax,%eax
+  803ee4:	79 d2                	jns    803eb8 <page_map_range+0x61>
+  803ee6:	89 c3                	mov    %eax,%ebx
+  803ee8:	eb b6                	jmp    803ea0 <page_map_range+0x49>
+		return 0;
+  803eea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803eef:	eb af                	jmp    803ea0 <page_map_range+0x49>
+
+00803ef1 <paging_pgfault_handler>:
+{
+  803ef1:	55                   	push   %ebp
+  803ef2:	89 e5                	mov    %esp,%ebp
+  803ef4:	56                   	push   %esi
+  803ef5:	53                   	push   %ebx
+  803ef6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  803ef9:	e8 6f e7 ff ff       	call   80266d <find_paging_env>
+	if (pagingenv == 0)
+  803efe:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803f03:	85 c0                	test   %eax,%eax
+  803f05:	74 3c                	je     803f43 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  803f07:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803f09:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803f0d:	75 12                	jne    803f21 <paging_pgfault_handler+0x30>
+  803f0f:	89 f0                	mov    %esi,%eax
+  803f11:	e8 7e f7 ff ff       	call   803694 <page_adopt>
+  803f16:	89 c2                	mov    %eax,%edx
+		return 0;
+  803f18:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803f1d:	85 d2                	test   %edx,%edx
+  803f1f:	78 22                	js     803f43 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  803f21:	83 ec 08             	sub    $0x8,%esp
+  803f24:	6a 00                	push   $0x0
+  803f26:	56                   	push   %esi
+  803f27:	e8 a9 f3 ff ff       	call   8032d5 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  803f2c:	83 c4 10             	add    $0x10,%esp
+  803f2f:	85 c0                	test   %eax,%eax
+  803f31:	74 05                	je     803f38 <paging_pgfault_handler+0x47>
+  803f33:	f6 00 01             	testb  $0x1,(%eax)
+  803f36:	75 12                	jne    803f4a <paging_pgfault_handler+0x59>
+	return 0;
+  803f38:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f3d:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803f41:	74 23                	je     803f66 <paging_pgfault_handler+0x75>
+}
+  803f43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f46:	5b                   	pop    %ebx
+  803f47:	5e                   	pop    %esi
+  803f48:	5d                   	pop    %ebp
+  803f49:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  803f4a:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803f4f:	8b 40 48             	mov    0x48(%eax),%eax
+  803f52:	83 ec 08             	sub    $0x8,%esp
+  803f55:	56                   	push   %esi
+  803f56:	50                   	push   %eax
+  803f57:	e8 d3 fa ff ff       	call   803a2f <page_in>
+  803f5c:	f7 d0                	not    %eax
+  803f5e:	c1 e8 1f             	shr    $0x1f,%eax
+  803f61:	83 c4 10             	add    $0x10,%esp
+  803f64:	eb dd                	jmp    803f43 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f66:	89 f0                	mov    %esi,%eax
+  803f68:	e8 97 e2 ff ff       	call   802204 <segment_lookup>
+  803f6d:	89 c2                	mov    %eax,%edx
+	return 0;
+  803f6f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f74:	85 d2                	test   %edx,%edx
+  803f76:	74 cb                	je     803f43 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  803f78:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803f7d:	8b 40 48             	mov    0x48(%eax),%eax
+  803f80:	83 ec 08             	sub    $0x8,%esp
+  803f83:	56                   	push   %esi
+  803f84:	50                   	push   %eax
+  803f85:	e8 f5 f3 ff ff       	call   80337f <page_out>
+  803f8a:	f7 d0                	not    %eax
+  803f8c:	c1 e8 1f             	shr    $0x1f,%eax
+  803f8f:	83 c4 10             	add    $0x10,%esp
+  803f92:	eb af                	jmp    803f43 <paging_pgfault_handler+0x52>
+
+00803f94 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  803f94:	55                   	push   %ebp
+  803f95:	89 e5                	mov    %esp,%ebp
+  803f97:	57                   	push   %edi
+  803f98:	56                   	push   %esi
+  803f99:	53                   	push   %ebx
+  803f9a:	83 ec 2c             	sub    $0x2c,%esp
+  803f9d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  803fa0:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  803fa5:	89 c1                	mov    %eax,%ecx
+  803fa7:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  803faa:	c1 e8 11             	shr    $0x11,%eax
+  803fad:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803fb0:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  803fb7:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  803fba:	b8 01 00 00 00       	mov    $0x1,%eax
+  803fbf:	d3 e0                	shl    %cl,%eax
+  803fc1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803fc4:	85 c7                	test   %eax,%edi
+  803fc6:	74 12                	je     803fda <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803fc8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  803fcd:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  803fd0:	bf 01 00 00 00       	mov    $0x1,%edi
+  803fd5:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803fd8:	eb 17                	jmp    803ff1 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  803fda:	ff 75 e0             	push   -0x20(%ebp)
+  803fdd:	68 44 57 80 00       	push   $0x805744
+  803fe2:	6a 48                	push   $0x48
+  803fe4:	68 5e 57 80 00       	push   $0x80575e
+  803fe9:	e8 40 c1 ff ff       	call   80012e <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803fee:	83 c3 01             	add    $0x1,%ebx
+  803ff1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803ff4:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  803ff7:	89 c8                	mov    %ecx,%eax
+  803ff9:	c1 e8 05             	shr    $0x5,%eax
+  803ffc:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  804003:	89 fe                	mov    %edi,%esi
+  804005:	d3 e6                	shl    %cl,%esi
+  804007:	89 f1                	mov    %esi,%ecx
+  804009:	85 d6                	test   %edx,%esi
+  80400b:	74 e1                	je     803fee <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  80400d:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  804010:	f7 d6                	not    %esi
+  804012:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804015:	21 fe                	and    %edi,%esi
+  804017:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80401a:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  804021:	f7 d1                	not    %ecx
+  804023:	21 d1                	and    %edx,%ecx
+  804025:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  80402c:	83 ec 04             	sub    $0x4,%esp
+  80402f:	53                   	push   %ebx
+  804030:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804033:	57                   	push   %edi
+  804034:	6a 00                	push   $0x0
+  804036:	e8 97 f8 ff ff       	call   8038d2 <page_unmap_range>
+	va_free(va, n);
+  80403b:	83 c4 08             	add    $0x8,%esp
+  80403e:	53                   	push   %ebx
+  80403f:	57                   	push   %edi
+  804040:	e8 ed 05 00 00       	call   804632 <va_free>
+}
+  804045:	83 c4 10             	add    $0x10,%esp
+  804048:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80404b:	5b                   	pop    %ebx
+  80404c:	5e                   	pop    %esi
+  80404d:	5f                   	pop    %edi
+  80404e:	5d                   	pop    %ebp
+  80404f:	c3                   	ret
+
+00804050 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  804050:	55                   	push   %ebp
+  804051:	89 e5                	mov    %esp,%ebp
+  804053:	57                   	push   %edi
+  804054:	56                   	push   %esi
+  804055:	53                   	push   %ebx
+  804056:	83 ec 1c             	sub    $0x1c,%esp
+  804059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  80405c:	85 db                	test   %ebx,%ebx
+  80405e:	74 34                	je     804094 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  804060:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  804066:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  80406b:	77 2f                	ja     80409c <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  80406d:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  804073:	75 51                	jne    8040c6 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  804075:	89 c1                	mov    %eax,%ecx
+  804077:	c1 e9 0c             	shr    $0xc,%ecx
+  80407a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80407f:	d3 e2                	shl    %cl,%edx
+  804081:	c1 e8 11             	shr    $0x11,%eax
+  804084:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  80408b:	75 24                	jne    8040b1 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  80408d:	89 d8                	mov    %ebx,%eax
+  80408f:	e8 00 ff ff ff       	call   803f94 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  804094:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804097:	5b                   	pop    %ebx
+  804098:	5e                   	pop    %esi
+  804099:	5f                   	pop    %edi
+  80409a:	5d                   	pop    %ebp
+  80409b:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  80409c:	53                   	push   %ebx
+  80409d:	68 6b 57 80 00       	push   $0x80576b
+  8040a2:	68 a2 00 00 00       	push   $0xa2
+  8040a7:	68 5e 57 80 00       	push   $0x80575e
+  8040ac:	e8 7d c0 ff ff       	call   80012e <_panic>
+			panic("free: %p is not allocated", va);
+  8040b1:	53                   	push   %ebx
+  8040b2:	68 44 57 80 00       	push   $0x805744
+  8040b7:	68 a5 00 00 00       	push   $0xa5
+  8040bc:	68 5e 57 80 00       	push   $0x80575e
+  8040c1:	e8 68 c0 ff ff       	call   80012e <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  8040c6:	89 de                	mov    %ebx,%esi
+  8040c8:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  8040ce:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  8040d4:	89 c8                	mov    %ecx,%eax
+  8040d6:	c1 e8 11             	shr    $0x11,%eax
+  8040d9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8040dc:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  8040e3:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8040e6:	c1 e9 0c             	shr    $0xc,%ecx
+  8040e9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8040ee:	d3 e0                	shl    %cl,%eax
+  8040f0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8040f3:	85 c7                	test   %eax,%edi
+  8040f5:	74 1b                	je     804112 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  8040f7:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8040fb:	89 d8                	mov    %ebx,%eax
+  8040fd:	29 f0                	sub    %esi,%eax
+  8040ff:	83 e8 10             	sub    $0x10,%eax
+  804102:	99                   	cltd
+  804103:	f7 ff                	idiv   %edi
+  804105:	89 d1                	mov    %edx,%ecx
+  804107:	85 d2                	test   %edx,%edx
+  804109:	75 07                	jne    804112 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80410b:	ba 10 00 00 00       	mov    $0x10,%edx
+  804110:	eb 18                	jmp    80412a <free+0xda>
+		panic("free: %p is not allocated", va);
+  804112:	53                   	push   %ebx
+  804113:	68 44 57 80 00       	push   $0x805744
+  804118:	68 ad 00 00 00       	push   $0xad
+  80411d:	68 5e 57 80 00       	push   $0x80575e
+  804122:	e8 07 c0 ff ff       	call   80012e <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804127:	83 c1 01             	add    $0x1,%ecx
+  80412a:	89 d0                	mov    %edx,%eax
+  80412c:	d3 e0                	shl    %cl,%eax
+  80412e:	39 c7                	cmp    %eax,%edi
+  804130:	7f f5                	jg     804127 <free+0xd7>
+	*(void **) va = s->free;
+  804132:	8b 46 08             	mov    0x8(%esi),%eax
+  804135:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  804137:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  80413a:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  80413e:	8d 58 01             	lea    0x1(%eax),%ebx
+  804141:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  804145:	66 85 c0             	test   %ax,%ax
+  804148:	74 52                	je     80419c <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  80414a:	0f b7 db             	movzwl %bx,%ebx
+  80414d:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804151:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804156:	ba 00 00 00 00       	mov    $0x0,%edx
+  80415b:	f7 ff                	idiv   %edi
+  80415d:	39 c3                	cmp    %eax,%ebx
+  80415f:	0f 85 2f ff ff ff    	jne    804094 <free+0x44>
+  804165:	8b 46 04             	mov    0x4(%esi),%eax
+  804168:	85 c0                	test   %eax,%eax
+  80416a:	74 53                	je     8041bf <free+0x16f>
+		s->prev->next = s->next;
+  80416c:	8b 16                	mov    (%esi),%edx
+  80416e:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804170:	8b 06                	mov    (%esi),%eax
+  804172:	85 c0                	test   %eax,%eax
+  804174:	74 06                	je     80417c <free+0x12c>
+		s->next->prev = s->prev;
+  804176:	8b 56 04             	mov    0x4(%esi),%edx
+  804179:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  80417c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80417f:	f7 d0                	not    %eax
+  804181:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804184:	21 d0                	and    %edx,%eax
+  804186:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  804189:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  804190:	89 f0                	mov    %esi,%eax
+  804192:	e8 fd fd ff ff       	call   803f94 <heap_free_pages>
+  804197:	e9 f8 fe ff ff       	jmp    804094 <free+0x44>
+	s->prev = NULL;
+  80419c:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  8041a3:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  8041aa:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  8041ac:	85 c0                	test   %eax,%eax
+  8041ae:	74 03                	je     8041b3 <free+0x163>
+		slabs[c]->prev = s;
+  8041b0:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  8041b3:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  8041ba:	e9 d5 fe ff ff       	jmp    804094 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8041bf:	8b 06                	mov    (%esi),%eax
+  8041c1:	85 c0                	test   %eax,%eax
+  8041c3:	0f 84 cb fe ff ff    	je     804094 <free+0x44>
+		slabs[c] = s->next;
+  8041c9:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  8041d0:	8b 06                	mov    (%esi),%eax
+  8041d2:	eb a2                	jmp    804176 <free+0x126>
+
+008041d4 <heap_alloc_pages>:
+{
+  8041d4:	55                   	push   %ebp
+  8041d5:	89 e5                	mov    %esp,%ebp
+  8041d7:	57                   	push   %edi
+  8041d8:	56                   	push   %esi
+  8041d9:	53                   	push   %ebx
+  8041da:	83 ec 18             	sub    $0x18,%esp
+  8041dd:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  8041df:	50                   	push   %eax
+  8041e0:	e8 15 03 00 00       	call   8044fa <va_alloc>
+  8041e5:	89 c3                	mov    %eax,%ebx
+  8041e7:	83 c4 10             	add    $0x10,%esp
+  8041ea:	85 c0                	test   %eax,%eax
+  8041ec:	74 47                	je     804235 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8041ee:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  8041f4:	89 c1                	mov    %eax,%ecx
+  8041f6:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  8041f9:	c1 e8 11             	shr    $0x11,%eax
+  8041fc:	ba 01 00 00 00       	mov    $0x1,%edx
+  804201:	89 d7                	mov    %edx,%edi
+  804203:	d3 e7                	shl    %cl,%edi
+  804205:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  80420c:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  804210:	89 c8                	mov    %ecx,%eax
+  804212:	c1 e8 05             	shr    $0x5,%eax
+  804215:	d3 e2                	shl    %cl,%edx
+  804217:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  80421e:	83 ec 0c             	sub    $0xc,%esp
+  804221:	6a 00                	push   $0x0
+  804223:	6a 07                	push   $0x7
+  804225:	56                   	push   %esi
+  804226:	53                   	push   %ebx
+  804227:	6a 00                	push   $0x0
+  804229:	e8 3a f7 ff ff       	call   803968 <page_alloc_range>
+  80422e:	83 c4 20             	add    $0x20,%esp
+  804231:	85 c0                	test   %eax,%eax
+  804233:	78 0a                	js     80423f <heap_alloc_pages+0x6b>
+}
+  804235:	89 d8                	mov    %ebx,%eax
+  804237:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80423a:	5b                   	pop    %ebx
+  80423b:	5e                   	pop    %esi
+  80423c:	5f                   	pop    %edi
+  80423d:	5d                   	pop    %ebp
+  80423e:	c3                   	ret
+		free(va);
+  80423f:	83 ec 0c             	sub    $0xc,%esp
+  804242:	53                   	push   %ebx
+  804243:	e8 08 fe ff ff       	call   804050 <free>
+		return NULL;
+  804248:	83 c4 10             	add    $0x10,%esp
+  80424b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804250:	eb e3                	jmp    804235 <heap_alloc_pages+0x61>
+
+00804252 <malloc>:
+{
+  804252:	55                   	push   %ebp
+  804253:	89 e5                	mov    %esp,%ebp
+  804255:	57                   	push   %edi
+  804256:	56                   	push   %esi
+  804257:	53                   	push   %ebx
+  804258:	83 ec 1c             	sub    $0x1c,%esp
+  80425b:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  80425e:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804261:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  804267:	0f 87 21 01 00 00    	ja     80438e <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  80426d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804272:	ba 10 00 00 00       	mov    $0x10,%edx
+  804277:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  804279:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80427e:	76 15                	jbe    804295 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804280:	05 ff 0f 00 00       	add    $0xfff,%eax
+  804285:	c1 e8 0c             	shr    $0xc,%eax
+  804288:	e8 47 ff ff ff       	call   8041d4 <heap_alloc_pages>
+  80428d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804290:	eb 37                	jmp    8042c9 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804292:	83 c1 01             	add    $0x1,%ecx
+  804295:	89 d6                	mov    %edx,%esi
+  804297:	d3 e6                	shl    %cl,%esi
+  804299:	39 c6                	cmp    %eax,%esi
+  80429b:	72 f5                	jb     804292 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  80429d:	89 cb                	mov    %ecx,%ebx
+  80429f:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  8042a6:	85 ff                	test   %edi,%edi
+  8042a8:	74 2a                	je     8042d4 <malloc+0x82>
+	v = s->free;
+  8042aa:	8b 47 08             	mov    0x8(%edi),%eax
+  8042ad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  8042b0:	8b 00                	mov    (%eax),%eax
+  8042b2:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  8042b5:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  8042b9:	83 e8 01             	sub    $0x1,%eax
+  8042bc:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  8042c0:	66 85 c0             	test   %ax,%ax
+  8042c3:	0f 84 9a 00 00 00    	je     804363 <malloc+0x111>
+}
+  8042c9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8042cc:	83 c4 1c             	add    $0x1c,%esp
+  8042cf:	5b                   	pop    %ebx
+  8042d0:	5e                   	pop    %esi
+  8042d1:	5f                   	pop    %edi
+  8042d2:	5d                   	pop    %ebp
+  8042d3:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  8042d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8042d9:	e8 f6 fe ff ff       	call   8041d4 <heap_alloc_pages>
+  8042de:	89 c1                	mov    %eax,%ecx
+  8042e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8042e3:	85 c0                	test   %eax,%eax
+  8042e5:	74 e2                	je     8042c9 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8042e7:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  8042ed:	89 c8                	mov    %ecx,%eax
+  8042ef:	c1 e8 11             	shr    $0x11,%eax
+  8042f2:	c1 e9 0c             	shr    $0xc,%ecx
+  8042f5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042fa:	d3 e2                	shl    %cl,%edx
+  8042fc:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804303:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804306:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  80430a:	0f b7 f6             	movzwl %si,%esi
+  80430d:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804312:	ba 00 00 00 00       	mov    $0x0,%edx
+  804317:	f7 fe                	idiv   %esi
+  804319:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  80431d:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  804320:	85 c0                	test   %eax,%eax
+  804322:	74 14                	je     804338 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  804324:	83 e8 01             	sub    $0x1,%eax
+  804327:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  80432b:	0f af d0             	imul   %eax,%edx
+  80432e:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804332:	89 3a                	mov    %edi,(%edx)
+  804334:	89 d7                	mov    %edx,%edi
+  804336:	eb e5                	jmp    80431d <malloc+0xcb>
+	s->prev = NULL;
+  804338:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80433b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804342:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  804349:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  80434b:	85 c0                	test   %eax,%eax
+  80434d:	74 03                	je     804352 <malloc+0x100>
+		slabs[c]->prev = s;
+  80434f:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804352:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804355:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  80435c:	89 c7                	mov    %eax,%edi
+  80435e:	e9 47 ff ff ff       	jmp    8042aa <malloc+0x58>
+	if (s->prev)
+  804363:	8b 47 04             	mov    0x4(%edi),%eax
+  804366:	85 c0                	test   %eax,%eax
+  804368:	74 19                	je     804383 <malloc+0x131>
+		s->prev->next = s->next;
+  80436a:	8b 17                	mov    (%edi),%edx
+  80436c:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  80436e:	8b 07                	mov    (%edi),%eax
+  804370:	85 c0                	test   %eax,%eax
+  804372:	0f 84 51 ff ff ff    	je     8042c9 <malloc+0x77>
+		s->next->prev = s->prev;
+  804378:	8b 57 04             	mov    0x4(%edi),%edx
+  80437b:	89 50 04             	mov    %edx,0x4(%eax)
+  80437e:	e9 46 ff ff ff       	jmp    8042c9 <malloc+0x77>
+		slabs[c] = s->next;
+  804383:	8b 07                	mov    (%edi),%eax
+  804385:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  80438c:	eb e0                	jmp    80436e <malloc+0x11c>
+		return NULL;
+  80438e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804395:	e9 2f ff ff ff       	jmp    8042c9 <malloc+0x77>
+
+0080439a <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  80439a:	55                   	push   %ebp
+  80439b:	89 e5                	mov    %esp,%ebp
+  80439d:	57                   	push   %edi
+  80439e:	56                   	push   %esi
+  80439f:	53                   	push   %ebx
+  8043a0:	83 ec 0c             	sub    $0xc,%esp
+  8043a3:	89 c6                	mov    %eax,%esi
+  8043a5:	89 d7                	mov    %edx,%edi
+  8043a7:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8043aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8043af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043b4:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  8043b9:	83 ef 01             	sub    $0x1,%edi
+  8043bc:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8043bf:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8043c2:	eb 34                	jmp    8043f8 <va_chunk_scan+0x5e>
+			i += 31;
+  8043c4:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  8043c7:	89 ca                	mov    %ecx,%edx
+			continue;
+  8043c9:	eb 23                	jmp    8043ee <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8043cb:	89 c7                	mov    %eax,%edi
+  8043cd:	c1 ef 05             	shr    $0x5,%edi
+  8043d0:	be 01 00 00 00       	mov    $0x1,%esi
+  8043d5:	d3 e6                	shl    %cl,%esi
+  8043d7:	89 f1                	mov    %esi,%ecx
+  8043d9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8043dc:	23 0c be             	and    (%esi,%edi,4),%ecx
+  8043df:	75 41                	jne    804422 <va_chunk_scan+0x88>
+			len++;
+  8043e1:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  8043e4:	39 d3                	cmp    %edx,%ebx
+  8043e6:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  8043e9:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  8043ec:	72 2d                	jb     80441b <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8043ee:	83 c0 01             	add    $0x1,%eax
+  8043f1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8043f6:	77 31                	ja     804429 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  8043f8:	89 c1                	mov    %eax,%ecx
+  8043fa:	83 e1 1f             	and    $0x1f,%ecx
+  8043fd:	75 cc                	jne    8043cb <va_chunk_scan+0x31>
+  8043ff:	89 c7                	mov    %eax,%edi
+  804401:	c1 ef 05             	shr    $0x5,%edi
+  804404:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804407:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  80440a:	83 ff ff             	cmp    $0xffffffff,%edi
+  80440d:	74 b5                	je     8043c4 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  80440f:	85 ff                	test   %edi,%edi
+  804411:	75 b8                	jne    8043cb <va_chunk_scan+0x31>
+			i += 31;
+  804413:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804416:	83 c2 20             	add    $0x20,%edx
+  804419:	eb c9                	jmp    8043e4 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  80441b:	83 c0 01             	add    $0x1,%eax
+  80441e:	29 d0                	sub    %edx,%eax
+  804420:	eb 15                	jmp    804437 <va_chunk_scan+0x9d>
+			len = 0;
+  804422:	ba 00 00 00 00       	mov    $0x0,%edx
+  804427:	eb c5                	jmp    8043ee <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804429:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  80442e:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804431:	85 d2                	test   %edx,%edx
+  804433:	74 02                	je     804437 <va_chunk_scan+0x9d>
+		*run_store = best;
+  804435:	89 1a                	mov    %ebx,(%edx)
+}
+  804437:	83 c4 0c             	add    $0xc,%esp
+  80443a:	5b                   	pop    %ebx
+  80443b:	5e                   	pop    %esi
+  80443c:	5f                   	pop    %edi
+  80443d:	5d                   	pop    %ebp
+  80443e:	c3                   	ret
+
+0080443f <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  80443f:	55                   	push   %ebp
+  804440:	89 e5                	mov    %esp,%ebp
+  804442:	57                   	push   %edi
+  804443:	56                   	push   %esi
+  804444:	53                   	push   %ebx
+  804445:	83 ec 14             	sub    $0x14,%esp
+  804448:	89 c3                	mov    %eax,%ebx
+  80444a:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  80444c:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804452:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  804458:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  80445b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  80445e:	89 d6                	mov    %edx,%esi
+  804460:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  804466:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804468:	eb 34                	jmp    80449e <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  80446a:	89 c8                	mov    %ecx,%eax
+  80446c:	c1 e8 05             	shr    $0x5,%eax
+  80446f:	89 da                	mov    %ebx,%edx
+  804471:	c1 e2 05             	shl    $0x5,%edx
+  804474:	01 da                	add    %ebx,%edx
+  804476:	01 c2                	add    %eax,%edx
+  804478:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  80447d:	d3 c0                	rol    %cl,%eax
+  80447f:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804486:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  80448d:	b8 01 00 00 00       	mov    $0x1,%eax
+  804492:	01 d0                	add    %edx,%eax
+  804494:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  80449b:	83 c1 01             	add    $0x1,%ecx
+  80449e:	39 f9                	cmp    %edi,%ecx
+  8044a0:	74 30                	je     8044d2 <va_chunk_mark+0x93>
+		if (alloc)
+  8044a2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8044a6:	74 c2                	je     80446a <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  8044a8:	89 c8                	mov    %ecx,%eax
+  8044aa:	c1 e8 05             	shr    $0x5,%eax
+  8044ad:	89 da                	mov    %ebx,%edx
+  8044af:	c1 e2 05             	shl    $0x5,%edx
+  8044b2:	01 da                	add    %ebx,%edx
+  8044b4:	01 c2                	add    %eax,%edx
+  8044b6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8044bb:	d3 e0                	shl    %cl,%eax
+  8044bd:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  8044c4:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  8044cb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8044d0:	eb c0                	jmp    804492 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  8044d2:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  8044d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044da:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8044dd:	e8 b8 fe ff ff       	call   80439a <va_chunk_scan>
+	ch->run = run;
+  8044e2:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  8044e8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8044eb:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  8044f2:	83 c4 14             	add    $0x14,%esp
+  8044f5:	5b                   	pop    %ebx
+  8044f6:	5e                   	pop    %esi
+  8044f7:	5f                   	pop    %edi
+  8044f8:	5d                   	pop    %ebp
+  8044f9:	c3                   	ret
+
+008044fa <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  8044fa:	55                   	push   %ebp
+  8044fb:	89 e5                	mov    %esp,%ebp
+  8044fd:	57                   	push   %edi
+  8044fe:	56                   	push   %esi
+  8044ff:	53                   	push   %ebx
+  804500:	83 ec 04             	sub    $0x4,%esp
+  804503:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804506:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  80450b:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  804510:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  804517:	74 4f                	je     804568 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804519:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  80451c:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804521:	0f 87 01 01 00 00    	ja     804628 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804527:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  80452d:	0f 87 80 00 00 00    	ja     8045b3 <va_alloc+0xb9>
+  804533:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804538:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  80453d:	0f b7 10             	movzwl (%eax),%edx
+  804540:	05 84 00 00 00       	add    $0x84,%eax
+  804545:	39 da                	cmp    %ebx,%edx
+  804547:	73 2c                	jae    804575 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804549:	83 c6 01             	add    $0x1,%esi
+  80454c:	83 fe 1c             	cmp    $0x1c,%esi
+  80454f:	75 ec                	jne    80453d <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804551:	b8 00 00 00 00       	mov    $0x0,%eax
+  804556:	eb 53                	jmp    8045ab <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804558:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  80455e:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804563:	05 84 00 00 00       	add    $0x84,%eax
+  804568:	39 d0                	cmp    %edx,%eax
+  80456a:	75 ec                	jne    804558 <va_alloc+0x5e>
+	va_inited = 1;
+  80456c:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  804573:	eb a4                	jmp    804519 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804575:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  80457b:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  804580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804585:	89 da                	mov    %ebx,%edx
+  804587:	e8 0e fe ff ff       	call   80439a <va_chunk_scan>
+  80458c:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  80458e:	6a 01                	push   $0x1
+  804590:	89 d9                	mov    %ebx,%ecx
+  804592:	89 c2                	mov    %eax,%edx
+  804594:	89 f0                	mov    %esi,%eax
+  804596:	e8 a4 fe ff ff       	call   80443f <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  80459b:	c1 e6 16             	shl    $0x16,%esi
+  80459e:	c1 e7 0c             	shl    $0xc,%edi
+  8045a1:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  8045a8:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  8045ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045ae:	5b                   	pop    %ebx
+  8045af:	5e                   	pop    %esi
+  8045b0:	5f                   	pop    %edi
+  8045b1:	5d                   	pop    %ebp
+  8045b2:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  8045b3:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  8045b9:	c1 ee 0a             	shr    $0xa,%esi
+  8045bc:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  8045c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045c6:	eb 0a                	jmp    8045d2 <va_alloc+0xd8>
+			first = c + 1;
+  8045c8:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  8045ca:	83 c2 01             	add    $0x1,%edx
+  8045cd:	83 fa 1d             	cmp    $0x1d,%edx
+  8045d0:	74 4f                	je     804621 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  8045d2:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  8045d8:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  8045df:	00 04 
+  8045e1:	75 e5                	jne    8045c8 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  8045e3:	89 d1                	mov    %edx,%ecx
+  8045e5:	29 c1                	sub    %eax,%ecx
+  8045e7:	39 f1                	cmp    %esi,%ecx
+  8045e9:	75 df                	jne    8045ca <va_alloc+0xd0>
+  8045eb:	89 c7                	mov    %eax,%edi
+  8045ed:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  8045f0:	be 00 04 00 00       	mov    $0x400,%esi
+  8045f5:	39 f3                	cmp    %esi,%ebx
+  8045f7:	0f 46 f3             	cmovbe %ebx,%esi
+  8045fa:	6a 01                	push   $0x1
+  8045fc:	89 f1                	mov    %esi,%ecx
+  8045fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  804603:	89 f8                	mov    %edi,%eax
+  804605:	e8 35 fe ff ff       	call   80443f <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  80460a:	83 c7 01             	add    $0x1,%edi
+  80460d:	83 c4 04             	add    $0x4,%esp
+  804610:	29 f3                	sub    %esi,%ebx
+  804612:	75 dc                	jne    8045f0 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804614:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804617:	c1 e0 16             	shl    $0x16,%eax
+  80461a:	05 00 00 00 08       	add    $0x8000000,%eax
+  80461f:	eb 8a                	jmp    8045ab <va_alloc+0xb1>
+	return NULL;
+  804621:	b8 00 00 00 00       	mov    $0x0,%eax
+  804626:	eb 83                	jmp    8045ab <va_alloc+0xb1>
+		return NULL;
+  804628:	b8 00 00 00 00       	mov    $0x0,%eax
+  80462d:	e9 79 ff ff ff       	jmp    8045ab <va_alloc+0xb1>
+
+00804632 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804632:	55                   	push   %ebp
+  804633:	89 e5                	mov    %esp,%ebp
+  804635:	57                   	push   %edi
+  804636:	56                   	push   %esi
+  804637:	53                   	push   %ebx
+  804638:	83 ec 0c             	sub    $0xc,%esp
+  80463b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80463e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804641:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804647:	76 21                	jbe    80466a <va_free+0x38>
+  804649:	89 f0                	mov    %esi,%eax
+  80464b:	c1 e0 0c             	shl    $0xc,%eax
+  80464e:	01 f8                	add    %edi,%eax
+  804650:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804655:	77 13                	ja     80466a <va_free+0x38>
+	    || PGOFF(va))
+  804657:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80465d:	75 0b                	jne    80466a <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  80465f:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804665:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804668:	eb 45                	jmp    8046af <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  80466a:	83 ec 0c             	sub    $0xc,%esp
+  80466d:	56                   	push   %esi
+  80466e:	57                   	push   %edi
+  80466f:	68 88 57 80 00       	push   $0x805788
+  804674:	68 8e 00 00 00       	push   $0x8e
+  804679:	68 a8 57 80 00       	push   $0x8057a8
+  80467e:	e8 ab ba ff ff       	call   80012e <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804683:	89 fa                	mov    %edi,%edx
+  804685:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80468b:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804690:	29 d3                	sub    %edx,%ebx
+  804692:	39 f3                	cmp    %esi,%ebx
+  804694:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804697:	89 f8                	mov    %edi,%eax
+  804699:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  80469c:	83 ec 0c             	sub    $0xc,%esp
+  80469f:	6a 00                	push   $0x0
+  8046a1:	89 d9                	mov    %ebx,%ecx
+  8046a3:	e8 97 fd ff ff       	call   80443f <va_chunk_mark>
+		i += n;
+  8046a8:	01 df                	add    %ebx,%edi
+		npages -= n;
+  8046aa:	29 de                	sub    %ebx,%esi
+  8046ac:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  8046af:	85 f6                	test   %esi,%esi
+  8046b1:	75 d0                	jne    804683 <va_free+0x51>
+	}
+}
+  8046b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046b6:	5b                   	pop    %ebx
+  8046b7:	5e                   	pop    %esi
+  8046b8:	5f                   	pop    %edi
+  8046b9:	5d                   	pop    %ebp
+  8046ba:	c3                   	ret
+
+008046bb <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8046bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046c0:	c3                   	ret
+
+008046c1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8046c1:	55                   	push   %ebp
+  8046c2:	89 e5                	mov    %esp,%ebp
+  8046c4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8046c7:	68 b5 57 80 00       	push   $0x8057b5
+  8046cc:	ff 75 0c             	push   0xc(%ebp)
+  8046cf:	e8 1c c1 ff ff       	call   8007f0 <strcpy>
+	return 0;
+}
+  8046d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046d9:	c9                   	leave
+  8046da:	c3                   	ret
+
+008046db <devcons_write>:
+{
+  8046db:	55                   	push   %ebp
+  8046dc:	89 e5                	mov    %esp,%ebp
+  8046de:	57                   	push   %edi
+  8046df:	56                   	push   %esi
+  8046e0:	53                   	push   %ebx
+  8046e1:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8046e7:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8046ec:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8046f2:	eb 2e                	jmp    804722 <devcons_write+0x47>
+		m = n - tot;
+  8046f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8046f7:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8046f9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8046fe:	39 c3                	cmp    %eax,%ebx
+  804700:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804703:	83 ec 04             	sub    $0x4,%esp
+  804706:	53                   	push   %ebx
+  804707:	89 f0                	mov    %esi,%eax
+  804709:	03 45 0c             	add    0xc(%ebp),%eax
+  80470c:	50                   	push   %eax
+  80470d:	57                   	push   %edi
+  80470e:	e8 63 c2 ff ff       	call   800976 <memmove>
+		sys_cputs(buf, m);
+  804713:	83 c4 08             	add    $0x8,%esp
+  804716:	53                   	push   %ebx
+  804717:	57                   	push   %edi
+  804718:	e8 f9 c4 ff ff       	call   800c16 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80471d:	01 de                	add    %ebx,%esi
+  80471f:	83 c4 10             	add    $0x10,%esp
+  804722:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804725:	72 cd                	jb     8046f4 <devcons_write+0x19>
+}
+  804727:	89 f0                	mov    %esi,%eax
+  804729:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80472c:	5b                   	pop    %ebx
+  80472d:	5e                   	pop    %esi
+  80472e:	5f                   	pop    %edi
+  80472f:	5d                   	pop    %ebp
+  804730:	c3                   	ret
+
+00804731 <devcons_read>:
+{
+  804731:	55                   	push   %ebp
+  804732:	89 e5                	mov    %esp,%ebp
+  804734:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804737:	b8 00 00 00 00       	mov    $0x0,%eax
+  80473c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804740:	75 07                	jne    804749 <devcons_read+0x18>
+  804742:	eb 1f                	jmp    804763 <devcons_read+0x32>
+		sys_yield();
+  804744:	e8 7b c5 ff ff       	call   800cc4 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804749:	e8 f7 c4 ff ff       	call   800c45 <sys_cgetc>
+  80474e:	85 c0                	test   %eax,%eax
+  804750:	74 f2                	je     804744 <devcons_read+0x13>
+	if (c < 0)
+  804752:	78 0f                	js     804763 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804754:	83 f8 04             	cmp    $0x4,%eax
+  804757:	74 0c                	je     804765 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804759:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80475c:	88 02                	mov    %al,(%edx)
+	return 1;
+  80475e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804763:	c9                   	leave
+  804764:	c3                   	ret
+		return 0;
+  804765:	b8 00 00 00 00       	mov    $0x0,%eax
+  80476a:	eb f7                	jmp    804763 <devcons_read+0x32>
+
+0080476c <cputchar>:
+{
+  80476c:	55                   	push   %ebp
+  80476d:	89 e5                	mov    %esp,%ebp
+  80476f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804772:	8b 45 08             	mov    0x8(%ebp),%eax
+  804775:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804778:	6a 01                	push   $0x1
+  80477a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80477d:	50                   	push   %eax
+  80477e:	e8 93 c4 ff ff       	call   800c16 <sys_cputs>
+}
+  804783:	83 c4 10             	add    $0x10,%esp
+  804786:	c9                   	leave
+  804787:	c3                   	ret
+
+00804788 <getchar>:
+{
+  804788:	55                   	push   %ebp
+  804789:	89 e5                	mov    %esp,%ebp
+  80478b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80478e:	6a 01                	push   $0x1
+  804790:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804793:	50                   	push   %eax
+  804794:	6a 00                	push   $0x0
+  804796:	e8 d7 ce ff ff       	call   801672 <read>
+	if (r < 0)
+  80479b:	83 c4 10             	add    $0x10,%esp
+  80479e:	85 c0                	test   %eax,%eax
+  8047a0:	78 06                	js     8047a8 <getchar+0x20>
+	if (r < 1)
+  8047a2:	74 06                	je     8047aa <getchar+0x22>
+	return c;
+  8047a4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8047a8:	c9                   	leave
+  8047a9:	c3                   	ret
+		return -E_EOF;
+  8047aa:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8047af:	eb f7                	jmp    8047a8 <getchar+0x20>
+
+008047b1 <iscons>:
+{
+  8047b1:	55                   	push   %ebp
+  8047b2:	89 e5                	mov    %esp,%ebp
+  8047b4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8047b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8047ba:	50                   	push   %eax
+  8047bb:	ff 75 08             	push   0x8(%ebp)
+  8047be:	e8 50 cc ff ff       	call   801413 <fd_lookup>
+  8047c3:	83 c4 10             	add    $0x10,%esp
+  8047c6:	85 c0                	test   %eax,%eax
+  8047c8:	78 11                	js     8047db <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8047ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047cd:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  8047d3:	39 10                	cmp    %edx,(%eax)
+  8047d5:	0f 94 c0             	sete   %al
+  8047d8:	0f b6 c0             	movzbl %al,%eax
+}
+  8047db:	c9                   	leave
+  8047dc:	c3                   	ret
+
+008047dd <opencons>:
+{
+  8047dd:	55                   	push   %ebp
+  8047de:	89 e5                	mov    %esp,%ebp
+  8047e0:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8047e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8047e6:	50                   	push   %eax
+  8047e7:	e8 d3 cb ff ff       	call   8013bf <fd_alloc>
+  8047ec:	83 c4 10             	add    $0x10,%esp
+  8047ef:	85 c0                	test   %eax,%eax
+  8047f1:	78 3a                	js     80482d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8047f3:	83 ec 04             	sub    $0x4,%esp
+  8047f6:	68 07 04 00 00       	push   $0x407
+  8047fb:	ff 75 f4             	push   -0xc(%ebp)
+  8047fe:	6a 00                	push   $0x0
+  804800:	e8 de c4 ff ff       	call   800ce3 <sys_page_alloc>
+  804805:	83 c4 10             	add    $0x10,%esp
+  804808:	85 c0                	test   %eax,%eax
+  80480a:	78 21                	js     80482d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80480c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80480f:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804815:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804817:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80481a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804821:	83 ec 0c             	sub    $0xc,%esp
+  804824:	50                   	push   %eax
+  804825:	e8 6e cb ff ff       	call   801398 <fd2num>
+  80482a:	83 c4 10             	add    $0x10,%esp
+}
+  80482d:	c9                   	leave
+  80482e:	c3                   	ret
+
+0080482f <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  80482f:	55                   	push   %ebp
+  804830:	89 e5                	mov    %esp,%ebp
+  804832:	57                   	push   %edi
+  804833:	56                   	push   %esi
+  804834:	53                   	push   %ebx
+  804835:	83 ec 14             	sub    $0x14,%esp
+  804838:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80483b:	8b 75 14             	mov    0x14(%ebp),%esi
+  80483e:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804841:	ff 75 10             	push   0x10(%ebp)
+  804844:	ff 75 0c             	push   0xc(%ebp)
+  804847:	e8 ba c8 ff ff       	call   801106 <sys_ipc_recv_pages>
+  80484c:	83 c4 10             	add    $0x10,%esp
+  80484f:	85 c0                	test   %eax,%eax
+  804851:	78 46                	js     804899 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804853:	85 ff                	test   %edi,%edi
+  804855:	74 0d                	je     804864 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804857:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  80485c:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804862:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804864:	85 f6                	test   %esi,%esi
+  804866:	74 0d                	je     804875 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804868:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  80486d:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804873:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804875:	85 db                	test   %ebx,%ebx
+  804877:	74 0d                	je     804886 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804879:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  80487e:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804884:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804886:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  80488b:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804891:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804894:	5b                   	pop    %ebx
+  804895:	5e                   	pop    %esi
+  804896:	5f                   	pop    %edi
+  804897:	5d                   	pop    %ebp
+  804898:	c3                   	ret
+		if (from_env_store) {
+  804899:	85 ff                	test   %edi,%edi
+  80489b:	74 06                	je     8048a3 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80489d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8048a3:	85 f6                	test   %esi,%esi
+  8048a5:	74 06                	je     8048ad <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  8048a7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8048ad:	85 db                	test   %ebx,%ebx
+  8048af:	74 e0                	je     804891 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8048b1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8048b7:	eb d8                	jmp    804891 <ipc_recv_pages+0x62>
+
+008048b9 <ipc_recv>:
+{
+  8048b9:	55                   	push   %ebp
+  8048ba:	89 e5                	mov    %esp,%ebp
+  8048bc:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8048bf:	6a 00                	push   $0x0
+  8048c1:	ff 75 10             	push   0x10(%ebp)
+  8048c4:	6a 01                	push   $0x1
+  8048c6:	ff 75 0c             	push   0xc(%ebp)
+  8048c9:	ff 75 08             	push   0x8(%ebp)
+  8048cc:	e8 5e ff ff ff       	call   80482f <ipc_recv_pages>
+}
+  8048d1:	c9                   	leave
+  8048d2:	c3                   	ret
+
+008048d3 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8048d3:	55                   	push   %ebp
+  8048d4:	89 e5                	mov    %esp,%ebp
+  8048d6:	56                   	push   %esi
+  8048d7:	53                   	push   %ebx
+  8048d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8048db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8048de:	83 ec 0c             	sub    $0xc,%esp
+  8048e1:	ff 75 0c             	push   0xc(%ebp)
+  8048e4:	e8 51 c9 ff ff       	call   80123a <sys_ipc_try_recv>
+  8048e9:	83 c4 10             	add    $0x10,%esp
+  8048ec:	85 c0                	test   %eax,%eax
+  8048ee:	78 34                	js     804924 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8048f0:	85 f6                	test   %esi,%esi
+  8048f2:	74 0d                	je     804901 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8048f4:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8048f9:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8048ff:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  804901:	85 db                	test   %ebx,%ebx
+  804903:	74 0d                	je     804912 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  804905:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  80490a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804910:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804912:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804917:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80491d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804920:	5b                   	pop    %ebx
+  804921:	5e                   	pop    %esi
+  804922:	5d                   	pop    %ebp
+  804923:	c3                   	ret
+		if (from_env_store) {
+  804924:	85 f6                	test   %esi,%esi
+  804926:	74 06                	je     80492e <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  804928:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  80492e:	85 db                	test   %ebx,%ebx
+  804930:	74 eb                	je     80491d <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  804932:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804938:	eb e3                	jmp    80491d <ipc_try_recv+0x4a>
+
+0080493a <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80493a:	55                   	push   %ebp
+  80493b:	89 e5                	mov    %esp,%ebp
+  80493d:	83 ec 14             	sub    $0x14,%esp
+  804940:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804943:	85 c0                	test   %eax,%eax
+  804945:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80494a:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80494d:	ff 75 18             	push   0x18(%ebp)
+  804950:	ff 75 14             	push   0x14(%ebp)
+  804953:	50                   	push   %eax
+  804954:	ff 75 0c             	push   0xc(%ebp)
+  804957:	ff 75 08             	push   0x8(%ebp)
+  80495a:	e8 6a c7 ff ff       	call   8010c9 <sys_ipc_send_pages>
+  80495f:	83 c4 20             	add    $0x20,%esp
+  804962:	85 c0                	test   %eax,%eax
+  804964:	78 02                	js     804968 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804966:	c9                   	leave
+  804967:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804968:	50                   	push   %eax
+  804969:	68 c4 57 80 00       	push   $0x8057c4
+  80496e:	68 80 00 00 00       	push   $0x80
+  804973:	68 f0 57 80 00       	push   $0x8057f0
+  804978:	e8 b1 b7 ff ff       	call   80012e <_panic>
+
+0080497d <ipc_send>:
+{
+  80497d:	55                   	push   %ebp
+  80497e:	89 e5                	mov    %esp,%ebp
+  804980:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  804983:	ff 75 14             	push   0x14(%ebp)
+  804986:	6a 01                	push   $0x1
+  804988:	ff 75 10             	push   0x10(%ebp)
+  80498b:	ff 75 0c             	push   0xc(%ebp)
+  80498e:	ff 75 08             	push   0x8(%ebp)
+  804991:	e8 a4 ff ff ff       	call   80493a <ipc_send_pages>
+}
+  804996:	83 c4 20             	add    $0x20,%esp
+  804999:	c9                   	leave
+  80499a:	c3                   	ret
+
+0080499b <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80499b:	55                   	push   %ebp
+  80499c:	89 e5                	mov    %esp,%ebp
+  80499e:	83 ec 14             	sub    $0x14,%esp
+  8049a1:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8049a4:	85 c0                	test   %eax,%eax
+  8049a6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8049ab:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8049ae:	ff 75 18             	push   0x18(%ebp)
+  8049b1:	ff 75 14             	push   0x14(%ebp)
+  8049b4:	50                   	push   %eax
+  8049b5:	ff 75 0c             	push   0xc(%ebp)
+  8049b8:	ff 75 08             	push   0x8(%ebp)
+  8049bb:	e8 9a c7 ff ff       	call   80115a <sys_ipc_call>
+  8049c0:	83 c4 20             	add    $0x20,%esp
+  8049c3:	85 c0                	test   %eax,%eax
+  8049c5:	78 0b                	js     8049d2 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  8049c7:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8049cc:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8049d2:	c9                   	leave
+  8049d3:	c3                   	ret
+
+008049d4 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  8049d4:	55                   	push   %ebp
+  8049d5:	89 e5                	mov    %esp,%ebp
+  8049d7:	57                   	push   %edi
+  8049d8:	56                   	push   %esi
+  8049d9:	53                   	push   %ebx
+  8049da:	83 ec 18             	sub    $0x18,%esp
+  8049dd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8049e0:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8049e3:	8b 75 20             	mov    0x20(%ebp),%esi
+  8049e6:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8049e9:	85 c0                	test   %eax,%eax
+  8049eb:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8049f0:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8049f3:	ff 75 18             	push   0x18(%ebp)
+  8049f6:	ff 75 14             	push   0x14(%ebp)
+  8049f9:	50                   	push   %eax
+  8049fa:	ff 75 0c             	push   0xc(%ebp)
+  8049fd:	ff 75 08             	push   0x8(%ebp)
+  804a00:	e8 96 c7 ff ff       	call   80119b <sys_ipc_reply_recv>
+  804a05:	83 c4 20             	add    $0x20,%esp
+  804a08:	85 c0                	test   %eax,%eax
+  804a0a:	78 46                	js     804a52 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804a0c:	85 ff                	test   %edi,%edi
+  804a0e:	74 0d                	je     804a1d <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  804a10:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804a15:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804a1b:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804a1d:	85 f6                	test   %esi,%esi
+  804a1f:	74 0d                	je     804a2e <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  804a21:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804a26:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804a2c:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804a2e:	85 db                	test   %ebx,%ebx
+  804a30:	74 0d                	je     804a3f <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  804a32:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804a37:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804a3d:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804a3f:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804a44:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804a4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a4d:	5b                   	pop    %ebx
+  804a4e:	5e                   	pop    %esi
+  804a4f:	5f                   	pop    %edi
+  804a50:	5d                   	pop    %ebp
+  804a51:	c3                   	ret
+		if (from_env_store) {
+  804a52:	85 ff                	test   %edi,%edi
+  804a54:	74 06                	je     804a5c <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  804a56:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804a5c:	85 f6                	test   %esi,%esi
+  804a5e:	74 06                	je     804a66 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  804a60:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804a66:	85 db                	test   %ebx,%ebx
+  804a68:	74 e0                	je     804a4a <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  804a6a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804a70:	eb d8                	jmp    804a4a <ipc_reply_recv+0x76>
+
+00804a72 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804a72:	55                   	push   %ebp
+  804a73:	89 e5                	mov    %esp,%ebp
+  804a75:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804a78:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804a7d:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804a80:	c1 e0 06             	shl    $0x6,%eax
+  804a83:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804a88:	8b 40 50             	mov    0x50(%eax),%eax
+  804a8b:	39 c8                	cmp    %ecx,%eax
+  804a8d:	74 12                	je     804aa1 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804a8f:	83 c2 01             	add    $0x1,%edx
+  804a92:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804a98:	75 e3                	jne    804a7d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804a9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a9f:	eb 0e                	jmp    804aaf <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804aa1:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804aa4:	c1 e0 06             	shl    $0x6,%eax
+  804aa7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804aac:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804aaf:	5d                   	pop    %ebp
+  804ab0:	c3                   	ret
+
+00804ab1 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804ab1:	55                   	push   %ebp
+  804ab2:	89 e5                	mov    %esp,%ebp
+  804ab4:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804ab7:	89 c2                	mov    %eax,%edx
+  804ab9:	c1 ea 16             	shr    $0x16,%edx
+  804abc:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804ac3:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804ac8:	f6 c1 01             	test   $0x1,%cl
+  804acb:	74 1e                	je     804aeb <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  804acd:	c1 e8 0c             	shr    $0xc,%eax
+  804ad0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804ad7:	a8 01                	test   $0x1,%al
+  804ad9:	74 10                	je     804aeb <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804adb:	c1 e8 0c             	shr    $0xc,%eax
+  804ade:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  804ae1:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  804ae8:	0f b7 d2             	movzwl %dx,%edx
+}
+  804aeb:	89 d0                	mov    %edx,%eax
+  804aed:	5d                   	pop    %ebp
+  804aee:	c3                   	ret
+
+00804aef <udivmod>:
+  804aef:	55                   	push   %ebp
+  804af0:	57                   	push   %edi
+  804af1:	56                   	push   %esi
+  804af2:	53                   	push   %ebx
+  804af3:	83 ec 24             	sub    $0x24,%esp
+  804af6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804afa:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804afe:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804b02:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804b06:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804b0a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804b0e:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  804b12:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804b17:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b21:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804b28:	00 
+  804b29:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804b30:	00 
+  804b31:	89 fb                	mov    %edi,%ebx
+  804b33:	eb 08                	jmp    804b3d <udivmod+0x4e>
+  804b35:	83 e9 01             	sub    $0x1,%ecx
+  804b38:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804b3b:	74 68                	je     804ba5 <udivmod+0xb6>
+  804b3d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804b41:	01 c0                	add    %eax,%eax
+  804b43:	89 c6                	mov    %eax,%esi
+  804b45:	89 d7                	mov    %edx,%edi
+  804b47:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804b4b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804b4f:	0f ad d0             	shrd   %cl,%edx,%eax
+  804b52:	d3 ea                	shr    %cl,%edx
+  804b54:	f6 c1 20             	test   $0x20,%cl
+  804b57:	74 04                	je     804b5d <udivmod+0x6e>
+  804b59:	89 d0                	mov    %edx,%eax
+  804b5b:	31 d2                	xor    %edx,%edx
+  804b5d:	83 e0 01             	and    $0x1,%eax
+  804b60:	89 04 24             	mov    %eax,(%esp)
+  804b63:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804b6a:	00 
+  804b6b:	8b 04 24             	mov    (%esp),%eax
+  804b6e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804b72:	09 f0                	or     %esi,%eax
+  804b74:	09 fa                	or     %edi,%edx
+  804b76:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804b7a:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804b7e:	39 f0                	cmp    %esi,%eax
+  804b80:	89 d5                	mov    %edx,%ebp
+  804b82:	19 fd                	sbb    %edi,%ebp
+  804b84:	72 af                	jb     804b35 <udivmod+0x46>
+  804b86:	29 f0                	sub    %esi,%eax
+  804b88:	19 fa                	sbb    %edi,%edx
+  804b8a:	89 cf                	mov    %ecx,%edi
+  804b8c:	c1 ef 05             	shr    $0x5,%edi
+  804b8f:	83 e7 01             	and    $0x1,%edi
+  804b92:	89 fe                	mov    %edi,%esi
+  804b94:	83 f6 01             	xor    $0x1,%esi
+  804b97:	d3 e6                	shl    %cl,%esi
+  804b99:	d3 e7                	shl    %cl,%edi
+  804b9b:	09 74 24 18          	or     %esi,0x18(%esp)
+  804b9f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804ba3:	eb 90                	jmp    804b35 <udivmod+0x46>
+  804ba5:	85 db                	test   %ebx,%ebx
+  804ba7:	74 05                	je     804bae <udivmod+0xbf>
+  804ba9:	89 03                	mov    %eax,(%ebx)
+  804bab:	89 53 04             	mov    %edx,0x4(%ebx)
+  804bae:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804bb2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804bb6:	83 c4 24             	add    $0x24,%esp
+  804bb9:	5b                   	pop    %ebx
+  804bba:	5e                   	pop    %esi
+  804bbb:	5f                   	pop    %edi
+  804bbc:	5d                   	pop    %ebp
+  804bbd:	c3                   	ret
+
+00804bbe <__udivdi3>:
+  804bbe:	83 ec 08             	sub    $0x8,%esp
+  804bc1:	6a 00                	push   $0x0
+  804bc3:	ff 74 24 1c          	push   0x1c(%esp)
+  804bc7:	ff 74 24 1c          	push   0x1c(%esp)
+  804bcb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804bcf:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804bd3:	e8 17 ff ff ff       	call   804aef <udivmod>
+  804bd8:	83 c4 14             	add    $0x14,%esp
+  804bdb:	c3                   	ret
+
+00804bdc <__umoddi3>:
+  804bdc:	83 ec 18             	sub    $0x18,%esp
+  804bdf:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804be3:	50                   	push   %eax
+  804be4:	ff 74 24 2c          	push   0x2c(%esp)
+  804be8:	ff 74 24 2c          	push   0x2c(%esp)
+  804bec:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804bf0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804bf4:	e8 f6 fe ff ff       	call   804aef <udivmod>
+  804bf9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804bfd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804c01:	83 c4 24             	add    $0x24,%esp
+  804c04:	c3                   	ret
+
+00804c05 <__divdi3>:
+  804c05:	55                   	push   %ebp
+  804c06:	57                   	push   %edi
+  804c07:	56                   	push   %esi
+  804c08:	53                   	push   %ebx
+  804c09:	83 ec 10             	sub    $0x10,%esp
+  804c0c:	8b 44 24 24          	mov    0x24(%esp),%eax
+  804c10:	8b 54 24 28          	mov    0x28(%esp),%edx
+  804c14:	89 c6                	mov    %eax,%esi
+  804c16:	89 d7                	mov    %edx,%edi
+  804c18:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  804c1c:	33 7c 24 30          	xor    0x30(%esp),%edi
+  804c20:	89 74 24 04          	mov    %esi,0x4(%esp)
+  804c24:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  804c28:	89 c5                	mov    %eax,%ebp
+  804c2a:	f7 dd                	neg    %ebp
+  804c2c:	89 d6                	mov    %edx,%esi
+  804c2e:	83 d6 00             	adc    $0x0,%esi
+  804c31:	f7 de                	neg    %esi
+  804c33:	0f 48 e8             	cmovs  %eax,%ebp
+  804c36:	0f 49 d6             	cmovns %esi,%edx
+  804c39:	6a 00                	push   $0x0
+  804c3b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  804c3f:	f7 de                	neg    %esi
+  804c41:	8b 44 24 34          	mov    0x34(%esp),%eax
+  804c45:	83 d0 00             	adc    $0x0,%eax
+  804c48:	f7 d8                	neg    %eax
+  804c4a:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  804c4f:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  804c54:	50                   	push   %eax
+  804c55:	56                   	push   %esi
+  804c56:	89 e8                	mov    %ebp,%eax
+  804c58:	e8 92 fe ff ff       	call   804aef <udivmod>
+  804c5d:	83 c4 10             	add    $0x10,%esp
+  804c60:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  804c65:	78 08                	js     804c6f <__divdi3+0x6a>
+  804c67:	83 c4 0c             	add    $0xc,%esp
+  804c6a:	5b                   	pop    %ebx
+  804c6b:	5e                   	pop    %esi
+  804c6c:	5f                   	pop    %edi
+  804c6d:	5d                   	pop    %ebp
+  804c6e:	c3                   	ret
+  804c6f:	f7 d8                	neg    %eax
+  804c71:	83 d2 00             	adc    $0x0,%edx
+  804c74:	f7 da                	neg    %edx
+  804c76:	eb ef                	jmp    804c67 <__divdi3+0x62>
+
+00804c78 <__moddi3>:
+  804c78:	55                   	push   %ebp
+  804c79:	57                   	push   %edi
+  804c7a:	56                   	push   %esi
+  804c7b:	53                   	push   %ebx
+  804c7c:	83 ec 18             	sub    $0x18,%esp
+  804c7f:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  804c83:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  804c87:	89 f1                	mov    %esi,%ecx
+  804c89:	f7 d9                	neg    %ecx
+  804c8b:	89 da                	mov    %ebx,%edx
+  804c8d:	83 d2 00             	adc    $0x0,%edx
+  804c90:	f7 da                	neg    %edx
+  804c92:	0f 48 ce             	cmovs  %esi,%ecx
+  804c95:	0f 48 d3             	cmovs  %ebx,%edx
+  804c98:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804c9c:	50                   	push   %eax
+  804c9d:	8b 74 24 38          	mov    0x38(%esp),%esi
+  804ca1:	f7 de                	neg    %esi
+  804ca3:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  804ca7:	83 d0 00             	adc    $0x0,%eax
+  804caa:	f7 d8                	neg    %eax
+  804cac:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  804cb1:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  804cb6:	50                   	push   %eax
+  804cb7:	56                   	push   %esi
+  804cb8:	89 c8                	mov    %ecx,%eax
+  804cba:	e8 30 fe ff ff       	call   804aef <udivmod>
+  804cbf:	83 c4 10             	add    $0x10,%esp
+  804cc2:	85 db                	test   %ebx,%ebx
+  804cc4:	78 10                	js     804cd6 <__moddi3+0x5e>
+  804cc6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804cca:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804cce:	83 c4 14             	add    $0x14,%esp
+  804cd1:	5b                   	pop    %ebx
+  804cd2:	5e                   	pop    %esi
+  804cd3:	5f                   	pop    %edi
+  804cd4:	5d                   	pop    %ebp
+  804cd5:	c3                   	ret
+  804cd6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804cda:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804cde:	f7 d8                	neg    %eax
+  804ce0:	83 d2 00             	adc    $0x0,%edx
+  804ce3:	f7 da                	neg    %edx
+  804ce5:	eb e7                	jmp    804cce <__moddi3+0x56>
@@ -0,0 +1,9908 @@
+
+obj/user/faultallocbad.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 85 00 00 00       	call   8000b6 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+int
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+
+	cprintf("fault %x\n", addr);
+  80003f:	53                   	push   %ebx
+  800040:	68 e0 4c 80 00       	push   $0x804ce0
+  800045:	e8 aa 01 00 00       	call   8001f4 <cprintf>
+	if ((r = page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004a:	6a 01                	push   $0x1
+  80004c:	6a 07                	push   $0x7
+  80004e:	89 d8                	mov    %ebx,%eax
+  800050:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800055:	50                   	push   %eax
+  800056:	6a 00                	push   $0x0
+  800058:	e8 8d 35 00 00       	call   8035ea <page_alloc>
+  80005d:	83 c4 20             	add    $0x20,%esp
+  800060:	85 c0                	test   %eax,%eax
+  800062:	78 18                	js     80007c <handler+0x49>
+				PTE_P|PTE_U|PTE_W, 1)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800064:	53                   	push   %ebx
+  800065:	68 2c 4d 80 00       	push   $0x804d2c
+  80006a:	6a 64                	push   $0x64
+  80006c:	53                   	push   %ebx
+  80006d:	e8 14 07 00 00       	call   800786 <snprintf>
+	return 1;
+}
+  800072:	b8 01 00 00 00       	mov    $0x1,%eax
+  800077:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80007a:	c9                   	leave
+  80007b:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  80007c:	83 ec 0c             	sub    $0xc,%esp
+  80007f:	50                   	push   %eax
+  800080:	53                   	push   %ebx
+  800081:	68 00 4d 80 00       	push   $0x804d00
+  800086:	6a 0f                	push   $0xf
+  800088:	68 ea 4c 80 00       	push   $0x804cea
+  80008d:	e8 87 00 00 00       	call   800119 <_panic>
+
+00800092 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800092:	55                   	push   %ebp
+  800093:	89 e5                	mov    %esp,%ebp
+  800095:	83 ec 14             	sub    $0x14,%esp
+	add_pgfault_handler(handler);
+  800098:	68 33 00 80 00       	push   $0x800033
+  80009d:	e8 59 12 00 00       	call   8012fb <add_pgfault_handler>
+	sys_cputs((char*)0xDEADBEEF, 4);
+  8000a2:	83 c4 08             	add    $0x8,%esp
+  8000a5:	6a 04                	push   $0x4
+  8000a7:	68 ef be ad de       	push   $0xdeadbeef
+  8000ac:	e8 50 0b 00 00       	call   800c01 <sys_cputs>
+}
+  8000b1:	83 c4 10             	add    $0x10,%esp
+  8000b4:	c9                   	leave
+  8000b5:	c3                   	ret
+
+008000b6 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000b6:	55                   	push   %ebp
+  8000b7:	89 e5                	mov    %esp,%ebp
+  8000b9:	56                   	push   %esi
+  8000ba:	53                   	push   %ebx
+  8000bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000be:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8000c1:	e8 ca 0b 00 00       	call   800c90 <sys_getenvid>
+  8000c6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000cb:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8000ce:	c1 e0 06             	shl    $0x6,%eax
+  8000d1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000d6:	a3 14 e9 80 00       	mov    %eax,0x80e914
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000db:	85 db                	test   %ebx,%ebx
+  8000dd:	7e 07                	jle    8000e6 <libmain+0x30>
+		binaryname = argv[0];
+  8000df:	8b 06                	mov    (%esi),%eax
+  8000e1:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  8000e6:	83 ec 08             	sub    $0x8,%esp
+  8000e9:	56                   	push   %esi
+  8000ea:	53                   	push   %ebx
+  8000eb:	e8 a2 ff ff ff       	call   800092 <umain>
+
+	// exit gracefully
+	exit();
+  8000f0:	e8 0a 00 00 00       	call   8000ff <exit>
+}
+  8000f5:	83 c4 10             	add    $0x10,%esp
+  8000f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000fb:	5b                   	pop    %ebx
+  8000fc:	5e                   	pop    %esi
+  8000fd:	5d                   	pop    %ebp
+  8000fe:	c3                   	ret
+
+008000ff <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000ff:	55                   	push   %ebp
+  800100:	89 e5                	mov    %esp,%ebp
+  800102:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800105:	e8 44 14 00 00       	call   80154e <close_all>
+	sys_env_destroy(0);
+  80010a:	83 ec 0c             	sub    $0xc,%esp
+  80010d:	6a 00                	push   $0x0
+  80010f:	e8 3b 0b 00 00       	call   800c4f <sys_env_destroy>
+}
+  800114:	83 c4 10             	add    $0x10,%esp
+  800117:	c9                   	leave
+  800118:	c3                   	ret
+
+00800119 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800119:	55                   	push   %ebp
+  80011a:	89 e5                	mov    %esp,%ebp
+  80011c:	56                   	push   %esi
+  80011d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80011e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800121:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  800127:	e8 64 0b 00 00       	call   800c90 <sys_getenvid>
+  80012c:	83 ec 0c             	sub    $0xc,%esp
+  80012f:	ff 75 0c             	push   0xc(%ebp)
+  800132:	ff 75 08             	push   0x8(%ebp)
+  800135:	56                   	push   %esi
+  800136:	50                   	push   %eax
+  800137:	68 58 4d 80 00       	push   $0x804d58
+  80013c:	e8 b3 00 00 00       	call   8001f4 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800141:	83 c4 18             	add    $0x18,%esp
+  800144:	53                   	push   %ebx
+  800145:	ff 75 10             	push   0x10(%ebp)
+  800148:	e8 56 00 00 00       	call   8001a3 <vcprintf>
+	cprintf("\n");
+  80014d:	c7 04 24 5d 52 80 00 	movl   $0x80525d,(%esp)
+  800154:	e8 9b 00 00 00       	call   8001f4 <cprintf>
+  800159:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80015c:	cc                   	int3
+	while (1)
+  80015d:	eb fd                	jmp    80015c <_panic+0x43>
+
+0080015f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80015f:	55                   	push   %ebp
+  800160:	89 e5                	mov    %esp,%ebp
+  800162:	53                   	push   %ebx
+  800163:	83 ec 04             	sub    $0x4,%esp
+  800166:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800169:	8b 13                	mov    (%ebx),%edx
+  80016b:	8d 42 01             	lea    0x1(%edx),%eax
+  80016e:	89 03                	mov    %eax,(%ebx)
+  800170:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800173:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800177:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80017c:	74 09                	je     800187 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80017e:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800182:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800185:	c9                   	leave
+  800186:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800187:	83 ec 08             	sub    $0x8,%esp
+  80018a:	68 ff 00 00 00       	push   $0xff
+  80018f:	8d 43 08             	lea    0x8(%ebx),%eax
+  800192:	50                   	push   %eax
+  800193:	e8 69 0a 00 00       	call   800c01 <sys_cputs>
+		b->idx = 0;
+  800198:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80019e:	83 c4 10             	add    $0x10,%esp
+  8001a1:	eb db                	jmp    80017e <putch+0x1f>
+
+008001a3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001a3:	55                   	push   %ebp
+  8001a4:	89 e5                	mov    %esp,%ebp
+  8001a6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001ac:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001b3:	00 00 00 
+	b.cnt = 0;
+  8001b6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001bd:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001c0:	ff 75 0c             	push   0xc(%ebp)
+  8001c3:	ff 75 08             	push   0x8(%ebp)
+  8001c6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001cc:	50                   	push   %eax
+  8001cd:	68 5f 01 80 00       	push   $0x80015f
+  8001d2:	e8 14 01 00 00       	call   8002eb <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001d7:	83 c4 08             	add    $0x8,%esp
+  8001da:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001e0:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001e6:	50                   	push   %eax
+  8001e7:	e8 15 0a 00 00       	call   800c01 <sys_cputs>
+
+	return b.cnt;
+}
+  8001ec:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001f2:	c9                   	leave
+  8001f3:	c3                   	ret
+
+008001f4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001f4:	55                   	push   %ebp
+  8001f5:	89 e5                	mov    %esp,%ebp
+  8001f7:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001fa:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001fd:	50                   	push   %eax
+  8001fe:	ff 75 08             	push   0x8(%ebp)
+  800201:	e8 9d ff ff ff       	call   8001a3 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800206:	c9                   	leave
+  800207:	c3                   	ret
+
+00800208 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800208:	55                   	push   %ebp
+  800209:	89 e5                	mov    %esp,%ebp
+  80020b:	57                   	push   %edi
+  80020c:	56                   	push   %esi
+  80020d:	53                   	push   %ebx
+  80020e:	83 ec 1c             	sub    $0x1c,%esp
+  800211:	89 c7                	mov    %eax,%edi
+  800213:	89 d6                	mov    %edx,%esi
+  800215:	8b 45 08             	mov    0x8(%ebp),%eax
+  800218:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80021b:	89 d1                	mov    %edx,%ecx
+  80021d:	89 c2                	mov    %eax,%edx
+  80021f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800222:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800225:	8b 45 10             	mov    0x10(%ebp),%eax
+  800228:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80022b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80022e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800235:	39 c2                	cmp    %eax,%edx
+  800237:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80023a:	72 3e                	jb     80027a <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80023c:	83 ec 0c             	sub    $0xc,%esp
+  80023f:	ff 75 18             	push   0x18(%ebp)
+  800242:	83 eb 01             	sub    $0x1,%ebx
+  800245:	53                   	push   %ebx
+  800246:	50                   	push   %eax
+  800247:	83 ec 08             	sub    $0x8,%esp
+  80024a:	ff 75 e4             	push   -0x1c(%ebp)
+  80024d:	ff 75 e0             	push   -0x20(%ebp)
+  800250:	ff 75 dc             	push   -0x24(%ebp)
+  800253:	ff 75 d8             	push   -0x28(%ebp)
+  800256:	e8 4e 49 00 00       	call   804ba9 <__udivdi3>
+  80025b:	83 c4 18             	add    $0x18,%esp
+  80025e:	52                   	push   %edx
+  80025f:	50                   	push   %eax
+  800260:	89 f2                	mov    %esi,%edx
+  800262:	89 f8                	mov    %edi,%eax
+  800264:	e8 9f ff ff ff       	call   800208 <printnum>
+  800269:	83 c4 20             	add    $0x20,%esp
+  80026c:	eb 13                	jmp    800281 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80026e:	83 ec 08             	sub    $0x8,%esp
+  800271:	56                   	push   %esi
+  800272:	ff 75 18             	push   0x18(%ebp)
+  800275:	ff d7                	call   *%edi
+  800277:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80027a:	83 eb 01             	sub    $0x1,%ebx
+  80027d:	85 db                	test   %ebx,%ebx
+  80027f:	7f ed                	jg     80026e <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800281:	83 ec 08             	sub    $0x8,%esp
+  800284:	56                   	push   %esi
+  800285:	83 ec 04             	sub    $0x4,%esp
+  800288:	ff 75 e4             	push   -0x1c(%ebp)
+  80028b:	ff 75 e0             	push   -0x20(%ebp)
+  80028e:	ff 75 dc             	push   -0x24(%ebp)
+  800291:	ff 75 d8             	push   -0x28(%ebp)
+  800294:	e8 2e 49 00 00       	call   804bc7 <__umoddi3>
+  800299:	83 c4 14             	add    $0x14,%esp
+  80029c:	0f be 80 7b 4d 80 00 	movsbl 0x804d7b(%eax),%eax
+  8002a3:	50                   	push   %eax
+  8002a4:	ff d7                	call   *%edi
+}
+  8002a6:	83 c4 10             	add    $0x10,%esp
+  8002a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ac:	5b                   	pop    %ebx
+  8002ad:	5e                   	pop    %esi
+  8002ae:	5f                   	pop    %edi
+  8002af:	5d                   	pop    %ebp
+  8002b0:	c3                   	ret
+
+008002b1 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002b1:	55                   	push   %ebp
+  8002b2:	89 e5                	mov    %esp,%ebp
+  8002b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002b7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002bb:	8b 10                	mov    (%eax),%edx
+  8002bd:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002c0:	73 0a                	jae    8002cc <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002c2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002c5:	89 08                	mov    %ecx,(%eax)
+  8002c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ca:	88 02                	mov    %al,(%edx)
+}
+  8002cc:	5d                   	pop    %ebp
+  8002cd:	c3                   	ret
+
+008002ce <printfmt>:
+{
+  8002ce:	55                   	push   %ebp
+  8002cf:	89 e5                	mov    %esp,%ebp
+  8002d1:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002d4:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002d7:	50                   	push   %eax
+  8002d8:	ff 75 10             	push   0x10(%ebp)
+  8002db:	ff 75 0c             	push   0xc(%ebp)
+  8002de:	ff 75 08             	push   0x8(%ebp)
+  8002e1:	e8 05 00 00 00       	call   8002eb <vprintfmt>
+}
+  8002e6:	83 c4 10             	add    $0x10,%esp
+  8002e9:	c9                   	leave
+  8002ea:	c3                   	ret
+
+008002eb <vprintfmt>:
+{
+  8002eb:	55                   	push   %ebp
+  8002ec:	89 e5                	mov    %esp,%ebp
+  8002ee:	57                   	push   %edi
+  8002ef:	56                   	push   %esi
+  8002f0:	53                   	push   %ebx
+  8002f1:	83 ec 2c             	sub    $0x2c,%esp
+  8002f4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002f7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002fa:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002fd:	eb 0a                	jmp    800309 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002ff:	83 ec 08             	sub    $0x8,%esp
+  800302:	53                   	push   %ebx
+  800303:	50                   	push   %eax
+  800304:	ff d6                	call   *%esi
+  800306:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800309:	83 c7 01             	add    $0x1,%edi
+  80030c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800310:	83 f8 25             	cmp    $0x25,%eax
+  800313:	74 0c                	je     800321 <vprintfmt+0x36>
+			if (ch == '\0')
+  800315:	85 c0                	test   %eax,%eax
+  800317:	75 e6                	jne    8002ff <vprintfmt+0x14>
+}
+  800319:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80031c:	5b                   	pop    %ebx
+  80031d:	5e                   	pop    %esi
+  80031e:	5f                   	pop    %edi
+  80031f:	5d                   	pop    %ebp
+  800320:	c3                   	ret
+		padc = ' ';
+  800321:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800325:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80032c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800333:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80033a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80033f:	8d 47 01             	lea    0x1(%edi),%eax
+  800342:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800345:	0f b6 17             	movzbl (%edi),%edx
+  800348:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80034b:	3c 55                	cmp    $0x55,%al
+  80034d:	0f 87 c5 03 00 00    	ja     800718 <vprintfmt+0x42d>
+  800353:	0f b6 c0             	movzbl %al,%eax
+  800356:	ff 24 85 00 4f 80 00 	jmp    *0x804f00(,%eax,4)
+  80035d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800360:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800364:	eb d9                	jmp    80033f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800366:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800369:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80036d:	eb d0                	jmp    80033f <vprintfmt+0x54>
+  80036f:	0f b6 d2             	movzbl %dl,%edx
+  800372:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800375:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80037d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800380:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800384:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800387:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80038a:	83 f9 09             	cmp    $0x9,%ecx
+  80038d:	77 55                	ja     8003e4 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80038f:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800392:	eb e9                	jmp    80037d <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800394:	8b 45 14             	mov    0x14(%ebp),%eax
+  800397:	8b 00                	mov    (%eax),%eax
+  800399:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80039c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039f:	8d 40 04             	lea    0x4(%eax),%eax
+  8003a2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003a8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ac:	79 91                	jns    80033f <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003ae:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003b4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003bb:	eb 82                	jmp    80033f <vprintfmt+0x54>
+			if (width < 0)
+  8003bd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003c0:	85 d2                	test   %edx,%edx
+  8003c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c7:	0f 49 c2             	cmovns %edx,%eax
+  8003ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003cd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003d0:	e9 6a ff ff ff       	jmp    80033f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003d8:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003df:	e9 5b ff ff ff       	jmp    80033f <vprintfmt+0x54>
+  8003e4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003e7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ea:	eb bc                	jmp    8003a8 <vprintfmt+0xbd>
+			lflag++;
+  8003ec:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ef:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003f2:	e9 48 ff ff ff       	jmp    80033f <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fa:	8d 78 04             	lea    0x4(%eax),%edi
+  8003fd:	83 ec 08             	sub    $0x8,%esp
+  800400:	53                   	push   %ebx
+  800401:	ff 30                	push   (%eax)
+  800403:	ff d6                	call   *%esi
+			break;
+  800405:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800408:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80040b:	e9 63 02 00 00       	jmp    800673 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800410:	8b 45 14             	mov    0x14(%ebp),%eax
+  800413:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800416:	8b 10                	mov    (%eax),%edx
+  800418:	89 d0                	mov    %edx,%eax
+  80041a:	f7 d8                	neg    %eax
+  80041c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80041f:	83 f8 12             	cmp    $0x12,%eax
+  800422:	7f 23                	jg     800447 <vprintfmt+0x15c>
+  800424:	8b 14 85 60 50 80 00 	mov    0x805060(,%eax,4),%edx
+  80042b:	85 d2                	test   %edx,%edx
+  80042d:	74 18                	je     800447 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80042f:	52                   	push   %edx
+  800430:	68 e9 51 80 00       	push   $0x8051e9
+  800435:	53                   	push   %ebx
+  800436:	56                   	push   %esi
+  800437:	e8 92 fe ff ff       	call   8002ce <printfmt>
+  80043c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80043f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800442:	e9 2c 02 00 00       	jmp    800673 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  800447:	50                   	push   %eax
+  800448:	68 93 4d 80 00       	push   $0x804d93
+  80044d:	53                   	push   %ebx
+  80044e:	56                   	push   %esi
+  80044f:	e8 7a fe ff ff       	call   8002ce <printfmt>
+  800454:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800457:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80045a:	e9 14 02 00 00       	jmp    800673 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80045f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800462:	83 c0 04             	add    $0x4,%eax
+  800465:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800468:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046b:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80046d:	85 c9                	test   %ecx,%ecx
+  80046f:	b8 8c 4d 80 00       	mov    $0x804d8c,%eax
+  800474:	0f 45 c1             	cmovne %ecx,%eax
+  800477:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80047a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80047e:	7e 06                	jle    800486 <vprintfmt+0x19b>
+  800480:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800484:	75 0b                	jne    800491 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800486:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800489:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80048c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80048f:	eb 5c                	jmp    8004ed <vprintfmt+0x202>
+  800491:	83 ec 08             	sub    $0x8,%esp
+  800494:	ff 75 d0             	push   -0x30(%ebp)
+  800497:	ff 75 cc             	push   -0x34(%ebp)
+  80049a:	e8 19 03 00 00       	call   8007b8 <strnlen>
+  80049f:	89 c2                	mov    %eax,%edx
+  8004a1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004a4:	29 d0                	sub    %edx,%eax
+  8004a6:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004a9:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004ad:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004b0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004b3:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004b5:	eb 0e                	jmp    8004c5 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004b7:	83 ec 08             	sub    $0x8,%esp
+  8004ba:	53                   	push   %ebx
+  8004bb:	57                   	push   %edi
+  8004bc:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004bf:	83 ee 01             	sub    $0x1,%esi
+  8004c2:	83 c4 10             	add    $0x10,%esp
+  8004c5:	85 f6                	test   %esi,%esi
+  8004c7:	7f ee                	jg     8004b7 <vprintfmt+0x1cc>
+  8004c9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004cc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004cf:	85 c0                	test   %eax,%eax
+  8004d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d6:	0f 49 d0             	cmovns %eax,%edx
+  8004d9:	29 d0                	sub    %edx,%eax
+  8004db:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004de:	eb a6                	jmp    800486 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004e0:	83 ec 08             	sub    $0x8,%esp
+  8004e3:	53                   	push   %ebx
+  8004e4:	52                   	push   %edx
+  8004e5:	ff 55 08             	call   *0x8(%ebp)
+  8004e8:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004eb:	89 f1                	mov    %esi,%ecx
+  8004ed:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004f0:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004f4:	0f be d0             	movsbl %al,%edx
+  8004f7:	85 d2                	test   %edx,%edx
+  8004f9:	74 28                	je     800523 <vprintfmt+0x238>
+  8004fb:	85 ff                	test   %edi,%edi
+  8004fd:	78 05                	js     800504 <vprintfmt+0x219>
+  8004ff:	83 ef 01             	sub    $0x1,%edi
+  800502:	78 30                	js     800534 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800504:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800508:	74 d6                	je     8004e0 <vprintfmt+0x1f5>
+  80050a:	0f be c0             	movsbl %al,%eax
+  80050d:	83 e8 20             	sub    $0x20,%eax
+  800510:	83 f8 5e             	cmp    $0x5e,%eax
+  800513:	76 cb                	jbe    8004e0 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800515:	83 ec 08             	sub    $0x8,%esp
+  800518:	53                   	push   %ebx
+  800519:	6a 3f                	push   $0x3f
+  80051b:	ff 55 08             	call   *0x8(%ebp)
+  80051e:	83 c4 10             	add    $0x10,%esp
+  800521:	eb c8                	jmp    8004eb <vprintfmt+0x200>
+  800523:	8b 75 08             	mov    0x8(%ebp),%esi
+  800526:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800529:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80052c:	01 d0                	add    %edx,%eax
+  80052e:	29 c8                	sub    %ecx,%eax
+  800530:	89 c7                	mov    %eax,%edi
+  800532:	eb 13                	jmp    800547 <vprintfmt+0x25c>
+  800534:	8b 75 08             	mov    0x8(%ebp),%esi
+  800537:	eb ed                	jmp    800526 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800539:	83 ec 08             	sub    $0x8,%esp
+  80053c:	53                   	push   %ebx
+  80053d:	6a 20                	push   $0x20
+  80053f:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800541:	83 ef 01             	sub    $0x1,%edi
+  800544:	83 c4 10             	add    $0x10,%esp
+  800547:	85 ff                	test   %edi,%edi
+  800549:	7f ee                	jg     800539 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80054b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80054e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800551:	e9 1d 01 00 00       	jmp    800673 <vprintfmt+0x388>
+	if (lflag >= 2)
+  800556:	83 f9 01             	cmp    $0x1,%ecx
+  800559:	7f 1b                	jg     800576 <vprintfmt+0x28b>
+	else if (lflag)
+  80055b:	85 c9                	test   %ecx,%ecx
+  80055d:	74 63                	je     8005c2 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  80055f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800562:	8b 00                	mov    (%eax),%eax
+  800564:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800567:	99                   	cltd
+  800568:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80056b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056e:	8d 40 04             	lea    0x4(%eax),%eax
+  800571:	89 45 14             	mov    %eax,0x14(%ebp)
+  800574:	eb 17                	jmp    80058d <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  800576:	8b 45 14             	mov    0x14(%ebp),%eax
+  800579:	8b 50 04             	mov    0x4(%eax),%edx
+  80057c:	8b 00                	mov    (%eax),%eax
+  80057e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800581:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800584:	8b 45 14             	mov    0x14(%ebp),%eax
+  800587:	8d 40 08             	lea    0x8(%eax),%eax
+  80058a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80058d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800590:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800593:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800598:	85 c9                	test   %ecx,%ecx
+  80059a:	0f 89 b9 00 00 00    	jns    800659 <vprintfmt+0x36e>
+				putch('-', putdat);
+  8005a0:	83 ec 08             	sub    $0x8,%esp
+  8005a3:	53                   	push   %ebx
+  8005a4:	6a 2d                	push   $0x2d
+  8005a6:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005a8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ab:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005ae:	f7 da                	neg    %edx
+  8005b0:	83 d1 00             	adc    $0x0,%ecx
+  8005b3:	f7 d9                	neg    %ecx
+  8005b5:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005b8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005bd:	e9 97 00 00 00       	jmp    800659 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8005c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c5:	8b 00                	mov    (%eax),%eax
+  8005c7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ca:	99                   	cltd
+  8005cb:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d7:	eb b4                	jmp    80058d <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8005d9:	83 f9 01             	cmp    $0x1,%ecx
+  8005dc:	7f 1b                	jg     8005f9 <vprintfmt+0x30e>
+	else if (lflag)
+  8005de:	85 c9                	test   %ecx,%ecx
+  8005e0:	74 2c                	je     80060e <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8005e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e5:	8b 10                	mov    (%eax),%edx
+  8005e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ef:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005f7:	eb 60                	jmp    800659 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8005f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fc:	8b 10                	mov    (%eax),%edx
+  8005fe:	8b 48 04             	mov    0x4(%eax),%ecx
+  800601:	8d 40 08             	lea    0x8(%eax),%eax
+  800604:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800607:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80060c:	eb 4b                	jmp    800659 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80060e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800611:	8b 10                	mov    (%eax),%edx
+  800613:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800618:	8d 40 04             	lea    0x4(%eax),%eax
+  80061b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80061e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800623:	eb 34                	jmp    800659 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800625:	83 f9 01             	cmp    $0x1,%ecx
+  800628:	7f 15                	jg     80063f <vprintfmt+0x354>
+	else if (lflag)
+  80062a:	85 c9                	test   %ecx,%ecx
+  80062c:	74 4d                	je     80067b <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  80062e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800631:	8b 00                	mov    (%eax),%eax
+  800633:	99                   	cltd
+  800634:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800637:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80063a:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80063d:	eb 11                	jmp    800650 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  80063f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800642:	8b 50 04             	mov    0x4(%eax),%edx
+  800645:	8b 00                	mov    (%eax),%eax
+  800647:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80064a:	8d 49 08             	lea    0x8(%ecx),%ecx
+  80064d:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800650:	89 d1                	mov    %edx,%ecx
+  800652:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800654:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800659:	83 ec 0c             	sub    $0xc,%esp
+  80065c:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800660:	50                   	push   %eax
+  800661:	ff 75 e0             	push   -0x20(%ebp)
+  800664:	57                   	push   %edi
+  800665:	51                   	push   %ecx
+  800666:	52                   	push   %edx
+  800667:	89 da                	mov    %ebx,%edx
+  800669:	89 f0                	mov    %esi,%eax
+  80066b:	e8 98 fb ff ff       	call   800208 <printnum>
+			break;
+  800670:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800673:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800676:	e9 8e fc ff ff       	jmp    800309 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	8b 00                	mov    (%eax),%eax
+  800680:	99                   	cltd
+  800681:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800684:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800687:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80068a:	eb c4                	jmp    800650 <vprintfmt+0x365>
+			putch('0', putdat);
+  80068c:	83 ec 08             	sub    $0x8,%esp
+  80068f:	53                   	push   %ebx
+  800690:	6a 30                	push   $0x30
+  800692:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800694:	83 c4 08             	add    $0x8,%esp
+  800697:	53                   	push   %ebx
+  800698:	6a 78                	push   $0x78
+  80069a:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80069c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069f:	8b 10                	mov    (%eax),%edx
+  8006a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006a6:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006a9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ac:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006af:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8006b4:	eb a3                	jmp    800659 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8006b6:	83 f9 01             	cmp    $0x1,%ecx
+  8006b9:	7f 1b                	jg     8006d6 <vprintfmt+0x3eb>
+	else if (lflag)
+  8006bb:	85 c9                	test   %ecx,%ecx
+  8006bd:	74 2f                	je     8006ee <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8006bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c2:	8b 10                	mov    (%eax),%edx
+  8006c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006cf:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006d4:	eb 83                	jmp    800659 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8006d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d9:	8b 10                	mov    (%eax),%edx
+  8006db:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006de:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006e9:	e9 6b ff ff ff       	jmp    800659 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8006ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f1:	8b 10                	mov    (%eax),%edx
+  8006f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006fe:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800703:	e9 51 ff ff ff       	jmp    800659 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800708:	83 ec 08             	sub    $0x8,%esp
+  80070b:	53                   	push   %ebx
+  80070c:	6a 25                	push   $0x25
+  80070e:	ff d6                	call   *%esi
+			break;
+  800710:	83 c4 10             	add    $0x10,%esp
+  800713:	e9 5b ff ff ff       	jmp    800673 <vprintfmt+0x388>
+			putch('%', putdat);
+  800718:	83 ec 08             	sub    $0x8,%esp
+  80071b:	53                   	push   %ebx
+  80071c:	6a 25                	push   $0x25
+  80071e:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800720:	83 c4 10             	add    $0x10,%esp
+  800723:	89 f8                	mov    %edi,%eax
+  800725:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800729:	74 05                	je     800730 <vprintfmt+0x445>
+  80072b:	83 e8 01             	sub    $0x1,%eax
+  80072e:	eb f5                	jmp    800725 <vprintfmt+0x43a>
+  800730:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800733:	e9 3b ff ff ff       	jmp    800673 <vprintfmt+0x388>
+
+00800738 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800738:	55                   	push   %ebp
+  800739:	89 e5                	mov    %esp,%ebp
+  80073b:	83 ec 18             	sub    $0x18,%esp
+  80073e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800741:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800744:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800747:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80074b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80074e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800755:	85 c0                	test   %eax,%eax
+  800757:	74 26                	je     80077f <vsnprintf+0x47>
+  800759:	85 d2                	test   %edx,%edx
+  80075b:	7e 22                	jle    80077f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80075d:	ff 75 14             	push   0x14(%ebp)
+  800760:	ff 75 10             	push   0x10(%ebp)
+  800763:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800766:	50                   	push   %eax
+  800767:	68 b1 02 80 00       	push   $0x8002b1
+  80076c:	e8 7a fb ff ff       	call   8002eb <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800771:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800774:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800777:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80077a:	83 c4 10             	add    $0x10,%esp
+}
+  80077d:	c9                   	leave
+  80077e:	c3                   	ret
+		return -E_INVAL;
+  80077f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800784:	eb f7                	jmp    80077d <vsnprintf+0x45>
+
+00800786 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800786:	55                   	push   %ebp
+  800787:	89 e5                	mov    %esp,%ebp
+  800789:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80078c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80078f:	50                   	push   %eax
+  800790:	ff 75 10             	push   0x10(%ebp)
+  800793:	ff 75 0c             	push   0xc(%ebp)
+  800796:	ff 75 08             	push   0x8(%ebp)
+  800799:	e8 9a ff ff ff       	call   800738 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80079e:	c9                   	leave
+  80079f:	c3                   	ret
+
+008007a0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007a0:	55                   	push   %ebp
+  8007a1:	89 e5                	mov    %esp,%ebp
+  8007a3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ab:	eb 03                	jmp    8007b0 <strlen+0x10>
+		n++;
+  8007ad:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007b0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007b4:	75 f7                	jne    8007ad <strlen+0xd>
+	return n;
+}
+  8007b6:	5d                   	pop    %ebp
+  8007b7:	c3                   	ret
+
+008007b8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007b8:	55                   	push   %ebp
+  8007b9:	89 e5                	mov    %esp,%ebp
+  8007bb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c6:	eb 03                	jmp    8007cb <strnlen+0x13>
+		n++;
+  8007c8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007cb:	39 d0                	cmp    %edx,%eax
+  8007cd:	74 08                	je     8007d7 <strnlen+0x1f>
+  8007cf:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007d3:	75 f3                	jne    8007c8 <strnlen+0x10>
+  8007d5:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007d7:	89 d0                	mov    %edx,%eax
+  8007d9:	5d                   	pop    %ebp
+  8007da:	c3                   	ret
+
+008007db <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007db:	55                   	push   %ebp
+  8007dc:	89 e5                	mov    %esp,%ebp
+  8007de:	53                   	push   %ebx
+  8007df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007e2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ea:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007ee:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007f1:	83 c0 01             	add    $0x1,%eax
+  8007f4:	84 d2                	test   %dl,%dl
+  8007f6:	75 f2                	jne    8007ea <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007f8:	89 c8                	mov    %ecx,%eax
+  8007fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007fd:	c9                   	leave
+  8007fe:	c3                   	ret
+
+008007ff <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007ff:	55                   	push   %ebp
+  800800:	89 e5                	mov    %esp,%ebp
+  800802:	53                   	push   %ebx
+  800803:	83 ec 10             	sub    $0x10,%esp
+  800806:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800809:	53                   	push   %ebx
+  80080a:	e8 91 ff ff ff       	call   8007a0 <strlen>
+  80080f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800812:	ff 75 0c             	push   0xc(%ebp)
+  800815:	01 d8                	add    %ebx,%eax
+  800817:	50                   	push   %eax
+  800818:	e8 be ff ff ff       	call   8007db <strcpy>
+	return dst;
+}
+  80081d:	89 d8                	mov    %ebx,%eax
+  80081f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800822:	c9                   	leave
+  800823:	c3                   	ret
+
+00800824 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800824:	55                   	push   %ebp
+  800825:	89 e5                	mov    %esp,%ebp
+  800827:	56                   	push   %esi
+  800828:	53                   	push   %ebx
+  800829:	8b 75 08             	mov    0x8(%ebp),%esi
+  80082c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80082f:	89 f3                	mov    %esi,%ebx
+  800831:	03 5d 10             	add    0x10(%ebp),%ebx
+  800834:	89 f0                	mov    %esi,%eax
+  800836:	eb 0f                	jmp    800847 <strncpy+0x23>
+		*dst++ = *src;
+  800838:	83 c0 01             	add    $0x1,%eax
+  80083b:	0f b6 0a             	movzbl (%edx),%ecx
+  80083e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800841:	80 f9 01             	cmp    $0x1,%cl
+  800844:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800847:	39 d8                	cmp    %ebx,%eax
+  800849:	75 ed                	jne    800838 <strncpy+0x14>
+	}
+	return ret;
+}
+  80084b:	89 f0                	mov    %esi,%eax
+  80084d:	5b                   	pop    %ebx
+  80084e:	5e                   	pop    %esi
+  80084f:	5d                   	pop    %ebp
+  800850:	c3                   	ret
+
+00800851 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800851:	55                   	push   %ebp
+  800852:	89 e5                	mov    %esp,%ebp
+  800854:	56                   	push   %esi
+  800855:	53                   	push   %ebx
+  800856:	8b 75 08             	mov    0x8(%ebp),%esi
+  800859:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80085c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80085f:	89 f0                	mov    %esi,%eax
+  800861:	85 d2                	test   %edx,%edx
+  800863:	74 21                	je     800886 <strlcpy+0x35>
+  800865:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800869:	89 f2                	mov    %esi,%edx
+  80086b:	eb 09                	jmp    800876 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80086d:	83 c1 01             	add    $0x1,%ecx
+  800870:	83 c2 01             	add    $0x1,%edx
+  800873:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800876:	39 c2                	cmp    %eax,%edx
+  800878:	74 09                	je     800883 <strlcpy+0x32>
+  80087a:	0f b6 19             	movzbl (%ecx),%ebx
+  80087d:	84 db                	test   %bl,%bl
+  80087f:	75 ec                	jne    80086d <strlcpy+0x1c>
+  800881:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800883:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800886:	29 f0                	sub    %esi,%eax
+}
+  800888:	5b                   	pop    %ebx
+  800889:	5e                   	pop    %esi
+  80088a:	5d                   	pop    %ebp
+  80088b:	c3                   	ret
+
+0080088c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80088c:	55                   	push   %ebp
+  80088d:	89 e5                	mov    %esp,%ebp
+  80088f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800892:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800895:	eb 06                	jmp    80089d <strcmp+0x11>
+		p++, q++;
+  800897:	83 c1 01             	add    $0x1,%ecx
+  80089a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80089d:	0f b6 01             	movzbl (%ecx),%eax
+  8008a0:	84 c0                	test   %al,%al
+  8008a2:	74 04                	je     8008a8 <strcmp+0x1c>
+  8008a4:	3a 02                	cmp    (%edx),%al
+  8008a6:	74 ef                	je     800897 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008a8:	0f b6 c0             	movzbl %al,%eax
+  8008ab:	0f b6 12             	movzbl (%edx),%edx
+  8008ae:	29 d0                	sub    %edx,%eax
+}
+  8008b0:	5d                   	pop    %ebp
+  8008b1:	c3                   	ret
+
+008008b2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008b2:	55                   	push   %ebp
+  8008b3:	89 e5                	mov    %esp,%ebp
+  8008b5:	53                   	push   %ebx
+  8008b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008bc:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008bf:	eb 09                	jmp    8008ca <strncmp+0x18>
+		n--, p++, q++;
+  8008c1:	83 ea 01             	sub    $0x1,%edx
+  8008c4:	83 c0 01             	add    $0x1,%eax
+  8008c7:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008ca:	85 d2                	test   %edx,%edx
+  8008cc:	74 18                	je     8008e6 <strncmp+0x34>
+  8008ce:	0f b6 18             	movzbl (%eax),%ebx
+  8008d1:	84 db                	test   %bl,%bl
+  8008d3:	74 04                	je     8008d9 <strncmp+0x27>
+  8008d5:	3a 19                	cmp    (%ecx),%bl
+  8008d7:	74 e8                	je     8008c1 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008d9:	0f b6 00             	movzbl (%eax),%eax
+  8008dc:	0f b6 11             	movzbl (%ecx),%edx
+  8008df:	29 d0                	sub    %edx,%eax
+}
+  8008e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e4:	c9                   	leave
+  8008e5:	c3                   	ret
+		return 0;
+  8008e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008eb:	eb f4                	jmp    8008e1 <strncmp+0x2f>
+
+008008ed <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008ed:	55                   	push   %ebp
+  8008ee:	89 e5                	mov    %esp,%ebp
+  8008f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008f7:	eb 03                	jmp    8008fc <strchr+0xf>
+  8008f9:	83 c0 01             	add    $0x1,%eax
+  8008fc:	0f b6 10             	movzbl (%eax),%edx
+  8008ff:	84 d2                	test   %dl,%dl
+  800901:	74 06                	je     800909 <strchr+0x1c>
+		if (*s == c)
+  800903:	38 ca                	cmp    %cl,%dl
+  800905:	75 f2                	jne    8008f9 <strchr+0xc>
+  800907:	eb 05                	jmp    80090e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800909:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80090e:	5d                   	pop    %ebp
+  80090f:	c3                   	ret
+
+00800910 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800910:	55                   	push   %ebp
+  800911:	89 e5                	mov    %esp,%ebp
+  800913:	8b 45 08             	mov    0x8(%ebp),%eax
+  800916:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80091a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80091d:	38 ca                	cmp    %cl,%dl
+  80091f:	74 09                	je     80092a <strfind+0x1a>
+  800921:	84 d2                	test   %dl,%dl
+  800923:	74 05                	je     80092a <strfind+0x1a>
+	for (; *s; s++)
+  800925:	83 c0 01             	add    $0x1,%eax
+  800928:	eb f0                	jmp    80091a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80092a:	5d                   	pop    %ebp
+  80092b:	c3                   	ret
+
+0080092c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80092c:	55                   	push   %ebp
+  80092d:	89 e5                	mov    %esp,%ebp
+  80092f:	57                   	push   %edi
+  800930:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800933:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800936:	85 c9                	test   %ecx,%ecx
+  800938:	74 20                	je     80095a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80093a:	89 f8                	mov    %edi,%eax
+  80093c:	09 c8                	or     %ecx,%eax
+  80093e:	a8 03                	test   $0x3,%al
+  800940:	75 12                	jne    800954 <memset+0x28>
+		c &= 0xFF;
+  800942:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800946:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80094c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80094f:	fc                   	cld
+  800950:	f3 ab                	rep stos %eax,%es:(%edi)
+  800952:	eb 06                	jmp    80095a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800954:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800957:	fc                   	cld
+  800958:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80095a:	89 f8                	mov    %edi,%eax
+  80095c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80095f:	c9                   	leave
+  800960:	c3                   	ret
+
+00800961 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800961:	55                   	push   %ebp
+  800962:	89 e5                	mov    %esp,%ebp
+  800964:	57                   	push   %edi
+  800965:	56                   	push   %esi
+  800966:	8b 45 08             	mov    0x8(%ebp),%eax
+  800969:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80096c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80096f:	39 c6                	cmp    %eax,%esi
+  800971:	73 32                	jae    8009a5 <memmove+0x44>
+  800973:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800976:	39 d0                	cmp    %edx,%eax
+  800978:	73 2b                	jae    8009a5 <memmove+0x44>
+		s += n;
+		d += n;
+  80097a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80097d:	89 d6                	mov    %edx,%esi
+  80097f:	09 fe                	or     %edi,%esi
+  800981:	09 ce                	or     %ecx,%esi
+  800983:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800989:	75 0e                	jne    800999 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80098b:	83 ef 04             	sub    $0x4,%edi
+  80098e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800991:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800994:	fd                   	std
+  800995:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800997:	eb 09                	jmp    8009a2 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800999:	83 ef 01             	sub    $0x1,%edi
+  80099c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80099f:	fd                   	std
+  8009a0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009a2:	fc                   	cld
+  8009a3:	eb 1a                	jmp    8009bf <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009a5:	89 f2                	mov    %esi,%edx
+  8009a7:	09 c2                	or     %eax,%edx
+  8009a9:	09 ca                	or     %ecx,%edx
+  8009ab:	f6 c2 03             	test   $0x3,%dl
+  8009ae:	75 0a                	jne    8009ba <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009b0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009b3:	89 c7                	mov    %eax,%edi
+  8009b5:	fc                   	cld
+  8009b6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009b8:	eb 05                	jmp    8009bf <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009ba:	89 c7                	mov    %eax,%edi
+  8009bc:	fc                   	cld
+  8009bd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009bf:	5e                   	pop    %esi
+  8009c0:	5f                   	pop    %edi
+  8009c1:	5d                   	pop    %ebp
+  8009c2:	c3                   	ret
+
+008009c3 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009c3:	55                   	push   %ebp
+  8009c4:	89 e5                	mov    %esp,%ebp
+  8009c6:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009c9:	ff 75 10             	push   0x10(%ebp)
+  8009cc:	ff 75 0c             	push   0xc(%ebp)
+  8009cf:	ff 75 08             	push   0x8(%ebp)
+  8009d2:	e8 8a ff ff ff       	call   800961 <memmove>
+}
+  8009d7:	c9                   	leave
+  8009d8:	c3                   	ret
+
+008009d9 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009d9:	55                   	push   %ebp
+  8009da:	89 e5                	mov    %esp,%ebp
+  8009dc:	56                   	push   %esi
+  8009dd:	53                   	push   %ebx
+  8009de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009e4:	89 c6                	mov    %eax,%esi
+  8009e6:	03 75 10             	add    0x10(%ebp),%esi
+  8009e9:	eb 06                	jmp    8009f1 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009eb:	83 c0 01             	add    $0x1,%eax
+  8009ee:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009f1:	39 f0                	cmp    %esi,%eax
+  8009f3:	74 14                	je     800a09 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009f5:	0f b6 08             	movzbl (%eax),%ecx
+  8009f8:	0f b6 1a             	movzbl (%edx),%ebx
+  8009fb:	38 d9                	cmp    %bl,%cl
+  8009fd:	74 ec                	je     8009eb <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009ff:	0f b6 c1             	movzbl %cl,%eax
+  800a02:	0f b6 db             	movzbl %bl,%ebx
+  800a05:	29 d8                	sub    %ebx,%eax
+  800a07:	eb 05                	jmp    800a0e <memcmp+0x35>
+	}
+
+	return 0;
+  800a09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a0e:	5b                   	pop    %ebx
+  800a0f:	5e                   	pop    %esi
+  800a10:	5d                   	pop    %ebp
+  800a11:	c3                   	ret
+
+00800a12 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a12:	55                   	push   %ebp
+  800a13:	89 e5                	mov    %esp,%ebp
+  800a15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a1b:	89 c2                	mov    %eax,%edx
+  800a1d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a20:	eb 03                	jmp    800a25 <memfind+0x13>
+  800a22:	83 c0 01             	add    $0x1,%eax
+  800a25:	39 d0                	cmp    %edx,%eax
+  800a27:	73 04                	jae    800a2d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a29:	38 08                	cmp    %cl,(%eax)
+  800a2b:	75 f5                	jne    800a22 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a2d:	5d                   	pop    %ebp
+  800a2e:	c3                   	ret
+
+00800a2f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a2f:	55                   	push   %ebp
+  800a30:	89 e5                	mov    %esp,%ebp
+  800a32:	57                   	push   %edi
+  800a33:	56                   	push   %esi
+  800a34:	53                   	push   %ebx
+  800a35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a38:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a3b:	eb 03                	jmp    800a40 <strtol+0x11>
+		s++;
+  800a3d:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a40:	0f b6 02             	movzbl (%edx),%eax
+  800a43:	3c 20                	cmp    $0x20,%al
+  800a45:	74 f6                	je     800a3d <strtol+0xe>
+  800a47:	3c 09                	cmp    $0x9,%al
+  800a49:	74 f2                	je     800a3d <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a4b:	3c 2b                	cmp    $0x2b,%al
+  800a4d:	74 2a                	je     800a79 <strtol+0x4a>
+	int neg = 0;
+  800a4f:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a54:	3c 2d                	cmp    $0x2d,%al
+  800a56:	74 2b                	je     800a83 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a58:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a5e:	75 0f                	jne    800a6f <strtol+0x40>
+  800a60:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a63:	74 28                	je     800a8d <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a65:	85 db                	test   %ebx,%ebx
+  800a67:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a6c:	0f 44 d8             	cmove  %eax,%ebx
+  800a6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a74:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a77:	eb 46                	jmp    800abf <strtol+0x90>
+		s++;
+  800a79:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a81:	eb d5                	jmp    800a58 <strtol+0x29>
+		s++, neg = 1;
+  800a83:	83 c2 01             	add    $0x1,%edx
+  800a86:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a8b:	eb cb                	jmp    800a58 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a8d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a91:	74 0e                	je     800aa1 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a93:	85 db                	test   %ebx,%ebx
+  800a95:	75 d8                	jne    800a6f <strtol+0x40>
+		s++, base = 8;
+  800a97:	83 c2 01             	add    $0x1,%edx
+  800a9a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a9f:	eb ce                	jmp    800a6f <strtol+0x40>
+		s += 2, base = 16;
+  800aa1:	83 c2 02             	add    $0x2,%edx
+  800aa4:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800aa9:	eb c4                	jmp    800a6f <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800aab:	0f be c0             	movsbl %al,%eax
+  800aae:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ab1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ab4:	7d 3a                	jge    800af0 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ab6:	83 c2 01             	add    $0x1,%edx
+  800ab9:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800abd:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800abf:	0f b6 02             	movzbl (%edx),%eax
+  800ac2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ac5:	89 f3                	mov    %esi,%ebx
+  800ac7:	80 fb 09             	cmp    $0x9,%bl
+  800aca:	76 df                	jbe    800aab <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800acc:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800acf:	89 f3                	mov    %esi,%ebx
+  800ad1:	80 fb 19             	cmp    $0x19,%bl
+  800ad4:	77 08                	ja     800ade <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ad6:	0f be c0             	movsbl %al,%eax
+  800ad9:	83 e8 57             	sub    $0x57,%eax
+  800adc:	eb d3                	jmp    800ab1 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ade:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ae1:	89 f3                	mov    %esi,%ebx
+  800ae3:	80 fb 19             	cmp    $0x19,%bl
+  800ae6:	77 08                	ja     800af0 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ae8:	0f be c0             	movsbl %al,%eax
+  800aeb:	83 e8 37             	sub    $0x37,%eax
+  800aee:	eb c1                	jmp    800ab1 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800af0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800af4:	74 05                	je     800afb <strtol+0xcc>
+		*endptr = (char *) s;
+  800af6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800af9:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800afb:	89 c8                	mov    %ecx,%eax
+  800afd:	f7 d8                	neg    %eax
+  800aff:	85 ff                	test   %edi,%edi
+  800b01:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b04:	89 c8                	mov    %ecx,%eax
+  800b06:	5b                   	pop    %ebx
+  800b07:	5e                   	pop    %esi
+  800b08:	5f                   	pop    %edi
+  800b09:	5d                   	pop    %ebp
+  800b0a:	c3                   	ret
+
+00800b0b <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800b0b:	55                   	push   %ebp
+  800b0c:	89 e5                	mov    %esp,%ebp
+  800b0e:	57                   	push   %edi
+  800b0f:	56                   	push   %esi
+  800b10:	53                   	push   %ebx
+  800b11:	83 ec 0c             	sub    $0xc,%esp
+  800b14:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b17:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b1a:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800b1d:	85 ff                	test   %edi,%edi
+  800b1f:	74 16                	je     800b37 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800b21:	83 ec 04             	sub    $0x4,%esp
+  800b24:	56                   	push   %esi
+  800b25:	6a 00                	push   $0x0
+  800b27:	53                   	push   %ebx
+  800b28:	e8 02 ff ff ff       	call   800a2f <strtol>
+  800b2d:	89 07                	mov    %eax,(%edi)
+  800b2f:	83 c4 10             	add    $0x10,%esp
+  800b32:	eb 03                	jmp    800b37 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800b34:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800b37:	0f b6 03             	movzbl (%ebx),%eax
+  800b3a:	3c 20                	cmp    $0x20,%al
+  800b3c:	74 f6                	je     800b34 <strisl+0x29>
+  800b3e:	3c 09                	cmp    $0x9,%al
+  800b40:	74 f2                	je     800b34 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b42:	3c 2b                	cmp    $0x2b,%al
+  800b44:	74 23                	je     800b69 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800b46:	3c 2d                	cmp    $0x2d,%al
+  800b48:	0f 94 c0             	sete   %al
+  800b4b:	0f b6 c0             	movzbl %al,%eax
+  800b4e:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b50:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800b56:	75 41                	jne    800b99 <strisl+0x8e>
+  800b58:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800b5b:	74 11                	je     800b6e <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b5d:	85 f6                	test   %esi,%esi
+  800b5f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b64:	0f 44 f0             	cmove  %eax,%esi
+  800b67:	eb 30                	jmp    800b99 <strisl+0x8e>
+		s++;
+  800b69:	83 c3 01             	add    $0x1,%ebx
+  800b6c:	eb e2                	jmp    800b50 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b6e:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800b72:	74 0e                	je     800b82 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800b74:	85 f6                	test   %esi,%esi
+  800b76:	75 21                	jne    800b99 <strisl+0x8e>
+		s++, base = 8;
+  800b78:	83 c3 01             	add    $0x1,%ebx
+  800b7b:	be 08 00 00 00       	mov    $0x8,%esi
+  800b80:	eb 17                	jmp    800b99 <strisl+0x8e>
+		s += 2, base = 16;
+  800b82:	83 c3 02             	add    $0x2,%ebx
+  800b85:	be 10 00 00 00       	mov    $0x10,%esi
+  800b8a:	eb 0d                	jmp    800b99 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b8c:	0f be c0             	movsbl %al,%eax
+  800b8f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800b92:	39 f0                	cmp    %esi,%eax
+  800b94:	7d 38                	jge    800bce <strisl+0xc3>
+			return 0;
+		s++;
+  800b96:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800b99:	0f b6 03             	movzbl (%ebx),%eax
+  800b9c:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800b9f:	80 fa 09             	cmp    $0x9,%dl
+  800ba2:	76 e8                	jbe    800b8c <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800ba4:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800ba7:	80 fa 19             	cmp    $0x19,%dl
+  800baa:	77 08                	ja     800bb4 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800bac:	0f be c0             	movsbl %al,%eax
+  800baf:	83 e8 57             	sub    $0x57,%eax
+  800bb2:	eb de                	jmp    800b92 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bb4:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800bb7:	80 fa 19             	cmp    $0x19,%dl
+  800bba:	77 08                	ja     800bc4 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800bbc:	0f be c0             	movsbl %al,%eax
+  800bbf:	83 e8 37             	sub    $0x37,%eax
+  800bc2:	eb ce                	jmp    800b92 <strisl+0x87>
+		else if (!*s)
+  800bc4:	84 c0                	test   %al,%al
+  800bc6:	0f 94 c0             	sete   %al
+  800bc9:	0f b6 c0             	movzbl %al,%eax
+  800bcc:	eb 05                	jmp    800bd3 <strisl+0xc8>
+			return 0;
+  800bce:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800bd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bd6:	5b                   	pop    %ebx
+  800bd7:	5e                   	pop    %esi
+  800bd8:	5f                   	pop    %edi
+  800bd9:	5d                   	pop    %ebp
+  800bda:	c3                   	ret
+
+00800bdb <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800bdb:	55                   	push   %ebp
+  800bdc:	89 e5                	mov    %esp,%ebp
+  800bde:	83 ec 10             	sub    $0x10,%esp
+  800be1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800be4:	89 c8                	mov    %ecx,%eax
+  800be6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800beb:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800bee:	eb 0b                	jmp    800bfb <touch_mem+0x20>
+		c = *(char *)page;
+  800bf0:	0f b6 10             	movzbl (%eax),%edx
+  800bf3:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800bf6:	05 00 10 00 00       	add    $0x1000,%eax
+  800bfb:	39 c8                	cmp    %ecx,%eax
+  800bfd:	72 f1                	jb     800bf0 <touch_mem+0x15>
+}
+  800bff:	c9                   	leave
+  800c00:	c3                   	ret
+
+00800c01 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c01:	55                   	push   %ebp
+  800c02:	89 e5                	mov    %esp,%ebp
+  800c04:	57                   	push   %edi
+  800c05:	56                   	push   %esi
+  800c06:	53                   	push   %ebx
+	touch_mem(s, len);
+  800c07:	ff 75 0c             	push   0xc(%ebp)
+  800c0a:	ff 75 08             	push   0x8(%ebp)
+  800c0d:	e8 c9 ff ff ff       	call   800bdb <touch_mem>
+	asm volatile("int %1\n"
+  800c12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c17:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c1d:	89 c3                	mov    %eax,%ebx
+  800c1f:	89 c7                	mov    %eax,%edi
+  800c21:	89 c6                	mov    %eax,%esi
+  800c23:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c25:	83 c4 08             	add    $0x8,%esp
+  800c28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c2b:	5b                   	pop    %ebx
+  800c2c:	5e                   	pop    %esi
+  800c2d:	5f                   	pop    %edi
+  800c2e:	5d                   	pop    %ebp
+  800c2f:	c3                   	ret
+
+00800c30 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c30:	55                   	push   %ebp
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	57                   	push   %edi
+  800c34:	56                   	push   %esi
+  800c35:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c36:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c3b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c40:	89 d1                	mov    %edx,%ecx
+  800c42:	89 d3                	mov    %edx,%ebx
+  800c44:	89 d7                	mov    %edx,%edi
+  800c46:	89 d6                	mov    %edx,%esi
+  800c48:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c4a:	5b                   	pop    %ebx
+  800c4b:	5e                   	pop    %esi
+  800c4c:	5f                   	pop    %edi
+  800c4d:	5d                   	pop    %ebp
+  800c4e:	c3                   	ret
+
+00800c4f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c4f:	55                   	push   %ebp
+  800c50:	89 e5                	mov    %esp,%ebp
+  800c52:	57                   	push   %edi
+  800c53:	56                   	push   %esi
+  800c54:	53                   	push   %ebx
+  800c55:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c60:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c65:	89 cb                	mov    %ecx,%ebx
+  800c67:	89 cf                	mov    %ecx,%edi
+  800c69:	89 ce                	mov    %ecx,%esi
+  800c6b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c6d:	85 c0                	test   %eax,%eax
+  800c6f:	7f 08                	jg     800c79 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c74:	5b                   	pop    %ebx
+  800c75:	5e                   	pop    %esi
+  800c76:	5f                   	pop    %edi
+  800c77:	5d                   	pop    %ebp
+  800c78:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c79:	83 ec 0c             	sub    $0xc,%esp
+  800c7c:	50                   	push   %eax
+  800c7d:	6a 03                	push   $0x3
+  800c7f:	68 cb 50 80 00       	push   $0x8050cb
+  800c84:	6a 23                	push   $0x23
+  800c86:	68 e8 50 80 00       	push   $0x8050e8
+  800c8b:	e8 89 f4 ff ff       	call   800119 <_panic>
+
+00800c90 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c90:	55                   	push   %ebp
+  800c91:	89 e5                	mov    %esp,%ebp
+  800c93:	57                   	push   %edi
+  800c94:	56                   	push   %esi
+  800c95:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c96:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c9b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ca0:	89 d1                	mov    %edx,%ecx
+  800ca2:	89 d3                	mov    %edx,%ebx
+  800ca4:	89 d7                	mov    %edx,%edi
+  800ca6:	89 d6                	mov    %edx,%esi
+  800ca8:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800caa:	5b                   	pop    %ebx
+  800cab:	5e                   	pop    %esi
+  800cac:	5f                   	pop    %edi
+  800cad:	5d                   	pop    %ebp
+  800cae:	c3                   	ret
+
+00800caf <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800caf:	55                   	push   %ebp
+  800cb0:	89 e5                	mov    %esp,%ebp
+  800cb2:	57                   	push   %edi
+  800cb3:	56                   	push   %esi
+  800cb4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cba:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cbf:	89 d1                	mov    %edx,%ecx
+  800cc1:	89 d3                	mov    %edx,%ebx
+  800cc3:	89 d7                	mov    %edx,%edi
+  800cc5:	89 d6                	mov    %edx,%esi
+  800cc7:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cc9:	5b                   	pop    %ebx
+  800cca:	5e                   	pop    %esi
+  800ccb:	5f                   	pop    %edi
+  800ccc:	5d                   	pop    %ebp
+  800ccd:	c3                   	ret
+
+00800cce <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cce:	55                   	push   %ebp
+  800ccf:	89 e5                	mov    %esp,%ebp
+  800cd1:	57                   	push   %edi
+  800cd2:	56                   	push   %esi
+  800cd3:	53                   	push   %ebx
+  800cd4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cd7:	be 00 00 00 00       	mov    $0x0,%esi
+  800cdc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ce7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cea:	89 f7                	mov    %esi,%edi
+  800cec:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cee:	85 c0                	test   %eax,%eax
+  800cf0:	7f 08                	jg     800cfa <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cf2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf5:	5b                   	pop    %ebx
+  800cf6:	5e                   	pop    %esi
+  800cf7:	5f                   	pop    %edi
+  800cf8:	5d                   	pop    %ebp
+  800cf9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cfa:	83 ec 0c             	sub    $0xc,%esp
+  800cfd:	50                   	push   %eax
+  800cfe:	6a 04                	push   $0x4
+  800d00:	68 cb 50 80 00       	push   $0x8050cb
+  800d05:	6a 23                	push   $0x23
+  800d07:	68 e8 50 80 00       	push   $0x8050e8
+  800d0c:	e8 08 f4 ff ff       	call   800119 <_panic>
+
+00800d11 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d11:	55                   	push   %ebp
+  800d12:	89 e5                	mov    %esp,%ebp
+  800d14:	57                   	push   %edi
+  800d15:	56                   	push   %esi
+  800d16:	53                   	push   %ebx
+  800d17:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d20:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d28:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d2b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d2e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d30:	85 c0                	test   %eax,%eax
+  800d32:	7f 08                	jg     800d3c <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d37:	5b                   	pop    %ebx
+  800d38:	5e                   	pop    %esi
+  800d39:	5f                   	pop    %edi
+  800d3a:	5d                   	pop    %ebp
+  800d3b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d3c:	83 ec 0c             	sub    $0xc,%esp
+  800d3f:	50                   	push   %eax
+  800d40:	6a 05                	push   $0x5
+  800d42:	68 cb 50 80 00       	push   $0x8050cb
+  800d47:	6a 23                	push   $0x23
+  800d49:	68 e8 50 80 00       	push   $0x8050e8
+  800d4e:	e8 c6 f3 ff ff       	call   800119 <_panic>
+
+00800d53 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d53:	55                   	push   %ebp
+  800d54:	89 e5                	mov    %esp,%ebp
+  800d56:	57                   	push   %edi
+  800d57:	56                   	push   %esi
+  800d58:	53                   	push   %ebx
+  800d59:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d67:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d6c:	89 df                	mov    %ebx,%edi
+  800d6e:	89 de                	mov    %ebx,%esi
+  800d70:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d72:	85 c0                	test   %eax,%eax
+  800d74:	7f 08                	jg     800d7e <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d79:	5b                   	pop    %ebx
+  800d7a:	5e                   	pop    %esi
+  800d7b:	5f                   	pop    %edi
+  800d7c:	5d                   	pop    %ebp
+  800d7d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d7e:	83 ec 0c             	sub    $0xc,%esp
+  800d81:	50                   	push   %eax
+  800d82:	6a 06                	push   $0x6
+  800d84:	68 cb 50 80 00       	push   $0x8050cb
+  800d89:	6a 23                	push   $0x23
+  800d8b:	68 e8 50 80 00       	push   $0x8050e8
+  800d90:	e8 84 f3 ff ff       	call   800119 <_panic>
+
+00800d95 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800d95:	55                   	push   %ebp
+  800d96:	89 e5                	mov    %esp,%ebp
+  800d98:	57                   	push   %edi
+  800d99:	56                   	push   %esi
+  800d9a:	53                   	push   %ebx
+  800d9b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800da3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da9:	b8 18 00 00 00       	mov    $0x18,%eax
+  800dae:	89 df                	mov    %ebx,%edi
+  800db0:	89 de                	mov    %ebx,%esi
+  800db2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800db4:	85 c0                	test   %eax,%eax
+  800db6:	7f 08                	jg     800dc0 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800db8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dbb:	5b                   	pop    %ebx
+  800dbc:	5e                   	pop    %esi
+  800dbd:	5f                   	pop    %edi
+  800dbe:	5d                   	pop    %ebp
+  800dbf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dc0:	83 ec 0c             	sub    $0xc,%esp
+  800dc3:	50                   	push   %eax
+  800dc4:	6a 18                	push   $0x18
+  800dc6:	68 cb 50 80 00       	push   $0x8050cb
+  800dcb:	6a 23                	push   $0x23
+  800dcd:	68 e8 50 80 00       	push   $0x8050e8
+  800dd2:	e8 42 f3 ff ff       	call   800119 <_panic>
+
+00800dd7 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800dd7:	55                   	push   %ebp
+  800dd8:	89 e5                	mov    %esp,%ebp
+  800dda:	57                   	push   %edi
+  800ddb:	56                   	push   %esi
+  800ddc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ddd:	be 00 00 00 00       	mov    $0x0,%esi
+  800de2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de8:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ded:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df0:	89 f7                	mov    %esi,%edi
+  800df2:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800df4:	5b                   	pop    %ebx
+  800df5:	5e                   	pop    %esi
+  800df6:	5f                   	pop    %edi
+  800df7:	5d                   	pop    %ebp
+  800df8:	c3                   	ret
+
+00800df9 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800df9:	55                   	push   %ebp
+  800dfa:	89 e5                	mov    %esp,%ebp
+  800dfc:	57                   	push   %edi
+  800dfd:	56                   	push   %esi
+  800dfe:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e05:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e0a:	be 00 00 00 00       	mov    $0x0,%esi
+  800e0f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e12:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e15:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e17:	5b                   	pop    %ebx
+  800e18:	5e                   	pop    %esi
+  800e19:	5f                   	pop    %edi
+  800e1a:	5d                   	pop    %ebp
+  800e1b:	c3                   	ret
+
+00800e1c <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e1c:	55                   	push   %ebp
+  800e1d:	89 e5                	mov    %esp,%ebp
+  800e1f:	57                   	push   %edi
+  800e20:	56                   	push   %esi
+  800e21:	53                   	push   %ebx
+  800e22:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800e25:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800e28:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800e2e:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800e31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e37:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e3c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e3f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e42:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e44:	85 c0                	test   %eax,%eax
+  800e46:	7f 08                	jg     800e50 <sys_page_map_range+0x34>
+}
+  800e48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4b:	5b                   	pop    %ebx
+  800e4c:	5e                   	pop    %esi
+  800e4d:	5f                   	pop    %edi
+  800e4e:	5d                   	pop    %ebp
+  800e4f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e50:	83 ec 0c             	sub    $0xc,%esp
+  800e53:	50                   	push   %eax
+  800e54:	6a 10                	push   $0x10
+  800e56:	68 cb 50 80 00       	push   $0x8050cb
+  800e5b:	6a 23                	push   $0x23
+  800e5d:	68 e8 50 80 00       	push   $0x8050e8
+  800e62:	e8 b2 f2 ff ff       	call   800119 <_panic>
+
+00800e67 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e67:	55                   	push   %ebp
+  800e68:	89 e5                	mov    %esp,%ebp
+  800e6a:	57                   	push   %edi
+  800e6b:	56                   	push   %esi
+  800e6c:	53                   	push   %ebx
+  800e6d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e70:	be 00 00 00 00       	mov    $0x0,%esi
+  800e75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7b:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e80:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e83:	89 f7                	mov    %esi,%edi
+  800e85:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e87:	85 c0                	test   %eax,%eax
+  800e89:	7f 08                	jg     800e93 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8e:	5b                   	pop    %ebx
+  800e8f:	5e                   	pop    %esi
+  800e90:	5f                   	pop    %edi
+  800e91:	5d                   	pop    %ebp
+  800e92:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e93:	83 ec 0c             	sub    $0xc,%esp
+  800e96:	50                   	push   %eax
+  800e97:	6a 11                	push   $0x11
+  800e99:	68 cb 50 80 00       	push   $0x8050cb
+  800e9e:	6a 23                	push   $0x23
+  800ea0:	68 e8 50 80 00       	push   $0x8050e8
+  800ea5:	e8 6f f2 ff ff       	call   800119 <_panic>
+
+00800eaa <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800eaa:	55                   	push   %ebp
+  800eab:	89 e5                	mov    %esp,%ebp
+  800ead:	57                   	push   %edi
+  800eae:	56                   	push   %esi
+  800eaf:	53                   	push   %ebx
+  800eb0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb3:	be 00 00 00 00       	mov    $0x0,%esi
+  800eb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebe:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800ec3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec6:	89 f7                	mov    %esi,%edi
+  800ec8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eca:	85 c0                	test   %eax,%eax
+  800ecc:	7f 08                	jg     800ed6 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ece:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed1:	5b                   	pop    %ebx
+  800ed2:	5e                   	pop    %esi
+  800ed3:	5f                   	pop    %edi
+  800ed4:	5d                   	pop    %ebp
+  800ed5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed6:	83 ec 0c             	sub    $0xc,%esp
+  800ed9:	50                   	push   %eax
+  800eda:	6a 1b                	push   $0x1b
+  800edc:	68 cb 50 80 00       	push   $0x8050cb
+  800ee1:	6a 23                	push   $0x23
+  800ee3:	68 e8 50 80 00       	push   $0x8050e8
+  800ee8:	e8 2c f2 ff ff       	call   800119 <_panic>
+
+00800eed <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800eed:	55                   	push   %ebp
+  800eee:	89 e5                	mov    %esp,%ebp
+  800ef0:	57                   	push   %edi
+  800ef1:	56                   	push   %esi
+  800ef2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ef3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef8:	b8 12 00 00 00       	mov    $0x12,%eax
+  800efd:	89 d1                	mov    %edx,%ecx
+  800eff:	89 d3                	mov    %edx,%ebx
+  800f01:	89 d7                	mov    %edx,%edi
+  800f03:	89 d6                	mov    %edx,%esi
+  800f05:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f07:	5b                   	pop    %ebx
+  800f08:	5e                   	pop    %esi
+  800f09:	5f                   	pop    %edi
+  800f0a:	5d                   	pop    %ebp
+  800f0b:	c3                   	ret
+
+00800f0c <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f0c:	55                   	push   %ebp
+  800f0d:	89 e5                	mov    %esp,%ebp
+  800f0f:	57                   	push   %edi
+  800f10:	56                   	push   %esi
+  800f11:	53                   	push   %ebx
+  800f12:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f20:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f25:	89 df                	mov    %ebx,%edi
+  800f27:	89 de                	mov    %ebx,%esi
+  800f29:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f2b:	85 c0                	test   %eax,%eax
+  800f2d:	7f 08                	jg     800f37 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f32:	5b                   	pop    %ebx
+  800f33:	5e                   	pop    %esi
+  800f34:	5f                   	pop    %edi
+  800f35:	5d                   	pop    %ebp
+  800f36:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f37:	83 ec 0c             	sub    $0xc,%esp
+  800f3a:	50                   	push   %eax
+  800f3b:	6a 08                	push   $0x8
+  800f3d:	68 cb 50 80 00       	push   $0x8050cb
+  800f42:	6a 23                	push   $0x23
+  800f44:	68 e8 50 80 00       	push   $0x8050e8
+  800f49:	e8 cb f1 ff ff       	call   800119 <_panic>
+
+00800f4e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f4e:	55                   	push   %ebp
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	57                   	push   %edi
+  800f52:	56                   	push   %esi
+  800f53:	53                   	push   %ebx
+  800f54:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800f57:	6a 44                	push   $0x44
+  800f59:	ff 75 0c             	push   0xc(%ebp)
+  800f5c:	e8 7a fc ff ff       	call   800bdb <touch_mem>
+	asm volatile("int %1\n"
+  800f61:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f66:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f69:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f71:	89 df                	mov    %ebx,%edi
+  800f73:	89 de                	mov    %ebx,%esi
+  800f75:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f77:	83 c4 08             	add    $0x8,%esp
+  800f7a:	85 c0                	test   %eax,%eax
+  800f7c:	7f 08                	jg     800f86 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f81:	5b                   	pop    %ebx
+  800f82:	5e                   	pop    %esi
+  800f83:	5f                   	pop    %edi
+  800f84:	5d                   	pop    %ebp
+  800f85:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f86:	83 ec 0c             	sub    $0xc,%esp
+  800f89:	50                   	push   %eax
+  800f8a:	6a 09                	push   $0x9
+  800f8c:	68 cb 50 80 00       	push   $0x8050cb
+  800f91:	6a 23                	push   $0x23
+  800f93:	68 e8 50 80 00       	push   $0x8050e8
+  800f98:	e8 7c f1 ff ff       	call   800119 <_panic>
+
+00800f9d <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800f9d:	55                   	push   %ebp
+  800f9e:	89 e5                	mov    %esp,%ebp
+  800fa0:	57                   	push   %edi
+  800fa1:	56                   	push   %esi
+  800fa2:	53                   	push   %ebx
+  800fa3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fa6:	be 00 00 00 00       	mov    $0x0,%esi
+  800fab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800fb6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb9:	89 f7                	mov    %esi,%edi
+  800fbb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fbd:	85 c0                	test   %eax,%eax
+  800fbf:	7f 08                	jg     800fc9 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800fc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc4:	5b                   	pop    %ebx
+  800fc5:	5e                   	pop    %esi
+  800fc6:	5f                   	pop    %edi
+  800fc7:	5d                   	pop    %ebp
+  800fc8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc9:	83 ec 0c             	sub    $0xc,%esp
+  800fcc:	50                   	push   %eax
+  800fcd:	6a 1a                	push   $0x1a
+  800fcf:	68 cb 50 80 00       	push   $0x8050cb
+  800fd4:	6a 23                	push   $0x23
+  800fd6:	68 e8 50 80 00       	push   $0x8050e8
+  800fdb:	e8 39 f1 ff ff       	call   800119 <_panic>
+
+00800fe0 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  800fe0:	55                   	push   %ebp
+  800fe1:	89 e5                	mov    %esp,%ebp
+  800fe3:	57                   	push   %edi
+  800fe4:	56                   	push   %esi
+  800fe5:	53                   	push   %ebx
+  800fe6:	83 ec 0c             	sub    $0xc,%esp
+  800fe9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  800fec:	89 d8                	mov    %ebx,%eax
+  800fee:	c1 e0 05             	shl    $0x5,%eax
+  800ff1:	50                   	push   %eax
+  800ff2:	ff 75 0c             	push   0xc(%ebp)
+  800ff5:	e8 e1 fb ff ff       	call   800bdb <touch_mem>
+	asm volatile("int %1\n"
+  800ffa:	be 00 00 00 00       	mov    $0x0,%esi
+  800fff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801002:	b8 13 00 00 00       	mov    $0x13,%eax
+  801007:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100a:	89 f7                	mov    %esi,%edi
+  80100c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80100e:	83 c4 08             	add    $0x8,%esp
+  801011:	85 c0                	test   %eax,%eax
+  801013:	7f 08                	jg     80101d <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  801015:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801018:	5b                   	pop    %ebx
+  801019:	5e                   	pop    %esi
+  80101a:	5f                   	pop    %edi
+  80101b:	5d                   	pop    %ebp
+  80101c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80101d:	83 ec 0c             	sub    $0xc,%esp
+  801020:	50                   	push   %eax
+  801021:	6a 13                	push   $0x13
+  801023:	68 cb 50 80 00       	push   $0x8050cb
+  801028:	6a 23                	push   $0x23
+  80102a:	68 e8 50 80 00       	push   $0x8050e8
+  80102f:	e8 e5 f0 ff ff       	call   800119 <_panic>
+
+00801034 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801034:	55                   	push   %ebp
+  801035:	89 e5                	mov    %esp,%ebp
+  801037:	57                   	push   %edi
+  801038:	56                   	push   %esi
+  801039:	53                   	push   %ebx
+  80103a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80103d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801042:	8b 55 08             	mov    0x8(%ebp),%edx
+  801045:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801048:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80104d:	89 df                	mov    %ebx,%edi
+  80104f:	89 de                	mov    %ebx,%esi
+  801051:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801053:	85 c0                	test   %eax,%eax
+  801055:	7f 08                	jg     80105f <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801057:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80105a:	5b                   	pop    %ebx
+  80105b:	5e                   	pop    %esi
+  80105c:	5f                   	pop    %edi
+  80105d:	5d                   	pop    %ebp
+  80105e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105f:	83 ec 0c             	sub    $0xc,%esp
+  801062:	50                   	push   %eax
+  801063:	6a 0a                	push   $0xa
+  801065:	68 cb 50 80 00       	push   $0x8050cb
+  80106a:	6a 23                	push   $0x23
+  80106c:	68 e8 50 80 00       	push   $0x8050e8
+  801071:	e8 a3 f0 ff ff       	call   800119 <_panic>
+
+00801076 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801076:	55                   	push   %ebp
+  801077:	89 e5                	mov    %esp,%ebp
+  801079:	57                   	push   %edi
+  80107a:	56                   	push   %esi
+  80107b:	53                   	push   %ebx
+  80107c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  80107f:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801085:	76 1d                	jbe    8010a4 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  801087:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801092:	be 01 00 00 00       	mov    $0x1,%esi
+  801097:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80109a:	cd 30                	int    $0x30
+}
+  80109c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109f:	5b                   	pop    %ebx
+  8010a0:	5e                   	pop    %esi
+  8010a1:	5f                   	pop    %edi
+  8010a2:	5d                   	pop    %ebp
+  8010a3:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8010a4:	68 00 10 00 00       	push   $0x1000
+  8010a9:	53                   	push   %ebx
+  8010aa:	e8 2c fb ff ff       	call   800bdb <touch_mem>
+  8010af:	83 c4 08             	add    $0x8,%esp
+  8010b2:	eb d3                	jmp    801087 <sys_ipc_send+0x11>
+
+008010b4 <sys_ipc_send_pages>:
+{
+  8010b4:	55                   	push   %ebp
+  8010b5:	89 e5                	mov    %esp,%ebp
+  8010b7:	57                   	push   %edi
+  8010b8:	56                   	push   %esi
+  8010b9:	53                   	push   %ebx
+  8010ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010bd:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8010c0:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010c6:	76 18                	jbe    8010e0 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8010c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ce:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010d3:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8010d6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8010d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010db:	5b                   	pop    %ebx
+  8010dc:	5e                   	pop    %esi
+  8010dd:	5f                   	pop    %edi
+  8010de:	5d                   	pop    %ebp
+  8010df:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8010e0:	89 f0                	mov    %esi,%eax
+  8010e2:	c1 e0 0c             	shl    $0xc,%eax
+  8010e5:	50                   	push   %eax
+  8010e6:	53                   	push   %ebx
+  8010e7:	e8 ef fa ff ff       	call   800bdb <touch_mem>
+  8010ec:	83 c4 08             	add    $0x8,%esp
+  8010ef:	eb d7                	jmp    8010c8 <sys_ipc_send_pages+0x14>
+
+008010f1 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8010f1:	55                   	push   %ebp
+  8010f2:	89 e5                	mov    %esp,%ebp
+  8010f4:	57                   	push   %edi
+  8010f5:	56                   	push   %esi
+  8010f6:	53                   	push   %ebx
+  8010f7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801102:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801105:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80110a:	89 df                	mov    %ebx,%edi
+  80110c:	89 de                	mov    %ebx,%esi
+  80110e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801110:	85 c0                	test   %eax,%eax
+  801112:	7f 08                	jg     80111c <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801114:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801117:	5b                   	pop    %ebx
+  801118:	5e                   	pop    %esi
+  801119:	5f                   	pop    %edi
+  80111a:	5d                   	pop    %ebp
+  80111b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80111c:	83 ec 0c             	sub    $0xc,%esp
+  80111f:	50                   	push   %eax
+  801120:	6a 0d                	push   $0xd
+  801122:	68 cb 50 80 00       	push   $0x8050cb
+  801127:	6a 23                	push   $0x23
+  801129:	68 e8 50 80 00       	push   $0x8050e8
+  80112e:	e8 e6 ef ff ff       	call   800119 <_panic>
+
+00801133 <sys_ipc_recv>:
+{
+  801133:	55                   	push   %ebp
+  801134:	89 e5                	mov    %esp,%ebp
+  801136:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801139:	6a 01                	push   $0x1
+  80113b:	ff 75 08             	push   0x8(%ebp)
+  80113e:	e8 ae ff ff ff       	call   8010f1 <sys_ipc_recv_pages>
+}
+  801143:	c9                   	leave
+  801144:	c3                   	ret
+
+00801145 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801145:	55                   	push   %ebp
+  801146:	89 e5                	mov    %esp,%ebp
+  801148:	57                   	push   %edi
+  801149:	56                   	push   %esi
+  80114a:	53                   	push   %ebx
+  80114b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80114e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801151:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801154:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80115a:	77 04                	ja     801160 <sys_ipc_call+0x1b>
+  80115c:	85 f6                	test   %esi,%esi
+  80115e:	75 15                	jne    801175 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801160:	8b 55 08             	mov    0x8(%ebp),%edx
+  801163:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801166:	b8 14 00 00 00       	mov    $0x14,%eax
+  80116b:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80116d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801170:	5b                   	pop    %ebx
+  801171:	5e                   	pop    %esi
+  801172:	5f                   	pop    %edi
+  801173:	5d                   	pop    %ebp
+  801174:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  801175:	89 f8                	mov    %edi,%eax
+  801177:	c1 e0 0c             	shl    $0xc,%eax
+  80117a:	50                   	push   %eax
+  80117b:	53                   	push   %ebx
+  80117c:	e8 5a fa ff ff       	call   800bdb <touch_mem>
+  801181:	83 c4 08             	add    $0x8,%esp
+  801184:	eb da                	jmp    801160 <sys_ipc_call+0x1b>
+
+00801186 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801186:	55                   	push   %ebp
+  801187:	89 e5                	mov    %esp,%ebp
+  801189:	57                   	push   %edi
+  80118a:	56                   	push   %esi
+  80118b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80118c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801192:	b8 15 00 00 00       	mov    $0x15,%eax
+  801197:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80119a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80119d:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011a0:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8011a2:	5b                   	pop    %ebx
+  8011a3:	5e                   	pop    %esi
+  8011a4:	5f                   	pop    %edi
+  8011a5:	5d                   	pop    %ebp
+  8011a6:	c3                   	ret
+
+008011a7 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8011a7:	55                   	push   %ebp
+  8011a8:	89 e5                	mov    %esp,%ebp
+  8011aa:	57                   	push   %edi
+  8011ab:	56                   	push   %esi
+  8011ac:	53                   	push   %ebx
+  8011ad:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8011b0:	6a 04                	push   $0x4
+  8011b2:	ff 75 08             	push   0x8(%ebp)
+  8011b5:	e8 21 fa ff ff       	call   800bdb <touch_mem>
+	asm volatile("int %1\n"
+  8011ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8011bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c2:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011cd:	89 f7                	mov    %esi,%edi
+  8011cf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011d1:	83 c4 08             	add    $0x8,%esp
+  8011d4:	85 c0                	test   %eax,%eax
+  8011d6:	7f 08                	jg     8011e0 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8011d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011db:	5b                   	pop    %ebx
+  8011dc:	5e                   	pop    %esi
+  8011dd:	5f                   	pop    %edi
+  8011de:	5d                   	pop    %ebp
+  8011df:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e0:	83 ec 0c             	sub    $0xc,%esp
+  8011e3:	50                   	push   %eax
+  8011e4:	6a 16                	push   $0x16
+  8011e6:	68 cb 50 80 00       	push   $0x8050cb
+  8011eb:	6a 23                	push   $0x23
+  8011ed:	68 e8 50 80 00       	push   $0x8050e8
+  8011f2:	e8 22 ef ff ff       	call   800119 <_panic>
+
+008011f7 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8011f7:	55                   	push   %ebp
+  8011f8:	89 e5                	mov    %esp,%ebp
+  8011fa:	57                   	push   %edi
+  8011fb:	56                   	push   %esi
+  8011fc:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8011fd:	6a 04                	push   $0x4
+  8011ff:	ff 75 08             	push   0x8(%ebp)
+  801202:	e8 d4 f9 ff ff       	call   800bdb <touch_mem>
+	asm volatile("int %1\n"
+  801207:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120f:	b8 17 00 00 00       	mov    $0x17,%eax
+  801214:	8b 55 08             	mov    0x8(%ebp),%edx
+  801217:	89 df                	mov    %ebx,%edi
+  801219:	89 de                	mov    %ebx,%esi
+  80121b:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80121d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801220:	5b                   	pop    %ebx
+  801221:	5e                   	pop    %esi
+  801222:	5f                   	pop    %edi
+  801223:	5d                   	pop    %ebp
+  801224:	c3                   	ret
+
+00801225 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  801225:	55                   	push   %ebp
+  801226:	89 e5                	mov    %esp,%ebp
+  801228:	57                   	push   %edi
+  801229:	56                   	push   %esi
+  80122a:	53                   	push   %ebx
+  80122b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80122e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801233:	8b 55 08             	mov    0x8(%ebp),%edx
+  801236:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80123b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801240:	89 df                	mov    %ebx,%edi
+  801242:	89 de                	mov    %ebx,%esi
+  801244:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801246:	85 c0                	test   %eax,%eax
+  801248:	7f 08                	jg     801252 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80124a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124d:	5b                   	pop    %ebx
+  80124e:	5e                   	pop    %esi
+  80124f:	5f                   	pop    %edi
+  801250:	5d                   	pop    %ebp
+  801251:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801252:	83 ec 0c             	sub    $0xc,%esp
+  801255:	50                   	push   %eax
+  801256:	6a 0e                	push   $0xe
+  801258:	68 cb 50 80 00       	push   $0x8050cb
+  80125d:	6a 23                	push   $0x23
+  80125f:	68 e8 50 80 00       	push   $0x8050e8
+  801264:	e8 b0 ee ff ff       	call   800119 <_panic>
+
+00801269 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  801269:	55                   	push   %ebp
+  80126a:	89 e5                	mov    %esp,%ebp
+  80126c:	56                   	push   %esi
+  80126d:	53                   	push   %ebx
+  80126e:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  801271:	a1 00 70 80 00       	mov    0x807000,%eax
+  801276:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  801279:	85 db                	test   %ebx,%ebx
+  80127b:	78 17                	js     801294 <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  80127d:	83 ec 0c             	sub    $0xc,%esp
+  801280:	56                   	push   %esi
+  801281:	ff 14 9d 20 e9 80 00 	call   *0x80e920(,%ebx,4)
+  801288:	83 c4 10             	add    $0x10,%esp
+  80128b:	85 c0                	test   %eax,%eax
+  80128d:	75 27                	jne    8012b6 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  80128f:	83 eb 01             	sub    $0x1,%ebx
+  801292:	eb e5                	jmp    801279 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  801294:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  801299:	8b 40 48             	mov    0x48(%eax),%eax
+  80129c:	83 ec 08             	sub    $0x8,%esp
+  80129f:	ff 76 28             	push   0x28(%esi)
+  8012a2:	ff 36                	push   (%esi)
+  8012a4:	50                   	push   %eax
+  8012a5:	68 f8 50 80 00       	push   $0x8050f8
+  8012aa:	6a 1d                	push   $0x1d
+  8012ac:	68 1b 51 80 00       	push   $0x80511b
+  8012b1:	e8 63 ee ff ff       	call   800119 <_panic>
+}
+  8012b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012b9:	5b                   	pop    %ebx
+  8012ba:	5e                   	pop    %esi
+  8012bb:	5d                   	pop    %ebp
+  8012bc:	c3                   	ret
+
+008012bd <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8012bd:	55                   	push   %ebp
+  8012be:	89 e5                	mov    %esp,%ebp
+  8012c0:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  8012c3:	83 3d 48 e9 80 00 00 	cmpl   $0x0,0x80e948
+  8012ca:	74 0a                	je     8012d6 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8012cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012cf:	a3 48 e9 80 00       	mov    %eax,0x80e948
+}
+  8012d4:	c9                   	leave
+  8012d5:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  8012d6:	83 ec 04             	sub    $0x4,%esp
+  8012d9:	6a 07                	push   $0x7
+  8012db:	68 00 f0 bf ee       	push   $0xeebff000
+  8012e0:	6a 00                	push   $0x0
+  8012e2:	e8 e7 f9 ff ff       	call   800cce <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8012e7:	83 c4 08             	add    $0x8,%esp
+  8012ea:	68 5d 13 80 00       	push   $0x80135d
+  8012ef:	6a 00                	push   $0x0
+  8012f1:	e8 3e fd ff ff       	call   801034 <sys_env_set_pgfault_upcall>
+  8012f6:	83 c4 10             	add    $0x10,%esp
+  8012f9:	eb d1                	jmp    8012cc <set_pgfault_handler+0xf>
+
+008012fb <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  8012fb:	55                   	push   %ebp
+  8012fc:	89 e5                	mov    %esp,%ebp
+  8012fe:	83 ec 08             	sub    $0x8,%esp
+  801301:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  801304:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  80130a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80130f:	eb 03                	jmp    801314 <add_pgfault_handler+0x19>
+  801311:	83 c0 01             	add    $0x1,%eax
+  801314:	39 d0                	cmp    %edx,%eax
+  801316:	74 0b                	je     801323 <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  801318:	39 0c 85 20 e9 80 00 	cmp    %ecx,0x80e920(,%eax,4)
+  80131f:	75 f0                	jne    801311 <add_pgfault_handler+0x16>
+  801321:	eb 24                	jmp    801347 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  801323:	83 fa 0a             	cmp    $0xa,%edx
+  801326:	74 21                	je     801349 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  801328:	8d 42 01             	lea    0x1(%edx),%eax
+  80132b:	a3 00 70 80 00       	mov    %eax,0x807000
+  801330:	89 0c 95 20 e9 80 00 	mov    %ecx,0x80e920(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  801337:	83 ec 0c             	sub    $0xc,%esp
+  80133a:	68 69 12 80 00       	push   $0x801269
+  80133f:	e8 79 ff ff ff       	call   8012bd <set_pgfault_handler>
+  801344:	83 c4 10             	add    $0x10,%esp
+}
+  801347:	c9                   	leave
+  801348:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  801349:	83 ec 04             	sub    $0x4,%esp
+  80134c:	68 29 51 80 00       	push   $0x805129
+  801351:	6a 44                	push   $0x44
+  801353:	68 1b 51 80 00       	push   $0x80511b
+  801358:	e8 bc ed ff ff       	call   800119 <_panic>
+
+0080135d <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80135d:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80135e:	a1 48 e9 80 00       	mov    0x80e948,%eax
+	call *%eax
+  801363:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  801365:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  801368:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  80136c:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  801370:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  801373:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  801375:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  801379:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  80137c:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  80137d:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  801380:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  801381:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  801382:	c3                   	ret
+
+00801383 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801383:	55                   	push   %ebp
+  801384:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801386:	8b 45 08             	mov    0x8(%ebp),%eax
+  801389:	05 00 00 00 30       	add    $0x30000000,%eax
+  80138e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801391:	5d                   	pop    %ebp
+  801392:	c3                   	ret
+
+00801393 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801393:	55                   	push   %ebp
+  801394:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801396:	8b 45 08             	mov    0x8(%ebp),%eax
+  801399:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80139e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8013a3:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013a8:	5d                   	pop    %ebp
+  8013a9:	c3                   	ret
+
+008013aa <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013aa:	55                   	push   %ebp
+  8013ab:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8013ad:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8013b2:	a8 01                	test   $0x1,%al
+  8013b4:	74 3c                	je     8013f2 <fd_alloc+0x48>
+  8013b6:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013bb:	89 c2                	mov    %eax,%edx
+  8013bd:	c1 ea 0c             	shr    $0xc,%edx
+  8013c0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013c7:	89 c1                	mov    %eax,%ecx
+  8013c9:	05 00 10 00 00       	add    $0x1000,%eax
+  8013ce:	f6 c2 01             	test   $0x1,%dl
+  8013d1:	74 13                	je     8013e6 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8013d3:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8013d8:	75 e1                	jne    8013bb <fd_alloc+0x11>
+  8013da:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8013df:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8013e4:	eb 05                	jmp    8013eb <fd_alloc+0x41>
+			return 0;
+  8013e6:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8013eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ee:	89 0a                	mov    %ecx,(%edx)
+}
+  8013f0:	5d                   	pop    %ebp
+  8013f1:	c3                   	ret
+  8013f2:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8013f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013fc:	eb ed                	jmp    8013eb <fd_alloc+0x41>
+
+008013fe <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013fe:	55                   	push   %ebp
+  8013ff:	89 e5                	mov    %esp,%ebp
+  801401:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801404:	83 f8 1f             	cmp    $0x1f,%eax
+  801407:	77 30                	ja     801439 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801409:	c1 e0 0c             	shl    $0xc,%eax
+  80140c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801411:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801417:	f6 c2 01             	test   $0x1,%dl
+  80141a:	74 24                	je     801440 <fd_lookup+0x42>
+  80141c:	89 c2                	mov    %eax,%edx
+  80141e:	c1 ea 0c             	shr    $0xc,%edx
+  801421:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801428:	f6 c2 01             	test   $0x1,%dl
+  80142b:	74 1a                	je     801447 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80142d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801430:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801432:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801437:	5d                   	pop    %ebp
+  801438:	c3                   	ret
+		return -E_INVAL;
+  801439:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80143e:	eb f7                	jmp    801437 <fd_lookup+0x39>
+		return -E_INVAL;
+  801440:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801445:	eb f0                	jmp    801437 <fd_lookup+0x39>
+  801447:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80144c:	eb e9                	jmp    801437 <fd_lookup+0x39>
+
+0080144e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80144e:	55                   	push   %ebp
+  80144f:	89 e5                	mov    %esp,%ebp
+  801451:	53                   	push   %ebx
+  801452:	83 ec 04             	sub    $0x4,%esp
+  801455:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801458:	b8 c0 51 80 00       	mov    $0x8051c0,%eax
+  80145d:	8b 18                	mov    (%eax),%ebx
+  80145f:	85 db                	test   %ebx,%ebx
+  801461:	74 0e                	je     801471 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801463:	83 c0 04             	add    $0x4,%eax
+  801466:	39 13                	cmp    %edx,(%ebx)
+  801468:	75 f3                	jne    80145d <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  80146a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146f:	eb 1f                	jmp    801490 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801471:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  801476:	8b 40 48             	mov    0x48(%eax),%eax
+  801479:	83 ec 04             	sub    $0x4,%esp
+  80147c:	52                   	push   %edx
+  80147d:	50                   	push   %eax
+  80147e:	68 44 51 80 00       	push   $0x805144
+  801483:	e8 6c ed ff ff       	call   8001f4 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801488:	83 c4 10             	add    $0x10,%esp
+  80148b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801490:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801493:	89 1a                	mov    %ebx,(%edx)
+}
+  801495:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801498:	c9                   	leave
+  801499:	c3                   	ret
+
+0080149a <fd_close>:
+{
+  80149a:	55                   	push   %ebp
+  80149b:	89 e5                	mov    %esp,%ebp
+  80149d:	57                   	push   %edi
+  80149e:	56                   	push   %esi
+  80149f:	53                   	push   %ebx
+  8014a0:	83 ec 24             	sub    $0x24,%esp
+  8014a3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014a6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014a9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014ac:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014ad:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014b3:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014b6:	50                   	push   %eax
+  8014b7:	e8 42 ff ff ff       	call   8013fe <fd_lookup>
+  8014bc:	89 c3                	mov    %eax,%ebx
+  8014be:	83 c4 10             	add    $0x10,%esp
+  8014c1:	85 c0                	test   %eax,%eax
+  8014c3:	78 05                	js     8014ca <fd_close+0x30>
+	    || fd != fd2)
+  8014c5:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8014c8:	74 16                	je     8014e0 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8014ca:	89 f8                	mov    %edi,%eax
+  8014cc:	84 c0                	test   %al,%al
+  8014ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d3:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014d6:	89 d8                	mov    %ebx,%eax
+  8014d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014db:	5b                   	pop    %ebx
+  8014dc:	5e                   	pop    %esi
+  8014dd:	5f                   	pop    %edi
+  8014de:	5d                   	pop    %ebp
+  8014df:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014e0:	83 ec 08             	sub    $0x8,%esp
+  8014e3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014e6:	50                   	push   %eax
+  8014e7:	ff 36                	push   (%esi)
+  8014e9:	e8 60 ff ff ff       	call   80144e <dev_lookup>
+  8014ee:	89 c3                	mov    %eax,%ebx
+  8014f0:	83 c4 10             	add    $0x10,%esp
+  8014f3:	85 c0                	test   %eax,%eax
+  8014f5:	78 1a                	js     801511 <fd_close+0x77>
+		if (dev->dev_close)
+  8014f7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014fa:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8014fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801502:	85 c0                	test   %eax,%eax
+  801504:	74 0b                	je     801511 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801506:	83 ec 0c             	sub    $0xc,%esp
+  801509:	56                   	push   %esi
+  80150a:	ff d0                	call   *%eax
+  80150c:	89 c3                	mov    %eax,%ebx
+  80150e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801511:	83 ec 08             	sub    $0x8,%esp
+  801514:	56                   	push   %esi
+  801515:	6a 00                	push   $0x0
+  801517:	e8 37 f8 ff ff       	call   800d53 <sys_page_unmap>
+	return r;
+  80151c:	83 c4 10             	add    $0x10,%esp
+  80151f:	eb b5                	jmp    8014d6 <fd_close+0x3c>
+
+00801521 <close>:
+
+int
+close(int fdnum)
+{
+  801521:	55                   	push   %ebp
+  801522:	89 e5                	mov    %esp,%ebp
+  801524:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801527:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80152a:	50                   	push   %eax
+  80152b:	ff 75 08             	push   0x8(%ebp)
+  80152e:	e8 cb fe ff ff       	call   8013fe <fd_lookup>
+  801533:	83 c4 10             	add    $0x10,%esp
+  801536:	85 c0                	test   %eax,%eax
+  801538:	79 02                	jns    80153c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80153a:	c9                   	leave
+  80153b:	c3                   	ret
+		return fd_close(fd, 1);
+  80153c:	83 ec 08             	sub    $0x8,%esp
+  80153f:	6a 01                	push   $0x1
+  801541:	ff 75 f4             	push   -0xc(%ebp)
+  801544:	e8 51 ff ff ff       	call   80149a <fd_close>
+  801549:	83 c4 10             	add    $0x10,%esp
+  80154c:	eb ec                	jmp    80153a <close+0x19>
+
+0080154e <close_all>:
+
+void
+close_all(void)
+{
+  80154e:	55                   	push   %ebp
+  80154f:	89 e5                	mov    %esp,%ebp
+  801551:	53                   	push   %ebx
+  801552:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801555:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80155a:	83 ec 0c             	sub    $0xc,%esp
+  80155d:	53                   	push   %ebx
+  80155e:	e8 be ff ff ff       	call   801521 <close>
+	for (i = 0; i < MAXFD; i++)
+  801563:	83 c3 01             	add    $0x1,%ebx
+  801566:	83 c4 10             	add    $0x10,%esp
+  801569:	83 fb 20             	cmp    $0x20,%ebx
+  80156c:	75 ec                	jne    80155a <close_all+0xc>
+}
+  80156e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801571:	c9                   	leave
+  801572:	c3                   	ret
+
+00801573 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801573:	55                   	push   %ebp
+  801574:	89 e5                	mov    %esp,%ebp
+  801576:	57                   	push   %edi
+  801577:	56                   	push   %esi
+  801578:	53                   	push   %ebx
+  801579:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80157c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80157f:	50                   	push   %eax
+  801580:	ff 75 08             	push   0x8(%ebp)
+  801583:	e8 76 fe ff ff       	call   8013fe <fd_lookup>
+  801588:	89 c3                	mov    %eax,%ebx
+  80158a:	83 c4 10             	add    $0x10,%esp
+  80158d:	85 c0                	test   %eax,%eax
+  80158f:	78 7f                	js     801610 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801591:	83 ec 0c             	sub    $0xc,%esp
+  801594:	ff 75 0c             	push   0xc(%ebp)
+  801597:	e8 85 ff ff ff       	call   801521 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80159c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80159f:	c1 e6 0c             	shl    $0xc,%esi
+  8015a2:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8015a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015ab:	89 3c 24             	mov    %edi,(%esp)
+  8015ae:	e8 e0 fd ff ff       	call   801393 <fd2data>
+  8015b3:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8015b5:	89 34 24             	mov    %esi,(%esp)
+  8015b8:	e8 d6 fd ff ff       	call   801393 <fd2data>
+  8015bd:	83 c4 10             	add    $0x10,%esp
+  8015c0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8015c3:	89 d8                	mov    %ebx,%eax
+  8015c5:	c1 e8 16             	shr    $0x16,%eax
+  8015c8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015cf:	a8 01                	test   $0x1,%al
+  8015d1:	74 11                	je     8015e4 <dup+0x71>
+  8015d3:	89 d8                	mov    %ebx,%eax
+  8015d5:	c1 e8 0c             	shr    $0xc,%eax
+  8015d8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015df:	f6 c2 01             	test   $0x1,%dl
+  8015e2:	75 36                	jne    80161a <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015e4:	89 f8                	mov    %edi,%eax
+  8015e6:	c1 e8 0c             	shr    $0xc,%eax
+  8015e9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015f0:	83 ec 0c             	sub    $0xc,%esp
+  8015f3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015f8:	50                   	push   %eax
+  8015f9:	56                   	push   %esi
+  8015fa:	6a 00                	push   $0x0
+  8015fc:	57                   	push   %edi
+  8015fd:	6a 00                	push   $0x0
+  8015ff:	e8 0d f7 ff ff       	call   800d11 <sys_page_map>
+  801604:	89 c3                	mov    %eax,%ebx
+  801606:	83 c4 20             	add    $0x20,%esp
+  801609:	85 c0                	test   %eax,%eax
+  80160b:	78 33                	js     801640 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80160d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801610:	89 d8                	mov    %ebx,%eax
+  801612:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801615:	5b                   	pop    %ebx
+  801616:	5e                   	pop    %esi
+  801617:	5f                   	pop    %edi
+  801618:	5d                   	pop    %ebp
+  801619:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80161a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801621:	83 ec 0c             	sub    $0xc,%esp
+  801624:	25 07 0e 00 00       	and    $0xe07,%eax
+  801629:	50                   	push   %eax
+  80162a:	ff 75 d4             	push   -0x2c(%ebp)
+  80162d:	6a 00                	push   $0x0
+  80162f:	53                   	push   %ebx
+  801630:	6a 00                	push   $0x0
+  801632:	e8 da f6 ff ff       	call   800d11 <sys_page_map>
+  801637:	89 c3                	mov    %eax,%ebx
+  801639:	83 c4 20             	add    $0x20,%esp
+  80163c:	85 c0                	test   %eax,%eax
+  80163e:	79 a4                	jns    8015e4 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801640:	83 ec 08             	sub    $0x8,%esp
+  801643:	56                   	push   %esi
+  801644:	6a 00                	push   $0x0
+  801646:	e8 08 f7 ff ff       	call   800d53 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80164b:	83 c4 08             	add    $0x8,%esp
+  80164e:	ff 75 d4             	push   -0x2c(%ebp)
+  801651:	6a 00                	push   $0x0
+  801653:	e8 fb f6 ff ff       	call   800d53 <sys_page_unmap>
+	return r;
+  801658:	83 c4 10             	add    $0x10,%esp
+  80165b:	eb b3                	jmp    801610 <dup+0x9d>
+
+0080165d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80165d:	55                   	push   %ebp
+  80165e:	89 e5                	mov    %esp,%ebp
+  801660:	56                   	push   %esi
+  801661:	53                   	push   %ebx
+  801662:	83 ec 18             	sub    $0x18,%esp
+  801665:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801668:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80166b:	50                   	push   %eax
+  80166c:	56                   	push   %esi
+  80166d:	e8 8c fd ff ff       	call   8013fe <fd_lookup>
+  801672:	83 c4 10             	add    $0x10,%esp
+  801675:	85 c0                	test   %eax,%eax
+  801677:	78 3c                	js     8016b5 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801679:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80167c:	83 ec 08             	sub    $0x8,%esp
+  80167f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801682:	50                   	push   %eax
+  801683:	ff 33                	push   (%ebx)
+  801685:	e8 c4 fd ff ff       	call   80144e <dev_lookup>
+  80168a:	83 c4 10             	add    $0x10,%esp
+  80168d:	85 c0                	test   %eax,%eax
+  80168f:	78 24                	js     8016b5 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801691:	8b 43 08             	mov    0x8(%ebx),%eax
+  801694:	83 e0 03             	and    $0x3,%eax
+  801697:	83 f8 01             	cmp    $0x1,%eax
+  80169a:	74 20                	je     8016bc <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80169c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80169f:	8b 40 08             	mov    0x8(%eax),%eax
+  8016a2:	85 c0                	test   %eax,%eax
+  8016a4:	74 37                	je     8016dd <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8016a6:	83 ec 04             	sub    $0x4,%esp
+  8016a9:	ff 75 10             	push   0x10(%ebp)
+  8016ac:	ff 75 0c             	push   0xc(%ebp)
+  8016af:	53                   	push   %ebx
+  8016b0:	ff d0                	call   *%eax
+  8016b2:	83 c4 10             	add    $0x10,%esp
+}
+  8016b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016b8:	5b                   	pop    %ebx
+  8016b9:	5e                   	pop    %esi
+  8016ba:	5d                   	pop    %ebp
+  8016bb:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016bc:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8016c1:	8b 40 48             	mov    0x48(%eax),%eax
+  8016c4:	83 ec 04             	sub    $0x4,%esp
+  8016c7:	56                   	push   %esi
+  8016c8:	50                   	push   %eax
+  8016c9:	68 85 51 80 00       	push   $0x805185
+  8016ce:	e8 21 eb ff ff       	call   8001f4 <cprintf>
+		return -E_INVAL;
+  8016d3:	83 c4 10             	add    $0x10,%esp
+  8016d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016db:	eb d8                	jmp    8016b5 <read+0x58>
+		return -E_NOT_SUPP;
+  8016dd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016e2:	eb d1                	jmp    8016b5 <read+0x58>
+
+008016e4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016e4:	55                   	push   %ebp
+  8016e5:	89 e5                	mov    %esp,%ebp
+  8016e7:	57                   	push   %edi
+  8016e8:	56                   	push   %esi
+  8016e9:	53                   	push   %ebx
+  8016ea:	83 ec 0c             	sub    $0xc,%esp
+  8016ed:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016f0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f8:	eb 02                	jmp    8016fc <readn+0x18>
+  8016fa:	01 c3                	add    %eax,%ebx
+  8016fc:	39 f3                	cmp    %esi,%ebx
+  8016fe:	73 21                	jae    801721 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801700:	83 ec 04             	sub    $0x4,%esp
+  801703:	89 f0                	mov    %esi,%eax
+  801705:	29 d8                	sub    %ebx,%eax
+  801707:	50                   	push   %eax
+  801708:	89 d8                	mov    %ebx,%eax
+  80170a:	03 45 0c             	add    0xc(%ebp),%eax
+  80170d:	50                   	push   %eax
+  80170e:	57                   	push   %edi
+  80170f:	e8 49 ff ff ff       	call   80165d <read>
+		if (m < 0)
+  801714:	83 c4 10             	add    $0x10,%esp
+  801717:	85 c0                	test   %eax,%eax
+  801719:	78 04                	js     80171f <readn+0x3b>
+			return m;
+		if (m == 0)
+  80171b:	75 dd                	jne    8016fa <readn+0x16>
+  80171d:	eb 02                	jmp    801721 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80171f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801721:	89 d8                	mov    %ebx,%eax
+  801723:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801726:	5b                   	pop    %ebx
+  801727:	5e                   	pop    %esi
+  801728:	5f                   	pop    %edi
+  801729:	5d                   	pop    %ebp
+  80172a:	c3                   	ret
+
+0080172b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80172b:	55                   	push   %ebp
+  80172c:	89 e5                	mov    %esp,%ebp
+  80172e:	56                   	push   %esi
+  80172f:	53                   	push   %ebx
+  801730:	83 ec 18             	sub    $0x18,%esp
+  801733:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801736:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801739:	50                   	push   %eax
+  80173a:	53                   	push   %ebx
+  80173b:	e8 be fc ff ff       	call   8013fe <fd_lookup>
+  801740:	83 c4 10             	add    $0x10,%esp
+  801743:	85 c0                	test   %eax,%eax
+  801745:	78 37                	js     80177e <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801747:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80174a:	83 ec 08             	sub    $0x8,%esp
+  80174d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801750:	50                   	push   %eax
+  801751:	ff 36                	push   (%esi)
+  801753:	e8 f6 fc ff ff       	call   80144e <dev_lookup>
+  801758:	83 c4 10             	add    $0x10,%esp
+  80175b:	85 c0                	test   %eax,%eax
+  80175d:	78 1f                	js     80177e <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80175f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801763:	74 20                	je     801785 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801765:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801768:	8b 40 0c             	mov    0xc(%eax),%eax
+  80176b:	85 c0                	test   %eax,%eax
+  80176d:	74 37                	je     8017a6 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80176f:	83 ec 04             	sub    $0x4,%esp
+  801772:	ff 75 10             	push   0x10(%ebp)
+  801775:	ff 75 0c             	push   0xc(%ebp)
+  801778:	56                   	push   %esi
+  801779:	ff d0                	call   *%eax
+  80177b:	83 c4 10             	add    $0x10,%esp
+}
+  80177e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801781:	5b                   	pop    %ebx
+  801782:	5e                   	pop    %esi
+  801783:	5d                   	pop    %ebp
+  801784:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801785:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  80178a:	8b 40 48             	mov    0x48(%eax),%eax
+  80178d:	83 ec 04             	sub    $0x4,%esp
+  801790:	53                   	push   %ebx
+  801791:	50                   	push   %eax
+  801792:	68 a1 51 80 00       	push   $0x8051a1
+  801797:	e8 58 ea ff ff       	call   8001f4 <cprintf>
+		return -E_INVAL;
+  80179c:	83 c4 10             	add    $0x10,%esp
+  80179f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a4:	eb d8                	jmp    80177e <write+0x53>
+		return -E_NOT_SUPP;
+  8017a6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017ab:	eb d1                	jmp    80177e <write+0x53>
+
+008017ad <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017ad:	55                   	push   %ebp
+  8017ae:	89 e5                	mov    %esp,%ebp
+  8017b0:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b6:	50                   	push   %eax
+  8017b7:	ff 75 08             	push   0x8(%ebp)
+  8017ba:	e8 3f fc ff ff       	call   8013fe <fd_lookup>
+  8017bf:	83 c4 10             	add    $0x10,%esp
+  8017c2:	85 c0                	test   %eax,%eax
+  8017c4:	78 0e                	js     8017d4 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8017c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017cc:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8017cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017d4:	c9                   	leave
+  8017d5:	c3                   	ret
+
+008017d6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017d6:	55                   	push   %ebp
+  8017d7:	89 e5                	mov    %esp,%ebp
+  8017d9:	56                   	push   %esi
+  8017da:	53                   	push   %ebx
+  8017db:	83 ec 18             	sub    $0x18,%esp
+  8017de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017e1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017e4:	50                   	push   %eax
+  8017e5:	53                   	push   %ebx
+  8017e6:	e8 13 fc ff ff       	call   8013fe <fd_lookup>
+  8017eb:	83 c4 10             	add    $0x10,%esp
+  8017ee:	85 c0                	test   %eax,%eax
+  8017f0:	78 34                	js     801826 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017f2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017f5:	83 ec 08             	sub    $0x8,%esp
+  8017f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017fb:	50                   	push   %eax
+  8017fc:	ff 36                	push   (%esi)
+  8017fe:	e8 4b fc ff ff       	call   80144e <dev_lookup>
+  801803:	83 c4 10             	add    $0x10,%esp
+  801806:	85 c0                	test   %eax,%eax
+  801808:	78 1c                	js     801826 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80180a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80180e:	74 1d                	je     80182d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801810:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801813:	8b 40 18             	mov    0x18(%eax),%eax
+  801816:	85 c0                	test   %eax,%eax
+  801818:	74 34                	je     80184e <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80181a:	83 ec 08             	sub    $0x8,%esp
+  80181d:	ff 75 0c             	push   0xc(%ebp)
+  801820:	56                   	push   %esi
+  801821:	ff d0                	call   *%eax
+  801823:	83 c4 10             	add    $0x10,%esp
+}
+  801826:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801829:	5b                   	pop    %ebx
+  80182a:	5e                   	pop    %esi
+  80182b:	5d                   	pop    %ebp
+  80182c:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80182d:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  801832:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801835:	83 ec 04             	sub    $0x4,%esp
+  801838:	53                   	push   %ebx
+  801839:	50                   	push   %eax
+  80183a:	68 64 51 80 00       	push   $0x805164
+  80183f:	e8 b0 e9 ff ff       	call   8001f4 <cprintf>
+		return -E_INVAL;
+  801844:	83 c4 10             	add    $0x10,%esp
+  801847:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80184c:	eb d8                	jmp    801826 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80184e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801853:	eb d1                	jmp    801826 <ftruncate+0x50>
+
+00801855 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801855:	55                   	push   %ebp
+  801856:	89 e5                	mov    %esp,%ebp
+  801858:	56                   	push   %esi
+  801859:	53                   	push   %ebx
+  80185a:	83 ec 18             	sub    $0x18,%esp
+  80185d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801860:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801863:	50                   	push   %eax
+  801864:	ff 75 08             	push   0x8(%ebp)
+  801867:	e8 92 fb ff ff       	call   8013fe <fd_lookup>
+  80186c:	83 c4 10             	add    $0x10,%esp
+  80186f:	85 c0                	test   %eax,%eax
+  801871:	78 49                	js     8018bc <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801873:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801876:	83 ec 08             	sub    $0x8,%esp
+  801879:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80187c:	50                   	push   %eax
+  80187d:	ff 36                	push   (%esi)
+  80187f:	e8 ca fb ff ff       	call   80144e <dev_lookup>
+  801884:	83 c4 10             	add    $0x10,%esp
+  801887:	85 c0                	test   %eax,%eax
+  801889:	78 31                	js     8018bc <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80188b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80188e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801892:	74 2f                	je     8018c3 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801894:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801897:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80189e:	00 00 00 
+	stat->st_isdir = 0;
+  8018a1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018a8:	00 00 00 
+	stat->st_dev = dev;
+  8018ab:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8018b1:	83 ec 08             	sub    $0x8,%esp
+  8018b4:	53                   	push   %ebx
+  8018b5:	56                   	push   %esi
+  8018b6:	ff 50 14             	call   *0x14(%eax)
+  8018b9:	83 c4 10             	add    $0x10,%esp
+}
+  8018bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018bf:	5b                   	pop    %ebx
+  8018c0:	5e                   	pop    %esi
+  8018c1:	5d                   	pop    %ebp
+  8018c2:	c3                   	ret
+		return -E_NOT_SUPP;
+  8018c3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018c8:	eb f2                	jmp    8018bc <fstat+0x67>
+
+008018ca <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018ca:	55                   	push   %ebp
+  8018cb:	89 e5                	mov    %esp,%ebp
+  8018cd:	56                   	push   %esi
+  8018ce:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8018cf:	83 ec 08             	sub    $0x8,%esp
+  8018d2:	6a 00                	push   $0x0
+  8018d4:	ff 75 08             	push   0x8(%ebp)
+  8018d7:	e8 bc 02 00 00       	call   801b98 <open>
+  8018dc:	89 c3                	mov    %eax,%ebx
+  8018de:	83 c4 10             	add    $0x10,%esp
+  8018e1:	85 c0                	test   %eax,%eax
+  8018e3:	78 1b                	js     801900 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8018e5:	83 ec 08             	sub    $0x8,%esp
+  8018e8:	ff 75 0c             	push   0xc(%ebp)
+  8018eb:	50                   	push   %eax
+  8018ec:	e8 64 ff ff ff       	call   801855 <fstat>
+  8018f1:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8018f3:	89 1c 24             	mov    %ebx,(%esp)
+  8018f6:	e8 26 fc ff ff       	call   801521 <close>
+	return r;
+  8018fb:	83 c4 10             	add    $0x10,%esp
+  8018fe:	89 f3                	mov    %esi,%ebx
+}
+  801900:	89 d8                	mov    %ebx,%eax
+  801902:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801905:	5b                   	pop    %ebx
+  801906:	5e                   	pop    %esi
+  801907:	5d                   	pop    %ebp
+  801908:	c3                   	ret
+
+00801909 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801909:	55                   	push   %ebp
+  80190a:	89 e5                	mov    %esp,%ebp
+  80190c:	57                   	push   %edi
+  80190d:	56                   	push   %esi
+  80190e:	53                   	push   %ebx
+  80190f:	83 ec 0c             	sub    $0xc,%esp
+  801912:	89 c7                	mov    %eax,%edi
+  801914:	89 d3                	mov    %edx,%ebx
+  801916:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801918:	83 3d 04 70 80 00 00 	cmpl   $0x0,0x807004
+  80191f:	74 2d                	je     80194e <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801921:	6a 07                	push   $0x7
+  801923:	68 00 f0 80 00       	push   $0x80f000
+  801928:	57                   	push   %edi
+  801929:	ff 35 04 70 80 00    	push   0x807004
+  80192f:	e8 34 30 00 00       	call   804968 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801934:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80193b:	6a 00                	push   $0x0
+  80193d:	56                   	push   %esi
+  80193e:	53                   	push   %ebx
+  80193f:	6a 00                	push   $0x0
+  801941:	e8 d4 2e 00 00       	call   80481a <ipc_recv_pages>
+}
+  801946:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801949:	5b                   	pop    %ebx
+  80194a:	5e                   	pop    %esi
+  80194b:	5f                   	pop    %edi
+  80194c:	5d                   	pop    %ebp
+  80194d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80194e:	83 ec 0c             	sub    $0xc,%esp
+  801951:	6a 01                	push   $0x1
+  801953:	e8 05 31 00 00       	call   804a5d <ipc_find_env>
+  801958:	a3 04 70 80 00       	mov    %eax,0x807004
+  80195d:	83 c4 10             	add    $0x10,%esp
+  801960:	eb bf                	jmp    801921 <fsipc_pages+0x18>
+
+00801962 <fsipc>:
+{
+  801962:	55                   	push   %ebp
+  801963:	89 e5                	mov    %esp,%ebp
+  801965:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801968:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80196d:	e8 97 ff ff ff       	call   801909 <fsipc_pages>
+}
+  801972:	c9                   	leave
+  801973:	c3                   	ret
+
+00801974 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801974:	55                   	push   %ebp
+  801975:	89 e5                	mov    %esp,%ebp
+  801977:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80197a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80197d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801980:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  801985:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801988:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80198d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801992:	b8 02 00 00 00       	mov    $0x2,%eax
+  801997:	e8 c6 ff ff ff       	call   801962 <fsipc>
+}
+  80199c:	c9                   	leave
+  80199d:	c3                   	ret
+
+0080199e <devfile_flush>:
+{
+  80199e:	55                   	push   %ebp
+  80199f:	89 e5                	mov    %esp,%ebp
+  8019a1:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019aa:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8019af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019b9:	e8 a4 ff ff ff       	call   801962 <fsipc>
+}
+  8019be:	c9                   	leave
+  8019bf:	c3                   	ret
+
+008019c0 <devfile_stat>:
+{
+  8019c0:	55                   	push   %ebp
+  8019c1:	89 e5                	mov    %esp,%ebp
+  8019c3:	53                   	push   %ebx
+  8019c4:	83 ec 04             	sub    $0x4,%esp
+  8019c7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019cd:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019d0:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019da:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019df:	e8 7e ff ff ff       	call   801962 <fsipc>
+  8019e4:	85 c0                	test   %eax,%eax
+  8019e6:	78 2c                	js     801a14 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019e8:	83 ec 08             	sub    $0x8,%esp
+  8019eb:	68 00 f0 80 00       	push   $0x80f000
+  8019f0:	53                   	push   %ebx
+  8019f1:	e8 e5 ed ff ff       	call   8007db <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8019f6:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  8019fb:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a01:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  801a06:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801a0c:	83 c4 10             	add    $0x10,%esp
+  801a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a17:	c9                   	leave
+  801a18:	c3                   	ret
+
+00801a19 <devfile_write>:
+{
+  801a19:	55                   	push   %ebp
+  801a1a:	89 e5                	mov    %esp,%ebp
+  801a1c:	83 ec 0c             	sub    $0xc,%esp
+  801a1f:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801a22:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a27:	39 d0                	cmp    %edx,%eax
+  801a29:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a2f:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a32:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  801a38:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801a3d:	50                   	push   %eax
+  801a3e:	ff 75 0c             	push   0xc(%ebp)
+  801a41:	68 08 f0 80 00       	push   $0x80f008
+  801a46:	e8 16 ef ff ff       	call   800961 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801a4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a50:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a55:	e8 08 ff ff ff       	call   801962 <fsipc>
+}
+  801a5a:	c9                   	leave
+  801a5b:	c3                   	ret
+
+00801a5c <devfile_read>:
+{
+  801a5c:	55                   	push   %ebp
+  801a5d:	89 e5                	mov    %esp,%ebp
+  801a5f:	57                   	push   %edi
+  801a60:	56                   	push   %esi
+  801a61:	53                   	push   %ebx
+  801a62:	83 ec 1c             	sub    $0x1c,%esp
+  801a65:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a68:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a6b:	89 fe                	mov    %edi,%esi
+  801a6d:	c1 ee 0c             	shr    $0xc,%esi
+  801a70:	b8 20 00 00 00       	mov    $0x20,%eax
+  801a75:	39 c6                	cmp    %eax,%esi
+  801a77:	0f 47 f0             	cmova  %eax,%esi
+  801a7a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a82:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801a85:	eb 14                	jmp    801a9b <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a87:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801a8e:	05 00 10 00 00       	add    $0x1000,%eax
+  801a93:	f6 c6 06             	test   $0x6,%dh
+  801a96:	75 42                	jne    801ada <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a98:	83 c1 01             	add    $0x1,%ecx
+  801a9b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801a9e:	39 f1                	cmp    %esi,%ecx
+  801aa0:	0f 84 95 00 00 00    	je     801b3b <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801aa6:	89 c2                	mov    %eax,%edx
+  801aa8:	c1 ea 16             	shr    $0x16,%edx
+  801aab:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801ab2:	f6 c2 01             	test   $0x1,%dl
+  801ab5:	74 23                	je     801ada <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801ab7:	89 c2                	mov    %eax,%edx
+  801ab9:	c1 ea 0c             	shr    $0xc,%edx
+  801abc:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801ac3:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801ac9:	74 0f                	je     801ada <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801acb:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801ad2:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801ad8:	75 ad                	jne    801a87 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801ada:	85 c9                	test   %ecx,%ecx
+  801adc:	74 11                	je     801aef <devfile_read+0x93>
+  801ade:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801ae5:	75 08                	jne    801aef <devfile_read+0x93>
+  801ae7:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801aed:	74 50                	je     801b3f <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801aef:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801af2:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  801af7:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801afd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b02:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b07:	e8 56 fe ff ff       	call   801962 <fsipc>
+  801b0c:	89 c6                	mov    %eax,%esi
+  801b0e:	85 c0                	test   %eax,%eax
+  801b10:	78 1f                	js     801b31 <devfile_read+0xd5>
+	assert(r <= n);
+  801b12:	39 c7                	cmp    %eax,%edi
+  801b14:	72 50                	jb     801b66 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801b16:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b1b:	7f 62                	jg     801b7f <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801b1d:	83 ec 04             	sub    $0x4,%esp
+  801b20:	50                   	push   %eax
+  801b21:	68 00 f0 80 00       	push   $0x80f000
+  801b26:	ff 75 0c             	push   0xc(%ebp)
+  801b29:	e8 33 ee ff ff       	call   800961 <memmove>
+	return r;
+  801b2e:	83 c4 10             	add    $0x10,%esp
+}
+  801b31:	89 f0                	mov    %esi,%eax
+  801b33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b36:	5b                   	pop    %ebx
+  801b37:	5e                   	pop    %esi
+  801b38:	5f                   	pop    %edi
+  801b39:	5d                   	pop    %ebp
+  801b3a:	c3                   	ret
+  801b3b:	89 f1                	mov    %esi,%ecx
+  801b3d:	eb 9b                	jmp    801ada <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801b3f:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b42:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801b47:	89 c8                	mov    %ecx,%eax
+  801b49:	c1 e0 0c             	shl    $0xc,%eax
+  801b4c:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801b51:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b54:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801b59:	e8 ab fd ff ff       	call   801909 <fsipc_pages>
+  801b5e:	89 c6                	mov    %eax,%esi
+  801b60:	85 c0                	test   %eax,%eax
+  801b62:	78 8b                	js     801aef <devfile_read+0x93>
+  801b64:	eb cb                	jmp    801b31 <devfile_read+0xd5>
+	assert(r <= n);
+  801b66:	68 d0 51 80 00       	push   $0x8051d0
+  801b6b:	68 d7 51 80 00       	push   $0x8051d7
+  801b70:	68 a0 00 00 00       	push   $0xa0
+  801b75:	68 ec 51 80 00       	push   $0x8051ec
+  801b7a:	e8 9a e5 ff ff       	call   800119 <_panic>
+	assert(r <= PGSIZE);
+  801b7f:	68 f7 51 80 00       	push   $0x8051f7
+  801b84:	68 d7 51 80 00       	push   $0x8051d7
+  801b89:	68 a1 00 00 00       	push   $0xa1
+  801b8e:	68 ec 51 80 00       	push   $0x8051ec
+  801b93:	e8 81 e5 ff ff       	call   800119 <_panic>
+
+00801b98 <open>:
+{
+  801b98:	55                   	push   %ebp
+  801b99:	89 e5                	mov    %esp,%ebp
+  801b9b:	56                   	push   %esi
+  801b9c:	53                   	push   %ebx
+  801b9d:	83 ec 1c             	sub    $0x1c,%esp
+  801ba0:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801ba3:	56                   	push   %esi
+  801ba4:	e8 f7 eb ff ff       	call   8007a0 <strlen>
+  801ba9:	83 c4 10             	add    $0x10,%esp
+  801bac:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bb1:	7f 6c                	jg     801c1f <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801bb3:	83 ec 0c             	sub    $0xc,%esp
+  801bb6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bb9:	50                   	push   %eax
+  801bba:	e8 eb f7 ff ff       	call   8013aa <fd_alloc>
+  801bbf:	89 c3                	mov    %eax,%ebx
+  801bc1:	83 c4 10             	add    $0x10,%esp
+  801bc4:	85 c0                	test   %eax,%eax
+  801bc6:	78 3c                	js     801c04 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801bc8:	83 ec 08             	sub    $0x8,%esp
+  801bcb:	56                   	push   %esi
+  801bcc:	68 00 f0 80 00       	push   $0x80f000
+  801bd1:	e8 05 ec ff ff       	call   8007db <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801bd6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bd9:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bde:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801be1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801be6:	e8 77 fd ff ff       	call   801962 <fsipc>
+  801beb:	89 c3                	mov    %eax,%ebx
+  801bed:	83 c4 10             	add    $0x10,%esp
+  801bf0:	85 c0                	test   %eax,%eax
+  801bf2:	78 19                	js     801c0d <open+0x75>
+	return fd2num(fd);
+  801bf4:	83 ec 0c             	sub    $0xc,%esp
+  801bf7:	ff 75 f4             	push   -0xc(%ebp)
+  801bfa:	e8 84 f7 ff ff       	call   801383 <fd2num>
+  801bff:	89 c3                	mov    %eax,%ebx
+  801c01:	83 c4 10             	add    $0x10,%esp
+}
+  801c04:	89 d8                	mov    %ebx,%eax
+  801c06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c09:	5b                   	pop    %ebx
+  801c0a:	5e                   	pop    %esi
+  801c0b:	5d                   	pop    %ebp
+  801c0c:	c3                   	ret
+		fd_close(fd, 0);
+  801c0d:	83 ec 08             	sub    $0x8,%esp
+  801c10:	6a 00                	push   $0x0
+  801c12:	ff 75 f4             	push   -0xc(%ebp)
+  801c15:	e8 80 f8 ff ff       	call   80149a <fd_close>
+		return r;
+  801c1a:	83 c4 10             	add    $0x10,%esp
+  801c1d:	eb e5                	jmp    801c04 <open+0x6c>
+		return -E_BAD_PATH;
+  801c1f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c24:	eb de                	jmp    801c04 <open+0x6c>
+
+00801c26 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801c26:	55                   	push   %ebp
+  801c27:	89 e5                	mov    %esp,%ebp
+  801c29:	53                   	push   %ebx
+  801c2a:	83 ec 10             	sub    $0x10,%esp
+  801c2d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801c30:	53                   	push   %ebx
+  801c31:	e8 6a eb ff ff       	call   8007a0 <strlen>
+  801c36:	83 c4 10             	add    $0x10,%esp
+  801c39:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c3e:	7f 25                	jg     801c65 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801c40:	83 ec 08             	sub    $0x8,%esp
+  801c43:	53                   	push   %ebx
+  801c44:	68 00 f0 80 00       	push   $0x80f000
+  801c49:	e8 8d eb ff ff       	call   8007db <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801c4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c53:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c58:	e8 05 fd ff ff       	call   801962 <fsipc>
+  801c5d:	83 c4 10             	add    $0x10,%esp
+}
+  801c60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c63:	c9                   	leave
+  801c64:	c3                   	ret
+		return -E_BAD_PATH;
+  801c65:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801c6a:	eb f4                	jmp    801c60 <remove+0x3a>
+
+00801c6c <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c6c:	55                   	push   %ebp
+  801c6d:	89 e5                	mov    %esp,%ebp
+  801c6f:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c72:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c77:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c7c:	e8 e1 fc ff ff       	call   801962 <fsipc>
+}
+  801c81:	c9                   	leave
+  801c82:	c3                   	ret
+
+00801c83 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801c83:	55                   	push   %ebp
+  801c84:	89 e5                	mov    %esp,%ebp
+  801c86:	53                   	push   %ebx
+  801c87:	83 ec 04             	sub    $0x4,%esp
+  801c8a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801c8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c92:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c97:	e8 c6 fc ff ff       	call   801962 <fsipc>
+  801c9c:	85 c0                	test   %eax,%eax
+  801c9e:	78 3c                	js     801cdc <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801ca0:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  801ca5:	89 03                	mov    %eax,(%ebx)
+  801ca7:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  801cac:	89 43 04             	mov    %eax,0x4(%ebx)
+  801caf:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  801cb4:	89 43 08             	mov    %eax,0x8(%ebx)
+  801cb7:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  801cbc:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801cbf:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  801cc4:	89 43 10             	mov    %eax,0x10(%ebx)
+  801cc7:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  801ccc:	89 43 14             	mov    %eax,0x14(%ebx)
+  801ccf:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  801cd4:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cdc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cdf:	c9                   	leave
+  801ce0:	c3                   	ret
+
+00801ce1 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801ce1:	55                   	push   %ebp
+  801ce2:	89 e5                	mov    %esp,%ebp
+  801ce4:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801ce7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cea:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  801cef:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cf4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801cf9:	e8 64 fc ff ff       	call   801962 <fsipc>
+}
+  801cfe:	c9                   	leave
+  801cff:	c3                   	ret
+
+00801d00 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d00:	55                   	push   %ebp
+  801d01:	89 e5                	mov    %esp,%ebp
+  801d03:	56                   	push   %esi
+  801d04:	53                   	push   %ebx
+  801d05:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801d08:	83 ec 0c             	sub    $0xc,%esp
+  801d0b:	ff 75 08             	push   0x8(%ebp)
+  801d0e:	e8 80 f6 ff ff       	call   801393 <fd2data>
+  801d13:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801d15:	83 c4 08             	add    $0x8,%esp
+  801d18:	68 03 52 80 00       	push   $0x805203
+  801d1d:	53                   	push   %ebx
+  801d1e:	e8 b8 ea ff ff       	call   8007db <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801d23:	8b 46 04             	mov    0x4(%esi),%eax
+  801d26:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801d2c:	2b 0e                	sub    (%esi),%ecx
+  801d2e:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801d33:	89 c8                	mov    %ecx,%eax
+  801d35:	f7 e2                	mul    %edx
+  801d37:	c1 ea 0c             	shr    $0xc,%edx
+  801d3a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801d40:	29 d1                	sub    %edx,%ecx
+  801d42:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801d48:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d4f:	00 00 00 
+	stat->st_dev = &devpipe;
+  801d52:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  801d59:	60 80 00 
+	return 0;
+}
+  801d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d61:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d64:	5b                   	pop    %ebx
+  801d65:	5e                   	pop    %esi
+  801d66:	5d                   	pop    %ebp
+  801d67:	c3                   	ret
+
+00801d68 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801d68:	55                   	push   %ebp
+  801d69:	89 e5                	mov    %esp,%ebp
+  801d6b:	53                   	push   %ebx
+  801d6c:	83 ec 0c             	sub    $0xc,%esp
+  801d6f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801d72:	53                   	push   %ebx
+  801d73:	6a 00                	push   $0x0
+  801d75:	e8 d9 ef ff ff       	call   800d53 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801d7a:	89 1c 24             	mov    %ebx,(%esp)
+  801d7d:	e8 11 f6 ff ff       	call   801393 <fd2data>
+  801d82:	83 c4 08             	add    $0x8,%esp
+  801d85:	50                   	push   %eax
+  801d86:	6a 00                	push   $0x0
+  801d88:	e8 c6 ef ff ff       	call   800d53 <sys_page_unmap>
+}
+  801d8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d90:	c9                   	leave
+  801d91:	c3                   	ret
+
+00801d92 <_pipeisclosed>:
+{
+  801d92:	55                   	push   %ebp
+  801d93:	89 e5                	mov    %esp,%ebp
+  801d95:	57                   	push   %edi
+  801d96:	56                   	push   %esi
+  801d97:	53                   	push   %ebx
+  801d98:	83 ec 1c             	sub    $0x1c,%esp
+  801d9b:	89 c7                	mov    %eax,%edi
+  801d9d:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801d9f:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  801da4:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801da7:	83 ec 0c             	sub    $0xc,%esp
+  801daa:	57                   	push   %edi
+  801dab:	e8 ec 2c 00 00       	call   804a9c <pageref>
+  801db0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801db3:	89 34 24             	mov    %esi,(%esp)
+  801db6:	e8 e1 2c 00 00       	call   804a9c <pageref>
+		nn = thisenv->env_runs;
+  801dbb:	8b 15 14 e9 80 00    	mov    0x80e914,%edx
+  801dc1:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801dc4:	83 c4 10             	add    $0x10,%esp
+  801dc7:	39 cb                	cmp    %ecx,%ebx
+  801dc9:	74 1b                	je     801de6 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801dcb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801dce:	75 cf                	jne    801d9f <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801dd0:	8b 42 58             	mov    0x58(%edx),%eax
+  801dd3:	6a 01                	push   $0x1
+  801dd5:	50                   	push   %eax
+  801dd6:	53                   	push   %ebx
+  801dd7:	68 0a 52 80 00       	push   $0x80520a
+  801ddc:	e8 13 e4 ff ff       	call   8001f4 <cprintf>
+  801de1:	83 c4 10             	add    $0x10,%esp
+  801de4:	eb b9                	jmp    801d9f <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801de6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801de9:	0f 94 c0             	sete   %al
+  801dec:	0f b6 c0             	movzbl %al,%eax
+}
+  801def:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801df2:	5b                   	pop    %ebx
+  801df3:	5e                   	pop    %esi
+  801df4:	5f                   	pop    %edi
+  801df5:	5d                   	pop    %ebp
+  801df6:	c3                   	ret
+
+00801df7 <devpipe_read>:
+{
+  801df7:	55                   	push   %ebp
+  801df8:	89 e5                	mov    %esp,%ebp
+  801dfa:	57                   	push   %edi
+  801dfb:	56                   	push   %esi
+  801dfc:	53                   	push   %ebx
+  801dfd:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801e00:	ff 75 08             	push   0x8(%ebp)
+  801e03:	e8 8b f5 ff ff       	call   801393 <fd2data>
+  801e08:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801e0a:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801e0d:	8d 40 04             	lea    0x4(%eax),%eax
+  801e10:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801e13:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801e16:	8b 0b                	mov    (%ebx),%ecx
+  801e18:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801e1e:	29 ce                	sub    %ecx,%esi
+  801e20:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e25:	f7 e6                	mul    %esi
+  801e27:	c1 ea 0c             	shr    $0xc,%edx
+  801e2a:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801e30:	29 c6                	sub    %eax,%esi
+  801e32:	89 f2                	mov    %esi,%edx
+  801e34:	75 43                	jne    801e79 <devpipe_read+0x82>
+		ref = pageref(p);
+  801e36:	83 ec 0c             	sub    $0xc,%esp
+  801e39:	53                   	push   %ebx
+  801e3a:	e8 5d 2c 00 00       	call   804a9c <pageref>
+  801e3f:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801e41:	89 da                	mov    %ebx,%edx
+  801e43:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e46:	e8 47 ff ff ff       	call   801d92 <_pipeisclosed>
+  801e4b:	83 c4 10             	add    $0x10,%esp
+  801e4e:	85 c0                	test   %eax,%eax
+  801e50:	0f 85 c1 00 00 00    	jne    801f17 <devpipe_read+0x120>
+	*sleeping = 1;
+  801e56:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801e5d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801e62:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801e65:	75 ac                	jne    801e13 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801e67:	83 ec 04             	sub    $0x4,%esp
+  801e6a:	56                   	push   %esi
+  801e6b:	57                   	push   %edi
+  801e6c:	ff 75 e4             	push   -0x1c(%ebp)
+  801e6f:	e8 33 f3 ff ff       	call   8011a7 <sys_futex_wait>
+  801e74:	83 c4 10             	add    $0x10,%esp
+  801e77:	eb 9a                	jmp    801e13 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801e79:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801e7c:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801e80:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801e82:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e87:	f7 e1                	mul    %ecx
+  801e89:	c1 ea 0b             	shr    $0xb,%edx
+  801e8c:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801e92:	29 c1                	sub    %eax,%ecx
+  801e94:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801e96:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801e9b:	29 cf                	sub    %ecx,%edi
+  801e9d:	39 f7                	cmp    %esi,%edi
+  801e9f:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801ea2:	8d 43 10             	lea    0x10(%ebx),%eax
+  801ea5:	83 ec 04             	sub    $0x4,%esp
+  801ea8:	57                   	push   %edi
+  801ea9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801eac:	01 c2                	add    %eax,%edx
+  801eae:	52                   	push   %edx
+  801eaf:	ff 75 0c             	push   0xc(%ebp)
+  801eb2:	e8 aa ea ff ff       	call   800961 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801eb7:	83 c4 0c             	add    $0xc,%esp
+  801eba:	89 f1                	mov    %esi,%ecx
+  801ebc:	29 f9                	sub    %edi,%ecx
+  801ebe:	51                   	push   %ecx
+  801ebf:	ff 75 e4             	push   -0x1c(%ebp)
+  801ec2:	89 f8                	mov    %edi,%eax
+  801ec4:	03 45 0c             	add    0xc(%ebp),%eax
+  801ec7:	50                   	push   %eax
+  801ec8:	e8 94 ea ff ff       	call   800961 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801ecd:	89 f1                	mov    %esi,%ecx
+  801ecf:	03 0b                	add    (%ebx),%ecx
+  801ed1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801ed6:	f7 e1                	mul    %ecx
+  801ed8:	c1 ea 0c             	shr    $0xc,%edx
+  801edb:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801ee1:	29 d1                	sub    %edx,%ecx
+  801ee3:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801ee5:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801eea:	83 c4 10             	add    $0x10,%esp
+  801eed:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801ef1:	75 0a                	jne    801efd <devpipe_read+0x106>
+	return n;
+  801ef3:	89 f0                	mov    %esi,%eax
+}
+  801ef5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ef8:	5b                   	pop    %ebx
+  801ef9:	5e                   	pop    %esi
+  801efa:	5f                   	pop    %edi
+  801efb:	5d                   	pop    %ebp
+  801efc:	c3                   	ret
+		*sleeping = 0;
+  801efd:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801f04:	83 ec 08             	sub    $0x8,%esp
+  801f07:	68 00 04 00 00       	push   $0x400
+  801f0c:	53                   	push   %ebx
+  801f0d:	e8 e5 f2 ff ff       	call   8011f7 <sys_futex_wake>
+  801f12:	83 c4 10             	add    $0x10,%esp
+  801f15:	eb dc                	jmp    801ef3 <devpipe_read+0xfc>
+			return 0;
+  801f17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f1c:	eb d7                	jmp    801ef5 <devpipe_read+0xfe>
+
+00801f1e <devpipe_write>:
+{
+  801f1e:	55                   	push   %ebp
+  801f1f:	89 e5                	mov    %esp,%ebp
+  801f21:	57                   	push   %edi
+  801f22:	56                   	push   %esi
+  801f23:	53                   	push   %ebx
+  801f24:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801f27:	ff 75 08             	push   0x8(%ebp)
+  801f2a:	e8 64 f4 ff ff       	call   801393 <fd2data>
+  801f2f:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801f31:	83 c4 10             	add    $0x10,%esp
+  801f34:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801f3b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f3e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801f41:	0f 83 23 01 00 00    	jae    80206a <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801f47:	8b 77 04             	mov    0x4(%edi),%esi
+  801f4a:	8b 1f                	mov    (%edi),%ebx
+  801f4c:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801f52:	29 d9                	sub    %ebx,%ecx
+  801f54:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f59:	f7 e1                	mul    %ecx
+  801f5b:	c1 ea 0c             	shr    $0xc,%edx
+  801f5e:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801f64:	29 c1                	sub    %eax,%ecx
+  801f66:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801f68:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801f6e:	75 40                	jne    801fb0 <devpipe_write+0x92>
+			ref = pageref(p);
+  801f70:	83 ec 0c             	sub    $0xc,%esp
+  801f73:	57                   	push   %edi
+  801f74:	e8 23 2b 00 00       	call   804a9c <pageref>
+  801f79:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801f7b:	89 fa                	mov    %edi,%edx
+  801f7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f80:	e8 0d fe ff ff       	call   801d92 <_pipeisclosed>
+  801f85:	83 c4 10             	add    $0x10,%esp
+  801f88:	85 c0                	test   %eax,%eax
+  801f8a:	0f 85 d5 00 00 00    	jne    802065 <devpipe_write+0x147>
+	*sleeping = 1;
+  801f90:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801f97:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801f9c:	39 1f                	cmp    %ebx,(%edi)
+  801f9e:	75 a7                	jne    801f47 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801fa0:	83 ec 04             	sub    $0x4,%esp
+  801fa3:	56                   	push   %esi
+  801fa4:	53                   	push   %ebx
+  801fa5:	57                   	push   %edi
+  801fa6:	e8 fc f1 ff ff       	call   8011a7 <sys_futex_wait>
+  801fab:	83 c4 10             	add    $0x10,%esp
+  801fae:	eb 97                	jmp    801f47 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801fb0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801fb3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fb6:	29 c1                	sub    %eax,%ecx
+  801fb8:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801fbd:	89 d8                	mov    %ebx,%eax
+  801fbf:	29 d0                	sub    %edx,%eax
+  801fc1:	39 c1                	cmp    %eax,%ecx
+  801fc3:	0f 46 c1             	cmovbe %ecx,%eax
+  801fc6:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801fc8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801fcd:	f7 e6                	mul    %esi
+  801fcf:	c1 ea 0b             	shr    $0xb,%edx
+  801fd2:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801fd8:	29 c6                	sub    %eax,%esi
+  801fda:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801fdc:	29 f3                	sub    %esi,%ebx
+  801fde:	39 cb                	cmp    %ecx,%ebx
+  801fe0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801fe3:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801fe6:	8d 77 10             	lea    0x10(%edi),%esi
+  801fe9:	83 ec 04             	sub    $0x4,%esp
+  801fec:	53                   	push   %ebx
+  801fed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ff0:	03 45 0c             	add    0xc(%ebp),%eax
+  801ff3:	50                   	push   %eax
+  801ff4:	01 f2                	add    %esi,%edx
+  801ff6:	52                   	push   %edx
+  801ff7:	e8 65 e9 ff ff       	call   800961 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  801ffc:	83 c4 0c             	add    $0xc,%esp
+  801fff:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802002:	29 d8                	sub    %ebx,%eax
+  802004:	50                   	push   %eax
+  802005:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802008:	01 d3                	add    %edx,%ebx
+  80200a:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80200d:	53                   	push   %ebx
+  80200e:	56                   	push   %esi
+  80200f:	e8 4d e9 ff ff       	call   800961 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802014:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802017:	03 4f 04             	add    0x4(%edi),%ecx
+  80201a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80201f:	f7 e1                	mul    %ecx
+  802021:	c1 ea 0c             	shr    $0xc,%edx
+  802024:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80202a:	29 d1                	sub    %edx,%ecx
+  80202c:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  80202f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802034:	83 c4 10             	add    $0x10,%esp
+  802037:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  80203b:	75 0b                	jne    802048 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  80203d:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  802040:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802043:	e9 f3 fe ff ff       	jmp    801f3b <devpipe_write+0x1d>
+		*sleeping = 0;
+  802048:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  80204f:	83 ec 08             	sub    $0x8,%esp
+  802052:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802057:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  80205a:	50                   	push   %eax
+  80205b:	e8 97 f1 ff ff       	call   8011f7 <sys_futex_wake>
+  802060:	83 c4 10             	add    $0x10,%esp
+  802063:	eb d8                	jmp    80203d <devpipe_write+0x11f>
+				return 0;
+  802065:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80206a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206d:	5b                   	pop    %ebx
+  80206e:	5e                   	pop    %esi
+  80206f:	5f                   	pop    %edi
+  802070:	5d                   	pop    %ebp
+  802071:	c3                   	ret
+
+00802072 <pipe>:
+{
+  802072:	55                   	push   %ebp
+  802073:	89 e5                	mov    %esp,%ebp
+  802075:	56                   	push   %esi
+  802076:	53                   	push   %ebx
+  802077:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80207a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80207d:	50                   	push   %eax
+  80207e:	e8 27 f3 ff ff       	call   8013aa <fd_alloc>
+  802083:	89 c3                	mov    %eax,%ebx
+  802085:	83 c4 10             	add    $0x10,%esp
+  802088:	85 c0                	test   %eax,%eax
+  80208a:	0f 88 23 01 00 00    	js     8021b3 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802090:	83 ec 04             	sub    $0x4,%esp
+  802093:	68 07 04 00 00       	push   $0x407
+  802098:	ff 75 f4             	push   -0xc(%ebp)
+  80209b:	6a 00                	push   $0x0
+  80209d:	e8 2c ec ff ff       	call   800cce <sys_page_alloc>
+  8020a2:	89 c3                	mov    %eax,%ebx
+  8020a4:	83 c4 10             	add    $0x10,%esp
+  8020a7:	85 c0                	test   %eax,%eax
+  8020a9:	0f 88 04 01 00 00    	js     8021b3 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8020af:	83 ec 0c             	sub    $0xc,%esp
+  8020b2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020b5:	50                   	push   %eax
+  8020b6:	e8 ef f2 ff ff       	call   8013aa <fd_alloc>
+  8020bb:	89 c3                	mov    %eax,%ebx
+  8020bd:	83 c4 10             	add    $0x10,%esp
+  8020c0:	85 c0                	test   %eax,%eax
+  8020c2:	0f 88 db 00 00 00    	js     8021a3 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020c8:	83 ec 04             	sub    $0x4,%esp
+  8020cb:	68 07 04 00 00       	push   $0x407
+  8020d0:	ff 75 f0             	push   -0x10(%ebp)
+  8020d3:	6a 00                	push   $0x0
+  8020d5:	e8 f4 eb ff ff       	call   800cce <sys_page_alloc>
+  8020da:	89 c3                	mov    %eax,%ebx
+  8020dc:	83 c4 10             	add    $0x10,%esp
+  8020df:	85 c0                	test   %eax,%eax
+  8020e1:	0f 88 bc 00 00 00    	js     8021a3 <pipe+0x131>
+	va = fd2data(fd0);
+  8020e7:	83 ec 0c             	sub    $0xc,%esp
+  8020ea:	ff 75 f4             	push   -0xc(%ebp)
+  8020ed:	e8 a1 f2 ff ff       	call   801393 <fd2data>
+  8020f2:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020f4:	83 c4 0c             	add    $0xc,%esp
+  8020f7:	68 07 04 00 00       	push   $0x407
+  8020fc:	50                   	push   %eax
+  8020fd:	6a 00                	push   $0x0
+  8020ff:	e8 ca eb ff ff       	call   800cce <sys_page_alloc>
+  802104:	89 c3                	mov    %eax,%ebx
+  802106:	83 c4 10             	add    $0x10,%esp
+  802109:	85 c0                	test   %eax,%eax
+  80210b:	0f 88 82 00 00 00    	js     802193 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802111:	83 ec 0c             	sub    $0xc,%esp
+  802114:	ff 75 f0             	push   -0x10(%ebp)
+  802117:	e8 77 f2 ff ff       	call   801393 <fd2data>
+  80211c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802123:	50                   	push   %eax
+  802124:	6a 00                	push   $0x0
+  802126:	56                   	push   %esi
+  802127:	6a 00                	push   $0x0
+  802129:	e8 e3 eb ff ff       	call   800d11 <sys_page_map>
+  80212e:	89 c3                	mov    %eax,%ebx
+  802130:	83 c4 20             	add    $0x20,%esp
+  802133:	85 c0                	test   %eax,%eax
+  802135:	78 4e                	js     802185 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802137:	a1 20 60 80 00       	mov    0x806020,%eax
+  80213c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80213f:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802141:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802144:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80214b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80214e:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802150:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802153:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80215a:	83 ec 0c             	sub    $0xc,%esp
+  80215d:	ff 75 f4             	push   -0xc(%ebp)
+  802160:	e8 1e f2 ff ff       	call   801383 <fd2num>
+  802165:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802168:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80216a:	83 c4 04             	add    $0x4,%esp
+  80216d:	ff 75 f0             	push   -0x10(%ebp)
+  802170:	e8 0e f2 ff ff       	call   801383 <fd2num>
+  802175:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802178:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80217b:	83 c4 10             	add    $0x10,%esp
+  80217e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802183:	eb 2e                	jmp    8021b3 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802185:	83 ec 08             	sub    $0x8,%esp
+  802188:	56                   	push   %esi
+  802189:	6a 00                	push   $0x0
+  80218b:	e8 c3 eb ff ff       	call   800d53 <sys_page_unmap>
+  802190:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802193:	83 ec 08             	sub    $0x8,%esp
+  802196:	ff 75 f0             	push   -0x10(%ebp)
+  802199:	6a 00                	push   $0x0
+  80219b:	e8 b3 eb ff ff       	call   800d53 <sys_page_unmap>
+  8021a0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8021a3:	83 ec 08             	sub    $0x8,%esp
+  8021a6:	ff 75 f4             	push   -0xc(%ebp)
+  8021a9:	6a 00                	push   $0x0
+  8021ab:	e8 a3 eb ff ff       	call   800d53 <sys_page_unmap>
+  8021b0:	83 c4 10             	add    $0x10,%esp
+}
+  8021b3:	89 d8                	mov    %ebx,%eax
+  8021b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b8:	5b                   	pop    %ebx
+  8021b9:	5e                   	pop    %esi
+  8021ba:	5d                   	pop    %ebp
+  8021bb:	c3                   	ret
+
+008021bc <pipeisclosed>:
+{
+  8021bc:	55                   	push   %ebp
+  8021bd:	89 e5                	mov    %esp,%ebp
+  8021bf:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021c2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c5:	50                   	push   %eax
+  8021c6:	ff 75 08             	push   0x8(%ebp)
+  8021c9:	e8 30 f2 ff ff       	call   8013fe <fd_lookup>
+  8021ce:	83 c4 10             	add    $0x10,%esp
+  8021d1:	85 c0                	test   %eax,%eax
+  8021d3:	78 18                	js     8021ed <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8021d5:	83 ec 0c             	sub    $0xc,%esp
+  8021d8:	ff 75 f4             	push   -0xc(%ebp)
+  8021db:	e8 b3 f1 ff ff       	call   801393 <fd2data>
+  8021e0:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8021e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021e5:	e8 a8 fb ff ff       	call   801d92 <_pipeisclosed>
+  8021ea:	83 c4 10             	add    $0x10,%esp
+}
+  8021ed:	c9                   	leave
+  8021ee:	c3                   	ret
+
+008021ef <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  8021ef:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8021f1:	8b 15 14 e9 80 00    	mov    0x80e914,%edx
+  8021f7:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  8021fd:	81 c2 34 01 00 00    	add    $0x134,%edx
+  802203:	39 d0                	cmp    %edx,%eax
+  802205:	74 2e                	je     802235 <segment_lookup+0x46>
+{
+  802207:	55                   	push   %ebp
+  802208:	89 e5                	mov    %esp,%ebp
+  80220a:	57                   	push   %edi
+  80220b:	56                   	push   %esi
+  80220c:	53                   	push   %ebx
+  80220d:	eb 07                	jmp    802216 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  80220f:	83 c0 20             	add    $0x20,%eax
+  802212:	39 d0                	cmp    %edx,%eax
+  802214:	74 15                	je     80222b <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802216:	8b 18                	mov    (%eax),%ebx
+  802218:	39 d9                	cmp    %ebx,%ecx
+  80221a:	72 f3                	jb     80220f <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  80221c:	8b 38                	mov    (%eax),%edi
+  80221e:	8b 58 04             	mov    0x4(%eax),%ebx
+  802221:	89 ce                	mov    %ecx,%esi
+  802223:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  802225:	39 de                	cmp    %ebx,%esi
+  802227:	73 e6                	jae    80220f <segment_lookup+0x20>
+  802229:	eb 05                	jmp    802230 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  80222b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802230:	5b                   	pop    %ebx
+  802231:	5e                   	pop    %esi
+  802232:	5f                   	pop    %edi
+  802233:	5d                   	pop    %ebp
+  802234:	c3                   	ret
+	return NULL;
+  802235:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80223a:	c3                   	ret
+
+0080223b <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  80223b:	55                   	push   %ebp
+  80223c:	89 e5                	mov    %esp,%ebp
+  80223e:	53                   	push   %ebx
+  80223f:	83 ec 04             	sub    $0x4,%esp
+  802242:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802244:	c1 e8 16             	shr    $0x16,%eax
+  802247:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80224e:	25 81 00 00 00       	and    $0x81,%eax
+  802253:	83 f8 01             	cmp    $0x1,%eax
+  802256:	75 6b                	jne    8022c3 <page_is_clean+0x88>
+  802258:	89 da                	mov    %ebx,%edx
+  80225a:	c1 ea 0c             	shr    $0xc,%edx
+  80225d:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  802264:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802269:	f6 c1 01             	test   $0x1,%cl
+  80226c:	74 5a                	je     8022c8 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  80226e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802275:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  80227b:	75 4b                	jne    8022c8 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  80227d:	89 d8                	mov    %ebx,%eax
+  80227f:	e8 6b ff ff ff       	call   8021ef <segment_lookup>
+  802284:	89 c2                	mov    %eax,%edx
+		return 1;
+  802286:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  80228b:	85 d2                	test   %edx,%edx
+  80228d:	75 39                	jne    8022c8 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  80228f:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  802295:	b8 00 00 00 00       	mov    $0x0,%eax
+  80229a:	eb 03                	jmp    80229f <page_is_clean+0x64>
+  80229c:	83 c0 01             	add    $0x1,%eax
+  80229f:	39 c2                	cmp    %eax,%edx
+  8022a1:	7e 19                	jle    8022bc <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  8022a3:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  8022aa:	72 f0                	jb     80229c <page_is_clean+0x61>
+  8022ac:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  8022b3:	73 e7                	jae    80229c <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  8022b5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022ba:	eb 0c                	jmp    8022c8 <page_is_clean+0x8d>
+	return 0;
+  8022bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c1:	eb 05                	jmp    8022c8 <page_is_clean+0x8d>
+		return 0;
+  8022c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022cb:	c9                   	leave
+  8022cc:	c3                   	ret
+
+008022cd <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  8022cd:	55                   	push   %ebp
+  8022ce:	89 e5                	mov    %esp,%ebp
+  8022d0:	57                   	push   %edi
+  8022d1:	56                   	push   %esi
+  8022d2:	53                   	push   %ebx
+  8022d3:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8022d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8022db:	eb 19                	jmp    8022f6 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8022dd:	f7 d3                	not    %ebx
+  8022df:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8022e5:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8022e7:	83 c6 01             	add    $0x1,%esi
+  8022ea:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8022f0:	0f 87 97 00 00 00    	ja     80238d <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8022f6:	89 f3                	mov    %esi,%ebx
+  8022f8:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  8022fe:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802304:	89 d8                	mov    %ebx,%eax
+  802306:	c1 e8 0a             	shr    $0xa,%eax
+  802309:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802310:	25 81 00 00 00       	and    $0x81,%eax
+  802315:	83 f8 01             	cmp    $0x1,%eax
+  802318:	75 c3                	jne    8022dd <linear_walk+0x10>
+  80231a:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802320:	77 bb                	ja     8022dd <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802322:	89 df                	mov    %ebx,%edi
+  802324:	c1 e7 0c             	shl    $0xc,%edi
+  802327:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80232a:	89 f8                	mov    %edi,%eax
+  80232c:	e8 0a ff ff ff       	call   80223b <page_is_clean>
+  802331:	84 c0                	test   %al,%al
+  802333:	75 64                	jne    802399 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802335:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  80233b:	77 aa                	ja     8022e7 <linear_walk+0x1a>
+  80233d:	81 ff 00 00 81 00    	cmp    $0x810000,%edi
+  802343:	72 a2                	jb     8022e7 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802345:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80234c:	a8 01                	test   $0x1,%al
+  80234e:	74 97                	je     8022e7 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802350:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802357:	f6 c4 04             	test   $0x4,%ah
+  80235a:	75 8b                	jne    8022e7 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80235c:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802363:	f6 c4 02             	test   $0x2,%ah
+  802366:	0f 85 7b ff ff ff    	jne    8022e7 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80236c:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802373:	c1 e8 0c             	shr    $0xc,%eax
+  802376:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802379:	05 00 00 00 ef       	add    $0xef000000,%eax
+  80237e:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802382:	66 83 f8 01          	cmp    $0x1,%ax
+  802386:	76 11                	jbe    802399 <linear_walk+0xcc>
+  802388:	e9 5a ff ff ff       	jmp    8022e7 <linear_walk+0x1a>
+  80238d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  802392:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802399:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  80239f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023a2:	83 c4 1c             	add    $0x1c,%esp
+  8023a5:	5b                   	pop    %ebx
+  8023a6:	5e                   	pop    %esi
+  8023a7:	5f                   	pop    %edi
+  8023a8:	5d                   	pop    %ebp
+  8023a9:	c3                   	ret
+
+008023aa <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  8023aa:	55                   	push   %ebp
+  8023ab:	89 e5                	mov    %esp,%ebp
+  8023ad:	56                   	push   %esi
+  8023ae:	53                   	push   %ebx
+  8023af:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  8023b1:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023b6:	83 e0 7f             	and    $0x7f,%eax
+  8023b9:	c1 e0 04             	shl    $0x4,%eax
+  8023bc:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  8023c2:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  8023c8:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  8023ce:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  8023d4:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023d9:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  8023dc:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023e1:	83 c0 01             	add    $0x1,%eax
+  8023e4:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  8023e9:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  8023ec:	5b                   	pop    %ebx
+  8023ed:	5e                   	pop    %esi
+  8023ee:	5d                   	pop    %ebp
+  8023ef:	c3                   	ret
+
+008023f0 <page_ring_enter>:
+{
+  8023f0:	55                   	push   %ebp
+  8023f1:	89 e5                	mov    %esp,%ebp
+  8023f3:	57                   	push   %edi
+  8023f4:	56                   	push   %esi
+  8023f5:	53                   	push   %ebx
+  8023f6:	83 ec 18             	sub    $0x18,%esp
+  8023f9:	89 c6                	mov    %eax,%esi
+  8023fb:	89 d7                	mov    %edx,%edi
+  8023fd:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  8023ff:	6a 00                	push   $0x0
+  802401:	6a 00                	push   $0x0
+  802403:	6a 00                	push   $0x0
+  802405:	6a 07                	push   $0x7
+  802407:	ff 35 40 b0 80 00    	push   0x80b040
+  80240d:	e8 74 25 00 00       	call   804986 <ipc_call>
+  802412:	83 c4 20             	add    $0x20,%esp
+  802415:	85 c0                	test   %eax,%eax
+  802417:	79 22                	jns    80243b <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802419:	50                   	push   %eax
+  80241a:	68 22 52 80 00       	push   $0x805222
+  80241f:	68 13 02 00 00       	push   $0x213
+  802424:	68 36 52 80 00       	push   $0x805236
+  802429:	e8 eb dc ff ff       	call   800119 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  80242e:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802433:	83 c0 01             	add    $0x1,%eax
+  802436:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  80243b:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802441:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802446:	39 c2                	cmp    %eax,%edx
+  802448:	74 24                	je     80246e <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  80244a:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  80244f:	83 e0 7f             	and    $0x7f,%eax
+  802452:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802459:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802460:	29 f0                	sub    %esi,%eax
+  802462:	39 d8                	cmp    %ebx,%eax
+  802464:	73 c8                	jae    80242e <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802466:	8b 52 04             	mov    0x4(%edx),%edx
+  802469:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  80246c:	eb c0                	jmp    80242e <page_ring_enter+0x3e>
+}
+  80246e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802471:	5b                   	pop    %ebx
+  802472:	5e                   	pop    %esi
+  802473:	5f                   	pop    %edi
+  802474:	5d                   	pop    %ebp
+  802475:	c3                   	ret
+
+00802476 <page_ring_reserve>:
+{
+  802476:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802478:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80247d:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802483:	29 d0                	sub    %edx,%eax
+  802485:	ba 80 00 00 00       	mov    $0x80,%edx
+  80248a:	29 ca                	sub    %ecx,%edx
+  80248c:	39 c2                	cmp    %eax,%edx
+  80248e:	72 01                	jb     802491 <page_ring_reserve+0x1b>
+  802490:	c3                   	ret
+{
+  802491:	55                   	push   %ebp
+  802492:	89 e5                	mov    %esp,%ebp
+  802494:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802497:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80249c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a6:	e8 45 ff ff ff       	call   8023f0 <page_ring_enter>
+}
+  8024ab:	c9                   	leave
+  8024ac:	c3                   	ret
+
+008024ad <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  8024ad:	55                   	push   %ebp
+  8024ae:	89 e5                	mov    %esp,%ebp
+  8024b0:	53                   	push   %ebx
+  8024b1:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  8024b4:	6a 07                	push   $0x7
+  8024b6:	6a 01                	push   $0x1
+  8024b8:	89 c3                	mov    %eax,%ebx
+  8024ba:	c1 e3 0c             	shl    $0xc,%ebx
+  8024bd:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  8024c3:	52                   	push   %edx
+  8024c4:	6a 04                	push   $0x4
+  8024c6:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  8024cd:	e8 b4 24 00 00       	call   804986 <ipc_call>
+	sharereqs[i].nslots = 0;
+  8024d2:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  8024d9:	00 00 00 
+	return r;
+}
+  8024dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024df:	c9                   	leave
+  8024e0:	c3                   	ret
+
+008024e1 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  8024e1:	55                   	push   %ebp
+  8024e2:	89 e5                	mov    %esp,%ebp
+  8024e4:	56                   	push   %esi
+  8024e5:	53                   	push   %ebx
+  8024e6:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  8024e8:	c1 e8 10             	shr    $0x10,%eax
+  8024eb:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  8024ee:	89 c2                	mov    %eax,%edx
+  8024f0:	c1 e2 0c             	shl    $0xc,%edx
+  8024f3:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  8024f9:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8024fc:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  802502:	89 c2                	mov    %eax,%edx
+  802504:	c1 e2 0a             	shl    $0xa,%edx
+  802507:	01 f2                	add    %esi,%edx
+  802509:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802510:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802516:	74 09                	je     802521 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802518:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80251d:	5b                   	pop    %ebx
+  80251e:	5e                   	pop    %esi
+  80251f:	5d                   	pop    %ebp
+  802520:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802521:	e8 87 ff ff ff       	call   8024ad <page_share_send>
+  802526:	eb f5                	jmp    80251d <page_share_slot+0x3c>
+
+00802528 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802528:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  80252d:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802530:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802535:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  80253b:	74 09                	je     802546 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  80253d:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802542:	85 c0                	test   %eax,%eax
+  802544:	75 01                	jne    802547 <page_ring_ready+0x1f>
+}
+  802546:	c3                   	ret
+{
+  802547:	55                   	push   %ebp
+  802548:	89 e5                	mov    %esp,%ebp
+  80254a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  80254d:	68 07 06 00 00       	push   $0x607
+  802552:	6a 08                	push   $0x8
+  802554:	68 00 30 ad de       	push   $0xdead3000
+  802559:	6a 00                	push   $0x0
+  80255b:	e8 99 e8 ff ff       	call   800df9 <sys_page_alloc_range>
+  802560:	83 c4 10             	add    $0x10,%esp
+  802563:	83 f8 08             	cmp    $0x8,%eax
+  802566:	74 1b                	je     802583 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802568:	83 ec 04             	sub    $0x4,%esp
+  80256b:	6a 08                	push   $0x8
+  80256d:	68 00 30 ad de       	push   $0xdead3000
+  802572:	6a 00                	push   $0x0
+  802574:	e8 ee e8 ff ff       	call   800e67 <sys_page_unmap_range>
+		return 0;
+  802579:	83 c4 10             	add    $0x10,%esp
+  80257c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802581:	c9                   	leave
+  802582:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802583:	83 ec 0c             	sub    $0xc,%esp
+  802586:	68 07 04 00 00       	push   $0x407
+  80258b:	6a 08                	push   $0x8
+  80258d:	68 00 30 ad de       	push   $0xdead3000
+  802592:	6a 06                	push   $0x6
+  802594:	ff 35 40 b0 80 00    	push   0x80b040
+  80259a:	e8 e7 23 00 00       	call   804986 <ipc_call>
+  80259f:	83 c4 20             	add    $0x20,%esp
+  8025a2:	85 c0                	test   %eax,%eax
+  8025a4:	78 14                	js     8025ba <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  8025a6:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8025ab:	8b 40 48             	mov    0x48(%eax),%eax
+  8025ae:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  8025b3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025b8:	eb c7                	jmp    802581 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  8025ba:	83 ec 04             	sub    $0x4,%esp
+  8025bd:	6a 08                	push   $0x8
+  8025bf:	68 00 30 ad de       	push   $0xdead3000
+  8025c4:	6a 00                	push   $0x0
+  8025c6:	e8 9c e8 ff ff       	call   800e67 <sys_page_unmap_range>
+		return 0;
+  8025cb:	83 c4 10             	add    $0x10,%esp
+  8025ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d3:	eb ac                	jmp    802581 <page_ring_ready+0x59>
+
+008025d5 <page_remove_slot>:
+{
+  8025d5:	55                   	push   %ebp
+  8025d6:	89 e5                	mov    %esp,%ebp
+  8025d8:	56                   	push   %esi
+  8025d9:	53                   	push   %ebx
+  8025da:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8025dc:	89 c6                	mov    %eax,%esi
+  8025de:	c1 ee 10             	shr    $0x10,%esi
+  8025e1:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8025e4:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  8025eb:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  8025f1:	74 2a                	je     80261d <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8025f3:	83 ec 0c             	sub    $0xc,%esp
+  8025f6:	6a 00                	push   $0x0
+  8025f8:	6a 00                	push   $0x0
+  8025fa:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  8025fc:	c1 e3 04             	shl    $0x4,%ebx
+  8025ff:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802602:	53                   	push   %ebx
+  802603:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  80260a:	e8 77 23 00 00       	call   804986 <ipc_call>
+  80260f:	83 c4 20             	add    $0x20,%esp
+  802612:	85 c0                	test   %eax,%eax
+  802614:	78 2d                	js     802643 <page_remove_slot+0x6e>
+}
+  802616:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802619:	5b                   	pop    %ebx
+  80261a:	5e                   	pop    %esi
+  80261b:	5d                   	pop    %ebp
+  80261c:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  80261d:	e8 06 ff ff ff       	call   802528 <page_ring_ready>
+  802622:	85 c0                	test   %eax,%eax
+  802624:	74 cd                	je     8025f3 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802626:	b8 01 00 00 00       	mov    $0x1,%eax
+  80262b:	e8 46 fe ff ff       	call   802476 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802630:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802635:	89 da                	mov    %ebx,%edx
+  802637:	b8 02 00 00 00       	mov    $0x2,%eax
+  80263c:	e8 69 fd ff ff       	call   8023aa <page_ring_post>
+		return;
+  802641:	eb d3                	jmp    802616 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802643:	50                   	push   %eax
+  802644:	68 90 52 80 00       	push   $0x805290
+  802649:	68 ac 03 00 00       	push   $0x3ac
+  80264e:	68 36 52 80 00       	push   $0x805236
+  802653:	e8 c1 da ff ff       	call   800119 <_panic>
+
+00802658 <find_paging_env>:
+	if(pagingenv)
+  802658:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  80265d:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  80265f:	85 c0                	test   %eax,%eax
+  802661:	74 05                	je     802668 <find_paging_env+0x10>
+  802663:	eb 56                	jmp    8026bb <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802665:	83 c0 01             	add    $0x1,%eax
+  802668:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80266d:	7f 47                	jg     8026b6 <find_paging_env+0x5e>
+  80266f:	83 f9 01             	cmp    $0x1,%ecx
+  802672:	7f 42                	jg     8026b6 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802674:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802677:	c1 e2 06             	shl    $0x6,%edx
+  80267a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802680:	8b 52 50             	mov    0x50(%edx),%edx
+  802683:	83 fa 02             	cmp    $0x2,%edx
+  802686:	75 dd                	jne    802665 <find_paging_env+0xd>
+  802688:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  80268b:	c1 e2 06             	shl    $0x6,%edx
+  80268e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802694:	8b 52 54             	mov    0x54(%edx),%edx
+  802697:	85 d2                	test   %edx,%edx
+  802699:	74 ca                	je     802665 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  80269b:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  80269e:	c1 e2 06             	shl    $0x6,%edx
+  8026a1:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8026a7:	8b 52 48             	mov    0x48(%edx),%edx
+  8026aa:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  8026b1:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8026b4:	eb af                	jmp    802665 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  8026b6:	83 f9 02             	cmp    $0x2,%ecx
+  8026b9:	74 01                	je     8026bc <find_paging_env+0x64>
+}
+  8026bb:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  8026bc:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8026c1:	8b 40 48             	mov    0x48(%eax),%eax
+  8026c4:	83 e0 01             	and    $0x1,%eax
+  8026c7:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  8026ce:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  8026d3:	eb e6                	jmp    8026bb <find_paging_env+0x63>
+
+008026d5 <page_add_backed>:
+{
+  8026d5:	55                   	push   %ebp
+  8026d6:	89 e5                	mov    %esp,%ebp
+  8026d8:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  8026db:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  8026e0:	83 f8 04             	cmp    $0x4,%eax
+  8026e3:	74 35                	je     80271a <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  8026e5:	89 d1                	mov    %edx,%ecx
+  8026e7:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  8026ed:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  8026f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026f7:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  8026fe:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802704:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  80270b:	83 c0 01             	add    $0x1,%eax
+  80270e:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  802713:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802718:	5d                   	pop    %ebp
+  802719:	c3                   	ret
+		return -E_NO_MEM;
+  80271a:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80271f:	eb f7                	jmp    802718 <page_add_backed+0x43>
+
+00802721 <percentage_of_pgdir_to_walk>:
+{
+  802721:	55                   	push   %ebp
+  802722:	89 e5                	mov    %esp,%ebp
+  802724:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802727:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  80272b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  80272e:	db 45 fc             	fildl  -0x4(%ebp)
+  802731:	d8 35 1c 57 80 00    	fdivs  0x80571c
+	return ret*ret;
+  802737:	d8 c8                	fmul   %st(0),%st
+}
+  802739:	c9                   	leave
+  80273a:	c3                   	ret
+
+0080273b <nfu_with_aging_page_choice_func>:
+{
+  80273b:	55                   	push   %ebp
+  80273c:	89 e5                	mov    %esp,%ebp
+  80273e:	57                   	push   %edi
+  80273f:	56                   	push   %esi
+  802740:	53                   	push   %ebx
+  802741:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802744:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  80274a:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  80274c:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802751:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802756:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80275d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802762:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802765:	eb 18                	jmp    80277f <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802767:	f7 d0                	not    %eax
+  802769:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80276e:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802770:	83 c2 01             	add    $0x1,%edx
+  802773:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802779:	0f 87 13 01 00 00    	ja     802892 <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  80277f:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802783:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802786:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80278b:	89 c1                	mov    %eax,%ecx
+  80278d:	c1 e9 0a             	shr    $0xa,%ecx
+  802790:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802797:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  80279d:	83 f9 01             	cmp    $0x1,%ecx
+  8027a0:	75 c5                	jne    802767 <nfu_with_aging_page_choice_func+0x2c>
+  8027a2:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8027a7:	77 be                	ja     802767 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8027a9:	89 c1                	mov    %eax,%ecx
+  8027ab:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8027ae:	81 f9 00 00 81 00    	cmp    $0x810000,%ecx
+  8027b4:	0f 82 a5 00 00 00    	jb     80285f <nfu_with_aging_page_choice_func+0x124>
+  8027ba:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8027c0:	0f 87 99 00 00 00    	ja     80285f <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8027c6:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8027cd:	f6 c1 01             	test   $0x1,%cl
+  8027d0:	0f 84 89 00 00 00    	je     80285f <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027d6:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8027dd:	f6 c5 04             	test   $0x4,%ch
+  8027e0:	75 7d                	jne    80285f <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8027e2:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027e9:	f6 c5 02             	test   $0x2,%ch
+  8027ec:	75 71                	jne    80285f <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8027ee:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8027f5:	c1 e9 0c             	shr    $0xc,%ecx
+  8027f8:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8027fb:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802801:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802805:	66 83 f9 01          	cmp    $0x1,%cx
+  802809:	77 54                	ja     80285f <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  80280b:	89 f9                	mov    %edi,%ecx
+  80280d:	80 f9 ff             	cmp    $0xff,%cl
+  802810:	74 21                	je     802833 <nfu_with_aging_page_choice_func+0xf8>
+  802812:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802819:	c1 e9 0c             	shr    $0xc,%ecx
+  80281c:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80281f:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802825:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802829:	89 fb                	mov    %edi,%ebx
+  80282b:	38 d9                	cmp    %bl,%cl
+  80282d:	73 30                	jae    80285f <nfu_with_aging_page_choice_func+0x124>
+  80282f:	dd d8                	fstp   %st(0)
+  802831:	eb 02                	jmp    802835 <nfu_with_aging_page_choice_func+0xfa>
+  802833:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802835:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80283c:	c1 e9 0c             	shr    $0xc,%ecx
+  80283f:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802842:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802849:	89 fb                	mov    %edi,%ebx
+  80284b:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  80284e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802851:	db 45 e0             	fildl  -0x20(%ebp)
+  802854:	d8 35 1c 57 80 00    	fdivs  0x80571c
+	return ret*ret;
+  80285a:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80285c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  80285f:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802862:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802865:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80286c:	df 6d e0             	fildll -0x20(%ebp)
+  80286f:	d9 c1                	fld    %st(1)
+  802871:	d8 0d 20 57 80 00    	fmuls  0x805720
+  802877:	d9 c9                	fxch   %st(1)
+  802879:	df f1                	fcomip %st(1),%st
+  80287b:	dd d8                	fstp   %st(0)
+  80287d:	0f 82 ed fe ff ff    	jb     802770 <nfu_with_aging_page_choice_func+0x35>
+  802883:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802885:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  80288a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80288d:	c1 e0 0c             	shl    $0xc,%eax
+  802890:	eb 0e                	jmp    8028a0 <nfu_with_aging_page_choice_func+0x165>
+  802892:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802894:	89 f8                	mov    %edi,%eax
+  802896:	3c ff                	cmp    $0xff,%al
+  802898:	74 0e                	je     8028a8 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  80289a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80289d:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8028a0:	83 c4 14             	add    $0x14,%esp
+  8028a3:	5b                   	pop    %ebx
+  8028a4:	5e                   	pop    %esi
+  8028a5:	5f                   	pop    %edi
+  8028a6:	5d                   	pop    %ebp
+  8028a7:	c3                   	ret
+	pgnum = 0;
+  8028a8:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  8028af:	00 00 00 
+	return (void*)UTOP;
+  8028b2:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8028b7:	eb e7                	jmp    8028a0 <nfu_with_aging_page_choice_func+0x165>
+
+008028b9 <myRand>:
+    state = state * 1664525 + 1013904223;
+  8028b9:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  8028c0:	66 19 00 
+  8028c3:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  8028c8:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  8028cd:	c1 e8 18             	shr    $0x18,%eax
+}
+  8028d0:	c3                   	ret
+
+008028d1 <random_page_choice_func>:
+{
+  8028d1:	55                   	push   %ebp
+  8028d2:	89 e5                	mov    %esp,%ebp
+  8028d4:	57                   	push   %edi
+  8028d5:	56                   	push   %esi
+  8028d6:	53                   	push   %ebx
+  8028d7:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8028da:	be 00 00 00 00       	mov    $0x0,%esi
+  8028df:	eb 19                	jmp    8028fa <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8028e1:	f7 d3                	not    %ebx
+  8028e3:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8028e9:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8028eb:	83 c6 01             	add    $0x1,%esi
+  8028ee:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8028f4:	0f 87 a0 00 00 00    	ja     80299a <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8028fa:	89 f3                	mov    %esi,%ebx
+  8028fc:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  802902:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802908:	89 d8                	mov    %ebx,%eax
+  80290a:	c1 e8 0a             	shr    $0xa,%eax
+  80290d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802914:	25 81 00 00 00       	and    $0x81,%eax
+  802919:	83 f8 01             	cmp    $0x1,%eax
+  80291c:	75 c3                	jne    8028e1 <random_page_choice_func+0x10>
+  80291e:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802924:	77 bb                	ja     8028e1 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802926:	89 df                	mov    %ebx,%edi
+  802928:	c1 e7 0c             	shl    $0xc,%edi
+  80292b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80292e:	89 f8                	mov    %edi,%eax
+  802930:	e8 06 f9 ff ff       	call   80223b <page_is_clean>
+  802935:	84 c0                	test   %al,%al
+  802937:	0f 85 82 00 00 00    	jne    8029bf <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80293d:	81 ff 00 00 81 00    	cmp    $0x810000,%edi
+  802943:	72 a6                	jb     8028eb <random_page_choice_func+0x1a>
+  802945:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  80294b:	77 9e                	ja     8028eb <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80294d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802954:	a8 01                	test   $0x1,%al
+  802956:	74 93                	je     8028eb <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802958:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80295f:	f6 c4 04             	test   $0x4,%ah
+  802962:	75 87                	jne    8028eb <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802964:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80296b:	f6 c4 02             	test   $0x2,%ah
+  80296e:	0f 85 77 ff ff ff    	jne    8028eb <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802974:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80297b:	c1 e8 0c             	shr    $0xc,%eax
+  80297e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802981:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802986:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80298a:	66 83 f8 01          	cmp    $0x1,%ax
+  80298e:	0f 87 57 ff ff ff    	ja     8028eb <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  802994:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  80299a:	e8 1a ff ff ff       	call   8028b9 <myRand>
+  80299f:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  8029a5:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  8029aa:	29 fe                	sub    %edi,%esi
+  8029ac:	0f be c0             	movsbl %al,%eax
+  8029af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b4:	f7 f6                	div    %esi
+  8029b6:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8029b8:	bb 15 00 00 00       	mov    $0x15,%ebx
+  8029bd:	eb 1c                	jmp    8029db <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  8029bf:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  8029c5:	e9 8f 00 00 00       	jmp    802a59 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8029ca:	e8 ea fe ff ff       	call   8028b9 <myRand>
+  8029cf:	0f be c0             	movsbl %al,%eax
+  8029d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029d7:	f7 f6                	div    %esi
+  8029d9:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8029db:	83 eb 01             	sub    $0x1,%ebx
+  8029de:	0f 84 c2 00 00 00    	je     802aa6 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  8029e4:	89 d0                	mov    %edx,%eax
+  8029e6:	c1 e8 0a             	shr    $0xa,%eax
+  8029e9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8029f0:	25 81 00 00 00       	and    $0x81,%eax
+  8029f5:	83 f8 01             	cmp    $0x1,%eax
+  8029f8:	75 d0                	jne    8029ca <random_page_choice_func+0xf9>
+  8029fa:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  802a00:	77 c8                	ja     8029ca <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  802a02:	89 d0                	mov    %edx,%eax
+  802a04:	c1 e0 0c             	shl    $0xc,%eax
+  802a07:	3d 00 00 81 00       	cmp    $0x810000,%eax
+  802a0c:	72 56                	jb     802a64 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a0e:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  802a13:	77 65                	ja     802a7a <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802a15:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a1c:	f6 c1 01             	test   $0x1,%cl
+  802a1f:	74 59                	je     802a7a <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802a21:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802a28:	f6 c5 04             	test   $0x4,%ch
+  802a2b:	75 4d                	jne    802a7a <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  802a2d:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802a34:	f6 c5 02             	test   $0x2,%ch
+  802a37:	75 41                	jne    802a7a <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  802a39:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802a40:	c1 ea 0c             	shr    $0xc,%edx
+  802a43:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  802a46:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  802a4c:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  802a50:	66 83 fa 01          	cmp    $0x1,%dx
+  802a54:	77 3a                	ja     802a90 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  802a56:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  802a59:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a5c:	83 c4 1c             	add    $0x1c,%esp
+  802a5f:	5b                   	pop    %ebx
+  802a60:	5e                   	pop    %esi
+  802a61:	5f                   	pop    %edi
+  802a62:	5d                   	pop    %ebp
+  802a63:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802a64:	e8 50 fe ff ff       	call   8028b9 <myRand>
+  802a69:	0f be c0             	movsbl %al,%eax
+  802a6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a71:	f7 f6                	div    %esi
+  802a73:	01 fa                	add    %edi,%edx
+			continue;
+  802a75:	e9 61 ff ff ff       	jmp    8029db <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802a7a:	e8 3a fe ff ff       	call   8028b9 <myRand>
+  802a7f:	0f be c0             	movsbl %al,%eax
+  802a82:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a87:	f7 f6                	div    %esi
+  802a89:	01 fa                	add    %edi,%edx
+			continue;
+  802a8b:	e9 4b ff ff ff       	jmp    8029db <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802a90:	e8 24 fe ff ff       	call   8028b9 <myRand>
+  802a95:	0f be c0             	movsbl %al,%eax
+  802a98:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a9d:	f7 f6                	div    %esi
+  802a9f:	01 fa                	add    %edi,%edx
+			continue;
+  802aa1:	e9 35 ff ff ff       	jmp    8029db <random_page_choice_func+0x10a>
+	pgnum = 0;
+  802aa6:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  802aad:	00 00 00 
+	return (void*)UTOP;
+  802ab0:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  802ab7:	eb a0                	jmp    802a59 <random_page_choice_func+0x188>
+
+00802ab9 <nfu>:
+{
+  802ab9:	55                   	push   %ebp
+  802aba:	89 e5                	mov    %esp,%ebp
+  802abc:	57                   	push   %edi
+  802abd:	56                   	push   %esi
+  802abe:	53                   	push   %ebx
+  802abf:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802ac2:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  802ac8:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802aca:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802acf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ad4:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802adb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ae0:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802ae3:	eb 18                	jmp    802afd <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802ae5:	f7 d0                	not    %eax
+  802ae7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802aec:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802aee:	83 c2 01             	add    $0x1,%edx
+  802af1:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802af7:	0f 87 13 01 00 00    	ja     802c10 <nfu+0x157>
+		++num_searched_ptes;
+  802afd:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802b01:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802b04:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802b09:	89 c1                	mov    %eax,%ecx
+  802b0b:	c1 e9 0a             	shr    $0xa,%ecx
+  802b0e:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802b15:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802b1b:	83 f9 01             	cmp    $0x1,%ecx
+  802b1e:	75 c5                	jne    802ae5 <nfu+0x2c>
+  802b20:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802b25:	77 be                	ja     802ae5 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802b27:	89 c1                	mov    %eax,%ecx
+  802b29:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b2c:	81 f9 00 00 81 00    	cmp    $0x810000,%ecx
+  802b32:	0f 82 a5 00 00 00    	jb     802bdd <nfu+0x124>
+  802b38:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802b3e:	0f 87 99 00 00 00    	ja     802bdd <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b44:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b4b:	f6 c1 01             	test   $0x1,%cl
+  802b4e:	0f 84 89 00 00 00    	je     802bdd <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802b54:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b5b:	f6 c5 04             	test   $0x4,%ch
+  802b5e:	75 7d                	jne    802bdd <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802b60:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802b67:	f6 c5 02             	test   $0x2,%ch
+  802b6a:	75 71                	jne    802bdd <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802b6c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b73:	c1 e9 0c             	shr    $0xc,%ecx
+  802b76:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b79:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802b7f:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802b83:	66 83 f9 01          	cmp    $0x1,%cx
+  802b87:	77 54                	ja     802bdd <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  802b89:	89 f9                	mov    %edi,%ecx
+  802b8b:	80 f9 ff             	cmp    $0xff,%cl
+  802b8e:	74 21                	je     802bb1 <nfu+0xf8>
+  802b90:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b97:	c1 e9 0c             	shr    $0xc,%ecx
+  802b9a:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b9d:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802ba3:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  802ba7:	89 fb                	mov    %edi,%ebx
+  802ba9:	38 d9                	cmp    %bl,%cl
+  802bab:	73 30                	jae    802bdd <nfu+0x124>
+  802bad:	dd d8                	fstp   %st(0)
+  802baf:	eb 02                	jmp    802bb3 <nfu+0xfa>
+  802bb1:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  802bb3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802bba:	c1 e9 0c             	shr    $0xc,%ecx
+  802bbd:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802bc0:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802bc7:	89 fb                	mov    %edi,%ebx
+  802bc9:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802bcc:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802bcf:	db 45 e0             	fildl  -0x20(%ebp)
+  802bd2:	d8 35 1c 57 80 00    	fdivs  0x80571c
+	return ret*ret;
+  802bd8:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802bda:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802bdd:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802be0:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802be3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802bea:	df 6d e0             	fildll -0x20(%ebp)
+  802bed:	d9 c1                	fld    %st(1)
+  802bef:	d8 0d 20 57 80 00    	fmuls  0x805720
+  802bf5:	d9 c9                	fxch   %st(1)
+  802bf7:	df f1                	fcomip %st(1),%st
+  802bf9:	dd d8                	fstp   %st(0)
+  802bfb:	0f 82 ed fe ff ff    	jb     802aee <nfu+0x35>
+  802c01:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802c03:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  802c08:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802c0b:	c1 e0 0c             	shl    $0xc,%eax
+  802c0e:	eb 0e                	jmp    802c1e <nfu+0x165>
+  802c10:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802c12:	89 f8                	mov    %edi,%eax
+  802c14:	3c ff                	cmp    $0xff,%al
+  802c16:	74 0e                	je     802c26 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802c18:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802c1b:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802c1e:	83 c4 14             	add    $0x14,%esp
+  802c21:	5b                   	pop    %ebx
+  802c22:	5e                   	pop    %esi
+  802c23:	5f                   	pop    %edi
+  802c24:	5d                   	pop    %ebp
+  802c25:	c3                   	ret
+	pgnum = 0;
+  802c26:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  802c2d:	00 00 00 
+	return (void*)UTOP;
+  802c30:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802c35:	eb e7                	jmp    802c1e <nfu+0x165>
+
+00802c37 <lru>:
+{
+  802c37:	55                   	push   %ebp
+  802c38:	89 e5                	mov    %esp,%ebp
+  802c3a:	57                   	push   %edi
+  802c3b:	56                   	push   %esi
+  802c3c:	53                   	push   %ebx
+  802c3d:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c40:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  802c46:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  802c4d:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802c54:	be 00 00 00 00       	mov    $0x0,%esi
+  802c59:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c60:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c65:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  802c68:	eb 18                	jmp    802c82 <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802c6a:	f7 d0                	not    %eax
+  802c6c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802c71:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c73:	83 c2 01             	add    $0x1,%edx
+  802c76:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802c7c:	0f 87 fa 00 00 00    	ja     802d7c <lru+0x145>
+		++num_searched_ptes;
+  802c82:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c85:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802c88:	01 d0                	add    %edx,%eax
+  802c8a:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802c8f:	89 c1                	mov    %eax,%ecx
+  802c91:	c1 e9 0a             	shr    $0xa,%ecx
+  802c94:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802c9b:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802ca1:	83 f9 01             	cmp    $0x1,%ecx
+  802ca4:	75 c4                	jne    802c6a <lru+0x33>
+  802ca6:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802cab:	77 bd                	ja     802c6a <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802cad:	89 c1                	mov    %eax,%ecx
+  802caf:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802cb2:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802cb8:	0f 87 92 00 00 00    	ja     802d50 <lru+0x119>
+  802cbe:	81 f9 00 00 81 00    	cmp    $0x810000,%ecx
+  802cc4:	0f 82 86 00 00 00    	jb     802d50 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802cca:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802cd1:	f6 c1 01             	test   $0x1,%cl
+  802cd4:	74 7a                	je     802d50 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802cd6:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802cdd:	f6 c5 04             	test   $0x4,%ch
+  802ce0:	75 6e                	jne    802d50 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802ce2:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802ce9:	f6 c5 02             	test   $0x2,%ch
+  802cec:	75 62                	jne    802d50 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802cee:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802cf5:	c1 e9 0c             	shr    $0xc,%ecx
+  802cf8:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802cfb:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d01:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802d05:	66 83 f9 01          	cmp    $0x1,%cx
+  802d09:	77 45                	ja     802d50 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  802d0b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d12:	c1 e9 0c             	shr    $0xc,%ecx
+  802d15:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d18:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d1e:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802d21:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802d24:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  802d27:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802d2a:	19 df                	sbb    %ebx,%edi
+  802d2c:	7c 22                	jl     802d50 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  802d2e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d35:	c1 e9 0c             	shr    $0xc,%ecx
+  802d38:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d3b:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d41:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802d44:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802d47:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802d4a:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d4d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802d50:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  802d53:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802d5a:	df 6d e0             	fildll -0x20(%ebp)
+  802d5d:	d9 05 20 57 80 00    	flds   0x805720
+  802d63:	d9 c9                	fxch   %st(1)
+  802d65:	df f1                	fcomip %st(1),%st
+  802d67:	dd d8                	fstp   %st(0)
+  802d69:	0f 82 04 ff ff ff    	jb     802c73 <lru+0x3c>
+			pgnum = pgnum_actual;
+  802d6f:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  802d74:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d77:	c1 e0 0c             	shl    $0xc,%eax
+  802d7a:	eb 06                	jmp    802d82 <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  802d7c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d7f:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802d82:	83 c4 1c             	add    $0x1c,%esp
+  802d85:	5b                   	pop    %ebx
+  802d86:	5e                   	pop    %esi
+  802d87:	5f                   	pop    %edi
+  802d88:	5d                   	pop    %ebp
+  802d89:	c3                   	ret
+
+00802d8a <set_page_choice_func>:
+{
+  802d8a:	55                   	push   %ebp
+  802d8b:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  802d8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d90:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  802d95:	5d                   	pop    %ebp
+  802d96:	c3                   	ret
+
+00802d97 <get_page_choice>:
+{
+  802d97:	55                   	push   %ebp
+  802d98:	89 e5                	mov    %esp,%ebp
+  802d9a:	57                   	push   %edi
+  802d9b:	56                   	push   %esi
+  802d9c:	53                   	push   %ebx
+  802d9d:	83 ec 24             	sub    $0x24,%esp
+  802da0:	8b 75 08             	mov    0x8(%ebp),%esi
+  802da3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  802da6:	57                   	push   %edi
+  802da7:	56                   	push   %esi
+  802da8:	ff 15 3c 60 80 00    	call   *0x80603c
+  802dae:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802db0:	83 c4 10             	add    $0x10,%esp
+  802db3:	eb 25                	jmp    802dda <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  802db5:	83 ec 08             	sub    $0x8,%esp
+  802db8:	c1 e0 16             	shl    $0x16,%eax
+  802dbb:	50                   	push   %eax
+  802dbc:	6a 00                	push   $0x0
+  802dbe:	e8 d2 df ff ff       	call   800d95 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802dc3:	83 c4 10             	add    $0x10,%esp
+  802dc6:	85 c0                	test   %eax,%eax
+  802dc8:	75 43                	jne    802e0d <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  802dca:	83 ec 08             	sub    $0x8,%esp
+  802dcd:	57                   	push   %edi
+  802dce:	56                   	push   %esi
+  802dcf:	ff 15 3c 60 80 00    	call   *0x80603c
+  802dd5:	89 c3                	mov    %eax,%ebx
+  802dd7:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802dda:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802ddd:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  802de3:	0f 86 ae 00 00 00    	jbe    802e97 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802de9:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  802dee:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802df5:	81 e2 81 00 00 00    	and    $0x81,%edx
+  802dfb:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  802e01:	74 b2                	je     802db5 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802e03:	83 c0 01             	add    $0x1,%eax
+  802e06:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  802e0b:	75 e1                	jne    802dee <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802e0d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e10:	05 00 10 40 11       	add    $0x11401000,%eax
+  802e15:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802e1a:	76 1f                	jbe    802e3b <get_page_choice+0xa4>
+		return (void *) UTOP;
+  802e1c:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  802e21:	89 d8                	mov    %ebx,%eax
+  802e23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e26:	5b                   	pop    %ebx
+  802e27:	5e                   	pop    %esi
+  802e28:	5f                   	pop    %edi
+  802e29:	5d                   	pop    %ebp
+  802e2a:	c3                   	ret
+		sys_page_split(0, pg_out);
+  802e2b:	83 ec 08             	sub    $0x8,%esp
+  802e2e:	53                   	push   %ebx
+  802e2f:	6a 00                	push   $0x0
+  802e31:	e8 5f df ff ff       	call   800d95 <sys_page_split>
+  802e36:	83 c4 10             	add    $0x10,%esp
+  802e39:	eb 6c                	jmp    802ea7 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  802e3b:	83 ec 04             	sub    $0x4,%esp
+  802e3e:	68 c8 52 80 00       	push   $0x8052c8
+  802e43:	68 cc 01 00 00       	push   $0x1cc
+  802e48:	68 36 52 80 00       	push   $0x805236
+  802e4d:	e8 c7 d2 ff ff       	call   800119 <_panic>
+		panic("We tried to page out code pages\n");
+  802e52:	83 ec 04             	sub    $0x4,%esp
+  802e55:	68 f8 52 80 00       	push   $0x8052f8
+  802e5a:	68 d6 01 00 00       	push   $0x1d6
+  802e5f:	68 36 52 80 00       	push   $0x805236
+  802e64:	e8 b0 d2 ff ff       	call   800119 <_panic>
+		panic("Invalid mapping for the va\n");
+  802e69:	83 ec 04             	sub    $0x4,%esp
+  802e6c:	68 43 52 80 00       	push   $0x805243
+  802e71:	68 da 01 00 00       	push   $0x1da
+  802e76:	68 36 52 80 00       	push   $0x805236
+  802e7b:	e8 99 d2 ff ff       	call   800119 <_panic>
+		panic("We tried to page out a shared page\n");
+  802e80:	83 ec 04             	sub    $0x4,%esp
+  802e83:	68 1c 53 80 00       	push   $0x80531c
+  802e88:	68 e0 01 00 00       	push   $0x1e0
+  802e8d:	68 36 52 80 00       	push   $0x805236
+  802e92:	e8 82 d2 ff ff       	call   800119 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  802e97:	89 de                	mov    %ebx,%esi
+  802e99:	c1 ee 16             	shr    $0x16,%esi
+  802e9c:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802ea3:	a8 80                	test   $0x80,%al
+  802ea5:	75 84                	jne    802e2b <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802ea7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802eaa:	05 00 10 40 11       	add    $0x11401000,%eax
+  802eaf:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802eb4:	76 85                	jbe    802e3b <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  802eb6:	89 d8                	mov    %ebx,%eax
+  802eb8:	e8 7e f3 ff ff       	call   80223b <page_is_clean>
+  802ebd:	84 c0                	test   %al,%al
+  802ebf:	0f 85 5c ff ff ff    	jne    802e21 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  802ec5:	81 7d e4 00 00 81 00 	cmpl   $0x810000,-0x1c(%ebp)
+  802ecc:	76 84                	jbe    802e52 <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  802ece:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802ed5:	a8 01                	test   $0x1,%al
+  802ed7:	74 90                	je     802e69 <get_page_choice+0xd2>
+  802ed9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802edc:	c1 e8 0c             	shr    $0xc,%eax
+  802edf:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802ee6:	f6 c2 01             	test   $0x1,%dl
+  802ee9:	0f 84 7a ff ff ff    	je     802e69 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802eef:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  802ef6:	f6 c2 01             	test   $0x1,%dl
+  802ef9:	74 85                	je     802e80 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802efb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802f02:	f6 c2 01             	test   $0x1,%dl
+  802f05:	0f 84 75 ff ff ff    	je     802e80 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802f0b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802f12:	f6 c6 04             	test   $0x4,%dh
+  802f15:	0f 85 65 ff ff ff    	jne    802e80 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  802f1b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802f22:	f6 c6 02             	test   $0x2,%dh
+  802f25:	0f 85 55 ff ff ff    	jne    802e80 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  802f2b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f32:	c1 e8 0c             	shr    $0xc,%eax
+  802f35:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802f38:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802f3d:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802f41:	66 83 f8 01          	cmp    $0x1,%ax
+  802f45:	0f 86 d6 fe ff ff    	jbe    802e21 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  802f4b:	83 ec 04             	sub    $0x4,%esp
+  802f4e:	68 40 53 80 00       	push   $0x805340
+  802f53:	68 e2 01 00 00       	push   $0x1e2
+  802f58:	68 36 52 80 00       	push   $0x805236
+  802f5d:	e8 b7 d1 ff ff       	call   800119 <_panic>
+
+00802f62 <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  802f62:	55                   	push   %ebp
+  802f63:	89 e5                	mov    %esp,%ebp
+  802f65:	57                   	push   %edi
+  802f66:	56                   	push   %esi
+  802f67:	53                   	push   %ebx
+  802f68:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  802f6b:	e8 e8 f6 ff ff       	call   802658 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  802f70:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802f75:	85 c0                	test   %eax,%eax
+  802f77:	74 41                	je     802fba <page_share_paged_out+0x58>
+  802f79:	83 3d 10 e9 80 00 00 	cmpl   $0x0,0x80e910
+  802f80:	0f 84 fd 00 00 00    	je     803083 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  802f86:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802f8d:	00 00 00 
+  802f90:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  802f97:	00 00 00 
+  802f9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f9f:	eb 2c                	jmp    802fcd <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802fa1:	83 c3 04             	add    $0x4,%ebx
+  802fa4:	39 f3                	cmp    %esi,%ebx
+  802fa6:	74 1a                	je     802fc2 <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  802fa8:	8b 03                	mov    (%ebx),%eax
+  802faa:	a8 01                	test   $0x1,%al
+  802fac:	74 f3                	je     802fa1 <page_share_paged_out+0x3f>
+  802fae:	c1 e8 0c             	shr    $0xc,%eax
+  802fb1:	e8 2b f5 ff ff       	call   8024e1 <page_share_slot>
+  802fb6:	85 c0                	test   %eax,%eax
+  802fb8:	79 e7                	jns    802fa1 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  802fba:	83 c4 0c             	add    $0xc,%esp
+  802fbd:	5b                   	pop    %ebx
+  802fbe:	5e                   	pop    %esi
+  802fbf:	5f                   	pop    %edi
+  802fc0:	5d                   	pop    %ebp
+  802fc1:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  802fc2:	83 c7 04             	add    $0x4,%edi
+  802fc5:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  802fcb:	74 1b                	je     802fe8 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  802fcd:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  802fd2:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  802fd5:	f6 c3 01             	test   $0x1,%bl
+  802fd8:	74 e8                	je     802fc2 <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  802fda:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802fe0:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  802fe6:	eb bc                	jmp    802fa4 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802fe8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fed:	eb 11                	jmp    803000 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  802fef:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802ff5:	83 c3 01             	add    $0x1,%ebx
+  802ff8:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802ffe:	77 41                	ja     803041 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  803000:	89 d8                	mov    %ebx,%eax
+  803002:	c1 e8 0a             	shr    $0xa,%eax
+  803005:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80300c:	25 81 00 00 00       	and    $0x81,%eax
+  803011:	83 f8 01             	cmp    $0x1,%eax
+  803014:	75 d9                	jne    802fef <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803016:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80301d:	25 81 00 00 00       	and    $0x81,%eax
+  803022:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803027:	75 cc                	jne    802ff5 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803029:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803030:	c1 e8 0c             	shr    $0xc,%eax
+  803033:	e8 a9 f4 ff ff       	call   8024e1 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803038:	85 c0                	test   %eax,%eax
+  80303a:	79 b9                	jns    802ff5 <page_share_paged_out+0x93>
+  80303c:	e9 79 ff ff ff       	jmp    802fba <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803041:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803048:	75 13                	jne    80305d <page_share_paged_out+0xfb>
+  80304a:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  803051:	75 1d                	jne    803070 <page_share_paged_out+0x10e>
+	return 0;
+  803053:	b8 00 00 00 00       	mov    $0x0,%eax
+  803058:	e9 5d ff ff ff       	jmp    802fba <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80305d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803062:	e8 46 f4 ff ff       	call   8024ad <page_share_send>
+  803067:	85 c0                	test   %eax,%eax
+  803069:	79 df                	jns    80304a <page_share_paged_out+0xe8>
+  80306b:	e9 4a ff ff ff       	jmp    802fba <page_share_paged_out+0x58>
+  803070:	b8 01 00 00 00       	mov    $0x1,%eax
+  803075:	e8 33 f4 ff ff       	call   8024ad <page_share_send>
+  80307a:	85 c0                	test   %eax,%eax
+  80307c:	79 d5                	jns    803053 <page_share_paged_out+0xf1>
+  80307e:	e9 37 ff ff ff       	jmp    802fba <page_share_paged_out+0x58>
+		return 0;
+  803083:	b8 00 00 00 00       	mov    $0x0,%eax
+  803088:	e9 2d ff ff ff       	jmp    802fba <page_share_paged_out+0x58>
+
+0080308d <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  80308d:	55                   	push   %ebp
+  80308e:	89 e5                	mov    %esp,%ebp
+  803090:	56                   	push   %esi
+  803091:	53                   	push   %ebx
+  803092:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  803095:	e8 be f5 ff ff       	call   802658 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  80309a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  80309f:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8030a6:	0f 84 82 00 00 00    	je     80312e <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  8030ac:	83 ec 0c             	sub    $0xc,%esp
+  8030af:	68 00 10 00 00       	push   $0x1000
+  8030b4:	e8 84 11 00 00       	call   80423d <malloc>
+  8030b9:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  8030bb:	83 c4 0c             	add    $0xc,%esp
+  8030be:	6a 14                	push   $0x14
+  8030c0:	6a 00                	push   $0x0
+  8030c2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8030c5:	50                   	push   %eax
+  8030c6:	e8 61 d8 ff ff       	call   80092c <memset>
+  8030cb:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  8030ce:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  8030d3:	83 ec 0c             	sub    $0xc,%esp
+  8030d6:	6a 07                	push   $0x7
+  8030d8:	6a 01                	push   $0x1
+  8030da:	53                   	push   %ebx
+  8030db:	6a 03                	push   $0x3
+  8030dd:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8030e4:	e8 9d 18 00 00       	call   804986 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  8030e9:	8b 03                	mov    (%ebx),%eax
+  8030eb:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  8030ee:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030f1:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  8030f4:	8b 43 08             	mov    0x8(%ebx),%eax
+  8030f7:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  8030fa:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8030fd:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  803100:	8b 43 10             	mov    0x10(%ebx),%eax
+  803103:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803106:	83 c6 01             	add    $0x1,%esi
+  803109:	83 c4 20             	add    $0x20,%esp
+  80310c:	83 fe 02             	cmp    $0x2,%esi
+  80310f:	75 c2                	jne    8030d3 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  803111:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803114:	89 03                	mov    %eax,(%ebx)
+  803116:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803119:	89 43 04             	mov    %eax,0x4(%ebx)
+  80311c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80311f:	89 43 08             	mov    %eax,0x8(%ebx)
+  803122:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803125:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803128:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80312b:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  80312e:	89 d8                	mov    %ebx,%eax
+  803130:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803133:	5b                   	pop    %ebx
+  803134:	5e                   	pop    %esi
+  803135:	5d                   	pop    %ebp
+  803136:	c3                   	ret
+
+00803137 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803137:	55                   	push   %ebp
+  803138:	89 e5                	mov    %esp,%ebp
+  80313a:	53                   	push   %ebx
+  80313b:	83 ec 10             	sub    $0x10,%esp
+  80313e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  803141:	68 5d 52 80 00       	push   $0x80525d
+  803146:	e8 a9 d0 ff ff       	call   8001f4 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  80314b:	83 c4 08             	add    $0x8,%esp
+  80314e:	ff 33                	push   (%ebx)
+  803150:	68 74 53 80 00       	push   $0x805374
+  803155:	e8 9a d0 ff ff       	call   8001f4 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  80315a:	83 c4 08             	add    $0x8,%esp
+  80315d:	ff 73 04             	push   0x4(%ebx)
+  803160:	68 5f 52 80 00       	push   $0x80525f
+  803165:	e8 8a d0 ff ff       	call   8001f4 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  80316a:	83 c4 08             	add    $0x8,%esp
+  80316d:	ff 73 08             	push   0x8(%ebx)
+  803170:	68 94 53 80 00       	push   $0x805394
+  803175:	e8 7a d0 ff ff       	call   8001f4 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  80317a:	83 c4 08             	add    $0x8,%esp
+  80317d:	ff 73 0c             	push   0xc(%ebx)
+  803180:	68 b8 53 80 00       	push   $0x8053b8
+  803185:	e8 6a d0 ff ff       	call   8001f4 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  80318a:	83 c4 08             	add    $0x8,%esp
+  80318d:	ff 73 10             	push   0x10(%ebx)
+  803190:	68 dc 53 80 00       	push   $0x8053dc
+  803195:	e8 5a d0 ff ff       	call   8001f4 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  80319a:	83 c4 08             	add    $0x8,%esp
+  80319d:	ff 35 08 b0 80 00    	push   0x80b008
+  8031a3:	68 18 54 80 00       	push   $0x805418
+  8031a8:	e8 47 d0 ff ff       	call   8001f4 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  8031ad:	83 c4 08             	add    $0x8,%esp
+  8031b0:	ff 35 04 b0 80 00    	push   0x80b004
+  8031b6:	68 4c 54 80 00       	push   $0x80544c
+  8031bb:	e8 34 d0 ff ff       	call   8001f4 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  8031c0:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8031c5:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  8031c8:	8b 50 68             	mov    0x68(%eax),%edx
+  8031cb:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  8031ce:	51                   	push   %ecx
+  8031cf:	52                   	push   %edx
+  8031d0:	50                   	push   %eax
+  8031d1:	68 8c 54 80 00       	push   $0x80548c
+  8031d6:	e8 19 d0 ff ff       	call   8001f4 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  8031db:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8031e0:	8b 40 70             	mov    0x70(%eax),%eax
+  8031e3:	83 c4 18             	add    $0x18,%esp
+  8031e6:	50                   	push   %eax
+  8031e7:	68 c0 54 80 00       	push   $0x8054c0
+  8031ec:	e8 03 d0 ff ff       	call   8001f4 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  8031f1:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  8031f7:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  8031fd:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  803202:	51                   	push   %ecx
+  803203:	52                   	push   %edx
+  803204:	50                   	push   %eax
+  803205:	68 f0 54 80 00       	push   $0x8054f0
+  80320a:	e8 e5 cf ff ff       	call   8001f4 <cprintf>
+	cprintf("\n");
+  80320f:	83 c4 14             	add    $0x14,%esp
+  803212:	68 5d 52 80 00       	push   $0x80525d
+  803217:	e8 d8 cf ff ff       	call   8001f4 <cprintf>
+}
+  80321c:	83 c4 10             	add    $0x10,%esp
+  80321f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803222:	c9                   	leave
+  803223:	c3                   	ret
+
+00803224 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  803224:	55                   	push   %ebp
+  803225:	89 e5                	mov    %esp,%ebp
+  803227:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  80322a:	e8 5e fe ff ff       	call   80308d <get_paging_stats>
+  80322f:	83 ec 0c             	sub    $0xc,%esp
+  803232:	50                   	push   %eax
+  803233:	e8 ff fe ff ff       	call   803137 <print_paging_stats>
+}
+  803238:	83 c4 10             	add    $0x10,%esp
+  80323b:	c9                   	leave
+  80323c:	c3                   	ret
+
+0080323d <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  80323d:	55                   	push   %ebp
+  80323e:	89 e5                	mov    %esp,%ebp
+  803240:	53                   	push   %ebx
+  803241:	83 ec 04             	sub    $0x4,%esp
+  803244:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803247:	eb 13                	jmp    80325c <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803249:	83 ec 04             	sub    $0x4,%esp
+  80324c:	6a ff                	push   $0xffffffff
+  80324e:	53                   	push   %ebx
+  80324f:	68 00 f0 ff ee       	push   $0xeefff000
+  803254:	e8 4e df ff ff       	call   8011a7 <sys_futex_wait>
+  803259:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  80325c:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  803261:	39 d8                	cmp    %ebx,%eax
+  803263:	74 e4                	je     803249 <mem_pressure_wait+0xc>
+	return now;
+}
+  803265:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803268:	c9                   	leave
+  803269:	c3                   	ret
+
+0080326a <init_map_dir>:
+
+void
+init_map_dir()
+{
+  80326a:	55                   	push   %ebp
+  80326b:	89 e5                	mov    %esp,%ebp
+  80326d:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  803270:	68 dc 3e 80 00       	push   $0x803edc
+  803275:	e8 81 e0 ff ff       	call   8012fb <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  80327a:	c7 05 10 e9 80 00 00 	movl   $0xdeadb000,0x80e910
+  803281:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  803284:	83 c4 0c             	add    $0xc,%esp
+  803287:	68 07 02 00 00       	push   $0x207
+  80328c:	68 00 b0 ad de       	push   $0xdeadb000
+  803291:	6a 00                	push   $0x0
+  803293:	e8 36 da ff ff       	call   800cce <sys_page_alloc>
+  803298:	83 c4 10             	add    $0x10,%esp
+  80329b:	85 c0                	test   %eax,%eax
+  80329d:	78 0c                	js     8032ab <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  80329f:	e8 b4 f3 ff ff       	call   802658 <find_paging_env>
+	page_ring_ready();
+  8032a4:	e8 7f f2 ff ff       	call   802528 <page_ring_ready>
+}
+  8032a9:	c9                   	leave
+  8032aa:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  8032ab:	50                   	push   %eax
+  8032ac:	68 7d 52 80 00       	push   $0x80527d
+  8032b1:	68 13 05 00 00       	push   $0x513
+  8032b6:	68 36 52 80 00       	push   $0x805236
+  8032bb:	e8 59 ce ff ff       	call   800119 <_panic>
+
+008032c0 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  8032c0:	55                   	push   %ebp
+  8032c1:	89 e5                	mov    %esp,%ebp
+  8032c3:	57                   	push   %edi
+  8032c4:	56                   	push   %esi
+  8032c5:	53                   	push   %ebx
+  8032c6:	83 ec 0c             	sub    $0xc,%esp
+  8032c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  8032cc:	89 fa                	mov    %edi,%edx
+  8032ce:	c1 ea 16             	shr    $0x16,%edx
+  8032d1:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  8032d6:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  8032d9:	f6 06 01             	testb  $0x1,(%esi)
+  8032dc:	75 3e                	jne    80331c <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  8032de:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  8032e3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8032e7:	74 47                	je     803330 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  8032e9:	83 ec 0c             	sub    $0xc,%esp
+  8032ec:	6a 01                	push   $0x1
+  8032ee:	e8 f2 11 00 00       	call   8044e5 <va_alloc>
+  8032f3:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  8032f5:	83 c4 10             	add    $0x10,%esp
+  8032f8:	85 c0                	test   %eax,%eax
+  8032fa:	74 34                	je     803330 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  8032fc:	6a 00                	push   $0x0
+  8032fe:	68 07 02 00 00       	push   $0x207
+  803303:	50                   	push   %eax
+  803304:	6a 00                	push   $0x0
+  803306:	e8 df 02 00 00       	call   8035ea <page_alloc>
+  80330b:	83 c4 10             	add    $0x10,%esp
+  80330e:	85 c0                	test   %eax,%eax
+  803310:	78 28                	js     80333a <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  803312:	f6 06 01             	testb  $0x1,(%esi)
+  803315:	75 38                	jne    80334f <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803317:	83 cb 01             	or     $0x1,%ebx
+  80331a:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  80331c:	89 f8                	mov    %edi,%eax
+  80331e:	c1 e8 0a             	shr    $0xa,%eax
+  803321:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803326:	8b 1e                	mov    (%esi),%ebx
+  803328:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  80332e:	01 c3                	add    %eax,%ebx
+}
+  803330:	89 d8                	mov    %ebx,%eax
+  803332:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803335:	5b                   	pop    %ebx
+  803336:	5e                   	pop    %esi
+  803337:	5f                   	pop    %edi
+  803338:	5d                   	pop    %ebp
+  803339:	c3                   	ret
+			va_free(page, 1);
+  80333a:	83 ec 08             	sub    $0x8,%esp
+  80333d:	6a 01                	push   $0x1
+  80333f:	53                   	push   %ebx
+  803340:	e8 d8 12 00 00       	call   80461d <va_free>
+			return NULL;
+  803345:	83 c4 10             	add    $0x10,%esp
+  803348:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80334d:	eb e1                	jmp    803330 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  80334f:	83 ec 08             	sub    $0x8,%esp
+  803352:	53                   	push   %ebx
+  803353:	6a 00                	push   $0x0
+  803355:	e8 f9 d9 ff ff       	call   800d53 <sys_page_unmap>
+			va_free(page, 1);
+  80335a:	83 c4 08             	add    $0x8,%esp
+  80335d:	6a 01                	push   $0x1
+  80335f:	53                   	push   %ebx
+  803360:	e8 b8 12 00 00       	call   80461d <va_free>
+  803365:	83 c4 10             	add    $0x10,%esp
+  803368:	eb b2                	jmp    80331c <umapdir_walk+0x5c>
+
+0080336a <page_out>:
+{
+  80336a:	55                   	push   %ebp
+  80336b:	89 e5                	mov    %esp,%ebp
+  80336d:	57                   	push   %edi
+  80336e:	56                   	push   %esi
+  80336f:	53                   	push   %ebx
+  803370:	83 ec 5c             	sub    $0x5c,%esp
+  803373:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803376:	e8 dd f2 ff ff       	call   802658 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  80337b:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803380:	85 c0                	test   %eax,%eax
+  803382:	74 1e                	je     8033a2 <page_out+0x38>
+  803384:	83 ec 0c             	sub    $0xc,%esp
+  803387:	6a 00                	push   $0x0
+  803389:	6a 00                	push   $0x0
+  80338b:	6a 00                	push   $0x0
+  80338d:	6a 08                	push   $0x8
+  80338f:	50                   	push   %eax
+  803390:	e8 f1 15 00 00       	call   804986 <ipc_call>
+  803395:	89 c3                	mov    %eax,%ebx
+  803397:	83 c4 20             	add    $0x20,%esp
+  80339a:	85 c0                	test   %eax,%eax
+  80339c:	0f 84 ac 00 00 00    	je     80344e <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  8033a2:	83 ec 08             	sub    $0x8,%esp
+  8033a5:	ff 75 0c             	push   0xc(%ebp)
+  8033a8:	57                   	push   %edi
+  8033a9:	e8 e9 f9 ff ff       	call   802d97 <get_page_choice>
+  8033ae:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  8033b0:	83 c4 10             	add    $0x10,%esp
+  8033b3:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8033b8:	0f 84 18 02 00 00    	je     8035d6 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  8033be:	e8 78 ee ff ff       	call   80223b <page_is_clean>
+  8033c3:	84 c0                	test   %al,%al
+  8033c5:	0f 85 8c 00 00 00    	jne    803457 <page_out+0xed>
+	if (pagingenv == 0)
+  8033cb:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8033d2:	0f 84 08 02 00 00    	je     8035e0 <page_out+0x276>
+	if (page_ring_ready())
+  8033d8:	e8 4b f1 ff ff       	call   802528 <page_ring_ready>
+  8033dd:	89 c3                	mov    %eax,%ebx
+  8033df:	85 c0                	test   %eax,%eax
+  8033e1:	0f 85 89 00 00 00    	jne    803470 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  8033e7:	83 ec 0c             	sub    $0xc,%esp
+  8033ea:	6a 05                	push   $0x5
+  8033ec:	6a 01                	push   $0x1
+  8033ee:	56                   	push   %esi
+  8033ef:	6a 01                	push   $0x1
+  8033f1:	ff 35 40 b0 80 00    	push   0x80b040
+  8033f7:	e8 8a 15 00 00       	call   804986 <ipc_call>
+  8033fc:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  8033fe:	83 c4 20             	add    $0x20,%esp
+  803401:	85 c0                	test   %eax,%eax
+  803403:	0f 88 b8 01 00 00    	js     8035c1 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803409:	89 f0                	mov    %esi,%eax
+  80340b:	c1 e8 0c             	shr    $0xc,%eax
+  80340e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803415:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803418:	83 ec 08             	sub    $0x8,%esp
+  80341b:	56                   	push   %esi
+  80341c:	6a 00                	push   $0x0
+  80341e:	e8 30 d9 ff ff       	call   800d53 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803423:	83 c4 08             	add    $0x8,%esp
+  803426:	6a 01                	push   $0x1
+  803428:	56                   	push   %esi
+  803429:	e8 92 fe ff ff       	call   8032c0 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  80342e:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803431:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803437:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  80343a:	09 fe                	or     %edi,%esi
+  80343c:	83 ce 01             	or     $0x1,%esi
+  80343f:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803441:	83 c4 10             	add    $0x10,%esp
+}
+  803444:	89 d8                	mov    %ebx,%eax
+  803446:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803449:	5b                   	pop    %ebx
+  80344a:	5e                   	pop    %esi
+  80344b:	5f                   	pop    %edi
+  80344c:	5d                   	pop    %ebp
+  80344d:	c3                   	ret
+		num_page_reclaims++;
+  80344e:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  803455:	eb ed                	jmp    803444 <page_out+0xda>
+		num_page_drops++;
+  803457:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  80345e:	83 ec 08             	sub    $0x8,%esp
+  803461:	56                   	push   %esi
+  803462:	6a 00                	push   $0x0
+  803464:	e8 ea d8 ff ff       	call   800d53 <sys_page_unmap>
+  803469:	89 c3                	mov    %eax,%ebx
+  80346b:	83 c4 10             	add    $0x10,%esp
+  80346e:	eb d4                	jmp    803444 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803470:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803472:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803477:	2d 00 10 00 00       	sub    $0x1000,%eax
+  80347c:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  80347f:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803481:	83 c0 08             	add    $0x8,%eax
+  803484:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803487:	b8 07 00 00 00       	mov    $0x7,%eax
+  80348c:	e8 e5 ef ff ff       	call   802476 <page_ring_reserve>
+	first = ring->sq_tail;
+  803491:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803496:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803499:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  80349e:	83 ec 04             	sub    $0x4,%esp
+  8034a1:	68 00 10 00 00       	push   $0x1000
+  8034a6:	56                   	push   %esi
+  8034a7:	89 d8                	mov    %ebx,%eax
+  8034a9:	c1 e0 0c             	shl    $0xc,%eax
+  8034ac:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  8034b1:	50                   	push   %eax
+  8034b2:	e8 0c d5 ff ff       	call   8009c3 <memcpy>
+		vas[n] = va;
+  8034b7:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  8034bb:	89 d9                	mov    %ebx,%ecx
+  8034bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034c2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034c7:	e8 de ee ff ff       	call   8023aa <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  8034cc:	8d 43 01             	lea    0x1(%ebx),%eax
+  8034cf:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  8034d2:	83 c4 10             	add    $0x10,%esp
+  8034d5:	83 fb 06             	cmp    $0x6,%ebx
+  8034d8:	74 62                	je     80353c <page_out+0x1d2>
+  8034da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8034dd:	eb 15                	jmp    8034f4 <page_out+0x18a>
+			num_page_drops++;
+  8034df:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  8034e6:	83 ec 08             	sub    $0x8,%esp
+  8034e9:	56                   	push   %esi
+  8034ea:	6a 00                	push   $0x0
+  8034ec:	e8 62 d8 ff ff       	call   800d53 <sys_page_unmap>
+  8034f1:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  8034f4:	83 ec 08             	sub    $0x8,%esp
+  8034f7:	53                   	push   %ebx
+  8034f8:	57                   	push   %edi
+  8034f9:	e8 99 f8 ff ff       	call   802d97 <get_page_choice>
+  8034fe:	89 c6                	mov    %eax,%esi
+  803500:	83 c4 10             	add    $0x10,%esp
+  803503:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803508:	74 32                	je     80353c <page_out+0x1d2>
+  80350a:	e8 2c ed ff ff       	call   80223b <page_is_clean>
+  80350f:	84 c0                	test   %al,%al
+  803511:	75 cc                	jne    8034df <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803513:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803516:	39 c6                	cmp    %eax,%esi
+  803518:	72 07                	jb     803521 <page_out+0x1b7>
+  80351a:	8b 45 98             	mov    -0x68(%ebp),%eax
+  80351d:	39 c6                	cmp    %eax,%esi
+  80351f:	72 1b                	jb     80353c <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803521:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803526:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803529:	eb 03                	jmp    80352e <page_out+0x1c4>
+  80352b:	83 c3 01             	add    $0x1,%ebx
+  80352e:	39 da                	cmp    %ebx,%edx
+  803530:	0f 84 68 ff ff ff    	je     80349e <page_out+0x134>
+  803536:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  80353a:	75 ef                	jne    80352b <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  80353c:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  80353f:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803542:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803545:	e8 a6 ee ff ff       	call   8023f0 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  80354a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80354f:	eb 42                	jmp    803593 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803551:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803555:	89 f8                	mov    %edi,%eax
+  803557:	c1 e8 0c             	shr    $0xc,%eax
+  80355a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803561:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803564:	83 ec 08             	sub    $0x8,%esp
+  803567:	57                   	push   %edi
+  803568:	6a 00                	push   $0x0
+  80356a:	e8 e4 d7 ff ff       	call   800d53 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  80356f:	83 c4 08             	add    $0x8,%esp
+  803572:	6a 01                	push   $0x1
+  803574:	57                   	push   %edi
+  803575:	e8 46 fd ff ff       	call   8032c0 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  80357a:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  80357d:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803583:	c1 e6 0c             	shl    $0xc,%esi
+  803586:	09 d6                	or     %edx,%esi
+  803588:	83 ce 01             	or     $0x1,%esi
+  80358b:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  80358d:	83 c3 01             	add    $0x1,%ebx
+  803590:	83 c4 10             	add    $0x10,%esp
+  803593:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803596:	39 c3                	cmp    %eax,%ebx
+  803598:	74 1d                	je     8035b7 <page_out+0x24d>
+		if (res[i] < 0)
+  80359a:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  80359e:	85 f6                	test   %esi,%esi
+  8035a0:	79 af                	jns    803551 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  8035a2:	56                   	push   %esi
+  8035a3:	68 20 55 80 00       	push   $0x805520
+  8035a8:	68 d1 02 00 00       	push   $0x2d1
+  8035ad:	68 36 52 80 00       	push   $0x805236
+  8035b2:	e8 62 cb ff ff       	call   800119 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  8035b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035bc:	e9 83 fe ff ff       	jmp    803444 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  8035c1:	50                   	push   %eax
+  8035c2:	68 20 55 80 00       	push   $0x805520
+  8035c7:	68 0a 03 00 00       	push   $0x30a
+  8035cc:	68 36 52 80 00       	push   $0x805236
+  8035d1:	e8 43 cb ff ff       	call   800119 <_panic>
+		return -E_NO_MEM;
+  8035d6:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  8035db:	e9 64 fe ff ff       	jmp    803444 <page_out+0xda>
+		return -E_PAGING;
+  8035e0:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8035e5:	e9 5a fe ff ff       	jmp    803444 <page_out+0xda>
+
+008035ea <page_alloc>:
+{
+  8035ea:	55                   	push   %ebp
+  8035eb:	89 e5                	mov    %esp,%ebp
+  8035ed:	57                   	push   %edi
+  8035ee:	56                   	push   %esi
+  8035ef:	53                   	push   %ebx
+  8035f0:	83 ec 0c             	sub    $0xc,%esp
+  8035f3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035f6:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  8035f9:	83 3d 10 e9 80 00 00 	cmpl   $0x0,0x80e910
+  803600:	74 34                	je     803636 <page_alloc+0x4c>
+	if (check_mte)
+  803602:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803606:	75 35                	jne    80363d <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803608:	83 ec 04             	sub    $0x4,%esp
+  80360b:	ff 75 10             	push   0x10(%ebp)
+  80360e:	56                   	push   %esi
+  80360f:	57                   	push   %edi
+  803610:	e8 b9 d6 ff ff       	call   800cce <sys_page_alloc>
+  803615:	89 c3                	mov    %eax,%ebx
+  803617:	83 c4 10             	add    $0x10,%esp
+  80361a:	85 c0                	test   %eax,%eax
+  80361c:	79 52                	jns    803670 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  80361e:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803621:	75 52                	jne    803675 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803623:	83 ec 08             	sub    $0x8,%esp
+  803626:	56                   	push   %esi
+  803627:	57                   	push   %edi
+  803628:	e8 3d fd ff ff       	call   80336a <page_out>
+  80362d:	83 c4 10             	add    $0x10,%esp
+  803630:	85 c0                	test   %eax,%eax
+  803632:	79 d4                	jns    803608 <page_alloc+0x1e>
+  803634:	eb 3f                	jmp    803675 <page_alloc+0x8b>
+		init_map_dir();
+  803636:	e8 2f fc ff ff       	call   80326a <init_map_dir>
+  80363b:	eb c5                	jmp    803602 <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  80363d:	83 ec 08             	sub    $0x8,%esp
+  803640:	6a 00                	push   $0x0
+  803642:	56                   	push   %esi
+  803643:	e8 78 fc ff ff       	call   8032c0 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803648:	83 c4 10             	add    $0x10,%esp
+  80364b:	85 c0                	test   %eax,%eax
+  80364d:	74 b9                	je     803608 <page_alloc+0x1e>
+  80364f:	8b 10                	mov    (%eax),%edx
+  803651:	f6 c2 01             	test   $0x1,%dl
+  803654:	74 b2                	je     803608 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803656:	83 ec 08             	sub    $0x8,%esp
+  803659:	56                   	push   %esi
+  80365a:	52                   	push   %edx
+  80365b:	50                   	push   %eax
+  80365c:	68 44 55 80 00       	push   $0x805544
+  803661:	68 34 03 00 00       	push   $0x334
+  803666:	68 36 52 80 00       	push   $0x805236
+  80366b:	e8 a9 ca ff ff       	call   800119 <_panic>
+	return 0;
+  803670:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803675:	89 d8                	mov    %ebx,%eax
+  803677:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80367a:	5b                   	pop    %ebx
+  80367b:	5e                   	pop    %esi
+  80367c:	5f                   	pop    %edi
+  80367d:	5d                   	pop    %ebp
+  80367e:	c3                   	ret
+
+0080367f <page_adopt>:
+{
+  80367f:	55                   	push   %ebp
+  803680:	89 e5                	mov    %esp,%ebp
+  803682:	56                   	push   %esi
+  803683:	53                   	push   %ebx
+  803684:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803686:	c1 e8 16             	shr    $0x16,%eax
+  803689:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803690:	25 81 00 00 00       	and    $0x81,%eax
+  803695:	83 f8 01             	cmp    $0x1,%eax
+  803698:	75 53                	jne    8036ed <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  80369a:	89 d8                	mov    %ebx,%eax
+  80369c:	c1 e8 0c             	shr    $0xc,%eax
+  80369f:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  8036a6:	89 f2                	mov    %esi,%edx
+  8036a8:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  8036ae:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  8036b3:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  8036b9:	75 37                	jne    8036f2 <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  8036bb:	83 ec 08             	sub    $0x8,%esp
+  8036be:	6a 01                	push   $0x1
+  8036c0:	53                   	push   %ebx
+  8036c1:	e8 fa fb ff ff       	call   8032c0 <umapdir_walk>
+  8036c6:	83 c4 10             	add    $0x10,%esp
+  8036c9:	85 c0                	test   %eax,%eax
+  8036cb:	74 2c                	je     8036f9 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  8036cd:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  8036d3:	83 ce 01             	or     $0x1,%esi
+  8036d6:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  8036d8:	83 ec 08             	sub    $0x8,%esp
+  8036db:	53                   	push   %ebx
+  8036dc:	6a 00                	push   $0x0
+  8036de:	e8 70 d6 ff ff       	call   800d53 <sys_page_unmap>
+	return 1;
+  8036e3:	83 c4 10             	add    $0x10,%esp
+  8036e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036eb:	eb 05                	jmp    8036f2 <page_adopt+0x73>
+		return 0;
+  8036ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036f5:	5b                   	pop    %ebx
+  8036f6:	5e                   	pop    %esi
+  8036f7:	5d                   	pop    %ebp
+  8036f8:	c3                   	ret
+		return -E_NO_MEM;
+  8036f9:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8036fe:	eb f2                	jmp    8036f2 <page_adopt+0x73>
+
+00803700 <page_forget>:
+{
+  803700:	55                   	push   %ebp
+  803701:	89 e5                	mov    %esp,%ebp
+  803703:	53                   	push   %ebx
+  803704:	83 ec 04             	sub    $0x4,%esp
+  803707:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803709:	e8 4a ef ff ff       	call   802658 <find_paging_env>
+	if (pagingenv == 0)
+  80370e:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803715:	74 39                	je     803750 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803717:	89 d8                	mov    %ebx,%eax
+  803719:	c1 e8 16             	shr    $0x16,%eax
+  80371c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803723:	25 81 00 00 00       	and    $0x81,%eax
+  803728:	83 f8 01             	cmp    $0x1,%eax
+  80372b:	74 28                	je     803755 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  80372d:	83 3d 10 e9 80 00 00 	cmpl   $0x0,0x80e910
+  803734:	74 1a                	je     803750 <page_forget+0x50>
+  803736:	83 ec 08             	sub    $0x8,%esp
+  803739:	6a 00                	push   $0x0
+  80373b:	53                   	push   %ebx
+  80373c:	e8 7f fb ff ff       	call   8032c0 <umapdir_walk>
+  803741:	89 c3                	mov    %eax,%ebx
+  803743:	83 c4 10             	add    $0x10,%esp
+  803746:	85 c0                	test   %eax,%eax
+  803748:	74 06                	je     803750 <page_forget+0x50>
+  80374a:	8b 00                	mov    (%eax),%eax
+  80374c:	a8 01                	test   $0x1,%al
+  80374e:	75 2b                	jne    80377b <page_forget+0x7b>
+}
+  803750:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803753:	c9                   	leave
+  803754:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803755:	89 d8                	mov    %ebx,%eax
+  803757:	c1 e8 0c             	shr    $0xc,%eax
+  80375a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803761:	89 c2                	mov    %eax,%edx
+  803763:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803769:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  80376f:	75 bc                	jne    80372d <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803771:	c1 e8 0c             	shr    $0xc,%eax
+  803774:	e8 5c ee ff ff       	call   8025d5 <page_remove_slot>
+		return;
+  803779:	eb d5                	jmp    803750 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  80377b:	c1 e8 0c             	shr    $0xc,%eax
+  80377e:	e8 52 ee ff ff       	call   8025d5 <page_remove_slot>
+	*mte = 0;
+  803783:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803789:	eb c5                	jmp    803750 <page_forget+0x50>
+
+0080378b <page_unmap>:
+{
+  80378b:	55                   	push   %ebp
+  80378c:	89 e5                	mov    %esp,%ebp
+  80378e:	57                   	push   %edi
+  80378f:	56                   	push   %esi
+  803790:	53                   	push   %ebx
+  803791:	83 ec 0c             	sub    $0xc,%esp
+  803794:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803797:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  80379a:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  80379f:	8b 40 48             	mov    0x48(%eax),%eax
+  8037a2:	85 db                	test   %ebx,%ebx
+  8037a4:	0f 8e b4 00 00 00    	jle    80385e <page_unmap+0xd3>
+  8037aa:	39 d8                	cmp    %ebx,%eax
+  8037ac:	0f 84 ac 00 00 00    	je     80385e <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  8037b2:	83 ec 08             	sub    $0x8,%esp
+  8037b5:	57                   	push   %edi
+  8037b6:	53                   	push   %ebx
+  8037b7:	e8 97 d5 ff ff       	call   800d53 <sys_page_unmap>
+  8037bc:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  8037be:	e8 95 ee ff ff       	call   802658 <find_paging_env>
+	if (pagingenv == 0)
+  8037c3:	83 c4 10             	add    $0x10,%esp
+  8037c6:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8037cd:	0f 84 a1 00 00 00    	je     803874 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8037d3:	83 ec 0c             	sub    $0xc,%esp
+  8037d6:	6a 05                	push   $0x5
+  8037d8:	68 00 00 40 00       	push   $0x400000
+  8037dd:	6a 00                	push   $0x0
+  8037df:	68 00 b0 ad de       	push   $0xdeadb000
+  8037e4:	53                   	push   %ebx
+  8037e5:	e8 27 d5 ff ff       	call   800d11 <sys_page_map>
+  8037ea:	83 c4 20             	add    $0x20,%esp
+  8037ed:	85 c0                	test   %eax,%eax
+  8037ef:	0f 88 89 00 00 00    	js     80387e <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  8037f5:	89 f8                	mov    %edi,%eax
+  8037f7:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8037fa:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803801:	a8 01                	test   $0x1,%al
+  803803:	74 6f                	je     803874 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803805:	83 ec 0c             	sub    $0xc,%esp
+  803808:	6a 05                	push   $0x5
+  80380a:	68 00 00 40 00       	push   $0x400000
+  80380f:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803811:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803816:	50                   	push   %eax
+  803817:	53                   	push   %ebx
+  803818:	e8 f4 d4 ff ff       	call   800d11 <sys_page_map>
+  80381d:	83 c4 20             	add    $0x20,%esp
+  803820:	85 c0                	test   %eax,%eax
+  803822:	78 6f                	js     803893 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803824:	c1 ef 0c             	shr    $0xc,%edi
+  803827:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  80382d:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803834:	01 
+  803835:	74 3d                	je     803874 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803837:	83 ec 08             	sub    $0x8,%esp
+  80383a:	68 00 00 40 00       	push   $0x400000
+  80383f:	6a 00                	push   $0x0
+  803841:	e8 0d d5 ff ff       	call   800d53 <sys_page_unmap>
+  803846:	83 c4 10             	add    $0x10,%esp
+  803849:	85 c0                	test   %eax,%eax
+  80384b:	78 5b                	js     8038a8 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  80384d:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803854:	c1 e8 0c             	shr    $0xc,%eax
+  803857:	e8 79 ed ff ff       	call   8025d5 <page_remove_slot>
+	return r;
+  80385c:	eb 16                	jmp    803874 <page_unmap+0xe9>
+		page_forget(va);
+  80385e:	89 f8                	mov    %edi,%eax
+  803860:	e8 9b fe ff ff       	call   803700 <page_forget>
+		return sys_page_unmap(envid, va);
+  803865:	83 ec 08             	sub    $0x8,%esp
+  803868:	57                   	push   %edi
+  803869:	53                   	push   %ebx
+  80386a:	e8 e4 d4 ff ff       	call   800d53 <sys_page_unmap>
+  80386f:	89 c6                	mov    %eax,%esi
+  803871:	83 c4 10             	add    $0x10,%esp
+}
+  803874:	89 f0                	mov    %esi,%eax
+  803876:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803879:	5b                   	pop    %ebx
+  80387a:	5e                   	pop    %esi
+  80387b:	5f                   	pop    %edi
+  80387c:	5d                   	pop    %ebp
+  80387d:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  80387e:	50                   	push   %eax
+  80387f:	68 80 55 80 00       	push   $0x805580
+  803884:	68 e4 03 00 00       	push   $0x3e4
+  803889:	68 36 52 80 00       	push   $0x805236
+  80388e:	e8 86 c8 ff ff       	call   800119 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803893:	50                   	push   %eax
+  803894:	68 ac 55 80 00       	push   $0x8055ac
+  803899:	68 ea 03 00 00       	push   $0x3ea
+  80389e:	68 36 52 80 00       	push   $0x805236
+  8038a3:	e8 71 c8 ff ff       	call   800119 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  8038a8:	50                   	push   %eax
+  8038a9:	68 d8 55 80 00       	push   $0x8055d8
+  8038ae:	68 ef 03 00 00       	push   $0x3ef
+  8038b3:	68 36 52 80 00       	push   $0x805236
+  8038b8:	e8 5c c8 ff ff       	call   800119 <_panic>
+
+008038bd <page_unmap_range>:
+{
+  8038bd:	55                   	push   %ebp
+  8038be:	89 e5                	mov    %esp,%ebp
+  8038c0:	57                   	push   %edi
+  8038c1:	56                   	push   %esi
+  8038c2:	53                   	push   %ebx
+  8038c3:	83 ec 0c             	sub    $0xc,%esp
+  8038c6:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  8038c9:	e8 8a ed ff ff       	call   802658 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  8038ce:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8038d3:	8b 40 48             	mov    0x48(%eax),%eax
+  8038d6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8038da:	7e 38                	jle    803914 <page_unmap_range+0x57>
+  8038dc:	3b 45 08             	cmp    0x8(%ebp),%eax
+  8038df:	74 33                	je     803914 <page_unmap_range+0x57>
+  8038e1:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8038e8:	74 2a                	je     803914 <page_unmap_range+0x57>
+  8038ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  8038ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8038f2:	39 fe                	cmp    %edi,%esi
+  8038f4:	74 56                	je     80394c <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  8038f6:	83 ec 08             	sub    $0x8,%esp
+  8038f9:	53                   	push   %ebx
+  8038fa:	ff 75 08             	push   0x8(%ebp)
+  8038fd:	e8 89 fe ff ff       	call   80378b <page_unmap>
+  803902:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803908:	83 c4 10             	add    $0x10,%esp
+  80390b:	85 c0                	test   %eax,%eax
+  80390d:	78 35                	js     803944 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  80390f:	83 c6 01             	add    $0x1,%esi
+  803912:	eb de                	jmp    8038f2 <page_unmap_range+0x35>
+  803914:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803917:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80391c:	eb 10                	jmp    80392e <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  80391e:	89 f0                	mov    %esi,%eax
+  803920:	e8 db fd ff ff       	call   803700 <page_forget>
+		for (i = 0; i < npages; i++)
+  803925:	83 c3 01             	add    $0x1,%ebx
+  803928:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80392e:	39 fb                	cmp    %edi,%ebx
+  803930:	75 ec                	jne    80391e <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  803932:	83 ec 04             	sub    $0x4,%esp
+  803935:	57                   	push   %edi
+  803936:	ff 75 0c             	push   0xc(%ebp)
+  803939:	ff 75 08             	push   0x8(%ebp)
+  80393c:	e8 26 d5 ff ff       	call   800e67 <sys_page_unmap_range>
+  803941:	83 c4 10             	add    $0x10,%esp
+}
+  803944:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803947:	5b                   	pop    %ebx
+  803948:	5e                   	pop    %esi
+  803949:	5f                   	pop    %edi
+  80394a:	5d                   	pop    %ebp
+  80394b:	c3                   	ret
+	return 0;
+  80394c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803951:	eb f1                	jmp    803944 <page_unmap_range+0x87>
+
+00803953 <page_alloc_range>:
+{
+  803953:	55                   	push   %ebp
+  803954:	89 e5                	mov    %esp,%ebp
+  803956:	57                   	push   %edi
+  803957:	56                   	push   %esi
+  803958:	53                   	push   %ebx
+  803959:	83 ec 1c             	sub    $0x1c,%esp
+  80395c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80395f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  803962:	83 3d 10 e9 80 00 00 	cmpl   $0x0,0x80e910
+  803969:	74 14                	je     80397f <page_alloc_range+0x2c>
+	if (check_mte)
+  80396b:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80396f:	74 66                	je     8039d7 <page_alloc_range+0x84>
+  803971:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  803973:	b8 00 00 00 00       	mov    $0x0,%eax
+  803978:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  80397b:	89 c7                	mov    %eax,%edi
+  80397d:	eb 10                	jmp    80398f <page_alloc_range+0x3c>
+		init_map_dir();
+  80397f:	e8 e6 f8 ff ff       	call   80326a <init_map_dir>
+  803984:	eb e5                	jmp    80396b <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803986:	83 c7 01             	add    $0x1,%edi
+  803989:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80398f:	39 df                	cmp    %ebx,%edi
+  803991:	74 38                	je     8039cb <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  803993:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803996:	83 ec 08             	sub    $0x8,%esp
+  803999:	6a 00                	push   $0x0
+  80399b:	56                   	push   %esi
+  80399c:	e8 1f f9 ff ff       	call   8032c0 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  8039a1:	83 c4 10             	add    $0x10,%esp
+  8039a4:	85 c0                	test   %eax,%eax
+  8039a6:	74 de                	je     803986 <page_alloc_range+0x33>
+  8039a8:	8b 10                	mov    (%eax),%edx
+  8039aa:	f6 c2 01             	test   $0x1,%dl
+  8039ad:	74 d7                	je     803986 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  8039af:	83 ec 08             	sub    $0x8,%esp
+  8039b2:	ff 75 e4             	push   -0x1c(%ebp)
+  8039b5:	52                   	push   %edx
+  8039b6:	50                   	push   %eax
+  8039b7:	68 44 55 80 00       	push   $0x805544
+  8039bc:	68 0b 04 00 00       	push   $0x40b
+  8039c1:	68 36 52 80 00       	push   $0x805236
+  8039c6:	e8 4e c7 ff ff       	call   800119 <_panic>
+  8039cb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8039ce:	eb 07                	jmp    8039d7 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  8039d0:	c1 e0 0c             	shl    $0xc,%eax
+  8039d3:	01 c7                	add    %eax,%edi
+			npages -= r;
+  8039d5:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  8039d7:	85 db                	test   %ebx,%ebx
+  8039d9:	74 30                	je     803a0b <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  8039db:	ff 75 14             	push   0x14(%ebp)
+  8039de:	53                   	push   %ebx
+  8039df:	57                   	push   %edi
+  8039e0:	ff 75 08             	push   0x8(%ebp)
+  8039e3:	e8 11 d4 ff ff       	call   800df9 <sys_page_alloc_range>
+  8039e8:	89 c6                	mov    %eax,%esi
+  8039ea:	83 c4 10             	add    $0x10,%esp
+  8039ed:	85 c0                	test   %eax,%eax
+  8039ef:	7f df                	jg     8039d0 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  8039f1:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8039f4:	75 1a                	jne    803a10 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  8039f6:	83 ec 08             	sub    $0x8,%esp
+  8039f9:	57                   	push   %edi
+  8039fa:	ff 75 08             	push   0x8(%ebp)
+  8039fd:	e8 68 f9 ff ff       	call   80336a <page_out>
+  803a02:	83 c4 10             	add    $0x10,%esp
+  803a05:	85 c0                	test   %eax,%eax
+  803a07:	79 ce                	jns    8039d7 <page_alloc_range+0x84>
+  803a09:	eb 05                	jmp    803a10 <page_alloc_range+0xbd>
+	return 0;
+  803a0b:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803a10:	89 f0                	mov    %esi,%eax
+  803a12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a15:	5b                   	pop    %ebx
+  803a16:	5e                   	pop    %esi
+  803a17:	5f                   	pop    %edi
+  803a18:	5d                   	pop    %ebp
+  803a19:	c3                   	ret
+
+00803a1a <page_in>:
+{
+  803a1a:	55                   	push   %ebp
+  803a1b:	89 e5                	mov    %esp,%ebp
+  803a1d:	57                   	push   %edi
+  803a1e:	56                   	push   %esi
+  803a1f:	53                   	push   %ebx
+  803a20:	83 ec 3c             	sub    $0x3c,%esp
+  803a23:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  803a26:	e8 2d ec ff ff       	call   802658 <find_paging_env>
+	if (pagingenv == 0)
+  803a2b:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803a32:	0f 84 09 02 00 00    	je     803c41 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  803a38:	83 ec 08             	sub    $0x8,%esp
+  803a3b:	6a 00                	push   $0x0
+  803a3d:	56                   	push   %esi
+  803a3e:	e8 7d f8 ff ff       	call   8032c0 <umapdir_walk>
+  803a43:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803a45:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803a4b:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  803a4e:	83 c4 10             	add    $0x10,%esp
+  803a51:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803a55:	74 0d                	je     803a64 <page_in+0x4a>
+  803a57:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803a5c:	8b 40 48             	mov    0x48(%eax),%eax
+  803a5f:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803a62:	75 06                	jne    803a6a <page_in+0x50>
+  803a64:	8b 03                	mov    (%ebx),%eax
+  803a66:	a8 02                	test   $0x2,%al
+  803a68:	75 63                	jne    803acd <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  803a6a:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803a6c:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803a6e:	89 f0                	mov    %esi,%eax
+  803a70:	25 06 0e 00 00       	and    $0xe06,%eax
+  803a75:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803a78:	50                   	push   %eax
+  803a79:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803a7c:	57                   	push   %edi
+  803a7d:	ff 75 08             	push   0x8(%ebp)
+  803a80:	e8 65 fb ff ff       	call   8035ea <page_alloc>
+  803a85:	83 c4 10             	add    $0x10,%esp
+  803a88:	85 c0                	test   %eax,%eax
+  803a8a:	78 39                	js     803ac5 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  803a8c:	89 f0                	mov    %esi,%eax
+  803a8e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803a91:	83 ec 0c             	sub    $0xc,%esp
+  803a94:	6a 07                	push   $0x7
+  803a96:	6a 01                	push   $0x1
+  803a98:	57                   	push   %edi
+  803a99:	c1 e0 04             	shl    $0x4,%eax
+  803a9c:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803a9d:	c1 ee 1c             	shr    $0x1c,%esi
+  803aa0:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803aa3:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803aaa:	e8 d7 0e 00 00       	call   804986 <ipc_call>
+  803aaf:	83 c4 20             	add    $0x20,%esp
+  803ab2:	85 c0                	test   %eax,%eax
+  803ab4:	0f 88 72 01 00 00    	js     803c2c <page_in+0x212>
+	*mte = 0;
+  803aba:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  803ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ac5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ac8:	5b                   	pop    %ebx
+  803ac9:	5e                   	pop    %esi
+  803aca:	5f                   	pop    %edi
+  803acb:	5d                   	pop    %ebp
+  803acc:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803acd:	25 06 0e 00 00       	and    $0xe06,%eax
+  803ad2:	83 c8 01             	or     $0x1,%eax
+  803ad5:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  803ad8:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803adb:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  803ade:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  803ae4:	be 01 00 00 00       	mov    $0x1,%esi
+  803ae9:	eb 46                	jmp    803b31 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  803aeb:	83 ec 08             	sub    $0x8,%esp
+  803aee:	6a 00                	push   $0x0
+  803af0:	51                   	push   %ecx
+  803af1:	e8 ca f7 ff ff       	call   8032c0 <umapdir_walk>
+  803af6:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  803afa:	83 c4 10             	add    $0x10,%esp
+  803afd:	85 c0                	test   %eax,%eax
+  803aff:	74 66                	je     803b67 <page_in+0x14d>
+  803b01:	8b 00                	mov    (%eax),%eax
+  803b03:	a8 01                	test   $0x1,%al
+  803b05:	74 60                	je     803b67 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  803b07:	89 c2                	mov    %eax,%edx
+  803b09:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  803b0f:	83 ca 01             	or     $0x1,%edx
+  803b12:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  803b15:	75 50                	jne    803b67 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  803b17:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803b1d:	c1 e8 1c             	shr    $0x1c,%eax
+  803b20:	8b 13                	mov    (%ebx),%edx
+  803b22:	c1 ea 1c             	shr    $0x1c,%edx
+  803b25:	39 d0                	cmp    %edx,%eax
+  803b27:	75 3e                	jne    803b67 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803b29:	83 c6 01             	add    $0x1,%esi
+  803b2c:	83 fe 08             	cmp    $0x8,%esi
+  803b2f:	74 3f                	je     803b70 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  803b31:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803b33:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  803b39:	77 2c                	ja     803b67 <page_in+0x14d>
+  803b3b:	89 f8                	mov    %edi,%eax
+  803b3d:	c1 e8 16             	shr    $0x16,%eax
+  803b40:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803b47:	f6 c2 01             	test   $0x1,%dl
+  803b4a:	74 9f                	je     803aeb <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803b4c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803b53:	a8 80                	test   $0x80,%al
+  803b55:	75 10                	jne    803b67 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803b57:	89 f8                	mov    %edi,%eax
+  803b59:	c1 e8 0c             	shr    $0xc,%eax
+  803b5c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b63:	a8 01                	test   $0x1,%al
+  803b65:	74 84                	je     803aeb <page_in+0xd1>
+	if (n == 1)
+  803b67:	83 fe 01             	cmp    $0x1,%esi
+  803b6a:	0f 84 fa fe ff ff    	je     803a6a <page_in+0x50>
+	req.nslots = n;
+  803b70:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  803b76:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b7b:	eb 13                	jmp    803b90 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  803b7d:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  803b81:	8b 12                	mov    (%edx),%edx
+  803b83:	c1 ea 0c             	shr    $0xc,%edx
+  803b86:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  803b8d:	83 c0 01             	add    $0x1,%eax
+  803b90:	39 c6                	cmp    %eax,%esi
+  803b92:	75 e9                	jne    803b7d <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  803b94:	83 ec 0c             	sub    $0xc,%esp
+  803b97:	6a 00                	push   $0x0
+  803b99:	ff 75 c0             	push   -0x40(%ebp)
+  803b9c:	56                   	push   %esi
+  803b9d:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803ba0:	57                   	push   %edi
+  803ba1:	6a 00                	push   $0x0
+  803ba3:	e8 ab fd ff ff       	call   803953 <page_alloc_range>
+  803ba8:	83 c4 20             	add    $0x20,%esp
+  803bab:	85 c0                	test   %eax,%eax
+  803bad:	78 6e                	js     803c1d <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  803baf:	83 ec 04             	sub    $0x4,%esp
+  803bb2:	6a 24                	push   $0x24
+  803bb4:	68 00 80 80 00       	push   $0x808000
+  803bb9:	57                   	push   %edi
+  803bba:	e8 a2 cd ff ff       	call   800961 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803bbf:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803bc6:	56                   	push   %esi
+  803bc7:	57                   	push   %edi
+  803bc8:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803bca:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  803bd1:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803bd4:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  803bdb:	e8 a6 0d 00 00       	call   804986 <ipc_call>
+  803be0:	83 c4 20             	add    $0x20,%esp
+  803be3:	85 c0                	test   %eax,%eax
+  803be5:	78 08                	js     803bef <page_in+0x1d5>
+  803be7:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  803bea:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  803bed:	eb 20                	jmp    803c0f <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  803bef:	50                   	push   %eax
+  803bf0:	68 04 56 80 00       	push   $0x805604
+  803bf5:	68 59 02 00 00       	push   $0x259
+  803bfa:	68 36 52 80 00       	push   $0x805236
+  803bff:	e8 15 c5 ff ff       	call   800119 <_panic>
+		*mtes[i] = 0;
+  803c04:	8b 10                	mov    (%eax),%edx
+  803c06:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  803c0c:	83 c0 04             	add    $0x4,%eax
+  803c0f:	39 c8                	cmp    %ecx,%eax
+  803c11:	75 f1                	jne    803c04 <page_in+0x1ea>
+	return n;
+  803c13:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  803c15:	85 f6                	test   %esi,%esi
+  803c17:	0f 84 4d fe ff ff    	je     803a6a <page_in+0x50>
+		return r < 0 ? r : 0;
+  803c1d:	85 c0                	test   %eax,%eax
+  803c1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c24:	0f 4f c2             	cmovg  %edx,%eax
+  803c27:	e9 99 fe ff ff       	jmp    803ac5 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  803c2c:	50                   	push   %eax
+  803c2d:	68 3c 56 80 00       	push   $0x80563c
+  803c32:	68 9a 02 00 00       	push   $0x29a
+  803c37:	68 36 52 80 00       	push   $0x805236
+  803c3c:	e8 d8 c4 ff ff       	call   800119 <_panic>
+		return -E_PAGING;
+  803c41:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803c46:	e9 7a fe ff ff       	jmp    803ac5 <page_in+0xab>
+
+00803c4b <page_map>:
+{
+  803c4b:	55                   	push   %ebp
+  803c4c:	89 e5                	mov    %esp,%ebp
+  803c4e:	57                   	push   %edi
+  803c4f:	56                   	push   %esi
+  803c50:	53                   	push   %ebx
+  803c51:	83 ec 1c             	sub    $0x1c,%esp
+  803c54:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803c57:	83 ec 0c             	sub    $0xc,%esp
+  803c5a:	ff 75 18             	push   0x18(%ebp)
+  803c5d:	ff 75 14             	push   0x14(%ebp)
+  803c60:	ff 75 10             	push   0x10(%ebp)
+  803c63:	ff 75 0c             	push   0xc(%ebp)
+  803c66:	56                   	push   %esi
+  803c67:	e8 a5 d0 ff ff       	call   800d11 <sys_page_map>
+  803c6c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803c6f:	83 c4 20             	add    $0x20,%esp
+  803c72:	85 c0                	test   %eax,%eax
+  803c74:	0f 89 a9 01 00 00    	jns    803e23 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  803c7a:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  803c7e:	74 5f                	je     803cdf <page_map+0x94>
+		if (r != -E_INVAL)
+  803c80:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  803c84:	0f 85 a0 01 00 00    	jne    803e2a <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803c8a:	85 f6                	test   %esi,%esi
+  803c8c:	74 70                	je     803cfe <page_map+0xb3>
+  803c8e:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803c93:	8b 40 48             	mov    0x48(%eax),%eax
+  803c96:	39 f0                	cmp    %esi,%eax
+  803c98:	74 64                	je     803cfe <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803c9a:	83 ec 0c             	sub    $0xc,%esp
+  803c9d:	6a 05                	push   $0x5
+  803c9f:	68 00 00 40 00       	push   $0x400000
+  803ca4:	6a 00                	push   $0x0
+  803ca6:	68 00 b0 ad de       	push   $0xdeadb000
+  803cab:	56                   	push   %esi
+  803cac:	e8 60 d0 ff ff       	call   800d11 <sys_page_map>
+  803cb1:	89 c3                	mov    %eax,%ebx
+  803cb3:	83 c4 20             	add    $0x20,%esp
+  803cb6:	85 c0                	test   %eax,%eax
+  803cb8:	79 6a                	jns    803d24 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  803cba:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803cbd:	75 50                	jne    803d0f <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  803cbf:	83 ec 08             	sub    $0x8,%esp
+  803cc2:	68 00 00 40 00       	push   $0x400000
+  803cc7:	6a fc                	push   $0xfffffffc
+  803cc9:	e8 9c f6 ff ff       	call   80336a <page_out>
+  803cce:	83 c4 10             	add    $0x10,%esp
+  803cd1:	85 c0                	test   %eax,%eax
+  803cd3:	79 c5                	jns    803c9a <page_map+0x4f>
+}
+  803cd5:	89 d8                	mov    %ebx,%eax
+  803cd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cda:	5b                   	pop    %ebx
+  803cdb:	5e                   	pop    %esi
+  803cdc:	5f                   	pop    %edi
+  803cdd:	5d                   	pop    %ebp
+  803cde:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  803cdf:	83 ec 08             	sub    $0x8,%esp
+  803ce2:	68 00 00 40 00       	push   $0x400000
+  803ce7:	6a 00                	push   $0x0
+  803ce9:	e8 7c f6 ff ff       	call   80336a <page_out>
+  803cee:	83 c4 10             	add    $0x10,%esp
+  803cf1:	85 c0                	test   %eax,%eax
+  803cf3:	0f 89 5e ff ff ff    	jns    803c57 <page_map+0xc>
+				return r;
+  803cf9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803cfc:	eb d7                	jmp    803cd5 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803cfe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d01:	e8 79 f9 ff ff       	call   80367f <page_adopt>
+  803d06:	85 c0                	test   %eax,%eax
+  803d08:	79 90                	jns    803c9a <page_map+0x4f>
+			return r;
+  803d0a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803d0d:	eb c6                	jmp    803cd5 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  803d0f:	53                   	push   %ebx
+  803d10:	68 70 56 80 00       	push   $0x805670
+  803d15:	68 77 03 00 00       	push   $0x377
+  803d1a:	68 36 52 80 00       	push   $0x805236
+  803d1f:	e8 f5 c3 ff ff       	call   800119 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  803d24:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d27:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803d2a:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  803d31:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  803d37:	0f 84 f5 00 00 00    	je     803e32 <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803d3d:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803d43:	83 ec 0c             	sub    $0xc,%esp
+  803d46:	6a 05                	push   $0x5
+  803d48:	68 00 00 40 00       	push   $0x400000
+  803d4d:	6a 00                	push   $0x0
+  803d4f:	57                   	push   %edi
+  803d50:	56                   	push   %esi
+  803d51:	e8 bb cf ff ff       	call   800d11 <sys_page_map>
+  803d56:	89 c3                	mov    %eax,%ebx
+  803d58:	83 c4 20             	add    $0x20,%esp
+  803d5b:	85 c0                	test   %eax,%eax
+  803d5d:	79 35                	jns    803d94 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  803d5f:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803d62:	75 1b                	jne    803d7f <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803d64:	83 ec 08             	sub    $0x8,%esp
+  803d67:	68 00 00 40 00       	push   $0x400000
+  803d6c:	6a 00                	push   $0x0
+  803d6e:	e8 f7 f5 ff ff       	call   80336a <page_out>
+  803d73:	83 c4 10             	add    $0x10,%esp
+  803d76:	85 c0                	test   %eax,%eax
+  803d78:	79 c9                	jns    803d43 <page_map+0xf8>
+  803d7a:	e9 56 ff ff ff       	jmp    803cd5 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  803d7f:	53                   	push   %ebx
+  803d80:	68 98 56 80 00       	push   $0x805698
+  803d85:	68 83 03 00 00       	push   $0x383
+  803d8a:	68 36 52 80 00       	push   $0x805236
+  803d8f:	e8 85 c3 ff ff       	call   800119 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  803d94:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d97:	c1 e8 0c             	shr    $0xc,%eax
+  803d9a:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803d9f:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  803da6:	01 
+  803da7:	0f 84 8d 00 00 00    	je     803e3a <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803dad:	83 ec 08             	sub    $0x8,%esp
+  803db0:	68 00 00 40 00       	push   $0x400000
+  803db5:	6a 00                	push   $0x0
+  803db7:	e8 97 cf ff ff       	call   800d53 <sys_page_unmap>
+  803dbc:	83 c4 10             	add    $0x10,%esp
+  803dbf:	85 c0                	test   %eax,%eax
+  803dc1:	78 36                	js     803df9 <page_map+0x1ae>
+  803dc3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  803dc6:	83 ec 08             	sub    $0x8,%esp
+  803dc9:	57                   	push   %edi
+  803dca:	56                   	push   %esi
+  803dcb:	e8 4a fc ff ff       	call   803a1a <page_in>
+  803dd0:	89 c3                	mov    %eax,%ebx
+  803dd2:	83 c4 10             	add    $0x10,%esp
+  803dd5:	85 c0                	test   %eax,%eax
+  803dd7:	0f 89 7a fe ff ff    	jns    803c57 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  803ddd:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803de0:	75 2c                	jne    803e0e <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  803de2:	83 ec 08             	sub    $0x8,%esp
+  803de5:	57                   	push   %edi
+  803de6:	6a 00                	push   $0x0
+  803de8:	e8 7d f5 ff ff       	call   80336a <page_out>
+  803ded:	83 c4 10             	add    $0x10,%esp
+  803df0:	85 c0                	test   %eax,%eax
+  803df2:	79 d2                	jns    803dc6 <page_map+0x17b>
+  803df4:	e9 dc fe ff ff       	jmp    803cd5 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  803df9:	50                   	push   %eax
+  803dfa:	68 c4 56 80 00       	push   $0x8056c4
+  803dff:	68 8b 03 00 00       	push   $0x38b
+  803e04:	68 36 52 80 00       	push   $0x805236
+  803e09:	e8 0b c3 ff ff       	call   800119 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  803e0e:	53                   	push   %ebx
+  803e0f:	68 ec 56 80 00       	push   $0x8056ec
+  803e14:	68 91 03 00 00       	push   $0x391
+  803e19:	68 36 52 80 00       	push   $0x805236
+  803e1e:	e8 f6 c2 ff ff       	call   800119 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803e23:	89 c3                	mov    %eax,%ebx
+  803e25:	e9 ab fe ff ff       	jmp    803cd5 <page_map+0x8a>
+  803e2a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e2d:	e9 a3 fe ff ff       	jmp    803cd5 <page_map+0x8a>
+			return r; // Pass through the error
+  803e32:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e35:	e9 9b fe ff ff       	jmp    803cd5 <page_map+0x8a>
+			return r; // Pass through the error
+  803e3a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e3d:	e9 93 fe ff ff       	jmp    803cd5 <page_map+0x8a>
+
+00803e42 <page_map_range>:
+{
+  803e42:	55                   	push   %ebp
+  803e43:	89 e5                	mov    %esp,%ebp
+  803e45:	57                   	push   %edi
+  803e46:	56                   	push   %esi
+  803e47:	53                   	push   %ebx
+  803e48:	83 ec 0c             	sub    $0xc,%esp
+  803e4b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803e4e:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  803e51:	83 ec 08             	sub    $0x8,%esp
+  803e54:	ff 75 1c             	push   0x1c(%ebp)
+  803e57:	ff 75 18             	push   0x18(%ebp)
+  803e5a:	56                   	push   %esi
+  803e5b:	ff 75 10             	push   0x10(%ebp)
+  803e5e:	57                   	push   %edi
+  803e5f:	ff 75 08             	push   0x8(%ebp)
+  803e62:	e8 b5 cf ff ff       	call   800e1c <sys_page_map_range>
+  803e67:	89 c3                	mov    %eax,%ebx
+  803e69:	83 c4 20             	add    $0x20,%esp
+  803e6c:	85 c0                	test   %eax,%eax
+  803e6e:	79 1b                	jns    803e8b <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  803e70:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803e73:	75 20                	jne    803e95 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803e75:	83 ec 08             	sub    $0x8,%esp
+  803e78:	68 00 00 40 00       	push   $0x400000
+  803e7d:	6a 00                	push   $0x0
+  803e7f:	e8 e6 f4 ff ff       	call   80336a <page_out>
+  803e84:	83 c4 10             	add    $0x10,%esp
+  803e87:	85 c0                	test   %eax,%eax
+  803e89:	79 c6                	jns    803e51 <page_map_range+0xf>
+}
+  803e8b:	89 d8                	mov    %ebx,%eax
+  803e8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e90:	5b                   	pop    %ebx
+  803e91:	5e                   	pop    %esi
+  803e92:	5f                   	pop    %edi
+  803e93:	5d                   	pop    %ebp
+  803e94:	c3                   	ret
+		if (r != -E_INVAL)
+  803e95:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  803e98:	75 f1                	jne    803e8b <page_map_range+0x49>
+  803e9a:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  803e9c:	be 00 00 00 00       	mov    $0x0,%esi
+  803ea1:	eb 03                	jmp    803ea6 <page_map_range+0x64>
+  803ea3:	83 c6 01             	add    $0x1,%esi
+  803ea6:	3b 75 18             	cmp    0x18(%ebp),%esi
+  803ea9:	74 2a                	je     803ed5 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  803eab:	83 ec 0c             	sub    $0xc,%esp
+  803eae:	ff 75 1c             	push   0x1c(%ebp)
+  803eb1:	53                   	push   %ebx
+  803eb2:	ff 75 10             	push   0x10(%ebp)
+  803eb5:	57                   	push   %edi
+  803eb6:	ff 75 08             	push   0x8(%ebp)
+  803eb9:	e8 8d fd ff ff       	call   803c4b <page_map>
+  803ebe:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803ec4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803eca:	83 c4 20             	add    $0x20,%esp
+  803ecd:	85 c0                	test   %eax,%eax
+  803ecf:	79 d2                	jns    803ea3 <page_map_range+0x61>
+  803ed1:	89 c3                	mov    %eax,%ebx
+  803ed3:	eb b6                	jmp    803e8b <page_map_range+0x49>
+		return 0;
+  803ed5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803eda:	eb af                	jmp    803e8b <page_map_range+0x49>
+
+00803edc <paging_pgfault_handler>:
+{
+  803edc:	55                   	push   %ebp
+  803edd:	89 e5                	mov    %esp,%ebp
+  803edf:	56                   	push   %esi
+  803ee0:	53                   	push   %ebx
+  803ee1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  803ee4:	e8 6f e7 ff ff       	call   802658 <find_paging_env>
+	if (pagingenv == 0)
+  803ee9:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803eee:	85 c0                	test   %eax,%eax
+  803ef0:	74 3c                	je     803f2e <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  803ef2:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803ef4:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803ef8:	75 12                	jne    803f0c <paging_pgfault_handler+0x30>
+  803efa:	89 f0                	mov    %esi,%eax
+  803efc:	e8 7e f7 ff ff       	call   80367f <page_adopt>
+  803f01:	89 c2                	mov    %eax,%edx
+		return 0;
+  803f03:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803f08:	85 d2                	test   %edx,%edx
+  803f0a:	78 22                	js     803f2e <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  803f0c:	83 ec 08             	sub    $0x8,%esp
+  803f0f:	6a 00                	push   $0x0
+  803f11:	56                   	push   %esi
+  803f12:	e8 a9 f3 ff ff       	call   8032c0 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  803f17:	83 c4 10             	add    $0x10,%esp
+  803f1a:	85 c0                	test   %eax,%eax
+  803f1c:	74 05                	je     803f23 <paging_pgfault_handler+0x47>
+  803f1e:	f6 00 01             	testb  $0x1,(%eax)
+  803f21:	75 12                	jne    803f35 <paging_pgfault_handler+0x59>
+	return 0;
+  803f23:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f28:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803f2c:	74 23                	je     803f51 <paging_pgfault_handler+0x75>
+}
+  803f2e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f31:	5b                   	pop    %ebx
+  803f32:	5e                   	pop    %esi
+  803f33:	5d                   	pop    %ebp
+  803f34:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  803f35:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803f3a:	8b 40 48             	mov    0x48(%eax),%eax
+  803f3d:	83 ec 08             	sub    $0x8,%esp
+  803f40:	56                   	push   %esi
+  803f41:	50                   	push   %eax
+  803f42:	e8 d3 fa ff ff       	call   803a1a <page_in>
+  803f47:	f7 d0                	not    %eax
+  803f49:	c1 e8 1f             	shr    $0x1f,%eax
+  803f4c:	83 c4 10             	add    $0x10,%esp
+  803f4f:	eb dd                	jmp    803f2e <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f51:	89 f0                	mov    %esi,%eax
+  803f53:	e8 97 e2 ff ff       	call   8021ef <segment_lookup>
+  803f58:	89 c2                	mov    %eax,%edx
+	return 0;
+  803f5a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f5f:	85 d2                	test   %edx,%edx
+  803f61:	74 cb                	je     803f2e <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  803f63:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803f68:	8b 40 48             	mov    0x48(%eax),%eax
+  803f6b:	83 ec 08             	sub    $0x8,%esp
+  803f6e:	56                   	push   %esi
+  803f6f:	50                   	push   %eax
+  803f70:	e8 f5 f3 ff ff       	call   80336a <page_out>
+  803f75:	f7 d0                	not    %eax
+  803f77:	c1 e8 1f             	shr    $0x1f,%eax
+  803f7a:	83 c4 10             	add    $0x10,%esp
+  803f7d:	eb af                	jmp    803f2e <paging_pgfault_handler+0x52>
+
+00803f7f <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  803f7f:	55                   	push   %ebp
+  803f80:	89 e5                	mov    %esp,%ebp
+  803f82:	57                   	push   %edi
+  803f83:	56                   	push   %esi
+  803f84:	53                   	push   %ebx
+  803f85:	83 ec 2c             	sub    $0x2c,%esp
+  803f88:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  803f8b:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  803f90:	89 c1                	mov    %eax,%ecx
+  803f92:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  803f95:	c1 e8 11             	shr    $0x11,%eax
+  803f98:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803f9b:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  803fa2:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  803fa5:	b8 01 00 00 00       	mov    $0x1,%eax
+  803faa:	d3 e0                	shl    %cl,%eax
+  803fac:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803faf:	85 c7                	test   %eax,%edi
+  803fb1:	74 12                	je     803fc5 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803fb3:	bb 01 00 00 00       	mov    $0x1,%ebx
+  803fb8:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  803fbb:	bf 01 00 00 00       	mov    $0x1,%edi
+  803fc0:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803fc3:	eb 17                	jmp    803fdc <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  803fc5:	ff 75 e0             	push   -0x20(%ebp)
+  803fc8:	68 24 57 80 00       	push   $0x805724
+  803fcd:	6a 48                	push   $0x48
+  803fcf:	68 3e 57 80 00       	push   $0x80573e
+  803fd4:	e8 40 c1 ff ff       	call   800119 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803fd9:	83 c3 01             	add    $0x1,%ebx
+  803fdc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803fdf:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  803fe2:	89 c8                	mov    %ecx,%eax
+  803fe4:	c1 e8 05             	shr    $0x5,%eax
+  803fe7:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  803fee:	89 fe                	mov    %edi,%esi
+  803ff0:	d3 e6                	shl    %cl,%esi
+  803ff2:	89 f1                	mov    %esi,%ecx
+  803ff4:	85 d6                	test   %edx,%esi
+  803ff6:	74 e1                	je     803fd9 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  803ff8:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  803ffb:	f7 d6                	not    %esi
+  803ffd:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804000:	21 fe                	and    %edi,%esi
+  804002:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804005:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  80400c:	f7 d1                	not    %ecx
+  80400e:	21 d1                	and    %edx,%ecx
+  804010:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804017:	83 ec 04             	sub    $0x4,%esp
+  80401a:	53                   	push   %ebx
+  80401b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80401e:	57                   	push   %edi
+  80401f:	6a 00                	push   $0x0
+  804021:	e8 97 f8 ff ff       	call   8038bd <page_unmap_range>
+	va_free(va, n);
+  804026:	83 c4 08             	add    $0x8,%esp
+  804029:	53                   	push   %ebx
+  80402a:	57                   	push   %edi
+  80402b:	e8 ed 05 00 00       	call   80461d <va_free>
+}
+  804030:	83 c4 10             	add    $0x10,%esp
+  804033:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804036:	5b                   	pop    %ebx
+  804037:	5e                   	pop    %esi
+  804038:	5f                   	pop    %edi
+  804039:	5d                   	pop    %ebp
+  80403a:	c3                   	ret
+
+0080403b <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  80403b:	55                   	push   %ebp
+  80403c:	89 e5                	mov    %esp,%ebp
+  80403e:	57                   	push   %edi
+  80403f:	56                   	push   %esi
+  804040:	53                   	push   %ebx
+  804041:	83 ec 1c             	sub    $0x1c,%esp
+  804044:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804047:	85 db                	test   %ebx,%ebx
+  804049:	74 34                	je     80407f <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  80404b:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  804051:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  804056:	77 2f                	ja     804087 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  804058:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80405e:	75 51                	jne    8040b1 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  804060:	89 c1                	mov    %eax,%ecx
+  804062:	c1 e9 0c             	shr    $0xc,%ecx
+  804065:	ba 01 00 00 00       	mov    $0x1,%edx
+  80406a:	d3 e2                	shl    %cl,%edx
+  80406c:	c1 e8 11             	shr    $0x11,%eax
+  80406f:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  804076:	75 24                	jne    80409c <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  804078:	89 d8                	mov    %ebx,%eax
+  80407a:	e8 00 ff ff ff       	call   803f7f <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  80407f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804082:	5b                   	pop    %ebx
+  804083:	5e                   	pop    %esi
+  804084:	5f                   	pop    %edi
+  804085:	5d                   	pop    %ebp
+  804086:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  804087:	53                   	push   %ebx
+  804088:	68 4b 57 80 00       	push   $0x80574b
+  80408d:	68 a2 00 00 00       	push   $0xa2
+  804092:	68 3e 57 80 00       	push   $0x80573e
+  804097:	e8 7d c0 ff ff       	call   800119 <_panic>
+			panic("free: %p is not allocated", va);
+  80409c:	53                   	push   %ebx
+  80409d:	68 24 57 80 00       	push   $0x805724
+  8040a2:	68 a5 00 00 00       	push   $0xa5
+  8040a7:	68 3e 57 80 00       	push   $0x80573e
+  8040ac:	e8 68 c0 ff ff       	call   800119 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  8040b1:	89 de                	mov    %ebx,%esi
+  8040b3:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  8040b9:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  8040bf:	89 c8                	mov    %ecx,%eax
+  8040c1:	c1 e8 11             	shr    $0x11,%eax
+  8040c4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8040c7:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  8040ce:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8040d1:	c1 e9 0c             	shr    $0xc,%ecx
+  8040d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8040d9:	d3 e0                	shl    %cl,%eax
+  8040db:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8040de:	85 c7                	test   %eax,%edi
+  8040e0:	74 1b                	je     8040fd <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  8040e2:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8040e6:	89 d8                	mov    %ebx,%eax
+  8040e8:	29 f0                	sub    %esi,%eax
+  8040ea:	83 e8 10             	sub    $0x10,%eax
+  8040ed:	99                   	cltd
+  8040ee:	f7 ff                	idiv   %edi
+  8040f0:	89 d1                	mov    %edx,%ecx
+  8040f2:	85 d2                	test   %edx,%edx
+  8040f4:	75 07                	jne    8040fd <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8040f6:	ba 10 00 00 00       	mov    $0x10,%edx
+  8040fb:	eb 18                	jmp    804115 <free+0xda>
+		panic("free: %p is not allocated", va);
+  8040fd:	53                   	push   %ebx
+  8040fe:	68 24 57 80 00       	push   $0x805724
+  804103:	68 ad 00 00 00       	push   $0xad
+  804108:	68 3e 57 80 00       	push   $0x80573e
+  80410d:	e8 07 c0 ff ff       	call   800119 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804112:	83 c1 01             	add    $0x1,%ecx
+  804115:	89 d0                	mov    %edx,%eax
+  804117:	d3 e0                	shl    %cl,%eax
+  804119:	39 c7                	cmp    %eax,%edi
+  80411b:	7f f5                	jg     804112 <free+0xd7>
+	*(void **) va = s->free;
+  80411d:	8b 46 08             	mov    0x8(%esi),%eax
+  804120:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  804122:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  804125:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  804129:	8d 58 01             	lea    0x1(%eax),%ebx
+  80412c:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  804130:	66 85 c0             	test   %ax,%ax
+  804133:	74 52                	je     804187 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804135:	0f b7 db             	movzwl %bx,%ebx
+  804138:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  80413c:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804141:	ba 00 00 00 00       	mov    $0x0,%edx
+  804146:	f7 ff                	idiv   %edi
+  804148:	39 c3                	cmp    %eax,%ebx
+  80414a:	0f 85 2f ff ff ff    	jne    80407f <free+0x44>
+  804150:	8b 46 04             	mov    0x4(%esi),%eax
+  804153:	85 c0                	test   %eax,%eax
+  804155:	74 53                	je     8041aa <free+0x16f>
+		s->prev->next = s->next;
+  804157:	8b 16                	mov    (%esi),%edx
+  804159:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  80415b:	8b 06                	mov    (%esi),%eax
+  80415d:	85 c0                	test   %eax,%eax
+  80415f:	74 06                	je     804167 <free+0x12c>
+		s->next->prev = s->prev;
+  804161:	8b 56 04             	mov    0x4(%esi),%edx
+  804164:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804167:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80416a:	f7 d0                	not    %eax
+  80416c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80416f:	21 d0                	and    %edx,%eax
+  804171:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  804174:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  80417b:	89 f0                	mov    %esi,%eax
+  80417d:	e8 fd fd ff ff       	call   803f7f <heap_free_pages>
+  804182:	e9 f8 fe ff ff       	jmp    80407f <free+0x44>
+	s->prev = NULL;
+  804187:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  80418e:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  804195:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  804197:	85 c0                	test   %eax,%eax
+  804199:	74 03                	je     80419e <free+0x163>
+		slabs[c]->prev = s;
+  80419b:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  80419e:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  8041a5:	e9 d5 fe ff ff       	jmp    80407f <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8041aa:	8b 06                	mov    (%esi),%eax
+  8041ac:	85 c0                	test   %eax,%eax
+  8041ae:	0f 84 cb fe ff ff    	je     80407f <free+0x44>
+		slabs[c] = s->next;
+  8041b4:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  8041bb:	8b 06                	mov    (%esi),%eax
+  8041bd:	eb a2                	jmp    804161 <free+0x126>
+
+008041bf <heap_alloc_pages>:
+{
+  8041bf:	55                   	push   %ebp
+  8041c0:	89 e5                	mov    %esp,%ebp
+  8041c2:	57                   	push   %edi
+  8041c3:	56                   	push   %esi
+  8041c4:	53                   	push   %ebx
+  8041c5:	83 ec 18             	sub    $0x18,%esp
+  8041c8:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  8041ca:	50                   	push   %eax
+  8041cb:	e8 15 03 00 00       	call   8044e5 <va_alloc>
+  8041d0:	89 c3                	mov    %eax,%ebx
+  8041d2:	83 c4 10             	add    $0x10,%esp
+  8041d5:	85 c0                	test   %eax,%eax
+  8041d7:	74 47                	je     804220 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8041d9:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  8041df:	89 c1                	mov    %eax,%ecx
+  8041e1:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  8041e4:	c1 e8 11             	shr    $0x11,%eax
+  8041e7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8041ec:	89 d7                	mov    %edx,%edi
+  8041ee:	d3 e7                	shl    %cl,%edi
+  8041f0:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  8041f7:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  8041fb:	89 c8                	mov    %ecx,%eax
+  8041fd:	c1 e8 05             	shr    $0x5,%eax
+  804200:	d3 e2                	shl    %cl,%edx
+  804202:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  804209:	83 ec 0c             	sub    $0xc,%esp
+  80420c:	6a 00                	push   $0x0
+  80420e:	6a 07                	push   $0x7
+  804210:	56                   	push   %esi
+  804211:	53                   	push   %ebx
+  804212:	6a 00                	push   $0x0
+  804214:	e8 3a f7 ff ff       	call   803953 <page_alloc_range>
+  804219:	83 c4 20             	add    $0x20,%esp
+  80421c:	85 c0                	test   %eax,%eax
+  80421e:	78 0a                	js     80422a <heap_alloc_pages+0x6b>
+}
+  804220:	89 d8                	mov    %ebx,%eax
+  804222:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804225:	5b                   	pop    %ebx
+  804226:	5e                   	pop    %esi
+  804227:	5f                   	pop    %edi
+  804228:	5d                   	pop    %ebp
+  804229:	c3                   	ret
+		free(va);
+  80422a:	83 ec 0c             	sub    $0xc,%esp
+  80422d:	53                   	push   %ebx
+  80422e:	e8 08 fe ff ff       	call   80403b <free>
+		return NULL;
+  804233:	83 c4 10             	add    $0x10,%esp
+  804236:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80423b:	eb e3                	jmp    804220 <heap_alloc_pages+0x61>
+
+0080423d <malloc>:
+{
+  80423d:	55                   	push   %ebp
+  80423e:	89 e5                	mov    %esp,%ebp
+  804240:	57                   	push   %edi
+  804241:	56                   	push   %esi
+  804242:	53                   	push   %ebx
+  804243:	83 ec 1c             	sub    $0x1c,%esp
+  804246:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804249:	8d 50 ff             	lea    -0x1(%eax),%edx
+  80424c:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  804252:	0f 87 21 01 00 00    	ja     804379 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804258:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80425d:	ba 10 00 00 00       	mov    $0x10,%edx
+  804262:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  804264:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804269:	76 15                	jbe    804280 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  80426b:	05 ff 0f 00 00       	add    $0xfff,%eax
+  804270:	c1 e8 0c             	shr    $0xc,%eax
+  804273:	e8 47 ff ff ff       	call   8041bf <heap_alloc_pages>
+  804278:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80427b:	eb 37                	jmp    8042b4 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  80427d:	83 c1 01             	add    $0x1,%ecx
+  804280:	89 d6                	mov    %edx,%esi
+  804282:	d3 e6                	shl    %cl,%esi
+  804284:	39 c6                	cmp    %eax,%esi
+  804286:	72 f5                	jb     80427d <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804288:	89 cb                	mov    %ecx,%ebx
+  80428a:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  804291:	85 ff                	test   %edi,%edi
+  804293:	74 2a                	je     8042bf <malloc+0x82>
+	v = s->free;
+  804295:	8b 47 08             	mov    0x8(%edi),%eax
+  804298:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  80429b:	8b 00                	mov    (%eax),%eax
+  80429d:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  8042a0:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  8042a4:	83 e8 01             	sub    $0x1,%eax
+  8042a7:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  8042ab:	66 85 c0             	test   %ax,%ax
+  8042ae:	0f 84 9a 00 00 00    	je     80434e <malloc+0x111>
+}
+  8042b4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8042b7:	83 c4 1c             	add    $0x1c,%esp
+  8042ba:	5b                   	pop    %ebx
+  8042bb:	5e                   	pop    %esi
+  8042bc:	5f                   	pop    %edi
+  8042bd:	5d                   	pop    %ebp
+  8042be:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  8042bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8042c4:	e8 f6 fe ff ff       	call   8041bf <heap_alloc_pages>
+  8042c9:	89 c1                	mov    %eax,%ecx
+  8042cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8042ce:	85 c0                	test   %eax,%eax
+  8042d0:	74 e2                	je     8042b4 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8042d2:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  8042d8:	89 c8                	mov    %ecx,%eax
+  8042da:	c1 e8 11             	shr    $0x11,%eax
+  8042dd:	c1 e9 0c             	shr    $0xc,%ecx
+  8042e0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042e5:	d3 e2                	shl    %cl,%edx
+  8042e7:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  8042ee:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8042f1:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  8042f5:	0f b7 f6             	movzwl %si,%esi
+  8042f8:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8042fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  804302:	f7 fe                	idiv   %esi
+  804304:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804308:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  80430b:	85 c0                	test   %eax,%eax
+  80430d:	74 14                	je     804323 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  80430f:	83 e8 01             	sub    $0x1,%eax
+  804312:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804316:	0f af d0             	imul   %eax,%edx
+  804319:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  80431d:	89 3a                	mov    %edi,(%edx)
+  80431f:	89 d7                	mov    %edx,%edi
+  804321:	eb e5                	jmp    804308 <malloc+0xcb>
+	s->prev = NULL;
+  804323:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804326:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  80432d:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  804334:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804336:	85 c0                	test   %eax,%eax
+  804338:	74 03                	je     80433d <malloc+0x100>
+		slabs[c]->prev = s;
+  80433a:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  80433d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804340:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  804347:	89 c7                	mov    %eax,%edi
+  804349:	e9 47 ff ff ff       	jmp    804295 <malloc+0x58>
+	if (s->prev)
+  80434e:	8b 47 04             	mov    0x4(%edi),%eax
+  804351:	85 c0                	test   %eax,%eax
+  804353:	74 19                	je     80436e <malloc+0x131>
+		s->prev->next = s->next;
+  804355:	8b 17                	mov    (%edi),%edx
+  804357:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804359:	8b 07                	mov    (%edi),%eax
+  80435b:	85 c0                	test   %eax,%eax
+  80435d:	0f 84 51 ff ff ff    	je     8042b4 <malloc+0x77>
+		s->next->prev = s->prev;
+  804363:	8b 57 04             	mov    0x4(%edi),%edx
+  804366:	89 50 04             	mov    %edx,0x4(%eax)
+  804369:	e9 46 ff ff ff       	jmp    8042b4 <malloc+0x77>
+		slabs[c] = s->next;
+  80436e:	8b 07                	mov    (%edi),%eax
+  804370:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  804377:	eb e0                	jmp    804359 <malloc+0x11c>
+		return NULL;
+  804379:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804380:	e9 2f ff ff ff       	jmp    8042b4 <malloc+0x77>
+
+00804385 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804385:	55                   	push   %ebp
+  804386:	89 e5                	mov    %esp,%ebp
+  804388:	57                   	push   %edi
+  804389:	56                   	push   %esi
+  80438a:	53                   	push   %ebx
+  80438b:	83 ec 0c             	sub    $0xc,%esp
+  80438e:	89 c6                	mov    %eax,%esi
+  804390:	89 d7                	mov    %edx,%edi
+  804392:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804395:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80439a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80439f:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  8043a4:	83 ef 01             	sub    $0x1,%edi
+  8043a7:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8043aa:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8043ad:	eb 34                	jmp    8043e3 <va_chunk_scan+0x5e>
+			i += 31;
+  8043af:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  8043b2:	89 ca                	mov    %ecx,%edx
+			continue;
+  8043b4:	eb 23                	jmp    8043d9 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8043b6:	89 c7                	mov    %eax,%edi
+  8043b8:	c1 ef 05             	shr    $0x5,%edi
+  8043bb:	be 01 00 00 00       	mov    $0x1,%esi
+  8043c0:	d3 e6                	shl    %cl,%esi
+  8043c2:	89 f1                	mov    %esi,%ecx
+  8043c4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8043c7:	23 0c be             	and    (%esi,%edi,4),%ecx
+  8043ca:	75 41                	jne    80440d <va_chunk_scan+0x88>
+			len++;
+  8043cc:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  8043cf:	39 d3                	cmp    %edx,%ebx
+  8043d1:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  8043d4:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  8043d7:	72 2d                	jb     804406 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8043d9:	83 c0 01             	add    $0x1,%eax
+  8043dc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8043e1:	77 31                	ja     804414 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  8043e3:	89 c1                	mov    %eax,%ecx
+  8043e5:	83 e1 1f             	and    $0x1f,%ecx
+  8043e8:	75 cc                	jne    8043b6 <va_chunk_scan+0x31>
+  8043ea:	89 c7                	mov    %eax,%edi
+  8043ec:	c1 ef 05             	shr    $0x5,%edi
+  8043ef:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8043f2:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  8043f5:	83 ff ff             	cmp    $0xffffffff,%edi
+  8043f8:	74 b5                	je     8043af <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  8043fa:	85 ff                	test   %edi,%edi
+  8043fc:	75 b8                	jne    8043b6 <va_chunk_scan+0x31>
+			i += 31;
+  8043fe:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804401:	83 c2 20             	add    $0x20,%edx
+  804404:	eb c9                	jmp    8043cf <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804406:	83 c0 01             	add    $0x1,%eax
+  804409:	29 d0                	sub    %edx,%eax
+  80440b:	eb 15                	jmp    804422 <va_chunk_scan+0x9d>
+			len = 0;
+  80440d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804412:	eb c5                	jmp    8043d9 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804414:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804419:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  80441c:	85 d2                	test   %edx,%edx
+  80441e:	74 02                	je     804422 <va_chunk_scan+0x9d>
+		*run_store = best;
+  804420:	89 1a                	mov    %ebx,(%edx)
+}
+  804422:	83 c4 0c             	add    $0xc,%esp
+  804425:	5b                   	pop    %ebx
+  804426:	5e                   	pop    %esi
+  804427:	5f                   	pop    %edi
+  804428:	5d                   	pop    %ebp
+  804429:	c3                   	ret
+
+0080442a <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  80442a:	55                   	push   %ebp
+  80442b:	89 e5                	mov    %esp,%ebp
+  80442d:	57                   	push   %edi
+  80442e:	56                   	push   %esi
+  80442f:	53                   	push   %ebx
+  804430:	83 ec 14             	sub    $0x14,%esp
+  804433:	89 c3                	mov    %eax,%ebx
+  804435:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804437:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  80443d:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  804443:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804446:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804449:	89 d6                	mov    %edx,%esi
+  80444b:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  804451:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804453:	eb 34                	jmp    804489 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804455:	89 c8                	mov    %ecx,%eax
+  804457:	c1 e8 05             	shr    $0x5,%eax
+  80445a:	89 da                	mov    %ebx,%edx
+  80445c:	c1 e2 05             	shl    $0x5,%edx
+  80445f:	01 da                	add    %ebx,%edx
+  804461:	01 c2                	add    %eax,%edx
+  804463:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804468:	d3 c0                	rol    %cl,%eax
+  80446a:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804471:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804478:	b8 01 00 00 00       	mov    $0x1,%eax
+  80447d:	01 d0                	add    %edx,%eax
+  80447f:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804486:	83 c1 01             	add    $0x1,%ecx
+  804489:	39 f9                	cmp    %edi,%ecx
+  80448b:	74 30                	je     8044bd <va_chunk_mark+0x93>
+		if (alloc)
+  80448d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804491:	74 c2                	je     804455 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804493:	89 c8                	mov    %ecx,%eax
+  804495:	c1 e8 05             	shr    $0x5,%eax
+  804498:	89 da                	mov    %ebx,%edx
+  80449a:	c1 e2 05             	shl    $0x5,%edx
+  80449d:	01 da                	add    %ebx,%edx
+  80449f:	01 c2                	add    %eax,%edx
+  8044a1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8044a6:	d3 e0                	shl    %cl,%eax
+  8044a8:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  8044af:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  8044b6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8044bb:	eb c0                	jmp    80447d <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  8044bd:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  8044c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044c5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8044c8:	e8 b8 fe ff ff       	call   804385 <va_chunk_scan>
+	ch->run = run;
+  8044cd:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  8044d3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8044d6:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  8044dd:	83 c4 14             	add    $0x14,%esp
+  8044e0:	5b                   	pop    %ebx
+  8044e1:	5e                   	pop    %esi
+  8044e2:	5f                   	pop    %edi
+  8044e3:	5d                   	pop    %ebp
+  8044e4:	c3                   	ret
+
+008044e5 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  8044e5:	55                   	push   %ebp
+  8044e6:	89 e5                	mov    %esp,%ebp
+  8044e8:	57                   	push   %edi
+  8044e9:	56                   	push   %esi
+  8044ea:	53                   	push   %ebx
+  8044eb:	83 ec 04             	sub    $0x4,%esp
+  8044ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  8044f1:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  8044f6:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  8044fb:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  804502:	74 4f                	je     804553 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804504:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804507:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  80450c:	0f 87 01 01 00 00    	ja     804613 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804512:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804518:	0f 87 80 00 00 00    	ja     80459e <va_alloc+0xb9>
+  80451e:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804523:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804528:	0f b7 10             	movzwl (%eax),%edx
+  80452b:	05 84 00 00 00       	add    $0x84,%eax
+  804530:	39 da                	cmp    %ebx,%edx
+  804532:	73 2c                	jae    804560 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804534:	83 c6 01             	add    $0x1,%esi
+  804537:	83 fe 1c             	cmp    $0x1c,%esi
+  80453a:	75 ec                	jne    804528 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  80453c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804541:	eb 53                	jmp    804596 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804543:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804549:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  80454e:	05 84 00 00 00       	add    $0x84,%eax
+  804553:	39 d0                	cmp    %edx,%eax
+  804555:	75 ec                	jne    804543 <va_alloc+0x5e>
+	va_inited = 1;
+  804557:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  80455e:	eb a4                	jmp    804504 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804560:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804566:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  80456b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804570:	89 da                	mov    %ebx,%edx
+  804572:	e8 0e fe ff ff       	call   804385 <va_chunk_scan>
+  804577:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804579:	6a 01                	push   $0x1
+  80457b:	89 d9                	mov    %ebx,%ecx
+  80457d:	89 c2                	mov    %eax,%edx
+  80457f:	89 f0                	mov    %esi,%eax
+  804581:	e8 a4 fe ff ff       	call   80442a <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804586:	c1 e6 16             	shl    $0x16,%esi
+  804589:	c1 e7 0c             	shl    $0xc,%edi
+  80458c:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804593:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804596:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804599:	5b                   	pop    %ebx
+  80459a:	5e                   	pop    %esi
+  80459b:	5f                   	pop    %edi
+  80459c:	5d                   	pop    %ebp
+  80459d:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  80459e:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  8045a4:	c1 ee 0a             	shr    $0xa,%esi
+  8045a7:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  8045ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045b1:	eb 0a                	jmp    8045bd <va_alloc+0xd8>
+			first = c + 1;
+  8045b3:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  8045b5:	83 c2 01             	add    $0x1,%edx
+  8045b8:	83 fa 1d             	cmp    $0x1d,%edx
+  8045bb:	74 4f                	je     80460c <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  8045bd:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  8045c3:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  8045ca:	00 04 
+  8045cc:	75 e5                	jne    8045b3 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  8045ce:	89 d1                	mov    %edx,%ecx
+  8045d0:	29 c1                	sub    %eax,%ecx
+  8045d2:	39 f1                	cmp    %esi,%ecx
+  8045d4:	75 df                	jne    8045b5 <va_alloc+0xd0>
+  8045d6:	89 c7                	mov    %eax,%edi
+  8045d8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  8045db:	be 00 04 00 00       	mov    $0x400,%esi
+  8045e0:	39 f3                	cmp    %esi,%ebx
+  8045e2:	0f 46 f3             	cmovbe %ebx,%esi
+  8045e5:	6a 01                	push   $0x1
+  8045e7:	89 f1                	mov    %esi,%ecx
+  8045e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045ee:	89 f8                	mov    %edi,%eax
+  8045f0:	e8 35 fe ff ff       	call   80442a <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  8045f5:	83 c7 01             	add    $0x1,%edi
+  8045f8:	83 c4 04             	add    $0x4,%esp
+  8045fb:	29 f3                	sub    %esi,%ebx
+  8045fd:	75 dc                	jne    8045db <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  8045ff:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804602:	c1 e0 16             	shl    $0x16,%eax
+  804605:	05 00 00 00 08       	add    $0x8000000,%eax
+  80460a:	eb 8a                	jmp    804596 <va_alloc+0xb1>
+	return NULL;
+  80460c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804611:	eb 83                	jmp    804596 <va_alloc+0xb1>
+		return NULL;
+  804613:	b8 00 00 00 00       	mov    $0x0,%eax
+  804618:	e9 79 ff ff ff       	jmp    804596 <va_alloc+0xb1>
+
+0080461d <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  80461d:	55                   	push   %ebp
+  80461e:	89 e5                	mov    %esp,%ebp
+  804620:	57                   	push   %edi
+  804621:	56                   	push   %esi
+  804622:	53                   	push   %ebx
+  804623:	83 ec 0c             	sub    $0xc,%esp
+  804626:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804629:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  80462c:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804632:	76 21                	jbe    804655 <va_free+0x38>
+  804634:	89 f0                	mov    %esi,%eax
+  804636:	c1 e0 0c             	shl    $0xc,%eax
+  804639:	01 f8                	add    %edi,%eax
+  80463b:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804640:	77 13                	ja     804655 <va_free+0x38>
+	    || PGOFF(va))
+  804642:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804648:	75 0b                	jne    804655 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  80464a:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804650:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804653:	eb 45                	jmp    80469a <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804655:	83 ec 0c             	sub    $0xc,%esp
+  804658:	56                   	push   %esi
+  804659:	57                   	push   %edi
+  80465a:	68 68 57 80 00       	push   $0x805768
+  80465f:	68 8e 00 00 00       	push   $0x8e
+  804664:	68 88 57 80 00       	push   $0x805788
+  804669:	e8 ab ba ff ff       	call   800119 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  80466e:	89 fa                	mov    %edi,%edx
+  804670:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804676:	bb 00 04 00 00       	mov    $0x400,%ebx
+  80467b:	29 d3                	sub    %edx,%ebx
+  80467d:	39 f3                	cmp    %esi,%ebx
+  80467f:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804682:	89 f8                	mov    %edi,%eax
+  804684:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804687:	83 ec 0c             	sub    $0xc,%esp
+  80468a:	6a 00                	push   $0x0
+  80468c:	89 d9                	mov    %ebx,%ecx
+  80468e:	e8 97 fd ff ff       	call   80442a <va_chunk_mark>
+		i += n;
+  804693:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804695:	29 de                	sub    %ebx,%esi
+  804697:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  80469a:	85 f6                	test   %esi,%esi
+  80469c:	75 d0                	jne    80466e <va_free+0x51>
+	}
+}
+  80469e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046a1:	5b                   	pop    %ebx
+  8046a2:	5e                   	pop    %esi
+  8046a3:	5f                   	pop    %edi
+  8046a4:	5d                   	pop    %ebp
+  8046a5:	c3                   	ret
+
+008046a6 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8046a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046ab:	c3                   	ret
+
+008046ac <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8046ac:	55                   	push   %ebp
+  8046ad:	89 e5                	mov    %esp,%ebp
+  8046af:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8046b2:	68 95 57 80 00       	push   $0x805795
+  8046b7:	ff 75 0c             	push   0xc(%ebp)
+  8046ba:	e8 1c c1 ff ff       	call   8007db <strcpy>
+	return 0;
+}
+  8046bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046c4:	c9                   	leave
+  8046c5:	c3                   	ret
+
+008046c6 <devcons_write>:
+{
+  8046c6:	55                   	push   %ebp
+  8046c7:	89 e5                	mov    %esp,%ebp
+  8046c9:	57                   	push   %edi
+  8046ca:	56                   	push   %esi
+  8046cb:	53                   	push   %ebx
+  8046cc:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8046d2:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8046d7:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8046dd:	eb 2e                	jmp    80470d <devcons_write+0x47>
+		m = n - tot;
+  8046df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8046e2:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8046e4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8046e9:	39 c3                	cmp    %eax,%ebx
+  8046eb:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8046ee:	83 ec 04             	sub    $0x4,%esp
+  8046f1:	53                   	push   %ebx
+  8046f2:	89 f0                	mov    %esi,%eax
+  8046f4:	03 45 0c             	add    0xc(%ebp),%eax
+  8046f7:	50                   	push   %eax
+  8046f8:	57                   	push   %edi
+  8046f9:	e8 63 c2 ff ff       	call   800961 <memmove>
+		sys_cputs(buf, m);
+  8046fe:	83 c4 08             	add    $0x8,%esp
+  804701:	53                   	push   %ebx
+  804702:	57                   	push   %edi
+  804703:	e8 f9 c4 ff ff       	call   800c01 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804708:	01 de                	add    %ebx,%esi
+  80470a:	83 c4 10             	add    $0x10,%esp
+  80470d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804710:	72 cd                	jb     8046df <devcons_write+0x19>
+}
+  804712:	89 f0                	mov    %esi,%eax
+  804714:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804717:	5b                   	pop    %ebx
+  804718:	5e                   	pop    %esi
+  804719:	5f                   	pop    %edi
+  80471a:	5d                   	pop    %ebp
+  80471b:	c3                   	ret
+
+0080471c <devcons_read>:
+{
+  80471c:	55                   	push   %ebp
+  80471d:	89 e5                	mov    %esp,%ebp
+  80471f:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804722:	b8 00 00 00 00       	mov    $0x0,%eax
+  804727:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80472b:	75 07                	jne    804734 <devcons_read+0x18>
+  80472d:	eb 1f                	jmp    80474e <devcons_read+0x32>
+		sys_yield();
+  80472f:	e8 7b c5 ff ff       	call   800caf <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804734:	e8 f7 c4 ff ff       	call   800c30 <sys_cgetc>
+  804739:	85 c0                	test   %eax,%eax
+  80473b:	74 f2                	je     80472f <devcons_read+0x13>
+	if (c < 0)
+  80473d:	78 0f                	js     80474e <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80473f:	83 f8 04             	cmp    $0x4,%eax
+  804742:	74 0c                	je     804750 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804744:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804747:	88 02                	mov    %al,(%edx)
+	return 1;
+  804749:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80474e:	c9                   	leave
+  80474f:	c3                   	ret
+		return 0;
+  804750:	b8 00 00 00 00       	mov    $0x0,%eax
+  804755:	eb f7                	jmp    80474e <devcons_read+0x32>
+
+00804757 <cputchar>:
+{
+  804757:	55                   	push   %ebp
+  804758:	89 e5                	mov    %esp,%ebp
+  80475a:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80475d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804760:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804763:	6a 01                	push   $0x1
+  804765:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804768:	50                   	push   %eax
+  804769:	e8 93 c4 ff ff       	call   800c01 <sys_cputs>
+}
+  80476e:	83 c4 10             	add    $0x10,%esp
+  804771:	c9                   	leave
+  804772:	c3                   	ret
+
+00804773 <getchar>:
+{
+  804773:	55                   	push   %ebp
+  804774:	89 e5                	mov    %esp,%ebp
+  804776:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804779:	6a 01                	push   $0x1
+  80477b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80477e:	50                   	push   %eax
+  80477f:	6a 00                	push   $0x0
+  804781:	e8 d7 ce ff ff       	call   80165d <read>
+	if (r < 0)
+  804786:	83 c4 10             	add    $0x10,%esp
+  804789:	85 c0                	test   %eax,%eax
+  80478b:	78 06                	js     804793 <getchar+0x20>
+	if (r < 1)
+  80478d:	74 06                	je     804795 <getchar+0x22>
+	return c;
+  80478f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804793:	c9                   	leave
+  804794:	c3                   	ret
+		return -E_EOF;
+  804795:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80479a:	eb f7                	jmp    804793 <getchar+0x20>
+
+0080479c <iscons>:
+{
+  80479c:	55                   	push   %ebp
+  80479d:	89 e5                	mov    %esp,%ebp
+  80479f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8047a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8047a5:	50                   	push   %eax
+  8047a6:	ff 75 08             	push   0x8(%ebp)
+  8047a9:	e8 50 cc ff ff       	call   8013fe <fd_lookup>
+  8047ae:	83 c4 10             	add    $0x10,%esp
+  8047b1:	85 c0                	test   %eax,%eax
+  8047b3:	78 11                	js     8047c6 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8047b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047b8:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  8047be:	39 10                	cmp    %edx,(%eax)
+  8047c0:	0f 94 c0             	sete   %al
+  8047c3:	0f b6 c0             	movzbl %al,%eax
+}
+  8047c6:	c9                   	leave
+  8047c7:	c3                   	ret
+
+008047c8 <opencons>:
+{
+  8047c8:	55                   	push   %ebp
+  8047c9:	89 e5                	mov    %esp,%ebp
+  8047cb:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8047ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8047d1:	50                   	push   %eax
+  8047d2:	e8 d3 cb ff ff       	call   8013aa <fd_alloc>
+  8047d7:	83 c4 10             	add    $0x10,%esp
+  8047da:	85 c0                	test   %eax,%eax
+  8047dc:	78 3a                	js     804818 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8047de:	83 ec 04             	sub    $0x4,%esp
+  8047e1:	68 07 04 00 00       	push   $0x407
+  8047e6:	ff 75 f4             	push   -0xc(%ebp)
+  8047e9:	6a 00                	push   $0x0
+  8047eb:	e8 de c4 ff ff       	call   800cce <sys_page_alloc>
+  8047f0:	83 c4 10             	add    $0x10,%esp
+  8047f3:	85 c0                	test   %eax,%eax
+  8047f5:	78 21                	js     804818 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8047f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047fa:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804800:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804802:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804805:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80480c:	83 ec 0c             	sub    $0xc,%esp
+  80480f:	50                   	push   %eax
+  804810:	e8 6e cb ff ff       	call   801383 <fd2num>
+  804815:	83 c4 10             	add    $0x10,%esp
+}
+  804818:	c9                   	leave
+  804819:	c3                   	ret
+
+0080481a <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  80481a:	55                   	push   %ebp
+  80481b:	89 e5                	mov    %esp,%ebp
+  80481d:	57                   	push   %edi
+  80481e:	56                   	push   %esi
+  80481f:	53                   	push   %ebx
+  804820:	83 ec 14             	sub    $0x14,%esp
+  804823:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804826:	8b 75 14             	mov    0x14(%ebp),%esi
+  804829:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  80482c:	ff 75 10             	push   0x10(%ebp)
+  80482f:	ff 75 0c             	push   0xc(%ebp)
+  804832:	e8 ba c8 ff ff       	call   8010f1 <sys_ipc_recv_pages>
+  804837:	83 c4 10             	add    $0x10,%esp
+  80483a:	85 c0                	test   %eax,%eax
+  80483c:	78 46                	js     804884 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80483e:	85 ff                	test   %edi,%edi
+  804840:	74 0d                	je     80484f <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804842:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804847:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80484d:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80484f:	85 f6                	test   %esi,%esi
+  804851:	74 0d                	je     804860 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804853:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804858:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80485e:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804860:	85 db                	test   %ebx,%ebx
+  804862:	74 0d                	je     804871 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804864:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804869:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80486f:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804871:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804876:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80487c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80487f:	5b                   	pop    %ebx
+  804880:	5e                   	pop    %esi
+  804881:	5f                   	pop    %edi
+  804882:	5d                   	pop    %ebp
+  804883:	c3                   	ret
+		if (from_env_store) {
+  804884:	85 ff                	test   %edi,%edi
+  804886:	74 06                	je     80488e <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  804888:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80488e:	85 f6                	test   %esi,%esi
+  804890:	74 06                	je     804898 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804892:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804898:	85 db                	test   %ebx,%ebx
+  80489a:	74 e0                	je     80487c <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  80489c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8048a2:	eb d8                	jmp    80487c <ipc_recv_pages+0x62>
+
+008048a4 <ipc_recv>:
+{
+  8048a4:	55                   	push   %ebp
+  8048a5:	89 e5                	mov    %esp,%ebp
+  8048a7:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8048aa:	6a 00                	push   $0x0
+  8048ac:	ff 75 10             	push   0x10(%ebp)
+  8048af:	6a 01                	push   $0x1
+  8048b1:	ff 75 0c             	push   0xc(%ebp)
+  8048b4:	ff 75 08             	push   0x8(%ebp)
+  8048b7:	e8 5e ff ff ff       	call   80481a <ipc_recv_pages>
+}
+  8048bc:	c9                   	leave
+  8048bd:	c3                   	ret
+
+008048be <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8048be:	55                   	push   %ebp
+  8048bf:	89 e5                	mov    %esp,%ebp
+  8048c1:	56                   	push   %esi
+  8048c2:	53                   	push   %ebx
+  8048c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8048c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8048c9:	83 ec 0c             	sub    $0xc,%esp
+  8048cc:	ff 75 0c             	push   0xc(%ebp)
+  8048cf:	e8 51 c9 ff ff       	call   801225 <sys_ipc_try_recv>
+  8048d4:	83 c4 10             	add    $0x10,%esp
+  8048d7:	85 c0                	test   %eax,%eax
+  8048d9:	78 34                	js     80490f <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8048db:	85 f6                	test   %esi,%esi
+  8048dd:	74 0d                	je     8048ec <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8048df:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8048e4:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8048ea:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8048ec:	85 db                	test   %ebx,%ebx
+  8048ee:	74 0d                	je     8048fd <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8048f0:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8048f5:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8048fb:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8048fd:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804902:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804908:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80490b:	5b                   	pop    %ebx
+  80490c:	5e                   	pop    %esi
+  80490d:	5d                   	pop    %ebp
+  80490e:	c3                   	ret
+		if (from_env_store) {
+  80490f:	85 f6                	test   %esi,%esi
+  804911:	74 06                	je     804919 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  804913:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  804919:	85 db                	test   %ebx,%ebx
+  80491b:	74 eb                	je     804908 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  80491d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804923:	eb e3                	jmp    804908 <ipc_try_recv+0x4a>
+
+00804925 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804925:	55                   	push   %ebp
+  804926:	89 e5                	mov    %esp,%ebp
+  804928:	83 ec 14             	sub    $0x14,%esp
+  80492b:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80492e:	85 c0                	test   %eax,%eax
+  804930:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804935:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804938:	ff 75 18             	push   0x18(%ebp)
+  80493b:	ff 75 14             	push   0x14(%ebp)
+  80493e:	50                   	push   %eax
+  80493f:	ff 75 0c             	push   0xc(%ebp)
+  804942:	ff 75 08             	push   0x8(%ebp)
+  804945:	e8 6a c7 ff ff       	call   8010b4 <sys_ipc_send_pages>
+  80494a:	83 c4 20             	add    $0x20,%esp
+  80494d:	85 c0                	test   %eax,%eax
+  80494f:	78 02                	js     804953 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804951:	c9                   	leave
+  804952:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804953:	50                   	push   %eax
+  804954:	68 a4 57 80 00       	push   $0x8057a4
+  804959:	68 80 00 00 00       	push   $0x80
+  80495e:	68 d0 57 80 00       	push   $0x8057d0
+  804963:	e8 b1 b7 ff ff       	call   800119 <_panic>
+
+00804968 <ipc_send>:
+{
+  804968:	55                   	push   %ebp
+  804969:	89 e5                	mov    %esp,%ebp
+  80496b:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  80496e:	ff 75 14             	push   0x14(%ebp)
+  804971:	6a 01                	push   $0x1
+  804973:	ff 75 10             	push   0x10(%ebp)
+  804976:	ff 75 0c             	push   0xc(%ebp)
+  804979:	ff 75 08             	push   0x8(%ebp)
+  80497c:	e8 a4 ff ff ff       	call   804925 <ipc_send_pages>
+}
+  804981:	83 c4 20             	add    $0x20,%esp
+  804984:	c9                   	leave
+  804985:	c3                   	ret
+
+00804986 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804986:	55                   	push   %ebp
+  804987:	89 e5                	mov    %esp,%ebp
+  804989:	83 ec 14             	sub    $0x14,%esp
+  80498c:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80498f:	85 c0                	test   %eax,%eax
+  804991:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804996:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804999:	ff 75 18             	push   0x18(%ebp)
+  80499c:	ff 75 14             	push   0x14(%ebp)
+  80499f:	50                   	push   %eax
+  8049a0:	ff 75 0c             	push   0xc(%ebp)
+  8049a3:	ff 75 08             	push   0x8(%ebp)
+  8049a6:	e8 9a c7 ff ff       	call   801145 <sys_ipc_call>
+  8049ab:	83 c4 20             	add    $0x20,%esp
+  8049ae:	85 c0                	test   %eax,%eax
+  8049b0:	78 0b                	js     8049bd <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  8049b2:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8049b7:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8049bd:	c9                   	leave
+  8049be:	c3                   	ret
+
+008049bf <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  8049bf:	55                   	push   %ebp
+  8049c0:	89 e5                	mov    %esp,%ebp
+  8049c2:	57                   	push   %edi
+  8049c3:	56                   	push   %esi
+  8049c4:	53                   	push   %ebx
+  8049c5:	83 ec 18             	sub    $0x18,%esp
+  8049c8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8049cb:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8049ce:	8b 75 20             	mov    0x20(%ebp),%esi
+  8049d1:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8049d4:	85 c0                	test   %eax,%eax
+  8049d6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8049db:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8049de:	ff 75 18             	push   0x18(%ebp)
+  8049e1:	ff 75 14             	push   0x14(%ebp)
+  8049e4:	50                   	push   %eax
+  8049e5:	ff 75 0c             	push   0xc(%ebp)
+  8049e8:	ff 75 08             	push   0x8(%ebp)
+  8049eb:	e8 96 c7 ff ff       	call   801186 <sys_ipc_reply_recv>
+  8049f0:	83 c4 20             	add    $0x20,%esp
+  8049f3:	85 c0                	test   %eax,%eax
+  8049f5:	78 46                	js     804a3d <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8049f7:	85 ff                	test   %edi,%edi
+  8049f9:	74 0d                	je     804a08 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8049fb:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804a00:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804a06:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804a08:	85 f6                	test   %esi,%esi
+  804a0a:	74 0d                	je     804a19 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  804a0c:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804a11:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804a17:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804a19:	85 db                	test   %ebx,%ebx
+  804a1b:	74 0d                	je     804a2a <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  804a1d:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804a22:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804a28:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804a2a:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804a2f:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804a35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a38:	5b                   	pop    %ebx
+  804a39:	5e                   	pop    %esi
+  804a3a:	5f                   	pop    %edi
+  804a3b:	5d                   	pop    %ebp
+  804a3c:	c3                   	ret
+		if (from_env_store) {
+  804a3d:	85 ff                	test   %edi,%edi
+  804a3f:	74 06                	je     804a47 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  804a41:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804a47:	85 f6                	test   %esi,%esi
+  804a49:	74 06                	je     804a51 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  804a4b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804a51:	85 db                	test   %ebx,%ebx
+  804a53:	74 e0                	je     804a35 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  804a55:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804a5b:	eb d8                	jmp    804a35 <ipc_reply_recv+0x76>
+
+00804a5d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804a5d:	55                   	push   %ebp
+  804a5e:	89 e5                	mov    %esp,%ebp
+  804a60:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804a63:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804a68:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804a6b:	c1 e0 06             	shl    $0x6,%eax
+  804a6e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804a73:	8b 40 50             	mov    0x50(%eax),%eax
+  804a76:	39 c8                	cmp    %ecx,%eax
+  804a78:	74 12                	je     804a8c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804a7a:	83 c2 01             	add    $0x1,%edx
+  804a7d:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804a83:	75 e3                	jne    804a68 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804a85:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a8a:	eb 0e                	jmp    804a9a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804a8c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804a8f:	c1 e0 06             	shl    $0x6,%eax
+  804a92:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804a97:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804a9a:	5d                   	pop    %ebp
+  804a9b:	c3                   	ret
+
+00804a9c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804a9c:	55                   	push   %ebp
+  804a9d:	89 e5                	mov    %esp,%ebp
+  804a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804aa2:	89 c2                	mov    %eax,%edx
+  804aa4:	c1 ea 16             	shr    $0x16,%edx
+  804aa7:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804aae:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804ab3:	f6 c1 01             	test   $0x1,%cl
+  804ab6:	74 1e                	je     804ad6 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  804ab8:	c1 e8 0c             	shr    $0xc,%eax
+  804abb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804ac2:	a8 01                	test   $0x1,%al
+  804ac4:	74 10                	je     804ad6 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804ac6:	c1 e8 0c             	shr    $0xc,%eax
+  804ac9:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  804acc:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  804ad3:	0f b7 d2             	movzwl %dx,%edx
+}
+  804ad6:	89 d0                	mov    %edx,%eax
+  804ad8:	5d                   	pop    %ebp
+  804ad9:	c3                   	ret
+
+00804ada <udivmod>:
+  804ada:	55                   	push   %ebp
+  804adb:	57                   	push   %edi
+  804adc:	56                   	push   %esi
+  804add:	53                   	push   %ebx
+  804ade:	83 ec 24             	sub    $0x24,%esp
+  804ae1:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804ae5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804ae9:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804aed:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804af1:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804af5:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804af9:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  804afd:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804b02:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b07:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b0c:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804b13:	00 
+  804b14:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804b1b:	00 
+  804b1c:	89 fb                	mov    %edi,%ebx
+  804b1e:	eb 08                	jmp    804b28 <udivmod+0x4e>
+  804b20:	83 e9 01             	sub    $0x1,%ecx
+  804b23:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804b26:	74 68                	je     804b90 <udivmod+0xb6>
+  804b28:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804b2c:	01 c0                	add    %eax,%eax
+  804b2e:	89 c6                	mov    %eax,%esi
+  804b30:	89 d7                	mov    %edx,%edi
+  804b32:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804b36:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804b3a:	0f ad d0             	shrd   %cl,%edx,%eax
+  804b3d:	d3 ea                	shr    %cl,%edx
+  804b3f:	f6 c1 20             	test   $0x20,%cl
+  804b42:	74 04                	je     804b48 <udivmod+0x6e>
+  804b44:	89 d0                	mov    %edx,%eax
+  804b46:	31 d2                	xor    %edx,%edx
+  804b48:	83 e0 01             	and    $0x1,%eax
+  804b4b:	89 04 24             	mov    %eax,(%esp)
+  804b4e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804b55:	00 
+  804b56:	8b 04 24             	mov    (%esp),%eax
+  804b59:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804b5d:	09 f0                	or     %esi,%eax
+  804b5f:	09 fa                	or     %edi,%edx
+  804b61:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804b65:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804b69:	39 f0                	cmp    %esi,%eax
+  804b6b:	89 d5                	mov    %edx,%ebp
+  804b6d:	19 fd                	sbb    %edi,%ebp
+  804b6f:	72 af                	jb     804b20 <udivmod+0x46>
+  804b71:	29 f0                	sub    %esi,%eax
+  804b73:	19 fa                	sbb    %edi,%edx
+  804b75:	89 cf                	mov    %ecx,%edi
+  804b77:	c1 ef 05             	shr    $0x5,%edi
+  804b7a:	83 e7 01             	and    $0x1,%edi
+  804b7d:	89 fe                	mov    %edi,%esi
+  804b7f:	83 f6 01             	xor    $0x1,%esi
+  804b82:	d3 e6                	shl    %cl,%esi
+  804b84:	d3 e7                	shl    %cl,%edi
+  804b86:	09 74 24 18          	or     %esi,0x18(%esp)
+  804b8a:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804b8e:	eb 90                	jmp    804b20 <udivmod+0x46>
+  804b90:	85 db                	test   %ebx,%ebx
+  804b92:	74 05                	je     804b99 <udivmod+0xbf>
+  804b94:	89 03                	mov    %eax,(%ebx)
+  804b96:	89 53 04             	mov    %edx,0x4(%ebx)
+  804b99:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804b9d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804ba1:	83 c4 24             	add    $0x24,%esp
+  804ba4:	5b                   	pop    %ebx
+  804ba5:	5e                   	pop    %esi
+  804ba6:	5f                   	pop    %edi
+  804ba7:	5d                   	pop    %ebp
+  804ba8:	c3                   	ret
+
+00804ba9 <__udivdi3>:
+  804ba9:	83 ec 08             	sub    $0x8,%esp
+  804bac:	6a 00                	push   $0x0
+  804bae:	ff 74 24 1c          	push   0x1c(%esp)
+  804bb2:	ff 74 24 1c          	push   0x1c(%esp)
+  804bb6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804bba:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804bbe:	e8 17 ff ff ff       	call   804ada <udivmod>
+  804bc3:	83 c4 14             	add    $0x14,%esp
+  804bc6:	c3                   	ret
+
+00804bc7 <__umoddi3>:
+  804bc7:	83 ec 18             	sub    $0x18,%esp
+  804bca:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804bce:	50                   	push   %eax
+  804bcf:	ff 74 24 2c          	push   0x2c(%esp)
+  804bd3:	ff 74 24 2c          	push   0x2c(%esp)
+  804bd7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804bdb:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804bdf:	e8 f6 fe ff ff       	call   804ada <udivmod>
+  804be4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804be8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804bec:	83 c4 24             	add    $0x24,%esp
+  804bef:	c3                   	ret
+
+00804bf0 <__divdi3>:
+  804bf0:	55                   	push   %ebp
+  804bf1:	57                   	push   %edi
+  804bf2:	56                   	push   %esi
+  804bf3:	53                   	push   %ebx
+  804bf4:	83 ec 10             	sub    $0x10,%esp
+  804bf7:	8b 44 24 24          	mov    0x24(%esp),%eax
+  804bfb:	8b 54 24 28          	mov    0x28(%esp),%edx
+  804bff:	89 c6                	mov    %eax,%esi
+  804c01:	89 d7                	mov    %edx,%edi
+  804c03:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  804c07:	33 7c 24 30          	xor    0x30(%esp),%edi
+  804c0b:	89 74 24 04          	mov    %esi,0x4(%esp)
+  804c0f:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  804c13:	89 c5                	mov    %eax,%ebp
+  804c15:	f7 dd                	neg    %ebp
+  804c17:	89 d6                	mov    %edx,%esi
+  804c19:	83 d6 00             	adc    $0x0,%esi
+  804c1c:	f7 de                	neg    %esi
+  804c1e:	0f 48 e8             	cmovs  %eax,%ebp
+  804c21:	0f 49 d6             	cmovns %esi,%edx
+  804c24:	6a 00                	push   $0x0
+  804c26:	8b 74 24 30          	mov    0x30(%esp),%esi
+  804c2a:	f7 de                	neg    %esi
+  804c2c:	8b 44 24 34          	mov    0x34(%esp),%eax
+  804c30:	83 d0 00             	adc    $0x0,%eax
+  804c33:	f7 d8                	neg    %eax
+  804c35:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  804c3a:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  804c3f:	50                   	push   %eax
+  804c40:	56                   	push   %esi
+  804c41:	89 e8                	mov    %ebp,%eax
+  804c43:	e8 92 fe ff ff       	call   804ada <udivmod>
+  804c48:	83 c4 10             	add    $0x10,%esp
+  804c4b:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  804c50:	78 08                	js     804c5a <__divdi3+0x6a>
+  804c52:	83 c4 0c             	add    $0xc,%esp
+  804c55:	5b                   	pop    %ebx
+  804c56:	5e                   	pop    %esi
+  804c57:	5f                   	pop    %edi
+  804c58:	5d                   	pop    %ebp
+  804c59:	c3                   	ret
+  804c5a:	f7 d8                	neg    %eax
+  804c5c:	83 d2 00             	adc    $0x0,%edx
+  804c5f:	f7 da                	neg    %edx
+  804c61:	eb ef                	jmp    804c52 <__divdi3+0x62>
+
+00804c63 <__moddi3>:
+  804c63:	55                   	push   %ebp
+  804c64:	57                   	push   %edi
+  804c65:	56                   	push   %esi
+  804c66:	53                   	push   %ebx
+  804c67:	83 ec 18             	sub    $0x18,%esp
+  804c6a:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  804c6e:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  804c72:	89 f1                	mov    %esi,%ecx
+  804c74:	f7 d9                	neg    %ecx
+  804c76:	89 da                	mov    %ebx,%edx
+  804c78:	83 d2 00             	adc    $0x0,%edx
+  804c7b:	f7 da                	neg    %edx
+  804c7d:	0f 48 ce             	cmovs  %esi,%ecx
+  804c80:	0f 48 d3             	cmovs  %ebx,%edx
+  804c83:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804c87:	50                   	push   %eax
+  804c88:	8b 74 24 38          	mov    0x38(%esp),%esi
+  804c8c:	f7 de                	neg    %esi
+  804c8e:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  804c92:	83 d0 00             	adc    $0x0,%eax
+  804c95:	f7 d8                	neg    %eax
+  804c97:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  804c9c:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  804ca1:	50                   	push   %eax
+  804ca2:	56                   	push   %esi
+  804ca3:	89 c8                	mov    %ecx,%eax
+  804ca5:	e8 30 fe ff ff       	call   804ada <udivmod>
+  804caa:	83 c4 10             	add    $0x10,%esp
+  804cad:	85 db                	test   %ebx,%ebx
+  804caf:	78 10                	js     804cc1 <__moddi3+0x5e>
+  804cb1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804cb5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804cb9:	83 c4 14             	add    $0x14,%esp
+  804cbc:	5b                   	pop    %ebx
+  804cbd:	5e                   	pop    %esi
+  804cbe:	5f                   	pop    %edi
+  804cbf:	5d                   	pop    %ebp
+  804cc0:	c3                   	ret
+  804cc1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804cc5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804cc9:	f7 d8                	neg    %eax
+  804ccb:	83 d2 00             	adc    $0x0,%edx
+  804cce:	f7 da                	neg    %edx
+  804cd0:	eb e7                	jmp    804cb9 <__moddi3+0x56>
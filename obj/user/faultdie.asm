@@ -0,0 +1,5793 @@
+
+obj/user/faultdie.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 51 00 00 00       	call   800082 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+int
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+  800039:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void*)utf->utf_fault_va;
+	uint32_t err = utf->utf_err;
+	cprintf("i faulted at va %x, err %x\n", addr, err & 7);
+  80003c:	8b 42 04             	mov    0x4(%edx),%eax
+  80003f:	83 e0 07             	and    $0x7,%eax
+  800042:	50                   	push   %eax
+  800043:	ff 32                	push   (%edx)
+  800045:	68 00 28 80 00       	push   $0x802800
+  80004a:	e8 2b 01 00 00       	call   80017a <cprintf>
+	sys_env_destroy(sys_getenvid());
+  80004f:	e8 c2 0b 00 00       	call   800c16 <sys_getenvid>
+  800054:	89 04 24             	mov    %eax,(%esp)
+  800057:	e8 79 0b 00 00       	call   800bd5 <sys_env_destroy>
+	return 1;
+}
+  80005c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800061:	c9                   	leave
+  800062:	c3                   	ret
+
+00800063 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800063:	55                   	push   %ebp
+  800064:	89 e5                	mov    %esp,%ebp
+  800066:	83 ec 14             	sub    $0x14,%esp
+	add_pgfault_handler(handler);
+  800069:	68 33 00 80 00       	push   $0x800033
+  80006e:	e8 0e 12 00 00       	call   801281 <add_pgfault_handler>
+	*(int*)0xDeadBeef = 0;
+  800073:	c7 05 ef be ad de 00 	movl   $0x0,0xdeadbeef
+  80007a:	00 00 00 
+}
+  80007d:	83 c4 10             	add    $0x10,%esp
+  800080:	c9                   	leave
+  800081:	c3                   	ret
+
+00800082 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800082:	55                   	push   %ebp
+  800083:	89 e5                	mov    %esp,%ebp
+  800085:	56                   	push   %esi
+  800086:	53                   	push   %ebx
+  800087:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80008a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  80008d:	e8 84 0b 00 00       	call   800c16 <sys_getenvid>
+  800092:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800097:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80009a:	c1 e0 06             	shl    $0x6,%eax
+  80009d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000a2:	a3 0c 40 80 00       	mov    %eax,0x80400c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000a7:	85 db                	test   %ebx,%ebx
+  8000a9:	7e 07                	jle    8000b2 <libmain+0x30>
+		binaryname = argv[0];
+  8000ab:	8b 06                	mov    (%esi),%eax
+  8000ad:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8000b2:	83 ec 08             	sub    $0x8,%esp
+  8000b5:	56                   	push   %esi
+  8000b6:	53                   	push   %ebx
+  8000b7:	e8 a7 ff ff ff       	call   800063 <umain>
+
+	// exit gracefully
+	exit();
+  8000bc:	e8 0a 00 00 00       	call   8000cb <exit>
+}
+  8000c1:	83 c4 10             	add    $0x10,%esp
+  8000c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000c7:	5b                   	pop    %ebx
+  8000c8:	5e                   	pop    %esi
+  8000c9:	5d                   	pop    %ebp
+  8000ca:	c3                   	ret
+
+008000cb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000cb:	55                   	push   %ebp
+  8000cc:	89 e5                	mov    %esp,%ebp
+  8000ce:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000d1:	e8 fe 13 00 00       	call   8014d4 <close_all>
+	sys_env_destroy(0);
+  8000d6:	83 ec 0c             	sub    $0xc,%esp
+  8000d9:	6a 00                	push   $0x0
+  8000db:	e8 f5 0a 00 00       	call   800bd5 <sys_env_destroy>
+}
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	c9                   	leave
+  8000e4:	c3                   	ret
+
+008000e5 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000e5:	55                   	push   %ebp
+  8000e6:	89 e5                	mov    %esp,%ebp
+  8000e8:	53                   	push   %ebx
+  8000e9:	83 ec 04             	sub    $0x4,%esp
+  8000ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000ef:	8b 13                	mov    (%ebx),%edx
+  8000f1:	8d 42 01             	lea    0x1(%edx),%eax
+  8000f4:	89 03                	mov    %eax,(%ebx)
+  8000f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000f9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000fd:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800102:	74 09                	je     80010d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800104:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800108:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80010b:	c9                   	leave
+  80010c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80010d:	83 ec 08             	sub    $0x8,%esp
+  800110:	68 ff 00 00 00       	push   $0xff
+  800115:	8d 43 08             	lea    0x8(%ebx),%eax
+  800118:	50                   	push   %eax
+  800119:	e8 69 0a 00 00       	call   800b87 <sys_cputs>
+		b->idx = 0;
+  80011e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800124:	83 c4 10             	add    $0x10,%esp
+  800127:	eb db                	jmp    800104 <putch+0x1f>
+
+00800129 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800129:	55                   	push   %ebp
+  80012a:	89 e5                	mov    %esp,%ebp
+  80012c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800132:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800139:	00 00 00 
+	b.cnt = 0;
+  80013c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800143:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800146:	ff 75 0c             	push   0xc(%ebp)
+  800149:	ff 75 08             	push   0x8(%ebp)
+  80014c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800152:	50                   	push   %eax
+  800153:	68 e5 00 80 00       	push   $0x8000e5
+  800158:	e8 14 01 00 00       	call   800271 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80015d:	83 c4 08             	add    $0x8,%esp
+  800160:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800166:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80016c:	50                   	push   %eax
+  80016d:	e8 15 0a 00 00       	call   800b87 <sys_cputs>
+
+	return b.cnt;
+}
+  800172:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800178:	c9                   	leave
+  800179:	c3                   	ret
+
+0080017a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80017a:	55                   	push   %ebp
+  80017b:	89 e5                	mov    %esp,%ebp
+  80017d:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800180:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800183:	50                   	push   %eax
+  800184:	ff 75 08             	push   0x8(%ebp)
+  800187:	e8 9d ff ff ff       	call   800129 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80018c:	c9                   	leave
+  80018d:	c3                   	ret
+
+0080018e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80018e:	55                   	push   %ebp
+  80018f:	89 e5                	mov    %esp,%ebp
+  800191:	57                   	push   %edi
+  800192:	56                   	push   %esi
+  800193:	53                   	push   %ebx
+  800194:	83 ec 1c             	sub    $0x1c,%esp
+  800197:	89 c7                	mov    %eax,%edi
+  800199:	89 d6                	mov    %edx,%esi
+  80019b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80019e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001a1:	89 d1                	mov    %edx,%ecx
+  8001a3:	89 c2                	mov    %eax,%edx
+  8001a5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001a8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001ab:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001ae:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001b4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001bb:	39 c2                	cmp    %eax,%edx
+  8001bd:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001c0:	72 3e                	jb     800200 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001c2:	83 ec 0c             	sub    $0xc,%esp
+  8001c5:	ff 75 18             	push   0x18(%ebp)
+  8001c8:	83 eb 01             	sub    $0x1,%ebx
+  8001cb:	53                   	push   %ebx
+  8001cc:	50                   	push   %eax
+  8001cd:	83 ec 08             	sub    $0x8,%esp
+  8001d0:	ff 75 e4             	push   -0x1c(%ebp)
+  8001d3:	ff 75 e0             	push   -0x20(%ebp)
+  8001d6:	ff 75 dc             	push   -0x24(%ebp)
+  8001d9:	ff 75 d8             	push   -0x28(%ebp)
+  8001dc:	e8 dd 24 00 00       	call   8026be <__udivdi3>
+  8001e1:	83 c4 18             	add    $0x18,%esp
+  8001e4:	52                   	push   %edx
+  8001e5:	50                   	push   %eax
+  8001e6:	89 f2                	mov    %esi,%edx
+  8001e8:	89 f8                	mov    %edi,%eax
+  8001ea:	e8 9f ff ff ff       	call   80018e <printnum>
+  8001ef:	83 c4 20             	add    $0x20,%esp
+  8001f2:	eb 13                	jmp    800207 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001f4:	83 ec 08             	sub    $0x8,%esp
+  8001f7:	56                   	push   %esi
+  8001f8:	ff 75 18             	push   0x18(%ebp)
+  8001fb:	ff d7                	call   *%edi
+  8001fd:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800200:	83 eb 01             	sub    $0x1,%ebx
+  800203:	85 db                	test   %ebx,%ebx
+  800205:	7f ed                	jg     8001f4 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800207:	83 ec 08             	sub    $0x8,%esp
+  80020a:	56                   	push   %esi
+  80020b:	83 ec 04             	sub    $0x4,%esp
+  80020e:	ff 75 e4             	push   -0x1c(%ebp)
+  800211:	ff 75 e0             	push   -0x20(%ebp)
+  800214:	ff 75 dc             	push   -0x24(%ebp)
+  800217:	ff 75 d8             	push   -0x28(%ebp)
+  80021a:	e8 bd 24 00 00       	call   8026dc <__umoddi3>
+  80021f:	83 c4 14             	add    $0x14,%esp
+  800222:	0f be 80 26 28 80 00 	movsbl 0x802826(%eax),%eax
+  800229:	50                   	push   %eax
+  80022a:	ff d7                	call   *%edi
+}
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800232:	5b                   	pop    %ebx
+  800233:	5e                   	pop    %esi
+  800234:	5f                   	pop    %edi
+  800235:	5d                   	pop    %ebp
+  800236:	c3                   	ret
+
+00800237 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80023d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800241:	8b 10                	mov    (%eax),%edx
+  800243:	3b 50 04             	cmp    0x4(%eax),%edx
+  800246:	73 0a                	jae    800252 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800248:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80024b:	89 08                	mov    %ecx,(%eax)
+  80024d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800250:	88 02                	mov    %al,(%edx)
+}
+  800252:	5d                   	pop    %ebp
+  800253:	c3                   	ret
+
+00800254 <printfmt>:
+{
+  800254:	55                   	push   %ebp
+  800255:	89 e5                	mov    %esp,%ebp
+  800257:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80025a:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80025d:	50                   	push   %eax
+  80025e:	ff 75 10             	push   0x10(%ebp)
+  800261:	ff 75 0c             	push   0xc(%ebp)
+  800264:	ff 75 08             	push   0x8(%ebp)
+  800267:	e8 05 00 00 00       	call   800271 <vprintfmt>
+}
+  80026c:	83 c4 10             	add    $0x10,%esp
+  80026f:	c9                   	leave
+  800270:	c3                   	ret
+
+00800271 <vprintfmt>:
+{
+  800271:	55                   	push   %ebp
+  800272:	89 e5                	mov    %esp,%ebp
+  800274:	57                   	push   %edi
+  800275:	56                   	push   %esi
+  800276:	53                   	push   %ebx
+  800277:	83 ec 2c             	sub    $0x2c,%esp
+  80027a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80027d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800280:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800283:	eb 0a                	jmp    80028f <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800285:	83 ec 08             	sub    $0x8,%esp
+  800288:	53                   	push   %ebx
+  800289:	50                   	push   %eax
+  80028a:	ff d6                	call   *%esi
+  80028c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80028f:	83 c7 01             	add    $0x1,%edi
+  800292:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800296:	83 f8 25             	cmp    $0x25,%eax
+  800299:	74 0c                	je     8002a7 <vprintfmt+0x36>
+			if (ch == '\0')
+  80029b:	85 c0                	test   %eax,%eax
+  80029d:	75 e6                	jne    800285 <vprintfmt+0x14>
+}
+  80029f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a2:	5b                   	pop    %ebx
+  8002a3:	5e                   	pop    %esi
+  8002a4:	5f                   	pop    %edi
+  8002a5:	5d                   	pop    %ebp
+  8002a6:	c3                   	ret
+		padc = ' ';
+  8002a7:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002ab:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002b2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002b9:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002c5:	8d 47 01             	lea    0x1(%edi),%eax
+  8002c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002cb:	0f b6 17             	movzbl (%edi),%edx
+  8002ce:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002d1:	3c 55                	cmp    $0x55,%al
+  8002d3:	0f 87 c5 03 00 00    	ja     80069e <vprintfmt+0x42d>
+  8002d9:	0f b6 c0             	movzbl %al,%eax
+  8002dc:	ff 24 85 a0 29 80 00 	jmp    *0x8029a0(,%eax,4)
+  8002e3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002e6:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002ea:	eb d9                	jmp    8002c5 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002ec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002ef:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002f3:	eb d0                	jmp    8002c5 <vprintfmt+0x54>
+  8002f5:	0f b6 d2             	movzbl %dl,%edx
+  8002f8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800300:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800303:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800306:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80030a:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80030d:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800310:	83 f9 09             	cmp    $0x9,%ecx
+  800313:	77 55                	ja     80036a <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800315:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800318:	eb e9                	jmp    800303 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80031a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80031d:	8b 00                	mov    (%eax),%eax
+  80031f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800322:	8b 45 14             	mov    0x14(%ebp),%eax
+  800325:	8d 40 04             	lea    0x4(%eax),%eax
+  800328:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80032b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80032e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800332:	79 91                	jns    8002c5 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800334:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800337:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80033a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800341:	eb 82                	jmp    8002c5 <vprintfmt+0x54>
+			if (width < 0)
+  800343:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800346:	85 d2                	test   %edx,%edx
+  800348:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034d:	0f 49 c2             	cmovns %edx,%eax
+  800350:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800353:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800356:	e9 6a ff ff ff       	jmp    8002c5 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80035b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80035e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800365:	e9 5b ff ff ff       	jmp    8002c5 <vprintfmt+0x54>
+  80036a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80036d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800370:	eb bc                	jmp    80032e <vprintfmt+0xbd>
+			lflag++;
+  800372:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800375:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800378:	e9 48 ff ff ff       	jmp    8002c5 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80037d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800380:	8d 78 04             	lea    0x4(%eax),%edi
+  800383:	83 ec 08             	sub    $0x8,%esp
+  800386:	53                   	push   %ebx
+  800387:	ff 30                	push   (%eax)
+  800389:	ff d6                	call   *%esi
+			break;
+  80038b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80038e:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800391:	e9 63 02 00 00       	jmp    8005f9 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800396:	8b 45 14             	mov    0x14(%ebp),%eax
+  800399:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80039c:	8b 10                	mov    (%eax),%edx
+  80039e:	89 d0                	mov    %edx,%eax
+  8003a0:	f7 d8                	neg    %eax
+  8003a2:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003a5:	83 f8 12             	cmp    $0x12,%eax
+  8003a8:	7f 23                	jg     8003cd <vprintfmt+0x15c>
+  8003aa:	8b 14 85 00 2b 80 00 	mov    0x802b00(,%eax,4),%edx
+  8003b1:	85 d2                	test   %edx,%edx
+  8003b3:	74 18                	je     8003cd <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003b5:	52                   	push   %edx
+  8003b6:	68 89 2c 80 00       	push   $0x802c89
+  8003bb:	53                   	push   %ebx
+  8003bc:	56                   	push   %esi
+  8003bd:	e8 92 fe ff ff       	call   800254 <printfmt>
+  8003c2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003c5:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003c8:	e9 2c 02 00 00       	jmp    8005f9 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  8003cd:	50                   	push   %eax
+  8003ce:	68 3e 28 80 00       	push   $0x80283e
+  8003d3:	53                   	push   %ebx
+  8003d4:	56                   	push   %esi
+  8003d5:	e8 7a fe ff ff       	call   800254 <printfmt>
+  8003da:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003dd:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003e0:	e9 14 02 00 00       	jmp    8005f9 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e8:	83 c0 04             	add    $0x4,%eax
+  8003eb:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f1:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003f3:	85 c9                	test   %ecx,%ecx
+  8003f5:	b8 37 28 80 00       	mov    $0x802837,%eax
+  8003fa:	0f 45 c1             	cmovne %ecx,%eax
+  8003fd:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800400:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800404:	7e 06                	jle    80040c <vprintfmt+0x19b>
+  800406:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80040a:	75 0b                	jne    800417 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80040c:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80040f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800412:	89 75 08             	mov    %esi,0x8(%ebp)
+  800415:	eb 5c                	jmp    800473 <vprintfmt+0x202>
+  800417:	83 ec 08             	sub    $0x8,%esp
+  80041a:	ff 75 d0             	push   -0x30(%ebp)
+  80041d:	ff 75 cc             	push   -0x34(%ebp)
+  800420:	e8 19 03 00 00       	call   80073e <strnlen>
+  800425:	89 c2                	mov    %eax,%edx
+  800427:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80042a:	29 d0                	sub    %edx,%eax
+  80042c:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80042f:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800433:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800436:	89 75 08             	mov    %esi,0x8(%ebp)
+  800439:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80043b:	eb 0e                	jmp    80044b <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80043d:	83 ec 08             	sub    $0x8,%esp
+  800440:	53                   	push   %ebx
+  800441:	57                   	push   %edi
+  800442:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800445:	83 ee 01             	sub    $0x1,%esi
+  800448:	83 c4 10             	add    $0x10,%esp
+  80044b:	85 f6                	test   %esi,%esi
+  80044d:	7f ee                	jg     80043d <vprintfmt+0x1cc>
+  80044f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800452:	8b 75 08             	mov    0x8(%ebp),%esi
+  800455:	85 c0                	test   %eax,%eax
+  800457:	ba 00 00 00 00       	mov    $0x0,%edx
+  80045c:	0f 49 d0             	cmovns %eax,%edx
+  80045f:	29 d0                	sub    %edx,%eax
+  800461:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800464:	eb a6                	jmp    80040c <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800466:	83 ec 08             	sub    $0x8,%esp
+  800469:	53                   	push   %ebx
+  80046a:	52                   	push   %edx
+  80046b:	ff 55 08             	call   *0x8(%ebp)
+  80046e:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800471:	89 f1                	mov    %esi,%ecx
+  800473:	8d 71 01             	lea    0x1(%ecx),%esi
+  800476:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80047a:	0f be d0             	movsbl %al,%edx
+  80047d:	85 d2                	test   %edx,%edx
+  80047f:	74 28                	je     8004a9 <vprintfmt+0x238>
+  800481:	85 ff                	test   %edi,%edi
+  800483:	78 05                	js     80048a <vprintfmt+0x219>
+  800485:	83 ef 01             	sub    $0x1,%edi
+  800488:	78 30                	js     8004ba <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80048a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80048e:	74 d6                	je     800466 <vprintfmt+0x1f5>
+  800490:	0f be c0             	movsbl %al,%eax
+  800493:	83 e8 20             	sub    $0x20,%eax
+  800496:	83 f8 5e             	cmp    $0x5e,%eax
+  800499:	76 cb                	jbe    800466 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80049b:	83 ec 08             	sub    $0x8,%esp
+  80049e:	53                   	push   %ebx
+  80049f:	6a 3f                	push   $0x3f
+  8004a1:	ff 55 08             	call   *0x8(%ebp)
+  8004a4:	83 c4 10             	add    $0x10,%esp
+  8004a7:	eb c8                	jmp    800471 <vprintfmt+0x200>
+  8004a9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ac:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004af:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004b2:	01 d0                	add    %edx,%eax
+  8004b4:	29 c8                	sub    %ecx,%eax
+  8004b6:	89 c7                	mov    %eax,%edi
+  8004b8:	eb 13                	jmp    8004cd <vprintfmt+0x25c>
+  8004ba:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004bd:	eb ed                	jmp    8004ac <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004bf:	83 ec 08             	sub    $0x8,%esp
+  8004c2:	53                   	push   %ebx
+  8004c3:	6a 20                	push   $0x20
+  8004c5:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004c7:	83 ef 01             	sub    $0x1,%edi
+  8004ca:	83 c4 10             	add    $0x10,%esp
+  8004cd:	85 ff                	test   %edi,%edi
+  8004cf:	7f ee                	jg     8004bf <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004d1:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004d4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004d7:	e9 1d 01 00 00       	jmp    8005f9 <vprintfmt+0x388>
+	if (lflag >= 2)
+  8004dc:	83 f9 01             	cmp    $0x1,%ecx
+  8004df:	7f 1b                	jg     8004fc <vprintfmt+0x28b>
+	else if (lflag)
+  8004e1:	85 c9                	test   %ecx,%ecx
+  8004e3:	74 63                	je     800548 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  8004e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e8:	8b 00                	mov    (%eax),%eax
+  8004ea:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004ed:	99                   	cltd
+  8004ee:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f4:	8d 40 04             	lea    0x4(%eax),%eax
+  8004f7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004fa:	eb 17                	jmp    800513 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  8004fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ff:	8b 50 04             	mov    0x4(%eax),%edx
+  800502:	8b 00                	mov    (%eax),%eax
+  800504:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800507:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80050a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050d:	8d 40 08             	lea    0x8(%eax),%eax
+  800510:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800513:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800516:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800519:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80051e:	85 c9                	test   %ecx,%ecx
+  800520:	0f 89 b9 00 00 00    	jns    8005df <vprintfmt+0x36e>
+				putch('-', putdat);
+  800526:	83 ec 08             	sub    $0x8,%esp
+  800529:	53                   	push   %ebx
+  80052a:	6a 2d                	push   $0x2d
+  80052c:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80052e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800531:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800534:	f7 da                	neg    %edx
+  800536:	83 d1 00             	adc    $0x0,%ecx
+  800539:	f7 d9                	neg    %ecx
+  80053b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80053e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800543:	e9 97 00 00 00       	jmp    8005df <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800548:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054b:	8b 00                	mov    (%eax),%eax
+  80054d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800550:	99                   	cltd
+  800551:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800554:	8b 45 14             	mov    0x14(%ebp),%eax
+  800557:	8d 40 04             	lea    0x4(%eax),%eax
+  80055a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80055d:	eb b4                	jmp    800513 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  80055f:	83 f9 01             	cmp    $0x1,%ecx
+  800562:	7f 1b                	jg     80057f <vprintfmt+0x30e>
+	else if (lflag)
+  800564:	85 c9                	test   %ecx,%ecx
+  800566:	74 2c                	je     800594 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800568:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056b:	8b 10                	mov    (%eax),%edx
+  80056d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800572:	8d 40 04             	lea    0x4(%eax),%eax
+  800575:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800578:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80057d:	eb 60                	jmp    8005df <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80057f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800582:	8b 10                	mov    (%eax),%edx
+  800584:	8b 48 04             	mov    0x4(%eax),%ecx
+  800587:	8d 40 08             	lea    0x8(%eax),%eax
+  80058a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80058d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800592:	eb 4b                	jmp    8005df <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800594:	8b 45 14             	mov    0x14(%ebp),%eax
+  800597:	8b 10                	mov    (%eax),%edx
+  800599:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80059e:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005a4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005a9:	eb 34                	jmp    8005df <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8005ab:	83 f9 01             	cmp    $0x1,%ecx
+  8005ae:	7f 15                	jg     8005c5 <vprintfmt+0x354>
+	else if (lflag)
+  8005b0:	85 c9                	test   %ecx,%ecx
+  8005b2:	74 4d                	je     800601 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8005b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b7:	8b 00                	mov    (%eax),%eax
+  8005b9:	99                   	cltd
+  8005ba:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005bd:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8005c0:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8005c3:	eb 11                	jmp    8005d6 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  8005c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c8:	8b 50 04             	mov    0x4(%eax),%edx
+  8005cb:	8b 00                	mov    (%eax),%eax
+  8005cd:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005d0:	8d 49 08             	lea    0x8(%ecx),%ecx
+  8005d3:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  8005d6:	89 d1                	mov    %edx,%ecx
+  8005d8:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  8005da:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005df:	83 ec 0c             	sub    $0xc,%esp
+  8005e2:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8005e6:	50                   	push   %eax
+  8005e7:	ff 75 e0             	push   -0x20(%ebp)
+  8005ea:	57                   	push   %edi
+  8005eb:	51                   	push   %ecx
+  8005ec:	52                   	push   %edx
+  8005ed:	89 da                	mov    %ebx,%edx
+  8005ef:	89 f0                	mov    %esi,%eax
+  8005f1:	e8 98 fb ff ff       	call   80018e <printnum>
+			break;
+  8005f6:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8005f9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005fc:	e9 8e fc ff ff       	jmp    80028f <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800601:	8b 45 14             	mov    0x14(%ebp),%eax
+  800604:	8b 00                	mov    (%eax),%eax
+  800606:	99                   	cltd
+  800607:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80060a:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80060d:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800610:	eb c4                	jmp    8005d6 <vprintfmt+0x365>
+			putch('0', putdat);
+  800612:	83 ec 08             	sub    $0x8,%esp
+  800615:	53                   	push   %ebx
+  800616:	6a 30                	push   $0x30
+  800618:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80061a:	83 c4 08             	add    $0x8,%esp
+  80061d:	53                   	push   %ebx
+  80061e:	6a 78                	push   $0x78
+  800620:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800622:	8b 45 14             	mov    0x14(%ebp),%eax
+  800625:	8b 10                	mov    (%eax),%edx
+  800627:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80062c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80062f:	8d 40 04             	lea    0x4(%eax),%eax
+  800632:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800635:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  80063a:	eb a3                	jmp    8005df <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80063c:	83 f9 01             	cmp    $0x1,%ecx
+  80063f:	7f 1b                	jg     80065c <vprintfmt+0x3eb>
+	else if (lflag)
+  800641:	85 c9                	test   %ecx,%ecx
+  800643:	74 2f                	je     800674 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800645:	8b 45 14             	mov    0x14(%ebp),%eax
+  800648:	8b 10                	mov    (%eax),%edx
+  80064a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064f:	8d 40 04             	lea    0x4(%eax),%eax
+  800652:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800655:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80065a:	eb 83                	jmp    8005df <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80065c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065f:	8b 10                	mov    (%eax),%edx
+  800661:	8b 48 04             	mov    0x4(%eax),%ecx
+  800664:	8d 40 08             	lea    0x8(%eax),%eax
+  800667:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80066a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80066f:	e9 6b ff ff ff       	jmp    8005df <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800674:	8b 45 14             	mov    0x14(%ebp),%eax
+  800677:	8b 10                	mov    (%eax),%edx
+  800679:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067e:	8d 40 04             	lea    0x4(%eax),%eax
+  800681:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800684:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800689:	e9 51 ff ff ff       	jmp    8005df <vprintfmt+0x36e>
+			putch(ch, putdat);
+  80068e:	83 ec 08             	sub    $0x8,%esp
+  800691:	53                   	push   %ebx
+  800692:	6a 25                	push   $0x25
+  800694:	ff d6                	call   *%esi
+			break;
+  800696:	83 c4 10             	add    $0x10,%esp
+  800699:	e9 5b ff ff ff       	jmp    8005f9 <vprintfmt+0x388>
+			putch('%', putdat);
+  80069e:	83 ec 08             	sub    $0x8,%esp
+  8006a1:	53                   	push   %ebx
+  8006a2:	6a 25                	push   $0x25
+  8006a4:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006a6:	83 c4 10             	add    $0x10,%esp
+  8006a9:	89 f8                	mov    %edi,%eax
+  8006ab:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006af:	74 05                	je     8006b6 <vprintfmt+0x445>
+  8006b1:	83 e8 01             	sub    $0x1,%eax
+  8006b4:	eb f5                	jmp    8006ab <vprintfmt+0x43a>
+  8006b6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006b9:	e9 3b ff ff ff       	jmp    8005f9 <vprintfmt+0x388>
+
+008006be <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006be:	55                   	push   %ebp
+  8006bf:	89 e5                	mov    %esp,%ebp
+  8006c1:	83 ec 18             	sub    $0x18,%esp
+  8006c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006ca:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006cd:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006d1:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006d4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006db:	85 c0                	test   %eax,%eax
+  8006dd:	74 26                	je     800705 <vsnprintf+0x47>
+  8006df:	85 d2                	test   %edx,%edx
+  8006e1:	7e 22                	jle    800705 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006e3:	ff 75 14             	push   0x14(%ebp)
+  8006e6:	ff 75 10             	push   0x10(%ebp)
+  8006e9:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006ec:	50                   	push   %eax
+  8006ed:	68 37 02 80 00       	push   $0x800237
+  8006f2:	e8 7a fb ff ff       	call   800271 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006f7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006fa:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800700:	83 c4 10             	add    $0x10,%esp
+}
+  800703:	c9                   	leave
+  800704:	c3                   	ret
+		return -E_INVAL;
+  800705:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80070a:	eb f7                	jmp    800703 <vsnprintf+0x45>
+
+0080070c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80070c:	55                   	push   %ebp
+  80070d:	89 e5                	mov    %esp,%ebp
+  80070f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800712:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800715:	50                   	push   %eax
+  800716:	ff 75 10             	push   0x10(%ebp)
+  800719:	ff 75 0c             	push   0xc(%ebp)
+  80071c:	ff 75 08             	push   0x8(%ebp)
+  80071f:	e8 9a ff ff ff       	call   8006be <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800724:	c9                   	leave
+  800725:	c3                   	ret
+
+00800726 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800726:	55                   	push   %ebp
+  800727:	89 e5                	mov    %esp,%ebp
+  800729:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80072c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800731:	eb 03                	jmp    800736 <strlen+0x10>
+		n++;
+  800733:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800736:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80073a:	75 f7                	jne    800733 <strlen+0xd>
+	return n;
+}
+  80073c:	5d                   	pop    %ebp
+  80073d:	c3                   	ret
+
+0080073e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80073e:	55                   	push   %ebp
+  80073f:	89 e5                	mov    %esp,%ebp
+  800741:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800744:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800747:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074c:	eb 03                	jmp    800751 <strnlen+0x13>
+		n++;
+  80074e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800751:	39 d0                	cmp    %edx,%eax
+  800753:	74 08                	je     80075d <strnlen+0x1f>
+  800755:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800759:	75 f3                	jne    80074e <strnlen+0x10>
+  80075b:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80075d:	89 d0                	mov    %edx,%eax
+  80075f:	5d                   	pop    %ebp
+  800760:	c3                   	ret
+
+00800761 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800761:	55                   	push   %ebp
+  800762:	89 e5                	mov    %esp,%ebp
+  800764:	53                   	push   %ebx
+  800765:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800768:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80076b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800770:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800774:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800777:	83 c0 01             	add    $0x1,%eax
+  80077a:	84 d2                	test   %dl,%dl
+  80077c:	75 f2                	jne    800770 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80077e:	89 c8                	mov    %ecx,%eax
+  800780:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800783:	c9                   	leave
+  800784:	c3                   	ret
+
+00800785 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800785:	55                   	push   %ebp
+  800786:	89 e5                	mov    %esp,%ebp
+  800788:	53                   	push   %ebx
+  800789:	83 ec 10             	sub    $0x10,%esp
+  80078c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80078f:	53                   	push   %ebx
+  800790:	e8 91 ff ff ff       	call   800726 <strlen>
+  800795:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800798:	ff 75 0c             	push   0xc(%ebp)
+  80079b:	01 d8                	add    %ebx,%eax
+  80079d:	50                   	push   %eax
+  80079e:	e8 be ff ff ff       	call   800761 <strcpy>
+	return dst;
+}
+  8007a3:	89 d8                	mov    %ebx,%eax
+  8007a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007a8:	c9                   	leave
+  8007a9:	c3                   	ret
+
+008007aa <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007aa:	55                   	push   %ebp
+  8007ab:	89 e5                	mov    %esp,%ebp
+  8007ad:	56                   	push   %esi
+  8007ae:	53                   	push   %ebx
+  8007af:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007b5:	89 f3                	mov    %esi,%ebx
+  8007b7:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007ba:	89 f0                	mov    %esi,%eax
+  8007bc:	eb 0f                	jmp    8007cd <strncpy+0x23>
+		*dst++ = *src;
+  8007be:	83 c0 01             	add    $0x1,%eax
+  8007c1:	0f b6 0a             	movzbl (%edx),%ecx
+  8007c4:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007c7:	80 f9 01             	cmp    $0x1,%cl
+  8007ca:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007cd:	39 d8                	cmp    %ebx,%eax
+  8007cf:	75 ed                	jne    8007be <strncpy+0x14>
+	}
+	return ret;
+}
+  8007d1:	89 f0                	mov    %esi,%eax
+  8007d3:	5b                   	pop    %ebx
+  8007d4:	5e                   	pop    %esi
+  8007d5:	5d                   	pop    %ebp
+  8007d6:	c3                   	ret
+
+008007d7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007d7:	55                   	push   %ebp
+  8007d8:	89 e5                	mov    %esp,%ebp
+  8007da:	56                   	push   %esi
+  8007db:	53                   	push   %ebx
+  8007dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007e2:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007e5:	89 f0                	mov    %esi,%eax
+  8007e7:	85 d2                	test   %edx,%edx
+  8007e9:	74 21                	je     80080c <strlcpy+0x35>
+  8007eb:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007ef:	89 f2                	mov    %esi,%edx
+  8007f1:	eb 09                	jmp    8007fc <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007f3:	83 c1 01             	add    $0x1,%ecx
+  8007f6:	83 c2 01             	add    $0x1,%edx
+  8007f9:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007fc:	39 c2                	cmp    %eax,%edx
+  8007fe:	74 09                	je     800809 <strlcpy+0x32>
+  800800:	0f b6 19             	movzbl (%ecx),%ebx
+  800803:	84 db                	test   %bl,%bl
+  800805:	75 ec                	jne    8007f3 <strlcpy+0x1c>
+  800807:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800809:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80080c:	29 f0                	sub    %esi,%eax
+}
+  80080e:	5b                   	pop    %ebx
+  80080f:	5e                   	pop    %esi
+  800810:	5d                   	pop    %ebp
+  800811:	c3                   	ret
+
+00800812 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800812:	55                   	push   %ebp
+  800813:	89 e5                	mov    %esp,%ebp
+  800815:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800818:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80081b:	eb 06                	jmp    800823 <strcmp+0x11>
+		p++, q++;
+  80081d:	83 c1 01             	add    $0x1,%ecx
+  800820:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800823:	0f b6 01             	movzbl (%ecx),%eax
+  800826:	84 c0                	test   %al,%al
+  800828:	74 04                	je     80082e <strcmp+0x1c>
+  80082a:	3a 02                	cmp    (%edx),%al
+  80082c:	74 ef                	je     80081d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80082e:	0f b6 c0             	movzbl %al,%eax
+  800831:	0f b6 12             	movzbl (%edx),%edx
+  800834:	29 d0                	sub    %edx,%eax
+}
+  800836:	5d                   	pop    %ebp
+  800837:	c3                   	ret
+
+00800838 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800838:	55                   	push   %ebp
+  800839:	89 e5                	mov    %esp,%ebp
+  80083b:	53                   	push   %ebx
+  80083c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80083f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800842:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800845:	eb 09                	jmp    800850 <strncmp+0x18>
+		n--, p++, q++;
+  800847:	83 ea 01             	sub    $0x1,%edx
+  80084a:	83 c0 01             	add    $0x1,%eax
+  80084d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800850:	85 d2                	test   %edx,%edx
+  800852:	74 18                	je     80086c <strncmp+0x34>
+  800854:	0f b6 18             	movzbl (%eax),%ebx
+  800857:	84 db                	test   %bl,%bl
+  800859:	74 04                	je     80085f <strncmp+0x27>
+  80085b:	3a 19                	cmp    (%ecx),%bl
+  80085d:	74 e8                	je     800847 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80085f:	0f b6 00             	movzbl (%eax),%eax
+  800862:	0f b6 11             	movzbl (%ecx),%edx
+  800865:	29 d0                	sub    %edx,%eax
+}
+  800867:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80086a:	c9                   	leave
+  80086b:	c3                   	ret
+		return 0;
+  80086c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800871:	eb f4                	jmp    800867 <strncmp+0x2f>
+
+00800873 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800873:	55                   	push   %ebp
+  800874:	89 e5                	mov    %esp,%ebp
+  800876:	8b 45 08             	mov    0x8(%ebp),%eax
+  800879:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80087d:	eb 03                	jmp    800882 <strchr+0xf>
+  80087f:	83 c0 01             	add    $0x1,%eax
+  800882:	0f b6 10             	movzbl (%eax),%edx
+  800885:	84 d2                	test   %dl,%dl
+  800887:	74 06                	je     80088f <strchr+0x1c>
+		if (*s == c)
+  800889:	38 ca                	cmp    %cl,%dl
+  80088b:	75 f2                	jne    80087f <strchr+0xc>
+  80088d:	eb 05                	jmp    800894 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80088f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800894:	5d                   	pop    %ebp
+  800895:	c3                   	ret
+
+00800896 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800896:	55                   	push   %ebp
+  800897:	89 e5                	mov    %esp,%ebp
+  800899:	8b 45 08             	mov    0x8(%ebp),%eax
+  80089c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008a0:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008a3:	38 ca                	cmp    %cl,%dl
+  8008a5:	74 09                	je     8008b0 <strfind+0x1a>
+  8008a7:	84 d2                	test   %dl,%dl
+  8008a9:	74 05                	je     8008b0 <strfind+0x1a>
+	for (; *s; s++)
+  8008ab:	83 c0 01             	add    $0x1,%eax
+  8008ae:	eb f0                	jmp    8008a0 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008b0:	5d                   	pop    %ebp
+  8008b1:	c3                   	ret
+
+008008b2 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008b2:	55                   	push   %ebp
+  8008b3:	89 e5                	mov    %esp,%ebp
+  8008b5:	57                   	push   %edi
+  8008b6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008b9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008bc:	85 c9                	test   %ecx,%ecx
+  8008be:	74 20                	je     8008e0 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008c0:	89 f8                	mov    %edi,%eax
+  8008c2:	09 c8                	or     %ecx,%eax
+  8008c4:	a8 03                	test   $0x3,%al
+  8008c6:	75 12                	jne    8008da <memset+0x28>
+		c &= 0xFF;
+  8008c8:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008cc:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008d2:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008d5:	fc                   	cld
+  8008d6:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008d8:	eb 06                	jmp    8008e0 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008dd:	fc                   	cld
+  8008de:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008e0:	89 f8                	mov    %edi,%eax
+  8008e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008e5:	c9                   	leave
+  8008e6:	c3                   	ret
+
+008008e7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008e7:	55                   	push   %ebp
+  8008e8:	89 e5                	mov    %esp,%ebp
+  8008ea:	57                   	push   %edi
+  8008eb:	56                   	push   %esi
+  8008ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ef:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008f2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008f5:	39 c6                	cmp    %eax,%esi
+  8008f7:	73 32                	jae    80092b <memmove+0x44>
+  8008f9:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008fc:	39 d0                	cmp    %edx,%eax
+  8008fe:	73 2b                	jae    80092b <memmove+0x44>
+		s += n;
+		d += n;
+  800900:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800903:	89 d6                	mov    %edx,%esi
+  800905:	09 fe                	or     %edi,%esi
+  800907:	09 ce                	or     %ecx,%esi
+  800909:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80090f:	75 0e                	jne    80091f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800911:	83 ef 04             	sub    $0x4,%edi
+  800914:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800917:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80091a:	fd                   	std
+  80091b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80091d:	eb 09                	jmp    800928 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80091f:	83 ef 01             	sub    $0x1,%edi
+  800922:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800925:	fd                   	std
+  800926:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800928:	fc                   	cld
+  800929:	eb 1a                	jmp    800945 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80092b:	89 f2                	mov    %esi,%edx
+  80092d:	09 c2                	or     %eax,%edx
+  80092f:	09 ca                	or     %ecx,%edx
+  800931:	f6 c2 03             	test   $0x3,%dl
+  800934:	75 0a                	jne    800940 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800936:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800939:	89 c7                	mov    %eax,%edi
+  80093b:	fc                   	cld
+  80093c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80093e:	eb 05                	jmp    800945 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800940:	89 c7                	mov    %eax,%edi
+  800942:	fc                   	cld
+  800943:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800945:	5e                   	pop    %esi
+  800946:	5f                   	pop    %edi
+  800947:	5d                   	pop    %ebp
+  800948:	c3                   	ret
+
+00800949 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800949:	55                   	push   %ebp
+  80094a:	89 e5                	mov    %esp,%ebp
+  80094c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80094f:	ff 75 10             	push   0x10(%ebp)
+  800952:	ff 75 0c             	push   0xc(%ebp)
+  800955:	ff 75 08             	push   0x8(%ebp)
+  800958:	e8 8a ff ff ff       	call   8008e7 <memmove>
+}
+  80095d:	c9                   	leave
+  80095e:	c3                   	ret
+
+0080095f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80095f:	55                   	push   %ebp
+  800960:	89 e5                	mov    %esp,%ebp
+  800962:	56                   	push   %esi
+  800963:	53                   	push   %ebx
+  800964:	8b 45 08             	mov    0x8(%ebp),%eax
+  800967:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80096a:	89 c6                	mov    %eax,%esi
+  80096c:	03 75 10             	add    0x10(%ebp),%esi
+  80096f:	eb 06                	jmp    800977 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800971:	83 c0 01             	add    $0x1,%eax
+  800974:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800977:	39 f0                	cmp    %esi,%eax
+  800979:	74 14                	je     80098f <memcmp+0x30>
+		if (*s1 != *s2)
+  80097b:	0f b6 08             	movzbl (%eax),%ecx
+  80097e:	0f b6 1a             	movzbl (%edx),%ebx
+  800981:	38 d9                	cmp    %bl,%cl
+  800983:	74 ec                	je     800971 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800985:	0f b6 c1             	movzbl %cl,%eax
+  800988:	0f b6 db             	movzbl %bl,%ebx
+  80098b:	29 d8                	sub    %ebx,%eax
+  80098d:	eb 05                	jmp    800994 <memcmp+0x35>
+	}
+
+	return 0;
+  80098f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800994:	5b                   	pop    %ebx
+  800995:	5e                   	pop    %esi
+  800996:	5d                   	pop    %ebp
+  800997:	c3                   	ret
+
+00800998 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800998:	55                   	push   %ebp
+  800999:	89 e5                	mov    %esp,%ebp
+  80099b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009a1:	89 c2                	mov    %eax,%edx
+  8009a3:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009a6:	eb 03                	jmp    8009ab <memfind+0x13>
+  8009a8:	83 c0 01             	add    $0x1,%eax
+  8009ab:	39 d0                	cmp    %edx,%eax
+  8009ad:	73 04                	jae    8009b3 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009af:	38 08                	cmp    %cl,(%eax)
+  8009b1:	75 f5                	jne    8009a8 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009b3:	5d                   	pop    %ebp
+  8009b4:	c3                   	ret
+
+008009b5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009b5:	55                   	push   %ebp
+  8009b6:	89 e5                	mov    %esp,%ebp
+  8009b8:	57                   	push   %edi
+  8009b9:	56                   	push   %esi
+  8009ba:	53                   	push   %ebx
+  8009bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009c1:	eb 03                	jmp    8009c6 <strtol+0x11>
+		s++;
+  8009c3:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009c6:	0f b6 02             	movzbl (%edx),%eax
+  8009c9:	3c 20                	cmp    $0x20,%al
+  8009cb:	74 f6                	je     8009c3 <strtol+0xe>
+  8009cd:	3c 09                	cmp    $0x9,%al
+  8009cf:	74 f2                	je     8009c3 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009d1:	3c 2b                	cmp    $0x2b,%al
+  8009d3:	74 2a                	je     8009ff <strtol+0x4a>
+	int neg = 0;
+  8009d5:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009da:	3c 2d                	cmp    $0x2d,%al
+  8009dc:	74 2b                	je     800a09 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009de:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009e4:	75 0f                	jne    8009f5 <strtol+0x40>
+  8009e6:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009e9:	74 28                	je     800a13 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009eb:	85 db                	test   %ebx,%ebx
+  8009ed:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009f2:	0f 44 d8             	cmove  %eax,%ebx
+  8009f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009fa:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009fd:	eb 46                	jmp    800a45 <strtol+0x90>
+		s++;
+  8009ff:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a02:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a07:	eb d5                	jmp    8009de <strtol+0x29>
+		s++, neg = 1;
+  800a09:	83 c2 01             	add    $0x1,%edx
+  800a0c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a11:	eb cb                	jmp    8009de <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a13:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a17:	74 0e                	je     800a27 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a19:	85 db                	test   %ebx,%ebx
+  800a1b:	75 d8                	jne    8009f5 <strtol+0x40>
+		s++, base = 8;
+  800a1d:	83 c2 01             	add    $0x1,%edx
+  800a20:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a25:	eb ce                	jmp    8009f5 <strtol+0x40>
+		s += 2, base = 16;
+  800a27:	83 c2 02             	add    $0x2,%edx
+  800a2a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a2f:	eb c4                	jmp    8009f5 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a31:	0f be c0             	movsbl %al,%eax
+  800a34:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a37:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a3a:	7d 3a                	jge    800a76 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a3c:	83 c2 01             	add    $0x1,%edx
+  800a3f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a43:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a45:	0f b6 02             	movzbl (%edx),%eax
+  800a48:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a4b:	89 f3                	mov    %esi,%ebx
+  800a4d:	80 fb 09             	cmp    $0x9,%bl
+  800a50:	76 df                	jbe    800a31 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a52:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a55:	89 f3                	mov    %esi,%ebx
+  800a57:	80 fb 19             	cmp    $0x19,%bl
+  800a5a:	77 08                	ja     800a64 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a5c:	0f be c0             	movsbl %al,%eax
+  800a5f:	83 e8 57             	sub    $0x57,%eax
+  800a62:	eb d3                	jmp    800a37 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a64:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a67:	89 f3                	mov    %esi,%ebx
+  800a69:	80 fb 19             	cmp    $0x19,%bl
+  800a6c:	77 08                	ja     800a76 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a6e:	0f be c0             	movsbl %al,%eax
+  800a71:	83 e8 37             	sub    $0x37,%eax
+  800a74:	eb c1                	jmp    800a37 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a76:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a7a:	74 05                	je     800a81 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a7c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a7f:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a81:	89 c8                	mov    %ecx,%eax
+  800a83:	f7 d8                	neg    %eax
+  800a85:	85 ff                	test   %edi,%edi
+  800a87:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a8a:	89 c8                	mov    %ecx,%eax
+  800a8c:	5b                   	pop    %ebx
+  800a8d:	5e                   	pop    %esi
+  800a8e:	5f                   	pop    %edi
+  800a8f:	5d                   	pop    %ebp
+  800a90:	c3                   	ret
+
+00800a91 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800a91:	55                   	push   %ebp
+  800a92:	89 e5                	mov    %esp,%ebp
+  800a94:	57                   	push   %edi
+  800a95:	56                   	push   %esi
+  800a96:	53                   	push   %ebx
+  800a97:	83 ec 0c             	sub    $0xc,%esp
+  800a9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a9d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aa0:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800aa3:	85 ff                	test   %edi,%edi
+  800aa5:	74 16                	je     800abd <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800aa7:	83 ec 04             	sub    $0x4,%esp
+  800aaa:	56                   	push   %esi
+  800aab:	6a 00                	push   $0x0
+  800aad:	53                   	push   %ebx
+  800aae:	e8 02 ff ff ff       	call   8009b5 <strtol>
+  800ab3:	89 07                	mov    %eax,(%edi)
+  800ab5:	83 c4 10             	add    $0x10,%esp
+  800ab8:	eb 03                	jmp    800abd <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800aba:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800abd:	0f b6 03             	movzbl (%ebx),%eax
+  800ac0:	3c 20                	cmp    $0x20,%al
+  800ac2:	74 f6                	je     800aba <strisl+0x29>
+  800ac4:	3c 09                	cmp    $0x9,%al
+  800ac6:	74 f2                	je     800aba <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ac8:	3c 2b                	cmp    $0x2b,%al
+  800aca:	74 23                	je     800aef <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800acc:	3c 2d                	cmp    $0x2d,%al
+  800ace:	0f 94 c0             	sete   %al
+  800ad1:	0f b6 c0             	movzbl %al,%eax
+  800ad4:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ad6:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800adc:	75 41                	jne    800b1f <strisl+0x8e>
+  800ade:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800ae1:	74 11                	je     800af4 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ae3:	85 f6                	test   %esi,%esi
+  800ae5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800aea:	0f 44 f0             	cmove  %eax,%esi
+  800aed:	eb 30                	jmp    800b1f <strisl+0x8e>
+		s++;
+  800aef:	83 c3 01             	add    $0x1,%ebx
+  800af2:	eb e2                	jmp    800ad6 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800af4:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800af8:	74 0e                	je     800b08 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800afa:	85 f6                	test   %esi,%esi
+  800afc:	75 21                	jne    800b1f <strisl+0x8e>
+		s++, base = 8;
+  800afe:	83 c3 01             	add    $0x1,%ebx
+  800b01:	be 08 00 00 00       	mov    $0x8,%esi
+  800b06:	eb 17                	jmp    800b1f <strisl+0x8e>
+		s += 2, base = 16;
+  800b08:	83 c3 02             	add    $0x2,%ebx
+  800b0b:	be 10 00 00 00       	mov    $0x10,%esi
+  800b10:	eb 0d                	jmp    800b1f <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b12:	0f be c0             	movsbl %al,%eax
+  800b15:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800b18:	39 f0                	cmp    %esi,%eax
+  800b1a:	7d 38                	jge    800b54 <strisl+0xc3>
+			return 0;
+		s++;
+  800b1c:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800b1f:	0f b6 03             	movzbl (%ebx),%eax
+  800b22:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800b25:	80 fa 09             	cmp    $0x9,%dl
+  800b28:	76 e8                	jbe    800b12 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800b2a:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800b2d:	80 fa 19             	cmp    $0x19,%dl
+  800b30:	77 08                	ja     800b3a <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800b32:	0f be c0             	movsbl %al,%eax
+  800b35:	83 e8 57             	sub    $0x57,%eax
+  800b38:	eb de                	jmp    800b18 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b3a:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800b3d:	80 fa 19             	cmp    $0x19,%dl
+  800b40:	77 08                	ja     800b4a <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800b42:	0f be c0             	movsbl %al,%eax
+  800b45:	83 e8 37             	sub    $0x37,%eax
+  800b48:	eb ce                	jmp    800b18 <strisl+0x87>
+		else if (!*s)
+  800b4a:	84 c0                	test   %al,%al
+  800b4c:	0f 94 c0             	sete   %al
+  800b4f:	0f b6 c0             	movzbl %al,%eax
+  800b52:	eb 05                	jmp    800b59 <strisl+0xc8>
+			return 0;
+  800b54:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800b59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b5c:	5b                   	pop    %ebx
+  800b5d:	5e                   	pop    %esi
+  800b5e:	5f                   	pop    %edi
+  800b5f:	5d                   	pop    %ebp
+  800b60:	c3                   	ret
+
+00800b61 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800b61:	55                   	push   %ebp
+  800b62:	89 e5                	mov    %esp,%ebp
+  800b64:	83 ec 10             	sub    $0x10,%esp
+  800b67:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800b6a:	89 c8                	mov    %ecx,%eax
+  800b6c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800b71:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800b74:	eb 0b                	jmp    800b81 <touch_mem+0x20>
+		c = *(char *)page;
+  800b76:	0f b6 10             	movzbl (%eax),%edx
+  800b79:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800b7c:	05 00 10 00 00       	add    $0x1000,%eax
+  800b81:	39 c8                	cmp    %ecx,%eax
+  800b83:	72 f1                	jb     800b76 <touch_mem+0x15>
+}
+  800b85:	c9                   	leave
+  800b86:	c3                   	ret
+
+00800b87 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b87:	55                   	push   %ebp
+  800b88:	89 e5                	mov    %esp,%ebp
+  800b8a:	57                   	push   %edi
+  800b8b:	56                   	push   %esi
+  800b8c:	53                   	push   %ebx
+	touch_mem(s, len);
+  800b8d:	ff 75 0c             	push   0xc(%ebp)
+  800b90:	ff 75 08             	push   0x8(%ebp)
+  800b93:	e8 c9 ff ff ff       	call   800b61 <touch_mem>
+	asm volatile("int %1\n"
+  800b98:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba3:	89 c3                	mov    %eax,%ebx
+  800ba5:	89 c7                	mov    %eax,%edi
+  800ba7:	89 c6                	mov    %eax,%esi
+  800ba9:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bab:	83 c4 08             	add    $0x8,%esp
+  800bae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bb1:	5b                   	pop    %ebx
+  800bb2:	5e                   	pop    %esi
+  800bb3:	5f                   	pop    %edi
+  800bb4:	5d                   	pop    %ebp
+  800bb5:	c3                   	ret
+
+00800bb6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bb6:	55                   	push   %ebp
+  800bb7:	89 e5                	mov    %esp,%ebp
+  800bb9:	57                   	push   %edi
+  800bba:	56                   	push   %esi
+  800bbb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bc1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bc6:	89 d1                	mov    %edx,%ecx
+  800bc8:	89 d3                	mov    %edx,%ebx
+  800bca:	89 d7                	mov    %edx,%edi
+  800bcc:	89 d6                	mov    %edx,%esi
+  800bce:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bd0:	5b                   	pop    %ebx
+  800bd1:	5e                   	pop    %esi
+  800bd2:	5f                   	pop    %edi
+  800bd3:	5d                   	pop    %ebp
+  800bd4:	c3                   	ret
+
+00800bd5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bd5:	55                   	push   %ebp
+  800bd6:	89 e5                	mov    %esp,%ebp
+  800bd8:	57                   	push   %edi
+  800bd9:	56                   	push   %esi
+  800bda:	53                   	push   %ebx
+  800bdb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bde:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800be3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800beb:	89 cb                	mov    %ecx,%ebx
+  800bed:	89 cf                	mov    %ecx,%edi
+  800bef:	89 ce                	mov    %ecx,%esi
+  800bf1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bf3:	85 c0                	test   %eax,%eax
+  800bf5:	7f 08                	jg     800bff <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bf7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bfa:	5b                   	pop    %ebx
+  800bfb:	5e                   	pop    %esi
+  800bfc:	5f                   	pop    %edi
+  800bfd:	5d                   	pop    %ebp
+  800bfe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bff:	83 ec 0c             	sub    $0xc,%esp
+  800c02:	50                   	push   %eax
+  800c03:	6a 03                	push   $0x3
+  800c05:	68 6b 2b 80 00       	push   $0x802b6b
+  800c0a:	6a 23                	push   $0x23
+  800c0c:	68 88 2b 80 00       	push   $0x802b88
+  800c11:	e8 d3 16 00 00       	call   8022e9 <_panic>
+
+00800c16 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c16:	55                   	push   %ebp
+  800c17:	89 e5                	mov    %esp,%ebp
+  800c19:	57                   	push   %edi
+  800c1a:	56                   	push   %esi
+  800c1b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c21:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c26:	89 d1                	mov    %edx,%ecx
+  800c28:	89 d3                	mov    %edx,%ebx
+  800c2a:	89 d7                	mov    %edx,%edi
+  800c2c:	89 d6                	mov    %edx,%esi
+  800c2e:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c30:	5b                   	pop    %ebx
+  800c31:	5e                   	pop    %esi
+  800c32:	5f                   	pop    %edi
+  800c33:	5d                   	pop    %ebp
+  800c34:	c3                   	ret
+
+00800c35 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c35:	55                   	push   %ebp
+  800c36:	89 e5                	mov    %esp,%ebp
+  800c38:	57                   	push   %edi
+  800c39:	56                   	push   %esi
+  800c3a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c40:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c45:	89 d1                	mov    %edx,%ecx
+  800c47:	89 d3                	mov    %edx,%ebx
+  800c49:	89 d7                	mov    %edx,%edi
+  800c4b:	89 d6                	mov    %edx,%esi
+  800c4d:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c4f:	5b                   	pop    %ebx
+  800c50:	5e                   	pop    %esi
+  800c51:	5f                   	pop    %edi
+  800c52:	5d                   	pop    %ebp
+  800c53:	c3                   	ret
+
+00800c54 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c54:	55                   	push   %ebp
+  800c55:	89 e5                	mov    %esp,%ebp
+  800c57:	57                   	push   %edi
+  800c58:	56                   	push   %esi
+  800c59:	53                   	push   %ebx
+  800c5a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c5d:	be 00 00 00 00       	mov    $0x0,%esi
+  800c62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c68:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c70:	89 f7                	mov    %esi,%edi
+  800c72:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c74:	85 c0                	test   %eax,%eax
+  800c76:	7f 08                	jg     800c80 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c7b:	5b                   	pop    %ebx
+  800c7c:	5e                   	pop    %esi
+  800c7d:	5f                   	pop    %edi
+  800c7e:	5d                   	pop    %ebp
+  800c7f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c80:	83 ec 0c             	sub    $0xc,%esp
+  800c83:	50                   	push   %eax
+  800c84:	6a 04                	push   $0x4
+  800c86:	68 6b 2b 80 00       	push   $0x802b6b
+  800c8b:	6a 23                	push   $0x23
+  800c8d:	68 88 2b 80 00       	push   $0x802b88
+  800c92:	e8 52 16 00 00       	call   8022e9 <_panic>
+
+00800c97 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c97:	55                   	push   %ebp
+  800c98:	89 e5                	mov    %esp,%ebp
+  800c9a:	57                   	push   %edi
+  800c9b:	56                   	push   %esi
+  800c9c:	53                   	push   %ebx
+  800c9d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ca0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca6:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cae:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cb1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cb4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cb6:	85 c0                	test   %eax,%eax
+  800cb8:	7f 08                	jg     800cc2 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cbd:	5b                   	pop    %ebx
+  800cbe:	5e                   	pop    %esi
+  800cbf:	5f                   	pop    %edi
+  800cc0:	5d                   	pop    %ebp
+  800cc1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cc2:	83 ec 0c             	sub    $0xc,%esp
+  800cc5:	50                   	push   %eax
+  800cc6:	6a 05                	push   $0x5
+  800cc8:	68 6b 2b 80 00       	push   $0x802b6b
+  800ccd:	6a 23                	push   $0x23
+  800ccf:	68 88 2b 80 00       	push   $0x802b88
+  800cd4:	e8 10 16 00 00       	call   8022e9 <_panic>
+
+00800cd9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cd9:	55                   	push   %ebp
+  800cda:	89 e5                	mov    %esp,%ebp
+  800cdc:	57                   	push   %edi
+  800cdd:	56                   	push   %esi
+  800cde:	53                   	push   %ebx
+  800cdf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ce2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ced:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cf2:	89 df                	mov    %ebx,%edi
+  800cf4:	89 de                	mov    %ebx,%esi
+  800cf6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cf8:	85 c0                	test   %eax,%eax
+  800cfa:	7f 08                	jg     800d04 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800cfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cff:	5b                   	pop    %ebx
+  800d00:	5e                   	pop    %esi
+  800d01:	5f                   	pop    %edi
+  800d02:	5d                   	pop    %ebp
+  800d03:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d04:	83 ec 0c             	sub    $0xc,%esp
+  800d07:	50                   	push   %eax
+  800d08:	6a 06                	push   $0x6
+  800d0a:	68 6b 2b 80 00       	push   $0x802b6b
+  800d0f:	6a 23                	push   $0x23
+  800d11:	68 88 2b 80 00       	push   $0x802b88
+  800d16:	e8 ce 15 00 00       	call   8022e9 <_panic>
+
+00800d1b <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800d1b:	55                   	push   %ebp
+  800d1c:	89 e5                	mov    %esp,%ebp
+  800d1e:	57                   	push   %edi
+  800d1f:	56                   	push   %esi
+  800d20:	53                   	push   %ebx
+  800d21:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2f:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d34:	89 df                	mov    %ebx,%edi
+  800d36:	89 de                	mov    %ebx,%esi
+  800d38:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d3a:	85 c0                	test   %eax,%eax
+  800d3c:	7f 08                	jg     800d46 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d41:	5b                   	pop    %ebx
+  800d42:	5e                   	pop    %esi
+  800d43:	5f                   	pop    %edi
+  800d44:	5d                   	pop    %ebp
+  800d45:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d46:	83 ec 0c             	sub    $0xc,%esp
+  800d49:	50                   	push   %eax
+  800d4a:	6a 18                	push   $0x18
+  800d4c:	68 6b 2b 80 00       	push   $0x802b6b
+  800d51:	6a 23                	push   $0x23
+  800d53:	68 88 2b 80 00       	push   $0x802b88
+  800d58:	e8 8c 15 00 00       	call   8022e9 <_panic>
+
+00800d5d <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800d5d:	55                   	push   %ebp
+  800d5e:	89 e5                	mov    %esp,%ebp
+  800d60:	57                   	push   %edi
+  800d61:	56                   	push   %esi
+  800d62:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d63:	be 00 00 00 00       	mov    $0x0,%esi
+  800d68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6e:	b8 19 00 00 00       	mov    $0x19,%eax
+  800d73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d76:	89 f7                	mov    %esi,%edi
+  800d78:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800d7a:	5b                   	pop    %ebx
+  800d7b:	5e                   	pop    %esi
+  800d7c:	5f                   	pop    %edi
+  800d7d:	5d                   	pop    %ebp
+  800d7e:	c3                   	ret
+
+00800d7f <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d7f:	55                   	push   %ebp
+  800d80:	89 e5                	mov    %esp,%ebp
+  800d82:	57                   	push   %edi
+  800d83:	56                   	push   %esi
+  800d84:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d90:	be 00 00 00 00       	mov    $0x0,%esi
+  800d95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d98:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d9b:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800d9d:	5b                   	pop    %ebx
+  800d9e:	5e                   	pop    %esi
+  800d9f:	5f                   	pop    %edi
+  800da0:	5d                   	pop    %ebp
+  800da1:	c3                   	ret
+
+00800da2 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800da2:	55                   	push   %ebp
+  800da3:	89 e5                	mov    %esp,%ebp
+  800da5:	57                   	push   %edi
+  800da6:	56                   	push   %esi
+  800da7:	53                   	push   %ebx
+  800da8:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800dab:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800dae:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800db4:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800db7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbd:	b8 10 00 00 00       	mov    $0x10,%eax
+  800dc2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc5:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dc8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dca:	85 c0                	test   %eax,%eax
+  800dcc:	7f 08                	jg     800dd6 <sys_page_map_range+0x34>
+}
+  800dce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd1:	5b                   	pop    %ebx
+  800dd2:	5e                   	pop    %esi
+  800dd3:	5f                   	pop    %edi
+  800dd4:	5d                   	pop    %ebp
+  800dd5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd6:	83 ec 0c             	sub    $0xc,%esp
+  800dd9:	50                   	push   %eax
+  800dda:	6a 10                	push   $0x10
+  800ddc:	68 6b 2b 80 00       	push   $0x802b6b
+  800de1:	6a 23                	push   $0x23
+  800de3:	68 88 2b 80 00       	push   $0x802b88
+  800de8:	e8 fc 14 00 00       	call   8022e9 <_panic>
+
+00800ded <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800ded:	55                   	push   %ebp
+  800dee:	89 e5                	mov    %esp,%ebp
+  800df0:	57                   	push   %edi
+  800df1:	56                   	push   %esi
+  800df2:	53                   	push   %ebx
+  800df3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800df6:	be 00 00 00 00       	mov    $0x0,%esi
+  800dfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e01:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e06:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e09:	89 f7                	mov    %esi,%edi
+  800e0b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e0d:	85 c0                	test   %eax,%eax
+  800e0f:	7f 08                	jg     800e19 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e14:	5b                   	pop    %ebx
+  800e15:	5e                   	pop    %esi
+  800e16:	5f                   	pop    %edi
+  800e17:	5d                   	pop    %ebp
+  800e18:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e19:	83 ec 0c             	sub    $0xc,%esp
+  800e1c:	50                   	push   %eax
+  800e1d:	6a 11                	push   $0x11
+  800e1f:	68 6b 2b 80 00       	push   $0x802b6b
+  800e24:	6a 23                	push   $0x23
+  800e26:	68 88 2b 80 00       	push   $0x802b88
+  800e2b:	e8 b9 14 00 00       	call   8022e9 <_panic>
+
+00800e30 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800e30:	55                   	push   %ebp
+  800e31:	89 e5                	mov    %esp,%ebp
+  800e33:	57                   	push   %edi
+  800e34:	56                   	push   %esi
+  800e35:	53                   	push   %ebx
+  800e36:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e39:	be 00 00 00 00       	mov    $0x0,%esi
+  800e3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e44:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800e49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e4c:	89 f7                	mov    %esi,%edi
+  800e4e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e50:	85 c0                	test   %eax,%eax
+  800e52:	7f 08                	jg     800e5c <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e57:	5b                   	pop    %ebx
+  800e58:	5e                   	pop    %esi
+  800e59:	5f                   	pop    %edi
+  800e5a:	5d                   	pop    %ebp
+  800e5b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5c:	83 ec 0c             	sub    $0xc,%esp
+  800e5f:	50                   	push   %eax
+  800e60:	6a 1b                	push   $0x1b
+  800e62:	68 6b 2b 80 00       	push   $0x802b6b
+  800e67:	6a 23                	push   $0x23
+  800e69:	68 88 2b 80 00       	push   $0x802b88
+  800e6e:	e8 76 14 00 00       	call   8022e9 <_panic>
+
+00800e73 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	57                   	push   %edi
+  800e77:	56                   	push   %esi
+  800e78:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e79:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7e:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e83:	89 d1                	mov    %edx,%ecx
+  800e85:	89 d3                	mov    %edx,%ebx
+  800e87:	89 d7                	mov    %edx,%edi
+  800e89:	89 d6                	mov    %edx,%esi
+  800e8b:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800e8d:	5b                   	pop    %ebx
+  800e8e:	5e                   	pop    %esi
+  800e8f:	5f                   	pop    %edi
+  800e90:	5d                   	pop    %ebp
+  800e91:	c3                   	ret
+
+00800e92 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e92:	55                   	push   %ebp
+  800e93:	89 e5                	mov    %esp,%ebp
+  800e95:	57                   	push   %edi
+  800e96:	56                   	push   %esi
+  800e97:	53                   	push   %ebx
+  800e98:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea6:	b8 08 00 00 00       	mov    $0x8,%eax
+  800eab:	89 df                	mov    %ebx,%edi
+  800ead:	89 de                	mov    %ebx,%esi
+  800eaf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb1:	85 c0                	test   %eax,%eax
+  800eb3:	7f 08                	jg     800ebd <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800eb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb8:	5b                   	pop    %ebx
+  800eb9:	5e                   	pop    %esi
+  800eba:	5f                   	pop    %edi
+  800ebb:	5d                   	pop    %ebp
+  800ebc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ebd:	83 ec 0c             	sub    $0xc,%esp
+  800ec0:	50                   	push   %eax
+  800ec1:	6a 08                	push   $0x8
+  800ec3:	68 6b 2b 80 00       	push   $0x802b6b
+  800ec8:	6a 23                	push   $0x23
+  800eca:	68 88 2b 80 00       	push   $0x802b88
+  800ecf:	e8 15 14 00 00       	call   8022e9 <_panic>
+
+00800ed4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ed4:	55                   	push   %ebp
+  800ed5:	89 e5                	mov    %esp,%ebp
+  800ed7:	57                   	push   %edi
+  800ed8:	56                   	push   %esi
+  800ed9:	53                   	push   %ebx
+  800eda:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800edd:	6a 44                	push   $0x44
+  800edf:	ff 75 0c             	push   0xc(%ebp)
+  800ee2:	e8 7a fc ff ff       	call   800b61 <touch_mem>
+	asm volatile("int %1\n"
+  800ee7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eef:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ef4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef7:	89 df                	mov    %ebx,%edi
+  800ef9:	89 de                	mov    %ebx,%esi
+  800efb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800efd:	83 c4 08             	add    $0x8,%esp
+  800f00:	85 c0                	test   %eax,%eax
+  800f02:	7f 08                	jg     800f0c <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f07:	5b                   	pop    %ebx
+  800f08:	5e                   	pop    %esi
+  800f09:	5f                   	pop    %edi
+  800f0a:	5d                   	pop    %ebp
+  800f0b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0c:	83 ec 0c             	sub    $0xc,%esp
+  800f0f:	50                   	push   %eax
+  800f10:	6a 09                	push   $0x9
+  800f12:	68 6b 2b 80 00       	push   $0x802b6b
+  800f17:	6a 23                	push   $0x23
+  800f19:	68 88 2b 80 00       	push   $0x802b88
+  800f1e:	e8 c6 13 00 00       	call   8022e9 <_panic>
+
+00800f23 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800f23:	55                   	push   %ebp
+  800f24:	89 e5                	mov    %esp,%ebp
+  800f26:	57                   	push   %edi
+  800f27:	56                   	push   %esi
+  800f28:	53                   	push   %ebx
+  800f29:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f2c:	be 00 00 00 00       	mov    $0x0,%esi
+  800f31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f37:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800f3c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f3f:	89 f7                	mov    %esi,%edi
+  800f41:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f43:	85 c0                	test   %eax,%eax
+  800f45:	7f 08                	jg     800f4f <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800f47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4a:	5b                   	pop    %ebx
+  800f4b:	5e                   	pop    %esi
+  800f4c:	5f                   	pop    %edi
+  800f4d:	5d                   	pop    %ebp
+  800f4e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f4f:	83 ec 0c             	sub    $0xc,%esp
+  800f52:	50                   	push   %eax
+  800f53:	6a 1a                	push   $0x1a
+  800f55:	68 6b 2b 80 00       	push   $0x802b6b
+  800f5a:	6a 23                	push   $0x23
+  800f5c:	68 88 2b 80 00       	push   $0x802b88
+  800f61:	e8 83 13 00 00       	call   8022e9 <_panic>
+
+00800f66 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  800f66:	55                   	push   %ebp
+  800f67:	89 e5                	mov    %esp,%ebp
+  800f69:	57                   	push   %edi
+  800f6a:	56                   	push   %esi
+  800f6b:	53                   	push   %ebx
+  800f6c:	83 ec 0c             	sub    $0xc,%esp
+  800f6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  800f72:	89 d8                	mov    %ebx,%eax
+  800f74:	c1 e0 05             	shl    $0x5,%eax
+  800f77:	50                   	push   %eax
+  800f78:	ff 75 0c             	push   0xc(%ebp)
+  800f7b:	e8 e1 fb ff ff       	call   800b61 <touch_mem>
+	asm volatile("int %1\n"
+  800f80:	be 00 00 00 00       	mov    $0x0,%esi
+  800f85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f88:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f90:	89 f7                	mov    %esi,%edi
+  800f92:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f94:	83 c4 08             	add    $0x8,%esp
+  800f97:	85 c0                	test   %eax,%eax
+  800f99:	7f 08                	jg     800fa3 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  800f9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9e:	5b                   	pop    %ebx
+  800f9f:	5e                   	pop    %esi
+  800fa0:	5f                   	pop    %edi
+  800fa1:	5d                   	pop    %ebp
+  800fa2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa3:	83 ec 0c             	sub    $0xc,%esp
+  800fa6:	50                   	push   %eax
+  800fa7:	6a 13                	push   $0x13
+  800fa9:	68 6b 2b 80 00       	push   $0x802b6b
+  800fae:	6a 23                	push   $0x23
+  800fb0:	68 88 2b 80 00       	push   $0x802b88
+  800fb5:	e8 2f 13 00 00       	call   8022e9 <_panic>
+
+00800fba <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fba:	55                   	push   %ebp
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	57                   	push   %edi
+  800fbe:	56                   	push   %esi
+  800fbf:	53                   	push   %ebx
+  800fc0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fc3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fce:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fd3:	89 df                	mov    %ebx,%edi
+  800fd5:	89 de                	mov    %ebx,%esi
+  800fd7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd9:	85 c0                	test   %eax,%eax
+  800fdb:	7f 08                	jg     800fe5 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fdd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe0:	5b                   	pop    %ebx
+  800fe1:	5e                   	pop    %esi
+  800fe2:	5f                   	pop    %edi
+  800fe3:	5d                   	pop    %ebp
+  800fe4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe5:	83 ec 0c             	sub    $0xc,%esp
+  800fe8:	50                   	push   %eax
+  800fe9:	6a 0a                	push   $0xa
+  800feb:	68 6b 2b 80 00       	push   $0x802b6b
+  800ff0:	6a 23                	push   $0x23
+  800ff2:	68 88 2b 80 00       	push   $0x802b88
+  800ff7:	e8 ed 12 00 00       	call   8022e9 <_panic>
+
+00800ffc <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800ffc:	55                   	push   %ebp
+  800ffd:	89 e5                	mov    %esp,%ebp
+  800fff:	57                   	push   %edi
+  801000:	56                   	push   %esi
+  801001:	53                   	push   %ebx
+  801002:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801005:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80100b:	76 1d                	jbe    80102a <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80100d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801010:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801013:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801018:	be 01 00 00 00       	mov    $0x1,%esi
+  80101d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801020:	cd 30                	int    $0x30
+}
+  801022:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801025:	5b                   	pop    %ebx
+  801026:	5e                   	pop    %esi
+  801027:	5f                   	pop    %edi
+  801028:	5d                   	pop    %ebp
+  801029:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80102a:	68 00 10 00 00       	push   $0x1000
+  80102f:	53                   	push   %ebx
+  801030:	e8 2c fb ff ff       	call   800b61 <touch_mem>
+  801035:	83 c4 08             	add    $0x8,%esp
+  801038:	eb d3                	jmp    80100d <sys_ipc_send+0x11>
+
+0080103a <sys_ipc_send_pages>:
+{
+  80103a:	55                   	push   %ebp
+  80103b:	89 e5                	mov    %esp,%ebp
+  80103d:	57                   	push   %edi
+  80103e:	56                   	push   %esi
+  80103f:	53                   	push   %ebx
+  801040:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801043:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801046:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80104c:	76 18                	jbe    801066 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80104e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801051:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801054:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801059:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80105c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  80105e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801061:	5b                   	pop    %ebx
+  801062:	5e                   	pop    %esi
+  801063:	5f                   	pop    %edi
+  801064:	5d                   	pop    %ebp
+  801065:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801066:	89 f0                	mov    %esi,%eax
+  801068:	c1 e0 0c             	shl    $0xc,%eax
+  80106b:	50                   	push   %eax
+  80106c:	53                   	push   %ebx
+  80106d:	e8 ef fa ff ff       	call   800b61 <touch_mem>
+  801072:	83 c4 08             	add    $0x8,%esp
+  801075:	eb d7                	jmp    80104e <sys_ipc_send_pages+0x14>
+
+00801077 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801077:	55                   	push   %ebp
+  801078:	89 e5                	mov    %esp,%ebp
+  80107a:	57                   	push   %edi
+  80107b:	56                   	push   %esi
+  80107c:	53                   	push   %ebx
+  80107d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801080:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801085:	8b 55 08             	mov    0x8(%ebp),%edx
+  801088:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801090:	89 df                	mov    %ebx,%edi
+  801092:	89 de                	mov    %ebx,%esi
+  801094:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801096:	85 c0                	test   %eax,%eax
+  801098:	7f 08                	jg     8010a2 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  80109a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109d:	5b                   	pop    %ebx
+  80109e:	5e                   	pop    %esi
+  80109f:	5f                   	pop    %edi
+  8010a0:	5d                   	pop    %ebp
+  8010a1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a2:	83 ec 0c             	sub    $0xc,%esp
+  8010a5:	50                   	push   %eax
+  8010a6:	6a 0d                	push   $0xd
+  8010a8:	68 6b 2b 80 00       	push   $0x802b6b
+  8010ad:	6a 23                	push   $0x23
+  8010af:	68 88 2b 80 00       	push   $0x802b88
+  8010b4:	e8 30 12 00 00       	call   8022e9 <_panic>
+
+008010b9 <sys_ipc_recv>:
+{
+  8010b9:	55                   	push   %ebp
+  8010ba:	89 e5                	mov    %esp,%ebp
+  8010bc:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8010bf:	6a 01                	push   $0x1
+  8010c1:	ff 75 08             	push   0x8(%ebp)
+  8010c4:	e8 ae ff ff ff       	call   801077 <sys_ipc_recv_pages>
+}
+  8010c9:	c9                   	leave
+  8010ca:	c3                   	ret
+
+008010cb <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8010cb:	55                   	push   %ebp
+  8010cc:	89 e5                	mov    %esp,%ebp
+  8010ce:	57                   	push   %edi
+  8010cf:	56                   	push   %esi
+  8010d0:	53                   	push   %ebx
+  8010d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010d7:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  8010da:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010e0:	77 04                	ja     8010e6 <sys_ipc_call+0x1b>
+  8010e2:	85 f6                	test   %esi,%esi
+  8010e4:	75 15                	jne    8010fb <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8010e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ec:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010f1:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8010f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f6:	5b                   	pop    %ebx
+  8010f7:	5e                   	pop    %esi
+  8010f8:	5f                   	pop    %edi
+  8010f9:	5d                   	pop    %ebp
+  8010fa:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8010fb:	89 f8                	mov    %edi,%eax
+  8010fd:	c1 e0 0c             	shl    $0xc,%eax
+  801100:	50                   	push   %eax
+  801101:	53                   	push   %ebx
+  801102:	e8 5a fa ff ff       	call   800b61 <touch_mem>
+  801107:	83 c4 08             	add    $0x8,%esp
+  80110a:	eb da                	jmp    8010e6 <sys_ipc_call+0x1b>
+
+0080110c <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80110c:	55                   	push   %ebp
+  80110d:	89 e5                	mov    %esp,%ebp
+  80110f:	57                   	push   %edi
+  801110:	56                   	push   %esi
+  801111:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801112:	8b 55 08             	mov    0x8(%ebp),%edx
+  801115:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801118:	b8 15 00 00 00       	mov    $0x15,%eax
+  80111d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801120:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801123:	8b 75 18             	mov    0x18(%ebp),%esi
+  801126:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801128:	5b                   	pop    %ebx
+  801129:	5e                   	pop    %esi
+  80112a:	5f                   	pop    %edi
+  80112b:	5d                   	pop    %ebp
+  80112c:	c3                   	ret
+
+0080112d <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  80112d:	55                   	push   %ebp
+  80112e:	89 e5                	mov    %esp,%ebp
+  801130:	57                   	push   %edi
+  801131:	56                   	push   %esi
+  801132:	53                   	push   %ebx
+  801133:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801136:	6a 04                	push   $0x4
+  801138:	ff 75 08             	push   0x8(%ebp)
+  80113b:	e8 21 fa ff ff       	call   800b61 <touch_mem>
+	asm volatile("int %1\n"
+  801140:	be 00 00 00 00       	mov    $0x0,%esi
+  801145:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801148:	b8 16 00 00 00       	mov    $0x16,%eax
+  80114d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801150:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801153:	89 f7                	mov    %esi,%edi
+  801155:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801157:	83 c4 08             	add    $0x8,%esp
+  80115a:	85 c0                	test   %eax,%eax
+  80115c:	7f 08                	jg     801166 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  80115e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801161:	5b                   	pop    %ebx
+  801162:	5e                   	pop    %esi
+  801163:	5f                   	pop    %edi
+  801164:	5d                   	pop    %ebp
+  801165:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801166:	83 ec 0c             	sub    $0xc,%esp
+  801169:	50                   	push   %eax
+  80116a:	6a 16                	push   $0x16
+  80116c:	68 6b 2b 80 00       	push   $0x802b6b
+  801171:	6a 23                	push   $0x23
+  801173:	68 88 2b 80 00       	push   $0x802b88
+  801178:	e8 6c 11 00 00       	call   8022e9 <_panic>
+
+0080117d <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80117d:	55                   	push   %ebp
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	57                   	push   %edi
+  801181:	56                   	push   %esi
+  801182:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801183:	6a 04                	push   $0x4
+  801185:	ff 75 08             	push   0x8(%ebp)
+  801188:	e8 d4 f9 ff ff       	call   800b61 <touch_mem>
+	asm volatile("int %1\n"
+  80118d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801192:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801195:	b8 17 00 00 00       	mov    $0x17,%eax
+  80119a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119d:	89 df                	mov    %ebx,%edi
+  80119f:	89 de                	mov    %ebx,%esi
+  8011a1:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8011a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a6:	5b                   	pop    %ebx
+  8011a7:	5e                   	pop    %esi
+  8011a8:	5f                   	pop    %edi
+  8011a9:	5d                   	pop    %ebp
+  8011aa:	c3                   	ret
+
+008011ab <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8011ab:	55                   	push   %ebp
+  8011ac:	89 e5                	mov    %esp,%ebp
+  8011ae:	57                   	push   %edi
+  8011af:	56                   	push   %esi
+  8011b0:	53                   	push   %ebx
+  8011b1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011c1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011c6:	89 df                	mov    %ebx,%edi
+  8011c8:	89 de                	mov    %ebx,%esi
+  8011ca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011cc:	85 c0                	test   %eax,%eax
+  8011ce:	7f 08                	jg     8011d8 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  8011d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d3:	5b                   	pop    %ebx
+  8011d4:	5e                   	pop    %esi
+  8011d5:	5f                   	pop    %edi
+  8011d6:	5d                   	pop    %ebp
+  8011d7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011d8:	83 ec 0c             	sub    $0xc,%esp
+  8011db:	50                   	push   %eax
+  8011dc:	6a 0e                	push   $0xe
+  8011de:	68 6b 2b 80 00       	push   $0x802b6b
+  8011e3:	6a 23                	push   $0x23
+  8011e5:	68 88 2b 80 00       	push   $0x802b88
+  8011ea:	e8 fa 10 00 00       	call   8022e9 <_panic>
+
+008011ef <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	56                   	push   %esi
+  8011f3:	53                   	push   %ebx
+  8011f4:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8011f7:	a1 00 40 80 00       	mov    0x804000,%eax
+  8011fc:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  8011ff:	85 db                	test   %ebx,%ebx
+  801201:	78 17                	js     80121a <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  801203:	83 ec 0c             	sub    $0xc,%esp
+  801206:	56                   	push   %esi
+  801207:	ff 14 9d 20 40 80 00 	call   *0x804020(,%ebx,4)
+  80120e:	83 c4 10             	add    $0x10,%esp
+  801211:	85 c0                	test   %eax,%eax
+  801213:	75 27                	jne    80123c <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  801215:	83 eb 01             	sub    $0x1,%ebx
+  801218:	eb e5                	jmp    8011ff <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  80121a:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80121f:	8b 40 48             	mov    0x48(%eax),%eax
+  801222:	83 ec 08             	sub    $0x8,%esp
+  801225:	ff 76 28             	push   0x28(%esi)
+  801228:	ff 36                	push   (%esi)
+  80122a:	50                   	push   %eax
+  80122b:	68 98 2b 80 00       	push   $0x802b98
+  801230:	6a 1d                	push   $0x1d
+  801232:	68 bb 2b 80 00       	push   $0x802bbb
+  801237:	e8 ad 10 00 00       	call   8022e9 <_panic>
+}
+  80123c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80123f:	5b                   	pop    %ebx
+  801240:	5e                   	pop    %esi
+  801241:	5d                   	pop    %ebp
+  801242:	c3                   	ret
+
+00801243 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801243:	55                   	push   %ebp
+  801244:	89 e5                	mov    %esp,%ebp
+  801246:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  801249:	83 3d 48 40 80 00 00 	cmpl   $0x0,0x804048
+  801250:	74 0a                	je     80125c <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801252:	8b 45 08             	mov    0x8(%ebp),%eax
+  801255:	a3 48 40 80 00       	mov    %eax,0x804048
+}
+  80125a:	c9                   	leave
+  80125b:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  80125c:	83 ec 04             	sub    $0x4,%esp
+  80125f:	6a 07                	push   $0x7
+  801261:	68 00 f0 bf ee       	push   $0xeebff000
+  801266:	6a 00                	push   $0x0
+  801268:	e8 e7 f9 ff ff       	call   800c54 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80126d:	83 c4 08             	add    $0x8,%esp
+  801270:	68 e3 12 80 00       	push   $0x8012e3
+  801275:	6a 00                	push   $0x0
+  801277:	e8 3e fd ff ff       	call   800fba <sys_env_set_pgfault_upcall>
+  80127c:	83 c4 10             	add    $0x10,%esp
+  80127f:	eb d1                	jmp    801252 <set_pgfault_handler+0xf>
+
+00801281 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  801281:	55                   	push   %ebp
+  801282:	89 e5                	mov    %esp,%ebp
+  801284:	83 ec 08             	sub    $0x8,%esp
+  801287:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  80128a:	8b 15 00 40 80 00    	mov    0x804000,%edx
+  801290:	b8 00 00 00 00       	mov    $0x0,%eax
+  801295:	eb 03                	jmp    80129a <add_pgfault_handler+0x19>
+  801297:	83 c0 01             	add    $0x1,%eax
+  80129a:	39 d0                	cmp    %edx,%eax
+  80129c:	74 0b                	je     8012a9 <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  80129e:	39 0c 85 20 40 80 00 	cmp    %ecx,0x804020(,%eax,4)
+  8012a5:	75 f0                	jne    801297 <add_pgfault_handler+0x16>
+  8012a7:	eb 24                	jmp    8012cd <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  8012a9:	83 fa 0a             	cmp    $0xa,%edx
+  8012ac:	74 21                	je     8012cf <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  8012ae:	8d 42 01             	lea    0x1(%edx),%eax
+  8012b1:	a3 00 40 80 00       	mov    %eax,0x804000
+  8012b6:	89 0c 95 20 40 80 00 	mov    %ecx,0x804020(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  8012bd:	83 ec 0c             	sub    $0xc,%esp
+  8012c0:	68 ef 11 80 00       	push   $0x8011ef
+  8012c5:	e8 79 ff ff ff       	call   801243 <set_pgfault_handler>
+  8012ca:	83 c4 10             	add    $0x10,%esp
+}
+  8012cd:	c9                   	leave
+  8012ce:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  8012cf:	83 ec 04             	sub    $0x4,%esp
+  8012d2:	68 c9 2b 80 00       	push   $0x802bc9
+  8012d7:	6a 44                	push   $0x44
+  8012d9:	68 bb 2b 80 00       	push   $0x802bbb
+  8012de:	e8 06 10 00 00       	call   8022e9 <_panic>
+
+008012e3 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8012e3:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8012e4:	a1 48 40 80 00       	mov    0x804048,%eax
+	call *%eax
+  8012e9:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8012eb:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  8012ee:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  8012f2:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  8012f6:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  8012f9:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  8012fb:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  8012ff:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  801302:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  801303:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  801306:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  801307:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  801308:	c3                   	ret
+
+00801309 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801309:	55                   	push   %ebp
+  80130a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80130c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80130f:	05 00 00 00 30       	add    $0x30000000,%eax
+  801314:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801317:	5d                   	pop    %ebp
+  801318:	c3                   	ret
+
+00801319 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801319:	55                   	push   %ebp
+  80131a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80131c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80131f:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801324:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801329:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80132e:	5d                   	pop    %ebp
+  80132f:	c3                   	ret
+
+00801330 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801330:	55                   	push   %ebp
+  801331:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801333:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801338:	a8 01                	test   $0x1,%al
+  80133a:	74 3c                	je     801378 <fd_alloc+0x48>
+  80133c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801341:	89 c2                	mov    %eax,%edx
+  801343:	c1 ea 0c             	shr    $0xc,%edx
+  801346:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80134d:	89 c1                	mov    %eax,%ecx
+  80134f:	05 00 10 00 00       	add    $0x1000,%eax
+  801354:	f6 c2 01             	test   $0x1,%dl
+  801357:	74 13                	je     80136c <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801359:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80135e:	75 e1                	jne    801341 <fd_alloc+0x11>
+  801360:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801365:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80136a:	eb 05                	jmp    801371 <fd_alloc+0x41>
+			return 0;
+  80136c:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801371:	8b 55 08             	mov    0x8(%ebp),%edx
+  801374:	89 0a                	mov    %ecx,(%edx)
+}
+  801376:	5d                   	pop    %ebp
+  801377:	c3                   	ret
+  801378:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  80137d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801382:	eb ed                	jmp    801371 <fd_alloc+0x41>
+
+00801384 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801384:	55                   	push   %ebp
+  801385:	89 e5                	mov    %esp,%ebp
+  801387:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80138a:	83 f8 1f             	cmp    $0x1f,%eax
+  80138d:	77 30                	ja     8013bf <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80138f:	c1 e0 0c             	shl    $0xc,%eax
+  801392:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801397:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80139d:	f6 c2 01             	test   $0x1,%dl
+  8013a0:	74 24                	je     8013c6 <fd_lookup+0x42>
+  8013a2:	89 c2                	mov    %eax,%edx
+  8013a4:	c1 ea 0c             	shr    $0xc,%edx
+  8013a7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013ae:	f6 c2 01             	test   $0x1,%dl
+  8013b1:	74 1a                	je     8013cd <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8013b3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013b6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8013b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013bd:	5d                   	pop    %ebp
+  8013be:	c3                   	ret
+		return -E_INVAL;
+  8013bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013c4:	eb f7                	jmp    8013bd <fd_lookup+0x39>
+		return -E_INVAL;
+  8013c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013cb:	eb f0                	jmp    8013bd <fd_lookup+0x39>
+  8013cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013d2:	eb e9                	jmp    8013bd <fd_lookup+0x39>
+
+008013d4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013d4:	55                   	push   %ebp
+  8013d5:	89 e5                	mov    %esp,%ebp
+  8013d7:	53                   	push   %ebx
+  8013d8:	83 ec 04             	sub    $0x4,%esp
+  8013db:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8013de:	b8 60 2c 80 00       	mov    $0x802c60,%eax
+  8013e3:	8b 18                	mov    (%eax),%ebx
+  8013e5:	85 db                	test   %ebx,%ebx
+  8013e7:	74 0e                	je     8013f7 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  8013e9:	83 c0 04             	add    $0x4,%eax
+  8013ec:	39 13                	cmp    %edx,(%ebx)
+  8013ee:	75 f3                	jne    8013e3 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  8013f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f5:	eb 1f                	jmp    801416 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013f7:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8013fc:	8b 40 48             	mov    0x48(%eax),%eax
+  8013ff:	83 ec 04             	sub    $0x4,%esp
+  801402:	52                   	push   %edx
+  801403:	50                   	push   %eax
+  801404:	68 e4 2b 80 00       	push   $0x802be4
+  801409:	e8 6c ed ff ff       	call   80017a <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80140e:	83 c4 10             	add    $0x10,%esp
+  801411:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801416:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801419:	89 1a                	mov    %ebx,(%edx)
+}
+  80141b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80141e:	c9                   	leave
+  80141f:	c3                   	ret
+
+00801420 <fd_close>:
+{
+  801420:	55                   	push   %ebp
+  801421:	89 e5                	mov    %esp,%ebp
+  801423:	57                   	push   %edi
+  801424:	56                   	push   %esi
+  801425:	53                   	push   %ebx
+  801426:	83 ec 24             	sub    $0x24,%esp
+  801429:	8b 75 08             	mov    0x8(%ebp),%esi
+  80142c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80142f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801432:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801433:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801439:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80143c:	50                   	push   %eax
+  80143d:	e8 42 ff ff ff       	call   801384 <fd_lookup>
+  801442:	89 c3                	mov    %eax,%ebx
+  801444:	83 c4 10             	add    $0x10,%esp
+  801447:	85 c0                	test   %eax,%eax
+  801449:	78 05                	js     801450 <fd_close+0x30>
+	    || fd != fd2)
+  80144b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80144e:	74 16                	je     801466 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801450:	89 f8                	mov    %edi,%eax
+  801452:	84 c0                	test   %al,%al
+  801454:	b8 00 00 00 00       	mov    $0x0,%eax
+  801459:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80145c:	89 d8                	mov    %ebx,%eax
+  80145e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801461:	5b                   	pop    %ebx
+  801462:	5e                   	pop    %esi
+  801463:	5f                   	pop    %edi
+  801464:	5d                   	pop    %ebp
+  801465:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801466:	83 ec 08             	sub    $0x8,%esp
+  801469:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80146c:	50                   	push   %eax
+  80146d:	ff 36                	push   (%esi)
+  80146f:	e8 60 ff ff ff       	call   8013d4 <dev_lookup>
+  801474:	89 c3                	mov    %eax,%ebx
+  801476:	83 c4 10             	add    $0x10,%esp
+  801479:	85 c0                	test   %eax,%eax
+  80147b:	78 1a                	js     801497 <fd_close+0x77>
+		if (dev->dev_close)
+  80147d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801480:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801483:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801488:	85 c0                	test   %eax,%eax
+  80148a:	74 0b                	je     801497 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80148c:	83 ec 0c             	sub    $0xc,%esp
+  80148f:	56                   	push   %esi
+  801490:	ff d0                	call   *%eax
+  801492:	89 c3                	mov    %eax,%ebx
+  801494:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801497:	83 ec 08             	sub    $0x8,%esp
+  80149a:	56                   	push   %esi
+  80149b:	6a 00                	push   $0x0
+  80149d:	e8 37 f8 ff ff       	call   800cd9 <sys_page_unmap>
+	return r;
+  8014a2:	83 c4 10             	add    $0x10,%esp
+  8014a5:	eb b5                	jmp    80145c <fd_close+0x3c>
+
+008014a7 <close>:
+
+int
+close(int fdnum)
+{
+  8014a7:	55                   	push   %ebp
+  8014a8:	89 e5                	mov    %esp,%ebp
+  8014aa:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014b0:	50                   	push   %eax
+  8014b1:	ff 75 08             	push   0x8(%ebp)
+  8014b4:	e8 cb fe ff ff       	call   801384 <fd_lookup>
+  8014b9:	83 c4 10             	add    $0x10,%esp
+  8014bc:	85 c0                	test   %eax,%eax
+  8014be:	79 02                	jns    8014c2 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8014c0:	c9                   	leave
+  8014c1:	c3                   	ret
+		return fd_close(fd, 1);
+  8014c2:	83 ec 08             	sub    $0x8,%esp
+  8014c5:	6a 01                	push   $0x1
+  8014c7:	ff 75 f4             	push   -0xc(%ebp)
+  8014ca:	e8 51 ff ff ff       	call   801420 <fd_close>
+  8014cf:	83 c4 10             	add    $0x10,%esp
+  8014d2:	eb ec                	jmp    8014c0 <close+0x19>
+
+008014d4 <close_all>:
+
+void
+close_all(void)
+{
+  8014d4:	55                   	push   %ebp
+  8014d5:	89 e5                	mov    %esp,%ebp
+  8014d7:	53                   	push   %ebx
+  8014d8:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8014db:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8014e0:	83 ec 0c             	sub    $0xc,%esp
+  8014e3:	53                   	push   %ebx
+  8014e4:	e8 be ff ff ff       	call   8014a7 <close>
+	for (i = 0; i < MAXFD; i++)
+  8014e9:	83 c3 01             	add    $0x1,%ebx
+  8014ec:	83 c4 10             	add    $0x10,%esp
+  8014ef:	83 fb 20             	cmp    $0x20,%ebx
+  8014f2:	75 ec                	jne    8014e0 <close_all+0xc>
+}
+  8014f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014f7:	c9                   	leave
+  8014f8:	c3                   	ret
+
+008014f9 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014f9:	55                   	push   %ebp
+  8014fa:	89 e5                	mov    %esp,%ebp
+  8014fc:	57                   	push   %edi
+  8014fd:	56                   	push   %esi
+  8014fe:	53                   	push   %ebx
+  8014ff:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801502:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801505:	50                   	push   %eax
+  801506:	ff 75 08             	push   0x8(%ebp)
+  801509:	e8 76 fe ff ff       	call   801384 <fd_lookup>
+  80150e:	89 c3                	mov    %eax,%ebx
+  801510:	83 c4 10             	add    $0x10,%esp
+  801513:	85 c0                	test   %eax,%eax
+  801515:	78 7f                	js     801596 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801517:	83 ec 0c             	sub    $0xc,%esp
+  80151a:	ff 75 0c             	push   0xc(%ebp)
+  80151d:	e8 85 ff ff ff       	call   8014a7 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801522:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801525:	c1 e6 0c             	shl    $0xc,%esi
+  801528:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80152e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801531:	89 3c 24             	mov    %edi,(%esp)
+  801534:	e8 e0 fd ff ff       	call   801319 <fd2data>
+  801539:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80153b:	89 34 24             	mov    %esi,(%esp)
+  80153e:	e8 d6 fd ff ff       	call   801319 <fd2data>
+  801543:	83 c4 10             	add    $0x10,%esp
+  801546:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801549:	89 d8                	mov    %ebx,%eax
+  80154b:	c1 e8 16             	shr    $0x16,%eax
+  80154e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801555:	a8 01                	test   $0x1,%al
+  801557:	74 11                	je     80156a <dup+0x71>
+  801559:	89 d8                	mov    %ebx,%eax
+  80155b:	c1 e8 0c             	shr    $0xc,%eax
+  80155e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801565:	f6 c2 01             	test   $0x1,%dl
+  801568:	75 36                	jne    8015a0 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80156a:	89 f8                	mov    %edi,%eax
+  80156c:	c1 e8 0c             	shr    $0xc,%eax
+  80156f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801576:	83 ec 0c             	sub    $0xc,%esp
+  801579:	25 07 0e 00 00       	and    $0xe07,%eax
+  80157e:	50                   	push   %eax
+  80157f:	56                   	push   %esi
+  801580:	6a 00                	push   $0x0
+  801582:	57                   	push   %edi
+  801583:	6a 00                	push   $0x0
+  801585:	e8 0d f7 ff ff       	call   800c97 <sys_page_map>
+  80158a:	89 c3                	mov    %eax,%ebx
+  80158c:	83 c4 20             	add    $0x20,%esp
+  80158f:	85 c0                	test   %eax,%eax
+  801591:	78 33                	js     8015c6 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801593:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801596:	89 d8                	mov    %ebx,%eax
+  801598:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80159b:	5b                   	pop    %ebx
+  80159c:	5e                   	pop    %esi
+  80159d:	5f                   	pop    %edi
+  80159e:	5d                   	pop    %ebp
+  80159f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8015a0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015a7:	83 ec 0c             	sub    $0xc,%esp
+  8015aa:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015af:	50                   	push   %eax
+  8015b0:	ff 75 d4             	push   -0x2c(%ebp)
+  8015b3:	6a 00                	push   $0x0
+  8015b5:	53                   	push   %ebx
+  8015b6:	6a 00                	push   $0x0
+  8015b8:	e8 da f6 ff ff       	call   800c97 <sys_page_map>
+  8015bd:	89 c3                	mov    %eax,%ebx
+  8015bf:	83 c4 20             	add    $0x20,%esp
+  8015c2:	85 c0                	test   %eax,%eax
+  8015c4:	79 a4                	jns    80156a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8015c6:	83 ec 08             	sub    $0x8,%esp
+  8015c9:	56                   	push   %esi
+  8015ca:	6a 00                	push   $0x0
+  8015cc:	e8 08 f7 ff ff       	call   800cd9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8015d1:	83 c4 08             	add    $0x8,%esp
+  8015d4:	ff 75 d4             	push   -0x2c(%ebp)
+  8015d7:	6a 00                	push   $0x0
+  8015d9:	e8 fb f6 ff ff       	call   800cd9 <sys_page_unmap>
+	return r;
+  8015de:	83 c4 10             	add    $0x10,%esp
+  8015e1:	eb b3                	jmp    801596 <dup+0x9d>
+
+008015e3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015e3:	55                   	push   %ebp
+  8015e4:	89 e5                	mov    %esp,%ebp
+  8015e6:	56                   	push   %esi
+  8015e7:	53                   	push   %ebx
+  8015e8:	83 ec 18             	sub    $0x18,%esp
+  8015eb:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015ee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015f1:	50                   	push   %eax
+  8015f2:	56                   	push   %esi
+  8015f3:	e8 8c fd ff ff       	call   801384 <fd_lookup>
+  8015f8:	83 c4 10             	add    $0x10,%esp
+  8015fb:	85 c0                	test   %eax,%eax
+  8015fd:	78 3c                	js     80163b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015ff:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801602:	83 ec 08             	sub    $0x8,%esp
+  801605:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801608:	50                   	push   %eax
+  801609:	ff 33                	push   (%ebx)
+  80160b:	e8 c4 fd ff ff       	call   8013d4 <dev_lookup>
+  801610:	83 c4 10             	add    $0x10,%esp
+  801613:	85 c0                	test   %eax,%eax
+  801615:	78 24                	js     80163b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801617:	8b 43 08             	mov    0x8(%ebx),%eax
+  80161a:	83 e0 03             	and    $0x3,%eax
+  80161d:	83 f8 01             	cmp    $0x1,%eax
+  801620:	74 20                	je     801642 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801622:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801625:	8b 40 08             	mov    0x8(%eax),%eax
+  801628:	85 c0                	test   %eax,%eax
+  80162a:	74 37                	je     801663 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80162c:	83 ec 04             	sub    $0x4,%esp
+  80162f:	ff 75 10             	push   0x10(%ebp)
+  801632:	ff 75 0c             	push   0xc(%ebp)
+  801635:	53                   	push   %ebx
+  801636:	ff d0                	call   *%eax
+  801638:	83 c4 10             	add    $0x10,%esp
+}
+  80163b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80163e:	5b                   	pop    %ebx
+  80163f:	5e                   	pop    %esi
+  801640:	5d                   	pop    %ebp
+  801641:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801642:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801647:	8b 40 48             	mov    0x48(%eax),%eax
+  80164a:	83 ec 04             	sub    $0x4,%esp
+  80164d:	56                   	push   %esi
+  80164e:	50                   	push   %eax
+  80164f:	68 25 2c 80 00       	push   $0x802c25
+  801654:	e8 21 eb ff ff       	call   80017a <cprintf>
+		return -E_INVAL;
+  801659:	83 c4 10             	add    $0x10,%esp
+  80165c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801661:	eb d8                	jmp    80163b <read+0x58>
+		return -E_NOT_SUPP;
+  801663:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801668:	eb d1                	jmp    80163b <read+0x58>
+
+0080166a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80166a:	55                   	push   %ebp
+  80166b:	89 e5                	mov    %esp,%ebp
+  80166d:	57                   	push   %edi
+  80166e:	56                   	push   %esi
+  80166f:	53                   	push   %ebx
+  801670:	83 ec 0c             	sub    $0xc,%esp
+  801673:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801676:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801679:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80167e:	eb 02                	jmp    801682 <readn+0x18>
+  801680:	01 c3                	add    %eax,%ebx
+  801682:	39 f3                	cmp    %esi,%ebx
+  801684:	73 21                	jae    8016a7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801686:	83 ec 04             	sub    $0x4,%esp
+  801689:	89 f0                	mov    %esi,%eax
+  80168b:	29 d8                	sub    %ebx,%eax
+  80168d:	50                   	push   %eax
+  80168e:	89 d8                	mov    %ebx,%eax
+  801690:	03 45 0c             	add    0xc(%ebp),%eax
+  801693:	50                   	push   %eax
+  801694:	57                   	push   %edi
+  801695:	e8 49 ff ff ff       	call   8015e3 <read>
+		if (m < 0)
+  80169a:	83 c4 10             	add    $0x10,%esp
+  80169d:	85 c0                	test   %eax,%eax
+  80169f:	78 04                	js     8016a5 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8016a1:	75 dd                	jne    801680 <readn+0x16>
+  8016a3:	eb 02                	jmp    8016a7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016a5:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8016a7:	89 d8                	mov    %ebx,%eax
+  8016a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ac:	5b                   	pop    %ebx
+  8016ad:	5e                   	pop    %esi
+  8016ae:	5f                   	pop    %edi
+  8016af:	5d                   	pop    %ebp
+  8016b0:	c3                   	ret
+
+008016b1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8016b1:	55                   	push   %ebp
+  8016b2:	89 e5                	mov    %esp,%ebp
+  8016b4:	56                   	push   %esi
+  8016b5:	53                   	push   %ebx
+  8016b6:	83 ec 18             	sub    $0x18,%esp
+  8016b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016bc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016bf:	50                   	push   %eax
+  8016c0:	53                   	push   %ebx
+  8016c1:	e8 be fc ff ff       	call   801384 <fd_lookup>
+  8016c6:	83 c4 10             	add    $0x10,%esp
+  8016c9:	85 c0                	test   %eax,%eax
+  8016cb:	78 37                	js     801704 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016cd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016d0:	83 ec 08             	sub    $0x8,%esp
+  8016d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d6:	50                   	push   %eax
+  8016d7:	ff 36                	push   (%esi)
+  8016d9:	e8 f6 fc ff ff       	call   8013d4 <dev_lookup>
+  8016de:	83 c4 10             	add    $0x10,%esp
+  8016e1:	85 c0                	test   %eax,%eax
+  8016e3:	78 1f                	js     801704 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016e5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016e9:	74 20                	je     80170b <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8016eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ee:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016f1:	85 c0                	test   %eax,%eax
+  8016f3:	74 37                	je     80172c <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8016f5:	83 ec 04             	sub    $0x4,%esp
+  8016f8:	ff 75 10             	push   0x10(%ebp)
+  8016fb:	ff 75 0c             	push   0xc(%ebp)
+  8016fe:	56                   	push   %esi
+  8016ff:	ff d0                	call   *%eax
+  801701:	83 c4 10             	add    $0x10,%esp
+}
+  801704:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801707:	5b                   	pop    %ebx
+  801708:	5e                   	pop    %esi
+  801709:	5d                   	pop    %ebp
+  80170a:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80170b:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801710:	8b 40 48             	mov    0x48(%eax),%eax
+  801713:	83 ec 04             	sub    $0x4,%esp
+  801716:	53                   	push   %ebx
+  801717:	50                   	push   %eax
+  801718:	68 41 2c 80 00       	push   $0x802c41
+  80171d:	e8 58 ea ff ff       	call   80017a <cprintf>
+		return -E_INVAL;
+  801722:	83 c4 10             	add    $0x10,%esp
+  801725:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80172a:	eb d8                	jmp    801704 <write+0x53>
+		return -E_NOT_SUPP;
+  80172c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801731:	eb d1                	jmp    801704 <write+0x53>
+
+00801733 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801733:	55                   	push   %ebp
+  801734:	89 e5                	mov    %esp,%ebp
+  801736:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801739:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80173c:	50                   	push   %eax
+  80173d:	ff 75 08             	push   0x8(%ebp)
+  801740:	e8 3f fc ff ff       	call   801384 <fd_lookup>
+  801745:	83 c4 10             	add    $0x10,%esp
+  801748:	85 c0                	test   %eax,%eax
+  80174a:	78 0e                	js     80175a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80174c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80174f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801752:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801755:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80175a:	c9                   	leave
+  80175b:	c3                   	ret
+
+0080175c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80175c:	55                   	push   %ebp
+  80175d:	89 e5                	mov    %esp,%ebp
+  80175f:	56                   	push   %esi
+  801760:	53                   	push   %ebx
+  801761:	83 ec 18             	sub    $0x18,%esp
+  801764:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801767:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80176a:	50                   	push   %eax
+  80176b:	53                   	push   %ebx
+  80176c:	e8 13 fc ff ff       	call   801384 <fd_lookup>
+  801771:	83 c4 10             	add    $0x10,%esp
+  801774:	85 c0                	test   %eax,%eax
+  801776:	78 34                	js     8017ac <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801778:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80177b:	83 ec 08             	sub    $0x8,%esp
+  80177e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801781:	50                   	push   %eax
+  801782:	ff 36                	push   (%esi)
+  801784:	e8 4b fc ff ff       	call   8013d4 <dev_lookup>
+  801789:	83 c4 10             	add    $0x10,%esp
+  80178c:	85 c0                	test   %eax,%eax
+  80178e:	78 1c                	js     8017ac <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801790:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801794:	74 1d                	je     8017b3 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801796:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801799:	8b 40 18             	mov    0x18(%eax),%eax
+  80179c:	85 c0                	test   %eax,%eax
+  80179e:	74 34                	je     8017d4 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8017a0:	83 ec 08             	sub    $0x8,%esp
+  8017a3:	ff 75 0c             	push   0xc(%ebp)
+  8017a6:	56                   	push   %esi
+  8017a7:	ff d0                	call   *%eax
+  8017a9:	83 c4 10             	add    $0x10,%esp
+}
+  8017ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017af:	5b                   	pop    %ebx
+  8017b0:	5e                   	pop    %esi
+  8017b1:	5d                   	pop    %ebp
+  8017b2:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8017b3:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8017b8:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017bb:	83 ec 04             	sub    $0x4,%esp
+  8017be:	53                   	push   %ebx
+  8017bf:	50                   	push   %eax
+  8017c0:	68 04 2c 80 00       	push   $0x802c04
+  8017c5:	e8 b0 e9 ff ff       	call   80017a <cprintf>
+		return -E_INVAL;
+  8017ca:	83 c4 10             	add    $0x10,%esp
+  8017cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d2:	eb d8                	jmp    8017ac <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017d4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017d9:	eb d1                	jmp    8017ac <ftruncate+0x50>
+
+008017db <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017db:	55                   	push   %ebp
+  8017dc:	89 e5                	mov    %esp,%ebp
+  8017de:	56                   	push   %esi
+  8017df:	53                   	push   %ebx
+  8017e0:	83 ec 18             	sub    $0x18,%esp
+  8017e3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017e6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017e9:	50                   	push   %eax
+  8017ea:	ff 75 08             	push   0x8(%ebp)
+  8017ed:	e8 92 fb ff ff       	call   801384 <fd_lookup>
+  8017f2:	83 c4 10             	add    $0x10,%esp
+  8017f5:	85 c0                	test   %eax,%eax
+  8017f7:	78 49                	js     801842 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017f9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017fc:	83 ec 08             	sub    $0x8,%esp
+  8017ff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801802:	50                   	push   %eax
+  801803:	ff 36                	push   (%esi)
+  801805:	e8 ca fb ff ff       	call   8013d4 <dev_lookup>
+  80180a:	83 c4 10             	add    $0x10,%esp
+  80180d:	85 c0                	test   %eax,%eax
+  80180f:	78 31                	js     801842 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801811:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801814:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801818:	74 2f                	je     801849 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80181a:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80181d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801824:	00 00 00 
+	stat->st_isdir = 0;
+  801827:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80182e:	00 00 00 
+	stat->st_dev = dev;
+  801831:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801837:	83 ec 08             	sub    $0x8,%esp
+  80183a:	53                   	push   %ebx
+  80183b:	56                   	push   %esi
+  80183c:	ff 50 14             	call   *0x14(%eax)
+  80183f:	83 c4 10             	add    $0x10,%esp
+}
+  801842:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801845:	5b                   	pop    %ebx
+  801846:	5e                   	pop    %esi
+  801847:	5d                   	pop    %ebp
+  801848:	c3                   	ret
+		return -E_NOT_SUPP;
+  801849:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80184e:	eb f2                	jmp    801842 <fstat+0x67>
+
+00801850 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801850:	55                   	push   %ebp
+  801851:	89 e5                	mov    %esp,%ebp
+  801853:	56                   	push   %esi
+  801854:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801855:	83 ec 08             	sub    $0x8,%esp
+  801858:	6a 00                	push   $0x0
+  80185a:	ff 75 08             	push   0x8(%ebp)
+  80185d:	e8 bc 02 00 00       	call   801b1e <open>
+  801862:	89 c3                	mov    %eax,%ebx
+  801864:	83 c4 10             	add    $0x10,%esp
+  801867:	85 c0                	test   %eax,%eax
+  801869:	78 1b                	js     801886 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80186b:	83 ec 08             	sub    $0x8,%esp
+  80186e:	ff 75 0c             	push   0xc(%ebp)
+  801871:	50                   	push   %eax
+  801872:	e8 64 ff ff ff       	call   8017db <fstat>
+  801877:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801879:	89 1c 24             	mov    %ebx,(%esp)
+  80187c:	e8 26 fc ff ff       	call   8014a7 <close>
+	return r;
+  801881:	83 c4 10             	add    $0x10,%esp
+  801884:	89 f3                	mov    %esi,%ebx
+}
+  801886:	89 d8                	mov    %ebx,%eax
+  801888:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80188b:	5b                   	pop    %ebx
+  80188c:	5e                   	pop    %esi
+  80188d:	5d                   	pop    %ebp
+  80188e:	c3                   	ret
+
+0080188f <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  80188f:	55                   	push   %ebp
+  801890:	89 e5                	mov    %esp,%ebp
+  801892:	57                   	push   %edi
+  801893:	56                   	push   %esi
+  801894:	53                   	push   %ebx
+  801895:	83 ec 0c             	sub    $0xc,%esp
+  801898:	89 c7                	mov    %eax,%edi
+  80189a:	89 d3                	mov    %edx,%ebx
+  80189c:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80189e:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018a5:	74 2d                	je     8018d4 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018a7:	6a 07                	push   $0x7
+  8018a9:	68 00 50 80 00       	push   $0x805000
+  8018ae:	57                   	push   %edi
+  8018af:	ff 35 04 40 80 00    	push   0x804004
+  8018b5:	e8 c3 0b 00 00       	call   80247d <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  8018ba:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8018c1:	6a 00                	push   $0x0
+  8018c3:	56                   	push   %esi
+  8018c4:	53                   	push   %ebx
+  8018c5:	6a 00                	push   $0x0
+  8018c7:	e8 63 0a 00 00       	call   80232f <ipc_recv_pages>
+}
+  8018cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018cf:	5b                   	pop    %ebx
+  8018d0:	5e                   	pop    %esi
+  8018d1:	5f                   	pop    %edi
+  8018d2:	5d                   	pop    %ebp
+  8018d3:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018d4:	83 ec 0c             	sub    $0xc,%esp
+  8018d7:	6a 01                	push   $0x1
+  8018d9:	e8 94 0c 00 00       	call   802572 <ipc_find_env>
+  8018de:	a3 04 40 80 00       	mov    %eax,0x804004
+  8018e3:	83 c4 10             	add    $0x10,%esp
+  8018e6:	eb bf                	jmp    8018a7 <fsipc_pages+0x18>
+
+008018e8 <fsipc>:
+{
+  8018e8:	55                   	push   %ebp
+  8018e9:	89 e5                	mov    %esp,%ebp
+  8018eb:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  8018ee:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018f3:	e8 97 ff ff ff       	call   80188f <fsipc_pages>
+}
+  8018f8:	c9                   	leave
+  8018f9:	c3                   	ret
+
+008018fa <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018fa:	55                   	push   %ebp
+  8018fb:	89 e5                	mov    %esp,%ebp
+  8018fd:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801900:	8b 45 08             	mov    0x8(%ebp),%eax
+  801903:	8b 40 0c             	mov    0xc(%eax),%eax
+  801906:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  80190b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80190e:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801913:	ba 00 00 00 00       	mov    $0x0,%edx
+  801918:	b8 02 00 00 00       	mov    $0x2,%eax
+  80191d:	e8 c6 ff ff ff       	call   8018e8 <fsipc>
+}
+  801922:	c9                   	leave
+  801923:	c3                   	ret
+
+00801924 <devfile_flush>:
+{
+  801924:	55                   	push   %ebp
+  801925:	89 e5                	mov    %esp,%ebp
+  801927:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80192a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80192d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801930:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801935:	ba 00 00 00 00       	mov    $0x0,%edx
+  80193a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80193f:	e8 a4 ff ff ff       	call   8018e8 <fsipc>
+}
+  801944:	c9                   	leave
+  801945:	c3                   	ret
+
+00801946 <devfile_stat>:
+{
+  801946:	55                   	push   %ebp
+  801947:	89 e5                	mov    %esp,%ebp
+  801949:	53                   	push   %ebx
+  80194a:	83 ec 04             	sub    $0x4,%esp
+  80194d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801950:	8b 45 08             	mov    0x8(%ebp),%eax
+  801953:	8b 40 0c             	mov    0xc(%eax),%eax
+  801956:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80195b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801960:	b8 05 00 00 00       	mov    $0x5,%eax
+  801965:	e8 7e ff ff ff       	call   8018e8 <fsipc>
+  80196a:	85 c0                	test   %eax,%eax
+  80196c:	78 2c                	js     80199a <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80196e:	83 ec 08             	sub    $0x8,%esp
+  801971:	68 00 50 80 00       	push   $0x805000
+  801976:	53                   	push   %ebx
+  801977:	e8 e5 ed ff ff       	call   800761 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80197c:	a1 80 50 80 00       	mov    0x805080,%eax
+  801981:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801987:	a1 84 50 80 00       	mov    0x805084,%eax
+  80198c:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801992:	83 c4 10             	add    $0x10,%esp
+  801995:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80199a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80199d:	c9                   	leave
+  80199e:	c3                   	ret
+
+0080199f <devfile_write>:
+{
+  80199f:	55                   	push   %ebp
+  8019a0:	89 e5                	mov    %esp,%ebp
+  8019a2:	83 ec 0c             	sub    $0xc,%esp
+  8019a5:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8019a8:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8019ad:	39 d0                	cmp    %edx,%eax
+  8019af:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8019b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019b5:	8b 52 0c             	mov    0xc(%edx),%edx
+  8019b8:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  8019be:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8019c3:	50                   	push   %eax
+  8019c4:	ff 75 0c             	push   0xc(%ebp)
+  8019c7:	68 08 50 80 00       	push   $0x805008
+  8019cc:	e8 16 ef ff ff       	call   8008e7 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8019d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019d6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019db:	e8 08 ff ff ff       	call   8018e8 <fsipc>
+}
+  8019e0:	c9                   	leave
+  8019e1:	c3                   	ret
+
+008019e2 <devfile_read>:
+{
+  8019e2:	55                   	push   %ebp
+  8019e3:	89 e5                	mov    %esp,%ebp
+  8019e5:	57                   	push   %edi
+  8019e6:	56                   	push   %esi
+  8019e7:	53                   	push   %ebx
+  8019e8:	83 ec 1c             	sub    $0x1c,%esp
+  8019eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019ee:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8019f1:	89 fe                	mov    %edi,%esi
+  8019f3:	c1 ee 0c             	shr    $0xc,%esi
+  8019f6:	b8 20 00 00 00       	mov    $0x20,%eax
+  8019fb:	39 c6                	cmp    %eax,%esi
+  8019fd:	0f 47 f0             	cmova  %eax,%esi
+  801a00:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a03:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a08:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801a0b:	eb 14                	jmp    801a21 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a0d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801a14:	05 00 10 00 00       	add    $0x1000,%eax
+  801a19:	f6 c6 06             	test   $0x6,%dh
+  801a1c:	75 42                	jne    801a60 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a1e:	83 c1 01             	add    $0x1,%ecx
+  801a21:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801a24:	39 f1                	cmp    %esi,%ecx
+  801a26:	0f 84 95 00 00 00    	je     801ac1 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801a2c:	89 c2                	mov    %eax,%edx
+  801a2e:	c1 ea 16             	shr    $0x16,%edx
+  801a31:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a38:	f6 c2 01             	test   $0x1,%dl
+  801a3b:	74 23                	je     801a60 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801a3d:	89 c2                	mov    %eax,%edx
+  801a3f:	c1 ea 0c             	shr    $0xc,%edx
+  801a42:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801a49:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801a4f:	74 0f                	je     801a60 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801a51:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801a58:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801a5e:	75 ad                	jne    801a0d <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801a60:	85 c9                	test   %ecx,%ecx
+  801a62:	74 11                	je     801a75 <devfile_read+0x93>
+  801a64:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801a6b:	75 08                	jne    801a75 <devfile_read+0x93>
+  801a6d:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801a73:	74 50                	je     801ac5 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a75:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a78:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  801a7d:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a83:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a88:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a8d:	e8 56 fe ff ff       	call   8018e8 <fsipc>
+  801a92:	89 c6                	mov    %eax,%esi
+  801a94:	85 c0                	test   %eax,%eax
+  801a96:	78 1f                	js     801ab7 <devfile_read+0xd5>
+	assert(r <= n);
+  801a98:	39 c7                	cmp    %eax,%edi
+  801a9a:	72 50                	jb     801aec <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801a9c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801aa1:	7f 62                	jg     801b05 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801aa3:	83 ec 04             	sub    $0x4,%esp
+  801aa6:	50                   	push   %eax
+  801aa7:	68 00 50 80 00       	push   $0x805000
+  801aac:	ff 75 0c             	push   0xc(%ebp)
+  801aaf:	e8 33 ee ff ff       	call   8008e7 <memmove>
+	return r;
+  801ab4:	83 c4 10             	add    $0x10,%esp
+}
+  801ab7:	89 f0                	mov    %esi,%eax
+  801ab9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801abc:	5b                   	pop    %ebx
+  801abd:	5e                   	pop    %esi
+  801abe:	5f                   	pop    %edi
+  801abf:	5d                   	pop    %ebp
+  801ac0:	c3                   	ret
+  801ac1:	89 f1                	mov    %esi,%ecx
+  801ac3:	eb 9b                	jmp    801a60 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801ac5:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801ac8:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801acd:	89 c8                	mov    %ecx,%eax
+  801acf:	c1 e0 0c             	shl    $0xc,%eax
+  801ad2:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801ad7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ada:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801adf:	e8 ab fd ff ff       	call   80188f <fsipc_pages>
+  801ae4:	89 c6                	mov    %eax,%esi
+  801ae6:	85 c0                	test   %eax,%eax
+  801ae8:	78 8b                	js     801a75 <devfile_read+0x93>
+  801aea:	eb cb                	jmp    801ab7 <devfile_read+0xd5>
+	assert(r <= n);
+  801aec:	68 70 2c 80 00       	push   $0x802c70
+  801af1:	68 77 2c 80 00       	push   $0x802c77
+  801af6:	68 a0 00 00 00       	push   $0xa0
+  801afb:	68 8c 2c 80 00       	push   $0x802c8c
+  801b00:	e8 e4 07 00 00       	call   8022e9 <_panic>
+	assert(r <= PGSIZE);
+  801b05:	68 97 2c 80 00       	push   $0x802c97
+  801b0a:	68 77 2c 80 00       	push   $0x802c77
+  801b0f:	68 a1 00 00 00       	push   $0xa1
+  801b14:	68 8c 2c 80 00       	push   $0x802c8c
+  801b19:	e8 cb 07 00 00       	call   8022e9 <_panic>
+
+00801b1e <open>:
+{
+  801b1e:	55                   	push   %ebp
+  801b1f:	89 e5                	mov    %esp,%ebp
+  801b21:	56                   	push   %esi
+  801b22:	53                   	push   %ebx
+  801b23:	83 ec 1c             	sub    $0x1c,%esp
+  801b26:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801b29:	56                   	push   %esi
+  801b2a:	e8 f7 eb ff ff       	call   800726 <strlen>
+  801b2f:	83 c4 10             	add    $0x10,%esp
+  801b32:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b37:	7f 6c                	jg     801ba5 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801b39:	83 ec 0c             	sub    $0xc,%esp
+  801b3c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b3f:	50                   	push   %eax
+  801b40:	e8 eb f7 ff ff       	call   801330 <fd_alloc>
+  801b45:	89 c3                	mov    %eax,%ebx
+  801b47:	83 c4 10             	add    $0x10,%esp
+  801b4a:	85 c0                	test   %eax,%eax
+  801b4c:	78 3c                	js     801b8a <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801b4e:	83 ec 08             	sub    $0x8,%esp
+  801b51:	56                   	push   %esi
+  801b52:	68 00 50 80 00       	push   $0x805000
+  801b57:	e8 05 ec ff ff       	call   800761 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b5f:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b64:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b67:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b6c:	e8 77 fd ff ff       	call   8018e8 <fsipc>
+  801b71:	89 c3                	mov    %eax,%ebx
+  801b73:	83 c4 10             	add    $0x10,%esp
+  801b76:	85 c0                	test   %eax,%eax
+  801b78:	78 19                	js     801b93 <open+0x75>
+	return fd2num(fd);
+  801b7a:	83 ec 0c             	sub    $0xc,%esp
+  801b7d:	ff 75 f4             	push   -0xc(%ebp)
+  801b80:	e8 84 f7 ff ff       	call   801309 <fd2num>
+  801b85:	89 c3                	mov    %eax,%ebx
+  801b87:	83 c4 10             	add    $0x10,%esp
+}
+  801b8a:	89 d8                	mov    %ebx,%eax
+  801b8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b8f:	5b                   	pop    %ebx
+  801b90:	5e                   	pop    %esi
+  801b91:	5d                   	pop    %ebp
+  801b92:	c3                   	ret
+		fd_close(fd, 0);
+  801b93:	83 ec 08             	sub    $0x8,%esp
+  801b96:	6a 00                	push   $0x0
+  801b98:	ff 75 f4             	push   -0xc(%ebp)
+  801b9b:	e8 80 f8 ff ff       	call   801420 <fd_close>
+		return r;
+  801ba0:	83 c4 10             	add    $0x10,%esp
+  801ba3:	eb e5                	jmp    801b8a <open+0x6c>
+		return -E_BAD_PATH;
+  801ba5:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801baa:	eb de                	jmp    801b8a <open+0x6c>
+
+00801bac <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801bac:	55                   	push   %ebp
+  801bad:	89 e5                	mov    %esp,%ebp
+  801baf:	53                   	push   %ebx
+  801bb0:	83 ec 10             	sub    $0x10,%esp
+  801bb3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801bb6:	53                   	push   %ebx
+  801bb7:	e8 6a eb ff ff       	call   800726 <strlen>
+  801bbc:	83 c4 10             	add    $0x10,%esp
+  801bbf:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bc4:	7f 25                	jg     801beb <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801bc6:	83 ec 08             	sub    $0x8,%esp
+  801bc9:	53                   	push   %ebx
+  801bca:	68 00 50 80 00       	push   $0x805000
+  801bcf:	e8 8d eb ff ff       	call   800761 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801bd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd9:	b8 07 00 00 00       	mov    $0x7,%eax
+  801bde:	e8 05 fd ff ff       	call   8018e8 <fsipc>
+  801be3:	83 c4 10             	add    $0x10,%esp
+}
+  801be6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801be9:	c9                   	leave
+  801bea:	c3                   	ret
+		return -E_BAD_PATH;
+  801beb:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801bf0:	eb f4                	jmp    801be6 <remove+0x3a>
+
+00801bf2 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801bf2:	55                   	push   %ebp
+  801bf3:	89 e5                	mov    %esp,%ebp
+  801bf5:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801bf8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bfd:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c02:	e8 e1 fc ff ff       	call   8018e8 <fsipc>
+}
+  801c07:	c9                   	leave
+  801c08:	c3                   	ret
+
+00801c09 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801c09:	55                   	push   %ebp
+  801c0a:	89 e5                	mov    %esp,%ebp
+  801c0c:	53                   	push   %ebx
+  801c0d:	83 ec 04             	sub    $0x4,%esp
+  801c10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801c13:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c18:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c1d:	e8 c6 fc ff ff       	call   8018e8 <fsipc>
+  801c22:	85 c0                	test   %eax,%eax
+  801c24:	78 3c                	js     801c62 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801c26:	a1 00 50 80 00       	mov    0x805000,%eax
+  801c2b:	89 03                	mov    %eax,(%ebx)
+  801c2d:	a1 04 50 80 00       	mov    0x805004,%eax
+  801c32:	89 43 04             	mov    %eax,0x4(%ebx)
+  801c35:	a1 08 50 80 00       	mov    0x805008,%eax
+  801c3a:	89 43 08             	mov    %eax,0x8(%ebx)
+  801c3d:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801c42:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801c45:	a1 10 50 80 00       	mov    0x805010,%eax
+  801c4a:	89 43 10             	mov    %eax,0x10(%ebx)
+  801c4d:	a1 14 50 80 00       	mov    0x805014,%eax
+  801c52:	89 43 14             	mov    %eax,0x14(%ebx)
+  801c55:	a1 18 50 80 00       	mov    0x805018,%eax
+  801c5a:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c65:	c9                   	leave
+  801c66:	c3                   	ret
+
+00801c67 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801c67:	55                   	push   %ebp
+  801c68:	89 e5                	mov    %esp,%ebp
+  801c6a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801c6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c70:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  801c75:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c7a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c7f:	e8 64 fc ff ff       	call   8018e8 <fsipc>
+}
+  801c84:	c9                   	leave
+  801c85:	c3                   	ret
+
+00801c86 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c86:	55                   	push   %ebp
+  801c87:	89 e5                	mov    %esp,%ebp
+  801c89:	56                   	push   %esi
+  801c8a:	53                   	push   %ebx
+  801c8b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801c8e:	83 ec 0c             	sub    $0xc,%esp
+  801c91:	ff 75 08             	push   0x8(%ebp)
+  801c94:	e8 80 f6 ff ff       	call   801319 <fd2data>
+  801c99:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801c9b:	83 c4 08             	add    $0x8,%esp
+  801c9e:	68 a3 2c 80 00       	push   $0x802ca3
+  801ca3:	53                   	push   %ebx
+  801ca4:	e8 b8 ea ff ff       	call   800761 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801ca9:	8b 46 04             	mov    0x4(%esi),%eax
+  801cac:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801cb2:	2b 0e                	sub    (%esi),%ecx
+  801cb4:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801cb9:	89 c8                	mov    %ecx,%eax
+  801cbb:	f7 e2                	mul    %edx
+  801cbd:	c1 ea 0c             	shr    $0xc,%edx
+  801cc0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801cc6:	29 d1                	sub    %edx,%ecx
+  801cc8:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801cce:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801cd5:	00 00 00 
+	stat->st_dev = &devpipe;
+  801cd8:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  801cdf:	30 80 00 
+	return 0;
+}
+  801ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cea:	5b                   	pop    %ebx
+  801ceb:	5e                   	pop    %esi
+  801cec:	5d                   	pop    %ebp
+  801ced:	c3                   	ret
+
+00801cee <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801cee:	55                   	push   %ebp
+  801cef:	89 e5                	mov    %esp,%ebp
+  801cf1:	53                   	push   %ebx
+  801cf2:	83 ec 0c             	sub    $0xc,%esp
+  801cf5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801cf8:	53                   	push   %ebx
+  801cf9:	6a 00                	push   $0x0
+  801cfb:	e8 d9 ef ff ff       	call   800cd9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801d00:	89 1c 24             	mov    %ebx,(%esp)
+  801d03:	e8 11 f6 ff ff       	call   801319 <fd2data>
+  801d08:	83 c4 08             	add    $0x8,%esp
+  801d0b:	50                   	push   %eax
+  801d0c:	6a 00                	push   $0x0
+  801d0e:	e8 c6 ef ff ff       	call   800cd9 <sys_page_unmap>
+}
+  801d13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d16:	c9                   	leave
+  801d17:	c3                   	ret
+
+00801d18 <_pipeisclosed>:
+{
+  801d18:	55                   	push   %ebp
+  801d19:	89 e5                	mov    %esp,%ebp
+  801d1b:	57                   	push   %edi
+  801d1c:	56                   	push   %esi
+  801d1d:	53                   	push   %ebx
+  801d1e:	83 ec 1c             	sub    $0x1c,%esp
+  801d21:	89 c7                	mov    %eax,%edi
+  801d23:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801d25:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801d2a:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801d2d:	83 ec 0c             	sub    $0xc,%esp
+  801d30:	57                   	push   %edi
+  801d31:	e8 7b 08 00 00       	call   8025b1 <pageref>
+  801d36:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d39:	89 34 24             	mov    %esi,(%esp)
+  801d3c:	e8 70 08 00 00       	call   8025b1 <pageref>
+		nn = thisenv->env_runs;
+  801d41:	8b 15 0c 40 80 00    	mov    0x80400c,%edx
+  801d47:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801d4a:	83 c4 10             	add    $0x10,%esp
+  801d4d:	39 cb                	cmp    %ecx,%ebx
+  801d4f:	74 1b                	je     801d6c <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801d51:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801d54:	75 cf                	jne    801d25 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801d56:	8b 42 58             	mov    0x58(%edx),%eax
+  801d59:	6a 01                	push   $0x1
+  801d5b:	50                   	push   %eax
+  801d5c:	53                   	push   %ebx
+  801d5d:	68 aa 2c 80 00       	push   $0x802caa
+  801d62:	e8 13 e4 ff ff       	call   80017a <cprintf>
+  801d67:	83 c4 10             	add    $0x10,%esp
+  801d6a:	eb b9                	jmp    801d25 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801d6c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801d6f:	0f 94 c0             	sete   %al
+  801d72:	0f b6 c0             	movzbl %al,%eax
+}
+  801d75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d78:	5b                   	pop    %ebx
+  801d79:	5e                   	pop    %esi
+  801d7a:	5f                   	pop    %edi
+  801d7b:	5d                   	pop    %ebp
+  801d7c:	c3                   	ret
+
+00801d7d <devpipe_read>:
+{
+  801d7d:	55                   	push   %ebp
+  801d7e:	89 e5                	mov    %esp,%ebp
+  801d80:	57                   	push   %edi
+  801d81:	56                   	push   %esi
+  801d82:	53                   	push   %ebx
+  801d83:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801d86:	ff 75 08             	push   0x8(%ebp)
+  801d89:	e8 8b f5 ff ff       	call   801319 <fd2data>
+  801d8e:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801d90:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801d93:	8d 40 04             	lea    0x4(%eax),%eax
+  801d96:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801d99:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801d9c:	8b 0b                	mov    (%ebx),%ecx
+  801d9e:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801da4:	29 ce                	sub    %ecx,%esi
+  801da6:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801dab:	f7 e6                	mul    %esi
+  801dad:	c1 ea 0c             	shr    $0xc,%edx
+  801db0:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801db6:	29 c6                	sub    %eax,%esi
+  801db8:	89 f2                	mov    %esi,%edx
+  801dba:	75 43                	jne    801dff <devpipe_read+0x82>
+		ref = pageref(p);
+  801dbc:	83 ec 0c             	sub    $0xc,%esp
+  801dbf:	53                   	push   %ebx
+  801dc0:	e8 ec 07 00 00       	call   8025b1 <pageref>
+  801dc5:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801dc7:	89 da                	mov    %ebx,%edx
+  801dc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dcc:	e8 47 ff ff ff       	call   801d18 <_pipeisclosed>
+  801dd1:	83 c4 10             	add    $0x10,%esp
+  801dd4:	85 c0                	test   %eax,%eax
+  801dd6:	0f 85 c1 00 00 00    	jne    801e9d <devpipe_read+0x120>
+	*sleeping = 1;
+  801ddc:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801de3:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801de8:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801deb:	75 ac                	jne    801d99 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801ded:	83 ec 04             	sub    $0x4,%esp
+  801df0:	56                   	push   %esi
+  801df1:	57                   	push   %edi
+  801df2:	ff 75 e4             	push   -0x1c(%ebp)
+  801df5:	e8 33 f3 ff ff       	call   80112d <sys_futex_wait>
+  801dfa:	83 c4 10             	add    $0x10,%esp
+  801dfd:	eb 9a                	jmp    801d99 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801dff:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801e02:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801e06:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801e08:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e0d:	f7 e1                	mul    %ecx
+  801e0f:	c1 ea 0b             	shr    $0xb,%edx
+  801e12:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801e18:	29 c1                	sub    %eax,%ecx
+  801e1a:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801e1c:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801e21:	29 cf                	sub    %ecx,%edi
+  801e23:	39 f7                	cmp    %esi,%edi
+  801e25:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801e28:	8d 43 10             	lea    0x10(%ebx),%eax
+  801e2b:	83 ec 04             	sub    $0x4,%esp
+  801e2e:	57                   	push   %edi
+  801e2f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e32:	01 c2                	add    %eax,%edx
+  801e34:	52                   	push   %edx
+  801e35:	ff 75 0c             	push   0xc(%ebp)
+  801e38:	e8 aa ea ff ff       	call   8008e7 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801e3d:	83 c4 0c             	add    $0xc,%esp
+  801e40:	89 f1                	mov    %esi,%ecx
+  801e42:	29 f9                	sub    %edi,%ecx
+  801e44:	51                   	push   %ecx
+  801e45:	ff 75 e4             	push   -0x1c(%ebp)
+  801e48:	89 f8                	mov    %edi,%eax
+  801e4a:	03 45 0c             	add    0xc(%ebp),%eax
+  801e4d:	50                   	push   %eax
+  801e4e:	e8 94 ea ff ff       	call   8008e7 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801e53:	89 f1                	mov    %esi,%ecx
+  801e55:	03 0b                	add    (%ebx),%ecx
+  801e57:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e5c:	f7 e1                	mul    %ecx
+  801e5e:	c1 ea 0c             	shr    $0xc,%edx
+  801e61:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801e67:	29 d1                	sub    %edx,%ecx
+  801e69:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801e6b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801e70:	83 c4 10             	add    $0x10,%esp
+  801e73:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801e77:	75 0a                	jne    801e83 <devpipe_read+0x106>
+	return n;
+  801e79:	89 f0                	mov    %esi,%eax
+}
+  801e7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e7e:	5b                   	pop    %ebx
+  801e7f:	5e                   	pop    %esi
+  801e80:	5f                   	pop    %edi
+  801e81:	5d                   	pop    %ebp
+  801e82:	c3                   	ret
+		*sleeping = 0;
+  801e83:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801e8a:	83 ec 08             	sub    $0x8,%esp
+  801e8d:	68 00 04 00 00       	push   $0x400
+  801e92:	53                   	push   %ebx
+  801e93:	e8 e5 f2 ff ff       	call   80117d <sys_futex_wake>
+  801e98:	83 c4 10             	add    $0x10,%esp
+  801e9b:	eb dc                	jmp    801e79 <devpipe_read+0xfc>
+			return 0;
+  801e9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea2:	eb d7                	jmp    801e7b <devpipe_read+0xfe>
+
+00801ea4 <devpipe_write>:
+{
+  801ea4:	55                   	push   %ebp
+  801ea5:	89 e5                	mov    %esp,%ebp
+  801ea7:	57                   	push   %edi
+  801ea8:	56                   	push   %esi
+  801ea9:	53                   	push   %ebx
+  801eaa:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801ead:	ff 75 08             	push   0x8(%ebp)
+  801eb0:	e8 64 f4 ff ff       	call   801319 <fd2data>
+  801eb5:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801eb7:	83 c4 10             	add    $0x10,%esp
+  801eba:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801ec1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ec4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801ec7:	0f 83 23 01 00 00    	jae    801ff0 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801ecd:	8b 77 04             	mov    0x4(%edi),%esi
+  801ed0:	8b 1f                	mov    (%edi),%ebx
+  801ed2:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801ed8:	29 d9                	sub    %ebx,%ecx
+  801eda:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801edf:	f7 e1                	mul    %ecx
+  801ee1:	c1 ea 0c             	shr    $0xc,%edx
+  801ee4:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801eea:	29 c1                	sub    %eax,%ecx
+  801eec:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801eee:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801ef4:	75 40                	jne    801f36 <devpipe_write+0x92>
+			ref = pageref(p);
+  801ef6:	83 ec 0c             	sub    $0xc,%esp
+  801ef9:	57                   	push   %edi
+  801efa:	e8 b2 06 00 00       	call   8025b1 <pageref>
+  801eff:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801f01:	89 fa                	mov    %edi,%edx
+  801f03:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f06:	e8 0d fe ff ff       	call   801d18 <_pipeisclosed>
+  801f0b:	83 c4 10             	add    $0x10,%esp
+  801f0e:	85 c0                	test   %eax,%eax
+  801f10:	0f 85 d5 00 00 00    	jne    801feb <devpipe_write+0x147>
+	*sleeping = 1;
+  801f16:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801f1d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801f22:	39 1f                	cmp    %ebx,(%edi)
+  801f24:	75 a7                	jne    801ecd <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801f26:	83 ec 04             	sub    $0x4,%esp
+  801f29:	56                   	push   %esi
+  801f2a:	53                   	push   %ebx
+  801f2b:	57                   	push   %edi
+  801f2c:	e8 fc f1 ff ff       	call   80112d <sys_futex_wait>
+  801f31:	83 c4 10             	add    $0x10,%esp
+  801f34:	eb 97                	jmp    801ecd <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801f36:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801f39:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f3c:	29 c1                	sub    %eax,%ecx
+  801f3e:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801f43:	89 d8                	mov    %ebx,%eax
+  801f45:	29 d0                	sub    %edx,%eax
+  801f47:	39 c1                	cmp    %eax,%ecx
+  801f49:	0f 46 c1             	cmovbe %ecx,%eax
+  801f4c:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801f4e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f53:	f7 e6                	mul    %esi
+  801f55:	c1 ea 0b             	shr    $0xb,%edx
+  801f58:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801f5e:	29 c6                	sub    %eax,%esi
+  801f60:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801f62:	29 f3                	sub    %esi,%ebx
+  801f64:	39 cb                	cmp    %ecx,%ebx
+  801f66:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801f69:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801f6c:	8d 77 10             	lea    0x10(%edi),%esi
+  801f6f:	83 ec 04             	sub    $0x4,%esp
+  801f72:	53                   	push   %ebx
+  801f73:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f76:	03 45 0c             	add    0xc(%ebp),%eax
+  801f79:	50                   	push   %eax
+  801f7a:	01 f2                	add    %esi,%edx
+  801f7c:	52                   	push   %edx
+  801f7d:	e8 65 e9 ff ff       	call   8008e7 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  801f82:	83 c4 0c             	add    $0xc,%esp
+  801f85:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f88:	29 d8                	sub    %ebx,%eax
+  801f8a:	50                   	push   %eax
+  801f8b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f8e:	01 d3                	add    %edx,%ebx
+  801f90:	03 5d 0c             	add    0xc(%ebp),%ebx
+  801f93:	53                   	push   %ebx
+  801f94:	56                   	push   %esi
+  801f95:	e8 4d e9 ff ff       	call   8008e7 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  801f9a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801f9d:	03 4f 04             	add    0x4(%edi),%ecx
+  801fa0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801fa5:	f7 e1                	mul    %ecx
+  801fa7:	c1 ea 0c             	shr    $0xc,%edx
+  801faa:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801fb0:	29 d1                	sub    %edx,%ecx
+  801fb2:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  801fb5:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801fba:	83 c4 10             	add    $0x10,%esp
+  801fbd:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  801fc1:	75 0b                	jne    801fce <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  801fc3:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  801fc6:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801fc9:	e9 f3 fe ff ff       	jmp    801ec1 <devpipe_write+0x1d>
+		*sleeping = 0;
+  801fce:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  801fd5:	83 ec 08             	sub    $0x8,%esp
+  801fd8:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  801fdd:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  801fe0:	50                   	push   %eax
+  801fe1:	e8 97 f1 ff ff       	call   80117d <sys_futex_wake>
+  801fe6:	83 c4 10             	add    $0x10,%esp
+  801fe9:	eb d8                	jmp    801fc3 <devpipe_write+0x11f>
+				return 0;
+  801feb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ff0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ff3:	5b                   	pop    %ebx
+  801ff4:	5e                   	pop    %esi
+  801ff5:	5f                   	pop    %edi
+  801ff6:	5d                   	pop    %ebp
+  801ff7:	c3                   	ret
+
+00801ff8 <pipe>:
+{
+  801ff8:	55                   	push   %ebp
+  801ff9:	89 e5                	mov    %esp,%ebp
+  801ffb:	56                   	push   %esi
+  801ffc:	53                   	push   %ebx
+  801ffd:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802000:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802003:	50                   	push   %eax
+  802004:	e8 27 f3 ff ff       	call   801330 <fd_alloc>
+  802009:	89 c3                	mov    %eax,%ebx
+  80200b:	83 c4 10             	add    $0x10,%esp
+  80200e:	85 c0                	test   %eax,%eax
+  802010:	0f 88 23 01 00 00    	js     802139 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802016:	83 ec 04             	sub    $0x4,%esp
+  802019:	68 07 04 00 00       	push   $0x407
+  80201e:	ff 75 f4             	push   -0xc(%ebp)
+  802021:	6a 00                	push   $0x0
+  802023:	e8 2c ec ff ff       	call   800c54 <sys_page_alloc>
+  802028:	89 c3                	mov    %eax,%ebx
+  80202a:	83 c4 10             	add    $0x10,%esp
+  80202d:	85 c0                	test   %eax,%eax
+  80202f:	0f 88 04 01 00 00    	js     802139 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802035:	83 ec 0c             	sub    $0xc,%esp
+  802038:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80203b:	50                   	push   %eax
+  80203c:	e8 ef f2 ff ff       	call   801330 <fd_alloc>
+  802041:	89 c3                	mov    %eax,%ebx
+  802043:	83 c4 10             	add    $0x10,%esp
+  802046:	85 c0                	test   %eax,%eax
+  802048:	0f 88 db 00 00 00    	js     802129 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80204e:	83 ec 04             	sub    $0x4,%esp
+  802051:	68 07 04 00 00       	push   $0x407
+  802056:	ff 75 f0             	push   -0x10(%ebp)
+  802059:	6a 00                	push   $0x0
+  80205b:	e8 f4 eb ff ff       	call   800c54 <sys_page_alloc>
+  802060:	89 c3                	mov    %eax,%ebx
+  802062:	83 c4 10             	add    $0x10,%esp
+  802065:	85 c0                	test   %eax,%eax
+  802067:	0f 88 bc 00 00 00    	js     802129 <pipe+0x131>
+	va = fd2data(fd0);
+  80206d:	83 ec 0c             	sub    $0xc,%esp
+  802070:	ff 75 f4             	push   -0xc(%ebp)
+  802073:	e8 a1 f2 ff ff       	call   801319 <fd2data>
+  802078:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80207a:	83 c4 0c             	add    $0xc,%esp
+  80207d:	68 07 04 00 00       	push   $0x407
+  802082:	50                   	push   %eax
+  802083:	6a 00                	push   $0x0
+  802085:	e8 ca eb ff ff       	call   800c54 <sys_page_alloc>
+  80208a:	89 c3                	mov    %eax,%ebx
+  80208c:	83 c4 10             	add    $0x10,%esp
+  80208f:	85 c0                	test   %eax,%eax
+  802091:	0f 88 82 00 00 00    	js     802119 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802097:	83 ec 0c             	sub    $0xc,%esp
+  80209a:	ff 75 f0             	push   -0x10(%ebp)
+  80209d:	e8 77 f2 ff ff       	call   801319 <fd2data>
+  8020a2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8020a9:	50                   	push   %eax
+  8020aa:	6a 00                	push   $0x0
+  8020ac:	56                   	push   %esi
+  8020ad:	6a 00                	push   $0x0
+  8020af:	e8 e3 eb ff ff       	call   800c97 <sys_page_map>
+  8020b4:	89 c3                	mov    %eax,%ebx
+  8020b6:	83 c4 20             	add    $0x20,%esp
+  8020b9:	85 c0                	test   %eax,%eax
+  8020bb:	78 4e                	js     80210b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8020bd:	a1 20 30 80 00       	mov    0x803020,%eax
+  8020c2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020c5:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8020c7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020ca:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8020d1:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8020d4:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8020d6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8020d9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8020e0:	83 ec 0c             	sub    $0xc,%esp
+  8020e3:	ff 75 f4             	push   -0xc(%ebp)
+  8020e6:	e8 1e f2 ff ff       	call   801309 <fd2num>
+  8020eb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8020ee:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8020f0:	83 c4 04             	add    $0x4,%esp
+  8020f3:	ff 75 f0             	push   -0x10(%ebp)
+  8020f6:	e8 0e f2 ff ff       	call   801309 <fd2num>
+  8020fb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8020fe:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802101:	83 c4 10             	add    $0x10,%esp
+  802104:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802109:	eb 2e                	jmp    802139 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80210b:	83 ec 08             	sub    $0x8,%esp
+  80210e:	56                   	push   %esi
+  80210f:	6a 00                	push   $0x0
+  802111:	e8 c3 eb ff ff       	call   800cd9 <sys_page_unmap>
+  802116:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802119:	83 ec 08             	sub    $0x8,%esp
+  80211c:	ff 75 f0             	push   -0x10(%ebp)
+  80211f:	6a 00                	push   $0x0
+  802121:	e8 b3 eb ff ff       	call   800cd9 <sys_page_unmap>
+  802126:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802129:	83 ec 08             	sub    $0x8,%esp
+  80212c:	ff 75 f4             	push   -0xc(%ebp)
+  80212f:	6a 00                	push   $0x0
+  802131:	e8 a3 eb ff ff       	call   800cd9 <sys_page_unmap>
+  802136:	83 c4 10             	add    $0x10,%esp
+}
+  802139:	89 d8                	mov    %ebx,%eax
+  80213b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80213e:	5b                   	pop    %ebx
+  80213f:	5e                   	pop    %esi
+  802140:	5d                   	pop    %ebp
+  802141:	c3                   	ret
+
+00802142 <pipeisclosed>:
+{
+  802142:	55                   	push   %ebp
+  802143:	89 e5                	mov    %esp,%ebp
+  802145:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802148:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80214b:	50                   	push   %eax
+  80214c:	ff 75 08             	push   0x8(%ebp)
+  80214f:	e8 30 f2 ff ff       	call   801384 <fd_lookup>
+  802154:	83 c4 10             	add    $0x10,%esp
+  802157:	85 c0                	test   %eax,%eax
+  802159:	78 18                	js     802173 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80215b:	83 ec 0c             	sub    $0xc,%esp
+  80215e:	ff 75 f4             	push   -0xc(%ebp)
+  802161:	e8 b3 f1 ff ff       	call   801319 <fd2data>
+  802166:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802168:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80216b:	e8 a8 fb ff ff       	call   801d18 <_pipeisclosed>
+  802170:	83 c4 10             	add    $0x10,%esp
+}
+  802173:	c9                   	leave
+  802174:	c3                   	ret
+
+00802175 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802175:	b8 00 00 00 00       	mov    $0x0,%eax
+  80217a:	c3                   	ret
+
+0080217b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80217b:	55                   	push   %ebp
+  80217c:	89 e5                	mov    %esp,%ebp
+  80217e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802181:	68 c2 2c 80 00       	push   $0x802cc2
+  802186:	ff 75 0c             	push   0xc(%ebp)
+  802189:	e8 d3 e5 ff ff       	call   800761 <strcpy>
+	return 0;
+}
+  80218e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802193:	c9                   	leave
+  802194:	c3                   	ret
+
+00802195 <devcons_write>:
+{
+  802195:	55                   	push   %ebp
+  802196:	89 e5                	mov    %esp,%ebp
+  802198:	57                   	push   %edi
+  802199:	56                   	push   %esi
+  80219a:	53                   	push   %ebx
+  80219b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8021a1:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8021a6:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8021ac:	eb 2e                	jmp    8021dc <devcons_write+0x47>
+		m = n - tot;
+  8021ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8021b1:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8021b3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8021b8:	39 c3                	cmp    %eax,%ebx
+  8021ba:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8021bd:	83 ec 04             	sub    $0x4,%esp
+  8021c0:	53                   	push   %ebx
+  8021c1:	89 f0                	mov    %esi,%eax
+  8021c3:	03 45 0c             	add    0xc(%ebp),%eax
+  8021c6:	50                   	push   %eax
+  8021c7:	57                   	push   %edi
+  8021c8:	e8 1a e7 ff ff       	call   8008e7 <memmove>
+		sys_cputs(buf, m);
+  8021cd:	83 c4 08             	add    $0x8,%esp
+  8021d0:	53                   	push   %ebx
+  8021d1:	57                   	push   %edi
+  8021d2:	e8 b0 e9 ff ff       	call   800b87 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8021d7:	01 de                	add    %ebx,%esi
+  8021d9:	83 c4 10             	add    $0x10,%esp
+  8021dc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021df:	72 cd                	jb     8021ae <devcons_write+0x19>
+}
+  8021e1:	89 f0                	mov    %esi,%eax
+  8021e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021e6:	5b                   	pop    %ebx
+  8021e7:	5e                   	pop    %esi
+  8021e8:	5f                   	pop    %edi
+  8021e9:	5d                   	pop    %ebp
+  8021ea:	c3                   	ret
+
+008021eb <devcons_read>:
+{
+  8021eb:	55                   	push   %ebp
+  8021ec:	89 e5                	mov    %esp,%ebp
+  8021ee:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8021f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021f6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8021fa:	75 07                	jne    802203 <devcons_read+0x18>
+  8021fc:	eb 1f                	jmp    80221d <devcons_read+0x32>
+		sys_yield();
+  8021fe:	e8 32 ea ff ff       	call   800c35 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802203:	e8 ae e9 ff ff       	call   800bb6 <sys_cgetc>
+  802208:	85 c0                	test   %eax,%eax
+  80220a:	74 f2                	je     8021fe <devcons_read+0x13>
+	if (c < 0)
+  80220c:	78 0f                	js     80221d <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80220e:	83 f8 04             	cmp    $0x4,%eax
+  802211:	74 0c                	je     80221f <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802213:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802216:	88 02                	mov    %al,(%edx)
+	return 1;
+  802218:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80221d:	c9                   	leave
+  80221e:	c3                   	ret
+		return 0;
+  80221f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802224:	eb f7                	jmp    80221d <devcons_read+0x32>
+
+00802226 <cputchar>:
+{
+  802226:	55                   	push   %ebp
+  802227:	89 e5                	mov    %esp,%ebp
+  802229:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80222c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80222f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802232:	6a 01                	push   $0x1
+  802234:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802237:	50                   	push   %eax
+  802238:	e8 4a e9 ff ff       	call   800b87 <sys_cputs>
+}
+  80223d:	83 c4 10             	add    $0x10,%esp
+  802240:	c9                   	leave
+  802241:	c3                   	ret
+
+00802242 <getchar>:
+{
+  802242:	55                   	push   %ebp
+  802243:	89 e5                	mov    %esp,%ebp
+  802245:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802248:	6a 01                	push   $0x1
+  80224a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80224d:	50                   	push   %eax
+  80224e:	6a 00                	push   $0x0
+  802250:	e8 8e f3 ff ff       	call   8015e3 <read>
+	if (r < 0)
+  802255:	83 c4 10             	add    $0x10,%esp
+  802258:	85 c0                	test   %eax,%eax
+  80225a:	78 06                	js     802262 <getchar+0x20>
+	if (r < 1)
+  80225c:	74 06                	je     802264 <getchar+0x22>
+	return c;
+  80225e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802262:	c9                   	leave
+  802263:	c3                   	ret
+		return -E_EOF;
+  802264:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802269:	eb f7                	jmp    802262 <getchar+0x20>
+
+0080226b <iscons>:
+{
+  80226b:	55                   	push   %ebp
+  80226c:	89 e5                	mov    %esp,%ebp
+  80226e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802271:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802274:	50                   	push   %eax
+  802275:	ff 75 08             	push   0x8(%ebp)
+  802278:	e8 07 f1 ff ff       	call   801384 <fd_lookup>
+  80227d:	83 c4 10             	add    $0x10,%esp
+  802280:	85 c0                	test   %eax,%eax
+  802282:	78 11                	js     802295 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802284:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802287:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  80228d:	39 10                	cmp    %edx,(%eax)
+  80228f:	0f 94 c0             	sete   %al
+  802292:	0f b6 c0             	movzbl %al,%eax
+}
+  802295:	c9                   	leave
+  802296:	c3                   	ret
+
+00802297 <opencons>:
+{
+  802297:	55                   	push   %ebp
+  802298:	89 e5                	mov    %esp,%ebp
+  80229a:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80229d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022a0:	50                   	push   %eax
+  8022a1:	e8 8a f0 ff ff       	call   801330 <fd_alloc>
+  8022a6:	83 c4 10             	add    $0x10,%esp
+  8022a9:	85 c0                	test   %eax,%eax
+  8022ab:	78 3a                	js     8022e7 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8022ad:	83 ec 04             	sub    $0x4,%esp
+  8022b0:	68 07 04 00 00       	push   $0x407
+  8022b5:	ff 75 f4             	push   -0xc(%ebp)
+  8022b8:	6a 00                	push   $0x0
+  8022ba:	e8 95 e9 ff ff       	call   800c54 <sys_page_alloc>
+  8022bf:	83 c4 10             	add    $0x10,%esp
+  8022c2:	85 c0                	test   %eax,%eax
+  8022c4:	78 21                	js     8022e7 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8022c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022c9:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  8022cf:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8022d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022d4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8022db:	83 ec 0c             	sub    $0xc,%esp
+  8022de:	50                   	push   %eax
+  8022df:	e8 25 f0 ff ff       	call   801309 <fd2num>
+  8022e4:	83 c4 10             	add    $0x10,%esp
+}
+  8022e7:	c9                   	leave
+  8022e8:	c3                   	ret
+
+008022e9 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8022e9:	55                   	push   %ebp
+  8022ea:	89 e5                	mov    %esp,%ebp
+  8022ec:	56                   	push   %esi
+  8022ed:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8022ee:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8022f1:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  8022f7:	e8 1a e9 ff ff       	call   800c16 <sys_getenvid>
+  8022fc:	83 ec 0c             	sub    $0xc,%esp
+  8022ff:	ff 75 0c             	push   0xc(%ebp)
+  802302:	ff 75 08             	push   0x8(%ebp)
+  802305:	56                   	push   %esi
+  802306:	50                   	push   %eax
+  802307:	68 d0 2c 80 00       	push   $0x802cd0
+  80230c:	e8 69 de ff ff       	call   80017a <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802311:	83 c4 18             	add    $0x18,%esp
+  802314:	53                   	push   %ebx
+  802315:	ff 75 10             	push   0x10(%ebp)
+  802318:	e8 0c de ff ff       	call   800129 <vcprintf>
+	cprintf("\n");
+  80231d:	c7 04 24 bb 2c 80 00 	movl   $0x802cbb,(%esp)
+  802324:	e8 51 de ff ff       	call   80017a <cprintf>
+  802329:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80232c:	cc                   	int3
+	while (1)
+  80232d:	eb fd                	jmp    80232c <_panic+0x43>
+
+0080232f <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  80232f:	55                   	push   %ebp
+  802330:	89 e5                	mov    %esp,%ebp
+  802332:	57                   	push   %edi
+  802333:	56                   	push   %esi
+  802334:	53                   	push   %ebx
+  802335:	83 ec 14             	sub    $0x14,%esp
+  802338:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80233b:	8b 75 14             	mov    0x14(%ebp),%esi
+  80233e:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  802341:	ff 75 10             	push   0x10(%ebp)
+  802344:	ff 75 0c             	push   0xc(%ebp)
+  802347:	e8 2b ed ff ff       	call   801077 <sys_ipc_recv_pages>
+  80234c:	83 c4 10             	add    $0x10,%esp
+  80234f:	85 c0                	test   %eax,%eax
+  802351:	78 46                	js     802399 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802353:	85 ff                	test   %edi,%edi
+  802355:	74 0d                	je     802364 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  802357:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80235c:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802362:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802364:	85 f6                	test   %esi,%esi
+  802366:	74 0d                	je     802375 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  802368:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80236d:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802373:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802375:	85 db                	test   %ebx,%ebx
+  802377:	74 0d                	je     802386 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  802379:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80237e:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802384:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802386:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80238b:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802391:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802394:	5b                   	pop    %ebx
+  802395:	5e                   	pop    %esi
+  802396:	5f                   	pop    %edi
+  802397:	5d                   	pop    %ebp
+  802398:	c3                   	ret
+		if (from_env_store) {
+  802399:	85 ff                	test   %edi,%edi
+  80239b:	74 06                	je     8023a3 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80239d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8023a3:	85 f6                	test   %esi,%esi
+  8023a5:	74 06                	je     8023ad <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  8023a7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8023ad:	85 db                	test   %ebx,%ebx
+  8023af:	74 e0                	je     802391 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8023b1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8023b7:	eb d8                	jmp    802391 <ipc_recv_pages+0x62>
+
+008023b9 <ipc_recv>:
+{
+  8023b9:	55                   	push   %ebp
+  8023ba:	89 e5                	mov    %esp,%ebp
+  8023bc:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8023bf:	6a 00                	push   $0x0
+  8023c1:	ff 75 10             	push   0x10(%ebp)
+  8023c4:	6a 01                	push   $0x1
+  8023c6:	ff 75 0c             	push   0xc(%ebp)
+  8023c9:	ff 75 08             	push   0x8(%ebp)
+  8023cc:	e8 5e ff ff ff       	call   80232f <ipc_recv_pages>
+}
+  8023d1:	c9                   	leave
+  8023d2:	c3                   	ret
+
+008023d3 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8023d3:	55                   	push   %ebp
+  8023d4:	89 e5                	mov    %esp,%ebp
+  8023d6:	56                   	push   %esi
+  8023d7:	53                   	push   %ebx
+  8023d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8023db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8023de:	83 ec 0c             	sub    $0xc,%esp
+  8023e1:	ff 75 0c             	push   0xc(%ebp)
+  8023e4:	e8 c2 ed ff ff       	call   8011ab <sys_ipc_try_recv>
+  8023e9:	83 c4 10             	add    $0x10,%esp
+  8023ec:	85 c0                	test   %eax,%eax
+  8023ee:	78 34                	js     802424 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8023f0:	85 f6                	test   %esi,%esi
+  8023f2:	74 0d                	je     802401 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8023f4:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8023f9:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8023ff:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  802401:	85 db                	test   %ebx,%ebx
+  802403:	74 0d                	je     802412 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  802405:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80240a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802410:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802412:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802417:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80241d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802420:	5b                   	pop    %ebx
+  802421:	5e                   	pop    %esi
+  802422:	5d                   	pop    %ebp
+  802423:	c3                   	ret
+		if (from_env_store) {
+  802424:	85 f6                	test   %esi,%esi
+  802426:	74 06                	je     80242e <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  802428:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  80242e:	85 db                	test   %ebx,%ebx
+  802430:	74 eb                	je     80241d <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  802432:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802438:	eb e3                	jmp    80241d <ipc_try_recv+0x4a>
+
+0080243a <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80243a:	55                   	push   %ebp
+  80243b:	89 e5                	mov    %esp,%ebp
+  80243d:	83 ec 14             	sub    $0x14,%esp
+  802440:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802443:	85 c0                	test   %eax,%eax
+  802445:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80244a:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80244d:	ff 75 18             	push   0x18(%ebp)
+  802450:	ff 75 14             	push   0x14(%ebp)
+  802453:	50                   	push   %eax
+  802454:	ff 75 0c             	push   0xc(%ebp)
+  802457:	ff 75 08             	push   0x8(%ebp)
+  80245a:	e8 db eb ff ff       	call   80103a <sys_ipc_send_pages>
+  80245f:	83 c4 20             	add    $0x20,%esp
+  802462:	85 c0                	test   %eax,%eax
+  802464:	78 02                	js     802468 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  802466:	c9                   	leave
+  802467:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  802468:	50                   	push   %eax
+  802469:	68 f4 2c 80 00       	push   $0x802cf4
+  80246e:	68 80 00 00 00       	push   $0x80
+  802473:	68 20 2d 80 00       	push   $0x802d20
+  802478:	e8 6c fe ff ff       	call   8022e9 <_panic>
+
+0080247d <ipc_send>:
+{
+  80247d:	55                   	push   %ebp
+  80247e:	89 e5                	mov    %esp,%ebp
+  802480:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  802483:	ff 75 14             	push   0x14(%ebp)
+  802486:	6a 01                	push   $0x1
+  802488:	ff 75 10             	push   0x10(%ebp)
+  80248b:	ff 75 0c             	push   0xc(%ebp)
+  80248e:	ff 75 08             	push   0x8(%ebp)
+  802491:	e8 a4 ff ff ff       	call   80243a <ipc_send_pages>
+}
+  802496:	83 c4 20             	add    $0x20,%esp
+  802499:	c9                   	leave
+  80249a:	c3                   	ret
+
+0080249b <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80249b:	55                   	push   %ebp
+  80249c:	89 e5                	mov    %esp,%ebp
+  80249e:	83 ec 14             	sub    $0x14,%esp
+  8024a1:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8024a4:	85 c0                	test   %eax,%eax
+  8024a6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8024ab:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8024ae:	ff 75 18             	push   0x18(%ebp)
+  8024b1:	ff 75 14             	push   0x14(%ebp)
+  8024b4:	50                   	push   %eax
+  8024b5:	ff 75 0c             	push   0xc(%ebp)
+  8024b8:	ff 75 08             	push   0x8(%ebp)
+  8024bb:	e8 0b ec ff ff       	call   8010cb <sys_ipc_call>
+  8024c0:	83 c4 20             	add    $0x20,%esp
+  8024c3:	85 c0                	test   %eax,%eax
+  8024c5:	78 0b                	js     8024d2 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  8024c7:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8024cc:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8024d2:	c9                   	leave
+  8024d3:	c3                   	ret
+
+008024d4 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  8024d4:	55                   	push   %ebp
+  8024d5:	89 e5                	mov    %esp,%ebp
+  8024d7:	57                   	push   %edi
+  8024d8:	56                   	push   %esi
+  8024d9:	53                   	push   %ebx
+  8024da:	83 ec 18             	sub    $0x18,%esp
+  8024dd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024e0:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8024e3:	8b 75 20             	mov    0x20(%ebp),%esi
+  8024e6:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8024e9:	85 c0                	test   %eax,%eax
+  8024eb:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8024f0:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8024f3:	ff 75 18             	push   0x18(%ebp)
+  8024f6:	ff 75 14             	push   0x14(%ebp)
+  8024f9:	50                   	push   %eax
+  8024fa:	ff 75 0c             	push   0xc(%ebp)
+  8024fd:	ff 75 08             	push   0x8(%ebp)
+  802500:	e8 07 ec ff ff       	call   80110c <sys_ipc_reply_recv>
+  802505:	83 c4 20             	add    $0x20,%esp
+  802508:	85 c0                	test   %eax,%eax
+  80250a:	78 46                	js     802552 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80250c:	85 ff                	test   %edi,%edi
+  80250e:	74 0d                	je     80251d <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  802510:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802515:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80251b:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80251d:	85 f6                	test   %esi,%esi
+  80251f:	74 0d                	je     80252e <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  802521:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802526:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80252c:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80252e:	85 db                	test   %ebx,%ebx
+  802530:	74 0d                	je     80253f <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  802532:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802537:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80253d:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80253f:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802544:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80254a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80254d:	5b                   	pop    %ebx
+  80254e:	5e                   	pop    %esi
+  80254f:	5f                   	pop    %edi
+  802550:	5d                   	pop    %ebp
+  802551:	c3                   	ret
+		if (from_env_store) {
+  802552:	85 ff                	test   %edi,%edi
+  802554:	74 06                	je     80255c <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  802556:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80255c:	85 f6                	test   %esi,%esi
+  80255e:	74 06                	je     802566 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  802560:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802566:	85 db                	test   %ebx,%ebx
+  802568:	74 e0                	je     80254a <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  80256a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802570:	eb d8                	jmp    80254a <ipc_reply_recv+0x76>
+
+00802572 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802572:	55                   	push   %ebp
+  802573:	89 e5                	mov    %esp,%ebp
+  802575:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802578:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80257d:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802580:	c1 e0 06             	shl    $0x6,%eax
+  802583:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802588:	8b 40 50             	mov    0x50(%eax),%eax
+  80258b:	39 c8                	cmp    %ecx,%eax
+  80258d:	74 12                	je     8025a1 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80258f:	83 c2 01             	add    $0x1,%edx
+  802592:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802598:	75 e3                	jne    80257d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80259a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80259f:	eb 0e                	jmp    8025af <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8025a1:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8025a4:	c1 e0 06             	shl    $0x6,%eax
+  8025a7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8025ac:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8025af:	5d                   	pop    %ebp
+  8025b0:	c3                   	ret
+
+008025b1 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8025b1:	55                   	push   %ebp
+  8025b2:	89 e5                	mov    %esp,%ebp
+  8025b4:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8025b7:	89 c2                	mov    %eax,%edx
+  8025b9:	c1 ea 16             	shr    $0x16,%edx
+  8025bc:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8025c3:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8025c8:	f6 c1 01             	test   $0x1,%cl
+  8025cb:	74 1e                	je     8025eb <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  8025cd:	c1 e8 0c             	shr    $0xc,%eax
+  8025d0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8025d7:	a8 01                	test   $0x1,%al
+  8025d9:	74 10                	je     8025eb <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8025db:	c1 e8 0c             	shr    $0xc,%eax
+  8025de:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8025e1:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  8025e8:	0f b7 d2             	movzwl %dx,%edx
+}
+  8025eb:	89 d0                	mov    %edx,%eax
+  8025ed:	5d                   	pop    %ebp
+  8025ee:	c3                   	ret
+
+008025ef <udivmod>:
+  8025ef:	55                   	push   %ebp
+  8025f0:	57                   	push   %edi
+  8025f1:	56                   	push   %esi
+  8025f2:	53                   	push   %ebx
+  8025f3:	83 ec 24             	sub    $0x24,%esp
+  8025f6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025fa:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025fe:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802602:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802606:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80260a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80260e:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802612:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802617:	b8 00 00 00 00       	mov    $0x0,%eax
+  80261c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802621:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802628:	00 
+  802629:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802630:	00 
+  802631:	89 fb                	mov    %edi,%ebx
+  802633:	eb 08                	jmp    80263d <udivmod+0x4e>
+  802635:	83 e9 01             	sub    $0x1,%ecx
+  802638:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80263b:	74 68                	je     8026a5 <udivmod+0xb6>
+  80263d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802641:	01 c0                	add    %eax,%eax
+  802643:	89 c6                	mov    %eax,%esi
+  802645:	89 d7                	mov    %edx,%edi
+  802647:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80264b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80264f:	0f ad d0             	shrd   %cl,%edx,%eax
+  802652:	d3 ea                	shr    %cl,%edx
+  802654:	f6 c1 20             	test   $0x20,%cl
+  802657:	74 04                	je     80265d <udivmod+0x6e>
+  802659:	89 d0                	mov    %edx,%eax
+  80265b:	31 d2                	xor    %edx,%edx
+  80265d:	83 e0 01             	and    $0x1,%eax
+  802660:	89 04 24             	mov    %eax,(%esp)
+  802663:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80266a:	00 
+  80266b:	8b 04 24             	mov    (%esp),%eax
+  80266e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802672:	09 f0                	or     %esi,%eax
+  802674:	09 fa                	or     %edi,%edx
+  802676:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80267a:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80267e:	39 f0                	cmp    %esi,%eax
+  802680:	89 d5                	mov    %edx,%ebp
+  802682:	19 fd                	sbb    %edi,%ebp
+  802684:	72 af                	jb     802635 <udivmod+0x46>
+  802686:	29 f0                	sub    %esi,%eax
+  802688:	19 fa                	sbb    %edi,%edx
+  80268a:	89 cf                	mov    %ecx,%edi
+  80268c:	c1 ef 05             	shr    $0x5,%edi
+  80268f:	83 e7 01             	and    $0x1,%edi
+  802692:	89 fe                	mov    %edi,%esi
+  802694:	83 f6 01             	xor    $0x1,%esi
+  802697:	d3 e6                	shl    %cl,%esi
+  802699:	d3 e7                	shl    %cl,%edi
+  80269b:	09 74 24 18          	or     %esi,0x18(%esp)
+  80269f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8026a3:	eb 90                	jmp    802635 <udivmod+0x46>
+  8026a5:	85 db                	test   %ebx,%ebx
+  8026a7:	74 05                	je     8026ae <udivmod+0xbf>
+  8026a9:	89 03                	mov    %eax,(%ebx)
+  8026ab:	89 53 04             	mov    %edx,0x4(%ebx)
+  8026ae:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026b2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026b6:	83 c4 24             	add    $0x24,%esp
+  8026b9:	5b                   	pop    %ebx
+  8026ba:	5e                   	pop    %esi
+  8026bb:	5f                   	pop    %edi
+  8026bc:	5d                   	pop    %ebp
+  8026bd:	c3                   	ret
+
+008026be <__udivdi3>:
+  8026be:	83 ec 08             	sub    $0x8,%esp
+  8026c1:	6a 00                	push   $0x0
+  8026c3:	ff 74 24 1c          	push   0x1c(%esp)
+  8026c7:	ff 74 24 1c          	push   0x1c(%esp)
+  8026cb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026cf:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026d3:	e8 17 ff ff ff       	call   8025ef <udivmod>
+  8026d8:	83 c4 14             	add    $0x14,%esp
+  8026db:	c3                   	ret
+
+008026dc <__umoddi3>:
+  8026dc:	83 ec 18             	sub    $0x18,%esp
+  8026df:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8026e3:	50                   	push   %eax
+  8026e4:	ff 74 24 2c          	push   0x2c(%esp)
+  8026e8:	ff 74 24 2c          	push   0x2c(%esp)
+  8026ec:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026f0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026f4:	e8 f6 fe ff ff       	call   8025ef <udivmod>
+  8026f9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026fd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802701:	83 c4 24             	add    $0x24,%esp
+  802704:	c3                   	ret
+
+00802705 <__divdi3>:
+  802705:	55                   	push   %ebp
+  802706:	57                   	push   %edi
+  802707:	56                   	push   %esi
+  802708:	53                   	push   %ebx
+  802709:	83 ec 10             	sub    $0x10,%esp
+  80270c:	8b 44 24 24          	mov    0x24(%esp),%eax
+  802710:	8b 54 24 28          	mov    0x28(%esp),%edx
+  802714:	89 c6                	mov    %eax,%esi
+  802716:	89 d7                	mov    %edx,%edi
+  802718:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  80271c:	33 7c 24 30          	xor    0x30(%esp),%edi
+  802720:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802724:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  802728:	89 c5                	mov    %eax,%ebp
+  80272a:	f7 dd                	neg    %ebp
+  80272c:	89 d6                	mov    %edx,%esi
+  80272e:	83 d6 00             	adc    $0x0,%esi
+  802731:	f7 de                	neg    %esi
+  802733:	0f 48 e8             	cmovs  %eax,%ebp
+  802736:	0f 49 d6             	cmovns %esi,%edx
+  802739:	6a 00                	push   $0x0
+  80273b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80273f:	f7 de                	neg    %esi
+  802741:	8b 44 24 34          	mov    0x34(%esp),%eax
+  802745:	83 d0 00             	adc    $0x0,%eax
+  802748:	f7 d8                	neg    %eax
+  80274a:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  80274f:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  802754:	50                   	push   %eax
+  802755:	56                   	push   %esi
+  802756:	89 e8                	mov    %ebp,%eax
+  802758:	e8 92 fe ff ff       	call   8025ef <udivmod>
+  80275d:	83 c4 10             	add    $0x10,%esp
+  802760:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  802765:	78 08                	js     80276f <__divdi3+0x6a>
+  802767:	83 c4 0c             	add    $0xc,%esp
+  80276a:	5b                   	pop    %ebx
+  80276b:	5e                   	pop    %esi
+  80276c:	5f                   	pop    %edi
+  80276d:	5d                   	pop    %ebp
+  80276e:	c3                   	ret
+  80276f:	f7 d8                	neg    %eax
+  802771:	83 d2 00             	adc    $0x0,%edx
+  802774:	f7 da                	neg    %edx
+  802776:	eb ef                	jmp    802767 <__divdi3+0x62>
+
+00802778 <__moddi3>:
+  802778:	55                   	push   %ebp
+  802779:	57                   	push   %edi
+  80277a:	56                   	push   %esi
+  80277b:	53                   	push   %ebx
+  80277c:	83 ec 18             	sub    $0x18,%esp
+  80277f:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802783:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802787:	89 f1                	mov    %esi,%ecx
+  802789:	f7 d9                	neg    %ecx
+  80278b:	89 da                	mov    %ebx,%edx
+  80278d:	83 d2 00             	adc    $0x0,%edx
+  802790:	f7 da                	neg    %edx
+  802792:	0f 48 ce             	cmovs  %esi,%ecx
+  802795:	0f 48 d3             	cmovs  %ebx,%edx
+  802798:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80279c:	50                   	push   %eax
+  80279d:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8027a1:	f7 de                	neg    %esi
+  8027a3:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8027a7:	83 d0 00             	adc    $0x0,%eax
+  8027aa:	f7 d8                	neg    %eax
+  8027ac:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8027b1:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8027b6:	50                   	push   %eax
+  8027b7:	56                   	push   %esi
+  8027b8:	89 c8                	mov    %ecx,%eax
+  8027ba:	e8 30 fe ff ff       	call   8025ef <udivmod>
+  8027bf:	83 c4 10             	add    $0x10,%esp
+  8027c2:	85 db                	test   %ebx,%ebx
+  8027c4:	78 10                	js     8027d6 <__moddi3+0x5e>
+  8027c6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027ca:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027ce:	83 c4 14             	add    $0x14,%esp
+  8027d1:	5b                   	pop    %ebx
+  8027d2:	5e                   	pop    %esi
+  8027d3:	5f                   	pop    %edi
+  8027d4:	5d                   	pop    %ebp
+  8027d5:	c3                   	ret
+  8027d6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027da:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027de:	f7 d8                	neg    %eax
+  8027e0:	83 d2 00             	adc    $0x0,%edx
+  8027e3:	f7 da                	neg    %edx
+  8027e5:	eb e7                	jmp    8027ce <__moddi3+0x56>
@@ -0,0 +1,9862 @@
+
+obj/user/faultevilhandler.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 36 00 00 00       	call   800067 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+	page_alloc(0, (void*) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W, 1);
+  800039:	6a 01                	push   $0x1
+  80003b:	6a 07                	push   $0x7
+  80003d:	68 00 f0 bf ee       	push   $0xeebff000
+  800042:	6a 00                	push   $0x0
+  800044:	e8 76 29 00 00       	call   8029bf <page_alloc>
+	sys_env_set_pgfault_upcall(0, (void*) 0xF0100020);
+  800049:	83 c4 08             	add    $0x8,%esp
+  80004c:	68 20 00 10 f0       	push   $0xf0100020
+  800051:	6a 00                	push   $0x0
+  800053:	e8 cb 04 00 00       	call   800523 <sys_env_set_pgfault_upcall>
+	*(int*)0 = 0;
+  800058:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80005f:	00 00 00 
+}
+  800062:	83 c4 10             	add    $0x10,%esp
+  800065:	c9                   	leave
+  800066:	c3                   	ret
+
+00800067 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800067:	55                   	push   %ebp
+  800068:	89 e5                	mov    %esp,%ebp
+  80006a:	56                   	push   %esi
+  80006b:	53                   	push   %ebx
+  80006c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80006f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800072:	e8 08 01 00 00       	call   80017f <sys_getenvid>
+  800077:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80007c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80007f:	c1 e0 06             	shl    $0x6,%eax
+  800082:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800087:	a3 18 e9 80 00       	mov    %eax,0x80e918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80008c:	85 db                	test   %ebx,%ebx
+  80008e:	7e 07                	jle    800097 <libmain+0x30>
+		binaryname = argv[0];
+  800090:	8b 06                	mov    (%esi),%eax
+  800092:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800097:	83 ec 08             	sub    $0x8,%esp
+  80009a:	56                   	push   %esi
+  80009b:	53                   	push   %ebx
+  80009c:	e8 92 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000a1:	e8 0a 00 00 00       	call   8000b0 <exit>
+}
+  8000a6:	83 c4 10             	add    $0x10,%esp
+  8000a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000ac:	5b                   	pop    %ebx
+  8000ad:	5e                   	pop    %esi
+  8000ae:	5d                   	pop    %ebp
+  8000af:	c3                   	ret
+
+008000b0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000b0:	55                   	push   %ebp
+  8000b1:	89 e5                	mov    %esp,%ebp
+  8000b3:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000b6:	e8 68 08 00 00       	call   800923 <close_all>
+	sys_env_destroy(0);
+  8000bb:	83 ec 0c             	sub    $0xc,%esp
+  8000be:	6a 00                	push   $0x0
+  8000c0:	e8 79 00 00 00       	call   80013e <sys_env_destroy>
+}
+  8000c5:	83 c4 10             	add    $0x10,%esp
+  8000c8:	c9                   	leave
+  8000c9:	c3                   	ret
+
+008000ca <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  8000ca:	55                   	push   %ebp
+  8000cb:	89 e5                	mov    %esp,%ebp
+  8000cd:	83 ec 10             	sub    $0x10,%esp
+  8000d0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000d3:	89 c8                	mov    %ecx,%eax
+  8000d5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8000da:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8000dd:	eb 0b                	jmp    8000ea <touch_mem+0x20>
+		c = *(char *)page;
+  8000df:	0f b6 10             	movzbl (%eax),%edx
+  8000e2:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000e5:	05 00 10 00 00       	add    $0x1000,%eax
+  8000ea:	39 c8                	cmp    %ecx,%eax
+  8000ec:	72 f1                	jb     8000df <touch_mem+0x15>
+}
+  8000ee:	c9                   	leave
+  8000ef:	c3                   	ret
+
+008000f0 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000f0:	55                   	push   %ebp
+  8000f1:	89 e5                	mov    %esp,%ebp
+  8000f3:	57                   	push   %edi
+  8000f4:	56                   	push   %esi
+  8000f5:	53                   	push   %ebx
+	touch_mem(s, len);
+  8000f6:	ff 75 0c             	push   0xc(%ebp)
+  8000f9:	ff 75 08             	push   0x8(%ebp)
+  8000fc:	e8 c9 ff ff ff       	call   8000ca <touch_mem>
+	asm volatile("int %1\n"
+  800101:	b8 00 00 00 00       	mov    $0x0,%eax
+  800106:	8b 55 08             	mov    0x8(%ebp),%edx
+  800109:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80010c:	89 c3                	mov    %eax,%ebx
+  80010e:	89 c7                	mov    %eax,%edi
+  800110:	89 c6                	mov    %eax,%esi
+  800112:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800114:	83 c4 08             	add    $0x8,%esp
+  800117:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80011a:	5b                   	pop    %ebx
+  80011b:	5e                   	pop    %esi
+  80011c:	5f                   	pop    %edi
+  80011d:	5d                   	pop    %ebp
+  80011e:	c3                   	ret
+
+0080011f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80011f:	55                   	push   %ebp
+  800120:	89 e5                	mov    %esp,%ebp
+  800122:	57                   	push   %edi
+  800123:	56                   	push   %esi
+  800124:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800125:	ba 00 00 00 00       	mov    $0x0,%edx
+  80012a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80012f:	89 d1                	mov    %edx,%ecx
+  800131:	89 d3                	mov    %edx,%ebx
+  800133:	89 d7                	mov    %edx,%edi
+  800135:	89 d6                	mov    %edx,%esi
+  800137:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800139:	5b                   	pop    %ebx
+  80013a:	5e                   	pop    %esi
+  80013b:	5f                   	pop    %edi
+  80013c:	5d                   	pop    %ebp
+  80013d:	c3                   	ret
+
+0080013e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80013e:	55                   	push   %ebp
+  80013f:	89 e5                	mov    %esp,%ebp
+  800141:	57                   	push   %edi
+  800142:	56                   	push   %esi
+  800143:	53                   	push   %ebx
+  800144:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800147:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80014c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80014f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800154:	89 cb                	mov    %ecx,%ebx
+  800156:	89 cf                	mov    %ecx,%edi
+  800158:	89 ce                	mov    %ecx,%esi
+  80015a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80015c:	85 c0                	test   %eax,%eax
+  80015e:	7f 08                	jg     800168 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800160:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800163:	5b                   	pop    %ebx
+  800164:	5e                   	pop    %esi
+  800165:	5f                   	pop    %edi
+  800166:	5d                   	pop    %ebp
+  800167:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800168:	83 ec 0c             	sub    $0xc,%esp
+  80016b:	50                   	push   %eax
+  80016c:	6a 03                	push   $0x3
+  80016e:	68 aa 4c 80 00       	push   $0x804caa
+  800173:	6a 23                	push   $0x23
+  800175:	68 c7 4c 80 00       	push   $0x804cc7
+  80017a:	e8 70 3a 00 00       	call   803bef <_panic>
+
+0080017f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80017f:	55                   	push   %ebp
+  800180:	89 e5                	mov    %esp,%ebp
+  800182:	57                   	push   %edi
+  800183:	56                   	push   %esi
+  800184:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800185:	ba 00 00 00 00       	mov    $0x0,%edx
+  80018a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80018f:	89 d1                	mov    %edx,%ecx
+  800191:	89 d3                	mov    %edx,%ebx
+  800193:	89 d7                	mov    %edx,%edi
+  800195:	89 d6                	mov    %edx,%esi
+  800197:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800199:	5b                   	pop    %ebx
+  80019a:	5e                   	pop    %esi
+  80019b:	5f                   	pop    %edi
+  80019c:	5d                   	pop    %ebp
+  80019d:	c3                   	ret
+
+0080019e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80019e:	55                   	push   %ebp
+  80019f:	89 e5                	mov    %esp,%ebp
+  8001a1:	57                   	push   %edi
+  8001a2:	56                   	push   %esi
+  8001a3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8001a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001a9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001ae:	89 d1                	mov    %edx,%ecx
+  8001b0:	89 d3                	mov    %edx,%ebx
+  8001b2:	89 d7                	mov    %edx,%edi
+  8001b4:	89 d6                	mov    %edx,%esi
+  8001b6:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8001b8:	5b                   	pop    %ebx
+  8001b9:	5e                   	pop    %esi
+  8001ba:	5f                   	pop    %edi
+  8001bb:	5d                   	pop    %ebp
+  8001bc:	c3                   	ret
+
+008001bd <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001bd:	55                   	push   %ebp
+  8001be:	89 e5                	mov    %esp,%ebp
+  8001c0:	57                   	push   %edi
+  8001c1:	56                   	push   %esi
+  8001c2:	53                   	push   %ebx
+  8001c3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8001cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001d1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001d9:	89 f7                	mov    %esi,%edi
+  8001db:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001dd:	85 c0                	test   %eax,%eax
+  8001df:	7f 08                	jg     8001e9 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001e4:	5b                   	pop    %ebx
+  8001e5:	5e                   	pop    %esi
+  8001e6:	5f                   	pop    %edi
+  8001e7:	5d                   	pop    %ebp
+  8001e8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001e9:	83 ec 0c             	sub    $0xc,%esp
+  8001ec:	50                   	push   %eax
+  8001ed:	6a 04                	push   $0x4
+  8001ef:	68 aa 4c 80 00       	push   $0x804caa
+  8001f4:	6a 23                	push   $0x23
+  8001f6:	68 c7 4c 80 00       	push   $0x804cc7
+  8001fb:	e8 ef 39 00 00       	call   803bef <_panic>
+
+00800200 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800200:	55                   	push   %ebp
+  800201:	89 e5                	mov    %esp,%ebp
+  800203:	57                   	push   %edi
+  800204:	56                   	push   %esi
+  800205:	53                   	push   %ebx
+  800206:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800209:	8b 55 08             	mov    0x8(%ebp),%edx
+  80020c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80020f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800214:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800217:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80021a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80021d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80021f:	85 c0                	test   %eax,%eax
+  800221:	7f 08                	jg     80022b <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800223:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800226:	5b                   	pop    %ebx
+  800227:	5e                   	pop    %esi
+  800228:	5f                   	pop    %edi
+  800229:	5d                   	pop    %ebp
+  80022a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80022b:	83 ec 0c             	sub    $0xc,%esp
+  80022e:	50                   	push   %eax
+  80022f:	6a 05                	push   $0x5
+  800231:	68 aa 4c 80 00       	push   $0x804caa
+  800236:	6a 23                	push   $0x23
+  800238:	68 c7 4c 80 00       	push   $0x804cc7
+  80023d:	e8 ad 39 00 00       	call   803bef <_panic>
+
+00800242 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800242:	55                   	push   %ebp
+  800243:	89 e5                	mov    %esp,%ebp
+  800245:	57                   	push   %edi
+  800246:	56                   	push   %esi
+  800247:	53                   	push   %ebx
+  800248:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80024b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800250:	8b 55 08             	mov    0x8(%ebp),%edx
+  800253:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800256:	b8 06 00 00 00       	mov    $0x6,%eax
+  80025b:	89 df                	mov    %ebx,%edi
+  80025d:	89 de                	mov    %ebx,%esi
+  80025f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800261:	85 c0                	test   %eax,%eax
+  800263:	7f 08                	jg     80026d <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800265:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800268:	5b                   	pop    %ebx
+  800269:	5e                   	pop    %esi
+  80026a:	5f                   	pop    %edi
+  80026b:	5d                   	pop    %ebp
+  80026c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80026d:	83 ec 0c             	sub    $0xc,%esp
+  800270:	50                   	push   %eax
+  800271:	6a 06                	push   $0x6
+  800273:	68 aa 4c 80 00       	push   $0x804caa
+  800278:	6a 23                	push   $0x23
+  80027a:	68 c7 4c 80 00       	push   $0x804cc7
+  80027f:	e8 6b 39 00 00       	call   803bef <_panic>
+
+00800284 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800284:	55                   	push   %ebp
+  800285:	89 e5                	mov    %esp,%ebp
+  800287:	57                   	push   %edi
+  800288:	56                   	push   %esi
+  800289:	53                   	push   %ebx
+  80028a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80028d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800292:	8b 55 08             	mov    0x8(%ebp),%edx
+  800295:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800298:	b8 18 00 00 00       	mov    $0x18,%eax
+  80029d:	89 df                	mov    %ebx,%edi
+  80029f:	89 de                	mov    %ebx,%esi
+  8002a1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002a3:	85 c0                	test   %eax,%eax
+  8002a5:	7f 08                	jg     8002af <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8002a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002aa:	5b                   	pop    %ebx
+  8002ab:	5e                   	pop    %esi
+  8002ac:	5f                   	pop    %edi
+  8002ad:	5d                   	pop    %ebp
+  8002ae:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002af:	83 ec 0c             	sub    $0xc,%esp
+  8002b2:	50                   	push   %eax
+  8002b3:	6a 18                	push   $0x18
+  8002b5:	68 aa 4c 80 00       	push   $0x804caa
+  8002ba:	6a 23                	push   $0x23
+  8002bc:	68 c7 4c 80 00       	push   $0x804cc7
+  8002c1:	e8 29 39 00 00       	call   803bef <_panic>
+
+008002c6 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  8002c6:	55                   	push   %ebp
+  8002c7:	89 e5                	mov    %esp,%ebp
+  8002c9:	57                   	push   %edi
+  8002ca:	56                   	push   %esi
+  8002cb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8002d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002d7:	b8 19 00 00 00       	mov    $0x19,%eax
+  8002dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002df:	89 f7                	mov    %esi,%edi
+  8002e1:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  8002e3:	5b                   	pop    %ebx
+  8002e4:	5e                   	pop    %esi
+  8002e5:	5f                   	pop    %edi
+  8002e6:	5d                   	pop    %ebp
+  8002e7:	c3                   	ret
+
+008002e8 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8002e8:	55                   	push   %ebp
+  8002e9:	89 e5                	mov    %esp,%ebp
+  8002eb:	57                   	push   %edi
+  8002ec:	56                   	push   %esi
+  8002ed:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8002fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800301:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800304:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800306:	5b                   	pop    %ebx
+  800307:	5e                   	pop    %esi
+  800308:	5f                   	pop    %edi
+  800309:	5d                   	pop    %ebp
+  80030a:	c3                   	ret
+
+0080030b <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  80030b:	55                   	push   %ebp
+  80030c:	89 e5                	mov    %esp,%ebp
+  80030e:	57                   	push   %edi
+  80030f:	56                   	push   %esi
+  800310:	53                   	push   %ebx
+  800311:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800314:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800317:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  80031d:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800320:	8b 55 08             	mov    0x8(%ebp),%edx
+  800323:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800326:	b8 10 00 00 00       	mov    $0x10,%eax
+  80032b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80032e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800331:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800333:	85 c0                	test   %eax,%eax
+  800335:	7f 08                	jg     80033f <sys_page_map_range+0x34>
+}
+  800337:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033a:	5b                   	pop    %ebx
+  80033b:	5e                   	pop    %esi
+  80033c:	5f                   	pop    %edi
+  80033d:	5d                   	pop    %ebp
+  80033e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80033f:	83 ec 0c             	sub    $0xc,%esp
+  800342:	50                   	push   %eax
+  800343:	6a 10                	push   $0x10
+  800345:	68 aa 4c 80 00       	push   $0x804caa
+  80034a:	6a 23                	push   $0x23
+  80034c:	68 c7 4c 80 00       	push   $0x804cc7
+  800351:	e8 99 38 00 00       	call   803bef <_panic>
+
+00800356 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800356:	55                   	push   %ebp
+  800357:	89 e5                	mov    %esp,%ebp
+  800359:	57                   	push   %edi
+  80035a:	56                   	push   %esi
+  80035b:	53                   	push   %ebx
+  80035c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80035f:	be 00 00 00 00       	mov    $0x0,%esi
+  800364:	8b 55 08             	mov    0x8(%ebp),%edx
+  800367:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80036a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80036f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800372:	89 f7                	mov    %esi,%edi
+  800374:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800376:	85 c0                	test   %eax,%eax
+  800378:	7f 08                	jg     800382 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  80037a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80037d:	5b                   	pop    %ebx
+  80037e:	5e                   	pop    %esi
+  80037f:	5f                   	pop    %edi
+  800380:	5d                   	pop    %ebp
+  800381:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800382:	83 ec 0c             	sub    $0xc,%esp
+  800385:	50                   	push   %eax
+  800386:	6a 11                	push   $0x11
+  800388:	68 aa 4c 80 00       	push   $0x804caa
+  80038d:	6a 23                	push   $0x23
+  80038f:	68 c7 4c 80 00       	push   $0x804cc7
+  800394:	e8 56 38 00 00       	call   803bef <_panic>
+
+00800399 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800399:	55                   	push   %ebp
+  80039a:	89 e5                	mov    %esp,%ebp
+  80039c:	57                   	push   %edi
+  80039d:	56                   	push   %esi
+  80039e:	53                   	push   %ebx
+  80039f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8003a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003ad:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8003b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003b5:	89 f7                	mov    %esi,%edi
+  8003b7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003b9:	85 c0                	test   %eax,%eax
+  8003bb:	7f 08                	jg     8003c5 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8003bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c0:	5b                   	pop    %ebx
+  8003c1:	5e                   	pop    %esi
+  8003c2:	5f                   	pop    %edi
+  8003c3:	5d                   	pop    %ebp
+  8003c4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003c5:	83 ec 0c             	sub    $0xc,%esp
+  8003c8:	50                   	push   %eax
+  8003c9:	6a 1b                	push   $0x1b
+  8003cb:	68 aa 4c 80 00       	push   $0x804caa
+  8003d0:	6a 23                	push   $0x23
+  8003d2:	68 c7 4c 80 00       	push   $0x804cc7
+  8003d7:	e8 13 38 00 00       	call   803bef <_panic>
+
+008003dc <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  8003dc:	55                   	push   %ebp
+  8003dd:	89 e5                	mov    %esp,%ebp
+  8003df:	57                   	push   %edi
+  8003e0:	56                   	push   %esi
+  8003e1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003e7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003ec:	89 d1                	mov    %edx,%ecx
+  8003ee:	89 d3                	mov    %edx,%ebx
+  8003f0:	89 d7                	mov    %edx,%edi
+  8003f2:	89 d6                	mov    %edx,%esi
+  8003f4:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8003f6:	5b                   	pop    %ebx
+  8003f7:	5e                   	pop    %esi
+  8003f8:	5f                   	pop    %edi
+  8003f9:	5d                   	pop    %ebp
+  8003fa:	c3                   	ret
+
+008003fb <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003fb:	55                   	push   %ebp
+  8003fc:	89 e5                	mov    %esp,%ebp
+  8003fe:	57                   	push   %edi
+  8003ff:	56                   	push   %esi
+  800400:	53                   	push   %ebx
+  800401:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800404:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800409:	8b 55 08             	mov    0x8(%ebp),%edx
+  80040c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80040f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800414:	89 df                	mov    %ebx,%edi
+  800416:	89 de                	mov    %ebx,%esi
+  800418:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80041a:	85 c0                	test   %eax,%eax
+  80041c:	7f 08                	jg     800426 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80041e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800421:	5b                   	pop    %ebx
+  800422:	5e                   	pop    %esi
+  800423:	5f                   	pop    %edi
+  800424:	5d                   	pop    %ebp
+  800425:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800426:	83 ec 0c             	sub    $0xc,%esp
+  800429:	50                   	push   %eax
+  80042a:	6a 08                	push   $0x8
+  80042c:	68 aa 4c 80 00       	push   $0x804caa
+  800431:	6a 23                	push   $0x23
+  800433:	68 c7 4c 80 00       	push   $0x804cc7
+  800438:	e8 b2 37 00 00       	call   803bef <_panic>
+
+0080043d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80043d:	55                   	push   %ebp
+  80043e:	89 e5                	mov    %esp,%ebp
+  800440:	57                   	push   %edi
+  800441:	56                   	push   %esi
+  800442:	53                   	push   %ebx
+  800443:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800446:	6a 44                	push   $0x44
+  800448:	ff 75 0c             	push   0xc(%ebp)
+  80044b:	e8 7a fc ff ff       	call   8000ca <touch_mem>
+	asm volatile("int %1\n"
+  800450:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800455:	8b 55 08             	mov    0x8(%ebp),%edx
+  800458:	b8 09 00 00 00       	mov    $0x9,%eax
+  80045d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800460:	89 df                	mov    %ebx,%edi
+  800462:	89 de                	mov    %ebx,%esi
+  800464:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800466:	83 c4 08             	add    $0x8,%esp
+  800469:	85 c0                	test   %eax,%eax
+  80046b:	7f 08                	jg     800475 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80046d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800470:	5b                   	pop    %ebx
+  800471:	5e                   	pop    %esi
+  800472:	5f                   	pop    %edi
+  800473:	5d                   	pop    %ebp
+  800474:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800475:	83 ec 0c             	sub    $0xc,%esp
+  800478:	50                   	push   %eax
+  800479:	6a 09                	push   $0x9
+  80047b:	68 aa 4c 80 00       	push   $0x804caa
+  800480:	6a 23                	push   $0x23
+  800482:	68 c7 4c 80 00       	push   $0x804cc7
+  800487:	e8 63 37 00 00       	call   803bef <_panic>
+
+0080048c <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  80048c:	55                   	push   %ebp
+  80048d:	89 e5                	mov    %esp,%ebp
+  80048f:	57                   	push   %edi
+  800490:	56                   	push   %esi
+  800491:	53                   	push   %ebx
+  800492:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800495:	be 00 00 00 00       	mov    $0x0,%esi
+  80049a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80049d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004a0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8004a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004a8:	89 f7                	mov    %esi,%edi
+  8004aa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004ac:	85 c0                	test   %eax,%eax
+  8004ae:	7f 08                	jg     8004b8 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  8004b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b3:	5b                   	pop    %ebx
+  8004b4:	5e                   	pop    %esi
+  8004b5:	5f                   	pop    %edi
+  8004b6:	5d                   	pop    %ebp
+  8004b7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004b8:	83 ec 0c             	sub    $0xc,%esp
+  8004bb:	50                   	push   %eax
+  8004bc:	6a 1a                	push   $0x1a
+  8004be:	68 aa 4c 80 00       	push   $0x804caa
+  8004c3:	6a 23                	push   $0x23
+  8004c5:	68 c7 4c 80 00       	push   $0x804cc7
+  8004ca:	e8 20 37 00 00       	call   803bef <_panic>
+
+008004cf <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8004cf:	55                   	push   %ebp
+  8004d0:	89 e5                	mov    %esp,%ebp
+  8004d2:	57                   	push   %edi
+  8004d3:	56                   	push   %esi
+  8004d4:	53                   	push   %ebx
+  8004d5:	83 ec 0c             	sub    $0xc,%esp
+  8004d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8004db:	89 d8                	mov    %ebx,%eax
+  8004dd:	c1 e0 05             	shl    $0x5,%eax
+  8004e0:	50                   	push   %eax
+  8004e1:	ff 75 0c             	push   0xc(%ebp)
+  8004e4:	e8 e1 fb ff ff       	call   8000ca <touch_mem>
+	asm volatile("int %1\n"
+  8004e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8004ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f1:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004f9:	89 f7                	mov    %esi,%edi
+  8004fb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004fd:	83 c4 08             	add    $0x8,%esp
+  800500:	85 c0                	test   %eax,%eax
+  800502:	7f 08                	jg     80050c <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  800504:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800507:	5b                   	pop    %ebx
+  800508:	5e                   	pop    %esi
+  800509:	5f                   	pop    %edi
+  80050a:	5d                   	pop    %ebp
+  80050b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80050c:	83 ec 0c             	sub    $0xc,%esp
+  80050f:	50                   	push   %eax
+  800510:	6a 13                	push   $0x13
+  800512:	68 aa 4c 80 00       	push   $0x804caa
+  800517:	6a 23                	push   $0x23
+  800519:	68 c7 4c 80 00       	push   $0x804cc7
+  80051e:	e8 cc 36 00 00       	call   803bef <_panic>
+
+00800523 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800523:	55                   	push   %ebp
+  800524:	89 e5                	mov    %esp,%ebp
+  800526:	57                   	push   %edi
+  800527:	56                   	push   %esi
+  800528:	53                   	push   %ebx
+  800529:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80052c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800531:	8b 55 08             	mov    0x8(%ebp),%edx
+  800534:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800537:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80053c:	89 df                	mov    %ebx,%edi
+  80053e:	89 de                	mov    %ebx,%esi
+  800540:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800542:	85 c0                	test   %eax,%eax
+  800544:	7f 08                	jg     80054e <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800546:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800549:	5b                   	pop    %ebx
+  80054a:	5e                   	pop    %esi
+  80054b:	5f                   	pop    %edi
+  80054c:	5d                   	pop    %ebp
+  80054d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80054e:	83 ec 0c             	sub    $0xc,%esp
+  800551:	50                   	push   %eax
+  800552:	6a 0a                	push   $0xa
+  800554:	68 aa 4c 80 00       	push   $0x804caa
+  800559:	6a 23                	push   $0x23
+  80055b:	68 c7 4c 80 00       	push   $0x804cc7
+  800560:	e8 8a 36 00 00       	call   803bef <_panic>
+
+00800565 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800565:	55                   	push   %ebp
+  800566:	89 e5                	mov    %esp,%ebp
+  800568:	57                   	push   %edi
+  800569:	56                   	push   %esi
+  80056a:	53                   	push   %ebx
+  80056b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  80056e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800574:	76 1d                	jbe    800593 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  800576:	8b 55 08             	mov    0x8(%ebp),%edx
+  800579:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80057c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800581:	be 01 00 00 00       	mov    $0x1,%esi
+  800586:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800589:	cd 30                	int    $0x30
+}
+  80058b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80058e:	5b                   	pop    %ebx
+  80058f:	5e                   	pop    %esi
+  800590:	5f                   	pop    %edi
+  800591:	5d                   	pop    %ebp
+  800592:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  800593:	68 00 10 00 00       	push   $0x1000
+  800598:	53                   	push   %ebx
+  800599:	e8 2c fb ff ff       	call   8000ca <touch_mem>
+  80059e:	83 c4 08             	add    $0x8,%esp
+  8005a1:	eb d3                	jmp    800576 <sys_ipc_send+0x11>
+
+008005a3 <sys_ipc_send_pages>:
+{
+  8005a3:	55                   	push   %ebp
+  8005a4:	89 e5                	mov    %esp,%ebp
+  8005a6:	57                   	push   %edi
+  8005a7:	56                   	push   %esi
+  8005a8:	53                   	push   %ebx
+  8005a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005ac:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8005af:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8005b5:	76 18                	jbe    8005cf <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8005b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005bd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8005c2:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8005c5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8005c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005ca:	5b                   	pop    %ebx
+  8005cb:	5e                   	pop    %esi
+  8005cc:	5f                   	pop    %edi
+  8005cd:	5d                   	pop    %ebp
+  8005ce:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8005cf:	89 f0                	mov    %esi,%eax
+  8005d1:	c1 e0 0c             	shl    $0xc,%eax
+  8005d4:	50                   	push   %eax
+  8005d5:	53                   	push   %ebx
+  8005d6:	e8 ef fa ff ff       	call   8000ca <touch_mem>
+  8005db:	83 c4 08             	add    $0x8,%esp
+  8005de:	eb d7                	jmp    8005b7 <sys_ipc_send_pages+0x14>
+
+008005e0 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8005e0:	55                   	push   %ebp
+  8005e1:	89 e5                	mov    %esp,%ebp
+  8005e3:	57                   	push   %edi
+  8005e4:	56                   	push   %esi
+  8005e5:	53                   	push   %ebx
+  8005e6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8005e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005f4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8005f9:	89 df                	mov    %ebx,%edi
+  8005fb:	89 de                	mov    %ebx,%esi
+  8005fd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8005ff:	85 c0                	test   %eax,%eax
+  800601:	7f 08                	jg     80060b <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  800603:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800606:	5b                   	pop    %ebx
+  800607:	5e                   	pop    %esi
+  800608:	5f                   	pop    %edi
+  800609:	5d                   	pop    %ebp
+  80060a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80060b:	83 ec 0c             	sub    $0xc,%esp
+  80060e:	50                   	push   %eax
+  80060f:	6a 0d                	push   $0xd
+  800611:	68 aa 4c 80 00       	push   $0x804caa
+  800616:	6a 23                	push   $0x23
+  800618:	68 c7 4c 80 00       	push   $0x804cc7
+  80061d:	e8 cd 35 00 00       	call   803bef <_panic>
+
+00800622 <sys_ipc_recv>:
+{
+  800622:	55                   	push   %ebp
+  800623:	89 e5                	mov    %esp,%ebp
+  800625:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  800628:	6a 01                	push   $0x1
+  80062a:	ff 75 08             	push   0x8(%ebp)
+  80062d:	e8 ae ff ff ff       	call   8005e0 <sys_ipc_recv_pages>
+}
+  800632:	c9                   	leave
+  800633:	c3                   	ret
+
+00800634 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  800634:	55                   	push   %ebp
+  800635:	89 e5                	mov    %esp,%ebp
+  800637:	57                   	push   %edi
+  800638:	56                   	push   %esi
+  800639:	53                   	push   %ebx
+  80063a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80063d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800640:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  800643:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800649:	77 04                	ja     80064f <sys_ipc_call+0x1b>
+  80064b:	85 f6                	test   %esi,%esi
+  80064d:	75 15                	jne    800664 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  80064f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800652:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800655:	b8 14 00 00 00       	mov    $0x14,%eax
+  80065a:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80065c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80065f:	5b                   	pop    %ebx
+  800660:	5e                   	pop    %esi
+  800661:	5f                   	pop    %edi
+  800662:	5d                   	pop    %ebp
+  800663:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  800664:	89 f8                	mov    %edi,%eax
+  800666:	c1 e0 0c             	shl    $0xc,%eax
+  800669:	50                   	push   %eax
+  80066a:	53                   	push   %ebx
+  80066b:	e8 5a fa ff ff       	call   8000ca <touch_mem>
+  800670:	83 c4 08             	add    $0x8,%esp
+  800673:	eb da                	jmp    80064f <sys_ipc_call+0x1b>
+
+00800675 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  800675:	55                   	push   %ebp
+  800676:	89 e5                	mov    %esp,%ebp
+  800678:	57                   	push   %edi
+  800679:	56                   	push   %esi
+  80067a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80067b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80067e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800681:	b8 15 00 00 00       	mov    $0x15,%eax
+  800686:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800689:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80068c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80068f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  800691:	5b                   	pop    %ebx
+  800692:	5e                   	pop    %esi
+  800693:	5f                   	pop    %edi
+  800694:	5d                   	pop    %ebp
+  800695:	c3                   	ret
+
+00800696 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  800696:	55                   	push   %ebp
+  800697:	89 e5                	mov    %esp,%ebp
+  800699:	57                   	push   %edi
+  80069a:	56                   	push   %esi
+  80069b:	53                   	push   %ebx
+  80069c:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  80069f:	6a 04                	push   $0x4
+  8006a1:	ff 75 08             	push   0x8(%ebp)
+  8006a4:	e8 21 fa ff ff       	call   8000ca <touch_mem>
+	asm volatile("int %1\n"
+  8006a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8006ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006b1:	b8 16 00 00 00       	mov    $0x16,%eax
+  8006b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8006bc:	89 f7                	mov    %esi,%edi
+  8006be:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8006c0:	83 c4 08             	add    $0x8,%esp
+  8006c3:	85 c0                	test   %eax,%eax
+  8006c5:	7f 08                	jg     8006cf <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8006c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006ca:	5b                   	pop    %ebx
+  8006cb:	5e                   	pop    %esi
+  8006cc:	5f                   	pop    %edi
+  8006cd:	5d                   	pop    %ebp
+  8006ce:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006cf:	83 ec 0c             	sub    $0xc,%esp
+  8006d2:	50                   	push   %eax
+  8006d3:	6a 16                	push   $0x16
+  8006d5:	68 aa 4c 80 00       	push   $0x804caa
+  8006da:	6a 23                	push   $0x23
+  8006dc:	68 c7 4c 80 00       	push   $0x804cc7
+  8006e1:	e8 09 35 00 00       	call   803bef <_panic>
+
+008006e6 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8006e6:	55                   	push   %ebp
+  8006e7:	89 e5                	mov    %esp,%ebp
+  8006e9:	57                   	push   %edi
+  8006ea:	56                   	push   %esi
+  8006eb:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8006ec:	6a 04                	push   $0x4
+  8006ee:	ff 75 08             	push   0x8(%ebp)
+  8006f1:	e8 d4 f9 ff ff       	call   8000ca <touch_mem>
+	asm volatile("int %1\n"
+  8006f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006fe:	b8 17 00 00 00       	mov    $0x17,%eax
+  800703:	8b 55 08             	mov    0x8(%ebp),%edx
+  800706:	89 df                	mov    %ebx,%edi
+  800708:	89 de                	mov    %ebx,%esi
+  80070a:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80070c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80070f:	5b                   	pop    %ebx
+  800710:	5e                   	pop    %esi
+  800711:	5f                   	pop    %edi
+  800712:	5d                   	pop    %ebp
+  800713:	c3                   	ret
+
+00800714 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  800714:	55                   	push   %ebp
+  800715:	89 e5                	mov    %esp,%ebp
+  800717:	57                   	push   %edi
+  800718:	56                   	push   %esi
+  800719:	53                   	push   %ebx
+  80071a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80071d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800722:	8b 55 08             	mov    0x8(%ebp),%edx
+  800725:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80072a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80072f:	89 df                	mov    %ebx,%edi
+  800731:	89 de                	mov    %ebx,%esi
+  800733:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800735:	85 c0                	test   %eax,%eax
+  800737:	7f 08                	jg     800741 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  800739:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80073c:	5b                   	pop    %ebx
+  80073d:	5e                   	pop    %esi
+  80073e:	5f                   	pop    %edi
+  80073f:	5d                   	pop    %ebp
+  800740:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800741:	83 ec 0c             	sub    $0xc,%esp
+  800744:	50                   	push   %eax
+  800745:	6a 0e                	push   $0xe
+  800747:	68 aa 4c 80 00       	push   $0x804caa
+  80074c:	6a 23                	push   $0x23
+  80074e:	68 c7 4c 80 00       	push   $0x804cc7
+  800753:	e8 97 34 00 00       	call   803bef <_panic>
+
+00800758 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800758:	55                   	push   %ebp
+  800759:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80075b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80075e:	05 00 00 00 30       	add    $0x30000000,%eax
+  800763:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800766:	5d                   	pop    %ebp
+  800767:	c3                   	ret
+
+00800768 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800768:	55                   	push   %ebp
+  800769:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80076b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80076e:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800773:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800778:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80077d:	5d                   	pop    %ebp
+  80077e:	c3                   	ret
+
+0080077f <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80077f:	55                   	push   %ebp
+  800780:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  800782:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  800787:	a8 01                	test   $0x1,%al
+  800789:	74 3c                	je     8007c7 <fd_alloc+0x48>
+  80078b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800790:	89 c2                	mov    %eax,%edx
+  800792:	c1 ea 0c             	shr    $0xc,%edx
+  800795:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80079c:	89 c1                	mov    %eax,%ecx
+  80079e:	05 00 10 00 00       	add    $0x1000,%eax
+  8007a3:	f6 c2 01             	test   $0x1,%dl
+  8007a6:	74 13                	je     8007bb <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8007a8:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8007ad:	75 e1                	jne    800790 <fd_alloc+0x11>
+  8007af:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8007b4:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8007b9:	eb 05                	jmp    8007c0 <fd_alloc+0x41>
+			return 0;
+  8007bb:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8007c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007c3:	89 0a                	mov    %ecx,(%edx)
+}
+  8007c5:	5d                   	pop    %ebp
+  8007c6:	c3                   	ret
+  8007c7:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8007cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d1:	eb ed                	jmp    8007c0 <fd_alloc+0x41>
+
+008007d3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8007d3:	55                   	push   %ebp
+  8007d4:	89 e5                	mov    %esp,%ebp
+  8007d6:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8007d9:	83 f8 1f             	cmp    $0x1f,%eax
+  8007dc:	77 30                	ja     80080e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8007de:	c1 e0 0c             	shl    $0xc,%eax
+  8007e1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8007e6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8007ec:	f6 c2 01             	test   $0x1,%dl
+  8007ef:	74 24                	je     800815 <fd_lookup+0x42>
+  8007f1:	89 c2                	mov    %eax,%edx
+  8007f3:	c1 ea 0c             	shr    $0xc,%edx
+  8007f6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8007fd:	f6 c2 01             	test   $0x1,%dl
+  800800:	74 1a                	je     80081c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800802:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800805:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800807:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80080c:	5d                   	pop    %ebp
+  80080d:	c3                   	ret
+		return -E_INVAL;
+  80080e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800813:	eb f7                	jmp    80080c <fd_lookup+0x39>
+		return -E_INVAL;
+  800815:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80081a:	eb f0                	jmp    80080c <fd_lookup+0x39>
+  80081c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800821:	eb e9                	jmp    80080c <fd_lookup+0x39>
+
+00800823 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800823:	55                   	push   %ebp
+  800824:	89 e5                	mov    %esp,%ebp
+  800826:	53                   	push   %ebx
+  800827:	83 ec 04             	sub    $0x4,%esp
+  80082a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80082d:	b8 54 4d 80 00       	mov    $0x804d54,%eax
+  800832:	8b 18                	mov    (%eax),%ebx
+  800834:	85 db                	test   %ebx,%ebx
+  800836:	74 0e                	je     800846 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  800838:	83 c0 04             	add    $0x4,%eax
+  80083b:	39 13                	cmp    %edx,(%ebx)
+  80083d:	75 f3                	jne    800832 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  80083f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800844:	eb 1f                	jmp    800865 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800846:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80084b:	8b 40 48             	mov    0x48(%eax),%eax
+  80084e:	83 ec 04             	sub    $0x4,%esp
+  800851:	52                   	push   %edx
+  800852:	50                   	push   %eax
+  800853:	68 d8 4c 80 00       	push   $0x804cd8
+  800858:	e8 6d 34 00 00       	call   803cca <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80085d:	83 c4 10             	add    $0x10,%esp
+  800860:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800865:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800868:	89 1a                	mov    %ebx,(%edx)
+}
+  80086a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80086d:	c9                   	leave
+  80086e:	c3                   	ret
+
+0080086f <fd_close>:
+{
+  80086f:	55                   	push   %ebp
+  800870:	89 e5                	mov    %esp,%ebp
+  800872:	57                   	push   %edi
+  800873:	56                   	push   %esi
+  800874:	53                   	push   %ebx
+  800875:	83 ec 24             	sub    $0x24,%esp
+  800878:	8b 75 08             	mov    0x8(%ebp),%esi
+  80087b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80087e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800881:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800882:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800888:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80088b:	50                   	push   %eax
+  80088c:	e8 42 ff ff ff       	call   8007d3 <fd_lookup>
+  800891:	89 c3                	mov    %eax,%ebx
+  800893:	83 c4 10             	add    $0x10,%esp
+  800896:	85 c0                	test   %eax,%eax
+  800898:	78 05                	js     80089f <fd_close+0x30>
+	    || fd != fd2)
+  80089a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80089d:	74 16                	je     8008b5 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80089f:	89 f8                	mov    %edi,%eax
+  8008a1:	84 c0                	test   %al,%al
+  8008a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a8:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8008ab:	89 d8                	mov    %ebx,%eax
+  8008ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008b0:	5b                   	pop    %ebx
+  8008b1:	5e                   	pop    %esi
+  8008b2:	5f                   	pop    %edi
+  8008b3:	5d                   	pop    %ebp
+  8008b4:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8008b5:	83 ec 08             	sub    $0x8,%esp
+  8008b8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8008bb:	50                   	push   %eax
+  8008bc:	ff 36                	push   (%esi)
+  8008be:	e8 60 ff ff ff       	call   800823 <dev_lookup>
+  8008c3:	89 c3                	mov    %eax,%ebx
+  8008c5:	83 c4 10             	add    $0x10,%esp
+  8008c8:	85 c0                	test   %eax,%eax
+  8008ca:	78 1a                	js     8008e6 <fd_close+0x77>
+		if (dev->dev_close)
+  8008cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008cf:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8008d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8008d7:	85 c0                	test   %eax,%eax
+  8008d9:	74 0b                	je     8008e6 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8008db:	83 ec 0c             	sub    $0xc,%esp
+  8008de:	56                   	push   %esi
+  8008df:	ff d0                	call   *%eax
+  8008e1:	89 c3                	mov    %eax,%ebx
+  8008e3:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8008e6:	83 ec 08             	sub    $0x8,%esp
+  8008e9:	56                   	push   %esi
+  8008ea:	6a 00                	push   $0x0
+  8008ec:	e8 51 f9 ff ff       	call   800242 <sys_page_unmap>
+	return r;
+  8008f1:	83 c4 10             	add    $0x10,%esp
+  8008f4:	eb b5                	jmp    8008ab <fd_close+0x3c>
+
+008008f6 <close>:
+
+int
+close(int fdnum)
+{
+  8008f6:	55                   	push   %ebp
+  8008f7:	89 e5                	mov    %esp,%ebp
+  8008f9:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8008fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008ff:	50                   	push   %eax
+  800900:	ff 75 08             	push   0x8(%ebp)
+  800903:	e8 cb fe ff ff       	call   8007d3 <fd_lookup>
+  800908:	83 c4 10             	add    $0x10,%esp
+  80090b:	85 c0                	test   %eax,%eax
+  80090d:	79 02                	jns    800911 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80090f:	c9                   	leave
+  800910:	c3                   	ret
+		return fd_close(fd, 1);
+  800911:	83 ec 08             	sub    $0x8,%esp
+  800914:	6a 01                	push   $0x1
+  800916:	ff 75 f4             	push   -0xc(%ebp)
+  800919:	e8 51 ff ff ff       	call   80086f <fd_close>
+  80091e:	83 c4 10             	add    $0x10,%esp
+  800921:	eb ec                	jmp    80090f <close+0x19>
+
+00800923 <close_all>:
+
+void
+close_all(void)
+{
+  800923:	55                   	push   %ebp
+  800924:	89 e5                	mov    %esp,%ebp
+  800926:	53                   	push   %ebx
+  800927:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80092a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80092f:	83 ec 0c             	sub    $0xc,%esp
+  800932:	53                   	push   %ebx
+  800933:	e8 be ff ff ff       	call   8008f6 <close>
+	for (i = 0; i < MAXFD; i++)
+  800938:	83 c3 01             	add    $0x1,%ebx
+  80093b:	83 c4 10             	add    $0x10,%esp
+  80093e:	83 fb 20             	cmp    $0x20,%ebx
+  800941:	75 ec                	jne    80092f <close_all+0xc>
+}
+  800943:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800946:	c9                   	leave
+  800947:	c3                   	ret
+
+00800948 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800948:	55                   	push   %ebp
+  800949:	89 e5                	mov    %esp,%ebp
+  80094b:	57                   	push   %edi
+  80094c:	56                   	push   %esi
+  80094d:	53                   	push   %ebx
+  80094e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800951:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800954:	50                   	push   %eax
+  800955:	ff 75 08             	push   0x8(%ebp)
+  800958:	e8 76 fe ff ff       	call   8007d3 <fd_lookup>
+  80095d:	89 c3                	mov    %eax,%ebx
+  80095f:	83 c4 10             	add    $0x10,%esp
+  800962:	85 c0                	test   %eax,%eax
+  800964:	78 7f                	js     8009e5 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800966:	83 ec 0c             	sub    $0xc,%esp
+  800969:	ff 75 0c             	push   0xc(%ebp)
+  80096c:	e8 85 ff ff ff       	call   8008f6 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800971:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800974:	c1 e6 0c             	shl    $0xc,%esi
+  800977:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80097d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800980:	89 3c 24             	mov    %edi,(%esp)
+  800983:	e8 e0 fd ff ff       	call   800768 <fd2data>
+  800988:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80098a:	89 34 24             	mov    %esi,(%esp)
+  80098d:	e8 d6 fd ff ff       	call   800768 <fd2data>
+  800992:	83 c4 10             	add    $0x10,%esp
+  800995:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800998:	89 d8                	mov    %ebx,%eax
+  80099a:	c1 e8 16             	shr    $0x16,%eax
+  80099d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8009a4:	a8 01                	test   $0x1,%al
+  8009a6:	74 11                	je     8009b9 <dup+0x71>
+  8009a8:	89 d8                	mov    %ebx,%eax
+  8009aa:	c1 e8 0c             	shr    $0xc,%eax
+  8009ad:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8009b4:	f6 c2 01             	test   $0x1,%dl
+  8009b7:	75 36                	jne    8009ef <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8009b9:	89 f8                	mov    %edi,%eax
+  8009bb:	c1 e8 0c             	shr    $0xc,%eax
+  8009be:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8009c5:	83 ec 0c             	sub    $0xc,%esp
+  8009c8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8009cd:	50                   	push   %eax
+  8009ce:	56                   	push   %esi
+  8009cf:	6a 00                	push   $0x0
+  8009d1:	57                   	push   %edi
+  8009d2:	6a 00                	push   $0x0
+  8009d4:	e8 27 f8 ff ff       	call   800200 <sys_page_map>
+  8009d9:	89 c3                	mov    %eax,%ebx
+  8009db:	83 c4 20             	add    $0x20,%esp
+  8009de:	85 c0                	test   %eax,%eax
+  8009e0:	78 33                	js     800a15 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8009e2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8009e5:	89 d8                	mov    %ebx,%eax
+  8009e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009ea:	5b                   	pop    %ebx
+  8009eb:	5e                   	pop    %esi
+  8009ec:	5f                   	pop    %edi
+  8009ed:	5d                   	pop    %ebp
+  8009ee:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8009ef:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8009f6:	83 ec 0c             	sub    $0xc,%esp
+  8009f9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8009fe:	50                   	push   %eax
+  8009ff:	ff 75 d4             	push   -0x2c(%ebp)
+  800a02:	6a 00                	push   $0x0
+  800a04:	53                   	push   %ebx
+  800a05:	6a 00                	push   $0x0
+  800a07:	e8 f4 f7 ff ff       	call   800200 <sys_page_map>
+  800a0c:	89 c3                	mov    %eax,%ebx
+  800a0e:	83 c4 20             	add    $0x20,%esp
+  800a11:	85 c0                	test   %eax,%eax
+  800a13:	79 a4                	jns    8009b9 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800a15:	83 ec 08             	sub    $0x8,%esp
+  800a18:	56                   	push   %esi
+  800a19:	6a 00                	push   $0x0
+  800a1b:	e8 22 f8 ff ff       	call   800242 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800a20:	83 c4 08             	add    $0x8,%esp
+  800a23:	ff 75 d4             	push   -0x2c(%ebp)
+  800a26:	6a 00                	push   $0x0
+  800a28:	e8 15 f8 ff ff       	call   800242 <sys_page_unmap>
+	return r;
+  800a2d:	83 c4 10             	add    $0x10,%esp
+  800a30:	eb b3                	jmp    8009e5 <dup+0x9d>
+
+00800a32 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800a32:	55                   	push   %ebp
+  800a33:	89 e5                	mov    %esp,%ebp
+  800a35:	56                   	push   %esi
+  800a36:	53                   	push   %ebx
+  800a37:	83 ec 18             	sub    $0x18,%esp
+  800a3a:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a3d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a40:	50                   	push   %eax
+  800a41:	56                   	push   %esi
+  800a42:	e8 8c fd ff ff       	call   8007d3 <fd_lookup>
+  800a47:	83 c4 10             	add    $0x10,%esp
+  800a4a:	85 c0                	test   %eax,%eax
+  800a4c:	78 3c                	js     800a8a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a4e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a51:	83 ec 08             	sub    $0x8,%esp
+  800a54:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a57:	50                   	push   %eax
+  800a58:	ff 33                	push   (%ebx)
+  800a5a:	e8 c4 fd ff ff       	call   800823 <dev_lookup>
+  800a5f:	83 c4 10             	add    $0x10,%esp
+  800a62:	85 c0                	test   %eax,%eax
+  800a64:	78 24                	js     800a8a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a66:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a69:	83 e0 03             	and    $0x3,%eax
+  800a6c:	83 f8 01             	cmp    $0x1,%eax
+  800a6f:	74 20                	je     800a91 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800a71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a74:	8b 40 08             	mov    0x8(%eax),%eax
+  800a77:	85 c0                	test   %eax,%eax
+  800a79:	74 37                	je     800ab2 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800a7b:	83 ec 04             	sub    $0x4,%esp
+  800a7e:	ff 75 10             	push   0x10(%ebp)
+  800a81:	ff 75 0c             	push   0xc(%ebp)
+  800a84:	53                   	push   %ebx
+  800a85:	ff d0                	call   *%eax
+  800a87:	83 c4 10             	add    $0x10,%esp
+}
+  800a8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a8d:	5b                   	pop    %ebx
+  800a8e:	5e                   	pop    %esi
+  800a8f:	5d                   	pop    %ebp
+  800a90:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a91:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  800a96:	8b 40 48             	mov    0x48(%eax),%eax
+  800a99:	83 ec 04             	sub    $0x4,%esp
+  800a9c:	56                   	push   %esi
+  800a9d:	50                   	push   %eax
+  800a9e:	68 19 4d 80 00       	push   $0x804d19
+  800aa3:	e8 22 32 00 00       	call   803cca <cprintf>
+		return -E_INVAL;
+  800aa8:	83 c4 10             	add    $0x10,%esp
+  800aab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ab0:	eb d8                	jmp    800a8a <read+0x58>
+		return -E_NOT_SUPP;
+  800ab2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ab7:	eb d1                	jmp    800a8a <read+0x58>
+
+00800ab9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800ab9:	55                   	push   %ebp
+  800aba:	89 e5                	mov    %esp,%ebp
+  800abc:	57                   	push   %edi
+  800abd:	56                   	push   %esi
+  800abe:	53                   	push   %ebx
+  800abf:	83 ec 0c             	sub    $0xc,%esp
+  800ac2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ac5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800ac8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800acd:	eb 02                	jmp    800ad1 <readn+0x18>
+  800acf:	01 c3                	add    %eax,%ebx
+  800ad1:	39 f3                	cmp    %esi,%ebx
+  800ad3:	73 21                	jae    800af6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800ad5:	83 ec 04             	sub    $0x4,%esp
+  800ad8:	89 f0                	mov    %esi,%eax
+  800ada:	29 d8                	sub    %ebx,%eax
+  800adc:	50                   	push   %eax
+  800add:	89 d8                	mov    %ebx,%eax
+  800adf:	03 45 0c             	add    0xc(%ebp),%eax
+  800ae2:	50                   	push   %eax
+  800ae3:	57                   	push   %edi
+  800ae4:	e8 49 ff ff ff       	call   800a32 <read>
+		if (m < 0)
+  800ae9:	83 c4 10             	add    $0x10,%esp
+  800aec:	85 c0                	test   %eax,%eax
+  800aee:	78 04                	js     800af4 <readn+0x3b>
+			return m;
+		if (m == 0)
+  800af0:	75 dd                	jne    800acf <readn+0x16>
+  800af2:	eb 02                	jmp    800af6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800af4:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800af6:	89 d8                	mov    %ebx,%eax
+  800af8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800afb:	5b                   	pop    %ebx
+  800afc:	5e                   	pop    %esi
+  800afd:	5f                   	pop    %edi
+  800afe:	5d                   	pop    %ebp
+  800aff:	c3                   	ret
+
+00800b00 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800b00:	55                   	push   %ebp
+  800b01:	89 e5                	mov    %esp,%ebp
+  800b03:	56                   	push   %esi
+  800b04:	53                   	push   %ebx
+  800b05:	83 ec 18             	sub    $0x18,%esp
+  800b08:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b0b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b0e:	50                   	push   %eax
+  800b0f:	53                   	push   %ebx
+  800b10:	e8 be fc ff ff       	call   8007d3 <fd_lookup>
+  800b15:	83 c4 10             	add    $0x10,%esp
+  800b18:	85 c0                	test   %eax,%eax
+  800b1a:	78 37                	js     800b53 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b1c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b1f:	83 ec 08             	sub    $0x8,%esp
+  800b22:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b25:	50                   	push   %eax
+  800b26:	ff 36                	push   (%esi)
+  800b28:	e8 f6 fc ff ff       	call   800823 <dev_lookup>
+  800b2d:	83 c4 10             	add    $0x10,%esp
+  800b30:	85 c0                	test   %eax,%eax
+  800b32:	78 1f                	js     800b53 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b34:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b38:	74 20                	je     800b5a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800b3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b3d:	8b 40 0c             	mov    0xc(%eax),%eax
+  800b40:	85 c0                	test   %eax,%eax
+  800b42:	74 37                	je     800b7b <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800b44:	83 ec 04             	sub    $0x4,%esp
+  800b47:	ff 75 10             	push   0x10(%ebp)
+  800b4a:	ff 75 0c             	push   0xc(%ebp)
+  800b4d:	56                   	push   %esi
+  800b4e:	ff d0                	call   *%eax
+  800b50:	83 c4 10             	add    $0x10,%esp
+}
+  800b53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b56:	5b                   	pop    %ebx
+  800b57:	5e                   	pop    %esi
+  800b58:	5d                   	pop    %ebp
+  800b59:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b5a:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  800b5f:	8b 40 48             	mov    0x48(%eax),%eax
+  800b62:	83 ec 04             	sub    $0x4,%esp
+  800b65:	53                   	push   %ebx
+  800b66:	50                   	push   %eax
+  800b67:	68 35 4d 80 00       	push   $0x804d35
+  800b6c:	e8 59 31 00 00       	call   803cca <cprintf>
+		return -E_INVAL;
+  800b71:	83 c4 10             	add    $0x10,%esp
+  800b74:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b79:	eb d8                	jmp    800b53 <write+0x53>
+		return -E_NOT_SUPP;
+  800b7b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b80:	eb d1                	jmp    800b53 <write+0x53>
+
+00800b82 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b88:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b8b:	50                   	push   %eax
+  800b8c:	ff 75 08             	push   0x8(%ebp)
+  800b8f:	e8 3f fc ff ff       	call   8007d3 <fd_lookup>
+  800b94:	83 c4 10             	add    $0x10,%esp
+  800b97:	85 c0                	test   %eax,%eax
+  800b99:	78 0e                	js     800ba9 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b9b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ba1:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ba9:	c9                   	leave
+  800baa:	c3                   	ret
+
+00800bab <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800bab:	55                   	push   %ebp
+  800bac:	89 e5                	mov    %esp,%ebp
+  800bae:	56                   	push   %esi
+  800baf:	53                   	push   %ebx
+  800bb0:	83 ec 18             	sub    $0x18,%esp
+  800bb3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800bb6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800bb9:	50                   	push   %eax
+  800bba:	53                   	push   %ebx
+  800bbb:	e8 13 fc ff ff       	call   8007d3 <fd_lookup>
+  800bc0:	83 c4 10             	add    $0x10,%esp
+  800bc3:	85 c0                	test   %eax,%eax
+  800bc5:	78 34                	js     800bfb <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800bc7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800bca:	83 ec 08             	sub    $0x8,%esp
+  800bcd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bd0:	50                   	push   %eax
+  800bd1:	ff 36                	push   (%esi)
+  800bd3:	e8 4b fc ff ff       	call   800823 <dev_lookup>
+  800bd8:	83 c4 10             	add    $0x10,%esp
+  800bdb:	85 c0                	test   %eax,%eax
+  800bdd:	78 1c                	js     800bfb <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bdf:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800be3:	74 1d                	je     800c02 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800be5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800be8:	8b 40 18             	mov    0x18(%eax),%eax
+  800beb:	85 c0                	test   %eax,%eax
+  800bed:	74 34                	je     800c23 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800bef:	83 ec 08             	sub    $0x8,%esp
+  800bf2:	ff 75 0c             	push   0xc(%ebp)
+  800bf5:	56                   	push   %esi
+  800bf6:	ff d0                	call   *%eax
+  800bf8:	83 c4 10             	add    $0x10,%esp
+}
+  800bfb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bfe:	5b                   	pop    %ebx
+  800bff:	5e                   	pop    %esi
+  800c00:	5d                   	pop    %ebp
+  800c01:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800c02:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  800c07:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800c0a:	83 ec 04             	sub    $0x4,%esp
+  800c0d:	53                   	push   %ebx
+  800c0e:	50                   	push   %eax
+  800c0f:	68 f8 4c 80 00       	push   $0x804cf8
+  800c14:	e8 b1 30 00 00       	call   803cca <cprintf>
+		return -E_INVAL;
+  800c19:	83 c4 10             	add    $0x10,%esp
+  800c1c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c21:	eb d8                	jmp    800bfb <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800c23:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c28:	eb d1                	jmp    800bfb <ftruncate+0x50>
+
+00800c2a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800c2a:	55                   	push   %ebp
+  800c2b:	89 e5                	mov    %esp,%ebp
+  800c2d:	56                   	push   %esi
+  800c2e:	53                   	push   %ebx
+  800c2f:	83 ec 18             	sub    $0x18,%esp
+  800c32:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c35:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c38:	50                   	push   %eax
+  800c39:	ff 75 08             	push   0x8(%ebp)
+  800c3c:	e8 92 fb ff ff       	call   8007d3 <fd_lookup>
+  800c41:	83 c4 10             	add    $0x10,%esp
+  800c44:	85 c0                	test   %eax,%eax
+  800c46:	78 49                	js     800c91 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c48:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c4b:	83 ec 08             	sub    $0x8,%esp
+  800c4e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c51:	50                   	push   %eax
+  800c52:	ff 36                	push   (%esi)
+  800c54:	e8 ca fb ff ff       	call   800823 <dev_lookup>
+  800c59:	83 c4 10             	add    $0x10,%esp
+  800c5c:	85 c0                	test   %eax,%eax
+  800c5e:	78 31                	js     800c91 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c63:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c67:	74 2f                	je     800c98 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c69:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c6c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c73:	00 00 00 
+	stat->st_isdir = 0;
+  800c76:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c7d:	00 00 00 
+	stat->st_dev = dev;
+  800c80:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c86:	83 ec 08             	sub    $0x8,%esp
+  800c89:	53                   	push   %ebx
+  800c8a:	56                   	push   %esi
+  800c8b:	ff 50 14             	call   *0x14(%eax)
+  800c8e:	83 c4 10             	add    $0x10,%esp
+}
+  800c91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c94:	5b                   	pop    %ebx
+  800c95:	5e                   	pop    %esi
+  800c96:	5d                   	pop    %ebp
+  800c97:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c98:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c9d:	eb f2                	jmp    800c91 <fstat+0x67>
+
+00800c9f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c9f:	55                   	push   %ebp
+  800ca0:	89 e5                	mov    %esp,%ebp
+  800ca2:	56                   	push   %esi
+  800ca3:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800ca4:	83 ec 08             	sub    $0x8,%esp
+  800ca7:	6a 00                	push   $0x0
+  800ca9:	ff 75 08             	push   0x8(%ebp)
+  800cac:	e8 bc 02 00 00       	call   800f6d <open>
+  800cb1:	89 c3                	mov    %eax,%ebx
+  800cb3:	83 c4 10             	add    $0x10,%esp
+  800cb6:	85 c0                	test   %eax,%eax
+  800cb8:	78 1b                	js     800cd5 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800cba:	83 ec 08             	sub    $0x8,%esp
+  800cbd:	ff 75 0c             	push   0xc(%ebp)
+  800cc0:	50                   	push   %eax
+  800cc1:	e8 64 ff ff ff       	call   800c2a <fstat>
+  800cc6:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800cc8:	89 1c 24             	mov    %ebx,(%esp)
+  800ccb:	e8 26 fc ff ff       	call   8008f6 <close>
+	return r;
+  800cd0:	83 c4 10             	add    $0x10,%esp
+  800cd3:	89 f3                	mov    %esi,%ebx
+}
+  800cd5:	89 d8                	mov    %ebx,%eax
+  800cd7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cda:	5b                   	pop    %ebx
+  800cdb:	5e                   	pop    %esi
+  800cdc:	5d                   	pop    %ebp
+  800cdd:	c3                   	ret
+
+00800cde <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  800cde:	55                   	push   %ebp
+  800cdf:	89 e5                	mov    %esp,%ebp
+  800ce1:	57                   	push   %edi
+  800ce2:	56                   	push   %esi
+  800ce3:	53                   	push   %ebx
+  800ce4:	83 ec 0c             	sub    $0xc,%esp
+  800ce7:	89 c7                	mov    %eax,%edi
+  800ce9:	89 d3                	mov    %edx,%ebx
+  800ceb:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800ced:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800cf4:	74 2d                	je     800d23 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cf6:	6a 07                	push   $0x7
+  800cf8:	68 00 f0 80 00       	push   $0x80f000
+  800cfd:	57                   	push   %edi
+  800cfe:	ff 35 00 70 80 00    	push   0x807000
+  800d04:	e8 10 3c 00 00       	call   804919 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  800d09:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800d10:	6a 00                	push   $0x0
+  800d12:	56                   	push   %esi
+  800d13:	53                   	push   %ebx
+  800d14:	6a 00                	push   $0x0
+  800d16:	e8 b0 3a 00 00       	call   8047cb <ipc_recv_pages>
+}
+  800d1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1e:	5b                   	pop    %ebx
+  800d1f:	5e                   	pop    %esi
+  800d20:	5f                   	pop    %edi
+  800d21:	5d                   	pop    %ebp
+  800d22:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800d23:	83 ec 0c             	sub    $0xc,%esp
+  800d26:	6a 01                	push   $0x1
+  800d28:	e8 e1 3c 00 00       	call   804a0e <ipc_find_env>
+  800d2d:	a3 00 70 80 00       	mov    %eax,0x807000
+  800d32:	83 c4 10             	add    $0x10,%esp
+  800d35:	eb bf                	jmp    800cf6 <fsipc_pages+0x18>
+
+00800d37 <fsipc>:
+{
+  800d37:	55                   	push   %ebp
+  800d38:	89 e5                	mov    %esp,%ebp
+  800d3a:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  800d3d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d42:	e8 97 ff ff ff       	call   800cde <fsipc_pages>
+}
+  800d47:	c9                   	leave
+  800d48:	c3                   	ret
+
+00800d49 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d49:	55                   	push   %ebp
+  800d4a:	89 e5                	mov    %esp,%ebp
+  800d4c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d52:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d55:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  800d5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d5d:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800d62:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d67:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d6c:	e8 c6 ff ff ff       	call   800d37 <fsipc>
+}
+  800d71:	c9                   	leave
+  800d72:	c3                   	ret
+
+00800d73 <devfile_flush>:
+{
+  800d73:	55                   	push   %ebp
+  800d74:	89 e5                	mov    %esp,%ebp
+  800d76:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d79:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d7c:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d7f:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800d84:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d89:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d8e:	e8 a4 ff ff ff       	call   800d37 <fsipc>
+}
+  800d93:	c9                   	leave
+  800d94:	c3                   	ret
+
+00800d95 <devfile_stat>:
+{
+  800d95:	55                   	push   %ebp
+  800d96:	89 e5                	mov    %esp,%ebp
+  800d98:	53                   	push   %ebx
+  800d99:	83 ec 04             	sub    $0x4,%esp
+  800d9c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800da2:	8b 40 0c             	mov    0xc(%eax),%eax
+  800da5:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800daa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800daf:	b8 05 00 00 00       	mov    $0x5,%eax
+  800db4:	e8 7e ff ff ff       	call   800d37 <fsipc>
+  800db9:	85 c0                	test   %eax,%eax
+  800dbb:	78 2c                	js     800de9 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800dbd:	83 ec 08             	sub    $0x8,%esp
+  800dc0:	68 00 f0 80 00       	push   $0x80f000
+  800dc5:	53                   	push   %ebx
+  800dc6:	e8 e6 34 00 00       	call   8042b1 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800dcb:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  800dd0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800dd6:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  800ddb:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800de1:	83 c4 10             	add    $0x10,%esp
+  800de4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800de9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dec:	c9                   	leave
+  800ded:	c3                   	ret
+
+00800dee <devfile_write>:
+{
+  800dee:	55                   	push   %ebp
+  800def:	89 e5                	mov    %esp,%ebp
+  800df1:	83 ec 0c             	sub    $0xc,%esp
+  800df4:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800df7:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800dfc:	39 d0                	cmp    %edx,%eax
+  800dfe:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800e01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e04:	8b 52 0c             	mov    0xc(%edx),%edx
+  800e07:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  800e0d:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800e12:	50                   	push   %eax
+  800e13:	ff 75 0c             	push   0xc(%ebp)
+  800e16:	68 08 f0 80 00       	push   $0x80f008
+  800e1b:	e8 17 36 00 00       	call   804437 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800e20:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e25:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e2a:	e8 08 ff ff ff       	call   800d37 <fsipc>
+}
+  800e2f:	c9                   	leave
+  800e30:	c3                   	ret
+
+00800e31 <devfile_read>:
+{
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	57                   	push   %edi
+  800e35:	56                   	push   %esi
+  800e36:	53                   	push   %ebx
+  800e37:	83 ec 1c             	sub    $0x1c,%esp
+  800e3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e3d:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e40:	89 fe                	mov    %edi,%esi
+  800e42:	c1 ee 0c             	shr    $0xc,%esi
+  800e45:	b8 20 00 00 00       	mov    $0x20,%eax
+  800e4a:	39 c6                	cmp    %eax,%esi
+  800e4c:	0f 47 f0             	cmova  %eax,%esi
+  800e4f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e52:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e57:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  800e5a:	eb 14                	jmp    800e70 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e5c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  800e63:	05 00 10 00 00       	add    $0x1000,%eax
+  800e68:	f6 c6 06             	test   $0x6,%dh
+  800e6b:	75 42                	jne    800eaf <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e6d:	83 c1 01             	add    $0x1,%ecx
+  800e70:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800e73:	39 f1                	cmp    %esi,%ecx
+  800e75:	0f 84 95 00 00 00    	je     800f10 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e7b:	89 c2                	mov    %eax,%edx
+  800e7d:	c1 ea 16             	shr    $0x16,%edx
+  800e80:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e87:	f6 c2 01             	test   $0x1,%dl
+  800e8a:	74 23                	je     800eaf <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e8c:	89 c2                	mov    %eax,%edx
+  800e8e:	c1 ea 0c             	shr    $0xc,%edx
+  800e91:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800e98:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  800e9e:	74 0f                	je     800eaf <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  800ea0:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800ea7:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  800ead:	75 ad                	jne    800e5c <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  800eaf:	85 c9                	test   %ecx,%ecx
+  800eb1:	74 11                	je     800ec4 <devfile_read+0x93>
+  800eb3:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  800eba:	75 08                	jne    800ec4 <devfile_read+0x93>
+  800ebc:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  800ec2:	74 50                	je     800f14 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800ec4:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800ec7:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  800ecc:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800ed2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed7:	b8 03 00 00 00       	mov    $0x3,%eax
+  800edc:	e8 56 fe ff ff       	call   800d37 <fsipc>
+  800ee1:	89 c6                	mov    %eax,%esi
+  800ee3:	85 c0                	test   %eax,%eax
+  800ee5:	78 1f                	js     800f06 <devfile_read+0xd5>
+	assert(r <= n);
+  800ee7:	39 c7                	cmp    %eax,%edi
+  800ee9:	72 50                	jb     800f3b <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  800eeb:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800ef0:	7f 62                	jg     800f54 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  800ef2:	83 ec 04             	sub    $0x4,%esp
+  800ef5:	50                   	push   %eax
+  800ef6:	68 00 f0 80 00       	push   $0x80f000
+  800efb:	ff 75 0c             	push   0xc(%ebp)
+  800efe:	e8 34 35 00 00       	call   804437 <memmove>
+	return r;
+  800f03:	83 c4 10             	add    $0x10,%esp
+}
+  800f06:	89 f0                	mov    %esi,%eax
+  800f08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0b:	5b                   	pop    %ebx
+  800f0c:	5e                   	pop    %esi
+  800f0d:	5f                   	pop    %edi
+  800f0e:	5d                   	pop    %ebp
+  800f0f:	c3                   	ret
+  800f10:	89 f1                	mov    %esi,%ecx
+  800f12:	eb 9b                	jmp    800eaf <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  800f14:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f17:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  800f1c:	89 c8                	mov    %ecx,%eax
+  800f1e:	c1 e0 0c             	shl    $0xc,%eax
+  800f21:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  800f26:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f29:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f2e:	e8 ab fd ff ff       	call   800cde <fsipc_pages>
+  800f33:	89 c6                	mov    %eax,%esi
+  800f35:	85 c0                	test   %eax,%eax
+  800f37:	78 8b                	js     800ec4 <devfile_read+0x93>
+  800f39:	eb cb                	jmp    800f06 <devfile_read+0xd5>
+	assert(r <= n);
+  800f3b:	68 64 4d 80 00       	push   $0x804d64
+  800f40:	68 6b 4d 80 00       	push   $0x804d6b
+  800f45:	68 a0 00 00 00       	push   $0xa0
+  800f4a:	68 80 4d 80 00       	push   $0x804d80
+  800f4f:	e8 9b 2c 00 00       	call   803bef <_panic>
+	assert(r <= PGSIZE);
+  800f54:	68 8b 4d 80 00       	push   $0x804d8b
+  800f59:	68 6b 4d 80 00       	push   $0x804d6b
+  800f5e:	68 a1 00 00 00       	push   $0xa1
+  800f63:	68 80 4d 80 00       	push   $0x804d80
+  800f68:	e8 82 2c 00 00       	call   803bef <_panic>
+
+00800f6d <open>:
+{
+  800f6d:	55                   	push   %ebp
+  800f6e:	89 e5                	mov    %esp,%ebp
+  800f70:	56                   	push   %esi
+  800f71:	53                   	push   %ebx
+  800f72:	83 ec 1c             	sub    $0x1c,%esp
+  800f75:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800f78:	56                   	push   %esi
+  800f79:	e8 f8 32 00 00       	call   804276 <strlen>
+  800f7e:	83 c4 10             	add    $0x10,%esp
+  800f81:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f86:	7f 6c                	jg     800ff4 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800f88:	83 ec 0c             	sub    $0xc,%esp
+  800f8b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f8e:	50                   	push   %eax
+  800f8f:	e8 eb f7 ff ff       	call   80077f <fd_alloc>
+  800f94:	89 c3                	mov    %eax,%ebx
+  800f96:	83 c4 10             	add    $0x10,%esp
+  800f99:	85 c0                	test   %eax,%eax
+  800f9b:	78 3c                	js     800fd9 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800f9d:	83 ec 08             	sub    $0x8,%esp
+  800fa0:	56                   	push   %esi
+  800fa1:	68 00 f0 80 00       	push   $0x80f000
+  800fa6:	e8 06 33 00 00       	call   8042b1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800fab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800fae:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800fb3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800fb6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fbb:	e8 77 fd ff ff       	call   800d37 <fsipc>
+  800fc0:	89 c3                	mov    %eax,%ebx
+  800fc2:	83 c4 10             	add    $0x10,%esp
+  800fc5:	85 c0                	test   %eax,%eax
+  800fc7:	78 19                	js     800fe2 <open+0x75>
+	return fd2num(fd);
+  800fc9:	83 ec 0c             	sub    $0xc,%esp
+  800fcc:	ff 75 f4             	push   -0xc(%ebp)
+  800fcf:	e8 84 f7 ff ff       	call   800758 <fd2num>
+  800fd4:	89 c3                	mov    %eax,%ebx
+  800fd6:	83 c4 10             	add    $0x10,%esp
+}
+  800fd9:	89 d8                	mov    %ebx,%eax
+  800fdb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fde:	5b                   	pop    %ebx
+  800fdf:	5e                   	pop    %esi
+  800fe0:	5d                   	pop    %ebp
+  800fe1:	c3                   	ret
+		fd_close(fd, 0);
+  800fe2:	83 ec 08             	sub    $0x8,%esp
+  800fe5:	6a 00                	push   $0x0
+  800fe7:	ff 75 f4             	push   -0xc(%ebp)
+  800fea:	e8 80 f8 ff ff       	call   80086f <fd_close>
+		return r;
+  800fef:	83 c4 10             	add    $0x10,%esp
+  800ff2:	eb e5                	jmp    800fd9 <open+0x6c>
+		return -E_BAD_PATH;
+  800ff4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800ff9:	eb de                	jmp    800fd9 <open+0x6c>
+
+00800ffb <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800ffb:	55                   	push   %ebp
+  800ffc:	89 e5                	mov    %esp,%ebp
+  800ffe:	53                   	push   %ebx
+  800fff:	83 ec 10             	sub    $0x10,%esp
+  801002:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801005:	53                   	push   %ebx
+  801006:	e8 6b 32 00 00       	call   804276 <strlen>
+  80100b:	83 c4 10             	add    $0x10,%esp
+  80100e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801013:	7f 25                	jg     80103a <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801015:	83 ec 08             	sub    $0x8,%esp
+  801018:	53                   	push   %ebx
+  801019:	68 00 f0 80 00       	push   $0x80f000
+  80101e:	e8 8e 32 00 00       	call   8042b1 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801023:	ba 00 00 00 00       	mov    $0x0,%edx
+  801028:	b8 07 00 00 00       	mov    $0x7,%eax
+  80102d:	e8 05 fd ff ff       	call   800d37 <fsipc>
+  801032:	83 c4 10             	add    $0x10,%esp
+}
+  801035:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801038:	c9                   	leave
+  801039:	c3                   	ret
+		return -E_BAD_PATH;
+  80103a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80103f:	eb f4                	jmp    801035 <remove+0x3a>
+
+00801041 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801041:	55                   	push   %ebp
+  801042:	89 e5                	mov    %esp,%ebp
+  801044:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801047:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801051:	e8 e1 fc ff ff       	call   800d37 <fsipc>
+}
+  801056:	c9                   	leave
+  801057:	c3                   	ret
+
+00801058 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801058:	55                   	push   %ebp
+  801059:	89 e5                	mov    %esp,%ebp
+  80105b:	53                   	push   %ebx
+  80105c:	83 ec 04             	sub    $0x4,%esp
+  80105f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801062:	ba 00 00 00 00       	mov    $0x0,%edx
+  801067:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80106c:	e8 c6 fc ff ff       	call   800d37 <fsipc>
+  801071:	85 c0                	test   %eax,%eax
+  801073:	78 3c                	js     8010b1 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801075:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  80107a:	89 03                	mov    %eax,(%ebx)
+  80107c:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  801081:	89 43 04             	mov    %eax,0x4(%ebx)
+  801084:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  801089:	89 43 08             	mov    %eax,0x8(%ebx)
+  80108c:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  801091:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801094:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  801099:	89 43 10             	mov    %eax,0x10(%ebx)
+  80109c:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  8010a1:	89 43 14             	mov    %eax,0x14(%ebx)
+  8010a4:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  8010a9:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  8010ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010b4:	c9                   	leave
+  8010b5:	c3                   	ret
+
+008010b6 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  8010b6:	55                   	push   %ebp
+  8010b7:	89 e5                	mov    %esp,%ebp
+  8010b9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  8010bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010bf:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  8010c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010ce:	e8 64 fc ff ff       	call   800d37 <fsipc>
+}
+  8010d3:	c9                   	leave
+  8010d4:	c3                   	ret
+
+008010d5 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8010d5:	55                   	push   %ebp
+  8010d6:	89 e5                	mov    %esp,%ebp
+  8010d8:	56                   	push   %esi
+  8010d9:	53                   	push   %ebx
+  8010da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8010dd:	83 ec 0c             	sub    $0xc,%esp
+  8010e0:	ff 75 08             	push   0x8(%ebp)
+  8010e3:	e8 80 f6 ff ff       	call   800768 <fd2data>
+  8010e8:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8010ea:	83 c4 08             	add    $0x8,%esp
+  8010ed:	68 97 4d 80 00       	push   $0x804d97
+  8010f2:	53                   	push   %ebx
+  8010f3:	e8 b9 31 00 00       	call   8042b1 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8010f8:	8b 46 04             	mov    0x4(%esi),%eax
+  8010fb:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801101:	2b 0e                	sub    (%esi),%ecx
+  801103:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801108:	89 c8                	mov    %ecx,%eax
+  80110a:	f7 e2                	mul    %edx
+  80110c:	c1 ea 0c             	shr    $0xc,%edx
+  80110f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801115:	29 d1                	sub    %edx,%ecx
+  801117:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  80111d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801124:	00 00 00 
+	stat->st_dev = &devpipe;
+  801127:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  80112e:	60 80 00 
+	return 0;
+}
+  801131:	b8 00 00 00 00       	mov    $0x0,%eax
+  801136:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801139:	5b                   	pop    %ebx
+  80113a:	5e                   	pop    %esi
+  80113b:	5d                   	pop    %ebp
+  80113c:	c3                   	ret
+
+0080113d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80113d:	55                   	push   %ebp
+  80113e:	89 e5                	mov    %esp,%ebp
+  801140:	53                   	push   %ebx
+  801141:	83 ec 0c             	sub    $0xc,%esp
+  801144:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801147:	53                   	push   %ebx
+  801148:	6a 00                	push   $0x0
+  80114a:	e8 f3 f0 ff ff       	call   800242 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80114f:	89 1c 24             	mov    %ebx,(%esp)
+  801152:	e8 11 f6 ff ff       	call   800768 <fd2data>
+  801157:	83 c4 08             	add    $0x8,%esp
+  80115a:	50                   	push   %eax
+  80115b:	6a 00                	push   $0x0
+  80115d:	e8 e0 f0 ff ff       	call   800242 <sys_page_unmap>
+}
+  801162:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801165:	c9                   	leave
+  801166:	c3                   	ret
+
+00801167 <_pipeisclosed>:
+{
+  801167:	55                   	push   %ebp
+  801168:	89 e5                	mov    %esp,%ebp
+  80116a:	57                   	push   %edi
+  80116b:	56                   	push   %esi
+  80116c:	53                   	push   %ebx
+  80116d:	83 ec 1c             	sub    $0x1c,%esp
+  801170:	89 c7                	mov    %eax,%edi
+  801172:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801174:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801179:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80117c:	83 ec 0c             	sub    $0xc,%esp
+  80117f:	57                   	push   %edi
+  801180:	e8 c8 38 00 00       	call   804a4d <pageref>
+  801185:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801188:	89 34 24             	mov    %esi,(%esp)
+  80118b:	e8 bd 38 00 00       	call   804a4d <pageref>
+		nn = thisenv->env_runs;
+  801190:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  801196:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801199:	83 c4 10             	add    $0x10,%esp
+  80119c:	39 cb                	cmp    %ecx,%ebx
+  80119e:	74 1b                	je     8011bb <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8011a0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8011a3:	75 cf                	jne    801174 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8011a5:	8b 42 58             	mov    0x58(%edx),%eax
+  8011a8:	6a 01                	push   $0x1
+  8011aa:	50                   	push   %eax
+  8011ab:	53                   	push   %ebx
+  8011ac:	68 9e 4d 80 00       	push   $0x804d9e
+  8011b1:	e8 14 2b 00 00       	call   803cca <cprintf>
+  8011b6:	83 c4 10             	add    $0x10,%esp
+  8011b9:	eb b9                	jmp    801174 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8011bb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8011be:	0f 94 c0             	sete   %al
+  8011c1:	0f b6 c0             	movzbl %al,%eax
+}
+  8011c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c7:	5b                   	pop    %ebx
+  8011c8:	5e                   	pop    %esi
+  8011c9:	5f                   	pop    %edi
+  8011ca:	5d                   	pop    %ebp
+  8011cb:	c3                   	ret
+
+008011cc <devpipe_read>:
+{
+  8011cc:	55                   	push   %ebp
+  8011cd:	89 e5                	mov    %esp,%ebp
+  8011cf:	57                   	push   %edi
+  8011d0:	56                   	push   %esi
+  8011d1:	53                   	push   %ebx
+  8011d2:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8011d5:	ff 75 08             	push   0x8(%ebp)
+  8011d8:	e8 8b f5 ff ff       	call   800768 <fd2data>
+  8011dd:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8011df:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8011e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8011e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8011e8:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8011eb:	8b 0b                	mov    (%ebx),%ecx
+  8011ed:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8011f3:	29 ce                	sub    %ecx,%esi
+  8011f5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8011fa:	f7 e6                	mul    %esi
+  8011fc:	c1 ea 0c             	shr    $0xc,%edx
+  8011ff:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801205:	29 c6                	sub    %eax,%esi
+  801207:	89 f2                	mov    %esi,%edx
+  801209:	75 43                	jne    80124e <devpipe_read+0x82>
+		ref = pageref(p);
+  80120b:	83 ec 0c             	sub    $0xc,%esp
+  80120e:	53                   	push   %ebx
+  80120f:	e8 39 38 00 00       	call   804a4d <pageref>
+  801214:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801216:	89 da                	mov    %ebx,%edx
+  801218:	8b 45 08             	mov    0x8(%ebp),%eax
+  80121b:	e8 47 ff ff ff       	call   801167 <_pipeisclosed>
+  801220:	83 c4 10             	add    $0x10,%esp
+  801223:	85 c0                	test   %eax,%eax
+  801225:	0f 85 c1 00 00 00    	jne    8012ec <devpipe_read+0x120>
+	*sleeping = 1;
+  80122b:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801232:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801237:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  80123a:	75 ac                	jne    8011e8 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  80123c:	83 ec 04             	sub    $0x4,%esp
+  80123f:	56                   	push   %esi
+  801240:	57                   	push   %edi
+  801241:	ff 75 e4             	push   -0x1c(%ebp)
+  801244:	e8 4d f4 ff ff       	call   800696 <sys_futex_wait>
+  801249:	83 c4 10             	add    $0x10,%esp
+  80124c:	eb 9a                	jmp    8011e8 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  80124e:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801251:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801255:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801257:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80125c:	f7 e1                	mul    %ecx
+  80125e:	c1 ea 0b             	shr    $0xb,%edx
+  801261:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801267:	29 c1                	sub    %eax,%ecx
+  801269:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  80126b:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801270:	29 cf                	sub    %ecx,%edi
+  801272:	39 f7                	cmp    %esi,%edi
+  801274:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801277:	8d 43 10             	lea    0x10(%ebx),%eax
+  80127a:	83 ec 04             	sub    $0x4,%esp
+  80127d:	57                   	push   %edi
+  80127e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801281:	01 c2                	add    %eax,%edx
+  801283:	52                   	push   %edx
+  801284:	ff 75 0c             	push   0xc(%ebp)
+  801287:	e8 ab 31 00 00       	call   804437 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  80128c:	83 c4 0c             	add    $0xc,%esp
+  80128f:	89 f1                	mov    %esi,%ecx
+  801291:	29 f9                	sub    %edi,%ecx
+  801293:	51                   	push   %ecx
+  801294:	ff 75 e4             	push   -0x1c(%ebp)
+  801297:	89 f8                	mov    %edi,%eax
+  801299:	03 45 0c             	add    0xc(%ebp),%eax
+  80129c:	50                   	push   %eax
+  80129d:	e8 95 31 00 00       	call   804437 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  8012a2:	89 f1                	mov    %esi,%ecx
+  8012a4:	03 0b                	add    (%ebx),%ecx
+  8012a6:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8012ab:	f7 e1                	mul    %ecx
+  8012ad:	c1 ea 0c             	shr    $0xc,%edx
+  8012b0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8012b6:	29 d1                	sub    %edx,%ecx
+  8012b8:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  8012ba:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8012bf:	83 c4 10             	add    $0x10,%esp
+  8012c2:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  8012c6:	75 0a                	jne    8012d2 <devpipe_read+0x106>
+	return n;
+  8012c8:	89 f0                	mov    %esi,%eax
+}
+  8012ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012cd:	5b                   	pop    %ebx
+  8012ce:	5e                   	pop    %esi
+  8012cf:	5f                   	pop    %edi
+  8012d0:	5d                   	pop    %ebp
+  8012d1:	c3                   	ret
+		*sleeping = 0;
+  8012d2:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8012d9:	83 ec 08             	sub    $0x8,%esp
+  8012dc:	68 00 04 00 00       	push   $0x400
+  8012e1:	53                   	push   %ebx
+  8012e2:	e8 ff f3 ff ff       	call   8006e6 <sys_futex_wake>
+  8012e7:	83 c4 10             	add    $0x10,%esp
+  8012ea:	eb dc                	jmp    8012c8 <devpipe_read+0xfc>
+			return 0;
+  8012ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f1:	eb d7                	jmp    8012ca <devpipe_read+0xfe>
+
+008012f3 <devpipe_write>:
+{
+  8012f3:	55                   	push   %ebp
+  8012f4:	89 e5                	mov    %esp,%ebp
+  8012f6:	57                   	push   %edi
+  8012f7:	56                   	push   %esi
+  8012f8:	53                   	push   %ebx
+  8012f9:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8012fc:	ff 75 08             	push   0x8(%ebp)
+  8012ff:	e8 64 f4 ff ff       	call   800768 <fd2data>
+  801304:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801306:	83 c4 10             	add    $0x10,%esp
+  801309:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801310:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801313:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801316:	0f 83 23 01 00 00    	jae    80143f <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80131c:	8b 77 04             	mov    0x4(%edi),%esi
+  80131f:	8b 1f                	mov    (%edi),%ebx
+  801321:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801327:	29 d9                	sub    %ebx,%ecx
+  801329:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80132e:	f7 e1                	mul    %ecx
+  801330:	c1 ea 0c             	shr    $0xc,%edx
+  801333:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801339:	29 c1                	sub    %eax,%ecx
+  80133b:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80133d:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801343:	75 40                	jne    801385 <devpipe_write+0x92>
+			ref = pageref(p);
+  801345:	83 ec 0c             	sub    $0xc,%esp
+  801348:	57                   	push   %edi
+  801349:	e8 ff 36 00 00       	call   804a4d <pageref>
+  80134e:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801350:	89 fa                	mov    %edi,%edx
+  801352:	8b 45 08             	mov    0x8(%ebp),%eax
+  801355:	e8 0d fe ff ff       	call   801167 <_pipeisclosed>
+  80135a:	83 c4 10             	add    $0x10,%esp
+  80135d:	85 c0                	test   %eax,%eax
+  80135f:	0f 85 d5 00 00 00    	jne    80143a <devpipe_write+0x147>
+	*sleeping = 1;
+  801365:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  80136c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801371:	39 1f                	cmp    %ebx,(%edi)
+  801373:	75 a7                	jne    80131c <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801375:	83 ec 04             	sub    $0x4,%esp
+  801378:	56                   	push   %esi
+  801379:	53                   	push   %ebx
+  80137a:	57                   	push   %edi
+  80137b:	e8 16 f3 ff ff       	call   800696 <sys_futex_wait>
+  801380:	83 c4 10             	add    $0x10,%esp
+  801383:	eb 97                	jmp    80131c <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801385:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801388:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80138b:	29 c1                	sub    %eax,%ecx
+  80138d:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801392:	89 d8                	mov    %ebx,%eax
+  801394:	29 d0                	sub    %edx,%eax
+  801396:	39 c1                	cmp    %eax,%ecx
+  801398:	0f 46 c1             	cmovbe %ecx,%eax
+  80139b:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  80139d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8013a2:	f7 e6                	mul    %esi
+  8013a4:	c1 ea 0b             	shr    $0xb,%edx
+  8013a7:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8013ad:	29 c6                	sub    %eax,%esi
+  8013af:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8013b1:	29 f3                	sub    %esi,%ebx
+  8013b3:	39 cb                	cmp    %ecx,%ebx
+  8013b5:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8013b8:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  8013bb:	8d 77 10             	lea    0x10(%edi),%esi
+  8013be:	83 ec 04             	sub    $0x4,%esp
+  8013c1:	53                   	push   %ebx
+  8013c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8013c5:	03 45 0c             	add    0xc(%ebp),%eax
+  8013c8:	50                   	push   %eax
+  8013c9:	01 f2                	add    %esi,%edx
+  8013cb:	52                   	push   %edx
+  8013cc:	e8 66 30 00 00       	call   804437 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8013d1:	83 c4 0c             	add    $0xc,%esp
+  8013d4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013d7:	29 d8                	sub    %ebx,%eax
+  8013d9:	50                   	push   %eax
+  8013da:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8013dd:	01 d3                	add    %edx,%ebx
+  8013df:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8013e2:	53                   	push   %ebx
+  8013e3:	56                   	push   %esi
+  8013e4:	e8 4e 30 00 00       	call   804437 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8013e9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8013ec:	03 4f 04             	add    0x4(%edi),%ecx
+  8013ef:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8013f4:	f7 e1                	mul    %ecx
+  8013f6:	c1 ea 0c             	shr    $0xc,%edx
+  8013f9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8013ff:	29 d1                	sub    %edx,%ecx
+  801401:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  801404:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801409:	83 c4 10             	add    $0x10,%esp
+  80140c:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  801410:	75 0b                	jne    80141d <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  801412:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  801415:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801418:	e9 f3 fe ff ff       	jmp    801310 <devpipe_write+0x1d>
+		*sleeping = 0;
+  80141d:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  801424:	83 ec 08             	sub    $0x8,%esp
+  801427:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  80142c:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  80142f:	50                   	push   %eax
+  801430:	e8 b1 f2 ff ff       	call   8006e6 <sys_futex_wake>
+  801435:	83 c4 10             	add    $0x10,%esp
+  801438:	eb d8                	jmp    801412 <devpipe_write+0x11f>
+				return 0;
+  80143a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80143f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801442:	5b                   	pop    %ebx
+  801443:	5e                   	pop    %esi
+  801444:	5f                   	pop    %edi
+  801445:	5d                   	pop    %ebp
+  801446:	c3                   	ret
+
+00801447 <pipe>:
+{
+  801447:	55                   	push   %ebp
+  801448:	89 e5                	mov    %esp,%ebp
+  80144a:	56                   	push   %esi
+  80144b:	53                   	push   %ebx
+  80144c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80144f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801452:	50                   	push   %eax
+  801453:	e8 27 f3 ff ff       	call   80077f <fd_alloc>
+  801458:	89 c3                	mov    %eax,%ebx
+  80145a:	83 c4 10             	add    $0x10,%esp
+  80145d:	85 c0                	test   %eax,%eax
+  80145f:	0f 88 23 01 00 00    	js     801588 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801465:	83 ec 04             	sub    $0x4,%esp
+  801468:	68 07 04 00 00       	push   $0x407
+  80146d:	ff 75 f4             	push   -0xc(%ebp)
+  801470:	6a 00                	push   $0x0
+  801472:	e8 46 ed ff ff       	call   8001bd <sys_page_alloc>
+  801477:	89 c3                	mov    %eax,%ebx
+  801479:	83 c4 10             	add    $0x10,%esp
+  80147c:	85 c0                	test   %eax,%eax
+  80147e:	0f 88 04 01 00 00    	js     801588 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801484:	83 ec 0c             	sub    $0xc,%esp
+  801487:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80148a:	50                   	push   %eax
+  80148b:	e8 ef f2 ff ff       	call   80077f <fd_alloc>
+  801490:	89 c3                	mov    %eax,%ebx
+  801492:	83 c4 10             	add    $0x10,%esp
+  801495:	85 c0                	test   %eax,%eax
+  801497:	0f 88 db 00 00 00    	js     801578 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80149d:	83 ec 04             	sub    $0x4,%esp
+  8014a0:	68 07 04 00 00       	push   $0x407
+  8014a5:	ff 75 f0             	push   -0x10(%ebp)
+  8014a8:	6a 00                	push   $0x0
+  8014aa:	e8 0e ed ff ff       	call   8001bd <sys_page_alloc>
+  8014af:	89 c3                	mov    %eax,%ebx
+  8014b1:	83 c4 10             	add    $0x10,%esp
+  8014b4:	85 c0                	test   %eax,%eax
+  8014b6:	0f 88 bc 00 00 00    	js     801578 <pipe+0x131>
+	va = fd2data(fd0);
+  8014bc:	83 ec 0c             	sub    $0xc,%esp
+  8014bf:	ff 75 f4             	push   -0xc(%ebp)
+  8014c2:	e8 a1 f2 ff ff       	call   800768 <fd2data>
+  8014c7:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014c9:	83 c4 0c             	add    $0xc,%esp
+  8014cc:	68 07 04 00 00       	push   $0x407
+  8014d1:	50                   	push   %eax
+  8014d2:	6a 00                	push   $0x0
+  8014d4:	e8 e4 ec ff ff       	call   8001bd <sys_page_alloc>
+  8014d9:	89 c3                	mov    %eax,%ebx
+  8014db:	83 c4 10             	add    $0x10,%esp
+  8014de:	85 c0                	test   %eax,%eax
+  8014e0:	0f 88 82 00 00 00    	js     801568 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014e6:	83 ec 0c             	sub    $0xc,%esp
+  8014e9:	ff 75 f0             	push   -0x10(%ebp)
+  8014ec:	e8 77 f2 ff ff       	call   800768 <fd2data>
+  8014f1:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8014f8:	50                   	push   %eax
+  8014f9:	6a 00                	push   $0x0
+  8014fb:	56                   	push   %esi
+  8014fc:	6a 00                	push   $0x0
+  8014fe:	e8 fd ec ff ff       	call   800200 <sys_page_map>
+  801503:	89 c3                	mov    %eax,%ebx
+  801505:	83 c4 20             	add    $0x20,%esp
+  801508:	85 c0                	test   %eax,%eax
+  80150a:	78 4e                	js     80155a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80150c:	a1 20 60 80 00       	mov    0x806020,%eax
+  801511:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801514:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801516:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801519:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801520:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801523:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801525:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801528:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80152f:	83 ec 0c             	sub    $0xc,%esp
+  801532:	ff 75 f4             	push   -0xc(%ebp)
+  801535:	e8 1e f2 ff ff       	call   800758 <fd2num>
+  80153a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80153d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80153f:	83 c4 04             	add    $0x4,%esp
+  801542:	ff 75 f0             	push   -0x10(%ebp)
+  801545:	e8 0e f2 ff ff       	call   800758 <fd2num>
+  80154a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80154d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801550:	83 c4 10             	add    $0x10,%esp
+  801553:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801558:	eb 2e                	jmp    801588 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80155a:	83 ec 08             	sub    $0x8,%esp
+  80155d:	56                   	push   %esi
+  80155e:	6a 00                	push   $0x0
+  801560:	e8 dd ec ff ff       	call   800242 <sys_page_unmap>
+  801565:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801568:	83 ec 08             	sub    $0x8,%esp
+  80156b:	ff 75 f0             	push   -0x10(%ebp)
+  80156e:	6a 00                	push   $0x0
+  801570:	e8 cd ec ff ff       	call   800242 <sys_page_unmap>
+  801575:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801578:	83 ec 08             	sub    $0x8,%esp
+  80157b:	ff 75 f4             	push   -0xc(%ebp)
+  80157e:	6a 00                	push   $0x0
+  801580:	e8 bd ec ff ff       	call   800242 <sys_page_unmap>
+  801585:	83 c4 10             	add    $0x10,%esp
+}
+  801588:	89 d8                	mov    %ebx,%eax
+  80158a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80158d:	5b                   	pop    %ebx
+  80158e:	5e                   	pop    %esi
+  80158f:	5d                   	pop    %ebp
+  801590:	c3                   	ret
+
+00801591 <pipeisclosed>:
+{
+  801591:	55                   	push   %ebp
+  801592:	89 e5                	mov    %esp,%ebp
+  801594:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801597:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80159a:	50                   	push   %eax
+  80159b:	ff 75 08             	push   0x8(%ebp)
+  80159e:	e8 30 f2 ff ff       	call   8007d3 <fd_lookup>
+  8015a3:	83 c4 10             	add    $0x10,%esp
+  8015a6:	85 c0                	test   %eax,%eax
+  8015a8:	78 18                	js     8015c2 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8015aa:	83 ec 0c             	sub    $0xc,%esp
+  8015ad:	ff 75 f4             	push   -0xc(%ebp)
+  8015b0:	e8 b3 f1 ff ff       	call   800768 <fd2data>
+  8015b5:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8015b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015ba:	e8 a8 fb ff ff       	call   801167 <_pipeisclosed>
+  8015bf:	83 c4 10             	add    $0x10,%esp
+}
+  8015c2:	c9                   	leave
+  8015c3:	c3                   	ret
+
+008015c4 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  8015c4:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8015c6:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  8015cc:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  8015d2:	81 c2 34 01 00 00    	add    $0x134,%edx
+  8015d8:	39 d0                	cmp    %edx,%eax
+  8015da:	74 2e                	je     80160a <segment_lookup+0x46>
+{
+  8015dc:	55                   	push   %ebp
+  8015dd:	89 e5                	mov    %esp,%ebp
+  8015df:	57                   	push   %edi
+  8015e0:	56                   	push   %esi
+  8015e1:	53                   	push   %ebx
+  8015e2:	eb 07                	jmp    8015eb <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8015e4:	83 c0 20             	add    $0x20,%eax
+  8015e7:	39 d0                	cmp    %edx,%eax
+  8015e9:	74 15                	je     801600 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  8015eb:	8b 18                	mov    (%eax),%ebx
+  8015ed:	39 d9                	cmp    %ebx,%ecx
+  8015ef:	72 f3                	jb     8015e4 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  8015f1:	8b 38                	mov    (%eax),%edi
+  8015f3:	8b 58 04             	mov    0x4(%eax),%ebx
+  8015f6:	89 ce                	mov    %ecx,%esi
+  8015f8:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  8015fa:	39 de                	cmp    %ebx,%esi
+  8015fc:	73 e6                	jae    8015e4 <segment_lookup+0x20>
+  8015fe:	eb 05                	jmp    801605 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  801600:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801605:	5b                   	pop    %ebx
+  801606:	5e                   	pop    %esi
+  801607:	5f                   	pop    %edi
+  801608:	5d                   	pop    %ebp
+  801609:	c3                   	ret
+	return NULL;
+  80160a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80160f:	c3                   	ret
+
+00801610 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  801610:	55                   	push   %ebp
+  801611:	89 e5                	mov    %esp,%ebp
+  801613:	53                   	push   %ebx
+  801614:	83 ec 04             	sub    $0x4,%esp
+  801617:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  801619:	c1 e8 16             	shr    $0x16,%eax
+  80161c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801623:	25 81 00 00 00       	and    $0x81,%eax
+  801628:	83 f8 01             	cmp    $0x1,%eax
+  80162b:	75 6b                	jne    801698 <page_is_clean+0x88>
+  80162d:	89 da                	mov    %ebx,%edx
+  80162f:	c1 ea 0c             	shr    $0xc,%edx
+  801632:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  801639:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80163e:	f6 c1 01             	test   $0x1,%cl
+  801641:	74 5a                	je     80169d <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  801643:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80164a:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  801650:	75 4b                	jne    80169d <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  801652:	89 d8                	mov    %ebx,%eax
+  801654:	e8 6b ff ff ff       	call   8015c4 <segment_lookup>
+  801659:	89 c2                	mov    %eax,%edx
+		return 1;
+  80165b:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  801660:	85 d2                	test   %edx,%edx
+  801662:	75 39                	jne    80169d <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  801664:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  80166a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166f:	eb 03                	jmp    801674 <page_is_clean+0x64>
+  801671:	83 c0 01             	add    $0x1,%eax
+  801674:	39 c2                	cmp    %eax,%edx
+  801676:	7e 19                	jle    801691 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  801678:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  80167f:	72 f0                	jb     801671 <page_is_clean+0x61>
+  801681:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  801688:	73 e7                	jae    801671 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  80168a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80168f:	eb 0c                	jmp    80169d <page_is_clean+0x8d>
+	return 0;
+  801691:	b8 00 00 00 00       	mov    $0x0,%eax
+  801696:	eb 05                	jmp    80169d <page_is_clean+0x8d>
+		return 0;
+  801698:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80169d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016a0:	c9                   	leave
+  8016a1:	c3                   	ret
+
+008016a2 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  8016a2:	55                   	push   %ebp
+  8016a3:	89 e5                	mov    %esp,%ebp
+  8016a5:	57                   	push   %edi
+  8016a6:	56                   	push   %esi
+  8016a7:	53                   	push   %ebx
+  8016a8:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8016ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b0:	eb 19                	jmp    8016cb <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8016b2:	f7 d3                	not    %ebx
+  8016b4:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8016ba:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8016bc:	83 c6 01             	add    $0x1,%esi
+  8016bf:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8016c5:	0f 87 97 00 00 00    	ja     801762 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8016cb:	89 f3                	mov    %esi,%ebx
+  8016cd:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  8016d3:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8016d9:	89 d8                	mov    %ebx,%eax
+  8016db:	c1 e8 0a             	shr    $0xa,%eax
+  8016de:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8016e5:	25 81 00 00 00       	and    $0x81,%eax
+  8016ea:	83 f8 01             	cmp    $0x1,%eax
+  8016ed:	75 c3                	jne    8016b2 <linear_walk+0x10>
+  8016ef:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8016f5:	77 bb                	ja     8016b2 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8016f7:	89 df                	mov    %ebx,%edi
+  8016f9:	c1 e7 0c             	shl    $0xc,%edi
+  8016fc:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8016ff:	89 f8                	mov    %edi,%eax
+  801701:	e8 0a ff ff ff       	call   801610 <page_is_clean>
+  801706:	84 c0                	test   %al,%al
+  801708:	75 64                	jne    80176e <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80170a:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  801710:	77 aa                	ja     8016bc <linear_walk+0x1a>
+  801712:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  801718:	72 a2                	jb     8016bc <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80171a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  801721:	a8 01                	test   $0x1,%al
+  801723:	74 97                	je     8016bc <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  801725:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80172c:	f6 c4 04             	test   $0x4,%ah
+  80172f:	75 8b                	jne    8016bc <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  801731:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  801738:	f6 c4 02             	test   $0x2,%ah
+  80173b:	0f 85 7b ff ff ff    	jne    8016bc <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  801741:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801748:	c1 e8 0c             	shr    $0xc,%eax
+  80174b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80174e:	05 00 00 00 ef       	add    $0xef000000,%eax
+  801753:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  801757:	66 83 f8 01          	cmp    $0x1,%ax
+  80175b:	76 11                	jbe    80176e <linear_walk+0xcc>
+  80175d:	e9 5a ff ff ff       	jmp    8016bc <linear_walk+0x1a>
+  801762:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  801767:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  80176e:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  801774:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801777:	83 c4 1c             	add    $0x1c,%esp
+  80177a:	5b                   	pop    %ebx
+  80177b:	5e                   	pop    %esi
+  80177c:	5f                   	pop    %edi
+  80177d:	5d                   	pop    %ebp
+  80177e:	c3                   	ret
+
+0080177f <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  80177f:	55                   	push   %ebp
+  801780:	89 e5                	mov    %esp,%ebp
+  801782:	56                   	push   %esi
+  801783:	53                   	push   %ebx
+  801784:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  801786:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80178b:	83 e0 7f             	and    $0x7f,%eax
+  80178e:	c1 e0 04             	shl    $0x4,%eax
+  801791:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  801797:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  80179d:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  8017a3:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  8017a9:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8017ae:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  8017b1:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8017b6:	83 c0 01             	add    $0x1,%eax
+  8017b9:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  8017be:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  8017c1:	5b                   	pop    %ebx
+  8017c2:	5e                   	pop    %esi
+  8017c3:	5d                   	pop    %ebp
+  8017c4:	c3                   	ret
+
+008017c5 <page_ring_enter>:
+{
+  8017c5:	55                   	push   %ebp
+  8017c6:	89 e5                	mov    %esp,%ebp
+  8017c8:	57                   	push   %edi
+  8017c9:	56                   	push   %esi
+  8017ca:	53                   	push   %ebx
+  8017cb:	83 ec 18             	sub    $0x18,%esp
+  8017ce:	89 c6                	mov    %eax,%esi
+  8017d0:	89 d7                	mov    %edx,%edi
+  8017d2:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  8017d4:	6a 00                	push   $0x0
+  8017d6:	6a 00                	push   $0x0
+  8017d8:	6a 00                	push   $0x0
+  8017da:	6a 07                	push   $0x7
+  8017dc:	ff 35 40 b0 80 00    	push   0x80b040
+  8017e2:	e8 50 31 00 00       	call   804937 <ipc_call>
+  8017e7:	83 c4 20             	add    $0x20,%esp
+  8017ea:	85 c0                	test   %eax,%eax
+  8017ec:	79 22                	jns    801810 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  8017ee:	50                   	push   %eax
+  8017ef:	68 b6 4d 80 00       	push   $0x804db6
+  8017f4:	68 13 02 00 00       	push   $0x213
+  8017f9:	68 ca 4d 80 00       	push   $0x804dca
+  8017fe:	e8 ec 23 00 00       	call   803bef <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  801803:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  801808:	83 c0 01             	add    $0x1,%eax
+  80180b:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  801810:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  801816:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  80181b:	39 c2                	cmp    %eax,%edx
+  80181d:	74 24                	je     801843 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  80181f:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  801824:	83 e0 7f             	and    $0x7f,%eax
+  801827:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  80182e:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  801835:	29 f0                	sub    %esi,%eax
+  801837:	39 d8                	cmp    %ebx,%eax
+  801839:	73 c8                	jae    801803 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  80183b:	8b 52 04             	mov    0x4(%edx),%edx
+  80183e:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  801841:	eb c0                	jmp    801803 <page_ring_enter+0x3e>
+}
+  801843:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801846:	5b                   	pop    %ebx
+  801847:	5e                   	pop    %esi
+  801848:	5f                   	pop    %edi
+  801849:	5d                   	pop    %ebp
+  80184a:	c3                   	ret
+
+0080184b <page_ring_reserve>:
+{
+  80184b:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  80184d:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  801852:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  801858:	29 d0                	sub    %edx,%eax
+  80185a:	ba 80 00 00 00       	mov    $0x80,%edx
+  80185f:	29 ca                	sub    %ecx,%edx
+  801861:	39 c2                	cmp    %eax,%edx
+  801863:	72 01                	jb     801866 <page_ring_reserve+0x1b>
+  801865:	c3                   	ret
+{
+  801866:	55                   	push   %ebp
+  801867:	89 e5                	mov    %esp,%ebp
+  801869:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  80186c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801871:	ba 00 00 00 00       	mov    $0x0,%edx
+  801876:	b8 00 00 00 00       	mov    $0x0,%eax
+  80187b:	e8 45 ff ff ff       	call   8017c5 <page_ring_enter>
+}
+  801880:	c9                   	leave
+  801881:	c3                   	ret
+
+00801882 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  801882:	55                   	push   %ebp
+  801883:	89 e5                	mov    %esp,%ebp
+  801885:	53                   	push   %ebx
+  801886:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  801889:	6a 07                	push   $0x7
+  80188b:	6a 01                	push   $0x1
+  80188d:	89 c3                	mov    %eax,%ebx
+  80188f:	c1 e3 0c             	shl    $0xc,%ebx
+  801892:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  801898:	52                   	push   %edx
+  801899:	6a 04                	push   $0x4
+  80189b:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  8018a2:	e8 90 30 00 00       	call   804937 <ipc_call>
+	sharereqs[i].nslots = 0;
+  8018a7:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  8018ae:	00 00 00 
+	return r;
+}
+  8018b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018b4:	c9                   	leave
+  8018b5:	c3                   	ret
+
+008018b6 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  8018b6:	55                   	push   %ebp
+  8018b7:	89 e5                	mov    %esp,%ebp
+  8018b9:	56                   	push   %esi
+  8018ba:	53                   	push   %ebx
+  8018bb:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  8018bd:	c1 e8 10             	shr    $0x10,%eax
+  8018c0:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  8018c3:	89 c2                	mov    %eax,%edx
+  8018c5:	c1 e2 0c             	shl    $0xc,%edx
+  8018c8:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  8018ce:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8018d1:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  8018d7:	89 c2                	mov    %eax,%edx
+  8018d9:	c1 e2 0a             	shl    $0xa,%edx
+  8018dc:	01 f2                	add    %esi,%edx
+  8018de:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  8018e5:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  8018eb:	74 09                	je     8018f6 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  8018ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018f2:	5b                   	pop    %ebx
+  8018f3:	5e                   	pop    %esi
+  8018f4:	5d                   	pop    %ebp
+  8018f5:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  8018f6:	e8 87 ff ff ff       	call   801882 <page_share_send>
+  8018fb:	eb f5                	jmp    8018f2 <page_share_slot+0x3c>
+
+008018fd <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  8018fd:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801902:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  801905:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  80190a:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  801910:	74 09                	je     80191b <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  801912:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  801917:	85 c0                	test   %eax,%eax
+  801919:	75 01                	jne    80191c <page_ring_ready+0x1f>
+}
+  80191b:	c3                   	ret
+{
+  80191c:	55                   	push   %ebp
+  80191d:	89 e5                	mov    %esp,%ebp
+  80191f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  801922:	68 07 06 00 00       	push   $0x607
+  801927:	6a 08                	push   $0x8
+  801929:	68 00 30 ad de       	push   $0xdead3000
+  80192e:	6a 00                	push   $0x0
+  801930:	e8 b3 e9 ff ff       	call   8002e8 <sys_page_alloc_range>
+  801935:	83 c4 10             	add    $0x10,%esp
+  801938:	83 f8 08             	cmp    $0x8,%eax
+  80193b:	74 1b                	je     801958 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  80193d:	83 ec 04             	sub    $0x4,%esp
+  801940:	6a 08                	push   $0x8
+  801942:	68 00 30 ad de       	push   $0xdead3000
+  801947:	6a 00                	push   $0x0
+  801949:	e8 08 ea ff ff       	call   800356 <sys_page_unmap_range>
+		return 0;
+  80194e:	83 c4 10             	add    $0x10,%esp
+  801951:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801956:	c9                   	leave
+  801957:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  801958:	83 ec 0c             	sub    $0xc,%esp
+  80195b:	68 07 04 00 00       	push   $0x407
+  801960:	6a 08                	push   $0x8
+  801962:	68 00 30 ad de       	push   $0xdead3000
+  801967:	6a 06                	push   $0x6
+  801969:	ff 35 40 b0 80 00    	push   0x80b040
+  80196f:	e8 c3 2f 00 00       	call   804937 <ipc_call>
+  801974:	83 c4 20             	add    $0x20,%esp
+  801977:	85 c0                	test   %eax,%eax
+  801979:	78 14                	js     80198f <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  80197b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801980:	8b 40 48             	mov    0x48(%eax),%eax
+  801983:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  801988:	b8 01 00 00 00       	mov    $0x1,%eax
+  80198d:	eb c7                	jmp    801956 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  80198f:	83 ec 04             	sub    $0x4,%esp
+  801992:	6a 08                	push   $0x8
+  801994:	68 00 30 ad de       	push   $0xdead3000
+  801999:	6a 00                	push   $0x0
+  80199b:	e8 b6 e9 ff ff       	call   800356 <sys_page_unmap_range>
+		return 0;
+  8019a0:	83 c4 10             	add    $0x10,%esp
+  8019a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a8:	eb ac                	jmp    801956 <page_ring_ready+0x59>
+
+008019aa <page_remove_slot>:
+{
+  8019aa:	55                   	push   %ebp
+  8019ab:	89 e5                	mov    %esp,%ebp
+  8019ad:	56                   	push   %esi
+  8019ae:	53                   	push   %ebx
+  8019af:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8019b1:	89 c6                	mov    %eax,%esi
+  8019b3:	c1 ee 10             	shr    $0x10,%esi
+  8019b6:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8019b9:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  8019c0:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  8019c6:	74 2a                	je     8019f2 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8019c8:	83 ec 0c             	sub    $0xc,%esp
+  8019cb:	6a 00                	push   $0x0
+  8019cd:	6a 00                	push   $0x0
+  8019cf:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  8019d1:	c1 e3 04             	shl    $0x4,%ebx
+  8019d4:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8019d7:	53                   	push   %ebx
+  8019d8:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8019df:	e8 53 2f 00 00       	call   804937 <ipc_call>
+  8019e4:	83 c4 20             	add    $0x20,%esp
+  8019e7:	85 c0                	test   %eax,%eax
+  8019e9:	78 2d                	js     801a18 <page_remove_slot+0x6e>
+}
+  8019eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ee:	5b                   	pop    %ebx
+  8019ef:	5e                   	pop    %esi
+  8019f0:	5d                   	pop    %ebp
+  8019f1:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8019f2:	e8 06 ff ff ff       	call   8018fd <page_ring_ready>
+  8019f7:	85 c0                	test   %eax,%eax
+  8019f9:	74 cd                	je     8019c8 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  8019fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a00:	e8 46 fe ff ff       	call   80184b <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  801a05:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a0a:	89 da                	mov    %ebx,%edx
+  801a0c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a11:	e8 69 fd ff ff       	call   80177f <page_ring_post>
+		return;
+  801a16:	eb d3                	jmp    8019eb <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  801a18:	50                   	push   %eax
+  801a19:	68 24 4e 80 00       	push   $0x804e24
+  801a1e:	68 ac 03 00 00       	push   $0x3ac
+  801a23:	68 ca 4d 80 00       	push   $0x804dca
+  801a28:	e8 c2 21 00 00       	call   803bef <_panic>
+
+00801a2d <find_paging_env>:
+	if(pagingenv)
+  801a2d:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  801a32:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  801a34:	85 c0                	test   %eax,%eax
+  801a36:	74 05                	je     801a3d <find_paging_env+0x10>
+  801a38:	eb 56                	jmp    801a90 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  801a3a:	83 c0 01             	add    $0x1,%eax
+  801a3d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a42:	7f 47                	jg     801a8b <find_paging_env+0x5e>
+  801a44:	83 f9 01             	cmp    $0x1,%ecx
+  801a47:	7f 42                	jg     801a8b <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  801a49:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  801a4c:	c1 e2 06             	shl    $0x6,%edx
+  801a4f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801a55:	8b 52 50             	mov    0x50(%edx),%edx
+  801a58:	83 fa 02             	cmp    $0x2,%edx
+  801a5b:	75 dd                	jne    801a3a <find_paging_env+0xd>
+  801a5d:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  801a60:	c1 e2 06             	shl    $0x6,%edx
+  801a63:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801a69:	8b 52 54             	mov    0x54(%edx),%edx
+  801a6c:	85 d2                	test   %edx,%edx
+  801a6e:	74 ca                	je     801a3a <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  801a70:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  801a73:	c1 e2 06             	shl    $0x6,%edx
+  801a76:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801a7c:	8b 52 48             	mov    0x48(%edx),%edx
+  801a7f:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  801a86:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801a89:	eb af                	jmp    801a3a <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  801a8b:	83 f9 02             	cmp    $0x2,%ecx
+  801a8e:	74 01                	je     801a91 <find_paging_env+0x64>
+}
+  801a90:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  801a91:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801a96:	8b 40 48             	mov    0x48(%eax),%eax
+  801a99:	83 e0 01             	and    $0x1,%eax
+  801a9c:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  801aa3:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  801aa8:	eb e6                	jmp    801a90 <find_paging_env+0x63>
+
+00801aaa <page_add_backed>:
+{
+  801aaa:	55                   	push   %ebp
+  801aab:	89 e5                	mov    %esp,%ebp
+  801aad:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  801ab0:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  801ab5:	83 f8 04             	cmp    $0x4,%eax
+  801ab8:	74 35                	je     801aef <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  801aba:	89 d1                	mov    %edx,%ecx
+  801abc:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  801ac2:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  801ac9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801acc:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  801ad3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  801ad9:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  801ae0:	83 c0 01             	add    $0x1,%eax
+  801ae3:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  801ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801aed:	5d                   	pop    %ebp
+  801aee:	c3                   	ret
+		return -E_NO_MEM;
+  801aef:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  801af4:	eb f7                	jmp    801aed <page_add_backed+0x43>
+
+00801af6 <percentage_of_pgdir_to_walk>:
+{
+  801af6:	55                   	push   %ebp
+  801af7:	89 e5                	mov    %esp,%ebp
+  801af9:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  801afc:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  801b00:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  801b03:	db 45 fc             	fildl  -0x4(%ebp)
+  801b06:	d8 35 b0 52 80 00    	fdivs  0x8052b0
+	return ret*ret;
+  801b0c:	d8 c8                	fmul   %st(0),%st
+}
+  801b0e:	c9                   	leave
+  801b0f:	c3                   	ret
+
+00801b10 <nfu_with_aging_page_choice_func>:
+{
+  801b10:	55                   	push   %ebp
+  801b11:	89 e5                	mov    %esp,%ebp
+  801b13:	57                   	push   %edi
+  801b14:	56                   	push   %esi
+  801b15:	53                   	push   %ebx
+  801b16:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  801b19:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  801b1f:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  801b21:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  801b26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b2b:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  801b32:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b37:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  801b3a:	eb 18                	jmp    801b54 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  801b3c:	f7 d0                	not    %eax
+  801b3e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b43:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  801b45:	83 c2 01             	add    $0x1,%edx
+  801b48:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  801b4e:	0f 87 13 01 00 00    	ja     801c67 <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  801b54:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  801b58:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  801b5b:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  801b60:	89 c1                	mov    %eax,%ecx
+  801b62:	c1 e9 0a             	shr    $0xa,%ecx
+  801b65:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  801b6c:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  801b72:	83 f9 01             	cmp    $0x1,%ecx
+  801b75:	75 c5                	jne    801b3c <nfu_with_aging_page_choice_func+0x2c>
+  801b77:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  801b7c:	77 be                	ja     801b3c <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  801b7e:	89 c1                	mov    %eax,%ecx
+  801b80:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  801b83:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  801b89:	0f 82 a5 00 00 00    	jb     801c34 <nfu_with_aging_page_choice_func+0x124>
+  801b8f:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  801b95:	0f 87 99 00 00 00    	ja     801c34 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  801b9b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  801ba2:	f6 c1 01             	test   $0x1,%cl
+  801ba5:	0f 84 89 00 00 00    	je     801c34 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  801bab:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  801bb2:	f6 c5 04             	test   $0x4,%ch
+  801bb5:	75 7d                	jne    801c34 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  801bb7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  801bbe:	f6 c5 02             	test   $0x2,%ch
+  801bc1:	75 71                	jne    801c34 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  801bc3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801bca:	c1 e9 0c             	shr    $0xc,%ecx
+  801bcd:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  801bd0:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  801bd6:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  801bda:	66 83 f9 01          	cmp    $0x1,%cx
+  801bde:	77 54                	ja     801c34 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  801be0:	89 f9                	mov    %edi,%ecx
+  801be2:	80 f9 ff             	cmp    $0xff,%cl
+  801be5:	74 21                	je     801c08 <nfu_with_aging_page_choice_func+0xf8>
+  801be7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801bee:	c1 e9 0c             	shr    $0xc,%ecx
+  801bf1:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  801bf4:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  801bfa:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  801bfe:	89 fb                	mov    %edi,%ebx
+  801c00:	38 d9                	cmp    %bl,%cl
+  801c02:	73 30                	jae    801c34 <nfu_with_aging_page_choice_func+0x124>
+  801c04:	dd d8                	fstp   %st(0)
+  801c06:	eb 02                	jmp    801c0a <nfu_with_aging_page_choice_func+0xfa>
+  801c08:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  801c0a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801c11:	c1 e9 0c             	shr    $0xc,%ecx
+  801c14:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  801c17:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  801c1e:	89 fb                	mov    %edi,%ebx
+  801c20:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  801c23:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801c26:	db 45 e0             	fildl  -0x20(%ebp)
+  801c29:	d8 35 b0 52 80 00    	fdivs  0x8052b0
+	return ret*ret;
+  801c2f:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  801c31:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  801c34:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  801c37:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  801c3a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801c41:	df 6d e0             	fildll -0x20(%ebp)
+  801c44:	d9 c1                	fld    %st(1)
+  801c46:	d8 0d b4 52 80 00    	fmuls  0x8052b4
+  801c4c:	d9 c9                	fxch   %st(1)
+  801c4e:	df f1                	fcomip %st(1),%st
+  801c50:	dd d8                	fstp   %st(0)
+  801c52:	0f 82 ed fe ff ff    	jb     801b45 <nfu_with_aging_page_choice_func+0x35>
+  801c58:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  801c5a:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  801c5f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  801c62:	c1 e0 0c             	shl    $0xc,%eax
+  801c65:	eb 0e                	jmp    801c75 <nfu_with_aging_page_choice_func+0x165>
+  801c67:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  801c69:	89 f8                	mov    %edi,%eax
+  801c6b:	3c ff                	cmp    $0xff,%al
+  801c6d:	74 0e                	je     801c7d <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  801c6f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  801c72:	c1 e0 0c             	shl    $0xc,%eax
+}
+  801c75:	83 c4 14             	add    $0x14,%esp
+  801c78:	5b                   	pop    %ebx
+  801c79:	5e                   	pop    %esi
+  801c7a:	5f                   	pop    %edi
+  801c7b:	5d                   	pop    %ebp
+  801c7c:	c3                   	ret
+	pgnum = 0;
+  801c7d:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  801c84:	00 00 00 
+	return (void*)UTOP;
+  801c87:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801c8c:	eb e7                	jmp    801c75 <nfu_with_aging_page_choice_func+0x165>
+
+00801c8e <myRand>:
+    state = state * 1664525 + 1013904223;
+  801c8e:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  801c95:	66 19 00 
+  801c98:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  801c9d:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  801ca2:	c1 e8 18             	shr    $0x18,%eax
+}
+  801ca5:	c3                   	ret
+
+00801ca6 <random_page_choice_func>:
+{
+  801ca6:	55                   	push   %ebp
+  801ca7:	89 e5                	mov    %esp,%ebp
+  801ca9:	57                   	push   %edi
+  801caa:	56                   	push   %esi
+  801cab:	53                   	push   %ebx
+  801cac:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  801caf:	be 00 00 00 00       	mov    $0x0,%esi
+  801cb4:	eb 19                	jmp    801ccf <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  801cb6:	f7 d3                	not    %ebx
+  801cb8:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  801cbe:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  801cc0:	83 c6 01             	add    $0x1,%esi
+  801cc3:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  801cc9:	0f 87 a0 00 00 00    	ja     801d6f <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  801ccf:	89 f3                	mov    %esi,%ebx
+  801cd1:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  801cd7:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  801cdd:	89 d8                	mov    %ebx,%eax
+  801cdf:	c1 e8 0a             	shr    $0xa,%eax
+  801ce2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ce9:	25 81 00 00 00       	and    $0x81,%eax
+  801cee:	83 f8 01             	cmp    $0x1,%eax
+  801cf1:	75 c3                	jne    801cb6 <random_page_choice_func+0x10>
+  801cf3:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  801cf9:	77 bb                	ja     801cb6 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  801cfb:	89 df                	mov    %ebx,%edi
+  801cfd:	c1 e7 0c             	shl    $0xc,%edi
+  801d00:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  801d03:	89 f8                	mov    %edi,%eax
+  801d05:	e8 06 f9 ff ff       	call   801610 <page_is_clean>
+  801d0a:	84 c0                	test   %al,%al
+  801d0c:	0f 85 82 00 00 00    	jne    801d94 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  801d12:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  801d18:	72 a6                	jb     801cc0 <random_page_choice_func+0x1a>
+  801d1a:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  801d20:	77 9e                	ja     801cc0 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  801d22:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  801d29:	a8 01                	test   $0x1,%al
+  801d2b:	74 93                	je     801cc0 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  801d2d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  801d34:	f6 c4 04             	test   $0x4,%ah
+  801d37:	75 87                	jne    801cc0 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  801d39:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  801d40:	f6 c4 02             	test   $0x2,%ah
+  801d43:	0f 85 77 ff ff ff    	jne    801cc0 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  801d49:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801d50:	c1 e8 0c             	shr    $0xc,%eax
+  801d53:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801d56:	05 00 00 00 ef       	add    $0xef000000,%eax
+  801d5b:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  801d5f:	66 83 f8 01          	cmp    $0x1,%ax
+  801d63:	0f 87 57 ff ff ff    	ja     801cc0 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  801d69:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  801d6f:	e8 1a ff ff ff       	call   801c8e <myRand>
+  801d74:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  801d7a:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  801d7f:	29 fe                	sub    %edi,%esi
+  801d81:	0f be c0             	movsbl %al,%eax
+  801d84:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d89:	f7 f6                	div    %esi
+  801d8b:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  801d8d:	bb 15 00 00 00       	mov    $0x15,%ebx
+  801d92:	eb 1c                	jmp    801db0 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  801d94:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  801d9a:	e9 8f 00 00 00       	jmp    801e2e <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  801d9f:	e8 ea fe ff ff       	call   801c8e <myRand>
+  801da4:	0f be c0             	movsbl %al,%eax
+  801da7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dac:	f7 f6                	div    %esi
+  801dae:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  801db0:	83 eb 01             	sub    $0x1,%ebx
+  801db3:	0f 84 c2 00 00 00    	je     801e7b <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  801db9:	89 d0                	mov    %edx,%eax
+  801dbb:	c1 e8 0a             	shr    $0xa,%eax
+  801dbe:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801dc5:	25 81 00 00 00       	and    $0x81,%eax
+  801dca:	83 f8 01             	cmp    $0x1,%eax
+  801dcd:	75 d0                	jne    801d9f <random_page_choice_func+0xf9>
+  801dcf:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  801dd5:	77 c8                	ja     801d9f <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  801dd7:	89 d0                	mov    %edx,%eax
+  801dd9:	c1 e0 0c             	shl    $0xc,%eax
+  801ddc:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  801de1:	72 56                	jb     801e39 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  801de3:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  801de8:	77 65                	ja     801e4f <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  801dea:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  801df1:	f6 c1 01             	test   $0x1,%cl
+  801df4:	74 59                	je     801e4f <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  801df6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  801dfd:	f6 c5 04             	test   $0x4,%ch
+  801e00:	75 4d                	jne    801e4f <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  801e02:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  801e09:	f6 c5 02             	test   $0x2,%ch
+  801e0c:	75 41                	jne    801e4f <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  801e0e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e15:	c1 ea 0c             	shr    $0xc,%edx
+  801e18:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  801e1b:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  801e21:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  801e25:	66 83 fa 01          	cmp    $0x1,%dx
+  801e29:	77 3a                	ja     801e65 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  801e2b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  801e2e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e31:	83 c4 1c             	add    $0x1c,%esp
+  801e34:	5b                   	pop    %ebx
+  801e35:	5e                   	pop    %esi
+  801e36:	5f                   	pop    %edi
+  801e37:	5d                   	pop    %ebp
+  801e38:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  801e39:	e8 50 fe ff ff       	call   801c8e <myRand>
+  801e3e:	0f be c0             	movsbl %al,%eax
+  801e41:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e46:	f7 f6                	div    %esi
+  801e48:	01 fa                	add    %edi,%edx
+			continue;
+  801e4a:	e9 61 ff ff ff       	jmp    801db0 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  801e4f:	e8 3a fe ff ff       	call   801c8e <myRand>
+  801e54:	0f be c0             	movsbl %al,%eax
+  801e57:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e5c:	f7 f6                	div    %esi
+  801e5e:	01 fa                	add    %edi,%edx
+			continue;
+  801e60:	e9 4b ff ff ff       	jmp    801db0 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  801e65:	e8 24 fe ff ff       	call   801c8e <myRand>
+  801e6a:	0f be c0             	movsbl %al,%eax
+  801e6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e72:	f7 f6                	div    %esi
+  801e74:	01 fa                	add    %edi,%edx
+			continue;
+  801e76:	e9 35 ff ff ff       	jmp    801db0 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  801e7b:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  801e82:	00 00 00 
+	return (void*)UTOP;
+  801e85:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  801e8c:	eb a0                	jmp    801e2e <random_page_choice_func+0x188>
+
+00801e8e <nfu>:
+{
+  801e8e:	55                   	push   %ebp
+  801e8f:	89 e5                	mov    %esp,%ebp
+  801e91:	57                   	push   %edi
+  801e92:	56                   	push   %esi
+  801e93:	53                   	push   %ebx
+  801e94:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  801e97:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  801e9d:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  801e9f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  801ea4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ea9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  801eb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb5:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  801eb8:	eb 18                	jmp    801ed2 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  801eba:	f7 d0                	not    %eax
+  801ebc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801ec1:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  801ec3:	83 c2 01             	add    $0x1,%edx
+  801ec6:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  801ecc:	0f 87 13 01 00 00    	ja     801fe5 <nfu+0x157>
+		++num_searched_ptes;
+  801ed2:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  801ed6:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  801ed9:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  801ede:	89 c1                	mov    %eax,%ecx
+  801ee0:	c1 e9 0a             	shr    $0xa,%ecx
+  801ee3:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  801eea:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  801ef0:	83 f9 01             	cmp    $0x1,%ecx
+  801ef3:	75 c5                	jne    801eba <nfu+0x2c>
+  801ef5:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  801efa:	77 be                	ja     801eba <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  801efc:	89 c1                	mov    %eax,%ecx
+  801efe:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  801f01:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  801f07:	0f 82 a5 00 00 00    	jb     801fb2 <nfu+0x124>
+  801f0d:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  801f13:	0f 87 99 00 00 00    	ja     801fb2 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  801f19:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  801f20:	f6 c1 01             	test   $0x1,%cl
+  801f23:	0f 84 89 00 00 00    	je     801fb2 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  801f29:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  801f30:	f6 c5 04             	test   $0x4,%ch
+  801f33:	75 7d                	jne    801fb2 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  801f35:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  801f3c:	f6 c5 02             	test   $0x2,%ch
+  801f3f:	75 71                	jne    801fb2 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  801f41:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801f48:	c1 e9 0c             	shr    $0xc,%ecx
+  801f4b:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  801f4e:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  801f54:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  801f58:	66 83 f9 01          	cmp    $0x1,%cx
+  801f5c:	77 54                	ja     801fb2 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  801f5e:	89 f9                	mov    %edi,%ecx
+  801f60:	80 f9 ff             	cmp    $0xff,%cl
+  801f63:	74 21                	je     801f86 <nfu+0xf8>
+  801f65:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801f6c:	c1 e9 0c             	shr    $0xc,%ecx
+  801f6f:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  801f72:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  801f78:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  801f7c:	89 fb                	mov    %edi,%ebx
+  801f7e:	38 d9                	cmp    %bl,%cl
+  801f80:	73 30                	jae    801fb2 <nfu+0x124>
+  801f82:	dd d8                	fstp   %st(0)
+  801f84:	eb 02                	jmp    801f88 <nfu+0xfa>
+  801f86:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  801f88:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801f8f:	c1 e9 0c             	shr    $0xc,%ecx
+  801f92:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  801f95:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  801f9c:	89 fb                	mov    %edi,%ebx
+  801f9e:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  801fa1:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801fa4:	db 45 e0             	fildl  -0x20(%ebp)
+  801fa7:	d8 35 b0 52 80 00    	fdivs  0x8052b0
+	return ret*ret;
+  801fad:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  801faf:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  801fb2:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  801fb5:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  801fb8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801fbf:	df 6d e0             	fildll -0x20(%ebp)
+  801fc2:	d9 c1                	fld    %st(1)
+  801fc4:	d8 0d b4 52 80 00    	fmuls  0x8052b4
+  801fca:	d9 c9                	fxch   %st(1)
+  801fcc:	df f1                	fcomip %st(1),%st
+  801fce:	dd d8                	fstp   %st(0)
+  801fd0:	0f 82 ed fe ff ff    	jb     801ec3 <nfu+0x35>
+  801fd6:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  801fd8:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  801fdd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  801fe0:	c1 e0 0c             	shl    $0xc,%eax
+  801fe3:	eb 0e                	jmp    801ff3 <nfu+0x165>
+  801fe5:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  801fe7:	89 f8                	mov    %edi,%eax
+  801fe9:	3c ff                	cmp    $0xff,%al
+  801feb:	74 0e                	je     801ffb <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  801fed:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  801ff0:	c1 e0 0c             	shl    $0xc,%eax
+}
+  801ff3:	83 c4 14             	add    $0x14,%esp
+  801ff6:	5b                   	pop    %ebx
+  801ff7:	5e                   	pop    %esi
+  801ff8:	5f                   	pop    %edi
+  801ff9:	5d                   	pop    %ebp
+  801ffa:	c3                   	ret
+	pgnum = 0;
+  801ffb:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  802002:	00 00 00 
+	return (void*)UTOP;
+  802005:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80200a:	eb e7                	jmp    801ff3 <nfu+0x165>
+
+0080200c <lru>:
+{
+  80200c:	55                   	push   %ebp
+  80200d:	89 e5                	mov    %esp,%ebp
+  80200f:	57                   	push   %edi
+  802010:	56                   	push   %esi
+  802011:	53                   	push   %ebx
+  802012:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802015:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  80201b:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  802022:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802029:	be 00 00 00 00       	mov    $0x0,%esi
+  80202e:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802035:	ba 00 00 00 00       	mov    $0x0,%edx
+  80203a:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  80203d:	eb 18                	jmp    802057 <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80203f:	f7 d0                	not    %eax
+  802041:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802046:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802048:	83 c2 01             	add    $0x1,%edx
+  80204b:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802051:	0f 87 fa 00 00 00    	ja     802151 <lru+0x145>
+		++num_searched_ptes;
+  802057:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80205a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80205d:	01 d0                	add    %edx,%eax
+  80205f:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802064:	89 c1                	mov    %eax,%ecx
+  802066:	c1 e9 0a             	shr    $0xa,%ecx
+  802069:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802070:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802076:	83 f9 01             	cmp    $0x1,%ecx
+  802079:	75 c4                	jne    80203f <lru+0x33>
+  80207b:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802080:	77 bd                	ja     80203f <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802082:	89 c1                	mov    %eax,%ecx
+  802084:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802087:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  80208d:	0f 87 92 00 00 00    	ja     802125 <lru+0x119>
+  802093:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802099:	0f 82 86 00 00 00    	jb     802125 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80209f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8020a6:	f6 c1 01             	test   $0x1,%cl
+  8020a9:	74 7a                	je     802125 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8020ab:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8020b2:	f6 c5 04             	test   $0x4,%ch
+  8020b5:	75 6e                	jne    802125 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8020b7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8020be:	f6 c5 02             	test   $0x2,%ch
+  8020c1:	75 62                	jne    802125 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8020c3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8020ca:	c1 e9 0c             	shr    $0xc,%ecx
+  8020cd:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8020d0:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8020d6:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8020da:	66 83 f9 01          	cmp    $0x1,%cx
+  8020de:	77 45                	ja     802125 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  8020e0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8020e7:	c1 e9 0c             	shr    $0xc,%ecx
+  8020ea:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8020ed:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8020f3:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8020f6:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8020f9:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  8020fc:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8020ff:	19 df                	sbb    %ebx,%edi
+  802101:	7c 22                	jl     802125 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  802103:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80210a:	c1 e9 0c             	shr    $0xc,%ecx
+  80210d:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802110:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802116:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802119:	8b 49 10             	mov    0x10(%ecx),%ecx
+  80211c:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  80211f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802122:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802125:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  802128:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80212f:	df 6d e0             	fildll -0x20(%ebp)
+  802132:	d9 05 b4 52 80 00    	flds   0x8052b4
+  802138:	d9 c9                	fxch   %st(1)
+  80213a:	df f1                	fcomip %st(1),%st
+  80213c:	dd d8                	fstp   %st(0)
+  80213e:	0f 82 04 ff ff ff    	jb     802048 <lru+0x3c>
+			pgnum = pgnum_actual;
+  802144:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  802149:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80214c:	c1 e0 0c             	shl    $0xc,%eax
+  80214f:	eb 06                	jmp    802157 <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  802151:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802154:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802157:	83 c4 1c             	add    $0x1c,%esp
+  80215a:	5b                   	pop    %ebx
+  80215b:	5e                   	pop    %esi
+  80215c:	5f                   	pop    %edi
+  80215d:	5d                   	pop    %ebp
+  80215e:	c3                   	ret
+
+0080215f <set_page_choice_func>:
+{
+  80215f:	55                   	push   %ebp
+  802160:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  802162:	8b 45 08             	mov    0x8(%ebp),%eax
+  802165:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  80216a:	5d                   	pop    %ebp
+  80216b:	c3                   	ret
+
+0080216c <get_page_choice>:
+{
+  80216c:	55                   	push   %ebp
+  80216d:	89 e5                	mov    %esp,%ebp
+  80216f:	57                   	push   %edi
+  802170:	56                   	push   %esi
+  802171:	53                   	push   %ebx
+  802172:	83 ec 24             	sub    $0x24,%esp
+  802175:	8b 75 08             	mov    0x8(%ebp),%esi
+  802178:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  80217b:	57                   	push   %edi
+  80217c:	56                   	push   %esi
+  80217d:	ff 15 3c 60 80 00    	call   *0x80603c
+  802183:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802185:	83 c4 10             	add    $0x10,%esp
+  802188:	eb 25                	jmp    8021af <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  80218a:	83 ec 08             	sub    $0x8,%esp
+  80218d:	c1 e0 16             	shl    $0x16,%eax
+  802190:	50                   	push   %eax
+  802191:	6a 00                	push   $0x0
+  802193:	e8 ec e0 ff ff       	call   800284 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802198:	83 c4 10             	add    $0x10,%esp
+  80219b:	85 c0                	test   %eax,%eax
+  80219d:	75 43                	jne    8021e2 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  80219f:	83 ec 08             	sub    $0x8,%esp
+  8021a2:	57                   	push   %edi
+  8021a3:	56                   	push   %esi
+  8021a4:	ff 15 3c 60 80 00    	call   *0x80603c
+  8021aa:	89 c3                	mov    %eax,%ebx
+  8021ac:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8021af:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8021b2:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8021b8:	0f 86 ae 00 00 00    	jbe    80226c <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  8021be:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  8021c3:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8021ca:	81 e2 81 00 00 00    	and    $0x81,%edx
+  8021d0:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  8021d6:	74 b2                	je     80218a <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  8021d8:	83 c0 01             	add    $0x1,%eax
+  8021db:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  8021e0:	75 e1                	jne    8021c3 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  8021e2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8021e5:	05 00 10 40 11       	add    $0x11401000,%eax
+  8021ea:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8021ef:	76 1f                	jbe    802210 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  8021f1:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  8021f6:	89 d8                	mov    %ebx,%eax
+  8021f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021fb:	5b                   	pop    %ebx
+  8021fc:	5e                   	pop    %esi
+  8021fd:	5f                   	pop    %edi
+  8021fe:	5d                   	pop    %ebp
+  8021ff:	c3                   	ret
+		sys_page_split(0, pg_out);
+  802200:	83 ec 08             	sub    $0x8,%esp
+  802203:	53                   	push   %ebx
+  802204:	6a 00                	push   $0x0
+  802206:	e8 79 e0 ff ff       	call   800284 <sys_page_split>
+  80220b:	83 c4 10             	add    $0x10,%esp
+  80220e:	eb 6c                	jmp    80227c <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  802210:	83 ec 04             	sub    $0x4,%esp
+  802213:	68 5c 4e 80 00       	push   $0x804e5c
+  802218:	68 cc 01 00 00       	push   $0x1cc
+  80221d:	68 ca 4d 80 00       	push   $0x804dca
+  802222:	e8 c8 19 00 00       	call   803bef <_panic>
+		panic("We tried to page out code pages\n");
+  802227:	83 ec 04             	sub    $0x4,%esp
+  80222a:	68 8c 4e 80 00       	push   $0x804e8c
+  80222f:	68 d6 01 00 00       	push   $0x1d6
+  802234:	68 ca 4d 80 00       	push   $0x804dca
+  802239:	e8 b1 19 00 00       	call   803bef <_panic>
+		panic("Invalid mapping for the va\n");
+  80223e:	83 ec 04             	sub    $0x4,%esp
+  802241:	68 d7 4d 80 00       	push   $0x804dd7
+  802246:	68 da 01 00 00       	push   $0x1da
+  80224b:	68 ca 4d 80 00       	push   $0x804dca
+  802250:	e8 9a 19 00 00       	call   803bef <_panic>
+		panic("We tried to page out a shared page\n");
+  802255:	83 ec 04             	sub    $0x4,%esp
+  802258:	68 b0 4e 80 00       	push   $0x804eb0
+  80225d:	68 e0 01 00 00       	push   $0x1e0
+  802262:	68 ca 4d 80 00       	push   $0x804dca
+  802267:	e8 83 19 00 00       	call   803bef <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  80226c:	89 de                	mov    %ebx,%esi
+  80226e:	c1 ee 16             	shr    $0x16,%esi
+  802271:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802278:	a8 80                	test   $0x80,%al
+  80227a:	75 84                	jne    802200 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  80227c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80227f:	05 00 10 40 11       	add    $0x11401000,%eax
+  802284:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802289:	76 85                	jbe    802210 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  80228b:	89 d8                	mov    %ebx,%eax
+  80228d:	e8 7e f3 ff ff       	call   801610 <page_is_clean>
+  802292:	84 c0                	test   %al,%al
+  802294:	0f 85 5c ff ff ff    	jne    8021f6 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  80229a:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  8022a1:	76 84                	jbe    802227 <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  8022a3:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8022aa:	a8 01                	test   $0x1,%al
+  8022ac:	74 90                	je     80223e <get_page_choice+0xd2>
+  8022ae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022b1:	c1 e8 0c             	shr    $0xc,%eax
+  8022b4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8022bb:	f6 c2 01             	test   $0x1,%dl
+  8022be:	0f 84 7a ff ff ff    	je     80223e <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  8022c4:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  8022cb:	f6 c2 01             	test   $0x1,%dl
+  8022ce:	74 85                	je     802255 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  8022d0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  8022d7:	f6 c2 01             	test   $0x1,%dl
+  8022da:	0f 84 75 ff ff ff    	je     802255 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8022e0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  8022e7:	f6 c6 04             	test   $0x4,%dh
+  8022ea:	0f 85 65 ff ff ff    	jne    802255 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  8022f0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8022f7:	f6 c6 02             	test   $0x2,%dh
+  8022fa:	0f 85 55 ff ff ff    	jne    802255 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  802300:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802307:	c1 e8 0c             	shr    $0xc,%eax
+  80230a:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80230d:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802312:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802316:	66 83 f8 01          	cmp    $0x1,%ax
+  80231a:	0f 86 d6 fe ff ff    	jbe    8021f6 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  802320:	83 ec 04             	sub    $0x4,%esp
+  802323:	68 d4 4e 80 00       	push   $0x804ed4
+  802328:	68 e2 01 00 00       	push   $0x1e2
+  80232d:	68 ca 4d 80 00       	push   $0x804dca
+  802332:	e8 b8 18 00 00       	call   803bef <_panic>
+
+00802337 <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  802337:	55                   	push   %ebp
+  802338:	89 e5                	mov    %esp,%ebp
+  80233a:	57                   	push   %edi
+  80233b:	56                   	push   %esi
+  80233c:	53                   	push   %ebx
+  80233d:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  802340:	e8 e8 f6 ff ff       	call   801a2d <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  802345:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80234a:	85 c0                	test   %eax,%eax
+  80234c:	74 41                	je     80238f <page_share_paged_out+0x58>
+  80234e:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  802355:	0f 84 fd 00 00 00    	je     802458 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  80235b:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802362:	00 00 00 
+  802365:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  80236c:	00 00 00 
+  80236f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802374:	eb 2c                	jmp    8023a2 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802376:	83 c3 04             	add    $0x4,%ebx
+  802379:	39 f3                	cmp    %esi,%ebx
+  80237b:	74 1a                	je     802397 <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  80237d:	8b 03                	mov    (%ebx),%eax
+  80237f:	a8 01                	test   $0x1,%al
+  802381:	74 f3                	je     802376 <page_share_paged_out+0x3f>
+  802383:	c1 e8 0c             	shr    $0xc,%eax
+  802386:	e8 2b f5 ff ff       	call   8018b6 <page_share_slot>
+  80238b:	85 c0                	test   %eax,%eax
+  80238d:	79 e7                	jns    802376 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  80238f:	83 c4 0c             	add    $0xc,%esp
+  802392:	5b                   	pop    %ebx
+  802393:	5e                   	pop    %esi
+  802394:	5f                   	pop    %edi
+  802395:	5d                   	pop    %ebp
+  802396:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  802397:	83 c7 04             	add    $0x4,%edi
+  80239a:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  8023a0:	74 1b                	je     8023bd <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  8023a2:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8023a7:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  8023aa:	f6 c3 01             	test   $0x1,%bl
+  8023ad:	74 e8                	je     802397 <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  8023af:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8023b5:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  8023bb:	eb bc                	jmp    802379 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8023bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023c2:	eb 11                	jmp    8023d5 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  8023c4:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8023ca:	83 c3 01             	add    $0x1,%ebx
+  8023cd:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8023d3:	77 41                	ja     802416 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  8023d5:	89 d8                	mov    %ebx,%eax
+  8023d7:	c1 e8 0a             	shr    $0xa,%eax
+  8023da:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8023e1:	25 81 00 00 00       	and    $0x81,%eax
+  8023e6:	83 f8 01             	cmp    $0x1,%eax
+  8023e9:	75 d9                	jne    8023c4 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  8023eb:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8023f2:	25 81 00 00 00       	and    $0x81,%eax
+  8023f7:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8023fc:	75 cc                	jne    8023ca <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  8023fe:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802405:	c1 e8 0c             	shr    $0xc,%eax
+  802408:	e8 a9 f4 ff ff       	call   8018b6 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  80240d:	85 c0                	test   %eax,%eax
+  80240f:	79 b9                	jns    8023ca <page_share_paged_out+0x93>
+  802411:	e9 79 ff ff ff       	jmp    80238f <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  802416:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80241d:	75 13                	jne    802432 <page_share_paged_out+0xfb>
+  80241f:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802426:	75 1d                	jne    802445 <page_share_paged_out+0x10e>
+	return 0;
+  802428:	b8 00 00 00 00       	mov    $0x0,%eax
+  80242d:	e9 5d ff ff ff       	jmp    80238f <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  802432:	b8 00 00 00 00       	mov    $0x0,%eax
+  802437:	e8 46 f4 ff ff       	call   801882 <page_share_send>
+  80243c:	85 c0                	test   %eax,%eax
+  80243e:	79 df                	jns    80241f <page_share_paged_out+0xe8>
+  802440:	e9 4a ff ff ff       	jmp    80238f <page_share_paged_out+0x58>
+  802445:	b8 01 00 00 00       	mov    $0x1,%eax
+  80244a:	e8 33 f4 ff ff       	call   801882 <page_share_send>
+  80244f:	85 c0                	test   %eax,%eax
+  802451:	79 d5                	jns    802428 <page_share_paged_out+0xf1>
+  802453:	e9 37 ff ff ff       	jmp    80238f <page_share_paged_out+0x58>
+		return 0;
+  802458:	b8 00 00 00 00       	mov    $0x0,%eax
+  80245d:	e9 2d ff ff ff       	jmp    80238f <page_share_paged_out+0x58>
+
+00802462 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  802462:	55                   	push   %ebp
+  802463:	89 e5                	mov    %esp,%ebp
+  802465:	56                   	push   %esi
+  802466:	53                   	push   %ebx
+  802467:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  80246a:	e8 be f5 ff ff       	call   801a2d <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  80246f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  802474:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  80247b:	0f 84 82 00 00 00    	je     802503 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  802481:	83 ec 0c             	sub    $0xc,%esp
+  802484:	68 00 10 00 00       	push   $0x1000
+  802489:	e8 84 11 00 00       	call   803612 <malloc>
+  80248e:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  802490:	83 c4 0c             	add    $0xc,%esp
+  802493:	6a 14                	push   $0x14
+  802495:	6a 00                	push   $0x0
+  802497:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80249a:	50                   	push   %eax
+  80249b:	e8 62 1f 00 00       	call   804402 <memset>
+  8024a0:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  8024a3:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  8024a8:	83 ec 0c             	sub    $0xc,%esp
+  8024ab:	6a 07                	push   $0x7
+  8024ad:	6a 01                	push   $0x1
+  8024af:	53                   	push   %ebx
+  8024b0:	6a 03                	push   $0x3
+  8024b2:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8024b9:	e8 79 24 00 00       	call   804937 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  8024be:	8b 03                	mov    (%ebx),%eax
+  8024c0:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  8024c3:	8b 43 04             	mov    0x4(%ebx),%eax
+  8024c6:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  8024c9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8024cc:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  8024cf:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8024d2:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  8024d5:	8b 43 10             	mov    0x10(%ebx),%eax
+  8024d8:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  8024db:	83 c6 01             	add    $0x1,%esi
+  8024de:	83 c4 20             	add    $0x20,%esp
+  8024e1:	83 fe 02             	cmp    $0x2,%esi
+  8024e4:	75 c2                	jne    8024a8 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  8024e6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024e9:	89 03                	mov    %eax,(%ebx)
+  8024eb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8024ee:	89 43 04             	mov    %eax,0x4(%ebx)
+  8024f1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8024f4:	89 43 08             	mov    %eax,0x8(%ebx)
+  8024f7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8024fa:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8024fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802500:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  802503:	89 d8                	mov    %ebx,%eax
+  802505:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802508:	5b                   	pop    %ebx
+  802509:	5e                   	pop    %esi
+  80250a:	5d                   	pop    %ebp
+  80250b:	c3                   	ret
+
+0080250c <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  80250c:	55                   	push   %ebp
+  80250d:	89 e5                	mov    %esp,%ebp
+  80250f:	53                   	push   %ebx
+  802510:	83 ec 10             	sub    $0x10,%esp
+  802513:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  802516:	68 f1 4d 80 00       	push   $0x804df1
+  80251b:	e8 aa 17 00 00       	call   803cca <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  802520:	83 c4 08             	add    $0x8,%esp
+  802523:	ff 33                	push   (%ebx)
+  802525:	68 08 4f 80 00       	push   $0x804f08
+  80252a:	e8 9b 17 00 00       	call   803cca <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  80252f:	83 c4 08             	add    $0x8,%esp
+  802532:	ff 73 04             	push   0x4(%ebx)
+  802535:	68 f3 4d 80 00       	push   $0x804df3
+  80253a:	e8 8b 17 00 00       	call   803cca <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  80253f:	83 c4 08             	add    $0x8,%esp
+  802542:	ff 73 08             	push   0x8(%ebx)
+  802545:	68 28 4f 80 00       	push   $0x804f28
+  80254a:	e8 7b 17 00 00       	call   803cca <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  80254f:	83 c4 08             	add    $0x8,%esp
+  802552:	ff 73 0c             	push   0xc(%ebx)
+  802555:	68 4c 4f 80 00       	push   $0x804f4c
+  80255a:	e8 6b 17 00 00       	call   803cca <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  80255f:	83 c4 08             	add    $0x8,%esp
+  802562:	ff 73 10             	push   0x10(%ebx)
+  802565:	68 70 4f 80 00       	push   $0x804f70
+  80256a:	e8 5b 17 00 00       	call   803cca <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  80256f:	83 c4 08             	add    $0x8,%esp
+  802572:	ff 35 08 b0 80 00    	push   0x80b008
+  802578:	68 ac 4f 80 00       	push   $0x804fac
+  80257d:	e8 48 17 00 00       	call   803cca <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  802582:	83 c4 08             	add    $0x8,%esp
+  802585:	ff 35 04 b0 80 00    	push   0x80b004
+  80258b:	68 e0 4f 80 00       	push   $0x804fe0
+  802590:	e8 35 17 00 00       	call   803cca <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  802595:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80259a:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  80259d:	8b 50 68             	mov    0x68(%eax),%edx
+  8025a0:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  8025a3:	51                   	push   %ecx
+  8025a4:	52                   	push   %edx
+  8025a5:	50                   	push   %eax
+  8025a6:	68 20 50 80 00       	push   $0x805020
+  8025ab:	e8 1a 17 00 00       	call   803cca <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  8025b0:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8025b5:	8b 40 70             	mov    0x70(%eax),%eax
+  8025b8:	83 c4 18             	add    $0x18,%esp
+  8025bb:	50                   	push   %eax
+  8025bc:	68 54 50 80 00       	push   $0x805054
+  8025c1:	e8 04 17 00 00       	call   803cca <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  8025c6:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  8025cc:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  8025d2:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  8025d7:	51                   	push   %ecx
+  8025d8:	52                   	push   %edx
+  8025d9:	50                   	push   %eax
+  8025da:	68 84 50 80 00       	push   $0x805084
+  8025df:	e8 e6 16 00 00       	call   803cca <cprintf>
+	cprintf("\n");
+  8025e4:	83 c4 14             	add    $0x14,%esp
+  8025e7:	68 f1 4d 80 00       	push   $0x804df1
+  8025ec:	e8 d9 16 00 00       	call   803cca <cprintf>
+}
+  8025f1:	83 c4 10             	add    $0x10,%esp
+  8025f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025f7:	c9                   	leave
+  8025f8:	c3                   	ret
+
+008025f9 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  8025f9:	55                   	push   %ebp
+  8025fa:	89 e5                	mov    %esp,%ebp
+  8025fc:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  8025ff:	e8 5e fe ff ff       	call   802462 <get_paging_stats>
+  802604:	83 ec 0c             	sub    $0xc,%esp
+  802607:	50                   	push   %eax
+  802608:	e8 ff fe ff ff       	call   80250c <print_paging_stats>
+}
+  80260d:	83 c4 10             	add    $0x10,%esp
+  802610:	c9                   	leave
+  802611:	c3                   	ret
+
+00802612 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  802612:	55                   	push   %ebp
+  802613:	89 e5                	mov    %esp,%ebp
+  802615:	53                   	push   %ebx
+  802616:	83 ec 04             	sub    $0x4,%esp
+  802619:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  80261c:	eb 13                	jmp    802631 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  80261e:	83 ec 04             	sub    $0x4,%esp
+  802621:	6a ff                	push   $0xffffffff
+  802623:	53                   	push   %ebx
+  802624:	68 00 f0 ff ee       	push   $0xeefff000
+  802629:	e8 68 e0 ff ff       	call   800696 <sys_futex_wait>
+  80262e:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  802631:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  802636:	39 d8                	cmp    %ebx,%eax
+  802638:	74 e4                	je     80261e <mem_pressure_wait+0xc>
+	return now;
+}
+  80263a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80263d:	c9                   	leave
+  80263e:	c3                   	ret
+
+0080263f <init_map_dir>:
+
+void
+init_map_dir()
+{
+  80263f:	55                   	push   %ebp
+  802640:	89 e5                	mov    %esp,%ebp
+  802642:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  802645:	68 b1 32 80 00       	push   $0x8032b1
+  80264a:	e8 f4 20 00 00       	call   804743 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  80264f:	c7 05 14 e9 80 00 00 	movl   $0xdeadb000,0x80e914
+  802656:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  802659:	83 c4 0c             	add    $0xc,%esp
+  80265c:	68 07 02 00 00       	push   $0x207
+  802661:	68 00 b0 ad de       	push   $0xdeadb000
+  802666:	6a 00                	push   $0x0
+  802668:	e8 50 db ff ff       	call   8001bd <sys_page_alloc>
+  80266d:	83 c4 10             	add    $0x10,%esp
+  802670:	85 c0                	test   %eax,%eax
+  802672:	78 0c                	js     802680 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  802674:	e8 b4 f3 ff ff       	call   801a2d <find_paging_env>
+	page_ring_ready();
+  802679:	e8 7f f2 ff ff       	call   8018fd <page_ring_ready>
+}
+  80267e:	c9                   	leave
+  80267f:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  802680:	50                   	push   %eax
+  802681:	68 11 4e 80 00       	push   $0x804e11
+  802686:	68 13 05 00 00       	push   $0x513
+  80268b:	68 ca 4d 80 00       	push   $0x804dca
+  802690:	e8 5a 15 00 00       	call   803bef <_panic>
+
+00802695 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  802695:	55                   	push   %ebp
+  802696:	89 e5                	mov    %esp,%ebp
+  802698:	57                   	push   %edi
+  802699:	56                   	push   %esi
+  80269a:	53                   	push   %ebx
+  80269b:	83 ec 0c             	sub    $0xc,%esp
+  80269e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  8026a1:	89 fa                	mov    %edi,%edx
+  8026a3:	c1 ea 16             	shr    $0x16,%edx
+  8026a6:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8026ab:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  8026ae:	f6 06 01             	testb  $0x1,(%esi)
+  8026b1:	75 3e                	jne    8026f1 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  8026b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  8026b8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8026bc:	74 47                	je     802705 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  8026be:	83 ec 0c             	sub    $0xc,%esp
+  8026c1:	6a 01                	push   $0x1
+  8026c3:	e8 f2 11 00 00       	call   8038ba <va_alloc>
+  8026c8:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  8026ca:	83 c4 10             	add    $0x10,%esp
+  8026cd:	85 c0                	test   %eax,%eax
+  8026cf:	74 34                	je     802705 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  8026d1:	6a 00                	push   $0x0
+  8026d3:	68 07 02 00 00       	push   $0x207
+  8026d8:	50                   	push   %eax
+  8026d9:	6a 00                	push   $0x0
+  8026db:	e8 df 02 00 00       	call   8029bf <page_alloc>
+  8026e0:	83 c4 10             	add    $0x10,%esp
+  8026e3:	85 c0                	test   %eax,%eax
+  8026e5:	78 28                	js     80270f <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  8026e7:	f6 06 01             	testb  $0x1,(%esi)
+  8026ea:	75 38                	jne    802724 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  8026ec:	83 cb 01             	or     $0x1,%ebx
+  8026ef:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  8026f1:	89 f8                	mov    %edi,%eax
+  8026f3:	c1 e8 0a             	shr    $0xa,%eax
+  8026f6:	25 fc 0f 00 00       	and    $0xffc,%eax
+  8026fb:	8b 1e                	mov    (%esi),%ebx
+  8026fd:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802703:	01 c3                	add    %eax,%ebx
+}
+  802705:	89 d8                	mov    %ebx,%eax
+  802707:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80270a:	5b                   	pop    %ebx
+  80270b:	5e                   	pop    %esi
+  80270c:	5f                   	pop    %edi
+  80270d:	5d                   	pop    %ebp
+  80270e:	c3                   	ret
+			va_free(page, 1);
+  80270f:	83 ec 08             	sub    $0x8,%esp
+  802712:	6a 01                	push   $0x1
+  802714:	53                   	push   %ebx
+  802715:	e8 d8 12 00 00       	call   8039f2 <va_free>
+			return NULL;
+  80271a:	83 c4 10             	add    $0x10,%esp
+  80271d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802722:	eb e1                	jmp    802705 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  802724:	83 ec 08             	sub    $0x8,%esp
+  802727:	53                   	push   %ebx
+  802728:	6a 00                	push   $0x0
+  80272a:	e8 13 db ff ff       	call   800242 <sys_page_unmap>
+			va_free(page, 1);
+  80272f:	83 c4 08             	add    $0x8,%esp
+  802732:	6a 01                	push   $0x1
+  802734:	53                   	push   %ebx
+  802735:	e8 b8 12 00 00       	call   8039f2 <va_free>
+  80273a:	83 c4 10             	add    $0x10,%esp
+  80273d:	eb b2                	jmp    8026f1 <umapdir_walk+0x5c>
+
+0080273f <page_out>:
+{
+  80273f:	55                   	push   %ebp
+  802740:	89 e5                	mov    %esp,%ebp
+  802742:	57                   	push   %edi
+  802743:	56                   	push   %esi
+  802744:	53                   	push   %ebx
+  802745:	83 ec 5c             	sub    $0x5c,%esp
+  802748:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  80274b:	e8 dd f2 ff ff       	call   801a2d <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  802750:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802755:	85 c0                	test   %eax,%eax
+  802757:	74 1e                	je     802777 <page_out+0x38>
+  802759:	83 ec 0c             	sub    $0xc,%esp
+  80275c:	6a 00                	push   $0x0
+  80275e:	6a 00                	push   $0x0
+  802760:	6a 00                	push   $0x0
+  802762:	6a 08                	push   $0x8
+  802764:	50                   	push   %eax
+  802765:	e8 cd 21 00 00       	call   804937 <ipc_call>
+  80276a:	89 c3                	mov    %eax,%ebx
+  80276c:	83 c4 20             	add    $0x20,%esp
+  80276f:	85 c0                	test   %eax,%eax
+  802771:	0f 84 ac 00 00 00    	je     802823 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  802777:	83 ec 08             	sub    $0x8,%esp
+  80277a:	ff 75 0c             	push   0xc(%ebp)
+  80277d:	57                   	push   %edi
+  80277e:	e8 e9 f9 ff ff       	call   80216c <get_page_choice>
+  802783:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  802785:	83 c4 10             	add    $0x10,%esp
+  802788:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  80278d:	0f 84 18 02 00 00    	je     8029ab <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  802793:	e8 78 ee ff ff       	call   801610 <page_is_clean>
+  802798:	84 c0                	test   %al,%al
+  80279a:	0f 85 8c 00 00 00    	jne    80282c <page_out+0xed>
+	if (pagingenv == 0)
+  8027a0:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8027a7:	0f 84 08 02 00 00    	je     8029b5 <page_out+0x276>
+	if (page_ring_ready())
+  8027ad:	e8 4b f1 ff ff       	call   8018fd <page_ring_ready>
+  8027b2:	89 c3                	mov    %eax,%ebx
+  8027b4:	85 c0                	test   %eax,%eax
+  8027b6:	0f 85 89 00 00 00    	jne    802845 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  8027bc:	83 ec 0c             	sub    $0xc,%esp
+  8027bf:	6a 05                	push   $0x5
+  8027c1:	6a 01                	push   $0x1
+  8027c3:	56                   	push   %esi
+  8027c4:	6a 01                	push   $0x1
+  8027c6:	ff 35 40 b0 80 00    	push   0x80b040
+  8027cc:	e8 66 21 00 00       	call   804937 <ipc_call>
+  8027d1:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  8027d3:	83 c4 20             	add    $0x20,%esp
+  8027d6:	85 c0                	test   %eax,%eax
+  8027d8:	0f 88 b8 01 00 00    	js     802996 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  8027de:	89 f0                	mov    %esi,%eax
+  8027e0:	c1 e8 0c             	shr    $0xc,%eax
+  8027e3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8027ea:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  8027ed:	83 ec 08             	sub    $0x8,%esp
+  8027f0:	56                   	push   %esi
+  8027f1:	6a 00                	push   $0x0
+  8027f3:	e8 4a da ff ff       	call   800242 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  8027f8:	83 c4 08             	add    $0x8,%esp
+  8027fb:	6a 01                	push   $0x1
+  8027fd:	56                   	push   %esi
+  8027fe:	e8 92 fe ff ff       	call   802695 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  802803:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  802806:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  80280c:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  80280f:	09 fe                	or     %edi,%esi
+  802811:	83 ce 01             	or     $0x1,%esi
+  802814:	89 30                	mov    %esi,(%eax)
+	return 0;
+  802816:	83 c4 10             	add    $0x10,%esp
+}
+  802819:	89 d8                	mov    %ebx,%eax
+  80281b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80281e:	5b                   	pop    %ebx
+  80281f:	5e                   	pop    %esi
+  802820:	5f                   	pop    %edi
+  802821:	5d                   	pop    %ebp
+  802822:	c3                   	ret
+		num_page_reclaims++;
+  802823:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  80282a:	eb ed                	jmp    802819 <page_out+0xda>
+		num_page_drops++;
+  80282c:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  802833:	83 ec 08             	sub    $0x8,%esp
+  802836:	56                   	push   %esi
+  802837:	6a 00                	push   $0x0
+  802839:	e8 04 da ff ff       	call   800242 <sys_page_unmap>
+  80283e:	89 c3                	mov    %eax,%ebx
+  802840:	83 c4 10             	add    $0x10,%esp
+  802843:	eb d4                	jmp    802819 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  802845:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  802847:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80284c:	2d 00 10 00 00       	sub    $0x1000,%eax
+  802851:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  802854:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  802856:	83 c0 08             	add    $0x8,%eax
+  802859:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  80285c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802861:	e8 e5 ef ff ff       	call   80184b <page_ring_reserve>
+	first = ring->sq_tail;
+  802866:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80286b:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  80286e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  802873:	83 ec 04             	sub    $0x4,%esp
+  802876:	68 00 10 00 00       	push   $0x1000
+  80287b:	56                   	push   %esi
+  80287c:	89 d8                	mov    %ebx,%eax
+  80287e:	c1 e0 0c             	shl    $0xc,%eax
+  802881:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  802886:	50                   	push   %eax
+  802887:	e8 0d 1c 00 00       	call   804499 <memcpy>
+		vas[n] = va;
+  80288c:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  802890:	89 d9                	mov    %ebx,%ecx
+  802892:	ba 00 00 00 00       	mov    $0x0,%edx
+  802897:	b8 01 00 00 00       	mov    $0x1,%eax
+  80289c:	e8 de ee ff ff       	call   80177f <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  8028a1:	8d 43 01             	lea    0x1(%ebx),%eax
+  8028a4:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  8028a7:	83 c4 10             	add    $0x10,%esp
+  8028aa:	83 fb 06             	cmp    $0x6,%ebx
+  8028ad:	74 62                	je     802911 <page_out+0x1d2>
+  8028af:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8028b2:	eb 15                	jmp    8028c9 <page_out+0x18a>
+			num_page_drops++;
+  8028b4:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  8028bb:	83 ec 08             	sub    $0x8,%esp
+  8028be:	56                   	push   %esi
+  8028bf:	6a 00                	push   $0x0
+  8028c1:	e8 7c d9 ff ff       	call   800242 <sys_page_unmap>
+  8028c6:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  8028c9:	83 ec 08             	sub    $0x8,%esp
+  8028cc:	53                   	push   %ebx
+  8028cd:	57                   	push   %edi
+  8028ce:	e8 99 f8 ff ff       	call   80216c <get_page_choice>
+  8028d3:	89 c6                	mov    %eax,%esi
+  8028d5:	83 c4 10             	add    $0x10,%esp
+  8028d8:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8028dd:	74 32                	je     802911 <page_out+0x1d2>
+  8028df:	e8 2c ed ff ff       	call   801610 <page_is_clean>
+  8028e4:	84 c0                	test   %al,%al
+  8028e6:	75 cc                	jne    8028b4 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  8028e8:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  8028eb:	39 c6                	cmp    %eax,%esi
+  8028ed:	72 07                	jb     8028f6 <page_out+0x1b7>
+  8028ef:	8b 45 98             	mov    -0x68(%ebp),%eax
+  8028f2:	39 c6                	cmp    %eax,%esi
+  8028f4:	72 1b                	jb     802911 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  8028f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028fb:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  8028fe:	eb 03                	jmp    802903 <page_out+0x1c4>
+  802900:	83 c3 01             	add    $0x1,%ebx
+  802903:	39 da                	cmp    %ebx,%edx
+  802905:	0f 84 68 ff ff ff    	je     802873 <page_out+0x134>
+  80290b:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  80290f:	75 ef                	jne    802900 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  802911:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  802914:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  802917:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  80291a:	e8 a6 ee ff ff       	call   8017c5 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  80291f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802924:	eb 42                	jmp    802968 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  802926:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  80292a:	89 f8                	mov    %edi,%eax
+  80292c:	c1 e8 0c             	shr    $0xc,%eax
+  80292f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802936:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  802939:	83 ec 08             	sub    $0x8,%esp
+  80293c:	57                   	push   %edi
+  80293d:	6a 00                	push   $0x0
+  80293f:	e8 fe d8 ff ff       	call   800242 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  802944:	83 c4 08             	add    $0x8,%esp
+  802947:	6a 01                	push   $0x1
+  802949:	57                   	push   %edi
+  80294a:	e8 46 fd ff ff       	call   802695 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  80294f:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  802952:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  802958:	c1 e6 0c             	shl    $0xc,%esi
+  80295b:	09 d6                	or     %edx,%esi
+  80295d:	83 ce 01             	or     $0x1,%esi
+  802960:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  802962:	83 c3 01             	add    $0x1,%ebx
+  802965:	83 c4 10             	add    $0x10,%esp
+  802968:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  80296b:	39 c3                	cmp    %eax,%ebx
+  80296d:	74 1d                	je     80298c <page_out+0x24d>
+		if (res[i] < 0)
+  80296f:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  802973:	85 f6                	test   %esi,%esi
+  802975:	79 af                	jns    802926 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  802977:	56                   	push   %esi
+  802978:	68 b4 50 80 00       	push   $0x8050b4
+  80297d:	68 d1 02 00 00       	push   $0x2d1
+  802982:	68 ca 4d 80 00       	push   $0x804dca
+  802987:	e8 63 12 00 00       	call   803bef <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  80298c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802991:	e9 83 fe ff ff       	jmp    802819 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  802996:	50                   	push   %eax
+  802997:	68 b4 50 80 00       	push   $0x8050b4
+  80299c:	68 0a 03 00 00       	push   $0x30a
+  8029a1:	68 ca 4d 80 00       	push   $0x804dca
+  8029a6:	e8 44 12 00 00       	call   803bef <_panic>
+		return -E_NO_MEM;
+  8029ab:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  8029b0:	e9 64 fe ff ff       	jmp    802819 <page_out+0xda>
+		return -E_PAGING;
+  8029b5:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8029ba:	e9 5a fe ff ff       	jmp    802819 <page_out+0xda>
+
+008029bf <page_alloc>:
+{
+  8029bf:	55                   	push   %ebp
+  8029c0:	89 e5                	mov    %esp,%ebp
+  8029c2:	57                   	push   %edi
+  8029c3:	56                   	push   %esi
+  8029c4:	53                   	push   %ebx
+  8029c5:	83 ec 0c             	sub    $0xc,%esp
+  8029c8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8029cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  8029ce:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  8029d5:	74 34                	je     802a0b <page_alloc+0x4c>
+	if (check_mte)
+  8029d7:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8029db:	75 35                	jne    802a12 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  8029dd:	83 ec 04             	sub    $0x4,%esp
+  8029e0:	ff 75 10             	push   0x10(%ebp)
+  8029e3:	56                   	push   %esi
+  8029e4:	57                   	push   %edi
+  8029e5:	e8 d3 d7 ff ff       	call   8001bd <sys_page_alloc>
+  8029ea:	89 c3                	mov    %eax,%ebx
+  8029ec:	83 c4 10             	add    $0x10,%esp
+  8029ef:	85 c0                	test   %eax,%eax
+  8029f1:	79 52                	jns    802a45 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  8029f3:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8029f6:	75 52                	jne    802a4a <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  8029f8:	83 ec 08             	sub    $0x8,%esp
+  8029fb:	56                   	push   %esi
+  8029fc:	57                   	push   %edi
+  8029fd:	e8 3d fd ff ff       	call   80273f <page_out>
+  802a02:	83 c4 10             	add    $0x10,%esp
+  802a05:	85 c0                	test   %eax,%eax
+  802a07:	79 d4                	jns    8029dd <page_alloc+0x1e>
+  802a09:	eb 3f                	jmp    802a4a <page_alloc+0x8b>
+		init_map_dir();
+  802a0b:	e8 2f fc ff ff       	call   80263f <init_map_dir>
+  802a10:	eb c5                	jmp    8029d7 <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  802a12:	83 ec 08             	sub    $0x8,%esp
+  802a15:	6a 00                	push   $0x0
+  802a17:	56                   	push   %esi
+  802a18:	e8 78 fc ff ff       	call   802695 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  802a1d:	83 c4 10             	add    $0x10,%esp
+  802a20:	85 c0                	test   %eax,%eax
+  802a22:	74 b9                	je     8029dd <page_alloc+0x1e>
+  802a24:	8b 10                	mov    (%eax),%edx
+  802a26:	f6 c2 01             	test   $0x1,%dl
+  802a29:	74 b2                	je     8029dd <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  802a2b:	83 ec 08             	sub    $0x8,%esp
+  802a2e:	56                   	push   %esi
+  802a2f:	52                   	push   %edx
+  802a30:	50                   	push   %eax
+  802a31:	68 d8 50 80 00       	push   $0x8050d8
+  802a36:	68 34 03 00 00       	push   $0x334
+  802a3b:	68 ca 4d 80 00       	push   $0x804dca
+  802a40:	e8 aa 11 00 00       	call   803bef <_panic>
+	return 0;
+  802a45:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802a4a:	89 d8                	mov    %ebx,%eax
+  802a4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a4f:	5b                   	pop    %ebx
+  802a50:	5e                   	pop    %esi
+  802a51:	5f                   	pop    %edi
+  802a52:	5d                   	pop    %ebp
+  802a53:	c3                   	ret
+
+00802a54 <page_adopt>:
+{
+  802a54:	55                   	push   %ebp
+  802a55:	89 e5                	mov    %esp,%ebp
+  802a57:	56                   	push   %esi
+  802a58:	53                   	push   %ebx
+  802a59:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  802a5b:	c1 e8 16             	shr    $0x16,%eax
+  802a5e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802a65:	25 81 00 00 00       	and    $0x81,%eax
+  802a6a:	83 f8 01             	cmp    $0x1,%eax
+  802a6d:	75 53                	jne    802ac2 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  802a6f:	89 d8                	mov    %ebx,%eax
+  802a71:	c1 e8 0c             	shr    $0xc,%eax
+  802a74:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  802a7b:	89 f2                	mov    %esi,%edx
+  802a7d:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  802a83:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  802a88:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  802a8e:	75 37                	jne    802ac7 <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  802a90:	83 ec 08             	sub    $0x8,%esp
+  802a93:	6a 01                	push   $0x1
+  802a95:	53                   	push   %ebx
+  802a96:	e8 fa fb ff ff       	call   802695 <umapdir_walk>
+  802a9b:	83 c4 10             	add    $0x10,%esp
+  802a9e:	85 c0                	test   %eax,%eax
+  802aa0:	74 2c                	je     802ace <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  802aa2:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  802aa8:	83 ce 01             	or     $0x1,%esi
+  802aab:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  802aad:	83 ec 08             	sub    $0x8,%esp
+  802ab0:	53                   	push   %ebx
+  802ab1:	6a 00                	push   $0x0
+  802ab3:	e8 8a d7 ff ff       	call   800242 <sys_page_unmap>
+	return 1;
+  802ab8:	83 c4 10             	add    $0x10,%esp
+  802abb:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ac0:	eb 05                	jmp    802ac7 <page_adopt+0x73>
+		return 0;
+  802ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ac7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802aca:	5b                   	pop    %ebx
+  802acb:	5e                   	pop    %esi
+  802acc:	5d                   	pop    %ebp
+  802acd:	c3                   	ret
+		return -E_NO_MEM;
+  802ace:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802ad3:	eb f2                	jmp    802ac7 <page_adopt+0x73>
+
+00802ad5 <page_forget>:
+{
+  802ad5:	55                   	push   %ebp
+  802ad6:	89 e5                	mov    %esp,%ebp
+  802ad8:	53                   	push   %ebx
+  802ad9:	83 ec 04             	sub    $0x4,%esp
+  802adc:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  802ade:	e8 4a ef ff ff       	call   801a2d <find_paging_env>
+	if (pagingenv == 0)
+  802ae3:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  802aea:	74 39                	je     802b25 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  802aec:	89 d8                	mov    %ebx,%eax
+  802aee:	c1 e8 16             	shr    $0x16,%eax
+  802af1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802af8:	25 81 00 00 00       	and    $0x81,%eax
+  802afd:	83 f8 01             	cmp    $0x1,%eax
+  802b00:	74 28                	je     802b2a <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  802b02:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  802b09:	74 1a                	je     802b25 <page_forget+0x50>
+  802b0b:	83 ec 08             	sub    $0x8,%esp
+  802b0e:	6a 00                	push   $0x0
+  802b10:	53                   	push   %ebx
+  802b11:	e8 7f fb ff ff       	call   802695 <umapdir_walk>
+  802b16:	89 c3                	mov    %eax,%ebx
+  802b18:	83 c4 10             	add    $0x10,%esp
+  802b1b:	85 c0                	test   %eax,%eax
+  802b1d:	74 06                	je     802b25 <page_forget+0x50>
+  802b1f:	8b 00                	mov    (%eax),%eax
+  802b21:	a8 01                	test   $0x1,%al
+  802b23:	75 2b                	jne    802b50 <page_forget+0x7b>
+}
+  802b25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b28:	c9                   	leave
+  802b29:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  802b2a:	89 d8                	mov    %ebx,%eax
+  802b2c:	c1 e8 0c             	shr    $0xc,%eax
+  802b2f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802b36:	89 c2                	mov    %eax,%edx
+  802b38:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  802b3e:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  802b44:	75 bc                	jne    802b02 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  802b46:	c1 e8 0c             	shr    $0xc,%eax
+  802b49:	e8 5c ee ff ff       	call   8019aa <page_remove_slot>
+		return;
+  802b4e:	eb d5                	jmp    802b25 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  802b50:	c1 e8 0c             	shr    $0xc,%eax
+  802b53:	e8 52 ee ff ff       	call   8019aa <page_remove_slot>
+	*mte = 0;
+  802b58:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802b5e:	eb c5                	jmp    802b25 <page_forget+0x50>
+
+00802b60 <page_unmap>:
+{
+  802b60:	55                   	push   %ebp
+  802b61:	89 e5                	mov    %esp,%ebp
+  802b63:	57                   	push   %edi
+  802b64:	56                   	push   %esi
+  802b65:	53                   	push   %ebx
+  802b66:	83 ec 0c             	sub    $0xc,%esp
+  802b69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b6c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  802b6f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802b74:	8b 40 48             	mov    0x48(%eax),%eax
+  802b77:	85 db                	test   %ebx,%ebx
+  802b79:	0f 8e b4 00 00 00    	jle    802c33 <page_unmap+0xd3>
+  802b7f:	39 d8                	cmp    %ebx,%eax
+  802b81:	0f 84 ac 00 00 00    	je     802c33 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  802b87:	83 ec 08             	sub    $0x8,%esp
+  802b8a:	57                   	push   %edi
+  802b8b:	53                   	push   %ebx
+  802b8c:	e8 b1 d6 ff ff       	call   800242 <sys_page_unmap>
+  802b91:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  802b93:	e8 95 ee ff ff       	call   801a2d <find_paging_env>
+	if (pagingenv == 0)
+  802b98:	83 c4 10             	add    $0x10,%esp
+  802b9b:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  802ba2:	0f 84 a1 00 00 00    	je     802c49 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  802ba8:	83 ec 0c             	sub    $0xc,%esp
+  802bab:	6a 05                	push   $0x5
+  802bad:	68 00 00 40 00       	push   $0x400000
+  802bb2:	6a 00                	push   $0x0
+  802bb4:	68 00 b0 ad de       	push   $0xdeadb000
+  802bb9:	53                   	push   %ebx
+  802bba:	e8 41 d6 ff ff       	call   800200 <sys_page_map>
+  802bbf:	83 c4 20             	add    $0x20,%esp
+  802bc2:	85 c0                	test   %eax,%eax
+  802bc4:	0f 88 89 00 00 00    	js     802c53 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  802bca:	89 f8                	mov    %edi,%eax
+  802bcc:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  802bcf:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  802bd6:	a8 01                	test   $0x1,%al
+  802bd8:	74 6f                	je     802c49 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  802bda:	83 ec 0c             	sub    $0xc,%esp
+  802bdd:	6a 05                	push   $0x5
+  802bdf:	68 00 00 40 00       	push   $0x400000
+  802be4:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  802be6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  802beb:	50                   	push   %eax
+  802bec:	53                   	push   %ebx
+  802bed:	e8 0e d6 ff ff       	call   800200 <sys_page_map>
+  802bf2:	83 c4 20             	add    $0x20,%esp
+  802bf5:	85 c0                	test   %eax,%eax
+  802bf7:	78 6f                	js     802c68 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  802bf9:	c1 ef 0c             	shr    $0xc,%edi
+  802bfc:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  802c02:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  802c09:	01 
+  802c0a:	74 3d                	je     802c49 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  802c0c:	83 ec 08             	sub    $0x8,%esp
+  802c0f:	68 00 00 40 00       	push   $0x400000
+  802c14:	6a 00                	push   $0x0
+  802c16:	e8 27 d6 ff ff       	call   800242 <sys_page_unmap>
+  802c1b:	83 c4 10             	add    $0x10,%esp
+  802c1e:	85 c0                	test   %eax,%eax
+  802c20:	78 5b                	js     802c7d <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  802c22:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  802c29:	c1 e8 0c             	shr    $0xc,%eax
+  802c2c:	e8 79 ed ff ff       	call   8019aa <page_remove_slot>
+	return r;
+  802c31:	eb 16                	jmp    802c49 <page_unmap+0xe9>
+		page_forget(va);
+  802c33:	89 f8                	mov    %edi,%eax
+  802c35:	e8 9b fe ff ff       	call   802ad5 <page_forget>
+		return sys_page_unmap(envid, va);
+  802c3a:	83 ec 08             	sub    $0x8,%esp
+  802c3d:	57                   	push   %edi
+  802c3e:	53                   	push   %ebx
+  802c3f:	e8 fe d5 ff ff       	call   800242 <sys_page_unmap>
+  802c44:	89 c6                	mov    %eax,%esi
+  802c46:	83 c4 10             	add    $0x10,%esp
+}
+  802c49:	89 f0                	mov    %esi,%eax
+  802c4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c4e:	5b                   	pop    %ebx
+  802c4f:	5e                   	pop    %esi
+  802c50:	5f                   	pop    %edi
+  802c51:	5d                   	pop    %ebp
+  802c52:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  802c53:	50                   	push   %eax
+  802c54:	68 14 51 80 00       	push   $0x805114
+  802c59:	68 e4 03 00 00       	push   $0x3e4
+  802c5e:	68 ca 4d 80 00       	push   $0x804dca
+  802c63:	e8 87 0f 00 00       	call   803bef <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  802c68:	50                   	push   %eax
+  802c69:	68 40 51 80 00       	push   $0x805140
+  802c6e:	68 ea 03 00 00       	push   $0x3ea
+  802c73:	68 ca 4d 80 00       	push   $0x804dca
+  802c78:	e8 72 0f 00 00       	call   803bef <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  802c7d:	50                   	push   %eax
+  802c7e:	68 6c 51 80 00       	push   $0x80516c
+  802c83:	68 ef 03 00 00       	push   $0x3ef
+  802c88:	68 ca 4d 80 00       	push   $0x804dca
+  802c8d:	e8 5d 0f 00 00       	call   803bef <_panic>
+
+00802c92 <page_unmap_range>:
+{
+  802c92:	55                   	push   %ebp
+  802c93:	89 e5                	mov    %esp,%ebp
+  802c95:	57                   	push   %edi
+  802c96:	56                   	push   %esi
+  802c97:	53                   	push   %ebx
+  802c98:	83 ec 0c             	sub    $0xc,%esp
+  802c9b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  802c9e:	e8 8a ed ff ff       	call   801a2d <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  802ca3:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802ca8:	8b 40 48             	mov    0x48(%eax),%eax
+  802cab:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  802caf:	7e 38                	jle    802ce9 <page_unmap_range+0x57>
+  802cb1:	3b 45 08             	cmp    0x8(%ebp),%eax
+  802cb4:	74 33                	je     802ce9 <page_unmap_range+0x57>
+  802cb6:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  802cbd:	74 2a                	je     802ce9 <page_unmap_range+0x57>
+  802cbf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  802cc2:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc7:	39 fe                	cmp    %edi,%esi
+  802cc9:	74 56                	je     802d21 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  802ccb:	83 ec 08             	sub    $0x8,%esp
+  802cce:	53                   	push   %ebx
+  802ccf:	ff 75 08             	push   0x8(%ebp)
+  802cd2:	e8 89 fe ff ff       	call   802b60 <page_unmap>
+  802cd7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802cdd:	83 c4 10             	add    $0x10,%esp
+  802ce0:	85 c0                	test   %eax,%eax
+  802ce2:	78 35                	js     802d19 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  802ce4:	83 c6 01             	add    $0x1,%esi
+  802ce7:	eb de                	jmp    802cc7 <page_unmap_range+0x35>
+  802ce9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  802cec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cf1:	eb 10                	jmp    802d03 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  802cf3:	89 f0                	mov    %esi,%eax
+  802cf5:	e8 db fd ff ff       	call   802ad5 <page_forget>
+		for (i = 0; i < npages; i++)
+  802cfa:	83 c3 01             	add    $0x1,%ebx
+  802cfd:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802d03:	39 fb                	cmp    %edi,%ebx
+  802d05:	75 ec                	jne    802cf3 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  802d07:	83 ec 04             	sub    $0x4,%esp
+  802d0a:	57                   	push   %edi
+  802d0b:	ff 75 0c             	push   0xc(%ebp)
+  802d0e:	ff 75 08             	push   0x8(%ebp)
+  802d11:	e8 40 d6 ff ff       	call   800356 <sys_page_unmap_range>
+  802d16:	83 c4 10             	add    $0x10,%esp
+}
+  802d19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d1c:	5b                   	pop    %ebx
+  802d1d:	5e                   	pop    %esi
+  802d1e:	5f                   	pop    %edi
+  802d1f:	5d                   	pop    %ebp
+  802d20:	c3                   	ret
+	return 0;
+  802d21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d26:	eb f1                	jmp    802d19 <page_unmap_range+0x87>
+
+00802d28 <page_alloc_range>:
+{
+  802d28:	55                   	push   %ebp
+  802d29:	89 e5                	mov    %esp,%ebp
+  802d2b:	57                   	push   %edi
+  802d2c:	56                   	push   %esi
+  802d2d:	53                   	push   %ebx
+  802d2e:	83 ec 1c             	sub    $0x1c,%esp
+  802d31:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d34:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  802d37:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  802d3e:	74 14                	je     802d54 <page_alloc_range+0x2c>
+	if (check_mte)
+  802d40:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802d44:	74 66                	je     802dac <page_alloc_range+0x84>
+  802d46:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  802d48:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  802d50:	89 c7                	mov    %eax,%edi
+  802d52:	eb 10                	jmp    802d64 <page_alloc_range+0x3c>
+		init_map_dir();
+  802d54:	e8 e6 f8 ff ff       	call   80263f <init_map_dir>
+  802d59:	eb e5                	jmp    802d40 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  802d5b:	83 c7 01             	add    $0x1,%edi
+  802d5e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802d64:	39 df                	cmp    %ebx,%edi
+  802d66:	74 38                	je     802da0 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  802d68:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802d6b:	83 ec 08             	sub    $0x8,%esp
+  802d6e:	6a 00                	push   $0x0
+  802d70:	56                   	push   %esi
+  802d71:	e8 1f f9 ff ff       	call   802695 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  802d76:	83 c4 10             	add    $0x10,%esp
+  802d79:	85 c0                	test   %eax,%eax
+  802d7b:	74 de                	je     802d5b <page_alloc_range+0x33>
+  802d7d:	8b 10                	mov    (%eax),%edx
+  802d7f:	f6 c2 01             	test   $0x1,%dl
+  802d82:	74 d7                	je     802d5b <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  802d84:	83 ec 08             	sub    $0x8,%esp
+  802d87:	ff 75 e4             	push   -0x1c(%ebp)
+  802d8a:	52                   	push   %edx
+  802d8b:	50                   	push   %eax
+  802d8c:	68 d8 50 80 00       	push   $0x8050d8
+  802d91:	68 0b 04 00 00       	push   $0x40b
+  802d96:	68 ca 4d 80 00       	push   $0x804dca
+  802d9b:	e8 4f 0e 00 00       	call   803bef <_panic>
+  802da0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802da3:	eb 07                	jmp    802dac <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  802da5:	c1 e0 0c             	shl    $0xc,%eax
+  802da8:	01 c7                	add    %eax,%edi
+			npages -= r;
+  802daa:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  802dac:	85 db                	test   %ebx,%ebx
+  802dae:	74 30                	je     802de0 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  802db0:	ff 75 14             	push   0x14(%ebp)
+  802db3:	53                   	push   %ebx
+  802db4:	57                   	push   %edi
+  802db5:	ff 75 08             	push   0x8(%ebp)
+  802db8:	e8 2b d5 ff ff       	call   8002e8 <sys_page_alloc_range>
+  802dbd:	89 c6                	mov    %eax,%esi
+  802dbf:	83 c4 10             	add    $0x10,%esp
+  802dc2:	85 c0                	test   %eax,%eax
+  802dc4:	7f df                	jg     802da5 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  802dc6:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  802dc9:	75 1a                	jne    802de5 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  802dcb:	83 ec 08             	sub    $0x8,%esp
+  802dce:	57                   	push   %edi
+  802dcf:	ff 75 08             	push   0x8(%ebp)
+  802dd2:	e8 68 f9 ff ff       	call   80273f <page_out>
+  802dd7:	83 c4 10             	add    $0x10,%esp
+  802dda:	85 c0                	test   %eax,%eax
+  802ddc:	79 ce                	jns    802dac <page_alloc_range+0x84>
+  802dde:	eb 05                	jmp    802de5 <page_alloc_range+0xbd>
+	return 0;
+  802de0:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  802de5:	89 f0                	mov    %esi,%eax
+  802de7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dea:	5b                   	pop    %ebx
+  802deb:	5e                   	pop    %esi
+  802dec:	5f                   	pop    %edi
+  802ded:	5d                   	pop    %ebp
+  802dee:	c3                   	ret
+
+00802def <page_in>:
+{
+  802def:	55                   	push   %ebp
+  802df0:	89 e5                	mov    %esp,%ebp
+  802df2:	57                   	push   %edi
+  802df3:	56                   	push   %esi
+  802df4:	53                   	push   %ebx
+  802df5:	83 ec 3c             	sub    $0x3c,%esp
+  802df8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  802dfb:	e8 2d ec ff ff       	call   801a2d <find_paging_env>
+	if (pagingenv == 0)
+  802e00:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  802e07:	0f 84 09 02 00 00    	je     803016 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  802e0d:	83 ec 08             	sub    $0x8,%esp
+  802e10:	6a 00                	push   $0x0
+  802e12:	56                   	push   %esi
+  802e13:	e8 7d f8 ff ff       	call   802695 <umapdir_walk>
+  802e18:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  802e1a:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802e20:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  802e23:	83 c4 10             	add    $0x10,%esp
+  802e26:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  802e2a:	74 0d                	je     802e39 <page_in+0x4a>
+  802e2c:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802e31:	8b 40 48             	mov    0x48(%eax),%eax
+  802e34:	3b 45 08             	cmp    0x8(%ebp),%eax
+  802e37:	75 06                	jne    802e3f <page_in+0x50>
+  802e39:	8b 03                	mov    (%ebx),%eax
+  802e3b:	a8 02                	test   $0x2,%al
+  802e3d:	75 63                	jne    802ea2 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  802e3f:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  802e41:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  802e43:	89 f0                	mov    %esi,%eax
+  802e45:	25 06 0e 00 00       	and    $0xe06,%eax
+  802e4a:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  802e4d:	50                   	push   %eax
+  802e4e:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  802e51:	57                   	push   %edi
+  802e52:	ff 75 08             	push   0x8(%ebp)
+  802e55:	e8 65 fb ff ff       	call   8029bf <page_alloc>
+  802e5a:	83 c4 10             	add    $0x10,%esp
+  802e5d:	85 c0                	test   %eax,%eax
+  802e5f:	78 39                	js     802e9a <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  802e61:	89 f0                	mov    %esi,%eax
+  802e63:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  802e66:	83 ec 0c             	sub    $0xc,%esp
+  802e69:	6a 07                	push   $0x7
+  802e6b:	6a 01                	push   $0x1
+  802e6d:	57                   	push   %edi
+  802e6e:	c1 e0 04             	shl    $0x4,%eax
+  802e71:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802e72:	c1 ee 1c             	shr    $0x1c,%esi
+  802e75:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  802e78:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  802e7f:	e8 b3 1a 00 00       	call   804937 <ipc_call>
+  802e84:	83 c4 20             	add    $0x20,%esp
+  802e87:	85 c0                	test   %eax,%eax
+  802e89:	0f 88 72 01 00 00    	js     803001 <page_in+0x212>
+	*mte = 0;
+  802e8f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  802e95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e9d:	5b                   	pop    %ebx
+  802e9e:	5e                   	pop    %esi
+  802e9f:	5f                   	pop    %edi
+  802ea0:	5d                   	pop    %ebp
+  802ea1:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  802ea2:	25 06 0e 00 00       	and    $0xe06,%eax
+  802ea7:	83 c8 01             	or     $0x1,%eax
+  802eaa:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  802ead:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  802eb0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  802eb3:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  802eb9:	be 01 00 00 00       	mov    $0x1,%esi
+  802ebe:	eb 46                	jmp    802f06 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  802ec0:	83 ec 08             	sub    $0x8,%esp
+  802ec3:	6a 00                	push   $0x0
+  802ec5:	51                   	push   %ecx
+  802ec6:	e8 ca f7 ff ff       	call   802695 <umapdir_walk>
+  802ecb:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  802ecf:	83 c4 10             	add    $0x10,%esp
+  802ed2:	85 c0                	test   %eax,%eax
+  802ed4:	74 66                	je     802f3c <page_in+0x14d>
+  802ed6:	8b 00                	mov    (%eax),%eax
+  802ed8:	a8 01                	test   $0x1,%al
+  802eda:	74 60                	je     802f3c <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  802edc:	89 c2                	mov    %eax,%edx
+  802ede:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  802ee4:	83 ca 01             	or     $0x1,%edx
+  802ee7:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  802eea:	75 50                	jne    802f3c <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  802eec:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  802ef2:	c1 e8 1c             	shr    $0x1c,%eax
+  802ef5:	8b 13                	mov    (%ebx),%edx
+  802ef7:	c1 ea 1c             	shr    $0x1c,%edx
+  802efa:	39 d0                	cmp    %edx,%eax
+  802efc:	75 3e                	jne    802f3c <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  802efe:	83 c6 01             	add    $0x1,%esi
+  802f01:	83 fe 08             	cmp    $0x8,%esi
+  802f04:	74 3f                	je     802f45 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  802f06:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  802f08:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  802f0e:	77 2c                	ja     802f3c <page_in+0x14d>
+  802f10:	89 f8                	mov    %edi,%eax
+  802f12:	c1 e8 16             	shr    $0x16,%eax
+  802f15:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802f1c:	f6 c2 01             	test   $0x1,%dl
+  802f1f:	74 9f                	je     802ec0 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  802f21:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  802f28:	a8 80                	test   $0x80,%al
+  802f2a:	75 10                	jne    802f3c <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  802f2c:	89 f8                	mov    %edi,%eax
+  802f2e:	c1 e8 0c             	shr    $0xc,%eax
+  802f31:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f38:	a8 01                	test   $0x1,%al
+  802f3a:	74 84                	je     802ec0 <page_in+0xd1>
+	if (n == 1)
+  802f3c:	83 fe 01             	cmp    $0x1,%esi
+  802f3f:	0f 84 fa fe ff ff    	je     802e3f <page_in+0x50>
+	req.nslots = n;
+  802f45:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  802f4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f50:	eb 13                	jmp    802f65 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  802f52:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  802f56:	8b 12                	mov    (%edx),%edx
+  802f58:	c1 ea 0c             	shr    $0xc,%edx
+  802f5b:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  802f62:	83 c0 01             	add    $0x1,%eax
+  802f65:	39 c6                	cmp    %eax,%esi
+  802f67:	75 e9                	jne    802f52 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  802f69:	83 ec 0c             	sub    $0xc,%esp
+  802f6c:	6a 00                	push   $0x0
+  802f6e:	ff 75 c0             	push   -0x40(%ebp)
+  802f71:	56                   	push   %esi
+  802f72:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  802f75:	57                   	push   %edi
+  802f76:	6a 00                	push   $0x0
+  802f78:	e8 ab fd ff ff       	call   802d28 <page_alloc_range>
+  802f7d:	83 c4 20             	add    $0x20,%esp
+  802f80:	85 c0                	test   %eax,%eax
+  802f82:	78 6e                	js     802ff2 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  802f84:	83 ec 04             	sub    $0x4,%esp
+  802f87:	6a 24                	push   $0x24
+  802f89:	68 00 80 80 00       	push   $0x808000
+  802f8e:	57                   	push   %edi
+  802f8f:	e8 a3 14 00 00       	call   804437 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  802f94:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  802f9b:	56                   	push   %esi
+  802f9c:	57                   	push   %edi
+  802f9d:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802f9f:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  802fa6:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  802fa9:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  802fb0:	e8 82 19 00 00       	call   804937 <ipc_call>
+  802fb5:	83 c4 20             	add    $0x20,%esp
+  802fb8:	85 c0                	test   %eax,%eax
+  802fba:	78 08                	js     802fc4 <page_in+0x1d5>
+  802fbc:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  802fbf:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  802fc2:	eb 20                	jmp    802fe4 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  802fc4:	50                   	push   %eax
+  802fc5:	68 98 51 80 00       	push   $0x805198
+  802fca:	68 59 02 00 00       	push   $0x259
+  802fcf:	68 ca 4d 80 00       	push   $0x804dca
+  802fd4:	e8 16 0c 00 00       	call   803bef <_panic>
+		*mtes[i] = 0;
+  802fd9:	8b 10                	mov    (%eax),%edx
+  802fdb:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  802fe1:	83 c0 04             	add    $0x4,%eax
+  802fe4:	39 c8                	cmp    %ecx,%eax
+  802fe6:	75 f1                	jne    802fd9 <page_in+0x1ea>
+	return n;
+  802fe8:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  802fea:	85 f6                	test   %esi,%esi
+  802fec:	0f 84 4d fe ff ff    	je     802e3f <page_in+0x50>
+		return r < 0 ? r : 0;
+  802ff2:	85 c0                	test   %eax,%eax
+  802ff4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ff9:	0f 4f c2             	cmovg  %edx,%eax
+  802ffc:	e9 99 fe ff ff       	jmp    802e9a <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  803001:	50                   	push   %eax
+  803002:	68 d0 51 80 00       	push   $0x8051d0
+  803007:	68 9a 02 00 00       	push   $0x29a
+  80300c:	68 ca 4d 80 00       	push   $0x804dca
+  803011:	e8 d9 0b 00 00       	call   803bef <_panic>
+		return -E_PAGING;
+  803016:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80301b:	e9 7a fe ff ff       	jmp    802e9a <page_in+0xab>
+
+00803020 <page_map>:
+{
+  803020:	55                   	push   %ebp
+  803021:	89 e5                	mov    %esp,%ebp
+  803023:	57                   	push   %edi
+  803024:	56                   	push   %esi
+  803025:	53                   	push   %ebx
+  803026:	83 ec 1c             	sub    $0x1c,%esp
+  803029:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  80302c:	83 ec 0c             	sub    $0xc,%esp
+  80302f:	ff 75 18             	push   0x18(%ebp)
+  803032:	ff 75 14             	push   0x14(%ebp)
+  803035:	ff 75 10             	push   0x10(%ebp)
+  803038:	ff 75 0c             	push   0xc(%ebp)
+  80303b:	56                   	push   %esi
+  80303c:	e8 bf d1 ff ff       	call   800200 <sys_page_map>
+  803041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803044:	83 c4 20             	add    $0x20,%esp
+  803047:	85 c0                	test   %eax,%eax
+  803049:	0f 89 a9 01 00 00    	jns    8031f8 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  80304f:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  803053:	74 5f                	je     8030b4 <page_map+0x94>
+		if (r != -E_INVAL)
+  803055:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  803059:	0f 85 a0 01 00 00    	jne    8031ff <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  80305f:	85 f6                	test   %esi,%esi
+  803061:	74 70                	je     8030d3 <page_map+0xb3>
+  803063:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803068:	8b 40 48             	mov    0x48(%eax),%eax
+  80306b:	39 f0                	cmp    %esi,%eax
+  80306d:	74 64                	je     8030d3 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80306f:	83 ec 0c             	sub    $0xc,%esp
+  803072:	6a 05                	push   $0x5
+  803074:	68 00 00 40 00       	push   $0x400000
+  803079:	6a 00                	push   $0x0
+  80307b:	68 00 b0 ad de       	push   $0xdeadb000
+  803080:	56                   	push   %esi
+  803081:	e8 7a d1 ff ff       	call   800200 <sys_page_map>
+  803086:	89 c3                	mov    %eax,%ebx
+  803088:	83 c4 20             	add    $0x20,%esp
+  80308b:	85 c0                	test   %eax,%eax
+  80308d:	79 6a                	jns    8030f9 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  80308f:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803092:	75 50                	jne    8030e4 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  803094:	83 ec 08             	sub    $0x8,%esp
+  803097:	68 00 00 40 00       	push   $0x400000
+  80309c:	6a fc                	push   $0xfffffffc
+  80309e:	e8 9c f6 ff ff       	call   80273f <page_out>
+  8030a3:	83 c4 10             	add    $0x10,%esp
+  8030a6:	85 c0                	test   %eax,%eax
+  8030a8:	79 c5                	jns    80306f <page_map+0x4f>
+}
+  8030aa:	89 d8                	mov    %ebx,%eax
+  8030ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030af:	5b                   	pop    %ebx
+  8030b0:	5e                   	pop    %esi
+  8030b1:	5f                   	pop    %edi
+  8030b2:	5d                   	pop    %ebp
+  8030b3:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  8030b4:	83 ec 08             	sub    $0x8,%esp
+  8030b7:	68 00 00 40 00       	push   $0x400000
+  8030bc:	6a 00                	push   $0x0
+  8030be:	e8 7c f6 ff ff       	call   80273f <page_out>
+  8030c3:	83 c4 10             	add    $0x10,%esp
+  8030c6:	85 c0                	test   %eax,%eax
+  8030c8:	0f 89 5e ff ff ff    	jns    80302c <page_map+0xc>
+				return r;
+  8030ce:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030d1:	eb d7                	jmp    8030aa <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8030d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8030d6:	e8 79 f9 ff ff       	call   802a54 <page_adopt>
+  8030db:	85 c0                	test   %eax,%eax
+  8030dd:	79 90                	jns    80306f <page_map+0x4f>
+			return r;
+  8030df:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030e2:	eb c6                	jmp    8030aa <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  8030e4:	53                   	push   %ebx
+  8030e5:	68 04 52 80 00       	push   $0x805204
+  8030ea:	68 77 03 00 00       	push   $0x377
+  8030ef:	68 ca 4d 80 00       	push   $0x804dca
+  8030f4:	e8 f6 0a 00 00       	call   803bef <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  8030f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8030fc:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8030ff:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  803106:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  80310c:	0f 84 f5 00 00 00    	je     803207 <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803112:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803118:	83 ec 0c             	sub    $0xc,%esp
+  80311b:	6a 05                	push   $0x5
+  80311d:	68 00 00 40 00       	push   $0x400000
+  803122:	6a 00                	push   $0x0
+  803124:	57                   	push   %edi
+  803125:	56                   	push   %esi
+  803126:	e8 d5 d0 ff ff       	call   800200 <sys_page_map>
+  80312b:	89 c3                	mov    %eax,%ebx
+  80312d:	83 c4 20             	add    $0x20,%esp
+  803130:	85 c0                	test   %eax,%eax
+  803132:	79 35                	jns    803169 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  803134:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803137:	75 1b                	jne    803154 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803139:	83 ec 08             	sub    $0x8,%esp
+  80313c:	68 00 00 40 00       	push   $0x400000
+  803141:	6a 00                	push   $0x0
+  803143:	e8 f7 f5 ff ff       	call   80273f <page_out>
+  803148:	83 c4 10             	add    $0x10,%esp
+  80314b:	85 c0                	test   %eax,%eax
+  80314d:	79 c9                	jns    803118 <page_map+0xf8>
+  80314f:	e9 56 ff ff ff       	jmp    8030aa <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  803154:	53                   	push   %ebx
+  803155:	68 2c 52 80 00       	push   $0x80522c
+  80315a:	68 83 03 00 00       	push   $0x383
+  80315f:	68 ca 4d 80 00       	push   $0x804dca
+  803164:	e8 86 0a 00 00       	call   803bef <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  803169:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80316c:	c1 e8 0c             	shr    $0xc,%eax
+  80316f:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803174:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  80317b:	01 
+  80317c:	0f 84 8d 00 00 00    	je     80320f <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803182:	83 ec 08             	sub    $0x8,%esp
+  803185:	68 00 00 40 00       	push   $0x400000
+  80318a:	6a 00                	push   $0x0
+  80318c:	e8 b1 d0 ff ff       	call   800242 <sys_page_unmap>
+  803191:	83 c4 10             	add    $0x10,%esp
+  803194:	85 c0                	test   %eax,%eax
+  803196:	78 36                	js     8031ce <page_map+0x1ae>
+  803198:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  80319b:	83 ec 08             	sub    $0x8,%esp
+  80319e:	57                   	push   %edi
+  80319f:	56                   	push   %esi
+  8031a0:	e8 4a fc ff ff       	call   802def <page_in>
+  8031a5:	89 c3                	mov    %eax,%ebx
+  8031a7:	83 c4 10             	add    $0x10,%esp
+  8031aa:	85 c0                	test   %eax,%eax
+  8031ac:	0f 89 7a fe ff ff    	jns    80302c <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  8031b2:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8031b5:	75 2c                	jne    8031e3 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  8031b7:	83 ec 08             	sub    $0x8,%esp
+  8031ba:	57                   	push   %edi
+  8031bb:	6a 00                	push   $0x0
+  8031bd:	e8 7d f5 ff ff       	call   80273f <page_out>
+  8031c2:	83 c4 10             	add    $0x10,%esp
+  8031c5:	85 c0                	test   %eax,%eax
+  8031c7:	79 d2                	jns    80319b <page_map+0x17b>
+  8031c9:	e9 dc fe ff ff       	jmp    8030aa <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  8031ce:	50                   	push   %eax
+  8031cf:	68 58 52 80 00       	push   $0x805258
+  8031d4:	68 8b 03 00 00       	push   $0x38b
+  8031d9:	68 ca 4d 80 00       	push   $0x804dca
+  8031de:	e8 0c 0a 00 00       	call   803bef <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  8031e3:	53                   	push   %ebx
+  8031e4:	68 80 52 80 00       	push   $0x805280
+  8031e9:	68 91 03 00 00       	push   $0x391
+  8031ee:	68 ca 4d 80 00       	push   $0x804dca
+  8031f3:	e8 f7 09 00 00       	call   803bef <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8031f8:	89 c3                	mov    %eax,%ebx
+  8031fa:	e9 ab fe ff ff       	jmp    8030aa <page_map+0x8a>
+  8031ff:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803202:	e9 a3 fe ff ff       	jmp    8030aa <page_map+0x8a>
+			return r; // Pass through the error
+  803207:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80320a:	e9 9b fe ff ff       	jmp    8030aa <page_map+0x8a>
+			return r; // Pass through the error
+  80320f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803212:	e9 93 fe ff ff       	jmp    8030aa <page_map+0x8a>
+
+00803217 <page_map_range>:
+{
+  803217:	55                   	push   %ebp
+  803218:	89 e5                	mov    %esp,%ebp
+  80321a:	57                   	push   %edi
+  80321b:	56                   	push   %esi
+  80321c:	53                   	push   %ebx
+  80321d:	83 ec 0c             	sub    $0xc,%esp
+  803220:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803223:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  803226:	83 ec 08             	sub    $0x8,%esp
+  803229:	ff 75 1c             	push   0x1c(%ebp)
+  80322c:	ff 75 18             	push   0x18(%ebp)
+  80322f:	56                   	push   %esi
+  803230:	ff 75 10             	push   0x10(%ebp)
+  803233:	57                   	push   %edi
+  803234:	ff 75 08             	push   0x8(%ebp)
+  803237:	e8 cf d0 ff ff       	call   80030b <sys_page_map_range>
+  80323c:	89 c3                	mov    %eax,%ebx
+  80323e:	83 c4 20             	add    $0x20,%esp
+  803241:	85 c0                	test   %eax,%eax
+  803243:	79 1b                	jns    803260 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  803245:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803248:	75 20                	jne    80326a <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  80324a:	83 ec 08             	sub    $0x8,%esp
+  80324d:	68 00 00 40 00       	push   $0x400000
+  803252:	6a 00                	push   $0x0
+  803254:	e8 e6 f4 ff ff       	call   80273f <page_out>
+  803259:	83 c4 10             	add    $0x10,%esp
+  80325c:	85 c0                	test   %eax,%eax
+  80325e:	79 c6                	jns    803226 <page_map_range+0xf>
+}
+  803260:	89 d8                	mov    %ebx,%eax
+  803262:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803265:	5b                   	pop    %ebx
+  803266:	5e                   	pop    %esi
+  803267:	5f                   	pop    %edi
+  803268:	5d                   	pop    %ebp
+  803269:	c3                   	ret
+		if (r != -E_INVAL)
+  80326a:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  80326d:	75 f1                	jne    803260 <page_map_range+0x49>
+  80326f:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  803271:	be 00 00 00 00       	mov    $0x0,%esi
+  803276:	eb 03                	jmp    80327b <page_map_range+0x64>
+  803278:	83 c6 01             	add    $0x1,%esi
+  80327b:	3b 75 18             	cmp    0x18(%ebp),%esi
+  80327e:	74 2a                	je     8032aa <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  803280:	83 ec 0c             	sub    $0xc,%esp
+  803283:	ff 75 1c             	push   0x1c(%ebp)
+  803286:	53                   	push   %ebx
+  803287:	ff 75 10             	push   0x10(%ebp)
+  80328a:	57                   	push   %edi
+  80328b:	ff 75 08             	push   0x8(%ebp)
+  80328e:	e8 8d fd ff ff       	call   803020 <page_map>
+  803293:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803299:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80329f:	83 c4 20             	add    $0x20,%esp
+  8032a2:	85 c0                	test   %eax,%eax
+  8032a4:	79 d2                	jns    803278 <page_map_range+0x61>
+  8032a6:	89 c3                	mov    %eax,%ebx
+  8032a8:	eb b6                	jmp    803260 <page_map_range+0x49>
+		return 0;
+  8032aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032af:	eb af                	jmp    803260 <page_map_range+0x49>
+
+008032b1 <paging_pgfault_handler>:
+{
+  8032b1:	55                   	push   %ebp
+  8032b2:	89 e5                	mov    %esp,%ebp
+  8032b4:	56                   	push   %esi
+  8032b5:	53                   	push   %ebx
+  8032b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  8032b9:	e8 6f e7 ff ff       	call   801a2d <find_paging_env>
+	if (pagingenv == 0)
+  8032be:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  8032c3:	85 c0                	test   %eax,%eax
+  8032c5:	74 3c                	je     803303 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  8032c7:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  8032c9:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8032cd:	75 12                	jne    8032e1 <paging_pgfault_handler+0x30>
+  8032cf:	89 f0                	mov    %esi,%eax
+  8032d1:	e8 7e f7 ff ff       	call   802a54 <page_adopt>
+  8032d6:	89 c2                	mov    %eax,%edx
+		return 0;
+  8032d8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  8032dd:	85 d2                	test   %edx,%edx
+  8032df:	78 22                	js     803303 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  8032e1:	83 ec 08             	sub    $0x8,%esp
+  8032e4:	6a 00                	push   $0x0
+  8032e6:	56                   	push   %esi
+  8032e7:	e8 a9 f3 ff ff       	call   802695 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  8032ec:	83 c4 10             	add    $0x10,%esp
+  8032ef:	85 c0                	test   %eax,%eax
+  8032f1:	74 05                	je     8032f8 <paging_pgfault_handler+0x47>
+  8032f3:	f6 00 01             	testb  $0x1,(%eax)
+  8032f6:	75 12                	jne    80330a <paging_pgfault_handler+0x59>
+	return 0;
+  8032f8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8032fd:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803301:	74 23                	je     803326 <paging_pgfault_handler+0x75>
+}
+  803303:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803306:	5b                   	pop    %ebx
+  803307:	5e                   	pop    %esi
+  803308:	5d                   	pop    %ebp
+  803309:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  80330a:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80330f:	8b 40 48             	mov    0x48(%eax),%eax
+  803312:	83 ec 08             	sub    $0x8,%esp
+  803315:	56                   	push   %esi
+  803316:	50                   	push   %eax
+  803317:	e8 d3 fa ff ff       	call   802def <page_in>
+  80331c:	f7 d0                	not    %eax
+  80331e:	c1 e8 1f             	shr    $0x1f,%eax
+  803321:	83 c4 10             	add    $0x10,%esp
+  803324:	eb dd                	jmp    803303 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803326:	89 f0                	mov    %esi,%eax
+  803328:	e8 97 e2 ff ff       	call   8015c4 <segment_lookup>
+  80332d:	89 c2                	mov    %eax,%edx
+	return 0;
+  80332f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803334:	85 d2                	test   %edx,%edx
+  803336:	74 cb                	je     803303 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  803338:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80333d:	8b 40 48             	mov    0x48(%eax),%eax
+  803340:	83 ec 08             	sub    $0x8,%esp
+  803343:	56                   	push   %esi
+  803344:	50                   	push   %eax
+  803345:	e8 f5 f3 ff ff       	call   80273f <page_out>
+  80334a:	f7 d0                	not    %eax
+  80334c:	c1 e8 1f             	shr    $0x1f,%eax
+  80334f:	83 c4 10             	add    $0x10,%esp
+  803352:	eb af                	jmp    803303 <paging_pgfault_handler+0x52>
+
+00803354 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  803354:	55                   	push   %ebp
+  803355:	89 e5                	mov    %esp,%ebp
+  803357:	57                   	push   %edi
+  803358:	56                   	push   %esi
+  803359:	53                   	push   %ebx
+  80335a:	83 ec 2c             	sub    $0x2c,%esp
+  80335d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  803360:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  803365:	89 c1                	mov    %eax,%ecx
+  803367:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  80336a:	c1 e8 11             	shr    $0x11,%eax
+  80336d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803370:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  803377:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  80337a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80337f:	d3 e0                	shl    %cl,%eax
+  803381:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803384:	85 c7                	test   %eax,%edi
+  803386:	74 12                	je     80339a <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803388:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80338d:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  803390:	bf 01 00 00 00       	mov    $0x1,%edi
+  803395:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803398:	eb 17                	jmp    8033b1 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  80339a:	ff 75 e0             	push   -0x20(%ebp)
+  80339d:	68 b8 52 80 00       	push   $0x8052b8
+  8033a2:	6a 48                	push   $0x48
+  8033a4:	68 d2 52 80 00       	push   $0x8052d2
+  8033a9:	e8 41 08 00 00       	call   803bef <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  8033ae:	83 c3 01             	add    $0x1,%ebx
+  8033b1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8033b4:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  8033b7:	89 c8                	mov    %ecx,%eax
+  8033b9:	c1 e8 05             	shr    $0x5,%eax
+  8033bc:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  8033c3:	89 fe                	mov    %edi,%esi
+  8033c5:	d3 e6                	shl    %cl,%esi
+  8033c7:	89 f1                	mov    %esi,%ecx
+  8033c9:	85 d6                	test   %edx,%esi
+  8033cb:	74 e1                	je     8033ae <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  8033cd:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  8033d0:	f7 d6                	not    %esi
+  8033d2:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8033d5:	21 fe                	and    %edi,%esi
+  8033d7:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8033da:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  8033e1:	f7 d1                	not    %ecx
+  8033e3:	21 d1                	and    %edx,%ecx
+  8033e5:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  8033ec:	83 ec 04             	sub    $0x4,%esp
+  8033ef:	53                   	push   %ebx
+  8033f0:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8033f3:	57                   	push   %edi
+  8033f4:	6a 00                	push   $0x0
+  8033f6:	e8 97 f8 ff ff       	call   802c92 <page_unmap_range>
+	va_free(va, n);
+  8033fb:	83 c4 08             	add    $0x8,%esp
+  8033fe:	53                   	push   %ebx
+  8033ff:	57                   	push   %edi
+  803400:	e8 ed 05 00 00       	call   8039f2 <va_free>
+}
+  803405:	83 c4 10             	add    $0x10,%esp
+  803408:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80340b:	5b                   	pop    %ebx
+  80340c:	5e                   	pop    %esi
+  80340d:	5f                   	pop    %edi
+  80340e:	5d                   	pop    %ebp
+  80340f:	c3                   	ret
+
+00803410 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  803410:	55                   	push   %ebp
+  803411:	89 e5                	mov    %esp,%ebp
+  803413:	57                   	push   %edi
+  803414:	56                   	push   %esi
+  803415:	53                   	push   %ebx
+  803416:	83 ec 1c             	sub    $0x1c,%esp
+  803419:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  80341c:	85 db                	test   %ebx,%ebx
+  80341e:	74 34                	je     803454 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  803420:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803426:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  80342b:	77 2f                	ja     80345c <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  80342d:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  803433:	75 51                	jne    803486 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  803435:	89 c1                	mov    %eax,%ecx
+  803437:	c1 e9 0c             	shr    $0xc,%ecx
+  80343a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80343f:	d3 e2                	shl    %cl,%edx
+  803441:	c1 e8 11             	shr    $0x11,%eax
+  803444:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  80344b:	75 24                	jne    803471 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  80344d:	89 d8                	mov    %ebx,%eax
+  80344f:	e8 00 ff ff ff       	call   803354 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  803454:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803457:	5b                   	pop    %ebx
+  803458:	5e                   	pop    %esi
+  803459:	5f                   	pop    %edi
+  80345a:	5d                   	pop    %ebp
+  80345b:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  80345c:	53                   	push   %ebx
+  80345d:	68 df 52 80 00       	push   $0x8052df
+  803462:	68 a2 00 00 00       	push   $0xa2
+  803467:	68 d2 52 80 00       	push   $0x8052d2
+  80346c:	e8 7e 07 00 00       	call   803bef <_panic>
+			panic("free: %p is not allocated", va);
+  803471:	53                   	push   %ebx
+  803472:	68 b8 52 80 00       	push   $0x8052b8
+  803477:	68 a5 00 00 00       	push   $0xa5
+  80347c:	68 d2 52 80 00       	push   $0x8052d2
+  803481:	e8 69 07 00 00       	call   803bef <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  803486:	89 de                	mov    %ebx,%esi
+  803488:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  80348e:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  803494:	89 c8                	mov    %ecx,%eax
+  803496:	c1 e8 11             	shr    $0x11,%eax
+  803499:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80349c:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  8034a3:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8034a6:	c1 e9 0c             	shr    $0xc,%ecx
+  8034a9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034ae:	d3 e0                	shl    %cl,%eax
+  8034b0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8034b3:	85 c7                	test   %eax,%edi
+  8034b5:	74 1b                	je     8034d2 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  8034b7:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8034bb:	89 d8                	mov    %ebx,%eax
+  8034bd:	29 f0                	sub    %esi,%eax
+  8034bf:	83 e8 10             	sub    $0x10,%eax
+  8034c2:	99                   	cltd
+  8034c3:	f7 ff                	idiv   %edi
+  8034c5:	89 d1                	mov    %edx,%ecx
+  8034c7:	85 d2                	test   %edx,%edx
+  8034c9:	75 07                	jne    8034d2 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8034cb:	ba 10 00 00 00       	mov    $0x10,%edx
+  8034d0:	eb 18                	jmp    8034ea <free+0xda>
+		panic("free: %p is not allocated", va);
+  8034d2:	53                   	push   %ebx
+  8034d3:	68 b8 52 80 00       	push   $0x8052b8
+  8034d8:	68 ad 00 00 00       	push   $0xad
+  8034dd:	68 d2 52 80 00       	push   $0x8052d2
+  8034e2:	e8 08 07 00 00       	call   803bef <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8034e7:	83 c1 01             	add    $0x1,%ecx
+  8034ea:	89 d0                	mov    %edx,%eax
+  8034ec:	d3 e0                	shl    %cl,%eax
+  8034ee:	39 c7                	cmp    %eax,%edi
+  8034f0:	7f f5                	jg     8034e7 <free+0xd7>
+	*(void **) va = s->free;
+  8034f2:	8b 46 08             	mov    0x8(%esi),%eax
+  8034f5:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  8034f7:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  8034fa:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  8034fe:	8d 58 01             	lea    0x1(%eax),%ebx
+  803501:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  803505:	66 85 c0             	test   %ax,%ax
+  803508:	74 52                	je     80355c <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  80350a:	0f b7 db             	movzwl %bx,%ebx
+  80350d:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  803511:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  803516:	ba 00 00 00 00       	mov    $0x0,%edx
+  80351b:	f7 ff                	idiv   %edi
+  80351d:	39 c3                	cmp    %eax,%ebx
+  80351f:	0f 85 2f ff ff ff    	jne    803454 <free+0x44>
+  803525:	8b 46 04             	mov    0x4(%esi),%eax
+  803528:	85 c0                	test   %eax,%eax
+  80352a:	74 53                	je     80357f <free+0x16f>
+		s->prev->next = s->next;
+  80352c:	8b 16                	mov    (%esi),%edx
+  80352e:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  803530:	8b 06                	mov    (%esi),%eax
+  803532:	85 c0                	test   %eax,%eax
+  803534:	74 06                	je     80353c <free+0x12c>
+		s->next->prev = s->prev;
+  803536:	8b 56 04             	mov    0x4(%esi),%edx
+  803539:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  80353c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80353f:	f7 d0                	not    %eax
+  803541:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803544:	21 d0                	and    %edx,%eax
+  803546:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803549:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  803550:	89 f0                	mov    %esi,%eax
+  803552:	e8 fd fd ff ff       	call   803354 <heap_free_pages>
+  803557:	e9 f8 fe ff ff       	jmp    803454 <free+0x44>
+	s->prev = NULL;
+  80355c:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  803563:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  80356a:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  80356c:	85 c0                	test   %eax,%eax
+  80356e:	74 03                	je     803573 <free+0x163>
+		slabs[c]->prev = s;
+  803570:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  803573:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  80357a:	e9 d5 fe ff ff       	jmp    803454 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  80357f:	8b 06                	mov    (%esi),%eax
+  803581:	85 c0                	test   %eax,%eax
+  803583:	0f 84 cb fe ff ff    	je     803454 <free+0x44>
+		slabs[c] = s->next;
+  803589:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  803590:	8b 06                	mov    (%esi),%eax
+  803592:	eb a2                	jmp    803536 <free+0x126>
+
+00803594 <heap_alloc_pages>:
+{
+  803594:	55                   	push   %ebp
+  803595:	89 e5                	mov    %esp,%ebp
+  803597:	57                   	push   %edi
+  803598:	56                   	push   %esi
+  803599:	53                   	push   %ebx
+  80359a:	83 ec 18             	sub    $0x18,%esp
+  80359d:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  80359f:	50                   	push   %eax
+  8035a0:	e8 15 03 00 00       	call   8038ba <va_alloc>
+  8035a5:	89 c3                	mov    %eax,%ebx
+  8035a7:	83 c4 10             	add    $0x10,%esp
+  8035aa:	85 c0                	test   %eax,%eax
+  8035ac:	74 47                	je     8035f5 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8035ae:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  8035b4:	89 c1                	mov    %eax,%ecx
+  8035b6:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  8035b9:	c1 e8 11             	shr    $0x11,%eax
+  8035bc:	ba 01 00 00 00       	mov    $0x1,%edx
+  8035c1:	89 d7                	mov    %edx,%edi
+  8035c3:	d3 e7                	shl    %cl,%edi
+  8035c5:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  8035cc:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  8035d0:	89 c8                	mov    %ecx,%eax
+  8035d2:	c1 e8 05             	shr    $0x5,%eax
+  8035d5:	d3 e2                	shl    %cl,%edx
+  8035d7:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  8035de:	83 ec 0c             	sub    $0xc,%esp
+  8035e1:	6a 00                	push   $0x0
+  8035e3:	6a 07                	push   $0x7
+  8035e5:	56                   	push   %esi
+  8035e6:	53                   	push   %ebx
+  8035e7:	6a 00                	push   $0x0
+  8035e9:	e8 3a f7 ff ff       	call   802d28 <page_alloc_range>
+  8035ee:	83 c4 20             	add    $0x20,%esp
+  8035f1:	85 c0                	test   %eax,%eax
+  8035f3:	78 0a                	js     8035ff <heap_alloc_pages+0x6b>
+}
+  8035f5:	89 d8                	mov    %ebx,%eax
+  8035f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035fa:	5b                   	pop    %ebx
+  8035fb:	5e                   	pop    %esi
+  8035fc:	5f                   	pop    %edi
+  8035fd:	5d                   	pop    %ebp
+  8035fe:	c3                   	ret
+		free(va);
+  8035ff:	83 ec 0c             	sub    $0xc,%esp
+  803602:	53                   	push   %ebx
+  803603:	e8 08 fe ff ff       	call   803410 <free>
+		return NULL;
+  803608:	83 c4 10             	add    $0x10,%esp
+  80360b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803610:	eb e3                	jmp    8035f5 <heap_alloc_pages+0x61>
+
+00803612 <malloc>:
+{
+  803612:	55                   	push   %ebp
+  803613:	89 e5                	mov    %esp,%ebp
+  803615:	57                   	push   %edi
+  803616:	56                   	push   %esi
+  803617:	53                   	push   %ebx
+  803618:	83 ec 1c             	sub    $0x1c,%esp
+  80361b:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  80361e:	8d 50 ff             	lea    -0x1(%eax),%edx
+  803621:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  803627:	0f 87 21 01 00 00    	ja     80374e <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  80362d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803632:	ba 10 00 00 00       	mov    $0x10,%edx
+  803637:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  803639:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80363e:	76 15                	jbe    803655 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  803640:	05 ff 0f 00 00       	add    $0xfff,%eax
+  803645:	c1 e8 0c             	shr    $0xc,%eax
+  803648:	e8 47 ff ff ff       	call   803594 <heap_alloc_pages>
+  80364d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803650:	eb 37                	jmp    803689 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  803652:	83 c1 01             	add    $0x1,%ecx
+  803655:	89 d6                	mov    %edx,%esi
+  803657:	d3 e6                	shl    %cl,%esi
+  803659:	39 c6                	cmp    %eax,%esi
+  80365b:	72 f5                	jb     803652 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  80365d:	89 cb                	mov    %ecx,%ebx
+  80365f:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  803666:	85 ff                	test   %edi,%edi
+  803668:	74 2a                	je     803694 <malloc+0x82>
+	v = s->free;
+  80366a:	8b 47 08             	mov    0x8(%edi),%eax
+  80366d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  803670:	8b 00                	mov    (%eax),%eax
+  803672:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  803675:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  803679:	83 e8 01             	sub    $0x1,%eax
+  80367c:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  803680:	66 85 c0             	test   %ax,%ax
+  803683:	0f 84 9a 00 00 00    	je     803723 <malloc+0x111>
+}
+  803689:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80368c:	83 c4 1c             	add    $0x1c,%esp
+  80368f:	5b                   	pop    %ebx
+  803690:	5e                   	pop    %esi
+  803691:	5f                   	pop    %edi
+  803692:	5d                   	pop    %ebp
+  803693:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  803694:	b8 01 00 00 00       	mov    $0x1,%eax
+  803699:	e8 f6 fe ff ff       	call   803594 <heap_alloc_pages>
+  80369e:	89 c1                	mov    %eax,%ecx
+  8036a0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8036a3:	85 c0                	test   %eax,%eax
+  8036a5:	74 e2                	je     803689 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8036a7:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  8036ad:	89 c8                	mov    %ecx,%eax
+  8036af:	c1 e8 11             	shr    $0x11,%eax
+  8036b2:	c1 e9 0c             	shr    $0xc,%ecx
+  8036b5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8036ba:	d3 e2                	shl    %cl,%edx
+  8036bc:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  8036c3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8036c6:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  8036ca:	0f b7 f6             	movzwl %si,%esi
+  8036cd:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8036d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036d7:	f7 fe                	idiv   %esi
+  8036d9:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  8036dd:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  8036e0:	85 c0                	test   %eax,%eax
+  8036e2:	74 14                	je     8036f8 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  8036e4:	83 e8 01             	sub    $0x1,%eax
+  8036e7:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  8036eb:	0f af d0             	imul   %eax,%edx
+  8036ee:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  8036f2:	89 3a                	mov    %edi,(%edx)
+  8036f4:	89 d7                	mov    %edx,%edi
+  8036f6:	eb e5                	jmp    8036dd <malloc+0xcb>
+	s->prev = NULL;
+  8036f8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8036fb:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  803702:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  803709:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  80370b:	85 c0                	test   %eax,%eax
+  80370d:	74 03                	je     803712 <malloc+0x100>
+		slabs[c]->prev = s;
+  80370f:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  803712:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803715:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  80371c:	89 c7                	mov    %eax,%edi
+  80371e:	e9 47 ff ff ff       	jmp    80366a <malloc+0x58>
+	if (s->prev)
+  803723:	8b 47 04             	mov    0x4(%edi),%eax
+  803726:	85 c0                	test   %eax,%eax
+  803728:	74 19                	je     803743 <malloc+0x131>
+		s->prev->next = s->next;
+  80372a:	8b 17                	mov    (%edi),%edx
+  80372c:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  80372e:	8b 07                	mov    (%edi),%eax
+  803730:	85 c0                	test   %eax,%eax
+  803732:	0f 84 51 ff ff ff    	je     803689 <malloc+0x77>
+		s->next->prev = s->prev;
+  803738:	8b 57 04             	mov    0x4(%edi),%edx
+  80373b:	89 50 04             	mov    %edx,0x4(%eax)
+  80373e:	e9 46 ff ff ff       	jmp    803689 <malloc+0x77>
+		slabs[c] = s->next;
+  803743:	8b 07                	mov    (%edi),%eax
+  803745:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  80374c:	eb e0                	jmp    80372e <malloc+0x11c>
+		return NULL;
+  80374e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803755:	e9 2f ff ff ff       	jmp    803689 <malloc+0x77>
+
+0080375a <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  80375a:	55                   	push   %ebp
+  80375b:	89 e5                	mov    %esp,%ebp
+  80375d:	57                   	push   %edi
+  80375e:	56                   	push   %esi
+  80375f:	53                   	push   %ebx
+  803760:	83 ec 0c             	sub    $0xc,%esp
+  803763:	89 c6                	mov    %eax,%esi
+  803765:	89 d7                	mov    %edx,%edi
+  803767:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  80376a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80376f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803774:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  803779:	83 ef 01             	sub    $0x1,%edi
+  80377c:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  80377f:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  803782:	eb 34                	jmp    8037b8 <va_chunk_scan+0x5e>
+			i += 31;
+  803784:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  803787:	89 ca                	mov    %ecx,%edx
+			continue;
+  803789:	eb 23                	jmp    8037ae <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  80378b:	89 c7                	mov    %eax,%edi
+  80378d:	c1 ef 05             	shr    $0x5,%edi
+  803790:	be 01 00 00 00       	mov    $0x1,%esi
+  803795:	d3 e6                	shl    %cl,%esi
+  803797:	89 f1                	mov    %esi,%ecx
+  803799:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80379c:	23 0c be             	and    (%esi,%edi,4),%ecx
+  80379f:	75 41                	jne    8037e2 <va_chunk_scan+0x88>
+			len++;
+  8037a1:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  8037a4:	39 d3                	cmp    %edx,%ebx
+  8037a6:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  8037a9:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  8037ac:	72 2d                	jb     8037db <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8037ae:	83 c0 01             	add    $0x1,%eax
+  8037b1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8037b6:	77 31                	ja     8037e9 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  8037b8:	89 c1                	mov    %eax,%ecx
+  8037ba:	83 e1 1f             	and    $0x1f,%ecx
+  8037bd:	75 cc                	jne    80378b <va_chunk_scan+0x31>
+  8037bf:	89 c7                	mov    %eax,%edi
+  8037c1:	c1 ef 05             	shr    $0x5,%edi
+  8037c4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8037c7:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  8037ca:	83 ff ff             	cmp    $0xffffffff,%edi
+  8037cd:	74 b5                	je     803784 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  8037cf:	85 ff                	test   %edi,%edi
+  8037d1:	75 b8                	jne    80378b <va_chunk_scan+0x31>
+			i += 31;
+  8037d3:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  8037d6:	83 c2 20             	add    $0x20,%edx
+  8037d9:	eb c9                	jmp    8037a4 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  8037db:	83 c0 01             	add    $0x1,%eax
+  8037de:	29 d0                	sub    %edx,%eax
+  8037e0:	eb 15                	jmp    8037f7 <va_chunk_scan+0x9d>
+			len = 0;
+  8037e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037e7:	eb c5                	jmp    8037ae <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  8037e9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  8037ee:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  8037f1:	85 d2                	test   %edx,%edx
+  8037f3:	74 02                	je     8037f7 <va_chunk_scan+0x9d>
+		*run_store = best;
+  8037f5:	89 1a                	mov    %ebx,(%edx)
+}
+  8037f7:	83 c4 0c             	add    $0xc,%esp
+  8037fa:	5b                   	pop    %ebx
+  8037fb:	5e                   	pop    %esi
+  8037fc:	5f                   	pop    %edi
+  8037fd:	5d                   	pop    %ebp
+  8037fe:	c3                   	ret
+
+008037ff <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  8037ff:	55                   	push   %ebp
+  803800:	89 e5                	mov    %esp,%ebp
+  803802:	57                   	push   %edi
+  803803:	56                   	push   %esi
+  803804:	53                   	push   %ebx
+  803805:	83 ec 14             	sub    $0x14,%esp
+  803808:	89 c3                	mov    %eax,%ebx
+  80380a:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  80380c:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  803812:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  803818:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  80381b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  80381e:	89 d6                	mov    %edx,%esi
+  803820:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  803826:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  803828:	eb 34                	jmp    80385e <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  80382a:	89 c8                	mov    %ecx,%eax
+  80382c:	c1 e8 05             	shr    $0x5,%eax
+  80382f:	89 da                	mov    %ebx,%edx
+  803831:	c1 e2 05             	shl    $0x5,%edx
+  803834:	01 da                	add    %ebx,%edx
+  803836:	01 c2                	add    %eax,%edx
+  803838:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  80383d:	d3 c0                	rol    %cl,%eax
+  80383f:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  803846:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  80384d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803852:	01 d0                	add    %edx,%eax
+  803854:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  80385b:	83 c1 01             	add    $0x1,%ecx
+  80385e:	39 f9                	cmp    %edi,%ecx
+  803860:	74 30                	je     803892 <va_chunk_mark+0x93>
+		if (alloc)
+  803862:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803866:	74 c2                	je     80382a <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  803868:	89 c8                	mov    %ecx,%eax
+  80386a:	c1 e8 05             	shr    $0x5,%eax
+  80386d:	89 da                	mov    %ebx,%edx
+  80386f:	c1 e2 05             	shl    $0x5,%edx
+  803872:	01 da                	add    %ebx,%edx
+  803874:	01 c2                	add    %eax,%edx
+  803876:	b8 01 00 00 00       	mov    $0x1,%eax
+  80387b:	d3 e0                	shl    %cl,%eax
+  80387d:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  803884:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  80388b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803890:	eb c0                	jmp    803852 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  803892:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  803895:	ba 00 00 00 00       	mov    $0x0,%edx
+  80389a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80389d:	e8 b8 fe ff ff       	call   80375a <va_chunk_scan>
+	ch->run = run;
+  8038a2:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  8038a8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8038ab:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  8038b2:	83 c4 14             	add    $0x14,%esp
+  8038b5:	5b                   	pop    %ebx
+  8038b6:	5e                   	pop    %esi
+  8038b7:	5f                   	pop    %edi
+  8038b8:	5d                   	pop    %ebp
+  8038b9:	c3                   	ret
+
+008038ba <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  8038ba:	55                   	push   %ebp
+  8038bb:	89 e5                	mov    %esp,%ebp
+  8038bd:	57                   	push   %edi
+  8038be:	56                   	push   %esi
+  8038bf:	53                   	push   %ebx
+  8038c0:	83 ec 04             	sub    $0x4,%esp
+  8038c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  8038c6:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  8038cb:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  8038d0:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  8038d7:	74 4f                	je     803928 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  8038d9:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8038dc:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  8038e1:	0f 87 01 01 00 00    	ja     8039e8 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  8038e7:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  8038ed:	0f 87 80 00 00 00    	ja     803973 <va_alloc+0xb9>
+  8038f3:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  8038f8:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  8038fd:	0f b7 10             	movzwl (%eax),%edx
+  803900:	05 84 00 00 00       	add    $0x84,%eax
+  803905:	39 da                	cmp    %ebx,%edx
+  803907:	73 2c                	jae    803935 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  803909:	83 c6 01             	add    $0x1,%esi
+  80390c:	83 fe 1c             	cmp    $0x1c,%esi
+  80390f:	75 ec                	jne    8038fd <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  803911:	b8 00 00 00 00       	mov    $0x0,%eax
+  803916:	eb 53                	jmp    80396b <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  803918:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  80391e:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  803923:	05 84 00 00 00       	add    $0x84,%eax
+  803928:	39 d0                	cmp    %edx,%eax
+  80392a:	75 ec                	jne    803918 <va_alloc+0x5e>
+	va_inited = 1;
+  80392c:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  803933:	eb a4                	jmp    8038d9 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  803935:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  80393b:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  803940:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803945:	89 da                	mov    %ebx,%edx
+  803947:	e8 0e fe ff ff       	call   80375a <va_chunk_scan>
+  80394c:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  80394e:	6a 01                	push   $0x1
+  803950:	89 d9                	mov    %ebx,%ecx
+  803952:	89 c2                	mov    %eax,%edx
+  803954:	89 f0                	mov    %esi,%eax
+  803956:	e8 a4 fe ff ff       	call   8037ff <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  80395b:	c1 e6 16             	shl    $0x16,%esi
+  80395e:	c1 e7 0c             	shl    $0xc,%edi
+  803961:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  803968:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  80396b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80396e:	5b                   	pop    %ebx
+  80396f:	5e                   	pop    %esi
+  803970:	5f                   	pop    %edi
+  803971:	5d                   	pop    %ebp
+  803972:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  803973:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  803979:	c1 ee 0a             	shr    $0xa,%esi
+  80397c:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  803981:	b8 00 00 00 00       	mov    $0x0,%eax
+  803986:	eb 0a                	jmp    803992 <va_alloc+0xd8>
+			first = c + 1;
+  803988:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  80398a:	83 c2 01             	add    $0x1,%edx
+  80398d:	83 fa 1d             	cmp    $0x1d,%edx
+  803990:	74 4f                	je     8039e1 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  803992:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  803998:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  80399f:	00 04 
+  8039a1:	75 e5                	jne    803988 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  8039a3:	89 d1                	mov    %edx,%ecx
+  8039a5:	29 c1                	sub    %eax,%ecx
+  8039a7:	39 f1                	cmp    %esi,%ecx
+  8039a9:	75 df                	jne    80398a <va_alloc+0xd0>
+  8039ab:	89 c7                	mov    %eax,%edi
+  8039ad:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  8039b0:	be 00 04 00 00       	mov    $0x400,%esi
+  8039b5:	39 f3                	cmp    %esi,%ebx
+  8039b7:	0f 46 f3             	cmovbe %ebx,%esi
+  8039ba:	6a 01                	push   $0x1
+  8039bc:	89 f1                	mov    %esi,%ecx
+  8039be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039c3:	89 f8                	mov    %edi,%eax
+  8039c5:	e8 35 fe ff ff       	call   8037ff <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  8039ca:	83 c7 01             	add    $0x1,%edi
+  8039cd:	83 c4 04             	add    $0x4,%esp
+  8039d0:	29 f3                	sub    %esi,%ebx
+  8039d2:	75 dc                	jne    8039b0 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  8039d4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8039d7:	c1 e0 16             	shl    $0x16,%eax
+  8039da:	05 00 00 00 08       	add    $0x8000000,%eax
+  8039df:	eb 8a                	jmp    80396b <va_alloc+0xb1>
+	return NULL;
+  8039e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039e6:	eb 83                	jmp    80396b <va_alloc+0xb1>
+		return NULL;
+  8039e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ed:	e9 79 ff ff ff       	jmp    80396b <va_alloc+0xb1>
+
+008039f2 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  8039f2:	55                   	push   %ebp
+  8039f3:	89 e5                	mov    %esp,%ebp
+  8039f5:	57                   	push   %edi
+  8039f6:	56                   	push   %esi
+  8039f7:	53                   	push   %ebx
+  8039f8:	83 ec 0c             	sub    $0xc,%esp
+  8039fb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8039fe:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  803a01:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  803a07:	76 21                	jbe    803a2a <va_free+0x38>
+  803a09:	89 f0                	mov    %esi,%eax
+  803a0b:	c1 e0 0c             	shl    $0xc,%eax
+  803a0e:	01 f8                	add    %edi,%eax
+  803a10:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  803a15:	77 13                	ja     803a2a <va_free+0x38>
+	    || PGOFF(va))
+  803a17:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803a1d:	75 0b                	jne    803a2a <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  803a1f:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  803a25:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  803a28:	eb 45                	jmp    803a6f <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  803a2a:	83 ec 0c             	sub    $0xc,%esp
+  803a2d:	56                   	push   %esi
+  803a2e:	57                   	push   %edi
+  803a2f:	68 fc 52 80 00       	push   $0x8052fc
+  803a34:	68 8e 00 00 00       	push   $0x8e
+  803a39:	68 1c 53 80 00       	push   $0x80531c
+  803a3e:	e8 ac 01 00 00       	call   803bef <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  803a43:	89 fa                	mov    %edi,%edx
+  803a45:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803a4b:	bb 00 04 00 00       	mov    $0x400,%ebx
+  803a50:	29 d3                	sub    %edx,%ebx
+  803a52:	39 f3                	cmp    %esi,%ebx
+  803a54:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  803a57:	89 f8                	mov    %edi,%eax
+  803a59:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  803a5c:	83 ec 0c             	sub    $0xc,%esp
+  803a5f:	6a 00                	push   $0x0
+  803a61:	89 d9                	mov    %ebx,%ecx
+  803a63:	e8 97 fd ff ff       	call   8037ff <va_chunk_mark>
+		i += n;
+  803a68:	01 df                	add    %ebx,%edi
+		npages -= n;
+  803a6a:	29 de                	sub    %ebx,%esi
+  803a6c:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  803a6f:	85 f6                	test   %esi,%esi
+  803a71:	75 d0                	jne    803a43 <va_free+0x51>
+	}
+}
+  803a73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a76:	5b                   	pop    %ebx
+  803a77:	5e                   	pop    %esi
+  803a78:	5f                   	pop    %edi
+  803a79:	5d                   	pop    %ebp
+  803a7a:	c3                   	ret
+
+00803a7b <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a80:	c3                   	ret
+
+00803a81 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803a81:	55                   	push   %ebp
+  803a82:	89 e5                	mov    %esp,%ebp
+  803a84:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803a87:	68 29 53 80 00       	push   $0x805329
+  803a8c:	ff 75 0c             	push   0xc(%ebp)
+  803a8f:	e8 1d 08 00 00       	call   8042b1 <strcpy>
+	return 0;
+}
+  803a94:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a99:	c9                   	leave
+  803a9a:	c3                   	ret
+
+00803a9b <devcons_write>:
+{
+  803a9b:	55                   	push   %ebp
+  803a9c:	89 e5                	mov    %esp,%ebp
+  803a9e:	57                   	push   %edi
+  803a9f:	56                   	push   %esi
+  803aa0:	53                   	push   %ebx
+  803aa1:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803aa7:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803aac:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803ab2:	eb 2e                	jmp    803ae2 <devcons_write+0x47>
+		m = n - tot;
+  803ab4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803ab7:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803ab9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803abe:	39 c3                	cmp    %eax,%ebx
+  803ac0:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803ac3:	83 ec 04             	sub    $0x4,%esp
+  803ac6:	53                   	push   %ebx
+  803ac7:	89 f0                	mov    %esi,%eax
+  803ac9:	03 45 0c             	add    0xc(%ebp),%eax
+  803acc:	50                   	push   %eax
+  803acd:	57                   	push   %edi
+  803ace:	e8 64 09 00 00       	call   804437 <memmove>
+		sys_cputs(buf, m);
+  803ad3:	83 c4 08             	add    $0x8,%esp
+  803ad6:	53                   	push   %ebx
+  803ad7:	57                   	push   %edi
+  803ad8:	e8 13 c6 ff ff       	call   8000f0 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803add:	01 de                	add    %ebx,%esi
+  803adf:	83 c4 10             	add    $0x10,%esp
+  803ae2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803ae5:	72 cd                	jb     803ab4 <devcons_write+0x19>
+}
+  803ae7:	89 f0                	mov    %esi,%eax
+  803ae9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803aec:	5b                   	pop    %ebx
+  803aed:	5e                   	pop    %esi
+  803aee:	5f                   	pop    %edi
+  803aef:	5d                   	pop    %ebp
+  803af0:	c3                   	ret
+
+00803af1 <devcons_read>:
+{
+  803af1:	55                   	push   %ebp
+  803af2:	89 e5                	mov    %esp,%ebp
+  803af4:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803afc:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803b00:	75 07                	jne    803b09 <devcons_read+0x18>
+  803b02:	eb 1f                	jmp    803b23 <devcons_read+0x32>
+		sys_yield();
+  803b04:	e8 95 c6 ff ff       	call   80019e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803b09:	e8 11 c6 ff ff       	call   80011f <sys_cgetc>
+  803b0e:	85 c0                	test   %eax,%eax
+  803b10:	74 f2                	je     803b04 <devcons_read+0x13>
+	if (c < 0)
+  803b12:	78 0f                	js     803b23 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803b14:	83 f8 04             	cmp    $0x4,%eax
+  803b17:	74 0c                	je     803b25 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803b19:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803b1c:	88 02                	mov    %al,(%edx)
+	return 1;
+  803b1e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803b23:	c9                   	leave
+  803b24:	c3                   	ret
+		return 0;
+  803b25:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b2a:	eb f7                	jmp    803b23 <devcons_read+0x32>
+
+00803b2c <cputchar>:
+{
+  803b2c:	55                   	push   %ebp
+  803b2d:	89 e5                	mov    %esp,%ebp
+  803b2f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803b32:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b35:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803b38:	6a 01                	push   $0x1
+  803b3a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803b3d:	50                   	push   %eax
+  803b3e:	e8 ad c5 ff ff       	call   8000f0 <sys_cputs>
+}
+  803b43:	83 c4 10             	add    $0x10,%esp
+  803b46:	c9                   	leave
+  803b47:	c3                   	ret
+
+00803b48 <getchar>:
+{
+  803b48:	55                   	push   %ebp
+  803b49:	89 e5                	mov    %esp,%ebp
+  803b4b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803b4e:	6a 01                	push   $0x1
+  803b50:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803b53:	50                   	push   %eax
+  803b54:	6a 00                	push   $0x0
+  803b56:	e8 d7 ce ff ff       	call   800a32 <read>
+	if (r < 0)
+  803b5b:	83 c4 10             	add    $0x10,%esp
+  803b5e:	85 c0                	test   %eax,%eax
+  803b60:	78 06                	js     803b68 <getchar+0x20>
+	if (r < 1)
+  803b62:	74 06                	je     803b6a <getchar+0x22>
+	return c;
+  803b64:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803b68:	c9                   	leave
+  803b69:	c3                   	ret
+		return -E_EOF;
+  803b6a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803b6f:	eb f7                	jmp    803b68 <getchar+0x20>
+
+00803b71 <iscons>:
+{
+  803b71:	55                   	push   %ebp
+  803b72:	89 e5                	mov    %esp,%ebp
+  803b74:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b77:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b7a:	50                   	push   %eax
+  803b7b:	ff 75 08             	push   0x8(%ebp)
+  803b7e:	e8 50 cc ff ff       	call   8007d3 <fd_lookup>
+  803b83:	83 c4 10             	add    $0x10,%esp
+  803b86:	85 c0                	test   %eax,%eax
+  803b88:	78 11                	js     803b9b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803b8a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b8d:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  803b93:	39 10                	cmp    %edx,(%eax)
+  803b95:	0f 94 c0             	sete   %al
+  803b98:	0f b6 c0             	movzbl %al,%eax
+}
+  803b9b:	c9                   	leave
+  803b9c:	c3                   	ret
+
+00803b9d <opencons>:
+{
+  803b9d:	55                   	push   %ebp
+  803b9e:	89 e5                	mov    %esp,%ebp
+  803ba0:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803ba3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ba6:	50                   	push   %eax
+  803ba7:	e8 d3 cb ff ff       	call   80077f <fd_alloc>
+  803bac:	83 c4 10             	add    $0x10,%esp
+  803baf:	85 c0                	test   %eax,%eax
+  803bb1:	78 3a                	js     803bed <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803bb3:	83 ec 04             	sub    $0x4,%esp
+  803bb6:	68 07 04 00 00       	push   $0x407
+  803bbb:	ff 75 f4             	push   -0xc(%ebp)
+  803bbe:	6a 00                	push   $0x0
+  803bc0:	e8 f8 c5 ff ff       	call   8001bd <sys_page_alloc>
+  803bc5:	83 c4 10             	add    $0x10,%esp
+  803bc8:	85 c0                	test   %eax,%eax
+  803bca:	78 21                	js     803bed <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803bcc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803bcf:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  803bd5:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803bd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803bda:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803be1:	83 ec 0c             	sub    $0xc,%esp
+  803be4:	50                   	push   %eax
+  803be5:	e8 6e cb ff ff       	call   800758 <fd2num>
+  803bea:	83 c4 10             	add    $0x10,%esp
+}
+  803bed:	c9                   	leave
+  803bee:	c3                   	ret
+
+00803bef <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803bef:	55                   	push   %ebp
+  803bf0:	89 e5                	mov    %esp,%ebp
+  803bf2:	56                   	push   %esi
+  803bf3:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803bf4:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803bf7:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  803bfd:	e8 7d c5 ff ff       	call   80017f <sys_getenvid>
+  803c02:	83 ec 0c             	sub    $0xc,%esp
+  803c05:	ff 75 0c             	push   0xc(%ebp)
+  803c08:	ff 75 08             	push   0x8(%ebp)
+  803c0b:	56                   	push   %esi
+  803c0c:	50                   	push   %eax
+  803c0d:	68 38 53 80 00       	push   $0x805338
+  803c12:	e8 b3 00 00 00       	call   803cca <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803c17:	83 c4 18             	add    $0x18,%esp
+  803c1a:	53                   	push   %ebx
+  803c1b:	ff 75 10             	push   0x10(%ebp)
+  803c1e:	e8 56 00 00 00       	call   803c79 <vcprintf>
+	cprintf("\n");
+  803c23:	c7 04 24 f1 4d 80 00 	movl   $0x804df1,(%esp)
+  803c2a:	e8 9b 00 00 00       	call   803cca <cprintf>
+  803c2f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803c32:	cc                   	int3
+	while (1)
+  803c33:	eb fd                	jmp    803c32 <_panic+0x43>
+
+00803c35 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  803c35:	55                   	push   %ebp
+  803c36:	89 e5                	mov    %esp,%ebp
+  803c38:	53                   	push   %ebx
+  803c39:	83 ec 04             	sub    $0x4,%esp
+  803c3c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  803c3f:	8b 13                	mov    (%ebx),%edx
+  803c41:	8d 42 01             	lea    0x1(%edx),%eax
+  803c44:	89 03                	mov    %eax,(%ebx)
+  803c46:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803c49:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  803c4d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  803c52:	74 09                	je     803c5d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  803c54:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  803c58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c5b:	c9                   	leave
+  803c5c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  803c5d:	83 ec 08             	sub    $0x8,%esp
+  803c60:	68 ff 00 00 00       	push   $0xff
+  803c65:	8d 43 08             	lea    0x8(%ebx),%eax
+  803c68:	50                   	push   %eax
+  803c69:	e8 82 c4 ff ff       	call   8000f0 <sys_cputs>
+		b->idx = 0;
+  803c6e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803c74:	83 c4 10             	add    $0x10,%esp
+  803c77:	eb db                	jmp    803c54 <putch+0x1f>
+
+00803c79 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  803c79:	55                   	push   %ebp
+  803c7a:	89 e5                	mov    %esp,%ebp
+  803c7c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  803c82:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  803c89:	00 00 00 
+	b.cnt = 0;
+  803c8c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  803c93:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  803c96:	ff 75 0c             	push   0xc(%ebp)
+  803c99:	ff 75 08             	push   0x8(%ebp)
+  803c9c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  803ca2:	50                   	push   %eax
+  803ca3:	68 35 3c 80 00       	push   $0x803c35
+  803ca8:	e8 14 01 00 00       	call   803dc1 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  803cad:	83 c4 08             	add    $0x8,%esp
+  803cb0:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  803cb6:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  803cbc:	50                   	push   %eax
+  803cbd:	e8 2e c4 ff ff       	call   8000f0 <sys_cputs>
+
+	return b.cnt;
+}
+  803cc2:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  803cc8:	c9                   	leave
+  803cc9:	c3                   	ret
+
+00803cca <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  803cca:	55                   	push   %ebp
+  803ccb:	89 e5                	mov    %esp,%ebp
+  803ccd:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  803cd0:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  803cd3:	50                   	push   %eax
+  803cd4:	ff 75 08             	push   0x8(%ebp)
+  803cd7:	e8 9d ff ff ff       	call   803c79 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  803cdc:	c9                   	leave
+  803cdd:	c3                   	ret
+
+00803cde <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  803cde:	55                   	push   %ebp
+  803cdf:	89 e5                	mov    %esp,%ebp
+  803ce1:	57                   	push   %edi
+  803ce2:	56                   	push   %esi
+  803ce3:	53                   	push   %ebx
+  803ce4:	83 ec 1c             	sub    $0x1c,%esp
+  803ce7:	89 c7                	mov    %eax,%edi
+  803ce9:	89 d6                	mov    %edx,%esi
+  803ceb:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803cf1:	89 d1                	mov    %edx,%ecx
+  803cf3:	89 c2                	mov    %eax,%edx
+  803cf5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803cf8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803cfb:	8b 45 10             	mov    0x10(%ebp),%eax
+  803cfe:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  803d01:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803d04:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803d0b:	39 c2                	cmp    %eax,%edx
+  803d0d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  803d10:	72 3e                	jb     803d50 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  803d12:	83 ec 0c             	sub    $0xc,%esp
+  803d15:	ff 75 18             	push   0x18(%ebp)
+  803d18:	83 eb 01             	sub    $0x1,%ebx
+  803d1b:	53                   	push   %ebx
+  803d1c:	50                   	push   %eax
+  803d1d:	83 ec 08             	sub    $0x8,%esp
+  803d20:	ff 75 e4             	push   -0x1c(%ebp)
+  803d23:	ff 75 e0             	push   -0x20(%ebp)
+  803d26:	ff 75 dc             	push   -0x24(%ebp)
+  803d29:	ff 75 d8             	push   -0x28(%ebp)
+  803d2c:	e8 29 0e 00 00       	call   804b5a <__udivdi3>
+  803d31:	83 c4 18             	add    $0x18,%esp
+  803d34:	52                   	push   %edx
+  803d35:	50                   	push   %eax
+  803d36:	89 f2                	mov    %esi,%edx
+  803d38:	89 f8                	mov    %edi,%eax
+  803d3a:	e8 9f ff ff ff       	call   803cde <printnum>
+  803d3f:	83 c4 20             	add    $0x20,%esp
+  803d42:	eb 13                	jmp    803d57 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  803d44:	83 ec 08             	sub    $0x8,%esp
+  803d47:	56                   	push   %esi
+  803d48:	ff 75 18             	push   0x18(%ebp)
+  803d4b:	ff d7                	call   *%edi
+  803d4d:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  803d50:	83 eb 01             	sub    $0x1,%ebx
+  803d53:	85 db                	test   %ebx,%ebx
+  803d55:	7f ed                	jg     803d44 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  803d57:	83 ec 08             	sub    $0x8,%esp
+  803d5a:	56                   	push   %esi
+  803d5b:	83 ec 04             	sub    $0x4,%esp
+  803d5e:	ff 75 e4             	push   -0x1c(%ebp)
+  803d61:	ff 75 e0             	push   -0x20(%ebp)
+  803d64:	ff 75 dc             	push   -0x24(%ebp)
+  803d67:	ff 75 d8             	push   -0x28(%ebp)
+  803d6a:	e8 09 0e 00 00       	call   804b78 <__umoddi3>
+  803d6f:	83 c4 14             	add    $0x14,%esp
+  803d72:	0f be 80 5b 53 80 00 	movsbl 0x80535b(%eax),%eax
+  803d79:	50                   	push   %eax
+  803d7a:	ff d7                	call   *%edi
+}
+  803d7c:	83 c4 10             	add    $0x10,%esp
+  803d7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d82:	5b                   	pop    %ebx
+  803d83:	5e                   	pop    %esi
+  803d84:	5f                   	pop    %edi
+  803d85:	5d                   	pop    %ebp
+  803d86:	c3                   	ret
+
+00803d87 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  803d87:	55                   	push   %ebp
+  803d88:	89 e5                	mov    %esp,%ebp
+  803d8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  803d8d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  803d91:	8b 10                	mov    (%eax),%edx
+  803d93:	3b 50 04             	cmp    0x4(%eax),%edx
+  803d96:	73 0a                	jae    803da2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  803d98:	8d 4a 01             	lea    0x1(%edx),%ecx
+  803d9b:	89 08                	mov    %ecx,(%eax)
+  803d9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803da0:	88 02                	mov    %al,(%edx)
+}
+  803da2:	5d                   	pop    %ebp
+  803da3:	c3                   	ret
+
+00803da4 <printfmt>:
+{
+  803da4:	55                   	push   %ebp
+  803da5:	89 e5                	mov    %esp,%ebp
+  803da7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  803daa:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  803dad:	50                   	push   %eax
+  803dae:	ff 75 10             	push   0x10(%ebp)
+  803db1:	ff 75 0c             	push   0xc(%ebp)
+  803db4:	ff 75 08             	push   0x8(%ebp)
+  803db7:	e8 05 00 00 00       	call   803dc1 <vprintfmt>
+}
+  803dbc:	83 c4 10             	add    $0x10,%esp
+  803dbf:	c9                   	leave
+  803dc0:	c3                   	ret
+
+00803dc1 <vprintfmt>:
+{
+  803dc1:	55                   	push   %ebp
+  803dc2:	89 e5                	mov    %esp,%ebp
+  803dc4:	57                   	push   %edi
+  803dc5:	56                   	push   %esi
+  803dc6:	53                   	push   %ebx
+  803dc7:	83 ec 2c             	sub    $0x2c,%esp
+  803dca:	8b 75 08             	mov    0x8(%ebp),%esi
+  803dcd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803dd0:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803dd3:	eb 0a                	jmp    803ddf <vprintfmt+0x1e>
+			putch(ch, putdat);
+  803dd5:	83 ec 08             	sub    $0x8,%esp
+  803dd8:	53                   	push   %ebx
+  803dd9:	50                   	push   %eax
+  803dda:	ff d6                	call   *%esi
+  803ddc:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  803ddf:	83 c7 01             	add    $0x1,%edi
+  803de2:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  803de6:	83 f8 25             	cmp    $0x25,%eax
+  803de9:	74 0c                	je     803df7 <vprintfmt+0x36>
+			if (ch == '\0')
+  803deb:	85 c0                	test   %eax,%eax
+  803ded:	75 e6                	jne    803dd5 <vprintfmt+0x14>
+}
+  803def:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803df2:	5b                   	pop    %ebx
+  803df3:	5e                   	pop    %esi
+  803df4:	5f                   	pop    %edi
+  803df5:	5d                   	pop    %ebp
+  803df6:	c3                   	ret
+		padc = ' ';
+  803df7:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  803dfb:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  803e02:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  803e09:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  803e10:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  803e15:	8d 47 01             	lea    0x1(%edi),%eax
+  803e18:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803e1b:	0f b6 17             	movzbl (%edi),%edx
+  803e1e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  803e21:	3c 55                	cmp    $0x55,%al
+  803e23:	0f 87 c5 03 00 00    	ja     8041ee <vprintfmt+0x42d>
+  803e29:	0f b6 c0             	movzbl %al,%eax
+  803e2c:	ff 24 85 e0 54 80 00 	jmp    *0x8054e0(,%eax,4)
+  803e33:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  803e36:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  803e3a:	eb d9                	jmp    803e15 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  803e3c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803e3f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  803e43:	eb d0                	jmp    803e15 <vprintfmt+0x54>
+  803e45:	0f b6 d2             	movzbl %dl,%edx
+  803e48:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  803e4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e50:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  803e53:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  803e56:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  803e5a:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  803e5d:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  803e60:	83 f9 09             	cmp    $0x9,%ecx
+  803e63:	77 55                	ja     803eba <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  803e65:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  803e68:	eb e9                	jmp    803e53 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  803e6a:	8b 45 14             	mov    0x14(%ebp),%eax
+  803e6d:	8b 00                	mov    (%eax),%eax
+  803e6f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803e72:	8b 45 14             	mov    0x14(%ebp),%eax
+  803e75:	8d 40 04             	lea    0x4(%eax),%eax
+  803e78:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  803e7b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  803e7e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  803e82:	79 91                	jns    803e15 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  803e84:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803e87:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803e8a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  803e91:	eb 82                	jmp    803e15 <vprintfmt+0x54>
+			if (width < 0)
+  803e93:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803e96:	85 d2                	test   %edx,%edx
+  803e98:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e9d:	0f 49 c2             	cmovns %edx,%eax
+  803ea0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  803ea3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  803ea6:	e9 6a ff ff ff       	jmp    803e15 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  803eab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  803eae:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  803eb5:	e9 5b ff ff ff       	jmp    803e15 <vprintfmt+0x54>
+  803eba:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803ebd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803ec0:	eb bc                	jmp    803e7e <vprintfmt+0xbd>
+			lflag++;
+  803ec2:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  803ec5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  803ec8:	e9 48 ff ff ff       	jmp    803e15 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  803ecd:	8b 45 14             	mov    0x14(%ebp),%eax
+  803ed0:	8d 78 04             	lea    0x4(%eax),%edi
+  803ed3:	83 ec 08             	sub    $0x8,%esp
+  803ed6:	53                   	push   %ebx
+  803ed7:	ff 30                	push   (%eax)
+  803ed9:	ff d6                	call   *%esi
+			break;
+  803edb:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  803ede:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  803ee1:	e9 63 02 00 00       	jmp    804149 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  803ee6:	8b 45 14             	mov    0x14(%ebp),%eax
+  803ee9:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  803eec:	8b 10                	mov    (%eax),%edx
+  803eee:	89 d0                	mov    %edx,%eax
+  803ef0:	f7 d8                	neg    %eax
+  803ef2:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  803ef5:	83 f8 12             	cmp    $0x12,%eax
+  803ef8:	7f 23                	jg     803f1d <vprintfmt+0x15c>
+  803efa:	8b 14 85 40 56 80 00 	mov    0x805640(,%eax,4),%edx
+  803f01:	85 d2                	test   %edx,%edx
+  803f03:	74 18                	je     803f1d <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  803f05:	52                   	push   %edx
+  803f06:	68 7d 4d 80 00       	push   $0x804d7d
+  803f0b:	53                   	push   %ebx
+  803f0c:	56                   	push   %esi
+  803f0d:	e8 92 fe ff ff       	call   803da4 <printfmt>
+  803f12:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  803f15:	89 7d 14             	mov    %edi,0x14(%ebp)
+  803f18:	e9 2c 02 00 00       	jmp    804149 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  803f1d:	50                   	push   %eax
+  803f1e:	68 73 53 80 00       	push   $0x805373
+  803f23:	53                   	push   %ebx
+  803f24:	56                   	push   %esi
+  803f25:	e8 7a fe ff ff       	call   803da4 <printfmt>
+  803f2a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  803f2d:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  803f30:	e9 14 02 00 00       	jmp    804149 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  803f35:	8b 45 14             	mov    0x14(%ebp),%eax
+  803f38:	83 c0 04             	add    $0x4,%eax
+  803f3b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  803f3e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803f41:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  803f43:	85 c9                	test   %ecx,%ecx
+  803f45:	b8 6c 53 80 00       	mov    $0x80536c,%eax
+  803f4a:	0f 45 c1             	cmovne %ecx,%eax
+  803f4d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  803f50:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  803f54:	7e 06                	jle    803f5c <vprintfmt+0x19b>
+  803f56:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  803f5a:	75 0b                	jne    803f67 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803f5c:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  803f5f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  803f62:	89 75 08             	mov    %esi,0x8(%ebp)
+  803f65:	eb 5c                	jmp    803fc3 <vprintfmt+0x202>
+  803f67:	83 ec 08             	sub    $0x8,%esp
+  803f6a:	ff 75 d0             	push   -0x30(%ebp)
+  803f6d:	ff 75 cc             	push   -0x34(%ebp)
+  803f70:	e8 19 03 00 00       	call   80428e <strnlen>
+  803f75:	89 c2                	mov    %eax,%edx
+  803f77:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803f7a:	29 d0                	sub    %edx,%eax
+  803f7c:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  803f7f:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  803f83:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803f86:	89 75 08             	mov    %esi,0x8(%ebp)
+  803f89:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803f8b:	eb 0e                	jmp    803f9b <vprintfmt+0x1da>
+					putch(padc, putdat);
+  803f8d:	83 ec 08             	sub    $0x8,%esp
+  803f90:	53                   	push   %ebx
+  803f91:	57                   	push   %edi
+  803f92:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  803f95:	83 ee 01             	sub    $0x1,%esi
+  803f98:	83 c4 10             	add    $0x10,%esp
+  803f9b:	85 f6                	test   %esi,%esi
+  803f9d:	7f ee                	jg     803f8d <vprintfmt+0x1cc>
+  803f9f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803fa2:	8b 75 08             	mov    0x8(%ebp),%esi
+  803fa5:	85 c0                	test   %eax,%eax
+  803fa7:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fac:	0f 49 d0             	cmovns %eax,%edx
+  803faf:	29 d0                	sub    %edx,%eax
+  803fb1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803fb4:	eb a6                	jmp    803f5c <vprintfmt+0x19b>
+					putch(ch, putdat);
+  803fb6:	83 ec 08             	sub    $0x8,%esp
+  803fb9:	53                   	push   %ebx
+  803fba:	52                   	push   %edx
+  803fbb:	ff 55 08             	call   *0x8(%ebp)
+  803fbe:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803fc1:	89 f1                	mov    %esi,%ecx
+  803fc3:	8d 71 01             	lea    0x1(%ecx),%esi
+  803fc6:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  803fca:	0f be d0             	movsbl %al,%edx
+  803fcd:	85 d2                	test   %edx,%edx
+  803fcf:	74 28                	je     803ff9 <vprintfmt+0x238>
+  803fd1:	85 ff                	test   %edi,%edi
+  803fd3:	78 05                	js     803fda <vprintfmt+0x219>
+  803fd5:	83 ef 01             	sub    $0x1,%edi
+  803fd8:	78 30                	js     80400a <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  803fda:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  803fde:	74 d6                	je     803fb6 <vprintfmt+0x1f5>
+  803fe0:	0f be c0             	movsbl %al,%eax
+  803fe3:	83 e8 20             	sub    $0x20,%eax
+  803fe6:	83 f8 5e             	cmp    $0x5e,%eax
+  803fe9:	76 cb                	jbe    803fb6 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  803feb:	83 ec 08             	sub    $0x8,%esp
+  803fee:	53                   	push   %ebx
+  803fef:	6a 3f                	push   $0x3f
+  803ff1:	ff 55 08             	call   *0x8(%ebp)
+  803ff4:	83 c4 10             	add    $0x10,%esp
+  803ff7:	eb c8                	jmp    803fc1 <vprintfmt+0x200>
+  803ff9:	8b 75 08             	mov    0x8(%ebp),%esi
+  803ffc:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  803fff:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804002:	01 d0                	add    %edx,%eax
+  804004:	29 c8                	sub    %ecx,%eax
+  804006:	89 c7                	mov    %eax,%edi
+  804008:	eb 13                	jmp    80401d <vprintfmt+0x25c>
+  80400a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80400d:	eb ed                	jmp    803ffc <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80400f:	83 ec 08             	sub    $0x8,%esp
+  804012:	53                   	push   %ebx
+  804013:	6a 20                	push   $0x20
+  804015:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  804017:	83 ef 01             	sub    $0x1,%edi
+  80401a:	83 c4 10             	add    $0x10,%esp
+  80401d:	85 ff                	test   %edi,%edi
+  80401f:	7f ee                	jg     80400f <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  804021:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  804024:	89 45 14             	mov    %eax,0x14(%ebp)
+  804027:	e9 1d 01 00 00       	jmp    804149 <vprintfmt+0x388>
+	if (lflag >= 2)
+  80402c:	83 f9 01             	cmp    $0x1,%ecx
+  80402f:	7f 1b                	jg     80404c <vprintfmt+0x28b>
+	else if (lflag)
+  804031:	85 c9                	test   %ecx,%ecx
+  804033:	74 63                	je     804098 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  804035:	8b 45 14             	mov    0x14(%ebp),%eax
+  804038:	8b 00                	mov    (%eax),%eax
+  80403a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80403d:	99                   	cltd
+  80403e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  804041:	8b 45 14             	mov    0x14(%ebp),%eax
+  804044:	8d 40 04             	lea    0x4(%eax),%eax
+  804047:	89 45 14             	mov    %eax,0x14(%ebp)
+  80404a:	eb 17                	jmp    804063 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80404c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80404f:	8b 50 04             	mov    0x4(%eax),%edx
+  804052:	8b 00                	mov    (%eax),%eax
+  804054:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  804057:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80405a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80405d:	8d 40 08             	lea    0x8(%eax),%eax
+  804060:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  804063:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  804066:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  804069:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80406e:	85 c9                	test   %ecx,%ecx
+  804070:	0f 89 b9 00 00 00    	jns    80412f <vprintfmt+0x36e>
+				putch('-', putdat);
+  804076:	83 ec 08             	sub    $0x8,%esp
+  804079:	53                   	push   %ebx
+  80407a:	6a 2d                	push   $0x2d
+  80407c:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80407e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  804081:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  804084:	f7 da                	neg    %edx
+  804086:	83 d1 00             	adc    $0x0,%ecx
+  804089:	f7 d9                	neg    %ecx
+  80408b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80408e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804093:	e9 97 00 00 00       	jmp    80412f <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  804098:	8b 45 14             	mov    0x14(%ebp),%eax
+  80409b:	8b 00                	mov    (%eax),%eax
+  80409d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8040a0:	99                   	cltd
+  8040a1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8040a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8040a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8040aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8040ad:	eb b4                	jmp    804063 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8040af:	83 f9 01             	cmp    $0x1,%ecx
+  8040b2:	7f 1b                	jg     8040cf <vprintfmt+0x30e>
+	else if (lflag)
+  8040b4:	85 c9                	test   %ecx,%ecx
+  8040b6:	74 2c                	je     8040e4 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8040b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8040bb:	8b 10                	mov    (%eax),%edx
+  8040bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8040c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8040c5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8040c8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8040cd:	eb 60                	jmp    80412f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8040cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8040d2:	8b 10                	mov    (%eax),%edx
+  8040d4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8040d7:	8d 40 08             	lea    0x8(%eax),%eax
+  8040da:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8040dd:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8040e2:	eb 4b                	jmp    80412f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8040e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8040e7:	8b 10                	mov    (%eax),%edx
+  8040e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8040ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8040f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8040f4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8040f9:	eb 34                	jmp    80412f <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8040fb:	83 f9 01             	cmp    $0x1,%ecx
+  8040fe:	7f 15                	jg     804115 <vprintfmt+0x354>
+	else if (lflag)
+  804100:	85 c9                	test   %ecx,%ecx
+  804102:	74 4d                	je     804151 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  804104:	8b 45 14             	mov    0x14(%ebp),%eax
+  804107:	8b 00                	mov    (%eax),%eax
+  804109:	99                   	cltd
+  80410a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80410d:	8d 49 04             	lea    0x4(%ecx),%ecx
+  804110:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  804113:	eb 11                	jmp    804126 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  804115:	8b 45 14             	mov    0x14(%ebp),%eax
+  804118:	8b 50 04             	mov    0x4(%eax),%edx
+  80411b:	8b 00                	mov    (%eax),%eax
+  80411d:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  804120:	8d 49 08             	lea    0x8(%ecx),%ecx
+  804123:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  804126:	89 d1                	mov    %edx,%ecx
+  804128:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  80412a:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80412f:	83 ec 0c             	sub    $0xc,%esp
+  804132:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  804136:	50                   	push   %eax
+  804137:	ff 75 e0             	push   -0x20(%ebp)
+  80413a:	57                   	push   %edi
+  80413b:	51                   	push   %ecx
+  80413c:	52                   	push   %edx
+  80413d:	89 da                	mov    %ebx,%edx
+  80413f:	89 f0                	mov    %esi,%eax
+  804141:	e8 98 fb ff ff       	call   803cde <printnum>
+			break;
+  804146:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  804149:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80414c:	e9 8e fc ff ff       	jmp    803ddf <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  804151:	8b 45 14             	mov    0x14(%ebp),%eax
+  804154:	8b 00                	mov    (%eax),%eax
+  804156:	99                   	cltd
+  804157:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80415a:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80415d:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  804160:	eb c4                	jmp    804126 <vprintfmt+0x365>
+			putch('0', putdat);
+  804162:	83 ec 08             	sub    $0x8,%esp
+  804165:	53                   	push   %ebx
+  804166:	6a 30                	push   $0x30
+  804168:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80416a:	83 c4 08             	add    $0x8,%esp
+  80416d:	53                   	push   %ebx
+  80416e:	6a 78                	push   $0x78
+  804170:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  804172:	8b 45 14             	mov    0x14(%ebp),%eax
+  804175:	8b 10                	mov    (%eax),%edx
+  804177:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80417c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80417f:	8d 40 04             	lea    0x4(%eax),%eax
+  804182:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  804185:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  80418a:	eb a3                	jmp    80412f <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80418c:	83 f9 01             	cmp    $0x1,%ecx
+  80418f:	7f 1b                	jg     8041ac <vprintfmt+0x3eb>
+	else if (lflag)
+  804191:	85 c9                	test   %ecx,%ecx
+  804193:	74 2f                	je     8041c4 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  804195:	8b 45 14             	mov    0x14(%ebp),%eax
+  804198:	8b 10                	mov    (%eax),%edx
+  80419a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80419f:	8d 40 04             	lea    0x4(%eax),%eax
+  8041a2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8041a5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8041aa:	eb 83                	jmp    80412f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8041ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8041af:	8b 10                	mov    (%eax),%edx
+  8041b1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8041b4:	8d 40 08             	lea    0x8(%eax),%eax
+  8041b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8041ba:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8041bf:	e9 6b ff ff ff       	jmp    80412f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8041c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8041c7:	8b 10                	mov    (%eax),%edx
+  8041c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8041ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8041d1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8041d4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8041d9:	e9 51 ff ff ff       	jmp    80412f <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8041de:	83 ec 08             	sub    $0x8,%esp
+  8041e1:	53                   	push   %ebx
+  8041e2:	6a 25                	push   $0x25
+  8041e4:	ff d6                	call   *%esi
+			break;
+  8041e6:	83 c4 10             	add    $0x10,%esp
+  8041e9:	e9 5b ff ff ff       	jmp    804149 <vprintfmt+0x388>
+			putch('%', putdat);
+  8041ee:	83 ec 08             	sub    $0x8,%esp
+  8041f1:	53                   	push   %ebx
+  8041f2:	6a 25                	push   $0x25
+  8041f4:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8041f6:	83 c4 10             	add    $0x10,%esp
+  8041f9:	89 f8                	mov    %edi,%eax
+  8041fb:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8041ff:	74 05                	je     804206 <vprintfmt+0x445>
+  804201:	83 e8 01             	sub    $0x1,%eax
+  804204:	eb f5                	jmp    8041fb <vprintfmt+0x43a>
+  804206:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804209:	e9 3b ff ff ff       	jmp    804149 <vprintfmt+0x388>
+
+0080420e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80420e:	55                   	push   %ebp
+  80420f:	89 e5                	mov    %esp,%ebp
+  804211:	83 ec 18             	sub    $0x18,%esp
+  804214:	8b 45 08             	mov    0x8(%ebp),%eax
+  804217:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80421a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80421d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  804221:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  804224:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80422b:	85 c0                	test   %eax,%eax
+  80422d:	74 26                	je     804255 <vsnprintf+0x47>
+  80422f:	85 d2                	test   %edx,%edx
+  804231:	7e 22                	jle    804255 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  804233:	ff 75 14             	push   0x14(%ebp)
+  804236:	ff 75 10             	push   0x10(%ebp)
+  804239:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80423c:	50                   	push   %eax
+  80423d:	68 87 3d 80 00       	push   $0x803d87
+  804242:	e8 7a fb ff ff       	call   803dc1 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  804247:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80424a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80424d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804250:	83 c4 10             	add    $0x10,%esp
+}
+  804253:	c9                   	leave
+  804254:	c3                   	ret
+		return -E_INVAL;
+  804255:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80425a:	eb f7                	jmp    804253 <vsnprintf+0x45>
+
+0080425c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80425c:	55                   	push   %ebp
+  80425d:	89 e5                	mov    %esp,%ebp
+  80425f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  804262:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  804265:	50                   	push   %eax
+  804266:	ff 75 10             	push   0x10(%ebp)
+  804269:	ff 75 0c             	push   0xc(%ebp)
+  80426c:	ff 75 08             	push   0x8(%ebp)
+  80426f:	e8 9a ff ff ff       	call   80420e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  804274:	c9                   	leave
+  804275:	c3                   	ret
+
+00804276 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  804276:	55                   	push   %ebp
+  804277:	89 e5                	mov    %esp,%ebp
+  804279:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80427c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804281:	eb 03                	jmp    804286 <strlen+0x10>
+		n++;
+  804283:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  804286:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80428a:	75 f7                	jne    804283 <strlen+0xd>
+	return n;
+}
+  80428c:	5d                   	pop    %ebp
+  80428d:	c3                   	ret
+
+0080428e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80428e:	55                   	push   %ebp
+  80428f:	89 e5                	mov    %esp,%ebp
+  804291:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  804294:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804297:	b8 00 00 00 00       	mov    $0x0,%eax
+  80429c:	eb 03                	jmp    8042a1 <strnlen+0x13>
+		n++;
+  80429e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8042a1:	39 d0                	cmp    %edx,%eax
+  8042a3:	74 08                	je     8042ad <strnlen+0x1f>
+  8042a5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8042a9:	75 f3                	jne    80429e <strnlen+0x10>
+  8042ab:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8042ad:	89 d0                	mov    %edx,%eax
+  8042af:	5d                   	pop    %ebp
+  8042b0:	c3                   	ret
+
+008042b1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8042b1:	55                   	push   %ebp
+  8042b2:	89 e5                	mov    %esp,%ebp
+  8042b4:	53                   	push   %ebx
+  8042b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8042b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8042bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8042c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8042c7:	83 c0 01             	add    $0x1,%eax
+  8042ca:	84 d2                	test   %dl,%dl
+  8042cc:	75 f2                	jne    8042c0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8042ce:	89 c8                	mov    %ecx,%eax
+  8042d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8042d3:	c9                   	leave
+  8042d4:	c3                   	ret
+
+008042d5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8042d5:	55                   	push   %ebp
+  8042d6:	89 e5                	mov    %esp,%ebp
+  8042d8:	53                   	push   %ebx
+  8042d9:	83 ec 10             	sub    $0x10,%esp
+  8042dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8042df:	53                   	push   %ebx
+  8042e0:	e8 91 ff ff ff       	call   804276 <strlen>
+  8042e5:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8042e8:	ff 75 0c             	push   0xc(%ebp)
+  8042eb:	01 d8                	add    %ebx,%eax
+  8042ed:	50                   	push   %eax
+  8042ee:	e8 be ff ff ff       	call   8042b1 <strcpy>
+	return dst;
+}
+  8042f3:	89 d8                	mov    %ebx,%eax
+  8042f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8042f8:	c9                   	leave
+  8042f9:	c3                   	ret
+
+008042fa <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8042fa:	55                   	push   %ebp
+  8042fb:	89 e5                	mov    %esp,%ebp
+  8042fd:	56                   	push   %esi
+  8042fe:	53                   	push   %ebx
+  8042ff:	8b 75 08             	mov    0x8(%ebp),%esi
+  804302:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  804305:	89 f3                	mov    %esi,%ebx
+  804307:	03 5d 10             	add    0x10(%ebp),%ebx
+  80430a:	89 f0                	mov    %esi,%eax
+  80430c:	eb 0f                	jmp    80431d <strncpy+0x23>
+		*dst++ = *src;
+  80430e:	83 c0 01             	add    $0x1,%eax
+  804311:	0f b6 0a             	movzbl (%edx),%ecx
+  804314:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  804317:	80 f9 01             	cmp    $0x1,%cl
+  80431a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80431d:	39 d8                	cmp    %ebx,%eax
+  80431f:	75 ed                	jne    80430e <strncpy+0x14>
+	}
+	return ret;
+}
+  804321:	89 f0                	mov    %esi,%eax
+  804323:	5b                   	pop    %ebx
+  804324:	5e                   	pop    %esi
+  804325:	5d                   	pop    %ebp
+  804326:	c3                   	ret
+
+00804327 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  804327:	55                   	push   %ebp
+  804328:	89 e5                	mov    %esp,%ebp
+  80432a:	56                   	push   %esi
+  80432b:	53                   	push   %ebx
+  80432c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80432f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804332:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  804335:	89 f0                	mov    %esi,%eax
+  804337:	85 d2                	test   %edx,%edx
+  804339:	74 21                	je     80435c <strlcpy+0x35>
+  80433b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80433f:	89 f2                	mov    %esi,%edx
+  804341:	eb 09                	jmp    80434c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  804343:	83 c1 01             	add    $0x1,%ecx
+  804346:	83 c2 01             	add    $0x1,%edx
+  804349:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80434c:	39 c2                	cmp    %eax,%edx
+  80434e:	74 09                	je     804359 <strlcpy+0x32>
+  804350:	0f b6 19             	movzbl (%ecx),%ebx
+  804353:	84 db                	test   %bl,%bl
+  804355:	75 ec                	jne    804343 <strlcpy+0x1c>
+  804357:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  804359:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80435c:	29 f0                	sub    %esi,%eax
+}
+  80435e:	5b                   	pop    %ebx
+  80435f:	5e                   	pop    %esi
+  804360:	5d                   	pop    %ebp
+  804361:	c3                   	ret
+
+00804362 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  804362:	55                   	push   %ebp
+  804363:	89 e5                	mov    %esp,%ebp
+  804365:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804368:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80436b:	eb 06                	jmp    804373 <strcmp+0x11>
+		p++, q++;
+  80436d:	83 c1 01             	add    $0x1,%ecx
+  804370:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  804373:	0f b6 01             	movzbl (%ecx),%eax
+  804376:	84 c0                	test   %al,%al
+  804378:	74 04                	je     80437e <strcmp+0x1c>
+  80437a:	3a 02                	cmp    (%edx),%al
+  80437c:	74 ef                	je     80436d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80437e:	0f b6 c0             	movzbl %al,%eax
+  804381:	0f b6 12             	movzbl (%edx),%edx
+  804384:	29 d0                	sub    %edx,%eax
+}
+  804386:	5d                   	pop    %ebp
+  804387:	c3                   	ret
+
+00804388 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  804388:	55                   	push   %ebp
+  804389:	89 e5                	mov    %esp,%ebp
+  80438b:	53                   	push   %ebx
+  80438c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80438f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804392:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  804395:	eb 09                	jmp    8043a0 <strncmp+0x18>
+		n--, p++, q++;
+  804397:	83 ea 01             	sub    $0x1,%edx
+  80439a:	83 c0 01             	add    $0x1,%eax
+  80439d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8043a0:	85 d2                	test   %edx,%edx
+  8043a2:	74 18                	je     8043bc <strncmp+0x34>
+  8043a4:	0f b6 18             	movzbl (%eax),%ebx
+  8043a7:	84 db                	test   %bl,%bl
+  8043a9:	74 04                	je     8043af <strncmp+0x27>
+  8043ab:	3a 19                	cmp    (%ecx),%bl
+  8043ad:	74 e8                	je     804397 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8043af:	0f b6 00             	movzbl (%eax),%eax
+  8043b2:	0f b6 11             	movzbl (%ecx),%edx
+  8043b5:	29 d0                	sub    %edx,%eax
+}
+  8043b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8043ba:	c9                   	leave
+  8043bb:	c3                   	ret
+		return 0;
+  8043bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c1:	eb f4                	jmp    8043b7 <strncmp+0x2f>
+
+008043c3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8043c3:	55                   	push   %ebp
+  8043c4:	89 e5                	mov    %esp,%ebp
+  8043c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043c9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8043cd:	eb 03                	jmp    8043d2 <strchr+0xf>
+  8043cf:	83 c0 01             	add    $0x1,%eax
+  8043d2:	0f b6 10             	movzbl (%eax),%edx
+  8043d5:	84 d2                	test   %dl,%dl
+  8043d7:	74 06                	je     8043df <strchr+0x1c>
+		if (*s == c)
+  8043d9:	38 ca                	cmp    %cl,%dl
+  8043db:	75 f2                	jne    8043cf <strchr+0xc>
+  8043dd:	eb 05                	jmp    8043e4 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8043df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043e4:	5d                   	pop    %ebp
+  8043e5:	c3                   	ret
+
+008043e6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8043e6:	55                   	push   %ebp
+  8043e7:	89 e5                	mov    %esp,%ebp
+  8043e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043ec:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8043f0:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8043f3:	38 ca                	cmp    %cl,%dl
+  8043f5:	74 09                	je     804400 <strfind+0x1a>
+  8043f7:	84 d2                	test   %dl,%dl
+  8043f9:	74 05                	je     804400 <strfind+0x1a>
+	for (; *s; s++)
+  8043fb:	83 c0 01             	add    $0x1,%eax
+  8043fe:	eb f0                	jmp    8043f0 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  804400:	5d                   	pop    %ebp
+  804401:	c3                   	ret
+
+00804402 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  804402:	55                   	push   %ebp
+  804403:	89 e5                	mov    %esp,%ebp
+  804405:	57                   	push   %edi
+  804406:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804409:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80440c:	85 c9                	test   %ecx,%ecx
+  80440e:	74 20                	je     804430 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  804410:	89 f8                	mov    %edi,%eax
+  804412:	09 c8                	or     %ecx,%eax
+  804414:	a8 03                	test   $0x3,%al
+  804416:	75 12                	jne    80442a <memset+0x28>
+		c &= 0xFF;
+  804418:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80441c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  804422:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  804425:	fc                   	cld
+  804426:	f3 ab                	rep stos %eax,%es:(%edi)
+  804428:	eb 06                	jmp    804430 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80442a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80442d:	fc                   	cld
+  80442e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  804430:	89 f8                	mov    %edi,%eax
+  804432:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  804435:	c9                   	leave
+  804436:	c3                   	ret
+
+00804437 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  804437:	55                   	push   %ebp
+  804438:	89 e5                	mov    %esp,%ebp
+  80443a:	57                   	push   %edi
+  80443b:	56                   	push   %esi
+  80443c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80443f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  804442:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  804445:	39 c6                	cmp    %eax,%esi
+  804447:	73 32                	jae    80447b <memmove+0x44>
+  804449:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80444c:	39 d0                	cmp    %edx,%eax
+  80444e:	73 2b                	jae    80447b <memmove+0x44>
+		s += n;
+		d += n;
+  804450:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  804453:	89 d6                	mov    %edx,%esi
+  804455:	09 fe                	or     %edi,%esi
+  804457:	09 ce                	or     %ecx,%esi
+  804459:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80445f:	75 0e                	jne    80446f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  804461:	83 ef 04             	sub    $0x4,%edi
+  804464:	8d 72 fc             	lea    -0x4(%edx),%esi
+  804467:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80446a:	fd                   	std
+  80446b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80446d:	eb 09                	jmp    804478 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80446f:	83 ef 01             	sub    $0x1,%edi
+  804472:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  804475:	fd                   	std
+  804476:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  804478:	fc                   	cld
+  804479:	eb 1a                	jmp    804495 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80447b:	89 f2                	mov    %esi,%edx
+  80447d:	09 c2                	or     %eax,%edx
+  80447f:	09 ca                	or     %ecx,%edx
+  804481:	f6 c2 03             	test   $0x3,%dl
+  804484:	75 0a                	jne    804490 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  804486:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  804489:	89 c7                	mov    %eax,%edi
+  80448b:	fc                   	cld
+  80448c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80448e:	eb 05                	jmp    804495 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  804490:	89 c7                	mov    %eax,%edi
+  804492:	fc                   	cld
+  804493:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  804495:	5e                   	pop    %esi
+  804496:	5f                   	pop    %edi
+  804497:	5d                   	pop    %ebp
+  804498:	c3                   	ret
+
+00804499 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  804499:	55                   	push   %ebp
+  80449a:	89 e5                	mov    %esp,%ebp
+  80449c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80449f:	ff 75 10             	push   0x10(%ebp)
+  8044a2:	ff 75 0c             	push   0xc(%ebp)
+  8044a5:	ff 75 08             	push   0x8(%ebp)
+  8044a8:	e8 8a ff ff ff       	call   804437 <memmove>
+}
+  8044ad:	c9                   	leave
+  8044ae:	c3                   	ret
+
+008044af <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8044af:	55                   	push   %ebp
+  8044b0:	89 e5                	mov    %esp,%ebp
+  8044b2:	56                   	push   %esi
+  8044b3:	53                   	push   %ebx
+  8044b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8044ba:	89 c6                	mov    %eax,%esi
+  8044bc:	03 75 10             	add    0x10(%ebp),%esi
+  8044bf:	eb 06                	jmp    8044c7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8044c1:	83 c0 01             	add    $0x1,%eax
+  8044c4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8044c7:	39 f0                	cmp    %esi,%eax
+  8044c9:	74 14                	je     8044df <memcmp+0x30>
+		if (*s1 != *s2)
+  8044cb:	0f b6 08             	movzbl (%eax),%ecx
+  8044ce:	0f b6 1a             	movzbl (%edx),%ebx
+  8044d1:	38 d9                	cmp    %bl,%cl
+  8044d3:	74 ec                	je     8044c1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8044d5:	0f b6 c1             	movzbl %cl,%eax
+  8044d8:	0f b6 db             	movzbl %bl,%ebx
+  8044db:	29 d8                	sub    %ebx,%eax
+  8044dd:	eb 05                	jmp    8044e4 <memcmp+0x35>
+	}
+
+	return 0;
+  8044df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044e4:	5b                   	pop    %ebx
+  8044e5:	5e                   	pop    %esi
+  8044e6:	5d                   	pop    %ebp
+  8044e7:	c3                   	ret
+
+008044e8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8044e8:	55                   	push   %ebp
+  8044e9:	89 e5                	mov    %esp,%ebp
+  8044eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8044f1:	89 c2                	mov    %eax,%edx
+  8044f3:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8044f6:	eb 03                	jmp    8044fb <memfind+0x13>
+  8044f8:	83 c0 01             	add    $0x1,%eax
+  8044fb:	39 d0                	cmp    %edx,%eax
+  8044fd:	73 04                	jae    804503 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8044ff:	38 08                	cmp    %cl,(%eax)
+  804501:	75 f5                	jne    8044f8 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  804503:	5d                   	pop    %ebp
+  804504:	c3                   	ret
+
+00804505 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  804505:	55                   	push   %ebp
+  804506:	89 e5                	mov    %esp,%ebp
+  804508:	57                   	push   %edi
+  804509:	56                   	push   %esi
+  80450a:	53                   	push   %ebx
+  80450b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80450e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  804511:	eb 03                	jmp    804516 <strtol+0x11>
+		s++;
+  804513:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  804516:	0f b6 02             	movzbl (%edx),%eax
+  804519:	3c 20                	cmp    $0x20,%al
+  80451b:	74 f6                	je     804513 <strtol+0xe>
+  80451d:	3c 09                	cmp    $0x9,%al
+  80451f:	74 f2                	je     804513 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  804521:	3c 2b                	cmp    $0x2b,%al
+  804523:	74 2a                	je     80454f <strtol+0x4a>
+	int neg = 0;
+  804525:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80452a:	3c 2d                	cmp    $0x2d,%al
+  80452c:	74 2b                	je     804559 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80452e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  804534:	75 0f                	jne    804545 <strtol+0x40>
+  804536:	80 3a 30             	cmpb   $0x30,(%edx)
+  804539:	74 28                	je     804563 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80453b:	85 db                	test   %ebx,%ebx
+  80453d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  804542:	0f 44 d8             	cmove  %eax,%ebx
+  804545:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80454a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80454d:	eb 46                	jmp    804595 <strtol+0x90>
+		s++;
+  80454f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  804552:	bf 00 00 00 00       	mov    $0x0,%edi
+  804557:	eb d5                	jmp    80452e <strtol+0x29>
+		s++, neg = 1;
+  804559:	83 c2 01             	add    $0x1,%edx
+  80455c:	bf 01 00 00 00       	mov    $0x1,%edi
+  804561:	eb cb                	jmp    80452e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  804563:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  804567:	74 0e                	je     804577 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  804569:	85 db                	test   %ebx,%ebx
+  80456b:	75 d8                	jne    804545 <strtol+0x40>
+		s++, base = 8;
+  80456d:	83 c2 01             	add    $0x1,%edx
+  804570:	bb 08 00 00 00       	mov    $0x8,%ebx
+  804575:	eb ce                	jmp    804545 <strtol+0x40>
+		s += 2, base = 16;
+  804577:	83 c2 02             	add    $0x2,%edx
+  80457a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80457f:	eb c4                	jmp    804545 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  804581:	0f be c0             	movsbl %al,%eax
+  804584:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  804587:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80458a:	7d 3a                	jge    8045c6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  80458c:	83 c2 01             	add    $0x1,%edx
+  80458f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  804593:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  804595:	0f b6 02             	movzbl (%edx),%eax
+  804598:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80459b:	89 f3                	mov    %esi,%ebx
+  80459d:	80 fb 09             	cmp    $0x9,%bl
+  8045a0:	76 df                	jbe    804581 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8045a2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8045a5:	89 f3                	mov    %esi,%ebx
+  8045a7:	80 fb 19             	cmp    $0x19,%bl
+  8045aa:	77 08                	ja     8045b4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8045ac:	0f be c0             	movsbl %al,%eax
+  8045af:	83 e8 57             	sub    $0x57,%eax
+  8045b2:	eb d3                	jmp    804587 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8045b4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8045b7:	89 f3                	mov    %esi,%ebx
+  8045b9:	80 fb 19             	cmp    $0x19,%bl
+  8045bc:	77 08                	ja     8045c6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8045be:	0f be c0             	movsbl %al,%eax
+  8045c1:	83 e8 37             	sub    $0x37,%eax
+  8045c4:	eb c1                	jmp    804587 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8045c6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8045ca:	74 05                	je     8045d1 <strtol+0xcc>
+		*endptr = (char *) s;
+  8045cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8045cf:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8045d1:	89 c8                	mov    %ecx,%eax
+  8045d3:	f7 d8                	neg    %eax
+  8045d5:	85 ff                	test   %edi,%edi
+  8045d7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8045da:	89 c8                	mov    %ecx,%eax
+  8045dc:	5b                   	pop    %ebx
+  8045dd:	5e                   	pop    %esi
+  8045de:	5f                   	pop    %edi
+  8045df:	5d                   	pop    %ebp
+  8045e0:	c3                   	ret
+
+008045e1 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  8045e1:	55                   	push   %ebp
+  8045e2:	89 e5                	mov    %esp,%ebp
+  8045e4:	57                   	push   %edi
+  8045e5:	56                   	push   %esi
+  8045e6:	53                   	push   %ebx
+  8045e7:	83 ec 0c             	sub    $0xc,%esp
+  8045ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8045ed:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8045f0:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  8045f3:	85 ff                	test   %edi,%edi
+  8045f5:	74 16                	je     80460d <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  8045f7:	83 ec 04             	sub    $0x4,%esp
+  8045fa:	56                   	push   %esi
+  8045fb:	6a 00                	push   $0x0
+  8045fd:	53                   	push   %ebx
+  8045fe:	e8 02 ff ff ff       	call   804505 <strtol>
+  804603:	89 07                	mov    %eax,(%edi)
+  804605:	83 c4 10             	add    $0x10,%esp
+  804608:	eb 03                	jmp    80460d <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  80460a:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  80460d:	0f b6 03             	movzbl (%ebx),%eax
+  804610:	3c 20                	cmp    $0x20,%al
+  804612:	74 f6                	je     80460a <strisl+0x29>
+  804614:	3c 09                	cmp    $0x9,%al
+  804616:	74 f2                	je     80460a <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  804618:	3c 2b                	cmp    $0x2b,%al
+  80461a:	74 23                	je     80463f <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  80461c:	3c 2d                	cmp    $0x2d,%al
+  80461e:	0f 94 c0             	sete   %al
+  804621:	0f b6 c0             	movzbl %al,%eax
+  804624:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  804626:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  80462c:	75 41                	jne    80466f <strisl+0x8e>
+  80462e:	80 3b 30             	cmpb   $0x30,(%ebx)
+  804631:	74 11                	je     804644 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  804633:	85 f6                	test   %esi,%esi
+  804635:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80463a:	0f 44 f0             	cmove  %eax,%esi
+  80463d:	eb 30                	jmp    80466f <strisl+0x8e>
+		s++;
+  80463f:	83 c3 01             	add    $0x1,%ebx
+  804642:	eb e2                	jmp    804626 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  804644:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  804648:	74 0e                	je     804658 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  80464a:	85 f6                	test   %esi,%esi
+  80464c:	75 21                	jne    80466f <strisl+0x8e>
+		s++, base = 8;
+  80464e:	83 c3 01             	add    $0x1,%ebx
+  804651:	be 08 00 00 00       	mov    $0x8,%esi
+  804656:	eb 17                	jmp    80466f <strisl+0x8e>
+		s += 2, base = 16;
+  804658:	83 c3 02             	add    $0x2,%ebx
+  80465b:	be 10 00 00 00       	mov    $0x10,%esi
+  804660:	eb 0d                	jmp    80466f <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  804662:	0f be c0             	movsbl %al,%eax
+  804665:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  804668:	39 f0                	cmp    %esi,%eax
+  80466a:	7d 38                	jge    8046a4 <strisl+0xc3>
+			return 0;
+		s++;
+  80466c:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  80466f:	0f b6 03             	movzbl (%ebx),%eax
+  804672:	8d 50 d0             	lea    -0x30(%eax),%edx
+  804675:	80 fa 09             	cmp    $0x9,%dl
+  804678:	76 e8                	jbe    804662 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  80467a:	8d 50 9f             	lea    -0x61(%eax),%edx
+  80467d:	80 fa 19             	cmp    $0x19,%dl
+  804680:	77 08                	ja     80468a <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  804682:	0f be c0             	movsbl %al,%eax
+  804685:	83 e8 57             	sub    $0x57,%eax
+  804688:	eb de                	jmp    804668 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  80468a:	8d 50 bf             	lea    -0x41(%eax),%edx
+  80468d:	80 fa 19             	cmp    $0x19,%dl
+  804690:	77 08                	ja     80469a <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  804692:	0f be c0             	movsbl %al,%eax
+  804695:	83 e8 37             	sub    $0x37,%eax
+  804698:	eb ce                	jmp    804668 <strisl+0x87>
+		else if (!*s)
+  80469a:	84 c0                	test   %al,%al
+  80469c:	0f 94 c0             	sete   %al
+  80469f:	0f b6 c0             	movzbl %al,%eax
+  8046a2:	eb 05                	jmp    8046a9 <strisl+0xc8>
+			return 0;
+  8046a4:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  8046a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046ac:	5b                   	pop    %ebx
+  8046ad:	5e                   	pop    %esi
+  8046ae:	5f                   	pop    %edi
+  8046af:	5d                   	pop    %ebp
+  8046b0:	c3                   	ret
+
+008046b1 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  8046b1:	55                   	push   %ebp
+  8046b2:	89 e5                	mov    %esp,%ebp
+  8046b4:	56                   	push   %esi
+  8046b5:	53                   	push   %ebx
+  8046b6:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8046b9:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  8046be:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  8046c1:	85 db                	test   %ebx,%ebx
+  8046c3:	78 17                	js     8046dc <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  8046c5:	83 ec 0c             	sub    $0xc,%esp
+  8046c8:	56                   	push   %esi
+  8046c9:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  8046d0:	83 c4 10             	add    $0x10,%esp
+  8046d3:	85 c0                	test   %eax,%eax
+  8046d5:	75 27                	jne    8046fe <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8046d7:	83 eb 01             	sub    $0x1,%ebx
+  8046da:	eb e5                	jmp    8046c1 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  8046dc:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8046e1:	8b 40 48             	mov    0x48(%eax),%eax
+  8046e4:	83 ec 08             	sub    $0x8,%esp
+  8046e7:	ff 76 28             	push   0x28(%esi)
+  8046ea:	ff 36                	push   (%esi)
+  8046ec:	50                   	push   %eax
+  8046ed:	68 ac 56 80 00       	push   $0x8056ac
+  8046f2:	6a 1d                	push   $0x1d
+  8046f4:	68 cf 56 80 00       	push   $0x8056cf
+  8046f9:	e8 f1 f4 ff ff       	call   803bef <_panic>
+}
+  8046fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804701:	5b                   	pop    %ebx
+  804702:	5e                   	pop    %esi
+  804703:	5d                   	pop    %ebp
+  804704:	c3                   	ret
+
+00804705 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804705:	55                   	push   %ebp
+  804706:	89 e5                	mov    %esp,%ebp
+  804708:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  80470b:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  804712:	74 0a                	je     80471e <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804714:	8b 45 08             	mov    0x8(%ebp),%eax
+  804717:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  80471c:	c9                   	leave
+  80471d:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  80471e:	83 ec 04             	sub    $0x4,%esp
+  804721:	6a 07                	push   $0x7
+  804723:	68 00 f0 bf ee       	push   $0xeebff000
+  804728:	6a 00                	push   $0x0
+  80472a:	e8 8e ba ff ff       	call   8001bd <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80472f:	83 c4 08             	add    $0x8,%esp
+  804732:	68 a5 47 80 00       	push   $0x8047a5
+  804737:	6a 00                	push   $0x0
+  804739:	e8 e5 bd ff ff       	call   800523 <sys_env_set_pgfault_upcall>
+  80473e:	83 c4 10             	add    $0x10,%esp
+  804741:	eb d1                	jmp    804714 <set_pgfault_handler+0xf>
+
+00804743 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804743:	55                   	push   %ebp
+  804744:	89 e5                	mov    %esp,%ebp
+  804746:	83 ec 08             	sub    $0x8,%esp
+  804749:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  80474c:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  804752:	b8 00 00 00 00       	mov    $0x0,%eax
+  804757:	eb 03                	jmp    80475c <add_pgfault_handler+0x19>
+  804759:	83 c0 01             	add    $0x1,%eax
+  80475c:	39 d0                	cmp    %edx,%eax
+  80475e:	74 0b                	je     80476b <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804760:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  804767:	75 f0                	jne    804759 <add_pgfault_handler+0x16>
+  804769:	eb 24                	jmp    80478f <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  80476b:	83 fa 0a             	cmp    $0xa,%edx
+  80476e:	74 21                	je     804791 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  804770:	8d 42 01             	lea    0x1(%edx),%eax
+  804773:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  804778:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  80477f:	83 ec 0c             	sub    $0xc,%esp
+  804782:	68 b1 46 80 00       	push   $0x8046b1
+  804787:	e8 79 ff ff ff       	call   804705 <set_pgfault_handler>
+  80478c:	83 c4 10             	add    $0x10,%esp
+}
+  80478f:	c9                   	leave
+  804790:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  804791:	83 ec 04             	sub    $0x4,%esp
+  804794:	68 dd 56 80 00       	push   $0x8056dd
+  804799:	6a 44                	push   $0x44
+  80479b:	68 cf 56 80 00       	push   $0x8056cf
+  8047a0:	e8 4a f4 ff ff       	call   803bef <_panic>
+
+008047a5 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8047a5:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8047a6:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  8047ab:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8047ad:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  8047b0:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  8047b4:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  8047b8:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  8047bb:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  8047bd:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  8047c1:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  8047c4:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  8047c5:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  8047c8:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  8047c9:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8047ca:	c3                   	ret
+
+008047cb <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8047cb:	55                   	push   %ebp
+  8047cc:	89 e5                	mov    %esp,%ebp
+  8047ce:	57                   	push   %edi
+  8047cf:	56                   	push   %esi
+  8047d0:	53                   	push   %ebx
+  8047d1:	83 ec 14             	sub    $0x14,%esp
+  8047d4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8047d7:	8b 75 14             	mov    0x14(%ebp),%esi
+  8047da:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8047dd:	ff 75 10             	push   0x10(%ebp)
+  8047e0:	ff 75 0c             	push   0xc(%ebp)
+  8047e3:	e8 f8 bd ff ff       	call   8005e0 <sys_ipc_recv_pages>
+  8047e8:	83 c4 10             	add    $0x10,%esp
+  8047eb:	85 c0                	test   %eax,%eax
+  8047ed:	78 46                	js     804835 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8047ef:	85 ff                	test   %edi,%edi
+  8047f1:	74 0d                	je     804800 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  8047f3:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8047f8:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8047fe:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804800:	85 f6                	test   %esi,%esi
+  804802:	74 0d                	je     804811 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804804:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804809:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80480f:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804811:	85 db                	test   %ebx,%ebx
+  804813:	74 0d                	je     804822 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804815:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80481a:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804820:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804822:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804827:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80482d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804830:	5b                   	pop    %ebx
+  804831:	5e                   	pop    %esi
+  804832:	5f                   	pop    %edi
+  804833:	5d                   	pop    %ebp
+  804834:	c3                   	ret
+		if (from_env_store) {
+  804835:	85 ff                	test   %edi,%edi
+  804837:	74 06                	je     80483f <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  804839:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80483f:	85 f6                	test   %esi,%esi
+  804841:	74 06                	je     804849 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804843:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804849:	85 db                	test   %ebx,%ebx
+  80484b:	74 e0                	je     80482d <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  80484d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804853:	eb d8                	jmp    80482d <ipc_recv_pages+0x62>
+
+00804855 <ipc_recv>:
+{
+  804855:	55                   	push   %ebp
+  804856:	89 e5                	mov    %esp,%ebp
+  804858:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  80485b:	6a 00                	push   $0x0
+  80485d:	ff 75 10             	push   0x10(%ebp)
+  804860:	6a 01                	push   $0x1
+  804862:	ff 75 0c             	push   0xc(%ebp)
+  804865:	ff 75 08             	push   0x8(%ebp)
+  804868:	e8 5e ff ff ff       	call   8047cb <ipc_recv_pages>
+}
+  80486d:	c9                   	leave
+  80486e:	c3                   	ret
+
+0080486f <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80486f:	55                   	push   %ebp
+  804870:	89 e5                	mov    %esp,%ebp
+  804872:	56                   	push   %esi
+  804873:	53                   	push   %ebx
+  804874:	8b 75 08             	mov    0x8(%ebp),%esi
+  804877:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  80487a:	83 ec 0c             	sub    $0xc,%esp
+  80487d:	ff 75 0c             	push   0xc(%ebp)
+  804880:	e8 8f be ff ff       	call   800714 <sys_ipc_try_recv>
+  804885:	83 c4 10             	add    $0x10,%esp
+  804888:	85 c0                	test   %eax,%eax
+  80488a:	78 34                	js     8048c0 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80488c:	85 f6                	test   %esi,%esi
+  80488e:	74 0d                	je     80489d <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  804890:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804895:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80489b:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  80489d:	85 db                	test   %ebx,%ebx
+  80489f:	74 0d                	je     8048ae <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8048a1:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8048a6:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8048ac:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8048ae:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8048b3:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8048b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8048bc:	5b                   	pop    %ebx
+  8048bd:	5e                   	pop    %esi
+  8048be:	5d                   	pop    %ebp
+  8048bf:	c3                   	ret
+		if (from_env_store) {
+  8048c0:	85 f6                	test   %esi,%esi
+  8048c2:	74 06                	je     8048ca <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8048c4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8048ca:	85 db                	test   %ebx,%ebx
+  8048cc:	74 eb                	je     8048b9 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8048ce:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8048d4:	eb e3                	jmp    8048b9 <ipc_try_recv+0x4a>
+
+008048d6 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8048d6:	55                   	push   %ebp
+  8048d7:	89 e5                	mov    %esp,%ebp
+  8048d9:	83 ec 14             	sub    $0x14,%esp
+  8048dc:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8048df:	85 c0                	test   %eax,%eax
+  8048e1:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8048e6:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8048e9:	ff 75 18             	push   0x18(%ebp)
+  8048ec:	ff 75 14             	push   0x14(%ebp)
+  8048ef:	50                   	push   %eax
+  8048f0:	ff 75 0c             	push   0xc(%ebp)
+  8048f3:	ff 75 08             	push   0x8(%ebp)
+  8048f6:	e8 a8 bc ff ff       	call   8005a3 <sys_ipc_send_pages>
+  8048fb:	83 c4 20             	add    $0x20,%esp
+  8048fe:	85 c0                	test   %eax,%eax
+  804900:	78 02                	js     804904 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804902:	c9                   	leave
+  804903:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804904:	50                   	push   %eax
+  804905:	68 f8 56 80 00       	push   $0x8056f8
+  80490a:	68 80 00 00 00       	push   $0x80
+  80490f:	68 24 57 80 00       	push   $0x805724
+  804914:	e8 d6 f2 ff ff       	call   803bef <_panic>
+
+00804919 <ipc_send>:
+{
+  804919:	55                   	push   %ebp
+  80491a:	89 e5                	mov    %esp,%ebp
+  80491c:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  80491f:	ff 75 14             	push   0x14(%ebp)
+  804922:	6a 01                	push   $0x1
+  804924:	ff 75 10             	push   0x10(%ebp)
+  804927:	ff 75 0c             	push   0xc(%ebp)
+  80492a:	ff 75 08             	push   0x8(%ebp)
+  80492d:	e8 a4 ff ff ff       	call   8048d6 <ipc_send_pages>
+}
+  804932:	83 c4 20             	add    $0x20,%esp
+  804935:	c9                   	leave
+  804936:	c3                   	ret
+
+00804937 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804937:	55                   	push   %ebp
+  804938:	89 e5                	mov    %esp,%ebp
+  80493a:	83 ec 14             	sub    $0x14,%esp
+  80493d:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804940:	85 c0                	test   %eax,%eax
+  804942:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804947:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80494a:	ff 75 18             	push   0x18(%ebp)
+  80494d:	ff 75 14             	push   0x14(%ebp)
+  804950:	50                   	push   %eax
+  804951:	ff 75 0c             	push   0xc(%ebp)
+  804954:	ff 75 08             	push   0x8(%ebp)
+  804957:	e8 d8 bc ff ff       	call   800634 <sys_ipc_call>
+  80495c:	83 c4 20             	add    $0x20,%esp
+  80495f:	85 c0                	test   %eax,%eax
+  804961:	78 0b                	js     80496e <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  804963:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804968:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80496e:	c9                   	leave
+  80496f:	c3                   	ret
+
+00804970 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  804970:	55                   	push   %ebp
+  804971:	89 e5                	mov    %esp,%ebp
+  804973:	57                   	push   %edi
+  804974:	56                   	push   %esi
+  804975:	53                   	push   %ebx
+  804976:	83 ec 18             	sub    $0x18,%esp
+  804979:	8b 45 10             	mov    0x10(%ebp),%eax
+  80497c:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  80497f:	8b 75 20             	mov    0x20(%ebp),%esi
+  804982:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804985:	85 c0                	test   %eax,%eax
+  804987:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80498c:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80498f:	ff 75 18             	push   0x18(%ebp)
+  804992:	ff 75 14             	push   0x14(%ebp)
+  804995:	50                   	push   %eax
+  804996:	ff 75 0c             	push   0xc(%ebp)
+  804999:	ff 75 08             	push   0x8(%ebp)
+  80499c:	e8 d4 bc ff ff       	call   800675 <sys_ipc_reply_recv>
+  8049a1:	83 c4 20             	add    $0x20,%esp
+  8049a4:	85 c0                	test   %eax,%eax
+  8049a6:	78 46                	js     8049ee <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8049a8:	85 ff                	test   %edi,%edi
+  8049aa:	74 0d                	je     8049b9 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8049ac:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049b1:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8049b7:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8049b9:	85 f6                	test   %esi,%esi
+  8049bb:	74 0d                	je     8049ca <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8049bd:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049c2:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8049c8:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8049ca:	85 db                	test   %ebx,%ebx
+  8049cc:	74 0d                	je     8049db <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8049ce:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049d3:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8049d9:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8049db:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049e0:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8049e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8049e9:	5b                   	pop    %ebx
+  8049ea:	5e                   	pop    %esi
+  8049eb:	5f                   	pop    %edi
+  8049ec:	5d                   	pop    %ebp
+  8049ed:	c3                   	ret
+		if (from_env_store) {
+  8049ee:	85 ff                	test   %edi,%edi
+  8049f0:	74 06                	je     8049f8 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  8049f2:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8049f8:	85 f6                	test   %esi,%esi
+  8049fa:	74 06                	je     804a02 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  8049fc:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804a02:	85 db                	test   %ebx,%ebx
+  804a04:	74 e0                	je     8049e6 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  804a06:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804a0c:	eb d8                	jmp    8049e6 <ipc_reply_recv+0x76>
+
+00804a0e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804a0e:	55                   	push   %ebp
+  804a0f:	89 e5                	mov    %esp,%ebp
+  804a11:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804a14:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804a19:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804a1c:	c1 e0 06             	shl    $0x6,%eax
+  804a1f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804a24:	8b 40 50             	mov    0x50(%eax),%eax
+  804a27:	39 c8                	cmp    %ecx,%eax
+  804a29:	74 12                	je     804a3d <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804a2b:	83 c2 01             	add    $0x1,%edx
+  804a2e:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804a34:	75 e3                	jne    804a19 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804a36:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a3b:	eb 0e                	jmp    804a4b <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804a3d:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804a40:	c1 e0 06             	shl    $0x6,%eax
+  804a43:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804a48:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804a4b:	5d                   	pop    %ebp
+  804a4c:	c3                   	ret
+
+00804a4d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804a4d:	55                   	push   %ebp
+  804a4e:	89 e5                	mov    %esp,%ebp
+  804a50:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804a53:	89 c2                	mov    %eax,%edx
+  804a55:	c1 ea 16             	shr    $0x16,%edx
+  804a58:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804a5f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804a64:	f6 c1 01             	test   $0x1,%cl
+  804a67:	74 1e                	je     804a87 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  804a69:	c1 e8 0c             	shr    $0xc,%eax
+  804a6c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804a73:	a8 01                	test   $0x1,%al
+  804a75:	74 10                	je     804a87 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804a77:	c1 e8 0c             	shr    $0xc,%eax
+  804a7a:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  804a7d:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  804a84:	0f b7 d2             	movzwl %dx,%edx
+}
+  804a87:	89 d0                	mov    %edx,%eax
+  804a89:	5d                   	pop    %ebp
+  804a8a:	c3                   	ret
+
+00804a8b <udivmod>:
+  804a8b:	55                   	push   %ebp
+  804a8c:	57                   	push   %edi
+  804a8d:	56                   	push   %esi
+  804a8e:	53                   	push   %ebx
+  804a8f:	83 ec 24             	sub    $0x24,%esp
+  804a92:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804a96:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804a9a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804a9e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804aa2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804aa6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804aaa:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  804aae:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ab8:	ba 00 00 00 00       	mov    $0x0,%edx
+  804abd:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804ac4:	00 
+  804ac5:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804acc:	00 
+  804acd:	89 fb                	mov    %edi,%ebx
+  804acf:	eb 08                	jmp    804ad9 <udivmod+0x4e>
+  804ad1:	83 e9 01             	sub    $0x1,%ecx
+  804ad4:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804ad7:	74 68                	je     804b41 <udivmod+0xb6>
+  804ad9:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804add:	01 c0                	add    %eax,%eax
+  804adf:	89 c6                	mov    %eax,%esi
+  804ae1:	89 d7                	mov    %edx,%edi
+  804ae3:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804ae7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804aeb:	0f ad d0             	shrd   %cl,%edx,%eax
+  804aee:	d3 ea                	shr    %cl,%edx
+  804af0:	f6 c1 20             	test   $0x20,%cl
+  804af3:	74 04                	je     804af9 <udivmod+0x6e>
+  804af5:	89 d0                	mov    %edx,%eax
+  804af7:	31 d2                	xor    %edx,%edx
+  804af9:	83 e0 01             	and    $0x1,%eax
+  804afc:	89 04 24             	mov    %eax,(%esp)
+  804aff:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804b06:	00 
+  804b07:	8b 04 24             	mov    (%esp),%eax
+  804b0a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804b0e:	09 f0                	or     %esi,%eax
+  804b10:	09 fa                	or     %edi,%edx
+  804b12:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804b16:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804b1a:	39 f0                	cmp    %esi,%eax
+  804b1c:	89 d5                	mov    %edx,%ebp
+  804b1e:	19 fd                	sbb    %edi,%ebp
+  804b20:	72 af                	jb     804ad1 <udivmod+0x46>
+  804b22:	29 f0                	sub    %esi,%eax
+  804b24:	19 fa                	sbb    %edi,%edx
+  804b26:	89 cf                	mov    %ecx,%edi
+  804b28:	c1 ef 05             	shr    $0x5,%edi
+  804b2b:	83 e7 01             	and    $0x1,%edi
+  804b2e:	89 fe                	mov    %edi,%esi
+  804b30:	83 f6 01             	xor    $0x1,%esi
+  804b33:	d3 e6                	shl    %cl,%esi
+  804b35:	d3 e7                	shl    %cl,%edi
+  804b37:	09 74 24 18          	or     %esi,0x18(%esp)
+  804b3b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804b3f:	eb 90                	jmp    804ad1 <udivmod+0x46>
+  804b41:	85 db                	test   %ebx,%ebx
+  804b43:	74 05                	je     804b4a <udivmod+0xbf>
+  804b45:	89 03                	mov    %eax,(%ebx)
+  804b47:	89 53 04             	mov    %edx,0x4(%ebx)
+  804b4a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804b4e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804b52:	83 c4 24             	add    $0x24,%esp
+  804b55:	5b                   	pop    %ebx
+  804b56:	5e                   	pop    %esi
+  804b57:	5f                   	pop    %edi
+  804b58:	5d                   	pop    %ebp
+  804b59:	c3                   	ret
+
+00804b5a <__udivdi3>:
+  804b5a:	83 ec 08             	sub    $0x8,%esp
+  804b5d:	6a 00                	push   $0x0
+  804b5f:	ff 74 24 1c          	push   0x1c(%esp)
+  804b63:	ff 74 24 1c          	push   0x1c(%esp)
+  804b67:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804b6b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804b6f:	e8 17 ff ff ff       	call   804a8b <udivmod>
+  804b74:	83 c4 14             	add    $0x14,%esp
+  804b77:	c3                   	ret
+
+00804b78 <__umoddi3>:
+  804b78:	83 ec 18             	sub    $0x18,%esp
+  804b7b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804b7f:	50                   	push   %eax
+  804b80:	ff 74 24 2c          	push   0x2c(%esp)
+  804b84:	ff 74 24 2c          	push   0x2c(%esp)
+  804b88:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804b8c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804b90:	e8 f6 fe ff ff       	call   804a8b <udivmod>
+  804b95:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804b99:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804b9d:	83 c4 24             	add    $0x24,%esp
+  804ba0:	c3                   	ret
+
+00804ba1 <__divdi3>:
+  804ba1:	55                   	push   %ebp
+  804ba2:	57                   	push   %edi
+  804ba3:	56                   	push   %esi
+  804ba4:	53                   	push   %ebx
+  804ba5:	83 ec 10             	sub    $0x10,%esp
+  804ba8:	8b 44 24 24          	mov    0x24(%esp),%eax
+  804bac:	8b 54 24 28          	mov    0x28(%esp),%edx
+  804bb0:	89 c6                	mov    %eax,%esi
+  804bb2:	89 d7                	mov    %edx,%edi
+  804bb4:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  804bb8:	33 7c 24 30          	xor    0x30(%esp),%edi
+  804bbc:	89 74 24 04          	mov    %esi,0x4(%esp)
+  804bc0:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  804bc4:	89 c5                	mov    %eax,%ebp
+  804bc6:	f7 dd                	neg    %ebp
+  804bc8:	89 d6                	mov    %edx,%esi
+  804bca:	83 d6 00             	adc    $0x0,%esi
+  804bcd:	f7 de                	neg    %esi
+  804bcf:	0f 48 e8             	cmovs  %eax,%ebp
+  804bd2:	0f 49 d6             	cmovns %esi,%edx
+  804bd5:	6a 00                	push   $0x0
+  804bd7:	8b 74 24 30          	mov    0x30(%esp),%esi
+  804bdb:	f7 de                	neg    %esi
+  804bdd:	8b 44 24 34          	mov    0x34(%esp),%eax
+  804be1:	83 d0 00             	adc    $0x0,%eax
+  804be4:	f7 d8                	neg    %eax
+  804be6:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  804beb:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  804bf0:	50                   	push   %eax
+  804bf1:	56                   	push   %esi
+  804bf2:	89 e8                	mov    %ebp,%eax
+  804bf4:	e8 92 fe ff ff       	call   804a8b <udivmod>
+  804bf9:	83 c4 10             	add    $0x10,%esp
+  804bfc:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  804c01:	78 08                	js     804c0b <__divdi3+0x6a>
+  804c03:	83 c4 0c             	add    $0xc,%esp
+  804c06:	5b                   	pop    %ebx
+  804c07:	5e                   	pop    %esi
+  804c08:	5f                   	pop    %edi
+  804c09:	5d                   	pop    %ebp
+  804c0a:	c3                   	ret
+  804c0b:	f7 d8                	neg    %eax
+  804c0d:	83 d2 00             	adc    $0x0,%edx
+  804c10:	f7 da                	neg    %edx
+  804c12:	eb ef                	jmp    804c03 <__divdi3+0x62>
+
+00804c14 <__moddi3>:
+  804c14:	55                   	push   %ebp
+  804c15:	57                   	push   %edi
+  804c16:	56                   	push   %esi
+  804c17:	53                   	push   %ebx
+  804c18:	83 ec 18             	sub    $0x18,%esp
+  804c1b:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  804c1f:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  804c23:	89 f1                	mov    %esi,%ecx
+  804c25:	f7 d9                	neg    %ecx
+  804c27:	89 da                	mov    %ebx,%edx
+  804c29:	83 d2 00             	adc    $0x0,%edx
+  804c2c:	f7 da                	neg    %edx
+  804c2e:	0f 48 ce             	cmovs  %esi,%ecx
+  804c31:	0f 48 d3             	cmovs  %ebx,%edx
+  804c34:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804c38:	50                   	push   %eax
+  804c39:	8b 74 24 38          	mov    0x38(%esp),%esi
+  804c3d:	f7 de                	neg    %esi
+  804c3f:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  804c43:	83 d0 00             	adc    $0x0,%eax
+  804c46:	f7 d8                	neg    %eax
+  804c48:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  804c4d:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  804c52:	50                   	push   %eax
+  804c53:	56                   	push   %esi
+  804c54:	89 c8                	mov    %ecx,%eax
+  804c56:	e8 30 fe ff ff       	call   804a8b <udivmod>
+  804c5b:	83 c4 10             	add    $0x10,%esp
+  804c5e:	85 db                	test   %ebx,%ebx
+  804c60:	78 10                	js     804c72 <__moddi3+0x5e>
+  804c62:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804c66:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804c6a:	83 c4 14             	add    $0x14,%esp
+  804c6d:	5b                   	pop    %ebx
+  804c6e:	5e                   	pop    %esi
+  804c6f:	5f                   	pop    %edi
+  804c70:	5d                   	pop    %ebp
+  804c71:	c3                   	ret
+  804c72:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804c76:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804c7a:	f7 d8                	neg    %eax
+  804c7c:	83 d2 00             	adc    $0x0,%edx
+  804c7f:	f7 da                	neg    %edx
+  804c81:	eb e7                	jmp    804c6a <__moddi3+0x56>
@@ -0,0 +1,5766 @@
+
+obj/user/faultnostack.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_env_set_pgfault_upcall(0, (void*) _pgfault_upcall);
+  800039:	68 45 07 80 00       	push   $0x800745
+  80003e:	6a 00                	push   $0x0
+  800040:	e8 cb 04 00 00       	call   800510 <sys_env_set_pgfault_upcall>
+	*(int*)0 = 0;
+  800045:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80004c:	00 00 00 
+}
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	56                   	push   %esi
+  800058:	53                   	push   %ebx
+  800059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  80005f:	e8 08 01 00 00       	call   80016c <sys_getenvid>
+  800064:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800069:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80006c:	c1 e0 06             	shl    $0x6,%eax
+  80006f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800074:	a3 0c 40 80 00       	mov    %eax,0x80400c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800079:	85 db                	test   %ebx,%ebx
+  80007b:	7e 07                	jle    800084 <libmain+0x30>
+		binaryname = argv[0];
+  80007d:	8b 06                	mov    (%esi),%eax
+  80007f:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	56                   	push   %esi
+  800088:	53                   	push   %ebx
+  800089:	e8 a5 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80008e:	e8 0a 00 00 00       	call   80009d <exit>
+}
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800099:	5b                   	pop    %ebx
+  80009a:	5e                   	pop    %esi
+  80009b:	5d                   	pop    %ebp
+  80009c:	c3                   	ret
+
+0080009d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000a3:	e8 8e 08 00 00       	call   800936 <close_all>
+	sys_env_destroy(0);
+  8000a8:	83 ec 0c             	sub    $0xc,%esp
+  8000ab:	6a 00                	push   $0x0
+  8000ad:	e8 79 00 00 00       	call   80012b <sys_env_destroy>
+}
+  8000b2:	83 c4 10             	add    $0x10,%esp
+  8000b5:	c9                   	leave
+  8000b6:	c3                   	ret
+
+008000b7 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  8000b7:	55                   	push   %ebp
+  8000b8:	89 e5                	mov    %esp,%ebp
+  8000ba:	83 ec 10             	sub    $0x10,%esp
+  8000bd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000c0:	89 c8                	mov    %ecx,%eax
+  8000c2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8000c7:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8000ca:	eb 0b                	jmp    8000d7 <touch_mem+0x20>
+		c = *(char *)page;
+  8000cc:	0f b6 10             	movzbl (%eax),%edx
+  8000cf:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000d2:	05 00 10 00 00       	add    $0x1000,%eax
+  8000d7:	39 c8                	cmp    %ecx,%eax
+  8000d9:	72 f1                	jb     8000cc <touch_mem+0x15>
+}
+  8000db:	c9                   	leave
+  8000dc:	c3                   	ret
+
+008000dd <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000dd:	55                   	push   %ebp
+  8000de:	89 e5                	mov    %esp,%ebp
+  8000e0:	57                   	push   %edi
+  8000e1:	56                   	push   %esi
+  8000e2:	53                   	push   %ebx
+	touch_mem(s, len);
+  8000e3:	ff 75 0c             	push   0xc(%ebp)
+  8000e6:	ff 75 08             	push   0x8(%ebp)
+  8000e9:	e8 c9 ff ff ff       	call   8000b7 <touch_mem>
+	asm volatile("int %1\n"
+  8000ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000f9:	89 c3                	mov    %eax,%ebx
+  8000fb:	89 c7                	mov    %eax,%edi
+  8000fd:	89 c6                	mov    %eax,%esi
+  8000ff:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800101:	83 c4 08             	add    $0x8,%esp
+  800104:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800107:	5b                   	pop    %ebx
+  800108:	5e                   	pop    %esi
+  800109:	5f                   	pop    %edi
+  80010a:	5d                   	pop    %ebp
+  80010b:	c3                   	ret
+
+0080010c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80010c:	55                   	push   %ebp
+  80010d:	89 e5                	mov    %esp,%ebp
+  80010f:	57                   	push   %edi
+  800110:	56                   	push   %esi
+  800111:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800112:	ba 00 00 00 00       	mov    $0x0,%edx
+  800117:	b8 01 00 00 00       	mov    $0x1,%eax
+  80011c:	89 d1                	mov    %edx,%ecx
+  80011e:	89 d3                	mov    %edx,%ebx
+  800120:	89 d7                	mov    %edx,%edi
+  800122:	89 d6                	mov    %edx,%esi
+  800124:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800126:	5b                   	pop    %ebx
+  800127:	5e                   	pop    %esi
+  800128:	5f                   	pop    %edi
+  800129:	5d                   	pop    %ebp
+  80012a:	c3                   	ret
+
+0080012b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80012b:	55                   	push   %ebp
+  80012c:	89 e5                	mov    %esp,%ebp
+  80012e:	57                   	push   %edi
+  80012f:	56                   	push   %esi
+  800130:	53                   	push   %ebx
+  800131:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800134:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800139:	8b 55 08             	mov    0x8(%ebp),%edx
+  80013c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800141:	89 cb                	mov    %ecx,%ebx
+  800143:	89 cf                	mov    %ecx,%edi
+  800145:	89 ce                	mov    %ecx,%esi
+  800147:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800149:	85 c0                	test   %eax,%eax
+  80014b:	7f 08                	jg     800155 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80014d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800150:	5b                   	pop    %ebx
+  800151:	5e                   	pop    %esi
+  800152:	5f                   	pop    %edi
+  800153:	5d                   	pop    %ebp
+  800154:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800155:	83 ec 0c             	sub    $0xc,%esp
+  800158:	50                   	push   %eax
+  800159:	6a 03                	push   $0x3
+  80015b:	68 ca 27 80 00       	push   $0x8027ca
+  800160:	6a 23                	push   $0x23
+  800162:	68 e7 27 80 00       	push   $0x8027e7
+  800167:	e8 df 15 00 00       	call   80174b <_panic>
+
+0080016c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80016c:	55                   	push   %ebp
+  80016d:	89 e5                	mov    %esp,%ebp
+  80016f:	57                   	push   %edi
+  800170:	56                   	push   %esi
+  800171:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800172:	ba 00 00 00 00       	mov    $0x0,%edx
+  800177:	b8 02 00 00 00       	mov    $0x2,%eax
+  80017c:	89 d1                	mov    %edx,%ecx
+  80017e:	89 d3                	mov    %edx,%ebx
+  800180:	89 d7                	mov    %edx,%edi
+  800182:	89 d6                	mov    %edx,%esi
+  800184:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800186:	5b                   	pop    %ebx
+  800187:	5e                   	pop    %esi
+  800188:	5f                   	pop    %edi
+  800189:	5d                   	pop    %ebp
+  80018a:	c3                   	ret
+
+0080018b <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80018b:	55                   	push   %ebp
+  80018c:	89 e5                	mov    %esp,%ebp
+  80018e:	57                   	push   %edi
+  80018f:	56                   	push   %esi
+  800190:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800191:	ba 00 00 00 00       	mov    $0x0,%edx
+  800196:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80019b:	89 d1                	mov    %edx,%ecx
+  80019d:	89 d3                	mov    %edx,%ebx
+  80019f:	89 d7                	mov    %edx,%edi
+  8001a1:	89 d6                	mov    %edx,%esi
+  8001a3:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8001a5:	5b                   	pop    %ebx
+  8001a6:	5e                   	pop    %esi
+  8001a7:	5f                   	pop    %edi
+  8001a8:	5d                   	pop    %ebp
+  8001a9:	c3                   	ret
+
+008001aa <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001aa:	55                   	push   %ebp
+  8001ab:	89 e5                	mov    %esp,%ebp
+  8001ad:	57                   	push   %edi
+  8001ae:	56                   	push   %esi
+  8001af:	53                   	push   %ebx
+  8001b0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8001b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001be:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001c6:	89 f7                	mov    %esi,%edi
+  8001c8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001ca:	85 c0                	test   %eax,%eax
+  8001cc:	7f 08                	jg     8001d6 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d1:	5b                   	pop    %ebx
+  8001d2:	5e                   	pop    %esi
+  8001d3:	5f                   	pop    %edi
+  8001d4:	5d                   	pop    %ebp
+  8001d5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001d6:	83 ec 0c             	sub    $0xc,%esp
+  8001d9:	50                   	push   %eax
+  8001da:	6a 04                	push   $0x4
+  8001dc:	68 ca 27 80 00       	push   $0x8027ca
+  8001e1:	6a 23                	push   $0x23
+  8001e3:	68 e7 27 80 00       	push   $0x8027e7
+  8001e8:	e8 5e 15 00 00       	call   80174b <_panic>
+
+008001ed <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001ed:	55                   	push   %ebp
+  8001ee:	89 e5                	mov    %esp,%ebp
+  8001f0:	57                   	push   %edi
+  8001f1:	56                   	push   %esi
+  8001f2:	53                   	push   %ebx
+  8001f3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001fc:	b8 05 00 00 00       	mov    $0x5,%eax
+  800201:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800204:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800207:	8b 75 18             	mov    0x18(%ebp),%esi
+  80020a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80020c:	85 c0                	test   %eax,%eax
+  80020e:	7f 08                	jg     800218 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800210:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800213:	5b                   	pop    %ebx
+  800214:	5e                   	pop    %esi
+  800215:	5f                   	pop    %edi
+  800216:	5d                   	pop    %ebp
+  800217:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800218:	83 ec 0c             	sub    $0xc,%esp
+  80021b:	50                   	push   %eax
+  80021c:	6a 05                	push   $0x5
+  80021e:	68 ca 27 80 00       	push   $0x8027ca
+  800223:	6a 23                	push   $0x23
+  800225:	68 e7 27 80 00       	push   $0x8027e7
+  80022a:	e8 1c 15 00 00       	call   80174b <_panic>
+
+0080022f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80022f:	55                   	push   %ebp
+  800230:	89 e5                	mov    %esp,%ebp
+  800232:	57                   	push   %edi
+  800233:	56                   	push   %esi
+  800234:	53                   	push   %ebx
+  800235:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800238:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80023d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800240:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800243:	b8 06 00 00 00       	mov    $0x6,%eax
+  800248:	89 df                	mov    %ebx,%edi
+  80024a:	89 de                	mov    %ebx,%esi
+  80024c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80024e:	85 c0                	test   %eax,%eax
+  800250:	7f 08                	jg     80025a <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800252:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800255:	5b                   	pop    %ebx
+  800256:	5e                   	pop    %esi
+  800257:	5f                   	pop    %edi
+  800258:	5d                   	pop    %ebp
+  800259:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80025a:	83 ec 0c             	sub    $0xc,%esp
+  80025d:	50                   	push   %eax
+  80025e:	6a 06                	push   $0x6
+  800260:	68 ca 27 80 00       	push   $0x8027ca
+  800265:	6a 23                	push   $0x23
+  800267:	68 e7 27 80 00       	push   $0x8027e7
+  80026c:	e8 da 14 00 00       	call   80174b <_panic>
+
+00800271 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800271:	55                   	push   %ebp
+  800272:	89 e5                	mov    %esp,%ebp
+  800274:	57                   	push   %edi
+  800275:	56                   	push   %esi
+  800276:	53                   	push   %ebx
+  800277:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80027a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80027f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800282:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800285:	b8 18 00 00 00       	mov    $0x18,%eax
+  80028a:	89 df                	mov    %ebx,%edi
+  80028c:	89 de                	mov    %ebx,%esi
+  80028e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800290:	85 c0                	test   %eax,%eax
+  800292:	7f 08                	jg     80029c <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800294:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800297:	5b                   	pop    %ebx
+  800298:	5e                   	pop    %esi
+  800299:	5f                   	pop    %edi
+  80029a:	5d                   	pop    %ebp
+  80029b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80029c:	83 ec 0c             	sub    $0xc,%esp
+  80029f:	50                   	push   %eax
+  8002a0:	6a 18                	push   $0x18
+  8002a2:	68 ca 27 80 00       	push   $0x8027ca
+  8002a7:	6a 23                	push   $0x23
+  8002a9:	68 e7 27 80 00       	push   $0x8027e7
+  8002ae:	e8 98 14 00 00       	call   80174b <_panic>
+
+008002b3 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  8002b3:	55                   	push   %ebp
+  8002b4:	89 e5                	mov    %esp,%ebp
+  8002b6:	57                   	push   %edi
+  8002b7:	56                   	push   %esi
+  8002b8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8002be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c4:	b8 19 00 00 00       	mov    $0x19,%eax
+  8002c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002cc:	89 f7                	mov    %esi,%edi
+  8002ce:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  8002d0:	5b                   	pop    %ebx
+  8002d1:	5e                   	pop    %esi
+  8002d2:	5f                   	pop    %edi
+  8002d3:	5d                   	pop    %ebp
+  8002d4:	c3                   	ret
+
+008002d5 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8002d5:	55                   	push   %ebp
+  8002d6:	89 e5                	mov    %esp,%ebp
+  8002d8:	57                   	push   %edi
+  8002d9:	56                   	push   %esi
+  8002da:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002e1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8002eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002ee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002f1:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8002f3:	5b                   	pop    %ebx
+  8002f4:	5e                   	pop    %esi
+  8002f5:	5f                   	pop    %edi
+  8002f6:	5d                   	pop    %ebp
+  8002f7:	c3                   	ret
+
+008002f8 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  8002f8:	55                   	push   %ebp
+  8002f9:	89 e5                	mov    %esp,%ebp
+  8002fb:	57                   	push   %edi
+  8002fc:	56                   	push   %esi
+  8002fd:	53                   	push   %ebx
+  8002fe:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800301:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800304:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  80030a:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  80030d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800310:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800313:	b8 10 00 00 00       	mov    $0x10,%eax
+  800318:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80031b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80031e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800320:	85 c0                	test   %eax,%eax
+  800322:	7f 08                	jg     80032c <sys_page_map_range+0x34>
+}
+  800324:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800327:	5b                   	pop    %ebx
+  800328:	5e                   	pop    %esi
+  800329:	5f                   	pop    %edi
+  80032a:	5d                   	pop    %ebp
+  80032b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80032c:	83 ec 0c             	sub    $0xc,%esp
+  80032f:	50                   	push   %eax
+  800330:	6a 10                	push   $0x10
+  800332:	68 ca 27 80 00       	push   $0x8027ca
+  800337:	6a 23                	push   $0x23
+  800339:	68 e7 27 80 00       	push   $0x8027e7
+  80033e:	e8 08 14 00 00       	call   80174b <_panic>
+
+00800343 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800343:	55                   	push   %ebp
+  800344:	89 e5                	mov    %esp,%ebp
+  800346:	57                   	push   %edi
+  800347:	56                   	push   %esi
+  800348:	53                   	push   %ebx
+  800349:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80034c:	be 00 00 00 00       	mov    $0x0,%esi
+  800351:	8b 55 08             	mov    0x8(%ebp),%edx
+  800354:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800357:	b8 11 00 00 00       	mov    $0x11,%eax
+  80035c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80035f:	89 f7                	mov    %esi,%edi
+  800361:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800363:	85 c0                	test   %eax,%eax
+  800365:	7f 08                	jg     80036f <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800367:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80036a:	5b                   	pop    %ebx
+  80036b:	5e                   	pop    %esi
+  80036c:	5f                   	pop    %edi
+  80036d:	5d                   	pop    %ebp
+  80036e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80036f:	83 ec 0c             	sub    $0xc,%esp
+  800372:	50                   	push   %eax
+  800373:	6a 11                	push   $0x11
+  800375:	68 ca 27 80 00       	push   $0x8027ca
+  80037a:	6a 23                	push   $0x23
+  80037c:	68 e7 27 80 00       	push   $0x8027e7
+  800381:	e8 c5 13 00 00       	call   80174b <_panic>
+
+00800386 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800386:	55                   	push   %ebp
+  800387:	89 e5                	mov    %esp,%ebp
+  800389:	57                   	push   %edi
+  80038a:	56                   	push   %esi
+  80038b:	53                   	push   %ebx
+  80038c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80038f:	be 00 00 00 00       	mov    $0x0,%esi
+  800394:	8b 55 08             	mov    0x8(%ebp),%edx
+  800397:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80039a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80039f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003a2:	89 f7                	mov    %esi,%edi
+  8003a4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003a6:	85 c0                	test   %eax,%eax
+  8003a8:	7f 08                	jg     8003b2 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8003aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ad:	5b                   	pop    %ebx
+  8003ae:	5e                   	pop    %esi
+  8003af:	5f                   	pop    %edi
+  8003b0:	5d                   	pop    %ebp
+  8003b1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003b2:	83 ec 0c             	sub    $0xc,%esp
+  8003b5:	50                   	push   %eax
+  8003b6:	6a 1b                	push   $0x1b
+  8003b8:	68 ca 27 80 00       	push   $0x8027ca
+  8003bd:	6a 23                	push   $0x23
+  8003bf:	68 e7 27 80 00       	push   $0x8027e7
+  8003c4:	e8 82 13 00 00       	call   80174b <_panic>
+
+008003c9 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  8003c9:	55                   	push   %ebp
+  8003ca:	89 e5                	mov    %esp,%ebp
+  8003cc:	57                   	push   %edi
+  8003cd:	56                   	push   %esi
+  8003ce:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003d4:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003d9:	89 d1                	mov    %edx,%ecx
+  8003db:	89 d3                	mov    %edx,%ebx
+  8003dd:	89 d7                	mov    %edx,%edi
+  8003df:	89 d6                	mov    %edx,%esi
+  8003e1:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8003e3:	5b                   	pop    %ebx
+  8003e4:	5e                   	pop    %esi
+  8003e5:	5f                   	pop    %edi
+  8003e6:	5d                   	pop    %ebp
+  8003e7:	c3                   	ret
+
+008003e8 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003e8:	55                   	push   %ebp
+  8003e9:	89 e5                	mov    %esp,%ebp
+  8003eb:	57                   	push   %edi
+  8003ec:	56                   	push   %esi
+  8003ed:	53                   	push   %ebx
+  8003ee:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003fc:	b8 08 00 00 00       	mov    $0x8,%eax
+  800401:	89 df                	mov    %ebx,%edi
+  800403:	89 de                	mov    %ebx,%esi
+  800405:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800407:	85 c0                	test   %eax,%eax
+  800409:	7f 08                	jg     800413 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80040b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80040e:	5b                   	pop    %ebx
+  80040f:	5e                   	pop    %esi
+  800410:	5f                   	pop    %edi
+  800411:	5d                   	pop    %ebp
+  800412:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800413:	83 ec 0c             	sub    $0xc,%esp
+  800416:	50                   	push   %eax
+  800417:	6a 08                	push   $0x8
+  800419:	68 ca 27 80 00       	push   $0x8027ca
+  80041e:	6a 23                	push   $0x23
+  800420:	68 e7 27 80 00       	push   $0x8027e7
+  800425:	e8 21 13 00 00       	call   80174b <_panic>
+
+0080042a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80042a:	55                   	push   %ebp
+  80042b:	89 e5                	mov    %esp,%ebp
+  80042d:	57                   	push   %edi
+  80042e:	56                   	push   %esi
+  80042f:	53                   	push   %ebx
+  800430:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800433:	6a 44                	push   $0x44
+  800435:	ff 75 0c             	push   0xc(%ebp)
+  800438:	e8 7a fc ff ff       	call   8000b7 <touch_mem>
+	asm volatile("int %1\n"
+  80043d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800442:	8b 55 08             	mov    0x8(%ebp),%edx
+  800445:	b8 09 00 00 00       	mov    $0x9,%eax
+  80044a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80044d:	89 df                	mov    %ebx,%edi
+  80044f:	89 de                	mov    %ebx,%esi
+  800451:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800453:	83 c4 08             	add    $0x8,%esp
+  800456:	85 c0                	test   %eax,%eax
+  800458:	7f 08                	jg     800462 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80045a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80045d:	5b                   	pop    %ebx
+  80045e:	5e                   	pop    %esi
+  80045f:	5f                   	pop    %edi
+  800460:	5d                   	pop    %ebp
+  800461:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800462:	83 ec 0c             	sub    $0xc,%esp
+  800465:	50                   	push   %eax
+  800466:	6a 09                	push   $0x9
+  800468:	68 ca 27 80 00       	push   $0x8027ca
+  80046d:	6a 23                	push   $0x23
+  80046f:	68 e7 27 80 00       	push   $0x8027e7
+  800474:	e8 d2 12 00 00       	call   80174b <_panic>
+
+00800479 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800479:	55                   	push   %ebp
+  80047a:	89 e5                	mov    %esp,%ebp
+  80047c:	57                   	push   %edi
+  80047d:	56                   	push   %esi
+  80047e:	53                   	push   %ebx
+  80047f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800482:	be 00 00 00 00       	mov    $0x0,%esi
+  800487:	8b 55 08             	mov    0x8(%ebp),%edx
+  80048a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80048d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800492:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800495:	89 f7                	mov    %esi,%edi
+  800497:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800499:	85 c0                	test   %eax,%eax
+  80049b:	7f 08                	jg     8004a5 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  80049d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004a0:	5b                   	pop    %ebx
+  8004a1:	5e                   	pop    %esi
+  8004a2:	5f                   	pop    %edi
+  8004a3:	5d                   	pop    %ebp
+  8004a4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004a5:	83 ec 0c             	sub    $0xc,%esp
+  8004a8:	50                   	push   %eax
+  8004a9:	6a 1a                	push   $0x1a
+  8004ab:	68 ca 27 80 00       	push   $0x8027ca
+  8004b0:	6a 23                	push   $0x23
+  8004b2:	68 e7 27 80 00       	push   $0x8027e7
+  8004b7:	e8 8f 12 00 00       	call   80174b <_panic>
+
+008004bc <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8004bc:	55                   	push   %ebp
+  8004bd:	89 e5                	mov    %esp,%ebp
+  8004bf:	57                   	push   %edi
+  8004c0:	56                   	push   %esi
+  8004c1:	53                   	push   %ebx
+  8004c2:	83 ec 0c             	sub    $0xc,%esp
+  8004c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8004c8:	89 d8                	mov    %ebx,%eax
+  8004ca:	c1 e0 05             	shl    $0x5,%eax
+  8004cd:	50                   	push   %eax
+  8004ce:	ff 75 0c             	push   0xc(%ebp)
+  8004d1:	e8 e1 fb ff ff       	call   8000b7 <touch_mem>
+	asm volatile("int %1\n"
+  8004d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8004db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004de:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004e6:	89 f7                	mov    %esi,%edi
+  8004e8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004ea:	83 c4 08             	add    $0x8,%esp
+  8004ed:	85 c0                	test   %eax,%eax
+  8004ef:	7f 08                	jg     8004f9 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8004f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004f4:	5b                   	pop    %ebx
+  8004f5:	5e                   	pop    %esi
+  8004f6:	5f                   	pop    %edi
+  8004f7:	5d                   	pop    %ebp
+  8004f8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004f9:	83 ec 0c             	sub    $0xc,%esp
+  8004fc:	50                   	push   %eax
+  8004fd:	6a 13                	push   $0x13
+  8004ff:	68 ca 27 80 00       	push   $0x8027ca
+  800504:	6a 23                	push   $0x23
+  800506:	68 e7 27 80 00       	push   $0x8027e7
+  80050b:	e8 3b 12 00 00       	call   80174b <_panic>
+
+00800510 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800510:	55                   	push   %ebp
+  800511:	89 e5                	mov    %esp,%ebp
+  800513:	57                   	push   %edi
+  800514:	56                   	push   %esi
+  800515:	53                   	push   %ebx
+  800516:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800519:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80051e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800521:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800524:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800529:	89 df                	mov    %ebx,%edi
+  80052b:	89 de                	mov    %ebx,%esi
+  80052d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80052f:	85 c0                	test   %eax,%eax
+  800531:	7f 08                	jg     80053b <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800533:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800536:	5b                   	pop    %ebx
+  800537:	5e                   	pop    %esi
+  800538:	5f                   	pop    %edi
+  800539:	5d                   	pop    %ebp
+  80053a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80053b:	83 ec 0c             	sub    $0xc,%esp
+  80053e:	50                   	push   %eax
+  80053f:	6a 0a                	push   $0xa
+  800541:	68 ca 27 80 00       	push   $0x8027ca
+  800546:	6a 23                	push   $0x23
+  800548:	68 e7 27 80 00       	push   $0x8027e7
+  80054d:	e8 f9 11 00 00       	call   80174b <_panic>
+
+00800552 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800552:	55                   	push   %ebp
+  800553:	89 e5                	mov    %esp,%ebp
+  800555:	57                   	push   %edi
+  800556:	56                   	push   %esi
+  800557:	53                   	push   %ebx
+  800558:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  80055b:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800561:	76 1d                	jbe    800580 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  800563:	8b 55 08             	mov    0x8(%ebp),%edx
+  800566:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800569:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80056e:	be 01 00 00 00       	mov    $0x1,%esi
+  800573:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800576:	cd 30                	int    $0x30
+}
+  800578:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80057b:	5b                   	pop    %ebx
+  80057c:	5e                   	pop    %esi
+  80057d:	5f                   	pop    %edi
+  80057e:	5d                   	pop    %ebp
+  80057f:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  800580:	68 00 10 00 00       	push   $0x1000
+  800585:	53                   	push   %ebx
+  800586:	e8 2c fb ff ff       	call   8000b7 <touch_mem>
+  80058b:	83 c4 08             	add    $0x8,%esp
+  80058e:	eb d3                	jmp    800563 <sys_ipc_send+0x11>
+
+00800590 <sys_ipc_send_pages>:
+{
+  800590:	55                   	push   %ebp
+  800591:	89 e5                	mov    %esp,%ebp
+  800593:	57                   	push   %edi
+  800594:	56                   	push   %esi
+  800595:	53                   	push   %ebx
+  800596:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800599:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  80059c:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8005a2:	76 18                	jbe    8005bc <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8005a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005aa:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8005af:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8005b2:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8005b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005b7:	5b                   	pop    %ebx
+  8005b8:	5e                   	pop    %esi
+  8005b9:	5f                   	pop    %edi
+  8005ba:	5d                   	pop    %ebp
+  8005bb:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8005bc:	89 f0                	mov    %esi,%eax
+  8005be:	c1 e0 0c             	shl    $0xc,%eax
+  8005c1:	50                   	push   %eax
+  8005c2:	53                   	push   %ebx
+  8005c3:	e8 ef fa ff ff       	call   8000b7 <touch_mem>
+  8005c8:	83 c4 08             	add    $0x8,%esp
+  8005cb:	eb d7                	jmp    8005a4 <sys_ipc_send_pages+0x14>
+
+008005cd <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8005cd:	55                   	push   %ebp
+  8005ce:	89 e5                	mov    %esp,%ebp
+  8005d0:	57                   	push   %edi
+  8005d1:	56                   	push   %esi
+  8005d2:	53                   	push   %ebx
+  8005d3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8005d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005e1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8005e6:	89 df                	mov    %ebx,%edi
+  8005e8:	89 de                	mov    %ebx,%esi
+  8005ea:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8005ec:	85 c0                	test   %eax,%eax
+  8005ee:	7f 08                	jg     8005f8 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8005f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005f3:	5b                   	pop    %ebx
+  8005f4:	5e                   	pop    %esi
+  8005f5:	5f                   	pop    %edi
+  8005f6:	5d                   	pop    %ebp
+  8005f7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8005f8:	83 ec 0c             	sub    $0xc,%esp
+  8005fb:	50                   	push   %eax
+  8005fc:	6a 0d                	push   $0xd
+  8005fe:	68 ca 27 80 00       	push   $0x8027ca
+  800603:	6a 23                	push   $0x23
+  800605:	68 e7 27 80 00       	push   $0x8027e7
+  80060a:	e8 3c 11 00 00       	call   80174b <_panic>
+
+0080060f <sys_ipc_recv>:
+{
+  80060f:	55                   	push   %ebp
+  800610:	89 e5                	mov    %esp,%ebp
+  800612:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  800615:	6a 01                	push   $0x1
+  800617:	ff 75 08             	push   0x8(%ebp)
+  80061a:	e8 ae ff ff ff       	call   8005cd <sys_ipc_recv_pages>
+}
+  80061f:	c9                   	leave
+  800620:	c3                   	ret
+
+00800621 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  800621:	55                   	push   %ebp
+  800622:	89 e5                	mov    %esp,%ebp
+  800624:	57                   	push   %edi
+  800625:	56                   	push   %esi
+  800626:	53                   	push   %ebx
+  800627:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80062a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80062d:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  800630:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800636:	77 04                	ja     80063c <sys_ipc_call+0x1b>
+  800638:	85 f6                	test   %esi,%esi
+  80063a:	75 15                	jne    800651 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  80063c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80063f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800642:	b8 14 00 00 00       	mov    $0x14,%eax
+  800647:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  800649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80064c:	5b                   	pop    %ebx
+  80064d:	5e                   	pop    %esi
+  80064e:	5f                   	pop    %edi
+  80064f:	5d                   	pop    %ebp
+  800650:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  800651:	89 f8                	mov    %edi,%eax
+  800653:	c1 e0 0c             	shl    $0xc,%eax
+  800656:	50                   	push   %eax
+  800657:	53                   	push   %ebx
+  800658:	e8 5a fa ff ff       	call   8000b7 <touch_mem>
+  80065d:	83 c4 08             	add    $0x8,%esp
+  800660:	eb da                	jmp    80063c <sys_ipc_call+0x1b>
+
+00800662 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  800662:	55                   	push   %ebp
+  800663:	89 e5                	mov    %esp,%ebp
+  800665:	57                   	push   %edi
+  800666:	56                   	push   %esi
+  800667:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800668:	8b 55 08             	mov    0x8(%ebp),%edx
+  80066b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80066e:	b8 15 00 00 00       	mov    $0x15,%eax
+  800673:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800676:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800679:	8b 75 18             	mov    0x18(%ebp),%esi
+  80067c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80067e:	5b                   	pop    %ebx
+  80067f:	5e                   	pop    %esi
+  800680:	5f                   	pop    %edi
+  800681:	5d                   	pop    %ebp
+  800682:	c3                   	ret
+
+00800683 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  800683:	55                   	push   %ebp
+  800684:	89 e5                	mov    %esp,%ebp
+  800686:	57                   	push   %edi
+  800687:	56                   	push   %esi
+  800688:	53                   	push   %ebx
+  800689:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  80068c:	6a 04                	push   $0x4
+  80068e:	ff 75 08             	push   0x8(%ebp)
+  800691:	e8 21 fa ff ff       	call   8000b7 <touch_mem>
+	asm volatile("int %1\n"
+  800696:	be 00 00 00 00       	mov    $0x0,%esi
+  80069b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80069e:	b8 16 00 00 00       	mov    $0x16,%eax
+  8006a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8006a9:	89 f7                	mov    %esi,%edi
+  8006ab:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8006ad:	83 c4 08             	add    $0x8,%esp
+  8006b0:	85 c0                	test   %eax,%eax
+  8006b2:	7f 08                	jg     8006bc <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8006b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006b7:	5b                   	pop    %ebx
+  8006b8:	5e                   	pop    %esi
+  8006b9:	5f                   	pop    %edi
+  8006ba:	5d                   	pop    %ebp
+  8006bb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006bc:	83 ec 0c             	sub    $0xc,%esp
+  8006bf:	50                   	push   %eax
+  8006c0:	6a 16                	push   $0x16
+  8006c2:	68 ca 27 80 00       	push   $0x8027ca
+  8006c7:	6a 23                	push   $0x23
+  8006c9:	68 e7 27 80 00       	push   $0x8027e7
+  8006ce:	e8 78 10 00 00       	call   80174b <_panic>
+
+008006d3 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8006d3:	55                   	push   %ebp
+  8006d4:	89 e5                	mov    %esp,%ebp
+  8006d6:	57                   	push   %edi
+  8006d7:	56                   	push   %esi
+  8006d8:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8006d9:	6a 04                	push   $0x4
+  8006db:	ff 75 08             	push   0x8(%ebp)
+  8006de:	e8 d4 f9 ff ff       	call   8000b7 <touch_mem>
+	asm volatile("int %1\n"
+  8006e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006eb:	b8 17 00 00 00       	mov    $0x17,%eax
+  8006f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006f3:	89 df                	mov    %ebx,%edi
+  8006f5:	89 de                	mov    %ebx,%esi
+  8006f7:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8006f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006fc:	5b                   	pop    %ebx
+  8006fd:	5e                   	pop    %esi
+  8006fe:	5f                   	pop    %edi
+  8006ff:	5d                   	pop    %ebp
+  800700:	c3                   	ret
+
+00800701 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  800701:	55                   	push   %ebp
+  800702:	89 e5                	mov    %esp,%ebp
+  800704:	57                   	push   %edi
+  800705:	56                   	push   %esi
+  800706:	53                   	push   %ebx
+  800707:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80070a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80070f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800712:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800717:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80071c:	89 df                	mov    %ebx,%edi
+  80071e:	89 de                	mov    %ebx,%esi
+  800720:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800722:	85 c0                	test   %eax,%eax
+  800724:	7f 08                	jg     80072e <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  800726:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800729:	5b                   	pop    %ebx
+  80072a:	5e                   	pop    %esi
+  80072b:	5f                   	pop    %edi
+  80072c:	5d                   	pop    %ebp
+  80072d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80072e:	83 ec 0c             	sub    $0xc,%esp
+  800731:	50                   	push   %eax
+  800732:	6a 0e                	push   $0xe
+  800734:	68 ca 27 80 00       	push   $0x8027ca
+  800739:	6a 23                	push   $0x23
+  80073b:	68 e7 27 80 00       	push   $0x8027e7
+  800740:	e8 06 10 00 00       	call   80174b <_panic>
+
+00800745 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  800745:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  800746:	a1 28 60 80 00       	mov    0x806028,%eax
+	call *%eax
+  80074b:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80074d:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  800750:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  800754:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  800758:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  80075b:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  80075d:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  800761:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  800764:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  800765:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  800768:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  800769:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80076a:	c3                   	ret
+
+0080076b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80076b:	55                   	push   %ebp
+  80076c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80076e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800771:	05 00 00 00 30       	add    $0x30000000,%eax
+  800776:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800779:	5d                   	pop    %ebp
+  80077a:	c3                   	ret
+
+0080077b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80077b:	55                   	push   %ebp
+  80077c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80077e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800781:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800786:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80078b:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800790:	5d                   	pop    %ebp
+  800791:	c3                   	ret
+
+00800792 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800792:	55                   	push   %ebp
+  800793:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  800795:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  80079a:	a8 01                	test   $0x1,%al
+  80079c:	74 3c                	je     8007da <fd_alloc+0x48>
+  80079e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8007a3:	89 c2                	mov    %eax,%edx
+  8007a5:	c1 ea 0c             	shr    $0xc,%edx
+  8007a8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8007af:	89 c1                	mov    %eax,%ecx
+  8007b1:	05 00 10 00 00       	add    $0x1000,%eax
+  8007b6:	f6 c2 01             	test   $0x1,%dl
+  8007b9:	74 13                	je     8007ce <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8007bb:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8007c0:	75 e1                	jne    8007a3 <fd_alloc+0x11>
+  8007c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8007c7:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8007cc:	eb 05                	jmp    8007d3 <fd_alloc+0x41>
+			return 0;
+  8007ce:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8007d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007d6:	89 0a                	mov    %ecx,(%edx)
+}
+  8007d8:	5d                   	pop    %ebp
+  8007d9:	c3                   	ret
+  8007da:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8007df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e4:	eb ed                	jmp    8007d3 <fd_alloc+0x41>
+
+008007e6 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8007e6:	55                   	push   %ebp
+  8007e7:	89 e5                	mov    %esp,%ebp
+  8007e9:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8007ec:	83 f8 1f             	cmp    $0x1f,%eax
+  8007ef:	77 30                	ja     800821 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8007f1:	c1 e0 0c             	shl    $0xc,%eax
+  8007f4:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8007f9:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8007ff:	f6 c2 01             	test   $0x1,%dl
+  800802:	74 24                	je     800828 <fd_lookup+0x42>
+  800804:	89 c2                	mov    %eax,%edx
+  800806:	c1 ea 0c             	shr    $0xc,%edx
+  800809:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800810:	f6 c2 01             	test   $0x1,%dl
+  800813:	74 1a                	je     80082f <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800815:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800818:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80081f:	5d                   	pop    %ebp
+  800820:	c3                   	ret
+		return -E_INVAL;
+  800821:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800826:	eb f7                	jmp    80081f <fd_lookup+0x39>
+		return -E_INVAL;
+  800828:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80082d:	eb f0                	jmp    80081f <fd_lookup+0x39>
+  80082f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800834:	eb e9                	jmp    80081f <fd_lookup+0x39>
+
+00800836 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800836:	55                   	push   %ebp
+  800837:	89 e5                	mov    %esp,%ebp
+  800839:	53                   	push   %ebx
+  80083a:	83 ec 04             	sub    $0x4,%esp
+  80083d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800840:	b8 74 28 80 00       	mov    $0x802874,%eax
+  800845:	8b 18                	mov    (%eax),%ebx
+  800847:	85 db                	test   %ebx,%ebx
+  800849:	74 0e                	je     800859 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  80084b:	83 c0 04             	add    $0x4,%eax
+  80084e:	39 13                	cmp    %edx,(%ebx)
+  800850:	75 f3                	jne    800845 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  800852:	b8 00 00 00 00       	mov    $0x0,%eax
+  800857:	eb 1f                	jmp    800878 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800859:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80085e:	8b 40 48             	mov    0x48(%eax),%eax
+  800861:	83 ec 04             	sub    $0x4,%esp
+  800864:	52                   	push   %edx
+  800865:	50                   	push   %eax
+  800866:	68 f8 27 80 00       	push   $0x8027f8
+  80086b:	e8 b6 0f 00 00       	call   801826 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800870:	83 c4 10             	add    $0x10,%esp
+  800873:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800878:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80087b:	89 1a                	mov    %ebx,(%edx)
+}
+  80087d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800880:	c9                   	leave
+  800881:	c3                   	ret
+
+00800882 <fd_close>:
+{
+  800882:	55                   	push   %ebp
+  800883:	89 e5                	mov    %esp,%ebp
+  800885:	57                   	push   %edi
+  800886:	56                   	push   %esi
+  800887:	53                   	push   %ebx
+  800888:	83 ec 24             	sub    $0x24,%esp
+  80088b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80088e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800891:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800894:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800895:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80089b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80089e:	50                   	push   %eax
+  80089f:	e8 42 ff ff ff       	call   8007e6 <fd_lookup>
+  8008a4:	89 c3                	mov    %eax,%ebx
+  8008a6:	83 c4 10             	add    $0x10,%esp
+  8008a9:	85 c0                	test   %eax,%eax
+  8008ab:	78 05                	js     8008b2 <fd_close+0x30>
+	    || fd != fd2)
+  8008ad:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8008b0:	74 16                	je     8008c8 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8008b2:	89 f8                	mov    %edi,%eax
+  8008b4:	84 c0                	test   %al,%al
+  8008b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008bb:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8008be:	89 d8                	mov    %ebx,%eax
+  8008c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008c3:	5b                   	pop    %ebx
+  8008c4:	5e                   	pop    %esi
+  8008c5:	5f                   	pop    %edi
+  8008c6:	5d                   	pop    %ebp
+  8008c7:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8008c8:	83 ec 08             	sub    $0x8,%esp
+  8008cb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8008ce:	50                   	push   %eax
+  8008cf:	ff 36                	push   (%esi)
+  8008d1:	e8 60 ff ff ff       	call   800836 <dev_lookup>
+  8008d6:	89 c3                	mov    %eax,%ebx
+  8008d8:	83 c4 10             	add    $0x10,%esp
+  8008db:	85 c0                	test   %eax,%eax
+  8008dd:	78 1a                	js     8008f9 <fd_close+0x77>
+		if (dev->dev_close)
+  8008df:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008e2:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8008e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8008ea:	85 c0                	test   %eax,%eax
+  8008ec:	74 0b                	je     8008f9 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8008ee:	83 ec 0c             	sub    $0xc,%esp
+  8008f1:	56                   	push   %esi
+  8008f2:	ff d0                	call   *%eax
+  8008f4:	89 c3                	mov    %eax,%ebx
+  8008f6:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8008f9:	83 ec 08             	sub    $0x8,%esp
+  8008fc:	56                   	push   %esi
+  8008fd:	6a 00                	push   $0x0
+  8008ff:	e8 2b f9 ff ff       	call   80022f <sys_page_unmap>
+	return r;
+  800904:	83 c4 10             	add    $0x10,%esp
+  800907:	eb b5                	jmp    8008be <fd_close+0x3c>
+
+00800909 <close>:
+
+int
+close(int fdnum)
+{
+  800909:	55                   	push   %ebp
+  80090a:	89 e5                	mov    %esp,%ebp
+  80090c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80090f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800912:	50                   	push   %eax
+  800913:	ff 75 08             	push   0x8(%ebp)
+  800916:	e8 cb fe ff ff       	call   8007e6 <fd_lookup>
+  80091b:	83 c4 10             	add    $0x10,%esp
+  80091e:	85 c0                	test   %eax,%eax
+  800920:	79 02                	jns    800924 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800922:	c9                   	leave
+  800923:	c3                   	ret
+		return fd_close(fd, 1);
+  800924:	83 ec 08             	sub    $0x8,%esp
+  800927:	6a 01                	push   $0x1
+  800929:	ff 75 f4             	push   -0xc(%ebp)
+  80092c:	e8 51 ff ff ff       	call   800882 <fd_close>
+  800931:	83 c4 10             	add    $0x10,%esp
+  800934:	eb ec                	jmp    800922 <close+0x19>
+
+00800936 <close_all>:
+
+void
+close_all(void)
+{
+  800936:	55                   	push   %ebp
+  800937:	89 e5                	mov    %esp,%ebp
+  800939:	53                   	push   %ebx
+  80093a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80093d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800942:	83 ec 0c             	sub    $0xc,%esp
+  800945:	53                   	push   %ebx
+  800946:	e8 be ff ff ff       	call   800909 <close>
+	for (i = 0; i < MAXFD; i++)
+  80094b:	83 c3 01             	add    $0x1,%ebx
+  80094e:	83 c4 10             	add    $0x10,%esp
+  800951:	83 fb 20             	cmp    $0x20,%ebx
+  800954:	75 ec                	jne    800942 <close_all+0xc>
+}
+  800956:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800959:	c9                   	leave
+  80095a:	c3                   	ret
+
+0080095b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80095b:	55                   	push   %ebp
+  80095c:	89 e5                	mov    %esp,%ebp
+  80095e:	57                   	push   %edi
+  80095f:	56                   	push   %esi
+  800960:	53                   	push   %ebx
+  800961:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800964:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800967:	50                   	push   %eax
+  800968:	ff 75 08             	push   0x8(%ebp)
+  80096b:	e8 76 fe ff ff       	call   8007e6 <fd_lookup>
+  800970:	89 c3                	mov    %eax,%ebx
+  800972:	83 c4 10             	add    $0x10,%esp
+  800975:	85 c0                	test   %eax,%eax
+  800977:	78 7f                	js     8009f8 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800979:	83 ec 0c             	sub    $0xc,%esp
+  80097c:	ff 75 0c             	push   0xc(%ebp)
+  80097f:	e8 85 ff ff ff       	call   800909 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800984:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800987:	c1 e6 0c             	shl    $0xc,%esi
+  80098a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800990:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800993:	89 3c 24             	mov    %edi,(%esp)
+  800996:	e8 e0 fd ff ff       	call   80077b <fd2data>
+  80099b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80099d:	89 34 24             	mov    %esi,(%esp)
+  8009a0:	e8 d6 fd ff ff       	call   80077b <fd2data>
+  8009a5:	83 c4 10             	add    $0x10,%esp
+  8009a8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8009ab:	89 d8                	mov    %ebx,%eax
+  8009ad:	c1 e8 16             	shr    $0x16,%eax
+  8009b0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8009b7:	a8 01                	test   $0x1,%al
+  8009b9:	74 11                	je     8009cc <dup+0x71>
+  8009bb:	89 d8                	mov    %ebx,%eax
+  8009bd:	c1 e8 0c             	shr    $0xc,%eax
+  8009c0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8009c7:	f6 c2 01             	test   $0x1,%dl
+  8009ca:	75 36                	jne    800a02 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8009cc:	89 f8                	mov    %edi,%eax
+  8009ce:	c1 e8 0c             	shr    $0xc,%eax
+  8009d1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8009d8:	83 ec 0c             	sub    $0xc,%esp
+  8009db:	25 07 0e 00 00       	and    $0xe07,%eax
+  8009e0:	50                   	push   %eax
+  8009e1:	56                   	push   %esi
+  8009e2:	6a 00                	push   $0x0
+  8009e4:	57                   	push   %edi
+  8009e5:	6a 00                	push   $0x0
+  8009e7:	e8 01 f8 ff ff       	call   8001ed <sys_page_map>
+  8009ec:	89 c3                	mov    %eax,%ebx
+  8009ee:	83 c4 20             	add    $0x20,%esp
+  8009f1:	85 c0                	test   %eax,%eax
+  8009f3:	78 33                	js     800a28 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8009f5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8009f8:	89 d8                	mov    %ebx,%eax
+  8009fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009fd:	5b                   	pop    %ebx
+  8009fe:	5e                   	pop    %esi
+  8009ff:	5f                   	pop    %edi
+  800a00:	5d                   	pop    %ebp
+  800a01:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800a02:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800a09:	83 ec 0c             	sub    $0xc,%esp
+  800a0c:	25 07 0e 00 00       	and    $0xe07,%eax
+  800a11:	50                   	push   %eax
+  800a12:	ff 75 d4             	push   -0x2c(%ebp)
+  800a15:	6a 00                	push   $0x0
+  800a17:	53                   	push   %ebx
+  800a18:	6a 00                	push   $0x0
+  800a1a:	e8 ce f7 ff ff       	call   8001ed <sys_page_map>
+  800a1f:	89 c3                	mov    %eax,%ebx
+  800a21:	83 c4 20             	add    $0x20,%esp
+  800a24:	85 c0                	test   %eax,%eax
+  800a26:	79 a4                	jns    8009cc <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800a28:	83 ec 08             	sub    $0x8,%esp
+  800a2b:	56                   	push   %esi
+  800a2c:	6a 00                	push   $0x0
+  800a2e:	e8 fc f7 ff ff       	call   80022f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800a33:	83 c4 08             	add    $0x8,%esp
+  800a36:	ff 75 d4             	push   -0x2c(%ebp)
+  800a39:	6a 00                	push   $0x0
+  800a3b:	e8 ef f7 ff ff       	call   80022f <sys_page_unmap>
+	return r;
+  800a40:	83 c4 10             	add    $0x10,%esp
+  800a43:	eb b3                	jmp    8009f8 <dup+0x9d>
+
+00800a45 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800a45:	55                   	push   %ebp
+  800a46:	89 e5                	mov    %esp,%ebp
+  800a48:	56                   	push   %esi
+  800a49:	53                   	push   %ebx
+  800a4a:	83 ec 18             	sub    $0x18,%esp
+  800a4d:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a50:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a53:	50                   	push   %eax
+  800a54:	56                   	push   %esi
+  800a55:	e8 8c fd ff ff       	call   8007e6 <fd_lookup>
+  800a5a:	83 c4 10             	add    $0x10,%esp
+  800a5d:	85 c0                	test   %eax,%eax
+  800a5f:	78 3c                	js     800a9d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a61:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a64:	83 ec 08             	sub    $0x8,%esp
+  800a67:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a6a:	50                   	push   %eax
+  800a6b:	ff 33                	push   (%ebx)
+  800a6d:	e8 c4 fd ff ff       	call   800836 <dev_lookup>
+  800a72:	83 c4 10             	add    $0x10,%esp
+  800a75:	85 c0                	test   %eax,%eax
+  800a77:	78 24                	js     800a9d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a79:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a7c:	83 e0 03             	and    $0x3,%eax
+  800a7f:	83 f8 01             	cmp    $0x1,%eax
+  800a82:	74 20                	je     800aa4 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800a84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a87:	8b 40 08             	mov    0x8(%eax),%eax
+  800a8a:	85 c0                	test   %eax,%eax
+  800a8c:	74 37                	je     800ac5 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800a8e:	83 ec 04             	sub    $0x4,%esp
+  800a91:	ff 75 10             	push   0x10(%ebp)
+  800a94:	ff 75 0c             	push   0xc(%ebp)
+  800a97:	53                   	push   %ebx
+  800a98:	ff d0                	call   *%eax
+  800a9a:	83 c4 10             	add    $0x10,%esp
+}
+  800a9d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800aa0:	5b                   	pop    %ebx
+  800aa1:	5e                   	pop    %esi
+  800aa2:	5d                   	pop    %ebp
+  800aa3:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800aa4:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  800aa9:	8b 40 48             	mov    0x48(%eax),%eax
+  800aac:	83 ec 04             	sub    $0x4,%esp
+  800aaf:	56                   	push   %esi
+  800ab0:	50                   	push   %eax
+  800ab1:	68 39 28 80 00       	push   $0x802839
+  800ab6:	e8 6b 0d 00 00       	call   801826 <cprintf>
+		return -E_INVAL;
+  800abb:	83 c4 10             	add    $0x10,%esp
+  800abe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ac3:	eb d8                	jmp    800a9d <read+0x58>
+		return -E_NOT_SUPP;
+  800ac5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800aca:	eb d1                	jmp    800a9d <read+0x58>
+
+00800acc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800acc:	55                   	push   %ebp
+  800acd:	89 e5                	mov    %esp,%ebp
+  800acf:	57                   	push   %edi
+  800ad0:	56                   	push   %esi
+  800ad1:	53                   	push   %ebx
+  800ad2:	83 ec 0c             	sub    $0xc,%esp
+  800ad5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ad8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800adb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ae0:	eb 02                	jmp    800ae4 <readn+0x18>
+  800ae2:	01 c3                	add    %eax,%ebx
+  800ae4:	39 f3                	cmp    %esi,%ebx
+  800ae6:	73 21                	jae    800b09 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800ae8:	83 ec 04             	sub    $0x4,%esp
+  800aeb:	89 f0                	mov    %esi,%eax
+  800aed:	29 d8                	sub    %ebx,%eax
+  800aef:	50                   	push   %eax
+  800af0:	89 d8                	mov    %ebx,%eax
+  800af2:	03 45 0c             	add    0xc(%ebp),%eax
+  800af5:	50                   	push   %eax
+  800af6:	57                   	push   %edi
+  800af7:	e8 49 ff ff ff       	call   800a45 <read>
+		if (m < 0)
+  800afc:	83 c4 10             	add    $0x10,%esp
+  800aff:	85 c0                	test   %eax,%eax
+  800b01:	78 04                	js     800b07 <readn+0x3b>
+			return m;
+		if (m == 0)
+  800b03:	75 dd                	jne    800ae2 <readn+0x16>
+  800b05:	eb 02                	jmp    800b09 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800b07:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800b09:	89 d8                	mov    %ebx,%eax
+  800b0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b0e:	5b                   	pop    %ebx
+  800b0f:	5e                   	pop    %esi
+  800b10:	5f                   	pop    %edi
+  800b11:	5d                   	pop    %ebp
+  800b12:	c3                   	ret
+
+00800b13 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800b13:	55                   	push   %ebp
+  800b14:	89 e5                	mov    %esp,%ebp
+  800b16:	56                   	push   %esi
+  800b17:	53                   	push   %ebx
+  800b18:	83 ec 18             	sub    $0x18,%esp
+  800b1b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b1e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b21:	50                   	push   %eax
+  800b22:	53                   	push   %ebx
+  800b23:	e8 be fc ff ff       	call   8007e6 <fd_lookup>
+  800b28:	83 c4 10             	add    $0x10,%esp
+  800b2b:	85 c0                	test   %eax,%eax
+  800b2d:	78 37                	js     800b66 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b2f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b32:	83 ec 08             	sub    $0x8,%esp
+  800b35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b38:	50                   	push   %eax
+  800b39:	ff 36                	push   (%esi)
+  800b3b:	e8 f6 fc ff ff       	call   800836 <dev_lookup>
+  800b40:	83 c4 10             	add    $0x10,%esp
+  800b43:	85 c0                	test   %eax,%eax
+  800b45:	78 1f                	js     800b66 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b47:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b4b:	74 20                	je     800b6d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800b4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b50:	8b 40 0c             	mov    0xc(%eax),%eax
+  800b53:	85 c0                	test   %eax,%eax
+  800b55:	74 37                	je     800b8e <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800b57:	83 ec 04             	sub    $0x4,%esp
+  800b5a:	ff 75 10             	push   0x10(%ebp)
+  800b5d:	ff 75 0c             	push   0xc(%ebp)
+  800b60:	56                   	push   %esi
+  800b61:	ff d0                	call   *%eax
+  800b63:	83 c4 10             	add    $0x10,%esp
+}
+  800b66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b69:	5b                   	pop    %ebx
+  800b6a:	5e                   	pop    %esi
+  800b6b:	5d                   	pop    %ebp
+  800b6c:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b6d:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  800b72:	8b 40 48             	mov    0x48(%eax),%eax
+  800b75:	83 ec 04             	sub    $0x4,%esp
+  800b78:	53                   	push   %ebx
+  800b79:	50                   	push   %eax
+  800b7a:	68 55 28 80 00       	push   $0x802855
+  800b7f:	e8 a2 0c 00 00       	call   801826 <cprintf>
+		return -E_INVAL;
+  800b84:	83 c4 10             	add    $0x10,%esp
+  800b87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b8c:	eb d8                	jmp    800b66 <write+0x53>
+		return -E_NOT_SUPP;
+  800b8e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b93:	eb d1                	jmp    800b66 <write+0x53>
+
+00800b95 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b95:	55                   	push   %ebp
+  800b96:	89 e5                	mov    %esp,%ebp
+  800b98:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b9b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b9e:	50                   	push   %eax
+  800b9f:	ff 75 08             	push   0x8(%ebp)
+  800ba2:	e8 3f fc ff ff       	call   8007e6 <fd_lookup>
+  800ba7:	83 c4 10             	add    $0x10,%esp
+  800baa:	85 c0                	test   %eax,%eax
+  800bac:	78 0e                	js     800bbc <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800bae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bb1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bb4:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bbc:	c9                   	leave
+  800bbd:	c3                   	ret
+
+00800bbe <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800bbe:	55                   	push   %ebp
+  800bbf:	89 e5                	mov    %esp,%ebp
+  800bc1:	56                   	push   %esi
+  800bc2:	53                   	push   %ebx
+  800bc3:	83 ec 18             	sub    $0x18,%esp
+  800bc6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800bc9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800bcc:	50                   	push   %eax
+  800bcd:	53                   	push   %ebx
+  800bce:	e8 13 fc ff ff       	call   8007e6 <fd_lookup>
+  800bd3:	83 c4 10             	add    $0x10,%esp
+  800bd6:	85 c0                	test   %eax,%eax
+  800bd8:	78 34                	js     800c0e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800bda:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800bdd:	83 ec 08             	sub    $0x8,%esp
+  800be0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800be3:	50                   	push   %eax
+  800be4:	ff 36                	push   (%esi)
+  800be6:	e8 4b fc ff ff       	call   800836 <dev_lookup>
+  800beb:	83 c4 10             	add    $0x10,%esp
+  800bee:	85 c0                	test   %eax,%eax
+  800bf0:	78 1c                	js     800c0e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bf2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800bf6:	74 1d                	je     800c15 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800bf8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bfb:	8b 40 18             	mov    0x18(%eax),%eax
+  800bfe:	85 c0                	test   %eax,%eax
+  800c00:	74 34                	je     800c36 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800c02:	83 ec 08             	sub    $0x8,%esp
+  800c05:	ff 75 0c             	push   0xc(%ebp)
+  800c08:	56                   	push   %esi
+  800c09:	ff d0                	call   *%eax
+  800c0b:	83 c4 10             	add    $0x10,%esp
+}
+  800c0e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c11:	5b                   	pop    %ebx
+  800c12:	5e                   	pop    %esi
+  800c13:	5d                   	pop    %ebp
+  800c14:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800c15:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  800c1a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800c1d:	83 ec 04             	sub    $0x4,%esp
+  800c20:	53                   	push   %ebx
+  800c21:	50                   	push   %eax
+  800c22:	68 18 28 80 00       	push   $0x802818
+  800c27:	e8 fa 0b 00 00       	call   801826 <cprintf>
+		return -E_INVAL;
+  800c2c:	83 c4 10             	add    $0x10,%esp
+  800c2f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c34:	eb d8                	jmp    800c0e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800c36:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c3b:	eb d1                	jmp    800c0e <ftruncate+0x50>
+
+00800c3d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800c3d:	55                   	push   %ebp
+  800c3e:	89 e5                	mov    %esp,%ebp
+  800c40:	56                   	push   %esi
+  800c41:	53                   	push   %ebx
+  800c42:	83 ec 18             	sub    $0x18,%esp
+  800c45:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c48:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c4b:	50                   	push   %eax
+  800c4c:	ff 75 08             	push   0x8(%ebp)
+  800c4f:	e8 92 fb ff ff       	call   8007e6 <fd_lookup>
+  800c54:	83 c4 10             	add    $0x10,%esp
+  800c57:	85 c0                	test   %eax,%eax
+  800c59:	78 49                	js     800ca4 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c5b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c5e:	83 ec 08             	sub    $0x8,%esp
+  800c61:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c64:	50                   	push   %eax
+  800c65:	ff 36                	push   (%esi)
+  800c67:	e8 ca fb ff ff       	call   800836 <dev_lookup>
+  800c6c:	83 c4 10             	add    $0x10,%esp
+  800c6f:	85 c0                	test   %eax,%eax
+  800c71:	78 31                	js     800ca4 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c76:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c7a:	74 2f                	je     800cab <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c7c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c7f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c86:	00 00 00 
+	stat->st_isdir = 0;
+  800c89:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c90:	00 00 00 
+	stat->st_dev = dev;
+  800c93:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c99:	83 ec 08             	sub    $0x8,%esp
+  800c9c:	53                   	push   %ebx
+  800c9d:	56                   	push   %esi
+  800c9e:	ff 50 14             	call   *0x14(%eax)
+  800ca1:	83 c4 10             	add    $0x10,%esp
+}
+  800ca4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ca7:	5b                   	pop    %ebx
+  800ca8:	5e                   	pop    %esi
+  800ca9:	5d                   	pop    %ebp
+  800caa:	c3                   	ret
+		return -E_NOT_SUPP;
+  800cab:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800cb0:	eb f2                	jmp    800ca4 <fstat+0x67>
+
+00800cb2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800cb2:	55                   	push   %ebp
+  800cb3:	89 e5                	mov    %esp,%ebp
+  800cb5:	56                   	push   %esi
+  800cb6:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800cb7:	83 ec 08             	sub    $0x8,%esp
+  800cba:	6a 00                	push   $0x0
+  800cbc:	ff 75 08             	push   0x8(%ebp)
+  800cbf:	e8 bc 02 00 00       	call   800f80 <open>
+  800cc4:	89 c3                	mov    %eax,%ebx
+  800cc6:	83 c4 10             	add    $0x10,%esp
+  800cc9:	85 c0                	test   %eax,%eax
+  800ccb:	78 1b                	js     800ce8 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800ccd:	83 ec 08             	sub    $0x8,%esp
+  800cd0:	ff 75 0c             	push   0xc(%ebp)
+  800cd3:	50                   	push   %eax
+  800cd4:	e8 64 ff ff ff       	call   800c3d <fstat>
+  800cd9:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800cdb:	89 1c 24             	mov    %ebx,(%esp)
+  800cde:	e8 26 fc ff ff       	call   800909 <close>
+	return r;
+  800ce3:	83 c4 10             	add    $0x10,%esp
+  800ce6:	89 f3                	mov    %esi,%ebx
+}
+  800ce8:	89 d8                	mov    %ebx,%eax
+  800cea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ced:	5b                   	pop    %ebx
+  800cee:	5e                   	pop    %esi
+  800cef:	5d                   	pop    %ebp
+  800cf0:	c3                   	ret
+
+00800cf1 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  800cf1:	55                   	push   %ebp
+  800cf2:	89 e5                	mov    %esp,%ebp
+  800cf4:	57                   	push   %edi
+  800cf5:	56                   	push   %esi
+  800cf6:	53                   	push   %ebx
+  800cf7:	83 ec 0c             	sub    $0xc,%esp
+  800cfa:	89 c7                	mov    %eax,%edi
+  800cfc:	89 d3                	mov    %edx,%ebx
+  800cfe:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800d00:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800d07:	74 2d                	je     800d36 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800d09:	6a 07                	push   $0x7
+  800d0b:	68 00 50 80 00       	push   $0x805000
+  800d10:	57                   	push   %edi
+  800d11:	ff 35 00 40 80 00    	push   0x804000
+  800d17:	e8 33 17 00 00       	call   80244f <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  800d1c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800d23:	6a 00                	push   $0x0
+  800d25:	56                   	push   %esi
+  800d26:	53                   	push   %ebx
+  800d27:	6a 00                	push   $0x0
+  800d29:	e8 d3 15 00 00       	call   802301 <ipc_recv_pages>
+}
+  800d2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d31:	5b                   	pop    %ebx
+  800d32:	5e                   	pop    %esi
+  800d33:	5f                   	pop    %edi
+  800d34:	5d                   	pop    %ebp
+  800d35:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800d36:	83 ec 0c             	sub    $0xc,%esp
+  800d39:	6a 01                	push   $0x1
+  800d3b:	e8 04 18 00 00       	call   802544 <ipc_find_env>
+  800d40:	a3 00 40 80 00       	mov    %eax,0x804000
+  800d45:	83 c4 10             	add    $0x10,%esp
+  800d48:	eb bf                	jmp    800d09 <fsipc_pages+0x18>
+
+00800d4a <fsipc>:
+{
+  800d4a:	55                   	push   %ebp
+  800d4b:	89 e5                	mov    %esp,%ebp
+  800d4d:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  800d50:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d55:	e8 97 ff ff ff       	call   800cf1 <fsipc_pages>
+}
+  800d5a:	c9                   	leave
+  800d5b:	c3                   	ret
+
+00800d5c <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d5c:	55                   	push   %ebp
+  800d5d:	89 e5                	mov    %esp,%ebp
+  800d5f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d62:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d65:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d68:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800d6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d70:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800d75:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d7f:	e8 c6 ff ff ff       	call   800d4a <fsipc>
+}
+  800d84:	c9                   	leave
+  800d85:	c3                   	ret
+
+00800d86 <devfile_flush>:
+{
+  800d86:	55                   	push   %ebp
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d8f:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d92:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800d97:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800da1:	e8 a4 ff ff ff       	call   800d4a <fsipc>
+}
+  800da6:	c9                   	leave
+  800da7:	c3                   	ret
+
+00800da8 <devfile_stat>:
+{
+  800da8:	55                   	push   %ebp
+  800da9:	89 e5                	mov    %esp,%ebp
+  800dab:	53                   	push   %ebx
+  800dac:	83 ec 04             	sub    $0x4,%esp
+  800daf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800db2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db5:	8b 40 0c             	mov    0xc(%eax),%eax
+  800db8:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800dbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc2:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dc7:	e8 7e ff ff ff       	call   800d4a <fsipc>
+  800dcc:	85 c0                	test   %eax,%eax
+  800dce:	78 2c                	js     800dfc <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800dd0:	83 ec 08             	sub    $0x8,%esp
+  800dd3:	68 00 50 80 00       	push   $0x805000
+  800dd8:	53                   	push   %ebx
+  800dd9:	e8 2f 10 00 00       	call   801e0d <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800dde:	a1 80 50 80 00       	mov    0x805080,%eax
+  800de3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800de9:	a1 84 50 80 00       	mov    0x805084,%eax
+  800dee:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800df4:	83 c4 10             	add    $0x10,%esp
+  800df7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dfc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dff:	c9                   	leave
+  800e00:	c3                   	ret
+
+00800e01 <devfile_write>:
+{
+  800e01:	55                   	push   %ebp
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	83 ec 0c             	sub    $0xc,%esp
+  800e07:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800e0a:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800e0f:	39 d0                	cmp    %edx,%eax
+  800e11:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e17:	8b 52 0c             	mov    0xc(%edx),%edx
+  800e1a:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  800e20:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800e25:	50                   	push   %eax
+  800e26:	ff 75 0c             	push   0xc(%ebp)
+  800e29:	68 08 50 80 00       	push   $0x805008
+  800e2e:	e8 60 11 00 00       	call   801f93 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800e33:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e38:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e3d:	e8 08 ff ff ff       	call   800d4a <fsipc>
+}
+  800e42:	c9                   	leave
+  800e43:	c3                   	ret
+
+00800e44 <devfile_read>:
+{
+  800e44:	55                   	push   %ebp
+  800e45:	89 e5                	mov    %esp,%ebp
+  800e47:	57                   	push   %edi
+  800e48:	56                   	push   %esi
+  800e49:	53                   	push   %ebx
+  800e4a:	83 ec 1c             	sub    $0x1c,%esp
+  800e4d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e50:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e53:	89 fe                	mov    %edi,%esi
+  800e55:	c1 ee 0c             	shr    $0xc,%esi
+  800e58:	b8 20 00 00 00       	mov    $0x20,%eax
+  800e5d:	39 c6                	cmp    %eax,%esi
+  800e5f:	0f 47 f0             	cmova  %eax,%esi
+  800e62:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e65:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e6a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  800e6d:	eb 14                	jmp    800e83 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e6f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  800e76:	05 00 10 00 00       	add    $0x1000,%eax
+  800e7b:	f6 c6 06             	test   $0x6,%dh
+  800e7e:	75 42                	jne    800ec2 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e80:	83 c1 01             	add    $0x1,%ecx
+  800e83:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800e86:	39 f1                	cmp    %esi,%ecx
+  800e88:	0f 84 95 00 00 00    	je     800f23 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e8e:	89 c2                	mov    %eax,%edx
+  800e90:	c1 ea 16             	shr    $0x16,%edx
+  800e93:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e9a:	f6 c2 01             	test   $0x1,%dl
+  800e9d:	74 23                	je     800ec2 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e9f:	89 c2                	mov    %eax,%edx
+  800ea1:	c1 ea 0c             	shr    $0xc,%edx
+  800ea4:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800eab:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  800eb1:	74 0f                	je     800ec2 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  800eb3:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800eba:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  800ec0:	75 ad                	jne    800e6f <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  800ec2:	85 c9                	test   %ecx,%ecx
+  800ec4:	74 11                	je     800ed7 <devfile_read+0x93>
+  800ec6:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  800ecd:	75 08                	jne    800ed7 <devfile_read+0x93>
+  800ecf:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  800ed5:	74 50                	je     800f27 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800ed7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800eda:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  800edf:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800ee5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eea:	b8 03 00 00 00       	mov    $0x3,%eax
+  800eef:	e8 56 fe ff ff       	call   800d4a <fsipc>
+  800ef4:	89 c6                	mov    %eax,%esi
+  800ef6:	85 c0                	test   %eax,%eax
+  800ef8:	78 1f                	js     800f19 <devfile_read+0xd5>
+	assert(r <= n);
+  800efa:	39 c7                	cmp    %eax,%edi
+  800efc:	72 50                	jb     800f4e <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  800efe:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800f03:	7f 62                	jg     800f67 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  800f05:	83 ec 04             	sub    $0x4,%esp
+  800f08:	50                   	push   %eax
+  800f09:	68 00 50 80 00       	push   $0x805000
+  800f0e:	ff 75 0c             	push   0xc(%ebp)
+  800f11:	e8 7d 10 00 00       	call   801f93 <memmove>
+	return r;
+  800f16:	83 c4 10             	add    $0x10,%esp
+}
+  800f19:	89 f0                	mov    %esi,%eax
+  800f1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1e:	5b                   	pop    %ebx
+  800f1f:	5e                   	pop    %esi
+  800f20:	5f                   	pop    %edi
+  800f21:	5d                   	pop    %ebp
+  800f22:	c3                   	ret
+  800f23:	89 f1                	mov    %esi,%ecx
+  800f25:	eb 9b                	jmp    800ec2 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  800f27:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f2a:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  800f2f:	89 c8                	mov    %ecx,%eax
+  800f31:	c1 e0 0c             	shl    $0xc,%eax
+  800f34:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  800f39:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f3c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f41:	e8 ab fd ff ff       	call   800cf1 <fsipc_pages>
+  800f46:	89 c6                	mov    %eax,%esi
+  800f48:	85 c0                	test   %eax,%eax
+  800f4a:	78 8b                	js     800ed7 <devfile_read+0x93>
+  800f4c:	eb cb                	jmp    800f19 <devfile_read+0xd5>
+	assert(r <= n);
+  800f4e:	68 84 28 80 00       	push   $0x802884
+  800f53:	68 8b 28 80 00       	push   $0x80288b
+  800f58:	68 a0 00 00 00       	push   $0xa0
+  800f5d:	68 a0 28 80 00       	push   $0x8028a0
+  800f62:	e8 e4 07 00 00       	call   80174b <_panic>
+	assert(r <= PGSIZE);
+  800f67:	68 ab 28 80 00       	push   $0x8028ab
+  800f6c:	68 8b 28 80 00       	push   $0x80288b
+  800f71:	68 a1 00 00 00       	push   $0xa1
+  800f76:	68 a0 28 80 00       	push   $0x8028a0
+  800f7b:	e8 cb 07 00 00       	call   80174b <_panic>
+
+00800f80 <open>:
+{
+  800f80:	55                   	push   %ebp
+  800f81:	89 e5                	mov    %esp,%ebp
+  800f83:	56                   	push   %esi
+  800f84:	53                   	push   %ebx
+  800f85:	83 ec 1c             	sub    $0x1c,%esp
+  800f88:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800f8b:	56                   	push   %esi
+  800f8c:	e8 41 0e 00 00       	call   801dd2 <strlen>
+  800f91:	83 c4 10             	add    $0x10,%esp
+  800f94:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f99:	7f 6c                	jg     801007 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800f9b:	83 ec 0c             	sub    $0xc,%esp
+  800f9e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800fa1:	50                   	push   %eax
+  800fa2:	e8 eb f7 ff ff       	call   800792 <fd_alloc>
+  800fa7:	89 c3                	mov    %eax,%ebx
+  800fa9:	83 c4 10             	add    $0x10,%esp
+  800fac:	85 c0                	test   %eax,%eax
+  800fae:	78 3c                	js     800fec <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800fb0:	83 ec 08             	sub    $0x8,%esp
+  800fb3:	56                   	push   %esi
+  800fb4:	68 00 50 80 00       	push   $0x805000
+  800fb9:	e8 4f 0e 00 00       	call   801e0d <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800fbe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800fc1:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800fc6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800fc9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fce:	e8 77 fd ff ff       	call   800d4a <fsipc>
+  800fd3:	89 c3                	mov    %eax,%ebx
+  800fd5:	83 c4 10             	add    $0x10,%esp
+  800fd8:	85 c0                	test   %eax,%eax
+  800fda:	78 19                	js     800ff5 <open+0x75>
+	return fd2num(fd);
+  800fdc:	83 ec 0c             	sub    $0xc,%esp
+  800fdf:	ff 75 f4             	push   -0xc(%ebp)
+  800fe2:	e8 84 f7 ff ff       	call   80076b <fd2num>
+  800fe7:	89 c3                	mov    %eax,%ebx
+  800fe9:	83 c4 10             	add    $0x10,%esp
+}
+  800fec:	89 d8                	mov    %ebx,%eax
+  800fee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ff1:	5b                   	pop    %ebx
+  800ff2:	5e                   	pop    %esi
+  800ff3:	5d                   	pop    %ebp
+  800ff4:	c3                   	ret
+		fd_close(fd, 0);
+  800ff5:	83 ec 08             	sub    $0x8,%esp
+  800ff8:	6a 00                	push   $0x0
+  800ffa:	ff 75 f4             	push   -0xc(%ebp)
+  800ffd:	e8 80 f8 ff ff       	call   800882 <fd_close>
+		return r;
+  801002:	83 c4 10             	add    $0x10,%esp
+  801005:	eb e5                	jmp    800fec <open+0x6c>
+		return -E_BAD_PATH;
+  801007:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80100c:	eb de                	jmp    800fec <open+0x6c>
+
+0080100e <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80100e:	55                   	push   %ebp
+  80100f:	89 e5                	mov    %esp,%ebp
+  801011:	53                   	push   %ebx
+  801012:	83 ec 10             	sub    $0x10,%esp
+  801015:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801018:	53                   	push   %ebx
+  801019:	e8 b4 0d 00 00       	call   801dd2 <strlen>
+  80101e:	83 c4 10             	add    $0x10,%esp
+  801021:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801026:	7f 25                	jg     80104d <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801028:	83 ec 08             	sub    $0x8,%esp
+  80102b:	53                   	push   %ebx
+  80102c:	68 00 50 80 00       	push   $0x805000
+  801031:	e8 d7 0d 00 00       	call   801e0d <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801036:	ba 00 00 00 00       	mov    $0x0,%edx
+  80103b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801040:	e8 05 fd ff ff       	call   800d4a <fsipc>
+  801045:	83 c4 10             	add    $0x10,%esp
+}
+  801048:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80104b:	c9                   	leave
+  80104c:	c3                   	ret
+		return -E_BAD_PATH;
+  80104d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801052:	eb f4                	jmp    801048 <remove+0x3a>
+
+00801054 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801054:	55                   	push   %ebp
+  801055:	89 e5                	mov    %esp,%ebp
+  801057:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80105a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80105f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801064:	e8 e1 fc ff ff       	call   800d4a <fsipc>
+}
+  801069:	c9                   	leave
+  80106a:	c3                   	ret
+
+0080106b <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  80106b:	55                   	push   %ebp
+  80106c:	89 e5                	mov    %esp,%ebp
+  80106e:	53                   	push   %ebx
+  80106f:	83 ec 04             	sub    $0x4,%esp
+  801072:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801075:	ba 00 00 00 00       	mov    $0x0,%edx
+  80107a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80107f:	e8 c6 fc ff ff       	call   800d4a <fsipc>
+  801084:	85 c0                	test   %eax,%eax
+  801086:	78 3c                	js     8010c4 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801088:	a1 00 50 80 00       	mov    0x805000,%eax
+  80108d:	89 03                	mov    %eax,(%ebx)
+  80108f:	a1 04 50 80 00       	mov    0x805004,%eax
+  801094:	89 43 04             	mov    %eax,0x4(%ebx)
+  801097:	a1 08 50 80 00       	mov    0x805008,%eax
+  80109c:	89 43 08             	mov    %eax,0x8(%ebx)
+  80109f:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  8010a4:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8010a7:	a1 10 50 80 00       	mov    0x805010,%eax
+  8010ac:	89 43 10             	mov    %eax,0x10(%ebx)
+  8010af:	a1 14 50 80 00       	mov    0x805014,%eax
+  8010b4:	89 43 14             	mov    %eax,0x14(%ebx)
+  8010b7:	a1 18 50 80 00       	mov    0x805018,%eax
+  8010bc:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  8010bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010c7:	c9                   	leave
+  8010c8:	c3                   	ret
+
+008010c9 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  8010c9:	55                   	push   %ebp
+  8010ca:	89 e5                	mov    %esp,%ebp
+  8010cc:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  8010cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010d2:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  8010d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010dc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010e1:	e8 64 fc ff ff       	call   800d4a <fsipc>
+}
+  8010e6:	c9                   	leave
+  8010e7:	c3                   	ret
+
+008010e8 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8010e8:	55                   	push   %ebp
+  8010e9:	89 e5                	mov    %esp,%ebp
+  8010eb:	56                   	push   %esi
+  8010ec:	53                   	push   %ebx
+  8010ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8010f0:	83 ec 0c             	sub    $0xc,%esp
+  8010f3:	ff 75 08             	push   0x8(%ebp)
+  8010f6:	e8 80 f6 ff ff       	call   80077b <fd2data>
+  8010fb:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8010fd:	83 c4 08             	add    $0x8,%esp
+  801100:	68 b7 28 80 00       	push   $0x8028b7
+  801105:	53                   	push   %ebx
+  801106:	e8 02 0d 00 00       	call   801e0d <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80110b:	8b 46 04             	mov    0x4(%esi),%eax
+  80110e:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801114:	2b 0e                	sub    (%esi),%ecx
+  801116:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80111b:	89 c8                	mov    %ecx,%eax
+  80111d:	f7 e2                	mul    %edx
+  80111f:	c1 ea 0c             	shr    $0xc,%edx
+  801122:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801128:	29 d1                	sub    %edx,%ecx
+  80112a:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801130:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801137:	00 00 00 
+	stat->st_dev = &devpipe;
+  80113a:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  801141:	30 80 00 
+	return 0;
+}
+  801144:	b8 00 00 00 00       	mov    $0x0,%eax
+  801149:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80114c:	5b                   	pop    %ebx
+  80114d:	5e                   	pop    %esi
+  80114e:	5d                   	pop    %ebp
+  80114f:	c3                   	ret
+
+00801150 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801150:	55                   	push   %ebp
+  801151:	89 e5                	mov    %esp,%ebp
+  801153:	53                   	push   %ebx
+  801154:	83 ec 0c             	sub    $0xc,%esp
+  801157:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80115a:	53                   	push   %ebx
+  80115b:	6a 00                	push   $0x0
+  80115d:	e8 cd f0 ff ff       	call   80022f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801162:	89 1c 24             	mov    %ebx,(%esp)
+  801165:	e8 11 f6 ff ff       	call   80077b <fd2data>
+  80116a:	83 c4 08             	add    $0x8,%esp
+  80116d:	50                   	push   %eax
+  80116e:	6a 00                	push   $0x0
+  801170:	e8 ba f0 ff ff       	call   80022f <sys_page_unmap>
+}
+  801175:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801178:	c9                   	leave
+  801179:	c3                   	ret
+
+0080117a <_pipeisclosed>:
+{
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	57                   	push   %edi
+  80117e:	56                   	push   %esi
+  80117f:	53                   	push   %ebx
+  801180:	83 ec 1c             	sub    $0x1c,%esp
+  801183:	89 c7                	mov    %eax,%edi
+  801185:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801187:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80118c:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80118f:	83 ec 0c             	sub    $0xc,%esp
+  801192:	57                   	push   %edi
+  801193:	e8 eb 13 00 00       	call   802583 <pageref>
+  801198:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80119b:	89 34 24             	mov    %esi,(%esp)
+  80119e:	e8 e0 13 00 00       	call   802583 <pageref>
+		nn = thisenv->env_runs;
+  8011a3:	8b 15 0c 40 80 00    	mov    0x80400c,%edx
+  8011a9:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8011ac:	83 c4 10             	add    $0x10,%esp
+  8011af:	39 cb                	cmp    %ecx,%ebx
+  8011b1:	74 1b                	je     8011ce <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8011b3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8011b6:	75 cf                	jne    801187 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8011b8:	8b 42 58             	mov    0x58(%edx),%eax
+  8011bb:	6a 01                	push   $0x1
+  8011bd:	50                   	push   %eax
+  8011be:	53                   	push   %ebx
+  8011bf:	68 be 28 80 00       	push   $0x8028be
+  8011c4:	e8 5d 06 00 00       	call   801826 <cprintf>
+  8011c9:	83 c4 10             	add    $0x10,%esp
+  8011cc:	eb b9                	jmp    801187 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8011ce:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8011d1:	0f 94 c0             	sete   %al
+  8011d4:	0f b6 c0             	movzbl %al,%eax
+}
+  8011d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011da:	5b                   	pop    %ebx
+  8011db:	5e                   	pop    %esi
+  8011dc:	5f                   	pop    %edi
+  8011dd:	5d                   	pop    %ebp
+  8011de:	c3                   	ret
+
+008011df <devpipe_read>:
+{
+  8011df:	55                   	push   %ebp
+  8011e0:	89 e5                	mov    %esp,%ebp
+  8011e2:	57                   	push   %edi
+  8011e3:	56                   	push   %esi
+  8011e4:	53                   	push   %ebx
+  8011e5:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8011e8:	ff 75 08             	push   0x8(%ebp)
+  8011eb:	e8 8b f5 ff ff       	call   80077b <fd2data>
+  8011f0:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8011f2:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8011f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8011f8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8011fb:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8011fe:	8b 0b                	mov    (%ebx),%ecx
+  801200:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801206:	29 ce                	sub    %ecx,%esi
+  801208:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80120d:	f7 e6                	mul    %esi
+  80120f:	c1 ea 0c             	shr    $0xc,%edx
+  801212:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801218:	29 c6                	sub    %eax,%esi
+  80121a:	89 f2                	mov    %esi,%edx
+  80121c:	75 43                	jne    801261 <devpipe_read+0x82>
+		ref = pageref(p);
+  80121e:	83 ec 0c             	sub    $0xc,%esp
+  801221:	53                   	push   %ebx
+  801222:	e8 5c 13 00 00       	call   802583 <pageref>
+  801227:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801229:	89 da                	mov    %ebx,%edx
+  80122b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80122e:	e8 47 ff ff ff       	call   80117a <_pipeisclosed>
+  801233:	83 c4 10             	add    $0x10,%esp
+  801236:	85 c0                	test   %eax,%eax
+  801238:	0f 85 c1 00 00 00    	jne    8012ff <devpipe_read+0x120>
+	*sleeping = 1;
+  80123e:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801245:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80124a:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  80124d:	75 ac                	jne    8011fb <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  80124f:	83 ec 04             	sub    $0x4,%esp
+  801252:	56                   	push   %esi
+  801253:	57                   	push   %edi
+  801254:	ff 75 e4             	push   -0x1c(%ebp)
+  801257:	e8 27 f4 ff ff       	call   800683 <sys_futex_wait>
+  80125c:	83 c4 10             	add    $0x10,%esp
+  80125f:	eb 9a                	jmp    8011fb <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801261:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801264:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801268:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80126a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80126f:	f7 e1                	mul    %ecx
+  801271:	c1 ea 0b             	shr    $0xb,%edx
+  801274:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80127a:	29 c1                	sub    %eax,%ecx
+  80127c:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  80127e:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801283:	29 cf                	sub    %ecx,%edi
+  801285:	39 f7                	cmp    %esi,%edi
+  801287:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  80128a:	8d 43 10             	lea    0x10(%ebx),%eax
+  80128d:	83 ec 04             	sub    $0x4,%esp
+  801290:	57                   	push   %edi
+  801291:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801294:	01 c2                	add    %eax,%edx
+  801296:	52                   	push   %edx
+  801297:	ff 75 0c             	push   0xc(%ebp)
+  80129a:	e8 f4 0c 00 00       	call   801f93 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  80129f:	83 c4 0c             	add    $0xc,%esp
+  8012a2:	89 f1                	mov    %esi,%ecx
+  8012a4:	29 f9                	sub    %edi,%ecx
+  8012a6:	51                   	push   %ecx
+  8012a7:	ff 75 e4             	push   -0x1c(%ebp)
+  8012aa:	89 f8                	mov    %edi,%eax
+  8012ac:	03 45 0c             	add    0xc(%ebp),%eax
+  8012af:	50                   	push   %eax
+  8012b0:	e8 de 0c 00 00       	call   801f93 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  8012b5:	89 f1                	mov    %esi,%ecx
+  8012b7:	03 0b                	add    (%ebx),%ecx
+  8012b9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8012be:	f7 e1                	mul    %ecx
+  8012c0:	c1 ea 0c             	shr    $0xc,%edx
+  8012c3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8012c9:	29 d1                	sub    %edx,%ecx
+  8012cb:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  8012cd:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8012d2:	83 c4 10             	add    $0x10,%esp
+  8012d5:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  8012d9:	75 0a                	jne    8012e5 <devpipe_read+0x106>
+	return n;
+  8012db:	89 f0                	mov    %esi,%eax
+}
+  8012dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e0:	5b                   	pop    %ebx
+  8012e1:	5e                   	pop    %esi
+  8012e2:	5f                   	pop    %edi
+  8012e3:	5d                   	pop    %ebp
+  8012e4:	c3                   	ret
+		*sleeping = 0;
+  8012e5:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8012ec:	83 ec 08             	sub    $0x8,%esp
+  8012ef:	68 00 04 00 00       	push   $0x400
+  8012f4:	53                   	push   %ebx
+  8012f5:	e8 d9 f3 ff ff       	call   8006d3 <sys_futex_wake>
+  8012fa:	83 c4 10             	add    $0x10,%esp
+  8012fd:	eb dc                	jmp    8012db <devpipe_read+0xfc>
+			return 0;
+  8012ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801304:	eb d7                	jmp    8012dd <devpipe_read+0xfe>
+
+00801306 <devpipe_write>:
+{
+  801306:	55                   	push   %ebp
+  801307:	89 e5                	mov    %esp,%ebp
+  801309:	57                   	push   %edi
+  80130a:	56                   	push   %esi
+  80130b:	53                   	push   %ebx
+  80130c:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80130f:	ff 75 08             	push   0x8(%ebp)
+  801312:	e8 64 f4 ff ff       	call   80077b <fd2data>
+  801317:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801319:	83 c4 10             	add    $0x10,%esp
+  80131c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801323:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801326:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801329:	0f 83 23 01 00 00    	jae    801452 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80132f:	8b 77 04             	mov    0x4(%edi),%esi
+  801332:	8b 1f                	mov    (%edi),%ebx
+  801334:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  80133a:	29 d9                	sub    %ebx,%ecx
+  80133c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801341:	f7 e1                	mul    %ecx
+  801343:	c1 ea 0c             	shr    $0xc,%edx
+  801346:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80134c:	29 c1                	sub    %eax,%ecx
+  80134e:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801350:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801356:	75 40                	jne    801398 <devpipe_write+0x92>
+			ref = pageref(p);
+  801358:	83 ec 0c             	sub    $0xc,%esp
+  80135b:	57                   	push   %edi
+  80135c:	e8 22 12 00 00       	call   802583 <pageref>
+  801361:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801363:	89 fa                	mov    %edi,%edx
+  801365:	8b 45 08             	mov    0x8(%ebp),%eax
+  801368:	e8 0d fe ff ff       	call   80117a <_pipeisclosed>
+  80136d:	83 c4 10             	add    $0x10,%esp
+  801370:	85 c0                	test   %eax,%eax
+  801372:	0f 85 d5 00 00 00    	jne    80144d <devpipe_write+0x147>
+	*sleeping = 1;
+  801378:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  80137f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801384:	39 1f                	cmp    %ebx,(%edi)
+  801386:	75 a7                	jne    80132f <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801388:	83 ec 04             	sub    $0x4,%esp
+  80138b:	56                   	push   %esi
+  80138c:	53                   	push   %ebx
+  80138d:	57                   	push   %edi
+  80138e:	e8 f0 f2 ff ff       	call   800683 <sys_futex_wait>
+  801393:	83 c4 10             	add    $0x10,%esp
+  801396:	eb 97                	jmp    80132f <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801398:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80139b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80139e:	29 c1                	sub    %eax,%ecx
+  8013a0:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8013a5:	89 d8                	mov    %ebx,%eax
+  8013a7:	29 d0                	sub    %edx,%eax
+  8013a9:	39 c1                	cmp    %eax,%ecx
+  8013ab:	0f 46 c1             	cmovbe %ecx,%eax
+  8013ae:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  8013b0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8013b5:	f7 e6                	mul    %esi
+  8013b7:	c1 ea 0b             	shr    $0xb,%edx
+  8013ba:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8013c0:	29 c6                	sub    %eax,%esi
+  8013c2:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8013c4:	29 f3                	sub    %esi,%ebx
+  8013c6:	39 cb                	cmp    %ecx,%ebx
+  8013c8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8013cb:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  8013ce:	8d 77 10             	lea    0x10(%edi),%esi
+  8013d1:	83 ec 04             	sub    $0x4,%esp
+  8013d4:	53                   	push   %ebx
+  8013d5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8013d8:	03 45 0c             	add    0xc(%ebp),%eax
+  8013db:	50                   	push   %eax
+  8013dc:	01 f2                	add    %esi,%edx
+  8013de:	52                   	push   %edx
+  8013df:	e8 af 0b 00 00       	call   801f93 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8013e4:	83 c4 0c             	add    $0xc,%esp
+  8013e7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013ea:	29 d8                	sub    %ebx,%eax
+  8013ec:	50                   	push   %eax
+  8013ed:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8013f0:	01 d3                	add    %edx,%ebx
+  8013f2:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8013f5:	53                   	push   %ebx
+  8013f6:	56                   	push   %esi
+  8013f7:	e8 97 0b 00 00       	call   801f93 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8013fc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8013ff:	03 4f 04             	add    0x4(%edi),%ecx
+  801402:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801407:	f7 e1                	mul    %ecx
+  801409:	c1 ea 0c             	shr    $0xc,%edx
+  80140c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801412:	29 d1                	sub    %edx,%ecx
+  801414:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  801417:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80141c:	83 c4 10             	add    $0x10,%esp
+  80141f:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  801423:	75 0b                	jne    801430 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  801425:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  801428:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80142b:	e9 f3 fe ff ff       	jmp    801323 <devpipe_write+0x1d>
+		*sleeping = 0;
+  801430:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  801437:	83 ec 08             	sub    $0x8,%esp
+  80143a:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  80143f:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  801442:	50                   	push   %eax
+  801443:	e8 8b f2 ff ff       	call   8006d3 <sys_futex_wake>
+  801448:	83 c4 10             	add    $0x10,%esp
+  80144b:	eb d8                	jmp    801425 <devpipe_write+0x11f>
+				return 0;
+  80144d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801452:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801455:	5b                   	pop    %ebx
+  801456:	5e                   	pop    %esi
+  801457:	5f                   	pop    %edi
+  801458:	5d                   	pop    %ebp
+  801459:	c3                   	ret
+
+0080145a <pipe>:
+{
+  80145a:	55                   	push   %ebp
+  80145b:	89 e5                	mov    %esp,%ebp
+  80145d:	56                   	push   %esi
+  80145e:	53                   	push   %ebx
+  80145f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801462:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801465:	50                   	push   %eax
+  801466:	e8 27 f3 ff ff       	call   800792 <fd_alloc>
+  80146b:	89 c3                	mov    %eax,%ebx
+  80146d:	83 c4 10             	add    $0x10,%esp
+  801470:	85 c0                	test   %eax,%eax
+  801472:	0f 88 23 01 00 00    	js     80159b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801478:	83 ec 04             	sub    $0x4,%esp
+  80147b:	68 07 04 00 00       	push   $0x407
+  801480:	ff 75 f4             	push   -0xc(%ebp)
+  801483:	6a 00                	push   $0x0
+  801485:	e8 20 ed ff ff       	call   8001aa <sys_page_alloc>
+  80148a:	89 c3                	mov    %eax,%ebx
+  80148c:	83 c4 10             	add    $0x10,%esp
+  80148f:	85 c0                	test   %eax,%eax
+  801491:	0f 88 04 01 00 00    	js     80159b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801497:	83 ec 0c             	sub    $0xc,%esp
+  80149a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80149d:	50                   	push   %eax
+  80149e:	e8 ef f2 ff ff       	call   800792 <fd_alloc>
+  8014a3:	89 c3                	mov    %eax,%ebx
+  8014a5:	83 c4 10             	add    $0x10,%esp
+  8014a8:	85 c0                	test   %eax,%eax
+  8014aa:	0f 88 db 00 00 00    	js     80158b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014b0:	83 ec 04             	sub    $0x4,%esp
+  8014b3:	68 07 04 00 00       	push   $0x407
+  8014b8:	ff 75 f0             	push   -0x10(%ebp)
+  8014bb:	6a 00                	push   $0x0
+  8014bd:	e8 e8 ec ff ff       	call   8001aa <sys_page_alloc>
+  8014c2:	89 c3                	mov    %eax,%ebx
+  8014c4:	83 c4 10             	add    $0x10,%esp
+  8014c7:	85 c0                	test   %eax,%eax
+  8014c9:	0f 88 bc 00 00 00    	js     80158b <pipe+0x131>
+	va = fd2data(fd0);
+  8014cf:	83 ec 0c             	sub    $0xc,%esp
+  8014d2:	ff 75 f4             	push   -0xc(%ebp)
+  8014d5:	e8 a1 f2 ff ff       	call   80077b <fd2data>
+  8014da:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014dc:	83 c4 0c             	add    $0xc,%esp
+  8014df:	68 07 04 00 00       	push   $0x407
+  8014e4:	50                   	push   %eax
+  8014e5:	6a 00                	push   $0x0
+  8014e7:	e8 be ec ff ff       	call   8001aa <sys_page_alloc>
+  8014ec:	89 c3                	mov    %eax,%ebx
+  8014ee:	83 c4 10             	add    $0x10,%esp
+  8014f1:	85 c0                	test   %eax,%eax
+  8014f3:	0f 88 82 00 00 00    	js     80157b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014f9:	83 ec 0c             	sub    $0xc,%esp
+  8014fc:	ff 75 f0             	push   -0x10(%ebp)
+  8014ff:	e8 77 f2 ff ff       	call   80077b <fd2data>
+  801504:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80150b:	50                   	push   %eax
+  80150c:	6a 00                	push   $0x0
+  80150e:	56                   	push   %esi
+  80150f:	6a 00                	push   $0x0
+  801511:	e8 d7 ec ff ff       	call   8001ed <sys_page_map>
+  801516:	89 c3                	mov    %eax,%ebx
+  801518:	83 c4 20             	add    $0x20,%esp
+  80151b:	85 c0                	test   %eax,%eax
+  80151d:	78 4e                	js     80156d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80151f:	a1 20 30 80 00       	mov    0x803020,%eax
+  801524:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801527:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801529:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80152c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801533:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801536:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801538:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80153b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801542:	83 ec 0c             	sub    $0xc,%esp
+  801545:	ff 75 f4             	push   -0xc(%ebp)
+  801548:	e8 1e f2 ff ff       	call   80076b <fd2num>
+  80154d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801550:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801552:	83 c4 04             	add    $0x4,%esp
+  801555:	ff 75 f0             	push   -0x10(%ebp)
+  801558:	e8 0e f2 ff ff       	call   80076b <fd2num>
+  80155d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801560:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801563:	83 c4 10             	add    $0x10,%esp
+  801566:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156b:	eb 2e                	jmp    80159b <pipe+0x141>
+	sys_page_unmap(0, va);
+  80156d:	83 ec 08             	sub    $0x8,%esp
+  801570:	56                   	push   %esi
+  801571:	6a 00                	push   $0x0
+  801573:	e8 b7 ec ff ff       	call   80022f <sys_page_unmap>
+  801578:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80157b:	83 ec 08             	sub    $0x8,%esp
+  80157e:	ff 75 f0             	push   -0x10(%ebp)
+  801581:	6a 00                	push   $0x0
+  801583:	e8 a7 ec ff ff       	call   80022f <sys_page_unmap>
+  801588:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80158b:	83 ec 08             	sub    $0x8,%esp
+  80158e:	ff 75 f4             	push   -0xc(%ebp)
+  801591:	6a 00                	push   $0x0
+  801593:	e8 97 ec ff ff       	call   80022f <sys_page_unmap>
+  801598:	83 c4 10             	add    $0x10,%esp
+}
+  80159b:	89 d8                	mov    %ebx,%eax
+  80159d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015a0:	5b                   	pop    %ebx
+  8015a1:	5e                   	pop    %esi
+  8015a2:	5d                   	pop    %ebp
+  8015a3:	c3                   	ret
+
+008015a4 <pipeisclosed>:
+{
+  8015a4:	55                   	push   %ebp
+  8015a5:	89 e5                	mov    %esp,%ebp
+  8015a7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015ad:	50                   	push   %eax
+  8015ae:	ff 75 08             	push   0x8(%ebp)
+  8015b1:	e8 30 f2 ff ff       	call   8007e6 <fd_lookup>
+  8015b6:	83 c4 10             	add    $0x10,%esp
+  8015b9:	85 c0                	test   %eax,%eax
+  8015bb:	78 18                	js     8015d5 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8015bd:	83 ec 0c             	sub    $0xc,%esp
+  8015c0:	ff 75 f4             	push   -0xc(%ebp)
+  8015c3:	e8 b3 f1 ff ff       	call   80077b <fd2data>
+  8015c8:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8015ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015cd:	e8 a8 fb ff ff       	call   80117a <_pipeisclosed>
+  8015d2:	83 c4 10             	add    $0x10,%esp
+}
+  8015d5:	c9                   	leave
+  8015d6:	c3                   	ret
+
+008015d7 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8015d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015dc:	c3                   	ret
+
+008015dd <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015dd:	55                   	push   %ebp
+  8015de:	89 e5                	mov    %esp,%ebp
+  8015e0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8015e3:	68 d6 28 80 00       	push   $0x8028d6
+  8015e8:	ff 75 0c             	push   0xc(%ebp)
+  8015eb:	e8 1d 08 00 00       	call   801e0d <strcpy>
+	return 0;
+}
+  8015f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f5:	c9                   	leave
+  8015f6:	c3                   	ret
+
+008015f7 <devcons_write>:
+{
+  8015f7:	55                   	push   %ebp
+  8015f8:	89 e5                	mov    %esp,%ebp
+  8015fa:	57                   	push   %edi
+  8015fb:	56                   	push   %esi
+  8015fc:	53                   	push   %ebx
+  8015fd:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  801603:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  801608:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80160e:	eb 2e                	jmp    80163e <devcons_write+0x47>
+		m = n - tot;
+  801610:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801613:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  801615:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80161a:	39 c3                	cmp    %eax,%ebx
+  80161c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80161f:	83 ec 04             	sub    $0x4,%esp
+  801622:	53                   	push   %ebx
+  801623:	89 f0                	mov    %esi,%eax
+  801625:	03 45 0c             	add    0xc(%ebp),%eax
+  801628:	50                   	push   %eax
+  801629:	57                   	push   %edi
+  80162a:	e8 64 09 00 00       	call   801f93 <memmove>
+		sys_cputs(buf, m);
+  80162f:	83 c4 08             	add    $0x8,%esp
+  801632:	53                   	push   %ebx
+  801633:	57                   	push   %edi
+  801634:	e8 a4 ea ff ff       	call   8000dd <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  801639:	01 de                	add    %ebx,%esi
+  80163b:	83 c4 10             	add    $0x10,%esp
+  80163e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801641:	72 cd                	jb     801610 <devcons_write+0x19>
+}
+  801643:	89 f0                	mov    %esi,%eax
+  801645:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801648:	5b                   	pop    %ebx
+  801649:	5e                   	pop    %esi
+  80164a:	5f                   	pop    %edi
+  80164b:	5d                   	pop    %ebp
+  80164c:	c3                   	ret
+
+0080164d <devcons_read>:
+{
+  80164d:	55                   	push   %ebp
+  80164e:	89 e5                	mov    %esp,%ebp
+  801650:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801653:	b8 00 00 00 00       	mov    $0x0,%eax
+  801658:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80165c:	75 07                	jne    801665 <devcons_read+0x18>
+  80165e:	eb 1f                	jmp    80167f <devcons_read+0x32>
+		sys_yield();
+  801660:	e8 26 eb ff ff       	call   80018b <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801665:	e8 a2 ea ff ff       	call   80010c <sys_cgetc>
+  80166a:	85 c0                	test   %eax,%eax
+  80166c:	74 f2                	je     801660 <devcons_read+0x13>
+	if (c < 0)
+  80166e:	78 0f                	js     80167f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801670:	83 f8 04             	cmp    $0x4,%eax
+  801673:	74 0c                	je     801681 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801675:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801678:	88 02                	mov    %al,(%edx)
+	return 1;
+  80167a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80167f:	c9                   	leave
+  801680:	c3                   	ret
+		return 0;
+  801681:	b8 00 00 00 00       	mov    $0x0,%eax
+  801686:	eb f7                	jmp    80167f <devcons_read+0x32>
+
+00801688 <cputchar>:
+{
+  801688:	55                   	push   %ebp
+  801689:	89 e5                	mov    %esp,%ebp
+  80168b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80168e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801691:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801694:	6a 01                	push   $0x1
+  801696:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801699:	50                   	push   %eax
+  80169a:	e8 3e ea ff ff       	call   8000dd <sys_cputs>
+}
+  80169f:	83 c4 10             	add    $0x10,%esp
+  8016a2:	c9                   	leave
+  8016a3:	c3                   	ret
+
+008016a4 <getchar>:
+{
+  8016a4:	55                   	push   %ebp
+  8016a5:	89 e5                	mov    %esp,%ebp
+  8016a7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8016aa:	6a 01                	push   $0x1
+  8016ac:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8016af:	50                   	push   %eax
+  8016b0:	6a 00                	push   $0x0
+  8016b2:	e8 8e f3 ff ff       	call   800a45 <read>
+	if (r < 0)
+  8016b7:	83 c4 10             	add    $0x10,%esp
+  8016ba:	85 c0                	test   %eax,%eax
+  8016bc:	78 06                	js     8016c4 <getchar+0x20>
+	if (r < 1)
+  8016be:	74 06                	je     8016c6 <getchar+0x22>
+	return c;
+  8016c0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8016c4:	c9                   	leave
+  8016c5:	c3                   	ret
+		return -E_EOF;
+  8016c6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8016cb:	eb f7                	jmp    8016c4 <getchar+0x20>
+
+008016cd <iscons>:
+{
+  8016cd:	55                   	push   %ebp
+  8016ce:	89 e5                	mov    %esp,%ebp
+  8016d0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d6:	50                   	push   %eax
+  8016d7:	ff 75 08             	push   0x8(%ebp)
+  8016da:	e8 07 f1 ff ff       	call   8007e6 <fd_lookup>
+  8016df:	83 c4 10             	add    $0x10,%esp
+  8016e2:	85 c0                	test   %eax,%eax
+  8016e4:	78 11                	js     8016f7 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8016e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e9:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  8016ef:	39 10                	cmp    %edx,(%eax)
+  8016f1:	0f 94 c0             	sete   %al
+  8016f4:	0f b6 c0             	movzbl %al,%eax
+}
+  8016f7:	c9                   	leave
+  8016f8:	c3                   	ret
+
+008016f9 <opencons>:
+{
+  8016f9:	55                   	push   %ebp
+  8016fa:	89 e5                	mov    %esp,%ebp
+  8016fc:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8016ff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801702:	50                   	push   %eax
+  801703:	e8 8a f0 ff ff       	call   800792 <fd_alloc>
+  801708:	83 c4 10             	add    $0x10,%esp
+  80170b:	85 c0                	test   %eax,%eax
+  80170d:	78 3a                	js     801749 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80170f:	83 ec 04             	sub    $0x4,%esp
+  801712:	68 07 04 00 00       	push   $0x407
+  801717:	ff 75 f4             	push   -0xc(%ebp)
+  80171a:	6a 00                	push   $0x0
+  80171c:	e8 89 ea ff ff       	call   8001aa <sys_page_alloc>
+  801721:	83 c4 10             	add    $0x10,%esp
+  801724:	85 c0                	test   %eax,%eax
+  801726:	78 21                	js     801749 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  801728:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80172b:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  801731:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  801733:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801736:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80173d:	83 ec 0c             	sub    $0xc,%esp
+  801740:	50                   	push   %eax
+  801741:	e8 25 f0 ff ff       	call   80076b <fd2num>
+  801746:	83 c4 10             	add    $0x10,%esp
+}
+  801749:	c9                   	leave
+  80174a:	c3                   	ret
+
+0080174b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80174b:	55                   	push   %ebp
+  80174c:	89 e5                	mov    %esp,%ebp
+  80174e:	56                   	push   %esi
+  80174f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801750:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801753:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801759:	e8 0e ea ff ff       	call   80016c <sys_getenvid>
+  80175e:	83 ec 0c             	sub    $0xc,%esp
+  801761:	ff 75 0c             	push   0xc(%ebp)
+  801764:	ff 75 08             	push   0x8(%ebp)
+  801767:	56                   	push   %esi
+  801768:	50                   	push   %eax
+  801769:	68 e4 28 80 00       	push   $0x8028e4
+  80176e:	e8 b3 00 00 00       	call   801826 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801773:	83 c4 18             	add    $0x18,%esp
+  801776:	53                   	push   %ebx
+  801777:	ff 75 10             	push   0x10(%ebp)
+  80177a:	e8 56 00 00 00       	call   8017d5 <vcprintf>
+	cprintf("\n");
+  80177f:	c7 04 24 cf 28 80 00 	movl   $0x8028cf,(%esp)
+  801786:	e8 9b 00 00 00       	call   801826 <cprintf>
+  80178b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80178e:	cc                   	int3
+	while (1)
+  80178f:	eb fd                	jmp    80178e <_panic+0x43>
+
+00801791 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801791:	55                   	push   %ebp
+  801792:	89 e5                	mov    %esp,%ebp
+  801794:	53                   	push   %ebx
+  801795:	83 ec 04             	sub    $0x4,%esp
+  801798:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80179b:	8b 13                	mov    (%ebx),%edx
+  80179d:	8d 42 01             	lea    0x1(%edx),%eax
+  8017a0:	89 03                	mov    %eax,(%ebx)
+  8017a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8017a5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8017a9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8017ae:	74 09                	je     8017b9 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8017b0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8017b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017b7:	c9                   	leave
+  8017b8:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8017b9:	83 ec 08             	sub    $0x8,%esp
+  8017bc:	68 ff 00 00 00       	push   $0xff
+  8017c1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8017c4:	50                   	push   %eax
+  8017c5:	e8 13 e9 ff ff       	call   8000dd <sys_cputs>
+		b->idx = 0;
+  8017ca:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8017d0:	83 c4 10             	add    $0x10,%esp
+  8017d3:	eb db                	jmp    8017b0 <putch+0x1f>
+
+008017d5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8017d5:	55                   	push   %ebp
+  8017d6:	89 e5                	mov    %esp,%ebp
+  8017d8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8017de:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017e5:	00 00 00 
+	b.cnt = 0;
+  8017e8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8017ef:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8017f2:	ff 75 0c             	push   0xc(%ebp)
+  8017f5:	ff 75 08             	push   0x8(%ebp)
+  8017f8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8017fe:	50                   	push   %eax
+  8017ff:	68 91 17 80 00       	push   $0x801791
+  801804:	e8 14 01 00 00       	call   80191d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  801809:	83 c4 08             	add    $0x8,%esp
+  80180c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801812:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  801818:	50                   	push   %eax
+  801819:	e8 bf e8 ff ff       	call   8000dd <sys_cputs>
+
+	return b.cnt;
+}
+  80181e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801824:	c9                   	leave
+  801825:	c3                   	ret
+
+00801826 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801826:	55                   	push   %ebp
+  801827:	89 e5                	mov    %esp,%ebp
+  801829:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80182c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80182f:	50                   	push   %eax
+  801830:	ff 75 08             	push   0x8(%ebp)
+  801833:	e8 9d ff ff ff       	call   8017d5 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801838:	c9                   	leave
+  801839:	c3                   	ret
+
+0080183a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80183a:	55                   	push   %ebp
+  80183b:	89 e5                	mov    %esp,%ebp
+  80183d:	57                   	push   %edi
+  80183e:	56                   	push   %esi
+  80183f:	53                   	push   %ebx
+  801840:	83 ec 1c             	sub    $0x1c,%esp
+  801843:	89 c7                	mov    %eax,%edi
+  801845:	89 d6                	mov    %edx,%esi
+  801847:	8b 45 08             	mov    0x8(%ebp),%eax
+  80184a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80184d:	89 d1                	mov    %edx,%ecx
+  80184f:	89 c2                	mov    %eax,%edx
+  801851:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801854:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801857:	8b 45 10             	mov    0x10(%ebp),%eax
+  80185a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80185d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801860:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801867:	39 c2                	cmp    %eax,%edx
+  801869:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80186c:	72 3e                	jb     8018ac <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80186e:	83 ec 0c             	sub    $0xc,%esp
+  801871:	ff 75 18             	push   0x18(%ebp)
+  801874:	83 eb 01             	sub    $0x1,%ebx
+  801877:	53                   	push   %ebx
+  801878:	50                   	push   %eax
+  801879:	83 ec 08             	sub    $0x8,%esp
+  80187c:	ff 75 e4             	push   -0x1c(%ebp)
+  80187f:	ff 75 e0             	push   -0x20(%ebp)
+  801882:	ff 75 dc             	push   -0x24(%ebp)
+  801885:	ff 75 d8             	push   -0x28(%ebp)
+  801888:	e8 03 0e 00 00       	call   802690 <__udivdi3>
+  80188d:	83 c4 18             	add    $0x18,%esp
+  801890:	52                   	push   %edx
+  801891:	50                   	push   %eax
+  801892:	89 f2                	mov    %esi,%edx
+  801894:	89 f8                	mov    %edi,%eax
+  801896:	e8 9f ff ff ff       	call   80183a <printnum>
+  80189b:	83 c4 20             	add    $0x20,%esp
+  80189e:	eb 13                	jmp    8018b3 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8018a0:	83 ec 08             	sub    $0x8,%esp
+  8018a3:	56                   	push   %esi
+  8018a4:	ff 75 18             	push   0x18(%ebp)
+  8018a7:	ff d7                	call   *%edi
+  8018a9:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8018ac:	83 eb 01             	sub    $0x1,%ebx
+  8018af:	85 db                	test   %ebx,%ebx
+  8018b1:	7f ed                	jg     8018a0 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8018b3:	83 ec 08             	sub    $0x8,%esp
+  8018b6:	56                   	push   %esi
+  8018b7:	83 ec 04             	sub    $0x4,%esp
+  8018ba:	ff 75 e4             	push   -0x1c(%ebp)
+  8018bd:	ff 75 e0             	push   -0x20(%ebp)
+  8018c0:	ff 75 dc             	push   -0x24(%ebp)
+  8018c3:	ff 75 d8             	push   -0x28(%ebp)
+  8018c6:	e8 e3 0d 00 00       	call   8026ae <__umoddi3>
+  8018cb:	83 c4 14             	add    $0x14,%esp
+  8018ce:	0f be 80 07 29 80 00 	movsbl 0x802907(%eax),%eax
+  8018d5:	50                   	push   %eax
+  8018d6:	ff d7                	call   *%edi
+}
+  8018d8:	83 c4 10             	add    $0x10,%esp
+  8018db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018de:	5b                   	pop    %ebx
+  8018df:	5e                   	pop    %esi
+  8018e0:	5f                   	pop    %edi
+  8018e1:	5d                   	pop    %ebp
+  8018e2:	c3                   	ret
+
+008018e3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8018e3:	55                   	push   %ebp
+  8018e4:	89 e5                	mov    %esp,%ebp
+  8018e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8018e9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8018ed:	8b 10                	mov    (%eax),%edx
+  8018ef:	3b 50 04             	cmp    0x4(%eax),%edx
+  8018f2:	73 0a                	jae    8018fe <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8018f4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8018f7:	89 08                	mov    %ecx,(%eax)
+  8018f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018fc:	88 02                	mov    %al,(%edx)
+}
+  8018fe:	5d                   	pop    %ebp
+  8018ff:	c3                   	ret
+
+00801900 <printfmt>:
+{
+  801900:	55                   	push   %ebp
+  801901:	89 e5                	mov    %esp,%ebp
+  801903:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801906:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801909:	50                   	push   %eax
+  80190a:	ff 75 10             	push   0x10(%ebp)
+  80190d:	ff 75 0c             	push   0xc(%ebp)
+  801910:	ff 75 08             	push   0x8(%ebp)
+  801913:	e8 05 00 00 00       	call   80191d <vprintfmt>
+}
+  801918:	83 c4 10             	add    $0x10,%esp
+  80191b:	c9                   	leave
+  80191c:	c3                   	ret
+
+0080191d <vprintfmt>:
+{
+  80191d:	55                   	push   %ebp
+  80191e:	89 e5                	mov    %esp,%ebp
+  801920:	57                   	push   %edi
+  801921:	56                   	push   %esi
+  801922:	53                   	push   %ebx
+  801923:	83 ec 2c             	sub    $0x2c,%esp
+  801926:	8b 75 08             	mov    0x8(%ebp),%esi
+  801929:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80192c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80192f:	eb 0a                	jmp    80193b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  801931:	83 ec 08             	sub    $0x8,%esp
+  801934:	53                   	push   %ebx
+  801935:	50                   	push   %eax
+  801936:	ff d6                	call   *%esi
+  801938:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80193b:	83 c7 01             	add    $0x1,%edi
+  80193e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801942:	83 f8 25             	cmp    $0x25,%eax
+  801945:	74 0c                	je     801953 <vprintfmt+0x36>
+			if (ch == '\0')
+  801947:	85 c0                	test   %eax,%eax
+  801949:	75 e6                	jne    801931 <vprintfmt+0x14>
+}
+  80194b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80194e:	5b                   	pop    %ebx
+  80194f:	5e                   	pop    %esi
+  801950:	5f                   	pop    %edi
+  801951:	5d                   	pop    %ebp
+  801952:	c3                   	ret
+		padc = ' ';
+  801953:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801957:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80195e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801965:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80196c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801971:	8d 47 01             	lea    0x1(%edi),%eax
+  801974:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801977:	0f b6 17             	movzbl (%edi),%edx
+  80197a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80197d:	3c 55                	cmp    $0x55,%al
+  80197f:	0f 87 c5 03 00 00    	ja     801d4a <vprintfmt+0x42d>
+  801985:	0f b6 c0             	movzbl %al,%eax
+  801988:	ff 24 85 80 2a 80 00 	jmp    *0x802a80(,%eax,4)
+  80198f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801992:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801996:	eb d9                	jmp    801971 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801998:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80199b:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80199f:	eb d0                	jmp    801971 <vprintfmt+0x54>
+  8019a1:	0f b6 d2             	movzbl %dl,%edx
+  8019a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8019a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ac:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8019af:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8019b2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8019b6:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8019b9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8019bc:	83 f9 09             	cmp    $0x9,%ecx
+  8019bf:	77 55                	ja     801a16 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8019c1:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8019c4:	eb e9                	jmp    8019af <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8019c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019c9:	8b 00                	mov    (%eax),%eax
+  8019cb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8019d4:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019d7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8019da:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8019de:	79 91                	jns    801971 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8019e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8019e3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019e6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8019ed:	eb 82                	jmp    801971 <vprintfmt+0x54>
+			if (width < 0)
+  8019ef:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8019f2:	85 d2                	test   %edx,%edx
+  8019f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f9:	0f 49 c2             	cmovns %edx,%eax
+  8019fc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019ff:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801a02:	e9 6a ff ff ff       	jmp    801971 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801a07:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  801a0a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801a11:	e9 5b ff ff ff       	jmp    801971 <vprintfmt+0x54>
+  801a16:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801a19:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801a1c:	eb bc                	jmp    8019da <vprintfmt+0xbd>
+			lflag++;
+  801a1e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801a21:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  801a24:	e9 48 ff ff ff       	jmp    801971 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  801a29:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a2c:	8d 78 04             	lea    0x4(%eax),%edi
+  801a2f:	83 ec 08             	sub    $0x8,%esp
+  801a32:	53                   	push   %ebx
+  801a33:	ff 30                	push   (%eax)
+  801a35:	ff d6                	call   *%esi
+			break;
+  801a37:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  801a3a:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801a3d:	e9 63 02 00 00       	jmp    801ca5 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  801a42:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a45:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801a48:	8b 10                	mov    (%eax),%edx
+  801a4a:	89 d0                	mov    %edx,%eax
+  801a4c:	f7 d8                	neg    %eax
+  801a4e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801a51:	83 f8 12             	cmp    $0x12,%eax
+  801a54:	7f 23                	jg     801a79 <vprintfmt+0x15c>
+  801a56:	8b 14 85 e0 2b 80 00 	mov    0x802be0(,%eax,4),%edx
+  801a5d:	85 d2                	test   %edx,%edx
+  801a5f:	74 18                	je     801a79 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801a61:	52                   	push   %edx
+  801a62:	68 9d 28 80 00       	push   $0x80289d
+  801a67:	53                   	push   %ebx
+  801a68:	56                   	push   %esi
+  801a69:	e8 92 fe ff ff       	call   801900 <printfmt>
+  801a6e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a71:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801a74:	e9 2c 02 00 00       	jmp    801ca5 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  801a79:	50                   	push   %eax
+  801a7a:	68 1f 29 80 00       	push   $0x80291f
+  801a7f:	53                   	push   %ebx
+  801a80:	56                   	push   %esi
+  801a81:	e8 7a fe ff ff       	call   801900 <printfmt>
+  801a86:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a89:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801a8c:	e9 14 02 00 00       	jmp    801ca5 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801a91:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a94:	83 c0 04             	add    $0x4,%eax
+  801a97:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801a9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a9d:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801a9f:	85 c9                	test   %ecx,%ecx
+  801aa1:	b8 18 29 80 00       	mov    $0x802918,%eax
+  801aa6:	0f 45 c1             	cmovne %ecx,%eax
+  801aa9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801aac:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801ab0:	7e 06                	jle    801ab8 <vprintfmt+0x19b>
+  801ab2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801ab6:	75 0b                	jne    801ac3 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ab8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801abb:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801abe:	89 75 08             	mov    %esi,0x8(%ebp)
+  801ac1:	eb 5c                	jmp    801b1f <vprintfmt+0x202>
+  801ac3:	83 ec 08             	sub    $0x8,%esp
+  801ac6:	ff 75 d0             	push   -0x30(%ebp)
+  801ac9:	ff 75 cc             	push   -0x34(%ebp)
+  801acc:	e8 19 03 00 00       	call   801dea <strnlen>
+  801ad1:	89 c2                	mov    %eax,%edx
+  801ad3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ad6:	29 d0                	sub    %edx,%eax
+  801ad8:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801adb:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801adf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ae2:	89 75 08             	mov    %esi,0x8(%ebp)
+  801ae5:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ae7:	eb 0e                	jmp    801af7 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801ae9:	83 ec 08             	sub    $0x8,%esp
+  801aec:	53                   	push   %ebx
+  801aed:	57                   	push   %edi
+  801aee:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801af1:	83 ee 01             	sub    $0x1,%esi
+  801af4:	83 c4 10             	add    $0x10,%esp
+  801af7:	85 f6                	test   %esi,%esi
+  801af9:	7f ee                	jg     801ae9 <vprintfmt+0x1cc>
+  801afb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801afe:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b01:	85 c0                	test   %eax,%eax
+  801b03:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b08:	0f 49 d0             	cmovns %eax,%edx
+  801b0b:	29 d0                	sub    %edx,%eax
+  801b0d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801b10:	eb a6                	jmp    801ab8 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801b12:	83 ec 08             	sub    $0x8,%esp
+  801b15:	53                   	push   %ebx
+  801b16:	52                   	push   %edx
+  801b17:	ff 55 08             	call   *0x8(%ebp)
+  801b1a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801b1d:	89 f1                	mov    %esi,%ecx
+  801b1f:	8d 71 01             	lea    0x1(%ecx),%esi
+  801b22:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801b26:	0f be d0             	movsbl %al,%edx
+  801b29:	85 d2                	test   %edx,%edx
+  801b2b:	74 28                	je     801b55 <vprintfmt+0x238>
+  801b2d:	85 ff                	test   %edi,%edi
+  801b2f:	78 05                	js     801b36 <vprintfmt+0x219>
+  801b31:	83 ef 01             	sub    $0x1,%edi
+  801b34:	78 30                	js     801b66 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801b36:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801b3a:	74 d6                	je     801b12 <vprintfmt+0x1f5>
+  801b3c:	0f be c0             	movsbl %al,%eax
+  801b3f:	83 e8 20             	sub    $0x20,%eax
+  801b42:	83 f8 5e             	cmp    $0x5e,%eax
+  801b45:	76 cb                	jbe    801b12 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801b47:	83 ec 08             	sub    $0x8,%esp
+  801b4a:	53                   	push   %ebx
+  801b4b:	6a 3f                	push   $0x3f
+  801b4d:	ff 55 08             	call   *0x8(%ebp)
+  801b50:	83 c4 10             	add    $0x10,%esp
+  801b53:	eb c8                	jmp    801b1d <vprintfmt+0x200>
+  801b55:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b58:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b5b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801b5e:	01 d0                	add    %edx,%eax
+  801b60:	29 c8                	sub    %ecx,%eax
+  801b62:	89 c7                	mov    %eax,%edi
+  801b64:	eb 13                	jmp    801b79 <vprintfmt+0x25c>
+  801b66:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b69:	eb ed                	jmp    801b58 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801b6b:	83 ec 08             	sub    $0x8,%esp
+  801b6e:	53                   	push   %ebx
+  801b6f:	6a 20                	push   $0x20
+  801b71:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801b73:	83 ef 01             	sub    $0x1,%edi
+  801b76:	83 c4 10             	add    $0x10,%esp
+  801b79:	85 ff                	test   %edi,%edi
+  801b7b:	7f ee                	jg     801b6b <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801b7d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b80:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b83:	e9 1d 01 00 00       	jmp    801ca5 <vprintfmt+0x388>
+	if (lflag >= 2)
+  801b88:	83 f9 01             	cmp    $0x1,%ecx
+  801b8b:	7f 1b                	jg     801ba8 <vprintfmt+0x28b>
+	else if (lflag)
+  801b8d:	85 c9                	test   %ecx,%ecx
+  801b8f:	74 63                	je     801bf4 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  801b91:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b94:	8b 00                	mov    (%eax),%eax
+  801b96:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b99:	99                   	cltd
+  801b9a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b9d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ba0:	8d 40 04             	lea    0x4(%eax),%eax
+  801ba3:	89 45 14             	mov    %eax,0x14(%ebp)
+  801ba6:	eb 17                	jmp    801bbf <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  801ba8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bab:	8b 50 04             	mov    0x4(%eax),%edx
+  801bae:	8b 00                	mov    (%eax),%eax
+  801bb0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bb3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801bb6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bb9:	8d 40 08             	lea    0x8(%eax),%eax
+  801bbc:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801bbf:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801bc2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801bc5:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801bca:	85 c9                	test   %ecx,%ecx
+  801bcc:	0f 89 b9 00 00 00    	jns    801c8b <vprintfmt+0x36e>
+				putch('-', putdat);
+  801bd2:	83 ec 08             	sub    $0x8,%esp
+  801bd5:	53                   	push   %ebx
+  801bd6:	6a 2d                	push   $0x2d
+  801bd8:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801bda:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801bdd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801be0:	f7 da                	neg    %edx
+  801be2:	83 d1 00             	adc    $0x0,%ecx
+  801be5:	f7 d9                	neg    %ecx
+  801be7:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801bea:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801bef:	e9 97 00 00 00       	jmp    801c8b <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  801bf4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bf7:	8b 00                	mov    (%eax),%eax
+  801bf9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bfc:	99                   	cltd
+  801bfd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801c00:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c03:	8d 40 04             	lea    0x4(%eax),%eax
+  801c06:	89 45 14             	mov    %eax,0x14(%ebp)
+  801c09:	eb b4                	jmp    801bbf <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  801c0b:	83 f9 01             	cmp    $0x1,%ecx
+  801c0e:	7f 1b                	jg     801c2b <vprintfmt+0x30e>
+	else if (lflag)
+  801c10:	85 c9                	test   %ecx,%ecx
+  801c12:	74 2c                	je     801c40 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  801c14:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c17:	8b 10                	mov    (%eax),%edx
+  801c19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c1e:	8d 40 04             	lea    0x4(%eax),%eax
+  801c21:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c24:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801c29:	eb 60                	jmp    801c8b <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801c2b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c2e:	8b 10                	mov    (%eax),%edx
+  801c30:	8b 48 04             	mov    0x4(%eax),%ecx
+  801c33:	8d 40 08             	lea    0x8(%eax),%eax
+  801c36:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c39:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801c3e:	eb 4b                	jmp    801c8b <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  801c40:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c43:	8b 10                	mov    (%eax),%edx
+  801c45:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c4a:	8d 40 04             	lea    0x4(%eax),%eax
+  801c4d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c50:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801c55:	eb 34                	jmp    801c8b <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801c57:	83 f9 01             	cmp    $0x1,%ecx
+  801c5a:	7f 15                	jg     801c71 <vprintfmt+0x354>
+	else if (lflag)
+  801c5c:	85 c9                	test   %ecx,%ecx
+  801c5e:	74 4d                	je     801cad <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  801c60:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c63:	8b 00                	mov    (%eax),%eax
+  801c65:	99                   	cltd
+  801c66:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c69:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801c6c:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  801c6f:	eb 11                	jmp    801c82 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  801c71:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c74:	8b 50 04             	mov    0x4(%eax),%edx
+  801c77:	8b 00                	mov    (%eax),%eax
+  801c79:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c7c:	8d 49 08             	lea    0x8(%ecx),%ecx
+  801c7f:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  801c82:	89 d1                	mov    %edx,%ecx
+  801c84:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  801c86:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801c8b:	83 ec 0c             	sub    $0xc,%esp
+  801c8e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801c92:	50                   	push   %eax
+  801c93:	ff 75 e0             	push   -0x20(%ebp)
+  801c96:	57                   	push   %edi
+  801c97:	51                   	push   %ecx
+  801c98:	52                   	push   %edx
+  801c99:	89 da                	mov    %ebx,%edx
+  801c9b:	89 f0                	mov    %esi,%eax
+  801c9d:	e8 98 fb ff ff       	call   80183a <printnum>
+			break;
+  801ca2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801ca5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801ca8:	e9 8e fc ff ff       	jmp    80193b <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  801cad:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cb0:	8b 00                	mov    (%eax),%eax
+  801cb2:	99                   	cltd
+  801cb3:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801cb6:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801cb9:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  801cbc:	eb c4                	jmp    801c82 <vprintfmt+0x365>
+			putch('0', putdat);
+  801cbe:	83 ec 08             	sub    $0x8,%esp
+  801cc1:	53                   	push   %ebx
+  801cc2:	6a 30                	push   $0x30
+  801cc4:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801cc6:	83 c4 08             	add    $0x8,%esp
+  801cc9:	53                   	push   %ebx
+  801cca:	6a 78                	push   $0x78
+  801ccc:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801cce:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cd1:	8b 10                	mov    (%eax),%edx
+  801cd3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801cd8:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801cdb:	8d 40 04             	lea    0x4(%eax),%eax
+  801cde:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ce1:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  801ce6:	eb a3                	jmp    801c8b <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801ce8:	83 f9 01             	cmp    $0x1,%ecx
+  801ceb:	7f 1b                	jg     801d08 <vprintfmt+0x3eb>
+	else if (lflag)
+  801ced:	85 c9                	test   %ecx,%ecx
+  801cef:	74 2f                	je     801d20 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  801cf1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cf4:	8b 10                	mov    (%eax),%edx
+  801cf6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cfb:	8d 40 04             	lea    0x4(%eax),%eax
+  801cfe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801d01:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801d06:	eb 83                	jmp    801c8b <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801d08:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d0b:	8b 10                	mov    (%eax),%edx
+  801d0d:	8b 48 04             	mov    0x4(%eax),%ecx
+  801d10:	8d 40 08             	lea    0x8(%eax),%eax
+  801d13:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801d16:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801d1b:	e9 6b ff ff ff       	jmp    801c8b <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  801d20:	8b 45 14             	mov    0x14(%ebp),%eax
+  801d23:	8b 10                	mov    (%eax),%edx
+  801d25:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d2a:	8d 40 04             	lea    0x4(%eax),%eax
+  801d2d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801d30:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801d35:	e9 51 ff ff ff       	jmp    801c8b <vprintfmt+0x36e>
+			putch(ch, putdat);
+  801d3a:	83 ec 08             	sub    $0x8,%esp
+  801d3d:	53                   	push   %ebx
+  801d3e:	6a 25                	push   $0x25
+  801d40:	ff d6                	call   *%esi
+			break;
+  801d42:	83 c4 10             	add    $0x10,%esp
+  801d45:	e9 5b ff ff ff       	jmp    801ca5 <vprintfmt+0x388>
+			putch('%', putdat);
+  801d4a:	83 ec 08             	sub    $0x8,%esp
+  801d4d:	53                   	push   %ebx
+  801d4e:	6a 25                	push   $0x25
+  801d50:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801d52:	83 c4 10             	add    $0x10,%esp
+  801d55:	89 f8                	mov    %edi,%eax
+  801d57:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801d5b:	74 05                	je     801d62 <vprintfmt+0x445>
+  801d5d:	83 e8 01             	sub    $0x1,%eax
+  801d60:	eb f5                	jmp    801d57 <vprintfmt+0x43a>
+  801d62:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d65:	e9 3b ff ff ff       	jmp    801ca5 <vprintfmt+0x388>
+
+00801d6a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801d6a:	55                   	push   %ebp
+  801d6b:	89 e5                	mov    %esp,%ebp
+  801d6d:	83 ec 18             	sub    $0x18,%esp
+  801d70:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d73:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801d76:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801d79:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801d7d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801d80:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801d87:	85 c0                	test   %eax,%eax
+  801d89:	74 26                	je     801db1 <vsnprintf+0x47>
+  801d8b:	85 d2                	test   %edx,%edx
+  801d8d:	7e 22                	jle    801db1 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801d8f:	ff 75 14             	push   0x14(%ebp)
+  801d92:	ff 75 10             	push   0x10(%ebp)
+  801d95:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801d98:	50                   	push   %eax
+  801d99:	68 e3 18 80 00       	push   $0x8018e3
+  801d9e:	e8 7a fb ff ff       	call   80191d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801da3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801da6:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801da9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dac:	83 c4 10             	add    $0x10,%esp
+}
+  801daf:	c9                   	leave
+  801db0:	c3                   	ret
+		return -E_INVAL;
+  801db1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801db6:	eb f7                	jmp    801daf <vsnprintf+0x45>
+
+00801db8 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801db8:	55                   	push   %ebp
+  801db9:	89 e5                	mov    %esp,%ebp
+  801dbb:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801dbe:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801dc1:	50                   	push   %eax
+  801dc2:	ff 75 10             	push   0x10(%ebp)
+  801dc5:	ff 75 0c             	push   0xc(%ebp)
+  801dc8:	ff 75 08             	push   0x8(%ebp)
+  801dcb:	e8 9a ff ff ff       	call   801d6a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801dd0:	c9                   	leave
+  801dd1:	c3                   	ret
+
+00801dd2 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801dd2:	55                   	push   %ebp
+  801dd3:	89 e5                	mov    %esp,%ebp
+  801dd5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ddd:	eb 03                	jmp    801de2 <strlen+0x10>
+		n++;
+  801ddf:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801de2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801de6:	75 f7                	jne    801ddf <strlen+0xd>
+	return n;
+}
+  801de8:	5d                   	pop    %ebp
+  801de9:	c3                   	ret
+
+00801dea <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801dea:	55                   	push   %ebp
+  801deb:	89 e5                	mov    %esp,%ebp
+  801ded:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801df0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801df3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df8:	eb 03                	jmp    801dfd <strnlen+0x13>
+		n++;
+  801dfa:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dfd:	39 d0                	cmp    %edx,%eax
+  801dff:	74 08                	je     801e09 <strnlen+0x1f>
+  801e01:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801e05:	75 f3                	jne    801dfa <strnlen+0x10>
+  801e07:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801e09:	89 d0                	mov    %edx,%eax
+  801e0b:	5d                   	pop    %ebp
+  801e0c:	c3                   	ret
+
+00801e0d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801e0d:	55                   	push   %ebp
+  801e0e:	89 e5                	mov    %esp,%ebp
+  801e10:	53                   	push   %ebx
+  801e11:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e14:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801e17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801e20:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801e23:	83 c0 01             	add    $0x1,%eax
+  801e26:	84 d2                	test   %dl,%dl
+  801e28:	75 f2                	jne    801e1c <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801e2a:	89 c8                	mov    %ecx,%eax
+  801e2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e2f:	c9                   	leave
+  801e30:	c3                   	ret
+
+00801e31 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801e31:	55                   	push   %ebp
+  801e32:	89 e5                	mov    %esp,%ebp
+  801e34:	53                   	push   %ebx
+  801e35:	83 ec 10             	sub    $0x10,%esp
+  801e38:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801e3b:	53                   	push   %ebx
+  801e3c:	e8 91 ff ff ff       	call   801dd2 <strlen>
+  801e41:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801e44:	ff 75 0c             	push   0xc(%ebp)
+  801e47:	01 d8                	add    %ebx,%eax
+  801e49:	50                   	push   %eax
+  801e4a:	e8 be ff ff ff       	call   801e0d <strcpy>
+	return dst;
+}
+  801e4f:	89 d8                	mov    %ebx,%eax
+  801e51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e54:	c9                   	leave
+  801e55:	c3                   	ret
+
+00801e56 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801e56:	55                   	push   %ebp
+  801e57:	89 e5                	mov    %esp,%ebp
+  801e59:	56                   	push   %esi
+  801e5a:	53                   	push   %ebx
+  801e5b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e5e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801e61:	89 f3                	mov    %esi,%ebx
+  801e63:	03 5d 10             	add    0x10(%ebp),%ebx
+  801e66:	89 f0                	mov    %esi,%eax
+  801e68:	eb 0f                	jmp    801e79 <strncpy+0x23>
+		*dst++ = *src;
+  801e6a:	83 c0 01             	add    $0x1,%eax
+  801e6d:	0f b6 0a             	movzbl (%edx),%ecx
+  801e70:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801e73:	80 f9 01             	cmp    $0x1,%cl
+  801e76:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801e79:	39 d8                	cmp    %ebx,%eax
+  801e7b:	75 ed                	jne    801e6a <strncpy+0x14>
+	}
+	return ret;
+}
+  801e7d:	89 f0                	mov    %esi,%eax
+  801e7f:	5b                   	pop    %ebx
+  801e80:	5e                   	pop    %esi
+  801e81:	5d                   	pop    %ebp
+  801e82:	c3                   	ret
+
+00801e83 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e83:	55                   	push   %ebp
+  801e84:	89 e5                	mov    %esp,%ebp
+  801e86:	56                   	push   %esi
+  801e87:	53                   	push   %ebx
+  801e88:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e8e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801e91:	89 f0                	mov    %esi,%eax
+  801e93:	85 d2                	test   %edx,%edx
+  801e95:	74 21                	je     801eb8 <strlcpy+0x35>
+  801e97:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801e9b:	89 f2                	mov    %esi,%edx
+  801e9d:	eb 09                	jmp    801ea8 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801e9f:	83 c1 01             	add    $0x1,%ecx
+  801ea2:	83 c2 01             	add    $0x1,%edx
+  801ea5:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801ea8:	39 c2                	cmp    %eax,%edx
+  801eaa:	74 09                	je     801eb5 <strlcpy+0x32>
+  801eac:	0f b6 19             	movzbl (%ecx),%ebx
+  801eaf:	84 db                	test   %bl,%bl
+  801eb1:	75 ec                	jne    801e9f <strlcpy+0x1c>
+  801eb3:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801eb5:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801eb8:	29 f0                	sub    %esi,%eax
+}
+  801eba:	5b                   	pop    %ebx
+  801ebb:	5e                   	pop    %esi
+  801ebc:	5d                   	pop    %ebp
+  801ebd:	c3                   	ret
+
+00801ebe <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801ebe:	55                   	push   %ebp
+  801ebf:	89 e5                	mov    %esp,%ebp
+  801ec1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ec4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801ec7:	eb 06                	jmp    801ecf <strcmp+0x11>
+		p++, q++;
+  801ec9:	83 c1 01             	add    $0x1,%ecx
+  801ecc:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801ecf:	0f b6 01             	movzbl (%ecx),%eax
+  801ed2:	84 c0                	test   %al,%al
+  801ed4:	74 04                	je     801eda <strcmp+0x1c>
+  801ed6:	3a 02                	cmp    (%edx),%al
+  801ed8:	74 ef                	je     801ec9 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801eda:	0f b6 c0             	movzbl %al,%eax
+  801edd:	0f b6 12             	movzbl (%edx),%edx
+  801ee0:	29 d0                	sub    %edx,%eax
+}
+  801ee2:	5d                   	pop    %ebp
+  801ee3:	c3                   	ret
+
+00801ee4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801ee4:	55                   	push   %ebp
+  801ee5:	89 e5                	mov    %esp,%ebp
+  801ee7:	53                   	push   %ebx
+  801ee8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eeb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eee:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801ef1:	eb 09                	jmp    801efc <strncmp+0x18>
+		n--, p++, q++;
+  801ef3:	83 ea 01             	sub    $0x1,%edx
+  801ef6:	83 c0 01             	add    $0x1,%eax
+  801ef9:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801efc:	85 d2                	test   %edx,%edx
+  801efe:	74 18                	je     801f18 <strncmp+0x34>
+  801f00:	0f b6 18             	movzbl (%eax),%ebx
+  801f03:	84 db                	test   %bl,%bl
+  801f05:	74 04                	je     801f0b <strncmp+0x27>
+  801f07:	3a 19                	cmp    (%ecx),%bl
+  801f09:	74 e8                	je     801ef3 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801f0b:	0f b6 00             	movzbl (%eax),%eax
+  801f0e:	0f b6 11             	movzbl (%ecx),%edx
+  801f11:	29 d0                	sub    %edx,%eax
+}
+  801f13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f16:	c9                   	leave
+  801f17:	c3                   	ret
+		return 0;
+  801f18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f1d:	eb f4                	jmp    801f13 <strncmp+0x2f>
+
+00801f1f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801f1f:	55                   	push   %ebp
+  801f20:	89 e5                	mov    %esp,%ebp
+  801f22:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f25:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f29:	eb 03                	jmp    801f2e <strchr+0xf>
+  801f2b:	83 c0 01             	add    $0x1,%eax
+  801f2e:	0f b6 10             	movzbl (%eax),%edx
+  801f31:	84 d2                	test   %dl,%dl
+  801f33:	74 06                	je     801f3b <strchr+0x1c>
+		if (*s == c)
+  801f35:	38 ca                	cmp    %cl,%dl
+  801f37:	75 f2                	jne    801f2b <strchr+0xc>
+  801f39:	eb 05                	jmp    801f40 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801f3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f40:	5d                   	pop    %ebp
+  801f41:	c3                   	ret
+
+00801f42 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801f42:	55                   	push   %ebp
+  801f43:	89 e5                	mov    %esp,%ebp
+  801f45:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f48:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f4c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801f4f:	38 ca                	cmp    %cl,%dl
+  801f51:	74 09                	je     801f5c <strfind+0x1a>
+  801f53:	84 d2                	test   %dl,%dl
+  801f55:	74 05                	je     801f5c <strfind+0x1a>
+	for (; *s; s++)
+  801f57:	83 c0 01             	add    $0x1,%eax
+  801f5a:	eb f0                	jmp    801f4c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801f5c:	5d                   	pop    %ebp
+  801f5d:	c3                   	ret
+
+00801f5e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801f5e:	55                   	push   %ebp
+  801f5f:	89 e5                	mov    %esp,%ebp
+  801f61:	57                   	push   %edi
+  801f62:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f65:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801f68:	85 c9                	test   %ecx,%ecx
+  801f6a:	74 20                	je     801f8c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801f6c:	89 f8                	mov    %edi,%eax
+  801f6e:	09 c8                	or     %ecx,%eax
+  801f70:	a8 03                	test   $0x3,%al
+  801f72:	75 12                	jne    801f86 <memset+0x28>
+		c &= 0xFF;
+  801f74:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801f78:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801f7e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801f81:	fc                   	cld
+  801f82:	f3 ab                	rep stos %eax,%es:(%edi)
+  801f84:	eb 06                	jmp    801f8c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801f86:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f89:	fc                   	cld
+  801f8a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801f8c:	89 f8                	mov    %edi,%eax
+  801f8e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801f91:	c9                   	leave
+  801f92:	c3                   	ret
+
+00801f93 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801f93:	55                   	push   %ebp
+  801f94:	89 e5                	mov    %esp,%ebp
+  801f96:	57                   	push   %edi
+  801f97:	56                   	push   %esi
+  801f98:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f9b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f9e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801fa1:	39 c6                	cmp    %eax,%esi
+  801fa3:	73 32                	jae    801fd7 <memmove+0x44>
+  801fa5:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801fa8:	39 d0                	cmp    %edx,%eax
+  801faa:	73 2b                	jae    801fd7 <memmove+0x44>
+		s += n;
+		d += n;
+  801fac:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801faf:	89 d6                	mov    %edx,%esi
+  801fb1:	09 fe                	or     %edi,%esi
+  801fb3:	09 ce                	or     %ecx,%esi
+  801fb5:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801fbb:	75 0e                	jne    801fcb <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801fbd:	83 ef 04             	sub    $0x4,%edi
+  801fc0:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801fc3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801fc6:	fd                   	std
+  801fc7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fc9:	eb 09                	jmp    801fd4 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801fcb:	83 ef 01             	sub    $0x1,%edi
+  801fce:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801fd1:	fd                   	std
+  801fd2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801fd4:	fc                   	cld
+  801fd5:	eb 1a                	jmp    801ff1 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801fd7:	89 f2                	mov    %esi,%edx
+  801fd9:	09 c2                	or     %eax,%edx
+  801fdb:	09 ca                	or     %ecx,%edx
+  801fdd:	f6 c2 03             	test   $0x3,%dl
+  801fe0:	75 0a                	jne    801fec <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801fe2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801fe5:	89 c7                	mov    %eax,%edi
+  801fe7:	fc                   	cld
+  801fe8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fea:	eb 05                	jmp    801ff1 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801fec:	89 c7                	mov    %eax,%edi
+  801fee:	fc                   	cld
+  801fef:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801ff1:	5e                   	pop    %esi
+  801ff2:	5f                   	pop    %edi
+  801ff3:	5d                   	pop    %ebp
+  801ff4:	c3                   	ret
+
+00801ff5 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801ff5:	55                   	push   %ebp
+  801ff6:	89 e5                	mov    %esp,%ebp
+  801ff8:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801ffb:	ff 75 10             	push   0x10(%ebp)
+  801ffe:	ff 75 0c             	push   0xc(%ebp)
+  802001:	ff 75 08             	push   0x8(%ebp)
+  802004:	e8 8a ff ff ff       	call   801f93 <memmove>
+}
+  802009:	c9                   	leave
+  80200a:	c3                   	ret
+
+0080200b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80200b:	55                   	push   %ebp
+  80200c:	89 e5                	mov    %esp,%ebp
+  80200e:	56                   	push   %esi
+  80200f:	53                   	push   %ebx
+  802010:	8b 45 08             	mov    0x8(%ebp),%eax
+  802013:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802016:	89 c6                	mov    %eax,%esi
+  802018:	03 75 10             	add    0x10(%ebp),%esi
+  80201b:	eb 06                	jmp    802023 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80201d:	83 c0 01             	add    $0x1,%eax
+  802020:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802023:	39 f0                	cmp    %esi,%eax
+  802025:	74 14                	je     80203b <memcmp+0x30>
+		if (*s1 != *s2)
+  802027:	0f b6 08             	movzbl (%eax),%ecx
+  80202a:	0f b6 1a             	movzbl (%edx),%ebx
+  80202d:	38 d9                	cmp    %bl,%cl
+  80202f:	74 ec                	je     80201d <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802031:	0f b6 c1             	movzbl %cl,%eax
+  802034:	0f b6 db             	movzbl %bl,%ebx
+  802037:	29 d8                	sub    %ebx,%eax
+  802039:	eb 05                	jmp    802040 <memcmp+0x35>
+	}
+
+	return 0;
+  80203b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802040:	5b                   	pop    %ebx
+  802041:	5e                   	pop    %esi
+  802042:	5d                   	pop    %ebp
+  802043:	c3                   	ret
+
+00802044 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802044:	55                   	push   %ebp
+  802045:	89 e5                	mov    %esp,%ebp
+  802047:	8b 45 08             	mov    0x8(%ebp),%eax
+  80204a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80204d:	89 c2                	mov    %eax,%edx
+  80204f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802052:	eb 03                	jmp    802057 <memfind+0x13>
+  802054:	83 c0 01             	add    $0x1,%eax
+  802057:	39 d0                	cmp    %edx,%eax
+  802059:	73 04                	jae    80205f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80205b:	38 08                	cmp    %cl,(%eax)
+  80205d:	75 f5                	jne    802054 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80205f:	5d                   	pop    %ebp
+  802060:	c3                   	ret
+
+00802061 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802061:	55                   	push   %ebp
+  802062:	89 e5                	mov    %esp,%ebp
+  802064:	57                   	push   %edi
+  802065:	56                   	push   %esi
+  802066:	53                   	push   %ebx
+  802067:	8b 55 08             	mov    0x8(%ebp),%edx
+  80206a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80206d:	eb 03                	jmp    802072 <strtol+0x11>
+		s++;
+  80206f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802072:	0f b6 02             	movzbl (%edx),%eax
+  802075:	3c 20                	cmp    $0x20,%al
+  802077:	74 f6                	je     80206f <strtol+0xe>
+  802079:	3c 09                	cmp    $0x9,%al
+  80207b:	74 f2                	je     80206f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  80207d:	3c 2b                	cmp    $0x2b,%al
+  80207f:	74 2a                	je     8020ab <strtol+0x4a>
+	int neg = 0;
+  802081:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802086:	3c 2d                	cmp    $0x2d,%al
+  802088:	74 2b                	je     8020b5 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80208a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802090:	75 0f                	jne    8020a1 <strtol+0x40>
+  802092:	80 3a 30             	cmpb   $0x30,(%edx)
+  802095:	74 28                	je     8020bf <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802097:	85 db                	test   %ebx,%ebx
+  802099:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80209e:	0f 44 d8             	cmove  %eax,%ebx
+  8020a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020a6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8020a9:	eb 46                	jmp    8020f1 <strtol+0x90>
+		s++;
+  8020ab:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8020ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020b3:	eb d5                	jmp    80208a <strtol+0x29>
+		s++, neg = 1;
+  8020b5:	83 c2 01             	add    $0x1,%edx
+  8020b8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020bd:	eb cb                	jmp    80208a <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8020bf:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8020c3:	74 0e                	je     8020d3 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8020c5:	85 db                	test   %ebx,%ebx
+  8020c7:	75 d8                	jne    8020a1 <strtol+0x40>
+		s++, base = 8;
+  8020c9:	83 c2 01             	add    $0x1,%edx
+  8020cc:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8020d1:	eb ce                	jmp    8020a1 <strtol+0x40>
+		s += 2, base = 16;
+  8020d3:	83 c2 02             	add    $0x2,%edx
+  8020d6:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8020db:	eb c4                	jmp    8020a1 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8020dd:	0f be c0             	movsbl %al,%eax
+  8020e0:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8020e3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8020e6:	7d 3a                	jge    802122 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8020e8:	83 c2 01             	add    $0x1,%edx
+  8020eb:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8020ef:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8020f1:	0f b6 02             	movzbl (%edx),%eax
+  8020f4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8020f7:	89 f3                	mov    %esi,%ebx
+  8020f9:	80 fb 09             	cmp    $0x9,%bl
+  8020fc:	76 df                	jbe    8020dd <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8020fe:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802101:	89 f3                	mov    %esi,%ebx
+  802103:	80 fb 19             	cmp    $0x19,%bl
+  802106:	77 08                	ja     802110 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802108:	0f be c0             	movsbl %al,%eax
+  80210b:	83 e8 57             	sub    $0x57,%eax
+  80210e:	eb d3                	jmp    8020e3 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802110:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802113:	89 f3                	mov    %esi,%ebx
+  802115:	80 fb 19             	cmp    $0x19,%bl
+  802118:	77 08                	ja     802122 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80211a:	0f be c0             	movsbl %al,%eax
+  80211d:	83 e8 37             	sub    $0x37,%eax
+  802120:	eb c1                	jmp    8020e3 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802122:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802126:	74 05                	je     80212d <strtol+0xcc>
+		*endptr = (char *) s;
+  802128:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80212b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80212d:	89 c8                	mov    %ecx,%eax
+  80212f:	f7 d8                	neg    %eax
+  802131:	85 ff                	test   %edi,%edi
+  802133:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802136:	89 c8                	mov    %ecx,%eax
+  802138:	5b                   	pop    %ebx
+  802139:	5e                   	pop    %esi
+  80213a:	5f                   	pop    %edi
+  80213b:	5d                   	pop    %ebp
+  80213c:	c3                   	ret
+
+0080213d <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  80213d:	55                   	push   %ebp
+  80213e:	89 e5                	mov    %esp,%ebp
+  802140:	57                   	push   %edi
+  802141:	56                   	push   %esi
+  802142:	53                   	push   %ebx
+  802143:	83 ec 0c             	sub    $0xc,%esp
+  802146:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802149:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80214c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  80214f:	85 ff                	test   %edi,%edi
+  802151:	74 16                	je     802169 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  802153:	83 ec 04             	sub    $0x4,%esp
+  802156:	56                   	push   %esi
+  802157:	6a 00                	push   $0x0
+  802159:	53                   	push   %ebx
+  80215a:	e8 02 ff ff ff       	call   802061 <strtol>
+  80215f:	89 07                	mov    %eax,(%edi)
+  802161:	83 c4 10             	add    $0x10,%esp
+  802164:	eb 03                	jmp    802169 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  802166:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  802169:	0f b6 03             	movzbl (%ebx),%eax
+  80216c:	3c 20                	cmp    $0x20,%al
+  80216e:	74 f6                	je     802166 <strisl+0x29>
+  802170:	3c 09                	cmp    $0x9,%al
+  802172:	74 f2                	je     802166 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  802174:	3c 2b                	cmp    $0x2b,%al
+  802176:	74 23                	je     80219b <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  802178:	3c 2d                	cmp    $0x2d,%al
+  80217a:	0f 94 c0             	sete   %al
+  80217d:	0f b6 c0             	movzbl %al,%eax
+  802180:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802182:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  802188:	75 41                	jne    8021cb <strisl+0x8e>
+  80218a:	80 3b 30             	cmpb   $0x30,(%ebx)
+  80218d:	74 11                	je     8021a0 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80218f:	85 f6                	test   %esi,%esi
+  802191:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802196:	0f 44 f0             	cmove  %eax,%esi
+  802199:	eb 30                	jmp    8021cb <strisl+0x8e>
+		s++;
+  80219b:	83 c3 01             	add    $0x1,%ebx
+  80219e:	eb e2                	jmp    802182 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8021a0:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  8021a4:	74 0e                	je     8021b4 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  8021a6:	85 f6                	test   %esi,%esi
+  8021a8:	75 21                	jne    8021cb <strisl+0x8e>
+		s++, base = 8;
+  8021aa:	83 c3 01             	add    $0x1,%ebx
+  8021ad:	be 08 00 00 00       	mov    $0x8,%esi
+  8021b2:	eb 17                	jmp    8021cb <strisl+0x8e>
+		s += 2, base = 16;
+  8021b4:	83 c3 02             	add    $0x2,%ebx
+  8021b7:	be 10 00 00 00       	mov    $0x10,%esi
+  8021bc:	eb 0d                	jmp    8021cb <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8021be:	0f be c0             	movsbl %al,%eax
+  8021c1:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  8021c4:	39 f0                	cmp    %esi,%eax
+  8021c6:	7d 38                	jge    802200 <strisl+0xc3>
+			return 0;
+		s++;
+  8021c8:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  8021cb:	0f b6 03             	movzbl (%ebx),%eax
+  8021ce:	8d 50 d0             	lea    -0x30(%eax),%edx
+  8021d1:	80 fa 09             	cmp    $0x9,%dl
+  8021d4:	76 e8                	jbe    8021be <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  8021d6:	8d 50 9f             	lea    -0x61(%eax),%edx
+  8021d9:	80 fa 19             	cmp    $0x19,%dl
+  8021dc:	77 08                	ja     8021e6 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  8021de:	0f be c0             	movsbl %al,%eax
+  8021e1:	83 e8 57             	sub    $0x57,%eax
+  8021e4:	eb de                	jmp    8021c4 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  8021e6:	8d 50 bf             	lea    -0x41(%eax),%edx
+  8021e9:	80 fa 19             	cmp    $0x19,%dl
+  8021ec:	77 08                	ja     8021f6 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  8021ee:	0f be c0             	movsbl %al,%eax
+  8021f1:	83 e8 37             	sub    $0x37,%eax
+  8021f4:	eb ce                	jmp    8021c4 <strisl+0x87>
+		else if (!*s)
+  8021f6:	84 c0                	test   %al,%al
+  8021f8:	0f 94 c0             	sete   %al
+  8021fb:	0f b6 c0             	movzbl %al,%eax
+  8021fe:	eb 05                	jmp    802205 <strisl+0xc8>
+			return 0;
+  802200:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  802205:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802208:	5b                   	pop    %ebx
+  802209:	5e                   	pop    %esi
+  80220a:	5f                   	pop    %edi
+  80220b:	5d                   	pop    %ebp
+  80220c:	c3                   	ret
+
+0080220d <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  80220d:	55                   	push   %ebp
+  80220e:	89 e5                	mov    %esp,%ebp
+  802210:	56                   	push   %esi
+  802211:	53                   	push   %ebx
+  802212:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  802215:	a1 04 40 80 00       	mov    0x804004,%eax
+  80221a:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  80221d:	85 db                	test   %ebx,%ebx
+  80221f:	78 17                	js     802238 <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  802221:	83 ec 0c             	sub    $0xc,%esp
+  802224:	56                   	push   %esi
+  802225:	ff 14 9d 00 60 80 00 	call   *0x806000(,%ebx,4)
+  80222c:	83 c4 10             	add    $0x10,%esp
+  80222f:	85 c0                	test   %eax,%eax
+  802231:	75 27                	jne    80225a <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  802233:	83 eb 01             	sub    $0x1,%ebx
+  802236:	eb e5                	jmp    80221d <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  802238:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80223d:	8b 40 48             	mov    0x48(%eax),%eax
+  802240:	83 ec 08             	sub    $0x8,%esp
+  802243:	ff 76 28             	push   0x28(%esi)
+  802246:	ff 36                	push   (%esi)
+  802248:	50                   	push   %eax
+  802249:	68 4c 2c 80 00       	push   $0x802c4c
+  80224e:	6a 1d                	push   $0x1d
+  802250:	68 6f 2c 80 00       	push   $0x802c6f
+  802255:	e8 f1 f4 ff ff       	call   80174b <_panic>
+}
+  80225a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80225d:	5b                   	pop    %ebx
+  80225e:	5e                   	pop    %esi
+  80225f:	5d                   	pop    %ebp
+  802260:	c3                   	ret
+
+00802261 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802261:	55                   	push   %ebp
+  802262:	89 e5                	mov    %esp,%ebp
+  802264:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  802267:	83 3d 28 60 80 00 00 	cmpl   $0x0,0x806028
+  80226e:	74 0a                	je     80227a <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802270:	8b 45 08             	mov    0x8(%ebp),%eax
+  802273:	a3 28 60 80 00       	mov    %eax,0x806028
+}
+  802278:	c9                   	leave
+  802279:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  80227a:	83 ec 04             	sub    $0x4,%esp
+  80227d:	6a 07                	push   $0x7
+  80227f:	68 00 f0 bf ee       	push   $0xeebff000
+  802284:	6a 00                	push   $0x0
+  802286:	e8 1f df ff ff       	call   8001aa <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80228b:	83 c4 08             	add    $0x8,%esp
+  80228e:	68 45 07 80 00       	push   $0x800745
+  802293:	6a 00                	push   $0x0
+  802295:	e8 76 e2 ff ff       	call   800510 <sys_env_set_pgfault_upcall>
+  80229a:	83 c4 10             	add    $0x10,%esp
+  80229d:	eb d1                	jmp    802270 <set_pgfault_handler+0xf>
+
+0080229f <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  80229f:	55                   	push   %ebp
+  8022a0:	89 e5                	mov    %esp,%ebp
+  8022a2:	83 ec 08             	sub    $0x8,%esp
+  8022a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  8022a8:	8b 15 04 40 80 00    	mov    0x804004,%edx
+  8022ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b3:	eb 03                	jmp    8022b8 <add_pgfault_handler+0x19>
+  8022b5:	83 c0 01             	add    $0x1,%eax
+  8022b8:	39 d0                	cmp    %edx,%eax
+  8022ba:	74 0b                	je     8022c7 <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  8022bc:	39 0c 85 00 60 80 00 	cmp    %ecx,0x806000(,%eax,4)
+  8022c3:	75 f0                	jne    8022b5 <add_pgfault_handler+0x16>
+  8022c5:	eb 24                	jmp    8022eb <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  8022c7:	83 fa 0a             	cmp    $0xa,%edx
+  8022ca:	74 21                	je     8022ed <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  8022cc:	8d 42 01             	lea    0x1(%edx),%eax
+  8022cf:	a3 04 40 80 00       	mov    %eax,0x804004
+  8022d4:	89 0c 95 00 60 80 00 	mov    %ecx,0x806000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  8022db:	83 ec 0c             	sub    $0xc,%esp
+  8022de:	68 0d 22 80 00       	push   $0x80220d
+  8022e3:	e8 79 ff ff ff       	call   802261 <set_pgfault_handler>
+  8022e8:	83 c4 10             	add    $0x10,%esp
+}
+  8022eb:	c9                   	leave
+  8022ec:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  8022ed:	83 ec 04             	sub    $0x4,%esp
+  8022f0:	68 7d 2c 80 00       	push   $0x802c7d
+  8022f5:	6a 44                	push   $0x44
+  8022f7:	68 6f 2c 80 00       	push   $0x802c6f
+  8022fc:	e8 4a f4 ff ff       	call   80174b <_panic>
+
+00802301 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  802301:	55                   	push   %ebp
+  802302:	89 e5                	mov    %esp,%ebp
+  802304:	57                   	push   %edi
+  802305:	56                   	push   %esi
+  802306:	53                   	push   %ebx
+  802307:	83 ec 14             	sub    $0x14,%esp
+  80230a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80230d:	8b 75 14             	mov    0x14(%ebp),%esi
+  802310:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  802313:	ff 75 10             	push   0x10(%ebp)
+  802316:	ff 75 0c             	push   0xc(%ebp)
+  802319:	e8 af e2 ff ff       	call   8005cd <sys_ipc_recv_pages>
+  80231e:	83 c4 10             	add    $0x10,%esp
+  802321:	85 c0                	test   %eax,%eax
+  802323:	78 46                	js     80236b <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802325:	85 ff                	test   %edi,%edi
+  802327:	74 0d                	je     802336 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  802329:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80232e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802334:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802336:	85 f6                	test   %esi,%esi
+  802338:	74 0d                	je     802347 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  80233a:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80233f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802345:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802347:	85 db                	test   %ebx,%ebx
+  802349:	74 0d                	je     802358 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  80234b:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802350:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802356:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802358:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80235d:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802363:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802366:	5b                   	pop    %ebx
+  802367:	5e                   	pop    %esi
+  802368:	5f                   	pop    %edi
+  802369:	5d                   	pop    %ebp
+  80236a:	c3                   	ret
+		if (from_env_store) {
+  80236b:	85 ff                	test   %edi,%edi
+  80236d:	74 06                	je     802375 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80236f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802375:	85 f6                	test   %esi,%esi
+  802377:	74 06                	je     80237f <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  802379:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80237f:	85 db                	test   %ebx,%ebx
+  802381:	74 e0                	je     802363 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  802383:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802389:	eb d8                	jmp    802363 <ipc_recv_pages+0x62>
+
+0080238b <ipc_recv>:
+{
+  80238b:	55                   	push   %ebp
+  80238c:	89 e5                	mov    %esp,%ebp
+  80238e:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  802391:	6a 00                	push   $0x0
+  802393:	ff 75 10             	push   0x10(%ebp)
+  802396:	6a 01                	push   $0x1
+  802398:	ff 75 0c             	push   0xc(%ebp)
+  80239b:	ff 75 08             	push   0x8(%ebp)
+  80239e:	e8 5e ff ff ff       	call   802301 <ipc_recv_pages>
+}
+  8023a3:	c9                   	leave
+  8023a4:	c3                   	ret
+
+008023a5 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8023a5:	55                   	push   %ebp
+  8023a6:	89 e5                	mov    %esp,%ebp
+  8023a8:	56                   	push   %esi
+  8023a9:	53                   	push   %ebx
+  8023aa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8023ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8023b0:	83 ec 0c             	sub    $0xc,%esp
+  8023b3:	ff 75 0c             	push   0xc(%ebp)
+  8023b6:	e8 46 e3 ff ff       	call   800701 <sys_ipc_try_recv>
+  8023bb:	83 c4 10             	add    $0x10,%esp
+  8023be:	85 c0                	test   %eax,%eax
+  8023c0:	78 34                	js     8023f6 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8023c2:	85 f6                	test   %esi,%esi
+  8023c4:	74 0d                	je     8023d3 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8023c6:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8023cb:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8023d1:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8023d3:	85 db                	test   %ebx,%ebx
+  8023d5:	74 0d                	je     8023e4 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8023d7:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8023dc:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8023e2:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8023e4:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8023e9:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8023ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023f2:	5b                   	pop    %ebx
+  8023f3:	5e                   	pop    %esi
+  8023f4:	5d                   	pop    %ebp
+  8023f5:	c3                   	ret
+		if (from_env_store) {
+  8023f6:	85 f6                	test   %esi,%esi
+  8023f8:	74 06                	je     802400 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8023fa:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  802400:	85 db                	test   %ebx,%ebx
+  802402:	74 eb                	je     8023ef <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  802404:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80240a:	eb e3                	jmp    8023ef <ipc_try_recv+0x4a>
+
+0080240c <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80240c:	55                   	push   %ebp
+  80240d:	89 e5                	mov    %esp,%ebp
+  80240f:	83 ec 14             	sub    $0x14,%esp
+  802412:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802415:	85 c0                	test   %eax,%eax
+  802417:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80241c:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80241f:	ff 75 18             	push   0x18(%ebp)
+  802422:	ff 75 14             	push   0x14(%ebp)
+  802425:	50                   	push   %eax
+  802426:	ff 75 0c             	push   0xc(%ebp)
+  802429:	ff 75 08             	push   0x8(%ebp)
+  80242c:	e8 5f e1 ff ff       	call   800590 <sys_ipc_send_pages>
+  802431:	83 c4 20             	add    $0x20,%esp
+  802434:	85 c0                	test   %eax,%eax
+  802436:	78 02                	js     80243a <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  802438:	c9                   	leave
+  802439:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  80243a:	50                   	push   %eax
+  80243b:	68 98 2c 80 00       	push   $0x802c98
+  802440:	68 80 00 00 00       	push   $0x80
+  802445:	68 c4 2c 80 00       	push   $0x802cc4
+  80244a:	e8 fc f2 ff ff       	call   80174b <_panic>
+
+0080244f <ipc_send>:
+{
+  80244f:	55                   	push   %ebp
+  802450:	89 e5                	mov    %esp,%ebp
+  802452:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  802455:	ff 75 14             	push   0x14(%ebp)
+  802458:	6a 01                	push   $0x1
+  80245a:	ff 75 10             	push   0x10(%ebp)
+  80245d:	ff 75 0c             	push   0xc(%ebp)
+  802460:	ff 75 08             	push   0x8(%ebp)
+  802463:	e8 a4 ff ff ff       	call   80240c <ipc_send_pages>
+}
+  802468:	83 c4 20             	add    $0x20,%esp
+  80246b:	c9                   	leave
+  80246c:	c3                   	ret
+
+0080246d <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80246d:	55                   	push   %ebp
+  80246e:	89 e5                	mov    %esp,%ebp
+  802470:	83 ec 14             	sub    $0x14,%esp
+  802473:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802476:	85 c0                	test   %eax,%eax
+  802478:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80247d:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802480:	ff 75 18             	push   0x18(%ebp)
+  802483:	ff 75 14             	push   0x14(%ebp)
+  802486:	50                   	push   %eax
+  802487:	ff 75 0c             	push   0xc(%ebp)
+  80248a:	ff 75 08             	push   0x8(%ebp)
+  80248d:	e8 8f e1 ff ff       	call   800621 <sys_ipc_call>
+  802492:	83 c4 20             	add    $0x20,%esp
+  802495:	85 c0                	test   %eax,%eax
+  802497:	78 0b                	js     8024a4 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  802499:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80249e:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8024a4:	c9                   	leave
+  8024a5:	c3                   	ret
+
+008024a6 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  8024a6:	55                   	push   %ebp
+  8024a7:	89 e5                	mov    %esp,%ebp
+  8024a9:	57                   	push   %edi
+  8024aa:	56                   	push   %esi
+  8024ab:	53                   	push   %ebx
+  8024ac:	83 ec 18             	sub    $0x18,%esp
+  8024af:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024b2:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8024b5:	8b 75 20             	mov    0x20(%ebp),%esi
+  8024b8:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8024bb:	85 c0                	test   %eax,%eax
+  8024bd:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8024c2:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8024c5:	ff 75 18             	push   0x18(%ebp)
+  8024c8:	ff 75 14             	push   0x14(%ebp)
+  8024cb:	50                   	push   %eax
+  8024cc:	ff 75 0c             	push   0xc(%ebp)
+  8024cf:	ff 75 08             	push   0x8(%ebp)
+  8024d2:	e8 8b e1 ff ff       	call   800662 <sys_ipc_reply_recv>
+  8024d7:	83 c4 20             	add    $0x20,%esp
+  8024da:	85 c0                	test   %eax,%eax
+  8024dc:	78 46                	js     802524 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8024de:	85 ff                	test   %edi,%edi
+  8024e0:	74 0d                	je     8024ef <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8024e2:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8024e7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8024ed:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8024ef:	85 f6                	test   %esi,%esi
+  8024f1:	74 0d                	je     802500 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8024f3:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8024f8:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8024fe:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802500:	85 db                	test   %ebx,%ebx
+  802502:	74 0d                	je     802511 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  802504:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802509:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80250f:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802511:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802516:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80251c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80251f:	5b                   	pop    %ebx
+  802520:	5e                   	pop    %esi
+  802521:	5f                   	pop    %edi
+  802522:	5d                   	pop    %ebp
+  802523:	c3                   	ret
+		if (from_env_store) {
+  802524:	85 ff                	test   %edi,%edi
+  802526:	74 06                	je     80252e <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  802528:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80252e:	85 f6                	test   %esi,%esi
+  802530:	74 06                	je     802538 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  802532:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802538:	85 db                	test   %ebx,%ebx
+  80253a:	74 e0                	je     80251c <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  80253c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802542:	eb d8                	jmp    80251c <ipc_reply_recv+0x76>
+
+00802544 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802544:	55                   	push   %ebp
+  802545:	89 e5                	mov    %esp,%ebp
+  802547:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80254a:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80254f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802552:	c1 e0 06             	shl    $0x6,%eax
+  802555:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80255a:	8b 40 50             	mov    0x50(%eax),%eax
+  80255d:	39 c8                	cmp    %ecx,%eax
+  80255f:	74 12                	je     802573 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802561:	83 c2 01             	add    $0x1,%edx
+  802564:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80256a:	75 e3                	jne    80254f <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80256c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802571:	eb 0e                	jmp    802581 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802573:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802576:	c1 e0 06             	shl    $0x6,%eax
+  802579:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80257e:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802581:	5d                   	pop    %ebp
+  802582:	c3                   	ret
+
+00802583 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802583:	55                   	push   %ebp
+  802584:	89 e5                	mov    %esp,%ebp
+  802586:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802589:	89 c2                	mov    %eax,%edx
+  80258b:	c1 ea 16             	shr    $0x16,%edx
+  80258e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802595:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80259a:	f6 c1 01             	test   $0x1,%cl
+  80259d:	74 1e                	je     8025bd <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  80259f:	c1 e8 0c             	shr    $0xc,%eax
+  8025a2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8025a9:	a8 01                	test   $0x1,%al
+  8025ab:	74 10                	je     8025bd <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8025ad:	c1 e8 0c             	shr    $0xc,%eax
+  8025b0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8025b3:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  8025ba:	0f b7 d2             	movzwl %dx,%edx
+}
+  8025bd:	89 d0                	mov    %edx,%eax
+  8025bf:	5d                   	pop    %ebp
+  8025c0:	c3                   	ret
+
+008025c1 <udivmod>:
+  8025c1:	55                   	push   %ebp
+  8025c2:	57                   	push   %edi
+  8025c3:	56                   	push   %esi
+  8025c4:	53                   	push   %ebx
+  8025c5:	83 ec 24             	sub    $0x24,%esp
+  8025c8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8025cc:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8025d0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8025d4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8025d8:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8025dc:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8025e0:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8025e4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8025e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8025fa:	00 
+  8025fb:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802602:	00 
+  802603:	89 fb                	mov    %edi,%ebx
+  802605:	eb 08                	jmp    80260f <udivmod+0x4e>
+  802607:	83 e9 01             	sub    $0x1,%ecx
+  80260a:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80260d:	74 68                	je     802677 <udivmod+0xb6>
+  80260f:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802613:	01 c0                	add    %eax,%eax
+  802615:	89 c6                	mov    %eax,%esi
+  802617:	89 d7                	mov    %edx,%edi
+  802619:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80261d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802621:	0f ad d0             	shrd   %cl,%edx,%eax
+  802624:	d3 ea                	shr    %cl,%edx
+  802626:	f6 c1 20             	test   $0x20,%cl
+  802629:	74 04                	je     80262f <udivmod+0x6e>
+  80262b:	89 d0                	mov    %edx,%eax
+  80262d:	31 d2                	xor    %edx,%edx
+  80262f:	83 e0 01             	and    $0x1,%eax
+  802632:	89 04 24             	mov    %eax,(%esp)
+  802635:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80263c:	00 
+  80263d:	8b 04 24             	mov    (%esp),%eax
+  802640:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802644:	09 f0                	or     %esi,%eax
+  802646:	09 fa                	or     %edi,%edx
+  802648:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80264c:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802650:	39 f0                	cmp    %esi,%eax
+  802652:	89 d5                	mov    %edx,%ebp
+  802654:	19 fd                	sbb    %edi,%ebp
+  802656:	72 af                	jb     802607 <udivmod+0x46>
+  802658:	29 f0                	sub    %esi,%eax
+  80265a:	19 fa                	sbb    %edi,%edx
+  80265c:	89 cf                	mov    %ecx,%edi
+  80265e:	c1 ef 05             	shr    $0x5,%edi
+  802661:	83 e7 01             	and    $0x1,%edi
+  802664:	89 fe                	mov    %edi,%esi
+  802666:	83 f6 01             	xor    $0x1,%esi
+  802669:	d3 e6                	shl    %cl,%esi
+  80266b:	d3 e7                	shl    %cl,%edi
+  80266d:	09 74 24 18          	or     %esi,0x18(%esp)
+  802671:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802675:	eb 90                	jmp    802607 <udivmod+0x46>
+  802677:	85 db                	test   %ebx,%ebx
+  802679:	74 05                	je     802680 <udivmod+0xbf>
+  80267b:	89 03                	mov    %eax,(%ebx)
+  80267d:	89 53 04             	mov    %edx,0x4(%ebx)
+  802680:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802684:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802688:	83 c4 24             	add    $0x24,%esp
+  80268b:	5b                   	pop    %ebx
+  80268c:	5e                   	pop    %esi
+  80268d:	5f                   	pop    %edi
+  80268e:	5d                   	pop    %ebp
+  80268f:	c3                   	ret
+
+00802690 <__udivdi3>:
+  802690:	83 ec 08             	sub    $0x8,%esp
+  802693:	6a 00                	push   $0x0
+  802695:	ff 74 24 1c          	push   0x1c(%esp)
+  802699:	ff 74 24 1c          	push   0x1c(%esp)
+  80269d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026a1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026a5:	e8 17 ff ff ff       	call   8025c1 <udivmod>
+  8026aa:	83 c4 14             	add    $0x14,%esp
+  8026ad:	c3                   	ret
+
+008026ae <__umoddi3>:
+  8026ae:	83 ec 18             	sub    $0x18,%esp
+  8026b1:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8026b5:	50                   	push   %eax
+  8026b6:	ff 74 24 2c          	push   0x2c(%esp)
+  8026ba:	ff 74 24 2c          	push   0x2c(%esp)
+  8026be:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8026c2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8026c6:	e8 f6 fe ff ff       	call   8025c1 <udivmod>
+  8026cb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8026cf:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8026d3:	83 c4 24             	add    $0x24,%esp
+  8026d6:	c3                   	ret
+
+008026d7 <__divdi3>:
+  8026d7:	55                   	push   %ebp
+  8026d8:	57                   	push   %edi
+  8026d9:	56                   	push   %esi
+  8026da:	53                   	push   %ebx
+  8026db:	83 ec 10             	sub    $0x10,%esp
+  8026de:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8026e2:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8026e6:	89 c6                	mov    %eax,%esi
+  8026e8:	89 d7                	mov    %edx,%edi
+  8026ea:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8026ee:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8026f2:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8026f6:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8026fa:	89 c5                	mov    %eax,%ebp
+  8026fc:	f7 dd                	neg    %ebp
+  8026fe:	89 d6                	mov    %edx,%esi
+  802700:	83 d6 00             	adc    $0x0,%esi
+  802703:	f7 de                	neg    %esi
+  802705:	0f 48 e8             	cmovs  %eax,%ebp
+  802708:	0f 49 d6             	cmovns %esi,%edx
+  80270b:	6a 00                	push   $0x0
+  80270d:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802711:	f7 de                	neg    %esi
+  802713:	8b 44 24 34          	mov    0x34(%esp),%eax
+  802717:	83 d0 00             	adc    $0x0,%eax
+  80271a:	f7 d8                	neg    %eax
+  80271c:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  802721:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  802726:	50                   	push   %eax
+  802727:	56                   	push   %esi
+  802728:	89 e8                	mov    %ebp,%eax
+  80272a:	e8 92 fe ff ff       	call   8025c1 <udivmod>
+  80272f:	83 c4 10             	add    $0x10,%esp
+  802732:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  802737:	78 08                	js     802741 <__divdi3+0x6a>
+  802739:	83 c4 0c             	add    $0xc,%esp
+  80273c:	5b                   	pop    %ebx
+  80273d:	5e                   	pop    %esi
+  80273e:	5f                   	pop    %edi
+  80273f:	5d                   	pop    %ebp
+  802740:	c3                   	ret
+  802741:	f7 d8                	neg    %eax
+  802743:	83 d2 00             	adc    $0x0,%edx
+  802746:	f7 da                	neg    %edx
+  802748:	eb ef                	jmp    802739 <__divdi3+0x62>
+
+0080274a <__moddi3>:
+  80274a:	55                   	push   %ebp
+  80274b:	57                   	push   %edi
+  80274c:	56                   	push   %esi
+  80274d:	53                   	push   %ebx
+  80274e:	83 ec 18             	sub    $0x18,%esp
+  802751:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802755:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802759:	89 f1                	mov    %esi,%ecx
+  80275b:	f7 d9                	neg    %ecx
+  80275d:	89 da                	mov    %ebx,%edx
+  80275f:	83 d2 00             	adc    $0x0,%edx
+  802762:	f7 da                	neg    %edx
+  802764:	0f 48 ce             	cmovs  %esi,%ecx
+  802767:	0f 48 d3             	cmovs  %ebx,%edx
+  80276a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80276e:	50                   	push   %eax
+  80276f:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802773:	f7 de                	neg    %esi
+  802775:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802779:	83 d0 00             	adc    $0x0,%eax
+  80277c:	f7 d8                	neg    %eax
+  80277e:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802783:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802788:	50                   	push   %eax
+  802789:	56                   	push   %esi
+  80278a:	89 c8                	mov    %ecx,%eax
+  80278c:	e8 30 fe ff ff       	call   8025c1 <udivmod>
+  802791:	83 c4 10             	add    $0x10,%esp
+  802794:	85 db                	test   %ebx,%ebx
+  802796:	78 10                	js     8027a8 <__moddi3+0x5e>
+  802798:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80279c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027a0:	83 c4 14             	add    $0x14,%esp
+  8027a3:	5b                   	pop    %ebx
+  8027a4:	5e                   	pop    %esi
+  8027a5:	5f                   	pop    %edi
+  8027a6:	5d                   	pop    %ebp
+  8027a7:	c3                   	ret
+  8027a8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8027ac:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8027b0:	f7 d8                	neg    %eax
+  8027b2:	83 d2 00             	adc    $0x0,%edx
+  8027b5:	f7 da                	neg    %edx
+  8027b7:	eb e7                	jmp    8027a0 <__moddi3+0x56>
@@ -0,0 +1,5564 @@
+
+obj/user/faultread.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("I read %08x from location 0!\n", *(unsigned*)0);
+  800039:	ff 35 00 00 00 00    	push   0x0
+  80003f:	68 a0 26 80 00       	push   $0x8026a0
+  800044:	e8 fd 00 00 00       	call   800146 <cprintf>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800059:	e8 84 0b 00 00       	call   800be2 <sys_getenvid>
+  80005e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800063:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800066:	c1 e0 06             	shl    $0x6,%eax
+  800069:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006e:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800073:	85 db                	test   %ebx,%ebx
+  800075:	7e 07                	jle    80007e <libmain+0x30>
+		binaryname = argv[0];
+  800077:	8b 06                	mov    (%esi),%eax
+  800079:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80007e:	83 ec 08             	sub    $0x8,%esp
+  800081:	56                   	push   %esi
+  800082:	53                   	push   %ebx
+  800083:	e8 ab ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800088:	e8 0a 00 00 00       	call   800097 <exit>
+}
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800093:	5b                   	pop    %ebx
+  800094:	5e                   	pop    %esi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+
+00800097 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800097:	55                   	push   %ebp
+  800098:	89 e5                	mov    %esp,%ebp
+  80009a:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80009d:	e8 e4 12 00 00       	call   801386 <close_all>
+	sys_env_destroy(0);
+  8000a2:	83 ec 0c             	sub    $0xc,%esp
+  8000a5:	6a 00                	push   $0x0
+  8000a7:	e8 f5 0a 00 00       	call   800ba1 <sys_env_destroy>
+}
+  8000ac:	83 c4 10             	add    $0x10,%esp
+  8000af:	c9                   	leave
+  8000b0:	c3                   	ret
+
+008000b1 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000b1:	55                   	push   %ebp
+  8000b2:	89 e5                	mov    %esp,%ebp
+  8000b4:	53                   	push   %ebx
+  8000b5:	83 ec 04             	sub    $0x4,%esp
+  8000b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000bb:	8b 13                	mov    (%ebx),%edx
+  8000bd:	8d 42 01             	lea    0x1(%edx),%eax
+  8000c0:	89 03                	mov    %eax,(%ebx)
+  8000c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000c5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000c9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000ce:	74 09                	je     8000d9 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000d0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000d7:	c9                   	leave
+  8000d8:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000d9:	83 ec 08             	sub    $0x8,%esp
+  8000dc:	68 ff 00 00 00       	push   $0xff
+  8000e1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000e4:	50                   	push   %eax
+  8000e5:	e8 69 0a 00 00       	call   800b53 <sys_cputs>
+		b->idx = 0;
+  8000ea:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8000f0:	83 c4 10             	add    $0x10,%esp
+  8000f3:	eb db                	jmp    8000d0 <putch+0x1f>
+
+008000f5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8000f5:	55                   	push   %ebp
+  8000f6:	89 e5                	mov    %esp,%ebp
+  8000f8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8000fe:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800105:	00 00 00 
+	b.cnt = 0;
+  800108:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80010f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800112:	ff 75 0c             	push   0xc(%ebp)
+  800115:	ff 75 08             	push   0x8(%ebp)
+  800118:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80011e:	50                   	push   %eax
+  80011f:	68 b1 00 80 00       	push   $0x8000b1
+  800124:	e8 14 01 00 00       	call   80023d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800129:	83 c4 08             	add    $0x8,%esp
+  80012c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800132:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800138:	50                   	push   %eax
+  800139:	e8 15 0a 00 00       	call   800b53 <sys_cputs>
+
+	return b.cnt;
+}
+  80013e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800144:	c9                   	leave
+  800145:	c3                   	ret
+
+00800146 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800146:	55                   	push   %ebp
+  800147:	89 e5                	mov    %esp,%ebp
+  800149:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80014c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80014f:	50                   	push   %eax
+  800150:	ff 75 08             	push   0x8(%ebp)
+  800153:	e8 9d ff ff ff       	call   8000f5 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800158:	c9                   	leave
+  800159:	c3                   	ret
+
+0080015a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80015a:	55                   	push   %ebp
+  80015b:	89 e5                	mov    %esp,%ebp
+  80015d:	57                   	push   %edi
+  80015e:	56                   	push   %esi
+  80015f:	53                   	push   %ebx
+  800160:	83 ec 1c             	sub    $0x1c,%esp
+  800163:	89 c7                	mov    %eax,%edi
+  800165:	89 d6                	mov    %edx,%esi
+  800167:	8b 45 08             	mov    0x8(%ebp),%eax
+  80016a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80016d:	89 d1                	mov    %edx,%ecx
+  80016f:	89 c2                	mov    %eax,%edx
+  800171:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800174:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800177:	8b 45 10             	mov    0x10(%ebp),%eax
+  80017a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80017d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800180:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800187:	39 c2                	cmp    %eax,%edx
+  800189:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80018c:	72 3e                	jb     8001cc <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80018e:	83 ec 0c             	sub    $0xc,%esp
+  800191:	ff 75 18             	push   0x18(%ebp)
+  800194:	83 eb 01             	sub    $0x1,%ebx
+  800197:	53                   	push   %ebx
+  800198:	50                   	push   %eax
+  800199:	83 ec 08             	sub    $0x8,%esp
+  80019c:	ff 75 e4             	push   -0x1c(%ebp)
+  80019f:	ff 75 e0             	push   -0x20(%ebp)
+  8001a2:	ff 75 dc             	push   -0x24(%ebp)
+  8001a5:	ff 75 d8             	push   -0x28(%ebp)
+  8001a8:	e8 c3 23 00 00       	call   802570 <__udivdi3>
+  8001ad:	83 c4 18             	add    $0x18,%esp
+  8001b0:	52                   	push   %edx
+  8001b1:	50                   	push   %eax
+  8001b2:	89 f2                	mov    %esi,%edx
+  8001b4:	89 f8                	mov    %edi,%eax
+  8001b6:	e8 9f ff ff ff       	call   80015a <printnum>
+  8001bb:	83 c4 20             	add    $0x20,%esp
+  8001be:	eb 13                	jmp    8001d3 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001c0:	83 ec 08             	sub    $0x8,%esp
+  8001c3:	56                   	push   %esi
+  8001c4:	ff 75 18             	push   0x18(%ebp)
+  8001c7:	ff d7                	call   *%edi
+  8001c9:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001cc:	83 eb 01             	sub    $0x1,%ebx
+  8001cf:	85 db                	test   %ebx,%ebx
+  8001d1:	7f ed                	jg     8001c0 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001d3:	83 ec 08             	sub    $0x8,%esp
+  8001d6:	56                   	push   %esi
+  8001d7:	83 ec 04             	sub    $0x4,%esp
+  8001da:	ff 75 e4             	push   -0x1c(%ebp)
+  8001dd:	ff 75 e0             	push   -0x20(%ebp)
+  8001e0:	ff 75 dc             	push   -0x24(%ebp)
+  8001e3:	ff 75 d8             	push   -0x28(%ebp)
+  8001e6:	e8 a3 23 00 00       	call   80258e <__umoddi3>
+  8001eb:	83 c4 14             	add    $0x14,%esp
+  8001ee:	0f be 80 c8 26 80 00 	movsbl 0x8026c8(%eax),%eax
+  8001f5:	50                   	push   %eax
+  8001f6:	ff d7                	call   *%edi
+}
+  8001f8:	83 c4 10             	add    $0x10,%esp
+  8001fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fe:	5b                   	pop    %ebx
+  8001ff:	5e                   	pop    %esi
+  800200:	5f                   	pop    %edi
+  800201:	5d                   	pop    %ebp
+  800202:	c3                   	ret
+
+00800203 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800203:	55                   	push   %ebp
+  800204:	89 e5                	mov    %esp,%ebp
+  800206:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800209:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80020d:	8b 10                	mov    (%eax),%edx
+  80020f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800212:	73 0a                	jae    80021e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800214:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800217:	89 08                	mov    %ecx,(%eax)
+  800219:	8b 45 08             	mov    0x8(%ebp),%eax
+  80021c:	88 02                	mov    %al,(%edx)
+}
+  80021e:	5d                   	pop    %ebp
+  80021f:	c3                   	ret
+
+00800220 <printfmt>:
+{
+  800220:	55                   	push   %ebp
+  800221:	89 e5                	mov    %esp,%ebp
+  800223:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800226:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800229:	50                   	push   %eax
+  80022a:	ff 75 10             	push   0x10(%ebp)
+  80022d:	ff 75 0c             	push   0xc(%ebp)
+  800230:	ff 75 08             	push   0x8(%ebp)
+  800233:	e8 05 00 00 00       	call   80023d <vprintfmt>
+}
+  800238:	83 c4 10             	add    $0x10,%esp
+  80023b:	c9                   	leave
+  80023c:	c3                   	ret
+
+0080023d <vprintfmt>:
+{
+  80023d:	55                   	push   %ebp
+  80023e:	89 e5                	mov    %esp,%ebp
+  800240:	57                   	push   %edi
+  800241:	56                   	push   %esi
+  800242:	53                   	push   %ebx
+  800243:	83 ec 2c             	sub    $0x2c,%esp
+  800246:	8b 75 08             	mov    0x8(%ebp),%esi
+  800249:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80024c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80024f:	eb 0a                	jmp    80025b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800251:	83 ec 08             	sub    $0x8,%esp
+  800254:	53                   	push   %ebx
+  800255:	50                   	push   %eax
+  800256:	ff d6                	call   *%esi
+  800258:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80025b:	83 c7 01             	add    $0x1,%edi
+  80025e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800262:	83 f8 25             	cmp    $0x25,%eax
+  800265:	74 0c                	je     800273 <vprintfmt+0x36>
+			if (ch == '\0')
+  800267:	85 c0                	test   %eax,%eax
+  800269:	75 e6                	jne    800251 <vprintfmt+0x14>
+}
+  80026b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80026e:	5b                   	pop    %ebx
+  80026f:	5e                   	pop    %esi
+  800270:	5f                   	pop    %edi
+  800271:	5d                   	pop    %ebp
+  800272:	c3                   	ret
+		padc = ' ';
+  800273:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800277:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80027e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800285:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80028c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800291:	8d 47 01             	lea    0x1(%edi),%eax
+  800294:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800297:	0f b6 17             	movzbl (%edi),%edx
+  80029a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80029d:	3c 55                	cmp    $0x55,%al
+  80029f:	0f 87 c5 03 00 00    	ja     80066a <vprintfmt+0x42d>
+  8002a5:	0f b6 c0             	movzbl %al,%eax
+  8002a8:	ff 24 85 60 28 80 00 	jmp    *0x802860(,%eax,4)
+  8002af:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002b2:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002b6:	eb d9                	jmp    800291 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002b8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002bb:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002bf:	eb d0                	jmp    800291 <vprintfmt+0x54>
+  8002c1:	0f b6 d2             	movzbl %dl,%edx
+  8002c4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002cf:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002d2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002d6:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002d9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002dc:	83 f9 09             	cmp    $0x9,%ecx
+  8002df:	77 55                	ja     800336 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8002e1:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8002e4:	eb e9                	jmp    8002cf <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8002e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002e9:	8b 00                	mov    (%eax),%eax
+  8002eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8002f4:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8002f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8002fa:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8002fe:	79 91                	jns    800291 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800300:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800303:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800306:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80030d:	eb 82                	jmp    800291 <vprintfmt+0x54>
+			if (width < 0)
+  80030f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800312:	85 d2                	test   %edx,%edx
+  800314:	b8 00 00 00 00       	mov    $0x0,%eax
+  800319:	0f 49 c2             	cmovns %edx,%eax
+  80031c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80031f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800322:	e9 6a ff ff ff       	jmp    800291 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800327:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80032a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800331:	e9 5b ff ff ff       	jmp    800291 <vprintfmt+0x54>
+  800336:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800339:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80033c:	eb bc                	jmp    8002fa <vprintfmt+0xbd>
+			lflag++;
+  80033e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800341:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800344:	e9 48 ff ff ff       	jmp    800291 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800349:	8b 45 14             	mov    0x14(%ebp),%eax
+  80034c:	8d 78 04             	lea    0x4(%eax),%edi
+  80034f:	83 ec 08             	sub    $0x8,%esp
+  800352:	53                   	push   %ebx
+  800353:	ff 30                	push   (%eax)
+  800355:	ff d6                	call   *%esi
+			break;
+  800357:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80035a:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80035d:	e9 63 02 00 00       	jmp    8005c5 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800362:	8b 45 14             	mov    0x14(%ebp),%eax
+  800365:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800368:	8b 10                	mov    (%eax),%edx
+  80036a:	89 d0                	mov    %edx,%eax
+  80036c:	f7 d8                	neg    %eax
+  80036e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800371:	83 f8 12             	cmp    $0x12,%eax
+  800374:	7f 23                	jg     800399 <vprintfmt+0x15c>
+  800376:	8b 14 85 c0 29 80 00 	mov    0x8029c0(,%eax,4),%edx
+  80037d:	85 d2                	test   %edx,%edx
+  80037f:	74 18                	je     800399 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800381:	52                   	push   %edx
+  800382:	68 fd 2a 80 00       	push   $0x802afd
+  800387:	53                   	push   %ebx
+  800388:	56                   	push   %esi
+  800389:	e8 92 fe ff ff       	call   800220 <printfmt>
+  80038e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800391:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800394:	e9 2c 02 00 00       	jmp    8005c5 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  800399:	50                   	push   %eax
+  80039a:	68 e0 26 80 00       	push   $0x8026e0
+  80039f:	53                   	push   %ebx
+  8003a0:	56                   	push   %esi
+  8003a1:	e8 7a fe ff ff       	call   800220 <printfmt>
+  8003a6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003a9:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003ac:	e9 14 02 00 00       	jmp    8005c5 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b4:	83 c0 04             	add    $0x4,%eax
+  8003b7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bd:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003bf:	85 c9                	test   %ecx,%ecx
+  8003c1:	b8 d9 26 80 00       	mov    $0x8026d9,%eax
+  8003c6:	0f 45 c1             	cmovne %ecx,%eax
+  8003c9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003cc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d0:	7e 06                	jle    8003d8 <vprintfmt+0x19b>
+  8003d2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003d6:	75 0b                	jne    8003e3 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003d8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003db:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003de:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003e1:	eb 5c                	jmp    80043f <vprintfmt+0x202>
+  8003e3:	83 ec 08             	sub    $0x8,%esp
+  8003e6:	ff 75 d0             	push   -0x30(%ebp)
+  8003e9:	ff 75 cc             	push   -0x34(%ebp)
+  8003ec:	e8 19 03 00 00       	call   80070a <strnlen>
+  8003f1:	89 c2                	mov    %eax,%edx
+  8003f3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003f6:	29 d0                	sub    %edx,%eax
+  8003f8:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8003fb:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8003ff:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800402:	89 75 08             	mov    %esi,0x8(%ebp)
+  800405:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800407:	eb 0e                	jmp    800417 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800409:	83 ec 08             	sub    $0x8,%esp
+  80040c:	53                   	push   %ebx
+  80040d:	57                   	push   %edi
+  80040e:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800411:	83 ee 01             	sub    $0x1,%esi
+  800414:	83 c4 10             	add    $0x10,%esp
+  800417:	85 f6                	test   %esi,%esi
+  800419:	7f ee                	jg     800409 <vprintfmt+0x1cc>
+  80041b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80041e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800421:	85 c0                	test   %eax,%eax
+  800423:	ba 00 00 00 00       	mov    $0x0,%edx
+  800428:	0f 49 d0             	cmovns %eax,%edx
+  80042b:	29 d0                	sub    %edx,%eax
+  80042d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800430:	eb a6                	jmp    8003d8 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800432:	83 ec 08             	sub    $0x8,%esp
+  800435:	53                   	push   %ebx
+  800436:	52                   	push   %edx
+  800437:	ff 55 08             	call   *0x8(%ebp)
+  80043a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80043d:	89 f1                	mov    %esi,%ecx
+  80043f:	8d 71 01             	lea    0x1(%ecx),%esi
+  800442:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800446:	0f be d0             	movsbl %al,%edx
+  800449:	85 d2                	test   %edx,%edx
+  80044b:	74 28                	je     800475 <vprintfmt+0x238>
+  80044d:	85 ff                	test   %edi,%edi
+  80044f:	78 05                	js     800456 <vprintfmt+0x219>
+  800451:	83 ef 01             	sub    $0x1,%edi
+  800454:	78 30                	js     800486 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800456:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80045a:	74 d6                	je     800432 <vprintfmt+0x1f5>
+  80045c:	0f be c0             	movsbl %al,%eax
+  80045f:	83 e8 20             	sub    $0x20,%eax
+  800462:	83 f8 5e             	cmp    $0x5e,%eax
+  800465:	76 cb                	jbe    800432 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800467:	83 ec 08             	sub    $0x8,%esp
+  80046a:	53                   	push   %ebx
+  80046b:	6a 3f                	push   $0x3f
+  80046d:	ff 55 08             	call   *0x8(%ebp)
+  800470:	83 c4 10             	add    $0x10,%esp
+  800473:	eb c8                	jmp    80043d <vprintfmt+0x200>
+  800475:	8b 75 08             	mov    0x8(%ebp),%esi
+  800478:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80047b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80047e:	01 d0                	add    %edx,%eax
+  800480:	29 c8                	sub    %ecx,%eax
+  800482:	89 c7                	mov    %eax,%edi
+  800484:	eb 13                	jmp    800499 <vprintfmt+0x25c>
+  800486:	8b 75 08             	mov    0x8(%ebp),%esi
+  800489:	eb ed                	jmp    800478 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80048b:	83 ec 08             	sub    $0x8,%esp
+  80048e:	53                   	push   %ebx
+  80048f:	6a 20                	push   $0x20
+  800491:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800493:	83 ef 01             	sub    $0x1,%edi
+  800496:	83 c4 10             	add    $0x10,%esp
+  800499:	85 ff                	test   %edi,%edi
+  80049b:	7f ee                	jg     80048b <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80049d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004a0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004a3:	e9 1d 01 00 00       	jmp    8005c5 <vprintfmt+0x388>
+	if (lflag >= 2)
+  8004a8:	83 f9 01             	cmp    $0x1,%ecx
+  8004ab:	7f 1b                	jg     8004c8 <vprintfmt+0x28b>
+	else if (lflag)
+  8004ad:	85 c9                	test   %ecx,%ecx
+  8004af:	74 63                	je     800514 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  8004b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b4:	8b 00                	mov    (%eax),%eax
+  8004b6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004b9:	99                   	cltd
+  8004ba:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8004c3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004c6:	eb 17                	jmp    8004df <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  8004c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cb:	8b 50 04             	mov    0x4(%eax),%edx
+  8004ce:	8b 00                	mov    (%eax),%eax
+  8004d0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004d3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d9:	8d 40 08             	lea    0x8(%eax),%eax
+  8004dc:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8004df:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004e2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8004e5:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8004ea:	85 c9                	test   %ecx,%ecx
+  8004ec:	0f 89 b9 00 00 00    	jns    8005ab <vprintfmt+0x36e>
+				putch('-', putdat);
+  8004f2:	83 ec 08             	sub    $0x8,%esp
+  8004f5:	53                   	push   %ebx
+  8004f6:	6a 2d                	push   $0x2d
+  8004f8:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8004fa:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004fd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800500:	f7 da                	neg    %edx
+  800502:	83 d1 00             	adc    $0x0,%ecx
+  800505:	f7 d9                	neg    %ecx
+  800507:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80050a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80050f:	e9 97 00 00 00       	jmp    8005ab <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800514:	8b 45 14             	mov    0x14(%ebp),%eax
+  800517:	8b 00                	mov    (%eax),%eax
+  800519:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80051c:	99                   	cltd
+  80051d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800520:	8b 45 14             	mov    0x14(%ebp),%eax
+  800523:	8d 40 04             	lea    0x4(%eax),%eax
+  800526:	89 45 14             	mov    %eax,0x14(%ebp)
+  800529:	eb b4                	jmp    8004df <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  80052b:	83 f9 01             	cmp    $0x1,%ecx
+  80052e:	7f 1b                	jg     80054b <vprintfmt+0x30e>
+	else if (lflag)
+  800530:	85 c9                	test   %ecx,%ecx
+  800532:	74 2c                	je     800560 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800534:	8b 45 14             	mov    0x14(%ebp),%eax
+  800537:	8b 10                	mov    (%eax),%edx
+  800539:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80053e:	8d 40 04             	lea    0x4(%eax),%eax
+  800541:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800544:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800549:	eb 60                	jmp    8005ab <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80054b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054e:	8b 10                	mov    (%eax),%edx
+  800550:	8b 48 04             	mov    0x4(%eax),%ecx
+  800553:	8d 40 08             	lea    0x8(%eax),%eax
+  800556:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800559:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80055e:	eb 4b                	jmp    8005ab <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800560:	8b 45 14             	mov    0x14(%ebp),%eax
+  800563:	8b 10                	mov    (%eax),%edx
+  800565:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80056a:	8d 40 04             	lea    0x4(%eax),%eax
+  80056d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800570:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800575:	eb 34                	jmp    8005ab <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800577:	83 f9 01             	cmp    $0x1,%ecx
+  80057a:	7f 15                	jg     800591 <vprintfmt+0x354>
+	else if (lflag)
+  80057c:	85 c9                	test   %ecx,%ecx
+  80057e:	74 4d                	je     8005cd <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800580:	8b 45 14             	mov    0x14(%ebp),%eax
+  800583:	8b 00                	mov    (%eax),%eax
+  800585:	99                   	cltd
+  800586:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800589:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80058c:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80058f:	eb 11                	jmp    8005a2 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800591:	8b 45 14             	mov    0x14(%ebp),%eax
+  800594:	8b 50 04             	mov    0x4(%eax),%edx
+  800597:	8b 00                	mov    (%eax),%eax
+  800599:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80059c:	8d 49 08             	lea    0x8(%ecx),%ecx
+  80059f:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  8005a2:	89 d1                	mov    %edx,%ecx
+  8005a4:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  8005a6:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005ab:	83 ec 0c             	sub    $0xc,%esp
+  8005ae:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8005b2:	50                   	push   %eax
+  8005b3:	ff 75 e0             	push   -0x20(%ebp)
+  8005b6:	57                   	push   %edi
+  8005b7:	51                   	push   %ecx
+  8005b8:	52                   	push   %edx
+  8005b9:	89 da                	mov    %ebx,%edx
+  8005bb:	89 f0                	mov    %esi,%eax
+  8005bd:	e8 98 fb ff ff       	call   80015a <printnum>
+			break;
+  8005c2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8005c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005c8:	e9 8e fc ff ff       	jmp    80025b <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  8005cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d0:	8b 00                	mov    (%eax),%eax
+  8005d2:	99                   	cltd
+  8005d3:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005d6:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8005d9:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8005dc:	eb c4                	jmp    8005a2 <vprintfmt+0x365>
+			putch('0', putdat);
+  8005de:	83 ec 08             	sub    $0x8,%esp
+  8005e1:	53                   	push   %ebx
+  8005e2:	6a 30                	push   $0x30
+  8005e4:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005e6:	83 c4 08             	add    $0x8,%esp
+  8005e9:	53                   	push   %ebx
+  8005ea:	6a 78                	push   $0x78
+  8005ec:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f1:	8b 10                	mov    (%eax),%edx
+  8005f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005f8:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8005fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800601:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800606:	eb a3                	jmp    8005ab <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800608:	83 f9 01             	cmp    $0x1,%ecx
+  80060b:	7f 1b                	jg     800628 <vprintfmt+0x3eb>
+	else if (lflag)
+  80060d:	85 c9                	test   %ecx,%ecx
+  80060f:	74 2f                	je     800640 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800611:	8b 45 14             	mov    0x14(%ebp),%eax
+  800614:	8b 10                	mov    (%eax),%edx
+  800616:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80061b:	8d 40 04             	lea    0x4(%eax),%eax
+  80061e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800621:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800626:	eb 83                	jmp    8005ab <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800628:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062b:	8b 10                	mov    (%eax),%edx
+  80062d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800630:	8d 40 08             	lea    0x8(%eax),%eax
+  800633:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800636:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80063b:	e9 6b ff ff ff       	jmp    8005ab <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800640:	8b 45 14             	mov    0x14(%ebp),%eax
+  800643:	8b 10                	mov    (%eax),%edx
+  800645:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064a:	8d 40 04             	lea    0x4(%eax),%eax
+  80064d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800650:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800655:	e9 51 ff ff ff       	jmp    8005ab <vprintfmt+0x36e>
+			putch(ch, putdat);
+  80065a:	83 ec 08             	sub    $0x8,%esp
+  80065d:	53                   	push   %ebx
+  80065e:	6a 25                	push   $0x25
+  800660:	ff d6                	call   *%esi
+			break;
+  800662:	83 c4 10             	add    $0x10,%esp
+  800665:	e9 5b ff ff ff       	jmp    8005c5 <vprintfmt+0x388>
+			putch('%', putdat);
+  80066a:	83 ec 08             	sub    $0x8,%esp
+  80066d:	53                   	push   %ebx
+  80066e:	6a 25                	push   $0x25
+  800670:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800672:	83 c4 10             	add    $0x10,%esp
+  800675:	89 f8                	mov    %edi,%eax
+  800677:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80067b:	74 05                	je     800682 <vprintfmt+0x445>
+  80067d:	83 e8 01             	sub    $0x1,%eax
+  800680:	eb f5                	jmp    800677 <vprintfmt+0x43a>
+  800682:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800685:	e9 3b ff ff ff       	jmp    8005c5 <vprintfmt+0x388>
+
+0080068a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80068a:	55                   	push   %ebp
+  80068b:	89 e5                	mov    %esp,%ebp
+  80068d:	83 ec 18             	sub    $0x18,%esp
+  800690:	8b 45 08             	mov    0x8(%ebp),%eax
+  800693:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800696:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800699:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80069d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006a0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006a7:	85 c0                	test   %eax,%eax
+  8006a9:	74 26                	je     8006d1 <vsnprintf+0x47>
+  8006ab:	85 d2                	test   %edx,%edx
+  8006ad:	7e 22                	jle    8006d1 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006af:	ff 75 14             	push   0x14(%ebp)
+  8006b2:	ff 75 10             	push   0x10(%ebp)
+  8006b5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006b8:	50                   	push   %eax
+  8006b9:	68 03 02 80 00       	push   $0x800203
+  8006be:	e8 7a fb ff ff       	call   80023d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006c3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006c6:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006cc:	83 c4 10             	add    $0x10,%esp
+}
+  8006cf:	c9                   	leave
+  8006d0:	c3                   	ret
+		return -E_INVAL;
+  8006d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006d6:	eb f7                	jmp    8006cf <vsnprintf+0x45>
+
+008006d8 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006d8:	55                   	push   %ebp
+  8006d9:	89 e5                	mov    %esp,%ebp
+  8006db:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006de:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006e1:	50                   	push   %eax
+  8006e2:	ff 75 10             	push   0x10(%ebp)
+  8006e5:	ff 75 0c             	push   0xc(%ebp)
+  8006e8:	ff 75 08             	push   0x8(%ebp)
+  8006eb:	e8 9a ff ff ff       	call   80068a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8006f0:	c9                   	leave
+  8006f1:	c3                   	ret
+
+008006f2 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8006f2:	55                   	push   %ebp
+  8006f3:	89 e5                	mov    %esp,%ebp
+  8006f5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8006f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006fd:	eb 03                	jmp    800702 <strlen+0x10>
+		n++;
+  8006ff:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800702:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800706:	75 f7                	jne    8006ff <strlen+0xd>
+	return n;
+}
+  800708:	5d                   	pop    %ebp
+  800709:	c3                   	ret
+
+0080070a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80070a:	55                   	push   %ebp
+  80070b:	89 e5                	mov    %esp,%ebp
+  80070d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800710:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800713:	b8 00 00 00 00       	mov    $0x0,%eax
+  800718:	eb 03                	jmp    80071d <strnlen+0x13>
+		n++;
+  80071a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80071d:	39 d0                	cmp    %edx,%eax
+  80071f:	74 08                	je     800729 <strnlen+0x1f>
+  800721:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800725:	75 f3                	jne    80071a <strnlen+0x10>
+  800727:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800729:	89 d0                	mov    %edx,%eax
+  80072b:	5d                   	pop    %ebp
+  80072c:	c3                   	ret
+
+0080072d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80072d:	55                   	push   %ebp
+  80072e:	89 e5                	mov    %esp,%ebp
+  800730:	53                   	push   %ebx
+  800731:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800734:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800737:	b8 00 00 00 00       	mov    $0x0,%eax
+  80073c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800740:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800743:	83 c0 01             	add    $0x1,%eax
+  800746:	84 d2                	test   %dl,%dl
+  800748:	75 f2                	jne    80073c <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80074a:	89 c8                	mov    %ecx,%eax
+  80074c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80074f:	c9                   	leave
+  800750:	c3                   	ret
+
+00800751 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800751:	55                   	push   %ebp
+  800752:	89 e5                	mov    %esp,%ebp
+  800754:	53                   	push   %ebx
+  800755:	83 ec 10             	sub    $0x10,%esp
+  800758:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80075b:	53                   	push   %ebx
+  80075c:	e8 91 ff ff ff       	call   8006f2 <strlen>
+  800761:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800764:	ff 75 0c             	push   0xc(%ebp)
+  800767:	01 d8                	add    %ebx,%eax
+  800769:	50                   	push   %eax
+  80076a:	e8 be ff ff ff       	call   80072d <strcpy>
+	return dst;
+}
+  80076f:	89 d8                	mov    %ebx,%eax
+  800771:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800774:	c9                   	leave
+  800775:	c3                   	ret
+
+00800776 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800776:	55                   	push   %ebp
+  800777:	89 e5                	mov    %esp,%ebp
+  800779:	56                   	push   %esi
+  80077a:	53                   	push   %ebx
+  80077b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80077e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800781:	89 f3                	mov    %esi,%ebx
+  800783:	03 5d 10             	add    0x10(%ebp),%ebx
+  800786:	89 f0                	mov    %esi,%eax
+  800788:	eb 0f                	jmp    800799 <strncpy+0x23>
+		*dst++ = *src;
+  80078a:	83 c0 01             	add    $0x1,%eax
+  80078d:	0f b6 0a             	movzbl (%edx),%ecx
+  800790:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800793:	80 f9 01             	cmp    $0x1,%cl
+  800796:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800799:	39 d8                	cmp    %ebx,%eax
+  80079b:	75 ed                	jne    80078a <strncpy+0x14>
+	}
+	return ret;
+}
+  80079d:	89 f0                	mov    %esi,%eax
+  80079f:	5b                   	pop    %ebx
+  8007a0:	5e                   	pop    %esi
+  8007a1:	5d                   	pop    %ebp
+  8007a2:	c3                   	ret
+
+008007a3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007a3:	55                   	push   %ebp
+  8007a4:	89 e5                	mov    %esp,%ebp
+  8007a6:	56                   	push   %esi
+  8007a7:	53                   	push   %ebx
+  8007a8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007ae:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007b1:	89 f0                	mov    %esi,%eax
+  8007b3:	85 d2                	test   %edx,%edx
+  8007b5:	74 21                	je     8007d8 <strlcpy+0x35>
+  8007b7:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007bb:	89 f2                	mov    %esi,%edx
+  8007bd:	eb 09                	jmp    8007c8 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007bf:	83 c1 01             	add    $0x1,%ecx
+  8007c2:	83 c2 01             	add    $0x1,%edx
+  8007c5:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007c8:	39 c2                	cmp    %eax,%edx
+  8007ca:	74 09                	je     8007d5 <strlcpy+0x32>
+  8007cc:	0f b6 19             	movzbl (%ecx),%ebx
+  8007cf:	84 db                	test   %bl,%bl
+  8007d1:	75 ec                	jne    8007bf <strlcpy+0x1c>
+  8007d3:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007d5:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007d8:	29 f0                	sub    %esi,%eax
+}
+  8007da:	5b                   	pop    %ebx
+  8007db:	5e                   	pop    %esi
+  8007dc:	5d                   	pop    %ebp
+  8007dd:	c3                   	ret
+
+008007de <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007de:	55                   	push   %ebp
+  8007df:	89 e5                	mov    %esp,%ebp
+  8007e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007e7:	eb 06                	jmp    8007ef <strcmp+0x11>
+		p++, q++;
+  8007e9:	83 c1 01             	add    $0x1,%ecx
+  8007ec:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8007ef:	0f b6 01             	movzbl (%ecx),%eax
+  8007f2:	84 c0                	test   %al,%al
+  8007f4:	74 04                	je     8007fa <strcmp+0x1c>
+  8007f6:	3a 02                	cmp    (%edx),%al
+  8007f8:	74 ef                	je     8007e9 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8007fa:	0f b6 c0             	movzbl %al,%eax
+  8007fd:	0f b6 12             	movzbl (%edx),%edx
+  800800:	29 d0                	sub    %edx,%eax
+}
+  800802:	5d                   	pop    %ebp
+  800803:	c3                   	ret
+
+00800804 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800804:	55                   	push   %ebp
+  800805:	89 e5                	mov    %esp,%ebp
+  800807:	53                   	push   %ebx
+  800808:	8b 45 08             	mov    0x8(%ebp),%eax
+  80080b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80080e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800811:	eb 09                	jmp    80081c <strncmp+0x18>
+		n--, p++, q++;
+  800813:	83 ea 01             	sub    $0x1,%edx
+  800816:	83 c0 01             	add    $0x1,%eax
+  800819:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80081c:	85 d2                	test   %edx,%edx
+  80081e:	74 18                	je     800838 <strncmp+0x34>
+  800820:	0f b6 18             	movzbl (%eax),%ebx
+  800823:	84 db                	test   %bl,%bl
+  800825:	74 04                	je     80082b <strncmp+0x27>
+  800827:	3a 19                	cmp    (%ecx),%bl
+  800829:	74 e8                	je     800813 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80082b:	0f b6 00             	movzbl (%eax),%eax
+  80082e:	0f b6 11             	movzbl (%ecx),%edx
+  800831:	29 d0                	sub    %edx,%eax
+}
+  800833:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800836:	c9                   	leave
+  800837:	c3                   	ret
+		return 0;
+  800838:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083d:	eb f4                	jmp    800833 <strncmp+0x2f>
+
+0080083f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80083f:	55                   	push   %ebp
+  800840:	89 e5                	mov    %esp,%ebp
+  800842:	8b 45 08             	mov    0x8(%ebp),%eax
+  800845:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800849:	eb 03                	jmp    80084e <strchr+0xf>
+  80084b:	83 c0 01             	add    $0x1,%eax
+  80084e:	0f b6 10             	movzbl (%eax),%edx
+  800851:	84 d2                	test   %dl,%dl
+  800853:	74 06                	je     80085b <strchr+0x1c>
+		if (*s == c)
+  800855:	38 ca                	cmp    %cl,%dl
+  800857:	75 f2                	jne    80084b <strchr+0xc>
+  800859:	eb 05                	jmp    800860 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80085b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800860:	5d                   	pop    %ebp
+  800861:	c3                   	ret
+
+00800862 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800862:	55                   	push   %ebp
+  800863:	89 e5                	mov    %esp,%ebp
+  800865:	8b 45 08             	mov    0x8(%ebp),%eax
+  800868:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80086c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80086f:	38 ca                	cmp    %cl,%dl
+  800871:	74 09                	je     80087c <strfind+0x1a>
+  800873:	84 d2                	test   %dl,%dl
+  800875:	74 05                	je     80087c <strfind+0x1a>
+	for (; *s; s++)
+  800877:	83 c0 01             	add    $0x1,%eax
+  80087a:	eb f0                	jmp    80086c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80087c:	5d                   	pop    %ebp
+  80087d:	c3                   	ret
+
+0080087e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80087e:	55                   	push   %ebp
+  80087f:	89 e5                	mov    %esp,%ebp
+  800881:	57                   	push   %edi
+  800882:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800885:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800888:	85 c9                	test   %ecx,%ecx
+  80088a:	74 20                	je     8008ac <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80088c:	89 f8                	mov    %edi,%eax
+  80088e:	09 c8                	or     %ecx,%eax
+  800890:	a8 03                	test   $0x3,%al
+  800892:	75 12                	jne    8008a6 <memset+0x28>
+		c &= 0xFF;
+  800894:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800898:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80089e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008a1:	fc                   	cld
+  8008a2:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008a4:	eb 06                	jmp    8008ac <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008a9:	fc                   	cld
+  8008aa:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008ac:	89 f8                	mov    %edi,%eax
+  8008ae:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008b1:	c9                   	leave
+  8008b2:	c3                   	ret
+
+008008b3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008b3:	55                   	push   %ebp
+  8008b4:	89 e5                	mov    %esp,%ebp
+  8008b6:	57                   	push   %edi
+  8008b7:	56                   	push   %esi
+  8008b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008be:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008c1:	39 c6                	cmp    %eax,%esi
+  8008c3:	73 32                	jae    8008f7 <memmove+0x44>
+  8008c5:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008c8:	39 d0                	cmp    %edx,%eax
+  8008ca:	73 2b                	jae    8008f7 <memmove+0x44>
+		s += n;
+		d += n;
+  8008cc:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008cf:	89 d6                	mov    %edx,%esi
+  8008d1:	09 fe                	or     %edi,%esi
+  8008d3:	09 ce                	or     %ecx,%esi
+  8008d5:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008db:	75 0e                	jne    8008eb <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008dd:	83 ef 04             	sub    $0x4,%edi
+  8008e0:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008e3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008e6:	fd                   	std
+  8008e7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008e9:	eb 09                	jmp    8008f4 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008eb:	83 ef 01             	sub    $0x1,%edi
+  8008ee:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8008f1:	fd                   	std
+  8008f2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8008f4:	fc                   	cld
+  8008f5:	eb 1a                	jmp    800911 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008f7:	89 f2                	mov    %esi,%edx
+  8008f9:	09 c2                	or     %eax,%edx
+  8008fb:	09 ca                	or     %ecx,%edx
+  8008fd:	f6 c2 03             	test   $0x3,%dl
+  800900:	75 0a                	jne    80090c <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800902:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800905:	89 c7                	mov    %eax,%edi
+  800907:	fc                   	cld
+  800908:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80090a:	eb 05                	jmp    800911 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80090c:	89 c7                	mov    %eax,%edi
+  80090e:	fc                   	cld
+  80090f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800911:	5e                   	pop    %esi
+  800912:	5f                   	pop    %edi
+  800913:	5d                   	pop    %ebp
+  800914:	c3                   	ret
+
+00800915 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800915:	55                   	push   %ebp
+  800916:	89 e5                	mov    %esp,%ebp
+  800918:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80091b:	ff 75 10             	push   0x10(%ebp)
+  80091e:	ff 75 0c             	push   0xc(%ebp)
+  800921:	ff 75 08             	push   0x8(%ebp)
+  800924:	e8 8a ff ff ff       	call   8008b3 <memmove>
+}
+  800929:	c9                   	leave
+  80092a:	c3                   	ret
+
+0080092b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80092b:	55                   	push   %ebp
+  80092c:	89 e5                	mov    %esp,%ebp
+  80092e:	56                   	push   %esi
+  80092f:	53                   	push   %ebx
+  800930:	8b 45 08             	mov    0x8(%ebp),%eax
+  800933:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800936:	89 c6                	mov    %eax,%esi
+  800938:	03 75 10             	add    0x10(%ebp),%esi
+  80093b:	eb 06                	jmp    800943 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80093d:	83 c0 01             	add    $0x1,%eax
+  800940:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800943:	39 f0                	cmp    %esi,%eax
+  800945:	74 14                	je     80095b <memcmp+0x30>
+		if (*s1 != *s2)
+  800947:	0f b6 08             	movzbl (%eax),%ecx
+  80094a:	0f b6 1a             	movzbl (%edx),%ebx
+  80094d:	38 d9                	cmp    %bl,%cl
+  80094f:	74 ec                	je     80093d <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800951:	0f b6 c1             	movzbl %cl,%eax
+  800954:	0f b6 db             	movzbl %bl,%ebx
+  800957:	29 d8                	sub    %ebx,%eax
+  800959:	eb 05                	jmp    800960 <memcmp+0x35>
+	}
+
+	return 0;
+  80095b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800960:	5b                   	pop    %ebx
+  800961:	5e                   	pop    %esi
+  800962:	5d                   	pop    %ebp
+  800963:	c3                   	ret
+
+00800964 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800964:	55                   	push   %ebp
+  800965:	89 e5                	mov    %esp,%ebp
+  800967:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80096d:	89 c2                	mov    %eax,%edx
+  80096f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800972:	eb 03                	jmp    800977 <memfind+0x13>
+  800974:	83 c0 01             	add    $0x1,%eax
+  800977:	39 d0                	cmp    %edx,%eax
+  800979:	73 04                	jae    80097f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80097b:	38 08                	cmp    %cl,(%eax)
+  80097d:	75 f5                	jne    800974 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80097f:	5d                   	pop    %ebp
+  800980:	c3                   	ret
+
+00800981 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800981:	55                   	push   %ebp
+  800982:	89 e5                	mov    %esp,%ebp
+  800984:	57                   	push   %edi
+  800985:	56                   	push   %esi
+  800986:	53                   	push   %ebx
+  800987:	8b 55 08             	mov    0x8(%ebp),%edx
+  80098a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80098d:	eb 03                	jmp    800992 <strtol+0x11>
+		s++;
+  80098f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800992:	0f b6 02             	movzbl (%edx),%eax
+  800995:	3c 20                	cmp    $0x20,%al
+  800997:	74 f6                	je     80098f <strtol+0xe>
+  800999:	3c 09                	cmp    $0x9,%al
+  80099b:	74 f2                	je     80098f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  80099d:	3c 2b                	cmp    $0x2b,%al
+  80099f:	74 2a                	je     8009cb <strtol+0x4a>
+	int neg = 0;
+  8009a1:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009a6:	3c 2d                	cmp    $0x2d,%al
+  8009a8:	74 2b                	je     8009d5 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009aa:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009b0:	75 0f                	jne    8009c1 <strtol+0x40>
+  8009b2:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009b5:	74 28                	je     8009df <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009b7:	85 db                	test   %ebx,%ebx
+  8009b9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009be:	0f 44 d8             	cmove  %eax,%ebx
+  8009c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009c6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009c9:	eb 46                	jmp    800a11 <strtol+0x90>
+		s++;
+  8009cb:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d3:	eb d5                	jmp    8009aa <strtol+0x29>
+		s++, neg = 1;
+  8009d5:	83 c2 01             	add    $0x1,%edx
+  8009d8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009dd:	eb cb                	jmp    8009aa <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009df:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009e3:	74 0e                	je     8009f3 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009e5:	85 db                	test   %ebx,%ebx
+  8009e7:	75 d8                	jne    8009c1 <strtol+0x40>
+		s++, base = 8;
+  8009e9:	83 c2 01             	add    $0x1,%edx
+  8009ec:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8009f1:	eb ce                	jmp    8009c1 <strtol+0x40>
+		s += 2, base = 16;
+  8009f3:	83 c2 02             	add    $0x2,%edx
+  8009f6:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8009fb:	eb c4                	jmp    8009c1 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8009fd:	0f be c0             	movsbl %al,%eax
+  800a00:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a03:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a06:	7d 3a                	jge    800a42 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a08:	83 c2 01             	add    $0x1,%edx
+  800a0b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a0f:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a11:	0f b6 02             	movzbl (%edx),%eax
+  800a14:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a17:	89 f3                	mov    %esi,%ebx
+  800a19:	80 fb 09             	cmp    $0x9,%bl
+  800a1c:	76 df                	jbe    8009fd <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a1e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a21:	89 f3                	mov    %esi,%ebx
+  800a23:	80 fb 19             	cmp    $0x19,%bl
+  800a26:	77 08                	ja     800a30 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a28:	0f be c0             	movsbl %al,%eax
+  800a2b:	83 e8 57             	sub    $0x57,%eax
+  800a2e:	eb d3                	jmp    800a03 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a30:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a33:	89 f3                	mov    %esi,%ebx
+  800a35:	80 fb 19             	cmp    $0x19,%bl
+  800a38:	77 08                	ja     800a42 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a3a:	0f be c0             	movsbl %al,%eax
+  800a3d:	83 e8 37             	sub    $0x37,%eax
+  800a40:	eb c1                	jmp    800a03 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a42:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a46:	74 05                	je     800a4d <strtol+0xcc>
+		*endptr = (char *) s;
+  800a48:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a4b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a4d:	89 c8                	mov    %ecx,%eax
+  800a4f:	f7 d8                	neg    %eax
+  800a51:	85 ff                	test   %edi,%edi
+  800a53:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a56:	89 c8                	mov    %ecx,%eax
+  800a58:	5b                   	pop    %ebx
+  800a59:	5e                   	pop    %esi
+  800a5a:	5f                   	pop    %edi
+  800a5b:	5d                   	pop    %ebp
+  800a5c:	c3                   	ret
+
+00800a5d <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800a5d:	55                   	push   %ebp
+  800a5e:	89 e5                	mov    %esp,%ebp
+  800a60:	57                   	push   %edi
+  800a61:	56                   	push   %esi
+  800a62:	53                   	push   %ebx
+  800a63:	83 ec 0c             	sub    $0xc,%esp
+  800a66:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a69:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a6c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800a6f:	85 ff                	test   %edi,%edi
+  800a71:	74 16                	je     800a89 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800a73:	83 ec 04             	sub    $0x4,%esp
+  800a76:	56                   	push   %esi
+  800a77:	6a 00                	push   $0x0
+  800a79:	53                   	push   %ebx
+  800a7a:	e8 02 ff ff ff       	call   800981 <strtol>
+  800a7f:	89 07                	mov    %eax,(%edi)
+  800a81:	83 c4 10             	add    $0x10,%esp
+  800a84:	eb 03                	jmp    800a89 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800a86:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800a89:	0f b6 03             	movzbl (%ebx),%eax
+  800a8c:	3c 20                	cmp    $0x20,%al
+  800a8e:	74 f6                	je     800a86 <strisl+0x29>
+  800a90:	3c 09                	cmp    $0x9,%al
+  800a92:	74 f2                	je     800a86 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a94:	3c 2b                	cmp    $0x2b,%al
+  800a96:	74 23                	je     800abb <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800a98:	3c 2d                	cmp    $0x2d,%al
+  800a9a:	0f 94 c0             	sete   %al
+  800a9d:	0f b6 c0             	movzbl %al,%eax
+  800aa0:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aa2:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800aa8:	75 41                	jne    800aeb <strisl+0x8e>
+  800aaa:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800aad:	74 11                	je     800ac0 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800aaf:	85 f6                	test   %esi,%esi
+  800ab1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ab6:	0f 44 f0             	cmove  %eax,%esi
+  800ab9:	eb 30                	jmp    800aeb <strisl+0x8e>
+		s++;
+  800abb:	83 c3 01             	add    $0x1,%ebx
+  800abe:	eb e2                	jmp    800aa2 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ac0:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800ac4:	74 0e                	je     800ad4 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800ac6:	85 f6                	test   %esi,%esi
+  800ac8:	75 21                	jne    800aeb <strisl+0x8e>
+		s++, base = 8;
+  800aca:	83 c3 01             	add    $0x1,%ebx
+  800acd:	be 08 00 00 00       	mov    $0x8,%esi
+  800ad2:	eb 17                	jmp    800aeb <strisl+0x8e>
+		s += 2, base = 16;
+  800ad4:	83 c3 02             	add    $0x2,%ebx
+  800ad7:	be 10 00 00 00       	mov    $0x10,%esi
+  800adc:	eb 0d                	jmp    800aeb <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ade:	0f be c0             	movsbl %al,%eax
+  800ae1:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800ae4:	39 f0                	cmp    %esi,%eax
+  800ae6:	7d 38                	jge    800b20 <strisl+0xc3>
+			return 0;
+		s++;
+  800ae8:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800aeb:	0f b6 03             	movzbl (%ebx),%eax
+  800aee:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800af1:	80 fa 09             	cmp    $0x9,%dl
+  800af4:	76 e8                	jbe    800ade <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800af6:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800af9:	80 fa 19             	cmp    $0x19,%dl
+  800afc:	77 08                	ja     800b06 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800afe:	0f be c0             	movsbl %al,%eax
+  800b01:	83 e8 57             	sub    $0x57,%eax
+  800b04:	eb de                	jmp    800ae4 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b06:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800b09:	80 fa 19             	cmp    $0x19,%dl
+  800b0c:	77 08                	ja     800b16 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800b0e:	0f be c0             	movsbl %al,%eax
+  800b11:	83 e8 37             	sub    $0x37,%eax
+  800b14:	eb ce                	jmp    800ae4 <strisl+0x87>
+		else if (!*s)
+  800b16:	84 c0                	test   %al,%al
+  800b18:	0f 94 c0             	sete   %al
+  800b1b:	0f b6 c0             	movzbl %al,%eax
+  800b1e:	eb 05                	jmp    800b25 <strisl+0xc8>
+			return 0;
+  800b20:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800b25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b28:	5b                   	pop    %ebx
+  800b29:	5e                   	pop    %esi
+  800b2a:	5f                   	pop    %edi
+  800b2b:	5d                   	pop    %ebp
+  800b2c:	c3                   	ret
+
+00800b2d <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800b2d:	55                   	push   %ebp
+  800b2e:	89 e5                	mov    %esp,%ebp
+  800b30:	83 ec 10             	sub    $0x10,%esp
+  800b33:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800b36:	89 c8                	mov    %ecx,%eax
+  800b38:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800b3d:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800b40:	eb 0b                	jmp    800b4d <touch_mem+0x20>
+		c = *(char *)page;
+  800b42:	0f b6 10             	movzbl (%eax),%edx
+  800b45:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800b48:	05 00 10 00 00       	add    $0x1000,%eax
+  800b4d:	39 c8                	cmp    %ecx,%eax
+  800b4f:	72 f1                	jb     800b42 <touch_mem+0x15>
+}
+  800b51:	c9                   	leave
+  800b52:	c3                   	ret
+
+00800b53 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b53:	55                   	push   %ebp
+  800b54:	89 e5                	mov    %esp,%ebp
+  800b56:	57                   	push   %edi
+  800b57:	56                   	push   %esi
+  800b58:	53                   	push   %ebx
+	touch_mem(s, len);
+  800b59:	ff 75 0c             	push   0xc(%ebp)
+  800b5c:	ff 75 08             	push   0x8(%ebp)
+  800b5f:	e8 c9 ff ff ff       	call   800b2d <touch_mem>
+	asm volatile("int %1\n"
+  800b64:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b6f:	89 c3                	mov    %eax,%ebx
+  800b71:	89 c7                	mov    %eax,%edi
+  800b73:	89 c6                	mov    %eax,%esi
+  800b75:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b77:	83 c4 08             	add    $0x8,%esp
+  800b7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b7d:	5b                   	pop    %ebx
+  800b7e:	5e                   	pop    %esi
+  800b7f:	5f                   	pop    %edi
+  800b80:	5d                   	pop    %ebp
+  800b81:	c3                   	ret
+
+00800b82 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	57                   	push   %edi
+  800b86:	56                   	push   %esi
+  800b87:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b88:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b8d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b92:	89 d1                	mov    %edx,%ecx
+  800b94:	89 d3                	mov    %edx,%ebx
+  800b96:	89 d7                	mov    %edx,%edi
+  800b98:	89 d6                	mov    %edx,%esi
+  800b9a:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b9c:	5b                   	pop    %ebx
+  800b9d:	5e                   	pop    %esi
+  800b9e:	5f                   	pop    %edi
+  800b9f:	5d                   	pop    %ebp
+  800ba0:	c3                   	ret
+
+00800ba1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ba1:	55                   	push   %ebp
+  800ba2:	89 e5                	mov    %esp,%ebp
+  800ba4:	57                   	push   %edi
+  800ba5:	56                   	push   %esi
+  800ba6:	53                   	push   %ebx
+  800ba7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800baa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800baf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb2:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bb7:	89 cb                	mov    %ecx,%ebx
+  800bb9:	89 cf                	mov    %ecx,%edi
+  800bbb:	89 ce                	mov    %ecx,%esi
+  800bbd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bbf:	85 c0                	test   %eax,%eax
+  800bc1:	7f 08                	jg     800bcb <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc6:	5b                   	pop    %ebx
+  800bc7:	5e                   	pop    %esi
+  800bc8:	5f                   	pop    %edi
+  800bc9:	5d                   	pop    %ebp
+  800bca:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bcb:	83 ec 0c             	sub    $0xc,%esp
+  800bce:	50                   	push   %eax
+  800bcf:	6a 03                	push   $0x3
+  800bd1:	68 2b 2a 80 00       	push   $0x802a2b
+  800bd6:	6a 23                	push   $0x23
+  800bd8:	68 48 2a 80 00       	push   $0x802a48
+  800bdd:	e8 b9 15 00 00       	call   80219b <_panic>
+
+00800be2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800be2:	55                   	push   %ebp
+  800be3:	89 e5                	mov    %esp,%ebp
+  800be5:	57                   	push   %edi
+  800be6:	56                   	push   %esi
+  800be7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800be8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bed:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bf2:	89 d1                	mov    %edx,%ecx
+  800bf4:	89 d3                	mov    %edx,%ebx
+  800bf6:	89 d7                	mov    %edx,%edi
+  800bf8:	89 d6                	mov    %edx,%esi
+  800bfa:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bfc:	5b                   	pop    %ebx
+  800bfd:	5e                   	pop    %esi
+  800bfe:	5f                   	pop    %edi
+  800bff:	5d                   	pop    %ebp
+  800c00:	c3                   	ret
+
+00800c01 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c01:	55                   	push   %ebp
+  800c02:	89 e5                	mov    %esp,%ebp
+  800c04:	57                   	push   %edi
+  800c05:	56                   	push   %esi
+  800c06:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c07:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c11:	89 d1                	mov    %edx,%ecx
+  800c13:	89 d3                	mov    %edx,%ebx
+  800c15:	89 d7                	mov    %edx,%edi
+  800c17:	89 d6                	mov    %edx,%esi
+  800c19:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c1b:	5b                   	pop    %ebx
+  800c1c:	5e                   	pop    %esi
+  800c1d:	5f                   	pop    %edi
+  800c1e:	5d                   	pop    %ebp
+  800c1f:	c3                   	ret
+
+00800c20 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c20:	55                   	push   %ebp
+  800c21:	89 e5                	mov    %esp,%ebp
+  800c23:	57                   	push   %edi
+  800c24:	56                   	push   %esi
+  800c25:	53                   	push   %ebx
+  800c26:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c29:	be 00 00 00 00       	mov    $0x0,%esi
+  800c2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c34:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c3c:	89 f7                	mov    %esi,%edi
+  800c3e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c40:	85 c0                	test   %eax,%eax
+  800c42:	7f 08                	jg     800c4c <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c47:	5b                   	pop    %ebx
+  800c48:	5e                   	pop    %esi
+  800c49:	5f                   	pop    %edi
+  800c4a:	5d                   	pop    %ebp
+  800c4b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c4c:	83 ec 0c             	sub    $0xc,%esp
+  800c4f:	50                   	push   %eax
+  800c50:	6a 04                	push   $0x4
+  800c52:	68 2b 2a 80 00       	push   $0x802a2b
+  800c57:	6a 23                	push   $0x23
+  800c59:	68 48 2a 80 00       	push   $0x802a48
+  800c5e:	e8 38 15 00 00       	call   80219b <_panic>
+
+00800c63 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c63:	55                   	push   %ebp
+  800c64:	89 e5                	mov    %esp,%ebp
+  800c66:	57                   	push   %edi
+  800c67:	56                   	push   %esi
+  800c68:	53                   	push   %ebx
+  800c69:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c72:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c7a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c7d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c80:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c82:	85 c0                	test   %eax,%eax
+  800c84:	7f 08                	jg     800c8e <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c89:	5b                   	pop    %ebx
+  800c8a:	5e                   	pop    %esi
+  800c8b:	5f                   	pop    %edi
+  800c8c:	5d                   	pop    %ebp
+  800c8d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c8e:	83 ec 0c             	sub    $0xc,%esp
+  800c91:	50                   	push   %eax
+  800c92:	6a 05                	push   $0x5
+  800c94:	68 2b 2a 80 00       	push   $0x802a2b
+  800c99:	6a 23                	push   $0x23
+  800c9b:	68 48 2a 80 00       	push   $0x802a48
+  800ca0:	e8 f6 14 00 00       	call   80219b <_panic>
+
+00800ca5 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ca5:	55                   	push   %ebp
+  800ca6:	89 e5                	mov    %esp,%ebp
+  800ca8:	57                   	push   %edi
+  800ca9:	56                   	push   %esi
+  800caa:	53                   	push   %ebx
+  800cab:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb9:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cbe:	89 df                	mov    %ebx,%edi
+  800cc0:	89 de                	mov    %ebx,%esi
+  800cc2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cc4:	85 c0                	test   %eax,%eax
+  800cc6:	7f 08                	jg     800cd0 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800cc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ccb:	5b                   	pop    %ebx
+  800ccc:	5e                   	pop    %esi
+  800ccd:	5f                   	pop    %edi
+  800cce:	5d                   	pop    %ebp
+  800ccf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cd0:	83 ec 0c             	sub    $0xc,%esp
+  800cd3:	50                   	push   %eax
+  800cd4:	6a 06                	push   $0x6
+  800cd6:	68 2b 2a 80 00       	push   $0x802a2b
+  800cdb:	6a 23                	push   $0x23
+  800cdd:	68 48 2a 80 00       	push   $0x802a48
+  800ce2:	e8 b4 14 00 00       	call   80219b <_panic>
+
+00800ce7 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800ce7:	55                   	push   %ebp
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	57                   	push   %edi
+  800ceb:	56                   	push   %esi
+  800cec:	53                   	push   %ebx
+  800ced:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cf0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cf5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cfb:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d00:	89 df                	mov    %ebx,%edi
+  800d02:	89 de                	mov    %ebx,%esi
+  800d04:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d06:	85 c0                	test   %eax,%eax
+  800d08:	7f 08                	jg     800d12 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0d:	5b                   	pop    %ebx
+  800d0e:	5e                   	pop    %esi
+  800d0f:	5f                   	pop    %edi
+  800d10:	5d                   	pop    %ebp
+  800d11:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d12:	83 ec 0c             	sub    $0xc,%esp
+  800d15:	50                   	push   %eax
+  800d16:	6a 18                	push   $0x18
+  800d18:	68 2b 2a 80 00       	push   $0x802a2b
+  800d1d:	6a 23                	push   $0x23
+  800d1f:	68 48 2a 80 00       	push   $0x802a48
+  800d24:	e8 72 14 00 00       	call   80219b <_panic>
+
+00800d29 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	57                   	push   %edi
+  800d2d:	56                   	push   %esi
+  800d2e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d2f:	be 00 00 00 00       	mov    $0x0,%esi
+  800d34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3a:	b8 19 00 00 00       	mov    $0x19,%eax
+  800d3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d42:	89 f7                	mov    %esi,%edi
+  800d44:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800d46:	5b                   	pop    %ebx
+  800d47:	5e                   	pop    %esi
+  800d48:	5f                   	pop    %edi
+  800d49:	5d                   	pop    %ebp
+  800d4a:	c3                   	ret
+
+00800d4b <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d4b:	55                   	push   %ebp
+  800d4c:	89 e5                	mov    %esp,%ebp
+  800d4e:	57                   	push   %edi
+  800d4f:	56                   	push   %esi
+  800d50:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d57:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d5c:	be 00 00 00 00       	mov    $0x0,%esi
+  800d61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d64:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d67:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800d69:	5b                   	pop    %ebx
+  800d6a:	5e                   	pop    %esi
+  800d6b:	5f                   	pop    %edi
+  800d6c:	5d                   	pop    %ebp
+  800d6d:	c3                   	ret
+
+00800d6e <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800d6e:	55                   	push   %ebp
+  800d6f:	89 e5                	mov    %esp,%ebp
+  800d71:	57                   	push   %edi
+  800d72:	56                   	push   %esi
+  800d73:	53                   	push   %ebx
+  800d74:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800d77:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800d7a:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800d80:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800d83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d89:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d91:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d94:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d96:	85 c0                	test   %eax,%eax
+  800d98:	7f 08                	jg     800da2 <sys_page_map_range+0x34>
+}
+  800d9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9d:	5b                   	pop    %ebx
+  800d9e:	5e                   	pop    %esi
+  800d9f:	5f                   	pop    %edi
+  800da0:	5d                   	pop    %ebp
+  800da1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da2:	83 ec 0c             	sub    $0xc,%esp
+  800da5:	50                   	push   %eax
+  800da6:	6a 10                	push   $0x10
+  800da8:	68 2b 2a 80 00       	push   $0x802a2b
+  800dad:	6a 23                	push   $0x23
+  800daf:	68 48 2a 80 00       	push   $0x802a48
+  800db4:	e8 e2 13 00 00       	call   80219b <_panic>
+
+00800db9 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800db9:	55                   	push   %ebp
+  800dba:	89 e5                	mov    %esp,%ebp
+  800dbc:	57                   	push   %edi
+  800dbd:	56                   	push   %esi
+  800dbe:	53                   	push   %ebx
+  800dbf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dc2:	be 00 00 00 00       	mov    $0x0,%esi
+  800dc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcd:	b8 11 00 00 00       	mov    $0x11,%eax
+  800dd2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd5:	89 f7                	mov    %esi,%edi
+  800dd7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dd9:	85 c0                	test   %eax,%eax
+  800ddb:	7f 08                	jg     800de5 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ddd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de0:	5b                   	pop    %ebx
+  800de1:	5e                   	pop    %esi
+  800de2:	5f                   	pop    %edi
+  800de3:	5d                   	pop    %ebp
+  800de4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de5:	83 ec 0c             	sub    $0xc,%esp
+  800de8:	50                   	push   %eax
+  800de9:	6a 11                	push   $0x11
+  800deb:	68 2b 2a 80 00       	push   $0x802a2b
+  800df0:	6a 23                	push   $0x23
+  800df2:	68 48 2a 80 00       	push   $0x802a48
+  800df7:	e8 9f 13 00 00       	call   80219b <_panic>
+
+00800dfc <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800dfc:	55                   	push   %ebp
+  800dfd:	89 e5                	mov    %esp,%ebp
+  800dff:	57                   	push   %edi
+  800e00:	56                   	push   %esi
+  800e01:	53                   	push   %ebx
+  800e02:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e05:	be 00 00 00 00       	mov    $0x0,%esi
+  800e0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e10:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800e15:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e18:	89 f7                	mov    %esi,%edi
+  800e1a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e1c:	85 c0                	test   %eax,%eax
+  800e1e:	7f 08                	jg     800e28 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e23:	5b                   	pop    %ebx
+  800e24:	5e                   	pop    %esi
+  800e25:	5f                   	pop    %edi
+  800e26:	5d                   	pop    %ebp
+  800e27:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e28:	83 ec 0c             	sub    $0xc,%esp
+  800e2b:	50                   	push   %eax
+  800e2c:	6a 1b                	push   $0x1b
+  800e2e:	68 2b 2a 80 00       	push   $0x802a2b
+  800e33:	6a 23                	push   $0x23
+  800e35:	68 48 2a 80 00       	push   $0x802a48
+  800e3a:	e8 5c 13 00 00       	call   80219b <_panic>
+
+00800e3f <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800e3f:	55                   	push   %ebp
+  800e40:	89 e5                	mov    %esp,%ebp
+  800e42:	57                   	push   %edi
+  800e43:	56                   	push   %esi
+  800e44:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4a:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e4f:	89 d1                	mov    %edx,%ecx
+  800e51:	89 d3                	mov    %edx,%ebx
+  800e53:	89 d7                	mov    %edx,%edi
+  800e55:	89 d6                	mov    %edx,%esi
+  800e57:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800e59:	5b                   	pop    %ebx
+  800e5a:	5e                   	pop    %esi
+  800e5b:	5f                   	pop    %edi
+  800e5c:	5d                   	pop    %ebp
+  800e5d:	c3                   	ret
+
+00800e5e <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e5e:	55                   	push   %ebp
+  800e5f:	89 e5                	mov    %esp,%ebp
+  800e61:	57                   	push   %edi
+  800e62:	56                   	push   %esi
+  800e63:	53                   	push   %ebx
+  800e64:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e72:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e77:	89 df                	mov    %ebx,%edi
+  800e79:	89 de                	mov    %ebx,%esi
+  800e7b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e7d:	85 c0                	test   %eax,%eax
+  800e7f:	7f 08                	jg     800e89 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e84:	5b                   	pop    %ebx
+  800e85:	5e                   	pop    %esi
+  800e86:	5f                   	pop    %edi
+  800e87:	5d                   	pop    %ebp
+  800e88:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e89:	83 ec 0c             	sub    $0xc,%esp
+  800e8c:	50                   	push   %eax
+  800e8d:	6a 08                	push   $0x8
+  800e8f:	68 2b 2a 80 00       	push   $0x802a2b
+  800e94:	6a 23                	push   $0x23
+  800e96:	68 48 2a 80 00       	push   $0x802a48
+  800e9b:	e8 fb 12 00 00       	call   80219b <_panic>
+
+00800ea0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ea0:	55                   	push   %ebp
+  800ea1:	89 e5                	mov    %esp,%ebp
+  800ea3:	57                   	push   %edi
+  800ea4:	56                   	push   %esi
+  800ea5:	53                   	push   %ebx
+  800ea6:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800ea9:	6a 44                	push   $0x44
+  800eab:	ff 75 0c             	push   0xc(%ebp)
+  800eae:	e8 7a fc ff ff       	call   800b2d <touch_mem>
+	asm volatile("int %1\n"
+  800eb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebb:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ec0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec3:	89 df                	mov    %ebx,%edi
+  800ec5:	89 de                	mov    %ebx,%esi
+  800ec7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec9:	83 c4 08             	add    $0x8,%esp
+  800ecc:	85 c0                	test   %eax,%eax
+  800ece:	7f 08                	jg     800ed8 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ed0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed3:	5b                   	pop    %ebx
+  800ed4:	5e                   	pop    %esi
+  800ed5:	5f                   	pop    %edi
+  800ed6:	5d                   	pop    %ebp
+  800ed7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed8:	83 ec 0c             	sub    $0xc,%esp
+  800edb:	50                   	push   %eax
+  800edc:	6a 09                	push   $0x9
+  800ede:	68 2b 2a 80 00       	push   $0x802a2b
+  800ee3:	6a 23                	push   $0x23
+  800ee5:	68 48 2a 80 00       	push   $0x802a48
+  800eea:	e8 ac 12 00 00       	call   80219b <_panic>
+
+00800eef <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800eef:	55                   	push   %ebp
+  800ef0:	89 e5                	mov    %esp,%ebp
+  800ef2:	57                   	push   %edi
+  800ef3:	56                   	push   %esi
+  800ef4:	53                   	push   %ebx
+  800ef5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ef8:	be 00 00 00 00       	mov    $0x0,%esi
+  800efd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f03:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800f08:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f0b:	89 f7                	mov    %esi,%edi
+  800f0d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0f:	85 c0                	test   %eax,%eax
+  800f11:	7f 08                	jg     800f1b <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800f13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f16:	5b                   	pop    %ebx
+  800f17:	5e                   	pop    %esi
+  800f18:	5f                   	pop    %edi
+  800f19:	5d                   	pop    %ebp
+  800f1a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f1b:	83 ec 0c             	sub    $0xc,%esp
+  800f1e:	50                   	push   %eax
+  800f1f:	6a 1a                	push   $0x1a
+  800f21:	68 2b 2a 80 00       	push   $0x802a2b
+  800f26:	6a 23                	push   $0x23
+  800f28:	68 48 2a 80 00       	push   $0x802a48
+  800f2d:	e8 69 12 00 00       	call   80219b <_panic>
+
+00800f32 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  800f32:	55                   	push   %ebp
+  800f33:	89 e5                	mov    %esp,%ebp
+  800f35:	57                   	push   %edi
+  800f36:	56                   	push   %esi
+  800f37:	53                   	push   %ebx
+  800f38:	83 ec 0c             	sub    $0xc,%esp
+  800f3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  800f3e:	89 d8                	mov    %ebx,%eax
+  800f40:	c1 e0 05             	shl    $0x5,%eax
+  800f43:	50                   	push   %eax
+  800f44:	ff 75 0c             	push   0xc(%ebp)
+  800f47:	e8 e1 fb ff ff       	call   800b2d <touch_mem>
+	asm volatile("int %1\n"
+  800f4c:	be 00 00 00 00       	mov    $0x0,%esi
+  800f51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f54:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5c:	89 f7                	mov    %esi,%edi
+  800f5e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f60:	83 c4 08             	add    $0x8,%esp
+  800f63:	85 c0                	test   %eax,%eax
+  800f65:	7f 08                	jg     800f6f <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  800f67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f6a:	5b                   	pop    %ebx
+  800f6b:	5e                   	pop    %esi
+  800f6c:	5f                   	pop    %edi
+  800f6d:	5d                   	pop    %ebp
+  800f6e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6f:	83 ec 0c             	sub    $0xc,%esp
+  800f72:	50                   	push   %eax
+  800f73:	6a 13                	push   $0x13
+  800f75:	68 2b 2a 80 00       	push   $0x802a2b
+  800f7a:	6a 23                	push   $0x23
+  800f7c:	68 48 2a 80 00       	push   $0x802a48
+  800f81:	e8 15 12 00 00       	call   80219b <_panic>
+
+00800f86 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f86:	55                   	push   %ebp
+  800f87:	89 e5                	mov    %esp,%ebp
+  800f89:	57                   	push   %edi
+  800f8a:	56                   	push   %esi
+  800f8b:	53                   	push   %ebx
+  800f8c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f9f:	89 df                	mov    %ebx,%edi
+  800fa1:	89 de                	mov    %ebx,%esi
+  800fa3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa5:	85 c0                	test   %eax,%eax
+  800fa7:	7f 08                	jg     800fb1 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fa9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fac:	5b                   	pop    %ebx
+  800fad:	5e                   	pop    %esi
+  800fae:	5f                   	pop    %edi
+  800faf:	5d                   	pop    %ebp
+  800fb0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb1:	83 ec 0c             	sub    $0xc,%esp
+  800fb4:	50                   	push   %eax
+  800fb5:	6a 0a                	push   $0xa
+  800fb7:	68 2b 2a 80 00       	push   $0x802a2b
+  800fbc:	6a 23                	push   $0x23
+  800fbe:	68 48 2a 80 00       	push   $0x802a48
+  800fc3:	e8 d3 11 00 00       	call   80219b <_panic>
+
+00800fc8 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fc8:	55                   	push   %ebp
+  800fc9:	89 e5                	mov    %esp,%ebp
+  800fcb:	57                   	push   %edi
+  800fcc:	56                   	push   %esi
+  800fcd:	53                   	push   %ebx
+  800fce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  800fd1:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800fd7:	76 1d                	jbe    800ff6 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdf:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fe4:	be 01 00 00 00       	mov    $0x1,%esi
+  800fe9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fec:	cd 30                	int    $0x30
+}
+  800fee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff1:	5b                   	pop    %ebx
+  800ff2:	5e                   	pop    %esi
+  800ff3:	5f                   	pop    %edi
+  800ff4:	5d                   	pop    %ebp
+  800ff5:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  800ff6:	68 00 10 00 00       	push   $0x1000
+  800ffb:	53                   	push   %ebx
+  800ffc:	e8 2c fb ff ff       	call   800b2d <touch_mem>
+  801001:	83 c4 08             	add    $0x8,%esp
+  801004:	eb d3                	jmp    800fd9 <sys_ipc_send+0x11>
+
+00801006 <sys_ipc_send_pages>:
+{
+  801006:	55                   	push   %ebp
+  801007:	89 e5                	mov    %esp,%ebp
+  801009:	57                   	push   %edi
+  80100a:	56                   	push   %esi
+  80100b:	53                   	push   %ebx
+  80100c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80100f:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801012:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801018:	76 18                	jbe    801032 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80101a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801020:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801025:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801028:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  80102a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80102d:	5b                   	pop    %ebx
+  80102e:	5e                   	pop    %esi
+  80102f:	5f                   	pop    %edi
+  801030:	5d                   	pop    %ebp
+  801031:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801032:	89 f0                	mov    %esi,%eax
+  801034:	c1 e0 0c             	shl    $0xc,%eax
+  801037:	50                   	push   %eax
+  801038:	53                   	push   %ebx
+  801039:	e8 ef fa ff ff       	call   800b2d <touch_mem>
+  80103e:	83 c4 08             	add    $0x8,%esp
+  801041:	eb d7                	jmp    80101a <sys_ipc_send_pages+0x14>
+
+00801043 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801043:	55                   	push   %ebp
+  801044:	89 e5                	mov    %esp,%ebp
+  801046:	57                   	push   %edi
+  801047:	56                   	push   %esi
+  801048:	53                   	push   %ebx
+  801049:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80104c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801051:	8b 55 08             	mov    0x8(%ebp),%edx
+  801054:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801057:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80105c:	89 df                	mov    %ebx,%edi
+  80105e:	89 de                	mov    %ebx,%esi
+  801060:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801062:	85 c0                	test   %eax,%eax
+  801064:	7f 08                	jg     80106e <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801066:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801069:	5b                   	pop    %ebx
+  80106a:	5e                   	pop    %esi
+  80106b:	5f                   	pop    %edi
+  80106c:	5d                   	pop    %ebp
+  80106d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106e:	83 ec 0c             	sub    $0xc,%esp
+  801071:	50                   	push   %eax
+  801072:	6a 0d                	push   $0xd
+  801074:	68 2b 2a 80 00       	push   $0x802a2b
+  801079:	6a 23                	push   $0x23
+  80107b:	68 48 2a 80 00       	push   $0x802a48
+  801080:	e8 16 11 00 00       	call   80219b <_panic>
+
+00801085 <sys_ipc_recv>:
+{
+  801085:	55                   	push   %ebp
+  801086:	89 e5                	mov    %esp,%ebp
+  801088:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80108b:	6a 01                	push   $0x1
+  80108d:	ff 75 08             	push   0x8(%ebp)
+  801090:	e8 ae ff ff ff       	call   801043 <sys_ipc_recv_pages>
+}
+  801095:	c9                   	leave
+  801096:	c3                   	ret
+
+00801097 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801097:	55                   	push   %ebp
+  801098:	89 e5                	mov    %esp,%ebp
+  80109a:	57                   	push   %edi
+  80109b:	56                   	push   %esi
+  80109c:	53                   	push   %ebx
+  80109d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010a3:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  8010a6:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010ac:	77 04                	ja     8010b2 <sys_ipc_call+0x1b>
+  8010ae:	85 f6                	test   %esi,%esi
+  8010b0:	75 15                	jne    8010c7 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8010b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b8:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010bd:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8010bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c2:	5b                   	pop    %ebx
+  8010c3:	5e                   	pop    %esi
+  8010c4:	5f                   	pop    %edi
+  8010c5:	5d                   	pop    %ebp
+  8010c6:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8010c7:	89 f8                	mov    %edi,%eax
+  8010c9:	c1 e0 0c             	shl    $0xc,%eax
+  8010cc:	50                   	push   %eax
+  8010cd:	53                   	push   %ebx
+  8010ce:	e8 5a fa ff ff       	call   800b2d <touch_mem>
+  8010d3:	83 c4 08             	add    $0x8,%esp
+  8010d6:	eb da                	jmp    8010b2 <sys_ipc_call+0x1b>
+
+008010d8 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8010d8:	55                   	push   %ebp
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	57                   	push   %edi
+  8010dc:	56                   	push   %esi
+  8010dd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e4:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ef:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010f2:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8010f4:	5b                   	pop    %ebx
+  8010f5:	5e                   	pop    %esi
+  8010f6:	5f                   	pop    %edi
+  8010f7:	5d                   	pop    %ebp
+  8010f8:	c3                   	ret
+
+008010f9 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8010f9:	55                   	push   %ebp
+  8010fa:	89 e5                	mov    %esp,%ebp
+  8010fc:	57                   	push   %edi
+  8010fd:	56                   	push   %esi
+  8010fe:	53                   	push   %ebx
+  8010ff:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801102:	6a 04                	push   $0x4
+  801104:	ff 75 08             	push   0x8(%ebp)
+  801107:	e8 21 fa ff ff       	call   800b2d <touch_mem>
+	asm volatile("int %1\n"
+  80110c:	be 00 00 00 00       	mov    $0x0,%esi
+  801111:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801114:	b8 16 00 00 00       	mov    $0x16,%eax
+  801119:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80111f:	89 f7                	mov    %esi,%edi
+  801121:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801123:	83 c4 08             	add    $0x8,%esp
+  801126:	85 c0                	test   %eax,%eax
+  801128:	7f 08                	jg     801132 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  80112a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112d:	5b                   	pop    %ebx
+  80112e:	5e                   	pop    %esi
+  80112f:	5f                   	pop    %edi
+  801130:	5d                   	pop    %ebp
+  801131:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801132:	83 ec 0c             	sub    $0xc,%esp
+  801135:	50                   	push   %eax
+  801136:	6a 16                	push   $0x16
+  801138:	68 2b 2a 80 00       	push   $0x802a2b
+  80113d:	6a 23                	push   $0x23
+  80113f:	68 48 2a 80 00       	push   $0x802a48
+  801144:	e8 52 10 00 00       	call   80219b <_panic>
+
+00801149 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+  80114c:	57                   	push   %edi
+  80114d:	56                   	push   %esi
+  80114e:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  80114f:	6a 04                	push   $0x4
+  801151:	ff 75 08             	push   0x8(%ebp)
+  801154:	e8 d4 f9 ff ff       	call   800b2d <touch_mem>
+	asm volatile("int %1\n"
+  801159:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801161:	b8 17 00 00 00       	mov    $0x17,%eax
+  801166:	8b 55 08             	mov    0x8(%ebp),%edx
+  801169:	89 df                	mov    %ebx,%edi
+  80116b:	89 de                	mov    %ebx,%esi
+  80116d:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80116f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801172:	5b                   	pop    %ebx
+  801173:	5e                   	pop    %esi
+  801174:	5f                   	pop    %edi
+  801175:	5d                   	pop    %ebp
+  801176:	c3                   	ret
+
+00801177 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  801177:	55                   	push   %ebp
+  801178:	89 e5                	mov    %esp,%ebp
+  80117a:	57                   	push   %edi
+  80117b:	56                   	push   %esi
+  80117c:	53                   	push   %ebx
+  80117d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801180:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801185:	8b 55 08             	mov    0x8(%ebp),%edx
+  801188:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80118d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801192:	89 df                	mov    %ebx,%edi
+  801194:	89 de                	mov    %ebx,%esi
+  801196:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801198:	85 c0                	test   %eax,%eax
+  80119a:	7f 08                	jg     8011a4 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80119c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80119f:	5b                   	pop    %ebx
+  8011a0:	5e                   	pop    %esi
+  8011a1:	5f                   	pop    %edi
+  8011a2:	5d                   	pop    %ebp
+  8011a3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a4:	83 ec 0c             	sub    $0xc,%esp
+  8011a7:	50                   	push   %eax
+  8011a8:	6a 0e                	push   $0xe
+  8011aa:	68 2b 2a 80 00       	push   $0x802a2b
+  8011af:	6a 23                	push   $0x23
+  8011b1:	68 48 2a 80 00       	push   $0x802a48
+  8011b6:	e8 e0 0f 00 00       	call   80219b <_panic>
+
+008011bb <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8011bb:	55                   	push   %ebp
+  8011bc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011c1:	05 00 00 00 30       	add    $0x30000000,%eax
+  8011c6:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8011c9:	5d                   	pop    %ebp
+  8011ca:	c3                   	ret
+
+008011cb <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8011cb:	55                   	push   %ebp
+  8011cc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d1:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8011d6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011db:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8011e0:	5d                   	pop    %ebp
+  8011e1:	c3                   	ret
+
+008011e2 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8011e2:	55                   	push   %ebp
+  8011e3:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8011e5:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8011ea:	a8 01                	test   $0x1,%al
+  8011ec:	74 3c                	je     80122a <fd_alloc+0x48>
+  8011ee:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8011f3:	89 c2                	mov    %eax,%edx
+  8011f5:	c1 ea 0c             	shr    $0xc,%edx
+  8011f8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011ff:	89 c1                	mov    %eax,%ecx
+  801201:	05 00 10 00 00       	add    $0x1000,%eax
+  801206:	f6 c2 01             	test   $0x1,%dl
+  801209:	74 13                	je     80121e <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80120b:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801210:	75 e1                	jne    8011f3 <fd_alloc+0x11>
+  801212:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801217:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80121c:	eb 05                	jmp    801223 <fd_alloc+0x41>
+			return 0;
+  80121e:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801223:	8b 55 08             	mov    0x8(%ebp),%edx
+  801226:	89 0a                	mov    %ecx,(%edx)
+}
+  801228:	5d                   	pop    %ebp
+  801229:	c3                   	ret
+  80122a:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  80122f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801234:	eb ed                	jmp    801223 <fd_alloc+0x41>
+
+00801236 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801236:	55                   	push   %ebp
+  801237:	89 e5                	mov    %esp,%ebp
+  801239:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80123c:	83 f8 1f             	cmp    $0x1f,%eax
+  80123f:	77 30                	ja     801271 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801241:	c1 e0 0c             	shl    $0xc,%eax
+  801244:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801249:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80124f:	f6 c2 01             	test   $0x1,%dl
+  801252:	74 24                	je     801278 <fd_lookup+0x42>
+  801254:	89 c2                	mov    %eax,%edx
+  801256:	c1 ea 0c             	shr    $0xc,%edx
+  801259:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801260:	f6 c2 01             	test   $0x1,%dl
+  801263:	74 1a                	je     80127f <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801265:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801268:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80126a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80126f:	5d                   	pop    %ebp
+  801270:	c3                   	ret
+		return -E_INVAL;
+  801271:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801276:	eb f7                	jmp    80126f <fd_lookup+0x39>
+		return -E_INVAL;
+  801278:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80127d:	eb f0                	jmp    80126f <fd_lookup+0x39>
+  80127f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801284:	eb e9                	jmp    80126f <fd_lookup+0x39>
+
+00801286 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801286:	55                   	push   %ebp
+  801287:	89 e5                	mov    %esp,%ebp
+  801289:	53                   	push   %ebx
+  80128a:	83 ec 04             	sub    $0x4,%esp
+  80128d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801290:	b8 d4 2a 80 00       	mov    $0x802ad4,%eax
+  801295:	8b 18                	mov    (%eax),%ebx
+  801297:	85 db                	test   %ebx,%ebx
+  801299:	74 0e                	je     8012a9 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  80129b:	83 c0 04             	add    $0x4,%eax
+  80129e:	39 13                	cmp    %edx,(%ebx)
+  8012a0:	75 f3                	jne    801295 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  8012a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a7:	eb 1f                	jmp    8012c8 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8012a9:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012ae:	8b 40 48             	mov    0x48(%eax),%eax
+  8012b1:	83 ec 04             	sub    $0x4,%esp
+  8012b4:	52                   	push   %edx
+  8012b5:	50                   	push   %eax
+  8012b6:	68 58 2a 80 00       	push   $0x802a58
+  8012bb:	e8 86 ee ff ff       	call   800146 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8012c0:	83 c4 10             	add    $0x10,%esp
+  8012c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8012c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012cb:	89 1a                	mov    %ebx,(%edx)
+}
+  8012cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012d0:	c9                   	leave
+  8012d1:	c3                   	ret
+
+008012d2 <fd_close>:
+{
+  8012d2:	55                   	push   %ebp
+  8012d3:	89 e5                	mov    %esp,%ebp
+  8012d5:	57                   	push   %edi
+  8012d6:	56                   	push   %esi
+  8012d7:	53                   	push   %ebx
+  8012d8:	83 ec 24             	sub    $0x24,%esp
+  8012db:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012de:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012e1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012e4:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012e5:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8012eb:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012ee:	50                   	push   %eax
+  8012ef:	e8 42 ff ff ff       	call   801236 <fd_lookup>
+  8012f4:	89 c3                	mov    %eax,%ebx
+  8012f6:	83 c4 10             	add    $0x10,%esp
+  8012f9:	85 c0                	test   %eax,%eax
+  8012fb:	78 05                	js     801302 <fd_close+0x30>
+	    || fd != fd2)
+  8012fd:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801300:	74 16                	je     801318 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801302:	89 f8                	mov    %edi,%eax
+  801304:	84 c0                	test   %al,%al
+  801306:	b8 00 00 00 00       	mov    $0x0,%eax
+  80130b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80130e:	89 d8                	mov    %ebx,%eax
+  801310:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801313:	5b                   	pop    %ebx
+  801314:	5e                   	pop    %esi
+  801315:	5f                   	pop    %edi
+  801316:	5d                   	pop    %ebp
+  801317:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801318:	83 ec 08             	sub    $0x8,%esp
+  80131b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80131e:	50                   	push   %eax
+  80131f:	ff 36                	push   (%esi)
+  801321:	e8 60 ff ff ff       	call   801286 <dev_lookup>
+  801326:	89 c3                	mov    %eax,%ebx
+  801328:	83 c4 10             	add    $0x10,%esp
+  80132b:	85 c0                	test   %eax,%eax
+  80132d:	78 1a                	js     801349 <fd_close+0x77>
+		if (dev->dev_close)
+  80132f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801332:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801335:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80133a:	85 c0                	test   %eax,%eax
+  80133c:	74 0b                	je     801349 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80133e:	83 ec 0c             	sub    $0xc,%esp
+  801341:	56                   	push   %esi
+  801342:	ff d0                	call   *%eax
+  801344:	89 c3                	mov    %eax,%ebx
+  801346:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801349:	83 ec 08             	sub    $0x8,%esp
+  80134c:	56                   	push   %esi
+  80134d:	6a 00                	push   $0x0
+  80134f:	e8 51 f9 ff ff       	call   800ca5 <sys_page_unmap>
+	return r;
+  801354:	83 c4 10             	add    $0x10,%esp
+  801357:	eb b5                	jmp    80130e <fd_close+0x3c>
+
+00801359 <close>:
+
+int
+close(int fdnum)
+{
+  801359:	55                   	push   %ebp
+  80135a:	89 e5                	mov    %esp,%ebp
+  80135c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80135f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801362:	50                   	push   %eax
+  801363:	ff 75 08             	push   0x8(%ebp)
+  801366:	e8 cb fe ff ff       	call   801236 <fd_lookup>
+  80136b:	83 c4 10             	add    $0x10,%esp
+  80136e:	85 c0                	test   %eax,%eax
+  801370:	79 02                	jns    801374 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801372:	c9                   	leave
+  801373:	c3                   	ret
+		return fd_close(fd, 1);
+  801374:	83 ec 08             	sub    $0x8,%esp
+  801377:	6a 01                	push   $0x1
+  801379:	ff 75 f4             	push   -0xc(%ebp)
+  80137c:	e8 51 ff ff ff       	call   8012d2 <fd_close>
+  801381:	83 c4 10             	add    $0x10,%esp
+  801384:	eb ec                	jmp    801372 <close+0x19>
+
+00801386 <close_all>:
+
+void
+close_all(void)
+{
+  801386:	55                   	push   %ebp
+  801387:	89 e5                	mov    %esp,%ebp
+  801389:	53                   	push   %ebx
+  80138a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80138d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801392:	83 ec 0c             	sub    $0xc,%esp
+  801395:	53                   	push   %ebx
+  801396:	e8 be ff ff ff       	call   801359 <close>
+	for (i = 0; i < MAXFD; i++)
+  80139b:	83 c3 01             	add    $0x1,%ebx
+  80139e:	83 c4 10             	add    $0x10,%esp
+  8013a1:	83 fb 20             	cmp    $0x20,%ebx
+  8013a4:	75 ec                	jne    801392 <close_all+0xc>
+}
+  8013a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013a9:	c9                   	leave
+  8013aa:	c3                   	ret
+
+008013ab <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8013ab:	55                   	push   %ebp
+  8013ac:	89 e5                	mov    %esp,%ebp
+  8013ae:	57                   	push   %edi
+  8013af:	56                   	push   %esi
+  8013b0:	53                   	push   %ebx
+  8013b1:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8013b4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013b7:	50                   	push   %eax
+  8013b8:	ff 75 08             	push   0x8(%ebp)
+  8013bb:	e8 76 fe ff ff       	call   801236 <fd_lookup>
+  8013c0:	89 c3                	mov    %eax,%ebx
+  8013c2:	83 c4 10             	add    $0x10,%esp
+  8013c5:	85 c0                	test   %eax,%eax
+  8013c7:	78 7f                	js     801448 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8013c9:	83 ec 0c             	sub    $0xc,%esp
+  8013cc:	ff 75 0c             	push   0xc(%ebp)
+  8013cf:	e8 85 ff ff ff       	call   801359 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8013d4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013d7:	c1 e6 0c             	shl    $0xc,%esi
+  8013da:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8013e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8013e3:	89 3c 24             	mov    %edi,(%esp)
+  8013e6:	e8 e0 fd ff ff       	call   8011cb <fd2data>
+  8013eb:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8013ed:	89 34 24             	mov    %esi,(%esp)
+  8013f0:	e8 d6 fd ff ff       	call   8011cb <fd2data>
+  8013f5:	83 c4 10             	add    $0x10,%esp
+  8013f8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8013fb:	89 d8                	mov    %ebx,%eax
+  8013fd:	c1 e8 16             	shr    $0x16,%eax
+  801400:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801407:	a8 01                	test   $0x1,%al
+  801409:	74 11                	je     80141c <dup+0x71>
+  80140b:	89 d8                	mov    %ebx,%eax
+  80140d:	c1 e8 0c             	shr    $0xc,%eax
+  801410:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801417:	f6 c2 01             	test   $0x1,%dl
+  80141a:	75 36                	jne    801452 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80141c:	89 f8                	mov    %edi,%eax
+  80141e:	c1 e8 0c             	shr    $0xc,%eax
+  801421:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801428:	83 ec 0c             	sub    $0xc,%esp
+  80142b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801430:	50                   	push   %eax
+  801431:	56                   	push   %esi
+  801432:	6a 00                	push   $0x0
+  801434:	57                   	push   %edi
+  801435:	6a 00                	push   $0x0
+  801437:	e8 27 f8 ff ff       	call   800c63 <sys_page_map>
+  80143c:	89 c3                	mov    %eax,%ebx
+  80143e:	83 c4 20             	add    $0x20,%esp
+  801441:	85 c0                	test   %eax,%eax
+  801443:	78 33                	js     801478 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801445:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801448:	89 d8                	mov    %ebx,%eax
+  80144a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144d:	5b                   	pop    %ebx
+  80144e:	5e                   	pop    %esi
+  80144f:	5f                   	pop    %edi
+  801450:	5d                   	pop    %ebp
+  801451:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801452:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801459:	83 ec 0c             	sub    $0xc,%esp
+  80145c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801461:	50                   	push   %eax
+  801462:	ff 75 d4             	push   -0x2c(%ebp)
+  801465:	6a 00                	push   $0x0
+  801467:	53                   	push   %ebx
+  801468:	6a 00                	push   $0x0
+  80146a:	e8 f4 f7 ff ff       	call   800c63 <sys_page_map>
+  80146f:	89 c3                	mov    %eax,%ebx
+  801471:	83 c4 20             	add    $0x20,%esp
+  801474:	85 c0                	test   %eax,%eax
+  801476:	79 a4                	jns    80141c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801478:	83 ec 08             	sub    $0x8,%esp
+  80147b:	56                   	push   %esi
+  80147c:	6a 00                	push   $0x0
+  80147e:	e8 22 f8 ff ff       	call   800ca5 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801483:	83 c4 08             	add    $0x8,%esp
+  801486:	ff 75 d4             	push   -0x2c(%ebp)
+  801489:	6a 00                	push   $0x0
+  80148b:	e8 15 f8 ff ff       	call   800ca5 <sys_page_unmap>
+	return r;
+  801490:	83 c4 10             	add    $0x10,%esp
+  801493:	eb b3                	jmp    801448 <dup+0x9d>
+
+00801495 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801495:	55                   	push   %ebp
+  801496:	89 e5                	mov    %esp,%ebp
+  801498:	56                   	push   %esi
+  801499:	53                   	push   %ebx
+  80149a:	83 ec 18             	sub    $0x18,%esp
+  80149d:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014a0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014a3:	50                   	push   %eax
+  8014a4:	56                   	push   %esi
+  8014a5:	e8 8c fd ff ff       	call   801236 <fd_lookup>
+  8014aa:	83 c4 10             	add    $0x10,%esp
+  8014ad:	85 c0                	test   %eax,%eax
+  8014af:	78 3c                	js     8014ed <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014b1:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014b4:	83 ec 08             	sub    $0x8,%esp
+  8014b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014ba:	50                   	push   %eax
+  8014bb:	ff 33                	push   (%ebx)
+  8014bd:	e8 c4 fd ff ff       	call   801286 <dev_lookup>
+  8014c2:	83 c4 10             	add    $0x10,%esp
+  8014c5:	85 c0                	test   %eax,%eax
+  8014c7:	78 24                	js     8014ed <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014c9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8014cc:	83 e0 03             	and    $0x3,%eax
+  8014cf:	83 f8 01             	cmp    $0x1,%eax
+  8014d2:	74 20                	je     8014f4 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8014d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014d7:	8b 40 08             	mov    0x8(%eax),%eax
+  8014da:	85 c0                	test   %eax,%eax
+  8014dc:	74 37                	je     801515 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8014de:	83 ec 04             	sub    $0x4,%esp
+  8014e1:	ff 75 10             	push   0x10(%ebp)
+  8014e4:	ff 75 0c             	push   0xc(%ebp)
+  8014e7:	53                   	push   %ebx
+  8014e8:	ff d0                	call   *%eax
+  8014ea:	83 c4 10             	add    $0x10,%esp
+}
+  8014ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014f0:	5b                   	pop    %ebx
+  8014f1:	5e                   	pop    %esi
+  8014f2:	5d                   	pop    %ebp
+  8014f3:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014f4:	a1 08 40 80 00       	mov    0x804008,%eax
+  8014f9:	8b 40 48             	mov    0x48(%eax),%eax
+  8014fc:	83 ec 04             	sub    $0x4,%esp
+  8014ff:	56                   	push   %esi
+  801500:	50                   	push   %eax
+  801501:	68 99 2a 80 00       	push   $0x802a99
+  801506:	e8 3b ec ff ff       	call   800146 <cprintf>
+		return -E_INVAL;
+  80150b:	83 c4 10             	add    $0x10,%esp
+  80150e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801513:	eb d8                	jmp    8014ed <read+0x58>
+		return -E_NOT_SUPP;
+  801515:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80151a:	eb d1                	jmp    8014ed <read+0x58>
+
+0080151c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80151c:	55                   	push   %ebp
+  80151d:	89 e5                	mov    %esp,%ebp
+  80151f:	57                   	push   %edi
+  801520:	56                   	push   %esi
+  801521:	53                   	push   %ebx
+  801522:	83 ec 0c             	sub    $0xc,%esp
+  801525:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801528:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80152b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801530:	eb 02                	jmp    801534 <readn+0x18>
+  801532:	01 c3                	add    %eax,%ebx
+  801534:	39 f3                	cmp    %esi,%ebx
+  801536:	73 21                	jae    801559 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801538:	83 ec 04             	sub    $0x4,%esp
+  80153b:	89 f0                	mov    %esi,%eax
+  80153d:	29 d8                	sub    %ebx,%eax
+  80153f:	50                   	push   %eax
+  801540:	89 d8                	mov    %ebx,%eax
+  801542:	03 45 0c             	add    0xc(%ebp),%eax
+  801545:	50                   	push   %eax
+  801546:	57                   	push   %edi
+  801547:	e8 49 ff ff ff       	call   801495 <read>
+		if (m < 0)
+  80154c:	83 c4 10             	add    $0x10,%esp
+  80154f:	85 c0                	test   %eax,%eax
+  801551:	78 04                	js     801557 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801553:	75 dd                	jne    801532 <readn+0x16>
+  801555:	eb 02                	jmp    801559 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801557:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801559:	89 d8                	mov    %ebx,%eax
+  80155b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80155e:	5b                   	pop    %ebx
+  80155f:	5e                   	pop    %esi
+  801560:	5f                   	pop    %edi
+  801561:	5d                   	pop    %ebp
+  801562:	c3                   	ret
+
+00801563 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801563:	55                   	push   %ebp
+  801564:	89 e5                	mov    %esp,%ebp
+  801566:	56                   	push   %esi
+  801567:	53                   	push   %ebx
+  801568:	83 ec 18             	sub    $0x18,%esp
+  80156b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80156e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801571:	50                   	push   %eax
+  801572:	53                   	push   %ebx
+  801573:	e8 be fc ff ff       	call   801236 <fd_lookup>
+  801578:	83 c4 10             	add    $0x10,%esp
+  80157b:	85 c0                	test   %eax,%eax
+  80157d:	78 37                	js     8015b6 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80157f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801582:	83 ec 08             	sub    $0x8,%esp
+  801585:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801588:	50                   	push   %eax
+  801589:	ff 36                	push   (%esi)
+  80158b:	e8 f6 fc ff ff       	call   801286 <dev_lookup>
+  801590:	83 c4 10             	add    $0x10,%esp
+  801593:	85 c0                	test   %eax,%eax
+  801595:	78 1f                	js     8015b6 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801597:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80159b:	74 20                	je     8015bd <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80159d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015a0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015a3:	85 c0                	test   %eax,%eax
+  8015a5:	74 37                	je     8015de <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8015a7:	83 ec 04             	sub    $0x4,%esp
+  8015aa:	ff 75 10             	push   0x10(%ebp)
+  8015ad:	ff 75 0c             	push   0xc(%ebp)
+  8015b0:	56                   	push   %esi
+  8015b1:	ff d0                	call   *%eax
+  8015b3:	83 c4 10             	add    $0x10,%esp
+}
+  8015b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015b9:	5b                   	pop    %ebx
+  8015ba:	5e                   	pop    %esi
+  8015bb:	5d                   	pop    %ebp
+  8015bc:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015bd:	a1 08 40 80 00       	mov    0x804008,%eax
+  8015c2:	8b 40 48             	mov    0x48(%eax),%eax
+  8015c5:	83 ec 04             	sub    $0x4,%esp
+  8015c8:	53                   	push   %ebx
+  8015c9:	50                   	push   %eax
+  8015ca:	68 b5 2a 80 00       	push   $0x802ab5
+  8015cf:	e8 72 eb ff ff       	call   800146 <cprintf>
+		return -E_INVAL;
+  8015d4:	83 c4 10             	add    $0x10,%esp
+  8015d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015dc:	eb d8                	jmp    8015b6 <write+0x53>
+		return -E_NOT_SUPP;
+  8015de:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015e3:	eb d1                	jmp    8015b6 <write+0x53>
+
+008015e5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015e5:	55                   	push   %ebp
+  8015e6:	89 e5                	mov    %esp,%ebp
+  8015e8:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015ee:	50                   	push   %eax
+  8015ef:	ff 75 08             	push   0x8(%ebp)
+  8015f2:	e8 3f fc ff ff       	call   801236 <fd_lookup>
+  8015f7:	83 c4 10             	add    $0x10,%esp
+  8015fa:	85 c0                	test   %eax,%eax
+  8015fc:	78 0e                	js     80160c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8015fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801601:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801604:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801607:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80160c:	c9                   	leave
+  80160d:	c3                   	ret
+
+0080160e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80160e:	55                   	push   %ebp
+  80160f:	89 e5                	mov    %esp,%ebp
+  801611:	56                   	push   %esi
+  801612:	53                   	push   %ebx
+  801613:	83 ec 18             	sub    $0x18,%esp
+  801616:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801619:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80161c:	50                   	push   %eax
+  80161d:	53                   	push   %ebx
+  80161e:	e8 13 fc ff ff       	call   801236 <fd_lookup>
+  801623:	83 c4 10             	add    $0x10,%esp
+  801626:	85 c0                	test   %eax,%eax
+  801628:	78 34                	js     80165e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80162a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80162d:	83 ec 08             	sub    $0x8,%esp
+  801630:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801633:	50                   	push   %eax
+  801634:	ff 36                	push   (%esi)
+  801636:	e8 4b fc ff ff       	call   801286 <dev_lookup>
+  80163b:	83 c4 10             	add    $0x10,%esp
+  80163e:	85 c0                	test   %eax,%eax
+  801640:	78 1c                	js     80165e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801642:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801646:	74 1d                	je     801665 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801648:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80164b:	8b 40 18             	mov    0x18(%eax),%eax
+  80164e:	85 c0                	test   %eax,%eax
+  801650:	74 34                	je     801686 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801652:	83 ec 08             	sub    $0x8,%esp
+  801655:	ff 75 0c             	push   0xc(%ebp)
+  801658:	56                   	push   %esi
+  801659:	ff d0                	call   *%eax
+  80165b:	83 c4 10             	add    $0x10,%esp
+}
+  80165e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801661:	5b                   	pop    %ebx
+  801662:	5e                   	pop    %esi
+  801663:	5d                   	pop    %ebp
+  801664:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801665:	a1 08 40 80 00       	mov    0x804008,%eax
+  80166a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80166d:	83 ec 04             	sub    $0x4,%esp
+  801670:	53                   	push   %ebx
+  801671:	50                   	push   %eax
+  801672:	68 78 2a 80 00       	push   $0x802a78
+  801677:	e8 ca ea ff ff       	call   800146 <cprintf>
+		return -E_INVAL;
+  80167c:	83 c4 10             	add    $0x10,%esp
+  80167f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801684:	eb d8                	jmp    80165e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801686:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80168b:	eb d1                	jmp    80165e <ftruncate+0x50>
+
+0080168d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80168d:	55                   	push   %ebp
+  80168e:	89 e5                	mov    %esp,%ebp
+  801690:	56                   	push   %esi
+  801691:	53                   	push   %ebx
+  801692:	83 ec 18             	sub    $0x18,%esp
+  801695:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801698:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80169b:	50                   	push   %eax
+  80169c:	ff 75 08             	push   0x8(%ebp)
+  80169f:	e8 92 fb ff ff       	call   801236 <fd_lookup>
+  8016a4:	83 c4 10             	add    $0x10,%esp
+  8016a7:	85 c0                	test   %eax,%eax
+  8016a9:	78 49                	js     8016f4 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016ab:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016ae:	83 ec 08             	sub    $0x8,%esp
+  8016b1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016b4:	50                   	push   %eax
+  8016b5:	ff 36                	push   (%esi)
+  8016b7:	e8 ca fb ff ff       	call   801286 <dev_lookup>
+  8016bc:	83 c4 10             	add    $0x10,%esp
+  8016bf:	85 c0                	test   %eax,%eax
+  8016c1:	78 31                	js     8016f4 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8016c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016c6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016ca:	74 2f                	je     8016fb <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8016cc:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8016cf:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016d6:	00 00 00 
+	stat->st_isdir = 0;
+  8016d9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016e0:	00 00 00 
+	stat->st_dev = dev;
+  8016e3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8016e9:	83 ec 08             	sub    $0x8,%esp
+  8016ec:	53                   	push   %ebx
+  8016ed:	56                   	push   %esi
+  8016ee:	ff 50 14             	call   *0x14(%eax)
+  8016f1:	83 c4 10             	add    $0x10,%esp
+}
+  8016f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016f7:	5b                   	pop    %ebx
+  8016f8:	5e                   	pop    %esi
+  8016f9:	5d                   	pop    %ebp
+  8016fa:	c3                   	ret
+		return -E_NOT_SUPP;
+  8016fb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801700:	eb f2                	jmp    8016f4 <fstat+0x67>
+
+00801702 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801702:	55                   	push   %ebp
+  801703:	89 e5                	mov    %esp,%ebp
+  801705:	56                   	push   %esi
+  801706:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801707:	83 ec 08             	sub    $0x8,%esp
+  80170a:	6a 00                	push   $0x0
+  80170c:	ff 75 08             	push   0x8(%ebp)
+  80170f:	e8 bc 02 00 00       	call   8019d0 <open>
+  801714:	89 c3                	mov    %eax,%ebx
+  801716:	83 c4 10             	add    $0x10,%esp
+  801719:	85 c0                	test   %eax,%eax
+  80171b:	78 1b                	js     801738 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80171d:	83 ec 08             	sub    $0x8,%esp
+  801720:	ff 75 0c             	push   0xc(%ebp)
+  801723:	50                   	push   %eax
+  801724:	e8 64 ff ff ff       	call   80168d <fstat>
+  801729:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80172b:	89 1c 24             	mov    %ebx,(%esp)
+  80172e:	e8 26 fc ff ff       	call   801359 <close>
+	return r;
+  801733:	83 c4 10             	add    $0x10,%esp
+  801736:	89 f3                	mov    %esi,%ebx
+}
+  801738:	89 d8                	mov    %ebx,%eax
+  80173a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80173d:	5b                   	pop    %ebx
+  80173e:	5e                   	pop    %esi
+  80173f:	5d                   	pop    %ebp
+  801740:	c3                   	ret
+
+00801741 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801741:	55                   	push   %ebp
+  801742:	89 e5                	mov    %esp,%ebp
+  801744:	57                   	push   %edi
+  801745:	56                   	push   %esi
+  801746:	53                   	push   %ebx
+  801747:	83 ec 0c             	sub    $0xc,%esp
+  80174a:	89 c7                	mov    %eax,%edi
+  80174c:	89 d3                	mov    %edx,%ebx
+  80174e:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801750:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801757:	74 2d                	je     801786 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801759:	6a 07                	push   $0x7
+  80175b:	68 00 50 80 00       	push   $0x805000
+  801760:	57                   	push   %edi
+  801761:	ff 35 00 40 80 00    	push   0x804000
+  801767:	e8 c3 0b 00 00       	call   80232f <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  80176c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801773:	6a 00                	push   $0x0
+  801775:	56                   	push   %esi
+  801776:	53                   	push   %ebx
+  801777:	6a 00                	push   $0x0
+  801779:	e8 63 0a 00 00       	call   8021e1 <ipc_recv_pages>
+}
+  80177e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801781:	5b                   	pop    %ebx
+  801782:	5e                   	pop    %esi
+  801783:	5f                   	pop    %edi
+  801784:	5d                   	pop    %ebp
+  801785:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801786:	83 ec 0c             	sub    $0xc,%esp
+  801789:	6a 01                	push   $0x1
+  80178b:	e8 94 0c 00 00       	call   802424 <ipc_find_env>
+  801790:	a3 00 40 80 00       	mov    %eax,0x804000
+  801795:	83 c4 10             	add    $0x10,%esp
+  801798:	eb bf                	jmp    801759 <fsipc_pages+0x18>
+
+0080179a <fsipc>:
+{
+  80179a:	55                   	push   %ebp
+  80179b:	89 e5                	mov    %esp,%ebp
+  80179d:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  8017a0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017a5:	e8 97 ff ff ff       	call   801741 <fsipc_pages>
+}
+  8017aa:	c9                   	leave
+  8017ab:	c3                   	ret
+
+008017ac <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017ac:	55                   	push   %ebp
+  8017ad:	89 e5                	mov    %esp,%ebp
+  8017af:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8017b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017b8:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  8017bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017c0:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8017c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ca:	b8 02 00 00 00       	mov    $0x2,%eax
+  8017cf:	e8 c6 ff ff ff       	call   80179a <fsipc>
+}
+  8017d4:	c9                   	leave
+  8017d5:	c3                   	ret
+
+008017d6 <devfile_flush>:
+{
+  8017d6:	55                   	push   %ebp
+  8017d7:	89 e5                	mov    %esp,%ebp
+  8017d9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8017dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017df:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017e2:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8017e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ec:	b8 06 00 00 00       	mov    $0x6,%eax
+  8017f1:	e8 a4 ff ff ff       	call   80179a <fsipc>
+}
+  8017f6:	c9                   	leave
+  8017f7:	c3                   	ret
+
+008017f8 <devfile_stat>:
+{
+  8017f8:	55                   	push   %ebp
+  8017f9:	89 e5                	mov    %esp,%ebp
+  8017fb:	53                   	push   %ebx
+  8017fc:	83 ec 04             	sub    $0x4,%esp
+  8017ff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801802:	8b 45 08             	mov    0x8(%ebp),%eax
+  801805:	8b 40 0c             	mov    0xc(%eax),%eax
+  801808:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80180d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801812:	b8 05 00 00 00       	mov    $0x5,%eax
+  801817:	e8 7e ff ff ff       	call   80179a <fsipc>
+  80181c:	85 c0                	test   %eax,%eax
+  80181e:	78 2c                	js     80184c <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801820:	83 ec 08             	sub    $0x8,%esp
+  801823:	68 00 50 80 00       	push   $0x805000
+  801828:	53                   	push   %ebx
+  801829:	e8 ff ee ff ff       	call   80072d <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80182e:	a1 80 50 80 00       	mov    0x805080,%eax
+  801833:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801839:	a1 84 50 80 00       	mov    0x805084,%eax
+  80183e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801844:	83 c4 10             	add    $0x10,%esp
+  801847:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80184c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80184f:	c9                   	leave
+  801850:	c3                   	ret
+
+00801851 <devfile_write>:
+{
+  801851:	55                   	push   %ebp
+  801852:	89 e5                	mov    %esp,%ebp
+  801854:	83 ec 0c             	sub    $0xc,%esp
+  801857:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80185a:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80185f:	39 d0                	cmp    %edx,%eax
+  801861:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801864:	8b 55 08             	mov    0x8(%ebp),%edx
+  801867:	8b 52 0c             	mov    0xc(%edx),%edx
+  80186a:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  801870:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801875:	50                   	push   %eax
+  801876:	ff 75 0c             	push   0xc(%ebp)
+  801879:	68 08 50 80 00       	push   $0x805008
+  80187e:	e8 30 f0 ff ff       	call   8008b3 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801883:	ba 00 00 00 00       	mov    $0x0,%edx
+  801888:	b8 04 00 00 00       	mov    $0x4,%eax
+  80188d:	e8 08 ff ff ff       	call   80179a <fsipc>
+}
+  801892:	c9                   	leave
+  801893:	c3                   	ret
+
+00801894 <devfile_read>:
+{
+  801894:	55                   	push   %ebp
+  801895:	89 e5                	mov    %esp,%ebp
+  801897:	57                   	push   %edi
+  801898:	56                   	push   %esi
+  801899:	53                   	push   %ebx
+  80189a:	83 ec 1c             	sub    $0x1c,%esp
+  80189d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8018a0:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8018a3:	89 fe                	mov    %edi,%esi
+  8018a5:	c1 ee 0c             	shr    $0xc,%esi
+  8018a8:	b8 20 00 00 00       	mov    $0x20,%eax
+  8018ad:	39 c6                	cmp    %eax,%esi
+  8018af:	0f 47 f0             	cmova  %eax,%esi
+  8018b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018ba:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8018bd:	eb 14                	jmp    8018d3 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8018bf:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  8018c6:	05 00 10 00 00       	add    $0x1000,%eax
+  8018cb:	f6 c6 06             	test   $0x6,%dh
+  8018ce:	75 42                	jne    801912 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8018d0:	83 c1 01             	add    $0x1,%ecx
+  8018d3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8018d6:	39 f1                	cmp    %esi,%ecx
+  8018d8:	0f 84 95 00 00 00    	je     801973 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8018de:	89 c2                	mov    %eax,%edx
+  8018e0:	c1 ea 16             	shr    $0x16,%edx
+  8018e3:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8018ea:	f6 c2 01             	test   $0x1,%dl
+  8018ed:	74 23                	je     801912 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8018ef:	89 c2                	mov    %eax,%edx
+  8018f1:	c1 ea 0c             	shr    $0xc,%edx
+  8018f4:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8018fb:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801901:	74 0f                	je     801912 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801903:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  80190a:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801910:	75 ad                	jne    8018bf <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801912:	85 c9                	test   %ecx,%ecx
+  801914:	74 11                	je     801927 <devfile_read+0x93>
+  801916:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80191d:	75 08                	jne    801927 <devfile_read+0x93>
+  80191f:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801925:	74 50                	je     801977 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801927:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80192a:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  80192f:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801935:	ba 00 00 00 00       	mov    $0x0,%edx
+  80193a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80193f:	e8 56 fe ff ff       	call   80179a <fsipc>
+  801944:	89 c6                	mov    %eax,%esi
+  801946:	85 c0                	test   %eax,%eax
+  801948:	78 1f                	js     801969 <devfile_read+0xd5>
+	assert(r <= n);
+  80194a:	39 c7                	cmp    %eax,%edi
+  80194c:	72 50                	jb     80199e <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  80194e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801953:	7f 62                	jg     8019b7 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801955:	83 ec 04             	sub    $0x4,%esp
+  801958:	50                   	push   %eax
+  801959:	68 00 50 80 00       	push   $0x805000
+  80195e:	ff 75 0c             	push   0xc(%ebp)
+  801961:	e8 4d ef ff ff       	call   8008b3 <memmove>
+	return r;
+  801966:	83 c4 10             	add    $0x10,%esp
+}
+  801969:	89 f0                	mov    %esi,%eax
+  80196b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80196e:	5b                   	pop    %ebx
+  80196f:	5e                   	pop    %esi
+  801970:	5f                   	pop    %edi
+  801971:	5d                   	pop    %ebp
+  801972:	c3                   	ret
+  801973:	89 f1                	mov    %esi,%ecx
+  801975:	eb 9b                	jmp    801912 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801977:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80197a:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  80197f:	89 c8                	mov    %ecx,%eax
+  801981:	c1 e0 0c             	shl    $0xc,%eax
+  801984:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801989:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80198c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801991:	e8 ab fd ff ff       	call   801741 <fsipc_pages>
+  801996:	89 c6                	mov    %eax,%esi
+  801998:	85 c0                	test   %eax,%eax
+  80199a:	78 8b                	js     801927 <devfile_read+0x93>
+  80199c:	eb cb                	jmp    801969 <devfile_read+0xd5>
+	assert(r <= n);
+  80199e:	68 e4 2a 80 00       	push   $0x802ae4
+  8019a3:	68 eb 2a 80 00       	push   $0x802aeb
+  8019a8:	68 a0 00 00 00       	push   $0xa0
+  8019ad:	68 00 2b 80 00       	push   $0x802b00
+  8019b2:	e8 e4 07 00 00       	call   80219b <_panic>
+	assert(r <= PGSIZE);
+  8019b7:	68 0b 2b 80 00       	push   $0x802b0b
+  8019bc:	68 eb 2a 80 00       	push   $0x802aeb
+  8019c1:	68 a1 00 00 00       	push   $0xa1
+  8019c6:	68 00 2b 80 00       	push   $0x802b00
+  8019cb:	e8 cb 07 00 00       	call   80219b <_panic>
+
+008019d0 <open>:
+{
+  8019d0:	55                   	push   %ebp
+  8019d1:	89 e5                	mov    %esp,%ebp
+  8019d3:	56                   	push   %esi
+  8019d4:	53                   	push   %ebx
+  8019d5:	83 ec 1c             	sub    $0x1c,%esp
+  8019d8:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8019db:	56                   	push   %esi
+  8019dc:	e8 11 ed ff ff       	call   8006f2 <strlen>
+  8019e1:	83 c4 10             	add    $0x10,%esp
+  8019e4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019e9:	7f 6c                	jg     801a57 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8019eb:	83 ec 0c             	sub    $0xc,%esp
+  8019ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019f1:	50                   	push   %eax
+  8019f2:	e8 eb f7 ff ff       	call   8011e2 <fd_alloc>
+  8019f7:	89 c3                	mov    %eax,%ebx
+  8019f9:	83 c4 10             	add    $0x10,%esp
+  8019fc:	85 c0                	test   %eax,%eax
+  8019fe:	78 3c                	js     801a3c <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801a00:	83 ec 08             	sub    $0x8,%esp
+  801a03:	56                   	push   %esi
+  801a04:	68 00 50 80 00       	push   $0x805000
+  801a09:	e8 1f ed ff ff       	call   80072d <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a0e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a11:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801a16:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a19:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a1e:	e8 77 fd ff ff       	call   80179a <fsipc>
+  801a23:	89 c3                	mov    %eax,%ebx
+  801a25:	83 c4 10             	add    $0x10,%esp
+  801a28:	85 c0                	test   %eax,%eax
+  801a2a:	78 19                	js     801a45 <open+0x75>
+	return fd2num(fd);
+  801a2c:	83 ec 0c             	sub    $0xc,%esp
+  801a2f:	ff 75 f4             	push   -0xc(%ebp)
+  801a32:	e8 84 f7 ff ff       	call   8011bb <fd2num>
+  801a37:	89 c3                	mov    %eax,%ebx
+  801a39:	83 c4 10             	add    $0x10,%esp
+}
+  801a3c:	89 d8                	mov    %ebx,%eax
+  801a3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a41:	5b                   	pop    %ebx
+  801a42:	5e                   	pop    %esi
+  801a43:	5d                   	pop    %ebp
+  801a44:	c3                   	ret
+		fd_close(fd, 0);
+  801a45:	83 ec 08             	sub    $0x8,%esp
+  801a48:	6a 00                	push   $0x0
+  801a4a:	ff 75 f4             	push   -0xc(%ebp)
+  801a4d:	e8 80 f8 ff ff       	call   8012d2 <fd_close>
+		return r;
+  801a52:	83 c4 10             	add    $0x10,%esp
+  801a55:	eb e5                	jmp    801a3c <open+0x6c>
+		return -E_BAD_PATH;
+  801a57:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a5c:	eb de                	jmp    801a3c <open+0x6c>
+
+00801a5e <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801a5e:	55                   	push   %ebp
+  801a5f:	89 e5                	mov    %esp,%ebp
+  801a61:	53                   	push   %ebx
+  801a62:	83 ec 10             	sub    $0x10,%esp
+  801a65:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801a68:	53                   	push   %ebx
+  801a69:	e8 84 ec ff ff       	call   8006f2 <strlen>
+  801a6e:	83 c4 10             	add    $0x10,%esp
+  801a71:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a76:	7f 25                	jg     801a9d <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801a78:	83 ec 08             	sub    $0x8,%esp
+  801a7b:	53                   	push   %ebx
+  801a7c:	68 00 50 80 00       	push   $0x805000
+  801a81:	e8 a7 ec ff ff       	call   80072d <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801a86:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a8b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a90:	e8 05 fd ff ff       	call   80179a <fsipc>
+  801a95:	83 c4 10             	add    $0x10,%esp
+}
+  801a98:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a9b:	c9                   	leave
+  801a9c:	c3                   	ret
+		return -E_BAD_PATH;
+  801a9d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801aa2:	eb f4                	jmp    801a98 <remove+0x3a>
+
+00801aa4 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801aa4:	55                   	push   %ebp
+  801aa5:	89 e5                	mov    %esp,%ebp
+  801aa7:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801aaa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aaf:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ab4:	e8 e1 fc ff ff       	call   80179a <fsipc>
+}
+  801ab9:	c9                   	leave
+  801aba:	c3                   	ret
+
+00801abb <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801abb:	55                   	push   %ebp
+  801abc:	89 e5                	mov    %esp,%ebp
+  801abe:	53                   	push   %ebx
+  801abf:	83 ec 04             	sub    $0x4,%esp
+  801ac2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801ac5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aca:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801acf:	e8 c6 fc ff ff       	call   80179a <fsipc>
+  801ad4:	85 c0                	test   %eax,%eax
+  801ad6:	78 3c                	js     801b14 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801ad8:	a1 00 50 80 00       	mov    0x805000,%eax
+  801add:	89 03                	mov    %eax,(%ebx)
+  801adf:	a1 04 50 80 00       	mov    0x805004,%eax
+  801ae4:	89 43 04             	mov    %eax,0x4(%ebx)
+  801ae7:	a1 08 50 80 00       	mov    0x805008,%eax
+  801aec:	89 43 08             	mov    %eax,0x8(%ebx)
+  801aef:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801af4:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801af7:	a1 10 50 80 00       	mov    0x805010,%eax
+  801afc:	89 43 10             	mov    %eax,0x10(%ebx)
+  801aff:	a1 14 50 80 00       	mov    0x805014,%eax
+  801b04:	89 43 14             	mov    %eax,0x14(%ebx)
+  801b07:	a1 18 50 80 00       	mov    0x805018,%eax
+  801b0c:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b17:	c9                   	leave
+  801b18:	c3                   	ret
+
+00801b19 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801b19:	55                   	push   %ebp
+  801b1a:	89 e5                	mov    %esp,%ebp
+  801b1c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801b1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b22:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  801b27:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b2c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801b31:	e8 64 fc ff ff       	call   80179a <fsipc>
+}
+  801b36:	c9                   	leave
+  801b37:	c3                   	ret
+
+00801b38 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b38:	55                   	push   %ebp
+  801b39:	89 e5                	mov    %esp,%ebp
+  801b3b:	56                   	push   %esi
+  801b3c:	53                   	push   %ebx
+  801b3d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801b40:	83 ec 0c             	sub    $0xc,%esp
+  801b43:	ff 75 08             	push   0x8(%ebp)
+  801b46:	e8 80 f6 ff ff       	call   8011cb <fd2data>
+  801b4b:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801b4d:	83 c4 08             	add    $0x8,%esp
+  801b50:	68 17 2b 80 00       	push   $0x802b17
+  801b55:	53                   	push   %ebx
+  801b56:	e8 d2 eb ff ff       	call   80072d <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801b5b:	8b 46 04             	mov    0x4(%esi),%eax
+  801b5e:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801b64:	2b 0e                	sub    (%esi),%ecx
+  801b66:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801b6b:	89 c8                	mov    %ecx,%eax
+  801b6d:	f7 e2                	mul    %edx
+  801b6f:	c1 ea 0c             	shr    $0xc,%edx
+  801b72:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801b78:	29 d1                	sub    %edx,%ecx
+  801b7a:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801b80:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b87:	00 00 00 
+	stat->st_dev = &devpipe;
+  801b8a:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  801b91:	30 80 00 
+	return 0;
+}
+  801b94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b9c:	5b                   	pop    %ebx
+  801b9d:	5e                   	pop    %esi
+  801b9e:	5d                   	pop    %ebp
+  801b9f:	c3                   	ret
+
+00801ba0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801ba0:	55                   	push   %ebp
+  801ba1:	89 e5                	mov    %esp,%ebp
+  801ba3:	53                   	push   %ebx
+  801ba4:	83 ec 0c             	sub    $0xc,%esp
+  801ba7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801baa:	53                   	push   %ebx
+  801bab:	6a 00                	push   $0x0
+  801bad:	e8 f3 f0 ff ff       	call   800ca5 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801bb2:	89 1c 24             	mov    %ebx,(%esp)
+  801bb5:	e8 11 f6 ff ff       	call   8011cb <fd2data>
+  801bba:	83 c4 08             	add    $0x8,%esp
+  801bbd:	50                   	push   %eax
+  801bbe:	6a 00                	push   $0x0
+  801bc0:	e8 e0 f0 ff ff       	call   800ca5 <sys_page_unmap>
+}
+  801bc5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bc8:	c9                   	leave
+  801bc9:	c3                   	ret
+
+00801bca <_pipeisclosed>:
+{
+  801bca:	55                   	push   %ebp
+  801bcb:	89 e5                	mov    %esp,%ebp
+  801bcd:	57                   	push   %edi
+  801bce:	56                   	push   %esi
+  801bcf:	53                   	push   %ebx
+  801bd0:	83 ec 1c             	sub    $0x1c,%esp
+  801bd3:	89 c7                	mov    %eax,%edi
+  801bd5:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801bd7:	a1 08 40 80 00       	mov    0x804008,%eax
+  801bdc:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801bdf:	83 ec 0c             	sub    $0xc,%esp
+  801be2:	57                   	push   %edi
+  801be3:	e8 7b 08 00 00       	call   802463 <pageref>
+  801be8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801beb:	89 34 24             	mov    %esi,(%esp)
+  801bee:	e8 70 08 00 00       	call   802463 <pageref>
+		nn = thisenv->env_runs;
+  801bf3:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801bf9:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801bfc:	83 c4 10             	add    $0x10,%esp
+  801bff:	39 cb                	cmp    %ecx,%ebx
+  801c01:	74 1b                	je     801c1e <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801c03:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801c06:	75 cf                	jne    801bd7 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801c08:	8b 42 58             	mov    0x58(%edx),%eax
+  801c0b:	6a 01                	push   $0x1
+  801c0d:	50                   	push   %eax
+  801c0e:	53                   	push   %ebx
+  801c0f:	68 1e 2b 80 00       	push   $0x802b1e
+  801c14:	e8 2d e5 ff ff       	call   800146 <cprintf>
+  801c19:	83 c4 10             	add    $0x10,%esp
+  801c1c:	eb b9                	jmp    801bd7 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801c1e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801c21:	0f 94 c0             	sete   %al
+  801c24:	0f b6 c0             	movzbl %al,%eax
+}
+  801c27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c2a:	5b                   	pop    %ebx
+  801c2b:	5e                   	pop    %esi
+  801c2c:	5f                   	pop    %edi
+  801c2d:	5d                   	pop    %ebp
+  801c2e:	c3                   	ret
+
+00801c2f <devpipe_read>:
+{
+  801c2f:	55                   	push   %ebp
+  801c30:	89 e5                	mov    %esp,%ebp
+  801c32:	57                   	push   %edi
+  801c33:	56                   	push   %esi
+  801c34:	53                   	push   %ebx
+  801c35:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801c38:	ff 75 08             	push   0x8(%ebp)
+  801c3b:	e8 8b f5 ff ff       	call   8011cb <fd2data>
+  801c40:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801c42:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801c45:	8d 40 04             	lea    0x4(%eax),%eax
+  801c48:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801c4b:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801c4e:	8b 0b                	mov    (%ebx),%ecx
+  801c50:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801c56:	29 ce                	sub    %ecx,%esi
+  801c58:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801c5d:	f7 e6                	mul    %esi
+  801c5f:	c1 ea 0c             	shr    $0xc,%edx
+  801c62:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801c68:	29 c6                	sub    %eax,%esi
+  801c6a:	89 f2                	mov    %esi,%edx
+  801c6c:	75 43                	jne    801cb1 <devpipe_read+0x82>
+		ref = pageref(p);
+  801c6e:	83 ec 0c             	sub    $0xc,%esp
+  801c71:	53                   	push   %ebx
+  801c72:	e8 ec 07 00 00       	call   802463 <pageref>
+  801c77:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801c79:	89 da                	mov    %ebx,%edx
+  801c7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7e:	e8 47 ff ff ff       	call   801bca <_pipeisclosed>
+  801c83:	83 c4 10             	add    $0x10,%esp
+  801c86:	85 c0                	test   %eax,%eax
+  801c88:	0f 85 c1 00 00 00    	jne    801d4f <devpipe_read+0x120>
+	*sleeping = 1;
+  801c8e:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801c95:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801c9a:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801c9d:	75 ac                	jne    801c4b <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801c9f:	83 ec 04             	sub    $0x4,%esp
+  801ca2:	56                   	push   %esi
+  801ca3:	57                   	push   %edi
+  801ca4:	ff 75 e4             	push   -0x1c(%ebp)
+  801ca7:	e8 4d f4 ff ff       	call   8010f9 <sys_futex_wait>
+  801cac:	83 c4 10             	add    $0x10,%esp
+  801caf:	eb 9a                	jmp    801c4b <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801cb1:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801cb4:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801cb8:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801cba:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801cbf:	f7 e1                	mul    %ecx
+  801cc1:	c1 ea 0b             	shr    $0xb,%edx
+  801cc4:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801cca:	29 c1                	sub    %eax,%ecx
+  801ccc:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801cce:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801cd3:	29 cf                	sub    %ecx,%edi
+  801cd5:	39 f7                	cmp    %esi,%edi
+  801cd7:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801cda:	8d 43 10             	lea    0x10(%ebx),%eax
+  801cdd:	83 ec 04             	sub    $0x4,%esp
+  801ce0:	57                   	push   %edi
+  801ce1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ce4:	01 c2                	add    %eax,%edx
+  801ce6:	52                   	push   %edx
+  801ce7:	ff 75 0c             	push   0xc(%ebp)
+  801cea:	e8 c4 eb ff ff       	call   8008b3 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801cef:	83 c4 0c             	add    $0xc,%esp
+  801cf2:	89 f1                	mov    %esi,%ecx
+  801cf4:	29 f9                	sub    %edi,%ecx
+  801cf6:	51                   	push   %ecx
+  801cf7:	ff 75 e4             	push   -0x1c(%ebp)
+  801cfa:	89 f8                	mov    %edi,%eax
+  801cfc:	03 45 0c             	add    0xc(%ebp),%eax
+  801cff:	50                   	push   %eax
+  801d00:	e8 ae eb ff ff       	call   8008b3 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801d05:	89 f1                	mov    %esi,%ecx
+  801d07:	03 0b                	add    (%ebx),%ecx
+  801d09:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801d0e:	f7 e1                	mul    %ecx
+  801d10:	c1 ea 0c             	shr    $0xc,%edx
+  801d13:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801d19:	29 d1                	sub    %edx,%ecx
+  801d1b:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801d1d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801d22:	83 c4 10             	add    $0x10,%esp
+  801d25:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801d29:	75 0a                	jne    801d35 <devpipe_read+0x106>
+	return n;
+  801d2b:	89 f0                	mov    %esi,%eax
+}
+  801d2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d30:	5b                   	pop    %ebx
+  801d31:	5e                   	pop    %esi
+  801d32:	5f                   	pop    %edi
+  801d33:	5d                   	pop    %ebp
+  801d34:	c3                   	ret
+		*sleeping = 0;
+  801d35:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801d3c:	83 ec 08             	sub    $0x8,%esp
+  801d3f:	68 00 04 00 00       	push   $0x400
+  801d44:	53                   	push   %ebx
+  801d45:	e8 ff f3 ff ff       	call   801149 <sys_futex_wake>
+  801d4a:	83 c4 10             	add    $0x10,%esp
+  801d4d:	eb dc                	jmp    801d2b <devpipe_read+0xfc>
+			return 0;
+  801d4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d54:	eb d7                	jmp    801d2d <devpipe_read+0xfe>
+
+00801d56 <devpipe_write>:
+{
+  801d56:	55                   	push   %ebp
+  801d57:	89 e5                	mov    %esp,%ebp
+  801d59:	57                   	push   %edi
+  801d5a:	56                   	push   %esi
+  801d5b:	53                   	push   %ebx
+  801d5c:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801d5f:	ff 75 08             	push   0x8(%ebp)
+  801d62:	e8 64 f4 ff ff       	call   8011cb <fd2data>
+  801d67:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801d69:	83 c4 10             	add    $0x10,%esp
+  801d6c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801d73:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d76:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801d79:	0f 83 23 01 00 00    	jae    801ea2 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801d7f:	8b 77 04             	mov    0x4(%edi),%esi
+  801d82:	8b 1f                	mov    (%edi),%ebx
+  801d84:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801d8a:	29 d9                	sub    %ebx,%ecx
+  801d8c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801d91:	f7 e1                	mul    %ecx
+  801d93:	c1 ea 0c             	shr    $0xc,%edx
+  801d96:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801d9c:	29 c1                	sub    %eax,%ecx
+  801d9e:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801da0:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801da6:	75 40                	jne    801de8 <devpipe_write+0x92>
+			ref = pageref(p);
+  801da8:	83 ec 0c             	sub    $0xc,%esp
+  801dab:	57                   	push   %edi
+  801dac:	e8 b2 06 00 00       	call   802463 <pageref>
+  801db1:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801db3:	89 fa                	mov    %edi,%edx
+  801db5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db8:	e8 0d fe ff ff       	call   801bca <_pipeisclosed>
+  801dbd:	83 c4 10             	add    $0x10,%esp
+  801dc0:	85 c0                	test   %eax,%eax
+  801dc2:	0f 85 d5 00 00 00    	jne    801e9d <devpipe_write+0x147>
+	*sleeping = 1;
+  801dc8:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801dcf:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801dd4:	39 1f                	cmp    %ebx,(%edi)
+  801dd6:	75 a7                	jne    801d7f <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801dd8:	83 ec 04             	sub    $0x4,%esp
+  801ddb:	56                   	push   %esi
+  801ddc:	53                   	push   %ebx
+  801ddd:	57                   	push   %edi
+  801dde:	e8 16 f3 ff ff       	call   8010f9 <sys_futex_wait>
+  801de3:	83 c4 10             	add    $0x10,%esp
+  801de6:	eb 97                	jmp    801d7f <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801de8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801deb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801dee:	29 c1                	sub    %eax,%ecx
+  801df0:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801df5:	89 d8                	mov    %ebx,%eax
+  801df7:	29 d0                	sub    %edx,%eax
+  801df9:	39 c1                	cmp    %eax,%ecx
+  801dfb:	0f 46 c1             	cmovbe %ecx,%eax
+  801dfe:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801e00:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e05:	f7 e6                	mul    %esi
+  801e07:	c1 ea 0b             	shr    $0xb,%edx
+  801e0a:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801e10:	29 c6                	sub    %eax,%esi
+  801e12:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801e14:	29 f3                	sub    %esi,%ebx
+  801e16:	39 cb                	cmp    %ecx,%ebx
+  801e18:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801e1b:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801e1e:	8d 77 10             	lea    0x10(%edi),%esi
+  801e21:	83 ec 04             	sub    $0x4,%esp
+  801e24:	53                   	push   %ebx
+  801e25:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e28:	03 45 0c             	add    0xc(%ebp),%eax
+  801e2b:	50                   	push   %eax
+  801e2c:	01 f2                	add    %esi,%edx
+  801e2e:	52                   	push   %edx
+  801e2f:	e8 7f ea ff ff       	call   8008b3 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  801e34:	83 c4 0c             	add    $0xc,%esp
+  801e37:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801e3a:	29 d8                	sub    %ebx,%eax
+  801e3c:	50                   	push   %eax
+  801e3d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801e40:	01 d3                	add    %edx,%ebx
+  801e42:	03 5d 0c             	add    0xc(%ebp),%ebx
+  801e45:	53                   	push   %ebx
+  801e46:	56                   	push   %esi
+  801e47:	e8 67 ea ff ff       	call   8008b3 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  801e4c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801e4f:	03 4f 04             	add    0x4(%edi),%ecx
+  801e52:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e57:	f7 e1                	mul    %ecx
+  801e59:	c1 ea 0c             	shr    $0xc,%edx
+  801e5c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801e62:	29 d1                	sub    %edx,%ecx
+  801e64:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  801e67:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801e6c:	83 c4 10             	add    $0x10,%esp
+  801e6f:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  801e73:	75 0b                	jne    801e80 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  801e75:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  801e78:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801e7b:	e9 f3 fe ff ff       	jmp    801d73 <devpipe_write+0x1d>
+		*sleeping = 0;
+  801e80:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  801e87:	83 ec 08             	sub    $0x8,%esp
+  801e8a:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  801e8f:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  801e92:	50                   	push   %eax
+  801e93:	e8 b1 f2 ff ff       	call   801149 <sys_futex_wake>
+  801e98:	83 c4 10             	add    $0x10,%esp
+  801e9b:	eb d8                	jmp    801e75 <devpipe_write+0x11f>
+				return 0;
+  801e9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ea2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ea5:	5b                   	pop    %ebx
+  801ea6:	5e                   	pop    %esi
+  801ea7:	5f                   	pop    %edi
+  801ea8:	5d                   	pop    %ebp
+  801ea9:	c3                   	ret
+
+00801eaa <pipe>:
+{
+  801eaa:	55                   	push   %ebp
+  801eab:	89 e5                	mov    %esp,%ebp
+  801ead:	56                   	push   %esi
+  801eae:	53                   	push   %ebx
+  801eaf:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801eb2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eb5:	50                   	push   %eax
+  801eb6:	e8 27 f3 ff ff       	call   8011e2 <fd_alloc>
+  801ebb:	89 c3                	mov    %eax,%ebx
+  801ebd:	83 c4 10             	add    $0x10,%esp
+  801ec0:	85 c0                	test   %eax,%eax
+  801ec2:	0f 88 23 01 00 00    	js     801feb <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801ec8:	83 ec 04             	sub    $0x4,%esp
+  801ecb:	68 07 04 00 00       	push   $0x407
+  801ed0:	ff 75 f4             	push   -0xc(%ebp)
+  801ed3:	6a 00                	push   $0x0
+  801ed5:	e8 46 ed ff ff       	call   800c20 <sys_page_alloc>
+  801eda:	89 c3                	mov    %eax,%ebx
+  801edc:	83 c4 10             	add    $0x10,%esp
+  801edf:	85 c0                	test   %eax,%eax
+  801ee1:	0f 88 04 01 00 00    	js     801feb <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801ee7:	83 ec 0c             	sub    $0xc,%esp
+  801eea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801eed:	50                   	push   %eax
+  801eee:	e8 ef f2 ff ff       	call   8011e2 <fd_alloc>
+  801ef3:	89 c3                	mov    %eax,%ebx
+  801ef5:	83 c4 10             	add    $0x10,%esp
+  801ef8:	85 c0                	test   %eax,%eax
+  801efa:	0f 88 db 00 00 00    	js     801fdb <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f00:	83 ec 04             	sub    $0x4,%esp
+  801f03:	68 07 04 00 00       	push   $0x407
+  801f08:	ff 75 f0             	push   -0x10(%ebp)
+  801f0b:	6a 00                	push   $0x0
+  801f0d:	e8 0e ed ff ff       	call   800c20 <sys_page_alloc>
+  801f12:	89 c3                	mov    %eax,%ebx
+  801f14:	83 c4 10             	add    $0x10,%esp
+  801f17:	85 c0                	test   %eax,%eax
+  801f19:	0f 88 bc 00 00 00    	js     801fdb <pipe+0x131>
+	va = fd2data(fd0);
+  801f1f:	83 ec 0c             	sub    $0xc,%esp
+  801f22:	ff 75 f4             	push   -0xc(%ebp)
+  801f25:	e8 a1 f2 ff ff       	call   8011cb <fd2data>
+  801f2a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f2c:	83 c4 0c             	add    $0xc,%esp
+  801f2f:	68 07 04 00 00       	push   $0x407
+  801f34:	50                   	push   %eax
+  801f35:	6a 00                	push   $0x0
+  801f37:	e8 e4 ec ff ff       	call   800c20 <sys_page_alloc>
+  801f3c:	89 c3                	mov    %eax,%ebx
+  801f3e:	83 c4 10             	add    $0x10,%esp
+  801f41:	85 c0                	test   %eax,%eax
+  801f43:	0f 88 82 00 00 00    	js     801fcb <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f49:	83 ec 0c             	sub    $0xc,%esp
+  801f4c:	ff 75 f0             	push   -0x10(%ebp)
+  801f4f:	e8 77 f2 ff ff       	call   8011cb <fd2data>
+  801f54:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801f5b:	50                   	push   %eax
+  801f5c:	6a 00                	push   $0x0
+  801f5e:	56                   	push   %esi
+  801f5f:	6a 00                	push   $0x0
+  801f61:	e8 fd ec ff ff       	call   800c63 <sys_page_map>
+  801f66:	89 c3                	mov    %eax,%ebx
+  801f68:	83 c4 20             	add    $0x20,%esp
+  801f6b:	85 c0                	test   %eax,%eax
+  801f6d:	78 4e                	js     801fbd <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801f6f:	a1 20 30 80 00       	mov    0x803020,%eax
+  801f74:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f77:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801f79:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f7c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801f83:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801f86:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801f88:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801f8b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801f92:	83 ec 0c             	sub    $0xc,%esp
+  801f95:	ff 75 f4             	push   -0xc(%ebp)
+  801f98:	e8 1e f2 ff ff       	call   8011bb <fd2num>
+  801f9d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fa0:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801fa2:	83 c4 04             	add    $0x4,%esp
+  801fa5:	ff 75 f0             	push   -0x10(%ebp)
+  801fa8:	e8 0e f2 ff ff       	call   8011bb <fd2num>
+  801fad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fb0:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801fb3:	83 c4 10             	add    $0x10,%esp
+  801fb6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fbb:	eb 2e                	jmp    801feb <pipe+0x141>
+	sys_page_unmap(0, va);
+  801fbd:	83 ec 08             	sub    $0x8,%esp
+  801fc0:	56                   	push   %esi
+  801fc1:	6a 00                	push   $0x0
+  801fc3:	e8 dd ec ff ff       	call   800ca5 <sys_page_unmap>
+  801fc8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801fcb:	83 ec 08             	sub    $0x8,%esp
+  801fce:	ff 75 f0             	push   -0x10(%ebp)
+  801fd1:	6a 00                	push   $0x0
+  801fd3:	e8 cd ec ff ff       	call   800ca5 <sys_page_unmap>
+  801fd8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801fdb:	83 ec 08             	sub    $0x8,%esp
+  801fde:	ff 75 f4             	push   -0xc(%ebp)
+  801fe1:	6a 00                	push   $0x0
+  801fe3:	e8 bd ec ff ff       	call   800ca5 <sys_page_unmap>
+  801fe8:	83 c4 10             	add    $0x10,%esp
+}
+  801feb:	89 d8                	mov    %ebx,%eax
+  801fed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ff0:	5b                   	pop    %ebx
+  801ff1:	5e                   	pop    %esi
+  801ff2:	5d                   	pop    %ebp
+  801ff3:	c3                   	ret
+
+00801ff4 <pipeisclosed>:
+{
+  801ff4:	55                   	push   %ebp
+  801ff5:	89 e5                	mov    %esp,%ebp
+  801ff7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ffa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ffd:	50                   	push   %eax
+  801ffe:	ff 75 08             	push   0x8(%ebp)
+  802001:	e8 30 f2 ff ff       	call   801236 <fd_lookup>
+  802006:	83 c4 10             	add    $0x10,%esp
+  802009:	85 c0                	test   %eax,%eax
+  80200b:	78 18                	js     802025 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80200d:	83 ec 0c             	sub    $0xc,%esp
+  802010:	ff 75 f4             	push   -0xc(%ebp)
+  802013:	e8 b3 f1 ff ff       	call   8011cb <fd2data>
+  802018:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80201a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80201d:	e8 a8 fb ff ff       	call   801bca <_pipeisclosed>
+  802022:	83 c4 10             	add    $0x10,%esp
+}
+  802025:	c9                   	leave
+  802026:	c3                   	ret
+
+00802027 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802027:	b8 00 00 00 00       	mov    $0x0,%eax
+  80202c:	c3                   	ret
+
+0080202d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80202d:	55                   	push   %ebp
+  80202e:	89 e5                	mov    %esp,%ebp
+  802030:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802033:	68 36 2b 80 00       	push   $0x802b36
+  802038:	ff 75 0c             	push   0xc(%ebp)
+  80203b:	e8 ed e6 ff ff       	call   80072d <strcpy>
+	return 0;
+}
+  802040:	b8 00 00 00 00       	mov    $0x0,%eax
+  802045:	c9                   	leave
+  802046:	c3                   	ret
+
+00802047 <devcons_write>:
+{
+  802047:	55                   	push   %ebp
+  802048:	89 e5                	mov    %esp,%ebp
+  80204a:	57                   	push   %edi
+  80204b:	56                   	push   %esi
+  80204c:	53                   	push   %ebx
+  80204d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802053:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802058:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80205e:	eb 2e                	jmp    80208e <devcons_write+0x47>
+		m = n - tot;
+  802060:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802063:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802065:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80206a:	39 c3                	cmp    %eax,%ebx
+  80206c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80206f:	83 ec 04             	sub    $0x4,%esp
+  802072:	53                   	push   %ebx
+  802073:	89 f0                	mov    %esi,%eax
+  802075:	03 45 0c             	add    0xc(%ebp),%eax
+  802078:	50                   	push   %eax
+  802079:	57                   	push   %edi
+  80207a:	e8 34 e8 ff ff       	call   8008b3 <memmove>
+		sys_cputs(buf, m);
+  80207f:	83 c4 08             	add    $0x8,%esp
+  802082:	53                   	push   %ebx
+  802083:	57                   	push   %edi
+  802084:	e8 ca ea ff ff       	call   800b53 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802089:	01 de                	add    %ebx,%esi
+  80208b:	83 c4 10             	add    $0x10,%esp
+  80208e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802091:	72 cd                	jb     802060 <devcons_write+0x19>
+}
+  802093:	89 f0                	mov    %esi,%eax
+  802095:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802098:	5b                   	pop    %ebx
+  802099:	5e                   	pop    %esi
+  80209a:	5f                   	pop    %edi
+  80209b:	5d                   	pop    %ebp
+  80209c:	c3                   	ret
+
+0080209d <devcons_read>:
+{
+  80209d:	55                   	push   %ebp
+  80209e:	89 e5                	mov    %esp,%ebp
+  8020a0:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8020a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8020ac:	75 07                	jne    8020b5 <devcons_read+0x18>
+  8020ae:	eb 1f                	jmp    8020cf <devcons_read+0x32>
+		sys_yield();
+  8020b0:	e8 4c eb ff ff       	call   800c01 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8020b5:	e8 c8 ea ff ff       	call   800b82 <sys_cgetc>
+  8020ba:	85 c0                	test   %eax,%eax
+  8020bc:	74 f2                	je     8020b0 <devcons_read+0x13>
+	if (c < 0)
+  8020be:	78 0f                	js     8020cf <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8020c0:	83 f8 04             	cmp    $0x4,%eax
+  8020c3:	74 0c                	je     8020d1 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8020c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020c8:	88 02                	mov    %al,(%edx)
+	return 1;
+  8020ca:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8020cf:	c9                   	leave
+  8020d0:	c3                   	ret
+		return 0;
+  8020d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d6:	eb f7                	jmp    8020cf <devcons_read+0x32>
+
+008020d8 <cputchar>:
+{
+  8020d8:	55                   	push   %ebp
+  8020d9:	89 e5                	mov    %esp,%ebp
+  8020db:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8020de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020e1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8020e4:	6a 01                	push   $0x1
+  8020e6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020e9:	50                   	push   %eax
+  8020ea:	e8 64 ea ff ff       	call   800b53 <sys_cputs>
+}
+  8020ef:	83 c4 10             	add    $0x10,%esp
+  8020f2:	c9                   	leave
+  8020f3:	c3                   	ret
+
+008020f4 <getchar>:
+{
+  8020f4:	55                   	push   %ebp
+  8020f5:	89 e5                	mov    %esp,%ebp
+  8020f7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8020fa:	6a 01                	push   $0x1
+  8020fc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020ff:	50                   	push   %eax
+  802100:	6a 00                	push   $0x0
+  802102:	e8 8e f3 ff ff       	call   801495 <read>
+	if (r < 0)
+  802107:	83 c4 10             	add    $0x10,%esp
+  80210a:	85 c0                	test   %eax,%eax
+  80210c:	78 06                	js     802114 <getchar+0x20>
+	if (r < 1)
+  80210e:	74 06                	je     802116 <getchar+0x22>
+	return c;
+  802110:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802114:	c9                   	leave
+  802115:	c3                   	ret
+		return -E_EOF;
+  802116:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80211b:	eb f7                	jmp    802114 <getchar+0x20>
+
+0080211d <iscons>:
+{
+  80211d:	55                   	push   %ebp
+  80211e:	89 e5                	mov    %esp,%ebp
+  802120:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802123:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802126:	50                   	push   %eax
+  802127:	ff 75 08             	push   0x8(%ebp)
+  80212a:	e8 07 f1 ff ff       	call   801236 <fd_lookup>
+  80212f:	83 c4 10             	add    $0x10,%esp
+  802132:	85 c0                	test   %eax,%eax
+  802134:	78 11                	js     802147 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802136:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802139:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  80213f:	39 10                	cmp    %edx,(%eax)
+  802141:	0f 94 c0             	sete   %al
+  802144:	0f b6 c0             	movzbl %al,%eax
+}
+  802147:	c9                   	leave
+  802148:	c3                   	ret
+
+00802149 <opencons>:
+{
+  802149:	55                   	push   %ebp
+  80214a:	89 e5                	mov    %esp,%ebp
+  80214c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80214f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802152:	50                   	push   %eax
+  802153:	e8 8a f0 ff ff       	call   8011e2 <fd_alloc>
+  802158:	83 c4 10             	add    $0x10,%esp
+  80215b:	85 c0                	test   %eax,%eax
+  80215d:	78 3a                	js     802199 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80215f:	83 ec 04             	sub    $0x4,%esp
+  802162:	68 07 04 00 00       	push   $0x407
+  802167:	ff 75 f4             	push   -0xc(%ebp)
+  80216a:	6a 00                	push   $0x0
+  80216c:	e8 af ea ff ff       	call   800c20 <sys_page_alloc>
+  802171:	83 c4 10             	add    $0x10,%esp
+  802174:	85 c0                	test   %eax,%eax
+  802176:	78 21                	js     802199 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802178:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80217b:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  802181:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802183:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802186:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80218d:	83 ec 0c             	sub    $0xc,%esp
+  802190:	50                   	push   %eax
+  802191:	e8 25 f0 ff ff       	call   8011bb <fd2num>
+  802196:	83 c4 10             	add    $0x10,%esp
+}
+  802199:	c9                   	leave
+  80219a:	c3                   	ret
+
+0080219b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80219b:	55                   	push   %ebp
+  80219c:	89 e5                	mov    %esp,%ebp
+  80219e:	56                   	push   %esi
+  80219f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8021a0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8021a3:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  8021a9:	e8 34 ea ff ff       	call   800be2 <sys_getenvid>
+  8021ae:	83 ec 0c             	sub    $0xc,%esp
+  8021b1:	ff 75 0c             	push   0xc(%ebp)
+  8021b4:	ff 75 08             	push   0x8(%ebp)
+  8021b7:	56                   	push   %esi
+  8021b8:	50                   	push   %eax
+  8021b9:	68 44 2b 80 00       	push   $0x802b44
+  8021be:	e8 83 df ff ff       	call   800146 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8021c3:	83 c4 18             	add    $0x18,%esp
+  8021c6:	53                   	push   %ebx
+  8021c7:	ff 75 10             	push   0x10(%ebp)
+  8021ca:	e8 26 df ff ff       	call   8000f5 <vcprintf>
+	cprintf("\n");
+  8021cf:	c7 04 24 bc 26 80 00 	movl   $0x8026bc,(%esp)
+  8021d6:	e8 6b df ff ff       	call   800146 <cprintf>
+  8021db:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8021de:	cc                   	int3
+	while (1)
+  8021df:	eb fd                	jmp    8021de <_panic+0x43>
+
+008021e1 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8021e1:	55                   	push   %ebp
+  8021e2:	89 e5                	mov    %esp,%ebp
+  8021e4:	57                   	push   %edi
+  8021e5:	56                   	push   %esi
+  8021e6:	53                   	push   %ebx
+  8021e7:	83 ec 14             	sub    $0x14,%esp
+  8021ea:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021ed:	8b 75 14             	mov    0x14(%ebp),%esi
+  8021f0:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8021f3:	ff 75 10             	push   0x10(%ebp)
+  8021f6:	ff 75 0c             	push   0xc(%ebp)
+  8021f9:	e8 45 ee ff ff       	call   801043 <sys_ipc_recv_pages>
+  8021fe:	83 c4 10             	add    $0x10,%esp
+  802201:	85 c0                	test   %eax,%eax
+  802203:	78 46                	js     80224b <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802205:	85 ff                	test   %edi,%edi
+  802207:	74 0d                	je     802216 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  802209:	a1 08 40 80 00       	mov    0x804008,%eax
+  80220e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802214:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802216:	85 f6                	test   %esi,%esi
+  802218:	74 0d                	je     802227 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  80221a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80221f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802225:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802227:	85 db                	test   %ebx,%ebx
+  802229:	74 0d                	je     802238 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  80222b:	a1 08 40 80 00       	mov    0x804008,%eax
+  802230:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802236:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802238:	a1 08 40 80 00       	mov    0x804008,%eax
+  80223d:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802243:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802246:	5b                   	pop    %ebx
+  802247:	5e                   	pop    %esi
+  802248:	5f                   	pop    %edi
+  802249:	5d                   	pop    %ebp
+  80224a:	c3                   	ret
+		if (from_env_store) {
+  80224b:	85 ff                	test   %edi,%edi
+  80224d:	74 06                	je     802255 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80224f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802255:	85 f6                	test   %esi,%esi
+  802257:	74 06                	je     80225f <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  802259:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80225f:	85 db                	test   %ebx,%ebx
+  802261:	74 e0                	je     802243 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  802263:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802269:	eb d8                	jmp    802243 <ipc_recv_pages+0x62>
+
+0080226b <ipc_recv>:
+{
+  80226b:	55                   	push   %ebp
+  80226c:	89 e5                	mov    %esp,%ebp
+  80226e:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  802271:	6a 00                	push   $0x0
+  802273:	ff 75 10             	push   0x10(%ebp)
+  802276:	6a 01                	push   $0x1
+  802278:	ff 75 0c             	push   0xc(%ebp)
+  80227b:	ff 75 08             	push   0x8(%ebp)
+  80227e:	e8 5e ff ff ff       	call   8021e1 <ipc_recv_pages>
+}
+  802283:	c9                   	leave
+  802284:	c3                   	ret
+
+00802285 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802285:	55                   	push   %ebp
+  802286:	89 e5                	mov    %esp,%ebp
+  802288:	56                   	push   %esi
+  802289:	53                   	push   %ebx
+  80228a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80228d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  802290:	83 ec 0c             	sub    $0xc,%esp
+  802293:	ff 75 0c             	push   0xc(%ebp)
+  802296:	e8 dc ee ff ff       	call   801177 <sys_ipc_try_recv>
+  80229b:	83 c4 10             	add    $0x10,%esp
+  80229e:	85 c0                	test   %eax,%eax
+  8022a0:	78 34                	js     8022d6 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8022a2:	85 f6                	test   %esi,%esi
+  8022a4:	74 0d                	je     8022b3 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8022a6:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022ab:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8022b1:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8022b3:	85 db                	test   %ebx,%ebx
+  8022b5:	74 0d                	je     8022c4 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8022b7:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022bc:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8022c2:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8022c4:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022c9:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8022cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022d2:	5b                   	pop    %ebx
+  8022d3:	5e                   	pop    %esi
+  8022d4:	5d                   	pop    %ebp
+  8022d5:	c3                   	ret
+		if (from_env_store) {
+  8022d6:	85 f6                	test   %esi,%esi
+  8022d8:	74 06                	je     8022e0 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8022da:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8022e0:	85 db                	test   %ebx,%ebx
+  8022e2:	74 eb                	je     8022cf <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8022e4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8022ea:	eb e3                	jmp    8022cf <ipc_try_recv+0x4a>
+
+008022ec <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8022ec:	55                   	push   %ebp
+  8022ed:	89 e5                	mov    %esp,%ebp
+  8022ef:	83 ec 14             	sub    $0x14,%esp
+  8022f2:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8022f5:	85 c0                	test   %eax,%eax
+  8022f7:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8022fc:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8022ff:	ff 75 18             	push   0x18(%ebp)
+  802302:	ff 75 14             	push   0x14(%ebp)
+  802305:	50                   	push   %eax
+  802306:	ff 75 0c             	push   0xc(%ebp)
+  802309:	ff 75 08             	push   0x8(%ebp)
+  80230c:	e8 f5 ec ff ff       	call   801006 <sys_ipc_send_pages>
+  802311:	83 c4 20             	add    $0x20,%esp
+  802314:	85 c0                	test   %eax,%eax
+  802316:	78 02                	js     80231a <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  802318:	c9                   	leave
+  802319:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  80231a:	50                   	push   %eax
+  80231b:	68 68 2b 80 00       	push   $0x802b68
+  802320:	68 80 00 00 00       	push   $0x80
+  802325:	68 94 2b 80 00       	push   $0x802b94
+  80232a:	e8 6c fe ff ff       	call   80219b <_panic>
+
+0080232f <ipc_send>:
+{
+  80232f:	55                   	push   %ebp
+  802330:	89 e5                	mov    %esp,%ebp
+  802332:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  802335:	ff 75 14             	push   0x14(%ebp)
+  802338:	6a 01                	push   $0x1
+  80233a:	ff 75 10             	push   0x10(%ebp)
+  80233d:	ff 75 0c             	push   0xc(%ebp)
+  802340:	ff 75 08             	push   0x8(%ebp)
+  802343:	e8 a4 ff ff ff       	call   8022ec <ipc_send_pages>
+}
+  802348:	83 c4 20             	add    $0x20,%esp
+  80234b:	c9                   	leave
+  80234c:	c3                   	ret
+
+0080234d <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80234d:	55                   	push   %ebp
+  80234e:	89 e5                	mov    %esp,%ebp
+  802350:	83 ec 14             	sub    $0x14,%esp
+  802353:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802356:	85 c0                	test   %eax,%eax
+  802358:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80235d:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802360:	ff 75 18             	push   0x18(%ebp)
+  802363:	ff 75 14             	push   0x14(%ebp)
+  802366:	50                   	push   %eax
+  802367:	ff 75 0c             	push   0xc(%ebp)
+  80236a:	ff 75 08             	push   0x8(%ebp)
+  80236d:	e8 25 ed ff ff       	call   801097 <sys_ipc_call>
+  802372:	83 c4 20             	add    $0x20,%esp
+  802375:	85 c0                	test   %eax,%eax
+  802377:	78 0b                	js     802384 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  802379:	a1 08 40 80 00       	mov    0x804008,%eax
+  80237e:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802384:	c9                   	leave
+  802385:	c3                   	ret
+
+00802386 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  802386:	55                   	push   %ebp
+  802387:	89 e5                	mov    %esp,%ebp
+  802389:	57                   	push   %edi
+  80238a:	56                   	push   %esi
+  80238b:	53                   	push   %ebx
+  80238c:	83 ec 18             	sub    $0x18,%esp
+  80238f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802392:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  802395:	8b 75 20             	mov    0x20(%ebp),%esi
+  802398:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80239b:	85 c0                	test   %eax,%eax
+  80239d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8023a2:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8023a5:	ff 75 18             	push   0x18(%ebp)
+  8023a8:	ff 75 14             	push   0x14(%ebp)
+  8023ab:	50                   	push   %eax
+  8023ac:	ff 75 0c             	push   0xc(%ebp)
+  8023af:	ff 75 08             	push   0x8(%ebp)
+  8023b2:	e8 21 ed ff ff       	call   8010d8 <sys_ipc_reply_recv>
+  8023b7:	83 c4 20             	add    $0x20,%esp
+  8023ba:	85 c0                	test   %eax,%eax
+  8023bc:	78 46                	js     802404 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8023be:	85 ff                	test   %edi,%edi
+  8023c0:	74 0d                	je     8023cf <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8023c2:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023c7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8023cd:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8023cf:	85 f6                	test   %esi,%esi
+  8023d1:	74 0d                	je     8023e0 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8023d3:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023d8:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8023de:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8023e0:	85 db                	test   %ebx,%ebx
+  8023e2:	74 0d                	je     8023f1 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8023e4:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023e9:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8023ef:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8023f1:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023f6:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8023fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023ff:	5b                   	pop    %ebx
+  802400:	5e                   	pop    %esi
+  802401:	5f                   	pop    %edi
+  802402:	5d                   	pop    %ebp
+  802403:	c3                   	ret
+		if (from_env_store) {
+  802404:	85 ff                	test   %edi,%edi
+  802406:	74 06                	je     80240e <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  802408:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80240e:	85 f6                	test   %esi,%esi
+  802410:	74 06                	je     802418 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  802412:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802418:	85 db                	test   %ebx,%ebx
+  80241a:	74 e0                	je     8023fc <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  80241c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802422:	eb d8                	jmp    8023fc <ipc_reply_recv+0x76>
+
+00802424 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802424:	55                   	push   %ebp
+  802425:	89 e5                	mov    %esp,%ebp
+  802427:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80242a:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80242f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802432:	c1 e0 06             	shl    $0x6,%eax
+  802435:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80243a:	8b 40 50             	mov    0x50(%eax),%eax
+  80243d:	39 c8                	cmp    %ecx,%eax
+  80243f:	74 12                	je     802453 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802441:	83 c2 01             	add    $0x1,%edx
+  802444:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80244a:	75 e3                	jne    80242f <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80244c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802451:	eb 0e                	jmp    802461 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802453:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802456:	c1 e0 06             	shl    $0x6,%eax
+  802459:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80245e:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802461:	5d                   	pop    %ebp
+  802462:	c3                   	ret
+
+00802463 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802463:	55                   	push   %ebp
+  802464:	89 e5                	mov    %esp,%ebp
+  802466:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802469:	89 c2                	mov    %eax,%edx
+  80246b:	c1 ea 16             	shr    $0x16,%edx
+  80246e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802475:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80247a:	f6 c1 01             	test   $0x1,%cl
+  80247d:	74 1e                	je     80249d <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  80247f:	c1 e8 0c             	shr    $0xc,%eax
+  802482:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802489:	a8 01                	test   $0x1,%al
+  80248b:	74 10                	je     80249d <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80248d:	c1 e8 0c             	shr    $0xc,%eax
+  802490:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802493:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  80249a:	0f b7 d2             	movzwl %dx,%edx
+}
+  80249d:	89 d0                	mov    %edx,%eax
+  80249f:	5d                   	pop    %ebp
+  8024a0:	c3                   	ret
+
+008024a1 <udivmod>:
+  8024a1:	55                   	push   %ebp
+  8024a2:	57                   	push   %edi
+  8024a3:	56                   	push   %esi
+  8024a4:	53                   	push   %ebx
+  8024a5:	83 ec 24             	sub    $0x24,%esp
+  8024a8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8024ac:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8024b0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8024b4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8024b8:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024bc:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024c0:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8024c4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024da:	00 
+  8024db:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024e2:	00 
+  8024e3:	89 fb                	mov    %edi,%ebx
+  8024e5:	eb 08                	jmp    8024ef <udivmod+0x4e>
+  8024e7:	83 e9 01             	sub    $0x1,%ecx
+  8024ea:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8024ed:	74 68                	je     802557 <udivmod+0xb6>
+  8024ef:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024f3:	01 c0                	add    %eax,%eax
+  8024f5:	89 c6                	mov    %eax,%esi
+  8024f7:	89 d7                	mov    %edx,%edi
+  8024f9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8024fd:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802501:	0f ad d0             	shrd   %cl,%edx,%eax
+  802504:	d3 ea                	shr    %cl,%edx
+  802506:	f6 c1 20             	test   $0x20,%cl
+  802509:	74 04                	je     80250f <udivmod+0x6e>
+  80250b:	89 d0                	mov    %edx,%eax
+  80250d:	31 d2                	xor    %edx,%edx
+  80250f:	83 e0 01             	and    $0x1,%eax
+  802512:	89 04 24             	mov    %eax,(%esp)
+  802515:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80251c:	00 
+  80251d:	8b 04 24             	mov    (%esp),%eax
+  802520:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802524:	09 f0                	or     %esi,%eax
+  802526:	09 fa                	or     %edi,%edx
+  802528:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80252c:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802530:	39 f0                	cmp    %esi,%eax
+  802532:	89 d5                	mov    %edx,%ebp
+  802534:	19 fd                	sbb    %edi,%ebp
+  802536:	72 af                	jb     8024e7 <udivmod+0x46>
+  802538:	29 f0                	sub    %esi,%eax
+  80253a:	19 fa                	sbb    %edi,%edx
+  80253c:	89 cf                	mov    %ecx,%edi
+  80253e:	c1 ef 05             	shr    $0x5,%edi
+  802541:	83 e7 01             	and    $0x1,%edi
+  802544:	89 fe                	mov    %edi,%esi
+  802546:	83 f6 01             	xor    $0x1,%esi
+  802549:	d3 e6                	shl    %cl,%esi
+  80254b:	d3 e7                	shl    %cl,%edi
+  80254d:	09 74 24 18          	or     %esi,0x18(%esp)
+  802551:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802555:	eb 90                	jmp    8024e7 <udivmod+0x46>
+  802557:	85 db                	test   %ebx,%ebx
+  802559:	74 05                	je     802560 <udivmod+0xbf>
+  80255b:	89 03                	mov    %eax,(%ebx)
+  80255d:	89 53 04             	mov    %edx,0x4(%ebx)
+  802560:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802564:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802568:	83 c4 24             	add    $0x24,%esp
+  80256b:	5b                   	pop    %ebx
+  80256c:	5e                   	pop    %esi
+  80256d:	5f                   	pop    %edi
+  80256e:	5d                   	pop    %ebp
+  80256f:	c3                   	ret
+
+00802570 <__udivdi3>:
+  802570:	83 ec 08             	sub    $0x8,%esp
+  802573:	6a 00                	push   $0x0
+  802575:	ff 74 24 1c          	push   0x1c(%esp)
+  802579:	ff 74 24 1c          	push   0x1c(%esp)
+  80257d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802581:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802585:	e8 17 ff ff ff       	call   8024a1 <udivmod>
+  80258a:	83 c4 14             	add    $0x14,%esp
+  80258d:	c3                   	ret
+
+0080258e <__umoddi3>:
+  80258e:	83 ec 18             	sub    $0x18,%esp
+  802591:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802595:	50                   	push   %eax
+  802596:	ff 74 24 2c          	push   0x2c(%esp)
+  80259a:	ff 74 24 2c          	push   0x2c(%esp)
+  80259e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025a2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025a6:	e8 f6 fe ff ff       	call   8024a1 <udivmod>
+  8025ab:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025af:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025b3:	83 c4 24             	add    $0x24,%esp
+  8025b6:	c3                   	ret
+
+008025b7 <__divdi3>:
+  8025b7:	55                   	push   %ebp
+  8025b8:	57                   	push   %edi
+  8025b9:	56                   	push   %esi
+  8025ba:	53                   	push   %ebx
+  8025bb:	83 ec 10             	sub    $0x10,%esp
+  8025be:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8025c2:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8025c6:	89 c6                	mov    %eax,%esi
+  8025c8:	89 d7                	mov    %edx,%edi
+  8025ca:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8025ce:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8025d2:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025d6:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8025da:	89 c5                	mov    %eax,%ebp
+  8025dc:	f7 dd                	neg    %ebp
+  8025de:	89 d6                	mov    %edx,%esi
+  8025e0:	83 d6 00             	adc    $0x0,%esi
+  8025e3:	f7 de                	neg    %esi
+  8025e5:	0f 48 e8             	cmovs  %eax,%ebp
+  8025e8:	0f 49 d6             	cmovns %esi,%edx
+  8025eb:	6a 00                	push   $0x0
+  8025ed:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8025f1:	f7 de                	neg    %esi
+  8025f3:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8025f7:	83 d0 00             	adc    $0x0,%eax
+  8025fa:	f7 d8                	neg    %eax
+  8025fc:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  802601:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  802606:	50                   	push   %eax
+  802607:	56                   	push   %esi
+  802608:	89 e8                	mov    %ebp,%eax
+  80260a:	e8 92 fe ff ff       	call   8024a1 <udivmod>
+  80260f:	83 c4 10             	add    $0x10,%esp
+  802612:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  802617:	78 08                	js     802621 <__divdi3+0x6a>
+  802619:	83 c4 0c             	add    $0xc,%esp
+  80261c:	5b                   	pop    %ebx
+  80261d:	5e                   	pop    %esi
+  80261e:	5f                   	pop    %edi
+  80261f:	5d                   	pop    %ebp
+  802620:	c3                   	ret
+  802621:	f7 d8                	neg    %eax
+  802623:	83 d2 00             	adc    $0x0,%edx
+  802626:	f7 da                	neg    %edx
+  802628:	eb ef                	jmp    802619 <__divdi3+0x62>
+
+0080262a <__moddi3>:
+  80262a:	55                   	push   %ebp
+  80262b:	57                   	push   %edi
+  80262c:	56                   	push   %esi
+  80262d:	53                   	push   %ebx
+  80262e:	83 ec 18             	sub    $0x18,%esp
+  802631:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802635:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802639:	89 f1                	mov    %esi,%ecx
+  80263b:	f7 d9                	neg    %ecx
+  80263d:	89 da                	mov    %ebx,%edx
+  80263f:	83 d2 00             	adc    $0x0,%edx
+  802642:	f7 da                	neg    %edx
+  802644:	0f 48 ce             	cmovs  %esi,%ecx
+  802647:	0f 48 d3             	cmovs  %ebx,%edx
+  80264a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80264e:	50                   	push   %eax
+  80264f:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802653:	f7 de                	neg    %esi
+  802655:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802659:	83 d0 00             	adc    $0x0,%eax
+  80265c:	f7 d8                	neg    %eax
+  80265e:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802663:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802668:	50                   	push   %eax
+  802669:	56                   	push   %esi
+  80266a:	89 c8                	mov    %ecx,%eax
+  80266c:	e8 30 fe ff ff       	call   8024a1 <udivmod>
+  802671:	83 c4 10             	add    $0x10,%esp
+  802674:	85 db                	test   %ebx,%ebx
+  802676:	78 10                	js     802688 <__moddi3+0x5e>
+  802678:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80267c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802680:	83 c4 14             	add    $0x14,%esp
+  802683:	5b                   	pop    %ebx
+  802684:	5e                   	pop    %esi
+  802685:	5f                   	pop    %edi
+  802686:	5d                   	pop    %ebp
+  802687:	c3                   	ret
+  802688:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80268c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802690:	f7 d8                	neg    %eax
+  802692:	83 d2 00             	adc    $0x0,%edx
+  802695:	f7 da                	neg    %edx
+  802697:	eb e7                	jmp    802680 <__moddi3+0x56>
@@ -0,0 +1,10298 @@
+
+obj/user/faultregs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ae 05 00 00       	call   8005df <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <check_regs>:
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs* a, const char *an, struct regs* b, const char *bn,
+	   const char *testname)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	89 c6                	mov    %eax,%esi
+  80003e:	89 cb                	mov    %ecx,%ebx
+	int mismatch = 0;
+
+	cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  800040:	ff 75 08             	push   0x8(%ebp)
+  800043:	52                   	push   %edx
+  800044:	68 31 52 80 00       	push   $0x805231
+  800049:	68 00 52 80 00       	push   $0x805200
+  80004e:	e8 ca 06 00 00       	call   80071d <cprintf>
+			cprintf("MISMATCH\n");				\
+			mismatch = 1;					\
+		}							\
+	} while (0)
+
+	CHECK(edi, regs.reg_edi);
+  800053:	ff 33                	push   (%ebx)
+  800055:	ff 36                	push   (%esi)
+  800057:	68 10 52 80 00       	push   $0x805210
+  80005c:	68 14 52 80 00       	push   $0x805214
+  800061:	e8 b7 06 00 00       	call   80071d <cprintf>
+  800066:	83 c4 20             	add    $0x20,%esp
+  800069:	8b 03                	mov    (%ebx),%eax
+  80006b:	39 06                	cmp    %eax,(%esi)
+  80006d:	0f 84 2e 02 00 00    	je     8002a1 <check_regs+0x26e>
+  800073:	83 ec 0c             	sub    $0xc,%esp
+  800076:	68 28 52 80 00       	push   $0x805228
+  80007b:	e8 9d 06 00 00       	call   80071d <cprintf>
+  800080:	83 c4 10             	add    $0x10,%esp
+  800083:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(esi, regs.reg_esi);
+  800088:	ff 73 04             	push   0x4(%ebx)
+  80008b:	ff 76 04             	push   0x4(%esi)
+  80008e:	68 32 52 80 00       	push   $0x805232
+  800093:	68 14 52 80 00       	push   $0x805214
+  800098:	e8 80 06 00 00       	call   80071d <cprintf>
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8000a3:	39 46 04             	cmp    %eax,0x4(%esi)
+  8000a6:	0f 84 0f 02 00 00    	je     8002bb <check_regs+0x288>
+  8000ac:	83 ec 0c             	sub    $0xc,%esp
+  8000af:	68 28 52 80 00       	push   $0x805228
+  8000b4:	e8 64 06 00 00       	call   80071d <cprintf>
+  8000b9:	83 c4 10             	add    $0x10,%esp
+  8000bc:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ebp, regs.reg_ebp);
+  8000c1:	ff 73 08             	push   0x8(%ebx)
+  8000c4:	ff 76 08             	push   0x8(%esi)
+  8000c7:	68 36 52 80 00       	push   $0x805236
+  8000cc:	68 14 52 80 00       	push   $0x805214
+  8000d1:	e8 47 06 00 00       	call   80071d <cprintf>
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8000dc:	39 46 08             	cmp    %eax,0x8(%esi)
+  8000df:	0f 84 eb 01 00 00    	je     8002d0 <check_regs+0x29d>
+  8000e5:	83 ec 0c             	sub    $0xc,%esp
+  8000e8:	68 28 52 80 00       	push   $0x805228
+  8000ed:	e8 2b 06 00 00       	call   80071d <cprintf>
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ebx, regs.reg_ebx);
+  8000fa:	ff 73 10             	push   0x10(%ebx)
+  8000fd:	ff 76 10             	push   0x10(%esi)
+  800100:	68 3a 52 80 00       	push   $0x80523a
+  800105:	68 14 52 80 00       	push   $0x805214
+  80010a:	e8 0e 06 00 00       	call   80071d <cprintf>
+  80010f:	83 c4 10             	add    $0x10,%esp
+  800112:	8b 43 10             	mov    0x10(%ebx),%eax
+  800115:	39 46 10             	cmp    %eax,0x10(%esi)
+  800118:	0f 84 c7 01 00 00    	je     8002e5 <check_regs+0x2b2>
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	68 28 52 80 00       	push   $0x805228
+  800126:	e8 f2 05 00 00       	call   80071d <cprintf>
+  80012b:	83 c4 10             	add    $0x10,%esp
+  80012e:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(edx, regs.reg_edx);
+  800133:	ff 73 14             	push   0x14(%ebx)
+  800136:	ff 76 14             	push   0x14(%esi)
+  800139:	68 3e 52 80 00       	push   $0x80523e
+  80013e:	68 14 52 80 00       	push   $0x805214
+  800143:	e8 d5 05 00 00       	call   80071d <cprintf>
+  800148:	83 c4 10             	add    $0x10,%esp
+  80014b:	8b 43 14             	mov    0x14(%ebx),%eax
+  80014e:	39 46 14             	cmp    %eax,0x14(%esi)
+  800151:	0f 84 a3 01 00 00    	je     8002fa <check_regs+0x2c7>
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	68 28 52 80 00       	push   $0x805228
+  80015f:	e8 b9 05 00 00       	call   80071d <cprintf>
+  800164:	83 c4 10             	add    $0x10,%esp
+  800167:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ecx, regs.reg_ecx);
+  80016c:	ff 73 18             	push   0x18(%ebx)
+  80016f:	ff 76 18             	push   0x18(%esi)
+  800172:	68 42 52 80 00       	push   $0x805242
+  800177:	68 14 52 80 00       	push   $0x805214
+  80017c:	e8 9c 05 00 00       	call   80071d <cprintf>
+  800181:	83 c4 10             	add    $0x10,%esp
+  800184:	8b 43 18             	mov    0x18(%ebx),%eax
+  800187:	39 46 18             	cmp    %eax,0x18(%esi)
+  80018a:	0f 84 7f 01 00 00    	je     80030f <check_regs+0x2dc>
+  800190:	83 ec 0c             	sub    $0xc,%esp
+  800193:	68 28 52 80 00       	push   $0x805228
+  800198:	e8 80 05 00 00       	call   80071d <cprintf>
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eax, regs.reg_eax);
+  8001a5:	ff 73 1c             	push   0x1c(%ebx)
+  8001a8:	ff 76 1c             	push   0x1c(%esi)
+  8001ab:	68 46 52 80 00       	push   $0x805246
+  8001b0:	68 14 52 80 00       	push   $0x805214
+  8001b5:	e8 63 05 00 00       	call   80071d <cprintf>
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8001c0:	39 46 1c             	cmp    %eax,0x1c(%esi)
+  8001c3:	0f 84 5b 01 00 00    	je     800324 <check_regs+0x2f1>
+  8001c9:	83 ec 0c             	sub    $0xc,%esp
+  8001cc:	68 28 52 80 00       	push   $0x805228
+  8001d1:	e8 47 05 00 00       	call   80071d <cprintf>
+  8001d6:	83 c4 10             	add    $0x10,%esp
+  8001d9:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eip, eip);
+  8001de:	ff 73 20             	push   0x20(%ebx)
+  8001e1:	ff 76 20             	push   0x20(%esi)
+  8001e4:	68 4a 52 80 00       	push   $0x80524a
+  8001e9:	68 14 52 80 00       	push   $0x805214
+  8001ee:	e8 2a 05 00 00       	call   80071d <cprintf>
+  8001f3:	83 c4 10             	add    $0x10,%esp
+  8001f6:	8b 43 20             	mov    0x20(%ebx),%eax
+  8001f9:	39 46 20             	cmp    %eax,0x20(%esi)
+  8001fc:	0f 84 37 01 00 00    	je     800339 <check_regs+0x306>
+  800202:	83 ec 0c             	sub    $0xc,%esp
+  800205:	68 28 52 80 00       	push   $0x805228
+  80020a:	e8 0e 05 00 00       	call   80071d <cprintf>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eflags, eflags);
+  800217:	ff 73 24             	push   0x24(%ebx)
+  80021a:	ff 76 24             	push   0x24(%esi)
+  80021d:	68 4e 52 80 00       	push   $0x80524e
+  800222:	68 14 52 80 00       	push   $0x805214
+  800227:	e8 f1 04 00 00       	call   80071d <cprintf>
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	8b 43 24             	mov    0x24(%ebx),%eax
+  800232:	39 46 24             	cmp    %eax,0x24(%esi)
+  800235:	0f 84 13 01 00 00    	je     80034e <check_regs+0x31b>
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	68 28 52 80 00       	push   $0x805228
+  800243:	e8 d5 04 00 00       	call   80071d <cprintf>
+	CHECK(esp, esp);
+  800248:	ff 73 28             	push   0x28(%ebx)
+  80024b:	ff 76 28             	push   0x28(%esi)
+  80024e:	68 55 52 80 00       	push   $0x805255
+  800253:	68 14 52 80 00       	push   $0x805214
+  800258:	e8 c0 04 00 00       	call   80071d <cprintf>
+  80025d:	83 c4 20             	add    $0x20,%esp
+  800260:	8b 43 28             	mov    0x28(%ebx),%eax
+  800263:	39 46 28             	cmp    %eax,0x28(%esi)
+  800266:	0f 84 53 01 00 00    	je     8003bf <check_regs+0x38c>
+  80026c:	83 ec 0c             	sub    $0xc,%esp
+  80026f:	68 28 52 80 00       	push   $0x805228
+  800274:	e8 a4 04 00 00       	call   80071d <cprintf>
+
+#undef CHECK
+
+	cprintf("Registers %s ", testname);
+  800279:	83 c4 08             	add    $0x8,%esp
+  80027c:	ff 75 0c             	push   0xc(%ebp)
+  80027f:	68 59 52 80 00       	push   $0x805259
+  800284:	e8 94 04 00 00       	call   80071d <cprintf>
+  800289:	83 c4 10             	add    $0x10,%esp
+	if (!mismatch)
+		cprintf("OK\n");
+	else
+		cprintf("MISMATCH\n");
+  80028c:	83 ec 0c             	sub    $0xc,%esp
+  80028f:	68 28 52 80 00       	push   $0x805228
+  800294:	e8 84 04 00 00       	call   80071d <cprintf>
+  800299:	83 c4 10             	add    $0x10,%esp
+}
+  80029c:	e9 16 01 00 00       	jmp    8003b7 <check_regs+0x384>
+	CHECK(edi, regs.reg_edi);
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+  8002a4:	68 24 52 80 00       	push   $0x805224
+  8002a9:	e8 6f 04 00 00       	call   80071d <cprintf>
+  8002ae:	83 c4 10             	add    $0x10,%esp
+	int mismatch = 0;
+  8002b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b6:	e9 cd fd ff ff       	jmp    800088 <check_regs+0x55>
+	CHECK(esi, regs.reg_esi);
+  8002bb:	83 ec 0c             	sub    $0xc,%esp
+  8002be:	68 24 52 80 00       	push   $0x805224
+  8002c3:	e8 55 04 00 00       	call   80071d <cprintf>
+  8002c8:	83 c4 10             	add    $0x10,%esp
+  8002cb:	e9 f1 fd ff ff       	jmp    8000c1 <check_regs+0x8e>
+	CHECK(ebp, regs.reg_ebp);
+  8002d0:	83 ec 0c             	sub    $0xc,%esp
+  8002d3:	68 24 52 80 00       	push   $0x805224
+  8002d8:	e8 40 04 00 00       	call   80071d <cprintf>
+  8002dd:	83 c4 10             	add    $0x10,%esp
+  8002e0:	e9 15 fe ff ff       	jmp    8000fa <check_regs+0xc7>
+	CHECK(ebx, regs.reg_ebx);
+  8002e5:	83 ec 0c             	sub    $0xc,%esp
+  8002e8:	68 24 52 80 00       	push   $0x805224
+  8002ed:	e8 2b 04 00 00       	call   80071d <cprintf>
+  8002f2:	83 c4 10             	add    $0x10,%esp
+  8002f5:	e9 39 fe ff ff       	jmp    800133 <check_regs+0x100>
+	CHECK(edx, regs.reg_edx);
+  8002fa:	83 ec 0c             	sub    $0xc,%esp
+  8002fd:	68 24 52 80 00       	push   $0x805224
+  800302:	e8 16 04 00 00       	call   80071d <cprintf>
+  800307:	83 c4 10             	add    $0x10,%esp
+  80030a:	e9 5d fe ff ff       	jmp    80016c <check_regs+0x139>
+	CHECK(ecx, regs.reg_ecx);
+  80030f:	83 ec 0c             	sub    $0xc,%esp
+  800312:	68 24 52 80 00       	push   $0x805224
+  800317:	e8 01 04 00 00       	call   80071d <cprintf>
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	e9 81 fe ff ff       	jmp    8001a5 <check_regs+0x172>
+	CHECK(eax, regs.reg_eax);
+  800324:	83 ec 0c             	sub    $0xc,%esp
+  800327:	68 24 52 80 00       	push   $0x805224
+  80032c:	e8 ec 03 00 00       	call   80071d <cprintf>
+  800331:	83 c4 10             	add    $0x10,%esp
+  800334:	e9 a5 fe ff ff       	jmp    8001de <check_regs+0x1ab>
+	CHECK(eip, eip);
+  800339:	83 ec 0c             	sub    $0xc,%esp
+  80033c:	68 24 52 80 00       	push   $0x805224
+  800341:	e8 d7 03 00 00       	call   80071d <cprintf>
+  800346:	83 c4 10             	add    $0x10,%esp
+  800349:	e9 c9 fe ff ff       	jmp    800217 <check_regs+0x1e4>
+	CHECK(eflags, eflags);
+  80034e:	83 ec 0c             	sub    $0xc,%esp
+  800351:	68 24 52 80 00       	push   $0x805224
+  800356:	e8 c2 03 00 00       	call   80071d <cprintf>
+	CHECK(esp, esp);
+  80035b:	ff 73 28             	push   0x28(%ebx)
+  80035e:	ff 76 28             	push   0x28(%esi)
+  800361:	68 55 52 80 00       	push   $0x805255
+  800366:	68 14 52 80 00       	push   $0x805214
+  80036b:	e8 ad 03 00 00       	call   80071d <cprintf>
+  800370:	83 c4 20             	add    $0x20,%esp
+  800373:	8b 43 28             	mov    0x28(%ebx),%eax
+  800376:	39 46 28             	cmp    %eax,0x28(%esi)
+  800379:	0f 85 ed fe ff ff    	jne    80026c <check_regs+0x239>
+  80037f:	83 ec 0c             	sub    $0xc,%esp
+  800382:	68 24 52 80 00       	push   $0x805224
+  800387:	e8 91 03 00 00       	call   80071d <cprintf>
+	cprintf("Registers %s ", testname);
+  80038c:	83 c4 08             	add    $0x8,%esp
+  80038f:	ff 75 0c             	push   0xc(%ebp)
+  800392:	68 59 52 80 00       	push   $0x805259
+  800397:	e8 81 03 00 00       	call   80071d <cprintf>
+	if (!mismatch)
+  80039c:	83 c4 10             	add    $0x10,%esp
+  80039f:	85 ff                	test   %edi,%edi
+  8003a1:	0f 85 e5 fe ff ff    	jne    80028c <check_regs+0x259>
+		cprintf("OK\n");
+  8003a7:	83 ec 0c             	sub    $0xc,%esp
+  8003aa:	68 24 52 80 00       	push   $0x805224
+  8003af:	e8 69 03 00 00       	call   80071d <cprintf>
+  8003b4:	83 c4 10             	add    $0x10,%esp
+}
+  8003b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ba:	5b                   	pop    %ebx
+  8003bb:	5e                   	pop    %esi
+  8003bc:	5f                   	pop    %edi
+  8003bd:	5d                   	pop    %ebp
+  8003be:	c3                   	ret
+	CHECK(esp, esp);
+  8003bf:	83 ec 0c             	sub    $0xc,%esp
+  8003c2:	68 24 52 80 00       	push   $0x805224
+  8003c7:	e8 51 03 00 00       	call   80071d <cprintf>
+	cprintf("Registers %s ", testname);
+  8003cc:	83 c4 08             	add    $0x8,%esp
+  8003cf:	ff 75 0c             	push   0xc(%ebp)
+  8003d2:	68 59 52 80 00       	push   $0x805259
+  8003d7:	e8 41 03 00 00       	call   80071d <cprintf>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	e9 a8 fe ff ff       	jmp    80028c <check_regs+0x259>
+
+008003e4 <pgfault>:
+
+static int
+pgfault(struct UTrapframe *utf)
+{
+  8003e4:	55                   	push   %ebp
+  8003e5:	89 e5                	mov    %esp,%ebp
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	8b 45 08             	mov    0x8(%ebp),%eax
+	int r;
+
+	if (utf->utf_fault_va != (uint32_t)UTEMP)
+  8003ed:	8b 10                	mov    (%eax),%edx
+  8003ef:	81 fa 00 00 40 00    	cmp    $0x400000,%edx
+  8003f5:	0f 85 a1 00 00 00    	jne    80049c <pgfault+0xb8>
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+		      utf->utf_fault_va, utf->utf_eip);
+
+	// Check registers in UTrapframe
+	during.regs = utf->utf_regs;
+  8003fb:	8b 50 08             	mov    0x8(%eax),%edx
+  8003fe:	89 15 40 70 80 00    	mov    %edx,0x807040
+  800404:	8b 50 0c             	mov    0xc(%eax),%edx
+  800407:	89 15 44 70 80 00    	mov    %edx,0x807044
+  80040d:	8b 50 10             	mov    0x10(%eax),%edx
+  800410:	89 15 48 70 80 00    	mov    %edx,0x807048
+  800416:	8b 50 14             	mov    0x14(%eax),%edx
+  800419:	89 15 4c 70 80 00    	mov    %edx,0x80704c
+  80041f:	8b 50 18             	mov    0x18(%eax),%edx
+  800422:	89 15 50 70 80 00    	mov    %edx,0x807050
+  800428:	8b 50 1c             	mov    0x1c(%eax),%edx
+  80042b:	89 15 54 70 80 00    	mov    %edx,0x807054
+  800431:	8b 50 20             	mov    0x20(%eax),%edx
+  800434:	89 15 58 70 80 00    	mov    %edx,0x807058
+  80043a:	8b 50 24             	mov    0x24(%eax),%edx
+  80043d:	89 15 5c 70 80 00    	mov    %edx,0x80705c
+	during.eip = utf->utf_eip;
+  800443:	8b 50 28             	mov    0x28(%eax),%edx
+  800446:	89 15 60 70 80 00    	mov    %edx,0x807060
+	during.eflags = utf->utf_eflags;
+  80044c:	8b 50 2c             	mov    0x2c(%eax),%edx
+  80044f:	89 15 64 70 80 00    	mov    %edx,0x807064
+	during.esp = utf->utf_esp;
+  800455:	8b 40 30             	mov    0x30(%eax),%eax
+  800458:	a3 68 70 80 00       	mov    %eax,0x807068
+	check_regs(&before, "before", &during, "during", "in UTrapframe");
+  80045d:	83 ec 08             	sub    $0x8,%esp
+  800460:	68 7f 52 80 00       	push   $0x80527f
+  800465:	68 8d 52 80 00       	push   $0x80528d
+  80046a:	b9 40 70 80 00       	mov    $0x807040,%ecx
+  80046f:	ba 78 52 80 00       	mov    $0x805278,%edx
+  800474:	b8 80 70 80 00       	mov    $0x807080,%eax
+  800479:	e8 b5 fb ff ff       	call   800033 <check_regs>
+
+	// Map UTEMP so the write succeeds
+	if ((r = page_alloc(0, UTEMP, PTE_U|PTE_P|PTE_W, 1)) < 0)
+  80047e:	6a 01                	push   $0x1
+  800480:	6a 07                	push   $0x7
+  800482:	68 00 00 40 00       	push   $0x400000
+  800487:	6a 00                	push   $0x0
+  800489:	e8 85 36 00 00       	call   803b13 <page_alloc>
+  80048e:	83 c4 20             	add    $0x20,%esp
+  800491:	85 c0                	test   %eax,%eax
+  800493:	78 1f                	js     8004b4 <pgfault+0xd0>
+		panic("page_alloc: %e", r);
+	return 1;
+}
+  800495:	b8 01 00 00 00       	mov    $0x1,%eax
+  80049a:	c9                   	leave
+  80049b:	c3                   	ret
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+  80049c:	83 ec 0c             	sub    $0xc,%esp
+  80049f:	ff 70 28             	push   0x28(%eax)
+  8004a2:	52                   	push   %edx
+  8004a3:	68 bc 52 80 00       	push   $0x8052bc
+  8004a8:	6a 50                	push   $0x50
+  8004aa:	68 67 52 80 00       	push   $0x805267
+  8004af:	e8 8e 01 00 00       	call   800642 <_panic>
+		panic("page_alloc: %e", r);
+  8004b4:	50                   	push   %eax
+  8004b5:	68 94 52 80 00       	push   $0x805294
+  8004ba:	6a 5c                	push   $0x5c
+  8004bc:	68 67 52 80 00       	push   $0x805267
+  8004c1:	e8 7c 01 00 00       	call   800642 <_panic>
+
+008004c6 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8004c6:	55                   	push   %ebp
+  8004c7:	89 e5                	mov    %esp,%ebp
+  8004c9:	83 ec 14             	sub    $0x14,%esp
+	add_pgfault_handler(pgfault);
+  8004cc:	68 e4 03 80 00       	push   $0x8003e4
+  8004d1:	e8 4e 13 00 00       	call   801824 <add_pgfault_handler>
+
+	__asm __volatile(
+  8004d6:	50                   	push   %eax
+  8004d7:	9c                   	pushf
+  8004d8:	58                   	pop    %eax
+  8004d9:	0d d5 08 00 00       	or     $0x8d5,%eax
+  8004de:	50                   	push   %eax
+  8004df:	9d                   	popf
+  8004e0:	a3 a4 70 80 00       	mov    %eax,0x8070a4
+  8004e5:	8d 05 20 05 80 00    	lea    0x800520,%eax
+  8004eb:	a3 a0 70 80 00       	mov    %eax,0x8070a0
+  8004f0:	58                   	pop    %eax
+  8004f1:	89 3d 80 70 80 00    	mov    %edi,0x807080
+  8004f7:	89 35 84 70 80 00    	mov    %esi,0x807084
+  8004fd:	89 2d 88 70 80 00    	mov    %ebp,0x807088
+  800503:	89 1d 90 70 80 00    	mov    %ebx,0x807090
+  800509:	89 15 94 70 80 00    	mov    %edx,0x807094
+  80050f:	89 0d 98 70 80 00    	mov    %ecx,0x807098
+  800515:	a3 9c 70 80 00       	mov    %eax,0x80709c
+  80051a:	89 25 a8 70 80 00    	mov    %esp,0x8070a8
+  800520:	c7 05 00 00 40 00 2a 	movl   $0x2a,0x400000
+  800527:	00 00 00 
+  80052a:	89 3d 00 70 80 00    	mov    %edi,0x807000
+  800530:	89 35 04 70 80 00    	mov    %esi,0x807004
+  800536:	89 2d 08 70 80 00    	mov    %ebp,0x807008
+  80053c:	89 1d 10 70 80 00    	mov    %ebx,0x807010
+  800542:	89 15 14 70 80 00    	mov    %edx,0x807014
+  800548:	89 0d 18 70 80 00    	mov    %ecx,0x807018
+  80054e:	a3 1c 70 80 00       	mov    %eax,0x80701c
+  800553:	89 25 28 70 80 00    	mov    %esp,0x807028
+  800559:	8b 3d 80 70 80 00    	mov    0x807080,%edi
+  80055f:	8b 35 84 70 80 00    	mov    0x807084,%esi
+  800565:	8b 2d 88 70 80 00    	mov    0x807088,%ebp
+  80056b:	8b 1d 90 70 80 00    	mov    0x807090,%ebx
+  800571:	8b 15 94 70 80 00    	mov    0x807094,%edx
+  800577:	8b 0d 98 70 80 00    	mov    0x807098,%ecx
+  80057d:	a1 9c 70 80 00       	mov    0x80709c,%eax
+  800582:	8b 25 a8 70 80 00    	mov    0x8070a8,%esp
+  800588:	50                   	push   %eax
+  800589:	9c                   	pushf
+  80058a:	58                   	pop    %eax
+  80058b:	a3 24 70 80 00       	mov    %eax,0x807024
+  800590:	58                   	pop    %eax
+		: : "m" (before), "m" (after) : "memory", "cc");
+
+	// Check UTEMP to roughly determine that EIP was restored
+	// correctly (of course, we probably wouldn't get this far if
+	// it weren't)
+	if (*(int*)UTEMP != 42)
+  800591:	83 c4 10             	add    $0x10,%esp
+  800594:	83 3d 00 00 40 00 2a 	cmpl   $0x2a,0x400000
+  80059b:	75 30                	jne    8005cd <umain+0x107>
+		cprintf("EIP after page-fault MISMATCH\n");
+	after.eip = before.eip;
+  80059d:	a1 a0 70 80 00       	mov    0x8070a0,%eax
+  8005a2:	a3 20 70 80 00       	mov    %eax,0x807020
+
+	check_regs(&before, "before", &after, "after", "after page-fault");
+  8005a7:	83 ec 08             	sub    $0x8,%esp
+  8005aa:	68 a3 52 80 00       	push   $0x8052a3
+  8005af:	68 b4 52 80 00       	push   $0x8052b4
+  8005b4:	b9 00 70 80 00       	mov    $0x807000,%ecx
+  8005b9:	ba 78 52 80 00       	mov    $0x805278,%edx
+  8005be:	b8 80 70 80 00       	mov    $0x807080,%eax
+  8005c3:	e8 6b fa ff ff       	call   800033 <check_regs>
+}
+  8005c8:	83 c4 10             	add    $0x10,%esp
+  8005cb:	c9                   	leave
+  8005cc:	c3                   	ret
+		cprintf("EIP after page-fault MISMATCH\n");
+  8005cd:	83 ec 0c             	sub    $0xc,%esp
+  8005d0:	68 f0 52 80 00       	push   $0x8052f0
+  8005d5:	e8 43 01 00 00       	call   80071d <cprintf>
+  8005da:	83 c4 10             	add    $0x10,%esp
+  8005dd:	eb be                	jmp    80059d <umain+0xd7>
+
+008005df <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8005df:	55                   	push   %ebp
+  8005e0:	89 e5                	mov    %esp,%ebp
+  8005e2:	56                   	push   %esi
+  8005e3:	53                   	push   %ebx
+  8005e4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005e7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8005ea:	e8 ca 0b 00 00       	call   8011b9 <sys_getenvid>
+  8005ef:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8005f4:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005f7:	c1 e0 06             	shl    $0x6,%eax
+  8005fa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8005ff:	a3 14 e9 80 00       	mov    %eax,0x80e914
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800604:	85 db                	test   %ebx,%ebx
+  800606:	7e 07                	jle    80060f <libmain+0x30>
+		binaryname = argv[0];
+  800608:	8b 06                	mov    (%esi),%eax
+  80060a:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  80060f:	83 ec 08             	sub    $0x8,%esp
+  800612:	56                   	push   %esi
+  800613:	53                   	push   %ebx
+  800614:	e8 ad fe ff ff       	call   8004c6 <umain>
+
+	// exit gracefully
+	exit();
+  800619:	e8 0a 00 00 00       	call   800628 <exit>
+}
+  80061e:	83 c4 10             	add    $0x10,%esp
+  800621:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800624:	5b                   	pop    %ebx
+  800625:	5e                   	pop    %esi
+  800626:	5d                   	pop    %ebp
+  800627:	c3                   	ret
+
+00800628 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800628:	55                   	push   %ebp
+  800629:	89 e5                	mov    %esp,%ebp
+  80062b:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80062e:	e8 44 14 00 00       	call   801a77 <close_all>
+	sys_env_destroy(0);
+  800633:	83 ec 0c             	sub    $0xc,%esp
+  800636:	6a 00                	push   $0x0
+  800638:	e8 3b 0b 00 00       	call   801178 <sys_env_destroy>
+}
+  80063d:	83 c4 10             	add    $0x10,%esp
+  800640:	c9                   	leave
+  800641:	c3                   	ret
+
+00800642 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800642:	55                   	push   %ebp
+  800643:	89 e5                	mov    %esp,%ebp
+  800645:	56                   	push   %esi
+  800646:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800647:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80064a:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  800650:	e8 64 0b 00 00       	call   8011b9 <sys_getenvid>
+  800655:	83 ec 0c             	sub    $0xc,%esp
+  800658:	ff 75 0c             	push   0xc(%ebp)
+  80065b:	ff 75 08             	push   0x8(%ebp)
+  80065e:	56                   	push   %esi
+  80065f:	50                   	push   %eax
+  800660:	68 1c 53 80 00       	push   $0x80531c
+  800665:	e8 b3 00 00 00       	call   80071d <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80066a:	83 c4 18             	add    $0x18,%esp
+  80066d:	53                   	push   %ebx
+  80066e:	ff 75 10             	push   0x10(%ebp)
+  800671:	e8 56 00 00 00       	call   8006cc <vcprintf>
+	cprintf("\n");
+  800676:	c7 04 24 30 52 80 00 	movl   $0x805230,(%esp)
+  80067d:	e8 9b 00 00 00       	call   80071d <cprintf>
+  800682:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800685:	cc                   	int3
+	while (1)
+  800686:	eb fd                	jmp    800685 <_panic+0x43>
+
+00800688 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800688:	55                   	push   %ebp
+  800689:	89 e5                	mov    %esp,%ebp
+  80068b:	53                   	push   %ebx
+  80068c:	83 ec 04             	sub    $0x4,%esp
+  80068f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800692:	8b 13                	mov    (%ebx),%edx
+  800694:	8d 42 01             	lea    0x1(%edx),%eax
+  800697:	89 03                	mov    %eax,(%ebx)
+  800699:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80069c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8006a0:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8006a5:	74 09                	je     8006b0 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8006a7:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8006ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006ae:	c9                   	leave
+  8006af:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8006b0:	83 ec 08             	sub    $0x8,%esp
+  8006b3:	68 ff 00 00 00       	push   $0xff
+  8006b8:	8d 43 08             	lea    0x8(%ebx),%eax
+  8006bb:	50                   	push   %eax
+  8006bc:	e8 69 0a 00 00       	call   80112a <sys_cputs>
+		b->idx = 0;
+  8006c1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8006c7:	83 c4 10             	add    $0x10,%esp
+  8006ca:	eb db                	jmp    8006a7 <putch+0x1f>
+
+008006cc <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8006cc:	55                   	push   %ebp
+  8006cd:	89 e5                	mov    %esp,%ebp
+  8006cf:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8006d5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8006dc:	00 00 00 
+	b.cnt = 0;
+  8006df:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8006e6:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8006e9:	ff 75 0c             	push   0xc(%ebp)
+  8006ec:	ff 75 08             	push   0x8(%ebp)
+  8006ef:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8006f5:	50                   	push   %eax
+  8006f6:	68 88 06 80 00       	push   $0x800688
+  8006fb:	e8 14 01 00 00       	call   800814 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800700:	83 c4 08             	add    $0x8,%esp
+  800703:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800709:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80070f:	50                   	push   %eax
+  800710:	e8 15 0a 00 00       	call   80112a <sys_cputs>
+
+	return b.cnt;
+}
+  800715:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80071b:	c9                   	leave
+  80071c:	c3                   	ret
+
+0080071d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80071d:	55                   	push   %ebp
+  80071e:	89 e5                	mov    %esp,%ebp
+  800720:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800723:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800726:	50                   	push   %eax
+  800727:	ff 75 08             	push   0x8(%ebp)
+  80072a:	e8 9d ff ff ff       	call   8006cc <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80072f:	c9                   	leave
+  800730:	c3                   	ret
+
+00800731 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800731:	55                   	push   %ebp
+  800732:	89 e5                	mov    %esp,%ebp
+  800734:	57                   	push   %edi
+  800735:	56                   	push   %esi
+  800736:	53                   	push   %ebx
+  800737:	83 ec 1c             	sub    $0x1c,%esp
+  80073a:	89 c7                	mov    %eax,%edi
+  80073c:	89 d6                	mov    %edx,%esi
+  80073e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800741:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800744:	89 d1                	mov    %edx,%ecx
+  800746:	89 c2                	mov    %eax,%edx
+  800748:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80074b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80074e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800751:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800754:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800757:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80075e:	39 c2                	cmp    %eax,%edx
+  800760:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800763:	72 3e                	jb     8007a3 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800765:	83 ec 0c             	sub    $0xc,%esp
+  800768:	ff 75 18             	push   0x18(%ebp)
+  80076b:	83 eb 01             	sub    $0x1,%ebx
+  80076e:	53                   	push   %ebx
+  80076f:	50                   	push   %eax
+  800770:	83 ec 08             	sub    $0x8,%esp
+  800773:	ff 75 e4             	push   -0x1c(%ebp)
+  800776:	ff 75 e0             	push   -0x20(%ebp)
+  800779:	ff 75 dc             	push   -0x24(%ebp)
+  80077c:	ff 75 d8             	push   -0x28(%ebp)
+  80077f:	e8 4e 49 00 00       	call   8050d2 <__udivdi3>
+  800784:	83 c4 18             	add    $0x18,%esp
+  800787:	52                   	push   %edx
+  800788:	50                   	push   %eax
+  800789:	89 f2                	mov    %esi,%edx
+  80078b:	89 f8                	mov    %edi,%eax
+  80078d:	e8 9f ff ff ff       	call   800731 <printnum>
+  800792:	83 c4 20             	add    $0x20,%esp
+  800795:	eb 13                	jmp    8007aa <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800797:	83 ec 08             	sub    $0x8,%esp
+  80079a:	56                   	push   %esi
+  80079b:	ff 75 18             	push   0x18(%ebp)
+  80079e:	ff d7                	call   *%edi
+  8007a0:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8007a3:	83 eb 01             	sub    $0x1,%ebx
+  8007a6:	85 db                	test   %ebx,%ebx
+  8007a8:	7f ed                	jg     800797 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007aa:	83 ec 08             	sub    $0x8,%esp
+  8007ad:	56                   	push   %esi
+  8007ae:	83 ec 04             	sub    $0x4,%esp
+  8007b1:	ff 75 e4             	push   -0x1c(%ebp)
+  8007b4:	ff 75 e0             	push   -0x20(%ebp)
+  8007b7:	ff 75 dc             	push   -0x24(%ebp)
+  8007ba:	ff 75 d8             	push   -0x28(%ebp)
+  8007bd:	e8 2e 49 00 00       	call   8050f0 <__umoddi3>
+  8007c2:	83 c4 14             	add    $0x14,%esp
+  8007c5:	0f be 80 3f 53 80 00 	movsbl 0x80533f(%eax),%eax
+  8007cc:	50                   	push   %eax
+  8007cd:	ff d7                	call   *%edi
+}
+  8007cf:	83 c4 10             	add    $0x10,%esp
+  8007d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007d5:	5b                   	pop    %ebx
+  8007d6:	5e                   	pop    %esi
+  8007d7:	5f                   	pop    %edi
+  8007d8:	5d                   	pop    %ebp
+  8007d9:	c3                   	ret
+
+008007da <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8007da:	55                   	push   %ebp
+  8007db:	89 e5                	mov    %esp,%ebp
+  8007dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8007e0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8007e4:	8b 10                	mov    (%eax),%edx
+  8007e6:	3b 50 04             	cmp    0x4(%eax),%edx
+  8007e9:	73 0a                	jae    8007f5 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8007eb:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8007ee:	89 08                	mov    %ecx,(%eax)
+  8007f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007f3:	88 02                	mov    %al,(%edx)
+}
+  8007f5:	5d                   	pop    %ebp
+  8007f6:	c3                   	ret
+
+008007f7 <printfmt>:
+{
+  8007f7:	55                   	push   %ebp
+  8007f8:	89 e5                	mov    %esp,%ebp
+  8007fa:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8007fd:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800800:	50                   	push   %eax
+  800801:	ff 75 10             	push   0x10(%ebp)
+  800804:	ff 75 0c             	push   0xc(%ebp)
+  800807:	ff 75 08             	push   0x8(%ebp)
+  80080a:	e8 05 00 00 00       	call   800814 <vprintfmt>
+}
+  80080f:	83 c4 10             	add    $0x10,%esp
+  800812:	c9                   	leave
+  800813:	c3                   	ret
+
+00800814 <vprintfmt>:
+{
+  800814:	55                   	push   %ebp
+  800815:	89 e5                	mov    %esp,%ebp
+  800817:	57                   	push   %edi
+  800818:	56                   	push   %esi
+  800819:	53                   	push   %ebx
+  80081a:	83 ec 2c             	sub    $0x2c,%esp
+  80081d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800820:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800823:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800826:	eb 0a                	jmp    800832 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800828:	83 ec 08             	sub    $0x8,%esp
+  80082b:	53                   	push   %ebx
+  80082c:	50                   	push   %eax
+  80082d:	ff d6                	call   *%esi
+  80082f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800832:	83 c7 01             	add    $0x1,%edi
+  800835:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800839:	83 f8 25             	cmp    $0x25,%eax
+  80083c:	74 0c                	je     80084a <vprintfmt+0x36>
+			if (ch == '\0')
+  80083e:	85 c0                	test   %eax,%eax
+  800840:	75 e6                	jne    800828 <vprintfmt+0x14>
+}
+  800842:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800845:	5b                   	pop    %ebx
+  800846:	5e                   	pop    %esi
+  800847:	5f                   	pop    %edi
+  800848:	5d                   	pop    %ebp
+  800849:	c3                   	ret
+		padc = ' ';
+  80084a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80084e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800855:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80085c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800863:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800868:	8d 47 01             	lea    0x1(%edi),%eax
+  80086b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80086e:	0f b6 17             	movzbl (%edi),%edx
+  800871:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800874:	3c 55                	cmp    $0x55,%al
+  800876:	0f 87 c5 03 00 00    	ja     800c41 <vprintfmt+0x42d>
+  80087c:	0f b6 c0             	movzbl %al,%eax
+  80087f:	ff 24 85 c0 54 80 00 	jmp    *0x8054c0(,%eax,4)
+  800886:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800889:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80088d:	eb d9                	jmp    800868 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80088f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800892:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800896:	eb d0                	jmp    800868 <vprintfmt+0x54>
+  800898:	0f b6 d2             	movzbl %dl,%edx
+  80089b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80089e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8008a6:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8008a9:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8008ad:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8008b0:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8008b3:	83 f9 09             	cmp    $0x9,%ecx
+  8008b6:	77 55                	ja     80090d <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8008b8:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8008bb:	eb e9                	jmp    8008a6 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8008bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c0:	8b 00                	mov    (%eax),%eax
+  8008c2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008cb:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8008ce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8008d1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8008d5:	79 91                	jns    800868 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8008d7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008dd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8008e4:	eb 82                	jmp    800868 <vprintfmt+0x54>
+			if (width < 0)
+  8008e6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8008e9:	85 d2                	test   %edx,%edx
+  8008eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f0:	0f 49 c2             	cmovns %edx,%eax
+  8008f3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8008f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8008f9:	e9 6a ff ff ff       	jmp    800868 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8008fe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800901:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800908:	e9 5b ff ff ff       	jmp    800868 <vprintfmt+0x54>
+  80090d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800910:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800913:	eb bc                	jmp    8008d1 <vprintfmt+0xbd>
+			lflag++;
+  800915:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800918:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80091b:	e9 48 ff ff ff       	jmp    800868 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800920:	8b 45 14             	mov    0x14(%ebp),%eax
+  800923:	8d 78 04             	lea    0x4(%eax),%edi
+  800926:	83 ec 08             	sub    $0x8,%esp
+  800929:	53                   	push   %ebx
+  80092a:	ff 30                	push   (%eax)
+  80092c:	ff d6                	call   *%esi
+			break;
+  80092e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800931:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800934:	e9 63 02 00 00       	jmp    800b9c <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800939:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093c:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80093f:	8b 10                	mov    (%eax),%edx
+  800941:	89 d0                	mov    %edx,%eax
+  800943:	f7 d8                	neg    %eax
+  800945:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800948:	83 f8 12             	cmp    $0x12,%eax
+  80094b:	7f 23                	jg     800970 <vprintfmt+0x15c>
+  80094d:	8b 14 85 20 56 80 00 	mov    0x805620(,%eax,4),%edx
+  800954:	85 d2                	test   %edx,%edx
+  800956:	74 18                	je     800970 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800958:	52                   	push   %edx
+  800959:	68 a9 57 80 00       	push   $0x8057a9
+  80095e:	53                   	push   %ebx
+  80095f:	56                   	push   %esi
+  800960:	e8 92 fe ff ff       	call   8007f7 <printfmt>
+  800965:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800968:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80096b:	e9 2c 02 00 00       	jmp    800b9c <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  800970:	50                   	push   %eax
+  800971:	68 57 53 80 00       	push   $0x805357
+  800976:	53                   	push   %ebx
+  800977:	56                   	push   %esi
+  800978:	e8 7a fe ff ff       	call   8007f7 <printfmt>
+  80097d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800980:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800983:	e9 14 02 00 00       	jmp    800b9c <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800988:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098b:	83 c0 04             	add    $0x4,%eax
+  80098e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800991:	8b 45 14             	mov    0x14(%ebp),%eax
+  800994:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800996:	85 c9                	test   %ecx,%ecx
+  800998:	b8 50 53 80 00       	mov    $0x805350,%eax
+  80099d:	0f 45 c1             	cmovne %ecx,%eax
+  8009a0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8009a3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8009a7:	7e 06                	jle    8009af <vprintfmt+0x19b>
+  8009a9:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8009ad:	75 0b                	jne    8009ba <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009af:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8009b2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8009b5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8009b8:	eb 5c                	jmp    800a16 <vprintfmt+0x202>
+  8009ba:	83 ec 08             	sub    $0x8,%esp
+  8009bd:	ff 75 d0             	push   -0x30(%ebp)
+  8009c0:	ff 75 cc             	push   -0x34(%ebp)
+  8009c3:	e8 19 03 00 00       	call   800ce1 <strnlen>
+  8009c8:	89 c2                	mov    %eax,%edx
+  8009ca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009cd:	29 d0                	sub    %edx,%eax
+  8009cf:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8009d2:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8009d6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8009d9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8009dc:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009de:	eb 0e                	jmp    8009ee <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8009e0:	83 ec 08             	sub    $0x8,%esp
+  8009e3:	53                   	push   %ebx
+  8009e4:	57                   	push   %edi
+  8009e5:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009e8:	83 ee 01             	sub    $0x1,%esi
+  8009eb:	83 c4 10             	add    $0x10,%esp
+  8009ee:	85 f6                	test   %esi,%esi
+  8009f0:	7f ee                	jg     8009e0 <vprintfmt+0x1cc>
+  8009f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009f8:	85 c0                	test   %eax,%eax
+  8009fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009ff:	0f 49 d0             	cmovns %eax,%edx
+  800a02:	29 d0                	sub    %edx,%eax
+  800a04:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a07:	eb a6                	jmp    8009af <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800a09:	83 ec 08             	sub    $0x8,%esp
+  800a0c:	53                   	push   %ebx
+  800a0d:	52                   	push   %edx
+  800a0e:	ff 55 08             	call   *0x8(%ebp)
+  800a11:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a14:	89 f1                	mov    %esi,%ecx
+  800a16:	8d 71 01             	lea    0x1(%ecx),%esi
+  800a19:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800a1d:	0f be d0             	movsbl %al,%edx
+  800a20:	85 d2                	test   %edx,%edx
+  800a22:	74 28                	je     800a4c <vprintfmt+0x238>
+  800a24:	85 ff                	test   %edi,%edi
+  800a26:	78 05                	js     800a2d <vprintfmt+0x219>
+  800a28:	83 ef 01             	sub    $0x1,%edi
+  800a2b:	78 30                	js     800a5d <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800a2d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800a31:	74 d6                	je     800a09 <vprintfmt+0x1f5>
+  800a33:	0f be c0             	movsbl %al,%eax
+  800a36:	83 e8 20             	sub    $0x20,%eax
+  800a39:	83 f8 5e             	cmp    $0x5e,%eax
+  800a3c:	76 cb                	jbe    800a09 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800a3e:	83 ec 08             	sub    $0x8,%esp
+  800a41:	53                   	push   %ebx
+  800a42:	6a 3f                	push   $0x3f
+  800a44:	ff 55 08             	call   *0x8(%ebp)
+  800a47:	83 c4 10             	add    $0x10,%esp
+  800a4a:	eb c8                	jmp    800a14 <vprintfmt+0x200>
+  800a4c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a4f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a52:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800a55:	01 d0                	add    %edx,%eax
+  800a57:	29 c8                	sub    %ecx,%eax
+  800a59:	89 c7                	mov    %eax,%edi
+  800a5b:	eb 13                	jmp    800a70 <vprintfmt+0x25c>
+  800a5d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a60:	eb ed                	jmp    800a4f <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800a62:	83 ec 08             	sub    $0x8,%esp
+  800a65:	53                   	push   %ebx
+  800a66:	6a 20                	push   $0x20
+  800a68:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800a6a:	83 ef 01             	sub    $0x1,%edi
+  800a6d:	83 c4 10             	add    $0x10,%esp
+  800a70:	85 ff                	test   %edi,%edi
+  800a72:	7f ee                	jg     800a62 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a74:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800a77:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a7a:	e9 1d 01 00 00       	jmp    800b9c <vprintfmt+0x388>
+	if (lflag >= 2)
+  800a7f:	83 f9 01             	cmp    $0x1,%ecx
+  800a82:	7f 1b                	jg     800a9f <vprintfmt+0x28b>
+	else if (lflag)
+  800a84:	85 c9                	test   %ecx,%ecx
+  800a86:	74 63                	je     800aeb <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800a88:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a8b:	8b 00                	mov    (%eax),%eax
+  800a8d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a90:	99                   	cltd
+  800a91:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a94:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a97:	8d 40 04             	lea    0x4(%eax),%eax
+  800a9a:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a9d:	eb 17                	jmp    800ab6 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  800a9f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa2:	8b 50 04             	mov    0x4(%eax),%edx
+  800aa5:	8b 00                	mov    (%eax),%eax
+  800aa7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800aaa:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800aad:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ab0:	8d 40 08             	lea    0x8(%eax),%eax
+  800ab3:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800ab6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800ab9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800abc:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800ac1:	85 c9                	test   %ecx,%ecx
+  800ac3:	0f 89 b9 00 00 00    	jns    800b82 <vprintfmt+0x36e>
+				putch('-', putdat);
+  800ac9:	83 ec 08             	sub    $0x8,%esp
+  800acc:	53                   	push   %ebx
+  800acd:	6a 2d                	push   $0x2d
+  800acf:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800ad1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800ad4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800ad7:	f7 da                	neg    %edx
+  800ad9:	83 d1 00             	adc    $0x0,%ecx
+  800adc:	f7 d9                	neg    %ecx
+  800ade:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800ae1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800ae6:	e9 97 00 00 00       	jmp    800b82 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800aeb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aee:	8b 00                	mov    (%eax),%eax
+  800af0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800af3:	99                   	cltd
+  800af4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800af7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800afa:	8d 40 04             	lea    0x4(%eax),%eax
+  800afd:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b00:	eb b4                	jmp    800ab6 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  800b02:	83 f9 01             	cmp    $0x1,%ecx
+  800b05:	7f 1b                	jg     800b22 <vprintfmt+0x30e>
+	else if (lflag)
+  800b07:	85 c9                	test   %ecx,%ecx
+  800b09:	74 2c                	je     800b37 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800b0b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b0e:	8b 10                	mov    (%eax),%edx
+  800b10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b15:	8d 40 04             	lea    0x4(%eax),%eax
+  800b18:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b1b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800b20:	eb 60                	jmp    800b82 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800b22:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b25:	8b 10                	mov    (%eax),%edx
+  800b27:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b2a:	8d 40 08             	lea    0x8(%eax),%eax
+  800b2d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b30:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800b35:	eb 4b                	jmp    800b82 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800b37:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b3a:	8b 10                	mov    (%eax),%edx
+  800b3c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b41:	8d 40 04             	lea    0x4(%eax),%eax
+  800b44:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b47:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800b4c:	eb 34                	jmp    800b82 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800b4e:	83 f9 01             	cmp    $0x1,%ecx
+  800b51:	7f 15                	jg     800b68 <vprintfmt+0x354>
+	else if (lflag)
+  800b53:	85 c9                	test   %ecx,%ecx
+  800b55:	74 4d                	je     800ba4 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800b57:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b5a:	8b 00                	mov    (%eax),%eax
+  800b5c:	99                   	cltd
+  800b5d:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800b60:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800b63:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800b66:	eb 11                	jmp    800b79 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800b68:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b6b:	8b 50 04             	mov    0x4(%eax),%edx
+  800b6e:	8b 00                	mov    (%eax),%eax
+  800b70:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800b73:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800b76:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800b79:	89 d1                	mov    %edx,%ecx
+  800b7b:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800b7d:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800b82:	83 ec 0c             	sub    $0xc,%esp
+  800b85:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800b89:	50                   	push   %eax
+  800b8a:	ff 75 e0             	push   -0x20(%ebp)
+  800b8d:	57                   	push   %edi
+  800b8e:	51                   	push   %ecx
+  800b8f:	52                   	push   %edx
+  800b90:	89 da                	mov    %ebx,%edx
+  800b92:	89 f0                	mov    %esi,%eax
+  800b94:	e8 98 fb ff ff       	call   800731 <printnum>
+			break;
+  800b99:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800b9c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800b9f:	e9 8e fc ff ff       	jmp    800832 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800ba4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ba7:	8b 00                	mov    (%eax),%eax
+  800ba9:	99                   	cltd
+  800baa:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800bad:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800bb0:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800bb3:	eb c4                	jmp    800b79 <vprintfmt+0x365>
+			putch('0', putdat);
+  800bb5:	83 ec 08             	sub    $0x8,%esp
+  800bb8:	53                   	push   %ebx
+  800bb9:	6a 30                	push   $0x30
+  800bbb:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800bbd:	83 c4 08             	add    $0x8,%esp
+  800bc0:	53                   	push   %ebx
+  800bc1:	6a 78                	push   $0x78
+  800bc3:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800bc5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bc8:	8b 10                	mov    (%eax),%edx
+  800bca:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800bcf:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800bd2:	8d 40 04             	lea    0x4(%eax),%eax
+  800bd5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bd8:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800bdd:	eb a3                	jmp    800b82 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800bdf:	83 f9 01             	cmp    $0x1,%ecx
+  800be2:	7f 1b                	jg     800bff <vprintfmt+0x3eb>
+	else if (lflag)
+  800be4:	85 c9                	test   %ecx,%ecx
+  800be6:	74 2f                	je     800c17 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800be8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800beb:	8b 10                	mov    (%eax),%edx
+  800bed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf2:	8d 40 04             	lea    0x4(%eax),%eax
+  800bf5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bf8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800bfd:	eb 83                	jmp    800b82 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800bff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c02:	8b 10                	mov    (%eax),%edx
+  800c04:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c07:	8d 40 08             	lea    0x8(%eax),%eax
+  800c0a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c0d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800c12:	e9 6b ff ff ff       	jmp    800b82 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800c17:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c1a:	8b 10                	mov    (%eax),%edx
+  800c1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c21:	8d 40 04             	lea    0x4(%eax),%eax
+  800c24:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c27:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800c2c:	e9 51 ff ff ff       	jmp    800b82 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800c31:	83 ec 08             	sub    $0x8,%esp
+  800c34:	53                   	push   %ebx
+  800c35:	6a 25                	push   $0x25
+  800c37:	ff d6                	call   *%esi
+			break;
+  800c39:	83 c4 10             	add    $0x10,%esp
+  800c3c:	e9 5b ff ff ff       	jmp    800b9c <vprintfmt+0x388>
+			putch('%', putdat);
+  800c41:	83 ec 08             	sub    $0x8,%esp
+  800c44:	53                   	push   %ebx
+  800c45:	6a 25                	push   $0x25
+  800c47:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800c49:	83 c4 10             	add    $0x10,%esp
+  800c4c:	89 f8                	mov    %edi,%eax
+  800c4e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800c52:	74 05                	je     800c59 <vprintfmt+0x445>
+  800c54:	83 e8 01             	sub    $0x1,%eax
+  800c57:	eb f5                	jmp    800c4e <vprintfmt+0x43a>
+  800c59:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800c5c:	e9 3b ff ff ff       	jmp    800b9c <vprintfmt+0x388>
+
+00800c61 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c61:	55                   	push   %ebp
+  800c62:	89 e5                	mov    %esp,%ebp
+  800c64:	83 ec 18             	sub    $0x18,%esp
+  800c67:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800c6d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c70:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c74:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c77:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800c7e:	85 c0                	test   %eax,%eax
+  800c80:	74 26                	je     800ca8 <vsnprintf+0x47>
+  800c82:	85 d2                	test   %edx,%edx
+  800c84:	7e 22                	jle    800ca8 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800c86:	ff 75 14             	push   0x14(%ebp)
+  800c89:	ff 75 10             	push   0x10(%ebp)
+  800c8c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c8f:	50                   	push   %eax
+  800c90:	68 da 07 80 00       	push   $0x8007da
+  800c95:	e8 7a fb ff ff       	call   800814 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800c9a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800c9d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ca0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ca3:	83 c4 10             	add    $0x10,%esp
+}
+  800ca6:	c9                   	leave
+  800ca7:	c3                   	ret
+		return -E_INVAL;
+  800ca8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cad:	eb f7                	jmp    800ca6 <vsnprintf+0x45>
+
+00800caf <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800caf:	55                   	push   %ebp
+  800cb0:	89 e5                	mov    %esp,%ebp
+  800cb2:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800cb5:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800cb8:	50                   	push   %eax
+  800cb9:	ff 75 10             	push   0x10(%ebp)
+  800cbc:	ff 75 0c             	push   0xc(%ebp)
+  800cbf:	ff 75 08             	push   0x8(%ebp)
+  800cc2:	e8 9a ff ff ff       	call   800c61 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800cc7:	c9                   	leave
+  800cc8:	c3                   	ret
+
+00800cc9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800cc9:	55                   	push   %ebp
+  800cca:	89 e5                	mov    %esp,%ebp
+  800ccc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd4:	eb 03                	jmp    800cd9 <strlen+0x10>
+		n++;
+  800cd6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800cd9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800cdd:	75 f7                	jne    800cd6 <strlen+0xd>
+	return n;
+}
+  800cdf:	5d                   	pop    %ebp
+  800ce0:	c3                   	ret
+
+00800ce1 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800ce1:	55                   	push   %ebp
+  800ce2:	89 e5                	mov    %esp,%ebp
+  800ce4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ce7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cea:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cef:	eb 03                	jmp    800cf4 <strnlen+0x13>
+		n++;
+  800cf1:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cf4:	39 d0                	cmp    %edx,%eax
+  800cf6:	74 08                	je     800d00 <strnlen+0x1f>
+  800cf8:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800cfc:	75 f3                	jne    800cf1 <strnlen+0x10>
+  800cfe:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800d00:	89 d0                	mov    %edx,%eax
+  800d02:	5d                   	pop    %ebp
+  800d03:	c3                   	ret
+
+00800d04 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800d04:	55                   	push   %ebp
+  800d05:	89 e5                	mov    %esp,%ebp
+  800d07:	53                   	push   %ebx
+  800d08:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d0b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800d0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d13:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800d17:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800d1a:	83 c0 01             	add    $0x1,%eax
+  800d1d:	84 d2                	test   %dl,%dl
+  800d1f:	75 f2                	jne    800d13 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800d21:	89 c8                	mov    %ecx,%eax
+  800d23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d26:	c9                   	leave
+  800d27:	c3                   	ret
+
+00800d28 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800d28:	55                   	push   %ebp
+  800d29:	89 e5                	mov    %esp,%ebp
+  800d2b:	53                   	push   %ebx
+  800d2c:	83 ec 10             	sub    $0x10,%esp
+  800d2f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800d32:	53                   	push   %ebx
+  800d33:	e8 91 ff ff ff       	call   800cc9 <strlen>
+  800d38:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800d3b:	ff 75 0c             	push   0xc(%ebp)
+  800d3e:	01 d8                	add    %ebx,%eax
+  800d40:	50                   	push   %eax
+  800d41:	e8 be ff ff ff       	call   800d04 <strcpy>
+	return dst;
+}
+  800d46:	89 d8                	mov    %ebx,%eax
+  800d48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d4b:	c9                   	leave
+  800d4c:	c3                   	ret
+
+00800d4d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d4d:	55                   	push   %ebp
+  800d4e:	89 e5                	mov    %esp,%ebp
+  800d50:	56                   	push   %esi
+  800d51:	53                   	push   %ebx
+  800d52:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d55:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800d58:	89 f3                	mov    %esi,%ebx
+  800d5a:	03 5d 10             	add    0x10(%ebp),%ebx
+  800d5d:	89 f0                	mov    %esi,%eax
+  800d5f:	eb 0f                	jmp    800d70 <strncpy+0x23>
+		*dst++ = *src;
+  800d61:	83 c0 01             	add    $0x1,%eax
+  800d64:	0f b6 0a             	movzbl (%edx),%ecx
+  800d67:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800d6a:	80 f9 01             	cmp    $0x1,%cl
+  800d6d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800d70:	39 d8                	cmp    %ebx,%eax
+  800d72:	75 ed                	jne    800d61 <strncpy+0x14>
+	}
+	return ret;
+}
+  800d74:	89 f0                	mov    %esi,%eax
+  800d76:	5b                   	pop    %ebx
+  800d77:	5e                   	pop    %esi
+  800d78:	5d                   	pop    %ebp
+  800d79:	c3                   	ret
+
+00800d7a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800d7a:	55                   	push   %ebp
+  800d7b:	89 e5                	mov    %esp,%ebp
+  800d7d:	56                   	push   %esi
+  800d7e:	53                   	push   %ebx
+  800d7f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d85:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800d88:	89 f0                	mov    %esi,%eax
+  800d8a:	85 d2                	test   %edx,%edx
+  800d8c:	74 21                	je     800daf <strlcpy+0x35>
+  800d8e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800d92:	89 f2                	mov    %esi,%edx
+  800d94:	eb 09                	jmp    800d9f <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800d96:	83 c1 01             	add    $0x1,%ecx
+  800d99:	83 c2 01             	add    $0x1,%edx
+  800d9c:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800d9f:	39 c2                	cmp    %eax,%edx
+  800da1:	74 09                	je     800dac <strlcpy+0x32>
+  800da3:	0f b6 19             	movzbl (%ecx),%ebx
+  800da6:	84 db                	test   %bl,%bl
+  800da8:	75 ec                	jne    800d96 <strlcpy+0x1c>
+  800daa:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800dac:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800daf:	29 f0                	sub    %esi,%eax
+}
+  800db1:	5b                   	pop    %ebx
+  800db2:	5e                   	pop    %esi
+  800db3:	5d                   	pop    %ebp
+  800db4:	c3                   	ret
+
+00800db5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800db5:	55                   	push   %ebp
+  800db6:	89 e5                	mov    %esp,%ebp
+  800db8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800dbb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800dbe:	eb 06                	jmp    800dc6 <strcmp+0x11>
+		p++, q++;
+  800dc0:	83 c1 01             	add    $0x1,%ecx
+  800dc3:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800dc6:	0f b6 01             	movzbl (%ecx),%eax
+  800dc9:	84 c0                	test   %al,%al
+  800dcb:	74 04                	je     800dd1 <strcmp+0x1c>
+  800dcd:	3a 02                	cmp    (%edx),%al
+  800dcf:	74 ef                	je     800dc0 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800dd1:	0f b6 c0             	movzbl %al,%eax
+  800dd4:	0f b6 12             	movzbl (%edx),%edx
+  800dd7:	29 d0                	sub    %edx,%eax
+}
+  800dd9:	5d                   	pop    %ebp
+  800dda:	c3                   	ret
+
+00800ddb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ddb:	55                   	push   %ebp
+  800ddc:	89 e5                	mov    %esp,%ebp
+  800dde:	53                   	push   %ebx
+  800ddf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800de2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de5:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800de8:	eb 09                	jmp    800df3 <strncmp+0x18>
+		n--, p++, q++;
+  800dea:	83 ea 01             	sub    $0x1,%edx
+  800ded:	83 c0 01             	add    $0x1,%eax
+  800df0:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800df3:	85 d2                	test   %edx,%edx
+  800df5:	74 18                	je     800e0f <strncmp+0x34>
+  800df7:	0f b6 18             	movzbl (%eax),%ebx
+  800dfa:	84 db                	test   %bl,%bl
+  800dfc:	74 04                	je     800e02 <strncmp+0x27>
+  800dfe:	3a 19                	cmp    (%ecx),%bl
+  800e00:	74 e8                	je     800dea <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e02:	0f b6 00             	movzbl (%eax),%eax
+  800e05:	0f b6 11             	movzbl (%ecx),%edx
+  800e08:	29 d0                	sub    %edx,%eax
+}
+  800e0a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e0d:	c9                   	leave
+  800e0e:	c3                   	ret
+		return 0;
+  800e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e14:	eb f4                	jmp    800e0a <strncmp+0x2f>
+
+00800e16 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800e16:	55                   	push   %ebp
+  800e17:	89 e5                	mov    %esp,%ebp
+  800e19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e1c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e20:	eb 03                	jmp    800e25 <strchr+0xf>
+  800e22:	83 c0 01             	add    $0x1,%eax
+  800e25:	0f b6 10             	movzbl (%eax),%edx
+  800e28:	84 d2                	test   %dl,%dl
+  800e2a:	74 06                	je     800e32 <strchr+0x1c>
+		if (*s == c)
+  800e2c:	38 ca                	cmp    %cl,%dl
+  800e2e:	75 f2                	jne    800e22 <strchr+0xc>
+  800e30:	eb 05                	jmp    800e37 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800e32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e37:	5d                   	pop    %ebp
+  800e38:	c3                   	ret
+
+00800e39 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800e39:	55                   	push   %ebp
+  800e3a:	89 e5                	mov    %esp,%ebp
+  800e3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e3f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e43:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800e46:	38 ca                	cmp    %cl,%dl
+  800e48:	74 09                	je     800e53 <strfind+0x1a>
+  800e4a:	84 d2                	test   %dl,%dl
+  800e4c:	74 05                	je     800e53 <strfind+0x1a>
+	for (; *s; s++)
+  800e4e:	83 c0 01             	add    $0x1,%eax
+  800e51:	eb f0                	jmp    800e43 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800e53:	5d                   	pop    %ebp
+  800e54:	c3                   	ret
+
+00800e55 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	57                   	push   %edi
+  800e59:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e5c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800e5f:	85 c9                	test   %ecx,%ecx
+  800e61:	74 20                	je     800e83 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800e63:	89 f8                	mov    %edi,%eax
+  800e65:	09 c8                	or     %ecx,%eax
+  800e67:	a8 03                	test   $0x3,%al
+  800e69:	75 12                	jne    800e7d <memset+0x28>
+		c &= 0xFF;
+  800e6b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800e6f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800e75:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800e78:	fc                   	cld
+  800e79:	f3 ab                	rep stos %eax,%es:(%edi)
+  800e7b:	eb 06                	jmp    800e83 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800e7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e80:	fc                   	cld
+  800e81:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800e83:	89 f8                	mov    %edi,%eax
+  800e85:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800e88:	c9                   	leave
+  800e89:	c3                   	ret
+
+00800e8a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800e8a:	55                   	push   %ebp
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	57                   	push   %edi
+  800e8e:	56                   	push   %esi
+  800e8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e92:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e95:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800e98:	39 c6                	cmp    %eax,%esi
+  800e9a:	73 32                	jae    800ece <memmove+0x44>
+  800e9c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800e9f:	39 d0                	cmp    %edx,%eax
+  800ea1:	73 2b                	jae    800ece <memmove+0x44>
+		s += n;
+		d += n;
+  800ea3:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ea6:	89 d6                	mov    %edx,%esi
+  800ea8:	09 fe                	or     %edi,%esi
+  800eaa:	09 ce                	or     %ecx,%esi
+  800eac:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800eb2:	75 0e                	jne    800ec2 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800eb4:	83 ef 04             	sub    $0x4,%edi
+  800eb7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800eba:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ebd:	fd                   	std
+  800ebe:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ec0:	eb 09                	jmp    800ecb <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ec2:	83 ef 01             	sub    $0x1,%edi
+  800ec5:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ec8:	fd                   	std
+  800ec9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ecb:	fc                   	cld
+  800ecc:	eb 1a                	jmp    800ee8 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ece:	89 f2                	mov    %esi,%edx
+  800ed0:	09 c2                	or     %eax,%edx
+  800ed2:	09 ca                	or     %ecx,%edx
+  800ed4:	f6 c2 03             	test   $0x3,%dl
+  800ed7:	75 0a                	jne    800ee3 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ed9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800edc:	89 c7                	mov    %eax,%edi
+  800ede:	fc                   	cld
+  800edf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ee1:	eb 05                	jmp    800ee8 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ee3:	89 c7                	mov    %eax,%edi
+  800ee5:	fc                   	cld
+  800ee6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ee8:	5e                   	pop    %esi
+  800ee9:	5f                   	pop    %edi
+  800eea:	5d                   	pop    %ebp
+  800eeb:	c3                   	ret
+
+00800eec <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800eec:	55                   	push   %ebp
+  800eed:	89 e5                	mov    %esp,%ebp
+  800eef:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ef2:	ff 75 10             	push   0x10(%ebp)
+  800ef5:	ff 75 0c             	push   0xc(%ebp)
+  800ef8:	ff 75 08             	push   0x8(%ebp)
+  800efb:	e8 8a ff ff ff       	call   800e8a <memmove>
+}
+  800f00:	c9                   	leave
+  800f01:	c3                   	ret
+
+00800f02 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800f02:	55                   	push   %ebp
+  800f03:	89 e5                	mov    %esp,%ebp
+  800f05:	56                   	push   %esi
+  800f06:	53                   	push   %ebx
+  800f07:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f0a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800f0d:	89 c6                	mov    %eax,%esi
+  800f0f:	03 75 10             	add    0x10(%ebp),%esi
+  800f12:	eb 06                	jmp    800f1a <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800f14:	83 c0 01             	add    $0x1,%eax
+  800f17:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800f1a:	39 f0                	cmp    %esi,%eax
+  800f1c:	74 14                	je     800f32 <memcmp+0x30>
+		if (*s1 != *s2)
+  800f1e:	0f b6 08             	movzbl (%eax),%ecx
+  800f21:	0f b6 1a             	movzbl (%edx),%ebx
+  800f24:	38 d9                	cmp    %bl,%cl
+  800f26:	74 ec                	je     800f14 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800f28:	0f b6 c1             	movzbl %cl,%eax
+  800f2b:	0f b6 db             	movzbl %bl,%ebx
+  800f2e:	29 d8                	sub    %ebx,%eax
+  800f30:	eb 05                	jmp    800f37 <memcmp+0x35>
+	}
+
+	return 0;
+  800f32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f37:	5b                   	pop    %ebx
+  800f38:	5e                   	pop    %esi
+  800f39:	5d                   	pop    %ebp
+  800f3a:	c3                   	ret
+
+00800f3b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800f44:	89 c2                	mov    %eax,%edx
+  800f46:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800f49:	eb 03                	jmp    800f4e <memfind+0x13>
+  800f4b:	83 c0 01             	add    $0x1,%eax
+  800f4e:	39 d0                	cmp    %edx,%eax
+  800f50:	73 04                	jae    800f56 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800f52:	38 08                	cmp    %cl,(%eax)
+  800f54:	75 f5                	jne    800f4b <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800f56:	5d                   	pop    %ebp
+  800f57:	c3                   	ret
+
+00800f58 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800f58:	55                   	push   %ebp
+  800f59:	89 e5                	mov    %esp,%ebp
+  800f5b:	57                   	push   %edi
+  800f5c:	56                   	push   %esi
+  800f5d:	53                   	push   %ebx
+  800f5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800f64:	eb 03                	jmp    800f69 <strtol+0x11>
+		s++;
+  800f66:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800f69:	0f b6 02             	movzbl (%edx),%eax
+  800f6c:	3c 20                	cmp    $0x20,%al
+  800f6e:	74 f6                	je     800f66 <strtol+0xe>
+  800f70:	3c 09                	cmp    $0x9,%al
+  800f72:	74 f2                	je     800f66 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800f74:	3c 2b                	cmp    $0x2b,%al
+  800f76:	74 2a                	je     800fa2 <strtol+0x4a>
+	int neg = 0;
+  800f78:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800f7d:	3c 2d                	cmp    $0x2d,%al
+  800f7f:	74 2b                	je     800fac <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f81:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800f87:	75 0f                	jne    800f98 <strtol+0x40>
+  800f89:	80 3a 30             	cmpb   $0x30,(%edx)
+  800f8c:	74 28                	je     800fb6 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800f8e:	85 db                	test   %ebx,%ebx
+  800f90:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f95:	0f 44 d8             	cmove  %eax,%ebx
+  800f98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f9d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800fa0:	eb 46                	jmp    800fe8 <strtol+0x90>
+		s++;
+  800fa2:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800fa5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800faa:	eb d5                	jmp    800f81 <strtol+0x29>
+		s++, neg = 1;
+  800fac:	83 c2 01             	add    $0x1,%edx
+  800faf:	bf 01 00 00 00       	mov    $0x1,%edi
+  800fb4:	eb cb                	jmp    800f81 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800fb6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800fba:	74 0e                	je     800fca <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800fbc:	85 db                	test   %ebx,%ebx
+  800fbe:	75 d8                	jne    800f98 <strtol+0x40>
+		s++, base = 8;
+  800fc0:	83 c2 01             	add    $0x1,%edx
+  800fc3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800fc8:	eb ce                	jmp    800f98 <strtol+0x40>
+		s += 2, base = 16;
+  800fca:	83 c2 02             	add    $0x2,%edx
+  800fcd:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800fd2:	eb c4                	jmp    800f98 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800fd4:	0f be c0             	movsbl %al,%eax
+  800fd7:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800fda:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800fdd:	7d 3a                	jge    801019 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800fdf:	83 c2 01             	add    $0x1,%edx
+  800fe2:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800fe6:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800fe8:	0f b6 02             	movzbl (%edx),%eax
+  800feb:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800fee:	89 f3                	mov    %esi,%ebx
+  800ff0:	80 fb 09             	cmp    $0x9,%bl
+  800ff3:	76 df                	jbe    800fd4 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ff5:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ff8:	89 f3                	mov    %esi,%ebx
+  800ffa:	80 fb 19             	cmp    $0x19,%bl
+  800ffd:	77 08                	ja     801007 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800fff:	0f be c0             	movsbl %al,%eax
+  801002:	83 e8 57             	sub    $0x57,%eax
+  801005:	eb d3                	jmp    800fda <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801007:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80100a:	89 f3                	mov    %esi,%ebx
+  80100c:	80 fb 19             	cmp    $0x19,%bl
+  80100f:	77 08                	ja     801019 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801011:	0f be c0             	movsbl %al,%eax
+  801014:	83 e8 37             	sub    $0x37,%eax
+  801017:	eb c1                	jmp    800fda <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801019:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80101d:	74 05                	je     801024 <strtol+0xcc>
+		*endptr = (char *) s;
+  80101f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801022:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801024:	89 c8                	mov    %ecx,%eax
+  801026:	f7 d8                	neg    %eax
+  801028:	85 ff                	test   %edi,%edi
+  80102a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80102d:	89 c8                	mov    %ecx,%eax
+  80102f:	5b                   	pop    %ebx
+  801030:	5e                   	pop    %esi
+  801031:	5f                   	pop    %edi
+  801032:	5d                   	pop    %ebp
+  801033:	c3                   	ret
+
+00801034 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  801034:	55                   	push   %ebp
+  801035:	89 e5                	mov    %esp,%ebp
+  801037:	57                   	push   %edi
+  801038:	56                   	push   %esi
+  801039:	53                   	push   %ebx
+  80103a:	83 ec 0c             	sub    $0xc,%esp
+  80103d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801040:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801043:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  801046:	85 ff                	test   %edi,%edi
+  801048:	74 16                	je     801060 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  80104a:	83 ec 04             	sub    $0x4,%esp
+  80104d:	56                   	push   %esi
+  80104e:	6a 00                	push   $0x0
+  801050:	53                   	push   %ebx
+  801051:	e8 02 ff ff ff       	call   800f58 <strtol>
+  801056:	89 07                	mov    %eax,(%edi)
+  801058:	83 c4 10             	add    $0x10,%esp
+  80105b:	eb 03                	jmp    801060 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  80105d:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  801060:	0f b6 03             	movzbl (%ebx),%eax
+  801063:	3c 20                	cmp    $0x20,%al
+  801065:	74 f6                	je     80105d <strisl+0x29>
+  801067:	3c 09                	cmp    $0x9,%al
+  801069:	74 f2                	je     80105d <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  80106b:	3c 2b                	cmp    $0x2b,%al
+  80106d:	74 23                	je     801092 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  80106f:	3c 2d                	cmp    $0x2d,%al
+  801071:	0f 94 c0             	sete   %al
+  801074:	0f b6 c0             	movzbl %al,%eax
+  801077:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801079:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  80107f:	75 41                	jne    8010c2 <strisl+0x8e>
+  801081:	80 3b 30             	cmpb   $0x30,(%ebx)
+  801084:	74 11                	je     801097 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801086:	85 f6                	test   %esi,%esi
+  801088:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80108d:	0f 44 f0             	cmove  %eax,%esi
+  801090:	eb 30                	jmp    8010c2 <strisl+0x8e>
+		s++;
+  801092:	83 c3 01             	add    $0x1,%ebx
+  801095:	eb e2                	jmp    801079 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801097:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  80109b:	74 0e                	je     8010ab <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  80109d:	85 f6                	test   %esi,%esi
+  80109f:	75 21                	jne    8010c2 <strisl+0x8e>
+		s++, base = 8;
+  8010a1:	83 c3 01             	add    $0x1,%ebx
+  8010a4:	be 08 00 00 00       	mov    $0x8,%esi
+  8010a9:	eb 17                	jmp    8010c2 <strisl+0x8e>
+		s += 2, base = 16;
+  8010ab:	83 c3 02             	add    $0x2,%ebx
+  8010ae:	be 10 00 00 00       	mov    $0x10,%esi
+  8010b3:	eb 0d                	jmp    8010c2 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8010b5:	0f be c0             	movsbl %al,%eax
+  8010b8:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  8010bb:	39 f0                	cmp    %esi,%eax
+  8010bd:	7d 38                	jge    8010f7 <strisl+0xc3>
+			return 0;
+		s++;
+  8010bf:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  8010c2:	0f b6 03             	movzbl (%ebx),%eax
+  8010c5:	8d 50 d0             	lea    -0x30(%eax),%edx
+  8010c8:	80 fa 09             	cmp    $0x9,%dl
+  8010cb:	76 e8                	jbe    8010b5 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  8010cd:	8d 50 9f             	lea    -0x61(%eax),%edx
+  8010d0:	80 fa 19             	cmp    $0x19,%dl
+  8010d3:	77 08                	ja     8010dd <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  8010d5:	0f be c0             	movsbl %al,%eax
+  8010d8:	83 e8 57             	sub    $0x57,%eax
+  8010db:	eb de                	jmp    8010bb <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  8010dd:	8d 50 bf             	lea    -0x41(%eax),%edx
+  8010e0:	80 fa 19             	cmp    $0x19,%dl
+  8010e3:	77 08                	ja     8010ed <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  8010e5:	0f be c0             	movsbl %al,%eax
+  8010e8:	83 e8 37             	sub    $0x37,%eax
+  8010eb:	eb ce                	jmp    8010bb <strisl+0x87>
+		else if (!*s)
+  8010ed:	84 c0                	test   %al,%al
+  8010ef:	0f 94 c0             	sete   %al
+  8010f2:	0f b6 c0             	movzbl %al,%eax
+  8010f5:	eb 05                	jmp    8010fc <strisl+0xc8>
+			return 0;
+  8010f7:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  8010fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ff:	5b                   	pop    %ebx
+  801100:	5e                   	pop    %esi
+  801101:	5f                   	pop    %edi
+  801102:	5d                   	pop    %ebp
+  801103:	c3                   	ret
+
+00801104 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  801104:	55                   	push   %ebp
+  801105:	89 e5                	mov    %esp,%ebp
+  801107:	83 ec 10             	sub    $0x10,%esp
+  80110a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  80110d:	89 c8                	mov    %ecx,%eax
+  80110f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801114:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801117:	eb 0b                	jmp    801124 <touch_mem+0x20>
+		c = *(char *)page;
+  801119:	0f b6 10             	movzbl (%eax),%edx
+  80111c:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  80111f:	05 00 10 00 00       	add    $0x1000,%eax
+  801124:	39 c8                	cmp    %ecx,%eax
+  801126:	72 f1                	jb     801119 <touch_mem+0x15>
+}
+  801128:	c9                   	leave
+  801129:	c3                   	ret
+
+0080112a <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80112a:	55                   	push   %ebp
+  80112b:	89 e5                	mov    %esp,%ebp
+  80112d:	57                   	push   %edi
+  80112e:	56                   	push   %esi
+  80112f:	53                   	push   %ebx
+	touch_mem(s, len);
+  801130:	ff 75 0c             	push   0xc(%ebp)
+  801133:	ff 75 08             	push   0x8(%ebp)
+  801136:	e8 c9 ff ff ff       	call   801104 <touch_mem>
+	asm volatile("int %1\n"
+  80113b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801140:	8b 55 08             	mov    0x8(%ebp),%edx
+  801143:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801146:	89 c3                	mov    %eax,%ebx
+  801148:	89 c7                	mov    %eax,%edi
+  80114a:	89 c6                	mov    %eax,%esi
+  80114c:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80114e:	83 c4 08             	add    $0x8,%esp
+  801151:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801154:	5b                   	pop    %ebx
+  801155:	5e                   	pop    %esi
+  801156:	5f                   	pop    %edi
+  801157:	5d                   	pop    %ebp
+  801158:	c3                   	ret
+
+00801159 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801159:	55                   	push   %ebp
+  80115a:	89 e5                	mov    %esp,%ebp
+  80115c:	57                   	push   %edi
+  80115d:	56                   	push   %esi
+  80115e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80115f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801164:	b8 01 00 00 00       	mov    $0x1,%eax
+  801169:	89 d1                	mov    %edx,%ecx
+  80116b:	89 d3                	mov    %edx,%ebx
+  80116d:	89 d7                	mov    %edx,%edi
+  80116f:	89 d6                	mov    %edx,%esi
+  801171:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801173:	5b                   	pop    %ebx
+  801174:	5e                   	pop    %esi
+  801175:	5f                   	pop    %edi
+  801176:	5d                   	pop    %ebp
+  801177:	c3                   	ret
+
+00801178 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801178:	55                   	push   %ebp
+  801179:	89 e5                	mov    %esp,%ebp
+  80117b:	57                   	push   %edi
+  80117c:	56                   	push   %esi
+  80117d:	53                   	push   %ebx
+  80117e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801181:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801186:	8b 55 08             	mov    0x8(%ebp),%edx
+  801189:	b8 03 00 00 00       	mov    $0x3,%eax
+  80118e:	89 cb                	mov    %ecx,%ebx
+  801190:	89 cf                	mov    %ecx,%edi
+  801192:	89 ce                	mov    %ecx,%esi
+  801194:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801196:	85 c0                	test   %eax,%eax
+  801198:	7f 08                	jg     8011a2 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80119a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80119d:	5b                   	pop    %ebx
+  80119e:	5e                   	pop    %esi
+  80119f:	5f                   	pop    %edi
+  8011a0:	5d                   	pop    %ebp
+  8011a1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a2:	83 ec 0c             	sub    $0xc,%esp
+  8011a5:	50                   	push   %eax
+  8011a6:	6a 03                	push   $0x3
+  8011a8:	68 8b 56 80 00       	push   $0x80568b
+  8011ad:	6a 23                	push   $0x23
+  8011af:	68 a8 56 80 00       	push   $0x8056a8
+  8011b4:	e8 89 f4 ff ff       	call   800642 <_panic>
+
+008011b9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8011b9:	55                   	push   %ebp
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	57                   	push   %edi
+  8011bd:	56                   	push   %esi
+  8011be:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8011c9:	89 d1                	mov    %edx,%ecx
+  8011cb:	89 d3                	mov    %edx,%ebx
+  8011cd:	89 d7                	mov    %edx,%edi
+  8011cf:	89 d6                	mov    %edx,%esi
+  8011d1:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8011d3:	5b                   	pop    %ebx
+  8011d4:	5e                   	pop    %esi
+  8011d5:	5f                   	pop    %edi
+  8011d6:	5d                   	pop    %ebp
+  8011d7:	c3                   	ret
+
+008011d8 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8011d8:	55                   	push   %ebp
+  8011d9:	89 e5                	mov    %esp,%ebp
+  8011db:	57                   	push   %edi
+  8011dc:	56                   	push   %esi
+  8011dd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8011e8:	89 d1                	mov    %edx,%ecx
+  8011ea:	89 d3                	mov    %edx,%ebx
+  8011ec:	89 d7                	mov    %edx,%edi
+  8011ee:	89 d6                	mov    %edx,%esi
+  8011f0:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8011f2:	5b                   	pop    %ebx
+  8011f3:	5e                   	pop    %esi
+  8011f4:	5f                   	pop    %edi
+  8011f5:	5d                   	pop    %ebp
+  8011f6:	c3                   	ret
+
+008011f7 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8011f7:	55                   	push   %ebp
+  8011f8:	89 e5                	mov    %esp,%ebp
+  8011fa:	57                   	push   %edi
+  8011fb:	56                   	push   %esi
+  8011fc:	53                   	push   %ebx
+  8011fd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801200:	be 00 00 00 00       	mov    $0x0,%esi
+  801205:	8b 55 08             	mov    0x8(%ebp),%edx
+  801208:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801210:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801213:	89 f7                	mov    %esi,%edi
+  801215:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801217:	85 c0                	test   %eax,%eax
+  801219:	7f 08                	jg     801223 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80121b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80121e:	5b                   	pop    %ebx
+  80121f:	5e                   	pop    %esi
+  801220:	5f                   	pop    %edi
+  801221:	5d                   	pop    %ebp
+  801222:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801223:	83 ec 0c             	sub    $0xc,%esp
+  801226:	50                   	push   %eax
+  801227:	6a 04                	push   $0x4
+  801229:	68 8b 56 80 00       	push   $0x80568b
+  80122e:	6a 23                	push   $0x23
+  801230:	68 a8 56 80 00       	push   $0x8056a8
+  801235:	e8 08 f4 ff ff       	call   800642 <_panic>
+
+0080123a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80123a:	55                   	push   %ebp
+  80123b:	89 e5                	mov    %esp,%ebp
+  80123d:	57                   	push   %edi
+  80123e:	56                   	push   %esi
+  80123f:	53                   	push   %ebx
+  801240:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801243:	8b 55 08             	mov    0x8(%ebp),%edx
+  801246:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801249:	b8 05 00 00 00       	mov    $0x5,%eax
+  80124e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801251:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801254:	8b 75 18             	mov    0x18(%ebp),%esi
+  801257:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801259:	85 c0                	test   %eax,%eax
+  80125b:	7f 08                	jg     801265 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80125d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801260:	5b                   	pop    %ebx
+  801261:	5e                   	pop    %esi
+  801262:	5f                   	pop    %edi
+  801263:	5d                   	pop    %ebp
+  801264:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801265:	83 ec 0c             	sub    $0xc,%esp
+  801268:	50                   	push   %eax
+  801269:	6a 05                	push   $0x5
+  80126b:	68 8b 56 80 00       	push   $0x80568b
+  801270:	6a 23                	push   $0x23
+  801272:	68 a8 56 80 00       	push   $0x8056a8
+  801277:	e8 c6 f3 ff ff       	call   800642 <_panic>
+
+0080127c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80127c:	55                   	push   %ebp
+  80127d:	89 e5                	mov    %esp,%ebp
+  80127f:	57                   	push   %edi
+  801280:	56                   	push   %esi
+  801281:	53                   	push   %ebx
+  801282:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801285:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801290:	b8 06 00 00 00       	mov    $0x6,%eax
+  801295:	89 df                	mov    %ebx,%edi
+  801297:	89 de                	mov    %ebx,%esi
+  801299:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80129b:	85 c0                	test   %eax,%eax
+  80129d:	7f 08                	jg     8012a7 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80129f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a2:	5b                   	pop    %ebx
+  8012a3:	5e                   	pop    %esi
+  8012a4:	5f                   	pop    %edi
+  8012a5:	5d                   	pop    %ebp
+  8012a6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012a7:	83 ec 0c             	sub    $0xc,%esp
+  8012aa:	50                   	push   %eax
+  8012ab:	6a 06                	push   $0x6
+  8012ad:	68 8b 56 80 00       	push   $0x80568b
+  8012b2:	6a 23                	push   $0x23
+  8012b4:	68 a8 56 80 00       	push   $0x8056a8
+  8012b9:	e8 84 f3 ff ff       	call   800642 <_panic>
+
+008012be <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  8012be:	55                   	push   %ebp
+  8012bf:	89 e5                	mov    %esp,%ebp
+  8012c1:	57                   	push   %edi
+  8012c2:	56                   	push   %esi
+  8012c3:	53                   	push   %ebx
+  8012c4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d2:	b8 18 00 00 00       	mov    $0x18,%eax
+  8012d7:	89 df                	mov    %ebx,%edi
+  8012d9:	89 de                	mov    %ebx,%esi
+  8012db:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012dd:	85 c0                	test   %eax,%eax
+  8012df:	7f 08                	jg     8012e9 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8012e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e4:	5b                   	pop    %ebx
+  8012e5:	5e                   	pop    %esi
+  8012e6:	5f                   	pop    %edi
+  8012e7:	5d                   	pop    %ebp
+  8012e8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012e9:	83 ec 0c             	sub    $0xc,%esp
+  8012ec:	50                   	push   %eax
+  8012ed:	6a 18                	push   $0x18
+  8012ef:	68 8b 56 80 00       	push   $0x80568b
+  8012f4:	6a 23                	push   $0x23
+  8012f6:	68 a8 56 80 00       	push   $0x8056a8
+  8012fb:	e8 42 f3 ff ff       	call   800642 <_panic>
+
+00801300 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  801300:	55                   	push   %ebp
+  801301:	89 e5                	mov    %esp,%ebp
+  801303:	57                   	push   %edi
+  801304:	56                   	push   %esi
+  801305:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801306:	be 00 00 00 00       	mov    $0x0,%esi
+  80130b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801311:	b8 19 00 00 00       	mov    $0x19,%eax
+  801316:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801319:	89 f7                	mov    %esi,%edi
+  80131b:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  80131d:	5b                   	pop    %ebx
+  80131e:	5e                   	pop    %esi
+  80131f:	5f                   	pop    %edi
+  801320:	5d                   	pop    %ebp
+  801321:	c3                   	ret
+
+00801322 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  801322:	55                   	push   %ebp
+  801323:	89 e5                	mov    %esp,%ebp
+  801325:	57                   	push   %edi
+  801326:	56                   	push   %esi
+  801327:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801328:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80132e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801333:	be 00 00 00 00       	mov    $0x0,%esi
+  801338:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80133b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80133e:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  801340:	5b                   	pop    %ebx
+  801341:	5e                   	pop    %esi
+  801342:	5f                   	pop    %edi
+  801343:	5d                   	pop    %ebp
+  801344:	c3                   	ret
+
+00801345 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  801345:	55                   	push   %ebp
+  801346:	89 e5                	mov    %esp,%ebp
+  801348:	57                   	push   %edi
+  801349:	56                   	push   %esi
+  80134a:	53                   	push   %ebx
+  80134b:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  80134e:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  801351:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801357:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  80135a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801360:	b8 10 00 00 00       	mov    $0x10,%eax
+  801365:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801368:	8b 75 18             	mov    0x18(%ebp),%esi
+  80136b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80136d:	85 c0                	test   %eax,%eax
+  80136f:	7f 08                	jg     801379 <sys_page_map_range+0x34>
+}
+  801371:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801374:	5b                   	pop    %ebx
+  801375:	5e                   	pop    %esi
+  801376:	5f                   	pop    %edi
+  801377:	5d                   	pop    %ebp
+  801378:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801379:	83 ec 0c             	sub    $0xc,%esp
+  80137c:	50                   	push   %eax
+  80137d:	6a 10                	push   $0x10
+  80137f:	68 8b 56 80 00       	push   $0x80568b
+  801384:	6a 23                	push   $0x23
+  801386:	68 a8 56 80 00       	push   $0x8056a8
+  80138b:	e8 b2 f2 ff ff       	call   800642 <_panic>
+
+00801390 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  801390:	55                   	push   %ebp
+  801391:	89 e5                	mov    %esp,%ebp
+  801393:	57                   	push   %edi
+  801394:	56                   	push   %esi
+  801395:	53                   	push   %ebx
+  801396:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801399:	be 00 00 00 00       	mov    $0x0,%esi
+  80139e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a4:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ac:	89 f7                	mov    %esi,%edi
+  8013ae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013b0:	85 c0                	test   %eax,%eax
+  8013b2:	7f 08                	jg     8013bc <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8013b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b7:	5b                   	pop    %ebx
+  8013b8:	5e                   	pop    %esi
+  8013b9:	5f                   	pop    %edi
+  8013ba:	5d                   	pop    %ebp
+  8013bb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013bc:	83 ec 0c             	sub    $0xc,%esp
+  8013bf:	50                   	push   %eax
+  8013c0:	6a 11                	push   $0x11
+  8013c2:	68 8b 56 80 00       	push   $0x80568b
+  8013c7:	6a 23                	push   $0x23
+  8013c9:	68 a8 56 80 00       	push   $0x8056a8
+  8013ce:	e8 6f f2 ff ff       	call   800642 <_panic>
+
+008013d3 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  8013d3:	55                   	push   %ebp
+  8013d4:	89 e5                	mov    %esp,%ebp
+  8013d6:	57                   	push   %edi
+  8013d7:	56                   	push   %esi
+  8013d8:	53                   	push   %ebx
+  8013d9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8013ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ef:	89 f7                	mov    %esi,%edi
+  8013f1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013f3:	85 c0                	test   %eax,%eax
+  8013f5:	7f 08                	jg     8013ff <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8013f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013fa:	5b                   	pop    %ebx
+  8013fb:	5e                   	pop    %esi
+  8013fc:	5f                   	pop    %edi
+  8013fd:	5d                   	pop    %ebp
+  8013fe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013ff:	83 ec 0c             	sub    $0xc,%esp
+  801402:	50                   	push   %eax
+  801403:	6a 1b                	push   $0x1b
+  801405:	68 8b 56 80 00       	push   $0x80568b
+  80140a:	6a 23                	push   $0x23
+  80140c:	68 a8 56 80 00       	push   $0x8056a8
+  801411:	e8 2c f2 ff ff       	call   800642 <_panic>
+
+00801416 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  801416:	55                   	push   %ebp
+  801417:	89 e5                	mov    %esp,%ebp
+  801419:	57                   	push   %edi
+  80141a:	56                   	push   %esi
+  80141b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80141c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801421:	b8 12 00 00 00       	mov    $0x12,%eax
+  801426:	89 d1                	mov    %edx,%ecx
+  801428:	89 d3                	mov    %edx,%ebx
+  80142a:	89 d7                	mov    %edx,%edi
+  80142c:	89 d6                	mov    %edx,%esi
+  80142e:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801430:	5b                   	pop    %ebx
+  801431:	5e                   	pop    %esi
+  801432:	5f                   	pop    %edi
+  801433:	5d                   	pop    %ebp
+  801434:	c3                   	ret
+
+00801435 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801435:	55                   	push   %ebp
+  801436:	89 e5                	mov    %esp,%ebp
+  801438:	57                   	push   %edi
+  801439:	56                   	push   %esi
+  80143a:	53                   	push   %ebx
+  80143b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80143e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801443:	8b 55 08             	mov    0x8(%ebp),%edx
+  801446:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801449:	b8 08 00 00 00       	mov    $0x8,%eax
+  80144e:	89 df                	mov    %ebx,%edi
+  801450:	89 de                	mov    %ebx,%esi
+  801452:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801454:	85 c0                	test   %eax,%eax
+  801456:	7f 08                	jg     801460 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801458:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80145b:	5b                   	pop    %ebx
+  80145c:	5e                   	pop    %esi
+  80145d:	5f                   	pop    %edi
+  80145e:	5d                   	pop    %ebp
+  80145f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801460:	83 ec 0c             	sub    $0xc,%esp
+  801463:	50                   	push   %eax
+  801464:	6a 08                	push   $0x8
+  801466:	68 8b 56 80 00       	push   $0x80568b
+  80146b:	6a 23                	push   $0x23
+  80146d:	68 a8 56 80 00       	push   $0x8056a8
+  801472:	e8 cb f1 ff ff       	call   800642 <_panic>
+
+00801477 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801477:	55                   	push   %ebp
+  801478:	89 e5                	mov    %esp,%ebp
+  80147a:	57                   	push   %edi
+  80147b:	56                   	push   %esi
+  80147c:	53                   	push   %ebx
+  80147d:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  801480:	6a 44                	push   $0x44
+  801482:	ff 75 0c             	push   0xc(%ebp)
+  801485:	e8 7a fc ff ff       	call   801104 <touch_mem>
+	asm volatile("int %1\n"
+  80148a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801492:	b8 09 00 00 00       	mov    $0x9,%eax
+  801497:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149a:	89 df                	mov    %ebx,%edi
+  80149c:	89 de                	mov    %ebx,%esi
+  80149e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014a0:	83 c4 08             	add    $0x8,%esp
+  8014a3:	85 c0                	test   %eax,%eax
+  8014a5:	7f 08                	jg     8014af <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8014a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014aa:	5b                   	pop    %ebx
+  8014ab:	5e                   	pop    %esi
+  8014ac:	5f                   	pop    %edi
+  8014ad:	5d                   	pop    %ebp
+  8014ae:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014af:	83 ec 0c             	sub    $0xc,%esp
+  8014b2:	50                   	push   %eax
+  8014b3:	6a 09                	push   $0x9
+  8014b5:	68 8b 56 80 00       	push   $0x80568b
+  8014ba:	6a 23                	push   $0x23
+  8014bc:	68 a8 56 80 00       	push   $0x8056a8
+  8014c1:	e8 7c f1 ff ff       	call   800642 <_panic>
+
+008014c6 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  8014c6:	55                   	push   %ebp
+  8014c7:	89 e5                	mov    %esp,%ebp
+  8014c9:	57                   	push   %edi
+  8014ca:	56                   	push   %esi
+  8014cb:	53                   	push   %ebx
+  8014cc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8014cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014da:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014e2:	89 f7                	mov    %esi,%edi
+  8014e4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014e6:	85 c0                	test   %eax,%eax
+  8014e8:	7f 08                	jg     8014f2 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  8014ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ed:	5b                   	pop    %ebx
+  8014ee:	5e                   	pop    %esi
+  8014ef:	5f                   	pop    %edi
+  8014f0:	5d                   	pop    %ebp
+  8014f1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014f2:	83 ec 0c             	sub    $0xc,%esp
+  8014f5:	50                   	push   %eax
+  8014f6:	6a 1a                	push   $0x1a
+  8014f8:	68 8b 56 80 00       	push   $0x80568b
+  8014fd:	6a 23                	push   $0x23
+  8014ff:	68 a8 56 80 00       	push   $0x8056a8
+  801504:	e8 39 f1 ff ff       	call   800642 <_panic>
+
+00801509 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  801509:	55                   	push   %ebp
+  80150a:	89 e5                	mov    %esp,%ebp
+  80150c:	57                   	push   %edi
+  80150d:	56                   	push   %esi
+  80150e:	53                   	push   %ebx
+  80150f:	83 ec 0c             	sub    $0xc,%esp
+  801512:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801515:	89 d8                	mov    %ebx,%eax
+  801517:	c1 e0 05             	shl    $0x5,%eax
+  80151a:	50                   	push   %eax
+  80151b:	ff 75 0c             	push   0xc(%ebp)
+  80151e:	e8 e1 fb ff ff       	call   801104 <touch_mem>
+	asm volatile("int %1\n"
+  801523:	be 00 00 00 00       	mov    $0x0,%esi
+  801528:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801530:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801533:	89 f7                	mov    %esi,%edi
+  801535:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801537:	83 c4 08             	add    $0x8,%esp
+  80153a:	85 c0                	test   %eax,%eax
+  80153c:	7f 08                	jg     801546 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  80153e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801541:	5b                   	pop    %ebx
+  801542:	5e                   	pop    %esi
+  801543:	5f                   	pop    %edi
+  801544:	5d                   	pop    %ebp
+  801545:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801546:	83 ec 0c             	sub    $0xc,%esp
+  801549:	50                   	push   %eax
+  80154a:	6a 13                	push   $0x13
+  80154c:	68 8b 56 80 00       	push   $0x80568b
+  801551:	6a 23                	push   $0x23
+  801553:	68 a8 56 80 00       	push   $0x8056a8
+  801558:	e8 e5 f0 ff ff       	call   800642 <_panic>
+
+0080155d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80155d:	55                   	push   %ebp
+  80155e:	89 e5                	mov    %esp,%ebp
+  801560:	57                   	push   %edi
+  801561:	56                   	push   %esi
+  801562:	53                   	push   %ebx
+  801563:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801566:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801571:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801576:	89 df                	mov    %ebx,%edi
+  801578:	89 de                	mov    %ebx,%esi
+  80157a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80157c:	85 c0                	test   %eax,%eax
+  80157e:	7f 08                	jg     801588 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801580:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801583:	5b                   	pop    %ebx
+  801584:	5e                   	pop    %esi
+  801585:	5f                   	pop    %edi
+  801586:	5d                   	pop    %ebp
+  801587:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801588:	83 ec 0c             	sub    $0xc,%esp
+  80158b:	50                   	push   %eax
+  80158c:	6a 0a                	push   $0xa
+  80158e:	68 8b 56 80 00       	push   $0x80568b
+  801593:	6a 23                	push   $0x23
+  801595:	68 a8 56 80 00       	push   $0x8056a8
+  80159a:	e8 a3 f0 ff ff       	call   800642 <_panic>
+
+0080159f <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80159f:	55                   	push   %ebp
+  8015a0:	89 e5                	mov    %esp,%ebp
+  8015a2:	57                   	push   %edi
+  8015a3:	56                   	push   %esi
+  8015a4:	53                   	push   %ebx
+  8015a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  8015a8:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8015ae:	76 1d                	jbe    8015cd <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  8015b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8015bb:	be 01 00 00 00       	mov    $0x1,%esi
+  8015c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015c3:	cd 30                	int    $0x30
+}
+  8015c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c8:	5b                   	pop    %ebx
+  8015c9:	5e                   	pop    %esi
+  8015ca:	5f                   	pop    %edi
+  8015cb:	5d                   	pop    %ebp
+  8015cc:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8015cd:	68 00 10 00 00       	push   $0x1000
+  8015d2:	53                   	push   %ebx
+  8015d3:	e8 2c fb ff ff       	call   801104 <touch_mem>
+  8015d8:	83 c4 08             	add    $0x8,%esp
+  8015db:	eb d3                	jmp    8015b0 <sys_ipc_send+0x11>
+
+008015dd <sys_ipc_send_pages>:
+{
+  8015dd:	55                   	push   %ebp
+  8015de:	89 e5                	mov    %esp,%ebp
+  8015e0:	57                   	push   %edi
+  8015e1:	56                   	push   %esi
+  8015e2:	53                   	push   %ebx
+  8015e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e6:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8015e9:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8015ef:	76 18                	jbe    801609 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8015f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8015fc:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8015ff:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  801601:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801604:	5b                   	pop    %ebx
+  801605:	5e                   	pop    %esi
+  801606:	5f                   	pop    %edi
+  801607:	5d                   	pop    %ebp
+  801608:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801609:	89 f0                	mov    %esi,%eax
+  80160b:	c1 e0 0c             	shl    $0xc,%eax
+  80160e:	50                   	push   %eax
+  80160f:	53                   	push   %ebx
+  801610:	e8 ef fa ff ff       	call   801104 <touch_mem>
+  801615:	83 c4 08             	add    $0x8,%esp
+  801618:	eb d7                	jmp    8015f1 <sys_ipc_send_pages+0x14>
+
+0080161a <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  80161a:	55                   	push   %ebp
+  80161b:	89 e5                	mov    %esp,%ebp
+  80161d:	57                   	push   %edi
+  80161e:	56                   	push   %esi
+  80161f:	53                   	push   %ebx
+  801620:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801623:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801628:	8b 55 08             	mov    0x8(%ebp),%edx
+  80162b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80162e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801633:	89 df                	mov    %ebx,%edi
+  801635:	89 de                	mov    %ebx,%esi
+  801637:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801639:	85 c0                	test   %eax,%eax
+  80163b:	7f 08                	jg     801645 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  80163d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801640:	5b                   	pop    %ebx
+  801641:	5e                   	pop    %esi
+  801642:	5f                   	pop    %edi
+  801643:	5d                   	pop    %ebp
+  801644:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801645:	83 ec 0c             	sub    $0xc,%esp
+  801648:	50                   	push   %eax
+  801649:	6a 0d                	push   $0xd
+  80164b:	68 8b 56 80 00       	push   $0x80568b
+  801650:	6a 23                	push   $0x23
+  801652:	68 a8 56 80 00       	push   $0x8056a8
+  801657:	e8 e6 ef ff ff       	call   800642 <_panic>
+
+0080165c <sys_ipc_recv>:
+{
+  80165c:	55                   	push   %ebp
+  80165d:	89 e5                	mov    %esp,%ebp
+  80165f:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801662:	6a 01                	push   $0x1
+  801664:	ff 75 08             	push   0x8(%ebp)
+  801667:	e8 ae ff ff ff       	call   80161a <sys_ipc_recv_pages>
+}
+  80166c:	c9                   	leave
+  80166d:	c3                   	ret
+
+0080166e <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80166e:	55                   	push   %ebp
+  80166f:	89 e5                	mov    %esp,%ebp
+  801671:	57                   	push   %edi
+  801672:	56                   	push   %esi
+  801673:	53                   	push   %ebx
+  801674:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801677:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80167a:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  80167d:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801683:	77 04                	ja     801689 <sys_ipc_call+0x1b>
+  801685:	85 f6                	test   %esi,%esi
+  801687:	75 15                	jne    80169e <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801689:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80168f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801694:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801696:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801699:	5b                   	pop    %ebx
+  80169a:	5e                   	pop    %esi
+  80169b:	5f                   	pop    %edi
+  80169c:	5d                   	pop    %ebp
+  80169d:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80169e:	89 f8                	mov    %edi,%eax
+  8016a0:	c1 e0 0c             	shl    $0xc,%eax
+  8016a3:	50                   	push   %eax
+  8016a4:	53                   	push   %ebx
+  8016a5:	e8 5a fa ff ff       	call   801104 <touch_mem>
+  8016aa:	83 c4 08             	add    $0x8,%esp
+  8016ad:	eb da                	jmp    801689 <sys_ipc_call+0x1b>
+
+008016af <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8016af:	55                   	push   %ebp
+  8016b0:	89 e5                	mov    %esp,%ebp
+  8016b2:	57                   	push   %edi
+  8016b3:	56                   	push   %esi
+  8016b4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8016b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016bb:	b8 15 00 00 00       	mov    $0x15,%eax
+  8016c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016c3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016c6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8016c9:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8016cb:	5b                   	pop    %ebx
+  8016cc:	5e                   	pop    %esi
+  8016cd:	5f                   	pop    %edi
+  8016ce:	5d                   	pop    %ebp
+  8016cf:	c3                   	ret
+
+008016d0 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8016d0:	55                   	push   %ebp
+  8016d1:	89 e5                	mov    %esp,%ebp
+  8016d3:	57                   	push   %edi
+  8016d4:	56                   	push   %esi
+  8016d5:	53                   	push   %ebx
+  8016d6:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8016d9:	6a 04                	push   $0x4
+  8016db:	ff 75 08             	push   0x8(%ebp)
+  8016de:	e8 21 fa ff ff       	call   801104 <touch_mem>
+	asm volatile("int %1\n"
+  8016e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016eb:	b8 16 00 00 00       	mov    $0x16,%eax
+  8016f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016f6:	89 f7                	mov    %esi,%edi
+  8016f8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016fa:	83 c4 08             	add    $0x8,%esp
+  8016fd:	85 c0                	test   %eax,%eax
+  8016ff:	7f 08                	jg     801709 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  801701:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801704:	5b                   	pop    %ebx
+  801705:	5e                   	pop    %esi
+  801706:	5f                   	pop    %edi
+  801707:	5d                   	pop    %ebp
+  801708:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801709:	83 ec 0c             	sub    $0xc,%esp
+  80170c:	50                   	push   %eax
+  80170d:	6a 16                	push   $0x16
+  80170f:	68 8b 56 80 00       	push   $0x80568b
+  801714:	6a 23                	push   $0x23
+  801716:	68 a8 56 80 00       	push   $0x8056a8
+  80171b:	e8 22 ef ff ff       	call   800642 <_panic>
+
+00801720 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801720:	55                   	push   %ebp
+  801721:	89 e5                	mov    %esp,%ebp
+  801723:	57                   	push   %edi
+  801724:	56                   	push   %esi
+  801725:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801726:	6a 04                	push   $0x4
+  801728:	ff 75 08             	push   0x8(%ebp)
+  80172b:	e8 d4 f9 ff ff       	call   801104 <touch_mem>
+	asm volatile("int %1\n"
+  801730:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801735:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801738:	b8 17 00 00 00       	mov    $0x17,%eax
+  80173d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801740:	89 df                	mov    %ebx,%edi
+  801742:	89 de                	mov    %ebx,%esi
+  801744:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801746:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801749:	5b                   	pop    %ebx
+  80174a:	5e                   	pop    %esi
+  80174b:	5f                   	pop    %edi
+  80174c:	5d                   	pop    %ebp
+  80174d:	c3                   	ret
+
+0080174e <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80174e:	55                   	push   %ebp
+  80174f:	89 e5                	mov    %esp,%ebp
+  801751:	57                   	push   %edi
+  801752:	56                   	push   %esi
+  801753:	53                   	push   %ebx
+  801754:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801757:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80175f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801764:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801769:	89 df                	mov    %ebx,%edi
+  80176b:	89 de                	mov    %ebx,%esi
+  80176d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80176f:	85 c0                	test   %eax,%eax
+  801771:	7f 08                	jg     80177b <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801773:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801776:	5b                   	pop    %ebx
+  801777:	5e                   	pop    %esi
+  801778:	5f                   	pop    %edi
+  801779:	5d                   	pop    %ebp
+  80177a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80177b:	83 ec 0c             	sub    $0xc,%esp
+  80177e:	50                   	push   %eax
+  80177f:	6a 0e                	push   $0xe
+  801781:	68 8b 56 80 00       	push   $0x80568b
+  801786:	6a 23                	push   $0x23
+  801788:	68 a8 56 80 00       	push   $0x8056a8
+  80178d:	e8 b0 ee ff ff       	call   800642 <_panic>
+
+00801792 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  801792:	55                   	push   %ebp
+  801793:	89 e5                	mov    %esp,%ebp
+  801795:	56                   	push   %esi
+  801796:	53                   	push   %ebx
+  801797:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  80179a:	a1 ac 70 80 00       	mov    0x8070ac,%eax
+  80179f:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  8017a2:	85 db                	test   %ebx,%ebx
+  8017a4:	78 17                	js     8017bd <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  8017a6:	83 ec 0c             	sub    $0xc,%esp
+  8017a9:	56                   	push   %esi
+  8017aa:	ff 14 9d 20 e9 80 00 	call   *0x80e920(,%ebx,4)
+  8017b1:	83 c4 10             	add    $0x10,%esp
+  8017b4:	85 c0                	test   %eax,%eax
+  8017b6:	75 27                	jne    8017df <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8017b8:	83 eb 01             	sub    $0x1,%ebx
+  8017bb:	eb e5                	jmp    8017a2 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  8017bd:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8017c2:	8b 40 48             	mov    0x48(%eax),%eax
+  8017c5:	83 ec 08             	sub    $0x8,%esp
+  8017c8:	ff 76 28             	push   0x28(%esi)
+  8017cb:	ff 36                	push   (%esi)
+  8017cd:	50                   	push   %eax
+  8017ce:	68 b8 56 80 00       	push   $0x8056b8
+  8017d3:	6a 1d                	push   $0x1d
+  8017d5:	68 db 56 80 00       	push   $0x8056db
+  8017da:	e8 63 ee ff ff       	call   800642 <_panic>
+}
+  8017df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e2:	5b                   	pop    %ebx
+  8017e3:	5e                   	pop    %esi
+  8017e4:	5d                   	pop    %ebp
+  8017e5:	c3                   	ret
+
+008017e6 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8017e6:	55                   	push   %ebp
+  8017e7:	89 e5                	mov    %esp,%ebp
+  8017e9:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  8017ec:	83 3d 48 e9 80 00 00 	cmpl   $0x0,0x80e948
+  8017f3:	74 0a                	je     8017ff <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8017f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017f8:	a3 48 e9 80 00       	mov    %eax,0x80e948
+}
+  8017fd:	c9                   	leave
+  8017fe:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  8017ff:	83 ec 04             	sub    $0x4,%esp
+  801802:	6a 07                	push   $0x7
+  801804:	68 00 f0 bf ee       	push   $0xeebff000
+  801809:	6a 00                	push   $0x0
+  80180b:	e8 e7 f9 ff ff       	call   8011f7 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801810:	83 c4 08             	add    $0x8,%esp
+  801813:	68 86 18 80 00       	push   $0x801886
+  801818:	6a 00                	push   $0x0
+  80181a:	e8 3e fd ff ff       	call   80155d <sys_env_set_pgfault_upcall>
+  80181f:	83 c4 10             	add    $0x10,%esp
+  801822:	eb d1                	jmp    8017f5 <set_pgfault_handler+0xf>
+
+00801824 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  801824:	55                   	push   %ebp
+  801825:	89 e5                	mov    %esp,%ebp
+  801827:	83 ec 08             	sub    $0x8,%esp
+  80182a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  80182d:	8b 15 ac 70 80 00    	mov    0x8070ac,%edx
+  801833:	b8 00 00 00 00       	mov    $0x0,%eax
+  801838:	eb 03                	jmp    80183d <add_pgfault_handler+0x19>
+  80183a:	83 c0 01             	add    $0x1,%eax
+  80183d:	39 d0                	cmp    %edx,%eax
+  80183f:	74 0b                	je     80184c <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  801841:	39 0c 85 20 e9 80 00 	cmp    %ecx,0x80e920(,%eax,4)
+  801848:	75 f0                	jne    80183a <add_pgfault_handler+0x16>
+  80184a:	eb 24                	jmp    801870 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  80184c:	83 fa 0a             	cmp    $0xa,%edx
+  80184f:	74 21                	je     801872 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  801851:	8d 42 01             	lea    0x1(%edx),%eax
+  801854:	a3 ac 70 80 00       	mov    %eax,0x8070ac
+  801859:	89 0c 95 20 e9 80 00 	mov    %ecx,0x80e920(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  801860:	83 ec 0c             	sub    $0xc,%esp
+  801863:	68 92 17 80 00       	push   $0x801792
+  801868:	e8 79 ff ff ff       	call   8017e6 <set_pgfault_handler>
+  80186d:	83 c4 10             	add    $0x10,%esp
+}
+  801870:	c9                   	leave
+  801871:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  801872:	83 ec 04             	sub    $0x4,%esp
+  801875:	68 e9 56 80 00       	push   $0x8056e9
+  80187a:	6a 44                	push   $0x44
+  80187c:	68 db 56 80 00       	push   $0x8056db
+  801881:	e8 bc ed ff ff       	call   800642 <_panic>
+
+00801886 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801886:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801887:	a1 48 e9 80 00       	mov    0x80e948,%eax
+	call *%eax
+  80188c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80188e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  801891:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  801895:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  801899:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  80189c:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  80189e:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  8018a2:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  8018a5:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  8018a6:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  8018a9:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  8018aa:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8018ab:	c3                   	ret
+
+008018ac <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8018ac:	55                   	push   %ebp
+  8018ad:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b2:	05 00 00 00 30       	add    $0x30000000,%eax
+  8018b7:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8018ba:	5d                   	pop    %ebp
+  8018bb:	c3                   	ret
+
+008018bc <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8018bc:	55                   	push   %ebp
+  8018bd:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c2:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8018c7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8018cc:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8018d1:	5d                   	pop    %ebp
+  8018d2:	c3                   	ret
+
+008018d3 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8018d3:	55                   	push   %ebp
+  8018d4:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8018d6:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8018db:	a8 01                	test   $0x1,%al
+  8018dd:	74 3c                	je     80191b <fd_alloc+0x48>
+  8018df:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8018e4:	89 c2                	mov    %eax,%edx
+  8018e6:	c1 ea 0c             	shr    $0xc,%edx
+  8018e9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8018f0:	89 c1                	mov    %eax,%ecx
+  8018f2:	05 00 10 00 00       	add    $0x1000,%eax
+  8018f7:	f6 c2 01             	test   $0x1,%dl
+  8018fa:	74 13                	je     80190f <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8018fc:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801901:	75 e1                	jne    8018e4 <fd_alloc+0x11>
+  801903:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801908:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80190d:	eb 05                	jmp    801914 <fd_alloc+0x41>
+			return 0;
+  80190f:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801914:	8b 55 08             	mov    0x8(%ebp),%edx
+  801917:	89 0a                	mov    %ecx,(%edx)
+}
+  801919:	5d                   	pop    %ebp
+  80191a:	c3                   	ret
+  80191b:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801920:	b8 00 00 00 00       	mov    $0x0,%eax
+  801925:	eb ed                	jmp    801914 <fd_alloc+0x41>
+
+00801927 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801927:	55                   	push   %ebp
+  801928:	89 e5                	mov    %esp,%ebp
+  80192a:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80192d:	83 f8 1f             	cmp    $0x1f,%eax
+  801930:	77 30                	ja     801962 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801932:	c1 e0 0c             	shl    $0xc,%eax
+  801935:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80193a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801940:	f6 c2 01             	test   $0x1,%dl
+  801943:	74 24                	je     801969 <fd_lookup+0x42>
+  801945:	89 c2                	mov    %eax,%edx
+  801947:	c1 ea 0c             	shr    $0xc,%edx
+  80194a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801951:	f6 c2 01             	test   $0x1,%dl
+  801954:	74 1a                	je     801970 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801956:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801959:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80195b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801960:	5d                   	pop    %ebp
+  801961:	c3                   	ret
+		return -E_INVAL;
+  801962:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801967:	eb f7                	jmp    801960 <fd_lookup+0x39>
+		return -E_INVAL;
+  801969:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80196e:	eb f0                	jmp    801960 <fd_lookup+0x39>
+  801970:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801975:	eb e9                	jmp    801960 <fd_lookup+0x39>
+
+00801977 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801977:	55                   	push   %ebp
+  801978:	89 e5                	mov    %esp,%ebp
+  80197a:	53                   	push   %ebx
+  80197b:	83 ec 04             	sub    $0x4,%esp
+  80197e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801981:	b8 80 57 80 00       	mov    $0x805780,%eax
+  801986:	8b 18                	mov    (%eax),%ebx
+  801988:	85 db                	test   %ebx,%ebx
+  80198a:	74 0e                	je     80199a <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  80198c:	83 c0 04             	add    $0x4,%eax
+  80198f:	39 13                	cmp    %edx,(%ebx)
+  801991:	75 f3                	jne    801986 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801993:	b8 00 00 00 00       	mov    $0x0,%eax
+  801998:	eb 1f                	jmp    8019b9 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80199a:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  80199f:	8b 40 48             	mov    0x48(%eax),%eax
+  8019a2:	83 ec 04             	sub    $0x4,%esp
+  8019a5:	52                   	push   %edx
+  8019a6:	50                   	push   %eax
+  8019a7:	68 04 57 80 00       	push   $0x805704
+  8019ac:	e8 6c ed ff ff       	call   80071d <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8019b1:	83 c4 10             	add    $0x10,%esp
+  8019b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8019b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019bc:	89 1a                	mov    %ebx,(%edx)
+}
+  8019be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019c1:	c9                   	leave
+  8019c2:	c3                   	ret
+
+008019c3 <fd_close>:
+{
+  8019c3:	55                   	push   %ebp
+  8019c4:	89 e5                	mov    %esp,%ebp
+  8019c6:	57                   	push   %edi
+  8019c7:	56                   	push   %esi
+  8019c8:	53                   	push   %ebx
+  8019c9:	83 ec 24             	sub    $0x24,%esp
+  8019cc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019cf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019d2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019d5:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019d6:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019dc:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019df:	50                   	push   %eax
+  8019e0:	e8 42 ff ff ff       	call   801927 <fd_lookup>
+  8019e5:	89 c3                	mov    %eax,%ebx
+  8019e7:	83 c4 10             	add    $0x10,%esp
+  8019ea:	85 c0                	test   %eax,%eax
+  8019ec:	78 05                	js     8019f3 <fd_close+0x30>
+	    || fd != fd2)
+  8019ee:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8019f1:	74 16                	je     801a09 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8019f3:	89 f8                	mov    %edi,%eax
+  8019f5:	84 c0                	test   %al,%al
+  8019f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fc:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8019ff:	89 d8                	mov    %ebx,%eax
+  801a01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a04:	5b                   	pop    %ebx
+  801a05:	5e                   	pop    %esi
+  801a06:	5f                   	pop    %edi
+  801a07:	5d                   	pop    %ebp
+  801a08:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a09:	83 ec 08             	sub    $0x8,%esp
+  801a0c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a0f:	50                   	push   %eax
+  801a10:	ff 36                	push   (%esi)
+  801a12:	e8 60 ff ff ff       	call   801977 <dev_lookup>
+  801a17:	89 c3                	mov    %eax,%ebx
+  801a19:	83 c4 10             	add    $0x10,%esp
+  801a1c:	85 c0                	test   %eax,%eax
+  801a1e:	78 1a                	js     801a3a <fd_close+0x77>
+		if (dev->dev_close)
+  801a20:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a23:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a26:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a2b:	85 c0                	test   %eax,%eax
+  801a2d:	74 0b                	je     801a3a <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a2f:	83 ec 0c             	sub    $0xc,%esp
+  801a32:	56                   	push   %esi
+  801a33:	ff d0                	call   *%eax
+  801a35:	89 c3                	mov    %eax,%ebx
+  801a37:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a3a:	83 ec 08             	sub    $0x8,%esp
+  801a3d:	56                   	push   %esi
+  801a3e:	6a 00                	push   $0x0
+  801a40:	e8 37 f8 ff ff       	call   80127c <sys_page_unmap>
+	return r;
+  801a45:	83 c4 10             	add    $0x10,%esp
+  801a48:	eb b5                	jmp    8019ff <fd_close+0x3c>
+
+00801a4a <close>:
+
+int
+close(int fdnum)
+{
+  801a4a:	55                   	push   %ebp
+  801a4b:	89 e5                	mov    %esp,%ebp
+  801a4d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a50:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a53:	50                   	push   %eax
+  801a54:	ff 75 08             	push   0x8(%ebp)
+  801a57:	e8 cb fe ff ff       	call   801927 <fd_lookup>
+  801a5c:	83 c4 10             	add    $0x10,%esp
+  801a5f:	85 c0                	test   %eax,%eax
+  801a61:	79 02                	jns    801a65 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a63:	c9                   	leave
+  801a64:	c3                   	ret
+		return fd_close(fd, 1);
+  801a65:	83 ec 08             	sub    $0x8,%esp
+  801a68:	6a 01                	push   $0x1
+  801a6a:	ff 75 f4             	push   -0xc(%ebp)
+  801a6d:	e8 51 ff ff ff       	call   8019c3 <fd_close>
+  801a72:	83 c4 10             	add    $0x10,%esp
+  801a75:	eb ec                	jmp    801a63 <close+0x19>
+
+00801a77 <close_all>:
+
+void
+close_all(void)
+{
+  801a77:	55                   	push   %ebp
+  801a78:	89 e5                	mov    %esp,%ebp
+  801a7a:	53                   	push   %ebx
+  801a7b:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a83:	83 ec 0c             	sub    $0xc,%esp
+  801a86:	53                   	push   %ebx
+  801a87:	e8 be ff ff ff       	call   801a4a <close>
+	for (i = 0; i < MAXFD; i++)
+  801a8c:	83 c3 01             	add    $0x1,%ebx
+  801a8f:	83 c4 10             	add    $0x10,%esp
+  801a92:	83 fb 20             	cmp    $0x20,%ebx
+  801a95:	75 ec                	jne    801a83 <close_all+0xc>
+}
+  801a97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a9a:	c9                   	leave
+  801a9b:	c3                   	ret
+
+00801a9c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801a9c:	55                   	push   %ebp
+  801a9d:	89 e5                	mov    %esp,%ebp
+  801a9f:	57                   	push   %edi
+  801aa0:	56                   	push   %esi
+  801aa1:	53                   	push   %ebx
+  801aa2:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801aa5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801aa8:	50                   	push   %eax
+  801aa9:	ff 75 08             	push   0x8(%ebp)
+  801aac:	e8 76 fe ff ff       	call   801927 <fd_lookup>
+  801ab1:	89 c3                	mov    %eax,%ebx
+  801ab3:	83 c4 10             	add    $0x10,%esp
+  801ab6:	85 c0                	test   %eax,%eax
+  801ab8:	78 7f                	js     801b39 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801aba:	83 ec 0c             	sub    $0xc,%esp
+  801abd:	ff 75 0c             	push   0xc(%ebp)
+  801ac0:	e8 85 ff ff ff       	call   801a4a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801ac5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ac8:	c1 e6 0c             	shl    $0xc,%esi
+  801acb:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801ad1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ad4:	89 3c 24             	mov    %edi,(%esp)
+  801ad7:	e8 e0 fd ff ff       	call   8018bc <fd2data>
+  801adc:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801ade:	89 34 24             	mov    %esi,(%esp)
+  801ae1:	e8 d6 fd ff ff       	call   8018bc <fd2data>
+  801ae6:	83 c4 10             	add    $0x10,%esp
+  801ae9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801aec:	89 d8                	mov    %ebx,%eax
+  801aee:	c1 e8 16             	shr    $0x16,%eax
+  801af1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801af8:	a8 01                	test   $0x1,%al
+  801afa:	74 11                	je     801b0d <dup+0x71>
+  801afc:	89 d8                	mov    %ebx,%eax
+  801afe:	c1 e8 0c             	shr    $0xc,%eax
+  801b01:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b08:	f6 c2 01             	test   $0x1,%dl
+  801b0b:	75 36                	jne    801b43 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b0d:	89 f8                	mov    %edi,%eax
+  801b0f:	c1 e8 0c             	shr    $0xc,%eax
+  801b12:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b19:	83 ec 0c             	sub    $0xc,%esp
+  801b1c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b21:	50                   	push   %eax
+  801b22:	56                   	push   %esi
+  801b23:	6a 00                	push   $0x0
+  801b25:	57                   	push   %edi
+  801b26:	6a 00                	push   $0x0
+  801b28:	e8 0d f7 ff ff       	call   80123a <sys_page_map>
+  801b2d:	89 c3                	mov    %eax,%ebx
+  801b2f:	83 c4 20             	add    $0x20,%esp
+  801b32:	85 c0                	test   %eax,%eax
+  801b34:	78 33                	js     801b69 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b36:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b39:	89 d8                	mov    %ebx,%eax
+  801b3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b3e:	5b                   	pop    %ebx
+  801b3f:	5e                   	pop    %esi
+  801b40:	5f                   	pop    %edi
+  801b41:	5d                   	pop    %ebp
+  801b42:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b43:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b4a:	83 ec 0c             	sub    $0xc,%esp
+  801b4d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b52:	50                   	push   %eax
+  801b53:	ff 75 d4             	push   -0x2c(%ebp)
+  801b56:	6a 00                	push   $0x0
+  801b58:	53                   	push   %ebx
+  801b59:	6a 00                	push   $0x0
+  801b5b:	e8 da f6 ff ff       	call   80123a <sys_page_map>
+  801b60:	89 c3                	mov    %eax,%ebx
+  801b62:	83 c4 20             	add    $0x20,%esp
+  801b65:	85 c0                	test   %eax,%eax
+  801b67:	79 a4                	jns    801b0d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b69:	83 ec 08             	sub    $0x8,%esp
+  801b6c:	56                   	push   %esi
+  801b6d:	6a 00                	push   $0x0
+  801b6f:	e8 08 f7 ff ff       	call   80127c <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b74:	83 c4 08             	add    $0x8,%esp
+  801b77:	ff 75 d4             	push   -0x2c(%ebp)
+  801b7a:	6a 00                	push   $0x0
+  801b7c:	e8 fb f6 ff ff       	call   80127c <sys_page_unmap>
+	return r;
+  801b81:	83 c4 10             	add    $0x10,%esp
+  801b84:	eb b3                	jmp    801b39 <dup+0x9d>
+
+00801b86 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b86:	55                   	push   %ebp
+  801b87:	89 e5                	mov    %esp,%ebp
+  801b89:	56                   	push   %esi
+  801b8a:	53                   	push   %ebx
+  801b8b:	83 ec 18             	sub    $0x18,%esp
+  801b8e:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b91:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b94:	50                   	push   %eax
+  801b95:	56                   	push   %esi
+  801b96:	e8 8c fd ff ff       	call   801927 <fd_lookup>
+  801b9b:	83 c4 10             	add    $0x10,%esp
+  801b9e:	85 c0                	test   %eax,%eax
+  801ba0:	78 3c                	js     801bde <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ba2:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801ba5:	83 ec 08             	sub    $0x8,%esp
+  801ba8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bab:	50                   	push   %eax
+  801bac:	ff 33                	push   (%ebx)
+  801bae:	e8 c4 fd ff ff       	call   801977 <dev_lookup>
+  801bb3:	83 c4 10             	add    $0x10,%esp
+  801bb6:	85 c0                	test   %eax,%eax
+  801bb8:	78 24                	js     801bde <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801bba:	8b 43 08             	mov    0x8(%ebx),%eax
+  801bbd:	83 e0 03             	and    $0x3,%eax
+  801bc0:	83 f8 01             	cmp    $0x1,%eax
+  801bc3:	74 20                	je     801be5 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801bc5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bc8:	8b 40 08             	mov    0x8(%eax),%eax
+  801bcb:	85 c0                	test   %eax,%eax
+  801bcd:	74 37                	je     801c06 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801bcf:	83 ec 04             	sub    $0x4,%esp
+  801bd2:	ff 75 10             	push   0x10(%ebp)
+  801bd5:	ff 75 0c             	push   0xc(%ebp)
+  801bd8:	53                   	push   %ebx
+  801bd9:	ff d0                	call   *%eax
+  801bdb:	83 c4 10             	add    $0x10,%esp
+}
+  801bde:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be1:	5b                   	pop    %ebx
+  801be2:	5e                   	pop    %esi
+  801be3:	5d                   	pop    %ebp
+  801be4:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801be5:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  801bea:	8b 40 48             	mov    0x48(%eax),%eax
+  801bed:	83 ec 04             	sub    $0x4,%esp
+  801bf0:	56                   	push   %esi
+  801bf1:	50                   	push   %eax
+  801bf2:	68 45 57 80 00       	push   $0x805745
+  801bf7:	e8 21 eb ff ff       	call   80071d <cprintf>
+		return -E_INVAL;
+  801bfc:	83 c4 10             	add    $0x10,%esp
+  801bff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c04:	eb d8                	jmp    801bde <read+0x58>
+		return -E_NOT_SUPP;
+  801c06:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c0b:	eb d1                	jmp    801bde <read+0x58>
+
+00801c0d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c0d:	55                   	push   %ebp
+  801c0e:	89 e5                	mov    %esp,%ebp
+  801c10:	57                   	push   %edi
+  801c11:	56                   	push   %esi
+  801c12:	53                   	push   %ebx
+  801c13:	83 ec 0c             	sub    $0xc,%esp
+  801c16:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c19:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c21:	eb 02                	jmp    801c25 <readn+0x18>
+  801c23:	01 c3                	add    %eax,%ebx
+  801c25:	39 f3                	cmp    %esi,%ebx
+  801c27:	73 21                	jae    801c4a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c29:	83 ec 04             	sub    $0x4,%esp
+  801c2c:	89 f0                	mov    %esi,%eax
+  801c2e:	29 d8                	sub    %ebx,%eax
+  801c30:	50                   	push   %eax
+  801c31:	89 d8                	mov    %ebx,%eax
+  801c33:	03 45 0c             	add    0xc(%ebp),%eax
+  801c36:	50                   	push   %eax
+  801c37:	57                   	push   %edi
+  801c38:	e8 49 ff ff ff       	call   801b86 <read>
+		if (m < 0)
+  801c3d:	83 c4 10             	add    $0x10,%esp
+  801c40:	85 c0                	test   %eax,%eax
+  801c42:	78 04                	js     801c48 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c44:	75 dd                	jne    801c23 <readn+0x16>
+  801c46:	eb 02                	jmp    801c4a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c48:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c4a:	89 d8                	mov    %ebx,%eax
+  801c4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c4f:	5b                   	pop    %ebx
+  801c50:	5e                   	pop    %esi
+  801c51:	5f                   	pop    %edi
+  801c52:	5d                   	pop    %ebp
+  801c53:	c3                   	ret
+
+00801c54 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c54:	55                   	push   %ebp
+  801c55:	89 e5                	mov    %esp,%ebp
+  801c57:	56                   	push   %esi
+  801c58:	53                   	push   %ebx
+  801c59:	83 ec 18             	sub    $0x18,%esp
+  801c5c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c5f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c62:	50                   	push   %eax
+  801c63:	53                   	push   %ebx
+  801c64:	e8 be fc ff ff       	call   801927 <fd_lookup>
+  801c69:	83 c4 10             	add    $0x10,%esp
+  801c6c:	85 c0                	test   %eax,%eax
+  801c6e:	78 37                	js     801ca7 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c70:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c73:	83 ec 08             	sub    $0x8,%esp
+  801c76:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c79:	50                   	push   %eax
+  801c7a:	ff 36                	push   (%esi)
+  801c7c:	e8 f6 fc ff ff       	call   801977 <dev_lookup>
+  801c81:	83 c4 10             	add    $0x10,%esp
+  801c84:	85 c0                	test   %eax,%eax
+  801c86:	78 1f                	js     801ca7 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c88:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c8c:	74 20                	je     801cae <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801c8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c91:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c94:	85 c0                	test   %eax,%eax
+  801c96:	74 37                	je     801ccf <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c98:	83 ec 04             	sub    $0x4,%esp
+  801c9b:	ff 75 10             	push   0x10(%ebp)
+  801c9e:	ff 75 0c             	push   0xc(%ebp)
+  801ca1:	56                   	push   %esi
+  801ca2:	ff d0                	call   *%eax
+  801ca4:	83 c4 10             	add    $0x10,%esp
+}
+  801ca7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801caa:	5b                   	pop    %ebx
+  801cab:	5e                   	pop    %esi
+  801cac:	5d                   	pop    %ebp
+  801cad:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cae:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  801cb3:	8b 40 48             	mov    0x48(%eax),%eax
+  801cb6:	83 ec 04             	sub    $0x4,%esp
+  801cb9:	53                   	push   %ebx
+  801cba:	50                   	push   %eax
+  801cbb:	68 61 57 80 00       	push   $0x805761
+  801cc0:	e8 58 ea ff ff       	call   80071d <cprintf>
+		return -E_INVAL;
+  801cc5:	83 c4 10             	add    $0x10,%esp
+  801cc8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ccd:	eb d8                	jmp    801ca7 <write+0x53>
+		return -E_NOT_SUPP;
+  801ccf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cd4:	eb d1                	jmp    801ca7 <write+0x53>
+
+00801cd6 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801cd6:	55                   	push   %ebp
+  801cd7:	89 e5                	mov    %esp,%ebp
+  801cd9:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801cdc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cdf:	50                   	push   %eax
+  801ce0:	ff 75 08             	push   0x8(%ebp)
+  801ce3:	e8 3f fc ff ff       	call   801927 <fd_lookup>
+  801ce8:	83 c4 10             	add    $0x10,%esp
+  801ceb:	85 c0                	test   %eax,%eax
+  801ced:	78 0e                	js     801cfd <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801cef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cf2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cf5:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801cf8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cfd:	c9                   	leave
+  801cfe:	c3                   	ret
+
+00801cff <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801cff:	55                   	push   %ebp
+  801d00:	89 e5                	mov    %esp,%ebp
+  801d02:	56                   	push   %esi
+  801d03:	53                   	push   %ebx
+  801d04:	83 ec 18             	sub    $0x18,%esp
+  801d07:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d0a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d0d:	50                   	push   %eax
+  801d0e:	53                   	push   %ebx
+  801d0f:	e8 13 fc ff ff       	call   801927 <fd_lookup>
+  801d14:	83 c4 10             	add    $0x10,%esp
+  801d17:	85 c0                	test   %eax,%eax
+  801d19:	78 34                	js     801d4f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d1b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d1e:	83 ec 08             	sub    $0x8,%esp
+  801d21:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d24:	50                   	push   %eax
+  801d25:	ff 36                	push   (%esi)
+  801d27:	e8 4b fc ff ff       	call   801977 <dev_lookup>
+  801d2c:	83 c4 10             	add    $0x10,%esp
+  801d2f:	85 c0                	test   %eax,%eax
+  801d31:	78 1c                	js     801d4f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d33:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d37:	74 1d                	je     801d56 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d3c:	8b 40 18             	mov    0x18(%eax),%eax
+  801d3f:	85 c0                	test   %eax,%eax
+  801d41:	74 34                	je     801d77 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d43:	83 ec 08             	sub    $0x8,%esp
+  801d46:	ff 75 0c             	push   0xc(%ebp)
+  801d49:	56                   	push   %esi
+  801d4a:	ff d0                	call   *%eax
+  801d4c:	83 c4 10             	add    $0x10,%esp
+}
+  801d4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d52:	5b                   	pop    %ebx
+  801d53:	5e                   	pop    %esi
+  801d54:	5d                   	pop    %ebp
+  801d55:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801d56:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  801d5b:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d5e:	83 ec 04             	sub    $0x4,%esp
+  801d61:	53                   	push   %ebx
+  801d62:	50                   	push   %eax
+  801d63:	68 24 57 80 00       	push   $0x805724
+  801d68:	e8 b0 e9 ff ff       	call   80071d <cprintf>
+		return -E_INVAL;
+  801d6d:	83 c4 10             	add    $0x10,%esp
+  801d70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d75:	eb d8                	jmp    801d4f <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801d77:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d7c:	eb d1                	jmp    801d4f <ftruncate+0x50>
+
+00801d7e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d7e:	55                   	push   %ebp
+  801d7f:	89 e5                	mov    %esp,%ebp
+  801d81:	56                   	push   %esi
+  801d82:	53                   	push   %ebx
+  801d83:	83 ec 18             	sub    $0x18,%esp
+  801d86:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d89:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d8c:	50                   	push   %eax
+  801d8d:	ff 75 08             	push   0x8(%ebp)
+  801d90:	e8 92 fb ff ff       	call   801927 <fd_lookup>
+  801d95:	83 c4 10             	add    $0x10,%esp
+  801d98:	85 c0                	test   %eax,%eax
+  801d9a:	78 49                	js     801de5 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d9c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d9f:	83 ec 08             	sub    $0x8,%esp
+  801da2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801da5:	50                   	push   %eax
+  801da6:	ff 36                	push   (%esi)
+  801da8:	e8 ca fb ff ff       	call   801977 <dev_lookup>
+  801dad:	83 c4 10             	add    $0x10,%esp
+  801db0:	85 c0                	test   %eax,%eax
+  801db2:	78 31                	js     801de5 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801db4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801db7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801dbb:	74 2f                	je     801dec <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801dbd:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801dc0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801dc7:	00 00 00 
+	stat->st_isdir = 0;
+  801dca:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801dd1:	00 00 00 
+	stat->st_dev = dev;
+  801dd4:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801dda:	83 ec 08             	sub    $0x8,%esp
+  801ddd:	53                   	push   %ebx
+  801dde:	56                   	push   %esi
+  801ddf:	ff 50 14             	call   *0x14(%eax)
+  801de2:	83 c4 10             	add    $0x10,%esp
+}
+  801de5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801de8:	5b                   	pop    %ebx
+  801de9:	5e                   	pop    %esi
+  801dea:	5d                   	pop    %ebp
+  801deb:	c3                   	ret
+		return -E_NOT_SUPP;
+  801dec:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801df1:	eb f2                	jmp    801de5 <fstat+0x67>
+
+00801df3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801df3:	55                   	push   %ebp
+  801df4:	89 e5                	mov    %esp,%ebp
+  801df6:	56                   	push   %esi
+  801df7:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801df8:	83 ec 08             	sub    $0x8,%esp
+  801dfb:	6a 00                	push   $0x0
+  801dfd:	ff 75 08             	push   0x8(%ebp)
+  801e00:	e8 bc 02 00 00       	call   8020c1 <open>
+  801e05:	89 c3                	mov    %eax,%ebx
+  801e07:	83 c4 10             	add    $0x10,%esp
+  801e0a:	85 c0                	test   %eax,%eax
+  801e0c:	78 1b                	js     801e29 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e0e:	83 ec 08             	sub    $0x8,%esp
+  801e11:	ff 75 0c             	push   0xc(%ebp)
+  801e14:	50                   	push   %eax
+  801e15:	e8 64 ff ff ff       	call   801d7e <fstat>
+  801e1a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e1c:	89 1c 24             	mov    %ebx,(%esp)
+  801e1f:	e8 26 fc ff ff       	call   801a4a <close>
+	return r;
+  801e24:	83 c4 10             	add    $0x10,%esp
+  801e27:	89 f3                	mov    %esi,%ebx
+}
+  801e29:	89 d8                	mov    %ebx,%eax
+  801e2b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e2e:	5b                   	pop    %ebx
+  801e2f:	5e                   	pop    %esi
+  801e30:	5d                   	pop    %ebp
+  801e31:	c3                   	ret
+
+00801e32 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801e32:	55                   	push   %ebp
+  801e33:	89 e5                	mov    %esp,%ebp
+  801e35:	57                   	push   %edi
+  801e36:	56                   	push   %esi
+  801e37:	53                   	push   %ebx
+  801e38:	83 ec 0c             	sub    $0xc,%esp
+  801e3b:	89 c7                	mov    %eax,%edi
+  801e3d:	89 d3                	mov    %edx,%ebx
+  801e3f:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801e41:	83 3d b0 70 80 00 00 	cmpl   $0x0,0x8070b0
+  801e48:	74 2d                	je     801e77 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e4a:	6a 07                	push   $0x7
+  801e4c:	68 00 f0 80 00       	push   $0x80f000
+  801e51:	57                   	push   %edi
+  801e52:	ff 35 b0 70 80 00    	push   0x8070b0
+  801e58:	e8 34 30 00 00       	call   804e91 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801e5d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801e64:	6a 00                	push   $0x0
+  801e66:	56                   	push   %esi
+  801e67:	53                   	push   %ebx
+  801e68:	6a 00                	push   $0x0
+  801e6a:	e8 d4 2e 00 00       	call   804d43 <ipc_recv_pages>
+}
+  801e6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e72:	5b                   	pop    %ebx
+  801e73:	5e                   	pop    %esi
+  801e74:	5f                   	pop    %edi
+  801e75:	5d                   	pop    %ebp
+  801e76:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e77:	83 ec 0c             	sub    $0xc,%esp
+  801e7a:	6a 01                	push   $0x1
+  801e7c:	e8 05 31 00 00       	call   804f86 <ipc_find_env>
+  801e81:	a3 b0 70 80 00       	mov    %eax,0x8070b0
+  801e86:	83 c4 10             	add    $0x10,%esp
+  801e89:	eb bf                	jmp    801e4a <fsipc_pages+0x18>
+
+00801e8b <fsipc>:
+{
+  801e8b:	55                   	push   %ebp
+  801e8c:	89 e5                	mov    %esp,%ebp
+  801e8e:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801e91:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e96:	e8 97 ff ff ff       	call   801e32 <fsipc_pages>
+}
+  801e9b:	c9                   	leave
+  801e9c:	c3                   	ret
+
+00801e9d <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e9d:	55                   	push   %ebp
+  801e9e:	89 e5                	mov    %esp,%ebp
+  801ea0:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ea3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ea9:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  801eae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801eb1:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801eb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ebb:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ec0:	e8 c6 ff ff ff       	call   801e8b <fsipc>
+}
+  801ec5:	c9                   	leave
+  801ec6:	c3                   	ret
+
+00801ec7 <devfile_flush>:
+{
+  801ec7:	55                   	push   %ebp
+  801ec8:	89 e5                	mov    %esp,%ebp
+  801eca:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ecd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ed3:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801ed8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801edd:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ee2:	e8 a4 ff ff ff       	call   801e8b <fsipc>
+}
+  801ee7:	c9                   	leave
+  801ee8:	c3                   	ret
+
+00801ee9 <devfile_stat>:
+{
+  801ee9:	55                   	push   %ebp
+  801eea:	89 e5                	mov    %esp,%ebp
+  801eec:	53                   	push   %ebx
+  801eed:	83 ec 04             	sub    $0x4,%esp
+  801ef0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ef3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ef9:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801efe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f03:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f08:	e8 7e ff ff ff       	call   801e8b <fsipc>
+  801f0d:	85 c0                	test   %eax,%eax
+  801f0f:	78 2c                	js     801f3d <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f11:	83 ec 08             	sub    $0x8,%esp
+  801f14:	68 00 f0 80 00       	push   $0x80f000
+  801f19:	53                   	push   %ebx
+  801f1a:	e8 e5 ed ff ff       	call   800d04 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f1f:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  801f24:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f2a:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  801f2f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801f35:	83 c4 10             	add    $0x10,%esp
+  801f38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f40:	c9                   	leave
+  801f41:	c3                   	ret
+
+00801f42 <devfile_write>:
+{
+  801f42:	55                   	push   %ebp
+  801f43:	89 e5                	mov    %esp,%ebp
+  801f45:	83 ec 0c             	sub    $0xc,%esp
+  801f48:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801f4b:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801f50:	39 d0                	cmp    %edx,%eax
+  801f52:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f55:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f58:	8b 52 0c             	mov    0xc(%edx),%edx
+  801f5b:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  801f61:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801f66:	50                   	push   %eax
+  801f67:	ff 75 0c             	push   0xc(%ebp)
+  801f6a:	68 08 f0 80 00       	push   $0x80f008
+  801f6f:	e8 16 ef ff ff       	call   800e8a <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801f74:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f79:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f7e:	e8 08 ff ff ff       	call   801e8b <fsipc>
+}
+  801f83:	c9                   	leave
+  801f84:	c3                   	ret
+
+00801f85 <devfile_read>:
+{
+  801f85:	55                   	push   %ebp
+  801f86:	89 e5                	mov    %esp,%ebp
+  801f88:	57                   	push   %edi
+  801f89:	56                   	push   %esi
+  801f8a:	53                   	push   %ebx
+  801f8b:	83 ec 1c             	sub    $0x1c,%esp
+  801f8e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f91:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801f94:	89 fe                	mov    %edi,%esi
+  801f96:	c1 ee 0c             	shr    $0xc,%esi
+  801f99:	b8 20 00 00 00       	mov    $0x20,%eax
+  801f9e:	39 c6                	cmp    %eax,%esi
+  801fa0:	0f 47 f0             	cmova  %eax,%esi
+  801fa3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fa6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fab:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801fae:	eb 14                	jmp    801fc4 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801fb0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801fb7:	05 00 10 00 00       	add    $0x1000,%eax
+  801fbc:	f6 c6 06             	test   $0x6,%dh
+  801fbf:	75 42                	jne    802003 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801fc1:	83 c1 01             	add    $0x1,%ecx
+  801fc4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801fc7:	39 f1                	cmp    %esi,%ecx
+  801fc9:	0f 84 95 00 00 00    	je     802064 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801fcf:	89 c2                	mov    %eax,%edx
+  801fd1:	c1 ea 16             	shr    $0x16,%edx
+  801fd4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801fdb:	f6 c2 01             	test   $0x1,%dl
+  801fde:	74 23                	je     802003 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801fe0:	89 c2                	mov    %eax,%edx
+  801fe2:	c1 ea 0c             	shr    $0xc,%edx
+  801fe5:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801fec:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801ff2:	74 0f                	je     802003 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801ff4:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801ffb:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  802001:	75 ad                	jne    801fb0 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  802003:	85 c9                	test   %ecx,%ecx
+  802005:	74 11                	je     802018 <devfile_read+0x93>
+  802007:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80200e:	75 08                	jne    802018 <devfile_read+0x93>
+  802010:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  802016:	74 50                	je     802068 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802018:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80201b:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  802020:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802026:	ba 00 00 00 00       	mov    $0x0,%edx
+  80202b:	b8 03 00 00 00       	mov    $0x3,%eax
+  802030:	e8 56 fe ff ff       	call   801e8b <fsipc>
+  802035:	89 c6                	mov    %eax,%esi
+  802037:	85 c0                	test   %eax,%eax
+  802039:	78 1f                	js     80205a <devfile_read+0xd5>
+	assert(r <= n);
+  80203b:	39 c7                	cmp    %eax,%edi
+  80203d:	72 50                	jb     80208f <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  80203f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802044:	7f 62                	jg     8020a8 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  802046:	83 ec 04             	sub    $0x4,%esp
+  802049:	50                   	push   %eax
+  80204a:	68 00 f0 80 00       	push   $0x80f000
+  80204f:	ff 75 0c             	push   0xc(%ebp)
+  802052:	e8 33 ee ff ff       	call   800e8a <memmove>
+	return r;
+  802057:	83 c4 10             	add    $0x10,%esp
+}
+  80205a:	89 f0                	mov    %esi,%eax
+  80205c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80205f:	5b                   	pop    %ebx
+  802060:	5e                   	pop    %esi
+  802061:	5f                   	pop    %edi
+  802062:	5d                   	pop    %ebp
+  802063:	c3                   	ret
+  802064:	89 f1                	mov    %esi,%ecx
+  802066:	eb 9b                	jmp    802003 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  802068:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80206b:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  802070:	89 c8                	mov    %ecx,%eax
+  802072:	c1 e0 0c             	shl    $0xc,%eax
+  802075:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  80207a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80207d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802082:	e8 ab fd ff ff       	call   801e32 <fsipc_pages>
+  802087:	89 c6                	mov    %eax,%esi
+  802089:	85 c0                	test   %eax,%eax
+  80208b:	78 8b                	js     802018 <devfile_read+0x93>
+  80208d:	eb cb                	jmp    80205a <devfile_read+0xd5>
+	assert(r <= n);
+  80208f:	68 90 57 80 00       	push   $0x805790
+  802094:	68 97 57 80 00       	push   $0x805797
+  802099:	68 a0 00 00 00       	push   $0xa0
+  80209e:	68 ac 57 80 00       	push   $0x8057ac
+  8020a3:	e8 9a e5 ff ff       	call   800642 <_panic>
+	assert(r <= PGSIZE);
+  8020a8:	68 b7 57 80 00       	push   $0x8057b7
+  8020ad:	68 97 57 80 00       	push   $0x805797
+  8020b2:	68 a1 00 00 00       	push   $0xa1
+  8020b7:	68 ac 57 80 00       	push   $0x8057ac
+  8020bc:	e8 81 e5 ff ff       	call   800642 <_panic>
+
+008020c1 <open>:
+{
+  8020c1:	55                   	push   %ebp
+  8020c2:	89 e5                	mov    %esp,%ebp
+  8020c4:	56                   	push   %esi
+  8020c5:	53                   	push   %ebx
+  8020c6:	83 ec 1c             	sub    $0x1c,%esp
+  8020c9:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8020cc:	56                   	push   %esi
+  8020cd:	e8 f7 eb ff ff       	call   800cc9 <strlen>
+  8020d2:	83 c4 10             	add    $0x10,%esp
+  8020d5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020da:	7f 6c                	jg     802148 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8020dc:	83 ec 0c             	sub    $0xc,%esp
+  8020df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020e2:	50                   	push   %eax
+  8020e3:	e8 eb f7 ff ff       	call   8018d3 <fd_alloc>
+  8020e8:	89 c3                	mov    %eax,%ebx
+  8020ea:	83 c4 10             	add    $0x10,%esp
+  8020ed:	85 c0                	test   %eax,%eax
+  8020ef:	78 3c                	js     80212d <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8020f1:	83 ec 08             	sub    $0x8,%esp
+  8020f4:	56                   	push   %esi
+  8020f5:	68 00 f0 80 00       	push   $0x80f000
+  8020fa:	e8 05 ec ff ff       	call   800d04 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8020ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802102:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802107:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80210a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80210f:	e8 77 fd ff ff       	call   801e8b <fsipc>
+  802114:	89 c3                	mov    %eax,%ebx
+  802116:	83 c4 10             	add    $0x10,%esp
+  802119:	85 c0                	test   %eax,%eax
+  80211b:	78 19                	js     802136 <open+0x75>
+	return fd2num(fd);
+  80211d:	83 ec 0c             	sub    $0xc,%esp
+  802120:	ff 75 f4             	push   -0xc(%ebp)
+  802123:	e8 84 f7 ff ff       	call   8018ac <fd2num>
+  802128:	89 c3                	mov    %eax,%ebx
+  80212a:	83 c4 10             	add    $0x10,%esp
+}
+  80212d:	89 d8                	mov    %ebx,%eax
+  80212f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802132:	5b                   	pop    %ebx
+  802133:	5e                   	pop    %esi
+  802134:	5d                   	pop    %ebp
+  802135:	c3                   	ret
+		fd_close(fd, 0);
+  802136:	83 ec 08             	sub    $0x8,%esp
+  802139:	6a 00                	push   $0x0
+  80213b:	ff 75 f4             	push   -0xc(%ebp)
+  80213e:	e8 80 f8 ff ff       	call   8019c3 <fd_close>
+		return r;
+  802143:	83 c4 10             	add    $0x10,%esp
+  802146:	eb e5                	jmp    80212d <open+0x6c>
+		return -E_BAD_PATH;
+  802148:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80214d:	eb de                	jmp    80212d <open+0x6c>
+
+0080214f <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80214f:	55                   	push   %ebp
+  802150:	89 e5                	mov    %esp,%ebp
+  802152:	53                   	push   %ebx
+  802153:	83 ec 10             	sub    $0x10,%esp
+  802156:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802159:	53                   	push   %ebx
+  80215a:	e8 6a eb ff ff       	call   800cc9 <strlen>
+  80215f:	83 c4 10             	add    $0x10,%esp
+  802162:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802167:	7f 25                	jg     80218e <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802169:	83 ec 08             	sub    $0x8,%esp
+  80216c:	53                   	push   %ebx
+  80216d:	68 00 f0 80 00       	push   $0x80f000
+  802172:	e8 8d eb ff ff       	call   800d04 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802177:	ba 00 00 00 00       	mov    $0x0,%edx
+  80217c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802181:	e8 05 fd ff ff       	call   801e8b <fsipc>
+  802186:	83 c4 10             	add    $0x10,%esp
+}
+  802189:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80218c:	c9                   	leave
+  80218d:	c3                   	ret
+		return -E_BAD_PATH;
+  80218e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802193:	eb f4                	jmp    802189 <remove+0x3a>
+
+00802195 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802195:	55                   	push   %ebp
+  802196:	89 e5                	mov    %esp,%ebp
+  802198:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80219b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021a5:	e8 e1 fc ff ff       	call   801e8b <fsipc>
+}
+  8021aa:	c9                   	leave
+  8021ab:	c3                   	ret
+
+008021ac <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  8021ac:	55                   	push   %ebp
+  8021ad:	89 e5                	mov    %esp,%ebp
+  8021af:	53                   	push   %ebx
+  8021b0:	83 ec 04             	sub    $0x4,%esp
+  8021b3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  8021b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8021c0:	e8 c6 fc ff ff       	call   801e8b <fsipc>
+  8021c5:	85 c0                	test   %eax,%eax
+  8021c7:	78 3c                	js     802205 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  8021c9:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  8021ce:	89 03                	mov    %eax,(%ebx)
+  8021d0:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  8021d5:	89 43 04             	mov    %eax,0x4(%ebx)
+  8021d8:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  8021dd:	89 43 08             	mov    %eax,0x8(%ebx)
+  8021e0:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  8021e5:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8021e8:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  8021ed:	89 43 10             	mov    %eax,0x10(%ebx)
+  8021f0:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  8021f5:	89 43 14             	mov    %eax,0x14(%ebx)
+  8021f8:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  8021fd:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  802200:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802205:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802208:	c9                   	leave
+  802209:	c3                   	ret
+
+0080220a <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  80220a:	55                   	push   %ebp
+  80220b:	89 e5                	mov    %esp,%ebp
+  80220d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  802210:	8b 45 08             	mov    0x8(%ebp),%eax
+  802213:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  802218:	ba 00 00 00 00       	mov    $0x0,%edx
+  80221d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802222:	e8 64 fc ff ff       	call   801e8b <fsipc>
+}
+  802227:	c9                   	leave
+  802228:	c3                   	ret
+
+00802229 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802229:	55                   	push   %ebp
+  80222a:	89 e5                	mov    %esp,%ebp
+  80222c:	56                   	push   %esi
+  80222d:	53                   	push   %ebx
+  80222e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802231:	83 ec 0c             	sub    $0xc,%esp
+  802234:	ff 75 08             	push   0x8(%ebp)
+  802237:	e8 80 f6 ff ff       	call   8018bc <fd2data>
+  80223c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80223e:	83 c4 08             	add    $0x8,%esp
+  802241:	68 c3 57 80 00       	push   $0x8057c3
+  802246:	53                   	push   %ebx
+  802247:	e8 b8 ea ff ff       	call   800d04 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80224c:	8b 46 04             	mov    0x4(%esi),%eax
+  80224f:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  802255:	2b 0e                	sub    (%esi),%ecx
+  802257:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80225c:	89 c8                	mov    %ecx,%eax
+  80225e:	f7 e2                	mul    %edx
+  802260:	c1 ea 0c             	shr    $0xc,%edx
+  802263:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802269:	29 d1                	sub    %edx,%ecx
+  80226b:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  802271:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802278:	00 00 00 
+	stat->st_dev = &devpipe;
+  80227b:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  802282:	60 80 00 
+	return 0;
+}
+  802285:	b8 00 00 00 00       	mov    $0x0,%eax
+  80228a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80228d:	5b                   	pop    %ebx
+  80228e:	5e                   	pop    %esi
+  80228f:	5d                   	pop    %ebp
+  802290:	c3                   	ret
+
+00802291 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802291:	55                   	push   %ebp
+  802292:	89 e5                	mov    %esp,%ebp
+  802294:	53                   	push   %ebx
+  802295:	83 ec 0c             	sub    $0xc,%esp
+  802298:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80229b:	53                   	push   %ebx
+  80229c:	6a 00                	push   $0x0
+  80229e:	e8 d9 ef ff ff       	call   80127c <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8022a3:	89 1c 24             	mov    %ebx,(%esp)
+  8022a6:	e8 11 f6 ff ff       	call   8018bc <fd2data>
+  8022ab:	83 c4 08             	add    $0x8,%esp
+  8022ae:	50                   	push   %eax
+  8022af:	6a 00                	push   $0x0
+  8022b1:	e8 c6 ef ff ff       	call   80127c <sys_page_unmap>
+}
+  8022b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022b9:	c9                   	leave
+  8022ba:	c3                   	ret
+
+008022bb <_pipeisclosed>:
+{
+  8022bb:	55                   	push   %ebp
+  8022bc:	89 e5                	mov    %esp,%ebp
+  8022be:	57                   	push   %edi
+  8022bf:	56                   	push   %esi
+  8022c0:	53                   	push   %ebx
+  8022c1:	83 ec 1c             	sub    $0x1c,%esp
+  8022c4:	89 c7                	mov    %eax,%edi
+  8022c6:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8022c8:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8022cd:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8022d0:	83 ec 0c             	sub    $0xc,%esp
+  8022d3:	57                   	push   %edi
+  8022d4:	e8 ec 2c 00 00       	call   804fc5 <pageref>
+  8022d9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8022dc:	89 34 24             	mov    %esi,(%esp)
+  8022df:	e8 e1 2c 00 00       	call   804fc5 <pageref>
+		nn = thisenv->env_runs;
+  8022e4:	8b 15 14 e9 80 00    	mov    0x80e914,%edx
+  8022ea:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8022ed:	83 c4 10             	add    $0x10,%esp
+  8022f0:	39 cb                	cmp    %ecx,%ebx
+  8022f2:	74 1b                	je     80230f <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8022f4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8022f7:	75 cf                	jne    8022c8 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8022f9:	8b 42 58             	mov    0x58(%edx),%eax
+  8022fc:	6a 01                	push   $0x1
+  8022fe:	50                   	push   %eax
+  8022ff:	53                   	push   %ebx
+  802300:	68 ca 57 80 00       	push   $0x8057ca
+  802305:	e8 13 e4 ff ff       	call   80071d <cprintf>
+  80230a:	83 c4 10             	add    $0x10,%esp
+  80230d:	eb b9                	jmp    8022c8 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80230f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802312:	0f 94 c0             	sete   %al
+  802315:	0f b6 c0             	movzbl %al,%eax
+}
+  802318:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80231b:	5b                   	pop    %ebx
+  80231c:	5e                   	pop    %esi
+  80231d:	5f                   	pop    %edi
+  80231e:	5d                   	pop    %ebp
+  80231f:	c3                   	ret
+
+00802320 <devpipe_read>:
+{
+  802320:	55                   	push   %ebp
+  802321:	89 e5                	mov    %esp,%ebp
+  802323:	57                   	push   %edi
+  802324:	56                   	push   %esi
+  802325:	53                   	push   %ebx
+  802326:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802329:	ff 75 08             	push   0x8(%ebp)
+  80232c:	e8 8b f5 ff ff       	call   8018bc <fd2data>
+  802331:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  802333:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  802336:	8d 40 04             	lea    0x4(%eax),%eax
+  802339:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80233c:	8b 7b 04             	mov    0x4(%ebx),%edi
+  80233f:	8b 0b                	mov    (%ebx),%ecx
+  802341:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  802347:	29 ce                	sub    %ecx,%esi
+  802349:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80234e:	f7 e6                	mul    %esi
+  802350:	c1 ea 0c             	shr    $0xc,%edx
+  802353:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  802359:	29 c6                	sub    %eax,%esi
+  80235b:	89 f2                	mov    %esi,%edx
+  80235d:	75 43                	jne    8023a2 <devpipe_read+0x82>
+		ref = pageref(p);
+  80235f:	83 ec 0c             	sub    $0xc,%esp
+  802362:	53                   	push   %ebx
+  802363:	e8 5d 2c 00 00       	call   804fc5 <pageref>
+  802368:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  80236a:	89 da                	mov    %ebx,%edx
+  80236c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80236f:	e8 47 ff ff ff       	call   8022bb <_pipeisclosed>
+  802374:	83 c4 10             	add    $0x10,%esp
+  802377:	85 c0                	test   %eax,%eax
+  802379:	0f 85 c1 00 00 00    	jne    802440 <devpipe_read+0x120>
+	*sleeping = 1;
+  80237f:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  802386:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80238b:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  80238e:	75 ac                	jne    80233c <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  802390:	83 ec 04             	sub    $0x4,%esp
+  802393:	56                   	push   %esi
+  802394:	57                   	push   %edi
+  802395:	ff 75 e4             	push   -0x1c(%ebp)
+  802398:	e8 33 f3 ff ff       	call   8016d0 <sys_futex_wait>
+  80239d:	83 c4 10             	add    $0x10,%esp
+  8023a0:	eb 9a                	jmp    80233c <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  8023a2:	39 75 10             	cmp    %esi,0x10(%ebp)
+  8023a5:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  8023a9:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8023ab:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8023b0:	f7 e1                	mul    %ecx
+  8023b2:	c1 ea 0b             	shr    $0xb,%edx
+  8023b5:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8023bb:	29 c1                	sub    %eax,%ecx
+  8023bd:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  8023bf:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8023c4:	29 cf                	sub    %ecx,%edi
+  8023c6:	39 f7                	cmp    %esi,%edi
+  8023c8:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  8023cb:	8d 43 10             	lea    0x10(%ebx),%eax
+  8023ce:	83 ec 04             	sub    $0x4,%esp
+  8023d1:	57                   	push   %edi
+  8023d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8023d5:	01 c2                	add    %eax,%edx
+  8023d7:	52                   	push   %edx
+  8023d8:	ff 75 0c             	push   0xc(%ebp)
+  8023db:	e8 aa ea ff ff       	call   800e8a <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  8023e0:	83 c4 0c             	add    $0xc,%esp
+  8023e3:	89 f1                	mov    %esi,%ecx
+  8023e5:	29 f9                	sub    %edi,%ecx
+  8023e7:	51                   	push   %ecx
+  8023e8:	ff 75 e4             	push   -0x1c(%ebp)
+  8023eb:	89 f8                	mov    %edi,%eax
+  8023ed:	03 45 0c             	add    0xc(%ebp),%eax
+  8023f0:	50                   	push   %eax
+  8023f1:	e8 94 ea ff ff       	call   800e8a <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  8023f6:	89 f1                	mov    %esi,%ecx
+  8023f8:	03 0b                	add    (%ebx),%ecx
+  8023fa:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8023ff:	f7 e1                	mul    %ecx
+  802401:	c1 ea 0c             	shr    $0xc,%edx
+  802404:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80240a:	29 d1                	sub    %edx,%ecx
+  80240c:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  80240e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802413:	83 c4 10             	add    $0x10,%esp
+  802416:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  80241a:	75 0a                	jne    802426 <devpipe_read+0x106>
+	return n;
+  80241c:	89 f0                	mov    %esi,%eax
+}
+  80241e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802421:	5b                   	pop    %ebx
+  802422:	5e                   	pop    %esi
+  802423:	5f                   	pop    %edi
+  802424:	5d                   	pop    %ebp
+  802425:	c3                   	ret
+		*sleeping = 0;
+  802426:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  80242d:	83 ec 08             	sub    $0x8,%esp
+  802430:	68 00 04 00 00       	push   $0x400
+  802435:	53                   	push   %ebx
+  802436:	e8 e5 f2 ff ff       	call   801720 <sys_futex_wake>
+  80243b:	83 c4 10             	add    $0x10,%esp
+  80243e:	eb dc                	jmp    80241c <devpipe_read+0xfc>
+			return 0;
+  802440:	b8 00 00 00 00       	mov    $0x0,%eax
+  802445:	eb d7                	jmp    80241e <devpipe_read+0xfe>
+
+00802447 <devpipe_write>:
+{
+  802447:	55                   	push   %ebp
+  802448:	89 e5                	mov    %esp,%ebp
+  80244a:	57                   	push   %edi
+  80244b:	56                   	push   %esi
+  80244c:	53                   	push   %ebx
+  80244d:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802450:	ff 75 08             	push   0x8(%ebp)
+  802453:	e8 64 f4 ff ff       	call   8018bc <fd2data>
+  802458:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  80245a:	83 c4 10             	add    $0x10,%esp
+  80245d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802464:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802467:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80246a:	0f 83 23 01 00 00    	jae    802593 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802470:	8b 77 04             	mov    0x4(%edi),%esi
+  802473:	8b 1f                	mov    (%edi),%ebx
+  802475:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  80247b:	29 d9                	sub    %ebx,%ecx
+  80247d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802482:	f7 e1                	mul    %ecx
+  802484:	c1 ea 0c             	shr    $0xc,%edx
+  802487:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80248d:	29 c1                	sub    %eax,%ecx
+  80248f:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802491:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802497:	75 40                	jne    8024d9 <devpipe_write+0x92>
+			ref = pageref(p);
+  802499:	83 ec 0c             	sub    $0xc,%esp
+  80249c:	57                   	push   %edi
+  80249d:	e8 23 2b 00 00       	call   804fc5 <pageref>
+  8024a2:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  8024a4:	89 fa                	mov    %edi,%edx
+  8024a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024a9:	e8 0d fe ff ff       	call   8022bb <_pipeisclosed>
+  8024ae:	83 c4 10             	add    $0x10,%esp
+  8024b1:	85 c0                	test   %eax,%eax
+  8024b3:	0f 85 d5 00 00 00    	jne    80258e <devpipe_write+0x147>
+	*sleeping = 1;
+  8024b9:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  8024c0:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8024c5:	39 1f                	cmp    %ebx,(%edi)
+  8024c7:	75 a7                	jne    802470 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  8024c9:	83 ec 04             	sub    $0x4,%esp
+  8024cc:	56                   	push   %esi
+  8024cd:	53                   	push   %ebx
+  8024ce:	57                   	push   %edi
+  8024cf:	e8 fc f1 ff ff       	call   8016d0 <sys_futex_wait>
+  8024d4:	83 c4 10             	add    $0x10,%esp
+  8024d7:	eb 97                	jmp    802470 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8024d9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8024dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024df:	29 c1                	sub    %eax,%ecx
+  8024e1:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8024e6:	89 d8                	mov    %ebx,%eax
+  8024e8:	29 d0                	sub    %edx,%eax
+  8024ea:	39 c1                	cmp    %eax,%ecx
+  8024ec:	0f 46 c1             	cmovbe %ecx,%eax
+  8024ef:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  8024f1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8024f6:	f7 e6                	mul    %esi
+  8024f8:	c1 ea 0b             	shr    $0xb,%edx
+  8024fb:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802501:	29 c6                	sub    %eax,%esi
+  802503:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802505:	29 f3                	sub    %esi,%ebx
+  802507:	39 cb                	cmp    %ecx,%ebx
+  802509:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80250c:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  80250f:	8d 77 10             	lea    0x10(%edi),%esi
+  802512:	83 ec 04             	sub    $0x4,%esp
+  802515:	53                   	push   %ebx
+  802516:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802519:	03 45 0c             	add    0xc(%ebp),%eax
+  80251c:	50                   	push   %eax
+  80251d:	01 f2                	add    %esi,%edx
+  80251f:	52                   	push   %edx
+  802520:	e8 65 e9 ff ff       	call   800e8a <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802525:	83 c4 0c             	add    $0xc,%esp
+  802528:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80252b:	29 d8                	sub    %ebx,%eax
+  80252d:	50                   	push   %eax
+  80252e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802531:	01 d3                	add    %edx,%ebx
+  802533:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802536:	53                   	push   %ebx
+  802537:	56                   	push   %esi
+  802538:	e8 4d e9 ff ff       	call   800e8a <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  80253d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802540:	03 4f 04             	add    0x4(%edi),%ecx
+  802543:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802548:	f7 e1                	mul    %ecx
+  80254a:	c1 ea 0c             	shr    $0xc,%edx
+  80254d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802553:	29 d1                	sub    %edx,%ecx
+  802555:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  802558:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80255d:	83 c4 10             	add    $0x10,%esp
+  802560:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802564:	75 0b                	jne    802571 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802566:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  802569:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80256c:	e9 f3 fe ff ff       	jmp    802464 <devpipe_write+0x1d>
+		*sleeping = 0;
+  802571:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  802578:	83 ec 08             	sub    $0x8,%esp
+  80257b:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802580:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802583:	50                   	push   %eax
+  802584:	e8 97 f1 ff ff       	call   801720 <sys_futex_wake>
+  802589:	83 c4 10             	add    $0x10,%esp
+  80258c:	eb d8                	jmp    802566 <devpipe_write+0x11f>
+				return 0;
+  80258e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802593:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802596:	5b                   	pop    %ebx
+  802597:	5e                   	pop    %esi
+  802598:	5f                   	pop    %edi
+  802599:	5d                   	pop    %ebp
+  80259a:	c3                   	ret
+
+0080259b <pipe>:
+{
+  80259b:	55                   	push   %ebp
+  80259c:	89 e5                	mov    %esp,%ebp
+  80259e:	56                   	push   %esi
+  80259f:	53                   	push   %ebx
+  8025a0:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8025a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025a6:	50                   	push   %eax
+  8025a7:	e8 27 f3 ff ff       	call   8018d3 <fd_alloc>
+  8025ac:	89 c3                	mov    %eax,%ebx
+  8025ae:	83 c4 10             	add    $0x10,%esp
+  8025b1:	85 c0                	test   %eax,%eax
+  8025b3:	0f 88 23 01 00 00    	js     8026dc <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025b9:	83 ec 04             	sub    $0x4,%esp
+  8025bc:	68 07 04 00 00       	push   $0x407
+  8025c1:	ff 75 f4             	push   -0xc(%ebp)
+  8025c4:	6a 00                	push   $0x0
+  8025c6:	e8 2c ec ff ff       	call   8011f7 <sys_page_alloc>
+  8025cb:	89 c3                	mov    %eax,%ebx
+  8025cd:	83 c4 10             	add    $0x10,%esp
+  8025d0:	85 c0                	test   %eax,%eax
+  8025d2:	0f 88 04 01 00 00    	js     8026dc <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8025d8:	83 ec 0c             	sub    $0xc,%esp
+  8025db:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025de:	50                   	push   %eax
+  8025df:	e8 ef f2 ff ff       	call   8018d3 <fd_alloc>
+  8025e4:	89 c3                	mov    %eax,%ebx
+  8025e6:	83 c4 10             	add    $0x10,%esp
+  8025e9:	85 c0                	test   %eax,%eax
+  8025eb:	0f 88 db 00 00 00    	js     8026cc <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025f1:	83 ec 04             	sub    $0x4,%esp
+  8025f4:	68 07 04 00 00       	push   $0x407
+  8025f9:	ff 75 f0             	push   -0x10(%ebp)
+  8025fc:	6a 00                	push   $0x0
+  8025fe:	e8 f4 eb ff ff       	call   8011f7 <sys_page_alloc>
+  802603:	89 c3                	mov    %eax,%ebx
+  802605:	83 c4 10             	add    $0x10,%esp
+  802608:	85 c0                	test   %eax,%eax
+  80260a:	0f 88 bc 00 00 00    	js     8026cc <pipe+0x131>
+	va = fd2data(fd0);
+  802610:	83 ec 0c             	sub    $0xc,%esp
+  802613:	ff 75 f4             	push   -0xc(%ebp)
+  802616:	e8 a1 f2 ff ff       	call   8018bc <fd2data>
+  80261b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80261d:	83 c4 0c             	add    $0xc,%esp
+  802620:	68 07 04 00 00       	push   $0x407
+  802625:	50                   	push   %eax
+  802626:	6a 00                	push   $0x0
+  802628:	e8 ca eb ff ff       	call   8011f7 <sys_page_alloc>
+  80262d:	89 c3                	mov    %eax,%ebx
+  80262f:	83 c4 10             	add    $0x10,%esp
+  802632:	85 c0                	test   %eax,%eax
+  802634:	0f 88 82 00 00 00    	js     8026bc <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80263a:	83 ec 0c             	sub    $0xc,%esp
+  80263d:	ff 75 f0             	push   -0x10(%ebp)
+  802640:	e8 77 f2 ff ff       	call   8018bc <fd2data>
+  802645:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80264c:	50                   	push   %eax
+  80264d:	6a 00                	push   $0x0
+  80264f:	56                   	push   %esi
+  802650:	6a 00                	push   $0x0
+  802652:	e8 e3 eb ff ff       	call   80123a <sys_page_map>
+  802657:	89 c3                	mov    %eax,%ebx
+  802659:	83 c4 20             	add    $0x20,%esp
+  80265c:	85 c0                	test   %eax,%eax
+  80265e:	78 4e                	js     8026ae <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802660:	a1 20 60 80 00       	mov    0x806020,%eax
+  802665:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802668:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80266a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80266d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802674:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802677:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802679:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80267c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802683:	83 ec 0c             	sub    $0xc,%esp
+  802686:	ff 75 f4             	push   -0xc(%ebp)
+  802689:	e8 1e f2 ff ff       	call   8018ac <fd2num>
+  80268e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802691:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802693:	83 c4 04             	add    $0x4,%esp
+  802696:	ff 75 f0             	push   -0x10(%ebp)
+  802699:	e8 0e f2 ff ff       	call   8018ac <fd2num>
+  80269e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8026a1:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8026a4:	83 c4 10             	add    $0x10,%esp
+  8026a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026ac:	eb 2e                	jmp    8026dc <pipe+0x141>
+	sys_page_unmap(0, va);
+  8026ae:	83 ec 08             	sub    $0x8,%esp
+  8026b1:	56                   	push   %esi
+  8026b2:	6a 00                	push   $0x0
+  8026b4:	e8 c3 eb ff ff       	call   80127c <sys_page_unmap>
+  8026b9:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8026bc:	83 ec 08             	sub    $0x8,%esp
+  8026bf:	ff 75 f0             	push   -0x10(%ebp)
+  8026c2:	6a 00                	push   $0x0
+  8026c4:	e8 b3 eb ff ff       	call   80127c <sys_page_unmap>
+  8026c9:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8026cc:	83 ec 08             	sub    $0x8,%esp
+  8026cf:	ff 75 f4             	push   -0xc(%ebp)
+  8026d2:	6a 00                	push   $0x0
+  8026d4:	e8 a3 eb ff ff       	call   80127c <sys_page_unmap>
+  8026d9:	83 c4 10             	add    $0x10,%esp
+}
+  8026dc:	89 d8                	mov    %ebx,%eax
+  8026de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026e1:	5b                   	pop    %ebx
+  8026e2:	5e                   	pop    %esi
+  8026e3:	5d                   	pop    %ebp
+  8026e4:	c3                   	ret
+
+008026e5 <pipeisclosed>:
+{
+  8026e5:	55                   	push   %ebp
+  8026e6:	89 e5                	mov    %esp,%ebp
+  8026e8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026ee:	50                   	push   %eax
+  8026ef:	ff 75 08             	push   0x8(%ebp)
+  8026f2:	e8 30 f2 ff ff       	call   801927 <fd_lookup>
+  8026f7:	83 c4 10             	add    $0x10,%esp
+  8026fa:	85 c0                	test   %eax,%eax
+  8026fc:	78 18                	js     802716 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8026fe:	83 ec 0c             	sub    $0xc,%esp
+  802701:	ff 75 f4             	push   -0xc(%ebp)
+  802704:	e8 b3 f1 ff ff       	call   8018bc <fd2data>
+  802709:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80270b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80270e:	e8 a8 fb ff ff       	call   8022bb <_pipeisclosed>
+  802713:	83 c4 10             	add    $0x10,%esp
+}
+  802716:	c9                   	leave
+  802717:	c3                   	ret
+
+00802718 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802718:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  80271a:	8b 15 14 e9 80 00    	mov    0x80e914,%edx
+  802720:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802726:	81 c2 34 01 00 00    	add    $0x134,%edx
+  80272c:	39 d0                	cmp    %edx,%eax
+  80272e:	74 2e                	je     80275e <segment_lookup+0x46>
+{
+  802730:	55                   	push   %ebp
+  802731:	89 e5                	mov    %esp,%ebp
+  802733:	57                   	push   %edi
+  802734:	56                   	push   %esi
+  802735:	53                   	push   %ebx
+  802736:	eb 07                	jmp    80273f <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802738:	83 c0 20             	add    $0x20,%eax
+  80273b:	39 d0                	cmp    %edx,%eax
+  80273d:	74 15                	je     802754 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  80273f:	8b 18                	mov    (%eax),%ebx
+  802741:	39 d9                	cmp    %ebx,%ecx
+  802743:	72 f3                	jb     802738 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  802745:	8b 38                	mov    (%eax),%edi
+  802747:	8b 58 04             	mov    0x4(%eax),%ebx
+  80274a:	89 ce                	mov    %ecx,%esi
+  80274c:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  80274e:	39 de                	cmp    %ebx,%esi
+  802750:	73 e6                	jae    802738 <segment_lookup+0x20>
+  802752:	eb 05                	jmp    802759 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  802754:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802759:	5b                   	pop    %ebx
+  80275a:	5e                   	pop    %esi
+  80275b:	5f                   	pop    %edi
+  80275c:	5d                   	pop    %ebp
+  80275d:	c3                   	ret
+	return NULL;
+  80275e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802763:	c3                   	ret
+
+00802764 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802764:	55                   	push   %ebp
+  802765:	89 e5                	mov    %esp,%ebp
+  802767:	53                   	push   %ebx
+  802768:	83 ec 04             	sub    $0x4,%esp
+  80276b:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80276d:	c1 e8 16             	shr    $0x16,%eax
+  802770:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802777:	25 81 00 00 00       	and    $0x81,%eax
+  80277c:	83 f8 01             	cmp    $0x1,%eax
+  80277f:	75 6b                	jne    8027ec <page_is_clean+0x88>
+  802781:	89 da                	mov    %ebx,%edx
+  802783:	c1 ea 0c             	shr    $0xc,%edx
+  802786:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  80278d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802792:	f6 c1 01             	test   $0x1,%cl
+  802795:	74 5a                	je     8027f1 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802797:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80279e:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  8027a4:	75 4b                	jne    8027f1 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  8027a6:	89 d8                	mov    %ebx,%eax
+  8027a8:	e8 6b ff ff ff       	call   802718 <segment_lookup>
+  8027ad:	89 c2                	mov    %eax,%edx
+		return 1;
+  8027af:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  8027b4:	85 d2                	test   %edx,%edx
+  8027b6:	75 39                	jne    8027f1 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  8027b8:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  8027be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c3:	eb 03                	jmp    8027c8 <page_is_clean+0x64>
+  8027c5:	83 c0 01             	add    $0x1,%eax
+  8027c8:	39 c2                	cmp    %eax,%edx
+  8027ca:	7e 19                	jle    8027e5 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  8027cc:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  8027d3:	72 f0                	jb     8027c5 <page_is_clean+0x61>
+  8027d5:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  8027dc:	73 e7                	jae    8027c5 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  8027de:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027e3:	eb 0c                	jmp    8027f1 <page_is_clean+0x8d>
+	return 0;
+  8027e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ea:	eb 05                	jmp    8027f1 <page_is_clean+0x8d>
+		return 0;
+  8027ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027f4:	c9                   	leave
+  8027f5:	c3                   	ret
+
+008027f6 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  8027f6:	55                   	push   %ebp
+  8027f7:	89 e5                	mov    %esp,%ebp
+  8027f9:	57                   	push   %edi
+  8027fa:	56                   	push   %esi
+  8027fb:	53                   	push   %ebx
+  8027fc:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8027ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802804:	eb 19                	jmp    80281f <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802806:	f7 d3                	not    %ebx
+  802808:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80280e:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802810:	83 c6 01             	add    $0x1,%esi
+  802813:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802819:	0f 87 97 00 00 00    	ja     8028b6 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80281f:	89 f3                	mov    %esi,%ebx
+  802821:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  802827:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80282d:	89 d8                	mov    %ebx,%eax
+  80282f:	c1 e8 0a             	shr    $0xa,%eax
+  802832:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802839:	25 81 00 00 00       	and    $0x81,%eax
+  80283e:	83 f8 01             	cmp    $0x1,%eax
+  802841:	75 c3                	jne    802806 <linear_walk+0x10>
+  802843:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802849:	77 bb                	ja     802806 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  80284b:	89 df                	mov    %ebx,%edi
+  80284d:	c1 e7 0c             	shl    $0xc,%edi
+  802850:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802853:	89 f8                	mov    %edi,%eax
+  802855:	e8 0a ff ff ff       	call   802764 <page_is_clean>
+  80285a:	84 c0                	test   %al,%al
+  80285c:	75 64                	jne    8028c2 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80285e:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802864:	77 aa                	ja     802810 <linear_walk+0x1a>
+  802866:	81 ff 00 00 81 00    	cmp    $0x810000,%edi
+  80286c:	72 a2                	jb     802810 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80286e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802875:	a8 01                	test   $0x1,%al
+  802877:	74 97                	je     802810 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802879:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802880:	f6 c4 04             	test   $0x4,%ah
+  802883:	75 8b                	jne    802810 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802885:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80288c:	f6 c4 02             	test   $0x2,%ah
+  80288f:	0f 85 7b ff ff ff    	jne    802810 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802895:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80289c:	c1 e8 0c             	shr    $0xc,%eax
+  80289f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8028a2:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8028a7:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8028ab:	66 83 f8 01          	cmp    $0x1,%ax
+  8028af:	76 11                	jbe    8028c2 <linear_walk+0xcc>
+  8028b1:	e9 5a ff ff ff       	jmp    802810 <linear_walk+0x1a>
+  8028b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  8028bb:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  8028c2:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  8028c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028cb:	83 c4 1c             	add    $0x1c,%esp
+  8028ce:	5b                   	pop    %ebx
+  8028cf:	5e                   	pop    %esi
+  8028d0:	5f                   	pop    %edi
+  8028d1:	5d                   	pop    %ebp
+  8028d2:	c3                   	ret
+
+008028d3 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  8028d3:	55                   	push   %ebp
+  8028d4:	89 e5                	mov    %esp,%ebp
+  8028d6:	56                   	push   %esi
+  8028d7:	53                   	push   %ebx
+  8028d8:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  8028da:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8028df:	83 e0 7f             	and    $0x7f,%eax
+  8028e2:	c1 e0 04             	shl    $0x4,%eax
+  8028e5:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  8028eb:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  8028f1:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  8028f7:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  8028fd:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802902:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  802905:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80290a:	83 c0 01             	add    $0x1,%eax
+  80290d:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  802912:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802915:	5b                   	pop    %ebx
+  802916:	5e                   	pop    %esi
+  802917:	5d                   	pop    %ebp
+  802918:	c3                   	ret
+
+00802919 <page_ring_enter>:
+{
+  802919:	55                   	push   %ebp
+  80291a:	89 e5                	mov    %esp,%ebp
+  80291c:	57                   	push   %edi
+  80291d:	56                   	push   %esi
+  80291e:	53                   	push   %ebx
+  80291f:	83 ec 18             	sub    $0x18,%esp
+  802922:	89 c6                	mov    %eax,%esi
+  802924:	89 d7                	mov    %edx,%edi
+  802926:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802928:	6a 00                	push   $0x0
+  80292a:	6a 00                	push   $0x0
+  80292c:	6a 00                	push   $0x0
+  80292e:	6a 07                	push   $0x7
+  802930:	ff 35 40 b0 80 00    	push   0x80b040
+  802936:	e8 74 25 00 00       	call   804eaf <ipc_call>
+  80293b:	83 c4 20             	add    $0x20,%esp
+  80293e:	85 c0                	test   %eax,%eax
+  802940:	79 22                	jns    802964 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802942:	50                   	push   %eax
+  802943:	68 e2 57 80 00       	push   $0x8057e2
+  802948:	68 13 02 00 00       	push   $0x213
+  80294d:	68 f6 57 80 00       	push   $0x8057f6
+  802952:	e8 eb dc ff ff       	call   800642 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802957:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  80295c:	83 c0 01             	add    $0x1,%eax
+  80295f:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802964:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  80296a:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  80296f:	39 c2                	cmp    %eax,%edx
+  802971:	74 24                	je     802997 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802973:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802978:	83 e0 7f             	and    $0x7f,%eax
+  80297b:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802982:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802989:	29 f0                	sub    %esi,%eax
+  80298b:	39 d8                	cmp    %ebx,%eax
+  80298d:	73 c8                	jae    802957 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  80298f:	8b 52 04             	mov    0x4(%edx),%edx
+  802992:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802995:	eb c0                	jmp    802957 <page_ring_enter+0x3e>
+}
+  802997:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80299a:	5b                   	pop    %ebx
+  80299b:	5e                   	pop    %esi
+  80299c:	5f                   	pop    %edi
+  80299d:	5d                   	pop    %ebp
+  80299e:	c3                   	ret
+
+0080299f <page_ring_reserve>:
+{
+  80299f:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  8029a1:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8029a6:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  8029ac:	29 d0                	sub    %edx,%eax
+  8029ae:	ba 80 00 00 00       	mov    $0x80,%edx
+  8029b3:	29 ca                	sub    %ecx,%edx
+  8029b5:	39 c2                	cmp    %eax,%edx
+  8029b7:	72 01                	jb     8029ba <page_ring_reserve+0x1b>
+  8029b9:	c3                   	ret
+{
+  8029ba:	55                   	push   %ebp
+  8029bb:	89 e5                	mov    %esp,%ebp
+  8029bd:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  8029c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029cf:	e8 45 ff ff ff       	call   802919 <page_ring_enter>
+}
+  8029d4:	c9                   	leave
+  8029d5:	c3                   	ret
+
+008029d6 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  8029d6:	55                   	push   %ebp
+  8029d7:	89 e5                	mov    %esp,%ebp
+  8029d9:	53                   	push   %ebx
+  8029da:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  8029dd:	6a 07                	push   $0x7
+  8029df:	6a 01                	push   $0x1
+  8029e1:	89 c3                	mov    %eax,%ebx
+  8029e3:	c1 e3 0c             	shl    $0xc,%ebx
+  8029e6:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  8029ec:	52                   	push   %edx
+  8029ed:	6a 04                	push   $0x4
+  8029ef:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  8029f6:	e8 b4 24 00 00       	call   804eaf <ipc_call>
+	sharereqs[i].nslots = 0;
+  8029fb:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  802a02:	00 00 00 
+	return r;
+}
+  802a05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a08:	c9                   	leave
+  802a09:	c3                   	ret
+
+00802a0a <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802a0a:	55                   	push   %ebp
+  802a0b:	89 e5                	mov    %esp,%ebp
+  802a0d:	56                   	push   %esi
+  802a0e:	53                   	push   %ebx
+  802a0f:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802a11:	c1 e8 10             	shr    $0x10,%eax
+  802a14:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802a17:	89 c2                	mov    %eax,%edx
+  802a19:	c1 e2 0c             	shl    $0xc,%edx
+  802a1c:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  802a22:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802a25:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  802a2b:	89 c2                	mov    %eax,%edx
+  802a2d:	c1 e2 0a             	shl    $0xa,%edx
+  802a30:	01 f2                	add    %esi,%edx
+  802a32:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802a39:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802a3f:	74 09                	je     802a4a <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802a41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a46:	5b                   	pop    %ebx
+  802a47:	5e                   	pop    %esi
+  802a48:	5d                   	pop    %ebp
+  802a49:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802a4a:	e8 87 ff ff ff       	call   8029d6 <page_share_send>
+  802a4f:	eb f5                	jmp    802a46 <page_share_slot+0x3c>
+
+00802a51 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802a51:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  802a56:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802a59:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802a5e:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  802a64:	74 09                	je     802a6f <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802a66:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802a6b:	85 c0                	test   %eax,%eax
+  802a6d:	75 01                	jne    802a70 <page_ring_ready+0x1f>
+}
+  802a6f:	c3                   	ret
+{
+  802a70:	55                   	push   %ebp
+  802a71:	89 e5                	mov    %esp,%ebp
+  802a73:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802a76:	68 07 06 00 00       	push   $0x607
+  802a7b:	6a 08                	push   $0x8
+  802a7d:	68 00 30 ad de       	push   $0xdead3000
+  802a82:	6a 00                	push   $0x0
+  802a84:	e8 99 e8 ff ff       	call   801322 <sys_page_alloc_range>
+  802a89:	83 c4 10             	add    $0x10,%esp
+  802a8c:	83 f8 08             	cmp    $0x8,%eax
+  802a8f:	74 1b                	je     802aac <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802a91:	83 ec 04             	sub    $0x4,%esp
+  802a94:	6a 08                	push   $0x8
+  802a96:	68 00 30 ad de       	push   $0xdead3000
+  802a9b:	6a 00                	push   $0x0
+  802a9d:	e8 ee e8 ff ff       	call   801390 <sys_page_unmap_range>
+		return 0;
+  802aa2:	83 c4 10             	add    $0x10,%esp
+  802aa5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802aaa:	c9                   	leave
+  802aab:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802aac:	83 ec 0c             	sub    $0xc,%esp
+  802aaf:	68 07 04 00 00       	push   $0x407
+  802ab4:	6a 08                	push   $0x8
+  802ab6:	68 00 30 ad de       	push   $0xdead3000
+  802abb:	6a 06                	push   $0x6
+  802abd:	ff 35 40 b0 80 00    	push   0x80b040
+  802ac3:	e8 e7 23 00 00       	call   804eaf <ipc_call>
+  802ac8:	83 c4 20             	add    $0x20,%esp
+  802acb:	85 c0                	test   %eax,%eax
+  802acd:	78 14                	js     802ae3 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802acf:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  802ad4:	8b 40 48             	mov    0x48(%eax),%eax
+  802ad7:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  802adc:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ae1:	eb c7                	jmp    802aaa <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802ae3:	83 ec 04             	sub    $0x4,%esp
+  802ae6:	6a 08                	push   $0x8
+  802ae8:	68 00 30 ad de       	push   $0xdead3000
+  802aed:	6a 00                	push   $0x0
+  802aef:	e8 9c e8 ff ff       	call   801390 <sys_page_unmap_range>
+		return 0;
+  802af4:	83 c4 10             	add    $0x10,%esp
+  802af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802afc:	eb ac                	jmp    802aaa <page_ring_ready+0x59>
+
+00802afe <page_remove_slot>:
+{
+  802afe:	55                   	push   %ebp
+  802aff:	89 e5                	mov    %esp,%ebp
+  802b01:	56                   	push   %esi
+  802b02:	53                   	push   %ebx
+  802b03:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802b05:	89 c6                	mov    %eax,%esi
+  802b07:	c1 ee 10             	shr    $0x10,%esi
+  802b0a:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802b0d:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  802b14:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  802b1a:	74 2a                	je     802b46 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802b1c:	83 ec 0c             	sub    $0xc,%esp
+  802b1f:	6a 00                	push   $0x0
+  802b21:	6a 00                	push   $0x0
+  802b23:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802b25:	c1 e3 04             	shl    $0x4,%ebx
+  802b28:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802b2b:	53                   	push   %ebx
+  802b2c:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  802b33:	e8 77 23 00 00       	call   804eaf <ipc_call>
+  802b38:	83 c4 20             	add    $0x20,%esp
+  802b3b:	85 c0                	test   %eax,%eax
+  802b3d:	78 2d                	js     802b6c <page_remove_slot+0x6e>
+}
+  802b3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b42:	5b                   	pop    %ebx
+  802b43:	5e                   	pop    %esi
+  802b44:	5d                   	pop    %ebp
+  802b45:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802b46:	e8 06 ff ff ff       	call   802a51 <page_ring_ready>
+  802b4b:	85 c0                	test   %eax,%eax
+  802b4d:	74 cd                	je     802b1c <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802b4f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b54:	e8 46 fe ff ff       	call   80299f <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802b59:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b5e:	89 da                	mov    %ebx,%edx
+  802b60:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b65:	e8 69 fd ff ff       	call   8028d3 <page_ring_post>
+		return;
+  802b6a:	eb d3                	jmp    802b3f <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802b6c:	50                   	push   %eax
+  802b6d:	68 50 58 80 00       	push   $0x805850
+  802b72:	68 ac 03 00 00       	push   $0x3ac
+  802b77:	68 f6 57 80 00       	push   $0x8057f6
+  802b7c:	e8 c1 da ff ff       	call   800642 <_panic>
+
+00802b81 <find_paging_env>:
+	if(pagingenv)
+  802b81:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802b86:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802b88:	85 c0                	test   %eax,%eax
+  802b8a:	74 05                	je     802b91 <find_paging_env+0x10>
+  802b8c:	eb 56                	jmp    802be4 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802b8e:	83 c0 01             	add    $0x1,%eax
+  802b91:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802b96:	7f 47                	jg     802bdf <find_paging_env+0x5e>
+  802b98:	83 f9 01             	cmp    $0x1,%ecx
+  802b9b:	7f 42                	jg     802bdf <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802b9d:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802ba0:	c1 e2 06             	shl    $0x6,%edx
+  802ba3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802ba9:	8b 52 50             	mov    0x50(%edx),%edx
+  802bac:	83 fa 02             	cmp    $0x2,%edx
+  802baf:	75 dd                	jne    802b8e <find_paging_env+0xd>
+  802bb1:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802bb4:	c1 e2 06             	shl    $0x6,%edx
+  802bb7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802bbd:	8b 52 54             	mov    0x54(%edx),%edx
+  802bc0:	85 d2                	test   %edx,%edx
+  802bc2:	74 ca                	je     802b8e <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802bc4:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802bc7:	c1 e2 06             	shl    $0x6,%edx
+  802bca:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802bd0:	8b 52 48             	mov    0x48(%edx),%edx
+  802bd3:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  802bda:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802bdd:	eb af                	jmp    802b8e <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802bdf:	83 f9 02             	cmp    $0x2,%ecx
+  802be2:	74 01                	je     802be5 <find_paging_env+0x64>
+}
+  802be4:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802be5:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  802bea:	8b 40 48             	mov    0x48(%eax),%eax
+  802bed:	83 e0 01             	and    $0x1,%eax
+  802bf0:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  802bf7:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  802bfc:	eb e6                	jmp    802be4 <find_paging_env+0x63>
+
+00802bfe <page_add_backed>:
+{
+  802bfe:	55                   	push   %ebp
+  802bff:	89 e5                	mov    %esp,%ebp
+  802c01:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802c04:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  802c09:	83 f8 04             	cmp    $0x4,%eax
+  802c0c:	74 35                	je     802c43 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802c0e:	89 d1                	mov    %edx,%ecx
+  802c10:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802c16:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802c1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c20:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802c27:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802c2d:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  802c34:	83 c0 01             	add    $0x1,%eax
+  802c37:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  802c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c41:	5d                   	pop    %ebp
+  802c42:	c3                   	ret
+		return -E_NO_MEM;
+  802c43:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802c48:	eb f7                	jmp    802c41 <page_add_backed+0x43>
+
+00802c4a <percentage_of_pgdir_to_walk>:
+{
+  802c4a:	55                   	push   %ebp
+  802c4b:	89 e5                	mov    %esp,%ebp
+  802c4d:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802c50:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802c54:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802c57:	db 45 fc             	fildl  -0x4(%ebp)
+  802c5a:	d8 35 dc 5c 80 00    	fdivs  0x805cdc
+	return ret*ret;
+  802c60:	d8 c8                	fmul   %st(0),%st
+}
+  802c62:	c9                   	leave
+  802c63:	c3                   	ret
+
+00802c64 <nfu_with_aging_page_choice_func>:
+{
+  802c64:	55                   	push   %ebp
+  802c65:	89 e5                	mov    %esp,%ebp
+  802c67:	57                   	push   %edi
+  802c68:	56                   	push   %esi
+  802c69:	53                   	push   %ebx
+  802c6a:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c6d:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  802c73:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802c75:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802c7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c7f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c86:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c8b:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802c8e:	eb 18                	jmp    802ca8 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802c90:	f7 d0                	not    %eax
+  802c92:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802c97:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c99:	83 c2 01             	add    $0x1,%edx
+  802c9c:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802ca2:	0f 87 13 01 00 00    	ja     802dbb <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802ca8:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802cac:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802caf:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802cb4:	89 c1                	mov    %eax,%ecx
+  802cb6:	c1 e9 0a             	shr    $0xa,%ecx
+  802cb9:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802cc0:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802cc6:	83 f9 01             	cmp    $0x1,%ecx
+  802cc9:	75 c5                	jne    802c90 <nfu_with_aging_page_choice_func+0x2c>
+  802ccb:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802cd0:	77 be                	ja     802c90 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802cd2:	89 c1                	mov    %eax,%ecx
+  802cd4:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802cd7:	81 f9 00 00 81 00    	cmp    $0x810000,%ecx
+  802cdd:	0f 82 a5 00 00 00    	jb     802d88 <nfu_with_aging_page_choice_func+0x124>
+  802ce3:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802ce9:	0f 87 99 00 00 00    	ja     802d88 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802cef:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802cf6:	f6 c1 01             	test   $0x1,%cl
+  802cf9:	0f 84 89 00 00 00    	je     802d88 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802cff:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802d06:	f6 c5 04             	test   $0x4,%ch
+  802d09:	75 7d                	jne    802d88 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802d0b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802d12:	f6 c5 02             	test   $0x2,%ch
+  802d15:	75 71                	jne    802d88 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802d17:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d1e:	c1 e9 0c             	shr    $0xc,%ecx
+  802d21:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d24:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d2a:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802d2e:	66 83 f9 01          	cmp    $0x1,%cx
+  802d32:	77 54                	ja     802d88 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802d34:	89 f9                	mov    %edi,%ecx
+  802d36:	80 f9 ff             	cmp    $0xff,%cl
+  802d39:	74 21                	je     802d5c <nfu_with_aging_page_choice_func+0xf8>
+  802d3b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d42:	c1 e9 0c             	shr    $0xc,%ecx
+  802d45:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d48:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d4e:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802d52:	89 fb                	mov    %edi,%ebx
+  802d54:	38 d9                	cmp    %bl,%cl
+  802d56:	73 30                	jae    802d88 <nfu_with_aging_page_choice_func+0x124>
+  802d58:	dd d8                	fstp   %st(0)
+  802d5a:	eb 02                	jmp    802d5e <nfu_with_aging_page_choice_func+0xfa>
+  802d5c:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802d5e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d65:	c1 e9 0c             	shr    $0xc,%ecx
+  802d68:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d6b:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802d72:	89 fb                	mov    %edi,%ebx
+  802d74:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802d77:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802d7a:	db 45 e0             	fildl  -0x20(%ebp)
+  802d7d:	d8 35 dc 5c 80 00    	fdivs  0x805cdc
+	return ret*ret;
+  802d83:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d85:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802d88:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802d8b:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802d8e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802d95:	df 6d e0             	fildll -0x20(%ebp)
+  802d98:	d9 c1                	fld    %st(1)
+  802d9a:	d8 0d e0 5c 80 00    	fmuls  0x805ce0
+  802da0:	d9 c9                	fxch   %st(1)
+  802da2:	df f1                	fcomip %st(1),%st
+  802da4:	dd d8                	fstp   %st(0)
+  802da6:	0f 82 ed fe ff ff    	jb     802c99 <nfu_with_aging_page_choice_func+0x35>
+  802dac:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802dae:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  802db3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802db6:	c1 e0 0c             	shl    $0xc,%eax
+  802db9:	eb 0e                	jmp    802dc9 <nfu_with_aging_page_choice_func+0x165>
+  802dbb:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802dbd:	89 f8                	mov    %edi,%eax
+  802dbf:	3c ff                	cmp    $0xff,%al
+  802dc1:	74 0e                	je     802dd1 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802dc3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802dc6:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802dc9:	83 c4 14             	add    $0x14,%esp
+  802dcc:	5b                   	pop    %ebx
+  802dcd:	5e                   	pop    %esi
+  802dce:	5f                   	pop    %edi
+  802dcf:	5d                   	pop    %ebp
+  802dd0:	c3                   	ret
+	pgnum = 0;
+  802dd1:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  802dd8:	00 00 00 
+	return (void*)UTOP;
+  802ddb:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802de0:	eb e7                	jmp    802dc9 <nfu_with_aging_page_choice_func+0x165>
+
+00802de2 <myRand>:
+    state = state * 1664525 + 1013904223;
+  802de2:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  802de9:	66 19 00 
+  802dec:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802df1:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  802df6:	c1 e8 18             	shr    $0x18,%eax
+}
+  802df9:	c3                   	ret
+
+00802dfa <random_page_choice_func>:
+{
+  802dfa:	55                   	push   %ebp
+  802dfb:	89 e5                	mov    %esp,%ebp
+  802dfd:	57                   	push   %edi
+  802dfe:	56                   	push   %esi
+  802dff:	53                   	push   %ebx
+  802e00:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802e03:	be 00 00 00 00       	mov    $0x0,%esi
+  802e08:	eb 19                	jmp    802e23 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802e0a:	f7 d3                	not    %ebx
+  802e0c:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802e12:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802e14:	83 c6 01             	add    $0x1,%esi
+  802e17:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802e1d:	0f 87 a0 00 00 00    	ja     802ec3 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802e23:	89 f3                	mov    %esi,%ebx
+  802e25:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  802e2b:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802e31:	89 d8                	mov    %ebx,%eax
+  802e33:	c1 e8 0a             	shr    $0xa,%eax
+  802e36:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802e3d:	25 81 00 00 00       	and    $0x81,%eax
+  802e42:	83 f8 01             	cmp    $0x1,%eax
+  802e45:	75 c3                	jne    802e0a <random_page_choice_func+0x10>
+  802e47:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802e4d:	77 bb                	ja     802e0a <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802e4f:	89 df                	mov    %ebx,%edi
+  802e51:	c1 e7 0c             	shl    $0xc,%edi
+  802e54:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802e57:	89 f8                	mov    %edi,%eax
+  802e59:	e8 06 f9 ff ff       	call   802764 <page_is_clean>
+  802e5e:	84 c0                	test   %al,%al
+  802e60:	0f 85 82 00 00 00    	jne    802ee8 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802e66:	81 ff 00 00 81 00    	cmp    $0x810000,%edi
+  802e6c:	72 a6                	jb     802e14 <random_page_choice_func+0x1a>
+  802e6e:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802e74:	77 9e                	ja     802e14 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802e76:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802e7d:	a8 01                	test   $0x1,%al
+  802e7f:	74 93                	je     802e14 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802e81:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802e88:	f6 c4 04             	test   $0x4,%ah
+  802e8b:	75 87                	jne    802e14 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802e8d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802e94:	f6 c4 02             	test   $0x2,%ah
+  802e97:	0f 85 77 ff ff ff    	jne    802e14 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802e9d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802ea4:	c1 e8 0c             	shr    $0xc,%eax
+  802ea7:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802eaa:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802eaf:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802eb3:	66 83 f8 01          	cmp    $0x1,%ax
+  802eb7:	0f 87 57 ff ff ff    	ja     802e14 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  802ebd:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802ec3:	e8 1a ff ff ff       	call   802de2 <myRand>
+  802ec8:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  802ece:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  802ed3:	29 fe                	sub    %edi,%esi
+  802ed5:	0f be c0             	movsbl %al,%eax
+  802ed8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802edd:	f7 f6                	div    %esi
+  802edf:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802ee1:	bb 15 00 00 00       	mov    $0x15,%ebx
+  802ee6:	eb 1c                	jmp    802f04 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  802ee8:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  802eee:	e9 8f 00 00 00       	jmp    802f82 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802ef3:	e8 ea fe ff ff       	call   802de2 <myRand>
+  802ef8:	0f be c0             	movsbl %al,%eax
+  802efb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f00:	f7 f6                	div    %esi
+  802f02:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802f04:	83 eb 01             	sub    $0x1,%ebx
+  802f07:	0f 84 c2 00 00 00    	je     802fcf <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  802f0d:	89 d0                	mov    %edx,%eax
+  802f0f:	c1 e8 0a             	shr    $0xa,%eax
+  802f12:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802f19:	25 81 00 00 00       	and    $0x81,%eax
+  802f1e:	83 f8 01             	cmp    $0x1,%eax
+  802f21:	75 d0                	jne    802ef3 <random_page_choice_func+0xf9>
+  802f23:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  802f29:	77 c8                	ja     802ef3 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  802f2b:	89 d0                	mov    %edx,%eax
+  802f2d:	c1 e0 0c             	shl    $0xc,%eax
+  802f30:	3d 00 00 81 00       	cmp    $0x810000,%eax
+  802f35:	72 56                	jb     802f8d <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f37:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  802f3c:	77 65                	ja     802fa3 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802f3e:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f45:	f6 c1 01             	test   $0x1,%cl
+  802f48:	74 59                	je     802fa3 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802f4a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802f51:	f6 c5 04             	test   $0x4,%ch
+  802f54:	75 4d                	jne    802fa3 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  802f56:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802f5d:	f6 c5 02             	test   $0x2,%ch
+  802f60:	75 41                	jne    802fa3 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  802f62:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802f69:	c1 ea 0c             	shr    $0xc,%edx
+  802f6c:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  802f6f:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  802f75:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  802f79:	66 83 fa 01          	cmp    $0x1,%dx
+  802f7d:	77 3a                	ja     802fb9 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  802f7f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  802f82:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f85:	83 c4 1c             	add    $0x1c,%esp
+  802f88:	5b                   	pop    %ebx
+  802f89:	5e                   	pop    %esi
+  802f8a:	5f                   	pop    %edi
+  802f8b:	5d                   	pop    %ebp
+  802f8c:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802f8d:	e8 50 fe ff ff       	call   802de2 <myRand>
+  802f92:	0f be c0             	movsbl %al,%eax
+  802f95:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f9a:	f7 f6                	div    %esi
+  802f9c:	01 fa                	add    %edi,%edx
+			continue;
+  802f9e:	e9 61 ff ff ff       	jmp    802f04 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802fa3:	e8 3a fe ff ff       	call   802de2 <myRand>
+  802fa8:	0f be c0             	movsbl %al,%eax
+  802fab:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fb0:	f7 f6                	div    %esi
+  802fb2:	01 fa                	add    %edi,%edx
+			continue;
+  802fb4:	e9 4b ff ff ff       	jmp    802f04 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802fb9:	e8 24 fe ff ff       	call   802de2 <myRand>
+  802fbe:	0f be c0             	movsbl %al,%eax
+  802fc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fc6:	f7 f6                	div    %esi
+  802fc8:	01 fa                	add    %edi,%edx
+			continue;
+  802fca:	e9 35 ff ff ff       	jmp    802f04 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  802fcf:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  802fd6:	00 00 00 
+	return (void*)UTOP;
+  802fd9:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  802fe0:	eb a0                	jmp    802f82 <random_page_choice_func+0x188>
+
+00802fe2 <nfu>:
+{
+  802fe2:	55                   	push   %ebp
+  802fe3:	89 e5                	mov    %esp,%ebp
+  802fe5:	57                   	push   %edi
+  802fe6:	56                   	push   %esi
+  802fe7:	53                   	push   %ebx
+  802fe8:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802feb:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  802ff1:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802ff3:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802ff8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ffd:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803004:	ba 00 00 00 00       	mov    $0x0,%edx
+  803009:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  80300c:	eb 18                	jmp    803026 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80300e:	f7 d0                	not    %eax
+  803010:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803015:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803017:	83 c2 01             	add    $0x1,%edx
+  80301a:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803020:	0f 87 13 01 00 00    	ja     803139 <nfu+0x157>
+		++num_searched_ptes;
+  803026:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80302a:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  80302d:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803032:	89 c1                	mov    %eax,%ecx
+  803034:	c1 e9 0a             	shr    $0xa,%ecx
+  803037:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80303e:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803044:	83 f9 01             	cmp    $0x1,%ecx
+  803047:	75 c5                	jne    80300e <nfu+0x2c>
+  803049:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  80304e:	77 be                	ja     80300e <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803050:	89 c1                	mov    %eax,%ecx
+  803052:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803055:	81 f9 00 00 81 00    	cmp    $0x810000,%ecx
+  80305b:	0f 82 a5 00 00 00    	jb     803106 <nfu+0x124>
+  803061:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803067:	0f 87 99 00 00 00    	ja     803106 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80306d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803074:	f6 c1 01             	test   $0x1,%cl
+  803077:	0f 84 89 00 00 00    	je     803106 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80307d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803084:	f6 c5 04             	test   $0x4,%ch
+  803087:	75 7d                	jne    803106 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803089:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803090:	f6 c5 02             	test   $0x2,%ch
+  803093:	75 71                	jne    803106 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803095:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80309c:	c1 e9 0c             	shr    $0xc,%ecx
+  80309f:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8030a2:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8030a8:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8030ac:	66 83 f9 01          	cmp    $0x1,%cx
+  8030b0:	77 54                	ja     803106 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  8030b2:	89 f9                	mov    %edi,%ecx
+  8030b4:	80 f9 ff             	cmp    $0xff,%cl
+  8030b7:	74 21                	je     8030da <nfu+0xf8>
+  8030b9:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8030c0:	c1 e9 0c             	shr    $0xc,%ecx
+  8030c3:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8030c6:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8030cc:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  8030d0:	89 fb                	mov    %edi,%ebx
+  8030d2:	38 d9                	cmp    %bl,%cl
+  8030d4:	73 30                	jae    803106 <nfu+0x124>
+  8030d6:	dd d8                	fstp   %st(0)
+  8030d8:	eb 02                	jmp    8030dc <nfu+0xfa>
+  8030da:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  8030dc:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8030e3:	c1 e9 0c             	shr    $0xc,%ecx
+  8030e6:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8030e9:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  8030f0:	89 fb                	mov    %edi,%ebx
+  8030f2:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  8030f5:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8030f8:	db 45 e0             	fildl  -0x20(%ebp)
+  8030fb:	d8 35 dc 5c 80 00    	fdivs  0x805cdc
+	return ret*ret;
+  803101:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803103:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803106:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  803109:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80310c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803113:	df 6d e0             	fildll -0x20(%ebp)
+  803116:	d9 c1                	fld    %st(1)
+  803118:	d8 0d e0 5c 80 00    	fmuls  0x805ce0
+  80311e:	d9 c9                	fxch   %st(1)
+  803120:	df f1                	fcomip %st(1),%st
+  803122:	dd d8                	fstp   %st(0)
+  803124:	0f 82 ed fe ff ff    	jb     803017 <nfu+0x35>
+  80312a:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  80312c:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  803131:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803134:	c1 e0 0c             	shl    $0xc,%eax
+  803137:	eb 0e                	jmp    803147 <nfu+0x165>
+  803139:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  80313b:	89 f8                	mov    %edi,%eax
+  80313d:	3c ff                	cmp    $0xff,%al
+  80313f:	74 0e                	je     80314f <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  803141:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803144:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803147:	83 c4 14             	add    $0x14,%esp
+  80314a:	5b                   	pop    %ebx
+  80314b:	5e                   	pop    %esi
+  80314c:	5f                   	pop    %edi
+  80314d:	5d                   	pop    %ebp
+  80314e:	c3                   	ret
+	pgnum = 0;
+  80314f:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  803156:	00 00 00 
+	return (void*)UTOP;
+  803159:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80315e:	eb e7                	jmp    803147 <nfu+0x165>
+
+00803160 <lru>:
+{
+  803160:	55                   	push   %ebp
+  803161:	89 e5                	mov    %esp,%ebp
+  803163:	57                   	push   %edi
+  803164:	56                   	push   %esi
+  803165:	53                   	push   %ebx
+  803166:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803169:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  80316f:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  803176:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80317d:	be 00 00 00 00       	mov    $0x0,%esi
+  803182:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803189:	ba 00 00 00 00       	mov    $0x0,%edx
+  80318e:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  803191:	eb 18                	jmp    8031ab <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803193:	f7 d0                	not    %eax
+  803195:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80319a:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80319c:	83 c2 01             	add    $0x1,%edx
+  80319f:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  8031a5:	0f 87 fa 00 00 00    	ja     8032a5 <lru+0x145>
+		++num_searched_ptes;
+  8031ab:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8031ae:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8031b1:	01 d0                	add    %edx,%eax
+  8031b3:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8031b8:	89 c1                	mov    %eax,%ecx
+  8031ba:	c1 e9 0a             	shr    $0xa,%ecx
+  8031bd:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8031c4:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8031ca:	83 f9 01             	cmp    $0x1,%ecx
+  8031cd:	75 c4                	jne    803193 <lru+0x33>
+  8031cf:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8031d4:	77 bd                	ja     803193 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8031d6:	89 c1                	mov    %eax,%ecx
+  8031d8:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8031db:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8031e1:	0f 87 92 00 00 00    	ja     803279 <lru+0x119>
+  8031e7:	81 f9 00 00 81 00    	cmp    $0x810000,%ecx
+  8031ed:	0f 82 86 00 00 00    	jb     803279 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8031f3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8031fa:	f6 c1 01             	test   $0x1,%cl
+  8031fd:	74 7a                	je     803279 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8031ff:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803206:	f6 c5 04             	test   $0x4,%ch
+  803209:	75 6e                	jne    803279 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80320b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803212:	f6 c5 02             	test   $0x2,%ch
+  803215:	75 62                	jne    803279 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803217:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80321e:	c1 e9 0c             	shr    $0xc,%ecx
+  803221:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803224:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80322a:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  80322e:	66 83 f9 01          	cmp    $0x1,%cx
+  803232:	77 45                	ja     803279 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  803234:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80323b:	c1 e9 0c             	shr    $0xc,%ecx
+  80323e:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803241:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803247:	8b 59 14             	mov    0x14(%ecx),%ebx
+  80324a:	8b 49 10             	mov    0x10(%ecx),%ecx
+  80324d:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  803250:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803253:	19 df                	sbb    %ebx,%edi
+  803255:	7c 22                	jl     803279 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  803257:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80325e:	c1 e9 0c             	shr    $0xc,%ecx
+  803261:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803264:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80326a:	8b 59 14             	mov    0x14(%ecx),%ebx
+  80326d:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803270:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  803273:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803276:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803279:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  80327c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803283:	df 6d e0             	fildll -0x20(%ebp)
+  803286:	d9 05 e0 5c 80 00    	flds   0x805ce0
+  80328c:	d9 c9                	fxch   %st(1)
+  80328e:	df f1                	fcomip %st(1),%st
+  803290:	dd d8                	fstp   %st(0)
+  803292:	0f 82 04 ff ff ff    	jb     80319c <lru+0x3c>
+			pgnum = pgnum_actual;
+  803298:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  80329d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8032a0:	c1 e0 0c             	shl    $0xc,%eax
+  8032a3:	eb 06                	jmp    8032ab <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  8032a5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8032a8:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8032ab:	83 c4 1c             	add    $0x1c,%esp
+  8032ae:	5b                   	pop    %ebx
+  8032af:	5e                   	pop    %esi
+  8032b0:	5f                   	pop    %edi
+  8032b1:	5d                   	pop    %ebp
+  8032b2:	c3                   	ret
+
+008032b3 <set_page_choice_func>:
+{
+  8032b3:	55                   	push   %ebp
+  8032b4:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  8032b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032b9:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  8032be:	5d                   	pop    %ebp
+  8032bf:	c3                   	ret
+
+008032c0 <get_page_choice>:
+{
+  8032c0:	55                   	push   %ebp
+  8032c1:	89 e5                	mov    %esp,%ebp
+  8032c3:	57                   	push   %edi
+  8032c4:	56                   	push   %esi
+  8032c5:	53                   	push   %ebx
+  8032c6:	83 ec 24             	sub    $0x24,%esp
+  8032c9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032cc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  8032cf:	57                   	push   %edi
+  8032d0:	56                   	push   %esi
+  8032d1:	ff 15 3c 60 80 00    	call   *0x80603c
+  8032d7:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8032d9:	83 c4 10             	add    $0x10,%esp
+  8032dc:	eb 25                	jmp    803303 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  8032de:	83 ec 08             	sub    $0x8,%esp
+  8032e1:	c1 e0 16             	shl    $0x16,%eax
+  8032e4:	50                   	push   %eax
+  8032e5:	6a 00                	push   $0x0
+  8032e7:	e8 d2 df ff ff       	call   8012be <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8032ec:	83 c4 10             	add    $0x10,%esp
+  8032ef:	85 c0                	test   %eax,%eax
+  8032f1:	75 43                	jne    803336 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  8032f3:	83 ec 08             	sub    $0x8,%esp
+  8032f6:	57                   	push   %edi
+  8032f7:	56                   	push   %esi
+  8032f8:	ff 15 3c 60 80 00    	call   *0x80603c
+  8032fe:	89 c3                	mov    %eax,%ebx
+  803300:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803303:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  803306:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80330c:	0f 86 ae 00 00 00    	jbe    8033c0 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803312:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  803317:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80331e:	81 e2 81 00 00 00    	and    $0x81,%edx
+  803324:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  80332a:	74 b2                	je     8032de <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80332c:	83 c0 01             	add    $0x1,%eax
+  80332f:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  803334:	75 e1                	jne    803317 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803336:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803339:	05 00 10 40 11       	add    $0x11401000,%eax
+  80333e:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803343:	76 1f                	jbe    803364 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  803345:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  80334a:	89 d8                	mov    %ebx,%eax
+  80334c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80334f:	5b                   	pop    %ebx
+  803350:	5e                   	pop    %esi
+  803351:	5f                   	pop    %edi
+  803352:	5d                   	pop    %ebp
+  803353:	c3                   	ret
+		sys_page_split(0, pg_out);
+  803354:	83 ec 08             	sub    $0x8,%esp
+  803357:	53                   	push   %ebx
+  803358:	6a 00                	push   $0x0
+  80335a:	e8 5f df ff ff       	call   8012be <sys_page_split>
+  80335f:	83 c4 10             	add    $0x10,%esp
+  803362:	eb 6c                	jmp    8033d0 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  803364:	83 ec 04             	sub    $0x4,%esp
+  803367:	68 88 58 80 00       	push   $0x805888
+  80336c:	68 cc 01 00 00       	push   $0x1cc
+  803371:	68 f6 57 80 00       	push   $0x8057f6
+  803376:	e8 c7 d2 ff ff       	call   800642 <_panic>
+		panic("We tried to page out code pages\n");
+  80337b:	83 ec 04             	sub    $0x4,%esp
+  80337e:	68 b8 58 80 00       	push   $0x8058b8
+  803383:	68 d6 01 00 00       	push   $0x1d6
+  803388:	68 f6 57 80 00       	push   $0x8057f6
+  80338d:	e8 b0 d2 ff ff       	call   800642 <_panic>
+		panic("Invalid mapping for the va\n");
+  803392:	83 ec 04             	sub    $0x4,%esp
+  803395:	68 03 58 80 00       	push   $0x805803
+  80339a:	68 da 01 00 00       	push   $0x1da
+  80339f:	68 f6 57 80 00       	push   $0x8057f6
+  8033a4:	e8 99 d2 ff ff       	call   800642 <_panic>
+		panic("We tried to page out a shared page\n");
+  8033a9:	83 ec 04             	sub    $0x4,%esp
+  8033ac:	68 dc 58 80 00       	push   $0x8058dc
+  8033b1:	68 e0 01 00 00       	push   $0x1e0
+  8033b6:	68 f6 57 80 00       	push   $0x8057f6
+  8033bb:	e8 82 d2 ff ff       	call   800642 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  8033c0:	89 de                	mov    %ebx,%esi
+  8033c2:	c1 ee 16             	shr    $0x16,%esi
+  8033c5:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8033cc:	a8 80                	test   $0x80,%al
+  8033ce:	75 84                	jne    803354 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  8033d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8033d3:	05 00 10 40 11       	add    $0x11401000,%eax
+  8033d8:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8033dd:	76 85                	jbe    803364 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  8033df:	89 d8                	mov    %ebx,%eax
+  8033e1:	e8 7e f3 ff ff       	call   802764 <page_is_clean>
+  8033e6:	84 c0                	test   %al,%al
+  8033e8:	0f 85 5c ff ff ff    	jne    80334a <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  8033ee:	81 7d e4 00 00 81 00 	cmpl   $0x810000,-0x1c(%ebp)
+  8033f5:	76 84                	jbe    80337b <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  8033f7:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8033fe:	a8 01                	test   $0x1,%al
+  803400:	74 90                	je     803392 <get_page_choice+0xd2>
+  803402:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803405:	c1 e8 0c             	shr    $0xc,%eax
+  803408:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80340f:	f6 c2 01             	test   $0x1,%dl
+  803412:	0f 84 7a ff ff ff    	je     803392 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803418:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  80341f:	f6 c2 01             	test   $0x1,%dl
+  803422:	74 85                	je     8033a9 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803424:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  80342b:	f6 c2 01             	test   $0x1,%dl
+  80342e:	0f 84 75 ff ff ff    	je     8033a9 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  803434:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  80343b:	f6 c6 04             	test   $0x4,%dh
+  80343e:	0f 85 65 ff ff ff    	jne    8033a9 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  803444:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  80344b:	f6 c6 02             	test   $0x2,%dh
+  80344e:	0f 85 55 ff ff ff    	jne    8033a9 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  803454:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80345b:	c1 e8 0c             	shr    $0xc,%eax
+  80345e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803461:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803466:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80346a:	66 83 f8 01          	cmp    $0x1,%ax
+  80346e:	0f 86 d6 fe ff ff    	jbe    80334a <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  803474:	83 ec 04             	sub    $0x4,%esp
+  803477:	68 00 59 80 00       	push   $0x805900
+  80347c:	68 e2 01 00 00       	push   $0x1e2
+  803481:	68 f6 57 80 00       	push   $0x8057f6
+  803486:	e8 b7 d1 ff ff       	call   800642 <_panic>
+
+0080348b <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  80348b:	55                   	push   %ebp
+  80348c:	89 e5                	mov    %esp,%ebp
+  80348e:	57                   	push   %edi
+  80348f:	56                   	push   %esi
+  803490:	53                   	push   %ebx
+  803491:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  803494:	e8 e8 f6 ff ff       	call   802b81 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  803499:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80349e:	85 c0                	test   %eax,%eax
+  8034a0:	74 41                	je     8034e3 <page_share_paged_out+0x58>
+  8034a2:	83 3d 10 e9 80 00 00 	cmpl   $0x0,0x80e910
+  8034a9:	0f 84 fd 00 00 00    	je     8035ac <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  8034af:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  8034b6:	00 00 00 
+  8034b9:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  8034c0:	00 00 00 
+  8034c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034c8:	eb 2c                	jmp    8034f6 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8034ca:	83 c3 04             	add    $0x4,%ebx
+  8034cd:	39 f3                	cmp    %esi,%ebx
+  8034cf:	74 1a                	je     8034eb <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  8034d1:	8b 03                	mov    (%ebx),%eax
+  8034d3:	a8 01                	test   $0x1,%al
+  8034d5:	74 f3                	je     8034ca <page_share_paged_out+0x3f>
+  8034d7:	c1 e8 0c             	shr    $0xc,%eax
+  8034da:	e8 2b f5 ff ff       	call   802a0a <page_share_slot>
+  8034df:	85 c0                	test   %eax,%eax
+  8034e1:	79 e7                	jns    8034ca <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  8034e3:	83 c4 0c             	add    $0xc,%esp
+  8034e6:	5b                   	pop    %ebx
+  8034e7:	5e                   	pop    %esi
+  8034e8:	5f                   	pop    %edi
+  8034e9:	5d                   	pop    %ebp
+  8034ea:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  8034eb:	83 c7 04             	add    $0x4,%edi
+  8034ee:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  8034f4:	74 1b                	je     803511 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  8034f6:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  8034fb:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  8034fe:	f6 c3 01             	test   $0x1,%bl
+  803501:	74 e8                	je     8034eb <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  803503:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803509:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  80350f:	eb bc                	jmp    8034cd <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803511:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803516:	eb 11                	jmp    803529 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  803518:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80351e:	83 c3 01             	add    $0x1,%ebx
+  803521:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803527:	77 41                	ja     80356a <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  803529:	89 d8                	mov    %ebx,%eax
+  80352b:	c1 e8 0a             	shr    $0xa,%eax
+  80352e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803535:	25 81 00 00 00       	and    $0x81,%eax
+  80353a:	83 f8 01             	cmp    $0x1,%eax
+  80353d:	75 d9                	jne    803518 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  80353f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803546:	25 81 00 00 00       	and    $0x81,%eax
+  80354b:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803550:	75 cc                	jne    80351e <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803552:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803559:	c1 e8 0c             	shr    $0xc,%eax
+  80355c:	e8 a9 f4 ff ff       	call   802a0a <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803561:	85 c0                	test   %eax,%eax
+  803563:	79 b9                	jns    80351e <page_share_paged_out+0x93>
+  803565:	e9 79 ff ff ff       	jmp    8034e3 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80356a:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803571:	75 13                	jne    803586 <page_share_paged_out+0xfb>
+  803573:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80357a:	75 1d                	jne    803599 <page_share_paged_out+0x10e>
+	return 0;
+  80357c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803581:	e9 5d ff ff ff       	jmp    8034e3 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803586:	b8 00 00 00 00       	mov    $0x0,%eax
+  80358b:	e8 46 f4 ff ff       	call   8029d6 <page_share_send>
+  803590:	85 c0                	test   %eax,%eax
+  803592:	79 df                	jns    803573 <page_share_paged_out+0xe8>
+  803594:	e9 4a ff ff ff       	jmp    8034e3 <page_share_paged_out+0x58>
+  803599:	b8 01 00 00 00       	mov    $0x1,%eax
+  80359e:	e8 33 f4 ff ff       	call   8029d6 <page_share_send>
+  8035a3:	85 c0                	test   %eax,%eax
+  8035a5:	79 d5                	jns    80357c <page_share_paged_out+0xf1>
+  8035a7:	e9 37 ff ff ff       	jmp    8034e3 <page_share_paged_out+0x58>
+		return 0;
+  8035ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035b1:	e9 2d ff ff ff       	jmp    8034e3 <page_share_paged_out+0x58>
+
+008035b6 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  8035b6:	55                   	push   %ebp
+  8035b7:	89 e5                	mov    %esp,%ebp
+  8035b9:	56                   	push   %esi
+  8035ba:	53                   	push   %ebx
+  8035bb:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  8035be:	e8 be f5 ff ff       	call   802b81 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  8035c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  8035c8:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8035cf:	0f 84 82 00 00 00    	je     803657 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  8035d5:	83 ec 0c             	sub    $0xc,%esp
+  8035d8:	68 00 10 00 00       	push   $0x1000
+  8035dd:	e8 84 11 00 00       	call   804766 <malloc>
+  8035e2:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  8035e4:	83 c4 0c             	add    $0xc,%esp
+  8035e7:	6a 14                	push   $0x14
+  8035e9:	6a 00                	push   $0x0
+  8035eb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8035ee:	50                   	push   %eax
+  8035ef:	e8 61 d8 ff ff       	call   800e55 <memset>
+  8035f4:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  8035f7:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  8035fc:	83 ec 0c             	sub    $0xc,%esp
+  8035ff:	6a 07                	push   $0x7
+  803601:	6a 01                	push   $0x1
+  803603:	53                   	push   %ebx
+  803604:	6a 03                	push   $0x3
+  803606:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  80360d:	e8 9d 18 00 00       	call   804eaf <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  803612:	8b 03                	mov    (%ebx),%eax
+  803614:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803617:	8b 43 04             	mov    0x4(%ebx),%eax
+  80361a:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  80361d:	8b 43 08             	mov    0x8(%ebx),%eax
+  803620:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  803623:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803626:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  803629:	8b 43 10             	mov    0x10(%ebx),%eax
+  80362c:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  80362f:	83 c6 01             	add    $0x1,%esi
+  803632:	83 c4 20             	add    $0x20,%esp
+  803635:	83 fe 02             	cmp    $0x2,%esi
+  803638:	75 c2                	jne    8035fc <get_paging_stats+0x46>
+	}
+	*stats = total;
+  80363a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80363d:	89 03                	mov    %eax,(%ebx)
+  80363f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803642:	89 43 04             	mov    %eax,0x4(%ebx)
+  803645:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803648:	89 43 08             	mov    %eax,0x8(%ebx)
+  80364b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80364e:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803651:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803654:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  803657:	89 d8                	mov    %ebx,%eax
+  803659:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80365c:	5b                   	pop    %ebx
+  80365d:	5e                   	pop    %esi
+  80365e:	5d                   	pop    %ebp
+  80365f:	c3                   	ret
+
+00803660 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803660:	55                   	push   %ebp
+  803661:	89 e5                	mov    %esp,%ebp
+  803663:	53                   	push   %ebx
+  803664:	83 ec 10             	sub    $0x10,%esp
+  803667:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  80366a:	68 30 52 80 00       	push   $0x805230
+  80366f:	e8 a9 d0 ff ff       	call   80071d <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  803674:	83 c4 08             	add    $0x8,%esp
+  803677:	ff 33                	push   (%ebx)
+  803679:	68 34 59 80 00       	push   $0x805934
+  80367e:	e8 9a d0 ff ff       	call   80071d <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  803683:	83 c4 08             	add    $0x8,%esp
+  803686:	ff 73 04             	push   0x4(%ebx)
+  803689:	68 1f 58 80 00       	push   $0x80581f
+  80368e:	e8 8a d0 ff ff       	call   80071d <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  803693:	83 c4 08             	add    $0x8,%esp
+  803696:	ff 73 08             	push   0x8(%ebx)
+  803699:	68 54 59 80 00       	push   $0x805954
+  80369e:	e8 7a d0 ff ff       	call   80071d <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  8036a3:	83 c4 08             	add    $0x8,%esp
+  8036a6:	ff 73 0c             	push   0xc(%ebx)
+  8036a9:	68 78 59 80 00       	push   $0x805978
+  8036ae:	e8 6a d0 ff ff       	call   80071d <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  8036b3:	83 c4 08             	add    $0x8,%esp
+  8036b6:	ff 73 10             	push   0x10(%ebx)
+  8036b9:	68 9c 59 80 00       	push   $0x80599c
+  8036be:	e8 5a d0 ff ff       	call   80071d <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  8036c3:	83 c4 08             	add    $0x8,%esp
+  8036c6:	ff 35 08 b0 80 00    	push   0x80b008
+  8036cc:	68 d8 59 80 00       	push   $0x8059d8
+  8036d1:	e8 47 d0 ff ff       	call   80071d <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  8036d6:	83 c4 08             	add    $0x8,%esp
+  8036d9:	ff 35 04 b0 80 00    	push   0x80b004
+  8036df:	68 0c 5a 80 00       	push   $0x805a0c
+  8036e4:	e8 34 d0 ff ff       	call   80071d <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  8036e9:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8036ee:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  8036f1:	8b 50 68             	mov    0x68(%eax),%edx
+  8036f4:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  8036f7:	51                   	push   %ecx
+  8036f8:	52                   	push   %edx
+  8036f9:	50                   	push   %eax
+  8036fa:	68 4c 5a 80 00       	push   $0x805a4c
+  8036ff:	e8 19 d0 ff ff       	call   80071d <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  803704:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803709:	8b 40 70             	mov    0x70(%eax),%eax
+  80370c:	83 c4 18             	add    $0x18,%esp
+  80370f:	50                   	push   %eax
+  803710:	68 80 5a 80 00       	push   $0x805a80
+  803715:	e8 03 d0 ff ff       	call   80071d <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  80371a:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  803720:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803726:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  80372b:	51                   	push   %ecx
+  80372c:	52                   	push   %edx
+  80372d:	50                   	push   %eax
+  80372e:	68 b0 5a 80 00       	push   $0x805ab0
+  803733:	e8 e5 cf ff ff       	call   80071d <cprintf>
+	cprintf("\n");
+  803738:	83 c4 14             	add    $0x14,%esp
+  80373b:	68 30 52 80 00       	push   $0x805230
+  803740:	e8 d8 cf ff ff       	call   80071d <cprintf>
+}
+  803745:	83 c4 10             	add    $0x10,%esp
+  803748:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80374b:	c9                   	leave
+  80374c:	c3                   	ret
+
+0080374d <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  80374d:	55                   	push   %ebp
+  80374e:	89 e5                	mov    %esp,%ebp
+  803750:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  803753:	e8 5e fe ff ff       	call   8035b6 <get_paging_stats>
+  803758:	83 ec 0c             	sub    $0xc,%esp
+  80375b:	50                   	push   %eax
+  80375c:	e8 ff fe ff ff       	call   803660 <print_paging_stats>
+}
+  803761:	83 c4 10             	add    $0x10,%esp
+  803764:	c9                   	leave
+  803765:	c3                   	ret
+
+00803766 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803766:	55                   	push   %ebp
+  803767:	89 e5                	mov    %esp,%ebp
+  803769:	53                   	push   %ebx
+  80376a:	83 ec 04             	sub    $0x4,%esp
+  80376d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803770:	eb 13                	jmp    803785 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803772:	83 ec 04             	sub    $0x4,%esp
+  803775:	6a ff                	push   $0xffffffff
+  803777:	53                   	push   %ebx
+  803778:	68 00 f0 ff ee       	push   $0xeefff000
+  80377d:	e8 4e df ff ff       	call   8016d0 <sys_futex_wait>
+  803782:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803785:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  80378a:	39 d8                	cmp    %ebx,%eax
+  80378c:	74 e4                	je     803772 <mem_pressure_wait+0xc>
+	return now;
+}
+  80378e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803791:	c9                   	leave
+  803792:	c3                   	ret
+
+00803793 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803793:	55                   	push   %ebp
+  803794:	89 e5                	mov    %esp,%ebp
+  803796:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  803799:	68 05 44 80 00       	push   $0x804405
+  80379e:	e8 81 e0 ff ff       	call   801824 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  8037a3:	c7 05 10 e9 80 00 00 	movl   $0xdeadb000,0x80e910
+  8037aa:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  8037ad:	83 c4 0c             	add    $0xc,%esp
+  8037b0:	68 07 02 00 00       	push   $0x207
+  8037b5:	68 00 b0 ad de       	push   $0xdeadb000
+  8037ba:	6a 00                	push   $0x0
+  8037bc:	e8 36 da ff ff       	call   8011f7 <sys_page_alloc>
+  8037c1:	83 c4 10             	add    $0x10,%esp
+  8037c4:	85 c0                	test   %eax,%eax
+  8037c6:	78 0c                	js     8037d4 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  8037c8:	e8 b4 f3 ff ff       	call   802b81 <find_paging_env>
+	page_ring_ready();
+  8037cd:	e8 7f f2 ff ff       	call   802a51 <page_ring_ready>
+}
+  8037d2:	c9                   	leave
+  8037d3:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  8037d4:	50                   	push   %eax
+  8037d5:	68 3d 58 80 00       	push   $0x80583d
+  8037da:	68 13 05 00 00       	push   $0x513
+  8037df:	68 f6 57 80 00       	push   $0x8057f6
+  8037e4:	e8 59 ce ff ff       	call   800642 <_panic>
+
+008037e9 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  8037e9:	55                   	push   %ebp
+  8037ea:	89 e5                	mov    %esp,%ebp
+  8037ec:	57                   	push   %edi
+  8037ed:	56                   	push   %esi
+  8037ee:	53                   	push   %ebx
+  8037ef:	83 ec 0c             	sub    $0xc,%esp
+  8037f2:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  8037f5:	89 fa                	mov    %edi,%edx
+  8037f7:	c1 ea 16             	shr    $0x16,%edx
+  8037fa:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  8037ff:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  803802:	f6 06 01             	testb  $0x1,(%esi)
+  803805:	75 3e                	jne    803845 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803807:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  80380c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803810:	74 47                	je     803859 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  803812:	83 ec 0c             	sub    $0xc,%esp
+  803815:	6a 01                	push   $0x1
+  803817:	e8 f2 11 00 00       	call   804a0e <va_alloc>
+  80381c:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  80381e:	83 c4 10             	add    $0x10,%esp
+  803821:	85 c0                	test   %eax,%eax
+  803823:	74 34                	je     803859 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803825:	6a 00                	push   $0x0
+  803827:	68 07 02 00 00       	push   $0x207
+  80382c:	50                   	push   %eax
+  80382d:	6a 00                	push   $0x0
+  80382f:	e8 df 02 00 00       	call   803b13 <page_alloc>
+  803834:	83 c4 10             	add    $0x10,%esp
+  803837:	85 c0                	test   %eax,%eax
+  803839:	78 28                	js     803863 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  80383b:	f6 06 01             	testb  $0x1,(%esi)
+  80383e:	75 38                	jne    803878 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803840:	83 cb 01             	or     $0x1,%ebx
+  803843:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803845:	89 f8                	mov    %edi,%eax
+  803847:	c1 e8 0a             	shr    $0xa,%eax
+  80384a:	25 fc 0f 00 00       	and    $0xffc,%eax
+  80384f:	8b 1e                	mov    (%esi),%ebx
+  803851:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803857:	01 c3                	add    %eax,%ebx
+}
+  803859:	89 d8                	mov    %ebx,%eax
+  80385b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80385e:	5b                   	pop    %ebx
+  80385f:	5e                   	pop    %esi
+  803860:	5f                   	pop    %edi
+  803861:	5d                   	pop    %ebp
+  803862:	c3                   	ret
+			va_free(page, 1);
+  803863:	83 ec 08             	sub    $0x8,%esp
+  803866:	6a 01                	push   $0x1
+  803868:	53                   	push   %ebx
+  803869:	e8 d8 12 00 00       	call   804b46 <va_free>
+			return NULL;
+  80386e:	83 c4 10             	add    $0x10,%esp
+  803871:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803876:	eb e1                	jmp    803859 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  803878:	83 ec 08             	sub    $0x8,%esp
+  80387b:	53                   	push   %ebx
+  80387c:	6a 00                	push   $0x0
+  80387e:	e8 f9 d9 ff ff       	call   80127c <sys_page_unmap>
+			va_free(page, 1);
+  803883:	83 c4 08             	add    $0x8,%esp
+  803886:	6a 01                	push   $0x1
+  803888:	53                   	push   %ebx
+  803889:	e8 b8 12 00 00       	call   804b46 <va_free>
+  80388e:	83 c4 10             	add    $0x10,%esp
+  803891:	eb b2                	jmp    803845 <umapdir_walk+0x5c>
+
+00803893 <page_out>:
+{
+  803893:	55                   	push   %ebp
+  803894:	89 e5                	mov    %esp,%ebp
+  803896:	57                   	push   %edi
+  803897:	56                   	push   %esi
+  803898:	53                   	push   %ebx
+  803899:	83 ec 5c             	sub    $0x5c,%esp
+  80389c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  80389f:	e8 dd f2 ff ff       	call   802b81 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  8038a4:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  8038a9:	85 c0                	test   %eax,%eax
+  8038ab:	74 1e                	je     8038cb <page_out+0x38>
+  8038ad:	83 ec 0c             	sub    $0xc,%esp
+  8038b0:	6a 00                	push   $0x0
+  8038b2:	6a 00                	push   $0x0
+  8038b4:	6a 00                	push   $0x0
+  8038b6:	6a 08                	push   $0x8
+  8038b8:	50                   	push   %eax
+  8038b9:	e8 f1 15 00 00       	call   804eaf <ipc_call>
+  8038be:	89 c3                	mov    %eax,%ebx
+  8038c0:	83 c4 20             	add    $0x20,%esp
+  8038c3:	85 c0                	test   %eax,%eax
+  8038c5:	0f 84 ac 00 00 00    	je     803977 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  8038cb:	83 ec 08             	sub    $0x8,%esp
+  8038ce:	ff 75 0c             	push   0xc(%ebp)
+  8038d1:	57                   	push   %edi
+  8038d2:	e8 e9 f9 ff ff       	call   8032c0 <get_page_choice>
+  8038d7:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  8038d9:	83 c4 10             	add    $0x10,%esp
+  8038dc:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8038e1:	0f 84 18 02 00 00    	je     803aff <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  8038e7:	e8 78 ee ff ff       	call   802764 <page_is_clean>
+  8038ec:	84 c0                	test   %al,%al
+  8038ee:	0f 85 8c 00 00 00    	jne    803980 <page_out+0xed>
+	if (pagingenv == 0)
+  8038f4:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8038fb:	0f 84 08 02 00 00    	je     803b09 <page_out+0x276>
+	if (page_ring_ready())
+  803901:	e8 4b f1 ff ff       	call   802a51 <page_ring_ready>
+  803906:	89 c3                	mov    %eax,%ebx
+  803908:	85 c0                	test   %eax,%eax
+  80390a:	0f 85 89 00 00 00    	jne    803999 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  803910:	83 ec 0c             	sub    $0xc,%esp
+  803913:	6a 05                	push   $0x5
+  803915:	6a 01                	push   $0x1
+  803917:	56                   	push   %esi
+  803918:	6a 01                	push   $0x1
+  80391a:	ff 35 40 b0 80 00    	push   0x80b040
+  803920:	e8 8a 15 00 00       	call   804eaf <ipc_call>
+  803925:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803927:	83 c4 20             	add    $0x20,%esp
+  80392a:	85 c0                	test   %eax,%eax
+  80392c:	0f 88 b8 01 00 00    	js     803aea <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803932:	89 f0                	mov    %esi,%eax
+  803934:	c1 e8 0c             	shr    $0xc,%eax
+  803937:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80393e:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803941:	83 ec 08             	sub    $0x8,%esp
+  803944:	56                   	push   %esi
+  803945:	6a 00                	push   $0x0
+  803947:	e8 30 d9 ff ff       	call   80127c <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  80394c:	83 c4 08             	add    $0x8,%esp
+  80394f:	6a 01                	push   $0x1
+  803951:	56                   	push   %esi
+  803952:	e8 92 fe ff ff       	call   8037e9 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803957:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  80395a:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803960:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803963:	09 fe                	or     %edi,%esi
+  803965:	83 ce 01             	or     $0x1,%esi
+  803968:	89 30                	mov    %esi,(%eax)
+	return 0;
+  80396a:	83 c4 10             	add    $0x10,%esp
+}
+  80396d:	89 d8                	mov    %ebx,%eax
+  80396f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803972:	5b                   	pop    %ebx
+  803973:	5e                   	pop    %esi
+  803974:	5f                   	pop    %edi
+  803975:	5d                   	pop    %ebp
+  803976:	c3                   	ret
+		num_page_reclaims++;
+  803977:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  80397e:	eb ed                	jmp    80396d <page_out+0xda>
+		num_page_drops++;
+  803980:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  803987:	83 ec 08             	sub    $0x8,%esp
+  80398a:	56                   	push   %esi
+  80398b:	6a 00                	push   $0x0
+  80398d:	e8 ea d8 ff ff       	call   80127c <sys_page_unmap>
+  803992:	89 c3                	mov    %eax,%ebx
+  803994:	83 c4 10             	add    $0x10,%esp
+  803997:	eb d4                	jmp    80396d <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803999:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  80399b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8039a0:	2d 00 10 00 00       	sub    $0x1000,%eax
+  8039a5:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  8039a8:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  8039aa:	83 c0 08             	add    $0x8,%eax
+  8039ad:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  8039b0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8039b5:	e8 e5 ef ff ff       	call   80299f <page_ring_reserve>
+	first = ring->sq_tail;
+  8039ba:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8039bf:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  8039c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  8039c7:	83 ec 04             	sub    $0x4,%esp
+  8039ca:	68 00 10 00 00       	push   $0x1000
+  8039cf:	56                   	push   %esi
+  8039d0:	89 d8                	mov    %ebx,%eax
+  8039d2:	c1 e0 0c             	shl    $0xc,%eax
+  8039d5:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  8039da:	50                   	push   %eax
+  8039db:	e8 0c d5 ff ff       	call   800eec <memcpy>
+		vas[n] = va;
+  8039e0:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  8039e4:	89 d9                	mov    %ebx,%ecx
+  8039e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039eb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8039f0:	e8 de ee ff ff       	call   8028d3 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  8039f5:	8d 43 01             	lea    0x1(%ebx),%eax
+  8039f8:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  8039fb:	83 c4 10             	add    $0x10,%esp
+  8039fe:	83 fb 06             	cmp    $0x6,%ebx
+  803a01:	74 62                	je     803a65 <page_out+0x1d2>
+  803a03:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803a06:	eb 15                	jmp    803a1d <page_out+0x18a>
+			num_page_drops++;
+  803a08:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  803a0f:	83 ec 08             	sub    $0x8,%esp
+  803a12:	56                   	push   %esi
+  803a13:	6a 00                	push   $0x0
+  803a15:	e8 62 d8 ff ff       	call   80127c <sys_page_unmap>
+  803a1a:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803a1d:	83 ec 08             	sub    $0x8,%esp
+  803a20:	53                   	push   %ebx
+  803a21:	57                   	push   %edi
+  803a22:	e8 99 f8 ff ff       	call   8032c0 <get_page_choice>
+  803a27:	89 c6                	mov    %eax,%esi
+  803a29:	83 c4 10             	add    $0x10,%esp
+  803a2c:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803a31:	74 32                	je     803a65 <page_out+0x1d2>
+  803a33:	e8 2c ed ff ff       	call   802764 <page_is_clean>
+  803a38:	84 c0                	test   %al,%al
+  803a3a:	75 cc                	jne    803a08 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803a3c:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803a3f:	39 c6                	cmp    %eax,%esi
+  803a41:	72 07                	jb     803a4a <page_out+0x1b7>
+  803a43:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803a46:	39 c6                	cmp    %eax,%esi
+  803a48:	72 1b                	jb     803a65 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803a4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a4f:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803a52:	eb 03                	jmp    803a57 <page_out+0x1c4>
+  803a54:	83 c3 01             	add    $0x1,%ebx
+  803a57:	39 da                	cmp    %ebx,%edx
+  803a59:	0f 84 68 ff ff ff    	je     8039c7 <page_out+0x134>
+  803a5f:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803a63:	75 ef                	jne    803a54 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803a65:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803a68:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803a6b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803a6e:	e8 a6 ee ff ff       	call   802919 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803a73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a78:	eb 42                	jmp    803abc <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803a7a:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803a7e:	89 f8                	mov    %edi,%eax
+  803a80:	c1 e8 0c             	shr    $0xc,%eax
+  803a83:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803a8a:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803a8d:	83 ec 08             	sub    $0x8,%esp
+  803a90:	57                   	push   %edi
+  803a91:	6a 00                	push   $0x0
+  803a93:	e8 e4 d7 ff ff       	call   80127c <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803a98:	83 c4 08             	add    $0x8,%esp
+  803a9b:	6a 01                	push   $0x1
+  803a9d:	57                   	push   %edi
+  803a9e:	e8 46 fd ff ff       	call   8037e9 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803aa3:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803aa6:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803aac:	c1 e6 0c             	shl    $0xc,%esi
+  803aaf:	09 d6                	or     %edx,%esi
+  803ab1:	83 ce 01             	or     $0x1,%esi
+  803ab4:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803ab6:	83 c3 01             	add    $0x1,%ebx
+  803ab9:	83 c4 10             	add    $0x10,%esp
+  803abc:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803abf:	39 c3                	cmp    %eax,%ebx
+  803ac1:	74 1d                	je     803ae0 <page_out+0x24d>
+		if (res[i] < 0)
+  803ac3:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803ac7:	85 f6                	test   %esi,%esi
+  803ac9:	79 af                	jns    803a7a <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803acb:	56                   	push   %esi
+  803acc:	68 e0 5a 80 00       	push   $0x805ae0
+  803ad1:	68 d1 02 00 00       	push   $0x2d1
+  803ad6:	68 f6 57 80 00       	push   $0x8057f6
+  803adb:	e8 62 cb ff ff       	call   800642 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803ae0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ae5:	e9 83 fe ff ff       	jmp    80396d <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803aea:	50                   	push   %eax
+  803aeb:	68 e0 5a 80 00       	push   $0x805ae0
+  803af0:	68 0a 03 00 00       	push   $0x30a
+  803af5:	68 f6 57 80 00       	push   $0x8057f6
+  803afa:	e8 43 cb ff ff       	call   800642 <_panic>
+		return -E_NO_MEM;
+  803aff:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803b04:	e9 64 fe ff ff       	jmp    80396d <page_out+0xda>
+		return -E_PAGING;
+  803b09:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803b0e:	e9 5a fe ff ff       	jmp    80396d <page_out+0xda>
+
+00803b13 <page_alloc>:
+{
+  803b13:	55                   	push   %ebp
+  803b14:	89 e5                	mov    %esp,%ebp
+  803b16:	57                   	push   %edi
+  803b17:	56                   	push   %esi
+  803b18:	53                   	push   %ebx
+  803b19:	83 ec 0c             	sub    $0xc,%esp
+  803b1c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803b1f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803b22:	83 3d 10 e9 80 00 00 	cmpl   $0x0,0x80e910
+  803b29:	74 34                	je     803b5f <page_alloc+0x4c>
+	if (check_mte)
+  803b2b:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803b2f:	75 35                	jne    803b66 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803b31:	83 ec 04             	sub    $0x4,%esp
+  803b34:	ff 75 10             	push   0x10(%ebp)
+  803b37:	56                   	push   %esi
+  803b38:	57                   	push   %edi
+  803b39:	e8 b9 d6 ff ff       	call   8011f7 <sys_page_alloc>
+  803b3e:	89 c3                	mov    %eax,%ebx
+  803b40:	83 c4 10             	add    $0x10,%esp
+  803b43:	85 c0                	test   %eax,%eax
+  803b45:	79 52                	jns    803b99 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803b47:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803b4a:	75 52                	jne    803b9e <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803b4c:	83 ec 08             	sub    $0x8,%esp
+  803b4f:	56                   	push   %esi
+  803b50:	57                   	push   %edi
+  803b51:	e8 3d fd ff ff       	call   803893 <page_out>
+  803b56:	83 c4 10             	add    $0x10,%esp
+  803b59:	85 c0                	test   %eax,%eax
+  803b5b:	79 d4                	jns    803b31 <page_alloc+0x1e>
+  803b5d:	eb 3f                	jmp    803b9e <page_alloc+0x8b>
+		init_map_dir();
+  803b5f:	e8 2f fc ff ff       	call   803793 <init_map_dir>
+  803b64:	eb c5                	jmp    803b2b <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803b66:	83 ec 08             	sub    $0x8,%esp
+  803b69:	6a 00                	push   $0x0
+  803b6b:	56                   	push   %esi
+  803b6c:	e8 78 fc ff ff       	call   8037e9 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803b71:	83 c4 10             	add    $0x10,%esp
+  803b74:	85 c0                	test   %eax,%eax
+  803b76:	74 b9                	je     803b31 <page_alloc+0x1e>
+  803b78:	8b 10                	mov    (%eax),%edx
+  803b7a:	f6 c2 01             	test   $0x1,%dl
+  803b7d:	74 b2                	je     803b31 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803b7f:	83 ec 08             	sub    $0x8,%esp
+  803b82:	56                   	push   %esi
+  803b83:	52                   	push   %edx
+  803b84:	50                   	push   %eax
+  803b85:	68 04 5b 80 00       	push   $0x805b04
+  803b8a:	68 34 03 00 00       	push   $0x334
+  803b8f:	68 f6 57 80 00       	push   $0x8057f6
+  803b94:	e8 a9 ca ff ff       	call   800642 <_panic>
+	return 0;
+  803b99:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803b9e:	89 d8                	mov    %ebx,%eax
+  803ba0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ba3:	5b                   	pop    %ebx
+  803ba4:	5e                   	pop    %esi
+  803ba5:	5f                   	pop    %edi
+  803ba6:	5d                   	pop    %ebp
+  803ba7:	c3                   	ret
+
+00803ba8 <page_adopt>:
+{
+  803ba8:	55                   	push   %ebp
+  803ba9:	89 e5                	mov    %esp,%ebp
+  803bab:	56                   	push   %esi
+  803bac:	53                   	push   %ebx
+  803bad:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803baf:	c1 e8 16             	shr    $0x16,%eax
+  803bb2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803bb9:	25 81 00 00 00       	and    $0x81,%eax
+  803bbe:	83 f8 01             	cmp    $0x1,%eax
+  803bc1:	75 53                	jne    803c16 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803bc3:	89 d8                	mov    %ebx,%eax
+  803bc5:	c1 e8 0c             	shr    $0xc,%eax
+  803bc8:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803bcf:	89 f2                	mov    %esi,%edx
+  803bd1:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803bd7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803bdc:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803be2:	75 37                	jne    803c1b <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803be4:	83 ec 08             	sub    $0x8,%esp
+  803be7:	6a 01                	push   $0x1
+  803be9:	53                   	push   %ebx
+  803bea:	e8 fa fb ff ff       	call   8037e9 <umapdir_walk>
+  803bef:	83 c4 10             	add    $0x10,%esp
+  803bf2:	85 c0                	test   %eax,%eax
+  803bf4:	74 2c                	je     803c22 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803bf6:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803bfc:	83 ce 01             	or     $0x1,%esi
+  803bff:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803c01:	83 ec 08             	sub    $0x8,%esp
+  803c04:	53                   	push   %ebx
+  803c05:	6a 00                	push   $0x0
+  803c07:	e8 70 d6 ff ff       	call   80127c <sys_page_unmap>
+	return 1;
+  803c0c:	83 c4 10             	add    $0x10,%esp
+  803c0f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803c14:	eb 05                	jmp    803c1b <page_adopt+0x73>
+		return 0;
+  803c16:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c1e:	5b                   	pop    %ebx
+  803c1f:	5e                   	pop    %esi
+  803c20:	5d                   	pop    %ebp
+  803c21:	c3                   	ret
+		return -E_NO_MEM;
+  803c22:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803c27:	eb f2                	jmp    803c1b <page_adopt+0x73>
+
+00803c29 <page_forget>:
+{
+  803c29:	55                   	push   %ebp
+  803c2a:	89 e5                	mov    %esp,%ebp
+  803c2c:	53                   	push   %ebx
+  803c2d:	83 ec 04             	sub    $0x4,%esp
+  803c30:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803c32:	e8 4a ef ff ff       	call   802b81 <find_paging_env>
+	if (pagingenv == 0)
+  803c37:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803c3e:	74 39                	je     803c79 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803c40:	89 d8                	mov    %ebx,%eax
+  803c42:	c1 e8 16             	shr    $0x16,%eax
+  803c45:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803c4c:	25 81 00 00 00       	and    $0x81,%eax
+  803c51:	83 f8 01             	cmp    $0x1,%eax
+  803c54:	74 28                	je     803c7e <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803c56:	83 3d 10 e9 80 00 00 	cmpl   $0x0,0x80e910
+  803c5d:	74 1a                	je     803c79 <page_forget+0x50>
+  803c5f:	83 ec 08             	sub    $0x8,%esp
+  803c62:	6a 00                	push   $0x0
+  803c64:	53                   	push   %ebx
+  803c65:	e8 7f fb ff ff       	call   8037e9 <umapdir_walk>
+  803c6a:	89 c3                	mov    %eax,%ebx
+  803c6c:	83 c4 10             	add    $0x10,%esp
+  803c6f:	85 c0                	test   %eax,%eax
+  803c71:	74 06                	je     803c79 <page_forget+0x50>
+  803c73:	8b 00                	mov    (%eax),%eax
+  803c75:	a8 01                	test   $0x1,%al
+  803c77:	75 2b                	jne    803ca4 <page_forget+0x7b>
+}
+  803c79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c7c:	c9                   	leave
+  803c7d:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803c7e:	89 d8                	mov    %ebx,%eax
+  803c80:	c1 e8 0c             	shr    $0xc,%eax
+  803c83:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803c8a:	89 c2                	mov    %eax,%edx
+  803c8c:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803c92:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803c98:	75 bc                	jne    803c56 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803c9a:	c1 e8 0c             	shr    $0xc,%eax
+  803c9d:	e8 5c ee ff ff       	call   802afe <page_remove_slot>
+		return;
+  803ca2:	eb d5                	jmp    803c79 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803ca4:	c1 e8 0c             	shr    $0xc,%eax
+  803ca7:	e8 52 ee ff ff       	call   802afe <page_remove_slot>
+	*mte = 0;
+  803cac:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803cb2:	eb c5                	jmp    803c79 <page_forget+0x50>
+
+00803cb4 <page_unmap>:
+{
+  803cb4:	55                   	push   %ebp
+  803cb5:	89 e5                	mov    %esp,%ebp
+  803cb7:	57                   	push   %edi
+  803cb8:	56                   	push   %esi
+  803cb9:	53                   	push   %ebx
+  803cba:	83 ec 0c             	sub    $0xc,%esp
+  803cbd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803cc0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803cc3:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803cc8:	8b 40 48             	mov    0x48(%eax),%eax
+  803ccb:	85 db                	test   %ebx,%ebx
+  803ccd:	0f 8e b4 00 00 00    	jle    803d87 <page_unmap+0xd3>
+  803cd3:	39 d8                	cmp    %ebx,%eax
+  803cd5:	0f 84 ac 00 00 00    	je     803d87 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803cdb:	83 ec 08             	sub    $0x8,%esp
+  803cde:	57                   	push   %edi
+  803cdf:	53                   	push   %ebx
+  803ce0:	e8 97 d5 ff ff       	call   80127c <sys_page_unmap>
+  803ce5:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803ce7:	e8 95 ee ff ff       	call   802b81 <find_paging_env>
+	if (pagingenv == 0)
+  803cec:	83 c4 10             	add    $0x10,%esp
+  803cef:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803cf6:	0f 84 a1 00 00 00    	je     803d9d <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803cfc:	83 ec 0c             	sub    $0xc,%esp
+  803cff:	6a 05                	push   $0x5
+  803d01:	68 00 00 40 00       	push   $0x400000
+  803d06:	6a 00                	push   $0x0
+  803d08:	68 00 b0 ad de       	push   $0xdeadb000
+  803d0d:	53                   	push   %ebx
+  803d0e:	e8 27 d5 ff ff       	call   80123a <sys_page_map>
+  803d13:	83 c4 20             	add    $0x20,%esp
+  803d16:	85 c0                	test   %eax,%eax
+  803d18:	0f 88 89 00 00 00    	js     803da7 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803d1e:	89 f8                	mov    %edi,%eax
+  803d20:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803d23:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803d2a:	a8 01                	test   $0x1,%al
+  803d2c:	74 6f                	je     803d9d <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803d2e:	83 ec 0c             	sub    $0xc,%esp
+  803d31:	6a 05                	push   $0x5
+  803d33:	68 00 00 40 00       	push   $0x400000
+  803d38:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803d3a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803d3f:	50                   	push   %eax
+  803d40:	53                   	push   %ebx
+  803d41:	e8 f4 d4 ff ff       	call   80123a <sys_page_map>
+  803d46:	83 c4 20             	add    $0x20,%esp
+  803d49:	85 c0                	test   %eax,%eax
+  803d4b:	78 6f                	js     803dbc <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803d4d:	c1 ef 0c             	shr    $0xc,%edi
+  803d50:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803d56:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803d5d:	01 
+  803d5e:	74 3d                	je     803d9d <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803d60:	83 ec 08             	sub    $0x8,%esp
+  803d63:	68 00 00 40 00       	push   $0x400000
+  803d68:	6a 00                	push   $0x0
+  803d6a:	e8 0d d5 ff ff       	call   80127c <sys_page_unmap>
+  803d6f:	83 c4 10             	add    $0x10,%esp
+  803d72:	85 c0                	test   %eax,%eax
+  803d74:	78 5b                	js     803dd1 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803d76:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803d7d:	c1 e8 0c             	shr    $0xc,%eax
+  803d80:	e8 79 ed ff ff       	call   802afe <page_remove_slot>
+	return r;
+  803d85:	eb 16                	jmp    803d9d <page_unmap+0xe9>
+		page_forget(va);
+  803d87:	89 f8                	mov    %edi,%eax
+  803d89:	e8 9b fe ff ff       	call   803c29 <page_forget>
+		return sys_page_unmap(envid, va);
+  803d8e:	83 ec 08             	sub    $0x8,%esp
+  803d91:	57                   	push   %edi
+  803d92:	53                   	push   %ebx
+  803d93:	e8 e4 d4 ff ff       	call   80127c <sys_page_unmap>
+  803d98:	89 c6                	mov    %eax,%esi
+  803d9a:	83 c4 10             	add    $0x10,%esp
+}
+  803d9d:	89 f0                	mov    %esi,%eax
+  803d9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803da2:	5b                   	pop    %ebx
+  803da3:	5e                   	pop    %esi
+  803da4:	5f                   	pop    %edi
+  803da5:	5d                   	pop    %ebp
+  803da6:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803da7:	50                   	push   %eax
+  803da8:	68 40 5b 80 00       	push   $0x805b40
+  803dad:	68 e4 03 00 00       	push   $0x3e4
+  803db2:	68 f6 57 80 00       	push   $0x8057f6
+  803db7:	e8 86 c8 ff ff       	call   800642 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803dbc:	50                   	push   %eax
+  803dbd:	68 6c 5b 80 00       	push   $0x805b6c
+  803dc2:	68 ea 03 00 00       	push   $0x3ea
+  803dc7:	68 f6 57 80 00       	push   $0x8057f6
+  803dcc:	e8 71 c8 ff ff       	call   800642 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803dd1:	50                   	push   %eax
+  803dd2:	68 98 5b 80 00       	push   $0x805b98
+  803dd7:	68 ef 03 00 00       	push   $0x3ef
+  803ddc:	68 f6 57 80 00       	push   $0x8057f6
+  803de1:	e8 5c c8 ff ff       	call   800642 <_panic>
+
+00803de6 <page_unmap_range>:
+{
+  803de6:	55                   	push   %ebp
+  803de7:	89 e5                	mov    %esp,%ebp
+  803de9:	57                   	push   %edi
+  803dea:	56                   	push   %esi
+  803deb:	53                   	push   %ebx
+  803dec:	83 ec 0c             	sub    $0xc,%esp
+  803def:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803df2:	e8 8a ed ff ff       	call   802b81 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803df7:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803dfc:	8b 40 48             	mov    0x48(%eax),%eax
+  803dff:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803e03:	7e 38                	jle    803e3d <page_unmap_range+0x57>
+  803e05:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803e08:	74 33                	je     803e3d <page_unmap_range+0x57>
+  803e0a:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803e11:	74 2a                	je     803e3d <page_unmap_range+0x57>
+  803e13:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  803e16:	be 00 00 00 00       	mov    $0x0,%esi
+  803e1b:	39 fe                	cmp    %edi,%esi
+  803e1d:	74 56                	je     803e75 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  803e1f:	83 ec 08             	sub    $0x8,%esp
+  803e22:	53                   	push   %ebx
+  803e23:	ff 75 08             	push   0x8(%ebp)
+  803e26:	e8 89 fe ff ff       	call   803cb4 <page_unmap>
+  803e2b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803e31:	83 c4 10             	add    $0x10,%esp
+  803e34:	85 c0                	test   %eax,%eax
+  803e36:	78 35                	js     803e6d <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  803e38:	83 c6 01             	add    $0x1,%esi
+  803e3b:	eb de                	jmp    803e1b <page_unmap_range+0x35>
+  803e3d:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803e40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e45:	eb 10                	jmp    803e57 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803e47:	89 f0                	mov    %esi,%eax
+  803e49:	e8 db fd ff ff       	call   803c29 <page_forget>
+		for (i = 0; i < npages; i++)
+  803e4e:	83 c3 01             	add    $0x1,%ebx
+  803e51:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803e57:	39 fb                	cmp    %edi,%ebx
+  803e59:	75 ec                	jne    803e47 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  803e5b:	83 ec 04             	sub    $0x4,%esp
+  803e5e:	57                   	push   %edi
+  803e5f:	ff 75 0c             	push   0xc(%ebp)
+  803e62:	ff 75 08             	push   0x8(%ebp)
+  803e65:	e8 26 d5 ff ff       	call   801390 <sys_page_unmap_range>
+  803e6a:	83 c4 10             	add    $0x10,%esp
+}
+  803e6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e70:	5b                   	pop    %ebx
+  803e71:	5e                   	pop    %esi
+  803e72:	5f                   	pop    %edi
+  803e73:	5d                   	pop    %ebp
+  803e74:	c3                   	ret
+	return 0;
+  803e75:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e7a:	eb f1                	jmp    803e6d <page_unmap_range+0x87>
+
+00803e7c <page_alloc_range>:
+{
+  803e7c:	55                   	push   %ebp
+  803e7d:	89 e5                	mov    %esp,%ebp
+  803e7f:	57                   	push   %edi
+  803e80:	56                   	push   %esi
+  803e81:	53                   	push   %ebx
+  803e82:	83 ec 1c             	sub    $0x1c,%esp
+  803e85:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803e88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  803e8b:	83 3d 10 e9 80 00 00 	cmpl   $0x0,0x80e910
+  803e92:	74 14                	je     803ea8 <page_alloc_range+0x2c>
+	if (check_mte)
+  803e94:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803e98:	74 66                	je     803f00 <page_alloc_range+0x84>
+  803e9a:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  803e9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ea1:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803ea4:	89 c7                	mov    %eax,%edi
+  803ea6:	eb 10                	jmp    803eb8 <page_alloc_range+0x3c>
+		init_map_dir();
+  803ea8:	e8 e6 f8 ff ff       	call   803793 <init_map_dir>
+  803ead:	eb e5                	jmp    803e94 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803eaf:	83 c7 01             	add    $0x1,%edi
+  803eb2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803eb8:	39 df                	cmp    %ebx,%edi
+  803eba:	74 38                	je     803ef4 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  803ebc:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803ebf:	83 ec 08             	sub    $0x8,%esp
+  803ec2:	6a 00                	push   $0x0
+  803ec4:	56                   	push   %esi
+  803ec5:	e8 1f f9 ff ff       	call   8037e9 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  803eca:	83 c4 10             	add    $0x10,%esp
+  803ecd:	85 c0                	test   %eax,%eax
+  803ecf:	74 de                	je     803eaf <page_alloc_range+0x33>
+  803ed1:	8b 10                	mov    (%eax),%edx
+  803ed3:	f6 c2 01             	test   $0x1,%dl
+  803ed6:	74 d7                	je     803eaf <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  803ed8:	83 ec 08             	sub    $0x8,%esp
+  803edb:	ff 75 e4             	push   -0x1c(%ebp)
+  803ede:	52                   	push   %edx
+  803edf:	50                   	push   %eax
+  803ee0:	68 04 5b 80 00       	push   $0x805b04
+  803ee5:	68 0b 04 00 00       	push   $0x40b
+  803eea:	68 f6 57 80 00       	push   $0x8057f6
+  803eef:	e8 4e c7 ff ff       	call   800642 <_panic>
+  803ef4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803ef7:	eb 07                	jmp    803f00 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  803ef9:	c1 e0 0c             	shl    $0xc,%eax
+  803efc:	01 c7                	add    %eax,%edi
+			npages -= r;
+  803efe:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  803f00:	85 db                	test   %ebx,%ebx
+  803f02:	74 30                	je     803f34 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  803f04:	ff 75 14             	push   0x14(%ebp)
+  803f07:	53                   	push   %ebx
+  803f08:	57                   	push   %edi
+  803f09:	ff 75 08             	push   0x8(%ebp)
+  803f0c:	e8 11 d4 ff ff       	call   801322 <sys_page_alloc_range>
+  803f11:	89 c6                	mov    %eax,%esi
+  803f13:	83 c4 10             	add    $0x10,%esp
+  803f16:	85 c0                	test   %eax,%eax
+  803f18:	7f df                	jg     803ef9 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  803f1a:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  803f1d:	75 1a                	jne    803f39 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  803f1f:	83 ec 08             	sub    $0x8,%esp
+  803f22:	57                   	push   %edi
+  803f23:	ff 75 08             	push   0x8(%ebp)
+  803f26:	e8 68 f9 ff ff       	call   803893 <page_out>
+  803f2b:	83 c4 10             	add    $0x10,%esp
+  803f2e:	85 c0                	test   %eax,%eax
+  803f30:	79 ce                	jns    803f00 <page_alloc_range+0x84>
+  803f32:	eb 05                	jmp    803f39 <page_alloc_range+0xbd>
+	return 0;
+  803f34:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803f39:	89 f0                	mov    %esi,%eax
+  803f3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f3e:	5b                   	pop    %ebx
+  803f3f:	5e                   	pop    %esi
+  803f40:	5f                   	pop    %edi
+  803f41:	5d                   	pop    %ebp
+  803f42:	c3                   	ret
+
+00803f43 <page_in>:
+{
+  803f43:	55                   	push   %ebp
+  803f44:	89 e5                	mov    %esp,%ebp
+  803f46:	57                   	push   %edi
+  803f47:	56                   	push   %esi
+  803f48:	53                   	push   %ebx
+  803f49:	83 ec 3c             	sub    $0x3c,%esp
+  803f4c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  803f4f:	e8 2d ec ff ff       	call   802b81 <find_paging_env>
+	if (pagingenv == 0)
+  803f54:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803f5b:	0f 84 09 02 00 00    	je     80416a <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  803f61:	83 ec 08             	sub    $0x8,%esp
+  803f64:	6a 00                	push   $0x0
+  803f66:	56                   	push   %esi
+  803f67:	e8 7d f8 ff ff       	call   8037e9 <umapdir_walk>
+  803f6c:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803f6e:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803f74:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  803f77:	83 c4 10             	add    $0x10,%esp
+  803f7a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803f7e:	74 0d                	je     803f8d <page_in+0x4a>
+  803f80:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803f85:	8b 40 48             	mov    0x48(%eax),%eax
+  803f88:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803f8b:	75 06                	jne    803f93 <page_in+0x50>
+  803f8d:	8b 03                	mov    (%ebx),%eax
+  803f8f:	a8 02                	test   $0x2,%al
+  803f91:	75 63                	jne    803ff6 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  803f93:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803f95:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803f97:	89 f0                	mov    %esi,%eax
+  803f99:	25 06 0e 00 00       	and    $0xe06,%eax
+  803f9e:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803fa1:	50                   	push   %eax
+  803fa2:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803fa5:	57                   	push   %edi
+  803fa6:	ff 75 08             	push   0x8(%ebp)
+  803fa9:	e8 65 fb ff ff       	call   803b13 <page_alloc>
+  803fae:	83 c4 10             	add    $0x10,%esp
+  803fb1:	85 c0                	test   %eax,%eax
+  803fb3:	78 39                	js     803fee <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  803fb5:	89 f0                	mov    %esi,%eax
+  803fb7:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803fba:	83 ec 0c             	sub    $0xc,%esp
+  803fbd:	6a 07                	push   $0x7
+  803fbf:	6a 01                	push   $0x1
+  803fc1:	57                   	push   %edi
+  803fc2:	c1 e0 04             	shl    $0x4,%eax
+  803fc5:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803fc6:	c1 ee 1c             	shr    $0x1c,%esi
+  803fc9:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803fcc:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803fd3:	e8 d7 0e 00 00       	call   804eaf <ipc_call>
+  803fd8:	83 c4 20             	add    $0x20,%esp
+  803fdb:	85 c0                	test   %eax,%eax
+  803fdd:	0f 88 72 01 00 00    	js     804155 <page_in+0x212>
+	*mte = 0;
+  803fe3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  803fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ff1:	5b                   	pop    %ebx
+  803ff2:	5e                   	pop    %esi
+  803ff3:	5f                   	pop    %edi
+  803ff4:	5d                   	pop    %ebp
+  803ff5:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803ff6:	25 06 0e 00 00       	and    $0xe06,%eax
+  803ffb:	83 c8 01             	or     $0x1,%eax
+  803ffe:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  804001:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804004:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  804007:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  80400d:	be 01 00 00 00       	mov    $0x1,%esi
+  804012:	eb 46                	jmp    80405a <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  804014:	83 ec 08             	sub    $0x8,%esp
+  804017:	6a 00                	push   $0x0
+  804019:	51                   	push   %ecx
+  80401a:	e8 ca f7 ff ff       	call   8037e9 <umapdir_walk>
+  80401f:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  804023:	83 c4 10             	add    $0x10,%esp
+  804026:	85 c0                	test   %eax,%eax
+  804028:	74 66                	je     804090 <page_in+0x14d>
+  80402a:	8b 00                	mov    (%eax),%eax
+  80402c:	a8 01                	test   $0x1,%al
+  80402e:	74 60                	je     804090 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  804030:	89 c2                	mov    %eax,%edx
+  804032:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  804038:	83 ca 01             	or     $0x1,%edx
+  80403b:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  80403e:	75 50                	jne    804090 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  804040:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804046:	c1 e8 1c             	shr    $0x1c,%eax
+  804049:	8b 13                	mov    (%ebx),%edx
+  80404b:	c1 ea 1c             	shr    $0x1c,%edx
+  80404e:	39 d0                	cmp    %edx,%eax
+  804050:	75 3e                	jne    804090 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804052:	83 c6 01             	add    $0x1,%esi
+  804055:	83 fe 08             	cmp    $0x8,%esi
+  804058:	74 3f                	je     804099 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  80405a:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  80405c:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  804062:	77 2c                	ja     804090 <page_in+0x14d>
+  804064:	89 f8                	mov    %edi,%eax
+  804066:	c1 e8 16             	shr    $0x16,%eax
+  804069:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  804070:	f6 c2 01             	test   $0x1,%dl
+  804073:	74 9f                	je     804014 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804075:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  80407c:	a8 80                	test   $0x80,%al
+  80407e:	75 10                	jne    804090 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804080:	89 f8                	mov    %edi,%eax
+  804082:	c1 e8 0c             	shr    $0xc,%eax
+  804085:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80408c:	a8 01                	test   $0x1,%al
+  80408e:	74 84                	je     804014 <page_in+0xd1>
+	if (n == 1)
+  804090:	83 fe 01             	cmp    $0x1,%esi
+  804093:	0f 84 fa fe ff ff    	je     803f93 <page_in+0x50>
+	req.nslots = n;
+  804099:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  80409f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040a4:	eb 13                	jmp    8040b9 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  8040a6:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  8040aa:	8b 12                	mov    (%edx),%edx
+  8040ac:	c1 ea 0c             	shr    $0xc,%edx
+  8040af:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  8040b6:	83 c0 01             	add    $0x1,%eax
+  8040b9:	39 c6                	cmp    %eax,%esi
+  8040bb:	75 e9                	jne    8040a6 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  8040bd:	83 ec 0c             	sub    $0xc,%esp
+  8040c0:	6a 00                	push   $0x0
+  8040c2:	ff 75 c0             	push   -0x40(%ebp)
+  8040c5:	56                   	push   %esi
+  8040c6:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  8040c9:	57                   	push   %edi
+  8040ca:	6a 00                	push   $0x0
+  8040cc:	e8 ab fd ff ff       	call   803e7c <page_alloc_range>
+  8040d1:	83 c4 20             	add    $0x20,%esp
+  8040d4:	85 c0                	test   %eax,%eax
+  8040d6:	78 6e                	js     804146 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  8040d8:	83 ec 04             	sub    $0x4,%esp
+  8040db:	6a 24                	push   $0x24
+  8040dd:	68 00 80 80 00       	push   $0x808000
+  8040e2:	57                   	push   %edi
+  8040e3:	e8 a2 cd ff ff       	call   800e8a <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  8040e8:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8040ef:	56                   	push   %esi
+  8040f0:	57                   	push   %edi
+  8040f1:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8040f3:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  8040fa:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  8040fd:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  804104:	e8 a6 0d 00 00       	call   804eaf <ipc_call>
+  804109:	83 c4 20             	add    $0x20,%esp
+  80410c:	85 c0                	test   %eax,%eax
+  80410e:	78 08                	js     804118 <page_in+0x1d5>
+  804110:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  804113:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  804116:	eb 20                	jmp    804138 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  804118:	50                   	push   %eax
+  804119:	68 c4 5b 80 00       	push   $0x805bc4
+  80411e:	68 59 02 00 00       	push   $0x259
+  804123:	68 f6 57 80 00       	push   $0x8057f6
+  804128:	e8 15 c5 ff ff       	call   800642 <_panic>
+		*mtes[i] = 0;
+  80412d:	8b 10                	mov    (%eax),%edx
+  80412f:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  804135:	83 c0 04             	add    $0x4,%eax
+  804138:	39 c8                	cmp    %ecx,%eax
+  80413a:	75 f1                	jne    80412d <page_in+0x1ea>
+	return n;
+  80413c:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  80413e:	85 f6                	test   %esi,%esi
+  804140:	0f 84 4d fe ff ff    	je     803f93 <page_in+0x50>
+		return r < 0 ? r : 0;
+  804146:	85 c0                	test   %eax,%eax
+  804148:	ba 00 00 00 00       	mov    $0x0,%edx
+  80414d:	0f 4f c2             	cmovg  %edx,%eax
+  804150:	e9 99 fe ff ff       	jmp    803fee <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  804155:	50                   	push   %eax
+  804156:	68 fc 5b 80 00       	push   $0x805bfc
+  80415b:	68 9a 02 00 00       	push   $0x29a
+  804160:	68 f6 57 80 00       	push   $0x8057f6
+  804165:	e8 d8 c4 ff ff       	call   800642 <_panic>
+		return -E_PAGING;
+  80416a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80416f:	e9 7a fe ff ff       	jmp    803fee <page_in+0xab>
+
+00804174 <page_map>:
+{
+  804174:	55                   	push   %ebp
+  804175:	89 e5                	mov    %esp,%ebp
+  804177:	57                   	push   %edi
+  804178:	56                   	push   %esi
+  804179:	53                   	push   %ebx
+  80417a:	83 ec 1c             	sub    $0x1c,%esp
+  80417d:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  804180:	83 ec 0c             	sub    $0xc,%esp
+  804183:	ff 75 18             	push   0x18(%ebp)
+  804186:	ff 75 14             	push   0x14(%ebp)
+  804189:	ff 75 10             	push   0x10(%ebp)
+  80418c:	ff 75 0c             	push   0xc(%ebp)
+  80418f:	56                   	push   %esi
+  804190:	e8 a5 d0 ff ff       	call   80123a <sys_page_map>
+  804195:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804198:	83 c4 20             	add    $0x20,%esp
+  80419b:	85 c0                	test   %eax,%eax
+  80419d:	0f 89 a9 01 00 00    	jns    80434c <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  8041a3:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  8041a7:	74 5f                	je     804208 <page_map+0x94>
+		if (r != -E_INVAL)
+  8041a9:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  8041ad:	0f 85 a0 01 00 00    	jne    804353 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8041b3:	85 f6                	test   %esi,%esi
+  8041b5:	74 70                	je     804227 <page_map+0xb3>
+  8041b7:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8041bc:	8b 40 48             	mov    0x48(%eax),%eax
+  8041bf:	39 f0                	cmp    %esi,%eax
+  8041c1:	74 64                	je     804227 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8041c3:	83 ec 0c             	sub    $0xc,%esp
+  8041c6:	6a 05                	push   $0x5
+  8041c8:	68 00 00 40 00       	push   $0x400000
+  8041cd:	6a 00                	push   $0x0
+  8041cf:	68 00 b0 ad de       	push   $0xdeadb000
+  8041d4:	56                   	push   %esi
+  8041d5:	e8 60 d0 ff ff       	call   80123a <sys_page_map>
+  8041da:	89 c3                	mov    %eax,%ebx
+  8041dc:	83 c4 20             	add    $0x20,%esp
+  8041df:	85 c0                	test   %eax,%eax
+  8041e1:	79 6a                	jns    80424d <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  8041e3:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8041e6:	75 50                	jne    804238 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  8041e8:	83 ec 08             	sub    $0x8,%esp
+  8041eb:	68 00 00 40 00       	push   $0x400000
+  8041f0:	6a fc                	push   $0xfffffffc
+  8041f2:	e8 9c f6 ff ff       	call   803893 <page_out>
+  8041f7:	83 c4 10             	add    $0x10,%esp
+  8041fa:	85 c0                	test   %eax,%eax
+  8041fc:	79 c5                	jns    8041c3 <page_map+0x4f>
+}
+  8041fe:	89 d8                	mov    %ebx,%eax
+  804200:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804203:	5b                   	pop    %ebx
+  804204:	5e                   	pop    %esi
+  804205:	5f                   	pop    %edi
+  804206:	5d                   	pop    %ebp
+  804207:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  804208:	83 ec 08             	sub    $0x8,%esp
+  80420b:	68 00 00 40 00       	push   $0x400000
+  804210:	6a 00                	push   $0x0
+  804212:	e8 7c f6 ff ff       	call   803893 <page_out>
+  804217:	83 c4 10             	add    $0x10,%esp
+  80421a:	85 c0                	test   %eax,%eax
+  80421c:	0f 89 5e ff ff ff    	jns    804180 <page_map+0xc>
+				return r;
+  804222:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804225:	eb d7                	jmp    8041fe <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804227:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80422a:	e8 79 f9 ff ff       	call   803ba8 <page_adopt>
+  80422f:	85 c0                	test   %eax,%eax
+  804231:	79 90                	jns    8041c3 <page_map+0x4f>
+			return r;
+  804233:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804236:	eb c6                	jmp    8041fe <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  804238:	53                   	push   %ebx
+  804239:	68 30 5c 80 00       	push   $0x805c30
+  80423e:	68 77 03 00 00       	push   $0x377
+  804243:	68 f6 57 80 00       	push   $0x8057f6
+  804248:	e8 f5 c3 ff ff       	call   800642 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  80424d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804250:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  804253:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  80425a:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  804260:	0f 84 f5 00 00 00    	je     80435b <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  804266:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80426c:	83 ec 0c             	sub    $0xc,%esp
+  80426f:	6a 05                	push   $0x5
+  804271:	68 00 00 40 00       	push   $0x400000
+  804276:	6a 00                	push   $0x0
+  804278:	57                   	push   %edi
+  804279:	56                   	push   %esi
+  80427a:	e8 bb cf ff ff       	call   80123a <sys_page_map>
+  80427f:	89 c3                	mov    %eax,%ebx
+  804281:	83 c4 20             	add    $0x20,%esp
+  804284:	85 c0                	test   %eax,%eax
+  804286:	79 35                	jns    8042bd <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  804288:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80428b:	75 1b                	jne    8042a8 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  80428d:	83 ec 08             	sub    $0x8,%esp
+  804290:	68 00 00 40 00       	push   $0x400000
+  804295:	6a 00                	push   $0x0
+  804297:	e8 f7 f5 ff ff       	call   803893 <page_out>
+  80429c:	83 c4 10             	add    $0x10,%esp
+  80429f:	85 c0                	test   %eax,%eax
+  8042a1:	79 c9                	jns    80426c <page_map+0xf8>
+  8042a3:	e9 56 ff ff ff       	jmp    8041fe <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  8042a8:	53                   	push   %ebx
+  8042a9:	68 58 5c 80 00       	push   $0x805c58
+  8042ae:	68 83 03 00 00       	push   $0x383
+  8042b3:	68 f6 57 80 00       	push   $0x8057f6
+  8042b8:	e8 85 c3 ff ff       	call   800642 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  8042bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8042c0:	c1 e8 0c             	shr    $0xc,%eax
+  8042c3:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8042c8:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  8042cf:	01 
+  8042d0:	0f 84 8d 00 00 00    	je     804363 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  8042d6:	83 ec 08             	sub    $0x8,%esp
+  8042d9:	68 00 00 40 00       	push   $0x400000
+  8042de:	6a 00                	push   $0x0
+  8042e0:	e8 97 cf ff ff       	call   80127c <sys_page_unmap>
+  8042e5:	83 c4 10             	add    $0x10,%esp
+  8042e8:	85 c0                	test   %eax,%eax
+  8042ea:	78 36                	js     804322 <page_map+0x1ae>
+  8042ec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  8042ef:	83 ec 08             	sub    $0x8,%esp
+  8042f2:	57                   	push   %edi
+  8042f3:	56                   	push   %esi
+  8042f4:	e8 4a fc ff ff       	call   803f43 <page_in>
+  8042f9:	89 c3                	mov    %eax,%ebx
+  8042fb:	83 c4 10             	add    $0x10,%esp
+  8042fe:	85 c0                	test   %eax,%eax
+  804300:	0f 89 7a fe ff ff    	jns    804180 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  804306:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804309:	75 2c                	jne    804337 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  80430b:	83 ec 08             	sub    $0x8,%esp
+  80430e:	57                   	push   %edi
+  80430f:	6a 00                	push   $0x0
+  804311:	e8 7d f5 ff ff       	call   803893 <page_out>
+  804316:	83 c4 10             	add    $0x10,%esp
+  804319:	85 c0                	test   %eax,%eax
+  80431b:	79 d2                	jns    8042ef <page_map+0x17b>
+  80431d:	e9 dc fe ff ff       	jmp    8041fe <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  804322:	50                   	push   %eax
+  804323:	68 84 5c 80 00       	push   $0x805c84
+  804328:	68 8b 03 00 00       	push   $0x38b
+  80432d:	68 f6 57 80 00       	push   $0x8057f6
+  804332:	e8 0b c3 ff ff       	call   800642 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  804337:	53                   	push   %ebx
+  804338:	68 ac 5c 80 00       	push   $0x805cac
+  80433d:	68 91 03 00 00       	push   $0x391
+  804342:	68 f6 57 80 00       	push   $0x8057f6
+  804347:	e8 f6 c2 ff ff       	call   800642 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  80434c:	89 c3                	mov    %eax,%ebx
+  80434e:	e9 ab fe ff ff       	jmp    8041fe <page_map+0x8a>
+  804353:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804356:	e9 a3 fe ff ff       	jmp    8041fe <page_map+0x8a>
+			return r; // Pass through the error
+  80435b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80435e:	e9 9b fe ff ff       	jmp    8041fe <page_map+0x8a>
+			return r; // Pass through the error
+  804363:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804366:	e9 93 fe ff ff       	jmp    8041fe <page_map+0x8a>
+
+0080436b <page_map_range>:
+{
+  80436b:	55                   	push   %ebp
+  80436c:	89 e5                	mov    %esp,%ebp
+  80436e:	57                   	push   %edi
+  80436f:	56                   	push   %esi
+  804370:	53                   	push   %ebx
+  804371:	83 ec 0c             	sub    $0xc,%esp
+  804374:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804377:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  80437a:	83 ec 08             	sub    $0x8,%esp
+  80437d:	ff 75 1c             	push   0x1c(%ebp)
+  804380:	ff 75 18             	push   0x18(%ebp)
+  804383:	56                   	push   %esi
+  804384:	ff 75 10             	push   0x10(%ebp)
+  804387:	57                   	push   %edi
+  804388:	ff 75 08             	push   0x8(%ebp)
+  80438b:	e8 b5 cf ff ff       	call   801345 <sys_page_map_range>
+  804390:	89 c3                	mov    %eax,%ebx
+  804392:	83 c4 20             	add    $0x20,%esp
+  804395:	85 c0                	test   %eax,%eax
+  804397:	79 1b                	jns    8043b4 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  804399:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80439c:	75 20                	jne    8043be <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  80439e:	83 ec 08             	sub    $0x8,%esp
+  8043a1:	68 00 00 40 00       	push   $0x400000
+  8043a6:	6a 00                	push   $0x0
+  8043a8:	e8 e6 f4 ff ff       	call   803893 <page_out>
+  8043ad:	83 c4 10             	add    $0x10,%esp
+  8043b0:	85 c0                	test   %eax,%eax
+  8043b2:	79 c6                	jns    80437a <page_map_range+0xf>
+}
+  8043b4:	89 d8                	mov    %ebx,%eax
+  8043b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043b9:	5b                   	pop    %ebx
+  8043ba:	5e                   	pop    %esi
+  8043bb:	5f                   	pop    %edi
+  8043bc:	5d                   	pop    %ebp
+  8043bd:	c3                   	ret
+		if (r != -E_INVAL)
+  8043be:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  8043c1:	75 f1                	jne    8043b4 <page_map_range+0x49>
+  8043c3:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  8043c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8043ca:	eb 03                	jmp    8043cf <page_map_range+0x64>
+  8043cc:	83 c6 01             	add    $0x1,%esi
+  8043cf:	3b 75 18             	cmp    0x18(%ebp),%esi
+  8043d2:	74 2a                	je     8043fe <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  8043d4:	83 ec 0c             	sub    $0xc,%esp
+  8043d7:	ff 75 1c             	push   0x1c(%ebp)
+  8043da:	53                   	push   %ebx
+  8043db:	ff 75 10             	push   0x10(%ebp)
+  8043de:	57                   	push   %edi
+  8043df:	ff 75 08             	push   0x8(%ebp)
+  8043e2:	e8 8d fd ff ff       	call   804174 <page_map>
+  8043e7:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8043ed:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8043f3:	83 c4 20             	add    $0x20,%esp
+  8043f6:	85 c0                	test   %eax,%eax
+  8043f8:	79 d2                	jns    8043cc <page_map_range+0x61>
+  8043fa:	89 c3                	mov    %eax,%ebx
+  8043fc:	eb b6                	jmp    8043b4 <page_map_range+0x49>
+		return 0;
+  8043fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804403:	eb af                	jmp    8043b4 <page_map_range+0x49>
+
+00804405 <paging_pgfault_handler>:
+{
+  804405:	55                   	push   %ebp
+  804406:	89 e5                	mov    %esp,%ebp
+  804408:	56                   	push   %esi
+  804409:	53                   	push   %ebx
+  80440a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  80440d:	e8 6f e7 ff ff       	call   802b81 <find_paging_env>
+	if (pagingenv == 0)
+  804412:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  804417:	85 c0                	test   %eax,%eax
+  804419:	74 3c                	je     804457 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  80441b:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  80441d:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804421:	75 12                	jne    804435 <paging_pgfault_handler+0x30>
+  804423:	89 f0                	mov    %esi,%eax
+  804425:	e8 7e f7 ff ff       	call   803ba8 <page_adopt>
+  80442a:	89 c2                	mov    %eax,%edx
+		return 0;
+  80442c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804431:	85 d2                	test   %edx,%edx
+  804433:	78 22                	js     804457 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  804435:	83 ec 08             	sub    $0x8,%esp
+  804438:	6a 00                	push   $0x0
+  80443a:	56                   	push   %esi
+  80443b:	e8 a9 f3 ff ff       	call   8037e9 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  804440:	83 c4 10             	add    $0x10,%esp
+  804443:	85 c0                	test   %eax,%eax
+  804445:	74 05                	je     80444c <paging_pgfault_handler+0x47>
+  804447:	f6 00 01             	testb  $0x1,(%eax)
+  80444a:	75 12                	jne    80445e <paging_pgfault_handler+0x59>
+	return 0;
+  80444c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804451:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804455:	74 23                	je     80447a <paging_pgfault_handler+0x75>
+}
+  804457:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80445a:	5b                   	pop    %ebx
+  80445b:	5e                   	pop    %esi
+  80445c:	5d                   	pop    %ebp
+  80445d:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  80445e:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804463:	8b 40 48             	mov    0x48(%eax),%eax
+  804466:	83 ec 08             	sub    $0x8,%esp
+  804469:	56                   	push   %esi
+  80446a:	50                   	push   %eax
+  80446b:	e8 d3 fa ff ff       	call   803f43 <page_in>
+  804470:	f7 d0                	not    %eax
+  804472:	c1 e8 1f             	shr    $0x1f,%eax
+  804475:	83 c4 10             	add    $0x10,%esp
+  804478:	eb dd                	jmp    804457 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  80447a:	89 f0                	mov    %esi,%eax
+  80447c:	e8 97 e2 ff ff       	call   802718 <segment_lookup>
+  804481:	89 c2                	mov    %eax,%edx
+	return 0;
+  804483:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804488:	85 d2                	test   %edx,%edx
+  80448a:	74 cb                	je     804457 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  80448c:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804491:	8b 40 48             	mov    0x48(%eax),%eax
+  804494:	83 ec 08             	sub    $0x8,%esp
+  804497:	56                   	push   %esi
+  804498:	50                   	push   %eax
+  804499:	e8 f5 f3 ff ff       	call   803893 <page_out>
+  80449e:	f7 d0                	not    %eax
+  8044a0:	c1 e8 1f             	shr    $0x1f,%eax
+  8044a3:	83 c4 10             	add    $0x10,%esp
+  8044a6:	eb af                	jmp    804457 <paging_pgfault_handler+0x52>
+
+008044a8 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  8044a8:	55                   	push   %ebp
+  8044a9:	89 e5                	mov    %esp,%ebp
+  8044ab:	57                   	push   %edi
+  8044ac:	56                   	push   %esi
+  8044ad:	53                   	push   %ebx
+  8044ae:	83 ec 2c             	sub    $0x2c,%esp
+  8044b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8044b4:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  8044b9:	89 c1                	mov    %eax,%ecx
+  8044bb:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  8044be:	c1 e8 11             	shr    $0x11,%eax
+  8044c1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8044c4:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  8044cb:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  8044ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8044d3:	d3 e0                	shl    %cl,%eax
+  8044d5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8044d8:	85 c7                	test   %eax,%edi
+  8044da:	74 12                	je     8044ee <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  8044dc:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8044e1:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  8044e4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8044e9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8044ec:	eb 17                	jmp    804505 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  8044ee:	ff 75 e0             	push   -0x20(%ebp)
+  8044f1:	68 e4 5c 80 00       	push   $0x805ce4
+  8044f6:	6a 48                	push   $0x48
+  8044f8:	68 fe 5c 80 00       	push   $0x805cfe
+  8044fd:	e8 40 c1 ff ff       	call   800642 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804502:	83 c3 01             	add    $0x1,%ebx
+  804505:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804508:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  80450b:	89 c8                	mov    %ecx,%eax
+  80450d:	c1 e8 05             	shr    $0x5,%eax
+  804510:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  804517:	89 fe                	mov    %edi,%esi
+  804519:	d3 e6                	shl    %cl,%esi
+  80451b:	89 f1                	mov    %esi,%ecx
+  80451d:	85 d6                	test   %edx,%esi
+  80451f:	74 e1                	je     804502 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  804521:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  804524:	f7 d6                	not    %esi
+  804526:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804529:	21 fe                	and    %edi,%esi
+  80452b:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80452e:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  804535:	f7 d1                	not    %ecx
+  804537:	21 d1                	and    %edx,%ecx
+  804539:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804540:	83 ec 04             	sub    $0x4,%esp
+  804543:	53                   	push   %ebx
+  804544:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804547:	57                   	push   %edi
+  804548:	6a 00                	push   $0x0
+  80454a:	e8 97 f8 ff ff       	call   803de6 <page_unmap_range>
+	va_free(va, n);
+  80454f:	83 c4 08             	add    $0x8,%esp
+  804552:	53                   	push   %ebx
+  804553:	57                   	push   %edi
+  804554:	e8 ed 05 00 00       	call   804b46 <va_free>
+}
+  804559:	83 c4 10             	add    $0x10,%esp
+  80455c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80455f:	5b                   	pop    %ebx
+  804560:	5e                   	pop    %esi
+  804561:	5f                   	pop    %edi
+  804562:	5d                   	pop    %ebp
+  804563:	c3                   	ret
+
+00804564 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  804564:	55                   	push   %ebp
+  804565:	89 e5                	mov    %esp,%ebp
+  804567:	57                   	push   %edi
+  804568:	56                   	push   %esi
+  804569:	53                   	push   %ebx
+  80456a:	83 ec 1c             	sub    $0x1c,%esp
+  80456d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804570:	85 db                	test   %ebx,%ebx
+  804572:	74 34                	je     8045a8 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  804574:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80457a:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  80457f:	77 2f                	ja     8045b0 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  804581:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  804587:	75 51                	jne    8045da <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  804589:	89 c1                	mov    %eax,%ecx
+  80458b:	c1 e9 0c             	shr    $0xc,%ecx
+  80458e:	ba 01 00 00 00       	mov    $0x1,%edx
+  804593:	d3 e2                	shl    %cl,%edx
+  804595:	c1 e8 11             	shr    $0x11,%eax
+  804598:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  80459f:	75 24                	jne    8045c5 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  8045a1:	89 d8                	mov    %ebx,%eax
+  8045a3:	e8 00 ff ff ff       	call   8044a8 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  8045a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045ab:	5b                   	pop    %ebx
+  8045ac:	5e                   	pop    %esi
+  8045ad:	5f                   	pop    %edi
+  8045ae:	5d                   	pop    %ebp
+  8045af:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  8045b0:	53                   	push   %ebx
+  8045b1:	68 0b 5d 80 00       	push   $0x805d0b
+  8045b6:	68 a2 00 00 00       	push   $0xa2
+  8045bb:	68 fe 5c 80 00       	push   $0x805cfe
+  8045c0:	e8 7d c0 ff ff       	call   800642 <_panic>
+			panic("free: %p is not allocated", va);
+  8045c5:	53                   	push   %ebx
+  8045c6:	68 e4 5c 80 00       	push   $0x805ce4
+  8045cb:	68 a5 00 00 00       	push   $0xa5
+  8045d0:	68 fe 5c 80 00       	push   $0x805cfe
+  8045d5:	e8 68 c0 ff ff       	call   800642 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  8045da:	89 de                	mov    %ebx,%esi
+  8045dc:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  8045e2:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  8045e8:	89 c8                	mov    %ecx,%eax
+  8045ea:	c1 e8 11             	shr    $0x11,%eax
+  8045ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8045f0:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  8045f7:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8045fa:	c1 e9 0c             	shr    $0xc,%ecx
+  8045fd:	b8 01 00 00 00       	mov    $0x1,%eax
+  804602:	d3 e0                	shl    %cl,%eax
+  804604:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804607:	85 c7                	test   %eax,%edi
+  804609:	74 1b                	je     804626 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  80460b:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  80460f:	89 d8                	mov    %ebx,%eax
+  804611:	29 f0                	sub    %esi,%eax
+  804613:	83 e8 10             	sub    $0x10,%eax
+  804616:	99                   	cltd
+  804617:	f7 ff                	idiv   %edi
+  804619:	89 d1                	mov    %edx,%ecx
+  80461b:	85 d2                	test   %edx,%edx
+  80461d:	75 07                	jne    804626 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80461f:	ba 10 00 00 00       	mov    $0x10,%edx
+  804624:	eb 18                	jmp    80463e <free+0xda>
+		panic("free: %p is not allocated", va);
+  804626:	53                   	push   %ebx
+  804627:	68 e4 5c 80 00       	push   $0x805ce4
+  80462c:	68 ad 00 00 00       	push   $0xad
+  804631:	68 fe 5c 80 00       	push   $0x805cfe
+  804636:	e8 07 c0 ff ff       	call   800642 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80463b:	83 c1 01             	add    $0x1,%ecx
+  80463e:	89 d0                	mov    %edx,%eax
+  804640:	d3 e0                	shl    %cl,%eax
+  804642:	39 c7                	cmp    %eax,%edi
+  804644:	7f f5                	jg     80463b <free+0xd7>
+	*(void **) va = s->free;
+  804646:	8b 46 08             	mov    0x8(%esi),%eax
+  804649:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  80464b:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  80464e:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  804652:	8d 58 01             	lea    0x1(%eax),%ebx
+  804655:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  804659:	66 85 c0             	test   %ax,%ax
+  80465c:	74 52                	je     8046b0 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  80465e:	0f b7 db             	movzwl %bx,%ebx
+  804661:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804665:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80466a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80466f:	f7 ff                	idiv   %edi
+  804671:	39 c3                	cmp    %eax,%ebx
+  804673:	0f 85 2f ff ff ff    	jne    8045a8 <free+0x44>
+  804679:	8b 46 04             	mov    0x4(%esi),%eax
+  80467c:	85 c0                	test   %eax,%eax
+  80467e:	74 53                	je     8046d3 <free+0x16f>
+		s->prev->next = s->next;
+  804680:	8b 16                	mov    (%esi),%edx
+  804682:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804684:	8b 06                	mov    (%esi),%eax
+  804686:	85 c0                	test   %eax,%eax
+  804688:	74 06                	je     804690 <free+0x12c>
+		s->next->prev = s->prev;
+  80468a:	8b 56 04             	mov    0x4(%esi),%edx
+  80468d:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804690:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804693:	f7 d0                	not    %eax
+  804695:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804698:	21 d0                	and    %edx,%eax
+  80469a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80469d:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  8046a4:	89 f0                	mov    %esi,%eax
+  8046a6:	e8 fd fd ff ff       	call   8044a8 <heap_free_pages>
+  8046ab:	e9 f8 fe ff ff       	jmp    8045a8 <free+0x44>
+	s->prev = NULL;
+  8046b0:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  8046b7:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  8046be:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  8046c0:	85 c0                	test   %eax,%eax
+  8046c2:	74 03                	je     8046c7 <free+0x163>
+		slabs[c]->prev = s;
+  8046c4:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  8046c7:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  8046ce:	e9 d5 fe ff ff       	jmp    8045a8 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8046d3:	8b 06                	mov    (%esi),%eax
+  8046d5:	85 c0                	test   %eax,%eax
+  8046d7:	0f 84 cb fe ff ff    	je     8045a8 <free+0x44>
+		slabs[c] = s->next;
+  8046dd:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  8046e4:	8b 06                	mov    (%esi),%eax
+  8046e6:	eb a2                	jmp    80468a <free+0x126>
+
+008046e8 <heap_alloc_pages>:
+{
+  8046e8:	55                   	push   %ebp
+  8046e9:	89 e5                	mov    %esp,%ebp
+  8046eb:	57                   	push   %edi
+  8046ec:	56                   	push   %esi
+  8046ed:	53                   	push   %ebx
+  8046ee:	83 ec 18             	sub    $0x18,%esp
+  8046f1:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  8046f3:	50                   	push   %eax
+  8046f4:	e8 15 03 00 00       	call   804a0e <va_alloc>
+  8046f9:	89 c3                	mov    %eax,%ebx
+  8046fb:	83 c4 10             	add    $0x10,%esp
+  8046fe:	85 c0                	test   %eax,%eax
+  804700:	74 47                	je     804749 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804702:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804708:	89 c1                	mov    %eax,%ecx
+  80470a:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  80470d:	c1 e8 11             	shr    $0x11,%eax
+  804710:	ba 01 00 00 00       	mov    $0x1,%edx
+  804715:	89 d7                	mov    %edx,%edi
+  804717:	d3 e7                	shl    %cl,%edi
+  804719:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  804720:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  804724:	89 c8                	mov    %ecx,%eax
+  804726:	c1 e8 05             	shr    $0x5,%eax
+  804729:	d3 e2                	shl    %cl,%edx
+  80472b:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  804732:	83 ec 0c             	sub    $0xc,%esp
+  804735:	6a 00                	push   $0x0
+  804737:	6a 07                	push   $0x7
+  804739:	56                   	push   %esi
+  80473a:	53                   	push   %ebx
+  80473b:	6a 00                	push   $0x0
+  80473d:	e8 3a f7 ff ff       	call   803e7c <page_alloc_range>
+  804742:	83 c4 20             	add    $0x20,%esp
+  804745:	85 c0                	test   %eax,%eax
+  804747:	78 0a                	js     804753 <heap_alloc_pages+0x6b>
+}
+  804749:	89 d8                	mov    %ebx,%eax
+  80474b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80474e:	5b                   	pop    %ebx
+  80474f:	5e                   	pop    %esi
+  804750:	5f                   	pop    %edi
+  804751:	5d                   	pop    %ebp
+  804752:	c3                   	ret
+		free(va);
+  804753:	83 ec 0c             	sub    $0xc,%esp
+  804756:	53                   	push   %ebx
+  804757:	e8 08 fe ff ff       	call   804564 <free>
+		return NULL;
+  80475c:	83 c4 10             	add    $0x10,%esp
+  80475f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804764:	eb e3                	jmp    804749 <heap_alloc_pages+0x61>
+
+00804766 <malloc>:
+{
+  804766:	55                   	push   %ebp
+  804767:	89 e5                	mov    %esp,%ebp
+  804769:	57                   	push   %edi
+  80476a:	56                   	push   %esi
+  80476b:	53                   	push   %ebx
+  80476c:	83 ec 1c             	sub    $0x1c,%esp
+  80476f:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804772:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804775:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  80477b:	0f 87 21 01 00 00    	ja     8048a2 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804781:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804786:	ba 10 00 00 00       	mov    $0x10,%edx
+  80478b:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  80478d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804792:	76 15                	jbe    8047a9 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804794:	05 ff 0f 00 00       	add    $0xfff,%eax
+  804799:	c1 e8 0c             	shr    $0xc,%eax
+  80479c:	e8 47 ff ff ff       	call   8046e8 <heap_alloc_pages>
+  8047a1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8047a4:	eb 37                	jmp    8047dd <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8047a6:	83 c1 01             	add    $0x1,%ecx
+  8047a9:	89 d6                	mov    %edx,%esi
+  8047ab:	d3 e6                	shl    %cl,%esi
+  8047ad:	39 c6                	cmp    %eax,%esi
+  8047af:	72 f5                	jb     8047a6 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  8047b1:	89 cb                	mov    %ecx,%ebx
+  8047b3:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  8047ba:	85 ff                	test   %edi,%edi
+  8047bc:	74 2a                	je     8047e8 <malloc+0x82>
+	v = s->free;
+  8047be:	8b 47 08             	mov    0x8(%edi),%eax
+  8047c1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  8047c4:	8b 00                	mov    (%eax),%eax
+  8047c6:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  8047c9:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  8047cd:	83 e8 01             	sub    $0x1,%eax
+  8047d0:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  8047d4:	66 85 c0             	test   %ax,%ax
+  8047d7:	0f 84 9a 00 00 00    	je     804877 <malloc+0x111>
+}
+  8047dd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8047e0:	83 c4 1c             	add    $0x1c,%esp
+  8047e3:	5b                   	pop    %ebx
+  8047e4:	5e                   	pop    %esi
+  8047e5:	5f                   	pop    %edi
+  8047e6:	5d                   	pop    %ebp
+  8047e7:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  8047e8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8047ed:	e8 f6 fe ff ff       	call   8046e8 <heap_alloc_pages>
+  8047f2:	89 c1                	mov    %eax,%ecx
+  8047f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8047f7:	85 c0                	test   %eax,%eax
+  8047f9:	74 e2                	je     8047dd <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8047fb:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  804801:	89 c8                	mov    %ecx,%eax
+  804803:	c1 e8 11             	shr    $0x11,%eax
+  804806:	c1 e9 0c             	shr    $0xc,%ecx
+  804809:	ba 01 00 00 00       	mov    $0x1,%edx
+  80480e:	d3 e2                	shl    %cl,%edx
+  804810:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804817:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80481a:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  80481e:	0f b7 f6             	movzwl %si,%esi
+  804821:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804826:	ba 00 00 00 00       	mov    $0x0,%edx
+  80482b:	f7 fe                	idiv   %esi
+  80482d:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804831:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  804834:	85 c0                	test   %eax,%eax
+  804836:	74 14                	je     80484c <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  804838:	83 e8 01             	sub    $0x1,%eax
+  80483b:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  80483f:	0f af d0             	imul   %eax,%edx
+  804842:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804846:	89 3a                	mov    %edi,(%edx)
+  804848:	89 d7                	mov    %edx,%edi
+  80484a:	eb e5                	jmp    804831 <malloc+0xcb>
+	s->prev = NULL;
+  80484c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80484f:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804856:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  80485d:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  80485f:	85 c0                	test   %eax,%eax
+  804861:	74 03                	je     804866 <malloc+0x100>
+		slabs[c]->prev = s;
+  804863:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804866:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804869:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  804870:	89 c7                	mov    %eax,%edi
+  804872:	e9 47 ff ff ff       	jmp    8047be <malloc+0x58>
+	if (s->prev)
+  804877:	8b 47 04             	mov    0x4(%edi),%eax
+  80487a:	85 c0                	test   %eax,%eax
+  80487c:	74 19                	je     804897 <malloc+0x131>
+		s->prev->next = s->next;
+  80487e:	8b 17                	mov    (%edi),%edx
+  804880:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804882:	8b 07                	mov    (%edi),%eax
+  804884:	85 c0                	test   %eax,%eax
+  804886:	0f 84 51 ff ff ff    	je     8047dd <malloc+0x77>
+		s->next->prev = s->prev;
+  80488c:	8b 57 04             	mov    0x4(%edi),%edx
+  80488f:	89 50 04             	mov    %edx,0x4(%eax)
+  804892:	e9 46 ff ff ff       	jmp    8047dd <malloc+0x77>
+		slabs[c] = s->next;
+  804897:	8b 07                	mov    (%edi),%eax
+  804899:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  8048a0:	eb e0                	jmp    804882 <malloc+0x11c>
+		return NULL;
+  8048a2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8048a9:	e9 2f ff ff ff       	jmp    8047dd <malloc+0x77>
+
+008048ae <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  8048ae:	55                   	push   %ebp
+  8048af:	89 e5                	mov    %esp,%ebp
+  8048b1:	57                   	push   %edi
+  8048b2:	56                   	push   %esi
+  8048b3:	53                   	push   %ebx
+  8048b4:	83 ec 0c             	sub    $0xc,%esp
+  8048b7:	89 c6                	mov    %eax,%esi
+  8048b9:	89 d7                	mov    %edx,%edi
+  8048bb:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8048be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8048c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048c8:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  8048cd:	83 ef 01             	sub    $0x1,%edi
+  8048d0:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8048d3:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8048d6:	eb 34                	jmp    80490c <va_chunk_scan+0x5e>
+			i += 31;
+  8048d8:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  8048db:	89 ca                	mov    %ecx,%edx
+			continue;
+  8048dd:	eb 23                	jmp    804902 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8048df:	89 c7                	mov    %eax,%edi
+  8048e1:	c1 ef 05             	shr    $0x5,%edi
+  8048e4:	be 01 00 00 00       	mov    $0x1,%esi
+  8048e9:	d3 e6                	shl    %cl,%esi
+  8048eb:	89 f1                	mov    %esi,%ecx
+  8048ed:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8048f0:	23 0c be             	and    (%esi,%edi,4),%ecx
+  8048f3:	75 41                	jne    804936 <va_chunk_scan+0x88>
+			len++;
+  8048f5:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  8048f8:	39 d3                	cmp    %edx,%ebx
+  8048fa:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  8048fd:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  804900:	72 2d                	jb     80492f <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804902:	83 c0 01             	add    $0x1,%eax
+  804905:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80490a:	77 31                	ja     80493d <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  80490c:	89 c1                	mov    %eax,%ecx
+  80490e:	83 e1 1f             	and    $0x1f,%ecx
+  804911:	75 cc                	jne    8048df <va_chunk_scan+0x31>
+  804913:	89 c7                	mov    %eax,%edi
+  804915:	c1 ef 05             	shr    $0x5,%edi
+  804918:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80491b:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  80491e:	83 ff ff             	cmp    $0xffffffff,%edi
+  804921:	74 b5                	je     8048d8 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  804923:	85 ff                	test   %edi,%edi
+  804925:	75 b8                	jne    8048df <va_chunk_scan+0x31>
+			i += 31;
+  804927:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  80492a:	83 c2 20             	add    $0x20,%edx
+  80492d:	eb c9                	jmp    8048f8 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  80492f:	83 c0 01             	add    $0x1,%eax
+  804932:	29 d0                	sub    %edx,%eax
+  804934:	eb 15                	jmp    80494b <va_chunk_scan+0x9d>
+			len = 0;
+  804936:	ba 00 00 00 00       	mov    $0x0,%edx
+  80493b:	eb c5                	jmp    804902 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  80493d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804942:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804945:	85 d2                	test   %edx,%edx
+  804947:	74 02                	je     80494b <va_chunk_scan+0x9d>
+		*run_store = best;
+  804949:	89 1a                	mov    %ebx,(%edx)
+}
+  80494b:	83 c4 0c             	add    $0xc,%esp
+  80494e:	5b                   	pop    %ebx
+  80494f:	5e                   	pop    %esi
+  804950:	5f                   	pop    %edi
+  804951:	5d                   	pop    %ebp
+  804952:	c3                   	ret
+
+00804953 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804953:	55                   	push   %ebp
+  804954:	89 e5                	mov    %esp,%ebp
+  804956:	57                   	push   %edi
+  804957:	56                   	push   %esi
+  804958:	53                   	push   %ebx
+  804959:	83 ec 14             	sub    $0x14,%esp
+  80495c:	89 c3                	mov    %eax,%ebx
+  80495e:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804960:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804966:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  80496c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  80496f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804972:	89 d6                	mov    %edx,%esi
+  804974:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  80497a:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  80497c:	eb 34                	jmp    8049b2 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  80497e:	89 c8                	mov    %ecx,%eax
+  804980:	c1 e8 05             	shr    $0x5,%eax
+  804983:	89 da                	mov    %ebx,%edx
+  804985:	c1 e2 05             	shl    $0x5,%edx
+  804988:	01 da                	add    %ebx,%edx
+  80498a:	01 c2                	add    %eax,%edx
+  80498c:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804991:	d3 c0                	rol    %cl,%eax
+  804993:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  80499a:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  8049a1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8049a6:	01 d0                	add    %edx,%eax
+  8049a8:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  8049af:	83 c1 01             	add    $0x1,%ecx
+  8049b2:	39 f9                	cmp    %edi,%ecx
+  8049b4:	74 30                	je     8049e6 <va_chunk_mark+0x93>
+		if (alloc)
+  8049b6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8049ba:	74 c2                	je     80497e <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  8049bc:	89 c8                	mov    %ecx,%eax
+  8049be:	c1 e8 05             	shr    $0x5,%eax
+  8049c1:	89 da                	mov    %ebx,%edx
+  8049c3:	c1 e2 05             	shl    $0x5,%edx
+  8049c6:	01 da                	add    %ebx,%edx
+  8049c8:	01 c2                	add    %eax,%edx
+  8049ca:	b8 01 00 00 00       	mov    $0x1,%eax
+  8049cf:	d3 e0                	shl    %cl,%eax
+  8049d1:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  8049d8:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  8049df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8049e4:	eb c0                	jmp    8049a6 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  8049e6:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  8049e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049ee:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8049f1:	e8 b8 fe ff ff       	call   8048ae <va_chunk_scan>
+	ch->run = run;
+  8049f6:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  8049fc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8049ff:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  804a06:	83 c4 14             	add    $0x14,%esp
+  804a09:	5b                   	pop    %ebx
+  804a0a:	5e                   	pop    %esi
+  804a0b:	5f                   	pop    %edi
+  804a0c:	5d                   	pop    %ebp
+  804a0d:	c3                   	ret
+
+00804a0e <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804a0e:	55                   	push   %ebp
+  804a0f:	89 e5                	mov    %esp,%ebp
+  804a11:	57                   	push   %edi
+  804a12:	56                   	push   %esi
+  804a13:	53                   	push   %ebx
+  804a14:	83 ec 04             	sub    $0x4,%esp
+  804a17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804a1a:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  804a1f:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  804a24:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  804a2b:	74 4f                	je     804a7c <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804a2d:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804a30:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804a35:	0f 87 01 01 00 00    	ja     804b3c <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804a3b:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804a41:	0f 87 80 00 00 00    	ja     804ac7 <va_alloc+0xb9>
+  804a47:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804a4c:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804a51:	0f b7 10             	movzwl (%eax),%edx
+  804a54:	05 84 00 00 00       	add    $0x84,%eax
+  804a59:	39 da                	cmp    %ebx,%edx
+  804a5b:	73 2c                	jae    804a89 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804a5d:	83 c6 01             	add    $0x1,%esi
+  804a60:	83 fe 1c             	cmp    $0x1c,%esi
+  804a63:	75 ec                	jne    804a51 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804a65:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a6a:	eb 53                	jmp    804abf <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804a6c:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804a72:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804a77:	05 84 00 00 00       	add    $0x84,%eax
+  804a7c:	39 d0                	cmp    %edx,%eax
+  804a7e:	75 ec                	jne    804a6c <va_alloc+0x5e>
+	va_inited = 1;
+  804a80:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  804a87:	eb a4                	jmp    804a2d <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804a89:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804a8f:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  804a94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804a99:	89 da                	mov    %ebx,%edx
+  804a9b:	e8 0e fe ff ff       	call   8048ae <va_chunk_scan>
+  804aa0:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804aa2:	6a 01                	push   $0x1
+  804aa4:	89 d9                	mov    %ebx,%ecx
+  804aa6:	89 c2                	mov    %eax,%edx
+  804aa8:	89 f0                	mov    %esi,%eax
+  804aaa:	e8 a4 fe ff ff       	call   804953 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804aaf:	c1 e6 16             	shl    $0x16,%esi
+  804ab2:	c1 e7 0c             	shl    $0xc,%edi
+  804ab5:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804abc:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804abf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804ac2:	5b                   	pop    %ebx
+  804ac3:	5e                   	pop    %esi
+  804ac4:	5f                   	pop    %edi
+  804ac5:	5d                   	pop    %ebp
+  804ac6:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804ac7:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804acd:	c1 ee 0a             	shr    $0xa,%esi
+  804ad0:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ada:	eb 0a                	jmp    804ae6 <va_alloc+0xd8>
+			first = c + 1;
+  804adc:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804ade:	83 c2 01             	add    $0x1,%edx
+  804ae1:	83 fa 1d             	cmp    $0x1d,%edx
+  804ae4:	74 4f                	je     804b35 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804ae6:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804aec:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  804af3:	00 04 
+  804af5:	75 e5                	jne    804adc <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804af7:	89 d1                	mov    %edx,%ecx
+  804af9:	29 c1                	sub    %eax,%ecx
+  804afb:	39 f1                	cmp    %esi,%ecx
+  804afd:	75 df                	jne    804ade <va_alloc+0xd0>
+  804aff:	89 c7                	mov    %eax,%edi
+  804b01:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804b04:	be 00 04 00 00       	mov    $0x400,%esi
+  804b09:	39 f3                	cmp    %esi,%ebx
+  804b0b:	0f 46 f3             	cmovbe %ebx,%esi
+  804b0e:	6a 01                	push   $0x1
+  804b10:	89 f1                	mov    %esi,%ecx
+  804b12:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b17:	89 f8                	mov    %edi,%eax
+  804b19:	e8 35 fe ff ff       	call   804953 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804b1e:	83 c7 01             	add    $0x1,%edi
+  804b21:	83 c4 04             	add    $0x4,%esp
+  804b24:	29 f3                	sub    %esi,%ebx
+  804b26:	75 dc                	jne    804b04 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804b28:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804b2b:	c1 e0 16             	shl    $0x16,%eax
+  804b2e:	05 00 00 00 08       	add    $0x8000000,%eax
+  804b33:	eb 8a                	jmp    804abf <va_alloc+0xb1>
+	return NULL;
+  804b35:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b3a:	eb 83                	jmp    804abf <va_alloc+0xb1>
+		return NULL;
+  804b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b41:	e9 79 ff ff ff       	jmp    804abf <va_alloc+0xb1>
+
+00804b46 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804b46:	55                   	push   %ebp
+  804b47:	89 e5                	mov    %esp,%ebp
+  804b49:	57                   	push   %edi
+  804b4a:	56                   	push   %esi
+  804b4b:	53                   	push   %ebx
+  804b4c:	83 ec 0c             	sub    $0xc,%esp
+  804b4f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804b52:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804b55:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804b5b:	76 21                	jbe    804b7e <va_free+0x38>
+  804b5d:	89 f0                	mov    %esi,%eax
+  804b5f:	c1 e0 0c             	shl    $0xc,%eax
+  804b62:	01 f8                	add    %edi,%eax
+  804b64:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804b69:	77 13                	ja     804b7e <va_free+0x38>
+	    || PGOFF(va))
+  804b6b:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804b71:	75 0b                	jne    804b7e <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804b73:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804b79:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804b7c:	eb 45                	jmp    804bc3 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804b7e:	83 ec 0c             	sub    $0xc,%esp
+  804b81:	56                   	push   %esi
+  804b82:	57                   	push   %edi
+  804b83:	68 28 5d 80 00       	push   $0x805d28
+  804b88:	68 8e 00 00 00       	push   $0x8e
+  804b8d:	68 48 5d 80 00       	push   $0x805d48
+  804b92:	e8 ab ba ff ff       	call   800642 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804b97:	89 fa                	mov    %edi,%edx
+  804b99:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804b9f:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804ba4:	29 d3                	sub    %edx,%ebx
+  804ba6:	39 f3                	cmp    %esi,%ebx
+  804ba8:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804bab:	89 f8                	mov    %edi,%eax
+  804bad:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804bb0:	83 ec 0c             	sub    $0xc,%esp
+  804bb3:	6a 00                	push   $0x0
+  804bb5:	89 d9                	mov    %ebx,%ecx
+  804bb7:	e8 97 fd ff ff       	call   804953 <va_chunk_mark>
+		i += n;
+  804bbc:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804bbe:	29 de                	sub    %ebx,%esi
+  804bc0:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804bc3:	85 f6                	test   %esi,%esi
+  804bc5:	75 d0                	jne    804b97 <va_free+0x51>
+	}
+}
+  804bc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804bca:	5b                   	pop    %ebx
+  804bcb:	5e                   	pop    %esi
+  804bcc:	5f                   	pop    %edi
+  804bcd:	5d                   	pop    %ebp
+  804bce:	c3                   	ret
+
+00804bcf <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bd4:	c3                   	ret
+
+00804bd5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804bd5:	55                   	push   %ebp
+  804bd6:	89 e5                	mov    %esp,%ebp
+  804bd8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804bdb:	68 55 5d 80 00       	push   $0x805d55
+  804be0:	ff 75 0c             	push   0xc(%ebp)
+  804be3:	e8 1c c1 ff ff       	call   800d04 <strcpy>
+	return 0;
+}
+  804be8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bed:	c9                   	leave
+  804bee:	c3                   	ret
+
+00804bef <devcons_write>:
+{
+  804bef:	55                   	push   %ebp
+  804bf0:	89 e5                	mov    %esp,%ebp
+  804bf2:	57                   	push   %edi
+  804bf3:	56                   	push   %esi
+  804bf4:	53                   	push   %ebx
+  804bf5:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804bfb:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804c00:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804c06:	eb 2e                	jmp    804c36 <devcons_write+0x47>
+		m = n - tot;
+  804c08:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804c0b:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804c0d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804c12:	39 c3                	cmp    %eax,%ebx
+  804c14:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804c17:	83 ec 04             	sub    $0x4,%esp
+  804c1a:	53                   	push   %ebx
+  804c1b:	89 f0                	mov    %esi,%eax
+  804c1d:	03 45 0c             	add    0xc(%ebp),%eax
+  804c20:	50                   	push   %eax
+  804c21:	57                   	push   %edi
+  804c22:	e8 63 c2 ff ff       	call   800e8a <memmove>
+		sys_cputs(buf, m);
+  804c27:	83 c4 08             	add    $0x8,%esp
+  804c2a:	53                   	push   %ebx
+  804c2b:	57                   	push   %edi
+  804c2c:	e8 f9 c4 ff ff       	call   80112a <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804c31:	01 de                	add    %ebx,%esi
+  804c33:	83 c4 10             	add    $0x10,%esp
+  804c36:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804c39:	72 cd                	jb     804c08 <devcons_write+0x19>
+}
+  804c3b:	89 f0                	mov    %esi,%eax
+  804c3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804c40:	5b                   	pop    %ebx
+  804c41:	5e                   	pop    %esi
+  804c42:	5f                   	pop    %edi
+  804c43:	5d                   	pop    %ebp
+  804c44:	c3                   	ret
+
+00804c45 <devcons_read>:
+{
+  804c45:	55                   	push   %ebp
+  804c46:	89 e5                	mov    %esp,%ebp
+  804c48:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804c4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c50:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804c54:	75 07                	jne    804c5d <devcons_read+0x18>
+  804c56:	eb 1f                	jmp    804c77 <devcons_read+0x32>
+		sys_yield();
+  804c58:	e8 7b c5 ff ff       	call   8011d8 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804c5d:	e8 f7 c4 ff ff       	call   801159 <sys_cgetc>
+  804c62:	85 c0                	test   %eax,%eax
+  804c64:	74 f2                	je     804c58 <devcons_read+0x13>
+	if (c < 0)
+  804c66:	78 0f                	js     804c77 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804c68:	83 f8 04             	cmp    $0x4,%eax
+  804c6b:	74 0c                	je     804c79 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804c6d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804c70:	88 02                	mov    %al,(%edx)
+	return 1;
+  804c72:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804c77:	c9                   	leave
+  804c78:	c3                   	ret
+		return 0;
+  804c79:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c7e:	eb f7                	jmp    804c77 <devcons_read+0x32>
+
+00804c80 <cputchar>:
+{
+  804c80:	55                   	push   %ebp
+  804c81:	89 e5                	mov    %esp,%ebp
+  804c83:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804c86:	8b 45 08             	mov    0x8(%ebp),%eax
+  804c89:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804c8c:	6a 01                	push   $0x1
+  804c8e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804c91:	50                   	push   %eax
+  804c92:	e8 93 c4 ff ff       	call   80112a <sys_cputs>
+}
+  804c97:	83 c4 10             	add    $0x10,%esp
+  804c9a:	c9                   	leave
+  804c9b:	c3                   	ret
+
+00804c9c <getchar>:
+{
+  804c9c:	55                   	push   %ebp
+  804c9d:	89 e5                	mov    %esp,%ebp
+  804c9f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804ca2:	6a 01                	push   $0x1
+  804ca4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804ca7:	50                   	push   %eax
+  804ca8:	6a 00                	push   $0x0
+  804caa:	e8 d7 ce ff ff       	call   801b86 <read>
+	if (r < 0)
+  804caf:	83 c4 10             	add    $0x10,%esp
+  804cb2:	85 c0                	test   %eax,%eax
+  804cb4:	78 06                	js     804cbc <getchar+0x20>
+	if (r < 1)
+  804cb6:	74 06                	je     804cbe <getchar+0x22>
+	return c;
+  804cb8:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804cbc:	c9                   	leave
+  804cbd:	c3                   	ret
+		return -E_EOF;
+  804cbe:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804cc3:	eb f7                	jmp    804cbc <getchar+0x20>
+
+00804cc5 <iscons>:
+{
+  804cc5:	55                   	push   %ebp
+  804cc6:	89 e5                	mov    %esp,%ebp
+  804cc8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804ccb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804cce:	50                   	push   %eax
+  804ccf:	ff 75 08             	push   0x8(%ebp)
+  804cd2:	e8 50 cc ff ff       	call   801927 <fd_lookup>
+  804cd7:	83 c4 10             	add    $0x10,%esp
+  804cda:	85 c0                	test   %eax,%eax
+  804cdc:	78 11                	js     804cef <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804cde:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804ce1:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804ce7:	39 10                	cmp    %edx,(%eax)
+  804ce9:	0f 94 c0             	sete   %al
+  804cec:	0f b6 c0             	movzbl %al,%eax
+}
+  804cef:	c9                   	leave
+  804cf0:	c3                   	ret
+
+00804cf1 <opencons>:
+{
+  804cf1:	55                   	push   %ebp
+  804cf2:	89 e5                	mov    %esp,%ebp
+  804cf4:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804cf7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804cfa:	50                   	push   %eax
+  804cfb:	e8 d3 cb ff ff       	call   8018d3 <fd_alloc>
+  804d00:	83 c4 10             	add    $0x10,%esp
+  804d03:	85 c0                	test   %eax,%eax
+  804d05:	78 3a                	js     804d41 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804d07:	83 ec 04             	sub    $0x4,%esp
+  804d0a:	68 07 04 00 00       	push   $0x407
+  804d0f:	ff 75 f4             	push   -0xc(%ebp)
+  804d12:	6a 00                	push   $0x0
+  804d14:	e8 de c4 ff ff       	call   8011f7 <sys_page_alloc>
+  804d19:	83 c4 10             	add    $0x10,%esp
+  804d1c:	85 c0                	test   %eax,%eax
+  804d1e:	78 21                	js     804d41 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804d20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804d23:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804d29:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804d2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804d2e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804d35:	83 ec 0c             	sub    $0xc,%esp
+  804d38:	50                   	push   %eax
+  804d39:	e8 6e cb ff ff       	call   8018ac <fd2num>
+  804d3e:	83 c4 10             	add    $0x10,%esp
+}
+  804d41:	c9                   	leave
+  804d42:	c3                   	ret
+
+00804d43 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  804d43:	55                   	push   %ebp
+  804d44:	89 e5                	mov    %esp,%ebp
+  804d46:	57                   	push   %edi
+  804d47:	56                   	push   %esi
+  804d48:	53                   	push   %ebx
+  804d49:	83 ec 14             	sub    $0x14,%esp
+  804d4c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804d4f:	8b 75 14             	mov    0x14(%ebp),%esi
+  804d52:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804d55:	ff 75 10             	push   0x10(%ebp)
+  804d58:	ff 75 0c             	push   0xc(%ebp)
+  804d5b:	e8 ba c8 ff ff       	call   80161a <sys_ipc_recv_pages>
+  804d60:	83 c4 10             	add    $0x10,%esp
+  804d63:	85 c0                	test   %eax,%eax
+  804d65:	78 46                	js     804dad <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804d67:	85 ff                	test   %edi,%edi
+  804d69:	74 0d                	je     804d78 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804d6b:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804d70:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804d76:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804d78:	85 f6                	test   %esi,%esi
+  804d7a:	74 0d                	je     804d89 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804d7c:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804d81:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804d87:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804d89:	85 db                	test   %ebx,%ebx
+  804d8b:	74 0d                	je     804d9a <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804d8d:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804d92:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804d98:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804d9a:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804d9f:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804da5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804da8:	5b                   	pop    %ebx
+  804da9:	5e                   	pop    %esi
+  804daa:	5f                   	pop    %edi
+  804dab:	5d                   	pop    %ebp
+  804dac:	c3                   	ret
+		if (from_env_store) {
+  804dad:	85 ff                	test   %edi,%edi
+  804daf:	74 06                	je     804db7 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  804db1:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804db7:	85 f6                	test   %esi,%esi
+  804db9:	74 06                	je     804dc1 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804dbb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804dc1:	85 db                	test   %ebx,%ebx
+  804dc3:	74 e0                	je     804da5 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  804dc5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804dcb:	eb d8                	jmp    804da5 <ipc_recv_pages+0x62>
+
+00804dcd <ipc_recv>:
+{
+  804dcd:	55                   	push   %ebp
+  804dce:	89 e5                	mov    %esp,%ebp
+  804dd0:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  804dd3:	6a 00                	push   $0x0
+  804dd5:	ff 75 10             	push   0x10(%ebp)
+  804dd8:	6a 01                	push   $0x1
+  804dda:	ff 75 0c             	push   0xc(%ebp)
+  804ddd:	ff 75 08             	push   0x8(%ebp)
+  804de0:	e8 5e ff ff ff       	call   804d43 <ipc_recv_pages>
+}
+  804de5:	c9                   	leave
+  804de6:	c3                   	ret
+
+00804de7 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804de7:	55                   	push   %ebp
+  804de8:	89 e5                	mov    %esp,%ebp
+  804dea:	56                   	push   %esi
+  804deb:	53                   	push   %ebx
+  804dec:	8b 75 08             	mov    0x8(%ebp),%esi
+  804def:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  804df2:	83 ec 0c             	sub    $0xc,%esp
+  804df5:	ff 75 0c             	push   0xc(%ebp)
+  804df8:	e8 51 c9 ff ff       	call   80174e <sys_ipc_try_recv>
+  804dfd:	83 c4 10             	add    $0x10,%esp
+  804e00:	85 c0                	test   %eax,%eax
+  804e02:	78 34                	js     804e38 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804e04:	85 f6                	test   %esi,%esi
+  804e06:	74 0d                	je     804e15 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  804e08:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804e0d:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804e13:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  804e15:	85 db                	test   %ebx,%ebx
+  804e17:	74 0d                	je     804e26 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  804e19:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804e1e:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804e24:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804e26:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804e2b:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804e31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804e34:	5b                   	pop    %ebx
+  804e35:	5e                   	pop    %esi
+  804e36:	5d                   	pop    %ebp
+  804e37:	c3                   	ret
+		if (from_env_store) {
+  804e38:	85 f6                	test   %esi,%esi
+  804e3a:	74 06                	je     804e42 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  804e3c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  804e42:	85 db                	test   %ebx,%ebx
+  804e44:	74 eb                	je     804e31 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  804e46:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804e4c:	eb e3                	jmp    804e31 <ipc_try_recv+0x4a>
+
+00804e4e <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804e4e:	55                   	push   %ebp
+  804e4f:	89 e5                	mov    %esp,%ebp
+  804e51:	83 ec 14             	sub    $0x14,%esp
+  804e54:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804e57:	85 c0                	test   %eax,%eax
+  804e59:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804e5e:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804e61:	ff 75 18             	push   0x18(%ebp)
+  804e64:	ff 75 14             	push   0x14(%ebp)
+  804e67:	50                   	push   %eax
+  804e68:	ff 75 0c             	push   0xc(%ebp)
+  804e6b:	ff 75 08             	push   0x8(%ebp)
+  804e6e:	e8 6a c7 ff ff       	call   8015dd <sys_ipc_send_pages>
+  804e73:	83 c4 20             	add    $0x20,%esp
+  804e76:	85 c0                	test   %eax,%eax
+  804e78:	78 02                	js     804e7c <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804e7a:	c9                   	leave
+  804e7b:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804e7c:	50                   	push   %eax
+  804e7d:	68 64 5d 80 00       	push   $0x805d64
+  804e82:	68 80 00 00 00       	push   $0x80
+  804e87:	68 90 5d 80 00       	push   $0x805d90
+  804e8c:	e8 b1 b7 ff ff       	call   800642 <_panic>
+
+00804e91 <ipc_send>:
+{
+  804e91:	55                   	push   %ebp
+  804e92:	89 e5                	mov    %esp,%ebp
+  804e94:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  804e97:	ff 75 14             	push   0x14(%ebp)
+  804e9a:	6a 01                	push   $0x1
+  804e9c:	ff 75 10             	push   0x10(%ebp)
+  804e9f:	ff 75 0c             	push   0xc(%ebp)
+  804ea2:	ff 75 08             	push   0x8(%ebp)
+  804ea5:	e8 a4 ff ff ff       	call   804e4e <ipc_send_pages>
+}
+  804eaa:	83 c4 20             	add    $0x20,%esp
+  804ead:	c9                   	leave
+  804eae:	c3                   	ret
+
+00804eaf <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804eaf:	55                   	push   %ebp
+  804eb0:	89 e5                	mov    %esp,%ebp
+  804eb2:	83 ec 14             	sub    $0x14,%esp
+  804eb5:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804eb8:	85 c0                	test   %eax,%eax
+  804eba:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804ebf:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804ec2:	ff 75 18             	push   0x18(%ebp)
+  804ec5:	ff 75 14             	push   0x14(%ebp)
+  804ec8:	50                   	push   %eax
+  804ec9:	ff 75 0c             	push   0xc(%ebp)
+  804ecc:	ff 75 08             	push   0x8(%ebp)
+  804ecf:	e8 9a c7 ff ff       	call   80166e <sys_ipc_call>
+  804ed4:	83 c4 20             	add    $0x20,%esp
+  804ed7:	85 c0                	test   %eax,%eax
+  804ed9:	78 0b                	js     804ee6 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  804edb:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804ee0:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804ee6:	c9                   	leave
+  804ee7:	c3                   	ret
+
+00804ee8 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  804ee8:	55                   	push   %ebp
+  804ee9:	89 e5                	mov    %esp,%ebp
+  804eeb:	57                   	push   %edi
+  804eec:	56                   	push   %esi
+  804eed:	53                   	push   %ebx
+  804eee:	83 ec 18             	sub    $0x18,%esp
+  804ef1:	8b 45 10             	mov    0x10(%ebp),%eax
+  804ef4:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  804ef7:	8b 75 20             	mov    0x20(%ebp),%esi
+  804efa:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804efd:	85 c0                	test   %eax,%eax
+  804eff:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804f04:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804f07:	ff 75 18             	push   0x18(%ebp)
+  804f0a:	ff 75 14             	push   0x14(%ebp)
+  804f0d:	50                   	push   %eax
+  804f0e:	ff 75 0c             	push   0xc(%ebp)
+  804f11:	ff 75 08             	push   0x8(%ebp)
+  804f14:	e8 96 c7 ff ff       	call   8016af <sys_ipc_reply_recv>
+  804f19:	83 c4 20             	add    $0x20,%esp
+  804f1c:	85 c0                	test   %eax,%eax
+  804f1e:	78 46                	js     804f66 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804f20:	85 ff                	test   %edi,%edi
+  804f22:	74 0d                	je     804f31 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  804f24:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804f29:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804f2f:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804f31:	85 f6                	test   %esi,%esi
+  804f33:	74 0d                	je     804f42 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  804f35:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804f3a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804f40:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804f42:	85 db                	test   %ebx,%ebx
+  804f44:	74 0d                	je     804f53 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  804f46:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804f4b:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804f51:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804f53:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  804f58:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804f5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804f61:	5b                   	pop    %ebx
+  804f62:	5e                   	pop    %esi
+  804f63:	5f                   	pop    %edi
+  804f64:	5d                   	pop    %ebp
+  804f65:	c3                   	ret
+		if (from_env_store) {
+  804f66:	85 ff                	test   %edi,%edi
+  804f68:	74 06                	je     804f70 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  804f6a:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804f70:	85 f6                	test   %esi,%esi
+  804f72:	74 06                	je     804f7a <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  804f74:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804f7a:	85 db                	test   %ebx,%ebx
+  804f7c:	74 e0                	je     804f5e <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  804f7e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804f84:	eb d8                	jmp    804f5e <ipc_reply_recv+0x76>
+
+00804f86 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804f86:	55                   	push   %ebp
+  804f87:	89 e5                	mov    %esp,%ebp
+  804f89:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804f8c:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804f91:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804f94:	c1 e0 06             	shl    $0x6,%eax
+  804f97:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804f9c:	8b 40 50             	mov    0x50(%eax),%eax
+  804f9f:	39 c8                	cmp    %ecx,%eax
+  804fa1:	74 12                	je     804fb5 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804fa3:	83 c2 01             	add    $0x1,%edx
+  804fa6:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804fac:	75 e3                	jne    804f91 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804fae:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fb3:	eb 0e                	jmp    804fc3 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804fb5:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804fb8:	c1 e0 06             	shl    $0x6,%eax
+  804fbb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804fc0:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804fc3:	5d                   	pop    %ebp
+  804fc4:	c3                   	ret
+
+00804fc5 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804fc5:	55                   	push   %ebp
+  804fc6:	89 e5                	mov    %esp,%ebp
+  804fc8:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804fcb:	89 c2                	mov    %eax,%edx
+  804fcd:	c1 ea 16             	shr    $0x16,%edx
+  804fd0:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804fd7:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804fdc:	f6 c1 01             	test   $0x1,%cl
+  804fdf:	74 1e                	je     804fff <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  804fe1:	c1 e8 0c             	shr    $0xc,%eax
+  804fe4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804feb:	a8 01                	test   $0x1,%al
+  804fed:	74 10                	je     804fff <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804fef:	c1 e8 0c             	shr    $0xc,%eax
+  804ff2:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  804ff5:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  804ffc:	0f b7 d2             	movzwl %dx,%edx
+}
+  804fff:	89 d0                	mov    %edx,%eax
+  805001:	5d                   	pop    %ebp
+  805002:	c3                   	ret
+
+00805003 <udivmod>:
+  805003:	55                   	push   %ebp
+  805004:	57                   	push   %edi
+  805005:	56                   	push   %esi
+  805006:	53                   	push   %ebx
+  805007:	83 ec 24             	sub    $0x24,%esp
+  80500a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80500e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  805012:	8b 44 24 38          	mov    0x38(%esp),%eax
+  805016:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80501a:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80501e:	89 54 24 14          	mov    %edx,0x14(%esp)
+  805022:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  805026:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80502b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805030:	ba 00 00 00 00       	mov    $0x0,%edx
+  805035:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80503c:	00 
+  80503d:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  805044:	00 
+  805045:	89 fb                	mov    %edi,%ebx
+  805047:	eb 08                	jmp    805051 <udivmod+0x4e>
+  805049:	83 e9 01             	sub    $0x1,%ecx
+  80504c:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80504f:	74 68                	je     8050b9 <udivmod+0xb6>
+  805051:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  805055:	01 c0                	add    %eax,%eax
+  805057:	89 c6                	mov    %eax,%esi
+  805059:	89 d7                	mov    %edx,%edi
+  80505b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80505f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805063:	0f ad d0             	shrd   %cl,%edx,%eax
+  805066:	d3 ea                	shr    %cl,%edx
+  805068:	f6 c1 20             	test   $0x20,%cl
+  80506b:	74 04                	je     805071 <udivmod+0x6e>
+  80506d:	89 d0                	mov    %edx,%eax
+  80506f:	31 d2                	xor    %edx,%edx
+  805071:	83 e0 01             	and    $0x1,%eax
+  805074:	89 04 24             	mov    %eax,(%esp)
+  805077:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80507e:	00 
+  80507f:	8b 04 24             	mov    (%esp),%eax
+  805082:	8b 54 24 04          	mov    0x4(%esp),%edx
+  805086:	09 f0                	or     %esi,%eax
+  805088:	09 fa                	or     %edi,%edx
+  80508a:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80508e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  805092:	39 f0                	cmp    %esi,%eax
+  805094:	89 d5                	mov    %edx,%ebp
+  805096:	19 fd                	sbb    %edi,%ebp
+  805098:	72 af                	jb     805049 <udivmod+0x46>
+  80509a:	29 f0                	sub    %esi,%eax
+  80509c:	19 fa                	sbb    %edi,%edx
+  80509e:	89 cf                	mov    %ecx,%edi
+  8050a0:	c1 ef 05             	shr    $0x5,%edi
+  8050a3:	83 e7 01             	and    $0x1,%edi
+  8050a6:	89 fe                	mov    %edi,%esi
+  8050a8:	83 f6 01             	xor    $0x1,%esi
+  8050ab:	d3 e6                	shl    %cl,%esi
+  8050ad:	d3 e7                	shl    %cl,%edi
+  8050af:	09 74 24 18          	or     %esi,0x18(%esp)
+  8050b3:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8050b7:	eb 90                	jmp    805049 <udivmod+0x46>
+  8050b9:	85 db                	test   %ebx,%ebx
+  8050bb:	74 05                	je     8050c2 <udivmod+0xbf>
+  8050bd:	89 03                	mov    %eax,(%ebx)
+  8050bf:	89 53 04             	mov    %edx,0x4(%ebx)
+  8050c2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8050c6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8050ca:	83 c4 24             	add    $0x24,%esp
+  8050cd:	5b                   	pop    %ebx
+  8050ce:	5e                   	pop    %esi
+  8050cf:	5f                   	pop    %edi
+  8050d0:	5d                   	pop    %ebp
+  8050d1:	c3                   	ret
+
+008050d2 <__udivdi3>:
+  8050d2:	83 ec 08             	sub    $0x8,%esp
+  8050d5:	6a 00                	push   $0x0
+  8050d7:	ff 74 24 1c          	push   0x1c(%esp)
+  8050db:	ff 74 24 1c          	push   0x1c(%esp)
+  8050df:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8050e3:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8050e7:	e8 17 ff ff ff       	call   805003 <udivmod>
+  8050ec:	83 c4 14             	add    $0x14,%esp
+  8050ef:	c3                   	ret
+
+008050f0 <__umoddi3>:
+  8050f0:	83 ec 18             	sub    $0x18,%esp
+  8050f3:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8050f7:	50                   	push   %eax
+  8050f8:	ff 74 24 2c          	push   0x2c(%esp)
+  8050fc:	ff 74 24 2c          	push   0x2c(%esp)
+  805100:	8b 44 24 28          	mov    0x28(%esp),%eax
+  805104:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  805108:	e8 f6 fe ff ff       	call   805003 <udivmod>
+  80510d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805111:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805115:	83 c4 24             	add    $0x24,%esp
+  805118:	c3                   	ret
+
+00805119 <__divdi3>:
+  805119:	55                   	push   %ebp
+  80511a:	57                   	push   %edi
+  80511b:	56                   	push   %esi
+  80511c:	53                   	push   %ebx
+  80511d:	83 ec 10             	sub    $0x10,%esp
+  805120:	8b 44 24 24          	mov    0x24(%esp),%eax
+  805124:	8b 54 24 28          	mov    0x28(%esp),%edx
+  805128:	89 c6                	mov    %eax,%esi
+  80512a:	89 d7                	mov    %edx,%edi
+  80512c:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  805130:	33 7c 24 30          	xor    0x30(%esp),%edi
+  805134:	89 74 24 04          	mov    %esi,0x4(%esp)
+  805138:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  80513c:	89 c5                	mov    %eax,%ebp
+  80513e:	f7 dd                	neg    %ebp
+  805140:	89 d6                	mov    %edx,%esi
+  805142:	83 d6 00             	adc    $0x0,%esi
+  805145:	f7 de                	neg    %esi
+  805147:	0f 48 e8             	cmovs  %eax,%ebp
+  80514a:	0f 49 d6             	cmovns %esi,%edx
+  80514d:	6a 00                	push   $0x0
+  80514f:	8b 74 24 30          	mov    0x30(%esp),%esi
+  805153:	f7 de                	neg    %esi
+  805155:	8b 44 24 34          	mov    0x34(%esp),%eax
+  805159:	83 d0 00             	adc    $0x0,%eax
+  80515c:	f7 d8                	neg    %eax
+  80515e:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  805163:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  805168:	50                   	push   %eax
+  805169:	56                   	push   %esi
+  80516a:	89 e8                	mov    %ebp,%eax
+  80516c:	e8 92 fe ff ff       	call   805003 <udivmod>
+  805171:	83 c4 10             	add    $0x10,%esp
+  805174:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  805179:	78 08                	js     805183 <__divdi3+0x6a>
+  80517b:	83 c4 0c             	add    $0xc,%esp
+  80517e:	5b                   	pop    %ebx
+  80517f:	5e                   	pop    %esi
+  805180:	5f                   	pop    %edi
+  805181:	5d                   	pop    %ebp
+  805182:	c3                   	ret
+  805183:	f7 d8                	neg    %eax
+  805185:	83 d2 00             	adc    $0x0,%edx
+  805188:	f7 da                	neg    %edx
+  80518a:	eb ef                	jmp    80517b <__divdi3+0x62>
+
+0080518c <__moddi3>:
+  80518c:	55                   	push   %ebp
+  80518d:	57                   	push   %edi
+  80518e:	56                   	push   %esi
+  80518f:	53                   	push   %ebx
+  805190:	83 ec 18             	sub    $0x18,%esp
+  805193:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  805197:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80519b:	89 f1                	mov    %esi,%ecx
+  80519d:	f7 d9                	neg    %ecx
+  80519f:	89 da                	mov    %ebx,%edx
+  8051a1:	83 d2 00             	adc    $0x0,%edx
+  8051a4:	f7 da                	neg    %edx
+  8051a6:	0f 48 ce             	cmovs  %esi,%ecx
+  8051a9:	0f 48 d3             	cmovs  %ebx,%edx
+  8051ac:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8051b0:	50                   	push   %eax
+  8051b1:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8051b5:	f7 de                	neg    %esi
+  8051b7:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8051bb:	83 d0 00             	adc    $0x0,%eax
+  8051be:	f7 d8                	neg    %eax
+  8051c0:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8051c5:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8051ca:	50                   	push   %eax
+  8051cb:	56                   	push   %esi
+  8051cc:	89 c8                	mov    %ecx,%eax
+  8051ce:	e8 30 fe ff ff       	call   805003 <udivmod>
+  8051d3:	83 c4 10             	add    $0x10,%esp
+  8051d6:	85 db                	test   %ebx,%ebx
+  8051d8:	78 10                	js     8051ea <__moddi3+0x5e>
+  8051da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8051de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8051e2:	83 c4 14             	add    $0x14,%esp
+  8051e5:	5b                   	pop    %ebx
+  8051e6:	5e                   	pop    %esi
+  8051e7:	5f                   	pop    %edi
+  8051e8:	5d                   	pop    %ebp
+  8051e9:	c3                   	ret
+  8051ea:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8051ee:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8051f2:	f7 d8                	neg    %eax
+  8051f4:	83 d2 00             	adc    $0x0,%edx
+  8051f7:	f7 da                	neg    %edx
+  8051f9:	eb e7                	jmp    8051e2 <__moddi3+0x56>
@@ -0,0 +1,5557 @@
+
+obj/user/faultwrite.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 0d 00 00 00       	call   80003e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	*(unsigned*)0 = 0;
+  800033:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80003a:	00 00 00 
+}
+  80003d:	c3                   	ret
+
+0080003e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80003e:	55                   	push   %ebp
+  80003f:	89 e5                	mov    %esp,%ebp
+  800041:	56                   	push   %esi
+  800042:	53                   	push   %ebx
+  800043:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800046:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800049:	e8 08 01 00 00       	call   800156 <sys_getenvid>
+  80004e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800053:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800056:	c1 e0 06             	shl    $0x6,%eax
+  800059:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80005e:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800063:	85 db                	test   %ebx,%ebx
+  800065:	7e 07                	jle    80006e <libmain+0x30>
+		binaryname = argv[0];
+  800067:	8b 06                	mov    (%esi),%eax
+  800069:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80006e:	83 ec 08             	sub    $0x8,%esp
+  800071:	56                   	push   %esi
+  800072:	53                   	push   %ebx
+  800073:	e8 bb ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800078:	e8 0a 00 00 00       	call   800087 <exit>
+}
+  80007d:	83 c4 10             	add    $0x10,%esp
+  800080:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800083:	5b                   	pop    %ebx
+  800084:	5e                   	pop    %esi
+  800085:	5d                   	pop    %ebp
+  800086:	c3                   	ret
+
+00800087 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800087:	55                   	push   %ebp
+  800088:	89 e5                	mov    %esp,%ebp
+  80008a:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80008d:	e8 68 08 00 00       	call   8008fa <close_all>
+	sys_env_destroy(0);
+  800092:	83 ec 0c             	sub    $0xc,%esp
+  800095:	6a 00                	push   $0x0
+  800097:	e8 79 00 00 00       	call   800115 <sys_env_destroy>
+}
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	c9                   	leave
+  8000a0:	c3                   	ret
+
+008000a1 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  8000a1:	55                   	push   %ebp
+  8000a2:	89 e5                	mov    %esp,%ebp
+  8000a4:	83 ec 10             	sub    $0x10,%esp
+  8000a7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000aa:	89 c8                	mov    %ecx,%eax
+  8000ac:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8000b1:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8000b4:	eb 0b                	jmp    8000c1 <touch_mem+0x20>
+		c = *(char *)page;
+  8000b6:	0f b6 10             	movzbl (%eax),%edx
+  8000b9:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000bc:	05 00 10 00 00       	add    $0x1000,%eax
+  8000c1:	39 c8                	cmp    %ecx,%eax
+  8000c3:	72 f1                	jb     8000b6 <touch_mem+0x15>
+}
+  8000c5:	c9                   	leave
+  8000c6:	c3                   	ret
+
+008000c7 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000c7:	55                   	push   %ebp
+  8000c8:	89 e5                	mov    %esp,%ebp
+  8000ca:	57                   	push   %edi
+  8000cb:	56                   	push   %esi
+  8000cc:	53                   	push   %ebx
+	touch_mem(s, len);
+  8000cd:	ff 75 0c             	push   0xc(%ebp)
+  8000d0:	ff 75 08             	push   0x8(%ebp)
+  8000d3:	e8 c9 ff ff ff       	call   8000a1 <touch_mem>
+	asm volatile("int %1\n"
+  8000d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000e3:	89 c3                	mov    %eax,%ebx
+  8000e5:	89 c7                	mov    %eax,%edi
+  8000e7:	89 c6                	mov    %eax,%esi
+  8000e9:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000eb:	83 c4 08             	add    $0x8,%esp
+  8000ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000f1:	5b                   	pop    %ebx
+  8000f2:	5e                   	pop    %esi
+  8000f3:	5f                   	pop    %edi
+  8000f4:	5d                   	pop    %ebp
+  8000f5:	c3                   	ret
+
+008000f6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000f6:	55                   	push   %ebp
+  8000f7:	89 e5                	mov    %esp,%ebp
+  8000f9:	57                   	push   %edi
+  8000fa:	56                   	push   %esi
+  8000fb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800101:	b8 01 00 00 00       	mov    $0x1,%eax
+  800106:	89 d1                	mov    %edx,%ecx
+  800108:	89 d3                	mov    %edx,%ebx
+  80010a:	89 d7                	mov    %edx,%edi
+  80010c:	89 d6                	mov    %edx,%esi
+  80010e:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800110:	5b                   	pop    %ebx
+  800111:	5e                   	pop    %esi
+  800112:	5f                   	pop    %edi
+  800113:	5d                   	pop    %ebp
+  800114:	c3                   	ret
+
+00800115 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800115:	55                   	push   %ebp
+  800116:	89 e5                	mov    %esp,%ebp
+  800118:	57                   	push   %edi
+  800119:	56                   	push   %esi
+  80011a:	53                   	push   %ebx
+  80011b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80011e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800123:	8b 55 08             	mov    0x8(%ebp),%edx
+  800126:	b8 03 00 00 00       	mov    $0x3,%eax
+  80012b:	89 cb                	mov    %ecx,%ebx
+  80012d:	89 cf                	mov    %ecx,%edi
+  80012f:	89 ce                	mov    %ecx,%esi
+  800131:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800133:	85 c0                	test   %eax,%eax
+  800135:	7f 08                	jg     80013f <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800137:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80013a:	5b                   	pop    %ebx
+  80013b:	5e                   	pop    %esi
+  80013c:	5f                   	pop    %edi
+  80013d:	5d                   	pop    %ebp
+  80013e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80013f:	83 ec 0c             	sub    $0xc,%esp
+  800142:	50                   	push   %eax
+  800143:	6a 03                	push   $0x3
+  800145:	68 aa 26 80 00       	push   $0x8026aa
+  80014a:	6a 23                	push   $0x23
+  80014c:	68 c7 26 80 00       	push   $0x8026c7
+  800151:	e8 b9 15 00 00       	call   80170f <_panic>
+
+00800156 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800156:	55                   	push   %ebp
+  800157:	89 e5                	mov    %esp,%ebp
+  800159:	57                   	push   %edi
+  80015a:	56                   	push   %esi
+  80015b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80015c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800161:	b8 02 00 00 00       	mov    $0x2,%eax
+  800166:	89 d1                	mov    %edx,%ecx
+  800168:	89 d3                	mov    %edx,%ebx
+  80016a:	89 d7                	mov    %edx,%edi
+  80016c:	89 d6                	mov    %edx,%esi
+  80016e:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800170:	5b                   	pop    %ebx
+  800171:	5e                   	pop    %esi
+  800172:	5f                   	pop    %edi
+  800173:	5d                   	pop    %ebp
+  800174:	c3                   	ret
+
+00800175 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800175:	55                   	push   %ebp
+  800176:	89 e5                	mov    %esp,%ebp
+  800178:	57                   	push   %edi
+  800179:	56                   	push   %esi
+  80017a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80017b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800180:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800185:	89 d1                	mov    %edx,%ecx
+  800187:	89 d3                	mov    %edx,%ebx
+  800189:	89 d7                	mov    %edx,%edi
+  80018b:	89 d6                	mov    %edx,%esi
+  80018d:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80018f:	5b                   	pop    %ebx
+  800190:	5e                   	pop    %esi
+  800191:	5f                   	pop    %edi
+  800192:	5d                   	pop    %ebp
+  800193:	c3                   	ret
+
+00800194 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800194:	55                   	push   %ebp
+  800195:	89 e5                	mov    %esp,%ebp
+  800197:	57                   	push   %edi
+  800198:	56                   	push   %esi
+  800199:	53                   	push   %ebx
+  80019a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80019d:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001a8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001b0:	89 f7                	mov    %esi,%edi
+  8001b2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001b4:	85 c0                	test   %eax,%eax
+  8001b6:	7f 08                	jg     8001c0 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001bb:	5b                   	pop    %ebx
+  8001bc:	5e                   	pop    %esi
+  8001bd:	5f                   	pop    %edi
+  8001be:	5d                   	pop    %ebp
+  8001bf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001c0:	83 ec 0c             	sub    $0xc,%esp
+  8001c3:	50                   	push   %eax
+  8001c4:	6a 04                	push   $0x4
+  8001c6:	68 aa 26 80 00       	push   $0x8026aa
+  8001cb:	6a 23                	push   $0x23
+  8001cd:	68 c7 26 80 00       	push   $0x8026c7
+  8001d2:	e8 38 15 00 00       	call   80170f <_panic>
+
+008001d7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	57                   	push   %edi
+  8001db:	56                   	push   %esi
+  8001dc:	53                   	push   %ebx
+  8001dd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001e6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001ee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001f1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001f4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001f6:	85 c0                	test   %eax,%eax
+  8001f8:	7f 08                	jg     800202 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fd:	5b                   	pop    %ebx
+  8001fe:	5e                   	pop    %esi
+  8001ff:	5f                   	pop    %edi
+  800200:	5d                   	pop    %ebp
+  800201:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800202:	83 ec 0c             	sub    $0xc,%esp
+  800205:	50                   	push   %eax
+  800206:	6a 05                	push   $0x5
+  800208:	68 aa 26 80 00       	push   $0x8026aa
+  80020d:	6a 23                	push   $0x23
+  80020f:	68 c7 26 80 00       	push   $0x8026c7
+  800214:	e8 f6 14 00 00       	call   80170f <_panic>
+
+00800219 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800219:	55                   	push   %ebp
+  80021a:	89 e5                	mov    %esp,%ebp
+  80021c:	57                   	push   %edi
+  80021d:	56                   	push   %esi
+  80021e:	53                   	push   %ebx
+  80021f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800222:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800227:	8b 55 08             	mov    0x8(%ebp),%edx
+  80022a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80022d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800232:	89 df                	mov    %ebx,%edi
+  800234:	89 de                	mov    %ebx,%esi
+  800236:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800238:	85 c0                	test   %eax,%eax
+  80023a:	7f 08                	jg     800244 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80023c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80023f:	5b                   	pop    %ebx
+  800240:	5e                   	pop    %esi
+  800241:	5f                   	pop    %edi
+  800242:	5d                   	pop    %ebp
+  800243:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800244:	83 ec 0c             	sub    $0xc,%esp
+  800247:	50                   	push   %eax
+  800248:	6a 06                	push   $0x6
+  80024a:	68 aa 26 80 00       	push   $0x8026aa
+  80024f:	6a 23                	push   $0x23
+  800251:	68 c7 26 80 00       	push   $0x8026c7
+  800256:	e8 b4 14 00 00       	call   80170f <_panic>
+
+0080025b <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  80025b:	55                   	push   %ebp
+  80025c:	89 e5                	mov    %esp,%ebp
+  80025e:	57                   	push   %edi
+  80025f:	56                   	push   %esi
+  800260:	53                   	push   %ebx
+  800261:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800264:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800269:	8b 55 08             	mov    0x8(%ebp),%edx
+  80026c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80026f:	b8 18 00 00 00       	mov    $0x18,%eax
+  800274:	89 df                	mov    %ebx,%edi
+  800276:	89 de                	mov    %ebx,%esi
+  800278:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80027a:	85 c0                	test   %eax,%eax
+  80027c:	7f 08                	jg     800286 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80027e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800281:	5b                   	pop    %ebx
+  800282:	5e                   	pop    %esi
+  800283:	5f                   	pop    %edi
+  800284:	5d                   	pop    %ebp
+  800285:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800286:	83 ec 0c             	sub    $0xc,%esp
+  800289:	50                   	push   %eax
+  80028a:	6a 18                	push   $0x18
+  80028c:	68 aa 26 80 00       	push   $0x8026aa
+  800291:	6a 23                	push   $0x23
+  800293:	68 c7 26 80 00       	push   $0x8026c7
+  800298:	e8 72 14 00 00       	call   80170f <_panic>
+
+0080029d <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  80029d:	55                   	push   %ebp
+  80029e:	89 e5                	mov    %esp,%ebp
+  8002a0:	57                   	push   %edi
+  8002a1:	56                   	push   %esi
+  8002a2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002ae:	b8 19 00 00 00       	mov    $0x19,%eax
+  8002b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002b6:	89 f7                	mov    %esi,%edi
+  8002b8:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  8002ba:	5b                   	pop    %ebx
+  8002bb:	5e                   	pop    %esi
+  8002bc:	5f                   	pop    %edi
+  8002bd:	5d                   	pop    %ebp
+  8002be:	c3                   	ret
+
+008002bf <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8002bf:	55                   	push   %ebp
+  8002c0:	89 e5                	mov    %esp,%ebp
+  8002c2:	57                   	push   %edi
+  8002c3:	56                   	push   %esi
+  8002c4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002cb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8002d5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002d8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002db:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8002dd:	5b                   	pop    %ebx
+  8002de:	5e                   	pop    %esi
+  8002df:	5f                   	pop    %edi
+  8002e0:	5d                   	pop    %ebp
+  8002e1:	c3                   	ret
+
+008002e2 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  8002e2:	55                   	push   %ebp
+  8002e3:	89 e5                	mov    %esp,%ebp
+  8002e5:	57                   	push   %edi
+  8002e6:	56                   	push   %esi
+  8002e7:	53                   	push   %ebx
+  8002e8:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  8002eb:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8002ee:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8002f4:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  8002f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002fd:	b8 10 00 00 00       	mov    $0x10,%eax
+  800302:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800305:	8b 75 18             	mov    0x18(%ebp),%esi
+  800308:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80030a:	85 c0                	test   %eax,%eax
+  80030c:	7f 08                	jg     800316 <sys_page_map_range+0x34>
+}
+  80030e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800311:	5b                   	pop    %ebx
+  800312:	5e                   	pop    %esi
+  800313:	5f                   	pop    %edi
+  800314:	5d                   	pop    %ebp
+  800315:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800316:	83 ec 0c             	sub    $0xc,%esp
+  800319:	50                   	push   %eax
+  80031a:	6a 10                	push   $0x10
+  80031c:	68 aa 26 80 00       	push   $0x8026aa
+  800321:	6a 23                	push   $0x23
+  800323:	68 c7 26 80 00       	push   $0x8026c7
+  800328:	e8 e2 13 00 00       	call   80170f <_panic>
+
+0080032d <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  80032d:	55                   	push   %ebp
+  80032e:	89 e5                	mov    %esp,%ebp
+  800330:	57                   	push   %edi
+  800331:	56                   	push   %esi
+  800332:	53                   	push   %ebx
+  800333:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800336:	be 00 00 00 00       	mov    $0x0,%esi
+  80033b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80033e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800341:	b8 11 00 00 00       	mov    $0x11,%eax
+  800346:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800349:	89 f7                	mov    %esi,%edi
+  80034b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80034d:	85 c0                	test   %eax,%eax
+  80034f:	7f 08                	jg     800359 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800351:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800354:	5b                   	pop    %ebx
+  800355:	5e                   	pop    %esi
+  800356:	5f                   	pop    %edi
+  800357:	5d                   	pop    %ebp
+  800358:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800359:	83 ec 0c             	sub    $0xc,%esp
+  80035c:	50                   	push   %eax
+  80035d:	6a 11                	push   $0x11
+  80035f:	68 aa 26 80 00       	push   $0x8026aa
+  800364:	6a 23                	push   $0x23
+  800366:	68 c7 26 80 00       	push   $0x8026c7
+  80036b:	e8 9f 13 00 00       	call   80170f <_panic>
+
+00800370 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800370:	55                   	push   %ebp
+  800371:	89 e5                	mov    %esp,%ebp
+  800373:	57                   	push   %edi
+  800374:	56                   	push   %esi
+  800375:	53                   	push   %ebx
+  800376:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800379:	be 00 00 00 00       	mov    $0x0,%esi
+  80037e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800381:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800384:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800389:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80038c:	89 f7                	mov    %esi,%edi
+  80038e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800390:	85 c0                	test   %eax,%eax
+  800392:	7f 08                	jg     80039c <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800394:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800397:	5b                   	pop    %ebx
+  800398:	5e                   	pop    %esi
+  800399:	5f                   	pop    %edi
+  80039a:	5d                   	pop    %ebp
+  80039b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80039c:	83 ec 0c             	sub    $0xc,%esp
+  80039f:	50                   	push   %eax
+  8003a0:	6a 1b                	push   $0x1b
+  8003a2:	68 aa 26 80 00       	push   $0x8026aa
+  8003a7:	6a 23                	push   $0x23
+  8003a9:	68 c7 26 80 00       	push   $0x8026c7
+  8003ae:	e8 5c 13 00 00       	call   80170f <_panic>
+
+008003b3 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  8003b3:	55                   	push   %ebp
+  8003b4:	89 e5                	mov    %esp,%ebp
+  8003b6:	57                   	push   %edi
+  8003b7:	56                   	push   %esi
+  8003b8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003be:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003c3:	89 d1                	mov    %edx,%ecx
+  8003c5:	89 d3                	mov    %edx,%ebx
+  8003c7:	89 d7                	mov    %edx,%edi
+  8003c9:	89 d6                	mov    %edx,%esi
+  8003cb:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8003cd:	5b                   	pop    %ebx
+  8003ce:	5e                   	pop    %esi
+  8003cf:	5f                   	pop    %edi
+  8003d0:	5d                   	pop    %ebp
+  8003d1:	c3                   	ret
+
+008003d2 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003d2:	55                   	push   %ebp
+  8003d3:	89 e5                	mov    %esp,%ebp
+  8003d5:	57                   	push   %edi
+  8003d6:	56                   	push   %esi
+  8003d7:	53                   	push   %ebx
+  8003d8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003e6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8003eb:	89 df                	mov    %ebx,%edi
+  8003ed:	89 de                	mov    %ebx,%esi
+  8003ef:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003f1:	85 c0                	test   %eax,%eax
+  8003f3:	7f 08                	jg     8003fd <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f8:	5b                   	pop    %ebx
+  8003f9:	5e                   	pop    %esi
+  8003fa:	5f                   	pop    %edi
+  8003fb:	5d                   	pop    %ebp
+  8003fc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003fd:	83 ec 0c             	sub    $0xc,%esp
+  800400:	50                   	push   %eax
+  800401:	6a 08                	push   $0x8
+  800403:	68 aa 26 80 00       	push   $0x8026aa
+  800408:	6a 23                	push   $0x23
+  80040a:	68 c7 26 80 00       	push   $0x8026c7
+  80040f:	e8 fb 12 00 00       	call   80170f <_panic>
+
+00800414 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800414:	55                   	push   %ebp
+  800415:	89 e5                	mov    %esp,%ebp
+  800417:	57                   	push   %edi
+  800418:	56                   	push   %esi
+  800419:	53                   	push   %ebx
+  80041a:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  80041d:	6a 44                	push   $0x44
+  80041f:	ff 75 0c             	push   0xc(%ebp)
+  800422:	e8 7a fc ff ff       	call   8000a1 <touch_mem>
+	asm volatile("int %1\n"
+  800427:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80042c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80042f:	b8 09 00 00 00       	mov    $0x9,%eax
+  800434:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800437:	89 df                	mov    %ebx,%edi
+  800439:	89 de                	mov    %ebx,%esi
+  80043b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80043d:	83 c4 08             	add    $0x8,%esp
+  800440:	85 c0                	test   %eax,%eax
+  800442:	7f 08                	jg     80044c <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800444:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800447:	5b                   	pop    %ebx
+  800448:	5e                   	pop    %esi
+  800449:	5f                   	pop    %edi
+  80044a:	5d                   	pop    %ebp
+  80044b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80044c:	83 ec 0c             	sub    $0xc,%esp
+  80044f:	50                   	push   %eax
+  800450:	6a 09                	push   $0x9
+  800452:	68 aa 26 80 00       	push   $0x8026aa
+  800457:	6a 23                	push   $0x23
+  800459:	68 c7 26 80 00       	push   $0x8026c7
+  80045e:	e8 ac 12 00 00       	call   80170f <_panic>
+
+00800463 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800463:	55                   	push   %ebp
+  800464:	89 e5                	mov    %esp,%ebp
+  800466:	57                   	push   %edi
+  800467:	56                   	push   %esi
+  800468:	53                   	push   %ebx
+  800469:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80046c:	be 00 00 00 00       	mov    $0x0,%esi
+  800471:	8b 55 08             	mov    0x8(%ebp),%edx
+  800474:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800477:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80047c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80047f:	89 f7                	mov    %esi,%edi
+  800481:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800483:	85 c0                	test   %eax,%eax
+  800485:	7f 08                	jg     80048f <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800487:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80048a:	5b                   	pop    %ebx
+  80048b:	5e                   	pop    %esi
+  80048c:	5f                   	pop    %edi
+  80048d:	5d                   	pop    %ebp
+  80048e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80048f:	83 ec 0c             	sub    $0xc,%esp
+  800492:	50                   	push   %eax
+  800493:	6a 1a                	push   $0x1a
+  800495:	68 aa 26 80 00       	push   $0x8026aa
+  80049a:	6a 23                	push   $0x23
+  80049c:	68 c7 26 80 00       	push   $0x8026c7
+  8004a1:	e8 69 12 00 00       	call   80170f <_panic>
+
+008004a6 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8004a6:	55                   	push   %ebp
+  8004a7:	89 e5                	mov    %esp,%ebp
+  8004a9:	57                   	push   %edi
+  8004aa:	56                   	push   %esi
+  8004ab:	53                   	push   %ebx
+  8004ac:	83 ec 0c             	sub    $0xc,%esp
+  8004af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8004b2:	89 d8                	mov    %ebx,%eax
+  8004b4:	c1 e0 05             	shl    $0x5,%eax
+  8004b7:	50                   	push   %eax
+  8004b8:	ff 75 0c             	push   0xc(%ebp)
+  8004bb:	e8 e1 fb ff ff       	call   8000a1 <touch_mem>
+	asm volatile("int %1\n"
+  8004c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8004c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004d0:	89 f7                	mov    %esi,%edi
+  8004d2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004d4:	83 c4 08             	add    $0x8,%esp
+  8004d7:	85 c0                	test   %eax,%eax
+  8004d9:	7f 08                	jg     8004e3 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8004db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004de:	5b                   	pop    %ebx
+  8004df:	5e                   	pop    %esi
+  8004e0:	5f                   	pop    %edi
+  8004e1:	5d                   	pop    %ebp
+  8004e2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004e3:	83 ec 0c             	sub    $0xc,%esp
+  8004e6:	50                   	push   %eax
+  8004e7:	6a 13                	push   $0x13
+  8004e9:	68 aa 26 80 00       	push   $0x8026aa
+  8004ee:	6a 23                	push   $0x23
+  8004f0:	68 c7 26 80 00       	push   $0x8026c7
+  8004f5:	e8 15 12 00 00       	call   80170f <_panic>
+
+008004fa <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8004fa:	55                   	push   %ebp
+  8004fb:	89 e5                	mov    %esp,%ebp
+  8004fd:	57                   	push   %edi
+  8004fe:	56                   	push   %esi
+  8004ff:	53                   	push   %ebx
+  800500:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800503:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800508:	8b 55 08             	mov    0x8(%ebp),%edx
+  80050b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80050e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800513:	89 df                	mov    %ebx,%edi
+  800515:	89 de                	mov    %ebx,%esi
+  800517:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800519:	85 c0                	test   %eax,%eax
+  80051b:	7f 08                	jg     800525 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80051d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800520:	5b                   	pop    %ebx
+  800521:	5e                   	pop    %esi
+  800522:	5f                   	pop    %edi
+  800523:	5d                   	pop    %ebp
+  800524:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800525:	83 ec 0c             	sub    $0xc,%esp
+  800528:	50                   	push   %eax
+  800529:	6a 0a                	push   $0xa
+  80052b:	68 aa 26 80 00       	push   $0x8026aa
+  800530:	6a 23                	push   $0x23
+  800532:	68 c7 26 80 00       	push   $0x8026c7
+  800537:	e8 d3 11 00 00       	call   80170f <_panic>
+
+0080053c <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80053c:	55                   	push   %ebp
+  80053d:	89 e5                	mov    %esp,%ebp
+  80053f:	57                   	push   %edi
+  800540:	56                   	push   %esi
+  800541:	53                   	push   %ebx
+  800542:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  800545:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80054b:	76 1d                	jbe    80056a <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80054d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800550:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800553:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800558:	be 01 00 00 00       	mov    $0x1,%esi
+  80055d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800560:	cd 30                	int    $0x30
+}
+  800562:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800565:	5b                   	pop    %ebx
+  800566:	5e                   	pop    %esi
+  800567:	5f                   	pop    %edi
+  800568:	5d                   	pop    %ebp
+  800569:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80056a:	68 00 10 00 00       	push   $0x1000
+  80056f:	53                   	push   %ebx
+  800570:	e8 2c fb ff ff       	call   8000a1 <touch_mem>
+  800575:	83 c4 08             	add    $0x8,%esp
+  800578:	eb d3                	jmp    80054d <sys_ipc_send+0x11>
+
+0080057a <sys_ipc_send_pages>:
+{
+  80057a:	55                   	push   %ebp
+  80057b:	89 e5                	mov    %esp,%ebp
+  80057d:	57                   	push   %edi
+  80057e:	56                   	push   %esi
+  80057f:	53                   	push   %ebx
+  800580:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800583:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  800586:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80058c:	76 18                	jbe    8005a6 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80058e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800591:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800594:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800599:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80059c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  80059e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005a1:	5b                   	pop    %ebx
+  8005a2:	5e                   	pop    %esi
+  8005a3:	5f                   	pop    %edi
+  8005a4:	5d                   	pop    %ebp
+  8005a5:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8005a6:	89 f0                	mov    %esi,%eax
+  8005a8:	c1 e0 0c             	shl    $0xc,%eax
+  8005ab:	50                   	push   %eax
+  8005ac:	53                   	push   %ebx
+  8005ad:	e8 ef fa ff ff       	call   8000a1 <touch_mem>
+  8005b2:	83 c4 08             	add    $0x8,%esp
+  8005b5:	eb d7                	jmp    80058e <sys_ipc_send_pages+0x14>
+
+008005b7 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8005b7:	55                   	push   %ebp
+  8005b8:	89 e5                	mov    %esp,%ebp
+  8005ba:	57                   	push   %edi
+  8005bb:	56                   	push   %esi
+  8005bc:	53                   	push   %ebx
+  8005bd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8005c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005cb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8005d0:	89 df                	mov    %ebx,%edi
+  8005d2:	89 de                	mov    %ebx,%esi
+  8005d4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8005d6:	85 c0                	test   %eax,%eax
+  8005d8:	7f 08                	jg     8005e2 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8005da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005dd:	5b                   	pop    %ebx
+  8005de:	5e                   	pop    %esi
+  8005df:	5f                   	pop    %edi
+  8005e0:	5d                   	pop    %ebp
+  8005e1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8005e2:	83 ec 0c             	sub    $0xc,%esp
+  8005e5:	50                   	push   %eax
+  8005e6:	6a 0d                	push   $0xd
+  8005e8:	68 aa 26 80 00       	push   $0x8026aa
+  8005ed:	6a 23                	push   $0x23
+  8005ef:	68 c7 26 80 00       	push   $0x8026c7
+  8005f4:	e8 16 11 00 00       	call   80170f <_panic>
+
+008005f9 <sys_ipc_recv>:
+{
+  8005f9:	55                   	push   %ebp
+  8005fa:	89 e5                	mov    %esp,%ebp
+  8005fc:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8005ff:	6a 01                	push   $0x1
+  800601:	ff 75 08             	push   0x8(%ebp)
+  800604:	e8 ae ff ff ff       	call   8005b7 <sys_ipc_recv_pages>
+}
+  800609:	c9                   	leave
+  80060a:	c3                   	ret
+
+0080060b <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80060b:	55                   	push   %ebp
+  80060c:	89 e5                	mov    %esp,%ebp
+  80060e:	57                   	push   %edi
+  80060f:	56                   	push   %esi
+  800610:	53                   	push   %ebx
+  800611:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800614:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800617:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  80061a:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800620:	77 04                	ja     800626 <sys_ipc_call+0x1b>
+  800622:	85 f6                	test   %esi,%esi
+  800624:	75 15                	jne    80063b <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  800626:	8b 55 08             	mov    0x8(%ebp),%edx
+  800629:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80062c:	b8 14 00 00 00       	mov    $0x14,%eax
+  800631:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  800633:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800636:	5b                   	pop    %ebx
+  800637:	5e                   	pop    %esi
+  800638:	5f                   	pop    %edi
+  800639:	5d                   	pop    %ebp
+  80063a:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80063b:	89 f8                	mov    %edi,%eax
+  80063d:	c1 e0 0c             	shl    $0xc,%eax
+  800640:	50                   	push   %eax
+  800641:	53                   	push   %ebx
+  800642:	e8 5a fa ff ff       	call   8000a1 <touch_mem>
+  800647:	83 c4 08             	add    $0x8,%esp
+  80064a:	eb da                	jmp    800626 <sys_ipc_call+0x1b>
+
+0080064c <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80064c:	55                   	push   %ebp
+  80064d:	89 e5                	mov    %esp,%ebp
+  80064f:	57                   	push   %edi
+  800650:	56                   	push   %esi
+  800651:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800652:	8b 55 08             	mov    0x8(%ebp),%edx
+  800655:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800658:	b8 15 00 00 00       	mov    $0x15,%eax
+  80065d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800660:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800663:	8b 75 18             	mov    0x18(%ebp),%esi
+  800666:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  800668:	5b                   	pop    %ebx
+  800669:	5e                   	pop    %esi
+  80066a:	5f                   	pop    %edi
+  80066b:	5d                   	pop    %ebp
+  80066c:	c3                   	ret
+
+0080066d <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  80066d:	55                   	push   %ebp
+  80066e:	89 e5                	mov    %esp,%ebp
+  800670:	57                   	push   %edi
+  800671:	56                   	push   %esi
+  800672:	53                   	push   %ebx
+  800673:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  800676:	6a 04                	push   $0x4
+  800678:	ff 75 08             	push   0x8(%ebp)
+  80067b:	e8 21 fa ff ff       	call   8000a1 <touch_mem>
+	asm volatile("int %1\n"
+  800680:	be 00 00 00 00       	mov    $0x0,%esi
+  800685:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800688:	b8 16 00 00 00       	mov    $0x16,%eax
+  80068d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800690:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800693:	89 f7                	mov    %esi,%edi
+  800695:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800697:	83 c4 08             	add    $0x8,%esp
+  80069a:	85 c0                	test   %eax,%eax
+  80069c:	7f 08                	jg     8006a6 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  80069e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006a1:	5b                   	pop    %ebx
+  8006a2:	5e                   	pop    %esi
+  8006a3:	5f                   	pop    %edi
+  8006a4:	5d                   	pop    %ebp
+  8006a5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006a6:	83 ec 0c             	sub    $0xc,%esp
+  8006a9:	50                   	push   %eax
+  8006aa:	6a 16                	push   $0x16
+  8006ac:	68 aa 26 80 00       	push   $0x8026aa
+  8006b1:	6a 23                	push   $0x23
+  8006b3:	68 c7 26 80 00       	push   $0x8026c7
+  8006b8:	e8 52 10 00 00       	call   80170f <_panic>
+
+008006bd <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8006bd:	55                   	push   %ebp
+  8006be:	89 e5                	mov    %esp,%ebp
+  8006c0:	57                   	push   %edi
+  8006c1:	56                   	push   %esi
+  8006c2:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8006c3:	6a 04                	push   $0x4
+  8006c5:	ff 75 08             	push   0x8(%ebp)
+  8006c8:	e8 d4 f9 ff ff       	call   8000a1 <touch_mem>
+	asm volatile("int %1\n"
+  8006cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006d5:	b8 17 00 00 00       	mov    $0x17,%eax
+  8006da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006dd:	89 df                	mov    %ebx,%edi
+  8006df:	89 de                	mov    %ebx,%esi
+  8006e1:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8006e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006e6:	5b                   	pop    %ebx
+  8006e7:	5e                   	pop    %esi
+  8006e8:	5f                   	pop    %edi
+  8006e9:	5d                   	pop    %ebp
+  8006ea:	c3                   	ret
+
+008006eb <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8006eb:	55                   	push   %ebp
+  8006ec:	89 e5                	mov    %esp,%ebp
+  8006ee:	57                   	push   %edi
+  8006ef:	56                   	push   %esi
+  8006f0:	53                   	push   %ebx
+  8006f1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8006f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006fc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800701:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800706:	89 df                	mov    %ebx,%edi
+  800708:	89 de                	mov    %ebx,%esi
+  80070a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80070c:	85 c0                	test   %eax,%eax
+  80070e:	7f 08                	jg     800718 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  800710:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800713:	5b                   	pop    %ebx
+  800714:	5e                   	pop    %esi
+  800715:	5f                   	pop    %edi
+  800716:	5d                   	pop    %ebp
+  800717:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800718:	83 ec 0c             	sub    $0xc,%esp
+  80071b:	50                   	push   %eax
+  80071c:	6a 0e                	push   $0xe
+  80071e:	68 aa 26 80 00       	push   $0x8026aa
+  800723:	6a 23                	push   $0x23
+  800725:	68 c7 26 80 00       	push   $0x8026c7
+  80072a:	e8 e0 0f 00 00       	call   80170f <_panic>
+
+0080072f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80072f:	55                   	push   %ebp
+  800730:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800732:	8b 45 08             	mov    0x8(%ebp),%eax
+  800735:	05 00 00 00 30       	add    $0x30000000,%eax
+  80073a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80073d:	5d                   	pop    %ebp
+  80073e:	c3                   	ret
+
+0080073f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80073f:	55                   	push   %ebp
+  800740:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800742:	8b 45 08             	mov    0x8(%ebp),%eax
+  800745:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80074a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80074f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800754:	5d                   	pop    %ebp
+  800755:	c3                   	ret
+
+00800756 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800756:	55                   	push   %ebp
+  800757:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  800759:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  80075e:	a8 01                	test   $0x1,%al
+  800760:	74 3c                	je     80079e <fd_alloc+0x48>
+  800762:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800767:	89 c2                	mov    %eax,%edx
+  800769:	c1 ea 0c             	shr    $0xc,%edx
+  80076c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800773:	89 c1                	mov    %eax,%ecx
+  800775:	05 00 10 00 00       	add    $0x1000,%eax
+  80077a:	f6 c2 01             	test   $0x1,%dl
+  80077d:	74 13                	je     800792 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80077f:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  800784:	75 e1                	jne    800767 <fd_alloc+0x11>
+  800786:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80078b:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  800790:	eb 05                	jmp    800797 <fd_alloc+0x41>
+			return 0;
+  800792:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  800797:	8b 55 08             	mov    0x8(%ebp),%edx
+  80079a:	89 0a                	mov    %ecx,(%edx)
+}
+  80079c:	5d                   	pop    %ebp
+  80079d:	c3                   	ret
+  80079e:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8007a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a8:	eb ed                	jmp    800797 <fd_alloc+0x41>
+
+008007aa <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8007aa:	55                   	push   %ebp
+  8007ab:	89 e5                	mov    %esp,%ebp
+  8007ad:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8007b0:	83 f8 1f             	cmp    $0x1f,%eax
+  8007b3:	77 30                	ja     8007e5 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8007b5:	c1 e0 0c             	shl    $0xc,%eax
+  8007b8:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8007bd:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8007c3:	f6 c2 01             	test   $0x1,%dl
+  8007c6:	74 24                	je     8007ec <fd_lookup+0x42>
+  8007c8:	89 c2                	mov    %eax,%edx
+  8007ca:	c1 ea 0c             	shr    $0xc,%edx
+  8007cd:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8007d4:	f6 c2 01             	test   $0x1,%dl
+  8007d7:	74 1a                	je     8007f3 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8007d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007dc:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8007de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007e3:	5d                   	pop    %ebp
+  8007e4:	c3                   	ret
+		return -E_INVAL;
+  8007e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007ea:	eb f7                	jmp    8007e3 <fd_lookup+0x39>
+		return -E_INVAL;
+  8007ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007f1:	eb f0                	jmp    8007e3 <fd_lookup+0x39>
+  8007f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007f8:	eb e9                	jmp    8007e3 <fd_lookup+0x39>
+
+008007fa <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8007fa:	55                   	push   %ebp
+  8007fb:	89 e5                	mov    %esp,%ebp
+  8007fd:	53                   	push   %ebx
+  8007fe:	83 ec 04             	sub    $0x4,%esp
+  800801:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800804:	b8 54 27 80 00       	mov    $0x802754,%eax
+  800809:	8b 18                	mov    (%eax),%ebx
+  80080b:	85 db                	test   %ebx,%ebx
+  80080d:	74 0e                	je     80081d <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  80080f:	83 c0 04             	add    $0x4,%eax
+  800812:	39 13                	cmp    %edx,(%ebx)
+  800814:	75 f3                	jne    800809 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  800816:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081b:	eb 1f                	jmp    80083c <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80081d:	a1 08 40 80 00       	mov    0x804008,%eax
+  800822:	8b 40 48             	mov    0x48(%eax),%eax
+  800825:	83 ec 04             	sub    $0x4,%esp
+  800828:	52                   	push   %edx
+  800829:	50                   	push   %eax
+  80082a:	68 d8 26 80 00       	push   $0x8026d8
+  80082f:	e8 b6 0f 00 00       	call   8017ea <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800834:	83 c4 10             	add    $0x10,%esp
+  800837:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80083c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80083f:	89 1a                	mov    %ebx,(%edx)
+}
+  800841:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800844:	c9                   	leave
+  800845:	c3                   	ret
+
+00800846 <fd_close>:
+{
+  800846:	55                   	push   %ebp
+  800847:	89 e5                	mov    %esp,%ebp
+  800849:	57                   	push   %edi
+  80084a:	56                   	push   %esi
+  80084b:	53                   	push   %ebx
+  80084c:	83 ec 24             	sub    $0x24,%esp
+  80084f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800852:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800855:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800858:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800859:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80085f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800862:	50                   	push   %eax
+  800863:	e8 42 ff ff ff       	call   8007aa <fd_lookup>
+  800868:	89 c3                	mov    %eax,%ebx
+  80086a:	83 c4 10             	add    $0x10,%esp
+  80086d:	85 c0                	test   %eax,%eax
+  80086f:	78 05                	js     800876 <fd_close+0x30>
+	    || fd != fd2)
+  800871:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800874:	74 16                	je     80088c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800876:	89 f8                	mov    %edi,%eax
+  800878:	84 c0                	test   %al,%al
+  80087a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800882:	89 d8                	mov    %ebx,%eax
+  800884:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800887:	5b                   	pop    %ebx
+  800888:	5e                   	pop    %esi
+  800889:	5f                   	pop    %edi
+  80088a:	5d                   	pop    %ebp
+  80088b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80088c:	83 ec 08             	sub    $0x8,%esp
+  80088f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800892:	50                   	push   %eax
+  800893:	ff 36                	push   (%esi)
+  800895:	e8 60 ff ff ff       	call   8007fa <dev_lookup>
+  80089a:	89 c3                	mov    %eax,%ebx
+  80089c:	83 c4 10             	add    $0x10,%esp
+  80089f:	85 c0                	test   %eax,%eax
+  8008a1:	78 1a                	js     8008bd <fd_close+0x77>
+		if (dev->dev_close)
+  8008a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008a6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8008a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8008ae:	85 c0                	test   %eax,%eax
+  8008b0:	74 0b                	je     8008bd <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8008b2:	83 ec 0c             	sub    $0xc,%esp
+  8008b5:	56                   	push   %esi
+  8008b6:	ff d0                	call   *%eax
+  8008b8:	89 c3                	mov    %eax,%ebx
+  8008ba:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8008bd:	83 ec 08             	sub    $0x8,%esp
+  8008c0:	56                   	push   %esi
+  8008c1:	6a 00                	push   $0x0
+  8008c3:	e8 51 f9 ff ff       	call   800219 <sys_page_unmap>
+	return r;
+  8008c8:	83 c4 10             	add    $0x10,%esp
+  8008cb:	eb b5                	jmp    800882 <fd_close+0x3c>
+
+008008cd <close>:
+
+int
+close(int fdnum)
+{
+  8008cd:	55                   	push   %ebp
+  8008ce:	89 e5                	mov    %esp,%ebp
+  8008d0:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8008d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008d6:	50                   	push   %eax
+  8008d7:	ff 75 08             	push   0x8(%ebp)
+  8008da:	e8 cb fe ff ff       	call   8007aa <fd_lookup>
+  8008df:	83 c4 10             	add    $0x10,%esp
+  8008e2:	85 c0                	test   %eax,%eax
+  8008e4:	79 02                	jns    8008e8 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8008e6:	c9                   	leave
+  8008e7:	c3                   	ret
+		return fd_close(fd, 1);
+  8008e8:	83 ec 08             	sub    $0x8,%esp
+  8008eb:	6a 01                	push   $0x1
+  8008ed:	ff 75 f4             	push   -0xc(%ebp)
+  8008f0:	e8 51 ff ff ff       	call   800846 <fd_close>
+  8008f5:	83 c4 10             	add    $0x10,%esp
+  8008f8:	eb ec                	jmp    8008e6 <close+0x19>
+
+008008fa <close_all>:
+
+void
+close_all(void)
+{
+  8008fa:	55                   	push   %ebp
+  8008fb:	89 e5                	mov    %esp,%ebp
+  8008fd:	53                   	push   %ebx
+  8008fe:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800901:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800906:	83 ec 0c             	sub    $0xc,%esp
+  800909:	53                   	push   %ebx
+  80090a:	e8 be ff ff ff       	call   8008cd <close>
+	for (i = 0; i < MAXFD; i++)
+  80090f:	83 c3 01             	add    $0x1,%ebx
+  800912:	83 c4 10             	add    $0x10,%esp
+  800915:	83 fb 20             	cmp    $0x20,%ebx
+  800918:	75 ec                	jne    800906 <close_all+0xc>
+}
+  80091a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80091d:	c9                   	leave
+  80091e:	c3                   	ret
+
+0080091f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80091f:	55                   	push   %ebp
+  800920:	89 e5                	mov    %esp,%ebp
+  800922:	57                   	push   %edi
+  800923:	56                   	push   %esi
+  800924:	53                   	push   %ebx
+  800925:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800928:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80092b:	50                   	push   %eax
+  80092c:	ff 75 08             	push   0x8(%ebp)
+  80092f:	e8 76 fe ff ff       	call   8007aa <fd_lookup>
+  800934:	89 c3                	mov    %eax,%ebx
+  800936:	83 c4 10             	add    $0x10,%esp
+  800939:	85 c0                	test   %eax,%eax
+  80093b:	78 7f                	js     8009bc <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80093d:	83 ec 0c             	sub    $0xc,%esp
+  800940:	ff 75 0c             	push   0xc(%ebp)
+  800943:	e8 85 ff ff ff       	call   8008cd <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800948:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80094b:	c1 e6 0c             	shl    $0xc,%esi
+  80094e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800954:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800957:	89 3c 24             	mov    %edi,(%esp)
+  80095a:	e8 e0 fd ff ff       	call   80073f <fd2data>
+  80095f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800961:	89 34 24             	mov    %esi,(%esp)
+  800964:	e8 d6 fd ff ff       	call   80073f <fd2data>
+  800969:	83 c4 10             	add    $0x10,%esp
+  80096c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80096f:	89 d8                	mov    %ebx,%eax
+  800971:	c1 e8 16             	shr    $0x16,%eax
+  800974:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80097b:	a8 01                	test   $0x1,%al
+  80097d:	74 11                	je     800990 <dup+0x71>
+  80097f:	89 d8                	mov    %ebx,%eax
+  800981:	c1 e8 0c             	shr    $0xc,%eax
+  800984:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80098b:	f6 c2 01             	test   $0x1,%dl
+  80098e:	75 36                	jne    8009c6 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800990:	89 f8                	mov    %edi,%eax
+  800992:	c1 e8 0c             	shr    $0xc,%eax
+  800995:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80099c:	83 ec 0c             	sub    $0xc,%esp
+  80099f:	25 07 0e 00 00       	and    $0xe07,%eax
+  8009a4:	50                   	push   %eax
+  8009a5:	56                   	push   %esi
+  8009a6:	6a 00                	push   $0x0
+  8009a8:	57                   	push   %edi
+  8009a9:	6a 00                	push   $0x0
+  8009ab:	e8 27 f8 ff ff       	call   8001d7 <sys_page_map>
+  8009b0:	89 c3                	mov    %eax,%ebx
+  8009b2:	83 c4 20             	add    $0x20,%esp
+  8009b5:	85 c0                	test   %eax,%eax
+  8009b7:	78 33                	js     8009ec <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8009b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8009bc:	89 d8                	mov    %ebx,%eax
+  8009be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009c1:	5b                   	pop    %ebx
+  8009c2:	5e                   	pop    %esi
+  8009c3:	5f                   	pop    %edi
+  8009c4:	5d                   	pop    %ebp
+  8009c5:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8009c6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8009cd:	83 ec 0c             	sub    $0xc,%esp
+  8009d0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8009d5:	50                   	push   %eax
+  8009d6:	ff 75 d4             	push   -0x2c(%ebp)
+  8009d9:	6a 00                	push   $0x0
+  8009db:	53                   	push   %ebx
+  8009dc:	6a 00                	push   $0x0
+  8009de:	e8 f4 f7 ff ff       	call   8001d7 <sys_page_map>
+  8009e3:	89 c3                	mov    %eax,%ebx
+  8009e5:	83 c4 20             	add    $0x20,%esp
+  8009e8:	85 c0                	test   %eax,%eax
+  8009ea:	79 a4                	jns    800990 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8009ec:	83 ec 08             	sub    $0x8,%esp
+  8009ef:	56                   	push   %esi
+  8009f0:	6a 00                	push   $0x0
+  8009f2:	e8 22 f8 ff ff       	call   800219 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8009f7:	83 c4 08             	add    $0x8,%esp
+  8009fa:	ff 75 d4             	push   -0x2c(%ebp)
+  8009fd:	6a 00                	push   $0x0
+  8009ff:	e8 15 f8 ff ff       	call   800219 <sys_page_unmap>
+	return r;
+  800a04:	83 c4 10             	add    $0x10,%esp
+  800a07:	eb b3                	jmp    8009bc <dup+0x9d>
+
+00800a09 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800a09:	55                   	push   %ebp
+  800a0a:	89 e5                	mov    %esp,%ebp
+  800a0c:	56                   	push   %esi
+  800a0d:	53                   	push   %ebx
+  800a0e:	83 ec 18             	sub    $0x18,%esp
+  800a11:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a14:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a17:	50                   	push   %eax
+  800a18:	56                   	push   %esi
+  800a19:	e8 8c fd ff ff       	call   8007aa <fd_lookup>
+  800a1e:	83 c4 10             	add    $0x10,%esp
+  800a21:	85 c0                	test   %eax,%eax
+  800a23:	78 3c                	js     800a61 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a25:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a28:	83 ec 08             	sub    $0x8,%esp
+  800a2b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a2e:	50                   	push   %eax
+  800a2f:	ff 33                	push   (%ebx)
+  800a31:	e8 c4 fd ff ff       	call   8007fa <dev_lookup>
+  800a36:	83 c4 10             	add    $0x10,%esp
+  800a39:	85 c0                	test   %eax,%eax
+  800a3b:	78 24                	js     800a61 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a3d:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a40:	83 e0 03             	and    $0x3,%eax
+  800a43:	83 f8 01             	cmp    $0x1,%eax
+  800a46:	74 20                	je     800a68 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800a48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a4b:	8b 40 08             	mov    0x8(%eax),%eax
+  800a4e:	85 c0                	test   %eax,%eax
+  800a50:	74 37                	je     800a89 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800a52:	83 ec 04             	sub    $0x4,%esp
+  800a55:	ff 75 10             	push   0x10(%ebp)
+  800a58:	ff 75 0c             	push   0xc(%ebp)
+  800a5b:	53                   	push   %ebx
+  800a5c:	ff d0                	call   *%eax
+  800a5e:	83 c4 10             	add    $0x10,%esp
+}
+  800a61:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a64:	5b                   	pop    %ebx
+  800a65:	5e                   	pop    %esi
+  800a66:	5d                   	pop    %ebp
+  800a67:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a68:	a1 08 40 80 00       	mov    0x804008,%eax
+  800a6d:	8b 40 48             	mov    0x48(%eax),%eax
+  800a70:	83 ec 04             	sub    $0x4,%esp
+  800a73:	56                   	push   %esi
+  800a74:	50                   	push   %eax
+  800a75:	68 19 27 80 00       	push   $0x802719
+  800a7a:	e8 6b 0d 00 00       	call   8017ea <cprintf>
+		return -E_INVAL;
+  800a7f:	83 c4 10             	add    $0x10,%esp
+  800a82:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a87:	eb d8                	jmp    800a61 <read+0x58>
+		return -E_NOT_SUPP;
+  800a89:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a8e:	eb d1                	jmp    800a61 <read+0x58>
+
+00800a90 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a90:	55                   	push   %ebp
+  800a91:	89 e5                	mov    %esp,%ebp
+  800a93:	57                   	push   %edi
+  800a94:	56                   	push   %esi
+  800a95:	53                   	push   %ebx
+  800a96:	83 ec 0c             	sub    $0xc,%esp
+  800a99:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a9c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800a9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800aa4:	eb 02                	jmp    800aa8 <readn+0x18>
+  800aa6:	01 c3                	add    %eax,%ebx
+  800aa8:	39 f3                	cmp    %esi,%ebx
+  800aaa:	73 21                	jae    800acd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800aac:	83 ec 04             	sub    $0x4,%esp
+  800aaf:	89 f0                	mov    %esi,%eax
+  800ab1:	29 d8                	sub    %ebx,%eax
+  800ab3:	50                   	push   %eax
+  800ab4:	89 d8                	mov    %ebx,%eax
+  800ab6:	03 45 0c             	add    0xc(%ebp),%eax
+  800ab9:	50                   	push   %eax
+  800aba:	57                   	push   %edi
+  800abb:	e8 49 ff ff ff       	call   800a09 <read>
+		if (m < 0)
+  800ac0:	83 c4 10             	add    $0x10,%esp
+  800ac3:	85 c0                	test   %eax,%eax
+  800ac5:	78 04                	js     800acb <readn+0x3b>
+			return m;
+		if (m == 0)
+  800ac7:	75 dd                	jne    800aa6 <readn+0x16>
+  800ac9:	eb 02                	jmp    800acd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800acb:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800acd:	89 d8                	mov    %ebx,%eax
+  800acf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ad2:	5b                   	pop    %ebx
+  800ad3:	5e                   	pop    %esi
+  800ad4:	5f                   	pop    %edi
+  800ad5:	5d                   	pop    %ebp
+  800ad6:	c3                   	ret
+
+00800ad7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	56                   	push   %esi
+  800adb:	53                   	push   %ebx
+  800adc:	83 ec 18             	sub    $0x18,%esp
+  800adf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800ae2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ae5:	50                   	push   %eax
+  800ae6:	53                   	push   %ebx
+  800ae7:	e8 be fc ff ff       	call   8007aa <fd_lookup>
+  800aec:	83 c4 10             	add    $0x10,%esp
+  800aef:	85 c0                	test   %eax,%eax
+  800af1:	78 37                	js     800b2a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800af3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800af6:	83 ec 08             	sub    $0x8,%esp
+  800af9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800afc:	50                   	push   %eax
+  800afd:	ff 36                	push   (%esi)
+  800aff:	e8 f6 fc ff ff       	call   8007fa <dev_lookup>
+  800b04:	83 c4 10             	add    $0x10,%esp
+  800b07:	85 c0                	test   %eax,%eax
+  800b09:	78 1f                	js     800b2a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b0b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b0f:	74 20                	je     800b31 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800b11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b14:	8b 40 0c             	mov    0xc(%eax),%eax
+  800b17:	85 c0                	test   %eax,%eax
+  800b19:	74 37                	je     800b52 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800b1b:	83 ec 04             	sub    $0x4,%esp
+  800b1e:	ff 75 10             	push   0x10(%ebp)
+  800b21:	ff 75 0c             	push   0xc(%ebp)
+  800b24:	56                   	push   %esi
+  800b25:	ff d0                	call   *%eax
+  800b27:	83 c4 10             	add    $0x10,%esp
+}
+  800b2a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b2d:	5b                   	pop    %ebx
+  800b2e:	5e                   	pop    %esi
+  800b2f:	5d                   	pop    %ebp
+  800b30:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b31:	a1 08 40 80 00       	mov    0x804008,%eax
+  800b36:	8b 40 48             	mov    0x48(%eax),%eax
+  800b39:	83 ec 04             	sub    $0x4,%esp
+  800b3c:	53                   	push   %ebx
+  800b3d:	50                   	push   %eax
+  800b3e:	68 35 27 80 00       	push   $0x802735
+  800b43:	e8 a2 0c 00 00       	call   8017ea <cprintf>
+		return -E_INVAL;
+  800b48:	83 c4 10             	add    $0x10,%esp
+  800b4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b50:	eb d8                	jmp    800b2a <write+0x53>
+		return -E_NOT_SUPP;
+  800b52:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b57:	eb d1                	jmp    800b2a <write+0x53>
+
+00800b59 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b59:	55                   	push   %ebp
+  800b5a:	89 e5                	mov    %esp,%ebp
+  800b5c:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b5f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b62:	50                   	push   %eax
+  800b63:	ff 75 08             	push   0x8(%ebp)
+  800b66:	e8 3f fc ff ff       	call   8007aa <fd_lookup>
+  800b6b:	83 c4 10             	add    $0x10,%esp
+  800b6e:	85 c0                	test   %eax,%eax
+  800b70:	78 0e                	js     800b80 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b72:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b78:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b80:	c9                   	leave
+  800b81:	c3                   	ret
+
+00800b82 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	56                   	push   %esi
+  800b86:	53                   	push   %ebx
+  800b87:	83 ec 18             	sub    $0x18,%esp
+  800b8a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b8d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b90:	50                   	push   %eax
+  800b91:	53                   	push   %ebx
+  800b92:	e8 13 fc ff ff       	call   8007aa <fd_lookup>
+  800b97:	83 c4 10             	add    $0x10,%esp
+  800b9a:	85 c0                	test   %eax,%eax
+  800b9c:	78 34                	js     800bd2 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b9e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800ba1:	83 ec 08             	sub    $0x8,%esp
+  800ba4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ba7:	50                   	push   %eax
+  800ba8:	ff 36                	push   (%esi)
+  800baa:	e8 4b fc ff ff       	call   8007fa <dev_lookup>
+  800baf:	83 c4 10             	add    $0x10,%esp
+  800bb2:	85 c0                	test   %eax,%eax
+  800bb4:	78 1c                	js     800bd2 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bb6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800bba:	74 1d                	je     800bd9 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800bbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bbf:	8b 40 18             	mov    0x18(%eax),%eax
+  800bc2:	85 c0                	test   %eax,%eax
+  800bc4:	74 34                	je     800bfa <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800bc6:	83 ec 08             	sub    $0x8,%esp
+  800bc9:	ff 75 0c             	push   0xc(%ebp)
+  800bcc:	56                   	push   %esi
+  800bcd:	ff d0                	call   *%eax
+  800bcf:	83 c4 10             	add    $0x10,%esp
+}
+  800bd2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bd5:	5b                   	pop    %ebx
+  800bd6:	5e                   	pop    %esi
+  800bd7:	5d                   	pop    %ebp
+  800bd8:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800bd9:	a1 08 40 80 00       	mov    0x804008,%eax
+  800bde:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800be1:	83 ec 04             	sub    $0x4,%esp
+  800be4:	53                   	push   %ebx
+  800be5:	50                   	push   %eax
+  800be6:	68 f8 26 80 00       	push   $0x8026f8
+  800beb:	e8 fa 0b 00 00       	call   8017ea <cprintf>
+		return -E_INVAL;
+  800bf0:	83 c4 10             	add    $0x10,%esp
+  800bf3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bf8:	eb d8                	jmp    800bd2 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800bfa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bff:	eb d1                	jmp    800bd2 <ftruncate+0x50>
+
+00800c01 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800c01:	55                   	push   %ebp
+  800c02:	89 e5                	mov    %esp,%ebp
+  800c04:	56                   	push   %esi
+  800c05:	53                   	push   %ebx
+  800c06:	83 ec 18             	sub    $0x18,%esp
+  800c09:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c0c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c0f:	50                   	push   %eax
+  800c10:	ff 75 08             	push   0x8(%ebp)
+  800c13:	e8 92 fb ff ff       	call   8007aa <fd_lookup>
+  800c18:	83 c4 10             	add    $0x10,%esp
+  800c1b:	85 c0                	test   %eax,%eax
+  800c1d:	78 49                	js     800c68 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c1f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c22:	83 ec 08             	sub    $0x8,%esp
+  800c25:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c28:	50                   	push   %eax
+  800c29:	ff 36                	push   (%esi)
+  800c2b:	e8 ca fb ff ff       	call   8007fa <dev_lookup>
+  800c30:	83 c4 10             	add    $0x10,%esp
+  800c33:	85 c0                	test   %eax,%eax
+  800c35:	78 31                	js     800c68 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c3a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c3e:	74 2f                	je     800c6f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c40:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c43:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c4a:	00 00 00 
+	stat->st_isdir = 0;
+  800c4d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c54:	00 00 00 
+	stat->st_dev = dev;
+  800c57:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c5d:	83 ec 08             	sub    $0x8,%esp
+  800c60:	53                   	push   %ebx
+  800c61:	56                   	push   %esi
+  800c62:	ff 50 14             	call   *0x14(%eax)
+  800c65:	83 c4 10             	add    $0x10,%esp
+}
+  800c68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c6b:	5b                   	pop    %ebx
+  800c6c:	5e                   	pop    %esi
+  800c6d:	5d                   	pop    %ebp
+  800c6e:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c6f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c74:	eb f2                	jmp    800c68 <fstat+0x67>
+
+00800c76 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c76:	55                   	push   %ebp
+  800c77:	89 e5                	mov    %esp,%ebp
+  800c79:	56                   	push   %esi
+  800c7a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c7b:	83 ec 08             	sub    $0x8,%esp
+  800c7e:	6a 00                	push   $0x0
+  800c80:	ff 75 08             	push   0x8(%ebp)
+  800c83:	e8 bc 02 00 00       	call   800f44 <open>
+  800c88:	89 c3                	mov    %eax,%ebx
+  800c8a:	83 c4 10             	add    $0x10,%esp
+  800c8d:	85 c0                	test   %eax,%eax
+  800c8f:	78 1b                	js     800cac <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c91:	83 ec 08             	sub    $0x8,%esp
+  800c94:	ff 75 0c             	push   0xc(%ebp)
+  800c97:	50                   	push   %eax
+  800c98:	e8 64 ff ff ff       	call   800c01 <fstat>
+  800c9d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c9f:	89 1c 24             	mov    %ebx,(%esp)
+  800ca2:	e8 26 fc ff ff       	call   8008cd <close>
+	return r;
+  800ca7:	83 c4 10             	add    $0x10,%esp
+  800caa:	89 f3                	mov    %esi,%ebx
+}
+  800cac:	89 d8                	mov    %ebx,%eax
+  800cae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800cb1:	5b                   	pop    %ebx
+  800cb2:	5e                   	pop    %esi
+  800cb3:	5d                   	pop    %ebp
+  800cb4:	c3                   	ret
+
+00800cb5 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  800cb5:	55                   	push   %ebp
+  800cb6:	89 e5                	mov    %esp,%ebp
+  800cb8:	57                   	push   %edi
+  800cb9:	56                   	push   %esi
+  800cba:	53                   	push   %ebx
+  800cbb:	83 ec 0c             	sub    $0xc,%esp
+  800cbe:	89 c7                	mov    %eax,%edi
+  800cc0:	89 d3                	mov    %edx,%ebx
+  800cc2:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800cc4:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800ccb:	74 2d                	je     800cfa <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800ccd:	6a 07                	push   $0x7
+  800ccf:	68 00 50 80 00       	push   $0x805000
+  800cd4:	57                   	push   %edi
+  800cd5:	ff 35 00 40 80 00    	push   0x804000
+  800cdb:	e8 3f 16 00 00       	call   80231f <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  800ce0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800ce7:	6a 00                	push   $0x0
+  800ce9:	56                   	push   %esi
+  800cea:	53                   	push   %ebx
+  800ceb:	6a 00                	push   $0x0
+  800ced:	e8 df 14 00 00       	call   8021d1 <ipc_recv_pages>
+}
+  800cf2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf5:	5b                   	pop    %ebx
+  800cf6:	5e                   	pop    %esi
+  800cf7:	5f                   	pop    %edi
+  800cf8:	5d                   	pop    %ebp
+  800cf9:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800cfa:	83 ec 0c             	sub    $0xc,%esp
+  800cfd:	6a 01                	push   $0x1
+  800cff:	e8 10 17 00 00       	call   802414 <ipc_find_env>
+  800d04:	a3 00 40 80 00       	mov    %eax,0x804000
+  800d09:	83 c4 10             	add    $0x10,%esp
+  800d0c:	eb bf                	jmp    800ccd <fsipc_pages+0x18>
+
+00800d0e <fsipc>:
+{
+  800d0e:	55                   	push   %ebp
+  800d0f:	89 e5                	mov    %esp,%ebp
+  800d11:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  800d14:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d19:	e8 97 ff ff ff       	call   800cb5 <fsipc_pages>
+}
+  800d1e:	c9                   	leave
+  800d1f:	c3                   	ret
+
+00800d20 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d20:	55                   	push   %ebp
+  800d21:	89 e5                	mov    %esp,%ebp
+  800d23:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d26:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d29:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d2c:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800d31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d34:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800d39:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d3e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d43:	e8 c6 ff ff ff       	call   800d0e <fsipc>
+}
+  800d48:	c9                   	leave
+  800d49:	c3                   	ret
+
+00800d4a <devfile_flush>:
+{
+  800d4a:	55                   	push   %ebp
+  800d4b:	89 e5                	mov    %esp,%ebp
+  800d4d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d50:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d53:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d56:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800d5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d60:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d65:	e8 a4 ff ff ff       	call   800d0e <fsipc>
+}
+  800d6a:	c9                   	leave
+  800d6b:	c3                   	ret
+
+00800d6c <devfile_stat>:
+{
+  800d6c:	55                   	push   %ebp
+  800d6d:	89 e5                	mov    %esp,%ebp
+  800d6f:	53                   	push   %ebx
+  800d70:	83 ec 04             	sub    $0x4,%esp
+  800d73:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d76:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d79:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d7c:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800d81:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d86:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d8b:	e8 7e ff ff ff       	call   800d0e <fsipc>
+  800d90:	85 c0                	test   %eax,%eax
+  800d92:	78 2c                	js     800dc0 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800d94:	83 ec 08             	sub    $0x8,%esp
+  800d97:	68 00 50 80 00       	push   $0x805000
+  800d9c:	53                   	push   %ebx
+  800d9d:	e8 2f 10 00 00       	call   801dd1 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800da2:	a1 80 50 80 00       	mov    0x805080,%eax
+  800da7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800dad:	a1 84 50 80 00       	mov    0x805084,%eax
+  800db2:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800db8:	83 c4 10             	add    $0x10,%esp
+  800dbb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dc0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dc3:	c9                   	leave
+  800dc4:	c3                   	ret
+
+00800dc5 <devfile_write>:
+{
+  800dc5:	55                   	push   %ebp
+  800dc6:	89 e5                	mov    %esp,%ebp
+  800dc8:	83 ec 0c             	sub    $0xc,%esp
+  800dcb:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800dce:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800dd3:	39 d0                	cmp    %edx,%eax
+  800dd5:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800dd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddb:	8b 52 0c             	mov    0xc(%edx),%edx
+  800dde:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  800de4:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800de9:	50                   	push   %eax
+  800dea:	ff 75 0c             	push   0xc(%ebp)
+  800ded:	68 08 50 80 00       	push   $0x805008
+  800df2:	e8 60 11 00 00       	call   801f57 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800df7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dfc:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e01:	e8 08 ff ff ff       	call   800d0e <fsipc>
+}
+  800e06:	c9                   	leave
+  800e07:	c3                   	ret
+
+00800e08 <devfile_read>:
+{
+  800e08:	55                   	push   %ebp
+  800e09:	89 e5                	mov    %esp,%ebp
+  800e0b:	57                   	push   %edi
+  800e0c:	56                   	push   %esi
+  800e0d:	53                   	push   %ebx
+  800e0e:	83 ec 1c             	sub    $0x1c,%esp
+  800e11:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e14:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e17:	89 fe                	mov    %edi,%esi
+  800e19:	c1 ee 0c             	shr    $0xc,%esi
+  800e1c:	b8 20 00 00 00       	mov    $0x20,%eax
+  800e21:	39 c6                	cmp    %eax,%esi
+  800e23:	0f 47 f0             	cmova  %eax,%esi
+  800e26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e29:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e2e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  800e31:	eb 14                	jmp    800e47 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e33:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  800e3a:	05 00 10 00 00       	add    $0x1000,%eax
+  800e3f:	f6 c6 06             	test   $0x6,%dh
+  800e42:	75 42                	jne    800e86 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e44:	83 c1 01             	add    $0x1,%ecx
+  800e47:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800e4a:	39 f1                	cmp    %esi,%ecx
+  800e4c:	0f 84 95 00 00 00    	je     800ee7 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e52:	89 c2                	mov    %eax,%edx
+  800e54:	c1 ea 16             	shr    $0x16,%edx
+  800e57:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e5e:	f6 c2 01             	test   $0x1,%dl
+  800e61:	74 23                	je     800e86 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e63:	89 c2                	mov    %eax,%edx
+  800e65:	c1 ea 0c             	shr    $0xc,%edx
+  800e68:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800e6f:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  800e75:	74 0f                	je     800e86 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  800e77:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800e7e:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  800e84:	75 ad                	jne    800e33 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  800e86:	85 c9                	test   %ecx,%ecx
+  800e88:	74 11                	je     800e9b <devfile_read+0x93>
+  800e8a:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  800e91:	75 08                	jne    800e9b <devfile_read+0x93>
+  800e93:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  800e99:	74 50                	je     800eeb <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800e9b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800e9e:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  800ea3:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800ea9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eae:	b8 03 00 00 00       	mov    $0x3,%eax
+  800eb3:	e8 56 fe ff ff       	call   800d0e <fsipc>
+  800eb8:	89 c6                	mov    %eax,%esi
+  800eba:	85 c0                	test   %eax,%eax
+  800ebc:	78 1f                	js     800edd <devfile_read+0xd5>
+	assert(r <= n);
+  800ebe:	39 c7                	cmp    %eax,%edi
+  800ec0:	72 50                	jb     800f12 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  800ec2:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800ec7:	7f 62                	jg     800f2b <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  800ec9:	83 ec 04             	sub    $0x4,%esp
+  800ecc:	50                   	push   %eax
+  800ecd:	68 00 50 80 00       	push   $0x805000
+  800ed2:	ff 75 0c             	push   0xc(%ebp)
+  800ed5:	e8 7d 10 00 00       	call   801f57 <memmove>
+	return r;
+  800eda:	83 c4 10             	add    $0x10,%esp
+}
+  800edd:	89 f0                	mov    %esi,%eax
+  800edf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee2:	5b                   	pop    %ebx
+  800ee3:	5e                   	pop    %esi
+  800ee4:	5f                   	pop    %edi
+  800ee5:	5d                   	pop    %ebp
+  800ee6:	c3                   	ret
+  800ee7:	89 f1                	mov    %esi,%ecx
+  800ee9:	eb 9b                	jmp    800e86 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  800eeb:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800eee:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  800ef3:	89 c8                	mov    %ecx,%eax
+  800ef5:	c1 e0 0c             	shl    $0xc,%eax
+  800ef8:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  800efd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f00:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f05:	e8 ab fd ff ff       	call   800cb5 <fsipc_pages>
+  800f0a:	89 c6                	mov    %eax,%esi
+  800f0c:	85 c0                	test   %eax,%eax
+  800f0e:	78 8b                	js     800e9b <devfile_read+0x93>
+  800f10:	eb cb                	jmp    800edd <devfile_read+0xd5>
+	assert(r <= n);
+  800f12:	68 64 27 80 00       	push   $0x802764
+  800f17:	68 6b 27 80 00       	push   $0x80276b
+  800f1c:	68 a0 00 00 00       	push   $0xa0
+  800f21:	68 80 27 80 00       	push   $0x802780
+  800f26:	e8 e4 07 00 00       	call   80170f <_panic>
+	assert(r <= PGSIZE);
+  800f2b:	68 8b 27 80 00       	push   $0x80278b
+  800f30:	68 6b 27 80 00       	push   $0x80276b
+  800f35:	68 a1 00 00 00       	push   $0xa1
+  800f3a:	68 80 27 80 00       	push   $0x802780
+  800f3f:	e8 cb 07 00 00       	call   80170f <_panic>
+
+00800f44 <open>:
+{
+  800f44:	55                   	push   %ebp
+  800f45:	89 e5                	mov    %esp,%ebp
+  800f47:	56                   	push   %esi
+  800f48:	53                   	push   %ebx
+  800f49:	83 ec 1c             	sub    $0x1c,%esp
+  800f4c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800f4f:	56                   	push   %esi
+  800f50:	e8 41 0e 00 00       	call   801d96 <strlen>
+  800f55:	83 c4 10             	add    $0x10,%esp
+  800f58:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f5d:	7f 6c                	jg     800fcb <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800f5f:	83 ec 0c             	sub    $0xc,%esp
+  800f62:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f65:	50                   	push   %eax
+  800f66:	e8 eb f7 ff ff       	call   800756 <fd_alloc>
+  800f6b:	89 c3                	mov    %eax,%ebx
+  800f6d:	83 c4 10             	add    $0x10,%esp
+  800f70:	85 c0                	test   %eax,%eax
+  800f72:	78 3c                	js     800fb0 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800f74:	83 ec 08             	sub    $0x8,%esp
+  800f77:	56                   	push   %esi
+  800f78:	68 00 50 80 00       	push   $0x805000
+  800f7d:	e8 4f 0e 00 00       	call   801dd1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800f82:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f85:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800f8a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800f8d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f92:	e8 77 fd ff ff       	call   800d0e <fsipc>
+  800f97:	89 c3                	mov    %eax,%ebx
+  800f99:	83 c4 10             	add    $0x10,%esp
+  800f9c:	85 c0                	test   %eax,%eax
+  800f9e:	78 19                	js     800fb9 <open+0x75>
+	return fd2num(fd);
+  800fa0:	83 ec 0c             	sub    $0xc,%esp
+  800fa3:	ff 75 f4             	push   -0xc(%ebp)
+  800fa6:	e8 84 f7 ff ff       	call   80072f <fd2num>
+  800fab:	89 c3                	mov    %eax,%ebx
+  800fad:	83 c4 10             	add    $0x10,%esp
+}
+  800fb0:	89 d8                	mov    %ebx,%eax
+  800fb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fb5:	5b                   	pop    %ebx
+  800fb6:	5e                   	pop    %esi
+  800fb7:	5d                   	pop    %ebp
+  800fb8:	c3                   	ret
+		fd_close(fd, 0);
+  800fb9:	83 ec 08             	sub    $0x8,%esp
+  800fbc:	6a 00                	push   $0x0
+  800fbe:	ff 75 f4             	push   -0xc(%ebp)
+  800fc1:	e8 80 f8 ff ff       	call   800846 <fd_close>
+		return r;
+  800fc6:	83 c4 10             	add    $0x10,%esp
+  800fc9:	eb e5                	jmp    800fb0 <open+0x6c>
+		return -E_BAD_PATH;
+  800fcb:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800fd0:	eb de                	jmp    800fb0 <open+0x6c>
+
+00800fd2 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800fd2:	55                   	push   %ebp
+  800fd3:	89 e5                	mov    %esp,%ebp
+  800fd5:	53                   	push   %ebx
+  800fd6:	83 ec 10             	sub    $0x10,%esp
+  800fd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  800fdc:	53                   	push   %ebx
+  800fdd:	e8 b4 0d 00 00       	call   801d96 <strlen>
+  800fe2:	83 c4 10             	add    $0x10,%esp
+  800fe5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800fea:	7f 25                	jg     801011 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  800fec:	83 ec 08             	sub    $0x8,%esp
+  800fef:	53                   	push   %ebx
+  800ff0:	68 00 50 80 00       	push   $0x805000
+  800ff5:	e8 d7 0d 00 00       	call   801dd1 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  800ffa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fff:	b8 07 00 00 00       	mov    $0x7,%eax
+  801004:	e8 05 fd ff ff       	call   800d0e <fsipc>
+  801009:	83 c4 10             	add    $0x10,%esp
+}
+  80100c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80100f:	c9                   	leave
+  801010:	c3                   	ret
+		return -E_BAD_PATH;
+  801011:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801016:	eb f4                	jmp    80100c <remove+0x3a>
+
+00801018 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801018:	55                   	push   %ebp
+  801019:	89 e5                	mov    %esp,%ebp
+  80101b:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80101e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801023:	b8 08 00 00 00       	mov    $0x8,%eax
+  801028:	e8 e1 fc ff ff       	call   800d0e <fsipc>
+}
+  80102d:	c9                   	leave
+  80102e:	c3                   	ret
+
+0080102f <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  80102f:	55                   	push   %ebp
+  801030:	89 e5                	mov    %esp,%ebp
+  801032:	53                   	push   %ebx
+  801033:	83 ec 04             	sub    $0x4,%esp
+  801036:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801039:	ba 00 00 00 00       	mov    $0x0,%edx
+  80103e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801043:	e8 c6 fc ff ff       	call   800d0e <fsipc>
+  801048:	85 c0                	test   %eax,%eax
+  80104a:	78 3c                	js     801088 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  80104c:	a1 00 50 80 00       	mov    0x805000,%eax
+  801051:	89 03                	mov    %eax,(%ebx)
+  801053:	a1 04 50 80 00       	mov    0x805004,%eax
+  801058:	89 43 04             	mov    %eax,0x4(%ebx)
+  80105b:	a1 08 50 80 00       	mov    0x805008,%eax
+  801060:	89 43 08             	mov    %eax,0x8(%ebx)
+  801063:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801068:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80106b:	a1 10 50 80 00       	mov    0x805010,%eax
+  801070:	89 43 10             	mov    %eax,0x10(%ebx)
+  801073:	a1 14 50 80 00       	mov    0x805014,%eax
+  801078:	89 43 14             	mov    %eax,0x14(%ebx)
+  80107b:	a1 18 50 80 00       	mov    0x805018,%eax
+  801080:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801083:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801088:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80108b:	c9                   	leave
+  80108c:	c3                   	ret
+
+0080108d <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  80108d:	55                   	push   %ebp
+  80108e:	89 e5                	mov    %esp,%ebp
+  801090:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801093:	8b 45 08             	mov    0x8(%ebp),%eax
+  801096:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  80109b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010a5:	e8 64 fc ff ff       	call   800d0e <fsipc>
+}
+  8010aa:	c9                   	leave
+  8010ab:	c3                   	ret
+
+008010ac <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8010ac:	55                   	push   %ebp
+  8010ad:	89 e5                	mov    %esp,%ebp
+  8010af:	56                   	push   %esi
+  8010b0:	53                   	push   %ebx
+  8010b1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8010b4:	83 ec 0c             	sub    $0xc,%esp
+  8010b7:	ff 75 08             	push   0x8(%ebp)
+  8010ba:	e8 80 f6 ff ff       	call   80073f <fd2data>
+  8010bf:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8010c1:	83 c4 08             	add    $0x8,%esp
+  8010c4:	68 97 27 80 00       	push   $0x802797
+  8010c9:	53                   	push   %ebx
+  8010ca:	e8 02 0d 00 00       	call   801dd1 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8010cf:	8b 46 04             	mov    0x4(%esi),%eax
+  8010d2:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8010d8:	2b 0e                	sub    (%esi),%ecx
+  8010da:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8010df:	89 c8                	mov    %ecx,%eax
+  8010e1:	f7 e2                	mul    %edx
+  8010e3:	c1 ea 0c             	shr    $0xc,%edx
+  8010e6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8010ec:	29 d1                	sub    %edx,%ecx
+  8010ee:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8010f4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8010fb:	00 00 00 
+	stat->st_dev = &devpipe;
+  8010fe:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  801105:	30 80 00 
+	return 0;
+}
+  801108:	b8 00 00 00 00       	mov    $0x0,%eax
+  80110d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801110:	5b                   	pop    %ebx
+  801111:	5e                   	pop    %esi
+  801112:	5d                   	pop    %ebp
+  801113:	c3                   	ret
+
+00801114 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801114:	55                   	push   %ebp
+  801115:	89 e5                	mov    %esp,%ebp
+  801117:	53                   	push   %ebx
+  801118:	83 ec 0c             	sub    $0xc,%esp
+  80111b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80111e:	53                   	push   %ebx
+  80111f:	6a 00                	push   $0x0
+  801121:	e8 f3 f0 ff ff       	call   800219 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801126:	89 1c 24             	mov    %ebx,(%esp)
+  801129:	e8 11 f6 ff ff       	call   80073f <fd2data>
+  80112e:	83 c4 08             	add    $0x8,%esp
+  801131:	50                   	push   %eax
+  801132:	6a 00                	push   $0x0
+  801134:	e8 e0 f0 ff ff       	call   800219 <sys_page_unmap>
+}
+  801139:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80113c:	c9                   	leave
+  80113d:	c3                   	ret
+
+0080113e <_pipeisclosed>:
+{
+  80113e:	55                   	push   %ebp
+  80113f:	89 e5                	mov    %esp,%ebp
+  801141:	57                   	push   %edi
+  801142:	56                   	push   %esi
+  801143:	53                   	push   %ebx
+  801144:	83 ec 1c             	sub    $0x1c,%esp
+  801147:	89 c7                	mov    %eax,%edi
+  801149:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80114b:	a1 08 40 80 00       	mov    0x804008,%eax
+  801150:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801153:	83 ec 0c             	sub    $0xc,%esp
+  801156:	57                   	push   %edi
+  801157:	e8 f7 12 00 00       	call   802453 <pageref>
+  80115c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80115f:	89 34 24             	mov    %esi,(%esp)
+  801162:	e8 ec 12 00 00       	call   802453 <pageref>
+		nn = thisenv->env_runs;
+  801167:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  80116d:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801170:	83 c4 10             	add    $0x10,%esp
+  801173:	39 cb                	cmp    %ecx,%ebx
+  801175:	74 1b                	je     801192 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801177:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80117a:	75 cf                	jne    80114b <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80117c:	8b 42 58             	mov    0x58(%edx),%eax
+  80117f:	6a 01                	push   $0x1
+  801181:	50                   	push   %eax
+  801182:	53                   	push   %ebx
+  801183:	68 9e 27 80 00       	push   $0x80279e
+  801188:	e8 5d 06 00 00       	call   8017ea <cprintf>
+  80118d:	83 c4 10             	add    $0x10,%esp
+  801190:	eb b9                	jmp    80114b <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801192:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801195:	0f 94 c0             	sete   %al
+  801198:	0f b6 c0             	movzbl %al,%eax
+}
+  80119b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80119e:	5b                   	pop    %ebx
+  80119f:	5e                   	pop    %esi
+  8011a0:	5f                   	pop    %edi
+  8011a1:	5d                   	pop    %ebp
+  8011a2:	c3                   	ret
+
+008011a3 <devpipe_read>:
+{
+  8011a3:	55                   	push   %ebp
+  8011a4:	89 e5                	mov    %esp,%ebp
+  8011a6:	57                   	push   %edi
+  8011a7:	56                   	push   %esi
+  8011a8:	53                   	push   %ebx
+  8011a9:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8011ac:	ff 75 08             	push   0x8(%ebp)
+  8011af:	e8 8b f5 ff ff       	call   80073f <fd2data>
+  8011b4:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8011b6:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8011b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8011bc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8011bf:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8011c2:	8b 0b                	mov    (%ebx),%ecx
+  8011c4:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8011ca:	29 ce                	sub    %ecx,%esi
+  8011cc:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8011d1:	f7 e6                	mul    %esi
+  8011d3:	c1 ea 0c             	shr    $0xc,%edx
+  8011d6:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8011dc:	29 c6                	sub    %eax,%esi
+  8011de:	89 f2                	mov    %esi,%edx
+  8011e0:	75 43                	jne    801225 <devpipe_read+0x82>
+		ref = pageref(p);
+  8011e2:	83 ec 0c             	sub    $0xc,%esp
+  8011e5:	53                   	push   %ebx
+  8011e6:	e8 68 12 00 00       	call   802453 <pageref>
+  8011eb:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8011ed:	89 da                	mov    %ebx,%edx
+  8011ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011f2:	e8 47 ff ff ff       	call   80113e <_pipeisclosed>
+  8011f7:	83 c4 10             	add    $0x10,%esp
+  8011fa:	85 c0                	test   %eax,%eax
+  8011fc:	0f 85 c1 00 00 00    	jne    8012c3 <devpipe_read+0x120>
+	*sleeping = 1;
+  801202:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801209:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80120e:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801211:	75 ac                	jne    8011bf <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801213:	83 ec 04             	sub    $0x4,%esp
+  801216:	56                   	push   %esi
+  801217:	57                   	push   %edi
+  801218:	ff 75 e4             	push   -0x1c(%ebp)
+  80121b:	e8 4d f4 ff ff       	call   80066d <sys_futex_wait>
+  801220:	83 c4 10             	add    $0x10,%esp
+  801223:	eb 9a                	jmp    8011bf <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801225:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801228:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  80122c:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80122e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801233:	f7 e1                	mul    %ecx
+  801235:	c1 ea 0b             	shr    $0xb,%edx
+  801238:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80123e:	29 c1                	sub    %eax,%ecx
+  801240:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801242:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801247:	29 cf                	sub    %ecx,%edi
+  801249:	39 f7                	cmp    %esi,%edi
+  80124b:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  80124e:	8d 43 10             	lea    0x10(%ebx),%eax
+  801251:	83 ec 04             	sub    $0x4,%esp
+  801254:	57                   	push   %edi
+  801255:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801258:	01 c2                	add    %eax,%edx
+  80125a:	52                   	push   %edx
+  80125b:	ff 75 0c             	push   0xc(%ebp)
+  80125e:	e8 f4 0c 00 00       	call   801f57 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801263:	83 c4 0c             	add    $0xc,%esp
+  801266:	89 f1                	mov    %esi,%ecx
+  801268:	29 f9                	sub    %edi,%ecx
+  80126a:	51                   	push   %ecx
+  80126b:	ff 75 e4             	push   -0x1c(%ebp)
+  80126e:	89 f8                	mov    %edi,%eax
+  801270:	03 45 0c             	add    0xc(%ebp),%eax
+  801273:	50                   	push   %eax
+  801274:	e8 de 0c 00 00       	call   801f57 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801279:	89 f1                	mov    %esi,%ecx
+  80127b:	03 0b                	add    (%ebx),%ecx
+  80127d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801282:	f7 e1                	mul    %ecx
+  801284:	c1 ea 0c             	shr    $0xc,%edx
+  801287:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80128d:	29 d1                	sub    %edx,%ecx
+  80128f:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801291:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801296:	83 c4 10             	add    $0x10,%esp
+  801299:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  80129d:	75 0a                	jne    8012a9 <devpipe_read+0x106>
+	return n;
+  80129f:	89 f0                	mov    %esi,%eax
+}
+  8012a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a4:	5b                   	pop    %ebx
+  8012a5:	5e                   	pop    %esi
+  8012a6:	5f                   	pop    %edi
+  8012a7:	5d                   	pop    %ebp
+  8012a8:	c3                   	ret
+		*sleeping = 0;
+  8012a9:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8012b0:	83 ec 08             	sub    $0x8,%esp
+  8012b3:	68 00 04 00 00       	push   $0x400
+  8012b8:	53                   	push   %ebx
+  8012b9:	e8 ff f3 ff ff       	call   8006bd <sys_futex_wake>
+  8012be:	83 c4 10             	add    $0x10,%esp
+  8012c1:	eb dc                	jmp    80129f <devpipe_read+0xfc>
+			return 0;
+  8012c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c8:	eb d7                	jmp    8012a1 <devpipe_read+0xfe>
+
+008012ca <devpipe_write>:
+{
+  8012ca:	55                   	push   %ebp
+  8012cb:	89 e5                	mov    %esp,%ebp
+  8012cd:	57                   	push   %edi
+  8012ce:	56                   	push   %esi
+  8012cf:	53                   	push   %ebx
+  8012d0:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8012d3:	ff 75 08             	push   0x8(%ebp)
+  8012d6:	e8 64 f4 ff ff       	call   80073f <fd2data>
+  8012db:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8012dd:	83 c4 10             	add    $0x10,%esp
+  8012e0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8012e7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8012ea:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8012ed:	0f 83 23 01 00 00    	jae    801416 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8012f3:	8b 77 04             	mov    0x4(%edi),%esi
+  8012f6:	8b 1f                	mov    (%edi),%ebx
+  8012f8:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  8012fe:	29 d9                	sub    %ebx,%ecx
+  801300:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801305:	f7 e1                	mul    %ecx
+  801307:	c1 ea 0c             	shr    $0xc,%edx
+  80130a:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801310:	29 c1                	sub    %eax,%ecx
+  801312:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801314:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80131a:	75 40                	jne    80135c <devpipe_write+0x92>
+			ref = pageref(p);
+  80131c:	83 ec 0c             	sub    $0xc,%esp
+  80131f:	57                   	push   %edi
+  801320:	e8 2e 11 00 00       	call   802453 <pageref>
+  801325:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801327:	89 fa                	mov    %edi,%edx
+  801329:	8b 45 08             	mov    0x8(%ebp),%eax
+  80132c:	e8 0d fe ff ff       	call   80113e <_pipeisclosed>
+  801331:	83 c4 10             	add    $0x10,%esp
+  801334:	85 c0                	test   %eax,%eax
+  801336:	0f 85 d5 00 00 00    	jne    801411 <devpipe_write+0x147>
+	*sleeping = 1;
+  80133c:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801343:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801348:	39 1f                	cmp    %ebx,(%edi)
+  80134a:	75 a7                	jne    8012f3 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  80134c:	83 ec 04             	sub    $0x4,%esp
+  80134f:	56                   	push   %esi
+  801350:	53                   	push   %ebx
+  801351:	57                   	push   %edi
+  801352:	e8 16 f3 ff ff       	call   80066d <sys_futex_wait>
+  801357:	83 c4 10             	add    $0x10,%esp
+  80135a:	eb 97                	jmp    8012f3 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80135c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80135f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801362:	29 c1                	sub    %eax,%ecx
+  801364:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801369:	89 d8                	mov    %ebx,%eax
+  80136b:	29 d0                	sub    %edx,%eax
+  80136d:	39 c1                	cmp    %eax,%ecx
+  80136f:	0f 46 c1             	cmovbe %ecx,%eax
+  801372:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801374:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801379:	f7 e6                	mul    %esi
+  80137b:	c1 ea 0b             	shr    $0xb,%edx
+  80137e:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801384:	29 c6                	sub    %eax,%esi
+  801386:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801388:	29 f3                	sub    %esi,%ebx
+  80138a:	39 cb                	cmp    %ecx,%ebx
+  80138c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80138f:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801392:	8d 77 10             	lea    0x10(%edi),%esi
+  801395:	83 ec 04             	sub    $0x4,%esp
+  801398:	53                   	push   %ebx
+  801399:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80139c:	03 45 0c             	add    0xc(%ebp),%eax
+  80139f:	50                   	push   %eax
+  8013a0:	01 f2                	add    %esi,%edx
+  8013a2:	52                   	push   %edx
+  8013a3:	e8 af 0b 00 00       	call   801f57 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8013a8:	83 c4 0c             	add    $0xc,%esp
+  8013ab:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013ae:	29 d8                	sub    %ebx,%eax
+  8013b0:	50                   	push   %eax
+  8013b1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8013b4:	01 d3                	add    %edx,%ebx
+  8013b6:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8013b9:	53                   	push   %ebx
+  8013ba:	56                   	push   %esi
+  8013bb:	e8 97 0b 00 00       	call   801f57 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8013c0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8013c3:	03 4f 04             	add    0x4(%edi),%ecx
+  8013c6:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8013cb:	f7 e1                	mul    %ecx
+  8013cd:	c1 ea 0c             	shr    $0xc,%edx
+  8013d0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8013d6:	29 d1                	sub    %edx,%ecx
+  8013d8:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8013db:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8013e0:	83 c4 10             	add    $0x10,%esp
+  8013e3:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8013e7:	75 0b                	jne    8013f4 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8013e9:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8013ec:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8013ef:	e9 f3 fe ff ff       	jmp    8012e7 <devpipe_write+0x1d>
+		*sleeping = 0;
+  8013f4:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8013fb:	83 ec 08             	sub    $0x8,%esp
+  8013fe:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  801403:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  801406:	50                   	push   %eax
+  801407:	e8 b1 f2 ff ff       	call   8006bd <sys_futex_wake>
+  80140c:	83 c4 10             	add    $0x10,%esp
+  80140f:	eb d8                	jmp    8013e9 <devpipe_write+0x11f>
+				return 0;
+  801411:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801416:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801419:	5b                   	pop    %ebx
+  80141a:	5e                   	pop    %esi
+  80141b:	5f                   	pop    %edi
+  80141c:	5d                   	pop    %ebp
+  80141d:	c3                   	ret
+
+0080141e <pipe>:
+{
+  80141e:	55                   	push   %ebp
+  80141f:	89 e5                	mov    %esp,%ebp
+  801421:	56                   	push   %esi
+  801422:	53                   	push   %ebx
+  801423:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801426:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801429:	50                   	push   %eax
+  80142a:	e8 27 f3 ff ff       	call   800756 <fd_alloc>
+  80142f:	89 c3                	mov    %eax,%ebx
+  801431:	83 c4 10             	add    $0x10,%esp
+  801434:	85 c0                	test   %eax,%eax
+  801436:	0f 88 23 01 00 00    	js     80155f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80143c:	83 ec 04             	sub    $0x4,%esp
+  80143f:	68 07 04 00 00       	push   $0x407
+  801444:	ff 75 f4             	push   -0xc(%ebp)
+  801447:	6a 00                	push   $0x0
+  801449:	e8 46 ed ff ff       	call   800194 <sys_page_alloc>
+  80144e:	89 c3                	mov    %eax,%ebx
+  801450:	83 c4 10             	add    $0x10,%esp
+  801453:	85 c0                	test   %eax,%eax
+  801455:	0f 88 04 01 00 00    	js     80155f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80145b:	83 ec 0c             	sub    $0xc,%esp
+  80145e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801461:	50                   	push   %eax
+  801462:	e8 ef f2 ff ff       	call   800756 <fd_alloc>
+  801467:	89 c3                	mov    %eax,%ebx
+  801469:	83 c4 10             	add    $0x10,%esp
+  80146c:	85 c0                	test   %eax,%eax
+  80146e:	0f 88 db 00 00 00    	js     80154f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801474:	83 ec 04             	sub    $0x4,%esp
+  801477:	68 07 04 00 00       	push   $0x407
+  80147c:	ff 75 f0             	push   -0x10(%ebp)
+  80147f:	6a 00                	push   $0x0
+  801481:	e8 0e ed ff ff       	call   800194 <sys_page_alloc>
+  801486:	89 c3                	mov    %eax,%ebx
+  801488:	83 c4 10             	add    $0x10,%esp
+  80148b:	85 c0                	test   %eax,%eax
+  80148d:	0f 88 bc 00 00 00    	js     80154f <pipe+0x131>
+	va = fd2data(fd0);
+  801493:	83 ec 0c             	sub    $0xc,%esp
+  801496:	ff 75 f4             	push   -0xc(%ebp)
+  801499:	e8 a1 f2 ff ff       	call   80073f <fd2data>
+  80149e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014a0:	83 c4 0c             	add    $0xc,%esp
+  8014a3:	68 07 04 00 00       	push   $0x407
+  8014a8:	50                   	push   %eax
+  8014a9:	6a 00                	push   $0x0
+  8014ab:	e8 e4 ec ff ff       	call   800194 <sys_page_alloc>
+  8014b0:	89 c3                	mov    %eax,%ebx
+  8014b2:	83 c4 10             	add    $0x10,%esp
+  8014b5:	85 c0                	test   %eax,%eax
+  8014b7:	0f 88 82 00 00 00    	js     80153f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014bd:	83 ec 0c             	sub    $0xc,%esp
+  8014c0:	ff 75 f0             	push   -0x10(%ebp)
+  8014c3:	e8 77 f2 ff ff       	call   80073f <fd2data>
+  8014c8:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8014cf:	50                   	push   %eax
+  8014d0:	6a 00                	push   $0x0
+  8014d2:	56                   	push   %esi
+  8014d3:	6a 00                	push   $0x0
+  8014d5:	e8 fd ec ff ff       	call   8001d7 <sys_page_map>
+  8014da:	89 c3                	mov    %eax,%ebx
+  8014dc:	83 c4 20             	add    $0x20,%esp
+  8014df:	85 c0                	test   %eax,%eax
+  8014e1:	78 4e                	js     801531 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8014e3:	a1 20 30 80 00       	mov    0x803020,%eax
+  8014e8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014eb:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8014ed:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014f0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8014f7:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8014fa:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8014fc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8014ff:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801506:	83 ec 0c             	sub    $0xc,%esp
+  801509:	ff 75 f4             	push   -0xc(%ebp)
+  80150c:	e8 1e f2 ff ff       	call   80072f <fd2num>
+  801511:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801514:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801516:	83 c4 04             	add    $0x4,%esp
+  801519:	ff 75 f0             	push   -0x10(%ebp)
+  80151c:	e8 0e f2 ff ff       	call   80072f <fd2num>
+  801521:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801524:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801527:	83 c4 10             	add    $0x10,%esp
+  80152a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80152f:	eb 2e                	jmp    80155f <pipe+0x141>
+	sys_page_unmap(0, va);
+  801531:	83 ec 08             	sub    $0x8,%esp
+  801534:	56                   	push   %esi
+  801535:	6a 00                	push   $0x0
+  801537:	e8 dd ec ff ff       	call   800219 <sys_page_unmap>
+  80153c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80153f:	83 ec 08             	sub    $0x8,%esp
+  801542:	ff 75 f0             	push   -0x10(%ebp)
+  801545:	6a 00                	push   $0x0
+  801547:	e8 cd ec ff ff       	call   800219 <sys_page_unmap>
+  80154c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80154f:	83 ec 08             	sub    $0x8,%esp
+  801552:	ff 75 f4             	push   -0xc(%ebp)
+  801555:	6a 00                	push   $0x0
+  801557:	e8 bd ec ff ff       	call   800219 <sys_page_unmap>
+  80155c:	83 c4 10             	add    $0x10,%esp
+}
+  80155f:	89 d8                	mov    %ebx,%eax
+  801561:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801564:	5b                   	pop    %ebx
+  801565:	5e                   	pop    %esi
+  801566:	5d                   	pop    %ebp
+  801567:	c3                   	ret
+
+00801568 <pipeisclosed>:
+{
+  801568:	55                   	push   %ebp
+  801569:	89 e5                	mov    %esp,%ebp
+  80156b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80156e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801571:	50                   	push   %eax
+  801572:	ff 75 08             	push   0x8(%ebp)
+  801575:	e8 30 f2 ff ff       	call   8007aa <fd_lookup>
+  80157a:	83 c4 10             	add    $0x10,%esp
+  80157d:	85 c0                	test   %eax,%eax
+  80157f:	78 18                	js     801599 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801581:	83 ec 0c             	sub    $0xc,%esp
+  801584:	ff 75 f4             	push   -0xc(%ebp)
+  801587:	e8 b3 f1 ff ff       	call   80073f <fd2data>
+  80158c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80158e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801591:	e8 a8 fb ff ff       	call   80113e <_pipeisclosed>
+  801596:	83 c4 10             	add    $0x10,%esp
+}
+  801599:	c9                   	leave
+  80159a:	c3                   	ret
+
+0080159b <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80159b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a0:	c3                   	ret
+
+008015a1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015a1:	55                   	push   %ebp
+  8015a2:	89 e5                	mov    %esp,%ebp
+  8015a4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8015a7:	68 b6 27 80 00       	push   $0x8027b6
+  8015ac:	ff 75 0c             	push   0xc(%ebp)
+  8015af:	e8 1d 08 00 00       	call   801dd1 <strcpy>
+	return 0;
+}
+  8015b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b9:	c9                   	leave
+  8015ba:	c3                   	ret
+
+008015bb <devcons_write>:
+{
+  8015bb:	55                   	push   %ebp
+  8015bc:	89 e5                	mov    %esp,%ebp
+  8015be:	57                   	push   %edi
+  8015bf:	56                   	push   %esi
+  8015c0:	53                   	push   %ebx
+  8015c1:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8015c7:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8015cc:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8015d2:	eb 2e                	jmp    801602 <devcons_write+0x47>
+		m = n - tot;
+  8015d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015d7:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8015d9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8015de:	39 c3                	cmp    %eax,%ebx
+  8015e0:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8015e3:	83 ec 04             	sub    $0x4,%esp
+  8015e6:	53                   	push   %ebx
+  8015e7:	89 f0                	mov    %esi,%eax
+  8015e9:	03 45 0c             	add    0xc(%ebp),%eax
+  8015ec:	50                   	push   %eax
+  8015ed:	57                   	push   %edi
+  8015ee:	e8 64 09 00 00       	call   801f57 <memmove>
+		sys_cputs(buf, m);
+  8015f3:	83 c4 08             	add    $0x8,%esp
+  8015f6:	53                   	push   %ebx
+  8015f7:	57                   	push   %edi
+  8015f8:	e8 ca ea ff ff       	call   8000c7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8015fd:	01 de                	add    %ebx,%esi
+  8015ff:	83 c4 10             	add    $0x10,%esp
+  801602:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801605:	72 cd                	jb     8015d4 <devcons_write+0x19>
+}
+  801607:	89 f0                	mov    %esi,%eax
+  801609:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160c:	5b                   	pop    %ebx
+  80160d:	5e                   	pop    %esi
+  80160e:	5f                   	pop    %edi
+  80160f:	5d                   	pop    %ebp
+  801610:	c3                   	ret
+
+00801611 <devcons_read>:
+{
+  801611:	55                   	push   %ebp
+  801612:	89 e5                	mov    %esp,%ebp
+  801614:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  801617:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801620:	75 07                	jne    801629 <devcons_read+0x18>
+  801622:	eb 1f                	jmp    801643 <devcons_read+0x32>
+		sys_yield();
+  801624:	e8 4c eb ff ff       	call   800175 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801629:	e8 c8 ea ff ff       	call   8000f6 <sys_cgetc>
+  80162e:	85 c0                	test   %eax,%eax
+  801630:	74 f2                	je     801624 <devcons_read+0x13>
+	if (c < 0)
+  801632:	78 0f                	js     801643 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  801634:	83 f8 04             	cmp    $0x4,%eax
+  801637:	74 0c                	je     801645 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801639:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80163c:	88 02                	mov    %al,(%edx)
+	return 1;
+  80163e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801643:	c9                   	leave
+  801644:	c3                   	ret
+		return 0;
+  801645:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164a:	eb f7                	jmp    801643 <devcons_read+0x32>
+
+0080164c <cputchar>:
+{
+  80164c:	55                   	push   %ebp
+  80164d:	89 e5                	mov    %esp,%ebp
+  80164f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  801652:	8b 45 08             	mov    0x8(%ebp),%eax
+  801655:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801658:	6a 01                	push   $0x1
+  80165a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80165d:	50                   	push   %eax
+  80165e:	e8 64 ea ff ff       	call   8000c7 <sys_cputs>
+}
+  801663:	83 c4 10             	add    $0x10,%esp
+  801666:	c9                   	leave
+  801667:	c3                   	ret
+
+00801668 <getchar>:
+{
+  801668:	55                   	push   %ebp
+  801669:	89 e5                	mov    %esp,%ebp
+  80166b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80166e:	6a 01                	push   $0x1
+  801670:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801673:	50                   	push   %eax
+  801674:	6a 00                	push   $0x0
+  801676:	e8 8e f3 ff ff       	call   800a09 <read>
+	if (r < 0)
+  80167b:	83 c4 10             	add    $0x10,%esp
+  80167e:	85 c0                	test   %eax,%eax
+  801680:	78 06                	js     801688 <getchar+0x20>
+	if (r < 1)
+  801682:	74 06                	je     80168a <getchar+0x22>
+	return c;
+  801684:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801688:	c9                   	leave
+  801689:	c3                   	ret
+		return -E_EOF;
+  80168a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80168f:	eb f7                	jmp    801688 <getchar+0x20>
+
+00801691 <iscons>:
+{
+  801691:	55                   	push   %ebp
+  801692:	89 e5                	mov    %esp,%ebp
+  801694:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801697:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80169a:	50                   	push   %eax
+  80169b:	ff 75 08             	push   0x8(%ebp)
+  80169e:	e8 07 f1 ff ff       	call   8007aa <fd_lookup>
+  8016a3:	83 c4 10             	add    $0x10,%esp
+  8016a6:	85 c0                	test   %eax,%eax
+  8016a8:	78 11                	js     8016bb <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8016aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ad:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  8016b3:	39 10                	cmp    %edx,(%eax)
+  8016b5:	0f 94 c0             	sete   %al
+  8016b8:	0f b6 c0             	movzbl %al,%eax
+}
+  8016bb:	c9                   	leave
+  8016bc:	c3                   	ret
+
+008016bd <opencons>:
+{
+  8016bd:	55                   	push   %ebp
+  8016be:	89 e5                	mov    %esp,%ebp
+  8016c0:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8016c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c6:	50                   	push   %eax
+  8016c7:	e8 8a f0 ff ff       	call   800756 <fd_alloc>
+  8016cc:	83 c4 10             	add    $0x10,%esp
+  8016cf:	85 c0                	test   %eax,%eax
+  8016d1:	78 3a                	js     80170d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8016d3:	83 ec 04             	sub    $0x4,%esp
+  8016d6:	68 07 04 00 00       	push   $0x407
+  8016db:	ff 75 f4             	push   -0xc(%ebp)
+  8016de:	6a 00                	push   $0x0
+  8016e0:	e8 af ea ff ff       	call   800194 <sys_page_alloc>
+  8016e5:	83 c4 10             	add    $0x10,%esp
+  8016e8:	85 c0                	test   %eax,%eax
+  8016ea:	78 21                	js     80170d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8016ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ef:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  8016f5:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8016f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016fa:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  801701:	83 ec 0c             	sub    $0xc,%esp
+  801704:	50                   	push   %eax
+  801705:	e8 25 f0 ff ff       	call   80072f <fd2num>
+  80170a:	83 c4 10             	add    $0x10,%esp
+}
+  80170d:	c9                   	leave
+  80170e:	c3                   	ret
+
+0080170f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80170f:	55                   	push   %ebp
+  801710:	89 e5                	mov    %esp,%ebp
+  801712:	56                   	push   %esi
+  801713:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801714:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801717:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80171d:	e8 34 ea ff ff       	call   800156 <sys_getenvid>
+  801722:	83 ec 0c             	sub    $0xc,%esp
+  801725:	ff 75 0c             	push   0xc(%ebp)
+  801728:	ff 75 08             	push   0x8(%ebp)
+  80172b:	56                   	push   %esi
+  80172c:	50                   	push   %eax
+  80172d:	68 c4 27 80 00       	push   $0x8027c4
+  801732:	e8 b3 00 00 00       	call   8017ea <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801737:	83 c4 18             	add    $0x18,%esp
+  80173a:	53                   	push   %ebx
+  80173b:	ff 75 10             	push   0x10(%ebp)
+  80173e:	e8 56 00 00 00       	call   801799 <vcprintf>
+	cprintf("\n");
+  801743:	c7 04 24 af 27 80 00 	movl   $0x8027af,(%esp)
+  80174a:	e8 9b 00 00 00       	call   8017ea <cprintf>
+  80174f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801752:	cc                   	int3
+	while (1)
+  801753:	eb fd                	jmp    801752 <_panic+0x43>
+
+00801755 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801755:	55                   	push   %ebp
+  801756:	89 e5                	mov    %esp,%ebp
+  801758:	53                   	push   %ebx
+  801759:	83 ec 04             	sub    $0x4,%esp
+  80175c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80175f:	8b 13                	mov    (%ebx),%edx
+  801761:	8d 42 01             	lea    0x1(%edx),%eax
+  801764:	89 03                	mov    %eax,(%ebx)
+  801766:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801769:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80176d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801772:	74 09                	je     80177d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  801774:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801778:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80177b:	c9                   	leave
+  80177c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80177d:	83 ec 08             	sub    $0x8,%esp
+  801780:	68 ff 00 00 00       	push   $0xff
+  801785:	8d 43 08             	lea    0x8(%ebx),%eax
+  801788:	50                   	push   %eax
+  801789:	e8 39 e9 ff ff       	call   8000c7 <sys_cputs>
+		b->idx = 0;
+  80178e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801794:	83 c4 10             	add    $0x10,%esp
+  801797:	eb db                	jmp    801774 <putch+0x1f>
+
+00801799 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  801799:	55                   	push   %ebp
+  80179a:	89 e5                	mov    %esp,%ebp
+  80179c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8017a2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017a9:	00 00 00 
+	b.cnt = 0;
+  8017ac:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8017b3:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8017b6:	ff 75 0c             	push   0xc(%ebp)
+  8017b9:	ff 75 08             	push   0x8(%ebp)
+  8017bc:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8017c2:	50                   	push   %eax
+  8017c3:	68 55 17 80 00       	push   $0x801755
+  8017c8:	e8 14 01 00 00       	call   8018e1 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8017cd:	83 c4 08             	add    $0x8,%esp
+  8017d0:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8017d6:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8017dc:	50                   	push   %eax
+  8017dd:	e8 e5 e8 ff ff       	call   8000c7 <sys_cputs>
+
+	return b.cnt;
+}
+  8017e2:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8017e8:	c9                   	leave
+  8017e9:	c3                   	ret
+
+008017ea <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8017ea:	55                   	push   %ebp
+  8017eb:	89 e5                	mov    %esp,%ebp
+  8017ed:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8017f0:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8017f3:	50                   	push   %eax
+  8017f4:	ff 75 08             	push   0x8(%ebp)
+  8017f7:	e8 9d ff ff ff       	call   801799 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8017fc:	c9                   	leave
+  8017fd:	c3                   	ret
+
+008017fe <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8017fe:	55                   	push   %ebp
+  8017ff:	89 e5                	mov    %esp,%ebp
+  801801:	57                   	push   %edi
+  801802:	56                   	push   %esi
+  801803:	53                   	push   %ebx
+  801804:	83 ec 1c             	sub    $0x1c,%esp
+  801807:	89 c7                	mov    %eax,%edi
+  801809:	89 d6                	mov    %edx,%esi
+  80180b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801811:	89 d1                	mov    %edx,%ecx
+  801813:	89 c2                	mov    %eax,%edx
+  801815:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801818:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80181b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80181e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801821:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801824:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80182b:	39 c2                	cmp    %eax,%edx
+  80182d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801830:	72 3e                	jb     801870 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801832:	83 ec 0c             	sub    $0xc,%esp
+  801835:	ff 75 18             	push   0x18(%ebp)
+  801838:	83 eb 01             	sub    $0x1,%ebx
+  80183b:	53                   	push   %ebx
+  80183c:	50                   	push   %eax
+  80183d:	83 ec 08             	sub    $0x8,%esp
+  801840:	ff 75 e4             	push   -0x1c(%ebp)
+  801843:	ff 75 e0             	push   -0x20(%ebp)
+  801846:	ff 75 dc             	push   -0x24(%ebp)
+  801849:	ff 75 d8             	push   -0x28(%ebp)
+  80184c:	e8 0f 0d 00 00       	call   802560 <__udivdi3>
+  801851:	83 c4 18             	add    $0x18,%esp
+  801854:	52                   	push   %edx
+  801855:	50                   	push   %eax
+  801856:	89 f2                	mov    %esi,%edx
+  801858:	89 f8                	mov    %edi,%eax
+  80185a:	e8 9f ff ff ff       	call   8017fe <printnum>
+  80185f:	83 c4 20             	add    $0x20,%esp
+  801862:	eb 13                	jmp    801877 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801864:	83 ec 08             	sub    $0x8,%esp
+  801867:	56                   	push   %esi
+  801868:	ff 75 18             	push   0x18(%ebp)
+  80186b:	ff d7                	call   *%edi
+  80186d:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801870:	83 eb 01             	sub    $0x1,%ebx
+  801873:	85 db                	test   %ebx,%ebx
+  801875:	7f ed                	jg     801864 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801877:	83 ec 08             	sub    $0x8,%esp
+  80187a:	56                   	push   %esi
+  80187b:	83 ec 04             	sub    $0x4,%esp
+  80187e:	ff 75 e4             	push   -0x1c(%ebp)
+  801881:	ff 75 e0             	push   -0x20(%ebp)
+  801884:	ff 75 dc             	push   -0x24(%ebp)
+  801887:	ff 75 d8             	push   -0x28(%ebp)
+  80188a:	e8 ef 0c 00 00       	call   80257e <__umoddi3>
+  80188f:	83 c4 14             	add    $0x14,%esp
+  801892:	0f be 80 e7 27 80 00 	movsbl 0x8027e7(%eax),%eax
+  801899:	50                   	push   %eax
+  80189a:	ff d7                	call   *%edi
+}
+  80189c:	83 c4 10             	add    $0x10,%esp
+  80189f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018a2:	5b                   	pop    %ebx
+  8018a3:	5e                   	pop    %esi
+  8018a4:	5f                   	pop    %edi
+  8018a5:	5d                   	pop    %ebp
+  8018a6:	c3                   	ret
+
+008018a7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8018a7:	55                   	push   %ebp
+  8018a8:	89 e5                	mov    %esp,%ebp
+  8018aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8018ad:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8018b1:	8b 10                	mov    (%eax),%edx
+  8018b3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8018b6:	73 0a                	jae    8018c2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8018b8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8018bb:	89 08                	mov    %ecx,(%eax)
+  8018bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c0:	88 02                	mov    %al,(%edx)
+}
+  8018c2:	5d                   	pop    %ebp
+  8018c3:	c3                   	ret
+
+008018c4 <printfmt>:
+{
+  8018c4:	55                   	push   %ebp
+  8018c5:	89 e5                	mov    %esp,%ebp
+  8018c7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8018ca:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8018cd:	50                   	push   %eax
+  8018ce:	ff 75 10             	push   0x10(%ebp)
+  8018d1:	ff 75 0c             	push   0xc(%ebp)
+  8018d4:	ff 75 08             	push   0x8(%ebp)
+  8018d7:	e8 05 00 00 00       	call   8018e1 <vprintfmt>
+}
+  8018dc:	83 c4 10             	add    $0x10,%esp
+  8018df:	c9                   	leave
+  8018e0:	c3                   	ret
+
+008018e1 <vprintfmt>:
+{
+  8018e1:	55                   	push   %ebp
+  8018e2:	89 e5                	mov    %esp,%ebp
+  8018e4:	57                   	push   %edi
+  8018e5:	56                   	push   %esi
+  8018e6:	53                   	push   %ebx
+  8018e7:	83 ec 2c             	sub    $0x2c,%esp
+  8018ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8018f0:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8018f3:	eb 0a                	jmp    8018ff <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8018f5:	83 ec 08             	sub    $0x8,%esp
+  8018f8:	53                   	push   %ebx
+  8018f9:	50                   	push   %eax
+  8018fa:	ff d6                	call   *%esi
+  8018fc:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8018ff:	83 c7 01             	add    $0x1,%edi
+  801902:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  801906:	83 f8 25             	cmp    $0x25,%eax
+  801909:	74 0c                	je     801917 <vprintfmt+0x36>
+			if (ch == '\0')
+  80190b:	85 c0                	test   %eax,%eax
+  80190d:	75 e6                	jne    8018f5 <vprintfmt+0x14>
+}
+  80190f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801912:	5b                   	pop    %ebx
+  801913:	5e                   	pop    %esi
+  801914:	5f                   	pop    %edi
+  801915:	5d                   	pop    %ebp
+  801916:	c3                   	ret
+		padc = ' ';
+  801917:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80191b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801922:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801929:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801930:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801935:	8d 47 01             	lea    0x1(%edi),%eax
+  801938:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80193b:	0f b6 17             	movzbl (%edi),%edx
+  80193e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801941:	3c 55                	cmp    $0x55,%al
+  801943:	0f 87 c5 03 00 00    	ja     801d0e <vprintfmt+0x42d>
+  801949:	0f b6 c0             	movzbl %al,%eax
+  80194c:	ff 24 85 60 29 80 00 	jmp    *0x802960(,%eax,4)
+  801953:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  801956:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80195a:	eb d9                	jmp    801935 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80195c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80195f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  801963:	eb d0                	jmp    801935 <vprintfmt+0x54>
+  801965:	0f b6 d2             	movzbl %dl,%edx
+  801968:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80196b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801970:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  801973:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801976:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80197a:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80197d:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801980:	83 f9 09             	cmp    $0x9,%ecx
+  801983:	77 55                	ja     8019da <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  801985:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801988:	eb e9                	jmp    801973 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80198a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80198d:	8b 00                	mov    (%eax),%eax
+  80198f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801992:	8b 45 14             	mov    0x14(%ebp),%eax
+  801995:	8d 40 04             	lea    0x4(%eax),%eax
+  801998:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80199b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80199e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8019a2:	79 91                	jns    801935 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8019a4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8019a7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019aa:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8019b1:	eb 82                	jmp    801935 <vprintfmt+0x54>
+			if (width < 0)
+  8019b3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8019b6:	85 d2                	test   %edx,%edx
+  8019b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019bd:	0f 49 c2             	cmovns %edx,%eax
+  8019c0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019c3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019c6:	e9 6a ff ff ff       	jmp    801935 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8019cb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8019ce:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8019d5:	e9 5b ff ff ff       	jmp    801935 <vprintfmt+0x54>
+  8019da:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019dd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019e0:	eb bc                	jmp    80199e <vprintfmt+0xbd>
+			lflag++;
+  8019e2:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8019e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019e8:	e9 48 ff ff ff       	jmp    801935 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8019ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019f0:	8d 78 04             	lea    0x4(%eax),%edi
+  8019f3:	83 ec 08             	sub    $0x8,%esp
+  8019f6:	53                   	push   %ebx
+  8019f7:	ff 30                	push   (%eax)
+  8019f9:	ff d6                	call   *%esi
+			break;
+  8019fb:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8019fe:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  801a01:	e9 63 02 00 00       	jmp    801c69 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  801a06:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a09:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801a0c:	8b 10                	mov    (%eax),%edx
+  801a0e:	89 d0                	mov    %edx,%eax
+  801a10:	f7 d8                	neg    %eax
+  801a12:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801a15:	83 f8 12             	cmp    $0x12,%eax
+  801a18:	7f 23                	jg     801a3d <vprintfmt+0x15c>
+  801a1a:	8b 14 85 c0 2a 80 00 	mov    0x802ac0(,%eax,4),%edx
+  801a21:	85 d2                	test   %edx,%edx
+  801a23:	74 18                	je     801a3d <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801a25:	52                   	push   %edx
+  801a26:	68 7d 27 80 00       	push   $0x80277d
+  801a2b:	53                   	push   %ebx
+  801a2c:	56                   	push   %esi
+  801a2d:	e8 92 fe ff ff       	call   8018c4 <printfmt>
+  801a32:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a35:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801a38:	e9 2c 02 00 00       	jmp    801c69 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  801a3d:	50                   	push   %eax
+  801a3e:	68 ff 27 80 00       	push   $0x8027ff
+  801a43:	53                   	push   %ebx
+  801a44:	56                   	push   %esi
+  801a45:	e8 7a fe ff ff       	call   8018c4 <printfmt>
+  801a4a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a4d:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801a50:	e9 14 02 00 00       	jmp    801c69 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801a55:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a58:	83 c0 04             	add    $0x4,%eax
+  801a5b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801a5e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a61:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801a63:	85 c9                	test   %ecx,%ecx
+  801a65:	b8 f8 27 80 00       	mov    $0x8027f8,%eax
+  801a6a:	0f 45 c1             	cmovne %ecx,%eax
+  801a6d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801a70:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801a74:	7e 06                	jle    801a7c <vprintfmt+0x19b>
+  801a76:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801a7a:	75 0b                	jne    801a87 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801a7c:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801a7f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801a82:	89 75 08             	mov    %esi,0x8(%ebp)
+  801a85:	eb 5c                	jmp    801ae3 <vprintfmt+0x202>
+  801a87:	83 ec 08             	sub    $0x8,%esp
+  801a8a:	ff 75 d0             	push   -0x30(%ebp)
+  801a8d:	ff 75 cc             	push   -0x34(%ebp)
+  801a90:	e8 19 03 00 00       	call   801dae <strnlen>
+  801a95:	89 c2                	mov    %eax,%edx
+  801a97:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a9a:	29 d0                	sub    %edx,%eax
+  801a9c:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801a9f:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801aa3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801aa6:	89 75 08             	mov    %esi,0x8(%ebp)
+  801aa9:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801aab:	eb 0e                	jmp    801abb <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801aad:	83 ec 08             	sub    $0x8,%esp
+  801ab0:	53                   	push   %ebx
+  801ab1:	57                   	push   %edi
+  801ab2:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ab5:	83 ee 01             	sub    $0x1,%esi
+  801ab8:	83 c4 10             	add    $0x10,%esp
+  801abb:	85 f6                	test   %esi,%esi
+  801abd:	7f ee                	jg     801aad <vprintfmt+0x1cc>
+  801abf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ac2:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ac5:	85 c0                	test   %eax,%eax
+  801ac7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801acc:	0f 49 d0             	cmovns %eax,%edx
+  801acf:	29 d0                	sub    %edx,%eax
+  801ad1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ad4:	eb a6                	jmp    801a7c <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801ad6:	83 ec 08             	sub    $0x8,%esp
+  801ad9:	53                   	push   %ebx
+  801ada:	52                   	push   %edx
+  801adb:	ff 55 08             	call   *0x8(%ebp)
+  801ade:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801ae1:	89 f1                	mov    %esi,%ecx
+  801ae3:	8d 71 01             	lea    0x1(%ecx),%esi
+  801ae6:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801aea:	0f be d0             	movsbl %al,%edx
+  801aed:	85 d2                	test   %edx,%edx
+  801aef:	74 28                	je     801b19 <vprintfmt+0x238>
+  801af1:	85 ff                	test   %edi,%edi
+  801af3:	78 05                	js     801afa <vprintfmt+0x219>
+  801af5:	83 ef 01             	sub    $0x1,%edi
+  801af8:	78 30                	js     801b2a <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801afa:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801afe:	74 d6                	je     801ad6 <vprintfmt+0x1f5>
+  801b00:	0f be c0             	movsbl %al,%eax
+  801b03:	83 e8 20             	sub    $0x20,%eax
+  801b06:	83 f8 5e             	cmp    $0x5e,%eax
+  801b09:	76 cb                	jbe    801ad6 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801b0b:	83 ec 08             	sub    $0x8,%esp
+  801b0e:	53                   	push   %ebx
+  801b0f:	6a 3f                	push   $0x3f
+  801b11:	ff 55 08             	call   *0x8(%ebp)
+  801b14:	83 c4 10             	add    $0x10,%esp
+  801b17:	eb c8                	jmp    801ae1 <vprintfmt+0x200>
+  801b19:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b1c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b1f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801b22:	01 d0                	add    %edx,%eax
+  801b24:	29 c8                	sub    %ecx,%eax
+  801b26:	89 c7                	mov    %eax,%edi
+  801b28:	eb 13                	jmp    801b3d <vprintfmt+0x25c>
+  801b2a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b2d:	eb ed                	jmp    801b1c <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801b2f:	83 ec 08             	sub    $0x8,%esp
+  801b32:	53                   	push   %ebx
+  801b33:	6a 20                	push   $0x20
+  801b35:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801b37:	83 ef 01             	sub    $0x1,%edi
+  801b3a:	83 c4 10             	add    $0x10,%esp
+  801b3d:	85 ff                	test   %edi,%edi
+  801b3f:	7f ee                	jg     801b2f <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801b41:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b44:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b47:	e9 1d 01 00 00       	jmp    801c69 <vprintfmt+0x388>
+	if (lflag >= 2)
+  801b4c:	83 f9 01             	cmp    $0x1,%ecx
+  801b4f:	7f 1b                	jg     801b6c <vprintfmt+0x28b>
+	else if (lflag)
+  801b51:	85 c9                	test   %ecx,%ecx
+  801b53:	74 63                	je     801bb8 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  801b55:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b58:	8b 00                	mov    (%eax),%eax
+  801b5a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b5d:	99                   	cltd
+  801b5e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b61:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b64:	8d 40 04             	lea    0x4(%eax),%eax
+  801b67:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b6a:	eb 17                	jmp    801b83 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  801b6c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b6f:	8b 50 04             	mov    0x4(%eax),%edx
+  801b72:	8b 00                	mov    (%eax),%eax
+  801b74:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b77:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b7a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b7d:	8d 40 08             	lea    0x8(%eax),%eax
+  801b80:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801b83:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b86:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801b89:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801b8e:	85 c9                	test   %ecx,%ecx
+  801b90:	0f 89 b9 00 00 00    	jns    801c4f <vprintfmt+0x36e>
+				putch('-', putdat);
+  801b96:	83 ec 08             	sub    $0x8,%esp
+  801b99:	53                   	push   %ebx
+  801b9a:	6a 2d                	push   $0x2d
+  801b9c:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801b9e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801ba1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801ba4:	f7 da                	neg    %edx
+  801ba6:	83 d1 00             	adc    $0x0,%ecx
+  801ba9:	f7 d9                	neg    %ecx
+  801bab:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801bae:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801bb3:	e9 97 00 00 00       	jmp    801c4f <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  801bb8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bbb:	8b 00                	mov    (%eax),%eax
+  801bbd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bc0:	99                   	cltd
+  801bc1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801bc4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bc7:	8d 40 04             	lea    0x4(%eax),%eax
+  801bca:	89 45 14             	mov    %eax,0x14(%ebp)
+  801bcd:	eb b4                	jmp    801b83 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  801bcf:	83 f9 01             	cmp    $0x1,%ecx
+  801bd2:	7f 1b                	jg     801bef <vprintfmt+0x30e>
+	else if (lflag)
+  801bd4:	85 c9                	test   %ecx,%ecx
+  801bd6:	74 2c                	je     801c04 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  801bd8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bdb:	8b 10                	mov    (%eax),%edx
+  801bdd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801be2:	8d 40 04             	lea    0x4(%eax),%eax
+  801be5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801be8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801bed:	eb 60                	jmp    801c4f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801bef:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bf2:	8b 10                	mov    (%eax),%edx
+  801bf4:	8b 48 04             	mov    0x4(%eax),%ecx
+  801bf7:	8d 40 08             	lea    0x8(%eax),%eax
+  801bfa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801bfd:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801c02:	eb 4b                	jmp    801c4f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  801c04:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c07:	8b 10                	mov    (%eax),%edx
+  801c09:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c0e:	8d 40 04             	lea    0x4(%eax),%eax
+  801c11:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c14:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801c19:	eb 34                	jmp    801c4f <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801c1b:	83 f9 01             	cmp    $0x1,%ecx
+  801c1e:	7f 15                	jg     801c35 <vprintfmt+0x354>
+	else if (lflag)
+  801c20:	85 c9                	test   %ecx,%ecx
+  801c22:	74 4d                	je     801c71 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  801c24:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c27:	8b 00                	mov    (%eax),%eax
+  801c29:	99                   	cltd
+  801c2a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c2d:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801c30:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  801c33:	eb 11                	jmp    801c46 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  801c35:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c38:	8b 50 04             	mov    0x4(%eax),%edx
+  801c3b:	8b 00                	mov    (%eax),%eax
+  801c3d:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c40:	8d 49 08             	lea    0x8(%ecx),%ecx
+  801c43:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  801c46:	89 d1                	mov    %edx,%ecx
+  801c48:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  801c4a:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801c4f:	83 ec 0c             	sub    $0xc,%esp
+  801c52:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801c56:	50                   	push   %eax
+  801c57:	ff 75 e0             	push   -0x20(%ebp)
+  801c5a:	57                   	push   %edi
+  801c5b:	51                   	push   %ecx
+  801c5c:	52                   	push   %edx
+  801c5d:	89 da                	mov    %ebx,%edx
+  801c5f:	89 f0                	mov    %esi,%eax
+  801c61:	e8 98 fb ff ff       	call   8017fe <printnum>
+			break;
+  801c66:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801c69:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801c6c:	e9 8e fc ff ff       	jmp    8018ff <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  801c71:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c74:	8b 00                	mov    (%eax),%eax
+  801c76:	99                   	cltd
+  801c77:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c7a:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801c7d:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  801c80:	eb c4                	jmp    801c46 <vprintfmt+0x365>
+			putch('0', putdat);
+  801c82:	83 ec 08             	sub    $0x8,%esp
+  801c85:	53                   	push   %ebx
+  801c86:	6a 30                	push   $0x30
+  801c88:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801c8a:	83 c4 08             	add    $0x8,%esp
+  801c8d:	53                   	push   %ebx
+  801c8e:	6a 78                	push   $0x78
+  801c90:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801c92:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c95:	8b 10                	mov    (%eax),%edx
+  801c97:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801c9c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801c9f:	8d 40 04             	lea    0x4(%eax),%eax
+  801ca2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801ca5:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  801caa:	eb a3                	jmp    801c4f <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801cac:	83 f9 01             	cmp    $0x1,%ecx
+  801caf:	7f 1b                	jg     801ccc <vprintfmt+0x3eb>
+	else if (lflag)
+  801cb1:	85 c9                	test   %ecx,%ecx
+  801cb3:	74 2f                	je     801ce4 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  801cb5:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cb8:	8b 10                	mov    (%eax),%edx
+  801cba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cbf:	8d 40 04             	lea    0x4(%eax),%eax
+  801cc2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cc5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801cca:	eb 83                	jmp    801c4f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801ccc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ccf:	8b 10                	mov    (%eax),%edx
+  801cd1:	8b 48 04             	mov    0x4(%eax),%ecx
+  801cd4:	8d 40 08             	lea    0x8(%eax),%eax
+  801cd7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cda:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801cdf:	e9 6b ff ff ff       	jmp    801c4f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  801ce4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ce7:	8b 10                	mov    (%eax),%edx
+  801ce9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cee:	8d 40 04             	lea    0x4(%eax),%eax
+  801cf1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cf4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801cf9:	e9 51 ff ff ff       	jmp    801c4f <vprintfmt+0x36e>
+			putch(ch, putdat);
+  801cfe:	83 ec 08             	sub    $0x8,%esp
+  801d01:	53                   	push   %ebx
+  801d02:	6a 25                	push   $0x25
+  801d04:	ff d6                	call   *%esi
+			break;
+  801d06:	83 c4 10             	add    $0x10,%esp
+  801d09:	e9 5b ff ff ff       	jmp    801c69 <vprintfmt+0x388>
+			putch('%', putdat);
+  801d0e:	83 ec 08             	sub    $0x8,%esp
+  801d11:	53                   	push   %ebx
+  801d12:	6a 25                	push   $0x25
+  801d14:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801d16:	83 c4 10             	add    $0x10,%esp
+  801d19:	89 f8                	mov    %edi,%eax
+  801d1b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801d1f:	74 05                	je     801d26 <vprintfmt+0x445>
+  801d21:	83 e8 01             	sub    $0x1,%eax
+  801d24:	eb f5                	jmp    801d1b <vprintfmt+0x43a>
+  801d26:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d29:	e9 3b ff ff ff       	jmp    801c69 <vprintfmt+0x388>
+
+00801d2e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801d2e:	55                   	push   %ebp
+  801d2f:	89 e5                	mov    %esp,%ebp
+  801d31:	83 ec 18             	sub    $0x18,%esp
+  801d34:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d37:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801d3a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801d3d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801d41:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801d44:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801d4b:	85 c0                	test   %eax,%eax
+  801d4d:	74 26                	je     801d75 <vsnprintf+0x47>
+  801d4f:	85 d2                	test   %edx,%edx
+  801d51:	7e 22                	jle    801d75 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801d53:	ff 75 14             	push   0x14(%ebp)
+  801d56:	ff 75 10             	push   0x10(%ebp)
+  801d59:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801d5c:	50                   	push   %eax
+  801d5d:	68 a7 18 80 00       	push   $0x8018a7
+  801d62:	e8 7a fb ff ff       	call   8018e1 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801d67:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801d6a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801d6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d70:	83 c4 10             	add    $0x10,%esp
+}
+  801d73:	c9                   	leave
+  801d74:	c3                   	ret
+		return -E_INVAL;
+  801d75:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d7a:	eb f7                	jmp    801d73 <vsnprintf+0x45>
+
+00801d7c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801d7c:	55                   	push   %ebp
+  801d7d:	89 e5                	mov    %esp,%ebp
+  801d7f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801d82:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801d85:	50                   	push   %eax
+  801d86:	ff 75 10             	push   0x10(%ebp)
+  801d89:	ff 75 0c             	push   0xc(%ebp)
+  801d8c:	ff 75 08             	push   0x8(%ebp)
+  801d8f:	e8 9a ff ff ff       	call   801d2e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801d94:	c9                   	leave
+  801d95:	c3                   	ret
+
+00801d96 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801d96:	55                   	push   %ebp
+  801d97:	89 e5                	mov    %esp,%ebp
+  801d99:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da1:	eb 03                	jmp    801da6 <strlen+0x10>
+		n++;
+  801da3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801da6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801daa:	75 f7                	jne    801da3 <strlen+0xd>
+	return n;
+}
+  801dac:	5d                   	pop    %ebp
+  801dad:	c3                   	ret
+
+00801dae <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801dae:	55                   	push   %ebp
+  801daf:	89 e5                	mov    %esp,%ebp
+  801db1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801db4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801db7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dbc:	eb 03                	jmp    801dc1 <strnlen+0x13>
+		n++;
+  801dbe:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dc1:	39 d0                	cmp    %edx,%eax
+  801dc3:	74 08                	je     801dcd <strnlen+0x1f>
+  801dc5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801dc9:	75 f3                	jne    801dbe <strnlen+0x10>
+  801dcb:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801dcd:	89 d0                	mov    %edx,%eax
+  801dcf:	5d                   	pop    %ebp
+  801dd0:	c3                   	ret
+
+00801dd1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801dd1:	55                   	push   %ebp
+  801dd2:	89 e5                	mov    %esp,%ebp
+  801dd4:	53                   	push   %ebx
+  801dd5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801dd8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801ddb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801de4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801de7:	83 c0 01             	add    $0x1,%eax
+  801dea:	84 d2                	test   %dl,%dl
+  801dec:	75 f2                	jne    801de0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801dee:	89 c8                	mov    %ecx,%eax
+  801df0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801df3:	c9                   	leave
+  801df4:	c3                   	ret
+
+00801df5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801df5:	55                   	push   %ebp
+  801df6:	89 e5                	mov    %esp,%ebp
+  801df8:	53                   	push   %ebx
+  801df9:	83 ec 10             	sub    $0x10,%esp
+  801dfc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801dff:	53                   	push   %ebx
+  801e00:	e8 91 ff ff ff       	call   801d96 <strlen>
+  801e05:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801e08:	ff 75 0c             	push   0xc(%ebp)
+  801e0b:	01 d8                	add    %ebx,%eax
+  801e0d:	50                   	push   %eax
+  801e0e:	e8 be ff ff ff       	call   801dd1 <strcpy>
+	return dst;
+}
+  801e13:	89 d8                	mov    %ebx,%eax
+  801e15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e18:	c9                   	leave
+  801e19:	c3                   	ret
+
+00801e1a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801e1a:	55                   	push   %ebp
+  801e1b:	89 e5                	mov    %esp,%ebp
+  801e1d:	56                   	push   %esi
+  801e1e:	53                   	push   %ebx
+  801e1f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e22:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801e25:	89 f3                	mov    %esi,%ebx
+  801e27:	03 5d 10             	add    0x10(%ebp),%ebx
+  801e2a:	89 f0                	mov    %esi,%eax
+  801e2c:	eb 0f                	jmp    801e3d <strncpy+0x23>
+		*dst++ = *src;
+  801e2e:	83 c0 01             	add    $0x1,%eax
+  801e31:	0f b6 0a             	movzbl (%edx),%ecx
+  801e34:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801e37:	80 f9 01             	cmp    $0x1,%cl
+  801e3a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801e3d:	39 d8                	cmp    %ebx,%eax
+  801e3f:	75 ed                	jne    801e2e <strncpy+0x14>
+	}
+	return ret;
+}
+  801e41:	89 f0                	mov    %esi,%eax
+  801e43:	5b                   	pop    %ebx
+  801e44:	5e                   	pop    %esi
+  801e45:	5d                   	pop    %ebp
+  801e46:	c3                   	ret
+
+00801e47 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e47:	55                   	push   %ebp
+  801e48:	89 e5                	mov    %esp,%ebp
+  801e4a:	56                   	push   %esi
+  801e4b:	53                   	push   %ebx
+  801e4c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e52:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801e55:	89 f0                	mov    %esi,%eax
+  801e57:	85 d2                	test   %edx,%edx
+  801e59:	74 21                	je     801e7c <strlcpy+0x35>
+  801e5b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801e5f:	89 f2                	mov    %esi,%edx
+  801e61:	eb 09                	jmp    801e6c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801e63:	83 c1 01             	add    $0x1,%ecx
+  801e66:	83 c2 01             	add    $0x1,%edx
+  801e69:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801e6c:	39 c2                	cmp    %eax,%edx
+  801e6e:	74 09                	je     801e79 <strlcpy+0x32>
+  801e70:	0f b6 19             	movzbl (%ecx),%ebx
+  801e73:	84 db                	test   %bl,%bl
+  801e75:	75 ec                	jne    801e63 <strlcpy+0x1c>
+  801e77:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801e79:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801e7c:	29 f0                	sub    %esi,%eax
+}
+  801e7e:	5b                   	pop    %ebx
+  801e7f:	5e                   	pop    %esi
+  801e80:	5d                   	pop    %ebp
+  801e81:	c3                   	ret
+
+00801e82 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801e82:	55                   	push   %ebp
+  801e83:	89 e5                	mov    %esp,%ebp
+  801e85:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e88:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801e8b:	eb 06                	jmp    801e93 <strcmp+0x11>
+		p++, q++;
+  801e8d:	83 c1 01             	add    $0x1,%ecx
+  801e90:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801e93:	0f b6 01             	movzbl (%ecx),%eax
+  801e96:	84 c0                	test   %al,%al
+  801e98:	74 04                	je     801e9e <strcmp+0x1c>
+  801e9a:	3a 02                	cmp    (%edx),%al
+  801e9c:	74 ef                	je     801e8d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801e9e:	0f b6 c0             	movzbl %al,%eax
+  801ea1:	0f b6 12             	movzbl (%edx),%edx
+  801ea4:	29 d0                	sub    %edx,%eax
+}
+  801ea6:	5d                   	pop    %ebp
+  801ea7:	c3                   	ret
+
+00801ea8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801ea8:	55                   	push   %ebp
+  801ea9:	89 e5                	mov    %esp,%ebp
+  801eab:	53                   	push   %ebx
+  801eac:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eaf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eb2:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801eb5:	eb 09                	jmp    801ec0 <strncmp+0x18>
+		n--, p++, q++;
+  801eb7:	83 ea 01             	sub    $0x1,%edx
+  801eba:	83 c0 01             	add    $0x1,%eax
+  801ebd:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801ec0:	85 d2                	test   %edx,%edx
+  801ec2:	74 18                	je     801edc <strncmp+0x34>
+  801ec4:	0f b6 18             	movzbl (%eax),%ebx
+  801ec7:	84 db                	test   %bl,%bl
+  801ec9:	74 04                	je     801ecf <strncmp+0x27>
+  801ecb:	3a 19                	cmp    (%ecx),%bl
+  801ecd:	74 e8                	je     801eb7 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ecf:	0f b6 00             	movzbl (%eax),%eax
+  801ed2:	0f b6 11             	movzbl (%ecx),%edx
+  801ed5:	29 d0                	sub    %edx,%eax
+}
+  801ed7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eda:	c9                   	leave
+  801edb:	c3                   	ret
+		return 0;
+  801edc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee1:	eb f4                	jmp    801ed7 <strncmp+0x2f>
+
+00801ee3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801ee3:	55                   	push   %ebp
+  801ee4:	89 e5                	mov    %esp,%ebp
+  801ee6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801eed:	eb 03                	jmp    801ef2 <strchr+0xf>
+  801eef:	83 c0 01             	add    $0x1,%eax
+  801ef2:	0f b6 10             	movzbl (%eax),%edx
+  801ef5:	84 d2                	test   %dl,%dl
+  801ef7:	74 06                	je     801eff <strchr+0x1c>
+		if (*s == c)
+  801ef9:	38 ca                	cmp    %cl,%dl
+  801efb:	75 f2                	jne    801eef <strchr+0xc>
+  801efd:	eb 05                	jmp    801f04 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801eff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f04:	5d                   	pop    %ebp
+  801f05:	c3                   	ret
+
+00801f06 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801f06:	55                   	push   %ebp
+  801f07:	89 e5                	mov    %esp,%ebp
+  801f09:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f0c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f10:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801f13:	38 ca                	cmp    %cl,%dl
+  801f15:	74 09                	je     801f20 <strfind+0x1a>
+  801f17:	84 d2                	test   %dl,%dl
+  801f19:	74 05                	je     801f20 <strfind+0x1a>
+	for (; *s; s++)
+  801f1b:	83 c0 01             	add    $0x1,%eax
+  801f1e:	eb f0                	jmp    801f10 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801f20:	5d                   	pop    %ebp
+  801f21:	c3                   	ret
+
+00801f22 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801f22:	55                   	push   %ebp
+  801f23:	89 e5                	mov    %esp,%ebp
+  801f25:	57                   	push   %edi
+  801f26:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f29:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801f2c:	85 c9                	test   %ecx,%ecx
+  801f2e:	74 20                	je     801f50 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801f30:	89 f8                	mov    %edi,%eax
+  801f32:	09 c8                	or     %ecx,%eax
+  801f34:	a8 03                	test   $0x3,%al
+  801f36:	75 12                	jne    801f4a <memset+0x28>
+		c &= 0xFF;
+  801f38:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801f3c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801f42:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801f45:	fc                   	cld
+  801f46:	f3 ab                	rep stos %eax,%es:(%edi)
+  801f48:	eb 06                	jmp    801f50 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801f4a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f4d:	fc                   	cld
+  801f4e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801f50:	89 f8                	mov    %edi,%eax
+  801f52:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801f55:	c9                   	leave
+  801f56:	c3                   	ret
+
+00801f57 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801f57:	55                   	push   %ebp
+  801f58:	89 e5                	mov    %esp,%ebp
+  801f5a:	57                   	push   %edi
+  801f5b:	56                   	push   %esi
+  801f5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f62:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801f65:	39 c6                	cmp    %eax,%esi
+  801f67:	73 32                	jae    801f9b <memmove+0x44>
+  801f69:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801f6c:	39 d0                	cmp    %edx,%eax
+  801f6e:	73 2b                	jae    801f9b <memmove+0x44>
+		s += n;
+		d += n;
+  801f70:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f73:	89 d6                	mov    %edx,%esi
+  801f75:	09 fe                	or     %edi,%esi
+  801f77:	09 ce                	or     %ecx,%esi
+  801f79:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801f7f:	75 0e                	jne    801f8f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801f81:	83 ef 04             	sub    $0x4,%edi
+  801f84:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801f87:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801f8a:	fd                   	std
+  801f8b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801f8d:	eb 09                	jmp    801f98 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801f8f:	83 ef 01             	sub    $0x1,%edi
+  801f92:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801f95:	fd                   	std
+  801f96:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801f98:	fc                   	cld
+  801f99:	eb 1a                	jmp    801fb5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f9b:	89 f2                	mov    %esi,%edx
+  801f9d:	09 c2                	or     %eax,%edx
+  801f9f:	09 ca                	or     %ecx,%edx
+  801fa1:	f6 c2 03             	test   $0x3,%dl
+  801fa4:	75 0a                	jne    801fb0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801fa6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801fa9:	89 c7                	mov    %eax,%edi
+  801fab:	fc                   	cld
+  801fac:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fae:	eb 05                	jmp    801fb5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801fb0:	89 c7                	mov    %eax,%edi
+  801fb2:	fc                   	cld
+  801fb3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801fb5:	5e                   	pop    %esi
+  801fb6:	5f                   	pop    %edi
+  801fb7:	5d                   	pop    %ebp
+  801fb8:	c3                   	ret
+
+00801fb9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801fb9:	55                   	push   %ebp
+  801fba:	89 e5                	mov    %esp,%ebp
+  801fbc:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801fbf:	ff 75 10             	push   0x10(%ebp)
+  801fc2:	ff 75 0c             	push   0xc(%ebp)
+  801fc5:	ff 75 08             	push   0x8(%ebp)
+  801fc8:	e8 8a ff ff ff       	call   801f57 <memmove>
+}
+  801fcd:	c9                   	leave
+  801fce:	c3                   	ret
+
+00801fcf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801fcf:	55                   	push   %ebp
+  801fd0:	89 e5                	mov    %esp,%ebp
+  801fd2:	56                   	push   %esi
+  801fd3:	53                   	push   %ebx
+  801fd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801fda:	89 c6                	mov    %eax,%esi
+  801fdc:	03 75 10             	add    0x10(%ebp),%esi
+  801fdf:	eb 06                	jmp    801fe7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801fe1:	83 c0 01             	add    $0x1,%eax
+  801fe4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801fe7:	39 f0                	cmp    %esi,%eax
+  801fe9:	74 14                	je     801fff <memcmp+0x30>
+		if (*s1 != *s2)
+  801feb:	0f b6 08             	movzbl (%eax),%ecx
+  801fee:	0f b6 1a             	movzbl (%edx),%ebx
+  801ff1:	38 d9                	cmp    %bl,%cl
+  801ff3:	74 ec                	je     801fe1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801ff5:	0f b6 c1             	movzbl %cl,%eax
+  801ff8:	0f b6 db             	movzbl %bl,%ebx
+  801ffb:	29 d8                	sub    %ebx,%eax
+  801ffd:	eb 05                	jmp    802004 <memcmp+0x35>
+	}
+
+	return 0;
+  801fff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802004:	5b                   	pop    %ebx
+  802005:	5e                   	pop    %esi
+  802006:	5d                   	pop    %ebp
+  802007:	c3                   	ret
+
+00802008 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802008:	55                   	push   %ebp
+  802009:	89 e5                	mov    %esp,%ebp
+  80200b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80200e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802011:	89 c2                	mov    %eax,%edx
+  802013:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802016:	eb 03                	jmp    80201b <memfind+0x13>
+  802018:	83 c0 01             	add    $0x1,%eax
+  80201b:	39 d0                	cmp    %edx,%eax
+  80201d:	73 04                	jae    802023 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80201f:	38 08                	cmp    %cl,(%eax)
+  802021:	75 f5                	jne    802018 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802023:	5d                   	pop    %ebp
+  802024:	c3                   	ret
+
+00802025 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802025:	55                   	push   %ebp
+  802026:	89 e5                	mov    %esp,%ebp
+  802028:	57                   	push   %edi
+  802029:	56                   	push   %esi
+  80202a:	53                   	push   %ebx
+  80202b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80202e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802031:	eb 03                	jmp    802036 <strtol+0x11>
+		s++;
+  802033:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802036:	0f b6 02             	movzbl (%edx),%eax
+  802039:	3c 20                	cmp    $0x20,%al
+  80203b:	74 f6                	je     802033 <strtol+0xe>
+  80203d:	3c 09                	cmp    $0x9,%al
+  80203f:	74 f2                	je     802033 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802041:	3c 2b                	cmp    $0x2b,%al
+  802043:	74 2a                	je     80206f <strtol+0x4a>
+	int neg = 0;
+  802045:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80204a:	3c 2d                	cmp    $0x2d,%al
+  80204c:	74 2b                	je     802079 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80204e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802054:	75 0f                	jne    802065 <strtol+0x40>
+  802056:	80 3a 30             	cmpb   $0x30,(%edx)
+  802059:	74 28                	je     802083 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80205b:	85 db                	test   %ebx,%ebx
+  80205d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802062:	0f 44 d8             	cmove  %eax,%ebx
+  802065:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80206a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80206d:	eb 46                	jmp    8020b5 <strtol+0x90>
+		s++;
+  80206f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802072:	bf 00 00 00 00       	mov    $0x0,%edi
+  802077:	eb d5                	jmp    80204e <strtol+0x29>
+		s++, neg = 1;
+  802079:	83 c2 01             	add    $0x1,%edx
+  80207c:	bf 01 00 00 00       	mov    $0x1,%edi
+  802081:	eb cb                	jmp    80204e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802083:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802087:	74 0e                	je     802097 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802089:	85 db                	test   %ebx,%ebx
+  80208b:	75 d8                	jne    802065 <strtol+0x40>
+		s++, base = 8;
+  80208d:	83 c2 01             	add    $0x1,%edx
+  802090:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802095:	eb ce                	jmp    802065 <strtol+0x40>
+		s += 2, base = 16;
+  802097:	83 c2 02             	add    $0x2,%edx
+  80209a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80209f:	eb c4                	jmp    802065 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8020a1:	0f be c0             	movsbl %al,%eax
+  8020a4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8020a7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8020aa:	7d 3a                	jge    8020e6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8020ac:	83 c2 01             	add    $0x1,%edx
+  8020af:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8020b3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8020b5:	0f b6 02             	movzbl (%edx),%eax
+  8020b8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8020bb:	89 f3                	mov    %esi,%ebx
+  8020bd:	80 fb 09             	cmp    $0x9,%bl
+  8020c0:	76 df                	jbe    8020a1 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8020c2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8020c5:	89 f3                	mov    %esi,%ebx
+  8020c7:	80 fb 19             	cmp    $0x19,%bl
+  8020ca:	77 08                	ja     8020d4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8020cc:	0f be c0             	movsbl %al,%eax
+  8020cf:	83 e8 57             	sub    $0x57,%eax
+  8020d2:	eb d3                	jmp    8020a7 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8020d4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8020d7:	89 f3                	mov    %esi,%ebx
+  8020d9:	80 fb 19             	cmp    $0x19,%bl
+  8020dc:	77 08                	ja     8020e6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8020de:	0f be c0             	movsbl %al,%eax
+  8020e1:	83 e8 37             	sub    $0x37,%eax
+  8020e4:	eb c1                	jmp    8020a7 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8020e6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8020ea:	74 05                	je     8020f1 <strtol+0xcc>
+		*endptr = (char *) s;
+  8020ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020ef:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8020f1:	89 c8                	mov    %ecx,%eax
+  8020f3:	f7 d8                	neg    %eax
+  8020f5:	85 ff                	test   %edi,%edi
+  8020f7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8020fa:	89 c8                	mov    %ecx,%eax
+  8020fc:	5b                   	pop    %ebx
+  8020fd:	5e                   	pop    %esi
+  8020fe:	5f                   	pop    %edi
+  8020ff:	5d                   	pop    %ebp
+  802100:	c3                   	ret
+
+00802101 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  802101:	55                   	push   %ebp
+  802102:	89 e5                	mov    %esp,%ebp
+  802104:	57                   	push   %edi
+  802105:	56                   	push   %esi
+  802106:	53                   	push   %ebx
+  802107:	83 ec 0c             	sub    $0xc,%esp
+  80210a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80210d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802110:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  802113:	85 ff                	test   %edi,%edi
+  802115:	74 16                	je     80212d <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  802117:	83 ec 04             	sub    $0x4,%esp
+  80211a:	56                   	push   %esi
+  80211b:	6a 00                	push   $0x0
+  80211d:	53                   	push   %ebx
+  80211e:	e8 02 ff ff ff       	call   802025 <strtol>
+  802123:	89 07                	mov    %eax,(%edi)
+  802125:	83 c4 10             	add    $0x10,%esp
+  802128:	eb 03                	jmp    80212d <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  80212a:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  80212d:	0f b6 03             	movzbl (%ebx),%eax
+  802130:	3c 20                	cmp    $0x20,%al
+  802132:	74 f6                	je     80212a <strisl+0x29>
+  802134:	3c 09                	cmp    $0x9,%al
+  802136:	74 f2                	je     80212a <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  802138:	3c 2b                	cmp    $0x2b,%al
+  80213a:	74 23                	je     80215f <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  80213c:	3c 2d                	cmp    $0x2d,%al
+  80213e:	0f 94 c0             	sete   %al
+  802141:	0f b6 c0             	movzbl %al,%eax
+  802144:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802146:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  80214c:	75 41                	jne    80218f <strisl+0x8e>
+  80214e:	80 3b 30             	cmpb   $0x30,(%ebx)
+  802151:	74 11                	je     802164 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802153:	85 f6                	test   %esi,%esi
+  802155:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80215a:	0f 44 f0             	cmove  %eax,%esi
+  80215d:	eb 30                	jmp    80218f <strisl+0x8e>
+		s++;
+  80215f:	83 c3 01             	add    $0x1,%ebx
+  802162:	eb e2                	jmp    802146 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802164:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  802168:	74 0e                	je     802178 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  80216a:	85 f6                	test   %esi,%esi
+  80216c:	75 21                	jne    80218f <strisl+0x8e>
+		s++, base = 8;
+  80216e:	83 c3 01             	add    $0x1,%ebx
+  802171:	be 08 00 00 00       	mov    $0x8,%esi
+  802176:	eb 17                	jmp    80218f <strisl+0x8e>
+		s += 2, base = 16;
+  802178:	83 c3 02             	add    $0x2,%ebx
+  80217b:	be 10 00 00 00       	mov    $0x10,%esi
+  802180:	eb 0d                	jmp    80218f <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802182:	0f be c0             	movsbl %al,%eax
+  802185:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  802188:	39 f0                	cmp    %esi,%eax
+  80218a:	7d 38                	jge    8021c4 <strisl+0xc3>
+			return 0;
+		s++;
+  80218c:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  80218f:	0f b6 03             	movzbl (%ebx),%eax
+  802192:	8d 50 d0             	lea    -0x30(%eax),%edx
+  802195:	80 fa 09             	cmp    $0x9,%dl
+  802198:	76 e8                	jbe    802182 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  80219a:	8d 50 9f             	lea    -0x61(%eax),%edx
+  80219d:	80 fa 19             	cmp    $0x19,%dl
+  8021a0:	77 08                	ja     8021aa <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  8021a2:	0f be c0             	movsbl %al,%eax
+  8021a5:	83 e8 57             	sub    $0x57,%eax
+  8021a8:	eb de                	jmp    802188 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  8021aa:	8d 50 bf             	lea    -0x41(%eax),%edx
+  8021ad:	80 fa 19             	cmp    $0x19,%dl
+  8021b0:	77 08                	ja     8021ba <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  8021b2:	0f be c0             	movsbl %al,%eax
+  8021b5:	83 e8 37             	sub    $0x37,%eax
+  8021b8:	eb ce                	jmp    802188 <strisl+0x87>
+		else if (!*s)
+  8021ba:	84 c0                	test   %al,%al
+  8021bc:	0f 94 c0             	sete   %al
+  8021bf:	0f b6 c0             	movzbl %al,%eax
+  8021c2:	eb 05                	jmp    8021c9 <strisl+0xc8>
+			return 0;
+  8021c4:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  8021c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021cc:	5b                   	pop    %ebx
+  8021cd:	5e                   	pop    %esi
+  8021ce:	5f                   	pop    %edi
+  8021cf:	5d                   	pop    %ebp
+  8021d0:	c3                   	ret
+
+008021d1 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8021d1:	55                   	push   %ebp
+  8021d2:	89 e5                	mov    %esp,%ebp
+  8021d4:	57                   	push   %edi
+  8021d5:	56                   	push   %esi
+  8021d6:	53                   	push   %ebx
+  8021d7:	83 ec 14             	sub    $0x14,%esp
+  8021da:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021dd:	8b 75 14             	mov    0x14(%ebp),%esi
+  8021e0:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8021e3:	ff 75 10             	push   0x10(%ebp)
+  8021e6:	ff 75 0c             	push   0xc(%ebp)
+  8021e9:	e8 c9 e3 ff ff       	call   8005b7 <sys_ipc_recv_pages>
+  8021ee:	83 c4 10             	add    $0x10,%esp
+  8021f1:	85 c0                	test   %eax,%eax
+  8021f3:	78 46                	js     80223b <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8021f5:	85 ff                	test   %edi,%edi
+  8021f7:	74 0d                	je     802206 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  8021f9:	a1 08 40 80 00       	mov    0x804008,%eax
+  8021fe:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802204:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802206:	85 f6                	test   %esi,%esi
+  802208:	74 0d                	je     802217 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  80220a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80220f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802215:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802217:	85 db                	test   %ebx,%ebx
+  802219:	74 0d                	je     802228 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  80221b:	a1 08 40 80 00       	mov    0x804008,%eax
+  802220:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802226:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802228:	a1 08 40 80 00       	mov    0x804008,%eax
+  80222d:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802233:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802236:	5b                   	pop    %ebx
+  802237:	5e                   	pop    %esi
+  802238:	5f                   	pop    %edi
+  802239:	5d                   	pop    %ebp
+  80223a:	c3                   	ret
+		if (from_env_store) {
+  80223b:	85 ff                	test   %edi,%edi
+  80223d:	74 06                	je     802245 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80223f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802245:	85 f6                	test   %esi,%esi
+  802247:	74 06                	je     80224f <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  802249:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80224f:	85 db                	test   %ebx,%ebx
+  802251:	74 e0                	je     802233 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  802253:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802259:	eb d8                	jmp    802233 <ipc_recv_pages+0x62>
+
+0080225b <ipc_recv>:
+{
+  80225b:	55                   	push   %ebp
+  80225c:	89 e5                	mov    %esp,%ebp
+  80225e:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  802261:	6a 00                	push   $0x0
+  802263:	ff 75 10             	push   0x10(%ebp)
+  802266:	6a 01                	push   $0x1
+  802268:	ff 75 0c             	push   0xc(%ebp)
+  80226b:	ff 75 08             	push   0x8(%ebp)
+  80226e:	e8 5e ff ff ff       	call   8021d1 <ipc_recv_pages>
+}
+  802273:	c9                   	leave
+  802274:	c3                   	ret
+
+00802275 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802275:	55                   	push   %ebp
+  802276:	89 e5                	mov    %esp,%ebp
+  802278:	56                   	push   %esi
+  802279:	53                   	push   %ebx
+  80227a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80227d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  802280:	83 ec 0c             	sub    $0xc,%esp
+  802283:	ff 75 0c             	push   0xc(%ebp)
+  802286:	e8 60 e4 ff ff       	call   8006eb <sys_ipc_try_recv>
+  80228b:	83 c4 10             	add    $0x10,%esp
+  80228e:	85 c0                	test   %eax,%eax
+  802290:	78 34                	js     8022c6 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802292:	85 f6                	test   %esi,%esi
+  802294:	74 0d                	je     8022a3 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  802296:	a1 08 40 80 00       	mov    0x804008,%eax
+  80229b:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8022a1:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8022a3:	85 db                	test   %ebx,%ebx
+  8022a5:	74 0d                	je     8022b4 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8022a7:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022ac:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8022b2:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8022b4:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022b9:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8022bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022c2:	5b                   	pop    %ebx
+  8022c3:	5e                   	pop    %esi
+  8022c4:	5d                   	pop    %ebp
+  8022c5:	c3                   	ret
+		if (from_env_store) {
+  8022c6:	85 f6                	test   %esi,%esi
+  8022c8:	74 06                	je     8022d0 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8022ca:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8022d0:	85 db                	test   %ebx,%ebx
+  8022d2:	74 eb                	je     8022bf <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8022d4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8022da:	eb e3                	jmp    8022bf <ipc_try_recv+0x4a>
+
+008022dc <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8022dc:	55                   	push   %ebp
+  8022dd:	89 e5                	mov    %esp,%ebp
+  8022df:	83 ec 14             	sub    $0x14,%esp
+  8022e2:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8022e5:	85 c0                	test   %eax,%eax
+  8022e7:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8022ec:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8022ef:	ff 75 18             	push   0x18(%ebp)
+  8022f2:	ff 75 14             	push   0x14(%ebp)
+  8022f5:	50                   	push   %eax
+  8022f6:	ff 75 0c             	push   0xc(%ebp)
+  8022f9:	ff 75 08             	push   0x8(%ebp)
+  8022fc:	e8 79 e2 ff ff       	call   80057a <sys_ipc_send_pages>
+  802301:	83 c4 20             	add    $0x20,%esp
+  802304:	85 c0                	test   %eax,%eax
+  802306:	78 02                	js     80230a <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  802308:	c9                   	leave
+  802309:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  80230a:	50                   	push   %eax
+  80230b:	68 2c 2b 80 00       	push   $0x802b2c
+  802310:	68 80 00 00 00       	push   $0x80
+  802315:	68 58 2b 80 00       	push   $0x802b58
+  80231a:	e8 f0 f3 ff ff       	call   80170f <_panic>
+
+0080231f <ipc_send>:
+{
+  80231f:	55                   	push   %ebp
+  802320:	89 e5                	mov    %esp,%ebp
+  802322:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  802325:	ff 75 14             	push   0x14(%ebp)
+  802328:	6a 01                	push   $0x1
+  80232a:	ff 75 10             	push   0x10(%ebp)
+  80232d:	ff 75 0c             	push   0xc(%ebp)
+  802330:	ff 75 08             	push   0x8(%ebp)
+  802333:	e8 a4 ff ff ff       	call   8022dc <ipc_send_pages>
+}
+  802338:	83 c4 20             	add    $0x20,%esp
+  80233b:	c9                   	leave
+  80233c:	c3                   	ret
+
+0080233d <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80233d:	55                   	push   %ebp
+  80233e:	89 e5                	mov    %esp,%ebp
+  802340:	83 ec 14             	sub    $0x14,%esp
+  802343:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802346:	85 c0                	test   %eax,%eax
+  802348:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80234d:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802350:	ff 75 18             	push   0x18(%ebp)
+  802353:	ff 75 14             	push   0x14(%ebp)
+  802356:	50                   	push   %eax
+  802357:	ff 75 0c             	push   0xc(%ebp)
+  80235a:	ff 75 08             	push   0x8(%ebp)
+  80235d:	e8 a9 e2 ff ff       	call   80060b <sys_ipc_call>
+  802362:	83 c4 20             	add    $0x20,%esp
+  802365:	85 c0                	test   %eax,%eax
+  802367:	78 0b                	js     802374 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  802369:	a1 08 40 80 00       	mov    0x804008,%eax
+  80236e:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802374:	c9                   	leave
+  802375:	c3                   	ret
+
+00802376 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  802376:	55                   	push   %ebp
+  802377:	89 e5                	mov    %esp,%ebp
+  802379:	57                   	push   %edi
+  80237a:	56                   	push   %esi
+  80237b:	53                   	push   %ebx
+  80237c:	83 ec 18             	sub    $0x18,%esp
+  80237f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802382:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  802385:	8b 75 20             	mov    0x20(%ebp),%esi
+  802388:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80238b:	85 c0                	test   %eax,%eax
+  80238d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802392:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802395:	ff 75 18             	push   0x18(%ebp)
+  802398:	ff 75 14             	push   0x14(%ebp)
+  80239b:	50                   	push   %eax
+  80239c:	ff 75 0c             	push   0xc(%ebp)
+  80239f:	ff 75 08             	push   0x8(%ebp)
+  8023a2:	e8 a5 e2 ff ff       	call   80064c <sys_ipc_reply_recv>
+  8023a7:	83 c4 20             	add    $0x20,%esp
+  8023aa:	85 c0                	test   %eax,%eax
+  8023ac:	78 46                	js     8023f4 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8023ae:	85 ff                	test   %edi,%edi
+  8023b0:	74 0d                	je     8023bf <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8023b2:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023b7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8023bd:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8023bf:	85 f6                	test   %esi,%esi
+  8023c1:	74 0d                	je     8023d0 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8023c3:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023c8:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8023ce:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8023d0:	85 db                	test   %ebx,%ebx
+  8023d2:	74 0d                	je     8023e1 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8023d4:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023d9:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8023df:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8023e1:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023e6:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8023ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023ef:	5b                   	pop    %ebx
+  8023f0:	5e                   	pop    %esi
+  8023f1:	5f                   	pop    %edi
+  8023f2:	5d                   	pop    %ebp
+  8023f3:	c3                   	ret
+		if (from_env_store) {
+  8023f4:	85 ff                	test   %edi,%edi
+  8023f6:	74 06                	je     8023fe <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  8023f8:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8023fe:	85 f6                	test   %esi,%esi
+  802400:	74 06                	je     802408 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  802402:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802408:	85 db                	test   %ebx,%ebx
+  80240a:	74 e0                	je     8023ec <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  80240c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802412:	eb d8                	jmp    8023ec <ipc_reply_recv+0x76>
+
+00802414 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802414:	55                   	push   %ebp
+  802415:	89 e5                	mov    %esp,%ebp
+  802417:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80241a:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80241f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802422:	c1 e0 06             	shl    $0x6,%eax
+  802425:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80242a:	8b 40 50             	mov    0x50(%eax),%eax
+  80242d:	39 c8                	cmp    %ecx,%eax
+  80242f:	74 12                	je     802443 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802431:	83 c2 01             	add    $0x1,%edx
+  802434:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80243a:	75 e3                	jne    80241f <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80243c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802441:	eb 0e                	jmp    802451 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802443:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802446:	c1 e0 06             	shl    $0x6,%eax
+  802449:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80244e:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802451:	5d                   	pop    %ebp
+  802452:	c3                   	ret
+
+00802453 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802453:	55                   	push   %ebp
+  802454:	89 e5                	mov    %esp,%ebp
+  802456:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802459:	89 c2                	mov    %eax,%edx
+  80245b:	c1 ea 16             	shr    $0x16,%edx
+  80245e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802465:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80246a:	f6 c1 01             	test   $0x1,%cl
+  80246d:	74 1e                	je     80248d <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  80246f:	c1 e8 0c             	shr    $0xc,%eax
+  802472:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802479:	a8 01                	test   $0x1,%al
+  80247b:	74 10                	je     80248d <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80247d:	c1 e8 0c             	shr    $0xc,%eax
+  802480:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802483:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  80248a:	0f b7 d2             	movzwl %dx,%edx
+}
+  80248d:	89 d0                	mov    %edx,%eax
+  80248f:	5d                   	pop    %ebp
+  802490:	c3                   	ret
+
+00802491 <udivmod>:
+  802491:	55                   	push   %ebp
+  802492:	57                   	push   %edi
+  802493:	56                   	push   %esi
+  802494:	53                   	push   %ebx
+  802495:	83 ec 24             	sub    $0x24,%esp
+  802498:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80249c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8024a0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8024a4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8024a8:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024ac:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024b0:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8024b4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024ca:	00 
+  8024cb:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024d2:	00 
+  8024d3:	89 fb                	mov    %edi,%ebx
+  8024d5:	eb 08                	jmp    8024df <udivmod+0x4e>
+  8024d7:	83 e9 01             	sub    $0x1,%ecx
+  8024da:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8024dd:	74 68                	je     802547 <udivmod+0xb6>
+  8024df:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024e3:	01 c0                	add    %eax,%eax
+  8024e5:	89 c6                	mov    %eax,%esi
+  8024e7:	89 d7                	mov    %edx,%edi
+  8024e9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8024ed:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8024f1:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024f4:	d3 ea                	shr    %cl,%edx
+  8024f6:	f6 c1 20             	test   $0x20,%cl
+  8024f9:	74 04                	je     8024ff <udivmod+0x6e>
+  8024fb:	89 d0                	mov    %edx,%eax
+  8024fd:	31 d2                	xor    %edx,%edx
+  8024ff:	83 e0 01             	and    $0x1,%eax
+  802502:	89 04 24             	mov    %eax,(%esp)
+  802505:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80250c:	00 
+  80250d:	8b 04 24             	mov    (%esp),%eax
+  802510:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802514:	09 f0                	or     %esi,%eax
+  802516:	09 fa                	or     %edi,%edx
+  802518:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80251c:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802520:	39 f0                	cmp    %esi,%eax
+  802522:	89 d5                	mov    %edx,%ebp
+  802524:	19 fd                	sbb    %edi,%ebp
+  802526:	72 af                	jb     8024d7 <udivmod+0x46>
+  802528:	29 f0                	sub    %esi,%eax
+  80252a:	19 fa                	sbb    %edi,%edx
+  80252c:	89 cf                	mov    %ecx,%edi
+  80252e:	c1 ef 05             	shr    $0x5,%edi
+  802531:	83 e7 01             	and    $0x1,%edi
+  802534:	89 fe                	mov    %edi,%esi
+  802536:	83 f6 01             	xor    $0x1,%esi
+  802539:	d3 e6                	shl    %cl,%esi
+  80253b:	d3 e7                	shl    %cl,%edi
+  80253d:	09 74 24 18          	or     %esi,0x18(%esp)
+  802541:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802545:	eb 90                	jmp    8024d7 <udivmod+0x46>
+  802547:	85 db                	test   %ebx,%ebx
+  802549:	74 05                	je     802550 <udivmod+0xbf>
+  80254b:	89 03                	mov    %eax,(%ebx)
+  80254d:	89 53 04             	mov    %edx,0x4(%ebx)
+  802550:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802554:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802558:	83 c4 24             	add    $0x24,%esp
+  80255b:	5b                   	pop    %ebx
+  80255c:	5e                   	pop    %esi
+  80255d:	5f                   	pop    %edi
+  80255e:	5d                   	pop    %ebp
+  80255f:	c3                   	ret
+
+00802560 <__udivdi3>:
+  802560:	83 ec 08             	sub    $0x8,%esp
+  802563:	6a 00                	push   $0x0
+  802565:	ff 74 24 1c          	push   0x1c(%esp)
+  802569:	ff 74 24 1c          	push   0x1c(%esp)
+  80256d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802571:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802575:	e8 17 ff ff ff       	call   802491 <udivmod>
+  80257a:	83 c4 14             	add    $0x14,%esp
+  80257d:	c3                   	ret
+
+0080257e <__umoddi3>:
+  80257e:	83 ec 18             	sub    $0x18,%esp
+  802581:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802585:	50                   	push   %eax
+  802586:	ff 74 24 2c          	push   0x2c(%esp)
+  80258a:	ff 74 24 2c          	push   0x2c(%esp)
+  80258e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802592:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802596:	e8 f6 fe ff ff       	call   802491 <udivmod>
+  80259b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80259f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025a3:	83 c4 24             	add    $0x24,%esp
+  8025a6:	c3                   	ret
+
+008025a7 <__divdi3>:
+  8025a7:	55                   	push   %ebp
+  8025a8:	57                   	push   %edi
+  8025a9:	56                   	push   %esi
+  8025aa:	53                   	push   %ebx
+  8025ab:	83 ec 10             	sub    $0x10,%esp
+  8025ae:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8025b2:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8025b6:	89 c6                	mov    %eax,%esi
+  8025b8:	89 d7                	mov    %edx,%edi
+  8025ba:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8025be:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8025c2:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025c6:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8025ca:	89 c5                	mov    %eax,%ebp
+  8025cc:	f7 dd                	neg    %ebp
+  8025ce:	89 d6                	mov    %edx,%esi
+  8025d0:	83 d6 00             	adc    $0x0,%esi
+  8025d3:	f7 de                	neg    %esi
+  8025d5:	0f 48 e8             	cmovs  %eax,%ebp
+  8025d8:	0f 49 d6             	cmovns %esi,%edx
+  8025db:	6a 00                	push   $0x0
+  8025dd:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8025e1:	f7 de                	neg    %esi
+  8025e3:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8025e7:	83 d0 00             	adc    $0x0,%eax
+  8025ea:	f7 d8                	neg    %eax
+  8025ec:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  8025f1:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  8025f6:	50                   	push   %eax
+  8025f7:	56                   	push   %esi
+  8025f8:	89 e8                	mov    %ebp,%eax
+  8025fa:	e8 92 fe ff ff       	call   802491 <udivmod>
+  8025ff:	83 c4 10             	add    $0x10,%esp
+  802602:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  802607:	78 08                	js     802611 <__divdi3+0x6a>
+  802609:	83 c4 0c             	add    $0xc,%esp
+  80260c:	5b                   	pop    %ebx
+  80260d:	5e                   	pop    %esi
+  80260e:	5f                   	pop    %edi
+  80260f:	5d                   	pop    %ebp
+  802610:	c3                   	ret
+  802611:	f7 d8                	neg    %eax
+  802613:	83 d2 00             	adc    $0x0,%edx
+  802616:	f7 da                	neg    %edx
+  802618:	eb ef                	jmp    802609 <__divdi3+0x62>
+
+0080261a <__moddi3>:
+  80261a:	55                   	push   %ebp
+  80261b:	57                   	push   %edi
+  80261c:	56                   	push   %esi
+  80261d:	53                   	push   %ebx
+  80261e:	83 ec 18             	sub    $0x18,%esp
+  802621:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802625:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802629:	89 f1                	mov    %esi,%ecx
+  80262b:	f7 d9                	neg    %ecx
+  80262d:	89 da                	mov    %ebx,%edx
+  80262f:	83 d2 00             	adc    $0x0,%edx
+  802632:	f7 da                	neg    %edx
+  802634:	0f 48 ce             	cmovs  %esi,%ecx
+  802637:	0f 48 d3             	cmovs  %ebx,%edx
+  80263a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80263e:	50                   	push   %eax
+  80263f:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802643:	f7 de                	neg    %esi
+  802645:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802649:	83 d0 00             	adc    $0x0,%eax
+  80264c:	f7 d8                	neg    %eax
+  80264e:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802653:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802658:	50                   	push   %eax
+  802659:	56                   	push   %esi
+  80265a:	89 c8                	mov    %ecx,%eax
+  80265c:	e8 30 fe ff ff       	call   802491 <udivmod>
+  802661:	83 c4 10             	add    $0x10,%esp
+  802664:	85 db                	test   %ebx,%ebx
+  802666:	78 10                	js     802678 <__moddi3+0x5e>
+  802668:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80266c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802670:	83 c4 14             	add    $0x14,%esp
+  802673:	5b                   	pop    %ebx
+  802674:	5e                   	pop    %esi
+  802675:	5f                   	pop    %edi
+  802676:	5d                   	pop    %ebp
+  802677:	c3                   	ret
+  802678:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80267c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802680:	f7 d8                	neg    %eax
+  802682:	83 d2 00             	adc    $0x0,%edx
+  802685:	f7 da                	neg    %edx
+  802687:	eb e7                	jmp    802670 <__moddi3+0x56>
@@ -0,0 +1,10916 @@
+
+obj/user/forkfallback.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 cf 03 00 00       	call   800400 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <fill>:
+// Pages [BASE, held) were taken to use up free memory
+uintptr_t held = BASE;
+
+static void
+fill(uint32_t tag)
+{
+  800033:	ba 00 00 00 00       	mov    $0x0,%edx
+	int i;
+
+	for (i = 0; i < NPAGES; i++) {
+		data[i*PGSIZE/sizeof(uint32_t)] = tag + i;
+  800038:	89 d1                	mov    %edx,%ecx
+  80003a:	c1 e9 02             	shr    $0x2,%ecx
+  80003d:	89 04 8d 20 70 80 00 	mov    %eax,0x807020(,%ecx,4)
+		bss[i*PGSIZE/sizeof(uint32_t)] = tag + i;
+  800044:	89 04 8d 20 f9 81 00 	mov    %eax,0x81f920(,%ecx,4)
+		((uint32_t*) BACKED)[i*PGSIZE/sizeof(uint32_t)] = tag + i;
+  80004b:	89 82 00 00 00 30    	mov    %eax,0x30000000(%edx)
+	for (i = 0; i < NPAGES; i++) {
+  800051:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  800057:	83 c0 01             	add    $0x1,%eax
+  80005a:	81 fa 00 00 01 00    	cmp    $0x10000,%edx
+  800060:	75 d6                	jne    800038 <fill+0x5>
+	}
+}
+  800062:	c3                   	ret
+
+00800063 <check>:
+
+static void
+check(uint32_t tag, const char *who)
+{
+  800063:	55                   	push   %ebp
+  800064:	89 e5                	mov    %esp,%ebp
+  800066:	57                   	push   %edi
+  800067:	56                   	push   %esi
+  800068:	53                   	push   %ebx
+  800069:	83 ec 0c             	sub    $0xc,%esp
+  80006c:	89 d6                	mov    %edx,%esi
+  80006e:	bb 00 00 00 30       	mov    $0x30000000,%ebx
+	int i;
+
+	for (i = 0; i < NPAGES; i++) {
+  800073:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (data[i*PGSIZE/sizeof(uint32_t)] != tag + i)
+  800078:	89 ca                	mov    %ecx,%edx
+  80007a:	c1 e2 0c             	shl    $0xc,%edx
+  80007d:	c1 ea 02             	shr    $0x2,%edx
+  800080:	8b 3c 95 20 70 80 00 	mov    0x807020(,%edx,4),%edi
+  800087:	39 c7                	cmp    %eax,%edi
+  800089:	75 2a                	jne    8000b5 <check+0x52>
+			panic("%s: .data page %d holds %x", who, i, data[i*PGSIZE/sizeof(uint32_t)]);
+		if (bss[i*PGSIZE/sizeof(uint32_t)] != tag + i)
+  80008b:	8b 14 95 20 f9 81 00 	mov    0x81f920(,%edx,4),%edx
+  800092:	39 c2                	cmp    %eax,%edx
+  800094:	75 36                	jne    8000cc <check+0x69>
+			panic("%s: .bss page %d holds %x", who, i, bss[i*PGSIZE/sizeof(uint32_t)]);
+		if (((uint32_t*) BACKED)[i*PGSIZE/sizeof(uint32_t)] != tag + i)
+  800096:	8b 13                	mov    (%ebx),%edx
+  800098:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80009e:	39 c2                	cmp    %eax,%edx
+  8000a0:	75 41                	jne    8000e3 <check+0x80>
+	for (i = 0; i < NPAGES; i++) {
+  8000a2:	83 c1 01             	add    $0x1,%ecx
+  8000a5:	83 c0 01             	add    $0x1,%eax
+  8000a8:	83 f9 10             	cmp    $0x10,%ecx
+  8000ab:	75 cb                	jne    800078 <check+0x15>
+			panic("%s: backed page %d holds %x", who, i,
+			      ((uint32_t*) BACKED)[i*PGSIZE/sizeof(uint32_t)]);
+	}
+}
+  8000ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000b0:	5b                   	pop    %ebx
+  8000b1:	5e                   	pop    %esi
+  8000b2:	5f                   	pop    %edi
+  8000b3:	5d                   	pop    %ebp
+  8000b4:	c3                   	ret
+			panic("%s: .data page %d holds %x", who, i, data[i*PGSIZE/sizeof(uint32_t)]);
+  8000b5:	83 ec 08             	sub    $0x8,%esp
+  8000b8:	57                   	push   %edi
+  8000b9:	51                   	push   %ecx
+  8000ba:	56                   	push   %esi
+  8000bb:	68 40 56 80 00       	push   $0x805640
+  8000c0:	6a 2b                	push   $0x2b
+  8000c2:	68 44 57 80 00       	push   $0x805744
+  8000c7:	e8 97 03 00 00       	call   800463 <_panic>
+			panic("%s: .bss page %d holds %x", who, i, bss[i*PGSIZE/sizeof(uint32_t)]);
+  8000cc:	83 ec 08             	sub    $0x8,%esp
+  8000cf:	52                   	push   %edx
+  8000d0:	51                   	push   %ecx
+  8000d1:	56                   	push   %esi
+  8000d2:	68 5b 56 80 00       	push   $0x80565b
+  8000d7:	6a 2d                	push   $0x2d
+  8000d9:	68 44 57 80 00       	push   $0x805744
+  8000de:	e8 80 03 00 00       	call   800463 <_panic>
+			panic("%s: backed page %d holds %x", who, i,
+  8000e3:	83 ec 08             	sub    $0x8,%esp
+  8000e6:	52                   	push   %edx
+  8000e7:	51                   	push   %ecx
+  8000e8:	56                   	push   %esi
+  8000e9:	68 75 56 80 00       	push   $0x805675
+  8000ee:	6a 2f                	push   $0x2f
+  8000f0:	68 44 57 80 00       	push   $0x805744
+  8000f5:	e8 69 03 00 00       	call   800463 <_panic>
+
+008000fa <give_back>:
+static void
+give_back(void)
+{
+	int r;
+
+	if (held > BASE && (r = sys_page_unmap_range(0, (void*) BASE, (held - BASE) / PGSIZE)) < 0)
+  8000fa:	a1 00 70 80 00       	mov    0x807000,%eax
+  8000ff:	3d 00 00 00 40       	cmp    $0x40000000,%eax
+  800104:	77 0b                	ja     800111 <give_back+0x17>
+		panic("sys_page_unmap_range: %e", r);
+	held = BASE;
+  800106:	c7 05 00 70 80 00 00 	movl   $0x40000000,0x807000
+  80010d:	00 00 40 
+  800110:	c3                   	ret
+{
+  800111:	55                   	push   %ebp
+  800112:	89 e5                	mov    %esp,%ebp
+  800114:	83 ec 0c             	sub    $0xc,%esp
+	if (held > BASE && (r = sys_page_unmap_range(0, (void*) BASE, (held - BASE) / PGSIZE)) < 0)
+  800117:	2d 00 00 00 40       	sub    $0x40000000,%eax
+  80011c:	c1 e8 0c             	shr    $0xc,%eax
+  80011f:	50                   	push   %eax
+  800120:	68 00 00 00 40       	push   $0x40000000
+  800125:	6a 00                	push   $0x0
+  800127:	e8 85 10 00 00       	call   8011b1 <sys_page_unmap_range>
+  80012c:	83 c4 10             	add    $0x10,%esp
+  80012f:	85 c0                	test   %eax,%eax
+  800131:	78 0c                	js     80013f <give_back+0x45>
+	held = BASE;
+  800133:	c7 05 00 70 80 00 00 	movl   $0x40000000,0x807000
+  80013a:	00 00 40 
+}
+  80013d:	c9                   	leave
+  80013e:	c3                   	ret
+		panic("sys_page_unmap_range: %e", r);
+  80013f:	50                   	push   %eax
+  800140:	68 91 56 80 00       	push   $0x805691
+  800145:	6a 4e                	push   $0x4e
+  800147:	68 44 57 80 00       	push   $0x805744
+  80014c:	e8 12 03 00 00       	call   800463 <_panic>
+
+00800151 <squeeze>:
+{
+  800151:	55                   	push   %ebp
+  800152:	89 e5                	mov    %esp,%ebp
+  800154:	53                   	push   %ebx
+  800155:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_env_set_rss(0, 0, thisenv->env_npages + 32)) < 0)
+  800158:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  80015d:	8b 40 64             	mov    0x64(%eax),%eax
+  800160:	83 c0 20             	add    $0x20,%eax
+  800163:	50                   	push   %eax
+  800164:	6a 00                	push   $0x0
+  800166:	6a 00                	push   $0x0
+  800168:	e8 7a 11 00 00       	call   8012e7 <sys_env_set_rss>
+  80016d:	83 c4 10             	add    $0x10,%esp
+  800170:	85 c0                	test   %eax,%eax
+  800172:	78 42                	js     8001b6 <squeeze+0x65>
+	for (va = SQUEEZE; va < SQUEEZE + NSQUEEZE*PGSIZE; va += PGSIZE) {
+  800174:	bb 00 00 00 38       	mov    $0x38000000,%ebx
+		if ((r = page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W, 1)) < 0)
+  800179:	6a 01                	push   $0x1
+  80017b:	6a 07                	push   $0x7
+  80017d:	53                   	push   %ebx
+  80017e:	6a 00                	push   $0x0
+  800180:	e8 b5 3c 00 00       	call   803e3a <page_alloc>
+  800185:	83 c4 10             	add    $0x10,%esp
+  800188:	85 c0                	test   %eax,%eax
+  80018a:	78 3c                	js     8001c8 <squeeze+0x77>
+		*(uintptr_t*)va = va;
+  80018c:	89 1b                	mov    %ebx,(%ebx)
+	for (va = SQUEEZE; va < SQUEEZE + NSQUEEZE*PGSIZE; va += PGSIZE) {
+  80018e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800194:	81 fb 00 00 10 38    	cmp    $0x38100000,%ebx
+  80019a:	75 dd                	jne    800179 <squeeze+0x28>
+	for (va = SQUEEZE; va < SQUEEZE + NSQUEEZE*PGSIZE; va += PGSIZE)
+  80019c:	b8 00 00 00 38       	mov    $0x38000000,%eax
+		assert(*(uintptr_t*)va == va);
+  8001a1:	39 00                	cmp    %eax,(%eax)
+  8001a3:	75 39                	jne    8001de <squeeze+0x8d>
+	for (va = SQUEEZE; va < SQUEEZE + NSQUEEZE*PGSIZE; va += PGSIZE)
+  8001a5:	05 00 10 00 00       	add    $0x1000,%eax
+  8001aa:	3d 00 00 10 38       	cmp    $0x38100000,%eax
+  8001af:	75 f0                	jne    8001a1 <squeeze+0x50>
+}
+  8001b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001b4:	c9                   	leave
+  8001b5:	c3                   	ret
+		panic("sys_env_set_rss: %e", r);
+  8001b6:	50                   	push   %eax
+  8001b7:	68 aa 56 80 00       	push   $0x8056aa
+  8001bc:	6a 3d                	push   $0x3d
+  8001be:	68 44 57 80 00       	push   $0x805744
+  8001c3:	e8 9b 02 00 00       	call   800463 <_panic>
+			panic("page_alloc on %p: %e", va, r);
+  8001c8:	83 ec 0c             	sub    $0xc,%esp
+  8001cb:	50                   	push   %eax
+  8001cc:	53                   	push   %ebx
+  8001cd:	68 2c 57 80 00       	push   $0x80572c
+  8001d2:	6a 40                	push   $0x40
+  8001d4:	68 44 57 80 00       	push   $0x805744
+  8001d9:	e8 85 02 00 00       	call   800463 <_panic>
+		assert(*(uintptr_t*)va == va);
+  8001de:	68 be 56 80 00       	push   $0x8056be
+  8001e3:	68 d4 56 80 00       	push   $0x8056d4
+  8001e8:	6a 44                	push   $0x44
+  8001ea:	68 44 57 80 00       	push   $0x805744
+  8001ef:	e8 6f 02 00 00       	call   800463 <_panic>
+
+008001f4 <fork_child>:
+// Fork a child that pages out nearly everything it has, checks that
+// it still sees 'before' everywhere, then writes its own tag and checks
+// that too
+static envid_t
+fork_child(uint32_t before, uint32_t tag)
+{
+  8001f4:	55                   	push   %ebp
+  8001f5:	89 e5                	mov    %esp,%ebp
+  8001f7:	57                   	push   %edi
+  8001f8:	56                   	push   %esi
+  8001f9:	53                   	push   %ebx
+  8001fa:	83 ec 0c             	sub    $0xc,%esp
+  8001fd:	89 c7                	mov    %eax,%edi
+  8001ff:	89 d6                	mov    %edx,%esi
+	envid_t envid;
+
+	if ((envid = fork()) < 0)
+  800201:	e8 f9 14 00 00       	call   8016ff <fork>
+  800206:	89 c3                	mov    %eax,%ebx
+  800208:	85 c0                	test   %eax,%eax
+  80020a:	78 0c                	js     800218 <fork_child+0x24>
+		panic("fork: %e", envid);
+	if (envid == 0) {
+  80020c:	74 1c                	je     80022a <fork_child+0x36>
+		fill(tag);
+		check(tag, "child");
+		exit();
+	}
+	return envid;
+}
+  80020e:	89 d8                	mov    %ebx,%eax
+  800210:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800213:	5b                   	pop    %ebx
+  800214:	5e                   	pop    %esi
+  800215:	5f                   	pop    %edi
+  800216:	5d                   	pop    %ebp
+  800217:	c3                   	ret
+		panic("fork: %e", envid);
+  800218:	50                   	push   %eax
+  800219:	68 e9 56 80 00       	push   $0x8056e9
+  80021e:	6a 5b                	push   $0x5b
+  800220:	68 44 57 80 00       	push   $0x805744
+  800225:	e8 39 02 00 00       	call   800463 <_panic>
+		give_back();
+  80022a:	e8 cb fe ff ff       	call   8000fa <give_back>
+		squeeze();
+  80022f:	e8 1d ff ff ff       	call   800151 <squeeze>
+		check(before, "child");
+  800234:	ba f2 56 80 00       	mov    $0x8056f2,%edx
+  800239:	89 f8                	mov    %edi,%eax
+  80023b:	e8 23 fe ff ff       	call   800063 <check>
+		fill(tag);
+  800240:	89 f0                	mov    %esi,%eax
+  800242:	e8 ec fd ff ff       	call   800033 <fill>
+		check(tag, "child");
+  800247:	ba f2 56 80 00       	mov    $0x8056f2,%edx
+  80024c:	89 f0                	mov    %esi,%eax
+  80024e:	e8 10 fe ff ff       	call   800063 <check>
+		exit();
+  800253:	e8 f1 01 00 00       	call   800449 <exit>
+	return envid;
+  800258:	eb b4                	jmp    80020e <fork_child+0x1a>
+
+0080025a <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80025a:	55                   	push   %ebp
+  80025b:	89 e5                	mov    %esp,%ebp
+  80025d:	53                   	push   %ebx
+  80025e:	83 ec 10             	sub    $0x10,%esp
+	int r;
+	envid_t envid;
+
+	if ((r = page_alloc_range(0, (void*) BACKED, NPAGES, PTE_P|PTE_U|PTE_W, 1)) < 0)
+  800261:	6a 01                	push   $0x1
+  800263:	6a 07                	push   $0x7
+  800265:	6a 10                	push   $0x10
+  800267:	68 00 00 00 30       	push   $0x30000000
+  80026c:	6a 00                	push   $0x0
+  80026e:	e8 30 3f 00 00       	call   8041a3 <page_alloc_range>
+  800273:	83 c4 20             	add    $0x20,%esp
+  800276:	85 c0                	test   %eax,%eax
+  800278:	0f 88 b3 00 00 00    	js     800331 <umain+0xd7>
+		panic("page_alloc_range: %e", r);
+	if ((r = page_add_backed((void*) BACKED, NPAGES*PGSIZE)) < 0)
+  80027e:	83 ec 08             	sub    $0x8,%esp
+  800281:	68 00 00 01 00       	push   $0x10000
+  800286:	68 00 00 00 30       	push   $0x30000000
+  80028b:	e8 95 2c 00 00       	call   802f25 <page_add_backed>
+  800290:	83 c4 10             	add    $0x10,%esp
+  800293:	85 c0                	test   %eax,%eax
+  800295:	0f 88 a8 00 00 00    	js     800343 <umain+0xe9>
+		panic("page_add_backed: %e", r);
+
+	// The kernel's fork: our pages and the child's are separate copies
+	fill(0x1000);
+  80029b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8002a0:	e8 8e fd ff ff       	call   800033 <fill>
+	envid = fork_child(0x1000, 0x2000);
+  8002a5:	ba 00 20 00 00       	mov    $0x2000,%edx
+  8002aa:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8002af:	e8 40 ff ff ff       	call   8001f4 <fork_child>
+  8002b4:	89 c3                	mov    %eax,%ebx
+	check(0x1000, "parent");
+  8002b6:	ba 21 57 80 00       	mov    $0x805721,%edx
+  8002bb:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8002c0:	e8 9e fd ff ff       	call   800063 <check>
+	fill(0x3000);
+  8002c5:	b8 00 30 00 00       	mov    $0x3000,%eax
+  8002ca:	e8 64 fd ff ff       	call   800033 <fill>
+	wait(envid);
+  8002cf:	83 ec 0c             	sub    $0xc,%esp
+  8002d2:	53                   	push   %ebx
+  8002d3:	e8 fb 26 00 00       	call   8029d3 <wait>
+	check(0x3000, "parent");
+  8002d8:	ba 21 57 80 00       	mov    $0x805721,%edx
+  8002dd:	b8 00 30 00 00       	mov    $0x3000,%eax
+  8002e2:	e8 7c fd ff ff       	call   800063 <check>
+	cprintf("forkfallback: sys_fork is good\n");
+  8002e7:	c7 04 24 68 57 80 00 	movl   $0x805768,(%esp)
+  8002ee:	e8 4b 02 00 00       	call   80053e <cprintf>
+
+	// Use up free memory, straight from the kernel so nothing gets
+	// paged out, until sys_fork has to refuse
+	fill(0x4000);
+  8002f3:	b8 00 40 00 00       	mov    $0x4000,%eax
+  8002f8:	e8 36 fd ff ff       	call   800033 <fill>
+	for (held = BASE; held < TOP; held += PGSIZE) {
+  8002fd:	83 c4 10             	add    $0x10,%esp
+  800300:	b8 00 00 00 40       	mov    $0x40000000,%eax
+  800305:	a3 00 70 80 00       	mov    %eax,0x807000
+  80030a:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  80030f:	77 49                	ja     80035a <umain+0x100>
+		if ((r = sys_page_alloc(0, (void*) held, PTE_P|PTE_U|PTE_W)) < 0) {
+  800311:	83 ec 04             	sub    $0x4,%esp
+  800314:	6a 07                	push   $0x7
+  800316:	50                   	push   %eax
+  800317:	6a 00                	push   $0x0
+  800319:	e8 fa 0c 00 00       	call   801018 <sys_page_alloc>
+  80031e:	83 c4 10             	add    $0x10,%esp
+  800321:	85 c0                	test   %eax,%eax
+  800323:	78 30                	js     800355 <umain+0xfb>
+	for (held = BASE; held < TOP; held += PGSIZE) {
+  800325:	a1 00 70 80 00       	mov    0x807000,%eax
+  80032a:	05 00 10 00 00       	add    $0x1000,%eax
+  80032f:	eb d4                	jmp    800305 <umain+0xab>
+		panic("page_alloc_range: %e", r);
+  800331:	50                   	push   %eax
+  800332:	68 f8 56 80 00       	push   $0x8056f8
+  800337:	6a 6e                	push   $0x6e
+  800339:	68 44 57 80 00       	push   $0x805744
+  80033e:	e8 20 01 00 00       	call   800463 <_panic>
+		panic("page_add_backed: %e", r);
+  800343:	50                   	push   %eax
+  800344:	68 0d 57 80 00       	push   $0x80570d
+  800349:	6a 70                	push   $0x70
+  80034b:	68 44 57 80 00       	push   $0x805744
+  800350:	e8 0e 01 00 00       	call   800463 <_panic>
+			if (r != -E_NO_MEM)
+  800355:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  800358:	75 73                	jne    8003cd <umain+0x173>
+				panic("sys_page_alloc on %p: %e", held, r);
+			break;
+		}
+	}
+	if ((r = sys_fork()) != -E_NO_MEM)
+  80035a:	e8 d8 0e 00 00       	call   801237 <sys_fork>
+  80035f:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  800362:	0f 85 83 00 00 00    	jne    8003eb <umain+0x191>
+		panic("sys_fork with no memory returned %d", r);
+	envid = fork_child(0x4000, 0x5000);
+  800368:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80036d:	b8 00 40 00 00       	mov    $0x4000,%eax
+  800372:	e8 7d fe ff ff       	call   8001f4 <fork_child>
+  800377:	89 c3                	mov    %eax,%ebx
+	give_back();
+  800379:	e8 7c fd ff ff       	call   8000fa <give_back>
+
+	// ufork left our pages copy-on-write: paging them out must not
+	// take them for clean pages and drop them
+	squeeze();
+  80037e:	e8 ce fd ff ff       	call   800151 <squeeze>
+	check(0x4000, "parent");
+  800383:	ba 21 57 80 00       	mov    $0x805721,%edx
+  800388:	b8 00 40 00 00       	mov    $0x4000,%eax
+  80038d:	e8 d1 fc ff ff       	call   800063 <check>
+	fill(0x6000);
+  800392:	b8 00 60 00 00       	mov    $0x6000,%eax
+  800397:	e8 97 fc ff ff       	call   800033 <fill>
+	check(0x6000, "parent");
+  80039c:	ba 21 57 80 00       	mov    $0x805721,%edx
+  8003a1:	b8 00 60 00 00       	mov    $0x6000,%eax
+  8003a6:	e8 b8 fc ff ff       	call   800063 <check>
+	wait(envid);
+  8003ab:	83 ec 0c             	sub    $0xc,%esp
+  8003ae:	53                   	push   %ebx
+  8003af:	e8 1f 26 00 00       	call   8029d3 <wait>
+	cprintf("forkfallback: Passed all checks!\n");
+  8003b4:	c7 04 24 ac 57 80 00 	movl   $0x8057ac,(%esp)
+  8003bb:	e8 7e 01 00 00       	call   80053e <cprintf>
+	get_and_print_paging_stats();
+  8003c0:	e8 af 36 00 00       	call   803a74 <get_and_print_paging_stats>
+}
+  8003c5:	83 c4 10             	add    $0x10,%esp
+  8003c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003cb:	c9                   	leave
+  8003cc:	c3                   	ret
+				panic("sys_page_alloc on %p: %e", held, r);
+  8003cd:	83 ec 0c             	sub    $0xc,%esp
+  8003d0:	50                   	push   %eax
+  8003d1:	ff 35 00 70 80 00    	push   0x807000
+  8003d7:	68 28 57 80 00       	push   $0x805728
+  8003dc:	68 81 00 00 00       	push   $0x81
+  8003e1:	68 44 57 80 00       	push   $0x805744
+  8003e6:	e8 78 00 00 00       	call   800463 <_panic>
+		panic("sys_fork with no memory returned %d", r);
+  8003eb:	50                   	push   %eax
+  8003ec:	68 88 57 80 00       	push   $0x805788
+  8003f1:	68 86 00 00 00       	push   $0x86
+  8003f6:	68 44 57 80 00       	push   $0x805744
+  8003fb:	e8 63 00 00 00       	call   800463 <_panic>
+
+00800400 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800400:	55                   	push   %ebp
+  800401:	89 e5                	mov    %esp,%ebp
+  800403:	56                   	push   %esi
+  800404:	53                   	push   %ebx
+  800405:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800408:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  80040b:	e8 ca 0b 00 00       	call   800fda <sys_getenvid>
+  800410:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800415:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800418:	c1 e0 06             	shl    $0x6,%eax
+  80041b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800420:	a3 24 f9 82 00       	mov    %eax,0x82f924
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800425:	85 db                	test   %ebx,%ebx
+  800427:	7e 07                	jle    800430 <libmain+0x30>
+		binaryname = argv[0];
+  800429:	8b 06                	mov    (%esi),%eax
+  80042b:	a3 20 70 81 00       	mov    %eax,0x817020
+
+	// call user main routine
+	umain(argc, argv);
+  800430:	83 ec 08             	sub    $0x8,%esp
+  800433:	56                   	push   %esi
+  800434:	53                   	push   %ebx
+  800435:	e8 20 fe ff ff       	call   80025a <umain>
+
+	// exit gracefully
+	exit();
+  80043a:	e8 0a 00 00 00       	call   800449 <exit>
+}
+  80043f:	83 c4 10             	add    $0x10,%esp
+  800442:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800445:	5b                   	pop    %ebx
+  800446:	5e                   	pop    %esi
+  800447:	5d                   	pop    %ebp
+  800448:	c3                   	ret
+
+00800449 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800449:	55                   	push   %ebp
+  80044a:	89 e5                	mov    %esp,%ebp
+  80044c:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80044f:	e8 de 18 00 00       	call   801d32 <close_all>
+	sys_env_destroy(0);
+  800454:	83 ec 0c             	sub    $0xc,%esp
+  800457:	6a 00                	push   $0x0
+  800459:	e8 3b 0b 00 00       	call   800f99 <sys_env_destroy>
+}
+  80045e:	83 c4 10             	add    $0x10,%esp
+  800461:	c9                   	leave
+  800462:	c3                   	ret
+
+00800463 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800463:	55                   	push   %ebp
+  800464:	89 e5                	mov    %esp,%ebp
+  800466:	56                   	push   %esi
+  800467:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800468:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80046b:	8b 35 20 70 81 00    	mov    0x817020,%esi
+  800471:	e8 64 0b 00 00       	call   800fda <sys_getenvid>
+  800476:	83 ec 0c             	sub    $0xc,%esp
+  800479:	ff 75 0c             	push   0xc(%ebp)
+  80047c:	ff 75 08             	push   0x8(%ebp)
+  80047f:	56                   	push   %esi
+  800480:	50                   	push   %eax
+  800481:	68 d8 57 80 00       	push   $0x8057d8
+  800486:	e8 b3 00 00 00       	call   80053e <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80048b:	83 c4 18             	add    $0x18,%esp
+  80048e:	53                   	push   %ebx
+  80048f:	ff 75 10             	push   0x10(%ebp)
+  800492:	e8 56 00 00 00       	call   8004ed <vcprintf>
+	cprintf("\n");
+  800497:	c7 04 24 82 5d 80 00 	movl   $0x805d82,(%esp)
+  80049e:	e8 9b 00 00 00       	call   80053e <cprintf>
+  8004a3:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8004a6:	cc                   	int3
+	while (1)
+  8004a7:	eb fd                	jmp    8004a6 <_panic+0x43>
+
+008004a9 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8004a9:	55                   	push   %ebp
+  8004aa:	89 e5                	mov    %esp,%ebp
+  8004ac:	53                   	push   %ebx
+  8004ad:	83 ec 04             	sub    $0x4,%esp
+  8004b0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8004b3:	8b 13                	mov    (%ebx),%edx
+  8004b5:	8d 42 01             	lea    0x1(%edx),%eax
+  8004b8:	89 03                	mov    %eax,(%ebx)
+  8004ba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8004bd:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8004c1:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8004c6:	74 09                	je     8004d1 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8004c8:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8004cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8004cf:	c9                   	leave
+  8004d0:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8004d1:	83 ec 08             	sub    $0x8,%esp
+  8004d4:	68 ff 00 00 00       	push   $0xff
+  8004d9:	8d 43 08             	lea    0x8(%ebx),%eax
+  8004dc:	50                   	push   %eax
+  8004dd:	e8 69 0a 00 00       	call   800f4b <sys_cputs>
+		b->idx = 0;
+  8004e2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8004e8:	83 c4 10             	add    $0x10,%esp
+  8004eb:	eb db                	jmp    8004c8 <putch+0x1f>
+
+008004ed <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8004ed:	55                   	push   %ebp
+  8004ee:	89 e5                	mov    %esp,%ebp
+  8004f0:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8004f6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8004fd:	00 00 00 
+	b.cnt = 0;
+  800500:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800507:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80050a:	ff 75 0c             	push   0xc(%ebp)
+  80050d:	ff 75 08             	push   0x8(%ebp)
+  800510:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800516:	50                   	push   %eax
+  800517:	68 a9 04 80 00       	push   $0x8004a9
+  80051c:	e8 14 01 00 00       	call   800635 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800521:	83 c4 08             	add    $0x8,%esp
+  800524:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80052a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800530:	50                   	push   %eax
+  800531:	e8 15 0a 00 00       	call   800f4b <sys_cputs>
+
+	return b.cnt;
+}
+  800536:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80053c:	c9                   	leave
+  80053d:	c3                   	ret
+
+0080053e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80053e:	55                   	push   %ebp
+  80053f:	89 e5                	mov    %esp,%ebp
+  800541:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800544:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800547:	50                   	push   %eax
+  800548:	ff 75 08             	push   0x8(%ebp)
+  80054b:	e8 9d ff ff ff       	call   8004ed <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800550:	c9                   	leave
+  800551:	c3                   	ret
+
+00800552 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800552:	55                   	push   %ebp
+  800553:	89 e5                	mov    %esp,%ebp
+  800555:	57                   	push   %edi
+  800556:	56                   	push   %esi
+  800557:	53                   	push   %ebx
+  800558:	83 ec 1c             	sub    $0x1c,%esp
+  80055b:	89 c7                	mov    %eax,%edi
+  80055d:	89 d6                	mov    %edx,%esi
+  80055f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800562:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800565:	89 d1                	mov    %edx,%ecx
+  800567:	89 c2                	mov    %eax,%edx
+  800569:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80056c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80056f:	8b 45 10             	mov    0x10(%ebp),%eax
+  800572:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800575:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800578:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80057f:	39 c2                	cmp    %eax,%edx
+  800581:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800584:	72 3e                	jb     8005c4 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800586:	83 ec 0c             	sub    $0xc,%esp
+  800589:	ff 75 18             	push   0x18(%ebp)
+  80058c:	83 eb 01             	sub    $0x1,%ebx
+  80058f:	53                   	push   %ebx
+  800590:	50                   	push   %eax
+  800591:	83 ec 08             	sub    $0x8,%esp
+  800594:	ff 75 e4             	push   -0x1c(%ebp)
+  800597:	ff 75 e0             	push   -0x20(%ebp)
+  80059a:	ff 75 dc             	push   -0x24(%ebp)
+  80059d:	ff 75 d8             	push   -0x28(%ebp)
+  8005a0:	e8 6e 4f 00 00       	call   805513 <__udivdi3>
+  8005a5:	83 c4 18             	add    $0x18,%esp
+  8005a8:	52                   	push   %edx
+  8005a9:	50                   	push   %eax
+  8005aa:	89 f2                	mov    %esi,%edx
+  8005ac:	89 f8                	mov    %edi,%eax
+  8005ae:	e8 9f ff ff ff       	call   800552 <printnum>
+  8005b3:	83 c4 20             	add    $0x20,%esp
+  8005b6:	eb 13                	jmp    8005cb <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8005b8:	83 ec 08             	sub    $0x8,%esp
+  8005bb:	56                   	push   %esi
+  8005bc:	ff 75 18             	push   0x18(%ebp)
+  8005bf:	ff d7                	call   *%edi
+  8005c1:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8005c4:	83 eb 01             	sub    $0x1,%ebx
+  8005c7:	85 db                	test   %ebx,%ebx
+  8005c9:	7f ed                	jg     8005b8 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8005cb:	83 ec 08             	sub    $0x8,%esp
+  8005ce:	56                   	push   %esi
+  8005cf:	83 ec 04             	sub    $0x4,%esp
+  8005d2:	ff 75 e4             	push   -0x1c(%ebp)
+  8005d5:	ff 75 e0             	push   -0x20(%ebp)
+  8005d8:	ff 75 dc             	push   -0x24(%ebp)
+  8005db:	ff 75 d8             	push   -0x28(%ebp)
+  8005de:	e8 4e 4f 00 00       	call   805531 <__umoddi3>
+  8005e3:	83 c4 14             	add    $0x14,%esp
+  8005e6:	0f be 80 fb 57 80 00 	movsbl 0x8057fb(%eax),%eax
+  8005ed:	50                   	push   %eax
+  8005ee:	ff d7                	call   *%edi
+}
+  8005f0:	83 c4 10             	add    $0x10,%esp
+  8005f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005f6:	5b                   	pop    %ebx
+  8005f7:	5e                   	pop    %esi
+  8005f8:	5f                   	pop    %edi
+  8005f9:	5d                   	pop    %ebp
+  8005fa:	c3                   	ret
+
+008005fb <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8005fb:	55                   	push   %ebp
+  8005fc:	89 e5                	mov    %esp,%ebp
+  8005fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800601:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800605:	8b 10                	mov    (%eax),%edx
+  800607:	3b 50 04             	cmp    0x4(%eax),%edx
+  80060a:	73 0a                	jae    800616 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80060c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80060f:	89 08                	mov    %ecx,(%eax)
+  800611:	8b 45 08             	mov    0x8(%ebp),%eax
+  800614:	88 02                	mov    %al,(%edx)
+}
+  800616:	5d                   	pop    %ebp
+  800617:	c3                   	ret
+
+00800618 <printfmt>:
+{
+  800618:	55                   	push   %ebp
+  800619:	89 e5                	mov    %esp,%ebp
+  80061b:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80061e:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800621:	50                   	push   %eax
+  800622:	ff 75 10             	push   0x10(%ebp)
+  800625:	ff 75 0c             	push   0xc(%ebp)
+  800628:	ff 75 08             	push   0x8(%ebp)
+  80062b:	e8 05 00 00 00       	call   800635 <vprintfmt>
+}
+  800630:	83 c4 10             	add    $0x10,%esp
+  800633:	c9                   	leave
+  800634:	c3                   	ret
+
+00800635 <vprintfmt>:
+{
+  800635:	55                   	push   %ebp
+  800636:	89 e5                	mov    %esp,%ebp
+  800638:	57                   	push   %edi
+  800639:	56                   	push   %esi
+  80063a:	53                   	push   %ebx
+  80063b:	83 ec 2c             	sub    $0x2c,%esp
+  80063e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800641:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800644:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800647:	eb 0a                	jmp    800653 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800649:	83 ec 08             	sub    $0x8,%esp
+  80064c:	53                   	push   %ebx
+  80064d:	50                   	push   %eax
+  80064e:	ff d6                	call   *%esi
+  800650:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800653:	83 c7 01             	add    $0x1,%edi
+  800656:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80065a:	83 f8 25             	cmp    $0x25,%eax
+  80065d:	74 0c                	je     80066b <vprintfmt+0x36>
+			if (ch == '\0')
+  80065f:	85 c0                	test   %eax,%eax
+  800661:	75 e6                	jne    800649 <vprintfmt+0x14>
+}
+  800663:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800666:	5b                   	pop    %ebx
+  800667:	5e                   	pop    %esi
+  800668:	5f                   	pop    %edi
+  800669:	5d                   	pop    %ebp
+  80066a:	c3                   	ret
+		padc = ' ';
+  80066b:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80066f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800676:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80067d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800684:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800689:	8d 47 01             	lea    0x1(%edi),%eax
+  80068c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80068f:	0f b6 17             	movzbl (%edi),%edx
+  800692:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800695:	3c 55                	cmp    $0x55,%al
+  800697:	0f 87 c5 03 00 00    	ja     800a62 <vprintfmt+0x42d>
+  80069d:	0f b6 c0             	movzbl %al,%eax
+  8006a0:	ff 24 85 80 59 80 00 	jmp    *0x805980(,%eax,4)
+  8006a7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8006aa:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8006ae:	eb d9                	jmp    800689 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8006b3:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8006b7:	eb d0                	jmp    800689 <vprintfmt+0x54>
+  8006b9:	0f b6 d2             	movzbl %dl,%edx
+  8006bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8006bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8006c7:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8006ca:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8006ce:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8006d1:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8006d4:	83 f9 09             	cmp    $0x9,%ecx
+  8006d7:	77 55                	ja     80072e <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8006d9:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8006dc:	eb e9                	jmp    8006c7 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8006de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e1:	8b 00                	mov    (%eax),%eax
+  8006e3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ec:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006ef:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8006f2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006f6:	79 91                	jns    800689 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8006f8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006fb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006fe:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800705:	eb 82                	jmp    800689 <vprintfmt+0x54>
+			if (width < 0)
+  800707:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80070a:	85 d2                	test   %edx,%edx
+  80070c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800711:	0f 49 c2             	cmovns %edx,%eax
+  800714:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800717:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80071a:	e9 6a ff ff ff       	jmp    800689 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80071f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800722:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800729:	e9 5b ff ff ff       	jmp    800689 <vprintfmt+0x54>
+  80072e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800731:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800734:	eb bc                	jmp    8006f2 <vprintfmt+0xbd>
+			lflag++;
+  800736:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800739:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80073c:	e9 48 ff ff ff       	jmp    800689 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800741:	8b 45 14             	mov    0x14(%ebp),%eax
+  800744:	8d 78 04             	lea    0x4(%eax),%edi
+  800747:	83 ec 08             	sub    $0x8,%esp
+  80074a:	53                   	push   %ebx
+  80074b:	ff 30                	push   (%eax)
+  80074d:	ff d6                	call   *%esi
+			break;
+  80074f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800752:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800755:	e9 63 02 00 00       	jmp    8009bd <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  80075a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075d:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800760:	8b 10                	mov    (%eax),%edx
+  800762:	89 d0                	mov    %edx,%eax
+  800764:	f7 d8                	neg    %eax
+  800766:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800769:	83 f8 12             	cmp    $0x12,%eax
+  80076c:	7f 23                	jg     800791 <vprintfmt+0x15c>
+  80076e:	8b 14 85 e0 5a 80 00 	mov    0x805ae0(,%eax,4),%edx
+  800775:	85 d2                	test   %edx,%edx
+  800777:	74 18                	je     800791 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800779:	52                   	push   %edx
+  80077a:	68 e6 56 80 00       	push   $0x8056e6
+  80077f:	53                   	push   %ebx
+  800780:	56                   	push   %esi
+  800781:	e8 92 fe ff ff       	call   800618 <printfmt>
+  800786:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800789:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80078c:	e9 2c 02 00 00       	jmp    8009bd <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  800791:	50                   	push   %eax
+  800792:	68 13 58 80 00       	push   $0x805813
+  800797:	53                   	push   %ebx
+  800798:	56                   	push   %esi
+  800799:	e8 7a fe ff ff       	call   800618 <printfmt>
+  80079e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8007a1:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8007a4:	e9 14 02 00 00       	jmp    8009bd <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ac:	83 c0 04             	add    $0x4,%eax
+  8007af:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8007b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b5:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8007b7:	85 c9                	test   %ecx,%ecx
+  8007b9:	b8 0c 58 80 00       	mov    $0x80580c,%eax
+  8007be:	0f 45 c1             	cmovne %ecx,%eax
+  8007c1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8007c4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8007c8:	7e 06                	jle    8007d0 <vprintfmt+0x19b>
+  8007ca:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8007ce:	75 0b                	jne    8007db <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007d0:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8007d3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8007d6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8007d9:	eb 5c                	jmp    800837 <vprintfmt+0x202>
+  8007db:	83 ec 08             	sub    $0x8,%esp
+  8007de:	ff 75 d0             	push   -0x30(%ebp)
+  8007e1:	ff 75 cc             	push   -0x34(%ebp)
+  8007e4:	e8 19 03 00 00       	call   800b02 <strnlen>
+  8007e9:	89 c2                	mov    %eax,%edx
+  8007eb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007ee:	29 d0                	sub    %edx,%eax
+  8007f0:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8007f3:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8007f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007fa:	89 75 08             	mov    %esi,0x8(%ebp)
+  8007fd:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007ff:	eb 0e                	jmp    80080f <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800801:	83 ec 08             	sub    $0x8,%esp
+  800804:	53                   	push   %ebx
+  800805:	57                   	push   %edi
+  800806:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800809:	83 ee 01             	sub    $0x1,%esi
+  80080c:	83 c4 10             	add    $0x10,%esp
+  80080f:	85 f6                	test   %esi,%esi
+  800811:	7f ee                	jg     800801 <vprintfmt+0x1cc>
+  800813:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800816:	8b 75 08             	mov    0x8(%ebp),%esi
+  800819:	85 c0                	test   %eax,%eax
+  80081b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800820:	0f 49 d0             	cmovns %eax,%edx
+  800823:	29 d0                	sub    %edx,%eax
+  800825:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800828:	eb a6                	jmp    8007d0 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80082a:	83 ec 08             	sub    $0x8,%esp
+  80082d:	53                   	push   %ebx
+  80082e:	52                   	push   %edx
+  80082f:	ff 55 08             	call   *0x8(%ebp)
+  800832:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800835:	89 f1                	mov    %esi,%ecx
+  800837:	8d 71 01             	lea    0x1(%ecx),%esi
+  80083a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80083e:	0f be d0             	movsbl %al,%edx
+  800841:	85 d2                	test   %edx,%edx
+  800843:	74 28                	je     80086d <vprintfmt+0x238>
+  800845:	85 ff                	test   %edi,%edi
+  800847:	78 05                	js     80084e <vprintfmt+0x219>
+  800849:	83 ef 01             	sub    $0x1,%edi
+  80084c:	78 30                	js     80087e <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80084e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800852:	74 d6                	je     80082a <vprintfmt+0x1f5>
+  800854:	0f be c0             	movsbl %al,%eax
+  800857:	83 e8 20             	sub    $0x20,%eax
+  80085a:	83 f8 5e             	cmp    $0x5e,%eax
+  80085d:	76 cb                	jbe    80082a <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80085f:	83 ec 08             	sub    $0x8,%esp
+  800862:	53                   	push   %ebx
+  800863:	6a 3f                	push   $0x3f
+  800865:	ff 55 08             	call   *0x8(%ebp)
+  800868:	83 c4 10             	add    $0x10,%esp
+  80086b:	eb c8                	jmp    800835 <vprintfmt+0x200>
+  80086d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800870:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800873:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800876:	01 d0                	add    %edx,%eax
+  800878:	29 c8                	sub    %ecx,%eax
+  80087a:	89 c7                	mov    %eax,%edi
+  80087c:	eb 13                	jmp    800891 <vprintfmt+0x25c>
+  80087e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800881:	eb ed                	jmp    800870 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800883:	83 ec 08             	sub    $0x8,%esp
+  800886:	53                   	push   %ebx
+  800887:	6a 20                	push   $0x20
+  800889:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80088b:	83 ef 01             	sub    $0x1,%edi
+  80088e:	83 c4 10             	add    $0x10,%esp
+  800891:	85 ff                	test   %edi,%edi
+  800893:	7f ee                	jg     800883 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800895:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800898:	89 45 14             	mov    %eax,0x14(%ebp)
+  80089b:	e9 1d 01 00 00       	jmp    8009bd <vprintfmt+0x388>
+	if (lflag >= 2)
+  8008a0:	83 f9 01             	cmp    $0x1,%ecx
+  8008a3:	7f 1b                	jg     8008c0 <vprintfmt+0x28b>
+	else if (lflag)
+  8008a5:	85 c9                	test   %ecx,%ecx
+  8008a7:	74 63                	je     80090c <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  8008a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ac:	8b 00                	mov    (%eax),%eax
+  8008ae:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008b1:	99                   	cltd
+  8008b2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8008b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008bb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008be:	eb 17                	jmp    8008d7 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  8008c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c3:	8b 50 04             	mov    0x4(%eax),%edx
+  8008c6:	8b 00                	mov    (%eax),%eax
+  8008c8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008cb:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8008ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d1:	8d 40 08             	lea    0x8(%eax),%eax
+  8008d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8008d7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008da:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8008dd:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8008e2:	85 c9                	test   %ecx,%ecx
+  8008e4:	0f 89 b9 00 00 00    	jns    8009a3 <vprintfmt+0x36e>
+				putch('-', putdat);
+  8008ea:	83 ec 08             	sub    $0x8,%esp
+  8008ed:	53                   	push   %ebx
+  8008ee:	6a 2d                	push   $0x2d
+  8008f0:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8008f2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008f5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008f8:	f7 da                	neg    %edx
+  8008fa:	83 d1 00             	adc    $0x0,%ecx
+  8008fd:	f7 d9                	neg    %ecx
+  8008ff:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800902:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800907:	e9 97 00 00 00       	jmp    8009a3 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  80090c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090f:	8b 00                	mov    (%eax),%eax
+  800911:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800914:	99                   	cltd
+  800915:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800918:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091b:	8d 40 04             	lea    0x4(%eax),%eax
+  80091e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800921:	eb b4                	jmp    8008d7 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  800923:	83 f9 01             	cmp    $0x1,%ecx
+  800926:	7f 1b                	jg     800943 <vprintfmt+0x30e>
+	else if (lflag)
+  800928:	85 c9                	test   %ecx,%ecx
+  80092a:	74 2c                	je     800958 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  80092c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092f:	8b 10                	mov    (%eax),%edx
+  800931:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800936:	8d 40 04             	lea    0x4(%eax),%eax
+  800939:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80093c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800941:	eb 60                	jmp    8009a3 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800943:	8b 45 14             	mov    0x14(%ebp),%eax
+  800946:	8b 10                	mov    (%eax),%edx
+  800948:	8b 48 04             	mov    0x4(%eax),%ecx
+  80094b:	8d 40 08             	lea    0x8(%eax),%eax
+  80094e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800951:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800956:	eb 4b                	jmp    8009a3 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800958:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095b:	8b 10                	mov    (%eax),%edx
+  80095d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800962:	8d 40 04             	lea    0x4(%eax),%eax
+  800965:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800968:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80096d:	eb 34                	jmp    8009a3 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80096f:	83 f9 01             	cmp    $0x1,%ecx
+  800972:	7f 15                	jg     800989 <vprintfmt+0x354>
+	else if (lflag)
+  800974:	85 c9                	test   %ecx,%ecx
+  800976:	74 4d                	je     8009c5 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800978:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097b:	8b 00                	mov    (%eax),%eax
+  80097d:	99                   	cltd
+  80097e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800981:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800984:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800987:	eb 11                	jmp    80099a <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800989:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098c:	8b 50 04             	mov    0x4(%eax),%edx
+  80098f:	8b 00                	mov    (%eax),%eax
+  800991:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800994:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800997:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  80099a:	89 d1                	mov    %edx,%ecx
+  80099c:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  80099e:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8009a3:	83 ec 0c             	sub    $0xc,%esp
+  8009a6:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8009aa:	50                   	push   %eax
+  8009ab:	ff 75 e0             	push   -0x20(%ebp)
+  8009ae:	57                   	push   %edi
+  8009af:	51                   	push   %ecx
+  8009b0:	52                   	push   %edx
+  8009b1:	89 da                	mov    %ebx,%edx
+  8009b3:	89 f0                	mov    %esi,%eax
+  8009b5:	e8 98 fb ff ff       	call   800552 <printnum>
+			break;
+  8009ba:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8009bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8009c0:	e9 8e fc ff ff       	jmp    800653 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  8009c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c8:	8b 00                	mov    (%eax),%eax
+  8009ca:	99                   	cltd
+  8009cb:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8009ce:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8009d1:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8009d4:	eb c4                	jmp    80099a <vprintfmt+0x365>
+			putch('0', putdat);
+  8009d6:	83 ec 08             	sub    $0x8,%esp
+  8009d9:	53                   	push   %ebx
+  8009da:	6a 30                	push   $0x30
+  8009dc:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8009de:	83 c4 08             	add    $0x8,%esp
+  8009e1:	53                   	push   %ebx
+  8009e2:	6a 78                	push   $0x78
+  8009e4:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8009e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e9:	8b 10                	mov    (%eax),%edx
+  8009eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8009f0:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8009f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8009f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009f9:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8009fe:	eb a3                	jmp    8009a3 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800a00:	83 f9 01             	cmp    $0x1,%ecx
+  800a03:	7f 1b                	jg     800a20 <vprintfmt+0x3eb>
+	else if (lflag)
+  800a05:	85 c9                	test   %ecx,%ecx
+  800a07:	74 2f                	je     800a38 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800a09:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0c:	8b 10                	mov    (%eax),%edx
+  800a0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a13:	8d 40 04             	lea    0x4(%eax),%eax
+  800a16:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a19:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800a1e:	eb 83                	jmp    8009a3 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800a20:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a23:	8b 10                	mov    (%eax),%edx
+  800a25:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a28:	8d 40 08             	lea    0x8(%eax),%eax
+  800a2b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a2e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800a33:	e9 6b ff ff ff       	jmp    8009a3 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800a38:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a3b:	8b 10                	mov    (%eax),%edx
+  800a3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a42:	8d 40 04             	lea    0x4(%eax),%eax
+  800a45:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a48:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800a4d:	e9 51 ff ff ff       	jmp    8009a3 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800a52:	83 ec 08             	sub    $0x8,%esp
+  800a55:	53                   	push   %ebx
+  800a56:	6a 25                	push   $0x25
+  800a58:	ff d6                	call   *%esi
+			break;
+  800a5a:	83 c4 10             	add    $0x10,%esp
+  800a5d:	e9 5b ff ff ff       	jmp    8009bd <vprintfmt+0x388>
+			putch('%', putdat);
+  800a62:	83 ec 08             	sub    $0x8,%esp
+  800a65:	53                   	push   %ebx
+  800a66:	6a 25                	push   $0x25
+  800a68:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a6a:	83 c4 10             	add    $0x10,%esp
+  800a6d:	89 f8                	mov    %edi,%eax
+  800a6f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a73:	74 05                	je     800a7a <vprintfmt+0x445>
+  800a75:	83 e8 01             	sub    $0x1,%eax
+  800a78:	eb f5                	jmp    800a6f <vprintfmt+0x43a>
+  800a7a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a7d:	e9 3b ff ff ff       	jmp    8009bd <vprintfmt+0x388>
+
+00800a82 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a82:	55                   	push   %ebp
+  800a83:	89 e5                	mov    %esp,%ebp
+  800a85:	83 ec 18             	sub    $0x18,%esp
+  800a88:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a8e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a91:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a95:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a98:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800a9f:	85 c0                	test   %eax,%eax
+  800aa1:	74 26                	je     800ac9 <vsnprintf+0x47>
+  800aa3:	85 d2                	test   %edx,%edx
+  800aa5:	7e 22                	jle    800ac9 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800aa7:	ff 75 14             	push   0x14(%ebp)
+  800aaa:	ff 75 10             	push   0x10(%ebp)
+  800aad:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800ab0:	50                   	push   %eax
+  800ab1:	68 fb 05 80 00       	push   $0x8005fb
+  800ab6:	e8 7a fb ff ff       	call   800635 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800abb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800abe:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ac1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ac4:	83 c4 10             	add    $0x10,%esp
+}
+  800ac7:	c9                   	leave
+  800ac8:	c3                   	ret
+		return -E_INVAL;
+  800ac9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ace:	eb f7                	jmp    800ac7 <vsnprintf+0x45>
+
+00800ad0 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ad0:	55                   	push   %ebp
+  800ad1:	89 e5                	mov    %esp,%ebp
+  800ad3:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800ad6:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800ad9:	50                   	push   %eax
+  800ada:	ff 75 10             	push   0x10(%ebp)
+  800add:	ff 75 0c             	push   0xc(%ebp)
+  800ae0:	ff 75 08             	push   0x8(%ebp)
+  800ae3:	e8 9a ff ff ff       	call   800a82 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800ae8:	c9                   	leave
+  800ae9:	c3                   	ret
+
+00800aea <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800aea:	55                   	push   %ebp
+  800aeb:	89 e5                	mov    %esp,%ebp
+  800aed:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800af0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af5:	eb 03                	jmp    800afa <strlen+0x10>
+		n++;
+  800af7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800afa:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800afe:	75 f7                	jne    800af7 <strlen+0xd>
+	return n;
+}
+  800b00:	5d                   	pop    %ebp
+  800b01:	c3                   	ret
+
+00800b02 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b02:	55                   	push   %ebp
+  800b03:	89 e5                	mov    %esp,%ebp
+  800b05:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b08:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b10:	eb 03                	jmp    800b15 <strnlen+0x13>
+		n++;
+  800b12:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b15:	39 d0                	cmp    %edx,%eax
+  800b17:	74 08                	je     800b21 <strnlen+0x1f>
+  800b19:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b1d:	75 f3                	jne    800b12 <strnlen+0x10>
+  800b1f:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800b21:	89 d0                	mov    %edx,%eax
+  800b23:	5d                   	pop    %ebp
+  800b24:	c3                   	ret
+
+00800b25 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b25:	55                   	push   %ebp
+  800b26:	89 e5                	mov    %esp,%ebp
+  800b28:	53                   	push   %ebx
+  800b29:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b2c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b34:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b38:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b3b:	83 c0 01             	add    $0x1,%eax
+  800b3e:	84 d2                	test   %dl,%dl
+  800b40:	75 f2                	jne    800b34 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b42:	89 c8                	mov    %ecx,%eax
+  800b44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b47:	c9                   	leave
+  800b48:	c3                   	ret
+
+00800b49 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b49:	55                   	push   %ebp
+  800b4a:	89 e5                	mov    %esp,%ebp
+  800b4c:	53                   	push   %ebx
+  800b4d:	83 ec 10             	sub    $0x10,%esp
+  800b50:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b53:	53                   	push   %ebx
+  800b54:	e8 91 ff ff ff       	call   800aea <strlen>
+  800b59:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b5c:	ff 75 0c             	push   0xc(%ebp)
+  800b5f:	01 d8                	add    %ebx,%eax
+  800b61:	50                   	push   %eax
+  800b62:	e8 be ff ff ff       	call   800b25 <strcpy>
+	return dst;
+}
+  800b67:	89 d8                	mov    %ebx,%eax
+  800b69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b6c:	c9                   	leave
+  800b6d:	c3                   	ret
+
+00800b6e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b6e:	55                   	push   %ebp
+  800b6f:	89 e5                	mov    %esp,%ebp
+  800b71:	56                   	push   %esi
+  800b72:	53                   	push   %ebx
+  800b73:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b76:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b79:	89 f3                	mov    %esi,%ebx
+  800b7b:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b7e:	89 f0                	mov    %esi,%eax
+  800b80:	eb 0f                	jmp    800b91 <strncpy+0x23>
+		*dst++ = *src;
+  800b82:	83 c0 01             	add    $0x1,%eax
+  800b85:	0f b6 0a             	movzbl (%edx),%ecx
+  800b88:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b8b:	80 f9 01             	cmp    $0x1,%cl
+  800b8e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b91:	39 d8                	cmp    %ebx,%eax
+  800b93:	75 ed                	jne    800b82 <strncpy+0x14>
+	}
+	return ret;
+}
+  800b95:	89 f0                	mov    %esi,%eax
+  800b97:	5b                   	pop    %ebx
+  800b98:	5e                   	pop    %esi
+  800b99:	5d                   	pop    %ebp
+  800b9a:	c3                   	ret
+
+00800b9b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b9b:	55                   	push   %ebp
+  800b9c:	89 e5                	mov    %esp,%ebp
+  800b9e:	56                   	push   %esi
+  800b9f:	53                   	push   %ebx
+  800ba0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ba3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba6:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ba9:	89 f0                	mov    %esi,%eax
+  800bab:	85 d2                	test   %edx,%edx
+  800bad:	74 21                	je     800bd0 <strlcpy+0x35>
+  800baf:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800bb3:	89 f2                	mov    %esi,%edx
+  800bb5:	eb 09                	jmp    800bc0 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800bb7:	83 c1 01             	add    $0x1,%ecx
+  800bba:	83 c2 01             	add    $0x1,%edx
+  800bbd:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800bc0:	39 c2                	cmp    %eax,%edx
+  800bc2:	74 09                	je     800bcd <strlcpy+0x32>
+  800bc4:	0f b6 19             	movzbl (%ecx),%ebx
+  800bc7:	84 db                	test   %bl,%bl
+  800bc9:	75 ec                	jne    800bb7 <strlcpy+0x1c>
+  800bcb:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800bcd:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800bd0:	29 f0                	sub    %esi,%eax
+}
+  800bd2:	5b                   	pop    %ebx
+  800bd3:	5e                   	pop    %esi
+  800bd4:	5d                   	pop    %ebp
+  800bd5:	c3                   	ret
+
+00800bd6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800bd6:	55                   	push   %ebp
+  800bd7:	89 e5                	mov    %esp,%ebp
+  800bd9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bdc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800bdf:	eb 06                	jmp    800be7 <strcmp+0x11>
+		p++, q++;
+  800be1:	83 c1 01             	add    $0x1,%ecx
+  800be4:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800be7:	0f b6 01             	movzbl (%ecx),%eax
+  800bea:	84 c0                	test   %al,%al
+  800bec:	74 04                	je     800bf2 <strcmp+0x1c>
+  800bee:	3a 02                	cmp    (%edx),%al
+  800bf0:	74 ef                	je     800be1 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bf2:	0f b6 c0             	movzbl %al,%eax
+  800bf5:	0f b6 12             	movzbl (%edx),%edx
+  800bf8:	29 d0                	sub    %edx,%eax
+}
+  800bfa:	5d                   	pop    %ebp
+  800bfb:	c3                   	ret
+
+00800bfc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800bfc:	55                   	push   %ebp
+  800bfd:	89 e5                	mov    %esp,%ebp
+  800bff:	53                   	push   %ebx
+  800c00:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c06:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800c09:	eb 09                	jmp    800c14 <strncmp+0x18>
+		n--, p++, q++;
+  800c0b:	83 ea 01             	sub    $0x1,%edx
+  800c0e:	83 c0 01             	add    $0x1,%eax
+  800c11:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800c14:	85 d2                	test   %edx,%edx
+  800c16:	74 18                	je     800c30 <strncmp+0x34>
+  800c18:	0f b6 18             	movzbl (%eax),%ebx
+  800c1b:	84 db                	test   %bl,%bl
+  800c1d:	74 04                	je     800c23 <strncmp+0x27>
+  800c1f:	3a 19                	cmp    (%ecx),%bl
+  800c21:	74 e8                	je     800c0b <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c23:	0f b6 00             	movzbl (%eax),%eax
+  800c26:	0f b6 11             	movzbl (%ecx),%edx
+  800c29:	29 d0                	sub    %edx,%eax
+}
+  800c2b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c2e:	c9                   	leave
+  800c2f:	c3                   	ret
+		return 0;
+  800c30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c35:	eb f4                	jmp    800c2b <strncmp+0x2f>
+
+00800c37 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c37:	55                   	push   %ebp
+  800c38:	89 e5                	mov    %esp,%ebp
+  800c3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c41:	eb 03                	jmp    800c46 <strchr+0xf>
+  800c43:	83 c0 01             	add    $0x1,%eax
+  800c46:	0f b6 10             	movzbl (%eax),%edx
+  800c49:	84 d2                	test   %dl,%dl
+  800c4b:	74 06                	je     800c53 <strchr+0x1c>
+		if (*s == c)
+  800c4d:	38 ca                	cmp    %cl,%dl
+  800c4f:	75 f2                	jne    800c43 <strchr+0xc>
+  800c51:	eb 05                	jmp    800c58 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800c53:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c58:	5d                   	pop    %ebp
+  800c59:	c3                   	ret
+
+00800c5a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c5a:	55                   	push   %ebp
+  800c5b:	89 e5                	mov    %esp,%ebp
+  800c5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c60:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c64:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800c67:	38 ca                	cmp    %cl,%dl
+  800c69:	74 09                	je     800c74 <strfind+0x1a>
+  800c6b:	84 d2                	test   %dl,%dl
+  800c6d:	74 05                	je     800c74 <strfind+0x1a>
+	for (; *s; s++)
+  800c6f:	83 c0 01             	add    $0x1,%eax
+  800c72:	eb f0                	jmp    800c64 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800c74:	5d                   	pop    %ebp
+  800c75:	c3                   	ret
+
+00800c76 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c76:	55                   	push   %ebp
+  800c77:	89 e5                	mov    %esp,%ebp
+  800c79:	57                   	push   %edi
+  800c7a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c7d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c80:	85 c9                	test   %ecx,%ecx
+  800c82:	74 20                	je     800ca4 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c84:	89 f8                	mov    %edi,%eax
+  800c86:	09 c8                	or     %ecx,%eax
+  800c88:	a8 03                	test   $0x3,%al
+  800c8a:	75 12                	jne    800c9e <memset+0x28>
+		c &= 0xFF;
+  800c8c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c90:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c96:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c99:	fc                   	cld
+  800c9a:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c9c:	eb 06                	jmp    800ca4 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c9e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ca1:	fc                   	cld
+  800ca2:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ca4:	89 f8                	mov    %edi,%eax
+  800ca6:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ca9:	c9                   	leave
+  800caa:	c3                   	ret
+
+00800cab <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800cab:	55                   	push   %ebp
+  800cac:	89 e5                	mov    %esp,%ebp
+  800cae:	57                   	push   %edi
+  800caf:	56                   	push   %esi
+  800cb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800cb6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800cb9:	39 c6                	cmp    %eax,%esi
+  800cbb:	73 32                	jae    800cef <memmove+0x44>
+  800cbd:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800cc0:	39 d0                	cmp    %edx,%eax
+  800cc2:	73 2b                	jae    800cef <memmove+0x44>
+		s += n;
+		d += n;
+  800cc4:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800cc7:	89 d6                	mov    %edx,%esi
+  800cc9:	09 fe                	or     %edi,%esi
+  800ccb:	09 ce                	or     %ecx,%esi
+  800ccd:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800cd3:	75 0e                	jne    800ce3 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800cd5:	83 ef 04             	sub    $0x4,%edi
+  800cd8:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800cdb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800cde:	fd                   	std
+  800cdf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ce1:	eb 09                	jmp    800cec <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ce3:	83 ef 01             	sub    $0x1,%edi
+  800ce6:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ce9:	fd                   	std
+  800cea:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800cec:	fc                   	cld
+  800ced:	eb 1a                	jmp    800d09 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800cef:	89 f2                	mov    %esi,%edx
+  800cf1:	09 c2                	or     %eax,%edx
+  800cf3:	09 ca                	or     %ecx,%edx
+  800cf5:	f6 c2 03             	test   $0x3,%dl
+  800cf8:	75 0a                	jne    800d04 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800cfa:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800cfd:	89 c7                	mov    %eax,%edi
+  800cff:	fc                   	cld
+  800d00:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d02:	eb 05                	jmp    800d09 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d04:	89 c7                	mov    %eax,%edi
+  800d06:	fc                   	cld
+  800d07:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d09:	5e                   	pop    %esi
+  800d0a:	5f                   	pop    %edi
+  800d0b:	5d                   	pop    %ebp
+  800d0c:	c3                   	ret
+
+00800d0d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d13:	ff 75 10             	push   0x10(%ebp)
+  800d16:	ff 75 0c             	push   0xc(%ebp)
+  800d19:	ff 75 08             	push   0x8(%ebp)
+  800d1c:	e8 8a ff ff ff       	call   800cab <memmove>
+}
+  800d21:	c9                   	leave
+  800d22:	c3                   	ret
+
+00800d23 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d23:	55                   	push   %ebp
+  800d24:	89 e5                	mov    %esp,%ebp
+  800d26:	56                   	push   %esi
+  800d27:	53                   	push   %ebx
+  800d28:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d2b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d2e:	89 c6                	mov    %eax,%esi
+  800d30:	03 75 10             	add    0x10(%ebp),%esi
+  800d33:	eb 06                	jmp    800d3b <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d35:	83 c0 01             	add    $0x1,%eax
+  800d38:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800d3b:	39 f0                	cmp    %esi,%eax
+  800d3d:	74 14                	je     800d53 <memcmp+0x30>
+		if (*s1 != *s2)
+  800d3f:	0f b6 08             	movzbl (%eax),%ecx
+  800d42:	0f b6 1a             	movzbl (%edx),%ebx
+  800d45:	38 d9                	cmp    %bl,%cl
+  800d47:	74 ec                	je     800d35 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800d49:	0f b6 c1             	movzbl %cl,%eax
+  800d4c:	0f b6 db             	movzbl %bl,%ebx
+  800d4f:	29 d8                	sub    %ebx,%eax
+  800d51:	eb 05                	jmp    800d58 <memcmp+0x35>
+	}
+
+	return 0;
+  800d53:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d58:	5b                   	pop    %ebx
+  800d59:	5e                   	pop    %esi
+  800d5a:	5d                   	pop    %ebp
+  800d5b:	c3                   	ret
+
+00800d5c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800d5c:	55                   	push   %ebp
+  800d5d:	89 e5                	mov    %esp,%ebp
+  800d5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800d65:	89 c2                	mov    %eax,%edx
+  800d67:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800d6a:	eb 03                	jmp    800d6f <memfind+0x13>
+  800d6c:	83 c0 01             	add    $0x1,%eax
+  800d6f:	39 d0                	cmp    %edx,%eax
+  800d71:	73 04                	jae    800d77 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800d73:	38 08                	cmp    %cl,(%eax)
+  800d75:	75 f5                	jne    800d6c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800d77:	5d                   	pop    %ebp
+  800d78:	c3                   	ret
+
+00800d79 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d79:	55                   	push   %ebp
+  800d7a:	89 e5                	mov    %esp,%ebp
+  800d7c:	57                   	push   %edi
+  800d7d:	56                   	push   %esi
+  800d7e:	53                   	push   %ebx
+  800d7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d85:	eb 03                	jmp    800d8a <strtol+0x11>
+		s++;
+  800d87:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d8a:	0f b6 02             	movzbl (%edx),%eax
+  800d8d:	3c 20                	cmp    $0x20,%al
+  800d8f:	74 f6                	je     800d87 <strtol+0xe>
+  800d91:	3c 09                	cmp    $0x9,%al
+  800d93:	74 f2                	je     800d87 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d95:	3c 2b                	cmp    $0x2b,%al
+  800d97:	74 2a                	je     800dc3 <strtol+0x4a>
+	int neg = 0;
+  800d99:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d9e:	3c 2d                	cmp    $0x2d,%al
+  800da0:	74 2b                	je     800dcd <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800da2:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800da8:	75 0f                	jne    800db9 <strtol+0x40>
+  800daa:	80 3a 30             	cmpb   $0x30,(%edx)
+  800dad:	74 28                	je     800dd7 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800daf:	85 db                	test   %ebx,%ebx
+  800db1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800db6:	0f 44 d8             	cmove  %eax,%ebx
+  800db9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dbe:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800dc1:	eb 46                	jmp    800e09 <strtol+0x90>
+		s++;
+  800dc3:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800dc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dcb:	eb d5                	jmp    800da2 <strtol+0x29>
+		s++, neg = 1;
+  800dcd:	83 c2 01             	add    $0x1,%edx
+  800dd0:	bf 01 00 00 00       	mov    $0x1,%edi
+  800dd5:	eb cb                	jmp    800da2 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800dd7:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ddb:	74 0e                	je     800deb <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ddd:	85 db                	test   %ebx,%ebx
+  800ddf:	75 d8                	jne    800db9 <strtol+0x40>
+		s++, base = 8;
+  800de1:	83 c2 01             	add    $0x1,%edx
+  800de4:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800de9:	eb ce                	jmp    800db9 <strtol+0x40>
+		s += 2, base = 16;
+  800deb:	83 c2 02             	add    $0x2,%edx
+  800dee:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800df3:	eb c4                	jmp    800db9 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800df5:	0f be c0             	movsbl %al,%eax
+  800df8:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800dfb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800dfe:	7d 3a                	jge    800e3a <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800e00:	83 c2 01             	add    $0x1,%edx
+  800e03:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e07:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e09:	0f b6 02             	movzbl (%edx),%eax
+  800e0c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e0f:	89 f3                	mov    %esi,%ebx
+  800e11:	80 fb 09             	cmp    $0x9,%bl
+  800e14:	76 df                	jbe    800df5 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800e16:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e19:	89 f3                	mov    %esi,%ebx
+  800e1b:	80 fb 19             	cmp    $0x19,%bl
+  800e1e:	77 08                	ja     800e28 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800e20:	0f be c0             	movsbl %al,%eax
+  800e23:	83 e8 57             	sub    $0x57,%eax
+  800e26:	eb d3                	jmp    800dfb <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e28:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e2b:	89 f3                	mov    %esi,%ebx
+  800e2d:	80 fb 19             	cmp    $0x19,%bl
+  800e30:	77 08                	ja     800e3a <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800e32:	0f be c0             	movsbl %al,%eax
+  800e35:	83 e8 37             	sub    $0x37,%eax
+  800e38:	eb c1                	jmp    800dfb <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800e3a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e3e:	74 05                	je     800e45 <strtol+0xcc>
+		*endptr = (char *) s;
+  800e40:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e43:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800e45:	89 c8                	mov    %ecx,%eax
+  800e47:	f7 d8                	neg    %eax
+  800e49:	85 ff                	test   %edi,%edi
+  800e4b:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800e4e:	89 c8                	mov    %ecx,%eax
+  800e50:	5b                   	pop    %ebx
+  800e51:	5e                   	pop    %esi
+  800e52:	5f                   	pop    %edi
+  800e53:	5d                   	pop    %ebp
+  800e54:	c3                   	ret
+
+00800e55 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	57                   	push   %edi
+  800e59:	56                   	push   %esi
+  800e5a:	53                   	push   %ebx
+  800e5b:	83 ec 0c             	sub    $0xc,%esp
+  800e5e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e61:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e64:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800e67:	85 ff                	test   %edi,%edi
+  800e69:	74 16                	je     800e81 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800e6b:	83 ec 04             	sub    $0x4,%esp
+  800e6e:	56                   	push   %esi
+  800e6f:	6a 00                	push   $0x0
+  800e71:	53                   	push   %ebx
+  800e72:	e8 02 ff ff ff       	call   800d79 <strtol>
+  800e77:	89 07                	mov    %eax,(%edi)
+  800e79:	83 c4 10             	add    $0x10,%esp
+  800e7c:	eb 03                	jmp    800e81 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800e7e:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800e81:	0f b6 03             	movzbl (%ebx),%eax
+  800e84:	3c 20                	cmp    $0x20,%al
+  800e86:	74 f6                	je     800e7e <strisl+0x29>
+  800e88:	3c 09                	cmp    $0x9,%al
+  800e8a:	74 f2                	je     800e7e <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e8c:	3c 2b                	cmp    $0x2b,%al
+  800e8e:	74 23                	je     800eb3 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800e90:	3c 2d                	cmp    $0x2d,%al
+  800e92:	0f 94 c0             	sete   %al
+  800e95:	0f b6 c0             	movzbl %al,%eax
+  800e98:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e9a:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800ea0:	75 41                	jne    800ee3 <strisl+0x8e>
+  800ea2:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800ea5:	74 11                	je     800eb8 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ea7:	85 f6                	test   %esi,%esi
+  800ea9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eae:	0f 44 f0             	cmove  %eax,%esi
+  800eb1:	eb 30                	jmp    800ee3 <strisl+0x8e>
+		s++;
+  800eb3:	83 c3 01             	add    $0x1,%ebx
+  800eb6:	eb e2                	jmp    800e9a <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800eb8:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800ebc:	74 0e                	je     800ecc <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800ebe:	85 f6                	test   %esi,%esi
+  800ec0:	75 21                	jne    800ee3 <strisl+0x8e>
+		s++, base = 8;
+  800ec2:	83 c3 01             	add    $0x1,%ebx
+  800ec5:	be 08 00 00 00       	mov    $0x8,%esi
+  800eca:	eb 17                	jmp    800ee3 <strisl+0x8e>
+		s += 2, base = 16;
+  800ecc:	83 c3 02             	add    $0x2,%ebx
+  800ecf:	be 10 00 00 00       	mov    $0x10,%esi
+  800ed4:	eb 0d                	jmp    800ee3 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ed6:	0f be c0             	movsbl %al,%eax
+  800ed9:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800edc:	39 f0                	cmp    %esi,%eax
+  800ede:	7d 38                	jge    800f18 <strisl+0xc3>
+			return 0;
+		s++;
+  800ee0:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800ee3:	0f b6 03             	movzbl (%ebx),%eax
+  800ee6:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800ee9:	80 fa 09             	cmp    $0x9,%dl
+  800eec:	76 e8                	jbe    800ed6 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800eee:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800ef1:	80 fa 19             	cmp    $0x19,%dl
+  800ef4:	77 08                	ja     800efe <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800ef6:	0f be c0             	movsbl %al,%eax
+  800ef9:	83 e8 57             	sub    $0x57,%eax
+  800efc:	eb de                	jmp    800edc <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800efe:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800f01:	80 fa 19             	cmp    $0x19,%dl
+  800f04:	77 08                	ja     800f0e <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800f06:	0f be c0             	movsbl %al,%eax
+  800f09:	83 e8 37             	sub    $0x37,%eax
+  800f0c:	eb ce                	jmp    800edc <strisl+0x87>
+		else if (!*s)
+  800f0e:	84 c0                	test   %al,%al
+  800f10:	0f 94 c0             	sete   %al
+  800f13:	0f b6 c0             	movzbl %al,%eax
+  800f16:	eb 05                	jmp    800f1d <strisl+0xc8>
+			return 0;
+  800f18:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800f1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f20:	5b                   	pop    %ebx
+  800f21:	5e                   	pop    %esi
+  800f22:	5f                   	pop    %edi
+  800f23:	5d                   	pop    %ebp
+  800f24:	c3                   	ret
+
+00800f25 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800f25:	55                   	push   %ebp
+  800f26:	89 e5                	mov    %esp,%ebp
+  800f28:	83 ec 10             	sub    $0x10,%esp
+  800f2b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800f2e:	89 c8                	mov    %ecx,%eax
+  800f30:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800f35:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800f38:	eb 0b                	jmp    800f45 <touch_mem+0x20>
+		c = *(char *)page;
+  800f3a:	0f b6 10             	movzbl (%eax),%edx
+  800f3d:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800f40:	05 00 10 00 00       	add    $0x1000,%eax
+  800f45:	39 c8                	cmp    %ecx,%eax
+  800f47:	72 f1                	jb     800f3a <touch_mem+0x15>
+}
+  800f49:	c9                   	leave
+  800f4a:	c3                   	ret
+
+00800f4b <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800f4b:	55                   	push   %ebp
+  800f4c:	89 e5                	mov    %esp,%ebp
+  800f4e:	57                   	push   %edi
+  800f4f:	56                   	push   %esi
+  800f50:	53                   	push   %ebx
+	touch_mem(s, len);
+  800f51:	ff 75 0c             	push   0xc(%ebp)
+  800f54:	ff 75 08             	push   0x8(%ebp)
+  800f57:	e8 c9 ff ff ff       	call   800f25 <touch_mem>
+	asm volatile("int %1\n"
+  800f5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f67:	89 c3                	mov    %eax,%ebx
+  800f69:	89 c7                	mov    %eax,%edi
+  800f6b:	89 c6                	mov    %eax,%esi
+  800f6d:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f6f:	83 c4 08             	add    $0x8,%esp
+  800f72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f75:	5b                   	pop    %ebx
+  800f76:	5e                   	pop    %esi
+  800f77:	5f                   	pop    %edi
+  800f78:	5d                   	pop    %ebp
+  800f79:	c3                   	ret
+
+00800f7a <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f7a:	55                   	push   %ebp
+  800f7b:	89 e5                	mov    %esp,%ebp
+  800f7d:	57                   	push   %edi
+  800f7e:	56                   	push   %esi
+  800f7f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f80:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f85:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8a:	89 d1                	mov    %edx,%ecx
+  800f8c:	89 d3                	mov    %edx,%ebx
+  800f8e:	89 d7                	mov    %edx,%edi
+  800f90:	89 d6                	mov    %edx,%esi
+  800f92:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f94:	5b                   	pop    %ebx
+  800f95:	5e                   	pop    %esi
+  800f96:	5f                   	pop    %edi
+  800f97:	5d                   	pop    %ebp
+  800f98:	c3                   	ret
+
+00800f99 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f99:	55                   	push   %ebp
+  800f9a:	89 e5                	mov    %esp,%ebp
+  800f9c:	57                   	push   %edi
+  800f9d:	56                   	push   %esi
+  800f9e:	53                   	push   %ebx
+  800f9f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fa2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fa7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800faa:	b8 03 00 00 00       	mov    $0x3,%eax
+  800faf:	89 cb                	mov    %ecx,%ebx
+  800fb1:	89 cf                	mov    %ecx,%edi
+  800fb3:	89 ce                	mov    %ecx,%esi
+  800fb5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb7:	85 c0                	test   %eax,%eax
+  800fb9:	7f 08                	jg     800fc3 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800fbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbe:	5b                   	pop    %ebx
+  800fbf:	5e                   	pop    %esi
+  800fc0:	5f                   	pop    %edi
+  800fc1:	5d                   	pop    %ebp
+  800fc2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc3:	83 ec 0c             	sub    $0xc,%esp
+  800fc6:	50                   	push   %eax
+  800fc7:	6a 03                	push   $0x3
+  800fc9:	68 4b 5b 80 00       	push   $0x805b4b
+  800fce:	6a 23                	push   $0x23
+  800fd0:	68 68 5b 80 00       	push   $0x805b68
+  800fd5:	e8 89 f4 ff ff       	call   800463 <_panic>
+
+00800fda <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800fda:	55                   	push   %ebp
+  800fdb:	89 e5                	mov    %esp,%ebp
+  800fdd:	57                   	push   %edi
+  800fde:	56                   	push   %esi
+  800fdf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fe0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe5:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fea:	89 d1                	mov    %edx,%ecx
+  800fec:	89 d3                	mov    %edx,%ebx
+  800fee:	89 d7                	mov    %edx,%edi
+  800ff0:	89 d6                	mov    %edx,%esi
+  800ff2:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ff4:	5b                   	pop    %ebx
+  800ff5:	5e                   	pop    %esi
+  800ff6:	5f                   	pop    %edi
+  800ff7:	5d                   	pop    %ebp
+  800ff8:	c3                   	ret
+
+00800ff9 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ff9:	55                   	push   %ebp
+  800ffa:	89 e5                	mov    %esp,%ebp
+  800ffc:	57                   	push   %edi
+  800ffd:	56                   	push   %esi
+  800ffe:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801004:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801009:	89 d1                	mov    %edx,%ecx
+  80100b:	89 d3                	mov    %edx,%ebx
+  80100d:	89 d7                	mov    %edx,%edi
+  80100f:	89 d6                	mov    %edx,%esi
+  801011:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801013:	5b                   	pop    %ebx
+  801014:	5e                   	pop    %esi
+  801015:	5f                   	pop    %edi
+  801016:	5d                   	pop    %ebp
+  801017:	c3                   	ret
+
+00801018 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801018:	55                   	push   %ebp
+  801019:	89 e5                	mov    %esp,%ebp
+  80101b:	57                   	push   %edi
+  80101c:	56                   	push   %esi
+  80101d:	53                   	push   %ebx
+  80101e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801021:	be 00 00 00 00       	mov    $0x0,%esi
+  801026:	8b 55 08             	mov    0x8(%ebp),%edx
+  801029:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801031:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801034:	89 f7                	mov    %esi,%edi
+  801036:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801038:	85 c0                	test   %eax,%eax
+  80103a:	7f 08                	jg     801044 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80103c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103f:	5b                   	pop    %ebx
+  801040:	5e                   	pop    %esi
+  801041:	5f                   	pop    %edi
+  801042:	5d                   	pop    %ebp
+  801043:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801044:	83 ec 0c             	sub    $0xc,%esp
+  801047:	50                   	push   %eax
+  801048:	6a 04                	push   $0x4
+  80104a:	68 4b 5b 80 00       	push   $0x805b4b
+  80104f:	6a 23                	push   $0x23
+  801051:	68 68 5b 80 00       	push   $0x805b68
+  801056:	e8 08 f4 ff ff       	call   800463 <_panic>
+
+0080105b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80105b:	55                   	push   %ebp
+  80105c:	89 e5                	mov    %esp,%ebp
+  80105e:	57                   	push   %edi
+  80105f:	56                   	push   %esi
+  801060:	53                   	push   %ebx
+  801061:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801064:	8b 55 08             	mov    0x8(%ebp),%edx
+  801067:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80106f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801072:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801075:	8b 75 18             	mov    0x18(%ebp),%esi
+  801078:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80107a:	85 c0                	test   %eax,%eax
+  80107c:	7f 08                	jg     801086 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80107e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801081:	5b                   	pop    %ebx
+  801082:	5e                   	pop    %esi
+  801083:	5f                   	pop    %edi
+  801084:	5d                   	pop    %ebp
+  801085:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801086:	83 ec 0c             	sub    $0xc,%esp
+  801089:	50                   	push   %eax
+  80108a:	6a 05                	push   $0x5
+  80108c:	68 4b 5b 80 00       	push   $0x805b4b
+  801091:	6a 23                	push   $0x23
+  801093:	68 68 5b 80 00       	push   $0x805b68
+  801098:	e8 c6 f3 ff ff       	call   800463 <_panic>
+
+0080109d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80109d:	55                   	push   %ebp
+  80109e:	89 e5                	mov    %esp,%ebp
+  8010a0:	57                   	push   %edi
+  8010a1:	56                   	push   %esi
+  8010a2:	53                   	push   %ebx
+  8010a3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b1:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010b6:	89 df                	mov    %ebx,%edi
+  8010b8:	89 de                	mov    %ebx,%esi
+  8010ba:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010bc:	85 c0                	test   %eax,%eax
+  8010be:	7f 08                	jg     8010c8 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8010c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c3:	5b                   	pop    %ebx
+  8010c4:	5e                   	pop    %esi
+  8010c5:	5f                   	pop    %edi
+  8010c6:	5d                   	pop    %ebp
+  8010c7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c8:	83 ec 0c             	sub    $0xc,%esp
+  8010cb:	50                   	push   %eax
+  8010cc:	6a 06                	push   $0x6
+  8010ce:	68 4b 5b 80 00       	push   $0x805b4b
+  8010d3:	6a 23                	push   $0x23
+  8010d5:	68 68 5b 80 00       	push   $0x805b68
+  8010da:	e8 84 f3 ff ff       	call   800463 <_panic>
+
+008010df <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  8010df:	55                   	push   %ebp
+  8010e0:	89 e5                	mov    %esp,%ebp
+  8010e2:	57                   	push   %edi
+  8010e3:	56                   	push   %esi
+  8010e4:	53                   	push   %ebx
+  8010e5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f3:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010f8:	89 df                	mov    %ebx,%edi
+  8010fa:	89 de                	mov    %ebx,%esi
+  8010fc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010fe:	85 c0                	test   %eax,%eax
+  801100:	7f 08                	jg     80110a <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801102:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801105:	5b                   	pop    %ebx
+  801106:	5e                   	pop    %esi
+  801107:	5f                   	pop    %edi
+  801108:	5d                   	pop    %ebp
+  801109:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110a:	83 ec 0c             	sub    $0xc,%esp
+  80110d:	50                   	push   %eax
+  80110e:	6a 18                	push   $0x18
+  801110:	68 4b 5b 80 00       	push   $0x805b4b
+  801115:	6a 23                	push   $0x23
+  801117:	68 68 5b 80 00       	push   $0x805b68
+  80111c:	e8 42 f3 ff ff       	call   800463 <_panic>
+
+00801121 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  801121:	55                   	push   %ebp
+  801122:	89 e5                	mov    %esp,%ebp
+  801124:	57                   	push   %edi
+  801125:	56                   	push   %esi
+  801126:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801127:	be 00 00 00 00       	mov    $0x0,%esi
+  80112c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801132:	b8 19 00 00 00       	mov    $0x19,%eax
+  801137:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80113a:	89 f7                	mov    %esi,%edi
+  80113c:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  80113e:	5b                   	pop    %ebx
+  80113f:	5e                   	pop    %esi
+  801140:	5f                   	pop    %edi
+  801141:	5d                   	pop    %ebp
+  801142:	c3                   	ret
+
+00801143 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  801143:	55                   	push   %ebp
+  801144:	89 e5                	mov    %esp,%ebp
+  801146:	57                   	push   %edi
+  801147:	56                   	push   %esi
+  801148:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801149:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801154:	be 00 00 00 00       	mov    $0x0,%esi
+  801159:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80115f:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  801161:	5b                   	pop    %ebx
+  801162:	5e                   	pop    %esi
+  801163:	5f                   	pop    %edi
+  801164:	5d                   	pop    %ebp
+  801165:	c3                   	ret
+
+00801166 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  801166:	55                   	push   %ebp
+  801167:	89 e5                	mov    %esp,%ebp
+  801169:	57                   	push   %edi
+  80116a:	56                   	push   %esi
+  80116b:	53                   	push   %ebx
+  80116c:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  80116f:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  801172:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801178:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  80117b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801181:	b8 10 00 00 00       	mov    $0x10,%eax
+  801186:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801189:	8b 75 18             	mov    0x18(%ebp),%esi
+  80118c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80118e:	85 c0                	test   %eax,%eax
+  801190:	7f 08                	jg     80119a <sys_page_map_range+0x34>
+}
+  801192:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80119a:	83 ec 0c             	sub    $0xc,%esp
+  80119d:	50                   	push   %eax
+  80119e:	6a 10                	push   $0x10
+  8011a0:	68 4b 5b 80 00       	push   $0x805b4b
+  8011a5:	6a 23                	push   $0x23
+  8011a7:	68 68 5b 80 00       	push   $0x805b68
+  8011ac:	e8 b2 f2 ff ff       	call   800463 <_panic>
+
+008011b1 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  8011b1:	55                   	push   %ebp
+  8011b2:	89 e5                	mov    %esp,%ebp
+  8011b4:	57                   	push   %edi
+  8011b5:	56                   	push   %esi
+  8011b6:	53                   	push   %ebx
+  8011b7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8011bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c5:	b8 11 00 00 00       	mov    $0x11,%eax
+  8011ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011cd:	89 f7                	mov    %esi,%edi
+  8011cf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011d1:	85 c0                	test   %eax,%eax
+  8011d3:	7f 08                	jg     8011dd <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8011d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d8:	5b                   	pop    %ebx
+  8011d9:	5e                   	pop    %esi
+  8011da:	5f                   	pop    %edi
+  8011db:	5d                   	pop    %ebp
+  8011dc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011dd:	83 ec 0c             	sub    $0xc,%esp
+  8011e0:	50                   	push   %eax
+  8011e1:	6a 11                	push   $0x11
+  8011e3:	68 4b 5b 80 00       	push   $0x805b4b
+  8011e8:	6a 23                	push   $0x23
+  8011ea:	68 68 5b 80 00       	push   $0x805b68
+  8011ef:	e8 6f f2 ff ff       	call   800463 <_panic>
+
+008011f4 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  8011f4:	55                   	push   %ebp
+  8011f5:	89 e5                	mov    %esp,%ebp
+  8011f7:	57                   	push   %edi
+  8011f8:	56                   	push   %esi
+  8011f9:	53                   	push   %ebx
+  8011fa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801202:	8b 55 08             	mov    0x8(%ebp),%edx
+  801205:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801208:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80120d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801210:	89 f7                	mov    %esi,%edi
+  801212:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801214:	85 c0                	test   %eax,%eax
+  801216:	7f 08                	jg     801220 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  801218:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80121b:	5b                   	pop    %ebx
+  80121c:	5e                   	pop    %esi
+  80121d:	5f                   	pop    %edi
+  80121e:	5d                   	pop    %ebp
+  80121f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801220:	83 ec 0c             	sub    $0xc,%esp
+  801223:	50                   	push   %eax
+  801224:	6a 1b                	push   $0x1b
+  801226:	68 4b 5b 80 00       	push   $0x805b4b
+  80122b:	6a 23                	push   $0x23
+  80122d:	68 68 5b 80 00       	push   $0x805b68
+  801232:	e8 2c f2 ff ff       	call   800463 <_panic>
+
+00801237 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  801237:	55                   	push   %ebp
+  801238:	89 e5                	mov    %esp,%ebp
+  80123a:	57                   	push   %edi
+  80123b:	56                   	push   %esi
+  80123c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80123d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801242:	b8 12 00 00 00       	mov    $0x12,%eax
+  801247:	89 d1                	mov    %edx,%ecx
+  801249:	89 d3                	mov    %edx,%ebx
+  80124b:	89 d7                	mov    %edx,%edi
+  80124d:	89 d6                	mov    %edx,%esi
+  80124f:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801251:	5b                   	pop    %ebx
+  801252:	5e                   	pop    %esi
+  801253:	5f                   	pop    %edi
+  801254:	5d                   	pop    %ebp
+  801255:	c3                   	ret
+
+00801256 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801256:	55                   	push   %ebp
+  801257:	89 e5                	mov    %esp,%ebp
+  801259:	57                   	push   %edi
+  80125a:	56                   	push   %esi
+  80125b:	53                   	push   %ebx
+  80125c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80125f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801264:	8b 55 08             	mov    0x8(%ebp),%edx
+  801267:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80126f:	89 df                	mov    %ebx,%edi
+  801271:	89 de                	mov    %ebx,%esi
+  801273:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801275:	85 c0                	test   %eax,%eax
+  801277:	7f 08                	jg     801281 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801279:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80127c:	5b                   	pop    %ebx
+  80127d:	5e                   	pop    %esi
+  80127e:	5f                   	pop    %edi
+  80127f:	5d                   	pop    %ebp
+  801280:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801281:	83 ec 0c             	sub    $0xc,%esp
+  801284:	50                   	push   %eax
+  801285:	6a 08                	push   $0x8
+  801287:	68 4b 5b 80 00       	push   $0x805b4b
+  80128c:	6a 23                	push   $0x23
+  80128e:	68 68 5b 80 00       	push   $0x805b68
+  801293:	e8 cb f1 ff ff       	call   800463 <_panic>
+
+00801298 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801298:	55                   	push   %ebp
+  801299:	89 e5                	mov    %esp,%ebp
+  80129b:	57                   	push   %edi
+  80129c:	56                   	push   %esi
+  80129d:	53                   	push   %ebx
+  80129e:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  8012a1:	6a 44                	push   $0x44
+  8012a3:	ff 75 0c             	push   0xc(%ebp)
+  8012a6:	e8 7a fc ff ff       	call   800f25 <touch_mem>
+	asm volatile("int %1\n"
+  8012ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012bb:	89 df                	mov    %ebx,%edi
+  8012bd:	89 de                	mov    %ebx,%esi
+  8012bf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012c1:	83 c4 08             	add    $0x8,%esp
+  8012c4:	85 c0                	test   %eax,%eax
+  8012c6:	7f 08                	jg     8012d0 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8012c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012cb:	5b                   	pop    %ebx
+  8012cc:	5e                   	pop    %esi
+  8012cd:	5f                   	pop    %edi
+  8012ce:	5d                   	pop    %ebp
+  8012cf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012d0:	83 ec 0c             	sub    $0xc,%esp
+  8012d3:	50                   	push   %eax
+  8012d4:	6a 09                	push   $0x9
+  8012d6:	68 4b 5b 80 00       	push   $0x805b4b
+  8012db:	6a 23                	push   $0x23
+  8012dd:	68 68 5b 80 00       	push   $0x805b68
+  8012e2:	e8 7c f1 ff ff       	call   800463 <_panic>
+
+008012e7 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  8012e7:	55                   	push   %ebp
+  8012e8:	89 e5                	mov    %esp,%ebp
+  8012ea:	57                   	push   %edi
+  8012eb:	56                   	push   %esi
+  8012ec:	53                   	push   %ebx
+  8012ed:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801300:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801303:	89 f7                	mov    %esi,%edi
+  801305:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801307:	85 c0                	test   %eax,%eax
+  801309:	7f 08                	jg     801313 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  80130b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80130e:	5b                   	pop    %ebx
+  80130f:	5e                   	pop    %esi
+  801310:	5f                   	pop    %edi
+  801311:	5d                   	pop    %ebp
+  801312:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801313:	83 ec 0c             	sub    $0xc,%esp
+  801316:	50                   	push   %eax
+  801317:	6a 1a                	push   $0x1a
+  801319:	68 4b 5b 80 00       	push   $0x805b4b
+  80131e:	6a 23                	push   $0x23
+  801320:	68 68 5b 80 00       	push   $0x805b68
+  801325:	e8 39 f1 ff ff       	call   800463 <_panic>
+
+0080132a <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  80132a:	55                   	push   %ebp
+  80132b:	89 e5                	mov    %esp,%ebp
+  80132d:	57                   	push   %edi
+  80132e:	56                   	push   %esi
+  80132f:	53                   	push   %ebx
+  801330:	83 ec 0c             	sub    $0xc,%esp
+  801333:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801336:	89 d8                	mov    %ebx,%eax
+  801338:	c1 e0 05             	shl    $0x5,%eax
+  80133b:	50                   	push   %eax
+  80133c:	ff 75 0c             	push   0xc(%ebp)
+  80133f:	e8 e1 fb ff ff       	call   800f25 <touch_mem>
+	asm volatile("int %1\n"
+  801344:	be 00 00 00 00       	mov    $0x0,%esi
+  801349:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134c:	b8 13 00 00 00       	mov    $0x13,%eax
+  801351:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801354:	89 f7                	mov    %esi,%edi
+  801356:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801358:	83 c4 08             	add    $0x8,%esp
+  80135b:	85 c0                	test   %eax,%eax
+  80135d:	7f 08                	jg     801367 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  80135f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801362:	5b                   	pop    %ebx
+  801363:	5e                   	pop    %esi
+  801364:	5f                   	pop    %edi
+  801365:	5d                   	pop    %ebp
+  801366:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801367:	83 ec 0c             	sub    $0xc,%esp
+  80136a:	50                   	push   %eax
+  80136b:	6a 13                	push   $0x13
+  80136d:	68 4b 5b 80 00       	push   $0x805b4b
+  801372:	6a 23                	push   $0x23
+  801374:	68 68 5b 80 00       	push   $0x805b68
+  801379:	e8 e5 f0 ff ff       	call   800463 <_panic>
+
+0080137e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80137e:	55                   	push   %ebp
+  80137f:	89 e5                	mov    %esp,%ebp
+  801381:	57                   	push   %edi
+  801382:	56                   	push   %esi
+  801383:	53                   	push   %ebx
+  801384:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801387:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80138f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801392:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801397:	89 df                	mov    %ebx,%edi
+  801399:	89 de                	mov    %ebx,%esi
+  80139b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80139d:	85 c0                	test   %eax,%eax
+  80139f:	7f 08                	jg     8013a9 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8013a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a4:	5b                   	pop    %ebx
+  8013a5:	5e                   	pop    %esi
+  8013a6:	5f                   	pop    %edi
+  8013a7:	5d                   	pop    %ebp
+  8013a8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013a9:	83 ec 0c             	sub    $0xc,%esp
+  8013ac:	50                   	push   %eax
+  8013ad:	6a 0a                	push   $0xa
+  8013af:	68 4b 5b 80 00       	push   $0x805b4b
+  8013b4:	6a 23                	push   $0x23
+  8013b6:	68 68 5b 80 00       	push   $0x805b68
+  8013bb:	e8 a3 f0 ff ff       	call   800463 <_panic>
+
+008013c0 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8013c0:	55                   	push   %ebp
+  8013c1:	89 e5                	mov    %esp,%ebp
+  8013c3:	57                   	push   %edi
+  8013c4:	56                   	push   %esi
+  8013c5:	53                   	push   %ebx
+  8013c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  8013c9:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8013cf:	76 1d                	jbe    8013ee <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  8013d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013dc:	be 01 00 00 00       	mov    $0x1,%esi
+  8013e1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013e4:	cd 30                	int    $0x30
+}
+  8013e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e9:	5b                   	pop    %ebx
+  8013ea:	5e                   	pop    %esi
+  8013eb:	5f                   	pop    %edi
+  8013ec:	5d                   	pop    %ebp
+  8013ed:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8013ee:	68 00 10 00 00       	push   $0x1000
+  8013f3:	53                   	push   %ebx
+  8013f4:	e8 2c fb ff ff       	call   800f25 <touch_mem>
+  8013f9:	83 c4 08             	add    $0x8,%esp
+  8013fc:	eb d3                	jmp    8013d1 <sys_ipc_send+0x11>
+
+008013fe <sys_ipc_send_pages>:
+{
+  8013fe:	55                   	push   %ebp
+  8013ff:	89 e5                	mov    %esp,%ebp
+  801401:	57                   	push   %edi
+  801402:	56                   	push   %esi
+  801403:	53                   	push   %ebx
+  801404:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801407:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  80140a:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801410:	76 18                	jbe    80142a <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  801412:	8b 55 08             	mov    0x8(%ebp),%edx
+  801415:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801418:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80141d:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801420:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  801422:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801425:	5b                   	pop    %ebx
+  801426:	5e                   	pop    %esi
+  801427:	5f                   	pop    %edi
+  801428:	5d                   	pop    %ebp
+  801429:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80142a:	89 f0                	mov    %esi,%eax
+  80142c:	c1 e0 0c             	shl    $0xc,%eax
+  80142f:	50                   	push   %eax
+  801430:	53                   	push   %ebx
+  801431:	e8 ef fa ff ff       	call   800f25 <touch_mem>
+  801436:	83 c4 08             	add    $0x8,%esp
+  801439:	eb d7                	jmp    801412 <sys_ipc_send_pages+0x14>
+
+0080143b <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  80143b:	55                   	push   %ebp
+  80143c:	89 e5                	mov    %esp,%ebp
+  80143e:	57                   	push   %edi
+  80143f:	56                   	push   %esi
+  801440:	53                   	push   %ebx
+  801441:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801444:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801449:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801454:	89 df                	mov    %ebx,%edi
+  801456:	89 de                	mov    %ebx,%esi
+  801458:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80145a:	85 c0                	test   %eax,%eax
+  80145c:	7f 08                	jg     801466 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  80145e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801461:	5b                   	pop    %ebx
+  801462:	5e                   	pop    %esi
+  801463:	5f                   	pop    %edi
+  801464:	5d                   	pop    %ebp
+  801465:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801466:	83 ec 0c             	sub    $0xc,%esp
+  801469:	50                   	push   %eax
+  80146a:	6a 0d                	push   $0xd
+  80146c:	68 4b 5b 80 00       	push   $0x805b4b
+  801471:	6a 23                	push   $0x23
+  801473:	68 68 5b 80 00       	push   $0x805b68
+  801478:	e8 e6 ef ff ff       	call   800463 <_panic>
+
+0080147d <sys_ipc_recv>:
+{
+  80147d:	55                   	push   %ebp
+  80147e:	89 e5                	mov    %esp,%ebp
+  801480:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801483:	6a 01                	push   $0x1
+  801485:	ff 75 08             	push   0x8(%ebp)
+  801488:	e8 ae ff ff ff       	call   80143b <sys_ipc_recv_pages>
+}
+  80148d:	c9                   	leave
+  80148e:	c3                   	ret
+
+0080148f <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80148f:	55                   	push   %ebp
+  801490:	89 e5                	mov    %esp,%ebp
+  801492:	57                   	push   %edi
+  801493:	56                   	push   %esi
+  801494:	53                   	push   %ebx
+  801495:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801498:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80149b:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  80149e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8014a4:	77 04                	ja     8014aa <sys_ipc_call+0x1b>
+  8014a6:	85 f6                	test   %esi,%esi
+  8014a8:	75 15                	jne    8014bf <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8014aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b0:	b8 14 00 00 00       	mov    $0x14,%eax
+  8014b5:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8014b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ba:	5b                   	pop    %ebx
+  8014bb:	5e                   	pop    %esi
+  8014bc:	5f                   	pop    %edi
+  8014bd:	5d                   	pop    %ebp
+  8014be:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8014bf:	89 f8                	mov    %edi,%eax
+  8014c1:	c1 e0 0c             	shl    $0xc,%eax
+  8014c4:	50                   	push   %eax
+  8014c5:	53                   	push   %ebx
+  8014c6:	e8 5a fa ff ff       	call   800f25 <touch_mem>
+  8014cb:	83 c4 08             	add    $0x8,%esp
+  8014ce:	eb da                	jmp    8014aa <sys_ipc_call+0x1b>
+
+008014d0 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8014d0:	55                   	push   %ebp
+  8014d1:	89 e5                	mov    %esp,%ebp
+  8014d3:	57                   	push   %edi
+  8014d4:	56                   	push   %esi
+  8014d5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014dc:	b8 15 00 00 00       	mov    $0x15,%eax
+  8014e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014e4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014e7:	8b 75 18             	mov    0x18(%ebp),%esi
+  8014ea:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8014ec:	5b                   	pop    %ebx
+  8014ed:	5e                   	pop    %esi
+  8014ee:	5f                   	pop    %edi
+  8014ef:	5d                   	pop    %ebp
+  8014f0:	c3                   	ret
+
+008014f1 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8014f1:	55                   	push   %ebp
+  8014f2:	89 e5                	mov    %esp,%ebp
+  8014f4:	57                   	push   %edi
+  8014f5:	56                   	push   %esi
+  8014f6:	53                   	push   %ebx
+  8014f7:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8014fa:	6a 04                	push   $0x4
+  8014fc:	ff 75 08             	push   0x8(%ebp)
+  8014ff:	e8 21 fa ff ff       	call   800f25 <touch_mem>
+	asm volatile("int %1\n"
+  801504:	be 00 00 00 00       	mov    $0x0,%esi
+  801509:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801511:	8b 55 08             	mov    0x8(%ebp),%edx
+  801514:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801517:	89 f7                	mov    %esi,%edi
+  801519:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80151b:	83 c4 08             	add    $0x8,%esp
+  80151e:	85 c0                	test   %eax,%eax
+  801520:	7f 08                	jg     80152a <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  801522:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801525:	5b                   	pop    %ebx
+  801526:	5e                   	pop    %esi
+  801527:	5f                   	pop    %edi
+  801528:	5d                   	pop    %ebp
+  801529:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80152a:	83 ec 0c             	sub    $0xc,%esp
+  80152d:	50                   	push   %eax
+  80152e:	6a 16                	push   $0x16
+  801530:	68 4b 5b 80 00       	push   $0x805b4b
+  801535:	6a 23                	push   $0x23
+  801537:	68 68 5b 80 00       	push   $0x805b68
+  80153c:	e8 22 ef ff ff       	call   800463 <_panic>
+
+00801541 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801541:	55                   	push   %ebp
+  801542:	89 e5                	mov    %esp,%ebp
+  801544:	57                   	push   %edi
+  801545:	56                   	push   %esi
+  801546:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801547:	6a 04                	push   $0x4
+  801549:	ff 75 08             	push   0x8(%ebp)
+  80154c:	e8 d4 f9 ff ff       	call   800f25 <touch_mem>
+	asm volatile("int %1\n"
+  801551:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801556:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801559:	b8 17 00 00 00       	mov    $0x17,%eax
+  80155e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801561:	89 df                	mov    %ebx,%edi
+  801563:	89 de                	mov    %ebx,%esi
+  801565:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801567:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80156a:	5b                   	pop    %ebx
+  80156b:	5e                   	pop    %esi
+  80156c:	5f                   	pop    %edi
+  80156d:	5d                   	pop    %ebp
+  80156e:	c3                   	ret
+
+0080156f <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80156f:	55                   	push   %ebp
+  801570:	89 e5                	mov    %esp,%ebp
+  801572:	57                   	push   %edi
+  801573:	56                   	push   %esi
+  801574:	53                   	push   %ebx
+  801575:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801578:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801580:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801585:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80158a:	89 df                	mov    %ebx,%edi
+  80158c:	89 de                	mov    %ebx,%esi
+  80158e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801590:	85 c0                	test   %eax,%eax
+  801592:	7f 08                	jg     80159c <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801594:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801597:	5b                   	pop    %ebx
+  801598:	5e                   	pop    %esi
+  801599:	5f                   	pop    %edi
+  80159a:	5d                   	pop    %ebp
+  80159b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80159c:	83 ec 0c             	sub    $0xc,%esp
+  80159f:	50                   	push   %eax
+  8015a0:	6a 0e                	push   $0xe
+  8015a2:	68 4b 5b 80 00       	push   $0x805b4b
+  8015a7:	6a 23                	push   $0x23
+  8015a9:	68 68 5b 80 00       	push   $0x805b68
+  8015ae:	e8 b0 ee ff ff       	call   800463 <_panic>
+
+008015b3 <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  8015b3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015ba:	f6 c6 06             	test   $0x6,%dh
+  8015bd:	75 37                	jne    8015f6 <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  8015bf:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015c6:	f6 c2 02             	test   $0x2,%dl
+  8015c9:	75 19                	jne    8015e4 <dupperm+0x31>
+  8015cb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015d2:	f6 c6 08             	test   $0x8,%dh
+  8015d5:	75 0d                	jne    8015e4 <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  8015d7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015de:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015e3:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  8015e4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015eb:	25 00 06 00 00       	and    $0x600,%eax
+  8015f0:	0d 05 08 00 00       	or     $0x805,%eax
+  8015f5:	c3                   	ret
+		return 0;
+  8015f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015fb:	c3                   	ret
+
+008015fc <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  8015fc:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  8015fe:	c1 e0 0c             	shl    $0xc,%eax
+  801601:	c1 e8 16             	shr    $0x16,%eax
+  801604:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  80160b:	f6 c1 01             	test   $0x1,%cl
+  80160e:	74 2c                	je     80163c <dupable+0x40>
+  801610:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801617:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161c:	f6 c1 04             	test   $0x4,%cl
+  80161f:	74 20                	je     801641 <dupable+0x45>
+  801621:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801628:	f6 c1 01             	test   $0x1,%cl
+  80162b:	74 14                	je     801641 <dupable+0x45>
+  80162d:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801634:	c1 e8 02             	shr    $0x2,%eax
+  801637:	83 e0 01             	and    $0x1,%eax
+  80163a:	eb 05                	jmp    801641 <dupable+0x45>
+  80163c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801641:	83 e0 01             	and    $0x1,%eax
+}
+  801644:	c3                   	ret
+
+00801645 <pgfault>:
+{
+  801645:	55                   	push   %ebp
+  801646:	89 e5                	mov    %esp,%ebp
+  801648:	56                   	push   %esi
+  801649:	53                   	push   %ebx
+  80164a:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  80164d:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  80164f:	89 ca                	mov    %ecx,%edx
+  801651:	c1 ea 0c             	shr    $0xc,%edx
+  801654:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  80165b:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  80165f:	0f 84 8e 00 00 00    	je     8016f3 <pgfault+0xae>
+		return 0;
+  801665:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  80166a:	f6 c6 08             	test   $0x8,%dh
+  80166d:	0f 84 85 00 00 00    	je     8016f8 <pgfault+0xb3>
+	perm |= PTE_W;
+  801673:	81 e2 07 06 00 00    	and    $0x607,%edx
+  801679:	89 d3                	mov    %edx,%ebx
+  80167b:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80167e:	89 ce                	mov    %ecx,%esi
+  801680:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  801686:	6a 01                	push   $0x1
+  801688:	53                   	push   %ebx
+  801689:	68 00 f0 7f 00       	push   $0x7ff000
+  80168e:	6a 00                	push   $0x0
+  801690:	e8 a5 27 00 00       	call   803e3a <page_alloc>
+  801695:	83 c4 10             	add    $0x10,%esp
+  801698:	85 c0                	test   %eax,%eax
+  80169a:	78 33                	js     8016cf <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  80169c:	83 ec 04             	sub    $0x4,%esp
+  80169f:	68 00 10 00 00       	push   $0x1000
+  8016a4:	56                   	push   %esi
+  8016a5:	68 00 f0 7f 00       	push   $0x7ff000
+  8016aa:	e8 fc f5 ff ff       	call   800cab <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  8016af:	89 1c 24             	mov    %ebx,(%esp)
+  8016b2:	56                   	push   %esi
+  8016b3:	6a 00                	push   $0x0
+  8016b5:	68 00 f0 7f 00       	push   $0x7ff000
+  8016ba:	6a 00                	push   $0x0
+  8016bc:	e8 da 2d 00 00       	call   80449b <page_map>
+  8016c1:	83 c4 20             	add    $0x20,%esp
+  8016c4:	85 c0                	test   %eax,%eax
+  8016c6:	78 19                	js     8016e1 <pgfault+0x9c>
+	return 1;
+  8016c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016cd:	eb 29                	jmp    8016f8 <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  8016cf:	50                   	push   %eax
+  8016d0:	68 78 5b 80 00       	push   $0x805b78
+  8016d5:	6a 2e                	push   $0x2e
+  8016d7:	68 cb 5b 80 00       	push   $0x805bcb
+  8016dc:	e8 82 ed ff ff       	call   800463 <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  8016e1:	50                   	push   %eax
+  8016e2:	68 a4 5b 80 00       	push   $0x805ba4
+  8016e7:	6a 32                	push   $0x32
+  8016e9:	68 cb 5b 80 00       	push   $0x805bcb
+  8016ee:	e8 70 ed ff ff       	call   800463 <_panic>
+		return 0;
+  8016f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016fb:	5b                   	pop    %ebx
+  8016fc:	5e                   	pop    %esi
+  8016fd:	5d                   	pop    %ebp
+  8016fe:	c3                   	ret
+
+008016ff <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8016ff:	55                   	push   %ebp
+  801700:	89 e5                	mov    %esp,%ebp
+  801702:	57                   	push   %edi
+  801703:	56                   	push   %esi
+  801704:	53                   	push   %ebx
+  801705:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  801708:	83 3d 20 f9 82 00 00 	cmpl   $0x0,0x82f920
+  80170f:	74 5d                	je     80176e <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  801711:	83 ec 0c             	sub    $0xc,%esp
+  801714:	68 45 16 80 00       	push   $0x801645
+  801719:	e8 de 39 00 00       	call   8050fc <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  80171e:	e8 14 fb ff ff       	call   801237 <sys_fork>
+  801723:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801726:	83 c4 10             	add    $0x10,%esp
+  801729:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  80172c:	74 47                	je     801775 <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  80172e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801732:	0f 84 c5 03 00 00    	je     801afd <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  801738:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80173c:	78 25                	js     801763 <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  80173e:	e8 6f 20 00 00       	call   8037b2 <page_share_paged_out>
+  801743:	85 c0                	test   %eax,%eax
+  801745:	0f 88 d8 03 00 00    	js     801b23 <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  80174b:	83 ec 08             	sub    $0x8,%esp
+  80174e:	6a 02                	push   $0x2
+  801750:	ff 75 e4             	push   -0x1c(%ebp)
+  801753:	e8 fe fa ff ff       	call   801256 <sys_env_set_status>
+  801758:	83 c4 10             	add    $0x10,%esp
+  80175b:	85 c0                	test   %eax,%eax
+  80175d:	0f 88 d5 03 00 00    	js     801b38 <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  801763:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801766:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801769:	5b                   	pop    %ebx
+  80176a:	5e                   	pop    %esi
+  80176b:	5f                   	pop    %edi
+  80176c:	5d                   	pop    %ebp
+  80176d:	c3                   	ret
+		init_map_dir();
+  80176e:	e8 47 23 00 00       	call   803aba <init_map_dir>
+  801773:	eb 9c                	jmp    801711 <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801775:	b8 07 00 00 00       	mov    $0x7,%eax
+  80177a:	cd 30                	int    $0x30
+  80177c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  80177f:	85 c0                	test   %eax,%eax
+  801781:	78 10                	js     801793 <fork+0x94>
+	if (envid == 0)
+  801783:	0f 84 74 03 00 00    	je     801afd <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801789:	be 00 00 00 00       	mov    $0x0,%esi
+  80178e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801791:	eb 30                	jmp    8017c3 <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  801793:	50                   	push   %eax
+  801794:	68 d6 5b 80 00       	push   $0x805bd6
+  801799:	68 cd 00 00 00       	push   $0xcd
+  80179e:	68 cb 5b 80 00       	push   $0x805bcb
+  8017a3:	e8 bb ec ff ff       	call   800463 <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  8017a8:	89 f2                	mov    %esi,%edx
+  8017aa:	c1 fa 1f             	sar    $0x1f,%edx
+  8017ad:	c1 ea 16             	shr    $0x16,%edx
+  8017b0:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8017b3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017b8:	29 d0                	sub    %edx,%eax
+  8017ba:	ba 00 04 00 00       	mov    $0x400,%edx
+  8017bf:	29 c2                	sub    %eax,%edx
+  8017c1:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  8017c3:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8017c6:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  8017cc:	0f 87 ff 02 00 00    	ja     801ad1 <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  8017d2:	89 f3                	mov    %esi,%ebx
+  8017d4:	c1 e3 0c             	shl    $0xc,%ebx
+  8017d7:	89 d8                	mov    %ebx,%eax
+  8017d9:	c1 e8 16             	shr    $0x16,%eax
+  8017dc:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8017e3:	f6 c2 01             	test   $0x1,%dl
+  8017e6:	74 c0                	je     8017a8 <fork+0xa9>
+  8017e8:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8017ef:	f6 c2 04             	test   $0x4,%dl
+  8017f2:	74 b4                	je     8017a8 <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  8017f4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8017fb:	a8 80                	test   $0x80,%al
+  8017fd:	75 24                	jne    801823 <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  8017ff:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801806:	25 81 00 00 00       	and    $0x81,%eax
+  80180b:	3d 80 00 00 00       	cmp    $0x80,%eax
+  801810:	74 21                	je     801833 <fork+0x134>
+		if (!dupable(pn)) {
+  801812:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801815:	e8 e2 fd ff ff       	call   8015fc <dupable>
+  80181a:	84 c0                	test   %al,%al
+  80181c:	75 1a                	jne    801838 <fork+0x139>
+			++pn;
+  80181e:	83 c6 01             	add    $0x1,%esi
+			continue;
+  801821:	eb a0                	jmp    8017c3 <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  801823:	83 ec 08             	sub    $0x8,%esp
+  801826:	53                   	push   %ebx
+  801827:	6a 00                	push   $0x0
+  801829:	e8 b1 f8 ff ff       	call   8010df <sys_page_split>
+  80182e:	83 c4 10             	add    $0x10,%esp
+  801831:	eb cc                	jmp    8017ff <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  801833:	0f b6 03             	movzbl (%ebx),%eax
+  801836:	eb da                	jmp    801812 <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  801838:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80183b:	89 f8                	mov    %edi,%eax
+  80183d:	e8 71 fd ff ff       	call   8015b3 <dupperm>
+  801842:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801845:	85 c0                	test   %eax,%eax
+  801847:	74 16                	je     80185f <fork+0x160>
+  801849:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  80184e:	29 f8                	sub    %edi,%eax
+  801850:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801853:	bf 01 00 00 00       	mov    $0x1,%edi
+  801858:	89 c6                	mov    %eax,%esi
+  80185a:	e9 c4 01 00 00       	jmp    801a23 <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  80185f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801862:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801869:	f6 c4 04             	test   $0x4,%ah
+  80186c:	0f 85 89 00 00 00    	jne    8018fb <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  801872:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801875:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80187c:	f6 c4 02             	test   $0x2,%ah
+  80187f:	0f 85 b1 00 00 00    	jne    801936 <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  801885:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801888:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80188f:	a8 02                	test   $0x2,%al
+  801891:	75 10                	jne    8018a3 <fork+0x1a4>
+  801893:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80189a:	f6 c4 08             	test   $0x8,%ah
+  80189d:	0f 84 3e 01 00 00    	je     8019e1 <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  8018a3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8018a6:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8018ad:	25 00 06 00 00       	and    $0x600,%eax
+  8018b2:	0d 05 08 00 00       	or     $0x805,%eax
+  8018b7:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  8018b9:	c1 e1 0c             	shl    $0xc,%ecx
+  8018bc:	89 cb                	mov    %ecx,%ebx
+  8018be:	83 ec 0c             	sub    $0xc,%esp
+  8018c1:	50                   	push   %eax
+  8018c2:	51                   	push   %ecx
+  8018c3:	ff 75 e4             	push   -0x1c(%ebp)
+  8018c6:	51                   	push   %ecx
+  8018c7:	6a 00                	push   $0x0
+  8018c9:	e8 cd 2b 00 00       	call   80449b <page_map>
+  8018ce:	83 c4 20             	add    $0x20,%esp
+  8018d1:	85 c0                	test   %eax,%eax
+  8018d3:	0f 88 e4 00 00 00    	js     8019bd <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  8018d9:	83 ec 0c             	sub    $0xc,%esp
+  8018dc:	57                   	push   %edi
+  8018dd:	53                   	push   %ebx
+  8018de:	6a 00                	push   $0x0
+  8018e0:	53                   	push   %ebx
+  8018e1:	6a 00                	push   $0x0
+  8018e3:	e8 b3 2b 00 00       	call   80449b <page_map>
+  8018e8:	83 c4 20             	add    $0x20,%esp
+  8018eb:	85 c0                	test   %eax,%eax
+  8018ed:	0f 88 dc 00 00 00    	js     8019cf <fork+0x2d0>
+			++pn;
+  8018f3:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8018f6:	e9 c8 fe ff ff       	jmp    8017c3 <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8018fb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8018fe:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801905:	c1 e1 0c             	shl    $0xc,%ecx
+  801908:	83 ec 0c             	sub    $0xc,%esp
+  80190b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801910:	50                   	push   %eax
+  801911:	51                   	push   %ecx
+  801912:	ff 75 e4             	push   -0x1c(%ebp)
+  801915:	51                   	push   %ecx
+  801916:	6a 00                	push   $0x0
+  801918:	e8 7e 2b 00 00       	call   80449b <page_map>
+  80191d:	83 c4 20             	add    $0x20,%esp
+  801920:	85 c0                	test   %eax,%eax
+  801922:	79 cf                	jns    8018f3 <fork+0x1f4>
+			panic("page_map %d", r);
+  801924:	50                   	push   %eax
+  801925:	68 e6 5b 80 00       	push   $0x805be6
+  80192a:	6a 4d                	push   $0x4d
+  80192c:	68 cb 5b 80 00       	push   $0x805bcb
+  801931:	e8 2d eb ff ff       	call   800463 <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  801936:	83 ec 0c             	sub    $0xc,%esp
+  801939:	68 00 10 00 00       	push   $0x1000
+  80193e:	e8 4a 31 00 00       	call   804a8d <malloc>
+  801943:	89 c7                	mov    %eax,%edi
+  801945:	83 c4 10             	add    $0x10,%esp
+  801948:	85 c0                	test   %eax,%eax
+  80194a:	74 4b                	je     801997 <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  80194c:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80194f:	c1 e3 0c             	shl    $0xc,%ebx
+  801952:	83 ec 04             	sub    $0x4,%esp
+  801955:	68 00 10 00 00       	push   $0x1000
+  80195a:	53                   	push   %ebx
+  80195b:	50                   	push   %eax
+  80195c:	e8 ac f3 ff ff       	call   800d0d <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  801961:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801964:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80196b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801970:	89 04 24             	mov    %eax,(%esp)
+  801973:	53                   	push   %ebx
+  801974:	ff 75 e4             	push   -0x1c(%ebp)
+  801977:	57                   	push   %edi
+  801978:	6a 00                	push   $0x0
+  80197a:	e8 1c 2b 00 00       	call   80449b <page_map>
+  80197f:	83 c4 20             	add    $0x20,%esp
+  801982:	85 c0                	test   %eax,%eax
+  801984:	78 25                	js     8019ab <fork+0x2ac>
+		free(temp);
+  801986:	83 ec 0c             	sub    $0xc,%esp
+  801989:	57                   	push   %edi
+  80198a:	e8 fc 2e 00 00       	call   80488b <free>
+  80198f:	83 c4 10             	add    $0x10,%esp
+  801992:	e9 5c ff ff ff       	jmp    8018f3 <fork+0x1f4>
+			panic("malloc failed");
+  801997:	83 ec 04             	sub    $0x4,%esp
+  80199a:	68 f2 5b 80 00       	push   $0x805bf2
+  80199f:	6a 56                	push   $0x56
+  8019a1:	68 cb 5b 80 00       	push   $0x805bcb
+  8019a6:	e8 b8 ea ff ff       	call   800463 <_panic>
+			panic("page_map: %e", r);
+  8019ab:	50                   	push   %eax
+  8019ac:	68 00 5c 80 00       	push   $0x805c00
+  8019b1:	6a 59                	push   $0x59
+  8019b3:	68 cb 5b 80 00       	push   $0x805bcb
+  8019b8:	e8 a6 ea ff ff       	call   800463 <_panic>
+			panic("page_map %d", r);
+  8019bd:	50                   	push   %eax
+  8019be:	68 e6 5b 80 00       	push   $0x805be6
+  8019c3:	6a 65                	push   $0x65
+  8019c5:	68 cb 5b 80 00       	push   $0x805bcb
+  8019ca:	e8 94 ea ff ff       	call   800463 <_panic>
+			panic("page_map %d", r);
+  8019cf:	50                   	push   %eax
+  8019d0:	68 e6 5b 80 00       	push   $0x805be6
+  8019d5:	6a 78                	push   $0x78
+  8019d7:	68 cb 5b 80 00       	push   $0x805bcb
+  8019dc:	e8 82 ea ff ff       	call   800463 <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8019e1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8019e4:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8019eb:	c1 e1 0c             	shl    $0xc,%ecx
+  8019ee:	83 ec 0c             	sub    $0xc,%esp
+  8019f1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019f6:	50                   	push   %eax
+  8019f7:	51                   	push   %ecx
+  8019f8:	ff 75 e4             	push   -0x1c(%ebp)
+  8019fb:	51                   	push   %ecx
+  8019fc:	6a 00                	push   $0x0
+  8019fe:	e8 98 2a 00 00       	call   80449b <page_map>
+  801a03:	83 c4 20             	add    $0x20,%esp
+  801a06:	85 c0                	test   %eax,%eax
+  801a08:	0f 89 e5 fe ff ff    	jns    8018f3 <fork+0x1f4>
+			panic("page_map %d", r);
+  801a0e:	50                   	push   %eax
+  801a0f:	68 e6 5b 80 00       	push   $0x805be6
+  801a14:	6a 7f                	push   $0x7f
+  801a16:	68 cb 5b 80 00       	push   $0x805bcb
+  801a1b:	e8 43 ea ff ff       	call   800463 <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801a20:	83 c7 01             	add    $0x1,%edi
+  801a23:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a26:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  801a29:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  801a2c:	39 f7                	cmp    %esi,%edi
+  801a2e:	74 1c                	je     801a4c <fork+0x34d>
+  801a30:	89 d8                	mov    %ebx,%eax
+  801a32:	e8 c5 fb ff ff       	call   8015fc <dupable>
+  801a37:	84 c0                	test   %al,%al
+  801a39:	74 7c                	je     801ab7 <fork+0x3b8>
+  801a3b:	89 d8                	mov    %ebx,%eax
+  801a3d:	e8 71 fb ff ff       	call   8015b3 <dupperm>
+  801a42:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  801a45:	74 d9                	je     801a20 <fork+0x321>
+  801a47:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801a4a:	eb 06                	jmp    801a52 <fork+0x353>
+  801a4c:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801a4f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  801a52:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a55:	c1 e0 0c             	shl    $0xc,%eax
+  801a58:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801a5b:	83 ec 08             	sub    $0x8,%esp
+  801a5e:	ff 75 dc             	push   -0x24(%ebp)
+  801a61:	57                   	push   %edi
+  801a62:	50                   	push   %eax
+  801a63:	ff 75 e4             	push   -0x1c(%ebp)
+  801a66:	50                   	push   %eax
+  801a67:	6a 00                	push   $0x0
+  801a69:	e8 24 2c 00 00       	call   804692 <page_map_range>
+  801a6e:	83 c4 20             	add    $0x20,%esp
+  801a71:	85 c0                	test   %eax,%eax
+  801a73:	78 47                	js     801abc <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  801a75:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801a7c:	0f 84 41 fd ff ff    	je     8017c3 <fork+0xc4>
+  801a82:	83 ec 08             	sub    $0x8,%esp
+  801a85:	ff 75 dc             	push   -0x24(%ebp)
+  801a88:	57                   	push   %edi
+  801a89:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a8c:	50                   	push   %eax
+  801a8d:	6a 00                	push   $0x0
+  801a8f:	50                   	push   %eax
+  801a90:	6a 00                	push   $0x0
+  801a92:	e8 fb 2b 00 00       	call   804692 <page_map_range>
+  801a97:	83 c4 20             	add    $0x20,%esp
+  801a9a:	85 c0                	test   %eax,%eax
+  801a9c:	0f 89 21 fd ff ff    	jns    8017c3 <fork+0xc4>
+		panic("page_map_range %e", r);
+  801aa2:	50                   	push   %eax
+  801aa3:	68 0d 5c 80 00       	push   $0x805c0d
+  801aa8:	68 a2 00 00 00       	push   $0xa2
+  801aad:	68 cb 5b 80 00       	push   $0x805bcb
+  801ab2:	e8 ac e9 ff ff       	call   800463 <_panic>
+  801ab7:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801aba:	eb 96                	jmp    801a52 <fork+0x353>
+		panic("page_map_range %e", r);
+  801abc:	50                   	push   %eax
+  801abd:	68 0d 5c 80 00       	push   $0x805c0d
+  801ac2:	68 a0 00 00 00       	push   $0xa0
+  801ac7:	68 cb 5b 80 00       	push   $0x805bcb
+  801acc:	e8 92 e9 ff ff       	call   800463 <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  801ad1:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  801ad4:	6a 01                	push   $0x1
+  801ad6:	6a 07                	push   $0x7
+  801ad8:	68 00 f0 bf ee       	push   $0xeebff000
+  801add:	53                   	push   %ebx
+  801ade:	e8 57 23 00 00       	call   803e3a <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801ae3:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  801ae8:	8b 40 74             	mov    0x74(%eax),%eax
+  801aeb:	83 c4 08             	add    $0x8,%esp
+  801aee:	50                   	push   %eax
+  801aef:	53                   	push   %ebx
+  801af0:	e8 89 f8 ff ff       	call   80137e <sys_env_set_pgfault_upcall>
+  801af5:	83 c4 10             	add    $0x10,%esp
+  801af8:	e9 41 fc ff ff       	jmp    80173e <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801afd:	e8 d8 f4 ff ff       	call   800fda <sys_getenvid>
+  801b02:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b07:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801b0a:	c1 e0 06             	shl    $0x6,%eax
+  801b0d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801b12:	a3 24 f9 82 00       	mov    %eax,0x82f924
+		return 0;
+  801b17:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801b1e:	e9 40 fc ff ff       	jmp    801763 <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  801b23:	50                   	push   %eax
+  801b24:	68 1f 5c 80 00       	push   $0x805c1f
+  801b29:	68 27 01 00 00       	push   $0x127
+  801b2e:	68 cb 5b 80 00       	push   $0x805bcb
+  801b33:	e8 2b e9 ff ff       	call   800463 <_panic>
+		panic("sys_env_set_status: %d", r);
+  801b38:	50                   	push   %eax
+  801b39:	68 38 5c 80 00       	push   $0x805c38
+  801b3e:	68 2b 01 00 00       	push   $0x12b
+  801b43:	68 cb 5b 80 00       	push   $0x805bcb
+  801b48:	e8 16 e9 ff ff       	call   800463 <_panic>
+
+00801b4d <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801b4d:	55                   	push   %ebp
+  801b4e:	89 e5                	mov    %esp,%ebp
+  801b50:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801b53:	68 4f 5c 80 00       	push   $0x805c4f
+  801b58:	68 35 01 00 00       	push   $0x135
+  801b5d:	68 cb 5b 80 00       	push   $0x805bcb
+  801b62:	e8 fc e8 ff ff       	call   800463 <_panic>
+
+00801b67 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801b67:	55                   	push   %ebp
+  801b68:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b6d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801b72:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801b75:	5d                   	pop    %ebp
+  801b76:	c3                   	ret
+
+00801b77 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801b77:	55                   	push   %ebp
+  801b78:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b7d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801b82:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801b87:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801b8c:	5d                   	pop    %ebp
+  801b8d:	c3                   	ret
+
+00801b8e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801b8e:	55                   	push   %ebp
+  801b8f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801b91:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801b96:	a8 01                	test   $0x1,%al
+  801b98:	74 3c                	je     801bd6 <fd_alloc+0x48>
+  801b9a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801b9f:	89 c2                	mov    %eax,%edx
+  801ba1:	c1 ea 0c             	shr    $0xc,%edx
+  801ba4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801bab:	89 c1                	mov    %eax,%ecx
+  801bad:	05 00 10 00 00       	add    $0x1000,%eax
+  801bb2:	f6 c2 01             	test   $0x1,%dl
+  801bb5:	74 13                	je     801bca <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801bb7:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801bbc:	75 e1                	jne    801b9f <fd_alloc+0x11>
+  801bbe:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801bc3:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801bc8:	eb 05                	jmp    801bcf <fd_alloc+0x41>
+			return 0;
+  801bca:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801bcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bd2:	89 0a                	mov    %ecx,(%edx)
+}
+  801bd4:	5d                   	pop    %ebp
+  801bd5:	c3                   	ret
+  801bd6:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be0:	eb ed                	jmp    801bcf <fd_alloc+0x41>
+
+00801be2 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801be2:	55                   	push   %ebp
+  801be3:	89 e5                	mov    %esp,%ebp
+  801be5:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801be8:	83 f8 1f             	cmp    $0x1f,%eax
+  801beb:	77 30                	ja     801c1d <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801bed:	c1 e0 0c             	shl    $0xc,%eax
+  801bf0:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801bf5:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801bfb:	f6 c2 01             	test   $0x1,%dl
+  801bfe:	74 24                	je     801c24 <fd_lookup+0x42>
+  801c00:	89 c2                	mov    %eax,%edx
+  801c02:	c1 ea 0c             	shr    $0xc,%edx
+  801c05:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c0c:	f6 c2 01             	test   $0x1,%dl
+  801c0f:	74 1a                	je     801c2b <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801c11:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c14:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801c16:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c1b:	5d                   	pop    %ebp
+  801c1c:	c3                   	ret
+		return -E_INVAL;
+  801c1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c22:	eb f7                	jmp    801c1b <fd_lookup+0x39>
+		return -E_INVAL;
+  801c24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c29:	eb f0                	jmp    801c1b <fd_lookup+0x39>
+  801c2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c30:	eb e9                	jmp    801c1b <fd_lookup+0x39>
+
+00801c32 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801c32:	55                   	push   %ebp
+  801c33:	89 e5                	mov    %esp,%ebp
+  801c35:	53                   	push   %ebx
+  801c36:	83 ec 04             	sub    $0x4,%esp
+  801c39:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801c3c:	b8 e4 5c 80 00       	mov    $0x805ce4,%eax
+  801c41:	8b 18                	mov    (%eax),%ebx
+  801c43:	85 db                	test   %ebx,%ebx
+  801c45:	74 0e                	je     801c55 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801c47:	83 c0 04             	add    $0x4,%eax
+  801c4a:	39 13                	cmp    %edx,(%ebx)
+  801c4c:	75 f3                	jne    801c41 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c53:	eb 1f                	jmp    801c74 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c55:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  801c5a:	8b 40 48             	mov    0x48(%eax),%eax
+  801c5d:	83 ec 04             	sub    $0x4,%esp
+  801c60:	52                   	push   %edx
+  801c61:	50                   	push   %eax
+  801c62:	68 68 5c 80 00       	push   $0x805c68
+  801c67:	e8 d2 e8 ff ff       	call   80053e <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801c6c:	83 c4 10             	add    $0x10,%esp
+  801c6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801c74:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c77:	89 1a                	mov    %ebx,(%edx)
+}
+  801c79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c7c:	c9                   	leave
+  801c7d:	c3                   	ret
+
+00801c7e <fd_close>:
+{
+  801c7e:	55                   	push   %ebp
+  801c7f:	89 e5                	mov    %esp,%ebp
+  801c81:	57                   	push   %edi
+  801c82:	56                   	push   %esi
+  801c83:	53                   	push   %ebx
+  801c84:	83 ec 24             	sub    $0x24,%esp
+  801c87:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c8a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801c8d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c90:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c91:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801c97:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801c9a:	50                   	push   %eax
+  801c9b:	e8 42 ff ff ff       	call   801be2 <fd_lookup>
+  801ca0:	89 c3                	mov    %eax,%ebx
+  801ca2:	83 c4 10             	add    $0x10,%esp
+  801ca5:	85 c0                	test   %eax,%eax
+  801ca7:	78 05                	js     801cae <fd_close+0x30>
+	    || fd != fd2)
+  801ca9:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801cac:	74 16                	je     801cc4 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801cae:	89 f8                	mov    %edi,%eax
+  801cb0:	84 c0                	test   %al,%al
+  801cb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb7:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801cba:	89 d8                	mov    %ebx,%eax
+  801cbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cbf:	5b                   	pop    %ebx
+  801cc0:	5e                   	pop    %esi
+  801cc1:	5f                   	pop    %edi
+  801cc2:	5d                   	pop    %ebp
+  801cc3:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801cc4:	83 ec 08             	sub    $0x8,%esp
+  801cc7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801cca:	50                   	push   %eax
+  801ccb:	ff 36                	push   (%esi)
+  801ccd:	e8 60 ff ff ff       	call   801c32 <dev_lookup>
+  801cd2:	89 c3                	mov    %eax,%ebx
+  801cd4:	83 c4 10             	add    $0x10,%esp
+  801cd7:	85 c0                	test   %eax,%eax
+  801cd9:	78 1a                	js     801cf5 <fd_close+0x77>
+		if (dev->dev_close)
+  801cdb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801cde:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801ce1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801ce6:	85 c0                	test   %eax,%eax
+  801ce8:	74 0b                	je     801cf5 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801cea:	83 ec 0c             	sub    $0xc,%esp
+  801ced:	56                   	push   %esi
+  801cee:	ff d0                	call   *%eax
+  801cf0:	89 c3                	mov    %eax,%ebx
+  801cf2:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801cf5:	83 ec 08             	sub    $0x8,%esp
+  801cf8:	56                   	push   %esi
+  801cf9:	6a 00                	push   $0x0
+  801cfb:	e8 9d f3 ff ff       	call   80109d <sys_page_unmap>
+	return r;
+  801d00:	83 c4 10             	add    $0x10,%esp
+  801d03:	eb b5                	jmp    801cba <fd_close+0x3c>
+
+00801d05 <close>:
+
+int
+close(int fdnum)
+{
+  801d05:	55                   	push   %ebp
+  801d06:	89 e5                	mov    %esp,%ebp
+  801d08:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d0b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d0e:	50                   	push   %eax
+  801d0f:	ff 75 08             	push   0x8(%ebp)
+  801d12:	e8 cb fe ff ff       	call   801be2 <fd_lookup>
+  801d17:	83 c4 10             	add    $0x10,%esp
+  801d1a:	85 c0                	test   %eax,%eax
+  801d1c:	79 02                	jns    801d20 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801d1e:	c9                   	leave
+  801d1f:	c3                   	ret
+		return fd_close(fd, 1);
+  801d20:	83 ec 08             	sub    $0x8,%esp
+  801d23:	6a 01                	push   $0x1
+  801d25:	ff 75 f4             	push   -0xc(%ebp)
+  801d28:	e8 51 ff ff ff       	call   801c7e <fd_close>
+  801d2d:	83 c4 10             	add    $0x10,%esp
+  801d30:	eb ec                	jmp    801d1e <close+0x19>
+
+00801d32 <close_all>:
+
+void
+close_all(void)
+{
+  801d32:	55                   	push   %ebp
+  801d33:	89 e5                	mov    %esp,%ebp
+  801d35:	53                   	push   %ebx
+  801d36:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801d39:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801d3e:	83 ec 0c             	sub    $0xc,%esp
+  801d41:	53                   	push   %ebx
+  801d42:	e8 be ff ff ff       	call   801d05 <close>
+	for (i = 0; i < MAXFD; i++)
+  801d47:	83 c3 01             	add    $0x1,%ebx
+  801d4a:	83 c4 10             	add    $0x10,%esp
+  801d4d:	83 fb 20             	cmp    $0x20,%ebx
+  801d50:	75 ec                	jne    801d3e <close_all+0xc>
+}
+  801d52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d55:	c9                   	leave
+  801d56:	c3                   	ret
+
+00801d57 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801d57:	55                   	push   %ebp
+  801d58:	89 e5                	mov    %esp,%ebp
+  801d5a:	57                   	push   %edi
+  801d5b:	56                   	push   %esi
+  801d5c:	53                   	push   %ebx
+  801d5d:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801d60:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d63:	50                   	push   %eax
+  801d64:	ff 75 08             	push   0x8(%ebp)
+  801d67:	e8 76 fe ff ff       	call   801be2 <fd_lookup>
+  801d6c:	89 c3                	mov    %eax,%ebx
+  801d6e:	83 c4 10             	add    $0x10,%esp
+  801d71:	85 c0                	test   %eax,%eax
+  801d73:	78 7f                	js     801df4 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801d75:	83 ec 0c             	sub    $0xc,%esp
+  801d78:	ff 75 0c             	push   0xc(%ebp)
+  801d7b:	e8 85 ff ff ff       	call   801d05 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801d80:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d83:	c1 e6 0c             	shl    $0xc,%esi
+  801d86:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801d8c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801d8f:	89 3c 24             	mov    %edi,(%esp)
+  801d92:	e8 e0 fd ff ff       	call   801b77 <fd2data>
+  801d97:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801d99:	89 34 24             	mov    %esi,(%esp)
+  801d9c:	e8 d6 fd ff ff       	call   801b77 <fd2data>
+  801da1:	83 c4 10             	add    $0x10,%esp
+  801da4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801da7:	89 d8                	mov    %ebx,%eax
+  801da9:	c1 e8 16             	shr    $0x16,%eax
+  801dac:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801db3:	a8 01                	test   $0x1,%al
+  801db5:	74 11                	je     801dc8 <dup+0x71>
+  801db7:	89 d8                	mov    %ebx,%eax
+  801db9:	c1 e8 0c             	shr    $0xc,%eax
+  801dbc:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801dc3:	f6 c2 01             	test   $0x1,%dl
+  801dc6:	75 36                	jne    801dfe <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801dc8:	89 f8                	mov    %edi,%eax
+  801dca:	c1 e8 0c             	shr    $0xc,%eax
+  801dcd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801dd4:	83 ec 0c             	sub    $0xc,%esp
+  801dd7:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ddc:	50                   	push   %eax
+  801ddd:	56                   	push   %esi
+  801dde:	6a 00                	push   $0x0
+  801de0:	57                   	push   %edi
+  801de1:	6a 00                	push   $0x0
+  801de3:	e8 73 f2 ff ff       	call   80105b <sys_page_map>
+  801de8:	89 c3                	mov    %eax,%ebx
+  801dea:	83 c4 20             	add    $0x20,%esp
+  801ded:	85 c0                	test   %eax,%eax
+  801def:	78 33                	js     801e24 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801df1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801df4:	89 d8                	mov    %ebx,%eax
+  801df6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801df9:	5b                   	pop    %ebx
+  801dfa:	5e                   	pop    %esi
+  801dfb:	5f                   	pop    %edi
+  801dfc:	5d                   	pop    %ebp
+  801dfd:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801dfe:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e05:	83 ec 0c             	sub    $0xc,%esp
+  801e08:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e0d:	50                   	push   %eax
+  801e0e:	ff 75 d4             	push   -0x2c(%ebp)
+  801e11:	6a 00                	push   $0x0
+  801e13:	53                   	push   %ebx
+  801e14:	6a 00                	push   $0x0
+  801e16:	e8 40 f2 ff ff       	call   80105b <sys_page_map>
+  801e1b:	89 c3                	mov    %eax,%ebx
+  801e1d:	83 c4 20             	add    $0x20,%esp
+  801e20:	85 c0                	test   %eax,%eax
+  801e22:	79 a4                	jns    801dc8 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801e24:	83 ec 08             	sub    $0x8,%esp
+  801e27:	56                   	push   %esi
+  801e28:	6a 00                	push   $0x0
+  801e2a:	e8 6e f2 ff ff       	call   80109d <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801e2f:	83 c4 08             	add    $0x8,%esp
+  801e32:	ff 75 d4             	push   -0x2c(%ebp)
+  801e35:	6a 00                	push   $0x0
+  801e37:	e8 61 f2 ff ff       	call   80109d <sys_page_unmap>
+	return r;
+  801e3c:	83 c4 10             	add    $0x10,%esp
+  801e3f:	eb b3                	jmp    801df4 <dup+0x9d>
+
+00801e41 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801e41:	55                   	push   %ebp
+  801e42:	89 e5                	mov    %esp,%ebp
+  801e44:	56                   	push   %esi
+  801e45:	53                   	push   %ebx
+  801e46:	83 ec 18             	sub    $0x18,%esp
+  801e49:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e4c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e4f:	50                   	push   %eax
+  801e50:	56                   	push   %esi
+  801e51:	e8 8c fd ff ff       	call   801be2 <fd_lookup>
+  801e56:	83 c4 10             	add    $0x10,%esp
+  801e59:	85 c0                	test   %eax,%eax
+  801e5b:	78 3c                	js     801e99 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e5d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801e60:	83 ec 08             	sub    $0x8,%esp
+  801e63:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e66:	50                   	push   %eax
+  801e67:	ff 33                	push   (%ebx)
+  801e69:	e8 c4 fd ff ff       	call   801c32 <dev_lookup>
+  801e6e:	83 c4 10             	add    $0x10,%esp
+  801e71:	85 c0                	test   %eax,%eax
+  801e73:	78 24                	js     801e99 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e75:	8b 43 08             	mov    0x8(%ebx),%eax
+  801e78:	83 e0 03             	and    $0x3,%eax
+  801e7b:	83 f8 01             	cmp    $0x1,%eax
+  801e7e:	74 20                	je     801ea0 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801e80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e83:	8b 40 08             	mov    0x8(%eax),%eax
+  801e86:	85 c0                	test   %eax,%eax
+  801e88:	74 37                	je     801ec1 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801e8a:	83 ec 04             	sub    $0x4,%esp
+  801e8d:	ff 75 10             	push   0x10(%ebp)
+  801e90:	ff 75 0c             	push   0xc(%ebp)
+  801e93:	53                   	push   %ebx
+  801e94:	ff d0                	call   *%eax
+  801e96:	83 c4 10             	add    $0x10,%esp
+}
+  801e99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e9c:	5b                   	pop    %ebx
+  801e9d:	5e                   	pop    %esi
+  801e9e:	5d                   	pop    %ebp
+  801e9f:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ea0:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  801ea5:	8b 40 48             	mov    0x48(%eax),%eax
+  801ea8:	83 ec 04             	sub    $0x4,%esp
+  801eab:	56                   	push   %esi
+  801eac:	50                   	push   %eax
+  801ead:	68 a9 5c 80 00       	push   $0x805ca9
+  801eb2:	e8 87 e6 ff ff       	call   80053e <cprintf>
+		return -E_INVAL;
+  801eb7:	83 c4 10             	add    $0x10,%esp
+  801eba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ebf:	eb d8                	jmp    801e99 <read+0x58>
+		return -E_NOT_SUPP;
+  801ec1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ec6:	eb d1                	jmp    801e99 <read+0x58>
+
+00801ec8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801ec8:	55                   	push   %ebp
+  801ec9:	89 e5                	mov    %esp,%ebp
+  801ecb:	57                   	push   %edi
+  801ecc:	56                   	push   %esi
+  801ecd:	53                   	push   %ebx
+  801ece:	83 ec 0c             	sub    $0xc,%esp
+  801ed1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ed4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801ed7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801edc:	eb 02                	jmp    801ee0 <readn+0x18>
+  801ede:	01 c3                	add    %eax,%ebx
+  801ee0:	39 f3                	cmp    %esi,%ebx
+  801ee2:	73 21                	jae    801f05 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801ee4:	83 ec 04             	sub    $0x4,%esp
+  801ee7:	89 f0                	mov    %esi,%eax
+  801ee9:	29 d8                	sub    %ebx,%eax
+  801eeb:	50                   	push   %eax
+  801eec:	89 d8                	mov    %ebx,%eax
+  801eee:	03 45 0c             	add    0xc(%ebp),%eax
+  801ef1:	50                   	push   %eax
+  801ef2:	57                   	push   %edi
+  801ef3:	e8 49 ff ff ff       	call   801e41 <read>
+		if (m < 0)
+  801ef8:	83 c4 10             	add    $0x10,%esp
+  801efb:	85 c0                	test   %eax,%eax
+  801efd:	78 04                	js     801f03 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801eff:	75 dd                	jne    801ede <readn+0x16>
+  801f01:	eb 02                	jmp    801f05 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f03:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801f05:	89 d8                	mov    %ebx,%eax
+  801f07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f0a:	5b                   	pop    %ebx
+  801f0b:	5e                   	pop    %esi
+  801f0c:	5f                   	pop    %edi
+  801f0d:	5d                   	pop    %ebp
+  801f0e:	c3                   	ret
+
+00801f0f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801f0f:	55                   	push   %ebp
+  801f10:	89 e5                	mov    %esp,%ebp
+  801f12:	56                   	push   %esi
+  801f13:	53                   	push   %ebx
+  801f14:	83 ec 18             	sub    $0x18,%esp
+  801f17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f1a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f1d:	50                   	push   %eax
+  801f1e:	53                   	push   %ebx
+  801f1f:	e8 be fc ff ff       	call   801be2 <fd_lookup>
+  801f24:	83 c4 10             	add    $0x10,%esp
+  801f27:	85 c0                	test   %eax,%eax
+  801f29:	78 37                	js     801f62 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f2b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f2e:	83 ec 08             	sub    $0x8,%esp
+  801f31:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f34:	50                   	push   %eax
+  801f35:	ff 36                	push   (%esi)
+  801f37:	e8 f6 fc ff ff       	call   801c32 <dev_lookup>
+  801f3c:	83 c4 10             	add    $0x10,%esp
+  801f3f:	85 c0                	test   %eax,%eax
+  801f41:	78 1f                	js     801f62 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f43:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f47:	74 20                	je     801f69 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801f49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f4c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f4f:	85 c0                	test   %eax,%eax
+  801f51:	74 37                	je     801f8a <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801f53:	83 ec 04             	sub    $0x4,%esp
+  801f56:	ff 75 10             	push   0x10(%ebp)
+  801f59:	ff 75 0c             	push   0xc(%ebp)
+  801f5c:	56                   	push   %esi
+  801f5d:	ff d0                	call   *%eax
+  801f5f:	83 c4 10             	add    $0x10,%esp
+}
+  801f62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f65:	5b                   	pop    %ebx
+  801f66:	5e                   	pop    %esi
+  801f67:	5d                   	pop    %ebp
+  801f68:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f69:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  801f6e:	8b 40 48             	mov    0x48(%eax),%eax
+  801f71:	83 ec 04             	sub    $0x4,%esp
+  801f74:	53                   	push   %ebx
+  801f75:	50                   	push   %eax
+  801f76:	68 c5 5c 80 00       	push   $0x805cc5
+  801f7b:	e8 be e5 ff ff       	call   80053e <cprintf>
+		return -E_INVAL;
+  801f80:	83 c4 10             	add    $0x10,%esp
+  801f83:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f88:	eb d8                	jmp    801f62 <write+0x53>
+		return -E_NOT_SUPP;
+  801f8a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f8f:	eb d1                	jmp    801f62 <write+0x53>
+
+00801f91 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801f91:	55                   	push   %ebp
+  801f92:	89 e5                	mov    %esp,%ebp
+  801f94:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f97:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f9a:	50                   	push   %eax
+  801f9b:	ff 75 08             	push   0x8(%ebp)
+  801f9e:	e8 3f fc ff ff       	call   801be2 <fd_lookup>
+  801fa3:	83 c4 10             	add    $0x10,%esp
+  801fa6:	85 c0                	test   %eax,%eax
+  801fa8:	78 0e                	js     801fb8 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801faa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fb0:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fb8:	c9                   	leave
+  801fb9:	c3                   	ret
+
+00801fba <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801fba:	55                   	push   %ebp
+  801fbb:	89 e5                	mov    %esp,%ebp
+  801fbd:	56                   	push   %esi
+  801fbe:	53                   	push   %ebx
+  801fbf:	83 ec 18             	sub    $0x18,%esp
+  801fc2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801fc5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fc8:	50                   	push   %eax
+  801fc9:	53                   	push   %ebx
+  801fca:	e8 13 fc ff ff       	call   801be2 <fd_lookup>
+  801fcf:	83 c4 10             	add    $0x10,%esp
+  801fd2:	85 c0                	test   %eax,%eax
+  801fd4:	78 34                	js     80200a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801fd6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fd9:	83 ec 08             	sub    $0x8,%esp
+  801fdc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fdf:	50                   	push   %eax
+  801fe0:	ff 36                	push   (%esi)
+  801fe2:	e8 4b fc ff ff       	call   801c32 <dev_lookup>
+  801fe7:	83 c4 10             	add    $0x10,%esp
+  801fea:	85 c0                	test   %eax,%eax
+  801fec:	78 1c                	js     80200a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fee:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ff2:	74 1d                	je     802011 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801ff4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ff7:	8b 40 18             	mov    0x18(%eax),%eax
+  801ffa:	85 c0                	test   %eax,%eax
+  801ffc:	74 34                	je     802032 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801ffe:	83 ec 08             	sub    $0x8,%esp
+  802001:	ff 75 0c             	push   0xc(%ebp)
+  802004:	56                   	push   %esi
+  802005:	ff d0                	call   *%eax
+  802007:	83 c4 10             	add    $0x10,%esp
+}
+  80200a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80200d:	5b                   	pop    %ebx
+  80200e:	5e                   	pop    %esi
+  80200f:	5d                   	pop    %ebp
+  802010:	c3                   	ret
+			thisenv->env_id, fdnum);
+  802011:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  802016:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802019:	83 ec 04             	sub    $0x4,%esp
+  80201c:	53                   	push   %ebx
+  80201d:	50                   	push   %eax
+  80201e:	68 88 5c 80 00       	push   $0x805c88
+  802023:	e8 16 e5 ff ff       	call   80053e <cprintf>
+		return -E_INVAL;
+  802028:	83 c4 10             	add    $0x10,%esp
+  80202b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802030:	eb d8                	jmp    80200a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802032:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802037:	eb d1                	jmp    80200a <ftruncate+0x50>
+
+00802039 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802039:	55                   	push   %ebp
+  80203a:	89 e5                	mov    %esp,%ebp
+  80203c:	56                   	push   %esi
+  80203d:	53                   	push   %ebx
+  80203e:	83 ec 18             	sub    $0x18,%esp
+  802041:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802044:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802047:	50                   	push   %eax
+  802048:	ff 75 08             	push   0x8(%ebp)
+  80204b:	e8 92 fb ff ff       	call   801be2 <fd_lookup>
+  802050:	83 c4 10             	add    $0x10,%esp
+  802053:	85 c0                	test   %eax,%eax
+  802055:	78 49                	js     8020a0 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802057:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80205a:	83 ec 08             	sub    $0x8,%esp
+  80205d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802060:	50                   	push   %eax
+  802061:	ff 36                	push   (%esi)
+  802063:	e8 ca fb ff ff       	call   801c32 <dev_lookup>
+  802068:	83 c4 10             	add    $0x10,%esp
+  80206b:	85 c0                	test   %eax,%eax
+  80206d:	78 31                	js     8020a0 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80206f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802072:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802076:	74 2f                	je     8020a7 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802078:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80207b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802082:	00 00 00 
+	stat->st_isdir = 0;
+  802085:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80208c:	00 00 00 
+	stat->st_dev = dev;
+  80208f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802095:	83 ec 08             	sub    $0x8,%esp
+  802098:	53                   	push   %ebx
+  802099:	56                   	push   %esi
+  80209a:	ff 50 14             	call   *0x14(%eax)
+  80209d:	83 c4 10             	add    $0x10,%esp
+}
+  8020a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020a3:	5b                   	pop    %ebx
+  8020a4:	5e                   	pop    %esi
+  8020a5:	5d                   	pop    %ebp
+  8020a6:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020a7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020ac:	eb f2                	jmp    8020a0 <fstat+0x67>
+
+008020ae <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8020ae:	55                   	push   %ebp
+  8020af:	89 e5                	mov    %esp,%ebp
+  8020b1:	56                   	push   %esi
+  8020b2:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8020b3:	83 ec 08             	sub    $0x8,%esp
+  8020b6:	6a 00                	push   $0x0
+  8020b8:	ff 75 08             	push   0x8(%ebp)
+  8020bb:	e8 bc 02 00 00       	call   80237c <open>
+  8020c0:	89 c3                	mov    %eax,%ebx
+  8020c2:	83 c4 10             	add    $0x10,%esp
+  8020c5:	85 c0                	test   %eax,%eax
+  8020c7:	78 1b                	js     8020e4 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8020c9:	83 ec 08             	sub    $0x8,%esp
+  8020cc:	ff 75 0c             	push   0xc(%ebp)
+  8020cf:	50                   	push   %eax
+  8020d0:	e8 64 ff ff ff       	call   802039 <fstat>
+  8020d5:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8020d7:	89 1c 24             	mov    %ebx,(%esp)
+  8020da:	e8 26 fc ff ff       	call   801d05 <close>
+	return r;
+  8020df:	83 c4 10             	add    $0x10,%esp
+  8020e2:	89 f3                	mov    %esi,%ebx
+}
+  8020e4:	89 d8                	mov    %ebx,%eax
+  8020e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020e9:	5b                   	pop    %ebx
+  8020ea:	5e                   	pop    %esi
+  8020eb:	5d                   	pop    %ebp
+  8020ec:	c3                   	ret
+
+008020ed <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  8020ed:	55                   	push   %ebp
+  8020ee:	89 e5                	mov    %esp,%ebp
+  8020f0:	57                   	push   %edi
+  8020f1:	56                   	push   %esi
+  8020f2:	53                   	push   %ebx
+  8020f3:	83 ec 0c             	sub    $0xc,%esp
+  8020f6:	89 c7                	mov    %eax,%edi
+  8020f8:	89 d3                	mov    %edx,%ebx
+  8020fa:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8020fc:	83 3d 00 80 81 00 00 	cmpl   $0x0,0x818000
+  802103:	74 2d                	je     802132 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802105:	6a 07                	push   $0x7
+  802107:	68 00 00 83 00       	push   $0x830000
+  80210c:	57                   	push   %edi
+  80210d:	ff 35 00 80 81 00    	push   0x818000
+  802113:	e8 ba 31 00 00       	call   8052d2 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  802118:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80211f:	6a 00                	push   $0x0
+  802121:	56                   	push   %esi
+  802122:	53                   	push   %ebx
+  802123:	6a 00                	push   $0x0
+  802125:	e8 5a 30 00 00       	call   805184 <ipc_recv_pages>
+}
+  80212a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80212d:	5b                   	pop    %ebx
+  80212e:	5e                   	pop    %esi
+  80212f:	5f                   	pop    %edi
+  802130:	5d                   	pop    %ebp
+  802131:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802132:	83 ec 0c             	sub    $0xc,%esp
+  802135:	6a 01                	push   $0x1
+  802137:	e8 8b 32 00 00       	call   8053c7 <ipc_find_env>
+  80213c:	a3 00 80 81 00       	mov    %eax,0x818000
+  802141:	83 c4 10             	add    $0x10,%esp
+  802144:	eb bf                	jmp    802105 <fsipc_pages+0x18>
+
+00802146 <fsipc>:
+{
+  802146:	55                   	push   %ebp
+  802147:	89 e5                	mov    %esp,%ebp
+  802149:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  80214c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802151:	e8 97 ff ff ff       	call   8020ed <fsipc_pages>
+}
+  802156:	c9                   	leave
+  802157:	c3                   	ret
+
+00802158 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802158:	55                   	push   %ebp
+  802159:	89 e5                	mov    %esp,%ebp
+  80215b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80215e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802161:	8b 40 0c             	mov    0xc(%eax),%eax
+  802164:	a3 00 00 83 00       	mov    %eax,0x830000
+	fsipcbuf.set_size.req_size = newsize;
+  802169:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80216c:	a3 04 00 83 00       	mov    %eax,0x830004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802171:	ba 00 00 00 00       	mov    $0x0,%edx
+  802176:	b8 02 00 00 00       	mov    $0x2,%eax
+  80217b:	e8 c6 ff ff ff       	call   802146 <fsipc>
+}
+  802180:	c9                   	leave
+  802181:	c3                   	ret
+
+00802182 <devfile_flush>:
+{
+  802182:	55                   	push   %ebp
+  802183:	89 e5                	mov    %esp,%ebp
+  802185:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802188:	8b 45 08             	mov    0x8(%ebp),%eax
+  80218b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80218e:	a3 00 00 83 00       	mov    %eax,0x830000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802193:	ba 00 00 00 00       	mov    $0x0,%edx
+  802198:	b8 06 00 00 00       	mov    $0x6,%eax
+  80219d:	e8 a4 ff ff ff       	call   802146 <fsipc>
+}
+  8021a2:	c9                   	leave
+  8021a3:	c3                   	ret
+
+008021a4 <devfile_stat>:
+{
+  8021a4:	55                   	push   %ebp
+  8021a5:	89 e5                	mov    %esp,%ebp
+  8021a7:	53                   	push   %ebx
+  8021a8:	83 ec 04             	sub    $0x4,%esp
+  8021ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8021ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021b4:	a3 00 00 83 00       	mov    %eax,0x830000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8021b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021be:	b8 05 00 00 00       	mov    $0x5,%eax
+  8021c3:	e8 7e ff ff ff       	call   802146 <fsipc>
+  8021c8:	85 c0                	test   %eax,%eax
+  8021ca:	78 2c                	js     8021f8 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021cc:	83 ec 08             	sub    $0x8,%esp
+  8021cf:	68 00 00 83 00       	push   $0x830000
+  8021d4:	53                   	push   %ebx
+  8021d5:	e8 4b e9 ff ff       	call   800b25 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8021da:	a1 80 00 83 00       	mov    0x830080,%eax
+  8021df:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021e5:	a1 84 00 83 00       	mov    0x830084,%eax
+  8021ea:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8021f0:	83 c4 10             	add    $0x10,%esp
+  8021f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021fb:	c9                   	leave
+  8021fc:	c3                   	ret
+
+008021fd <devfile_write>:
+{
+  8021fd:	55                   	push   %ebp
+  8021fe:	89 e5                	mov    %esp,%ebp
+  802200:	83 ec 0c             	sub    $0xc,%esp
+  802203:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802206:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80220b:	39 d0                	cmp    %edx,%eax
+  80220d:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802210:	8b 55 08             	mov    0x8(%ebp),%edx
+  802213:	8b 52 0c             	mov    0xc(%edx),%edx
+  802216:	89 15 00 00 83 00    	mov    %edx,0x830000
+	fsipcbuf.write.req_n = n;
+  80221c:	a3 04 00 83 00       	mov    %eax,0x830004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  802221:	50                   	push   %eax
+  802222:	ff 75 0c             	push   0xc(%ebp)
+  802225:	68 08 00 83 00       	push   $0x830008
+  80222a:	e8 7c ea ff ff       	call   800cab <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  80222f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802234:	b8 04 00 00 00       	mov    $0x4,%eax
+  802239:	e8 08 ff ff ff       	call   802146 <fsipc>
+}
+  80223e:	c9                   	leave
+  80223f:	c3                   	ret
+
+00802240 <devfile_read>:
+{
+  802240:	55                   	push   %ebp
+  802241:	89 e5                	mov    %esp,%ebp
+  802243:	57                   	push   %edi
+  802244:	56                   	push   %esi
+  802245:	53                   	push   %ebx
+  802246:	83 ec 1c             	sub    $0x1c,%esp
+  802249:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80224c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  80224f:	89 fe                	mov    %edi,%esi
+  802251:	c1 ee 0c             	shr    $0xc,%esi
+  802254:	b8 20 00 00 00       	mov    $0x20,%eax
+  802259:	39 c6                	cmp    %eax,%esi
+  80225b:	0f 47 f0             	cmova  %eax,%esi
+  80225e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802261:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802266:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802269:	eb 14                	jmp    80227f <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  80226b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  802272:	05 00 10 00 00       	add    $0x1000,%eax
+  802277:	f6 c6 06             	test   $0x6,%dh
+  80227a:	75 42                	jne    8022be <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  80227c:	83 c1 01             	add    $0x1,%ecx
+  80227f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802282:	39 f1                	cmp    %esi,%ecx
+  802284:	0f 84 95 00 00 00    	je     80231f <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  80228a:	89 c2                	mov    %eax,%edx
+  80228c:	c1 ea 16             	shr    $0x16,%edx
+  80228f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802296:	f6 c2 01             	test   $0x1,%dl
+  802299:	74 23                	je     8022be <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  80229b:	89 c2                	mov    %eax,%edx
+  80229d:	c1 ea 0c             	shr    $0xc,%edx
+  8022a0:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8022a7:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  8022ad:	74 0f                	je     8022be <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  8022af:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8022b6:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  8022bc:	75 ad                	jne    80226b <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  8022be:	85 c9                	test   %ecx,%ecx
+  8022c0:	74 11                	je     8022d3 <devfile_read+0x93>
+  8022c2:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  8022c9:	75 08                	jne    8022d3 <devfile_read+0x93>
+  8022cb:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  8022d1:	74 50                	je     802323 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022d3:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8022d6:	a3 00 00 83 00       	mov    %eax,0x830000
+	fsipcbuf.read.req_n = n;
+  8022db:	89 3d 04 00 83 00    	mov    %edi,0x830004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8022e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022eb:	e8 56 fe ff ff       	call   802146 <fsipc>
+  8022f0:	89 c6                	mov    %eax,%esi
+  8022f2:	85 c0                	test   %eax,%eax
+  8022f4:	78 1f                	js     802315 <devfile_read+0xd5>
+	assert(r <= n);
+  8022f6:	39 c7                	cmp    %eax,%edi
+  8022f8:	72 50                	jb     80234a <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  8022fa:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8022ff:	7f 62                	jg     802363 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  802301:	83 ec 04             	sub    $0x4,%esp
+  802304:	50                   	push   %eax
+  802305:	68 00 00 83 00       	push   $0x830000
+  80230a:	ff 75 0c             	push   0xc(%ebp)
+  80230d:	e8 99 e9 ff ff       	call   800cab <memmove>
+	return r;
+  802312:	83 c4 10             	add    $0x10,%esp
+}
+  802315:	89 f0                	mov    %esi,%eax
+  802317:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80231a:	5b                   	pop    %ebx
+  80231b:	5e                   	pop    %esi
+  80231c:	5f                   	pop    %edi
+  80231d:	5d                   	pop    %ebp
+  80231e:	c3                   	ret
+  80231f:	89 f1                	mov    %esi,%ecx
+  802321:	eb 9b                	jmp    8022be <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  802323:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802326:	a3 00 00 83 00       	mov    %eax,0x830000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  80232b:	89 c8                	mov    %ecx,%eax
+  80232d:	c1 e0 0c             	shl    $0xc,%eax
+  802330:	a3 04 00 83 00       	mov    %eax,0x830004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  802335:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802338:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80233d:	e8 ab fd ff ff       	call   8020ed <fsipc_pages>
+  802342:	89 c6                	mov    %eax,%esi
+  802344:	85 c0                	test   %eax,%eax
+  802346:	78 8b                	js     8022d3 <devfile_read+0x93>
+  802348:	eb cb                	jmp    802315 <devfile_read+0xd5>
+	assert(r <= n);
+  80234a:	68 f4 5c 80 00       	push   $0x805cf4
+  80234f:	68 d4 56 80 00       	push   $0x8056d4
+  802354:	68 a0 00 00 00       	push   $0xa0
+  802359:	68 fb 5c 80 00       	push   $0x805cfb
+  80235e:	e8 00 e1 ff ff       	call   800463 <_panic>
+	assert(r <= PGSIZE);
+  802363:	68 06 5d 80 00       	push   $0x805d06
+  802368:	68 d4 56 80 00       	push   $0x8056d4
+  80236d:	68 a1 00 00 00       	push   $0xa1
+  802372:	68 fb 5c 80 00       	push   $0x805cfb
+  802377:	e8 e7 e0 ff ff       	call   800463 <_panic>
+
+0080237c <open>:
+{
+  80237c:	55                   	push   %ebp
+  80237d:	89 e5                	mov    %esp,%ebp
+  80237f:	56                   	push   %esi
+  802380:	53                   	push   %ebx
+  802381:	83 ec 1c             	sub    $0x1c,%esp
+  802384:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802387:	56                   	push   %esi
+  802388:	e8 5d e7 ff ff       	call   800aea <strlen>
+  80238d:	83 c4 10             	add    $0x10,%esp
+  802390:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802395:	7f 6c                	jg     802403 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802397:	83 ec 0c             	sub    $0xc,%esp
+  80239a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80239d:	50                   	push   %eax
+  80239e:	e8 eb f7 ff ff       	call   801b8e <fd_alloc>
+  8023a3:	89 c3                	mov    %eax,%ebx
+  8023a5:	83 c4 10             	add    $0x10,%esp
+  8023a8:	85 c0                	test   %eax,%eax
+  8023aa:	78 3c                	js     8023e8 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8023ac:	83 ec 08             	sub    $0x8,%esp
+  8023af:	56                   	push   %esi
+  8023b0:	68 00 00 83 00       	push   $0x830000
+  8023b5:	e8 6b e7 ff ff       	call   800b25 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8023ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023bd:	a3 00 04 83 00       	mov    %eax,0x830400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8023c2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023c5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023ca:	e8 77 fd ff ff       	call   802146 <fsipc>
+  8023cf:	89 c3                	mov    %eax,%ebx
+  8023d1:	83 c4 10             	add    $0x10,%esp
+  8023d4:	85 c0                	test   %eax,%eax
+  8023d6:	78 19                	js     8023f1 <open+0x75>
+	return fd2num(fd);
+  8023d8:	83 ec 0c             	sub    $0xc,%esp
+  8023db:	ff 75 f4             	push   -0xc(%ebp)
+  8023de:	e8 84 f7 ff ff       	call   801b67 <fd2num>
+  8023e3:	89 c3                	mov    %eax,%ebx
+  8023e5:	83 c4 10             	add    $0x10,%esp
+}
+  8023e8:	89 d8                	mov    %ebx,%eax
+  8023ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023ed:	5b                   	pop    %ebx
+  8023ee:	5e                   	pop    %esi
+  8023ef:	5d                   	pop    %ebp
+  8023f0:	c3                   	ret
+		fd_close(fd, 0);
+  8023f1:	83 ec 08             	sub    $0x8,%esp
+  8023f4:	6a 00                	push   $0x0
+  8023f6:	ff 75 f4             	push   -0xc(%ebp)
+  8023f9:	e8 80 f8 ff ff       	call   801c7e <fd_close>
+		return r;
+  8023fe:	83 c4 10             	add    $0x10,%esp
+  802401:	eb e5                	jmp    8023e8 <open+0x6c>
+		return -E_BAD_PATH;
+  802403:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802408:	eb de                	jmp    8023e8 <open+0x6c>
+
+0080240a <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80240a:	55                   	push   %ebp
+  80240b:	89 e5                	mov    %esp,%ebp
+  80240d:	53                   	push   %ebx
+  80240e:	83 ec 10             	sub    $0x10,%esp
+  802411:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802414:	53                   	push   %ebx
+  802415:	e8 d0 e6 ff ff       	call   800aea <strlen>
+  80241a:	83 c4 10             	add    $0x10,%esp
+  80241d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802422:	7f 25                	jg     802449 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802424:	83 ec 08             	sub    $0x8,%esp
+  802427:	53                   	push   %ebx
+  802428:	68 00 00 83 00       	push   $0x830000
+  80242d:	e8 f3 e6 ff ff       	call   800b25 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802432:	ba 00 00 00 00       	mov    $0x0,%edx
+  802437:	b8 07 00 00 00       	mov    $0x7,%eax
+  80243c:	e8 05 fd ff ff       	call   802146 <fsipc>
+  802441:	83 c4 10             	add    $0x10,%esp
+}
+  802444:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802447:	c9                   	leave
+  802448:	c3                   	ret
+		return -E_BAD_PATH;
+  802449:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80244e:	eb f4                	jmp    802444 <remove+0x3a>
+
+00802450 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802450:	55                   	push   %ebp
+  802451:	89 e5                	mov    %esp,%ebp
+  802453:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802456:	ba 00 00 00 00       	mov    $0x0,%edx
+  80245b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802460:	e8 e1 fc ff ff       	call   802146 <fsipc>
+}
+  802465:	c9                   	leave
+  802466:	c3                   	ret
+
+00802467 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  802467:	55                   	push   %ebp
+  802468:	89 e5                	mov    %esp,%ebp
+  80246a:	53                   	push   %ebx
+  80246b:	83 ec 04             	sub    $0x4,%esp
+  80246e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  802471:	ba 00 00 00 00       	mov    $0x0,%edx
+  802476:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80247b:	e8 c6 fc ff ff       	call   802146 <fsipc>
+  802480:	85 c0                	test   %eax,%eax
+  802482:	78 3c                	js     8024c0 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  802484:	a1 00 00 83 00       	mov    0x830000,%eax
+  802489:	89 03                	mov    %eax,(%ebx)
+  80248b:	a1 04 00 83 00       	mov    0x830004,%eax
+  802490:	89 43 04             	mov    %eax,0x4(%ebx)
+  802493:	a1 08 00 83 00       	mov    0x830008,%eax
+  802498:	89 43 08             	mov    %eax,0x8(%ebx)
+  80249b:	a1 0c 00 83 00       	mov    0x83000c,%eax
+  8024a0:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8024a3:	a1 10 00 83 00       	mov    0x830010,%eax
+  8024a8:	89 43 10             	mov    %eax,0x10(%ebx)
+  8024ab:	a1 14 00 83 00       	mov    0x830014,%eax
+  8024b0:	89 43 14             	mov    %eax,0x14(%ebx)
+  8024b3:	a1 18 00 83 00       	mov    0x830018,%eax
+  8024b8:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  8024bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024c3:	c9                   	leave
+  8024c4:	c3                   	ret
+
+008024c5 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  8024c5:	55                   	push   %ebp
+  8024c6:	89 e5                	mov    %esp,%ebp
+  8024c8:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  8024cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ce:	a3 00 00 83 00       	mov    %eax,0x830000
+	return fsipc(FSREQ_BCSET, NULL);
+  8024d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8024dd:	e8 64 fc ff ff       	call   802146 <fsipc>
+}
+  8024e2:	c9                   	leave
+  8024e3:	c3                   	ret
+
+008024e4 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8024e4:	55                   	push   %ebp
+  8024e5:	89 e5                	mov    %esp,%ebp
+  8024e7:	56                   	push   %esi
+  8024e8:	53                   	push   %ebx
+  8024e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8024ec:	83 ec 0c             	sub    $0xc,%esp
+  8024ef:	ff 75 08             	push   0x8(%ebp)
+  8024f2:	e8 80 f6 ff ff       	call   801b77 <fd2data>
+  8024f7:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8024f9:	83 c4 08             	add    $0x8,%esp
+  8024fc:	68 12 5d 80 00       	push   $0x805d12
+  802501:	53                   	push   %ebx
+  802502:	e8 1e e6 ff ff       	call   800b25 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802507:	8b 46 04             	mov    0x4(%esi),%eax
+  80250a:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  802510:	2b 0e                	sub    (%esi),%ecx
+  802512:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802517:	89 c8                	mov    %ecx,%eax
+  802519:	f7 e2                	mul    %edx
+  80251b:	c1 ea 0c             	shr    $0xc,%edx
+  80251e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802524:	29 d1                	sub    %edx,%ecx
+  802526:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  80252c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802533:	00 00 00 
+	stat->st_dev = &devpipe;
+  802536:	c7 83 88 00 00 00 40 	movl   $0x817040,0x88(%ebx)
+  80253d:	70 81 00 
+	return 0;
+}
+  802540:	b8 00 00 00 00       	mov    $0x0,%eax
+  802545:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802548:	5b                   	pop    %ebx
+  802549:	5e                   	pop    %esi
+  80254a:	5d                   	pop    %ebp
+  80254b:	c3                   	ret
+
+0080254c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80254c:	55                   	push   %ebp
+  80254d:	89 e5                	mov    %esp,%ebp
+  80254f:	53                   	push   %ebx
+  802550:	83 ec 0c             	sub    $0xc,%esp
+  802553:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802556:	53                   	push   %ebx
+  802557:	6a 00                	push   $0x0
+  802559:	e8 3f eb ff ff       	call   80109d <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80255e:	89 1c 24             	mov    %ebx,(%esp)
+  802561:	e8 11 f6 ff ff       	call   801b77 <fd2data>
+  802566:	83 c4 08             	add    $0x8,%esp
+  802569:	50                   	push   %eax
+  80256a:	6a 00                	push   $0x0
+  80256c:	e8 2c eb ff ff       	call   80109d <sys_page_unmap>
+}
+  802571:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802574:	c9                   	leave
+  802575:	c3                   	ret
+
+00802576 <_pipeisclosed>:
+{
+  802576:	55                   	push   %ebp
+  802577:	89 e5                	mov    %esp,%ebp
+  802579:	57                   	push   %edi
+  80257a:	56                   	push   %esi
+  80257b:	53                   	push   %ebx
+  80257c:	83 ec 1c             	sub    $0x1c,%esp
+  80257f:	89 c7                	mov    %eax,%edi
+  802581:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802583:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  802588:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80258b:	83 ec 0c             	sub    $0xc,%esp
+  80258e:	57                   	push   %edi
+  80258f:	e8 72 2e 00 00       	call   805406 <pageref>
+  802594:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802597:	89 34 24             	mov    %esi,(%esp)
+  80259a:	e8 67 2e 00 00       	call   805406 <pageref>
+		nn = thisenv->env_runs;
+  80259f:	8b 15 24 f9 82 00    	mov    0x82f924,%edx
+  8025a5:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8025a8:	83 c4 10             	add    $0x10,%esp
+  8025ab:	39 cb                	cmp    %ecx,%ebx
+  8025ad:	74 1b                	je     8025ca <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8025af:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8025b2:	75 cf                	jne    802583 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8025b4:	8b 42 58             	mov    0x58(%edx),%eax
+  8025b7:	6a 01                	push   $0x1
+  8025b9:	50                   	push   %eax
+  8025ba:	53                   	push   %ebx
+  8025bb:	68 19 5d 80 00       	push   $0x805d19
+  8025c0:	e8 79 df ff ff       	call   80053e <cprintf>
+  8025c5:	83 c4 10             	add    $0x10,%esp
+  8025c8:	eb b9                	jmp    802583 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8025ca:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8025cd:	0f 94 c0             	sete   %al
+  8025d0:	0f b6 c0             	movzbl %al,%eax
+}
+  8025d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025d6:	5b                   	pop    %ebx
+  8025d7:	5e                   	pop    %esi
+  8025d8:	5f                   	pop    %edi
+  8025d9:	5d                   	pop    %ebp
+  8025da:	c3                   	ret
+
+008025db <devpipe_read>:
+{
+  8025db:	55                   	push   %ebp
+  8025dc:	89 e5                	mov    %esp,%ebp
+  8025de:	57                   	push   %edi
+  8025df:	56                   	push   %esi
+  8025e0:	53                   	push   %ebx
+  8025e1:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8025e4:	ff 75 08             	push   0x8(%ebp)
+  8025e7:	e8 8b f5 ff ff       	call   801b77 <fd2data>
+  8025ec:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8025ee:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8025f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8025f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8025f7:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8025fa:	8b 0b                	mov    (%ebx),%ecx
+  8025fc:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  802602:	29 ce                	sub    %ecx,%esi
+  802604:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802609:	f7 e6                	mul    %esi
+  80260b:	c1 ea 0c             	shr    $0xc,%edx
+  80260e:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  802614:	29 c6                	sub    %eax,%esi
+  802616:	89 f2                	mov    %esi,%edx
+  802618:	75 43                	jne    80265d <devpipe_read+0x82>
+		ref = pageref(p);
+  80261a:	83 ec 0c             	sub    $0xc,%esp
+  80261d:	53                   	push   %ebx
+  80261e:	e8 e3 2d 00 00       	call   805406 <pageref>
+  802623:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  802625:	89 da                	mov    %ebx,%edx
+  802627:	8b 45 08             	mov    0x8(%ebp),%eax
+  80262a:	e8 47 ff ff ff       	call   802576 <_pipeisclosed>
+  80262f:	83 c4 10             	add    $0x10,%esp
+  802632:	85 c0                	test   %eax,%eax
+  802634:	0f 85 c1 00 00 00    	jne    8026fb <devpipe_read+0x120>
+	*sleeping = 1;
+  80263a:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  802641:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802646:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  802649:	75 ac                	jne    8025f7 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  80264b:	83 ec 04             	sub    $0x4,%esp
+  80264e:	56                   	push   %esi
+  80264f:	57                   	push   %edi
+  802650:	ff 75 e4             	push   -0x1c(%ebp)
+  802653:	e8 99 ee ff ff       	call   8014f1 <sys_futex_wait>
+  802658:	83 c4 10             	add    $0x10,%esp
+  80265b:	eb 9a                	jmp    8025f7 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  80265d:	39 75 10             	cmp    %esi,0x10(%ebp)
+  802660:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  802664:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802666:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80266b:	f7 e1                	mul    %ecx
+  80266d:	c1 ea 0b             	shr    $0xb,%edx
+  802670:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802676:	29 c1                	sub    %eax,%ecx
+  802678:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  80267a:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80267f:	29 cf                	sub    %ecx,%edi
+  802681:	39 f7                	cmp    %esi,%edi
+  802683:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  802686:	8d 43 10             	lea    0x10(%ebx),%eax
+  802689:	83 ec 04             	sub    $0x4,%esp
+  80268c:	57                   	push   %edi
+  80268d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802690:	01 c2                	add    %eax,%edx
+  802692:	52                   	push   %edx
+  802693:	ff 75 0c             	push   0xc(%ebp)
+  802696:	e8 10 e6 ff ff       	call   800cab <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  80269b:	83 c4 0c             	add    $0xc,%esp
+  80269e:	89 f1                	mov    %esi,%ecx
+  8026a0:	29 f9                	sub    %edi,%ecx
+  8026a2:	51                   	push   %ecx
+  8026a3:	ff 75 e4             	push   -0x1c(%ebp)
+  8026a6:	89 f8                	mov    %edi,%eax
+  8026a8:	03 45 0c             	add    0xc(%ebp),%eax
+  8026ab:	50                   	push   %eax
+  8026ac:	e8 fa e5 ff ff       	call   800cab <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  8026b1:	89 f1                	mov    %esi,%ecx
+  8026b3:	03 0b                	add    (%ebx),%ecx
+  8026b5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8026ba:	f7 e1                	mul    %ecx
+  8026bc:	c1 ea 0c             	shr    $0xc,%edx
+  8026bf:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8026c5:	29 d1                	sub    %edx,%ecx
+  8026c7:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  8026c9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8026ce:	83 c4 10             	add    $0x10,%esp
+  8026d1:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  8026d5:	75 0a                	jne    8026e1 <devpipe_read+0x106>
+	return n;
+  8026d7:	89 f0                	mov    %esi,%eax
+}
+  8026d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026dc:	5b                   	pop    %ebx
+  8026dd:	5e                   	pop    %esi
+  8026de:	5f                   	pop    %edi
+  8026df:	5d                   	pop    %ebp
+  8026e0:	c3                   	ret
+		*sleeping = 0;
+  8026e1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8026e8:	83 ec 08             	sub    $0x8,%esp
+  8026eb:	68 00 04 00 00       	push   $0x400
+  8026f0:	53                   	push   %ebx
+  8026f1:	e8 4b ee ff ff       	call   801541 <sys_futex_wake>
+  8026f6:	83 c4 10             	add    $0x10,%esp
+  8026f9:	eb dc                	jmp    8026d7 <devpipe_read+0xfc>
+			return 0;
+  8026fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802700:	eb d7                	jmp    8026d9 <devpipe_read+0xfe>
+
+00802702 <devpipe_write>:
+{
+  802702:	55                   	push   %ebp
+  802703:	89 e5                	mov    %esp,%ebp
+  802705:	57                   	push   %edi
+  802706:	56                   	push   %esi
+  802707:	53                   	push   %ebx
+  802708:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80270b:	ff 75 08             	push   0x8(%ebp)
+  80270e:	e8 64 f4 ff ff       	call   801b77 <fd2data>
+  802713:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  802715:	83 c4 10             	add    $0x10,%esp
+  802718:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80271f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802722:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802725:	0f 83 23 01 00 00    	jae    80284e <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80272b:	8b 77 04             	mov    0x4(%edi),%esi
+  80272e:	8b 1f                	mov    (%edi),%ebx
+  802730:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  802736:	29 d9                	sub    %ebx,%ecx
+  802738:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80273d:	f7 e1                	mul    %ecx
+  80273f:	c1 ea 0c             	shr    $0xc,%edx
+  802742:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802748:	29 c1                	sub    %eax,%ecx
+  80274a:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80274c:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802752:	75 40                	jne    802794 <devpipe_write+0x92>
+			ref = pageref(p);
+  802754:	83 ec 0c             	sub    $0xc,%esp
+  802757:	57                   	push   %edi
+  802758:	e8 a9 2c 00 00       	call   805406 <pageref>
+  80275d:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  80275f:	89 fa                	mov    %edi,%edx
+  802761:	8b 45 08             	mov    0x8(%ebp),%eax
+  802764:	e8 0d fe ff ff       	call   802576 <_pipeisclosed>
+  802769:	83 c4 10             	add    $0x10,%esp
+  80276c:	85 c0                	test   %eax,%eax
+  80276e:	0f 85 d5 00 00 00    	jne    802849 <devpipe_write+0x147>
+	*sleeping = 1;
+  802774:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  80277b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802780:	39 1f                	cmp    %ebx,(%edi)
+  802782:	75 a7                	jne    80272b <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  802784:	83 ec 04             	sub    $0x4,%esp
+  802787:	56                   	push   %esi
+  802788:	53                   	push   %ebx
+  802789:	57                   	push   %edi
+  80278a:	e8 62 ed ff ff       	call   8014f1 <sys_futex_wait>
+  80278f:	83 c4 10             	add    $0x10,%esp
+  802792:	eb 97                	jmp    80272b <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802794:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802797:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80279a:	29 c1                	sub    %eax,%ecx
+  80279c:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8027a1:	89 d8                	mov    %ebx,%eax
+  8027a3:	29 d0                	sub    %edx,%eax
+  8027a5:	39 c1                	cmp    %eax,%ecx
+  8027a7:	0f 46 c1             	cmovbe %ecx,%eax
+  8027aa:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  8027ac:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8027b1:	f7 e6                	mul    %esi
+  8027b3:	c1 ea 0b             	shr    $0xb,%edx
+  8027b6:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8027bc:	29 c6                	sub    %eax,%esi
+  8027be:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8027c0:	29 f3                	sub    %esi,%ebx
+  8027c2:	39 cb                	cmp    %ecx,%ebx
+  8027c4:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8027c7:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  8027ca:	8d 77 10             	lea    0x10(%edi),%esi
+  8027cd:	83 ec 04             	sub    $0x4,%esp
+  8027d0:	53                   	push   %ebx
+  8027d1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027d4:	03 45 0c             	add    0xc(%ebp),%eax
+  8027d7:	50                   	push   %eax
+  8027d8:	01 f2                	add    %esi,%edx
+  8027da:	52                   	push   %edx
+  8027db:	e8 cb e4 ff ff       	call   800cab <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8027e0:	83 c4 0c             	add    $0xc,%esp
+  8027e3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8027e6:	29 d8                	sub    %ebx,%eax
+  8027e8:	50                   	push   %eax
+  8027e9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8027ec:	01 d3                	add    %edx,%ebx
+  8027ee:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8027f1:	53                   	push   %ebx
+  8027f2:	56                   	push   %esi
+  8027f3:	e8 b3 e4 ff ff       	call   800cab <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8027f8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8027fb:	03 4f 04             	add    0x4(%edi),%ecx
+  8027fe:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802803:	f7 e1                	mul    %ecx
+  802805:	c1 ea 0c             	shr    $0xc,%edx
+  802808:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80280e:	29 d1                	sub    %edx,%ecx
+  802810:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  802813:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802818:	83 c4 10             	add    $0x10,%esp
+  80281b:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  80281f:	75 0b                	jne    80282c <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802821:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  802824:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802827:	e9 f3 fe ff ff       	jmp    80271f <devpipe_write+0x1d>
+		*sleeping = 0;
+  80282c:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  802833:	83 ec 08             	sub    $0x8,%esp
+  802836:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  80283b:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  80283e:	50                   	push   %eax
+  80283f:	e8 fd ec ff ff       	call   801541 <sys_futex_wake>
+  802844:	83 c4 10             	add    $0x10,%esp
+  802847:	eb d8                	jmp    802821 <devpipe_write+0x11f>
+				return 0;
+  802849:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80284e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802851:	5b                   	pop    %ebx
+  802852:	5e                   	pop    %esi
+  802853:	5f                   	pop    %edi
+  802854:	5d                   	pop    %ebp
+  802855:	c3                   	ret
+
+00802856 <pipe>:
+{
+  802856:	55                   	push   %ebp
+  802857:	89 e5                	mov    %esp,%ebp
+  802859:	56                   	push   %esi
+  80285a:	53                   	push   %ebx
+  80285b:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80285e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802861:	50                   	push   %eax
+  802862:	e8 27 f3 ff ff       	call   801b8e <fd_alloc>
+  802867:	89 c3                	mov    %eax,%ebx
+  802869:	83 c4 10             	add    $0x10,%esp
+  80286c:	85 c0                	test   %eax,%eax
+  80286e:	0f 88 23 01 00 00    	js     802997 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802874:	83 ec 04             	sub    $0x4,%esp
+  802877:	68 07 04 00 00       	push   $0x407
+  80287c:	ff 75 f4             	push   -0xc(%ebp)
+  80287f:	6a 00                	push   $0x0
+  802881:	e8 92 e7 ff ff       	call   801018 <sys_page_alloc>
+  802886:	89 c3                	mov    %eax,%ebx
+  802888:	83 c4 10             	add    $0x10,%esp
+  80288b:	85 c0                	test   %eax,%eax
+  80288d:	0f 88 04 01 00 00    	js     802997 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802893:	83 ec 0c             	sub    $0xc,%esp
+  802896:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802899:	50                   	push   %eax
+  80289a:	e8 ef f2 ff ff       	call   801b8e <fd_alloc>
+  80289f:	89 c3                	mov    %eax,%ebx
+  8028a1:	83 c4 10             	add    $0x10,%esp
+  8028a4:	85 c0                	test   %eax,%eax
+  8028a6:	0f 88 db 00 00 00    	js     802987 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028ac:	83 ec 04             	sub    $0x4,%esp
+  8028af:	68 07 04 00 00       	push   $0x407
+  8028b4:	ff 75 f0             	push   -0x10(%ebp)
+  8028b7:	6a 00                	push   $0x0
+  8028b9:	e8 5a e7 ff ff       	call   801018 <sys_page_alloc>
+  8028be:	89 c3                	mov    %eax,%ebx
+  8028c0:	83 c4 10             	add    $0x10,%esp
+  8028c3:	85 c0                	test   %eax,%eax
+  8028c5:	0f 88 bc 00 00 00    	js     802987 <pipe+0x131>
+	va = fd2data(fd0);
+  8028cb:	83 ec 0c             	sub    $0xc,%esp
+  8028ce:	ff 75 f4             	push   -0xc(%ebp)
+  8028d1:	e8 a1 f2 ff ff       	call   801b77 <fd2data>
+  8028d6:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028d8:	83 c4 0c             	add    $0xc,%esp
+  8028db:	68 07 04 00 00       	push   $0x407
+  8028e0:	50                   	push   %eax
+  8028e1:	6a 00                	push   $0x0
+  8028e3:	e8 30 e7 ff ff       	call   801018 <sys_page_alloc>
+  8028e8:	89 c3                	mov    %eax,%ebx
+  8028ea:	83 c4 10             	add    $0x10,%esp
+  8028ed:	85 c0                	test   %eax,%eax
+  8028ef:	0f 88 82 00 00 00    	js     802977 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028f5:	83 ec 0c             	sub    $0xc,%esp
+  8028f8:	ff 75 f0             	push   -0x10(%ebp)
+  8028fb:	e8 77 f2 ff ff       	call   801b77 <fd2data>
+  802900:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802907:	50                   	push   %eax
+  802908:	6a 00                	push   $0x0
+  80290a:	56                   	push   %esi
+  80290b:	6a 00                	push   $0x0
+  80290d:	e8 49 e7 ff ff       	call   80105b <sys_page_map>
+  802912:	89 c3                	mov    %eax,%ebx
+  802914:	83 c4 20             	add    $0x20,%esp
+  802917:	85 c0                	test   %eax,%eax
+  802919:	78 4e                	js     802969 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80291b:	a1 40 70 81 00       	mov    0x817040,%eax
+  802920:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802923:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802925:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802928:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80292f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802932:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802934:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802937:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80293e:	83 ec 0c             	sub    $0xc,%esp
+  802941:	ff 75 f4             	push   -0xc(%ebp)
+  802944:	e8 1e f2 ff ff       	call   801b67 <fd2num>
+  802949:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80294c:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80294e:	83 c4 04             	add    $0x4,%esp
+  802951:	ff 75 f0             	push   -0x10(%ebp)
+  802954:	e8 0e f2 ff ff       	call   801b67 <fd2num>
+  802959:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80295c:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80295f:	83 c4 10             	add    $0x10,%esp
+  802962:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802967:	eb 2e                	jmp    802997 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802969:	83 ec 08             	sub    $0x8,%esp
+  80296c:	56                   	push   %esi
+  80296d:	6a 00                	push   $0x0
+  80296f:	e8 29 e7 ff ff       	call   80109d <sys_page_unmap>
+  802974:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802977:	83 ec 08             	sub    $0x8,%esp
+  80297a:	ff 75 f0             	push   -0x10(%ebp)
+  80297d:	6a 00                	push   $0x0
+  80297f:	e8 19 e7 ff ff       	call   80109d <sys_page_unmap>
+  802984:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802987:	83 ec 08             	sub    $0x8,%esp
+  80298a:	ff 75 f4             	push   -0xc(%ebp)
+  80298d:	6a 00                	push   $0x0
+  80298f:	e8 09 e7 ff ff       	call   80109d <sys_page_unmap>
+  802994:	83 c4 10             	add    $0x10,%esp
+}
+  802997:	89 d8                	mov    %ebx,%eax
+  802999:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80299c:	5b                   	pop    %ebx
+  80299d:	5e                   	pop    %esi
+  80299e:	5d                   	pop    %ebp
+  80299f:	c3                   	ret
+
+008029a0 <pipeisclosed>:
+{
+  8029a0:	55                   	push   %ebp
+  8029a1:	89 e5                	mov    %esp,%ebp
+  8029a3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029a9:	50                   	push   %eax
+  8029aa:	ff 75 08             	push   0x8(%ebp)
+  8029ad:	e8 30 f2 ff ff       	call   801be2 <fd_lookup>
+  8029b2:	83 c4 10             	add    $0x10,%esp
+  8029b5:	85 c0                	test   %eax,%eax
+  8029b7:	78 18                	js     8029d1 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8029b9:	83 ec 0c             	sub    $0xc,%esp
+  8029bc:	ff 75 f4             	push   -0xc(%ebp)
+  8029bf:	e8 b3 f1 ff ff       	call   801b77 <fd2data>
+  8029c4:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8029c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029c9:	e8 a8 fb ff ff       	call   802576 <_pipeisclosed>
+  8029ce:	83 c4 10             	add    $0x10,%esp
+}
+  8029d1:	c9                   	leave
+  8029d2:	c3                   	ret
+
+008029d3 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8029d3:	55                   	push   %ebp
+  8029d4:	89 e5                	mov    %esp,%ebp
+  8029d6:	57                   	push   %edi
+  8029d7:	56                   	push   %esi
+  8029d8:	53                   	push   %ebx
+  8029d9:	83 ec 0c             	sub    $0xc,%esp
+  8029dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+	const volatile struct Env *e;
+	unsigned status;
+
+	assert(envid != 0);
+  8029df:	85 ff                	test   %edi,%edi
+  8029e1:	74 21                	je     802a04 <wait+0x31>
+	e = &envs[ENVX(envid)];
+  8029e3:	89 f8                	mov    %edi,%eax
+  8029e5:	25 ff 03 00 00       	and    $0x3ff,%eax
+	// The kernel wakes us when it frees the environment.  Until then
+	// we sleep, unless its status changed since we looked.
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  8029ea:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  8029ed:	c1 e6 06             	shl    $0x6,%esi
+  8029f0:	81 c6 54 00 c0 ee    	add    $0xeec00054,%esi
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  8029f6:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  8029f9:	c1 e3 06             	shl    $0x6,%ebx
+  8029fc:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  802a02:	eb 25                	jmp    802a29 <wait+0x56>
+	assert(envid != 0);
+  802a04:	68 31 5d 80 00       	push   $0x805d31
+  802a09:	68 d4 56 80 00       	push   $0x8056d4
+  802a0e:	6a 0a                	push   $0xa
+  802a10:	68 3c 5d 80 00       	push   $0x805d3c
+  802a15:	e8 49 da ff ff       	call   800463 <_panic>
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  802a1a:	83 ec 04             	sub    $0x4,%esp
+  802a1d:	6a ff                	push   $0xffffffff
+  802a1f:	50                   	push   %eax
+  802a20:	56                   	push   %esi
+  802a21:	e8 cb ea ff ff       	call   8014f1 <sys_futex_wait>
+  802a26:	83 c4 10             	add    $0x10,%esp
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  802a29:	8b 43 48             	mov    0x48(%ebx),%eax
+  802a2c:	39 f8                	cmp    %edi,%eax
+  802a2e:	75 07                	jne    802a37 <wait+0x64>
+  802a30:	8b 43 54             	mov    0x54(%ebx),%eax
+  802a33:	85 c0                	test   %eax,%eax
+  802a35:	75 e3                	jne    802a1a <wait+0x47>
+}
+  802a37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a3a:	5b                   	pop    %ebx
+  802a3b:	5e                   	pop    %esi
+  802a3c:	5f                   	pop    %edi
+  802a3d:	5d                   	pop    %ebp
+  802a3e:	c3                   	ret
+
+00802a3f <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802a3f:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802a41:	8b 15 24 f9 82 00    	mov    0x82f924,%edx
+  802a47:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802a4d:	81 c2 34 01 00 00    	add    $0x134,%edx
+  802a53:	39 d0                	cmp    %edx,%eax
+  802a55:	74 2e                	je     802a85 <segment_lookup+0x46>
+{
+  802a57:	55                   	push   %ebp
+  802a58:	89 e5                	mov    %esp,%ebp
+  802a5a:	57                   	push   %edi
+  802a5b:	56                   	push   %esi
+  802a5c:	53                   	push   %ebx
+  802a5d:	eb 07                	jmp    802a66 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802a5f:	83 c0 20             	add    $0x20,%eax
+  802a62:	39 d0                	cmp    %edx,%eax
+  802a64:	74 15                	je     802a7b <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802a66:	8b 18                	mov    (%eax),%ebx
+  802a68:	39 d9                	cmp    %ebx,%ecx
+  802a6a:	72 f3                	jb     802a5f <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  802a6c:	8b 38                	mov    (%eax),%edi
+  802a6e:	8b 58 04             	mov    0x4(%eax),%ebx
+  802a71:	89 ce                	mov    %ecx,%esi
+  802a73:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  802a75:	39 de                	cmp    %ebx,%esi
+  802a77:	73 e6                	jae    802a5f <segment_lookup+0x20>
+  802a79:	eb 05                	jmp    802a80 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  802a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a80:	5b                   	pop    %ebx
+  802a81:	5e                   	pop    %esi
+  802a82:	5f                   	pop    %edi
+  802a83:	5d                   	pop    %ebp
+  802a84:	c3                   	ret
+	return NULL;
+  802a85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a8a:	c3                   	ret
+
+00802a8b <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802a8b:	55                   	push   %ebp
+  802a8c:	89 e5                	mov    %esp,%ebp
+  802a8e:	53                   	push   %ebx
+  802a8f:	83 ec 04             	sub    $0x4,%esp
+  802a92:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802a94:	c1 e8 16             	shr    $0x16,%eax
+  802a97:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802a9e:	25 81 00 00 00       	and    $0x81,%eax
+  802aa3:	83 f8 01             	cmp    $0x1,%eax
+  802aa6:	75 6b                	jne    802b13 <page_is_clean+0x88>
+  802aa8:	89 da                	mov    %ebx,%edx
+  802aaa:	c1 ea 0c             	shr    $0xc,%edx
+  802aad:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  802ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802ab9:	f6 c1 01             	test   $0x1,%cl
+  802abc:	74 5a                	je     802b18 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802abe:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802ac5:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802acb:	75 4b                	jne    802b18 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  802acd:	89 d8                	mov    %ebx,%eax
+  802acf:	e8 6b ff ff ff       	call   802a3f <segment_lookup>
+  802ad4:	89 c2                	mov    %eax,%edx
+		return 1;
+  802ad6:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  802adb:	85 d2                	test   %edx,%edx
+  802add:	75 39                	jne    802b18 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  802adf:	8b 15 0c c0 81 00    	mov    0x81c00c,%edx
+  802ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aea:	eb 03                	jmp    802aef <page_is_clean+0x64>
+  802aec:	83 c0 01             	add    $0x1,%eax
+  802aef:	39 c2                	cmp    %eax,%edx
+  802af1:	7e 19                	jle    802b0c <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  802af3:	3b 1c c5 20 c0 81 00 	cmp    0x81c020(,%eax,8),%ebx
+  802afa:	72 f0                	jb     802aec <page_is_clean+0x61>
+  802afc:	3b 1c c5 24 c0 81 00 	cmp    0x81c024(,%eax,8),%ebx
+  802b03:	73 e7                	jae    802aec <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  802b05:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b0a:	eb 0c                	jmp    802b18 <page_is_clean+0x8d>
+	return 0;
+  802b0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b11:	eb 05                	jmp    802b18 <page_is_clean+0x8d>
+		return 0;
+  802b13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b1b:	c9                   	leave
+  802b1c:	c3                   	ret
+
+00802b1d <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  802b1d:	55                   	push   %ebp
+  802b1e:	89 e5                	mov    %esp,%ebp
+  802b20:	57                   	push   %edi
+  802b21:	56                   	push   %esi
+  802b22:	53                   	push   %ebx
+  802b23:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802b26:	be 00 00 00 00       	mov    $0x0,%esi
+  802b2b:	eb 19                	jmp    802b46 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802b2d:	f7 d3                	not    %ebx
+  802b2f:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802b35:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802b37:	83 c6 01             	add    $0x1,%esi
+  802b3a:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802b40:	0f 87 97 00 00 00    	ja     802bdd <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802b46:	89 f3                	mov    %esi,%ebx
+  802b48:	03 1d 34 90 81 00    	add    0x819034,%ebx
+  802b4e:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802b54:	89 d8                	mov    %ebx,%eax
+  802b56:	c1 e8 0a             	shr    $0xa,%eax
+  802b59:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802b60:	25 81 00 00 00       	and    $0x81,%eax
+  802b65:	83 f8 01             	cmp    $0x1,%eax
+  802b68:	75 c3                	jne    802b2d <linear_walk+0x10>
+  802b6a:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802b70:	77 bb                	ja     802b2d <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802b72:	89 df                	mov    %ebx,%edi
+  802b74:	c1 e7 0c             	shl    $0xc,%edi
+  802b77:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802b7a:	89 f8                	mov    %edi,%eax
+  802b7c:	e8 0a ff ff ff       	call   802a8b <page_is_clean>
+  802b81:	84 c0                	test   %al,%al
+  802b83:	75 64                	jne    802be9 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b85:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802b8b:	77 aa                	ja     802b37 <linear_walk+0x1a>
+  802b8d:	81 ff 2c 10 83 00    	cmp    $0x83102c,%edi
+  802b93:	72 a2                	jb     802b37 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b95:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b9c:	a8 01                	test   $0x1,%al
+  802b9e:	74 97                	je     802b37 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802ba0:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802ba7:	f6 c4 04             	test   $0x4,%ah
+  802baa:	75 8b                	jne    802b37 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802bac:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802bb3:	f6 c4 02             	test   $0x2,%ah
+  802bb6:	0f 85 7b ff ff ff    	jne    802b37 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802bbc:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802bc3:	c1 e8 0c             	shr    $0xc,%eax
+  802bc6:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802bc9:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802bce:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802bd2:	66 83 f8 01          	cmp    $0x1,%ax
+  802bd6:	76 11                	jbe    802be9 <linear_walk+0xcc>
+  802bd8:	e9 5a ff ff ff       	jmp    802b37 <linear_walk+0x1a>
+  802bdd:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  802be2:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802be9:	89 1d 34 90 81 00    	mov    %ebx,0x819034
+}
+  802bef:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bf2:	83 c4 1c             	add    $0x1c,%esp
+  802bf5:	5b                   	pop    %ebx
+  802bf6:	5e                   	pop    %esi
+  802bf7:	5f                   	pop    %edi
+  802bf8:	5d                   	pop    %ebp
+  802bf9:	c3                   	ret
+
+00802bfa <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802bfa:	55                   	push   %ebp
+  802bfb:	89 e5                	mov    %esp,%ebp
+  802bfd:	56                   	push   %esi
+  802bfe:	53                   	push   %ebx
+  802bff:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  802c01:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802c06:	83 e0 7f             	and    $0x7f,%eax
+  802c09:	c1 e0 04             	shl    $0x4,%eax
+  802c0c:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  802c12:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802c18:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802c1e:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  802c24:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802c29:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  802c2c:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802c31:	83 c0 01             	add    $0x1,%eax
+  802c34:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  802c39:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802c3c:	5b                   	pop    %ebx
+  802c3d:	5e                   	pop    %esi
+  802c3e:	5d                   	pop    %ebp
+  802c3f:	c3                   	ret
+
+00802c40 <page_ring_enter>:
+{
+  802c40:	55                   	push   %ebp
+  802c41:	89 e5                	mov    %esp,%ebp
+  802c43:	57                   	push   %edi
+  802c44:	56                   	push   %esi
+  802c45:	53                   	push   %ebx
+  802c46:	83 ec 18             	sub    $0x18,%esp
+  802c49:	89 c6                	mov    %eax,%esi
+  802c4b:	89 d7                	mov    %edx,%edi
+  802c4d:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802c4f:	6a 00                	push   $0x0
+  802c51:	6a 00                	push   $0x0
+  802c53:	6a 00                	push   $0x0
+  802c55:	6a 07                	push   $0x7
+  802c57:	ff 35 40 c0 81 00    	push   0x81c040
+  802c5d:	e8 8e 26 00 00       	call   8052f0 <ipc_call>
+  802c62:	83 c4 20             	add    $0x20,%esp
+  802c65:	85 c0                	test   %eax,%eax
+  802c67:	79 22                	jns    802c8b <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802c69:	50                   	push   %eax
+  802c6a:	68 47 5d 80 00       	push   $0x805d47
+  802c6f:	68 13 02 00 00       	push   $0x213
+  802c74:	68 5b 5d 80 00       	push   $0x805d5b
+  802c79:	e8 e5 d7 ff ff       	call   800463 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802c7e:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802c83:	83 c0 01             	add    $0x1,%eax
+  802c86:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802c8b:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802c91:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802c96:	39 c2                	cmp    %eax,%edx
+  802c98:	74 24                	je     802cbe <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802c9a:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802c9f:	83 e0 7f             	and    $0x7f,%eax
+  802ca2:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802ca9:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802cb0:	29 f0                	sub    %esi,%eax
+  802cb2:	39 d8                	cmp    %ebx,%eax
+  802cb4:	73 c8                	jae    802c7e <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802cb6:	8b 52 04             	mov    0x4(%edx),%edx
+  802cb9:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802cbc:	eb c0                	jmp    802c7e <page_ring_enter+0x3e>
+}
+  802cbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cc1:	5b                   	pop    %ebx
+  802cc2:	5e                   	pop    %esi
+  802cc3:	5f                   	pop    %edi
+  802cc4:	5d                   	pop    %ebp
+  802cc5:	c3                   	ret
+
+00802cc6 <page_ring_reserve>:
+{
+  802cc6:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802cc8:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802ccd:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802cd3:	29 d0                	sub    %edx,%eax
+  802cd5:	ba 80 00 00 00       	mov    $0x80,%edx
+  802cda:	29 ca                	sub    %ecx,%edx
+  802cdc:	39 c2                	cmp    %eax,%edx
+  802cde:	72 01                	jb     802ce1 <page_ring_reserve+0x1b>
+  802ce0:	c3                   	ret
+{
+  802ce1:	55                   	push   %ebp
+  802ce2:	89 e5                	mov    %esp,%ebp
+  802ce4:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802ce7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802cec:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf6:	e8 45 ff ff ff       	call   802c40 <page_ring_enter>
+}
+  802cfb:	c9                   	leave
+  802cfc:	c3                   	ret
+
+00802cfd <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802cfd:	55                   	push   %ebp
+  802cfe:	89 e5                	mov    %esp,%ebp
+  802d00:	53                   	push   %ebx
+  802d01:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802d04:	6a 07                	push   $0x7
+  802d06:	6a 01                	push   $0x1
+  802d08:	89 c3                	mov    %eax,%ebx
+  802d0a:	c1 e3 0c             	shl    $0xc,%ebx
+  802d0d:	8d 93 00 a0 81 00    	lea    0x81a000(%ebx),%edx
+  802d13:	52                   	push   %edx
+  802d14:	6a 04                	push   $0x4
+  802d16:	ff 34 85 44 c0 81 00 	push   0x81c044(,%eax,4)
+  802d1d:	e8 ce 25 00 00       	call   8052f0 <ipc_call>
+	sharereqs[i].nslots = 0;
+  802d22:	c7 83 00 a0 81 00 00 	movl   $0x0,0x81a000(%ebx)
+  802d29:	00 00 00 
+	return r;
+}
+  802d2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d2f:	c9                   	leave
+  802d30:	c3                   	ret
+
+00802d31 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802d31:	55                   	push   %ebp
+  802d32:	89 e5                	mov    %esp,%ebp
+  802d34:	56                   	push   %esi
+  802d35:	53                   	push   %ebx
+  802d36:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802d38:	c1 e8 10             	shr    $0x10,%eax
+  802d3b:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802d3e:	89 c2                	mov    %eax,%edx
+  802d40:	c1 e2 0c             	shl    $0xc,%edx
+  802d43:	8b b2 00 a0 81 00    	mov    0x81a000(%edx),%esi
+  802d49:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802d4c:	89 9a 00 a0 81 00    	mov    %ebx,0x81a000(%edx)
+  802d52:	89 c2                	mov    %eax,%edx
+  802d54:	c1 e2 0a             	shl    $0xa,%edx
+  802d57:	01 f2                	add    %esi,%edx
+  802d59:	89 0c 95 04 a0 81 00 	mov    %ecx,0x81a004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802d60:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802d66:	74 09                	je     802d71 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802d68:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d6d:	5b                   	pop    %ebx
+  802d6e:	5e                   	pop    %esi
+  802d6f:	5d                   	pop    %ebp
+  802d70:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802d71:	e8 87 ff ff ff       	call   802cfd <page_share_send>
+  802d76:	eb f5                	jmp    802d6d <page_share_slot+0x3c>
+
+00802d78 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802d78:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  802d7d:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802d80:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802d85:	3b 15 00 c0 81 00    	cmp    0x81c000,%edx
+  802d8b:	74 09                	je     802d96 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802d8d:	a1 40 c0 81 00       	mov    0x81c040,%eax
+  802d92:	85 c0                	test   %eax,%eax
+  802d94:	75 01                	jne    802d97 <page_ring_ready+0x1f>
+}
+  802d96:	c3                   	ret
+{
+  802d97:	55                   	push   %ebp
+  802d98:	89 e5                	mov    %esp,%ebp
+  802d9a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802d9d:	68 07 06 00 00       	push   $0x607
+  802da2:	6a 08                	push   $0x8
+  802da4:	68 00 30 ad de       	push   $0xdead3000
+  802da9:	6a 00                	push   $0x0
+  802dab:	e8 93 e3 ff ff       	call   801143 <sys_page_alloc_range>
+  802db0:	83 c4 10             	add    $0x10,%esp
+  802db3:	83 f8 08             	cmp    $0x8,%eax
+  802db6:	74 1b                	je     802dd3 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802db8:	83 ec 04             	sub    $0x4,%esp
+  802dbb:	6a 08                	push   $0x8
+  802dbd:	68 00 30 ad de       	push   $0xdead3000
+  802dc2:	6a 00                	push   $0x0
+  802dc4:	e8 e8 e3 ff ff       	call   8011b1 <sys_page_unmap_range>
+		return 0;
+  802dc9:	83 c4 10             	add    $0x10,%esp
+  802dcc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802dd1:	c9                   	leave
+  802dd2:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802dd3:	83 ec 0c             	sub    $0xc,%esp
+  802dd6:	68 07 04 00 00       	push   $0x407
+  802ddb:	6a 08                	push   $0x8
+  802ddd:	68 00 30 ad de       	push   $0xdead3000
+  802de2:	6a 06                	push   $0x6
+  802de4:	ff 35 40 c0 81 00    	push   0x81c040
+  802dea:	e8 01 25 00 00       	call   8052f0 <ipc_call>
+  802def:	83 c4 20             	add    $0x20,%esp
+  802df2:	85 c0                	test   %eax,%eax
+  802df4:	78 14                	js     802e0a <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802df6:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  802dfb:	8b 40 48             	mov    0x48(%eax),%eax
+  802dfe:	a3 00 c0 81 00       	mov    %eax,0x81c000
+	return 1;
+  802e03:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e08:	eb c7                	jmp    802dd1 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802e0a:	83 ec 04             	sub    $0x4,%esp
+  802e0d:	6a 08                	push   $0x8
+  802e0f:	68 00 30 ad de       	push   $0xdead3000
+  802e14:	6a 00                	push   $0x0
+  802e16:	e8 96 e3 ff ff       	call   8011b1 <sys_page_unmap_range>
+		return 0;
+  802e1b:	83 c4 10             	add    $0x10,%esp
+  802e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e23:	eb ac                	jmp    802dd1 <page_ring_ready+0x59>
+
+00802e25 <page_remove_slot>:
+{
+  802e25:	55                   	push   %ebp
+  802e26:	89 e5                	mov    %esp,%ebp
+  802e28:	56                   	push   %esi
+  802e29:	53                   	push   %ebx
+  802e2a:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802e2c:	89 c6                	mov    %eax,%esi
+  802e2e:	c1 ee 10             	shr    $0x10,%esi
+  802e31:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802e34:	8b 04 b5 44 c0 81 00 	mov    0x81c044(,%esi,4),%eax
+  802e3b:	39 05 40 c0 81 00    	cmp    %eax,0x81c040
+  802e41:	74 2a                	je     802e6d <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802e43:	83 ec 0c             	sub    $0xc,%esp
+  802e46:	6a 00                	push   $0x0
+  802e48:	6a 00                	push   $0x0
+  802e4a:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802e4c:	c1 e3 04             	shl    $0x4,%ebx
+  802e4f:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802e52:	53                   	push   %ebx
+  802e53:	ff 34 b5 44 c0 81 00 	push   0x81c044(,%esi,4)
+  802e5a:	e8 91 24 00 00       	call   8052f0 <ipc_call>
+  802e5f:	83 c4 20             	add    $0x20,%esp
+  802e62:	85 c0                	test   %eax,%eax
+  802e64:	78 2d                	js     802e93 <page_remove_slot+0x6e>
+}
+  802e66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e69:	5b                   	pop    %ebx
+  802e6a:	5e                   	pop    %esi
+  802e6b:	5d                   	pop    %ebp
+  802e6c:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802e6d:	e8 06 ff ff ff       	call   802d78 <page_ring_ready>
+  802e72:	85 c0                	test   %eax,%eax
+  802e74:	74 cd                	je     802e43 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802e76:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e7b:	e8 46 fe ff ff       	call   802cc6 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802e80:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e85:	89 da                	mov    %ebx,%edx
+  802e87:	b8 02 00 00 00       	mov    $0x2,%eax
+  802e8c:	e8 69 fd ff ff       	call   802bfa <page_ring_post>
+		return;
+  802e91:	eb d3                	jmp    802e66 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802e93:	50                   	push   %eax
+  802e94:	68 b4 5d 80 00       	push   $0x805db4
+  802e99:	68 ac 03 00 00       	push   $0x3ac
+  802e9e:	68 5b 5d 80 00       	push   $0x805d5b
+  802ea3:	e8 bb d5 ff ff       	call   800463 <_panic>
+
+00802ea8 <find_paging_env>:
+	if(pagingenv)
+  802ea8:	a1 40 c0 81 00       	mov    0x81c040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802ead:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802eaf:	85 c0                	test   %eax,%eax
+  802eb1:	74 05                	je     802eb8 <find_paging_env+0x10>
+  802eb3:	eb 56                	jmp    802f0b <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802eb5:	83 c0 01             	add    $0x1,%eax
+  802eb8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802ebd:	7f 47                	jg     802f06 <find_paging_env+0x5e>
+  802ebf:	83 f9 01             	cmp    $0x1,%ecx
+  802ec2:	7f 42                	jg     802f06 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802ec4:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802ec7:	c1 e2 06             	shl    $0x6,%edx
+  802eca:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802ed0:	8b 52 50             	mov    0x50(%edx),%edx
+  802ed3:	83 fa 02             	cmp    $0x2,%edx
+  802ed6:	75 dd                	jne    802eb5 <find_paging_env+0xd>
+  802ed8:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802edb:	c1 e2 06             	shl    $0x6,%edx
+  802ede:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802ee4:	8b 52 54             	mov    0x54(%edx),%edx
+  802ee7:	85 d2                	test   %edx,%edx
+  802ee9:	74 ca                	je     802eb5 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802eeb:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802eee:	c1 e2 06             	shl    $0x6,%edx
+  802ef1:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802ef7:	8b 52 48             	mov    0x48(%edx),%edx
+  802efa:	89 14 8d 44 c0 81 00 	mov    %edx,0x81c044(,%ecx,4)
+  802f01:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802f04:	eb af                	jmp    802eb5 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802f06:	83 f9 02             	cmp    $0x2,%ecx
+  802f09:	74 01                	je     802f0c <find_paging_env+0x64>
+}
+  802f0b:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802f0c:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  802f11:	8b 40 48             	mov    0x48(%eax),%eax
+  802f14:	83 e0 01             	and    $0x1,%eax
+  802f17:	8b 04 85 44 c0 81 00 	mov    0x81c044(,%eax,4),%eax
+  802f1e:	a3 40 c0 81 00       	mov    %eax,0x81c040
+  802f23:	eb e6                	jmp    802f0b <find_paging_env+0x63>
+
+00802f25 <page_add_backed>:
+{
+  802f25:	55                   	push   %ebp
+  802f26:	89 e5                	mov    %esp,%ebp
+  802f28:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802f2b:	a1 0c c0 81 00       	mov    0x81c00c,%eax
+  802f30:	83 f8 04             	cmp    $0x4,%eax
+  802f33:	74 35                	je     802f6a <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802f35:	89 d1                	mov    %edx,%ecx
+  802f37:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802f3d:	89 0c c5 20 c0 81 00 	mov    %ecx,0x81c020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802f44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f47:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802f4e:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802f54:	89 14 c5 24 c0 81 00 	mov    %edx,0x81c024(,%eax,8)
+	num_backed_ranges++;
+  802f5b:	83 c0 01             	add    $0x1,%eax
+  802f5e:	a3 0c c0 81 00       	mov    %eax,0x81c00c
+	return 0;
+  802f63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f68:	5d                   	pop    %ebp
+  802f69:	c3                   	ret
+		return -E_NO_MEM;
+  802f6a:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802f6f:	eb f7                	jmp    802f68 <page_add_backed+0x43>
+
+00802f71 <percentage_of_pgdir_to_walk>:
+{
+  802f71:	55                   	push   %ebp
+  802f72:	89 e5                	mov    %esp,%ebp
+  802f74:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802f77:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802f7b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802f7e:	db 45 fc             	fildl  -0x4(%ebp)
+  802f81:	d8 35 40 62 80 00    	fdivs  0x806240
+	return ret*ret;
+  802f87:	d8 c8                	fmul   %st(0),%st
+}
+  802f89:	c9                   	leave
+  802f8a:	c3                   	ret
+
+00802f8b <nfu_with_aging_page_choice_func>:
+{
+  802f8b:	55                   	push   %ebp
+  802f8c:	89 e5                	mov    %esp,%ebp
+  802f8e:	57                   	push   %edi
+  802f8f:	56                   	push   %esi
+  802f90:	53                   	push   %ebx
+  802f91:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802f94:	8b 35 30 90 81 00    	mov    0x819030,%esi
+	float pct_to_walk = 1.0f;
+  802f9a:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802f9c:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802fa1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fa6:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802fad:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fb2:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802fb5:	eb 18                	jmp    802fcf <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802fb7:	f7 d0                	not    %eax
+  802fb9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802fbe:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802fc0:	83 c2 01             	add    $0x1,%edx
+  802fc3:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802fc9:	0f 87 13 01 00 00    	ja     8030e2 <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802fcf:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802fd3:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802fd6:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802fdb:	89 c1                	mov    %eax,%ecx
+  802fdd:	c1 e9 0a             	shr    $0xa,%ecx
+  802fe0:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802fe7:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802fed:	83 f9 01             	cmp    $0x1,%ecx
+  802ff0:	75 c5                	jne    802fb7 <nfu_with_aging_page_choice_func+0x2c>
+  802ff2:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802ff7:	77 be                	ja     802fb7 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802ff9:	89 c1                	mov    %eax,%ecx
+  802ffb:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802ffe:	81 f9 2c 10 83 00    	cmp    $0x83102c,%ecx
+  803004:	0f 82 a5 00 00 00    	jb     8030af <nfu_with_aging_page_choice_func+0x124>
+  80300a:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803010:	0f 87 99 00 00 00    	ja     8030af <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803016:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80301d:	f6 c1 01             	test   $0x1,%cl
+  803020:	0f 84 89 00 00 00    	je     8030af <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803026:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80302d:	f6 c5 04             	test   $0x4,%ch
+  803030:	75 7d                	jne    8030af <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803032:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803039:	f6 c5 02             	test   $0x2,%ch
+  80303c:	75 71                	jne    8030af <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80303e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803045:	c1 e9 0c             	shr    $0xc,%ecx
+  803048:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80304b:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803051:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803055:	66 83 f9 01          	cmp    $0x1,%cx
+  803059:	77 54                	ja     8030af <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  80305b:	89 f9                	mov    %edi,%ecx
+  80305d:	80 f9 ff             	cmp    $0xff,%cl
+  803060:	74 21                	je     803083 <nfu_with_aging_page_choice_func+0xf8>
+  803062:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803069:	c1 e9 0c             	shr    $0xc,%ecx
+  80306c:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80306f:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803075:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  803079:	89 fb                	mov    %edi,%ebx
+  80307b:	38 d9                	cmp    %bl,%cl
+  80307d:	73 30                	jae    8030af <nfu_with_aging_page_choice_func+0x124>
+  80307f:	dd d8                	fstp   %st(0)
+  803081:	eb 02                	jmp    803085 <nfu_with_aging_page_choice_func+0xfa>
+  803083:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  803085:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80308c:	c1 e9 0c             	shr    $0xc,%ecx
+  80308f:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803092:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  803099:	89 fb                	mov    %edi,%ebx
+  80309b:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  80309e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8030a1:	db 45 e0             	fildl  -0x20(%ebp)
+  8030a4:	d8 35 40 62 80 00    	fdivs  0x806240
+	return ret*ret;
+  8030aa:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8030ac:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8030af:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8030b2:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8030b5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8030bc:	df 6d e0             	fildll -0x20(%ebp)
+  8030bf:	d9 c1                	fld    %st(1)
+  8030c1:	d8 0d 44 62 80 00    	fmuls  0x806244
+  8030c7:	d9 c9                	fxch   %st(1)
+  8030c9:	df f1                	fcomip %st(1),%st
+  8030cb:	dd d8                	fstp   %st(0)
+  8030cd:	0f 82 ed fe ff ff    	jb     802fc0 <nfu_with_aging_page_choice_func+0x35>
+  8030d3:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  8030d5:	a3 30 90 81 00       	mov    %eax,0x819030
+			return (void*)(pgnum_opt*PGSIZE);
+  8030da:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8030dd:	c1 e0 0c             	shl    $0xc,%eax
+  8030e0:	eb 0e                	jmp    8030f0 <nfu_with_aging_page_choice_func+0x165>
+  8030e2:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  8030e4:	89 f8                	mov    %edi,%eax
+  8030e6:	3c ff                	cmp    $0xff,%al
+  8030e8:	74 0e                	je     8030f8 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  8030ea:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8030ed:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8030f0:	83 c4 14             	add    $0x14,%esp
+  8030f3:	5b                   	pop    %ebx
+  8030f4:	5e                   	pop    %esi
+  8030f5:	5f                   	pop    %edi
+  8030f6:	5d                   	pop    %ebp
+  8030f7:	c3                   	ret
+	pgnum = 0;
+  8030f8:	c7 05 30 90 81 00 00 	movl   $0x0,0x819030
+  8030ff:	00 00 00 
+	return (void*)UTOP;
+  803102:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803107:	eb e7                	jmp    8030f0 <nfu_with_aging_page_choice_func+0x165>
+
+00803109 <myRand>:
+    state = state * 1664525 + 1013904223;
+  803109:	69 05 60 70 81 00 0d 	imul   $0x19660d,0x817060,%eax
+  803110:	66 19 00 
+  803113:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  803118:	a3 60 70 81 00       	mov    %eax,0x817060
+    return state >> 24;
+  80311d:	c1 e8 18             	shr    $0x18,%eax
+}
+  803120:	c3                   	ret
+
+00803121 <random_page_choice_func>:
+{
+  803121:	55                   	push   %ebp
+  803122:	89 e5                	mov    %esp,%ebp
+  803124:	57                   	push   %edi
+  803125:	56                   	push   %esi
+  803126:	53                   	push   %ebx
+  803127:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80312a:	be 00 00 00 00       	mov    $0x0,%esi
+  80312f:	eb 19                	jmp    80314a <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803131:	f7 d3                	not    %ebx
+  803133:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  803139:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80313b:	83 c6 01             	add    $0x1,%esi
+  80313e:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  803144:	0f 87 a0 00 00 00    	ja     8031ea <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80314a:	89 f3                	mov    %esi,%ebx
+  80314c:	03 1d 2c 90 81 00    	add    0x81902c,%ebx
+  803152:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803158:	89 d8                	mov    %ebx,%eax
+  80315a:	c1 e8 0a             	shr    $0xa,%eax
+  80315d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803164:	25 81 00 00 00       	and    $0x81,%eax
+  803169:	83 f8 01             	cmp    $0x1,%eax
+  80316c:	75 c3                	jne    803131 <random_page_choice_func+0x10>
+  80316e:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803174:	77 bb                	ja     803131 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  803176:	89 df                	mov    %ebx,%edi
+  803178:	c1 e7 0c             	shl    $0xc,%edi
+  80317b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80317e:	89 f8                	mov    %edi,%eax
+  803180:	e8 06 f9 ff ff       	call   802a8b <page_is_clean>
+  803185:	84 c0                	test   %al,%al
+  803187:	0f 85 82 00 00 00    	jne    80320f <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80318d:	81 ff 2c 10 83 00    	cmp    $0x83102c,%edi
+  803193:	72 a6                	jb     80313b <random_page_choice_func+0x1a>
+  803195:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  80319b:	77 9e                	ja     80313b <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80319d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8031a4:	a8 01                	test   $0x1,%al
+  8031a6:	74 93                	je     80313b <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8031a8:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8031af:	f6 c4 04             	test   $0x4,%ah
+  8031b2:	75 87                	jne    80313b <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8031b4:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8031bb:	f6 c4 02             	test   $0x2,%ah
+  8031be:	0f 85 77 ff ff ff    	jne    80313b <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8031c4:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8031cb:	c1 e8 0c             	shr    $0xc,%eax
+  8031ce:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8031d1:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8031d6:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8031da:	66 83 f8 01          	cmp    $0x1,%ax
+  8031de:	0f 87 57 ff ff ff    	ja     80313b <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  8031e4:	89 1d 2c 90 81 00    	mov    %ebx,0x81902c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8031ea:	e8 1a ff ff ff       	call   803109 <myRand>
+  8031ef:	8b 3d 2c 90 81 00    	mov    0x81902c,%edi
+  8031f5:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  8031fa:	29 fe                	sub    %edi,%esi
+  8031fc:	0f be c0             	movsbl %al,%eax
+  8031ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  803204:	f7 f6                	div    %esi
+  803206:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  803208:	bb 15 00 00 00       	mov    $0x15,%ebx
+  80320d:	eb 1c                	jmp    80322b <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  80320f:	89 1d 2c 90 81 00    	mov    %ebx,0x81902c
+			return (void*)(pgnum*PGSIZE);
+  803215:	e9 8f 00 00 00       	jmp    8032a9 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  80321a:	e8 ea fe ff ff       	call   803109 <myRand>
+  80321f:	0f be c0             	movsbl %al,%eax
+  803222:	ba 00 00 00 00       	mov    $0x0,%edx
+  803227:	f7 f6                	div    %esi
+  803229:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  80322b:	83 eb 01             	sub    $0x1,%ebx
+  80322e:	0f 84 c2 00 00 00    	je     8032f6 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  803234:	89 d0                	mov    %edx,%eax
+  803236:	c1 e8 0a             	shr    $0xa,%eax
+  803239:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803240:	25 81 00 00 00       	and    $0x81,%eax
+  803245:	83 f8 01             	cmp    $0x1,%eax
+  803248:	75 d0                	jne    80321a <random_page_choice_func+0xf9>
+  80324a:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  803250:	77 c8                	ja     80321a <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  803252:	89 d0                	mov    %edx,%eax
+  803254:	c1 e0 0c             	shl    $0xc,%eax
+  803257:	3d 2c 10 83 00       	cmp    $0x83102c,%eax
+  80325c:	72 56                	jb     8032b4 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  80325e:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  803263:	77 65                	ja     8032ca <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  803265:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  80326c:	f6 c1 01             	test   $0x1,%cl
+  80326f:	74 59                	je     8032ca <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  803271:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  803278:	f6 c5 04             	test   $0x4,%ch
+  80327b:	75 4d                	jne    8032ca <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  80327d:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  803284:	f6 c5 02             	test   $0x2,%ch
+  803287:	75 41                	jne    8032ca <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  803289:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803290:	c1 ea 0c             	shr    $0xc,%edx
+  803293:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  803296:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  80329c:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  8032a0:	66 83 fa 01          	cmp    $0x1,%dx
+  8032a4:	77 3a                	ja     8032e0 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  8032a6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  8032a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032ac:	83 c4 1c             	add    $0x1c,%esp
+  8032af:	5b                   	pop    %ebx
+  8032b0:	5e                   	pop    %esi
+  8032b1:	5f                   	pop    %edi
+  8032b2:	5d                   	pop    %ebp
+  8032b3:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8032b4:	e8 50 fe ff ff       	call   803109 <myRand>
+  8032b9:	0f be c0             	movsbl %al,%eax
+  8032bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032c1:	f7 f6                	div    %esi
+  8032c3:	01 fa                	add    %edi,%edx
+			continue;
+  8032c5:	e9 61 ff ff ff       	jmp    80322b <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  8032ca:	e8 3a fe ff ff       	call   803109 <myRand>
+  8032cf:	0f be c0             	movsbl %al,%eax
+  8032d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032d7:	f7 f6                	div    %esi
+  8032d9:	01 fa                	add    %edi,%edx
+			continue;
+  8032db:	e9 4b ff ff ff       	jmp    80322b <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  8032e0:	e8 24 fe ff ff       	call   803109 <myRand>
+  8032e5:	0f be c0             	movsbl %al,%eax
+  8032e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032ed:	f7 f6                	div    %esi
+  8032ef:	01 fa                	add    %edi,%edx
+			continue;
+  8032f1:	e9 35 ff ff ff       	jmp    80322b <random_page_choice_func+0x10a>
+	pgnum = 0;
+  8032f6:	c7 05 2c 90 81 00 00 	movl   $0x0,0x81902c
+  8032fd:	00 00 00 
+	return (void*)UTOP;
+  803300:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  803307:	eb a0                	jmp    8032a9 <random_page_choice_func+0x188>
+
+00803309 <nfu>:
+{
+  803309:	55                   	push   %ebp
+  80330a:	89 e5                	mov    %esp,%ebp
+  80330c:	57                   	push   %edi
+  80330d:	56                   	push   %esi
+  80330e:	53                   	push   %ebx
+  80330f:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803312:	8b 35 28 90 81 00    	mov    0x819028,%esi
+	float pct_to_walk = 1.0f;
+  803318:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  80331a:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80331f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803324:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80332b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803330:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  803333:	eb 18                	jmp    80334d <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803335:	f7 d0                	not    %eax
+  803337:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80333c:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80333e:	83 c2 01             	add    $0x1,%edx
+  803341:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803347:	0f 87 13 01 00 00    	ja     803460 <nfu+0x157>
+		++num_searched_ptes;
+  80334d:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803351:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  803354:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803359:	89 c1                	mov    %eax,%ecx
+  80335b:	c1 e9 0a             	shr    $0xa,%ecx
+  80335e:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  803365:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  80336b:	83 f9 01             	cmp    $0x1,%ecx
+  80336e:	75 c5                	jne    803335 <nfu+0x2c>
+  803370:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803375:	77 be                	ja     803335 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803377:	89 c1                	mov    %eax,%ecx
+  803379:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80337c:	81 f9 2c 10 83 00    	cmp    $0x83102c,%ecx
+  803382:	0f 82 a5 00 00 00    	jb     80342d <nfu+0x124>
+  803388:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  80338e:	0f 87 99 00 00 00    	ja     80342d <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803394:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80339b:	f6 c1 01             	test   $0x1,%cl
+  80339e:	0f 84 89 00 00 00    	je     80342d <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8033a4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8033ab:	f6 c5 04             	test   $0x4,%ch
+  8033ae:	75 7d                	jne    80342d <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8033b0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8033b7:	f6 c5 02             	test   $0x2,%ch
+  8033ba:	75 71                	jne    80342d <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8033bc:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8033c3:	c1 e9 0c             	shr    $0xc,%ecx
+  8033c6:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8033c9:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8033cf:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8033d3:	66 83 f9 01          	cmp    $0x1,%cx
+  8033d7:	77 54                	ja     80342d <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  8033d9:	89 f9                	mov    %edi,%ecx
+  8033db:	80 f9 ff             	cmp    $0xff,%cl
+  8033de:	74 21                	je     803401 <nfu+0xf8>
+  8033e0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8033e7:	c1 e9 0c             	shr    $0xc,%ecx
+  8033ea:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8033ed:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8033f3:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  8033f7:	89 fb                	mov    %edi,%ebx
+  8033f9:	38 d9                	cmp    %bl,%cl
+  8033fb:	73 30                	jae    80342d <nfu+0x124>
+  8033fd:	dd d8                	fstp   %st(0)
+  8033ff:	eb 02                	jmp    803403 <nfu+0xfa>
+  803401:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  803403:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80340a:	c1 e9 0c             	shr    $0xc,%ecx
+  80340d:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803410:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  803417:	89 fb                	mov    %edi,%ebx
+  803419:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  80341c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80341f:	db 45 e0             	fildl  -0x20(%ebp)
+  803422:	d8 35 40 62 80 00    	fdivs  0x806240
+	return ret*ret;
+  803428:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80342a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  80342d:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  803430:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803433:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80343a:	df 6d e0             	fildll -0x20(%ebp)
+  80343d:	d9 c1                	fld    %st(1)
+  80343f:	d8 0d 44 62 80 00    	fmuls  0x806244
+  803445:	d9 c9                	fxch   %st(1)
+  803447:	df f1                	fcomip %st(1),%st
+  803449:	dd d8                	fstp   %st(0)
+  80344b:	0f 82 ed fe ff ff    	jb     80333e <nfu+0x35>
+  803451:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  803453:	a3 28 90 81 00       	mov    %eax,0x819028
+			return (void*)(pgnum_opt*PGSIZE);
+  803458:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80345b:	c1 e0 0c             	shl    $0xc,%eax
+  80345e:	eb 0e                	jmp    80346e <nfu+0x165>
+  803460:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  803462:	89 f8                	mov    %edi,%eax
+  803464:	3c ff                	cmp    $0xff,%al
+  803466:	74 0e                	je     803476 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  803468:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80346b:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80346e:	83 c4 14             	add    $0x14,%esp
+  803471:	5b                   	pop    %ebx
+  803472:	5e                   	pop    %esi
+  803473:	5f                   	pop    %edi
+  803474:	5d                   	pop    %ebp
+  803475:	c3                   	ret
+	pgnum = 0;
+  803476:	c7 05 28 90 81 00 00 	movl   $0x0,0x819028
+  80347d:	00 00 00 
+	return (void*)UTOP;
+  803480:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803485:	eb e7                	jmp    80346e <nfu+0x165>
+
+00803487 <lru>:
+{
+  803487:	55                   	push   %ebp
+  803488:	89 e5                	mov    %esp,%ebp
+  80348a:	57                   	push   %edi
+  80348b:	56                   	push   %esi
+  80348c:	53                   	push   %ebx
+  80348d:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803490:	8b 3d 24 90 81 00    	mov    0x819024,%edi
+	long long time_min = 9223372036854775807;
+  803496:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  80349d:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8034a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8034a9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8034b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034b5:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  8034b8:	eb 18                	jmp    8034d2 <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8034ba:	f7 d0                	not    %eax
+  8034bc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8034c1:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8034c3:	83 c2 01             	add    $0x1,%edx
+  8034c6:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  8034cc:	0f 87 fa 00 00 00    	ja     8035cc <lru+0x145>
+		++num_searched_ptes;
+  8034d2:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8034d5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8034d8:	01 d0                	add    %edx,%eax
+  8034da:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8034df:	89 c1                	mov    %eax,%ecx
+  8034e1:	c1 e9 0a             	shr    $0xa,%ecx
+  8034e4:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8034eb:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8034f1:	83 f9 01             	cmp    $0x1,%ecx
+  8034f4:	75 c4                	jne    8034ba <lru+0x33>
+  8034f6:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8034fb:	77 bd                	ja     8034ba <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8034fd:	89 c1                	mov    %eax,%ecx
+  8034ff:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803502:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803508:	0f 87 92 00 00 00    	ja     8035a0 <lru+0x119>
+  80350e:	81 f9 2c 10 83 00    	cmp    $0x83102c,%ecx
+  803514:	0f 82 86 00 00 00    	jb     8035a0 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80351a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803521:	f6 c1 01             	test   $0x1,%cl
+  803524:	74 7a                	je     8035a0 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803526:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80352d:	f6 c5 04             	test   $0x4,%ch
+  803530:	75 6e                	jne    8035a0 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803532:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803539:	f6 c5 02             	test   $0x2,%ch
+  80353c:	75 62                	jne    8035a0 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80353e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803545:	c1 e9 0c             	shr    $0xc,%ecx
+  803548:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80354b:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803551:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803555:	66 83 f9 01          	cmp    $0x1,%cx
+  803559:	77 45                	ja     8035a0 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  80355b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803562:	c1 e9 0c             	shr    $0xc,%ecx
+  803565:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803568:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80356e:	8b 59 14             	mov    0x14(%ecx),%ebx
+  803571:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803574:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  803577:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80357a:	19 df                	sbb    %ebx,%edi
+  80357c:	7c 22                	jl     8035a0 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  80357e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803585:	c1 e9 0c             	shr    $0xc,%ecx
+  803588:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80358b:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803591:	8b 59 14             	mov    0x14(%ecx),%ebx
+  803594:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803597:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  80359a:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80359d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8035a0:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8035a3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8035aa:	df 6d e0             	fildll -0x20(%ebp)
+  8035ad:	d9 05 44 62 80 00    	flds   0x806244
+  8035b3:	d9 c9                	fxch   %st(1)
+  8035b5:	df f1                	fcomip %st(1),%st
+  8035b7:	dd d8                	fstp   %st(0)
+  8035b9:	0f 82 04 ff ff ff    	jb     8034c3 <lru+0x3c>
+			pgnum = pgnum_actual;
+  8035bf:	a3 24 90 81 00       	mov    %eax,0x819024
+			return (void*)(pgnum_opt*PGSIZE);
+  8035c4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8035c7:	c1 e0 0c             	shl    $0xc,%eax
+  8035ca:	eb 06                	jmp    8035d2 <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  8035cc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8035cf:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8035d2:	83 c4 1c             	add    $0x1c,%esp
+  8035d5:	5b                   	pop    %ebx
+  8035d6:	5e                   	pop    %esi
+  8035d7:	5f                   	pop    %edi
+  8035d8:	5d                   	pop    %ebp
+  8035d9:	c3                   	ret
+
+008035da <set_page_choice_func>:
+{
+  8035da:	55                   	push   %ebp
+  8035db:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  8035dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035e0:	a3 5c 70 81 00       	mov    %eax,0x81705c
+}
+  8035e5:	5d                   	pop    %ebp
+  8035e6:	c3                   	ret
+
+008035e7 <get_page_choice>:
+{
+  8035e7:	55                   	push   %ebp
+  8035e8:	89 e5                	mov    %esp,%ebp
+  8035ea:	57                   	push   %edi
+  8035eb:	56                   	push   %esi
+  8035ec:	53                   	push   %ebx
+  8035ed:	83 ec 24             	sub    $0x24,%esp
+  8035f0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035f3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  8035f6:	57                   	push   %edi
+  8035f7:	56                   	push   %esi
+  8035f8:	ff 15 5c 70 81 00    	call   *0x81705c
+  8035fe:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803600:	83 c4 10             	add    $0x10,%esp
+  803603:	eb 25                	jmp    80362a <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  803605:	83 ec 08             	sub    $0x8,%esp
+  803608:	c1 e0 16             	shl    $0x16,%eax
+  80360b:	50                   	push   %eax
+  80360c:	6a 00                	push   $0x0
+  80360e:	e8 cc da ff ff       	call   8010df <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803613:	83 c4 10             	add    $0x10,%esp
+  803616:	85 c0                	test   %eax,%eax
+  803618:	75 43                	jne    80365d <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  80361a:	83 ec 08             	sub    $0x8,%esp
+  80361d:	57                   	push   %edi
+  80361e:	56                   	push   %esi
+  80361f:	ff 15 5c 70 81 00    	call   *0x81705c
+  803625:	89 c3                	mov    %eax,%ebx
+  803627:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80362a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80362d:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803633:	0f 86 ae 00 00 00    	jbe    8036e7 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803639:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  80363e:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803645:	81 e2 81 00 00 00    	and    $0x81,%edx
+  80364b:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  803651:	74 b2                	je     803605 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803653:	83 c0 01             	add    $0x1,%eax
+  803656:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  80365b:	75 e1                	jne    80363e <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  80365d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803660:	05 00 10 40 11       	add    $0x11401000,%eax
+  803665:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80366a:	76 1f                	jbe    80368b <get_page_choice+0xa4>
+		return (void *) UTOP;
+  80366c:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  803671:	89 d8                	mov    %ebx,%eax
+  803673:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803676:	5b                   	pop    %ebx
+  803677:	5e                   	pop    %esi
+  803678:	5f                   	pop    %edi
+  803679:	5d                   	pop    %ebp
+  80367a:	c3                   	ret
+		sys_page_split(0, pg_out);
+  80367b:	83 ec 08             	sub    $0x8,%esp
+  80367e:	53                   	push   %ebx
+  80367f:	6a 00                	push   $0x0
+  803681:	e8 59 da ff ff       	call   8010df <sys_page_split>
+  803686:	83 c4 10             	add    $0x10,%esp
+  803689:	eb 6c                	jmp    8036f7 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  80368b:	83 ec 04             	sub    $0x4,%esp
+  80368e:	68 ec 5d 80 00       	push   $0x805dec
+  803693:	68 cc 01 00 00       	push   $0x1cc
+  803698:	68 5b 5d 80 00       	push   $0x805d5b
+  80369d:	e8 c1 cd ff ff       	call   800463 <_panic>
+		panic("We tried to page out code pages\n");
+  8036a2:	83 ec 04             	sub    $0x4,%esp
+  8036a5:	68 1c 5e 80 00       	push   $0x805e1c
+  8036aa:	68 d6 01 00 00       	push   $0x1d6
+  8036af:	68 5b 5d 80 00       	push   $0x805d5b
+  8036b4:	e8 aa cd ff ff       	call   800463 <_panic>
+		panic("Invalid mapping for the va\n");
+  8036b9:	83 ec 04             	sub    $0x4,%esp
+  8036bc:	68 68 5d 80 00       	push   $0x805d68
+  8036c1:	68 da 01 00 00       	push   $0x1da
+  8036c6:	68 5b 5d 80 00       	push   $0x805d5b
+  8036cb:	e8 93 cd ff ff       	call   800463 <_panic>
+		panic("We tried to page out a shared page\n");
+  8036d0:	83 ec 04             	sub    $0x4,%esp
+  8036d3:	68 40 5e 80 00       	push   $0x805e40
+  8036d8:	68 e0 01 00 00       	push   $0x1e0
+  8036dd:	68 5b 5d 80 00       	push   $0x805d5b
+  8036e2:	e8 7c cd ff ff       	call   800463 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  8036e7:	89 de                	mov    %ebx,%esi
+  8036e9:	c1 ee 16             	shr    $0x16,%esi
+  8036ec:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8036f3:	a8 80                	test   $0x80,%al
+  8036f5:	75 84                	jne    80367b <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  8036f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036fa:	05 00 10 40 11       	add    $0x11401000,%eax
+  8036ff:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803704:	76 85                	jbe    80368b <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  803706:	89 d8                	mov    %ebx,%eax
+  803708:	e8 7e f3 ff ff       	call   802a8b <page_is_clean>
+  80370d:	84 c0                	test   %al,%al
+  80370f:	0f 85 5c ff ff ff    	jne    803671 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  803715:	81 7d e4 2c 10 83 00 	cmpl   $0x83102c,-0x1c(%ebp)
+  80371c:	76 84                	jbe    8036a2 <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  80371e:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803725:	a8 01                	test   $0x1,%al
+  803727:	74 90                	je     8036b9 <get_page_choice+0xd2>
+  803729:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80372c:	c1 e8 0c             	shr    $0xc,%eax
+  80372f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803736:	f6 c2 01             	test   $0x1,%dl
+  803739:	0f 84 7a ff ff ff    	je     8036b9 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  80373f:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  803746:	f6 c2 01             	test   $0x1,%dl
+  803749:	74 85                	je     8036d0 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  80374b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803752:	f6 c2 01             	test   $0x1,%dl
+  803755:	0f 84 75 ff ff ff    	je     8036d0 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  80375b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803762:	f6 c6 04             	test   $0x4,%dh
+  803765:	0f 85 65 ff ff ff    	jne    8036d0 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  80376b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  803772:	f6 c6 02             	test   $0x2,%dh
+  803775:	0f 85 55 ff ff ff    	jne    8036d0 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  80377b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803782:	c1 e8 0c             	shr    $0xc,%eax
+  803785:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803788:	05 00 00 00 ef       	add    $0xef000000,%eax
+  80378d:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  803791:	66 83 f8 01          	cmp    $0x1,%ax
+  803795:	0f 86 d6 fe ff ff    	jbe    803671 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  80379b:	83 ec 04             	sub    $0x4,%esp
+  80379e:	68 64 5e 80 00       	push   $0x805e64
+  8037a3:	68 e2 01 00 00       	push   $0x1e2
+  8037a8:	68 5b 5d 80 00       	push   $0x805d5b
+  8037ad:	e8 b1 cc ff ff       	call   800463 <_panic>
+
+008037b2 <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  8037b2:	55                   	push   %ebp
+  8037b3:	89 e5                	mov    %esp,%ebp
+  8037b5:	57                   	push   %edi
+  8037b6:	56                   	push   %esi
+  8037b7:	53                   	push   %ebx
+  8037b8:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  8037bb:	e8 e8 f6 ff ff       	call   802ea8 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  8037c0:	a1 40 c0 81 00       	mov    0x81c040,%eax
+  8037c5:	85 c0                	test   %eax,%eax
+  8037c7:	74 41                	je     80380a <page_share_paged_out+0x58>
+  8037c9:	83 3d 20 f9 82 00 00 	cmpl   $0x0,0x82f920
+  8037d0:	0f 84 fd 00 00 00    	je     8038d3 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  8037d6:	c7 05 00 a0 81 00 00 	movl   $0x0,0x81a000
+  8037dd:	00 00 00 
+  8037e0:	c7 05 00 b0 81 00 00 	movl   $0x0,0x81b000
+  8037e7:	00 00 00 
+  8037ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037ef:	eb 2c                	jmp    80381d <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8037f1:	83 c3 04             	add    $0x4,%ebx
+  8037f4:	39 f3                	cmp    %esi,%ebx
+  8037f6:	74 1a                	je     803812 <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  8037f8:	8b 03                	mov    (%ebx),%eax
+  8037fa:	a8 01                	test   $0x1,%al
+  8037fc:	74 f3                	je     8037f1 <page_share_paged_out+0x3f>
+  8037fe:	c1 e8 0c             	shr    $0xc,%eax
+  803801:	e8 2b f5 ff ff       	call   802d31 <page_share_slot>
+  803806:	85 c0                	test   %eax,%eax
+  803808:	79 e7                	jns    8037f1 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  80380a:	83 c4 0c             	add    $0xc,%esp
+  80380d:	5b                   	pop    %ebx
+  80380e:	5e                   	pop    %esi
+  80380f:	5f                   	pop    %edi
+  803810:	5d                   	pop    %ebp
+  803811:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  803812:	83 c7 04             	add    $0x4,%edi
+  803815:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  80381b:	74 1b                	je     803838 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  80381d:	a1 20 f9 82 00       	mov    0x82f920,%eax
+  803822:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  803825:	f6 c3 01             	test   $0x1,%bl
+  803828:	74 e8                	je     803812 <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  80382a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803830:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  803836:	eb bc                	jmp    8037f4 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803838:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80383d:	eb 11                	jmp    803850 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  80383f:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803845:	83 c3 01             	add    $0x1,%ebx
+  803848:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80384e:	77 41                	ja     803891 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  803850:	89 d8                	mov    %ebx,%eax
+  803852:	c1 e8 0a             	shr    $0xa,%eax
+  803855:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80385c:	25 81 00 00 00       	and    $0x81,%eax
+  803861:	83 f8 01             	cmp    $0x1,%eax
+  803864:	75 d9                	jne    80383f <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803866:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80386d:	25 81 00 00 00       	and    $0x81,%eax
+  803872:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803877:	75 cc                	jne    803845 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803879:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803880:	c1 e8 0c             	shr    $0xc,%eax
+  803883:	e8 a9 f4 ff ff       	call   802d31 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803888:	85 c0                	test   %eax,%eax
+  80388a:	79 b9                	jns    803845 <page_share_paged_out+0x93>
+  80388c:	e9 79 ff ff ff       	jmp    80380a <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803891:	83 3d 00 a0 81 00 00 	cmpl   $0x0,0x81a000
+  803898:	75 13                	jne    8038ad <page_share_paged_out+0xfb>
+  80389a:	83 3d 00 b0 81 00 00 	cmpl   $0x0,0x81b000
+  8038a1:	75 1d                	jne    8038c0 <page_share_paged_out+0x10e>
+	return 0;
+  8038a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038a8:	e9 5d ff ff ff       	jmp    80380a <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8038ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b2:	e8 46 f4 ff ff       	call   802cfd <page_share_send>
+  8038b7:	85 c0                	test   %eax,%eax
+  8038b9:	79 df                	jns    80389a <page_share_paged_out+0xe8>
+  8038bb:	e9 4a ff ff ff       	jmp    80380a <page_share_paged_out+0x58>
+  8038c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8038c5:	e8 33 f4 ff ff       	call   802cfd <page_share_send>
+  8038ca:	85 c0                	test   %eax,%eax
+  8038cc:	79 d5                	jns    8038a3 <page_share_paged_out+0xf1>
+  8038ce:	e9 37 ff ff ff       	jmp    80380a <page_share_paged_out+0x58>
+		return 0;
+  8038d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d8:	e9 2d ff ff ff       	jmp    80380a <page_share_paged_out+0x58>
+
+008038dd <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  8038dd:	55                   	push   %ebp
+  8038de:	89 e5                	mov    %esp,%ebp
+  8038e0:	56                   	push   %esi
+  8038e1:	53                   	push   %ebx
+  8038e2:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  8038e5:	e8 be f5 ff ff       	call   802ea8 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  8038ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  8038ef:	83 3d 40 c0 81 00 00 	cmpl   $0x0,0x81c040
+  8038f6:	0f 84 82 00 00 00    	je     80397e <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  8038fc:	83 ec 0c             	sub    $0xc,%esp
+  8038ff:	68 00 10 00 00       	push   $0x1000
+  803904:	e8 84 11 00 00       	call   804a8d <malloc>
+  803909:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  80390b:	83 c4 0c             	add    $0xc,%esp
+  80390e:	6a 14                	push   $0x14
+  803910:	6a 00                	push   $0x0
+  803912:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803915:	50                   	push   %eax
+  803916:	e8 5b d3 ff ff       	call   800c76 <memset>
+  80391b:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  80391e:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  803923:	83 ec 0c             	sub    $0xc,%esp
+  803926:	6a 07                	push   $0x7
+  803928:	6a 01                	push   $0x1
+  80392a:	53                   	push   %ebx
+  80392b:	6a 03                	push   $0x3
+  80392d:	ff 34 b5 44 c0 81 00 	push   0x81c044(,%esi,4)
+  803934:	e8 b7 19 00 00       	call   8052f0 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  803939:	8b 03                	mov    (%ebx),%eax
+  80393b:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  80393e:	8b 43 04             	mov    0x4(%ebx),%eax
+  803941:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  803944:	8b 43 08             	mov    0x8(%ebx),%eax
+  803947:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  80394a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80394d:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  803950:	8b 43 10             	mov    0x10(%ebx),%eax
+  803953:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803956:	83 c6 01             	add    $0x1,%esi
+  803959:	83 c4 20             	add    $0x20,%esp
+  80395c:	83 fe 02             	cmp    $0x2,%esi
+  80395f:	75 c2                	jne    803923 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  803961:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803964:	89 03                	mov    %eax,(%ebx)
+  803966:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803969:	89 43 04             	mov    %eax,0x4(%ebx)
+  80396c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80396f:	89 43 08             	mov    %eax,0x8(%ebx)
+  803972:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803975:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803978:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80397b:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  80397e:	89 d8                	mov    %ebx,%eax
+  803980:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803983:	5b                   	pop    %ebx
+  803984:	5e                   	pop    %esi
+  803985:	5d                   	pop    %ebp
+  803986:	c3                   	ret
+
+00803987 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803987:	55                   	push   %ebp
+  803988:	89 e5                	mov    %esp,%ebp
+  80398a:	53                   	push   %ebx
+  80398b:	83 ec 10             	sub    $0x10,%esp
+  80398e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  803991:	68 82 5d 80 00       	push   $0x805d82
+  803996:	e8 a3 cb ff ff       	call   80053e <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  80399b:	83 c4 08             	add    $0x8,%esp
+  80399e:	ff 33                	push   (%ebx)
+  8039a0:	68 98 5e 80 00       	push   $0x805e98
+  8039a5:	e8 94 cb ff ff       	call   80053e <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  8039aa:	83 c4 08             	add    $0x8,%esp
+  8039ad:	ff 73 04             	push   0x4(%ebx)
+  8039b0:	68 84 5d 80 00       	push   $0x805d84
+  8039b5:	e8 84 cb ff ff       	call   80053e <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  8039ba:	83 c4 08             	add    $0x8,%esp
+  8039bd:	ff 73 08             	push   0x8(%ebx)
+  8039c0:	68 b8 5e 80 00       	push   $0x805eb8
+  8039c5:	e8 74 cb ff ff       	call   80053e <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  8039ca:	83 c4 08             	add    $0x8,%esp
+  8039cd:	ff 73 0c             	push   0xc(%ebx)
+  8039d0:	68 dc 5e 80 00       	push   $0x805edc
+  8039d5:	e8 64 cb ff ff       	call   80053e <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  8039da:	83 c4 08             	add    $0x8,%esp
+  8039dd:	ff 73 10             	push   0x10(%ebx)
+  8039e0:	68 00 5f 80 00       	push   $0x805f00
+  8039e5:	e8 54 cb ff ff       	call   80053e <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  8039ea:	83 c4 08             	add    $0x8,%esp
+  8039ed:	ff 35 08 c0 81 00    	push   0x81c008
+  8039f3:	68 3c 5f 80 00       	push   $0x805f3c
+  8039f8:	e8 41 cb ff ff       	call   80053e <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  8039fd:	83 c4 08             	add    $0x8,%esp
+  803a00:	ff 35 04 c0 81 00    	push   0x81c004
+  803a06:	68 70 5f 80 00       	push   $0x805f70
+  803a0b:	e8 2e cb ff ff       	call   80053e <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  803a10:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  803a15:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  803a18:	8b 50 68             	mov    0x68(%eax),%edx
+  803a1b:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  803a1e:	51                   	push   %ecx
+  803a1f:	52                   	push   %edx
+  803a20:	50                   	push   %eax
+  803a21:	68 b0 5f 80 00       	push   $0x805fb0
+  803a26:	e8 13 cb ff ff       	call   80053e <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  803a2b:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  803a30:	8b 40 70             	mov    0x70(%eax),%eax
+  803a33:	83 c4 18             	add    $0x18,%esp
+  803a36:	50                   	push   %eax
+  803a37:	68 e4 5f 80 00       	push   $0x805fe4
+  803a3c:	e8 fd ca ff ff       	call   80053e <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  803a41:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  803a47:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803a4d:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  803a52:	51                   	push   %ecx
+  803a53:	52                   	push   %edx
+  803a54:	50                   	push   %eax
+  803a55:	68 14 60 80 00       	push   $0x806014
+  803a5a:	e8 df ca ff ff       	call   80053e <cprintf>
+	cprintf("\n");
+  803a5f:	83 c4 14             	add    $0x14,%esp
+  803a62:	68 82 5d 80 00       	push   $0x805d82
+  803a67:	e8 d2 ca ff ff       	call   80053e <cprintf>
+}
+  803a6c:	83 c4 10             	add    $0x10,%esp
+  803a6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a72:	c9                   	leave
+  803a73:	c3                   	ret
+
+00803a74 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  803a74:	55                   	push   %ebp
+  803a75:	89 e5                	mov    %esp,%ebp
+  803a77:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  803a7a:	e8 5e fe ff ff       	call   8038dd <get_paging_stats>
+  803a7f:	83 ec 0c             	sub    $0xc,%esp
+  803a82:	50                   	push   %eax
+  803a83:	e8 ff fe ff ff       	call   803987 <print_paging_stats>
+}
+  803a88:	83 c4 10             	add    $0x10,%esp
+  803a8b:	c9                   	leave
+  803a8c:	c3                   	ret
+
+00803a8d <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803a8d:	55                   	push   %ebp
+  803a8e:	89 e5                	mov    %esp,%ebp
+  803a90:	53                   	push   %ebx
+  803a91:	83 ec 04             	sub    $0x4,%esp
+  803a94:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803a97:	eb 13                	jmp    803aac <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803a99:	83 ec 04             	sub    $0x4,%esp
+  803a9c:	6a ff                	push   $0xffffffff
+  803a9e:	53                   	push   %ebx
+  803a9f:	68 00 f0 ff ee       	push   $0xeefff000
+  803aa4:	e8 48 da ff ff       	call   8014f1 <sys_futex_wait>
+  803aa9:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803aac:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  803ab1:	39 d8                	cmp    %ebx,%eax
+  803ab3:	74 e4                	je     803a99 <mem_pressure_wait+0xc>
+	return now;
+}
+  803ab5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ab8:	c9                   	leave
+  803ab9:	c3                   	ret
+
+00803aba <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803aba:	55                   	push   %ebp
+  803abb:	89 e5                	mov    %esp,%ebp
+  803abd:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  803ac0:	68 2c 47 80 00       	push   $0x80472c
+  803ac5:	e8 32 16 00 00       	call   8050fc <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803aca:	c7 05 20 f9 82 00 00 	movl   $0xdeadb000,0x82f920
+  803ad1:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  803ad4:	83 c4 0c             	add    $0xc,%esp
+  803ad7:	68 07 02 00 00       	push   $0x207
+  803adc:	68 00 b0 ad de       	push   $0xdeadb000
+  803ae1:	6a 00                	push   $0x0
+  803ae3:	e8 30 d5 ff ff       	call   801018 <sys_page_alloc>
+  803ae8:	83 c4 10             	add    $0x10,%esp
+  803aeb:	85 c0                	test   %eax,%eax
+  803aed:	78 0c                	js     803afb <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  803aef:	e8 b4 f3 ff ff       	call   802ea8 <find_paging_env>
+	page_ring_ready();
+  803af4:	e8 7f f2 ff ff       	call   802d78 <page_ring_ready>
+}
+  803af9:	c9                   	leave
+  803afa:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  803afb:	50                   	push   %eax
+  803afc:	68 a2 5d 80 00       	push   $0x805da2
+  803b01:	68 13 05 00 00       	push   $0x513
+  803b06:	68 5b 5d 80 00       	push   $0x805d5b
+  803b0b:	e8 53 c9 ff ff       	call   800463 <_panic>
+
+00803b10 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  803b10:	55                   	push   %ebp
+  803b11:	89 e5                	mov    %esp,%ebp
+  803b13:	57                   	push   %edi
+  803b14:	56                   	push   %esi
+  803b15:	53                   	push   %ebx
+  803b16:	83 ec 0c             	sub    $0xc,%esp
+  803b19:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  803b1c:	89 fa                	mov    %edi,%edx
+  803b1e:	c1 ea 16             	shr    $0x16,%edx
+  803b21:	a1 20 f9 82 00       	mov    0x82f920,%eax
+  803b26:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  803b29:	f6 06 01             	testb  $0x1,(%esi)
+  803b2c:	75 3e                	jne    803b6c <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803b2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  803b33:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803b37:	74 47                	je     803b80 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  803b39:	83 ec 0c             	sub    $0xc,%esp
+  803b3c:	6a 01                	push   $0x1
+  803b3e:	e8 f2 11 00 00       	call   804d35 <va_alloc>
+  803b43:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  803b45:	83 c4 10             	add    $0x10,%esp
+  803b48:	85 c0                	test   %eax,%eax
+  803b4a:	74 34                	je     803b80 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803b4c:	6a 00                	push   $0x0
+  803b4e:	68 07 02 00 00       	push   $0x207
+  803b53:	50                   	push   %eax
+  803b54:	6a 00                	push   $0x0
+  803b56:	e8 df 02 00 00       	call   803e3a <page_alloc>
+  803b5b:	83 c4 10             	add    $0x10,%esp
+  803b5e:	85 c0                	test   %eax,%eax
+  803b60:	78 28                	js     803b8a <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  803b62:	f6 06 01             	testb  $0x1,(%esi)
+  803b65:	75 38                	jne    803b9f <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803b67:	83 cb 01             	or     $0x1,%ebx
+  803b6a:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803b6c:	89 f8                	mov    %edi,%eax
+  803b6e:	c1 e8 0a             	shr    $0xa,%eax
+  803b71:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803b76:	8b 1e                	mov    (%esi),%ebx
+  803b78:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803b7e:	01 c3                	add    %eax,%ebx
+}
+  803b80:	89 d8                	mov    %ebx,%eax
+  803b82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b85:	5b                   	pop    %ebx
+  803b86:	5e                   	pop    %esi
+  803b87:	5f                   	pop    %edi
+  803b88:	5d                   	pop    %ebp
+  803b89:	c3                   	ret
+			va_free(page, 1);
+  803b8a:	83 ec 08             	sub    $0x8,%esp
+  803b8d:	6a 01                	push   $0x1
+  803b8f:	53                   	push   %ebx
+  803b90:	e8 d8 12 00 00       	call   804e6d <va_free>
+			return NULL;
+  803b95:	83 c4 10             	add    $0x10,%esp
+  803b98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b9d:	eb e1                	jmp    803b80 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  803b9f:	83 ec 08             	sub    $0x8,%esp
+  803ba2:	53                   	push   %ebx
+  803ba3:	6a 00                	push   $0x0
+  803ba5:	e8 f3 d4 ff ff       	call   80109d <sys_page_unmap>
+			va_free(page, 1);
+  803baa:	83 c4 08             	add    $0x8,%esp
+  803bad:	6a 01                	push   $0x1
+  803baf:	53                   	push   %ebx
+  803bb0:	e8 b8 12 00 00       	call   804e6d <va_free>
+  803bb5:	83 c4 10             	add    $0x10,%esp
+  803bb8:	eb b2                	jmp    803b6c <umapdir_walk+0x5c>
+
+00803bba <page_out>:
+{
+  803bba:	55                   	push   %ebp
+  803bbb:	89 e5                	mov    %esp,%ebp
+  803bbd:	57                   	push   %edi
+  803bbe:	56                   	push   %esi
+  803bbf:	53                   	push   %ebx
+  803bc0:	83 ec 5c             	sub    $0x5c,%esp
+  803bc3:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803bc6:	e8 dd f2 ff ff       	call   802ea8 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803bcb:	a1 40 c0 81 00       	mov    0x81c040,%eax
+  803bd0:	85 c0                	test   %eax,%eax
+  803bd2:	74 1e                	je     803bf2 <page_out+0x38>
+  803bd4:	83 ec 0c             	sub    $0xc,%esp
+  803bd7:	6a 00                	push   $0x0
+  803bd9:	6a 00                	push   $0x0
+  803bdb:	6a 00                	push   $0x0
+  803bdd:	6a 08                	push   $0x8
+  803bdf:	50                   	push   %eax
+  803be0:	e8 0b 17 00 00       	call   8052f0 <ipc_call>
+  803be5:	89 c3                	mov    %eax,%ebx
+  803be7:	83 c4 20             	add    $0x20,%esp
+  803bea:	85 c0                	test   %eax,%eax
+  803bec:	0f 84 ac 00 00 00    	je     803c9e <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  803bf2:	83 ec 08             	sub    $0x8,%esp
+  803bf5:	ff 75 0c             	push   0xc(%ebp)
+  803bf8:	57                   	push   %edi
+  803bf9:	e8 e9 f9 ff ff       	call   8035e7 <get_page_choice>
+  803bfe:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  803c00:	83 c4 10             	add    $0x10,%esp
+  803c03:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803c08:	0f 84 18 02 00 00    	je     803e26 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803c0e:	e8 78 ee ff ff       	call   802a8b <page_is_clean>
+  803c13:	84 c0                	test   %al,%al
+  803c15:	0f 85 8c 00 00 00    	jne    803ca7 <page_out+0xed>
+	if (pagingenv == 0)
+  803c1b:	83 3d 40 c0 81 00 00 	cmpl   $0x0,0x81c040
+  803c22:	0f 84 08 02 00 00    	je     803e30 <page_out+0x276>
+	if (page_ring_ready())
+  803c28:	e8 4b f1 ff ff       	call   802d78 <page_ring_ready>
+  803c2d:	89 c3                	mov    %eax,%ebx
+  803c2f:	85 c0                	test   %eax,%eax
+  803c31:	0f 85 89 00 00 00    	jne    803cc0 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  803c37:	83 ec 0c             	sub    $0xc,%esp
+  803c3a:	6a 05                	push   $0x5
+  803c3c:	6a 01                	push   $0x1
+  803c3e:	56                   	push   %esi
+  803c3f:	6a 01                	push   $0x1
+  803c41:	ff 35 40 c0 81 00    	push   0x81c040
+  803c47:	e8 a4 16 00 00       	call   8052f0 <ipc_call>
+  803c4c:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803c4e:	83 c4 20             	add    $0x20,%esp
+  803c51:	85 c0                	test   %eax,%eax
+  803c53:	0f 88 b8 01 00 00    	js     803e11 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803c59:	89 f0                	mov    %esi,%eax
+  803c5b:	c1 e8 0c             	shr    $0xc,%eax
+  803c5e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803c65:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803c68:	83 ec 08             	sub    $0x8,%esp
+  803c6b:	56                   	push   %esi
+  803c6c:	6a 00                	push   $0x0
+  803c6e:	e8 2a d4 ff ff       	call   80109d <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803c73:	83 c4 08             	add    $0x8,%esp
+  803c76:	6a 01                	push   $0x1
+  803c78:	56                   	push   %esi
+  803c79:	e8 92 fe ff ff       	call   803b10 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803c7e:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803c81:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803c87:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803c8a:	09 fe                	or     %edi,%esi
+  803c8c:	83 ce 01             	or     $0x1,%esi
+  803c8f:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803c91:	83 c4 10             	add    $0x10,%esp
+}
+  803c94:	89 d8                	mov    %ebx,%eax
+  803c96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c99:	5b                   	pop    %ebx
+  803c9a:	5e                   	pop    %esi
+  803c9b:	5f                   	pop    %edi
+  803c9c:	5d                   	pop    %ebp
+  803c9d:	c3                   	ret
+		num_page_reclaims++;
+  803c9e:	83 05 04 c0 81 00 01 	addl   $0x1,0x81c004
+		return 0;
+  803ca5:	eb ed                	jmp    803c94 <page_out+0xda>
+		num_page_drops++;
+  803ca7:	83 05 08 c0 81 00 01 	addl   $0x1,0x81c008
+		return sys_page_unmap(0, map_out_addr);
+  803cae:	83 ec 08             	sub    $0x8,%esp
+  803cb1:	56                   	push   %esi
+  803cb2:	6a 00                	push   $0x0
+  803cb4:	e8 e4 d3 ff ff       	call   80109d <sys_page_unmap>
+  803cb9:	89 c3                	mov    %eax,%ebx
+  803cbb:	83 c4 10             	add    $0x10,%esp
+  803cbe:	eb d4                	jmp    803c94 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803cc0:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803cc2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803cc7:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803ccc:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803ccf:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803cd1:	83 c0 08             	add    $0x8,%eax
+  803cd4:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803cd7:	b8 07 00 00 00       	mov    $0x7,%eax
+  803cdc:	e8 e5 ef ff ff       	call   802cc6 <page_ring_reserve>
+	first = ring->sq_tail;
+  803ce1:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803ce6:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803ce9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803cee:	83 ec 04             	sub    $0x4,%esp
+  803cf1:	68 00 10 00 00       	push   $0x1000
+  803cf6:	56                   	push   %esi
+  803cf7:	89 d8                	mov    %ebx,%eax
+  803cf9:	c1 e0 0c             	shl    $0xc,%eax
+  803cfc:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803d01:	50                   	push   %eax
+  803d02:	e8 06 d0 ff ff       	call   800d0d <memcpy>
+		vas[n] = va;
+  803d07:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803d0b:	89 d9                	mov    %ebx,%ecx
+  803d0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d12:	b8 01 00 00 00       	mov    $0x1,%eax
+  803d17:	e8 de ee ff ff       	call   802bfa <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803d1c:	8d 43 01             	lea    0x1(%ebx),%eax
+  803d1f:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803d22:	83 c4 10             	add    $0x10,%esp
+  803d25:	83 fb 06             	cmp    $0x6,%ebx
+  803d28:	74 62                	je     803d8c <page_out+0x1d2>
+  803d2a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803d2d:	eb 15                	jmp    803d44 <page_out+0x18a>
+			num_page_drops++;
+  803d2f:	83 05 08 c0 81 00 01 	addl   $0x1,0x81c008
+			sys_page_unmap(0, va);
+  803d36:	83 ec 08             	sub    $0x8,%esp
+  803d39:	56                   	push   %esi
+  803d3a:	6a 00                	push   $0x0
+  803d3c:	e8 5c d3 ff ff       	call   80109d <sys_page_unmap>
+  803d41:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803d44:	83 ec 08             	sub    $0x8,%esp
+  803d47:	53                   	push   %ebx
+  803d48:	57                   	push   %edi
+  803d49:	e8 99 f8 ff ff       	call   8035e7 <get_page_choice>
+  803d4e:	89 c6                	mov    %eax,%esi
+  803d50:	83 c4 10             	add    $0x10,%esp
+  803d53:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803d58:	74 32                	je     803d8c <page_out+0x1d2>
+  803d5a:	e8 2c ed ff ff       	call   802a8b <page_is_clean>
+  803d5f:	84 c0                	test   %al,%al
+  803d61:	75 cc                	jne    803d2f <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803d63:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803d66:	39 c6                	cmp    %eax,%esi
+  803d68:	72 07                	jb     803d71 <page_out+0x1b7>
+  803d6a:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803d6d:	39 c6                	cmp    %eax,%esi
+  803d6f:	72 1b                	jb     803d8c <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803d71:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d76:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803d79:	eb 03                	jmp    803d7e <page_out+0x1c4>
+  803d7b:	83 c3 01             	add    $0x1,%ebx
+  803d7e:	39 da                	cmp    %ebx,%edx
+  803d80:	0f 84 68 ff ff ff    	je     803cee <page_out+0x134>
+  803d86:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803d8a:	75 ef                	jne    803d7b <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803d8c:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803d8f:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803d92:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803d95:	e8 a6 ee ff ff       	call   802c40 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803d9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d9f:	eb 42                	jmp    803de3 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803da1:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803da5:	89 f8                	mov    %edi,%eax
+  803da7:	c1 e8 0c             	shr    $0xc,%eax
+  803daa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803db1:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803db4:	83 ec 08             	sub    $0x8,%esp
+  803db7:	57                   	push   %edi
+  803db8:	6a 00                	push   $0x0
+  803dba:	e8 de d2 ff ff       	call   80109d <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803dbf:	83 c4 08             	add    $0x8,%esp
+  803dc2:	6a 01                	push   $0x1
+  803dc4:	57                   	push   %edi
+  803dc5:	e8 46 fd ff ff       	call   803b10 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803dca:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803dcd:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803dd3:	c1 e6 0c             	shl    $0xc,%esi
+  803dd6:	09 d6                	or     %edx,%esi
+  803dd8:	83 ce 01             	or     $0x1,%esi
+  803ddb:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803ddd:	83 c3 01             	add    $0x1,%ebx
+  803de0:	83 c4 10             	add    $0x10,%esp
+  803de3:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803de6:	39 c3                	cmp    %eax,%ebx
+  803de8:	74 1d                	je     803e07 <page_out+0x24d>
+		if (res[i] < 0)
+  803dea:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803dee:	85 f6                	test   %esi,%esi
+  803df0:	79 af                	jns    803da1 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803df2:	56                   	push   %esi
+  803df3:	68 44 60 80 00       	push   $0x806044
+  803df8:	68 d1 02 00 00       	push   $0x2d1
+  803dfd:	68 5b 5d 80 00       	push   $0x805d5b
+  803e02:	e8 5c c6 ff ff       	call   800463 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803e07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e0c:	e9 83 fe ff ff       	jmp    803c94 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803e11:	50                   	push   %eax
+  803e12:	68 44 60 80 00       	push   $0x806044
+  803e17:	68 0a 03 00 00       	push   $0x30a
+  803e1c:	68 5b 5d 80 00       	push   $0x805d5b
+  803e21:	e8 3d c6 ff ff       	call   800463 <_panic>
+		return -E_NO_MEM;
+  803e26:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803e2b:	e9 64 fe ff ff       	jmp    803c94 <page_out+0xda>
+		return -E_PAGING;
+  803e30:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803e35:	e9 5a fe ff ff       	jmp    803c94 <page_out+0xda>
+
+00803e3a <page_alloc>:
+{
+  803e3a:	55                   	push   %ebp
+  803e3b:	89 e5                	mov    %esp,%ebp
+  803e3d:	57                   	push   %edi
+  803e3e:	56                   	push   %esi
+  803e3f:	53                   	push   %ebx
+  803e40:	83 ec 0c             	sub    $0xc,%esp
+  803e43:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803e46:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803e49:	83 3d 20 f9 82 00 00 	cmpl   $0x0,0x82f920
+  803e50:	74 34                	je     803e86 <page_alloc+0x4c>
+	if (check_mte)
+  803e52:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803e56:	75 35                	jne    803e8d <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803e58:	83 ec 04             	sub    $0x4,%esp
+  803e5b:	ff 75 10             	push   0x10(%ebp)
+  803e5e:	56                   	push   %esi
+  803e5f:	57                   	push   %edi
+  803e60:	e8 b3 d1 ff ff       	call   801018 <sys_page_alloc>
+  803e65:	89 c3                	mov    %eax,%ebx
+  803e67:	83 c4 10             	add    $0x10,%esp
+  803e6a:	85 c0                	test   %eax,%eax
+  803e6c:	79 52                	jns    803ec0 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803e6e:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803e71:	75 52                	jne    803ec5 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803e73:	83 ec 08             	sub    $0x8,%esp
+  803e76:	56                   	push   %esi
+  803e77:	57                   	push   %edi
+  803e78:	e8 3d fd ff ff       	call   803bba <page_out>
+  803e7d:	83 c4 10             	add    $0x10,%esp
+  803e80:	85 c0                	test   %eax,%eax
+  803e82:	79 d4                	jns    803e58 <page_alloc+0x1e>
+  803e84:	eb 3f                	jmp    803ec5 <page_alloc+0x8b>
+		init_map_dir();
+  803e86:	e8 2f fc ff ff       	call   803aba <init_map_dir>
+  803e8b:	eb c5                	jmp    803e52 <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803e8d:	83 ec 08             	sub    $0x8,%esp
+  803e90:	6a 00                	push   $0x0
+  803e92:	56                   	push   %esi
+  803e93:	e8 78 fc ff ff       	call   803b10 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803e98:	83 c4 10             	add    $0x10,%esp
+  803e9b:	85 c0                	test   %eax,%eax
+  803e9d:	74 b9                	je     803e58 <page_alloc+0x1e>
+  803e9f:	8b 10                	mov    (%eax),%edx
+  803ea1:	f6 c2 01             	test   $0x1,%dl
+  803ea4:	74 b2                	je     803e58 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803ea6:	83 ec 08             	sub    $0x8,%esp
+  803ea9:	56                   	push   %esi
+  803eaa:	52                   	push   %edx
+  803eab:	50                   	push   %eax
+  803eac:	68 68 60 80 00       	push   $0x806068
+  803eb1:	68 34 03 00 00       	push   $0x334
+  803eb6:	68 5b 5d 80 00       	push   $0x805d5b
+  803ebb:	e8 a3 c5 ff ff       	call   800463 <_panic>
+	return 0;
+  803ec0:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803ec5:	89 d8                	mov    %ebx,%eax
+  803ec7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803eca:	5b                   	pop    %ebx
+  803ecb:	5e                   	pop    %esi
+  803ecc:	5f                   	pop    %edi
+  803ecd:	5d                   	pop    %ebp
+  803ece:	c3                   	ret
+
+00803ecf <page_adopt>:
+{
+  803ecf:	55                   	push   %ebp
+  803ed0:	89 e5                	mov    %esp,%ebp
+  803ed2:	56                   	push   %esi
+  803ed3:	53                   	push   %ebx
+  803ed4:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803ed6:	c1 e8 16             	shr    $0x16,%eax
+  803ed9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803ee0:	25 81 00 00 00       	and    $0x81,%eax
+  803ee5:	83 f8 01             	cmp    $0x1,%eax
+  803ee8:	75 53                	jne    803f3d <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803eea:	89 d8                	mov    %ebx,%eax
+  803eec:	c1 e8 0c             	shr    $0xc,%eax
+  803eef:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803ef6:	89 f2                	mov    %esi,%edx
+  803ef8:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803efe:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803f03:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803f09:	75 37                	jne    803f42 <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803f0b:	83 ec 08             	sub    $0x8,%esp
+  803f0e:	6a 01                	push   $0x1
+  803f10:	53                   	push   %ebx
+  803f11:	e8 fa fb ff ff       	call   803b10 <umapdir_walk>
+  803f16:	83 c4 10             	add    $0x10,%esp
+  803f19:	85 c0                	test   %eax,%eax
+  803f1b:	74 2c                	je     803f49 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803f1d:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803f23:	83 ce 01             	or     $0x1,%esi
+  803f26:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803f28:	83 ec 08             	sub    $0x8,%esp
+  803f2b:	53                   	push   %ebx
+  803f2c:	6a 00                	push   $0x0
+  803f2e:	e8 6a d1 ff ff       	call   80109d <sys_page_unmap>
+	return 1;
+  803f33:	83 c4 10             	add    $0x10,%esp
+  803f36:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f3b:	eb 05                	jmp    803f42 <page_adopt+0x73>
+		return 0;
+  803f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f42:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f45:	5b                   	pop    %ebx
+  803f46:	5e                   	pop    %esi
+  803f47:	5d                   	pop    %ebp
+  803f48:	c3                   	ret
+		return -E_NO_MEM;
+  803f49:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803f4e:	eb f2                	jmp    803f42 <page_adopt+0x73>
+
+00803f50 <page_forget>:
+{
+  803f50:	55                   	push   %ebp
+  803f51:	89 e5                	mov    %esp,%ebp
+  803f53:	53                   	push   %ebx
+  803f54:	83 ec 04             	sub    $0x4,%esp
+  803f57:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803f59:	e8 4a ef ff ff       	call   802ea8 <find_paging_env>
+	if (pagingenv == 0)
+  803f5e:	83 3d 40 c0 81 00 00 	cmpl   $0x0,0x81c040
+  803f65:	74 39                	je     803fa0 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803f67:	89 d8                	mov    %ebx,%eax
+  803f69:	c1 e8 16             	shr    $0x16,%eax
+  803f6c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803f73:	25 81 00 00 00       	and    $0x81,%eax
+  803f78:	83 f8 01             	cmp    $0x1,%eax
+  803f7b:	74 28                	je     803fa5 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803f7d:	83 3d 20 f9 82 00 00 	cmpl   $0x0,0x82f920
+  803f84:	74 1a                	je     803fa0 <page_forget+0x50>
+  803f86:	83 ec 08             	sub    $0x8,%esp
+  803f89:	6a 00                	push   $0x0
+  803f8b:	53                   	push   %ebx
+  803f8c:	e8 7f fb ff ff       	call   803b10 <umapdir_walk>
+  803f91:	89 c3                	mov    %eax,%ebx
+  803f93:	83 c4 10             	add    $0x10,%esp
+  803f96:	85 c0                	test   %eax,%eax
+  803f98:	74 06                	je     803fa0 <page_forget+0x50>
+  803f9a:	8b 00                	mov    (%eax),%eax
+  803f9c:	a8 01                	test   $0x1,%al
+  803f9e:	75 2b                	jne    803fcb <page_forget+0x7b>
+}
+  803fa0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803fa3:	c9                   	leave
+  803fa4:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803fa5:	89 d8                	mov    %ebx,%eax
+  803fa7:	c1 e8 0c             	shr    $0xc,%eax
+  803faa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803fb1:	89 c2                	mov    %eax,%edx
+  803fb3:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803fb9:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803fbf:	75 bc                	jne    803f7d <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803fc1:	c1 e8 0c             	shr    $0xc,%eax
+  803fc4:	e8 5c ee ff ff       	call   802e25 <page_remove_slot>
+		return;
+  803fc9:	eb d5                	jmp    803fa0 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803fcb:	c1 e8 0c             	shr    $0xc,%eax
+  803fce:	e8 52 ee ff ff       	call   802e25 <page_remove_slot>
+	*mte = 0;
+  803fd3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803fd9:	eb c5                	jmp    803fa0 <page_forget+0x50>
+
+00803fdb <page_unmap>:
+{
+  803fdb:	55                   	push   %ebp
+  803fdc:	89 e5                	mov    %esp,%ebp
+  803fde:	57                   	push   %edi
+  803fdf:	56                   	push   %esi
+  803fe0:	53                   	push   %ebx
+  803fe1:	83 ec 0c             	sub    $0xc,%esp
+  803fe4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803fe7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803fea:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  803fef:	8b 40 48             	mov    0x48(%eax),%eax
+  803ff2:	85 db                	test   %ebx,%ebx
+  803ff4:	0f 8e b4 00 00 00    	jle    8040ae <page_unmap+0xd3>
+  803ffa:	39 d8                	cmp    %ebx,%eax
+  803ffc:	0f 84 ac 00 00 00    	je     8040ae <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  804002:	83 ec 08             	sub    $0x8,%esp
+  804005:	57                   	push   %edi
+  804006:	53                   	push   %ebx
+  804007:	e8 91 d0 ff ff       	call   80109d <sys_page_unmap>
+  80400c:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  80400e:	e8 95 ee ff ff       	call   802ea8 <find_paging_env>
+	if (pagingenv == 0)
+  804013:	83 c4 10             	add    $0x10,%esp
+  804016:	83 3d 40 c0 81 00 00 	cmpl   $0x0,0x81c040
+  80401d:	0f 84 a1 00 00 00    	je     8040c4 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804023:	83 ec 0c             	sub    $0xc,%esp
+  804026:	6a 05                	push   $0x5
+  804028:	68 00 00 40 00       	push   $0x400000
+  80402d:	6a 00                	push   $0x0
+  80402f:	68 00 b0 ad de       	push   $0xdeadb000
+  804034:	53                   	push   %ebx
+  804035:	e8 21 d0 ff ff       	call   80105b <sys_page_map>
+  80403a:	83 c4 20             	add    $0x20,%esp
+  80403d:	85 c0                	test   %eax,%eax
+  80403f:	0f 88 89 00 00 00    	js     8040ce <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  804045:	89 f8                	mov    %edi,%eax
+  804047:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  80404a:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  804051:	a8 01                	test   $0x1,%al
+  804053:	74 6f                	je     8040c4 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804055:	83 ec 0c             	sub    $0xc,%esp
+  804058:	6a 05                	push   $0x5
+  80405a:	68 00 00 40 00       	push   $0x400000
+  80405f:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  804061:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804066:	50                   	push   %eax
+  804067:	53                   	push   %ebx
+  804068:	e8 ee cf ff ff       	call   80105b <sys_page_map>
+  80406d:	83 c4 20             	add    $0x20,%esp
+  804070:	85 c0                	test   %eax,%eax
+  804072:	78 6f                	js     8040e3 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  804074:	c1 ef 0c             	shr    $0xc,%edi
+  804077:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  80407d:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  804084:	01 
+  804085:	74 3d                	je     8040c4 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  804087:	83 ec 08             	sub    $0x8,%esp
+  80408a:	68 00 00 40 00       	push   $0x400000
+  80408f:	6a 00                	push   $0x0
+  804091:	e8 07 d0 ff ff       	call   80109d <sys_page_unmap>
+  804096:	83 c4 10             	add    $0x10,%esp
+  804099:	85 c0                	test   %eax,%eax
+  80409b:	78 5b                	js     8040f8 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  80409d:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  8040a4:	c1 e8 0c             	shr    $0xc,%eax
+  8040a7:	e8 79 ed ff ff       	call   802e25 <page_remove_slot>
+	return r;
+  8040ac:	eb 16                	jmp    8040c4 <page_unmap+0xe9>
+		page_forget(va);
+  8040ae:	89 f8                	mov    %edi,%eax
+  8040b0:	e8 9b fe ff ff       	call   803f50 <page_forget>
+		return sys_page_unmap(envid, va);
+  8040b5:	83 ec 08             	sub    $0x8,%esp
+  8040b8:	57                   	push   %edi
+  8040b9:	53                   	push   %ebx
+  8040ba:	e8 de cf ff ff       	call   80109d <sys_page_unmap>
+  8040bf:	89 c6                	mov    %eax,%esi
+  8040c1:	83 c4 10             	add    $0x10,%esp
+}
+  8040c4:	89 f0                	mov    %esi,%eax
+  8040c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040c9:	5b                   	pop    %ebx
+  8040ca:	5e                   	pop    %esi
+  8040cb:	5f                   	pop    %edi
+  8040cc:	5d                   	pop    %ebp
+  8040cd:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  8040ce:	50                   	push   %eax
+  8040cf:	68 a4 60 80 00       	push   $0x8060a4
+  8040d4:	68 e4 03 00 00       	push   $0x3e4
+  8040d9:	68 5b 5d 80 00       	push   $0x805d5b
+  8040de:	e8 80 c3 ff ff       	call   800463 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  8040e3:	50                   	push   %eax
+  8040e4:	68 d0 60 80 00       	push   $0x8060d0
+  8040e9:	68 ea 03 00 00       	push   $0x3ea
+  8040ee:	68 5b 5d 80 00       	push   $0x805d5b
+  8040f3:	e8 6b c3 ff ff       	call   800463 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  8040f8:	50                   	push   %eax
+  8040f9:	68 fc 60 80 00       	push   $0x8060fc
+  8040fe:	68 ef 03 00 00       	push   $0x3ef
+  804103:	68 5b 5d 80 00       	push   $0x805d5b
+  804108:	e8 56 c3 ff ff       	call   800463 <_panic>
+
+0080410d <page_unmap_range>:
+{
+  80410d:	55                   	push   %ebp
+  80410e:	89 e5                	mov    %esp,%ebp
+  804110:	57                   	push   %edi
+  804111:	56                   	push   %esi
+  804112:	53                   	push   %ebx
+  804113:	83 ec 0c             	sub    $0xc,%esp
+  804116:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  804119:	e8 8a ed ff ff       	call   802ea8 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  80411e:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  804123:	8b 40 48             	mov    0x48(%eax),%eax
+  804126:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80412a:	7e 38                	jle    804164 <page_unmap_range+0x57>
+  80412c:	3b 45 08             	cmp    0x8(%ebp),%eax
+  80412f:	74 33                	je     804164 <page_unmap_range+0x57>
+  804131:	83 3d 40 c0 81 00 00 	cmpl   $0x0,0x81c040
+  804138:	74 2a                	je     804164 <page_unmap_range+0x57>
+  80413a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  80413d:	be 00 00 00 00       	mov    $0x0,%esi
+  804142:	39 fe                	cmp    %edi,%esi
+  804144:	74 56                	je     80419c <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  804146:	83 ec 08             	sub    $0x8,%esp
+  804149:	53                   	push   %ebx
+  80414a:	ff 75 08             	push   0x8(%ebp)
+  80414d:	e8 89 fe ff ff       	call   803fdb <page_unmap>
+  804152:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  804158:	83 c4 10             	add    $0x10,%esp
+  80415b:	85 c0                	test   %eax,%eax
+  80415d:	78 35                	js     804194 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  80415f:	83 c6 01             	add    $0x1,%esi
+  804162:	eb de                	jmp    804142 <page_unmap_range+0x35>
+  804164:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  804167:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80416c:	eb 10                	jmp    80417e <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  80416e:	89 f0                	mov    %esi,%eax
+  804170:	e8 db fd ff ff       	call   803f50 <page_forget>
+		for (i = 0; i < npages; i++)
+  804175:	83 c3 01             	add    $0x1,%ebx
+  804178:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80417e:	39 fb                	cmp    %edi,%ebx
+  804180:	75 ec                	jne    80416e <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  804182:	83 ec 04             	sub    $0x4,%esp
+  804185:	57                   	push   %edi
+  804186:	ff 75 0c             	push   0xc(%ebp)
+  804189:	ff 75 08             	push   0x8(%ebp)
+  80418c:	e8 20 d0 ff ff       	call   8011b1 <sys_page_unmap_range>
+  804191:	83 c4 10             	add    $0x10,%esp
+}
+  804194:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804197:	5b                   	pop    %ebx
+  804198:	5e                   	pop    %esi
+  804199:	5f                   	pop    %edi
+  80419a:	5d                   	pop    %ebp
+  80419b:	c3                   	ret
+	return 0;
+  80419c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041a1:	eb f1                	jmp    804194 <page_unmap_range+0x87>
+
+008041a3 <page_alloc_range>:
+{
+  8041a3:	55                   	push   %ebp
+  8041a4:	89 e5                	mov    %esp,%ebp
+  8041a6:	57                   	push   %edi
+  8041a7:	56                   	push   %esi
+  8041a8:	53                   	push   %ebx
+  8041a9:	83 ec 1c             	sub    $0x1c,%esp
+  8041ac:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8041af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  8041b2:	83 3d 20 f9 82 00 00 	cmpl   $0x0,0x82f920
+  8041b9:	74 14                	je     8041cf <page_alloc_range+0x2c>
+	if (check_mte)
+  8041bb:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8041bf:	74 66                	je     804227 <page_alloc_range+0x84>
+  8041c1:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  8041c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c8:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  8041cb:	89 c7                	mov    %eax,%edi
+  8041cd:	eb 10                	jmp    8041df <page_alloc_range+0x3c>
+		init_map_dir();
+  8041cf:	e8 e6 f8 ff ff       	call   803aba <init_map_dir>
+  8041d4:	eb e5                	jmp    8041bb <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  8041d6:	83 c7 01             	add    $0x1,%edi
+  8041d9:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8041df:	39 df                	cmp    %ebx,%edi
+  8041e1:	74 38                	je     80421b <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  8041e3:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8041e6:	83 ec 08             	sub    $0x8,%esp
+  8041e9:	6a 00                	push   $0x0
+  8041eb:	56                   	push   %esi
+  8041ec:	e8 1f f9 ff ff       	call   803b10 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  8041f1:	83 c4 10             	add    $0x10,%esp
+  8041f4:	85 c0                	test   %eax,%eax
+  8041f6:	74 de                	je     8041d6 <page_alloc_range+0x33>
+  8041f8:	8b 10                	mov    (%eax),%edx
+  8041fa:	f6 c2 01             	test   $0x1,%dl
+  8041fd:	74 d7                	je     8041d6 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  8041ff:	83 ec 08             	sub    $0x8,%esp
+  804202:	ff 75 e4             	push   -0x1c(%ebp)
+  804205:	52                   	push   %edx
+  804206:	50                   	push   %eax
+  804207:	68 68 60 80 00       	push   $0x806068
+  80420c:	68 0b 04 00 00       	push   $0x40b
+  804211:	68 5b 5d 80 00       	push   $0x805d5b
+  804216:	e8 48 c2 ff ff       	call   800463 <_panic>
+  80421b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80421e:	eb 07                	jmp    804227 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  804220:	c1 e0 0c             	shl    $0xc,%eax
+  804223:	01 c7                	add    %eax,%edi
+			npages -= r;
+  804225:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  804227:	85 db                	test   %ebx,%ebx
+  804229:	74 30                	je     80425b <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  80422b:	ff 75 14             	push   0x14(%ebp)
+  80422e:	53                   	push   %ebx
+  80422f:	57                   	push   %edi
+  804230:	ff 75 08             	push   0x8(%ebp)
+  804233:	e8 0b cf ff ff       	call   801143 <sys_page_alloc_range>
+  804238:	89 c6                	mov    %eax,%esi
+  80423a:	83 c4 10             	add    $0x10,%esp
+  80423d:	85 c0                	test   %eax,%eax
+  80423f:	7f df                	jg     804220 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  804241:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  804244:	75 1a                	jne    804260 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  804246:	83 ec 08             	sub    $0x8,%esp
+  804249:	57                   	push   %edi
+  80424a:	ff 75 08             	push   0x8(%ebp)
+  80424d:	e8 68 f9 ff ff       	call   803bba <page_out>
+  804252:	83 c4 10             	add    $0x10,%esp
+  804255:	85 c0                	test   %eax,%eax
+  804257:	79 ce                	jns    804227 <page_alloc_range+0x84>
+  804259:	eb 05                	jmp    804260 <page_alloc_range+0xbd>
+	return 0;
+  80425b:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  804260:	89 f0                	mov    %esi,%eax
+  804262:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804265:	5b                   	pop    %ebx
+  804266:	5e                   	pop    %esi
+  804267:	5f                   	pop    %edi
+  804268:	5d                   	pop    %ebp
+  804269:	c3                   	ret
+
+0080426a <page_in>:
+{
+  80426a:	55                   	push   %ebp
+  80426b:	89 e5                	mov    %esp,%ebp
+  80426d:	57                   	push   %edi
+  80426e:	56                   	push   %esi
+  80426f:	53                   	push   %ebx
+  804270:	83 ec 3c             	sub    $0x3c,%esp
+  804273:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  804276:	e8 2d ec ff ff       	call   802ea8 <find_paging_env>
+	if (pagingenv == 0)
+  80427b:	83 3d 40 c0 81 00 00 	cmpl   $0x0,0x81c040
+  804282:	0f 84 09 02 00 00    	je     804491 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  804288:	83 ec 08             	sub    $0x8,%esp
+  80428b:	6a 00                	push   $0x0
+  80428d:	56                   	push   %esi
+  80428e:	e8 7d f8 ff ff       	call   803b10 <umapdir_walk>
+  804293:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  804295:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80429b:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  80429e:	83 c4 10             	add    $0x10,%esp
+  8042a1:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8042a5:	74 0d                	je     8042b4 <page_in+0x4a>
+  8042a7:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  8042ac:	8b 40 48             	mov    0x48(%eax),%eax
+  8042af:	3b 45 08             	cmp    0x8(%ebp),%eax
+  8042b2:	75 06                	jne    8042ba <page_in+0x50>
+  8042b4:	8b 03                	mov    (%ebx),%eax
+  8042b6:	a8 02                	test   $0x2,%al
+  8042b8:	75 63                	jne    80431d <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  8042ba:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  8042bc:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  8042be:	89 f0                	mov    %esi,%eax
+  8042c0:	25 06 0e 00 00       	and    $0xe06,%eax
+  8042c5:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  8042c8:	50                   	push   %eax
+  8042c9:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  8042cc:	57                   	push   %edi
+  8042cd:	ff 75 08             	push   0x8(%ebp)
+  8042d0:	e8 65 fb ff ff       	call   803e3a <page_alloc>
+  8042d5:	83 c4 10             	add    $0x10,%esp
+  8042d8:	85 c0                	test   %eax,%eax
+  8042da:	78 39                	js     804315 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  8042dc:	89 f0                	mov    %esi,%eax
+  8042de:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8042e1:	83 ec 0c             	sub    $0xc,%esp
+  8042e4:	6a 07                	push   $0x7
+  8042e6:	6a 01                	push   $0x1
+  8042e8:	57                   	push   %edi
+  8042e9:	c1 e0 04             	shl    $0x4,%eax
+  8042ec:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8042ed:	c1 ee 1c             	shr    $0x1c,%esi
+  8042f0:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8042f3:	ff 34 b5 44 c0 81 00 	push   0x81c044(,%esi,4)
+  8042fa:	e8 f1 0f 00 00       	call   8052f0 <ipc_call>
+  8042ff:	83 c4 20             	add    $0x20,%esp
+  804302:	85 c0                	test   %eax,%eax
+  804304:	0f 88 72 01 00 00    	js     80447c <page_in+0x212>
+	*mte = 0;
+  80430a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  804310:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804315:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804318:	5b                   	pop    %ebx
+  804319:	5e                   	pop    %esi
+  80431a:	5f                   	pop    %edi
+  80431b:	5d                   	pop    %ebp
+  80431c:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  80431d:	25 06 0e 00 00       	and    $0xe06,%eax
+  804322:	83 c8 01             	or     $0x1,%eax
+  804325:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  804328:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  80432b:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80432e:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  804334:	be 01 00 00 00       	mov    $0x1,%esi
+  804339:	eb 46                	jmp    804381 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  80433b:	83 ec 08             	sub    $0x8,%esp
+  80433e:	6a 00                	push   $0x0
+  804340:	51                   	push   %ecx
+  804341:	e8 ca f7 ff ff       	call   803b10 <umapdir_walk>
+  804346:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  80434a:	83 c4 10             	add    $0x10,%esp
+  80434d:	85 c0                	test   %eax,%eax
+  80434f:	74 66                	je     8043b7 <page_in+0x14d>
+  804351:	8b 00                	mov    (%eax),%eax
+  804353:	a8 01                	test   $0x1,%al
+  804355:	74 60                	je     8043b7 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  804357:	89 c2                	mov    %eax,%edx
+  804359:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  80435f:	83 ca 01             	or     $0x1,%edx
+  804362:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  804365:	75 50                	jne    8043b7 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  804367:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80436d:	c1 e8 1c             	shr    $0x1c,%eax
+  804370:	8b 13                	mov    (%ebx),%edx
+  804372:	c1 ea 1c             	shr    $0x1c,%edx
+  804375:	39 d0                	cmp    %edx,%eax
+  804377:	75 3e                	jne    8043b7 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804379:	83 c6 01             	add    $0x1,%esi
+  80437c:	83 fe 08             	cmp    $0x8,%esi
+  80437f:	74 3f                	je     8043c0 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  804381:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  804383:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  804389:	77 2c                	ja     8043b7 <page_in+0x14d>
+  80438b:	89 f8                	mov    %edi,%eax
+  80438d:	c1 e8 16             	shr    $0x16,%eax
+  804390:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  804397:	f6 c2 01             	test   $0x1,%dl
+  80439a:	74 9f                	je     80433b <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  80439c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8043a3:	a8 80                	test   $0x80,%al
+  8043a5:	75 10                	jne    8043b7 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  8043a7:	89 f8                	mov    %edi,%eax
+  8043a9:	c1 e8 0c             	shr    $0xc,%eax
+  8043ac:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8043b3:	a8 01                	test   $0x1,%al
+  8043b5:	74 84                	je     80433b <page_in+0xd1>
+	if (n == 1)
+  8043b7:	83 fe 01             	cmp    $0x1,%esi
+  8043ba:	0f 84 fa fe ff ff    	je     8042ba <page_in+0x50>
+	req.nslots = n;
+  8043c0:	89 35 00 90 81 00    	mov    %esi,0x819000
+	for (i = 0; i < n; i++)
+  8043c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043cb:	eb 13                	jmp    8043e0 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  8043cd:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  8043d1:	8b 12                	mov    (%edx),%edx
+  8043d3:	c1 ea 0c             	shr    $0xc,%edx
+  8043d6:	89 14 85 04 90 81 00 	mov    %edx,0x819004(,%eax,4)
+	for (i = 0; i < n; i++)
+  8043dd:	83 c0 01             	add    $0x1,%eax
+  8043e0:	39 c6                	cmp    %eax,%esi
+  8043e2:	75 e9                	jne    8043cd <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  8043e4:	83 ec 0c             	sub    $0xc,%esp
+  8043e7:	6a 00                	push   $0x0
+  8043e9:	ff 75 c0             	push   -0x40(%ebp)
+  8043ec:	56                   	push   %esi
+  8043ed:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  8043f0:	57                   	push   %edi
+  8043f1:	6a 00                	push   $0x0
+  8043f3:	e8 ab fd ff ff       	call   8041a3 <page_alloc_range>
+  8043f8:	83 c4 20             	add    $0x20,%esp
+  8043fb:	85 c0                	test   %eax,%eax
+  8043fd:	78 6e                	js     80446d <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  8043ff:	83 ec 04             	sub    $0x4,%esp
+  804402:	6a 24                	push   $0x24
+  804404:	68 00 90 81 00       	push   $0x819000
+  804409:	57                   	push   %edi
+  80440a:	e8 9c c8 ff ff       	call   800cab <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  80440f:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  804416:	56                   	push   %esi
+  804417:	57                   	push   %edi
+  804418:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  80441a:	0f b7 05 06 90 81 00 	movzwl 0x819006,%eax
+  804421:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804424:	ff 34 85 44 c0 81 00 	push   0x81c044(,%eax,4)
+  80442b:	e8 c0 0e 00 00       	call   8052f0 <ipc_call>
+  804430:	83 c4 20             	add    $0x20,%esp
+  804433:	85 c0                	test   %eax,%eax
+  804435:	78 08                	js     80443f <page_in+0x1d5>
+  804437:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80443a:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  80443d:	eb 20                	jmp    80445f <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  80443f:	50                   	push   %eax
+  804440:	68 28 61 80 00       	push   $0x806128
+  804445:	68 59 02 00 00       	push   $0x259
+  80444a:	68 5b 5d 80 00       	push   $0x805d5b
+  80444f:	e8 0f c0 ff ff       	call   800463 <_panic>
+		*mtes[i] = 0;
+  804454:	8b 10                	mov    (%eax),%edx
+  804456:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  80445c:	83 c0 04             	add    $0x4,%eax
+  80445f:	39 c8                	cmp    %ecx,%eax
+  804461:	75 f1                	jne    804454 <page_in+0x1ea>
+	return n;
+  804463:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  804465:	85 f6                	test   %esi,%esi
+  804467:	0f 84 4d fe ff ff    	je     8042ba <page_in+0x50>
+		return r < 0 ? r : 0;
+  80446d:	85 c0                	test   %eax,%eax
+  80446f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804474:	0f 4f c2             	cmovg  %edx,%eax
+  804477:	e9 99 fe ff ff       	jmp    804315 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  80447c:	50                   	push   %eax
+  80447d:	68 60 61 80 00       	push   $0x806160
+  804482:	68 9a 02 00 00       	push   $0x29a
+  804487:	68 5b 5d 80 00       	push   $0x805d5b
+  80448c:	e8 d2 bf ff ff       	call   800463 <_panic>
+		return -E_PAGING;
+  804491:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804496:	e9 7a fe ff ff       	jmp    804315 <page_in+0xab>
+
+0080449b <page_map>:
+{
+  80449b:	55                   	push   %ebp
+  80449c:	89 e5                	mov    %esp,%ebp
+  80449e:	57                   	push   %edi
+  80449f:	56                   	push   %esi
+  8044a0:	53                   	push   %ebx
+  8044a1:	83 ec 1c             	sub    $0x1c,%esp
+  8044a4:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8044a7:	83 ec 0c             	sub    $0xc,%esp
+  8044aa:	ff 75 18             	push   0x18(%ebp)
+  8044ad:	ff 75 14             	push   0x14(%ebp)
+  8044b0:	ff 75 10             	push   0x10(%ebp)
+  8044b3:	ff 75 0c             	push   0xc(%ebp)
+  8044b6:	56                   	push   %esi
+  8044b7:	e8 9f cb ff ff       	call   80105b <sys_page_map>
+  8044bc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8044bf:	83 c4 20             	add    $0x20,%esp
+  8044c2:	85 c0                	test   %eax,%eax
+  8044c4:	0f 89 a9 01 00 00    	jns    804673 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  8044ca:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  8044ce:	74 5f                	je     80452f <page_map+0x94>
+		if (r != -E_INVAL)
+  8044d0:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  8044d4:	0f 85 a0 01 00 00    	jne    80467a <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8044da:	85 f6                	test   %esi,%esi
+  8044dc:	74 70                	je     80454e <page_map+0xb3>
+  8044de:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  8044e3:	8b 40 48             	mov    0x48(%eax),%eax
+  8044e6:	39 f0                	cmp    %esi,%eax
+  8044e8:	74 64                	je     80454e <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8044ea:	83 ec 0c             	sub    $0xc,%esp
+  8044ed:	6a 05                	push   $0x5
+  8044ef:	68 00 00 40 00       	push   $0x400000
+  8044f4:	6a 00                	push   $0x0
+  8044f6:	68 00 b0 ad de       	push   $0xdeadb000
+  8044fb:	56                   	push   %esi
+  8044fc:	e8 5a cb ff ff       	call   80105b <sys_page_map>
+  804501:	89 c3                	mov    %eax,%ebx
+  804503:	83 c4 20             	add    $0x20,%esp
+  804506:	85 c0                	test   %eax,%eax
+  804508:	79 6a                	jns    804574 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  80450a:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80450d:	75 50                	jne    80455f <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  80450f:	83 ec 08             	sub    $0x8,%esp
+  804512:	68 00 00 40 00       	push   $0x400000
+  804517:	6a fc                	push   $0xfffffffc
+  804519:	e8 9c f6 ff ff       	call   803bba <page_out>
+  80451e:	83 c4 10             	add    $0x10,%esp
+  804521:	85 c0                	test   %eax,%eax
+  804523:	79 c5                	jns    8044ea <page_map+0x4f>
+}
+  804525:	89 d8                	mov    %ebx,%eax
+  804527:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80452a:	5b                   	pop    %ebx
+  80452b:	5e                   	pop    %esi
+  80452c:	5f                   	pop    %edi
+  80452d:	5d                   	pop    %ebp
+  80452e:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  80452f:	83 ec 08             	sub    $0x8,%esp
+  804532:	68 00 00 40 00       	push   $0x400000
+  804537:	6a 00                	push   $0x0
+  804539:	e8 7c f6 ff ff       	call   803bba <page_out>
+  80453e:	83 c4 10             	add    $0x10,%esp
+  804541:	85 c0                	test   %eax,%eax
+  804543:	0f 89 5e ff ff ff    	jns    8044a7 <page_map+0xc>
+				return r;
+  804549:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80454c:	eb d7                	jmp    804525 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  80454e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804551:	e8 79 f9 ff ff       	call   803ecf <page_adopt>
+  804556:	85 c0                	test   %eax,%eax
+  804558:	79 90                	jns    8044ea <page_map+0x4f>
+			return r;
+  80455a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80455d:	eb c6                	jmp    804525 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  80455f:	53                   	push   %ebx
+  804560:	68 94 61 80 00       	push   $0x806194
+  804565:	68 77 03 00 00       	push   $0x377
+  80456a:	68 5b 5d 80 00       	push   $0x805d5b
+  80456f:	e8 ef be ff ff       	call   800463 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  804574:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804577:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  80457a:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  804581:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  804587:	0f 84 f5 00 00 00    	je     804682 <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  80458d:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804593:	83 ec 0c             	sub    $0xc,%esp
+  804596:	6a 05                	push   $0x5
+  804598:	68 00 00 40 00       	push   $0x400000
+  80459d:	6a 00                	push   $0x0
+  80459f:	57                   	push   %edi
+  8045a0:	56                   	push   %esi
+  8045a1:	e8 b5 ca ff ff       	call   80105b <sys_page_map>
+  8045a6:	89 c3                	mov    %eax,%ebx
+  8045a8:	83 c4 20             	add    $0x20,%esp
+  8045ab:	85 c0                	test   %eax,%eax
+  8045ad:	79 35                	jns    8045e4 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  8045af:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8045b2:	75 1b                	jne    8045cf <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8045b4:	83 ec 08             	sub    $0x8,%esp
+  8045b7:	68 00 00 40 00       	push   $0x400000
+  8045bc:	6a 00                	push   $0x0
+  8045be:	e8 f7 f5 ff ff       	call   803bba <page_out>
+  8045c3:	83 c4 10             	add    $0x10,%esp
+  8045c6:	85 c0                	test   %eax,%eax
+  8045c8:	79 c9                	jns    804593 <page_map+0xf8>
+  8045ca:	e9 56 ff ff ff       	jmp    804525 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  8045cf:	53                   	push   %ebx
+  8045d0:	68 bc 61 80 00       	push   $0x8061bc
+  8045d5:	68 83 03 00 00       	push   $0x383
+  8045da:	68 5b 5d 80 00       	push   $0x805d5b
+  8045df:	e8 7f be ff ff       	call   800463 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  8045e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8045e7:	c1 e8 0c             	shr    $0xc,%eax
+  8045ea:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8045ef:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  8045f6:	01 
+  8045f7:	0f 84 8d 00 00 00    	je     80468a <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  8045fd:	83 ec 08             	sub    $0x8,%esp
+  804600:	68 00 00 40 00       	push   $0x400000
+  804605:	6a 00                	push   $0x0
+  804607:	e8 91 ca ff ff       	call   80109d <sys_page_unmap>
+  80460c:	83 c4 10             	add    $0x10,%esp
+  80460f:	85 c0                	test   %eax,%eax
+  804611:	78 36                	js     804649 <page_map+0x1ae>
+  804613:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  804616:	83 ec 08             	sub    $0x8,%esp
+  804619:	57                   	push   %edi
+  80461a:	56                   	push   %esi
+  80461b:	e8 4a fc ff ff       	call   80426a <page_in>
+  804620:	89 c3                	mov    %eax,%ebx
+  804622:	83 c4 10             	add    $0x10,%esp
+  804625:	85 c0                	test   %eax,%eax
+  804627:	0f 89 7a fe ff ff    	jns    8044a7 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  80462d:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804630:	75 2c                	jne    80465e <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  804632:	83 ec 08             	sub    $0x8,%esp
+  804635:	57                   	push   %edi
+  804636:	6a 00                	push   $0x0
+  804638:	e8 7d f5 ff ff       	call   803bba <page_out>
+  80463d:	83 c4 10             	add    $0x10,%esp
+  804640:	85 c0                	test   %eax,%eax
+  804642:	79 d2                	jns    804616 <page_map+0x17b>
+  804644:	e9 dc fe ff ff       	jmp    804525 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  804649:	50                   	push   %eax
+  80464a:	68 e8 61 80 00       	push   $0x8061e8
+  80464f:	68 8b 03 00 00       	push   $0x38b
+  804654:	68 5b 5d 80 00       	push   $0x805d5b
+  804659:	e8 05 be ff ff       	call   800463 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  80465e:	53                   	push   %ebx
+  80465f:	68 10 62 80 00       	push   $0x806210
+  804664:	68 91 03 00 00       	push   $0x391
+  804669:	68 5b 5d 80 00       	push   $0x805d5b
+  80466e:	e8 f0 bd ff ff       	call   800463 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  804673:	89 c3                	mov    %eax,%ebx
+  804675:	e9 ab fe ff ff       	jmp    804525 <page_map+0x8a>
+  80467a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80467d:	e9 a3 fe ff ff       	jmp    804525 <page_map+0x8a>
+			return r; // Pass through the error
+  804682:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804685:	e9 9b fe ff ff       	jmp    804525 <page_map+0x8a>
+			return r; // Pass through the error
+  80468a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80468d:	e9 93 fe ff ff       	jmp    804525 <page_map+0x8a>
+
+00804692 <page_map_range>:
+{
+  804692:	55                   	push   %ebp
+  804693:	89 e5                	mov    %esp,%ebp
+  804695:	57                   	push   %edi
+  804696:	56                   	push   %esi
+  804697:	53                   	push   %ebx
+  804698:	83 ec 0c             	sub    $0xc,%esp
+  80469b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80469e:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  8046a1:	83 ec 08             	sub    $0x8,%esp
+  8046a4:	ff 75 1c             	push   0x1c(%ebp)
+  8046a7:	ff 75 18             	push   0x18(%ebp)
+  8046aa:	56                   	push   %esi
+  8046ab:	ff 75 10             	push   0x10(%ebp)
+  8046ae:	57                   	push   %edi
+  8046af:	ff 75 08             	push   0x8(%ebp)
+  8046b2:	e8 af ca ff ff       	call   801166 <sys_page_map_range>
+  8046b7:	89 c3                	mov    %eax,%ebx
+  8046b9:	83 c4 20             	add    $0x20,%esp
+  8046bc:	85 c0                	test   %eax,%eax
+  8046be:	79 1b                	jns    8046db <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  8046c0:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8046c3:	75 20                	jne    8046e5 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8046c5:	83 ec 08             	sub    $0x8,%esp
+  8046c8:	68 00 00 40 00       	push   $0x400000
+  8046cd:	6a 00                	push   $0x0
+  8046cf:	e8 e6 f4 ff ff       	call   803bba <page_out>
+  8046d4:	83 c4 10             	add    $0x10,%esp
+  8046d7:	85 c0                	test   %eax,%eax
+  8046d9:	79 c6                	jns    8046a1 <page_map_range+0xf>
+}
+  8046db:	89 d8                	mov    %ebx,%eax
+  8046dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046e0:	5b                   	pop    %ebx
+  8046e1:	5e                   	pop    %esi
+  8046e2:	5f                   	pop    %edi
+  8046e3:	5d                   	pop    %ebp
+  8046e4:	c3                   	ret
+		if (r != -E_INVAL)
+  8046e5:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  8046e8:	75 f1                	jne    8046db <page_map_range+0x49>
+  8046ea:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  8046ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8046f1:	eb 03                	jmp    8046f6 <page_map_range+0x64>
+  8046f3:	83 c6 01             	add    $0x1,%esi
+  8046f6:	3b 75 18             	cmp    0x18(%ebp),%esi
+  8046f9:	74 2a                	je     804725 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  8046fb:	83 ec 0c             	sub    $0xc,%esp
+  8046fe:	ff 75 1c             	push   0x1c(%ebp)
+  804701:	53                   	push   %ebx
+  804702:	ff 75 10             	push   0x10(%ebp)
+  804705:	57                   	push   %edi
+  804706:	ff 75 08             	push   0x8(%ebp)
+  804709:	e8 8d fd ff ff       	call   80449b <page_map>
+  80470e:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804714:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80471a:	83 c4 20             	add    $0x20,%esp
+  80471d:	85 c0                	test   %eax,%eax
+  80471f:	79 d2                	jns    8046f3 <page_map_range+0x61>
+  804721:	89 c3                	mov    %eax,%ebx
+  804723:	eb b6                	jmp    8046db <page_map_range+0x49>
+		return 0;
+  804725:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80472a:	eb af                	jmp    8046db <page_map_range+0x49>
+
+0080472c <paging_pgfault_handler>:
+{
+  80472c:	55                   	push   %ebp
+  80472d:	89 e5                	mov    %esp,%ebp
+  80472f:	56                   	push   %esi
+  804730:	53                   	push   %ebx
+  804731:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  804734:	e8 6f e7 ff ff       	call   802ea8 <find_paging_env>
+	if (pagingenv == 0)
+  804739:	a1 40 c0 81 00       	mov    0x81c040,%eax
+  80473e:	85 c0                	test   %eax,%eax
+  804740:	74 3c                	je     80477e <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  804742:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804744:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804748:	75 12                	jne    80475c <paging_pgfault_handler+0x30>
+  80474a:	89 f0                	mov    %esi,%eax
+  80474c:	e8 7e f7 ff ff       	call   803ecf <page_adopt>
+  804751:	89 c2                	mov    %eax,%edx
+		return 0;
+  804753:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804758:	85 d2                	test   %edx,%edx
+  80475a:	78 22                	js     80477e <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  80475c:	83 ec 08             	sub    $0x8,%esp
+  80475f:	6a 00                	push   $0x0
+  804761:	56                   	push   %esi
+  804762:	e8 a9 f3 ff ff       	call   803b10 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  804767:	83 c4 10             	add    $0x10,%esp
+  80476a:	85 c0                	test   %eax,%eax
+  80476c:	74 05                	je     804773 <paging_pgfault_handler+0x47>
+  80476e:	f6 00 01             	testb  $0x1,(%eax)
+  804771:	75 12                	jne    804785 <paging_pgfault_handler+0x59>
+	return 0;
+  804773:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804778:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80477c:	74 23                	je     8047a1 <paging_pgfault_handler+0x75>
+}
+  80477e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804781:	5b                   	pop    %ebx
+  804782:	5e                   	pop    %esi
+  804783:	5d                   	pop    %ebp
+  804784:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  804785:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  80478a:	8b 40 48             	mov    0x48(%eax),%eax
+  80478d:	83 ec 08             	sub    $0x8,%esp
+  804790:	56                   	push   %esi
+  804791:	50                   	push   %eax
+  804792:	e8 d3 fa ff ff       	call   80426a <page_in>
+  804797:	f7 d0                	not    %eax
+  804799:	c1 e8 1f             	shr    $0x1f,%eax
+  80479c:	83 c4 10             	add    $0x10,%esp
+  80479f:	eb dd                	jmp    80477e <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8047a1:	89 f0                	mov    %esi,%eax
+  8047a3:	e8 97 e2 ff ff       	call   802a3f <segment_lookup>
+  8047a8:	89 c2                	mov    %eax,%edx
+	return 0;
+  8047aa:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8047af:	85 d2                	test   %edx,%edx
+  8047b1:	74 cb                	je     80477e <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  8047b3:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  8047b8:	8b 40 48             	mov    0x48(%eax),%eax
+  8047bb:	83 ec 08             	sub    $0x8,%esp
+  8047be:	56                   	push   %esi
+  8047bf:	50                   	push   %eax
+  8047c0:	e8 f5 f3 ff ff       	call   803bba <page_out>
+  8047c5:	f7 d0                	not    %eax
+  8047c7:	c1 e8 1f             	shr    $0x1f,%eax
+  8047ca:	83 c4 10             	add    $0x10,%esp
+  8047cd:	eb af                	jmp    80477e <paging_pgfault_handler+0x52>
+
+008047cf <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  8047cf:	55                   	push   %ebp
+  8047d0:	89 e5                	mov    %esp,%ebp
+  8047d2:	57                   	push   %edi
+  8047d3:	56                   	push   %esi
+  8047d4:	53                   	push   %ebx
+  8047d5:	83 ec 2c             	sub    $0x2c,%esp
+  8047d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8047db:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  8047e0:	89 c1                	mov    %eax,%ecx
+  8047e2:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  8047e5:	c1 e8 11             	shr    $0x11,%eax
+  8047e8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8047eb:	8b 3c 85 80 dc 81 00 	mov    0x81dc80(,%eax,4),%edi
+  8047f2:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  8047f5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8047fa:	d3 e0                	shl    %cl,%eax
+  8047fc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8047ff:	85 c7                	test   %eax,%edi
+  804801:	74 12                	je     804815 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804803:	bb 01 00 00 00       	mov    $0x1,%ebx
+  804808:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  80480b:	bf 01 00 00 00       	mov    $0x1,%edi
+  804810:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804813:	eb 17                	jmp    80482c <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  804815:	ff 75 e0             	push   -0x20(%ebp)
+  804818:	68 48 62 80 00       	push   $0x806248
+  80481d:	6a 48                	push   $0x48
+  80481f:	68 62 62 80 00       	push   $0x806262
+  804824:	e8 3a bc ff ff       	call   800463 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804829:	83 c3 01             	add    $0x1,%ebx
+  80482c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80482f:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  804832:	89 c8                	mov    %ecx,%eax
+  804834:	c1 e8 05             	shr    $0x5,%eax
+  804837:	8b 14 85 80 ce 81 00 	mov    0x81ce80(,%eax,4),%edx
+  80483e:	89 fe                	mov    %edi,%esi
+  804840:	d3 e6                	shl    %cl,%esi
+  804842:	89 f1                	mov    %esi,%ecx
+  804844:	85 d6                	test   %edx,%esi
+  804846:	74 e1                	je     804829 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  804848:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  80484b:	f7 d6                	not    %esi
+  80484d:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804850:	21 fe                	and    %edi,%esi
+  804852:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804855:	89 34 bd 80 dc 81 00 	mov    %esi,0x81dc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  80485c:	f7 d1                	not    %ecx
+  80485e:	21 d1                	and    %edx,%ecx
+  804860:	89 0c 85 80 ce 81 00 	mov    %ecx,0x81ce80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804867:	83 ec 04             	sub    $0x4,%esp
+  80486a:	53                   	push   %ebx
+  80486b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80486e:	57                   	push   %edi
+  80486f:	6a 00                	push   $0x0
+  804871:	e8 97 f8 ff ff       	call   80410d <page_unmap_range>
+	va_free(va, n);
+  804876:	83 c4 08             	add    $0x8,%esp
+  804879:	53                   	push   %ebx
+  80487a:	57                   	push   %edi
+  80487b:	e8 ed 05 00 00       	call   804e6d <va_free>
+}
+  804880:	83 c4 10             	add    $0x10,%esp
+  804883:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804886:	5b                   	pop    %ebx
+  804887:	5e                   	pop    %esi
+  804888:	5f                   	pop    %edi
+  804889:	5d                   	pop    %ebp
+  80488a:	c3                   	ret
+
+0080488b <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  80488b:	55                   	push   %ebp
+  80488c:	89 e5                	mov    %esp,%ebp
+  80488e:	57                   	push   %edi
+  80488f:	56                   	push   %esi
+  804890:	53                   	push   %ebx
+  804891:	83 ec 1c             	sub    $0x1c,%esp
+  804894:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804897:	85 db                	test   %ebx,%ebx
+  804899:	74 34                	je     8048cf <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  80489b:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8048a1:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  8048a6:	77 2f                	ja     8048d7 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  8048a8:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8048ae:	75 51                	jne    804901 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  8048b0:	89 c1                	mov    %eax,%ecx
+  8048b2:	c1 e9 0c             	shr    $0xc,%ecx
+  8048b5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8048ba:	d3 e2                	shl    %cl,%edx
+  8048bc:	c1 e8 11             	shr    $0x11,%eax
+  8048bf:	23 14 85 80 c0 81 00 	and    0x81c080(,%eax,4),%edx
+  8048c6:	75 24                	jne    8048ec <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  8048c8:	89 d8                	mov    %ebx,%eax
+  8048ca:	e8 00 ff ff ff       	call   8047cf <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  8048cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8048d2:	5b                   	pop    %ebx
+  8048d3:	5e                   	pop    %esi
+  8048d4:	5f                   	pop    %edi
+  8048d5:	5d                   	pop    %ebp
+  8048d6:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  8048d7:	53                   	push   %ebx
+  8048d8:	68 6f 62 80 00       	push   $0x80626f
+  8048dd:	68 a2 00 00 00       	push   $0xa2
+  8048e2:	68 62 62 80 00       	push   $0x806262
+  8048e7:	e8 77 bb ff ff       	call   800463 <_panic>
+			panic("free: %p is not allocated", va);
+  8048ec:	53                   	push   %ebx
+  8048ed:	68 48 62 80 00       	push   $0x806248
+  8048f2:	68 a5 00 00 00       	push   $0xa5
+  8048f7:	68 62 62 80 00       	push   $0x806262
+  8048fc:	e8 62 bb ff ff       	call   800463 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  804901:	89 de                	mov    %ebx,%esi
+  804903:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  804909:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  80490f:	89 c8                	mov    %ecx,%eax
+  804911:	c1 e8 11             	shr    $0x11,%eax
+  804914:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804917:	8b 3c 85 80 c0 81 00 	mov    0x81c080(,%eax,4),%edi
+  80491e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  804921:	c1 e9 0c             	shr    $0xc,%ecx
+  804924:	b8 01 00 00 00       	mov    $0x1,%eax
+  804929:	d3 e0                	shl    %cl,%eax
+  80492b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80492e:	85 c7                	test   %eax,%edi
+  804930:	74 1b                	je     80494d <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  804932:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804936:	89 d8                	mov    %ebx,%eax
+  804938:	29 f0                	sub    %esi,%eax
+  80493a:	83 e8 10             	sub    $0x10,%eax
+  80493d:	99                   	cltd
+  80493e:	f7 ff                	idiv   %edi
+  804940:	89 d1                	mov    %edx,%ecx
+  804942:	85 d2                	test   %edx,%edx
+  804944:	75 07                	jne    80494d <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804946:	ba 10 00 00 00       	mov    $0x10,%edx
+  80494b:	eb 18                	jmp    804965 <free+0xda>
+		panic("free: %p is not allocated", va);
+  80494d:	53                   	push   %ebx
+  80494e:	68 48 62 80 00       	push   $0x806248
+  804953:	68 ad 00 00 00       	push   $0xad
+  804958:	68 62 62 80 00       	push   $0x806262
+  80495d:	e8 01 bb ff ff       	call   800463 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804962:	83 c1 01             	add    $0x1,%ecx
+  804965:	89 d0                	mov    %edx,%eax
+  804967:	d3 e0                	shl    %cl,%eax
+  804969:	39 c7                	cmp    %eax,%edi
+  80496b:	7f f5                	jg     804962 <free+0xd7>
+	*(void **) va = s->free;
+  80496d:	8b 46 08             	mov    0x8(%esi),%eax
+  804970:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  804972:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  804975:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  804979:	8d 58 01             	lea    0x1(%eax),%ebx
+  80497c:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  804980:	66 85 c0             	test   %ax,%ax
+  804983:	74 52                	je     8049d7 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804985:	0f b7 db             	movzwl %bx,%ebx
+  804988:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  80498c:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804991:	ba 00 00 00 00       	mov    $0x0,%edx
+  804996:	f7 ff                	idiv   %edi
+  804998:	39 c3                	cmp    %eax,%ebx
+  80499a:	0f 85 2f ff ff ff    	jne    8048cf <free+0x44>
+  8049a0:	8b 46 04             	mov    0x4(%esi),%eax
+  8049a3:	85 c0                	test   %eax,%eax
+  8049a5:	74 53                	je     8049fa <free+0x16f>
+		s->prev->next = s->next;
+  8049a7:	8b 16                	mov    (%esi),%edx
+  8049a9:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8049ab:	8b 06                	mov    (%esi),%eax
+  8049ad:	85 c0                	test   %eax,%eax
+  8049af:	74 06                	je     8049b7 <free+0x12c>
+		s->next->prev = s->prev;
+  8049b1:	8b 56 04             	mov    0x4(%esi),%edx
+  8049b4:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8049b7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8049ba:	f7 d0                	not    %eax
+  8049bc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8049bf:	21 d0                	and    %edx,%eax
+  8049c1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8049c4:	89 04 95 80 c0 81 00 	mov    %eax,0x81c080(,%edx,4)
+		heap_free_pages(s);
+  8049cb:	89 f0                	mov    %esi,%eax
+  8049cd:	e8 fd fd ff ff       	call   8047cf <heap_free_pages>
+  8049d2:	e9 f8 fe ff ff       	jmp    8048cf <free+0x44>
+	s->prev = NULL;
+  8049d7:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  8049de:	8b 04 8d 60 c0 81 00 	mov    0x81c060(,%ecx,4),%eax
+  8049e5:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  8049e7:	85 c0                	test   %eax,%eax
+  8049e9:	74 03                	je     8049ee <free+0x163>
+		slabs[c]->prev = s;
+  8049eb:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  8049ee:	89 34 8d 60 c0 81 00 	mov    %esi,0x81c060(,%ecx,4)
+}
+  8049f5:	e9 d5 fe ff ff       	jmp    8048cf <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8049fa:	8b 06                	mov    (%esi),%eax
+  8049fc:	85 c0                	test   %eax,%eax
+  8049fe:	0f 84 cb fe ff ff    	je     8048cf <free+0x44>
+		slabs[c] = s->next;
+  804a04:	89 04 8d 60 c0 81 00 	mov    %eax,0x81c060(,%ecx,4)
+	if (s->next)
+  804a0b:	8b 06                	mov    (%esi),%eax
+  804a0d:	eb a2                	jmp    8049b1 <free+0x126>
+
+00804a0f <heap_alloc_pages>:
+{
+  804a0f:	55                   	push   %ebp
+  804a10:	89 e5                	mov    %esp,%ebp
+  804a12:	57                   	push   %edi
+  804a13:	56                   	push   %esi
+  804a14:	53                   	push   %ebx
+  804a15:	83 ec 18             	sub    $0x18,%esp
+  804a18:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  804a1a:	50                   	push   %eax
+  804a1b:	e8 15 03 00 00       	call   804d35 <va_alloc>
+  804a20:	89 c3                	mov    %eax,%ebx
+  804a22:	83 c4 10             	add    $0x10,%esp
+  804a25:	85 c0                	test   %eax,%eax
+  804a27:	74 47                	je     804a70 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804a29:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804a2f:	89 c1                	mov    %eax,%ecx
+  804a31:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  804a34:	c1 e8 11             	shr    $0x11,%eax
+  804a37:	ba 01 00 00 00       	mov    $0x1,%edx
+  804a3c:	89 d7                	mov    %edx,%edi
+  804a3e:	d3 e7                	shl    %cl,%edi
+  804a40:	09 3c 85 80 dc 81 00 	or     %edi,0x81dc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  804a47:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  804a4b:	89 c8                	mov    %ecx,%eax
+  804a4d:	c1 e8 05             	shr    $0x5,%eax
+  804a50:	d3 e2                	shl    %cl,%edx
+  804a52:	09 14 85 80 ce 81 00 	or     %edx,0x81ce80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  804a59:	83 ec 0c             	sub    $0xc,%esp
+  804a5c:	6a 00                	push   $0x0
+  804a5e:	6a 07                	push   $0x7
+  804a60:	56                   	push   %esi
+  804a61:	53                   	push   %ebx
+  804a62:	6a 00                	push   $0x0
+  804a64:	e8 3a f7 ff ff       	call   8041a3 <page_alloc_range>
+  804a69:	83 c4 20             	add    $0x20,%esp
+  804a6c:	85 c0                	test   %eax,%eax
+  804a6e:	78 0a                	js     804a7a <heap_alloc_pages+0x6b>
+}
+  804a70:	89 d8                	mov    %ebx,%eax
+  804a72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a75:	5b                   	pop    %ebx
+  804a76:	5e                   	pop    %esi
+  804a77:	5f                   	pop    %edi
+  804a78:	5d                   	pop    %ebp
+  804a79:	c3                   	ret
+		free(va);
+  804a7a:	83 ec 0c             	sub    $0xc,%esp
+  804a7d:	53                   	push   %ebx
+  804a7e:	e8 08 fe ff ff       	call   80488b <free>
+		return NULL;
+  804a83:	83 c4 10             	add    $0x10,%esp
+  804a86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804a8b:	eb e3                	jmp    804a70 <heap_alloc_pages+0x61>
+
+00804a8d <malloc>:
+{
+  804a8d:	55                   	push   %ebp
+  804a8e:	89 e5                	mov    %esp,%ebp
+  804a90:	57                   	push   %edi
+  804a91:	56                   	push   %esi
+  804a92:	53                   	push   %ebx
+  804a93:	83 ec 1c             	sub    $0x1c,%esp
+  804a96:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804a99:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804a9c:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  804aa2:	0f 87 21 01 00 00    	ja     804bc9 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804aa8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804aad:	ba 10 00 00 00       	mov    $0x10,%edx
+  804ab2:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  804ab4:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804ab9:	76 15                	jbe    804ad0 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804abb:	05 ff 0f 00 00       	add    $0xfff,%eax
+  804ac0:	c1 e8 0c             	shr    $0xc,%eax
+  804ac3:	e8 47 ff ff ff       	call   804a0f <heap_alloc_pages>
+  804ac8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804acb:	eb 37                	jmp    804b04 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804acd:	83 c1 01             	add    $0x1,%ecx
+  804ad0:	89 d6                	mov    %edx,%esi
+  804ad2:	d3 e6                	shl    %cl,%esi
+  804ad4:	39 c6                	cmp    %eax,%esi
+  804ad6:	72 f5                	jb     804acd <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804ad8:	89 cb                	mov    %ecx,%ebx
+  804ada:	8b 3c 8d 60 c0 81 00 	mov    0x81c060(,%ecx,4),%edi
+  804ae1:	85 ff                	test   %edi,%edi
+  804ae3:	74 2a                	je     804b0f <malloc+0x82>
+	v = s->free;
+  804ae5:	8b 47 08             	mov    0x8(%edi),%eax
+  804ae8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  804aeb:	8b 00                	mov    (%eax),%eax
+  804aed:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  804af0:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  804af4:	83 e8 01             	sub    $0x1,%eax
+  804af7:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  804afb:	66 85 c0             	test   %ax,%ax
+  804afe:	0f 84 9a 00 00 00    	je     804b9e <malloc+0x111>
+}
+  804b04:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804b07:	83 c4 1c             	add    $0x1c,%esp
+  804b0a:	5b                   	pop    %ebx
+  804b0b:	5e                   	pop    %esi
+  804b0c:	5f                   	pop    %edi
+  804b0d:	5d                   	pop    %ebp
+  804b0e:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  804b0f:	b8 01 00 00 00       	mov    $0x1,%eax
+  804b14:	e8 f6 fe ff ff       	call   804a0f <heap_alloc_pages>
+  804b19:	89 c1                	mov    %eax,%ecx
+  804b1b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804b1e:	85 c0                	test   %eax,%eax
+  804b20:	74 e2                	je     804b04 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804b22:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  804b28:	89 c8                	mov    %ecx,%eax
+  804b2a:	c1 e8 11             	shr    $0x11,%eax
+  804b2d:	c1 e9 0c             	shr    $0xc,%ecx
+  804b30:	ba 01 00 00 00       	mov    $0x1,%edx
+  804b35:	d3 e2                	shl    %cl,%edx
+  804b37:	09 14 85 80 c0 81 00 	or     %edx,0x81c080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804b3e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804b41:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  804b45:	0f b7 f6             	movzwl %si,%esi
+  804b48:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804b4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b52:	f7 fe                	idiv   %esi
+  804b54:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804b58:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  804b5b:	85 c0                	test   %eax,%eax
+  804b5d:	74 14                	je     804b73 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  804b5f:	83 e8 01             	sub    $0x1,%eax
+  804b62:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804b66:	0f af d0             	imul   %eax,%edx
+  804b69:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804b6d:	89 3a                	mov    %edi,(%edx)
+  804b6f:	89 d7                	mov    %edx,%edi
+  804b71:	eb e5                	jmp    804b58 <malloc+0xcb>
+	s->prev = NULL;
+  804b73:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804b76:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804b7d:	8b 04 9d 60 c0 81 00 	mov    0x81c060(,%ebx,4),%eax
+  804b84:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804b86:	85 c0                	test   %eax,%eax
+  804b88:	74 03                	je     804b8d <malloc+0x100>
+		slabs[c]->prev = s;
+  804b8a:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804b8d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804b90:	89 04 9d 60 c0 81 00 	mov    %eax,0x81c060(,%ebx,4)
+	return s;
+  804b97:	89 c7                	mov    %eax,%edi
+  804b99:	e9 47 ff ff ff       	jmp    804ae5 <malloc+0x58>
+	if (s->prev)
+  804b9e:	8b 47 04             	mov    0x4(%edi),%eax
+  804ba1:	85 c0                	test   %eax,%eax
+  804ba3:	74 19                	je     804bbe <malloc+0x131>
+		s->prev->next = s->next;
+  804ba5:	8b 17                	mov    (%edi),%edx
+  804ba7:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804ba9:	8b 07                	mov    (%edi),%eax
+  804bab:	85 c0                	test   %eax,%eax
+  804bad:	0f 84 51 ff ff ff    	je     804b04 <malloc+0x77>
+		s->next->prev = s->prev;
+  804bb3:	8b 57 04             	mov    0x4(%edi),%edx
+  804bb6:	89 50 04             	mov    %edx,0x4(%eax)
+  804bb9:	e9 46 ff ff ff       	jmp    804b04 <malloc+0x77>
+		slabs[c] = s->next;
+  804bbe:	8b 07                	mov    (%edi),%eax
+  804bc0:	89 04 9d 60 c0 81 00 	mov    %eax,0x81c060(,%ebx,4)
+  804bc7:	eb e0                	jmp    804ba9 <malloc+0x11c>
+		return NULL;
+  804bc9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804bd0:	e9 2f ff ff ff       	jmp    804b04 <malloc+0x77>
+
+00804bd5 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804bd5:	55                   	push   %ebp
+  804bd6:	89 e5                	mov    %esp,%ebp
+  804bd8:	57                   	push   %edi
+  804bd9:	56                   	push   %esi
+  804bda:	53                   	push   %ebx
+  804bdb:	83 ec 0c             	sub    $0xc,%esp
+  804bde:	89 c6                	mov    %eax,%esi
+  804be0:	89 d7                	mov    %edx,%edi
+  804be2:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804be5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804bea:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bef:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  804bf4:	83 ef 01             	sub    $0x1,%edi
+  804bf7:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804bfa:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  804bfd:	eb 34                	jmp    804c33 <va_chunk_scan+0x5e>
+			i += 31;
+  804bff:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  804c02:	89 ca                	mov    %ecx,%edx
+			continue;
+  804c04:	eb 23                	jmp    804c29 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804c06:	89 c7                	mov    %eax,%edi
+  804c08:	c1 ef 05             	shr    $0x5,%edi
+  804c0b:	be 01 00 00 00       	mov    $0x1,%esi
+  804c10:	d3 e6                	shl    %cl,%esi
+  804c12:	89 f1                	mov    %esi,%ecx
+  804c14:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804c17:	23 0c be             	and    (%esi,%edi,4),%ecx
+  804c1a:	75 41                	jne    804c5d <va_chunk_scan+0x88>
+			len++;
+  804c1c:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804c1f:	39 d3                	cmp    %edx,%ebx
+  804c21:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  804c24:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  804c27:	72 2d                	jb     804c56 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804c29:	83 c0 01             	add    $0x1,%eax
+  804c2c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804c31:	77 31                	ja     804c64 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  804c33:	89 c1                	mov    %eax,%ecx
+  804c35:	83 e1 1f             	and    $0x1f,%ecx
+  804c38:	75 cc                	jne    804c06 <va_chunk_scan+0x31>
+  804c3a:	89 c7                	mov    %eax,%edi
+  804c3c:	c1 ef 05             	shr    $0x5,%edi
+  804c3f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804c42:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804c45:	83 ff ff             	cmp    $0xffffffff,%edi
+  804c48:	74 b5                	je     804bff <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  804c4a:	85 ff                	test   %edi,%edi
+  804c4c:	75 b8                	jne    804c06 <va_chunk_scan+0x31>
+			i += 31;
+  804c4e:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804c51:	83 c2 20             	add    $0x20,%edx
+  804c54:	eb c9                	jmp    804c1f <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804c56:	83 c0 01             	add    $0x1,%eax
+  804c59:	29 d0                	sub    %edx,%eax
+  804c5b:	eb 15                	jmp    804c72 <va_chunk_scan+0x9d>
+			len = 0;
+  804c5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c62:	eb c5                	jmp    804c29 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804c64:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804c69:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804c6c:	85 d2                	test   %edx,%edx
+  804c6e:	74 02                	je     804c72 <va_chunk_scan+0x9d>
+		*run_store = best;
+  804c70:	89 1a                	mov    %ebx,(%edx)
+}
+  804c72:	83 c4 0c             	add    $0xc,%esp
+  804c75:	5b                   	pop    %ebx
+  804c76:	5e                   	pop    %esi
+  804c77:	5f                   	pop    %edi
+  804c78:	5d                   	pop    %ebp
+  804c79:	c3                   	ret
+
+00804c7a <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804c7a:	55                   	push   %ebp
+  804c7b:	89 e5                	mov    %esp,%ebp
+  804c7d:	57                   	push   %edi
+  804c7e:	56                   	push   %esi
+  804c7f:	53                   	push   %ebx
+  804c80:	83 ec 14             	sub    $0x14,%esp
+  804c83:	89 c3                	mov    %eax,%ebx
+  804c85:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804c87:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804c8d:	8d ba a0 ea 81 00    	lea    0x81eaa0(%edx),%edi
+  804c93:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804c96:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804c99:	89 d6                	mov    %edx,%esi
+  804c9b:	81 c6 a0 ea 81 00    	add    $0x81eaa0,%esi
+  804ca1:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804ca3:	eb 34                	jmp    804cd9 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804ca5:	89 c8                	mov    %ecx,%eax
+  804ca7:	c1 e8 05             	shr    $0x5,%eax
+  804caa:	89 da                	mov    %ebx,%edx
+  804cac:	c1 e2 05             	shl    $0x5,%edx
+  804caf:	01 da                	add    %ebx,%edx
+  804cb1:	01 c2                	add    %eax,%edx
+  804cb3:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804cb8:	d3 c0                	rol    %cl,%eax
+  804cba:	21 04 95 a0 ea 81 00 	and    %eax,0x81eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804cc1:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804cc8:	b8 01 00 00 00       	mov    $0x1,%eax
+  804ccd:	01 d0                	add    %edx,%eax
+  804ccf:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804cd6:	83 c1 01             	add    $0x1,%ecx
+  804cd9:	39 f9                	cmp    %edi,%ecx
+  804cdb:	74 30                	je     804d0d <va_chunk_mark+0x93>
+		if (alloc)
+  804cdd:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804ce1:	74 c2                	je     804ca5 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804ce3:	89 c8                	mov    %ecx,%eax
+  804ce5:	c1 e8 05             	shr    $0x5,%eax
+  804ce8:	89 da                	mov    %ebx,%edx
+  804cea:	c1 e2 05             	shl    $0x5,%edx
+  804ced:	01 da                	add    %ebx,%edx
+  804cef:	01 c2                	add    %eax,%edx
+  804cf1:	b8 01 00 00 00       	mov    $0x1,%eax
+  804cf6:	d3 e0                	shl    %cl,%eax
+  804cf8:	09 04 95 a0 ea 81 00 	or     %eax,0x81eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804cff:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804d06:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804d0b:	eb c0                	jmp    804ccd <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804d0d:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804d10:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d15:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804d18:	e8 b8 fe ff ff       	call   804bd5 <va_chunk_scan>
+	ch->run = run;
+  804d1d:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804d23:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804d26:	66 89 83 22 eb 81 00 	mov    %ax,0x81eb22(%ebx)
+}
+  804d2d:	83 c4 14             	add    $0x14,%esp
+  804d30:	5b                   	pop    %ebx
+  804d31:	5e                   	pop    %esi
+  804d32:	5f                   	pop    %edi
+  804d33:	5d                   	pop    %ebp
+  804d34:	c3                   	ret
+
+00804d35 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804d35:	55                   	push   %ebp
+  804d36:	89 e5                	mov    %esp,%ebp
+  804d38:	57                   	push   %edi
+  804d39:	56                   	push   %esi
+  804d3a:	53                   	push   %ebx
+  804d3b:	83 ec 04             	sub    $0x4,%esp
+  804d3e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804d41:	b8 20 eb 81 00       	mov    $0x81eb20,%eax
+  804d46:	ba 90 f9 81 00       	mov    $0x81f990,%edx
+  804d4b:	80 3d 80 ea 81 00 00 	cmpb   $0x0,0x81ea80
+  804d52:	74 4f                	je     804da3 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804d54:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804d57:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804d5c:	0f 87 01 01 00 00    	ja     804e63 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804d62:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804d68:	0f 87 80 00 00 00    	ja     804dee <va_alloc+0xb9>
+  804d6e:	b8 22 eb 81 00       	mov    $0x81eb22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804d73:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804d78:	0f b7 10             	movzwl (%eax),%edx
+  804d7b:	05 84 00 00 00       	add    $0x84,%eax
+  804d80:	39 da                	cmp    %ebx,%edx
+  804d82:	73 2c                	jae    804db0 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804d84:	83 c6 01             	add    $0x1,%esi
+  804d87:	83 fe 1c             	cmp    $0x1c,%esi
+  804d8a:	75 ec                	jne    804d78 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804d8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d91:	eb 53                	jmp    804de6 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804d93:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804d99:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804d9e:	05 84 00 00 00       	add    $0x84,%eax
+  804da3:	39 d0                	cmp    %edx,%eax
+  804da5:	75 ec                	jne    804d93 <va_alloc+0x5e>
+	va_inited = 1;
+  804da7:	c6 05 80 ea 81 00 01 	movb   $0x1,0x81ea80
+}
+  804dae:	eb a4                	jmp    804d54 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804db0:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804db6:	05 a0 ea 81 00       	add    $0x81eaa0,%eax
+  804dbb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804dc0:	89 da                	mov    %ebx,%edx
+  804dc2:	e8 0e fe ff ff       	call   804bd5 <va_chunk_scan>
+  804dc7:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804dc9:	6a 01                	push   $0x1
+  804dcb:	89 d9                	mov    %ebx,%ecx
+  804dcd:	89 c2                	mov    %eax,%edx
+  804dcf:	89 f0                	mov    %esi,%eax
+  804dd1:	e8 a4 fe ff ff       	call   804c7a <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804dd6:	c1 e6 16             	shl    $0x16,%esi
+  804dd9:	c1 e7 0c             	shl    $0xc,%edi
+  804ddc:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804de3:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804de6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804de9:	5b                   	pop    %ebx
+  804dea:	5e                   	pop    %esi
+  804deb:	5f                   	pop    %edi
+  804dec:	5d                   	pop    %ebp
+  804ded:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804dee:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804df4:	c1 ee 0a             	shr    $0xa,%esi
+  804df7:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804dfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e01:	eb 0a                	jmp    804e0d <va_alloc+0xd8>
+			first = c + 1;
+  804e03:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804e05:	83 c2 01             	add    $0x1,%edx
+  804e08:	83 fa 1d             	cmp    $0x1d,%edx
+  804e0b:	74 4f                	je     804e5c <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804e0d:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804e13:	66 81 b9 9c ea 81 00 	cmpw   $0x400,0x81ea9c(%ecx)
+  804e1a:	00 04 
+  804e1c:	75 e5                	jne    804e03 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804e1e:	89 d1                	mov    %edx,%ecx
+  804e20:	29 c1                	sub    %eax,%ecx
+  804e22:	39 f1                	cmp    %esi,%ecx
+  804e24:	75 df                	jne    804e05 <va_alloc+0xd0>
+  804e26:	89 c7                	mov    %eax,%edi
+  804e28:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804e2b:	be 00 04 00 00       	mov    $0x400,%esi
+  804e30:	39 f3                	cmp    %esi,%ebx
+  804e32:	0f 46 f3             	cmovbe %ebx,%esi
+  804e35:	6a 01                	push   $0x1
+  804e37:	89 f1                	mov    %esi,%ecx
+  804e39:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e3e:	89 f8                	mov    %edi,%eax
+  804e40:	e8 35 fe ff ff       	call   804c7a <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804e45:	83 c7 01             	add    $0x1,%edi
+  804e48:	83 c4 04             	add    $0x4,%esp
+  804e4b:	29 f3                	sub    %esi,%ebx
+  804e4d:	75 dc                	jne    804e2b <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804e4f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804e52:	c1 e0 16             	shl    $0x16,%eax
+  804e55:	05 00 00 00 08       	add    $0x8000000,%eax
+  804e5a:	eb 8a                	jmp    804de6 <va_alloc+0xb1>
+	return NULL;
+  804e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e61:	eb 83                	jmp    804de6 <va_alloc+0xb1>
+		return NULL;
+  804e63:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e68:	e9 79 ff ff ff       	jmp    804de6 <va_alloc+0xb1>
+
+00804e6d <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804e6d:	55                   	push   %ebp
+  804e6e:	89 e5                	mov    %esp,%ebp
+  804e70:	57                   	push   %edi
+  804e71:	56                   	push   %esi
+  804e72:	53                   	push   %ebx
+  804e73:	83 ec 0c             	sub    $0xc,%esp
+  804e76:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804e79:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804e7c:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804e82:	76 21                	jbe    804ea5 <va_free+0x38>
+  804e84:	89 f0                	mov    %esi,%eax
+  804e86:	c1 e0 0c             	shl    $0xc,%eax
+  804e89:	01 f8                	add    %edi,%eax
+  804e8b:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804e90:	77 13                	ja     804ea5 <va_free+0x38>
+	    || PGOFF(va))
+  804e92:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804e98:	75 0b                	jne    804ea5 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804e9a:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804ea0:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804ea3:	eb 45                	jmp    804eea <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804ea5:	83 ec 0c             	sub    $0xc,%esp
+  804ea8:	56                   	push   %esi
+  804ea9:	57                   	push   %edi
+  804eaa:	68 8c 62 80 00       	push   $0x80628c
+  804eaf:	68 8e 00 00 00       	push   $0x8e
+  804eb4:	68 ac 62 80 00       	push   $0x8062ac
+  804eb9:	e8 a5 b5 ff ff       	call   800463 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804ebe:	89 fa                	mov    %edi,%edx
+  804ec0:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804ec6:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804ecb:	29 d3                	sub    %edx,%ebx
+  804ecd:	39 f3                	cmp    %esi,%ebx
+  804ecf:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804ed2:	89 f8                	mov    %edi,%eax
+  804ed4:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804ed7:	83 ec 0c             	sub    $0xc,%esp
+  804eda:	6a 00                	push   $0x0
+  804edc:	89 d9                	mov    %ebx,%ecx
+  804ede:	e8 97 fd ff ff       	call   804c7a <va_chunk_mark>
+		i += n;
+  804ee3:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804ee5:	29 de                	sub    %ebx,%esi
+  804ee7:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804eea:	85 f6                	test   %esi,%esi
+  804eec:	75 d0                	jne    804ebe <va_free+0x51>
+	}
+}
+  804eee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804ef1:	5b                   	pop    %ebx
+  804ef2:	5e                   	pop    %esi
+  804ef3:	5f                   	pop    %edi
+  804ef4:	5d                   	pop    %ebp
+  804ef5:	c3                   	ret
+
+00804ef6 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804efb:	c3                   	ret
+
+00804efc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804efc:	55                   	push   %ebp
+  804efd:	89 e5                	mov    %esp,%ebp
+  804eff:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804f02:	68 b9 62 80 00       	push   $0x8062b9
+  804f07:	ff 75 0c             	push   0xc(%ebp)
+  804f0a:	e8 16 bc ff ff       	call   800b25 <strcpy>
+	return 0;
+}
+  804f0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f14:	c9                   	leave
+  804f15:	c3                   	ret
+
+00804f16 <devcons_write>:
+{
+  804f16:	55                   	push   %ebp
+  804f17:	89 e5                	mov    %esp,%ebp
+  804f19:	57                   	push   %edi
+  804f1a:	56                   	push   %esi
+  804f1b:	53                   	push   %ebx
+  804f1c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804f22:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804f27:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804f2d:	eb 2e                	jmp    804f5d <devcons_write+0x47>
+		m = n - tot;
+  804f2f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804f32:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804f34:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804f39:	39 c3                	cmp    %eax,%ebx
+  804f3b:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804f3e:	83 ec 04             	sub    $0x4,%esp
+  804f41:	53                   	push   %ebx
+  804f42:	89 f0                	mov    %esi,%eax
+  804f44:	03 45 0c             	add    0xc(%ebp),%eax
+  804f47:	50                   	push   %eax
+  804f48:	57                   	push   %edi
+  804f49:	e8 5d bd ff ff       	call   800cab <memmove>
+		sys_cputs(buf, m);
+  804f4e:	83 c4 08             	add    $0x8,%esp
+  804f51:	53                   	push   %ebx
+  804f52:	57                   	push   %edi
+  804f53:	e8 f3 bf ff ff       	call   800f4b <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804f58:	01 de                	add    %ebx,%esi
+  804f5a:	83 c4 10             	add    $0x10,%esp
+  804f5d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804f60:	72 cd                	jb     804f2f <devcons_write+0x19>
+}
+  804f62:	89 f0                	mov    %esi,%eax
+  804f64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804f67:	5b                   	pop    %ebx
+  804f68:	5e                   	pop    %esi
+  804f69:	5f                   	pop    %edi
+  804f6a:	5d                   	pop    %ebp
+  804f6b:	c3                   	ret
+
+00804f6c <devcons_read>:
+{
+  804f6c:	55                   	push   %ebp
+  804f6d:	89 e5                	mov    %esp,%ebp
+  804f6f:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804f72:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f77:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804f7b:	75 07                	jne    804f84 <devcons_read+0x18>
+  804f7d:	eb 1f                	jmp    804f9e <devcons_read+0x32>
+		sys_yield();
+  804f7f:	e8 75 c0 ff ff       	call   800ff9 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804f84:	e8 f1 bf ff ff       	call   800f7a <sys_cgetc>
+  804f89:	85 c0                	test   %eax,%eax
+  804f8b:	74 f2                	je     804f7f <devcons_read+0x13>
+	if (c < 0)
+  804f8d:	78 0f                	js     804f9e <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804f8f:	83 f8 04             	cmp    $0x4,%eax
+  804f92:	74 0c                	je     804fa0 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804f94:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804f97:	88 02                	mov    %al,(%edx)
+	return 1;
+  804f99:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804f9e:	c9                   	leave
+  804f9f:	c3                   	ret
+		return 0;
+  804fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fa5:	eb f7                	jmp    804f9e <devcons_read+0x32>
+
+00804fa7 <cputchar>:
+{
+  804fa7:	55                   	push   %ebp
+  804fa8:	89 e5                	mov    %esp,%ebp
+  804faa:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804fad:	8b 45 08             	mov    0x8(%ebp),%eax
+  804fb0:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804fb3:	6a 01                	push   $0x1
+  804fb5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804fb8:	50                   	push   %eax
+  804fb9:	e8 8d bf ff ff       	call   800f4b <sys_cputs>
+}
+  804fbe:	83 c4 10             	add    $0x10,%esp
+  804fc1:	c9                   	leave
+  804fc2:	c3                   	ret
+
+00804fc3 <getchar>:
+{
+  804fc3:	55                   	push   %ebp
+  804fc4:	89 e5                	mov    %esp,%ebp
+  804fc6:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804fc9:	6a 01                	push   $0x1
+  804fcb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804fce:	50                   	push   %eax
+  804fcf:	6a 00                	push   $0x0
+  804fd1:	e8 6b ce ff ff       	call   801e41 <read>
+	if (r < 0)
+  804fd6:	83 c4 10             	add    $0x10,%esp
+  804fd9:	85 c0                	test   %eax,%eax
+  804fdb:	78 06                	js     804fe3 <getchar+0x20>
+	if (r < 1)
+  804fdd:	74 06                	je     804fe5 <getchar+0x22>
+	return c;
+  804fdf:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804fe3:	c9                   	leave
+  804fe4:	c3                   	ret
+		return -E_EOF;
+  804fe5:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804fea:	eb f7                	jmp    804fe3 <getchar+0x20>
+
+00804fec <iscons>:
+{
+  804fec:	55                   	push   %ebp
+  804fed:	89 e5                	mov    %esp,%ebp
+  804fef:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804ff2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804ff5:	50                   	push   %eax
+  804ff6:	ff 75 08             	push   0x8(%ebp)
+  804ff9:	e8 e4 cb ff ff       	call   801be2 <fd_lookup>
+  804ffe:	83 c4 10             	add    $0x10,%esp
+  805001:	85 c0                	test   %eax,%eax
+  805003:	78 11                	js     805016 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  805005:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805008:	8b 15 64 70 81 00    	mov    0x817064,%edx
+  80500e:	39 10                	cmp    %edx,(%eax)
+  805010:	0f 94 c0             	sete   %al
+  805013:	0f b6 c0             	movzbl %al,%eax
+}
+  805016:	c9                   	leave
+  805017:	c3                   	ret
+
+00805018 <opencons>:
+{
+  805018:	55                   	push   %ebp
+  805019:	89 e5                	mov    %esp,%ebp
+  80501b:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80501e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805021:	50                   	push   %eax
+  805022:	e8 67 cb ff ff       	call   801b8e <fd_alloc>
+  805027:	83 c4 10             	add    $0x10,%esp
+  80502a:	85 c0                	test   %eax,%eax
+  80502c:	78 3a                	js     805068 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80502e:	83 ec 04             	sub    $0x4,%esp
+  805031:	68 07 04 00 00       	push   $0x407
+  805036:	ff 75 f4             	push   -0xc(%ebp)
+  805039:	6a 00                	push   $0x0
+  80503b:	e8 d8 bf ff ff       	call   801018 <sys_page_alloc>
+  805040:	83 c4 10             	add    $0x10,%esp
+  805043:	85 c0                	test   %eax,%eax
+  805045:	78 21                	js     805068 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  805047:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80504a:	8b 15 64 70 81 00    	mov    0x817064,%edx
+  805050:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  805052:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805055:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80505c:	83 ec 0c             	sub    $0xc,%esp
+  80505f:	50                   	push   %eax
+  805060:	e8 02 cb ff ff       	call   801b67 <fd2num>
+  805065:	83 c4 10             	add    $0x10,%esp
+}
+  805068:	c9                   	leave
+  805069:	c3                   	ret
+
+0080506a <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  80506a:	55                   	push   %ebp
+  80506b:	89 e5                	mov    %esp,%ebp
+  80506d:	56                   	push   %esi
+  80506e:	53                   	push   %ebx
+  80506f:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  805072:	a1 10 f9 81 00       	mov    0x81f910,%eax
+  805077:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  80507a:	85 db                	test   %ebx,%ebx
+  80507c:	78 17                	js     805095 <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  80507e:	83 ec 0c             	sub    $0xc,%esp
+  805081:	56                   	push   %esi
+  805082:	ff 14 9d 00 10 83 00 	call   *0x831000(,%ebx,4)
+  805089:	83 c4 10             	add    $0x10,%esp
+  80508c:	85 c0                	test   %eax,%eax
+  80508e:	75 27                	jne    8050b7 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  805090:	83 eb 01             	sub    $0x1,%ebx
+  805093:	eb e5                	jmp    80507a <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  805095:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  80509a:	8b 40 48             	mov    0x48(%eax),%eax
+  80509d:	83 ec 08             	sub    $0x8,%esp
+  8050a0:	ff 76 28             	push   0x28(%esi)
+  8050a3:	ff 36                	push   (%esi)
+  8050a5:	50                   	push   %eax
+  8050a6:	68 c8 62 80 00       	push   $0x8062c8
+  8050ab:	6a 1d                	push   $0x1d
+  8050ad:	68 eb 62 80 00       	push   $0x8062eb
+  8050b2:	e8 ac b3 ff ff       	call   800463 <_panic>
+}
+  8050b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8050ba:	5b                   	pop    %ebx
+  8050bb:	5e                   	pop    %esi
+  8050bc:	5d                   	pop    %ebp
+  8050bd:	c3                   	ret
+
+008050be <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8050be:	55                   	push   %ebp
+  8050bf:	89 e5                	mov    %esp,%ebp
+  8050c1:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  8050c4:	83 3d 28 10 83 00 00 	cmpl   $0x0,0x831028
+  8050cb:	74 0a                	je     8050d7 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8050cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8050d0:	a3 28 10 83 00       	mov    %eax,0x831028
+}
+  8050d5:	c9                   	leave
+  8050d6:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  8050d7:	83 ec 04             	sub    $0x4,%esp
+  8050da:	6a 07                	push   $0x7
+  8050dc:	68 00 f0 bf ee       	push   $0xeebff000
+  8050e1:	6a 00                	push   $0x0
+  8050e3:	e8 30 bf ff ff       	call   801018 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8050e8:	83 c4 08             	add    $0x8,%esp
+  8050eb:	68 5e 51 80 00       	push   $0x80515e
+  8050f0:	6a 00                	push   $0x0
+  8050f2:	e8 87 c2 ff ff       	call   80137e <sys_env_set_pgfault_upcall>
+  8050f7:	83 c4 10             	add    $0x10,%esp
+  8050fa:	eb d1                	jmp    8050cd <set_pgfault_handler+0xf>
+
+008050fc <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  8050fc:	55                   	push   %ebp
+  8050fd:	89 e5                	mov    %esp,%ebp
+  8050ff:	83 ec 08             	sub    $0x8,%esp
+  805102:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  805105:	8b 15 10 f9 81 00    	mov    0x81f910,%edx
+  80510b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805110:	eb 03                	jmp    805115 <add_pgfault_handler+0x19>
+  805112:	83 c0 01             	add    $0x1,%eax
+  805115:	39 d0                	cmp    %edx,%eax
+  805117:	74 0b                	je     805124 <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  805119:	39 0c 85 00 10 83 00 	cmp    %ecx,0x831000(,%eax,4)
+  805120:	75 f0                	jne    805112 <add_pgfault_handler+0x16>
+  805122:	eb 24                	jmp    805148 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  805124:	83 fa 0a             	cmp    $0xa,%edx
+  805127:	74 21                	je     80514a <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  805129:	8d 42 01             	lea    0x1(%edx),%eax
+  80512c:	a3 10 f9 81 00       	mov    %eax,0x81f910
+  805131:	89 0c 95 00 10 83 00 	mov    %ecx,0x831000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  805138:	83 ec 0c             	sub    $0xc,%esp
+  80513b:	68 6a 50 80 00       	push   $0x80506a
+  805140:	e8 79 ff ff ff       	call   8050be <set_pgfault_handler>
+  805145:	83 c4 10             	add    $0x10,%esp
+}
+  805148:	c9                   	leave
+  805149:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  80514a:	83 ec 04             	sub    $0x4,%esp
+  80514d:	68 f9 62 80 00       	push   $0x8062f9
+  805152:	6a 44                	push   $0x44
+  805154:	68 eb 62 80 00       	push   $0x8062eb
+  805159:	e8 05 b3 ff ff       	call   800463 <_panic>
+
+0080515e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80515e:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80515f:	a1 28 10 83 00       	mov    0x831028,%eax
+	call *%eax
+  805164:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  805166:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  805169:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  80516d:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  805171:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  805174:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  805176:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  80517a:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  80517d:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  80517e:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  805181:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  805182:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  805183:	c3                   	ret
+
+00805184 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  805184:	55                   	push   %ebp
+  805185:	89 e5                	mov    %esp,%ebp
+  805187:	57                   	push   %edi
+  805188:	56                   	push   %esi
+  805189:	53                   	push   %ebx
+  80518a:	83 ec 14             	sub    $0x14,%esp
+  80518d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  805190:	8b 75 14             	mov    0x14(%ebp),%esi
+  805193:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  805196:	ff 75 10             	push   0x10(%ebp)
+  805199:	ff 75 0c             	push   0xc(%ebp)
+  80519c:	e8 9a c2 ff ff       	call   80143b <sys_ipc_recv_pages>
+  8051a1:	83 c4 10             	add    $0x10,%esp
+  8051a4:	85 c0                	test   %eax,%eax
+  8051a6:	78 46                	js     8051ee <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8051a8:	85 ff                	test   %edi,%edi
+  8051aa:	74 0d                	je     8051b9 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  8051ac:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  8051b1:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8051b7:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8051b9:	85 f6                	test   %esi,%esi
+  8051bb:	74 0d                	je     8051ca <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  8051bd:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  8051c2:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8051c8:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8051ca:	85 db                	test   %ebx,%ebx
+  8051cc:	74 0d                	je     8051db <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  8051ce:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  8051d3:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8051d9:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8051db:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  8051e0:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8051e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8051e9:	5b                   	pop    %ebx
+  8051ea:	5e                   	pop    %esi
+  8051eb:	5f                   	pop    %edi
+  8051ec:	5d                   	pop    %ebp
+  8051ed:	c3                   	ret
+		if (from_env_store) {
+  8051ee:	85 ff                	test   %edi,%edi
+  8051f0:	74 06                	je     8051f8 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  8051f2:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8051f8:	85 f6                	test   %esi,%esi
+  8051fa:	74 06                	je     805202 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  8051fc:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  805202:	85 db                	test   %ebx,%ebx
+  805204:	74 e0                	je     8051e6 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  805206:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80520c:	eb d8                	jmp    8051e6 <ipc_recv_pages+0x62>
+
+0080520e <ipc_recv>:
+{
+  80520e:	55                   	push   %ebp
+  80520f:	89 e5                	mov    %esp,%ebp
+  805211:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  805214:	6a 00                	push   $0x0
+  805216:	ff 75 10             	push   0x10(%ebp)
+  805219:	6a 01                	push   $0x1
+  80521b:	ff 75 0c             	push   0xc(%ebp)
+  80521e:	ff 75 08             	push   0x8(%ebp)
+  805221:	e8 5e ff ff ff       	call   805184 <ipc_recv_pages>
+}
+  805226:	c9                   	leave
+  805227:	c3                   	ret
+
+00805228 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805228:	55                   	push   %ebp
+  805229:	89 e5                	mov    %esp,%ebp
+  80522b:	56                   	push   %esi
+  80522c:	53                   	push   %ebx
+  80522d:	8b 75 08             	mov    0x8(%ebp),%esi
+  805230:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  805233:	83 ec 0c             	sub    $0xc,%esp
+  805236:	ff 75 0c             	push   0xc(%ebp)
+  805239:	e8 31 c3 ff ff       	call   80156f <sys_ipc_try_recv>
+  80523e:	83 c4 10             	add    $0x10,%esp
+  805241:	85 c0                	test   %eax,%eax
+  805243:	78 34                	js     805279 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  805245:	85 f6                	test   %esi,%esi
+  805247:	74 0d                	je     805256 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  805249:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  80524e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  805254:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  805256:	85 db                	test   %ebx,%ebx
+  805258:	74 0d                	je     805267 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  80525a:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  80525f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  805265:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  805267:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  80526c:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  805272:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805275:	5b                   	pop    %ebx
+  805276:	5e                   	pop    %esi
+  805277:	5d                   	pop    %ebp
+  805278:	c3                   	ret
+		if (from_env_store) {
+  805279:	85 f6                	test   %esi,%esi
+  80527b:	74 06                	je     805283 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  80527d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  805283:	85 db                	test   %ebx,%ebx
+  805285:	74 eb                	je     805272 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  805287:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80528d:	eb e3                	jmp    805272 <ipc_try_recv+0x4a>
+
+0080528f <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80528f:	55                   	push   %ebp
+  805290:	89 e5                	mov    %esp,%ebp
+  805292:	83 ec 14             	sub    $0x14,%esp
+  805295:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805298:	85 c0                	test   %eax,%eax
+  80529a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80529f:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8052a2:	ff 75 18             	push   0x18(%ebp)
+  8052a5:	ff 75 14             	push   0x14(%ebp)
+  8052a8:	50                   	push   %eax
+  8052a9:	ff 75 0c             	push   0xc(%ebp)
+  8052ac:	ff 75 08             	push   0x8(%ebp)
+  8052af:	e8 4a c1 ff ff       	call   8013fe <sys_ipc_send_pages>
+  8052b4:	83 c4 20             	add    $0x20,%esp
+  8052b7:	85 c0                	test   %eax,%eax
+  8052b9:	78 02                	js     8052bd <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  8052bb:	c9                   	leave
+  8052bc:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  8052bd:	50                   	push   %eax
+  8052be:	68 14 63 80 00       	push   $0x806314
+  8052c3:	68 80 00 00 00       	push   $0x80
+  8052c8:	68 40 63 80 00       	push   $0x806340
+  8052cd:	e8 91 b1 ff ff       	call   800463 <_panic>
+
+008052d2 <ipc_send>:
+{
+  8052d2:	55                   	push   %ebp
+  8052d3:	89 e5                	mov    %esp,%ebp
+  8052d5:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  8052d8:	ff 75 14             	push   0x14(%ebp)
+  8052db:	6a 01                	push   $0x1
+  8052dd:	ff 75 10             	push   0x10(%ebp)
+  8052e0:	ff 75 0c             	push   0xc(%ebp)
+  8052e3:	ff 75 08             	push   0x8(%ebp)
+  8052e6:	e8 a4 ff ff ff       	call   80528f <ipc_send_pages>
+}
+  8052eb:	83 c4 20             	add    $0x20,%esp
+  8052ee:	c9                   	leave
+  8052ef:	c3                   	ret
+
+008052f0 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8052f0:	55                   	push   %ebp
+  8052f1:	89 e5                	mov    %esp,%ebp
+  8052f3:	83 ec 14             	sub    $0x14,%esp
+  8052f6:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8052f9:	85 c0                	test   %eax,%eax
+  8052fb:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805300:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  805303:	ff 75 18             	push   0x18(%ebp)
+  805306:	ff 75 14             	push   0x14(%ebp)
+  805309:	50                   	push   %eax
+  80530a:	ff 75 0c             	push   0xc(%ebp)
+  80530d:	ff 75 08             	push   0x8(%ebp)
+  805310:	e8 7a c1 ff ff       	call   80148f <sys_ipc_call>
+  805315:	83 c4 20             	add    $0x20,%esp
+  805318:	85 c0                	test   %eax,%eax
+  80531a:	78 0b                	js     805327 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  80531c:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  805321:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  805327:	c9                   	leave
+  805328:	c3                   	ret
+
+00805329 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  805329:	55                   	push   %ebp
+  80532a:	89 e5                	mov    %esp,%ebp
+  80532c:	57                   	push   %edi
+  80532d:	56                   	push   %esi
+  80532e:	53                   	push   %ebx
+  80532f:	83 ec 18             	sub    $0x18,%esp
+  805332:	8b 45 10             	mov    0x10(%ebp),%eax
+  805335:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  805338:	8b 75 20             	mov    0x20(%ebp),%esi
+  80533b:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80533e:	85 c0                	test   %eax,%eax
+  805340:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805345:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  805348:	ff 75 18             	push   0x18(%ebp)
+  80534b:	ff 75 14             	push   0x14(%ebp)
+  80534e:	50                   	push   %eax
+  80534f:	ff 75 0c             	push   0xc(%ebp)
+  805352:	ff 75 08             	push   0x8(%ebp)
+  805355:	e8 76 c1 ff ff       	call   8014d0 <sys_ipc_reply_recv>
+  80535a:	83 c4 20             	add    $0x20,%esp
+  80535d:	85 c0                	test   %eax,%eax
+  80535f:	78 46                	js     8053a7 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  805361:	85 ff                	test   %edi,%edi
+  805363:	74 0d                	je     805372 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  805365:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  80536a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  805370:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  805372:	85 f6                	test   %esi,%esi
+  805374:	74 0d                	je     805383 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  805376:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  80537b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  805381:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  805383:	85 db                	test   %ebx,%ebx
+  805385:	74 0d                	je     805394 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  805387:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  80538c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  805392:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  805394:	a1 24 f9 82 00       	mov    0x82f924,%eax
+  805399:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80539f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8053a2:	5b                   	pop    %ebx
+  8053a3:	5e                   	pop    %esi
+  8053a4:	5f                   	pop    %edi
+  8053a5:	5d                   	pop    %ebp
+  8053a6:	c3                   	ret
+		if (from_env_store) {
+  8053a7:	85 ff                	test   %edi,%edi
+  8053a9:	74 06                	je     8053b1 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  8053ab:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8053b1:	85 f6                	test   %esi,%esi
+  8053b3:	74 06                	je     8053bb <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  8053b5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8053bb:	85 db                	test   %ebx,%ebx
+  8053bd:	74 e0                	je     80539f <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  8053bf:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8053c5:	eb d8                	jmp    80539f <ipc_reply_recv+0x76>
+
+008053c7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8053c7:	55                   	push   %ebp
+  8053c8:	89 e5                	mov    %esp,%ebp
+  8053ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8053cd:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8053d2:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8053d5:	c1 e0 06             	shl    $0x6,%eax
+  8053d8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8053dd:	8b 40 50             	mov    0x50(%eax),%eax
+  8053e0:	39 c8                	cmp    %ecx,%eax
+  8053e2:	74 12                	je     8053f6 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8053e4:	83 c2 01             	add    $0x1,%edx
+  8053e7:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8053ed:	75 e3                	jne    8053d2 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8053ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053f4:	eb 0e                	jmp    805404 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8053f6:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8053f9:	c1 e0 06             	shl    $0x6,%eax
+  8053fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805401:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  805404:	5d                   	pop    %ebp
+  805405:	c3                   	ret
+
+00805406 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  805406:	55                   	push   %ebp
+  805407:	89 e5                	mov    %esp,%ebp
+  805409:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80540c:	89 c2                	mov    %eax,%edx
+  80540e:	c1 ea 16             	shr    $0x16,%edx
+  805411:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  805418:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80541d:	f6 c1 01             	test   $0x1,%cl
+  805420:	74 1e                	je     805440 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  805422:	c1 e8 0c             	shr    $0xc,%eax
+  805425:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80542c:	a8 01                	test   $0x1,%al
+  80542e:	74 10                	je     805440 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  805430:	c1 e8 0c             	shr    $0xc,%eax
+  805433:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  805436:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  80543d:	0f b7 d2             	movzwl %dx,%edx
+}
+  805440:	89 d0                	mov    %edx,%eax
+  805442:	5d                   	pop    %ebp
+  805443:	c3                   	ret
+
+00805444 <udivmod>:
+  805444:	55                   	push   %ebp
+  805445:	57                   	push   %edi
+  805446:	56                   	push   %esi
+  805447:	53                   	push   %ebx
+  805448:	83 ec 24             	sub    $0x24,%esp
+  80544b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80544f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  805453:	8b 44 24 38          	mov    0x38(%esp),%eax
+  805457:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80545b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80545f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  805463:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  805467:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80546c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805471:	ba 00 00 00 00       	mov    $0x0,%edx
+  805476:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80547d:	00 
+  80547e:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  805485:	00 
+  805486:	89 fb                	mov    %edi,%ebx
+  805488:	eb 08                	jmp    805492 <udivmod+0x4e>
+  80548a:	83 e9 01             	sub    $0x1,%ecx
+  80548d:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  805490:	74 68                	je     8054fa <udivmod+0xb6>
+  805492:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  805496:	01 c0                	add    %eax,%eax
+  805498:	89 c6                	mov    %eax,%esi
+  80549a:	89 d7                	mov    %edx,%edi
+  80549c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8054a0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8054a4:	0f ad d0             	shrd   %cl,%edx,%eax
+  8054a7:	d3 ea                	shr    %cl,%edx
+  8054a9:	f6 c1 20             	test   $0x20,%cl
+  8054ac:	74 04                	je     8054b2 <udivmod+0x6e>
+  8054ae:	89 d0                	mov    %edx,%eax
+  8054b0:	31 d2                	xor    %edx,%edx
+  8054b2:	83 e0 01             	and    $0x1,%eax
+  8054b5:	89 04 24             	mov    %eax,(%esp)
+  8054b8:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8054bf:	00 
+  8054c0:	8b 04 24             	mov    (%esp),%eax
+  8054c3:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8054c7:	09 f0                	or     %esi,%eax
+  8054c9:	09 fa                	or     %edi,%edx
+  8054cb:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8054cf:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8054d3:	39 f0                	cmp    %esi,%eax
+  8054d5:	89 d5                	mov    %edx,%ebp
+  8054d7:	19 fd                	sbb    %edi,%ebp
+  8054d9:	72 af                	jb     80548a <udivmod+0x46>
+  8054db:	29 f0                	sub    %esi,%eax
+  8054dd:	19 fa                	sbb    %edi,%edx
+  8054df:	89 cf                	mov    %ecx,%edi
+  8054e1:	c1 ef 05             	shr    $0x5,%edi
+  8054e4:	83 e7 01             	and    $0x1,%edi
+  8054e7:	89 fe                	mov    %edi,%esi
+  8054e9:	83 f6 01             	xor    $0x1,%esi
+  8054ec:	d3 e6                	shl    %cl,%esi
+  8054ee:	d3 e7                	shl    %cl,%edi
+  8054f0:	09 74 24 18          	or     %esi,0x18(%esp)
+  8054f4:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8054f8:	eb 90                	jmp    80548a <udivmod+0x46>
+  8054fa:	85 db                	test   %ebx,%ebx
+  8054fc:	74 05                	je     805503 <udivmod+0xbf>
+  8054fe:	89 03                	mov    %eax,(%ebx)
+  805500:	89 53 04             	mov    %edx,0x4(%ebx)
+  805503:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805507:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80550b:	83 c4 24             	add    $0x24,%esp
+  80550e:	5b                   	pop    %ebx
+  80550f:	5e                   	pop    %esi
+  805510:	5f                   	pop    %edi
+  805511:	5d                   	pop    %ebp
+  805512:	c3                   	ret
+
+00805513 <__udivdi3>:
+  805513:	83 ec 08             	sub    $0x8,%esp
+  805516:	6a 00                	push   $0x0
+  805518:	ff 74 24 1c          	push   0x1c(%esp)
+  80551c:	ff 74 24 1c          	push   0x1c(%esp)
+  805520:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805524:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805528:	e8 17 ff ff ff       	call   805444 <udivmod>
+  80552d:	83 c4 14             	add    $0x14,%esp
+  805530:	c3                   	ret
+
+00805531 <__umoddi3>:
+  805531:	83 ec 18             	sub    $0x18,%esp
+  805534:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805538:	50                   	push   %eax
+  805539:	ff 74 24 2c          	push   0x2c(%esp)
+  80553d:	ff 74 24 2c          	push   0x2c(%esp)
+  805541:	8b 44 24 28          	mov    0x28(%esp),%eax
+  805545:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  805549:	e8 f6 fe ff ff       	call   805444 <udivmod>
+  80554e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805552:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805556:	83 c4 24             	add    $0x24,%esp
+  805559:	c3                   	ret
+
+0080555a <__divdi3>:
+  80555a:	55                   	push   %ebp
+  80555b:	57                   	push   %edi
+  80555c:	56                   	push   %esi
+  80555d:	53                   	push   %ebx
+  80555e:	83 ec 10             	sub    $0x10,%esp
+  805561:	8b 44 24 24          	mov    0x24(%esp),%eax
+  805565:	8b 54 24 28          	mov    0x28(%esp),%edx
+  805569:	89 c6                	mov    %eax,%esi
+  80556b:	89 d7                	mov    %edx,%edi
+  80556d:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  805571:	33 7c 24 30          	xor    0x30(%esp),%edi
+  805575:	89 74 24 04          	mov    %esi,0x4(%esp)
+  805579:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  80557d:	89 c5                	mov    %eax,%ebp
+  80557f:	f7 dd                	neg    %ebp
+  805581:	89 d6                	mov    %edx,%esi
+  805583:	83 d6 00             	adc    $0x0,%esi
+  805586:	f7 de                	neg    %esi
+  805588:	0f 48 e8             	cmovs  %eax,%ebp
+  80558b:	0f 49 d6             	cmovns %esi,%edx
+  80558e:	6a 00                	push   $0x0
+  805590:	8b 74 24 30          	mov    0x30(%esp),%esi
+  805594:	f7 de                	neg    %esi
+  805596:	8b 44 24 34          	mov    0x34(%esp),%eax
+  80559a:	83 d0 00             	adc    $0x0,%eax
+  80559d:	f7 d8                	neg    %eax
+  80559f:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  8055a4:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  8055a9:	50                   	push   %eax
+  8055aa:	56                   	push   %esi
+  8055ab:	89 e8                	mov    %ebp,%eax
+  8055ad:	e8 92 fe ff ff       	call   805444 <udivmod>
+  8055b2:	83 c4 10             	add    $0x10,%esp
+  8055b5:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  8055ba:	78 08                	js     8055c4 <__divdi3+0x6a>
+  8055bc:	83 c4 0c             	add    $0xc,%esp
+  8055bf:	5b                   	pop    %ebx
+  8055c0:	5e                   	pop    %esi
+  8055c1:	5f                   	pop    %edi
+  8055c2:	5d                   	pop    %ebp
+  8055c3:	c3                   	ret
+  8055c4:	f7 d8                	neg    %eax
+  8055c6:	83 d2 00             	adc    $0x0,%edx
+  8055c9:	f7 da                	neg    %edx
+  8055cb:	eb ef                	jmp    8055bc <__divdi3+0x62>
+
+008055cd <__moddi3>:
+  8055cd:	55                   	push   %ebp
+  8055ce:	57                   	push   %edi
+  8055cf:	56                   	push   %esi
+  8055d0:	53                   	push   %ebx
+  8055d1:	83 ec 18             	sub    $0x18,%esp
+  8055d4:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8055d8:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8055dc:	89 f1                	mov    %esi,%ecx
+  8055de:	f7 d9                	neg    %ecx
+  8055e0:	89 da                	mov    %ebx,%edx
+  8055e2:	83 d2 00             	adc    $0x0,%edx
+  8055e5:	f7 da                	neg    %edx
+  8055e7:	0f 48 ce             	cmovs  %esi,%ecx
+  8055ea:	0f 48 d3             	cmovs  %ebx,%edx
+  8055ed:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8055f1:	50                   	push   %eax
+  8055f2:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8055f6:	f7 de                	neg    %esi
+  8055f8:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8055fc:	83 d0 00             	adc    $0x0,%eax
+  8055ff:	f7 d8                	neg    %eax
+  805601:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  805606:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  80560b:	50                   	push   %eax
+  80560c:	56                   	push   %esi
+  80560d:	89 c8                	mov    %ecx,%eax
+  80560f:	e8 30 fe ff ff       	call   805444 <udivmod>
+  805614:	83 c4 10             	add    $0x10,%esp
+  805617:	85 db                	test   %ebx,%ebx
+  805619:	78 10                	js     80562b <__moddi3+0x5e>
+  80561b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80561f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805623:	83 c4 14             	add    $0x14,%esp
+  805626:	5b                   	pop    %ebx
+  805627:	5e                   	pop    %esi
+  805628:	5f                   	pop    %edi
+  805629:	5d                   	pop    %ebp
+  80562a:	c3                   	ret
+  80562b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80562f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805633:	f7 d8                	neg    %eax
+  805635:	83 d2 00             	adc    $0x0,%edx
+  805638:	f7 da                	neg    %edx
+  80563a:	eb e7                	jmp    805623 <__moddi3+0x56>
@@ -0,0 +1,10596 @@
+
+obj/user/forktest.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ff 00 00 00       	call   800130 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	int r;
+	uintptr_t va;
+
+	for(va = 0x10000000; va < 0x14000000; va+=PGSIZE){
+  800038:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+		cprintf("+%x\n", va);
+  80003d:	83 ec 08             	sub    $0x8,%esp
+  800040:	53                   	push   %ebx
+  800041:	68 80 53 80 00       	push   $0x805380
+  800046:	e8 23 02 00 00       	call   80026e <cprintf>
+		if((r = page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W, 1)) < 0)
+  80004b:	6a 01                	push   $0x1
+  80004d:	6a 07                	push   $0x7
+  80004f:	53                   	push   %ebx
+  800050:	6a 00                	push   $0x0
+  800052:	e8 13 3b 00 00       	call   803b6a <page_alloc>
+  800057:	83 c4 20             	add    $0x20,%esp
+  80005a:	85 c0                	test   %eax,%eax
+  80005c:	78 4c                	js     8000aa <umain+0x77>
+			panic("sys_page_alloc on %p: %e", va, r);
+
+		// Store the address in the page
+		*(uintptr_t*)va = (uintptr_t)va;
+  80005e:	89 1b                	mov    %ebx,(%ebx)
+	for(va = 0x10000000; va < 0x14000000; va+=PGSIZE){
+  800060:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800066:	81 fb 00 00 00 14    	cmp    $0x14000000,%ebx
+  80006c:	75 cf                	jne    80003d <umain+0xa>
+	}
+
+	if ((r = fork()) == 0) // Child
+  80006e:	e8 bc 13 00 00       	call   80142f <fork>
+  800073:	89 c6                	mov    %eax,%esi
+  800075:	85 c0                	test   %eax,%eax
+  800077:	75 5d                	jne    8000d6 <umain+0xa3>
+	{
+		for(va = 0x10000000; va < 0x14000000; va+=PGSIZE){
+  800079:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+			cprintf("+%x=%x\n", va, *(uintptr_t*)va);
+  80007e:	83 ec 04             	sub    $0x4,%esp
+  800081:	ff 33                	push   (%ebx)
+  800083:	53                   	push   %ebx
+  800084:	68 bb 53 80 00       	push   $0x8053bb
+  800089:	e8 e0 01 00 00       	call   80026e <cprintf>
+			assert(*(uintptr_t*)va == (uintptr_t)va);
+  80008e:	83 c4 10             	add    $0x10,%esp
+  800091:	39 1b                	cmp    %ebx,(%ebx)
+  800093:	75 2b                	jne    8000c0 <umain+0x8d>
+		for(va = 0x10000000; va < 0x14000000; va+=PGSIZE){
+  800095:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80009b:	81 fb 00 00 00 14    	cmp    $0x14000000,%ebx
+  8000a1:	75 db                	jne    80007e <umain+0x4b>
+
+		wait(r);
+
+		cprintf("%s: Passed all checks!\n");
+	}
+}
+  8000a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000a6:	5b                   	pop    %ebx
+  8000a7:	5e                   	pop    %esi
+  8000a8:	5d                   	pop    %ebp
+  8000a9:	c3                   	ret
+			panic("sys_page_alloc on %p: %e", va, r);
+  8000aa:	83 ec 0c             	sub    $0xc,%esp
+  8000ad:	50                   	push   %eax
+  8000ae:	53                   	push   %ebx
+  8000af:	68 85 53 80 00       	push   $0x805385
+  8000b4:	6a 11                	push   $0x11
+  8000b6:	68 9e 53 80 00       	push   $0x80539e
+  8000bb:	e8 d3 00 00 00       	call   800193 <_panic>
+			assert(*(uintptr_t*)va == (uintptr_t)va);
+  8000c0:	68 f0 53 80 00       	push   $0x8053f0
+  8000c5:	68 c3 53 80 00       	push   $0x8053c3
+  8000ca:	6a 1b                	push   $0x1b
+  8000cc:	68 9e 53 80 00       	push   $0x80539e
+  8000d1:	e8 bd 00 00 00       	call   800193 <_panic>
+		for(va = 0x10000000; va < 0x14000000; va+=PGSIZE){
+  8000d6:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+			cprintf("+%x=%x\n", va, *(uintptr_t*)va);
+  8000db:	83 ec 04             	sub    $0x4,%esp
+  8000de:	ff 33                	push   (%ebx)
+  8000e0:	53                   	push   %ebx
+  8000e1:	68 bb 53 80 00       	push   $0x8053bb
+  8000e6:	e8 83 01 00 00       	call   80026e <cprintf>
+			assert(*(uintptr_t*)va == (uintptr_t)va);
+  8000eb:	83 c4 10             	add    $0x10,%esp
+  8000ee:	39 1b                	cmp    %ebx,(%ebx)
+  8000f0:	75 28                	jne    80011a <umain+0xe7>
+		for(va = 0x10000000; va < 0x14000000; va+=PGSIZE){
+  8000f2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8000f8:	81 fb 00 00 00 14    	cmp    $0x14000000,%ebx
+  8000fe:	75 db                	jne    8000db <umain+0xa8>
+		wait(r);
+  800100:	83 ec 0c             	sub    $0xc,%esp
+  800103:	56                   	push   %esi
+  800104:	e8 fa 25 00 00       	call   802703 <wait>
+		cprintf("%s: Passed all checks!\n");
+  800109:	c7 04 24 d8 53 80 00 	movl   $0x8053d8,(%esp)
+  800110:	e8 59 01 00 00       	call   80026e <cprintf>
+  800115:	83 c4 10             	add    $0x10,%esp
+}
+  800118:	eb 89                	jmp    8000a3 <umain+0x70>
+			assert(*(uintptr_t*)va == (uintptr_t)va);
+  80011a:	68 f0 53 80 00       	push   $0x8053f0
+  80011f:	68 c3 53 80 00       	push   $0x8053c3
+  800124:	6a 22                	push   $0x22
+  800126:	68 9e 53 80 00       	push   $0x80539e
+  80012b:	e8 63 00 00 00       	call   800193 <_panic>
+
+00800130 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800130:	55                   	push   %ebp
+  800131:	89 e5                	mov    %esp,%ebp
+  800133:	56                   	push   %esi
+  800134:	53                   	push   %ebx
+  800135:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800138:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  80013b:	e8 ca 0b 00 00       	call   800d0a <sys_getenvid>
+  800140:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800145:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800148:	c1 e0 06             	shl    $0x6,%eax
+  80014b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800150:	a3 18 e9 80 00       	mov    %eax,0x80e918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800155:	85 db                	test   %ebx,%ebx
+  800157:	7e 07                	jle    800160 <libmain+0x30>
+		binaryname = argv[0];
+  800159:	8b 06                	mov    (%esi),%eax
+  80015b:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800160:	83 ec 08             	sub    $0x8,%esp
+  800163:	56                   	push   %esi
+  800164:	53                   	push   %ebx
+  800165:	e8 c9 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80016a:	e8 0a 00 00 00       	call   800179 <exit>
+}
+  80016f:	83 c4 10             	add    $0x10,%esp
+  800172:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800175:	5b                   	pop    %ebx
+  800176:	5e                   	pop    %esi
+  800177:	5d                   	pop    %ebp
+  800178:	c3                   	ret
+
+00800179 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800179:	55                   	push   %ebp
+  80017a:	89 e5                	mov    %esp,%ebp
+  80017c:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80017f:	e8 de 18 00 00       	call   801a62 <close_all>
+	sys_env_destroy(0);
+  800184:	83 ec 0c             	sub    $0xc,%esp
+  800187:	6a 00                	push   $0x0
+  800189:	e8 3b 0b 00 00       	call   800cc9 <sys_env_destroy>
+}
+  80018e:	83 c4 10             	add    $0x10,%esp
+  800191:	c9                   	leave
+  800192:	c3                   	ret
+
+00800193 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800193:	55                   	push   %ebp
+  800194:	89 e5                	mov    %esp,%ebp
+  800196:	56                   	push   %esi
+  800197:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800198:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80019b:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  8001a1:	e8 64 0b 00 00       	call   800d0a <sys_getenvid>
+  8001a6:	83 ec 0c             	sub    $0xc,%esp
+  8001a9:	ff 75 0c             	push   0xc(%ebp)
+  8001ac:	ff 75 08             	push   0x8(%ebp)
+  8001af:	56                   	push   %esi
+  8001b0:	50                   	push   %eax
+  8001b1:	68 1c 54 80 00       	push   $0x80541c
+  8001b6:	e8 b3 00 00 00       	call   80026e <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001bb:	83 c4 18             	add    $0x18,%esp
+  8001be:	53                   	push   %ebx
+  8001bf:	ff 75 10             	push   0x10(%ebp)
+  8001c2:	e8 56 00 00 00       	call   80021d <vcprintf>
+	cprintf("\n");
+  8001c7:	c7 04 24 ee 53 80 00 	movl   $0x8053ee,(%esp)
+  8001ce:	e8 9b 00 00 00       	call   80026e <cprintf>
+  8001d3:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001d6:	cc                   	int3
+	while (1)
+  8001d7:	eb fd                	jmp    8001d6 <_panic+0x43>
+
+008001d9 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001d9:	55                   	push   %ebp
+  8001da:	89 e5                	mov    %esp,%ebp
+  8001dc:	53                   	push   %ebx
+  8001dd:	83 ec 04             	sub    $0x4,%esp
+  8001e0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001e3:	8b 13                	mov    (%ebx),%edx
+  8001e5:	8d 42 01             	lea    0x1(%edx),%eax
+  8001e8:	89 03                	mov    %eax,(%ebx)
+  8001ea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001ed:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001f1:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001f6:	74 09                	je     800201 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001f8:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001ff:	c9                   	leave
+  800200:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800201:	83 ec 08             	sub    $0x8,%esp
+  800204:	68 ff 00 00 00       	push   $0xff
+  800209:	8d 43 08             	lea    0x8(%ebx),%eax
+  80020c:	50                   	push   %eax
+  80020d:	e8 69 0a 00 00       	call   800c7b <sys_cputs>
+		b->idx = 0;
+  800212:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800218:	83 c4 10             	add    $0x10,%esp
+  80021b:	eb db                	jmp    8001f8 <putch+0x1f>
+
+0080021d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80021d:	55                   	push   %ebp
+  80021e:	89 e5                	mov    %esp,%ebp
+  800220:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800226:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80022d:	00 00 00 
+	b.cnt = 0;
+  800230:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800237:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80023a:	ff 75 0c             	push   0xc(%ebp)
+  80023d:	ff 75 08             	push   0x8(%ebp)
+  800240:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800246:	50                   	push   %eax
+  800247:	68 d9 01 80 00       	push   $0x8001d9
+  80024c:	e8 14 01 00 00       	call   800365 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800251:	83 c4 08             	add    $0x8,%esp
+  800254:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80025a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800260:	50                   	push   %eax
+  800261:	e8 15 0a 00 00       	call   800c7b <sys_cputs>
+
+	return b.cnt;
+}
+  800266:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80026c:	c9                   	leave
+  80026d:	c3                   	ret
+
+0080026e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80026e:	55                   	push   %ebp
+  80026f:	89 e5                	mov    %esp,%ebp
+  800271:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800274:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800277:	50                   	push   %eax
+  800278:	ff 75 08             	push   0x8(%ebp)
+  80027b:	e8 9d ff ff ff       	call   80021d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800280:	c9                   	leave
+  800281:	c3                   	ret
+
+00800282 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800282:	55                   	push   %ebp
+  800283:	89 e5                	mov    %esp,%ebp
+  800285:	57                   	push   %edi
+  800286:	56                   	push   %esi
+  800287:	53                   	push   %ebx
+  800288:	83 ec 1c             	sub    $0x1c,%esp
+  80028b:	89 c7                	mov    %eax,%edi
+  80028d:	89 d6                	mov    %edx,%esi
+  80028f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800292:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800295:	89 d1                	mov    %edx,%ecx
+  800297:	89 c2                	mov    %eax,%edx
+  800299:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80029c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80029f:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002a2:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002a8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002af:	39 c2                	cmp    %eax,%edx
+  8002b1:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002b4:	72 3e                	jb     8002f4 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002b6:	83 ec 0c             	sub    $0xc,%esp
+  8002b9:	ff 75 18             	push   0x18(%ebp)
+  8002bc:	83 eb 01             	sub    $0x1,%ebx
+  8002bf:	53                   	push   %ebx
+  8002c0:	50                   	push   %eax
+  8002c1:	83 ec 08             	sub    $0x8,%esp
+  8002c4:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c7:	ff 75 e0             	push   -0x20(%ebp)
+  8002ca:	ff 75 dc             	push   -0x24(%ebp)
+  8002cd:	ff 75 d8             	push   -0x28(%ebp)
+  8002d0:	e8 6e 4f 00 00       	call   805243 <__udivdi3>
+  8002d5:	83 c4 18             	add    $0x18,%esp
+  8002d8:	52                   	push   %edx
+  8002d9:	50                   	push   %eax
+  8002da:	89 f2                	mov    %esi,%edx
+  8002dc:	89 f8                	mov    %edi,%eax
+  8002de:	e8 9f ff ff ff       	call   800282 <printnum>
+  8002e3:	83 c4 20             	add    $0x20,%esp
+  8002e6:	eb 13                	jmp    8002fb <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002e8:	83 ec 08             	sub    $0x8,%esp
+  8002eb:	56                   	push   %esi
+  8002ec:	ff 75 18             	push   0x18(%ebp)
+  8002ef:	ff d7                	call   *%edi
+  8002f1:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002f4:	83 eb 01             	sub    $0x1,%ebx
+  8002f7:	85 db                	test   %ebx,%ebx
+  8002f9:	7f ed                	jg     8002e8 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002fb:	83 ec 08             	sub    $0x8,%esp
+  8002fe:	56                   	push   %esi
+  8002ff:	83 ec 04             	sub    $0x4,%esp
+  800302:	ff 75 e4             	push   -0x1c(%ebp)
+  800305:	ff 75 e0             	push   -0x20(%ebp)
+  800308:	ff 75 dc             	push   -0x24(%ebp)
+  80030b:	ff 75 d8             	push   -0x28(%ebp)
+  80030e:	e8 4e 4f 00 00       	call   805261 <__umoddi3>
+  800313:	83 c4 14             	add    $0x14,%esp
+  800316:	0f be 80 3f 54 80 00 	movsbl 0x80543f(%eax),%eax
+  80031d:	50                   	push   %eax
+  80031e:	ff d7                	call   *%edi
+}
+  800320:	83 c4 10             	add    $0x10,%esp
+  800323:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800326:	5b                   	pop    %ebx
+  800327:	5e                   	pop    %esi
+  800328:	5f                   	pop    %edi
+  800329:	5d                   	pop    %ebp
+  80032a:	c3                   	ret
+
+0080032b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80032b:	55                   	push   %ebp
+  80032c:	89 e5                	mov    %esp,%ebp
+  80032e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800331:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800335:	8b 10                	mov    (%eax),%edx
+  800337:	3b 50 04             	cmp    0x4(%eax),%edx
+  80033a:	73 0a                	jae    800346 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80033c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80033f:	89 08                	mov    %ecx,(%eax)
+  800341:	8b 45 08             	mov    0x8(%ebp),%eax
+  800344:	88 02                	mov    %al,(%edx)
+}
+  800346:	5d                   	pop    %ebp
+  800347:	c3                   	ret
+
+00800348 <printfmt>:
+{
+  800348:	55                   	push   %ebp
+  800349:	89 e5                	mov    %esp,%ebp
+  80034b:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80034e:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800351:	50                   	push   %eax
+  800352:	ff 75 10             	push   0x10(%ebp)
+  800355:	ff 75 0c             	push   0xc(%ebp)
+  800358:	ff 75 08             	push   0x8(%ebp)
+  80035b:	e8 05 00 00 00       	call   800365 <vprintfmt>
+}
+  800360:	83 c4 10             	add    $0x10,%esp
+  800363:	c9                   	leave
+  800364:	c3                   	ret
+
+00800365 <vprintfmt>:
+{
+  800365:	55                   	push   %ebp
+  800366:	89 e5                	mov    %esp,%ebp
+  800368:	57                   	push   %edi
+  800369:	56                   	push   %esi
+  80036a:	53                   	push   %ebx
+  80036b:	83 ec 2c             	sub    $0x2c,%esp
+  80036e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800371:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800374:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800377:	eb 0a                	jmp    800383 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800379:	83 ec 08             	sub    $0x8,%esp
+  80037c:	53                   	push   %ebx
+  80037d:	50                   	push   %eax
+  80037e:	ff d6                	call   *%esi
+  800380:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800383:	83 c7 01             	add    $0x1,%edi
+  800386:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80038a:	83 f8 25             	cmp    $0x25,%eax
+  80038d:	74 0c                	je     80039b <vprintfmt+0x36>
+			if (ch == '\0')
+  80038f:	85 c0                	test   %eax,%eax
+  800391:	75 e6                	jne    800379 <vprintfmt+0x14>
+}
+  800393:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800396:	5b                   	pop    %ebx
+  800397:	5e                   	pop    %esi
+  800398:	5f                   	pop    %edi
+  800399:	5d                   	pop    %ebp
+  80039a:	c3                   	ret
+		padc = ' ';
+  80039b:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80039f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003a6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003ad:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b9:	8d 47 01             	lea    0x1(%edi),%eax
+  8003bc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003bf:	0f b6 17             	movzbl (%edi),%edx
+  8003c2:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003c5:	3c 55                	cmp    $0x55,%al
+  8003c7:	0f 87 c5 03 00 00    	ja     800792 <vprintfmt+0x42d>
+  8003cd:	0f b6 c0             	movzbl %al,%eax
+  8003d0:	ff 24 85 c0 55 80 00 	jmp    *0x8055c0(,%eax,4)
+  8003d7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003da:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003de:	eb d9                	jmp    8003b9 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003e3:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003e7:	eb d0                	jmp    8003b9 <vprintfmt+0x54>
+  8003e9:	0f b6 d2             	movzbl %dl,%edx
+  8003ec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003f7:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003fa:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003fe:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800401:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800404:	83 f9 09             	cmp    $0x9,%ecx
+  800407:	77 55                	ja     80045e <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800409:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80040c:	eb e9                	jmp    8003f7 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80040e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800411:	8b 00                	mov    (%eax),%eax
+  800413:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800416:	8b 45 14             	mov    0x14(%ebp),%eax
+  800419:	8d 40 04             	lea    0x4(%eax),%eax
+  80041c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80041f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800422:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800426:	79 91                	jns    8003b9 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800428:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80042b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80042e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800435:	eb 82                	jmp    8003b9 <vprintfmt+0x54>
+			if (width < 0)
+  800437:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80043a:	85 d2                	test   %edx,%edx
+  80043c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800441:	0f 49 c2             	cmovns %edx,%eax
+  800444:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800447:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80044a:	e9 6a ff ff ff       	jmp    8003b9 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80044f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800452:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800459:	e9 5b ff ff ff       	jmp    8003b9 <vprintfmt+0x54>
+  80045e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800461:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800464:	eb bc                	jmp    800422 <vprintfmt+0xbd>
+			lflag++;
+  800466:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800469:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80046c:	e9 48 ff ff ff       	jmp    8003b9 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800471:	8b 45 14             	mov    0x14(%ebp),%eax
+  800474:	8d 78 04             	lea    0x4(%eax),%edi
+  800477:	83 ec 08             	sub    $0x8,%esp
+  80047a:	53                   	push   %ebx
+  80047b:	ff 30                	push   (%eax)
+  80047d:	ff d6                	call   *%esi
+			break;
+  80047f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800482:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800485:	e9 63 02 00 00       	jmp    8006ed <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  80048a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048d:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800490:	8b 10                	mov    (%eax),%edx
+  800492:	89 d0                	mov    %edx,%eax
+  800494:	f7 d8                	neg    %eax
+  800496:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800499:	83 f8 12             	cmp    $0x12,%eax
+  80049c:	7f 23                	jg     8004c1 <vprintfmt+0x15c>
+  80049e:	8b 14 85 20 57 80 00 	mov    0x805720(,%eax,4),%edx
+  8004a5:	85 d2                	test   %edx,%edx
+  8004a7:	74 18                	je     8004c1 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004a9:	52                   	push   %edx
+  8004aa:	68 d5 53 80 00       	push   $0x8053d5
+  8004af:	53                   	push   %ebx
+  8004b0:	56                   	push   %esi
+  8004b1:	e8 92 fe ff ff       	call   800348 <printfmt>
+  8004b6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004b9:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004bc:	e9 2c 02 00 00       	jmp    8006ed <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  8004c1:	50                   	push   %eax
+  8004c2:	68 57 54 80 00       	push   $0x805457
+  8004c7:	53                   	push   %ebx
+  8004c8:	56                   	push   %esi
+  8004c9:	e8 7a fe ff ff       	call   800348 <printfmt>
+  8004ce:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004d1:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004d4:	e9 14 02 00 00       	jmp    8006ed <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004dc:	83 c0 04             	add    $0x4,%eax
+  8004df:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e5:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004e7:	85 c9                	test   %ecx,%ecx
+  8004e9:	b8 50 54 80 00       	mov    $0x805450,%eax
+  8004ee:	0f 45 c1             	cmovne %ecx,%eax
+  8004f1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004f4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004f8:	7e 06                	jle    800500 <vprintfmt+0x19b>
+  8004fa:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004fe:	75 0b                	jne    80050b <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800500:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800503:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800506:	89 75 08             	mov    %esi,0x8(%ebp)
+  800509:	eb 5c                	jmp    800567 <vprintfmt+0x202>
+  80050b:	83 ec 08             	sub    $0x8,%esp
+  80050e:	ff 75 d0             	push   -0x30(%ebp)
+  800511:	ff 75 cc             	push   -0x34(%ebp)
+  800514:	e8 19 03 00 00       	call   800832 <strnlen>
+  800519:	89 c2                	mov    %eax,%edx
+  80051b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80051e:	29 d0                	sub    %edx,%eax
+  800520:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800523:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800527:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80052a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80052d:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80052f:	eb 0e                	jmp    80053f <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800531:	83 ec 08             	sub    $0x8,%esp
+  800534:	53                   	push   %ebx
+  800535:	57                   	push   %edi
+  800536:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800539:	83 ee 01             	sub    $0x1,%esi
+  80053c:	83 c4 10             	add    $0x10,%esp
+  80053f:	85 f6                	test   %esi,%esi
+  800541:	7f ee                	jg     800531 <vprintfmt+0x1cc>
+  800543:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800546:	8b 75 08             	mov    0x8(%ebp),%esi
+  800549:	85 c0                	test   %eax,%eax
+  80054b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800550:	0f 49 d0             	cmovns %eax,%edx
+  800553:	29 d0                	sub    %edx,%eax
+  800555:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800558:	eb a6                	jmp    800500 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80055a:	83 ec 08             	sub    $0x8,%esp
+  80055d:	53                   	push   %ebx
+  80055e:	52                   	push   %edx
+  80055f:	ff 55 08             	call   *0x8(%ebp)
+  800562:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800565:	89 f1                	mov    %esi,%ecx
+  800567:	8d 71 01             	lea    0x1(%ecx),%esi
+  80056a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80056e:	0f be d0             	movsbl %al,%edx
+  800571:	85 d2                	test   %edx,%edx
+  800573:	74 28                	je     80059d <vprintfmt+0x238>
+  800575:	85 ff                	test   %edi,%edi
+  800577:	78 05                	js     80057e <vprintfmt+0x219>
+  800579:	83 ef 01             	sub    $0x1,%edi
+  80057c:	78 30                	js     8005ae <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80057e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800582:	74 d6                	je     80055a <vprintfmt+0x1f5>
+  800584:	0f be c0             	movsbl %al,%eax
+  800587:	83 e8 20             	sub    $0x20,%eax
+  80058a:	83 f8 5e             	cmp    $0x5e,%eax
+  80058d:	76 cb                	jbe    80055a <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80058f:	83 ec 08             	sub    $0x8,%esp
+  800592:	53                   	push   %ebx
+  800593:	6a 3f                	push   $0x3f
+  800595:	ff 55 08             	call   *0x8(%ebp)
+  800598:	83 c4 10             	add    $0x10,%esp
+  80059b:	eb c8                	jmp    800565 <vprintfmt+0x200>
+  80059d:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005a0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005a3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005a6:	01 d0                	add    %edx,%eax
+  8005a8:	29 c8                	sub    %ecx,%eax
+  8005aa:	89 c7                	mov    %eax,%edi
+  8005ac:	eb 13                	jmp    8005c1 <vprintfmt+0x25c>
+  8005ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005b1:	eb ed                	jmp    8005a0 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005b3:	83 ec 08             	sub    $0x8,%esp
+  8005b6:	53                   	push   %ebx
+  8005b7:	6a 20                	push   $0x20
+  8005b9:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005bb:	83 ef 01             	sub    $0x1,%edi
+  8005be:	83 c4 10             	add    $0x10,%esp
+  8005c1:	85 ff                	test   %edi,%edi
+  8005c3:	7f ee                	jg     8005b3 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005c5:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005c8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005cb:	e9 1d 01 00 00       	jmp    8006ed <vprintfmt+0x388>
+	if (lflag >= 2)
+  8005d0:	83 f9 01             	cmp    $0x1,%ecx
+  8005d3:	7f 1b                	jg     8005f0 <vprintfmt+0x28b>
+	else if (lflag)
+  8005d5:	85 c9                	test   %ecx,%ecx
+  8005d7:	74 63                	je     80063c <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  8005d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dc:	8b 00                	mov    (%eax),%eax
+  8005de:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e1:	99                   	cltd
+  8005e2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ee:	eb 17                	jmp    800607 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  8005f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f3:	8b 50 04             	mov    0x4(%eax),%edx
+  8005f6:	8b 00                	mov    (%eax),%eax
+  8005f8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005fb:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800601:	8d 40 08             	lea    0x8(%eax),%eax
+  800604:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800607:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80060a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80060d:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800612:	85 c9                	test   %ecx,%ecx
+  800614:	0f 89 b9 00 00 00    	jns    8006d3 <vprintfmt+0x36e>
+				putch('-', putdat);
+  80061a:	83 ec 08             	sub    $0x8,%esp
+  80061d:	53                   	push   %ebx
+  80061e:	6a 2d                	push   $0x2d
+  800620:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800622:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800625:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800628:	f7 da                	neg    %edx
+  80062a:	83 d1 00             	adc    $0x0,%ecx
+  80062d:	f7 d9                	neg    %ecx
+  80062f:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800632:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800637:	e9 97 00 00 00       	jmp    8006d3 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  80063c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063f:	8b 00                	mov    (%eax),%eax
+  800641:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800644:	99                   	cltd
+  800645:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800648:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064b:	8d 40 04             	lea    0x4(%eax),%eax
+  80064e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800651:	eb b4                	jmp    800607 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  800653:	83 f9 01             	cmp    $0x1,%ecx
+  800656:	7f 1b                	jg     800673 <vprintfmt+0x30e>
+	else if (lflag)
+  800658:	85 c9                	test   %ecx,%ecx
+  80065a:	74 2c                	je     800688 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  80065c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065f:	8b 10                	mov    (%eax),%edx
+  800661:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800666:	8d 40 04             	lea    0x4(%eax),%eax
+  800669:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80066c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800671:	eb 60                	jmp    8006d3 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800673:	8b 45 14             	mov    0x14(%ebp),%eax
+  800676:	8b 10                	mov    (%eax),%edx
+  800678:	8b 48 04             	mov    0x4(%eax),%ecx
+  80067b:	8d 40 08             	lea    0x8(%eax),%eax
+  80067e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800681:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800686:	eb 4b                	jmp    8006d3 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800688:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068b:	8b 10                	mov    (%eax),%edx
+  80068d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800692:	8d 40 04             	lea    0x4(%eax),%eax
+  800695:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800698:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80069d:	eb 34                	jmp    8006d3 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80069f:	83 f9 01             	cmp    $0x1,%ecx
+  8006a2:	7f 15                	jg     8006b9 <vprintfmt+0x354>
+	else if (lflag)
+  8006a4:	85 c9                	test   %ecx,%ecx
+  8006a6:	74 4d                	je     8006f5 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8006a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ab:	8b 00                	mov    (%eax),%eax
+  8006ad:	99                   	cltd
+  8006ae:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006b1:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8006b4:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8006b7:	eb 11                	jmp    8006ca <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  8006b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bc:	8b 50 04             	mov    0x4(%eax),%edx
+  8006bf:	8b 00                	mov    (%eax),%eax
+  8006c1:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006c4:	8d 49 08             	lea    0x8(%ecx),%ecx
+  8006c7:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  8006ca:	89 d1                	mov    %edx,%ecx
+  8006cc:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  8006ce:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006d3:	83 ec 0c             	sub    $0xc,%esp
+  8006d6:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006da:	50                   	push   %eax
+  8006db:	ff 75 e0             	push   -0x20(%ebp)
+  8006de:	57                   	push   %edi
+  8006df:	51                   	push   %ecx
+  8006e0:	52                   	push   %edx
+  8006e1:	89 da                	mov    %ebx,%edx
+  8006e3:	89 f0                	mov    %esi,%eax
+  8006e5:	e8 98 fb ff ff       	call   800282 <printnum>
+			break;
+  8006ea:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006ed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006f0:	e9 8e fc ff ff       	jmp    800383 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  8006f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f8:	8b 00                	mov    (%eax),%eax
+  8006fa:	99                   	cltd
+  8006fb:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006fe:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800701:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800704:	eb c4                	jmp    8006ca <vprintfmt+0x365>
+			putch('0', putdat);
+  800706:	83 ec 08             	sub    $0x8,%esp
+  800709:	53                   	push   %ebx
+  80070a:	6a 30                	push   $0x30
+  80070c:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80070e:	83 c4 08             	add    $0x8,%esp
+  800711:	53                   	push   %ebx
+  800712:	6a 78                	push   $0x78
+  800714:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800716:	8b 45 14             	mov    0x14(%ebp),%eax
+  800719:	8b 10                	mov    (%eax),%edx
+  80071b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800720:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800723:	8d 40 04             	lea    0x4(%eax),%eax
+  800726:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800729:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  80072e:	eb a3                	jmp    8006d3 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800730:	83 f9 01             	cmp    $0x1,%ecx
+  800733:	7f 1b                	jg     800750 <vprintfmt+0x3eb>
+	else if (lflag)
+  800735:	85 c9                	test   %ecx,%ecx
+  800737:	74 2f                	je     800768 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800739:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073c:	8b 10                	mov    (%eax),%edx
+  80073e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800743:	8d 40 04             	lea    0x4(%eax),%eax
+  800746:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800749:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80074e:	eb 83                	jmp    8006d3 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800750:	8b 45 14             	mov    0x14(%ebp),%eax
+  800753:	8b 10                	mov    (%eax),%edx
+  800755:	8b 48 04             	mov    0x4(%eax),%ecx
+  800758:	8d 40 08             	lea    0x8(%eax),%eax
+  80075b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80075e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800763:	e9 6b ff ff ff       	jmp    8006d3 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800768:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076b:	8b 10                	mov    (%eax),%edx
+  80076d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800772:	8d 40 04             	lea    0x4(%eax),%eax
+  800775:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800778:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80077d:	e9 51 ff ff ff       	jmp    8006d3 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800782:	83 ec 08             	sub    $0x8,%esp
+  800785:	53                   	push   %ebx
+  800786:	6a 25                	push   $0x25
+  800788:	ff d6                	call   *%esi
+			break;
+  80078a:	83 c4 10             	add    $0x10,%esp
+  80078d:	e9 5b ff ff ff       	jmp    8006ed <vprintfmt+0x388>
+			putch('%', putdat);
+  800792:	83 ec 08             	sub    $0x8,%esp
+  800795:	53                   	push   %ebx
+  800796:	6a 25                	push   $0x25
+  800798:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80079a:	83 c4 10             	add    $0x10,%esp
+  80079d:	89 f8                	mov    %edi,%eax
+  80079f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007a3:	74 05                	je     8007aa <vprintfmt+0x445>
+  8007a5:	83 e8 01             	sub    $0x1,%eax
+  8007a8:	eb f5                	jmp    80079f <vprintfmt+0x43a>
+  8007aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007ad:	e9 3b ff ff ff       	jmp    8006ed <vprintfmt+0x388>
+
+008007b2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007b2:	55                   	push   %ebp
+  8007b3:	89 e5                	mov    %esp,%ebp
+  8007b5:	83 ec 18             	sub    $0x18,%esp
+  8007b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007be:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007c1:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007c5:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007c8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007cf:	85 c0                	test   %eax,%eax
+  8007d1:	74 26                	je     8007f9 <vsnprintf+0x47>
+  8007d3:	85 d2                	test   %edx,%edx
+  8007d5:	7e 22                	jle    8007f9 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007d7:	ff 75 14             	push   0x14(%ebp)
+  8007da:	ff 75 10             	push   0x10(%ebp)
+  8007dd:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007e0:	50                   	push   %eax
+  8007e1:	68 2b 03 80 00       	push   $0x80032b
+  8007e6:	e8 7a fb ff ff       	call   800365 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007eb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007ee:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007f4:	83 c4 10             	add    $0x10,%esp
+}
+  8007f7:	c9                   	leave
+  8007f8:	c3                   	ret
+		return -E_INVAL;
+  8007f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007fe:	eb f7                	jmp    8007f7 <vsnprintf+0x45>
+
+00800800 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800800:	55                   	push   %ebp
+  800801:	89 e5                	mov    %esp,%ebp
+  800803:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800806:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800809:	50                   	push   %eax
+  80080a:	ff 75 10             	push   0x10(%ebp)
+  80080d:	ff 75 0c             	push   0xc(%ebp)
+  800810:	ff 75 08             	push   0x8(%ebp)
+  800813:	e8 9a ff ff ff       	call   8007b2 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800818:	c9                   	leave
+  800819:	c3                   	ret
+
+0080081a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80081a:	55                   	push   %ebp
+  80081b:	89 e5                	mov    %esp,%ebp
+  80081d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800820:	b8 00 00 00 00       	mov    $0x0,%eax
+  800825:	eb 03                	jmp    80082a <strlen+0x10>
+		n++;
+  800827:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80082a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80082e:	75 f7                	jne    800827 <strlen+0xd>
+	return n;
+}
+  800830:	5d                   	pop    %ebp
+  800831:	c3                   	ret
+
+00800832 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800832:	55                   	push   %ebp
+  800833:	89 e5                	mov    %esp,%ebp
+  800835:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800838:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80083b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800840:	eb 03                	jmp    800845 <strnlen+0x13>
+		n++;
+  800842:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800845:	39 d0                	cmp    %edx,%eax
+  800847:	74 08                	je     800851 <strnlen+0x1f>
+  800849:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80084d:	75 f3                	jne    800842 <strnlen+0x10>
+  80084f:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800851:	89 d0                	mov    %edx,%eax
+  800853:	5d                   	pop    %ebp
+  800854:	c3                   	ret
+
+00800855 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800855:	55                   	push   %ebp
+  800856:	89 e5                	mov    %esp,%ebp
+  800858:	53                   	push   %ebx
+  800859:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80085c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80085f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800864:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800868:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80086b:	83 c0 01             	add    $0x1,%eax
+  80086e:	84 d2                	test   %dl,%dl
+  800870:	75 f2                	jne    800864 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800872:	89 c8                	mov    %ecx,%eax
+  800874:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800877:	c9                   	leave
+  800878:	c3                   	ret
+
+00800879 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800879:	55                   	push   %ebp
+  80087a:	89 e5                	mov    %esp,%ebp
+  80087c:	53                   	push   %ebx
+  80087d:	83 ec 10             	sub    $0x10,%esp
+  800880:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800883:	53                   	push   %ebx
+  800884:	e8 91 ff ff ff       	call   80081a <strlen>
+  800889:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80088c:	ff 75 0c             	push   0xc(%ebp)
+  80088f:	01 d8                	add    %ebx,%eax
+  800891:	50                   	push   %eax
+  800892:	e8 be ff ff ff       	call   800855 <strcpy>
+	return dst;
+}
+  800897:	89 d8                	mov    %ebx,%eax
+  800899:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80089c:	c9                   	leave
+  80089d:	c3                   	ret
+
+0080089e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80089e:	55                   	push   %ebp
+  80089f:	89 e5                	mov    %esp,%ebp
+  8008a1:	56                   	push   %esi
+  8008a2:	53                   	push   %ebx
+  8008a3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008a9:	89 f3                	mov    %esi,%ebx
+  8008ab:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008ae:	89 f0                	mov    %esi,%eax
+  8008b0:	eb 0f                	jmp    8008c1 <strncpy+0x23>
+		*dst++ = *src;
+  8008b2:	83 c0 01             	add    $0x1,%eax
+  8008b5:	0f b6 0a             	movzbl (%edx),%ecx
+  8008b8:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008bb:	80 f9 01             	cmp    $0x1,%cl
+  8008be:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008c1:	39 d8                	cmp    %ebx,%eax
+  8008c3:	75 ed                	jne    8008b2 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008c5:	89 f0                	mov    %esi,%eax
+  8008c7:	5b                   	pop    %ebx
+  8008c8:	5e                   	pop    %esi
+  8008c9:	5d                   	pop    %ebp
+  8008ca:	c3                   	ret
+
+008008cb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008cb:	55                   	push   %ebp
+  8008cc:	89 e5                	mov    %esp,%ebp
+  8008ce:	56                   	push   %esi
+  8008cf:	53                   	push   %ebx
+  8008d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008d6:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008d9:	89 f0                	mov    %esi,%eax
+  8008db:	85 d2                	test   %edx,%edx
+  8008dd:	74 21                	je     800900 <strlcpy+0x35>
+  8008df:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008e3:	89 f2                	mov    %esi,%edx
+  8008e5:	eb 09                	jmp    8008f0 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008e7:	83 c1 01             	add    $0x1,%ecx
+  8008ea:	83 c2 01             	add    $0x1,%edx
+  8008ed:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008f0:	39 c2                	cmp    %eax,%edx
+  8008f2:	74 09                	je     8008fd <strlcpy+0x32>
+  8008f4:	0f b6 19             	movzbl (%ecx),%ebx
+  8008f7:	84 db                	test   %bl,%bl
+  8008f9:	75 ec                	jne    8008e7 <strlcpy+0x1c>
+  8008fb:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008fd:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800900:	29 f0                	sub    %esi,%eax
+}
+  800902:	5b                   	pop    %ebx
+  800903:	5e                   	pop    %esi
+  800904:	5d                   	pop    %ebp
+  800905:	c3                   	ret
+
+00800906 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800906:	55                   	push   %ebp
+  800907:	89 e5                	mov    %esp,%ebp
+  800909:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80090c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80090f:	eb 06                	jmp    800917 <strcmp+0x11>
+		p++, q++;
+  800911:	83 c1 01             	add    $0x1,%ecx
+  800914:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800917:	0f b6 01             	movzbl (%ecx),%eax
+  80091a:	84 c0                	test   %al,%al
+  80091c:	74 04                	je     800922 <strcmp+0x1c>
+  80091e:	3a 02                	cmp    (%edx),%al
+  800920:	74 ef                	je     800911 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800922:	0f b6 c0             	movzbl %al,%eax
+  800925:	0f b6 12             	movzbl (%edx),%edx
+  800928:	29 d0                	sub    %edx,%eax
+}
+  80092a:	5d                   	pop    %ebp
+  80092b:	c3                   	ret
+
+0080092c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80092c:	55                   	push   %ebp
+  80092d:	89 e5                	mov    %esp,%ebp
+  80092f:	53                   	push   %ebx
+  800930:	8b 45 08             	mov    0x8(%ebp),%eax
+  800933:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800936:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800939:	eb 09                	jmp    800944 <strncmp+0x18>
+		n--, p++, q++;
+  80093b:	83 ea 01             	sub    $0x1,%edx
+  80093e:	83 c0 01             	add    $0x1,%eax
+  800941:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800944:	85 d2                	test   %edx,%edx
+  800946:	74 18                	je     800960 <strncmp+0x34>
+  800948:	0f b6 18             	movzbl (%eax),%ebx
+  80094b:	84 db                	test   %bl,%bl
+  80094d:	74 04                	je     800953 <strncmp+0x27>
+  80094f:	3a 19                	cmp    (%ecx),%bl
+  800951:	74 e8                	je     80093b <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800953:	0f b6 00             	movzbl (%eax),%eax
+  800956:	0f b6 11             	movzbl (%ecx),%edx
+  800959:	29 d0                	sub    %edx,%eax
+}
+  80095b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80095e:	c9                   	leave
+  80095f:	c3                   	ret
+		return 0;
+  800960:	b8 00 00 00 00       	mov    $0x0,%eax
+  800965:	eb f4                	jmp    80095b <strncmp+0x2f>
+
+00800967 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800967:	55                   	push   %ebp
+  800968:	89 e5                	mov    %esp,%ebp
+  80096a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800971:	eb 03                	jmp    800976 <strchr+0xf>
+  800973:	83 c0 01             	add    $0x1,%eax
+  800976:	0f b6 10             	movzbl (%eax),%edx
+  800979:	84 d2                	test   %dl,%dl
+  80097b:	74 06                	je     800983 <strchr+0x1c>
+		if (*s == c)
+  80097d:	38 ca                	cmp    %cl,%dl
+  80097f:	75 f2                	jne    800973 <strchr+0xc>
+  800981:	eb 05                	jmp    800988 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800983:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800988:	5d                   	pop    %ebp
+  800989:	c3                   	ret
+
+0080098a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80098a:	55                   	push   %ebp
+  80098b:	89 e5                	mov    %esp,%ebp
+  80098d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800990:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800994:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800997:	38 ca                	cmp    %cl,%dl
+  800999:	74 09                	je     8009a4 <strfind+0x1a>
+  80099b:	84 d2                	test   %dl,%dl
+  80099d:	74 05                	je     8009a4 <strfind+0x1a>
+	for (; *s; s++)
+  80099f:	83 c0 01             	add    $0x1,%eax
+  8009a2:	eb f0                	jmp    800994 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009a4:	5d                   	pop    %ebp
+  8009a5:	c3                   	ret
+
+008009a6 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009a6:	55                   	push   %ebp
+  8009a7:	89 e5                	mov    %esp,%ebp
+  8009a9:	57                   	push   %edi
+  8009aa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009ad:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009b0:	85 c9                	test   %ecx,%ecx
+  8009b2:	74 20                	je     8009d4 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009b4:	89 f8                	mov    %edi,%eax
+  8009b6:	09 c8                	or     %ecx,%eax
+  8009b8:	a8 03                	test   $0x3,%al
+  8009ba:	75 12                	jne    8009ce <memset+0x28>
+		c &= 0xFF;
+  8009bc:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009c0:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009c6:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009c9:	fc                   	cld
+  8009ca:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009cc:	eb 06                	jmp    8009d4 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009d1:	fc                   	cld
+  8009d2:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009d4:	89 f8                	mov    %edi,%eax
+  8009d6:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009d9:	c9                   	leave
+  8009da:	c3                   	ret
+
+008009db <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	57                   	push   %edi
+  8009df:	56                   	push   %esi
+  8009e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009e6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009e9:	39 c6                	cmp    %eax,%esi
+  8009eb:	73 32                	jae    800a1f <memmove+0x44>
+  8009ed:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009f0:	39 d0                	cmp    %edx,%eax
+  8009f2:	73 2b                	jae    800a1f <memmove+0x44>
+		s += n;
+		d += n;
+  8009f4:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009f7:	89 d6                	mov    %edx,%esi
+  8009f9:	09 fe                	or     %edi,%esi
+  8009fb:	09 ce                	or     %ecx,%esi
+  8009fd:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a03:	75 0e                	jne    800a13 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a05:	83 ef 04             	sub    $0x4,%edi
+  800a08:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a0b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a0e:	fd                   	std
+  800a0f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a11:	eb 09                	jmp    800a1c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a13:	83 ef 01             	sub    $0x1,%edi
+  800a16:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a19:	fd                   	std
+  800a1a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a1c:	fc                   	cld
+  800a1d:	eb 1a                	jmp    800a39 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a1f:	89 f2                	mov    %esi,%edx
+  800a21:	09 c2                	or     %eax,%edx
+  800a23:	09 ca                	or     %ecx,%edx
+  800a25:	f6 c2 03             	test   $0x3,%dl
+  800a28:	75 0a                	jne    800a34 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a2a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a2d:	89 c7                	mov    %eax,%edi
+  800a2f:	fc                   	cld
+  800a30:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a32:	eb 05                	jmp    800a39 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a34:	89 c7                	mov    %eax,%edi
+  800a36:	fc                   	cld
+  800a37:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a39:	5e                   	pop    %esi
+  800a3a:	5f                   	pop    %edi
+  800a3b:	5d                   	pop    %ebp
+  800a3c:	c3                   	ret
+
+00800a3d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a3d:	55                   	push   %ebp
+  800a3e:	89 e5                	mov    %esp,%ebp
+  800a40:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a43:	ff 75 10             	push   0x10(%ebp)
+  800a46:	ff 75 0c             	push   0xc(%ebp)
+  800a49:	ff 75 08             	push   0x8(%ebp)
+  800a4c:	e8 8a ff ff ff       	call   8009db <memmove>
+}
+  800a51:	c9                   	leave
+  800a52:	c3                   	ret
+
+00800a53 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a53:	55                   	push   %ebp
+  800a54:	89 e5                	mov    %esp,%ebp
+  800a56:	56                   	push   %esi
+  800a57:	53                   	push   %ebx
+  800a58:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a5e:	89 c6                	mov    %eax,%esi
+  800a60:	03 75 10             	add    0x10(%ebp),%esi
+  800a63:	eb 06                	jmp    800a6b <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a65:	83 c0 01             	add    $0x1,%eax
+  800a68:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a6b:	39 f0                	cmp    %esi,%eax
+  800a6d:	74 14                	je     800a83 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a6f:	0f b6 08             	movzbl (%eax),%ecx
+  800a72:	0f b6 1a             	movzbl (%edx),%ebx
+  800a75:	38 d9                	cmp    %bl,%cl
+  800a77:	74 ec                	je     800a65 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a79:	0f b6 c1             	movzbl %cl,%eax
+  800a7c:	0f b6 db             	movzbl %bl,%ebx
+  800a7f:	29 d8                	sub    %ebx,%eax
+  800a81:	eb 05                	jmp    800a88 <memcmp+0x35>
+	}
+
+	return 0;
+  800a83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a88:	5b                   	pop    %ebx
+  800a89:	5e                   	pop    %esi
+  800a8a:	5d                   	pop    %ebp
+  800a8b:	c3                   	ret
+
+00800a8c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a8c:	55                   	push   %ebp
+  800a8d:	89 e5                	mov    %esp,%ebp
+  800a8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a95:	89 c2                	mov    %eax,%edx
+  800a97:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a9a:	eb 03                	jmp    800a9f <memfind+0x13>
+  800a9c:	83 c0 01             	add    $0x1,%eax
+  800a9f:	39 d0                	cmp    %edx,%eax
+  800aa1:	73 04                	jae    800aa7 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800aa3:	38 08                	cmp    %cl,(%eax)
+  800aa5:	75 f5                	jne    800a9c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800aa7:	5d                   	pop    %ebp
+  800aa8:	c3                   	ret
+
+00800aa9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800aa9:	55                   	push   %ebp
+  800aaa:	89 e5                	mov    %esp,%ebp
+  800aac:	57                   	push   %edi
+  800aad:	56                   	push   %esi
+  800aae:	53                   	push   %ebx
+  800aaf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ab2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ab5:	eb 03                	jmp    800aba <strtol+0x11>
+		s++;
+  800ab7:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800aba:	0f b6 02             	movzbl (%edx),%eax
+  800abd:	3c 20                	cmp    $0x20,%al
+  800abf:	74 f6                	je     800ab7 <strtol+0xe>
+  800ac1:	3c 09                	cmp    $0x9,%al
+  800ac3:	74 f2                	je     800ab7 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ac5:	3c 2b                	cmp    $0x2b,%al
+  800ac7:	74 2a                	je     800af3 <strtol+0x4a>
+	int neg = 0;
+  800ac9:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ace:	3c 2d                	cmp    $0x2d,%al
+  800ad0:	74 2b                	je     800afd <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ad2:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ad8:	75 0f                	jne    800ae9 <strtol+0x40>
+  800ada:	80 3a 30             	cmpb   $0x30,(%edx)
+  800add:	74 28                	je     800b07 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800adf:	85 db                	test   %ebx,%ebx
+  800ae1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ae6:	0f 44 d8             	cmove  %eax,%ebx
+  800ae9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aee:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800af1:	eb 46                	jmp    800b39 <strtol+0x90>
+		s++;
+  800af3:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800af6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800afb:	eb d5                	jmp    800ad2 <strtol+0x29>
+		s++, neg = 1;
+  800afd:	83 c2 01             	add    $0x1,%edx
+  800b00:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b05:	eb cb                	jmp    800ad2 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b07:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b0b:	74 0e                	je     800b1b <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b0d:	85 db                	test   %ebx,%ebx
+  800b0f:	75 d8                	jne    800ae9 <strtol+0x40>
+		s++, base = 8;
+  800b11:	83 c2 01             	add    $0x1,%edx
+  800b14:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b19:	eb ce                	jmp    800ae9 <strtol+0x40>
+		s += 2, base = 16;
+  800b1b:	83 c2 02             	add    $0x2,%edx
+  800b1e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b23:	eb c4                	jmp    800ae9 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b25:	0f be c0             	movsbl %al,%eax
+  800b28:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b2b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b2e:	7d 3a                	jge    800b6a <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b30:	83 c2 01             	add    $0x1,%edx
+  800b33:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b37:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b39:	0f b6 02             	movzbl (%edx),%eax
+  800b3c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b3f:	89 f3                	mov    %esi,%ebx
+  800b41:	80 fb 09             	cmp    $0x9,%bl
+  800b44:	76 df                	jbe    800b25 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b46:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b49:	89 f3                	mov    %esi,%ebx
+  800b4b:	80 fb 19             	cmp    $0x19,%bl
+  800b4e:	77 08                	ja     800b58 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b50:	0f be c0             	movsbl %al,%eax
+  800b53:	83 e8 57             	sub    $0x57,%eax
+  800b56:	eb d3                	jmp    800b2b <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b58:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b5b:	89 f3                	mov    %esi,%ebx
+  800b5d:	80 fb 19             	cmp    $0x19,%bl
+  800b60:	77 08                	ja     800b6a <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b62:	0f be c0             	movsbl %al,%eax
+  800b65:	83 e8 37             	sub    $0x37,%eax
+  800b68:	eb c1                	jmp    800b2b <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b6a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b6e:	74 05                	je     800b75 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b73:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b75:	89 c8                	mov    %ecx,%eax
+  800b77:	f7 d8                	neg    %eax
+  800b79:	85 ff                	test   %edi,%edi
+  800b7b:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b7e:	89 c8                	mov    %ecx,%eax
+  800b80:	5b                   	pop    %ebx
+  800b81:	5e                   	pop    %esi
+  800b82:	5f                   	pop    %edi
+  800b83:	5d                   	pop    %ebp
+  800b84:	c3                   	ret
+
+00800b85 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800b85:	55                   	push   %ebp
+  800b86:	89 e5                	mov    %esp,%ebp
+  800b88:	57                   	push   %edi
+  800b89:	56                   	push   %esi
+  800b8a:	53                   	push   %ebx
+  800b8b:	83 ec 0c             	sub    $0xc,%esp
+  800b8e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b91:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b94:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800b97:	85 ff                	test   %edi,%edi
+  800b99:	74 16                	je     800bb1 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800b9b:	83 ec 04             	sub    $0x4,%esp
+  800b9e:	56                   	push   %esi
+  800b9f:	6a 00                	push   $0x0
+  800ba1:	53                   	push   %ebx
+  800ba2:	e8 02 ff ff ff       	call   800aa9 <strtol>
+  800ba7:	89 07                	mov    %eax,(%edi)
+  800ba9:	83 c4 10             	add    $0x10,%esp
+  800bac:	eb 03                	jmp    800bb1 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800bae:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800bb1:	0f b6 03             	movzbl (%ebx),%eax
+  800bb4:	3c 20                	cmp    $0x20,%al
+  800bb6:	74 f6                	je     800bae <strisl+0x29>
+  800bb8:	3c 09                	cmp    $0x9,%al
+  800bba:	74 f2                	je     800bae <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bbc:	3c 2b                	cmp    $0x2b,%al
+  800bbe:	74 23                	je     800be3 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800bc0:	3c 2d                	cmp    $0x2d,%al
+  800bc2:	0f 94 c0             	sete   %al
+  800bc5:	0f b6 c0             	movzbl %al,%eax
+  800bc8:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bca:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800bd0:	75 41                	jne    800c13 <strisl+0x8e>
+  800bd2:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800bd5:	74 11                	je     800be8 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bd7:	85 f6                	test   %esi,%esi
+  800bd9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bde:	0f 44 f0             	cmove  %eax,%esi
+  800be1:	eb 30                	jmp    800c13 <strisl+0x8e>
+		s++;
+  800be3:	83 c3 01             	add    $0x1,%ebx
+  800be6:	eb e2                	jmp    800bca <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800be8:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800bec:	74 0e                	je     800bfc <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800bee:	85 f6                	test   %esi,%esi
+  800bf0:	75 21                	jne    800c13 <strisl+0x8e>
+		s++, base = 8;
+  800bf2:	83 c3 01             	add    $0x1,%ebx
+  800bf5:	be 08 00 00 00       	mov    $0x8,%esi
+  800bfa:	eb 17                	jmp    800c13 <strisl+0x8e>
+		s += 2, base = 16;
+  800bfc:	83 c3 02             	add    $0x2,%ebx
+  800bff:	be 10 00 00 00       	mov    $0x10,%esi
+  800c04:	eb 0d                	jmp    800c13 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c06:	0f be c0             	movsbl %al,%eax
+  800c09:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800c0c:	39 f0                	cmp    %esi,%eax
+  800c0e:	7d 38                	jge    800c48 <strisl+0xc3>
+			return 0;
+		s++;
+  800c10:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800c13:	0f b6 03             	movzbl (%ebx),%eax
+  800c16:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800c19:	80 fa 09             	cmp    $0x9,%dl
+  800c1c:	76 e8                	jbe    800c06 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800c1e:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800c21:	80 fa 19             	cmp    $0x19,%dl
+  800c24:	77 08                	ja     800c2e <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800c26:	0f be c0             	movsbl %al,%eax
+  800c29:	83 e8 57             	sub    $0x57,%eax
+  800c2c:	eb de                	jmp    800c0c <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c2e:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800c31:	80 fa 19             	cmp    $0x19,%dl
+  800c34:	77 08                	ja     800c3e <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800c36:	0f be c0             	movsbl %al,%eax
+  800c39:	83 e8 37             	sub    $0x37,%eax
+  800c3c:	eb ce                	jmp    800c0c <strisl+0x87>
+		else if (!*s)
+  800c3e:	84 c0                	test   %al,%al
+  800c40:	0f 94 c0             	sete   %al
+  800c43:	0f b6 c0             	movzbl %al,%eax
+  800c46:	eb 05                	jmp    800c4d <strisl+0xc8>
+			return 0;
+  800c48:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800c4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c50:	5b                   	pop    %ebx
+  800c51:	5e                   	pop    %esi
+  800c52:	5f                   	pop    %edi
+  800c53:	5d                   	pop    %ebp
+  800c54:	c3                   	ret
+
+00800c55 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800c55:	55                   	push   %ebp
+  800c56:	89 e5                	mov    %esp,%ebp
+  800c58:	83 ec 10             	sub    $0x10,%esp
+  800c5b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c5e:	89 c8                	mov    %ecx,%eax
+  800c60:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800c65:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800c68:	eb 0b                	jmp    800c75 <touch_mem+0x20>
+		c = *(char *)page;
+  800c6a:	0f b6 10             	movzbl (%eax),%edx
+  800c6d:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c70:	05 00 10 00 00       	add    $0x1000,%eax
+  800c75:	39 c8                	cmp    %ecx,%eax
+  800c77:	72 f1                	jb     800c6a <touch_mem+0x15>
+}
+  800c79:	c9                   	leave
+  800c7a:	c3                   	ret
+
+00800c7b <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c7b:	55                   	push   %ebp
+  800c7c:	89 e5                	mov    %esp,%ebp
+  800c7e:	57                   	push   %edi
+  800c7f:	56                   	push   %esi
+  800c80:	53                   	push   %ebx
+	touch_mem(s, len);
+  800c81:	ff 75 0c             	push   0xc(%ebp)
+  800c84:	ff 75 08             	push   0x8(%ebp)
+  800c87:	e8 c9 ff ff ff       	call   800c55 <touch_mem>
+	asm volatile("int %1\n"
+  800c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c97:	89 c3                	mov    %eax,%ebx
+  800c99:	89 c7                	mov    %eax,%edi
+  800c9b:	89 c6                	mov    %eax,%esi
+  800c9d:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c9f:	83 c4 08             	add    $0x8,%esp
+  800ca2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca5:	5b                   	pop    %ebx
+  800ca6:	5e                   	pop    %esi
+  800ca7:	5f                   	pop    %edi
+  800ca8:	5d                   	pop    %ebp
+  800ca9:	c3                   	ret
+
+00800caa <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800caa:	55                   	push   %ebp
+  800cab:	89 e5                	mov    %esp,%ebp
+  800cad:	57                   	push   %edi
+  800cae:	56                   	push   %esi
+  800caf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cba:	89 d1                	mov    %edx,%ecx
+  800cbc:	89 d3                	mov    %edx,%ebx
+  800cbe:	89 d7                	mov    %edx,%edi
+  800cc0:	89 d6                	mov    %edx,%esi
+  800cc2:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cc4:	5b                   	pop    %ebx
+  800cc5:	5e                   	pop    %esi
+  800cc6:	5f                   	pop    %edi
+  800cc7:	5d                   	pop    %ebp
+  800cc8:	c3                   	ret
+
+00800cc9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800cc9:	55                   	push   %ebp
+  800cca:	89 e5                	mov    %esp,%ebp
+  800ccc:	57                   	push   %edi
+  800ccd:	56                   	push   %esi
+  800cce:	53                   	push   %ebx
+  800ccf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cd2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cda:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cdf:	89 cb                	mov    %ecx,%ebx
+  800ce1:	89 cf                	mov    %ecx,%edi
+  800ce3:	89 ce                	mov    %ecx,%esi
+  800ce5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ce7:	85 c0                	test   %eax,%eax
+  800ce9:	7f 08                	jg     800cf3 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ceb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cee:	5b                   	pop    %ebx
+  800cef:	5e                   	pop    %esi
+  800cf0:	5f                   	pop    %edi
+  800cf1:	5d                   	pop    %ebp
+  800cf2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf3:	83 ec 0c             	sub    $0xc,%esp
+  800cf6:	50                   	push   %eax
+  800cf7:	6a 03                	push   $0x3
+  800cf9:	68 8b 57 80 00       	push   $0x80578b
+  800cfe:	6a 23                	push   $0x23
+  800d00:	68 a8 57 80 00       	push   $0x8057a8
+  800d05:	e8 89 f4 ff ff       	call   800193 <_panic>
+
+00800d0a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d0a:	55                   	push   %ebp
+  800d0b:	89 e5                	mov    %esp,%ebp
+  800d0d:	57                   	push   %edi
+  800d0e:	56                   	push   %esi
+  800d0f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d10:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d15:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d1a:	89 d1                	mov    %edx,%ecx
+  800d1c:	89 d3                	mov    %edx,%ebx
+  800d1e:	89 d7                	mov    %edx,%edi
+  800d20:	89 d6                	mov    %edx,%esi
+  800d22:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d24:	5b                   	pop    %ebx
+  800d25:	5e                   	pop    %esi
+  800d26:	5f                   	pop    %edi
+  800d27:	5d                   	pop    %ebp
+  800d28:	c3                   	ret
+
+00800d29 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	57                   	push   %edi
+  800d2d:	56                   	push   %esi
+  800d2e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d34:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d39:	89 d1                	mov    %edx,%ecx
+  800d3b:	89 d3                	mov    %edx,%ebx
+  800d3d:	89 d7                	mov    %edx,%edi
+  800d3f:	89 d6                	mov    %edx,%esi
+  800d41:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d43:	5b                   	pop    %ebx
+  800d44:	5e                   	pop    %esi
+  800d45:	5f                   	pop    %edi
+  800d46:	5d                   	pop    %ebp
+  800d47:	c3                   	ret
+
+00800d48 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d48:	55                   	push   %ebp
+  800d49:	89 e5                	mov    %esp,%ebp
+  800d4b:	57                   	push   %edi
+  800d4c:	56                   	push   %esi
+  800d4d:	53                   	push   %ebx
+  800d4e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d51:	be 00 00 00 00       	mov    $0x0,%esi
+  800d56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d64:	89 f7                	mov    %esi,%edi
+  800d66:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d68:	85 c0                	test   %eax,%eax
+  800d6a:	7f 08                	jg     800d74 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6f:	5b                   	pop    %ebx
+  800d70:	5e                   	pop    %esi
+  800d71:	5f                   	pop    %edi
+  800d72:	5d                   	pop    %ebp
+  800d73:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d74:	83 ec 0c             	sub    $0xc,%esp
+  800d77:	50                   	push   %eax
+  800d78:	6a 04                	push   $0x4
+  800d7a:	68 8b 57 80 00       	push   $0x80578b
+  800d7f:	6a 23                	push   $0x23
+  800d81:	68 a8 57 80 00       	push   $0x8057a8
+  800d86:	e8 08 f4 ff ff       	call   800193 <_panic>
+
+00800d8b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d8b:	55                   	push   %ebp
+  800d8c:	89 e5                	mov    %esp,%ebp
+  800d8e:	57                   	push   %edi
+  800d8f:	56                   	push   %esi
+  800d90:	53                   	push   %ebx
+  800d91:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800da5:	8b 75 18             	mov    0x18(%ebp),%esi
+  800da8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800daa:	85 c0                	test   %eax,%eax
+  800dac:	7f 08                	jg     800db6 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800dae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db1:	5b                   	pop    %ebx
+  800db2:	5e                   	pop    %esi
+  800db3:	5f                   	pop    %edi
+  800db4:	5d                   	pop    %ebp
+  800db5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db6:	83 ec 0c             	sub    $0xc,%esp
+  800db9:	50                   	push   %eax
+  800dba:	6a 05                	push   $0x5
+  800dbc:	68 8b 57 80 00       	push   $0x80578b
+  800dc1:	6a 23                	push   $0x23
+  800dc3:	68 a8 57 80 00       	push   $0x8057a8
+  800dc8:	e8 c6 f3 ff ff       	call   800193 <_panic>
+
+00800dcd <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dcd:	55                   	push   %ebp
+  800dce:	89 e5                	mov    %esp,%ebp
+  800dd0:	57                   	push   %edi
+  800dd1:	56                   	push   %esi
+  800dd2:	53                   	push   %ebx
+  800dd3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ddb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de1:	b8 06 00 00 00       	mov    $0x6,%eax
+  800de6:	89 df                	mov    %ebx,%edi
+  800de8:	89 de                	mov    %ebx,%esi
+  800dea:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dec:	85 c0                	test   %eax,%eax
+  800dee:	7f 08                	jg     800df8 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800df0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df3:	5b                   	pop    %ebx
+  800df4:	5e                   	pop    %esi
+  800df5:	5f                   	pop    %edi
+  800df6:	5d                   	pop    %ebp
+  800df7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df8:	83 ec 0c             	sub    $0xc,%esp
+  800dfb:	50                   	push   %eax
+  800dfc:	6a 06                	push   $0x6
+  800dfe:	68 8b 57 80 00       	push   $0x80578b
+  800e03:	6a 23                	push   $0x23
+  800e05:	68 a8 57 80 00       	push   $0x8057a8
+  800e0a:	e8 84 f3 ff ff       	call   800193 <_panic>
+
+00800e0f <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800e0f:	55                   	push   %ebp
+  800e10:	89 e5                	mov    %esp,%ebp
+  800e12:	57                   	push   %edi
+  800e13:	56                   	push   %esi
+  800e14:	53                   	push   %ebx
+  800e15:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e18:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e23:	b8 18 00 00 00       	mov    $0x18,%eax
+  800e28:	89 df                	mov    %ebx,%edi
+  800e2a:	89 de                	mov    %ebx,%esi
+  800e2c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e2e:	85 c0                	test   %eax,%eax
+  800e30:	7f 08                	jg     800e3a <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e35:	5b                   	pop    %ebx
+  800e36:	5e                   	pop    %esi
+  800e37:	5f                   	pop    %edi
+  800e38:	5d                   	pop    %ebp
+  800e39:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e3a:	83 ec 0c             	sub    $0xc,%esp
+  800e3d:	50                   	push   %eax
+  800e3e:	6a 18                	push   $0x18
+  800e40:	68 8b 57 80 00       	push   $0x80578b
+  800e45:	6a 23                	push   $0x23
+  800e47:	68 a8 57 80 00       	push   $0x8057a8
+  800e4c:	e8 42 f3 ff ff       	call   800193 <_panic>
+
+00800e51 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800e51:	55                   	push   %ebp
+  800e52:	89 e5                	mov    %esp,%ebp
+  800e54:	57                   	push   %edi
+  800e55:	56                   	push   %esi
+  800e56:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e57:	be 00 00 00 00       	mov    $0x0,%esi
+  800e5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e62:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e6a:	89 f7                	mov    %esi,%edi
+  800e6c:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800e6e:	5b                   	pop    %ebx
+  800e6f:	5e                   	pop    %esi
+  800e70:	5f                   	pop    %edi
+  800e71:	5d                   	pop    %ebp
+  800e72:	c3                   	ret
+
+00800e73 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	57                   	push   %edi
+  800e77:	56                   	push   %esi
+  800e78:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e84:	be 00 00 00 00       	mov    $0x0,%esi
+  800e89:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e8f:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e91:	5b                   	pop    %ebx
+  800e92:	5e                   	pop    %esi
+  800e93:	5f                   	pop    %edi
+  800e94:	5d                   	pop    %ebp
+  800e95:	c3                   	ret
+
+00800e96 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e96:	55                   	push   %ebp
+  800e97:	89 e5                	mov    %esp,%ebp
+  800e99:	57                   	push   %edi
+  800e9a:	56                   	push   %esi
+  800e9b:	53                   	push   %ebx
+  800e9c:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800e9f:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800ea2:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800ea8:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800eab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb1:	b8 10 00 00 00       	mov    $0x10,%eax
+  800eb6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eb9:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ebc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ebe:	85 c0                	test   %eax,%eax
+  800ec0:	7f 08                	jg     800eca <sys_page_map_range+0x34>
+}
+  800ec2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec5:	5b                   	pop    %ebx
+  800ec6:	5e                   	pop    %esi
+  800ec7:	5f                   	pop    %edi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eca:	83 ec 0c             	sub    $0xc,%esp
+  800ecd:	50                   	push   %eax
+  800ece:	6a 10                	push   $0x10
+  800ed0:	68 8b 57 80 00       	push   $0x80578b
+  800ed5:	6a 23                	push   $0x23
+  800ed7:	68 a8 57 80 00       	push   $0x8057a8
+  800edc:	e8 b2 f2 ff ff       	call   800193 <_panic>
+
+00800ee1 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800ee1:	55                   	push   %ebp
+  800ee2:	89 e5                	mov    %esp,%ebp
+  800ee4:	57                   	push   %edi
+  800ee5:	56                   	push   %esi
+  800ee6:	53                   	push   %ebx
+  800ee7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eea:	be 00 00 00 00       	mov    $0x0,%esi
+  800eef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef5:	b8 11 00 00 00       	mov    $0x11,%eax
+  800efa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800efd:	89 f7                	mov    %esi,%edi
+  800eff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f01:	85 c0                	test   %eax,%eax
+  800f03:	7f 08                	jg     800f0d <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f08:	5b                   	pop    %ebx
+  800f09:	5e                   	pop    %esi
+  800f0a:	5f                   	pop    %edi
+  800f0b:	5d                   	pop    %ebp
+  800f0c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0d:	83 ec 0c             	sub    $0xc,%esp
+  800f10:	50                   	push   %eax
+  800f11:	6a 11                	push   $0x11
+  800f13:	68 8b 57 80 00       	push   $0x80578b
+  800f18:	6a 23                	push   $0x23
+  800f1a:	68 a8 57 80 00       	push   $0x8057a8
+  800f1f:	e8 6f f2 ff ff       	call   800193 <_panic>
+
+00800f24 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800f24:	55                   	push   %ebp
+  800f25:	89 e5                	mov    %esp,%ebp
+  800f27:	57                   	push   %edi
+  800f28:	56                   	push   %esi
+  800f29:	53                   	push   %ebx
+  800f2a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f2d:	be 00 00 00 00       	mov    $0x0,%esi
+  800f32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f38:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800f3d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f40:	89 f7                	mov    %esi,%edi
+  800f42:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f44:	85 c0                	test   %eax,%eax
+  800f46:	7f 08                	jg     800f50 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4b:	5b                   	pop    %ebx
+  800f4c:	5e                   	pop    %esi
+  800f4d:	5f                   	pop    %edi
+  800f4e:	5d                   	pop    %ebp
+  800f4f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f50:	83 ec 0c             	sub    $0xc,%esp
+  800f53:	50                   	push   %eax
+  800f54:	6a 1b                	push   $0x1b
+  800f56:	68 8b 57 80 00       	push   $0x80578b
+  800f5b:	6a 23                	push   $0x23
+  800f5d:	68 a8 57 80 00       	push   $0x8057a8
+  800f62:	e8 2c f2 ff ff       	call   800193 <_panic>
+
+00800f67 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800f67:	55                   	push   %ebp
+  800f68:	89 e5                	mov    %esp,%ebp
+  800f6a:	57                   	push   %edi
+  800f6b:	56                   	push   %esi
+  800f6c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f72:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f77:	89 d1                	mov    %edx,%ecx
+  800f79:	89 d3                	mov    %edx,%ebx
+  800f7b:	89 d7                	mov    %edx,%edi
+  800f7d:	89 d6                	mov    %edx,%esi
+  800f7f:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f81:	5b                   	pop    %ebx
+  800f82:	5e                   	pop    %esi
+  800f83:	5f                   	pop    %edi
+  800f84:	5d                   	pop    %ebp
+  800f85:	c3                   	ret
+
+00800f86 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f86:	55                   	push   %ebp
+  800f87:	89 e5                	mov    %esp,%ebp
+  800f89:	57                   	push   %edi
+  800f8a:	56                   	push   %esi
+  800f8b:	53                   	push   %ebx
+  800f8c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9a:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f9f:	89 df                	mov    %ebx,%edi
+  800fa1:	89 de                	mov    %ebx,%esi
+  800fa3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa5:	85 c0                	test   %eax,%eax
+  800fa7:	7f 08                	jg     800fb1 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800fa9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fac:	5b                   	pop    %ebx
+  800fad:	5e                   	pop    %esi
+  800fae:	5f                   	pop    %edi
+  800faf:	5d                   	pop    %ebp
+  800fb0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb1:	83 ec 0c             	sub    $0xc,%esp
+  800fb4:	50                   	push   %eax
+  800fb5:	6a 08                	push   $0x8
+  800fb7:	68 8b 57 80 00       	push   $0x80578b
+  800fbc:	6a 23                	push   $0x23
+  800fbe:	68 a8 57 80 00       	push   $0x8057a8
+  800fc3:	e8 cb f1 ff ff       	call   800193 <_panic>
+
+00800fc8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fc8:	55                   	push   %ebp
+  800fc9:	89 e5                	mov    %esp,%ebp
+  800fcb:	57                   	push   %edi
+  800fcc:	56                   	push   %esi
+  800fcd:	53                   	push   %ebx
+  800fce:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800fd1:	6a 44                	push   $0x44
+  800fd3:	ff 75 0c             	push   0xc(%ebp)
+  800fd6:	e8 7a fc ff ff       	call   800c55 <touch_mem>
+	asm volatile("int %1\n"
+  800fdb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe3:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fe8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800feb:	89 df                	mov    %ebx,%edi
+  800fed:	89 de                	mov    %ebx,%esi
+  800fef:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff1:	83 c4 08             	add    $0x8,%esp
+  800ff4:	85 c0                	test   %eax,%eax
+  800ff6:	7f 08                	jg     801000 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ff8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ffb:	5b                   	pop    %ebx
+  800ffc:	5e                   	pop    %esi
+  800ffd:	5f                   	pop    %edi
+  800ffe:	5d                   	pop    %ebp
+  800fff:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801000:	83 ec 0c             	sub    $0xc,%esp
+  801003:	50                   	push   %eax
+  801004:	6a 09                	push   $0x9
+  801006:	68 8b 57 80 00       	push   $0x80578b
+  80100b:	6a 23                	push   $0x23
+  80100d:	68 a8 57 80 00       	push   $0x8057a8
+  801012:	e8 7c f1 ff ff       	call   800193 <_panic>
+
+00801017 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  801017:	55                   	push   %ebp
+  801018:	89 e5                	mov    %esp,%ebp
+  80101a:	57                   	push   %edi
+  80101b:	56                   	push   %esi
+  80101c:	53                   	push   %ebx
+  80101d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801020:	be 00 00 00 00       	mov    $0x0,%esi
+  801025:	8b 55 08             	mov    0x8(%ebp),%edx
+  801028:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801030:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801033:	89 f7                	mov    %esi,%edi
+  801035:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801037:	85 c0                	test   %eax,%eax
+  801039:	7f 08                	jg     801043 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  80103b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103e:	5b                   	pop    %ebx
+  80103f:	5e                   	pop    %esi
+  801040:	5f                   	pop    %edi
+  801041:	5d                   	pop    %ebp
+  801042:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801043:	83 ec 0c             	sub    $0xc,%esp
+  801046:	50                   	push   %eax
+  801047:	6a 1a                	push   $0x1a
+  801049:	68 8b 57 80 00       	push   $0x80578b
+  80104e:	6a 23                	push   $0x23
+  801050:	68 a8 57 80 00       	push   $0x8057a8
+  801055:	e8 39 f1 ff ff       	call   800193 <_panic>
+
+0080105a <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  80105a:	55                   	push   %ebp
+  80105b:	89 e5                	mov    %esp,%ebp
+  80105d:	57                   	push   %edi
+  80105e:	56                   	push   %esi
+  80105f:	53                   	push   %ebx
+  801060:	83 ec 0c             	sub    $0xc,%esp
+  801063:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801066:	89 d8                	mov    %ebx,%eax
+  801068:	c1 e0 05             	shl    $0x5,%eax
+  80106b:	50                   	push   %eax
+  80106c:	ff 75 0c             	push   0xc(%ebp)
+  80106f:	e8 e1 fb ff ff       	call   800c55 <touch_mem>
+	asm volatile("int %1\n"
+  801074:	be 00 00 00 00       	mov    $0x0,%esi
+  801079:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107c:	b8 13 00 00 00       	mov    $0x13,%eax
+  801081:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801084:	89 f7                	mov    %esi,%edi
+  801086:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801088:	83 c4 08             	add    $0x8,%esp
+  80108b:	85 c0                	test   %eax,%eax
+  80108d:	7f 08                	jg     801097 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  80108f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801092:	5b                   	pop    %ebx
+  801093:	5e                   	pop    %esi
+  801094:	5f                   	pop    %edi
+  801095:	5d                   	pop    %ebp
+  801096:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801097:	83 ec 0c             	sub    $0xc,%esp
+  80109a:	50                   	push   %eax
+  80109b:	6a 13                	push   $0x13
+  80109d:	68 8b 57 80 00       	push   $0x80578b
+  8010a2:	6a 23                	push   $0x23
+  8010a4:	68 a8 57 80 00       	push   $0x8057a8
+  8010a9:	e8 e5 f0 ff ff       	call   800193 <_panic>
+
+008010ae <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010ae:	55                   	push   %ebp
+  8010af:	89 e5                	mov    %esp,%ebp
+  8010b1:	57                   	push   %edi
+  8010b2:	56                   	push   %esi
+  8010b3:	53                   	push   %ebx
+  8010b4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010c7:	89 df                	mov    %ebx,%edi
+  8010c9:	89 de                	mov    %ebx,%esi
+  8010cb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010cd:	85 c0                	test   %eax,%eax
+  8010cf:	7f 08                	jg     8010d9 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d4:	5b                   	pop    %ebx
+  8010d5:	5e                   	pop    %esi
+  8010d6:	5f                   	pop    %edi
+  8010d7:	5d                   	pop    %ebp
+  8010d8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d9:	83 ec 0c             	sub    $0xc,%esp
+  8010dc:	50                   	push   %eax
+  8010dd:	6a 0a                	push   $0xa
+  8010df:	68 8b 57 80 00       	push   $0x80578b
+  8010e4:	6a 23                	push   $0x23
+  8010e6:	68 a8 57 80 00       	push   $0x8057a8
+  8010eb:	e8 a3 f0 ff ff       	call   800193 <_panic>
+
+008010f0 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010f0:	55                   	push   %ebp
+  8010f1:	89 e5                	mov    %esp,%ebp
+  8010f3:	57                   	push   %edi
+  8010f4:	56                   	push   %esi
+  8010f5:	53                   	push   %ebx
+  8010f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  8010f9:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010ff:	76 1d                	jbe    80111e <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  801101:	8b 55 08             	mov    0x8(%ebp),%edx
+  801104:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801107:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80110c:	be 01 00 00 00       	mov    $0x1,%esi
+  801111:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801114:	cd 30                	int    $0x30
+}
+  801116:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801119:	5b                   	pop    %ebx
+  80111a:	5e                   	pop    %esi
+  80111b:	5f                   	pop    %edi
+  80111c:	5d                   	pop    %ebp
+  80111d:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80111e:	68 00 10 00 00       	push   $0x1000
+  801123:	53                   	push   %ebx
+  801124:	e8 2c fb ff ff       	call   800c55 <touch_mem>
+  801129:	83 c4 08             	add    $0x8,%esp
+  80112c:	eb d3                	jmp    801101 <sys_ipc_send+0x11>
+
+0080112e <sys_ipc_send_pages>:
+{
+  80112e:	55                   	push   %ebp
+  80112f:	89 e5                	mov    %esp,%ebp
+  801131:	57                   	push   %edi
+  801132:	56                   	push   %esi
+  801133:	53                   	push   %ebx
+  801134:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801137:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  80113a:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801140:	76 18                	jbe    80115a <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  801142:	8b 55 08             	mov    0x8(%ebp),%edx
+  801145:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801148:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80114d:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801150:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  801152:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801155:	5b                   	pop    %ebx
+  801156:	5e                   	pop    %esi
+  801157:	5f                   	pop    %edi
+  801158:	5d                   	pop    %ebp
+  801159:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80115a:	89 f0                	mov    %esi,%eax
+  80115c:	c1 e0 0c             	shl    $0xc,%eax
+  80115f:	50                   	push   %eax
+  801160:	53                   	push   %ebx
+  801161:	e8 ef fa ff ff       	call   800c55 <touch_mem>
+  801166:	83 c4 08             	add    $0x8,%esp
+  801169:	eb d7                	jmp    801142 <sys_ipc_send_pages+0x14>
+
+0080116b <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  80116b:	55                   	push   %ebp
+  80116c:	89 e5                	mov    %esp,%ebp
+  80116e:	57                   	push   %edi
+  80116f:	56                   	push   %esi
+  801170:	53                   	push   %ebx
+  801171:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801174:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801179:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801184:	89 df                	mov    %ebx,%edi
+  801186:	89 de                	mov    %ebx,%esi
+  801188:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80118a:	85 c0                	test   %eax,%eax
+  80118c:	7f 08                	jg     801196 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  80118e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801191:	5b                   	pop    %ebx
+  801192:	5e                   	pop    %esi
+  801193:	5f                   	pop    %edi
+  801194:	5d                   	pop    %ebp
+  801195:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801196:	83 ec 0c             	sub    $0xc,%esp
+  801199:	50                   	push   %eax
+  80119a:	6a 0d                	push   $0xd
+  80119c:	68 8b 57 80 00       	push   $0x80578b
+  8011a1:	6a 23                	push   $0x23
+  8011a3:	68 a8 57 80 00       	push   $0x8057a8
+  8011a8:	e8 e6 ef ff ff       	call   800193 <_panic>
+
+008011ad <sys_ipc_recv>:
+{
+  8011ad:	55                   	push   %ebp
+  8011ae:	89 e5                	mov    %esp,%ebp
+  8011b0:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8011b3:	6a 01                	push   $0x1
+  8011b5:	ff 75 08             	push   0x8(%ebp)
+  8011b8:	e8 ae ff ff ff       	call   80116b <sys_ipc_recv_pages>
+}
+  8011bd:	c9                   	leave
+  8011be:	c3                   	ret
+
+008011bf <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8011bf:	55                   	push   %ebp
+  8011c0:	89 e5                	mov    %esp,%ebp
+  8011c2:	57                   	push   %edi
+  8011c3:	56                   	push   %esi
+  8011c4:	53                   	push   %ebx
+  8011c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011cb:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  8011ce:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011d4:	77 04                	ja     8011da <sys_ipc_call+0x1b>
+  8011d6:	85 f6                	test   %esi,%esi
+  8011d8:	75 15                	jne    8011ef <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8011da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e0:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011e5:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8011e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ea:	5b                   	pop    %ebx
+  8011eb:	5e                   	pop    %esi
+  8011ec:	5f                   	pop    %edi
+  8011ed:	5d                   	pop    %ebp
+  8011ee:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8011ef:	89 f8                	mov    %edi,%eax
+  8011f1:	c1 e0 0c             	shl    $0xc,%eax
+  8011f4:	50                   	push   %eax
+  8011f5:	53                   	push   %ebx
+  8011f6:	e8 5a fa ff ff       	call   800c55 <touch_mem>
+  8011fb:	83 c4 08             	add    $0x8,%esp
+  8011fe:	eb da                	jmp    8011da <sys_ipc_call+0x1b>
+
+00801200 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801200:	55                   	push   %ebp
+  801201:	89 e5                	mov    %esp,%ebp
+  801203:	57                   	push   %edi
+  801204:	56                   	push   %esi
+  801205:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801206:	8b 55 08             	mov    0x8(%ebp),%edx
+  801209:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801211:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801214:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801217:	8b 75 18             	mov    0x18(%ebp),%esi
+  80121a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80121c:	5b                   	pop    %ebx
+  80121d:	5e                   	pop    %esi
+  80121e:	5f                   	pop    %edi
+  80121f:	5d                   	pop    %ebp
+  801220:	c3                   	ret
+
+00801221 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  801221:	55                   	push   %ebp
+  801222:	89 e5                	mov    %esp,%ebp
+  801224:	57                   	push   %edi
+  801225:	56                   	push   %esi
+  801226:	53                   	push   %ebx
+  801227:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  80122a:	6a 04                	push   $0x4
+  80122c:	ff 75 08             	push   0x8(%ebp)
+  80122f:	e8 21 fa ff ff       	call   800c55 <touch_mem>
+	asm volatile("int %1\n"
+  801234:	be 00 00 00 00       	mov    $0x0,%esi
+  801239:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801241:	8b 55 08             	mov    0x8(%ebp),%edx
+  801244:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801247:	89 f7                	mov    %esi,%edi
+  801249:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80124b:	83 c4 08             	add    $0x8,%esp
+  80124e:	85 c0                	test   %eax,%eax
+  801250:	7f 08                	jg     80125a <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  801252:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801255:	5b                   	pop    %ebx
+  801256:	5e                   	pop    %esi
+  801257:	5f                   	pop    %edi
+  801258:	5d                   	pop    %ebp
+  801259:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80125a:	83 ec 0c             	sub    $0xc,%esp
+  80125d:	50                   	push   %eax
+  80125e:	6a 16                	push   $0x16
+  801260:	68 8b 57 80 00       	push   $0x80578b
+  801265:	6a 23                	push   $0x23
+  801267:	68 a8 57 80 00       	push   $0x8057a8
+  80126c:	e8 22 ef ff ff       	call   800193 <_panic>
+
+00801271 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801271:	55                   	push   %ebp
+  801272:	89 e5                	mov    %esp,%ebp
+  801274:	57                   	push   %edi
+  801275:	56                   	push   %esi
+  801276:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801277:	6a 04                	push   $0x4
+  801279:	ff 75 08             	push   0x8(%ebp)
+  80127c:	e8 d4 f9 ff ff       	call   800c55 <touch_mem>
+	asm volatile("int %1\n"
+  801281:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801286:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801289:	b8 17 00 00 00       	mov    $0x17,%eax
+  80128e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801291:	89 df                	mov    %ebx,%edi
+  801293:	89 de                	mov    %ebx,%esi
+  801295:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801297:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129a:	5b                   	pop    %ebx
+  80129b:	5e                   	pop    %esi
+  80129c:	5f                   	pop    %edi
+  80129d:	5d                   	pop    %ebp
+  80129e:	c3                   	ret
+
+0080129f <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80129f:	55                   	push   %ebp
+  8012a0:	89 e5                	mov    %esp,%ebp
+  8012a2:	57                   	push   %edi
+  8012a3:	56                   	push   %esi
+  8012a4:	53                   	push   %ebx
+  8012a5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012b5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012ba:	89 df                	mov    %ebx,%edi
+  8012bc:	89 de                	mov    %ebx,%esi
+  8012be:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012c0:	85 c0                	test   %eax,%eax
+  8012c2:	7f 08                	jg     8012cc <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  8012c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c7:	5b                   	pop    %ebx
+  8012c8:	5e                   	pop    %esi
+  8012c9:	5f                   	pop    %edi
+  8012ca:	5d                   	pop    %ebp
+  8012cb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012cc:	83 ec 0c             	sub    $0xc,%esp
+  8012cf:	50                   	push   %eax
+  8012d0:	6a 0e                	push   $0xe
+  8012d2:	68 8b 57 80 00       	push   $0x80578b
+  8012d7:	6a 23                	push   $0x23
+  8012d9:	68 a8 57 80 00       	push   $0x8057a8
+  8012de:	e8 b0 ee ff ff       	call   800193 <_panic>
+
+008012e3 <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  8012e3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012ea:	f6 c6 06             	test   $0x6,%dh
+  8012ed:	75 37                	jne    801326 <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  8012ef:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012f6:	f6 c2 02             	test   $0x2,%dl
+  8012f9:	75 19                	jne    801314 <dupperm+0x31>
+  8012fb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801302:	f6 c6 08             	test   $0x8,%dh
+  801305:	75 0d                	jne    801314 <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  801307:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80130e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801313:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801314:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80131b:	25 00 06 00 00       	and    $0x600,%eax
+  801320:	0d 05 08 00 00       	or     $0x805,%eax
+  801325:	c3                   	ret
+		return 0;
+  801326:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80132b:	c3                   	ret
+
+0080132c <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  80132c:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  80132e:	c1 e0 0c             	shl    $0xc,%eax
+  801331:	c1 e8 16             	shr    $0x16,%eax
+  801334:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  80133b:	f6 c1 01             	test   $0x1,%cl
+  80133e:	74 2c                	je     80136c <dupable+0x40>
+  801340:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134c:	f6 c1 04             	test   $0x4,%cl
+  80134f:	74 20                	je     801371 <dupable+0x45>
+  801351:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801358:	f6 c1 01             	test   $0x1,%cl
+  80135b:	74 14                	je     801371 <dupable+0x45>
+  80135d:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801364:	c1 e8 02             	shr    $0x2,%eax
+  801367:	83 e0 01             	and    $0x1,%eax
+  80136a:	eb 05                	jmp    801371 <dupable+0x45>
+  80136c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801371:	83 e0 01             	and    $0x1,%eax
+}
+  801374:	c3                   	ret
+
+00801375 <pgfault>:
+{
+  801375:	55                   	push   %ebp
+  801376:	89 e5                	mov    %esp,%ebp
+  801378:	56                   	push   %esi
+  801379:	53                   	push   %ebx
+  80137a:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  80137d:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  80137f:	89 ca                	mov    %ecx,%edx
+  801381:	c1 ea 0c             	shr    $0xc,%edx
+  801384:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  80138b:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  80138f:	0f 84 8e 00 00 00    	je     801423 <pgfault+0xae>
+		return 0;
+  801395:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  80139a:	f6 c6 08             	test   $0x8,%dh
+  80139d:	0f 84 85 00 00 00    	je     801428 <pgfault+0xb3>
+	perm |= PTE_W;
+  8013a3:	81 e2 07 06 00 00    	and    $0x607,%edx
+  8013a9:	89 d3                	mov    %edx,%ebx
+  8013ab:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8013ae:	89 ce                	mov    %ecx,%esi
+  8013b0:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  8013b6:	6a 01                	push   $0x1
+  8013b8:	53                   	push   %ebx
+  8013b9:	68 00 f0 7f 00       	push   $0x7ff000
+  8013be:	6a 00                	push   $0x0
+  8013c0:	e8 a5 27 00 00       	call   803b6a <page_alloc>
+  8013c5:	83 c4 10             	add    $0x10,%esp
+  8013c8:	85 c0                	test   %eax,%eax
+  8013ca:	78 33                	js     8013ff <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  8013cc:	83 ec 04             	sub    $0x4,%esp
+  8013cf:	68 00 10 00 00       	push   $0x1000
+  8013d4:	56                   	push   %esi
+  8013d5:	68 00 f0 7f 00       	push   $0x7ff000
+  8013da:	e8 fc f5 ff ff       	call   8009db <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  8013df:	89 1c 24             	mov    %ebx,(%esp)
+  8013e2:	56                   	push   %esi
+  8013e3:	6a 00                	push   $0x0
+  8013e5:	68 00 f0 7f 00       	push   $0x7ff000
+  8013ea:	6a 00                	push   $0x0
+  8013ec:	e8 da 2d 00 00       	call   8041cb <page_map>
+  8013f1:	83 c4 20             	add    $0x20,%esp
+  8013f4:	85 c0                	test   %eax,%eax
+  8013f6:	78 19                	js     801411 <pgfault+0x9c>
+	return 1;
+  8013f8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013fd:	eb 29                	jmp    801428 <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  8013ff:	50                   	push   %eax
+  801400:	68 b8 57 80 00       	push   $0x8057b8
+  801405:	6a 2e                	push   $0x2e
+  801407:	68 0b 58 80 00       	push   $0x80580b
+  80140c:	e8 82 ed ff ff       	call   800193 <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  801411:	50                   	push   %eax
+  801412:	68 e4 57 80 00       	push   $0x8057e4
+  801417:	6a 32                	push   $0x32
+  801419:	68 0b 58 80 00       	push   $0x80580b
+  80141e:	e8 70 ed ff ff       	call   800193 <_panic>
+		return 0;
+  801423:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801428:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80142b:	5b                   	pop    %ebx
+  80142c:	5e                   	pop    %esi
+  80142d:	5d                   	pop    %ebp
+  80142e:	c3                   	ret
+
+0080142f <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  80142f:	55                   	push   %ebp
+  801430:	89 e5                	mov    %esp,%ebp
+  801432:	57                   	push   %edi
+  801433:	56                   	push   %esi
+  801434:	53                   	push   %ebx
+  801435:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  801438:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  80143f:	74 5d                	je     80149e <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  801441:	83 ec 0c             	sub    $0xc,%esp
+  801444:	68 75 13 80 00       	push   $0x801375
+  801449:	e8 de 39 00 00       	call   804e2c <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  80144e:	e8 14 fb ff ff       	call   800f67 <sys_fork>
+  801453:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801456:	83 c4 10             	add    $0x10,%esp
+  801459:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  80145c:	74 47                	je     8014a5 <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  80145e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801462:	0f 84 c5 03 00 00    	je     80182d <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  801468:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80146c:	78 25                	js     801493 <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  80146e:	e8 6f 20 00 00       	call   8034e2 <page_share_paged_out>
+  801473:	85 c0                	test   %eax,%eax
+  801475:	0f 88 d8 03 00 00    	js     801853 <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  80147b:	83 ec 08             	sub    $0x8,%esp
+  80147e:	6a 02                	push   $0x2
+  801480:	ff 75 e4             	push   -0x1c(%ebp)
+  801483:	e8 fe fa ff ff       	call   800f86 <sys_env_set_status>
+  801488:	83 c4 10             	add    $0x10,%esp
+  80148b:	85 c0                	test   %eax,%eax
+  80148d:	0f 88 d5 03 00 00    	js     801868 <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  801493:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801496:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801499:	5b                   	pop    %ebx
+  80149a:	5e                   	pop    %esi
+  80149b:	5f                   	pop    %edi
+  80149c:	5d                   	pop    %ebp
+  80149d:	c3                   	ret
+		init_map_dir();
+  80149e:	e8 47 23 00 00       	call   8037ea <init_map_dir>
+  8014a3:	eb 9c                	jmp    801441 <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8014a5:	b8 07 00 00 00       	mov    $0x7,%eax
+  8014aa:	cd 30                	int    $0x30
+  8014ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  8014af:	85 c0                	test   %eax,%eax
+  8014b1:	78 10                	js     8014c3 <fork+0x94>
+	if (envid == 0)
+  8014b3:	0f 84 74 03 00 00    	je     80182d <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  8014b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014be:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8014c1:	eb 30                	jmp    8014f3 <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  8014c3:	50                   	push   %eax
+  8014c4:	68 16 58 80 00       	push   $0x805816
+  8014c9:	68 cd 00 00 00       	push   $0xcd
+  8014ce:	68 0b 58 80 00       	push   $0x80580b
+  8014d3:	e8 bb ec ff ff       	call   800193 <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  8014d8:	89 f2                	mov    %esi,%edx
+  8014da:	c1 fa 1f             	sar    $0x1f,%edx
+  8014dd:	c1 ea 16             	shr    $0x16,%edx
+  8014e0:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8014e3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014e8:	29 d0                	sub    %edx,%eax
+  8014ea:	ba 00 04 00 00       	mov    $0x400,%edx
+  8014ef:	29 c2                	sub    %eax,%edx
+  8014f1:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  8014f3:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8014f6:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  8014fc:	0f 87 ff 02 00 00    	ja     801801 <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  801502:	89 f3                	mov    %esi,%ebx
+  801504:	c1 e3 0c             	shl    $0xc,%ebx
+  801507:	89 d8                	mov    %ebx,%eax
+  801509:	c1 e8 16             	shr    $0x16,%eax
+  80150c:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801513:	f6 c2 01             	test   $0x1,%dl
+  801516:	74 c0                	je     8014d8 <fork+0xa9>
+  801518:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80151f:	f6 c2 04             	test   $0x4,%dl
+  801522:	74 b4                	je     8014d8 <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  801524:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80152b:	a8 80                	test   $0x80,%al
+  80152d:	75 24                	jne    801553 <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  80152f:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801536:	25 81 00 00 00       	and    $0x81,%eax
+  80153b:	3d 80 00 00 00       	cmp    $0x80,%eax
+  801540:	74 21                	je     801563 <fork+0x134>
+		if (!dupable(pn)) {
+  801542:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801545:	e8 e2 fd ff ff       	call   80132c <dupable>
+  80154a:	84 c0                	test   %al,%al
+  80154c:	75 1a                	jne    801568 <fork+0x139>
+			++pn;
+  80154e:	83 c6 01             	add    $0x1,%esi
+			continue;
+  801551:	eb a0                	jmp    8014f3 <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  801553:	83 ec 08             	sub    $0x8,%esp
+  801556:	53                   	push   %ebx
+  801557:	6a 00                	push   $0x0
+  801559:	e8 b1 f8 ff ff       	call   800e0f <sys_page_split>
+  80155e:	83 c4 10             	add    $0x10,%esp
+  801561:	eb cc                	jmp    80152f <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  801563:	0f b6 03             	movzbl (%ebx),%eax
+  801566:	eb da                	jmp    801542 <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  801568:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80156b:	89 f8                	mov    %edi,%eax
+  80156d:	e8 71 fd ff ff       	call   8012e3 <dupperm>
+  801572:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801575:	85 c0                	test   %eax,%eax
+  801577:	74 16                	je     80158f <fork+0x160>
+  801579:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  80157e:	29 f8                	sub    %edi,%eax
+  801580:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801583:	bf 01 00 00 00       	mov    $0x1,%edi
+  801588:	89 c6                	mov    %eax,%esi
+  80158a:	e9 c4 01 00 00       	jmp    801753 <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  80158f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801592:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801599:	f6 c4 04             	test   $0x4,%ah
+  80159c:	0f 85 89 00 00 00    	jne    80162b <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  8015a2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015a5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015ac:	f6 c4 02             	test   $0x2,%ah
+  8015af:	0f 85 b1 00 00 00    	jne    801666 <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  8015b5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8015b8:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8015bf:	a8 02                	test   $0x2,%al
+  8015c1:	75 10                	jne    8015d3 <fork+0x1a4>
+  8015c3:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8015ca:	f6 c4 08             	test   $0x8,%ah
+  8015cd:	0f 84 3e 01 00 00    	je     801711 <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  8015d3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8015d6:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8015dd:	25 00 06 00 00       	and    $0x600,%eax
+  8015e2:	0d 05 08 00 00       	or     $0x805,%eax
+  8015e7:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  8015e9:	c1 e1 0c             	shl    $0xc,%ecx
+  8015ec:	89 cb                	mov    %ecx,%ebx
+  8015ee:	83 ec 0c             	sub    $0xc,%esp
+  8015f1:	50                   	push   %eax
+  8015f2:	51                   	push   %ecx
+  8015f3:	ff 75 e4             	push   -0x1c(%ebp)
+  8015f6:	51                   	push   %ecx
+  8015f7:	6a 00                	push   $0x0
+  8015f9:	e8 cd 2b 00 00       	call   8041cb <page_map>
+  8015fe:	83 c4 20             	add    $0x20,%esp
+  801601:	85 c0                	test   %eax,%eax
+  801603:	0f 88 e4 00 00 00    	js     8016ed <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  801609:	83 ec 0c             	sub    $0xc,%esp
+  80160c:	57                   	push   %edi
+  80160d:	53                   	push   %ebx
+  80160e:	6a 00                	push   $0x0
+  801610:	53                   	push   %ebx
+  801611:	6a 00                	push   $0x0
+  801613:	e8 b3 2b 00 00       	call   8041cb <page_map>
+  801618:	83 c4 20             	add    $0x20,%esp
+  80161b:	85 c0                	test   %eax,%eax
+  80161d:	0f 88 dc 00 00 00    	js     8016ff <fork+0x2d0>
+			++pn;
+  801623:	83 c6 01             	add    $0x1,%esi
+			continue;
+  801626:	e9 c8 fe ff ff       	jmp    8014f3 <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  80162b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80162e:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801635:	c1 e1 0c             	shl    $0xc,%ecx
+  801638:	83 ec 0c             	sub    $0xc,%esp
+  80163b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801640:	50                   	push   %eax
+  801641:	51                   	push   %ecx
+  801642:	ff 75 e4             	push   -0x1c(%ebp)
+  801645:	51                   	push   %ecx
+  801646:	6a 00                	push   $0x0
+  801648:	e8 7e 2b 00 00       	call   8041cb <page_map>
+  80164d:	83 c4 20             	add    $0x20,%esp
+  801650:	85 c0                	test   %eax,%eax
+  801652:	79 cf                	jns    801623 <fork+0x1f4>
+			panic("page_map %d", r);
+  801654:	50                   	push   %eax
+  801655:	68 26 58 80 00       	push   $0x805826
+  80165a:	6a 4d                	push   $0x4d
+  80165c:	68 0b 58 80 00       	push   $0x80580b
+  801661:	e8 2d eb ff ff       	call   800193 <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  801666:	83 ec 0c             	sub    $0xc,%esp
+  801669:	68 00 10 00 00       	push   $0x1000
+  80166e:	e8 4a 31 00 00       	call   8047bd <malloc>
+  801673:	89 c7                	mov    %eax,%edi
+  801675:	83 c4 10             	add    $0x10,%esp
+  801678:	85 c0                	test   %eax,%eax
+  80167a:	74 4b                	je     8016c7 <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  80167c:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80167f:	c1 e3 0c             	shl    $0xc,%ebx
+  801682:	83 ec 04             	sub    $0x4,%esp
+  801685:	68 00 10 00 00       	push   $0x1000
+  80168a:	53                   	push   %ebx
+  80168b:	50                   	push   %eax
+  80168c:	e8 ac f3 ff ff       	call   800a3d <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  801691:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801694:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80169b:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016a0:	89 04 24             	mov    %eax,(%esp)
+  8016a3:	53                   	push   %ebx
+  8016a4:	ff 75 e4             	push   -0x1c(%ebp)
+  8016a7:	57                   	push   %edi
+  8016a8:	6a 00                	push   $0x0
+  8016aa:	e8 1c 2b 00 00       	call   8041cb <page_map>
+  8016af:	83 c4 20             	add    $0x20,%esp
+  8016b2:	85 c0                	test   %eax,%eax
+  8016b4:	78 25                	js     8016db <fork+0x2ac>
+		free(temp);
+  8016b6:	83 ec 0c             	sub    $0xc,%esp
+  8016b9:	57                   	push   %edi
+  8016ba:	e8 fc 2e 00 00       	call   8045bb <free>
+  8016bf:	83 c4 10             	add    $0x10,%esp
+  8016c2:	e9 5c ff ff ff       	jmp    801623 <fork+0x1f4>
+			panic("malloc failed");
+  8016c7:	83 ec 04             	sub    $0x4,%esp
+  8016ca:	68 32 58 80 00       	push   $0x805832
+  8016cf:	6a 56                	push   $0x56
+  8016d1:	68 0b 58 80 00       	push   $0x80580b
+  8016d6:	e8 b8 ea ff ff       	call   800193 <_panic>
+			panic("page_map: %e", r);
+  8016db:	50                   	push   %eax
+  8016dc:	68 40 58 80 00       	push   $0x805840
+  8016e1:	6a 59                	push   $0x59
+  8016e3:	68 0b 58 80 00       	push   $0x80580b
+  8016e8:	e8 a6 ea ff ff       	call   800193 <_panic>
+			panic("page_map %d", r);
+  8016ed:	50                   	push   %eax
+  8016ee:	68 26 58 80 00       	push   $0x805826
+  8016f3:	6a 65                	push   $0x65
+  8016f5:	68 0b 58 80 00       	push   $0x80580b
+  8016fa:	e8 94 ea ff ff       	call   800193 <_panic>
+			panic("page_map %d", r);
+  8016ff:	50                   	push   %eax
+  801700:	68 26 58 80 00       	push   $0x805826
+  801705:	6a 78                	push   $0x78
+  801707:	68 0b 58 80 00       	push   $0x80580b
+  80170c:	e8 82 ea ff ff       	call   800193 <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  801711:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801714:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80171b:	c1 e1 0c             	shl    $0xc,%ecx
+  80171e:	83 ec 0c             	sub    $0xc,%esp
+  801721:	25 07 0e 00 00       	and    $0xe07,%eax
+  801726:	50                   	push   %eax
+  801727:	51                   	push   %ecx
+  801728:	ff 75 e4             	push   -0x1c(%ebp)
+  80172b:	51                   	push   %ecx
+  80172c:	6a 00                	push   $0x0
+  80172e:	e8 98 2a 00 00       	call   8041cb <page_map>
+  801733:	83 c4 20             	add    $0x20,%esp
+  801736:	85 c0                	test   %eax,%eax
+  801738:	0f 89 e5 fe ff ff    	jns    801623 <fork+0x1f4>
+			panic("page_map %d", r);
+  80173e:	50                   	push   %eax
+  80173f:	68 26 58 80 00       	push   $0x805826
+  801744:	6a 7f                	push   $0x7f
+  801746:	68 0b 58 80 00       	push   $0x80580b
+  80174b:	e8 43 ea ff ff       	call   800193 <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801750:	83 c7 01             	add    $0x1,%edi
+  801753:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801756:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  801759:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  80175c:	39 f7                	cmp    %esi,%edi
+  80175e:	74 1c                	je     80177c <fork+0x34d>
+  801760:	89 d8                	mov    %ebx,%eax
+  801762:	e8 c5 fb ff ff       	call   80132c <dupable>
+  801767:	84 c0                	test   %al,%al
+  801769:	74 7c                	je     8017e7 <fork+0x3b8>
+  80176b:	89 d8                	mov    %ebx,%eax
+  80176d:	e8 71 fb ff ff       	call   8012e3 <dupperm>
+  801772:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  801775:	74 d9                	je     801750 <fork+0x321>
+  801777:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80177a:	eb 06                	jmp    801782 <fork+0x353>
+  80177c:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80177f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  801782:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801785:	c1 e0 0c             	shl    $0xc,%eax
+  801788:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80178b:	83 ec 08             	sub    $0x8,%esp
+  80178e:	ff 75 dc             	push   -0x24(%ebp)
+  801791:	57                   	push   %edi
+  801792:	50                   	push   %eax
+  801793:	ff 75 e4             	push   -0x1c(%ebp)
+  801796:	50                   	push   %eax
+  801797:	6a 00                	push   $0x0
+  801799:	e8 24 2c 00 00       	call   8043c2 <page_map_range>
+  80179e:	83 c4 20             	add    $0x20,%esp
+  8017a1:	85 c0                	test   %eax,%eax
+  8017a3:	78 47                	js     8017ec <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  8017a5:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  8017ac:	0f 84 41 fd ff ff    	je     8014f3 <fork+0xc4>
+  8017b2:	83 ec 08             	sub    $0x8,%esp
+  8017b5:	ff 75 dc             	push   -0x24(%ebp)
+  8017b8:	57                   	push   %edi
+  8017b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017bc:	50                   	push   %eax
+  8017bd:	6a 00                	push   $0x0
+  8017bf:	50                   	push   %eax
+  8017c0:	6a 00                	push   $0x0
+  8017c2:	e8 fb 2b 00 00       	call   8043c2 <page_map_range>
+  8017c7:	83 c4 20             	add    $0x20,%esp
+  8017ca:	85 c0                	test   %eax,%eax
+  8017cc:	0f 89 21 fd ff ff    	jns    8014f3 <fork+0xc4>
+		panic("page_map_range %e", r);
+  8017d2:	50                   	push   %eax
+  8017d3:	68 4d 58 80 00       	push   $0x80584d
+  8017d8:	68 a2 00 00 00       	push   $0xa2
+  8017dd:	68 0b 58 80 00       	push   $0x80580b
+  8017e2:	e8 ac e9 ff ff       	call   800193 <_panic>
+  8017e7:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8017ea:	eb 96                	jmp    801782 <fork+0x353>
+		panic("page_map_range %e", r);
+  8017ec:	50                   	push   %eax
+  8017ed:	68 4d 58 80 00       	push   $0x80584d
+  8017f2:	68 a0 00 00 00       	push   $0xa0
+  8017f7:	68 0b 58 80 00       	push   $0x80580b
+  8017fc:	e8 92 e9 ff ff       	call   800193 <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  801801:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  801804:	6a 01                	push   $0x1
+  801806:	6a 07                	push   $0x7
+  801808:	68 00 f0 bf ee       	push   $0xeebff000
+  80180d:	53                   	push   %ebx
+  80180e:	e8 57 23 00 00       	call   803b6a <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801813:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801818:	8b 40 74             	mov    0x74(%eax),%eax
+  80181b:	83 c4 08             	add    $0x8,%esp
+  80181e:	50                   	push   %eax
+  80181f:	53                   	push   %ebx
+  801820:	e8 89 f8 ff ff       	call   8010ae <sys_env_set_pgfault_upcall>
+  801825:	83 c4 10             	add    $0x10,%esp
+  801828:	e9 41 fc ff ff       	jmp    80146e <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80182d:	e8 d8 f4 ff ff       	call   800d0a <sys_getenvid>
+  801832:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801837:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80183a:	c1 e0 06             	shl    $0x6,%eax
+  80183d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801842:	a3 18 e9 80 00       	mov    %eax,0x80e918
+		return 0;
+  801847:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80184e:	e9 40 fc ff ff       	jmp    801493 <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  801853:	50                   	push   %eax
+  801854:	68 5f 58 80 00       	push   $0x80585f
+  801859:	68 27 01 00 00       	push   $0x127
+  80185e:	68 0b 58 80 00       	push   $0x80580b
+  801863:	e8 2b e9 ff ff       	call   800193 <_panic>
+		panic("sys_env_set_status: %d", r);
+  801868:	50                   	push   %eax
+  801869:	68 78 58 80 00       	push   $0x805878
+  80186e:	68 2b 01 00 00       	push   $0x12b
+  801873:	68 0b 58 80 00       	push   $0x80580b
+  801878:	e8 16 e9 ff ff       	call   800193 <_panic>
+
+0080187d <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80187d:	55                   	push   %ebp
+  80187e:	89 e5                	mov    %esp,%ebp
+  801880:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801883:	68 8f 58 80 00       	push   $0x80588f
+  801888:	68 35 01 00 00       	push   $0x135
+  80188d:	68 0b 58 80 00       	push   $0x80580b
+  801892:	e8 fc e8 ff ff       	call   800193 <_panic>
+
+00801897 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801897:	55                   	push   %ebp
+  801898:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80189a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80189d:	05 00 00 00 30       	add    $0x30000000,%eax
+  8018a2:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8018a5:	5d                   	pop    %ebp
+  8018a6:	c3                   	ret
+
+008018a7 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8018a7:	55                   	push   %ebp
+  8018a8:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ad:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8018b2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8018b7:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8018bc:	5d                   	pop    %ebp
+  8018bd:	c3                   	ret
+
+008018be <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8018be:	55                   	push   %ebp
+  8018bf:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8018c1:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8018c6:	a8 01                	test   $0x1,%al
+  8018c8:	74 3c                	je     801906 <fd_alloc+0x48>
+  8018ca:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8018cf:	89 c2                	mov    %eax,%edx
+  8018d1:	c1 ea 0c             	shr    $0xc,%edx
+  8018d4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8018db:	89 c1                	mov    %eax,%ecx
+  8018dd:	05 00 10 00 00       	add    $0x1000,%eax
+  8018e2:	f6 c2 01             	test   $0x1,%dl
+  8018e5:	74 13                	je     8018fa <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8018e7:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8018ec:	75 e1                	jne    8018cf <fd_alloc+0x11>
+  8018ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8018f3:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8018f8:	eb 05                	jmp    8018ff <fd_alloc+0x41>
+			return 0;
+  8018fa:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8018ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801902:	89 0a                	mov    %ecx,(%edx)
+}
+  801904:	5d                   	pop    %ebp
+  801905:	c3                   	ret
+  801906:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  80190b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801910:	eb ed                	jmp    8018ff <fd_alloc+0x41>
+
+00801912 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801912:	55                   	push   %ebp
+  801913:	89 e5                	mov    %esp,%ebp
+  801915:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801918:	83 f8 1f             	cmp    $0x1f,%eax
+  80191b:	77 30                	ja     80194d <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80191d:	c1 e0 0c             	shl    $0xc,%eax
+  801920:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801925:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80192b:	f6 c2 01             	test   $0x1,%dl
+  80192e:	74 24                	je     801954 <fd_lookup+0x42>
+  801930:	89 c2                	mov    %eax,%edx
+  801932:	c1 ea 0c             	shr    $0xc,%edx
+  801935:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80193c:	f6 c2 01             	test   $0x1,%dl
+  80193f:	74 1a                	je     80195b <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801941:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801944:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801946:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80194b:	5d                   	pop    %ebp
+  80194c:	c3                   	ret
+		return -E_INVAL;
+  80194d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801952:	eb f7                	jmp    80194b <fd_lookup+0x39>
+		return -E_INVAL;
+  801954:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801959:	eb f0                	jmp    80194b <fd_lookup+0x39>
+  80195b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801960:	eb e9                	jmp    80194b <fd_lookup+0x39>
+
+00801962 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801962:	55                   	push   %ebp
+  801963:	89 e5                	mov    %esp,%ebp
+  801965:	53                   	push   %ebx
+  801966:	83 ec 04             	sub    $0x4,%esp
+  801969:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80196c:	b8 24 59 80 00       	mov    $0x805924,%eax
+  801971:	8b 18                	mov    (%eax),%ebx
+  801973:	85 db                	test   %ebx,%ebx
+  801975:	74 0e                	je     801985 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801977:	83 c0 04             	add    $0x4,%eax
+  80197a:	39 13                	cmp    %edx,(%ebx)
+  80197c:	75 f3                	jne    801971 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  80197e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801983:	eb 1f                	jmp    8019a4 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801985:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80198a:	8b 40 48             	mov    0x48(%eax),%eax
+  80198d:	83 ec 04             	sub    $0x4,%esp
+  801990:	52                   	push   %edx
+  801991:	50                   	push   %eax
+  801992:	68 a8 58 80 00       	push   $0x8058a8
+  801997:	e8 d2 e8 ff ff       	call   80026e <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80199c:	83 c4 10             	add    $0x10,%esp
+  80199f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8019a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019a7:	89 1a                	mov    %ebx,(%edx)
+}
+  8019a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ac:	c9                   	leave
+  8019ad:	c3                   	ret
+
+008019ae <fd_close>:
+{
+  8019ae:	55                   	push   %ebp
+  8019af:	89 e5                	mov    %esp,%ebp
+  8019b1:	57                   	push   %edi
+  8019b2:	56                   	push   %esi
+  8019b3:	53                   	push   %ebx
+  8019b4:	83 ec 24             	sub    $0x24,%esp
+  8019b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019ba:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019bd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019c0:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019c1:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019c7:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019ca:	50                   	push   %eax
+  8019cb:	e8 42 ff ff ff       	call   801912 <fd_lookup>
+  8019d0:	89 c3                	mov    %eax,%ebx
+  8019d2:	83 c4 10             	add    $0x10,%esp
+  8019d5:	85 c0                	test   %eax,%eax
+  8019d7:	78 05                	js     8019de <fd_close+0x30>
+	    || fd != fd2)
+  8019d9:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8019dc:	74 16                	je     8019f4 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8019de:	89 f8                	mov    %edi,%eax
+  8019e0:	84 c0                	test   %al,%al
+  8019e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e7:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8019ea:	89 d8                	mov    %ebx,%eax
+  8019ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ef:	5b                   	pop    %ebx
+  8019f0:	5e                   	pop    %esi
+  8019f1:	5f                   	pop    %edi
+  8019f2:	5d                   	pop    %ebp
+  8019f3:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019f4:	83 ec 08             	sub    $0x8,%esp
+  8019f7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8019fa:	50                   	push   %eax
+  8019fb:	ff 36                	push   (%esi)
+  8019fd:	e8 60 ff ff ff       	call   801962 <dev_lookup>
+  801a02:	89 c3                	mov    %eax,%ebx
+  801a04:	83 c4 10             	add    $0x10,%esp
+  801a07:	85 c0                	test   %eax,%eax
+  801a09:	78 1a                	js     801a25 <fd_close+0x77>
+		if (dev->dev_close)
+  801a0b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a0e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a11:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a16:	85 c0                	test   %eax,%eax
+  801a18:	74 0b                	je     801a25 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a1a:	83 ec 0c             	sub    $0xc,%esp
+  801a1d:	56                   	push   %esi
+  801a1e:	ff d0                	call   *%eax
+  801a20:	89 c3                	mov    %eax,%ebx
+  801a22:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a25:	83 ec 08             	sub    $0x8,%esp
+  801a28:	56                   	push   %esi
+  801a29:	6a 00                	push   $0x0
+  801a2b:	e8 9d f3 ff ff       	call   800dcd <sys_page_unmap>
+	return r;
+  801a30:	83 c4 10             	add    $0x10,%esp
+  801a33:	eb b5                	jmp    8019ea <fd_close+0x3c>
+
+00801a35 <close>:
+
+int
+close(int fdnum)
+{
+  801a35:	55                   	push   %ebp
+  801a36:	89 e5                	mov    %esp,%ebp
+  801a38:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a3b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a3e:	50                   	push   %eax
+  801a3f:	ff 75 08             	push   0x8(%ebp)
+  801a42:	e8 cb fe ff ff       	call   801912 <fd_lookup>
+  801a47:	83 c4 10             	add    $0x10,%esp
+  801a4a:	85 c0                	test   %eax,%eax
+  801a4c:	79 02                	jns    801a50 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a4e:	c9                   	leave
+  801a4f:	c3                   	ret
+		return fd_close(fd, 1);
+  801a50:	83 ec 08             	sub    $0x8,%esp
+  801a53:	6a 01                	push   $0x1
+  801a55:	ff 75 f4             	push   -0xc(%ebp)
+  801a58:	e8 51 ff ff ff       	call   8019ae <fd_close>
+  801a5d:	83 c4 10             	add    $0x10,%esp
+  801a60:	eb ec                	jmp    801a4e <close+0x19>
+
+00801a62 <close_all>:
+
+void
+close_all(void)
+{
+  801a62:	55                   	push   %ebp
+  801a63:	89 e5                	mov    %esp,%ebp
+  801a65:	53                   	push   %ebx
+  801a66:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a69:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a6e:	83 ec 0c             	sub    $0xc,%esp
+  801a71:	53                   	push   %ebx
+  801a72:	e8 be ff ff ff       	call   801a35 <close>
+	for (i = 0; i < MAXFD; i++)
+  801a77:	83 c3 01             	add    $0x1,%ebx
+  801a7a:	83 c4 10             	add    $0x10,%esp
+  801a7d:	83 fb 20             	cmp    $0x20,%ebx
+  801a80:	75 ec                	jne    801a6e <close_all+0xc>
+}
+  801a82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a85:	c9                   	leave
+  801a86:	c3                   	ret
+
+00801a87 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801a87:	55                   	push   %ebp
+  801a88:	89 e5                	mov    %esp,%ebp
+  801a8a:	57                   	push   %edi
+  801a8b:	56                   	push   %esi
+  801a8c:	53                   	push   %ebx
+  801a8d:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801a90:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a93:	50                   	push   %eax
+  801a94:	ff 75 08             	push   0x8(%ebp)
+  801a97:	e8 76 fe ff ff       	call   801912 <fd_lookup>
+  801a9c:	89 c3                	mov    %eax,%ebx
+  801a9e:	83 c4 10             	add    $0x10,%esp
+  801aa1:	85 c0                	test   %eax,%eax
+  801aa3:	78 7f                	js     801b24 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801aa5:	83 ec 0c             	sub    $0xc,%esp
+  801aa8:	ff 75 0c             	push   0xc(%ebp)
+  801aab:	e8 85 ff ff ff       	call   801a35 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801ab0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ab3:	c1 e6 0c             	shl    $0xc,%esi
+  801ab6:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801abc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801abf:	89 3c 24             	mov    %edi,(%esp)
+  801ac2:	e8 e0 fd ff ff       	call   8018a7 <fd2data>
+  801ac7:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801ac9:	89 34 24             	mov    %esi,(%esp)
+  801acc:	e8 d6 fd ff ff       	call   8018a7 <fd2data>
+  801ad1:	83 c4 10             	add    $0x10,%esp
+  801ad4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801ad7:	89 d8                	mov    %ebx,%eax
+  801ad9:	c1 e8 16             	shr    $0x16,%eax
+  801adc:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ae3:	a8 01                	test   $0x1,%al
+  801ae5:	74 11                	je     801af8 <dup+0x71>
+  801ae7:	89 d8                	mov    %ebx,%eax
+  801ae9:	c1 e8 0c             	shr    $0xc,%eax
+  801aec:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801af3:	f6 c2 01             	test   $0x1,%dl
+  801af6:	75 36                	jne    801b2e <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801af8:	89 f8                	mov    %edi,%eax
+  801afa:	c1 e8 0c             	shr    $0xc,%eax
+  801afd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b04:	83 ec 0c             	sub    $0xc,%esp
+  801b07:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b0c:	50                   	push   %eax
+  801b0d:	56                   	push   %esi
+  801b0e:	6a 00                	push   $0x0
+  801b10:	57                   	push   %edi
+  801b11:	6a 00                	push   $0x0
+  801b13:	e8 73 f2 ff ff       	call   800d8b <sys_page_map>
+  801b18:	89 c3                	mov    %eax,%ebx
+  801b1a:	83 c4 20             	add    $0x20,%esp
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	78 33                	js     801b54 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b21:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b24:	89 d8                	mov    %ebx,%eax
+  801b26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b29:	5b                   	pop    %ebx
+  801b2a:	5e                   	pop    %esi
+  801b2b:	5f                   	pop    %edi
+  801b2c:	5d                   	pop    %ebp
+  801b2d:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b2e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b35:	83 ec 0c             	sub    $0xc,%esp
+  801b38:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b3d:	50                   	push   %eax
+  801b3e:	ff 75 d4             	push   -0x2c(%ebp)
+  801b41:	6a 00                	push   $0x0
+  801b43:	53                   	push   %ebx
+  801b44:	6a 00                	push   $0x0
+  801b46:	e8 40 f2 ff ff       	call   800d8b <sys_page_map>
+  801b4b:	89 c3                	mov    %eax,%ebx
+  801b4d:	83 c4 20             	add    $0x20,%esp
+  801b50:	85 c0                	test   %eax,%eax
+  801b52:	79 a4                	jns    801af8 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b54:	83 ec 08             	sub    $0x8,%esp
+  801b57:	56                   	push   %esi
+  801b58:	6a 00                	push   $0x0
+  801b5a:	e8 6e f2 ff ff       	call   800dcd <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b5f:	83 c4 08             	add    $0x8,%esp
+  801b62:	ff 75 d4             	push   -0x2c(%ebp)
+  801b65:	6a 00                	push   $0x0
+  801b67:	e8 61 f2 ff ff       	call   800dcd <sys_page_unmap>
+	return r;
+  801b6c:	83 c4 10             	add    $0x10,%esp
+  801b6f:	eb b3                	jmp    801b24 <dup+0x9d>
+
+00801b71 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b71:	55                   	push   %ebp
+  801b72:	89 e5                	mov    %esp,%ebp
+  801b74:	56                   	push   %esi
+  801b75:	53                   	push   %ebx
+  801b76:	83 ec 18             	sub    $0x18,%esp
+  801b79:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b7c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b7f:	50                   	push   %eax
+  801b80:	56                   	push   %esi
+  801b81:	e8 8c fd ff ff       	call   801912 <fd_lookup>
+  801b86:	83 c4 10             	add    $0x10,%esp
+  801b89:	85 c0                	test   %eax,%eax
+  801b8b:	78 3c                	js     801bc9 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b8d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801b90:	83 ec 08             	sub    $0x8,%esp
+  801b93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b96:	50                   	push   %eax
+  801b97:	ff 33                	push   (%ebx)
+  801b99:	e8 c4 fd ff ff       	call   801962 <dev_lookup>
+  801b9e:	83 c4 10             	add    $0x10,%esp
+  801ba1:	85 c0                	test   %eax,%eax
+  801ba3:	78 24                	js     801bc9 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ba5:	8b 43 08             	mov    0x8(%ebx),%eax
+  801ba8:	83 e0 03             	and    $0x3,%eax
+  801bab:	83 f8 01             	cmp    $0x1,%eax
+  801bae:	74 20                	je     801bd0 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801bb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bb3:	8b 40 08             	mov    0x8(%eax),%eax
+  801bb6:	85 c0                	test   %eax,%eax
+  801bb8:	74 37                	je     801bf1 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801bba:	83 ec 04             	sub    $0x4,%esp
+  801bbd:	ff 75 10             	push   0x10(%ebp)
+  801bc0:	ff 75 0c             	push   0xc(%ebp)
+  801bc3:	53                   	push   %ebx
+  801bc4:	ff d0                	call   *%eax
+  801bc6:	83 c4 10             	add    $0x10,%esp
+}
+  801bc9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bcc:	5b                   	pop    %ebx
+  801bcd:	5e                   	pop    %esi
+  801bce:	5d                   	pop    %ebp
+  801bcf:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bd0:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801bd5:	8b 40 48             	mov    0x48(%eax),%eax
+  801bd8:	83 ec 04             	sub    $0x4,%esp
+  801bdb:	56                   	push   %esi
+  801bdc:	50                   	push   %eax
+  801bdd:	68 e9 58 80 00       	push   $0x8058e9
+  801be2:	e8 87 e6 ff ff       	call   80026e <cprintf>
+		return -E_INVAL;
+  801be7:	83 c4 10             	add    $0x10,%esp
+  801bea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bef:	eb d8                	jmp    801bc9 <read+0x58>
+		return -E_NOT_SUPP;
+  801bf1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bf6:	eb d1                	jmp    801bc9 <read+0x58>
+
+00801bf8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801bf8:	55                   	push   %ebp
+  801bf9:	89 e5                	mov    %esp,%ebp
+  801bfb:	57                   	push   %edi
+  801bfc:	56                   	push   %esi
+  801bfd:	53                   	push   %ebx
+  801bfe:	83 ec 0c             	sub    $0xc,%esp
+  801c01:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c04:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c0c:	eb 02                	jmp    801c10 <readn+0x18>
+  801c0e:	01 c3                	add    %eax,%ebx
+  801c10:	39 f3                	cmp    %esi,%ebx
+  801c12:	73 21                	jae    801c35 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c14:	83 ec 04             	sub    $0x4,%esp
+  801c17:	89 f0                	mov    %esi,%eax
+  801c19:	29 d8                	sub    %ebx,%eax
+  801c1b:	50                   	push   %eax
+  801c1c:	89 d8                	mov    %ebx,%eax
+  801c1e:	03 45 0c             	add    0xc(%ebp),%eax
+  801c21:	50                   	push   %eax
+  801c22:	57                   	push   %edi
+  801c23:	e8 49 ff ff ff       	call   801b71 <read>
+		if (m < 0)
+  801c28:	83 c4 10             	add    $0x10,%esp
+  801c2b:	85 c0                	test   %eax,%eax
+  801c2d:	78 04                	js     801c33 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c2f:	75 dd                	jne    801c0e <readn+0x16>
+  801c31:	eb 02                	jmp    801c35 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c33:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c35:	89 d8                	mov    %ebx,%eax
+  801c37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c3a:	5b                   	pop    %ebx
+  801c3b:	5e                   	pop    %esi
+  801c3c:	5f                   	pop    %edi
+  801c3d:	5d                   	pop    %ebp
+  801c3e:	c3                   	ret
+
+00801c3f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c3f:	55                   	push   %ebp
+  801c40:	89 e5                	mov    %esp,%ebp
+  801c42:	56                   	push   %esi
+  801c43:	53                   	push   %ebx
+  801c44:	83 ec 18             	sub    $0x18,%esp
+  801c47:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c4a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c4d:	50                   	push   %eax
+  801c4e:	53                   	push   %ebx
+  801c4f:	e8 be fc ff ff       	call   801912 <fd_lookup>
+  801c54:	83 c4 10             	add    $0x10,%esp
+  801c57:	85 c0                	test   %eax,%eax
+  801c59:	78 37                	js     801c92 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c5b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c5e:	83 ec 08             	sub    $0x8,%esp
+  801c61:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c64:	50                   	push   %eax
+  801c65:	ff 36                	push   (%esi)
+  801c67:	e8 f6 fc ff ff       	call   801962 <dev_lookup>
+  801c6c:	83 c4 10             	add    $0x10,%esp
+  801c6f:	85 c0                	test   %eax,%eax
+  801c71:	78 1f                	js     801c92 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c73:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c77:	74 20                	je     801c99 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801c79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c7c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c7f:	85 c0                	test   %eax,%eax
+  801c81:	74 37                	je     801cba <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c83:	83 ec 04             	sub    $0x4,%esp
+  801c86:	ff 75 10             	push   0x10(%ebp)
+  801c89:	ff 75 0c             	push   0xc(%ebp)
+  801c8c:	56                   	push   %esi
+  801c8d:	ff d0                	call   *%eax
+  801c8f:	83 c4 10             	add    $0x10,%esp
+}
+  801c92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c95:	5b                   	pop    %ebx
+  801c96:	5e                   	pop    %esi
+  801c97:	5d                   	pop    %ebp
+  801c98:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c99:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801c9e:	8b 40 48             	mov    0x48(%eax),%eax
+  801ca1:	83 ec 04             	sub    $0x4,%esp
+  801ca4:	53                   	push   %ebx
+  801ca5:	50                   	push   %eax
+  801ca6:	68 05 59 80 00       	push   $0x805905
+  801cab:	e8 be e5 ff ff       	call   80026e <cprintf>
+		return -E_INVAL;
+  801cb0:	83 c4 10             	add    $0x10,%esp
+  801cb3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cb8:	eb d8                	jmp    801c92 <write+0x53>
+		return -E_NOT_SUPP;
+  801cba:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cbf:	eb d1                	jmp    801c92 <write+0x53>
+
+00801cc1 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801cc1:	55                   	push   %ebp
+  801cc2:	89 e5                	mov    %esp,%ebp
+  801cc4:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801cc7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cca:	50                   	push   %eax
+  801ccb:	ff 75 08             	push   0x8(%ebp)
+  801cce:	e8 3f fc ff ff       	call   801912 <fd_lookup>
+  801cd3:	83 c4 10             	add    $0x10,%esp
+  801cd6:	85 c0                	test   %eax,%eax
+  801cd8:	78 0e                	js     801ce8 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801cda:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cdd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ce0:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801ce3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ce8:	c9                   	leave
+  801ce9:	c3                   	ret
+
+00801cea <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801cea:	55                   	push   %ebp
+  801ceb:	89 e5                	mov    %esp,%ebp
+  801ced:	56                   	push   %esi
+  801cee:	53                   	push   %ebx
+  801cef:	83 ec 18             	sub    $0x18,%esp
+  801cf2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cf5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cf8:	50                   	push   %eax
+  801cf9:	53                   	push   %ebx
+  801cfa:	e8 13 fc ff ff       	call   801912 <fd_lookup>
+  801cff:	83 c4 10             	add    $0x10,%esp
+  801d02:	85 c0                	test   %eax,%eax
+  801d04:	78 34                	js     801d3a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d06:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d09:	83 ec 08             	sub    $0x8,%esp
+  801d0c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d0f:	50                   	push   %eax
+  801d10:	ff 36                	push   (%esi)
+  801d12:	e8 4b fc ff ff       	call   801962 <dev_lookup>
+  801d17:	83 c4 10             	add    $0x10,%esp
+  801d1a:	85 c0                	test   %eax,%eax
+  801d1c:	78 1c                	js     801d3a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d1e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d22:	74 1d                	je     801d41 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d27:	8b 40 18             	mov    0x18(%eax),%eax
+  801d2a:	85 c0                	test   %eax,%eax
+  801d2c:	74 34                	je     801d62 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d2e:	83 ec 08             	sub    $0x8,%esp
+  801d31:	ff 75 0c             	push   0xc(%ebp)
+  801d34:	56                   	push   %esi
+  801d35:	ff d0                	call   *%eax
+  801d37:	83 c4 10             	add    $0x10,%esp
+}
+  801d3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d3d:	5b                   	pop    %ebx
+  801d3e:	5e                   	pop    %esi
+  801d3f:	5d                   	pop    %ebp
+  801d40:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801d41:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801d46:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d49:	83 ec 04             	sub    $0x4,%esp
+  801d4c:	53                   	push   %ebx
+  801d4d:	50                   	push   %eax
+  801d4e:	68 c8 58 80 00       	push   $0x8058c8
+  801d53:	e8 16 e5 ff ff       	call   80026e <cprintf>
+		return -E_INVAL;
+  801d58:	83 c4 10             	add    $0x10,%esp
+  801d5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d60:	eb d8                	jmp    801d3a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801d62:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d67:	eb d1                	jmp    801d3a <ftruncate+0x50>
+
+00801d69 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d69:	55                   	push   %ebp
+  801d6a:	89 e5                	mov    %esp,%ebp
+  801d6c:	56                   	push   %esi
+  801d6d:	53                   	push   %ebx
+  801d6e:	83 ec 18             	sub    $0x18,%esp
+  801d71:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d74:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d77:	50                   	push   %eax
+  801d78:	ff 75 08             	push   0x8(%ebp)
+  801d7b:	e8 92 fb ff ff       	call   801912 <fd_lookup>
+  801d80:	83 c4 10             	add    $0x10,%esp
+  801d83:	85 c0                	test   %eax,%eax
+  801d85:	78 49                	js     801dd0 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d87:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d8a:	83 ec 08             	sub    $0x8,%esp
+  801d8d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d90:	50                   	push   %eax
+  801d91:	ff 36                	push   (%esi)
+  801d93:	e8 ca fb ff ff       	call   801962 <dev_lookup>
+  801d98:	83 c4 10             	add    $0x10,%esp
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	78 31                	js     801dd0 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801da2:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801da6:	74 2f                	je     801dd7 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801da8:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801dab:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801db2:	00 00 00 
+	stat->st_isdir = 0;
+  801db5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801dbc:	00 00 00 
+	stat->st_dev = dev;
+  801dbf:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801dc5:	83 ec 08             	sub    $0x8,%esp
+  801dc8:	53                   	push   %ebx
+  801dc9:	56                   	push   %esi
+  801dca:	ff 50 14             	call   *0x14(%eax)
+  801dcd:	83 c4 10             	add    $0x10,%esp
+}
+  801dd0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dd3:	5b                   	pop    %ebx
+  801dd4:	5e                   	pop    %esi
+  801dd5:	5d                   	pop    %ebp
+  801dd6:	c3                   	ret
+		return -E_NOT_SUPP;
+  801dd7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ddc:	eb f2                	jmp    801dd0 <fstat+0x67>
+
+00801dde <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801dde:	55                   	push   %ebp
+  801ddf:	89 e5                	mov    %esp,%ebp
+  801de1:	56                   	push   %esi
+  801de2:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801de3:	83 ec 08             	sub    $0x8,%esp
+  801de6:	6a 00                	push   $0x0
+  801de8:	ff 75 08             	push   0x8(%ebp)
+  801deb:	e8 bc 02 00 00       	call   8020ac <open>
+  801df0:	89 c3                	mov    %eax,%ebx
+  801df2:	83 c4 10             	add    $0x10,%esp
+  801df5:	85 c0                	test   %eax,%eax
+  801df7:	78 1b                	js     801e14 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801df9:	83 ec 08             	sub    $0x8,%esp
+  801dfc:	ff 75 0c             	push   0xc(%ebp)
+  801dff:	50                   	push   %eax
+  801e00:	e8 64 ff ff ff       	call   801d69 <fstat>
+  801e05:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e07:	89 1c 24             	mov    %ebx,(%esp)
+  801e0a:	e8 26 fc ff ff       	call   801a35 <close>
+	return r;
+  801e0f:	83 c4 10             	add    $0x10,%esp
+  801e12:	89 f3                	mov    %esi,%ebx
+}
+  801e14:	89 d8                	mov    %ebx,%eax
+  801e16:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e19:	5b                   	pop    %ebx
+  801e1a:	5e                   	pop    %esi
+  801e1b:	5d                   	pop    %ebp
+  801e1c:	c3                   	ret
+
+00801e1d <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801e1d:	55                   	push   %ebp
+  801e1e:	89 e5                	mov    %esp,%ebp
+  801e20:	57                   	push   %edi
+  801e21:	56                   	push   %esi
+  801e22:	53                   	push   %ebx
+  801e23:	83 ec 0c             	sub    $0xc,%esp
+  801e26:	89 c7                	mov    %eax,%edi
+  801e28:	89 d3                	mov    %edx,%ebx
+  801e2a:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801e2c:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801e33:	74 2d                	je     801e62 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e35:	6a 07                	push   $0x7
+  801e37:	68 00 f0 80 00       	push   $0x80f000
+  801e3c:	57                   	push   %edi
+  801e3d:	ff 35 00 70 80 00    	push   0x807000
+  801e43:	e8 ba 31 00 00       	call   805002 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801e48:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801e4f:	6a 00                	push   $0x0
+  801e51:	56                   	push   %esi
+  801e52:	53                   	push   %ebx
+  801e53:	6a 00                	push   $0x0
+  801e55:	e8 5a 30 00 00       	call   804eb4 <ipc_recv_pages>
+}
+  801e5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e5d:	5b                   	pop    %ebx
+  801e5e:	5e                   	pop    %esi
+  801e5f:	5f                   	pop    %edi
+  801e60:	5d                   	pop    %ebp
+  801e61:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e62:	83 ec 0c             	sub    $0xc,%esp
+  801e65:	6a 01                	push   $0x1
+  801e67:	e8 8b 32 00 00       	call   8050f7 <ipc_find_env>
+  801e6c:	a3 00 70 80 00       	mov    %eax,0x807000
+  801e71:	83 c4 10             	add    $0x10,%esp
+  801e74:	eb bf                	jmp    801e35 <fsipc_pages+0x18>
+
+00801e76 <fsipc>:
+{
+  801e76:	55                   	push   %ebp
+  801e77:	89 e5                	mov    %esp,%ebp
+  801e79:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801e7c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e81:	e8 97 ff ff ff       	call   801e1d <fsipc_pages>
+}
+  801e86:	c9                   	leave
+  801e87:	c3                   	ret
+
+00801e88 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e88:	55                   	push   %ebp
+  801e89:	89 e5                	mov    %esp,%ebp
+  801e8b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e91:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e94:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  801e99:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e9c:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801ea1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea6:	b8 02 00 00 00       	mov    $0x2,%eax
+  801eab:	e8 c6 ff ff ff       	call   801e76 <fsipc>
+}
+  801eb0:	c9                   	leave
+  801eb1:	c3                   	ret
+
+00801eb2 <devfile_flush>:
+{
+  801eb2:	55                   	push   %ebp
+  801eb3:	89 e5                	mov    %esp,%ebp
+  801eb5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801eb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ebb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ebe:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801ec3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec8:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ecd:	e8 a4 ff ff ff       	call   801e76 <fsipc>
+}
+  801ed2:	c9                   	leave
+  801ed3:	c3                   	ret
+
+00801ed4 <devfile_stat>:
+{
+  801ed4:	55                   	push   %ebp
+  801ed5:	89 e5                	mov    %esp,%ebp
+  801ed7:	53                   	push   %ebx
+  801ed8:	83 ec 04             	sub    $0x4,%esp
+  801edb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ede:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ee4:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801ee9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eee:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ef3:	e8 7e ff ff ff       	call   801e76 <fsipc>
+  801ef8:	85 c0                	test   %eax,%eax
+  801efa:	78 2c                	js     801f28 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801efc:	83 ec 08             	sub    $0x8,%esp
+  801eff:	68 00 f0 80 00       	push   $0x80f000
+  801f04:	53                   	push   %ebx
+  801f05:	e8 4b e9 ff ff       	call   800855 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f0a:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  801f0f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f15:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  801f1a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801f20:	83 c4 10             	add    $0x10,%esp
+  801f23:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f2b:	c9                   	leave
+  801f2c:	c3                   	ret
+
+00801f2d <devfile_write>:
+{
+  801f2d:	55                   	push   %ebp
+  801f2e:	89 e5                	mov    %esp,%ebp
+  801f30:	83 ec 0c             	sub    $0xc,%esp
+  801f33:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801f36:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801f3b:	39 d0                	cmp    %edx,%eax
+  801f3d:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f40:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f43:	8b 52 0c             	mov    0xc(%edx),%edx
+  801f46:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  801f4c:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801f51:	50                   	push   %eax
+  801f52:	ff 75 0c             	push   0xc(%ebp)
+  801f55:	68 08 f0 80 00       	push   $0x80f008
+  801f5a:	e8 7c ea ff ff       	call   8009db <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801f5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f64:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f69:	e8 08 ff ff ff       	call   801e76 <fsipc>
+}
+  801f6e:	c9                   	leave
+  801f6f:	c3                   	ret
+
+00801f70 <devfile_read>:
+{
+  801f70:	55                   	push   %ebp
+  801f71:	89 e5                	mov    %esp,%ebp
+  801f73:	57                   	push   %edi
+  801f74:	56                   	push   %esi
+  801f75:	53                   	push   %ebx
+  801f76:	83 ec 1c             	sub    $0x1c,%esp
+  801f79:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f7c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801f7f:	89 fe                	mov    %edi,%esi
+  801f81:	c1 ee 0c             	shr    $0xc,%esi
+  801f84:	b8 20 00 00 00       	mov    $0x20,%eax
+  801f89:	39 c6                	cmp    %eax,%esi
+  801f8b:	0f 47 f0             	cmova  %eax,%esi
+  801f8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f91:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f96:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801f99:	eb 14                	jmp    801faf <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801f9b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801fa2:	05 00 10 00 00       	add    $0x1000,%eax
+  801fa7:	f6 c6 06             	test   $0x6,%dh
+  801faa:	75 42                	jne    801fee <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801fac:	83 c1 01             	add    $0x1,%ecx
+  801faf:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801fb2:	39 f1                	cmp    %esi,%ecx
+  801fb4:	0f 84 95 00 00 00    	je     80204f <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801fba:	89 c2                	mov    %eax,%edx
+  801fbc:	c1 ea 16             	shr    $0x16,%edx
+  801fbf:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801fc6:	f6 c2 01             	test   $0x1,%dl
+  801fc9:	74 23                	je     801fee <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801fcb:	89 c2                	mov    %eax,%edx
+  801fcd:	c1 ea 0c             	shr    $0xc,%edx
+  801fd0:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801fd7:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801fdd:	74 0f                	je     801fee <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801fdf:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801fe6:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801fec:	75 ad                	jne    801f9b <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801fee:	85 c9                	test   %ecx,%ecx
+  801ff0:	74 11                	je     802003 <devfile_read+0x93>
+  801ff2:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801ff9:	75 08                	jne    802003 <devfile_read+0x93>
+  801ffb:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  802001:	74 50                	je     802053 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802003:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802006:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  80200b:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802011:	ba 00 00 00 00       	mov    $0x0,%edx
+  802016:	b8 03 00 00 00       	mov    $0x3,%eax
+  80201b:	e8 56 fe ff ff       	call   801e76 <fsipc>
+  802020:	89 c6                	mov    %eax,%esi
+  802022:	85 c0                	test   %eax,%eax
+  802024:	78 1f                	js     802045 <devfile_read+0xd5>
+	assert(r <= n);
+  802026:	39 c7                	cmp    %eax,%edi
+  802028:	72 50                	jb     80207a <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  80202a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80202f:	7f 62                	jg     802093 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  802031:	83 ec 04             	sub    $0x4,%esp
+  802034:	50                   	push   %eax
+  802035:	68 00 f0 80 00       	push   $0x80f000
+  80203a:	ff 75 0c             	push   0xc(%ebp)
+  80203d:	e8 99 e9 ff ff       	call   8009db <memmove>
+	return r;
+  802042:	83 c4 10             	add    $0x10,%esp
+}
+  802045:	89 f0                	mov    %esi,%eax
+  802047:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80204a:	5b                   	pop    %ebx
+  80204b:	5e                   	pop    %esi
+  80204c:	5f                   	pop    %edi
+  80204d:	5d                   	pop    %ebp
+  80204e:	c3                   	ret
+  80204f:	89 f1                	mov    %esi,%ecx
+  802051:	eb 9b                	jmp    801fee <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  802053:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802056:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  80205b:	89 c8                	mov    %ecx,%eax
+  80205d:	c1 e0 0c             	shl    $0xc,%eax
+  802060:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  802065:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802068:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80206d:	e8 ab fd ff ff       	call   801e1d <fsipc_pages>
+  802072:	89 c6                	mov    %eax,%esi
+  802074:	85 c0                	test   %eax,%eax
+  802076:	78 8b                	js     802003 <devfile_read+0x93>
+  802078:	eb cb                	jmp    802045 <devfile_read+0xd5>
+	assert(r <= n);
+  80207a:	68 34 59 80 00       	push   $0x805934
+  80207f:	68 c3 53 80 00       	push   $0x8053c3
+  802084:	68 a0 00 00 00       	push   $0xa0
+  802089:	68 3b 59 80 00       	push   $0x80593b
+  80208e:	e8 00 e1 ff ff       	call   800193 <_panic>
+	assert(r <= PGSIZE);
+  802093:	68 46 59 80 00       	push   $0x805946
+  802098:	68 c3 53 80 00       	push   $0x8053c3
+  80209d:	68 a1 00 00 00       	push   $0xa1
+  8020a2:	68 3b 59 80 00       	push   $0x80593b
+  8020a7:	e8 e7 e0 ff ff       	call   800193 <_panic>
+
+008020ac <open>:
+{
+  8020ac:	55                   	push   %ebp
+  8020ad:	89 e5                	mov    %esp,%ebp
+  8020af:	56                   	push   %esi
+  8020b0:	53                   	push   %ebx
+  8020b1:	83 ec 1c             	sub    $0x1c,%esp
+  8020b4:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8020b7:	56                   	push   %esi
+  8020b8:	e8 5d e7 ff ff       	call   80081a <strlen>
+  8020bd:	83 c4 10             	add    $0x10,%esp
+  8020c0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020c5:	7f 6c                	jg     802133 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8020c7:	83 ec 0c             	sub    $0xc,%esp
+  8020ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020cd:	50                   	push   %eax
+  8020ce:	e8 eb f7 ff ff       	call   8018be <fd_alloc>
+  8020d3:	89 c3                	mov    %eax,%ebx
+  8020d5:	83 c4 10             	add    $0x10,%esp
+  8020d8:	85 c0                	test   %eax,%eax
+  8020da:	78 3c                	js     802118 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8020dc:	83 ec 08             	sub    $0x8,%esp
+  8020df:	56                   	push   %esi
+  8020e0:	68 00 f0 80 00       	push   $0x80f000
+  8020e5:	e8 6b e7 ff ff       	call   800855 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8020ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020ed:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8020f2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020f5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020fa:	e8 77 fd ff ff       	call   801e76 <fsipc>
+  8020ff:	89 c3                	mov    %eax,%ebx
+  802101:	83 c4 10             	add    $0x10,%esp
+  802104:	85 c0                	test   %eax,%eax
+  802106:	78 19                	js     802121 <open+0x75>
+	return fd2num(fd);
+  802108:	83 ec 0c             	sub    $0xc,%esp
+  80210b:	ff 75 f4             	push   -0xc(%ebp)
+  80210e:	e8 84 f7 ff ff       	call   801897 <fd2num>
+  802113:	89 c3                	mov    %eax,%ebx
+  802115:	83 c4 10             	add    $0x10,%esp
+}
+  802118:	89 d8                	mov    %ebx,%eax
+  80211a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80211d:	5b                   	pop    %ebx
+  80211e:	5e                   	pop    %esi
+  80211f:	5d                   	pop    %ebp
+  802120:	c3                   	ret
+		fd_close(fd, 0);
+  802121:	83 ec 08             	sub    $0x8,%esp
+  802124:	6a 00                	push   $0x0
+  802126:	ff 75 f4             	push   -0xc(%ebp)
+  802129:	e8 80 f8 ff ff       	call   8019ae <fd_close>
+		return r;
+  80212e:	83 c4 10             	add    $0x10,%esp
+  802131:	eb e5                	jmp    802118 <open+0x6c>
+		return -E_BAD_PATH;
+  802133:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802138:	eb de                	jmp    802118 <open+0x6c>
+
+0080213a <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80213a:	55                   	push   %ebp
+  80213b:	89 e5                	mov    %esp,%ebp
+  80213d:	53                   	push   %ebx
+  80213e:	83 ec 10             	sub    $0x10,%esp
+  802141:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802144:	53                   	push   %ebx
+  802145:	e8 d0 e6 ff ff       	call   80081a <strlen>
+  80214a:	83 c4 10             	add    $0x10,%esp
+  80214d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802152:	7f 25                	jg     802179 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802154:	83 ec 08             	sub    $0x8,%esp
+  802157:	53                   	push   %ebx
+  802158:	68 00 f0 80 00       	push   $0x80f000
+  80215d:	e8 f3 e6 ff ff       	call   800855 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802162:	ba 00 00 00 00       	mov    $0x0,%edx
+  802167:	b8 07 00 00 00       	mov    $0x7,%eax
+  80216c:	e8 05 fd ff ff       	call   801e76 <fsipc>
+  802171:	83 c4 10             	add    $0x10,%esp
+}
+  802174:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802177:	c9                   	leave
+  802178:	c3                   	ret
+		return -E_BAD_PATH;
+  802179:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80217e:	eb f4                	jmp    802174 <remove+0x3a>
+
+00802180 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802180:	55                   	push   %ebp
+  802181:	89 e5                	mov    %esp,%ebp
+  802183:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802186:	ba 00 00 00 00       	mov    $0x0,%edx
+  80218b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802190:	e8 e1 fc ff ff       	call   801e76 <fsipc>
+}
+  802195:	c9                   	leave
+  802196:	c3                   	ret
+
+00802197 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  802197:	55                   	push   %ebp
+  802198:	89 e5                	mov    %esp,%ebp
+  80219a:	53                   	push   %ebx
+  80219b:	83 ec 04             	sub    $0x4,%esp
+  80219e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  8021a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8021ab:	e8 c6 fc ff ff       	call   801e76 <fsipc>
+  8021b0:	85 c0                	test   %eax,%eax
+  8021b2:	78 3c                	js     8021f0 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  8021b4:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  8021b9:	89 03                	mov    %eax,(%ebx)
+  8021bb:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  8021c0:	89 43 04             	mov    %eax,0x4(%ebx)
+  8021c3:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  8021c8:	89 43 08             	mov    %eax,0x8(%ebx)
+  8021cb:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  8021d0:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8021d3:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  8021d8:	89 43 10             	mov    %eax,0x10(%ebx)
+  8021db:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  8021e0:	89 43 14             	mov    %eax,0x14(%ebx)
+  8021e3:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  8021e8:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  8021eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021f3:	c9                   	leave
+  8021f4:	c3                   	ret
+
+008021f5 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  8021f5:	55                   	push   %ebp
+  8021f6:	89 e5                	mov    %esp,%ebp
+  8021f8:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  8021fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021fe:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  802203:	ba 00 00 00 00       	mov    $0x0,%edx
+  802208:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80220d:	e8 64 fc ff ff       	call   801e76 <fsipc>
+}
+  802212:	c9                   	leave
+  802213:	c3                   	ret
+
+00802214 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802214:	55                   	push   %ebp
+  802215:	89 e5                	mov    %esp,%ebp
+  802217:	56                   	push   %esi
+  802218:	53                   	push   %ebx
+  802219:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80221c:	83 ec 0c             	sub    $0xc,%esp
+  80221f:	ff 75 08             	push   0x8(%ebp)
+  802222:	e8 80 f6 ff ff       	call   8018a7 <fd2data>
+  802227:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802229:	83 c4 08             	add    $0x8,%esp
+  80222c:	68 52 59 80 00       	push   $0x805952
+  802231:	53                   	push   %ebx
+  802232:	e8 1e e6 ff ff       	call   800855 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802237:	8b 46 04             	mov    0x4(%esi),%eax
+  80223a:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  802240:	2b 0e                	sub    (%esi),%ecx
+  802242:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802247:	89 c8                	mov    %ecx,%eax
+  802249:	f7 e2                	mul    %edx
+  80224b:	c1 ea 0c             	shr    $0xc,%edx
+  80224e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802254:	29 d1                	sub    %edx,%ecx
+  802256:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  80225c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802263:	00 00 00 
+	stat->st_dev = &devpipe;
+  802266:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  80226d:	60 80 00 
+	return 0;
+}
+  802270:	b8 00 00 00 00       	mov    $0x0,%eax
+  802275:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802278:	5b                   	pop    %ebx
+  802279:	5e                   	pop    %esi
+  80227a:	5d                   	pop    %ebp
+  80227b:	c3                   	ret
+
+0080227c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80227c:	55                   	push   %ebp
+  80227d:	89 e5                	mov    %esp,%ebp
+  80227f:	53                   	push   %ebx
+  802280:	83 ec 0c             	sub    $0xc,%esp
+  802283:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802286:	53                   	push   %ebx
+  802287:	6a 00                	push   $0x0
+  802289:	e8 3f eb ff ff       	call   800dcd <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80228e:	89 1c 24             	mov    %ebx,(%esp)
+  802291:	e8 11 f6 ff ff       	call   8018a7 <fd2data>
+  802296:	83 c4 08             	add    $0x8,%esp
+  802299:	50                   	push   %eax
+  80229a:	6a 00                	push   $0x0
+  80229c:	e8 2c eb ff ff       	call   800dcd <sys_page_unmap>
+}
+  8022a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022a4:	c9                   	leave
+  8022a5:	c3                   	ret
+
+008022a6 <_pipeisclosed>:
+{
+  8022a6:	55                   	push   %ebp
+  8022a7:	89 e5                	mov    %esp,%ebp
+  8022a9:	57                   	push   %edi
+  8022aa:	56                   	push   %esi
+  8022ab:	53                   	push   %ebx
+  8022ac:	83 ec 1c             	sub    $0x1c,%esp
+  8022af:	89 c7                	mov    %eax,%edi
+  8022b1:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8022b3:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8022b8:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8022bb:	83 ec 0c             	sub    $0xc,%esp
+  8022be:	57                   	push   %edi
+  8022bf:	e8 72 2e 00 00       	call   805136 <pageref>
+  8022c4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8022c7:	89 34 24             	mov    %esi,(%esp)
+  8022ca:	e8 67 2e 00 00       	call   805136 <pageref>
+		nn = thisenv->env_runs;
+  8022cf:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  8022d5:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8022d8:	83 c4 10             	add    $0x10,%esp
+  8022db:	39 cb                	cmp    %ecx,%ebx
+  8022dd:	74 1b                	je     8022fa <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8022df:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8022e2:	75 cf                	jne    8022b3 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8022e4:	8b 42 58             	mov    0x58(%edx),%eax
+  8022e7:	6a 01                	push   $0x1
+  8022e9:	50                   	push   %eax
+  8022ea:	53                   	push   %ebx
+  8022eb:	68 59 59 80 00       	push   $0x805959
+  8022f0:	e8 79 df ff ff       	call   80026e <cprintf>
+  8022f5:	83 c4 10             	add    $0x10,%esp
+  8022f8:	eb b9                	jmp    8022b3 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8022fa:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8022fd:	0f 94 c0             	sete   %al
+  802300:	0f b6 c0             	movzbl %al,%eax
+}
+  802303:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802306:	5b                   	pop    %ebx
+  802307:	5e                   	pop    %esi
+  802308:	5f                   	pop    %edi
+  802309:	5d                   	pop    %ebp
+  80230a:	c3                   	ret
+
+0080230b <devpipe_read>:
+{
+  80230b:	55                   	push   %ebp
+  80230c:	89 e5                	mov    %esp,%ebp
+  80230e:	57                   	push   %edi
+  80230f:	56                   	push   %esi
+  802310:	53                   	push   %ebx
+  802311:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802314:	ff 75 08             	push   0x8(%ebp)
+  802317:	e8 8b f5 ff ff       	call   8018a7 <fd2data>
+  80231c:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  80231e:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  802321:	8d 40 04             	lea    0x4(%eax),%eax
+  802324:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802327:	8b 7b 04             	mov    0x4(%ebx),%edi
+  80232a:	8b 0b                	mov    (%ebx),%ecx
+  80232c:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  802332:	29 ce                	sub    %ecx,%esi
+  802334:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802339:	f7 e6                	mul    %esi
+  80233b:	c1 ea 0c             	shr    $0xc,%edx
+  80233e:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  802344:	29 c6                	sub    %eax,%esi
+  802346:	89 f2                	mov    %esi,%edx
+  802348:	75 43                	jne    80238d <devpipe_read+0x82>
+		ref = pageref(p);
+  80234a:	83 ec 0c             	sub    $0xc,%esp
+  80234d:	53                   	push   %ebx
+  80234e:	e8 e3 2d 00 00       	call   805136 <pageref>
+  802353:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  802355:	89 da                	mov    %ebx,%edx
+  802357:	8b 45 08             	mov    0x8(%ebp),%eax
+  80235a:	e8 47 ff ff ff       	call   8022a6 <_pipeisclosed>
+  80235f:	83 c4 10             	add    $0x10,%esp
+  802362:	85 c0                	test   %eax,%eax
+  802364:	0f 85 c1 00 00 00    	jne    80242b <devpipe_read+0x120>
+	*sleeping = 1;
+  80236a:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  802371:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802376:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  802379:	75 ac                	jne    802327 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  80237b:	83 ec 04             	sub    $0x4,%esp
+  80237e:	56                   	push   %esi
+  80237f:	57                   	push   %edi
+  802380:	ff 75 e4             	push   -0x1c(%ebp)
+  802383:	e8 99 ee ff ff       	call   801221 <sys_futex_wait>
+  802388:	83 c4 10             	add    $0x10,%esp
+  80238b:	eb 9a                	jmp    802327 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  80238d:	39 75 10             	cmp    %esi,0x10(%ebp)
+  802390:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  802394:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802396:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80239b:	f7 e1                	mul    %ecx
+  80239d:	c1 ea 0b             	shr    $0xb,%edx
+  8023a0:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8023a6:	29 c1                	sub    %eax,%ecx
+  8023a8:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  8023aa:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8023af:	29 cf                	sub    %ecx,%edi
+  8023b1:	39 f7                	cmp    %esi,%edi
+  8023b3:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  8023b6:	8d 43 10             	lea    0x10(%ebx),%eax
+  8023b9:	83 ec 04             	sub    $0x4,%esp
+  8023bc:	57                   	push   %edi
+  8023bd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8023c0:	01 c2                	add    %eax,%edx
+  8023c2:	52                   	push   %edx
+  8023c3:	ff 75 0c             	push   0xc(%ebp)
+  8023c6:	e8 10 e6 ff ff       	call   8009db <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  8023cb:	83 c4 0c             	add    $0xc,%esp
+  8023ce:	89 f1                	mov    %esi,%ecx
+  8023d0:	29 f9                	sub    %edi,%ecx
+  8023d2:	51                   	push   %ecx
+  8023d3:	ff 75 e4             	push   -0x1c(%ebp)
+  8023d6:	89 f8                	mov    %edi,%eax
+  8023d8:	03 45 0c             	add    0xc(%ebp),%eax
+  8023db:	50                   	push   %eax
+  8023dc:	e8 fa e5 ff ff       	call   8009db <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  8023e1:	89 f1                	mov    %esi,%ecx
+  8023e3:	03 0b                	add    (%ebx),%ecx
+  8023e5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8023ea:	f7 e1                	mul    %ecx
+  8023ec:	c1 ea 0c             	shr    $0xc,%edx
+  8023ef:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8023f5:	29 d1                	sub    %edx,%ecx
+  8023f7:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  8023f9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8023fe:	83 c4 10             	add    $0x10,%esp
+  802401:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  802405:	75 0a                	jne    802411 <devpipe_read+0x106>
+	return n;
+  802407:	89 f0                	mov    %esi,%eax
+}
+  802409:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80240c:	5b                   	pop    %ebx
+  80240d:	5e                   	pop    %esi
+  80240e:	5f                   	pop    %edi
+  80240f:	5d                   	pop    %ebp
+  802410:	c3                   	ret
+		*sleeping = 0;
+  802411:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  802418:	83 ec 08             	sub    $0x8,%esp
+  80241b:	68 00 04 00 00       	push   $0x400
+  802420:	53                   	push   %ebx
+  802421:	e8 4b ee ff ff       	call   801271 <sys_futex_wake>
+  802426:	83 c4 10             	add    $0x10,%esp
+  802429:	eb dc                	jmp    802407 <devpipe_read+0xfc>
+			return 0;
+  80242b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802430:	eb d7                	jmp    802409 <devpipe_read+0xfe>
+
+00802432 <devpipe_write>:
+{
+  802432:	55                   	push   %ebp
+  802433:	89 e5                	mov    %esp,%ebp
+  802435:	57                   	push   %edi
+  802436:	56                   	push   %esi
+  802437:	53                   	push   %ebx
+  802438:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80243b:	ff 75 08             	push   0x8(%ebp)
+  80243e:	e8 64 f4 ff ff       	call   8018a7 <fd2data>
+  802443:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  802445:	83 c4 10             	add    $0x10,%esp
+  802448:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80244f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802452:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802455:	0f 83 23 01 00 00    	jae    80257e <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80245b:	8b 77 04             	mov    0x4(%edi),%esi
+  80245e:	8b 1f                	mov    (%edi),%ebx
+  802460:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  802466:	29 d9                	sub    %ebx,%ecx
+  802468:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80246d:	f7 e1                	mul    %ecx
+  80246f:	c1 ea 0c             	shr    $0xc,%edx
+  802472:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802478:	29 c1                	sub    %eax,%ecx
+  80247a:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80247c:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802482:	75 40                	jne    8024c4 <devpipe_write+0x92>
+			ref = pageref(p);
+  802484:	83 ec 0c             	sub    $0xc,%esp
+  802487:	57                   	push   %edi
+  802488:	e8 a9 2c 00 00       	call   805136 <pageref>
+  80248d:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  80248f:	89 fa                	mov    %edi,%edx
+  802491:	8b 45 08             	mov    0x8(%ebp),%eax
+  802494:	e8 0d fe ff ff       	call   8022a6 <_pipeisclosed>
+  802499:	83 c4 10             	add    $0x10,%esp
+  80249c:	85 c0                	test   %eax,%eax
+  80249e:	0f 85 d5 00 00 00    	jne    802579 <devpipe_write+0x147>
+	*sleeping = 1;
+  8024a4:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  8024ab:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8024b0:	39 1f                	cmp    %ebx,(%edi)
+  8024b2:	75 a7                	jne    80245b <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  8024b4:	83 ec 04             	sub    $0x4,%esp
+  8024b7:	56                   	push   %esi
+  8024b8:	53                   	push   %ebx
+  8024b9:	57                   	push   %edi
+  8024ba:	e8 62 ed ff ff       	call   801221 <sys_futex_wait>
+  8024bf:	83 c4 10             	add    $0x10,%esp
+  8024c2:	eb 97                	jmp    80245b <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8024c4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8024c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024ca:	29 c1                	sub    %eax,%ecx
+  8024cc:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8024d1:	89 d8                	mov    %ebx,%eax
+  8024d3:	29 d0                	sub    %edx,%eax
+  8024d5:	39 c1                	cmp    %eax,%ecx
+  8024d7:	0f 46 c1             	cmovbe %ecx,%eax
+  8024da:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  8024dc:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8024e1:	f7 e6                	mul    %esi
+  8024e3:	c1 ea 0b             	shr    $0xb,%edx
+  8024e6:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8024ec:	29 c6                	sub    %eax,%esi
+  8024ee:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8024f0:	29 f3                	sub    %esi,%ebx
+  8024f2:	39 cb                	cmp    %ecx,%ebx
+  8024f4:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8024f7:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  8024fa:	8d 77 10             	lea    0x10(%edi),%esi
+  8024fd:	83 ec 04             	sub    $0x4,%esp
+  802500:	53                   	push   %ebx
+  802501:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802504:	03 45 0c             	add    0xc(%ebp),%eax
+  802507:	50                   	push   %eax
+  802508:	01 f2                	add    %esi,%edx
+  80250a:	52                   	push   %edx
+  80250b:	e8 cb e4 ff ff       	call   8009db <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802510:	83 c4 0c             	add    $0xc,%esp
+  802513:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802516:	29 d8                	sub    %ebx,%eax
+  802518:	50                   	push   %eax
+  802519:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80251c:	01 d3                	add    %edx,%ebx
+  80251e:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802521:	53                   	push   %ebx
+  802522:	56                   	push   %esi
+  802523:	e8 b3 e4 ff ff       	call   8009db <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802528:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80252b:	03 4f 04             	add    0x4(%edi),%ecx
+  80252e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802533:	f7 e1                	mul    %ecx
+  802535:	c1 ea 0c             	shr    $0xc,%edx
+  802538:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80253e:	29 d1                	sub    %edx,%ecx
+  802540:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  802543:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802548:	83 c4 10             	add    $0x10,%esp
+  80254b:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  80254f:	75 0b                	jne    80255c <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802551:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  802554:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802557:	e9 f3 fe ff ff       	jmp    80244f <devpipe_write+0x1d>
+		*sleeping = 0;
+  80255c:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  802563:	83 ec 08             	sub    $0x8,%esp
+  802566:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  80256b:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  80256e:	50                   	push   %eax
+  80256f:	e8 fd ec ff ff       	call   801271 <sys_futex_wake>
+  802574:	83 c4 10             	add    $0x10,%esp
+  802577:	eb d8                	jmp    802551 <devpipe_write+0x11f>
+				return 0;
+  802579:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80257e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802581:	5b                   	pop    %ebx
+  802582:	5e                   	pop    %esi
+  802583:	5f                   	pop    %edi
+  802584:	5d                   	pop    %ebp
+  802585:	c3                   	ret
+
+00802586 <pipe>:
+{
+  802586:	55                   	push   %ebp
+  802587:	89 e5                	mov    %esp,%ebp
+  802589:	56                   	push   %esi
+  80258a:	53                   	push   %ebx
+  80258b:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80258e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802591:	50                   	push   %eax
+  802592:	e8 27 f3 ff ff       	call   8018be <fd_alloc>
+  802597:	89 c3                	mov    %eax,%ebx
+  802599:	83 c4 10             	add    $0x10,%esp
+  80259c:	85 c0                	test   %eax,%eax
+  80259e:	0f 88 23 01 00 00    	js     8026c7 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025a4:	83 ec 04             	sub    $0x4,%esp
+  8025a7:	68 07 04 00 00       	push   $0x407
+  8025ac:	ff 75 f4             	push   -0xc(%ebp)
+  8025af:	6a 00                	push   $0x0
+  8025b1:	e8 92 e7 ff ff       	call   800d48 <sys_page_alloc>
+  8025b6:	89 c3                	mov    %eax,%ebx
+  8025b8:	83 c4 10             	add    $0x10,%esp
+  8025bb:	85 c0                	test   %eax,%eax
+  8025bd:	0f 88 04 01 00 00    	js     8026c7 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8025c3:	83 ec 0c             	sub    $0xc,%esp
+  8025c6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025c9:	50                   	push   %eax
+  8025ca:	e8 ef f2 ff ff       	call   8018be <fd_alloc>
+  8025cf:	89 c3                	mov    %eax,%ebx
+  8025d1:	83 c4 10             	add    $0x10,%esp
+  8025d4:	85 c0                	test   %eax,%eax
+  8025d6:	0f 88 db 00 00 00    	js     8026b7 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025dc:	83 ec 04             	sub    $0x4,%esp
+  8025df:	68 07 04 00 00       	push   $0x407
+  8025e4:	ff 75 f0             	push   -0x10(%ebp)
+  8025e7:	6a 00                	push   $0x0
+  8025e9:	e8 5a e7 ff ff       	call   800d48 <sys_page_alloc>
+  8025ee:	89 c3                	mov    %eax,%ebx
+  8025f0:	83 c4 10             	add    $0x10,%esp
+  8025f3:	85 c0                	test   %eax,%eax
+  8025f5:	0f 88 bc 00 00 00    	js     8026b7 <pipe+0x131>
+	va = fd2data(fd0);
+  8025fb:	83 ec 0c             	sub    $0xc,%esp
+  8025fe:	ff 75 f4             	push   -0xc(%ebp)
+  802601:	e8 a1 f2 ff ff       	call   8018a7 <fd2data>
+  802606:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802608:	83 c4 0c             	add    $0xc,%esp
+  80260b:	68 07 04 00 00       	push   $0x407
+  802610:	50                   	push   %eax
+  802611:	6a 00                	push   $0x0
+  802613:	e8 30 e7 ff ff       	call   800d48 <sys_page_alloc>
+  802618:	89 c3                	mov    %eax,%ebx
+  80261a:	83 c4 10             	add    $0x10,%esp
+  80261d:	85 c0                	test   %eax,%eax
+  80261f:	0f 88 82 00 00 00    	js     8026a7 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802625:	83 ec 0c             	sub    $0xc,%esp
+  802628:	ff 75 f0             	push   -0x10(%ebp)
+  80262b:	e8 77 f2 ff ff       	call   8018a7 <fd2data>
+  802630:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802637:	50                   	push   %eax
+  802638:	6a 00                	push   $0x0
+  80263a:	56                   	push   %esi
+  80263b:	6a 00                	push   $0x0
+  80263d:	e8 49 e7 ff ff       	call   800d8b <sys_page_map>
+  802642:	89 c3                	mov    %eax,%ebx
+  802644:	83 c4 20             	add    $0x20,%esp
+  802647:	85 c0                	test   %eax,%eax
+  802649:	78 4e                	js     802699 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80264b:	a1 20 60 80 00       	mov    0x806020,%eax
+  802650:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802653:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802655:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802658:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80265f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802662:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802664:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802667:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80266e:	83 ec 0c             	sub    $0xc,%esp
+  802671:	ff 75 f4             	push   -0xc(%ebp)
+  802674:	e8 1e f2 ff ff       	call   801897 <fd2num>
+  802679:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80267c:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80267e:	83 c4 04             	add    $0x4,%esp
+  802681:	ff 75 f0             	push   -0x10(%ebp)
+  802684:	e8 0e f2 ff ff       	call   801897 <fd2num>
+  802689:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80268c:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80268f:	83 c4 10             	add    $0x10,%esp
+  802692:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802697:	eb 2e                	jmp    8026c7 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802699:	83 ec 08             	sub    $0x8,%esp
+  80269c:	56                   	push   %esi
+  80269d:	6a 00                	push   $0x0
+  80269f:	e8 29 e7 ff ff       	call   800dcd <sys_page_unmap>
+  8026a4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8026a7:	83 ec 08             	sub    $0x8,%esp
+  8026aa:	ff 75 f0             	push   -0x10(%ebp)
+  8026ad:	6a 00                	push   $0x0
+  8026af:	e8 19 e7 ff ff       	call   800dcd <sys_page_unmap>
+  8026b4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8026b7:	83 ec 08             	sub    $0x8,%esp
+  8026ba:	ff 75 f4             	push   -0xc(%ebp)
+  8026bd:	6a 00                	push   $0x0
+  8026bf:	e8 09 e7 ff ff       	call   800dcd <sys_page_unmap>
+  8026c4:	83 c4 10             	add    $0x10,%esp
+}
+  8026c7:	89 d8                	mov    %ebx,%eax
+  8026c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026cc:	5b                   	pop    %ebx
+  8026cd:	5e                   	pop    %esi
+  8026ce:	5d                   	pop    %ebp
+  8026cf:	c3                   	ret
+
+008026d0 <pipeisclosed>:
+{
+  8026d0:	55                   	push   %ebp
+  8026d1:	89 e5                	mov    %esp,%ebp
+  8026d3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026d9:	50                   	push   %eax
+  8026da:	ff 75 08             	push   0x8(%ebp)
+  8026dd:	e8 30 f2 ff ff       	call   801912 <fd_lookup>
+  8026e2:	83 c4 10             	add    $0x10,%esp
+  8026e5:	85 c0                	test   %eax,%eax
+  8026e7:	78 18                	js     802701 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8026e9:	83 ec 0c             	sub    $0xc,%esp
+  8026ec:	ff 75 f4             	push   -0xc(%ebp)
+  8026ef:	e8 b3 f1 ff ff       	call   8018a7 <fd2data>
+  8026f4:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8026f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026f9:	e8 a8 fb ff ff       	call   8022a6 <_pipeisclosed>
+  8026fe:	83 c4 10             	add    $0x10,%esp
+}
+  802701:	c9                   	leave
+  802702:	c3                   	ret
+
+00802703 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  802703:	55                   	push   %ebp
+  802704:	89 e5                	mov    %esp,%ebp
+  802706:	57                   	push   %edi
+  802707:	56                   	push   %esi
+  802708:	53                   	push   %ebx
+  802709:	83 ec 0c             	sub    $0xc,%esp
+  80270c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	const volatile struct Env *e;
+	unsigned status;
+
+	assert(envid != 0);
+  80270f:	85 ff                	test   %edi,%edi
+  802711:	74 21                	je     802734 <wait+0x31>
+	e = &envs[ENVX(envid)];
+  802713:	89 f8                	mov    %edi,%eax
+  802715:	25 ff 03 00 00       	and    $0x3ff,%eax
+	// The kernel wakes us when it frees the environment.  Until then
+	// we sleep, unless its status changed since we looked.
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  80271a:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  80271d:	c1 e6 06             	shl    $0x6,%esi
+  802720:	81 c6 54 00 c0 ee    	add    $0xeec00054,%esi
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  802726:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  802729:	c1 e3 06             	shl    $0x6,%ebx
+  80272c:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  802732:	eb 25                	jmp    802759 <wait+0x56>
+	assert(envid != 0);
+  802734:	68 71 59 80 00       	push   $0x805971
+  802739:	68 c3 53 80 00       	push   $0x8053c3
+  80273e:	6a 0a                	push   $0xa
+  802740:	68 7c 59 80 00       	push   $0x80597c
+  802745:	e8 49 da ff ff       	call   800193 <_panic>
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  80274a:	83 ec 04             	sub    $0x4,%esp
+  80274d:	6a ff                	push   $0xffffffff
+  80274f:	50                   	push   %eax
+  802750:	56                   	push   %esi
+  802751:	e8 cb ea ff ff       	call   801221 <sys_futex_wait>
+  802756:	83 c4 10             	add    $0x10,%esp
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  802759:	8b 43 48             	mov    0x48(%ebx),%eax
+  80275c:	39 f8                	cmp    %edi,%eax
+  80275e:	75 07                	jne    802767 <wait+0x64>
+  802760:	8b 43 54             	mov    0x54(%ebx),%eax
+  802763:	85 c0                	test   %eax,%eax
+  802765:	75 e3                	jne    80274a <wait+0x47>
+}
+  802767:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80276a:	5b                   	pop    %ebx
+  80276b:	5e                   	pop    %esi
+  80276c:	5f                   	pop    %edi
+  80276d:	5d                   	pop    %ebp
+  80276e:	c3                   	ret
+
+0080276f <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  80276f:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802771:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  802777:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  80277d:	81 c2 34 01 00 00    	add    $0x134,%edx
+  802783:	39 d0                	cmp    %edx,%eax
+  802785:	74 2e                	je     8027b5 <segment_lookup+0x46>
+{
+  802787:	55                   	push   %ebp
+  802788:	89 e5                	mov    %esp,%ebp
+  80278a:	57                   	push   %edi
+  80278b:	56                   	push   %esi
+  80278c:	53                   	push   %ebx
+  80278d:	eb 07                	jmp    802796 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  80278f:	83 c0 20             	add    $0x20,%eax
+  802792:	39 d0                	cmp    %edx,%eax
+  802794:	74 15                	je     8027ab <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802796:	8b 18                	mov    (%eax),%ebx
+  802798:	39 d9                	cmp    %ebx,%ecx
+  80279a:	72 f3                	jb     80278f <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  80279c:	8b 38                	mov    (%eax),%edi
+  80279e:	8b 58 04             	mov    0x4(%eax),%ebx
+  8027a1:	89 ce                	mov    %ecx,%esi
+  8027a3:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  8027a5:	39 de                	cmp    %ebx,%esi
+  8027a7:	73 e6                	jae    80278f <segment_lookup+0x20>
+  8027a9:	eb 05                	jmp    8027b0 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  8027ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027b0:	5b                   	pop    %ebx
+  8027b1:	5e                   	pop    %esi
+  8027b2:	5f                   	pop    %edi
+  8027b3:	5d                   	pop    %ebp
+  8027b4:	c3                   	ret
+	return NULL;
+  8027b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027ba:	c3                   	ret
+
+008027bb <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  8027bb:	55                   	push   %ebp
+  8027bc:	89 e5                	mov    %esp,%ebp
+  8027be:	53                   	push   %ebx
+  8027bf:	83 ec 04             	sub    $0x4,%esp
+  8027c2:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8027c4:	c1 e8 16             	shr    $0x16,%eax
+  8027c7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8027ce:	25 81 00 00 00       	and    $0x81,%eax
+  8027d3:	83 f8 01             	cmp    $0x1,%eax
+  8027d6:	75 6b                	jne    802843 <page_is_clean+0x88>
+  8027d8:	89 da                	mov    %ebx,%edx
+  8027da:	c1 ea 0c             	shr    $0xc,%edx
+  8027dd:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  8027e4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8027e9:	f6 c1 01             	test   $0x1,%cl
+  8027ec:	74 5a                	je     802848 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  8027ee:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8027f5:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  8027fb:	75 4b                	jne    802848 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  8027fd:	89 d8                	mov    %ebx,%eax
+  8027ff:	e8 6b ff ff ff       	call   80276f <segment_lookup>
+  802804:	89 c2                	mov    %eax,%edx
+		return 1;
+  802806:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  80280b:	85 d2                	test   %edx,%edx
+  80280d:	75 39                	jne    802848 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  80280f:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  802815:	b8 00 00 00 00       	mov    $0x0,%eax
+  80281a:	eb 03                	jmp    80281f <page_is_clean+0x64>
+  80281c:	83 c0 01             	add    $0x1,%eax
+  80281f:	39 c2                	cmp    %eax,%edx
+  802821:	7e 19                	jle    80283c <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  802823:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  80282a:	72 f0                	jb     80281c <page_is_clean+0x61>
+  80282c:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  802833:	73 e7                	jae    80281c <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  802835:	b8 01 00 00 00       	mov    $0x1,%eax
+  80283a:	eb 0c                	jmp    802848 <page_is_clean+0x8d>
+	return 0;
+  80283c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802841:	eb 05                	jmp    802848 <page_is_clean+0x8d>
+		return 0;
+  802843:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802848:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80284b:	c9                   	leave
+  80284c:	c3                   	ret
+
+0080284d <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  80284d:	55                   	push   %ebp
+  80284e:	89 e5                	mov    %esp,%ebp
+  802850:	57                   	push   %edi
+  802851:	56                   	push   %esi
+  802852:	53                   	push   %ebx
+  802853:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802856:	be 00 00 00 00       	mov    $0x0,%esi
+  80285b:	eb 19                	jmp    802876 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80285d:	f7 d3                	not    %ebx
+  80285f:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802865:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802867:	83 c6 01             	add    $0x1,%esi
+  80286a:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802870:	0f 87 97 00 00 00    	ja     80290d <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802876:	89 f3                	mov    %esi,%ebx
+  802878:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  80287e:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802884:	89 d8                	mov    %ebx,%eax
+  802886:	c1 e8 0a             	shr    $0xa,%eax
+  802889:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802890:	25 81 00 00 00       	and    $0x81,%eax
+  802895:	83 f8 01             	cmp    $0x1,%eax
+  802898:	75 c3                	jne    80285d <linear_walk+0x10>
+  80289a:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8028a0:	77 bb                	ja     80285d <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8028a2:	89 df                	mov    %ebx,%edi
+  8028a4:	c1 e7 0c             	shl    $0xc,%edi
+  8028a7:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8028aa:	89 f8                	mov    %edi,%eax
+  8028ac:	e8 0a ff ff ff       	call   8027bb <page_is_clean>
+  8028b1:	84 c0                	test   %al,%al
+  8028b3:	75 64                	jne    802919 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8028b5:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  8028bb:	77 aa                	ja     802867 <linear_walk+0x1a>
+  8028bd:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  8028c3:	72 a2                	jb     802867 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8028c5:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8028cc:	a8 01                	test   $0x1,%al
+  8028ce:	74 97                	je     802867 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8028d0:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8028d7:	f6 c4 04             	test   $0x4,%ah
+  8028da:	75 8b                	jne    802867 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8028dc:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8028e3:	f6 c4 02             	test   $0x2,%ah
+  8028e6:	0f 85 7b ff ff ff    	jne    802867 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8028ec:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8028f3:	c1 e8 0c             	shr    $0xc,%eax
+  8028f6:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8028f9:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8028fe:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802902:	66 83 f8 01          	cmp    $0x1,%ax
+  802906:	76 11                	jbe    802919 <linear_walk+0xcc>
+  802908:	e9 5a ff ff ff       	jmp    802867 <linear_walk+0x1a>
+  80290d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  802912:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802919:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  80291f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802922:	83 c4 1c             	add    $0x1c,%esp
+  802925:	5b                   	pop    %ebx
+  802926:	5e                   	pop    %esi
+  802927:	5f                   	pop    %edi
+  802928:	5d                   	pop    %ebp
+  802929:	c3                   	ret
+
+0080292a <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  80292a:	55                   	push   %ebp
+  80292b:	89 e5                	mov    %esp,%ebp
+  80292d:	56                   	push   %esi
+  80292e:	53                   	push   %ebx
+  80292f:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  802931:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802936:	83 e0 7f             	and    $0x7f,%eax
+  802939:	c1 e0 04             	shl    $0x4,%eax
+  80293c:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  802942:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802948:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  80294e:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  802954:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802959:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  80295c:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802961:	83 c0 01             	add    $0x1,%eax
+  802964:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  802969:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  80296c:	5b                   	pop    %ebx
+  80296d:	5e                   	pop    %esi
+  80296e:	5d                   	pop    %ebp
+  80296f:	c3                   	ret
+
+00802970 <page_ring_enter>:
+{
+  802970:	55                   	push   %ebp
+  802971:	89 e5                	mov    %esp,%ebp
+  802973:	57                   	push   %edi
+  802974:	56                   	push   %esi
+  802975:	53                   	push   %ebx
+  802976:	83 ec 18             	sub    $0x18,%esp
+  802979:	89 c6                	mov    %eax,%esi
+  80297b:	89 d7                	mov    %edx,%edi
+  80297d:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  80297f:	6a 00                	push   $0x0
+  802981:	6a 00                	push   $0x0
+  802983:	6a 00                	push   $0x0
+  802985:	6a 07                	push   $0x7
+  802987:	ff 35 40 b0 80 00    	push   0x80b040
+  80298d:	e8 8e 26 00 00       	call   805020 <ipc_call>
+  802992:	83 c4 20             	add    $0x20,%esp
+  802995:	85 c0                	test   %eax,%eax
+  802997:	79 22                	jns    8029bb <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802999:	50                   	push   %eax
+  80299a:	68 87 59 80 00       	push   $0x805987
+  80299f:	68 13 02 00 00       	push   $0x213
+  8029a4:	68 9b 59 80 00       	push   $0x80599b
+  8029a9:	e8 e5 d7 ff ff       	call   800193 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  8029ae:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8029b3:	83 c0 01             	add    $0x1,%eax
+  8029b6:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  8029bb:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  8029c1:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  8029c6:	39 c2                	cmp    %eax,%edx
+  8029c8:	74 24                	je     8029ee <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  8029ca:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8029cf:	83 e0 7f             	and    $0x7f,%eax
+  8029d2:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  8029d9:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  8029e0:	29 f0                	sub    %esi,%eax
+  8029e2:	39 d8                	cmp    %ebx,%eax
+  8029e4:	73 c8                	jae    8029ae <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  8029e6:	8b 52 04             	mov    0x4(%edx),%edx
+  8029e9:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  8029ec:	eb c0                	jmp    8029ae <page_ring_enter+0x3e>
+}
+  8029ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029f1:	5b                   	pop    %ebx
+  8029f2:	5e                   	pop    %esi
+  8029f3:	5f                   	pop    %edi
+  8029f4:	5d                   	pop    %ebp
+  8029f5:	c3                   	ret
+
+008029f6 <page_ring_reserve>:
+{
+  8029f6:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  8029f8:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8029fd:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802a03:	29 d0                	sub    %edx,%eax
+  802a05:	ba 80 00 00 00       	mov    $0x80,%edx
+  802a0a:	29 ca                	sub    %ecx,%edx
+  802a0c:	39 c2                	cmp    %eax,%edx
+  802a0e:	72 01                	jb     802a11 <page_ring_reserve+0x1b>
+  802a10:	c3                   	ret
+{
+  802a11:	55                   	push   %ebp
+  802a12:	89 e5                	mov    %esp,%ebp
+  802a14:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802a17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a26:	e8 45 ff ff ff       	call   802970 <page_ring_enter>
+}
+  802a2b:	c9                   	leave
+  802a2c:	c3                   	ret
+
+00802a2d <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802a2d:	55                   	push   %ebp
+  802a2e:	89 e5                	mov    %esp,%ebp
+  802a30:	53                   	push   %ebx
+  802a31:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802a34:	6a 07                	push   $0x7
+  802a36:	6a 01                	push   $0x1
+  802a38:	89 c3                	mov    %eax,%ebx
+  802a3a:	c1 e3 0c             	shl    $0xc,%ebx
+  802a3d:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  802a43:	52                   	push   %edx
+  802a44:	6a 04                	push   $0x4
+  802a46:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  802a4d:	e8 ce 25 00 00       	call   805020 <ipc_call>
+	sharereqs[i].nslots = 0;
+  802a52:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  802a59:	00 00 00 
+	return r;
+}
+  802a5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a5f:	c9                   	leave
+  802a60:	c3                   	ret
+
+00802a61 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802a61:	55                   	push   %ebp
+  802a62:	89 e5                	mov    %esp,%ebp
+  802a64:	56                   	push   %esi
+  802a65:	53                   	push   %ebx
+  802a66:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802a68:	c1 e8 10             	shr    $0x10,%eax
+  802a6b:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802a6e:	89 c2                	mov    %eax,%edx
+  802a70:	c1 e2 0c             	shl    $0xc,%edx
+  802a73:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  802a79:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802a7c:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  802a82:	89 c2                	mov    %eax,%edx
+  802a84:	c1 e2 0a             	shl    $0xa,%edx
+  802a87:	01 f2                	add    %esi,%edx
+  802a89:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802a90:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802a96:	74 09                	je     802aa1 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802a98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a9d:	5b                   	pop    %ebx
+  802a9e:	5e                   	pop    %esi
+  802a9f:	5d                   	pop    %ebp
+  802aa0:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802aa1:	e8 87 ff ff ff       	call   802a2d <page_share_send>
+  802aa6:	eb f5                	jmp    802a9d <page_share_slot+0x3c>
+
+00802aa8 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802aa8:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802aad:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802ab0:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802ab5:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  802abb:	74 09                	je     802ac6 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802abd:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802ac2:	85 c0                	test   %eax,%eax
+  802ac4:	75 01                	jne    802ac7 <page_ring_ready+0x1f>
+}
+  802ac6:	c3                   	ret
+{
+  802ac7:	55                   	push   %ebp
+  802ac8:	89 e5                	mov    %esp,%ebp
+  802aca:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802acd:	68 07 06 00 00       	push   $0x607
+  802ad2:	6a 08                	push   $0x8
+  802ad4:	68 00 30 ad de       	push   $0xdead3000
+  802ad9:	6a 00                	push   $0x0
+  802adb:	e8 93 e3 ff ff       	call   800e73 <sys_page_alloc_range>
+  802ae0:	83 c4 10             	add    $0x10,%esp
+  802ae3:	83 f8 08             	cmp    $0x8,%eax
+  802ae6:	74 1b                	je     802b03 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802ae8:	83 ec 04             	sub    $0x4,%esp
+  802aeb:	6a 08                	push   $0x8
+  802aed:	68 00 30 ad de       	push   $0xdead3000
+  802af2:	6a 00                	push   $0x0
+  802af4:	e8 e8 e3 ff ff       	call   800ee1 <sys_page_unmap_range>
+		return 0;
+  802af9:	83 c4 10             	add    $0x10,%esp
+  802afc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b01:	c9                   	leave
+  802b02:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802b03:	83 ec 0c             	sub    $0xc,%esp
+  802b06:	68 07 04 00 00       	push   $0x407
+  802b0b:	6a 08                	push   $0x8
+  802b0d:	68 00 30 ad de       	push   $0xdead3000
+  802b12:	6a 06                	push   $0x6
+  802b14:	ff 35 40 b0 80 00    	push   0x80b040
+  802b1a:	e8 01 25 00 00       	call   805020 <ipc_call>
+  802b1f:	83 c4 20             	add    $0x20,%esp
+  802b22:	85 c0                	test   %eax,%eax
+  802b24:	78 14                	js     802b3a <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802b26:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802b2b:	8b 40 48             	mov    0x48(%eax),%eax
+  802b2e:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  802b33:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b38:	eb c7                	jmp    802b01 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802b3a:	83 ec 04             	sub    $0x4,%esp
+  802b3d:	6a 08                	push   $0x8
+  802b3f:	68 00 30 ad de       	push   $0xdead3000
+  802b44:	6a 00                	push   $0x0
+  802b46:	e8 96 e3 ff ff       	call   800ee1 <sys_page_unmap_range>
+		return 0;
+  802b4b:	83 c4 10             	add    $0x10,%esp
+  802b4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b53:	eb ac                	jmp    802b01 <page_ring_ready+0x59>
+
+00802b55 <page_remove_slot>:
+{
+  802b55:	55                   	push   %ebp
+  802b56:	89 e5                	mov    %esp,%ebp
+  802b58:	56                   	push   %esi
+  802b59:	53                   	push   %ebx
+  802b5a:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802b5c:	89 c6                	mov    %eax,%esi
+  802b5e:	c1 ee 10             	shr    $0x10,%esi
+  802b61:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802b64:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  802b6b:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  802b71:	74 2a                	je     802b9d <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802b73:	83 ec 0c             	sub    $0xc,%esp
+  802b76:	6a 00                	push   $0x0
+  802b78:	6a 00                	push   $0x0
+  802b7a:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802b7c:	c1 e3 04             	shl    $0x4,%ebx
+  802b7f:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802b82:	53                   	push   %ebx
+  802b83:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  802b8a:	e8 91 24 00 00       	call   805020 <ipc_call>
+  802b8f:	83 c4 20             	add    $0x20,%esp
+  802b92:	85 c0                	test   %eax,%eax
+  802b94:	78 2d                	js     802bc3 <page_remove_slot+0x6e>
+}
+  802b96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b99:	5b                   	pop    %ebx
+  802b9a:	5e                   	pop    %esi
+  802b9b:	5d                   	pop    %ebp
+  802b9c:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802b9d:	e8 06 ff ff ff       	call   802aa8 <page_ring_ready>
+  802ba2:	85 c0                	test   %eax,%eax
+  802ba4:	74 cd                	je     802b73 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802ba6:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bab:	e8 46 fe ff ff       	call   8029f6 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802bb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bb5:	89 da                	mov    %ebx,%edx
+  802bb7:	b8 02 00 00 00       	mov    $0x2,%eax
+  802bbc:	e8 69 fd ff ff       	call   80292a <page_ring_post>
+		return;
+  802bc1:	eb d3                	jmp    802b96 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802bc3:	50                   	push   %eax
+  802bc4:	68 f4 59 80 00       	push   $0x8059f4
+  802bc9:	68 ac 03 00 00       	push   $0x3ac
+  802bce:	68 9b 59 80 00       	push   $0x80599b
+  802bd3:	e8 bb d5 ff ff       	call   800193 <_panic>
+
+00802bd8 <find_paging_env>:
+	if(pagingenv)
+  802bd8:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802bdd:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802bdf:	85 c0                	test   %eax,%eax
+  802be1:	74 05                	je     802be8 <find_paging_env+0x10>
+  802be3:	eb 56                	jmp    802c3b <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802be5:	83 c0 01             	add    $0x1,%eax
+  802be8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802bed:	7f 47                	jg     802c36 <find_paging_env+0x5e>
+  802bef:	83 f9 01             	cmp    $0x1,%ecx
+  802bf2:	7f 42                	jg     802c36 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802bf4:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802bf7:	c1 e2 06             	shl    $0x6,%edx
+  802bfa:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802c00:	8b 52 50             	mov    0x50(%edx),%edx
+  802c03:	83 fa 02             	cmp    $0x2,%edx
+  802c06:	75 dd                	jne    802be5 <find_paging_env+0xd>
+  802c08:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802c0b:	c1 e2 06             	shl    $0x6,%edx
+  802c0e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802c14:	8b 52 54             	mov    0x54(%edx),%edx
+  802c17:	85 d2                	test   %edx,%edx
+  802c19:	74 ca                	je     802be5 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802c1b:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802c1e:	c1 e2 06             	shl    $0x6,%edx
+  802c21:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802c27:	8b 52 48             	mov    0x48(%edx),%edx
+  802c2a:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  802c31:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802c34:	eb af                	jmp    802be5 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802c36:	83 f9 02             	cmp    $0x2,%ecx
+  802c39:	74 01                	je     802c3c <find_paging_env+0x64>
+}
+  802c3b:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802c3c:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802c41:	8b 40 48             	mov    0x48(%eax),%eax
+  802c44:	83 e0 01             	and    $0x1,%eax
+  802c47:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  802c4e:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  802c53:	eb e6                	jmp    802c3b <find_paging_env+0x63>
+
+00802c55 <page_add_backed>:
+{
+  802c55:	55                   	push   %ebp
+  802c56:	89 e5                	mov    %esp,%ebp
+  802c58:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802c5b:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  802c60:	83 f8 04             	cmp    $0x4,%eax
+  802c63:	74 35                	je     802c9a <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802c65:	89 d1                	mov    %edx,%ecx
+  802c67:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802c6d:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802c74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c77:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802c7e:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802c84:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  802c8b:	83 c0 01             	add    $0x1,%eax
+  802c8e:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  802c93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c98:	5d                   	pop    %ebp
+  802c99:	c3                   	ret
+		return -E_NO_MEM;
+  802c9a:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802c9f:	eb f7                	jmp    802c98 <page_add_backed+0x43>
+
+00802ca1 <percentage_of_pgdir_to_walk>:
+{
+  802ca1:	55                   	push   %ebp
+  802ca2:	89 e5                	mov    %esp,%ebp
+  802ca4:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802ca7:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802cab:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802cae:	db 45 fc             	fildl  -0x4(%ebp)
+  802cb1:	d8 35 80 5e 80 00    	fdivs  0x805e80
+	return ret*ret;
+  802cb7:	d8 c8                	fmul   %st(0),%st
+}
+  802cb9:	c9                   	leave
+  802cba:	c3                   	ret
+
+00802cbb <nfu_with_aging_page_choice_func>:
+{
+  802cbb:	55                   	push   %ebp
+  802cbc:	89 e5                	mov    %esp,%ebp
+  802cbe:	57                   	push   %edi
+  802cbf:	56                   	push   %esi
+  802cc0:	53                   	push   %ebx
+  802cc1:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802cc4:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  802cca:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802ccc:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802cd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cd6:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802cdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ce2:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802ce5:	eb 18                	jmp    802cff <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802ce7:	f7 d0                	not    %eax
+  802ce9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802cee:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802cf0:	83 c2 01             	add    $0x1,%edx
+  802cf3:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802cf9:	0f 87 13 01 00 00    	ja     802e12 <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802cff:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d03:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802d06:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802d0b:	89 c1                	mov    %eax,%ecx
+  802d0d:	c1 e9 0a             	shr    $0xa,%ecx
+  802d10:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802d17:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802d1d:	83 f9 01             	cmp    $0x1,%ecx
+  802d20:	75 c5                	jne    802ce7 <nfu_with_aging_page_choice_func+0x2c>
+  802d22:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802d27:	77 be                	ja     802ce7 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802d29:	89 c1                	mov    %eax,%ecx
+  802d2b:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802d2e:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802d34:	0f 82 a5 00 00 00    	jb     802ddf <nfu_with_aging_page_choice_func+0x124>
+  802d3a:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802d40:	0f 87 99 00 00 00    	ja     802ddf <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802d46:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802d4d:	f6 c1 01             	test   $0x1,%cl
+  802d50:	0f 84 89 00 00 00    	je     802ddf <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802d56:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802d5d:	f6 c5 04             	test   $0x4,%ch
+  802d60:	75 7d                	jne    802ddf <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802d62:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802d69:	f6 c5 02             	test   $0x2,%ch
+  802d6c:	75 71                	jne    802ddf <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802d6e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d75:	c1 e9 0c             	shr    $0xc,%ecx
+  802d78:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d7b:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d81:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802d85:	66 83 f9 01          	cmp    $0x1,%cx
+  802d89:	77 54                	ja     802ddf <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802d8b:	89 f9                	mov    %edi,%ecx
+  802d8d:	80 f9 ff             	cmp    $0xff,%cl
+  802d90:	74 21                	je     802db3 <nfu_with_aging_page_choice_func+0xf8>
+  802d92:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d99:	c1 e9 0c             	shr    $0xc,%ecx
+  802d9c:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d9f:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802da5:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802da9:	89 fb                	mov    %edi,%ebx
+  802dab:	38 d9                	cmp    %bl,%cl
+  802dad:	73 30                	jae    802ddf <nfu_with_aging_page_choice_func+0x124>
+  802daf:	dd d8                	fstp   %st(0)
+  802db1:	eb 02                	jmp    802db5 <nfu_with_aging_page_choice_func+0xfa>
+  802db3:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802db5:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802dbc:	c1 e9 0c             	shr    $0xc,%ecx
+  802dbf:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802dc2:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802dc9:	89 fb                	mov    %edi,%ebx
+  802dcb:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802dce:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802dd1:	db 45 e0             	fildl  -0x20(%ebp)
+  802dd4:	d8 35 80 5e 80 00    	fdivs  0x805e80
+	return ret*ret;
+  802dda:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802ddc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802ddf:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802de2:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802de5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802dec:	df 6d e0             	fildll -0x20(%ebp)
+  802def:	d9 c1                	fld    %st(1)
+  802df1:	d8 0d 84 5e 80 00    	fmuls  0x805e84
+  802df7:	d9 c9                	fxch   %st(1)
+  802df9:	df f1                	fcomip %st(1),%st
+  802dfb:	dd d8                	fstp   %st(0)
+  802dfd:	0f 82 ed fe ff ff    	jb     802cf0 <nfu_with_aging_page_choice_func+0x35>
+  802e03:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802e05:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  802e0a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802e0d:	c1 e0 0c             	shl    $0xc,%eax
+  802e10:	eb 0e                	jmp    802e20 <nfu_with_aging_page_choice_func+0x165>
+  802e12:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802e14:	89 f8                	mov    %edi,%eax
+  802e16:	3c ff                	cmp    $0xff,%al
+  802e18:	74 0e                	je     802e28 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802e1a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802e1d:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802e20:	83 c4 14             	add    $0x14,%esp
+  802e23:	5b                   	pop    %ebx
+  802e24:	5e                   	pop    %esi
+  802e25:	5f                   	pop    %edi
+  802e26:	5d                   	pop    %ebp
+  802e27:	c3                   	ret
+	pgnum = 0;
+  802e28:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  802e2f:	00 00 00 
+	return (void*)UTOP;
+  802e32:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802e37:	eb e7                	jmp    802e20 <nfu_with_aging_page_choice_func+0x165>
+
+00802e39 <myRand>:
+    state = state * 1664525 + 1013904223;
+  802e39:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  802e40:	66 19 00 
+  802e43:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802e48:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  802e4d:	c1 e8 18             	shr    $0x18,%eax
+}
+  802e50:	c3                   	ret
+
+00802e51 <random_page_choice_func>:
+{
+  802e51:	55                   	push   %ebp
+  802e52:	89 e5                	mov    %esp,%ebp
+  802e54:	57                   	push   %edi
+  802e55:	56                   	push   %esi
+  802e56:	53                   	push   %ebx
+  802e57:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802e5a:	be 00 00 00 00       	mov    $0x0,%esi
+  802e5f:	eb 19                	jmp    802e7a <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802e61:	f7 d3                	not    %ebx
+  802e63:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802e69:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802e6b:	83 c6 01             	add    $0x1,%esi
+  802e6e:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802e74:	0f 87 a0 00 00 00    	ja     802f1a <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802e7a:	89 f3                	mov    %esi,%ebx
+  802e7c:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  802e82:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802e88:	89 d8                	mov    %ebx,%eax
+  802e8a:	c1 e8 0a             	shr    $0xa,%eax
+  802e8d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802e94:	25 81 00 00 00       	and    $0x81,%eax
+  802e99:	83 f8 01             	cmp    $0x1,%eax
+  802e9c:	75 c3                	jne    802e61 <random_page_choice_func+0x10>
+  802e9e:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802ea4:	77 bb                	ja     802e61 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802ea6:	89 df                	mov    %ebx,%edi
+  802ea8:	c1 e7 0c             	shl    $0xc,%edi
+  802eab:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802eae:	89 f8                	mov    %edi,%eax
+  802eb0:	e8 06 f9 ff ff       	call   8027bb <page_is_clean>
+  802eb5:	84 c0                	test   %al,%al
+  802eb7:	0f 85 82 00 00 00    	jne    802f3f <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802ebd:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  802ec3:	72 a6                	jb     802e6b <random_page_choice_func+0x1a>
+  802ec5:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802ecb:	77 9e                	ja     802e6b <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802ecd:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802ed4:	a8 01                	test   $0x1,%al
+  802ed6:	74 93                	je     802e6b <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802ed8:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802edf:	f6 c4 04             	test   $0x4,%ah
+  802ee2:	75 87                	jne    802e6b <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802ee4:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802eeb:	f6 c4 02             	test   $0x2,%ah
+  802eee:	0f 85 77 ff ff ff    	jne    802e6b <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802ef4:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802efb:	c1 e8 0c             	shr    $0xc,%eax
+  802efe:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802f01:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802f06:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802f0a:	66 83 f8 01          	cmp    $0x1,%ax
+  802f0e:	0f 87 57 ff ff ff    	ja     802e6b <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  802f14:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802f1a:	e8 1a ff ff ff       	call   802e39 <myRand>
+  802f1f:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  802f25:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  802f2a:	29 fe                	sub    %edi,%esi
+  802f2c:	0f be c0             	movsbl %al,%eax
+  802f2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f34:	f7 f6                	div    %esi
+  802f36:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802f38:	bb 15 00 00 00       	mov    $0x15,%ebx
+  802f3d:	eb 1c                	jmp    802f5b <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  802f3f:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  802f45:	e9 8f 00 00 00       	jmp    802fd9 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802f4a:	e8 ea fe ff ff       	call   802e39 <myRand>
+  802f4f:	0f be c0             	movsbl %al,%eax
+  802f52:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f57:	f7 f6                	div    %esi
+  802f59:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802f5b:	83 eb 01             	sub    $0x1,%ebx
+  802f5e:	0f 84 c2 00 00 00    	je     803026 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  802f64:	89 d0                	mov    %edx,%eax
+  802f66:	c1 e8 0a             	shr    $0xa,%eax
+  802f69:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802f70:	25 81 00 00 00       	and    $0x81,%eax
+  802f75:	83 f8 01             	cmp    $0x1,%eax
+  802f78:	75 d0                	jne    802f4a <random_page_choice_func+0xf9>
+  802f7a:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  802f80:	77 c8                	ja     802f4a <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  802f82:	89 d0                	mov    %edx,%eax
+  802f84:	c1 e0 0c             	shl    $0xc,%eax
+  802f87:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  802f8c:	72 56                	jb     802fe4 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f8e:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  802f93:	77 65                	ja     802ffa <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802f95:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f9c:	f6 c1 01             	test   $0x1,%cl
+  802f9f:	74 59                	je     802ffa <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802fa1:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802fa8:	f6 c5 04             	test   $0x4,%ch
+  802fab:	75 4d                	jne    802ffa <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  802fad:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802fb4:	f6 c5 02             	test   $0x2,%ch
+  802fb7:	75 41                	jne    802ffa <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  802fb9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802fc0:	c1 ea 0c             	shr    $0xc,%edx
+  802fc3:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  802fc6:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  802fcc:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  802fd0:	66 83 fa 01          	cmp    $0x1,%dx
+  802fd4:	77 3a                	ja     803010 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  802fd6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  802fd9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fdc:	83 c4 1c             	add    $0x1c,%esp
+  802fdf:	5b                   	pop    %ebx
+  802fe0:	5e                   	pop    %esi
+  802fe1:	5f                   	pop    %edi
+  802fe2:	5d                   	pop    %ebp
+  802fe3:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802fe4:	e8 50 fe ff ff       	call   802e39 <myRand>
+  802fe9:	0f be c0             	movsbl %al,%eax
+  802fec:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ff1:	f7 f6                	div    %esi
+  802ff3:	01 fa                	add    %edi,%edx
+			continue;
+  802ff5:	e9 61 ff ff ff       	jmp    802f5b <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802ffa:	e8 3a fe ff ff       	call   802e39 <myRand>
+  802fff:	0f be c0             	movsbl %al,%eax
+  803002:	ba 00 00 00 00       	mov    $0x0,%edx
+  803007:	f7 f6                	div    %esi
+  803009:	01 fa                	add    %edi,%edx
+			continue;
+  80300b:	e9 4b ff ff ff       	jmp    802f5b <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  803010:	e8 24 fe ff ff       	call   802e39 <myRand>
+  803015:	0f be c0             	movsbl %al,%eax
+  803018:	ba 00 00 00 00       	mov    $0x0,%edx
+  80301d:	f7 f6                	div    %esi
+  80301f:	01 fa                	add    %edi,%edx
+			continue;
+  803021:	e9 35 ff ff ff       	jmp    802f5b <random_page_choice_func+0x10a>
+	pgnum = 0;
+  803026:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  80302d:	00 00 00 
+	return (void*)UTOP;
+  803030:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  803037:	eb a0                	jmp    802fd9 <random_page_choice_func+0x188>
+
+00803039 <nfu>:
+{
+  803039:	55                   	push   %ebp
+  80303a:	89 e5                	mov    %esp,%ebp
+  80303c:	57                   	push   %edi
+  80303d:	56                   	push   %esi
+  80303e:	53                   	push   %ebx
+  80303f:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803042:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  803048:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  80304a:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80304f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803054:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80305b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803060:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  803063:	eb 18                	jmp    80307d <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803065:	f7 d0                	not    %eax
+  803067:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80306c:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80306e:	83 c2 01             	add    $0x1,%edx
+  803071:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803077:	0f 87 13 01 00 00    	ja     803190 <nfu+0x157>
+		++num_searched_ptes;
+  80307d:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803081:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  803084:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803089:	89 c1                	mov    %eax,%ecx
+  80308b:	c1 e9 0a             	shr    $0xa,%ecx
+  80308e:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  803095:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  80309b:	83 f9 01             	cmp    $0x1,%ecx
+  80309e:	75 c5                	jne    803065 <nfu+0x2c>
+  8030a0:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8030a5:	77 be                	ja     803065 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8030a7:	89 c1                	mov    %eax,%ecx
+  8030a9:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8030ac:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  8030b2:	0f 82 a5 00 00 00    	jb     80315d <nfu+0x124>
+  8030b8:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8030be:	0f 87 99 00 00 00    	ja     80315d <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8030c4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8030cb:	f6 c1 01             	test   $0x1,%cl
+  8030ce:	0f 84 89 00 00 00    	je     80315d <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8030d4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8030db:	f6 c5 04             	test   $0x4,%ch
+  8030de:	75 7d                	jne    80315d <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8030e0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8030e7:	f6 c5 02             	test   $0x2,%ch
+  8030ea:	75 71                	jne    80315d <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8030ec:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8030f3:	c1 e9 0c             	shr    $0xc,%ecx
+  8030f6:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8030f9:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8030ff:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803103:	66 83 f9 01          	cmp    $0x1,%cx
+  803107:	77 54                	ja     80315d <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  803109:	89 f9                	mov    %edi,%ecx
+  80310b:	80 f9 ff             	cmp    $0xff,%cl
+  80310e:	74 21                	je     803131 <nfu+0xf8>
+  803110:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803117:	c1 e9 0c             	shr    $0xc,%ecx
+  80311a:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80311d:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803123:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  803127:	89 fb                	mov    %edi,%ebx
+  803129:	38 d9                	cmp    %bl,%cl
+  80312b:	73 30                	jae    80315d <nfu+0x124>
+  80312d:	dd d8                	fstp   %st(0)
+  80312f:	eb 02                	jmp    803133 <nfu+0xfa>
+  803131:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  803133:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80313a:	c1 e9 0c             	shr    $0xc,%ecx
+  80313d:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803140:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  803147:	89 fb                	mov    %edi,%ebx
+  803149:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  80314c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80314f:	db 45 e0             	fildl  -0x20(%ebp)
+  803152:	d8 35 80 5e 80 00    	fdivs  0x805e80
+	return ret*ret;
+  803158:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80315a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  80315d:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  803160:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803163:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80316a:	df 6d e0             	fildll -0x20(%ebp)
+  80316d:	d9 c1                	fld    %st(1)
+  80316f:	d8 0d 84 5e 80 00    	fmuls  0x805e84
+  803175:	d9 c9                	fxch   %st(1)
+  803177:	df f1                	fcomip %st(1),%st
+  803179:	dd d8                	fstp   %st(0)
+  80317b:	0f 82 ed fe ff ff    	jb     80306e <nfu+0x35>
+  803181:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  803183:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  803188:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80318b:	c1 e0 0c             	shl    $0xc,%eax
+  80318e:	eb 0e                	jmp    80319e <nfu+0x165>
+  803190:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  803192:	89 f8                	mov    %edi,%eax
+  803194:	3c ff                	cmp    $0xff,%al
+  803196:	74 0e                	je     8031a6 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  803198:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80319b:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80319e:	83 c4 14             	add    $0x14,%esp
+  8031a1:	5b                   	pop    %ebx
+  8031a2:	5e                   	pop    %esi
+  8031a3:	5f                   	pop    %edi
+  8031a4:	5d                   	pop    %ebp
+  8031a5:	c3                   	ret
+	pgnum = 0;
+  8031a6:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  8031ad:	00 00 00 
+	return (void*)UTOP;
+  8031b0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8031b5:	eb e7                	jmp    80319e <nfu+0x165>
+
+008031b7 <lru>:
+{
+  8031b7:	55                   	push   %ebp
+  8031b8:	89 e5                	mov    %esp,%ebp
+  8031ba:	57                   	push   %edi
+  8031bb:	56                   	push   %esi
+  8031bc:	53                   	push   %ebx
+  8031bd:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8031c0:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  8031c6:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  8031cd:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8031d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8031d9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8031e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031e5:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  8031e8:	eb 18                	jmp    803202 <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8031ea:	f7 d0                	not    %eax
+  8031ec:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031f1:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8031f3:	83 c2 01             	add    $0x1,%edx
+  8031f6:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  8031fc:	0f 87 fa 00 00 00    	ja     8032fc <lru+0x145>
+		++num_searched_ptes;
+  803202:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803205:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803208:	01 d0                	add    %edx,%eax
+  80320a:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80320f:	89 c1                	mov    %eax,%ecx
+  803211:	c1 e9 0a             	shr    $0xa,%ecx
+  803214:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80321b:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803221:	83 f9 01             	cmp    $0x1,%ecx
+  803224:	75 c4                	jne    8031ea <lru+0x33>
+  803226:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  80322b:	77 bd                	ja     8031ea <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  80322d:	89 c1                	mov    %eax,%ecx
+  80322f:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803232:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803238:	0f 87 92 00 00 00    	ja     8032d0 <lru+0x119>
+  80323e:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  803244:	0f 82 86 00 00 00    	jb     8032d0 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80324a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803251:	f6 c1 01             	test   $0x1,%cl
+  803254:	74 7a                	je     8032d0 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803256:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80325d:	f6 c5 04             	test   $0x4,%ch
+  803260:	75 6e                	jne    8032d0 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803262:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803269:	f6 c5 02             	test   $0x2,%ch
+  80326c:	75 62                	jne    8032d0 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80326e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803275:	c1 e9 0c             	shr    $0xc,%ecx
+  803278:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80327b:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803281:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803285:	66 83 f9 01          	cmp    $0x1,%cx
+  803289:	77 45                	ja     8032d0 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  80328b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803292:	c1 e9 0c             	shr    $0xc,%ecx
+  803295:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803298:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80329e:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8032a1:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8032a4:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  8032a7:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8032aa:	19 df                	sbb    %ebx,%edi
+  8032ac:	7c 22                	jl     8032d0 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  8032ae:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032b5:	c1 e9 0c             	shr    $0xc,%ecx
+  8032b8:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032bb:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032c1:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8032c4:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8032c7:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8032ca:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8032cd:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8032d0:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8032d3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8032da:	df 6d e0             	fildll -0x20(%ebp)
+  8032dd:	d9 05 84 5e 80 00    	flds   0x805e84
+  8032e3:	d9 c9                	fxch   %st(1)
+  8032e5:	df f1                	fcomip %st(1),%st
+  8032e7:	dd d8                	fstp   %st(0)
+  8032e9:	0f 82 04 ff ff ff    	jb     8031f3 <lru+0x3c>
+			pgnum = pgnum_actual;
+  8032ef:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  8032f4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8032f7:	c1 e0 0c             	shl    $0xc,%eax
+  8032fa:	eb 06                	jmp    803302 <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  8032fc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8032ff:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803302:	83 c4 1c             	add    $0x1c,%esp
+  803305:	5b                   	pop    %ebx
+  803306:	5e                   	pop    %esi
+  803307:	5f                   	pop    %edi
+  803308:	5d                   	pop    %ebp
+  803309:	c3                   	ret
+
+0080330a <set_page_choice_func>:
+{
+  80330a:	55                   	push   %ebp
+  80330b:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  80330d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803310:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  803315:	5d                   	pop    %ebp
+  803316:	c3                   	ret
+
+00803317 <get_page_choice>:
+{
+  803317:	55                   	push   %ebp
+  803318:	89 e5                	mov    %esp,%ebp
+  80331a:	57                   	push   %edi
+  80331b:	56                   	push   %esi
+  80331c:	53                   	push   %ebx
+  80331d:	83 ec 24             	sub    $0x24,%esp
+  803320:	8b 75 08             	mov    0x8(%ebp),%esi
+  803323:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  803326:	57                   	push   %edi
+  803327:	56                   	push   %esi
+  803328:	ff 15 3c 60 80 00    	call   *0x80603c
+  80332e:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803330:	83 c4 10             	add    $0x10,%esp
+  803333:	eb 25                	jmp    80335a <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  803335:	83 ec 08             	sub    $0x8,%esp
+  803338:	c1 e0 16             	shl    $0x16,%eax
+  80333b:	50                   	push   %eax
+  80333c:	6a 00                	push   $0x0
+  80333e:	e8 cc da ff ff       	call   800e0f <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803343:	83 c4 10             	add    $0x10,%esp
+  803346:	85 c0                	test   %eax,%eax
+  803348:	75 43                	jne    80338d <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  80334a:	83 ec 08             	sub    $0x8,%esp
+  80334d:	57                   	push   %edi
+  80334e:	56                   	push   %esi
+  80334f:	ff 15 3c 60 80 00    	call   *0x80603c
+  803355:	89 c3                	mov    %eax,%ebx
+  803357:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80335a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80335d:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803363:	0f 86 ae 00 00 00    	jbe    803417 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803369:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  80336e:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803375:	81 e2 81 00 00 00    	and    $0x81,%edx
+  80337b:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  803381:	74 b2                	je     803335 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803383:	83 c0 01             	add    $0x1,%eax
+  803386:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  80338b:	75 e1                	jne    80336e <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  80338d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803390:	05 00 10 40 11       	add    $0x11401000,%eax
+  803395:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80339a:	76 1f                	jbe    8033bb <get_page_choice+0xa4>
+		return (void *) UTOP;
+  80339c:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  8033a1:	89 d8                	mov    %ebx,%eax
+  8033a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033a6:	5b                   	pop    %ebx
+  8033a7:	5e                   	pop    %esi
+  8033a8:	5f                   	pop    %edi
+  8033a9:	5d                   	pop    %ebp
+  8033aa:	c3                   	ret
+		sys_page_split(0, pg_out);
+  8033ab:	83 ec 08             	sub    $0x8,%esp
+  8033ae:	53                   	push   %ebx
+  8033af:	6a 00                	push   $0x0
+  8033b1:	e8 59 da ff ff       	call   800e0f <sys_page_split>
+  8033b6:	83 c4 10             	add    $0x10,%esp
+  8033b9:	eb 6c                	jmp    803427 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  8033bb:	83 ec 04             	sub    $0x4,%esp
+  8033be:	68 2c 5a 80 00       	push   $0x805a2c
+  8033c3:	68 cc 01 00 00       	push   $0x1cc
+  8033c8:	68 9b 59 80 00       	push   $0x80599b
+  8033cd:	e8 c1 cd ff ff       	call   800193 <_panic>
+		panic("We tried to page out code pages\n");
+  8033d2:	83 ec 04             	sub    $0x4,%esp
+  8033d5:	68 5c 5a 80 00       	push   $0x805a5c
+  8033da:	68 d6 01 00 00       	push   $0x1d6
+  8033df:	68 9b 59 80 00       	push   $0x80599b
+  8033e4:	e8 aa cd ff ff       	call   800193 <_panic>
+		panic("Invalid mapping for the va\n");
+  8033e9:	83 ec 04             	sub    $0x4,%esp
+  8033ec:	68 a8 59 80 00       	push   $0x8059a8
+  8033f1:	68 da 01 00 00       	push   $0x1da
+  8033f6:	68 9b 59 80 00       	push   $0x80599b
+  8033fb:	e8 93 cd ff ff       	call   800193 <_panic>
+		panic("We tried to page out a shared page\n");
+  803400:	83 ec 04             	sub    $0x4,%esp
+  803403:	68 80 5a 80 00       	push   $0x805a80
+  803408:	68 e0 01 00 00       	push   $0x1e0
+  80340d:	68 9b 59 80 00       	push   $0x80599b
+  803412:	e8 7c cd ff ff       	call   800193 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  803417:	89 de                	mov    %ebx,%esi
+  803419:	c1 ee 16             	shr    $0x16,%esi
+  80341c:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803423:	a8 80                	test   $0x80,%al
+  803425:	75 84                	jne    8033ab <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803427:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80342a:	05 00 10 40 11       	add    $0x11401000,%eax
+  80342f:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803434:	76 85                	jbe    8033bb <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  803436:	89 d8                	mov    %ebx,%eax
+  803438:	e8 7e f3 ff ff       	call   8027bb <page_is_clean>
+  80343d:	84 c0                	test   %al,%al
+  80343f:	0f 85 5c ff ff ff    	jne    8033a1 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  803445:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  80344c:	76 84                	jbe    8033d2 <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  80344e:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803455:	a8 01                	test   $0x1,%al
+  803457:	74 90                	je     8033e9 <get_page_choice+0xd2>
+  803459:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80345c:	c1 e8 0c             	shr    $0xc,%eax
+  80345f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803466:	f6 c2 01             	test   $0x1,%dl
+  803469:	0f 84 7a ff ff ff    	je     8033e9 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  80346f:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  803476:	f6 c2 01             	test   $0x1,%dl
+  803479:	74 85                	je     803400 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  80347b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803482:	f6 c2 01             	test   $0x1,%dl
+  803485:	0f 84 75 ff ff ff    	je     803400 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  80348b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803492:	f6 c6 04             	test   $0x4,%dh
+  803495:	0f 85 65 ff ff ff    	jne    803400 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  80349b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8034a2:	f6 c6 02             	test   $0x2,%dh
+  8034a5:	0f 85 55 ff ff ff    	jne    803400 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  8034ab:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8034b2:	c1 e8 0c             	shr    $0xc,%eax
+  8034b5:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8034b8:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8034bd:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8034c1:	66 83 f8 01          	cmp    $0x1,%ax
+  8034c5:	0f 86 d6 fe ff ff    	jbe    8033a1 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  8034cb:	83 ec 04             	sub    $0x4,%esp
+  8034ce:	68 a4 5a 80 00       	push   $0x805aa4
+  8034d3:	68 e2 01 00 00       	push   $0x1e2
+  8034d8:	68 9b 59 80 00       	push   $0x80599b
+  8034dd:	e8 b1 cc ff ff       	call   800193 <_panic>
+
+008034e2 <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  8034e2:	55                   	push   %ebp
+  8034e3:	89 e5                	mov    %esp,%ebp
+  8034e5:	57                   	push   %edi
+  8034e6:	56                   	push   %esi
+  8034e7:	53                   	push   %ebx
+  8034e8:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  8034eb:	e8 e8 f6 ff ff       	call   802bd8 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  8034f0:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  8034f5:	85 c0                	test   %eax,%eax
+  8034f7:	74 41                	je     80353a <page_share_paged_out+0x58>
+  8034f9:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803500:	0f 84 fd 00 00 00    	je     803603 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  803506:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  80350d:	00 00 00 
+  803510:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  803517:	00 00 00 
+  80351a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80351f:	eb 2c                	jmp    80354d <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803521:	83 c3 04             	add    $0x4,%ebx
+  803524:	39 f3                	cmp    %esi,%ebx
+  803526:	74 1a                	je     803542 <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  803528:	8b 03                	mov    (%ebx),%eax
+  80352a:	a8 01                	test   $0x1,%al
+  80352c:	74 f3                	je     803521 <page_share_paged_out+0x3f>
+  80352e:	c1 e8 0c             	shr    $0xc,%eax
+  803531:	e8 2b f5 ff ff       	call   802a61 <page_share_slot>
+  803536:	85 c0                	test   %eax,%eax
+  803538:	79 e7                	jns    803521 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  80353a:	83 c4 0c             	add    $0xc,%esp
+  80353d:	5b                   	pop    %ebx
+  80353e:	5e                   	pop    %esi
+  80353f:	5f                   	pop    %edi
+  803540:	5d                   	pop    %ebp
+  803541:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  803542:	83 c7 04             	add    $0x4,%edi
+  803545:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  80354b:	74 1b                	je     803568 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  80354d:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803552:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  803555:	f6 c3 01             	test   $0x1,%bl
+  803558:	74 e8                	je     803542 <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  80355a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803560:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  803566:	eb bc                	jmp    803524 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803568:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80356d:	eb 11                	jmp    803580 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  80356f:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803575:	83 c3 01             	add    $0x1,%ebx
+  803578:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80357e:	77 41                	ja     8035c1 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  803580:	89 d8                	mov    %ebx,%eax
+  803582:	c1 e8 0a             	shr    $0xa,%eax
+  803585:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80358c:	25 81 00 00 00       	and    $0x81,%eax
+  803591:	83 f8 01             	cmp    $0x1,%eax
+  803594:	75 d9                	jne    80356f <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803596:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80359d:	25 81 00 00 00       	and    $0x81,%eax
+  8035a2:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8035a7:	75 cc                	jne    803575 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  8035a9:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8035b0:	c1 e8 0c             	shr    $0xc,%eax
+  8035b3:	e8 a9 f4 ff ff       	call   802a61 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  8035b8:	85 c0                	test   %eax,%eax
+  8035ba:	79 b9                	jns    803575 <page_share_paged_out+0x93>
+  8035bc:	e9 79 ff ff ff       	jmp    80353a <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8035c1:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8035c8:	75 13                	jne    8035dd <page_share_paged_out+0xfb>
+  8035ca:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8035d1:	75 1d                	jne    8035f0 <page_share_paged_out+0x10e>
+	return 0;
+  8035d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d8:	e9 5d ff ff ff       	jmp    80353a <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8035dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e2:	e8 46 f4 ff ff       	call   802a2d <page_share_send>
+  8035e7:	85 c0                	test   %eax,%eax
+  8035e9:	79 df                	jns    8035ca <page_share_paged_out+0xe8>
+  8035eb:	e9 4a ff ff ff       	jmp    80353a <page_share_paged_out+0x58>
+  8035f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8035f5:	e8 33 f4 ff ff       	call   802a2d <page_share_send>
+  8035fa:	85 c0                	test   %eax,%eax
+  8035fc:	79 d5                	jns    8035d3 <page_share_paged_out+0xf1>
+  8035fe:	e9 37 ff ff ff       	jmp    80353a <page_share_paged_out+0x58>
+		return 0;
+  803603:	b8 00 00 00 00       	mov    $0x0,%eax
+  803608:	e9 2d ff ff ff       	jmp    80353a <page_share_paged_out+0x58>
+
+0080360d <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  80360d:	55                   	push   %ebp
+  80360e:	89 e5                	mov    %esp,%ebp
+  803610:	56                   	push   %esi
+  803611:	53                   	push   %ebx
+  803612:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  803615:	e8 be f5 ff ff       	call   802bd8 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  80361a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  80361f:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803626:	0f 84 82 00 00 00    	je     8036ae <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  80362c:	83 ec 0c             	sub    $0xc,%esp
+  80362f:	68 00 10 00 00       	push   $0x1000
+  803634:	e8 84 11 00 00       	call   8047bd <malloc>
+  803639:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  80363b:	83 c4 0c             	add    $0xc,%esp
+  80363e:	6a 14                	push   $0x14
+  803640:	6a 00                	push   $0x0
+  803642:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803645:	50                   	push   %eax
+  803646:	e8 5b d3 ff ff       	call   8009a6 <memset>
+  80364b:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  80364e:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  803653:	83 ec 0c             	sub    $0xc,%esp
+  803656:	6a 07                	push   $0x7
+  803658:	6a 01                	push   $0x1
+  80365a:	53                   	push   %ebx
+  80365b:	6a 03                	push   $0x3
+  80365d:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803664:	e8 b7 19 00 00       	call   805020 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  803669:	8b 03                	mov    (%ebx),%eax
+  80366b:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  80366e:	8b 43 04             	mov    0x4(%ebx),%eax
+  803671:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  803674:	8b 43 08             	mov    0x8(%ebx),%eax
+  803677:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  80367a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80367d:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  803680:	8b 43 10             	mov    0x10(%ebx),%eax
+  803683:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803686:	83 c6 01             	add    $0x1,%esi
+  803689:	83 c4 20             	add    $0x20,%esp
+  80368c:	83 fe 02             	cmp    $0x2,%esi
+  80368f:	75 c2                	jne    803653 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  803691:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803694:	89 03                	mov    %eax,(%ebx)
+  803696:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803699:	89 43 04             	mov    %eax,0x4(%ebx)
+  80369c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80369f:	89 43 08             	mov    %eax,0x8(%ebx)
+  8036a2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8036a5:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8036a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036ab:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  8036ae:	89 d8                	mov    %ebx,%eax
+  8036b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036b3:	5b                   	pop    %ebx
+  8036b4:	5e                   	pop    %esi
+  8036b5:	5d                   	pop    %ebp
+  8036b6:	c3                   	ret
+
+008036b7 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  8036b7:	55                   	push   %ebp
+  8036b8:	89 e5                	mov    %esp,%ebp
+  8036ba:	53                   	push   %ebx
+  8036bb:	83 ec 10             	sub    $0x10,%esp
+  8036be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  8036c1:	68 ee 53 80 00       	push   $0x8053ee
+  8036c6:	e8 a3 cb ff ff       	call   80026e <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  8036cb:	83 c4 08             	add    $0x8,%esp
+  8036ce:	ff 33                	push   (%ebx)
+  8036d0:	68 d8 5a 80 00       	push   $0x805ad8
+  8036d5:	e8 94 cb ff ff       	call   80026e <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  8036da:	83 c4 08             	add    $0x8,%esp
+  8036dd:	ff 73 04             	push   0x4(%ebx)
+  8036e0:	68 c4 59 80 00       	push   $0x8059c4
+  8036e5:	e8 84 cb ff ff       	call   80026e <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  8036ea:	83 c4 08             	add    $0x8,%esp
+  8036ed:	ff 73 08             	push   0x8(%ebx)
+  8036f0:	68 f8 5a 80 00       	push   $0x805af8
+  8036f5:	e8 74 cb ff ff       	call   80026e <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  8036fa:	83 c4 08             	add    $0x8,%esp
+  8036fd:	ff 73 0c             	push   0xc(%ebx)
+  803700:	68 1c 5b 80 00       	push   $0x805b1c
+  803705:	e8 64 cb ff ff       	call   80026e <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  80370a:	83 c4 08             	add    $0x8,%esp
+  80370d:	ff 73 10             	push   0x10(%ebx)
+  803710:	68 40 5b 80 00       	push   $0x805b40
+  803715:	e8 54 cb ff ff       	call   80026e <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  80371a:	83 c4 08             	add    $0x8,%esp
+  80371d:	ff 35 08 b0 80 00    	push   0x80b008
+  803723:	68 7c 5b 80 00       	push   $0x805b7c
+  803728:	e8 41 cb ff ff       	call   80026e <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  80372d:	83 c4 08             	add    $0x8,%esp
+  803730:	ff 35 04 b0 80 00    	push   0x80b004
+  803736:	68 b0 5b 80 00       	push   $0x805bb0
+  80373b:	e8 2e cb ff ff       	call   80026e <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  803740:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803745:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  803748:	8b 50 68             	mov    0x68(%eax),%edx
+  80374b:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  80374e:	51                   	push   %ecx
+  80374f:	52                   	push   %edx
+  803750:	50                   	push   %eax
+  803751:	68 f0 5b 80 00       	push   $0x805bf0
+  803756:	e8 13 cb ff ff       	call   80026e <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  80375b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803760:	8b 40 70             	mov    0x70(%eax),%eax
+  803763:	83 c4 18             	add    $0x18,%esp
+  803766:	50                   	push   %eax
+  803767:	68 24 5c 80 00       	push   $0x805c24
+  80376c:	e8 fd ca ff ff       	call   80026e <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  803771:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  803777:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  80377d:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  803782:	51                   	push   %ecx
+  803783:	52                   	push   %edx
+  803784:	50                   	push   %eax
+  803785:	68 54 5c 80 00       	push   $0x805c54
+  80378a:	e8 df ca ff ff       	call   80026e <cprintf>
+	cprintf("\n");
+  80378f:	83 c4 14             	add    $0x14,%esp
+  803792:	68 ee 53 80 00       	push   $0x8053ee
+  803797:	e8 d2 ca ff ff       	call   80026e <cprintf>
+}
+  80379c:	83 c4 10             	add    $0x10,%esp
+  80379f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037a2:	c9                   	leave
+  8037a3:	c3                   	ret
+
+008037a4 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  8037a4:	55                   	push   %ebp
+  8037a5:	89 e5                	mov    %esp,%ebp
+  8037a7:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  8037aa:	e8 5e fe ff ff       	call   80360d <get_paging_stats>
+  8037af:	83 ec 0c             	sub    $0xc,%esp
+  8037b2:	50                   	push   %eax
+  8037b3:	e8 ff fe ff ff       	call   8036b7 <print_paging_stats>
+}
+  8037b8:	83 c4 10             	add    $0x10,%esp
+  8037bb:	c9                   	leave
+  8037bc:	c3                   	ret
+
+008037bd <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  8037bd:	55                   	push   %ebp
+  8037be:	89 e5                	mov    %esp,%ebp
+  8037c0:	53                   	push   %ebx
+  8037c1:	83 ec 04             	sub    $0x4,%esp
+  8037c4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  8037c7:	eb 13                	jmp    8037dc <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  8037c9:	83 ec 04             	sub    $0x4,%esp
+  8037cc:	6a ff                	push   $0xffffffff
+  8037ce:	53                   	push   %ebx
+  8037cf:	68 00 f0 ff ee       	push   $0xeefff000
+  8037d4:	e8 48 da ff ff       	call   801221 <sys_futex_wait>
+  8037d9:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  8037dc:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  8037e1:	39 d8                	cmp    %ebx,%eax
+  8037e3:	74 e4                	je     8037c9 <mem_pressure_wait+0xc>
+	return now;
+}
+  8037e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037e8:	c9                   	leave
+  8037e9:	c3                   	ret
+
+008037ea <init_map_dir>:
+
+void
+init_map_dir()
+{
+  8037ea:	55                   	push   %ebp
+  8037eb:	89 e5                	mov    %esp,%ebp
+  8037ed:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  8037f0:	68 5c 44 80 00       	push   $0x80445c
+  8037f5:	e8 32 16 00 00       	call   804e2c <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  8037fa:	c7 05 14 e9 80 00 00 	movl   $0xdeadb000,0x80e914
+  803801:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  803804:	83 c4 0c             	add    $0xc,%esp
+  803807:	68 07 02 00 00       	push   $0x207
+  80380c:	68 00 b0 ad de       	push   $0xdeadb000
+  803811:	6a 00                	push   $0x0
+  803813:	e8 30 d5 ff ff       	call   800d48 <sys_page_alloc>
+  803818:	83 c4 10             	add    $0x10,%esp
+  80381b:	85 c0                	test   %eax,%eax
+  80381d:	78 0c                	js     80382b <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  80381f:	e8 b4 f3 ff ff       	call   802bd8 <find_paging_env>
+	page_ring_ready();
+  803824:	e8 7f f2 ff ff       	call   802aa8 <page_ring_ready>
+}
+  803829:	c9                   	leave
+  80382a:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  80382b:	50                   	push   %eax
+  80382c:	68 e2 59 80 00       	push   $0x8059e2
+  803831:	68 13 05 00 00       	push   $0x513
+  803836:	68 9b 59 80 00       	push   $0x80599b
+  80383b:	e8 53 c9 ff ff       	call   800193 <_panic>
+
+00803840 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  803840:	55                   	push   %ebp
+  803841:	89 e5                	mov    %esp,%ebp
+  803843:	57                   	push   %edi
+  803844:	56                   	push   %esi
+  803845:	53                   	push   %ebx
+  803846:	83 ec 0c             	sub    $0xc,%esp
+  803849:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  80384c:	89 fa                	mov    %edi,%edx
+  80384e:	c1 ea 16             	shr    $0x16,%edx
+  803851:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803856:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  803859:	f6 06 01             	testb  $0x1,(%esi)
+  80385c:	75 3e                	jne    80389c <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  80385e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  803863:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803867:	74 47                	je     8038b0 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  803869:	83 ec 0c             	sub    $0xc,%esp
+  80386c:	6a 01                	push   $0x1
+  80386e:	e8 f2 11 00 00       	call   804a65 <va_alloc>
+  803873:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  803875:	83 c4 10             	add    $0x10,%esp
+  803878:	85 c0                	test   %eax,%eax
+  80387a:	74 34                	je     8038b0 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  80387c:	6a 00                	push   $0x0
+  80387e:	68 07 02 00 00       	push   $0x207
+  803883:	50                   	push   %eax
+  803884:	6a 00                	push   $0x0
+  803886:	e8 df 02 00 00       	call   803b6a <page_alloc>
+  80388b:	83 c4 10             	add    $0x10,%esp
+  80388e:	85 c0                	test   %eax,%eax
+  803890:	78 28                	js     8038ba <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  803892:	f6 06 01             	testb  $0x1,(%esi)
+  803895:	75 38                	jne    8038cf <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803897:	83 cb 01             	or     $0x1,%ebx
+  80389a:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  80389c:	89 f8                	mov    %edi,%eax
+  80389e:	c1 e8 0a             	shr    $0xa,%eax
+  8038a1:	25 fc 0f 00 00       	and    $0xffc,%eax
+  8038a6:	8b 1e                	mov    (%esi),%ebx
+  8038a8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8038ae:	01 c3                	add    %eax,%ebx
+}
+  8038b0:	89 d8                	mov    %ebx,%eax
+  8038b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038b5:	5b                   	pop    %ebx
+  8038b6:	5e                   	pop    %esi
+  8038b7:	5f                   	pop    %edi
+  8038b8:	5d                   	pop    %ebp
+  8038b9:	c3                   	ret
+			va_free(page, 1);
+  8038ba:	83 ec 08             	sub    $0x8,%esp
+  8038bd:	6a 01                	push   $0x1
+  8038bf:	53                   	push   %ebx
+  8038c0:	e8 d8 12 00 00       	call   804b9d <va_free>
+			return NULL;
+  8038c5:	83 c4 10             	add    $0x10,%esp
+  8038c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038cd:	eb e1                	jmp    8038b0 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  8038cf:	83 ec 08             	sub    $0x8,%esp
+  8038d2:	53                   	push   %ebx
+  8038d3:	6a 00                	push   $0x0
+  8038d5:	e8 f3 d4 ff ff       	call   800dcd <sys_page_unmap>
+			va_free(page, 1);
+  8038da:	83 c4 08             	add    $0x8,%esp
+  8038dd:	6a 01                	push   $0x1
+  8038df:	53                   	push   %ebx
+  8038e0:	e8 b8 12 00 00       	call   804b9d <va_free>
+  8038e5:	83 c4 10             	add    $0x10,%esp
+  8038e8:	eb b2                	jmp    80389c <umapdir_walk+0x5c>
+
+008038ea <page_out>:
+{
+  8038ea:	55                   	push   %ebp
+  8038eb:	89 e5                	mov    %esp,%ebp
+  8038ed:	57                   	push   %edi
+  8038ee:	56                   	push   %esi
+  8038ef:	53                   	push   %ebx
+  8038f0:	83 ec 5c             	sub    $0x5c,%esp
+  8038f3:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  8038f6:	e8 dd f2 ff ff       	call   802bd8 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  8038fb:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803900:	85 c0                	test   %eax,%eax
+  803902:	74 1e                	je     803922 <page_out+0x38>
+  803904:	83 ec 0c             	sub    $0xc,%esp
+  803907:	6a 00                	push   $0x0
+  803909:	6a 00                	push   $0x0
+  80390b:	6a 00                	push   $0x0
+  80390d:	6a 08                	push   $0x8
+  80390f:	50                   	push   %eax
+  803910:	e8 0b 17 00 00       	call   805020 <ipc_call>
+  803915:	89 c3                	mov    %eax,%ebx
+  803917:	83 c4 20             	add    $0x20,%esp
+  80391a:	85 c0                	test   %eax,%eax
+  80391c:	0f 84 ac 00 00 00    	je     8039ce <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  803922:	83 ec 08             	sub    $0x8,%esp
+  803925:	ff 75 0c             	push   0xc(%ebp)
+  803928:	57                   	push   %edi
+  803929:	e8 e9 f9 ff ff       	call   803317 <get_page_choice>
+  80392e:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  803930:	83 c4 10             	add    $0x10,%esp
+  803933:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803938:	0f 84 18 02 00 00    	je     803b56 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  80393e:	e8 78 ee ff ff       	call   8027bb <page_is_clean>
+  803943:	84 c0                	test   %al,%al
+  803945:	0f 85 8c 00 00 00    	jne    8039d7 <page_out+0xed>
+	if (pagingenv == 0)
+  80394b:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803952:	0f 84 08 02 00 00    	je     803b60 <page_out+0x276>
+	if (page_ring_ready())
+  803958:	e8 4b f1 ff ff       	call   802aa8 <page_ring_ready>
+  80395d:	89 c3                	mov    %eax,%ebx
+  80395f:	85 c0                	test   %eax,%eax
+  803961:	0f 85 89 00 00 00    	jne    8039f0 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  803967:	83 ec 0c             	sub    $0xc,%esp
+  80396a:	6a 05                	push   $0x5
+  80396c:	6a 01                	push   $0x1
+  80396e:	56                   	push   %esi
+  80396f:	6a 01                	push   $0x1
+  803971:	ff 35 40 b0 80 00    	push   0x80b040
+  803977:	e8 a4 16 00 00       	call   805020 <ipc_call>
+  80397c:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  80397e:	83 c4 20             	add    $0x20,%esp
+  803981:	85 c0                	test   %eax,%eax
+  803983:	0f 88 b8 01 00 00    	js     803b41 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803989:	89 f0                	mov    %esi,%eax
+  80398b:	c1 e8 0c             	shr    $0xc,%eax
+  80398e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803995:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803998:	83 ec 08             	sub    $0x8,%esp
+  80399b:	56                   	push   %esi
+  80399c:	6a 00                	push   $0x0
+  80399e:	e8 2a d4 ff ff       	call   800dcd <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  8039a3:	83 c4 08             	add    $0x8,%esp
+  8039a6:	6a 01                	push   $0x1
+  8039a8:	56                   	push   %esi
+  8039a9:	e8 92 fe ff ff       	call   803840 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  8039ae:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  8039b1:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  8039b7:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  8039ba:	09 fe                	or     %edi,%esi
+  8039bc:	83 ce 01             	or     $0x1,%esi
+  8039bf:	89 30                	mov    %esi,(%eax)
+	return 0;
+  8039c1:	83 c4 10             	add    $0x10,%esp
+}
+  8039c4:	89 d8                	mov    %ebx,%eax
+  8039c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039c9:	5b                   	pop    %ebx
+  8039ca:	5e                   	pop    %esi
+  8039cb:	5f                   	pop    %edi
+  8039cc:	5d                   	pop    %ebp
+  8039cd:	c3                   	ret
+		num_page_reclaims++;
+  8039ce:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  8039d5:	eb ed                	jmp    8039c4 <page_out+0xda>
+		num_page_drops++;
+  8039d7:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  8039de:	83 ec 08             	sub    $0x8,%esp
+  8039e1:	56                   	push   %esi
+  8039e2:	6a 00                	push   $0x0
+  8039e4:	e8 e4 d3 ff ff       	call   800dcd <sys_page_unmap>
+  8039e9:	89 c3                	mov    %eax,%ebx
+  8039eb:	83 c4 10             	add    $0x10,%esp
+  8039ee:	eb d4                	jmp    8039c4 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8039f0:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  8039f2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8039f7:	2d 00 10 00 00       	sub    $0x1000,%eax
+  8039fc:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  8039ff:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803a01:	83 c0 08             	add    $0x8,%eax
+  803a04:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803a07:	b8 07 00 00 00       	mov    $0x7,%eax
+  803a0c:	e8 e5 ef ff ff       	call   8029f6 <page_ring_reserve>
+	first = ring->sq_tail;
+  803a11:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803a16:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803a19:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803a1e:	83 ec 04             	sub    $0x4,%esp
+  803a21:	68 00 10 00 00       	push   $0x1000
+  803a26:	56                   	push   %esi
+  803a27:	89 d8                	mov    %ebx,%eax
+  803a29:	c1 e0 0c             	shl    $0xc,%eax
+  803a2c:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803a31:	50                   	push   %eax
+  803a32:	e8 06 d0 ff ff       	call   800a3d <memcpy>
+		vas[n] = va;
+  803a37:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803a3b:	89 d9                	mov    %ebx,%ecx
+  803a3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a42:	b8 01 00 00 00       	mov    $0x1,%eax
+  803a47:	e8 de ee ff ff       	call   80292a <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803a4c:	8d 43 01             	lea    0x1(%ebx),%eax
+  803a4f:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803a52:	83 c4 10             	add    $0x10,%esp
+  803a55:	83 fb 06             	cmp    $0x6,%ebx
+  803a58:	74 62                	je     803abc <page_out+0x1d2>
+  803a5a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803a5d:	eb 15                	jmp    803a74 <page_out+0x18a>
+			num_page_drops++;
+  803a5f:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  803a66:	83 ec 08             	sub    $0x8,%esp
+  803a69:	56                   	push   %esi
+  803a6a:	6a 00                	push   $0x0
+  803a6c:	e8 5c d3 ff ff       	call   800dcd <sys_page_unmap>
+  803a71:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803a74:	83 ec 08             	sub    $0x8,%esp
+  803a77:	53                   	push   %ebx
+  803a78:	57                   	push   %edi
+  803a79:	e8 99 f8 ff ff       	call   803317 <get_page_choice>
+  803a7e:	89 c6                	mov    %eax,%esi
+  803a80:	83 c4 10             	add    $0x10,%esp
+  803a83:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803a88:	74 32                	je     803abc <page_out+0x1d2>
+  803a8a:	e8 2c ed ff ff       	call   8027bb <page_is_clean>
+  803a8f:	84 c0                	test   %al,%al
+  803a91:	75 cc                	jne    803a5f <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803a93:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803a96:	39 c6                	cmp    %eax,%esi
+  803a98:	72 07                	jb     803aa1 <page_out+0x1b7>
+  803a9a:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803a9d:	39 c6                	cmp    %eax,%esi
+  803a9f:	72 1b                	jb     803abc <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803aa1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803aa6:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803aa9:	eb 03                	jmp    803aae <page_out+0x1c4>
+  803aab:	83 c3 01             	add    $0x1,%ebx
+  803aae:	39 da                	cmp    %ebx,%edx
+  803ab0:	0f 84 68 ff ff ff    	je     803a1e <page_out+0x134>
+  803ab6:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803aba:	75 ef                	jne    803aab <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803abc:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803abf:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803ac2:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803ac5:	e8 a6 ee ff ff       	call   802970 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803aca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803acf:	eb 42                	jmp    803b13 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803ad1:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803ad5:	89 f8                	mov    %edi,%eax
+  803ad7:	c1 e8 0c             	shr    $0xc,%eax
+  803ada:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803ae1:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803ae4:	83 ec 08             	sub    $0x8,%esp
+  803ae7:	57                   	push   %edi
+  803ae8:	6a 00                	push   $0x0
+  803aea:	e8 de d2 ff ff       	call   800dcd <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803aef:	83 c4 08             	add    $0x8,%esp
+  803af2:	6a 01                	push   $0x1
+  803af4:	57                   	push   %edi
+  803af5:	e8 46 fd ff ff       	call   803840 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803afa:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803afd:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803b03:	c1 e6 0c             	shl    $0xc,%esi
+  803b06:	09 d6                	or     %edx,%esi
+  803b08:	83 ce 01             	or     $0x1,%esi
+  803b0b:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803b0d:	83 c3 01             	add    $0x1,%ebx
+  803b10:	83 c4 10             	add    $0x10,%esp
+  803b13:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803b16:	39 c3                	cmp    %eax,%ebx
+  803b18:	74 1d                	je     803b37 <page_out+0x24d>
+		if (res[i] < 0)
+  803b1a:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803b1e:	85 f6                	test   %esi,%esi
+  803b20:	79 af                	jns    803ad1 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803b22:	56                   	push   %esi
+  803b23:	68 84 5c 80 00       	push   $0x805c84
+  803b28:	68 d1 02 00 00       	push   $0x2d1
+  803b2d:	68 9b 59 80 00       	push   $0x80599b
+  803b32:	e8 5c c6 ff ff       	call   800193 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803b37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b3c:	e9 83 fe ff ff       	jmp    8039c4 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803b41:	50                   	push   %eax
+  803b42:	68 84 5c 80 00       	push   $0x805c84
+  803b47:	68 0a 03 00 00       	push   $0x30a
+  803b4c:	68 9b 59 80 00       	push   $0x80599b
+  803b51:	e8 3d c6 ff ff       	call   800193 <_panic>
+		return -E_NO_MEM;
+  803b56:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803b5b:	e9 64 fe ff ff       	jmp    8039c4 <page_out+0xda>
+		return -E_PAGING;
+  803b60:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803b65:	e9 5a fe ff ff       	jmp    8039c4 <page_out+0xda>
+
+00803b6a <page_alloc>:
+{
+  803b6a:	55                   	push   %ebp
+  803b6b:	89 e5                	mov    %esp,%ebp
+  803b6d:	57                   	push   %edi
+  803b6e:	56                   	push   %esi
+  803b6f:	53                   	push   %ebx
+  803b70:	83 ec 0c             	sub    $0xc,%esp
+  803b73:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803b76:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803b79:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803b80:	74 34                	je     803bb6 <page_alloc+0x4c>
+	if (check_mte)
+  803b82:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803b86:	75 35                	jne    803bbd <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803b88:	83 ec 04             	sub    $0x4,%esp
+  803b8b:	ff 75 10             	push   0x10(%ebp)
+  803b8e:	56                   	push   %esi
+  803b8f:	57                   	push   %edi
+  803b90:	e8 b3 d1 ff ff       	call   800d48 <sys_page_alloc>
+  803b95:	89 c3                	mov    %eax,%ebx
+  803b97:	83 c4 10             	add    $0x10,%esp
+  803b9a:	85 c0                	test   %eax,%eax
+  803b9c:	79 52                	jns    803bf0 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803b9e:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803ba1:	75 52                	jne    803bf5 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803ba3:	83 ec 08             	sub    $0x8,%esp
+  803ba6:	56                   	push   %esi
+  803ba7:	57                   	push   %edi
+  803ba8:	e8 3d fd ff ff       	call   8038ea <page_out>
+  803bad:	83 c4 10             	add    $0x10,%esp
+  803bb0:	85 c0                	test   %eax,%eax
+  803bb2:	79 d4                	jns    803b88 <page_alloc+0x1e>
+  803bb4:	eb 3f                	jmp    803bf5 <page_alloc+0x8b>
+		init_map_dir();
+  803bb6:	e8 2f fc ff ff       	call   8037ea <init_map_dir>
+  803bbb:	eb c5                	jmp    803b82 <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803bbd:	83 ec 08             	sub    $0x8,%esp
+  803bc0:	6a 00                	push   $0x0
+  803bc2:	56                   	push   %esi
+  803bc3:	e8 78 fc ff ff       	call   803840 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803bc8:	83 c4 10             	add    $0x10,%esp
+  803bcb:	85 c0                	test   %eax,%eax
+  803bcd:	74 b9                	je     803b88 <page_alloc+0x1e>
+  803bcf:	8b 10                	mov    (%eax),%edx
+  803bd1:	f6 c2 01             	test   $0x1,%dl
+  803bd4:	74 b2                	je     803b88 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803bd6:	83 ec 08             	sub    $0x8,%esp
+  803bd9:	56                   	push   %esi
+  803bda:	52                   	push   %edx
+  803bdb:	50                   	push   %eax
+  803bdc:	68 a8 5c 80 00       	push   $0x805ca8
+  803be1:	68 34 03 00 00       	push   $0x334
+  803be6:	68 9b 59 80 00       	push   $0x80599b
+  803beb:	e8 a3 c5 ff ff       	call   800193 <_panic>
+	return 0;
+  803bf0:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803bf5:	89 d8                	mov    %ebx,%eax
+  803bf7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bfa:	5b                   	pop    %ebx
+  803bfb:	5e                   	pop    %esi
+  803bfc:	5f                   	pop    %edi
+  803bfd:	5d                   	pop    %ebp
+  803bfe:	c3                   	ret
+
+00803bff <page_adopt>:
+{
+  803bff:	55                   	push   %ebp
+  803c00:	89 e5                	mov    %esp,%ebp
+  803c02:	56                   	push   %esi
+  803c03:	53                   	push   %ebx
+  803c04:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803c06:	c1 e8 16             	shr    $0x16,%eax
+  803c09:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803c10:	25 81 00 00 00       	and    $0x81,%eax
+  803c15:	83 f8 01             	cmp    $0x1,%eax
+  803c18:	75 53                	jne    803c6d <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803c1a:	89 d8                	mov    %ebx,%eax
+  803c1c:	c1 e8 0c             	shr    $0xc,%eax
+  803c1f:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803c26:	89 f2                	mov    %esi,%edx
+  803c28:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803c2e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803c33:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803c39:	75 37                	jne    803c72 <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803c3b:	83 ec 08             	sub    $0x8,%esp
+  803c3e:	6a 01                	push   $0x1
+  803c40:	53                   	push   %ebx
+  803c41:	e8 fa fb ff ff       	call   803840 <umapdir_walk>
+  803c46:	83 c4 10             	add    $0x10,%esp
+  803c49:	85 c0                	test   %eax,%eax
+  803c4b:	74 2c                	je     803c79 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803c4d:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803c53:	83 ce 01             	or     $0x1,%esi
+  803c56:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803c58:	83 ec 08             	sub    $0x8,%esp
+  803c5b:	53                   	push   %ebx
+  803c5c:	6a 00                	push   $0x0
+  803c5e:	e8 6a d1 ff ff       	call   800dcd <sys_page_unmap>
+	return 1;
+  803c63:	83 c4 10             	add    $0x10,%esp
+  803c66:	b8 01 00 00 00       	mov    $0x1,%eax
+  803c6b:	eb 05                	jmp    803c72 <page_adopt+0x73>
+		return 0;
+  803c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c75:	5b                   	pop    %ebx
+  803c76:	5e                   	pop    %esi
+  803c77:	5d                   	pop    %ebp
+  803c78:	c3                   	ret
+		return -E_NO_MEM;
+  803c79:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803c7e:	eb f2                	jmp    803c72 <page_adopt+0x73>
+
+00803c80 <page_forget>:
+{
+  803c80:	55                   	push   %ebp
+  803c81:	89 e5                	mov    %esp,%ebp
+  803c83:	53                   	push   %ebx
+  803c84:	83 ec 04             	sub    $0x4,%esp
+  803c87:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803c89:	e8 4a ef ff ff       	call   802bd8 <find_paging_env>
+	if (pagingenv == 0)
+  803c8e:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803c95:	74 39                	je     803cd0 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803c97:	89 d8                	mov    %ebx,%eax
+  803c99:	c1 e8 16             	shr    $0x16,%eax
+  803c9c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803ca3:	25 81 00 00 00       	and    $0x81,%eax
+  803ca8:	83 f8 01             	cmp    $0x1,%eax
+  803cab:	74 28                	je     803cd5 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803cad:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803cb4:	74 1a                	je     803cd0 <page_forget+0x50>
+  803cb6:	83 ec 08             	sub    $0x8,%esp
+  803cb9:	6a 00                	push   $0x0
+  803cbb:	53                   	push   %ebx
+  803cbc:	e8 7f fb ff ff       	call   803840 <umapdir_walk>
+  803cc1:	89 c3                	mov    %eax,%ebx
+  803cc3:	83 c4 10             	add    $0x10,%esp
+  803cc6:	85 c0                	test   %eax,%eax
+  803cc8:	74 06                	je     803cd0 <page_forget+0x50>
+  803cca:	8b 00                	mov    (%eax),%eax
+  803ccc:	a8 01                	test   $0x1,%al
+  803cce:	75 2b                	jne    803cfb <page_forget+0x7b>
+}
+  803cd0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803cd3:	c9                   	leave
+  803cd4:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803cd5:	89 d8                	mov    %ebx,%eax
+  803cd7:	c1 e8 0c             	shr    $0xc,%eax
+  803cda:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803ce1:	89 c2                	mov    %eax,%edx
+  803ce3:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803ce9:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803cef:	75 bc                	jne    803cad <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803cf1:	c1 e8 0c             	shr    $0xc,%eax
+  803cf4:	e8 5c ee ff ff       	call   802b55 <page_remove_slot>
+		return;
+  803cf9:	eb d5                	jmp    803cd0 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803cfb:	c1 e8 0c             	shr    $0xc,%eax
+  803cfe:	e8 52 ee ff ff       	call   802b55 <page_remove_slot>
+	*mte = 0;
+  803d03:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803d09:	eb c5                	jmp    803cd0 <page_forget+0x50>
+
+00803d0b <page_unmap>:
+{
+  803d0b:	55                   	push   %ebp
+  803d0c:	89 e5                	mov    %esp,%ebp
+  803d0e:	57                   	push   %edi
+  803d0f:	56                   	push   %esi
+  803d10:	53                   	push   %ebx
+  803d11:	83 ec 0c             	sub    $0xc,%esp
+  803d14:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803d17:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803d1a:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803d1f:	8b 40 48             	mov    0x48(%eax),%eax
+  803d22:	85 db                	test   %ebx,%ebx
+  803d24:	0f 8e b4 00 00 00    	jle    803dde <page_unmap+0xd3>
+  803d2a:	39 d8                	cmp    %ebx,%eax
+  803d2c:	0f 84 ac 00 00 00    	je     803dde <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803d32:	83 ec 08             	sub    $0x8,%esp
+  803d35:	57                   	push   %edi
+  803d36:	53                   	push   %ebx
+  803d37:	e8 91 d0 ff ff       	call   800dcd <sys_page_unmap>
+  803d3c:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803d3e:	e8 95 ee ff ff       	call   802bd8 <find_paging_env>
+	if (pagingenv == 0)
+  803d43:	83 c4 10             	add    $0x10,%esp
+  803d46:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803d4d:	0f 84 a1 00 00 00    	je     803df4 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803d53:	83 ec 0c             	sub    $0xc,%esp
+  803d56:	6a 05                	push   $0x5
+  803d58:	68 00 00 40 00       	push   $0x400000
+  803d5d:	6a 00                	push   $0x0
+  803d5f:	68 00 b0 ad de       	push   $0xdeadb000
+  803d64:	53                   	push   %ebx
+  803d65:	e8 21 d0 ff ff       	call   800d8b <sys_page_map>
+  803d6a:	83 c4 20             	add    $0x20,%esp
+  803d6d:	85 c0                	test   %eax,%eax
+  803d6f:	0f 88 89 00 00 00    	js     803dfe <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803d75:	89 f8                	mov    %edi,%eax
+  803d77:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803d7a:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803d81:	a8 01                	test   $0x1,%al
+  803d83:	74 6f                	je     803df4 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803d85:	83 ec 0c             	sub    $0xc,%esp
+  803d88:	6a 05                	push   $0x5
+  803d8a:	68 00 00 40 00       	push   $0x400000
+  803d8f:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803d91:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803d96:	50                   	push   %eax
+  803d97:	53                   	push   %ebx
+  803d98:	e8 ee cf ff ff       	call   800d8b <sys_page_map>
+  803d9d:	83 c4 20             	add    $0x20,%esp
+  803da0:	85 c0                	test   %eax,%eax
+  803da2:	78 6f                	js     803e13 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803da4:	c1 ef 0c             	shr    $0xc,%edi
+  803da7:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803dad:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803db4:	01 
+  803db5:	74 3d                	je     803df4 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803db7:	83 ec 08             	sub    $0x8,%esp
+  803dba:	68 00 00 40 00       	push   $0x400000
+  803dbf:	6a 00                	push   $0x0
+  803dc1:	e8 07 d0 ff ff       	call   800dcd <sys_page_unmap>
+  803dc6:	83 c4 10             	add    $0x10,%esp
+  803dc9:	85 c0                	test   %eax,%eax
+  803dcb:	78 5b                	js     803e28 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803dcd:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803dd4:	c1 e8 0c             	shr    $0xc,%eax
+  803dd7:	e8 79 ed ff ff       	call   802b55 <page_remove_slot>
+	return r;
+  803ddc:	eb 16                	jmp    803df4 <page_unmap+0xe9>
+		page_forget(va);
+  803dde:	89 f8                	mov    %edi,%eax
+  803de0:	e8 9b fe ff ff       	call   803c80 <page_forget>
+		return sys_page_unmap(envid, va);
+  803de5:	83 ec 08             	sub    $0x8,%esp
+  803de8:	57                   	push   %edi
+  803de9:	53                   	push   %ebx
+  803dea:	e8 de cf ff ff       	call   800dcd <sys_page_unmap>
+  803def:	89 c6                	mov    %eax,%esi
+  803df1:	83 c4 10             	add    $0x10,%esp
+}
+  803df4:	89 f0                	mov    %esi,%eax
+  803df6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803df9:	5b                   	pop    %ebx
+  803dfa:	5e                   	pop    %esi
+  803dfb:	5f                   	pop    %edi
+  803dfc:	5d                   	pop    %ebp
+  803dfd:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803dfe:	50                   	push   %eax
+  803dff:	68 e4 5c 80 00       	push   $0x805ce4
+  803e04:	68 e4 03 00 00       	push   $0x3e4
+  803e09:	68 9b 59 80 00       	push   $0x80599b
+  803e0e:	e8 80 c3 ff ff       	call   800193 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803e13:	50                   	push   %eax
+  803e14:	68 10 5d 80 00       	push   $0x805d10
+  803e19:	68 ea 03 00 00       	push   $0x3ea
+  803e1e:	68 9b 59 80 00       	push   $0x80599b
+  803e23:	e8 6b c3 ff ff       	call   800193 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803e28:	50                   	push   %eax
+  803e29:	68 3c 5d 80 00       	push   $0x805d3c
+  803e2e:	68 ef 03 00 00       	push   $0x3ef
+  803e33:	68 9b 59 80 00       	push   $0x80599b
+  803e38:	e8 56 c3 ff ff       	call   800193 <_panic>
+
+00803e3d <page_unmap_range>:
+{
+  803e3d:	55                   	push   %ebp
+  803e3e:	89 e5                	mov    %esp,%ebp
+  803e40:	57                   	push   %edi
+  803e41:	56                   	push   %esi
+  803e42:	53                   	push   %ebx
+  803e43:	83 ec 0c             	sub    $0xc,%esp
+  803e46:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803e49:	e8 8a ed ff ff       	call   802bd8 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803e4e:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803e53:	8b 40 48             	mov    0x48(%eax),%eax
+  803e56:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803e5a:	7e 38                	jle    803e94 <page_unmap_range+0x57>
+  803e5c:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803e5f:	74 33                	je     803e94 <page_unmap_range+0x57>
+  803e61:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803e68:	74 2a                	je     803e94 <page_unmap_range+0x57>
+  803e6a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  803e6d:	be 00 00 00 00       	mov    $0x0,%esi
+  803e72:	39 fe                	cmp    %edi,%esi
+  803e74:	74 56                	je     803ecc <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  803e76:	83 ec 08             	sub    $0x8,%esp
+  803e79:	53                   	push   %ebx
+  803e7a:	ff 75 08             	push   0x8(%ebp)
+  803e7d:	e8 89 fe ff ff       	call   803d0b <page_unmap>
+  803e82:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803e88:	83 c4 10             	add    $0x10,%esp
+  803e8b:	85 c0                	test   %eax,%eax
+  803e8d:	78 35                	js     803ec4 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  803e8f:	83 c6 01             	add    $0x1,%esi
+  803e92:	eb de                	jmp    803e72 <page_unmap_range+0x35>
+  803e94:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803e97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e9c:	eb 10                	jmp    803eae <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803e9e:	89 f0                	mov    %esi,%eax
+  803ea0:	e8 db fd ff ff       	call   803c80 <page_forget>
+		for (i = 0; i < npages; i++)
+  803ea5:	83 c3 01             	add    $0x1,%ebx
+  803ea8:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803eae:	39 fb                	cmp    %edi,%ebx
+  803eb0:	75 ec                	jne    803e9e <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  803eb2:	83 ec 04             	sub    $0x4,%esp
+  803eb5:	57                   	push   %edi
+  803eb6:	ff 75 0c             	push   0xc(%ebp)
+  803eb9:	ff 75 08             	push   0x8(%ebp)
+  803ebc:	e8 20 d0 ff ff       	call   800ee1 <sys_page_unmap_range>
+  803ec1:	83 c4 10             	add    $0x10,%esp
+}
+  803ec4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ec7:	5b                   	pop    %ebx
+  803ec8:	5e                   	pop    %esi
+  803ec9:	5f                   	pop    %edi
+  803eca:	5d                   	pop    %ebp
+  803ecb:	c3                   	ret
+	return 0;
+  803ecc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ed1:	eb f1                	jmp    803ec4 <page_unmap_range+0x87>
+
+00803ed3 <page_alloc_range>:
+{
+  803ed3:	55                   	push   %ebp
+  803ed4:	89 e5                	mov    %esp,%ebp
+  803ed6:	57                   	push   %edi
+  803ed7:	56                   	push   %esi
+  803ed8:	53                   	push   %ebx
+  803ed9:	83 ec 1c             	sub    $0x1c,%esp
+  803edc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803edf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  803ee2:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803ee9:	74 14                	je     803eff <page_alloc_range+0x2c>
+	if (check_mte)
+  803eeb:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803eef:	74 66                	je     803f57 <page_alloc_range+0x84>
+  803ef1:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  803ef3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef8:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803efb:	89 c7                	mov    %eax,%edi
+  803efd:	eb 10                	jmp    803f0f <page_alloc_range+0x3c>
+		init_map_dir();
+  803eff:	e8 e6 f8 ff ff       	call   8037ea <init_map_dir>
+  803f04:	eb e5                	jmp    803eeb <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803f06:	83 c7 01             	add    $0x1,%edi
+  803f09:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803f0f:	39 df                	cmp    %ebx,%edi
+  803f11:	74 38                	je     803f4b <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  803f13:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803f16:	83 ec 08             	sub    $0x8,%esp
+  803f19:	6a 00                	push   $0x0
+  803f1b:	56                   	push   %esi
+  803f1c:	e8 1f f9 ff ff       	call   803840 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  803f21:	83 c4 10             	add    $0x10,%esp
+  803f24:	85 c0                	test   %eax,%eax
+  803f26:	74 de                	je     803f06 <page_alloc_range+0x33>
+  803f28:	8b 10                	mov    (%eax),%edx
+  803f2a:	f6 c2 01             	test   $0x1,%dl
+  803f2d:	74 d7                	je     803f06 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  803f2f:	83 ec 08             	sub    $0x8,%esp
+  803f32:	ff 75 e4             	push   -0x1c(%ebp)
+  803f35:	52                   	push   %edx
+  803f36:	50                   	push   %eax
+  803f37:	68 a8 5c 80 00       	push   $0x805ca8
+  803f3c:	68 0b 04 00 00       	push   $0x40b
+  803f41:	68 9b 59 80 00       	push   $0x80599b
+  803f46:	e8 48 c2 ff ff       	call   800193 <_panic>
+  803f4b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803f4e:	eb 07                	jmp    803f57 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  803f50:	c1 e0 0c             	shl    $0xc,%eax
+  803f53:	01 c7                	add    %eax,%edi
+			npages -= r;
+  803f55:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  803f57:	85 db                	test   %ebx,%ebx
+  803f59:	74 30                	je     803f8b <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  803f5b:	ff 75 14             	push   0x14(%ebp)
+  803f5e:	53                   	push   %ebx
+  803f5f:	57                   	push   %edi
+  803f60:	ff 75 08             	push   0x8(%ebp)
+  803f63:	e8 0b cf ff ff       	call   800e73 <sys_page_alloc_range>
+  803f68:	89 c6                	mov    %eax,%esi
+  803f6a:	83 c4 10             	add    $0x10,%esp
+  803f6d:	85 c0                	test   %eax,%eax
+  803f6f:	7f df                	jg     803f50 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  803f71:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  803f74:	75 1a                	jne    803f90 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  803f76:	83 ec 08             	sub    $0x8,%esp
+  803f79:	57                   	push   %edi
+  803f7a:	ff 75 08             	push   0x8(%ebp)
+  803f7d:	e8 68 f9 ff ff       	call   8038ea <page_out>
+  803f82:	83 c4 10             	add    $0x10,%esp
+  803f85:	85 c0                	test   %eax,%eax
+  803f87:	79 ce                	jns    803f57 <page_alloc_range+0x84>
+  803f89:	eb 05                	jmp    803f90 <page_alloc_range+0xbd>
+	return 0;
+  803f8b:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803f90:	89 f0                	mov    %esi,%eax
+  803f92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f95:	5b                   	pop    %ebx
+  803f96:	5e                   	pop    %esi
+  803f97:	5f                   	pop    %edi
+  803f98:	5d                   	pop    %ebp
+  803f99:	c3                   	ret
+
+00803f9a <page_in>:
+{
+  803f9a:	55                   	push   %ebp
+  803f9b:	89 e5                	mov    %esp,%ebp
+  803f9d:	57                   	push   %edi
+  803f9e:	56                   	push   %esi
+  803f9f:	53                   	push   %ebx
+  803fa0:	83 ec 3c             	sub    $0x3c,%esp
+  803fa3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  803fa6:	e8 2d ec ff ff       	call   802bd8 <find_paging_env>
+	if (pagingenv == 0)
+  803fab:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803fb2:	0f 84 09 02 00 00    	je     8041c1 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  803fb8:	83 ec 08             	sub    $0x8,%esp
+  803fbb:	6a 00                	push   $0x0
+  803fbd:	56                   	push   %esi
+  803fbe:	e8 7d f8 ff ff       	call   803840 <umapdir_walk>
+  803fc3:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803fc5:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803fcb:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  803fce:	83 c4 10             	add    $0x10,%esp
+  803fd1:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803fd5:	74 0d                	je     803fe4 <page_in+0x4a>
+  803fd7:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803fdc:	8b 40 48             	mov    0x48(%eax),%eax
+  803fdf:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803fe2:	75 06                	jne    803fea <page_in+0x50>
+  803fe4:	8b 03                	mov    (%ebx),%eax
+  803fe6:	a8 02                	test   $0x2,%al
+  803fe8:	75 63                	jne    80404d <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  803fea:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803fec:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803fee:	89 f0                	mov    %esi,%eax
+  803ff0:	25 06 0e 00 00       	and    $0xe06,%eax
+  803ff5:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803ff8:	50                   	push   %eax
+  803ff9:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803ffc:	57                   	push   %edi
+  803ffd:	ff 75 08             	push   0x8(%ebp)
+  804000:	e8 65 fb ff ff       	call   803b6a <page_alloc>
+  804005:	83 c4 10             	add    $0x10,%esp
+  804008:	85 c0                	test   %eax,%eax
+  80400a:	78 39                	js     804045 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  80400c:	89 f0                	mov    %esi,%eax
+  80400e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  804011:	83 ec 0c             	sub    $0xc,%esp
+  804014:	6a 07                	push   $0x7
+  804016:	6a 01                	push   $0x1
+  804018:	57                   	push   %edi
+  804019:	c1 e0 04             	shl    $0x4,%eax
+  80401c:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  80401d:	c1 ee 1c             	shr    $0x1c,%esi
+  804020:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  804023:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  80402a:	e8 f1 0f 00 00       	call   805020 <ipc_call>
+  80402f:	83 c4 20             	add    $0x20,%esp
+  804032:	85 c0                	test   %eax,%eax
+  804034:	0f 88 72 01 00 00    	js     8041ac <page_in+0x212>
+	*mte = 0;
+  80403a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  804040:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804045:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804048:	5b                   	pop    %ebx
+  804049:	5e                   	pop    %esi
+  80404a:	5f                   	pop    %edi
+  80404b:	5d                   	pop    %ebp
+  80404c:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  80404d:	25 06 0e 00 00       	and    $0xe06,%eax
+  804052:	83 c8 01             	or     $0x1,%eax
+  804055:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  804058:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  80405b:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80405e:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  804064:	be 01 00 00 00       	mov    $0x1,%esi
+  804069:	eb 46                	jmp    8040b1 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  80406b:	83 ec 08             	sub    $0x8,%esp
+  80406e:	6a 00                	push   $0x0
+  804070:	51                   	push   %ecx
+  804071:	e8 ca f7 ff ff       	call   803840 <umapdir_walk>
+  804076:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  80407a:	83 c4 10             	add    $0x10,%esp
+  80407d:	85 c0                	test   %eax,%eax
+  80407f:	74 66                	je     8040e7 <page_in+0x14d>
+  804081:	8b 00                	mov    (%eax),%eax
+  804083:	a8 01                	test   $0x1,%al
+  804085:	74 60                	je     8040e7 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  804087:	89 c2                	mov    %eax,%edx
+  804089:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  80408f:	83 ca 01             	or     $0x1,%edx
+  804092:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  804095:	75 50                	jne    8040e7 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  804097:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80409d:	c1 e8 1c             	shr    $0x1c,%eax
+  8040a0:	8b 13                	mov    (%ebx),%edx
+  8040a2:	c1 ea 1c             	shr    $0x1c,%edx
+  8040a5:	39 d0                	cmp    %edx,%eax
+  8040a7:	75 3e                	jne    8040e7 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  8040a9:	83 c6 01             	add    $0x1,%esi
+  8040ac:	83 fe 08             	cmp    $0x8,%esi
+  8040af:	74 3f                	je     8040f0 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  8040b1:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8040b3:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  8040b9:	77 2c                	ja     8040e7 <page_in+0x14d>
+  8040bb:	89 f8                	mov    %edi,%eax
+  8040bd:	c1 e8 16             	shr    $0x16,%eax
+  8040c0:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8040c7:	f6 c2 01             	test   $0x1,%dl
+  8040ca:	74 9f                	je     80406b <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  8040cc:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8040d3:	a8 80                	test   $0x80,%al
+  8040d5:	75 10                	jne    8040e7 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  8040d7:	89 f8                	mov    %edi,%eax
+  8040d9:	c1 e8 0c             	shr    $0xc,%eax
+  8040dc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8040e3:	a8 01                	test   $0x1,%al
+  8040e5:	74 84                	je     80406b <page_in+0xd1>
+	if (n == 1)
+  8040e7:	83 fe 01             	cmp    $0x1,%esi
+  8040ea:	0f 84 fa fe ff ff    	je     803fea <page_in+0x50>
+	req.nslots = n;
+  8040f0:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  8040f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040fb:	eb 13                	jmp    804110 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  8040fd:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  804101:	8b 12                	mov    (%edx),%edx
+  804103:	c1 ea 0c             	shr    $0xc,%edx
+  804106:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  80410d:	83 c0 01             	add    $0x1,%eax
+  804110:	39 c6                	cmp    %eax,%esi
+  804112:	75 e9                	jne    8040fd <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  804114:	83 ec 0c             	sub    $0xc,%esp
+  804117:	6a 00                	push   $0x0
+  804119:	ff 75 c0             	push   -0x40(%ebp)
+  80411c:	56                   	push   %esi
+  80411d:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804120:	57                   	push   %edi
+  804121:	6a 00                	push   $0x0
+  804123:	e8 ab fd ff ff       	call   803ed3 <page_alloc_range>
+  804128:	83 c4 20             	add    $0x20,%esp
+  80412b:	85 c0                	test   %eax,%eax
+  80412d:	78 6e                	js     80419d <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  80412f:	83 ec 04             	sub    $0x4,%esp
+  804132:	6a 24                	push   $0x24
+  804134:	68 00 80 80 00       	push   $0x808000
+  804139:	57                   	push   %edi
+  80413a:	e8 9c c8 ff ff       	call   8009db <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  80413f:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  804146:	56                   	push   %esi
+  804147:	57                   	push   %edi
+  804148:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  80414a:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  804151:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804154:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  80415b:	e8 c0 0e 00 00       	call   805020 <ipc_call>
+  804160:	83 c4 20             	add    $0x20,%esp
+  804163:	85 c0                	test   %eax,%eax
+  804165:	78 08                	js     80416f <page_in+0x1d5>
+  804167:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80416a:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  80416d:	eb 20                	jmp    80418f <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  80416f:	50                   	push   %eax
+  804170:	68 68 5d 80 00       	push   $0x805d68
+  804175:	68 59 02 00 00       	push   $0x259
+  80417a:	68 9b 59 80 00       	push   $0x80599b
+  80417f:	e8 0f c0 ff ff       	call   800193 <_panic>
+		*mtes[i] = 0;
+  804184:	8b 10                	mov    (%eax),%edx
+  804186:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  80418c:	83 c0 04             	add    $0x4,%eax
+  80418f:	39 c8                	cmp    %ecx,%eax
+  804191:	75 f1                	jne    804184 <page_in+0x1ea>
+	return n;
+  804193:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  804195:	85 f6                	test   %esi,%esi
+  804197:	0f 84 4d fe ff ff    	je     803fea <page_in+0x50>
+		return r < 0 ? r : 0;
+  80419d:	85 c0                	test   %eax,%eax
+  80419f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041a4:	0f 4f c2             	cmovg  %edx,%eax
+  8041a7:	e9 99 fe ff ff       	jmp    804045 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  8041ac:	50                   	push   %eax
+  8041ad:	68 a0 5d 80 00       	push   $0x805da0
+  8041b2:	68 9a 02 00 00       	push   $0x29a
+  8041b7:	68 9b 59 80 00       	push   $0x80599b
+  8041bc:	e8 d2 bf ff ff       	call   800193 <_panic>
+		return -E_PAGING;
+  8041c1:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8041c6:	e9 7a fe ff ff       	jmp    804045 <page_in+0xab>
+
+008041cb <page_map>:
+{
+  8041cb:	55                   	push   %ebp
+  8041cc:	89 e5                	mov    %esp,%ebp
+  8041ce:	57                   	push   %edi
+  8041cf:	56                   	push   %esi
+  8041d0:	53                   	push   %ebx
+  8041d1:	83 ec 1c             	sub    $0x1c,%esp
+  8041d4:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8041d7:	83 ec 0c             	sub    $0xc,%esp
+  8041da:	ff 75 18             	push   0x18(%ebp)
+  8041dd:	ff 75 14             	push   0x14(%ebp)
+  8041e0:	ff 75 10             	push   0x10(%ebp)
+  8041e3:	ff 75 0c             	push   0xc(%ebp)
+  8041e6:	56                   	push   %esi
+  8041e7:	e8 9f cb ff ff       	call   800d8b <sys_page_map>
+  8041ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8041ef:	83 c4 20             	add    $0x20,%esp
+  8041f2:	85 c0                	test   %eax,%eax
+  8041f4:	0f 89 a9 01 00 00    	jns    8043a3 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  8041fa:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  8041fe:	74 5f                	je     80425f <page_map+0x94>
+		if (r != -E_INVAL)
+  804200:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  804204:	0f 85 a0 01 00 00    	jne    8043aa <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  80420a:	85 f6                	test   %esi,%esi
+  80420c:	74 70                	je     80427e <page_map+0xb3>
+  80420e:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804213:	8b 40 48             	mov    0x48(%eax),%eax
+  804216:	39 f0                	cmp    %esi,%eax
+  804218:	74 64                	je     80427e <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80421a:	83 ec 0c             	sub    $0xc,%esp
+  80421d:	6a 05                	push   $0x5
+  80421f:	68 00 00 40 00       	push   $0x400000
+  804224:	6a 00                	push   $0x0
+  804226:	68 00 b0 ad de       	push   $0xdeadb000
+  80422b:	56                   	push   %esi
+  80422c:	e8 5a cb ff ff       	call   800d8b <sys_page_map>
+  804231:	89 c3                	mov    %eax,%ebx
+  804233:	83 c4 20             	add    $0x20,%esp
+  804236:	85 c0                	test   %eax,%eax
+  804238:	79 6a                	jns    8042a4 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  80423a:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80423d:	75 50                	jne    80428f <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  80423f:	83 ec 08             	sub    $0x8,%esp
+  804242:	68 00 00 40 00       	push   $0x400000
+  804247:	6a fc                	push   $0xfffffffc
+  804249:	e8 9c f6 ff ff       	call   8038ea <page_out>
+  80424e:	83 c4 10             	add    $0x10,%esp
+  804251:	85 c0                	test   %eax,%eax
+  804253:	79 c5                	jns    80421a <page_map+0x4f>
+}
+  804255:	89 d8                	mov    %ebx,%eax
+  804257:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80425a:	5b                   	pop    %ebx
+  80425b:	5e                   	pop    %esi
+  80425c:	5f                   	pop    %edi
+  80425d:	5d                   	pop    %ebp
+  80425e:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  80425f:	83 ec 08             	sub    $0x8,%esp
+  804262:	68 00 00 40 00       	push   $0x400000
+  804267:	6a 00                	push   $0x0
+  804269:	e8 7c f6 ff ff       	call   8038ea <page_out>
+  80426e:	83 c4 10             	add    $0x10,%esp
+  804271:	85 c0                	test   %eax,%eax
+  804273:	0f 89 5e ff ff ff    	jns    8041d7 <page_map+0xc>
+				return r;
+  804279:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80427c:	eb d7                	jmp    804255 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  80427e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804281:	e8 79 f9 ff ff       	call   803bff <page_adopt>
+  804286:	85 c0                	test   %eax,%eax
+  804288:	79 90                	jns    80421a <page_map+0x4f>
+			return r;
+  80428a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80428d:	eb c6                	jmp    804255 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  80428f:	53                   	push   %ebx
+  804290:	68 d4 5d 80 00       	push   $0x805dd4
+  804295:	68 77 03 00 00       	push   $0x377
+  80429a:	68 9b 59 80 00       	push   $0x80599b
+  80429f:	e8 ef be ff ff       	call   800193 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  8042a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8042a7:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8042aa:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  8042b1:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8042b7:	0f 84 f5 00 00 00    	je     8043b2 <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8042bd:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8042c3:	83 ec 0c             	sub    $0xc,%esp
+  8042c6:	6a 05                	push   $0x5
+  8042c8:	68 00 00 40 00       	push   $0x400000
+  8042cd:	6a 00                	push   $0x0
+  8042cf:	57                   	push   %edi
+  8042d0:	56                   	push   %esi
+  8042d1:	e8 b5 ca ff ff       	call   800d8b <sys_page_map>
+  8042d6:	89 c3                	mov    %eax,%ebx
+  8042d8:	83 c4 20             	add    $0x20,%esp
+  8042db:	85 c0                	test   %eax,%eax
+  8042dd:	79 35                	jns    804314 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  8042df:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8042e2:	75 1b                	jne    8042ff <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8042e4:	83 ec 08             	sub    $0x8,%esp
+  8042e7:	68 00 00 40 00       	push   $0x400000
+  8042ec:	6a 00                	push   $0x0
+  8042ee:	e8 f7 f5 ff ff       	call   8038ea <page_out>
+  8042f3:	83 c4 10             	add    $0x10,%esp
+  8042f6:	85 c0                	test   %eax,%eax
+  8042f8:	79 c9                	jns    8042c3 <page_map+0xf8>
+  8042fa:	e9 56 ff ff ff       	jmp    804255 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  8042ff:	53                   	push   %ebx
+  804300:	68 fc 5d 80 00       	push   $0x805dfc
+  804305:	68 83 03 00 00       	push   $0x383
+  80430a:	68 9b 59 80 00       	push   $0x80599b
+  80430f:	e8 7f be ff ff       	call   800193 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  804314:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804317:	c1 e8 0c             	shr    $0xc,%eax
+  80431a:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  80431f:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  804326:	01 
+  804327:	0f 84 8d 00 00 00    	je     8043ba <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  80432d:	83 ec 08             	sub    $0x8,%esp
+  804330:	68 00 00 40 00       	push   $0x400000
+  804335:	6a 00                	push   $0x0
+  804337:	e8 91 ca ff ff       	call   800dcd <sys_page_unmap>
+  80433c:	83 c4 10             	add    $0x10,%esp
+  80433f:	85 c0                	test   %eax,%eax
+  804341:	78 36                	js     804379 <page_map+0x1ae>
+  804343:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  804346:	83 ec 08             	sub    $0x8,%esp
+  804349:	57                   	push   %edi
+  80434a:	56                   	push   %esi
+  80434b:	e8 4a fc ff ff       	call   803f9a <page_in>
+  804350:	89 c3                	mov    %eax,%ebx
+  804352:	83 c4 10             	add    $0x10,%esp
+  804355:	85 c0                	test   %eax,%eax
+  804357:	0f 89 7a fe ff ff    	jns    8041d7 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  80435d:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804360:	75 2c                	jne    80438e <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  804362:	83 ec 08             	sub    $0x8,%esp
+  804365:	57                   	push   %edi
+  804366:	6a 00                	push   $0x0
+  804368:	e8 7d f5 ff ff       	call   8038ea <page_out>
+  80436d:	83 c4 10             	add    $0x10,%esp
+  804370:	85 c0                	test   %eax,%eax
+  804372:	79 d2                	jns    804346 <page_map+0x17b>
+  804374:	e9 dc fe ff ff       	jmp    804255 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  804379:	50                   	push   %eax
+  80437a:	68 28 5e 80 00       	push   $0x805e28
+  80437f:	68 8b 03 00 00       	push   $0x38b
+  804384:	68 9b 59 80 00       	push   $0x80599b
+  804389:	e8 05 be ff ff       	call   800193 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  80438e:	53                   	push   %ebx
+  80438f:	68 50 5e 80 00       	push   $0x805e50
+  804394:	68 91 03 00 00       	push   $0x391
+  804399:	68 9b 59 80 00       	push   $0x80599b
+  80439e:	e8 f0 bd ff ff       	call   800193 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8043a3:	89 c3                	mov    %eax,%ebx
+  8043a5:	e9 ab fe ff ff       	jmp    804255 <page_map+0x8a>
+  8043aa:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8043ad:	e9 a3 fe ff ff       	jmp    804255 <page_map+0x8a>
+			return r; // Pass through the error
+  8043b2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8043b5:	e9 9b fe ff ff       	jmp    804255 <page_map+0x8a>
+			return r; // Pass through the error
+  8043ba:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8043bd:	e9 93 fe ff ff       	jmp    804255 <page_map+0x8a>
+
+008043c2 <page_map_range>:
+{
+  8043c2:	55                   	push   %ebp
+  8043c3:	89 e5                	mov    %esp,%ebp
+  8043c5:	57                   	push   %edi
+  8043c6:	56                   	push   %esi
+  8043c7:	53                   	push   %ebx
+  8043c8:	83 ec 0c             	sub    $0xc,%esp
+  8043cb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8043ce:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  8043d1:	83 ec 08             	sub    $0x8,%esp
+  8043d4:	ff 75 1c             	push   0x1c(%ebp)
+  8043d7:	ff 75 18             	push   0x18(%ebp)
+  8043da:	56                   	push   %esi
+  8043db:	ff 75 10             	push   0x10(%ebp)
+  8043de:	57                   	push   %edi
+  8043df:	ff 75 08             	push   0x8(%ebp)
+  8043e2:	e8 af ca ff ff       	call   800e96 <sys_page_map_range>
+  8043e7:	89 c3                	mov    %eax,%ebx
+  8043e9:	83 c4 20             	add    $0x20,%esp
+  8043ec:	85 c0                	test   %eax,%eax
+  8043ee:	79 1b                	jns    80440b <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  8043f0:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8043f3:	75 20                	jne    804415 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8043f5:	83 ec 08             	sub    $0x8,%esp
+  8043f8:	68 00 00 40 00       	push   $0x400000
+  8043fd:	6a 00                	push   $0x0
+  8043ff:	e8 e6 f4 ff ff       	call   8038ea <page_out>
+  804404:	83 c4 10             	add    $0x10,%esp
+  804407:	85 c0                	test   %eax,%eax
+  804409:	79 c6                	jns    8043d1 <page_map_range+0xf>
+}
+  80440b:	89 d8                	mov    %ebx,%eax
+  80440d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804410:	5b                   	pop    %ebx
+  804411:	5e                   	pop    %esi
+  804412:	5f                   	pop    %edi
+  804413:	5d                   	pop    %ebp
+  804414:	c3                   	ret
+		if (r != -E_INVAL)
+  804415:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  804418:	75 f1                	jne    80440b <page_map_range+0x49>
+  80441a:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  80441c:	be 00 00 00 00       	mov    $0x0,%esi
+  804421:	eb 03                	jmp    804426 <page_map_range+0x64>
+  804423:	83 c6 01             	add    $0x1,%esi
+  804426:	3b 75 18             	cmp    0x18(%ebp),%esi
+  804429:	74 2a                	je     804455 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  80442b:	83 ec 0c             	sub    $0xc,%esp
+  80442e:	ff 75 1c             	push   0x1c(%ebp)
+  804431:	53                   	push   %ebx
+  804432:	ff 75 10             	push   0x10(%ebp)
+  804435:	57                   	push   %edi
+  804436:	ff 75 08             	push   0x8(%ebp)
+  804439:	e8 8d fd ff ff       	call   8041cb <page_map>
+  80443e:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804444:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80444a:	83 c4 20             	add    $0x20,%esp
+  80444d:	85 c0                	test   %eax,%eax
+  80444f:	79 d2                	jns    804423 <page_map_range+0x61>
+  804451:	89 c3                	mov    %eax,%ebx
+  804453:	eb b6                	jmp    80440b <page_map_range+0x49>
+		return 0;
+  804455:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80445a:	eb af                	jmp    80440b <page_map_range+0x49>
+
+0080445c <paging_pgfault_handler>:
+{
+  80445c:	55                   	push   %ebp
+  80445d:	89 e5                	mov    %esp,%ebp
+  80445f:	56                   	push   %esi
+  804460:	53                   	push   %ebx
+  804461:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  804464:	e8 6f e7 ff ff       	call   802bd8 <find_paging_env>
+	if (pagingenv == 0)
+  804469:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80446e:	85 c0                	test   %eax,%eax
+  804470:	74 3c                	je     8044ae <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  804472:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804474:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804478:	75 12                	jne    80448c <paging_pgfault_handler+0x30>
+  80447a:	89 f0                	mov    %esi,%eax
+  80447c:	e8 7e f7 ff ff       	call   803bff <page_adopt>
+  804481:	89 c2                	mov    %eax,%edx
+		return 0;
+  804483:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804488:	85 d2                	test   %edx,%edx
+  80448a:	78 22                	js     8044ae <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  80448c:	83 ec 08             	sub    $0x8,%esp
+  80448f:	6a 00                	push   $0x0
+  804491:	56                   	push   %esi
+  804492:	e8 a9 f3 ff ff       	call   803840 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  804497:	83 c4 10             	add    $0x10,%esp
+  80449a:	85 c0                	test   %eax,%eax
+  80449c:	74 05                	je     8044a3 <paging_pgfault_handler+0x47>
+  80449e:	f6 00 01             	testb  $0x1,(%eax)
+  8044a1:	75 12                	jne    8044b5 <paging_pgfault_handler+0x59>
+	return 0;
+  8044a3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8044a8:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8044ac:	74 23                	je     8044d1 <paging_pgfault_handler+0x75>
+}
+  8044ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8044b1:	5b                   	pop    %ebx
+  8044b2:	5e                   	pop    %esi
+  8044b3:	5d                   	pop    %ebp
+  8044b4:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  8044b5:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8044ba:	8b 40 48             	mov    0x48(%eax),%eax
+  8044bd:	83 ec 08             	sub    $0x8,%esp
+  8044c0:	56                   	push   %esi
+  8044c1:	50                   	push   %eax
+  8044c2:	e8 d3 fa ff ff       	call   803f9a <page_in>
+  8044c7:	f7 d0                	not    %eax
+  8044c9:	c1 e8 1f             	shr    $0x1f,%eax
+  8044cc:	83 c4 10             	add    $0x10,%esp
+  8044cf:	eb dd                	jmp    8044ae <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8044d1:	89 f0                	mov    %esi,%eax
+  8044d3:	e8 97 e2 ff ff       	call   80276f <segment_lookup>
+  8044d8:	89 c2                	mov    %eax,%edx
+	return 0;
+  8044da:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8044df:	85 d2                	test   %edx,%edx
+  8044e1:	74 cb                	je     8044ae <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  8044e3:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8044e8:	8b 40 48             	mov    0x48(%eax),%eax
+  8044eb:	83 ec 08             	sub    $0x8,%esp
+  8044ee:	56                   	push   %esi
+  8044ef:	50                   	push   %eax
+  8044f0:	e8 f5 f3 ff ff       	call   8038ea <page_out>
+  8044f5:	f7 d0                	not    %eax
+  8044f7:	c1 e8 1f             	shr    $0x1f,%eax
+  8044fa:	83 c4 10             	add    $0x10,%esp
+  8044fd:	eb af                	jmp    8044ae <paging_pgfault_handler+0x52>
+
+008044ff <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  8044ff:	55                   	push   %ebp
+  804500:	89 e5                	mov    %esp,%ebp
+  804502:	57                   	push   %edi
+  804503:	56                   	push   %esi
+  804504:	53                   	push   %ebx
+  804505:	83 ec 2c             	sub    $0x2c,%esp
+  804508:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  80450b:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  804510:	89 c1                	mov    %eax,%ecx
+  804512:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  804515:	c1 e8 11             	shr    $0x11,%eax
+  804518:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80451b:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  804522:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  804525:	b8 01 00 00 00       	mov    $0x1,%eax
+  80452a:	d3 e0                	shl    %cl,%eax
+  80452c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80452f:	85 c7                	test   %eax,%edi
+  804531:	74 12                	je     804545 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804533:	bb 01 00 00 00       	mov    $0x1,%ebx
+  804538:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  80453b:	bf 01 00 00 00       	mov    $0x1,%edi
+  804540:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804543:	eb 17                	jmp    80455c <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  804545:	ff 75 e0             	push   -0x20(%ebp)
+  804548:	68 88 5e 80 00       	push   $0x805e88
+  80454d:	6a 48                	push   $0x48
+  80454f:	68 a2 5e 80 00       	push   $0x805ea2
+  804554:	e8 3a bc ff ff       	call   800193 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804559:	83 c3 01             	add    $0x1,%ebx
+  80455c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80455f:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  804562:	89 c8                	mov    %ecx,%eax
+  804564:	c1 e8 05             	shr    $0x5,%eax
+  804567:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  80456e:	89 fe                	mov    %edi,%esi
+  804570:	d3 e6                	shl    %cl,%esi
+  804572:	89 f1                	mov    %esi,%ecx
+  804574:	85 d6                	test   %edx,%esi
+  804576:	74 e1                	je     804559 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  804578:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  80457b:	f7 d6                	not    %esi
+  80457d:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804580:	21 fe                	and    %edi,%esi
+  804582:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804585:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  80458c:	f7 d1                	not    %ecx
+  80458e:	21 d1                	and    %edx,%ecx
+  804590:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804597:	83 ec 04             	sub    $0x4,%esp
+  80459a:	53                   	push   %ebx
+  80459b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80459e:	57                   	push   %edi
+  80459f:	6a 00                	push   $0x0
+  8045a1:	e8 97 f8 ff ff       	call   803e3d <page_unmap_range>
+	va_free(va, n);
+  8045a6:	83 c4 08             	add    $0x8,%esp
+  8045a9:	53                   	push   %ebx
+  8045aa:	57                   	push   %edi
+  8045ab:	e8 ed 05 00 00       	call   804b9d <va_free>
+}
+  8045b0:	83 c4 10             	add    $0x10,%esp
+  8045b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045b6:	5b                   	pop    %ebx
+  8045b7:	5e                   	pop    %esi
+  8045b8:	5f                   	pop    %edi
+  8045b9:	5d                   	pop    %ebp
+  8045ba:	c3                   	ret
+
+008045bb <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  8045bb:	55                   	push   %ebp
+  8045bc:	89 e5                	mov    %esp,%ebp
+  8045be:	57                   	push   %edi
+  8045bf:	56                   	push   %esi
+  8045c0:	53                   	push   %ebx
+  8045c1:	83 ec 1c             	sub    $0x1c,%esp
+  8045c4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  8045c7:	85 db                	test   %ebx,%ebx
+  8045c9:	74 34                	je     8045ff <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  8045cb:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8045d1:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  8045d6:	77 2f                	ja     804607 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  8045d8:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8045de:	75 51                	jne    804631 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  8045e0:	89 c1                	mov    %eax,%ecx
+  8045e2:	c1 e9 0c             	shr    $0xc,%ecx
+  8045e5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8045ea:	d3 e2                	shl    %cl,%edx
+  8045ec:	c1 e8 11             	shr    $0x11,%eax
+  8045ef:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  8045f6:	75 24                	jne    80461c <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  8045f8:	89 d8                	mov    %ebx,%eax
+  8045fa:	e8 00 ff ff ff       	call   8044ff <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  8045ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804602:	5b                   	pop    %ebx
+  804603:	5e                   	pop    %esi
+  804604:	5f                   	pop    %edi
+  804605:	5d                   	pop    %ebp
+  804606:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  804607:	53                   	push   %ebx
+  804608:	68 af 5e 80 00       	push   $0x805eaf
+  80460d:	68 a2 00 00 00       	push   $0xa2
+  804612:	68 a2 5e 80 00       	push   $0x805ea2
+  804617:	e8 77 bb ff ff       	call   800193 <_panic>
+			panic("free: %p is not allocated", va);
+  80461c:	53                   	push   %ebx
+  80461d:	68 88 5e 80 00       	push   $0x805e88
+  804622:	68 a5 00 00 00       	push   $0xa5
+  804627:	68 a2 5e 80 00       	push   $0x805ea2
+  80462c:	e8 62 bb ff ff       	call   800193 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  804631:	89 de                	mov    %ebx,%esi
+  804633:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  804639:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  80463f:	89 c8                	mov    %ecx,%eax
+  804641:	c1 e8 11             	shr    $0x11,%eax
+  804644:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804647:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  80464e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  804651:	c1 e9 0c             	shr    $0xc,%ecx
+  804654:	b8 01 00 00 00       	mov    $0x1,%eax
+  804659:	d3 e0                	shl    %cl,%eax
+  80465b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80465e:	85 c7                	test   %eax,%edi
+  804660:	74 1b                	je     80467d <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  804662:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804666:	89 d8                	mov    %ebx,%eax
+  804668:	29 f0                	sub    %esi,%eax
+  80466a:	83 e8 10             	sub    $0x10,%eax
+  80466d:	99                   	cltd
+  80466e:	f7 ff                	idiv   %edi
+  804670:	89 d1                	mov    %edx,%ecx
+  804672:	85 d2                	test   %edx,%edx
+  804674:	75 07                	jne    80467d <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804676:	ba 10 00 00 00       	mov    $0x10,%edx
+  80467b:	eb 18                	jmp    804695 <free+0xda>
+		panic("free: %p is not allocated", va);
+  80467d:	53                   	push   %ebx
+  80467e:	68 88 5e 80 00       	push   $0x805e88
+  804683:	68 ad 00 00 00       	push   $0xad
+  804688:	68 a2 5e 80 00       	push   $0x805ea2
+  80468d:	e8 01 bb ff ff       	call   800193 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804692:	83 c1 01             	add    $0x1,%ecx
+  804695:	89 d0                	mov    %edx,%eax
+  804697:	d3 e0                	shl    %cl,%eax
+  804699:	39 c7                	cmp    %eax,%edi
+  80469b:	7f f5                	jg     804692 <free+0xd7>
+	*(void **) va = s->free;
+  80469d:	8b 46 08             	mov    0x8(%esi),%eax
+  8046a0:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  8046a2:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  8046a5:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  8046a9:	8d 58 01             	lea    0x1(%eax),%ebx
+  8046ac:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  8046b0:	66 85 c0             	test   %ax,%ax
+  8046b3:	74 52                	je     804707 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8046b5:	0f b7 db             	movzwl %bx,%ebx
+  8046b8:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8046bc:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8046c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046c6:	f7 ff                	idiv   %edi
+  8046c8:	39 c3                	cmp    %eax,%ebx
+  8046ca:	0f 85 2f ff ff ff    	jne    8045ff <free+0x44>
+  8046d0:	8b 46 04             	mov    0x4(%esi),%eax
+  8046d3:	85 c0                	test   %eax,%eax
+  8046d5:	74 53                	je     80472a <free+0x16f>
+		s->prev->next = s->next;
+  8046d7:	8b 16                	mov    (%esi),%edx
+  8046d9:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8046db:	8b 06                	mov    (%esi),%eax
+  8046dd:	85 c0                	test   %eax,%eax
+  8046df:	74 06                	je     8046e7 <free+0x12c>
+		s->next->prev = s->prev;
+  8046e1:	8b 56 04             	mov    0x4(%esi),%edx
+  8046e4:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8046e7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8046ea:	f7 d0                	not    %eax
+  8046ec:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8046ef:	21 d0                	and    %edx,%eax
+  8046f1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8046f4:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  8046fb:	89 f0                	mov    %esi,%eax
+  8046fd:	e8 fd fd ff ff       	call   8044ff <heap_free_pages>
+  804702:	e9 f8 fe ff ff       	jmp    8045ff <free+0x44>
+	s->prev = NULL;
+  804707:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  80470e:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  804715:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  804717:	85 c0                	test   %eax,%eax
+  804719:	74 03                	je     80471e <free+0x163>
+		slabs[c]->prev = s;
+  80471b:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  80471e:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  804725:	e9 d5 fe ff ff       	jmp    8045ff <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  80472a:	8b 06                	mov    (%esi),%eax
+  80472c:	85 c0                	test   %eax,%eax
+  80472e:	0f 84 cb fe ff ff    	je     8045ff <free+0x44>
+		slabs[c] = s->next;
+  804734:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  80473b:	8b 06                	mov    (%esi),%eax
+  80473d:	eb a2                	jmp    8046e1 <free+0x126>
+
+0080473f <heap_alloc_pages>:
+{
+  80473f:	55                   	push   %ebp
+  804740:	89 e5                	mov    %esp,%ebp
+  804742:	57                   	push   %edi
+  804743:	56                   	push   %esi
+  804744:	53                   	push   %ebx
+  804745:	83 ec 18             	sub    $0x18,%esp
+  804748:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  80474a:	50                   	push   %eax
+  80474b:	e8 15 03 00 00       	call   804a65 <va_alloc>
+  804750:	89 c3                	mov    %eax,%ebx
+  804752:	83 c4 10             	add    $0x10,%esp
+  804755:	85 c0                	test   %eax,%eax
+  804757:	74 47                	je     8047a0 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804759:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  80475f:	89 c1                	mov    %eax,%ecx
+  804761:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  804764:	c1 e8 11             	shr    $0x11,%eax
+  804767:	ba 01 00 00 00       	mov    $0x1,%edx
+  80476c:	89 d7                	mov    %edx,%edi
+  80476e:	d3 e7                	shl    %cl,%edi
+  804770:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  804777:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  80477b:	89 c8                	mov    %ecx,%eax
+  80477d:	c1 e8 05             	shr    $0x5,%eax
+  804780:	d3 e2                	shl    %cl,%edx
+  804782:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  804789:	83 ec 0c             	sub    $0xc,%esp
+  80478c:	6a 00                	push   $0x0
+  80478e:	6a 07                	push   $0x7
+  804790:	56                   	push   %esi
+  804791:	53                   	push   %ebx
+  804792:	6a 00                	push   $0x0
+  804794:	e8 3a f7 ff ff       	call   803ed3 <page_alloc_range>
+  804799:	83 c4 20             	add    $0x20,%esp
+  80479c:	85 c0                	test   %eax,%eax
+  80479e:	78 0a                	js     8047aa <heap_alloc_pages+0x6b>
+}
+  8047a0:	89 d8                	mov    %ebx,%eax
+  8047a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8047a5:	5b                   	pop    %ebx
+  8047a6:	5e                   	pop    %esi
+  8047a7:	5f                   	pop    %edi
+  8047a8:	5d                   	pop    %ebp
+  8047a9:	c3                   	ret
+		free(va);
+  8047aa:	83 ec 0c             	sub    $0xc,%esp
+  8047ad:	53                   	push   %ebx
+  8047ae:	e8 08 fe ff ff       	call   8045bb <free>
+		return NULL;
+  8047b3:	83 c4 10             	add    $0x10,%esp
+  8047b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8047bb:	eb e3                	jmp    8047a0 <heap_alloc_pages+0x61>
+
+008047bd <malloc>:
+{
+  8047bd:	55                   	push   %ebp
+  8047be:	89 e5                	mov    %esp,%ebp
+  8047c0:	57                   	push   %edi
+  8047c1:	56                   	push   %esi
+  8047c2:	53                   	push   %ebx
+  8047c3:	83 ec 1c             	sub    $0x1c,%esp
+  8047c6:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  8047c9:	8d 50 ff             	lea    -0x1(%eax),%edx
+  8047cc:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  8047d2:	0f 87 21 01 00 00    	ja     8048f9 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8047d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8047dd:	ba 10 00 00 00       	mov    $0x10,%edx
+  8047e2:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  8047e4:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8047e9:	76 15                	jbe    804800 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  8047eb:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8047f0:	c1 e8 0c             	shr    $0xc,%eax
+  8047f3:	e8 47 ff ff ff       	call   80473f <heap_alloc_pages>
+  8047f8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8047fb:	eb 37                	jmp    804834 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8047fd:	83 c1 01             	add    $0x1,%ecx
+  804800:	89 d6                	mov    %edx,%esi
+  804802:	d3 e6                	shl    %cl,%esi
+  804804:	39 c6                	cmp    %eax,%esi
+  804806:	72 f5                	jb     8047fd <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804808:	89 cb                	mov    %ecx,%ebx
+  80480a:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  804811:	85 ff                	test   %edi,%edi
+  804813:	74 2a                	je     80483f <malloc+0x82>
+	v = s->free;
+  804815:	8b 47 08             	mov    0x8(%edi),%eax
+  804818:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  80481b:	8b 00                	mov    (%eax),%eax
+  80481d:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  804820:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  804824:	83 e8 01             	sub    $0x1,%eax
+  804827:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  80482b:	66 85 c0             	test   %ax,%ax
+  80482e:	0f 84 9a 00 00 00    	je     8048ce <malloc+0x111>
+}
+  804834:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804837:	83 c4 1c             	add    $0x1c,%esp
+  80483a:	5b                   	pop    %ebx
+  80483b:	5e                   	pop    %esi
+  80483c:	5f                   	pop    %edi
+  80483d:	5d                   	pop    %ebp
+  80483e:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  80483f:	b8 01 00 00 00       	mov    $0x1,%eax
+  804844:	e8 f6 fe ff ff       	call   80473f <heap_alloc_pages>
+  804849:	89 c1                	mov    %eax,%ecx
+  80484b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80484e:	85 c0                	test   %eax,%eax
+  804850:	74 e2                	je     804834 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804852:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  804858:	89 c8                	mov    %ecx,%eax
+  80485a:	c1 e8 11             	shr    $0x11,%eax
+  80485d:	c1 e9 0c             	shr    $0xc,%ecx
+  804860:	ba 01 00 00 00       	mov    $0x1,%edx
+  804865:	d3 e2                	shl    %cl,%edx
+  804867:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  80486e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804871:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  804875:	0f b7 f6             	movzwl %si,%esi
+  804878:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80487d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804882:	f7 fe                	idiv   %esi
+  804884:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804888:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  80488b:	85 c0                	test   %eax,%eax
+  80488d:	74 14                	je     8048a3 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  80488f:	83 e8 01             	sub    $0x1,%eax
+  804892:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804896:	0f af d0             	imul   %eax,%edx
+  804899:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  80489d:	89 3a                	mov    %edi,(%edx)
+  80489f:	89 d7                	mov    %edx,%edi
+  8048a1:	eb e5                	jmp    804888 <malloc+0xcb>
+	s->prev = NULL;
+  8048a3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8048a6:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  8048ad:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  8048b4:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  8048b6:	85 c0                	test   %eax,%eax
+  8048b8:	74 03                	je     8048bd <malloc+0x100>
+		slabs[c]->prev = s;
+  8048ba:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  8048bd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8048c0:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  8048c7:	89 c7                	mov    %eax,%edi
+  8048c9:	e9 47 ff ff ff       	jmp    804815 <malloc+0x58>
+	if (s->prev)
+  8048ce:	8b 47 04             	mov    0x4(%edi),%eax
+  8048d1:	85 c0                	test   %eax,%eax
+  8048d3:	74 19                	je     8048ee <malloc+0x131>
+		s->prev->next = s->next;
+  8048d5:	8b 17                	mov    (%edi),%edx
+  8048d7:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8048d9:	8b 07                	mov    (%edi),%eax
+  8048db:	85 c0                	test   %eax,%eax
+  8048dd:	0f 84 51 ff ff ff    	je     804834 <malloc+0x77>
+		s->next->prev = s->prev;
+  8048e3:	8b 57 04             	mov    0x4(%edi),%edx
+  8048e6:	89 50 04             	mov    %edx,0x4(%eax)
+  8048e9:	e9 46 ff ff ff       	jmp    804834 <malloc+0x77>
+		slabs[c] = s->next;
+  8048ee:	8b 07                	mov    (%edi),%eax
+  8048f0:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  8048f7:	eb e0                	jmp    8048d9 <malloc+0x11c>
+		return NULL;
+  8048f9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804900:	e9 2f ff ff ff       	jmp    804834 <malloc+0x77>
+
+00804905 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804905:	55                   	push   %ebp
+  804906:	89 e5                	mov    %esp,%ebp
+  804908:	57                   	push   %edi
+  804909:	56                   	push   %esi
+  80490a:	53                   	push   %ebx
+  80490b:	83 ec 0c             	sub    $0xc,%esp
+  80490e:	89 c6                	mov    %eax,%esi
+  804910:	89 d7                	mov    %edx,%edi
+  804912:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804915:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80491a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80491f:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  804924:	83 ef 01             	sub    $0x1,%edi
+  804927:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  80492a:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  80492d:	eb 34                	jmp    804963 <va_chunk_scan+0x5e>
+			i += 31;
+  80492f:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  804932:	89 ca                	mov    %ecx,%edx
+			continue;
+  804934:	eb 23                	jmp    804959 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804936:	89 c7                	mov    %eax,%edi
+  804938:	c1 ef 05             	shr    $0x5,%edi
+  80493b:	be 01 00 00 00       	mov    $0x1,%esi
+  804940:	d3 e6                	shl    %cl,%esi
+  804942:	89 f1                	mov    %esi,%ecx
+  804944:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804947:	23 0c be             	and    (%esi,%edi,4),%ecx
+  80494a:	75 41                	jne    80498d <va_chunk_scan+0x88>
+			len++;
+  80494c:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  80494f:	39 d3                	cmp    %edx,%ebx
+  804951:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  804954:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  804957:	72 2d                	jb     804986 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804959:	83 c0 01             	add    $0x1,%eax
+  80495c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804961:	77 31                	ja     804994 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  804963:	89 c1                	mov    %eax,%ecx
+  804965:	83 e1 1f             	and    $0x1f,%ecx
+  804968:	75 cc                	jne    804936 <va_chunk_scan+0x31>
+  80496a:	89 c7                	mov    %eax,%edi
+  80496c:	c1 ef 05             	shr    $0x5,%edi
+  80496f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804972:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804975:	83 ff ff             	cmp    $0xffffffff,%edi
+  804978:	74 b5                	je     80492f <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  80497a:	85 ff                	test   %edi,%edi
+  80497c:	75 b8                	jne    804936 <va_chunk_scan+0x31>
+			i += 31;
+  80497e:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804981:	83 c2 20             	add    $0x20,%edx
+  804984:	eb c9                	jmp    80494f <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804986:	83 c0 01             	add    $0x1,%eax
+  804989:	29 d0                	sub    %edx,%eax
+  80498b:	eb 15                	jmp    8049a2 <va_chunk_scan+0x9d>
+			len = 0;
+  80498d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804992:	eb c5                	jmp    804959 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804994:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804999:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  80499c:	85 d2                	test   %edx,%edx
+  80499e:	74 02                	je     8049a2 <va_chunk_scan+0x9d>
+		*run_store = best;
+  8049a0:	89 1a                	mov    %ebx,(%edx)
+}
+  8049a2:	83 c4 0c             	add    $0xc,%esp
+  8049a5:	5b                   	pop    %ebx
+  8049a6:	5e                   	pop    %esi
+  8049a7:	5f                   	pop    %edi
+  8049a8:	5d                   	pop    %ebp
+  8049a9:	c3                   	ret
+
+008049aa <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  8049aa:	55                   	push   %ebp
+  8049ab:	89 e5                	mov    %esp,%ebp
+  8049ad:	57                   	push   %edi
+  8049ae:	56                   	push   %esi
+  8049af:	53                   	push   %ebx
+  8049b0:	83 ec 14             	sub    $0x14,%esp
+  8049b3:	89 c3                	mov    %eax,%ebx
+  8049b5:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  8049b7:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  8049bd:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  8049c3:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  8049c6:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  8049c9:	89 d6                	mov    %edx,%esi
+  8049cb:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  8049d1:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  8049d3:	eb 34                	jmp    804a09 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  8049d5:	89 c8                	mov    %ecx,%eax
+  8049d7:	c1 e8 05             	shr    $0x5,%eax
+  8049da:	89 da                	mov    %ebx,%edx
+  8049dc:	c1 e2 05             	shl    $0x5,%edx
+  8049df:	01 da                	add    %ebx,%edx
+  8049e1:	01 c2                	add    %eax,%edx
+  8049e3:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8049e8:	d3 c0                	rol    %cl,%eax
+  8049ea:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  8049f1:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  8049f8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8049fd:	01 d0                	add    %edx,%eax
+  8049ff:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804a06:	83 c1 01             	add    $0x1,%ecx
+  804a09:	39 f9                	cmp    %edi,%ecx
+  804a0b:	74 30                	je     804a3d <va_chunk_mark+0x93>
+		if (alloc)
+  804a0d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804a11:	74 c2                	je     8049d5 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804a13:	89 c8                	mov    %ecx,%eax
+  804a15:	c1 e8 05             	shr    $0x5,%eax
+  804a18:	89 da                	mov    %ebx,%edx
+  804a1a:	c1 e2 05             	shl    $0x5,%edx
+  804a1d:	01 da                	add    %ebx,%edx
+  804a1f:	01 c2                	add    %eax,%edx
+  804a21:	b8 01 00 00 00       	mov    $0x1,%eax
+  804a26:	d3 e0                	shl    %cl,%eax
+  804a28:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804a2f:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804a36:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804a3b:	eb c0                	jmp    8049fd <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804a3d:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804a40:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a45:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804a48:	e8 b8 fe ff ff       	call   804905 <va_chunk_scan>
+	ch->run = run;
+  804a4d:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804a53:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804a56:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  804a5d:	83 c4 14             	add    $0x14,%esp
+  804a60:	5b                   	pop    %ebx
+  804a61:	5e                   	pop    %esi
+  804a62:	5f                   	pop    %edi
+  804a63:	5d                   	pop    %ebp
+  804a64:	c3                   	ret
+
+00804a65 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804a65:	55                   	push   %ebp
+  804a66:	89 e5                	mov    %esp,%ebp
+  804a68:	57                   	push   %edi
+  804a69:	56                   	push   %esi
+  804a6a:	53                   	push   %ebx
+  804a6b:	83 ec 04             	sub    $0x4,%esp
+  804a6e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804a71:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  804a76:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  804a7b:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  804a82:	74 4f                	je     804ad3 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804a84:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804a87:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804a8c:	0f 87 01 01 00 00    	ja     804b93 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804a92:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804a98:	0f 87 80 00 00 00    	ja     804b1e <va_alloc+0xb9>
+  804a9e:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804aa3:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804aa8:	0f b7 10             	movzwl (%eax),%edx
+  804aab:	05 84 00 00 00       	add    $0x84,%eax
+  804ab0:	39 da                	cmp    %ebx,%edx
+  804ab2:	73 2c                	jae    804ae0 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804ab4:	83 c6 01             	add    $0x1,%esi
+  804ab7:	83 fe 1c             	cmp    $0x1c,%esi
+  804aba:	75 ec                	jne    804aa8 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804abc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ac1:	eb 53                	jmp    804b16 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804ac3:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804ac9:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804ace:	05 84 00 00 00       	add    $0x84,%eax
+  804ad3:	39 d0                	cmp    %edx,%eax
+  804ad5:	75 ec                	jne    804ac3 <va_alloc+0x5e>
+	va_inited = 1;
+  804ad7:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  804ade:	eb a4                	jmp    804a84 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804ae0:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804ae6:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  804aeb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804af0:	89 da                	mov    %ebx,%edx
+  804af2:	e8 0e fe ff ff       	call   804905 <va_chunk_scan>
+  804af7:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804af9:	6a 01                	push   $0x1
+  804afb:	89 d9                	mov    %ebx,%ecx
+  804afd:	89 c2                	mov    %eax,%edx
+  804aff:	89 f0                	mov    %esi,%eax
+  804b01:	e8 a4 fe ff ff       	call   8049aa <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804b06:	c1 e6 16             	shl    $0x16,%esi
+  804b09:	c1 e7 0c             	shl    $0xc,%edi
+  804b0c:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804b13:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804b16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b19:	5b                   	pop    %ebx
+  804b1a:	5e                   	pop    %esi
+  804b1b:	5f                   	pop    %edi
+  804b1c:	5d                   	pop    %ebp
+  804b1d:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804b1e:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804b24:	c1 ee 0a             	shr    $0xa,%esi
+  804b27:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b31:	eb 0a                	jmp    804b3d <va_alloc+0xd8>
+			first = c + 1;
+  804b33:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804b35:	83 c2 01             	add    $0x1,%edx
+  804b38:	83 fa 1d             	cmp    $0x1d,%edx
+  804b3b:	74 4f                	je     804b8c <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804b3d:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804b43:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  804b4a:	00 04 
+  804b4c:	75 e5                	jne    804b33 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804b4e:	89 d1                	mov    %edx,%ecx
+  804b50:	29 c1                	sub    %eax,%ecx
+  804b52:	39 f1                	cmp    %esi,%ecx
+  804b54:	75 df                	jne    804b35 <va_alloc+0xd0>
+  804b56:	89 c7                	mov    %eax,%edi
+  804b58:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804b5b:	be 00 04 00 00       	mov    $0x400,%esi
+  804b60:	39 f3                	cmp    %esi,%ebx
+  804b62:	0f 46 f3             	cmovbe %ebx,%esi
+  804b65:	6a 01                	push   $0x1
+  804b67:	89 f1                	mov    %esi,%ecx
+  804b69:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b6e:	89 f8                	mov    %edi,%eax
+  804b70:	e8 35 fe ff ff       	call   8049aa <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804b75:	83 c7 01             	add    $0x1,%edi
+  804b78:	83 c4 04             	add    $0x4,%esp
+  804b7b:	29 f3                	sub    %esi,%ebx
+  804b7d:	75 dc                	jne    804b5b <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804b7f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804b82:	c1 e0 16             	shl    $0x16,%eax
+  804b85:	05 00 00 00 08       	add    $0x8000000,%eax
+  804b8a:	eb 8a                	jmp    804b16 <va_alloc+0xb1>
+	return NULL;
+  804b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b91:	eb 83                	jmp    804b16 <va_alloc+0xb1>
+		return NULL;
+  804b93:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b98:	e9 79 ff ff ff       	jmp    804b16 <va_alloc+0xb1>
+
+00804b9d <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804b9d:	55                   	push   %ebp
+  804b9e:	89 e5                	mov    %esp,%ebp
+  804ba0:	57                   	push   %edi
+  804ba1:	56                   	push   %esi
+  804ba2:	53                   	push   %ebx
+  804ba3:	83 ec 0c             	sub    $0xc,%esp
+  804ba6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804ba9:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804bac:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804bb2:	76 21                	jbe    804bd5 <va_free+0x38>
+  804bb4:	89 f0                	mov    %esi,%eax
+  804bb6:	c1 e0 0c             	shl    $0xc,%eax
+  804bb9:	01 f8                	add    %edi,%eax
+  804bbb:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804bc0:	77 13                	ja     804bd5 <va_free+0x38>
+	    || PGOFF(va))
+  804bc2:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804bc8:	75 0b                	jne    804bd5 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804bca:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804bd0:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804bd3:	eb 45                	jmp    804c1a <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804bd5:	83 ec 0c             	sub    $0xc,%esp
+  804bd8:	56                   	push   %esi
+  804bd9:	57                   	push   %edi
+  804bda:	68 cc 5e 80 00       	push   $0x805ecc
+  804bdf:	68 8e 00 00 00       	push   $0x8e
+  804be4:	68 ec 5e 80 00       	push   $0x805eec
+  804be9:	e8 a5 b5 ff ff       	call   800193 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804bee:	89 fa                	mov    %edi,%edx
+  804bf0:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804bf6:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804bfb:	29 d3                	sub    %edx,%ebx
+  804bfd:	39 f3                	cmp    %esi,%ebx
+  804bff:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804c02:	89 f8                	mov    %edi,%eax
+  804c04:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804c07:	83 ec 0c             	sub    $0xc,%esp
+  804c0a:	6a 00                	push   $0x0
+  804c0c:	89 d9                	mov    %ebx,%ecx
+  804c0e:	e8 97 fd ff ff       	call   8049aa <va_chunk_mark>
+		i += n;
+  804c13:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804c15:	29 de                	sub    %ebx,%esi
+  804c17:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804c1a:	85 f6                	test   %esi,%esi
+  804c1c:	75 d0                	jne    804bee <va_free+0x51>
+	}
+}
+  804c1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804c21:	5b                   	pop    %ebx
+  804c22:	5e                   	pop    %esi
+  804c23:	5f                   	pop    %edi
+  804c24:	5d                   	pop    %ebp
+  804c25:	c3                   	ret
+
+00804c26 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804c26:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c2b:	c3                   	ret
+
+00804c2c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804c2c:	55                   	push   %ebp
+  804c2d:	89 e5                	mov    %esp,%ebp
+  804c2f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804c32:	68 f9 5e 80 00       	push   $0x805ef9
+  804c37:	ff 75 0c             	push   0xc(%ebp)
+  804c3a:	e8 16 bc ff ff       	call   800855 <strcpy>
+	return 0;
+}
+  804c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c44:	c9                   	leave
+  804c45:	c3                   	ret
+
+00804c46 <devcons_write>:
+{
+  804c46:	55                   	push   %ebp
+  804c47:	89 e5                	mov    %esp,%ebp
+  804c49:	57                   	push   %edi
+  804c4a:	56                   	push   %esi
+  804c4b:	53                   	push   %ebx
+  804c4c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804c52:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804c57:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804c5d:	eb 2e                	jmp    804c8d <devcons_write+0x47>
+		m = n - tot;
+  804c5f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804c62:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804c64:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804c69:	39 c3                	cmp    %eax,%ebx
+  804c6b:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804c6e:	83 ec 04             	sub    $0x4,%esp
+  804c71:	53                   	push   %ebx
+  804c72:	89 f0                	mov    %esi,%eax
+  804c74:	03 45 0c             	add    0xc(%ebp),%eax
+  804c77:	50                   	push   %eax
+  804c78:	57                   	push   %edi
+  804c79:	e8 5d bd ff ff       	call   8009db <memmove>
+		sys_cputs(buf, m);
+  804c7e:	83 c4 08             	add    $0x8,%esp
+  804c81:	53                   	push   %ebx
+  804c82:	57                   	push   %edi
+  804c83:	e8 f3 bf ff ff       	call   800c7b <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804c88:	01 de                	add    %ebx,%esi
+  804c8a:	83 c4 10             	add    $0x10,%esp
+  804c8d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804c90:	72 cd                	jb     804c5f <devcons_write+0x19>
+}
+  804c92:	89 f0                	mov    %esi,%eax
+  804c94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804c97:	5b                   	pop    %ebx
+  804c98:	5e                   	pop    %esi
+  804c99:	5f                   	pop    %edi
+  804c9a:	5d                   	pop    %ebp
+  804c9b:	c3                   	ret
+
+00804c9c <devcons_read>:
+{
+  804c9c:	55                   	push   %ebp
+  804c9d:	89 e5                	mov    %esp,%ebp
+  804c9f:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ca7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804cab:	75 07                	jne    804cb4 <devcons_read+0x18>
+  804cad:	eb 1f                	jmp    804cce <devcons_read+0x32>
+		sys_yield();
+  804caf:	e8 75 c0 ff ff       	call   800d29 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804cb4:	e8 f1 bf ff ff       	call   800caa <sys_cgetc>
+  804cb9:	85 c0                	test   %eax,%eax
+  804cbb:	74 f2                	je     804caf <devcons_read+0x13>
+	if (c < 0)
+  804cbd:	78 0f                	js     804cce <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804cbf:	83 f8 04             	cmp    $0x4,%eax
+  804cc2:	74 0c                	je     804cd0 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804cc4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804cc7:	88 02                	mov    %al,(%edx)
+	return 1;
+  804cc9:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804cce:	c9                   	leave
+  804ccf:	c3                   	ret
+		return 0;
+  804cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cd5:	eb f7                	jmp    804cce <devcons_read+0x32>
+
+00804cd7 <cputchar>:
+{
+  804cd7:	55                   	push   %ebp
+  804cd8:	89 e5                	mov    %esp,%ebp
+  804cda:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804cdd:	8b 45 08             	mov    0x8(%ebp),%eax
+  804ce0:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804ce3:	6a 01                	push   $0x1
+  804ce5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804ce8:	50                   	push   %eax
+  804ce9:	e8 8d bf ff ff       	call   800c7b <sys_cputs>
+}
+  804cee:	83 c4 10             	add    $0x10,%esp
+  804cf1:	c9                   	leave
+  804cf2:	c3                   	ret
+
+00804cf3 <getchar>:
+{
+  804cf3:	55                   	push   %ebp
+  804cf4:	89 e5                	mov    %esp,%ebp
+  804cf6:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804cf9:	6a 01                	push   $0x1
+  804cfb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804cfe:	50                   	push   %eax
+  804cff:	6a 00                	push   $0x0
+  804d01:	e8 6b ce ff ff       	call   801b71 <read>
+	if (r < 0)
+  804d06:	83 c4 10             	add    $0x10,%esp
+  804d09:	85 c0                	test   %eax,%eax
+  804d0b:	78 06                	js     804d13 <getchar+0x20>
+	if (r < 1)
+  804d0d:	74 06                	je     804d15 <getchar+0x22>
+	return c;
+  804d0f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804d13:	c9                   	leave
+  804d14:	c3                   	ret
+		return -E_EOF;
+  804d15:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804d1a:	eb f7                	jmp    804d13 <getchar+0x20>
+
+00804d1c <iscons>:
+{
+  804d1c:	55                   	push   %ebp
+  804d1d:	89 e5                	mov    %esp,%ebp
+  804d1f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804d22:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804d25:	50                   	push   %eax
+  804d26:	ff 75 08             	push   0x8(%ebp)
+  804d29:	e8 e4 cb ff ff       	call   801912 <fd_lookup>
+  804d2e:	83 c4 10             	add    $0x10,%esp
+  804d31:	85 c0                	test   %eax,%eax
+  804d33:	78 11                	js     804d46 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804d35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804d38:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804d3e:	39 10                	cmp    %edx,(%eax)
+  804d40:	0f 94 c0             	sete   %al
+  804d43:	0f b6 c0             	movzbl %al,%eax
+}
+  804d46:	c9                   	leave
+  804d47:	c3                   	ret
+
+00804d48 <opencons>:
+{
+  804d48:	55                   	push   %ebp
+  804d49:	89 e5                	mov    %esp,%ebp
+  804d4b:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804d4e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804d51:	50                   	push   %eax
+  804d52:	e8 67 cb ff ff       	call   8018be <fd_alloc>
+  804d57:	83 c4 10             	add    $0x10,%esp
+  804d5a:	85 c0                	test   %eax,%eax
+  804d5c:	78 3a                	js     804d98 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804d5e:	83 ec 04             	sub    $0x4,%esp
+  804d61:	68 07 04 00 00       	push   $0x407
+  804d66:	ff 75 f4             	push   -0xc(%ebp)
+  804d69:	6a 00                	push   $0x0
+  804d6b:	e8 d8 bf ff ff       	call   800d48 <sys_page_alloc>
+  804d70:	83 c4 10             	add    $0x10,%esp
+  804d73:	85 c0                	test   %eax,%eax
+  804d75:	78 21                	js     804d98 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804d77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804d7a:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804d80:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804d82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804d85:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804d8c:	83 ec 0c             	sub    $0xc,%esp
+  804d8f:	50                   	push   %eax
+  804d90:	e8 02 cb ff ff       	call   801897 <fd2num>
+  804d95:	83 c4 10             	add    $0x10,%esp
+}
+  804d98:	c9                   	leave
+  804d99:	c3                   	ret
+
+00804d9a <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804d9a:	55                   	push   %ebp
+  804d9b:	89 e5                	mov    %esp,%ebp
+  804d9d:	56                   	push   %esi
+  804d9e:	53                   	push   %ebx
+  804d9f:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804da2:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  804da7:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804daa:	85 db                	test   %ebx,%ebx
+  804dac:	78 17                	js     804dc5 <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804dae:	83 ec 0c             	sub    $0xc,%esp
+  804db1:	56                   	push   %esi
+  804db2:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  804db9:	83 c4 10             	add    $0x10,%esp
+  804dbc:	85 c0                	test   %eax,%eax
+  804dbe:	75 27                	jne    804de7 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804dc0:	83 eb 01             	sub    $0x1,%ebx
+  804dc3:	eb e5                	jmp    804daa <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804dc5:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804dca:	8b 40 48             	mov    0x48(%eax),%eax
+  804dcd:	83 ec 08             	sub    $0x8,%esp
+  804dd0:	ff 76 28             	push   0x28(%esi)
+  804dd3:	ff 36                	push   (%esi)
+  804dd5:	50                   	push   %eax
+  804dd6:	68 08 5f 80 00       	push   $0x805f08
+  804ddb:	6a 1d                	push   $0x1d
+  804ddd:	68 2b 5f 80 00       	push   $0x805f2b
+  804de2:	e8 ac b3 ff ff       	call   800193 <_panic>
+}
+  804de7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804dea:	5b                   	pop    %ebx
+  804deb:	5e                   	pop    %esi
+  804dec:	5d                   	pop    %ebp
+  804ded:	c3                   	ret
+
+00804dee <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804dee:	55                   	push   %ebp
+  804def:	89 e5                	mov    %esp,%ebp
+  804df1:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804df4:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  804dfb:	74 0a                	je     804e07 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804dfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  804e00:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  804e05:	c9                   	leave
+  804e06:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804e07:	83 ec 04             	sub    $0x4,%esp
+  804e0a:	6a 07                	push   $0x7
+  804e0c:	68 00 f0 bf ee       	push   $0xeebff000
+  804e11:	6a 00                	push   $0x0
+  804e13:	e8 30 bf ff ff       	call   800d48 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804e18:	83 c4 08             	add    $0x8,%esp
+  804e1b:	68 8e 4e 80 00       	push   $0x804e8e
+  804e20:	6a 00                	push   $0x0
+  804e22:	e8 87 c2 ff ff       	call   8010ae <sys_env_set_pgfault_upcall>
+  804e27:	83 c4 10             	add    $0x10,%esp
+  804e2a:	eb d1                	jmp    804dfd <set_pgfault_handler+0xf>
+
+00804e2c <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804e2c:	55                   	push   %ebp
+  804e2d:	89 e5                	mov    %esp,%ebp
+  804e2f:	83 ec 08             	sub    $0x8,%esp
+  804e32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  804e35:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  804e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e40:	eb 03                	jmp    804e45 <add_pgfault_handler+0x19>
+  804e42:	83 c0 01             	add    $0x1,%eax
+  804e45:	39 d0                	cmp    %edx,%eax
+  804e47:	74 0b                	je     804e54 <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804e49:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  804e50:	75 f0                	jne    804e42 <add_pgfault_handler+0x16>
+  804e52:	eb 24                	jmp    804e78 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  804e54:	83 fa 0a             	cmp    $0xa,%edx
+  804e57:	74 21                	je     804e7a <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  804e59:	8d 42 01             	lea    0x1(%edx),%eax
+  804e5c:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  804e61:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  804e68:	83 ec 0c             	sub    $0xc,%esp
+  804e6b:	68 9a 4d 80 00       	push   $0x804d9a
+  804e70:	e8 79 ff ff ff       	call   804dee <set_pgfault_handler>
+  804e75:	83 c4 10             	add    $0x10,%esp
+}
+  804e78:	c9                   	leave
+  804e79:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  804e7a:	83 ec 04             	sub    $0x4,%esp
+  804e7d:	68 39 5f 80 00       	push   $0x805f39
+  804e82:	6a 44                	push   $0x44
+  804e84:	68 2b 5f 80 00       	push   $0x805f2b
+  804e89:	e8 05 b3 ff ff       	call   800193 <_panic>
+
+00804e8e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804e8e:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804e8f:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  804e94:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804e96:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  804e99:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  804e9d:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  804ea1:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  804ea4:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  804ea6:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  804eaa:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  804ead:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  804eae:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  804eb1:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  804eb2:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  804eb3:	c3                   	ret
+
+00804eb4 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  804eb4:	55                   	push   %ebp
+  804eb5:	89 e5                	mov    %esp,%ebp
+  804eb7:	57                   	push   %edi
+  804eb8:	56                   	push   %esi
+  804eb9:	53                   	push   %ebx
+  804eba:	83 ec 14             	sub    $0x14,%esp
+  804ebd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804ec0:	8b 75 14             	mov    0x14(%ebp),%esi
+  804ec3:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804ec6:	ff 75 10             	push   0x10(%ebp)
+  804ec9:	ff 75 0c             	push   0xc(%ebp)
+  804ecc:	e8 9a c2 ff ff       	call   80116b <sys_ipc_recv_pages>
+  804ed1:	83 c4 10             	add    $0x10,%esp
+  804ed4:	85 c0                	test   %eax,%eax
+  804ed6:	78 46                	js     804f1e <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804ed8:	85 ff                	test   %edi,%edi
+  804eda:	74 0d                	je     804ee9 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804edc:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804ee1:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804ee7:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804ee9:	85 f6                	test   %esi,%esi
+  804eeb:	74 0d                	je     804efa <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804eed:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804ef2:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804ef8:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804efa:	85 db                	test   %ebx,%ebx
+  804efc:	74 0d                	je     804f0b <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804efe:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804f03:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804f09:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804f0b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804f10:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804f16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804f19:	5b                   	pop    %ebx
+  804f1a:	5e                   	pop    %esi
+  804f1b:	5f                   	pop    %edi
+  804f1c:	5d                   	pop    %ebp
+  804f1d:	c3                   	ret
+		if (from_env_store) {
+  804f1e:	85 ff                	test   %edi,%edi
+  804f20:	74 06                	je     804f28 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  804f22:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804f28:	85 f6                	test   %esi,%esi
+  804f2a:	74 06                	je     804f32 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804f2c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804f32:	85 db                	test   %ebx,%ebx
+  804f34:	74 e0                	je     804f16 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  804f36:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804f3c:	eb d8                	jmp    804f16 <ipc_recv_pages+0x62>
+
+00804f3e <ipc_recv>:
+{
+  804f3e:	55                   	push   %ebp
+  804f3f:	89 e5                	mov    %esp,%ebp
+  804f41:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  804f44:	6a 00                	push   $0x0
+  804f46:	ff 75 10             	push   0x10(%ebp)
+  804f49:	6a 01                	push   $0x1
+  804f4b:	ff 75 0c             	push   0xc(%ebp)
+  804f4e:	ff 75 08             	push   0x8(%ebp)
+  804f51:	e8 5e ff ff ff       	call   804eb4 <ipc_recv_pages>
+}
+  804f56:	c9                   	leave
+  804f57:	c3                   	ret
+
+00804f58 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804f58:	55                   	push   %ebp
+  804f59:	89 e5                	mov    %esp,%ebp
+  804f5b:	56                   	push   %esi
+  804f5c:	53                   	push   %ebx
+  804f5d:	8b 75 08             	mov    0x8(%ebp),%esi
+  804f60:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  804f63:	83 ec 0c             	sub    $0xc,%esp
+  804f66:	ff 75 0c             	push   0xc(%ebp)
+  804f69:	e8 31 c3 ff ff       	call   80129f <sys_ipc_try_recv>
+  804f6e:	83 c4 10             	add    $0x10,%esp
+  804f71:	85 c0                	test   %eax,%eax
+  804f73:	78 34                	js     804fa9 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804f75:	85 f6                	test   %esi,%esi
+  804f77:	74 0d                	je     804f86 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  804f79:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804f7e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804f84:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  804f86:	85 db                	test   %ebx,%ebx
+  804f88:	74 0d                	je     804f97 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  804f8a:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804f8f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804f95:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804f97:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804f9c:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804fa2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804fa5:	5b                   	pop    %ebx
+  804fa6:	5e                   	pop    %esi
+  804fa7:	5d                   	pop    %ebp
+  804fa8:	c3                   	ret
+		if (from_env_store) {
+  804fa9:	85 f6                	test   %esi,%esi
+  804fab:	74 06                	je     804fb3 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  804fad:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  804fb3:	85 db                	test   %ebx,%ebx
+  804fb5:	74 eb                	je     804fa2 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  804fb7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804fbd:	eb e3                	jmp    804fa2 <ipc_try_recv+0x4a>
+
+00804fbf <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804fbf:	55                   	push   %ebp
+  804fc0:	89 e5                	mov    %esp,%ebp
+  804fc2:	83 ec 14             	sub    $0x14,%esp
+  804fc5:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804fc8:	85 c0                	test   %eax,%eax
+  804fca:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804fcf:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804fd2:	ff 75 18             	push   0x18(%ebp)
+  804fd5:	ff 75 14             	push   0x14(%ebp)
+  804fd8:	50                   	push   %eax
+  804fd9:	ff 75 0c             	push   0xc(%ebp)
+  804fdc:	ff 75 08             	push   0x8(%ebp)
+  804fdf:	e8 4a c1 ff ff       	call   80112e <sys_ipc_send_pages>
+  804fe4:	83 c4 20             	add    $0x20,%esp
+  804fe7:	85 c0                	test   %eax,%eax
+  804fe9:	78 02                	js     804fed <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804feb:	c9                   	leave
+  804fec:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804fed:	50                   	push   %eax
+  804fee:	68 54 5f 80 00       	push   $0x805f54
+  804ff3:	68 80 00 00 00       	push   $0x80
+  804ff8:	68 80 5f 80 00       	push   $0x805f80
+  804ffd:	e8 91 b1 ff ff       	call   800193 <_panic>
+
+00805002 <ipc_send>:
+{
+  805002:	55                   	push   %ebp
+  805003:	89 e5                	mov    %esp,%ebp
+  805005:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  805008:	ff 75 14             	push   0x14(%ebp)
+  80500b:	6a 01                	push   $0x1
+  80500d:	ff 75 10             	push   0x10(%ebp)
+  805010:	ff 75 0c             	push   0xc(%ebp)
+  805013:	ff 75 08             	push   0x8(%ebp)
+  805016:	e8 a4 ff ff ff       	call   804fbf <ipc_send_pages>
+}
+  80501b:	83 c4 20             	add    $0x20,%esp
+  80501e:	c9                   	leave
+  80501f:	c3                   	ret
+
+00805020 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  805020:	55                   	push   %ebp
+  805021:	89 e5                	mov    %esp,%ebp
+  805023:	83 ec 14             	sub    $0x14,%esp
+  805026:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805029:	85 c0                	test   %eax,%eax
+  80502b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805030:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  805033:	ff 75 18             	push   0x18(%ebp)
+  805036:	ff 75 14             	push   0x14(%ebp)
+  805039:	50                   	push   %eax
+  80503a:	ff 75 0c             	push   0xc(%ebp)
+  80503d:	ff 75 08             	push   0x8(%ebp)
+  805040:	e8 7a c1 ff ff       	call   8011bf <sys_ipc_call>
+  805045:	83 c4 20             	add    $0x20,%esp
+  805048:	85 c0                	test   %eax,%eax
+  80504a:	78 0b                	js     805057 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  80504c:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  805051:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  805057:	c9                   	leave
+  805058:	c3                   	ret
+
+00805059 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  805059:	55                   	push   %ebp
+  80505a:	89 e5                	mov    %esp,%ebp
+  80505c:	57                   	push   %edi
+  80505d:	56                   	push   %esi
+  80505e:	53                   	push   %ebx
+  80505f:	83 ec 18             	sub    $0x18,%esp
+  805062:	8b 45 10             	mov    0x10(%ebp),%eax
+  805065:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  805068:	8b 75 20             	mov    0x20(%ebp),%esi
+  80506b:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80506e:	85 c0                	test   %eax,%eax
+  805070:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805075:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  805078:	ff 75 18             	push   0x18(%ebp)
+  80507b:	ff 75 14             	push   0x14(%ebp)
+  80507e:	50                   	push   %eax
+  80507f:	ff 75 0c             	push   0xc(%ebp)
+  805082:	ff 75 08             	push   0x8(%ebp)
+  805085:	e8 76 c1 ff ff       	call   801200 <sys_ipc_reply_recv>
+  80508a:	83 c4 20             	add    $0x20,%esp
+  80508d:	85 c0                	test   %eax,%eax
+  80508f:	78 46                	js     8050d7 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  805091:	85 ff                	test   %edi,%edi
+  805093:	74 0d                	je     8050a2 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  805095:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80509a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8050a0:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8050a2:	85 f6                	test   %esi,%esi
+  8050a4:	74 0d                	je     8050b3 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8050a6:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8050ab:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8050b1:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8050b3:	85 db                	test   %ebx,%ebx
+  8050b5:	74 0d                	je     8050c4 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8050b7:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8050bc:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8050c2:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8050c4:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8050c9:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8050cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8050d2:	5b                   	pop    %ebx
+  8050d3:	5e                   	pop    %esi
+  8050d4:	5f                   	pop    %edi
+  8050d5:	5d                   	pop    %ebp
+  8050d6:	c3                   	ret
+		if (from_env_store) {
+  8050d7:	85 ff                	test   %edi,%edi
+  8050d9:	74 06                	je     8050e1 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  8050db:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8050e1:	85 f6                	test   %esi,%esi
+  8050e3:	74 06                	je     8050eb <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  8050e5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8050eb:	85 db                	test   %ebx,%ebx
+  8050ed:	74 e0                	je     8050cf <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  8050ef:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8050f5:	eb d8                	jmp    8050cf <ipc_reply_recv+0x76>
+
+008050f7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8050f7:	55                   	push   %ebp
+  8050f8:	89 e5                	mov    %esp,%ebp
+  8050fa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8050fd:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  805102:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  805105:	c1 e0 06             	shl    $0x6,%eax
+  805108:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80510d:	8b 40 50             	mov    0x50(%eax),%eax
+  805110:	39 c8                	cmp    %ecx,%eax
+  805112:	74 12                	je     805126 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  805114:	83 c2 01             	add    $0x1,%edx
+  805117:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80511d:	75 e3                	jne    805102 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80511f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805124:	eb 0e                	jmp    805134 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  805126:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  805129:	c1 e0 06             	shl    $0x6,%eax
+  80512c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805131:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  805134:	5d                   	pop    %ebp
+  805135:	c3                   	ret
+
+00805136 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  805136:	55                   	push   %ebp
+  805137:	89 e5                	mov    %esp,%ebp
+  805139:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80513c:	89 c2                	mov    %eax,%edx
+  80513e:	c1 ea 16             	shr    $0x16,%edx
+  805141:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  805148:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80514d:	f6 c1 01             	test   $0x1,%cl
+  805150:	74 1e                	je     805170 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  805152:	c1 e8 0c             	shr    $0xc,%eax
+  805155:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80515c:	a8 01                	test   $0x1,%al
+  80515e:	74 10                	je     805170 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  805160:	c1 e8 0c             	shr    $0xc,%eax
+  805163:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  805166:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  80516d:	0f b7 d2             	movzwl %dx,%edx
+}
+  805170:	89 d0                	mov    %edx,%eax
+  805172:	5d                   	pop    %ebp
+  805173:	c3                   	ret
+
+00805174 <udivmod>:
+  805174:	55                   	push   %ebp
+  805175:	57                   	push   %edi
+  805176:	56                   	push   %esi
+  805177:	53                   	push   %ebx
+  805178:	83 ec 24             	sub    $0x24,%esp
+  80517b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80517f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  805183:	8b 44 24 38          	mov    0x38(%esp),%eax
+  805187:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80518b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80518f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  805193:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  805197:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80519c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051a6:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8051ad:	00 
+  8051ae:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8051b5:	00 
+  8051b6:	89 fb                	mov    %edi,%ebx
+  8051b8:	eb 08                	jmp    8051c2 <udivmod+0x4e>
+  8051ba:	83 e9 01             	sub    $0x1,%ecx
+  8051bd:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8051c0:	74 68                	je     80522a <udivmod+0xb6>
+  8051c2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8051c6:	01 c0                	add    %eax,%eax
+  8051c8:	89 c6                	mov    %eax,%esi
+  8051ca:	89 d7                	mov    %edx,%edi
+  8051cc:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8051d0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8051d4:	0f ad d0             	shrd   %cl,%edx,%eax
+  8051d7:	d3 ea                	shr    %cl,%edx
+  8051d9:	f6 c1 20             	test   $0x20,%cl
+  8051dc:	74 04                	je     8051e2 <udivmod+0x6e>
+  8051de:	89 d0                	mov    %edx,%eax
+  8051e0:	31 d2                	xor    %edx,%edx
+  8051e2:	83 e0 01             	and    $0x1,%eax
+  8051e5:	89 04 24             	mov    %eax,(%esp)
+  8051e8:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8051ef:	00 
+  8051f0:	8b 04 24             	mov    (%esp),%eax
+  8051f3:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8051f7:	09 f0                	or     %esi,%eax
+  8051f9:	09 fa                	or     %edi,%edx
+  8051fb:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8051ff:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  805203:	39 f0                	cmp    %esi,%eax
+  805205:	89 d5                	mov    %edx,%ebp
+  805207:	19 fd                	sbb    %edi,%ebp
+  805209:	72 af                	jb     8051ba <udivmod+0x46>
+  80520b:	29 f0                	sub    %esi,%eax
+  80520d:	19 fa                	sbb    %edi,%edx
+  80520f:	89 cf                	mov    %ecx,%edi
+  805211:	c1 ef 05             	shr    $0x5,%edi
+  805214:	83 e7 01             	and    $0x1,%edi
+  805217:	89 fe                	mov    %edi,%esi
+  805219:	83 f6 01             	xor    $0x1,%esi
+  80521c:	d3 e6                	shl    %cl,%esi
+  80521e:	d3 e7                	shl    %cl,%edi
+  805220:	09 74 24 18          	or     %esi,0x18(%esp)
+  805224:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  805228:	eb 90                	jmp    8051ba <udivmod+0x46>
+  80522a:	85 db                	test   %ebx,%ebx
+  80522c:	74 05                	je     805233 <udivmod+0xbf>
+  80522e:	89 03                	mov    %eax,(%ebx)
+  805230:	89 53 04             	mov    %edx,0x4(%ebx)
+  805233:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805237:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80523b:	83 c4 24             	add    $0x24,%esp
+  80523e:	5b                   	pop    %ebx
+  80523f:	5e                   	pop    %esi
+  805240:	5f                   	pop    %edi
+  805241:	5d                   	pop    %ebp
+  805242:	c3                   	ret
+
+00805243 <__udivdi3>:
+  805243:	83 ec 08             	sub    $0x8,%esp
+  805246:	6a 00                	push   $0x0
+  805248:	ff 74 24 1c          	push   0x1c(%esp)
+  80524c:	ff 74 24 1c          	push   0x1c(%esp)
+  805250:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805254:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805258:	e8 17 ff ff ff       	call   805174 <udivmod>
+  80525d:	83 c4 14             	add    $0x14,%esp
+  805260:	c3                   	ret
+
+00805261 <__umoddi3>:
+  805261:	83 ec 18             	sub    $0x18,%esp
+  805264:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805268:	50                   	push   %eax
+  805269:	ff 74 24 2c          	push   0x2c(%esp)
+  80526d:	ff 74 24 2c          	push   0x2c(%esp)
+  805271:	8b 44 24 28          	mov    0x28(%esp),%eax
+  805275:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  805279:	e8 f6 fe ff ff       	call   805174 <udivmod>
+  80527e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805282:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805286:	83 c4 24             	add    $0x24,%esp
+  805289:	c3                   	ret
+
+0080528a <__divdi3>:
+  80528a:	55                   	push   %ebp
+  80528b:	57                   	push   %edi
+  80528c:	56                   	push   %esi
+  80528d:	53                   	push   %ebx
+  80528e:	83 ec 10             	sub    $0x10,%esp
+  805291:	8b 44 24 24          	mov    0x24(%esp),%eax
+  805295:	8b 54 24 28          	mov    0x28(%esp),%edx
+  805299:	89 c6                	mov    %eax,%esi
+  80529b:	89 d7                	mov    %edx,%edi
+  80529d:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8052a1:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8052a5:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8052a9:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8052ad:	89 c5                	mov    %eax,%ebp
+  8052af:	f7 dd                	neg    %ebp
+  8052b1:	89 d6                	mov    %edx,%esi
+  8052b3:	83 d6 00             	adc    $0x0,%esi
+  8052b6:	f7 de                	neg    %esi
+  8052b8:	0f 48 e8             	cmovs  %eax,%ebp
+  8052bb:	0f 49 d6             	cmovns %esi,%edx
+  8052be:	6a 00                	push   $0x0
+  8052c0:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8052c4:	f7 de                	neg    %esi
+  8052c6:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8052ca:	83 d0 00             	adc    $0x0,%eax
+  8052cd:	f7 d8                	neg    %eax
+  8052cf:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  8052d4:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  8052d9:	50                   	push   %eax
+  8052da:	56                   	push   %esi
+  8052db:	89 e8                	mov    %ebp,%eax
+  8052dd:	e8 92 fe ff ff       	call   805174 <udivmod>
+  8052e2:	83 c4 10             	add    $0x10,%esp
+  8052e5:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  8052ea:	78 08                	js     8052f4 <__divdi3+0x6a>
+  8052ec:	83 c4 0c             	add    $0xc,%esp
+  8052ef:	5b                   	pop    %ebx
+  8052f0:	5e                   	pop    %esi
+  8052f1:	5f                   	pop    %edi
+  8052f2:	5d                   	pop    %ebp
+  8052f3:	c3                   	ret
+  8052f4:	f7 d8                	neg    %eax
+  8052f6:	83 d2 00             	adc    $0x0,%edx
+  8052f9:	f7 da                	neg    %edx
+  8052fb:	eb ef                	jmp    8052ec <__divdi3+0x62>
+
+008052fd <__moddi3>:
+  8052fd:	55                   	push   %ebp
+  8052fe:	57                   	push   %edi
+  8052ff:	56                   	push   %esi
+  805300:	53                   	push   %ebx
+  805301:	83 ec 18             	sub    $0x18,%esp
+  805304:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  805308:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80530c:	89 f1                	mov    %esi,%ecx
+  80530e:	f7 d9                	neg    %ecx
+  805310:	89 da                	mov    %ebx,%edx
+  805312:	83 d2 00             	adc    $0x0,%edx
+  805315:	f7 da                	neg    %edx
+  805317:	0f 48 ce             	cmovs  %esi,%ecx
+  80531a:	0f 48 d3             	cmovs  %ebx,%edx
+  80531d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805321:	50                   	push   %eax
+  805322:	8b 74 24 38          	mov    0x38(%esp),%esi
+  805326:	f7 de                	neg    %esi
+  805328:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  80532c:	83 d0 00             	adc    $0x0,%eax
+  80532f:	f7 d8                	neg    %eax
+  805331:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  805336:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  80533b:	50                   	push   %eax
+  80533c:	56                   	push   %esi
+  80533d:	89 c8                	mov    %ecx,%eax
+  80533f:	e8 30 fe ff ff       	call   805174 <udivmod>
+  805344:	83 c4 10             	add    $0x10,%esp
+  805347:	85 db                	test   %ebx,%ebx
+  805349:	78 10                	js     80535b <__moddi3+0x5e>
+  80534b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80534f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805353:	83 c4 14             	add    $0x14,%esp
+  805356:	5b                   	pop    %ebx
+  805357:	5e                   	pop    %esi
+  805358:	5f                   	pop    %edi
+  805359:	5d                   	pop    %ebp
+  80535a:	c3                   	ret
+  80535b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80535f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805363:	f7 d8                	neg    %eax
+  805365:	83 d2 00             	adc    $0x0,%edx
+  805368:	f7 da                	neg    %edx
+  80536a:	eb e7                	jmp    805353 <__moddi3+0x56>
@@ -0,0 +1,10511 @@
+
+obj/user/forktree.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b2 00 00 00       	call   8000e3 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <forktree>:
+	}
+}
+
+void
+forktree(const char *cur)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80003d:	e8 35 0c 00 00       	call   800c77 <sys_getenvid>
+  800042:	83 ec 04             	sub    $0x4,%esp
+  800045:	53                   	push   %ebx
+  800046:	50                   	push   %eax
+  800047:	68 c0 52 80 00       	push   $0x8052c0
+  80004c:	e8 8a 01 00 00       	call   8001db <cprintf>
+
+	forkchild(cur, '0');
+  800051:	83 c4 08             	add    $0x8,%esp
+  800054:	6a 30                	push   $0x30
+  800056:	53                   	push   %ebx
+  800057:	e8 13 00 00 00       	call   80006f <forkchild>
+	forkchild(cur, '1');
+  80005c:	83 c4 08             	add    $0x8,%esp
+  80005f:	6a 31                	push   $0x31
+  800061:	53                   	push   %ebx
+  800062:	e8 08 00 00 00       	call   80006f <forkchild>
+}
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80006d:	c9                   	leave
+  80006e:	c3                   	ret
+
+0080006f <forkchild>:
+{
+  80006f:	55                   	push   %ebp
+  800070:	89 e5                	mov    %esp,%ebp
+  800072:	56                   	push   %esi
+  800073:	53                   	push   %ebx
+  800074:	83 ec 1c             	sub    $0x1c,%esp
+  800077:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80007a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if (strlen(cur) >= DEPTH)
+  80007d:	53                   	push   %ebx
+  80007e:	e8 04 07 00 00       	call   800787 <strlen>
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	83 f8 02             	cmp    $0x2,%eax
+  800089:	7e 07                	jle    800092 <forkchild+0x23>
+}
+  80008b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008e:	5b                   	pop    %ebx
+  80008f:	5e                   	pop    %esi
+  800090:	5d                   	pop    %ebp
+  800091:	c3                   	ret
+	snprintf(nxt, DEPTH+1, "%s%c", cur, branch);
+  800092:	83 ec 0c             	sub    $0xc,%esp
+  800095:	89 f0                	mov    %esi,%eax
+  800097:	0f be f0             	movsbl %al,%esi
+  80009a:	56                   	push   %esi
+  80009b:	53                   	push   %ebx
+  80009c:	68 d1 52 80 00       	push   $0x8052d1
+  8000a1:	6a 04                	push   $0x4
+  8000a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a6:	50                   	push   %eax
+  8000a7:	e8 c1 06 00 00       	call   80076d <snprintf>
+	if (fork() == 0) {
+  8000ac:	83 c4 20             	add    $0x20,%esp
+  8000af:	e8 e8 12 00 00       	call   80139c <fork>
+  8000b4:	85 c0                	test   %eax,%eax
+  8000b6:	75 d3                	jne    80008b <forkchild+0x1c>
+		forktree(nxt);
+  8000b8:	83 ec 0c             	sub    $0xc,%esp
+  8000bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000be:	50                   	push   %eax
+  8000bf:	e8 6f ff ff ff       	call   800033 <forktree>
+		exit();
+  8000c4:	e8 63 00 00 00       	call   80012c <exit>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+  8000cc:	eb bd                	jmp    80008b <forkchild+0x1c>
+
+008000ce <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000ce:	55                   	push   %ebp
+  8000cf:	89 e5                	mov    %esp,%ebp
+  8000d1:	83 ec 14             	sub    $0x14,%esp
+	forktree("");
+  8000d4:	68 d0 52 80 00       	push   $0x8052d0
+  8000d9:	e8 55 ff ff ff       	call   800033 <forktree>
+}
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	c9                   	leave
+  8000e2:	c3                   	ret
+
+008000e3 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	56                   	push   %esi
+  8000e7:	53                   	push   %ebx
+  8000e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8000ee:	e8 84 0b 00 00       	call   800c77 <sys_getenvid>
+  8000f3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f8:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8000fb:	c1 e0 06             	shl    $0x6,%eax
+  8000fe:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800103:	a3 18 e9 80 00       	mov    %eax,0x80e918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800108:	85 db                	test   %ebx,%ebx
+  80010a:	7e 07                	jle    800113 <libmain+0x30>
+		binaryname = argv[0];
+  80010c:	8b 06                	mov    (%esi),%eax
+  80010e:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800113:	83 ec 08             	sub    $0x8,%esp
+  800116:	56                   	push   %esi
+  800117:	53                   	push   %ebx
+  800118:	e8 b1 ff ff ff       	call   8000ce <umain>
+
+	// exit gracefully
+	exit();
+  80011d:	e8 0a 00 00 00       	call   80012c <exit>
+}
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800128:	5b                   	pop    %ebx
+  800129:	5e                   	pop    %esi
+  80012a:	5d                   	pop    %ebp
+  80012b:	c3                   	ret
+
+0080012c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80012c:	55                   	push   %ebp
+  80012d:	89 e5                	mov    %esp,%ebp
+  80012f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800132:	e8 98 18 00 00       	call   8019cf <close_all>
+	sys_env_destroy(0);
+  800137:	83 ec 0c             	sub    $0xc,%esp
+  80013a:	6a 00                	push   $0x0
+  80013c:	e8 f5 0a 00 00       	call   800c36 <sys_env_destroy>
+}
+  800141:	83 c4 10             	add    $0x10,%esp
+  800144:	c9                   	leave
+  800145:	c3                   	ret
+
+00800146 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800146:	55                   	push   %ebp
+  800147:	89 e5                	mov    %esp,%ebp
+  800149:	53                   	push   %ebx
+  80014a:	83 ec 04             	sub    $0x4,%esp
+  80014d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800150:	8b 13                	mov    (%ebx),%edx
+  800152:	8d 42 01             	lea    0x1(%edx),%eax
+  800155:	89 03                	mov    %eax,(%ebx)
+  800157:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80015a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80015e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800163:	74 09                	je     80016e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800165:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800169:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80016c:	c9                   	leave
+  80016d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80016e:	83 ec 08             	sub    $0x8,%esp
+  800171:	68 ff 00 00 00       	push   $0xff
+  800176:	8d 43 08             	lea    0x8(%ebx),%eax
+  800179:	50                   	push   %eax
+  80017a:	e8 69 0a 00 00       	call   800be8 <sys_cputs>
+		b->idx = 0;
+  80017f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800185:	83 c4 10             	add    $0x10,%esp
+  800188:	eb db                	jmp    800165 <putch+0x1f>
+
+0080018a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80018a:	55                   	push   %ebp
+  80018b:	89 e5                	mov    %esp,%ebp
+  80018d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800193:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80019a:	00 00 00 
+	b.cnt = 0;
+  80019d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001a4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001a7:	ff 75 0c             	push   0xc(%ebp)
+  8001aa:	ff 75 08             	push   0x8(%ebp)
+  8001ad:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001b3:	50                   	push   %eax
+  8001b4:	68 46 01 80 00       	push   $0x800146
+  8001b9:	e8 14 01 00 00       	call   8002d2 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001be:	83 c4 08             	add    $0x8,%esp
+  8001c1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001c7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001cd:	50                   	push   %eax
+  8001ce:	e8 15 0a 00 00       	call   800be8 <sys_cputs>
+
+	return b.cnt;
+}
+  8001d3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001d9:	c9                   	leave
+  8001da:	c3                   	ret
+
+008001db <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001db:	55                   	push   %ebp
+  8001dc:	89 e5                	mov    %esp,%ebp
+  8001de:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001e1:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001e4:	50                   	push   %eax
+  8001e5:	ff 75 08             	push   0x8(%ebp)
+  8001e8:	e8 9d ff ff ff       	call   80018a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001ed:	c9                   	leave
+  8001ee:	c3                   	ret
+
+008001ef <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001ef:	55                   	push   %ebp
+  8001f0:	89 e5                	mov    %esp,%ebp
+  8001f2:	57                   	push   %edi
+  8001f3:	56                   	push   %esi
+  8001f4:	53                   	push   %ebx
+  8001f5:	83 ec 1c             	sub    $0x1c,%esp
+  8001f8:	89 c7                	mov    %eax,%edi
+  8001fa:	89 d6                	mov    %edx,%esi
+  8001fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800202:	89 d1                	mov    %edx,%ecx
+  800204:	89 c2                	mov    %eax,%edx
+  800206:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800209:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80020c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80020f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800212:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800215:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80021c:	39 c2                	cmp    %eax,%edx
+  80021e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800221:	72 3e                	jb     800261 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800223:	83 ec 0c             	sub    $0xc,%esp
+  800226:	ff 75 18             	push   0x18(%ebp)
+  800229:	83 eb 01             	sub    $0x1,%ebx
+  80022c:	53                   	push   %ebx
+  80022d:	50                   	push   %eax
+  80022e:	83 ec 08             	sub    $0x8,%esp
+  800231:	ff 75 e4             	push   -0x1c(%ebp)
+  800234:	ff 75 e0             	push   -0x20(%ebp)
+  800237:	ff 75 dc             	push   -0x24(%ebp)
+  80023a:	ff 75 d8             	push   -0x28(%ebp)
+  80023d:	e8 48 4f 00 00       	call   80518a <__udivdi3>
+  800242:	83 c4 18             	add    $0x18,%esp
+  800245:	52                   	push   %edx
+  800246:	50                   	push   %eax
+  800247:	89 f2                	mov    %esi,%edx
+  800249:	89 f8                	mov    %edi,%eax
+  80024b:	e8 9f ff ff ff       	call   8001ef <printnum>
+  800250:	83 c4 20             	add    $0x20,%esp
+  800253:	eb 13                	jmp    800268 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800255:	83 ec 08             	sub    $0x8,%esp
+  800258:	56                   	push   %esi
+  800259:	ff 75 18             	push   0x18(%ebp)
+  80025c:	ff d7                	call   *%edi
+  80025e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800261:	83 eb 01             	sub    $0x1,%ebx
+  800264:	85 db                	test   %ebx,%ebx
+  800266:	7f ed                	jg     800255 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800268:	83 ec 08             	sub    $0x8,%esp
+  80026b:	56                   	push   %esi
+  80026c:	83 ec 04             	sub    $0x4,%esp
+  80026f:	ff 75 e4             	push   -0x1c(%ebp)
+  800272:	ff 75 e0             	push   -0x20(%ebp)
+  800275:	ff 75 dc             	push   -0x24(%ebp)
+  800278:	ff 75 d8             	push   -0x28(%ebp)
+  80027b:	e8 28 4f 00 00       	call   8051a8 <__umoddi3>
+  800280:	83 c4 14             	add    $0x14,%esp
+  800283:	0f be 80 e0 52 80 00 	movsbl 0x8052e0(%eax),%eax
+  80028a:	50                   	push   %eax
+  80028b:	ff d7                	call   *%edi
+}
+  80028d:	83 c4 10             	add    $0x10,%esp
+  800290:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800293:	5b                   	pop    %ebx
+  800294:	5e                   	pop    %esi
+  800295:	5f                   	pop    %edi
+  800296:	5d                   	pop    %ebp
+  800297:	c3                   	ret
+
+00800298 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800298:	55                   	push   %ebp
+  800299:	89 e5                	mov    %esp,%ebp
+  80029b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80029e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002a2:	8b 10                	mov    (%eax),%edx
+  8002a4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002a7:	73 0a                	jae    8002b3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002a9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002ac:	89 08                	mov    %ecx,(%eax)
+  8002ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002b1:	88 02                	mov    %al,(%edx)
+}
+  8002b3:	5d                   	pop    %ebp
+  8002b4:	c3                   	ret
+
+008002b5 <printfmt>:
+{
+  8002b5:	55                   	push   %ebp
+  8002b6:	89 e5                	mov    %esp,%ebp
+  8002b8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002bb:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002be:	50                   	push   %eax
+  8002bf:	ff 75 10             	push   0x10(%ebp)
+  8002c2:	ff 75 0c             	push   0xc(%ebp)
+  8002c5:	ff 75 08             	push   0x8(%ebp)
+  8002c8:	e8 05 00 00 00       	call   8002d2 <vprintfmt>
+}
+  8002cd:	83 c4 10             	add    $0x10,%esp
+  8002d0:	c9                   	leave
+  8002d1:	c3                   	ret
+
+008002d2 <vprintfmt>:
+{
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	57                   	push   %edi
+  8002d6:	56                   	push   %esi
+  8002d7:	53                   	push   %ebx
+  8002d8:	83 ec 2c             	sub    $0x2c,%esp
+  8002db:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002e1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002e4:	eb 0a                	jmp    8002f0 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002e6:	83 ec 08             	sub    $0x8,%esp
+  8002e9:	53                   	push   %ebx
+  8002ea:	50                   	push   %eax
+  8002eb:	ff d6                	call   *%esi
+  8002ed:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002f0:	83 c7 01             	add    $0x1,%edi
+  8002f3:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002f7:	83 f8 25             	cmp    $0x25,%eax
+  8002fa:	74 0c                	je     800308 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002fc:	85 c0                	test   %eax,%eax
+  8002fe:	75 e6                	jne    8002e6 <vprintfmt+0x14>
+}
+  800300:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800303:	5b                   	pop    %ebx
+  800304:	5e                   	pop    %esi
+  800305:	5f                   	pop    %edi
+  800306:	5d                   	pop    %ebp
+  800307:	c3                   	ret
+		padc = ' ';
+  800308:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80030c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800313:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80031a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800321:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800326:	8d 47 01             	lea    0x1(%edi),%eax
+  800329:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80032c:	0f b6 17             	movzbl (%edi),%edx
+  80032f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800332:	3c 55                	cmp    $0x55,%al
+  800334:	0f 87 c5 03 00 00    	ja     8006ff <vprintfmt+0x42d>
+  80033a:	0f b6 c0             	movzbl %al,%eax
+  80033d:	ff 24 85 60 54 80 00 	jmp    *0x805460(,%eax,4)
+  800344:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800347:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80034b:	eb d9                	jmp    800326 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80034d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800350:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800354:	eb d0                	jmp    800326 <vprintfmt+0x54>
+  800356:	0f b6 d2             	movzbl %dl,%edx
+  800359:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80035c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800361:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800364:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800367:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80036b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80036e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800371:	83 f9 09             	cmp    $0x9,%ecx
+  800374:	77 55                	ja     8003cb <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800376:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800379:	eb e9                	jmp    800364 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80037b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037e:	8b 00                	mov    (%eax),%eax
+  800380:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800383:	8b 45 14             	mov    0x14(%ebp),%eax
+  800386:	8d 40 04             	lea    0x4(%eax),%eax
+  800389:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80038c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80038f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800393:	79 91                	jns    800326 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800395:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800398:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80039b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003a2:	eb 82                	jmp    800326 <vprintfmt+0x54>
+			if (width < 0)
+  8003a4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003a7:	85 d2                	test   %edx,%edx
+  8003a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ae:	0f 49 c2             	cmovns %edx,%eax
+  8003b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003b7:	e9 6a ff ff ff       	jmp    800326 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003bf:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003c6:	e9 5b ff ff ff       	jmp    800326 <vprintfmt+0x54>
+  8003cb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ce:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003d1:	eb bc                	jmp    80038f <vprintfmt+0xbd>
+			lflag++;
+  8003d3:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003d9:	e9 48 ff ff ff       	jmp    800326 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e1:	8d 78 04             	lea    0x4(%eax),%edi
+  8003e4:	83 ec 08             	sub    $0x8,%esp
+  8003e7:	53                   	push   %ebx
+  8003e8:	ff 30                	push   (%eax)
+  8003ea:	ff d6                	call   *%esi
+			break;
+  8003ec:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003ef:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003f2:	e9 63 02 00 00       	jmp    80065a <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8003f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fa:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003fd:	8b 10                	mov    (%eax),%edx
+  8003ff:	89 d0                	mov    %edx,%eax
+  800401:	f7 d8                	neg    %eax
+  800403:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800406:	83 f8 12             	cmp    $0x12,%eax
+  800409:	7f 23                	jg     80042e <vprintfmt+0x15c>
+  80040b:	8b 14 85 c0 55 80 00 	mov    0x8055c0(,%eax,4),%edx
+  800412:	85 d2                	test   %edx,%edx
+  800414:	74 18                	je     80042e <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800416:	52                   	push   %edx
+  800417:	68 ed 57 80 00       	push   $0x8057ed
+  80041c:	53                   	push   %ebx
+  80041d:	56                   	push   %esi
+  80041e:	e8 92 fe ff ff       	call   8002b5 <printfmt>
+  800423:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800426:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800429:	e9 2c 02 00 00       	jmp    80065a <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80042e:	50                   	push   %eax
+  80042f:	68 f8 52 80 00       	push   $0x8052f8
+  800434:	53                   	push   %ebx
+  800435:	56                   	push   %esi
+  800436:	e8 7a fe ff ff       	call   8002b5 <printfmt>
+  80043b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80043e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800441:	e9 14 02 00 00       	jmp    80065a <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800446:	8b 45 14             	mov    0x14(%ebp),%eax
+  800449:	83 c0 04             	add    $0x4,%eax
+  80044c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80044f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800452:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800454:	85 c9                	test   %ecx,%ecx
+  800456:	b8 f1 52 80 00       	mov    $0x8052f1,%eax
+  80045b:	0f 45 c1             	cmovne %ecx,%eax
+  80045e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800461:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800465:	7e 06                	jle    80046d <vprintfmt+0x19b>
+  800467:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80046b:	75 0b                	jne    800478 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80046d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800470:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800473:	89 75 08             	mov    %esi,0x8(%ebp)
+  800476:	eb 5c                	jmp    8004d4 <vprintfmt+0x202>
+  800478:	83 ec 08             	sub    $0x8,%esp
+  80047b:	ff 75 d0             	push   -0x30(%ebp)
+  80047e:	ff 75 cc             	push   -0x34(%ebp)
+  800481:	e8 19 03 00 00       	call   80079f <strnlen>
+  800486:	89 c2                	mov    %eax,%edx
+  800488:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80048b:	29 d0                	sub    %edx,%eax
+  80048d:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800490:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800494:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800497:	89 75 08             	mov    %esi,0x8(%ebp)
+  80049a:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80049c:	eb 0e                	jmp    8004ac <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80049e:	83 ec 08             	sub    $0x8,%esp
+  8004a1:	53                   	push   %ebx
+  8004a2:	57                   	push   %edi
+  8004a3:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004a6:	83 ee 01             	sub    $0x1,%esi
+  8004a9:	83 c4 10             	add    $0x10,%esp
+  8004ac:	85 f6                	test   %esi,%esi
+  8004ae:	7f ee                	jg     80049e <vprintfmt+0x1cc>
+  8004b0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004b3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004b6:	85 c0                	test   %eax,%eax
+  8004b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004bd:	0f 49 d0             	cmovns %eax,%edx
+  8004c0:	29 d0                	sub    %edx,%eax
+  8004c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c5:	eb a6                	jmp    80046d <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004c7:	83 ec 08             	sub    $0x8,%esp
+  8004ca:	53                   	push   %ebx
+  8004cb:	52                   	push   %edx
+  8004cc:	ff 55 08             	call   *0x8(%ebp)
+  8004cf:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004d2:	89 f1                	mov    %esi,%ecx
+  8004d4:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004d7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004db:	0f be d0             	movsbl %al,%edx
+  8004de:	85 d2                	test   %edx,%edx
+  8004e0:	74 28                	je     80050a <vprintfmt+0x238>
+  8004e2:	85 ff                	test   %edi,%edi
+  8004e4:	78 05                	js     8004eb <vprintfmt+0x219>
+  8004e6:	83 ef 01             	sub    $0x1,%edi
+  8004e9:	78 30                	js     80051b <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004eb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004ef:	74 d6                	je     8004c7 <vprintfmt+0x1f5>
+  8004f1:	0f be c0             	movsbl %al,%eax
+  8004f4:	83 e8 20             	sub    $0x20,%eax
+  8004f7:	83 f8 5e             	cmp    $0x5e,%eax
+  8004fa:	76 cb                	jbe    8004c7 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004fc:	83 ec 08             	sub    $0x8,%esp
+  8004ff:	53                   	push   %ebx
+  800500:	6a 3f                	push   $0x3f
+  800502:	ff 55 08             	call   *0x8(%ebp)
+  800505:	83 c4 10             	add    $0x10,%esp
+  800508:	eb c8                	jmp    8004d2 <vprintfmt+0x200>
+  80050a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800510:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800513:	01 d0                	add    %edx,%eax
+  800515:	29 c8                	sub    %ecx,%eax
+  800517:	89 c7                	mov    %eax,%edi
+  800519:	eb 13                	jmp    80052e <vprintfmt+0x25c>
+  80051b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80051e:	eb ed                	jmp    80050d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800520:	83 ec 08             	sub    $0x8,%esp
+  800523:	53                   	push   %ebx
+  800524:	6a 20                	push   $0x20
+  800526:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800528:	83 ef 01             	sub    $0x1,%edi
+  80052b:	83 c4 10             	add    $0x10,%esp
+  80052e:	85 ff                	test   %edi,%edi
+  800530:	7f ee                	jg     800520 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800532:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800535:	89 45 14             	mov    %eax,0x14(%ebp)
+  800538:	e9 1d 01 00 00       	jmp    80065a <vprintfmt+0x388>
+	if (lflag >= 2)
+  80053d:	83 f9 01             	cmp    $0x1,%ecx
+  800540:	7f 1b                	jg     80055d <vprintfmt+0x28b>
+	else if (lflag)
+  800542:	85 c9                	test   %ecx,%ecx
+  800544:	74 63                	je     8005a9 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800546:	8b 45 14             	mov    0x14(%ebp),%eax
+  800549:	8b 00                	mov    (%eax),%eax
+  80054b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80054e:	99                   	cltd
+  80054f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800552:	8b 45 14             	mov    0x14(%ebp),%eax
+  800555:	8d 40 04             	lea    0x4(%eax),%eax
+  800558:	89 45 14             	mov    %eax,0x14(%ebp)
+  80055b:	eb 17                	jmp    800574 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80055d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800560:	8b 50 04             	mov    0x4(%eax),%edx
+  800563:	8b 00                	mov    (%eax),%eax
+  800565:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800568:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80056b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056e:	8d 40 08             	lea    0x8(%eax),%eax
+  800571:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800574:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800577:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80057a:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80057f:	85 c9                	test   %ecx,%ecx
+  800581:	0f 89 b9 00 00 00    	jns    800640 <vprintfmt+0x36e>
+				putch('-', putdat);
+  800587:	83 ec 08             	sub    $0x8,%esp
+  80058a:	53                   	push   %ebx
+  80058b:	6a 2d                	push   $0x2d
+  80058d:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80058f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800592:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800595:	f7 da                	neg    %edx
+  800597:	83 d1 00             	adc    $0x0,%ecx
+  80059a:	f7 d9                	neg    %ecx
+  80059c:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80059f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005a4:	e9 97 00 00 00       	jmp    800640 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8005a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ac:	8b 00                	mov    (%eax),%eax
+  8005ae:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b1:	99                   	cltd
+  8005b2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005be:	eb b4                	jmp    800574 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8005c0:	83 f9 01             	cmp    $0x1,%ecx
+  8005c3:	7f 1b                	jg     8005e0 <vprintfmt+0x30e>
+	else if (lflag)
+  8005c5:	85 c9                	test   %ecx,%ecx
+  8005c7:	74 2c                	je     8005f5 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8005c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cc:	8b 10                	mov    (%eax),%edx
+  8005ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005d9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005de:	eb 60                	jmp    800640 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8005e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e3:	8b 10                	mov    (%eax),%edx
+  8005e5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005e8:	8d 40 08             	lea    0x8(%eax),%eax
+  8005eb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005ee:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005f3:	eb 4b                	jmp    800640 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8005f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f8:	8b 10                	mov    (%eax),%edx
+  8005fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800602:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800605:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80060a:	eb 34                	jmp    800640 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80060c:	83 f9 01             	cmp    $0x1,%ecx
+  80060f:	7f 15                	jg     800626 <vprintfmt+0x354>
+	else if (lflag)
+  800611:	85 c9                	test   %ecx,%ecx
+  800613:	74 4d                	je     800662 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800615:	8b 45 14             	mov    0x14(%ebp),%eax
+  800618:	8b 00                	mov    (%eax),%eax
+  80061a:	99                   	cltd
+  80061b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80061e:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800621:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800624:	eb 11                	jmp    800637 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800626:	8b 45 14             	mov    0x14(%ebp),%eax
+  800629:	8b 50 04             	mov    0x4(%eax),%edx
+  80062c:	8b 00                	mov    (%eax),%eax
+  80062e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800631:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800634:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800637:	89 d1                	mov    %edx,%ecx
+  800639:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  80063b:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800640:	83 ec 0c             	sub    $0xc,%esp
+  800643:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800647:	50                   	push   %eax
+  800648:	ff 75 e0             	push   -0x20(%ebp)
+  80064b:	57                   	push   %edi
+  80064c:	51                   	push   %ecx
+  80064d:	52                   	push   %edx
+  80064e:	89 da                	mov    %ebx,%edx
+  800650:	89 f0                	mov    %esi,%eax
+  800652:	e8 98 fb ff ff       	call   8001ef <printnum>
+			break;
+  800657:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80065a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80065d:	e9 8e fc ff ff       	jmp    8002f0 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800662:	8b 45 14             	mov    0x14(%ebp),%eax
+  800665:	8b 00                	mov    (%eax),%eax
+  800667:	99                   	cltd
+  800668:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80066b:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80066e:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800671:	eb c4                	jmp    800637 <vprintfmt+0x365>
+			putch('0', putdat);
+  800673:	83 ec 08             	sub    $0x8,%esp
+  800676:	53                   	push   %ebx
+  800677:	6a 30                	push   $0x30
+  800679:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80067b:	83 c4 08             	add    $0x8,%esp
+  80067e:	53                   	push   %ebx
+  80067f:	6a 78                	push   $0x78
+  800681:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800683:	8b 45 14             	mov    0x14(%ebp),%eax
+  800686:	8b 10                	mov    (%eax),%edx
+  800688:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80068d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800690:	8d 40 04             	lea    0x4(%eax),%eax
+  800693:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800696:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  80069b:	eb a3                	jmp    800640 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80069d:	83 f9 01             	cmp    $0x1,%ecx
+  8006a0:	7f 1b                	jg     8006bd <vprintfmt+0x3eb>
+	else if (lflag)
+  8006a2:	85 c9                	test   %ecx,%ecx
+  8006a4:	74 2f                	je     8006d5 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8006a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a9:	8b 10                	mov    (%eax),%edx
+  8006ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006bb:	eb 83                	jmp    800640 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8006bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c0:	8b 10                	mov    (%eax),%edx
+  8006c2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006c5:	8d 40 08             	lea    0x8(%eax),%eax
+  8006c8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006cb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006d0:	e9 6b ff ff ff       	jmp    800640 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8006d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d8:	8b 10                	mov    (%eax),%edx
+  8006da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006df:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006ea:	e9 51 ff ff ff       	jmp    800640 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8006ef:	83 ec 08             	sub    $0x8,%esp
+  8006f2:	53                   	push   %ebx
+  8006f3:	6a 25                	push   $0x25
+  8006f5:	ff d6                	call   *%esi
+			break;
+  8006f7:	83 c4 10             	add    $0x10,%esp
+  8006fa:	e9 5b ff ff ff       	jmp    80065a <vprintfmt+0x388>
+			putch('%', putdat);
+  8006ff:	83 ec 08             	sub    $0x8,%esp
+  800702:	53                   	push   %ebx
+  800703:	6a 25                	push   $0x25
+  800705:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800707:	83 c4 10             	add    $0x10,%esp
+  80070a:	89 f8                	mov    %edi,%eax
+  80070c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800710:	74 05                	je     800717 <vprintfmt+0x445>
+  800712:	83 e8 01             	sub    $0x1,%eax
+  800715:	eb f5                	jmp    80070c <vprintfmt+0x43a>
+  800717:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80071a:	e9 3b ff ff ff       	jmp    80065a <vprintfmt+0x388>
+
+0080071f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80071f:	55                   	push   %ebp
+  800720:	89 e5                	mov    %esp,%ebp
+  800722:	83 ec 18             	sub    $0x18,%esp
+  800725:	8b 45 08             	mov    0x8(%ebp),%eax
+  800728:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80072b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80072e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800732:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800735:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80073c:	85 c0                	test   %eax,%eax
+  80073e:	74 26                	je     800766 <vsnprintf+0x47>
+  800740:	85 d2                	test   %edx,%edx
+  800742:	7e 22                	jle    800766 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800744:	ff 75 14             	push   0x14(%ebp)
+  800747:	ff 75 10             	push   0x10(%ebp)
+  80074a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80074d:	50                   	push   %eax
+  80074e:	68 98 02 80 00       	push   $0x800298
+  800753:	e8 7a fb ff ff       	call   8002d2 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800758:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80075b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80075e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800761:	83 c4 10             	add    $0x10,%esp
+}
+  800764:	c9                   	leave
+  800765:	c3                   	ret
+		return -E_INVAL;
+  800766:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80076b:	eb f7                	jmp    800764 <vsnprintf+0x45>
+
+0080076d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80076d:	55                   	push   %ebp
+  80076e:	89 e5                	mov    %esp,%ebp
+  800770:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800773:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800776:	50                   	push   %eax
+  800777:	ff 75 10             	push   0x10(%ebp)
+  80077a:	ff 75 0c             	push   0xc(%ebp)
+  80077d:	ff 75 08             	push   0x8(%ebp)
+  800780:	e8 9a ff ff ff       	call   80071f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800785:	c9                   	leave
+  800786:	c3                   	ret
+
+00800787 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800787:	55                   	push   %ebp
+  800788:	89 e5                	mov    %esp,%ebp
+  80078a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80078d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800792:	eb 03                	jmp    800797 <strlen+0x10>
+		n++;
+  800794:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800797:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80079b:	75 f7                	jne    800794 <strlen+0xd>
+	return n;
+}
+  80079d:	5d                   	pop    %ebp
+  80079e:	c3                   	ret
+
+0080079f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80079f:	55                   	push   %ebp
+  8007a0:	89 e5                	mov    %esp,%ebp
+  8007a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ad:	eb 03                	jmp    8007b2 <strnlen+0x13>
+		n++;
+  8007af:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007b2:	39 d0                	cmp    %edx,%eax
+  8007b4:	74 08                	je     8007be <strnlen+0x1f>
+  8007b6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007ba:	75 f3                	jne    8007af <strnlen+0x10>
+  8007bc:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007be:	89 d0                	mov    %edx,%eax
+  8007c0:	5d                   	pop    %ebp
+  8007c1:	c3                   	ret
+
+008007c2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007c2:	55                   	push   %ebp
+  8007c3:	89 e5                	mov    %esp,%ebp
+  8007c5:	53                   	push   %ebx
+  8007c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007d5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007d8:	83 c0 01             	add    $0x1,%eax
+  8007db:	84 d2                	test   %dl,%dl
+  8007dd:	75 f2                	jne    8007d1 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007df:	89 c8                	mov    %ecx,%eax
+  8007e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007e4:	c9                   	leave
+  8007e5:	c3                   	ret
+
+008007e6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007e6:	55                   	push   %ebp
+  8007e7:	89 e5                	mov    %esp,%ebp
+  8007e9:	53                   	push   %ebx
+  8007ea:	83 ec 10             	sub    $0x10,%esp
+  8007ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007f0:	53                   	push   %ebx
+  8007f1:	e8 91 ff ff ff       	call   800787 <strlen>
+  8007f6:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007f9:	ff 75 0c             	push   0xc(%ebp)
+  8007fc:	01 d8                	add    %ebx,%eax
+  8007fe:	50                   	push   %eax
+  8007ff:	e8 be ff ff ff       	call   8007c2 <strcpy>
+	return dst;
+}
+  800804:	89 d8                	mov    %ebx,%eax
+  800806:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800809:	c9                   	leave
+  80080a:	c3                   	ret
+
+0080080b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80080b:	55                   	push   %ebp
+  80080c:	89 e5                	mov    %esp,%ebp
+  80080e:	56                   	push   %esi
+  80080f:	53                   	push   %ebx
+  800810:	8b 75 08             	mov    0x8(%ebp),%esi
+  800813:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800816:	89 f3                	mov    %esi,%ebx
+  800818:	03 5d 10             	add    0x10(%ebp),%ebx
+  80081b:	89 f0                	mov    %esi,%eax
+  80081d:	eb 0f                	jmp    80082e <strncpy+0x23>
+		*dst++ = *src;
+  80081f:	83 c0 01             	add    $0x1,%eax
+  800822:	0f b6 0a             	movzbl (%edx),%ecx
+  800825:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800828:	80 f9 01             	cmp    $0x1,%cl
+  80082b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80082e:	39 d8                	cmp    %ebx,%eax
+  800830:	75 ed                	jne    80081f <strncpy+0x14>
+	}
+	return ret;
+}
+  800832:	89 f0                	mov    %esi,%eax
+  800834:	5b                   	pop    %ebx
+  800835:	5e                   	pop    %esi
+  800836:	5d                   	pop    %ebp
+  800837:	c3                   	ret
+
+00800838 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800838:	55                   	push   %ebp
+  800839:	89 e5                	mov    %esp,%ebp
+  80083b:	56                   	push   %esi
+  80083c:	53                   	push   %ebx
+  80083d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800840:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800843:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800846:	89 f0                	mov    %esi,%eax
+  800848:	85 d2                	test   %edx,%edx
+  80084a:	74 21                	je     80086d <strlcpy+0x35>
+  80084c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800850:	89 f2                	mov    %esi,%edx
+  800852:	eb 09                	jmp    80085d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800854:	83 c1 01             	add    $0x1,%ecx
+  800857:	83 c2 01             	add    $0x1,%edx
+  80085a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80085d:	39 c2                	cmp    %eax,%edx
+  80085f:	74 09                	je     80086a <strlcpy+0x32>
+  800861:	0f b6 19             	movzbl (%ecx),%ebx
+  800864:	84 db                	test   %bl,%bl
+  800866:	75 ec                	jne    800854 <strlcpy+0x1c>
+  800868:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80086a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80086d:	29 f0                	sub    %esi,%eax
+}
+  80086f:	5b                   	pop    %ebx
+  800870:	5e                   	pop    %esi
+  800871:	5d                   	pop    %ebp
+  800872:	c3                   	ret
+
+00800873 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800873:	55                   	push   %ebp
+  800874:	89 e5                	mov    %esp,%ebp
+  800876:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800879:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80087c:	eb 06                	jmp    800884 <strcmp+0x11>
+		p++, q++;
+  80087e:	83 c1 01             	add    $0x1,%ecx
+  800881:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800884:	0f b6 01             	movzbl (%ecx),%eax
+  800887:	84 c0                	test   %al,%al
+  800889:	74 04                	je     80088f <strcmp+0x1c>
+  80088b:	3a 02                	cmp    (%edx),%al
+  80088d:	74 ef                	je     80087e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80088f:	0f b6 c0             	movzbl %al,%eax
+  800892:	0f b6 12             	movzbl (%edx),%edx
+  800895:	29 d0                	sub    %edx,%eax
+}
+  800897:	5d                   	pop    %ebp
+  800898:	c3                   	ret
+
+00800899 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800899:	55                   	push   %ebp
+  80089a:	89 e5                	mov    %esp,%ebp
+  80089c:	53                   	push   %ebx
+  80089d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008a3:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008a6:	eb 09                	jmp    8008b1 <strncmp+0x18>
+		n--, p++, q++;
+  8008a8:	83 ea 01             	sub    $0x1,%edx
+  8008ab:	83 c0 01             	add    $0x1,%eax
+  8008ae:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008b1:	85 d2                	test   %edx,%edx
+  8008b3:	74 18                	je     8008cd <strncmp+0x34>
+  8008b5:	0f b6 18             	movzbl (%eax),%ebx
+  8008b8:	84 db                	test   %bl,%bl
+  8008ba:	74 04                	je     8008c0 <strncmp+0x27>
+  8008bc:	3a 19                	cmp    (%ecx),%bl
+  8008be:	74 e8                	je     8008a8 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008c0:	0f b6 00             	movzbl (%eax),%eax
+  8008c3:	0f b6 11             	movzbl (%ecx),%edx
+  8008c6:	29 d0                	sub    %edx,%eax
+}
+  8008c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008cb:	c9                   	leave
+  8008cc:	c3                   	ret
+		return 0;
+  8008cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d2:	eb f4                	jmp    8008c8 <strncmp+0x2f>
+
+008008d4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008d4:	55                   	push   %ebp
+  8008d5:	89 e5                	mov    %esp,%ebp
+  8008d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008da:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008de:	eb 03                	jmp    8008e3 <strchr+0xf>
+  8008e0:	83 c0 01             	add    $0x1,%eax
+  8008e3:	0f b6 10             	movzbl (%eax),%edx
+  8008e6:	84 d2                	test   %dl,%dl
+  8008e8:	74 06                	je     8008f0 <strchr+0x1c>
+		if (*s == c)
+  8008ea:	38 ca                	cmp    %cl,%dl
+  8008ec:	75 f2                	jne    8008e0 <strchr+0xc>
+  8008ee:	eb 05                	jmp    8008f5 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008f5:	5d                   	pop    %ebp
+  8008f6:	c3                   	ret
+
+008008f7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008f7:	55                   	push   %ebp
+  8008f8:	89 e5                	mov    %esp,%ebp
+  8008fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008fd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800901:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800904:	38 ca                	cmp    %cl,%dl
+  800906:	74 09                	je     800911 <strfind+0x1a>
+  800908:	84 d2                	test   %dl,%dl
+  80090a:	74 05                	je     800911 <strfind+0x1a>
+	for (; *s; s++)
+  80090c:	83 c0 01             	add    $0x1,%eax
+  80090f:	eb f0                	jmp    800901 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800911:	5d                   	pop    %ebp
+  800912:	c3                   	ret
+
+00800913 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800913:	55                   	push   %ebp
+  800914:	89 e5                	mov    %esp,%ebp
+  800916:	57                   	push   %edi
+  800917:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80091a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80091d:	85 c9                	test   %ecx,%ecx
+  80091f:	74 20                	je     800941 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800921:	89 f8                	mov    %edi,%eax
+  800923:	09 c8                	or     %ecx,%eax
+  800925:	a8 03                	test   $0x3,%al
+  800927:	75 12                	jne    80093b <memset+0x28>
+		c &= 0xFF;
+  800929:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80092d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800933:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800936:	fc                   	cld
+  800937:	f3 ab                	rep stos %eax,%es:(%edi)
+  800939:	eb 06                	jmp    800941 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80093b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80093e:	fc                   	cld
+  80093f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800941:	89 f8                	mov    %edi,%eax
+  800943:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800946:	c9                   	leave
+  800947:	c3                   	ret
+
+00800948 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800948:	55                   	push   %ebp
+  800949:	89 e5                	mov    %esp,%ebp
+  80094b:	57                   	push   %edi
+  80094c:	56                   	push   %esi
+  80094d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800950:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800953:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800956:	39 c6                	cmp    %eax,%esi
+  800958:	73 32                	jae    80098c <memmove+0x44>
+  80095a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80095d:	39 d0                	cmp    %edx,%eax
+  80095f:	73 2b                	jae    80098c <memmove+0x44>
+		s += n;
+		d += n;
+  800961:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800964:	89 d6                	mov    %edx,%esi
+  800966:	09 fe                	or     %edi,%esi
+  800968:	09 ce                	or     %ecx,%esi
+  80096a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800970:	75 0e                	jne    800980 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800972:	83 ef 04             	sub    $0x4,%edi
+  800975:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800978:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80097b:	fd                   	std
+  80097c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80097e:	eb 09                	jmp    800989 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800980:	83 ef 01             	sub    $0x1,%edi
+  800983:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800986:	fd                   	std
+  800987:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800989:	fc                   	cld
+  80098a:	eb 1a                	jmp    8009a6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80098c:	89 f2                	mov    %esi,%edx
+  80098e:	09 c2                	or     %eax,%edx
+  800990:	09 ca                	or     %ecx,%edx
+  800992:	f6 c2 03             	test   $0x3,%dl
+  800995:	75 0a                	jne    8009a1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800997:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80099a:	89 c7                	mov    %eax,%edi
+  80099c:	fc                   	cld
+  80099d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80099f:	eb 05                	jmp    8009a6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009a1:	89 c7                	mov    %eax,%edi
+  8009a3:	fc                   	cld
+  8009a4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009a6:	5e                   	pop    %esi
+  8009a7:	5f                   	pop    %edi
+  8009a8:	5d                   	pop    %ebp
+  8009a9:	c3                   	ret
+
+008009aa <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009aa:	55                   	push   %ebp
+  8009ab:	89 e5                	mov    %esp,%ebp
+  8009ad:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009b0:	ff 75 10             	push   0x10(%ebp)
+  8009b3:	ff 75 0c             	push   0xc(%ebp)
+  8009b6:	ff 75 08             	push   0x8(%ebp)
+  8009b9:	e8 8a ff ff ff       	call   800948 <memmove>
+}
+  8009be:	c9                   	leave
+  8009bf:	c3                   	ret
+
+008009c0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009c0:	55                   	push   %ebp
+  8009c1:	89 e5                	mov    %esp,%ebp
+  8009c3:	56                   	push   %esi
+  8009c4:	53                   	push   %ebx
+  8009c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009cb:	89 c6                	mov    %eax,%esi
+  8009cd:	03 75 10             	add    0x10(%ebp),%esi
+  8009d0:	eb 06                	jmp    8009d8 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009d2:	83 c0 01             	add    $0x1,%eax
+  8009d5:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009d8:	39 f0                	cmp    %esi,%eax
+  8009da:	74 14                	je     8009f0 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009dc:	0f b6 08             	movzbl (%eax),%ecx
+  8009df:	0f b6 1a             	movzbl (%edx),%ebx
+  8009e2:	38 d9                	cmp    %bl,%cl
+  8009e4:	74 ec                	je     8009d2 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009e6:	0f b6 c1             	movzbl %cl,%eax
+  8009e9:	0f b6 db             	movzbl %bl,%ebx
+  8009ec:	29 d8                	sub    %ebx,%eax
+  8009ee:	eb 05                	jmp    8009f5 <memcmp+0x35>
+	}
+
+	return 0;
+  8009f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009f5:	5b                   	pop    %ebx
+  8009f6:	5e                   	pop    %esi
+  8009f7:	5d                   	pop    %ebp
+  8009f8:	c3                   	ret
+
+008009f9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009f9:	55                   	push   %ebp
+  8009fa:	89 e5                	mov    %esp,%ebp
+  8009fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a02:	89 c2                	mov    %eax,%edx
+  800a04:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a07:	eb 03                	jmp    800a0c <memfind+0x13>
+  800a09:	83 c0 01             	add    $0x1,%eax
+  800a0c:	39 d0                	cmp    %edx,%eax
+  800a0e:	73 04                	jae    800a14 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a10:	38 08                	cmp    %cl,(%eax)
+  800a12:	75 f5                	jne    800a09 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a14:	5d                   	pop    %ebp
+  800a15:	c3                   	ret
+
+00800a16 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a16:	55                   	push   %ebp
+  800a17:	89 e5                	mov    %esp,%ebp
+  800a19:	57                   	push   %edi
+  800a1a:	56                   	push   %esi
+  800a1b:	53                   	push   %ebx
+  800a1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a22:	eb 03                	jmp    800a27 <strtol+0x11>
+		s++;
+  800a24:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a27:	0f b6 02             	movzbl (%edx),%eax
+  800a2a:	3c 20                	cmp    $0x20,%al
+  800a2c:	74 f6                	je     800a24 <strtol+0xe>
+  800a2e:	3c 09                	cmp    $0x9,%al
+  800a30:	74 f2                	je     800a24 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a32:	3c 2b                	cmp    $0x2b,%al
+  800a34:	74 2a                	je     800a60 <strtol+0x4a>
+	int neg = 0;
+  800a36:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a3b:	3c 2d                	cmp    $0x2d,%al
+  800a3d:	74 2b                	je     800a6a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a3f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a45:	75 0f                	jne    800a56 <strtol+0x40>
+  800a47:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a4a:	74 28                	je     800a74 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a4c:	85 db                	test   %ebx,%ebx
+  800a4e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a53:	0f 44 d8             	cmove  %eax,%ebx
+  800a56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a5b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a5e:	eb 46                	jmp    800aa6 <strtol+0x90>
+		s++;
+  800a60:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a63:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a68:	eb d5                	jmp    800a3f <strtol+0x29>
+		s++, neg = 1;
+  800a6a:	83 c2 01             	add    $0x1,%edx
+  800a6d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a72:	eb cb                	jmp    800a3f <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a74:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a78:	74 0e                	je     800a88 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a7a:	85 db                	test   %ebx,%ebx
+  800a7c:	75 d8                	jne    800a56 <strtol+0x40>
+		s++, base = 8;
+  800a7e:	83 c2 01             	add    $0x1,%edx
+  800a81:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a86:	eb ce                	jmp    800a56 <strtol+0x40>
+		s += 2, base = 16;
+  800a88:	83 c2 02             	add    $0x2,%edx
+  800a8b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a90:	eb c4                	jmp    800a56 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a92:	0f be c0             	movsbl %al,%eax
+  800a95:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a98:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a9b:	7d 3a                	jge    800ad7 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a9d:	83 c2 01             	add    $0x1,%edx
+  800aa0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800aa4:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800aa6:	0f b6 02             	movzbl (%edx),%eax
+  800aa9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800aac:	89 f3                	mov    %esi,%ebx
+  800aae:	80 fb 09             	cmp    $0x9,%bl
+  800ab1:	76 df                	jbe    800a92 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ab3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ab6:	89 f3                	mov    %esi,%ebx
+  800ab8:	80 fb 19             	cmp    $0x19,%bl
+  800abb:	77 08                	ja     800ac5 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800abd:	0f be c0             	movsbl %al,%eax
+  800ac0:	83 e8 57             	sub    $0x57,%eax
+  800ac3:	eb d3                	jmp    800a98 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ac5:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ac8:	89 f3                	mov    %esi,%ebx
+  800aca:	80 fb 19             	cmp    $0x19,%bl
+  800acd:	77 08                	ja     800ad7 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800acf:	0f be c0             	movsbl %al,%eax
+  800ad2:	83 e8 37             	sub    $0x37,%eax
+  800ad5:	eb c1                	jmp    800a98 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ad7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800adb:	74 05                	je     800ae2 <strtol+0xcc>
+		*endptr = (char *) s;
+  800add:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ae0:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ae2:	89 c8                	mov    %ecx,%eax
+  800ae4:	f7 d8                	neg    %eax
+  800ae6:	85 ff                	test   %edi,%edi
+  800ae8:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800aeb:	89 c8                	mov    %ecx,%eax
+  800aed:	5b                   	pop    %ebx
+  800aee:	5e                   	pop    %esi
+  800aef:	5f                   	pop    %edi
+  800af0:	5d                   	pop    %ebp
+  800af1:	c3                   	ret
+
+00800af2 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800af2:	55                   	push   %ebp
+  800af3:	89 e5                	mov    %esp,%ebp
+  800af5:	57                   	push   %edi
+  800af6:	56                   	push   %esi
+  800af7:	53                   	push   %ebx
+  800af8:	83 ec 0c             	sub    $0xc,%esp
+  800afb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800afe:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b01:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800b04:	85 ff                	test   %edi,%edi
+  800b06:	74 16                	je     800b1e <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800b08:	83 ec 04             	sub    $0x4,%esp
+  800b0b:	56                   	push   %esi
+  800b0c:	6a 00                	push   $0x0
+  800b0e:	53                   	push   %ebx
+  800b0f:	e8 02 ff ff ff       	call   800a16 <strtol>
+  800b14:	89 07                	mov    %eax,(%edi)
+  800b16:	83 c4 10             	add    $0x10,%esp
+  800b19:	eb 03                	jmp    800b1e <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800b1b:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800b1e:	0f b6 03             	movzbl (%ebx),%eax
+  800b21:	3c 20                	cmp    $0x20,%al
+  800b23:	74 f6                	je     800b1b <strisl+0x29>
+  800b25:	3c 09                	cmp    $0x9,%al
+  800b27:	74 f2                	je     800b1b <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b29:	3c 2b                	cmp    $0x2b,%al
+  800b2b:	74 23                	je     800b50 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800b2d:	3c 2d                	cmp    $0x2d,%al
+  800b2f:	0f 94 c0             	sete   %al
+  800b32:	0f b6 c0             	movzbl %al,%eax
+  800b35:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b37:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800b3d:	75 41                	jne    800b80 <strisl+0x8e>
+  800b3f:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800b42:	74 11                	je     800b55 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b44:	85 f6                	test   %esi,%esi
+  800b46:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b4b:	0f 44 f0             	cmove  %eax,%esi
+  800b4e:	eb 30                	jmp    800b80 <strisl+0x8e>
+		s++;
+  800b50:	83 c3 01             	add    $0x1,%ebx
+  800b53:	eb e2                	jmp    800b37 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b55:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800b59:	74 0e                	je     800b69 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800b5b:	85 f6                	test   %esi,%esi
+  800b5d:	75 21                	jne    800b80 <strisl+0x8e>
+		s++, base = 8;
+  800b5f:	83 c3 01             	add    $0x1,%ebx
+  800b62:	be 08 00 00 00       	mov    $0x8,%esi
+  800b67:	eb 17                	jmp    800b80 <strisl+0x8e>
+		s += 2, base = 16;
+  800b69:	83 c3 02             	add    $0x2,%ebx
+  800b6c:	be 10 00 00 00       	mov    $0x10,%esi
+  800b71:	eb 0d                	jmp    800b80 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b73:	0f be c0             	movsbl %al,%eax
+  800b76:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800b79:	39 f0                	cmp    %esi,%eax
+  800b7b:	7d 38                	jge    800bb5 <strisl+0xc3>
+			return 0;
+		s++;
+  800b7d:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800b80:	0f b6 03             	movzbl (%ebx),%eax
+  800b83:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800b86:	80 fa 09             	cmp    $0x9,%dl
+  800b89:	76 e8                	jbe    800b73 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800b8b:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800b8e:	80 fa 19             	cmp    $0x19,%dl
+  800b91:	77 08                	ja     800b9b <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800b93:	0f be c0             	movsbl %al,%eax
+  800b96:	83 e8 57             	sub    $0x57,%eax
+  800b99:	eb de                	jmp    800b79 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b9b:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800b9e:	80 fa 19             	cmp    $0x19,%dl
+  800ba1:	77 08                	ja     800bab <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800ba3:	0f be c0             	movsbl %al,%eax
+  800ba6:	83 e8 37             	sub    $0x37,%eax
+  800ba9:	eb ce                	jmp    800b79 <strisl+0x87>
+		else if (!*s)
+  800bab:	84 c0                	test   %al,%al
+  800bad:	0f 94 c0             	sete   %al
+  800bb0:	0f b6 c0             	movzbl %al,%eax
+  800bb3:	eb 05                	jmp    800bba <strisl+0xc8>
+			return 0;
+  800bb5:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800bba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bbd:	5b                   	pop    %ebx
+  800bbe:	5e                   	pop    %esi
+  800bbf:	5f                   	pop    %edi
+  800bc0:	5d                   	pop    %ebp
+  800bc1:	c3                   	ret
+
+00800bc2 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800bc2:	55                   	push   %ebp
+  800bc3:	89 e5                	mov    %esp,%ebp
+  800bc5:	83 ec 10             	sub    $0x10,%esp
+  800bc8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800bcb:	89 c8                	mov    %ecx,%eax
+  800bcd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800bd2:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800bd5:	eb 0b                	jmp    800be2 <touch_mem+0x20>
+		c = *(char *)page;
+  800bd7:	0f b6 10             	movzbl (%eax),%edx
+  800bda:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800bdd:	05 00 10 00 00       	add    $0x1000,%eax
+  800be2:	39 c8                	cmp    %ecx,%eax
+  800be4:	72 f1                	jb     800bd7 <touch_mem+0x15>
+}
+  800be6:	c9                   	leave
+  800be7:	c3                   	ret
+
+00800be8 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800be8:	55                   	push   %ebp
+  800be9:	89 e5                	mov    %esp,%ebp
+  800beb:	57                   	push   %edi
+  800bec:	56                   	push   %esi
+  800bed:	53                   	push   %ebx
+	touch_mem(s, len);
+  800bee:	ff 75 0c             	push   0xc(%ebp)
+  800bf1:	ff 75 08             	push   0x8(%ebp)
+  800bf4:	e8 c9 ff ff ff       	call   800bc2 <touch_mem>
+	asm volatile("int %1\n"
+  800bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c04:	89 c3                	mov    %eax,%ebx
+  800c06:	89 c7                	mov    %eax,%edi
+  800c08:	89 c6                	mov    %eax,%esi
+  800c0a:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c0c:	83 c4 08             	add    $0x8,%esp
+  800c0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c12:	5b                   	pop    %ebx
+  800c13:	5e                   	pop    %esi
+  800c14:	5f                   	pop    %edi
+  800c15:	5d                   	pop    %ebp
+  800c16:	c3                   	ret
+
+00800c17 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c17:	55                   	push   %ebp
+  800c18:	89 e5                	mov    %esp,%ebp
+  800c1a:	57                   	push   %edi
+  800c1b:	56                   	push   %esi
+  800c1c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c22:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c27:	89 d1                	mov    %edx,%ecx
+  800c29:	89 d3                	mov    %edx,%ebx
+  800c2b:	89 d7                	mov    %edx,%edi
+  800c2d:	89 d6                	mov    %edx,%esi
+  800c2f:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c31:	5b                   	pop    %ebx
+  800c32:	5e                   	pop    %esi
+  800c33:	5f                   	pop    %edi
+  800c34:	5d                   	pop    %ebp
+  800c35:	c3                   	ret
+
+00800c36 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c36:	55                   	push   %ebp
+  800c37:	89 e5                	mov    %esp,%ebp
+  800c39:	57                   	push   %edi
+  800c3a:	56                   	push   %esi
+  800c3b:	53                   	push   %ebx
+  800c3c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c3f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c47:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c4c:	89 cb                	mov    %ecx,%ebx
+  800c4e:	89 cf                	mov    %ecx,%edi
+  800c50:	89 ce                	mov    %ecx,%esi
+  800c52:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c54:	85 c0                	test   %eax,%eax
+  800c56:	7f 08                	jg     800c60 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c5b:	5b                   	pop    %ebx
+  800c5c:	5e                   	pop    %esi
+  800c5d:	5f                   	pop    %edi
+  800c5e:	5d                   	pop    %ebp
+  800c5f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c60:	83 ec 0c             	sub    $0xc,%esp
+  800c63:	50                   	push   %eax
+  800c64:	6a 03                	push   $0x3
+  800c66:	68 2b 56 80 00       	push   $0x80562b
+  800c6b:	6a 23                	push   $0x23
+  800c6d:	68 48 56 80 00       	push   $0x805648
+  800c72:	e8 24 40 00 00       	call   804c9b <_panic>
+
+00800c77 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c77:	55                   	push   %ebp
+  800c78:	89 e5                	mov    %esp,%ebp
+  800c7a:	57                   	push   %edi
+  800c7b:	56                   	push   %esi
+  800c7c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c82:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c87:	89 d1                	mov    %edx,%ecx
+  800c89:	89 d3                	mov    %edx,%ebx
+  800c8b:	89 d7                	mov    %edx,%edi
+  800c8d:	89 d6                	mov    %edx,%esi
+  800c8f:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c91:	5b                   	pop    %ebx
+  800c92:	5e                   	pop    %esi
+  800c93:	5f                   	pop    %edi
+  800c94:	5d                   	pop    %ebp
+  800c95:	c3                   	ret
+
+00800c96 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c96:	55                   	push   %ebp
+  800c97:	89 e5                	mov    %esp,%ebp
+  800c99:	57                   	push   %edi
+  800c9a:	56                   	push   %esi
+  800c9b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ca6:	89 d1                	mov    %edx,%ecx
+  800ca8:	89 d3                	mov    %edx,%ebx
+  800caa:	89 d7                	mov    %edx,%edi
+  800cac:	89 d6                	mov    %edx,%esi
+  800cae:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cb0:	5b                   	pop    %ebx
+  800cb1:	5e                   	pop    %esi
+  800cb2:	5f                   	pop    %edi
+  800cb3:	5d                   	pop    %ebp
+  800cb4:	c3                   	ret
+
+00800cb5 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cb5:	55                   	push   %ebp
+  800cb6:	89 e5                	mov    %esp,%ebp
+  800cb8:	57                   	push   %edi
+  800cb9:	56                   	push   %esi
+  800cba:	53                   	push   %ebx
+  800cbb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cbe:	be 00 00 00 00       	mov    $0x0,%esi
+  800cc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc9:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cd1:	89 f7                	mov    %esi,%edi
+  800cd3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cd5:	85 c0                	test   %eax,%eax
+  800cd7:	7f 08                	jg     800ce1 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdc:	5b                   	pop    %ebx
+  800cdd:	5e                   	pop    %esi
+  800cde:	5f                   	pop    %edi
+  800cdf:	5d                   	pop    %ebp
+  800ce0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ce1:	83 ec 0c             	sub    $0xc,%esp
+  800ce4:	50                   	push   %eax
+  800ce5:	6a 04                	push   $0x4
+  800ce7:	68 2b 56 80 00       	push   $0x80562b
+  800cec:	6a 23                	push   $0x23
+  800cee:	68 48 56 80 00       	push   $0x805648
+  800cf3:	e8 a3 3f 00 00       	call   804c9b <_panic>
+
+00800cf8 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cf8:	55                   	push   %ebp
+  800cf9:	89 e5                	mov    %esp,%ebp
+  800cfb:	57                   	push   %edi
+  800cfc:	56                   	push   %esi
+  800cfd:	53                   	push   %ebx
+  800cfe:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d07:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d0c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d0f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d12:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d15:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d17:	85 c0                	test   %eax,%eax
+  800d19:	7f 08                	jg     800d23 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1e:	5b                   	pop    %ebx
+  800d1f:	5e                   	pop    %esi
+  800d20:	5f                   	pop    %edi
+  800d21:	5d                   	pop    %ebp
+  800d22:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d23:	83 ec 0c             	sub    $0xc,%esp
+  800d26:	50                   	push   %eax
+  800d27:	6a 05                	push   $0x5
+  800d29:	68 2b 56 80 00       	push   $0x80562b
+  800d2e:	6a 23                	push   $0x23
+  800d30:	68 48 56 80 00       	push   $0x805648
+  800d35:	e8 61 3f 00 00       	call   804c9b <_panic>
+
+00800d3a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d3a:	55                   	push   %ebp
+  800d3b:	89 e5                	mov    %esp,%ebp
+  800d3d:	57                   	push   %edi
+  800d3e:	56                   	push   %esi
+  800d3f:	53                   	push   %ebx
+  800d40:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d53:	89 df                	mov    %ebx,%edi
+  800d55:	89 de                	mov    %ebx,%esi
+  800d57:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d59:	85 c0                	test   %eax,%eax
+  800d5b:	7f 08                	jg     800d65 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d60:	5b                   	pop    %ebx
+  800d61:	5e                   	pop    %esi
+  800d62:	5f                   	pop    %edi
+  800d63:	5d                   	pop    %ebp
+  800d64:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d65:	83 ec 0c             	sub    $0xc,%esp
+  800d68:	50                   	push   %eax
+  800d69:	6a 06                	push   $0x6
+  800d6b:	68 2b 56 80 00       	push   $0x80562b
+  800d70:	6a 23                	push   $0x23
+  800d72:	68 48 56 80 00       	push   $0x805648
+  800d77:	e8 1f 3f 00 00       	call   804c9b <_panic>
+
+00800d7c <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800d7c:	55                   	push   %ebp
+  800d7d:	89 e5                	mov    %esp,%ebp
+  800d7f:	57                   	push   %edi
+  800d80:	56                   	push   %esi
+  800d81:	53                   	push   %ebx
+  800d82:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d90:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d95:	89 df                	mov    %ebx,%edi
+  800d97:	89 de                	mov    %ebx,%esi
+  800d99:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d9b:	85 c0                	test   %eax,%eax
+  800d9d:	7f 08                	jg     800da7 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da2:	5b                   	pop    %ebx
+  800da3:	5e                   	pop    %esi
+  800da4:	5f                   	pop    %edi
+  800da5:	5d                   	pop    %ebp
+  800da6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da7:	83 ec 0c             	sub    $0xc,%esp
+  800daa:	50                   	push   %eax
+  800dab:	6a 18                	push   $0x18
+  800dad:	68 2b 56 80 00       	push   $0x80562b
+  800db2:	6a 23                	push   $0x23
+  800db4:	68 48 56 80 00       	push   $0x805648
+  800db9:	e8 dd 3e 00 00       	call   804c9b <_panic>
+
+00800dbe <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800dbe:	55                   	push   %ebp
+  800dbf:	89 e5                	mov    %esp,%ebp
+  800dc1:	57                   	push   %edi
+  800dc2:	56                   	push   %esi
+  800dc3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dc4:	be 00 00 00 00       	mov    $0x0,%esi
+  800dc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcf:	b8 19 00 00 00       	mov    $0x19,%eax
+  800dd4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd7:	89 f7                	mov    %esi,%edi
+  800dd9:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800ddb:	5b                   	pop    %ebx
+  800ddc:	5e                   	pop    %esi
+  800ddd:	5f                   	pop    %edi
+  800dde:	5d                   	pop    %ebp
+  800ddf:	c3                   	ret
+
+00800de0 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800de0:	55                   	push   %ebp
+  800de1:	89 e5                	mov    %esp,%ebp
+  800de3:	57                   	push   %edi
+  800de4:	56                   	push   %esi
+  800de5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800de6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dec:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800df1:	be 00 00 00 00       	mov    $0x0,%esi
+  800df6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dfc:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800dfe:	5b                   	pop    %ebx
+  800dff:	5e                   	pop    %esi
+  800e00:	5f                   	pop    %edi
+  800e01:	5d                   	pop    %ebp
+  800e02:	c3                   	ret
+
+00800e03 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e03:	55                   	push   %ebp
+  800e04:	89 e5                	mov    %esp,%ebp
+  800e06:	57                   	push   %edi
+  800e07:	56                   	push   %esi
+  800e08:	53                   	push   %ebx
+  800e09:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800e0c:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800e0f:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800e15:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800e18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e26:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e29:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e2b:	85 c0                	test   %eax,%eax
+  800e2d:	7f 08                	jg     800e37 <sys_page_map_range+0x34>
+}
+  800e2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e32:	5b                   	pop    %ebx
+  800e33:	5e                   	pop    %esi
+  800e34:	5f                   	pop    %edi
+  800e35:	5d                   	pop    %ebp
+  800e36:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e37:	83 ec 0c             	sub    $0xc,%esp
+  800e3a:	50                   	push   %eax
+  800e3b:	6a 10                	push   $0x10
+  800e3d:	68 2b 56 80 00       	push   $0x80562b
+  800e42:	6a 23                	push   $0x23
+  800e44:	68 48 56 80 00       	push   $0x805648
+  800e49:	e8 4d 3e 00 00       	call   804c9b <_panic>
+
+00800e4e <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e4e:	55                   	push   %ebp
+  800e4f:	89 e5                	mov    %esp,%ebp
+  800e51:	57                   	push   %edi
+  800e52:	56                   	push   %esi
+  800e53:	53                   	push   %ebx
+  800e54:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e57:	be 00 00 00 00       	mov    $0x0,%esi
+  800e5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e62:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e6a:	89 f7                	mov    %esi,%edi
+  800e6c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e6e:	85 c0                	test   %eax,%eax
+  800e70:	7f 08                	jg     800e7a <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e75:	5b                   	pop    %ebx
+  800e76:	5e                   	pop    %esi
+  800e77:	5f                   	pop    %edi
+  800e78:	5d                   	pop    %ebp
+  800e79:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e7a:	83 ec 0c             	sub    $0xc,%esp
+  800e7d:	50                   	push   %eax
+  800e7e:	6a 11                	push   $0x11
+  800e80:	68 2b 56 80 00       	push   $0x80562b
+  800e85:	6a 23                	push   $0x23
+  800e87:	68 48 56 80 00       	push   $0x805648
+  800e8c:	e8 0a 3e 00 00       	call   804c9b <_panic>
+
+00800e91 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800e91:	55                   	push   %ebp
+  800e92:	89 e5                	mov    %esp,%ebp
+  800e94:	57                   	push   %edi
+  800e95:	56                   	push   %esi
+  800e96:	53                   	push   %ebx
+  800e97:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e9a:	be 00 00 00 00       	mov    $0x0,%esi
+  800e9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800eaa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ead:	89 f7                	mov    %esi,%edi
+  800eaf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb1:	85 c0                	test   %eax,%eax
+  800eb3:	7f 08                	jg     800ebd <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800eb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb8:	5b                   	pop    %ebx
+  800eb9:	5e                   	pop    %esi
+  800eba:	5f                   	pop    %edi
+  800ebb:	5d                   	pop    %ebp
+  800ebc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ebd:	83 ec 0c             	sub    $0xc,%esp
+  800ec0:	50                   	push   %eax
+  800ec1:	6a 1b                	push   $0x1b
+  800ec3:	68 2b 56 80 00       	push   $0x80562b
+  800ec8:	6a 23                	push   $0x23
+  800eca:	68 48 56 80 00       	push   $0x805648
+  800ecf:	e8 c7 3d 00 00       	call   804c9b <_panic>
+
+00800ed4 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800ed4:	55                   	push   %ebp
+  800ed5:	89 e5                	mov    %esp,%ebp
+  800ed7:	57                   	push   %edi
+  800ed8:	56                   	push   %esi
+  800ed9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eda:	ba 00 00 00 00       	mov    $0x0,%edx
+  800edf:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ee4:	89 d1                	mov    %edx,%ecx
+  800ee6:	89 d3                	mov    %edx,%ebx
+  800ee8:	89 d7                	mov    %edx,%edi
+  800eea:	89 d6                	mov    %edx,%esi
+  800eec:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800eee:	5b                   	pop    %ebx
+  800eef:	5e                   	pop    %esi
+  800ef0:	5f                   	pop    %edi
+  800ef1:	5d                   	pop    %ebp
+  800ef2:	c3                   	ret
+
+00800ef3 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ef3:	55                   	push   %ebp
+  800ef4:	89 e5                	mov    %esp,%ebp
+  800ef6:	57                   	push   %edi
+  800ef7:	56                   	push   %esi
+  800ef8:	53                   	push   %ebx
+  800ef9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800efc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f07:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f0c:	89 df                	mov    %ebx,%edi
+  800f0e:	89 de                	mov    %ebx,%esi
+  800f10:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f12:	85 c0                	test   %eax,%eax
+  800f14:	7f 08                	jg     800f1e <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f19:	5b                   	pop    %ebx
+  800f1a:	5e                   	pop    %esi
+  800f1b:	5f                   	pop    %edi
+  800f1c:	5d                   	pop    %ebp
+  800f1d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f1e:	83 ec 0c             	sub    $0xc,%esp
+  800f21:	50                   	push   %eax
+  800f22:	6a 08                	push   $0x8
+  800f24:	68 2b 56 80 00       	push   $0x80562b
+  800f29:	6a 23                	push   $0x23
+  800f2b:	68 48 56 80 00       	push   $0x805648
+  800f30:	e8 66 3d 00 00       	call   804c9b <_panic>
+
+00800f35 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f35:	55                   	push   %ebp
+  800f36:	89 e5                	mov    %esp,%ebp
+  800f38:	57                   	push   %edi
+  800f39:	56                   	push   %esi
+  800f3a:	53                   	push   %ebx
+  800f3b:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800f3e:	6a 44                	push   $0x44
+  800f40:	ff 75 0c             	push   0xc(%ebp)
+  800f43:	e8 7a fc ff ff       	call   800bc2 <touch_mem>
+	asm volatile("int %1\n"
+  800f48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f50:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f58:	89 df                	mov    %ebx,%edi
+  800f5a:	89 de                	mov    %ebx,%esi
+  800f5c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f5e:	83 c4 08             	add    $0x8,%esp
+  800f61:	85 c0                	test   %eax,%eax
+  800f63:	7f 08                	jg     800f6d <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f68:	5b                   	pop    %ebx
+  800f69:	5e                   	pop    %esi
+  800f6a:	5f                   	pop    %edi
+  800f6b:	5d                   	pop    %ebp
+  800f6c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6d:	83 ec 0c             	sub    $0xc,%esp
+  800f70:	50                   	push   %eax
+  800f71:	6a 09                	push   $0x9
+  800f73:	68 2b 56 80 00       	push   $0x80562b
+  800f78:	6a 23                	push   $0x23
+  800f7a:	68 48 56 80 00       	push   $0x805648
+  800f7f:	e8 17 3d 00 00       	call   804c9b <_panic>
+
+00800f84 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800f84:	55                   	push   %ebp
+  800f85:	89 e5                	mov    %esp,%ebp
+  800f87:	57                   	push   %edi
+  800f88:	56                   	push   %esi
+  800f89:	53                   	push   %ebx
+  800f8a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f8d:	be 00 00 00 00       	mov    $0x0,%esi
+  800f92:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f98:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800f9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa0:	89 f7                	mov    %esi,%edi
+  800fa2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa4:	85 c0                	test   %eax,%eax
+  800fa6:	7f 08                	jg     800fb0 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800fa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fab:	5b                   	pop    %ebx
+  800fac:	5e                   	pop    %esi
+  800fad:	5f                   	pop    %edi
+  800fae:	5d                   	pop    %ebp
+  800faf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb0:	83 ec 0c             	sub    $0xc,%esp
+  800fb3:	50                   	push   %eax
+  800fb4:	6a 1a                	push   $0x1a
+  800fb6:	68 2b 56 80 00       	push   $0x80562b
+  800fbb:	6a 23                	push   $0x23
+  800fbd:	68 48 56 80 00       	push   $0x805648
+  800fc2:	e8 d4 3c 00 00       	call   804c9b <_panic>
+
+00800fc7 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  800fc7:	55                   	push   %ebp
+  800fc8:	89 e5                	mov    %esp,%ebp
+  800fca:	57                   	push   %edi
+  800fcb:	56                   	push   %esi
+  800fcc:	53                   	push   %ebx
+  800fcd:	83 ec 0c             	sub    $0xc,%esp
+  800fd0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  800fd3:	89 d8                	mov    %ebx,%eax
+  800fd5:	c1 e0 05             	shl    $0x5,%eax
+  800fd8:	50                   	push   %eax
+  800fd9:	ff 75 0c             	push   0xc(%ebp)
+  800fdc:	e8 e1 fb ff ff       	call   800bc2 <touch_mem>
+	asm volatile("int %1\n"
+  800fe1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe9:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff1:	89 f7                	mov    %esi,%edi
+  800ff3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff5:	83 c4 08             	add    $0x8,%esp
+  800ff8:	85 c0                	test   %eax,%eax
+  800ffa:	7f 08                	jg     801004 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  800ffc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fff:	5b                   	pop    %ebx
+  801000:	5e                   	pop    %esi
+  801001:	5f                   	pop    %edi
+  801002:	5d                   	pop    %ebp
+  801003:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801004:	83 ec 0c             	sub    $0xc,%esp
+  801007:	50                   	push   %eax
+  801008:	6a 13                	push   $0x13
+  80100a:	68 2b 56 80 00       	push   $0x80562b
+  80100f:	6a 23                	push   $0x23
+  801011:	68 48 56 80 00       	push   $0x805648
+  801016:	e8 80 3c 00 00       	call   804c9b <_panic>
+
+0080101b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	57                   	push   %edi
+  80101f:	56                   	push   %esi
+  801020:	53                   	push   %ebx
+  801021:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801024:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801029:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801034:	89 df                	mov    %ebx,%edi
+  801036:	89 de                	mov    %ebx,%esi
+  801038:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80103a:	85 c0                	test   %eax,%eax
+  80103c:	7f 08                	jg     801046 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80103e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801041:	5b                   	pop    %ebx
+  801042:	5e                   	pop    %esi
+  801043:	5f                   	pop    %edi
+  801044:	5d                   	pop    %ebp
+  801045:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801046:	83 ec 0c             	sub    $0xc,%esp
+  801049:	50                   	push   %eax
+  80104a:	6a 0a                	push   $0xa
+  80104c:	68 2b 56 80 00       	push   $0x80562b
+  801051:	6a 23                	push   $0x23
+  801053:	68 48 56 80 00       	push   $0x805648
+  801058:	e8 3e 3c 00 00       	call   804c9b <_panic>
+
+0080105d <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80105d:	55                   	push   %ebp
+  80105e:	89 e5                	mov    %esp,%ebp
+  801060:	57                   	push   %edi
+  801061:	56                   	push   %esi
+  801062:	53                   	push   %ebx
+  801063:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801066:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80106c:	76 1d                	jbe    80108b <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80106e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801071:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801074:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801079:	be 01 00 00 00       	mov    $0x1,%esi
+  80107e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801081:	cd 30                	int    $0x30
+}
+  801083:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801086:	5b                   	pop    %ebx
+  801087:	5e                   	pop    %esi
+  801088:	5f                   	pop    %edi
+  801089:	5d                   	pop    %ebp
+  80108a:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80108b:	68 00 10 00 00       	push   $0x1000
+  801090:	53                   	push   %ebx
+  801091:	e8 2c fb ff ff       	call   800bc2 <touch_mem>
+  801096:	83 c4 08             	add    $0x8,%esp
+  801099:	eb d3                	jmp    80106e <sys_ipc_send+0x11>
+
+0080109b <sys_ipc_send_pages>:
+{
+  80109b:	55                   	push   %ebp
+  80109c:	89 e5                	mov    %esp,%ebp
+  80109e:	57                   	push   %edi
+  80109f:	56                   	push   %esi
+  8010a0:	53                   	push   %ebx
+  8010a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a4:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8010a7:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010ad:	76 18                	jbe    8010c7 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8010af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010ba:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8010bd:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8010bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c2:	5b                   	pop    %ebx
+  8010c3:	5e                   	pop    %esi
+  8010c4:	5f                   	pop    %edi
+  8010c5:	5d                   	pop    %ebp
+  8010c6:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8010c7:	89 f0                	mov    %esi,%eax
+  8010c9:	c1 e0 0c             	shl    $0xc,%eax
+  8010cc:	50                   	push   %eax
+  8010cd:	53                   	push   %ebx
+  8010ce:	e8 ef fa ff ff       	call   800bc2 <touch_mem>
+  8010d3:	83 c4 08             	add    $0x8,%esp
+  8010d6:	eb d7                	jmp    8010af <sys_ipc_send_pages+0x14>
+
+008010d8 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8010d8:	55                   	push   %ebp
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	57                   	push   %edi
+  8010dc:	56                   	push   %esi
+  8010dd:	53                   	push   %ebx
+  8010de:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ec:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010f1:	89 df                	mov    %ebx,%edi
+  8010f3:	89 de                	mov    %ebx,%esi
+  8010f5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010f7:	85 c0                	test   %eax,%eax
+  8010f9:	7f 08                	jg     801103 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8010fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010fe:	5b                   	pop    %ebx
+  8010ff:	5e                   	pop    %esi
+  801100:	5f                   	pop    %edi
+  801101:	5d                   	pop    %ebp
+  801102:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801103:	83 ec 0c             	sub    $0xc,%esp
+  801106:	50                   	push   %eax
+  801107:	6a 0d                	push   $0xd
+  801109:	68 2b 56 80 00       	push   $0x80562b
+  80110e:	6a 23                	push   $0x23
+  801110:	68 48 56 80 00       	push   $0x805648
+  801115:	e8 81 3b 00 00       	call   804c9b <_panic>
+
+0080111a <sys_ipc_recv>:
+{
+  80111a:	55                   	push   %ebp
+  80111b:	89 e5                	mov    %esp,%ebp
+  80111d:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801120:	6a 01                	push   $0x1
+  801122:	ff 75 08             	push   0x8(%ebp)
+  801125:	e8 ae ff ff ff       	call   8010d8 <sys_ipc_recv_pages>
+}
+  80112a:	c9                   	leave
+  80112b:	c3                   	ret
+
+0080112c <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80112c:	55                   	push   %ebp
+  80112d:	89 e5                	mov    %esp,%ebp
+  80112f:	57                   	push   %edi
+  801130:	56                   	push   %esi
+  801131:	53                   	push   %ebx
+  801132:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801135:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801138:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  80113b:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801141:	77 04                	ja     801147 <sys_ipc_call+0x1b>
+  801143:	85 f6                	test   %esi,%esi
+  801145:	75 15                	jne    80115c <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801147:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801152:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801154:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801157:	5b                   	pop    %ebx
+  801158:	5e                   	pop    %esi
+  801159:	5f                   	pop    %edi
+  80115a:	5d                   	pop    %ebp
+  80115b:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80115c:	89 f8                	mov    %edi,%eax
+  80115e:	c1 e0 0c             	shl    $0xc,%eax
+  801161:	50                   	push   %eax
+  801162:	53                   	push   %ebx
+  801163:	e8 5a fa ff ff       	call   800bc2 <touch_mem>
+  801168:	83 c4 08             	add    $0x8,%esp
+  80116b:	eb da                	jmp    801147 <sys_ipc_call+0x1b>
+
+0080116d <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80116d:	55                   	push   %ebp
+  80116e:	89 e5                	mov    %esp,%ebp
+  801170:	57                   	push   %edi
+  801171:	56                   	push   %esi
+  801172:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801173:	8b 55 08             	mov    0x8(%ebp),%edx
+  801176:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801179:	b8 15 00 00 00       	mov    $0x15,%eax
+  80117e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801181:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801184:	8b 75 18             	mov    0x18(%ebp),%esi
+  801187:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801189:	5b                   	pop    %ebx
+  80118a:	5e                   	pop    %esi
+  80118b:	5f                   	pop    %edi
+  80118c:	5d                   	pop    %ebp
+  80118d:	c3                   	ret
+
+0080118e <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  80118e:	55                   	push   %ebp
+  80118f:	89 e5                	mov    %esp,%ebp
+  801191:	57                   	push   %edi
+  801192:	56                   	push   %esi
+  801193:	53                   	push   %ebx
+  801194:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801197:	6a 04                	push   $0x4
+  801199:	ff 75 08             	push   0x8(%ebp)
+  80119c:	e8 21 fa ff ff       	call   800bc2 <touch_mem>
+	asm volatile("int %1\n"
+  8011a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a9:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b4:	89 f7                	mov    %esi,%edi
+  8011b6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011b8:	83 c4 08             	add    $0x8,%esp
+  8011bb:	85 c0                	test   %eax,%eax
+  8011bd:	7f 08                	jg     8011c7 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8011bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c2:	5b                   	pop    %ebx
+  8011c3:	5e                   	pop    %esi
+  8011c4:	5f                   	pop    %edi
+  8011c5:	5d                   	pop    %ebp
+  8011c6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011c7:	83 ec 0c             	sub    $0xc,%esp
+  8011ca:	50                   	push   %eax
+  8011cb:	6a 16                	push   $0x16
+  8011cd:	68 2b 56 80 00       	push   $0x80562b
+  8011d2:	6a 23                	push   $0x23
+  8011d4:	68 48 56 80 00       	push   $0x805648
+  8011d9:	e8 bd 3a 00 00       	call   804c9b <_panic>
+
+008011de <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8011de:	55                   	push   %ebp
+  8011df:	89 e5                	mov    %esp,%ebp
+  8011e1:	57                   	push   %edi
+  8011e2:	56                   	push   %esi
+  8011e3:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8011e4:	6a 04                	push   $0x4
+  8011e6:	ff 75 08             	push   0x8(%ebp)
+  8011e9:	e8 d4 f9 ff ff       	call   800bc2 <touch_mem>
+	asm volatile("int %1\n"
+  8011ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f6:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fe:	89 df                	mov    %ebx,%edi
+  801200:	89 de                	mov    %ebx,%esi
+  801202:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801204:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801207:	5b                   	pop    %ebx
+  801208:	5e                   	pop    %esi
+  801209:	5f                   	pop    %edi
+  80120a:	5d                   	pop    %ebp
+  80120b:	c3                   	ret
+
+0080120c <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80120c:	55                   	push   %ebp
+  80120d:	89 e5                	mov    %esp,%ebp
+  80120f:	57                   	push   %edi
+  801210:	56                   	push   %esi
+  801211:	53                   	push   %ebx
+  801212:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801215:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801222:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801227:	89 df                	mov    %ebx,%edi
+  801229:	89 de                	mov    %ebx,%esi
+  80122b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80122d:	85 c0                	test   %eax,%eax
+  80122f:	7f 08                	jg     801239 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801231:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801234:	5b                   	pop    %ebx
+  801235:	5e                   	pop    %esi
+  801236:	5f                   	pop    %edi
+  801237:	5d                   	pop    %ebp
+  801238:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801239:	83 ec 0c             	sub    $0xc,%esp
+  80123c:	50                   	push   %eax
+  80123d:	6a 0e                	push   $0xe
+  80123f:	68 2b 56 80 00       	push   $0x80562b
+  801244:	6a 23                	push   $0x23
+  801246:	68 48 56 80 00       	push   $0x805648
+  80124b:	e8 4b 3a 00 00       	call   804c9b <_panic>
+
+00801250 <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  801250:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801257:	f6 c6 06             	test   $0x6,%dh
+  80125a:	75 37                	jne    801293 <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  80125c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801263:	f6 c2 02             	test   $0x2,%dl
+  801266:	75 19                	jne    801281 <dupperm+0x31>
+  801268:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80126f:	f6 c6 08             	test   $0x8,%dh
+  801272:	75 0d                	jne    801281 <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  801274:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80127b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801280:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801281:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801288:	25 00 06 00 00       	and    $0x600,%eax
+  80128d:	0d 05 08 00 00       	or     $0x805,%eax
+  801292:	c3                   	ret
+		return 0;
+  801293:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801298:	c3                   	ret
+
+00801299 <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  801299:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  80129b:	c1 e0 0c             	shl    $0xc,%eax
+  80129e:	c1 e8 16             	shr    $0x16,%eax
+  8012a1:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8012a8:	f6 c1 01             	test   $0x1,%cl
+  8012ab:	74 2c                	je     8012d9 <dupable+0x40>
+  8012ad:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8012b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b9:	f6 c1 04             	test   $0x4,%cl
+  8012bc:	74 20                	je     8012de <dupable+0x45>
+  8012be:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8012c5:	f6 c1 01             	test   $0x1,%cl
+  8012c8:	74 14                	je     8012de <dupable+0x45>
+  8012ca:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8012d1:	c1 e8 02             	shr    $0x2,%eax
+  8012d4:	83 e0 01             	and    $0x1,%eax
+  8012d7:	eb 05                	jmp    8012de <dupable+0x45>
+  8012d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012de:	83 e0 01             	and    $0x1,%eax
+}
+  8012e1:	c3                   	ret
+
+008012e2 <pgfault>:
+{
+  8012e2:	55                   	push   %ebp
+  8012e3:	89 e5                	mov    %esp,%ebp
+  8012e5:	56                   	push   %esi
+  8012e6:	53                   	push   %ebx
+  8012e7:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8012ea:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  8012ec:	89 ca                	mov    %ecx,%edx
+  8012ee:	c1 ea 0c             	shr    $0xc,%edx
+  8012f1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  8012f8:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8012fc:	0f 84 8e 00 00 00    	je     801390 <pgfault+0xae>
+		return 0;
+  801302:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801307:	f6 c6 08             	test   $0x8,%dh
+  80130a:	0f 84 85 00 00 00    	je     801395 <pgfault+0xb3>
+	perm |= PTE_W;
+  801310:	81 e2 07 06 00 00    	and    $0x607,%edx
+  801316:	89 d3                	mov    %edx,%ebx
+  801318:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80131b:	89 ce                	mov    %ecx,%esi
+  80131d:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  801323:	6a 01                	push   $0x1
+  801325:	53                   	push   %ebx
+  801326:	68 00 f0 7f 00       	push   $0x7ff000
+  80132b:	6a 00                	push   $0x0
+  80132d:	e8 39 27 00 00       	call   803a6b <page_alloc>
+  801332:	83 c4 10             	add    $0x10,%esp
+  801335:	85 c0                	test   %eax,%eax
+  801337:	78 33                	js     80136c <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  801339:	83 ec 04             	sub    $0x4,%esp
+  80133c:	68 00 10 00 00       	push   $0x1000
+  801341:	56                   	push   %esi
+  801342:	68 00 f0 7f 00       	push   $0x7ff000
+  801347:	e8 fc f5 ff ff       	call   800948 <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  80134c:	89 1c 24             	mov    %ebx,(%esp)
+  80134f:	56                   	push   %esi
+  801350:	6a 00                	push   $0x0
+  801352:	68 00 f0 7f 00       	push   $0x7ff000
+  801357:	6a 00                	push   $0x0
+  801359:	e8 6e 2d 00 00       	call   8040cc <page_map>
+  80135e:	83 c4 20             	add    $0x20,%esp
+  801361:	85 c0                	test   %eax,%eax
+  801363:	78 19                	js     80137e <pgfault+0x9c>
+	return 1;
+  801365:	b8 01 00 00 00       	mov    $0x1,%eax
+  80136a:	eb 29                	jmp    801395 <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  80136c:	50                   	push   %eax
+  80136d:	68 58 56 80 00       	push   $0x805658
+  801372:	6a 2e                	push   $0x2e
+  801374:	68 ab 56 80 00       	push   $0x8056ab
+  801379:	e8 1d 39 00 00       	call   804c9b <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  80137e:	50                   	push   %eax
+  80137f:	68 84 56 80 00       	push   $0x805684
+  801384:	6a 32                	push   $0x32
+  801386:	68 ab 56 80 00       	push   $0x8056ab
+  80138b:	e8 0b 39 00 00       	call   804c9b <_panic>
+		return 0;
+  801390:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801395:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801398:	5b                   	pop    %ebx
+  801399:	5e                   	pop    %esi
+  80139a:	5d                   	pop    %ebp
+  80139b:	c3                   	ret
+
+0080139c <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  80139c:	55                   	push   %ebp
+  80139d:	89 e5                	mov    %esp,%ebp
+  80139f:	57                   	push   %edi
+  8013a0:	56                   	push   %esi
+  8013a1:	53                   	push   %ebx
+  8013a2:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  8013a5:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  8013ac:	74 5d                	je     80140b <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  8013ae:	83 ec 0c             	sub    $0xc,%esp
+  8013b1:	68 e2 12 80 00       	push   $0x8012e2
+  8013b6:	e8 b8 39 00 00       	call   804d73 <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  8013bb:	e8 14 fb ff ff       	call   800ed4 <sys_fork>
+  8013c0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8013c3:	83 c4 10             	add    $0x10,%esp
+  8013c6:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8013c9:	74 47                	je     801412 <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  8013cb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8013cf:	0f 84 c5 03 00 00    	je     80179a <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  8013d5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8013d9:	78 25                	js     801400 <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  8013db:	e8 03 20 00 00       	call   8033e3 <page_share_paged_out>
+  8013e0:	85 c0                	test   %eax,%eax
+  8013e2:	0f 88 d8 03 00 00    	js     8017c0 <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  8013e8:	83 ec 08             	sub    $0x8,%esp
+  8013eb:	6a 02                	push   $0x2
+  8013ed:	ff 75 e4             	push   -0x1c(%ebp)
+  8013f0:	e8 fe fa ff ff       	call   800ef3 <sys_env_set_status>
+  8013f5:	83 c4 10             	add    $0x10,%esp
+  8013f8:	85 c0                	test   %eax,%eax
+  8013fa:	0f 88 d5 03 00 00    	js     8017d5 <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  801400:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801403:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801406:	5b                   	pop    %ebx
+  801407:	5e                   	pop    %esi
+  801408:	5f                   	pop    %edi
+  801409:	5d                   	pop    %ebp
+  80140a:	c3                   	ret
+		init_map_dir();
+  80140b:	e8 db 22 00 00       	call   8036eb <init_map_dir>
+  801410:	eb 9c                	jmp    8013ae <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801412:	b8 07 00 00 00       	mov    $0x7,%eax
+  801417:	cd 30                	int    $0x30
+  801419:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  80141c:	85 c0                	test   %eax,%eax
+  80141e:	78 10                	js     801430 <fork+0x94>
+	if (envid == 0)
+  801420:	0f 84 74 03 00 00    	je     80179a <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801426:	be 00 00 00 00       	mov    $0x0,%esi
+  80142b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80142e:	eb 30                	jmp    801460 <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  801430:	50                   	push   %eax
+  801431:	68 b6 56 80 00       	push   $0x8056b6
+  801436:	68 cd 00 00 00       	push   $0xcd
+  80143b:	68 ab 56 80 00       	push   $0x8056ab
+  801440:	e8 56 38 00 00       	call   804c9b <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  801445:	89 f2                	mov    %esi,%edx
+  801447:	c1 fa 1f             	sar    $0x1f,%edx
+  80144a:	c1 ea 16             	shr    $0x16,%edx
+  80144d:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  801450:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801455:	29 d0                	sub    %edx,%eax
+  801457:	ba 00 04 00 00       	mov    $0x400,%edx
+  80145c:	29 c2                	sub    %eax,%edx
+  80145e:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801460:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  801463:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801469:	0f 87 ff 02 00 00    	ja     80176e <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  80146f:	89 f3                	mov    %esi,%ebx
+  801471:	c1 e3 0c             	shl    $0xc,%ebx
+  801474:	89 d8                	mov    %ebx,%eax
+  801476:	c1 e8 16             	shr    $0x16,%eax
+  801479:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801480:	f6 c2 01             	test   $0x1,%dl
+  801483:	74 c0                	je     801445 <fork+0xa9>
+  801485:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80148c:	f6 c2 04             	test   $0x4,%dl
+  80148f:	74 b4                	je     801445 <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  801491:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801498:	a8 80                	test   $0x80,%al
+  80149a:	75 24                	jne    8014c0 <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  80149c:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8014a3:	25 81 00 00 00       	and    $0x81,%eax
+  8014a8:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8014ad:	74 21                	je     8014d0 <fork+0x134>
+		if (!dupable(pn)) {
+  8014af:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014b2:	e8 e2 fd ff ff       	call   801299 <dupable>
+  8014b7:	84 c0                	test   %al,%al
+  8014b9:	75 1a                	jne    8014d5 <fork+0x139>
+			++pn;
+  8014bb:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8014be:	eb a0                	jmp    801460 <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  8014c0:	83 ec 08             	sub    $0x8,%esp
+  8014c3:	53                   	push   %ebx
+  8014c4:	6a 00                	push   $0x0
+  8014c6:	e8 b1 f8 ff ff       	call   800d7c <sys_page_split>
+  8014cb:	83 c4 10             	add    $0x10,%esp
+  8014ce:	eb cc                	jmp    80149c <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  8014d0:	0f b6 03             	movzbl (%ebx),%eax
+  8014d3:	eb da                	jmp    8014af <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  8014d5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8014d8:	89 f8                	mov    %edi,%eax
+  8014da:	e8 71 fd ff ff       	call   801250 <dupperm>
+  8014df:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8014e2:	85 c0                	test   %eax,%eax
+  8014e4:	74 16                	je     8014fc <fork+0x160>
+  8014e6:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  8014eb:	29 f8                	sub    %edi,%eax
+  8014ed:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  8014f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8014f5:	89 c6                	mov    %eax,%esi
+  8014f7:	e9 c4 01 00 00       	jmp    8016c0 <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  8014fc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014ff:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801506:	f6 c4 04             	test   $0x4,%ah
+  801509:	0f 85 89 00 00 00    	jne    801598 <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  80150f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801512:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801519:	f6 c4 02             	test   $0x2,%ah
+  80151c:	0f 85 b1 00 00 00    	jne    8015d3 <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  801522:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801525:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80152c:	a8 02                	test   $0x2,%al
+  80152e:	75 10                	jne    801540 <fork+0x1a4>
+  801530:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801537:	f6 c4 08             	test   $0x8,%ah
+  80153a:	0f 84 3e 01 00 00    	je     80167e <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801540:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801543:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80154a:	25 00 06 00 00       	and    $0x600,%eax
+  80154f:	0d 05 08 00 00       	or     $0x805,%eax
+  801554:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  801556:	c1 e1 0c             	shl    $0xc,%ecx
+  801559:	89 cb                	mov    %ecx,%ebx
+  80155b:	83 ec 0c             	sub    $0xc,%esp
+  80155e:	50                   	push   %eax
+  80155f:	51                   	push   %ecx
+  801560:	ff 75 e4             	push   -0x1c(%ebp)
+  801563:	51                   	push   %ecx
+  801564:	6a 00                	push   $0x0
+  801566:	e8 61 2b 00 00       	call   8040cc <page_map>
+  80156b:	83 c4 20             	add    $0x20,%esp
+  80156e:	85 c0                	test   %eax,%eax
+  801570:	0f 88 e4 00 00 00    	js     80165a <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  801576:	83 ec 0c             	sub    $0xc,%esp
+  801579:	57                   	push   %edi
+  80157a:	53                   	push   %ebx
+  80157b:	6a 00                	push   $0x0
+  80157d:	53                   	push   %ebx
+  80157e:	6a 00                	push   $0x0
+  801580:	e8 47 2b 00 00       	call   8040cc <page_map>
+  801585:	83 c4 20             	add    $0x20,%esp
+  801588:	85 c0                	test   %eax,%eax
+  80158a:	0f 88 dc 00 00 00    	js     80166c <fork+0x2d0>
+			++pn;
+  801590:	83 c6 01             	add    $0x1,%esi
+			continue;
+  801593:	e9 c8 fe ff ff       	jmp    801460 <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  801598:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80159b:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8015a2:	c1 e1 0c             	shl    $0xc,%ecx
+  8015a5:	83 ec 0c             	sub    $0xc,%esp
+  8015a8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015ad:	50                   	push   %eax
+  8015ae:	51                   	push   %ecx
+  8015af:	ff 75 e4             	push   -0x1c(%ebp)
+  8015b2:	51                   	push   %ecx
+  8015b3:	6a 00                	push   $0x0
+  8015b5:	e8 12 2b 00 00       	call   8040cc <page_map>
+  8015ba:	83 c4 20             	add    $0x20,%esp
+  8015bd:	85 c0                	test   %eax,%eax
+  8015bf:	79 cf                	jns    801590 <fork+0x1f4>
+			panic("page_map %d", r);
+  8015c1:	50                   	push   %eax
+  8015c2:	68 c6 56 80 00       	push   $0x8056c6
+  8015c7:	6a 4d                	push   $0x4d
+  8015c9:	68 ab 56 80 00       	push   $0x8056ab
+  8015ce:	e8 c8 36 00 00       	call   804c9b <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  8015d3:	83 ec 0c             	sub    $0xc,%esp
+  8015d6:	68 00 10 00 00       	push   $0x1000
+  8015db:	e8 de 30 00 00       	call   8046be <malloc>
+  8015e0:	89 c7                	mov    %eax,%edi
+  8015e2:	83 c4 10             	add    $0x10,%esp
+  8015e5:	85 c0                	test   %eax,%eax
+  8015e7:	74 4b                	je     801634 <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  8015e9:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8015ec:	c1 e3 0c             	shl    $0xc,%ebx
+  8015ef:	83 ec 04             	sub    $0x4,%esp
+  8015f2:	68 00 10 00 00       	push   $0x1000
+  8015f7:	53                   	push   %ebx
+  8015f8:	50                   	push   %eax
+  8015f9:	e8 ac f3 ff ff       	call   8009aa <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  8015fe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801601:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801608:	25 07 0e 00 00       	and    $0xe07,%eax
+  80160d:	89 04 24             	mov    %eax,(%esp)
+  801610:	53                   	push   %ebx
+  801611:	ff 75 e4             	push   -0x1c(%ebp)
+  801614:	57                   	push   %edi
+  801615:	6a 00                	push   $0x0
+  801617:	e8 b0 2a 00 00       	call   8040cc <page_map>
+  80161c:	83 c4 20             	add    $0x20,%esp
+  80161f:	85 c0                	test   %eax,%eax
+  801621:	78 25                	js     801648 <fork+0x2ac>
+		free(temp);
+  801623:	83 ec 0c             	sub    $0xc,%esp
+  801626:	57                   	push   %edi
+  801627:	e8 90 2e 00 00       	call   8044bc <free>
+  80162c:	83 c4 10             	add    $0x10,%esp
+  80162f:	e9 5c ff ff ff       	jmp    801590 <fork+0x1f4>
+			panic("malloc failed");
+  801634:	83 ec 04             	sub    $0x4,%esp
+  801637:	68 d2 56 80 00       	push   $0x8056d2
+  80163c:	6a 56                	push   $0x56
+  80163e:	68 ab 56 80 00       	push   $0x8056ab
+  801643:	e8 53 36 00 00       	call   804c9b <_panic>
+			panic("page_map: %e", r);
+  801648:	50                   	push   %eax
+  801649:	68 e0 56 80 00       	push   $0x8056e0
+  80164e:	6a 59                	push   $0x59
+  801650:	68 ab 56 80 00       	push   $0x8056ab
+  801655:	e8 41 36 00 00       	call   804c9b <_panic>
+			panic("page_map %d", r);
+  80165a:	50                   	push   %eax
+  80165b:	68 c6 56 80 00       	push   $0x8056c6
+  801660:	6a 65                	push   $0x65
+  801662:	68 ab 56 80 00       	push   $0x8056ab
+  801667:	e8 2f 36 00 00       	call   804c9b <_panic>
+			panic("page_map %d", r);
+  80166c:	50                   	push   %eax
+  80166d:	68 c6 56 80 00       	push   $0x8056c6
+  801672:	6a 78                	push   $0x78
+  801674:	68 ab 56 80 00       	push   $0x8056ab
+  801679:	e8 1d 36 00 00       	call   804c9b <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  80167e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801681:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801688:	c1 e1 0c             	shl    $0xc,%ecx
+  80168b:	83 ec 0c             	sub    $0xc,%esp
+  80168e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801693:	50                   	push   %eax
+  801694:	51                   	push   %ecx
+  801695:	ff 75 e4             	push   -0x1c(%ebp)
+  801698:	51                   	push   %ecx
+  801699:	6a 00                	push   $0x0
+  80169b:	e8 2c 2a 00 00       	call   8040cc <page_map>
+  8016a0:	83 c4 20             	add    $0x20,%esp
+  8016a3:	85 c0                	test   %eax,%eax
+  8016a5:	0f 89 e5 fe ff ff    	jns    801590 <fork+0x1f4>
+			panic("page_map %d", r);
+  8016ab:	50                   	push   %eax
+  8016ac:	68 c6 56 80 00       	push   $0x8056c6
+  8016b1:	6a 7f                	push   $0x7f
+  8016b3:	68 ab 56 80 00       	push   $0x8056ab
+  8016b8:	e8 de 35 00 00       	call   804c9b <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  8016bd:	83 c7 01             	add    $0x1,%edi
+  8016c0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016c3:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  8016c6:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  8016c9:	39 f7                	cmp    %esi,%edi
+  8016cb:	74 1c                	je     8016e9 <fork+0x34d>
+  8016cd:	89 d8                	mov    %ebx,%eax
+  8016cf:	e8 c5 fb ff ff       	call   801299 <dupable>
+  8016d4:	84 c0                	test   %al,%al
+  8016d6:	74 7c                	je     801754 <fork+0x3b8>
+  8016d8:	89 d8                	mov    %ebx,%eax
+  8016da:	e8 71 fb ff ff       	call   801250 <dupperm>
+  8016df:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  8016e2:	74 d9                	je     8016bd <fork+0x321>
+  8016e4:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8016e7:	eb 06                	jmp    8016ef <fork+0x353>
+  8016e9:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8016ec:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  8016ef:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016f2:	c1 e0 0c             	shl    $0xc,%eax
+  8016f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8016f8:	83 ec 08             	sub    $0x8,%esp
+  8016fb:	ff 75 dc             	push   -0x24(%ebp)
+  8016fe:	57                   	push   %edi
+  8016ff:	50                   	push   %eax
+  801700:	ff 75 e4             	push   -0x1c(%ebp)
+  801703:	50                   	push   %eax
+  801704:	6a 00                	push   $0x0
+  801706:	e8 b8 2b 00 00       	call   8042c3 <page_map_range>
+  80170b:	83 c4 20             	add    $0x20,%esp
+  80170e:	85 c0                	test   %eax,%eax
+  801710:	78 47                	js     801759 <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  801712:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801719:	0f 84 41 fd ff ff    	je     801460 <fork+0xc4>
+  80171f:	83 ec 08             	sub    $0x8,%esp
+  801722:	ff 75 dc             	push   -0x24(%ebp)
+  801725:	57                   	push   %edi
+  801726:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801729:	50                   	push   %eax
+  80172a:	6a 00                	push   $0x0
+  80172c:	50                   	push   %eax
+  80172d:	6a 00                	push   $0x0
+  80172f:	e8 8f 2b 00 00       	call   8042c3 <page_map_range>
+  801734:	83 c4 20             	add    $0x20,%esp
+  801737:	85 c0                	test   %eax,%eax
+  801739:	0f 89 21 fd ff ff    	jns    801460 <fork+0xc4>
+		panic("page_map_range %e", r);
+  80173f:	50                   	push   %eax
+  801740:	68 ed 56 80 00       	push   $0x8056ed
+  801745:	68 a2 00 00 00       	push   $0xa2
+  80174a:	68 ab 56 80 00       	push   $0x8056ab
+  80174f:	e8 47 35 00 00       	call   804c9b <_panic>
+  801754:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801757:	eb 96                	jmp    8016ef <fork+0x353>
+		panic("page_map_range %e", r);
+  801759:	50                   	push   %eax
+  80175a:	68 ed 56 80 00       	push   $0x8056ed
+  80175f:	68 a0 00 00 00       	push   $0xa0
+  801764:	68 ab 56 80 00       	push   $0x8056ab
+  801769:	e8 2d 35 00 00       	call   804c9b <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  80176e:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  801771:	6a 01                	push   $0x1
+  801773:	6a 07                	push   $0x7
+  801775:	68 00 f0 bf ee       	push   $0xeebff000
+  80177a:	53                   	push   %ebx
+  80177b:	e8 eb 22 00 00       	call   803a6b <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801780:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801785:	8b 40 74             	mov    0x74(%eax),%eax
+  801788:	83 c4 08             	add    $0x8,%esp
+  80178b:	50                   	push   %eax
+  80178c:	53                   	push   %ebx
+  80178d:	e8 89 f8 ff ff       	call   80101b <sys_env_set_pgfault_upcall>
+  801792:	83 c4 10             	add    $0x10,%esp
+  801795:	e9 41 fc ff ff       	jmp    8013db <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80179a:	e8 d8 f4 ff ff       	call   800c77 <sys_getenvid>
+  80179f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017a4:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8017a7:	c1 e0 06             	shl    $0x6,%eax
+  8017aa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017af:	a3 18 e9 80 00       	mov    %eax,0x80e918
+		return 0;
+  8017b4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8017bb:	e9 40 fc ff ff       	jmp    801400 <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  8017c0:	50                   	push   %eax
+  8017c1:	68 ff 56 80 00       	push   $0x8056ff
+  8017c6:	68 27 01 00 00       	push   $0x127
+  8017cb:	68 ab 56 80 00       	push   $0x8056ab
+  8017d0:	e8 c6 34 00 00       	call   804c9b <_panic>
+		panic("sys_env_set_status: %d", r);
+  8017d5:	50                   	push   %eax
+  8017d6:	68 18 57 80 00       	push   $0x805718
+  8017db:	68 2b 01 00 00       	push   $0x12b
+  8017e0:	68 ab 56 80 00       	push   $0x8056ab
+  8017e5:	e8 b1 34 00 00       	call   804c9b <_panic>
+
+008017ea <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8017ea:	55                   	push   %ebp
+  8017eb:	89 e5                	mov    %esp,%ebp
+  8017ed:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8017f0:	68 2f 57 80 00       	push   $0x80572f
+  8017f5:	68 35 01 00 00       	push   $0x135
+  8017fa:	68 ab 56 80 00       	push   $0x8056ab
+  8017ff:	e8 97 34 00 00       	call   804c9b <_panic>
+
+00801804 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801804:	55                   	push   %ebp
+  801805:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801807:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180a:	05 00 00 00 30       	add    $0x30000000,%eax
+  80180f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801812:	5d                   	pop    %ebp
+  801813:	c3                   	ret
+
+00801814 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801814:	55                   	push   %ebp
+  801815:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801817:	8b 45 08             	mov    0x8(%ebp),%eax
+  80181a:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80181f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801824:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801829:	5d                   	pop    %ebp
+  80182a:	c3                   	ret
+
+0080182b <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80182b:	55                   	push   %ebp
+  80182c:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  80182e:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801833:	a8 01                	test   $0x1,%al
+  801835:	74 3c                	je     801873 <fd_alloc+0x48>
+  801837:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80183c:	89 c2                	mov    %eax,%edx
+  80183e:	c1 ea 0c             	shr    $0xc,%edx
+  801841:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801848:	89 c1                	mov    %eax,%ecx
+  80184a:	05 00 10 00 00       	add    $0x1000,%eax
+  80184f:	f6 c2 01             	test   $0x1,%dl
+  801852:	74 13                	je     801867 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801854:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801859:	75 e1                	jne    80183c <fd_alloc+0x11>
+  80185b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801860:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801865:	eb 05                	jmp    80186c <fd_alloc+0x41>
+			return 0;
+  801867:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  80186c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80186f:	89 0a                	mov    %ecx,(%edx)
+}
+  801871:	5d                   	pop    %ebp
+  801872:	c3                   	ret
+  801873:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801878:	b8 00 00 00 00       	mov    $0x0,%eax
+  80187d:	eb ed                	jmp    80186c <fd_alloc+0x41>
+
+0080187f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80187f:	55                   	push   %ebp
+  801880:	89 e5                	mov    %esp,%ebp
+  801882:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801885:	83 f8 1f             	cmp    $0x1f,%eax
+  801888:	77 30                	ja     8018ba <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80188a:	c1 e0 0c             	shl    $0xc,%eax
+  80188d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801892:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801898:	f6 c2 01             	test   $0x1,%dl
+  80189b:	74 24                	je     8018c1 <fd_lookup+0x42>
+  80189d:	89 c2                	mov    %eax,%edx
+  80189f:	c1 ea 0c             	shr    $0xc,%edx
+  8018a2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8018a9:	f6 c2 01             	test   $0x1,%dl
+  8018ac:	74 1a                	je     8018c8 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8018ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018b1:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8018b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018b8:	5d                   	pop    %ebp
+  8018b9:	c3                   	ret
+		return -E_INVAL;
+  8018ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018bf:	eb f7                	jmp    8018b8 <fd_lookup+0x39>
+		return -E_INVAL;
+  8018c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018c6:	eb f0                	jmp    8018b8 <fd_lookup+0x39>
+  8018c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018cd:	eb e9                	jmp    8018b8 <fd_lookup+0x39>
+
+008018cf <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8018cf:	55                   	push   %ebp
+  8018d0:	89 e5                	mov    %esp,%ebp
+  8018d2:	53                   	push   %ebx
+  8018d3:	83 ec 04             	sub    $0x4,%esp
+  8018d6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8018d9:	b8 c4 57 80 00       	mov    $0x8057c4,%eax
+  8018de:	8b 18                	mov    (%eax),%ebx
+  8018e0:	85 db                	test   %ebx,%ebx
+  8018e2:	74 0e                	je     8018f2 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  8018e4:	83 c0 04             	add    $0x4,%eax
+  8018e7:	39 13                	cmp    %edx,(%ebx)
+  8018e9:	75 f3                	jne    8018de <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  8018eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f0:	eb 1f                	jmp    801911 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018f2:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8018f7:	8b 40 48             	mov    0x48(%eax),%eax
+  8018fa:	83 ec 04             	sub    $0x4,%esp
+  8018fd:	52                   	push   %edx
+  8018fe:	50                   	push   %eax
+  8018ff:	68 48 57 80 00       	push   $0x805748
+  801904:	e8 d2 e8 ff ff       	call   8001db <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801909:	83 c4 10             	add    $0x10,%esp
+  80190c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801911:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801914:	89 1a                	mov    %ebx,(%edx)
+}
+  801916:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801919:	c9                   	leave
+  80191a:	c3                   	ret
+
+0080191b <fd_close>:
+{
+  80191b:	55                   	push   %ebp
+  80191c:	89 e5                	mov    %esp,%ebp
+  80191e:	57                   	push   %edi
+  80191f:	56                   	push   %esi
+  801920:	53                   	push   %ebx
+  801921:	83 ec 24             	sub    $0x24,%esp
+  801924:	8b 75 08             	mov    0x8(%ebp),%esi
+  801927:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80192a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80192d:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80192e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801934:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801937:	50                   	push   %eax
+  801938:	e8 42 ff ff ff       	call   80187f <fd_lookup>
+  80193d:	89 c3                	mov    %eax,%ebx
+  80193f:	83 c4 10             	add    $0x10,%esp
+  801942:	85 c0                	test   %eax,%eax
+  801944:	78 05                	js     80194b <fd_close+0x30>
+	    || fd != fd2)
+  801946:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801949:	74 16                	je     801961 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80194b:	89 f8                	mov    %edi,%eax
+  80194d:	84 c0                	test   %al,%al
+  80194f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801954:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801957:	89 d8                	mov    %ebx,%eax
+  801959:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80195c:	5b                   	pop    %ebx
+  80195d:	5e                   	pop    %esi
+  80195e:	5f                   	pop    %edi
+  80195f:	5d                   	pop    %ebp
+  801960:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801961:	83 ec 08             	sub    $0x8,%esp
+  801964:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801967:	50                   	push   %eax
+  801968:	ff 36                	push   (%esi)
+  80196a:	e8 60 ff ff ff       	call   8018cf <dev_lookup>
+  80196f:	89 c3                	mov    %eax,%ebx
+  801971:	83 c4 10             	add    $0x10,%esp
+  801974:	85 c0                	test   %eax,%eax
+  801976:	78 1a                	js     801992 <fd_close+0x77>
+		if (dev->dev_close)
+  801978:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80197b:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80197e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801983:	85 c0                	test   %eax,%eax
+  801985:	74 0b                	je     801992 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801987:	83 ec 0c             	sub    $0xc,%esp
+  80198a:	56                   	push   %esi
+  80198b:	ff d0                	call   *%eax
+  80198d:	89 c3                	mov    %eax,%ebx
+  80198f:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801992:	83 ec 08             	sub    $0x8,%esp
+  801995:	56                   	push   %esi
+  801996:	6a 00                	push   $0x0
+  801998:	e8 9d f3 ff ff       	call   800d3a <sys_page_unmap>
+	return r;
+  80199d:	83 c4 10             	add    $0x10,%esp
+  8019a0:	eb b5                	jmp    801957 <fd_close+0x3c>
+
+008019a2 <close>:
+
+int
+close(int fdnum)
+{
+  8019a2:	55                   	push   %ebp
+  8019a3:	89 e5                	mov    %esp,%ebp
+  8019a5:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ab:	50                   	push   %eax
+  8019ac:	ff 75 08             	push   0x8(%ebp)
+  8019af:	e8 cb fe ff ff       	call   80187f <fd_lookup>
+  8019b4:	83 c4 10             	add    $0x10,%esp
+  8019b7:	85 c0                	test   %eax,%eax
+  8019b9:	79 02                	jns    8019bd <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8019bb:	c9                   	leave
+  8019bc:	c3                   	ret
+		return fd_close(fd, 1);
+  8019bd:	83 ec 08             	sub    $0x8,%esp
+  8019c0:	6a 01                	push   $0x1
+  8019c2:	ff 75 f4             	push   -0xc(%ebp)
+  8019c5:	e8 51 ff ff ff       	call   80191b <fd_close>
+  8019ca:	83 c4 10             	add    $0x10,%esp
+  8019cd:	eb ec                	jmp    8019bb <close+0x19>
+
+008019cf <close_all>:
+
+void
+close_all(void)
+{
+  8019cf:	55                   	push   %ebp
+  8019d0:	89 e5                	mov    %esp,%ebp
+  8019d2:	53                   	push   %ebx
+  8019d3:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8019d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8019db:	83 ec 0c             	sub    $0xc,%esp
+  8019de:	53                   	push   %ebx
+  8019df:	e8 be ff ff ff       	call   8019a2 <close>
+	for (i = 0; i < MAXFD; i++)
+  8019e4:	83 c3 01             	add    $0x1,%ebx
+  8019e7:	83 c4 10             	add    $0x10,%esp
+  8019ea:	83 fb 20             	cmp    $0x20,%ebx
+  8019ed:	75 ec                	jne    8019db <close_all+0xc>
+}
+  8019ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019f2:	c9                   	leave
+  8019f3:	c3                   	ret
+
+008019f4 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019f4:	55                   	push   %ebp
+  8019f5:	89 e5                	mov    %esp,%ebp
+  8019f7:	57                   	push   %edi
+  8019f8:	56                   	push   %esi
+  8019f9:	53                   	push   %ebx
+  8019fa:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019fd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a00:	50                   	push   %eax
+  801a01:	ff 75 08             	push   0x8(%ebp)
+  801a04:	e8 76 fe ff ff       	call   80187f <fd_lookup>
+  801a09:	89 c3                	mov    %eax,%ebx
+  801a0b:	83 c4 10             	add    $0x10,%esp
+  801a0e:	85 c0                	test   %eax,%eax
+  801a10:	78 7f                	js     801a91 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a12:	83 ec 0c             	sub    $0xc,%esp
+  801a15:	ff 75 0c             	push   0xc(%ebp)
+  801a18:	e8 85 ff ff ff       	call   8019a2 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801a1d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a20:	c1 e6 0c             	shl    $0xc,%esi
+  801a23:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801a29:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a2c:	89 3c 24             	mov    %edi,(%esp)
+  801a2f:	e8 e0 fd ff ff       	call   801814 <fd2data>
+  801a34:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801a36:	89 34 24             	mov    %esi,(%esp)
+  801a39:	e8 d6 fd ff ff       	call   801814 <fd2data>
+  801a3e:	83 c4 10             	add    $0x10,%esp
+  801a41:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a44:	89 d8                	mov    %ebx,%eax
+  801a46:	c1 e8 16             	shr    $0x16,%eax
+  801a49:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a50:	a8 01                	test   $0x1,%al
+  801a52:	74 11                	je     801a65 <dup+0x71>
+  801a54:	89 d8                	mov    %ebx,%eax
+  801a56:	c1 e8 0c             	shr    $0xc,%eax
+  801a59:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a60:	f6 c2 01             	test   $0x1,%dl
+  801a63:	75 36                	jne    801a9b <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a65:	89 f8                	mov    %edi,%eax
+  801a67:	c1 e8 0c             	shr    $0xc,%eax
+  801a6a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a71:	83 ec 0c             	sub    $0xc,%esp
+  801a74:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a79:	50                   	push   %eax
+  801a7a:	56                   	push   %esi
+  801a7b:	6a 00                	push   $0x0
+  801a7d:	57                   	push   %edi
+  801a7e:	6a 00                	push   $0x0
+  801a80:	e8 73 f2 ff ff       	call   800cf8 <sys_page_map>
+  801a85:	89 c3                	mov    %eax,%ebx
+  801a87:	83 c4 20             	add    $0x20,%esp
+  801a8a:	85 c0                	test   %eax,%eax
+  801a8c:	78 33                	js     801ac1 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a8e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a91:	89 d8                	mov    %ebx,%eax
+  801a93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a96:	5b                   	pop    %ebx
+  801a97:	5e                   	pop    %esi
+  801a98:	5f                   	pop    %edi
+  801a99:	5d                   	pop    %ebp
+  801a9a:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a9b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801aa2:	83 ec 0c             	sub    $0xc,%esp
+  801aa5:	25 07 0e 00 00       	and    $0xe07,%eax
+  801aaa:	50                   	push   %eax
+  801aab:	ff 75 d4             	push   -0x2c(%ebp)
+  801aae:	6a 00                	push   $0x0
+  801ab0:	53                   	push   %ebx
+  801ab1:	6a 00                	push   $0x0
+  801ab3:	e8 40 f2 ff ff       	call   800cf8 <sys_page_map>
+  801ab8:	89 c3                	mov    %eax,%ebx
+  801aba:	83 c4 20             	add    $0x20,%esp
+  801abd:	85 c0                	test   %eax,%eax
+  801abf:	79 a4                	jns    801a65 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801ac1:	83 ec 08             	sub    $0x8,%esp
+  801ac4:	56                   	push   %esi
+  801ac5:	6a 00                	push   $0x0
+  801ac7:	e8 6e f2 ff ff       	call   800d3a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801acc:	83 c4 08             	add    $0x8,%esp
+  801acf:	ff 75 d4             	push   -0x2c(%ebp)
+  801ad2:	6a 00                	push   $0x0
+  801ad4:	e8 61 f2 ff ff       	call   800d3a <sys_page_unmap>
+	return r;
+  801ad9:	83 c4 10             	add    $0x10,%esp
+  801adc:	eb b3                	jmp    801a91 <dup+0x9d>
+
+00801ade <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801ade:	55                   	push   %ebp
+  801adf:	89 e5                	mov    %esp,%ebp
+  801ae1:	56                   	push   %esi
+  801ae2:	53                   	push   %ebx
+  801ae3:	83 ec 18             	sub    $0x18,%esp
+  801ae6:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ae9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801aec:	50                   	push   %eax
+  801aed:	56                   	push   %esi
+  801aee:	e8 8c fd ff ff       	call   80187f <fd_lookup>
+  801af3:	83 c4 10             	add    $0x10,%esp
+  801af6:	85 c0                	test   %eax,%eax
+  801af8:	78 3c                	js     801b36 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801afa:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801afd:	83 ec 08             	sub    $0x8,%esp
+  801b00:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b03:	50                   	push   %eax
+  801b04:	ff 33                	push   (%ebx)
+  801b06:	e8 c4 fd ff ff       	call   8018cf <dev_lookup>
+  801b0b:	83 c4 10             	add    $0x10,%esp
+  801b0e:	85 c0                	test   %eax,%eax
+  801b10:	78 24                	js     801b36 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b12:	8b 43 08             	mov    0x8(%ebx),%eax
+  801b15:	83 e0 03             	and    $0x3,%eax
+  801b18:	83 f8 01             	cmp    $0x1,%eax
+  801b1b:	74 20                	je     801b3d <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801b1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b20:	8b 40 08             	mov    0x8(%eax),%eax
+  801b23:	85 c0                	test   %eax,%eax
+  801b25:	74 37                	je     801b5e <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801b27:	83 ec 04             	sub    $0x4,%esp
+  801b2a:	ff 75 10             	push   0x10(%ebp)
+  801b2d:	ff 75 0c             	push   0xc(%ebp)
+  801b30:	53                   	push   %ebx
+  801b31:	ff d0                	call   *%eax
+  801b33:	83 c4 10             	add    $0x10,%esp
+}
+  801b36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b39:	5b                   	pop    %ebx
+  801b3a:	5e                   	pop    %esi
+  801b3b:	5d                   	pop    %ebp
+  801b3c:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b3d:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801b42:	8b 40 48             	mov    0x48(%eax),%eax
+  801b45:	83 ec 04             	sub    $0x4,%esp
+  801b48:	56                   	push   %esi
+  801b49:	50                   	push   %eax
+  801b4a:	68 89 57 80 00       	push   $0x805789
+  801b4f:	e8 87 e6 ff ff       	call   8001db <cprintf>
+		return -E_INVAL;
+  801b54:	83 c4 10             	add    $0x10,%esp
+  801b57:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b5c:	eb d8                	jmp    801b36 <read+0x58>
+		return -E_NOT_SUPP;
+  801b5e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b63:	eb d1                	jmp    801b36 <read+0x58>
+
+00801b65 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b65:	55                   	push   %ebp
+  801b66:	89 e5                	mov    %esp,%ebp
+  801b68:	57                   	push   %edi
+  801b69:	56                   	push   %esi
+  801b6a:	53                   	push   %ebx
+  801b6b:	83 ec 0c             	sub    $0xc,%esp
+  801b6e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b71:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b74:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b79:	eb 02                	jmp    801b7d <readn+0x18>
+  801b7b:	01 c3                	add    %eax,%ebx
+  801b7d:	39 f3                	cmp    %esi,%ebx
+  801b7f:	73 21                	jae    801ba2 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b81:	83 ec 04             	sub    $0x4,%esp
+  801b84:	89 f0                	mov    %esi,%eax
+  801b86:	29 d8                	sub    %ebx,%eax
+  801b88:	50                   	push   %eax
+  801b89:	89 d8                	mov    %ebx,%eax
+  801b8b:	03 45 0c             	add    0xc(%ebp),%eax
+  801b8e:	50                   	push   %eax
+  801b8f:	57                   	push   %edi
+  801b90:	e8 49 ff ff ff       	call   801ade <read>
+		if (m < 0)
+  801b95:	83 c4 10             	add    $0x10,%esp
+  801b98:	85 c0                	test   %eax,%eax
+  801b9a:	78 04                	js     801ba0 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b9c:	75 dd                	jne    801b7b <readn+0x16>
+  801b9e:	eb 02                	jmp    801ba2 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801ba0:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801ba2:	89 d8                	mov    %ebx,%eax
+  801ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ba7:	5b                   	pop    %ebx
+  801ba8:	5e                   	pop    %esi
+  801ba9:	5f                   	pop    %edi
+  801baa:	5d                   	pop    %ebp
+  801bab:	c3                   	ret
+
+00801bac <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801bac:	55                   	push   %ebp
+  801bad:	89 e5                	mov    %esp,%ebp
+  801baf:	56                   	push   %esi
+  801bb0:	53                   	push   %ebx
+  801bb1:	83 ec 18             	sub    $0x18,%esp
+  801bb4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bb7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bba:	50                   	push   %eax
+  801bbb:	53                   	push   %ebx
+  801bbc:	e8 be fc ff ff       	call   80187f <fd_lookup>
+  801bc1:	83 c4 10             	add    $0x10,%esp
+  801bc4:	85 c0                	test   %eax,%eax
+  801bc6:	78 37                	js     801bff <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bc8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bcb:	83 ec 08             	sub    $0x8,%esp
+  801bce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bd1:	50                   	push   %eax
+  801bd2:	ff 36                	push   (%esi)
+  801bd4:	e8 f6 fc ff ff       	call   8018cf <dev_lookup>
+  801bd9:	83 c4 10             	add    $0x10,%esp
+  801bdc:	85 c0                	test   %eax,%eax
+  801bde:	78 1f                	js     801bff <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801be0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801be4:	74 20                	je     801c06 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801be6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801be9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bec:	85 c0                	test   %eax,%eax
+  801bee:	74 37                	je     801c27 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801bf0:	83 ec 04             	sub    $0x4,%esp
+  801bf3:	ff 75 10             	push   0x10(%ebp)
+  801bf6:	ff 75 0c             	push   0xc(%ebp)
+  801bf9:	56                   	push   %esi
+  801bfa:	ff d0                	call   *%eax
+  801bfc:	83 c4 10             	add    $0x10,%esp
+}
+  801bff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c02:	5b                   	pop    %ebx
+  801c03:	5e                   	pop    %esi
+  801c04:	5d                   	pop    %ebp
+  801c05:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c06:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801c0b:	8b 40 48             	mov    0x48(%eax),%eax
+  801c0e:	83 ec 04             	sub    $0x4,%esp
+  801c11:	53                   	push   %ebx
+  801c12:	50                   	push   %eax
+  801c13:	68 a5 57 80 00       	push   $0x8057a5
+  801c18:	e8 be e5 ff ff       	call   8001db <cprintf>
+		return -E_INVAL;
+  801c1d:	83 c4 10             	add    $0x10,%esp
+  801c20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c25:	eb d8                	jmp    801bff <write+0x53>
+		return -E_NOT_SUPP;
+  801c27:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c2c:	eb d1                	jmp    801bff <write+0x53>
+
+00801c2e <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c2e:	55                   	push   %ebp
+  801c2f:	89 e5                	mov    %esp,%ebp
+  801c31:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c37:	50                   	push   %eax
+  801c38:	ff 75 08             	push   0x8(%ebp)
+  801c3b:	e8 3f fc ff ff       	call   80187f <fd_lookup>
+  801c40:	83 c4 10             	add    $0x10,%esp
+  801c43:	85 c0                	test   %eax,%eax
+  801c45:	78 0e                	js     801c55 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c47:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c4d:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c50:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c55:	c9                   	leave
+  801c56:	c3                   	ret
+
+00801c57 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c57:	55                   	push   %ebp
+  801c58:	89 e5                	mov    %esp,%ebp
+  801c5a:	56                   	push   %esi
+  801c5b:	53                   	push   %ebx
+  801c5c:	83 ec 18             	sub    $0x18,%esp
+  801c5f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c62:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c65:	50                   	push   %eax
+  801c66:	53                   	push   %ebx
+  801c67:	e8 13 fc ff ff       	call   80187f <fd_lookup>
+  801c6c:	83 c4 10             	add    $0x10,%esp
+  801c6f:	85 c0                	test   %eax,%eax
+  801c71:	78 34                	js     801ca7 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c73:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c76:	83 ec 08             	sub    $0x8,%esp
+  801c79:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c7c:	50                   	push   %eax
+  801c7d:	ff 36                	push   (%esi)
+  801c7f:	e8 4b fc ff ff       	call   8018cf <dev_lookup>
+  801c84:	83 c4 10             	add    $0x10,%esp
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	78 1c                	js     801ca7 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c8b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c8f:	74 1d                	je     801cae <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801c91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c94:	8b 40 18             	mov    0x18(%eax),%eax
+  801c97:	85 c0                	test   %eax,%eax
+  801c99:	74 34                	je     801ccf <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801c9b:	83 ec 08             	sub    $0x8,%esp
+  801c9e:	ff 75 0c             	push   0xc(%ebp)
+  801ca1:	56                   	push   %esi
+  801ca2:	ff d0                	call   *%eax
+  801ca4:	83 c4 10             	add    $0x10,%esp
+}
+  801ca7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801caa:	5b                   	pop    %ebx
+  801cab:	5e                   	pop    %esi
+  801cac:	5d                   	pop    %ebp
+  801cad:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801cae:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801cb3:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cb6:	83 ec 04             	sub    $0x4,%esp
+  801cb9:	53                   	push   %ebx
+  801cba:	50                   	push   %eax
+  801cbb:	68 68 57 80 00       	push   $0x805768
+  801cc0:	e8 16 e5 ff ff       	call   8001db <cprintf>
+		return -E_INVAL;
+  801cc5:	83 c4 10             	add    $0x10,%esp
+  801cc8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ccd:	eb d8                	jmp    801ca7 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801ccf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cd4:	eb d1                	jmp    801ca7 <ftruncate+0x50>
+
+00801cd6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801cd6:	55                   	push   %ebp
+  801cd7:	89 e5                	mov    %esp,%ebp
+  801cd9:	56                   	push   %esi
+  801cda:	53                   	push   %ebx
+  801cdb:	83 ec 18             	sub    $0x18,%esp
+  801cde:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ce1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ce4:	50                   	push   %eax
+  801ce5:	ff 75 08             	push   0x8(%ebp)
+  801ce8:	e8 92 fb ff ff       	call   80187f <fd_lookup>
+  801ced:	83 c4 10             	add    $0x10,%esp
+  801cf0:	85 c0                	test   %eax,%eax
+  801cf2:	78 49                	js     801d3d <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cf4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cf7:	83 ec 08             	sub    $0x8,%esp
+  801cfa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cfd:	50                   	push   %eax
+  801cfe:	ff 36                	push   (%esi)
+  801d00:	e8 ca fb ff ff       	call   8018cf <dev_lookup>
+  801d05:	83 c4 10             	add    $0x10,%esp
+  801d08:	85 c0                	test   %eax,%eax
+  801d0a:	78 31                	js     801d3d <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d0f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d13:	74 2f                	je     801d44 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d15:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d18:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d1f:	00 00 00 
+	stat->st_isdir = 0;
+  801d22:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d29:	00 00 00 
+	stat->st_dev = dev;
+  801d2c:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d32:	83 ec 08             	sub    $0x8,%esp
+  801d35:	53                   	push   %ebx
+  801d36:	56                   	push   %esi
+  801d37:	ff 50 14             	call   *0x14(%eax)
+  801d3a:	83 c4 10             	add    $0x10,%esp
+}
+  801d3d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d40:	5b                   	pop    %ebx
+  801d41:	5e                   	pop    %esi
+  801d42:	5d                   	pop    %ebp
+  801d43:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d44:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d49:	eb f2                	jmp    801d3d <fstat+0x67>
+
+00801d4b <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d4b:	55                   	push   %ebp
+  801d4c:	89 e5                	mov    %esp,%ebp
+  801d4e:	56                   	push   %esi
+  801d4f:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801d50:	83 ec 08             	sub    $0x8,%esp
+  801d53:	6a 00                	push   $0x0
+  801d55:	ff 75 08             	push   0x8(%ebp)
+  801d58:	e8 bc 02 00 00       	call   802019 <open>
+  801d5d:	89 c3                	mov    %eax,%ebx
+  801d5f:	83 c4 10             	add    $0x10,%esp
+  801d62:	85 c0                	test   %eax,%eax
+  801d64:	78 1b                	js     801d81 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801d66:	83 ec 08             	sub    $0x8,%esp
+  801d69:	ff 75 0c             	push   0xc(%ebp)
+  801d6c:	50                   	push   %eax
+  801d6d:	e8 64 ff ff ff       	call   801cd6 <fstat>
+  801d72:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801d74:	89 1c 24             	mov    %ebx,(%esp)
+  801d77:	e8 26 fc ff ff       	call   8019a2 <close>
+	return r;
+  801d7c:	83 c4 10             	add    $0x10,%esp
+  801d7f:	89 f3                	mov    %esi,%ebx
+}
+  801d81:	89 d8                	mov    %ebx,%eax
+  801d83:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d86:	5b                   	pop    %ebx
+  801d87:	5e                   	pop    %esi
+  801d88:	5d                   	pop    %ebp
+  801d89:	c3                   	ret
+
+00801d8a <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801d8a:	55                   	push   %ebp
+  801d8b:	89 e5                	mov    %esp,%ebp
+  801d8d:	57                   	push   %edi
+  801d8e:	56                   	push   %esi
+  801d8f:	53                   	push   %ebx
+  801d90:	83 ec 0c             	sub    $0xc,%esp
+  801d93:	89 c7                	mov    %eax,%edi
+  801d95:	89 d3                	mov    %edx,%ebx
+  801d97:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801d99:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801da0:	74 2d                	je     801dcf <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801da2:	6a 07                	push   $0x7
+  801da4:	68 00 f0 80 00       	push   $0x80f000
+  801da9:	57                   	push   %edi
+  801daa:	ff 35 00 70 80 00    	push   0x807000
+  801db0:	e8 94 31 00 00       	call   804f49 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801db5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801dbc:	6a 00                	push   $0x0
+  801dbe:	56                   	push   %esi
+  801dbf:	53                   	push   %ebx
+  801dc0:	6a 00                	push   $0x0
+  801dc2:	e8 34 30 00 00       	call   804dfb <ipc_recv_pages>
+}
+  801dc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dca:	5b                   	pop    %ebx
+  801dcb:	5e                   	pop    %esi
+  801dcc:	5f                   	pop    %edi
+  801dcd:	5d                   	pop    %ebp
+  801dce:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801dcf:	83 ec 0c             	sub    $0xc,%esp
+  801dd2:	6a 01                	push   $0x1
+  801dd4:	e8 65 32 00 00       	call   80503e <ipc_find_env>
+  801dd9:	a3 00 70 80 00       	mov    %eax,0x807000
+  801dde:	83 c4 10             	add    $0x10,%esp
+  801de1:	eb bf                	jmp    801da2 <fsipc_pages+0x18>
+
+00801de3 <fsipc>:
+{
+  801de3:	55                   	push   %ebp
+  801de4:	89 e5                	mov    %esp,%ebp
+  801de6:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801de9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801dee:	e8 97 ff ff ff       	call   801d8a <fsipc_pages>
+}
+  801df3:	c9                   	leave
+  801df4:	c3                   	ret
+
+00801df5 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801df5:	55                   	push   %ebp
+  801df6:	89 e5                	mov    %esp,%ebp
+  801df8:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801dfb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dfe:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e01:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  801e06:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e09:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e13:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e18:	e8 c6 ff ff ff       	call   801de3 <fsipc>
+}
+  801e1d:	c9                   	leave
+  801e1e:	c3                   	ret
+
+00801e1f <devfile_flush>:
+{
+  801e1f:	55                   	push   %ebp
+  801e20:	89 e5                	mov    %esp,%ebp
+  801e22:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e25:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e28:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e2b:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e30:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e35:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e3a:	e8 a4 ff ff ff       	call   801de3 <fsipc>
+}
+  801e3f:	c9                   	leave
+  801e40:	c3                   	ret
+
+00801e41 <devfile_stat>:
+{
+  801e41:	55                   	push   %ebp
+  801e42:	89 e5                	mov    %esp,%ebp
+  801e44:	53                   	push   %ebx
+  801e45:	83 ec 04             	sub    $0x4,%esp
+  801e48:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e4e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e51:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e56:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e5b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e60:	e8 7e ff ff ff       	call   801de3 <fsipc>
+  801e65:	85 c0                	test   %eax,%eax
+  801e67:	78 2c                	js     801e95 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e69:	83 ec 08             	sub    $0x8,%esp
+  801e6c:	68 00 f0 80 00       	push   $0x80f000
+  801e71:	53                   	push   %ebx
+  801e72:	e8 4b e9 ff ff       	call   8007c2 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801e77:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  801e7c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e82:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  801e87:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801e8d:	83 c4 10             	add    $0x10,%esp
+  801e90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e98:	c9                   	leave
+  801e99:	c3                   	ret
+
+00801e9a <devfile_write>:
+{
+  801e9a:	55                   	push   %ebp
+  801e9b:	89 e5                	mov    %esp,%ebp
+  801e9d:	83 ec 0c             	sub    $0xc,%esp
+  801ea0:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801ea3:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801ea8:	39 d0                	cmp    %edx,%eax
+  801eaa:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ead:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eb0:	8b 52 0c             	mov    0xc(%edx),%edx
+  801eb3:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  801eb9:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801ebe:	50                   	push   %eax
+  801ebf:	ff 75 0c             	push   0xc(%ebp)
+  801ec2:	68 08 f0 80 00       	push   $0x80f008
+  801ec7:	e8 7c ea ff ff       	call   800948 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801ecc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ed1:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ed6:	e8 08 ff ff ff       	call   801de3 <fsipc>
+}
+  801edb:	c9                   	leave
+  801edc:	c3                   	ret
+
+00801edd <devfile_read>:
+{
+  801edd:	55                   	push   %ebp
+  801ede:	89 e5                	mov    %esp,%ebp
+  801ee0:	57                   	push   %edi
+  801ee1:	56                   	push   %esi
+  801ee2:	53                   	push   %ebx
+  801ee3:	83 ec 1c             	sub    $0x1c,%esp
+  801ee6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ee9:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801eec:	89 fe                	mov    %edi,%esi
+  801eee:	c1 ee 0c             	shr    $0xc,%esi
+  801ef1:	b8 20 00 00 00       	mov    $0x20,%eax
+  801ef6:	39 c6                	cmp    %eax,%esi
+  801ef8:	0f 47 f0             	cmova  %eax,%esi
+  801efb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801efe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f03:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801f06:	eb 14                	jmp    801f1c <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801f08:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801f0f:	05 00 10 00 00       	add    $0x1000,%eax
+  801f14:	f6 c6 06             	test   $0x6,%dh
+  801f17:	75 42                	jne    801f5b <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801f19:	83 c1 01             	add    $0x1,%ecx
+  801f1c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801f1f:	39 f1                	cmp    %esi,%ecx
+  801f21:	0f 84 95 00 00 00    	je     801fbc <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801f27:	89 c2                	mov    %eax,%edx
+  801f29:	c1 ea 16             	shr    $0x16,%edx
+  801f2c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801f33:	f6 c2 01             	test   $0x1,%dl
+  801f36:	74 23                	je     801f5b <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801f38:	89 c2                	mov    %eax,%edx
+  801f3a:	c1 ea 0c             	shr    $0xc,%edx
+  801f3d:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801f44:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801f4a:	74 0f                	je     801f5b <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801f4c:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801f53:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801f59:	75 ad                	jne    801f08 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801f5b:	85 c9                	test   %ecx,%ecx
+  801f5d:	74 11                	je     801f70 <devfile_read+0x93>
+  801f5f:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801f66:	75 08                	jne    801f70 <devfile_read+0x93>
+  801f68:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801f6e:	74 50                	je     801fc0 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f70:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801f73:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  801f78:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801f7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f83:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f88:	e8 56 fe ff ff       	call   801de3 <fsipc>
+  801f8d:	89 c6                	mov    %eax,%esi
+  801f8f:	85 c0                	test   %eax,%eax
+  801f91:	78 1f                	js     801fb2 <devfile_read+0xd5>
+	assert(r <= n);
+  801f93:	39 c7                	cmp    %eax,%edi
+  801f95:	72 50                	jb     801fe7 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801f97:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f9c:	7f 62                	jg     802000 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801f9e:	83 ec 04             	sub    $0x4,%esp
+  801fa1:	50                   	push   %eax
+  801fa2:	68 00 f0 80 00       	push   $0x80f000
+  801fa7:	ff 75 0c             	push   0xc(%ebp)
+  801faa:	e8 99 e9 ff ff       	call   800948 <memmove>
+	return r;
+  801faf:	83 c4 10             	add    $0x10,%esp
+}
+  801fb2:	89 f0                	mov    %esi,%eax
+  801fb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fb7:	5b                   	pop    %ebx
+  801fb8:	5e                   	pop    %esi
+  801fb9:	5f                   	pop    %edi
+  801fba:	5d                   	pop    %ebp
+  801fbb:	c3                   	ret
+  801fbc:	89 f1                	mov    %esi,%ecx
+  801fbe:	eb 9b                	jmp    801f5b <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801fc0:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801fc3:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801fc8:	89 c8                	mov    %ecx,%eax
+  801fca:	c1 e0 0c             	shl    $0xc,%eax
+  801fcd:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801fd2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fd5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801fda:	e8 ab fd ff ff       	call   801d8a <fsipc_pages>
+  801fdf:	89 c6                	mov    %eax,%esi
+  801fe1:	85 c0                	test   %eax,%eax
+  801fe3:	78 8b                	js     801f70 <devfile_read+0x93>
+  801fe5:	eb cb                	jmp    801fb2 <devfile_read+0xd5>
+	assert(r <= n);
+  801fe7:	68 d4 57 80 00       	push   $0x8057d4
+  801fec:	68 db 57 80 00       	push   $0x8057db
+  801ff1:	68 a0 00 00 00       	push   $0xa0
+  801ff6:	68 f0 57 80 00       	push   $0x8057f0
+  801ffb:	e8 9b 2c 00 00       	call   804c9b <_panic>
+	assert(r <= PGSIZE);
+  802000:	68 fb 57 80 00       	push   $0x8057fb
+  802005:	68 db 57 80 00       	push   $0x8057db
+  80200a:	68 a1 00 00 00       	push   $0xa1
+  80200f:	68 f0 57 80 00       	push   $0x8057f0
+  802014:	e8 82 2c 00 00       	call   804c9b <_panic>
+
+00802019 <open>:
+{
+  802019:	55                   	push   %ebp
+  80201a:	89 e5                	mov    %esp,%ebp
+  80201c:	56                   	push   %esi
+  80201d:	53                   	push   %ebx
+  80201e:	83 ec 1c             	sub    $0x1c,%esp
+  802021:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802024:	56                   	push   %esi
+  802025:	e8 5d e7 ff ff       	call   800787 <strlen>
+  80202a:	83 c4 10             	add    $0x10,%esp
+  80202d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802032:	7f 6c                	jg     8020a0 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802034:	83 ec 0c             	sub    $0xc,%esp
+  802037:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80203a:	50                   	push   %eax
+  80203b:	e8 eb f7 ff ff       	call   80182b <fd_alloc>
+  802040:	89 c3                	mov    %eax,%ebx
+  802042:	83 c4 10             	add    $0x10,%esp
+  802045:	85 c0                	test   %eax,%eax
+  802047:	78 3c                	js     802085 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802049:	83 ec 08             	sub    $0x8,%esp
+  80204c:	56                   	push   %esi
+  80204d:	68 00 f0 80 00       	push   $0x80f000
+  802052:	e8 6b e7 ff ff       	call   8007c2 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802057:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80205a:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80205f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802062:	b8 01 00 00 00       	mov    $0x1,%eax
+  802067:	e8 77 fd ff ff       	call   801de3 <fsipc>
+  80206c:	89 c3                	mov    %eax,%ebx
+  80206e:	83 c4 10             	add    $0x10,%esp
+  802071:	85 c0                	test   %eax,%eax
+  802073:	78 19                	js     80208e <open+0x75>
+	return fd2num(fd);
+  802075:	83 ec 0c             	sub    $0xc,%esp
+  802078:	ff 75 f4             	push   -0xc(%ebp)
+  80207b:	e8 84 f7 ff ff       	call   801804 <fd2num>
+  802080:	89 c3                	mov    %eax,%ebx
+  802082:	83 c4 10             	add    $0x10,%esp
+}
+  802085:	89 d8                	mov    %ebx,%eax
+  802087:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80208a:	5b                   	pop    %ebx
+  80208b:	5e                   	pop    %esi
+  80208c:	5d                   	pop    %ebp
+  80208d:	c3                   	ret
+		fd_close(fd, 0);
+  80208e:	83 ec 08             	sub    $0x8,%esp
+  802091:	6a 00                	push   $0x0
+  802093:	ff 75 f4             	push   -0xc(%ebp)
+  802096:	e8 80 f8 ff ff       	call   80191b <fd_close>
+		return r;
+  80209b:	83 c4 10             	add    $0x10,%esp
+  80209e:	eb e5                	jmp    802085 <open+0x6c>
+		return -E_BAD_PATH;
+  8020a0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8020a5:	eb de                	jmp    802085 <open+0x6c>
+
+008020a7 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8020a7:	55                   	push   %ebp
+  8020a8:	89 e5                	mov    %esp,%ebp
+  8020aa:	53                   	push   %ebx
+  8020ab:	83 ec 10             	sub    $0x10,%esp
+  8020ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8020b1:	53                   	push   %ebx
+  8020b2:	e8 d0 e6 ff ff       	call   800787 <strlen>
+  8020b7:	83 c4 10             	add    $0x10,%esp
+  8020ba:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020bf:	7f 25                	jg     8020e6 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8020c1:	83 ec 08             	sub    $0x8,%esp
+  8020c4:	53                   	push   %ebx
+  8020c5:	68 00 f0 80 00       	push   $0x80f000
+  8020ca:	e8 f3 e6 ff ff       	call   8007c2 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8020cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020d4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8020d9:	e8 05 fd ff ff       	call   801de3 <fsipc>
+  8020de:	83 c4 10             	add    $0x10,%esp
+}
+  8020e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020e4:	c9                   	leave
+  8020e5:	c3                   	ret
+		return -E_BAD_PATH;
+  8020e6:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8020eb:	eb f4                	jmp    8020e1 <remove+0x3a>
+
+008020ed <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8020ed:	55                   	push   %ebp
+  8020ee:	89 e5                	mov    %esp,%ebp
+  8020f0:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8020f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020fd:	e8 e1 fc ff ff       	call   801de3 <fsipc>
+}
+  802102:	c9                   	leave
+  802103:	c3                   	ret
+
+00802104 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  802104:	55                   	push   %ebp
+  802105:	89 e5                	mov    %esp,%ebp
+  802107:	53                   	push   %ebx
+  802108:	83 ec 04             	sub    $0x4,%esp
+  80210b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  80210e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802113:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802118:	e8 c6 fc ff ff       	call   801de3 <fsipc>
+  80211d:	85 c0                	test   %eax,%eax
+  80211f:	78 3c                	js     80215d <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  802121:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  802126:	89 03                	mov    %eax,(%ebx)
+  802128:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  80212d:	89 43 04             	mov    %eax,0x4(%ebx)
+  802130:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  802135:	89 43 08             	mov    %eax,0x8(%ebx)
+  802138:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  80213d:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802140:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  802145:	89 43 10             	mov    %eax,0x10(%ebx)
+  802148:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  80214d:	89 43 14             	mov    %eax,0x14(%ebx)
+  802150:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  802155:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  802158:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80215d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802160:	c9                   	leave
+  802161:	c3                   	ret
+
+00802162 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  802162:	55                   	push   %ebp
+  802163:	89 e5                	mov    %esp,%ebp
+  802165:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  802168:	8b 45 08             	mov    0x8(%ebp),%eax
+  80216b:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  802170:	ba 00 00 00 00       	mov    $0x0,%edx
+  802175:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80217a:	e8 64 fc ff ff       	call   801de3 <fsipc>
+}
+  80217f:	c9                   	leave
+  802180:	c3                   	ret
+
+00802181 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802181:	55                   	push   %ebp
+  802182:	89 e5                	mov    %esp,%ebp
+  802184:	56                   	push   %esi
+  802185:	53                   	push   %ebx
+  802186:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802189:	83 ec 0c             	sub    $0xc,%esp
+  80218c:	ff 75 08             	push   0x8(%ebp)
+  80218f:	e8 80 f6 ff ff       	call   801814 <fd2data>
+  802194:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802196:	83 c4 08             	add    $0x8,%esp
+  802199:	68 07 58 80 00       	push   $0x805807
+  80219e:	53                   	push   %ebx
+  80219f:	e8 1e e6 ff ff       	call   8007c2 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8021a4:	8b 46 04             	mov    0x4(%esi),%eax
+  8021a7:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8021ad:	2b 0e                	sub    (%esi),%ecx
+  8021af:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8021b4:	89 c8                	mov    %ecx,%eax
+  8021b6:	f7 e2                	mul    %edx
+  8021b8:	c1 ea 0c             	shr    $0xc,%edx
+  8021bb:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8021c1:	29 d1                	sub    %edx,%ecx
+  8021c3:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8021c9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8021d0:	00 00 00 
+	stat->st_dev = &devpipe;
+  8021d3:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  8021da:	60 80 00 
+	return 0;
+}
+  8021dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021e5:	5b                   	pop    %ebx
+  8021e6:	5e                   	pop    %esi
+  8021e7:	5d                   	pop    %ebp
+  8021e8:	c3                   	ret
+
+008021e9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8021e9:	55                   	push   %ebp
+  8021ea:	89 e5                	mov    %esp,%ebp
+  8021ec:	53                   	push   %ebx
+  8021ed:	83 ec 0c             	sub    $0xc,%esp
+  8021f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8021f3:	53                   	push   %ebx
+  8021f4:	6a 00                	push   $0x0
+  8021f6:	e8 3f eb ff ff       	call   800d3a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8021fb:	89 1c 24             	mov    %ebx,(%esp)
+  8021fe:	e8 11 f6 ff ff       	call   801814 <fd2data>
+  802203:	83 c4 08             	add    $0x8,%esp
+  802206:	50                   	push   %eax
+  802207:	6a 00                	push   $0x0
+  802209:	e8 2c eb ff ff       	call   800d3a <sys_page_unmap>
+}
+  80220e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802211:	c9                   	leave
+  802212:	c3                   	ret
+
+00802213 <_pipeisclosed>:
+{
+  802213:	55                   	push   %ebp
+  802214:	89 e5                	mov    %esp,%ebp
+  802216:	57                   	push   %edi
+  802217:	56                   	push   %esi
+  802218:	53                   	push   %ebx
+  802219:	83 ec 1c             	sub    $0x1c,%esp
+  80221c:	89 c7                	mov    %eax,%edi
+  80221e:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802220:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802225:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802228:	83 ec 0c             	sub    $0xc,%esp
+  80222b:	57                   	push   %edi
+  80222c:	e8 4c 2e 00 00       	call   80507d <pageref>
+  802231:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802234:	89 34 24             	mov    %esi,(%esp)
+  802237:	e8 41 2e 00 00       	call   80507d <pageref>
+		nn = thisenv->env_runs;
+  80223c:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  802242:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802245:	83 c4 10             	add    $0x10,%esp
+  802248:	39 cb                	cmp    %ecx,%ebx
+  80224a:	74 1b                	je     802267 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80224c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80224f:	75 cf                	jne    802220 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802251:	8b 42 58             	mov    0x58(%edx),%eax
+  802254:	6a 01                	push   $0x1
+  802256:	50                   	push   %eax
+  802257:	53                   	push   %ebx
+  802258:	68 0e 58 80 00       	push   $0x80580e
+  80225d:	e8 79 df ff ff       	call   8001db <cprintf>
+  802262:	83 c4 10             	add    $0x10,%esp
+  802265:	eb b9                	jmp    802220 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802267:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80226a:	0f 94 c0             	sete   %al
+  80226d:	0f b6 c0             	movzbl %al,%eax
+}
+  802270:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802273:	5b                   	pop    %ebx
+  802274:	5e                   	pop    %esi
+  802275:	5f                   	pop    %edi
+  802276:	5d                   	pop    %ebp
+  802277:	c3                   	ret
+
+00802278 <devpipe_read>:
+{
+  802278:	55                   	push   %ebp
+  802279:	89 e5                	mov    %esp,%ebp
+  80227b:	57                   	push   %edi
+  80227c:	56                   	push   %esi
+  80227d:	53                   	push   %ebx
+  80227e:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802281:	ff 75 08             	push   0x8(%ebp)
+  802284:	e8 8b f5 ff ff       	call   801814 <fd2data>
+  802289:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  80228b:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  80228e:	8d 40 04             	lea    0x4(%eax),%eax
+  802291:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802294:	8b 7b 04             	mov    0x4(%ebx),%edi
+  802297:	8b 0b                	mov    (%ebx),%ecx
+  802299:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  80229f:	29 ce                	sub    %ecx,%esi
+  8022a1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8022a6:	f7 e6                	mul    %esi
+  8022a8:	c1 ea 0c             	shr    $0xc,%edx
+  8022ab:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8022b1:	29 c6                	sub    %eax,%esi
+  8022b3:	89 f2                	mov    %esi,%edx
+  8022b5:	75 43                	jne    8022fa <devpipe_read+0x82>
+		ref = pageref(p);
+  8022b7:	83 ec 0c             	sub    $0xc,%esp
+  8022ba:	53                   	push   %ebx
+  8022bb:	e8 bd 2d 00 00       	call   80507d <pageref>
+  8022c0:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8022c2:	89 da                	mov    %ebx,%edx
+  8022c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c7:	e8 47 ff ff ff       	call   802213 <_pipeisclosed>
+  8022cc:	83 c4 10             	add    $0x10,%esp
+  8022cf:	85 c0                	test   %eax,%eax
+  8022d1:	0f 85 c1 00 00 00    	jne    802398 <devpipe_read+0x120>
+	*sleeping = 1;
+  8022d7:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  8022de:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8022e3:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  8022e6:	75 ac                	jne    802294 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  8022e8:	83 ec 04             	sub    $0x4,%esp
+  8022eb:	56                   	push   %esi
+  8022ec:	57                   	push   %edi
+  8022ed:	ff 75 e4             	push   -0x1c(%ebp)
+  8022f0:	e8 99 ee ff ff       	call   80118e <sys_futex_wait>
+  8022f5:	83 c4 10             	add    $0x10,%esp
+  8022f8:	eb 9a                	jmp    802294 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  8022fa:	39 75 10             	cmp    %esi,0x10(%ebp)
+  8022fd:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  802301:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802303:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802308:	f7 e1                	mul    %ecx
+  80230a:	c1 ea 0b             	shr    $0xb,%edx
+  80230d:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802313:	29 c1                	sub    %eax,%ecx
+  802315:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  802317:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80231c:	29 cf                	sub    %ecx,%edi
+  80231e:	39 f7                	cmp    %esi,%edi
+  802320:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  802323:	8d 43 10             	lea    0x10(%ebx),%eax
+  802326:	83 ec 04             	sub    $0x4,%esp
+  802329:	57                   	push   %edi
+  80232a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80232d:	01 c2                	add    %eax,%edx
+  80232f:	52                   	push   %edx
+  802330:	ff 75 0c             	push   0xc(%ebp)
+  802333:	e8 10 e6 ff ff       	call   800948 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  802338:	83 c4 0c             	add    $0xc,%esp
+  80233b:	89 f1                	mov    %esi,%ecx
+  80233d:	29 f9                	sub    %edi,%ecx
+  80233f:	51                   	push   %ecx
+  802340:	ff 75 e4             	push   -0x1c(%ebp)
+  802343:	89 f8                	mov    %edi,%eax
+  802345:	03 45 0c             	add    0xc(%ebp),%eax
+  802348:	50                   	push   %eax
+  802349:	e8 fa e5 ff ff       	call   800948 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  80234e:	89 f1                	mov    %esi,%ecx
+  802350:	03 0b                	add    (%ebx),%ecx
+  802352:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802357:	f7 e1                	mul    %ecx
+  802359:	c1 ea 0c             	shr    $0xc,%edx
+  80235c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802362:	29 d1                	sub    %edx,%ecx
+  802364:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  802366:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80236b:	83 c4 10             	add    $0x10,%esp
+  80236e:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  802372:	75 0a                	jne    80237e <devpipe_read+0x106>
+	return n;
+  802374:	89 f0                	mov    %esi,%eax
+}
+  802376:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802379:	5b                   	pop    %ebx
+  80237a:	5e                   	pop    %esi
+  80237b:	5f                   	pop    %edi
+  80237c:	5d                   	pop    %ebp
+  80237d:	c3                   	ret
+		*sleeping = 0;
+  80237e:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  802385:	83 ec 08             	sub    $0x8,%esp
+  802388:	68 00 04 00 00       	push   $0x400
+  80238d:	53                   	push   %ebx
+  80238e:	e8 4b ee ff ff       	call   8011de <sys_futex_wake>
+  802393:	83 c4 10             	add    $0x10,%esp
+  802396:	eb dc                	jmp    802374 <devpipe_read+0xfc>
+			return 0;
+  802398:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239d:	eb d7                	jmp    802376 <devpipe_read+0xfe>
+
+0080239f <devpipe_write>:
+{
+  80239f:	55                   	push   %ebp
+  8023a0:	89 e5                	mov    %esp,%ebp
+  8023a2:	57                   	push   %edi
+  8023a3:	56                   	push   %esi
+  8023a4:	53                   	push   %ebx
+  8023a5:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8023a8:	ff 75 08             	push   0x8(%ebp)
+  8023ab:	e8 64 f4 ff ff       	call   801814 <fd2data>
+  8023b0:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8023b2:	83 c4 10             	add    $0x10,%esp
+  8023b5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8023bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023bf:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8023c2:	0f 83 23 01 00 00    	jae    8024eb <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8023c8:	8b 77 04             	mov    0x4(%edi),%esi
+  8023cb:	8b 1f                	mov    (%edi),%ebx
+  8023cd:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  8023d3:	29 d9                	sub    %ebx,%ecx
+  8023d5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8023da:	f7 e1                	mul    %ecx
+  8023dc:	c1 ea 0c             	shr    $0xc,%edx
+  8023df:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8023e5:	29 c1                	sub    %eax,%ecx
+  8023e7:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8023e9:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8023ef:	75 40                	jne    802431 <devpipe_write+0x92>
+			ref = pageref(p);
+  8023f1:	83 ec 0c             	sub    $0xc,%esp
+  8023f4:	57                   	push   %edi
+  8023f5:	e8 83 2c 00 00       	call   80507d <pageref>
+  8023fa:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  8023fc:	89 fa                	mov    %edi,%edx
+  8023fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802401:	e8 0d fe ff ff       	call   802213 <_pipeisclosed>
+  802406:	83 c4 10             	add    $0x10,%esp
+  802409:	85 c0                	test   %eax,%eax
+  80240b:	0f 85 d5 00 00 00    	jne    8024e6 <devpipe_write+0x147>
+	*sleeping = 1;
+  802411:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  802418:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80241d:	39 1f                	cmp    %ebx,(%edi)
+  80241f:	75 a7                	jne    8023c8 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  802421:	83 ec 04             	sub    $0x4,%esp
+  802424:	56                   	push   %esi
+  802425:	53                   	push   %ebx
+  802426:	57                   	push   %edi
+  802427:	e8 62 ed ff ff       	call   80118e <sys_futex_wait>
+  80242c:	83 c4 10             	add    $0x10,%esp
+  80242f:	eb 97                	jmp    8023c8 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802431:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802434:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802437:	29 c1                	sub    %eax,%ecx
+  802439:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80243e:	89 d8                	mov    %ebx,%eax
+  802440:	29 d0                	sub    %edx,%eax
+  802442:	39 c1                	cmp    %eax,%ecx
+  802444:	0f 46 c1             	cmovbe %ecx,%eax
+  802447:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  802449:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80244e:	f7 e6                	mul    %esi
+  802450:	c1 ea 0b             	shr    $0xb,%edx
+  802453:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802459:	29 c6                	sub    %eax,%esi
+  80245b:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80245d:	29 f3                	sub    %esi,%ebx
+  80245f:	39 cb                	cmp    %ecx,%ebx
+  802461:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802464:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  802467:	8d 77 10             	lea    0x10(%edi),%esi
+  80246a:	83 ec 04             	sub    $0x4,%esp
+  80246d:	53                   	push   %ebx
+  80246e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802471:	03 45 0c             	add    0xc(%ebp),%eax
+  802474:	50                   	push   %eax
+  802475:	01 f2                	add    %esi,%edx
+  802477:	52                   	push   %edx
+  802478:	e8 cb e4 ff ff       	call   800948 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80247d:	83 c4 0c             	add    $0xc,%esp
+  802480:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802483:	29 d8                	sub    %ebx,%eax
+  802485:	50                   	push   %eax
+  802486:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802489:	01 d3                	add    %edx,%ebx
+  80248b:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80248e:	53                   	push   %ebx
+  80248f:	56                   	push   %esi
+  802490:	e8 b3 e4 ff ff       	call   800948 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802495:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802498:	03 4f 04             	add    0x4(%edi),%ecx
+  80249b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8024a0:	f7 e1                	mul    %ecx
+  8024a2:	c1 ea 0c             	shr    $0xc,%edx
+  8024a5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8024ab:	29 d1                	sub    %edx,%ecx
+  8024ad:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8024b0:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8024b5:	83 c4 10             	add    $0x10,%esp
+  8024b8:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8024bc:	75 0b                	jne    8024c9 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8024be:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8024c1:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8024c4:	e9 f3 fe ff ff       	jmp    8023bc <devpipe_write+0x1d>
+		*sleeping = 0;
+  8024c9:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8024d0:	83 ec 08             	sub    $0x8,%esp
+  8024d3:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  8024d8:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  8024db:	50                   	push   %eax
+  8024dc:	e8 fd ec ff ff       	call   8011de <sys_futex_wake>
+  8024e1:	83 c4 10             	add    $0x10,%esp
+  8024e4:	eb d8                	jmp    8024be <devpipe_write+0x11f>
+				return 0;
+  8024e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024ee:	5b                   	pop    %ebx
+  8024ef:	5e                   	pop    %esi
+  8024f0:	5f                   	pop    %edi
+  8024f1:	5d                   	pop    %ebp
+  8024f2:	c3                   	ret
+
+008024f3 <pipe>:
+{
+  8024f3:	55                   	push   %ebp
+  8024f4:	89 e5                	mov    %esp,%ebp
+  8024f6:	56                   	push   %esi
+  8024f7:	53                   	push   %ebx
+  8024f8:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8024fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024fe:	50                   	push   %eax
+  8024ff:	e8 27 f3 ff ff       	call   80182b <fd_alloc>
+  802504:	89 c3                	mov    %eax,%ebx
+  802506:	83 c4 10             	add    $0x10,%esp
+  802509:	85 c0                	test   %eax,%eax
+  80250b:	0f 88 23 01 00 00    	js     802634 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802511:	83 ec 04             	sub    $0x4,%esp
+  802514:	68 07 04 00 00       	push   $0x407
+  802519:	ff 75 f4             	push   -0xc(%ebp)
+  80251c:	6a 00                	push   $0x0
+  80251e:	e8 92 e7 ff ff       	call   800cb5 <sys_page_alloc>
+  802523:	89 c3                	mov    %eax,%ebx
+  802525:	83 c4 10             	add    $0x10,%esp
+  802528:	85 c0                	test   %eax,%eax
+  80252a:	0f 88 04 01 00 00    	js     802634 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802530:	83 ec 0c             	sub    $0xc,%esp
+  802533:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802536:	50                   	push   %eax
+  802537:	e8 ef f2 ff ff       	call   80182b <fd_alloc>
+  80253c:	89 c3                	mov    %eax,%ebx
+  80253e:	83 c4 10             	add    $0x10,%esp
+  802541:	85 c0                	test   %eax,%eax
+  802543:	0f 88 db 00 00 00    	js     802624 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802549:	83 ec 04             	sub    $0x4,%esp
+  80254c:	68 07 04 00 00       	push   $0x407
+  802551:	ff 75 f0             	push   -0x10(%ebp)
+  802554:	6a 00                	push   $0x0
+  802556:	e8 5a e7 ff ff       	call   800cb5 <sys_page_alloc>
+  80255b:	89 c3                	mov    %eax,%ebx
+  80255d:	83 c4 10             	add    $0x10,%esp
+  802560:	85 c0                	test   %eax,%eax
+  802562:	0f 88 bc 00 00 00    	js     802624 <pipe+0x131>
+	va = fd2data(fd0);
+  802568:	83 ec 0c             	sub    $0xc,%esp
+  80256b:	ff 75 f4             	push   -0xc(%ebp)
+  80256e:	e8 a1 f2 ff ff       	call   801814 <fd2data>
+  802573:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802575:	83 c4 0c             	add    $0xc,%esp
+  802578:	68 07 04 00 00       	push   $0x407
+  80257d:	50                   	push   %eax
+  80257e:	6a 00                	push   $0x0
+  802580:	e8 30 e7 ff ff       	call   800cb5 <sys_page_alloc>
+  802585:	89 c3                	mov    %eax,%ebx
+  802587:	83 c4 10             	add    $0x10,%esp
+  80258a:	85 c0                	test   %eax,%eax
+  80258c:	0f 88 82 00 00 00    	js     802614 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802592:	83 ec 0c             	sub    $0xc,%esp
+  802595:	ff 75 f0             	push   -0x10(%ebp)
+  802598:	e8 77 f2 ff ff       	call   801814 <fd2data>
+  80259d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8025a4:	50                   	push   %eax
+  8025a5:	6a 00                	push   $0x0
+  8025a7:	56                   	push   %esi
+  8025a8:	6a 00                	push   $0x0
+  8025aa:	e8 49 e7 ff ff       	call   800cf8 <sys_page_map>
+  8025af:	89 c3                	mov    %eax,%ebx
+  8025b1:	83 c4 20             	add    $0x20,%esp
+  8025b4:	85 c0                	test   %eax,%eax
+  8025b6:	78 4e                	js     802606 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8025b8:	a1 20 60 80 00       	mov    0x806020,%eax
+  8025bd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025c0:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8025c2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025c5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8025cc:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8025cf:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8025d1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8025d4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8025db:	83 ec 0c             	sub    $0xc,%esp
+  8025de:	ff 75 f4             	push   -0xc(%ebp)
+  8025e1:	e8 1e f2 ff ff       	call   801804 <fd2num>
+  8025e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025e9:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8025eb:	83 c4 04             	add    $0x4,%esp
+  8025ee:	ff 75 f0             	push   -0x10(%ebp)
+  8025f1:	e8 0e f2 ff ff       	call   801804 <fd2num>
+  8025f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025f9:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8025fc:	83 c4 10             	add    $0x10,%esp
+  8025ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802604:	eb 2e                	jmp    802634 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802606:	83 ec 08             	sub    $0x8,%esp
+  802609:	56                   	push   %esi
+  80260a:	6a 00                	push   $0x0
+  80260c:	e8 29 e7 ff ff       	call   800d3a <sys_page_unmap>
+  802611:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802614:	83 ec 08             	sub    $0x8,%esp
+  802617:	ff 75 f0             	push   -0x10(%ebp)
+  80261a:	6a 00                	push   $0x0
+  80261c:	e8 19 e7 ff ff       	call   800d3a <sys_page_unmap>
+  802621:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802624:	83 ec 08             	sub    $0x8,%esp
+  802627:	ff 75 f4             	push   -0xc(%ebp)
+  80262a:	6a 00                	push   $0x0
+  80262c:	e8 09 e7 ff ff       	call   800d3a <sys_page_unmap>
+  802631:	83 c4 10             	add    $0x10,%esp
+}
+  802634:	89 d8                	mov    %ebx,%eax
+  802636:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802639:	5b                   	pop    %ebx
+  80263a:	5e                   	pop    %esi
+  80263b:	5d                   	pop    %ebp
+  80263c:	c3                   	ret
+
+0080263d <pipeisclosed>:
+{
+  80263d:	55                   	push   %ebp
+  80263e:	89 e5                	mov    %esp,%ebp
+  802640:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802643:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802646:	50                   	push   %eax
+  802647:	ff 75 08             	push   0x8(%ebp)
+  80264a:	e8 30 f2 ff ff       	call   80187f <fd_lookup>
+  80264f:	83 c4 10             	add    $0x10,%esp
+  802652:	85 c0                	test   %eax,%eax
+  802654:	78 18                	js     80266e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802656:	83 ec 0c             	sub    $0xc,%esp
+  802659:	ff 75 f4             	push   -0xc(%ebp)
+  80265c:	e8 b3 f1 ff ff       	call   801814 <fd2data>
+  802661:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802663:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802666:	e8 a8 fb ff ff       	call   802213 <_pipeisclosed>
+  80266b:	83 c4 10             	add    $0x10,%esp
+}
+  80266e:	c9                   	leave
+  80266f:	c3                   	ret
+
+00802670 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802670:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802672:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  802678:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  80267e:	81 c2 34 01 00 00    	add    $0x134,%edx
+  802684:	39 d0                	cmp    %edx,%eax
+  802686:	74 2e                	je     8026b6 <segment_lookup+0x46>
+{
+  802688:	55                   	push   %ebp
+  802689:	89 e5                	mov    %esp,%ebp
+  80268b:	57                   	push   %edi
+  80268c:	56                   	push   %esi
+  80268d:	53                   	push   %ebx
+  80268e:	eb 07                	jmp    802697 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802690:	83 c0 20             	add    $0x20,%eax
+  802693:	39 d0                	cmp    %edx,%eax
+  802695:	74 15                	je     8026ac <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802697:	8b 18                	mov    (%eax),%ebx
+  802699:	39 d9                	cmp    %ebx,%ecx
+  80269b:	72 f3                	jb     802690 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  80269d:	8b 38                	mov    (%eax),%edi
+  80269f:	8b 58 04             	mov    0x4(%eax),%ebx
+  8026a2:	89 ce                	mov    %ecx,%esi
+  8026a4:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  8026a6:	39 de                	cmp    %ebx,%esi
+  8026a8:	73 e6                	jae    802690 <segment_lookup+0x20>
+  8026aa:	eb 05                	jmp    8026b1 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  8026ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026b1:	5b                   	pop    %ebx
+  8026b2:	5e                   	pop    %esi
+  8026b3:	5f                   	pop    %edi
+  8026b4:	5d                   	pop    %ebp
+  8026b5:	c3                   	ret
+	return NULL;
+  8026b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026bb:	c3                   	ret
+
+008026bc <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  8026bc:	55                   	push   %ebp
+  8026bd:	89 e5                	mov    %esp,%ebp
+  8026bf:	53                   	push   %ebx
+  8026c0:	83 ec 04             	sub    $0x4,%esp
+  8026c3:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8026c5:	c1 e8 16             	shr    $0x16,%eax
+  8026c8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8026cf:	25 81 00 00 00       	and    $0x81,%eax
+  8026d4:	83 f8 01             	cmp    $0x1,%eax
+  8026d7:	75 6b                	jne    802744 <page_is_clean+0x88>
+  8026d9:	89 da                	mov    %ebx,%edx
+  8026db:	c1 ea 0c             	shr    $0xc,%edx
+  8026de:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  8026e5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8026ea:	f6 c1 01             	test   $0x1,%cl
+  8026ed:	74 5a                	je     802749 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  8026ef:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8026f6:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  8026fc:	75 4b                	jne    802749 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  8026fe:	89 d8                	mov    %ebx,%eax
+  802700:	e8 6b ff ff ff       	call   802670 <segment_lookup>
+  802705:	89 c2                	mov    %eax,%edx
+		return 1;
+  802707:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  80270c:	85 d2                	test   %edx,%edx
+  80270e:	75 39                	jne    802749 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  802710:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  802716:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271b:	eb 03                	jmp    802720 <page_is_clean+0x64>
+  80271d:	83 c0 01             	add    $0x1,%eax
+  802720:	39 c2                	cmp    %eax,%edx
+  802722:	7e 19                	jle    80273d <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  802724:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  80272b:	72 f0                	jb     80271d <page_is_clean+0x61>
+  80272d:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  802734:	73 e7                	jae    80271d <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  802736:	b8 01 00 00 00       	mov    $0x1,%eax
+  80273b:	eb 0c                	jmp    802749 <page_is_clean+0x8d>
+	return 0;
+  80273d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802742:	eb 05                	jmp    802749 <page_is_clean+0x8d>
+		return 0;
+  802744:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802749:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80274c:	c9                   	leave
+  80274d:	c3                   	ret
+
+0080274e <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  80274e:	55                   	push   %ebp
+  80274f:	89 e5                	mov    %esp,%ebp
+  802751:	57                   	push   %edi
+  802752:	56                   	push   %esi
+  802753:	53                   	push   %ebx
+  802754:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802757:	be 00 00 00 00       	mov    $0x0,%esi
+  80275c:	eb 19                	jmp    802777 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80275e:	f7 d3                	not    %ebx
+  802760:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802766:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802768:	83 c6 01             	add    $0x1,%esi
+  80276b:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802771:	0f 87 97 00 00 00    	ja     80280e <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802777:	89 f3                	mov    %esi,%ebx
+  802779:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  80277f:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802785:	89 d8                	mov    %ebx,%eax
+  802787:	c1 e8 0a             	shr    $0xa,%eax
+  80278a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802791:	25 81 00 00 00       	and    $0x81,%eax
+  802796:	83 f8 01             	cmp    $0x1,%eax
+  802799:	75 c3                	jne    80275e <linear_walk+0x10>
+  80279b:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8027a1:	77 bb                	ja     80275e <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8027a3:	89 df                	mov    %ebx,%edi
+  8027a5:	c1 e7 0c             	shl    $0xc,%edi
+  8027a8:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8027ab:	89 f8                	mov    %edi,%eax
+  8027ad:	e8 0a ff ff ff       	call   8026bc <page_is_clean>
+  8027b2:	84 c0                	test   %al,%al
+  8027b4:	75 64                	jne    80281a <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8027b6:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  8027bc:	77 aa                	ja     802768 <linear_walk+0x1a>
+  8027be:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  8027c4:	72 a2                	jb     802768 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8027c6:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8027cd:	a8 01                	test   $0x1,%al
+  8027cf:	74 97                	je     802768 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027d1:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8027d8:	f6 c4 04             	test   $0x4,%ah
+  8027db:	75 8b                	jne    802768 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8027dd:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027e4:	f6 c4 02             	test   $0x2,%ah
+  8027e7:	0f 85 7b ff ff ff    	jne    802768 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8027ed:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8027f4:	c1 e8 0c             	shr    $0xc,%eax
+  8027f7:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8027fa:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8027ff:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802803:	66 83 f8 01          	cmp    $0x1,%ax
+  802807:	76 11                	jbe    80281a <linear_walk+0xcc>
+  802809:	e9 5a ff ff ff       	jmp    802768 <linear_walk+0x1a>
+  80280e:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  802813:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  80281a:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  802820:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802823:	83 c4 1c             	add    $0x1c,%esp
+  802826:	5b                   	pop    %ebx
+  802827:	5e                   	pop    %esi
+  802828:	5f                   	pop    %edi
+  802829:	5d                   	pop    %ebp
+  80282a:	c3                   	ret
+
+0080282b <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  80282b:	55                   	push   %ebp
+  80282c:	89 e5                	mov    %esp,%ebp
+  80282e:	56                   	push   %esi
+  80282f:	53                   	push   %ebx
+  802830:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  802832:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802837:	83 e0 7f             	and    $0x7f,%eax
+  80283a:	c1 e0 04             	shl    $0x4,%eax
+  80283d:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  802843:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802849:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  80284f:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  802855:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80285a:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  80285d:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802862:	83 c0 01             	add    $0x1,%eax
+  802865:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  80286a:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  80286d:	5b                   	pop    %ebx
+  80286e:	5e                   	pop    %esi
+  80286f:	5d                   	pop    %ebp
+  802870:	c3                   	ret
+
+00802871 <page_ring_enter>:
+{
+  802871:	55                   	push   %ebp
+  802872:	89 e5                	mov    %esp,%ebp
+  802874:	57                   	push   %edi
+  802875:	56                   	push   %esi
+  802876:	53                   	push   %ebx
+  802877:	83 ec 18             	sub    $0x18,%esp
+  80287a:	89 c6                	mov    %eax,%esi
+  80287c:	89 d7                	mov    %edx,%edi
+  80287e:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802880:	6a 00                	push   $0x0
+  802882:	6a 00                	push   $0x0
+  802884:	6a 00                	push   $0x0
+  802886:	6a 07                	push   $0x7
+  802888:	ff 35 40 b0 80 00    	push   0x80b040
+  80288e:	e8 d4 26 00 00       	call   804f67 <ipc_call>
+  802893:	83 c4 20             	add    $0x20,%esp
+  802896:	85 c0                	test   %eax,%eax
+  802898:	79 22                	jns    8028bc <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  80289a:	50                   	push   %eax
+  80289b:	68 26 58 80 00       	push   $0x805826
+  8028a0:	68 13 02 00 00       	push   $0x213
+  8028a5:	68 3a 58 80 00       	push   $0x80583a
+  8028aa:	e8 ec 23 00 00       	call   804c9b <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  8028af:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8028b4:	83 c0 01             	add    $0x1,%eax
+  8028b7:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  8028bc:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  8028c2:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  8028c7:	39 c2                	cmp    %eax,%edx
+  8028c9:	74 24                	je     8028ef <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  8028cb:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8028d0:	83 e0 7f             	and    $0x7f,%eax
+  8028d3:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  8028da:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  8028e1:	29 f0                	sub    %esi,%eax
+  8028e3:	39 d8                	cmp    %ebx,%eax
+  8028e5:	73 c8                	jae    8028af <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  8028e7:	8b 52 04             	mov    0x4(%edx),%edx
+  8028ea:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  8028ed:	eb c0                	jmp    8028af <page_ring_enter+0x3e>
+}
+  8028ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028f2:	5b                   	pop    %ebx
+  8028f3:	5e                   	pop    %esi
+  8028f4:	5f                   	pop    %edi
+  8028f5:	5d                   	pop    %ebp
+  8028f6:	c3                   	ret
+
+008028f7 <page_ring_reserve>:
+{
+  8028f7:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  8028f9:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8028fe:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802904:	29 d0                	sub    %edx,%eax
+  802906:	ba 80 00 00 00       	mov    $0x80,%edx
+  80290b:	29 ca                	sub    %ecx,%edx
+  80290d:	39 c2                	cmp    %eax,%edx
+  80290f:	72 01                	jb     802912 <page_ring_reserve+0x1b>
+  802911:	c3                   	ret
+{
+  802912:	55                   	push   %ebp
+  802913:	89 e5                	mov    %esp,%ebp
+  802915:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802918:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80291d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802922:	b8 00 00 00 00       	mov    $0x0,%eax
+  802927:	e8 45 ff ff ff       	call   802871 <page_ring_enter>
+}
+  80292c:	c9                   	leave
+  80292d:	c3                   	ret
+
+0080292e <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  80292e:	55                   	push   %ebp
+  80292f:	89 e5                	mov    %esp,%ebp
+  802931:	53                   	push   %ebx
+  802932:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802935:	6a 07                	push   $0x7
+  802937:	6a 01                	push   $0x1
+  802939:	89 c3                	mov    %eax,%ebx
+  80293b:	c1 e3 0c             	shl    $0xc,%ebx
+  80293e:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  802944:	52                   	push   %edx
+  802945:	6a 04                	push   $0x4
+  802947:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  80294e:	e8 14 26 00 00       	call   804f67 <ipc_call>
+	sharereqs[i].nslots = 0;
+  802953:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  80295a:	00 00 00 
+	return r;
+}
+  80295d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802960:	c9                   	leave
+  802961:	c3                   	ret
+
+00802962 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802962:	55                   	push   %ebp
+  802963:	89 e5                	mov    %esp,%ebp
+  802965:	56                   	push   %esi
+  802966:	53                   	push   %ebx
+  802967:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802969:	c1 e8 10             	shr    $0x10,%eax
+  80296c:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  80296f:	89 c2                	mov    %eax,%edx
+  802971:	c1 e2 0c             	shl    $0xc,%edx
+  802974:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  80297a:	8d 5e 01             	lea    0x1(%esi),%ebx
+  80297d:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  802983:	89 c2                	mov    %eax,%edx
+  802985:	c1 e2 0a             	shl    $0xa,%edx
+  802988:	01 f2                	add    %esi,%edx
+  80298a:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802991:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802997:	74 09                	je     8029a2 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802999:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80299e:	5b                   	pop    %ebx
+  80299f:	5e                   	pop    %esi
+  8029a0:	5d                   	pop    %ebp
+  8029a1:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  8029a2:	e8 87 ff ff ff       	call   80292e <page_share_send>
+  8029a7:	eb f5                	jmp    80299e <page_share_slot+0x3c>
+
+008029a9 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  8029a9:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8029ae:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  8029b1:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  8029b6:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  8029bc:	74 09                	je     8029c7 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  8029be:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  8029c3:	85 c0                	test   %eax,%eax
+  8029c5:	75 01                	jne    8029c8 <page_ring_ready+0x1f>
+}
+  8029c7:	c3                   	ret
+{
+  8029c8:	55                   	push   %ebp
+  8029c9:	89 e5                	mov    %esp,%ebp
+  8029cb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  8029ce:	68 07 06 00 00       	push   $0x607
+  8029d3:	6a 08                	push   $0x8
+  8029d5:	68 00 30 ad de       	push   $0xdead3000
+  8029da:	6a 00                	push   $0x0
+  8029dc:	e8 ff e3 ff ff       	call   800de0 <sys_page_alloc_range>
+  8029e1:	83 c4 10             	add    $0x10,%esp
+  8029e4:	83 f8 08             	cmp    $0x8,%eax
+  8029e7:	74 1b                	je     802a04 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  8029e9:	83 ec 04             	sub    $0x4,%esp
+  8029ec:	6a 08                	push   $0x8
+  8029ee:	68 00 30 ad de       	push   $0xdead3000
+  8029f3:	6a 00                	push   $0x0
+  8029f5:	e8 54 e4 ff ff       	call   800e4e <sys_page_unmap_range>
+		return 0;
+  8029fa:	83 c4 10             	add    $0x10,%esp
+  8029fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a02:	c9                   	leave
+  802a03:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802a04:	83 ec 0c             	sub    $0xc,%esp
+  802a07:	68 07 04 00 00       	push   $0x407
+  802a0c:	6a 08                	push   $0x8
+  802a0e:	68 00 30 ad de       	push   $0xdead3000
+  802a13:	6a 06                	push   $0x6
+  802a15:	ff 35 40 b0 80 00    	push   0x80b040
+  802a1b:	e8 47 25 00 00       	call   804f67 <ipc_call>
+  802a20:	83 c4 20             	add    $0x20,%esp
+  802a23:	85 c0                	test   %eax,%eax
+  802a25:	78 14                	js     802a3b <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802a27:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802a2c:	8b 40 48             	mov    0x48(%eax),%eax
+  802a2f:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  802a34:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a39:	eb c7                	jmp    802a02 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802a3b:	83 ec 04             	sub    $0x4,%esp
+  802a3e:	6a 08                	push   $0x8
+  802a40:	68 00 30 ad de       	push   $0xdead3000
+  802a45:	6a 00                	push   $0x0
+  802a47:	e8 02 e4 ff ff       	call   800e4e <sys_page_unmap_range>
+		return 0;
+  802a4c:	83 c4 10             	add    $0x10,%esp
+  802a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a54:	eb ac                	jmp    802a02 <page_ring_ready+0x59>
+
+00802a56 <page_remove_slot>:
+{
+  802a56:	55                   	push   %ebp
+  802a57:	89 e5                	mov    %esp,%ebp
+  802a59:	56                   	push   %esi
+  802a5a:	53                   	push   %ebx
+  802a5b:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802a5d:	89 c6                	mov    %eax,%esi
+  802a5f:	c1 ee 10             	shr    $0x10,%esi
+  802a62:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802a65:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  802a6c:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  802a72:	74 2a                	je     802a9e <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802a74:	83 ec 0c             	sub    $0xc,%esp
+  802a77:	6a 00                	push   $0x0
+  802a79:	6a 00                	push   $0x0
+  802a7b:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802a7d:	c1 e3 04             	shl    $0x4,%ebx
+  802a80:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802a83:	53                   	push   %ebx
+  802a84:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  802a8b:	e8 d7 24 00 00       	call   804f67 <ipc_call>
+  802a90:	83 c4 20             	add    $0x20,%esp
+  802a93:	85 c0                	test   %eax,%eax
+  802a95:	78 2d                	js     802ac4 <page_remove_slot+0x6e>
+}
+  802a97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a9a:	5b                   	pop    %ebx
+  802a9b:	5e                   	pop    %esi
+  802a9c:	5d                   	pop    %ebp
+  802a9d:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802a9e:	e8 06 ff ff ff       	call   8029a9 <page_ring_ready>
+  802aa3:	85 c0                	test   %eax,%eax
+  802aa5:	74 cd                	je     802a74 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802aa7:	b8 01 00 00 00       	mov    $0x1,%eax
+  802aac:	e8 46 fe ff ff       	call   8028f7 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802ab1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ab6:	89 da                	mov    %ebx,%edx
+  802ab8:	b8 02 00 00 00       	mov    $0x2,%eax
+  802abd:	e8 69 fd ff ff       	call   80282b <page_ring_post>
+		return;
+  802ac2:	eb d3                	jmp    802a97 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802ac4:	50                   	push   %eax
+  802ac5:	68 94 58 80 00       	push   $0x805894
+  802aca:	68 ac 03 00 00       	push   $0x3ac
+  802acf:	68 3a 58 80 00       	push   $0x80583a
+  802ad4:	e8 c2 21 00 00       	call   804c9b <_panic>
+
+00802ad9 <find_paging_env>:
+	if(pagingenv)
+  802ad9:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802ade:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802ae0:	85 c0                	test   %eax,%eax
+  802ae2:	74 05                	je     802ae9 <find_paging_env+0x10>
+  802ae4:	eb 56                	jmp    802b3c <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802ae6:	83 c0 01             	add    $0x1,%eax
+  802ae9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802aee:	7f 47                	jg     802b37 <find_paging_env+0x5e>
+  802af0:	83 f9 01             	cmp    $0x1,%ecx
+  802af3:	7f 42                	jg     802b37 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802af5:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802af8:	c1 e2 06             	shl    $0x6,%edx
+  802afb:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802b01:	8b 52 50             	mov    0x50(%edx),%edx
+  802b04:	83 fa 02             	cmp    $0x2,%edx
+  802b07:	75 dd                	jne    802ae6 <find_paging_env+0xd>
+  802b09:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802b0c:	c1 e2 06             	shl    $0x6,%edx
+  802b0f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802b15:	8b 52 54             	mov    0x54(%edx),%edx
+  802b18:	85 d2                	test   %edx,%edx
+  802b1a:	74 ca                	je     802ae6 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802b1c:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802b1f:	c1 e2 06             	shl    $0x6,%edx
+  802b22:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802b28:	8b 52 48             	mov    0x48(%edx),%edx
+  802b2b:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  802b32:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802b35:	eb af                	jmp    802ae6 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802b37:	83 f9 02             	cmp    $0x2,%ecx
+  802b3a:	74 01                	je     802b3d <find_paging_env+0x64>
+}
+  802b3c:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802b3d:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802b42:	8b 40 48             	mov    0x48(%eax),%eax
+  802b45:	83 e0 01             	and    $0x1,%eax
+  802b48:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  802b4f:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  802b54:	eb e6                	jmp    802b3c <find_paging_env+0x63>
+
+00802b56 <page_add_backed>:
+{
+  802b56:	55                   	push   %ebp
+  802b57:	89 e5                	mov    %esp,%ebp
+  802b59:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802b5c:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  802b61:	83 f8 04             	cmp    $0x4,%eax
+  802b64:	74 35                	je     802b9b <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802b66:	89 d1                	mov    %edx,%ecx
+  802b68:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802b6e:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802b75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b78:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802b7f:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802b85:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  802b8c:	83 c0 01             	add    $0x1,%eax
+  802b8f:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  802b94:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b99:	5d                   	pop    %ebp
+  802b9a:	c3                   	ret
+		return -E_NO_MEM;
+  802b9b:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802ba0:	eb f7                	jmp    802b99 <page_add_backed+0x43>
+
+00802ba2 <percentage_of_pgdir_to_walk>:
+{
+  802ba2:	55                   	push   %ebp
+  802ba3:	89 e5                	mov    %esp,%ebp
+  802ba5:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802ba8:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802bac:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802baf:	db 45 fc             	fildl  -0x4(%ebp)
+  802bb2:	d8 35 20 5d 80 00    	fdivs  0x805d20
+	return ret*ret;
+  802bb8:	d8 c8                	fmul   %st(0),%st
+}
+  802bba:	c9                   	leave
+  802bbb:	c3                   	ret
+
+00802bbc <nfu_with_aging_page_choice_func>:
+{
+  802bbc:	55                   	push   %ebp
+  802bbd:	89 e5                	mov    %esp,%ebp
+  802bbf:	57                   	push   %edi
+  802bc0:	56                   	push   %esi
+  802bc1:	53                   	push   %ebx
+  802bc2:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802bc5:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  802bcb:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802bcd:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802bd2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bd7:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802bde:	ba 00 00 00 00       	mov    $0x0,%edx
+  802be3:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802be6:	eb 18                	jmp    802c00 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802be8:	f7 d0                	not    %eax
+  802bea:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802bef:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802bf1:	83 c2 01             	add    $0x1,%edx
+  802bf4:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802bfa:	0f 87 13 01 00 00    	ja     802d13 <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802c00:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c04:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802c07:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802c0c:	89 c1                	mov    %eax,%ecx
+  802c0e:	c1 e9 0a             	shr    $0xa,%ecx
+  802c11:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802c18:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802c1e:	83 f9 01             	cmp    $0x1,%ecx
+  802c21:	75 c5                	jne    802be8 <nfu_with_aging_page_choice_func+0x2c>
+  802c23:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802c28:	77 be                	ja     802be8 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802c2a:	89 c1                	mov    %eax,%ecx
+  802c2c:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802c2f:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802c35:	0f 82 a5 00 00 00    	jb     802ce0 <nfu_with_aging_page_choice_func+0x124>
+  802c3b:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802c41:	0f 87 99 00 00 00    	ja     802ce0 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802c47:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802c4e:	f6 c1 01             	test   $0x1,%cl
+  802c51:	0f 84 89 00 00 00    	je     802ce0 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802c57:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802c5e:	f6 c5 04             	test   $0x4,%ch
+  802c61:	75 7d                	jne    802ce0 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802c63:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802c6a:	f6 c5 02             	test   $0x2,%ch
+  802c6d:	75 71                	jne    802ce0 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802c6f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802c76:	c1 e9 0c             	shr    $0xc,%ecx
+  802c79:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802c7c:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802c82:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802c86:	66 83 f9 01          	cmp    $0x1,%cx
+  802c8a:	77 54                	ja     802ce0 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802c8c:	89 f9                	mov    %edi,%ecx
+  802c8e:	80 f9 ff             	cmp    $0xff,%cl
+  802c91:	74 21                	je     802cb4 <nfu_with_aging_page_choice_func+0xf8>
+  802c93:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802c9a:	c1 e9 0c             	shr    $0xc,%ecx
+  802c9d:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802ca0:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802ca6:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802caa:	89 fb                	mov    %edi,%ebx
+  802cac:	38 d9                	cmp    %bl,%cl
+  802cae:	73 30                	jae    802ce0 <nfu_with_aging_page_choice_func+0x124>
+  802cb0:	dd d8                	fstp   %st(0)
+  802cb2:	eb 02                	jmp    802cb6 <nfu_with_aging_page_choice_func+0xfa>
+  802cb4:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802cb6:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802cbd:	c1 e9 0c             	shr    $0xc,%ecx
+  802cc0:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802cc3:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802cca:	89 fb                	mov    %edi,%ebx
+  802ccc:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802ccf:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802cd2:	db 45 e0             	fildl  -0x20(%ebp)
+  802cd5:	d8 35 20 5d 80 00    	fdivs  0x805d20
+	return ret*ret;
+  802cdb:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802cdd:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802ce0:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802ce3:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802ce6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802ced:	df 6d e0             	fildll -0x20(%ebp)
+  802cf0:	d9 c1                	fld    %st(1)
+  802cf2:	d8 0d 24 5d 80 00    	fmuls  0x805d24
+  802cf8:	d9 c9                	fxch   %st(1)
+  802cfa:	df f1                	fcomip %st(1),%st
+  802cfc:	dd d8                	fstp   %st(0)
+  802cfe:	0f 82 ed fe ff ff    	jb     802bf1 <nfu_with_aging_page_choice_func+0x35>
+  802d04:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802d06:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  802d0b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d0e:	c1 e0 0c             	shl    $0xc,%eax
+  802d11:	eb 0e                	jmp    802d21 <nfu_with_aging_page_choice_func+0x165>
+  802d13:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802d15:	89 f8                	mov    %edi,%eax
+  802d17:	3c ff                	cmp    $0xff,%al
+  802d19:	74 0e                	je     802d29 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802d1b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d1e:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802d21:	83 c4 14             	add    $0x14,%esp
+  802d24:	5b                   	pop    %ebx
+  802d25:	5e                   	pop    %esi
+  802d26:	5f                   	pop    %edi
+  802d27:	5d                   	pop    %ebp
+  802d28:	c3                   	ret
+	pgnum = 0;
+  802d29:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  802d30:	00 00 00 
+	return (void*)UTOP;
+  802d33:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802d38:	eb e7                	jmp    802d21 <nfu_with_aging_page_choice_func+0x165>
+
+00802d3a <myRand>:
+    state = state * 1664525 + 1013904223;
+  802d3a:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  802d41:	66 19 00 
+  802d44:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802d49:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  802d4e:	c1 e8 18             	shr    $0x18,%eax
+}
+  802d51:	c3                   	ret
+
+00802d52 <random_page_choice_func>:
+{
+  802d52:	55                   	push   %ebp
+  802d53:	89 e5                	mov    %esp,%ebp
+  802d55:	57                   	push   %edi
+  802d56:	56                   	push   %esi
+  802d57:	53                   	push   %ebx
+  802d58:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802d5b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d60:	eb 19                	jmp    802d7b <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802d62:	f7 d3                	not    %ebx
+  802d64:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802d6a:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802d6c:	83 c6 01             	add    $0x1,%esi
+  802d6f:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802d75:	0f 87 a0 00 00 00    	ja     802e1b <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d7b:	89 f3                	mov    %esi,%ebx
+  802d7d:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  802d83:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802d89:	89 d8                	mov    %ebx,%eax
+  802d8b:	c1 e8 0a             	shr    $0xa,%eax
+  802d8e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802d95:	25 81 00 00 00       	and    $0x81,%eax
+  802d9a:	83 f8 01             	cmp    $0x1,%eax
+  802d9d:	75 c3                	jne    802d62 <random_page_choice_func+0x10>
+  802d9f:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802da5:	77 bb                	ja     802d62 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802da7:	89 df                	mov    %ebx,%edi
+  802da9:	c1 e7 0c             	shl    $0xc,%edi
+  802dac:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802daf:	89 f8                	mov    %edi,%eax
+  802db1:	e8 06 f9 ff ff       	call   8026bc <page_is_clean>
+  802db6:	84 c0                	test   %al,%al
+  802db8:	0f 85 82 00 00 00    	jne    802e40 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802dbe:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  802dc4:	72 a6                	jb     802d6c <random_page_choice_func+0x1a>
+  802dc6:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802dcc:	77 9e                	ja     802d6c <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802dce:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802dd5:	a8 01                	test   $0x1,%al
+  802dd7:	74 93                	je     802d6c <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802dd9:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802de0:	f6 c4 04             	test   $0x4,%ah
+  802de3:	75 87                	jne    802d6c <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802de5:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802dec:	f6 c4 02             	test   $0x2,%ah
+  802def:	0f 85 77 ff ff ff    	jne    802d6c <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802df5:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802dfc:	c1 e8 0c             	shr    $0xc,%eax
+  802dff:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802e02:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802e07:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802e0b:	66 83 f8 01          	cmp    $0x1,%ax
+  802e0f:	0f 87 57 ff ff ff    	ja     802d6c <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  802e15:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802e1b:	e8 1a ff ff ff       	call   802d3a <myRand>
+  802e20:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  802e26:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  802e2b:	29 fe                	sub    %edi,%esi
+  802e2d:	0f be c0             	movsbl %al,%eax
+  802e30:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e35:	f7 f6                	div    %esi
+  802e37:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802e39:	bb 15 00 00 00       	mov    $0x15,%ebx
+  802e3e:	eb 1c                	jmp    802e5c <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  802e40:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  802e46:	e9 8f 00 00 00       	jmp    802eda <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802e4b:	e8 ea fe ff ff       	call   802d3a <myRand>
+  802e50:	0f be c0             	movsbl %al,%eax
+  802e53:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e58:	f7 f6                	div    %esi
+  802e5a:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802e5c:	83 eb 01             	sub    $0x1,%ebx
+  802e5f:	0f 84 c2 00 00 00    	je     802f27 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  802e65:	89 d0                	mov    %edx,%eax
+  802e67:	c1 e8 0a             	shr    $0xa,%eax
+  802e6a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802e71:	25 81 00 00 00       	and    $0x81,%eax
+  802e76:	83 f8 01             	cmp    $0x1,%eax
+  802e79:	75 d0                	jne    802e4b <random_page_choice_func+0xf9>
+  802e7b:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  802e81:	77 c8                	ja     802e4b <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  802e83:	89 d0                	mov    %edx,%eax
+  802e85:	c1 e0 0c             	shl    $0xc,%eax
+  802e88:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  802e8d:	72 56                	jb     802ee5 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802e8f:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  802e94:	77 65                	ja     802efb <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802e96:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802e9d:	f6 c1 01             	test   $0x1,%cl
+  802ea0:	74 59                	je     802efb <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802ea2:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802ea9:	f6 c5 04             	test   $0x4,%ch
+  802eac:	75 4d                	jne    802efb <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  802eae:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802eb5:	f6 c5 02             	test   $0x2,%ch
+  802eb8:	75 41                	jne    802efb <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  802eba:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802ec1:	c1 ea 0c             	shr    $0xc,%edx
+  802ec4:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  802ec7:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  802ecd:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  802ed1:	66 83 fa 01          	cmp    $0x1,%dx
+  802ed5:	77 3a                	ja     802f11 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  802ed7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  802eda:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802edd:	83 c4 1c             	add    $0x1c,%esp
+  802ee0:	5b                   	pop    %ebx
+  802ee1:	5e                   	pop    %esi
+  802ee2:	5f                   	pop    %edi
+  802ee3:	5d                   	pop    %ebp
+  802ee4:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802ee5:	e8 50 fe ff ff       	call   802d3a <myRand>
+  802eea:	0f be c0             	movsbl %al,%eax
+  802eed:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ef2:	f7 f6                	div    %esi
+  802ef4:	01 fa                	add    %edi,%edx
+			continue;
+  802ef6:	e9 61 ff ff ff       	jmp    802e5c <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802efb:	e8 3a fe ff ff       	call   802d3a <myRand>
+  802f00:	0f be c0             	movsbl %al,%eax
+  802f03:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f08:	f7 f6                	div    %esi
+  802f0a:	01 fa                	add    %edi,%edx
+			continue;
+  802f0c:	e9 4b ff ff ff       	jmp    802e5c <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802f11:	e8 24 fe ff ff       	call   802d3a <myRand>
+  802f16:	0f be c0             	movsbl %al,%eax
+  802f19:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f1e:	f7 f6                	div    %esi
+  802f20:	01 fa                	add    %edi,%edx
+			continue;
+  802f22:	e9 35 ff ff ff       	jmp    802e5c <random_page_choice_func+0x10a>
+	pgnum = 0;
+  802f27:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  802f2e:	00 00 00 
+	return (void*)UTOP;
+  802f31:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  802f38:	eb a0                	jmp    802eda <random_page_choice_func+0x188>
+
+00802f3a <nfu>:
+{
+  802f3a:	55                   	push   %ebp
+  802f3b:	89 e5                	mov    %esp,%ebp
+  802f3d:	57                   	push   %edi
+  802f3e:	56                   	push   %esi
+  802f3f:	53                   	push   %ebx
+  802f40:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802f43:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  802f49:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802f4b:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802f50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f55:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802f5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f61:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802f64:	eb 18                	jmp    802f7e <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802f66:	f7 d0                	not    %eax
+  802f68:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f6d:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802f6f:	83 c2 01             	add    $0x1,%edx
+  802f72:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802f78:	0f 87 13 01 00 00    	ja     803091 <nfu+0x157>
+		++num_searched_ptes;
+  802f7e:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802f82:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802f85:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802f8a:	89 c1                	mov    %eax,%ecx
+  802f8c:	c1 e9 0a             	shr    $0xa,%ecx
+  802f8f:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802f96:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802f9c:	83 f9 01             	cmp    $0x1,%ecx
+  802f9f:	75 c5                	jne    802f66 <nfu+0x2c>
+  802fa1:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802fa6:	77 be                	ja     802f66 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802fa8:	89 c1                	mov    %eax,%ecx
+  802faa:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802fad:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802fb3:	0f 82 a5 00 00 00    	jb     80305e <nfu+0x124>
+  802fb9:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802fbf:	0f 87 99 00 00 00    	ja     80305e <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802fc5:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802fcc:	f6 c1 01             	test   $0x1,%cl
+  802fcf:	0f 84 89 00 00 00    	je     80305e <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802fd5:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802fdc:	f6 c5 04             	test   $0x4,%ch
+  802fdf:	75 7d                	jne    80305e <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802fe1:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802fe8:	f6 c5 02             	test   $0x2,%ch
+  802feb:	75 71                	jne    80305e <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802fed:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802ff4:	c1 e9 0c             	shr    $0xc,%ecx
+  802ff7:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802ffa:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803000:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803004:	66 83 f9 01          	cmp    $0x1,%cx
+  803008:	77 54                	ja     80305e <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  80300a:	89 f9                	mov    %edi,%ecx
+  80300c:	80 f9 ff             	cmp    $0xff,%cl
+  80300f:	74 21                	je     803032 <nfu+0xf8>
+  803011:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803018:	c1 e9 0c             	shr    $0xc,%ecx
+  80301b:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80301e:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803024:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  803028:	89 fb                	mov    %edi,%ebx
+  80302a:	38 d9                	cmp    %bl,%cl
+  80302c:	73 30                	jae    80305e <nfu+0x124>
+  80302e:	dd d8                	fstp   %st(0)
+  803030:	eb 02                	jmp    803034 <nfu+0xfa>
+  803032:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  803034:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80303b:	c1 e9 0c             	shr    $0xc,%ecx
+  80303e:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803041:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  803048:	89 fb                	mov    %edi,%ebx
+  80304a:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  80304d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803050:	db 45 e0             	fildl  -0x20(%ebp)
+  803053:	d8 35 20 5d 80 00    	fdivs  0x805d20
+	return ret*ret;
+  803059:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80305b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  80305e:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  803061:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803064:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80306b:	df 6d e0             	fildll -0x20(%ebp)
+  80306e:	d9 c1                	fld    %st(1)
+  803070:	d8 0d 24 5d 80 00    	fmuls  0x805d24
+  803076:	d9 c9                	fxch   %st(1)
+  803078:	df f1                	fcomip %st(1),%st
+  80307a:	dd d8                	fstp   %st(0)
+  80307c:	0f 82 ed fe ff ff    	jb     802f6f <nfu+0x35>
+  803082:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  803084:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  803089:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80308c:	c1 e0 0c             	shl    $0xc,%eax
+  80308f:	eb 0e                	jmp    80309f <nfu+0x165>
+  803091:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  803093:	89 f8                	mov    %edi,%eax
+  803095:	3c ff                	cmp    $0xff,%al
+  803097:	74 0e                	je     8030a7 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  803099:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80309c:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80309f:	83 c4 14             	add    $0x14,%esp
+  8030a2:	5b                   	pop    %ebx
+  8030a3:	5e                   	pop    %esi
+  8030a4:	5f                   	pop    %edi
+  8030a5:	5d                   	pop    %ebp
+  8030a6:	c3                   	ret
+	pgnum = 0;
+  8030a7:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  8030ae:	00 00 00 
+	return (void*)UTOP;
+  8030b1:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8030b6:	eb e7                	jmp    80309f <nfu+0x165>
+
+008030b8 <lru>:
+{
+  8030b8:	55                   	push   %ebp
+  8030b9:	89 e5                	mov    %esp,%ebp
+  8030bb:	57                   	push   %edi
+  8030bc:	56                   	push   %esi
+  8030bd:	53                   	push   %ebx
+  8030be:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8030c1:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  8030c7:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  8030ce:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8030d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8030da:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8030e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030e6:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  8030e9:	eb 18                	jmp    803103 <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8030eb:	f7 d0                	not    %eax
+  8030ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030f2:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8030f4:	83 c2 01             	add    $0x1,%edx
+  8030f7:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  8030fd:	0f 87 fa 00 00 00    	ja     8031fd <lru+0x145>
+		++num_searched_ptes;
+  803103:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803106:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803109:	01 d0                	add    %edx,%eax
+  80310b:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803110:	89 c1                	mov    %eax,%ecx
+  803112:	c1 e9 0a             	shr    $0xa,%ecx
+  803115:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80311c:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803122:	83 f9 01             	cmp    $0x1,%ecx
+  803125:	75 c4                	jne    8030eb <lru+0x33>
+  803127:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  80312c:	77 bd                	ja     8030eb <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  80312e:	89 c1                	mov    %eax,%ecx
+  803130:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803133:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803139:	0f 87 92 00 00 00    	ja     8031d1 <lru+0x119>
+  80313f:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  803145:	0f 82 86 00 00 00    	jb     8031d1 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80314b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803152:	f6 c1 01             	test   $0x1,%cl
+  803155:	74 7a                	je     8031d1 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803157:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80315e:	f6 c5 04             	test   $0x4,%ch
+  803161:	75 6e                	jne    8031d1 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803163:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80316a:	f6 c5 02             	test   $0x2,%ch
+  80316d:	75 62                	jne    8031d1 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80316f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803176:	c1 e9 0c             	shr    $0xc,%ecx
+  803179:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80317c:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803182:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803186:	66 83 f9 01          	cmp    $0x1,%cx
+  80318a:	77 45                	ja     8031d1 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  80318c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803193:	c1 e9 0c             	shr    $0xc,%ecx
+  803196:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803199:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80319f:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8031a2:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8031a5:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  8031a8:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8031ab:	19 df                	sbb    %ebx,%edi
+  8031ad:	7c 22                	jl     8031d1 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  8031af:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8031b6:	c1 e9 0c             	shr    $0xc,%ecx
+  8031b9:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8031bc:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8031c2:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8031c5:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8031c8:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8031cb:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8031ce:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8031d1:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8031d4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8031db:	df 6d e0             	fildll -0x20(%ebp)
+  8031de:	d9 05 24 5d 80 00    	flds   0x805d24
+  8031e4:	d9 c9                	fxch   %st(1)
+  8031e6:	df f1                	fcomip %st(1),%st
+  8031e8:	dd d8                	fstp   %st(0)
+  8031ea:	0f 82 04 ff ff ff    	jb     8030f4 <lru+0x3c>
+			pgnum = pgnum_actual;
+  8031f0:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  8031f5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8031f8:	c1 e0 0c             	shl    $0xc,%eax
+  8031fb:	eb 06                	jmp    803203 <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  8031fd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803200:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803203:	83 c4 1c             	add    $0x1c,%esp
+  803206:	5b                   	pop    %ebx
+  803207:	5e                   	pop    %esi
+  803208:	5f                   	pop    %edi
+  803209:	5d                   	pop    %ebp
+  80320a:	c3                   	ret
+
+0080320b <set_page_choice_func>:
+{
+  80320b:	55                   	push   %ebp
+  80320c:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  80320e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803211:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  803216:	5d                   	pop    %ebp
+  803217:	c3                   	ret
+
+00803218 <get_page_choice>:
+{
+  803218:	55                   	push   %ebp
+  803219:	89 e5                	mov    %esp,%ebp
+  80321b:	57                   	push   %edi
+  80321c:	56                   	push   %esi
+  80321d:	53                   	push   %ebx
+  80321e:	83 ec 24             	sub    $0x24,%esp
+  803221:	8b 75 08             	mov    0x8(%ebp),%esi
+  803224:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  803227:	57                   	push   %edi
+  803228:	56                   	push   %esi
+  803229:	ff 15 3c 60 80 00    	call   *0x80603c
+  80322f:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803231:	83 c4 10             	add    $0x10,%esp
+  803234:	eb 25                	jmp    80325b <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  803236:	83 ec 08             	sub    $0x8,%esp
+  803239:	c1 e0 16             	shl    $0x16,%eax
+  80323c:	50                   	push   %eax
+  80323d:	6a 00                	push   $0x0
+  80323f:	e8 38 db ff ff       	call   800d7c <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803244:	83 c4 10             	add    $0x10,%esp
+  803247:	85 c0                	test   %eax,%eax
+  803249:	75 43                	jne    80328e <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  80324b:	83 ec 08             	sub    $0x8,%esp
+  80324e:	57                   	push   %edi
+  80324f:	56                   	push   %esi
+  803250:	ff 15 3c 60 80 00    	call   *0x80603c
+  803256:	89 c3                	mov    %eax,%ebx
+  803258:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80325b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80325e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803264:	0f 86 ae 00 00 00    	jbe    803318 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80326a:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  80326f:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803276:	81 e2 81 00 00 00    	and    $0x81,%edx
+  80327c:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  803282:	74 b2                	je     803236 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803284:	83 c0 01             	add    $0x1,%eax
+  803287:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  80328c:	75 e1                	jne    80326f <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  80328e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803291:	05 00 10 40 11       	add    $0x11401000,%eax
+  803296:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80329b:	76 1f                	jbe    8032bc <get_page_choice+0xa4>
+		return (void *) UTOP;
+  80329d:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  8032a2:	89 d8                	mov    %ebx,%eax
+  8032a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032a7:	5b                   	pop    %ebx
+  8032a8:	5e                   	pop    %esi
+  8032a9:	5f                   	pop    %edi
+  8032aa:	5d                   	pop    %ebp
+  8032ab:	c3                   	ret
+		sys_page_split(0, pg_out);
+  8032ac:	83 ec 08             	sub    $0x8,%esp
+  8032af:	53                   	push   %ebx
+  8032b0:	6a 00                	push   $0x0
+  8032b2:	e8 c5 da ff ff       	call   800d7c <sys_page_split>
+  8032b7:	83 c4 10             	add    $0x10,%esp
+  8032ba:	eb 6c                	jmp    803328 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  8032bc:	83 ec 04             	sub    $0x4,%esp
+  8032bf:	68 cc 58 80 00       	push   $0x8058cc
+  8032c4:	68 cc 01 00 00       	push   $0x1cc
+  8032c9:	68 3a 58 80 00       	push   $0x80583a
+  8032ce:	e8 c8 19 00 00       	call   804c9b <_panic>
+		panic("We tried to page out code pages\n");
+  8032d3:	83 ec 04             	sub    $0x4,%esp
+  8032d6:	68 fc 58 80 00       	push   $0x8058fc
+  8032db:	68 d6 01 00 00       	push   $0x1d6
+  8032e0:	68 3a 58 80 00       	push   $0x80583a
+  8032e5:	e8 b1 19 00 00       	call   804c9b <_panic>
+		panic("Invalid mapping for the va\n");
+  8032ea:	83 ec 04             	sub    $0x4,%esp
+  8032ed:	68 47 58 80 00       	push   $0x805847
+  8032f2:	68 da 01 00 00       	push   $0x1da
+  8032f7:	68 3a 58 80 00       	push   $0x80583a
+  8032fc:	e8 9a 19 00 00       	call   804c9b <_panic>
+		panic("We tried to page out a shared page\n");
+  803301:	83 ec 04             	sub    $0x4,%esp
+  803304:	68 20 59 80 00       	push   $0x805920
+  803309:	68 e0 01 00 00       	push   $0x1e0
+  80330e:	68 3a 58 80 00       	push   $0x80583a
+  803313:	e8 83 19 00 00       	call   804c9b <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  803318:	89 de                	mov    %ebx,%esi
+  80331a:	c1 ee 16             	shr    $0x16,%esi
+  80331d:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803324:	a8 80                	test   $0x80,%al
+  803326:	75 84                	jne    8032ac <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803328:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80332b:	05 00 10 40 11       	add    $0x11401000,%eax
+  803330:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803335:	76 85                	jbe    8032bc <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  803337:	89 d8                	mov    %ebx,%eax
+  803339:	e8 7e f3 ff ff       	call   8026bc <page_is_clean>
+  80333e:	84 c0                	test   %al,%al
+  803340:	0f 85 5c ff ff ff    	jne    8032a2 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  803346:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  80334d:	76 84                	jbe    8032d3 <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  80334f:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803356:	a8 01                	test   $0x1,%al
+  803358:	74 90                	je     8032ea <get_page_choice+0xd2>
+  80335a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80335d:	c1 e8 0c             	shr    $0xc,%eax
+  803360:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803367:	f6 c2 01             	test   $0x1,%dl
+  80336a:	0f 84 7a ff ff ff    	je     8032ea <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803370:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  803377:	f6 c2 01             	test   $0x1,%dl
+  80337a:	74 85                	je     803301 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  80337c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803383:	f6 c2 01             	test   $0x1,%dl
+  803386:	0f 84 75 ff ff ff    	je     803301 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  80338c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803393:	f6 c6 04             	test   $0x4,%dh
+  803396:	0f 85 65 ff ff ff    	jne    803301 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  80339c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8033a3:	f6 c6 02             	test   $0x2,%dh
+  8033a6:	0f 85 55 ff ff ff    	jne    803301 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  8033ac:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8033b3:	c1 e8 0c             	shr    $0xc,%eax
+  8033b6:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8033b9:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8033be:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8033c2:	66 83 f8 01          	cmp    $0x1,%ax
+  8033c6:	0f 86 d6 fe ff ff    	jbe    8032a2 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  8033cc:	83 ec 04             	sub    $0x4,%esp
+  8033cf:	68 44 59 80 00       	push   $0x805944
+  8033d4:	68 e2 01 00 00       	push   $0x1e2
+  8033d9:	68 3a 58 80 00       	push   $0x80583a
+  8033de:	e8 b8 18 00 00       	call   804c9b <_panic>
+
+008033e3 <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  8033e3:	55                   	push   %ebp
+  8033e4:	89 e5                	mov    %esp,%ebp
+  8033e6:	57                   	push   %edi
+  8033e7:	56                   	push   %esi
+  8033e8:	53                   	push   %ebx
+  8033e9:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  8033ec:	e8 e8 f6 ff ff       	call   802ad9 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  8033f1:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  8033f6:	85 c0                	test   %eax,%eax
+  8033f8:	74 41                	je     80343b <page_share_paged_out+0x58>
+  8033fa:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803401:	0f 84 fd 00 00 00    	je     803504 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  803407:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  80340e:	00 00 00 
+  803411:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  803418:	00 00 00 
+  80341b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803420:	eb 2c                	jmp    80344e <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803422:	83 c3 04             	add    $0x4,%ebx
+  803425:	39 f3                	cmp    %esi,%ebx
+  803427:	74 1a                	je     803443 <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  803429:	8b 03                	mov    (%ebx),%eax
+  80342b:	a8 01                	test   $0x1,%al
+  80342d:	74 f3                	je     803422 <page_share_paged_out+0x3f>
+  80342f:	c1 e8 0c             	shr    $0xc,%eax
+  803432:	e8 2b f5 ff ff       	call   802962 <page_share_slot>
+  803437:	85 c0                	test   %eax,%eax
+  803439:	79 e7                	jns    803422 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  80343b:	83 c4 0c             	add    $0xc,%esp
+  80343e:	5b                   	pop    %ebx
+  80343f:	5e                   	pop    %esi
+  803440:	5f                   	pop    %edi
+  803441:	5d                   	pop    %ebp
+  803442:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  803443:	83 c7 04             	add    $0x4,%edi
+  803446:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  80344c:	74 1b                	je     803469 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  80344e:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803453:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  803456:	f6 c3 01             	test   $0x1,%bl
+  803459:	74 e8                	je     803443 <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  80345b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803461:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  803467:	eb bc                	jmp    803425 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803469:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80346e:	eb 11                	jmp    803481 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  803470:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803476:	83 c3 01             	add    $0x1,%ebx
+  803479:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80347f:	77 41                	ja     8034c2 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  803481:	89 d8                	mov    %ebx,%eax
+  803483:	c1 e8 0a             	shr    $0xa,%eax
+  803486:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80348d:	25 81 00 00 00       	and    $0x81,%eax
+  803492:	83 f8 01             	cmp    $0x1,%eax
+  803495:	75 d9                	jne    803470 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803497:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80349e:	25 81 00 00 00       	and    $0x81,%eax
+  8034a3:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8034a8:	75 cc                	jne    803476 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  8034aa:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8034b1:	c1 e8 0c             	shr    $0xc,%eax
+  8034b4:	e8 a9 f4 ff ff       	call   802962 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  8034b9:	85 c0                	test   %eax,%eax
+  8034bb:	79 b9                	jns    803476 <page_share_paged_out+0x93>
+  8034bd:	e9 79 ff ff ff       	jmp    80343b <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8034c2:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8034c9:	75 13                	jne    8034de <page_share_paged_out+0xfb>
+  8034cb:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8034d2:	75 1d                	jne    8034f1 <page_share_paged_out+0x10e>
+	return 0;
+  8034d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d9:	e9 5d ff ff ff       	jmp    80343b <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8034de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034e3:	e8 46 f4 ff ff       	call   80292e <page_share_send>
+  8034e8:	85 c0                	test   %eax,%eax
+  8034ea:	79 df                	jns    8034cb <page_share_paged_out+0xe8>
+  8034ec:	e9 4a ff ff ff       	jmp    80343b <page_share_paged_out+0x58>
+  8034f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034f6:	e8 33 f4 ff ff       	call   80292e <page_share_send>
+  8034fb:	85 c0                	test   %eax,%eax
+  8034fd:	79 d5                	jns    8034d4 <page_share_paged_out+0xf1>
+  8034ff:	e9 37 ff ff ff       	jmp    80343b <page_share_paged_out+0x58>
+		return 0;
+  803504:	b8 00 00 00 00       	mov    $0x0,%eax
+  803509:	e9 2d ff ff ff       	jmp    80343b <page_share_paged_out+0x58>
+
+0080350e <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  80350e:	55                   	push   %ebp
+  80350f:	89 e5                	mov    %esp,%ebp
+  803511:	56                   	push   %esi
+  803512:	53                   	push   %ebx
+  803513:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  803516:	e8 be f5 ff ff       	call   802ad9 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  80351b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  803520:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803527:	0f 84 82 00 00 00    	je     8035af <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  80352d:	83 ec 0c             	sub    $0xc,%esp
+  803530:	68 00 10 00 00       	push   $0x1000
+  803535:	e8 84 11 00 00       	call   8046be <malloc>
+  80353a:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  80353c:	83 c4 0c             	add    $0xc,%esp
+  80353f:	6a 14                	push   $0x14
+  803541:	6a 00                	push   $0x0
+  803543:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803546:	50                   	push   %eax
+  803547:	e8 c7 d3 ff ff       	call   800913 <memset>
+  80354c:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  80354f:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  803554:	83 ec 0c             	sub    $0xc,%esp
+  803557:	6a 07                	push   $0x7
+  803559:	6a 01                	push   $0x1
+  80355b:	53                   	push   %ebx
+  80355c:	6a 03                	push   $0x3
+  80355e:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803565:	e8 fd 19 00 00       	call   804f67 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  80356a:	8b 03                	mov    (%ebx),%eax
+  80356c:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  80356f:	8b 43 04             	mov    0x4(%ebx),%eax
+  803572:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  803575:	8b 43 08             	mov    0x8(%ebx),%eax
+  803578:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  80357b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80357e:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  803581:	8b 43 10             	mov    0x10(%ebx),%eax
+  803584:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803587:	83 c6 01             	add    $0x1,%esi
+  80358a:	83 c4 20             	add    $0x20,%esp
+  80358d:	83 fe 02             	cmp    $0x2,%esi
+  803590:	75 c2                	jne    803554 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  803592:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803595:	89 03                	mov    %eax,(%ebx)
+  803597:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80359a:	89 43 04             	mov    %eax,0x4(%ebx)
+  80359d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8035a0:	89 43 08             	mov    %eax,0x8(%ebx)
+  8035a3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8035a6:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8035a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035ac:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  8035af:	89 d8                	mov    %ebx,%eax
+  8035b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035b4:	5b                   	pop    %ebx
+  8035b5:	5e                   	pop    %esi
+  8035b6:	5d                   	pop    %ebp
+  8035b7:	c3                   	ret
+
+008035b8 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  8035b8:	55                   	push   %ebp
+  8035b9:	89 e5                	mov    %esp,%ebp
+  8035bb:	53                   	push   %ebx
+  8035bc:	83 ec 10             	sub    $0x10,%esp
+  8035bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  8035c2:	68 cf 52 80 00       	push   $0x8052cf
+  8035c7:	e8 0f cc ff ff       	call   8001db <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  8035cc:	83 c4 08             	add    $0x8,%esp
+  8035cf:	ff 33                	push   (%ebx)
+  8035d1:	68 78 59 80 00       	push   $0x805978
+  8035d6:	e8 00 cc ff ff       	call   8001db <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  8035db:	83 c4 08             	add    $0x8,%esp
+  8035de:	ff 73 04             	push   0x4(%ebx)
+  8035e1:	68 63 58 80 00       	push   $0x805863
+  8035e6:	e8 f0 cb ff ff       	call   8001db <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  8035eb:	83 c4 08             	add    $0x8,%esp
+  8035ee:	ff 73 08             	push   0x8(%ebx)
+  8035f1:	68 98 59 80 00       	push   $0x805998
+  8035f6:	e8 e0 cb ff ff       	call   8001db <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  8035fb:	83 c4 08             	add    $0x8,%esp
+  8035fe:	ff 73 0c             	push   0xc(%ebx)
+  803601:	68 bc 59 80 00       	push   $0x8059bc
+  803606:	e8 d0 cb ff ff       	call   8001db <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  80360b:	83 c4 08             	add    $0x8,%esp
+  80360e:	ff 73 10             	push   0x10(%ebx)
+  803611:	68 e0 59 80 00       	push   $0x8059e0
+  803616:	e8 c0 cb ff ff       	call   8001db <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  80361b:	83 c4 08             	add    $0x8,%esp
+  80361e:	ff 35 08 b0 80 00    	push   0x80b008
+  803624:	68 1c 5a 80 00       	push   $0x805a1c
+  803629:	e8 ad cb ff ff       	call   8001db <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  80362e:	83 c4 08             	add    $0x8,%esp
+  803631:	ff 35 04 b0 80 00    	push   0x80b004
+  803637:	68 50 5a 80 00       	push   $0x805a50
+  80363c:	e8 9a cb ff ff       	call   8001db <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  803641:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803646:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  803649:	8b 50 68             	mov    0x68(%eax),%edx
+  80364c:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  80364f:	51                   	push   %ecx
+  803650:	52                   	push   %edx
+  803651:	50                   	push   %eax
+  803652:	68 90 5a 80 00       	push   $0x805a90
+  803657:	e8 7f cb ff ff       	call   8001db <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  80365c:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803661:	8b 40 70             	mov    0x70(%eax),%eax
+  803664:	83 c4 18             	add    $0x18,%esp
+  803667:	50                   	push   %eax
+  803668:	68 c4 5a 80 00       	push   $0x805ac4
+  80366d:	e8 69 cb ff ff       	call   8001db <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  803672:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  803678:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  80367e:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  803683:	51                   	push   %ecx
+  803684:	52                   	push   %edx
+  803685:	50                   	push   %eax
+  803686:	68 f4 5a 80 00       	push   $0x805af4
+  80368b:	e8 4b cb ff ff       	call   8001db <cprintf>
+	cprintf("\n");
+  803690:	83 c4 14             	add    $0x14,%esp
+  803693:	68 cf 52 80 00       	push   $0x8052cf
+  803698:	e8 3e cb ff ff       	call   8001db <cprintf>
+}
+  80369d:	83 c4 10             	add    $0x10,%esp
+  8036a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036a3:	c9                   	leave
+  8036a4:	c3                   	ret
+
+008036a5 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  8036a5:	55                   	push   %ebp
+  8036a6:	89 e5                	mov    %esp,%ebp
+  8036a8:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  8036ab:	e8 5e fe ff ff       	call   80350e <get_paging_stats>
+  8036b0:	83 ec 0c             	sub    $0xc,%esp
+  8036b3:	50                   	push   %eax
+  8036b4:	e8 ff fe ff ff       	call   8035b8 <print_paging_stats>
+}
+  8036b9:	83 c4 10             	add    $0x10,%esp
+  8036bc:	c9                   	leave
+  8036bd:	c3                   	ret
+
+008036be <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  8036be:	55                   	push   %ebp
+  8036bf:	89 e5                	mov    %esp,%ebp
+  8036c1:	53                   	push   %ebx
+  8036c2:	83 ec 04             	sub    $0x4,%esp
+  8036c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  8036c8:	eb 13                	jmp    8036dd <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  8036ca:	83 ec 04             	sub    $0x4,%esp
+  8036cd:	6a ff                	push   $0xffffffff
+  8036cf:	53                   	push   %ebx
+  8036d0:	68 00 f0 ff ee       	push   $0xeefff000
+  8036d5:	e8 b4 da ff ff       	call   80118e <sys_futex_wait>
+  8036da:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  8036dd:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  8036e2:	39 d8                	cmp    %ebx,%eax
+  8036e4:	74 e4                	je     8036ca <mem_pressure_wait+0xc>
+	return now;
+}
+  8036e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036e9:	c9                   	leave
+  8036ea:	c3                   	ret
+
+008036eb <init_map_dir>:
+
+void
+init_map_dir()
+{
+  8036eb:	55                   	push   %ebp
+  8036ec:	89 e5                	mov    %esp,%ebp
+  8036ee:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  8036f1:	68 5d 43 80 00       	push   $0x80435d
+  8036f6:	e8 78 16 00 00       	call   804d73 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  8036fb:	c7 05 14 e9 80 00 00 	movl   $0xdeadb000,0x80e914
+  803702:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  803705:	83 c4 0c             	add    $0xc,%esp
+  803708:	68 07 02 00 00       	push   $0x207
+  80370d:	68 00 b0 ad de       	push   $0xdeadb000
+  803712:	6a 00                	push   $0x0
+  803714:	e8 9c d5 ff ff       	call   800cb5 <sys_page_alloc>
+  803719:	83 c4 10             	add    $0x10,%esp
+  80371c:	85 c0                	test   %eax,%eax
+  80371e:	78 0c                	js     80372c <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  803720:	e8 b4 f3 ff ff       	call   802ad9 <find_paging_env>
+	page_ring_ready();
+  803725:	e8 7f f2 ff ff       	call   8029a9 <page_ring_ready>
+}
+  80372a:	c9                   	leave
+  80372b:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  80372c:	50                   	push   %eax
+  80372d:	68 81 58 80 00       	push   $0x805881
+  803732:	68 13 05 00 00       	push   $0x513
+  803737:	68 3a 58 80 00       	push   $0x80583a
+  80373c:	e8 5a 15 00 00       	call   804c9b <_panic>
+
+00803741 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  803741:	55                   	push   %ebp
+  803742:	89 e5                	mov    %esp,%ebp
+  803744:	57                   	push   %edi
+  803745:	56                   	push   %esi
+  803746:	53                   	push   %ebx
+  803747:	83 ec 0c             	sub    $0xc,%esp
+  80374a:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  80374d:	89 fa                	mov    %edi,%edx
+  80374f:	c1 ea 16             	shr    $0x16,%edx
+  803752:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803757:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  80375a:	f6 06 01             	testb  $0x1,(%esi)
+  80375d:	75 3e                	jne    80379d <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  80375f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  803764:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803768:	74 47                	je     8037b1 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  80376a:	83 ec 0c             	sub    $0xc,%esp
+  80376d:	6a 01                	push   $0x1
+  80376f:	e8 f2 11 00 00       	call   804966 <va_alloc>
+  803774:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  803776:	83 c4 10             	add    $0x10,%esp
+  803779:	85 c0                	test   %eax,%eax
+  80377b:	74 34                	je     8037b1 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  80377d:	6a 00                	push   $0x0
+  80377f:	68 07 02 00 00       	push   $0x207
+  803784:	50                   	push   %eax
+  803785:	6a 00                	push   $0x0
+  803787:	e8 df 02 00 00       	call   803a6b <page_alloc>
+  80378c:	83 c4 10             	add    $0x10,%esp
+  80378f:	85 c0                	test   %eax,%eax
+  803791:	78 28                	js     8037bb <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  803793:	f6 06 01             	testb  $0x1,(%esi)
+  803796:	75 38                	jne    8037d0 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803798:	83 cb 01             	or     $0x1,%ebx
+  80379b:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  80379d:	89 f8                	mov    %edi,%eax
+  80379f:	c1 e8 0a             	shr    $0xa,%eax
+  8037a2:	25 fc 0f 00 00       	and    $0xffc,%eax
+  8037a7:	8b 1e                	mov    (%esi),%ebx
+  8037a9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8037af:	01 c3                	add    %eax,%ebx
+}
+  8037b1:	89 d8                	mov    %ebx,%eax
+  8037b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037b6:	5b                   	pop    %ebx
+  8037b7:	5e                   	pop    %esi
+  8037b8:	5f                   	pop    %edi
+  8037b9:	5d                   	pop    %ebp
+  8037ba:	c3                   	ret
+			va_free(page, 1);
+  8037bb:	83 ec 08             	sub    $0x8,%esp
+  8037be:	6a 01                	push   $0x1
+  8037c0:	53                   	push   %ebx
+  8037c1:	e8 d8 12 00 00       	call   804a9e <va_free>
+			return NULL;
+  8037c6:	83 c4 10             	add    $0x10,%esp
+  8037c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037ce:	eb e1                	jmp    8037b1 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  8037d0:	83 ec 08             	sub    $0x8,%esp
+  8037d3:	53                   	push   %ebx
+  8037d4:	6a 00                	push   $0x0
+  8037d6:	e8 5f d5 ff ff       	call   800d3a <sys_page_unmap>
+			va_free(page, 1);
+  8037db:	83 c4 08             	add    $0x8,%esp
+  8037de:	6a 01                	push   $0x1
+  8037e0:	53                   	push   %ebx
+  8037e1:	e8 b8 12 00 00       	call   804a9e <va_free>
+  8037e6:	83 c4 10             	add    $0x10,%esp
+  8037e9:	eb b2                	jmp    80379d <umapdir_walk+0x5c>
+
+008037eb <page_out>:
+{
+  8037eb:	55                   	push   %ebp
+  8037ec:	89 e5                	mov    %esp,%ebp
+  8037ee:	57                   	push   %edi
+  8037ef:	56                   	push   %esi
+  8037f0:	53                   	push   %ebx
+  8037f1:	83 ec 5c             	sub    $0x5c,%esp
+  8037f4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  8037f7:	e8 dd f2 ff ff       	call   802ad9 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  8037fc:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803801:	85 c0                	test   %eax,%eax
+  803803:	74 1e                	je     803823 <page_out+0x38>
+  803805:	83 ec 0c             	sub    $0xc,%esp
+  803808:	6a 00                	push   $0x0
+  80380a:	6a 00                	push   $0x0
+  80380c:	6a 00                	push   $0x0
+  80380e:	6a 08                	push   $0x8
+  803810:	50                   	push   %eax
+  803811:	e8 51 17 00 00       	call   804f67 <ipc_call>
+  803816:	89 c3                	mov    %eax,%ebx
+  803818:	83 c4 20             	add    $0x20,%esp
+  80381b:	85 c0                	test   %eax,%eax
+  80381d:	0f 84 ac 00 00 00    	je     8038cf <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  803823:	83 ec 08             	sub    $0x8,%esp
+  803826:	ff 75 0c             	push   0xc(%ebp)
+  803829:	57                   	push   %edi
+  80382a:	e8 e9 f9 ff ff       	call   803218 <get_page_choice>
+  80382f:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  803831:	83 c4 10             	add    $0x10,%esp
+  803834:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803839:	0f 84 18 02 00 00    	je     803a57 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  80383f:	e8 78 ee ff ff       	call   8026bc <page_is_clean>
+  803844:	84 c0                	test   %al,%al
+  803846:	0f 85 8c 00 00 00    	jne    8038d8 <page_out+0xed>
+	if (pagingenv == 0)
+  80384c:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803853:	0f 84 08 02 00 00    	je     803a61 <page_out+0x276>
+	if (page_ring_ready())
+  803859:	e8 4b f1 ff ff       	call   8029a9 <page_ring_ready>
+  80385e:	89 c3                	mov    %eax,%ebx
+  803860:	85 c0                	test   %eax,%eax
+  803862:	0f 85 89 00 00 00    	jne    8038f1 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  803868:	83 ec 0c             	sub    $0xc,%esp
+  80386b:	6a 05                	push   $0x5
+  80386d:	6a 01                	push   $0x1
+  80386f:	56                   	push   %esi
+  803870:	6a 01                	push   $0x1
+  803872:	ff 35 40 b0 80 00    	push   0x80b040
+  803878:	e8 ea 16 00 00       	call   804f67 <ipc_call>
+  80387d:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  80387f:	83 c4 20             	add    $0x20,%esp
+  803882:	85 c0                	test   %eax,%eax
+  803884:	0f 88 b8 01 00 00    	js     803a42 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  80388a:	89 f0                	mov    %esi,%eax
+  80388c:	c1 e8 0c             	shr    $0xc,%eax
+  80388f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803896:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803899:	83 ec 08             	sub    $0x8,%esp
+  80389c:	56                   	push   %esi
+  80389d:	6a 00                	push   $0x0
+  80389f:	e8 96 d4 ff ff       	call   800d3a <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  8038a4:	83 c4 08             	add    $0x8,%esp
+  8038a7:	6a 01                	push   $0x1
+  8038a9:	56                   	push   %esi
+  8038aa:	e8 92 fe ff ff       	call   803741 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  8038af:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  8038b2:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  8038b8:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  8038bb:	09 fe                	or     %edi,%esi
+  8038bd:	83 ce 01             	or     $0x1,%esi
+  8038c0:	89 30                	mov    %esi,(%eax)
+	return 0;
+  8038c2:	83 c4 10             	add    $0x10,%esp
+}
+  8038c5:	89 d8                	mov    %ebx,%eax
+  8038c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038ca:	5b                   	pop    %ebx
+  8038cb:	5e                   	pop    %esi
+  8038cc:	5f                   	pop    %edi
+  8038cd:	5d                   	pop    %ebp
+  8038ce:	c3                   	ret
+		num_page_reclaims++;
+  8038cf:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  8038d6:	eb ed                	jmp    8038c5 <page_out+0xda>
+		num_page_drops++;
+  8038d8:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  8038df:	83 ec 08             	sub    $0x8,%esp
+  8038e2:	56                   	push   %esi
+  8038e3:	6a 00                	push   $0x0
+  8038e5:	e8 50 d4 ff ff       	call   800d3a <sys_page_unmap>
+  8038ea:	89 c3                	mov    %eax,%ebx
+  8038ec:	83 c4 10             	add    $0x10,%esp
+  8038ef:	eb d4                	jmp    8038c5 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8038f1:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  8038f3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8038f8:	2d 00 10 00 00       	sub    $0x1000,%eax
+  8038fd:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803900:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803902:	83 c0 08             	add    $0x8,%eax
+  803905:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803908:	b8 07 00 00 00       	mov    $0x7,%eax
+  80390d:	e8 e5 ef ff ff       	call   8028f7 <page_ring_reserve>
+	first = ring->sq_tail;
+  803912:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803917:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  80391a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  80391f:	83 ec 04             	sub    $0x4,%esp
+  803922:	68 00 10 00 00       	push   $0x1000
+  803927:	56                   	push   %esi
+  803928:	89 d8                	mov    %ebx,%eax
+  80392a:	c1 e0 0c             	shl    $0xc,%eax
+  80392d:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803932:	50                   	push   %eax
+  803933:	e8 72 d0 ff ff       	call   8009aa <memcpy>
+		vas[n] = va;
+  803938:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  80393c:	89 d9                	mov    %ebx,%ecx
+  80393e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803943:	b8 01 00 00 00       	mov    $0x1,%eax
+  803948:	e8 de ee ff ff       	call   80282b <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  80394d:	8d 43 01             	lea    0x1(%ebx),%eax
+  803950:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803953:	83 c4 10             	add    $0x10,%esp
+  803956:	83 fb 06             	cmp    $0x6,%ebx
+  803959:	74 62                	je     8039bd <page_out+0x1d2>
+  80395b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80395e:	eb 15                	jmp    803975 <page_out+0x18a>
+			num_page_drops++;
+  803960:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  803967:	83 ec 08             	sub    $0x8,%esp
+  80396a:	56                   	push   %esi
+  80396b:	6a 00                	push   $0x0
+  80396d:	e8 c8 d3 ff ff       	call   800d3a <sys_page_unmap>
+  803972:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803975:	83 ec 08             	sub    $0x8,%esp
+  803978:	53                   	push   %ebx
+  803979:	57                   	push   %edi
+  80397a:	e8 99 f8 ff ff       	call   803218 <get_page_choice>
+  80397f:	89 c6                	mov    %eax,%esi
+  803981:	83 c4 10             	add    $0x10,%esp
+  803984:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803989:	74 32                	je     8039bd <page_out+0x1d2>
+  80398b:	e8 2c ed ff ff       	call   8026bc <page_is_clean>
+  803990:	84 c0                	test   %al,%al
+  803992:	75 cc                	jne    803960 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803994:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803997:	39 c6                	cmp    %eax,%esi
+  803999:	72 07                	jb     8039a2 <page_out+0x1b7>
+  80399b:	8b 45 98             	mov    -0x68(%ebp),%eax
+  80399e:	39 c6                	cmp    %eax,%esi
+  8039a0:	72 1b                	jb     8039bd <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  8039a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039a7:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  8039aa:	eb 03                	jmp    8039af <page_out+0x1c4>
+  8039ac:	83 c3 01             	add    $0x1,%ebx
+  8039af:	39 da                	cmp    %ebx,%edx
+  8039b1:	0f 84 68 ff ff ff    	je     80391f <page_out+0x134>
+  8039b7:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  8039bb:	75 ef                	jne    8039ac <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  8039bd:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  8039c0:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  8039c3:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  8039c6:	e8 a6 ee ff ff       	call   802871 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  8039cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039d0:	eb 42                	jmp    803a14 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  8039d2:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  8039d6:	89 f8                	mov    %edi,%eax
+  8039d8:	c1 e8 0c             	shr    $0xc,%eax
+  8039db:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8039e2:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  8039e5:	83 ec 08             	sub    $0x8,%esp
+  8039e8:	57                   	push   %edi
+  8039e9:	6a 00                	push   $0x0
+  8039eb:	e8 4a d3 ff ff       	call   800d3a <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  8039f0:	83 c4 08             	add    $0x8,%esp
+  8039f3:	6a 01                	push   $0x1
+  8039f5:	57                   	push   %edi
+  8039f6:	e8 46 fd ff ff       	call   803741 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  8039fb:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  8039fe:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803a04:	c1 e6 0c             	shl    $0xc,%esi
+  803a07:	09 d6                	or     %edx,%esi
+  803a09:	83 ce 01             	or     $0x1,%esi
+  803a0c:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803a0e:	83 c3 01             	add    $0x1,%ebx
+  803a11:	83 c4 10             	add    $0x10,%esp
+  803a14:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803a17:	39 c3                	cmp    %eax,%ebx
+  803a19:	74 1d                	je     803a38 <page_out+0x24d>
+		if (res[i] < 0)
+  803a1b:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803a1f:	85 f6                	test   %esi,%esi
+  803a21:	79 af                	jns    8039d2 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803a23:	56                   	push   %esi
+  803a24:	68 24 5b 80 00       	push   $0x805b24
+  803a29:	68 d1 02 00 00       	push   $0x2d1
+  803a2e:	68 3a 58 80 00       	push   $0x80583a
+  803a33:	e8 63 12 00 00       	call   804c9b <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803a38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a3d:	e9 83 fe ff ff       	jmp    8038c5 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803a42:	50                   	push   %eax
+  803a43:	68 24 5b 80 00       	push   $0x805b24
+  803a48:	68 0a 03 00 00       	push   $0x30a
+  803a4d:	68 3a 58 80 00       	push   $0x80583a
+  803a52:	e8 44 12 00 00       	call   804c9b <_panic>
+		return -E_NO_MEM;
+  803a57:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803a5c:	e9 64 fe ff ff       	jmp    8038c5 <page_out+0xda>
+		return -E_PAGING;
+  803a61:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a66:	e9 5a fe ff ff       	jmp    8038c5 <page_out+0xda>
+
+00803a6b <page_alloc>:
+{
+  803a6b:	55                   	push   %ebp
+  803a6c:	89 e5                	mov    %esp,%ebp
+  803a6e:	57                   	push   %edi
+  803a6f:	56                   	push   %esi
+  803a70:	53                   	push   %ebx
+  803a71:	83 ec 0c             	sub    $0xc,%esp
+  803a74:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803a77:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803a7a:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803a81:	74 34                	je     803ab7 <page_alloc+0x4c>
+	if (check_mte)
+  803a83:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803a87:	75 35                	jne    803abe <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803a89:	83 ec 04             	sub    $0x4,%esp
+  803a8c:	ff 75 10             	push   0x10(%ebp)
+  803a8f:	56                   	push   %esi
+  803a90:	57                   	push   %edi
+  803a91:	e8 1f d2 ff ff       	call   800cb5 <sys_page_alloc>
+  803a96:	89 c3                	mov    %eax,%ebx
+  803a98:	83 c4 10             	add    $0x10,%esp
+  803a9b:	85 c0                	test   %eax,%eax
+  803a9d:	79 52                	jns    803af1 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803a9f:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803aa2:	75 52                	jne    803af6 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803aa4:	83 ec 08             	sub    $0x8,%esp
+  803aa7:	56                   	push   %esi
+  803aa8:	57                   	push   %edi
+  803aa9:	e8 3d fd ff ff       	call   8037eb <page_out>
+  803aae:	83 c4 10             	add    $0x10,%esp
+  803ab1:	85 c0                	test   %eax,%eax
+  803ab3:	79 d4                	jns    803a89 <page_alloc+0x1e>
+  803ab5:	eb 3f                	jmp    803af6 <page_alloc+0x8b>
+		init_map_dir();
+  803ab7:	e8 2f fc ff ff       	call   8036eb <init_map_dir>
+  803abc:	eb c5                	jmp    803a83 <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803abe:	83 ec 08             	sub    $0x8,%esp
+  803ac1:	6a 00                	push   $0x0
+  803ac3:	56                   	push   %esi
+  803ac4:	e8 78 fc ff ff       	call   803741 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803ac9:	83 c4 10             	add    $0x10,%esp
+  803acc:	85 c0                	test   %eax,%eax
+  803ace:	74 b9                	je     803a89 <page_alloc+0x1e>
+  803ad0:	8b 10                	mov    (%eax),%edx
+  803ad2:	f6 c2 01             	test   $0x1,%dl
+  803ad5:	74 b2                	je     803a89 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803ad7:	83 ec 08             	sub    $0x8,%esp
+  803ada:	56                   	push   %esi
+  803adb:	52                   	push   %edx
+  803adc:	50                   	push   %eax
+  803add:	68 48 5b 80 00       	push   $0x805b48
+  803ae2:	68 34 03 00 00       	push   $0x334
+  803ae7:	68 3a 58 80 00       	push   $0x80583a
+  803aec:	e8 aa 11 00 00       	call   804c9b <_panic>
+	return 0;
+  803af1:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803af6:	89 d8                	mov    %ebx,%eax
+  803af8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803afb:	5b                   	pop    %ebx
+  803afc:	5e                   	pop    %esi
+  803afd:	5f                   	pop    %edi
+  803afe:	5d                   	pop    %ebp
+  803aff:	c3                   	ret
+
+00803b00 <page_adopt>:
+{
+  803b00:	55                   	push   %ebp
+  803b01:	89 e5                	mov    %esp,%ebp
+  803b03:	56                   	push   %esi
+  803b04:	53                   	push   %ebx
+  803b05:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803b07:	c1 e8 16             	shr    $0x16,%eax
+  803b0a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803b11:	25 81 00 00 00       	and    $0x81,%eax
+  803b16:	83 f8 01             	cmp    $0x1,%eax
+  803b19:	75 53                	jne    803b6e <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803b1b:	89 d8                	mov    %ebx,%eax
+  803b1d:	c1 e8 0c             	shr    $0xc,%eax
+  803b20:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803b27:	89 f2                	mov    %esi,%edx
+  803b29:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803b2f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803b34:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803b3a:	75 37                	jne    803b73 <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803b3c:	83 ec 08             	sub    $0x8,%esp
+  803b3f:	6a 01                	push   $0x1
+  803b41:	53                   	push   %ebx
+  803b42:	e8 fa fb ff ff       	call   803741 <umapdir_walk>
+  803b47:	83 c4 10             	add    $0x10,%esp
+  803b4a:	85 c0                	test   %eax,%eax
+  803b4c:	74 2c                	je     803b7a <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803b4e:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803b54:	83 ce 01             	or     $0x1,%esi
+  803b57:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803b59:	83 ec 08             	sub    $0x8,%esp
+  803b5c:	53                   	push   %ebx
+  803b5d:	6a 00                	push   $0x0
+  803b5f:	e8 d6 d1 ff ff       	call   800d3a <sys_page_unmap>
+	return 1;
+  803b64:	83 c4 10             	add    $0x10,%esp
+  803b67:	b8 01 00 00 00       	mov    $0x1,%eax
+  803b6c:	eb 05                	jmp    803b73 <page_adopt+0x73>
+		return 0;
+  803b6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b73:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b76:	5b                   	pop    %ebx
+  803b77:	5e                   	pop    %esi
+  803b78:	5d                   	pop    %ebp
+  803b79:	c3                   	ret
+		return -E_NO_MEM;
+  803b7a:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803b7f:	eb f2                	jmp    803b73 <page_adopt+0x73>
+
+00803b81 <page_forget>:
+{
+  803b81:	55                   	push   %ebp
+  803b82:	89 e5                	mov    %esp,%ebp
+  803b84:	53                   	push   %ebx
+  803b85:	83 ec 04             	sub    $0x4,%esp
+  803b88:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803b8a:	e8 4a ef ff ff       	call   802ad9 <find_paging_env>
+	if (pagingenv == 0)
+  803b8f:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803b96:	74 39                	je     803bd1 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803b98:	89 d8                	mov    %ebx,%eax
+  803b9a:	c1 e8 16             	shr    $0x16,%eax
+  803b9d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803ba4:	25 81 00 00 00       	and    $0x81,%eax
+  803ba9:	83 f8 01             	cmp    $0x1,%eax
+  803bac:	74 28                	je     803bd6 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803bae:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803bb5:	74 1a                	je     803bd1 <page_forget+0x50>
+  803bb7:	83 ec 08             	sub    $0x8,%esp
+  803bba:	6a 00                	push   $0x0
+  803bbc:	53                   	push   %ebx
+  803bbd:	e8 7f fb ff ff       	call   803741 <umapdir_walk>
+  803bc2:	89 c3                	mov    %eax,%ebx
+  803bc4:	83 c4 10             	add    $0x10,%esp
+  803bc7:	85 c0                	test   %eax,%eax
+  803bc9:	74 06                	je     803bd1 <page_forget+0x50>
+  803bcb:	8b 00                	mov    (%eax),%eax
+  803bcd:	a8 01                	test   $0x1,%al
+  803bcf:	75 2b                	jne    803bfc <page_forget+0x7b>
+}
+  803bd1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803bd4:	c9                   	leave
+  803bd5:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803bd6:	89 d8                	mov    %ebx,%eax
+  803bd8:	c1 e8 0c             	shr    $0xc,%eax
+  803bdb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803be2:	89 c2                	mov    %eax,%edx
+  803be4:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803bea:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803bf0:	75 bc                	jne    803bae <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803bf2:	c1 e8 0c             	shr    $0xc,%eax
+  803bf5:	e8 5c ee ff ff       	call   802a56 <page_remove_slot>
+		return;
+  803bfa:	eb d5                	jmp    803bd1 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803bfc:	c1 e8 0c             	shr    $0xc,%eax
+  803bff:	e8 52 ee ff ff       	call   802a56 <page_remove_slot>
+	*mte = 0;
+  803c04:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803c0a:	eb c5                	jmp    803bd1 <page_forget+0x50>
+
+00803c0c <page_unmap>:
+{
+  803c0c:	55                   	push   %ebp
+  803c0d:	89 e5                	mov    %esp,%ebp
+  803c0f:	57                   	push   %edi
+  803c10:	56                   	push   %esi
+  803c11:	53                   	push   %ebx
+  803c12:	83 ec 0c             	sub    $0xc,%esp
+  803c15:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803c18:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803c1b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803c20:	8b 40 48             	mov    0x48(%eax),%eax
+  803c23:	85 db                	test   %ebx,%ebx
+  803c25:	0f 8e b4 00 00 00    	jle    803cdf <page_unmap+0xd3>
+  803c2b:	39 d8                	cmp    %ebx,%eax
+  803c2d:	0f 84 ac 00 00 00    	je     803cdf <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803c33:	83 ec 08             	sub    $0x8,%esp
+  803c36:	57                   	push   %edi
+  803c37:	53                   	push   %ebx
+  803c38:	e8 fd d0 ff ff       	call   800d3a <sys_page_unmap>
+  803c3d:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803c3f:	e8 95 ee ff ff       	call   802ad9 <find_paging_env>
+	if (pagingenv == 0)
+  803c44:	83 c4 10             	add    $0x10,%esp
+  803c47:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803c4e:	0f 84 a1 00 00 00    	je     803cf5 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803c54:	83 ec 0c             	sub    $0xc,%esp
+  803c57:	6a 05                	push   $0x5
+  803c59:	68 00 00 40 00       	push   $0x400000
+  803c5e:	6a 00                	push   $0x0
+  803c60:	68 00 b0 ad de       	push   $0xdeadb000
+  803c65:	53                   	push   %ebx
+  803c66:	e8 8d d0 ff ff       	call   800cf8 <sys_page_map>
+  803c6b:	83 c4 20             	add    $0x20,%esp
+  803c6e:	85 c0                	test   %eax,%eax
+  803c70:	0f 88 89 00 00 00    	js     803cff <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803c76:	89 f8                	mov    %edi,%eax
+  803c78:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803c7b:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803c82:	a8 01                	test   $0x1,%al
+  803c84:	74 6f                	je     803cf5 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803c86:	83 ec 0c             	sub    $0xc,%esp
+  803c89:	6a 05                	push   $0x5
+  803c8b:	68 00 00 40 00       	push   $0x400000
+  803c90:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803c92:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803c97:	50                   	push   %eax
+  803c98:	53                   	push   %ebx
+  803c99:	e8 5a d0 ff ff       	call   800cf8 <sys_page_map>
+  803c9e:	83 c4 20             	add    $0x20,%esp
+  803ca1:	85 c0                	test   %eax,%eax
+  803ca3:	78 6f                	js     803d14 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803ca5:	c1 ef 0c             	shr    $0xc,%edi
+  803ca8:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803cae:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803cb5:	01 
+  803cb6:	74 3d                	je     803cf5 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803cb8:	83 ec 08             	sub    $0x8,%esp
+  803cbb:	68 00 00 40 00       	push   $0x400000
+  803cc0:	6a 00                	push   $0x0
+  803cc2:	e8 73 d0 ff ff       	call   800d3a <sys_page_unmap>
+  803cc7:	83 c4 10             	add    $0x10,%esp
+  803cca:	85 c0                	test   %eax,%eax
+  803ccc:	78 5b                	js     803d29 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803cce:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803cd5:	c1 e8 0c             	shr    $0xc,%eax
+  803cd8:	e8 79 ed ff ff       	call   802a56 <page_remove_slot>
+	return r;
+  803cdd:	eb 16                	jmp    803cf5 <page_unmap+0xe9>
+		page_forget(va);
+  803cdf:	89 f8                	mov    %edi,%eax
+  803ce1:	e8 9b fe ff ff       	call   803b81 <page_forget>
+		return sys_page_unmap(envid, va);
+  803ce6:	83 ec 08             	sub    $0x8,%esp
+  803ce9:	57                   	push   %edi
+  803cea:	53                   	push   %ebx
+  803ceb:	e8 4a d0 ff ff       	call   800d3a <sys_page_unmap>
+  803cf0:	89 c6                	mov    %eax,%esi
+  803cf2:	83 c4 10             	add    $0x10,%esp
+}
+  803cf5:	89 f0                	mov    %esi,%eax
+  803cf7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cfa:	5b                   	pop    %ebx
+  803cfb:	5e                   	pop    %esi
+  803cfc:	5f                   	pop    %edi
+  803cfd:	5d                   	pop    %ebp
+  803cfe:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803cff:	50                   	push   %eax
+  803d00:	68 84 5b 80 00       	push   $0x805b84
+  803d05:	68 e4 03 00 00       	push   $0x3e4
+  803d0a:	68 3a 58 80 00       	push   $0x80583a
+  803d0f:	e8 87 0f 00 00       	call   804c9b <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803d14:	50                   	push   %eax
+  803d15:	68 b0 5b 80 00       	push   $0x805bb0
+  803d1a:	68 ea 03 00 00       	push   $0x3ea
+  803d1f:	68 3a 58 80 00       	push   $0x80583a
+  803d24:	e8 72 0f 00 00       	call   804c9b <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803d29:	50                   	push   %eax
+  803d2a:	68 dc 5b 80 00       	push   $0x805bdc
+  803d2f:	68 ef 03 00 00       	push   $0x3ef
+  803d34:	68 3a 58 80 00       	push   $0x80583a
+  803d39:	e8 5d 0f 00 00       	call   804c9b <_panic>
+
+00803d3e <page_unmap_range>:
+{
+  803d3e:	55                   	push   %ebp
+  803d3f:	89 e5                	mov    %esp,%ebp
+  803d41:	57                   	push   %edi
+  803d42:	56                   	push   %esi
+  803d43:	53                   	push   %ebx
+  803d44:	83 ec 0c             	sub    $0xc,%esp
+  803d47:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803d4a:	e8 8a ed ff ff       	call   802ad9 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803d4f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803d54:	8b 40 48             	mov    0x48(%eax),%eax
+  803d57:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803d5b:	7e 38                	jle    803d95 <page_unmap_range+0x57>
+  803d5d:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803d60:	74 33                	je     803d95 <page_unmap_range+0x57>
+  803d62:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803d69:	74 2a                	je     803d95 <page_unmap_range+0x57>
+  803d6b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  803d6e:	be 00 00 00 00       	mov    $0x0,%esi
+  803d73:	39 fe                	cmp    %edi,%esi
+  803d75:	74 56                	je     803dcd <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  803d77:	83 ec 08             	sub    $0x8,%esp
+  803d7a:	53                   	push   %ebx
+  803d7b:	ff 75 08             	push   0x8(%ebp)
+  803d7e:	e8 89 fe ff ff       	call   803c0c <page_unmap>
+  803d83:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803d89:	83 c4 10             	add    $0x10,%esp
+  803d8c:	85 c0                	test   %eax,%eax
+  803d8e:	78 35                	js     803dc5 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  803d90:	83 c6 01             	add    $0x1,%esi
+  803d93:	eb de                	jmp    803d73 <page_unmap_range+0x35>
+  803d95:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803d98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d9d:	eb 10                	jmp    803daf <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803d9f:	89 f0                	mov    %esi,%eax
+  803da1:	e8 db fd ff ff       	call   803b81 <page_forget>
+		for (i = 0; i < npages; i++)
+  803da6:	83 c3 01             	add    $0x1,%ebx
+  803da9:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803daf:	39 fb                	cmp    %edi,%ebx
+  803db1:	75 ec                	jne    803d9f <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  803db3:	83 ec 04             	sub    $0x4,%esp
+  803db6:	57                   	push   %edi
+  803db7:	ff 75 0c             	push   0xc(%ebp)
+  803dba:	ff 75 08             	push   0x8(%ebp)
+  803dbd:	e8 8c d0 ff ff       	call   800e4e <sys_page_unmap_range>
+  803dc2:	83 c4 10             	add    $0x10,%esp
+}
+  803dc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dc8:	5b                   	pop    %ebx
+  803dc9:	5e                   	pop    %esi
+  803dca:	5f                   	pop    %edi
+  803dcb:	5d                   	pop    %ebp
+  803dcc:	c3                   	ret
+	return 0;
+  803dcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dd2:	eb f1                	jmp    803dc5 <page_unmap_range+0x87>
+
+00803dd4 <page_alloc_range>:
+{
+  803dd4:	55                   	push   %ebp
+  803dd5:	89 e5                	mov    %esp,%ebp
+  803dd7:	57                   	push   %edi
+  803dd8:	56                   	push   %esi
+  803dd9:	53                   	push   %ebx
+  803dda:	83 ec 1c             	sub    $0x1c,%esp
+  803ddd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803de0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  803de3:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803dea:	74 14                	je     803e00 <page_alloc_range+0x2c>
+	if (check_mte)
+  803dec:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803df0:	74 66                	je     803e58 <page_alloc_range+0x84>
+  803df2:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  803df4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803df9:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803dfc:	89 c7                	mov    %eax,%edi
+  803dfe:	eb 10                	jmp    803e10 <page_alloc_range+0x3c>
+		init_map_dir();
+  803e00:	e8 e6 f8 ff ff       	call   8036eb <init_map_dir>
+  803e05:	eb e5                	jmp    803dec <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803e07:	83 c7 01             	add    $0x1,%edi
+  803e0a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803e10:	39 df                	cmp    %ebx,%edi
+  803e12:	74 38                	je     803e4c <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  803e14:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803e17:	83 ec 08             	sub    $0x8,%esp
+  803e1a:	6a 00                	push   $0x0
+  803e1c:	56                   	push   %esi
+  803e1d:	e8 1f f9 ff ff       	call   803741 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  803e22:	83 c4 10             	add    $0x10,%esp
+  803e25:	85 c0                	test   %eax,%eax
+  803e27:	74 de                	je     803e07 <page_alloc_range+0x33>
+  803e29:	8b 10                	mov    (%eax),%edx
+  803e2b:	f6 c2 01             	test   $0x1,%dl
+  803e2e:	74 d7                	je     803e07 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  803e30:	83 ec 08             	sub    $0x8,%esp
+  803e33:	ff 75 e4             	push   -0x1c(%ebp)
+  803e36:	52                   	push   %edx
+  803e37:	50                   	push   %eax
+  803e38:	68 48 5b 80 00       	push   $0x805b48
+  803e3d:	68 0b 04 00 00       	push   $0x40b
+  803e42:	68 3a 58 80 00       	push   $0x80583a
+  803e47:	e8 4f 0e 00 00       	call   804c9b <_panic>
+  803e4c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803e4f:	eb 07                	jmp    803e58 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  803e51:	c1 e0 0c             	shl    $0xc,%eax
+  803e54:	01 c7                	add    %eax,%edi
+			npages -= r;
+  803e56:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  803e58:	85 db                	test   %ebx,%ebx
+  803e5a:	74 30                	je     803e8c <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  803e5c:	ff 75 14             	push   0x14(%ebp)
+  803e5f:	53                   	push   %ebx
+  803e60:	57                   	push   %edi
+  803e61:	ff 75 08             	push   0x8(%ebp)
+  803e64:	e8 77 cf ff ff       	call   800de0 <sys_page_alloc_range>
+  803e69:	89 c6                	mov    %eax,%esi
+  803e6b:	83 c4 10             	add    $0x10,%esp
+  803e6e:	85 c0                	test   %eax,%eax
+  803e70:	7f df                	jg     803e51 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  803e72:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  803e75:	75 1a                	jne    803e91 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  803e77:	83 ec 08             	sub    $0x8,%esp
+  803e7a:	57                   	push   %edi
+  803e7b:	ff 75 08             	push   0x8(%ebp)
+  803e7e:	e8 68 f9 ff ff       	call   8037eb <page_out>
+  803e83:	83 c4 10             	add    $0x10,%esp
+  803e86:	85 c0                	test   %eax,%eax
+  803e88:	79 ce                	jns    803e58 <page_alloc_range+0x84>
+  803e8a:	eb 05                	jmp    803e91 <page_alloc_range+0xbd>
+	return 0;
+  803e8c:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803e91:	89 f0                	mov    %esi,%eax
+  803e93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e96:	5b                   	pop    %ebx
+  803e97:	5e                   	pop    %esi
+  803e98:	5f                   	pop    %edi
+  803e99:	5d                   	pop    %ebp
+  803e9a:	c3                   	ret
+
+00803e9b <page_in>:
+{
+  803e9b:	55                   	push   %ebp
+  803e9c:	89 e5                	mov    %esp,%ebp
+  803e9e:	57                   	push   %edi
+  803e9f:	56                   	push   %esi
+  803ea0:	53                   	push   %ebx
+  803ea1:	83 ec 3c             	sub    $0x3c,%esp
+  803ea4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  803ea7:	e8 2d ec ff ff       	call   802ad9 <find_paging_env>
+	if (pagingenv == 0)
+  803eac:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803eb3:	0f 84 09 02 00 00    	je     8040c2 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  803eb9:	83 ec 08             	sub    $0x8,%esp
+  803ebc:	6a 00                	push   $0x0
+  803ebe:	56                   	push   %esi
+  803ebf:	e8 7d f8 ff ff       	call   803741 <umapdir_walk>
+  803ec4:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803ec6:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803ecc:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  803ecf:	83 c4 10             	add    $0x10,%esp
+  803ed2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803ed6:	74 0d                	je     803ee5 <page_in+0x4a>
+  803ed8:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803edd:	8b 40 48             	mov    0x48(%eax),%eax
+  803ee0:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803ee3:	75 06                	jne    803eeb <page_in+0x50>
+  803ee5:	8b 03                	mov    (%ebx),%eax
+  803ee7:	a8 02                	test   $0x2,%al
+  803ee9:	75 63                	jne    803f4e <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  803eeb:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803eed:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803eef:	89 f0                	mov    %esi,%eax
+  803ef1:	25 06 0e 00 00       	and    $0xe06,%eax
+  803ef6:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803ef9:	50                   	push   %eax
+  803efa:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803efd:	57                   	push   %edi
+  803efe:	ff 75 08             	push   0x8(%ebp)
+  803f01:	e8 65 fb ff ff       	call   803a6b <page_alloc>
+  803f06:	83 c4 10             	add    $0x10,%esp
+  803f09:	85 c0                	test   %eax,%eax
+  803f0b:	78 39                	js     803f46 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  803f0d:	89 f0                	mov    %esi,%eax
+  803f0f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803f12:	83 ec 0c             	sub    $0xc,%esp
+  803f15:	6a 07                	push   $0x7
+  803f17:	6a 01                	push   $0x1
+  803f19:	57                   	push   %edi
+  803f1a:	c1 e0 04             	shl    $0x4,%eax
+  803f1d:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803f1e:	c1 ee 1c             	shr    $0x1c,%esi
+  803f21:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803f24:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803f2b:	e8 37 10 00 00       	call   804f67 <ipc_call>
+  803f30:	83 c4 20             	add    $0x20,%esp
+  803f33:	85 c0                	test   %eax,%eax
+  803f35:	0f 88 72 01 00 00    	js     8040ad <page_in+0x212>
+	*mte = 0;
+  803f3b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  803f41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f49:	5b                   	pop    %ebx
+  803f4a:	5e                   	pop    %esi
+  803f4b:	5f                   	pop    %edi
+  803f4c:	5d                   	pop    %ebp
+  803f4d:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803f4e:	25 06 0e 00 00       	and    $0xe06,%eax
+  803f53:	83 c8 01             	or     $0x1,%eax
+  803f56:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  803f59:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803f5c:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  803f5f:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  803f65:	be 01 00 00 00       	mov    $0x1,%esi
+  803f6a:	eb 46                	jmp    803fb2 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  803f6c:	83 ec 08             	sub    $0x8,%esp
+  803f6f:	6a 00                	push   $0x0
+  803f71:	51                   	push   %ecx
+  803f72:	e8 ca f7 ff ff       	call   803741 <umapdir_walk>
+  803f77:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  803f7b:	83 c4 10             	add    $0x10,%esp
+  803f7e:	85 c0                	test   %eax,%eax
+  803f80:	74 66                	je     803fe8 <page_in+0x14d>
+  803f82:	8b 00                	mov    (%eax),%eax
+  803f84:	a8 01                	test   $0x1,%al
+  803f86:	74 60                	je     803fe8 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  803f88:	89 c2                	mov    %eax,%edx
+  803f8a:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  803f90:	83 ca 01             	or     $0x1,%edx
+  803f93:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  803f96:	75 50                	jne    803fe8 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  803f98:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803f9e:	c1 e8 1c             	shr    $0x1c,%eax
+  803fa1:	8b 13                	mov    (%ebx),%edx
+  803fa3:	c1 ea 1c             	shr    $0x1c,%edx
+  803fa6:	39 d0                	cmp    %edx,%eax
+  803fa8:	75 3e                	jne    803fe8 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803faa:	83 c6 01             	add    $0x1,%esi
+  803fad:	83 fe 08             	cmp    $0x8,%esi
+  803fb0:	74 3f                	je     803ff1 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  803fb2:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803fb4:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  803fba:	77 2c                	ja     803fe8 <page_in+0x14d>
+  803fbc:	89 f8                	mov    %edi,%eax
+  803fbe:	c1 e8 16             	shr    $0x16,%eax
+  803fc1:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803fc8:	f6 c2 01             	test   $0x1,%dl
+  803fcb:	74 9f                	je     803f6c <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803fcd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803fd4:	a8 80                	test   $0x80,%al
+  803fd6:	75 10                	jne    803fe8 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803fd8:	89 f8                	mov    %edi,%eax
+  803fda:	c1 e8 0c             	shr    $0xc,%eax
+  803fdd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803fe4:	a8 01                	test   $0x1,%al
+  803fe6:	74 84                	je     803f6c <page_in+0xd1>
+	if (n == 1)
+  803fe8:	83 fe 01             	cmp    $0x1,%esi
+  803feb:	0f 84 fa fe ff ff    	je     803eeb <page_in+0x50>
+	req.nslots = n;
+  803ff1:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  803ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ffc:	eb 13                	jmp    804011 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  803ffe:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  804002:	8b 12                	mov    (%edx),%edx
+  804004:	c1 ea 0c             	shr    $0xc,%edx
+  804007:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  80400e:	83 c0 01             	add    $0x1,%eax
+  804011:	39 c6                	cmp    %eax,%esi
+  804013:	75 e9                	jne    803ffe <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  804015:	83 ec 0c             	sub    $0xc,%esp
+  804018:	6a 00                	push   $0x0
+  80401a:	ff 75 c0             	push   -0x40(%ebp)
+  80401d:	56                   	push   %esi
+  80401e:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804021:	57                   	push   %edi
+  804022:	6a 00                	push   $0x0
+  804024:	e8 ab fd ff ff       	call   803dd4 <page_alloc_range>
+  804029:	83 c4 20             	add    $0x20,%esp
+  80402c:	85 c0                	test   %eax,%eax
+  80402e:	78 6e                	js     80409e <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  804030:	83 ec 04             	sub    $0x4,%esp
+  804033:	6a 24                	push   $0x24
+  804035:	68 00 80 80 00       	push   $0x808000
+  80403a:	57                   	push   %edi
+  80403b:	e8 08 c9 ff ff       	call   800948 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804040:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  804047:	56                   	push   %esi
+  804048:	57                   	push   %edi
+  804049:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  80404b:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  804052:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804055:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  80405c:	e8 06 0f 00 00       	call   804f67 <ipc_call>
+  804061:	83 c4 20             	add    $0x20,%esp
+  804064:	85 c0                	test   %eax,%eax
+  804066:	78 08                	js     804070 <page_in+0x1d5>
+  804068:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80406b:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  80406e:	eb 20                	jmp    804090 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  804070:	50                   	push   %eax
+  804071:	68 08 5c 80 00       	push   $0x805c08
+  804076:	68 59 02 00 00       	push   $0x259
+  80407b:	68 3a 58 80 00       	push   $0x80583a
+  804080:	e8 16 0c 00 00       	call   804c9b <_panic>
+		*mtes[i] = 0;
+  804085:	8b 10                	mov    (%eax),%edx
+  804087:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  80408d:	83 c0 04             	add    $0x4,%eax
+  804090:	39 c8                	cmp    %ecx,%eax
+  804092:	75 f1                	jne    804085 <page_in+0x1ea>
+	return n;
+  804094:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  804096:	85 f6                	test   %esi,%esi
+  804098:	0f 84 4d fe ff ff    	je     803eeb <page_in+0x50>
+		return r < 0 ? r : 0;
+  80409e:	85 c0                	test   %eax,%eax
+  8040a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040a5:	0f 4f c2             	cmovg  %edx,%eax
+  8040a8:	e9 99 fe ff ff       	jmp    803f46 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  8040ad:	50                   	push   %eax
+  8040ae:	68 40 5c 80 00       	push   $0x805c40
+  8040b3:	68 9a 02 00 00       	push   $0x29a
+  8040b8:	68 3a 58 80 00       	push   $0x80583a
+  8040bd:	e8 d9 0b 00 00       	call   804c9b <_panic>
+		return -E_PAGING;
+  8040c2:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8040c7:	e9 7a fe ff ff       	jmp    803f46 <page_in+0xab>
+
+008040cc <page_map>:
+{
+  8040cc:	55                   	push   %ebp
+  8040cd:	89 e5                	mov    %esp,%ebp
+  8040cf:	57                   	push   %edi
+  8040d0:	56                   	push   %esi
+  8040d1:	53                   	push   %ebx
+  8040d2:	83 ec 1c             	sub    $0x1c,%esp
+  8040d5:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8040d8:	83 ec 0c             	sub    $0xc,%esp
+  8040db:	ff 75 18             	push   0x18(%ebp)
+  8040de:	ff 75 14             	push   0x14(%ebp)
+  8040e1:	ff 75 10             	push   0x10(%ebp)
+  8040e4:	ff 75 0c             	push   0xc(%ebp)
+  8040e7:	56                   	push   %esi
+  8040e8:	e8 0b cc ff ff       	call   800cf8 <sys_page_map>
+  8040ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8040f0:	83 c4 20             	add    $0x20,%esp
+  8040f3:	85 c0                	test   %eax,%eax
+  8040f5:	0f 89 a9 01 00 00    	jns    8042a4 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  8040fb:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  8040ff:	74 5f                	je     804160 <page_map+0x94>
+		if (r != -E_INVAL)
+  804101:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  804105:	0f 85 a0 01 00 00    	jne    8042ab <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  80410b:	85 f6                	test   %esi,%esi
+  80410d:	74 70                	je     80417f <page_map+0xb3>
+  80410f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804114:	8b 40 48             	mov    0x48(%eax),%eax
+  804117:	39 f0                	cmp    %esi,%eax
+  804119:	74 64                	je     80417f <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80411b:	83 ec 0c             	sub    $0xc,%esp
+  80411e:	6a 05                	push   $0x5
+  804120:	68 00 00 40 00       	push   $0x400000
+  804125:	6a 00                	push   $0x0
+  804127:	68 00 b0 ad de       	push   $0xdeadb000
+  80412c:	56                   	push   %esi
+  80412d:	e8 c6 cb ff ff       	call   800cf8 <sys_page_map>
+  804132:	89 c3                	mov    %eax,%ebx
+  804134:	83 c4 20             	add    $0x20,%esp
+  804137:	85 c0                	test   %eax,%eax
+  804139:	79 6a                	jns    8041a5 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  80413b:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80413e:	75 50                	jne    804190 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  804140:	83 ec 08             	sub    $0x8,%esp
+  804143:	68 00 00 40 00       	push   $0x400000
+  804148:	6a fc                	push   $0xfffffffc
+  80414a:	e8 9c f6 ff ff       	call   8037eb <page_out>
+  80414f:	83 c4 10             	add    $0x10,%esp
+  804152:	85 c0                	test   %eax,%eax
+  804154:	79 c5                	jns    80411b <page_map+0x4f>
+}
+  804156:	89 d8                	mov    %ebx,%eax
+  804158:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80415b:	5b                   	pop    %ebx
+  80415c:	5e                   	pop    %esi
+  80415d:	5f                   	pop    %edi
+  80415e:	5d                   	pop    %ebp
+  80415f:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  804160:	83 ec 08             	sub    $0x8,%esp
+  804163:	68 00 00 40 00       	push   $0x400000
+  804168:	6a 00                	push   $0x0
+  80416a:	e8 7c f6 ff ff       	call   8037eb <page_out>
+  80416f:	83 c4 10             	add    $0x10,%esp
+  804172:	85 c0                	test   %eax,%eax
+  804174:	0f 89 5e ff ff ff    	jns    8040d8 <page_map+0xc>
+				return r;
+  80417a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80417d:	eb d7                	jmp    804156 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  80417f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804182:	e8 79 f9 ff ff       	call   803b00 <page_adopt>
+  804187:	85 c0                	test   %eax,%eax
+  804189:	79 90                	jns    80411b <page_map+0x4f>
+			return r;
+  80418b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80418e:	eb c6                	jmp    804156 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  804190:	53                   	push   %ebx
+  804191:	68 74 5c 80 00       	push   $0x805c74
+  804196:	68 77 03 00 00       	push   $0x377
+  80419b:	68 3a 58 80 00       	push   $0x80583a
+  8041a0:	e8 f6 0a 00 00       	call   804c9b <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  8041a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8041a8:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8041ab:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  8041b2:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8041b8:	0f 84 f5 00 00 00    	je     8042b3 <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8041be:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8041c4:	83 ec 0c             	sub    $0xc,%esp
+  8041c7:	6a 05                	push   $0x5
+  8041c9:	68 00 00 40 00       	push   $0x400000
+  8041ce:	6a 00                	push   $0x0
+  8041d0:	57                   	push   %edi
+  8041d1:	56                   	push   %esi
+  8041d2:	e8 21 cb ff ff       	call   800cf8 <sys_page_map>
+  8041d7:	89 c3                	mov    %eax,%ebx
+  8041d9:	83 c4 20             	add    $0x20,%esp
+  8041dc:	85 c0                	test   %eax,%eax
+  8041de:	79 35                	jns    804215 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  8041e0:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8041e3:	75 1b                	jne    804200 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8041e5:	83 ec 08             	sub    $0x8,%esp
+  8041e8:	68 00 00 40 00       	push   $0x400000
+  8041ed:	6a 00                	push   $0x0
+  8041ef:	e8 f7 f5 ff ff       	call   8037eb <page_out>
+  8041f4:	83 c4 10             	add    $0x10,%esp
+  8041f7:	85 c0                	test   %eax,%eax
+  8041f9:	79 c9                	jns    8041c4 <page_map+0xf8>
+  8041fb:	e9 56 ff ff ff       	jmp    804156 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  804200:	53                   	push   %ebx
+  804201:	68 9c 5c 80 00       	push   $0x805c9c
+  804206:	68 83 03 00 00       	push   $0x383
+  80420b:	68 3a 58 80 00       	push   $0x80583a
+  804210:	e8 86 0a 00 00       	call   804c9b <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  804215:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804218:	c1 e8 0c             	shr    $0xc,%eax
+  80421b:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  804220:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  804227:	01 
+  804228:	0f 84 8d 00 00 00    	je     8042bb <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  80422e:	83 ec 08             	sub    $0x8,%esp
+  804231:	68 00 00 40 00       	push   $0x400000
+  804236:	6a 00                	push   $0x0
+  804238:	e8 fd ca ff ff       	call   800d3a <sys_page_unmap>
+  80423d:	83 c4 10             	add    $0x10,%esp
+  804240:	85 c0                	test   %eax,%eax
+  804242:	78 36                	js     80427a <page_map+0x1ae>
+  804244:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  804247:	83 ec 08             	sub    $0x8,%esp
+  80424a:	57                   	push   %edi
+  80424b:	56                   	push   %esi
+  80424c:	e8 4a fc ff ff       	call   803e9b <page_in>
+  804251:	89 c3                	mov    %eax,%ebx
+  804253:	83 c4 10             	add    $0x10,%esp
+  804256:	85 c0                	test   %eax,%eax
+  804258:	0f 89 7a fe ff ff    	jns    8040d8 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  80425e:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804261:	75 2c                	jne    80428f <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  804263:	83 ec 08             	sub    $0x8,%esp
+  804266:	57                   	push   %edi
+  804267:	6a 00                	push   $0x0
+  804269:	e8 7d f5 ff ff       	call   8037eb <page_out>
+  80426e:	83 c4 10             	add    $0x10,%esp
+  804271:	85 c0                	test   %eax,%eax
+  804273:	79 d2                	jns    804247 <page_map+0x17b>
+  804275:	e9 dc fe ff ff       	jmp    804156 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  80427a:	50                   	push   %eax
+  80427b:	68 c8 5c 80 00       	push   $0x805cc8
+  804280:	68 8b 03 00 00       	push   $0x38b
+  804285:	68 3a 58 80 00       	push   $0x80583a
+  80428a:	e8 0c 0a 00 00       	call   804c9b <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  80428f:	53                   	push   %ebx
+  804290:	68 f0 5c 80 00       	push   $0x805cf0
+  804295:	68 91 03 00 00       	push   $0x391
+  80429a:	68 3a 58 80 00       	push   $0x80583a
+  80429f:	e8 f7 09 00 00       	call   804c9b <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8042a4:	89 c3                	mov    %eax,%ebx
+  8042a6:	e9 ab fe ff ff       	jmp    804156 <page_map+0x8a>
+  8042ab:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8042ae:	e9 a3 fe ff ff       	jmp    804156 <page_map+0x8a>
+			return r; // Pass through the error
+  8042b3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8042b6:	e9 9b fe ff ff       	jmp    804156 <page_map+0x8a>
+			return r; // Pass through the error
+  8042bb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8042be:	e9 93 fe ff ff       	jmp    804156 <page_map+0x8a>
+
+008042c3 <page_map_range>:
+{
+  8042c3:	55                   	push   %ebp
+  8042c4:	89 e5                	mov    %esp,%ebp
+  8042c6:	57                   	push   %edi
+  8042c7:	56                   	push   %esi
+  8042c8:	53                   	push   %ebx
+  8042c9:	83 ec 0c             	sub    $0xc,%esp
+  8042cc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8042cf:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  8042d2:	83 ec 08             	sub    $0x8,%esp
+  8042d5:	ff 75 1c             	push   0x1c(%ebp)
+  8042d8:	ff 75 18             	push   0x18(%ebp)
+  8042db:	56                   	push   %esi
+  8042dc:	ff 75 10             	push   0x10(%ebp)
+  8042df:	57                   	push   %edi
+  8042e0:	ff 75 08             	push   0x8(%ebp)
+  8042e3:	e8 1b cb ff ff       	call   800e03 <sys_page_map_range>
+  8042e8:	89 c3                	mov    %eax,%ebx
+  8042ea:	83 c4 20             	add    $0x20,%esp
+  8042ed:	85 c0                	test   %eax,%eax
+  8042ef:	79 1b                	jns    80430c <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  8042f1:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8042f4:	75 20                	jne    804316 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8042f6:	83 ec 08             	sub    $0x8,%esp
+  8042f9:	68 00 00 40 00       	push   $0x400000
+  8042fe:	6a 00                	push   $0x0
+  804300:	e8 e6 f4 ff ff       	call   8037eb <page_out>
+  804305:	83 c4 10             	add    $0x10,%esp
+  804308:	85 c0                	test   %eax,%eax
+  80430a:	79 c6                	jns    8042d2 <page_map_range+0xf>
+}
+  80430c:	89 d8                	mov    %ebx,%eax
+  80430e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804311:	5b                   	pop    %ebx
+  804312:	5e                   	pop    %esi
+  804313:	5f                   	pop    %edi
+  804314:	5d                   	pop    %ebp
+  804315:	c3                   	ret
+		if (r != -E_INVAL)
+  804316:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  804319:	75 f1                	jne    80430c <page_map_range+0x49>
+  80431b:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  80431d:	be 00 00 00 00       	mov    $0x0,%esi
+  804322:	eb 03                	jmp    804327 <page_map_range+0x64>
+  804324:	83 c6 01             	add    $0x1,%esi
+  804327:	3b 75 18             	cmp    0x18(%ebp),%esi
+  80432a:	74 2a                	je     804356 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  80432c:	83 ec 0c             	sub    $0xc,%esp
+  80432f:	ff 75 1c             	push   0x1c(%ebp)
+  804332:	53                   	push   %ebx
+  804333:	ff 75 10             	push   0x10(%ebp)
+  804336:	57                   	push   %edi
+  804337:	ff 75 08             	push   0x8(%ebp)
+  80433a:	e8 8d fd ff ff       	call   8040cc <page_map>
+  80433f:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804345:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80434b:	83 c4 20             	add    $0x20,%esp
+  80434e:	85 c0                	test   %eax,%eax
+  804350:	79 d2                	jns    804324 <page_map_range+0x61>
+  804352:	89 c3                	mov    %eax,%ebx
+  804354:	eb b6                	jmp    80430c <page_map_range+0x49>
+		return 0;
+  804356:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80435b:	eb af                	jmp    80430c <page_map_range+0x49>
+
+0080435d <paging_pgfault_handler>:
+{
+  80435d:	55                   	push   %ebp
+  80435e:	89 e5                	mov    %esp,%ebp
+  804360:	56                   	push   %esi
+  804361:	53                   	push   %ebx
+  804362:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  804365:	e8 6f e7 ff ff       	call   802ad9 <find_paging_env>
+	if (pagingenv == 0)
+  80436a:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80436f:	85 c0                	test   %eax,%eax
+  804371:	74 3c                	je     8043af <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  804373:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804375:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804379:	75 12                	jne    80438d <paging_pgfault_handler+0x30>
+  80437b:	89 f0                	mov    %esi,%eax
+  80437d:	e8 7e f7 ff ff       	call   803b00 <page_adopt>
+  804382:	89 c2                	mov    %eax,%edx
+		return 0;
+  804384:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804389:	85 d2                	test   %edx,%edx
+  80438b:	78 22                	js     8043af <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  80438d:	83 ec 08             	sub    $0x8,%esp
+  804390:	6a 00                	push   $0x0
+  804392:	56                   	push   %esi
+  804393:	e8 a9 f3 ff ff       	call   803741 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  804398:	83 c4 10             	add    $0x10,%esp
+  80439b:	85 c0                	test   %eax,%eax
+  80439d:	74 05                	je     8043a4 <paging_pgfault_handler+0x47>
+  80439f:	f6 00 01             	testb  $0x1,(%eax)
+  8043a2:	75 12                	jne    8043b6 <paging_pgfault_handler+0x59>
+	return 0;
+  8043a4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8043a9:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8043ad:	74 23                	je     8043d2 <paging_pgfault_handler+0x75>
+}
+  8043af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8043b2:	5b                   	pop    %ebx
+  8043b3:	5e                   	pop    %esi
+  8043b4:	5d                   	pop    %ebp
+  8043b5:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  8043b6:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8043bb:	8b 40 48             	mov    0x48(%eax),%eax
+  8043be:	83 ec 08             	sub    $0x8,%esp
+  8043c1:	56                   	push   %esi
+  8043c2:	50                   	push   %eax
+  8043c3:	e8 d3 fa ff ff       	call   803e9b <page_in>
+  8043c8:	f7 d0                	not    %eax
+  8043ca:	c1 e8 1f             	shr    $0x1f,%eax
+  8043cd:	83 c4 10             	add    $0x10,%esp
+  8043d0:	eb dd                	jmp    8043af <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8043d2:	89 f0                	mov    %esi,%eax
+  8043d4:	e8 97 e2 ff ff       	call   802670 <segment_lookup>
+  8043d9:	89 c2                	mov    %eax,%edx
+	return 0;
+  8043db:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8043e0:	85 d2                	test   %edx,%edx
+  8043e2:	74 cb                	je     8043af <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  8043e4:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8043e9:	8b 40 48             	mov    0x48(%eax),%eax
+  8043ec:	83 ec 08             	sub    $0x8,%esp
+  8043ef:	56                   	push   %esi
+  8043f0:	50                   	push   %eax
+  8043f1:	e8 f5 f3 ff ff       	call   8037eb <page_out>
+  8043f6:	f7 d0                	not    %eax
+  8043f8:	c1 e8 1f             	shr    $0x1f,%eax
+  8043fb:	83 c4 10             	add    $0x10,%esp
+  8043fe:	eb af                	jmp    8043af <paging_pgfault_handler+0x52>
+
+00804400 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  804400:	55                   	push   %ebp
+  804401:	89 e5                	mov    %esp,%ebp
+  804403:	57                   	push   %edi
+  804404:	56                   	push   %esi
+  804405:	53                   	push   %ebx
+  804406:	83 ec 2c             	sub    $0x2c,%esp
+  804409:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  80440c:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  804411:	89 c1                	mov    %eax,%ecx
+  804413:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  804416:	c1 e8 11             	shr    $0x11,%eax
+  804419:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80441c:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  804423:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  804426:	b8 01 00 00 00       	mov    $0x1,%eax
+  80442b:	d3 e0                	shl    %cl,%eax
+  80442d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  804430:	85 c7                	test   %eax,%edi
+  804432:	74 12                	je     804446 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804434:	bb 01 00 00 00       	mov    $0x1,%ebx
+  804439:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  80443c:	bf 01 00 00 00       	mov    $0x1,%edi
+  804441:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804444:	eb 17                	jmp    80445d <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  804446:	ff 75 e0             	push   -0x20(%ebp)
+  804449:	68 28 5d 80 00       	push   $0x805d28
+  80444e:	6a 48                	push   $0x48
+  804450:	68 42 5d 80 00       	push   $0x805d42
+  804455:	e8 41 08 00 00       	call   804c9b <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  80445a:	83 c3 01             	add    $0x1,%ebx
+  80445d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804460:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  804463:	89 c8                	mov    %ecx,%eax
+  804465:	c1 e8 05             	shr    $0x5,%eax
+  804468:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  80446f:	89 fe                	mov    %edi,%esi
+  804471:	d3 e6                	shl    %cl,%esi
+  804473:	89 f1                	mov    %esi,%ecx
+  804475:	85 d6                	test   %edx,%esi
+  804477:	74 e1                	je     80445a <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  804479:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  80447c:	f7 d6                	not    %esi
+  80447e:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804481:	21 fe                	and    %edi,%esi
+  804483:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804486:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  80448d:	f7 d1                	not    %ecx
+  80448f:	21 d1                	and    %edx,%ecx
+  804491:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804498:	83 ec 04             	sub    $0x4,%esp
+  80449b:	53                   	push   %ebx
+  80449c:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80449f:	57                   	push   %edi
+  8044a0:	6a 00                	push   $0x0
+  8044a2:	e8 97 f8 ff ff       	call   803d3e <page_unmap_range>
+	va_free(va, n);
+  8044a7:	83 c4 08             	add    $0x8,%esp
+  8044aa:	53                   	push   %ebx
+  8044ab:	57                   	push   %edi
+  8044ac:	e8 ed 05 00 00       	call   804a9e <va_free>
+}
+  8044b1:	83 c4 10             	add    $0x10,%esp
+  8044b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044b7:	5b                   	pop    %ebx
+  8044b8:	5e                   	pop    %esi
+  8044b9:	5f                   	pop    %edi
+  8044ba:	5d                   	pop    %ebp
+  8044bb:	c3                   	ret
+
+008044bc <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  8044bc:	55                   	push   %ebp
+  8044bd:	89 e5                	mov    %esp,%ebp
+  8044bf:	57                   	push   %edi
+  8044c0:	56                   	push   %esi
+  8044c1:	53                   	push   %ebx
+  8044c2:	83 ec 1c             	sub    $0x1c,%esp
+  8044c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  8044c8:	85 db                	test   %ebx,%ebx
+  8044ca:	74 34                	je     804500 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  8044cc:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8044d2:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  8044d7:	77 2f                	ja     804508 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  8044d9:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8044df:	75 51                	jne    804532 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  8044e1:	89 c1                	mov    %eax,%ecx
+  8044e3:	c1 e9 0c             	shr    $0xc,%ecx
+  8044e6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8044eb:	d3 e2                	shl    %cl,%edx
+  8044ed:	c1 e8 11             	shr    $0x11,%eax
+  8044f0:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  8044f7:	75 24                	jne    80451d <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  8044f9:	89 d8                	mov    %ebx,%eax
+  8044fb:	e8 00 ff ff ff       	call   804400 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  804500:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804503:	5b                   	pop    %ebx
+  804504:	5e                   	pop    %esi
+  804505:	5f                   	pop    %edi
+  804506:	5d                   	pop    %ebp
+  804507:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  804508:	53                   	push   %ebx
+  804509:	68 4f 5d 80 00       	push   $0x805d4f
+  80450e:	68 a2 00 00 00       	push   $0xa2
+  804513:	68 42 5d 80 00       	push   $0x805d42
+  804518:	e8 7e 07 00 00       	call   804c9b <_panic>
+			panic("free: %p is not allocated", va);
+  80451d:	53                   	push   %ebx
+  80451e:	68 28 5d 80 00       	push   $0x805d28
+  804523:	68 a5 00 00 00       	push   $0xa5
+  804528:	68 42 5d 80 00       	push   $0x805d42
+  80452d:	e8 69 07 00 00       	call   804c9b <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  804532:	89 de                	mov    %ebx,%esi
+  804534:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  80453a:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  804540:	89 c8                	mov    %ecx,%eax
+  804542:	c1 e8 11             	shr    $0x11,%eax
+  804545:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804548:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  80454f:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  804552:	c1 e9 0c             	shr    $0xc,%ecx
+  804555:	b8 01 00 00 00       	mov    $0x1,%eax
+  80455a:	d3 e0                	shl    %cl,%eax
+  80455c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80455f:	85 c7                	test   %eax,%edi
+  804561:	74 1b                	je     80457e <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  804563:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804567:	89 d8                	mov    %ebx,%eax
+  804569:	29 f0                	sub    %esi,%eax
+  80456b:	83 e8 10             	sub    $0x10,%eax
+  80456e:	99                   	cltd
+  80456f:	f7 ff                	idiv   %edi
+  804571:	89 d1                	mov    %edx,%ecx
+  804573:	85 d2                	test   %edx,%edx
+  804575:	75 07                	jne    80457e <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804577:	ba 10 00 00 00       	mov    $0x10,%edx
+  80457c:	eb 18                	jmp    804596 <free+0xda>
+		panic("free: %p is not allocated", va);
+  80457e:	53                   	push   %ebx
+  80457f:	68 28 5d 80 00       	push   $0x805d28
+  804584:	68 ad 00 00 00       	push   $0xad
+  804589:	68 42 5d 80 00       	push   $0x805d42
+  80458e:	e8 08 07 00 00       	call   804c9b <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804593:	83 c1 01             	add    $0x1,%ecx
+  804596:	89 d0                	mov    %edx,%eax
+  804598:	d3 e0                	shl    %cl,%eax
+  80459a:	39 c7                	cmp    %eax,%edi
+  80459c:	7f f5                	jg     804593 <free+0xd7>
+	*(void **) va = s->free;
+  80459e:	8b 46 08             	mov    0x8(%esi),%eax
+  8045a1:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  8045a3:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  8045a6:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  8045aa:	8d 58 01             	lea    0x1(%eax),%ebx
+  8045ad:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  8045b1:	66 85 c0             	test   %ax,%ax
+  8045b4:	74 52                	je     804608 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8045b6:	0f b7 db             	movzwl %bx,%ebx
+  8045b9:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8045bd:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8045c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045c7:	f7 ff                	idiv   %edi
+  8045c9:	39 c3                	cmp    %eax,%ebx
+  8045cb:	0f 85 2f ff ff ff    	jne    804500 <free+0x44>
+  8045d1:	8b 46 04             	mov    0x4(%esi),%eax
+  8045d4:	85 c0                	test   %eax,%eax
+  8045d6:	74 53                	je     80462b <free+0x16f>
+		s->prev->next = s->next;
+  8045d8:	8b 16                	mov    (%esi),%edx
+  8045da:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8045dc:	8b 06                	mov    (%esi),%eax
+  8045de:	85 c0                	test   %eax,%eax
+  8045e0:	74 06                	je     8045e8 <free+0x12c>
+		s->next->prev = s->prev;
+  8045e2:	8b 56 04             	mov    0x4(%esi),%edx
+  8045e5:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8045e8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8045eb:	f7 d0                	not    %eax
+  8045ed:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8045f0:	21 d0                	and    %edx,%eax
+  8045f2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8045f5:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  8045fc:	89 f0                	mov    %esi,%eax
+  8045fe:	e8 fd fd ff ff       	call   804400 <heap_free_pages>
+  804603:	e9 f8 fe ff ff       	jmp    804500 <free+0x44>
+	s->prev = NULL;
+  804608:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  80460f:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  804616:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  804618:	85 c0                	test   %eax,%eax
+  80461a:	74 03                	je     80461f <free+0x163>
+		slabs[c]->prev = s;
+  80461c:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  80461f:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  804626:	e9 d5 fe ff ff       	jmp    804500 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  80462b:	8b 06                	mov    (%esi),%eax
+  80462d:	85 c0                	test   %eax,%eax
+  80462f:	0f 84 cb fe ff ff    	je     804500 <free+0x44>
+		slabs[c] = s->next;
+  804635:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  80463c:	8b 06                	mov    (%esi),%eax
+  80463e:	eb a2                	jmp    8045e2 <free+0x126>
+
+00804640 <heap_alloc_pages>:
+{
+  804640:	55                   	push   %ebp
+  804641:	89 e5                	mov    %esp,%ebp
+  804643:	57                   	push   %edi
+  804644:	56                   	push   %esi
+  804645:	53                   	push   %ebx
+  804646:	83 ec 18             	sub    $0x18,%esp
+  804649:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  80464b:	50                   	push   %eax
+  80464c:	e8 15 03 00 00       	call   804966 <va_alloc>
+  804651:	89 c3                	mov    %eax,%ebx
+  804653:	83 c4 10             	add    $0x10,%esp
+  804656:	85 c0                	test   %eax,%eax
+  804658:	74 47                	je     8046a1 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  80465a:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804660:	89 c1                	mov    %eax,%ecx
+  804662:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  804665:	c1 e8 11             	shr    $0x11,%eax
+  804668:	ba 01 00 00 00       	mov    $0x1,%edx
+  80466d:	89 d7                	mov    %edx,%edi
+  80466f:	d3 e7                	shl    %cl,%edi
+  804671:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  804678:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  80467c:	89 c8                	mov    %ecx,%eax
+  80467e:	c1 e8 05             	shr    $0x5,%eax
+  804681:	d3 e2                	shl    %cl,%edx
+  804683:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  80468a:	83 ec 0c             	sub    $0xc,%esp
+  80468d:	6a 00                	push   $0x0
+  80468f:	6a 07                	push   $0x7
+  804691:	56                   	push   %esi
+  804692:	53                   	push   %ebx
+  804693:	6a 00                	push   $0x0
+  804695:	e8 3a f7 ff ff       	call   803dd4 <page_alloc_range>
+  80469a:	83 c4 20             	add    $0x20,%esp
+  80469d:	85 c0                	test   %eax,%eax
+  80469f:	78 0a                	js     8046ab <heap_alloc_pages+0x6b>
+}
+  8046a1:	89 d8                	mov    %ebx,%eax
+  8046a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046a6:	5b                   	pop    %ebx
+  8046a7:	5e                   	pop    %esi
+  8046a8:	5f                   	pop    %edi
+  8046a9:	5d                   	pop    %ebp
+  8046aa:	c3                   	ret
+		free(va);
+  8046ab:	83 ec 0c             	sub    $0xc,%esp
+  8046ae:	53                   	push   %ebx
+  8046af:	e8 08 fe ff ff       	call   8044bc <free>
+		return NULL;
+  8046b4:	83 c4 10             	add    $0x10,%esp
+  8046b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8046bc:	eb e3                	jmp    8046a1 <heap_alloc_pages+0x61>
+
+008046be <malloc>:
+{
+  8046be:	55                   	push   %ebp
+  8046bf:	89 e5                	mov    %esp,%ebp
+  8046c1:	57                   	push   %edi
+  8046c2:	56                   	push   %esi
+  8046c3:	53                   	push   %ebx
+  8046c4:	83 ec 1c             	sub    $0x1c,%esp
+  8046c7:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  8046ca:	8d 50 ff             	lea    -0x1(%eax),%edx
+  8046cd:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  8046d3:	0f 87 21 01 00 00    	ja     8047fa <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8046d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8046de:	ba 10 00 00 00       	mov    $0x10,%edx
+  8046e3:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  8046e5:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8046ea:	76 15                	jbe    804701 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  8046ec:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8046f1:	c1 e8 0c             	shr    $0xc,%eax
+  8046f4:	e8 47 ff ff ff       	call   804640 <heap_alloc_pages>
+  8046f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8046fc:	eb 37                	jmp    804735 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8046fe:	83 c1 01             	add    $0x1,%ecx
+  804701:	89 d6                	mov    %edx,%esi
+  804703:	d3 e6                	shl    %cl,%esi
+  804705:	39 c6                	cmp    %eax,%esi
+  804707:	72 f5                	jb     8046fe <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804709:	89 cb                	mov    %ecx,%ebx
+  80470b:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  804712:	85 ff                	test   %edi,%edi
+  804714:	74 2a                	je     804740 <malloc+0x82>
+	v = s->free;
+  804716:	8b 47 08             	mov    0x8(%edi),%eax
+  804719:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  80471c:	8b 00                	mov    (%eax),%eax
+  80471e:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  804721:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  804725:	83 e8 01             	sub    $0x1,%eax
+  804728:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  80472c:	66 85 c0             	test   %ax,%ax
+  80472f:	0f 84 9a 00 00 00    	je     8047cf <malloc+0x111>
+}
+  804735:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804738:	83 c4 1c             	add    $0x1c,%esp
+  80473b:	5b                   	pop    %ebx
+  80473c:	5e                   	pop    %esi
+  80473d:	5f                   	pop    %edi
+  80473e:	5d                   	pop    %ebp
+  80473f:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  804740:	b8 01 00 00 00       	mov    $0x1,%eax
+  804745:	e8 f6 fe ff ff       	call   804640 <heap_alloc_pages>
+  80474a:	89 c1                	mov    %eax,%ecx
+  80474c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80474f:	85 c0                	test   %eax,%eax
+  804751:	74 e2                	je     804735 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804753:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  804759:	89 c8                	mov    %ecx,%eax
+  80475b:	c1 e8 11             	shr    $0x11,%eax
+  80475e:	c1 e9 0c             	shr    $0xc,%ecx
+  804761:	ba 01 00 00 00       	mov    $0x1,%edx
+  804766:	d3 e2                	shl    %cl,%edx
+  804768:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  80476f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804772:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  804776:	0f b7 f6             	movzwl %si,%esi
+  804779:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80477e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804783:	f7 fe                	idiv   %esi
+  804785:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804789:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  80478c:	85 c0                	test   %eax,%eax
+  80478e:	74 14                	je     8047a4 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  804790:	83 e8 01             	sub    $0x1,%eax
+  804793:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804797:	0f af d0             	imul   %eax,%edx
+  80479a:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  80479e:	89 3a                	mov    %edi,(%edx)
+  8047a0:	89 d7                	mov    %edx,%edi
+  8047a2:	eb e5                	jmp    804789 <malloc+0xcb>
+	s->prev = NULL;
+  8047a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8047a7:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  8047ae:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  8047b5:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  8047b7:	85 c0                	test   %eax,%eax
+  8047b9:	74 03                	je     8047be <malloc+0x100>
+		slabs[c]->prev = s;
+  8047bb:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  8047be:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8047c1:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  8047c8:	89 c7                	mov    %eax,%edi
+  8047ca:	e9 47 ff ff ff       	jmp    804716 <malloc+0x58>
+	if (s->prev)
+  8047cf:	8b 47 04             	mov    0x4(%edi),%eax
+  8047d2:	85 c0                	test   %eax,%eax
+  8047d4:	74 19                	je     8047ef <malloc+0x131>
+		s->prev->next = s->next;
+  8047d6:	8b 17                	mov    (%edi),%edx
+  8047d8:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8047da:	8b 07                	mov    (%edi),%eax
+  8047dc:	85 c0                	test   %eax,%eax
+  8047de:	0f 84 51 ff ff ff    	je     804735 <malloc+0x77>
+		s->next->prev = s->prev;
+  8047e4:	8b 57 04             	mov    0x4(%edi),%edx
+  8047e7:	89 50 04             	mov    %edx,0x4(%eax)
+  8047ea:	e9 46 ff ff ff       	jmp    804735 <malloc+0x77>
+		slabs[c] = s->next;
+  8047ef:	8b 07                	mov    (%edi),%eax
+  8047f1:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  8047f8:	eb e0                	jmp    8047da <malloc+0x11c>
+		return NULL;
+  8047fa:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804801:	e9 2f ff ff ff       	jmp    804735 <malloc+0x77>
+
+00804806 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804806:	55                   	push   %ebp
+  804807:	89 e5                	mov    %esp,%ebp
+  804809:	57                   	push   %edi
+  80480a:	56                   	push   %esi
+  80480b:	53                   	push   %ebx
+  80480c:	83 ec 0c             	sub    $0xc,%esp
+  80480f:	89 c6                	mov    %eax,%esi
+  804811:	89 d7                	mov    %edx,%edi
+  804813:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804816:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80481b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804820:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  804825:	83 ef 01             	sub    $0x1,%edi
+  804828:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  80482b:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  80482e:	eb 34                	jmp    804864 <va_chunk_scan+0x5e>
+			i += 31;
+  804830:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  804833:	89 ca                	mov    %ecx,%edx
+			continue;
+  804835:	eb 23                	jmp    80485a <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804837:	89 c7                	mov    %eax,%edi
+  804839:	c1 ef 05             	shr    $0x5,%edi
+  80483c:	be 01 00 00 00       	mov    $0x1,%esi
+  804841:	d3 e6                	shl    %cl,%esi
+  804843:	89 f1                	mov    %esi,%ecx
+  804845:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804848:	23 0c be             	and    (%esi,%edi,4),%ecx
+  80484b:	75 41                	jne    80488e <va_chunk_scan+0x88>
+			len++;
+  80484d:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804850:	39 d3                	cmp    %edx,%ebx
+  804852:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  804855:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  804858:	72 2d                	jb     804887 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  80485a:	83 c0 01             	add    $0x1,%eax
+  80485d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804862:	77 31                	ja     804895 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  804864:	89 c1                	mov    %eax,%ecx
+  804866:	83 e1 1f             	and    $0x1f,%ecx
+  804869:	75 cc                	jne    804837 <va_chunk_scan+0x31>
+  80486b:	89 c7                	mov    %eax,%edi
+  80486d:	c1 ef 05             	shr    $0x5,%edi
+  804870:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804873:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804876:	83 ff ff             	cmp    $0xffffffff,%edi
+  804879:	74 b5                	je     804830 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  80487b:	85 ff                	test   %edi,%edi
+  80487d:	75 b8                	jne    804837 <va_chunk_scan+0x31>
+			i += 31;
+  80487f:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804882:	83 c2 20             	add    $0x20,%edx
+  804885:	eb c9                	jmp    804850 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804887:	83 c0 01             	add    $0x1,%eax
+  80488a:	29 d0                	sub    %edx,%eax
+  80488c:	eb 15                	jmp    8048a3 <va_chunk_scan+0x9d>
+			len = 0;
+  80488e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804893:	eb c5                	jmp    80485a <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804895:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  80489a:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  80489d:	85 d2                	test   %edx,%edx
+  80489f:	74 02                	je     8048a3 <va_chunk_scan+0x9d>
+		*run_store = best;
+  8048a1:	89 1a                	mov    %ebx,(%edx)
+}
+  8048a3:	83 c4 0c             	add    $0xc,%esp
+  8048a6:	5b                   	pop    %ebx
+  8048a7:	5e                   	pop    %esi
+  8048a8:	5f                   	pop    %edi
+  8048a9:	5d                   	pop    %ebp
+  8048aa:	c3                   	ret
+
+008048ab <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  8048ab:	55                   	push   %ebp
+  8048ac:	89 e5                	mov    %esp,%ebp
+  8048ae:	57                   	push   %edi
+  8048af:	56                   	push   %esi
+  8048b0:	53                   	push   %ebx
+  8048b1:	83 ec 14             	sub    $0x14,%esp
+  8048b4:	89 c3                	mov    %eax,%ebx
+  8048b6:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  8048b8:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  8048be:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  8048c4:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  8048c7:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  8048ca:	89 d6                	mov    %edx,%esi
+  8048cc:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  8048d2:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  8048d4:	eb 34                	jmp    80490a <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  8048d6:	89 c8                	mov    %ecx,%eax
+  8048d8:	c1 e8 05             	shr    $0x5,%eax
+  8048db:	89 da                	mov    %ebx,%edx
+  8048dd:	c1 e2 05             	shl    $0x5,%edx
+  8048e0:	01 da                	add    %ebx,%edx
+  8048e2:	01 c2                	add    %eax,%edx
+  8048e4:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8048e9:	d3 c0                	rol    %cl,%eax
+  8048eb:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  8048f2:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  8048f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8048fe:	01 d0                	add    %edx,%eax
+  804900:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804907:	83 c1 01             	add    $0x1,%ecx
+  80490a:	39 f9                	cmp    %edi,%ecx
+  80490c:	74 30                	je     80493e <va_chunk_mark+0x93>
+		if (alloc)
+  80490e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804912:	74 c2                	je     8048d6 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804914:	89 c8                	mov    %ecx,%eax
+  804916:	c1 e8 05             	shr    $0x5,%eax
+  804919:	89 da                	mov    %ebx,%edx
+  80491b:	c1 e2 05             	shl    $0x5,%edx
+  80491e:	01 da                	add    %ebx,%edx
+  804920:	01 c2                	add    %eax,%edx
+  804922:	b8 01 00 00 00       	mov    $0x1,%eax
+  804927:	d3 e0                	shl    %cl,%eax
+  804929:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804930:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804937:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80493c:	eb c0                	jmp    8048fe <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  80493e:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804941:	ba 00 00 00 00       	mov    $0x0,%edx
+  804946:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804949:	e8 b8 fe ff ff       	call   804806 <va_chunk_scan>
+	ch->run = run;
+  80494e:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804954:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804957:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  80495e:	83 c4 14             	add    $0x14,%esp
+  804961:	5b                   	pop    %ebx
+  804962:	5e                   	pop    %esi
+  804963:	5f                   	pop    %edi
+  804964:	5d                   	pop    %ebp
+  804965:	c3                   	ret
+
+00804966 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804966:	55                   	push   %ebp
+  804967:	89 e5                	mov    %esp,%ebp
+  804969:	57                   	push   %edi
+  80496a:	56                   	push   %esi
+  80496b:	53                   	push   %ebx
+  80496c:	83 ec 04             	sub    $0x4,%esp
+  80496f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804972:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  804977:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  80497c:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  804983:	74 4f                	je     8049d4 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804985:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804988:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  80498d:	0f 87 01 01 00 00    	ja     804a94 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804993:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804999:	0f 87 80 00 00 00    	ja     804a1f <va_alloc+0xb9>
+  80499f:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  8049a4:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  8049a9:	0f b7 10             	movzwl (%eax),%edx
+  8049ac:	05 84 00 00 00       	add    $0x84,%eax
+  8049b1:	39 da                	cmp    %ebx,%edx
+  8049b3:	73 2c                	jae    8049e1 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  8049b5:	83 c6 01             	add    $0x1,%esi
+  8049b8:	83 fe 1c             	cmp    $0x1c,%esi
+  8049bb:	75 ec                	jne    8049a9 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  8049bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049c2:	eb 53                	jmp    804a17 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  8049c4:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  8049ca:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  8049cf:	05 84 00 00 00       	add    $0x84,%eax
+  8049d4:	39 d0                	cmp    %edx,%eax
+  8049d6:	75 ec                	jne    8049c4 <va_alloc+0x5e>
+	va_inited = 1;
+  8049d8:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  8049df:	eb a4                	jmp    804985 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  8049e1:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  8049e7:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  8049ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8049f1:	89 da                	mov    %ebx,%edx
+  8049f3:	e8 0e fe ff ff       	call   804806 <va_chunk_scan>
+  8049f8:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  8049fa:	6a 01                	push   $0x1
+  8049fc:	89 d9                	mov    %ebx,%ecx
+  8049fe:	89 c2                	mov    %eax,%edx
+  804a00:	89 f0                	mov    %esi,%eax
+  804a02:	e8 a4 fe ff ff       	call   8048ab <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804a07:	c1 e6 16             	shl    $0x16,%esi
+  804a0a:	c1 e7 0c             	shl    $0xc,%edi
+  804a0d:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804a14:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804a17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a1a:	5b                   	pop    %ebx
+  804a1b:	5e                   	pop    %esi
+  804a1c:	5f                   	pop    %edi
+  804a1d:	5d                   	pop    %ebp
+  804a1e:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804a1f:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804a25:	c1 ee 0a             	shr    $0xa,%esi
+  804a28:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a32:	eb 0a                	jmp    804a3e <va_alloc+0xd8>
+			first = c + 1;
+  804a34:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804a36:	83 c2 01             	add    $0x1,%edx
+  804a39:	83 fa 1d             	cmp    $0x1d,%edx
+  804a3c:	74 4f                	je     804a8d <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804a3e:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804a44:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  804a4b:	00 04 
+  804a4d:	75 e5                	jne    804a34 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804a4f:	89 d1                	mov    %edx,%ecx
+  804a51:	29 c1                	sub    %eax,%ecx
+  804a53:	39 f1                	cmp    %esi,%ecx
+  804a55:	75 df                	jne    804a36 <va_alloc+0xd0>
+  804a57:	89 c7                	mov    %eax,%edi
+  804a59:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804a5c:	be 00 04 00 00       	mov    $0x400,%esi
+  804a61:	39 f3                	cmp    %esi,%ebx
+  804a63:	0f 46 f3             	cmovbe %ebx,%esi
+  804a66:	6a 01                	push   $0x1
+  804a68:	89 f1                	mov    %esi,%ecx
+  804a6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a6f:	89 f8                	mov    %edi,%eax
+  804a71:	e8 35 fe ff ff       	call   8048ab <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804a76:	83 c7 01             	add    $0x1,%edi
+  804a79:	83 c4 04             	add    $0x4,%esp
+  804a7c:	29 f3                	sub    %esi,%ebx
+  804a7e:	75 dc                	jne    804a5c <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804a80:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804a83:	c1 e0 16             	shl    $0x16,%eax
+  804a86:	05 00 00 00 08       	add    $0x8000000,%eax
+  804a8b:	eb 8a                	jmp    804a17 <va_alloc+0xb1>
+	return NULL;
+  804a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a92:	eb 83                	jmp    804a17 <va_alloc+0xb1>
+		return NULL;
+  804a94:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a99:	e9 79 ff ff ff       	jmp    804a17 <va_alloc+0xb1>
+
+00804a9e <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804a9e:	55                   	push   %ebp
+  804a9f:	89 e5                	mov    %esp,%ebp
+  804aa1:	57                   	push   %edi
+  804aa2:	56                   	push   %esi
+  804aa3:	53                   	push   %ebx
+  804aa4:	83 ec 0c             	sub    $0xc,%esp
+  804aa7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804aaa:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804aad:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804ab3:	76 21                	jbe    804ad6 <va_free+0x38>
+  804ab5:	89 f0                	mov    %esi,%eax
+  804ab7:	c1 e0 0c             	shl    $0xc,%eax
+  804aba:	01 f8                	add    %edi,%eax
+  804abc:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804ac1:	77 13                	ja     804ad6 <va_free+0x38>
+	    || PGOFF(va))
+  804ac3:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804ac9:	75 0b                	jne    804ad6 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804acb:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804ad1:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804ad4:	eb 45                	jmp    804b1b <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804ad6:	83 ec 0c             	sub    $0xc,%esp
+  804ad9:	56                   	push   %esi
+  804ada:	57                   	push   %edi
+  804adb:	68 6c 5d 80 00       	push   $0x805d6c
+  804ae0:	68 8e 00 00 00       	push   $0x8e
+  804ae5:	68 8c 5d 80 00       	push   $0x805d8c
+  804aea:	e8 ac 01 00 00       	call   804c9b <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804aef:	89 fa                	mov    %edi,%edx
+  804af1:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804af7:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804afc:	29 d3                	sub    %edx,%ebx
+  804afe:	39 f3                	cmp    %esi,%ebx
+  804b00:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804b03:	89 f8                	mov    %edi,%eax
+  804b05:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804b08:	83 ec 0c             	sub    $0xc,%esp
+  804b0b:	6a 00                	push   $0x0
+  804b0d:	89 d9                	mov    %ebx,%ecx
+  804b0f:	e8 97 fd ff ff       	call   8048ab <va_chunk_mark>
+		i += n;
+  804b14:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804b16:	29 de                	sub    %ebx,%esi
+  804b18:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804b1b:	85 f6                	test   %esi,%esi
+  804b1d:	75 d0                	jne    804aef <va_free+0x51>
+	}
+}
+  804b1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b22:	5b                   	pop    %ebx
+  804b23:	5e                   	pop    %esi
+  804b24:	5f                   	pop    %edi
+  804b25:	5d                   	pop    %ebp
+  804b26:	c3                   	ret
+
+00804b27 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b2c:	c3                   	ret
+
+00804b2d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804b2d:	55                   	push   %ebp
+  804b2e:	89 e5                	mov    %esp,%ebp
+  804b30:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804b33:	68 99 5d 80 00       	push   $0x805d99
+  804b38:	ff 75 0c             	push   0xc(%ebp)
+  804b3b:	e8 82 bc ff ff       	call   8007c2 <strcpy>
+	return 0;
+}
+  804b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b45:	c9                   	leave
+  804b46:	c3                   	ret
+
+00804b47 <devcons_write>:
+{
+  804b47:	55                   	push   %ebp
+  804b48:	89 e5                	mov    %esp,%ebp
+  804b4a:	57                   	push   %edi
+  804b4b:	56                   	push   %esi
+  804b4c:	53                   	push   %ebx
+  804b4d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804b53:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804b58:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804b5e:	eb 2e                	jmp    804b8e <devcons_write+0x47>
+		m = n - tot;
+  804b60:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804b63:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804b65:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804b6a:	39 c3                	cmp    %eax,%ebx
+  804b6c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804b6f:	83 ec 04             	sub    $0x4,%esp
+  804b72:	53                   	push   %ebx
+  804b73:	89 f0                	mov    %esi,%eax
+  804b75:	03 45 0c             	add    0xc(%ebp),%eax
+  804b78:	50                   	push   %eax
+  804b79:	57                   	push   %edi
+  804b7a:	e8 c9 bd ff ff       	call   800948 <memmove>
+		sys_cputs(buf, m);
+  804b7f:	83 c4 08             	add    $0x8,%esp
+  804b82:	53                   	push   %ebx
+  804b83:	57                   	push   %edi
+  804b84:	e8 5f c0 ff ff       	call   800be8 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804b89:	01 de                	add    %ebx,%esi
+  804b8b:	83 c4 10             	add    $0x10,%esp
+  804b8e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804b91:	72 cd                	jb     804b60 <devcons_write+0x19>
+}
+  804b93:	89 f0                	mov    %esi,%eax
+  804b95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b98:	5b                   	pop    %ebx
+  804b99:	5e                   	pop    %esi
+  804b9a:	5f                   	pop    %edi
+  804b9b:	5d                   	pop    %ebp
+  804b9c:	c3                   	ret
+
+00804b9d <devcons_read>:
+{
+  804b9d:	55                   	push   %ebp
+  804b9e:	89 e5                	mov    %esp,%ebp
+  804ba0:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804ba3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ba8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804bac:	75 07                	jne    804bb5 <devcons_read+0x18>
+  804bae:	eb 1f                	jmp    804bcf <devcons_read+0x32>
+		sys_yield();
+  804bb0:	e8 e1 c0 ff ff       	call   800c96 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804bb5:	e8 5d c0 ff ff       	call   800c17 <sys_cgetc>
+  804bba:	85 c0                	test   %eax,%eax
+  804bbc:	74 f2                	je     804bb0 <devcons_read+0x13>
+	if (c < 0)
+  804bbe:	78 0f                	js     804bcf <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804bc0:	83 f8 04             	cmp    $0x4,%eax
+  804bc3:	74 0c                	je     804bd1 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804bc5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804bc8:	88 02                	mov    %al,(%edx)
+	return 1;
+  804bca:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804bcf:	c9                   	leave
+  804bd0:	c3                   	ret
+		return 0;
+  804bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bd6:	eb f7                	jmp    804bcf <devcons_read+0x32>
+
+00804bd8 <cputchar>:
+{
+  804bd8:	55                   	push   %ebp
+  804bd9:	89 e5                	mov    %esp,%ebp
+  804bdb:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804bde:	8b 45 08             	mov    0x8(%ebp),%eax
+  804be1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804be4:	6a 01                	push   $0x1
+  804be6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804be9:	50                   	push   %eax
+  804bea:	e8 f9 bf ff ff       	call   800be8 <sys_cputs>
+}
+  804bef:	83 c4 10             	add    $0x10,%esp
+  804bf2:	c9                   	leave
+  804bf3:	c3                   	ret
+
+00804bf4 <getchar>:
+{
+  804bf4:	55                   	push   %ebp
+  804bf5:	89 e5                	mov    %esp,%ebp
+  804bf7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804bfa:	6a 01                	push   $0x1
+  804bfc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804bff:	50                   	push   %eax
+  804c00:	6a 00                	push   $0x0
+  804c02:	e8 d7 ce ff ff       	call   801ade <read>
+	if (r < 0)
+  804c07:	83 c4 10             	add    $0x10,%esp
+  804c0a:	85 c0                	test   %eax,%eax
+  804c0c:	78 06                	js     804c14 <getchar+0x20>
+	if (r < 1)
+  804c0e:	74 06                	je     804c16 <getchar+0x22>
+	return c;
+  804c10:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804c14:	c9                   	leave
+  804c15:	c3                   	ret
+		return -E_EOF;
+  804c16:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804c1b:	eb f7                	jmp    804c14 <getchar+0x20>
+
+00804c1d <iscons>:
+{
+  804c1d:	55                   	push   %ebp
+  804c1e:	89 e5                	mov    %esp,%ebp
+  804c20:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804c23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804c26:	50                   	push   %eax
+  804c27:	ff 75 08             	push   0x8(%ebp)
+  804c2a:	e8 50 cc ff ff       	call   80187f <fd_lookup>
+  804c2f:	83 c4 10             	add    $0x10,%esp
+  804c32:	85 c0                	test   %eax,%eax
+  804c34:	78 11                	js     804c47 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804c36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804c39:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804c3f:	39 10                	cmp    %edx,(%eax)
+  804c41:	0f 94 c0             	sete   %al
+  804c44:	0f b6 c0             	movzbl %al,%eax
+}
+  804c47:	c9                   	leave
+  804c48:	c3                   	ret
+
+00804c49 <opencons>:
+{
+  804c49:	55                   	push   %ebp
+  804c4a:	89 e5                	mov    %esp,%ebp
+  804c4c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804c4f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804c52:	50                   	push   %eax
+  804c53:	e8 d3 cb ff ff       	call   80182b <fd_alloc>
+  804c58:	83 c4 10             	add    $0x10,%esp
+  804c5b:	85 c0                	test   %eax,%eax
+  804c5d:	78 3a                	js     804c99 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804c5f:	83 ec 04             	sub    $0x4,%esp
+  804c62:	68 07 04 00 00       	push   $0x407
+  804c67:	ff 75 f4             	push   -0xc(%ebp)
+  804c6a:	6a 00                	push   $0x0
+  804c6c:	e8 44 c0 ff ff       	call   800cb5 <sys_page_alloc>
+  804c71:	83 c4 10             	add    $0x10,%esp
+  804c74:	85 c0                	test   %eax,%eax
+  804c76:	78 21                	js     804c99 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804c78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804c7b:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804c81:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804c83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804c86:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804c8d:	83 ec 0c             	sub    $0xc,%esp
+  804c90:	50                   	push   %eax
+  804c91:	e8 6e cb ff ff       	call   801804 <fd2num>
+  804c96:	83 c4 10             	add    $0x10,%esp
+}
+  804c99:	c9                   	leave
+  804c9a:	c3                   	ret
+
+00804c9b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  804c9b:	55                   	push   %ebp
+  804c9c:	89 e5                	mov    %esp,%ebp
+  804c9e:	56                   	push   %esi
+  804c9f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  804ca0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  804ca3:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  804ca9:	e8 c9 bf ff ff       	call   800c77 <sys_getenvid>
+  804cae:	83 ec 0c             	sub    $0xc,%esp
+  804cb1:	ff 75 0c             	push   0xc(%ebp)
+  804cb4:	ff 75 08             	push   0x8(%ebp)
+  804cb7:	56                   	push   %esi
+  804cb8:	50                   	push   %eax
+  804cb9:	68 a8 5d 80 00       	push   $0x805da8
+  804cbe:	e8 18 b5 ff ff       	call   8001db <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  804cc3:	83 c4 18             	add    $0x18,%esp
+  804cc6:	53                   	push   %ebx
+  804cc7:	ff 75 10             	push   0x10(%ebp)
+  804cca:	e8 bb b4 ff ff       	call   80018a <vcprintf>
+	cprintf("\n");
+  804ccf:	c7 04 24 cf 52 80 00 	movl   $0x8052cf,(%esp)
+  804cd6:	e8 00 b5 ff ff       	call   8001db <cprintf>
+  804cdb:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  804cde:	cc                   	int3
+	while (1)
+  804cdf:	eb fd                	jmp    804cde <_panic+0x43>
+
+00804ce1 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804ce1:	55                   	push   %ebp
+  804ce2:	89 e5                	mov    %esp,%ebp
+  804ce4:	56                   	push   %esi
+  804ce5:	53                   	push   %ebx
+  804ce6:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804ce9:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  804cee:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804cf1:	85 db                	test   %ebx,%ebx
+  804cf3:	78 17                	js     804d0c <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804cf5:	83 ec 0c             	sub    $0xc,%esp
+  804cf8:	56                   	push   %esi
+  804cf9:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  804d00:	83 c4 10             	add    $0x10,%esp
+  804d03:	85 c0                	test   %eax,%eax
+  804d05:	75 27                	jne    804d2e <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804d07:	83 eb 01             	sub    $0x1,%ebx
+  804d0a:	eb e5                	jmp    804cf1 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804d0c:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804d11:	8b 40 48             	mov    0x48(%eax),%eax
+  804d14:	83 ec 08             	sub    $0x8,%esp
+  804d17:	ff 76 28             	push   0x28(%esi)
+  804d1a:	ff 36                	push   (%esi)
+  804d1c:	50                   	push   %eax
+  804d1d:	68 cc 5d 80 00       	push   $0x805dcc
+  804d22:	6a 1d                	push   $0x1d
+  804d24:	68 ef 5d 80 00       	push   $0x805def
+  804d29:	e8 6d ff ff ff       	call   804c9b <_panic>
+}
+  804d2e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804d31:	5b                   	pop    %ebx
+  804d32:	5e                   	pop    %esi
+  804d33:	5d                   	pop    %ebp
+  804d34:	c3                   	ret
+
+00804d35 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804d35:	55                   	push   %ebp
+  804d36:	89 e5                	mov    %esp,%ebp
+  804d38:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804d3b:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  804d42:	74 0a                	je     804d4e <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804d44:	8b 45 08             	mov    0x8(%ebp),%eax
+  804d47:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  804d4c:	c9                   	leave
+  804d4d:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804d4e:	83 ec 04             	sub    $0x4,%esp
+  804d51:	6a 07                	push   $0x7
+  804d53:	68 00 f0 bf ee       	push   $0xeebff000
+  804d58:	6a 00                	push   $0x0
+  804d5a:	e8 56 bf ff ff       	call   800cb5 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804d5f:	83 c4 08             	add    $0x8,%esp
+  804d62:	68 d5 4d 80 00       	push   $0x804dd5
+  804d67:	6a 00                	push   $0x0
+  804d69:	e8 ad c2 ff ff       	call   80101b <sys_env_set_pgfault_upcall>
+  804d6e:	83 c4 10             	add    $0x10,%esp
+  804d71:	eb d1                	jmp    804d44 <set_pgfault_handler+0xf>
+
+00804d73 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804d73:	55                   	push   %ebp
+  804d74:	89 e5                	mov    %esp,%ebp
+  804d76:	83 ec 08             	sub    $0x8,%esp
+  804d79:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  804d7c:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  804d82:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d87:	eb 03                	jmp    804d8c <add_pgfault_handler+0x19>
+  804d89:	83 c0 01             	add    $0x1,%eax
+  804d8c:	39 d0                	cmp    %edx,%eax
+  804d8e:	74 0b                	je     804d9b <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804d90:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  804d97:	75 f0                	jne    804d89 <add_pgfault_handler+0x16>
+  804d99:	eb 24                	jmp    804dbf <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  804d9b:	83 fa 0a             	cmp    $0xa,%edx
+  804d9e:	74 21                	je     804dc1 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  804da0:	8d 42 01             	lea    0x1(%edx),%eax
+  804da3:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  804da8:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  804daf:	83 ec 0c             	sub    $0xc,%esp
+  804db2:	68 e1 4c 80 00       	push   $0x804ce1
+  804db7:	e8 79 ff ff ff       	call   804d35 <set_pgfault_handler>
+  804dbc:	83 c4 10             	add    $0x10,%esp
+}
+  804dbf:	c9                   	leave
+  804dc0:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  804dc1:	83 ec 04             	sub    $0x4,%esp
+  804dc4:	68 fd 5d 80 00       	push   $0x805dfd
+  804dc9:	6a 44                	push   $0x44
+  804dcb:	68 ef 5d 80 00       	push   $0x805def
+  804dd0:	e8 c6 fe ff ff       	call   804c9b <_panic>
+
+00804dd5 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804dd5:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804dd6:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  804ddb:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804ddd:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  804de0:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  804de4:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  804de8:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  804deb:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  804ded:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  804df1:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  804df4:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  804df5:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  804df8:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  804df9:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  804dfa:	c3                   	ret
+
+00804dfb <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  804dfb:	55                   	push   %ebp
+  804dfc:	89 e5                	mov    %esp,%ebp
+  804dfe:	57                   	push   %edi
+  804dff:	56                   	push   %esi
+  804e00:	53                   	push   %ebx
+  804e01:	83 ec 14             	sub    $0x14,%esp
+  804e04:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804e07:	8b 75 14             	mov    0x14(%ebp),%esi
+  804e0a:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804e0d:	ff 75 10             	push   0x10(%ebp)
+  804e10:	ff 75 0c             	push   0xc(%ebp)
+  804e13:	e8 c0 c2 ff ff       	call   8010d8 <sys_ipc_recv_pages>
+  804e18:	83 c4 10             	add    $0x10,%esp
+  804e1b:	85 c0                	test   %eax,%eax
+  804e1d:	78 46                	js     804e65 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804e1f:	85 ff                	test   %edi,%edi
+  804e21:	74 0d                	je     804e30 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804e23:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804e28:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804e2e:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804e30:	85 f6                	test   %esi,%esi
+  804e32:	74 0d                	je     804e41 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804e34:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804e39:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804e3f:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804e41:	85 db                	test   %ebx,%ebx
+  804e43:	74 0d                	je     804e52 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804e45:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804e4a:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804e50:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804e52:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804e57:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804e5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804e60:	5b                   	pop    %ebx
+  804e61:	5e                   	pop    %esi
+  804e62:	5f                   	pop    %edi
+  804e63:	5d                   	pop    %ebp
+  804e64:	c3                   	ret
+		if (from_env_store) {
+  804e65:	85 ff                	test   %edi,%edi
+  804e67:	74 06                	je     804e6f <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  804e69:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804e6f:	85 f6                	test   %esi,%esi
+  804e71:	74 06                	je     804e79 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804e73:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804e79:	85 db                	test   %ebx,%ebx
+  804e7b:	74 e0                	je     804e5d <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  804e7d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804e83:	eb d8                	jmp    804e5d <ipc_recv_pages+0x62>
+
+00804e85 <ipc_recv>:
+{
+  804e85:	55                   	push   %ebp
+  804e86:	89 e5                	mov    %esp,%ebp
+  804e88:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  804e8b:	6a 00                	push   $0x0
+  804e8d:	ff 75 10             	push   0x10(%ebp)
+  804e90:	6a 01                	push   $0x1
+  804e92:	ff 75 0c             	push   0xc(%ebp)
+  804e95:	ff 75 08             	push   0x8(%ebp)
+  804e98:	e8 5e ff ff ff       	call   804dfb <ipc_recv_pages>
+}
+  804e9d:	c9                   	leave
+  804e9e:	c3                   	ret
+
+00804e9f <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804e9f:	55                   	push   %ebp
+  804ea0:	89 e5                	mov    %esp,%ebp
+  804ea2:	56                   	push   %esi
+  804ea3:	53                   	push   %ebx
+  804ea4:	8b 75 08             	mov    0x8(%ebp),%esi
+  804ea7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  804eaa:	83 ec 0c             	sub    $0xc,%esp
+  804ead:	ff 75 0c             	push   0xc(%ebp)
+  804eb0:	e8 57 c3 ff ff       	call   80120c <sys_ipc_try_recv>
+  804eb5:	83 c4 10             	add    $0x10,%esp
+  804eb8:	85 c0                	test   %eax,%eax
+  804eba:	78 34                	js     804ef0 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804ebc:	85 f6                	test   %esi,%esi
+  804ebe:	74 0d                	je     804ecd <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  804ec0:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804ec5:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804ecb:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  804ecd:	85 db                	test   %ebx,%ebx
+  804ecf:	74 0d                	je     804ede <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  804ed1:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804ed6:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804edc:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804ede:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804ee3:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804ee9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804eec:	5b                   	pop    %ebx
+  804eed:	5e                   	pop    %esi
+  804eee:	5d                   	pop    %ebp
+  804eef:	c3                   	ret
+		if (from_env_store) {
+  804ef0:	85 f6                	test   %esi,%esi
+  804ef2:	74 06                	je     804efa <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  804ef4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  804efa:	85 db                	test   %ebx,%ebx
+  804efc:	74 eb                	je     804ee9 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  804efe:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804f04:	eb e3                	jmp    804ee9 <ipc_try_recv+0x4a>
+
+00804f06 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804f06:	55                   	push   %ebp
+  804f07:	89 e5                	mov    %esp,%ebp
+  804f09:	83 ec 14             	sub    $0x14,%esp
+  804f0c:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804f0f:	85 c0                	test   %eax,%eax
+  804f11:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804f16:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804f19:	ff 75 18             	push   0x18(%ebp)
+  804f1c:	ff 75 14             	push   0x14(%ebp)
+  804f1f:	50                   	push   %eax
+  804f20:	ff 75 0c             	push   0xc(%ebp)
+  804f23:	ff 75 08             	push   0x8(%ebp)
+  804f26:	e8 70 c1 ff ff       	call   80109b <sys_ipc_send_pages>
+  804f2b:	83 c4 20             	add    $0x20,%esp
+  804f2e:	85 c0                	test   %eax,%eax
+  804f30:	78 02                	js     804f34 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804f32:	c9                   	leave
+  804f33:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804f34:	50                   	push   %eax
+  804f35:	68 18 5e 80 00       	push   $0x805e18
+  804f3a:	68 80 00 00 00       	push   $0x80
+  804f3f:	68 44 5e 80 00       	push   $0x805e44
+  804f44:	e8 52 fd ff ff       	call   804c9b <_panic>
+
+00804f49 <ipc_send>:
+{
+  804f49:	55                   	push   %ebp
+  804f4a:	89 e5                	mov    %esp,%ebp
+  804f4c:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  804f4f:	ff 75 14             	push   0x14(%ebp)
+  804f52:	6a 01                	push   $0x1
+  804f54:	ff 75 10             	push   0x10(%ebp)
+  804f57:	ff 75 0c             	push   0xc(%ebp)
+  804f5a:	ff 75 08             	push   0x8(%ebp)
+  804f5d:	e8 a4 ff ff ff       	call   804f06 <ipc_send_pages>
+}
+  804f62:	83 c4 20             	add    $0x20,%esp
+  804f65:	c9                   	leave
+  804f66:	c3                   	ret
+
+00804f67 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804f67:	55                   	push   %ebp
+  804f68:	89 e5                	mov    %esp,%ebp
+  804f6a:	83 ec 14             	sub    $0x14,%esp
+  804f6d:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804f70:	85 c0                	test   %eax,%eax
+  804f72:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804f77:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804f7a:	ff 75 18             	push   0x18(%ebp)
+  804f7d:	ff 75 14             	push   0x14(%ebp)
+  804f80:	50                   	push   %eax
+  804f81:	ff 75 0c             	push   0xc(%ebp)
+  804f84:	ff 75 08             	push   0x8(%ebp)
+  804f87:	e8 a0 c1 ff ff       	call   80112c <sys_ipc_call>
+  804f8c:	83 c4 20             	add    $0x20,%esp
+  804f8f:	85 c0                	test   %eax,%eax
+  804f91:	78 0b                	js     804f9e <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  804f93:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804f98:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804f9e:	c9                   	leave
+  804f9f:	c3                   	ret
+
+00804fa0 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  804fa0:	55                   	push   %ebp
+  804fa1:	89 e5                	mov    %esp,%ebp
+  804fa3:	57                   	push   %edi
+  804fa4:	56                   	push   %esi
+  804fa5:	53                   	push   %ebx
+  804fa6:	83 ec 18             	sub    $0x18,%esp
+  804fa9:	8b 45 10             	mov    0x10(%ebp),%eax
+  804fac:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  804faf:	8b 75 20             	mov    0x20(%ebp),%esi
+  804fb2:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804fb5:	85 c0                	test   %eax,%eax
+  804fb7:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804fbc:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804fbf:	ff 75 18             	push   0x18(%ebp)
+  804fc2:	ff 75 14             	push   0x14(%ebp)
+  804fc5:	50                   	push   %eax
+  804fc6:	ff 75 0c             	push   0xc(%ebp)
+  804fc9:	ff 75 08             	push   0x8(%ebp)
+  804fcc:	e8 9c c1 ff ff       	call   80116d <sys_ipc_reply_recv>
+  804fd1:	83 c4 20             	add    $0x20,%esp
+  804fd4:	85 c0                	test   %eax,%eax
+  804fd6:	78 46                	js     80501e <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804fd8:	85 ff                	test   %edi,%edi
+  804fda:	74 0d                	je     804fe9 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  804fdc:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804fe1:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804fe7:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804fe9:	85 f6                	test   %esi,%esi
+  804feb:	74 0d                	je     804ffa <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  804fed:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804ff2:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804ff8:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804ffa:	85 db                	test   %ebx,%ebx
+  804ffc:	74 0d                	je     80500b <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  804ffe:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  805003:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  805009:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80500b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  805010:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  805016:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805019:	5b                   	pop    %ebx
+  80501a:	5e                   	pop    %esi
+  80501b:	5f                   	pop    %edi
+  80501c:	5d                   	pop    %ebp
+  80501d:	c3                   	ret
+		if (from_env_store) {
+  80501e:	85 ff                	test   %edi,%edi
+  805020:	74 06                	je     805028 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  805022:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  805028:	85 f6                	test   %esi,%esi
+  80502a:	74 06                	je     805032 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  80502c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  805032:	85 db                	test   %ebx,%ebx
+  805034:	74 e0                	je     805016 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  805036:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80503c:	eb d8                	jmp    805016 <ipc_reply_recv+0x76>
+
+0080503e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80503e:	55                   	push   %ebp
+  80503f:	89 e5                	mov    %esp,%ebp
+  805041:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  805044:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  805049:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80504c:	c1 e0 06             	shl    $0x6,%eax
+  80504f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805054:	8b 40 50             	mov    0x50(%eax),%eax
+  805057:	39 c8                	cmp    %ecx,%eax
+  805059:	74 12                	je     80506d <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80505b:	83 c2 01             	add    $0x1,%edx
+  80505e:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  805064:	75 e3                	jne    805049 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  805066:	b8 00 00 00 00       	mov    $0x0,%eax
+  80506b:	eb 0e                	jmp    80507b <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80506d:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  805070:	c1 e0 06             	shl    $0x6,%eax
+  805073:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805078:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80507b:	5d                   	pop    %ebp
+  80507c:	c3                   	ret
+
+0080507d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80507d:	55                   	push   %ebp
+  80507e:	89 e5                	mov    %esp,%ebp
+  805080:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805083:	89 c2                	mov    %eax,%edx
+  805085:	c1 ea 16             	shr    $0x16,%edx
+  805088:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80508f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805094:	f6 c1 01             	test   $0x1,%cl
+  805097:	74 1e                	je     8050b7 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  805099:	c1 e8 0c             	shr    $0xc,%eax
+  80509c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8050a3:	a8 01                	test   $0x1,%al
+  8050a5:	74 10                	je     8050b7 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8050a7:	c1 e8 0c             	shr    $0xc,%eax
+  8050aa:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8050ad:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  8050b4:	0f b7 d2             	movzwl %dx,%edx
+}
+  8050b7:	89 d0                	mov    %edx,%eax
+  8050b9:	5d                   	pop    %ebp
+  8050ba:	c3                   	ret
+
+008050bb <udivmod>:
+  8050bb:	55                   	push   %ebp
+  8050bc:	57                   	push   %edi
+  8050bd:	56                   	push   %esi
+  8050be:	53                   	push   %ebx
+  8050bf:	83 ec 24             	sub    $0x24,%esp
+  8050c2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8050c6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8050ca:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8050ce:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8050d2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8050d6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8050da:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8050de:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8050e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050ed:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8050f4:	00 
+  8050f5:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8050fc:	00 
+  8050fd:	89 fb                	mov    %edi,%ebx
+  8050ff:	eb 08                	jmp    805109 <udivmod+0x4e>
+  805101:	83 e9 01             	sub    $0x1,%ecx
+  805104:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  805107:	74 68                	je     805171 <udivmod+0xb6>
+  805109:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80510d:	01 c0                	add    %eax,%eax
+  80510f:	89 c6                	mov    %eax,%esi
+  805111:	89 d7                	mov    %edx,%edi
+  805113:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805117:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80511b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80511e:	d3 ea                	shr    %cl,%edx
+  805120:	f6 c1 20             	test   $0x20,%cl
+  805123:	74 04                	je     805129 <udivmod+0x6e>
+  805125:	89 d0                	mov    %edx,%eax
+  805127:	31 d2                	xor    %edx,%edx
+  805129:	83 e0 01             	and    $0x1,%eax
+  80512c:	89 04 24             	mov    %eax,(%esp)
+  80512f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805136:	00 
+  805137:	8b 04 24             	mov    (%esp),%eax
+  80513a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80513e:	09 f0                	or     %esi,%eax
+  805140:	09 fa                	or     %edi,%edx
+  805142:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805146:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80514a:	39 f0                	cmp    %esi,%eax
+  80514c:	89 d5                	mov    %edx,%ebp
+  80514e:	19 fd                	sbb    %edi,%ebp
+  805150:	72 af                	jb     805101 <udivmod+0x46>
+  805152:	29 f0                	sub    %esi,%eax
+  805154:	19 fa                	sbb    %edi,%edx
+  805156:	89 cf                	mov    %ecx,%edi
+  805158:	c1 ef 05             	shr    $0x5,%edi
+  80515b:	83 e7 01             	and    $0x1,%edi
+  80515e:	89 fe                	mov    %edi,%esi
+  805160:	83 f6 01             	xor    $0x1,%esi
+  805163:	d3 e6                	shl    %cl,%esi
+  805165:	d3 e7                	shl    %cl,%edi
+  805167:	09 74 24 18          	or     %esi,0x18(%esp)
+  80516b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80516f:	eb 90                	jmp    805101 <udivmod+0x46>
+  805171:	85 db                	test   %ebx,%ebx
+  805173:	74 05                	je     80517a <udivmod+0xbf>
+  805175:	89 03                	mov    %eax,(%ebx)
+  805177:	89 53 04             	mov    %edx,0x4(%ebx)
+  80517a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80517e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805182:	83 c4 24             	add    $0x24,%esp
+  805185:	5b                   	pop    %ebx
+  805186:	5e                   	pop    %esi
+  805187:	5f                   	pop    %edi
+  805188:	5d                   	pop    %ebp
+  805189:	c3                   	ret
+
+0080518a <__udivdi3>:
+  80518a:	83 ec 08             	sub    $0x8,%esp
+  80518d:	6a 00                	push   $0x0
+  80518f:	ff 74 24 1c          	push   0x1c(%esp)
+  805193:	ff 74 24 1c          	push   0x1c(%esp)
+  805197:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80519b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80519f:	e8 17 ff ff ff       	call   8050bb <udivmod>
+  8051a4:	83 c4 14             	add    $0x14,%esp
+  8051a7:	c3                   	ret
+
+008051a8 <__umoddi3>:
+  8051a8:	83 ec 18             	sub    $0x18,%esp
+  8051ab:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8051af:	50                   	push   %eax
+  8051b0:	ff 74 24 2c          	push   0x2c(%esp)
+  8051b4:	ff 74 24 2c          	push   0x2c(%esp)
+  8051b8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8051bc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8051c0:	e8 f6 fe ff ff       	call   8050bb <udivmod>
+  8051c5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8051c9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8051cd:	83 c4 24             	add    $0x24,%esp
+  8051d0:	c3                   	ret
+
+008051d1 <__divdi3>:
+  8051d1:	55                   	push   %ebp
+  8051d2:	57                   	push   %edi
+  8051d3:	56                   	push   %esi
+  8051d4:	53                   	push   %ebx
+  8051d5:	83 ec 10             	sub    $0x10,%esp
+  8051d8:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8051dc:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8051e0:	89 c6                	mov    %eax,%esi
+  8051e2:	89 d7                	mov    %edx,%edi
+  8051e4:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8051e8:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8051ec:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8051f0:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8051f4:	89 c5                	mov    %eax,%ebp
+  8051f6:	f7 dd                	neg    %ebp
+  8051f8:	89 d6                	mov    %edx,%esi
+  8051fa:	83 d6 00             	adc    $0x0,%esi
+  8051fd:	f7 de                	neg    %esi
+  8051ff:	0f 48 e8             	cmovs  %eax,%ebp
+  805202:	0f 49 d6             	cmovns %esi,%edx
+  805205:	6a 00                	push   $0x0
+  805207:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80520b:	f7 de                	neg    %esi
+  80520d:	8b 44 24 34          	mov    0x34(%esp),%eax
+  805211:	83 d0 00             	adc    $0x0,%eax
+  805214:	f7 d8                	neg    %eax
+  805216:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  80521b:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  805220:	50                   	push   %eax
+  805221:	56                   	push   %esi
+  805222:	89 e8                	mov    %ebp,%eax
+  805224:	e8 92 fe ff ff       	call   8050bb <udivmod>
+  805229:	83 c4 10             	add    $0x10,%esp
+  80522c:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  805231:	78 08                	js     80523b <__divdi3+0x6a>
+  805233:	83 c4 0c             	add    $0xc,%esp
+  805236:	5b                   	pop    %ebx
+  805237:	5e                   	pop    %esi
+  805238:	5f                   	pop    %edi
+  805239:	5d                   	pop    %ebp
+  80523a:	c3                   	ret
+  80523b:	f7 d8                	neg    %eax
+  80523d:	83 d2 00             	adc    $0x0,%edx
+  805240:	f7 da                	neg    %edx
+  805242:	eb ef                	jmp    805233 <__divdi3+0x62>
+
+00805244 <__moddi3>:
+  805244:	55                   	push   %ebp
+  805245:	57                   	push   %edi
+  805246:	56                   	push   %esi
+  805247:	53                   	push   %ebx
+  805248:	83 ec 18             	sub    $0x18,%esp
+  80524b:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80524f:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  805253:	89 f1                	mov    %esi,%ecx
+  805255:	f7 d9                	neg    %ecx
+  805257:	89 da                	mov    %ebx,%edx
+  805259:	83 d2 00             	adc    $0x0,%edx
+  80525c:	f7 da                	neg    %edx
+  80525e:	0f 48 ce             	cmovs  %esi,%ecx
+  805261:	0f 48 d3             	cmovs  %ebx,%edx
+  805264:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805268:	50                   	push   %eax
+  805269:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80526d:	f7 de                	neg    %esi
+  80526f:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  805273:	83 d0 00             	adc    $0x0,%eax
+  805276:	f7 d8                	neg    %eax
+  805278:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80527d:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  805282:	50                   	push   %eax
+  805283:	56                   	push   %esi
+  805284:	89 c8                	mov    %ecx,%eax
+  805286:	e8 30 fe ff ff       	call   8050bb <udivmod>
+  80528b:	83 c4 10             	add    $0x10,%esp
+  80528e:	85 db                	test   %ebx,%ebx
+  805290:	78 10                	js     8052a2 <__moddi3+0x5e>
+  805292:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805296:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80529a:	83 c4 14             	add    $0x14,%esp
+  80529d:	5b                   	pop    %ebx
+  80529e:	5e                   	pop    %esi
+  80529f:	5f                   	pop    %edi
+  8052a0:	5d                   	pop    %ebp
+  8052a1:	c3                   	ret
+  8052a2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8052a6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8052aa:	f7 d8                	neg    %eax
+  8052ac:	83 d2 00             	adc    $0x0,%edx
+  8052af:	f7 da                	neg    %edx
+  8052b1:	eb e7                	jmp    80529a <__moddi3+0x56>
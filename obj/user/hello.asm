@@ -0,0 +1,5570 @@
+
+obj/user/hello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2d 00 00 00       	call   80005e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+// hello, world
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	cprintf("hello, world\n");
+  800039:	68 c0 26 80 00       	push   $0x8026c0
+  80003e:	e8 13 01 00 00       	call   800156 <cprintf>
+	cprintf("i am environment %08x\n", thisenv->env_id);
+  800043:	a1 08 40 80 00       	mov    0x804008,%eax
+  800048:	8b 40 48             	mov    0x48(%eax),%eax
+  80004b:	83 c4 08             	add    $0x8,%esp
+  80004e:	50                   	push   %eax
+  80004f:	68 ce 26 80 00       	push   $0x8026ce
+  800054:	e8 fd 00 00 00       	call   800156 <cprintf>
+}
+  800059:	83 c4 10             	add    $0x10,%esp
+  80005c:	c9                   	leave
+  80005d:	c3                   	ret
+
+0080005e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80005e:	55                   	push   %ebp
+  80005f:	89 e5                	mov    %esp,%ebp
+  800061:	56                   	push   %esi
+  800062:	53                   	push   %ebx
+  800063:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800066:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800069:	e8 84 0b 00 00       	call   800bf2 <sys_getenvid>
+  80006e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800073:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800076:	c1 e0 06             	shl    $0x6,%eax
+  800079:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80007e:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800083:	85 db                	test   %ebx,%ebx
+  800085:	7e 07                	jle    80008e <libmain+0x30>
+		binaryname = argv[0];
+  800087:	8b 06                	mov    (%esi),%eax
+  800089:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80008e:	83 ec 08             	sub    $0x8,%esp
+  800091:	56                   	push   %esi
+  800092:	53                   	push   %ebx
+  800093:	e8 9b ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800098:	e8 0a 00 00 00       	call   8000a7 <exit>
+}
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000a3:	5b                   	pop    %ebx
+  8000a4:	5e                   	pop    %esi
+  8000a5:	5d                   	pop    %ebp
+  8000a6:	c3                   	ret
+
+008000a7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000ad:	e8 e4 12 00 00       	call   801396 <close_all>
+	sys_env_destroy(0);
+  8000b2:	83 ec 0c             	sub    $0xc,%esp
+  8000b5:	6a 00                	push   $0x0
+  8000b7:	e8 f5 0a 00 00       	call   800bb1 <sys_env_destroy>
+}
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	c9                   	leave
+  8000c0:	c3                   	ret
+
+008000c1 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000c1:	55                   	push   %ebp
+  8000c2:	89 e5                	mov    %esp,%ebp
+  8000c4:	53                   	push   %ebx
+  8000c5:	83 ec 04             	sub    $0x4,%esp
+  8000c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000cb:	8b 13                	mov    (%ebx),%edx
+  8000cd:	8d 42 01             	lea    0x1(%edx),%eax
+  8000d0:	89 03                	mov    %eax,(%ebx)
+  8000d2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000d5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000d9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000de:	74 09                	je     8000e9 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000e0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000e7:	c9                   	leave
+  8000e8:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000e9:	83 ec 08             	sub    $0x8,%esp
+  8000ec:	68 ff 00 00 00       	push   $0xff
+  8000f1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000f4:	50                   	push   %eax
+  8000f5:	e8 69 0a 00 00       	call   800b63 <sys_cputs>
+		b->idx = 0;
+  8000fa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800100:	83 c4 10             	add    $0x10,%esp
+  800103:	eb db                	jmp    8000e0 <putch+0x1f>
+
+00800105 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800105:	55                   	push   %ebp
+  800106:	89 e5                	mov    %esp,%ebp
+  800108:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80010e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800115:	00 00 00 
+	b.cnt = 0;
+  800118:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80011f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800122:	ff 75 0c             	push   0xc(%ebp)
+  800125:	ff 75 08             	push   0x8(%ebp)
+  800128:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80012e:	50                   	push   %eax
+  80012f:	68 c1 00 80 00       	push   $0x8000c1
+  800134:	e8 14 01 00 00       	call   80024d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800139:	83 c4 08             	add    $0x8,%esp
+  80013c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800142:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800148:	50                   	push   %eax
+  800149:	e8 15 0a 00 00       	call   800b63 <sys_cputs>
+
+	return b.cnt;
+}
+  80014e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+
+00800156 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800156:	55                   	push   %ebp
+  800157:	89 e5                	mov    %esp,%ebp
+  800159:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80015c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80015f:	50                   	push   %eax
+  800160:	ff 75 08             	push   0x8(%ebp)
+  800163:	e8 9d ff ff ff       	call   800105 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800168:	c9                   	leave
+  800169:	c3                   	ret
+
+0080016a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80016a:	55                   	push   %ebp
+  80016b:	89 e5                	mov    %esp,%ebp
+  80016d:	57                   	push   %edi
+  80016e:	56                   	push   %esi
+  80016f:	53                   	push   %ebx
+  800170:	83 ec 1c             	sub    $0x1c,%esp
+  800173:	89 c7                	mov    %eax,%edi
+  800175:	89 d6                	mov    %edx,%esi
+  800177:	8b 45 08             	mov    0x8(%ebp),%eax
+  80017a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80017d:	89 d1                	mov    %edx,%ecx
+  80017f:	89 c2                	mov    %eax,%edx
+  800181:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800184:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800187:	8b 45 10             	mov    0x10(%ebp),%eax
+  80018a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80018d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800190:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800197:	39 c2                	cmp    %eax,%edx
+  800199:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80019c:	72 3e                	jb     8001dc <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80019e:	83 ec 0c             	sub    $0xc,%esp
+  8001a1:	ff 75 18             	push   0x18(%ebp)
+  8001a4:	83 eb 01             	sub    $0x1,%ebx
+  8001a7:	53                   	push   %ebx
+  8001a8:	50                   	push   %eax
+  8001a9:	83 ec 08             	sub    $0x8,%esp
+  8001ac:	ff 75 e4             	push   -0x1c(%ebp)
+  8001af:	ff 75 e0             	push   -0x20(%ebp)
+  8001b2:	ff 75 dc             	push   -0x24(%ebp)
+  8001b5:	ff 75 d8             	push   -0x28(%ebp)
+  8001b8:	e8 c3 23 00 00       	call   802580 <__udivdi3>
+  8001bd:	83 c4 18             	add    $0x18,%esp
+  8001c0:	52                   	push   %edx
+  8001c1:	50                   	push   %eax
+  8001c2:	89 f2                	mov    %esi,%edx
+  8001c4:	89 f8                	mov    %edi,%eax
+  8001c6:	e8 9f ff ff ff       	call   80016a <printnum>
+  8001cb:	83 c4 20             	add    $0x20,%esp
+  8001ce:	eb 13                	jmp    8001e3 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001d0:	83 ec 08             	sub    $0x8,%esp
+  8001d3:	56                   	push   %esi
+  8001d4:	ff 75 18             	push   0x18(%ebp)
+  8001d7:	ff d7                	call   *%edi
+  8001d9:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001dc:	83 eb 01             	sub    $0x1,%ebx
+  8001df:	85 db                	test   %ebx,%ebx
+  8001e1:	7f ed                	jg     8001d0 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001e3:	83 ec 08             	sub    $0x8,%esp
+  8001e6:	56                   	push   %esi
+  8001e7:	83 ec 04             	sub    $0x4,%esp
+  8001ea:	ff 75 e4             	push   -0x1c(%ebp)
+  8001ed:	ff 75 e0             	push   -0x20(%ebp)
+  8001f0:	ff 75 dc             	push   -0x24(%ebp)
+  8001f3:	ff 75 d8             	push   -0x28(%ebp)
+  8001f6:	e8 a3 23 00 00       	call   80259e <__umoddi3>
+  8001fb:	83 c4 14             	add    $0x14,%esp
+  8001fe:	0f be 80 ef 26 80 00 	movsbl 0x8026ef(%eax),%eax
+  800205:	50                   	push   %eax
+  800206:	ff d7                	call   *%edi
+}
+  800208:	83 c4 10             	add    $0x10,%esp
+  80020b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020e:	5b                   	pop    %ebx
+  80020f:	5e                   	pop    %esi
+  800210:	5f                   	pop    %edi
+  800211:	5d                   	pop    %ebp
+  800212:	c3                   	ret
+
+00800213 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800213:	55                   	push   %ebp
+  800214:	89 e5                	mov    %esp,%ebp
+  800216:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800219:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80021d:	8b 10                	mov    (%eax),%edx
+  80021f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800222:	73 0a                	jae    80022e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800224:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800227:	89 08                	mov    %ecx,(%eax)
+  800229:	8b 45 08             	mov    0x8(%ebp),%eax
+  80022c:	88 02                	mov    %al,(%edx)
+}
+  80022e:	5d                   	pop    %ebp
+  80022f:	c3                   	ret
+
+00800230 <printfmt>:
+{
+  800230:	55                   	push   %ebp
+  800231:	89 e5                	mov    %esp,%ebp
+  800233:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800236:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800239:	50                   	push   %eax
+  80023a:	ff 75 10             	push   0x10(%ebp)
+  80023d:	ff 75 0c             	push   0xc(%ebp)
+  800240:	ff 75 08             	push   0x8(%ebp)
+  800243:	e8 05 00 00 00       	call   80024d <vprintfmt>
+}
+  800248:	83 c4 10             	add    $0x10,%esp
+  80024b:	c9                   	leave
+  80024c:	c3                   	ret
+
+0080024d <vprintfmt>:
+{
+  80024d:	55                   	push   %ebp
+  80024e:	89 e5                	mov    %esp,%ebp
+  800250:	57                   	push   %edi
+  800251:	56                   	push   %esi
+  800252:	53                   	push   %ebx
+  800253:	83 ec 2c             	sub    $0x2c,%esp
+  800256:	8b 75 08             	mov    0x8(%ebp),%esi
+  800259:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80025c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80025f:	eb 0a                	jmp    80026b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800261:	83 ec 08             	sub    $0x8,%esp
+  800264:	53                   	push   %ebx
+  800265:	50                   	push   %eax
+  800266:	ff d6                	call   *%esi
+  800268:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80026b:	83 c7 01             	add    $0x1,%edi
+  80026e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800272:	83 f8 25             	cmp    $0x25,%eax
+  800275:	74 0c                	je     800283 <vprintfmt+0x36>
+			if (ch == '\0')
+  800277:	85 c0                	test   %eax,%eax
+  800279:	75 e6                	jne    800261 <vprintfmt+0x14>
+}
+  80027b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027e:	5b                   	pop    %ebx
+  80027f:	5e                   	pop    %esi
+  800280:	5f                   	pop    %edi
+  800281:	5d                   	pop    %ebp
+  800282:	c3                   	ret
+		padc = ' ';
+  800283:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800287:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80028e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800295:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80029c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002a1:	8d 47 01             	lea    0x1(%edi),%eax
+  8002a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002a7:	0f b6 17             	movzbl (%edi),%edx
+  8002aa:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002ad:	3c 55                	cmp    $0x55,%al
+  8002af:	0f 87 c5 03 00 00    	ja     80067a <vprintfmt+0x42d>
+  8002b5:	0f b6 c0             	movzbl %al,%eax
+  8002b8:	ff 24 85 80 28 80 00 	jmp    *0x802880(,%eax,4)
+  8002bf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002c2:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002c6:	eb d9                	jmp    8002a1 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002cb:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002cf:	eb d0                	jmp    8002a1 <vprintfmt+0x54>
+  8002d1:	0f b6 d2             	movzbl %dl,%edx
+  8002d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002dc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002df:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002e2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002e6:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002e9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002ec:	83 f9 09             	cmp    $0x9,%ecx
+  8002ef:	77 55                	ja     800346 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8002f1:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8002f4:	eb e9                	jmp    8002df <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8002f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f9:	8b 00                	mov    (%eax),%eax
+  8002fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800301:	8d 40 04             	lea    0x4(%eax),%eax
+  800304:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800307:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80030a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80030e:	79 91                	jns    8002a1 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800310:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800313:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800316:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80031d:	eb 82                	jmp    8002a1 <vprintfmt+0x54>
+			if (width < 0)
+  80031f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800322:	85 d2                	test   %edx,%edx
+  800324:	b8 00 00 00 00       	mov    $0x0,%eax
+  800329:	0f 49 c2             	cmovns %edx,%eax
+  80032c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80032f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800332:	e9 6a ff ff ff       	jmp    8002a1 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800337:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80033a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800341:	e9 5b ff ff ff       	jmp    8002a1 <vprintfmt+0x54>
+  800346:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800349:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80034c:	eb bc                	jmp    80030a <vprintfmt+0xbd>
+			lflag++;
+  80034e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800351:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800354:	e9 48 ff ff ff       	jmp    8002a1 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800359:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035c:	8d 78 04             	lea    0x4(%eax),%edi
+  80035f:	83 ec 08             	sub    $0x8,%esp
+  800362:	53                   	push   %ebx
+  800363:	ff 30                	push   (%eax)
+  800365:	ff d6                	call   *%esi
+			break;
+  800367:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80036a:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80036d:	e9 63 02 00 00       	jmp    8005d5 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800372:	8b 45 14             	mov    0x14(%ebp),%eax
+  800375:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800378:	8b 10                	mov    (%eax),%edx
+  80037a:	89 d0                	mov    %edx,%eax
+  80037c:	f7 d8                	neg    %eax
+  80037e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800381:	83 f8 12             	cmp    $0x12,%eax
+  800384:	7f 23                	jg     8003a9 <vprintfmt+0x15c>
+  800386:	8b 14 85 e0 29 80 00 	mov    0x8029e0(,%eax,4),%edx
+  80038d:	85 d2                	test   %edx,%edx
+  80038f:	74 18                	je     8003a9 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800391:	52                   	push   %edx
+  800392:	68 1d 2b 80 00       	push   $0x802b1d
+  800397:	53                   	push   %ebx
+  800398:	56                   	push   %esi
+  800399:	e8 92 fe ff ff       	call   800230 <printfmt>
+  80039e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003a1:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003a4:	e9 2c 02 00 00       	jmp    8005d5 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  8003a9:	50                   	push   %eax
+  8003aa:	68 07 27 80 00       	push   $0x802707
+  8003af:	53                   	push   %ebx
+  8003b0:	56                   	push   %esi
+  8003b1:	e8 7a fe ff ff       	call   800230 <printfmt>
+  8003b6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003b9:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003bc:	e9 14 02 00 00       	jmp    8005d5 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c4:	83 c0 04             	add    $0x4,%eax
+  8003c7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cd:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003cf:	85 c9                	test   %ecx,%ecx
+  8003d1:	b8 00 27 80 00       	mov    $0x802700,%eax
+  8003d6:	0f 45 c1             	cmovne %ecx,%eax
+  8003d9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003dc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003e0:	7e 06                	jle    8003e8 <vprintfmt+0x19b>
+  8003e2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003e6:	75 0b                	jne    8003f3 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003e8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003eb:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003ee:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003f1:	eb 5c                	jmp    80044f <vprintfmt+0x202>
+  8003f3:	83 ec 08             	sub    $0x8,%esp
+  8003f6:	ff 75 d0             	push   -0x30(%ebp)
+  8003f9:	ff 75 cc             	push   -0x34(%ebp)
+  8003fc:	e8 19 03 00 00       	call   80071a <strnlen>
+  800401:	89 c2                	mov    %eax,%edx
+  800403:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800406:	29 d0                	sub    %edx,%eax
+  800408:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80040b:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80040f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800412:	89 75 08             	mov    %esi,0x8(%ebp)
+  800415:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800417:	eb 0e                	jmp    800427 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800419:	83 ec 08             	sub    $0x8,%esp
+  80041c:	53                   	push   %ebx
+  80041d:	57                   	push   %edi
+  80041e:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800421:	83 ee 01             	sub    $0x1,%esi
+  800424:	83 c4 10             	add    $0x10,%esp
+  800427:	85 f6                	test   %esi,%esi
+  800429:	7f ee                	jg     800419 <vprintfmt+0x1cc>
+  80042b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80042e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800431:	85 c0                	test   %eax,%eax
+  800433:	ba 00 00 00 00       	mov    $0x0,%edx
+  800438:	0f 49 d0             	cmovns %eax,%edx
+  80043b:	29 d0                	sub    %edx,%eax
+  80043d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800440:	eb a6                	jmp    8003e8 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800442:	83 ec 08             	sub    $0x8,%esp
+  800445:	53                   	push   %ebx
+  800446:	52                   	push   %edx
+  800447:	ff 55 08             	call   *0x8(%ebp)
+  80044a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80044d:	89 f1                	mov    %esi,%ecx
+  80044f:	8d 71 01             	lea    0x1(%ecx),%esi
+  800452:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800456:	0f be d0             	movsbl %al,%edx
+  800459:	85 d2                	test   %edx,%edx
+  80045b:	74 28                	je     800485 <vprintfmt+0x238>
+  80045d:	85 ff                	test   %edi,%edi
+  80045f:	78 05                	js     800466 <vprintfmt+0x219>
+  800461:	83 ef 01             	sub    $0x1,%edi
+  800464:	78 30                	js     800496 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800466:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80046a:	74 d6                	je     800442 <vprintfmt+0x1f5>
+  80046c:	0f be c0             	movsbl %al,%eax
+  80046f:	83 e8 20             	sub    $0x20,%eax
+  800472:	83 f8 5e             	cmp    $0x5e,%eax
+  800475:	76 cb                	jbe    800442 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800477:	83 ec 08             	sub    $0x8,%esp
+  80047a:	53                   	push   %ebx
+  80047b:	6a 3f                	push   $0x3f
+  80047d:	ff 55 08             	call   *0x8(%ebp)
+  800480:	83 c4 10             	add    $0x10,%esp
+  800483:	eb c8                	jmp    80044d <vprintfmt+0x200>
+  800485:	8b 75 08             	mov    0x8(%ebp),%esi
+  800488:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80048b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80048e:	01 d0                	add    %edx,%eax
+  800490:	29 c8                	sub    %ecx,%eax
+  800492:	89 c7                	mov    %eax,%edi
+  800494:	eb 13                	jmp    8004a9 <vprintfmt+0x25c>
+  800496:	8b 75 08             	mov    0x8(%ebp),%esi
+  800499:	eb ed                	jmp    800488 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80049b:	83 ec 08             	sub    $0x8,%esp
+  80049e:	53                   	push   %ebx
+  80049f:	6a 20                	push   $0x20
+  8004a1:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004a3:	83 ef 01             	sub    $0x1,%edi
+  8004a6:	83 c4 10             	add    $0x10,%esp
+  8004a9:	85 ff                	test   %edi,%edi
+  8004ab:	7f ee                	jg     80049b <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004ad:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004b3:	e9 1d 01 00 00       	jmp    8005d5 <vprintfmt+0x388>
+	if (lflag >= 2)
+  8004b8:	83 f9 01             	cmp    $0x1,%ecx
+  8004bb:	7f 1b                	jg     8004d8 <vprintfmt+0x28b>
+	else if (lflag)
+  8004bd:	85 c9                	test   %ecx,%ecx
+  8004bf:	74 63                	je     800524 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  8004c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c4:	8b 00                	mov    (%eax),%eax
+  8004c6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004c9:	99                   	cltd
+  8004ca:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d0:	8d 40 04             	lea    0x4(%eax),%eax
+  8004d3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004d6:	eb 17                	jmp    8004ef <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  8004d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004db:	8b 50 04             	mov    0x4(%eax),%edx
+  8004de:	8b 00                	mov    (%eax),%eax
+  8004e0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004e3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e9:	8d 40 08             	lea    0x8(%eax),%eax
+  8004ec:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8004ef:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004f2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8004f5:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8004fa:	85 c9                	test   %ecx,%ecx
+  8004fc:	0f 89 b9 00 00 00    	jns    8005bb <vprintfmt+0x36e>
+				putch('-', putdat);
+  800502:	83 ec 08             	sub    $0x8,%esp
+  800505:	53                   	push   %ebx
+  800506:	6a 2d                	push   $0x2d
+  800508:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80050a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80050d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800510:	f7 da                	neg    %edx
+  800512:	83 d1 00             	adc    $0x0,%ecx
+  800515:	f7 d9                	neg    %ecx
+  800517:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80051a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80051f:	e9 97 00 00 00       	jmp    8005bb <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800524:	8b 45 14             	mov    0x14(%ebp),%eax
+  800527:	8b 00                	mov    (%eax),%eax
+  800529:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052c:	99                   	cltd
+  80052d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800530:	8b 45 14             	mov    0x14(%ebp),%eax
+  800533:	8d 40 04             	lea    0x4(%eax),%eax
+  800536:	89 45 14             	mov    %eax,0x14(%ebp)
+  800539:	eb b4                	jmp    8004ef <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  80053b:	83 f9 01             	cmp    $0x1,%ecx
+  80053e:	7f 1b                	jg     80055b <vprintfmt+0x30e>
+	else if (lflag)
+  800540:	85 c9                	test   %ecx,%ecx
+  800542:	74 2c                	je     800570 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800544:	8b 45 14             	mov    0x14(%ebp),%eax
+  800547:	8b 10                	mov    (%eax),%edx
+  800549:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80054e:	8d 40 04             	lea    0x4(%eax),%eax
+  800551:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800554:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800559:	eb 60                	jmp    8005bb <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80055b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055e:	8b 10                	mov    (%eax),%edx
+  800560:	8b 48 04             	mov    0x4(%eax),%ecx
+  800563:	8d 40 08             	lea    0x8(%eax),%eax
+  800566:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800569:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80056e:	eb 4b                	jmp    8005bb <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800570:	8b 45 14             	mov    0x14(%ebp),%eax
+  800573:	8b 10                	mov    (%eax),%edx
+  800575:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80057a:	8d 40 04             	lea    0x4(%eax),%eax
+  80057d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800580:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800585:	eb 34                	jmp    8005bb <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800587:	83 f9 01             	cmp    $0x1,%ecx
+  80058a:	7f 15                	jg     8005a1 <vprintfmt+0x354>
+	else if (lflag)
+  80058c:	85 c9                	test   %ecx,%ecx
+  80058e:	74 4d                	je     8005dd <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800590:	8b 45 14             	mov    0x14(%ebp),%eax
+  800593:	8b 00                	mov    (%eax),%eax
+  800595:	99                   	cltd
+  800596:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800599:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80059c:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80059f:	eb 11                	jmp    8005b2 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  8005a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a4:	8b 50 04             	mov    0x4(%eax),%edx
+  8005a7:	8b 00                	mov    (%eax),%eax
+  8005a9:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005ac:	8d 49 08             	lea    0x8(%ecx),%ecx
+  8005af:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  8005b2:	89 d1                	mov    %edx,%ecx
+  8005b4:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  8005b6:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005bb:	83 ec 0c             	sub    $0xc,%esp
+  8005be:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8005c2:	50                   	push   %eax
+  8005c3:	ff 75 e0             	push   -0x20(%ebp)
+  8005c6:	57                   	push   %edi
+  8005c7:	51                   	push   %ecx
+  8005c8:	52                   	push   %edx
+  8005c9:	89 da                	mov    %ebx,%edx
+  8005cb:	89 f0                	mov    %esi,%eax
+  8005cd:	e8 98 fb ff ff       	call   80016a <printnum>
+			break;
+  8005d2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8005d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005d8:	e9 8e fc ff ff       	jmp    80026b <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  8005dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e0:	8b 00                	mov    (%eax),%eax
+  8005e2:	99                   	cltd
+  8005e3:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005e6:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8005e9:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8005ec:	eb c4                	jmp    8005b2 <vprintfmt+0x365>
+			putch('0', putdat);
+  8005ee:	83 ec 08             	sub    $0x8,%esp
+  8005f1:	53                   	push   %ebx
+  8005f2:	6a 30                	push   $0x30
+  8005f4:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005f6:	83 c4 08             	add    $0x8,%esp
+  8005f9:	53                   	push   %ebx
+  8005fa:	6a 78                	push   $0x78
+  8005fc:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800601:	8b 10                	mov    (%eax),%edx
+  800603:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800608:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80060b:	8d 40 04             	lea    0x4(%eax),%eax
+  80060e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800611:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800616:	eb a3                	jmp    8005bb <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800618:	83 f9 01             	cmp    $0x1,%ecx
+  80061b:	7f 1b                	jg     800638 <vprintfmt+0x3eb>
+	else if (lflag)
+  80061d:	85 c9                	test   %ecx,%ecx
+  80061f:	74 2f                	je     800650 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800621:	8b 45 14             	mov    0x14(%ebp),%eax
+  800624:	8b 10                	mov    (%eax),%edx
+  800626:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062b:	8d 40 04             	lea    0x4(%eax),%eax
+  80062e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800631:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800636:	eb 83                	jmp    8005bb <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800638:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063b:	8b 10                	mov    (%eax),%edx
+  80063d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800640:	8d 40 08             	lea    0x8(%eax),%eax
+  800643:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800646:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80064b:	e9 6b ff ff ff       	jmp    8005bb <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800650:	8b 45 14             	mov    0x14(%ebp),%eax
+  800653:	8b 10                	mov    (%eax),%edx
+  800655:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065a:	8d 40 04             	lea    0x4(%eax),%eax
+  80065d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800660:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800665:	e9 51 ff ff ff       	jmp    8005bb <vprintfmt+0x36e>
+			putch(ch, putdat);
+  80066a:	83 ec 08             	sub    $0x8,%esp
+  80066d:	53                   	push   %ebx
+  80066e:	6a 25                	push   $0x25
+  800670:	ff d6                	call   *%esi
+			break;
+  800672:	83 c4 10             	add    $0x10,%esp
+  800675:	e9 5b ff ff ff       	jmp    8005d5 <vprintfmt+0x388>
+			putch('%', putdat);
+  80067a:	83 ec 08             	sub    $0x8,%esp
+  80067d:	53                   	push   %ebx
+  80067e:	6a 25                	push   $0x25
+  800680:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800682:	83 c4 10             	add    $0x10,%esp
+  800685:	89 f8                	mov    %edi,%eax
+  800687:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80068b:	74 05                	je     800692 <vprintfmt+0x445>
+  80068d:	83 e8 01             	sub    $0x1,%eax
+  800690:	eb f5                	jmp    800687 <vprintfmt+0x43a>
+  800692:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800695:	e9 3b ff ff ff       	jmp    8005d5 <vprintfmt+0x388>
+
+0080069a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80069a:	55                   	push   %ebp
+  80069b:	89 e5                	mov    %esp,%ebp
+  80069d:	83 ec 18             	sub    $0x18,%esp
+  8006a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006a6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006a9:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006ad:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006b0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006b7:	85 c0                	test   %eax,%eax
+  8006b9:	74 26                	je     8006e1 <vsnprintf+0x47>
+  8006bb:	85 d2                	test   %edx,%edx
+  8006bd:	7e 22                	jle    8006e1 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006bf:	ff 75 14             	push   0x14(%ebp)
+  8006c2:	ff 75 10             	push   0x10(%ebp)
+  8006c5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006c8:	50                   	push   %eax
+  8006c9:	68 13 02 80 00       	push   $0x800213
+  8006ce:	e8 7a fb ff ff       	call   80024d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006d3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006d6:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006dc:	83 c4 10             	add    $0x10,%esp
+}
+  8006df:	c9                   	leave
+  8006e0:	c3                   	ret
+		return -E_INVAL;
+  8006e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006e6:	eb f7                	jmp    8006df <vsnprintf+0x45>
+
+008006e8 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006e8:	55                   	push   %ebp
+  8006e9:	89 e5                	mov    %esp,%ebp
+  8006eb:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006ee:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006f1:	50                   	push   %eax
+  8006f2:	ff 75 10             	push   0x10(%ebp)
+  8006f5:	ff 75 0c             	push   0xc(%ebp)
+  8006f8:	ff 75 08             	push   0x8(%ebp)
+  8006fb:	e8 9a ff ff ff       	call   80069a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800700:	c9                   	leave
+  800701:	c3                   	ret
+
+00800702 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800702:	55                   	push   %ebp
+  800703:	89 e5                	mov    %esp,%ebp
+  800705:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800708:	b8 00 00 00 00       	mov    $0x0,%eax
+  80070d:	eb 03                	jmp    800712 <strlen+0x10>
+		n++;
+  80070f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800712:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800716:	75 f7                	jne    80070f <strlen+0xd>
+	return n;
+}
+  800718:	5d                   	pop    %ebp
+  800719:	c3                   	ret
+
+0080071a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80071a:	55                   	push   %ebp
+  80071b:	89 e5                	mov    %esp,%ebp
+  80071d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800720:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800723:	b8 00 00 00 00       	mov    $0x0,%eax
+  800728:	eb 03                	jmp    80072d <strnlen+0x13>
+		n++;
+  80072a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80072d:	39 d0                	cmp    %edx,%eax
+  80072f:	74 08                	je     800739 <strnlen+0x1f>
+  800731:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800735:	75 f3                	jne    80072a <strnlen+0x10>
+  800737:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800739:	89 d0                	mov    %edx,%eax
+  80073b:	5d                   	pop    %ebp
+  80073c:	c3                   	ret
+
+0080073d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80073d:	55                   	push   %ebp
+  80073e:	89 e5                	mov    %esp,%ebp
+  800740:	53                   	push   %ebx
+  800741:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800744:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800747:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800750:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800753:	83 c0 01             	add    $0x1,%eax
+  800756:	84 d2                	test   %dl,%dl
+  800758:	75 f2                	jne    80074c <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80075a:	89 c8                	mov    %ecx,%eax
+  80075c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80075f:	c9                   	leave
+  800760:	c3                   	ret
+
+00800761 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800761:	55                   	push   %ebp
+  800762:	89 e5                	mov    %esp,%ebp
+  800764:	53                   	push   %ebx
+  800765:	83 ec 10             	sub    $0x10,%esp
+  800768:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80076b:	53                   	push   %ebx
+  80076c:	e8 91 ff ff ff       	call   800702 <strlen>
+  800771:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800774:	ff 75 0c             	push   0xc(%ebp)
+  800777:	01 d8                	add    %ebx,%eax
+  800779:	50                   	push   %eax
+  80077a:	e8 be ff ff ff       	call   80073d <strcpy>
+	return dst;
+}
+  80077f:	89 d8                	mov    %ebx,%eax
+  800781:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800784:	c9                   	leave
+  800785:	c3                   	ret
+
+00800786 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800786:	55                   	push   %ebp
+  800787:	89 e5                	mov    %esp,%ebp
+  800789:	56                   	push   %esi
+  80078a:	53                   	push   %ebx
+  80078b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80078e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800791:	89 f3                	mov    %esi,%ebx
+  800793:	03 5d 10             	add    0x10(%ebp),%ebx
+  800796:	89 f0                	mov    %esi,%eax
+  800798:	eb 0f                	jmp    8007a9 <strncpy+0x23>
+		*dst++ = *src;
+  80079a:	83 c0 01             	add    $0x1,%eax
+  80079d:	0f b6 0a             	movzbl (%edx),%ecx
+  8007a0:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007a3:	80 f9 01             	cmp    $0x1,%cl
+  8007a6:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007a9:	39 d8                	cmp    %ebx,%eax
+  8007ab:	75 ed                	jne    80079a <strncpy+0x14>
+	}
+	return ret;
+}
+  8007ad:	89 f0                	mov    %esi,%eax
+  8007af:	5b                   	pop    %ebx
+  8007b0:	5e                   	pop    %esi
+  8007b1:	5d                   	pop    %ebp
+  8007b2:	c3                   	ret
+
+008007b3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007b3:	55                   	push   %ebp
+  8007b4:	89 e5                	mov    %esp,%ebp
+  8007b6:	56                   	push   %esi
+  8007b7:	53                   	push   %ebx
+  8007b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007be:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007c1:	89 f0                	mov    %esi,%eax
+  8007c3:	85 d2                	test   %edx,%edx
+  8007c5:	74 21                	je     8007e8 <strlcpy+0x35>
+  8007c7:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007cb:	89 f2                	mov    %esi,%edx
+  8007cd:	eb 09                	jmp    8007d8 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007cf:	83 c1 01             	add    $0x1,%ecx
+  8007d2:	83 c2 01             	add    $0x1,%edx
+  8007d5:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007d8:	39 c2                	cmp    %eax,%edx
+  8007da:	74 09                	je     8007e5 <strlcpy+0x32>
+  8007dc:	0f b6 19             	movzbl (%ecx),%ebx
+  8007df:	84 db                	test   %bl,%bl
+  8007e1:	75 ec                	jne    8007cf <strlcpy+0x1c>
+  8007e3:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007e5:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007e8:	29 f0                	sub    %esi,%eax
+}
+  8007ea:	5b                   	pop    %ebx
+  8007eb:	5e                   	pop    %esi
+  8007ec:	5d                   	pop    %ebp
+  8007ed:	c3                   	ret
+
+008007ee <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007ee:	55                   	push   %ebp
+  8007ef:	89 e5                	mov    %esp,%ebp
+  8007f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007f7:	eb 06                	jmp    8007ff <strcmp+0x11>
+		p++, q++;
+  8007f9:	83 c1 01             	add    $0x1,%ecx
+  8007fc:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8007ff:	0f b6 01             	movzbl (%ecx),%eax
+  800802:	84 c0                	test   %al,%al
+  800804:	74 04                	je     80080a <strcmp+0x1c>
+  800806:	3a 02                	cmp    (%edx),%al
+  800808:	74 ef                	je     8007f9 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80080a:	0f b6 c0             	movzbl %al,%eax
+  80080d:	0f b6 12             	movzbl (%edx),%edx
+  800810:	29 d0                	sub    %edx,%eax
+}
+  800812:	5d                   	pop    %ebp
+  800813:	c3                   	ret
+
+00800814 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800814:	55                   	push   %ebp
+  800815:	89 e5                	mov    %esp,%ebp
+  800817:	53                   	push   %ebx
+  800818:	8b 45 08             	mov    0x8(%ebp),%eax
+  80081b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80081e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800821:	eb 09                	jmp    80082c <strncmp+0x18>
+		n--, p++, q++;
+  800823:	83 ea 01             	sub    $0x1,%edx
+  800826:	83 c0 01             	add    $0x1,%eax
+  800829:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80082c:	85 d2                	test   %edx,%edx
+  80082e:	74 18                	je     800848 <strncmp+0x34>
+  800830:	0f b6 18             	movzbl (%eax),%ebx
+  800833:	84 db                	test   %bl,%bl
+  800835:	74 04                	je     80083b <strncmp+0x27>
+  800837:	3a 19                	cmp    (%ecx),%bl
+  800839:	74 e8                	je     800823 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80083b:	0f b6 00             	movzbl (%eax),%eax
+  80083e:	0f b6 11             	movzbl (%ecx),%edx
+  800841:	29 d0                	sub    %edx,%eax
+}
+  800843:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800846:	c9                   	leave
+  800847:	c3                   	ret
+		return 0;
+  800848:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084d:	eb f4                	jmp    800843 <strncmp+0x2f>
+
+0080084f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80084f:	55                   	push   %ebp
+  800850:	89 e5                	mov    %esp,%ebp
+  800852:	8b 45 08             	mov    0x8(%ebp),%eax
+  800855:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800859:	eb 03                	jmp    80085e <strchr+0xf>
+  80085b:	83 c0 01             	add    $0x1,%eax
+  80085e:	0f b6 10             	movzbl (%eax),%edx
+  800861:	84 d2                	test   %dl,%dl
+  800863:	74 06                	je     80086b <strchr+0x1c>
+		if (*s == c)
+  800865:	38 ca                	cmp    %cl,%dl
+  800867:	75 f2                	jne    80085b <strchr+0xc>
+  800869:	eb 05                	jmp    800870 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80086b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800870:	5d                   	pop    %ebp
+  800871:	c3                   	ret
+
+00800872 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800872:	55                   	push   %ebp
+  800873:	89 e5                	mov    %esp,%ebp
+  800875:	8b 45 08             	mov    0x8(%ebp),%eax
+  800878:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80087c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80087f:	38 ca                	cmp    %cl,%dl
+  800881:	74 09                	je     80088c <strfind+0x1a>
+  800883:	84 d2                	test   %dl,%dl
+  800885:	74 05                	je     80088c <strfind+0x1a>
+	for (; *s; s++)
+  800887:	83 c0 01             	add    $0x1,%eax
+  80088a:	eb f0                	jmp    80087c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80088c:	5d                   	pop    %ebp
+  80088d:	c3                   	ret
+
+0080088e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80088e:	55                   	push   %ebp
+  80088f:	89 e5                	mov    %esp,%ebp
+  800891:	57                   	push   %edi
+  800892:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800895:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800898:	85 c9                	test   %ecx,%ecx
+  80089a:	74 20                	je     8008bc <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80089c:	89 f8                	mov    %edi,%eax
+  80089e:	09 c8                	or     %ecx,%eax
+  8008a0:	a8 03                	test   $0x3,%al
+  8008a2:	75 12                	jne    8008b6 <memset+0x28>
+		c &= 0xFF;
+  8008a4:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008a8:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008ae:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008b1:	fc                   	cld
+  8008b2:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008b4:	eb 06                	jmp    8008bc <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008b9:	fc                   	cld
+  8008ba:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008bc:	89 f8                	mov    %edi,%eax
+  8008be:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008c1:	c9                   	leave
+  8008c2:	c3                   	ret
+
+008008c3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008c3:	55                   	push   %ebp
+  8008c4:	89 e5                	mov    %esp,%ebp
+  8008c6:	57                   	push   %edi
+  8008c7:	56                   	push   %esi
+  8008c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008ce:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008d1:	39 c6                	cmp    %eax,%esi
+  8008d3:	73 32                	jae    800907 <memmove+0x44>
+  8008d5:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008d8:	39 d0                	cmp    %edx,%eax
+  8008da:	73 2b                	jae    800907 <memmove+0x44>
+		s += n;
+		d += n;
+  8008dc:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008df:	89 d6                	mov    %edx,%esi
+  8008e1:	09 fe                	or     %edi,%esi
+  8008e3:	09 ce                	or     %ecx,%esi
+  8008e5:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008eb:	75 0e                	jne    8008fb <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008ed:	83 ef 04             	sub    $0x4,%edi
+  8008f0:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008f3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008f6:	fd                   	std
+  8008f7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008f9:	eb 09                	jmp    800904 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008fb:	83 ef 01             	sub    $0x1,%edi
+  8008fe:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800901:	fd                   	std
+  800902:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800904:	fc                   	cld
+  800905:	eb 1a                	jmp    800921 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800907:	89 f2                	mov    %esi,%edx
+  800909:	09 c2                	or     %eax,%edx
+  80090b:	09 ca                	or     %ecx,%edx
+  80090d:	f6 c2 03             	test   $0x3,%dl
+  800910:	75 0a                	jne    80091c <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800912:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800915:	89 c7                	mov    %eax,%edi
+  800917:	fc                   	cld
+  800918:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80091a:	eb 05                	jmp    800921 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80091c:	89 c7                	mov    %eax,%edi
+  80091e:	fc                   	cld
+  80091f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800921:	5e                   	pop    %esi
+  800922:	5f                   	pop    %edi
+  800923:	5d                   	pop    %ebp
+  800924:	c3                   	ret
+
+00800925 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800925:	55                   	push   %ebp
+  800926:	89 e5                	mov    %esp,%ebp
+  800928:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80092b:	ff 75 10             	push   0x10(%ebp)
+  80092e:	ff 75 0c             	push   0xc(%ebp)
+  800931:	ff 75 08             	push   0x8(%ebp)
+  800934:	e8 8a ff ff ff       	call   8008c3 <memmove>
+}
+  800939:	c9                   	leave
+  80093a:	c3                   	ret
+
+0080093b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80093b:	55                   	push   %ebp
+  80093c:	89 e5                	mov    %esp,%ebp
+  80093e:	56                   	push   %esi
+  80093f:	53                   	push   %ebx
+  800940:	8b 45 08             	mov    0x8(%ebp),%eax
+  800943:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800946:	89 c6                	mov    %eax,%esi
+  800948:	03 75 10             	add    0x10(%ebp),%esi
+  80094b:	eb 06                	jmp    800953 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80094d:	83 c0 01             	add    $0x1,%eax
+  800950:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800953:	39 f0                	cmp    %esi,%eax
+  800955:	74 14                	je     80096b <memcmp+0x30>
+		if (*s1 != *s2)
+  800957:	0f b6 08             	movzbl (%eax),%ecx
+  80095a:	0f b6 1a             	movzbl (%edx),%ebx
+  80095d:	38 d9                	cmp    %bl,%cl
+  80095f:	74 ec                	je     80094d <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800961:	0f b6 c1             	movzbl %cl,%eax
+  800964:	0f b6 db             	movzbl %bl,%ebx
+  800967:	29 d8                	sub    %ebx,%eax
+  800969:	eb 05                	jmp    800970 <memcmp+0x35>
+	}
+
+	return 0;
+  80096b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800970:	5b                   	pop    %ebx
+  800971:	5e                   	pop    %esi
+  800972:	5d                   	pop    %ebp
+  800973:	c3                   	ret
+
+00800974 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800974:	55                   	push   %ebp
+  800975:	89 e5                	mov    %esp,%ebp
+  800977:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80097d:	89 c2                	mov    %eax,%edx
+  80097f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800982:	eb 03                	jmp    800987 <memfind+0x13>
+  800984:	83 c0 01             	add    $0x1,%eax
+  800987:	39 d0                	cmp    %edx,%eax
+  800989:	73 04                	jae    80098f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80098b:	38 08                	cmp    %cl,(%eax)
+  80098d:	75 f5                	jne    800984 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80098f:	5d                   	pop    %ebp
+  800990:	c3                   	ret
+
+00800991 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800991:	55                   	push   %ebp
+  800992:	89 e5                	mov    %esp,%ebp
+  800994:	57                   	push   %edi
+  800995:	56                   	push   %esi
+  800996:	53                   	push   %ebx
+  800997:	8b 55 08             	mov    0x8(%ebp),%edx
+  80099a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80099d:	eb 03                	jmp    8009a2 <strtol+0x11>
+		s++;
+  80099f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009a2:	0f b6 02             	movzbl (%edx),%eax
+  8009a5:	3c 20                	cmp    $0x20,%al
+  8009a7:	74 f6                	je     80099f <strtol+0xe>
+  8009a9:	3c 09                	cmp    $0x9,%al
+  8009ab:	74 f2                	je     80099f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009ad:	3c 2b                	cmp    $0x2b,%al
+  8009af:	74 2a                	je     8009db <strtol+0x4a>
+	int neg = 0;
+  8009b1:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009b6:	3c 2d                	cmp    $0x2d,%al
+  8009b8:	74 2b                	je     8009e5 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009ba:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009c0:	75 0f                	jne    8009d1 <strtol+0x40>
+  8009c2:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009c5:	74 28                	je     8009ef <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009c7:	85 db                	test   %ebx,%ebx
+  8009c9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009ce:	0f 44 d8             	cmove  %eax,%ebx
+  8009d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009d6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009d9:	eb 46                	jmp    800a21 <strtol+0x90>
+		s++;
+  8009db:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009e3:	eb d5                	jmp    8009ba <strtol+0x29>
+		s++, neg = 1;
+  8009e5:	83 c2 01             	add    $0x1,%edx
+  8009e8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009ed:	eb cb                	jmp    8009ba <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009ef:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009f3:	74 0e                	je     800a03 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009f5:	85 db                	test   %ebx,%ebx
+  8009f7:	75 d8                	jne    8009d1 <strtol+0x40>
+		s++, base = 8;
+  8009f9:	83 c2 01             	add    $0x1,%edx
+  8009fc:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a01:	eb ce                	jmp    8009d1 <strtol+0x40>
+		s += 2, base = 16;
+  800a03:	83 c2 02             	add    $0x2,%edx
+  800a06:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a0b:	eb c4                	jmp    8009d1 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a0d:	0f be c0             	movsbl %al,%eax
+  800a10:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a13:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a16:	7d 3a                	jge    800a52 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a18:	83 c2 01             	add    $0x1,%edx
+  800a1b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a1f:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a21:	0f b6 02             	movzbl (%edx),%eax
+  800a24:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a27:	89 f3                	mov    %esi,%ebx
+  800a29:	80 fb 09             	cmp    $0x9,%bl
+  800a2c:	76 df                	jbe    800a0d <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a2e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a31:	89 f3                	mov    %esi,%ebx
+  800a33:	80 fb 19             	cmp    $0x19,%bl
+  800a36:	77 08                	ja     800a40 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a38:	0f be c0             	movsbl %al,%eax
+  800a3b:	83 e8 57             	sub    $0x57,%eax
+  800a3e:	eb d3                	jmp    800a13 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a40:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a43:	89 f3                	mov    %esi,%ebx
+  800a45:	80 fb 19             	cmp    $0x19,%bl
+  800a48:	77 08                	ja     800a52 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a4a:	0f be c0             	movsbl %al,%eax
+  800a4d:	83 e8 37             	sub    $0x37,%eax
+  800a50:	eb c1                	jmp    800a13 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a52:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a56:	74 05                	je     800a5d <strtol+0xcc>
+		*endptr = (char *) s;
+  800a58:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a5b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a5d:	89 c8                	mov    %ecx,%eax
+  800a5f:	f7 d8                	neg    %eax
+  800a61:	85 ff                	test   %edi,%edi
+  800a63:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a66:	89 c8                	mov    %ecx,%eax
+  800a68:	5b                   	pop    %ebx
+  800a69:	5e                   	pop    %esi
+  800a6a:	5f                   	pop    %edi
+  800a6b:	5d                   	pop    %ebp
+  800a6c:	c3                   	ret
+
+00800a6d <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800a6d:	55                   	push   %ebp
+  800a6e:	89 e5                	mov    %esp,%ebp
+  800a70:	57                   	push   %edi
+  800a71:	56                   	push   %esi
+  800a72:	53                   	push   %ebx
+  800a73:	83 ec 0c             	sub    $0xc,%esp
+  800a76:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a79:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a7c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800a7f:	85 ff                	test   %edi,%edi
+  800a81:	74 16                	je     800a99 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800a83:	83 ec 04             	sub    $0x4,%esp
+  800a86:	56                   	push   %esi
+  800a87:	6a 00                	push   $0x0
+  800a89:	53                   	push   %ebx
+  800a8a:	e8 02 ff ff ff       	call   800991 <strtol>
+  800a8f:	89 07                	mov    %eax,(%edi)
+  800a91:	83 c4 10             	add    $0x10,%esp
+  800a94:	eb 03                	jmp    800a99 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800a96:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800a99:	0f b6 03             	movzbl (%ebx),%eax
+  800a9c:	3c 20                	cmp    $0x20,%al
+  800a9e:	74 f6                	je     800a96 <strisl+0x29>
+  800aa0:	3c 09                	cmp    $0x9,%al
+  800aa2:	74 f2                	je     800a96 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800aa4:	3c 2b                	cmp    $0x2b,%al
+  800aa6:	74 23                	je     800acb <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800aa8:	3c 2d                	cmp    $0x2d,%al
+  800aaa:	0f 94 c0             	sete   %al
+  800aad:	0f b6 c0             	movzbl %al,%eax
+  800ab0:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ab2:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800ab8:	75 41                	jne    800afb <strisl+0x8e>
+  800aba:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800abd:	74 11                	je     800ad0 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800abf:	85 f6                	test   %esi,%esi
+  800ac1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ac6:	0f 44 f0             	cmove  %eax,%esi
+  800ac9:	eb 30                	jmp    800afb <strisl+0x8e>
+		s++;
+  800acb:	83 c3 01             	add    $0x1,%ebx
+  800ace:	eb e2                	jmp    800ab2 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ad0:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800ad4:	74 0e                	je     800ae4 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800ad6:	85 f6                	test   %esi,%esi
+  800ad8:	75 21                	jne    800afb <strisl+0x8e>
+		s++, base = 8;
+  800ada:	83 c3 01             	add    $0x1,%ebx
+  800add:	be 08 00 00 00       	mov    $0x8,%esi
+  800ae2:	eb 17                	jmp    800afb <strisl+0x8e>
+		s += 2, base = 16;
+  800ae4:	83 c3 02             	add    $0x2,%ebx
+  800ae7:	be 10 00 00 00       	mov    $0x10,%esi
+  800aec:	eb 0d                	jmp    800afb <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800aee:	0f be c0             	movsbl %al,%eax
+  800af1:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800af4:	39 f0                	cmp    %esi,%eax
+  800af6:	7d 38                	jge    800b30 <strisl+0xc3>
+			return 0;
+		s++;
+  800af8:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800afb:	0f b6 03             	movzbl (%ebx),%eax
+  800afe:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800b01:	80 fa 09             	cmp    $0x9,%dl
+  800b04:	76 e8                	jbe    800aee <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800b06:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800b09:	80 fa 19             	cmp    $0x19,%dl
+  800b0c:	77 08                	ja     800b16 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800b0e:	0f be c0             	movsbl %al,%eax
+  800b11:	83 e8 57             	sub    $0x57,%eax
+  800b14:	eb de                	jmp    800af4 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b16:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800b19:	80 fa 19             	cmp    $0x19,%dl
+  800b1c:	77 08                	ja     800b26 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800b1e:	0f be c0             	movsbl %al,%eax
+  800b21:	83 e8 37             	sub    $0x37,%eax
+  800b24:	eb ce                	jmp    800af4 <strisl+0x87>
+		else if (!*s)
+  800b26:	84 c0                	test   %al,%al
+  800b28:	0f 94 c0             	sete   %al
+  800b2b:	0f b6 c0             	movzbl %al,%eax
+  800b2e:	eb 05                	jmp    800b35 <strisl+0xc8>
+			return 0;
+  800b30:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800b35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b38:	5b                   	pop    %ebx
+  800b39:	5e                   	pop    %esi
+  800b3a:	5f                   	pop    %edi
+  800b3b:	5d                   	pop    %ebp
+  800b3c:	c3                   	ret
+
+00800b3d <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800b3d:	55                   	push   %ebp
+  800b3e:	89 e5                	mov    %esp,%ebp
+  800b40:	83 ec 10             	sub    $0x10,%esp
+  800b43:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800b46:	89 c8                	mov    %ecx,%eax
+  800b48:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800b4d:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800b50:	eb 0b                	jmp    800b5d <touch_mem+0x20>
+		c = *(char *)page;
+  800b52:	0f b6 10             	movzbl (%eax),%edx
+  800b55:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800b58:	05 00 10 00 00       	add    $0x1000,%eax
+  800b5d:	39 c8                	cmp    %ecx,%eax
+  800b5f:	72 f1                	jb     800b52 <touch_mem+0x15>
+}
+  800b61:	c9                   	leave
+  800b62:	c3                   	ret
+
+00800b63 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b63:	55                   	push   %ebp
+  800b64:	89 e5                	mov    %esp,%ebp
+  800b66:	57                   	push   %edi
+  800b67:	56                   	push   %esi
+  800b68:	53                   	push   %ebx
+	touch_mem(s, len);
+  800b69:	ff 75 0c             	push   0xc(%ebp)
+  800b6c:	ff 75 08             	push   0x8(%ebp)
+  800b6f:	e8 c9 ff ff ff       	call   800b3d <touch_mem>
+	asm volatile("int %1\n"
+  800b74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b7f:	89 c3                	mov    %eax,%ebx
+  800b81:	89 c7                	mov    %eax,%edi
+  800b83:	89 c6                	mov    %eax,%esi
+  800b85:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b87:	83 c4 08             	add    $0x8,%esp
+  800b8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b8d:	5b                   	pop    %ebx
+  800b8e:	5e                   	pop    %esi
+  800b8f:	5f                   	pop    %edi
+  800b90:	5d                   	pop    %ebp
+  800b91:	c3                   	ret
+
+00800b92 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b92:	55                   	push   %ebp
+  800b93:	89 e5                	mov    %esp,%ebp
+  800b95:	57                   	push   %edi
+  800b96:	56                   	push   %esi
+  800b97:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b98:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b9d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ba2:	89 d1                	mov    %edx,%ecx
+  800ba4:	89 d3                	mov    %edx,%ebx
+  800ba6:	89 d7                	mov    %edx,%edi
+  800ba8:	89 d6                	mov    %edx,%esi
+  800baa:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bac:	5b                   	pop    %ebx
+  800bad:	5e                   	pop    %esi
+  800bae:	5f                   	pop    %edi
+  800baf:	5d                   	pop    %ebp
+  800bb0:	c3                   	ret
+
+00800bb1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bb1:	55                   	push   %ebp
+  800bb2:	89 e5                	mov    %esp,%ebp
+  800bb4:	57                   	push   %edi
+  800bb5:	56                   	push   %esi
+  800bb6:	53                   	push   %ebx
+  800bb7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc2:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bc7:	89 cb                	mov    %ecx,%ebx
+  800bc9:	89 cf                	mov    %ecx,%edi
+  800bcb:	89 ce                	mov    %ecx,%esi
+  800bcd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bcf:	85 c0                	test   %eax,%eax
+  800bd1:	7f 08                	jg     800bdb <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bd6:	5b                   	pop    %ebx
+  800bd7:	5e                   	pop    %esi
+  800bd8:	5f                   	pop    %edi
+  800bd9:	5d                   	pop    %ebp
+  800bda:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bdb:	83 ec 0c             	sub    $0xc,%esp
+  800bde:	50                   	push   %eax
+  800bdf:	6a 03                	push   $0x3
+  800be1:	68 4b 2a 80 00       	push   $0x802a4b
+  800be6:	6a 23                	push   $0x23
+  800be8:	68 68 2a 80 00       	push   $0x802a68
+  800bed:	e8 b9 15 00 00       	call   8021ab <_panic>
+
+00800bf2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bf2:	55                   	push   %ebp
+  800bf3:	89 e5                	mov    %esp,%ebp
+  800bf5:	57                   	push   %edi
+  800bf6:	56                   	push   %esi
+  800bf7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bf8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bfd:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c02:	89 d1                	mov    %edx,%ecx
+  800c04:	89 d3                	mov    %edx,%ebx
+  800c06:	89 d7                	mov    %edx,%edi
+  800c08:	89 d6                	mov    %edx,%esi
+  800c0a:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c0c:	5b                   	pop    %ebx
+  800c0d:	5e                   	pop    %esi
+  800c0e:	5f                   	pop    %edi
+  800c0f:	5d                   	pop    %ebp
+  800c10:	c3                   	ret
+
+00800c11 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c11:	55                   	push   %ebp
+  800c12:	89 e5                	mov    %esp,%ebp
+  800c14:	57                   	push   %edi
+  800c15:	56                   	push   %esi
+  800c16:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c21:	89 d1                	mov    %edx,%ecx
+  800c23:	89 d3                	mov    %edx,%ebx
+  800c25:	89 d7                	mov    %edx,%edi
+  800c27:	89 d6                	mov    %edx,%esi
+  800c29:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c2b:	5b                   	pop    %ebx
+  800c2c:	5e                   	pop    %esi
+  800c2d:	5f                   	pop    %edi
+  800c2e:	5d                   	pop    %ebp
+  800c2f:	c3                   	ret
+
+00800c30 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c30:	55                   	push   %ebp
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	57                   	push   %edi
+  800c34:	56                   	push   %esi
+  800c35:	53                   	push   %ebx
+  800c36:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c39:	be 00 00 00 00       	mov    $0x0,%esi
+  800c3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c44:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c4c:	89 f7                	mov    %esi,%edi
+  800c4e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c50:	85 c0                	test   %eax,%eax
+  800c52:	7f 08                	jg     800c5c <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c57:	5b                   	pop    %ebx
+  800c58:	5e                   	pop    %esi
+  800c59:	5f                   	pop    %edi
+  800c5a:	5d                   	pop    %ebp
+  800c5b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c5c:	83 ec 0c             	sub    $0xc,%esp
+  800c5f:	50                   	push   %eax
+  800c60:	6a 04                	push   $0x4
+  800c62:	68 4b 2a 80 00       	push   $0x802a4b
+  800c67:	6a 23                	push   $0x23
+  800c69:	68 68 2a 80 00       	push   $0x802a68
+  800c6e:	e8 38 15 00 00       	call   8021ab <_panic>
+
+00800c73 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c73:	55                   	push   %ebp
+  800c74:	89 e5                	mov    %esp,%ebp
+  800c76:	57                   	push   %edi
+  800c77:	56                   	push   %esi
+  800c78:	53                   	push   %ebx
+  800c79:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c82:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c8a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c8d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c90:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c92:	85 c0                	test   %eax,%eax
+  800c94:	7f 08                	jg     800c9e <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c99:	5b                   	pop    %ebx
+  800c9a:	5e                   	pop    %esi
+  800c9b:	5f                   	pop    %edi
+  800c9c:	5d                   	pop    %ebp
+  800c9d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c9e:	83 ec 0c             	sub    $0xc,%esp
+  800ca1:	50                   	push   %eax
+  800ca2:	6a 05                	push   $0x5
+  800ca4:	68 4b 2a 80 00       	push   $0x802a4b
+  800ca9:	6a 23                	push   $0x23
+  800cab:	68 68 2a 80 00       	push   $0x802a68
+  800cb0:	e8 f6 14 00 00       	call   8021ab <_panic>
+
+00800cb5 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cb5:	55                   	push   %ebp
+  800cb6:	89 e5                	mov    %esp,%ebp
+  800cb8:	57                   	push   %edi
+  800cb9:	56                   	push   %esi
+  800cba:	53                   	push   %ebx
+  800cbb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc9:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cce:	89 df                	mov    %ebx,%edi
+  800cd0:	89 de                	mov    %ebx,%esi
+  800cd2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cd4:	85 c0                	test   %eax,%eax
+  800cd6:	7f 08                	jg     800ce0 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800cd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdb:	5b                   	pop    %ebx
+  800cdc:	5e                   	pop    %esi
+  800cdd:	5f                   	pop    %edi
+  800cde:	5d                   	pop    %ebp
+  800cdf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ce0:	83 ec 0c             	sub    $0xc,%esp
+  800ce3:	50                   	push   %eax
+  800ce4:	6a 06                	push   $0x6
+  800ce6:	68 4b 2a 80 00       	push   $0x802a4b
+  800ceb:	6a 23                	push   $0x23
+  800ced:	68 68 2a 80 00       	push   $0x802a68
+  800cf2:	e8 b4 14 00 00       	call   8021ab <_panic>
+
+00800cf7 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800cf7:	55                   	push   %ebp
+  800cf8:	89 e5                	mov    %esp,%ebp
+  800cfa:	57                   	push   %edi
+  800cfb:	56                   	push   %esi
+  800cfc:	53                   	push   %ebx
+  800cfd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d00:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d08:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0b:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d10:	89 df                	mov    %ebx,%edi
+  800d12:	89 de                	mov    %ebx,%esi
+  800d14:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d16:	85 c0                	test   %eax,%eax
+  800d18:	7f 08                	jg     800d22 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1d:	5b                   	pop    %ebx
+  800d1e:	5e                   	pop    %esi
+  800d1f:	5f                   	pop    %edi
+  800d20:	5d                   	pop    %ebp
+  800d21:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d22:	83 ec 0c             	sub    $0xc,%esp
+  800d25:	50                   	push   %eax
+  800d26:	6a 18                	push   $0x18
+  800d28:	68 4b 2a 80 00       	push   $0x802a4b
+  800d2d:	6a 23                	push   $0x23
+  800d2f:	68 68 2a 80 00       	push   $0x802a68
+  800d34:	e8 72 14 00 00       	call   8021ab <_panic>
+
+00800d39 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800d39:	55                   	push   %ebp
+  800d3a:	89 e5                	mov    %esp,%ebp
+  800d3c:	57                   	push   %edi
+  800d3d:	56                   	push   %esi
+  800d3e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d3f:	be 00 00 00 00       	mov    $0x0,%esi
+  800d44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4a:	b8 19 00 00 00       	mov    $0x19,%eax
+  800d4f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d52:	89 f7                	mov    %esi,%edi
+  800d54:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800d56:	5b                   	pop    %ebx
+  800d57:	5e                   	pop    %esi
+  800d58:	5f                   	pop    %edi
+  800d59:	5d                   	pop    %ebp
+  800d5a:	c3                   	ret
+
+00800d5b <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d5b:	55                   	push   %ebp
+  800d5c:	89 e5                	mov    %esp,%ebp
+  800d5e:	57                   	push   %edi
+  800d5f:	56                   	push   %esi
+  800d60:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d67:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d6c:	be 00 00 00 00       	mov    $0x0,%esi
+  800d71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d74:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d77:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800d79:	5b                   	pop    %ebx
+  800d7a:	5e                   	pop    %esi
+  800d7b:	5f                   	pop    %edi
+  800d7c:	5d                   	pop    %ebp
+  800d7d:	c3                   	ret
+
+00800d7e <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800d7e:	55                   	push   %ebp
+  800d7f:	89 e5                	mov    %esp,%ebp
+  800d81:	57                   	push   %edi
+  800d82:	56                   	push   %esi
+  800d83:	53                   	push   %ebx
+  800d84:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800d87:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800d8a:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800d90:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800d93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d99:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d9e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800da4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800da6:	85 c0                	test   %eax,%eax
+  800da8:	7f 08                	jg     800db2 <sys_page_map_range+0x34>
+}
+  800daa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dad:	5b                   	pop    %ebx
+  800dae:	5e                   	pop    %esi
+  800daf:	5f                   	pop    %edi
+  800db0:	5d                   	pop    %ebp
+  800db1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db2:	83 ec 0c             	sub    $0xc,%esp
+  800db5:	50                   	push   %eax
+  800db6:	6a 10                	push   $0x10
+  800db8:	68 4b 2a 80 00       	push   $0x802a4b
+  800dbd:	6a 23                	push   $0x23
+  800dbf:	68 68 2a 80 00       	push   $0x802a68
+  800dc4:	e8 e2 13 00 00       	call   8021ab <_panic>
+
+00800dc9 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800dc9:	55                   	push   %ebp
+  800dca:	89 e5                	mov    %esp,%ebp
+  800dcc:	57                   	push   %edi
+  800dcd:	56                   	push   %esi
+  800dce:	53                   	push   %ebx
+  800dcf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dd2:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ddd:	b8 11 00 00 00       	mov    $0x11,%eax
+  800de2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de5:	89 f7                	mov    %esi,%edi
+  800de7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de9:	85 c0                	test   %eax,%eax
+  800deb:	7f 08                	jg     800df5 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ded:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df0:	5b                   	pop    %ebx
+  800df1:	5e                   	pop    %esi
+  800df2:	5f                   	pop    %edi
+  800df3:	5d                   	pop    %ebp
+  800df4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df5:	83 ec 0c             	sub    $0xc,%esp
+  800df8:	50                   	push   %eax
+  800df9:	6a 11                	push   $0x11
+  800dfb:	68 4b 2a 80 00       	push   $0x802a4b
+  800e00:	6a 23                	push   $0x23
+  800e02:	68 68 2a 80 00       	push   $0x802a68
+  800e07:	e8 9f 13 00 00       	call   8021ab <_panic>
+
+00800e0c <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800e0c:	55                   	push   %ebp
+  800e0d:	89 e5                	mov    %esp,%ebp
+  800e0f:	57                   	push   %edi
+  800e10:	56                   	push   %esi
+  800e11:	53                   	push   %ebx
+  800e12:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e15:	be 00 00 00 00       	mov    $0x0,%esi
+  800e1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e20:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800e25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e28:	89 f7                	mov    %esi,%edi
+  800e2a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e2c:	85 c0                	test   %eax,%eax
+  800e2e:	7f 08                	jg     800e38 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e33:	5b                   	pop    %ebx
+  800e34:	5e                   	pop    %esi
+  800e35:	5f                   	pop    %edi
+  800e36:	5d                   	pop    %ebp
+  800e37:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e38:	83 ec 0c             	sub    $0xc,%esp
+  800e3b:	50                   	push   %eax
+  800e3c:	6a 1b                	push   $0x1b
+  800e3e:	68 4b 2a 80 00       	push   $0x802a4b
+  800e43:	6a 23                	push   $0x23
+  800e45:	68 68 2a 80 00       	push   $0x802a68
+  800e4a:	e8 5c 13 00 00       	call   8021ab <_panic>
+
+00800e4f <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800e4f:	55                   	push   %ebp
+  800e50:	89 e5                	mov    %esp,%ebp
+  800e52:	57                   	push   %edi
+  800e53:	56                   	push   %esi
+  800e54:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5a:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e5f:	89 d1                	mov    %edx,%ecx
+  800e61:	89 d3                	mov    %edx,%ebx
+  800e63:	89 d7                	mov    %edx,%edi
+  800e65:	89 d6                	mov    %edx,%esi
+  800e67:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800e69:	5b                   	pop    %ebx
+  800e6a:	5e                   	pop    %esi
+  800e6b:	5f                   	pop    %edi
+  800e6c:	5d                   	pop    %ebp
+  800e6d:	c3                   	ret
+
+00800e6e <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e6e:	55                   	push   %ebp
+  800e6f:	89 e5                	mov    %esp,%ebp
+  800e71:	57                   	push   %edi
+  800e72:	56                   	push   %esi
+  800e73:	53                   	push   %ebx
+  800e74:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e82:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e87:	89 df                	mov    %ebx,%edi
+  800e89:	89 de                	mov    %ebx,%esi
+  800e8b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e8d:	85 c0                	test   %eax,%eax
+  800e8f:	7f 08                	jg     800e99 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e94:	5b                   	pop    %ebx
+  800e95:	5e                   	pop    %esi
+  800e96:	5f                   	pop    %edi
+  800e97:	5d                   	pop    %ebp
+  800e98:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e99:	83 ec 0c             	sub    $0xc,%esp
+  800e9c:	50                   	push   %eax
+  800e9d:	6a 08                	push   $0x8
+  800e9f:	68 4b 2a 80 00       	push   $0x802a4b
+  800ea4:	6a 23                	push   $0x23
+  800ea6:	68 68 2a 80 00       	push   $0x802a68
+  800eab:	e8 fb 12 00 00       	call   8021ab <_panic>
+
+00800eb0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800eb0:	55                   	push   %ebp
+  800eb1:	89 e5                	mov    %esp,%ebp
+  800eb3:	57                   	push   %edi
+  800eb4:	56                   	push   %esi
+  800eb5:	53                   	push   %ebx
+  800eb6:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800eb9:	6a 44                	push   $0x44
+  800ebb:	ff 75 0c             	push   0xc(%ebp)
+  800ebe:	e8 7a fc ff ff       	call   800b3d <touch_mem>
+	asm volatile("int %1\n"
+  800ec3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ecb:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ed0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed3:	89 df                	mov    %ebx,%edi
+  800ed5:	89 de                	mov    %ebx,%esi
+  800ed7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ed9:	83 c4 08             	add    $0x8,%esp
+  800edc:	85 c0                	test   %eax,%eax
+  800ede:	7f 08                	jg     800ee8 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ee0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee3:	5b                   	pop    %ebx
+  800ee4:	5e                   	pop    %esi
+  800ee5:	5f                   	pop    %edi
+  800ee6:	5d                   	pop    %ebp
+  800ee7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ee8:	83 ec 0c             	sub    $0xc,%esp
+  800eeb:	50                   	push   %eax
+  800eec:	6a 09                	push   $0x9
+  800eee:	68 4b 2a 80 00       	push   $0x802a4b
+  800ef3:	6a 23                	push   $0x23
+  800ef5:	68 68 2a 80 00       	push   $0x802a68
+  800efa:	e8 ac 12 00 00       	call   8021ab <_panic>
+
+00800eff <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800eff:	55                   	push   %ebp
+  800f00:	89 e5                	mov    %esp,%ebp
+  800f02:	57                   	push   %edi
+  800f03:	56                   	push   %esi
+  800f04:	53                   	push   %ebx
+  800f05:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f08:	be 00 00 00 00       	mov    $0x0,%esi
+  800f0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f13:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800f18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f1b:	89 f7                	mov    %esi,%edi
+  800f1d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f1f:	85 c0                	test   %eax,%eax
+  800f21:	7f 08                	jg     800f2b <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800f23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f26:	5b                   	pop    %ebx
+  800f27:	5e                   	pop    %esi
+  800f28:	5f                   	pop    %edi
+  800f29:	5d                   	pop    %ebp
+  800f2a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f2b:	83 ec 0c             	sub    $0xc,%esp
+  800f2e:	50                   	push   %eax
+  800f2f:	6a 1a                	push   $0x1a
+  800f31:	68 4b 2a 80 00       	push   $0x802a4b
+  800f36:	6a 23                	push   $0x23
+  800f38:	68 68 2a 80 00       	push   $0x802a68
+  800f3d:	e8 69 12 00 00       	call   8021ab <_panic>
+
+00800f42 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  800f42:	55                   	push   %ebp
+  800f43:	89 e5                	mov    %esp,%ebp
+  800f45:	57                   	push   %edi
+  800f46:	56                   	push   %esi
+  800f47:	53                   	push   %ebx
+  800f48:	83 ec 0c             	sub    $0xc,%esp
+  800f4b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  800f4e:	89 d8                	mov    %ebx,%eax
+  800f50:	c1 e0 05             	shl    $0x5,%eax
+  800f53:	50                   	push   %eax
+  800f54:	ff 75 0c             	push   0xc(%ebp)
+  800f57:	e8 e1 fb ff ff       	call   800b3d <touch_mem>
+	asm volatile("int %1\n"
+  800f5c:	be 00 00 00 00       	mov    $0x0,%esi
+  800f61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f64:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6c:	89 f7                	mov    %esi,%edi
+  800f6e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f70:	83 c4 08             	add    $0x8,%esp
+  800f73:	85 c0                	test   %eax,%eax
+  800f75:	7f 08                	jg     800f7f <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  800f77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7a:	5b                   	pop    %ebx
+  800f7b:	5e                   	pop    %esi
+  800f7c:	5f                   	pop    %edi
+  800f7d:	5d                   	pop    %ebp
+  800f7e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f7f:	83 ec 0c             	sub    $0xc,%esp
+  800f82:	50                   	push   %eax
+  800f83:	6a 13                	push   $0x13
+  800f85:	68 4b 2a 80 00       	push   $0x802a4b
+  800f8a:	6a 23                	push   $0x23
+  800f8c:	68 68 2a 80 00       	push   $0x802a68
+  800f91:	e8 15 12 00 00       	call   8021ab <_panic>
+
+00800f96 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f96:	55                   	push   %ebp
+  800f97:	89 e5                	mov    %esp,%ebp
+  800f99:	57                   	push   %edi
+  800f9a:	56                   	push   %esi
+  800f9b:	53                   	push   %ebx
+  800f9c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800faf:	89 df                	mov    %ebx,%edi
+  800fb1:	89 de                	mov    %ebx,%esi
+  800fb3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb5:	85 c0                	test   %eax,%eax
+  800fb7:	7f 08                	jg     800fc1 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbc:	5b                   	pop    %ebx
+  800fbd:	5e                   	pop    %esi
+  800fbe:	5f                   	pop    %edi
+  800fbf:	5d                   	pop    %ebp
+  800fc0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc1:	83 ec 0c             	sub    $0xc,%esp
+  800fc4:	50                   	push   %eax
+  800fc5:	6a 0a                	push   $0xa
+  800fc7:	68 4b 2a 80 00       	push   $0x802a4b
+  800fcc:	6a 23                	push   $0x23
+  800fce:	68 68 2a 80 00       	push   $0x802a68
+  800fd3:	e8 d3 11 00 00       	call   8021ab <_panic>
+
+00800fd8 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fd8:	55                   	push   %ebp
+  800fd9:	89 e5                	mov    %esp,%ebp
+  800fdb:	57                   	push   %edi
+  800fdc:	56                   	push   %esi
+  800fdd:	53                   	push   %ebx
+  800fde:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  800fe1:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800fe7:	76 1d                	jbe    801006 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  800fe9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fef:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ff4:	be 01 00 00 00       	mov    $0x1,%esi
+  800ff9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ffc:	cd 30                	int    $0x30
+}
+  800ffe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801001:	5b                   	pop    %ebx
+  801002:	5e                   	pop    %esi
+  801003:	5f                   	pop    %edi
+  801004:	5d                   	pop    %ebp
+  801005:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801006:	68 00 10 00 00       	push   $0x1000
+  80100b:	53                   	push   %ebx
+  80100c:	e8 2c fb ff ff       	call   800b3d <touch_mem>
+  801011:	83 c4 08             	add    $0x8,%esp
+  801014:	eb d3                	jmp    800fe9 <sys_ipc_send+0x11>
+
+00801016 <sys_ipc_send_pages>:
+{
+  801016:	55                   	push   %ebp
+  801017:	89 e5                	mov    %esp,%ebp
+  801019:	57                   	push   %edi
+  80101a:	56                   	push   %esi
+  80101b:	53                   	push   %ebx
+  80101c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80101f:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801022:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801028:	76 18                	jbe    801042 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80102a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801030:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801035:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801038:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  80103a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103d:	5b                   	pop    %ebx
+  80103e:	5e                   	pop    %esi
+  80103f:	5f                   	pop    %edi
+  801040:	5d                   	pop    %ebp
+  801041:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801042:	89 f0                	mov    %esi,%eax
+  801044:	c1 e0 0c             	shl    $0xc,%eax
+  801047:	50                   	push   %eax
+  801048:	53                   	push   %ebx
+  801049:	e8 ef fa ff ff       	call   800b3d <touch_mem>
+  80104e:	83 c4 08             	add    $0x8,%esp
+  801051:	eb d7                	jmp    80102a <sys_ipc_send_pages+0x14>
+
+00801053 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801053:	55                   	push   %ebp
+  801054:	89 e5                	mov    %esp,%ebp
+  801056:	57                   	push   %edi
+  801057:	56                   	push   %esi
+  801058:	53                   	push   %ebx
+  801059:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80105c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801061:	8b 55 08             	mov    0x8(%ebp),%edx
+  801064:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801067:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80106c:	89 df                	mov    %ebx,%edi
+  80106e:	89 de                	mov    %ebx,%esi
+  801070:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801072:	85 c0                	test   %eax,%eax
+  801074:	7f 08                	jg     80107e <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801076:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801079:	5b                   	pop    %ebx
+  80107a:	5e                   	pop    %esi
+  80107b:	5f                   	pop    %edi
+  80107c:	5d                   	pop    %ebp
+  80107d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107e:	83 ec 0c             	sub    $0xc,%esp
+  801081:	50                   	push   %eax
+  801082:	6a 0d                	push   $0xd
+  801084:	68 4b 2a 80 00       	push   $0x802a4b
+  801089:	6a 23                	push   $0x23
+  80108b:	68 68 2a 80 00       	push   $0x802a68
+  801090:	e8 16 11 00 00       	call   8021ab <_panic>
+
+00801095 <sys_ipc_recv>:
+{
+  801095:	55                   	push   %ebp
+  801096:	89 e5                	mov    %esp,%ebp
+  801098:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80109b:	6a 01                	push   $0x1
+  80109d:	ff 75 08             	push   0x8(%ebp)
+  8010a0:	e8 ae ff ff ff       	call   801053 <sys_ipc_recv_pages>
+}
+  8010a5:	c9                   	leave
+  8010a6:	c3                   	ret
+
+008010a7 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8010a7:	55                   	push   %ebp
+  8010a8:	89 e5                	mov    %esp,%ebp
+  8010aa:	57                   	push   %edi
+  8010ab:	56                   	push   %esi
+  8010ac:	53                   	push   %ebx
+  8010ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010b3:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  8010b6:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010bc:	77 04                	ja     8010c2 <sys_ipc_call+0x1b>
+  8010be:	85 f6                	test   %esi,%esi
+  8010c0:	75 15                	jne    8010d7 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8010c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c8:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010cd:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8010cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d2:	5b                   	pop    %ebx
+  8010d3:	5e                   	pop    %esi
+  8010d4:	5f                   	pop    %edi
+  8010d5:	5d                   	pop    %ebp
+  8010d6:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8010d7:	89 f8                	mov    %edi,%eax
+  8010d9:	c1 e0 0c             	shl    $0xc,%eax
+  8010dc:	50                   	push   %eax
+  8010dd:	53                   	push   %ebx
+  8010de:	e8 5a fa ff ff       	call   800b3d <touch_mem>
+  8010e3:	83 c4 08             	add    $0x8,%esp
+  8010e6:	eb da                	jmp    8010c2 <sys_ipc_call+0x1b>
+
+008010e8 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8010e8:	55                   	push   %ebp
+  8010e9:	89 e5                	mov    %esp,%ebp
+  8010eb:	57                   	push   %edi
+  8010ec:	56                   	push   %esi
+  8010ed:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f4:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010fc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ff:	8b 75 18             	mov    0x18(%ebp),%esi
+  801102:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801104:	5b                   	pop    %ebx
+  801105:	5e                   	pop    %esi
+  801106:	5f                   	pop    %edi
+  801107:	5d                   	pop    %ebp
+  801108:	c3                   	ret
+
+00801109 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  801109:	55                   	push   %ebp
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	57                   	push   %edi
+  80110d:	56                   	push   %esi
+  80110e:	53                   	push   %ebx
+  80110f:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801112:	6a 04                	push   $0x4
+  801114:	ff 75 08             	push   0x8(%ebp)
+  801117:	e8 21 fa ff ff       	call   800b3d <touch_mem>
+	asm volatile("int %1\n"
+  80111c:	be 00 00 00 00       	mov    $0x0,%esi
+  801121:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801124:	b8 16 00 00 00       	mov    $0x16,%eax
+  801129:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80112f:	89 f7                	mov    %esi,%edi
+  801131:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801133:	83 c4 08             	add    $0x8,%esp
+  801136:	85 c0                	test   %eax,%eax
+  801138:	7f 08                	jg     801142 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  80113a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80113d:	5b                   	pop    %ebx
+  80113e:	5e                   	pop    %esi
+  80113f:	5f                   	pop    %edi
+  801140:	5d                   	pop    %ebp
+  801141:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801142:	83 ec 0c             	sub    $0xc,%esp
+  801145:	50                   	push   %eax
+  801146:	6a 16                	push   $0x16
+  801148:	68 4b 2a 80 00       	push   $0x802a4b
+  80114d:	6a 23                	push   $0x23
+  80114f:	68 68 2a 80 00       	push   $0x802a68
+  801154:	e8 52 10 00 00       	call   8021ab <_panic>
+
+00801159 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801159:	55                   	push   %ebp
+  80115a:	89 e5                	mov    %esp,%ebp
+  80115c:	57                   	push   %edi
+  80115d:	56                   	push   %esi
+  80115e:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  80115f:	6a 04                	push   $0x4
+  801161:	ff 75 08             	push   0x8(%ebp)
+  801164:	e8 d4 f9 ff ff       	call   800b3d <touch_mem>
+	asm volatile("int %1\n"
+  801169:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801171:	b8 17 00 00 00       	mov    $0x17,%eax
+  801176:	8b 55 08             	mov    0x8(%ebp),%edx
+  801179:	89 df                	mov    %ebx,%edi
+  80117b:	89 de                	mov    %ebx,%esi
+  80117d:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80117f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801182:	5b                   	pop    %ebx
+  801183:	5e                   	pop    %esi
+  801184:	5f                   	pop    %edi
+  801185:	5d                   	pop    %ebp
+  801186:	c3                   	ret
+
+00801187 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  801187:	55                   	push   %ebp
+  801188:	89 e5                	mov    %esp,%ebp
+  80118a:	57                   	push   %edi
+  80118b:	56                   	push   %esi
+  80118c:	53                   	push   %ebx
+  80118d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801190:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801195:	8b 55 08             	mov    0x8(%ebp),%edx
+  801198:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80119d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011a2:	89 df                	mov    %ebx,%edi
+  8011a4:	89 de                	mov    %ebx,%esi
+  8011a6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011a8:	85 c0                	test   %eax,%eax
+  8011aa:	7f 08                	jg     8011b4 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  8011ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011af:	5b                   	pop    %ebx
+  8011b0:	5e                   	pop    %esi
+  8011b1:	5f                   	pop    %edi
+  8011b2:	5d                   	pop    %ebp
+  8011b3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b4:	83 ec 0c             	sub    $0xc,%esp
+  8011b7:	50                   	push   %eax
+  8011b8:	6a 0e                	push   $0xe
+  8011ba:	68 4b 2a 80 00       	push   $0x802a4b
+  8011bf:	6a 23                	push   $0x23
+  8011c1:	68 68 2a 80 00       	push   $0x802a68
+  8011c6:	e8 e0 0f 00 00       	call   8021ab <_panic>
+
+008011cb <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8011cb:	55                   	push   %ebp
+  8011cc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d1:	05 00 00 00 30       	add    $0x30000000,%eax
+  8011d6:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8011d9:	5d                   	pop    %ebp
+  8011da:	c3                   	ret
+
+008011db <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8011db:	55                   	push   %ebp
+  8011dc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011e1:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8011e6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011eb:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8011f0:	5d                   	pop    %ebp
+  8011f1:	c3                   	ret
+
+008011f2 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8011f2:	55                   	push   %ebp
+  8011f3:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8011f5:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8011fa:	a8 01                	test   $0x1,%al
+  8011fc:	74 3c                	je     80123a <fd_alloc+0x48>
+  8011fe:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801203:	89 c2                	mov    %eax,%edx
+  801205:	c1 ea 0c             	shr    $0xc,%edx
+  801208:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80120f:	89 c1                	mov    %eax,%ecx
+  801211:	05 00 10 00 00       	add    $0x1000,%eax
+  801216:	f6 c2 01             	test   $0x1,%dl
+  801219:	74 13                	je     80122e <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80121b:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801220:	75 e1                	jne    801203 <fd_alloc+0x11>
+  801222:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801227:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80122c:	eb 05                	jmp    801233 <fd_alloc+0x41>
+			return 0;
+  80122e:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801233:	8b 55 08             	mov    0x8(%ebp),%edx
+  801236:	89 0a                	mov    %ecx,(%edx)
+}
+  801238:	5d                   	pop    %ebp
+  801239:	c3                   	ret
+  80123a:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  80123f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801244:	eb ed                	jmp    801233 <fd_alloc+0x41>
+
+00801246 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801246:	55                   	push   %ebp
+  801247:	89 e5                	mov    %esp,%ebp
+  801249:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80124c:	83 f8 1f             	cmp    $0x1f,%eax
+  80124f:	77 30                	ja     801281 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801251:	c1 e0 0c             	shl    $0xc,%eax
+  801254:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801259:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80125f:	f6 c2 01             	test   $0x1,%dl
+  801262:	74 24                	je     801288 <fd_lookup+0x42>
+  801264:	89 c2                	mov    %eax,%edx
+  801266:	c1 ea 0c             	shr    $0xc,%edx
+  801269:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801270:	f6 c2 01             	test   $0x1,%dl
+  801273:	74 1a                	je     80128f <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801275:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801278:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80127a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80127f:	5d                   	pop    %ebp
+  801280:	c3                   	ret
+		return -E_INVAL;
+  801281:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801286:	eb f7                	jmp    80127f <fd_lookup+0x39>
+		return -E_INVAL;
+  801288:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80128d:	eb f0                	jmp    80127f <fd_lookup+0x39>
+  80128f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801294:	eb e9                	jmp    80127f <fd_lookup+0x39>
+
+00801296 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801296:	55                   	push   %ebp
+  801297:	89 e5                	mov    %esp,%ebp
+  801299:	53                   	push   %ebx
+  80129a:	83 ec 04             	sub    $0x4,%esp
+  80129d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8012a0:	b8 f4 2a 80 00       	mov    $0x802af4,%eax
+  8012a5:	8b 18                	mov    (%eax),%ebx
+  8012a7:	85 db                	test   %ebx,%ebx
+  8012a9:	74 0e                	je     8012b9 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  8012ab:	83 c0 04             	add    $0x4,%eax
+  8012ae:	39 13                	cmp    %edx,(%ebx)
+  8012b0:	75 f3                	jne    8012a5 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  8012b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b7:	eb 1f                	jmp    8012d8 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8012b9:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012be:	8b 40 48             	mov    0x48(%eax),%eax
+  8012c1:	83 ec 04             	sub    $0x4,%esp
+  8012c4:	52                   	push   %edx
+  8012c5:	50                   	push   %eax
+  8012c6:	68 78 2a 80 00       	push   $0x802a78
+  8012cb:	e8 86 ee ff ff       	call   800156 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8012d0:	83 c4 10             	add    $0x10,%esp
+  8012d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8012d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012db:	89 1a                	mov    %ebx,(%edx)
+}
+  8012dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012e0:	c9                   	leave
+  8012e1:	c3                   	ret
+
+008012e2 <fd_close>:
+{
+  8012e2:	55                   	push   %ebp
+  8012e3:	89 e5                	mov    %esp,%ebp
+  8012e5:	57                   	push   %edi
+  8012e6:	56                   	push   %esi
+  8012e7:	53                   	push   %ebx
+  8012e8:	83 ec 24             	sub    $0x24,%esp
+  8012eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012ee:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012f1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012f4:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012f5:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8012fb:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012fe:	50                   	push   %eax
+  8012ff:	e8 42 ff ff ff       	call   801246 <fd_lookup>
+  801304:	89 c3                	mov    %eax,%ebx
+  801306:	83 c4 10             	add    $0x10,%esp
+  801309:	85 c0                	test   %eax,%eax
+  80130b:	78 05                	js     801312 <fd_close+0x30>
+	    || fd != fd2)
+  80130d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801310:	74 16                	je     801328 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801312:	89 f8                	mov    %edi,%eax
+  801314:	84 c0                	test   %al,%al
+  801316:	b8 00 00 00 00       	mov    $0x0,%eax
+  80131b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80131e:	89 d8                	mov    %ebx,%eax
+  801320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801323:	5b                   	pop    %ebx
+  801324:	5e                   	pop    %esi
+  801325:	5f                   	pop    %edi
+  801326:	5d                   	pop    %ebp
+  801327:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801328:	83 ec 08             	sub    $0x8,%esp
+  80132b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80132e:	50                   	push   %eax
+  80132f:	ff 36                	push   (%esi)
+  801331:	e8 60 ff ff ff       	call   801296 <dev_lookup>
+  801336:	89 c3                	mov    %eax,%ebx
+  801338:	83 c4 10             	add    $0x10,%esp
+  80133b:	85 c0                	test   %eax,%eax
+  80133d:	78 1a                	js     801359 <fd_close+0x77>
+		if (dev->dev_close)
+  80133f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801342:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801345:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80134a:	85 c0                	test   %eax,%eax
+  80134c:	74 0b                	je     801359 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80134e:	83 ec 0c             	sub    $0xc,%esp
+  801351:	56                   	push   %esi
+  801352:	ff d0                	call   *%eax
+  801354:	89 c3                	mov    %eax,%ebx
+  801356:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801359:	83 ec 08             	sub    $0x8,%esp
+  80135c:	56                   	push   %esi
+  80135d:	6a 00                	push   $0x0
+  80135f:	e8 51 f9 ff ff       	call   800cb5 <sys_page_unmap>
+	return r;
+  801364:	83 c4 10             	add    $0x10,%esp
+  801367:	eb b5                	jmp    80131e <fd_close+0x3c>
+
+00801369 <close>:
+
+int
+close(int fdnum)
+{
+  801369:	55                   	push   %ebp
+  80136a:	89 e5                	mov    %esp,%ebp
+  80136c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80136f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801372:	50                   	push   %eax
+  801373:	ff 75 08             	push   0x8(%ebp)
+  801376:	e8 cb fe ff ff       	call   801246 <fd_lookup>
+  80137b:	83 c4 10             	add    $0x10,%esp
+  80137e:	85 c0                	test   %eax,%eax
+  801380:	79 02                	jns    801384 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801382:	c9                   	leave
+  801383:	c3                   	ret
+		return fd_close(fd, 1);
+  801384:	83 ec 08             	sub    $0x8,%esp
+  801387:	6a 01                	push   $0x1
+  801389:	ff 75 f4             	push   -0xc(%ebp)
+  80138c:	e8 51 ff ff ff       	call   8012e2 <fd_close>
+  801391:	83 c4 10             	add    $0x10,%esp
+  801394:	eb ec                	jmp    801382 <close+0x19>
+
+00801396 <close_all>:
+
+void
+close_all(void)
+{
+  801396:	55                   	push   %ebp
+  801397:	89 e5                	mov    %esp,%ebp
+  801399:	53                   	push   %ebx
+  80139a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80139d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8013a2:	83 ec 0c             	sub    $0xc,%esp
+  8013a5:	53                   	push   %ebx
+  8013a6:	e8 be ff ff ff       	call   801369 <close>
+	for (i = 0; i < MAXFD; i++)
+  8013ab:	83 c3 01             	add    $0x1,%ebx
+  8013ae:	83 c4 10             	add    $0x10,%esp
+  8013b1:	83 fb 20             	cmp    $0x20,%ebx
+  8013b4:	75 ec                	jne    8013a2 <close_all+0xc>
+}
+  8013b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013b9:	c9                   	leave
+  8013ba:	c3                   	ret
+
+008013bb <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8013bb:	55                   	push   %ebp
+  8013bc:	89 e5                	mov    %esp,%ebp
+  8013be:	57                   	push   %edi
+  8013bf:	56                   	push   %esi
+  8013c0:	53                   	push   %ebx
+  8013c1:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8013c4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013c7:	50                   	push   %eax
+  8013c8:	ff 75 08             	push   0x8(%ebp)
+  8013cb:	e8 76 fe ff ff       	call   801246 <fd_lookup>
+  8013d0:	89 c3                	mov    %eax,%ebx
+  8013d2:	83 c4 10             	add    $0x10,%esp
+  8013d5:	85 c0                	test   %eax,%eax
+  8013d7:	78 7f                	js     801458 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8013d9:	83 ec 0c             	sub    $0xc,%esp
+  8013dc:	ff 75 0c             	push   0xc(%ebp)
+  8013df:	e8 85 ff ff ff       	call   801369 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8013e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013e7:	c1 e6 0c             	shl    $0xc,%esi
+  8013ea:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8013f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8013f3:	89 3c 24             	mov    %edi,(%esp)
+  8013f6:	e8 e0 fd ff ff       	call   8011db <fd2data>
+  8013fb:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8013fd:	89 34 24             	mov    %esi,(%esp)
+  801400:	e8 d6 fd ff ff       	call   8011db <fd2data>
+  801405:	83 c4 10             	add    $0x10,%esp
+  801408:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80140b:	89 d8                	mov    %ebx,%eax
+  80140d:	c1 e8 16             	shr    $0x16,%eax
+  801410:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801417:	a8 01                	test   $0x1,%al
+  801419:	74 11                	je     80142c <dup+0x71>
+  80141b:	89 d8                	mov    %ebx,%eax
+  80141d:	c1 e8 0c             	shr    $0xc,%eax
+  801420:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801427:	f6 c2 01             	test   $0x1,%dl
+  80142a:	75 36                	jne    801462 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80142c:	89 f8                	mov    %edi,%eax
+  80142e:	c1 e8 0c             	shr    $0xc,%eax
+  801431:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801438:	83 ec 0c             	sub    $0xc,%esp
+  80143b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801440:	50                   	push   %eax
+  801441:	56                   	push   %esi
+  801442:	6a 00                	push   $0x0
+  801444:	57                   	push   %edi
+  801445:	6a 00                	push   $0x0
+  801447:	e8 27 f8 ff ff       	call   800c73 <sys_page_map>
+  80144c:	89 c3                	mov    %eax,%ebx
+  80144e:	83 c4 20             	add    $0x20,%esp
+  801451:	85 c0                	test   %eax,%eax
+  801453:	78 33                	js     801488 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801455:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801458:	89 d8                	mov    %ebx,%eax
+  80145a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80145d:	5b                   	pop    %ebx
+  80145e:	5e                   	pop    %esi
+  80145f:	5f                   	pop    %edi
+  801460:	5d                   	pop    %ebp
+  801461:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801462:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801469:	83 ec 0c             	sub    $0xc,%esp
+  80146c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801471:	50                   	push   %eax
+  801472:	ff 75 d4             	push   -0x2c(%ebp)
+  801475:	6a 00                	push   $0x0
+  801477:	53                   	push   %ebx
+  801478:	6a 00                	push   $0x0
+  80147a:	e8 f4 f7 ff ff       	call   800c73 <sys_page_map>
+  80147f:	89 c3                	mov    %eax,%ebx
+  801481:	83 c4 20             	add    $0x20,%esp
+  801484:	85 c0                	test   %eax,%eax
+  801486:	79 a4                	jns    80142c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801488:	83 ec 08             	sub    $0x8,%esp
+  80148b:	56                   	push   %esi
+  80148c:	6a 00                	push   $0x0
+  80148e:	e8 22 f8 ff ff       	call   800cb5 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801493:	83 c4 08             	add    $0x8,%esp
+  801496:	ff 75 d4             	push   -0x2c(%ebp)
+  801499:	6a 00                	push   $0x0
+  80149b:	e8 15 f8 ff ff       	call   800cb5 <sys_page_unmap>
+	return r;
+  8014a0:	83 c4 10             	add    $0x10,%esp
+  8014a3:	eb b3                	jmp    801458 <dup+0x9d>
+
+008014a5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8014a5:	55                   	push   %ebp
+  8014a6:	89 e5                	mov    %esp,%ebp
+  8014a8:	56                   	push   %esi
+  8014a9:	53                   	push   %ebx
+  8014aa:	83 ec 18             	sub    $0x18,%esp
+  8014ad:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014b0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014b3:	50                   	push   %eax
+  8014b4:	56                   	push   %esi
+  8014b5:	e8 8c fd ff ff       	call   801246 <fd_lookup>
+  8014ba:	83 c4 10             	add    $0x10,%esp
+  8014bd:	85 c0                	test   %eax,%eax
+  8014bf:	78 3c                	js     8014fd <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014c1:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014c4:	83 ec 08             	sub    $0x8,%esp
+  8014c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014ca:	50                   	push   %eax
+  8014cb:	ff 33                	push   (%ebx)
+  8014cd:	e8 c4 fd ff ff       	call   801296 <dev_lookup>
+  8014d2:	83 c4 10             	add    $0x10,%esp
+  8014d5:	85 c0                	test   %eax,%eax
+  8014d7:	78 24                	js     8014fd <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014d9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8014dc:	83 e0 03             	and    $0x3,%eax
+  8014df:	83 f8 01             	cmp    $0x1,%eax
+  8014e2:	74 20                	je     801504 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8014e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014e7:	8b 40 08             	mov    0x8(%eax),%eax
+  8014ea:	85 c0                	test   %eax,%eax
+  8014ec:	74 37                	je     801525 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8014ee:	83 ec 04             	sub    $0x4,%esp
+  8014f1:	ff 75 10             	push   0x10(%ebp)
+  8014f4:	ff 75 0c             	push   0xc(%ebp)
+  8014f7:	53                   	push   %ebx
+  8014f8:	ff d0                	call   *%eax
+  8014fa:	83 c4 10             	add    $0x10,%esp
+}
+  8014fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801500:	5b                   	pop    %ebx
+  801501:	5e                   	pop    %esi
+  801502:	5d                   	pop    %ebp
+  801503:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801504:	a1 08 40 80 00       	mov    0x804008,%eax
+  801509:	8b 40 48             	mov    0x48(%eax),%eax
+  80150c:	83 ec 04             	sub    $0x4,%esp
+  80150f:	56                   	push   %esi
+  801510:	50                   	push   %eax
+  801511:	68 b9 2a 80 00       	push   $0x802ab9
+  801516:	e8 3b ec ff ff       	call   800156 <cprintf>
+		return -E_INVAL;
+  80151b:	83 c4 10             	add    $0x10,%esp
+  80151e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801523:	eb d8                	jmp    8014fd <read+0x58>
+		return -E_NOT_SUPP;
+  801525:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80152a:	eb d1                	jmp    8014fd <read+0x58>
+
+0080152c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80152c:	55                   	push   %ebp
+  80152d:	89 e5                	mov    %esp,%ebp
+  80152f:	57                   	push   %edi
+  801530:	56                   	push   %esi
+  801531:	53                   	push   %ebx
+  801532:	83 ec 0c             	sub    $0xc,%esp
+  801535:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801538:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80153b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801540:	eb 02                	jmp    801544 <readn+0x18>
+  801542:	01 c3                	add    %eax,%ebx
+  801544:	39 f3                	cmp    %esi,%ebx
+  801546:	73 21                	jae    801569 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801548:	83 ec 04             	sub    $0x4,%esp
+  80154b:	89 f0                	mov    %esi,%eax
+  80154d:	29 d8                	sub    %ebx,%eax
+  80154f:	50                   	push   %eax
+  801550:	89 d8                	mov    %ebx,%eax
+  801552:	03 45 0c             	add    0xc(%ebp),%eax
+  801555:	50                   	push   %eax
+  801556:	57                   	push   %edi
+  801557:	e8 49 ff ff ff       	call   8014a5 <read>
+		if (m < 0)
+  80155c:	83 c4 10             	add    $0x10,%esp
+  80155f:	85 c0                	test   %eax,%eax
+  801561:	78 04                	js     801567 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801563:	75 dd                	jne    801542 <readn+0x16>
+  801565:	eb 02                	jmp    801569 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801567:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801569:	89 d8                	mov    %ebx,%eax
+  80156b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80156e:	5b                   	pop    %ebx
+  80156f:	5e                   	pop    %esi
+  801570:	5f                   	pop    %edi
+  801571:	5d                   	pop    %ebp
+  801572:	c3                   	ret
+
+00801573 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801573:	55                   	push   %ebp
+  801574:	89 e5                	mov    %esp,%ebp
+  801576:	56                   	push   %esi
+  801577:	53                   	push   %ebx
+  801578:	83 ec 18             	sub    $0x18,%esp
+  80157b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80157e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801581:	50                   	push   %eax
+  801582:	53                   	push   %ebx
+  801583:	e8 be fc ff ff       	call   801246 <fd_lookup>
+  801588:	83 c4 10             	add    $0x10,%esp
+  80158b:	85 c0                	test   %eax,%eax
+  80158d:	78 37                	js     8015c6 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80158f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801592:	83 ec 08             	sub    $0x8,%esp
+  801595:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801598:	50                   	push   %eax
+  801599:	ff 36                	push   (%esi)
+  80159b:	e8 f6 fc ff ff       	call   801296 <dev_lookup>
+  8015a0:	83 c4 10             	add    $0x10,%esp
+  8015a3:	85 c0                	test   %eax,%eax
+  8015a5:	78 1f                	js     8015c6 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015a7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015ab:	74 20                	je     8015cd <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8015ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015b0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015b3:	85 c0                	test   %eax,%eax
+  8015b5:	74 37                	je     8015ee <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8015b7:	83 ec 04             	sub    $0x4,%esp
+  8015ba:	ff 75 10             	push   0x10(%ebp)
+  8015bd:	ff 75 0c             	push   0xc(%ebp)
+  8015c0:	56                   	push   %esi
+  8015c1:	ff d0                	call   *%eax
+  8015c3:	83 c4 10             	add    $0x10,%esp
+}
+  8015c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015c9:	5b                   	pop    %ebx
+  8015ca:	5e                   	pop    %esi
+  8015cb:	5d                   	pop    %ebp
+  8015cc:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015cd:	a1 08 40 80 00       	mov    0x804008,%eax
+  8015d2:	8b 40 48             	mov    0x48(%eax),%eax
+  8015d5:	83 ec 04             	sub    $0x4,%esp
+  8015d8:	53                   	push   %ebx
+  8015d9:	50                   	push   %eax
+  8015da:	68 d5 2a 80 00       	push   $0x802ad5
+  8015df:	e8 72 eb ff ff       	call   800156 <cprintf>
+		return -E_INVAL;
+  8015e4:	83 c4 10             	add    $0x10,%esp
+  8015e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ec:	eb d8                	jmp    8015c6 <write+0x53>
+		return -E_NOT_SUPP;
+  8015ee:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015f3:	eb d1                	jmp    8015c6 <write+0x53>
+
+008015f5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015f5:	55                   	push   %ebp
+  8015f6:	89 e5                	mov    %esp,%ebp
+  8015f8:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015fe:	50                   	push   %eax
+  8015ff:	ff 75 08             	push   0x8(%ebp)
+  801602:	e8 3f fc ff ff       	call   801246 <fd_lookup>
+  801607:	83 c4 10             	add    $0x10,%esp
+  80160a:	85 c0                	test   %eax,%eax
+  80160c:	78 0e                	js     80161c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80160e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801611:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801614:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801617:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80161c:	c9                   	leave
+  80161d:	c3                   	ret
+
+0080161e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80161e:	55                   	push   %ebp
+  80161f:	89 e5                	mov    %esp,%ebp
+  801621:	56                   	push   %esi
+  801622:	53                   	push   %ebx
+  801623:	83 ec 18             	sub    $0x18,%esp
+  801626:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801629:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80162c:	50                   	push   %eax
+  80162d:	53                   	push   %ebx
+  80162e:	e8 13 fc ff ff       	call   801246 <fd_lookup>
+  801633:	83 c4 10             	add    $0x10,%esp
+  801636:	85 c0                	test   %eax,%eax
+  801638:	78 34                	js     80166e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80163a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80163d:	83 ec 08             	sub    $0x8,%esp
+  801640:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801643:	50                   	push   %eax
+  801644:	ff 36                	push   (%esi)
+  801646:	e8 4b fc ff ff       	call   801296 <dev_lookup>
+  80164b:	83 c4 10             	add    $0x10,%esp
+  80164e:	85 c0                	test   %eax,%eax
+  801650:	78 1c                	js     80166e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801652:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801656:	74 1d                	je     801675 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801658:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80165b:	8b 40 18             	mov    0x18(%eax),%eax
+  80165e:	85 c0                	test   %eax,%eax
+  801660:	74 34                	je     801696 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801662:	83 ec 08             	sub    $0x8,%esp
+  801665:	ff 75 0c             	push   0xc(%ebp)
+  801668:	56                   	push   %esi
+  801669:	ff d0                	call   *%eax
+  80166b:	83 c4 10             	add    $0x10,%esp
+}
+  80166e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801671:	5b                   	pop    %ebx
+  801672:	5e                   	pop    %esi
+  801673:	5d                   	pop    %ebp
+  801674:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801675:	a1 08 40 80 00       	mov    0x804008,%eax
+  80167a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80167d:	83 ec 04             	sub    $0x4,%esp
+  801680:	53                   	push   %ebx
+  801681:	50                   	push   %eax
+  801682:	68 98 2a 80 00       	push   $0x802a98
+  801687:	e8 ca ea ff ff       	call   800156 <cprintf>
+		return -E_INVAL;
+  80168c:	83 c4 10             	add    $0x10,%esp
+  80168f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801694:	eb d8                	jmp    80166e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801696:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80169b:	eb d1                	jmp    80166e <ftruncate+0x50>
+
+0080169d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80169d:	55                   	push   %ebp
+  80169e:	89 e5                	mov    %esp,%ebp
+  8016a0:	56                   	push   %esi
+  8016a1:	53                   	push   %ebx
+  8016a2:	83 ec 18             	sub    $0x18,%esp
+  8016a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016a8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016ab:	50                   	push   %eax
+  8016ac:	ff 75 08             	push   0x8(%ebp)
+  8016af:	e8 92 fb ff ff       	call   801246 <fd_lookup>
+  8016b4:	83 c4 10             	add    $0x10,%esp
+  8016b7:	85 c0                	test   %eax,%eax
+  8016b9:	78 49                	js     801704 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016bb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016be:	83 ec 08             	sub    $0x8,%esp
+  8016c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c4:	50                   	push   %eax
+  8016c5:	ff 36                	push   (%esi)
+  8016c7:	e8 ca fb ff ff       	call   801296 <dev_lookup>
+  8016cc:	83 c4 10             	add    $0x10,%esp
+  8016cf:	85 c0                	test   %eax,%eax
+  8016d1:	78 31                	js     801704 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8016d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016d6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016da:	74 2f                	je     80170b <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8016dc:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8016df:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016e6:	00 00 00 
+	stat->st_isdir = 0;
+  8016e9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016f0:	00 00 00 
+	stat->st_dev = dev;
+  8016f3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8016f9:	83 ec 08             	sub    $0x8,%esp
+  8016fc:	53                   	push   %ebx
+  8016fd:	56                   	push   %esi
+  8016fe:	ff 50 14             	call   *0x14(%eax)
+  801701:	83 c4 10             	add    $0x10,%esp
+}
+  801704:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801707:	5b                   	pop    %ebx
+  801708:	5e                   	pop    %esi
+  801709:	5d                   	pop    %ebp
+  80170a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80170b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801710:	eb f2                	jmp    801704 <fstat+0x67>
+
+00801712 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801712:	55                   	push   %ebp
+  801713:	89 e5                	mov    %esp,%ebp
+  801715:	56                   	push   %esi
+  801716:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801717:	83 ec 08             	sub    $0x8,%esp
+  80171a:	6a 00                	push   $0x0
+  80171c:	ff 75 08             	push   0x8(%ebp)
+  80171f:	e8 bc 02 00 00       	call   8019e0 <open>
+  801724:	89 c3                	mov    %eax,%ebx
+  801726:	83 c4 10             	add    $0x10,%esp
+  801729:	85 c0                	test   %eax,%eax
+  80172b:	78 1b                	js     801748 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80172d:	83 ec 08             	sub    $0x8,%esp
+  801730:	ff 75 0c             	push   0xc(%ebp)
+  801733:	50                   	push   %eax
+  801734:	e8 64 ff ff ff       	call   80169d <fstat>
+  801739:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80173b:	89 1c 24             	mov    %ebx,(%esp)
+  80173e:	e8 26 fc ff ff       	call   801369 <close>
+	return r;
+  801743:	83 c4 10             	add    $0x10,%esp
+  801746:	89 f3                	mov    %esi,%ebx
+}
+  801748:	89 d8                	mov    %ebx,%eax
+  80174a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80174d:	5b                   	pop    %ebx
+  80174e:	5e                   	pop    %esi
+  80174f:	5d                   	pop    %ebp
+  801750:	c3                   	ret
+
+00801751 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801751:	55                   	push   %ebp
+  801752:	89 e5                	mov    %esp,%ebp
+  801754:	57                   	push   %edi
+  801755:	56                   	push   %esi
+  801756:	53                   	push   %ebx
+  801757:	83 ec 0c             	sub    $0xc,%esp
+  80175a:	89 c7                	mov    %eax,%edi
+  80175c:	89 d3                	mov    %edx,%ebx
+  80175e:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801760:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801767:	74 2d                	je     801796 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801769:	6a 07                	push   $0x7
+  80176b:	68 00 50 80 00       	push   $0x805000
+  801770:	57                   	push   %edi
+  801771:	ff 35 00 40 80 00    	push   0x804000
+  801777:	e8 c3 0b 00 00       	call   80233f <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  80177c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801783:	6a 00                	push   $0x0
+  801785:	56                   	push   %esi
+  801786:	53                   	push   %ebx
+  801787:	6a 00                	push   $0x0
+  801789:	e8 63 0a 00 00       	call   8021f1 <ipc_recv_pages>
+}
+  80178e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801791:	5b                   	pop    %ebx
+  801792:	5e                   	pop    %esi
+  801793:	5f                   	pop    %edi
+  801794:	5d                   	pop    %ebp
+  801795:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801796:	83 ec 0c             	sub    $0xc,%esp
+  801799:	6a 01                	push   $0x1
+  80179b:	e8 94 0c 00 00       	call   802434 <ipc_find_env>
+  8017a0:	a3 00 40 80 00       	mov    %eax,0x804000
+  8017a5:	83 c4 10             	add    $0x10,%esp
+  8017a8:	eb bf                	jmp    801769 <fsipc_pages+0x18>
+
+008017aa <fsipc>:
+{
+  8017aa:	55                   	push   %ebp
+  8017ab:	89 e5                	mov    %esp,%ebp
+  8017ad:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  8017b0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017b5:	e8 97 ff ff ff       	call   801751 <fsipc_pages>
+}
+  8017ba:	c9                   	leave
+  8017bb:	c3                   	ret
+
+008017bc <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017bc:	55                   	push   %ebp
+  8017bd:	89 e5                	mov    %esp,%ebp
+  8017bf:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8017c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017c5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017c8:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  8017cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017d0:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8017d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017da:	b8 02 00 00 00       	mov    $0x2,%eax
+  8017df:	e8 c6 ff ff ff       	call   8017aa <fsipc>
+}
+  8017e4:	c9                   	leave
+  8017e5:	c3                   	ret
+
+008017e6 <devfile_flush>:
+{
+  8017e6:	55                   	push   %ebp
+  8017e7:	89 e5                	mov    %esp,%ebp
+  8017e9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8017ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ef:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017f2:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8017f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017fc:	b8 06 00 00 00       	mov    $0x6,%eax
+  801801:	e8 a4 ff ff ff       	call   8017aa <fsipc>
+}
+  801806:	c9                   	leave
+  801807:	c3                   	ret
+
+00801808 <devfile_stat>:
+{
+  801808:	55                   	push   %ebp
+  801809:	89 e5                	mov    %esp,%ebp
+  80180b:	53                   	push   %ebx
+  80180c:	83 ec 04             	sub    $0x4,%esp
+  80180f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801812:	8b 45 08             	mov    0x8(%ebp),%eax
+  801815:	8b 40 0c             	mov    0xc(%eax),%eax
+  801818:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80181d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801822:	b8 05 00 00 00       	mov    $0x5,%eax
+  801827:	e8 7e ff ff ff       	call   8017aa <fsipc>
+  80182c:	85 c0                	test   %eax,%eax
+  80182e:	78 2c                	js     80185c <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801830:	83 ec 08             	sub    $0x8,%esp
+  801833:	68 00 50 80 00       	push   $0x805000
+  801838:	53                   	push   %ebx
+  801839:	e8 ff ee ff ff       	call   80073d <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80183e:	a1 80 50 80 00       	mov    0x805080,%eax
+  801843:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801849:	a1 84 50 80 00       	mov    0x805084,%eax
+  80184e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801854:	83 c4 10             	add    $0x10,%esp
+  801857:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80185c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80185f:	c9                   	leave
+  801860:	c3                   	ret
+
+00801861 <devfile_write>:
+{
+  801861:	55                   	push   %ebp
+  801862:	89 e5                	mov    %esp,%ebp
+  801864:	83 ec 0c             	sub    $0xc,%esp
+  801867:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80186a:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80186f:	39 d0                	cmp    %edx,%eax
+  801871:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801874:	8b 55 08             	mov    0x8(%ebp),%edx
+  801877:	8b 52 0c             	mov    0xc(%edx),%edx
+  80187a:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  801880:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801885:	50                   	push   %eax
+  801886:	ff 75 0c             	push   0xc(%ebp)
+  801889:	68 08 50 80 00       	push   $0x805008
+  80188e:	e8 30 f0 ff ff       	call   8008c3 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801893:	ba 00 00 00 00       	mov    $0x0,%edx
+  801898:	b8 04 00 00 00       	mov    $0x4,%eax
+  80189d:	e8 08 ff ff ff       	call   8017aa <fsipc>
+}
+  8018a2:	c9                   	leave
+  8018a3:	c3                   	ret
+
+008018a4 <devfile_read>:
+{
+  8018a4:	55                   	push   %ebp
+  8018a5:	89 e5                	mov    %esp,%ebp
+  8018a7:	57                   	push   %edi
+  8018a8:	56                   	push   %esi
+  8018a9:	53                   	push   %ebx
+  8018aa:	83 ec 1c             	sub    $0x1c,%esp
+  8018ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8018b0:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8018b3:	89 fe                	mov    %edi,%esi
+  8018b5:	c1 ee 0c             	shr    $0xc,%esi
+  8018b8:	b8 20 00 00 00       	mov    $0x20,%eax
+  8018bd:	39 c6                	cmp    %eax,%esi
+  8018bf:	0f 47 f0             	cmova  %eax,%esi
+  8018c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018ca:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8018cd:	eb 14                	jmp    8018e3 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8018cf:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  8018d6:	05 00 10 00 00       	add    $0x1000,%eax
+  8018db:	f6 c6 06             	test   $0x6,%dh
+  8018de:	75 42                	jne    801922 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8018e0:	83 c1 01             	add    $0x1,%ecx
+  8018e3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8018e6:	39 f1                	cmp    %esi,%ecx
+  8018e8:	0f 84 95 00 00 00    	je     801983 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8018ee:	89 c2                	mov    %eax,%edx
+  8018f0:	c1 ea 16             	shr    $0x16,%edx
+  8018f3:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8018fa:	f6 c2 01             	test   $0x1,%dl
+  8018fd:	74 23                	je     801922 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8018ff:	89 c2                	mov    %eax,%edx
+  801901:	c1 ea 0c             	shr    $0xc,%edx
+  801904:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  80190b:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801911:	74 0f                	je     801922 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801913:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  80191a:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801920:	75 ad                	jne    8018cf <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801922:	85 c9                	test   %ecx,%ecx
+  801924:	74 11                	je     801937 <devfile_read+0x93>
+  801926:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80192d:	75 08                	jne    801937 <devfile_read+0x93>
+  80192f:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801935:	74 50                	je     801987 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801937:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80193a:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  80193f:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801945:	ba 00 00 00 00       	mov    $0x0,%edx
+  80194a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80194f:	e8 56 fe ff ff       	call   8017aa <fsipc>
+  801954:	89 c6                	mov    %eax,%esi
+  801956:	85 c0                	test   %eax,%eax
+  801958:	78 1f                	js     801979 <devfile_read+0xd5>
+	assert(r <= n);
+  80195a:	39 c7                	cmp    %eax,%edi
+  80195c:	72 50                	jb     8019ae <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  80195e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801963:	7f 62                	jg     8019c7 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801965:	83 ec 04             	sub    $0x4,%esp
+  801968:	50                   	push   %eax
+  801969:	68 00 50 80 00       	push   $0x805000
+  80196e:	ff 75 0c             	push   0xc(%ebp)
+  801971:	e8 4d ef ff ff       	call   8008c3 <memmove>
+	return r;
+  801976:	83 c4 10             	add    $0x10,%esp
+}
+  801979:	89 f0                	mov    %esi,%eax
+  80197b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80197e:	5b                   	pop    %ebx
+  80197f:	5e                   	pop    %esi
+  801980:	5f                   	pop    %edi
+  801981:	5d                   	pop    %ebp
+  801982:	c3                   	ret
+  801983:	89 f1                	mov    %esi,%ecx
+  801985:	eb 9b                	jmp    801922 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801987:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80198a:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  80198f:	89 c8                	mov    %ecx,%eax
+  801991:	c1 e0 0c             	shl    $0xc,%eax
+  801994:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801999:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80199c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8019a1:	e8 ab fd ff ff       	call   801751 <fsipc_pages>
+  8019a6:	89 c6                	mov    %eax,%esi
+  8019a8:	85 c0                	test   %eax,%eax
+  8019aa:	78 8b                	js     801937 <devfile_read+0x93>
+  8019ac:	eb cb                	jmp    801979 <devfile_read+0xd5>
+	assert(r <= n);
+  8019ae:	68 04 2b 80 00       	push   $0x802b04
+  8019b3:	68 0b 2b 80 00       	push   $0x802b0b
+  8019b8:	68 a0 00 00 00       	push   $0xa0
+  8019bd:	68 20 2b 80 00       	push   $0x802b20
+  8019c2:	e8 e4 07 00 00       	call   8021ab <_panic>
+	assert(r <= PGSIZE);
+  8019c7:	68 2b 2b 80 00       	push   $0x802b2b
+  8019cc:	68 0b 2b 80 00       	push   $0x802b0b
+  8019d1:	68 a1 00 00 00       	push   $0xa1
+  8019d6:	68 20 2b 80 00       	push   $0x802b20
+  8019db:	e8 cb 07 00 00       	call   8021ab <_panic>
+
+008019e0 <open>:
+{
+  8019e0:	55                   	push   %ebp
+  8019e1:	89 e5                	mov    %esp,%ebp
+  8019e3:	56                   	push   %esi
+  8019e4:	53                   	push   %ebx
+  8019e5:	83 ec 1c             	sub    $0x1c,%esp
+  8019e8:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8019eb:	56                   	push   %esi
+  8019ec:	e8 11 ed ff ff       	call   800702 <strlen>
+  8019f1:	83 c4 10             	add    $0x10,%esp
+  8019f4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019f9:	7f 6c                	jg     801a67 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8019fb:	83 ec 0c             	sub    $0xc,%esp
+  8019fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a01:	50                   	push   %eax
+  801a02:	e8 eb f7 ff ff       	call   8011f2 <fd_alloc>
+  801a07:	89 c3                	mov    %eax,%ebx
+  801a09:	83 c4 10             	add    $0x10,%esp
+  801a0c:	85 c0                	test   %eax,%eax
+  801a0e:	78 3c                	js     801a4c <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801a10:	83 ec 08             	sub    $0x8,%esp
+  801a13:	56                   	push   %esi
+  801a14:	68 00 50 80 00       	push   $0x805000
+  801a19:	e8 1f ed ff ff       	call   80073d <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a21:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801a26:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a29:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a2e:	e8 77 fd ff ff       	call   8017aa <fsipc>
+  801a33:	89 c3                	mov    %eax,%ebx
+  801a35:	83 c4 10             	add    $0x10,%esp
+  801a38:	85 c0                	test   %eax,%eax
+  801a3a:	78 19                	js     801a55 <open+0x75>
+	return fd2num(fd);
+  801a3c:	83 ec 0c             	sub    $0xc,%esp
+  801a3f:	ff 75 f4             	push   -0xc(%ebp)
+  801a42:	e8 84 f7 ff ff       	call   8011cb <fd2num>
+  801a47:	89 c3                	mov    %eax,%ebx
+  801a49:	83 c4 10             	add    $0x10,%esp
+}
+  801a4c:	89 d8                	mov    %ebx,%eax
+  801a4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a51:	5b                   	pop    %ebx
+  801a52:	5e                   	pop    %esi
+  801a53:	5d                   	pop    %ebp
+  801a54:	c3                   	ret
+		fd_close(fd, 0);
+  801a55:	83 ec 08             	sub    $0x8,%esp
+  801a58:	6a 00                	push   $0x0
+  801a5a:	ff 75 f4             	push   -0xc(%ebp)
+  801a5d:	e8 80 f8 ff ff       	call   8012e2 <fd_close>
+		return r;
+  801a62:	83 c4 10             	add    $0x10,%esp
+  801a65:	eb e5                	jmp    801a4c <open+0x6c>
+		return -E_BAD_PATH;
+  801a67:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a6c:	eb de                	jmp    801a4c <open+0x6c>
+
+00801a6e <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801a6e:	55                   	push   %ebp
+  801a6f:	89 e5                	mov    %esp,%ebp
+  801a71:	53                   	push   %ebx
+  801a72:	83 ec 10             	sub    $0x10,%esp
+  801a75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801a78:	53                   	push   %ebx
+  801a79:	e8 84 ec ff ff       	call   800702 <strlen>
+  801a7e:	83 c4 10             	add    $0x10,%esp
+  801a81:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a86:	7f 25                	jg     801aad <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801a88:	83 ec 08             	sub    $0x8,%esp
+  801a8b:	53                   	push   %ebx
+  801a8c:	68 00 50 80 00       	push   $0x805000
+  801a91:	e8 a7 ec ff ff       	call   80073d <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801a96:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a9b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801aa0:	e8 05 fd ff ff       	call   8017aa <fsipc>
+  801aa5:	83 c4 10             	add    $0x10,%esp
+}
+  801aa8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801aab:	c9                   	leave
+  801aac:	c3                   	ret
+		return -E_BAD_PATH;
+  801aad:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801ab2:	eb f4                	jmp    801aa8 <remove+0x3a>
+
+00801ab4 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801ab4:	55                   	push   %ebp
+  801ab5:	89 e5                	mov    %esp,%ebp
+  801ab7:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801aba:	ba 00 00 00 00       	mov    $0x0,%edx
+  801abf:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ac4:	e8 e1 fc ff ff       	call   8017aa <fsipc>
+}
+  801ac9:	c9                   	leave
+  801aca:	c3                   	ret
+
+00801acb <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801acb:	55                   	push   %ebp
+  801acc:	89 e5                	mov    %esp,%ebp
+  801ace:	53                   	push   %ebx
+  801acf:	83 ec 04             	sub    $0x4,%esp
+  801ad2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801ad5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ada:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801adf:	e8 c6 fc ff ff       	call   8017aa <fsipc>
+  801ae4:	85 c0                	test   %eax,%eax
+  801ae6:	78 3c                	js     801b24 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801ae8:	a1 00 50 80 00       	mov    0x805000,%eax
+  801aed:	89 03                	mov    %eax,(%ebx)
+  801aef:	a1 04 50 80 00       	mov    0x805004,%eax
+  801af4:	89 43 04             	mov    %eax,0x4(%ebx)
+  801af7:	a1 08 50 80 00       	mov    0x805008,%eax
+  801afc:	89 43 08             	mov    %eax,0x8(%ebx)
+  801aff:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801b04:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801b07:	a1 10 50 80 00       	mov    0x805010,%eax
+  801b0c:	89 43 10             	mov    %eax,0x10(%ebx)
+  801b0f:	a1 14 50 80 00       	mov    0x805014,%eax
+  801b14:	89 43 14             	mov    %eax,0x14(%ebx)
+  801b17:	a1 18 50 80 00       	mov    0x805018,%eax
+  801b1c:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b27:	c9                   	leave
+  801b28:	c3                   	ret
+
+00801b29 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801b29:	55                   	push   %ebp
+  801b2a:	89 e5                	mov    %esp,%ebp
+  801b2c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801b2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b32:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  801b37:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801b41:	e8 64 fc ff ff       	call   8017aa <fsipc>
+}
+  801b46:	c9                   	leave
+  801b47:	c3                   	ret
+
+00801b48 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b48:	55                   	push   %ebp
+  801b49:	89 e5                	mov    %esp,%ebp
+  801b4b:	56                   	push   %esi
+  801b4c:	53                   	push   %ebx
+  801b4d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801b50:	83 ec 0c             	sub    $0xc,%esp
+  801b53:	ff 75 08             	push   0x8(%ebp)
+  801b56:	e8 80 f6 ff ff       	call   8011db <fd2data>
+  801b5b:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801b5d:	83 c4 08             	add    $0x8,%esp
+  801b60:	68 37 2b 80 00       	push   $0x802b37
+  801b65:	53                   	push   %ebx
+  801b66:	e8 d2 eb ff ff       	call   80073d <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801b6b:	8b 46 04             	mov    0x4(%esi),%eax
+  801b6e:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801b74:	2b 0e                	sub    (%esi),%ecx
+  801b76:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801b7b:	89 c8                	mov    %ecx,%eax
+  801b7d:	f7 e2                	mul    %edx
+  801b7f:	c1 ea 0c             	shr    $0xc,%edx
+  801b82:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801b88:	29 d1                	sub    %edx,%ecx
+  801b8a:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801b90:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b97:	00 00 00 
+	stat->st_dev = &devpipe;
+  801b9a:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  801ba1:	30 80 00 
+	return 0;
+}
+  801ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bac:	5b                   	pop    %ebx
+  801bad:	5e                   	pop    %esi
+  801bae:	5d                   	pop    %ebp
+  801baf:	c3                   	ret
+
+00801bb0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801bb0:	55                   	push   %ebp
+  801bb1:	89 e5                	mov    %esp,%ebp
+  801bb3:	53                   	push   %ebx
+  801bb4:	83 ec 0c             	sub    $0xc,%esp
+  801bb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801bba:	53                   	push   %ebx
+  801bbb:	6a 00                	push   $0x0
+  801bbd:	e8 f3 f0 ff ff       	call   800cb5 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801bc2:	89 1c 24             	mov    %ebx,(%esp)
+  801bc5:	e8 11 f6 ff ff       	call   8011db <fd2data>
+  801bca:	83 c4 08             	add    $0x8,%esp
+  801bcd:	50                   	push   %eax
+  801bce:	6a 00                	push   $0x0
+  801bd0:	e8 e0 f0 ff ff       	call   800cb5 <sys_page_unmap>
+}
+  801bd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bd8:	c9                   	leave
+  801bd9:	c3                   	ret
+
+00801bda <_pipeisclosed>:
+{
+  801bda:	55                   	push   %ebp
+  801bdb:	89 e5                	mov    %esp,%ebp
+  801bdd:	57                   	push   %edi
+  801bde:	56                   	push   %esi
+  801bdf:	53                   	push   %ebx
+  801be0:	83 ec 1c             	sub    $0x1c,%esp
+  801be3:	89 c7                	mov    %eax,%edi
+  801be5:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801be7:	a1 08 40 80 00       	mov    0x804008,%eax
+  801bec:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801bef:	83 ec 0c             	sub    $0xc,%esp
+  801bf2:	57                   	push   %edi
+  801bf3:	e8 7b 08 00 00       	call   802473 <pageref>
+  801bf8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801bfb:	89 34 24             	mov    %esi,(%esp)
+  801bfe:	e8 70 08 00 00       	call   802473 <pageref>
+		nn = thisenv->env_runs;
+  801c03:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801c09:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801c0c:	83 c4 10             	add    $0x10,%esp
+  801c0f:	39 cb                	cmp    %ecx,%ebx
+  801c11:	74 1b                	je     801c2e <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801c13:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801c16:	75 cf                	jne    801be7 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801c18:	8b 42 58             	mov    0x58(%edx),%eax
+  801c1b:	6a 01                	push   $0x1
+  801c1d:	50                   	push   %eax
+  801c1e:	53                   	push   %ebx
+  801c1f:	68 3e 2b 80 00       	push   $0x802b3e
+  801c24:	e8 2d e5 ff ff       	call   800156 <cprintf>
+  801c29:	83 c4 10             	add    $0x10,%esp
+  801c2c:	eb b9                	jmp    801be7 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801c2e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801c31:	0f 94 c0             	sete   %al
+  801c34:	0f b6 c0             	movzbl %al,%eax
+}
+  801c37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c3a:	5b                   	pop    %ebx
+  801c3b:	5e                   	pop    %esi
+  801c3c:	5f                   	pop    %edi
+  801c3d:	5d                   	pop    %ebp
+  801c3e:	c3                   	ret
+
+00801c3f <devpipe_read>:
+{
+  801c3f:	55                   	push   %ebp
+  801c40:	89 e5                	mov    %esp,%ebp
+  801c42:	57                   	push   %edi
+  801c43:	56                   	push   %esi
+  801c44:	53                   	push   %ebx
+  801c45:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801c48:	ff 75 08             	push   0x8(%ebp)
+  801c4b:	e8 8b f5 ff ff       	call   8011db <fd2data>
+  801c50:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801c52:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801c55:	8d 40 04             	lea    0x4(%eax),%eax
+  801c58:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801c5b:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801c5e:	8b 0b                	mov    (%ebx),%ecx
+  801c60:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801c66:	29 ce                	sub    %ecx,%esi
+  801c68:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801c6d:	f7 e6                	mul    %esi
+  801c6f:	c1 ea 0c             	shr    $0xc,%edx
+  801c72:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801c78:	29 c6                	sub    %eax,%esi
+  801c7a:	89 f2                	mov    %esi,%edx
+  801c7c:	75 43                	jne    801cc1 <devpipe_read+0x82>
+		ref = pageref(p);
+  801c7e:	83 ec 0c             	sub    $0xc,%esp
+  801c81:	53                   	push   %ebx
+  801c82:	e8 ec 07 00 00       	call   802473 <pageref>
+  801c87:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801c89:	89 da                	mov    %ebx,%edx
+  801c8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c8e:	e8 47 ff ff ff       	call   801bda <_pipeisclosed>
+  801c93:	83 c4 10             	add    $0x10,%esp
+  801c96:	85 c0                	test   %eax,%eax
+  801c98:	0f 85 c1 00 00 00    	jne    801d5f <devpipe_read+0x120>
+	*sleeping = 1;
+  801c9e:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801ca5:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801caa:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801cad:	75 ac                	jne    801c5b <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801caf:	83 ec 04             	sub    $0x4,%esp
+  801cb2:	56                   	push   %esi
+  801cb3:	57                   	push   %edi
+  801cb4:	ff 75 e4             	push   -0x1c(%ebp)
+  801cb7:	e8 4d f4 ff ff       	call   801109 <sys_futex_wait>
+  801cbc:	83 c4 10             	add    $0x10,%esp
+  801cbf:	eb 9a                	jmp    801c5b <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801cc1:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801cc4:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801cc8:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801cca:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801ccf:	f7 e1                	mul    %ecx
+  801cd1:	c1 ea 0b             	shr    $0xb,%edx
+  801cd4:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801cda:	29 c1                	sub    %eax,%ecx
+  801cdc:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801cde:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801ce3:	29 cf                	sub    %ecx,%edi
+  801ce5:	39 f7                	cmp    %esi,%edi
+  801ce7:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801cea:	8d 43 10             	lea    0x10(%ebx),%eax
+  801ced:	83 ec 04             	sub    $0x4,%esp
+  801cf0:	57                   	push   %edi
+  801cf1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801cf4:	01 c2                	add    %eax,%edx
+  801cf6:	52                   	push   %edx
+  801cf7:	ff 75 0c             	push   0xc(%ebp)
+  801cfa:	e8 c4 eb ff ff       	call   8008c3 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801cff:	83 c4 0c             	add    $0xc,%esp
+  801d02:	89 f1                	mov    %esi,%ecx
+  801d04:	29 f9                	sub    %edi,%ecx
+  801d06:	51                   	push   %ecx
+  801d07:	ff 75 e4             	push   -0x1c(%ebp)
+  801d0a:	89 f8                	mov    %edi,%eax
+  801d0c:	03 45 0c             	add    0xc(%ebp),%eax
+  801d0f:	50                   	push   %eax
+  801d10:	e8 ae eb ff ff       	call   8008c3 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801d15:	89 f1                	mov    %esi,%ecx
+  801d17:	03 0b                	add    (%ebx),%ecx
+  801d19:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801d1e:	f7 e1                	mul    %ecx
+  801d20:	c1 ea 0c             	shr    $0xc,%edx
+  801d23:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801d29:	29 d1                	sub    %edx,%ecx
+  801d2b:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801d2d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801d32:	83 c4 10             	add    $0x10,%esp
+  801d35:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801d39:	75 0a                	jne    801d45 <devpipe_read+0x106>
+	return n;
+  801d3b:	89 f0                	mov    %esi,%eax
+}
+  801d3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d40:	5b                   	pop    %ebx
+  801d41:	5e                   	pop    %esi
+  801d42:	5f                   	pop    %edi
+  801d43:	5d                   	pop    %ebp
+  801d44:	c3                   	ret
+		*sleeping = 0;
+  801d45:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801d4c:	83 ec 08             	sub    $0x8,%esp
+  801d4f:	68 00 04 00 00       	push   $0x400
+  801d54:	53                   	push   %ebx
+  801d55:	e8 ff f3 ff ff       	call   801159 <sys_futex_wake>
+  801d5a:	83 c4 10             	add    $0x10,%esp
+  801d5d:	eb dc                	jmp    801d3b <devpipe_read+0xfc>
+			return 0;
+  801d5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d64:	eb d7                	jmp    801d3d <devpipe_read+0xfe>
+
+00801d66 <devpipe_write>:
+{
+  801d66:	55                   	push   %ebp
+  801d67:	89 e5                	mov    %esp,%ebp
+  801d69:	57                   	push   %edi
+  801d6a:	56                   	push   %esi
+  801d6b:	53                   	push   %ebx
+  801d6c:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801d6f:	ff 75 08             	push   0x8(%ebp)
+  801d72:	e8 64 f4 ff ff       	call   8011db <fd2data>
+  801d77:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801d79:	83 c4 10             	add    $0x10,%esp
+  801d7c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801d83:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d86:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801d89:	0f 83 23 01 00 00    	jae    801eb2 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801d8f:	8b 77 04             	mov    0x4(%edi),%esi
+  801d92:	8b 1f                	mov    (%edi),%ebx
+  801d94:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801d9a:	29 d9                	sub    %ebx,%ecx
+  801d9c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801da1:	f7 e1                	mul    %ecx
+  801da3:	c1 ea 0c             	shr    $0xc,%edx
+  801da6:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801dac:	29 c1                	sub    %eax,%ecx
+  801dae:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801db0:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801db6:	75 40                	jne    801df8 <devpipe_write+0x92>
+			ref = pageref(p);
+  801db8:	83 ec 0c             	sub    $0xc,%esp
+  801dbb:	57                   	push   %edi
+  801dbc:	e8 b2 06 00 00       	call   802473 <pageref>
+  801dc1:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801dc3:	89 fa                	mov    %edi,%edx
+  801dc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc8:	e8 0d fe ff ff       	call   801bda <_pipeisclosed>
+  801dcd:	83 c4 10             	add    $0x10,%esp
+  801dd0:	85 c0                	test   %eax,%eax
+  801dd2:	0f 85 d5 00 00 00    	jne    801ead <devpipe_write+0x147>
+	*sleeping = 1;
+  801dd8:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801ddf:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801de4:	39 1f                	cmp    %ebx,(%edi)
+  801de6:	75 a7                	jne    801d8f <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801de8:	83 ec 04             	sub    $0x4,%esp
+  801deb:	56                   	push   %esi
+  801dec:	53                   	push   %ebx
+  801ded:	57                   	push   %edi
+  801dee:	e8 16 f3 ff ff       	call   801109 <sys_futex_wait>
+  801df3:	83 c4 10             	add    $0x10,%esp
+  801df6:	eb 97                	jmp    801d8f <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801df8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801dfb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801dfe:	29 c1                	sub    %eax,%ecx
+  801e00:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801e05:	89 d8                	mov    %ebx,%eax
+  801e07:	29 d0                	sub    %edx,%eax
+  801e09:	39 c1                	cmp    %eax,%ecx
+  801e0b:	0f 46 c1             	cmovbe %ecx,%eax
+  801e0e:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801e10:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e15:	f7 e6                	mul    %esi
+  801e17:	c1 ea 0b             	shr    $0xb,%edx
+  801e1a:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801e20:	29 c6                	sub    %eax,%esi
+  801e22:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801e24:	29 f3                	sub    %esi,%ebx
+  801e26:	39 cb                	cmp    %ecx,%ebx
+  801e28:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801e2b:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801e2e:	8d 77 10             	lea    0x10(%edi),%esi
+  801e31:	83 ec 04             	sub    $0x4,%esp
+  801e34:	53                   	push   %ebx
+  801e35:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e38:	03 45 0c             	add    0xc(%ebp),%eax
+  801e3b:	50                   	push   %eax
+  801e3c:	01 f2                	add    %esi,%edx
+  801e3e:	52                   	push   %edx
+  801e3f:	e8 7f ea ff ff       	call   8008c3 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  801e44:	83 c4 0c             	add    $0xc,%esp
+  801e47:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801e4a:	29 d8                	sub    %ebx,%eax
+  801e4c:	50                   	push   %eax
+  801e4d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801e50:	01 d3                	add    %edx,%ebx
+  801e52:	03 5d 0c             	add    0xc(%ebp),%ebx
+  801e55:	53                   	push   %ebx
+  801e56:	56                   	push   %esi
+  801e57:	e8 67 ea ff ff       	call   8008c3 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  801e5c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801e5f:	03 4f 04             	add    0x4(%edi),%ecx
+  801e62:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e67:	f7 e1                	mul    %ecx
+  801e69:	c1 ea 0c             	shr    $0xc,%edx
+  801e6c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801e72:	29 d1                	sub    %edx,%ecx
+  801e74:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  801e77:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801e7c:	83 c4 10             	add    $0x10,%esp
+  801e7f:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  801e83:	75 0b                	jne    801e90 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  801e85:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  801e88:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801e8b:	e9 f3 fe ff ff       	jmp    801d83 <devpipe_write+0x1d>
+		*sleeping = 0;
+  801e90:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  801e97:	83 ec 08             	sub    $0x8,%esp
+  801e9a:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  801e9f:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  801ea2:	50                   	push   %eax
+  801ea3:	e8 b1 f2 ff ff       	call   801159 <sys_futex_wake>
+  801ea8:	83 c4 10             	add    $0x10,%esp
+  801eab:	eb d8                	jmp    801e85 <devpipe_write+0x11f>
+				return 0;
+  801ead:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eb5:	5b                   	pop    %ebx
+  801eb6:	5e                   	pop    %esi
+  801eb7:	5f                   	pop    %edi
+  801eb8:	5d                   	pop    %ebp
+  801eb9:	c3                   	ret
+
+00801eba <pipe>:
+{
+  801eba:	55                   	push   %ebp
+  801ebb:	89 e5                	mov    %esp,%ebp
+  801ebd:	56                   	push   %esi
+  801ebe:	53                   	push   %ebx
+  801ebf:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801ec2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ec5:	50                   	push   %eax
+  801ec6:	e8 27 f3 ff ff       	call   8011f2 <fd_alloc>
+  801ecb:	89 c3                	mov    %eax,%ebx
+  801ecd:	83 c4 10             	add    $0x10,%esp
+  801ed0:	85 c0                	test   %eax,%eax
+  801ed2:	0f 88 23 01 00 00    	js     801ffb <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801ed8:	83 ec 04             	sub    $0x4,%esp
+  801edb:	68 07 04 00 00       	push   $0x407
+  801ee0:	ff 75 f4             	push   -0xc(%ebp)
+  801ee3:	6a 00                	push   $0x0
+  801ee5:	e8 46 ed ff ff       	call   800c30 <sys_page_alloc>
+  801eea:	89 c3                	mov    %eax,%ebx
+  801eec:	83 c4 10             	add    $0x10,%esp
+  801eef:	85 c0                	test   %eax,%eax
+  801ef1:	0f 88 04 01 00 00    	js     801ffb <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801ef7:	83 ec 0c             	sub    $0xc,%esp
+  801efa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801efd:	50                   	push   %eax
+  801efe:	e8 ef f2 ff ff       	call   8011f2 <fd_alloc>
+  801f03:	89 c3                	mov    %eax,%ebx
+  801f05:	83 c4 10             	add    $0x10,%esp
+  801f08:	85 c0                	test   %eax,%eax
+  801f0a:	0f 88 db 00 00 00    	js     801feb <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f10:	83 ec 04             	sub    $0x4,%esp
+  801f13:	68 07 04 00 00       	push   $0x407
+  801f18:	ff 75 f0             	push   -0x10(%ebp)
+  801f1b:	6a 00                	push   $0x0
+  801f1d:	e8 0e ed ff ff       	call   800c30 <sys_page_alloc>
+  801f22:	89 c3                	mov    %eax,%ebx
+  801f24:	83 c4 10             	add    $0x10,%esp
+  801f27:	85 c0                	test   %eax,%eax
+  801f29:	0f 88 bc 00 00 00    	js     801feb <pipe+0x131>
+	va = fd2data(fd0);
+  801f2f:	83 ec 0c             	sub    $0xc,%esp
+  801f32:	ff 75 f4             	push   -0xc(%ebp)
+  801f35:	e8 a1 f2 ff ff       	call   8011db <fd2data>
+  801f3a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f3c:	83 c4 0c             	add    $0xc,%esp
+  801f3f:	68 07 04 00 00       	push   $0x407
+  801f44:	50                   	push   %eax
+  801f45:	6a 00                	push   $0x0
+  801f47:	e8 e4 ec ff ff       	call   800c30 <sys_page_alloc>
+  801f4c:	89 c3                	mov    %eax,%ebx
+  801f4e:	83 c4 10             	add    $0x10,%esp
+  801f51:	85 c0                	test   %eax,%eax
+  801f53:	0f 88 82 00 00 00    	js     801fdb <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f59:	83 ec 0c             	sub    $0xc,%esp
+  801f5c:	ff 75 f0             	push   -0x10(%ebp)
+  801f5f:	e8 77 f2 ff ff       	call   8011db <fd2data>
+  801f64:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801f6b:	50                   	push   %eax
+  801f6c:	6a 00                	push   $0x0
+  801f6e:	56                   	push   %esi
+  801f6f:	6a 00                	push   $0x0
+  801f71:	e8 fd ec ff ff       	call   800c73 <sys_page_map>
+  801f76:	89 c3                	mov    %eax,%ebx
+  801f78:	83 c4 20             	add    $0x20,%esp
+  801f7b:	85 c0                	test   %eax,%eax
+  801f7d:	78 4e                	js     801fcd <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801f7f:	a1 20 30 80 00       	mov    0x803020,%eax
+  801f84:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f87:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801f89:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f8c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801f93:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801f96:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801f98:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801f9b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801fa2:	83 ec 0c             	sub    $0xc,%esp
+  801fa5:	ff 75 f4             	push   -0xc(%ebp)
+  801fa8:	e8 1e f2 ff ff       	call   8011cb <fd2num>
+  801fad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fb0:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801fb2:	83 c4 04             	add    $0x4,%esp
+  801fb5:	ff 75 f0             	push   -0x10(%ebp)
+  801fb8:	e8 0e f2 ff ff       	call   8011cb <fd2num>
+  801fbd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fc0:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801fc3:	83 c4 10             	add    $0x10,%esp
+  801fc6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fcb:	eb 2e                	jmp    801ffb <pipe+0x141>
+	sys_page_unmap(0, va);
+  801fcd:	83 ec 08             	sub    $0x8,%esp
+  801fd0:	56                   	push   %esi
+  801fd1:	6a 00                	push   $0x0
+  801fd3:	e8 dd ec ff ff       	call   800cb5 <sys_page_unmap>
+  801fd8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801fdb:	83 ec 08             	sub    $0x8,%esp
+  801fde:	ff 75 f0             	push   -0x10(%ebp)
+  801fe1:	6a 00                	push   $0x0
+  801fe3:	e8 cd ec ff ff       	call   800cb5 <sys_page_unmap>
+  801fe8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801feb:	83 ec 08             	sub    $0x8,%esp
+  801fee:	ff 75 f4             	push   -0xc(%ebp)
+  801ff1:	6a 00                	push   $0x0
+  801ff3:	e8 bd ec ff ff       	call   800cb5 <sys_page_unmap>
+  801ff8:	83 c4 10             	add    $0x10,%esp
+}
+  801ffb:	89 d8                	mov    %ebx,%eax
+  801ffd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802000:	5b                   	pop    %ebx
+  802001:	5e                   	pop    %esi
+  802002:	5d                   	pop    %ebp
+  802003:	c3                   	ret
+
+00802004 <pipeisclosed>:
+{
+  802004:	55                   	push   %ebp
+  802005:	89 e5                	mov    %esp,%ebp
+  802007:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80200a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80200d:	50                   	push   %eax
+  80200e:	ff 75 08             	push   0x8(%ebp)
+  802011:	e8 30 f2 ff ff       	call   801246 <fd_lookup>
+  802016:	83 c4 10             	add    $0x10,%esp
+  802019:	85 c0                	test   %eax,%eax
+  80201b:	78 18                	js     802035 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80201d:	83 ec 0c             	sub    $0xc,%esp
+  802020:	ff 75 f4             	push   -0xc(%ebp)
+  802023:	e8 b3 f1 ff ff       	call   8011db <fd2data>
+  802028:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80202a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80202d:	e8 a8 fb ff ff       	call   801bda <_pipeisclosed>
+  802032:	83 c4 10             	add    $0x10,%esp
+}
+  802035:	c9                   	leave
+  802036:	c3                   	ret
+
+00802037 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802037:	b8 00 00 00 00       	mov    $0x0,%eax
+  80203c:	c3                   	ret
+
+0080203d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80203d:	55                   	push   %ebp
+  80203e:	89 e5                	mov    %esp,%ebp
+  802040:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802043:	68 56 2b 80 00       	push   $0x802b56
+  802048:	ff 75 0c             	push   0xc(%ebp)
+  80204b:	e8 ed e6 ff ff       	call   80073d <strcpy>
+	return 0;
+}
+  802050:	b8 00 00 00 00       	mov    $0x0,%eax
+  802055:	c9                   	leave
+  802056:	c3                   	ret
+
+00802057 <devcons_write>:
+{
+  802057:	55                   	push   %ebp
+  802058:	89 e5                	mov    %esp,%ebp
+  80205a:	57                   	push   %edi
+  80205b:	56                   	push   %esi
+  80205c:	53                   	push   %ebx
+  80205d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802063:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802068:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80206e:	eb 2e                	jmp    80209e <devcons_write+0x47>
+		m = n - tot;
+  802070:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802073:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802075:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80207a:	39 c3                	cmp    %eax,%ebx
+  80207c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80207f:	83 ec 04             	sub    $0x4,%esp
+  802082:	53                   	push   %ebx
+  802083:	89 f0                	mov    %esi,%eax
+  802085:	03 45 0c             	add    0xc(%ebp),%eax
+  802088:	50                   	push   %eax
+  802089:	57                   	push   %edi
+  80208a:	e8 34 e8 ff ff       	call   8008c3 <memmove>
+		sys_cputs(buf, m);
+  80208f:	83 c4 08             	add    $0x8,%esp
+  802092:	53                   	push   %ebx
+  802093:	57                   	push   %edi
+  802094:	e8 ca ea ff ff       	call   800b63 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802099:	01 de                	add    %ebx,%esi
+  80209b:	83 c4 10             	add    $0x10,%esp
+  80209e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8020a1:	72 cd                	jb     802070 <devcons_write+0x19>
+}
+  8020a3:	89 f0                	mov    %esi,%eax
+  8020a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020a8:	5b                   	pop    %ebx
+  8020a9:	5e                   	pop    %esi
+  8020aa:	5f                   	pop    %edi
+  8020ab:	5d                   	pop    %ebp
+  8020ac:	c3                   	ret
+
+008020ad <devcons_read>:
+{
+  8020ad:	55                   	push   %ebp
+  8020ae:	89 e5                	mov    %esp,%ebp
+  8020b0:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8020b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8020bc:	75 07                	jne    8020c5 <devcons_read+0x18>
+  8020be:	eb 1f                	jmp    8020df <devcons_read+0x32>
+		sys_yield();
+  8020c0:	e8 4c eb ff ff       	call   800c11 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8020c5:	e8 c8 ea ff ff       	call   800b92 <sys_cgetc>
+  8020ca:	85 c0                	test   %eax,%eax
+  8020cc:	74 f2                	je     8020c0 <devcons_read+0x13>
+	if (c < 0)
+  8020ce:	78 0f                	js     8020df <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8020d0:	83 f8 04             	cmp    $0x4,%eax
+  8020d3:	74 0c                	je     8020e1 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8020d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020d8:	88 02                	mov    %al,(%edx)
+	return 1;
+  8020da:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8020df:	c9                   	leave
+  8020e0:	c3                   	ret
+		return 0;
+  8020e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e6:	eb f7                	jmp    8020df <devcons_read+0x32>
+
+008020e8 <cputchar>:
+{
+  8020e8:	55                   	push   %ebp
+  8020e9:	89 e5                	mov    %esp,%ebp
+  8020eb:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8020ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020f1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8020f4:	6a 01                	push   $0x1
+  8020f6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020f9:	50                   	push   %eax
+  8020fa:	e8 64 ea ff ff       	call   800b63 <sys_cputs>
+}
+  8020ff:	83 c4 10             	add    $0x10,%esp
+  802102:	c9                   	leave
+  802103:	c3                   	ret
+
+00802104 <getchar>:
+{
+  802104:	55                   	push   %ebp
+  802105:	89 e5                	mov    %esp,%ebp
+  802107:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80210a:	6a 01                	push   $0x1
+  80210c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80210f:	50                   	push   %eax
+  802110:	6a 00                	push   $0x0
+  802112:	e8 8e f3 ff ff       	call   8014a5 <read>
+	if (r < 0)
+  802117:	83 c4 10             	add    $0x10,%esp
+  80211a:	85 c0                	test   %eax,%eax
+  80211c:	78 06                	js     802124 <getchar+0x20>
+	if (r < 1)
+  80211e:	74 06                	je     802126 <getchar+0x22>
+	return c;
+  802120:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802124:	c9                   	leave
+  802125:	c3                   	ret
+		return -E_EOF;
+  802126:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80212b:	eb f7                	jmp    802124 <getchar+0x20>
+
+0080212d <iscons>:
+{
+  80212d:	55                   	push   %ebp
+  80212e:	89 e5                	mov    %esp,%ebp
+  802130:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802133:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802136:	50                   	push   %eax
+  802137:	ff 75 08             	push   0x8(%ebp)
+  80213a:	e8 07 f1 ff ff       	call   801246 <fd_lookup>
+  80213f:	83 c4 10             	add    $0x10,%esp
+  802142:	85 c0                	test   %eax,%eax
+  802144:	78 11                	js     802157 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802146:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802149:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  80214f:	39 10                	cmp    %edx,(%eax)
+  802151:	0f 94 c0             	sete   %al
+  802154:	0f b6 c0             	movzbl %al,%eax
+}
+  802157:	c9                   	leave
+  802158:	c3                   	ret
+
+00802159 <opencons>:
+{
+  802159:	55                   	push   %ebp
+  80215a:	89 e5                	mov    %esp,%ebp
+  80215c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80215f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802162:	50                   	push   %eax
+  802163:	e8 8a f0 ff ff       	call   8011f2 <fd_alloc>
+  802168:	83 c4 10             	add    $0x10,%esp
+  80216b:	85 c0                	test   %eax,%eax
+  80216d:	78 3a                	js     8021a9 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80216f:	83 ec 04             	sub    $0x4,%esp
+  802172:	68 07 04 00 00       	push   $0x407
+  802177:	ff 75 f4             	push   -0xc(%ebp)
+  80217a:	6a 00                	push   $0x0
+  80217c:	e8 af ea ff ff       	call   800c30 <sys_page_alloc>
+  802181:	83 c4 10             	add    $0x10,%esp
+  802184:	85 c0                	test   %eax,%eax
+  802186:	78 21                	js     8021a9 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802188:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80218b:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  802191:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802193:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802196:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80219d:	83 ec 0c             	sub    $0xc,%esp
+  8021a0:	50                   	push   %eax
+  8021a1:	e8 25 f0 ff ff       	call   8011cb <fd2num>
+  8021a6:	83 c4 10             	add    $0x10,%esp
+}
+  8021a9:	c9                   	leave
+  8021aa:	c3                   	ret
+
+008021ab <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8021ab:	55                   	push   %ebp
+  8021ac:	89 e5                	mov    %esp,%ebp
+  8021ae:	56                   	push   %esi
+  8021af:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8021b0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8021b3:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  8021b9:	e8 34 ea ff ff       	call   800bf2 <sys_getenvid>
+  8021be:	83 ec 0c             	sub    $0xc,%esp
+  8021c1:	ff 75 0c             	push   0xc(%ebp)
+  8021c4:	ff 75 08             	push   0x8(%ebp)
+  8021c7:	56                   	push   %esi
+  8021c8:	50                   	push   %eax
+  8021c9:	68 64 2b 80 00       	push   $0x802b64
+  8021ce:	e8 83 df ff ff       	call   800156 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8021d3:	83 c4 18             	add    $0x18,%esp
+  8021d6:	53                   	push   %ebx
+  8021d7:	ff 75 10             	push   0x10(%ebp)
+  8021da:	e8 26 df ff ff       	call   800105 <vcprintf>
+	cprintf("\n");
+  8021df:	c7 04 24 4f 2b 80 00 	movl   $0x802b4f,(%esp)
+  8021e6:	e8 6b df ff ff       	call   800156 <cprintf>
+  8021eb:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8021ee:	cc                   	int3
+	while (1)
+  8021ef:	eb fd                	jmp    8021ee <_panic+0x43>
+
+008021f1 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8021f1:	55                   	push   %ebp
+  8021f2:	89 e5                	mov    %esp,%ebp
+  8021f4:	57                   	push   %edi
+  8021f5:	56                   	push   %esi
+  8021f6:	53                   	push   %ebx
+  8021f7:	83 ec 14             	sub    $0x14,%esp
+  8021fa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021fd:	8b 75 14             	mov    0x14(%ebp),%esi
+  802200:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  802203:	ff 75 10             	push   0x10(%ebp)
+  802206:	ff 75 0c             	push   0xc(%ebp)
+  802209:	e8 45 ee ff ff       	call   801053 <sys_ipc_recv_pages>
+  80220e:	83 c4 10             	add    $0x10,%esp
+  802211:	85 c0                	test   %eax,%eax
+  802213:	78 46                	js     80225b <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802215:	85 ff                	test   %edi,%edi
+  802217:	74 0d                	je     802226 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  802219:	a1 08 40 80 00       	mov    0x804008,%eax
+  80221e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802224:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802226:	85 f6                	test   %esi,%esi
+  802228:	74 0d                	je     802237 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  80222a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80222f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802235:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802237:	85 db                	test   %ebx,%ebx
+  802239:	74 0d                	je     802248 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  80223b:	a1 08 40 80 00       	mov    0x804008,%eax
+  802240:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802246:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802248:	a1 08 40 80 00       	mov    0x804008,%eax
+  80224d:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802253:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802256:	5b                   	pop    %ebx
+  802257:	5e                   	pop    %esi
+  802258:	5f                   	pop    %edi
+  802259:	5d                   	pop    %ebp
+  80225a:	c3                   	ret
+		if (from_env_store) {
+  80225b:	85 ff                	test   %edi,%edi
+  80225d:	74 06                	je     802265 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80225f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802265:	85 f6                	test   %esi,%esi
+  802267:	74 06                	je     80226f <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  802269:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80226f:	85 db                	test   %ebx,%ebx
+  802271:	74 e0                	je     802253 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  802273:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802279:	eb d8                	jmp    802253 <ipc_recv_pages+0x62>
+
+0080227b <ipc_recv>:
+{
+  80227b:	55                   	push   %ebp
+  80227c:	89 e5                	mov    %esp,%ebp
+  80227e:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  802281:	6a 00                	push   $0x0
+  802283:	ff 75 10             	push   0x10(%ebp)
+  802286:	6a 01                	push   $0x1
+  802288:	ff 75 0c             	push   0xc(%ebp)
+  80228b:	ff 75 08             	push   0x8(%ebp)
+  80228e:	e8 5e ff ff ff       	call   8021f1 <ipc_recv_pages>
+}
+  802293:	c9                   	leave
+  802294:	c3                   	ret
+
+00802295 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802295:	55                   	push   %ebp
+  802296:	89 e5                	mov    %esp,%ebp
+  802298:	56                   	push   %esi
+  802299:	53                   	push   %ebx
+  80229a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80229d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8022a0:	83 ec 0c             	sub    $0xc,%esp
+  8022a3:	ff 75 0c             	push   0xc(%ebp)
+  8022a6:	e8 dc ee ff ff       	call   801187 <sys_ipc_try_recv>
+  8022ab:	83 c4 10             	add    $0x10,%esp
+  8022ae:	85 c0                	test   %eax,%eax
+  8022b0:	78 34                	js     8022e6 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8022b2:	85 f6                	test   %esi,%esi
+  8022b4:	74 0d                	je     8022c3 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8022b6:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022bb:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8022c1:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8022c3:	85 db                	test   %ebx,%ebx
+  8022c5:	74 0d                	je     8022d4 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8022c7:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022cc:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8022d2:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8022d4:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022d9:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8022df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022e2:	5b                   	pop    %ebx
+  8022e3:	5e                   	pop    %esi
+  8022e4:	5d                   	pop    %ebp
+  8022e5:	c3                   	ret
+		if (from_env_store) {
+  8022e6:	85 f6                	test   %esi,%esi
+  8022e8:	74 06                	je     8022f0 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8022ea:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8022f0:	85 db                	test   %ebx,%ebx
+  8022f2:	74 eb                	je     8022df <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8022f4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8022fa:	eb e3                	jmp    8022df <ipc_try_recv+0x4a>
+
+008022fc <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8022fc:	55                   	push   %ebp
+  8022fd:	89 e5                	mov    %esp,%ebp
+  8022ff:	83 ec 14             	sub    $0x14,%esp
+  802302:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802305:	85 c0                	test   %eax,%eax
+  802307:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80230c:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80230f:	ff 75 18             	push   0x18(%ebp)
+  802312:	ff 75 14             	push   0x14(%ebp)
+  802315:	50                   	push   %eax
+  802316:	ff 75 0c             	push   0xc(%ebp)
+  802319:	ff 75 08             	push   0x8(%ebp)
+  80231c:	e8 f5 ec ff ff       	call   801016 <sys_ipc_send_pages>
+  802321:	83 c4 20             	add    $0x20,%esp
+  802324:	85 c0                	test   %eax,%eax
+  802326:	78 02                	js     80232a <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  802328:	c9                   	leave
+  802329:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  80232a:	50                   	push   %eax
+  80232b:	68 88 2b 80 00       	push   $0x802b88
+  802330:	68 80 00 00 00       	push   $0x80
+  802335:	68 b4 2b 80 00       	push   $0x802bb4
+  80233a:	e8 6c fe ff ff       	call   8021ab <_panic>
+
+0080233f <ipc_send>:
+{
+  80233f:	55                   	push   %ebp
+  802340:	89 e5                	mov    %esp,%ebp
+  802342:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  802345:	ff 75 14             	push   0x14(%ebp)
+  802348:	6a 01                	push   $0x1
+  80234a:	ff 75 10             	push   0x10(%ebp)
+  80234d:	ff 75 0c             	push   0xc(%ebp)
+  802350:	ff 75 08             	push   0x8(%ebp)
+  802353:	e8 a4 ff ff ff       	call   8022fc <ipc_send_pages>
+}
+  802358:	83 c4 20             	add    $0x20,%esp
+  80235b:	c9                   	leave
+  80235c:	c3                   	ret
+
+0080235d <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80235d:	55                   	push   %ebp
+  80235e:	89 e5                	mov    %esp,%ebp
+  802360:	83 ec 14             	sub    $0x14,%esp
+  802363:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802366:	85 c0                	test   %eax,%eax
+  802368:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80236d:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802370:	ff 75 18             	push   0x18(%ebp)
+  802373:	ff 75 14             	push   0x14(%ebp)
+  802376:	50                   	push   %eax
+  802377:	ff 75 0c             	push   0xc(%ebp)
+  80237a:	ff 75 08             	push   0x8(%ebp)
+  80237d:	e8 25 ed ff ff       	call   8010a7 <sys_ipc_call>
+  802382:	83 c4 20             	add    $0x20,%esp
+  802385:	85 c0                	test   %eax,%eax
+  802387:	78 0b                	js     802394 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  802389:	a1 08 40 80 00       	mov    0x804008,%eax
+  80238e:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802394:	c9                   	leave
+  802395:	c3                   	ret
+
+00802396 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  802396:	55                   	push   %ebp
+  802397:	89 e5                	mov    %esp,%ebp
+  802399:	57                   	push   %edi
+  80239a:	56                   	push   %esi
+  80239b:	53                   	push   %ebx
+  80239c:	83 ec 18             	sub    $0x18,%esp
+  80239f:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023a2:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8023a5:	8b 75 20             	mov    0x20(%ebp),%esi
+  8023a8:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8023ab:	85 c0                	test   %eax,%eax
+  8023ad:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8023b2:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8023b5:	ff 75 18             	push   0x18(%ebp)
+  8023b8:	ff 75 14             	push   0x14(%ebp)
+  8023bb:	50                   	push   %eax
+  8023bc:	ff 75 0c             	push   0xc(%ebp)
+  8023bf:	ff 75 08             	push   0x8(%ebp)
+  8023c2:	e8 21 ed ff ff       	call   8010e8 <sys_ipc_reply_recv>
+  8023c7:	83 c4 20             	add    $0x20,%esp
+  8023ca:	85 c0                	test   %eax,%eax
+  8023cc:	78 46                	js     802414 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8023ce:	85 ff                	test   %edi,%edi
+  8023d0:	74 0d                	je     8023df <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8023d2:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023d7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8023dd:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8023df:	85 f6                	test   %esi,%esi
+  8023e1:	74 0d                	je     8023f0 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8023e3:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023e8:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8023ee:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8023f0:	85 db                	test   %ebx,%ebx
+  8023f2:	74 0d                	je     802401 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8023f4:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023f9:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8023ff:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802401:	a1 08 40 80 00       	mov    0x804008,%eax
+  802406:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80240c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80240f:	5b                   	pop    %ebx
+  802410:	5e                   	pop    %esi
+  802411:	5f                   	pop    %edi
+  802412:	5d                   	pop    %ebp
+  802413:	c3                   	ret
+		if (from_env_store) {
+  802414:	85 ff                	test   %edi,%edi
+  802416:	74 06                	je     80241e <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  802418:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80241e:	85 f6                	test   %esi,%esi
+  802420:	74 06                	je     802428 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  802422:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802428:	85 db                	test   %ebx,%ebx
+  80242a:	74 e0                	je     80240c <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  80242c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802432:	eb d8                	jmp    80240c <ipc_reply_recv+0x76>
+
+00802434 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802434:	55                   	push   %ebp
+  802435:	89 e5                	mov    %esp,%ebp
+  802437:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80243a:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80243f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802442:	c1 e0 06             	shl    $0x6,%eax
+  802445:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80244a:	8b 40 50             	mov    0x50(%eax),%eax
+  80244d:	39 c8                	cmp    %ecx,%eax
+  80244f:	74 12                	je     802463 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802451:	83 c2 01             	add    $0x1,%edx
+  802454:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80245a:	75 e3                	jne    80243f <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80245c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802461:	eb 0e                	jmp    802471 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802463:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802466:	c1 e0 06             	shl    $0x6,%eax
+  802469:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80246e:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802471:	5d                   	pop    %ebp
+  802472:	c3                   	ret
+
+00802473 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802473:	55                   	push   %ebp
+  802474:	89 e5                	mov    %esp,%ebp
+  802476:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802479:	89 c2                	mov    %eax,%edx
+  80247b:	c1 ea 16             	shr    $0x16,%edx
+  80247e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802485:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80248a:	f6 c1 01             	test   $0x1,%cl
+  80248d:	74 1e                	je     8024ad <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  80248f:	c1 e8 0c             	shr    $0xc,%eax
+  802492:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802499:	a8 01                	test   $0x1,%al
+  80249b:	74 10                	je     8024ad <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80249d:	c1 e8 0c             	shr    $0xc,%eax
+  8024a0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8024a3:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  8024aa:	0f b7 d2             	movzwl %dx,%edx
+}
+  8024ad:	89 d0                	mov    %edx,%eax
+  8024af:	5d                   	pop    %ebp
+  8024b0:	c3                   	ret
+
+008024b1 <udivmod>:
+  8024b1:	55                   	push   %ebp
+  8024b2:	57                   	push   %edi
+  8024b3:	56                   	push   %esi
+  8024b4:	53                   	push   %ebx
+  8024b5:	83 ec 24             	sub    $0x24,%esp
+  8024b8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8024bc:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8024c0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8024c4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8024c8:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024cc:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024d0:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8024d4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024e3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024ea:	00 
+  8024eb:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024f2:	00 
+  8024f3:	89 fb                	mov    %edi,%ebx
+  8024f5:	eb 08                	jmp    8024ff <udivmod+0x4e>
+  8024f7:	83 e9 01             	sub    $0x1,%ecx
+  8024fa:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8024fd:	74 68                	je     802567 <udivmod+0xb6>
+  8024ff:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802503:	01 c0                	add    %eax,%eax
+  802505:	89 c6                	mov    %eax,%esi
+  802507:	89 d7                	mov    %edx,%edi
+  802509:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80250d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802511:	0f ad d0             	shrd   %cl,%edx,%eax
+  802514:	d3 ea                	shr    %cl,%edx
+  802516:	f6 c1 20             	test   $0x20,%cl
+  802519:	74 04                	je     80251f <udivmod+0x6e>
+  80251b:	89 d0                	mov    %edx,%eax
+  80251d:	31 d2                	xor    %edx,%edx
+  80251f:	83 e0 01             	and    $0x1,%eax
+  802522:	89 04 24             	mov    %eax,(%esp)
+  802525:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80252c:	00 
+  80252d:	8b 04 24             	mov    (%esp),%eax
+  802530:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802534:	09 f0                	or     %esi,%eax
+  802536:	09 fa                	or     %edi,%edx
+  802538:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80253c:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802540:	39 f0                	cmp    %esi,%eax
+  802542:	89 d5                	mov    %edx,%ebp
+  802544:	19 fd                	sbb    %edi,%ebp
+  802546:	72 af                	jb     8024f7 <udivmod+0x46>
+  802548:	29 f0                	sub    %esi,%eax
+  80254a:	19 fa                	sbb    %edi,%edx
+  80254c:	89 cf                	mov    %ecx,%edi
+  80254e:	c1 ef 05             	shr    $0x5,%edi
+  802551:	83 e7 01             	and    $0x1,%edi
+  802554:	89 fe                	mov    %edi,%esi
+  802556:	83 f6 01             	xor    $0x1,%esi
+  802559:	d3 e6                	shl    %cl,%esi
+  80255b:	d3 e7                	shl    %cl,%edi
+  80255d:	09 74 24 18          	or     %esi,0x18(%esp)
+  802561:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802565:	eb 90                	jmp    8024f7 <udivmod+0x46>
+  802567:	85 db                	test   %ebx,%ebx
+  802569:	74 05                	je     802570 <udivmod+0xbf>
+  80256b:	89 03                	mov    %eax,(%ebx)
+  80256d:	89 53 04             	mov    %edx,0x4(%ebx)
+  802570:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802574:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802578:	83 c4 24             	add    $0x24,%esp
+  80257b:	5b                   	pop    %ebx
+  80257c:	5e                   	pop    %esi
+  80257d:	5f                   	pop    %edi
+  80257e:	5d                   	pop    %ebp
+  80257f:	c3                   	ret
+
+00802580 <__udivdi3>:
+  802580:	83 ec 08             	sub    $0x8,%esp
+  802583:	6a 00                	push   $0x0
+  802585:	ff 74 24 1c          	push   0x1c(%esp)
+  802589:	ff 74 24 1c          	push   0x1c(%esp)
+  80258d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802591:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802595:	e8 17 ff ff ff       	call   8024b1 <udivmod>
+  80259a:	83 c4 14             	add    $0x14,%esp
+  80259d:	c3                   	ret
+
+0080259e <__umoddi3>:
+  80259e:	83 ec 18             	sub    $0x18,%esp
+  8025a1:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8025a5:	50                   	push   %eax
+  8025a6:	ff 74 24 2c          	push   0x2c(%esp)
+  8025aa:	ff 74 24 2c          	push   0x2c(%esp)
+  8025ae:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025b2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025b6:	e8 f6 fe ff ff       	call   8024b1 <udivmod>
+  8025bb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025bf:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025c3:	83 c4 24             	add    $0x24,%esp
+  8025c6:	c3                   	ret
+
+008025c7 <__divdi3>:
+  8025c7:	55                   	push   %ebp
+  8025c8:	57                   	push   %edi
+  8025c9:	56                   	push   %esi
+  8025ca:	53                   	push   %ebx
+  8025cb:	83 ec 10             	sub    $0x10,%esp
+  8025ce:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8025d2:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8025d6:	89 c6                	mov    %eax,%esi
+  8025d8:	89 d7                	mov    %edx,%edi
+  8025da:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8025de:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8025e2:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025e6:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8025ea:	89 c5                	mov    %eax,%ebp
+  8025ec:	f7 dd                	neg    %ebp
+  8025ee:	89 d6                	mov    %edx,%esi
+  8025f0:	83 d6 00             	adc    $0x0,%esi
+  8025f3:	f7 de                	neg    %esi
+  8025f5:	0f 48 e8             	cmovs  %eax,%ebp
+  8025f8:	0f 49 d6             	cmovns %esi,%edx
+  8025fb:	6a 00                	push   $0x0
+  8025fd:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802601:	f7 de                	neg    %esi
+  802603:	8b 44 24 34          	mov    0x34(%esp),%eax
+  802607:	83 d0 00             	adc    $0x0,%eax
+  80260a:	f7 d8                	neg    %eax
+  80260c:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  802611:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  802616:	50                   	push   %eax
+  802617:	56                   	push   %esi
+  802618:	89 e8                	mov    %ebp,%eax
+  80261a:	e8 92 fe ff ff       	call   8024b1 <udivmod>
+  80261f:	83 c4 10             	add    $0x10,%esp
+  802622:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  802627:	78 08                	js     802631 <__divdi3+0x6a>
+  802629:	83 c4 0c             	add    $0xc,%esp
+  80262c:	5b                   	pop    %ebx
+  80262d:	5e                   	pop    %esi
+  80262e:	5f                   	pop    %edi
+  80262f:	5d                   	pop    %ebp
+  802630:	c3                   	ret
+  802631:	f7 d8                	neg    %eax
+  802633:	83 d2 00             	adc    $0x0,%edx
+  802636:	f7 da                	neg    %edx
+  802638:	eb ef                	jmp    802629 <__divdi3+0x62>
+
+0080263a <__moddi3>:
+  80263a:	55                   	push   %ebp
+  80263b:	57                   	push   %edi
+  80263c:	56                   	push   %esi
+  80263d:	53                   	push   %ebx
+  80263e:	83 ec 18             	sub    $0x18,%esp
+  802641:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802645:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802649:	89 f1                	mov    %esi,%ecx
+  80264b:	f7 d9                	neg    %ecx
+  80264d:	89 da                	mov    %ebx,%edx
+  80264f:	83 d2 00             	adc    $0x0,%edx
+  802652:	f7 da                	neg    %edx
+  802654:	0f 48 ce             	cmovs  %esi,%ecx
+  802657:	0f 48 d3             	cmovs  %ebx,%edx
+  80265a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80265e:	50                   	push   %eax
+  80265f:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802663:	f7 de                	neg    %esi
+  802665:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802669:	83 d0 00             	adc    $0x0,%eax
+  80266c:	f7 d8                	neg    %eax
+  80266e:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802673:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802678:	50                   	push   %eax
+  802679:	56                   	push   %esi
+  80267a:	89 c8                	mov    %ecx,%eax
+  80267c:	e8 30 fe ff ff       	call   8024b1 <udivmod>
+  802681:	83 c4 10             	add    $0x10,%esp
+  802684:	85 db                	test   %ebx,%ebx
+  802686:	78 10                	js     802698 <__moddi3+0x5e>
+  802688:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80268c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802690:	83 c4 14             	add    $0x14,%esp
+  802693:	5b                   	pop    %ebx
+  802694:	5e                   	pop    %esi
+  802695:	5f                   	pop    %edi
+  802696:	5d                   	pop    %ebp
+  802697:	c3                   	ret
+  802698:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80269c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026a0:	f7 d8                	neg    %eax
+  8026a2:	83 d2 00             	adc    $0x0,%edx
+  8026a5:	f7 da                	neg    %edx
+  8026a7:	eb e7                	jmp    802690 <__moddi3+0x56>
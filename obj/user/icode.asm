@@ -0,0 +1,6316 @@
+
+obj/user/icode.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 03 01 00 00       	call   800134 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	81 ec 1c 02 00 00    	sub    $0x21c,%esp
+	int fd, n, r;
+	char buf[512+1];
+
+	binaryname = "icode";
+  80003e:	c7 05 00 40 80 00 60 	movl   $0x802e60,0x804000
+  800045:	2e 80 00 
+
+	cprintf("icode startup\n");
+  800048:	68 66 2e 80 00       	push   $0x802e66
+  80004d:	e8 20 02 00 00       	call   800272 <cprintf>
+
+	cprintf("icode: open /motd\n");
+  800052:	c7 04 24 75 2e 80 00 	movl   $0x802e75,(%esp)
+  800059:	e8 14 02 00 00       	call   800272 <cprintf>
+	if ((fd = open("/motd", O_RDONLY)) < 0)
+  80005e:	83 c4 08             	add    $0x8,%esp
+  800061:	6a 00                	push   $0x0
+  800063:	68 88 2e 80 00       	push   $0x802e88
+  800068:	e8 8f 1a 00 00       	call   801afc <open>
+  80006d:	89 c6                	mov    %eax,%esi
+  80006f:	83 c4 10             	add    $0x10,%esp
+  800072:	85 c0                	test   %eax,%eax
+  800074:	78 18                	js     80008e <umain+0x5b>
+		panic("icode: open /motd: %e", fd);
+
+	cprintf("icode: read /motd\n");
+  800076:	83 ec 0c             	sub    $0xc,%esp
+  800079:	68 b1 2e 80 00       	push   $0x802eb1
+  80007e:	e8 ef 01 00 00       	call   800272 <cprintf>
+	while ((n = read(fd, buf, sizeof buf-1)) > 0)
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	8d 9d f7 fd ff ff    	lea    -0x209(%ebp),%ebx
+  80008c:	eb 1f                	jmp    8000ad <umain+0x7a>
+		panic("icode: open /motd: %e", fd);
+  80008e:	50                   	push   %eax
+  80008f:	68 8e 2e 80 00       	push   $0x802e8e
+  800094:	6a 0f                	push   $0xf
+  800096:	68 a4 2e 80 00       	push   $0x802ea4
+  80009b:	e8 f7 00 00 00       	call   800197 <_panic>
+		sys_cputs(buf, n);
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+  8000a3:	50                   	push   %eax
+  8000a4:	53                   	push   %ebx
+  8000a5:	e8 d5 0b 00 00       	call   800c7f <sys_cputs>
+  8000aa:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(fd, buf, sizeof buf-1)) > 0)
+  8000ad:	83 ec 04             	sub    $0x4,%esp
+  8000b0:	68 00 02 00 00       	push   $0x200
+  8000b5:	53                   	push   %ebx
+  8000b6:	56                   	push   %esi
+  8000b7:	e8 05 15 00 00       	call   8015c1 <read>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	7f dd                	jg     8000a0 <umain+0x6d>
+
+	cprintf("icode: close /motd\n");
+  8000c3:	83 ec 0c             	sub    $0xc,%esp
+  8000c6:	68 c4 2e 80 00       	push   $0x802ec4
+  8000cb:	e8 a2 01 00 00       	call   800272 <cprintf>
+	close(fd);
+  8000d0:	89 34 24             	mov    %esi,(%esp)
+  8000d3:	e8 ad 13 00 00       	call   801485 <close>
+
+	cprintf("icode: spawn /init\n");
+  8000d8:	c7 04 24 d8 2e 80 00 	movl   $0x802ed8,(%esp)
+  8000df:	e8 8e 01 00 00       	call   800272 <cprintf>
+	if ((r = spawnl("/init", "init", "initarg1", "initarg2", (char*)0)) < 0)
+  8000e4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000eb:	68 ec 2e 80 00       	push   $0x802eec
+  8000f0:	68 f5 2e 80 00       	push   $0x802ef5
+  8000f5:	68 ff 2e 80 00       	push   $0x802eff
+  8000fa:	68 fe 2e 80 00       	push   $0x802efe
+  8000ff:	e8 c2 21 00 00       	call   8022c6 <spawnl>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	85 c0                	test   %eax,%eax
+  800109:	78 17                	js     800122 <umain+0xef>
+		panic("icode: spawn /init: %e", r);
+
+	cprintf("icode: exiting\n");
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 1b 2f 80 00       	push   $0x802f1b
+  800113:	e8 5a 01 00 00       	call   800272 <cprintf>
+}
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80011e:	5b                   	pop    %ebx
+  80011f:	5e                   	pop    %esi
+  800120:	5d                   	pop    %ebp
+  800121:	c3                   	ret
+		panic("icode: spawn /init: %e", r);
+  800122:	50                   	push   %eax
+  800123:	68 04 2f 80 00       	push   $0x802f04
+  800128:	6a 1a                	push   $0x1a
+  80012a:	68 a4 2e 80 00       	push   $0x802ea4
+  80012f:	e8 63 00 00 00       	call   800197 <_panic>
+
+00800134 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800134:	55                   	push   %ebp
+  800135:	89 e5                	mov    %esp,%ebp
+  800137:	56                   	push   %esi
+  800138:	53                   	push   %ebx
+  800139:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80013c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  80013f:	e8 ca 0b 00 00       	call   800d0e <sys_getenvid>
+  800144:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800149:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80014c:	c1 e0 06             	shl    $0x6,%eax
+  80014f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800154:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800159:	85 db                	test   %ebx,%ebx
+  80015b:	7e 07                	jle    800164 <libmain+0x30>
+		binaryname = argv[0];
+  80015d:	8b 06                	mov    (%esi),%eax
+  80015f:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800164:	83 ec 08             	sub    $0x8,%esp
+  800167:	56                   	push   %esi
+  800168:	53                   	push   %ebx
+  800169:	e8 c5 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80016e:	e8 0a 00 00 00       	call   80017d <exit>
+}
+  800173:	83 c4 10             	add    $0x10,%esp
+  800176:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800179:	5b                   	pop    %ebx
+  80017a:	5e                   	pop    %esi
+  80017b:	5d                   	pop    %ebp
+  80017c:	c3                   	ret
+
+0080017d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80017d:	55                   	push   %ebp
+  80017e:	89 e5                	mov    %esp,%ebp
+  800180:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800183:	e8 2a 13 00 00       	call   8014b2 <close_all>
+	sys_env_destroy(0);
+  800188:	83 ec 0c             	sub    $0xc,%esp
+  80018b:	6a 00                	push   $0x0
+  80018d:	e8 3b 0b 00 00       	call   800ccd <sys_env_destroy>
+}
+  800192:	83 c4 10             	add    $0x10,%esp
+  800195:	c9                   	leave
+  800196:	c3                   	ret
+
+00800197 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800197:	55                   	push   %ebp
+  800198:	89 e5                	mov    %esp,%ebp
+  80019a:	56                   	push   %esi
+  80019b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80019c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80019f:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8001a5:	e8 64 0b 00 00       	call   800d0e <sys_getenvid>
+  8001aa:	83 ec 0c             	sub    $0xc,%esp
+  8001ad:	ff 75 0c             	push   0xc(%ebp)
+  8001b0:	ff 75 08             	push   0x8(%ebp)
+  8001b3:	56                   	push   %esi
+  8001b4:	50                   	push   %eax
+  8001b5:	68 38 2f 80 00       	push   $0x802f38
+  8001ba:	e8 b3 00 00 00       	call   800272 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001bf:	83 c4 18             	add    $0x18,%esp
+  8001c2:	53                   	push   %ebx
+  8001c3:	ff 75 10             	push   0x10(%ebp)
+  8001c6:	e8 56 00 00 00       	call   800221 <vcprintf>
+	cprintf("\n");
+  8001cb:	c7 04 24 4a 34 80 00 	movl   $0x80344a,(%esp)
+  8001d2:	e8 9b 00 00 00       	call   800272 <cprintf>
+  8001d7:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001da:	cc                   	int3
+	while (1)
+  8001db:	eb fd                	jmp    8001da <_panic+0x43>
+
+008001dd <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	53                   	push   %ebx
+  8001e1:	83 ec 04             	sub    $0x4,%esp
+  8001e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001e7:	8b 13                	mov    (%ebx),%edx
+  8001e9:	8d 42 01             	lea    0x1(%edx),%eax
+  8001ec:	89 03                	mov    %eax,(%ebx)
+  8001ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001f1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001f5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001fa:	74 09                	je     800205 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001fc:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800200:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800203:	c9                   	leave
+  800204:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800205:	83 ec 08             	sub    $0x8,%esp
+  800208:	68 ff 00 00 00       	push   $0xff
+  80020d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800210:	50                   	push   %eax
+  800211:	e8 69 0a 00 00       	call   800c7f <sys_cputs>
+		b->idx = 0;
+  800216:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80021c:	83 c4 10             	add    $0x10,%esp
+  80021f:	eb db                	jmp    8001fc <putch+0x1f>
+
+00800221 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800221:	55                   	push   %ebp
+  800222:	89 e5                	mov    %esp,%ebp
+  800224:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80022a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800231:	00 00 00 
+	b.cnt = 0;
+  800234:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80023b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80023e:	ff 75 0c             	push   0xc(%ebp)
+  800241:	ff 75 08             	push   0x8(%ebp)
+  800244:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80024a:	50                   	push   %eax
+  80024b:	68 dd 01 80 00       	push   $0x8001dd
+  800250:	e8 14 01 00 00       	call   800369 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800255:	83 c4 08             	add    $0x8,%esp
+  800258:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80025e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800264:	50                   	push   %eax
+  800265:	e8 15 0a 00 00       	call   800c7f <sys_cputs>
+
+	return b.cnt;
+}
+  80026a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800270:	c9                   	leave
+  800271:	c3                   	ret
+
+00800272 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800272:	55                   	push   %ebp
+  800273:	89 e5                	mov    %esp,%ebp
+  800275:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800278:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80027b:	50                   	push   %eax
+  80027c:	ff 75 08             	push   0x8(%ebp)
+  80027f:	e8 9d ff ff ff       	call   800221 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800284:	c9                   	leave
+  800285:	c3                   	ret
+
+00800286 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800286:	55                   	push   %ebp
+  800287:	89 e5                	mov    %esp,%ebp
+  800289:	57                   	push   %edi
+  80028a:	56                   	push   %esi
+  80028b:	53                   	push   %ebx
+  80028c:	83 ec 1c             	sub    $0x1c,%esp
+  80028f:	89 c7                	mov    %eax,%edi
+  800291:	89 d6                	mov    %edx,%esi
+  800293:	8b 45 08             	mov    0x8(%ebp),%eax
+  800296:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800299:	89 d1                	mov    %edx,%ecx
+  80029b:	89 c2                	mov    %eax,%edx
+  80029d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002a0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002a3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002a6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002a9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002ac:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002b3:	39 c2                	cmp    %eax,%edx
+  8002b5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002b8:	72 3e                	jb     8002f8 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002ba:	83 ec 0c             	sub    $0xc,%esp
+  8002bd:	ff 75 18             	push   0x18(%ebp)
+  8002c0:	83 eb 01             	sub    $0x1,%ebx
+  8002c3:	53                   	push   %ebx
+  8002c4:	50                   	push   %eax
+  8002c5:	83 ec 08             	sub    $0x8,%esp
+  8002c8:	ff 75 e4             	push   -0x1c(%ebp)
+  8002cb:	ff 75 e0             	push   -0x20(%ebp)
+  8002ce:	ff 75 dc             	push   -0x24(%ebp)
+  8002d1:	ff 75 d8             	push   -0x28(%ebp)
+  8002d4:	e8 53 2a 00 00       	call   802d2c <__udivdi3>
+  8002d9:	83 c4 18             	add    $0x18,%esp
+  8002dc:	52                   	push   %edx
+  8002dd:	50                   	push   %eax
+  8002de:	89 f2                	mov    %esi,%edx
+  8002e0:	89 f8                	mov    %edi,%eax
+  8002e2:	e8 9f ff ff ff       	call   800286 <printnum>
+  8002e7:	83 c4 20             	add    $0x20,%esp
+  8002ea:	eb 13                	jmp    8002ff <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002ec:	83 ec 08             	sub    $0x8,%esp
+  8002ef:	56                   	push   %esi
+  8002f0:	ff 75 18             	push   0x18(%ebp)
+  8002f3:	ff d7                	call   *%edi
+  8002f5:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002f8:	83 eb 01             	sub    $0x1,%ebx
+  8002fb:	85 db                	test   %ebx,%ebx
+  8002fd:	7f ed                	jg     8002ec <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002ff:	83 ec 08             	sub    $0x8,%esp
+  800302:	56                   	push   %esi
+  800303:	83 ec 04             	sub    $0x4,%esp
+  800306:	ff 75 e4             	push   -0x1c(%ebp)
+  800309:	ff 75 e0             	push   -0x20(%ebp)
+  80030c:	ff 75 dc             	push   -0x24(%ebp)
+  80030f:	ff 75 d8             	push   -0x28(%ebp)
+  800312:	e8 33 2a 00 00       	call   802d4a <__umoddi3>
+  800317:	83 c4 14             	add    $0x14,%esp
+  80031a:	0f be 80 5b 2f 80 00 	movsbl 0x802f5b(%eax),%eax
+  800321:	50                   	push   %eax
+  800322:	ff d7                	call   *%edi
+}
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80032a:	5b                   	pop    %ebx
+  80032b:	5e                   	pop    %esi
+  80032c:	5f                   	pop    %edi
+  80032d:	5d                   	pop    %ebp
+  80032e:	c3                   	ret
+
+0080032f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80032f:	55                   	push   %ebp
+  800330:	89 e5                	mov    %esp,%ebp
+  800332:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800335:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800339:	8b 10                	mov    (%eax),%edx
+  80033b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80033e:	73 0a                	jae    80034a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800340:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800343:	89 08                	mov    %ecx,(%eax)
+  800345:	8b 45 08             	mov    0x8(%ebp),%eax
+  800348:	88 02                	mov    %al,(%edx)
+}
+  80034a:	5d                   	pop    %ebp
+  80034b:	c3                   	ret
+
+0080034c <printfmt>:
+{
+  80034c:	55                   	push   %ebp
+  80034d:	89 e5                	mov    %esp,%ebp
+  80034f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800352:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800355:	50                   	push   %eax
+  800356:	ff 75 10             	push   0x10(%ebp)
+  800359:	ff 75 0c             	push   0xc(%ebp)
+  80035c:	ff 75 08             	push   0x8(%ebp)
+  80035f:	e8 05 00 00 00       	call   800369 <vprintfmt>
+}
+  800364:	83 c4 10             	add    $0x10,%esp
+  800367:	c9                   	leave
+  800368:	c3                   	ret
+
+00800369 <vprintfmt>:
+{
+  800369:	55                   	push   %ebp
+  80036a:	89 e5                	mov    %esp,%ebp
+  80036c:	57                   	push   %edi
+  80036d:	56                   	push   %esi
+  80036e:	53                   	push   %ebx
+  80036f:	83 ec 2c             	sub    $0x2c,%esp
+  800372:	8b 75 08             	mov    0x8(%ebp),%esi
+  800375:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800378:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80037b:	eb 0a                	jmp    800387 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80037d:	83 ec 08             	sub    $0x8,%esp
+  800380:	53                   	push   %ebx
+  800381:	50                   	push   %eax
+  800382:	ff d6                	call   *%esi
+  800384:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800387:	83 c7 01             	add    $0x1,%edi
+  80038a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80038e:	83 f8 25             	cmp    $0x25,%eax
+  800391:	74 0c                	je     80039f <vprintfmt+0x36>
+			if (ch == '\0')
+  800393:	85 c0                	test   %eax,%eax
+  800395:	75 e6                	jne    80037d <vprintfmt+0x14>
+}
+  800397:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80039a:	5b                   	pop    %ebx
+  80039b:	5e                   	pop    %esi
+  80039c:	5f                   	pop    %edi
+  80039d:	5d                   	pop    %ebp
+  80039e:	c3                   	ret
+		padc = ' ';
+  80039f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003a3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003aa:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003b1:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003bd:	8d 47 01             	lea    0x1(%edi),%eax
+  8003c0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003c3:	0f b6 17             	movzbl (%edi),%edx
+  8003c6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003c9:	3c 55                	cmp    $0x55,%al
+  8003cb:	0f 87 c5 03 00 00    	ja     800796 <vprintfmt+0x42d>
+  8003d1:	0f b6 c0             	movzbl %al,%eax
+  8003d4:	ff 24 85 e0 30 80 00 	jmp    *0x8030e0(,%eax,4)
+  8003db:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003de:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003e2:	eb d9                	jmp    8003bd <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003e7:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003eb:	eb d0                	jmp    8003bd <vprintfmt+0x54>
+  8003ed:	0f b6 d2             	movzbl %dl,%edx
+  8003f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003fb:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003fe:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800402:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800405:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800408:	83 f9 09             	cmp    $0x9,%ecx
+  80040b:	77 55                	ja     800462 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80040d:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800410:	eb e9                	jmp    8003fb <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800412:	8b 45 14             	mov    0x14(%ebp),%eax
+  800415:	8b 00                	mov    (%eax),%eax
+  800417:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80041a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041d:	8d 40 04             	lea    0x4(%eax),%eax
+  800420:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800423:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800426:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80042a:	79 91                	jns    8003bd <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80042c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80042f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800432:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800439:	eb 82                	jmp    8003bd <vprintfmt+0x54>
+			if (width < 0)
+  80043b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80043e:	85 d2                	test   %edx,%edx
+  800440:	b8 00 00 00 00       	mov    $0x0,%eax
+  800445:	0f 49 c2             	cmovns %edx,%eax
+  800448:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80044b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80044e:	e9 6a ff ff ff       	jmp    8003bd <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800453:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800456:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80045d:	e9 5b ff ff ff       	jmp    8003bd <vprintfmt+0x54>
+  800462:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800465:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800468:	eb bc                	jmp    800426 <vprintfmt+0xbd>
+			lflag++;
+  80046a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80046d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800470:	e9 48 ff ff ff       	jmp    8003bd <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800475:	8b 45 14             	mov    0x14(%ebp),%eax
+  800478:	8d 78 04             	lea    0x4(%eax),%edi
+  80047b:	83 ec 08             	sub    $0x8,%esp
+  80047e:	53                   	push   %ebx
+  80047f:	ff 30                	push   (%eax)
+  800481:	ff d6                	call   *%esi
+			break;
+  800483:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800486:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800489:	e9 63 02 00 00       	jmp    8006f1 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  80048e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800491:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800494:	8b 10                	mov    (%eax),%edx
+  800496:	89 d0                	mov    %edx,%eax
+  800498:	f7 d8                	neg    %eax
+  80049a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80049d:	83 f8 12             	cmp    $0x12,%eax
+  8004a0:	7f 23                	jg     8004c5 <vprintfmt+0x15c>
+  8004a2:	8b 14 85 40 32 80 00 	mov    0x803240(,%eax,4),%edx
+  8004a9:	85 d2                	test   %edx,%edx
+  8004ab:	74 18                	je     8004c5 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004ad:	52                   	push   %edx
+  8004ae:	68 7d 33 80 00       	push   $0x80337d
+  8004b3:	53                   	push   %ebx
+  8004b4:	56                   	push   %esi
+  8004b5:	e8 92 fe ff ff       	call   80034c <printfmt>
+  8004ba:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004bd:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004c0:	e9 2c 02 00 00       	jmp    8006f1 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  8004c5:	50                   	push   %eax
+  8004c6:	68 73 2f 80 00       	push   $0x802f73
+  8004cb:	53                   	push   %ebx
+  8004cc:	56                   	push   %esi
+  8004cd:	e8 7a fe ff ff       	call   80034c <printfmt>
+  8004d2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004d5:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004d8:	e9 14 02 00 00       	jmp    8006f1 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e0:	83 c0 04             	add    $0x4,%eax
+  8004e3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e9:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004eb:	85 c9                	test   %ecx,%ecx
+  8004ed:	b8 6c 2f 80 00       	mov    $0x802f6c,%eax
+  8004f2:	0f 45 c1             	cmovne %ecx,%eax
+  8004f5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004f8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004fc:	7e 06                	jle    800504 <vprintfmt+0x19b>
+  8004fe:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800502:	75 0b                	jne    80050f <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800504:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800507:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80050a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80050d:	eb 5c                	jmp    80056b <vprintfmt+0x202>
+  80050f:	83 ec 08             	sub    $0x8,%esp
+  800512:	ff 75 d0             	push   -0x30(%ebp)
+  800515:	ff 75 cc             	push   -0x34(%ebp)
+  800518:	e8 19 03 00 00       	call   800836 <strnlen>
+  80051d:	89 c2                	mov    %eax,%edx
+  80051f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800522:	29 d0                	sub    %edx,%eax
+  800524:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800527:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80052b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80052e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800531:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800533:	eb 0e                	jmp    800543 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800535:	83 ec 08             	sub    $0x8,%esp
+  800538:	53                   	push   %ebx
+  800539:	57                   	push   %edi
+  80053a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80053d:	83 ee 01             	sub    $0x1,%esi
+  800540:	83 c4 10             	add    $0x10,%esp
+  800543:	85 f6                	test   %esi,%esi
+  800545:	7f ee                	jg     800535 <vprintfmt+0x1cc>
+  800547:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80054a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054d:	85 c0                	test   %eax,%eax
+  80054f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800554:	0f 49 d0             	cmovns %eax,%edx
+  800557:	29 d0                	sub    %edx,%eax
+  800559:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80055c:	eb a6                	jmp    800504 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80055e:	83 ec 08             	sub    $0x8,%esp
+  800561:	53                   	push   %ebx
+  800562:	52                   	push   %edx
+  800563:	ff 55 08             	call   *0x8(%ebp)
+  800566:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800569:	89 f1                	mov    %esi,%ecx
+  80056b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80056e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800572:	0f be d0             	movsbl %al,%edx
+  800575:	85 d2                	test   %edx,%edx
+  800577:	74 28                	je     8005a1 <vprintfmt+0x238>
+  800579:	85 ff                	test   %edi,%edi
+  80057b:	78 05                	js     800582 <vprintfmt+0x219>
+  80057d:	83 ef 01             	sub    $0x1,%edi
+  800580:	78 30                	js     8005b2 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800582:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800586:	74 d6                	je     80055e <vprintfmt+0x1f5>
+  800588:	0f be c0             	movsbl %al,%eax
+  80058b:	83 e8 20             	sub    $0x20,%eax
+  80058e:	83 f8 5e             	cmp    $0x5e,%eax
+  800591:	76 cb                	jbe    80055e <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800593:	83 ec 08             	sub    $0x8,%esp
+  800596:	53                   	push   %ebx
+  800597:	6a 3f                	push   $0x3f
+  800599:	ff 55 08             	call   *0x8(%ebp)
+  80059c:	83 c4 10             	add    $0x10,%esp
+  80059f:	eb c8                	jmp    800569 <vprintfmt+0x200>
+  8005a1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005a4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005a7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005aa:	01 d0                	add    %edx,%eax
+  8005ac:	29 c8                	sub    %ecx,%eax
+  8005ae:	89 c7                	mov    %eax,%edi
+  8005b0:	eb 13                	jmp    8005c5 <vprintfmt+0x25c>
+  8005b2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005b5:	eb ed                	jmp    8005a4 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005b7:	83 ec 08             	sub    $0x8,%esp
+  8005ba:	53                   	push   %ebx
+  8005bb:	6a 20                	push   $0x20
+  8005bd:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005bf:	83 ef 01             	sub    $0x1,%edi
+  8005c2:	83 c4 10             	add    $0x10,%esp
+  8005c5:	85 ff                	test   %edi,%edi
+  8005c7:	7f ee                	jg     8005b7 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005c9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005cc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005cf:	e9 1d 01 00 00       	jmp    8006f1 <vprintfmt+0x388>
+	if (lflag >= 2)
+  8005d4:	83 f9 01             	cmp    $0x1,%ecx
+  8005d7:	7f 1b                	jg     8005f4 <vprintfmt+0x28b>
+	else if (lflag)
+  8005d9:	85 c9                	test   %ecx,%ecx
+  8005db:	74 63                	je     800640 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  8005dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e0:	8b 00                	mov    (%eax),%eax
+  8005e2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e5:	99                   	cltd
+  8005e6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ef:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f2:	eb 17                	jmp    80060b <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  8005f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f7:	8b 50 04             	mov    0x4(%eax),%edx
+  8005fa:	8b 00                	mov    (%eax),%eax
+  8005fc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ff:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800602:	8b 45 14             	mov    0x14(%ebp),%eax
+  800605:	8d 40 08             	lea    0x8(%eax),%eax
+  800608:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80060b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80060e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800611:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800616:	85 c9                	test   %ecx,%ecx
+  800618:	0f 89 b9 00 00 00    	jns    8006d7 <vprintfmt+0x36e>
+				putch('-', putdat);
+  80061e:	83 ec 08             	sub    $0x8,%esp
+  800621:	53                   	push   %ebx
+  800622:	6a 2d                	push   $0x2d
+  800624:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800626:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800629:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80062c:	f7 da                	neg    %edx
+  80062e:	83 d1 00             	adc    $0x0,%ecx
+  800631:	f7 d9                	neg    %ecx
+  800633:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800636:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80063b:	e9 97 00 00 00       	jmp    8006d7 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800640:	8b 45 14             	mov    0x14(%ebp),%eax
+  800643:	8b 00                	mov    (%eax),%eax
+  800645:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800648:	99                   	cltd
+  800649:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80064c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064f:	8d 40 04             	lea    0x4(%eax),%eax
+  800652:	89 45 14             	mov    %eax,0x14(%ebp)
+  800655:	eb b4                	jmp    80060b <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  800657:	83 f9 01             	cmp    $0x1,%ecx
+  80065a:	7f 1b                	jg     800677 <vprintfmt+0x30e>
+	else if (lflag)
+  80065c:	85 c9                	test   %ecx,%ecx
+  80065e:	74 2c                	je     80068c <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800660:	8b 45 14             	mov    0x14(%ebp),%eax
+  800663:	8b 10                	mov    (%eax),%edx
+  800665:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066a:	8d 40 04             	lea    0x4(%eax),%eax
+  80066d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800670:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800675:	eb 60                	jmp    8006d7 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800677:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067a:	8b 10                	mov    (%eax),%edx
+  80067c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80067f:	8d 40 08             	lea    0x8(%eax),%eax
+  800682:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800685:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80068a:	eb 4b                	jmp    8006d7 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80068c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068f:	8b 10                	mov    (%eax),%edx
+  800691:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800696:	8d 40 04             	lea    0x4(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80069c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006a1:	eb 34                	jmp    8006d7 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8006a3:	83 f9 01             	cmp    $0x1,%ecx
+  8006a6:	7f 15                	jg     8006bd <vprintfmt+0x354>
+	else if (lflag)
+  8006a8:	85 c9                	test   %ecx,%ecx
+  8006aa:	74 4d                	je     8006f9 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8006ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006af:	8b 00                	mov    (%eax),%eax
+  8006b1:	99                   	cltd
+  8006b2:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006b5:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8006b8:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8006bb:	eb 11                	jmp    8006ce <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  8006bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c0:	8b 50 04             	mov    0x4(%eax),%edx
+  8006c3:	8b 00                	mov    (%eax),%eax
+  8006c5:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006c8:	8d 49 08             	lea    0x8(%ecx),%ecx
+  8006cb:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  8006ce:	89 d1                	mov    %edx,%ecx
+  8006d0:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  8006d2:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006d7:	83 ec 0c             	sub    $0xc,%esp
+  8006da:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006de:	50                   	push   %eax
+  8006df:	ff 75 e0             	push   -0x20(%ebp)
+  8006e2:	57                   	push   %edi
+  8006e3:	51                   	push   %ecx
+  8006e4:	52                   	push   %edx
+  8006e5:	89 da                	mov    %ebx,%edx
+  8006e7:	89 f0                	mov    %esi,%eax
+  8006e9:	e8 98 fb ff ff       	call   800286 <printnum>
+			break;
+  8006ee:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006f4:	e9 8e fc ff ff       	jmp    800387 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  8006f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fc:	8b 00                	mov    (%eax),%eax
+  8006fe:	99                   	cltd
+  8006ff:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800702:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800705:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800708:	eb c4                	jmp    8006ce <vprintfmt+0x365>
+			putch('0', putdat);
+  80070a:	83 ec 08             	sub    $0x8,%esp
+  80070d:	53                   	push   %ebx
+  80070e:	6a 30                	push   $0x30
+  800710:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800712:	83 c4 08             	add    $0x8,%esp
+  800715:	53                   	push   %ebx
+  800716:	6a 78                	push   $0x78
+  800718:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80071a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071d:	8b 10                	mov    (%eax),%edx
+  80071f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800724:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800727:	8d 40 04             	lea    0x4(%eax),%eax
+  80072a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80072d:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800732:	eb a3                	jmp    8006d7 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800734:	83 f9 01             	cmp    $0x1,%ecx
+  800737:	7f 1b                	jg     800754 <vprintfmt+0x3eb>
+	else if (lflag)
+  800739:	85 c9                	test   %ecx,%ecx
+  80073b:	74 2f                	je     80076c <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  80073d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800740:	8b 10                	mov    (%eax),%edx
+  800742:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800747:	8d 40 04             	lea    0x4(%eax),%eax
+  80074a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80074d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800752:	eb 83                	jmp    8006d7 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800754:	8b 45 14             	mov    0x14(%ebp),%eax
+  800757:	8b 10                	mov    (%eax),%edx
+  800759:	8b 48 04             	mov    0x4(%eax),%ecx
+  80075c:	8d 40 08             	lea    0x8(%eax),%eax
+  80075f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800762:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800767:	e9 6b ff ff ff       	jmp    8006d7 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80076c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076f:	8b 10                	mov    (%eax),%edx
+  800771:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800776:	8d 40 04             	lea    0x4(%eax),%eax
+  800779:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80077c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800781:	e9 51 ff ff ff       	jmp    8006d7 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800786:	83 ec 08             	sub    $0x8,%esp
+  800789:	53                   	push   %ebx
+  80078a:	6a 25                	push   $0x25
+  80078c:	ff d6                	call   *%esi
+			break;
+  80078e:	83 c4 10             	add    $0x10,%esp
+  800791:	e9 5b ff ff ff       	jmp    8006f1 <vprintfmt+0x388>
+			putch('%', putdat);
+  800796:	83 ec 08             	sub    $0x8,%esp
+  800799:	53                   	push   %ebx
+  80079a:	6a 25                	push   $0x25
+  80079c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80079e:	83 c4 10             	add    $0x10,%esp
+  8007a1:	89 f8                	mov    %edi,%eax
+  8007a3:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007a7:	74 05                	je     8007ae <vprintfmt+0x445>
+  8007a9:	83 e8 01             	sub    $0x1,%eax
+  8007ac:	eb f5                	jmp    8007a3 <vprintfmt+0x43a>
+  8007ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007b1:	e9 3b ff ff ff       	jmp    8006f1 <vprintfmt+0x388>
+
+008007b6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007b6:	55                   	push   %ebp
+  8007b7:	89 e5                	mov    %esp,%ebp
+  8007b9:	83 ec 18             	sub    $0x18,%esp
+  8007bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007c2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007c5:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007c9:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007cc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007d3:	85 c0                	test   %eax,%eax
+  8007d5:	74 26                	je     8007fd <vsnprintf+0x47>
+  8007d7:	85 d2                	test   %edx,%edx
+  8007d9:	7e 22                	jle    8007fd <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007db:	ff 75 14             	push   0x14(%ebp)
+  8007de:	ff 75 10             	push   0x10(%ebp)
+  8007e1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007e4:	50                   	push   %eax
+  8007e5:	68 2f 03 80 00       	push   $0x80032f
+  8007ea:	e8 7a fb ff ff       	call   800369 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007ef:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007f2:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007f8:	83 c4 10             	add    $0x10,%esp
+}
+  8007fb:	c9                   	leave
+  8007fc:	c3                   	ret
+		return -E_INVAL;
+  8007fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800802:	eb f7                	jmp    8007fb <vsnprintf+0x45>
+
+00800804 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800804:	55                   	push   %ebp
+  800805:	89 e5                	mov    %esp,%ebp
+  800807:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80080a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80080d:	50                   	push   %eax
+  80080e:	ff 75 10             	push   0x10(%ebp)
+  800811:	ff 75 0c             	push   0xc(%ebp)
+  800814:	ff 75 08             	push   0x8(%ebp)
+  800817:	e8 9a ff ff ff       	call   8007b6 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80081c:	c9                   	leave
+  80081d:	c3                   	ret
+
+0080081e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80081e:	55                   	push   %ebp
+  80081f:	89 e5                	mov    %esp,%ebp
+  800821:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800824:	b8 00 00 00 00       	mov    $0x0,%eax
+  800829:	eb 03                	jmp    80082e <strlen+0x10>
+		n++;
+  80082b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80082e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800832:	75 f7                	jne    80082b <strlen+0xd>
+	return n;
+}
+  800834:	5d                   	pop    %ebp
+  800835:	c3                   	ret
+
+00800836 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800836:	55                   	push   %ebp
+  800837:	89 e5                	mov    %esp,%ebp
+  800839:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80083c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80083f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800844:	eb 03                	jmp    800849 <strnlen+0x13>
+		n++;
+  800846:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800849:	39 d0                	cmp    %edx,%eax
+  80084b:	74 08                	je     800855 <strnlen+0x1f>
+  80084d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800851:	75 f3                	jne    800846 <strnlen+0x10>
+  800853:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800855:	89 d0                	mov    %edx,%eax
+  800857:	5d                   	pop    %ebp
+  800858:	c3                   	ret
+
+00800859 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800859:	55                   	push   %ebp
+  80085a:	89 e5                	mov    %esp,%ebp
+  80085c:	53                   	push   %ebx
+  80085d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800860:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800863:	b8 00 00 00 00       	mov    $0x0,%eax
+  800868:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80086c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80086f:	83 c0 01             	add    $0x1,%eax
+  800872:	84 d2                	test   %dl,%dl
+  800874:	75 f2                	jne    800868 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800876:	89 c8                	mov    %ecx,%eax
+  800878:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80087b:	c9                   	leave
+  80087c:	c3                   	ret
+
+0080087d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80087d:	55                   	push   %ebp
+  80087e:	89 e5                	mov    %esp,%ebp
+  800880:	53                   	push   %ebx
+  800881:	83 ec 10             	sub    $0x10,%esp
+  800884:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800887:	53                   	push   %ebx
+  800888:	e8 91 ff ff ff       	call   80081e <strlen>
+  80088d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800890:	ff 75 0c             	push   0xc(%ebp)
+  800893:	01 d8                	add    %ebx,%eax
+  800895:	50                   	push   %eax
+  800896:	e8 be ff ff ff       	call   800859 <strcpy>
+	return dst;
+}
+  80089b:	89 d8                	mov    %ebx,%eax
+  80089d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a0:	c9                   	leave
+  8008a1:	c3                   	ret
+
+008008a2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008a2:	55                   	push   %ebp
+  8008a3:	89 e5                	mov    %esp,%ebp
+  8008a5:	56                   	push   %esi
+  8008a6:	53                   	push   %ebx
+  8008a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008ad:	89 f3                	mov    %esi,%ebx
+  8008af:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008b2:	89 f0                	mov    %esi,%eax
+  8008b4:	eb 0f                	jmp    8008c5 <strncpy+0x23>
+		*dst++ = *src;
+  8008b6:	83 c0 01             	add    $0x1,%eax
+  8008b9:	0f b6 0a             	movzbl (%edx),%ecx
+  8008bc:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008bf:	80 f9 01             	cmp    $0x1,%cl
+  8008c2:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008c5:	39 d8                	cmp    %ebx,%eax
+  8008c7:	75 ed                	jne    8008b6 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008c9:	89 f0                	mov    %esi,%eax
+  8008cb:	5b                   	pop    %ebx
+  8008cc:	5e                   	pop    %esi
+  8008cd:	5d                   	pop    %ebp
+  8008ce:	c3                   	ret
+
+008008cf <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008cf:	55                   	push   %ebp
+  8008d0:	89 e5                	mov    %esp,%ebp
+  8008d2:	56                   	push   %esi
+  8008d3:	53                   	push   %ebx
+  8008d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008da:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008dd:	89 f0                	mov    %esi,%eax
+  8008df:	85 d2                	test   %edx,%edx
+  8008e1:	74 21                	je     800904 <strlcpy+0x35>
+  8008e3:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008e7:	89 f2                	mov    %esi,%edx
+  8008e9:	eb 09                	jmp    8008f4 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008eb:	83 c1 01             	add    $0x1,%ecx
+  8008ee:	83 c2 01             	add    $0x1,%edx
+  8008f1:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008f4:	39 c2                	cmp    %eax,%edx
+  8008f6:	74 09                	je     800901 <strlcpy+0x32>
+  8008f8:	0f b6 19             	movzbl (%ecx),%ebx
+  8008fb:	84 db                	test   %bl,%bl
+  8008fd:	75 ec                	jne    8008eb <strlcpy+0x1c>
+  8008ff:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800901:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800904:	29 f0                	sub    %esi,%eax
+}
+  800906:	5b                   	pop    %ebx
+  800907:	5e                   	pop    %esi
+  800908:	5d                   	pop    %ebp
+  800909:	c3                   	ret
+
+0080090a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80090a:	55                   	push   %ebp
+  80090b:	89 e5                	mov    %esp,%ebp
+  80090d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800910:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800913:	eb 06                	jmp    80091b <strcmp+0x11>
+		p++, q++;
+  800915:	83 c1 01             	add    $0x1,%ecx
+  800918:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80091b:	0f b6 01             	movzbl (%ecx),%eax
+  80091e:	84 c0                	test   %al,%al
+  800920:	74 04                	je     800926 <strcmp+0x1c>
+  800922:	3a 02                	cmp    (%edx),%al
+  800924:	74 ef                	je     800915 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800926:	0f b6 c0             	movzbl %al,%eax
+  800929:	0f b6 12             	movzbl (%edx),%edx
+  80092c:	29 d0                	sub    %edx,%eax
+}
+  80092e:	5d                   	pop    %ebp
+  80092f:	c3                   	ret
+
+00800930 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800930:	55                   	push   %ebp
+  800931:	89 e5                	mov    %esp,%ebp
+  800933:	53                   	push   %ebx
+  800934:	8b 45 08             	mov    0x8(%ebp),%eax
+  800937:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80093a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80093d:	eb 09                	jmp    800948 <strncmp+0x18>
+		n--, p++, q++;
+  80093f:	83 ea 01             	sub    $0x1,%edx
+  800942:	83 c0 01             	add    $0x1,%eax
+  800945:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800948:	85 d2                	test   %edx,%edx
+  80094a:	74 18                	je     800964 <strncmp+0x34>
+  80094c:	0f b6 18             	movzbl (%eax),%ebx
+  80094f:	84 db                	test   %bl,%bl
+  800951:	74 04                	je     800957 <strncmp+0x27>
+  800953:	3a 19                	cmp    (%ecx),%bl
+  800955:	74 e8                	je     80093f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800957:	0f b6 00             	movzbl (%eax),%eax
+  80095a:	0f b6 11             	movzbl (%ecx),%edx
+  80095d:	29 d0                	sub    %edx,%eax
+}
+  80095f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800962:	c9                   	leave
+  800963:	c3                   	ret
+		return 0;
+  800964:	b8 00 00 00 00       	mov    $0x0,%eax
+  800969:	eb f4                	jmp    80095f <strncmp+0x2f>
+
+0080096b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80096b:	55                   	push   %ebp
+  80096c:	89 e5                	mov    %esp,%ebp
+  80096e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800971:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800975:	eb 03                	jmp    80097a <strchr+0xf>
+  800977:	83 c0 01             	add    $0x1,%eax
+  80097a:	0f b6 10             	movzbl (%eax),%edx
+  80097d:	84 d2                	test   %dl,%dl
+  80097f:	74 06                	je     800987 <strchr+0x1c>
+		if (*s == c)
+  800981:	38 ca                	cmp    %cl,%dl
+  800983:	75 f2                	jne    800977 <strchr+0xc>
+  800985:	eb 05                	jmp    80098c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800987:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80098c:	5d                   	pop    %ebp
+  80098d:	c3                   	ret
+
+0080098e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80098e:	55                   	push   %ebp
+  80098f:	89 e5                	mov    %esp,%ebp
+  800991:	8b 45 08             	mov    0x8(%ebp),%eax
+  800994:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800998:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80099b:	38 ca                	cmp    %cl,%dl
+  80099d:	74 09                	je     8009a8 <strfind+0x1a>
+  80099f:	84 d2                	test   %dl,%dl
+  8009a1:	74 05                	je     8009a8 <strfind+0x1a>
+	for (; *s; s++)
+  8009a3:	83 c0 01             	add    $0x1,%eax
+  8009a6:	eb f0                	jmp    800998 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009a8:	5d                   	pop    %ebp
+  8009a9:	c3                   	ret
+
+008009aa <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009aa:	55                   	push   %ebp
+  8009ab:	89 e5                	mov    %esp,%ebp
+  8009ad:	57                   	push   %edi
+  8009ae:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009b1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009b4:	85 c9                	test   %ecx,%ecx
+  8009b6:	74 20                	je     8009d8 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009b8:	89 f8                	mov    %edi,%eax
+  8009ba:	09 c8                	or     %ecx,%eax
+  8009bc:	a8 03                	test   $0x3,%al
+  8009be:	75 12                	jne    8009d2 <memset+0x28>
+		c &= 0xFF;
+  8009c0:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009c4:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009ca:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009cd:	fc                   	cld
+  8009ce:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009d0:	eb 06                	jmp    8009d8 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009d5:	fc                   	cld
+  8009d6:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009d8:	89 f8                	mov    %edi,%eax
+  8009da:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009dd:	c9                   	leave
+  8009de:	c3                   	ret
+
+008009df <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009df:	55                   	push   %ebp
+  8009e0:	89 e5                	mov    %esp,%ebp
+  8009e2:	57                   	push   %edi
+  8009e3:	56                   	push   %esi
+  8009e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009ea:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009ed:	39 c6                	cmp    %eax,%esi
+  8009ef:	73 32                	jae    800a23 <memmove+0x44>
+  8009f1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009f4:	39 d0                	cmp    %edx,%eax
+  8009f6:	73 2b                	jae    800a23 <memmove+0x44>
+		s += n;
+		d += n;
+  8009f8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009fb:	89 d6                	mov    %edx,%esi
+  8009fd:	09 fe                	or     %edi,%esi
+  8009ff:	09 ce                	or     %ecx,%esi
+  800a01:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a07:	75 0e                	jne    800a17 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a09:	83 ef 04             	sub    $0x4,%edi
+  800a0c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a0f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a12:	fd                   	std
+  800a13:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a15:	eb 09                	jmp    800a20 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a17:	83 ef 01             	sub    $0x1,%edi
+  800a1a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a1d:	fd                   	std
+  800a1e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a20:	fc                   	cld
+  800a21:	eb 1a                	jmp    800a3d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a23:	89 f2                	mov    %esi,%edx
+  800a25:	09 c2                	or     %eax,%edx
+  800a27:	09 ca                	or     %ecx,%edx
+  800a29:	f6 c2 03             	test   $0x3,%dl
+  800a2c:	75 0a                	jne    800a38 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a2e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a31:	89 c7                	mov    %eax,%edi
+  800a33:	fc                   	cld
+  800a34:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a36:	eb 05                	jmp    800a3d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a38:	89 c7                	mov    %eax,%edi
+  800a3a:	fc                   	cld
+  800a3b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a3d:	5e                   	pop    %esi
+  800a3e:	5f                   	pop    %edi
+  800a3f:	5d                   	pop    %ebp
+  800a40:	c3                   	ret
+
+00800a41 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a41:	55                   	push   %ebp
+  800a42:	89 e5                	mov    %esp,%ebp
+  800a44:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a47:	ff 75 10             	push   0x10(%ebp)
+  800a4a:	ff 75 0c             	push   0xc(%ebp)
+  800a4d:	ff 75 08             	push   0x8(%ebp)
+  800a50:	e8 8a ff ff ff       	call   8009df <memmove>
+}
+  800a55:	c9                   	leave
+  800a56:	c3                   	ret
+
+00800a57 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a57:	55                   	push   %ebp
+  800a58:	89 e5                	mov    %esp,%ebp
+  800a5a:	56                   	push   %esi
+  800a5b:	53                   	push   %ebx
+  800a5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a62:	89 c6                	mov    %eax,%esi
+  800a64:	03 75 10             	add    0x10(%ebp),%esi
+  800a67:	eb 06                	jmp    800a6f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a69:	83 c0 01             	add    $0x1,%eax
+  800a6c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a6f:	39 f0                	cmp    %esi,%eax
+  800a71:	74 14                	je     800a87 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a73:	0f b6 08             	movzbl (%eax),%ecx
+  800a76:	0f b6 1a             	movzbl (%edx),%ebx
+  800a79:	38 d9                	cmp    %bl,%cl
+  800a7b:	74 ec                	je     800a69 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a7d:	0f b6 c1             	movzbl %cl,%eax
+  800a80:	0f b6 db             	movzbl %bl,%ebx
+  800a83:	29 d8                	sub    %ebx,%eax
+  800a85:	eb 05                	jmp    800a8c <memcmp+0x35>
+	}
+
+	return 0;
+  800a87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a8c:	5b                   	pop    %ebx
+  800a8d:	5e                   	pop    %esi
+  800a8e:	5d                   	pop    %ebp
+  800a8f:	c3                   	ret
+
+00800a90 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a90:	55                   	push   %ebp
+  800a91:	89 e5                	mov    %esp,%ebp
+  800a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a99:	89 c2                	mov    %eax,%edx
+  800a9b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a9e:	eb 03                	jmp    800aa3 <memfind+0x13>
+  800aa0:	83 c0 01             	add    $0x1,%eax
+  800aa3:	39 d0                	cmp    %edx,%eax
+  800aa5:	73 04                	jae    800aab <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800aa7:	38 08                	cmp    %cl,(%eax)
+  800aa9:	75 f5                	jne    800aa0 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800aab:	5d                   	pop    %ebp
+  800aac:	c3                   	ret
+
+00800aad <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800aad:	55                   	push   %ebp
+  800aae:	89 e5                	mov    %esp,%ebp
+  800ab0:	57                   	push   %edi
+  800ab1:	56                   	push   %esi
+  800ab2:	53                   	push   %ebx
+  800ab3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ab6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ab9:	eb 03                	jmp    800abe <strtol+0x11>
+		s++;
+  800abb:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800abe:	0f b6 02             	movzbl (%edx),%eax
+  800ac1:	3c 20                	cmp    $0x20,%al
+  800ac3:	74 f6                	je     800abb <strtol+0xe>
+  800ac5:	3c 09                	cmp    $0x9,%al
+  800ac7:	74 f2                	je     800abb <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ac9:	3c 2b                	cmp    $0x2b,%al
+  800acb:	74 2a                	je     800af7 <strtol+0x4a>
+	int neg = 0;
+  800acd:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ad2:	3c 2d                	cmp    $0x2d,%al
+  800ad4:	74 2b                	je     800b01 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ad6:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800adc:	75 0f                	jne    800aed <strtol+0x40>
+  800ade:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ae1:	74 28                	je     800b0b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ae3:	85 db                	test   %ebx,%ebx
+  800ae5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800aea:	0f 44 d8             	cmove  %eax,%ebx
+  800aed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800af2:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800af5:	eb 46                	jmp    800b3d <strtol+0x90>
+		s++;
+  800af7:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800afa:	bf 00 00 00 00       	mov    $0x0,%edi
+  800aff:	eb d5                	jmp    800ad6 <strtol+0x29>
+		s++, neg = 1;
+  800b01:	83 c2 01             	add    $0x1,%edx
+  800b04:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b09:	eb cb                	jmp    800ad6 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b0b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b0f:	74 0e                	je     800b1f <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b11:	85 db                	test   %ebx,%ebx
+  800b13:	75 d8                	jne    800aed <strtol+0x40>
+		s++, base = 8;
+  800b15:	83 c2 01             	add    $0x1,%edx
+  800b18:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b1d:	eb ce                	jmp    800aed <strtol+0x40>
+		s += 2, base = 16;
+  800b1f:	83 c2 02             	add    $0x2,%edx
+  800b22:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b27:	eb c4                	jmp    800aed <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b29:	0f be c0             	movsbl %al,%eax
+  800b2c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b2f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b32:	7d 3a                	jge    800b6e <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b34:	83 c2 01             	add    $0x1,%edx
+  800b37:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b3b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b3d:	0f b6 02             	movzbl (%edx),%eax
+  800b40:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b43:	89 f3                	mov    %esi,%ebx
+  800b45:	80 fb 09             	cmp    $0x9,%bl
+  800b48:	76 df                	jbe    800b29 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b4a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b4d:	89 f3                	mov    %esi,%ebx
+  800b4f:	80 fb 19             	cmp    $0x19,%bl
+  800b52:	77 08                	ja     800b5c <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b54:	0f be c0             	movsbl %al,%eax
+  800b57:	83 e8 57             	sub    $0x57,%eax
+  800b5a:	eb d3                	jmp    800b2f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b5c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b5f:	89 f3                	mov    %esi,%ebx
+  800b61:	80 fb 19             	cmp    $0x19,%bl
+  800b64:	77 08                	ja     800b6e <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b66:	0f be c0             	movsbl %al,%eax
+  800b69:	83 e8 37             	sub    $0x37,%eax
+  800b6c:	eb c1                	jmp    800b2f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b6e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b72:	74 05                	je     800b79 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b74:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b77:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b79:	89 c8                	mov    %ecx,%eax
+  800b7b:	f7 d8                	neg    %eax
+  800b7d:	85 ff                	test   %edi,%edi
+  800b7f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b82:	89 c8                	mov    %ecx,%eax
+  800b84:	5b                   	pop    %ebx
+  800b85:	5e                   	pop    %esi
+  800b86:	5f                   	pop    %edi
+  800b87:	5d                   	pop    %ebp
+  800b88:	c3                   	ret
+
+00800b89 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800b89:	55                   	push   %ebp
+  800b8a:	89 e5                	mov    %esp,%ebp
+  800b8c:	57                   	push   %edi
+  800b8d:	56                   	push   %esi
+  800b8e:	53                   	push   %ebx
+  800b8f:	83 ec 0c             	sub    $0xc,%esp
+  800b92:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b95:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b98:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800b9b:	85 ff                	test   %edi,%edi
+  800b9d:	74 16                	je     800bb5 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800b9f:	83 ec 04             	sub    $0x4,%esp
+  800ba2:	56                   	push   %esi
+  800ba3:	6a 00                	push   $0x0
+  800ba5:	53                   	push   %ebx
+  800ba6:	e8 02 ff ff ff       	call   800aad <strtol>
+  800bab:	89 07                	mov    %eax,(%edi)
+  800bad:	83 c4 10             	add    $0x10,%esp
+  800bb0:	eb 03                	jmp    800bb5 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800bb2:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800bb5:	0f b6 03             	movzbl (%ebx),%eax
+  800bb8:	3c 20                	cmp    $0x20,%al
+  800bba:	74 f6                	je     800bb2 <strisl+0x29>
+  800bbc:	3c 09                	cmp    $0x9,%al
+  800bbe:	74 f2                	je     800bb2 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bc0:	3c 2b                	cmp    $0x2b,%al
+  800bc2:	74 23                	je     800be7 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800bc4:	3c 2d                	cmp    $0x2d,%al
+  800bc6:	0f 94 c0             	sete   %al
+  800bc9:	0f b6 c0             	movzbl %al,%eax
+  800bcc:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bce:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800bd4:	75 41                	jne    800c17 <strisl+0x8e>
+  800bd6:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800bd9:	74 11                	je     800bec <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bdb:	85 f6                	test   %esi,%esi
+  800bdd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800be2:	0f 44 f0             	cmove  %eax,%esi
+  800be5:	eb 30                	jmp    800c17 <strisl+0x8e>
+		s++;
+  800be7:	83 c3 01             	add    $0x1,%ebx
+  800bea:	eb e2                	jmp    800bce <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bec:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800bf0:	74 0e                	je     800c00 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800bf2:	85 f6                	test   %esi,%esi
+  800bf4:	75 21                	jne    800c17 <strisl+0x8e>
+		s++, base = 8;
+  800bf6:	83 c3 01             	add    $0x1,%ebx
+  800bf9:	be 08 00 00 00       	mov    $0x8,%esi
+  800bfe:	eb 17                	jmp    800c17 <strisl+0x8e>
+		s += 2, base = 16;
+  800c00:	83 c3 02             	add    $0x2,%ebx
+  800c03:	be 10 00 00 00       	mov    $0x10,%esi
+  800c08:	eb 0d                	jmp    800c17 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c0a:	0f be c0             	movsbl %al,%eax
+  800c0d:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800c10:	39 f0                	cmp    %esi,%eax
+  800c12:	7d 38                	jge    800c4c <strisl+0xc3>
+			return 0;
+		s++;
+  800c14:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800c17:	0f b6 03             	movzbl (%ebx),%eax
+  800c1a:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800c1d:	80 fa 09             	cmp    $0x9,%dl
+  800c20:	76 e8                	jbe    800c0a <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800c22:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800c25:	80 fa 19             	cmp    $0x19,%dl
+  800c28:	77 08                	ja     800c32 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800c2a:	0f be c0             	movsbl %al,%eax
+  800c2d:	83 e8 57             	sub    $0x57,%eax
+  800c30:	eb de                	jmp    800c10 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c32:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800c35:	80 fa 19             	cmp    $0x19,%dl
+  800c38:	77 08                	ja     800c42 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800c3a:	0f be c0             	movsbl %al,%eax
+  800c3d:	83 e8 37             	sub    $0x37,%eax
+  800c40:	eb ce                	jmp    800c10 <strisl+0x87>
+		else if (!*s)
+  800c42:	84 c0                	test   %al,%al
+  800c44:	0f 94 c0             	sete   %al
+  800c47:	0f b6 c0             	movzbl %al,%eax
+  800c4a:	eb 05                	jmp    800c51 <strisl+0xc8>
+			return 0;
+  800c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800c51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c54:	5b                   	pop    %ebx
+  800c55:	5e                   	pop    %esi
+  800c56:	5f                   	pop    %edi
+  800c57:	5d                   	pop    %ebp
+  800c58:	c3                   	ret
+
+00800c59 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800c59:	55                   	push   %ebp
+  800c5a:	89 e5                	mov    %esp,%ebp
+  800c5c:	83 ec 10             	sub    $0x10,%esp
+  800c5f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c62:	89 c8                	mov    %ecx,%eax
+  800c64:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800c69:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800c6c:	eb 0b                	jmp    800c79 <touch_mem+0x20>
+		c = *(char *)page;
+  800c6e:	0f b6 10             	movzbl (%eax),%edx
+  800c71:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c74:	05 00 10 00 00       	add    $0x1000,%eax
+  800c79:	39 c8                	cmp    %ecx,%eax
+  800c7b:	72 f1                	jb     800c6e <touch_mem+0x15>
+}
+  800c7d:	c9                   	leave
+  800c7e:	c3                   	ret
+
+00800c7f <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c7f:	55                   	push   %ebp
+  800c80:	89 e5                	mov    %esp,%ebp
+  800c82:	57                   	push   %edi
+  800c83:	56                   	push   %esi
+  800c84:	53                   	push   %ebx
+	touch_mem(s, len);
+  800c85:	ff 75 0c             	push   0xc(%ebp)
+  800c88:	ff 75 08             	push   0x8(%ebp)
+  800c8b:	e8 c9 ff ff ff       	call   800c59 <touch_mem>
+	asm volatile("int %1\n"
+  800c90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9b:	89 c3                	mov    %eax,%ebx
+  800c9d:	89 c7                	mov    %eax,%edi
+  800c9f:	89 c6                	mov    %eax,%esi
+  800ca1:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ca3:	83 c4 08             	add    $0x8,%esp
+  800ca6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca9:	5b                   	pop    %ebx
+  800caa:	5e                   	pop    %esi
+  800cab:	5f                   	pop    %edi
+  800cac:	5d                   	pop    %ebp
+  800cad:	c3                   	ret
+
+00800cae <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cae:	55                   	push   %ebp
+  800caf:	89 e5                	mov    %esp,%ebp
+  800cb1:	57                   	push   %edi
+  800cb2:	56                   	push   %esi
+  800cb3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cbe:	89 d1                	mov    %edx,%ecx
+  800cc0:	89 d3                	mov    %edx,%ebx
+  800cc2:	89 d7                	mov    %edx,%edi
+  800cc4:	89 d6                	mov    %edx,%esi
+  800cc6:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cc8:	5b                   	pop    %ebx
+  800cc9:	5e                   	pop    %esi
+  800cca:	5f                   	pop    %edi
+  800ccb:	5d                   	pop    %ebp
+  800ccc:	c3                   	ret
+
+00800ccd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	57                   	push   %edi
+  800cd1:	56                   	push   %esi
+  800cd2:	53                   	push   %ebx
+  800cd3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cde:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ce3:	89 cb                	mov    %ecx,%ebx
+  800ce5:	89 cf                	mov    %ecx,%edi
+  800ce7:	89 ce                	mov    %ecx,%esi
+  800ce9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ceb:	85 c0                	test   %eax,%eax
+  800ced:	7f 08                	jg     800cf7 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf2:	5b                   	pop    %ebx
+  800cf3:	5e                   	pop    %esi
+  800cf4:	5f                   	pop    %edi
+  800cf5:	5d                   	pop    %ebp
+  800cf6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf7:	83 ec 0c             	sub    $0xc,%esp
+  800cfa:	50                   	push   %eax
+  800cfb:	6a 03                	push   $0x3
+  800cfd:	68 ab 32 80 00       	push   $0x8032ab
+  800d02:	6a 23                	push   $0x23
+  800d04:	68 c8 32 80 00       	push   $0x8032c8
+  800d09:	e8 89 f4 ff ff       	call   800197 <_panic>
+
+00800d0e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d0e:	55                   	push   %ebp
+  800d0f:	89 e5                	mov    %esp,%ebp
+  800d11:	57                   	push   %edi
+  800d12:	56                   	push   %esi
+  800d13:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d14:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d19:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d1e:	89 d1                	mov    %edx,%ecx
+  800d20:	89 d3                	mov    %edx,%ebx
+  800d22:	89 d7                	mov    %edx,%edi
+  800d24:	89 d6                	mov    %edx,%esi
+  800d26:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d28:	5b                   	pop    %ebx
+  800d29:	5e                   	pop    %esi
+  800d2a:	5f                   	pop    %edi
+  800d2b:	5d                   	pop    %ebp
+  800d2c:	c3                   	ret
+
+00800d2d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	57                   	push   %edi
+  800d31:	56                   	push   %esi
+  800d32:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d33:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d38:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d3d:	89 d1                	mov    %edx,%ecx
+  800d3f:	89 d3                	mov    %edx,%ebx
+  800d41:	89 d7                	mov    %edx,%edi
+  800d43:	89 d6                	mov    %edx,%esi
+  800d45:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d47:	5b                   	pop    %ebx
+  800d48:	5e                   	pop    %esi
+  800d49:	5f                   	pop    %edi
+  800d4a:	5d                   	pop    %ebp
+  800d4b:	c3                   	ret
+
+00800d4c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d4c:	55                   	push   %ebp
+  800d4d:	89 e5                	mov    %esp,%ebp
+  800d4f:	57                   	push   %edi
+  800d50:	56                   	push   %esi
+  800d51:	53                   	push   %ebx
+  800d52:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d55:	be 00 00 00 00       	mov    $0x0,%esi
+  800d5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d60:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d65:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d68:	89 f7                	mov    %esi,%edi
+  800d6a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d6c:	85 c0                	test   %eax,%eax
+  800d6e:	7f 08                	jg     800d78 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d73:	5b                   	pop    %ebx
+  800d74:	5e                   	pop    %esi
+  800d75:	5f                   	pop    %edi
+  800d76:	5d                   	pop    %ebp
+  800d77:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d78:	83 ec 0c             	sub    $0xc,%esp
+  800d7b:	50                   	push   %eax
+  800d7c:	6a 04                	push   $0x4
+  800d7e:	68 ab 32 80 00       	push   $0x8032ab
+  800d83:	6a 23                	push   $0x23
+  800d85:	68 c8 32 80 00       	push   $0x8032c8
+  800d8a:	e8 08 f4 ff ff       	call   800197 <_panic>
+
+00800d8f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d8f:	55                   	push   %ebp
+  800d90:	89 e5                	mov    %esp,%ebp
+  800d92:	57                   	push   %edi
+  800d93:	56                   	push   %esi
+  800d94:	53                   	push   %ebx
+  800d95:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800da3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800da9:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dae:	85 c0                	test   %eax,%eax
+  800db0:	7f 08                	jg     800dba <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800db2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db5:	5b                   	pop    %ebx
+  800db6:	5e                   	pop    %esi
+  800db7:	5f                   	pop    %edi
+  800db8:	5d                   	pop    %ebp
+  800db9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dba:	83 ec 0c             	sub    $0xc,%esp
+  800dbd:	50                   	push   %eax
+  800dbe:	6a 05                	push   $0x5
+  800dc0:	68 ab 32 80 00       	push   $0x8032ab
+  800dc5:	6a 23                	push   $0x23
+  800dc7:	68 c8 32 80 00       	push   $0x8032c8
+  800dcc:	e8 c6 f3 ff ff       	call   800197 <_panic>
+
+00800dd1 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dd1:	55                   	push   %ebp
+  800dd2:	89 e5                	mov    %esp,%ebp
+  800dd4:	57                   	push   %edi
+  800dd5:	56                   	push   %esi
+  800dd6:	53                   	push   %ebx
+  800dd7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ddf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dea:	89 df                	mov    %ebx,%edi
+  800dec:	89 de                	mov    %ebx,%esi
+  800dee:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800df0:	85 c0                	test   %eax,%eax
+  800df2:	7f 08                	jg     800dfc <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800df4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df7:	5b                   	pop    %ebx
+  800df8:	5e                   	pop    %esi
+  800df9:	5f                   	pop    %edi
+  800dfa:	5d                   	pop    %ebp
+  800dfb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dfc:	83 ec 0c             	sub    $0xc,%esp
+  800dff:	50                   	push   %eax
+  800e00:	6a 06                	push   $0x6
+  800e02:	68 ab 32 80 00       	push   $0x8032ab
+  800e07:	6a 23                	push   $0x23
+  800e09:	68 c8 32 80 00       	push   $0x8032c8
+  800e0e:	e8 84 f3 ff ff       	call   800197 <_panic>
+
+00800e13 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	57                   	push   %edi
+  800e17:	56                   	push   %esi
+  800e18:	53                   	push   %ebx
+  800e19:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e27:	b8 18 00 00 00       	mov    $0x18,%eax
+  800e2c:	89 df                	mov    %ebx,%edi
+  800e2e:	89 de                	mov    %ebx,%esi
+  800e30:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e32:	85 c0                	test   %eax,%eax
+  800e34:	7f 08                	jg     800e3e <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e39:	5b                   	pop    %ebx
+  800e3a:	5e                   	pop    %esi
+  800e3b:	5f                   	pop    %edi
+  800e3c:	5d                   	pop    %ebp
+  800e3d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e3e:	83 ec 0c             	sub    $0xc,%esp
+  800e41:	50                   	push   %eax
+  800e42:	6a 18                	push   $0x18
+  800e44:	68 ab 32 80 00       	push   $0x8032ab
+  800e49:	6a 23                	push   $0x23
+  800e4b:	68 c8 32 80 00       	push   $0x8032c8
+  800e50:	e8 42 f3 ff ff       	call   800197 <_panic>
+
+00800e55 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	57                   	push   %edi
+  800e59:	56                   	push   %esi
+  800e5a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e5b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e66:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e6e:	89 f7                	mov    %esi,%edi
+  800e70:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800e72:	5b                   	pop    %ebx
+  800e73:	5e                   	pop    %esi
+  800e74:	5f                   	pop    %edi
+  800e75:	5d                   	pop    %ebp
+  800e76:	c3                   	ret
+
+00800e77 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800e77:	55                   	push   %ebp
+  800e78:	89 e5                	mov    %esp,%ebp
+  800e7a:	57                   	push   %edi
+  800e7b:	56                   	push   %esi
+  800e7c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e83:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e88:	be 00 00 00 00       	mov    $0x0,%esi
+  800e8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e90:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e93:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e95:	5b                   	pop    %ebx
+  800e96:	5e                   	pop    %esi
+  800e97:	5f                   	pop    %edi
+  800e98:	5d                   	pop    %ebp
+  800e99:	c3                   	ret
+
+00800e9a <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e9a:	55                   	push   %ebp
+  800e9b:	89 e5                	mov    %esp,%ebp
+  800e9d:	57                   	push   %edi
+  800e9e:	56                   	push   %esi
+  800e9f:	53                   	push   %ebx
+  800ea0:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800ea3:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800ea6:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800eac:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800eaf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb5:	b8 10 00 00 00       	mov    $0x10,%eax
+  800eba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ebd:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ec0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec2:	85 c0                	test   %eax,%eax
+  800ec4:	7f 08                	jg     800ece <sys_page_map_range+0x34>
+}
+  800ec6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec9:	5b                   	pop    %ebx
+  800eca:	5e                   	pop    %esi
+  800ecb:	5f                   	pop    %edi
+  800ecc:	5d                   	pop    %ebp
+  800ecd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ece:	83 ec 0c             	sub    $0xc,%esp
+  800ed1:	50                   	push   %eax
+  800ed2:	6a 10                	push   $0x10
+  800ed4:	68 ab 32 80 00       	push   $0x8032ab
+  800ed9:	6a 23                	push   $0x23
+  800edb:	68 c8 32 80 00       	push   $0x8032c8
+  800ee0:	e8 b2 f2 ff ff       	call   800197 <_panic>
+
+00800ee5 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800ee5:	55                   	push   %ebp
+  800ee6:	89 e5                	mov    %esp,%ebp
+  800ee8:	57                   	push   %edi
+  800ee9:	56                   	push   %esi
+  800eea:	53                   	push   %ebx
+  800eeb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eee:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef9:	b8 11 00 00 00       	mov    $0x11,%eax
+  800efe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f01:	89 f7                	mov    %esi,%edi
+  800f03:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f05:	85 c0                	test   %eax,%eax
+  800f07:	7f 08                	jg     800f11 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0c:	5b                   	pop    %ebx
+  800f0d:	5e                   	pop    %esi
+  800f0e:	5f                   	pop    %edi
+  800f0f:	5d                   	pop    %ebp
+  800f10:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f11:	83 ec 0c             	sub    $0xc,%esp
+  800f14:	50                   	push   %eax
+  800f15:	6a 11                	push   $0x11
+  800f17:	68 ab 32 80 00       	push   $0x8032ab
+  800f1c:	6a 23                	push   $0x23
+  800f1e:	68 c8 32 80 00       	push   $0x8032c8
+  800f23:	e8 6f f2 ff ff       	call   800197 <_panic>
+
+00800f28 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800f28:	55                   	push   %ebp
+  800f29:	89 e5                	mov    %esp,%ebp
+  800f2b:	57                   	push   %edi
+  800f2c:	56                   	push   %esi
+  800f2d:	53                   	push   %ebx
+  800f2e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f31:	be 00 00 00 00       	mov    $0x0,%esi
+  800f36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800f41:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f44:	89 f7                	mov    %esi,%edi
+  800f46:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f48:	85 c0                	test   %eax,%eax
+  800f4a:	7f 08                	jg     800f54 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4f:	5b                   	pop    %ebx
+  800f50:	5e                   	pop    %esi
+  800f51:	5f                   	pop    %edi
+  800f52:	5d                   	pop    %ebp
+  800f53:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f54:	83 ec 0c             	sub    $0xc,%esp
+  800f57:	50                   	push   %eax
+  800f58:	6a 1b                	push   $0x1b
+  800f5a:	68 ab 32 80 00       	push   $0x8032ab
+  800f5f:	6a 23                	push   $0x23
+  800f61:	68 c8 32 80 00       	push   $0x8032c8
+  800f66:	e8 2c f2 ff ff       	call   800197 <_panic>
+
+00800f6b <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800f6b:	55                   	push   %ebp
+  800f6c:	89 e5                	mov    %esp,%ebp
+  800f6e:	57                   	push   %edi
+  800f6f:	56                   	push   %esi
+  800f70:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f71:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f76:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f7b:	89 d1                	mov    %edx,%ecx
+  800f7d:	89 d3                	mov    %edx,%ebx
+  800f7f:	89 d7                	mov    %edx,%edi
+  800f81:	89 d6                	mov    %edx,%esi
+  800f83:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f85:	5b                   	pop    %ebx
+  800f86:	5e                   	pop    %esi
+  800f87:	5f                   	pop    %edi
+  800f88:	5d                   	pop    %ebp
+  800f89:	c3                   	ret
+
+00800f8a <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f8a:	55                   	push   %ebp
+  800f8b:	89 e5                	mov    %esp,%ebp
+  800f8d:	57                   	push   %edi
+  800f8e:	56                   	push   %esi
+  800f8f:	53                   	push   %ebx
+  800f90:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f93:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fa3:	89 df                	mov    %ebx,%edi
+  800fa5:	89 de                	mov    %ebx,%esi
+  800fa7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa9:	85 c0                	test   %eax,%eax
+  800fab:	7f 08                	jg     800fb5 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800fad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb0:	5b                   	pop    %ebx
+  800fb1:	5e                   	pop    %esi
+  800fb2:	5f                   	pop    %edi
+  800fb3:	5d                   	pop    %ebp
+  800fb4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb5:	83 ec 0c             	sub    $0xc,%esp
+  800fb8:	50                   	push   %eax
+  800fb9:	6a 08                	push   $0x8
+  800fbb:	68 ab 32 80 00       	push   $0x8032ab
+  800fc0:	6a 23                	push   $0x23
+  800fc2:	68 c8 32 80 00       	push   $0x8032c8
+  800fc7:	e8 cb f1 ff ff       	call   800197 <_panic>
+
+00800fcc <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fcc:	55                   	push   %ebp
+  800fcd:	89 e5                	mov    %esp,%ebp
+  800fcf:	57                   	push   %edi
+  800fd0:	56                   	push   %esi
+  800fd1:	53                   	push   %ebx
+  800fd2:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800fd5:	6a 44                	push   $0x44
+  800fd7:	ff 75 0c             	push   0xc(%ebp)
+  800fda:	e8 7a fc ff ff       	call   800c59 <touch_mem>
+	asm volatile("int %1\n"
+  800fdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe7:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fef:	89 df                	mov    %ebx,%edi
+  800ff1:	89 de                	mov    %ebx,%esi
+  800ff3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff5:	83 c4 08             	add    $0x8,%esp
+  800ff8:	85 c0                	test   %eax,%eax
+  800ffa:	7f 08                	jg     801004 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ffc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fff:	5b                   	pop    %ebx
+  801000:	5e                   	pop    %esi
+  801001:	5f                   	pop    %edi
+  801002:	5d                   	pop    %ebp
+  801003:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801004:	83 ec 0c             	sub    $0xc,%esp
+  801007:	50                   	push   %eax
+  801008:	6a 09                	push   $0x9
+  80100a:	68 ab 32 80 00       	push   $0x8032ab
+  80100f:	6a 23                	push   $0x23
+  801011:	68 c8 32 80 00       	push   $0x8032c8
+  801016:	e8 7c f1 ff ff       	call   800197 <_panic>
+
+0080101b <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	57                   	push   %edi
+  80101f:	56                   	push   %esi
+  801020:	53                   	push   %ebx
+  801021:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801024:	be 00 00 00 00       	mov    $0x0,%esi
+  801029:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801034:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801037:	89 f7                	mov    %esi,%edi
+  801039:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80103b:	85 c0                	test   %eax,%eax
+  80103d:	7f 08                	jg     801047 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  80103f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801042:	5b                   	pop    %ebx
+  801043:	5e                   	pop    %esi
+  801044:	5f                   	pop    %edi
+  801045:	5d                   	pop    %ebp
+  801046:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801047:	83 ec 0c             	sub    $0xc,%esp
+  80104a:	50                   	push   %eax
+  80104b:	6a 1a                	push   $0x1a
+  80104d:	68 ab 32 80 00       	push   $0x8032ab
+  801052:	6a 23                	push   $0x23
+  801054:	68 c8 32 80 00       	push   $0x8032c8
+  801059:	e8 39 f1 ff ff       	call   800197 <_panic>
+
+0080105e <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	57                   	push   %edi
+  801062:	56                   	push   %esi
+  801063:	53                   	push   %ebx
+  801064:	83 ec 0c             	sub    $0xc,%esp
+  801067:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  80106a:	89 d8                	mov    %ebx,%eax
+  80106c:	c1 e0 05             	shl    $0x5,%eax
+  80106f:	50                   	push   %eax
+  801070:	ff 75 0c             	push   0xc(%ebp)
+  801073:	e8 e1 fb ff ff       	call   800c59 <touch_mem>
+	asm volatile("int %1\n"
+  801078:	be 00 00 00 00       	mov    $0x0,%esi
+  80107d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801080:	b8 13 00 00 00       	mov    $0x13,%eax
+  801085:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801088:	89 f7                	mov    %esi,%edi
+  80108a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80108c:	83 c4 08             	add    $0x8,%esp
+  80108f:	85 c0                	test   %eax,%eax
+  801091:	7f 08                	jg     80109b <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  801093:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801096:	5b                   	pop    %ebx
+  801097:	5e                   	pop    %esi
+  801098:	5f                   	pop    %edi
+  801099:	5d                   	pop    %ebp
+  80109a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109b:	83 ec 0c             	sub    $0xc,%esp
+  80109e:	50                   	push   %eax
+  80109f:	6a 13                	push   $0x13
+  8010a1:	68 ab 32 80 00       	push   $0x8032ab
+  8010a6:	6a 23                	push   $0x23
+  8010a8:	68 c8 32 80 00       	push   $0x8032c8
+  8010ad:	e8 e5 f0 ff ff       	call   800197 <_panic>
+
+008010b2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010b2:	55                   	push   %ebp
+  8010b3:	89 e5                	mov    %esp,%ebp
+  8010b5:	57                   	push   %edi
+  8010b6:	56                   	push   %esi
+  8010b7:	53                   	push   %ebx
+  8010b8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010cb:	89 df                	mov    %ebx,%edi
+  8010cd:	89 de                	mov    %ebx,%esi
+  8010cf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010d1:	85 c0                	test   %eax,%eax
+  8010d3:	7f 08                	jg     8010dd <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d8:	5b                   	pop    %ebx
+  8010d9:	5e                   	pop    %esi
+  8010da:	5f                   	pop    %edi
+  8010db:	5d                   	pop    %ebp
+  8010dc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010dd:	83 ec 0c             	sub    $0xc,%esp
+  8010e0:	50                   	push   %eax
+  8010e1:	6a 0a                	push   $0xa
+  8010e3:	68 ab 32 80 00       	push   $0x8032ab
+  8010e8:	6a 23                	push   $0x23
+  8010ea:	68 c8 32 80 00       	push   $0x8032c8
+  8010ef:	e8 a3 f0 ff ff       	call   800197 <_panic>
+
+008010f4 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010f4:	55                   	push   %ebp
+  8010f5:	89 e5                	mov    %esp,%ebp
+  8010f7:	57                   	push   %edi
+  8010f8:	56                   	push   %esi
+  8010f9:	53                   	push   %ebx
+  8010fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  8010fd:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801103:	76 1d                	jbe    801122 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  801105:	8b 55 08             	mov    0x8(%ebp),%edx
+  801108:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801110:	be 01 00 00 00       	mov    $0x1,%esi
+  801115:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801118:	cd 30                	int    $0x30
+}
+  80111a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111d:	5b                   	pop    %ebx
+  80111e:	5e                   	pop    %esi
+  80111f:	5f                   	pop    %edi
+  801120:	5d                   	pop    %ebp
+  801121:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801122:	68 00 10 00 00       	push   $0x1000
+  801127:	53                   	push   %ebx
+  801128:	e8 2c fb ff ff       	call   800c59 <touch_mem>
+  80112d:	83 c4 08             	add    $0x8,%esp
+  801130:	eb d3                	jmp    801105 <sys_ipc_send+0x11>
+
+00801132 <sys_ipc_send_pages>:
+{
+  801132:	55                   	push   %ebp
+  801133:	89 e5                	mov    %esp,%ebp
+  801135:	57                   	push   %edi
+  801136:	56                   	push   %esi
+  801137:	53                   	push   %ebx
+  801138:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80113b:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  80113e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801144:	76 18                	jbe    80115e <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  801146:	8b 55 08             	mov    0x8(%ebp),%edx
+  801149:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801151:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801154:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  801156:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801159:	5b                   	pop    %ebx
+  80115a:	5e                   	pop    %esi
+  80115b:	5f                   	pop    %edi
+  80115c:	5d                   	pop    %ebp
+  80115d:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80115e:	89 f0                	mov    %esi,%eax
+  801160:	c1 e0 0c             	shl    $0xc,%eax
+  801163:	50                   	push   %eax
+  801164:	53                   	push   %ebx
+  801165:	e8 ef fa ff ff       	call   800c59 <touch_mem>
+  80116a:	83 c4 08             	add    $0x8,%esp
+  80116d:	eb d7                	jmp    801146 <sys_ipc_send_pages+0x14>
+
+0080116f <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  80116f:	55                   	push   %ebp
+  801170:	89 e5                	mov    %esp,%ebp
+  801172:	57                   	push   %edi
+  801173:	56                   	push   %esi
+  801174:	53                   	push   %ebx
+  801175:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801178:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801180:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801183:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801188:	89 df                	mov    %ebx,%edi
+  80118a:	89 de                	mov    %ebx,%esi
+  80118c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80118e:	85 c0                	test   %eax,%eax
+  801190:	7f 08                	jg     80119a <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801192:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80119a:	83 ec 0c             	sub    $0xc,%esp
+  80119d:	50                   	push   %eax
+  80119e:	6a 0d                	push   $0xd
+  8011a0:	68 ab 32 80 00       	push   $0x8032ab
+  8011a5:	6a 23                	push   $0x23
+  8011a7:	68 c8 32 80 00       	push   $0x8032c8
+  8011ac:	e8 e6 ef ff ff       	call   800197 <_panic>
+
+008011b1 <sys_ipc_recv>:
+{
+  8011b1:	55                   	push   %ebp
+  8011b2:	89 e5                	mov    %esp,%ebp
+  8011b4:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8011b7:	6a 01                	push   $0x1
+  8011b9:	ff 75 08             	push   0x8(%ebp)
+  8011bc:	e8 ae ff ff ff       	call   80116f <sys_ipc_recv_pages>
+}
+  8011c1:	c9                   	leave
+  8011c2:	c3                   	ret
+
+008011c3 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8011c3:	55                   	push   %ebp
+  8011c4:	89 e5                	mov    %esp,%ebp
+  8011c6:	57                   	push   %edi
+  8011c7:	56                   	push   %esi
+  8011c8:	53                   	push   %ebx
+  8011c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011cc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011cf:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  8011d2:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011d8:	77 04                	ja     8011de <sys_ipc_call+0x1b>
+  8011da:	85 f6                	test   %esi,%esi
+  8011dc:	75 15                	jne    8011f3 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8011de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e4:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011e9:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8011eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ee:	5b                   	pop    %ebx
+  8011ef:	5e                   	pop    %esi
+  8011f0:	5f                   	pop    %edi
+  8011f1:	5d                   	pop    %ebp
+  8011f2:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8011f3:	89 f8                	mov    %edi,%eax
+  8011f5:	c1 e0 0c             	shl    $0xc,%eax
+  8011f8:	50                   	push   %eax
+  8011f9:	53                   	push   %ebx
+  8011fa:	e8 5a fa ff ff       	call   800c59 <touch_mem>
+  8011ff:	83 c4 08             	add    $0x8,%esp
+  801202:	eb da                	jmp    8011de <sys_ipc_call+0x1b>
+
+00801204 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801204:	55                   	push   %ebp
+  801205:	89 e5                	mov    %esp,%ebp
+  801207:	57                   	push   %edi
+  801208:	56                   	push   %esi
+  801209:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80120a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801210:	b8 15 00 00 00       	mov    $0x15,%eax
+  801215:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801218:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80121b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80121e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801220:	5b                   	pop    %ebx
+  801221:	5e                   	pop    %esi
+  801222:	5f                   	pop    %edi
+  801223:	5d                   	pop    %ebp
+  801224:	c3                   	ret
+
+00801225 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  801225:	55                   	push   %ebp
+  801226:	89 e5                	mov    %esp,%ebp
+  801228:	57                   	push   %edi
+  801229:	56                   	push   %esi
+  80122a:	53                   	push   %ebx
+  80122b:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  80122e:	6a 04                	push   $0x4
+  801230:	ff 75 08             	push   0x8(%ebp)
+  801233:	e8 21 fa ff ff       	call   800c59 <touch_mem>
+	asm volatile("int %1\n"
+  801238:	be 00 00 00 00       	mov    $0x0,%esi
+  80123d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801240:	b8 16 00 00 00       	mov    $0x16,%eax
+  801245:	8b 55 08             	mov    0x8(%ebp),%edx
+  801248:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80124b:	89 f7                	mov    %esi,%edi
+  80124d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80124f:	83 c4 08             	add    $0x8,%esp
+  801252:	85 c0                	test   %eax,%eax
+  801254:	7f 08                	jg     80125e <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  801256:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801259:	5b                   	pop    %ebx
+  80125a:	5e                   	pop    %esi
+  80125b:	5f                   	pop    %edi
+  80125c:	5d                   	pop    %ebp
+  80125d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80125e:	83 ec 0c             	sub    $0xc,%esp
+  801261:	50                   	push   %eax
+  801262:	6a 16                	push   $0x16
+  801264:	68 ab 32 80 00       	push   $0x8032ab
+  801269:	6a 23                	push   $0x23
+  80126b:	68 c8 32 80 00       	push   $0x8032c8
+  801270:	e8 22 ef ff ff       	call   800197 <_panic>
+
+00801275 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801275:	55                   	push   %ebp
+  801276:	89 e5                	mov    %esp,%ebp
+  801278:	57                   	push   %edi
+  801279:	56                   	push   %esi
+  80127a:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  80127b:	6a 04                	push   $0x4
+  80127d:	ff 75 08             	push   0x8(%ebp)
+  801280:	e8 d4 f9 ff ff       	call   800c59 <touch_mem>
+	asm volatile("int %1\n"
+  801285:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128d:	b8 17 00 00 00       	mov    $0x17,%eax
+  801292:	8b 55 08             	mov    0x8(%ebp),%edx
+  801295:	89 df                	mov    %ebx,%edi
+  801297:	89 de                	mov    %ebx,%esi
+  801299:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80129b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129e:	5b                   	pop    %ebx
+  80129f:	5e                   	pop    %esi
+  8012a0:	5f                   	pop    %edi
+  8012a1:	5d                   	pop    %ebp
+  8012a2:	c3                   	ret
+
+008012a3 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8012a3:	55                   	push   %ebp
+  8012a4:	89 e5                	mov    %esp,%ebp
+  8012a6:	57                   	push   %edi
+  8012a7:	56                   	push   %esi
+  8012a8:	53                   	push   %ebx
+  8012a9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012b9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012be:	89 df                	mov    %ebx,%edi
+  8012c0:	89 de                	mov    %ebx,%esi
+  8012c2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012c4:	85 c0                	test   %eax,%eax
+  8012c6:	7f 08                	jg     8012d0 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  8012c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012cb:	5b                   	pop    %ebx
+  8012cc:	5e                   	pop    %esi
+  8012cd:	5f                   	pop    %edi
+  8012ce:	5d                   	pop    %ebp
+  8012cf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012d0:	83 ec 0c             	sub    $0xc,%esp
+  8012d3:	50                   	push   %eax
+  8012d4:	6a 0e                	push   $0xe
+  8012d6:	68 ab 32 80 00       	push   $0x8032ab
+  8012db:	6a 23                	push   $0x23
+  8012dd:	68 c8 32 80 00       	push   $0x8032c8
+  8012e2:	e8 b0 ee ff ff       	call   800197 <_panic>
+
+008012e7 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8012e7:	55                   	push   %ebp
+  8012e8:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012ed:	05 00 00 00 30       	add    $0x30000000,%eax
+  8012f2:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012f5:	5d                   	pop    %ebp
+  8012f6:	c3                   	ret
+
+008012f7 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012f7:	55                   	push   %ebp
+  8012f8:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012fd:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801302:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801307:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80130c:	5d                   	pop    %ebp
+  80130d:	c3                   	ret
+
+0080130e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80130e:	55                   	push   %ebp
+  80130f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801311:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801316:	a8 01                	test   $0x1,%al
+  801318:	74 3c                	je     801356 <fd_alloc+0x48>
+  80131a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80131f:	89 c2                	mov    %eax,%edx
+  801321:	c1 ea 0c             	shr    $0xc,%edx
+  801324:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80132b:	89 c1                	mov    %eax,%ecx
+  80132d:	05 00 10 00 00       	add    $0x1000,%eax
+  801332:	f6 c2 01             	test   $0x1,%dl
+  801335:	74 13                	je     80134a <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801337:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80133c:	75 e1                	jne    80131f <fd_alloc+0x11>
+  80133e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801343:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801348:	eb 05                	jmp    80134f <fd_alloc+0x41>
+			return 0;
+  80134a:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  80134f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801352:	89 0a                	mov    %ecx,(%edx)
+}
+  801354:	5d                   	pop    %ebp
+  801355:	c3                   	ret
+  801356:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  80135b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801360:	eb ed                	jmp    80134f <fd_alloc+0x41>
+
+00801362 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801362:	55                   	push   %ebp
+  801363:	89 e5                	mov    %esp,%ebp
+  801365:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801368:	83 f8 1f             	cmp    $0x1f,%eax
+  80136b:	77 30                	ja     80139d <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80136d:	c1 e0 0c             	shl    $0xc,%eax
+  801370:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801375:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80137b:	f6 c2 01             	test   $0x1,%dl
+  80137e:	74 24                	je     8013a4 <fd_lookup+0x42>
+  801380:	89 c2                	mov    %eax,%edx
+  801382:	c1 ea 0c             	shr    $0xc,%edx
+  801385:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80138c:	f6 c2 01             	test   $0x1,%dl
+  80138f:	74 1a                	je     8013ab <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801391:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801394:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801396:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80139b:	5d                   	pop    %ebp
+  80139c:	c3                   	ret
+		return -E_INVAL;
+  80139d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013a2:	eb f7                	jmp    80139b <fd_lookup+0x39>
+		return -E_INVAL;
+  8013a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013a9:	eb f0                	jmp    80139b <fd_lookup+0x39>
+  8013ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013b0:	eb e9                	jmp    80139b <fd_lookup+0x39>
+
+008013b2 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013b2:	55                   	push   %ebp
+  8013b3:	89 e5                	mov    %esp,%ebp
+  8013b5:	53                   	push   %ebx
+  8013b6:	83 ec 04             	sub    $0x4,%esp
+  8013b9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8013bc:	b8 54 33 80 00       	mov    $0x803354,%eax
+  8013c1:	8b 18                	mov    (%eax),%ebx
+  8013c3:	85 db                	test   %ebx,%ebx
+  8013c5:	74 0e                	je     8013d5 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  8013c7:	83 c0 04             	add    $0x4,%eax
+  8013ca:	39 13                	cmp    %edx,(%ebx)
+  8013cc:	75 f3                	jne    8013c1 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  8013ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d3:	eb 1f                	jmp    8013f4 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013d5:	a1 08 50 80 00       	mov    0x805008,%eax
+  8013da:	8b 40 48             	mov    0x48(%eax),%eax
+  8013dd:	83 ec 04             	sub    $0x4,%esp
+  8013e0:	52                   	push   %edx
+  8013e1:	50                   	push   %eax
+  8013e2:	68 d8 32 80 00       	push   $0x8032d8
+  8013e7:	e8 86 ee ff ff       	call   800272 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8013ec:	83 c4 10             	add    $0x10,%esp
+  8013ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8013f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013f7:	89 1a                	mov    %ebx,(%edx)
+}
+  8013f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013fc:	c9                   	leave
+  8013fd:	c3                   	ret
+
+008013fe <fd_close>:
+{
+  8013fe:	55                   	push   %ebp
+  8013ff:	89 e5                	mov    %esp,%ebp
+  801401:	57                   	push   %edi
+  801402:	56                   	push   %esi
+  801403:	53                   	push   %ebx
+  801404:	83 ec 24             	sub    $0x24,%esp
+  801407:	8b 75 08             	mov    0x8(%ebp),%esi
+  80140a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80140d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801410:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801411:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801417:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80141a:	50                   	push   %eax
+  80141b:	e8 42 ff ff ff       	call   801362 <fd_lookup>
+  801420:	89 c3                	mov    %eax,%ebx
+  801422:	83 c4 10             	add    $0x10,%esp
+  801425:	85 c0                	test   %eax,%eax
+  801427:	78 05                	js     80142e <fd_close+0x30>
+	    || fd != fd2)
+  801429:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80142c:	74 16                	je     801444 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80142e:	89 f8                	mov    %edi,%eax
+  801430:	84 c0                	test   %al,%al
+  801432:	b8 00 00 00 00       	mov    $0x0,%eax
+  801437:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80143a:	89 d8                	mov    %ebx,%eax
+  80143c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80143f:	5b                   	pop    %ebx
+  801440:	5e                   	pop    %esi
+  801441:	5f                   	pop    %edi
+  801442:	5d                   	pop    %ebp
+  801443:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801444:	83 ec 08             	sub    $0x8,%esp
+  801447:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80144a:	50                   	push   %eax
+  80144b:	ff 36                	push   (%esi)
+  80144d:	e8 60 ff ff ff       	call   8013b2 <dev_lookup>
+  801452:	89 c3                	mov    %eax,%ebx
+  801454:	83 c4 10             	add    $0x10,%esp
+  801457:	85 c0                	test   %eax,%eax
+  801459:	78 1a                	js     801475 <fd_close+0x77>
+		if (dev->dev_close)
+  80145b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80145e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801461:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801466:	85 c0                	test   %eax,%eax
+  801468:	74 0b                	je     801475 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80146a:	83 ec 0c             	sub    $0xc,%esp
+  80146d:	56                   	push   %esi
+  80146e:	ff d0                	call   *%eax
+  801470:	89 c3                	mov    %eax,%ebx
+  801472:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801475:	83 ec 08             	sub    $0x8,%esp
+  801478:	56                   	push   %esi
+  801479:	6a 00                	push   $0x0
+  80147b:	e8 51 f9 ff ff       	call   800dd1 <sys_page_unmap>
+	return r;
+  801480:	83 c4 10             	add    $0x10,%esp
+  801483:	eb b5                	jmp    80143a <fd_close+0x3c>
+
+00801485 <close>:
+
+int
+close(int fdnum)
+{
+  801485:	55                   	push   %ebp
+  801486:	89 e5                	mov    %esp,%ebp
+  801488:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80148b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80148e:	50                   	push   %eax
+  80148f:	ff 75 08             	push   0x8(%ebp)
+  801492:	e8 cb fe ff ff       	call   801362 <fd_lookup>
+  801497:	83 c4 10             	add    $0x10,%esp
+  80149a:	85 c0                	test   %eax,%eax
+  80149c:	79 02                	jns    8014a0 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80149e:	c9                   	leave
+  80149f:	c3                   	ret
+		return fd_close(fd, 1);
+  8014a0:	83 ec 08             	sub    $0x8,%esp
+  8014a3:	6a 01                	push   $0x1
+  8014a5:	ff 75 f4             	push   -0xc(%ebp)
+  8014a8:	e8 51 ff ff ff       	call   8013fe <fd_close>
+  8014ad:	83 c4 10             	add    $0x10,%esp
+  8014b0:	eb ec                	jmp    80149e <close+0x19>
+
+008014b2 <close_all>:
+
+void
+close_all(void)
+{
+  8014b2:	55                   	push   %ebp
+  8014b3:	89 e5                	mov    %esp,%ebp
+  8014b5:	53                   	push   %ebx
+  8014b6:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8014b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8014be:	83 ec 0c             	sub    $0xc,%esp
+  8014c1:	53                   	push   %ebx
+  8014c2:	e8 be ff ff ff       	call   801485 <close>
+	for (i = 0; i < MAXFD; i++)
+  8014c7:	83 c3 01             	add    $0x1,%ebx
+  8014ca:	83 c4 10             	add    $0x10,%esp
+  8014cd:	83 fb 20             	cmp    $0x20,%ebx
+  8014d0:	75 ec                	jne    8014be <close_all+0xc>
+}
+  8014d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014d5:	c9                   	leave
+  8014d6:	c3                   	ret
+
+008014d7 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014d7:	55                   	push   %ebp
+  8014d8:	89 e5                	mov    %esp,%ebp
+  8014da:	57                   	push   %edi
+  8014db:	56                   	push   %esi
+  8014dc:	53                   	push   %ebx
+  8014dd:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8014e0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014e3:	50                   	push   %eax
+  8014e4:	ff 75 08             	push   0x8(%ebp)
+  8014e7:	e8 76 fe ff ff       	call   801362 <fd_lookup>
+  8014ec:	89 c3                	mov    %eax,%ebx
+  8014ee:	83 c4 10             	add    $0x10,%esp
+  8014f1:	85 c0                	test   %eax,%eax
+  8014f3:	78 7f                	js     801574 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8014f5:	83 ec 0c             	sub    $0xc,%esp
+  8014f8:	ff 75 0c             	push   0xc(%ebp)
+  8014fb:	e8 85 ff ff ff       	call   801485 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801500:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801503:	c1 e6 0c             	shl    $0xc,%esi
+  801506:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80150c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80150f:	89 3c 24             	mov    %edi,(%esp)
+  801512:	e8 e0 fd ff ff       	call   8012f7 <fd2data>
+  801517:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801519:	89 34 24             	mov    %esi,(%esp)
+  80151c:	e8 d6 fd ff ff       	call   8012f7 <fd2data>
+  801521:	83 c4 10             	add    $0x10,%esp
+  801524:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801527:	89 d8                	mov    %ebx,%eax
+  801529:	c1 e8 16             	shr    $0x16,%eax
+  80152c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801533:	a8 01                	test   $0x1,%al
+  801535:	74 11                	je     801548 <dup+0x71>
+  801537:	89 d8                	mov    %ebx,%eax
+  801539:	c1 e8 0c             	shr    $0xc,%eax
+  80153c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801543:	f6 c2 01             	test   $0x1,%dl
+  801546:	75 36                	jne    80157e <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801548:	89 f8                	mov    %edi,%eax
+  80154a:	c1 e8 0c             	shr    $0xc,%eax
+  80154d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801554:	83 ec 0c             	sub    $0xc,%esp
+  801557:	25 07 0e 00 00       	and    $0xe07,%eax
+  80155c:	50                   	push   %eax
+  80155d:	56                   	push   %esi
+  80155e:	6a 00                	push   $0x0
+  801560:	57                   	push   %edi
+  801561:	6a 00                	push   $0x0
+  801563:	e8 27 f8 ff ff       	call   800d8f <sys_page_map>
+  801568:	89 c3                	mov    %eax,%ebx
+  80156a:	83 c4 20             	add    $0x20,%esp
+  80156d:	85 c0                	test   %eax,%eax
+  80156f:	78 33                	js     8015a4 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801571:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801574:	89 d8                	mov    %ebx,%eax
+  801576:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801579:	5b                   	pop    %ebx
+  80157a:	5e                   	pop    %esi
+  80157b:	5f                   	pop    %edi
+  80157c:	5d                   	pop    %ebp
+  80157d:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80157e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801585:	83 ec 0c             	sub    $0xc,%esp
+  801588:	25 07 0e 00 00       	and    $0xe07,%eax
+  80158d:	50                   	push   %eax
+  80158e:	ff 75 d4             	push   -0x2c(%ebp)
+  801591:	6a 00                	push   $0x0
+  801593:	53                   	push   %ebx
+  801594:	6a 00                	push   $0x0
+  801596:	e8 f4 f7 ff ff       	call   800d8f <sys_page_map>
+  80159b:	89 c3                	mov    %eax,%ebx
+  80159d:	83 c4 20             	add    $0x20,%esp
+  8015a0:	85 c0                	test   %eax,%eax
+  8015a2:	79 a4                	jns    801548 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8015a4:	83 ec 08             	sub    $0x8,%esp
+  8015a7:	56                   	push   %esi
+  8015a8:	6a 00                	push   $0x0
+  8015aa:	e8 22 f8 ff ff       	call   800dd1 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8015af:	83 c4 08             	add    $0x8,%esp
+  8015b2:	ff 75 d4             	push   -0x2c(%ebp)
+  8015b5:	6a 00                	push   $0x0
+  8015b7:	e8 15 f8 ff ff       	call   800dd1 <sys_page_unmap>
+	return r;
+  8015bc:	83 c4 10             	add    $0x10,%esp
+  8015bf:	eb b3                	jmp    801574 <dup+0x9d>
+
+008015c1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015c1:	55                   	push   %ebp
+  8015c2:	89 e5                	mov    %esp,%ebp
+  8015c4:	56                   	push   %esi
+  8015c5:	53                   	push   %ebx
+  8015c6:	83 ec 18             	sub    $0x18,%esp
+  8015c9:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015cc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015cf:	50                   	push   %eax
+  8015d0:	56                   	push   %esi
+  8015d1:	e8 8c fd ff ff       	call   801362 <fd_lookup>
+  8015d6:	83 c4 10             	add    $0x10,%esp
+  8015d9:	85 c0                	test   %eax,%eax
+  8015db:	78 3c                	js     801619 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015dd:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8015e0:	83 ec 08             	sub    $0x8,%esp
+  8015e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015e6:	50                   	push   %eax
+  8015e7:	ff 33                	push   (%ebx)
+  8015e9:	e8 c4 fd ff ff       	call   8013b2 <dev_lookup>
+  8015ee:	83 c4 10             	add    $0x10,%esp
+  8015f1:	85 c0                	test   %eax,%eax
+  8015f3:	78 24                	js     801619 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8015f5:	8b 43 08             	mov    0x8(%ebx),%eax
+  8015f8:	83 e0 03             	and    $0x3,%eax
+  8015fb:	83 f8 01             	cmp    $0x1,%eax
+  8015fe:	74 20                	je     801620 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801600:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801603:	8b 40 08             	mov    0x8(%eax),%eax
+  801606:	85 c0                	test   %eax,%eax
+  801608:	74 37                	je     801641 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80160a:	83 ec 04             	sub    $0x4,%esp
+  80160d:	ff 75 10             	push   0x10(%ebp)
+  801610:	ff 75 0c             	push   0xc(%ebp)
+  801613:	53                   	push   %ebx
+  801614:	ff d0                	call   *%eax
+  801616:	83 c4 10             	add    $0x10,%esp
+}
+  801619:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80161c:	5b                   	pop    %ebx
+  80161d:	5e                   	pop    %esi
+  80161e:	5d                   	pop    %ebp
+  80161f:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801620:	a1 08 50 80 00       	mov    0x805008,%eax
+  801625:	8b 40 48             	mov    0x48(%eax),%eax
+  801628:	83 ec 04             	sub    $0x4,%esp
+  80162b:	56                   	push   %esi
+  80162c:	50                   	push   %eax
+  80162d:	68 19 33 80 00       	push   $0x803319
+  801632:	e8 3b ec ff ff       	call   800272 <cprintf>
+		return -E_INVAL;
+  801637:	83 c4 10             	add    $0x10,%esp
+  80163a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80163f:	eb d8                	jmp    801619 <read+0x58>
+		return -E_NOT_SUPP;
+  801641:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801646:	eb d1                	jmp    801619 <read+0x58>
+
+00801648 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801648:	55                   	push   %ebp
+  801649:	89 e5                	mov    %esp,%ebp
+  80164b:	57                   	push   %edi
+  80164c:	56                   	push   %esi
+  80164d:	53                   	push   %ebx
+  80164e:	83 ec 0c             	sub    $0xc,%esp
+  801651:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801654:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801657:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165c:	eb 02                	jmp    801660 <readn+0x18>
+  80165e:	01 c3                	add    %eax,%ebx
+  801660:	39 f3                	cmp    %esi,%ebx
+  801662:	73 21                	jae    801685 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801664:	83 ec 04             	sub    $0x4,%esp
+  801667:	89 f0                	mov    %esi,%eax
+  801669:	29 d8                	sub    %ebx,%eax
+  80166b:	50                   	push   %eax
+  80166c:	89 d8                	mov    %ebx,%eax
+  80166e:	03 45 0c             	add    0xc(%ebp),%eax
+  801671:	50                   	push   %eax
+  801672:	57                   	push   %edi
+  801673:	e8 49 ff ff ff       	call   8015c1 <read>
+		if (m < 0)
+  801678:	83 c4 10             	add    $0x10,%esp
+  80167b:	85 c0                	test   %eax,%eax
+  80167d:	78 04                	js     801683 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80167f:	75 dd                	jne    80165e <readn+0x16>
+  801681:	eb 02                	jmp    801685 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801683:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801685:	89 d8                	mov    %ebx,%eax
+  801687:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80168a:	5b                   	pop    %ebx
+  80168b:	5e                   	pop    %esi
+  80168c:	5f                   	pop    %edi
+  80168d:	5d                   	pop    %ebp
+  80168e:	c3                   	ret
+
+0080168f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80168f:	55                   	push   %ebp
+  801690:	89 e5                	mov    %esp,%ebp
+  801692:	56                   	push   %esi
+  801693:	53                   	push   %ebx
+  801694:	83 ec 18             	sub    $0x18,%esp
+  801697:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80169a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80169d:	50                   	push   %eax
+  80169e:	53                   	push   %ebx
+  80169f:	e8 be fc ff ff       	call   801362 <fd_lookup>
+  8016a4:	83 c4 10             	add    $0x10,%esp
+  8016a7:	85 c0                	test   %eax,%eax
+  8016a9:	78 37                	js     8016e2 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016ab:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016ae:	83 ec 08             	sub    $0x8,%esp
+  8016b1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016b4:	50                   	push   %eax
+  8016b5:	ff 36                	push   (%esi)
+  8016b7:	e8 f6 fc ff ff       	call   8013b2 <dev_lookup>
+  8016bc:	83 c4 10             	add    $0x10,%esp
+  8016bf:	85 c0                	test   %eax,%eax
+  8016c1:	78 1f                	js     8016e2 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016c3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016c7:	74 20                	je     8016e9 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8016c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016cc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016cf:	85 c0                	test   %eax,%eax
+  8016d1:	74 37                	je     80170a <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8016d3:	83 ec 04             	sub    $0x4,%esp
+  8016d6:	ff 75 10             	push   0x10(%ebp)
+  8016d9:	ff 75 0c             	push   0xc(%ebp)
+  8016dc:	56                   	push   %esi
+  8016dd:	ff d0                	call   *%eax
+  8016df:	83 c4 10             	add    $0x10,%esp
+}
+  8016e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016e5:	5b                   	pop    %ebx
+  8016e6:	5e                   	pop    %esi
+  8016e7:	5d                   	pop    %ebp
+  8016e8:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016e9:	a1 08 50 80 00       	mov    0x805008,%eax
+  8016ee:	8b 40 48             	mov    0x48(%eax),%eax
+  8016f1:	83 ec 04             	sub    $0x4,%esp
+  8016f4:	53                   	push   %ebx
+  8016f5:	50                   	push   %eax
+  8016f6:	68 35 33 80 00       	push   $0x803335
+  8016fb:	e8 72 eb ff ff       	call   800272 <cprintf>
+		return -E_INVAL;
+  801700:	83 c4 10             	add    $0x10,%esp
+  801703:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801708:	eb d8                	jmp    8016e2 <write+0x53>
+		return -E_NOT_SUPP;
+  80170a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80170f:	eb d1                	jmp    8016e2 <write+0x53>
+
+00801711 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801711:	55                   	push   %ebp
+  801712:	89 e5                	mov    %esp,%ebp
+  801714:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801717:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80171a:	50                   	push   %eax
+  80171b:	ff 75 08             	push   0x8(%ebp)
+  80171e:	e8 3f fc ff ff       	call   801362 <fd_lookup>
+  801723:	83 c4 10             	add    $0x10,%esp
+  801726:	85 c0                	test   %eax,%eax
+  801728:	78 0e                	js     801738 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80172a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80172d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801730:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801733:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801738:	c9                   	leave
+  801739:	c3                   	ret
+
+0080173a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80173a:	55                   	push   %ebp
+  80173b:	89 e5                	mov    %esp,%ebp
+  80173d:	56                   	push   %esi
+  80173e:	53                   	push   %ebx
+  80173f:	83 ec 18             	sub    $0x18,%esp
+  801742:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801745:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801748:	50                   	push   %eax
+  801749:	53                   	push   %ebx
+  80174a:	e8 13 fc ff ff       	call   801362 <fd_lookup>
+  80174f:	83 c4 10             	add    $0x10,%esp
+  801752:	85 c0                	test   %eax,%eax
+  801754:	78 34                	js     80178a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801756:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801759:	83 ec 08             	sub    $0x8,%esp
+  80175c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80175f:	50                   	push   %eax
+  801760:	ff 36                	push   (%esi)
+  801762:	e8 4b fc ff ff       	call   8013b2 <dev_lookup>
+  801767:	83 c4 10             	add    $0x10,%esp
+  80176a:	85 c0                	test   %eax,%eax
+  80176c:	78 1c                	js     80178a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80176e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801772:	74 1d                	je     801791 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801774:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801777:	8b 40 18             	mov    0x18(%eax),%eax
+  80177a:	85 c0                	test   %eax,%eax
+  80177c:	74 34                	je     8017b2 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80177e:	83 ec 08             	sub    $0x8,%esp
+  801781:	ff 75 0c             	push   0xc(%ebp)
+  801784:	56                   	push   %esi
+  801785:	ff d0                	call   *%eax
+  801787:	83 c4 10             	add    $0x10,%esp
+}
+  80178a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80178d:	5b                   	pop    %ebx
+  80178e:	5e                   	pop    %esi
+  80178f:	5d                   	pop    %ebp
+  801790:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801791:	a1 08 50 80 00       	mov    0x805008,%eax
+  801796:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801799:	83 ec 04             	sub    $0x4,%esp
+  80179c:	53                   	push   %ebx
+  80179d:	50                   	push   %eax
+  80179e:	68 f8 32 80 00       	push   $0x8032f8
+  8017a3:	e8 ca ea ff ff       	call   800272 <cprintf>
+		return -E_INVAL;
+  8017a8:	83 c4 10             	add    $0x10,%esp
+  8017ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b0:	eb d8                	jmp    80178a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017b2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017b7:	eb d1                	jmp    80178a <ftruncate+0x50>
+
+008017b9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017b9:	55                   	push   %ebp
+  8017ba:	89 e5                	mov    %esp,%ebp
+  8017bc:	56                   	push   %esi
+  8017bd:	53                   	push   %ebx
+  8017be:	83 ec 18             	sub    $0x18,%esp
+  8017c1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017c4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017c7:	50                   	push   %eax
+  8017c8:	ff 75 08             	push   0x8(%ebp)
+  8017cb:	e8 92 fb ff ff       	call   801362 <fd_lookup>
+  8017d0:	83 c4 10             	add    $0x10,%esp
+  8017d3:	85 c0                	test   %eax,%eax
+  8017d5:	78 49                	js     801820 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017d7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017da:	83 ec 08             	sub    $0x8,%esp
+  8017dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017e0:	50                   	push   %eax
+  8017e1:	ff 36                	push   (%esi)
+  8017e3:	e8 ca fb ff ff       	call   8013b2 <dev_lookup>
+  8017e8:	83 c4 10             	add    $0x10,%esp
+  8017eb:	85 c0                	test   %eax,%eax
+  8017ed:	78 31                	js     801820 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8017ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017f2:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8017f6:	74 2f                	je     801827 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8017f8:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8017fb:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801802:	00 00 00 
+	stat->st_isdir = 0;
+  801805:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80180c:	00 00 00 
+	stat->st_dev = dev;
+  80180f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801815:	83 ec 08             	sub    $0x8,%esp
+  801818:	53                   	push   %ebx
+  801819:	56                   	push   %esi
+  80181a:	ff 50 14             	call   *0x14(%eax)
+  80181d:	83 c4 10             	add    $0x10,%esp
+}
+  801820:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801823:	5b                   	pop    %ebx
+  801824:	5e                   	pop    %esi
+  801825:	5d                   	pop    %ebp
+  801826:	c3                   	ret
+		return -E_NOT_SUPP;
+  801827:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80182c:	eb f2                	jmp    801820 <fstat+0x67>
+
+0080182e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80182e:	55                   	push   %ebp
+  80182f:	89 e5                	mov    %esp,%ebp
+  801831:	56                   	push   %esi
+  801832:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801833:	83 ec 08             	sub    $0x8,%esp
+  801836:	6a 00                	push   $0x0
+  801838:	ff 75 08             	push   0x8(%ebp)
+  80183b:	e8 bc 02 00 00       	call   801afc <open>
+  801840:	89 c3                	mov    %eax,%ebx
+  801842:	83 c4 10             	add    $0x10,%esp
+  801845:	85 c0                	test   %eax,%eax
+  801847:	78 1b                	js     801864 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801849:	83 ec 08             	sub    $0x8,%esp
+  80184c:	ff 75 0c             	push   0xc(%ebp)
+  80184f:	50                   	push   %eax
+  801850:	e8 64 ff ff ff       	call   8017b9 <fstat>
+  801855:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801857:	89 1c 24             	mov    %ebx,(%esp)
+  80185a:	e8 26 fc ff ff       	call   801485 <close>
+	return r;
+  80185f:	83 c4 10             	add    $0x10,%esp
+  801862:	89 f3                	mov    %esi,%ebx
+}
+  801864:	89 d8                	mov    %ebx,%eax
+  801866:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801869:	5b                   	pop    %ebx
+  80186a:	5e                   	pop    %esi
+  80186b:	5d                   	pop    %ebp
+  80186c:	c3                   	ret
+
+0080186d <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  80186d:	55                   	push   %ebp
+  80186e:	89 e5                	mov    %esp,%ebp
+  801870:	57                   	push   %edi
+  801871:	56                   	push   %esi
+  801872:	53                   	push   %ebx
+  801873:	83 ec 0c             	sub    $0xc,%esp
+  801876:	89 c7                	mov    %eax,%edi
+  801878:	89 d3                	mov    %edx,%ebx
+  80187a:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80187c:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801883:	74 2d                	je     8018b2 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801885:	6a 07                	push   $0x7
+  801887:	68 00 60 80 00       	push   $0x806000
+  80188c:	57                   	push   %edi
+  80188d:	ff 35 00 50 80 00    	push   0x805000
+  801893:	e8 53 12 00 00       	call   802aeb <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801898:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80189f:	6a 00                	push   $0x0
+  8018a1:	56                   	push   %esi
+  8018a2:	53                   	push   %ebx
+  8018a3:	6a 00                	push   $0x0
+  8018a5:	e8 f3 10 00 00       	call   80299d <ipc_recv_pages>
+}
+  8018aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ad:	5b                   	pop    %ebx
+  8018ae:	5e                   	pop    %esi
+  8018af:	5f                   	pop    %edi
+  8018b0:	5d                   	pop    %ebp
+  8018b1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018b2:	83 ec 0c             	sub    $0xc,%esp
+  8018b5:	6a 01                	push   $0x1
+  8018b7:	e8 24 13 00 00       	call   802be0 <ipc_find_env>
+  8018bc:	a3 00 50 80 00       	mov    %eax,0x805000
+  8018c1:	83 c4 10             	add    $0x10,%esp
+  8018c4:	eb bf                	jmp    801885 <fsipc_pages+0x18>
+
+008018c6 <fsipc>:
+{
+  8018c6:	55                   	push   %ebp
+  8018c7:	89 e5                	mov    %esp,%ebp
+  8018c9:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  8018cc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018d1:	e8 97 ff ff ff       	call   80186d <fsipc_pages>
+}
+  8018d6:	c9                   	leave
+  8018d7:	c3                   	ret
+
+008018d8 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018d8:	55                   	push   %ebp
+  8018d9:	89 e5                	mov    %esp,%ebp
+  8018db:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018e4:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8018e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018ec:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8018f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018fb:	e8 c6 ff ff ff       	call   8018c6 <fsipc>
+}
+  801900:	c9                   	leave
+  801901:	c3                   	ret
+
+00801902 <devfile_flush>:
+{
+  801902:	55                   	push   %ebp
+  801903:	89 e5                	mov    %esp,%ebp
+  801905:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801908:	8b 45 08             	mov    0x8(%ebp),%eax
+  80190b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80190e:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801913:	ba 00 00 00 00       	mov    $0x0,%edx
+  801918:	b8 06 00 00 00       	mov    $0x6,%eax
+  80191d:	e8 a4 ff ff ff       	call   8018c6 <fsipc>
+}
+  801922:	c9                   	leave
+  801923:	c3                   	ret
+
+00801924 <devfile_stat>:
+{
+  801924:	55                   	push   %ebp
+  801925:	89 e5                	mov    %esp,%ebp
+  801927:	53                   	push   %ebx
+  801928:	83 ec 04             	sub    $0x4,%esp
+  80192b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80192e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801931:	8b 40 0c             	mov    0xc(%eax),%eax
+  801934:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801939:	ba 00 00 00 00       	mov    $0x0,%edx
+  80193e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801943:	e8 7e ff ff ff       	call   8018c6 <fsipc>
+  801948:	85 c0                	test   %eax,%eax
+  80194a:	78 2c                	js     801978 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80194c:	83 ec 08             	sub    $0x8,%esp
+  80194f:	68 00 60 80 00       	push   $0x806000
+  801954:	53                   	push   %ebx
+  801955:	e8 ff ee ff ff       	call   800859 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80195a:	a1 80 60 80 00       	mov    0x806080,%eax
+  80195f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801965:	a1 84 60 80 00       	mov    0x806084,%eax
+  80196a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801970:	83 c4 10             	add    $0x10,%esp
+  801973:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801978:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80197b:	c9                   	leave
+  80197c:	c3                   	ret
+
+0080197d <devfile_write>:
+{
+  80197d:	55                   	push   %ebp
+  80197e:	89 e5                	mov    %esp,%ebp
+  801980:	83 ec 0c             	sub    $0xc,%esp
+  801983:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801986:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80198b:	39 d0                	cmp    %edx,%eax
+  80198d:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801990:	8b 55 08             	mov    0x8(%ebp),%edx
+  801993:	8b 52 0c             	mov    0xc(%edx),%edx
+  801996:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  80199c:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8019a1:	50                   	push   %eax
+  8019a2:	ff 75 0c             	push   0xc(%ebp)
+  8019a5:	68 08 60 80 00       	push   $0x806008
+  8019aa:	e8 30 f0 ff ff       	call   8009df <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8019af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019b9:	e8 08 ff ff ff       	call   8018c6 <fsipc>
+}
+  8019be:	c9                   	leave
+  8019bf:	c3                   	ret
+
+008019c0 <devfile_read>:
+{
+  8019c0:	55                   	push   %ebp
+  8019c1:	89 e5                	mov    %esp,%ebp
+  8019c3:	57                   	push   %edi
+  8019c4:	56                   	push   %esi
+  8019c5:	53                   	push   %ebx
+  8019c6:	83 ec 1c             	sub    $0x1c,%esp
+  8019c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019cc:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8019cf:	89 fe                	mov    %edi,%esi
+  8019d1:	c1 ee 0c             	shr    $0xc,%esi
+  8019d4:	b8 20 00 00 00       	mov    $0x20,%eax
+  8019d9:	39 c6                	cmp    %eax,%esi
+  8019db:	0f 47 f0             	cmova  %eax,%esi
+  8019de:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019e6:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8019e9:	eb 14                	jmp    8019ff <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8019eb:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  8019f2:	05 00 10 00 00       	add    $0x1000,%eax
+  8019f7:	f6 c6 06             	test   $0x6,%dh
+  8019fa:	75 42                	jne    801a3e <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8019fc:	83 c1 01             	add    $0x1,%ecx
+  8019ff:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801a02:	39 f1                	cmp    %esi,%ecx
+  801a04:	0f 84 95 00 00 00    	je     801a9f <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801a0a:	89 c2                	mov    %eax,%edx
+  801a0c:	c1 ea 16             	shr    $0x16,%edx
+  801a0f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a16:	f6 c2 01             	test   $0x1,%dl
+  801a19:	74 23                	je     801a3e <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801a1b:	89 c2                	mov    %eax,%edx
+  801a1d:	c1 ea 0c             	shr    $0xc,%edx
+  801a20:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801a27:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801a2d:	74 0f                	je     801a3e <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801a2f:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801a36:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801a3c:	75 ad                	jne    8019eb <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801a3e:	85 c9                	test   %ecx,%ecx
+  801a40:	74 11                	je     801a53 <devfile_read+0x93>
+  801a42:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801a49:	75 08                	jne    801a53 <devfile_read+0x93>
+  801a4b:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801a51:	74 50                	je     801aa3 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a53:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a56:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801a5b:	89 3d 04 60 80 00    	mov    %edi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a61:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a66:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a6b:	e8 56 fe ff ff       	call   8018c6 <fsipc>
+  801a70:	89 c6                	mov    %eax,%esi
+  801a72:	85 c0                	test   %eax,%eax
+  801a74:	78 1f                	js     801a95 <devfile_read+0xd5>
+	assert(r <= n);
+  801a76:	39 c7                	cmp    %eax,%edi
+  801a78:	72 50                	jb     801aca <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801a7a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a7f:	7f 62                	jg     801ae3 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801a81:	83 ec 04             	sub    $0x4,%esp
+  801a84:	50                   	push   %eax
+  801a85:	68 00 60 80 00       	push   $0x806000
+  801a8a:	ff 75 0c             	push   0xc(%ebp)
+  801a8d:	e8 4d ef ff ff       	call   8009df <memmove>
+	return r;
+  801a92:	83 c4 10             	add    $0x10,%esp
+}
+  801a95:	89 f0                	mov    %esi,%eax
+  801a97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a9a:	5b                   	pop    %ebx
+  801a9b:	5e                   	pop    %esi
+  801a9c:	5f                   	pop    %edi
+  801a9d:	5d                   	pop    %ebp
+  801a9e:	c3                   	ret
+  801a9f:	89 f1                	mov    %esi,%ecx
+  801aa1:	eb 9b                	jmp    801a3e <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801aa3:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801aa6:	a3 00 60 80 00       	mov    %eax,0x806000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801aab:	89 c8                	mov    %ecx,%eax
+  801aad:	c1 e0 0c             	shl    $0xc,%eax
+  801ab0:	a3 04 60 80 00       	mov    %eax,0x806004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801ab5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ab8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801abd:	e8 ab fd ff ff       	call   80186d <fsipc_pages>
+  801ac2:	89 c6                	mov    %eax,%esi
+  801ac4:	85 c0                	test   %eax,%eax
+  801ac6:	78 8b                	js     801a53 <devfile_read+0x93>
+  801ac8:	eb cb                	jmp    801a95 <devfile_read+0xd5>
+	assert(r <= n);
+  801aca:	68 64 33 80 00       	push   $0x803364
+  801acf:	68 6b 33 80 00       	push   $0x80336b
+  801ad4:	68 a0 00 00 00       	push   $0xa0
+  801ad9:	68 80 33 80 00       	push   $0x803380
+  801ade:	e8 b4 e6 ff ff       	call   800197 <_panic>
+	assert(r <= PGSIZE);
+  801ae3:	68 8b 33 80 00       	push   $0x80338b
+  801ae8:	68 6b 33 80 00       	push   $0x80336b
+  801aed:	68 a1 00 00 00       	push   $0xa1
+  801af2:	68 80 33 80 00       	push   $0x803380
+  801af7:	e8 9b e6 ff ff       	call   800197 <_panic>
+
+00801afc <open>:
+{
+  801afc:	55                   	push   %ebp
+  801afd:	89 e5                	mov    %esp,%ebp
+  801aff:	56                   	push   %esi
+  801b00:	53                   	push   %ebx
+  801b01:	83 ec 1c             	sub    $0x1c,%esp
+  801b04:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801b07:	56                   	push   %esi
+  801b08:	e8 11 ed ff ff       	call   80081e <strlen>
+  801b0d:	83 c4 10             	add    $0x10,%esp
+  801b10:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b15:	7f 6c                	jg     801b83 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801b17:	83 ec 0c             	sub    $0xc,%esp
+  801b1a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b1d:	50                   	push   %eax
+  801b1e:	e8 eb f7 ff ff       	call   80130e <fd_alloc>
+  801b23:	89 c3                	mov    %eax,%ebx
+  801b25:	83 c4 10             	add    $0x10,%esp
+  801b28:	85 c0                	test   %eax,%eax
+  801b2a:	78 3c                	js     801b68 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801b2c:	83 ec 08             	sub    $0x8,%esp
+  801b2f:	56                   	push   %esi
+  801b30:	68 00 60 80 00       	push   $0x806000
+  801b35:	e8 1f ed ff ff       	call   800859 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b3d:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b42:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b45:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b4a:	e8 77 fd ff ff       	call   8018c6 <fsipc>
+  801b4f:	89 c3                	mov    %eax,%ebx
+  801b51:	83 c4 10             	add    $0x10,%esp
+  801b54:	85 c0                	test   %eax,%eax
+  801b56:	78 19                	js     801b71 <open+0x75>
+	return fd2num(fd);
+  801b58:	83 ec 0c             	sub    $0xc,%esp
+  801b5b:	ff 75 f4             	push   -0xc(%ebp)
+  801b5e:	e8 84 f7 ff ff       	call   8012e7 <fd2num>
+  801b63:	89 c3                	mov    %eax,%ebx
+  801b65:	83 c4 10             	add    $0x10,%esp
+}
+  801b68:	89 d8                	mov    %ebx,%eax
+  801b6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b6d:	5b                   	pop    %ebx
+  801b6e:	5e                   	pop    %esi
+  801b6f:	5d                   	pop    %ebp
+  801b70:	c3                   	ret
+		fd_close(fd, 0);
+  801b71:	83 ec 08             	sub    $0x8,%esp
+  801b74:	6a 00                	push   $0x0
+  801b76:	ff 75 f4             	push   -0xc(%ebp)
+  801b79:	e8 80 f8 ff ff       	call   8013fe <fd_close>
+		return r;
+  801b7e:	83 c4 10             	add    $0x10,%esp
+  801b81:	eb e5                	jmp    801b68 <open+0x6c>
+		return -E_BAD_PATH;
+  801b83:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b88:	eb de                	jmp    801b68 <open+0x6c>
+
+00801b8a <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801b8a:	55                   	push   %ebp
+  801b8b:	89 e5                	mov    %esp,%ebp
+  801b8d:	53                   	push   %ebx
+  801b8e:	83 ec 10             	sub    $0x10,%esp
+  801b91:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801b94:	53                   	push   %ebx
+  801b95:	e8 84 ec ff ff       	call   80081e <strlen>
+  801b9a:	83 c4 10             	add    $0x10,%esp
+  801b9d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ba2:	7f 25                	jg     801bc9 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801ba4:	83 ec 08             	sub    $0x8,%esp
+  801ba7:	53                   	push   %ebx
+  801ba8:	68 00 60 80 00       	push   $0x806000
+  801bad:	e8 a7 ec ff ff       	call   800859 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801bb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb7:	b8 07 00 00 00       	mov    $0x7,%eax
+  801bbc:	e8 05 fd ff ff       	call   8018c6 <fsipc>
+  801bc1:	83 c4 10             	add    $0x10,%esp
+}
+  801bc4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bc7:	c9                   	leave
+  801bc8:	c3                   	ret
+		return -E_BAD_PATH;
+  801bc9:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801bce:	eb f4                	jmp    801bc4 <remove+0x3a>
+
+00801bd0 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801bd0:	55                   	push   %ebp
+  801bd1:	89 e5                	mov    %esp,%ebp
+  801bd3:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801bd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bdb:	b8 08 00 00 00       	mov    $0x8,%eax
+  801be0:	e8 e1 fc ff ff       	call   8018c6 <fsipc>
+}
+  801be5:	c9                   	leave
+  801be6:	c3                   	ret
+
+00801be7 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801be7:	55                   	push   %ebp
+  801be8:	89 e5                	mov    %esp,%ebp
+  801bea:	53                   	push   %ebx
+  801beb:	83 ec 04             	sub    $0x4,%esp
+  801bee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801bf1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801bfb:	e8 c6 fc ff ff       	call   8018c6 <fsipc>
+  801c00:	85 c0                	test   %eax,%eax
+  801c02:	78 3c                	js     801c40 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801c04:	a1 00 60 80 00       	mov    0x806000,%eax
+  801c09:	89 03                	mov    %eax,(%ebx)
+  801c0b:	a1 04 60 80 00       	mov    0x806004,%eax
+  801c10:	89 43 04             	mov    %eax,0x4(%ebx)
+  801c13:	a1 08 60 80 00       	mov    0x806008,%eax
+  801c18:	89 43 08             	mov    %eax,0x8(%ebx)
+  801c1b:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  801c20:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801c23:	a1 10 60 80 00       	mov    0x806010,%eax
+  801c28:	89 43 10             	mov    %eax,0x10(%ebx)
+  801c2b:	a1 14 60 80 00       	mov    0x806014,%eax
+  801c30:	89 43 14             	mov    %eax,0x14(%ebx)
+  801c33:	a1 18 60 80 00       	mov    0x806018,%eax
+  801c38:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c43:	c9                   	leave
+  801c44:	c3                   	ret
+
+00801c45 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801c45:	55                   	push   %ebp
+  801c46:	89 e5                	mov    %esp,%ebp
+  801c48:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801c4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c4e:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_BCSET, NULL);
+  801c53:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c58:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c5d:	e8 64 fc ff ff       	call   8018c6 <fsipc>
+}
+  801c62:	c9                   	leave
+  801c63:	c3                   	ret
+
+00801c64 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  801c64:	55                   	push   %ebp
+  801c65:	89 e5                	mov    %esp,%ebp
+  801c67:	57                   	push   %edi
+  801c68:	56                   	push   %esi
+  801c69:	53                   	push   %ebx
+  801c6a:	81 ec 14 03 00 00    	sub    $0x314,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  801c70:	6a 00                	push   $0x0
+  801c72:	ff 75 08             	push   0x8(%ebp)
+  801c75:	e8 82 fe ff ff       	call   801afc <open>
+  801c7a:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  801c80:	83 c4 10             	add    $0x10,%esp
+  801c83:	85 c0                	test   %eax,%eax
+  801c85:	0f 88 06 06 00 00    	js     802291 <spawn+0x62d>
+  801c8b:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  801c8d:	83 ec 04             	sub    $0x4,%esp
+  801c90:	68 00 02 00 00       	push   $0x200
+  801c95:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  801c9b:	50                   	push   %eax
+  801c9c:	51                   	push   %ecx
+  801c9d:	e8 a6 f9 ff ff       	call   801648 <readn>
+  801ca2:	83 c4 10             	add    $0x10,%esp
+  801ca5:	3d 00 02 00 00       	cmp    $0x200,%eax
+  801caa:	75 74                	jne    801d20 <spawn+0xbc>
+	    || elf->e_magic != ELF_MAGIC) {
+  801cac:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  801cb3:	45 4c 46 
+  801cb6:	75 68                	jne    801d20 <spawn+0xbc>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801cb8:	b8 07 00 00 00       	mov    $0x7,%eax
+  801cbd:	cd 30                	int    $0x30
+  801cbf:	89 85 0c fd ff ff    	mov    %eax,-0x2f4(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  801cc5:	85 c0                	test   %eax,%eax
+  801cc7:	0f 88 b8 05 00 00    	js     802285 <spawn+0x621>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  801ccd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801cd2:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  801cd5:	c1 e6 06             	shl    $0x6,%esi
+  801cd8:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801cde:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  801ce4:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801ce9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  801ceb:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  801cf1:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  801cf7:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  801cfc:	be 00 00 00 00       	mov    $0x0,%esi
+  801d01:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  801d04:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  801d07:	85 c0                	test   %eax,%eax
+  801d09:	74 4d                	je     801d58 <spawn+0xf4>
+		string_size += strlen(argv[argc]) + 1;
+  801d0b:	83 ec 0c             	sub    $0xc,%esp
+  801d0e:	50                   	push   %eax
+  801d0f:	e8 0a eb ff ff       	call   80081e <strlen>
+  801d14:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  801d18:	83 c3 01             	add    $0x1,%ebx
+  801d1b:	83 c4 10             	add    $0x10,%esp
+  801d1e:	eb e4                	jmp    801d04 <spawn+0xa0>
+		close(fd);
+  801d20:	83 ec 0c             	sub    $0xc,%esp
+  801d23:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  801d29:	e8 57 f7 ff ff       	call   801485 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  801d2e:	83 c4 0c             	add    $0xc,%esp
+  801d31:	68 7f 45 4c 46       	push   $0x464c457f
+  801d36:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  801d3c:	68 97 33 80 00       	push   $0x803397
+  801d41:	e8 2c e5 ff ff       	call   800272 <cprintf>
+		return -E_NOT_EXEC;
+  801d46:	83 c4 10             	add    $0x10,%esp
+  801d49:	c7 85 10 fd ff ff f2 	movl   $0xfffffff2,-0x2f0(%ebp)
+  801d50:	ff ff ff 
+  801d53:	e9 39 05 00 00       	jmp    802291 <spawn+0x62d>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  801d58:	89 9d 04 fd ff ff    	mov    %ebx,-0x2fc(%ebp)
+  801d5e:	bf 00 10 40 00       	mov    $0x401000,%edi
+  801d63:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  801d65:	89 fa                	mov    %edi,%edx
+  801d67:	83 e2 fc             	and    $0xfffffffc,%edx
+  801d6a:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  801d71:	29 c2                	sub    %eax,%edx
+  801d73:	89 95 14 fd ff ff    	mov    %edx,-0x2ec(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  801d79:	8d 42 f8             	lea    -0x8(%edx),%eax
+  801d7c:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  801d81:	0f 86 18 05 00 00    	jbe    80229f <spawn+0x63b>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  801d87:	83 ec 04             	sub    $0x4,%esp
+  801d8a:	6a 07                	push   $0x7
+  801d8c:	68 00 00 40 00       	push   $0x400000
+  801d91:	6a 00                	push   $0x0
+  801d93:	e8 b4 ef ff ff       	call   800d4c <sys_page_alloc>
+  801d98:	83 c4 10             	add    $0x10,%esp
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	0f 88 01 05 00 00    	js     8022a4 <spawn+0x640>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  801da3:	be 00 00 00 00       	mov    $0x0,%esi
+  801da8:	89 9d 08 fd ff ff    	mov    %ebx,-0x2f8(%ebp)
+  801dae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801db1:	eb 30                	jmp    801de3 <spawn+0x17f>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  801db3:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  801db9:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  801dbf:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  801dc2:	83 ec 08             	sub    $0x8,%esp
+  801dc5:	ff 34 b3             	push   (%ebx,%esi,4)
+  801dc8:	57                   	push   %edi
+  801dc9:	e8 8b ea ff ff       	call   800859 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  801dce:	83 c4 04             	add    $0x4,%esp
+  801dd1:	ff 34 b3             	push   (%ebx,%esi,4)
+  801dd4:	e8 45 ea ff ff       	call   80081e <strlen>
+  801dd9:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  801ddd:	83 c6 01             	add    $0x1,%esi
+  801de0:	83 c4 10             	add    $0x10,%esp
+  801de3:	39 b5 08 fd ff ff    	cmp    %esi,-0x2f8(%ebp)
+  801de9:	7f c8                	jg     801db3 <spawn+0x14f>
+	}
+	argv_store[argc] = 0;
+  801deb:	8b 85 14 fd ff ff    	mov    -0x2ec(%ebp),%eax
+  801df1:	8b 8d 04 fd ff ff    	mov    -0x2fc(%ebp),%ecx
+  801df7:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  801dfe:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  801e04:	0f 85 fb 00 00 00    	jne    801f05 <spawn+0x2a1>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  801e0a:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  801e10:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  801e16:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  801e19:	89 c8                	mov    %ecx,%eax
+  801e1b:	8b 8d 04 fd ff ff    	mov    -0x2fc(%ebp),%ecx
+  801e21:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  801e24:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  801e29:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  801e2f:	83 ec 0c             	sub    $0xc,%esp
+  801e32:	6a 07                	push   $0x7
+  801e34:	68 00 d0 bf ee       	push   $0xeebfd000
+  801e39:	8b b5 0c fd ff ff    	mov    -0x2f4(%ebp),%esi
+  801e3f:	56                   	push   %esi
+  801e40:	68 00 00 40 00       	push   $0x400000
+  801e45:	6a 00                	push   $0x0
+  801e47:	e8 43 ef ff ff       	call   800d8f <sys_page_map>
+  801e4c:	89 c3                	mov    %eax,%ebx
+  801e4e:	83 c4 20             	add    $0x20,%esp
+  801e51:	85 c0                	test   %eax,%eax
+  801e53:	0f 88 53 04 00 00    	js     8022ac <spawn+0x648>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801e59:	83 ec 08             	sub    $0x8,%esp
+  801e5c:	68 00 00 40 00       	push   $0x400000
+  801e61:	6a 00                	push   $0x0
+  801e63:	e8 69 ef ff ff       	call   800dd1 <sys_page_unmap>
+  801e68:	89 c3                	mov    %eax,%ebx
+  801e6a:	83 c4 10             	add    $0x10,%esp
+  801e6d:	85 c0                	test   %eax,%eax
+  801e6f:	0f 88 37 04 00 00    	js     8022ac <spawn+0x648>
+	if ((r = fd_lookup(fd, &fdp)) < 0)
+  801e75:	83 ec 08             	sub    $0x8,%esp
+  801e78:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  801e7e:	50                   	push   %eax
+  801e7f:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  801e85:	e8 d8 f4 ff ff       	call   801362 <fd_lookup>
+  801e8a:	89 c7                	mov    %eax,%edi
+  801e8c:	83 c4 10             	add    $0x10,%esp
+  801e8f:	85 c0                	test   %eax,%eax
+  801e91:	0f 88 d6 01 00 00    	js     80206d <spawn+0x409>
+	if ((r = sys_page_map(0, fdp, child, (void*) PROGFD, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801e97:	83 ec 0c             	sub    $0xc,%esp
+  801e9a:	68 07 04 00 00       	push   $0x407
+  801e9f:	68 00 f0 ff cf       	push   $0xcffff000
+  801ea4:	56                   	push   %esi
+  801ea5:	ff b5 a0 fd ff ff    	push   -0x260(%ebp)
+  801eab:	6a 00                	push   $0x0
+  801ead:	e8 dd ee ff ff       	call   800d8f <sys_page_map>
+  801eb2:	89 c7                	mov    %eax,%edi
+  801eb4:	83 c4 20             	add    $0x20,%esp
+  801eb7:	85 c0                	test   %eax,%eax
+  801eb9:	0f 88 ae 01 00 00    	js     80206d <spawn+0x409>
+	pager = ipc_find_env(ENV_TYPE_FS);
+  801ebf:	83 ec 0c             	sub    $0xc,%esp
+  801ec2:	6a 01                	push   $0x1
+  801ec4:	e8 17 0d 00 00       	call   802be0 <ipc_find_env>
+  801ec9:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%ebp)
+	memset(segs, 0, sizeof(segs));
+  801ecf:	83 c4 0c             	add    $0xc,%esp
+  801ed2:	68 80 00 00 00       	push   $0x80
+  801ed7:	6a 00                	push   $0x0
+  801ed9:	8d 9d 20 fd ff ff    	lea    -0x2e0(%ebp),%ebx
+  801edf:	53                   	push   %ebx
+  801ee0:	e8 c5 ea ff ff       	call   8009aa <memset>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  801ee5:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  801eeb:	8d bc 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%edi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801ef2:	83 c4 10             	add    $0x10,%esp
+  801ef5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801efa:	89 fe                	mov    %edi,%esi
+  801efc:	89 d1                	mov    %edx,%ecx
+  801efe:	89 da                	mov    %ebx,%edx
+  801f00:	e9 bf 01 00 00       	jmp    8020c4 <spawn+0x460>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  801f05:	68 0c 34 80 00       	push   $0x80340c
+  801f0a:	68 6b 33 80 00       	push   $0x80336b
+  801f0f:	68 17 01 00 00       	push   $0x117
+  801f14:	68 b1 33 80 00       	push   $0x8033b1
+  801f19:	e8 79 e2 ff ff       	call   800197 <_panic>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  801f1e:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801f21:	89 9d 00 fd ff ff    	mov    %ebx,-0x300(%ebp)
+  801f27:	8b 46 10             	mov    0x10(%esi),%eax
+  801f2a:	89 85 14 fd ff ff    	mov    %eax,-0x2ec(%ebp)
+  801f30:	8b 7e 14             	mov    0x14(%esi),%edi
+  801f33:	89 bd 08 fd ff ff    	mov    %edi,-0x2f8(%ebp)
+  801f39:	8b 7e 08             	mov    0x8(%esi),%edi
+	int i, r;
+	void *blk;
+
+	//cprintf("map_segment %x+%x\n", va, memsz);
+
+	if ((i = PGOFF(va))) {
+  801f3c:	89 f8                	mov    %edi,%eax
+  801f3e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f43:	74 16                	je     801f5b <spawn+0x2f7>
+		va -= i;
+  801f45:	29 c7                	sub    %eax,%edi
+		memsz += i;
+  801f47:	01 85 08 fd ff ff    	add    %eax,-0x2f8(%ebp)
+		filesz += i;
+  801f4d:	01 85 14 fd ff ff    	add    %eax,-0x2ec(%ebp)
+		fileoffset -= i;
+  801f53:	29 c3                	sub    %eax,%ebx
+  801f55:	89 9d 00 fd ff ff    	mov    %ebx,-0x300(%ebp)
+	}
+
+	for (i = 0; i < memsz; i += PGSIZE) {
+  801f5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f60:	89 8d fc fc ff ff    	mov    %ecx,-0x304(%ebp)
+  801f66:	89 b5 f8 fc ff ff    	mov    %esi,-0x308(%ebp)
+  801f6c:	8b b5 14 fd ff ff    	mov    -0x2ec(%ebp),%esi
+  801f72:	89 95 f4 fc ff ff    	mov    %edx,-0x30c(%ebp)
+  801f78:	e9 ba 00 00 00       	jmp    802037 <spawn+0x3d3>
+			// allocate a blank page
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+				return r;
+		} else {
+			// from file
+			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  801f7d:	83 ec 04             	sub    $0x4,%esp
+  801f80:	6a 07                	push   $0x7
+  801f82:	68 00 00 40 00       	push   $0x400000
+  801f87:	6a 00                	push   $0x0
+  801f89:	e8 be ed ff ff       	call   800d4c <sys_page_alloc>
+  801f8e:	83 c4 10             	add    $0x10,%esp
+  801f91:	85 c0                	test   %eax,%eax
+  801f93:	0f 88 d7 02 00 00    	js     802270 <spawn+0x60c>
+				return r;
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  801f99:	83 ec 08             	sub    $0x8,%esp
+  801f9c:	8b 95 00 fd ff ff    	mov    -0x300(%ebp),%edx
+  801fa2:	8b 85 14 fd ff ff    	mov    -0x2ec(%ebp),%eax
+  801fa8:	01 d0                	add    %edx,%eax
+  801faa:	50                   	push   %eax
+  801fab:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  801fb1:	e8 5b f7 ff ff       	call   801711 <seek>
+  801fb6:	83 c4 10             	add    $0x10,%esp
+  801fb9:	85 c0                	test   %eax,%eax
+  801fbb:	0f 88 b6 02 00 00    	js     802277 <spawn+0x613>
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
+  801fc1:	83 ec 04             	sub    $0x4,%esp
+  801fc4:	89 f2                	mov    %esi,%edx
+  801fc6:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  801fcc:	29 ca                	sub    %ecx,%edx
+  801fce:	89 d0                	mov    %edx,%eax
+  801fd0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801fd5:	39 d0                	cmp    %edx,%eax
+  801fd7:	0f 47 c2             	cmova  %edx,%eax
+  801fda:	50                   	push   %eax
+  801fdb:	68 00 00 40 00       	push   $0x400000
+  801fe0:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  801fe6:	e8 5d f6 ff ff       	call   801648 <readn>
+  801feb:	83 c4 10             	add    $0x10,%esp
+  801fee:	85 c0                	test   %eax,%eax
+  801ff0:	0f 88 88 02 00 00    	js     80227e <spawn+0x61a>
+				return r;
+			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
+  801ff6:	83 ec 0c             	sub    $0xc,%esp
+  801ff9:	ff b5 04 fd ff ff    	push   -0x2fc(%ebp)
+  801fff:	57                   	push   %edi
+  802000:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802006:	68 00 00 40 00       	push   $0x400000
+  80200b:	6a 00                	push   $0x0
+  80200d:	e8 7d ed ff ff       	call   800d8f <sys_page_map>
+  802012:	83 c4 20             	add    $0x20,%esp
+  802015:	85 c0                	test   %eax,%eax
+  802017:	78 7e                	js     802097 <spawn+0x433>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP);
+  802019:	83 ec 08             	sub    $0x8,%esp
+  80201c:	68 00 00 40 00       	push   $0x400000
+  802021:	6a 00                	push   $0x0
+  802023:	e8 a9 ed ff ff       	call   800dd1 <sys_page_unmap>
+  802028:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < memsz; i += PGSIZE) {
+  80202b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802031:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  802037:	89 9d 14 fd ff ff    	mov    %ebx,-0x2ec(%ebp)
+  80203d:	8b 85 08 fd ff ff    	mov    -0x2f8(%ebp),%eax
+  802043:	39 c3                	cmp    %eax,%ebx
+  802045:	73 65                	jae    8020ac <spawn+0x448>
+		if (i >= filesz) {
+  802047:	39 f3                	cmp    %esi,%ebx
+  802049:	0f 82 2e ff ff ff    	jb     801f7d <spawn+0x319>
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  80204f:	83 ec 04             	sub    $0x4,%esp
+  802052:	ff b5 04 fd ff ff    	push   -0x2fc(%ebp)
+  802058:	57                   	push   %edi
+  802059:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  80205f:	e8 e8 ec ff ff       	call   800d4c <sys_page_alloc>
+  802064:	83 c4 10             	add    $0x10,%esp
+  802067:	85 c0                	test   %eax,%eax
+  802069:	79 c0                	jns    80202b <spawn+0x3c7>
+  80206b:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  80206d:	83 ec 0c             	sub    $0xc,%esp
+  802070:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802076:	e8 52 ec ff ff       	call   800ccd <sys_env_destroy>
+	close(fd);
+  80207b:	83 c4 04             	add    $0x4,%esp
+  80207e:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  802084:	e8 fc f3 ff ff       	call   801485 <close>
+	return r;
+  802089:	83 c4 10             	add    $0x10,%esp
+  80208c:	89 bd 10 fd ff ff    	mov    %edi,-0x2f0(%ebp)
+  802092:	e9 fa 01 00 00       	jmp    802291 <spawn+0x62d>
+				panic("spawn: sys_page_map data: %e", r);
+  802097:	50                   	push   %eax
+  802098:	68 bd 33 80 00       	push   $0x8033bd
+  80209d:	68 4a 01 00 00       	push   $0x14a
+  8020a2:	68 b1 33 80 00       	push   $0x8033b1
+  8020a7:	e8 eb e0 ff ff       	call   800197 <_panic>
+  8020ac:	8b 8d fc fc ff ff    	mov    -0x304(%ebp),%ecx
+  8020b2:	8b b5 f8 fc ff ff    	mov    -0x308(%ebp),%esi
+  8020b8:	8b 95 f4 fc ff ff    	mov    -0x30c(%ebp),%edx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8020be:	83 c1 01             	add    $0x1,%ecx
+  8020c1:	83 c6 20             	add    $0x20,%esi
+  8020c4:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8020cb:	39 c8                	cmp    %ecx,%eax
+  8020cd:	7e 74                	jle    802143 <spawn+0x4df>
+		if (ph->p_type != ELF_PROG_LOAD)
+  8020cf:	83 3e 01             	cmpl   $0x1,(%esi)
+  8020d2:	75 ea                	jne    8020be <spawn+0x45a>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8020d4:	8b 46 18             	mov    0x18(%esi),%eax
+  8020d7:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  8020da:	83 f8 01             	cmp    $0x1,%eax
+  8020dd:	19 ff                	sbb    %edi,%edi
+  8020df:	83 e7 fe             	and    $0xfffffffe,%edi
+  8020e2:	83 c7 07             	add    $0x7,%edi
+  8020e5:	89 bd 04 fd ff ff    	mov    %edi,-0x2fc(%ebp)
+		if (seg < segs + NSEGS) {
+  8020eb:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  8020f1:	39 c2                	cmp    %eax,%edx
+  8020f3:	0f 83 25 fe ff ff    	jae    801f1e <spawn+0x2ba>
+			seg->seg_va = ROUNDDOWN(ph->p_va, PGSIZE);
+  8020f9:	8b 46 08             	mov    0x8(%esi),%eax
+  8020fc:	89 c3                	mov    %eax,%ebx
+  8020fe:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802104:	89 1a                	mov    %ebx,(%edx)
+			seg->seg_memsz = ph->p_memsz + PGOFF(ph->p_va);
+  802106:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80210b:	89 c3                	mov    %eax,%ebx
+  80210d:	03 5e 14             	add    0x14(%esi),%ebx
+  802110:	89 5a 04             	mov    %ebx,0x4(%edx)
+			seg->seg_filesz = ph->p_filesz + PGOFF(ph->p_va);
+  802113:	89 c3                	mov    %eax,%ebx
+  802115:	03 5e 10             	add    0x10(%esi),%ebx
+  802118:	89 5a 08             	mov    %ebx,0x8(%edx)
+			seg->seg_offset = ph->p_offset - PGOFF(ph->p_va);
+  80211b:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80211e:	29 c3                	sub    %eax,%ebx
+  802120:	89 5a 0c             	mov    %ebx,0xc(%edx)
+			seg->seg_perm = perm;
+  802123:	89 7a 10             	mov    %edi,0x10(%edx)
+			seg->seg_pager = pager;
+  802126:	8b 85 f0 fc ff ff    	mov    -0x310(%ebp),%eax
+  80212c:	89 42 14             	mov    %eax,0x14(%edx)
+			seg->seg_fileid = fdp->fd_file.id;
+  80212f:	8b 85 a0 fd ff ff    	mov    -0x260(%ebp),%eax
+  802135:	8b 40 0c             	mov    0xc(%eax),%eax
+  802138:	89 42 18             	mov    %eax,0x18(%edx)
+			seg++;
+  80213b:	83 c2 20             	add    $0x20,%edx
+			continue;
+  80213e:	e9 7b ff ff ff       	jmp    8020be <spawn+0x45a>
+	if ((r = sys_env_set_segments(child, segs, seg - segs)) < 0)
+  802143:	89 d1                	mov    %edx,%ecx
+  802145:	83 ec 04             	sub    $0x4,%esp
+  802148:	8d 95 20 fd ff ff    	lea    -0x2e0(%ebp),%edx
+  80214e:	89 c8                	mov    %ecx,%eax
+  802150:	29 d0                	sub    %edx,%eax
+  802152:	c1 f8 05             	sar    $0x5,%eax
+  802155:	50                   	push   %eax
+  802156:	52                   	push   %edx
+  802157:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  80215d:	e8 fc ee ff ff       	call   80105e <sys_env_set_segments>
+  802162:	89 c7                	mov    %eax,%edi
+  802164:	83 c4 10             	add    $0x10,%esp
+  802167:	85 c0                	test   %eax,%eax
+  802169:	0f 88 fe fe ff ff    	js     80206d <spawn+0x409>
+	close(fd);
+  80216f:	83 ec 0c             	sub    $0xc,%esp
+  802172:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  802178:	e8 08 f3 ff ff       	call   801485 <close>
+  80217d:	83 c4 10             	add    $0x10,%esp
+	// Copy the mappings for shared pages into the child address.
+	// We need to iterate through all PTEs for addresses below UTOP.
+	// However, we handle the exception stack separately, so we only need to iterate up until UXSTACKTOP-PGSIZE.
+	// Since [USTACKTOP, UXSTACKTOP-PGSIZE) is empty memory, we can get away with only iterating up until USTACKTOP.
+	// This is the same as iterating through pages 0 through PGNUM(USTACKTOP)-1 inclusive.
+	for (pn = 0; pn < PGNUM(USTACKTOP); ++pn) {
+  802180:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802185:	eb 2d                	jmp    8021b4 <spawn+0x550>
+		// We only copy this page if it is present and readable in user mode, and if it is a shared page.
+		// This requires checking for PTE_P and PTE_U not only in uvpt[pn],
+		// but in the associated PDE as well, since page pn won't exist if its page table doesn't exist, i.e. if it isn't present in the page directory.
+		// Large pages are never shared (see sys_page_alloc), and have no uvpt entries.
+		if (((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U) && !(uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U) && (uvpt[pn]&PTE_SHARE))) {
+			sys_page_map(0, (void *)PGADDR(0,pn,0), child, (void *)PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL);
+  802187:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80218e:	83 ec 0c             	sub    $0xc,%esp
+  802191:	25 07 0e 00 00       	and    $0xe07,%eax
+  802196:	50                   	push   %eax
+  802197:	52                   	push   %edx
+  802198:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  80219e:	52                   	push   %edx
+  80219f:	6a 00                	push   $0x0
+  8021a1:	e8 e9 eb ff ff       	call   800d8f <sys_page_map>
+  8021a6:	83 c4 20             	add    $0x20,%esp
+	for (pn = 0; pn < PGNUM(USTACKTOP); ++pn) {
+  8021a9:	83 c3 01             	add    $0x1,%ebx
+  8021ac:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  8021b2:	74 51                	je     802205 <spawn+0x5a1>
+		if (((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U) && !(uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U) && (uvpt[pn]&PTE_SHARE))) {
+  8021b4:	89 da                	mov    %ebx,%edx
+  8021b6:	c1 e2 0c             	shl    $0xc,%edx
+  8021b9:	89 d0                	mov    %edx,%eax
+  8021bb:	c1 e8 16             	shr    $0x16,%eax
+  8021be:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8021c5:	f6 c1 01             	test   $0x1,%cl
+  8021c8:	74 df                	je     8021a9 <spawn+0x545>
+  8021ca:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8021d1:	f6 c1 04             	test   $0x4,%cl
+  8021d4:	74 d3                	je     8021a9 <spawn+0x545>
+  8021d6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8021dd:	a8 80                	test   $0x80,%al
+  8021df:	75 c8                	jne    8021a9 <spawn+0x545>
+  8021e1:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8021e8:	a8 01                	test   $0x1,%al
+  8021ea:	74 bd                	je     8021a9 <spawn+0x545>
+  8021ec:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8021f3:	a8 04                	test   $0x4,%al
+  8021f5:	74 b2                	je     8021a9 <spawn+0x545>
+  8021f7:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8021fe:	f6 c4 04             	test   $0x4,%ah
+  802201:	74 a6                	je     8021a9 <spawn+0x545>
+  802203:	eb 82                	jmp    802187 <spawn+0x523>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802205:	83 ec 08             	sub    $0x8,%esp
+  802208:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  80220e:	50                   	push   %eax
+  80220f:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802215:	e8 b2 ed ff ff       	call   800fcc <sys_env_set_trapframe>
+  80221a:	83 c4 10             	add    $0x10,%esp
+  80221d:	85 c0                	test   %eax,%eax
+  80221f:	78 25                	js     802246 <spawn+0x5e2>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802221:	83 ec 08             	sub    $0x8,%esp
+  802224:	6a 02                	push   $0x2
+  802226:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  80222c:	e8 59 ed ff ff       	call   800f8a <sys_env_set_status>
+  802231:	83 c4 10             	add    $0x10,%esp
+  802234:	85 c0                	test   %eax,%eax
+  802236:	78 23                	js     80225b <spawn+0x5f7>
+	return child;
+  802238:	8b 85 0c fd ff ff    	mov    -0x2f4(%ebp),%eax
+  80223e:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  802244:	eb 4b                	jmp    802291 <spawn+0x62d>
+		panic("sys_env_set_trapframe: %e", r);
+  802246:	50                   	push   %eax
+  802247:	68 da 33 80 00       	push   $0x8033da
+  80224c:	68 ab 00 00 00       	push   $0xab
+  802251:	68 b1 33 80 00       	push   $0x8033b1
+  802256:	e8 3c df ff ff       	call   800197 <_panic>
+		panic("sys_env_set_status: %e", r);
+  80225b:	50                   	push   %eax
+  80225c:	68 f4 33 80 00       	push   $0x8033f4
+  802261:	68 ae 00 00 00       	push   $0xae
+  802266:	68 b1 33 80 00       	push   $0x8033b1
+  80226b:	e8 27 df ff ff       	call   800197 <_panic>
+  802270:	89 c7                	mov    %eax,%edi
+  802272:	e9 f6 fd ff ff       	jmp    80206d <spawn+0x409>
+  802277:	89 c7                	mov    %eax,%edi
+  802279:	e9 ef fd ff ff       	jmp    80206d <spawn+0x409>
+  80227e:	89 c7                	mov    %eax,%edi
+  802280:	e9 e8 fd ff ff       	jmp    80206d <spawn+0x409>
+		return r;
+  802285:	8b 85 0c fd ff ff    	mov    -0x2f4(%ebp),%eax
+  80228b:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+}
+  802291:	8b 85 10 fd ff ff    	mov    -0x2f0(%ebp),%eax
+  802297:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80229a:	5b                   	pop    %ebx
+  80229b:	5e                   	pop    %esi
+  80229c:	5f                   	pop    %edi
+  80229d:	5d                   	pop    %ebp
+  80229e:	c3                   	ret
+		return -E_NO_MEM;
+  80229f:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  8022a4:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  8022aa:	eb e5                	jmp    802291 <spawn+0x62d>
+	sys_page_unmap(0, UTEMP);
+  8022ac:	83 ec 08             	sub    $0x8,%esp
+  8022af:	68 00 00 40 00       	push   $0x400000
+  8022b4:	6a 00                	push   $0x0
+  8022b6:	e8 16 eb ff ff       	call   800dd1 <sys_page_unmap>
+  8022bb:	83 c4 10             	add    $0x10,%esp
+  8022be:	89 9d 10 fd ff ff    	mov    %ebx,-0x2f0(%ebp)
+  8022c4:	eb cb                	jmp    802291 <spawn+0x62d>
+
+008022c6 <spawnl>:
+{
+  8022c6:	55                   	push   %ebp
+  8022c7:	89 e5                	mov    %esp,%ebp
+  8022c9:	56                   	push   %esi
+  8022ca:	53                   	push   %ebx
+	va_start(vl, arg0);
+  8022cb:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  8022ce:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  8022d3:	eb 05                	jmp    8022da <spawnl+0x14>
+		argc++;
+  8022d5:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  8022d8:	89 ca                	mov    %ecx,%edx
+  8022da:	8d 4a 04             	lea    0x4(%edx),%ecx
+  8022dd:	83 3a 00             	cmpl   $0x0,(%edx)
+  8022e0:	75 f3                	jne    8022d5 <spawnl+0xf>
+	const char *argv[argc+2];
+  8022e2:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  8022e9:	83 e2 f0             	and    $0xfffffff0,%edx
+  8022ec:	29 d4                	sub    %edx,%esp
+  8022ee:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  8022f2:	89 da                	mov    %ebx,%edx
+  8022f4:	c1 ea 02             	shr    $0x2,%edx
+  8022f7:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  8022fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022fd:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  802304:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  80230b:	00 
+	va_start(vl, arg0);
+  80230c:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  80230f:	89 c2                	mov    %eax,%edx
+  802311:	b8 00 00 00 00       	mov    $0x0,%eax
+  802316:	eb 0b                	jmp    802323 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  802318:	83 c0 01             	add    $0x1,%eax
+  80231b:	8b 31                	mov    (%ecx),%esi
+  80231d:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802320:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  802323:	39 d0                	cmp    %edx,%eax
+  802325:	75 f1                	jne    802318 <spawnl+0x52>
+	return spawn(prog, argv);
+  802327:	83 ec 08             	sub    $0x8,%esp
+  80232a:	53                   	push   %ebx
+  80232b:	ff 75 08             	push   0x8(%ebp)
+  80232e:	e8 31 f9 ff ff       	call   801c64 <spawn>
+}
+  802333:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802336:	5b                   	pop    %ebx
+  802337:	5e                   	pop    %esi
+  802338:	5d                   	pop    %ebp
+  802339:	c3                   	ret
+
+0080233a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80233a:	55                   	push   %ebp
+  80233b:	89 e5                	mov    %esp,%ebp
+  80233d:	56                   	push   %esi
+  80233e:	53                   	push   %ebx
+  80233f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802342:	83 ec 0c             	sub    $0xc,%esp
+  802345:	ff 75 08             	push   0x8(%ebp)
+  802348:	e8 aa ef ff ff       	call   8012f7 <fd2data>
+  80234d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80234f:	83 c4 08             	add    $0x8,%esp
+  802352:	68 32 34 80 00       	push   $0x803432
+  802357:	53                   	push   %ebx
+  802358:	e8 fc e4 ff ff       	call   800859 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80235d:	8b 46 04             	mov    0x4(%esi),%eax
+  802360:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  802366:	2b 0e                	sub    (%esi),%ecx
+  802368:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80236d:	89 c8                	mov    %ecx,%eax
+  80236f:	f7 e2                	mul    %edx
+  802371:	c1 ea 0c             	shr    $0xc,%edx
+  802374:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80237a:	29 d1                	sub    %edx,%ecx
+  80237c:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  802382:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802389:	00 00 00 
+	stat->st_dev = &devpipe;
+  80238c:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  802393:	40 80 00 
+	return 0;
+}
+  802396:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80239e:	5b                   	pop    %ebx
+  80239f:	5e                   	pop    %esi
+  8023a0:	5d                   	pop    %ebp
+  8023a1:	c3                   	ret
+
+008023a2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8023a2:	55                   	push   %ebp
+  8023a3:	89 e5                	mov    %esp,%ebp
+  8023a5:	53                   	push   %ebx
+  8023a6:	83 ec 0c             	sub    $0xc,%esp
+  8023a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8023ac:	53                   	push   %ebx
+  8023ad:	6a 00                	push   $0x0
+  8023af:	e8 1d ea ff ff       	call   800dd1 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8023b4:	89 1c 24             	mov    %ebx,(%esp)
+  8023b7:	e8 3b ef ff ff       	call   8012f7 <fd2data>
+  8023bc:	83 c4 08             	add    $0x8,%esp
+  8023bf:	50                   	push   %eax
+  8023c0:	6a 00                	push   $0x0
+  8023c2:	e8 0a ea ff ff       	call   800dd1 <sys_page_unmap>
+}
+  8023c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023ca:	c9                   	leave
+  8023cb:	c3                   	ret
+
+008023cc <_pipeisclosed>:
+{
+  8023cc:	55                   	push   %ebp
+  8023cd:	89 e5                	mov    %esp,%ebp
+  8023cf:	57                   	push   %edi
+  8023d0:	56                   	push   %esi
+  8023d1:	53                   	push   %ebx
+  8023d2:	83 ec 1c             	sub    $0x1c,%esp
+  8023d5:	89 c7                	mov    %eax,%edi
+  8023d7:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8023d9:	a1 08 50 80 00       	mov    0x805008,%eax
+  8023de:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8023e1:	83 ec 0c             	sub    $0xc,%esp
+  8023e4:	57                   	push   %edi
+  8023e5:	e8 35 08 00 00       	call   802c1f <pageref>
+  8023ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8023ed:	89 34 24             	mov    %esi,(%esp)
+  8023f0:	e8 2a 08 00 00       	call   802c1f <pageref>
+		nn = thisenv->env_runs;
+  8023f5:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8023fb:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8023fe:	83 c4 10             	add    $0x10,%esp
+  802401:	39 cb                	cmp    %ecx,%ebx
+  802403:	74 1b                	je     802420 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802405:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802408:	75 cf                	jne    8023d9 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80240a:	8b 42 58             	mov    0x58(%edx),%eax
+  80240d:	6a 01                	push   $0x1
+  80240f:	50                   	push   %eax
+  802410:	53                   	push   %ebx
+  802411:	68 39 34 80 00       	push   $0x803439
+  802416:	e8 57 de ff ff       	call   800272 <cprintf>
+  80241b:	83 c4 10             	add    $0x10,%esp
+  80241e:	eb b9                	jmp    8023d9 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802420:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802423:	0f 94 c0             	sete   %al
+  802426:	0f b6 c0             	movzbl %al,%eax
+}
+  802429:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80242c:	5b                   	pop    %ebx
+  80242d:	5e                   	pop    %esi
+  80242e:	5f                   	pop    %edi
+  80242f:	5d                   	pop    %ebp
+  802430:	c3                   	ret
+
+00802431 <devpipe_read>:
+{
+  802431:	55                   	push   %ebp
+  802432:	89 e5                	mov    %esp,%ebp
+  802434:	57                   	push   %edi
+  802435:	56                   	push   %esi
+  802436:	53                   	push   %ebx
+  802437:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80243a:	ff 75 08             	push   0x8(%ebp)
+  80243d:	e8 b5 ee ff ff       	call   8012f7 <fd2data>
+  802442:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  802444:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  802447:	8d 40 04             	lea    0x4(%eax),%eax
+  80244a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80244d:	8b 7b 04             	mov    0x4(%ebx),%edi
+  802450:	8b 0b                	mov    (%ebx),%ecx
+  802452:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  802458:	29 ce                	sub    %ecx,%esi
+  80245a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80245f:	f7 e6                	mul    %esi
+  802461:	c1 ea 0c             	shr    $0xc,%edx
+  802464:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  80246a:	29 c6                	sub    %eax,%esi
+  80246c:	89 f2                	mov    %esi,%edx
+  80246e:	75 43                	jne    8024b3 <devpipe_read+0x82>
+		ref = pageref(p);
+  802470:	83 ec 0c             	sub    $0xc,%esp
+  802473:	53                   	push   %ebx
+  802474:	e8 a6 07 00 00       	call   802c1f <pageref>
+  802479:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  80247b:	89 da                	mov    %ebx,%edx
+  80247d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802480:	e8 47 ff ff ff       	call   8023cc <_pipeisclosed>
+  802485:	83 c4 10             	add    $0x10,%esp
+  802488:	85 c0                	test   %eax,%eax
+  80248a:	0f 85 c1 00 00 00    	jne    802551 <devpipe_read+0x120>
+	*sleeping = 1;
+  802490:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  802497:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80249c:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  80249f:	75 ac                	jne    80244d <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  8024a1:	83 ec 04             	sub    $0x4,%esp
+  8024a4:	56                   	push   %esi
+  8024a5:	57                   	push   %edi
+  8024a6:	ff 75 e4             	push   -0x1c(%ebp)
+  8024a9:	e8 77 ed ff ff       	call   801225 <sys_futex_wait>
+  8024ae:	83 c4 10             	add    $0x10,%esp
+  8024b1:	eb 9a                	jmp    80244d <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  8024b3:	39 75 10             	cmp    %esi,0x10(%ebp)
+  8024b6:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  8024ba:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8024bc:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8024c1:	f7 e1                	mul    %ecx
+  8024c3:	c1 ea 0b             	shr    $0xb,%edx
+  8024c6:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8024cc:	29 c1                	sub    %eax,%ecx
+  8024ce:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  8024d0:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8024d5:	29 cf                	sub    %ecx,%edi
+  8024d7:	39 f7                	cmp    %esi,%edi
+  8024d9:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  8024dc:	8d 43 10             	lea    0x10(%ebx),%eax
+  8024df:	83 ec 04             	sub    $0x4,%esp
+  8024e2:	57                   	push   %edi
+  8024e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024e6:	01 c2                	add    %eax,%edx
+  8024e8:	52                   	push   %edx
+  8024e9:	ff 75 0c             	push   0xc(%ebp)
+  8024ec:	e8 ee e4 ff ff       	call   8009df <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  8024f1:	83 c4 0c             	add    $0xc,%esp
+  8024f4:	89 f1                	mov    %esi,%ecx
+  8024f6:	29 f9                	sub    %edi,%ecx
+  8024f8:	51                   	push   %ecx
+  8024f9:	ff 75 e4             	push   -0x1c(%ebp)
+  8024fc:	89 f8                	mov    %edi,%eax
+  8024fe:	03 45 0c             	add    0xc(%ebp),%eax
+  802501:	50                   	push   %eax
+  802502:	e8 d8 e4 ff ff       	call   8009df <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  802507:	89 f1                	mov    %esi,%ecx
+  802509:	03 0b                	add    (%ebx),%ecx
+  80250b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802510:	f7 e1                	mul    %ecx
+  802512:	c1 ea 0c             	shr    $0xc,%edx
+  802515:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80251b:	29 d1                	sub    %edx,%ecx
+  80251d:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  80251f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802524:	83 c4 10             	add    $0x10,%esp
+  802527:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  80252b:	75 0a                	jne    802537 <devpipe_read+0x106>
+	return n;
+  80252d:	89 f0                	mov    %esi,%eax
+}
+  80252f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802532:	5b                   	pop    %ebx
+  802533:	5e                   	pop    %esi
+  802534:	5f                   	pop    %edi
+  802535:	5d                   	pop    %ebp
+  802536:	c3                   	ret
+		*sleeping = 0;
+  802537:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  80253e:	83 ec 08             	sub    $0x8,%esp
+  802541:	68 00 04 00 00       	push   $0x400
+  802546:	53                   	push   %ebx
+  802547:	e8 29 ed ff ff       	call   801275 <sys_futex_wake>
+  80254c:	83 c4 10             	add    $0x10,%esp
+  80254f:	eb dc                	jmp    80252d <devpipe_read+0xfc>
+			return 0;
+  802551:	b8 00 00 00 00       	mov    $0x0,%eax
+  802556:	eb d7                	jmp    80252f <devpipe_read+0xfe>
+
+00802558 <devpipe_write>:
+{
+  802558:	55                   	push   %ebp
+  802559:	89 e5                	mov    %esp,%ebp
+  80255b:	57                   	push   %edi
+  80255c:	56                   	push   %esi
+  80255d:	53                   	push   %ebx
+  80255e:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802561:	ff 75 08             	push   0x8(%ebp)
+  802564:	e8 8e ed ff ff       	call   8012f7 <fd2data>
+  802569:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  80256b:	83 c4 10             	add    $0x10,%esp
+  80256e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802575:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802578:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80257b:	0f 83 23 01 00 00    	jae    8026a4 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802581:	8b 77 04             	mov    0x4(%edi),%esi
+  802584:	8b 1f                	mov    (%edi),%ebx
+  802586:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  80258c:	29 d9                	sub    %ebx,%ecx
+  80258e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802593:	f7 e1                	mul    %ecx
+  802595:	c1 ea 0c             	shr    $0xc,%edx
+  802598:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80259e:	29 c1                	sub    %eax,%ecx
+  8025a0:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8025a2:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8025a8:	75 40                	jne    8025ea <devpipe_write+0x92>
+			ref = pageref(p);
+  8025aa:	83 ec 0c             	sub    $0xc,%esp
+  8025ad:	57                   	push   %edi
+  8025ae:	e8 6c 06 00 00       	call   802c1f <pageref>
+  8025b3:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  8025b5:	89 fa                	mov    %edi,%edx
+  8025b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ba:	e8 0d fe ff ff       	call   8023cc <_pipeisclosed>
+  8025bf:	83 c4 10             	add    $0x10,%esp
+  8025c2:	85 c0                	test   %eax,%eax
+  8025c4:	0f 85 d5 00 00 00    	jne    80269f <devpipe_write+0x147>
+	*sleeping = 1;
+  8025ca:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  8025d1:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8025d6:	39 1f                	cmp    %ebx,(%edi)
+  8025d8:	75 a7                	jne    802581 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  8025da:	83 ec 04             	sub    $0x4,%esp
+  8025dd:	56                   	push   %esi
+  8025de:	53                   	push   %ebx
+  8025df:	57                   	push   %edi
+  8025e0:	e8 40 ec ff ff       	call   801225 <sys_futex_wait>
+  8025e5:	83 c4 10             	add    $0x10,%esp
+  8025e8:	eb 97                	jmp    802581 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8025ea:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8025ed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025f0:	29 c1                	sub    %eax,%ecx
+  8025f2:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8025f7:	89 d8                	mov    %ebx,%eax
+  8025f9:	29 d0                	sub    %edx,%eax
+  8025fb:	39 c1                	cmp    %eax,%ecx
+  8025fd:	0f 46 c1             	cmovbe %ecx,%eax
+  802600:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  802602:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802607:	f7 e6                	mul    %esi
+  802609:	c1 ea 0b             	shr    $0xb,%edx
+  80260c:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802612:	29 c6                	sub    %eax,%esi
+  802614:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802616:	29 f3                	sub    %esi,%ebx
+  802618:	39 cb                	cmp    %ecx,%ebx
+  80261a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80261d:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  802620:	8d 77 10             	lea    0x10(%edi),%esi
+  802623:	83 ec 04             	sub    $0x4,%esp
+  802626:	53                   	push   %ebx
+  802627:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80262a:	03 45 0c             	add    0xc(%ebp),%eax
+  80262d:	50                   	push   %eax
+  80262e:	01 f2                	add    %esi,%edx
+  802630:	52                   	push   %edx
+  802631:	e8 a9 e3 ff ff       	call   8009df <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802636:	83 c4 0c             	add    $0xc,%esp
+  802639:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80263c:	29 d8                	sub    %ebx,%eax
+  80263e:	50                   	push   %eax
+  80263f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802642:	01 d3                	add    %edx,%ebx
+  802644:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802647:	53                   	push   %ebx
+  802648:	56                   	push   %esi
+  802649:	e8 91 e3 ff ff       	call   8009df <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  80264e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802651:	03 4f 04             	add    0x4(%edi),%ecx
+  802654:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802659:	f7 e1                	mul    %ecx
+  80265b:	c1 ea 0c             	shr    $0xc,%edx
+  80265e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802664:	29 d1                	sub    %edx,%ecx
+  802666:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  802669:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80266e:	83 c4 10             	add    $0x10,%esp
+  802671:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802675:	75 0b                	jne    802682 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802677:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  80267a:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80267d:	e9 f3 fe ff ff       	jmp    802575 <devpipe_write+0x1d>
+		*sleeping = 0;
+  802682:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  802689:	83 ec 08             	sub    $0x8,%esp
+  80268c:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802691:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802694:	50                   	push   %eax
+  802695:	e8 db eb ff ff       	call   801275 <sys_futex_wake>
+  80269a:	83 c4 10             	add    $0x10,%esp
+  80269d:	eb d8                	jmp    802677 <devpipe_write+0x11f>
+				return 0;
+  80269f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026a7:	5b                   	pop    %ebx
+  8026a8:	5e                   	pop    %esi
+  8026a9:	5f                   	pop    %edi
+  8026aa:	5d                   	pop    %ebp
+  8026ab:	c3                   	ret
+
+008026ac <pipe>:
+{
+  8026ac:	55                   	push   %ebp
+  8026ad:	89 e5                	mov    %esp,%ebp
+  8026af:	56                   	push   %esi
+  8026b0:	53                   	push   %ebx
+  8026b1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026b7:	50                   	push   %eax
+  8026b8:	e8 51 ec ff ff       	call   80130e <fd_alloc>
+  8026bd:	89 c3                	mov    %eax,%ebx
+  8026bf:	83 c4 10             	add    $0x10,%esp
+  8026c2:	85 c0                	test   %eax,%eax
+  8026c4:	0f 88 23 01 00 00    	js     8027ed <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026ca:	83 ec 04             	sub    $0x4,%esp
+  8026cd:	68 07 04 00 00       	push   $0x407
+  8026d2:	ff 75 f4             	push   -0xc(%ebp)
+  8026d5:	6a 00                	push   $0x0
+  8026d7:	e8 70 e6 ff ff       	call   800d4c <sys_page_alloc>
+  8026dc:	89 c3                	mov    %eax,%ebx
+  8026de:	83 c4 10             	add    $0x10,%esp
+  8026e1:	85 c0                	test   %eax,%eax
+  8026e3:	0f 88 04 01 00 00    	js     8027ed <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026e9:	83 ec 0c             	sub    $0xc,%esp
+  8026ec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026ef:	50                   	push   %eax
+  8026f0:	e8 19 ec ff ff       	call   80130e <fd_alloc>
+  8026f5:	89 c3                	mov    %eax,%ebx
+  8026f7:	83 c4 10             	add    $0x10,%esp
+  8026fa:	85 c0                	test   %eax,%eax
+  8026fc:	0f 88 db 00 00 00    	js     8027dd <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802702:	83 ec 04             	sub    $0x4,%esp
+  802705:	68 07 04 00 00       	push   $0x407
+  80270a:	ff 75 f0             	push   -0x10(%ebp)
+  80270d:	6a 00                	push   $0x0
+  80270f:	e8 38 e6 ff ff       	call   800d4c <sys_page_alloc>
+  802714:	89 c3                	mov    %eax,%ebx
+  802716:	83 c4 10             	add    $0x10,%esp
+  802719:	85 c0                	test   %eax,%eax
+  80271b:	0f 88 bc 00 00 00    	js     8027dd <pipe+0x131>
+	va = fd2data(fd0);
+  802721:	83 ec 0c             	sub    $0xc,%esp
+  802724:	ff 75 f4             	push   -0xc(%ebp)
+  802727:	e8 cb eb ff ff       	call   8012f7 <fd2data>
+  80272c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80272e:	83 c4 0c             	add    $0xc,%esp
+  802731:	68 07 04 00 00       	push   $0x407
+  802736:	50                   	push   %eax
+  802737:	6a 00                	push   $0x0
+  802739:	e8 0e e6 ff ff       	call   800d4c <sys_page_alloc>
+  80273e:	89 c3                	mov    %eax,%ebx
+  802740:	83 c4 10             	add    $0x10,%esp
+  802743:	85 c0                	test   %eax,%eax
+  802745:	0f 88 82 00 00 00    	js     8027cd <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80274b:	83 ec 0c             	sub    $0xc,%esp
+  80274e:	ff 75 f0             	push   -0x10(%ebp)
+  802751:	e8 a1 eb ff ff       	call   8012f7 <fd2data>
+  802756:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80275d:	50                   	push   %eax
+  80275e:	6a 00                	push   $0x0
+  802760:	56                   	push   %esi
+  802761:	6a 00                	push   $0x0
+  802763:	e8 27 e6 ff ff       	call   800d8f <sys_page_map>
+  802768:	89 c3                	mov    %eax,%ebx
+  80276a:	83 c4 20             	add    $0x20,%esp
+  80276d:	85 c0                	test   %eax,%eax
+  80276f:	78 4e                	js     8027bf <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802771:	a1 20 40 80 00       	mov    0x804020,%eax
+  802776:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802779:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80277b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80277e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802785:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802788:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80278a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80278d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802794:	83 ec 0c             	sub    $0xc,%esp
+  802797:	ff 75 f4             	push   -0xc(%ebp)
+  80279a:	e8 48 eb ff ff       	call   8012e7 <fd2num>
+  80279f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027a2:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8027a4:	83 c4 04             	add    $0x4,%esp
+  8027a7:	ff 75 f0             	push   -0x10(%ebp)
+  8027aa:	e8 38 eb ff ff       	call   8012e7 <fd2num>
+  8027af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027b2:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027b5:	83 c4 10             	add    $0x10,%esp
+  8027b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027bd:	eb 2e                	jmp    8027ed <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027bf:	83 ec 08             	sub    $0x8,%esp
+  8027c2:	56                   	push   %esi
+  8027c3:	6a 00                	push   $0x0
+  8027c5:	e8 07 e6 ff ff       	call   800dd1 <sys_page_unmap>
+  8027ca:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027cd:	83 ec 08             	sub    $0x8,%esp
+  8027d0:	ff 75 f0             	push   -0x10(%ebp)
+  8027d3:	6a 00                	push   $0x0
+  8027d5:	e8 f7 e5 ff ff       	call   800dd1 <sys_page_unmap>
+  8027da:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027dd:	83 ec 08             	sub    $0x8,%esp
+  8027e0:	ff 75 f4             	push   -0xc(%ebp)
+  8027e3:	6a 00                	push   $0x0
+  8027e5:	e8 e7 e5 ff ff       	call   800dd1 <sys_page_unmap>
+  8027ea:	83 c4 10             	add    $0x10,%esp
+}
+  8027ed:	89 d8                	mov    %ebx,%eax
+  8027ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027f2:	5b                   	pop    %ebx
+  8027f3:	5e                   	pop    %esi
+  8027f4:	5d                   	pop    %ebp
+  8027f5:	c3                   	ret
+
+008027f6 <pipeisclosed>:
+{
+  8027f6:	55                   	push   %ebp
+  8027f7:	89 e5                	mov    %esp,%ebp
+  8027f9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027ff:	50                   	push   %eax
+  802800:	ff 75 08             	push   0x8(%ebp)
+  802803:	e8 5a eb ff ff       	call   801362 <fd_lookup>
+  802808:	83 c4 10             	add    $0x10,%esp
+  80280b:	85 c0                	test   %eax,%eax
+  80280d:	78 18                	js     802827 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80280f:	83 ec 0c             	sub    $0xc,%esp
+  802812:	ff 75 f4             	push   -0xc(%ebp)
+  802815:	e8 dd ea ff ff       	call   8012f7 <fd2data>
+  80281a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80281c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80281f:	e8 a8 fb ff ff       	call   8023cc <_pipeisclosed>
+  802824:	83 c4 10             	add    $0x10,%esp
+}
+  802827:	c9                   	leave
+  802828:	c3                   	ret
+
+00802829 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802829:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282e:	c3                   	ret
+
+0080282f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80282f:	55                   	push   %ebp
+  802830:	89 e5                	mov    %esp,%ebp
+  802832:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802835:	68 51 34 80 00       	push   $0x803451
+  80283a:	ff 75 0c             	push   0xc(%ebp)
+  80283d:	e8 17 e0 ff ff       	call   800859 <strcpy>
+	return 0;
+}
+  802842:	b8 00 00 00 00       	mov    $0x0,%eax
+  802847:	c9                   	leave
+  802848:	c3                   	ret
+
+00802849 <devcons_write>:
+{
+  802849:	55                   	push   %ebp
+  80284a:	89 e5                	mov    %esp,%ebp
+  80284c:	57                   	push   %edi
+  80284d:	56                   	push   %esi
+  80284e:	53                   	push   %ebx
+  80284f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802855:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80285a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802860:	eb 2e                	jmp    802890 <devcons_write+0x47>
+		m = n - tot;
+  802862:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802865:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802867:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80286c:	39 c3                	cmp    %eax,%ebx
+  80286e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802871:	83 ec 04             	sub    $0x4,%esp
+  802874:	53                   	push   %ebx
+  802875:	89 f0                	mov    %esi,%eax
+  802877:	03 45 0c             	add    0xc(%ebp),%eax
+  80287a:	50                   	push   %eax
+  80287b:	57                   	push   %edi
+  80287c:	e8 5e e1 ff ff       	call   8009df <memmove>
+		sys_cputs(buf, m);
+  802881:	83 c4 08             	add    $0x8,%esp
+  802884:	53                   	push   %ebx
+  802885:	57                   	push   %edi
+  802886:	e8 f4 e3 ff ff       	call   800c7f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80288b:	01 de                	add    %ebx,%esi
+  80288d:	83 c4 10             	add    $0x10,%esp
+  802890:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802893:	72 cd                	jb     802862 <devcons_write+0x19>
+}
+  802895:	89 f0                	mov    %esi,%eax
+  802897:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80289a:	5b                   	pop    %ebx
+  80289b:	5e                   	pop    %esi
+  80289c:	5f                   	pop    %edi
+  80289d:	5d                   	pop    %ebp
+  80289e:	c3                   	ret
+
+0080289f <devcons_read>:
+{
+  80289f:	55                   	push   %ebp
+  8028a0:	89 e5                	mov    %esp,%ebp
+  8028a2:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8028a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028aa:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028ae:	75 07                	jne    8028b7 <devcons_read+0x18>
+  8028b0:	eb 1f                	jmp    8028d1 <devcons_read+0x32>
+		sys_yield();
+  8028b2:	e8 76 e4 ff ff       	call   800d2d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8028b7:	e8 f2 e3 ff ff       	call   800cae <sys_cgetc>
+  8028bc:	85 c0                	test   %eax,%eax
+  8028be:	74 f2                	je     8028b2 <devcons_read+0x13>
+	if (c < 0)
+  8028c0:	78 0f                	js     8028d1 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8028c2:	83 f8 04             	cmp    $0x4,%eax
+  8028c5:	74 0c                	je     8028d3 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8028c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028ca:	88 02                	mov    %al,(%edx)
+	return 1;
+  8028cc:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8028d1:	c9                   	leave
+  8028d2:	c3                   	ret
+		return 0;
+  8028d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d8:	eb f7                	jmp    8028d1 <devcons_read+0x32>
+
+008028da <cputchar>:
+{
+  8028da:	55                   	push   %ebp
+  8028db:	89 e5                	mov    %esp,%ebp
+  8028dd:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8028e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e3:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8028e6:	6a 01                	push   $0x1
+  8028e8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028eb:	50                   	push   %eax
+  8028ec:	e8 8e e3 ff ff       	call   800c7f <sys_cputs>
+}
+  8028f1:	83 c4 10             	add    $0x10,%esp
+  8028f4:	c9                   	leave
+  8028f5:	c3                   	ret
+
+008028f6 <getchar>:
+{
+  8028f6:	55                   	push   %ebp
+  8028f7:	89 e5                	mov    %esp,%ebp
+  8028f9:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8028fc:	6a 01                	push   $0x1
+  8028fe:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802901:	50                   	push   %eax
+  802902:	6a 00                	push   $0x0
+  802904:	e8 b8 ec ff ff       	call   8015c1 <read>
+	if (r < 0)
+  802909:	83 c4 10             	add    $0x10,%esp
+  80290c:	85 c0                	test   %eax,%eax
+  80290e:	78 06                	js     802916 <getchar+0x20>
+	if (r < 1)
+  802910:	74 06                	je     802918 <getchar+0x22>
+	return c;
+  802912:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802916:	c9                   	leave
+  802917:	c3                   	ret
+		return -E_EOF;
+  802918:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80291d:	eb f7                	jmp    802916 <getchar+0x20>
+
+0080291f <iscons>:
+{
+  80291f:	55                   	push   %ebp
+  802920:	89 e5                	mov    %esp,%ebp
+  802922:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802925:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802928:	50                   	push   %eax
+  802929:	ff 75 08             	push   0x8(%ebp)
+  80292c:	e8 31 ea ff ff       	call   801362 <fd_lookup>
+  802931:	83 c4 10             	add    $0x10,%esp
+  802934:	85 c0                	test   %eax,%eax
+  802936:	78 11                	js     802949 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802938:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80293b:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802941:	39 10                	cmp    %edx,(%eax)
+  802943:	0f 94 c0             	sete   %al
+  802946:	0f b6 c0             	movzbl %al,%eax
+}
+  802949:	c9                   	leave
+  80294a:	c3                   	ret
+
+0080294b <opencons>:
+{
+  80294b:	55                   	push   %ebp
+  80294c:	89 e5                	mov    %esp,%ebp
+  80294e:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802951:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802954:	50                   	push   %eax
+  802955:	e8 b4 e9 ff ff       	call   80130e <fd_alloc>
+  80295a:	83 c4 10             	add    $0x10,%esp
+  80295d:	85 c0                	test   %eax,%eax
+  80295f:	78 3a                	js     80299b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802961:	83 ec 04             	sub    $0x4,%esp
+  802964:	68 07 04 00 00       	push   $0x407
+  802969:	ff 75 f4             	push   -0xc(%ebp)
+  80296c:	6a 00                	push   $0x0
+  80296e:	e8 d9 e3 ff ff       	call   800d4c <sys_page_alloc>
+  802973:	83 c4 10             	add    $0x10,%esp
+  802976:	85 c0                	test   %eax,%eax
+  802978:	78 21                	js     80299b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80297a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80297d:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802983:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802985:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802988:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80298f:	83 ec 0c             	sub    $0xc,%esp
+  802992:	50                   	push   %eax
+  802993:	e8 4f e9 ff ff       	call   8012e7 <fd2num>
+  802998:	83 c4 10             	add    $0x10,%esp
+}
+  80299b:	c9                   	leave
+  80299c:	c3                   	ret
+
+0080299d <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  80299d:	55                   	push   %ebp
+  80299e:	89 e5                	mov    %esp,%ebp
+  8029a0:	57                   	push   %edi
+  8029a1:	56                   	push   %esi
+  8029a2:	53                   	push   %ebx
+  8029a3:	83 ec 14             	sub    $0x14,%esp
+  8029a6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8029a9:	8b 75 14             	mov    0x14(%ebp),%esi
+  8029ac:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8029af:	ff 75 10             	push   0x10(%ebp)
+  8029b2:	ff 75 0c             	push   0xc(%ebp)
+  8029b5:	e8 b5 e7 ff ff       	call   80116f <sys_ipc_recv_pages>
+  8029ba:	83 c4 10             	add    $0x10,%esp
+  8029bd:	85 c0                	test   %eax,%eax
+  8029bf:	78 46                	js     802a07 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8029c1:	85 ff                	test   %edi,%edi
+  8029c3:	74 0d                	je     8029d2 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  8029c5:	a1 08 50 80 00       	mov    0x805008,%eax
+  8029ca:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8029d0:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8029d2:	85 f6                	test   %esi,%esi
+  8029d4:	74 0d                	je     8029e3 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  8029d6:	a1 08 50 80 00       	mov    0x805008,%eax
+  8029db:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8029e1:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8029e3:	85 db                	test   %ebx,%ebx
+  8029e5:	74 0d                	je     8029f4 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  8029e7:	a1 08 50 80 00       	mov    0x805008,%eax
+  8029ec:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8029f2:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8029f4:	a1 08 50 80 00       	mov    0x805008,%eax
+  8029f9:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8029ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a02:	5b                   	pop    %ebx
+  802a03:	5e                   	pop    %esi
+  802a04:	5f                   	pop    %edi
+  802a05:	5d                   	pop    %ebp
+  802a06:	c3                   	ret
+		if (from_env_store) {
+  802a07:	85 ff                	test   %edi,%edi
+  802a09:	74 06                	je     802a11 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  802a0b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802a11:	85 f6                	test   %esi,%esi
+  802a13:	74 06                	je     802a1b <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  802a15:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802a1b:	85 db                	test   %ebx,%ebx
+  802a1d:	74 e0                	je     8029ff <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  802a1f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a25:	eb d8                	jmp    8029ff <ipc_recv_pages+0x62>
+
+00802a27 <ipc_recv>:
+{
+  802a27:	55                   	push   %ebp
+  802a28:	89 e5                	mov    %esp,%ebp
+  802a2a:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  802a2d:	6a 00                	push   $0x0
+  802a2f:	ff 75 10             	push   0x10(%ebp)
+  802a32:	6a 01                	push   $0x1
+  802a34:	ff 75 0c             	push   0xc(%ebp)
+  802a37:	ff 75 08             	push   0x8(%ebp)
+  802a3a:	e8 5e ff ff ff       	call   80299d <ipc_recv_pages>
+}
+  802a3f:	c9                   	leave
+  802a40:	c3                   	ret
+
+00802a41 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802a41:	55                   	push   %ebp
+  802a42:	89 e5                	mov    %esp,%ebp
+  802a44:	56                   	push   %esi
+  802a45:	53                   	push   %ebx
+  802a46:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  802a4c:	83 ec 0c             	sub    $0xc,%esp
+  802a4f:	ff 75 0c             	push   0xc(%ebp)
+  802a52:	e8 4c e8 ff ff       	call   8012a3 <sys_ipc_try_recv>
+  802a57:	83 c4 10             	add    $0x10,%esp
+  802a5a:	85 c0                	test   %eax,%eax
+  802a5c:	78 34                	js     802a92 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802a5e:	85 f6                	test   %esi,%esi
+  802a60:	74 0d                	je     802a6f <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  802a62:	a1 08 50 80 00       	mov    0x805008,%eax
+  802a67:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802a6d:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  802a6f:	85 db                	test   %ebx,%ebx
+  802a71:	74 0d                	je     802a80 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  802a73:	a1 08 50 80 00       	mov    0x805008,%eax
+  802a78:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802a7e:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802a80:	a1 08 50 80 00       	mov    0x805008,%eax
+  802a85:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802a8b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a8e:	5b                   	pop    %ebx
+  802a8f:	5e                   	pop    %esi
+  802a90:	5d                   	pop    %ebp
+  802a91:	c3                   	ret
+		if (from_env_store) {
+  802a92:	85 f6                	test   %esi,%esi
+  802a94:	74 06                	je     802a9c <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  802a96:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  802a9c:	85 db                	test   %ebx,%ebx
+  802a9e:	74 eb                	je     802a8b <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  802aa0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802aa6:	eb e3                	jmp    802a8b <ipc_try_recv+0x4a>
+
+00802aa8 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802aa8:	55                   	push   %ebp
+  802aa9:	89 e5                	mov    %esp,%ebp
+  802aab:	83 ec 14             	sub    $0x14,%esp
+  802aae:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802ab1:	85 c0                	test   %eax,%eax
+  802ab3:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802ab8:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802abb:	ff 75 18             	push   0x18(%ebp)
+  802abe:	ff 75 14             	push   0x14(%ebp)
+  802ac1:	50                   	push   %eax
+  802ac2:	ff 75 0c             	push   0xc(%ebp)
+  802ac5:	ff 75 08             	push   0x8(%ebp)
+  802ac8:	e8 65 e6 ff ff       	call   801132 <sys_ipc_send_pages>
+  802acd:	83 c4 20             	add    $0x20,%esp
+  802ad0:	85 c0                	test   %eax,%eax
+  802ad2:	78 02                	js     802ad6 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  802ad4:	c9                   	leave
+  802ad5:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  802ad6:	50                   	push   %eax
+  802ad7:	68 60 34 80 00       	push   $0x803460
+  802adc:	68 80 00 00 00       	push   $0x80
+  802ae1:	68 8c 34 80 00       	push   $0x80348c
+  802ae6:	e8 ac d6 ff ff       	call   800197 <_panic>
+
+00802aeb <ipc_send>:
+{
+  802aeb:	55                   	push   %ebp
+  802aec:	89 e5                	mov    %esp,%ebp
+  802aee:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  802af1:	ff 75 14             	push   0x14(%ebp)
+  802af4:	6a 01                	push   $0x1
+  802af6:	ff 75 10             	push   0x10(%ebp)
+  802af9:	ff 75 0c             	push   0xc(%ebp)
+  802afc:	ff 75 08             	push   0x8(%ebp)
+  802aff:	e8 a4 ff ff ff       	call   802aa8 <ipc_send_pages>
+}
+  802b04:	83 c4 20             	add    $0x20,%esp
+  802b07:	c9                   	leave
+  802b08:	c3                   	ret
+
+00802b09 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802b09:	55                   	push   %ebp
+  802b0a:	89 e5                	mov    %esp,%ebp
+  802b0c:	83 ec 14             	sub    $0x14,%esp
+  802b0f:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802b12:	85 c0                	test   %eax,%eax
+  802b14:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802b19:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802b1c:	ff 75 18             	push   0x18(%ebp)
+  802b1f:	ff 75 14             	push   0x14(%ebp)
+  802b22:	50                   	push   %eax
+  802b23:	ff 75 0c             	push   0xc(%ebp)
+  802b26:	ff 75 08             	push   0x8(%ebp)
+  802b29:	e8 95 e6 ff ff       	call   8011c3 <sys_ipc_call>
+  802b2e:	83 c4 20             	add    $0x20,%esp
+  802b31:	85 c0                	test   %eax,%eax
+  802b33:	78 0b                	js     802b40 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  802b35:	a1 08 50 80 00       	mov    0x805008,%eax
+  802b3a:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802b40:	c9                   	leave
+  802b41:	c3                   	ret
+
+00802b42 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  802b42:	55                   	push   %ebp
+  802b43:	89 e5                	mov    %esp,%ebp
+  802b45:	57                   	push   %edi
+  802b46:	56                   	push   %esi
+  802b47:	53                   	push   %ebx
+  802b48:	83 ec 18             	sub    $0x18,%esp
+  802b4b:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b4e:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  802b51:	8b 75 20             	mov    0x20(%ebp),%esi
+  802b54:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802b57:	85 c0                	test   %eax,%eax
+  802b59:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802b5e:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802b61:	ff 75 18             	push   0x18(%ebp)
+  802b64:	ff 75 14             	push   0x14(%ebp)
+  802b67:	50                   	push   %eax
+  802b68:	ff 75 0c             	push   0xc(%ebp)
+  802b6b:	ff 75 08             	push   0x8(%ebp)
+  802b6e:	e8 91 e6 ff ff       	call   801204 <sys_ipc_reply_recv>
+  802b73:	83 c4 20             	add    $0x20,%esp
+  802b76:	85 c0                	test   %eax,%eax
+  802b78:	78 46                	js     802bc0 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802b7a:	85 ff                	test   %edi,%edi
+  802b7c:	74 0d                	je     802b8b <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  802b7e:	a1 08 50 80 00       	mov    0x805008,%eax
+  802b83:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802b89:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802b8b:	85 f6                	test   %esi,%esi
+  802b8d:	74 0d                	je     802b9c <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  802b8f:	a1 08 50 80 00       	mov    0x805008,%eax
+  802b94:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802b9a:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802b9c:	85 db                	test   %ebx,%ebx
+  802b9e:	74 0d                	je     802bad <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  802ba0:	a1 08 50 80 00       	mov    0x805008,%eax
+  802ba5:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802bab:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802bad:	a1 08 50 80 00       	mov    0x805008,%eax
+  802bb2:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802bb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bbb:	5b                   	pop    %ebx
+  802bbc:	5e                   	pop    %esi
+  802bbd:	5f                   	pop    %edi
+  802bbe:	5d                   	pop    %ebp
+  802bbf:	c3                   	ret
+		if (from_env_store) {
+  802bc0:	85 ff                	test   %edi,%edi
+  802bc2:	74 06                	je     802bca <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  802bc4:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802bca:	85 f6                	test   %esi,%esi
+  802bcc:	74 06                	je     802bd4 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  802bce:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802bd4:	85 db                	test   %ebx,%ebx
+  802bd6:	74 e0                	je     802bb8 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  802bd8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802bde:	eb d8                	jmp    802bb8 <ipc_reply_recv+0x76>
+
+00802be0 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802be0:	55                   	push   %ebp
+  802be1:	89 e5                	mov    %esp,%ebp
+  802be3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802be6:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  802beb:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802bee:	c1 e0 06             	shl    $0x6,%eax
+  802bf1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bf6:	8b 40 50             	mov    0x50(%eax),%eax
+  802bf9:	39 c8                	cmp    %ecx,%eax
+  802bfb:	74 12                	je     802c0f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802bfd:	83 c2 01             	add    $0x1,%edx
+  802c00:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802c06:	75 e3                	jne    802beb <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802c08:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0d:	eb 0e                	jmp    802c1d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802c0f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802c12:	c1 e0 06             	shl    $0x6,%eax
+  802c15:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c1a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802c1d:	5d                   	pop    %ebp
+  802c1e:	c3                   	ret
+
+00802c1f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802c1f:	55                   	push   %ebp
+  802c20:	89 e5                	mov    %esp,%ebp
+  802c22:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802c25:	89 c2                	mov    %eax,%edx
+  802c27:	c1 ea 16             	shr    $0x16,%edx
+  802c2a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802c31:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802c36:	f6 c1 01             	test   $0x1,%cl
+  802c39:	74 1e                	je     802c59 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  802c3b:	c1 e8 0c             	shr    $0xc,%eax
+  802c3e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802c45:	a8 01                	test   $0x1,%al
+  802c47:	74 10                	je     802c59 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802c49:	c1 e8 0c             	shr    $0xc,%eax
+  802c4c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802c4f:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  802c56:	0f b7 d2             	movzwl %dx,%edx
+}
+  802c59:	89 d0                	mov    %edx,%eax
+  802c5b:	5d                   	pop    %ebp
+  802c5c:	c3                   	ret
+
+00802c5d <udivmod>:
+  802c5d:	55                   	push   %ebp
+  802c5e:	57                   	push   %edi
+  802c5f:	56                   	push   %esi
+  802c60:	53                   	push   %ebx
+  802c61:	83 ec 24             	sub    $0x24,%esp
+  802c64:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802c68:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802c6c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802c70:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802c74:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802c78:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802c7c:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802c80:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c85:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c8f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802c96:	00 
+  802c97:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802c9e:	00 
+  802c9f:	89 fb                	mov    %edi,%ebx
+  802ca1:	eb 08                	jmp    802cab <udivmod+0x4e>
+  802ca3:	83 e9 01             	sub    $0x1,%ecx
+  802ca6:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802ca9:	74 68                	je     802d13 <udivmod+0xb6>
+  802cab:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802caf:	01 c0                	add    %eax,%eax
+  802cb1:	89 c6                	mov    %eax,%esi
+  802cb3:	89 d7                	mov    %edx,%edi
+  802cb5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802cb9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802cbd:	0f ad d0             	shrd   %cl,%edx,%eax
+  802cc0:	d3 ea                	shr    %cl,%edx
+  802cc2:	f6 c1 20             	test   $0x20,%cl
+  802cc5:	74 04                	je     802ccb <udivmod+0x6e>
+  802cc7:	89 d0                	mov    %edx,%eax
+  802cc9:	31 d2                	xor    %edx,%edx
+  802ccb:	83 e0 01             	and    $0x1,%eax
+  802cce:	89 04 24             	mov    %eax,(%esp)
+  802cd1:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802cd8:	00 
+  802cd9:	8b 04 24             	mov    (%esp),%eax
+  802cdc:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802ce0:	09 f0                	or     %esi,%eax
+  802ce2:	09 fa                	or     %edi,%edx
+  802ce4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802ce8:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802cec:	39 f0                	cmp    %esi,%eax
+  802cee:	89 d5                	mov    %edx,%ebp
+  802cf0:	19 fd                	sbb    %edi,%ebp
+  802cf2:	72 af                	jb     802ca3 <udivmod+0x46>
+  802cf4:	29 f0                	sub    %esi,%eax
+  802cf6:	19 fa                	sbb    %edi,%edx
+  802cf8:	89 cf                	mov    %ecx,%edi
+  802cfa:	c1 ef 05             	shr    $0x5,%edi
+  802cfd:	83 e7 01             	and    $0x1,%edi
+  802d00:	89 fe                	mov    %edi,%esi
+  802d02:	83 f6 01             	xor    $0x1,%esi
+  802d05:	d3 e6                	shl    %cl,%esi
+  802d07:	d3 e7                	shl    %cl,%edi
+  802d09:	09 74 24 18          	or     %esi,0x18(%esp)
+  802d0d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802d11:	eb 90                	jmp    802ca3 <udivmod+0x46>
+  802d13:	85 db                	test   %ebx,%ebx
+  802d15:	74 05                	je     802d1c <udivmod+0xbf>
+  802d17:	89 03                	mov    %eax,(%ebx)
+  802d19:	89 53 04             	mov    %edx,0x4(%ebx)
+  802d1c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d20:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d24:	83 c4 24             	add    $0x24,%esp
+  802d27:	5b                   	pop    %ebx
+  802d28:	5e                   	pop    %esi
+  802d29:	5f                   	pop    %edi
+  802d2a:	5d                   	pop    %ebp
+  802d2b:	c3                   	ret
+
+00802d2c <__udivdi3>:
+  802d2c:	83 ec 08             	sub    $0x8,%esp
+  802d2f:	6a 00                	push   $0x0
+  802d31:	ff 74 24 1c          	push   0x1c(%esp)
+  802d35:	ff 74 24 1c          	push   0x1c(%esp)
+  802d39:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d3d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d41:	e8 17 ff ff ff       	call   802c5d <udivmod>
+  802d46:	83 c4 14             	add    $0x14,%esp
+  802d49:	c3                   	ret
+
+00802d4a <__umoddi3>:
+  802d4a:	83 ec 18             	sub    $0x18,%esp
+  802d4d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d51:	50                   	push   %eax
+  802d52:	ff 74 24 2c          	push   0x2c(%esp)
+  802d56:	ff 74 24 2c          	push   0x2c(%esp)
+  802d5a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d5e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d62:	e8 f6 fe ff ff       	call   802c5d <udivmod>
+  802d67:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d6b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d6f:	83 c4 24             	add    $0x24,%esp
+  802d72:	c3                   	ret
+
+00802d73 <__divdi3>:
+  802d73:	55                   	push   %ebp
+  802d74:	57                   	push   %edi
+  802d75:	56                   	push   %esi
+  802d76:	53                   	push   %ebx
+  802d77:	83 ec 10             	sub    $0x10,%esp
+  802d7a:	8b 44 24 24          	mov    0x24(%esp),%eax
+  802d7e:	8b 54 24 28          	mov    0x28(%esp),%edx
+  802d82:	89 c6                	mov    %eax,%esi
+  802d84:	89 d7                	mov    %edx,%edi
+  802d86:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  802d8a:	33 7c 24 30          	xor    0x30(%esp),%edi
+  802d8e:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802d92:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  802d96:	89 c5                	mov    %eax,%ebp
+  802d98:	f7 dd                	neg    %ebp
+  802d9a:	89 d6                	mov    %edx,%esi
+  802d9c:	83 d6 00             	adc    $0x0,%esi
+  802d9f:	f7 de                	neg    %esi
+  802da1:	0f 48 e8             	cmovs  %eax,%ebp
+  802da4:	0f 49 d6             	cmovns %esi,%edx
+  802da7:	6a 00                	push   $0x0
+  802da9:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802dad:	f7 de                	neg    %esi
+  802daf:	8b 44 24 34          	mov    0x34(%esp),%eax
+  802db3:	83 d0 00             	adc    $0x0,%eax
+  802db6:	f7 d8                	neg    %eax
+  802db8:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  802dbd:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  802dc2:	50                   	push   %eax
+  802dc3:	56                   	push   %esi
+  802dc4:	89 e8                	mov    %ebp,%eax
+  802dc6:	e8 92 fe ff ff       	call   802c5d <udivmod>
+  802dcb:	83 c4 10             	add    $0x10,%esp
+  802dce:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  802dd3:	78 08                	js     802ddd <__divdi3+0x6a>
+  802dd5:	83 c4 0c             	add    $0xc,%esp
+  802dd8:	5b                   	pop    %ebx
+  802dd9:	5e                   	pop    %esi
+  802dda:	5f                   	pop    %edi
+  802ddb:	5d                   	pop    %ebp
+  802ddc:	c3                   	ret
+  802ddd:	f7 d8                	neg    %eax
+  802ddf:	83 d2 00             	adc    $0x0,%edx
+  802de2:	f7 da                	neg    %edx
+  802de4:	eb ef                	jmp    802dd5 <__divdi3+0x62>
+
+00802de6 <__moddi3>:
+  802de6:	55                   	push   %ebp
+  802de7:	57                   	push   %edi
+  802de8:	56                   	push   %esi
+  802de9:	53                   	push   %ebx
+  802dea:	83 ec 18             	sub    $0x18,%esp
+  802ded:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802df1:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802df5:	89 f1                	mov    %esi,%ecx
+  802df7:	f7 d9                	neg    %ecx
+  802df9:	89 da                	mov    %ebx,%edx
+  802dfb:	83 d2 00             	adc    $0x0,%edx
+  802dfe:	f7 da                	neg    %edx
+  802e00:	0f 48 ce             	cmovs  %esi,%ecx
+  802e03:	0f 48 d3             	cmovs  %ebx,%edx
+  802e06:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802e0a:	50                   	push   %eax
+  802e0b:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802e0f:	f7 de                	neg    %esi
+  802e11:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802e15:	83 d0 00             	adc    $0x0,%eax
+  802e18:	f7 d8                	neg    %eax
+  802e1a:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802e1f:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802e24:	50                   	push   %eax
+  802e25:	56                   	push   %esi
+  802e26:	89 c8                	mov    %ecx,%eax
+  802e28:	e8 30 fe ff ff       	call   802c5d <udivmod>
+  802e2d:	83 c4 10             	add    $0x10,%esp
+  802e30:	85 db                	test   %ebx,%ebx
+  802e32:	78 10                	js     802e44 <__moddi3+0x5e>
+  802e34:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802e38:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e3c:	83 c4 14             	add    $0x14,%esp
+  802e3f:	5b                   	pop    %ebx
+  802e40:	5e                   	pop    %esi
+  802e41:	5f                   	pop    %edi
+  802e42:	5d                   	pop    %ebp
+  802e43:	c3                   	ret
+  802e44:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802e48:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e4c:	f7 d8                	neg    %eax
+  802e4e:	83 d2 00             	adc    $0x0,%edx
+  802e51:	f7 da                	neg    %edx
+  802e53:	eb e7                	jmp    802e3c <__moddi3+0x56>
@@ -0,0 +1,6491 @@
+
+obj/user/init.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 5f 03 00 00       	call   800390 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <sum>:
+
+char bss[6000];
+
+int
+sum(const char *s, int n)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int i, tot = 0;
+  80003e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	for (i = 0; i < n; i++)
+  800043:	b8 00 00 00 00       	mov    $0x0,%eax
+  800048:	eb 0c                	jmp    800056 <sum+0x23>
+		tot ^= i * s[i];
+  80004a:	0f be 14 06          	movsbl (%esi,%eax,1),%edx
+  80004e:	0f af d0             	imul   %eax,%edx
+  800051:	31 d1                	xor    %edx,%ecx
+	for (i = 0; i < n; i++)
+  800053:	83 c0 01             	add    $0x1,%eax
+  800056:	39 d8                	cmp    %ebx,%eax
+  800058:	7c f0                	jl     80004a <sum+0x17>
+	return tot;
+}
+  80005a:	89 c8                	mov    %ecx,%eax
+  80005c:	5b                   	pop    %ebx
+  80005d:	5e                   	pop    %esi
+  80005e:	5d                   	pop    %ebp
+  80005f:	c3                   	ret
+
+00800060 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800060:	55                   	push   %ebp
+  800061:	89 e5                	mov    %esp,%ebp
+  800063:	57                   	push   %edi
+  800064:	56                   	push   %esi
+  800065:	53                   	push   %ebx
+  800066:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80006c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	int i, r, x, want;
+	char args[256];
+
+	cprintf("init: running\n");
+  80006f:	68 c0 2f 80 00       	push   $0x802fc0
+  800074:	e8 55 04 00 00       	call   8004ce <cprintf>
+
+	want = 0xf989e;
+	if ((x = sum((char*)&data, sizeof data)) != want)
+  800079:	83 c4 08             	add    $0x8,%esp
+  80007c:	68 70 17 00 00       	push   $0x1770
+  800081:	68 00 40 80 00       	push   $0x804000
+  800086:	e8 a8 ff ff ff       	call   800033 <sum>
+  80008b:	83 c4 10             	add    $0x10,%esp
+  80008e:	3d 9e 98 0f 00       	cmp    $0xf989e,%eax
+  800093:	74 64                	je     8000f9 <umain+0x99>
+		cprintf("init: data is not initialized: got sum %08x wanted %08x\n",
+  800095:	83 ec 04             	sub    $0x4,%esp
+  800098:	68 9e 98 0f 00       	push   $0xf989e
+  80009d:	50                   	push   %eax
+  80009e:	68 88 30 80 00       	push   $0x803088
+  8000a3:	e8 26 04 00 00       	call   8004ce <cprintf>
+  8000a8:	83 c4 10             	add    $0x10,%esp
+			x, want);
+	else
+		cprintf("init: data seems okay\n");
+	if ((x = sum(bss, sizeof bss)) != 0)
+  8000ab:	83 ec 08             	sub    $0x8,%esp
+  8000ae:	68 70 17 00 00       	push   $0x1770
+  8000b3:	68 20 60 80 00       	push   $0x806020
+  8000b8:	e8 76 ff ff ff       	call   800033 <sum>
+  8000bd:	83 c4 10             	add    $0x10,%esp
+  8000c0:	85 c0                	test   %eax,%eax
+  8000c2:	74 47                	je     80010b <umain+0xab>
+		cprintf("bss is not initialized: wanted sum 0 got %08x\n", x);
+  8000c4:	83 ec 08             	sub    $0x8,%esp
+  8000c7:	50                   	push   %eax
+  8000c8:	68 c4 30 80 00       	push   $0x8030c4
+  8000cd:	e8 fc 03 00 00       	call   8004ce <cprintf>
+  8000d2:	83 c4 10             	add    $0x10,%esp
+	else
+		cprintf("init: bss seems okay\n");
+
+	// output in one syscall per line to avoid output interleaving 
+	strcat(args, "init: args:");
+  8000d5:	83 ec 08             	sub    $0x8,%esp
+  8000d8:	68 fc 2f 80 00       	push   $0x802ffc
+  8000dd:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8000e3:	50                   	push   %eax
+  8000e4:	e8 f0 09 00 00       	call   800ad9 <strcat>
+	for (i = 0; i < argc; i++) {
+  8000e9:	83 c4 10             	add    $0x10,%esp
+  8000ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+		strcat(args, " '");
+  8000f1:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+	for (i = 0; i < argc; i++) {
+  8000f7:	eb 55                	jmp    80014e <umain+0xee>
+		cprintf("init: data seems okay\n");
+  8000f9:	83 ec 0c             	sub    $0xc,%esp
+  8000fc:	68 cf 2f 80 00       	push   $0x802fcf
+  800101:	e8 c8 03 00 00       	call   8004ce <cprintf>
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	eb a0                	jmp    8000ab <umain+0x4b>
+		cprintf("init: bss seems okay\n");
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 e6 2f 80 00       	push   $0x802fe6
+  800113:	e8 b6 03 00 00       	call   8004ce <cprintf>
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	eb b8                	jmp    8000d5 <umain+0x75>
+		strcat(args, " '");
+  80011d:	83 ec 08             	sub    $0x8,%esp
+  800120:	68 08 30 80 00       	push   $0x803008
+  800125:	56                   	push   %esi
+  800126:	e8 ae 09 00 00       	call   800ad9 <strcat>
+		strcat(args, argv[i]);
+  80012b:	83 c4 08             	add    $0x8,%esp
+  80012e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800131:	ff 34 98             	push   (%eax,%ebx,4)
+  800134:	56                   	push   %esi
+  800135:	e8 9f 09 00 00       	call   800ad9 <strcat>
+		strcat(args, "'");
+  80013a:	83 c4 08             	add    $0x8,%esp
+  80013d:	68 09 30 80 00       	push   $0x803009
+  800142:	56                   	push   %esi
+  800143:	e8 91 09 00 00       	call   800ad9 <strcat>
+	for (i = 0; i < argc; i++) {
+  800148:	83 c3 01             	add    $0x1,%ebx
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	39 fb                	cmp    %edi,%ebx
+  800150:	7c cb                	jl     80011d <umain+0xbd>
+	}
+	cprintf("%s\n", args);
+  800152:	83 ec 08             	sub    $0x8,%esp
+  800155:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80015b:	50                   	push   %eax
+  80015c:	68 0b 30 80 00       	push   $0x80300b
+  800161:	e8 68 03 00 00       	call   8004ce <cprintf>
+
+	cprintf("init: running sh\n");
+  800166:	c7 04 24 0f 30 80 00 	movl   $0x80300f,(%esp)
+  80016d:	e8 5c 03 00 00       	call   8004ce <cprintf>
+
+	// being run directly from kernel, so no file descriptors open yet
+	close(0);
+  800172:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800179:	e8 63 15 00 00       	call   8016e1 <close>
+	if ((r = opencons()) < 0)
+  80017e:	e8 bb 01 00 00       	call   80033e <opencons>
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	85 c0                	test   %eax,%eax
+  800188:	78 14                	js     80019e <umain+0x13e>
+		panic("opencons: %e", r);
+	if (r != 0)
+  80018a:	74 24                	je     8001b0 <umain+0x150>
+		panic("first opencons used fd %d", r);
+  80018c:	50                   	push   %eax
+  80018d:	68 3a 30 80 00       	push   $0x80303a
+  800192:	6a 39                	push   $0x39
+  800194:	68 2e 30 80 00       	push   $0x80302e
+  800199:	e8 55 02 00 00       	call   8003f3 <_panic>
+		panic("opencons: %e", r);
+  80019e:	50                   	push   %eax
+  80019f:	68 21 30 80 00       	push   $0x803021
+  8001a4:	6a 37                	push   $0x37
+  8001a6:	68 2e 30 80 00       	push   $0x80302e
+  8001ab:	e8 43 02 00 00       	call   8003f3 <_panic>
+	if ((r = dup(0, 1)) < 0)
+  8001b0:	83 ec 08             	sub    $0x8,%esp
+  8001b3:	6a 01                	push   $0x1
+  8001b5:	6a 00                	push   $0x0
+  8001b7:	e8 77 15 00 00       	call   801733 <dup>
+  8001bc:	83 c4 10             	add    $0x10,%esp
+  8001bf:	85 c0                	test   %eax,%eax
+  8001c1:	79 23                	jns    8001e6 <umain+0x186>
+		panic("dup: %e", r);
+  8001c3:	50                   	push   %eax
+  8001c4:	68 54 30 80 00       	push   $0x803054
+  8001c9:	6a 3b                	push   $0x3b
+  8001cb:	68 2e 30 80 00       	push   $0x80302e
+  8001d0:	e8 1e 02 00 00       	call   8003f3 <_panic>
+	while (1) {
+		cprintf("init: starting sh\n");
+		r = spawnl("/sh", "sh", (char*)0);
+		if (r < 0) {
+			cprintf("init: spawn sh: %e\n", r);
+  8001d5:	83 ec 08             	sub    $0x8,%esp
+  8001d8:	50                   	push   %eax
+  8001d9:	68 73 30 80 00       	push   $0x803073
+  8001de:	e8 eb 02 00 00       	call   8004ce <cprintf>
+			continue;
+  8001e3:	83 c4 10             	add    $0x10,%esp
+		cprintf("init: starting sh\n");
+  8001e6:	83 ec 0c             	sub    $0xc,%esp
+  8001e9:	68 5c 30 80 00       	push   $0x80305c
+  8001ee:	e8 db 02 00 00       	call   8004ce <cprintf>
+		r = spawnl("/sh", "sh", (char*)0);
+  8001f3:	83 c4 0c             	add    $0xc,%esp
+  8001f6:	6a 00                	push   $0x0
+  8001f8:	68 70 30 80 00       	push   $0x803070
+  8001fd:	68 6f 30 80 00       	push   $0x80306f
+  800202:	e8 1b 23 00 00       	call   802522 <spawnl>
+		if (r < 0) {
+  800207:	83 c4 10             	add    $0x10,%esp
+  80020a:	85 c0                	test   %eax,%eax
+  80020c:	78 c7                	js     8001d5 <umain+0x175>
+		}
+		wait(r);
+  80020e:	83 ec 0c             	sub    $0xc,%esp
+  800211:	50                   	push   %eax
+  800212:	e8 6e 28 00 00       	call   802a85 <wait>
+  800217:	83 c4 10             	add    $0x10,%esp
+  80021a:	eb ca                	jmp    8001e6 <umain+0x186>
+
+0080021c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80021c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800221:	c3                   	ret
+
+00800222 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800222:	55                   	push   %ebp
+  800223:	89 e5                	mov    %esp,%ebp
+  800225:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  800228:	68 f3 30 80 00       	push   $0x8030f3
+  80022d:	ff 75 0c             	push   0xc(%ebp)
+  800230:	e8 80 08 00 00       	call   800ab5 <strcpy>
+	return 0;
+}
+  800235:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+0080023c <devcons_write>:
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	57                   	push   %edi
+  800240:	56                   	push   %esi
+  800241:	53                   	push   %ebx
+  800242:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  800248:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80024d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  800253:	eb 2e                	jmp    800283 <devcons_write+0x47>
+		m = n - tot;
+  800255:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800258:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80025a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80025f:	39 c3                	cmp    %eax,%ebx
+  800261:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  800264:	83 ec 04             	sub    $0x4,%esp
+  800267:	53                   	push   %ebx
+  800268:	89 f0                	mov    %esi,%eax
+  80026a:	03 45 0c             	add    0xc(%ebp),%eax
+  80026d:	50                   	push   %eax
+  80026e:	57                   	push   %edi
+  80026f:	e8 c7 09 00 00       	call   800c3b <memmove>
+		sys_cputs(buf, m);
+  800274:	83 c4 08             	add    $0x8,%esp
+  800277:	53                   	push   %ebx
+  800278:	57                   	push   %edi
+  800279:	e8 5d 0c 00 00       	call   800edb <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80027e:	01 de                	add    %ebx,%esi
+  800280:	83 c4 10             	add    $0x10,%esp
+  800283:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800286:	72 cd                	jb     800255 <devcons_write+0x19>
+}
+  800288:	89 f0                	mov    %esi,%eax
+  80028a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028d:	5b                   	pop    %ebx
+  80028e:	5e                   	pop    %esi
+  80028f:	5f                   	pop    %edi
+  800290:	5d                   	pop    %ebp
+  800291:	c3                   	ret
+
+00800292 <devcons_read>:
+{
+  800292:	55                   	push   %ebp
+  800293:	89 e5                	mov    %esp,%ebp
+  800295:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  800298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002a1:	75 07                	jne    8002aa <devcons_read+0x18>
+  8002a3:	eb 1f                	jmp    8002c4 <devcons_read+0x32>
+		sys_yield();
+  8002a5:	e8 df 0c 00 00       	call   800f89 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8002aa:	e8 5b 0c 00 00       	call   800f0a <sys_cgetc>
+  8002af:	85 c0                	test   %eax,%eax
+  8002b1:	74 f2                	je     8002a5 <devcons_read+0x13>
+	if (c < 0)
+  8002b3:	78 0f                	js     8002c4 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8002b5:	83 f8 04             	cmp    $0x4,%eax
+  8002b8:	74 0c                	je     8002c6 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8002ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002bd:	88 02                	mov    %al,(%edx)
+	return 1;
+  8002bf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8002c4:	c9                   	leave
+  8002c5:	c3                   	ret
+		return 0;
+  8002c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cb:	eb f7                	jmp    8002c4 <devcons_read+0x32>
+
+008002cd <cputchar>:
+{
+  8002cd:	55                   	push   %ebp
+  8002ce:	89 e5                	mov    %esp,%ebp
+  8002d0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8002d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8002d9:	6a 01                	push   $0x1
+  8002db:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8002de:	50                   	push   %eax
+  8002df:	e8 f7 0b 00 00       	call   800edb <sys_cputs>
+}
+  8002e4:	83 c4 10             	add    $0x10,%esp
+  8002e7:	c9                   	leave
+  8002e8:	c3                   	ret
+
+008002e9 <getchar>:
+{
+  8002e9:	55                   	push   %ebp
+  8002ea:	89 e5                	mov    %esp,%ebp
+  8002ec:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8002ef:	6a 01                	push   $0x1
+  8002f1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	6a 00                	push   $0x0
+  8002f7:	e8 21 15 00 00       	call   80181d <read>
+	if (r < 0)
+  8002fc:	83 c4 10             	add    $0x10,%esp
+  8002ff:	85 c0                	test   %eax,%eax
+  800301:	78 06                	js     800309 <getchar+0x20>
+	if (r < 1)
+  800303:	74 06                	je     80030b <getchar+0x22>
+	return c;
+  800305:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  800309:	c9                   	leave
+  80030a:	c3                   	ret
+		return -E_EOF;
+  80030b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800310:	eb f7                	jmp    800309 <getchar+0x20>
+
+00800312 <iscons>:
+{
+  800312:	55                   	push   %ebp
+  800313:	89 e5                	mov    %esp,%ebp
+  800315:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800318:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80031b:	50                   	push   %eax
+  80031c:	ff 75 08             	push   0x8(%ebp)
+  80031f:	e8 9a 12 00 00       	call   8015be <fd_lookup>
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	85 c0                	test   %eax,%eax
+  800329:	78 11                	js     80033c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80032b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80032e:	8b 15 70 57 80 00    	mov    0x805770,%edx
+  800334:	39 10                	cmp    %edx,(%eax)
+  800336:	0f 94 c0             	sete   %al
+  800339:	0f b6 c0             	movzbl %al,%eax
+}
+  80033c:	c9                   	leave
+  80033d:	c3                   	ret
+
+0080033e <opencons>:
+{
+  80033e:	55                   	push   %ebp
+  80033f:	89 e5                	mov    %esp,%ebp
+  800341:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  800344:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800347:	50                   	push   %eax
+  800348:	e8 1d 12 00 00       	call   80156a <fd_alloc>
+  80034d:	83 c4 10             	add    $0x10,%esp
+  800350:	85 c0                	test   %eax,%eax
+  800352:	78 3a                	js     80038e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800354:	83 ec 04             	sub    $0x4,%esp
+  800357:	68 07 04 00 00       	push   $0x407
+  80035c:	ff 75 f4             	push   -0xc(%ebp)
+  80035f:	6a 00                	push   $0x0
+  800361:	e8 42 0c 00 00       	call   800fa8 <sys_page_alloc>
+  800366:	83 c4 10             	add    $0x10,%esp
+  800369:	85 c0                	test   %eax,%eax
+  80036b:	78 21                	js     80038e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80036d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800370:	8b 15 70 57 80 00    	mov    0x805770,%edx
+  800376:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800378:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80037b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800382:	83 ec 0c             	sub    $0xc,%esp
+  800385:	50                   	push   %eax
+  800386:	e8 b8 11 00 00       	call   801543 <fd2num>
+  80038b:	83 c4 10             	add    $0x10,%esp
+}
+  80038e:	c9                   	leave
+  80038f:	c3                   	ret
+
+00800390 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800390:	55                   	push   %ebp
+  800391:	89 e5                	mov    %esp,%ebp
+  800393:	56                   	push   %esi
+  800394:	53                   	push   %ebx
+  800395:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800398:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  80039b:	e8 ca 0b 00 00       	call   800f6a <sys_getenvid>
+  8003a0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003a5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003a8:	c1 e0 06             	shl    $0x6,%eax
+  8003ab:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003b0:	a3 94 77 80 00       	mov    %eax,0x807794
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003b5:	85 db                	test   %ebx,%ebx
+  8003b7:	7e 07                	jle    8003c0 <libmain+0x30>
+		binaryname = argv[0];
+  8003b9:	8b 06                	mov    (%esi),%eax
+  8003bb:	a3 8c 57 80 00       	mov    %eax,0x80578c
+
+	// call user main routine
+	umain(argc, argv);
+  8003c0:	83 ec 08             	sub    $0x8,%esp
+  8003c3:	56                   	push   %esi
+  8003c4:	53                   	push   %ebx
+  8003c5:	e8 96 fc ff ff       	call   800060 <umain>
+
+	// exit gracefully
+	exit();
+  8003ca:	e8 0a 00 00 00       	call   8003d9 <exit>
+}
+  8003cf:	83 c4 10             	add    $0x10,%esp
+  8003d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003d5:	5b                   	pop    %ebx
+  8003d6:	5e                   	pop    %esi
+  8003d7:	5d                   	pop    %ebp
+  8003d8:	c3                   	ret
+
+008003d9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003d9:	55                   	push   %ebp
+  8003da:	89 e5                	mov    %esp,%ebp
+  8003dc:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8003df:	e8 2a 13 00 00       	call   80170e <close_all>
+	sys_env_destroy(0);
+  8003e4:	83 ec 0c             	sub    $0xc,%esp
+  8003e7:	6a 00                	push   $0x0
+  8003e9:	e8 3b 0b 00 00       	call   800f29 <sys_env_destroy>
+}
+  8003ee:	83 c4 10             	add    $0x10,%esp
+  8003f1:	c9                   	leave
+  8003f2:	c3                   	ret
+
+008003f3 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8003f3:	55                   	push   %ebp
+  8003f4:	89 e5                	mov    %esp,%ebp
+  8003f6:	56                   	push   %esi
+  8003f7:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8003f8:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003fb:	8b 35 8c 57 80 00    	mov    0x80578c,%esi
+  800401:	e8 64 0b 00 00       	call   800f6a <sys_getenvid>
+  800406:	83 ec 0c             	sub    $0xc,%esp
+  800409:	ff 75 0c             	push   0xc(%ebp)
+  80040c:	ff 75 08             	push   0x8(%ebp)
+  80040f:	56                   	push   %esi
+  800410:	50                   	push   %eax
+  800411:	68 0c 31 80 00       	push   $0x80310c
+  800416:	e8 b3 00 00 00       	call   8004ce <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80041b:	83 c4 18             	add    $0x18,%esp
+  80041e:	53                   	push   %ebx
+  80041f:	ff 75 10             	push   0x10(%ebp)
+  800422:	e8 56 00 00 00       	call   80047d <vcprintf>
+	cprintf("\n");
+  800427:	c7 04 24 2a 36 80 00 	movl   $0x80362a,(%esp)
+  80042e:	e8 9b 00 00 00       	call   8004ce <cprintf>
+  800433:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800436:	cc                   	int3
+	while (1)
+  800437:	eb fd                	jmp    800436 <_panic+0x43>
+
+00800439 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800439:	55                   	push   %ebp
+  80043a:	89 e5                	mov    %esp,%ebp
+  80043c:	53                   	push   %ebx
+  80043d:	83 ec 04             	sub    $0x4,%esp
+  800440:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800443:	8b 13                	mov    (%ebx),%edx
+  800445:	8d 42 01             	lea    0x1(%edx),%eax
+  800448:	89 03                	mov    %eax,(%ebx)
+  80044a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80044d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800451:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800456:	74 09                	je     800461 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800458:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80045c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80045f:	c9                   	leave
+  800460:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800461:	83 ec 08             	sub    $0x8,%esp
+  800464:	68 ff 00 00 00       	push   $0xff
+  800469:	8d 43 08             	lea    0x8(%ebx),%eax
+  80046c:	50                   	push   %eax
+  80046d:	e8 69 0a 00 00       	call   800edb <sys_cputs>
+		b->idx = 0;
+  800472:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800478:	83 c4 10             	add    $0x10,%esp
+  80047b:	eb db                	jmp    800458 <putch+0x1f>
+
+0080047d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80047d:	55                   	push   %ebp
+  80047e:	89 e5                	mov    %esp,%ebp
+  800480:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800486:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80048d:	00 00 00 
+	b.cnt = 0;
+  800490:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800497:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80049a:	ff 75 0c             	push   0xc(%ebp)
+  80049d:	ff 75 08             	push   0x8(%ebp)
+  8004a0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004a6:	50                   	push   %eax
+  8004a7:	68 39 04 80 00       	push   $0x800439
+  8004ac:	e8 14 01 00 00       	call   8005c5 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004b1:	83 c4 08             	add    $0x8,%esp
+  8004b4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004ba:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004c0:	50                   	push   %eax
+  8004c1:	e8 15 0a 00 00       	call   800edb <sys_cputs>
+
+	return b.cnt;
+}
+  8004c6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004cc:	c9                   	leave
+  8004cd:	c3                   	ret
+
+008004ce <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004ce:	55                   	push   %ebp
+  8004cf:	89 e5                	mov    %esp,%ebp
+  8004d1:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8004d4:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8004d7:	50                   	push   %eax
+  8004d8:	ff 75 08             	push   0x8(%ebp)
+  8004db:	e8 9d ff ff ff       	call   80047d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8004e0:	c9                   	leave
+  8004e1:	c3                   	ret
+
+008004e2 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004e2:	55                   	push   %ebp
+  8004e3:	89 e5                	mov    %esp,%ebp
+  8004e5:	57                   	push   %edi
+  8004e6:	56                   	push   %esi
+  8004e7:	53                   	push   %ebx
+  8004e8:	83 ec 1c             	sub    $0x1c,%esp
+  8004eb:	89 c7                	mov    %eax,%edi
+  8004ed:	89 d6                	mov    %edx,%esi
+  8004ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004f5:	89 d1                	mov    %edx,%ecx
+  8004f7:	89 c2                	mov    %eax,%edx
+  8004f9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004fc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004ff:	8b 45 10             	mov    0x10(%ebp),%eax
+  800502:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800505:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800508:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80050f:	39 c2                	cmp    %eax,%edx
+  800511:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800514:	72 3e                	jb     800554 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800516:	83 ec 0c             	sub    $0xc,%esp
+  800519:	ff 75 18             	push   0x18(%ebp)
+  80051c:	83 eb 01             	sub    $0x1,%ebx
+  80051f:	53                   	push   %ebx
+  800520:	50                   	push   %eax
+  800521:	83 ec 08             	sub    $0x8,%esp
+  800524:	ff 75 e4             	push   -0x1c(%ebp)
+  800527:	ff 75 e0             	push   -0x20(%ebp)
+  80052a:	ff 75 dc             	push   -0x24(%ebp)
+  80052d:	ff 75 d8             	push   -0x28(%ebp)
+  800530:	e8 4b 29 00 00       	call   802e80 <__udivdi3>
+  800535:	83 c4 18             	add    $0x18,%esp
+  800538:	52                   	push   %edx
+  800539:	50                   	push   %eax
+  80053a:	89 f2                	mov    %esi,%edx
+  80053c:	89 f8                	mov    %edi,%eax
+  80053e:	e8 9f ff ff ff       	call   8004e2 <printnum>
+  800543:	83 c4 20             	add    $0x20,%esp
+  800546:	eb 13                	jmp    80055b <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800548:	83 ec 08             	sub    $0x8,%esp
+  80054b:	56                   	push   %esi
+  80054c:	ff 75 18             	push   0x18(%ebp)
+  80054f:	ff d7                	call   *%edi
+  800551:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800554:	83 eb 01             	sub    $0x1,%ebx
+  800557:	85 db                	test   %ebx,%ebx
+  800559:	7f ed                	jg     800548 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80055b:	83 ec 08             	sub    $0x8,%esp
+  80055e:	56                   	push   %esi
+  80055f:	83 ec 04             	sub    $0x4,%esp
+  800562:	ff 75 e4             	push   -0x1c(%ebp)
+  800565:	ff 75 e0             	push   -0x20(%ebp)
+  800568:	ff 75 dc             	push   -0x24(%ebp)
+  80056b:	ff 75 d8             	push   -0x28(%ebp)
+  80056e:	e8 2b 29 00 00       	call   802e9e <__umoddi3>
+  800573:	83 c4 14             	add    $0x14,%esp
+  800576:	0f be 80 2f 31 80 00 	movsbl 0x80312f(%eax),%eax
+  80057d:	50                   	push   %eax
+  80057e:	ff d7                	call   *%edi
+}
+  800580:	83 c4 10             	add    $0x10,%esp
+  800583:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800586:	5b                   	pop    %ebx
+  800587:	5e                   	pop    %esi
+  800588:	5f                   	pop    %edi
+  800589:	5d                   	pop    %ebp
+  80058a:	c3                   	ret
+
+0080058b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80058b:	55                   	push   %ebp
+  80058c:	89 e5                	mov    %esp,%ebp
+  80058e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800591:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800595:	8b 10                	mov    (%eax),%edx
+  800597:	3b 50 04             	cmp    0x4(%eax),%edx
+  80059a:	73 0a                	jae    8005a6 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80059c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80059f:	89 08                	mov    %ecx,(%eax)
+  8005a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005a4:	88 02                	mov    %al,(%edx)
+}
+  8005a6:	5d                   	pop    %ebp
+  8005a7:	c3                   	ret
+
+008005a8 <printfmt>:
+{
+  8005a8:	55                   	push   %ebp
+  8005a9:	89 e5                	mov    %esp,%ebp
+  8005ab:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005ae:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005b1:	50                   	push   %eax
+  8005b2:	ff 75 10             	push   0x10(%ebp)
+  8005b5:	ff 75 0c             	push   0xc(%ebp)
+  8005b8:	ff 75 08             	push   0x8(%ebp)
+  8005bb:	e8 05 00 00 00       	call   8005c5 <vprintfmt>
+}
+  8005c0:	83 c4 10             	add    $0x10,%esp
+  8005c3:	c9                   	leave
+  8005c4:	c3                   	ret
+
+008005c5 <vprintfmt>:
+{
+  8005c5:	55                   	push   %ebp
+  8005c6:	89 e5                	mov    %esp,%ebp
+  8005c8:	57                   	push   %edi
+  8005c9:	56                   	push   %esi
+  8005ca:	53                   	push   %ebx
+  8005cb:	83 ec 2c             	sub    $0x2c,%esp
+  8005ce:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005d1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005d4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8005d7:	eb 0a                	jmp    8005e3 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8005d9:	83 ec 08             	sub    $0x8,%esp
+  8005dc:	53                   	push   %ebx
+  8005dd:	50                   	push   %eax
+  8005de:	ff d6                	call   *%esi
+  8005e0:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005e3:	83 c7 01             	add    $0x1,%edi
+  8005e6:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8005ea:	83 f8 25             	cmp    $0x25,%eax
+  8005ed:	74 0c                	je     8005fb <vprintfmt+0x36>
+			if (ch == '\0')
+  8005ef:	85 c0                	test   %eax,%eax
+  8005f1:	75 e6                	jne    8005d9 <vprintfmt+0x14>
+}
+  8005f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005f6:	5b                   	pop    %ebx
+  8005f7:	5e                   	pop    %esi
+  8005f8:	5f                   	pop    %edi
+  8005f9:	5d                   	pop    %ebp
+  8005fa:	c3                   	ret
+		padc = ' ';
+  8005fb:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8005ff:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800606:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80060d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800614:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800619:	8d 47 01             	lea    0x1(%edi),%eax
+  80061c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80061f:	0f b6 17             	movzbl (%edi),%edx
+  800622:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800625:	3c 55                	cmp    $0x55,%al
+  800627:	0f 87 c5 03 00 00    	ja     8009f2 <vprintfmt+0x42d>
+  80062d:	0f b6 c0             	movzbl %al,%eax
+  800630:	ff 24 85 c0 32 80 00 	jmp    *0x8032c0(,%eax,4)
+  800637:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80063a:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80063e:	eb d9                	jmp    800619 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800640:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800643:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800647:	eb d0                	jmp    800619 <vprintfmt+0x54>
+  800649:	0f b6 d2             	movzbl %dl,%edx
+  80064c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80064f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800654:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800657:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80065a:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80065e:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800661:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800664:	83 f9 09             	cmp    $0x9,%ecx
+  800667:	77 55                	ja     8006be <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800669:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80066c:	eb e9                	jmp    800657 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80066e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800671:	8b 00                	mov    (%eax),%eax
+  800673:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800676:	8b 45 14             	mov    0x14(%ebp),%eax
+  800679:	8d 40 04             	lea    0x4(%eax),%eax
+  80067c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80067f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800682:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800686:	79 91                	jns    800619 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800688:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80068b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80068e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800695:	eb 82                	jmp    800619 <vprintfmt+0x54>
+			if (width < 0)
+  800697:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80069a:	85 d2                	test   %edx,%edx
+  80069c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a1:	0f 49 c2             	cmovns %edx,%eax
+  8006a4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006a7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006aa:	e9 6a ff ff ff       	jmp    800619 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006af:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8006b2:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006b9:	e9 5b ff ff ff       	jmp    800619 <vprintfmt+0x54>
+  8006be:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006c1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006c4:	eb bc                	jmp    800682 <vprintfmt+0xbd>
+			lflag++;
+  8006c6:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8006c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006cc:	e9 48 ff ff ff       	jmp    800619 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8006d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d4:	8d 78 04             	lea    0x4(%eax),%edi
+  8006d7:	83 ec 08             	sub    $0x8,%esp
+  8006da:	53                   	push   %ebx
+  8006db:	ff 30                	push   (%eax)
+  8006dd:	ff d6                	call   *%esi
+			break;
+  8006df:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8006e2:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8006e5:	e9 63 02 00 00       	jmp    80094d <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8006ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ed:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8006f0:	8b 10                	mov    (%eax),%edx
+  8006f2:	89 d0                	mov    %edx,%eax
+  8006f4:	f7 d8                	neg    %eax
+  8006f6:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006f9:	83 f8 12             	cmp    $0x12,%eax
+  8006fc:	7f 23                	jg     800721 <vprintfmt+0x15c>
+  8006fe:	8b 14 85 20 34 80 00 	mov    0x803420(,%eax,4),%edx
+  800705:	85 d2                	test   %edx,%edx
+  800707:	74 18                	je     800721 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800709:	52                   	push   %edx
+  80070a:	68 5d 35 80 00       	push   $0x80355d
+  80070f:	53                   	push   %ebx
+  800710:	56                   	push   %esi
+  800711:	e8 92 fe ff ff       	call   8005a8 <printfmt>
+  800716:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800719:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80071c:	e9 2c 02 00 00       	jmp    80094d <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  800721:	50                   	push   %eax
+  800722:	68 47 31 80 00       	push   $0x803147
+  800727:	53                   	push   %ebx
+  800728:	56                   	push   %esi
+  800729:	e8 7a fe ff ff       	call   8005a8 <printfmt>
+  80072e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800731:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800734:	e9 14 02 00 00       	jmp    80094d <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800739:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073c:	83 c0 04             	add    $0x4,%eax
+  80073f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800742:	8b 45 14             	mov    0x14(%ebp),%eax
+  800745:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800747:	85 c9                	test   %ecx,%ecx
+  800749:	b8 40 31 80 00       	mov    $0x803140,%eax
+  80074e:	0f 45 c1             	cmovne %ecx,%eax
+  800751:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800754:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800758:	7e 06                	jle    800760 <vprintfmt+0x19b>
+  80075a:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80075e:	75 0b                	jne    80076b <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800760:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800763:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800766:	89 75 08             	mov    %esi,0x8(%ebp)
+  800769:	eb 5c                	jmp    8007c7 <vprintfmt+0x202>
+  80076b:	83 ec 08             	sub    $0x8,%esp
+  80076e:	ff 75 d0             	push   -0x30(%ebp)
+  800771:	ff 75 cc             	push   -0x34(%ebp)
+  800774:	e8 19 03 00 00       	call   800a92 <strnlen>
+  800779:	89 c2                	mov    %eax,%edx
+  80077b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80077e:	29 d0                	sub    %edx,%eax
+  800780:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800783:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800787:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80078a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80078d:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80078f:	eb 0e                	jmp    80079f <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800791:	83 ec 08             	sub    $0x8,%esp
+  800794:	53                   	push   %ebx
+  800795:	57                   	push   %edi
+  800796:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800799:	83 ee 01             	sub    $0x1,%esi
+  80079c:	83 c4 10             	add    $0x10,%esp
+  80079f:	85 f6                	test   %esi,%esi
+  8007a1:	7f ee                	jg     800791 <vprintfmt+0x1cc>
+  8007a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007a6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007a9:	85 c0                	test   %eax,%eax
+  8007ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007b0:	0f 49 d0             	cmovns %eax,%edx
+  8007b3:	29 d0                	sub    %edx,%eax
+  8007b5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007b8:	eb a6                	jmp    800760 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8007ba:	83 ec 08             	sub    $0x8,%esp
+  8007bd:	53                   	push   %ebx
+  8007be:	52                   	push   %edx
+  8007bf:	ff 55 08             	call   *0x8(%ebp)
+  8007c2:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007c5:	89 f1                	mov    %esi,%ecx
+  8007c7:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007ca:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007ce:	0f be d0             	movsbl %al,%edx
+  8007d1:	85 d2                	test   %edx,%edx
+  8007d3:	74 28                	je     8007fd <vprintfmt+0x238>
+  8007d5:	85 ff                	test   %edi,%edi
+  8007d7:	78 05                	js     8007de <vprintfmt+0x219>
+  8007d9:	83 ef 01             	sub    $0x1,%edi
+  8007dc:	78 30                	js     80080e <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007de:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007e2:	74 d6                	je     8007ba <vprintfmt+0x1f5>
+  8007e4:	0f be c0             	movsbl %al,%eax
+  8007e7:	83 e8 20             	sub    $0x20,%eax
+  8007ea:	83 f8 5e             	cmp    $0x5e,%eax
+  8007ed:	76 cb                	jbe    8007ba <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8007ef:	83 ec 08             	sub    $0x8,%esp
+  8007f2:	53                   	push   %ebx
+  8007f3:	6a 3f                	push   $0x3f
+  8007f5:	ff 55 08             	call   *0x8(%ebp)
+  8007f8:	83 c4 10             	add    $0x10,%esp
+  8007fb:	eb c8                	jmp    8007c5 <vprintfmt+0x200>
+  8007fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800800:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800803:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800806:	01 d0                	add    %edx,%eax
+  800808:	29 c8                	sub    %ecx,%eax
+  80080a:	89 c7                	mov    %eax,%edi
+  80080c:	eb 13                	jmp    800821 <vprintfmt+0x25c>
+  80080e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800811:	eb ed                	jmp    800800 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800813:	83 ec 08             	sub    $0x8,%esp
+  800816:	53                   	push   %ebx
+  800817:	6a 20                	push   $0x20
+  800819:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80081b:	83 ef 01             	sub    $0x1,%edi
+  80081e:	83 c4 10             	add    $0x10,%esp
+  800821:	85 ff                	test   %edi,%edi
+  800823:	7f ee                	jg     800813 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800825:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800828:	89 45 14             	mov    %eax,0x14(%ebp)
+  80082b:	e9 1d 01 00 00       	jmp    80094d <vprintfmt+0x388>
+	if (lflag >= 2)
+  800830:	83 f9 01             	cmp    $0x1,%ecx
+  800833:	7f 1b                	jg     800850 <vprintfmt+0x28b>
+	else if (lflag)
+  800835:	85 c9                	test   %ecx,%ecx
+  800837:	74 63                	je     80089c <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800839:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083c:	8b 00                	mov    (%eax),%eax
+  80083e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800841:	99                   	cltd
+  800842:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800845:	8b 45 14             	mov    0x14(%ebp),%eax
+  800848:	8d 40 04             	lea    0x4(%eax),%eax
+  80084b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80084e:	eb 17                	jmp    800867 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  800850:	8b 45 14             	mov    0x14(%ebp),%eax
+  800853:	8b 50 04             	mov    0x4(%eax),%edx
+  800856:	8b 00                	mov    (%eax),%eax
+  800858:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80085b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80085e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800861:	8d 40 08             	lea    0x8(%eax),%eax
+  800864:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800867:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80086a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80086d:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800872:	85 c9                	test   %ecx,%ecx
+  800874:	0f 89 b9 00 00 00    	jns    800933 <vprintfmt+0x36e>
+				putch('-', putdat);
+  80087a:	83 ec 08             	sub    $0x8,%esp
+  80087d:	53                   	push   %ebx
+  80087e:	6a 2d                	push   $0x2d
+  800880:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800882:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800885:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800888:	f7 da                	neg    %edx
+  80088a:	83 d1 00             	adc    $0x0,%ecx
+  80088d:	f7 d9                	neg    %ecx
+  80088f:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800892:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800897:	e9 97 00 00 00       	jmp    800933 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  80089c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089f:	8b 00                	mov    (%eax),%eax
+  8008a1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008a4:	99                   	cltd
+  8008a5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8008a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ae:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b1:	eb b4                	jmp    800867 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8008b3:	83 f9 01             	cmp    $0x1,%ecx
+  8008b6:	7f 1b                	jg     8008d3 <vprintfmt+0x30e>
+	else if (lflag)
+  8008b8:	85 c9                	test   %ecx,%ecx
+  8008ba:	74 2c                	je     8008e8 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8008bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008bf:	8b 10                	mov    (%eax),%edx
+  8008c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008c6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008cc:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8008d1:	eb 60                	jmp    800933 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8008d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d6:	8b 10                	mov    (%eax),%edx
+  8008d8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008db:	8d 40 08             	lea    0x8(%eax),%eax
+  8008de:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008e1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8008e6:	eb 4b                	jmp    800933 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8008e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008eb:	8b 10                	mov    (%eax),%edx
+  8008ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008f8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8008fd:	eb 34                	jmp    800933 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8008ff:	83 f9 01             	cmp    $0x1,%ecx
+  800902:	7f 15                	jg     800919 <vprintfmt+0x354>
+	else if (lflag)
+  800904:	85 c9                	test   %ecx,%ecx
+  800906:	74 4d                	je     800955 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800908:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090b:	8b 00                	mov    (%eax),%eax
+  80090d:	99                   	cltd
+  80090e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800911:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800914:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800917:	eb 11                	jmp    80092a <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800919:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091c:	8b 50 04             	mov    0x4(%eax),%edx
+  80091f:	8b 00                	mov    (%eax),%eax
+  800921:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800924:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800927:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  80092a:	89 d1                	mov    %edx,%ecx
+  80092c:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  80092e:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800933:	83 ec 0c             	sub    $0xc,%esp
+  800936:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80093a:	50                   	push   %eax
+  80093b:	ff 75 e0             	push   -0x20(%ebp)
+  80093e:	57                   	push   %edi
+  80093f:	51                   	push   %ecx
+  800940:	52                   	push   %edx
+  800941:	89 da                	mov    %ebx,%edx
+  800943:	89 f0                	mov    %esi,%eax
+  800945:	e8 98 fb ff ff       	call   8004e2 <printnum>
+			break;
+  80094a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80094d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800950:	e9 8e fc ff ff       	jmp    8005e3 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800955:	8b 45 14             	mov    0x14(%ebp),%eax
+  800958:	8b 00                	mov    (%eax),%eax
+  80095a:	99                   	cltd
+  80095b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80095e:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800961:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800964:	eb c4                	jmp    80092a <vprintfmt+0x365>
+			putch('0', putdat);
+  800966:	83 ec 08             	sub    $0x8,%esp
+  800969:	53                   	push   %ebx
+  80096a:	6a 30                	push   $0x30
+  80096c:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80096e:	83 c4 08             	add    $0x8,%esp
+  800971:	53                   	push   %ebx
+  800972:	6a 78                	push   $0x78
+  800974:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800976:	8b 45 14             	mov    0x14(%ebp),%eax
+  800979:	8b 10                	mov    (%eax),%edx
+  80097b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800980:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800983:	8d 40 04             	lea    0x4(%eax),%eax
+  800986:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800989:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  80098e:	eb a3                	jmp    800933 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800990:	83 f9 01             	cmp    $0x1,%ecx
+  800993:	7f 1b                	jg     8009b0 <vprintfmt+0x3eb>
+	else if (lflag)
+  800995:	85 c9                	test   %ecx,%ecx
+  800997:	74 2f                	je     8009c8 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800999:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099c:	8b 10                	mov    (%eax),%edx
+  80099e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009a9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8009ae:	eb 83                	jmp    800933 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8009b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b3:	8b 10                	mov    (%eax),%edx
+  8009b5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009b8:	8d 40 08             	lea    0x8(%eax),%eax
+  8009bb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009be:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8009c3:	e9 6b ff ff ff       	jmp    800933 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8009c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009cb:	8b 10                	mov    (%eax),%edx
+  8009cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8009d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009d8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8009dd:	e9 51 ff ff ff       	jmp    800933 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8009e2:	83 ec 08             	sub    $0x8,%esp
+  8009e5:	53                   	push   %ebx
+  8009e6:	6a 25                	push   $0x25
+  8009e8:	ff d6                	call   *%esi
+			break;
+  8009ea:	83 c4 10             	add    $0x10,%esp
+  8009ed:	e9 5b ff ff ff       	jmp    80094d <vprintfmt+0x388>
+			putch('%', putdat);
+  8009f2:	83 ec 08             	sub    $0x8,%esp
+  8009f5:	53                   	push   %ebx
+  8009f6:	6a 25                	push   $0x25
+  8009f8:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009fa:	83 c4 10             	add    $0x10,%esp
+  8009fd:	89 f8                	mov    %edi,%eax
+  8009ff:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a03:	74 05                	je     800a0a <vprintfmt+0x445>
+  800a05:	83 e8 01             	sub    $0x1,%eax
+  800a08:	eb f5                	jmp    8009ff <vprintfmt+0x43a>
+  800a0a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a0d:	e9 3b ff ff ff       	jmp    80094d <vprintfmt+0x388>
+
+00800a12 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a12:	55                   	push   %ebp
+  800a13:	89 e5                	mov    %esp,%ebp
+  800a15:	83 ec 18             	sub    $0x18,%esp
+  800a18:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a1e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a21:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a25:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a28:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800a2f:	85 c0                	test   %eax,%eax
+  800a31:	74 26                	je     800a59 <vsnprintf+0x47>
+  800a33:	85 d2                	test   %edx,%edx
+  800a35:	7e 22                	jle    800a59 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a37:	ff 75 14             	push   0x14(%ebp)
+  800a3a:	ff 75 10             	push   0x10(%ebp)
+  800a3d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a40:	50                   	push   %eax
+  800a41:	68 8b 05 80 00       	push   $0x80058b
+  800a46:	e8 7a fb ff ff       	call   8005c5 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a4b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a4e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a54:	83 c4 10             	add    $0x10,%esp
+}
+  800a57:	c9                   	leave
+  800a58:	c3                   	ret
+		return -E_INVAL;
+  800a59:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a5e:	eb f7                	jmp    800a57 <vsnprintf+0x45>
+
+00800a60 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a60:	55                   	push   %ebp
+  800a61:	89 e5                	mov    %esp,%ebp
+  800a63:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a66:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a69:	50                   	push   %eax
+  800a6a:	ff 75 10             	push   0x10(%ebp)
+  800a6d:	ff 75 0c             	push   0xc(%ebp)
+  800a70:	ff 75 08             	push   0x8(%ebp)
+  800a73:	e8 9a ff ff ff       	call   800a12 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a78:	c9                   	leave
+  800a79:	c3                   	ret
+
+00800a7a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a7a:	55                   	push   %ebp
+  800a7b:	89 e5                	mov    %esp,%ebp
+  800a7d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a80:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a85:	eb 03                	jmp    800a8a <strlen+0x10>
+		n++;
+  800a87:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a8a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a8e:	75 f7                	jne    800a87 <strlen+0xd>
+	return n;
+}
+  800a90:	5d                   	pop    %ebp
+  800a91:	c3                   	ret
+
+00800a92 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a92:	55                   	push   %ebp
+  800a93:	89 e5                	mov    %esp,%ebp
+  800a95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa0:	eb 03                	jmp    800aa5 <strnlen+0x13>
+		n++;
+  800aa2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800aa5:	39 d0                	cmp    %edx,%eax
+  800aa7:	74 08                	je     800ab1 <strnlen+0x1f>
+  800aa9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800aad:	75 f3                	jne    800aa2 <strnlen+0x10>
+  800aaf:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800ab1:	89 d0                	mov    %edx,%eax
+  800ab3:	5d                   	pop    %ebp
+  800ab4:	c3                   	ret
+
+00800ab5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800ab5:	55                   	push   %ebp
+  800ab6:	89 e5                	mov    %esp,%ebp
+  800ab8:	53                   	push   %ebx
+  800ab9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800abc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800abf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800ac8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800acb:	83 c0 01             	add    $0x1,%eax
+  800ace:	84 d2                	test   %dl,%dl
+  800ad0:	75 f2                	jne    800ac4 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800ad2:	89 c8                	mov    %ecx,%eax
+  800ad4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ad7:	c9                   	leave
+  800ad8:	c3                   	ret
+
+00800ad9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ad9:	55                   	push   %ebp
+  800ada:	89 e5                	mov    %esp,%ebp
+  800adc:	53                   	push   %ebx
+  800add:	83 ec 10             	sub    $0x10,%esp
+  800ae0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800ae3:	53                   	push   %ebx
+  800ae4:	e8 91 ff ff ff       	call   800a7a <strlen>
+  800ae9:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800aec:	ff 75 0c             	push   0xc(%ebp)
+  800aef:	01 d8                	add    %ebx,%eax
+  800af1:	50                   	push   %eax
+  800af2:	e8 be ff ff ff       	call   800ab5 <strcpy>
+	return dst;
+}
+  800af7:	89 d8                	mov    %ebx,%eax
+  800af9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800afc:	c9                   	leave
+  800afd:	c3                   	ret
+
+00800afe <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800afe:	55                   	push   %ebp
+  800aff:	89 e5                	mov    %esp,%ebp
+  800b01:	56                   	push   %esi
+  800b02:	53                   	push   %ebx
+  800b03:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b06:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b09:	89 f3                	mov    %esi,%ebx
+  800b0b:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b0e:	89 f0                	mov    %esi,%eax
+  800b10:	eb 0f                	jmp    800b21 <strncpy+0x23>
+		*dst++ = *src;
+  800b12:	83 c0 01             	add    $0x1,%eax
+  800b15:	0f b6 0a             	movzbl (%edx),%ecx
+  800b18:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b1b:	80 f9 01             	cmp    $0x1,%cl
+  800b1e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b21:	39 d8                	cmp    %ebx,%eax
+  800b23:	75 ed                	jne    800b12 <strncpy+0x14>
+	}
+	return ret;
+}
+  800b25:	89 f0                	mov    %esi,%eax
+  800b27:	5b                   	pop    %ebx
+  800b28:	5e                   	pop    %esi
+  800b29:	5d                   	pop    %ebp
+  800b2a:	c3                   	ret
+
+00800b2b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b2b:	55                   	push   %ebp
+  800b2c:	89 e5                	mov    %esp,%ebp
+  800b2e:	56                   	push   %esi
+  800b2f:	53                   	push   %ebx
+  800b30:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b36:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b39:	89 f0                	mov    %esi,%eax
+  800b3b:	85 d2                	test   %edx,%edx
+  800b3d:	74 21                	je     800b60 <strlcpy+0x35>
+  800b3f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b43:	89 f2                	mov    %esi,%edx
+  800b45:	eb 09                	jmp    800b50 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b47:	83 c1 01             	add    $0x1,%ecx
+  800b4a:	83 c2 01             	add    $0x1,%edx
+  800b4d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b50:	39 c2                	cmp    %eax,%edx
+  800b52:	74 09                	je     800b5d <strlcpy+0x32>
+  800b54:	0f b6 19             	movzbl (%ecx),%ebx
+  800b57:	84 db                	test   %bl,%bl
+  800b59:	75 ec                	jne    800b47 <strlcpy+0x1c>
+  800b5b:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b5d:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b60:	29 f0                	sub    %esi,%eax
+}
+  800b62:	5b                   	pop    %ebx
+  800b63:	5e                   	pop    %esi
+  800b64:	5d                   	pop    %ebp
+  800b65:	c3                   	ret
+
+00800b66 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b66:	55                   	push   %ebp
+  800b67:	89 e5                	mov    %esp,%ebp
+  800b69:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b6c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b6f:	eb 06                	jmp    800b77 <strcmp+0x11>
+		p++, q++;
+  800b71:	83 c1 01             	add    $0x1,%ecx
+  800b74:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b77:	0f b6 01             	movzbl (%ecx),%eax
+  800b7a:	84 c0                	test   %al,%al
+  800b7c:	74 04                	je     800b82 <strcmp+0x1c>
+  800b7e:	3a 02                	cmp    (%edx),%al
+  800b80:	74 ef                	je     800b71 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b82:	0f b6 c0             	movzbl %al,%eax
+  800b85:	0f b6 12             	movzbl (%edx),%edx
+  800b88:	29 d0                	sub    %edx,%eax
+}
+  800b8a:	5d                   	pop    %ebp
+  800b8b:	c3                   	ret
+
+00800b8c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b8c:	55                   	push   %ebp
+  800b8d:	89 e5                	mov    %esp,%ebp
+  800b8f:	53                   	push   %ebx
+  800b90:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b96:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b99:	eb 09                	jmp    800ba4 <strncmp+0x18>
+		n--, p++, q++;
+  800b9b:	83 ea 01             	sub    $0x1,%edx
+  800b9e:	83 c0 01             	add    $0x1,%eax
+  800ba1:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ba4:	85 d2                	test   %edx,%edx
+  800ba6:	74 18                	je     800bc0 <strncmp+0x34>
+  800ba8:	0f b6 18             	movzbl (%eax),%ebx
+  800bab:	84 db                	test   %bl,%bl
+  800bad:	74 04                	je     800bb3 <strncmp+0x27>
+  800baf:	3a 19                	cmp    (%ecx),%bl
+  800bb1:	74 e8                	je     800b9b <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bb3:	0f b6 00             	movzbl (%eax),%eax
+  800bb6:	0f b6 11             	movzbl (%ecx),%edx
+  800bb9:	29 d0                	sub    %edx,%eax
+}
+  800bbb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bbe:	c9                   	leave
+  800bbf:	c3                   	ret
+		return 0;
+  800bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc5:	eb f4                	jmp    800bbb <strncmp+0x2f>
+
+00800bc7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bc7:	55                   	push   %ebp
+  800bc8:	89 e5                	mov    %esp,%ebp
+  800bca:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bcd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bd1:	eb 03                	jmp    800bd6 <strchr+0xf>
+  800bd3:	83 c0 01             	add    $0x1,%eax
+  800bd6:	0f b6 10             	movzbl (%eax),%edx
+  800bd9:	84 d2                	test   %dl,%dl
+  800bdb:	74 06                	je     800be3 <strchr+0x1c>
+		if (*s == c)
+  800bdd:	38 ca                	cmp    %cl,%dl
+  800bdf:	75 f2                	jne    800bd3 <strchr+0xc>
+  800be1:	eb 05                	jmp    800be8 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800be3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800be8:	5d                   	pop    %ebp
+  800be9:	c3                   	ret
+
+00800bea <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bea:	55                   	push   %ebp
+  800beb:	89 e5                	mov    %esp,%ebp
+  800bed:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bf4:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bf7:	38 ca                	cmp    %cl,%dl
+  800bf9:	74 09                	je     800c04 <strfind+0x1a>
+  800bfb:	84 d2                	test   %dl,%dl
+  800bfd:	74 05                	je     800c04 <strfind+0x1a>
+	for (; *s; s++)
+  800bff:	83 c0 01             	add    $0x1,%eax
+  800c02:	eb f0                	jmp    800bf4 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800c04:	5d                   	pop    %ebp
+  800c05:	c3                   	ret
+
+00800c06 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c06:	55                   	push   %ebp
+  800c07:	89 e5                	mov    %esp,%ebp
+  800c09:	57                   	push   %edi
+  800c0a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c0d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c10:	85 c9                	test   %ecx,%ecx
+  800c12:	74 20                	je     800c34 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c14:	89 f8                	mov    %edi,%eax
+  800c16:	09 c8                	or     %ecx,%eax
+  800c18:	a8 03                	test   $0x3,%al
+  800c1a:	75 12                	jne    800c2e <memset+0x28>
+		c &= 0xFF;
+  800c1c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c20:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c26:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c29:	fc                   	cld
+  800c2a:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c2c:	eb 06                	jmp    800c34 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c31:	fc                   	cld
+  800c32:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c34:	89 f8                	mov    %edi,%eax
+  800c36:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c39:	c9                   	leave
+  800c3a:	c3                   	ret
+
+00800c3b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c3b:	55                   	push   %ebp
+  800c3c:	89 e5                	mov    %esp,%ebp
+  800c3e:	57                   	push   %edi
+  800c3f:	56                   	push   %esi
+  800c40:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c43:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c46:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c49:	39 c6                	cmp    %eax,%esi
+  800c4b:	73 32                	jae    800c7f <memmove+0x44>
+  800c4d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c50:	39 d0                	cmp    %edx,%eax
+  800c52:	73 2b                	jae    800c7f <memmove+0x44>
+		s += n;
+		d += n;
+  800c54:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c57:	89 d6                	mov    %edx,%esi
+  800c59:	09 fe                	or     %edi,%esi
+  800c5b:	09 ce                	or     %ecx,%esi
+  800c5d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c63:	75 0e                	jne    800c73 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c65:	83 ef 04             	sub    $0x4,%edi
+  800c68:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c6b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c6e:	fd                   	std
+  800c6f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c71:	eb 09                	jmp    800c7c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c73:	83 ef 01             	sub    $0x1,%edi
+  800c76:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c79:	fd                   	std
+  800c7a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c7c:	fc                   	cld
+  800c7d:	eb 1a                	jmp    800c99 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c7f:	89 f2                	mov    %esi,%edx
+  800c81:	09 c2                	or     %eax,%edx
+  800c83:	09 ca                	or     %ecx,%edx
+  800c85:	f6 c2 03             	test   $0x3,%dl
+  800c88:	75 0a                	jne    800c94 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c8a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c8d:	89 c7                	mov    %eax,%edi
+  800c8f:	fc                   	cld
+  800c90:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c92:	eb 05                	jmp    800c99 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c94:	89 c7                	mov    %eax,%edi
+  800c96:	fc                   	cld
+  800c97:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c99:	5e                   	pop    %esi
+  800c9a:	5f                   	pop    %edi
+  800c9b:	5d                   	pop    %ebp
+  800c9c:	c3                   	ret
+
+00800c9d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c9d:	55                   	push   %ebp
+  800c9e:	89 e5                	mov    %esp,%ebp
+  800ca0:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ca3:	ff 75 10             	push   0x10(%ebp)
+  800ca6:	ff 75 0c             	push   0xc(%ebp)
+  800ca9:	ff 75 08             	push   0x8(%ebp)
+  800cac:	e8 8a ff ff ff       	call   800c3b <memmove>
+}
+  800cb1:	c9                   	leave
+  800cb2:	c3                   	ret
+
+00800cb3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800cb3:	55                   	push   %ebp
+  800cb4:	89 e5                	mov    %esp,%ebp
+  800cb6:	56                   	push   %esi
+  800cb7:	53                   	push   %ebx
+  800cb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cbb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800cbe:	89 c6                	mov    %eax,%esi
+  800cc0:	03 75 10             	add    0x10(%ebp),%esi
+  800cc3:	eb 06                	jmp    800ccb <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800cc5:	83 c0 01             	add    $0x1,%eax
+  800cc8:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ccb:	39 f0                	cmp    %esi,%eax
+  800ccd:	74 14                	je     800ce3 <memcmp+0x30>
+		if (*s1 != *s2)
+  800ccf:	0f b6 08             	movzbl (%eax),%ecx
+  800cd2:	0f b6 1a             	movzbl (%edx),%ebx
+  800cd5:	38 d9                	cmp    %bl,%cl
+  800cd7:	74 ec                	je     800cc5 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800cd9:	0f b6 c1             	movzbl %cl,%eax
+  800cdc:	0f b6 db             	movzbl %bl,%ebx
+  800cdf:	29 d8                	sub    %ebx,%eax
+  800ce1:	eb 05                	jmp    800ce8 <memcmp+0x35>
+	}
+
+	return 0;
+  800ce3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ce8:	5b                   	pop    %ebx
+  800ce9:	5e                   	pop    %esi
+  800cea:	5d                   	pop    %ebp
+  800ceb:	c3                   	ret
+
+00800cec <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cec:	55                   	push   %ebp
+  800ced:	89 e5                	mov    %esp,%ebp
+  800cef:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800cf5:	89 c2                	mov    %eax,%edx
+  800cf7:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cfa:	eb 03                	jmp    800cff <memfind+0x13>
+  800cfc:	83 c0 01             	add    $0x1,%eax
+  800cff:	39 d0                	cmp    %edx,%eax
+  800d01:	73 04                	jae    800d07 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800d03:	38 08                	cmp    %cl,(%eax)
+  800d05:	75 f5                	jne    800cfc <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800d07:	5d                   	pop    %ebp
+  800d08:	c3                   	ret
+
+00800d09 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d09:	55                   	push   %ebp
+  800d0a:	89 e5                	mov    %esp,%ebp
+  800d0c:	57                   	push   %edi
+  800d0d:	56                   	push   %esi
+  800d0e:	53                   	push   %ebx
+  800d0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d12:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d15:	eb 03                	jmp    800d1a <strtol+0x11>
+		s++;
+  800d17:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d1a:	0f b6 02             	movzbl (%edx),%eax
+  800d1d:	3c 20                	cmp    $0x20,%al
+  800d1f:	74 f6                	je     800d17 <strtol+0xe>
+  800d21:	3c 09                	cmp    $0x9,%al
+  800d23:	74 f2                	je     800d17 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d25:	3c 2b                	cmp    $0x2b,%al
+  800d27:	74 2a                	je     800d53 <strtol+0x4a>
+	int neg = 0;
+  800d29:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d2e:	3c 2d                	cmp    $0x2d,%al
+  800d30:	74 2b                	je     800d5d <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d32:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d38:	75 0f                	jne    800d49 <strtol+0x40>
+  800d3a:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d3d:	74 28                	je     800d67 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d3f:	85 db                	test   %ebx,%ebx
+  800d41:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d46:	0f 44 d8             	cmove  %eax,%ebx
+  800d49:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d4e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d51:	eb 46                	jmp    800d99 <strtol+0x90>
+		s++;
+  800d53:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d56:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d5b:	eb d5                	jmp    800d32 <strtol+0x29>
+		s++, neg = 1;
+  800d5d:	83 c2 01             	add    $0x1,%edx
+  800d60:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d65:	eb cb                	jmp    800d32 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d67:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d6b:	74 0e                	je     800d7b <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d6d:	85 db                	test   %ebx,%ebx
+  800d6f:	75 d8                	jne    800d49 <strtol+0x40>
+		s++, base = 8;
+  800d71:	83 c2 01             	add    $0x1,%edx
+  800d74:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d79:	eb ce                	jmp    800d49 <strtol+0x40>
+		s += 2, base = 16;
+  800d7b:	83 c2 02             	add    $0x2,%edx
+  800d7e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d83:	eb c4                	jmp    800d49 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d85:	0f be c0             	movsbl %al,%eax
+  800d88:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d8b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d8e:	7d 3a                	jge    800dca <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d90:	83 c2 01             	add    $0x1,%edx
+  800d93:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d97:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d99:	0f b6 02             	movzbl (%edx),%eax
+  800d9c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d9f:	89 f3                	mov    %esi,%ebx
+  800da1:	80 fb 09             	cmp    $0x9,%bl
+  800da4:	76 df                	jbe    800d85 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800da6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800da9:	89 f3                	mov    %esi,%ebx
+  800dab:	80 fb 19             	cmp    $0x19,%bl
+  800dae:	77 08                	ja     800db8 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800db0:	0f be c0             	movsbl %al,%eax
+  800db3:	83 e8 57             	sub    $0x57,%eax
+  800db6:	eb d3                	jmp    800d8b <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800db8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800dbb:	89 f3                	mov    %esi,%ebx
+  800dbd:	80 fb 19             	cmp    $0x19,%bl
+  800dc0:	77 08                	ja     800dca <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800dc2:	0f be c0             	movsbl %al,%eax
+  800dc5:	83 e8 37             	sub    $0x37,%eax
+  800dc8:	eb c1                	jmp    800d8b <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800dca:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800dce:	74 05                	je     800dd5 <strtol+0xcc>
+		*endptr = (char *) s;
+  800dd0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dd3:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800dd5:	89 c8                	mov    %ecx,%eax
+  800dd7:	f7 d8                	neg    %eax
+  800dd9:	85 ff                	test   %edi,%edi
+  800ddb:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800dde:	89 c8                	mov    %ecx,%eax
+  800de0:	5b                   	pop    %ebx
+  800de1:	5e                   	pop    %esi
+  800de2:	5f                   	pop    %edi
+  800de3:	5d                   	pop    %ebp
+  800de4:	c3                   	ret
+
+00800de5 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+  800de8:	57                   	push   %edi
+  800de9:	56                   	push   %esi
+  800dea:	53                   	push   %ebx
+  800deb:	83 ec 0c             	sub    $0xc,%esp
+  800dee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800df1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800df4:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800df7:	85 ff                	test   %edi,%edi
+  800df9:	74 16                	je     800e11 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800dfb:	83 ec 04             	sub    $0x4,%esp
+  800dfe:	56                   	push   %esi
+  800dff:	6a 00                	push   $0x0
+  800e01:	53                   	push   %ebx
+  800e02:	e8 02 ff ff ff       	call   800d09 <strtol>
+  800e07:	89 07                	mov    %eax,(%edi)
+  800e09:	83 c4 10             	add    $0x10,%esp
+  800e0c:	eb 03                	jmp    800e11 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800e0e:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800e11:	0f b6 03             	movzbl (%ebx),%eax
+  800e14:	3c 20                	cmp    $0x20,%al
+  800e16:	74 f6                	je     800e0e <strisl+0x29>
+  800e18:	3c 09                	cmp    $0x9,%al
+  800e1a:	74 f2                	je     800e0e <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e1c:	3c 2b                	cmp    $0x2b,%al
+  800e1e:	74 23                	je     800e43 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800e20:	3c 2d                	cmp    $0x2d,%al
+  800e22:	0f 94 c0             	sete   %al
+  800e25:	0f b6 c0             	movzbl %al,%eax
+  800e28:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e2a:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800e30:	75 41                	jne    800e73 <strisl+0x8e>
+  800e32:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800e35:	74 11                	je     800e48 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e37:	85 f6                	test   %esi,%esi
+  800e39:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e3e:	0f 44 f0             	cmove  %eax,%esi
+  800e41:	eb 30                	jmp    800e73 <strisl+0x8e>
+		s++;
+  800e43:	83 c3 01             	add    $0x1,%ebx
+  800e46:	eb e2                	jmp    800e2a <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e48:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800e4c:	74 0e                	je     800e5c <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800e4e:	85 f6                	test   %esi,%esi
+  800e50:	75 21                	jne    800e73 <strisl+0x8e>
+		s++, base = 8;
+  800e52:	83 c3 01             	add    $0x1,%ebx
+  800e55:	be 08 00 00 00       	mov    $0x8,%esi
+  800e5a:	eb 17                	jmp    800e73 <strisl+0x8e>
+		s += 2, base = 16;
+  800e5c:	83 c3 02             	add    $0x2,%ebx
+  800e5f:	be 10 00 00 00       	mov    $0x10,%esi
+  800e64:	eb 0d                	jmp    800e73 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e66:	0f be c0             	movsbl %al,%eax
+  800e69:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800e6c:	39 f0                	cmp    %esi,%eax
+  800e6e:	7d 38                	jge    800ea8 <strisl+0xc3>
+			return 0;
+		s++;
+  800e70:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800e73:	0f b6 03             	movzbl (%ebx),%eax
+  800e76:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800e79:	80 fa 09             	cmp    $0x9,%dl
+  800e7c:	76 e8                	jbe    800e66 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800e7e:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800e81:	80 fa 19             	cmp    $0x19,%dl
+  800e84:	77 08                	ja     800e8e <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800e86:	0f be c0             	movsbl %al,%eax
+  800e89:	83 e8 57             	sub    $0x57,%eax
+  800e8c:	eb de                	jmp    800e6c <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e8e:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800e91:	80 fa 19             	cmp    $0x19,%dl
+  800e94:	77 08                	ja     800e9e <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800e96:	0f be c0             	movsbl %al,%eax
+  800e99:	83 e8 37             	sub    $0x37,%eax
+  800e9c:	eb ce                	jmp    800e6c <strisl+0x87>
+		else if (!*s)
+  800e9e:	84 c0                	test   %al,%al
+  800ea0:	0f 94 c0             	sete   %al
+  800ea3:	0f b6 c0             	movzbl %al,%eax
+  800ea6:	eb 05                	jmp    800ead <strisl+0xc8>
+			return 0;
+  800ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800ead:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb0:	5b                   	pop    %ebx
+  800eb1:	5e                   	pop    %esi
+  800eb2:	5f                   	pop    %edi
+  800eb3:	5d                   	pop    %ebp
+  800eb4:	c3                   	ret
+
+00800eb5 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800eb5:	55                   	push   %ebp
+  800eb6:	89 e5                	mov    %esp,%ebp
+  800eb8:	83 ec 10             	sub    $0x10,%esp
+  800ebb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800ebe:	89 c8                	mov    %ecx,%eax
+  800ec0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800ec5:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800ec8:	eb 0b                	jmp    800ed5 <touch_mem+0x20>
+		c = *(char *)page;
+  800eca:	0f b6 10             	movzbl (%eax),%edx
+  800ecd:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800ed0:	05 00 10 00 00       	add    $0x1000,%eax
+  800ed5:	39 c8                	cmp    %ecx,%eax
+  800ed7:	72 f1                	jb     800eca <touch_mem+0x15>
+}
+  800ed9:	c9                   	leave
+  800eda:	c3                   	ret
+
+00800edb <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800edb:	55                   	push   %ebp
+  800edc:	89 e5                	mov    %esp,%ebp
+  800ede:	57                   	push   %edi
+  800edf:	56                   	push   %esi
+  800ee0:	53                   	push   %ebx
+	touch_mem(s, len);
+  800ee1:	ff 75 0c             	push   0xc(%ebp)
+  800ee4:	ff 75 08             	push   0x8(%ebp)
+  800ee7:	e8 c9 ff ff ff       	call   800eb5 <touch_mem>
+	asm volatile("int %1\n"
+  800eec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ef1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef7:	89 c3                	mov    %eax,%ebx
+  800ef9:	89 c7                	mov    %eax,%edi
+  800efb:	89 c6                	mov    %eax,%esi
+  800efd:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800eff:	83 c4 08             	add    $0x8,%esp
+  800f02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f05:	5b                   	pop    %ebx
+  800f06:	5e                   	pop    %esi
+  800f07:	5f                   	pop    %edi
+  800f08:	5d                   	pop    %ebp
+  800f09:	c3                   	ret
+
+00800f0a <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f0a:	55                   	push   %ebp
+  800f0b:	89 e5                	mov    %esp,%ebp
+  800f0d:	57                   	push   %edi
+  800f0e:	56                   	push   %esi
+  800f0f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f10:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f15:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f1a:	89 d1                	mov    %edx,%ecx
+  800f1c:	89 d3                	mov    %edx,%ebx
+  800f1e:	89 d7                	mov    %edx,%edi
+  800f20:	89 d6                	mov    %edx,%esi
+  800f22:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f24:	5b                   	pop    %ebx
+  800f25:	5e                   	pop    %esi
+  800f26:	5f                   	pop    %edi
+  800f27:	5d                   	pop    %ebp
+  800f28:	c3                   	ret
+
+00800f29 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f29:	55                   	push   %ebp
+  800f2a:	89 e5                	mov    %esp,%ebp
+  800f2c:	57                   	push   %edi
+  800f2d:	56                   	push   %esi
+  800f2e:	53                   	push   %ebx
+  800f2f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f3f:	89 cb                	mov    %ecx,%ebx
+  800f41:	89 cf                	mov    %ecx,%edi
+  800f43:	89 ce                	mov    %ecx,%esi
+  800f45:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f47:	85 c0                	test   %eax,%eax
+  800f49:	7f 08                	jg     800f53 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4e:	5b                   	pop    %ebx
+  800f4f:	5e                   	pop    %esi
+  800f50:	5f                   	pop    %edi
+  800f51:	5d                   	pop    %ebp
+  800f52:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f53:	83 ec 0c             	sub    $0xc,%esp
+  800f56:	50                   	push   %eax
+  800f57:	6a 03                	push   $0x3
+  800f59:	68 8b 34 80 00       	push   $0x80348b
+  800f5e:	6a 23                	push   $0x23
+  800f60:	68 a8 34 80 00       	push   $0x8034a8
+  800f65:	e8 89 f4 ff ff       	call   8003f3 <_panic>
+
+00800f6a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f6a:	55                   	push   %ebp
+  800f6b:	89 e5                	mov    %esp,%ebp
+  800f6d:	57                   	push   %edi
+  800f6e:	56                   	push   %esi
+  800f6f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f70:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f75:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f7a:	89 d1                	mov    %edx,%ecx
+  800f7c:	89 d3                	mov    %edx,%ebx
+  800f7e:	89 d7                	mov    %edx,%edi
+  800f80:	89 d6                	mov    %edx,%esi
+  800f82:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f84:	5b                   	pop    %ebx
+  800f85:	5e                   	pop    %esi
+  800f86:	5f                   	pop    %edi
+  800f87:	5d                   	pop    %ebp
+  800f88:	c3                   	ret
+
+00800f89 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f89:	55                   	push   %ebp
+  800f8a:	89 e5                	mov    %esp,%ebp
+  800f8c:	57                   	push   %edi
+  800f8d:	56                   	push   %esi
+  800f8e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f94:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f99:	89 d1                	mov    %edx,%ecx
+  800f9b:	89 d3                	mov    %edx,%ebx
+  800f9d:	89 d7                	mov    %edx,%edi
+  800f9f:	89 d6                	mov    %edx,%esi
+  800fa1:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800fa3:	5b                   	pop    %ebx
+  800fa4:	5e                   	pop    %esi
+  800fa5:	5f                   	pop    %edi
+  800fa6:	5d                   	pop    %ebp
+  800fa7:	c3                   	ret
+
+00800fa8 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800fa8:	55                   	push   %ebp
+  800fa9:	89 e5                	mov    %esp,%ebp
+  800fab:	57                   	push   %edi
+  800fac:	56                   	push   %esi
+  800fad:	53                   	push   %ebx
+  800fae:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fb1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbc:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fc1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc4:	89 f7                	mov    %esi,%edi
+  800fc6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc8:	85 c0                	test   %eax,%eax
+  800fca:	7f 08                	jg     800fd4 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800fcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fcf:	5b                   	pop    %ebx
+  800fd0:	5e                   	pop    %esi
+  800fd1:	5f                   	pop    %edi
+  800fd2:	5d                   	pop    %ebp
+  800fd3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd4:	83 ec 0c             	sub    $0xc,%esp
+  800fd7:	50                   	push   %eax
+  800fd8:	6a 04                	push   $0x4
+  800fda:	68 8b 34 80 00       	push   $0x80348b
+  800fdf:	6a 23                	push   $0x23
+  800fe1:	68 a8 34 80 00       	push   $0x8034a8
+  800fe6:	e8 08 f4 ff ff       	call   8003f3 <_panic>
+
+00800feb <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800feb:	55                   	push   %ebp
+  800fec:	89 e5                	mov    %esp,%ebp
+  800fee:	57                   	push   %edi
+  800fef:	56                   	push   %esi
+  800ff0:	53                   	push   %ebx
+  800ff1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ff4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffa:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801002:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801005:	8b 75 18             	mov    0x18(%ebp),%esi
+  801008:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80100a:	85 c0                	test   %eax,%eax
+  80100c:	7f 08                	jg     801016 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80100e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801011:	5b                   	pop    %ebx
+  801012:	5e                   	pop    %esi
+  801013:	5f                   	pop    %edi
+  801014:	5d                   	pop    %ebp
+  801015:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801016:	83 ec 0c             	sub    $0xc,%esp
+  801019:	50                   	push   %eax
+  80101a:	6a 05                	push   $0x5
+  80101c:	68 8b 34 80 00       	push   $0x80348b
+  801021:	6a 23                	push   $0x23
+  801023:	68 a8 34 80 00       	push   $0x8034a8
+  801028:	e8 c6 f3 ff ff       	call   8003f3 <_panic>
+
+0080102d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80102d:	55                   	push   %ebp
+  80102e:	89 e5                	mov    %esp,%ebp
+  801030:	57                   	push   %edi
+  801031:	56                   	push   %esi
+  801032:	53                   	push   %ebx
+  801033:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801036:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801041:	b8 06 00 00 00       	mov    $0x6,%eax
+  801046:	89 df                	mov    %ebx,%edi
+  801048:	89 de                	mov    %ebx,%esi
+  80104a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80104c:	85 c0                	test   %eax,%eax
+  80104e:	7f 08                	jg     801058 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801050:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801053:	5b                   	pop    %ebx
+  801054:	5e                   	pop    %esi
+  801055:	5f                   	pop    %edi
+  801056:	5d                   	pop    %ebp
+  801057:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801058:	83 ec 0c             	sub    $0xc,%esp
+  80105b:	50                   	push   %eax
+  80105c:	6a 06                	push   $0x6
+  80105e:	68 8b 34 80 00       	push   $0x80348b
+  801063:	6a 23                	push   $0x23
+  801065:	68 a8 34 80 00       	push   $0x8034a8
+  80106a:	e8 84 f3 ff ff       	call   8003f3 <_panic>
+
+0080106f <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  80106f:	55                   	push   %ebp
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	57                   	push   %edi
+  801073:	56                   	push   %esi
+  801074:	53                   	push   %ebx
+  801075:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801078:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801080:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801083:	b8 18 00 00 00       	mov    $0x18,%eax
+  801088:	89 df                	mov    %ebx,%edi
+  80108a:	89 de                	mov    %ebx,%esi
+  80108c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80108e:	85 c0                	test   %eax,%eax
+  801090:	7f 08                	jg     80109a <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801092:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801095:	5b                   	pop    %ebx
+  801096:	5e                   	pop    %esi
+  801097:	5f                   	pop    %edi
+  801098:	5d                   	pop    %ebp
+  801099:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109a:	83 ec 0c             	sub    $0xc,%esp
+  80109d:	50                   	push   %eax
+  80109e:	6a 18                	push   $0x18
+  8010a0:	68 8b 34 80 00       	push   $0x80348b
+  8010a5:	6a 23                	push   $0x23
+  8010a7:	68 a8 34 80 00       	push   $0x8034a8
+  8010ac:	e8 42 f3 ff ff       	call   8003f3 <_panic>
+
+008010b1 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  8010b1:	55                   	push   %ebp
+  8010b2:	89 e5                	mov    %esp,%ebp
+  8010b4:	57                   	push   %edi
+  8010b5:	56                   	push   %esi
+  8010b6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8010bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c2:	b8 19 00 00 00       	mov    $0x19,%eax
+  8010c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ca:	89 f7                	mov    %esi,%edi
+  8010cc:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  8010ce:	5b                   	pop    %ebx
+  8010cf:	5e                   	pop    %esi
+  8010d0:	5f                   	pop    %edi
+  8010d1:	5d                   	pop    %ebp
+  8010d2:	c3                   	ret
+
+008010d3 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8010d3:	55                   	push   %ebp
+  8010d4:	89 e5                	mov    %esp,%ebp
+  8010d6:	57                   	push   %edi
+  8010d7:	56                   	push   %esi
+  8010d8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010df:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ef:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8010f1:	5b                   	pop    %ebx
+  8010f2:	5e                   	pop    %esi
+  8010f3:	5f                   	pop    %edi
+  8010f4:	5d                   	pop    %ebp
+  8010f5:	c3                   	ret
+
+008010f6 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  8010f6:	55                   	push   %ebp
+  8010f7:	89 e5                	mov    %esp,%ebp
+  8010f9:	57                   	push   %edi
+  8010fa:	56                   	push   %esi
+  8010fb:	53                   	push   %ebx
+  8010fc:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  8010ff:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  801102:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801108:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  80110b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801111:	b8 10 00 00 00       	mov    $0x10,%eax
+  801116:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801119:	8b 75 18             	mov    0x18(%ebp),%esi
+  80111c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80111e:	85 c0                	test   %eax,%eax
+  801120:	7f 08                	jg     80112a <sys_page_map_range+0x34>
+}
+  801122:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801125:	5b                   	pop    %ebx
+  801126:	5e                   	pop    %esi
+  801127:	5f                   	pop    %edi
+  801128:	5d                   	pop    %ebp
+  801129:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80112a:	83 ec 0c             	sub    $0xc,%esp
+  80112d:	50                   	push   %eax
+  80112e:	6a 10                	push   $0x10
+  801130:	68 8b 34 80 00       	push   $0x80348b
+  801135:	6a 23                	push   $0x23
+  801137:	68 a8 34 80 00       	push   $0x8034a8
+  80113c:	e8 b2 f2 ff ff       	call   8003f3 <_panic>
+
+00801141 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  801141:	55                   	push   %ebp
+  801142:	89 e5                	mov    %esp,%ebp
+  801144:	57                   	push   %edi
+  801145:	56                   	push   %esi
+  801146:	53                   	push   %ebx
+  801147:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80114a:	be 00 00 00 00       	mov    $0x0,%esi
+  80114f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801152:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801155:	b8 11 00 00 00       	mov    $0x11,%eax
+  80115a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115d:	89 f7                	mov    %esi,%edi
+  80115f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801161:	85 c0                	test   %eax,%eax
+  801163:	7f 08                	jg     80116d <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  801165:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801168:	5b                   	pop    %ebx
+  801169:	5e                   	pop    %esi
+  80116a:	5f                   	pop    %edi
+  80116b:	5d                   	pop    %ebp
+  80116c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80116d:	83 ec 0c             	sub    $0xc,%esp
+  801170:	50                   	push   %eax
+  801171:	6a 11                	push   $0x11
+  801173:	68 8b 34 80 00       	push   $0x80348b
+  801178:	6a 23                	push   $0x23
+  80117a:	68 a8 34 80 00       	push   $0x8034a8
+  80117f:	e8 6f f2 ff ff       	call   8003f3 <_panic>
+
+00801184 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  801184:	55                   	push   %ebp
+  801185:	89 e5                	mov    %esp,%ebp
+  801187:	57                   	push   %edi
+  801188:	56                   	push   %esi
+  801189:	53                   	push   %ebx
+  80118a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80118d:	be 00 00 00 00       	mov    $0x0,%esi
+  801192:	8b 55 08             	mov    0x8(%ebp),%edx
+  801195:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801198:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80119d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a0:	89 f7                	mov    %esi,%edi
+  8011a2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011a4:	85 c0                	test   %eax,%eax
+  8011a6:	7f 08                	jg     8011b0 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8011a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ab:	5b                   	pop    %ebx
+  8011ac:	5e                   	pop    %esi
+  8011ad:	5f                   	pop    %edi
+  8011ae:	5d                   	pop    %ebp
+  8011af:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b0:	83 ec 0c             	sub    $0xc,%esp
+  8011b3:	50                   	push   %eax
+  8011b4:	6a 1b                	push   $0x1b
+  8011b6:	68 8b 34 80 00       	push   $0x80348b
+  8011bb:	6a 23                	push   $0x23
+  8011bd:	68 a8 34 80 00       	push   $0x8034a8
+  8011c2:	e8 2c f2 ff ff       	call   8003f3 <_panic>
+
+008011c7 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  8011c7:	55                   	push   %ebp
+  8011c8:	89 e5                	mov    %esp,%ebp
+  8011ca:	57                   	push   %edi
+  8011cb:	56                   	push   %esi
+  8011cc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d2:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011d7:	89 d1                	mov    %edx,%ecx
+  8011d9:	89 d3                	mov    %edx,%ebx
+  8011db:	89 d7                	mov    %edx,%edi
+  8011dd:	89 d6                	mov    %edx,%esi
+  8011df:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8011e1:	5b                   	pop    %ebx
+  8011e2:	5e                   	pop    %esi
+  8011e3:	5f                   	pop    %edi
+  8011e4:	5d                   	pop    %ebp
+  8011e5:	c3                   	ret
+
+008011e6 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8011e6:	55                   	push   %ebp
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	57                   	push   %edi
+  8011ea:	56                   	push   %esi
+  8011eb:	53                   	push   %ebx
+  8011ec:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011fa:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011ff:	89 df                	mov    %ebx,%edi
+  801201:	89 de                	mov    %ebx,%esi
+  801203:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801205:	85 c0                	test   %eax,%eax
+  801207:	7f 08                	jg     801211 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801209:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80120c:	5b                   	pop    %ebx
+  80120d:	5e                   	pop    %esi
+  80120e:	5f                   	pop    %edi
+  80120f:	5d                   	pop    %ebp
+  801210:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801211:	83 ec 0c             	sub    $0xc,%esp
+  801214:	50                   	push   %eax
+  801215:	6a 08                	push   $0x8
+  801217:	68 8b 34 80 00       	push   $0x80348b
+  80121c:	6a 23                	push   $0x23
+  80121e:	68 a8 34 80 00       	push   $0x8034a8
+  801223:	e8 cb f1 ff ff       	call   8003f3 <_panic>
+
+00801228 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801228:	55                   	push   %ebp
+  801229:	89 e5                	mov    %esp,%ebp
+  80122b:	57                   	push   %edi
+  80122c:	56                   	push   %esi
+  80122d:	53                   	push   %ebx
+  80122e:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  801231:	6a 44                	push   $0x44
+  801233:	ff 75 0c             	push   0xc(%ebp)
+  801236:	e8 7a fc ff ff       	call   800eb5 <touch_mem>
+	asm volatile("int %1\n"
+  80123b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801240:	8b 55 08             	mov    0x8(%ebp),%edx
+  801243:	b8 09 00 00 00       	mov    $0x9,%eax
+  801248:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124b:	89 df                	mov    %ebx,%edi
+  80124d:	89 de                	mov    %ebx,%esi
+  80124f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801251:	83 c4 08             	add    $0x8,%esp
+  801254:	85 c0                	test   %eax,%eax
+  801256:	7f 08                	jg     801260 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801258:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125b:	5b                   	pop    %ebx
+  80125c:	5e                   	pop    %esi
+  80125d:	5f                   	pop    %edi
+  80125e:	5d                   	pop    %ebp
+  80125f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801260:	83 ec 0c             	sub    $0xc,%esp
+  801263:	50                   	push   %eax
+  801264:	6a 09                	push   $0x9
+  801266:	68 8b 34 80 00       	push   $0x80348b
+  80126b:	6a 23                	push   $0x23
+  80126d:	68 a8 34 80 00       	push   $0x8034a8
+  801272:	e8 7c f1 ff ff       	call   8003f3 <_panic>
+
+00801277 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  801277:	55                   	push   %ebp
+  801278:	89 e5                	mov    %esp,%ebp
+  80127a:	57                   	push   %edi
+  80127b:	56                   	push   %esi
+  80127c:	53                   	push   %ebx
+  80127d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801280:	be 00 00 00 00       	mov    $0x0,%esi
+  801285:	8b 55 08             	mov    0x8(%ebp),%edx
+  801288:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801290:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801293:	89 f7                	mov    %esi,%edi
+  801295:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801297:	85 c0                	test   %eax,%eax
+  801299:	7f 08                	jg     8012a3 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  80129b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129e:	5b                   	pop    %ebx
+  80129f:	5e                   	pop    %esi
+  8012a0:	5f                   	pop    %edi
+  8012a1:	5d                   	pop    %ebp
+  8012a2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012a3:	83 ec 0c             	sub    $0xc,%esp
+  8012a6:	50                   	push   %eax
+  8012a7:	6a 1a                	push   $0x1a
+  8012a9:	68 8b 34 80 00       	push   $0x80348b
+  8012ae:	6a 23                	push   $0x23
+  8012b0:	68 a8 34 80 00       	push   $0x8034a8
+  8012b5:	e8 39 f1 ff ff       	call   8003f3 <_panic>
+
+008012ba <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8012ba:	55                   	push   %ebp
+  8012bb:	89 e5                	mov    %esp,%ebp
+  8012bd:	57                   	push   %edi
+  8012be:	56                   	push   %esi
+  8012bf:	53                   	push   %ebx
+  8012c0:	83 ec 0c             	sub    $0xc,%esp
+  8012c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8012c6:	89 d8                	mov    %ebx,%eax
+  8012c8:	c1 e0 05             	shl    $0x5,%eax
+  8012cb:	50                   	push   %eax
+  8012cc:	ff 75 0c             	push   0xc(%ebp)
+  8012cf:	e8 e1 fb ff ff       	call   800eb5 <touch_mem>
+	asm volatile("int %1\n"
+  8012d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012dc:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e4:	89 f7                	mov    %esi,%edi
+  8012e6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012e8:	83 c4 08             	add    $0x8,%esp
+  8012eb:	85 c0                	test   %eax,%eax
+  8012ed:	7f 08                	jg     8012f7 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8012ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f2:	5b                   	pop    %ebx
+  8012f3:	5e                   	pop    %esi
+  8012f4:	5f                   	pop    %edi
+  8012f5:	5d                   	pop    %ebp
+  8012f6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012f7:	83 ec 0c             	sub    $0xc,%esp
+  8012fa:	50                   	push   %eax
+  8012fb:	6a 13                	push   $0x13
+  8012fd:	68 8b 34 80 00       	push   $0x80348b
+  801302:	6a 23                	push   $0x23
+  801304:	68 a8 34 80 00       	push   $0x8034a8
+  801309:	e8 e5 f0 ff ff       	call   8003f3 <_panic>
+
+0080130e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80130e:	55                   	push   %ebp
+  80130f:	89 e5                	mov    %esp,%ebp
+  801311:	57                   	push   %edi
+  801312:	56                   	push   %esi
+  801313:	53                   	push   %ebx
+  801314:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801317:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801322:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801327:	89 df                	mov    %ebx,%edi
+  801329:	89 de                	mov    %ebx,%esi
+  80132b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80132d:	85 c0                	test   %eax,%eax
+  80132f:	7f 08                	jg     801339 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801331:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801334:	5b                   	pop    %ebx
+  801335:	5e                   	pop    %esi
+  801336:	5f                   	pop    %edi
+  801337:	5d                   	pop    %ebp
+  801338:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801339:	83 ec 0c             	sub    $0xc,%esp
+  80133c:	50                   	push   %eax
+  80133d:	6a 0a                	push   $0xa
+  80133f:	68 8b 34 80 00       	push   $0x80348b
+  801344:	6a 23                	push   $0x23
+  801346:	68 a8 34 80 00       	push   $0x8034a8
+  80134b:	e8 a3 f0 ff ff       	call   8003f3 <_panic>
+
+00801350 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801350:	55                   	push   %ebp
+  801351:	89 e5                	mov    %esp,%ebp
+  801353:	57                   	push   %edi
+  801354:	56                   	push   %esi
+  801355:	53                   	push   %ebx
+  801356:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801359:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80135f:	76 1d                	jbe    80137e <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  801361:	8b 55 08             	mov    0x8(%ebp),%edx
+  801364:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801367:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80136c:	be 01 00 00 00       	mov    $0x1,%esi
+  801371:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801374:	cd 30                	int    $0x30
+}
+  801376:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801379:	5b                   	pop    %ebx
+  80137a:	5e                   	pop    %esi
+  80137b:	5f                   	pop    %edi
+  80137c:	5d                   	pop    %ebp
+  80137d:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80137e:	68 00 10 00 00       	push   $0x1000
+  801383:	53                   	push   %ebx
+  801384:	e8 2c fb ff ff       	call   800eb5 <touch_mem>
+  801389:	83 c4 08             	add    $0x8,%esp
+  80138c:	eb d3                	jmp    801361 <sys_ipc_send+0x11>
+
+0080138e <sys_ipc_send_pages>:
+{
+  80138e:	55                   	push   %ebp
+  80138f:	89 e5                	mov    %esp,%ebp
+  801391:	57                   	push   %edi
+  801392:	56                   	push   %esi
+  801393:	53                   	push   %ebx
+  801394:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801397:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  80139a:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8013a0:	76 18                	jbe    8013ba <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8013a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013ad:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8013b0:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8013b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b5:	5b                   	pop    %ebx
+  8013b6:	5e                   	pop    %esi
+  8013b7:	5f                   	pop    %edi
+  8013b8:	5d                   	pop    %ebp
+  8013b9:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8013ba:	89 f0                	mov    %esi,%eax
+  8013bc:	c1 e0 0c             	shl    $0xc,%eax
+  8013bf:	50                   	push   %eax
+  8013c0:	53                   	push   %ebx
+  8013c1:	e8 ef fa ff ff       	call   800eb5 <touch_mem>
+  8013c6:	83 c4 08             	add    $0x8,%esp
+  8013c9:	eb d7                	jmp    8013a2 <sys_ipc_send_pages+0x14>
+
+008013cb <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8013cb:	55                   	push   %ebp
+  8013cc:	89 e5                	mov    %esp,%ebp
+  8013ce:	57                   	push   %edi
+  8013cf:	56                   	push   %esi
+  8013d0:	53                   	push   %ebx
+  8013d1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013df:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8013e4:	89 df                	mov    %ebx,%edi
+  8013e6:	89 de                	mov    %ebx,%esi
+  8013e8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013ea:	85 c0                	test   %eax,%eax
+  8013ec:	7f 08                	jg     8013f6 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8013ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f1:	5b                   	pop    %ebx
+  8013f2:	5e                   	pop    %esi
+  8013f3:	5f                   	pop    %edi
+  8013f4:	5d                   	pop    %ebp
+  8013f5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013f6:	83 ec 0c             	sub    $0xc,%esp
+  8013f9:	50                   	push   %eax
+  8013fa:	6a 0d                	push   $0xd
+  8013fc:	68 8b 34 80 00       	push   $0x80348b
+  801401:	6a 23                	push   $0x23
+  801403:	68 a8 34 80 00       	push   $0x8034a8
+  801408:	e8 e6 ef ff ff       	call   8003f3 <_panic>
+
+0080140d <sys_ipc_recv>:
+{
+  80140d:	55                   	push   %ebp
+  80140e:	89 e5                	mov    %esp,%ebp
+  801410:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801413:	6a 01                	push   $0x1
+  801415:	ff 75 08             	push   0x8(%ebp)
+  801418:	e8 ae ff ff ff       	call   8013cb <sys_ipc_recv_pages>
+}
+  80141d:	c9                   	leave
+  80141e:	c3                   	ret
+
+0080141f <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80141f:	55                   	push   %ebp
+  801420:	89 e5                	mov    %esp,%ebp
+  801422:	57                   	push   %edi
+  801423:	56                   	push   %esi
+  801424:	53                   	push   %ebx
+  801425:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801428:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80142b:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  80142e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801434:	77 04                	ja     80143a <sys_ipc_call+0x1b>
+  801436:	85 f6                	test   %esi,%esi
+  801438:	75 15                	jne    80144f <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  80143a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801440:	b8 14 00 00 00       	mov    $0x14,%eax
+  801445:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801447:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144a:	5b                   	pop    %ebx
+  80144b:	5e                   	pop    %esi
+  80144c:	5f                   	pop    %edi
+  80144d:	5d                   	pop    %ebp
+  80144e:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80144f:	89 f8                	mov    %edi,%eax
+  801451:	c1 e0 0c             	shl    $0xc,%eax
+  801454:	50                   	push   %eax
+  801455:	53                   	push   %ebx
+  801456:	e8 5a fa ff ff       	call   800eb5 <touch_mem>
+  80145b:	83 c4 08             	add    $0x8,%esp
+  80145e:	eb da                	jmp    80143a <sys_ipc_call+0x1b>
+
+00801460 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801460:	55                   	push   %ebp
+  801461:	89 e5                	mov    %esp,%ebp
+  801463:	57                   	push   %edi
+  801464:	56                   	push   %esi
+  801465:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801466:	8b 55 08             	mov    0x8(%ebp),%edx
+  801469:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80146c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801471:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801474:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801477:	8b 75 18             	mov    0x18(%ebp),%esi
+  80147a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80147c:	5b                   	pop    %ebx
+  80147d:	5e                   	pop    %esi
+  80147e:	5f                   	pop    %edi
+  80147f:	5d                   	pop    %ebp
+  801480:	c3                   	ret
+
+00801481 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  801481:	55                   	push   %ebp
+  801482:	89 e5                	mov    %esp,%ebp
+  801484:	57                   	push   %edi
+  801485:	56                   	push   %esi
+  801486:	53                   	push   %ebx
+  801487:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  80148a:	6a 04                	push   $0x4
+  80148c:	ff 75 08             	push   0x8(%ebp)
+  80148f:	e8 21 fa ff ff       	call   800eb5 <touch_mem>
+	asm volatile("int %1\n"
+  801494:	be 00 00 00 00       	mov    $0x0,%esi
+  801499:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149c:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014a7:	89 f7                	mov    %esi,%edi
+  8014a9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014ab:	83 c4 08             	add    $0x8,%esp
+  8014ae:	85 c0                	test   %eax,%eax
+  8014b0:	7f 08                	jg     8014ba <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8014b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b5:	5b                   	pop    %ebx
+  8014b6:	5e                   	pop    %esi
+  8014b7:	5f                   	pop    %edi
+  8014b8:	5d                   	pop    %ebp
+  8014b9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014ba:	83 ec 0c             	sub    $0xc,%esp
+  8014bd:	50                   	push   %eax
+  8014be:	6a 16                	push   $0x16
+  8014c0:	68 8b 34 80 00       	push   $0x80348b
+  8014c5:	6a 23                	push   $0x23
+  8014c7:	68 a8 34 80 00       	push   $0x8034a8
+  8014cc:	e8 22 ef ff ff       	call   8003f3 <_panic>
+
+008014d1 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8014d1:	55                   	push   %ebp
+  8014d2:	89 e5                	mov    %esp,%ebp
+  8014d4:	57                   	push   %edi
+  8014d5:	56                   	push   %esi
+  8014d6:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8014d7:	6a 04                	push   $0x4
+  8014d9:	ff 75 08             	push   0x8(%ebp)
+  8014dc:	e8 d4 f9 ff ff       	call   800eb5 <touch_mem>
+	asm volatile("int %1\n"
+  8014e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e9:	b8 17 00 00 00       	mov    $0x17,%eax
+  8014ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f1:	89 df                	mov    %ebx,%edi
+  8014f3:	89 de                	mov    %ebx,%esi
+  8014f5:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8014f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014fa:	5b                   	pop    %ebx
+  8014fb:	5e                   	pop    %esi
+  8014fc:	5f                   	pop    %edi
+  8014fd:	5d                   	pop    %ebp
+  8014fe:	c3                   	ret
+
+008014ff <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8014ff:	55                   	push   %ebp
+  801500:	89 e5                	mov    %esp,%ebp
+  801502:	57                   	push   %edi
+  801503:	56                   	push   %esi
+  801504:	53                   	push   %ebx
+  801505:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801508:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801510:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801515:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80151a:	89 df                	mov    %ebx,%edi
+  80151c:	89 de                	mov    %ebx,%esi
+  80151e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801520:	85 c0                	test   %eax,%eax
+  801522:	7f 08                	jg     80152c <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801524:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801527:	5b                   	pop    %ebx
+  801528:	5e                   	pop    %esi
+  801529:	5f                   	pop    %edi
+  80152a:	5d                   	pop    %ebp
+  80152b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80152c:	83 ec 0c             	sub    $0xc,%esp
+  80152f:	50                   	push   %eax
+  801530:	6a 0e                	push   $0xe
+  801532:	68 8b 34 80 00       	push   $0x80348b
+  801537:	6a 23                	push   $0x23
+  801539:	68 a8 34 80 00       	push   $0x8034a8
+  80153e:	e8 b0 ee ff ff       	call   8003f3 <_panic>
+
+00801543 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801543:	55                   	push   %ebp
+  801544:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801546:	8b 45 08             	mov    0x8(%ebp),%eax
+  801549:	05 00 00 00 30       	add    $0x30000000,%eax
+  80154e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801551:	5d                   	pop    %ebp
+  801552:	c3                   	ret
+
+00801553 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801553:	55                   	push   %ebp
+  801554:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801556:	8b 45 08             	mov    0x8(%ebp),%eax
+  801559:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80155e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801563:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801568:	5d                   	pop    %ebp
+  801569:	c3                   	ret
+
+0080156a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80156a:	55                   	push   %ebp
+  80156b:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  80156d:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801572:	a8 01                	test   $0x1,%al
+  801574:	74 3c                	je     8015b2 <fd_alloc+0x48>
+  801576:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80157b:	89 c2                	mov    %eax,%edx
+  80157d:	c1 ea 0c             	shr    $0xc,%edx
+  801580:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801587:	89 c1                	mov    %eax,%ecx
+  801589:	05 00 10 00 00       	add    $0x1000,%eax
+  80158e:	f6 c2 01             	test   $0x1,%dl
+  801591:	74 13                	je     8015a6 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801593:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801598:	75 e1                	jne    80157b <fd_alloc+0x11>
+  80159a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80159f:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8015a4:	eb 05                	jmp    8015ab <fd_alloc+0x41>
+			return 0;
+  8015a6:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8015ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ae:	89 0a                	mov    %ecx,(%edx)
+}
+  8015b0:	5d                   	pop    %ebp
+  8015b1:	c3                   	ret
+  8015b2:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8015b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015bc:	eb ed                	jmp    8015ab <fd_alloc+0x41>
+
+008015be <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8015be:	55                   	push   %ebp
+  8015bf:	89 e5                	mov    %esp,%ebp
+  8015c1:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8015c4:	83 f8 1f             	cmp    $0x1f,%eax
+  8015c7:	77 30                	ja     8015f9 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8015c9:	c1 e0 0c             	shl    $0xc,%eax
+  8015cc:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8015d1:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8015d7:	f6 c2 01             	test   $0x1,%dl
+  8015da:	74 24                	je     801600 <fd_lookup+0x42>
+  8015dc:	89 c2                	mov    %eax,%edx
+  8015de:	c1 ea 0c             	shr    $0xc,%edx
+  8015e1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015e8:	f6 c2 01             	test   $0x1,%dl
+  8015eb:	74 1a                	je     801607 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8015ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015f0:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8015f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015f7:	5d                   	pop    %ebp
+  8015f8:	c3                   	ret
+		return -E_INVAL;
+  8015f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015fe:	eb f7                	jmp    8015f7 <fd_lookup+0x39>
+		return -E_INVAL;
+  801600:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801605:	eb f0                	jmp    8015f7 <fd_lookup+0x39>
+  801607:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80160c:	eb e9                	jmp    8015f7 <fd_lookup+0x39>
+
+0080160e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80160e:	55                   	push   %ebp
+  80160f:	89 e5                	mov    %esp,%ebp
+  801611:	53                   	push   %ebx
+  801612:	83 ec 04             	sub    $0x4,%esp
+  801615:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801618:	b8 34 35 80 00       	mov    $0x803534,%eax
+  80161d:	8b 18                	mov    (%eax),%ebx
+  80161f:	85 db                	test   %ebx,%ebx
+  801621:	74 0e                	je     801631 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801623:	83 c0 04             	add    $0x4,%eax
+  801626:	39 13                	cmp    %edx,(%ebx)
+  801628:	75 f3                	jne    80161d <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  80162a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162f:	eb 1f                	jmp    801650 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801631:	a1 94 77 80 00       	mov    0x807794,%eax
+  801636:	8b 40 48             	mov    0x48(%eax),%eax
+  801639:	83 ec 04             	sub    $0x4,%esp
+  80163c:	52                   	push   %edx
+  80163d:	50                   	push   %eax
+  80163e:	68 b8 34 80 00       	push   $0x8034b8
+  801643:	e8 86 ee ff ff       	call   8004ce <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801648:	83 c4 10             	add    $0x10,%esp
+  80164b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801650:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801653:	89 1a                	mov    %ebx,(%edx)
+}
+  801655:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801658:	c9                   	leave
+  801659:	c3                   	ret
+
+0080165a <fd_close>:
+{
+  80165a:	55                   	push   %ebp
+  80165b:	89 e5                	mov    %esp,%ebp
+  80165d:	57                   	push   %edi
+  80165e:	56                   	push   %esi
+  80165f:	53                   	push   %ebx
+  801660:	83 ec 24             	sub    $0x24,%esp
+  801663:	8b 75 08             	mov    0x8(%ebp),%esi
+  801666:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801669:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80166c:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80166d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801673:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801676:	50                   	push   %eax
+  801677:	e8 42 ff ff ff       	call   8015be <fd_lookup>
+  80167c:	89 c3                	mov    %eax,%ebx
+  80167e:	83 c4 10             	add    $0x10,%esp
+  801681:	85 c0                	test   %eax,%eax
+  801683:	78 05                	js     80168a <fd_close+0x30>
+	    || fd != fd2)
+  801685:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801688:	74 16                	je     8016a0 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80168a:	89 f8                	mov    %edi,%eax
+  80168c:	84 c0                	test   %al,%al
+  80168e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801693:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801696:	89 d8                	mov    %ebx,%eax
+  801698:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80169b:	5b                   	pop    %ebx
+  80169c:	5e                   	pop    %esi
+  80169d:	5f                   	pop    %edi
+  80169e:	5d                   	pop    %ebp
+  80169f:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016a0:	83 ec 08             	sub    $0x8,%esp
+  8016a3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8016a6:	50                   	push   %eax
+  8016a7:	ff 36                	push   (%esi)
+  8016a9:	e8 60 ff ff ff       	call   80160e <dev_lookup>
+  8016ae:	89 c3                	mov    %eax,%ebx
+  8016b0:	83 c4 10             	add    $0x10,%esp
+  8016b3:	85 c0                	test   %eax,%eax
+  8016b5:	78 1a                	js     8016d1 <fd_close+0x77>
+		if (dev->dev_close)
+  8016b7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016ba:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8016bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8016c2:	85 c0                	test   %eax,%eax
+  8016c4:	74 0b                	je     8016d1 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8016c6:	83 ec 0c             	sub    $0xc,%esp
+  8016c9:	56                   	push   %esi
+  8016ca:	ff d0                	call   *%eax
+  8016cc:	89 c3                	mov    %eax,%ebx
+  8016ce:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8016d1:	83 ec 08             	sub    $0x8,%esp
+  8016d4:	56                   	push   %esi
+  8016d5:	6a 00                	push   $0x0
+  8016d7:	e8 51 f9 ff ff       	call   80102d <sys_page_unmap>
+	return r;
+  8016dc:	83 c4 10             	add    $0x10,%esp
+  8016df:	eb b5                	jmp    801696 <fd_close+0x3c>
+
+008016e1 <close>:
+
+int
+close(int fdnum)
+{
+  8016e1:	55                   	push   %ebp
+  8016e2:	89 e5                	mov    %esp,%ebp
+  8016e4:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ea:	50                   	push   %eax
+  8016eb:	ff 75 08             	push   0x8(%ebp)
+  8016ee:	e8 cb fe ff ff       	call   8015be <fd_lookup>
+  8016f3:	83 c4 10             	add    $0x10,%esp
+  8016f6:	85 c0                	test   %eax,%eax
+  8016f8:	79 02                	jns    8016fc <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8016fa:	c9                   	leave
+  8016fb:	c3                   	ret
+		return fd_close(fd, 1);
+  8016fc:	83 ec 08             	sub    $0x8,%esp
+  8016ff:	6a 01                	push   $0x1
+  801701:	ff 75 f4             	push   -0xc(%ebp)
+  801704:	e8 51 ff ff ff       	call   80165a <fd_close>
+  801709:	83 c4 10             	add    $0x10,%esp
+  80170c:	eb ec                	jmp    8016fa <close+0x19>
+
+0080170e <close_all>:
+
+void
+close_all(void)
+{
+  80170e:	55                   	push   %ebp
+  80170f:	89 e5                	mov    %esp,%ebp
+  801711:	53                   	push   %ebx
+  801712:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801715:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80171a:	83 ec 0c             	sub    $0xc,%esp
+  80171d:	53                   	push   %ebx
+  80171e:	e8 be ff ff ff       	call   8016e1 <close>
+	for (i = 0; i < MAXFD; i++)
+  801723:	83 c3 01             	add    $0x1,%ebx
+  801726:	83 c4 10             	add    $0x10,%esp
+  801729:	83 fb 20             	cmp    $0x20,%ebx
+  80172c:	75 ec                	jne    80171a <close_all+0xc>
+}
+  80172e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801731:	c9                   	leave
+  801732:	c3                   	ret
+
+00801733 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801733:	55                   	push   %ebp
+  801734:	89 e5                	mov    %esp,%ebp
+  801736:	57                   	push   %edi
+  801737:	56                   	push   %esi
+  801738:	53                   	push   %ebx
+  801739:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80173c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80173f:	50                   	push   %eax
+  801740:	ff 75 08             	push   0x8(%ebp)
+  801743:	e8 76 fe ff ff       	call   8015be <fd_lookup>
+  801748:	89 c3                	mov    %eax,%ebx
+  80174a:	83 c4 10             	add    $0x10,%esp
+  80174d:	85 c0                	test   %eax,%eax
+  80174f:	78 7f                	js     8017d0 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801751:	83 ec 0c             	sub    $0xc,%esp
+  801754:	ff 75 0c             	push   0xc(%ebp)
+  801757:	e8 85 ff ff ff       	call   8016e1 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80175c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80175f:	c1 e6 0c             	shl    $0xc,%esi
+  801762:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801768:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80176b:	89 3c 24             	mov    %edi,(%esp)
+  80176e:	e8 e0 fd ff ff       	call   801553 <fd2data>
+  801773:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801775:	89 34 24             	mov    %esi,(%esp)
+  801778:	e8 d6 fd ff ff       	call   801553 <fd2data>
+  80177d:	83 c4 10             	add    $0x10,%esp
+  801780:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801783:	89 d8                	mov    %ebx,%eax
+  801785:	c1 e8 16             	shr    $0x16,%eax
+  801788:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80178f:	a8 01                	test   $0x1,%al
+  801791:	74 11                	je     8017a4 <dup+0x71>
+  801793:	89 d8                	mov    %ebx,%eax
+  801795:	c1 e8 0c             	shr    $0xc,%eax
+  801798:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80179f:	f6 c2 01             	test   $0x1,%dl
+  8017a2:	75 36                	jne    8017da <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8017a4:	89 f8                	mov    %edi,%eax
+  8017a6:	c1 e8 0c             	shr    $0xc,%eax
+  8017a9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017b0:	83 ec 0c             	sub    $0xc,%esp
+  8017b3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017b8:	50                   	push   %eax
+  8017b9:	56                   	push   %esi
+  8017ba:	6a 00                	push   $0x0
+  8017bc:	57                   	push   %edi
+  8017bd:	6a 00                	push   $0x0
+  8017bf:	e8 27 f8 ff ff       	call   800feb <sys_page_map>
+  8017c4:	89 c3                	mov    %eax,%ebx
+  8017c6:	83 c4 20             	add    $0x20,%esp
+  8017c9:	85 c0                	test   %eax,%eax
+  8017cb:	78 33                	js     801800 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8017cd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8017d0:	89 d8                	mov    %ebx,%eax
+  8017d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017d5:	5b                   	pop    %ebx
+  8017d6:	5e                   	pop    %esi
+  8017d7:	5f                   	pop    %edi
+  8017d8:	5d                   	pop    %ebp
+  8017d9:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8017da:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017e1:	83 ec 0c             	sub    $0xc,%esp
+  8017e4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017e9:	50                   	push   %eax
+  8017ea:	ff 75 d4             	push   -0x2c(%ebp)
+  8017ed:	6a 00                	push   $0x0
+  8017ef:	53                   	push   %ebx
+  8017f0:	6a 00                	push   $0x0
+  8017f2:	e8 f4 f7 ff ff       	call   800feb <sys_page_map>
+  8017f7:	89 c3                	mov    %eax,%ebx
+  8017f9:	83 c4 20             	add    $0x20,%esp
+  8017fc:	85 c0                	test   %eax,%eax
+  8017fe:	79 a4                	jns    8017a4 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801800:	83 ec 08             	sub    $0x8,%esp
+  801803:	56                   	push   %esi
+  801804:	6a 00                	push   $0x0
+  801806:	e8 22 f8 ff ff       	call   80102d <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80180b:	83 c4 08             	add    $0x8,%esp
+  80180e:	ff 75 d4             	push   -0x2c(%ebp)
+  801811:	6a 00                	push   $0x0
+  801813:	e8 15 f8 ff ff       	call   80102d <sys_page_unmap>
+	return r;
+  801818:	83 c4 10             	add    $0x10,%esp
+  80181b:	eb b3                	jmp    8017d0 <dup+0x9d>
+
+0080181d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80181d:	55                   	push   %ebp
+  80181e:	89 e5                	mov    %esp,%ebp
+  801820:	56                   	push   %esi
+  801821:	53                   	push   %ebx
+  801822:	83 ec 18             	sub    $0x18,%esp
+  801825:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801828:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80182b:	50                   	push   %eax
+  80182c:	56                   	push   %esi
+  80182d:	e8 8c fd ff ff       	call   8015be <fd_lookup>
+  801832:	83 c4 10             	add    $0x10,%esp
+  801835:	85 c0                	test   %eax,%eax
+  801837:	78 3c                	js     801875 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801839:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80183c:	83 ec 08             	sub    $0x8,%esp
+  80183f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801842:	50                   	push   %eax
+  801843:	ff 33                	push   (%ebx)
+  801845:	e8 c4 fd ff ff       	call   80160e <dev_lookup>
+  80184a:	83 c4 10             	add    $0x10,%esp
+  80184d:	85 c0                	test   %eax,%eax
+  80184f:	78 24                	js     801875 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801851:	8b 43 08             	mov    0x8(%ebx),%eax
+  801854:	83 e0 03             	and    $0x3,%eax
+  801857:	83 f8 01             	cmp    $0x1,%eax
+  80185a:	74 20                	je     80187c <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80185c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80185f:	8b 40 08             	mov    0x8(%eax),%eax
+  801862:	85 c0                	test   %eax,%eax
+  801864:	74 37                	je     80189d <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801866:	83 ec 04             	sub    $0x4,%esp
+  801869:	ff 75 10             	push   0x10(%ebp)
+  80186c:	ff 75 0c             	push   0xc(%ebp)
+  80186f:	53                   	push   %ebx
+  801870:	ff d0                	call   *%eax
+  801872:	83 c4 10             	add    $0x10,%esp
+}
+  801875:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801878:	5b                   	pop    %ebx
+  801879:	5e                   	pop    %esi
+  80187a:	5d                   	pop    %ebp
+  80187b:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80187c:	a1 94 77 80 00       	mov    0x807794,%eax
+  801881:	8b 40 48             	mov    0x48(%eax),%eax
+  801884:	83 ec 04             	sub    $0x4,%esp
+  801887:	56                   	push   %esi
+  801888:	50                   	push   %eax
+  801889:	68 f9 34 80 00       	push   $0x8034f9
+  80188e:	e8 3b ec ff ff       	call   8004ce <cprintf>
+		return -E_INVAL;
+  801893:	83 c4 10             	add    $0x10,%esp
+  801896:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80189b:	eb d8                	jmp    801875 <read+0x58>
+		return -E_NOT_SUPP;
+  80189d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018a2:	eb d1                	jmp    801875 <read+0x58>
+
+008018a4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8018a4:	55                   	push   %ebp
+  8018a5:	89 e5                	mov    %esp,%ebp
+  8018a7:	57                   	push   %edi
+  8018a8:	56                   	push   %esi
+  8018a9:	53                   	push   %ebx
+  8018aa:	83 ec 0c             	sub    $0xc,%esp
+  8018ad:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8018b0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8018b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b8:	eb 02                	jmp    8018bc <readn+0x18>
+  8018ba:	01 c3                	add    %eax,%ebx
+  8018bc:	39 f3                	cmp    %esi,%ebx
+  8018be:	73 21                	jae    8018e1 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018c0:	83 ec 04             	sub    $0x4,%esp
+  8018c3:	89 f0                	mov    %esi,%eax
+  8018c5:	29 d8                	sub    %ebx,%eax
+  8018c7:	50                   	push   %eax
+  8018c8:	89 d8                	mov    %ebx,%eax
+  8018ca:	03 45 0c             	add    0xc(%ebp),%eax
+  8018cd:	50                   	push   %eax
+  8018ce:	57                   	push   %edi
+  8018cf:	e8 49 ff ff ff       	call   80181d <read>
+		if (m < 0)
+  8018d4:	83 c4 10             	add    $0x10,%esp
+  8018d7:	85 c0                	test   %eax,%eax
+  8018d9:	78 04                	js     8018df <readn+0x3b>
+			return m;
+		if (m == 0)
+  8018db:	75 dd                	jne    8018ba <readn+0x16>
+  8018dd:	eb 02                	jmp    8018e1 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018df:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8018e1:	89 d8                	mov    %ebx,%eax
+  8018e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e6:	5b                   	pop    %ebx
+  8018e7:	5e                   	pop    %esi
+  8018e8:	5f                   	pop    %edi
+  8018e9:	5d                   	pop    %ebp
+  8018ea:	c3                   	ret
+
+008018eb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8018eb:	55                   	push   %ebp
+  8018ec:	89 e5                	mov    %esp,%ebp
+  8018ee:	56                   	push   %esi
+  8018ef:	53                   	push   %ebx
+  8018f0:	83 ec 18             	sub    $0x18,%esp
+  8018f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018f6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018f9:	50                   	push   %eax
+  8018fa:	53                   	push   %ebx
+  8018fb:	e8 be fc ff ff       	call   8015be <fd_lookup>
+  801900:	83 c4 10             	add    $0x10,%esp
+  801903:	85 c0                	test   %eax,%eax
+  801905:	78 37                	js     80193e <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801907:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80190a:	83 ec 08             	sub    $0x8,%esp
+  80190d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801910:	50                   	push   %eax
+  801911:	ff 36                	push   (%esi)
+  801913:	e8 f6 fc ff ff       	call   80160e <dev_lookup>
+  801918:	83 c4 10             	add    $0x10,%esp
+  80191b:	85 c0                	test   %eax,%eax
+  80191d:	78 1f                	js     80193e <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80191f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801923:	74 20                	je     801945 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801925:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801928:	8b 40 0c             	mov    0xc(%eax),%eax
+  80192b:	85 c0                	test   %eax,%eax
+  80192d:	74 37                	je     801966 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80192f:	83 ec 04             	sub    $0x4,%esp
+  801932:	ff 75 10             	push   0x10(%ebp)
+  801935:	ff 75 0c             	push   0xc(%ebp)
+  801938:	56                   	push   %esi
+  801939:	ff d0                	call   *%eax
+  80193b:	83 c4 10             	add    $0x10,%esp
+}
+  80193e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801941:	5b                   	pop    %ebx
+  801942:	5e                   	pop    %esi
+  801943:	5d                   	pop    %ebp
+  801944:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801945:	a1 94 77 80 00       	mov    0x807794,%eax
+  80194a:	8b 40 48             	mov    0x48(%eax),%eax
+  80194d:	83 ec 04             	sub    $0x4,%esp
+  801950:	53                   	push   %ebx
+  801951:	50                   	push   %eax
+  801952:	68 15 35 80 00       	push   $0x803515
+  801957:	e8 72 eb ff ff       	call   8004ce <cprintf>
+		return -E_INVAL;
+  80195c:	83 c4 10             	add    $0x10,%esp
+  80195f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801964:	eb d8                	jmp    80193e <write+0x53>
+		return -E_NOT_SUPP;
+  801966:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80196b:	eb d1                	jmp    80193e <write+0x53>
+
+0080196d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80196d:	55                   	push   %ebp
+  80196e:	89 e5                	mov    %esp,%ebp
+  801970:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801973:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801976:	50                   	push   %eax
+  801977:	ff 75 08             	push   0x8(%ebp)
+  80197a:	e8 3f fc ff ff       	call   8015be <fd_lookup>
+  80197f:	83 c4 10             	add    $0x10,%esp
+  801982:	85 c0                	test   %eax,%eax
+  801984:	78 0e                	js     801994 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801986:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801989:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80198c:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80198f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801994:	c9                   	leave
+  801995:	c3                   	ret
+
+00801996 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801996:	55                   	push   %ebp
+  801997:	89 e5                	mov    %esp,%ebp
+  801999:	56                   	push   %esi
+  80199a:	53                   	push   %ebx
+  80199b:	83 ec 18             	sub    $0x18,%esp
+  80199e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019a1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019a4:	50                   	push   %eax
+  8019a5:	53                   	push   %ebx
+  8019a6:	e8 13 fc ff ff       	call   8015be <fd_lookup>
+  8019ab:	83 c4 10             	add    $0x10,%esp
+  8019ae:	85 c0                	test   %eax,%eax
+  8019b0:	78 34                	js     8019e6 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019b2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019b5:	83 ec 08             	sub    $0x8,%esp
+  8019b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019bb:	50                   	push   %eax
+  8019bc:	ff 36                	push   (%esi)
+  8019be:	e8 4b fc ff ff       	call   80160e <dev_lookup>
+  8019c3:	83 c4 10             	add    $0x10,%esp
+  8019c6:	85 c0                	test   %eax,%eax
+  8019c8:	78 1c                	js     8019e6 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019ca:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019ce:	74 1d                	je     8019ed <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8019d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019d3:	8b 40 18             	mov    0x18(%eax),%eax
+  8019d6:	85 c0                	test   %eax,%eax
+  8019d8:	74 34                	je     801a0e <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8019da:	83 ec 08             	sub    $0x8,%esp
+  8019dd:	ff 75 0c             	push   0xc(%ebp)
+  8019e0:	56                   	push   %esi
+  8019e1:	ff d0                	call   *%eax
+  8019e3:	83 c4 10             	add    $0x10,%esp
+}
+  8019e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019e9:	5b                   	pop    %ebx
+  8019ea:	5e                   	pop    %esi
+  8019eb:	5d                   	pop    %ebp
+  8019ec:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8019ed:	a1 94 77 80 00       	mov    0x807794,%eax
+  8019f2:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8019f5:	83 ec 04             	sub    $0x4,%esp
+  8019f8:	53                   	push   %ebx
+  8019f9:	50                   	push   %eax
+  8019fa:	68 d8 34 80 00       	push   $0x8034d8
+  8019ff:	e8 ca ea ff ff       	call   8004ce <cprintf>
+		return -E_INVAL;
+  801a04:	83 c4 10             	add    $0x10,%esp
+  801a07:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a0c:	eb d8                	jmp    8019e6 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801a0e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a13:	eb d1                	jmp    8019e6 <ftruncate+0x50>
+
+00801a15 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a15:	55                   	push   %ebp
+  801a16:	89 e5                	mov    %esp,%ebp
+  801a18:	56                   	push   %esi
+  801a19:	53                   	push   %ebx
+  801a1a:	83 ec 18             	sub    $0x18,%esp
+  801a1d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a20:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a23:	50                   	push   %eax
+  801a24:	ff 75 08             	push   0x8(%ebp)
+  801a27:	e8 92 fb ff ff       	call   8015be <fd_lookup>
+  801a2c:	83 c4 10             	add    $0x10,%esp
+  801a2f:	85 c0                	test   %eax,%eax
+  801a31:	78 49                	js     801a7c <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a33:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a36:	83 ec 08             	sub    $0x8,%esp
+  801a39:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a3c:	50                   	push   %eax
+  801a3d:	ff 36                	push   (%esi)
+  801a3f:	e8 ca fb ff ff       	call   80160e <dev_lookup>
+  801a44:	83 c4 10             	add    $0x10,%esp
+  801a47:	85 c0                	test   %eax,%eax
+  801a49:	78 31                	js     801a7c <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801a4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a4e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a52:	74 2f                	je     801a83 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a54:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a57:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a5e:	00 00 00 
+	stat->st_isdir = 0;
+  801a61:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a68:	00 00 00 
+	stat->st_dev = dev;
+  801a6b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801a71:	83 ec 08             	sub    $0x8,%esp
+  801a74:	53                   	push   %ebx
+  801a75:	56                   	push   %esi
+  801a76:	ff 50 14             	call   *0x14(%eax)
+  801a79:	83 c4 10             	add    $0x10,%esp
+}
+  801a7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a7f:	5b                   	pop    %ebx
+  801a80:	5e                   	pop    %esi
+  801a81:	5d                   	pop    %ebp
+  801a82:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a83:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a88:	eb f2                	jmp    801a7c <fstat+0x67>
+
+00801a8a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a8a:	55                   	push   %ebp
+  801a8b:	89 e5                	mov    %esp,%ebp
+  801a8d:	56                   	push   %esi
+  801a8e:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801a8f:	83 ec 08             	sub    $0x8,%esp
+  801a92:	6a 00                	push   $0x0
+  801a94:	ff 75 08             	push   0x8(%ebp)
+  801a97:	e8 bc 02 00 00       	call   801d58 <open>
+  801a9c:	89 c3                	mov    %eax,%ebx
+  801a9e:	83 c4 10             	add    $0x10,%esp
+  801aa1:	85 c0                	test   %eax,%eax
+  801aa3:	78 1b                	js     801ac0 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801aa5:	83 ec 08             	sub    $0x8,%esp
+  801aa8:	ff 75 0c             	push   0xc(%ebp)
+  801aab:	50                   	push   %eax
+  801aac:	e8 64 ff ff ff       	call   801a15 <fstat>
+  801ab1:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801ab3:	89 1c 24             	mov    %ebx,(%esp)
+  801ab6:	e8 26 fc ff ff       	call   8016e1 <close>
+	return r;
+  801abb:	83 c4 10             	add    $0x10,%esp
+  801abe:	89 f3                	mov    %esi,%ebx
+}
+  801ac0:	89 d8                	mov    %ebx,%eax
+  801ac2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ac5:	5b                   	pop    %ebx
+  801ac6:	5e                   	pop    %esi
+  801ac7:	5d                   	pop    %ebp
+  801ac8:	c3                   	ret
+
+00801ac9 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801ac9:	55                   	push   %ebp
+  801aca:	89 e5                	mov    %esp,%ebp
+  801acc:	57                   	push   %edi
+  801acd:	56                   	push   %esi
+  801ace:	53                   	push   %ebx
+  801acf:	83 ec 0c             	sub    $0xc,%esp
+  801ad2:	89 c7                	mov    %eax,%edi
+  801ad4:	89 d3                	mov    %edx,%ebx
+  801ad6:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801ad8:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801adf:	74 2d                	je     801b0e <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ae1:	6a 07                	push   $0x7
+  801ae3:	68 00 80 80 00       	push   $0x808000
+  801ae8:	57                   	push   %edi
+  801ae9:	ff 35 00 60 80 00    	push   0x806000
+  801aef:	e8 4b 11 00 00       	call   802c3f <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801af4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801afb:	6a 00                	push   $0x0
+  801afd:	56                   	push   %esi
+  801afe:	53                   	push   %ebx
+  801aff:	6a 00                	push   $0x0
+  801b01:	e8 eb 0f 00 00       	call   802af1 <ipc_recv_pages>
+}
+  801b06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b09:	5b                   	pop    %ebx
+  801b0a:	5e                   	pop    %esi
+  801b0b:	5f                   	pop    %edi
+  801b0c:	5d                   	pop    %ebp
+  801b0d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b0e:	83 ec 0c             	sub    $0xc,%esp
+  801b11:	6a 01                	push   $0x1
+  801b13:	e8 1c 12 00 00       	call   802d34 <ipc_find_env>
+  801b18:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b1d:	83 c4 10             	add    $0x10,%esp
+  801b20:	eb bf                	jmp    801ae1 <fsipc_pages+0x18>
+
+00801b22 <fsipc>:
+{
+  801b22:	55                   	push   %ebp
+  801b23:	89 e5                	mov    %esp,%ebp
+  801b25:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801b28:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b2d:	e8 97 ff ff ff       	call   801ac9 <fsipc_pages>
+}
+  801b32:	c9                   	leave
+  801b33:	c3                   	ret
+
+00801b34 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801b34:	55                   	push   %ebp
+  801b35:	89 e5                	mov    %esp,%ebp
+  801b37:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801b3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b3d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b40:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801b45:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b48:	a3 04 80 80 00       	mov    %eax,0x808004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801b4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b52:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b57:	e8 c6 ff ff ff       	call   801b22 <fsipc>
+}
+  801b5c:	c9                   	leave
+  801b5d:	c3                   	ret
+
+00801b5e <devfile_flush>:
+{
+  801b5e:	55                   	push   %ebp
+  801b5f:	89 e5                	mov    %esp,%ebp
+  801b61:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b64:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b67:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b6a:	a3 00 80 80 00       	mov    %eax,0x808000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801b6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b74:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b79:	e8 a4 ff ff ff       	call   801b22 <fsipc>
+}
+  801b7e:	c9                   	leave
+  801b7f:	c3                   	ret
+
+00801b80 <devfile_stat>:
+{
+  801b80:	55                   	push   %ebp
+  801b81:	89 e5                	mov    %esp,%ebp
+  801b83:	53                   	push   %ebx
+  801b84:	83 ec 04             	sub    $0x4,%esp
+  801b87:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b8d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b90:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801b95:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b9a:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b9f:	e8 7e ff ff ff       	call   801b22 <fsipc>
+  801ba4:	85 c0                	test   %eax,%eax
+  801ba6:	78 2c                	js     801bd4 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ba8:	83 ec 08             	sub    $0x8,%esp
+  801bab:	68 00 80 80 00       	push   $0x808000
+  801bb0:	53                   	push   %ebx
+  801bb1:	e8 ff ee ff ff       	call   800ab5 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801bb6:	a1 80 80 80 00       	mov    0x808080,%eax
+  801bbb:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801bc1:	a1 84 80 80 00       	mov    0x808084,%eax
+  801bc6:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801bcc:	83 c4 10             	add    $0x10,%esp
+  801bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bd7:	c9                   	leave
+  801bd8:	c3                   	ret
+
+00801bd9 <devfile_write>:
+{
+  801bd9:	55                   	push   %ebp
+  801bda:	89 e5                	mov    %esp,%ebp
+  801bdc:	83 ec 0c             	sub    $0xc,%esp
+  801bdf:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801be2:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801be7:	39 d0                	cmp    %edx,%eax
+  801be9:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801bec:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bef:	8b 52 0c             	mov    0xc(%edx),%edx
+  801bf2:	89 15 00 80 80 00    	mov    %edx,0x808000
+	fsipcbuf.write.req_n = n;
+  801bf8:	a3 04 80 80 00       	mov    %eax,0x808004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801bfd:	50                   	push   %eax
+  801bfe:	ff 75 0c             	push   0xc(%ebp)
+  801c01:	68 08 80 80 00       	push   $0x808008
+  801c06:	e8 30 f0 ff ff       	call   800c3b <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801c0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c10:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c15:	e8 08 ff ff ff       	call   801b22 <fsipc>
+}
+  801c1a:	c9                   	leave
+  801c1b:	c3                   	ret
+
+00801c1c <devfile_read>:
+{
+  801c1c:	55                   	push   %ebp
+  801c1d:	89 e5                	mov    %esp,%ebp
+  801c1f:	57                   	push   %edi
+  801c20:	56                   	push   %esi
+  801c21:	53                   	push   %ebx
+  801c22:	83 ec 1c             	sub    $0x1c,%esp
+  801c25:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801c28:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801c2b:	89 fe                	mov    %edi,%esi
+  801c2d:	c1 ee 0c             	shr    $0xc,%esi
+  801c30:	b8 20 00 00 00       	mov    $0x20,%eax
+  801c35:	39 c6                	cmp    %eax,%esi
+  801c37:	0f 47 f0             	cmova  %eax,%esi
+  801c3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c42:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801c45:	eb 14                	jmp    801c5b <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801c47:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801c4e:	05 00 10 00 00       	add    $0x1000,%eax
+  801c53:	f6 c6 06             	test   $0x6,%dh
+  801c56:	75 42                	jne    801c9a <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801c58:	83 c1 01             	add    $0x1,%ecx
+  801c5b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801c5e:	39 f1                	cmp    %esi,%ecx
+  801c60:	0f 84 95 00 00 00    	je     801cfb <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801c66:	89 c2                	mov    %eax,%edx
+  801c68:	c1 ea 16             	shr    $0x16,%edx
+  801c6b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801c72:	f6 c2 01             	test   $0x1,%dl
+  801c75:	74 23                	je     801c9a <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801c77:	89 c2                	mov    %eax,%edx
+  801c79:	c1 ea 0c             	shr    $0xc,%edx
+  801c7c:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801c83:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801c89:	74 0f                	je     801c9a <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801c8b:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801c92:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801c98:	75 ad                	jne    801c47 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801c9a:	85 c9                	test   %ecx,%ecx
+  801c9c:	74 11                	je     801caf <devfile_read+0x93>
+  801c9e:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801ca5:	75 08                	jne    801caf <devfile_read+0x93>
+  801ca7:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801cad:	74 50                	je     801cff <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801caf:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801cb2:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801cb7:	89 3d 04 80 80 00    	mov    %edi,0x808004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801cbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc2:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cc7:	e8 56 fe ff ff       	call   801b22 <fsipc>
+  801ccc:	89 c6                	mov    %eax,%esi
+  801cce:	85 c0                	test   %eax,%eax
+  801cd0:	78 1f                	js     801cf1 <devfile_read+0xd5>
+	assert(r <= n);
+  801cd2:	39 c7                	cmp    %eax,%edi
+  801cd4:	72 50                	jb     801d26 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801cd6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801cdb:	7f 62                	jg     801d3f <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801cdd:	83 ec 04             	sub    $0x4,%esp
+  801ce0:	50                   	push   %eax
+  801ce1:	68 00 80 80 00       	push   $0x808000
+  801ce6:	ff 75 0c             	push   0xc(%ebp)
+  801ce9:	e8 4d ef ff ff       	call   800c3b <memmove>
+	return r;
+  801cee:	83 c4 10             	add    $0x10,%esp
+}
+  801cf1:	89 f0                	mov    %esi,%eax
+  801cf3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf6:	5b                   	pop    %ebx
+  801cf7:	5e                   	pop    %esi
+  801cf8:	5f                   	pop    %edi
+  801cf9:	5d                   	pop    %ebp
+  801cfa:	c3                   	ret
+  801cfb:	89 f1                	mov    %esi,%ecx
+  801cfd:	eb 9b                	jmp    801c9a <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801cff:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801d02:	a3 00 80 80 00       	mov    %eax,0x808000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801d07:	89 c8                	mov    %ecx,%eax
+  801d09:	c1 e0 0c             	shl    $0xc,%eax
+  801d0c:	a3 04 80 80 00       	mov    %eax,0x808004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801d11:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d14:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801d19:	e8 ab fd ff ff       	call   801ac9 <fsipc_pages>
+  801d1e:	89 c6                	mov    %eax,%esi
+  801d20:	85 c0                	test   %eax,%eax
+  801d22:	78 8b                	js     801caf <devfile_read+0x93>
+  801d24:	eb cb                	jmp    801cf1 <devfile_read+0xd5>
+	assert(r <= n);
+  801d26:	68 44 35 80 00       	push   $0x803544
+  801d2b:	68 4b 35 80 00       	push   $0x80354b
+  801d30:	68 a0 00 00 00       	push   $0xa0
+  801d35:	68 60 35 80 00       	push   $0x803560
+  801d3a:	e8 b4 e6 ff ff       	call   8003f3 <_panic>
+	assert(r <= PGSIZE);
+  801d3f:	68 6b 35 80 00       	push   $0x80356b
+  801d44:	68 4b 35 80 00       	push   $0x80354b
+  801d49:	68 a1 00 00 00       	push   $0xa1
+  801d4e:	68 60 35 80 00       	push   $0x803560
+  801d53:	e8 9b e6 ff ff       	call   8003f3 <_panic>
+
+00801d58 <open>:
+{
+  801d58:	55                   	push   %ebp
+  801d59:	89 e5                	mov    %esp,%ebp
+  801d5b:	56                   	push   %esi
+  801d5c:	53                   	push   %ebx
+  801d5d:	83 ec 1c             	sub    $0x1c,%esp
+  801d60:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801d63:	56                   	push   %esi
+  801d64:	e8 11 ed ff ff       	call   800a7a <strlen>
+  801d69:	83 c4 10             	add    $0x10,%esp
+  801d6c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d71:	7f 6c                	jg     801ddf <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801d73:	83 ec 0c             	sub    $0xc,%esp
+  801d76:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d79:	50                   	push   %eax
+  801d7a:	e8 eb f7 ff ff       	call   80156a <fd_alloc>
+  801d7f:	89 c3                	mov    %eax,%ebx
+  801d81:	83 c4 10             	add    $0x10,%esp
+  801d84:	85 c0                	test   %eax,%eax
+  801d86:	78 3c                	js     801dc4 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801d88:	83 ec 08             	sub    $0x8,%esp
+  801d8b:	56                   	push   %esi
+  801d8c:	68 00 80 80 00       	push   $0x808000
+  801d91:	e8 1f ed ff ff       	call   800ab5 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801d96:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d99:	a3 00 84 80 00       	mov    %eax,0x808400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801d9e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801da1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801da6:	e8 77 fd ff ff       	call   801b22 <fsipc>
+  801dab:	89 c3                	mov    %eax,%ebx
+  801dad:	83 c4 10             	add    $0x10,%esp
+  801db0:	85 c0                	test   %eax,%eax
+  801db2:	78 19                	js     801dcd <open+0x75>
+	return fd2num(fd);
+  801db4:	83 ec 0c             	sub    $0xc,%esp
+  801db7:	ff 75 f4             	push   -0xc(%ebp)
+  801dba:	e8 84 f7 ff ff       	call   801543 <fd2num>
+  801dbf:	89 c3                	mov    %eax,%ebx
+  801dc1:	83 c4 10             	add    $0x10,%esp
+}
+  801dc4:	89 d8                	mov    %ebx,%eax
+  801dc6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dc9:	5b                   	pop    %ebx
+  801dca:	5e                   	pop    %esi
+  801dcb:	5d                   	pop    %ebp
+  801dcc:	c3                   	ret
+		fd_close(fd, 0);
+  801dcd:	83 ec 08             	sub    $0x8,%esp
+  801dd0:	6a 00                	push   $0x0
+  801dd2:	ff 75 f4             	push   -0xc(%ebp)
+  801dd5:	e8 80 f8 ff ff       	call   80165a <fd_close>
+		return r;
+  801dda:	83 c4 10             	add    $0x10,%esp
+  801ddd:	eb e5                	jmp    801dc4 <open+0x6c>
+		return -E_BAD_PATH;
+  801ddf:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801de4:	eb de                	jmp    801dc4 <open+0x6c>
+
+00801de6 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801de6:	55                   	push   %ebp
+  801de7:	89 e5                	mov    %esp,%ebp
+  801de9:	53                   	push   %ebx
+  801dea:	83 ec 10             	sub    $0x10,%esp
+  801ded:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801df0:	53                   	push   %ebx
+  801df1:	e8 84 ec ff ff       	call   800a7a <strlen>
+  801df6:	83 c4 10             	add    $0x10,%esp
+  801df9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801dfe:	7f 25                	jg     801e25 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801e00:	83 ec 08             	sub    $0x8,%esp
+  801e03:	53                   	push   %ebx
+  801e04:	68 00 80 80 00       	push   $0x808000
+  801e09:	e8 a7 ec ff ff       	call   800ab5 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801e0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e13:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e18:	e8 05 fd ff ff       	call   801b22 <fsipc>
+  801e1d:	83 c4 10             	add    $0x10,%esp
+}
+  801e20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e23:	c9                   	leave
+  801e24:	c3                   	ret
+		return -E_BAD_PATH;
+  801e25:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801e2a:	eb f4                	jmp    801e20 <remove+0x3a>
+
+00801e2c <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801e2c:	55                   	push   %ebp
+  801e2d:	89 e5                	mov    %esp,%ebp
+  801e2f:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801e32:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e37:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e3c:	e8 e1 fc ff ff       	call   801b22 <fsipc>
+}
+  801e41:	c9                   	leave
+  801e42:	c3                   	ret
+
+00801e43 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801e43:	55                   	push   %ebp
+  801e44:	89 e5                	mov    %esp,%ebp
+  801e46:	53                   	push   %ebx
+  801e47:	83 ec 04             	sub    $0x4,%esp
+  801e4a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801e4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e52:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e57:	e8 c6 fc ff ff       	call   801b22 <fsipc>
+  801e5c:	85 c0                	test   %eax,%eax
+  801e5e:	78 3c                	js     801e9c <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801e60:	a1 00 80 80 00       	mov    0x808000,%eax
+  801e65:	89 03                	mov    %eax,(%ebx)
+  801e67:	a1 04 80 80 00       	mov    0x808004,%eax
+  801e6c:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e6f:	a1 08 80 80 00       	mov    0x808008,%eax
+  801e74:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e77:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  801e7c:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e7f:	a1 10 80 80 00       	mov    0x808010,%eax
+  801e84:	89 43 10             	mov    %eax,0x10(%ebx)
+  801e87:	a1 14 80 80 00       	mov    0x808014,%eax
+  801e8c:	89 43 14             	mov    %eax,0x14(%ebx)
+  801e8f:	a1 18 80 80 00       	mov    0x808018,%eax
+  801e94:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801e97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e9f:	c9                   	leave
+  801ea0:	c3                   	ret
+
+00801ea1 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801ea1:	55                   	push   %ebp
+  801ea2:	89 e5                	mov    %esp,%ebp
+  801ea4:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801ea7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eaa:	a3 00 80 80 00       	mov    %eax,0x808000
+	return fsipc(FSREQ_BCSET, NULL);
+  801eaf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801eb9:	e8 64 fc ff ff       	call   801b22 <fsipc>
+}
+  801ebe:	c9                   	leave
+  801ebf:	c3                   	ret
+
+00801ec0 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  801ec0:	55                   	push   %ebp
+  801ec1:	89 e5                	mov    %esp,%ebp
+  801ec3:	57                   	push   %edi
+  801ec4:	56                   	push   %esi
+  801ec5:	53                   	push   %ebx
+  801ec6:	81 ec 14 03 00 00    	sub    $0x314,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  801ecc:	6a 00                	push   $0x0
+  801ece:	ff 75 08             	push   0x8(%ebp)
+  801ed1:	e8 82 fe ff ff       	call   801d58 <open>
+  801ed6:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  801edc:	83 c4 10             	add    $0x10,%esp
+  801edf:	85 c0                	test   %eax,%eax
+  801ee1:	0f 88 06 06 00 00    	js     8024ed <spawn+0x62d>
+  801ee7:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  801ee9:	83 ec 04             	sub    $0x4,%esp
+  801eec:	68 00 02 00 00       	push   $0x200
+  801ef1:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  801ef7:	50                   	push   %eax
+  801ef8:	51                   	push   %ecx
+  801ef9:	e8 a6 f9 ff ff       	call   8018a4 <readn>
+  801efe:	83 c4 10             	add    $0x10,%esp
+  801f01:	3d 00 02 00 00       	cmp    $0x200,%eax
+  801f06:	75 74                	jne    801f7c <spawn+0xbc>
+	    || elf->e_magic != ELF_MAGIC) {
+  801f08:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  801f0f:	45 4c 46 
+  801f12:	75 68                	jne    801f7c <spawn+0xbc>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801f14:	b8 07 00 00 00       	mov    $0x7,%eax
+  801f19:	cd 30                	int    $0x30
+  801f1b:	89 85 0c fd ff ff    	mov    %eax,-0x2f4(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  801f21:	85 c0                	test   %eax,%eax
+  801f23:	0f 88 b8 05 00 00    	js     8024e1 <spawn+0x621>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  801f29:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801f2e:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  801f31:	c1 e6 06             	shl    $0x6,%esi
+  801f34:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801f3a:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  801f40:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801f45:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  801f47:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  801f4d:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  801f53:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  801f58:	be 00 00 00 00       	mov    $0x0,%esi
+  801f5d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  801f60:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  801f63:	85 c0                	test   %eax,%eax
+  801f65:	74 4d                	je     801fb4 <spawn+0xf4>
+		string_size += strlen(argv[argc]) + 1;
+  801f67:	83 ec 0c             	sub    $0xc,%esp
+  801f6a:	50                   	push   %eax
+  801f6b:	e8 0a eb ff ff       	call   800a7a <strlen>
+  801f70:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  801f74:	83 c3 01             	add    $0x1,%ebx
+  801f77:	83 c4 10             	add    $0x10,%esp
+  801f7a:	eb e4                	jmp    801f60 <spawn+0xa0>
+		close(fd);
+  801f7c:	83 ec 0c             	sub    $0xc,%esp
+  801f7f:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  801f85:	e8 57 f7 ff ff       	call   8016e1 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  801f8a:	83 c4 0c             	add    $0xc,%esp
+  801f8d:	68 7f 45 4c 46       	push   $0x464c457f
+  801f92:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  801f98:	68 77 35 80 00       	push   $0x803577
+  801f9d:	e8 2c e5 ff ff       	call   8004ce <cprintf>
+		return -E_NOT_EXEC;
+  801fa2:	83 c4 10             	add    $0x10,%esp
+  801fa5:	c7 85 10 fd ff ff f2 	movl   $0xfffffff2,-0x2f0(%ebp)
+  801fac:	ff ff ff 
+  801faf:	e9 39 05 00 00       	jmp    8024ed <spawn+0x62d>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  801fb4:	89 9d 04 fd ff ff    	mov    %ebx,-0x2fc(%ebp)
+  801fba:	bf 00 10 40 00       	mov    $0x401000,%edi
+  801fbf:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  801fc1:	89 fa                	mov    %edi,%edx
+  801fc3:	83 e2 fc             	and    $0xfffffffc,%edx
+  801fc6:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  801fcd:	29 c2                	sub    %eax,%edx
+  801fcf:	89 95 14 fd ff ff    	mov    %edx,-0x2ec(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  801fd5:	8d 42 f8             	lea    -0x8(%edx),%eax
+  801fd8:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  801fdd:	0f 86 18 05 00 00    	jbe    8024fb <spawn+0x63b>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  801fe3:	83 ec 04             	sub    $0x4,%esp
+  801fe6:	6a 07                	push   $0x7
+  801fe8:	68 00 00 40 00       	push   $0x400000
+  801fed:	6a 00                	push   $0x0
+  801fef:	e8 b4 ef ff ff       	call   800fa8 <sys_page_alloc>
+  801ff4:	83 c4 10             	add    $0x10,%esp
+  801ff7:	85 c0                	test   %eax,%eax
+  801ff9:	0f 88 01 05 00 00    	js     802500 <spawn+0x640>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  801fff:	be 00 00 00 00       	mov    $0x0,%esi
+  802004:	89 9d 08 fd ff ff    	mov    %ebx,-0x2f8(%ebp)
+  80200a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80200d:	eb 30                	jmp    80203f <spawn+0x17f>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  80200f:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802015:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  80201b:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  80201e:	83 ec 08             	sub    $0x8,%esp
+  802021:	ff 34 b3             	push   (%ebx,%esi,4)
+  802024:	57                   	push   %edi
+  802025:	e8 8b ea ff ff       	call   800ab5 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  80202a:	83 c4 04             	add    $0x4,%esp
+  80202d:	ff 34 b3             	push   (%ebx,%esi,4)
+  802030:	e8 45 ea ff ff       	call   800a7a <strlen>
+  802035:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  802039:	83 c6 01             	add    $0x1,%esi
+  80203c:	83 c4 10             	add    $0x10,%esp
+  80203f:	39 b5 08 fd ff ff    	cmp    %esi,-0x2f8(%ebp)
+  802045:	7f c8                	jg     80200f <spawn+0x14f>
+	}
+	argv_store[argc] = 0;
+  802047:	8b 85 14 fd ff ff    	mov    -0x2ec(%ebp),%eax
+  80204d:	8b 8d 04 fd ff ff    	mov    -0x2fc(%ebp),%ecx
+  802053:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  80205a:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802060:	0f 85 fb 00 00 00    	jne    802161 <spawn+0x2a1>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802066:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  80206c:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  802072:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  802075:	89 c8                	mov    %ecx,%eax
+  802077:	8b 8d 04 fd ff ff    	mov    -0x2fc(%ebp),%ecx
+  80207d:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802080:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  802085:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  80208b:	83 ec 0c             	sub    $0xc,%esp
+  80208e:	6a 07                	push   $0x7
+  802090:	68 00 d0 bf ee       	push   $0xeebfd000
+  802095:	8b b5 0c fd ff ff    	mov    -0x2f4(%ebp),%esi
+  80209b:	56                   	push   %esi
+  80209c:	68 00 00 40 00       	push   $0x400000
+  8020a1:	6a 00                	push   $0x0
+  8020a3:	e8 43 ef ff ff       	call   800feb <sys_page_map>
+  8020a8:	89 c3                	mov    %eax,%ebx
+  8020aa:	83 c4 20             	add    $0x20,%esp
+  8020ad:	85 c0                	test   %eax,%eax
+  8020af:	0f 88 53 04 00 00    	js     802508 <spawn+0x648>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  8020b5:	83 ec 08             	sub    $0x8,%esp
+  8020b8:	68 00 00 40 00       	push   $0x400000
+  8020bd:	6a 00                	push   $0x0
+  8020bf:	e8 69 ef ff ff       	call   80102d <sys_page_unmap>
+  8020c4:	89 c3                	mov    %eax,%ebx
+  8020c6:	83 c4 10             	add    $0x10,%esp
+  8020c9:	85 c0                	test   %eax,%eax
+  8020cb:	0f 88 37 04 00 00    	js     802508 <spawn+0x648>
+	if ((r = fd_lookup(fd, &fdp)) < 0)
+  8020d1:	83 ec 08             	sub    $0x8,%esp
+  8020d4:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  8020da:	50                   	push   %eax
+  8020db:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  8020e1:	e8 d8 f4 ff ff       	call   8015be <fd_lookup>
+  8020e6:	89 c7                	mov    %eax,%edi
+  8020e8:	83 c4 10             	add    $0x10,%esp
+  8020eb:	85 c0                	test   %eax,%eax
+  8020ed:	0f 88 d6 01 00 00    	js     8022c9 <spawn+0x409>
+	if ((r = sys_page_map(0, fdp, child, (void*) PROGFD, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8020f3:	83 ec 0c             	sub    $0xc,%esp
+  8020f6:	68 07 04 00 00       	push   $0x407
+  8020fb:	68 00 f0 ff cf       	push   $0xcffff000
+  802100:	56                   	push   %esi
+  802101:	ff b5 a0 fd ff ff    	push   -0x260(%ebp)
+  802107:	6a 00                	push   $0x0
+  802109:	e8 dd ee ff ff       	call   800feb <sys_page_map>
+  80210e:	89 c7                	mov    %eax,%edi
+  802110:	83 c4 20             	add    $0x20,%esp
+  802113:	85 c0                	test   %eax,%eax
+  802115:	0f 88 ae 01 00 00    	js     8022c9 <spawn+0x409>
+	pager = ipc_find_env(ENV_TYPE_FS);
+  80211b:	83 ec 0c             	sub    $0xc,%esp
+  80211e:	6a 01                	push   $0x1
+  802120:	e8 0f 0c 00 00       	call   802d34 <ipc_find_env>
+  802125:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%ebp)
+	memset(segs, 0, sizeof(segs));
+  80212b:	83 c4 0c             	add    $0xc,%esp
+  80212e:	68 80 00 00 00       	push   $0x80
+  802133:	6a 00                	push   $0x0
+  802135:	8d 9d 20 fd ff ff    	lea    -0x2e0(%ebp),%ebx
+  80213b:	53                   	push   %ebx
+  80213c:	e8 c5 ea ff ff       	call   800c06 <memset>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802141:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802147:	8d bc 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%edi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80214e:	83 c4 10             	add    $0x10,%esp
+  802151:	ba 00 00 00 00       	mov    $0x0,%edx
+  802156:	89 fe                	mov    %edi,%esi
+  802158:	89 d1                	mov    %edx,%ecx
+  80215a:	89 da                	mov    %ebx,%edx
+  80215c:	e9 bf 01 00 00       	jmp    802320 <spawn+0x460>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802161:	68 ec 35 80 00       	push   $0x8035ec
+  802166:	68 4b 35 80 00       	push   $0x80354b
+  80216b:	68 17 01 00 00       	push   $0x117
+  802170:	68 91 35 80 00       	push   $0x803591
+  802175:	e8 79 e2 ff ff       	call   8003f3 <_panic>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  80217a:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80217d:	89 9d 00 fd ff ff    	mov    %ebx,-0x300(%ebp)
+  802183:	8b 46 10             	mov    0x10(%esi),%eax
+  802186:	89 85 14 fd ff ff    	mov    %eax,-0x2ec(%ebp)
+  80218c:	8b 7e 14             	mov    0x14(%esi),%edi
+  80218f:	89 bd 08 fd ff ff    	mov    %edi,-0x2f8(%ebp)
+  802195:	8b 7e 08             	mov    0x8(%esi),%edi
+	int i, r;
+	void *blk;
+
+	//cprintf("map_segment %x+%x\n", va, memsz);
+
+	if ((i = PGOFF(va))) {
+  802198:	89 f8                	mov    %edi,%eax
+  80219a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80219f:	74 16                	je     8021b7 <spawn+0x2f7>
+		va -= i;
+  8021a1:	29 c7                	sub    %eax,%edi
+		memsz += i;
+  8021a3:	01 85 08 fd ff ff    	add    %eax,-0x2f8(%ebp)
+		filesz += i;
+  8021a9:	01 85 14 fd ff ff    	add    %eax,-0x2ec(%ebp)
+		fileoffset -= i;
+  8021af:	29 c3                	sub    %eax,%ebx
+  8021b1:	89 9d 00 fd ff ff    	mov    %ebx,-0x300(%ebp)
+	}
+
+	for (i = 0; i < memsz; i += PGSIZE) {
+  8021b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021bc:	89 8d fc fc ff ff    	mov    %ecx,-0x304(%ebp)
+  8021c2:	89 b5 f8 fc ff ff    	mov    %esi,-0x308(%ebp)
+  8021c8:	8b b5 14 fd ff ff    	mov    -0x2ec(%ebp),%esi
+  8021ce:	89 95 f4 fc ff ff    	mov    %edx,-0x30c(%ebp)
+  8021d4:	e9 ba 00 00 00       	jmp    802293 <spawn+0x3d3>
+			// allocate a blank page
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+				return r;
+		} else {
+			// from file
+			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8021d9:	83 ec 04             	sub    $0x4,%esp
+  8021dc:	6a 07                	push   $0x7
+  8021de:	68 00 00 40 00       	push   $0x400000
+  8021e3:	6a 00                	push   $0x0
+  8021e5:	e8 be ed ff ff       	call   800fa8 <sys_page_alloc>
+  8021ea:	83 c4 10             	add    $0x10,%esp
+  8021ed:	85 c0                	test   %eax,%eax
+  8021ef:	0f 88 d7 02 00 00    	js     8024cc <spawn+0x60c>
+				return r;
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  8021f5:	83 ec 08             	sub    $0x8,%esp
+  8021f8:	8b 95 00 fd ff ff    	mov    -0x300(%ebp),%edx
+  8021fe:	8b 85 14 fd ff ff    	mov    -0x2ec(%ebp),%eax
+  802204:	01 d0                	add    %edx,%eax
+  802206:	50                   	push   %eax
+  802207:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  80220d:	e8 5b f7 ff ff       	call   80196d <seek>
+  802212:	83 c4 10             	add    $0x10,%esp
+  802215:	85 c0                	test   %eax,%eax
+  802217:	0f 88 b6 02 00 00    	js     8024d3 <spawn+0x613>
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
+  80221d:	83 ec 04             	sub    $0x4,%esp
+  802220:	89 f2                	mov    %esi,%edx
+  802222:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  802228:	29 ca                	sub    %ecx,%edx
+  80222a:	89 d0                	mov    %edx,%eax
+  80222c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802231:	39 d0                	cmp    %edx,%eax
+  802233:	0f 47 c2             	cmova  %edx,%eax
+  802236:	50                   	push   %eax
+  802237:	68 00 00 40 00       	push   $0x400000
+  80223c:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  802242:	e8 5d f6 ff ff       	call   8018a4 <readn>
+  802247:	83 c4 10             	add    $0x10,%esp
+  80224a:	85 c0                	test   %eax,%eax
+  80224c:	0f 88 88 02 00 00    	js     8024da <spawn+0x61a>
+				return r;
+			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
+  802252:	83 ec 0c             	sub    $0xc,%esp
+  802255:	ff b5 04 fd ff ff    	push   -0x2fc(%ebp)
+  80225b:	57                   	push   %edi
+  80225c:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802262:	68 00 00 40 00       	push   $0x400000
+  802267:	6a 00                	push   $0x0
+  802269:	e8 7d ed ff ff       	call   800feb <sys_page_map>
+  80226e:	83 c4 20             	add    $0x20,%esp
+  802271:	85 c0                	test   %eax,%eax
+  802273:	78 7e                	js     8022f3 <spawn+0x433>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP);
+  802275:	83 ec 08             	sub    $0x8,%esp
+  802278:	68 00 00 40 00       	push   $0x400000
+  80227d:	6a 00                	push   $0x0
+  80227f:	e8 a9 ed ff ff       	call   80102d <sys_page_unmap>
+  802284:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < memsz; i += PGSIZE) {
+  802287:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80228d:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  802293:	89 9d 14 fd ff ff    	mov    %ebx,-0x2ec(%ebp)
+  802299:	8b 85 08 fd ff ff    	mov    -0x2f8(%ebp),%eax
+  80229f:	39 c3                	cmp    %eax,%ebx
+  8022a1:	73 65                	jae    802308 <spawn+0x448>
+		if (i >= filesz) {
+  8022a3:	39 f3                	cmp    %esi,%ebx
+  8022a5:	0f 82 2e ff ff ff    	jb     8021d9 <spawn+0x319>
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  8022ab:	83 ec 04             	sub    $0x4,%esp
+  8022ae:	ff b5 04 fd ff ff    	push   -0x2fc(%ebp)
+  8022b4:	57                   	push   %edi
+  8022b5:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  8022bb:	e8 e8 ec ff ff       	call   800fa8 <sys_page_alloc>
+  8022c0:	83 c4 10             	add    $0x10,%esp
+  8022c3:	85 c0                	test   %eax,%eax
+  8022c5:	79 c0                	jns    802287 <spawn+0x3c7>
+  8022c7:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  8022c9:	83 ec 0c             	sub    $0xc,%esp
+  8022cc:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  8022d2:	e8 52 ec ff ff       	call   800f29 <sys_env_destroy>
+	close(fd);
+  8022d7:	83 c4 04             	add    $0x4,%esp
+  8022da:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  8022e0:	e8 fc f3 ff ff       	call   8016e1 <close>
+	return r;
+  8022e5:	83 c4 10             	add    $0x10,%esp
+  8022e8:	89 bd 10 fd ff ff    	mov    %edi,-0x2f0(%ebp)
+  8022ee:	e9 fa 01 00 00       	jmp    8024ed <spawn+0x62d>
+				panic("spawn: sys_page_map data: %e", r);
+  8022f3:	50                   	push   %eax
+  8022f4:	68 9d 35 80 00       	push   $0x80359d
+  8022f9:	68 4a 01 00 00       	push   $0x14a
+  8022fe:	68 91 35 80 00       	push   $0x803591
+  802303:	e8 eb e0 ff ff       	call   8003f3 <_panic>
+  802308:	8b 8d fc fc ff ff    	mov    -0x304(%ebp),%ecx
+  80230e:	8b b5 f8 fc ff ff    	mov    -0x308(%ebp),%esi
+  802314:	8b 95 f4 fc ff ff    	mov    -0x30c(%ebp),%edx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80231a:	83 c1 01             	add    $0x1,%ecx
+  80231d:	83 c6 20             	add    $0x20,%esi
+  802320:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802327:	39 c8                	cmp    %ecx,%eax
+  802329:	7e 74                	jle    80239f <spawn+0x4df>
+		if (ph->p_type != ELF_PROG_LOAD)
+  80232b:	83 3e 01             	cmpl   $0x1,(%esi)
+  80232e:	75 ea                	jne    80231a <spawn+0x45a>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802330:	8b 46 18             	mov    0x18(%esi),%eax
+  802333:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802336:	83 f8 01             	cmp    $0x1,%eax
+  802339:	19 ff                	sbb    %edi,%edi
+  80233b:	83 e7 fe             	and    $0xfffffffe,%edi
+  80233e:	83 c7 07             	add    $0x7,%edi
+  802341:	89 bd 04 fd ff ff    	mov    %edi,-0x2fc(%ebp)
+		if (seg < segs + NSEGS) {
+  802347:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  80234d:	39 c2                	cmp    %eax,%edx
+  80234f:	0f 83 25 fe ff ff    	jae    80217a <spawn+0x2ba>
+			seg->seg_va = ROUNDDOWN(ph->p_va, PGSIZE);
+  802355:	8b 46 08             	mov    0x8(%esi),%eax
+  802358:	89 c3                	mov    %eax,%ebx
+  80235a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802360:	89 1a                	mov    %ebx,(%edx)
+			seg->seg_memsz = ph->p_memsz + PGOFF(ph->p_va);
+  802362:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802367:	89 c3                	mov    %eax,%ebx
+  802369:	03 5e 14             	add    0x14(%esi),%ebx
+  80236c:	89 5a 04             	mov    %ebx,0x4(%edx)
+			seg->seg_filesz = ph->p_filesz + PGOFF(ph->p_va);
+  80236f:	89 c3                	mov    %eax,%ebx
+  802371:	03 5e 10             	add    0x10(%esi),%ebx
+  802374:	89 5a 08             	mov    %ebx,0x8(%edx)
+			seg->seg_offset = ph->p_offset - PGOFF(ph->p_va);
+  802377:	8b 5e 04             	mov    0x4(%esi),%ebx
+  80237a:	29 c3                	sub    %eax,%ebx
+  80237c:	89 5a 0c             	mov    %ebx,0xc(%edx)
+			seg->seg_perm = perm;
+  80237f:	89 7a 10             	mov    %edi,0x10(%edx)
+			seg->seg_pager = pager;
+  802382:	8b 85 f0 fc ff ff    	mov    -0x310(%ebp),%eax
+  802388:	89 42 14             	mov    %eax,0x14(%edx)
+			seg->seg_fileid = fdp->fd_file.id;
+  80238b:	8b 85 a0 fd ff ff    	mov    -0x260(%ebp),%eax
+  802391:	8b 40 0c             	mov    0xc(%eax),%eax
+  802394:	89 42 18             	mov    %eax,0x18(%edx)
+			seg++;
+  802397:	83 c2 20             	add    $0x20,%edx
+			continue;
+  80239a:	e9 7b ff ff ff       	jmp    80231a <spawn+0x45a>
+	if ((r = sys_env_set_segments(child, segs, seg - segs)) < 0)
+  80239f:	89 d1                	mov    %edx,%ecx
+  8023a1:	83 ec 04             	sub    $0x4,%esp
+  8023a4:	8d 95 20 fd ff ff    	lea    -0x2e0(%ebp),%edx
+  8023aa:	89 c8                	mov    %ecx,%eax
+  8023ac:	29 d0                	sub    %edx,%eax
+  8023ae:	c1 f8 05             	sar    $0x5,%eax
+  8023b1:	50                   	push   %eax
+  8023b2:	52                   	push   %edx
+  8023b3:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  8023b9:	e8 fc ee ff ff       	call   8012ba <sys_env_set_segments>
+  8023be:	89 c7                	mov    %eax,%edi
+  8023c0:	83 c4 10             	add    $0x10,%esp
+  8023c3:	85 c0                	test   %eax,%eax
+  8023c5:	0f 88 fe fe ff ff    	js     8022c9 <spawn+0x409>
+	close(fd);
+  8023cb:	83 ec 0c             	sub    $0xc,%esp
+  8023ce:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  8023d4:	e8 08 f3 ff ff       	call   8016e1 <close>
+  8023d9:	83 c4 10             	add    $0x10,%esp
+	// Copy the mappings for shared pages into the child address.
+	// We need to iterate through all PTEs for addresses below UTOP.
+	// However, we handle the exception stack separately, so we only need to iterate up until UXSTACKTOP-PGSIZE.
+	// Since [USTACKTOP, UXSTACKTOP-PGSIZE) is empty memory, we can get away with only iterating up until USTACKTOP.
+	// This is the same as iterating through pages 0 through PGNUM(USTACKTOP)-1 inclusive.
+	for (pn = 0; pn < PGNUM(USTACKTOP); ++pn) {
+  8023dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023e1:	eb 2d                	jmp    802410 <spawn+0x550>
+		// We only copy this page if it is present and readable in user mode, and if it is a shared page.
+		// This requires checking for PTE_P and PTE_U not only in uvpt[pn],
+		// but in the associated PDE as well, since page pn won't exist if its page table doesn't exist, i.e. if it isn't present in the page directory.
+		// Large pages are never shared (see sys_page_alloc), and have no uvpt entries.
+		if (((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U) && !(uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U) && (uvpt[pn]&PTE_SHARE))) {
+			sys_page_map(0, (void *)PGADDR(0,pn,0), child, (void *)PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL);
+  8023e3:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8023ea:	83 ec 0c             	sub    $0xc,%esp
+  8023ed:	25 07 0e 00 00       	and    $0xe07,%eax
+  8023f2:	50                   	push   %eax
+  8023f3:	52                   	push   %edx
+  8023f4:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  8023fa:	52                   	push   %edx
+  8023fb:	6a 00                	push   $0x0
+  8023fd:	e8 e9 eb ff ff       	call   800feb <sys_page_map>
+  802402:	83 c4 20             	add    $0x20,%esp
+	for (pn = 0; pn < PGNUM(USTACKTOP); ++pn) {
+  802405:	83 c3 01             	add    $0x1,%ebx
+  802408:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  80240e:	74 51                	je     802461 <spawn+0x5a1>
+		if (((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U) && !(uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U) && (uvpt[pn]&PTE_SHARE))) {
+  802410:	89 da                	mov    %ebx,%edx
+  802412:	c1 e2 0c             	shl    $0xc,%edx
+  802415:	89 d0                	mov    %edx,%eax
+  802417:	c1 e8 16             	shr    $0x16,%eax
+  80241a:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  802421:	f6 c1 01             	test   $0x1,%cl
+  802424:	74 df                	je     802405 <spawn+0x545>
+  802426:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  80242d:	f6 c1 04             	test   $0x4,%cl
+  802430:	74 d3                	je     802405 <spawn+0x545>
+  802432:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802439:	a8 80                	test   $0x80,%al
+  80243b:	75 c8                	jne    802405 <spawn+0x545>
+  80243d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802444:	a8 01                	test   $0x1,%al
+  802446:	74 bd                	je     802405 <spawn+0x545>
+  802448:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80244f:	a8 04                	test   $0x4,%al
+  802451:	74 b2                	je     802405 <spawn+0x545>
+  802453:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80245a:	f6 c4 04             	test   $0x4,%ah
+  80245d:	74 a6                	je     802405 <spawn+0x545>
+  80245f:	eb 82                	jmp    8023e3 <spawn+0x523>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802461:	83 ec 08             	sub    $0x8,%esp
+  802464:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  80246a:	50                   	push   %eax
+  80246b:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802471:	e8 b2 ed ff ff       	call   801228 <sys_env_set_trapframe>
+  802476:	83 c4 10             	add    $0x10,%esp
+  802479:	85 c0                	test   %eax,%eax
+  80247b:	78 25                	js     8024a2 <spawn+0x5e2>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  80247d:	83 ec 08             	sub    $0x8,%esp
+  802480:	6a 02                	push   $0x2
+  802482:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802488:	e8 59 ed ff ff       	call   8011e6 <sys_env_set_status>
+  80248d:	83 c4 10             	add    $0x10,%esp
+  802490:	85 c0                	test   %eax,%eax
+  802492:	78 23                	js     8024b7 <spawn+0x5f7>
+	return child;
+  802494:	8b 85 0c fd ff ff    	mov    -0x2f4(%ebp),%eax
+  80249a:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  8024a0:	eb 4b                	jmp    8024ed <spawn+0x62d>
+		panic("sys_env_set_trapframe: %e", r);
+  8024a2:	50                   	push   %eax
+  8024a3:	68 ba 35 80 00       	push   $0x8035ba
+  8024a8:	68 ab 00 00 00       	push   $0xab
+  8024ad:	68 91 35 80 00       	push   $0x803591
+  8024b2:	e8 3c df ff ff       	call   8003f3 <_panic>
+		panic("sys_env_set_status: %e", r);
+  8024b7:	50                   	push   %eax
+  8024b8:	68 d4 35 80 00       	push   $0x8035d4
+  8024bd:	68 ae 00 00 00       	push   $0xae
+  8024c2:	68 91 35 80 00       	push   $0x803591
+  8024c7:	e8 27 df ff ff       	call   8003f3 <_panic>
+  8024cc:	89 c7                	mov    %eax,%edi
+  8024ce:	e9 f6 fd ff ff       	jmp    8022c9 <spawn+0x409>
+  8024d3:	89 c7                	mov    %eax,%edi
+  8024d5:	e9 ef fd ff ff       	jmp    8022c9 <spawn+0x409>
+  8024da:	89 c7                	mov    %eax,%edi
+  8024dc:	e9 e8 fd ff ff       	jmp    8022c9 <spawn+0x409>
+		return r;
+  8024e1:	8b 85 0c fd ff ff    	mov    -0x2f4(%ebp),%eax
+  8024e7:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+}
+  8024ed:	8b 85 10 fd ff ff    	mov    -0x2f0(%ebp),%eax
+  8024f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024f6:	5b                   	pop    %ebx
+  8024f7:	5e                   	pop    %esi
+  8024f8:	5f                   	pop    %edi
+  8024f9:	5d                   	pop    %ebp
+  8024fa:	c3                   	ret
+		return -E_NO_MEM;
+  8024fb:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802500:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  802506:	eb e5                	jmp    8024ed <spawn+0x62d>
+	sys_page_unmap(0, UTEMP);
+  802508:	83 ec 08             	sub    $0x8,%esp
+  80250b:	68 00 00 40 00       	push   $0x400000
+  802510:	6a 00                	push   $0x0
+  802512:	e8 16 eb ff ff       	call   80102d <sys_page_unmap>
+  802517:	83 c4 10             	add    $0x10,%esp
+  80251a:	89 9d 10 fd ff ff    	mov    %ebx,-0x2f0(%ebp)
+  802520:	eb cb                	jmp    8024ed <spawn+0x62d>
+
+00802522 <spawnl>:
+{
+  802522:	55                   	push   %ebp
+  802523:	89 e5                	mov    %esp,%ebp
+  802525:	56                   	push   %esi
+  802526:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802527:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  80252a:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  80252f:	eb 05                	jmp    802536 <spawnl+0x14>
+		argc++;
+  802531:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  802534:	89 ca                	mov    %ecx,%edx
+  802536:	8d 4a 04             	lea    0x4(%edx),%ecx
+  802539:	83 3a 00             	cmpl   $0x0,(%edx)
+  80253c:	75 f3                	jne    802531 <spawnl+0xf>
+	const char *argv[argc+2];
+  80253e:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  802545:	83 e2 f0             	and    $0xfffffff0,%edx
+  802548:	29 d4                	sub    %edx,%esp
+  80254a:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  80254e:	89 da                	mov    %ebx,%edx
+  802550:	c1 ea 02             	shr    $0x2,%edx
+  802553:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802556:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802559:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  802560:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  802567:	00 
+	va_start(vl, arg0);
+  802568:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  80256b:	89 c2                	mov    %eax,%edx
+  80256d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802572:	eb 0b                	jmp    80257f <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  802574:	83 c0 01             	add    $0x1,%eax
+  802577:	8b 31                	mov    (%ecx),%esi
+  802579:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  80257c:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  80257f:	39 d0                	cmp    %edx,%eax
+  802581:	75 f1                	jne    802574 <spawnl+0x52>
+	return spawn(prog, argv);
+  802583:	83 ec 08             	sub    $0x8,%esp
+  802586:	53                   	push   %ebx
+  802587:	ff 75 08             	push   0x8(%ebp)
+  80258a:	e8 31 f9 ff ff       	call   801ec0 <spawn>
+}
+  80258f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802592:	5b                   	pop    %ebx
+  802593:	5e                   	pop    %esi
+  802594:	5d                   	pop    %ebp
+  802595:	c3                   	ret
+
+00802596 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802596:	55                   	push   %ebp
+  802597:	89 e5                	mov    %esp,%ebp
+  802599:	56                   	push   %esi
+  80259a:	53                   	push   %ebx
+  80259b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80259e:	83 ec 0c             	sub    $0xc,%esp
+  8025a1:	ff 75 08             	push   0x8(%ebp)
+  8025a4:	e8 aa ef ff ff       	call   801553 <fd2data>
+  8025a9:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8025ab:	83 c4 08             	add    $0x8,%esp
+  8025ae:	68 12 36 80 00       	push   $0x803612
+  8025b3:	53                   	push   %ebx
+  8025b4:	e8 fc e4 ff ff       	call   800ab5 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8025b9:	8b 46 04             	mov    0x4(%esi),%eax
+  8025bc:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8025c2:	2b 0e                	sub    (%esi),%ecx
+  8025c4:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8025c9:	89 c8                	mov    %ecx,%eax
+  8025cb:	f7 e2                	mul    %edx
+  8025cd:	c1 ea 0c             	shr    $0xc,%edx
+  8025d0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8025d6:	29 d1                	sub    %edx,%ecx
+  8025d8:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8025de:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8025e5:	00 00 00 
+	stat->st_dev = &devpipe;
+  8025e8:	c7 83 88 00 00 00 ac 	movl   $0x8057ac,0x88(%ebx)
+  8025ef:	57 80 00 
+	return 0;
+}
+  8025f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025fa:	5b                   	pop    %ebx
+  8025fb:	5e                   	pop    %esi
+  8025fc:	5d                   	pop    %ebp
+  8025fd:	c3                   	ret
+
+008025fe <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8025fe:	55                   	push   %ebp
+  8025ff:	89 e5                	mov    %esp,%ebp
+  802601:	53                   	push   %ebx
+  802602:	83 ec 0c             	sub    $0xc,%esp
+  802605:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802608:	53                   	push   %ebx
+  802609:	6a 00                	push   $0x0
+  80260b:	e8 1d ea ff ff       	call   80102d <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802610:	89 1c 24             	mov    %ebx,(%esp)
+  802613:	e8 3b ef ff ff       	call   801553 <fd2data>
+  802618:	83 c4 08             	add    $0x8,%esp
+  80261b:	50                   	push   %eax
+  80261c:	6a 00                	push   $0x0
+  80261e:	e8 0a ea ff ff       	call   80102d <sys_page_unmap>
+}
+  802623:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802626:	c9                   	leave
+  802627:	c3                   	ret
+
+00802628 <_pipeisclosed>:
+{
+  802628:	55                   	push   %ebp
+  802629:	89 e5                	mov    %esp,%ebp
+  80262b:	57                   	push   %edi
+  80262c:	56                   	push   %esi
+  80262d:	53                   	push   %ebx
+  80262e:	83 ec 1c             	sub    $0x1c,%esp
+  802631:	89 c7                	mov    %eax,%edi
+  802633:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802635:	a1 94 77 80 00       	mov    0x807794,%eax
+  80263a:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80263d:	83 ec 0c             	sub    $0xc,%esp
+  802640:	57                   	push   %edi
+  802641:	e8 2d 07 00 00       	call   802d73 <pageref>
+  802646:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802649:	89 34 24             	mov    %esi,(%esp)
+  80264c:	e8 22 07 00 00       	call   802d73 <pageref>
+		nn = thisenv->env_runs;
+  802651:	8b 15 94 77 80 00    	mov    0x807794,%edx
+  802657:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80265a:	83 c4 10             	add    $0x10,%esp
+  80265d:	39 cb                	cmp    %ecx,%ebx
+  80265f:	74 1b                	je     80267c <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802661:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802664:	75 cf                	jne    802635 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802666:	8b 42 58             	mov    0x58(%edx),%eax
+  802669:	6a 01                	push   $0x1
+  80266b:	50                   	push   %eax
+  80266c:	53                   	push   %ebx
+  80266d:	68 19 36 80 00       	push   $0x803619
+  802672:	e8 57 de ff ff       	call   8004ce <cprintf>
+  802677:	83 c4 10             	add    $0x10,%esp
+  80267a:	eb b9                	jmp    802635 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80267c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80267f:	0f 94 c0             	sete   %al
+  802682:	0f b6 c0             	movzbl %al,%eax
+}
+  802685:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802688:	5b                   	pop    %ebx
+  802689:	5e                   	pop    %esi
+  80268a:	5f                   	pop    %edi
+  80268b:	5d                   	pop    %ebp
+  80268c:	c3                   	ret
+
+0080268d <devpipe_read>:
+{
+  80268d:	55                   	push   %ebp
+  80268e:	89 e5                	mov    %esp,%ebp
+  802690:	57                   	push   %edi
+  802691:	56                   	push   %esi
+  802692:	53                   	push   %ebx
+  802693:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802696:	ff 75 08             	push   0x8(%ebp)
+  802699:	e8 b5 ee ff ff       	call   801553 <fd2data>
+  80269e:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8026a0:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8026a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8026a6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8026a9:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8026ac:	8b 0b                	mov    (%ebx),%ecx
+  8026ae:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8026b4:	29 ce                	sub    %ecx,%esi
+  8026b6:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8026bb:	f7 e6                	mul    %esi
+  8026bd:	c1 ea 0c             	shr    $0xc,%edx
+  8026c0:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8026c6:	29 c6                	sub    %eax,%esi
+  8026c8:	89 f2                	mov    %esi,%edx
+  8026ca:	75 43                	jne    80270f <devpipe_read+0x82>
+		ref = pageref(p);
+  8026cc:	83 ec 0c             	sub    $0xc,%esp
+  8026cf:	53                   	push   %ebx
+  8026d0:	e8 9e 06 00 00       	call   802d73 <pageref>
+  8026d5:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8026d7:	89 da                	mov    %ebx,%edx
+  8026d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026dc:	e8 47 ff ff ff       	call   802628 <_pipeisclosed>
+  8026e1:	83 c4 10             	add    $0x10,%esp
+  8026e4:	85 c0                	test   %eax,%eax
+  8026e6:	0f 85 c1 00 00 00    	jne    8027ad <devpipe_read+0x120>
+	*sleeping = 1;
+  8026ec:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  8026f3:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8026f8:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  8026fb:	75 ac                	jne    8026a9 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  8026fd:	83 ec 04             	sub    $0x4,%esp
+  802700:	56                   	push   %esi
+  802701:	57                   	push   %edi
+  802702:	ff 75 e4             	push   -0x1c(%ebp)
+  802705:	e8 77 ed ff ff       	call   801481 <sys_futex_wait>
+  80270a:	83 c4 10             	add    $0x10,%esp
+  80270d:	eb 9a                	jmp    8026a9 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  80270f:	39 75 10             	cmp    %esi,0x10(%ebp)
+  802712:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  802716:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802718:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80271d:	f7 e1                	mul    %ecx
+  80271f:	c1 ea 0b             	shr    $0xb,%edx
+  802722:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802728:	29 c1                	sub    %eax,%ecx
+  80272a:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  80272c:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802731:	29 cf                	sub    %ecx,%edi
+  802733:	39 f7                	cmp    %esi,%edi
+  802735:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  802738:	8d 43 10             	lea    0x10(%ebx),%eax
+  80273b:	83 ec 04             	sub    $0x4,%esp
+  80273e:	57                   	push   %edi
+  80273f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802742:	01 c2                	add    %eax,%edx
+  802744:	52                   	push   %edx
+  802745:	ff 75 0c             	push   0xc(%ebp)
+  802748:	e8 ee e4 ff ff       	call   800c3b <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  80274d:	83 c4 0c             	add    $0xc,%esp
+  802750:	89 f1                	mov    %esi,%ecx
+  802752:	29 f9                	sub    %edi,%ecx
+  802754:	51                   	push   %ecx
+  802755:	ff 75 e4             	push   -0x1c(%ebp)
+  802758:	89 f8                	mov    %edi,%eax
+  80275a:	03 45 0c             	add    0xc(%ebp),%eax
+  80275d:	50                   	push   %eax
+  80275e:	e8 d8 e4 ff ff       	call   800c3b <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  802763:	89 f1                	mov    %esi,%ecx
+  802765:	03 0b                	add    (%ebx),%ecx
+  802767:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80276c:	f7 e1                	mul    %ecx
+  80276e:	c1 ea 0c             	shr    $0xc,%edx
+  802771:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802777:	29 d1                	sub    %edx,%ecx
+  802779:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  80277b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802780:	83 c4 10             	add    $0x10,%esp
+  802783:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  802787:	75 0a                	jne    802793 <devpipe_read+0x106>
+	return n;
+  802789:	89 f0                	mov    %esi,%eax
+}
+  80278b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80278e:	5b                   	pop    %ebx
+  80278f:	5e                   	pop    %esi
+  802790:	5f                   	pop    %edi
+  802791:	5d                   	pop    %ebp
+  802792:	c3                   	ret
+		*sleeping = 0;
+  802793:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  80279a:	83 ec 08             	sub    $0x8,%esp
+  80279d:	68 00 04 00 00       	push   $0x400
+  8027a2:	53                   	push   %ebx
+  8027a3:	e8 29 ed ff ff       	call   8014d1 <sys_futex_wake>
+  8027a8:	83 c4 10             	add    $0x10,%esp
+  8027ab:	eb dc                	jmp    802789 <devpipe_read+0xfc>
+			return 0;
+  8027ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b2:	eb d7                	jmp    80278b <devpipe_read+0xfe>
+
+008027b4 <devpipe_write>:
+{
+  8027b4:	55                   	push   %ebp
+  8027b5:	89 e5                	mov    %esp,%ebp
+  8027b7:	57                   	push   %edi
+  8027b8:	56                   	push   %esi
+  8027b9:	53                   	push   %ebx
+  8027ba:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8027bd:	ff 75 08             	push   0x8(%ebp)
+  8027c0:	e8 8e ed ff ff       	call   801553 <fd2data>
+  8027c5:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8027c7:	83 c4 10             	add    $0x10,%esp
+  8027ca:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8027d1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027d4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8027d7:	0f 83 23 01 00 00    	jae    802900 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8027dd:	8b 77 04             	mov    0x4(%edi),%esi
+  8027e0:	8b 1f                	mov    (%edi),%ebx
+  8027e2:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  8027e8:	29 d9                	sub    %ebx,%ecx
+  8027ea:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8027ef:	f7 e1                	mul    %ecx
+  8027f1:	c1 ea 0c             	shr    $0xc,%edx
+  8027f4:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8027fa:	29 c1                	sub    %eax,%ecx
+  8027fc:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8027fe:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802804:	75 40                	jne    802846 <devpipe_write+0x92>
+			ref = pageref(p);
+  802806:	83 ec 0c             	sub    $0xc,%esp
+  802809:	57                   	push   %edi
+  80280a:	e8 64 05 00 00       	call   802d73 <pageref>
+  80280f:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  802811:	89 fa                	mov    %edi,%edx
+  802813:	8b 45 08             	mov    0x8(%ebp),%eax
+  802816:	e8 0d fe ff ff       	call   802628 <_pipeisclosed>
+  80281b:	83 c4 10             	add    $0x10,%esp
+  80281e:	85 c0                	test   %eax,%eax
+  802820:	0f 85 d5 00 00 00    	jne    8028fb <devpipe_write+0x147>
+	*sleeping = 1;
+  802826:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  80282d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802832:	39 1f                	cmp    %ebx,(%edi)
+  802834:	75 a7                	jne    8027dd <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  802836:	83 ec 04             	sub    $0x4,%esp
+  802839:	56                   	push   %esi
+  80283a:	53                   	push   %ebx
+  80283b:	57                   	push   %edi
+  80283c:	e8 40 ec ff ff       	call   801481 <sys_futex_wait>
+  802841:	83 c4 10             	add    $0x10,%esp
+  802844:	eb 97                	jmp    8027dd <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802846:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802849:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80284c:	29 c1                	sub    %eax,%ecx
+  80284e:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802853:	89 d8                	mov    %ebx,%eax
+  802855:	29 d0                	sub    %edx,%eax
+  802857:	39 c1                	cmp    %eax,%ecx
+  802859:	0f 46 c1             	cmovbe %ecx,%eax
+  80285c:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  80285e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802863:	f7 e6                	mul    %esi
+  802865:	c1 ea 0b             	shr    $0xb,%edx
+  802868:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80286e:	29 c6                	sub    %eax,%esi
+  802870:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802872:	29 f3                	sub    %esi,%ebx
+  802874:	39 cb                	cmp    %ecx,%ebx
+  802876:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802879:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  80287c:	8d 77 10             	lea    0x10(%edi),%esi
+  80287f:	83 ec 04             	sub    $0x4,%esp
+  802882:	53                   	push   %ebx
+  802883:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802886:	03 45 0c             	add    0xc(%ebp),%eax
+  802889:	50                   	push   %eax
+  80288a:	01 f2                	add    %esi,%edx
+  80288c:	52                   	push   %edx
+  80288d:	e8 a9 e3 ff ff       	call   800c3b <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802892:	83 c4 0c             	add    $0xc,%esp
+  802895:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802898:	29 d8                	sub    %ebx,%eax
+  80289a:	50                   	push   %eax
+  80289b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80289e:	01 d3                	add    %edx,%ebx
+  8028a0:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8028a3:	53                   	push   %ebx
+  8028a4:	56                   	push   %esi
+  8028a5:	e8 91 e3 ff ff       	call   800c3b <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8028aa:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8028ad:	03 4f 04             	add    0x4(%edi),%ecx
+  8028b0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8028b5:	f7 e1                	mul    %ecx
+  8028b7:	c1 ea 0c             	shr    $0xc,%edx
+  8028ba:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8028c0:	29 d1                	sub    %edx,%ecx
+  8028c2:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8028c5:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8028ca:	83 c4 10             	add    $0x10,%esp
+  8028cd:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8028d1:	75 0b                	jne    8028de <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8028d3:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8028d6:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8028d9:	e9 f3 fe ff ff       	jmp    8027d1 <devpipe_write+0x1d>
+		*sleeping = 0;
+  8028de:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8028e5:	83 ec 08             	sub    $0x8,%esp
+  8028e8:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  8028ed:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  8028f0:	50                   	push   %eax
+  8028f1:	e8 db eb ff ff       	call   8014d1 <sys_futex_wake>
+  8028f6:	83 c4 10             	add    $0x10,%esp
+  8028f9:	eb d8                	jmp    8028d3 <devpipe_write+0x11f>
+				return 0;
+  8028fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802900:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802903:	5b                   	pop    %ebx
+  802904:	5e                   	pop    %esi
+  802905:	5f                   	pop    %edi
+  802906:	5d                   	pop    %ebp
+  802907:	c3                   	ret
+
+00802908 <pipe>:
+{
+  802908:	55                   	push   %ebp
+  802909:	89 e5                	mov    %esp,%ebp
+  80290b:	56                   	push   %esi
+  80290c:	53                   	push   %ebx
+  80290d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802910:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802913:	50                   	push   %eax
+  802914:	e8 51 ec ff ff       	call   80156a <fd_alloc>
+  802919:	89 c3                	mov    %eax,%ebx
+  80291b:	83 c4 10             	add    $0x10,%esp
+  80291e:	85 c0                	test   %eax,%eax
+  802920:	0f 88 23 01 00 00    	js     802a49 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802926:	83 ec 04             	sub    $0x4,%esp
+  802929:	68 07 04 00 00       	push   $0x407
+  80292e:	ff 75 f4             	push   -0xc(%ebp)
+  802931:	6a 00                	push   $0x0
+  802933:	e8 70 e6 ff ff       	call   800fa8 <sys_page_alloc>
+  802938:	89 c3                	mov    %eax,%ebx
+  80293a:	83 c4 10             	add    $0x10,%esp
+  80293d:	85 c0                	test   %eax,%eax
+  80293f:	0f 88 04 01 00 00    	js     802a49 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802945:	83 ec 0c             	sub    $0xc,%esp
+  802948:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80294b:	50                   	push   %eax
+  80294c:	e8 19 ec ff ff       	call   80156a <fd_alloc>
+  802951:	89 c3                	mov    %eax,%ebx
+  802953:	83 c4 10             	add    $0x10,%esp
+  802956:	85 c0                	test   %eax,%eax
+  802958:	0f 88 db 00 00 00    	js     802a39 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80295e:	83 ec 04             	sub    $0x4,%esp
+  802961:	68 07 04 00 00       	push   $0x407
+  802966:	ff 75 f0             	push   -0x10(%ebp)
+  802969:	6a 00                	push   $0x0
+  80296b:	e8 38 e6 ff ff       	call   800fa8 <sys_page_alloc>
+  802970:	89 c3                	mov    %eax,%ebx
+  802972:	83 c4 10             	add    $0x10,%esp
+  802975:	85 c0                	test   %eax,%eax
+  802977:	0f 88 bc 00 00 00    	js     802a39 <pipe+0x131>
+	va = fd2data(fd0);
+  80297d:	83 ec 0c             	sub    $0xc,%esp
+  802980:	ff 75 f4             	push   -0xc(%ebp)
+  802983:	e8 cb eb ff ff       	call   801553 <fd2data>
+  802988:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80298a:	83 c4 0c             	add    $0xc,%esp
+  80298d:	68 07 04 00 00       	push   $0x407
+  802992:	50                   	push   %eax
+  802993:	6a 00                	push   $0x0
+  802995:	e8 0e e6 ff ff       	call   800fa8 <sys_page_alloc>
+  80299a:	89 c3                	mov    %eax,%ebx
+  80299c:	83 c4 10             	add    $0x10,%esp
+  80299f:	85 c0                	test   %eax,%eax
+  8029a1:	0f 88 82 00 00 00    	js     802a29 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029a7:	83 ec 0c             	sub    $0xc,%esp
+  8029aa:	ff 75 f0             	push   -0x10(%ebp)
+  8029ad:	e8 a1 eb ff ff       	call   801553 <fd2data>
+  8029b2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8029b9:	50                   	push   %eax
+  8029ba:	6a 00                	push   $0x0
+  8029bc:	56                   	push   %esi
+  8029bd:	6a 00                	push   $0x0
+  8029bf:	e8 27 e6 ff ff       	call   800feb <sys_page_map>
+  8029c4:	89 c3                	mov    %eax,%ebx
+  8029c6:	83 c4 20             	add    $0x20,%esp
+  8029c9:	85 c0                	test   %eax,%eax
+  8029cb:	78 4e                	js     802a1b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8029cd:	a1 ac 57 80 00       	mov    0x8057ac,%eax
+  8029d2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029d5:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8029d7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029da:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8029e1:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8029e4:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8029e6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8029e9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8029f0:	83 ec 0c             	sub    $0xc,%esp
+  8029f3:	ff 75 f4             	push   -0xc(%ebp)
+  8029f6:	e8 48 eb ff ff       	call   801543 <fd2num>
+  8029fb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029fe:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802a00:	83 c4 04             	add    $0x4,%esp
+  802a03:	ff 75 f0             	push   -0x10(%ebp)
+  802a06:	e8 38 eb ff ff       	call   801543 <fd2num>
+  802a0b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a0e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802a11:	83 c4 10             	add    $0x10,%esp
+  802a14:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a19:	eb 2e                	jmp    802a49 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802a1b:	83 ec 08             	sub    $0x8,%esp
+  802a1e:	56                   	push   %esi
+  802a1f:	6a 00                	push   $0x0
+  802a21:	e8 07 e6 ff ff       	call   80102d <sys_page_unmap>
+  802a26:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802a29:	83 ec 08             	sub    $0x8,%esp
+  802a2c:	ff 75 f0             	push   -0x10(%ebp)
+  802a2f:	6a 00                	push   $0x0
+  802a31:	e8 f7 e5 ff ff       	call   80102d <sys_page_unmap>
+  802a36:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802a39:	83 ec 08             	sub    $0x8,%esp
+  802a3c:	ff 75 f4             	push   -0xc(%ebp)
+  802a3f:	6a 00                	push   $0x0
+  802a41:	e8 e7 e5 ff ff       	call   80102d <sys_page_unmap>
+  802a46:	83 c4 10             	add    $0x10,%esp
+}
+  802a49:	89 d8                	mov    %ebx,%eax
+  802a4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a4e:	5b                   	pop    %ebx
+  802a4f:	5e                   	pop    %esi
+  802a50:	5d                   	pop    %ebp
+  802a51:	c3                   	ret
+
+00802a52 <pipeisclosed>:
+{
+  802a52:	55                   	push   %ebp
+  802a53:	89 e5                	mov    %esp,%ebp
+  802a55:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a58:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a5b:	50                   	push   %eax
+  802a5c:	ff 75 08             	push   0x8(%ebp)
+  802a5f:	e8 5a eb ff ff       	call   8015be <fd_lookup>
+  802a64:	83 c4 10             	add    $0x10,%esp
+  802a67:	85 c0                	test   %eax,%eax
+  802a69:	78 18                	js     802a83 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802a6b:	83 ec 0c             	sub    $0xc,%esp
+  802a6e:	ff 75 f4             	push   -0xc(%ebp)
+  802a71:	e8 dd ea ff ff       	call   801553 <fd2data>
+  802a76:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802a78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a7b:	e8 a8 fb ff ff       	call   802628 <_pipeisclosed>
+  802a80:	83 c4 10             	add    $0x10,%esp
+}
+  802a83:	c9                   	leave
+  802a84:	c3                   	ret
+
+00802a85 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  802a85:	55                   	push   %ebp
+  802a86:	89 e5                	mov    %esp,%ebp
+  802a88:	57                   	push   %edi
+  802a89:	56                   	push   %esi
+  802a8a:	53                   	push   %ebx
+  802a8b:	83 ec 0c             	sub    $0xc,%esp
+  802a8e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	const volatile struct Env *e;
+	unsigned status;
+
+	assert(envid != 0);
+  802a91:	85 ff                	test   %edi,%edi
+  802a93:	74 21                	je     802ab6 <wait+0x31>
+	e = &envs[ENVX(envid)];
+  802a95:	89 f8                	mov    %edi,%eax
+  802a97:	25 ff 03 00 00       	and    $0x3ff,%eax
+	// The kernel wakes us when it frees the environment.  Until then
+	// we sleep, unless its status changed since we looked.
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  802a9c:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  802a9f:	c1 e6 06             	shl    $0x6,%esi
+  802aa2:	81 c6 54 00 c0 ee    	add    $0xeec00054,%esi
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  802aa8:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  802aab:	c1 e3 06             	shl    $0x6,%ebx
+  802aae:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  802ab4:	eb 25                	jmp    802adb <wait+0x56>
+	assert(envid != 0);
+  802ab6:	68 31 36 80 00       	push   $0x803631
+  802abb:	68 4b 35 80 00       	push   $0x80354b
+  802ac0:	6a 0a                	push   $0xa
+  802ac2:	68 3c 36 80 00       	push   $0x80363c
+  802ac7:	e8 27 d9 ff ff       	call   8003f3 <_panic>
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  802acc:	83 ec 04             	sub    $0x4,%esp
+  802acf:	6a ff                	push   $0xffffffff
+  802ad1:	50                   	push   %eax
+  802ad2:	56                   	push   %esi
+  802ad3:	e8 a9 e9 ff ff       	call   801481 <sys_futex_wait>
+  802ad8:	83 c4 10             	add    $0x10,%esp
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  802adb:	8b 43 48             	mov    0x48(%ebx),%eax
+  802ade:	39 f8                	cmp    %edi,%eax
+  802ae0:	75 07                	jne    802ae9 <wait+0x64>
+  802ae2:	8b 43 54             	mov    0x54(%ebx),%eax
+  802ae5:	85 c0                	test   %eax,%eax
+  802ae7:	75 e3                	jne    802acc <wait+0x47>
+}
+  802ae9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aec:	5b                   	pop    %ebx
+  802aed:	5e                   	pop    %esi
+  802aee:	5f                   	pop    %edi
+  802aef:	5d                   	pop    %ebp
+  802af0:	c3                   	ret
+
+00802af1 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  802af1:	55                   	push   %ebp
+  802af2:	89 e5                	mov    %esp,%ebp
+  802af4:	57                   	push   %edi
+  802af5:	56                   	push   %esi
+  802af6:	53                   	push   %ebx
+  802af7:	83 ec 14             	sub    $0x14,%esp
+  802afa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802afd:	8b 75 14             	mov    0x14(%ebp),%esi
+  802b00:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  802b03:	ff 75 10             	push   0x10(%ebp)
+  802b06:	ff 75 0c             	push   0xc(%ebp)
+  802b09:	e8 bd e8 ff ff       	call   8013cb <sys_ipc_recv_pages>
+  802b0e:	83 c4 10             	add    $0x10,%esp
+  802b11:	85 c0                	test   %eax,%eax
+  802b13:	78 46                	js     802b5b <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802b15:	85 ff                	test   %edi,%edi
+  802b17:	74 0d                	je     802b26 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  802b19:	a1 94 77 80 00       	mov    0x807794,%eax
+  802b1e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802b24:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802b26:	85 f6                	test   %esi,%esi
+  802b28:	74 0d                	je     802b37 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  802b2a:	a1 94 77 80 00       	mov    0x807794,%eax
+  802b2f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802b35:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802b37:	85 db                	test   %ebx,%ebx
+  802b39:	74 0d                	je     802b48 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  802b3b:	a1 94 77 80 00       	mov    0x807794,%eax
+  802b40:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802b46:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802b48:	a1 94 77 80 00       	mov    0x807794,%eax
+  802b4d:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802b53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b56:	5b                   	pop    %ebx
+  802b57:	5e                   	pop    %esi
+  802b58:	5f                   	pop    %edi
+  802b59:	5d                   	pop    %ebp
+  802b5a:	c3                   	ret
+		if (from_env_store) {
+  802b5b:	85 ff                	test   %edi,%edi
+  802b5d:	74 06                	je     802b65 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  802b5f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802b65:	85 f6                	test   %esi,%esi
+  802b67:	74 06                	je     802b6f <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  802b69:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802b6f:	85 db                	test   %ebx,%ebx
+  802b71:	74 e0                	je     802b53 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  802b73:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802b79:	eb d8                	jmp    802b53 <ipc_recv_pages+0x62>
+
+00802b7b <ipc_recv>:
+{
+  802b7b:	55                   	push   %ebp
+  802b7c:	89 e5                	mov    %esp,%ebp
+  802b7e:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  802b81:	6a 00                	push   $0x0
+  802b83:	ff 75 10             	push   0x10(%ebp)
+  802b86:	6a 01                	push   $0x1
+  802b88:	ff 75 0c             	push   0xc(%ebp)
+  802b8b:	ff 75 08             	push   0x8(%ebp)
+  802b8e:	e8 5e ff ff ff       	call   802af1 <ipc_recv_pages>
+}
+  802b93:	c9                   	leave
+  802b94:	c3                   	ret
+
+00802b95 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802b95:	55                   	push   %ebp
+  802b96:	89 e5                	mov    %esp,%ebp
+  802b98:	56                   	push   %esi
+  802b99:	53                   	push   %ebx
+  802b9a:	8b 75 08             	mov    0x8(%ebp),%esi
+  802b9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  802ba0:	83 ec 0c             	sub    $0xc,%esp
+  802ba3:	ff 75 0c             	push   0xc(%ebp)
+  802ba6:	e8 54 e9 ff ff       	call   8014ff <sys_ipc_try_recv>
+  802bab:	83 c4 10             	add    $0x10,%esp
+  802bae:	85 c0                	test   %eax,%eax
+  802bb0:	78 34                	js     802be6 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802bb2:	85 f6                	test   %esi,%esi
+  802bb4:	74 0d                	je     802bc3 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  802bb6:	a1 94 77 80 00       	mov    0x807794,%eax
+  802bbb:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802bc1:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  802bc3:	85 db                	test   %ebx,%ebx
+  802bc5:	74 0d                	je     802bd4 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  802bc7:	a1 94 77 80 00       	mov    0x807794,%eax
+  802bcc:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802bd2:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802bd4:	a1 94 77 80 00       	mov    0x807794,%eax
+  802bd9:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802bdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802be2:	5b                   	pop    %ebx
+  802be3:	5e                   	pop    %esi
+  802be4:	5d                   	pop    %ebp
+  802be5:	c3                   	ret
+		if (from_env_store) {
+  802be6:	85 f6                	test   %esi,%esi
+  802be8:	74 06                	je     802bf0 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  802bea:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  802bf0:	85 db                	test   %ebx,%ebx
+  802bf2:	74 eb                	je     802bdf <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  802bf4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802bfa:	eb e3                	jmp    802bdf <ipc_try_recv+0x4a>
+
+00802bfc <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802bfc:	55                   	push   %ebp
+  802bfd:	89 e5                	mov    %esp,%ebp
+  802bff:	83 ec 14             	sub    $0x14,%esp
+  802c02:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802c05:	85 c0                	test   %eax,%eax
+  802c07:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802c0c:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802c0f:	ff 75 18             	push   0x18(%ebp)
+  802c12:	ff 75 14             	push   0x14(%ebp)
+  802c15:	50                   	push   %eax
+  802c16:	ff 75 0c             	push   0xc(%ebp)
+  802c19:	ff 75 08             	push   0x8(%ebp)
+  802c1c:	e8 6d e7 ff ff       	call   80138e <sys_ipc_send_pages>
+  802c21:	83 c4 20             	add    $0x20,%esp
+  802c24:	85 c0                	test   %eax,%eax
+  802c26:	78 02                	js     802c2a <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  802c28:	c9                   	leave
+  802c29:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  802c2a:	50                   	push   %eax
+  802c2b:	68 48 36 80 00       	push   $0x803648
+  802c30:	68 80 00 00 00       	push   $0x80
+  802c35:	68 74 36 80 00       	push   $0x803674
+  802c3a:	e8 b4 d7 ff ff       	call   8003f3 <_panic>
+
+00802c3f <ipc_send>:
+{
+  802c3f:	55                   	push   %ebp
+  802c40:	89 e5                	mov    %esp,%ebp
+  802c42:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  802c45:	ff 75 14             	push   0x14(%ebp)
+  802c48:	6a 01                	push   $0x1
+  802c4a:	ff 75 10             	push   0x10(%ebp)
+  802c4d:	ff 75 0c             	push   0xc(%ebp)
+  802c50:	ff 75 08             	push   0x8(%ebp)
+  802c53:	e8 a4 ff ff ff       	call   802bfc <ipc_send_pages>
+}
+  802c58:	83 c4 20             	add    $0x20,%esp
+  802c5b:	c9                   	leave
+  802c5c:	c3                   	ret
+
+00802c5d <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802c5d:	55                   	push   %ebp
+  802c5e:	89 e5                	mov    %esp,%ebp
+  802c60:	83 ec 14             	sub    $0x14,%esp
+  802c63:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802c66:	85 c0                	test   %eax,%eax
+  802c68:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802c6d:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802c70:	ff 75 18             	push   0x18(%ebp)
+  802c73:	ff 75 14             	push   0x14(%ebp)
+  802c76:	50                   	push   %eax
+  802c77:	ff 75 0c             	push   0xc(%ebp)
+  802c7a:	ff 75 08             	push   0x8(%ebp)
+  802c7d:	e8 9d e7 ff ff       	call   80141f <sys_ipc_call>
+  802c82:	83 c4 20             	add    $0x20,%esp
+  802c85:	85 c0                	test   %eax,%eax
+  802c87:	78 0b                	js     802c94 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  802c89:	a1 94 77 80 00       	mov    0x807794,%eax
+  802c8e:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802c94:	c9                   	leave
+  802c95:	c3                   	ret
+
+00802c96 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  802c96:	55                   	push   %ebp
+  802c97:	89 e5                	mov    %esp,%ebp
+  802c99:	57                   	push   %edi
+  802c9a:	56                   	push   %esi
+  802c9b:	53                   	push   %ebx
+  802c9c:	83 ec 18             	sub    $0x18,%esp
+  802c9f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ca2:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  802ca5:	8b 75 20             	mov    0x20(%ebp),%esi
+  802ca8:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802cab:	85 c0                	test   %eax,%eax
+  802cad:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802cb2:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802cb5:	ff 75 18             	push   0x18(%ebp)
+  802cb8:	ff 75 14             	push   0x14(%ebp)
+  802cbb:	50                   	push   %eax
+  802cbc:	ff 75 0c             	push   0xc(%ebp)
+  802cbf:	ff 75 08             	push   0x8(%ebp)
+  802cc2:	e8 99 e7 ff ff       	call   801460 <sys_ipc_reply_recv>
+  802cc7:	83 c4 20             	add    $0x20,%esp
+  802cca:	85 c0                	test   %eax,%eax
+  802ccc:	78 46                	js     802d14 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802cce:	85 ff                	test   %edi,%edi
+  802cd0:	74 0d                	je     802cdf <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  802cd2:	a1 94 77 80 00       	mov    0x807794,%eax
+  802cd7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802cdd:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802cdf:	85 f6                	test   %esi,%esi
+  802ce1:	74 0d                	je     802cf0 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  802ce3:	a1 94 77 80 00       	mov    0x807794,%eax
+  802ce8:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802cee:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802cf0:	85 db                	test   %ebx,%ebx
+  802cf2:	74 0d                	je     802d01 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  802cf4:	a1 94 77 80 00       	mov    0x807794,%eax
+  802cf9:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802cff:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802d01:	a1 94 77 80 00       	mov    0x807794,%eax
+  802d06:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802d0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d0f:	5b                   	pop    %ebx
+  802d10:	5e                   	pop    %esi
+  802d11:	5f                   	pop    %edi
+  802d12:	5d                   	pop    %ebp
+  802d13:	c3                   	ret
+		if (from_env_store) {
+  802d14:	85 ff                	test   %edi,%edi
+  802d16:	74 06                	je     802d1e <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  802d18:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802d1e:	85 f6                	test   %esi,%esi
+  802d20:	74 06                	je     802d28 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  802d22:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802d28:	85 db                	test   %ebx,%ebx
+  802d2a:	74 e0                	je     802d0c <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  802d2c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802d32:	eb d8                	jmp    802d0c <ipc_reply_recv+0x76>
+
+00802d34 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802d34:	55                   	push   %ebp
+  802d35:	89 e5                	mov    %esp,%ebp
+  802d37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802d3a:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  802d3f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802d42:	c1 e0 06             	shl    $0x6,%eax
+  802d45:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d4a:	8b 40 50             	mov    0x50(%eax),%eax
+  802d4d:	39 c8                	cmp    %ecx,%eax
+  802d4f:	74 12                	je     802d63 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802d51:	83 c2 01             	add    $0x1,%edx
+  802d54:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802d5a:	75 e3                	jne    802d3f <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d61:	eb 0e                	jmp    802d71 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802d63:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802d66:	c1 e0 06             	shl    $0x6,%eax
+  802d69:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d6e:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802d71:	5d                   	pop    %ebp
+  802d72:	c3                   	ret
+
+00802d73 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802d73:	55                   	push   %ebp
+  802d74:	89 e5                	mov    %esp,%ebp
+  802d76:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802d79:	89 c2                	mov    %eax,%edx
+  802d7b:	c1 ea 16             	shr    $0x16,%edx
+  802d7e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802d85:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802d8a:	f6 c1 01             	test   $0x1,%cl
+  802d8d:	74 1e                	je     802dad <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  802d8f:	c1 e8 0c             	shr    $0xc,%eax
+  802d92:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802d99:	a8 01                	test   $0x1,%al
+  802d9b:	74 10                	je     802dad <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802d9d:	c1 e8 0c             	shr    $0xc,%eax
+  802da0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802da3:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  802daa:	0f b7 d2             	movzwl %dx,%edx
+}
+  802dad:	89 d0                	mov    %edx,%eax
+  802daf:	5d                   	pop    %ebp
+  802db0:	c3                   	ret
+
+00802db1 <udivmod>:
+  802db1:	55                   	push   %ebp
+  802db2:	57                   	push   %edi
+  802db3:	56                   	push   %esi
+  802db4:	53                   	push   %ebx
+  802db5:	83 ec 24             	sub    $0x24,%esp
+  802db8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802dbc:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802dc0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802dc4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802dc8:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802dcc:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802dd0:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802dd4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802dd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dde:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802dea:	00 
+  802deb:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802df2:	00 
+  802df3:	89 fb                	mov    %edi,%ebx
+  802df5:	eb 08                	jmp    802dff <udivmod+0x4e>
+  802df7:	83 e9 01             	sub    $0x1,%ecx
+  802dfa:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802dfd:	74 68                	je     802e67 <udivmod+0xb6>
+  802dff:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802e03:	01 c0                	add    %eax,%eax
+  802e05:	89 c6                	mov    %eax,%esi
+  802e07:	89 d7                	mov    %edx,%edi
+  802e09:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802e0d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e11:	0f ad d0             	shrd   %cl,%edx,%eax
+  802e14:	d3 ea                	shr    %cl,%edx
+  802e16:	f6 c1 20             	test   $0x20,%cl
+  802e19:	74 04                	je     802e1f <udivmod+0x6e>
+  802e1b:	89 d0                	mov    %edx,%eax
+  802e1d:	31 d2                	xor    %edx,%edx
+  802e1f:	83 e0 01             	and    $0x1,%eax
+  802e22:	89 04 24             	mov    %eax,(%esp)
+  802e25:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802e2c:	00 
+  802e2d:	8b 04 24             	mov    (%esp),%eax
+  802e30:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802e34:	09 f0                	or     %esi,%eax
+  802e36:	09 fa                	or     %edi,%edx
+  802e38:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802e3c:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802e40:	39 f0                	cmp    %esi,%eax
+  802e42:	89 d5                	mov    %edx,%ebp
+  802e44:	19 fd                	sbb    %edi,%ebp
+  802e46:	72 af                	jb     802df7 <udivmod+0x46>
+  802e48:	29 f0                	sub    %esi,%eax
+  802e4a:	19 fa                	sbb    %edi,%edx
+  802e4c:	89 cf                	mov    %ecx,%edi
+  802e4e:	c1 ef 05             	shr    $0x5,%edi
+  802e51:	83 e7 01             	and    $0x1,%edi
+  802e54:	89 fe                	mov    %edi,%esi
+  802e56:	83 f6 01             	xor    $0x1,%esi
+  802e59:	d3 e6                	shl    %cl,%esi
+  802e5b:	d3 e7                	shl    %cl,%edi
+  802e5d:	09 74 24 18          	or     %esi,0x18(%esp)
+  802e61:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802e65:	eb 90                	jmp    802df7 <udivmod+0x46>
+  802e67:	85 db                	test   %ebx,%ebx
+  802e69:	74 05                	je     802e70 <udivmod+0xbf>
+  802e6b:	89 03                	mov    %eax,(%ebx)
+  802e6d:	89 53 04             	mov    %edx,0x4(%ebx)
+  802e70:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e74:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e78:	83 c4 24             	add    $0x24,%esp
+  802e7b:	5b                   	pop    %ebx
+  802e7c:	5e                   	pop    %esi
+  802e7d:	5f                   	pop    %edi
+  802e7e:	5d                   	pop    %ebp
+  802e7f:	c3                   	ret
+
+00802e80 <__udivdi3>:
+  802e80:	83 ec 08             	sub    $0x8,%esp
+  802e83:	6a 00                	push   $0x0
+  802e85:	ff 74 24 1c          	push   0x1c(%esp)
+  802e89:	ff 74 24 1c          	push   0x1c(%esp)
+  802e8d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e91:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e95:	e8 17 ff ff ff       	call   802db1 <udivmod>
+  802e9a:	83 c4 14             	add    $0x14,%esp
+  802e9d:	c3                   	ret
+
+00802e9e <__umoddi3>:
+  802e9e:	83 ec 18             	sub    $0x18,%esp
+  802ea1:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ea5:	50                   	push   %eax
+  802ea6:	ff 74 24 2c          	push   0x2c(%esp)
+  802eaa:	ff 74 24 2c          	push   0x2c(%esp)
+  802eae:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802eb2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802eb6:	e8 f6 fe ff ff       	call   802db1 <udivmod>
+  802ebb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802ebf:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802ec3:	83 c4 24             	add    $0x24,%esp
+  802ec6:	c3                   	ret
+
+00802ec7 <__divdi3>:
+  802ec7:	55                   	push   %ebp
+  802ec8:	57                   	push   %edi
+  802ec9:	56                   	push   %esi
+  802eca:	53                   	push   %ebx
+  802ecb:	83 ec 10             	sub    $0x10,%esp
+  802ece:	8b 44 24 24          	mov    0x24(%esp),%eax
+  802ed2:	8b 54 24 28          	mov    0x28(%esp),%edx
+  802ed6:	89 c6                	mov    %eax,%esi
+  802ed8:	89 d7                	mov    %edx,%edi
+  802eda:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  802ede:	33 7c 24 30          	xor    0x30(%esp),%edi
+  802ee2:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802ee6:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  802eea:	89 c5                	mov    %eax,%ebp
+  802eec:	f7 dd                	neg    %ebp
+  802eee:	89 d6                	mov    %edx,%esi
+  802ef0:	83 d6 00             	adc    $0x0,%esi
+  802ef3:	f7 de                	neg    %esi
+  802ef5:	0f 48 e8             	cmovs  %eax,%ebp
+  802ef8:	0f 49 d6             	cmovns %esi,%edx
+  802efb:	6a 00                	push   $0x0
+  802efd:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802f01:	f7 de                	neg    %esi
+  802f03:	8b 44 24 34          	mov    0x34(%esp),%eax
+  802f07:	83 d0 00             	adc    $0x0,%eax
+  802f0a:	f7 d8                	neg    %eax
+  802f0c:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  802f11:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  802f16:	50                   	push   %eax
+  802f17:	56                   	push   %esi
+  802f18:	89 e8                	mov    %ebp,%eax
+  802f1a:	e8 92 fe ff ff       	call   802db1 <udivmod>
+  802f1f:	83 c4 10             	add    $0x10,%esp
+  802f22:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  802f27:	78 08                	js     802f31 <__divdi3+0x6a>
+  802f29:	83 c4 0c             	add    $0xc,%esp
+  802f2c:	5b                   	pop    %ebx
+  802f2d:	5e                   	pop    %esi
+  802f2e:	5f                   	pop    %edi
+  802f2f:	5d                   	pop    %ebp
+  802f30:	c3                   	ret
+  802f31:	f7 d8                	neg    %eax
+  802f33:	83 d2 00             	adc    $0x0,%edx
+  802f36:	f7 da                	neg    %edx
+  802f38:	eb ef                	jmp    802f29 <__divdi3+0x62>
+
+00802f3a <__moddi3>:
+  802f3a:	55                   	push   %ebp
+  802f3b:	57                   	push   %edi
+  802f3c:	56                   	push   %esi
+  802f3d:	53                   	push   %ebx
+  802f3e:	83 ec 18             	sub    $0x18,%esp
+  802f41:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802f45:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802f49:	89 f1                	mov    %esi,%ecx
+  802f4b:	f7 d9                	neg    %ecx
+  802f4d:	89 da                	mov    %ebx,%edx
+  802f4f:	83 d2 00             	adc    $0x0,%edx
+  802f52:	f7 da                	neg    %edx
+  802f54:	0f 48 ce             	cmovs  %esi,%ecx
+  802f57:	0f 48 d3             	cmovs  %ebx,%edx
+  802f5a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f5e:	50                   	push   %eax
+  802f5f:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802f63:	f7 de                	neg    %esi
+  802f65:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802f69:	83 d0 00             	adc    $0x0,%eax
+  802f6c:	f7 d8                	neg    %eax
+  802f6e:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802f73:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802f78:	50                   	push   %eax
+  802f79:	56                   	push   %esi
+  802f7a:	89 c8                	mov    %ecx,%eax
+  802f7c:	e8 30 fe ff ff       	call   802db1 <udivmod>
+  802f81:	83 c4 10             	add    $0x10,%esp
+  802f84:	85 db                	test   %ebx,%ebx
+  802f86:	78 10                	js     802f98 <__moddi3+0x5e>
+  802f88:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f8c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f90:	83 c4 14             	add    $0x14,%esp
+  802f93:	5b                   	pop    %ebx
+  802f94:	5e                   	pop    %esi
+  802f95:	5f                   	pop    %edi
+  802f96:	5d                   	pop    %ebp
+  802f97:	c3                   	ret
+  802f98:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f9c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fa0:	f7 d8                	neg    %eax
+  802fa2:	83 d2 00             	adc    $0x0,%edx
+  802fa5:	f7 da                	neg    %edx
+  802fa7:	eb e7                	jmp    802f90 <__moddi3+0x56>
@@ -0,0 +1,10769 @@
+
+obj/user/largepage.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 d8 02 00 00       	call   800309 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define SIZE 0x8000000
+#define BASE 0x10000000
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	int r;
+	uintptr_t va, top;
+	envid_t envid;
+
+	// Large pages are private, and 4MB-aligned
+	assert(sys_page_alloc(0, (void*) BASE, PTE_P|PTE_U|PTE_W|PTE_PS|PTE_SHARE) == -E_INVAL);
+  800038:	83 ec 04             	sub    $0x4,%esp
+  80003b:	68 87 04 00 00       	push   $0x487
+  800040:	68 00 00 00 10       	push   $0x10000000
+  800045:	6a 00                	push   $0x0
+  800047:	e8 d5 0e 00 00       	call   800f21 <sys_page_alloc>
+  80004c:	83 c4 10             	add    $0x10,%esp
+  80004f:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800052:	75 64                	jne    8000b8 <umain+0x85>
+	assert(sys_page_alloc(0, (void*) (BASE + PGSIZE), PTE_P|PTE_U|PTE_W|PTE_PS) == -E_INVAL);
+  800054:	83 ec 04             	sub    $0x4,%esp
+  800057:	68 87 00 00 00       	push   $0x87
+  80005c:	68 00 10 00 10       	push   $0x10001000
+  800061:	6a 00                	push   $0x0
+  800063:	e8 b9 0e 00 00       	call   800f21 <sys_page_alloc>
+  800068:	83 c4 10             	add    $0x10,%esp
+  80006b:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80006e:	75 5e                	jne    8000ce <umain+0x9b>
+
+	for (top = BASE; top < BASE+SIZE; top += PTSIZE) {
+  800070:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+		if ((r = sys_page_alloc(0, (void*) top, PTE_P|PTE_U|PTE_W|PTE_PS)) < 0) {
+  800075:	83 ec 04             	sub    $0x4,%esp
+  800078:	68 87 00 00 00       	push   $0x87
+  80007d:	53                   	push   %ebx
+  80007e:	6a 00                	push   $0x0
+  800080:	e8 9c 0e 00 00       	call   800f21 <sys_page_alloc>
+  800085:	83 c4 10             	add    $0x10,%esp
+  800088:	85 c0                	test   %eax,%eax
+  80008a:	78 58                	js     8000e4 <umain+0xb1>
+			if (r != -E_NO_MEM)
+				panic("sys_page_alloc on %p: %e", top, r);
+			break;
+		}
+		assert((uvpd[PDX(top)] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS));
+  80008c:	89 d8                	mov    %ebx,%eax
+  80008e:	c1 e8 16             	shr    $0x16,%eax
+  800091:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800098:	25 81 00 00 00       	and    $0x81,%eax
+  80009d:	3d 81 00 00 00       	cmp    $0x81,%eax
+  8000a2:	0f 85 82 00 00 00    	jne    80012a <umain+0xf7>
+	for (top = BASE; top < BASE+SIZE; top += PTSIZE) {
+  8000a8:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  8000ae:	81 fb 00 00 00 18    	cmp    $0x18000000,%ebx
+  8000b4:	75 bf                	jne    800075 <umain+0x42>
+  8000b6:	eb 39                	jmp    8000f1 <umain+0xbe>
+	assert(sys_page_alloc(0, (void*) BASE, PTE_P|PTE_U|PTE_W|PTE_PS|PTE_SHARE) == -E_INVAL);
+  8000b8:	68 1c 56 80 00       	push   $0x80561c
+  8000bd:	68 6a 55 80 00       	push   $0x80556a
+  8000c2:	6a 14                	push   $0x14
+  8000c4:	68 7f 55 80 00       	push   $0x80557f
+  8000c9:	e8 9e 02 00 00       	call   80036c <_panic>
+	assert(sys_page_alloc(0, (void*) (BASE + PGSIZE), PTE_P|PTE_U|PTE_W|PTE_PS) == -E_INVAL);
+  8000ce:	68 6c 56 80 00       	push   $0x80566c
+  8000d3:	68 6a 55 80 00       	push   $0x80556a
+  8000d8:	6a 15                	push   $0x15
+  8000da:	68 7f 55 80 00       	push   $0x80557f
+  8000df:	e8 88 02 00 00       	call   80036c <_panic>
+			if (r != -E_NO_MEM)
+  8000e4:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8000e7:	75 2b                	jne    800114 <umain+0xe1>
+	}
+	if (top == BASE)
+  8000e9:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  8000ef:	74 4f                	je     800140 <umain+0x10d>
+		panic("no memory for a single large page");
+	// There's a large page there already
+	assert(sys_page_alloc(0, (void*) BASE, PTE_P|PTE_U|PTE_W|PTE_PS) == -E_INVAL);
+  8000f1:	83 ec 04             	sub    $0x4,%esp
+  8000f4:	68 87 00 00 00       	push   $0x87
+  8000f9:	68 00 00 00 10       	push   $0x10000000
+  8000fe:	6a 00                	push   $0x0
+  800100:	e8 1c 0e 00 00       	call   800f21 <sys_page_alloc>
+  800105:	83 c4 10             	add    $0x10,%esp
+  800108:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80010b:	75 47                	jne    800154 <umain+0x121>
+
+	for (va = BASE; va < top; va += PGSIZE)
+  80010d:	b8 00 00 00 10       	mov    $0x10000000,%eax
+  800112:	eb 5d                	jmp    800171 <umain+0x13e>
+				panic("sys_page_alloc on %p: %e", top, r);
+  800114:	83 ec 0c             	sub    $0xc,%esp
+  800117:	50                   	push   %eax
+  800118:	53                   	push   %ebx
+  800119:	68 9d 55 80 00       	push   $0x80559d
+  80011e:	6a 1a                	push   $0x1a
+  800120:	68 7f 55 80 00       	push   $0x80557f
+  800125:	e8 42 02 00 00       	call   80036c <_panic>
+		assert((uvpd[PDX(top)] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS));
+  80012a:	68 c0 56 80 00       	push   $0x8056c0
+  80012f:	68 6a 55 80 00       	push   $0x80556a
+  800134:	6a 1d                	push   $0x1d
+  800136:	68 7f 55 80 00       	push   $0x80557f
+  80013b:	e8 2c 02 00 00       	call   80036c <_panic>
+		panic("no memory for a single large page");
+  800140:	83 ec 04             	sub    $0x4,%esp
+  800143:	68 f4 56 80 00       	push   $0x8056f4
+  800148:	6a 20                	push   $0x20
+  80014a:	68 7f 55 80 00       	push   $0x80557f
+  80014f:	e8 18 02 00 00       	call   80036c <_panic>
+	assert(sys_page_alloc(0, (void*) BASE, PTE_P|PTE_U|PTE_W|PTE_PS) == -E_INVAL);
+  800154:	68 18 57 80 00       	push   $0x805718
+  800159:	68 6a 55 80 00       	push   $0x80556a
+  80015e:	6a 22                	push   $0x22
+  800160:	68 7f 55 80 00       	push   $0x80557f
+  800165:	e8 02 02 00 00       	call   80036c <_panic>
+		*(uintptr_t*)va = va;
+  80016a:	89 00                	mov    %eax,(%eax)
+	for (va = BASE; va < top; va += PGSIZE)
+  80016c:	05 00 10 00 00       	add    $0x1000,%eax
+  800171:	39 d8                	cmp    %ebx,%eax
+  800173:	72 f5                	jb     80016a <umain+0x137>
+
+	// Splitting leaves the contents alone
+	if ((r = sys_page_split(0, (void*) BASE)) < 0)
+  800175:	83 ec 08             	sub    $0x8,%esp
+  800178:	68 00 00 00 10       	push   $0x10000000
+  80017d:	6a 00                	push   $0x0
+  80017f:	e8 64 0e 00 00       	call   800fe8 <sys_page_split>
+  800184:	83 c4 10             	add    $0x10,%esp
+  800187:	85 c0                	test   %eax,%eax
+  800189:	78 57                	js     8001e2 <umain+0x1af>
+		panic("sys_page_split: %e", r);
+	assert(!(uvpd[PDX(BASE)] & PTE_PS));
+  80018b:	a1 00 d1 7b ef       	mov    0xef7bd100,%eax
+  800190:	a8 80                	test   $0x80,%al
+  800192:	75 60                	jne    8001f4 <umain+0x1c1>
+	for (va = BASE; va < BASE + PTSIZE; va += PGSIZE) {
+  800194:	b8 00 00 00 10       	mov    $0x10000000,%eax
+		assert(uvpt[PGNUM(va)] & PTE_P);
+  800199:	89 c2                	mov    %eax,%edx
+  80019b:	c1 ea 0c             	shr    $0xc,%edx
+  80019e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8001a5:	f6 c2 01             	test   $0x1,%dl
+  8001a8:	74 60                	je     80020a <umain+0x1d7>
+		assert(*(uintptr_t*)va == va);
+  8001aa:	39 00                	cmp    %eax,(%eax)
+  8001ac:	75 72                	jne    800220 <umain+0x1ed>
+	for (va = BASE; va < BASE + PTSIZE; va += PGSIZE) {
+  8001ae:	05 00 10 00 00       	add    $0x1000,%eax
+  8001b3:	3d 00 00 40 10       	cmp    $0x10400000,%eax
+  8001b8:	75 df                	jne    800199 <umain+0x166>
+	}
+
+	if ((envid = fork()) < 0)
+  8001ba:	e8 49 14 00 00       	call   801608 <fork>
+  8001bf:	85 c0                	test   %eax,%eax
+  8001c1:	78 73                	js     800236 <umain+0x203>
+		panic("fork: %e", envid);
+	if (envid == 0) {
+		for (va = BASE; va < top; va += PGSIZE)
+  8001c3:	ba 00 00 00 10       	mov    $0x10000000,%edx
+	if (envid == 0) {
+  8001c8:	0f 85 90 00 00 00    	jne    80025e <umain+0x22b>
+		for (va = BASE; va < top; va += PGSIZE)
+  8001ce:	39 da                	cmp    %ebx,%edx
+  8001d0:	0f 83 16 01 00 00    	jae    8002ec <umain+0x2b9>
+			assert(*(uintptr_t*)va == va);
+  8001d6:	39 12                	cmp    %edx,(%edx)
+  8001d8:	75 6e                	jne    800248 <umain+0x215>
+		for (va = BASE; va < top; va += PGSIZE)
+  8001da:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  8001e0:	eb ec                	jmp    8001ce <umain+0x19b>
+		panic("sys_page_split: %e", r);
+  8001e2:	50                   	push   %eax
+  8001e3:	68 b6 55 80 00       	push   $0x8055b6
+  8001e8:	6a 29                	push   $0x29
+  8001ea:	68 7f 55 80 00       	push   $0x80557f
+  8001ef:	e8 78 01 00 00       	call   80036c <_panic>
+	assert(!(uvpd[PDX(BASE)] & PTE_PS));
+  8001f4:	68 c9 55 80 00       	push   $0x8055c9
+  8001f9:	68 6a 55 80 00       	push   $0x80556a
+  8001fe:	6a 2a                	push   $0x2a
+  800200:	68 7f 55 80 00       	push   $0x80557f
+  800205:	e8 62 01 00 00       	call   80036c <_panic>
+		assert(uvpt[PGNUM(va)] & PTE_P);
+  80020a:	68 e5 55 80 00       	push   $0x8055e5
+  80020f:	68 6a 55 80 00       	push   $0x80556a
+  800214:	6a 2c                	push   $0x2c
+  800216:	68 7f 55 80 00       	push   $0x80557f
+  80021b:	e8 4c 01 00 00       	call   80036c <_panic>
+		assert(*(uintptr_t*)va == va);
+  800220:	68 fd 55 80 00       	push   $0x8055fd
+  800225:	68 6a 55 80 00       	push   $0x80556a
+  80022a:	6a 2d                	push   $0x2d
+  80022c:	68 7f 55 80 00       	push   $0x80557f
+  800231:	e8 36 01 00 00       	call   80036c <_panic>
+		panic("fork: %e", envid);
+  800236:	50                   	push   %eax
+  800237:	68 13 56 80 00       	push   $0x805613
+  80023c:	6a 31                	push   $0x31
+  80023e:	68 7f 55 80 00       	push   $0x80557f
+  800243:	e8 24 01 00 00       	call   80036c <_panic>
+			assert(*(uintptr_t*)va == va);
+  800248:	68 fd 55 80 00       	push   $0x8055fd
+  80024d:	68 6a 55 80 00       	push   $0x80556a
+  800252:	6a 34                	push   $0x34
+  800254:	68 7f 55 80 00       	push   $0x80557f
+  800259:	e8 0e 01 00 00       	call   80036c <_panic>
+		return;
+	}
+	wait(envid);
+  80025e:	83 ec 0c             	sub    $0xc,%esp
+  800261:	50                   	push   %eax
+  800262:	e8 75 26 00 00       	call   8028dc <wait>
+
+	for (va = top; va < BASE+SIZE; va += PGSIZE) {
+  800267:	83 c4 10             	add    $0x10,%esp
+  80026a:	89 de                	mov    %ebx,%esi
+  80026c:	eb 08                	jmp    800276 <umain+0x243>
+		if ((r = page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W, 1)) < 0)
+			panic("page_alloc on %p: %e", va, r);
+		*(uintptr_t*)va = va;
+  80026e:	89 36                	mov    %esi,(%esi)
+	for (va = top; va < BASE+SIZE; va += PGSIZE) {
+  800270:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  800276:	81 fe ff ff ff 17    	cmp    $0x17ffffff,%esi
+  80027c:	77 29                	ja     8002a7 <umain+0x274>
+		if ((r = page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W, 1)) < 0)
+  80027e:	6a 01                	push   $0x1
+  800280:	6a 07                	push   $0x7
+  800282:	56                   	push   %esi
+  800283:	6a 00                	push   $0x0
+  800285:	e8 b9 3a 00 00       	call   803d43 <page_alloc>
+  80028a:	83 c4 10             	add    $0x10,%esp
+  80028d:	85 c0                	test   %eax,%eax
+  80028f:	79 dd                	jns    80026e <umain+0x23b>
+			panic("page_alloc on %p: %e", va, r);
+  800291:	83 ec 0c             	sub    $0xc,%esp
+  800294:	50                   	push   %eax
+  800295:	56                   	push   %esi
+  800296:	68 a1 55 80 00       	push   $0x8055a1
+  80029b:	6a 3b                	push   $0x3b
+  80029d:	68 7f 55 80 00       	push   $0x80557f
+  8002a2:	e8 c5 00 00 00       	call   80036c <_panic>
+	}
+
+	for (va = BASE; va < BASE+SIZE; va += PGSIZE)
+  8002a7:	b8 00 00 00 10       	mov    $0x10000000,%eax
+		assert(*(uintptr_t*)va == va);
+  8002ac:	39 00                	cmp    %eax,(%eax)
+  8002ae:	75 43                	jne    8002f3 <umain+0x2c0>
+	for (va = BASE; va < BASE+SIZE; va += PGSIZE)
+  8002b0:	05 00 10 00 00       	add    $0x1000,%eax
+  8002b5:	3d 00 00 00 18       	cmp    $0x18000000,%eax
+  8002ba:	75 f0                	jne    8002ac <umain+0x279>
+
+	cprintf("%s: %d large pages, passed all checks!\n",
+		argc > 0 ? argv[0] : "largepage", (top - BASE) / PTSIZE);
+  8002bc:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+	cprintf("%s: %d large pages, passed all checks!\n",
+  8002c2:	c1 eb 16             	shr    $0x16,%ebx
+  8002c5:	b8 60 55 80 00       	mov    $0x805560,%eax
+  8002ca:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8002ce:	7e 05                	jle    8002d5 <umain+0x2a2>
+  8002d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002d3:	8b 00                	mov    (%eax),%eax
+  8002d5:	83 ec 04             	sub    $0x4,%esp
+  8002d8:	53                   	push   %ebx
+  8002d9:	50                   	push   %eax
+  8002da:	68 60 57 80 00       	push   $0x805760
+  8002df:	e8 63 01 00 00       	call   800447 <cprintf>
+	get_and_print_paging_stats();
+  8002e4:	e8 94 36 00 00       	call   80397d <get_and_print_paging_stats>
+  8002e9:	83 c4 10             	add    $0x10,%esp
+}
+  8002ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002ef:	5b                   	pop    %ebx
+  8002f0:	5e                   	pop    %esi
+  8002f1:	5d                   	pop    %ebp
+  8002f2:	c3                   	ret
+		assert(*(uintptr_t*)va == va);
+  8002f3:	68 fd 55 80 00       	push   $0x8055fd
+  8002f8:	68 6a 55 80 00       	push   $0x80556a
+  8002fd:	6a 40                	push   $0x40
+  8002ff:	68 7f 55 80 00       	push   $0x80557f
+  800304:	e8 63 00 00 00       	call   80036c <_panic>
+
+00800309 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800309:	55                   	push   %ebp
+  80030a:	89 e5                	mov    %esp,%ebp
+  80030c:	56                   	push   %esi
+  80030d:	53                   	push   %ebx
+  80030e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800311:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800314:	e8 ca 0b 00 00       	call   800ee3 <sys_getenvid>
+  800319:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80031e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800321:	c1 e0 06             	shl    $0x6,%eax
+  800324:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800329:	a3 18 f9 80 00       	mov    %eax,0x80f918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80032e:	85 db                	test   %ebx,%ebx
+  800330:	7e 07                	jle    800339 <libmain+0x30>
+		binaryname = argv[0];
+  800332:	8b 06                	mov    (%esi),%eax
+  800334:	a3 00 70 80 00       	mov    %eax,0x807000
+
+	// call user main routine
+	umain(argc, argv);
+  800339:	83 ec 08             	sub    $0x8,%esp
+  80033c:	56                   	push   %esi
+  80033d:	53                   	push   %ebx
+  80033e:	e8 f0 fc ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800343:	e8 0a 00 00 00       	call   800352 <exit>
+}
+  800348:	83 c4 10             	add    $0x10,%esp
+  80034b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80034e:	5b                   	pop    %ebx
+  80034f:	5e                   	pop    %esi
+  800350:	5d                   	pop    %ebp
+  800351:	c3                   	ret
+
+00800352 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800352:	55                   	push   %ebp
+  800353:	89 e5                	mov    %esp,%ebp
+  800355:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800358:	e8 de 18 00 00       	call   801c3b <close_all>
+	sys_env_destroy(0);
+  80035d:	83 ec 0c             	sub    $0xc,%esp
+  800360:	6a 00                	push   $0x0
+  800362:	e8 3b 0b 00 00       	call   800ea2 <sys_env_destroy>
+}
+  800367:	83 c4 10             	add    $0x10,%esp
+  80036a:	c9                   	leave
+  80036b:	c3                   	ret
+
+0080036c <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80036c:	55                   	push   %ebp
+  80036d:	89 e5                	mov    %esp,%ebp
+  80036f:	56                   	push   %esi
+  800370:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800371:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800374:	8b 35 00 70 80 00    	mov    0x807000,%esi
+  80037a:	e8 64 0b 00 00       	call   800ee3 <sys_getenvid>
+  80037f:	83 ec 0c             	sub    $0xc,%esp
+  800382:	ff 75 0c             	push   0xc(%ebp)
+  800385:	ff 75 08             	push   0x8(%ebp)
+  800388:	56                   	push   %esi
+  800389:	50                   	push   %eax
+  80038a:	68 94 57 80 00       	push   $0x805794
+  80038f:	e8 b3 00 00 00       	call   800447 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800394:	83 c4 18             	add    $0x18,%esp
+  800397:	53                   	push   %ebx
+  800398:	ff 75 10             	push   0x10(%ebp)
+  80039b:	e8 56 00 00 00       	call   8003f6 <vcprintf>
+	cprintf("\n");
+  8003a0:	c7 04 24 42 5d 80 00 	movl   $0x805d42,(%esp)
+  8003a7:	e8 9b 00 00 00       	call   800447 <cprintf>
+  8003ac:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8003af:	cc                   	int3
+	while (1)
+  8003b0:	eb fd                	jmp    8003af <_panic+0x43>
+
+008003b2 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003b2:	55                   	push   %ebp
+  8003b3:	89 e5                	mov    %esp,%ebp
+  8003b5:	53                   	push   %ebx
+  8003b6:	83 ec 04             	sub    $0x4,%esp
+  8003b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003bc:	8b 13                	mov    (%ebx),%edx
+  8003be:	8d 42 01             	lea    0x1(%edx),%eax
+  8003c1:	89 03                	mov    %eax,(%ebx)
+  8003c3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003c6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003ca:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003cf:	74 09                	je     8003da <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003d1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003d8:	c9                   	leave
+  8003d9:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003da:	83 ec 08             	sub    $0x8,%esp
+  8003dd:	68 ff 00 00 00       	push   $0xff
+  8003e2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003e5:	50                   	push   %eax
+  8003e6:	e8 69 0a 00 00       	call   800e54 <sys_cputs>
+		b->idx = 0;
+  8003eb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003f1:	83 c4 10             	add    $0x10,%esp
+  8003f4:	eb db                	jmp    8003d1 <putch+0x1f>
+
+008003f6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003f6:	55                   	push   %ebp
+  8003f7:	89 e5                	mov    %esp,%ebp
+  8003f9:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003ff:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800406:	00 00 00 
+	b.cnt = 0;
+  800409:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800410:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800413:	ff 75 0c             	push   0xc(%ebp)
+  800416:	ff 75 08             	push   0x8(%ebp)
+  800419:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80041f:	50                   	push   %eax
+  800420:	68 b2 03 80 00       	push   $0x8003b2
+  800425:	e8 14 01 00 00       	call   80053e <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80042a:	83 c4 08             	add    $0x8,%esp
+  80042d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800433:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800439:	50                   	push   %eax
+  80043a:	e8 15 0a 00 00       	call   800e54 <sys_cputs>
+
+	return b.cnt;
+}
+  80043f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800445:	c9                   	leave
+  800446:	c3                   	ret
+
+00800447 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800447:	55                   	push   %ebp
+  800448:	89 e5                	mov    %esp,%ebp
+  80044a:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80044d:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800450:	50                   	push   %eax
+  800451:	ff 75 08             	push   0x8(%ebp)
+  800454:	e8 9d ff ff ff       	call   8003f6 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800459:	c9                   	leave
+  80045a:	c3                   	ret
+
+0080045b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80045b:	55                   	push   %ebp
+  80045c:	89 e5                	mov    %esp,%ebp
+  80045e:	57                   	push   %edi
+  80045f:	56                   	push   %esi
+  800460:	53                   	push   %ebx
+  800461:	83 ec 1c             	sub    $0x1c,%esp
+  800464:	89 c7                	mov    %eax,%edi
+  800466:	89 d6                	mov    %edx,%esi
+  800468:	8b 45 08             	mov    0x8(%ebp),%eax
+  80046b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80046e:	89 d1                	mov    %edx,%ecx
+  800470:	89 c2                	mov    %eax,%edx
+  800472:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800475:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800478:	8b 45 10             	mov    0x10(%ebp),%eax
+  80047b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80047e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800481:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800488:	39 c2                	cmp    %eax,%edx
+  80048a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80048d:	72 3e                	jb     8004cd <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80048f:	83 ec 0c             	sub    $0xc,%esp
+  800492:	ff 75 18             	push   0x18(%ebp)
+  800495:	83 eb 01             	sub    $0x1,%ebx
+  800498:	53                   	push   %ebx
+  800499:	50                   	push   %eax
+  80049a:	83 ec 08             	sub    $0x8,%esp
+  80049d:	ff 75 e4             	push   -0x1c(%ebp)
+  8004a0:	ff 75 e0             	push   -0x20(%ebp)
+  8004a3:	ff 75 dc             	push   -0x24(%ebp)
+  8004a6:	ff 75 d8             	push   -0x28(%ebp)
+  8004a9:	e8 6e 4f 00 00       	call   80541c <__udivdi3>
+  8004ae:	83 c4 18             	add    $0x18,%esp
+  8004b1:	52                   	push   %edx
+  8004b2:	50                   	push   %eax
+  8004b3:	89 f2                	mov    %esi,%edx
+  8004b5:	89 f8                	mov    %edi,%eax
+  8004b7:	e8 9f ff ff ff       	call   80045b <printnum>
+  8004bc:	83 c4 20             	add    $0x20,%esp
+  8004bf:	eb 13                	jmp    8004d4 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8004c1:	83 ec 08             	sub    $0x8,%esp
+  8004c4:	56                   	push   %esi
+  8004c5:	ff 75 18             	push   0x18(%ebp)
+  8004c8:	ff d7                	call   *%edi
+  8004ca:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8004cd:	83 eb 01             	sub    $0x1,%ebx
+  8004d0:	85 db                	test   %ebx,%ebx
+  8004d2:	7f ed                	jg     8004c1 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004d4:	83 ec 08             	sub    $0x8,%esp
+  8004d7:	56                   	push   %esi
+  8004d8:	83 ec 04             	sub    $0x4,%esp
+  8004db:	ff 75 e4             	push   -0x1c(%ebp)
+  8004de:	ff 75 e0             	push   -0x20(%ebp)
+  8004e1:	ff 75 dc             	push   -0x24(%ebp)
+  8004e4:	ff 75 d8             	push   -0x28(%ebp)
+  8004e7:	e8 4e 4f 00 00       	call   80543a <__umoddi3>
+  8004ec:	83 c4 14             	add    $0x14,%esp
+  8004ef:	0f be 80 b7 57 80 00 	movsbl 0x8057b7(%eax),%eax
+  8004f6:	50                   	push   %eax
+  8004f7:	ff d7                	call   *%edi
+}
+  8004f9:	83 c4 10             	add    $0x10,%esp
+  8004fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004ff:	5b                   	pop    %ebx
+  800500:	5e                   	pop    %esi
+  800501:	5f                   	pop    %edi
+  800502:	5d                   	pop    %ebp
+  800503:	c3                   	ret
+
+00800504 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800504:	55                   	push   %ebp
+  800505:	89 e5                	mov    %esp,%ebp
+  800507:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80050a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80050e:	8b 10                	mov    (%eax),%edx
+  800510:	3b 50 04             	cmp    0x4(%eax),%edx
+  800513:	73 0a                	jae    80051f <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800515:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800518:	89 08                	mov    %ecx,(%eax)
+  80051a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80051d:	88 02                	mov    %al,(%edx)
+}
+  80051f:	5d                   	pop    %ebp
+  800520:	c3                   	ret
+
+00800521 <printfmt>:
+{
+  800521:	55                   	push   %ebp
+  800522:	89 e5                	mov    %esp,%ebp
+  800524:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800527:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80052a:	50                   	push   %eax
+  80052b:	ff 75 10             	push   0x10(%ebp)
+  80052e:	ff 75 0c             	push   0xc(%ebp)
+  800531:	ff 75 08             	push   0x8(%ebp)
+  800534:	e8 05 00 00 00       	call   80053e <vprintfmt>
+}
+  800539:	83 c4 10             	add    $0x10,%esp
+  80053c:	c9                   	leave
+  80053d:	c3                   	ret
+
+0080053e <vprintfmt>:
+{
+  80053e:	55                   	push   %ebp
+  80053f:	89 e5                	mov    %esp,%ebp
+  800541:	57                   	push   %edi
+  800542:	56                   	push   %esi
+  800543:	53                   	push   %ebx
+  800544:	83 ec 2c             	sub    $0x2c,%esp
+  800547:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80054d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800550:	eb 0a                	jmp    80055c <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800552:	83 ec 08             	sub    $0x8,%esp
+  800555:	53                   	push   %ebx
+  800556:	50                   	push   %eax
+  800557:	ff d6                	call   *%esi
+  800559:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80055c:	83 c7 01             	add    $0x1,%edi
+  80055f:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800563:	83 f8 25             	cmp    $0x25,%eax
+  800566:	74 0c                	je     800574 <vprintfmt+0x36>
+			if (ch == '\0')
+  800568:	85 c0                	test   %eax,%eax
+  80056a:	75 e6                	jne    800552 <vprintfmt+0x14>
+}
+  80056c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80056f:	5b                   	pop    %ebx
+  800570:	5e                   	pop    %esi
+  800571:	5f                   	pop    %edi
+  800572:	5d                   	pop    %ebp
+  800573:	c3                   	ret
+		padc = ' ';
+  800574:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800578:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80057f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800586:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80058d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800592:	8d 47 01             	lea    0x1(%edi),%eax
+  800595:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800598:	0f b6 17             	movzbl (%edi),%edx
+  80059b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80059e:	3c 55                	cmp    $0x55,%al
+  8005a0:	0f 87 c5 03 00 00    	ja     80096b <vprintfmt+0x42d>
+  8005a6:	0f b6 c0             	movzbl %al,%eax
+  8005a9:	ff 24 85 40 59 80 00 	jmp    *0x805940(,%eax,4)
+  8005b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8005b3:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8005b7:	eb d9                	jmp    800592 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005bc:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8005c0:	eb d0                	jmp    800592 <vprintfmt+0x54>
+  8005c2:	0f b6 d2             	movzbl %dl,%edx
+  8005c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8005c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005cd:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8005d0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005d3:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8005d7:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8005da:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005dd:	83 f9 09             	cmp    $0x9,%ecx
+  8005e0:	77 55                	ja     800637 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8005e2:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8005e5:	eb e9                	jmp    8005d0 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8005e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ea:	8b 00                	mov    (%eax),%eax
+  8005ec:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f5:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005f8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8005fb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005ff:	79 91                	jns    800592 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800601:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800604:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800607:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80060e:	eb 82                	jmp    800592 <vprintfmt+0x54>
+			if (width < 0)
+  800610:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800613:	85 d2                	test   %edx,%edx
+  800615:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061a:	0f 49 c2             	cmovns %edx,%eax
+  80061d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800620:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800623:	e9 6a ff ff ff       	jmp    800592 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800628:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80062b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800632:	e9 5b ff ff ff       	jmp    800592 <vprintfmt+0x54>
+  800637:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80063a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80063d:	eb bc                	jmp    8005fb <vprintfmt+0xbd>
+			lflag++;
+  80063f:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800642:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800645:	e9 48 ff ff ff       	jmp    800592 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80064a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064d:	8d 78 04             	lea    0x4(%eax),%edi
+  800650:	83 ec 08             	sub    $0x8,%esp
+  800653:	53                   	push   %ebx
+  800654:	ff 30                	push   (%eax)
+  800656:	ff d6                	call   *%esi
+			break;
+  800658:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80065b:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80065e:	e9 63 02 00 00       	jmp    8008c6 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800663:	8b 45 14             	mov    0x14(%ebp),%eax
+  800666:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800669:	8b 10                	mov    (%eax),%edx
+  80066b:	89 d0                	mov    %edx,%eax
+  80066d:	f7 d8                	neg    %eax
+  80066f:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800672:	83 f8 12             	cmp    $0x12,%eax
+  800675:	7f 23                	jg     80069a <vprintfmt+0x15c>
+  800677:	8b 14 85 a0 5a 80 00 	mov    0x805aa0(,%eax,4),%edx
+  80067e:	85 d2                	test   %edx,%edx
+  800680:	74 18                	je     80069a <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800682:	52                   	push   %edx
+  800683:	68 7c 55 80 00       	push   $0x80557c
+  800688:	53                   	push   %ebx
+  800689:	56                   	push   %esi
+  80068a:	e8 92 fe ff ff       	call   800521 <printfmt>
+  80068f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800692:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800695:	e9 2c 02 00 00       	jmp    8008c6 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80069a:	50                   	push   %eax
+  80069b:	68 cf 57 80 00       	push   $0x8057cf
+  8006a0:	53                   	push   %ebx
+  8006a1:	56                   	push   %esi
+  8006a2:	e8 7a fe ff ff       	call   800521 <printfmt>
+  8006a7:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006aa:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8006ad:	e9 14 02 00 00       	jmp    8008c6 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b5:	83 c0 04             	add    $0x4,%eax
+  8006b8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8006bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006be:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8006c0:	85 c9                	test   %ecx,%ecx
+  8006c2:	b8 c8 57 80 00       	mov    $0x8057c8,%eax
+  8006c7:	0f 45 c1             	cmovne %ecx,%eax
+  8006ca:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8006cd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006d1:	7e 06                	jle    8006d9 <vprintfmt+0x19b>
+  8006d3:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006d7:	75 0b                	jne    8006e4 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006d9:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006dc:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006df:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006e2:	eb 5c                	jmp    800740 <vprintfmt+0x202>
+  8006e4:	83 ec 08             	sub    $0x8,%esp
+  8006e7:	ff 75 d0             	push   -0x30(%ebp)
+  8006ea:	ff 75 cc             	push   -0x34(%ebp)
+  8006ed:	e8 19 03 00 00       	call   800a0b <strnlen>
+  8006f2:	89 c2                	mov    %eax,%edx
+  8006f4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006f7:	29 d0                	sub    %edx,%eax
+  8006f9:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8006fc:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800700:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800703:	89 75 08             	mov    %esi,0x8(%ebp)
+  800706:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800708:	eb 0e                	jmp    800718 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80070a:	83 ec 08             	sub    $0x8,%esp
+  80070d:	53                   	push   %ebx
+  80070e:	57                   	push   %edi
+  80070f:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800712:	83 ee 01             	sub    $0x1,%esi
+  800715:	83 c4 10             	add    $0x10,%esp
+  800718:	85 f6                	test   %esi,%esi
+  80071a:	7f ee                	jg     80070a <vprintfmt+0x1cc>
+  80071c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80071f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800722:	85 c0                	test   %eax,%eax
+  800724:	ba 00 00 00 00       	mov    $0x0,%edx
+  800729:	0f 49 d0             	cmovns %eax,%edx
+  80072c:	29 d0                	sub    %edx,%eax
+  80072e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800731:	eb a6                	jmp    8006d9 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800733:	83 ec 08             	sub    $0x8,%esp
+  800736:	53                   	push   %ebx
+  800737:	52                   	push   %edx
+  800738:	ff 55 08             	call   *0x8(%ebp)
+  80073b:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80073e:	89 f1                	mov    %esi,%ecx
+  800740:	8d 71 01             	lea    0x1(%ecx),%esi
+  800743:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800747:	0f be d0             	movsbl %al,%edx
+  80074a:	85 d2                	test   %edx,%edx
+  80074c:	74 28                	je     800776 <vprintfmt+0x238>
+  80074e:	85 ff                	test   %edi,%edi
+  800750:	78 05                	js     800757 <vprintfmt+0x219>
+  800752:	83 ef 01             	sub    $0x1,%edi
+  800755:	78 30                	js     800787 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800757:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80075b:	74 d6                	je     800733 <vprintfmt+0x1f5>
+  80075d:	0f be c0             	movsbl %al,%eax
+  800760:	83 e8 20             	sub    $0x20,%eax
+  800763:	83 f8 5e             	cmp    $0x5e,%eax
+  800766:	76 cb                	jbe    800733 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800768:	83 ec 08             	sub    $0x8,%esp
+  80076b:	53                   	push   %ebx
+  80076c:	6a 3f                	push   $0x3f
+  80076e:	ff 55 08             	call   *0x8(%ebp)
+  800771:	83 c4 10             	add    $0x10,%esp
+  800774:	eb c8                	jmp    80073e <vprintfmt+0x200>
+  800776:	8b 75 08             	mov    0x8(%ebp),%esi
+  800779:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80077c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80077f:	01 d0                	add    %edx,%eax
+  800781:	29 c8                	sub    %ecx,%eax
+  800783:	89 c7                	mov    %eax,%edi
+  800785:	eb 13                	jmp    80079a <vprintfmt+0x25c>
+  800787:	8b 75 08             	mov    0x8(%ebp),%esi
+  80078a:	eb ed                	jmp    800779 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80078c:	83 ec 08             	sub    $0x8,%esp
+  80078f:	53                   	push   %ebx
+  800790:	6a 20                	push   $0x20
+  800792:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800794:	83 ef 01             	sub    $0x1,%edi
+  800797:	83 c4 10             	add    $0x10,%esp
+  80079a:	85 ff                	test   %edi,%edi
+  80079c:	7f ee                	jg     80078c <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80079e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8007a1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007a4:	e9 1d 01 00 00       	jmp    8008c6 <vprintfmt+0x388>
+	if (lflag >= 2)
+  8007a9:	83 f9 01             	cmp    $0x1,%ecx
+  8007ac:	7f 1b                	jg     8007c9 <vprintfmt+0x28b>
+	else if (lflag)
+  8007ae:	85 c9                	test   %ecx,%ecx
+  8007b0:	74 63                	je     800815 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  8007b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b5:	8b 00                	mov    (%eax),%eax
+  8007b7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007ba:	99                   	cltd
+  8007bb:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c7:	eb 17                	jmp    8007e0 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  8007c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cc:	8b 50 04             	mov    0x4(%eax),%edx
+  8007cf:	8b 00                	mov    (%eax),%eax
+  8007d1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007d4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007da:	8d 40 08             	lea    0x8(%eax),%eax
+  8007dd:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007e0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007e3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8007e6:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8007eb:	85 c9                	test   %ecx,%ecx
+  8007ed:	0f 89 b9 00 00 00    	jns    8008ac <vprintfmt+0x36e>
+				putch('-', putdat);
+  8007f3:	83 ec 08             	sub    $0x8,%esp
+  8007f6:	53                   	push   %ebx
+  8007f7:	6a 2d                	push   $0x2d
+  8007f9:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8007fb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007fe:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800801:	f7 da                	neg    %edx
+  800803:	83 d1 00             	adc    $0x0,%ecx
+  800806:	f7 d9                	neg    %ecx
+  800808:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80080b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800810:	e9 97 00 00 00       	jmp    8008ac <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800815:	8b 45 14             	mov    0x14(%ebp),%eax
+  800818:	8b 00                	mov    (%eax),%eax
+  80081a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80081d:	99                   	cltd
+  80081e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800821:	8b 45 14             	mov    0x14(%ebp),%eax
+  800824:	8d 40 04             	lea    0x4(%eax),%eax
+  800827:	89 45 14             	mov    %eax,0x14(%ebp)
+  80082a:	eb b4                	jmp    8007e0 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  80082c:	83 f9 01             	cmp    $0x1,%ecx
+  80082f:	7f 1b                	jg     80084c <vprintfmt+0x30e>
+	else if (lflag)
+  800831:	85 c9                	test   %ecx,%ecx
+  800833:	74 2c                	je     800861 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800835:	8b 45 14             	mov    0x14(%ebp),%eax
+  800838:	8b 10                	mov    (%eax),%edx
+  80083a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80083f:	8d 40 04             	lea    0x4(%eax),%eax
+  800842:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800845:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80084a:	eb 60                	jmp    8008ac <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80084c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084f:	8b 10                	mov    (%eax),%edx
+  800851:	8b 48 04             	mov    0x4(%eax),%ecx
+  800854:	8d 40 08             	lea    0x8(%eax),%eax
+  800857:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80085a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80085f:	eb 4b                	jmp    8008ac <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800861:	8b 45 14             	mov    0x14(%ebp),%eax
+  800864:	8b 10                	mov    (%eax),%edx
+  800866:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80086b:	8d 40 04             	lea    0x4(%eax),%eax
+  80086e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800871:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800876:	eb 34                	jmp    8008ac <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800878:	83 f9 01             	cmp    $0x1,%ecx
+  80087b:	7f 15                	jg     800892 <vprintfmt+0x354>
+	else if (lflag)
+  80087d:	85 c9                	test   %ecx,%ecx
+  80087f:	74 4d                	je     8008ce <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800881:	8b 45 14             	mov    0x14(%ebp),%eax
+  800884:	8b 00                	mov    (%eax),%eax
+  800886:	99                   	cltd
+  800887:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80088a:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80088d:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800890:	eb 11                	jmp    8008a3 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800892:	8b 45 14             	mov    0x14(%ebp),%eax
+  800895:	8b 50 04             	mov    0x4(%eax),%edx
+  800898:	8b 00                	mov    (%eax),%eax
+  80089a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80089d:	8d 49 08             	lea    0x8(%ecx),%ecx
+  8008a0:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  8008a3:	89 d1                	mov    %edx,%ecx
+  8008a5:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  8008a7:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8008ac:	83 ec 0c             	sub    $0xc,%esp
+  8008af:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008b3:	50                   	push   %eax
+  8008b4:	ff 75 e0             	push   -0x20(%ebp)
+  8008b7:	57                   	push   %edi
+  8008b8:	51                   	push   %ecx
+  8008b9:	52                   	push   %edx
+  8008ba:	89 da                	mov    %ebx,%edx
+  8008bc:	89 f0                	mov    %esi,%eax
+  8008be:	e8 98 fb ff ff       	call   80045b <printnum>
+			break;
+  8008c3:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8008c6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008c9:	e9 8e fc ff ff       	jmp    80055c <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  8008ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d1:	8b 00                	mov    (%eax),%eax
+  8008d3:	99                   	cltd
+  8008d4:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8008d7:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8008da:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8008dd:	eb c4                	jmp    8008a3 <vprintfmt+0x365>
+			putch('0', putdat);
+  8008df:	83 ec 08             	sub    $0x8,%esp
+  8008e2:	53                   	push   %ebx
+  8008e3:	6a 30                	push   $0x30
+  8008e5:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8008e7:	83 c4 08             	add    $0x8,%esp
+  8008ea:	53                   	push   %ebx
+  8008eb:	6a 78                	push   $0x78
+  8008ed:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8008ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f2:	8b 10                	mov    (%eax),%edx
+  8008f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8008f9:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008fc:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800902:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800907:	eb a3                	jmp    8008ac <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800909:	83 f9 01             	cmp    $0x1,%ecx
+  80090c:	7f 1b                	jg     800929 <vprintfmt+0x3eb>
+	else if (lflag)
+  80090e:	85 c9                	test   %ecx,%ecx
+  800910:	74 2f                	je     800941 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800912:	8b 45 14             	mov    0x14(%ebp),%eax
+  800915:	8b 10                	mov    (%eax),%edx
+  800917:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80091c:	8d 40 04             	lea    0x4(%eax),%eax
+  80091f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800922:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800927:	eb 83                	jmp    8008ac <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800929:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092c:	8b 10                	mov    (%eax),%edx
+  80092e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800931:	8d 40 08             	lea    0x8(%eax),%eax
+  800934:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800937:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80093c:	e9 6b ff ff ff       	jmp    8008ac <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800941:	8b 45 14             	mov    0x14(%ebp),%eax
+  800944:	8b 10                	mov    (%eax),%edx
+  800946:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80094b:	8d 40 04             	lea    0x4(%eax),%eax
+  80094e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800951:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800956:	e9 51 ff ff ff       	jmp    8008ac <vprintfmt+0x36e>
+			putch(ch, putdat);
+  80095b:	83 ec 08             	sub    $0x8,%esp
+  80095e:	53                   	push   %ebx
+  80095f:	6a 25                	push   $0x25
+  800961:	ff d6                	call   *%esi
+			break;
+  800963:	83 c4 10             	add    $0x10,%esp
+  800966:	e9 5b ff ff ff       	jmp    8008c6 <vprintfmt+0x388>
+			putch('%', putdat);
+  80096b:	83 ec 08             	sub    $0x8,%esp
+  80096e:	53                   	push   %ebx
+  80096f:	6a 25                	push   $0x25
+  800971:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800973:	83 c4 10             	add    $0x10,%esp
+  800976:	89 f8                	mov    %edi,%eax
+  800978:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80097c:	74 05                	je     800983 <vprintfmt+0x445>
+  80097e:	83 e8 01             	sub    $0x1,%eax
+  800981:	eb f5                	jmp    800978 <vprintfmt+0x43a>
+  800983:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800986:	e9 3b ff ff ff       	jmp    8008c6 <vprintfmt+0x388>
+
+0080098b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80098b:	55                   	push   %ebp
+  80098c:	89 e5                	mov    %esp,%ebp
+  80098e:	83 ec 18             	sub    $0x18,%esp
+  800991:	8b 45 08             	mov    0x8(%ebp),%eax
+  800994:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800997:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80099a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80099e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009a1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009a8:	85 c0                	test   %eax,%eax
+  8009aa:	74 26                	je     8009d2 <vsnprintf+0x47>
+  8009ac:	85 d2                	test   %edx,%edx
+  8009ae:	7e 22                	jle    8009d2 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009b0:	ff 75 14             	push   0x14(%ebp)
+  8009b3:	ff 75 10             	push   0x10(%ebp)
+  8009b6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009b9:	50                   	push   %eax
+  8009ba:	68 04 05 80 00       	push   $0x800504
+  8009bf:	e8 7a fb ff ff       	call   80053e <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009c4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009c7:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009cd:	83 c4 10             	add    $0x10,%esp
+}
+  8009d0:	c9                   	leave
+  8009d1:	c3                   	ret
+		return -E_INVAL;
+  8009d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009d7:	eb f7                	jmp    8009d0 <vsnprintf+0x45>
+
+008009d9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009d9:	55                   	push   %ebp
+  8009da:	89 e5                	mov    %esp,%ebp
+  8009dc:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009df:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009e2:	50                   	push   %eax
+  8009e3:	ff 75 10             	push   0x10(%ebp)
+  8009e6:	ff 75 0c             	push   0xc(%ebp)
+  8009e9:	ff 75 08             	push   0x8(%ebp)
+  8009ec:	e8 9a ff ff ff       	call   80098b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009f1:	c9                   	leave
+  8009f2:	c3                   	ret
+
+008009f3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009f3:	55                   	push   %ebp
+  8009f4:	89 e5                	mov    %esp,%ebp
+  8009f6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009fe:	eb 03                	jmp    800a03 <strlen+0x10>
+		n++;
+  800a00:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a03:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a07:	75 f7                	jne    800a00 <strlen+0xd>
+	return n;
+}
+  800a09:	5d                   	pop    %ebp
+  800a0a:	c3                   	ret
+
+00800a0b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a0b:	55                   	push   %ebp
+  800a0c:	89 e5                	mov    %esp,%ebp
+  800a0e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a11:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a19:	eb 03                	jmp    800a1e <strnlen+0x13>
+		n++;
+  800a1b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a1e:	39 d0                	cmp    %edx,%eax
+  800a20:	74 08                	je     800a2a <strnlen+0x1f>
+  800a22:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a26:	75 f3                	jne    800a1b <strnlen+0x10>
+  800a28:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a2a:	89 d0                	mov    %edx,%eax
+  800a2c:	5d                   	pop    %ebp
+  800a2d:	c3                   	ret
+
+00800a2e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a2e:	55                   	push   %ebp
+  800a2f:	89 e5                	mov    %esp,%ebp
+  800a31:	53                   	push   %ebx
+  800a32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a35:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a41:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a44:	83 c0 01             	add    $0x1,%eax
+  800a47:	84 d2                	test   %dl,%dl
+  800a49:	75 f2                	jne    800a3d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a4b:	89 c8                	mov    %ecx,%eax
+  800a4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a50:	c9                   	leave
+  800a51:	c3                   	ret
+
+00800a52 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a52:	55                   	push   %ebp
+  800a53:	89 e5                	mov    %esp,%ebp
+  800a55:	53                   	push   %ebx
+  800a56:	83 ec 10             	sub    $0x10,%esp
+  800a59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a5c:	53                   	push   %ebx
+  800a5d:	e8 91 ff ff ff       	call   8009f3 <strlen>
+  800a62:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a65:	ff 75 0c             	push   0xc(%ebp)
+  800a68:	01 d8                	add    %ebx,%eax
+  800a6a:	50                   	push   %eax
+  800a6b:	e8 be ff ff ff       	call   800a2e <strcpy>
+	return dst;
+}
+  800a70:	89 d8                	mov    %ebx,%eax
+  800a72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a75:	c9                   	leave
+  800a76:	c3                   	ret
+
+00800a77 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a77:	55                   	push   %ebp
+  800a78:	89 e5                	mov    %esp,%ebp
+  800a7a:	56                   	push   %esi
+  800a7b:	53                   	push   %ebx
+  800a7c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a7f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a82:	89 f3                	mov    %esi,%ebx
+  800a84:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a87:	89 f0                	mov    %esi,%eax
+  800a89:	eb 0f                	jmp    800a9a <strncpy+0x23>
+		*dst++ = *src;
+  800a8b:	83 c0 01             	add    $0x1,%eax
+  800a8e:	0f b6 0a             	movzbl (%edx),%ecx
+  800a91:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a94:	80 f9 01             	cmp    $0x1,%cl
+  800a97:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a9a:	39 d8                	cmp    %ebx,%eax
+  800a9c:	75 ed                	jne    800a8b <strncpy+0x14>
+	}
+	return ret;
+}
+  800a9e:	89 f0                	mov    %esi,%eax
+  800aa0:	5b                   	pop    %ebx
+  800aa1:	5e                   	pop    %esi
+  800aa2:	5d                   	pop    %ebp
+  800aa3:	c3                   	ret
+
+00800aa4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800aa4:	55                   	push   %ebp
+  800aa5:	89 e5                	mov    %esp,%ebp
+  800aa7:	56                   	push   %esi
+  800aa8:	53                   	push   %ebx
+  800aa9:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aaf:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ab2:	89 f0                	mov    %esi,%eax
+  800ab4:	85 d2                	test   %edx,%edx
+  800ab6:	74 21                	je     800ad9 <strlcpy+0x35>
+  800ab8:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800abc:	89 f2                	mov    %esi,%edx
+  800abe:	eb 09                	jmp    800ac9 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800ac0:	83 c1 01             	add    $0x1,%ecx
+  800ac3:	83 c2 01             	add    $0x1,%edx
+  800ac6:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800ac9:	39 c2                	cmp    %eax,%edx
+  800acb:	74 09                	je     800ad6 <strlcpy+0x32>
+  800acd:	0f b6 19             	movzbl (%ecx),%ebx
+  800ad0:	84 db                	test   %bl,%bl
+  800ad2:	75 ec                	jne    800ac0 <strlcpy+0x1c>
+  800ad4:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800ad6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800ad9:	29 f0                	sub    %esi,%eax
+}
+  800adb:	5b                   	pop    %ebx
+  800adc:	5e                   	pop    %esi
+  800add:	5d                   	pop    %ebp
+  800ade:	c3                   	ret
+
+00800adf <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800adf:	55                   	push   %ebp
+  800ae0:	89 e5                	mov    %esp,%ebp
+  800ae2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ae5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ae8:	eb 06                	jmp    800af0 <strcmp+0x11>
+		p++, q++;
+  800aea:	83 c1 01             	add    $0x1,%ecx
+  800aed:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800af0:	0f b6 01             	movzbl (%ecx),%eax
+  800af3:	84 c0                	test   %al,%al
+  800af5:	74 04                	je     800afb <strcmp+0x1c>
+  800af7:	3a 02                	cmp    (%edx),%al
+  800af9:	74 ef                	je     800aea <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800afb:	0f b6 c0             	movzbl %al,%eax
+  800afe:	0f b6 12             	movzbl (%edx),%edx
+  800b01:	29 d0                	sub    %edx,%eax
+}
+  800b03:	5d                   	pop    %ebp
+  800b04:	c3                   	ret
+
+00800b05 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b05:	55                   	push   %ebp
+  800b06:	89 e5                	mov    %esp,%ebp
+  800b08:	53                   	push   %ebx
+  800b09:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b0f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b12:	eb 09                	jmp    800b1d <strncmp+0x18>
+		n--, p++, q++;
+  800b14:	83 ea 01             	sub    $0x1,%edx
+  800b17:	83 c0 01             	add    $0x1,%eax
+  800b1a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b1d:	85 d2                	test   %edx,%edx
+  800b1f:	74 18                	je     800b39 <strncmp+0x34>
+  800b21:	0f b6 18             	movzbl (%eax),%ebx
+  800b24:	84 db                	test   %bl,%bl
+  800b26:	74 04                	je     800b2c <strncmp+0x27>
+  800b28:	3a 19                	cmp    (%ecx),%bl
+  800b2a:	74 e8                	je     800b14 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b2c:	0f b6 00             	movzbl (%eax),%eax
+  800b2f:	0f b6 11             	movzbl (%ecx),%edx
+  800b32:	29 d0                	sub    %edx,%eax
+}
+  800b34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b37:	c9                   	leave
+  800b38:	c3                   	ret
+		return 0;
+  800b39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3e:	eb f4                	jmp    800b34 <strncmp+0x2f>
+
+00800b40 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b40:	55                   	push   %ebp
+  800b41:	89 e5                	mov    %esp,%ebp
+  800b43:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b46:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b4a:	eb 03                	jmp    800b4f <strchr+0xf>
+  800b4c:	83 c0 01             	add    $0x1,%eax
+  800b4f:	0f b6 10             	movzbl (%eax),%edx
+  800b52:	84 d2                	test   %dl,%dl
+  800b54:	74 06                	je     800b5c <strchr+0x1c>
+		if (*s == c)
+  800b56:	38 ca                	cmp    %cl,%dl
+  800b58:	75 f2                	jne    800b4c <strchr+0xc>
+  800b5a:	eb 05                	jmp    800b61 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b61:	5d                   	pop    %ebp
+  800b62:	c3                   	ret
+
+00800b63 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b63:	55                   	push   %ebp
+  800b64:	89 e5                	mov    %esp,%ebp
+  800b66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b69:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b6d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b70:	38 ca                	cmp    %cl,%dl
+  800b72:	74 09                	je     800b7d <strfind+0x1a>
+  800b74:	84 d2                	test   %dl,%dl
+  800b76:	74 05                	je     800b7d <strfind+0x1a>
+	for (; *s; s++)
+  800b78:	83 c0 01             	add    $0x1,%eax
+  800b7b:	eb f0                	jmp    800b6d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b7d:	5d                   	pop    %ebp
+  800b7e:	c3                   	ret
+
+00800b7f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b7f:	55                   	push   %ebp
+  800b80:	89 e5                	mov    %esp,%ebp
+  800b82:	57                   	push   %edi
+  800b83:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b86:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b89:	85 c9                	test   %ecx,%ecx
+  800b8b:	74 20                	je     800bad <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b8d:	89 f8                	mov    %edi,%eax
+  800b8f:	09 c8                	or     %ecx,%eax
+  800b91:	a8 03                	test   $0x3,%al
+  800b93:	75 12                	jne    800ba7 <memset+0x28>
+		c &= 0xFF;
+  800b95:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b99:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b9f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ba2:	fc                   	cld
+  800ba3:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ba5:	eb 06                	jmp    800bad <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ba7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800baa:	fc                   	cld
+  800bab:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bad:	89 f8                	mov    %edi,%eax
+  800baf:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bb2:	c9                   	leave
+  800bb3:	c3                   	ret
+
+00800bb4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bb4:	55                   	push   %ebp
+  800bb5:	89 e5                	mov    %esp,%ebp
+  800bb7:	57                   	push   %edi
+  800bb8:	56                   	push   %esi
+  800bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bbc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bbf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bc2:	39 c6                	cmp    %eax,%esi
+  800bc4:	73 32                	jae    800bf8 <memmove+0x44>
+  800bc6:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bc9:	39 d0                	cmp    %edx,%eax
+  800bcb:	73 2b                	jae    800bf8 <memmove+0x44>
+		s += n;
+		d += n;
+  800bcd:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bd0:	89 d6                	mov    %edx,%esi
+  800bd2:	09 fe                	or     %edi,%esi
+  800bd4:	09 ce                	or     %ecx,%esi
+  800bd6:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bdc:	75 0e                	jne    800bec <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bde:	83 ef 04             	sub    $0x4,%edi
+  800be1:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800be4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800be7:	fd                   	std
+  800be8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bea:	eb 09                	jmp    800bf5 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bec:	83 ef 01             	sub    $0x1,%edi
+  800bef:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800bf2:	fd                   	std
+  800bf3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800bf5:	fc                   	cld
+  800bf6:	eb 1a                	jmp    800c12 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bf8:	89 f2                	mov    %esi,%edx
+  800bfa:	09 c2                	or     %eax,%edx
+  800bfc:	09 ca                	or     %ecx,%edx
+  800bfe:	f6 c2 03             	test   $0x3,%dl
+  800c01:	75 0a                	jne    800c0d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c03:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c06:	89 c7                	mov    %eax,%edi
+  800c08:	fc                   	cld
+  800c09:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c0b:	eb 05                	jmp    800c12 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c0d:	89 c7                	mov    %eax,%edi
+  800c0f:	fc                   	cld
+  800c10:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c12:	5e                   	pop    %esi
+  800c13:	5f                   	pop    %edi
+  800c14:	5d                   	pop    %ebp
+  800c15:	c3                   	ret
+
+00800c16 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c16:	55                   	push   %ebp
+  800c17:	89 e5                	mov    %esp,%ebp
+  800c19:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c1c:	ff 75 10             	push   0x10(%ebp)
+  800c1f:	ff 75 0c             	push   0xc(%ebp)
+  800c22:	ff 75 08             	push   0x8(%ebp)
+  800c25:	e8 8a ff ff ff       	call   800bb4 <memmove>
+}
+  800c2a:	c9                   	leave
+  800c2b:	c3                   	ret
+
+00800c2c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c2c:	55                   	push   %ebp
+  800c2d:	89 e5                	mov    %esp,%ebp
+  800c2f:	56                   	push   %esi
+  800c30:	53                   	push   %ebx
+  800c31:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c34:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c37:	89 c6                	mov    %eax,%esi
+  800c39:	03 75 10             	add    0x10(%ebp),%esi
+  800c3c:	eb 06                	jmp    800c44 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c3e:	83 c0 01             	add    $0x1,%eax
+  800c41:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c44:	39 f0                	cmp    %esi,%eax
+  800c46:	74 14                	je     800c5c <memcmp+0x30>
+		if (*s1 != *s2)
+  800c48:	0f b6 08             	movzbl (%eax),%ecx
+  800c4b:	0f b6 1a             	movzbl (%edx),%ebx
+  800c4e:	38 d9                	cmp    %bl,%cl
+  800c50:	74 ec                	je     800c3e <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c52:	0f b6 c1             	movzbl %cl,%eax
+  800c55:	0f b6 db             	movzbl %bl,%ebx
+  800c58:	29 d8                	sub    %ebx,%eax
+  800c5a:	eb 05                	jmp    800c61 <memcmp+0x35>
+	}
+
+	return 0;
+  800c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c61:	5b                   	pop    %ebx
+  800c62:	5e                   	pop    %esi
+  800c63:	5d                   	pop    %ebp
+  800c64:	c3                   	ret
+
+00800c65 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c65:	55                   	push   %ebp
+  800c66:	89 e5                	mov    %esp,%ebp
+  800c68:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c6e:	89 c2                	mov    %eax,%edx
+  800c70:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c73:	eb 03                	jmp    800c78 <memfind+0x13>
+  800c75:	83 c0 01             	add    $0x1,%eax
+  800c78:	39 d0                	cmp    %edx,%eax
+  800c7a:	73 04                	jae    800c80 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c7c:	38 08                	cmp    %cl,(%eax)
+  800c7e:	75 f5                	jne    800c75 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c80:	5d                   	pop    %ebp
+  800c81:	c3                   	ret
+
+00800c82 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c82:	55                   	push   %ebp
+  800c83:	89 e5                	mov    %esp,%ebp
+  800c85:	57                   	push   %edi
+  800c86:	56                   	push   %esi
+  800c87:	53                   	push   %ebx
+  800c88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c8e:	eb 03                	jmp    800c93 <strtol+0x11>
+		s++;
+  800c90:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c93:	0f b6 02             	movzbl (%edx),%eax
+  800c96:	3c 20                	cmp    $0x20,%al
+  800c98:	74 f6                	je     800c90 <strtol+0xe>
+  800c9a:	3c 09                	cmp    $0x9,%al
+  800c9c:	74 f2                	je     800c90 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c9e:	3c 2b                	cmp    $0x2b,%al
+  800ca0:	74 2a                	je     800ccc <strtol+0x4a>
+	int neg = 0;
+  800ca2:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ca7:	3c 2d                	cmp    $0x2d,%al
+  800ca9:	74 2b                	je     800cd6 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cab:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cb1:	75 0f                	jne    800cc2 <strtol+0x40>
+  800cb3:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cb6:	74 28                	je     800ce0 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800cb8:	85 db                	test   %ebx,%ebx
+  800cba:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cbf:	0f 44 d8             	cmove  %eax,%ebx
+  800cc2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cc7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cca:	eb 46                	jmp    800d12 <strtol+0x90>
+		s++;
+  800ccc:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ccf:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cd4:	eb d5                	jmp    800cab <strtol+0x29>
+		s++, neg = 1;
+  800cd6:	83 c2 01             	add    $0x1,%edx
+  800cd9:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cde:	eb cb                	jmp    800cab <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ce0:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ce4:	74 0e                	je     800cf4 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ce6:	85 db                	test   %ebx,%ebx
+  800ce8:	75 d8                	jne    800cc2 <strtol+0x40>
+		s++, base = 8;
+  800cea:	83 c2 01             	add    $0x1,%edx
+  800ced:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cf2:	eb ce                	jmp    800cc2 <strtol+0x40>
+		s += 2, base = 16;
+  800cf4:	83 c2 02             	add    $0x2,%edx
+  800cf7:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cfc:	eb c4                	jmp    800cc2 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800cfe:	0f be c0             	movsbl %al,%eax
+  800d01:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d04:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d07:	7d 3a                	jge    800d43 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d09:	83 c2 01             	add    $0x1,%edx
+  800d0c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d10:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d12:	0f b6 02             	movzbl (%edx),%eax
+  800d15:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d18:	89 f3                	mov    %esi,%ebx
+  800d1a:	80 fb 09             	cmp    $0x9,%bl
+  800d1d:	76 df                	jbe    800cfe <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d1f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d22:	89 f3                	mov    %esi,%ebx
+  800d24:	80 fb 19             	cmp    $0x19,%bl
+  800d27:	77 08                	ja     800d31 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d29:	0f be c0             	movsbl %al,%eax
+  800d2c:	83 e8 57             	sub    $0x57,%eax
+  800d2f:	eb d3                	jmp    800d04 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d31:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d34:	89 f3                	mov    %esi,%ebx
+  800d36:	80 fb 19             	cmp    $0x19,%bl
+  800d39:	77 08                	ja     800d43 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d3b:	0f be c0             	movsbl %al,%eax
+  800d3e:	83 e8 37             	sub    $0x37,%eax
+  800d41:	eb c1                	jmp    800d04 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d43:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d47:	74 05                	je     800d4e <strtol+0xcc>
+		*endptr = (char *) s;
+  800d49:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d4c:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d4e:	89 c8                	mov    %ecx,%eax
+  800d50:	f7 d8                	neg    %eax
+  800d52:	85 ff                	test   %edi,%edi
+  800d54:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d57:	89 c8                	mov    %ecx,%eax
+  800d59:	5b                   	pop    %ebx
+  800d5a:	5e                   	pop    %esi
+  800d5b:	5f                   	pop    %edi
+  800d5c:	5d                   	pop    %ebp
+  800d5d:	c3                   	ret
+
+00800d5e <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800d5e:	55                   	push   %ebp
+  800d5f:	89 e5                	mov    %esp,%ebp
+  800d61:	57                   	push   %edi
+  800d62:	56                   	push   %esi
+  800d63:	53                   	push   %ebx
+  800d64:	83 ec 0c             	sub    $0xc,%esp
+  800d67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800d6a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d6d:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800d70:	85 ff                	test   %edi,%edi
+  800d72:	74 16                	je     800d8a <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800d74:	83 ec 04             	sub    $0x4,%esp
+  800d77:	56                   	push   %esi
+  800d78:	6a 00                	push   $0x0
+  800d7a:	53                   	push   %ebx
+  800d7b:	e8 02 ff ff ff       	call   800c82 <strtol>
+  800d80:	89 07                	mov    %eax,(%edi)
+  800d82:	83 c4 10             	add    $0x10,%esp
+  800d85:	eb 03                	jmp    800d8a <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800d87:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800d8a:	0f b6 03             	movzbl (%ebx),%eax
+  800d8d:	3c 20                	cmp    $0x20,%al
+  800d8f:	74 f6                	je     800d87 <strisl+0x29>
+  800d91:	3c 09                	cmp    $0x9,%al
+  800d93:	74 f2                	je     800d87 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d95:	3c 2b                	cmp    $0x2b,%al
+  800d97:	74 23                	je     800dbc <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800d99:	3c 2d                	cmp    $0x2d,%al
+  800d9b:	0f 94 c0             	sete   %al
+  800d9e:	0f b6 c0             	movzbl %al,%eax
+  800da1:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800da3:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800da9:	75 41                	jne    800dec <strisl+0x8e>
+  800dab:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800dae:	74 11                	je     800dc1 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800db0:	85 f6                	test   %esi,%esi
+  800db2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800db7:	0f 44 f0             	cmove  %eax,%esi
+  800dba:	eb 30                	jmp    800dec <strisl+0x8e>
+		s++;
+  800dbc:	83 c3 01             	add    $0x1,%ebx
+  800dbf:	eb e2                	jmp    800da3 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800dc1:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800dc5:	74 0e                	je     800dd5 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800dc7:	85 f6                	test   %esi,%esi
+  800dc9:	75 21                	jne    800dec <strisl+0x8e>
+		s++, base = 8;
+  800dcb:	83 c3 01             	add    $0x1,%ebx
+  800dce:	be 08 00 00 00       	mov    $0x8,%esi
+  800dd3:	eb 17                	jmp    800dec <strisl+0x8e>
+		s += 2, base = 16;
+  800dd5:	83 c3 02             	add    $0x2,%ebx
+  800dd8:	be 10 00 00 00       	mov    $0x10,%esi
+  800ddd:	eb 0d                	jmp    800dec <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ddf:	0f be c0             	movsbl %al,%eax
+  800de2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800de5:	39 f0                	cmp    %esi,%eax
+  800de7:	7d 38                	jge    800e21 <strisl+0xc3>
+			return 0;
+		s++;
+  800de9:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800dec:	0f b6 03             	movzbl (%ebx),%eax
+  800def:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800df2:	80 fa 09             	cmp    $0x9,%dl
+  800df5:	76 e8                	jbe    800ddf <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800df7:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800dfa:	80 fa 19             	cmp    $0x19,%dl
+  800dfd:	77 08                	ja     800e07 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800dff:	0f be c0             	movsbl %al,%eax
+  800e02:	83 e8 57             	sub    $0x57,%eax
+  800e05:	eb de                	jmp    800de5 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e07:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800e0a:	80 fa 19             	cmp    $0x19,%dl
+  800e0d:	77 08                	ja     800e17 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800e0f:	0f be c0             	movsbl %al,%eax
+  800e12:	83 e8 37             	sub    $0x37,%eax
+  800e15:	eb ce                	jmp    800de5 <strisl+0x87>
+		else if (!*s)
+  800e17:	84 c0                	test   %al,%al
+  800e19:	0f 94 c0             	sete   %al
+  800e1c:	0f b6 c0             	movzbl %al,%eax
+  800e1f:	eb 05                	jmp    800e26 <strisl+0xc8>
+			return 0;
+  800e21:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800e26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e29:	5b                   	pop    %ebx
+  800e2a:	5e                   	pop    %esi
+  800e2b:	5f                   	pop    %edi
+  800e2c:	5d                   	pop    %ebp
+  800e2d:	c3                   	ret
+
+00800e2e <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800e2e:	55                   	push   %ebp
+  800e2f:	89 e5                	mov    %esp,%ebp
+  800e31:	83 ec 10             	sub    $0x10,%esp
+  800e34:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800e37:	89 c8                	mov    %ecx,%eax
+  800e39:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800e3e:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800e41:	eb 0b                	jmp    800e4e <touch_mem+0x20>
+		c = *(char *)page;
+  800e43:	0f b6 10             	movzbl (%eax),%edx
+  800e46:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800e49:	05 00 10 00 00       	add    $0x1000,%eax
+  800e4e:	39 c8                	cmp    %ecx,%eax
+  800e50:	72 f1                	jb     800e43 <touch_mem+0x15>
+}
+  800e52:	c9                   	leave
+  800e53:	c3                   	ret
+
+00800e54 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	57                   	push   %edi
+  800e58:	56                   	push   %esi
+  800e59:	53                   	push   %ebx
+	touch_mem(s, len);
+  800e5a:	ff 75 0c             	push   0xc(%ebp)
+  800e5d:	ff 75 08             	push   0x8(%ebp)
+  800e60:	e8 c9 ff ff ff       	call   800e2e <touch_mem>
+	asm volatile("int %1\n"
+  800e65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e70:	89 c3                	mov    %eax,%ebx
+  800e72:	89 c7                	mov    %eax,%edi
+  800e74:	89 c6                	mov    %eax,%esi
+  800e76:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e78:	83 c4 08             	add    $0x8,%esp
+  800e7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7e:	5b                   	pop    %ebx
+  800e7f:	5e                   	pop    %esi
+  800e80:	5f                   	pop    %edi
+  800e81:	5d                   	pop    %ebp
+  800e82:	c3                   	ret
+
+00800e83 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e83:	55                   	push   %ebp
+  800e84:	89 e5                	mov    %esp,%ebp
+  800e86:	57                   	push   %edi
+  800e87:	56                   	push   %esi
+  800e88:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e89:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e8e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e93:	89 d1                	mov    %edx,%ecx
+  800e95:	89 d3                	mov    %edx,%ebx
+  800e97:	89 d7                	mov    %edx,%edi
+  800e99:	89 d6                	mov    %edx,%esi
+  800e9b:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e9d:	5b                   	pop    %ebx
+  800e9e:	5e                   	pop    %esi
+  800e9f:	5f                   	pop    %edi
+  800ea0:	5d                   	pop    %ebp
+  800ea1:	c3                   	ret
+
+00800ea2 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ea2:	55                   	push   %ebp
+  800ea3:	89 e5                	mov    %esp,%ebp
+  800ea5:	57                   	push   %edi
+  800ea6:	56                   	push   %esi
+  800ea7:	53                   	push   %ebx
+  800ea8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eb0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb3:	b8 03 00 00 00       	mov    $0x3,%eax
+  800eb8:	89 cb                	mov    %ecx,%ebx
+  800eba:	89 cf                	mov    %ecx,%edi
+  800ebc:	89 ce                	mov    %ecx,%esi
+  800ebe:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec0:	85 c0                	test   %eax,%eax
+  800ec2:	7f 08                	jg     800ecc <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ec4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec7:	5b                   	pop    %ebx
+  800ec8:	5e                   	pop    %esi
+  800ec9:	5f                   	pop    %edi
+  800eca:	5d                   	pop    %ebp
+  800ecb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ecc:	83 ec 0c             	sub    $0xc,%esp
+  800ecf:	50                   	push   %eax
+  800ed0:	6a 03                	push   $0x3
+  800ed2:	68 0b 5b 80 00       	push   $0x805b0b
+  800ed7:	6a 23                	push   $0x23
+  800ed9:	68 28 5b 80 00       	push   $0x805b28
+  800ede:	e8 89 f4 ff ff       	call   80036c <_panic>
+
+00800ee3 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ee3:	55                   	push   %ebp
+  800ee4:	89 e5                	mov    %esp,%ebp
+  800ee6:	57                   	push   %edi
+  800ee7:	56                   	push   %esi
+  800ee8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ee9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eee:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ef3:	89 d1                	mov    %edx,%ecx
+  800ef5:	89 d3                	mov    %edx,%ebx
+  800ef7:	89 d7                	mov    %edx,%edi
+  800ef9:	89 d6                	mov    %edx,%esi
+  800efb:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800efd:	5b                   	pop    %ebx
+  800efe:	5e                   	pop    %esi
+  800eff:	5f                   	pop    %edi
+  800f00:	5d                   	pop    %ebp
+  800f01:	c3                   	ret
+
+00800f02 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f02:	55                   	push   %ebp
+  800f03:	89 e5                	mov    %esp,%ebp
+  800f05:	57                   	push   %edi
+  800f06:	56                   	push   %esi
+  800f07:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f08:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f0d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f12:	89 d1                	mov    %edx,%ecx
+  800f14:	89 d3                	mov    %edx,%ebx
+  800f16:	89 d7                	mov    %edx,%edi
+  800f18:	89 d6                	mov    %edx,%esi
+  800f1a:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f1c:	5b                   	pop    %ebx
+  800f1d:	5e                   	pop    %esi
+  800f1e:	5f                   	pop    %edi
+  800f1f:	5d                   	pop    %ebp
+  800f20:	c3                   	ret
+
+00800f21 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f21:	55                   	push   %ebp
+  800f22:	89 e5                	mov    %esp,%ebp
+  800f24:	57                   	push   %edi
+  800f25:	56                   	push   %esi
+  800f26:	53                   	push   %ebx
+  800f27:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f2a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f35:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f3d:	89 f7                	mov    %esi,%edi
+  800f3f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f41:	85 c0                	test   %eax,%eax
+  800f43:	7f 08                	jg     800f4d <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f48:	5b                   	pop    %ebx
+  800f49:	5e                   	pop    %esi
+  800f4a:	5f                   	pop    %edi
+  800f4b:	5d                   	pop    %ebp
+  800f4c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f4d:	83 ec 0c             	sub    $0xc,%esp
+  800f50:	50                   	push   %eax
+  800f51:	6a 04                	push   $0x4
+  800f53:	68 0b 5b 80 00       	push   $0x805b0b
+  800f58:	6a 23                	push   $0x23
+  800f5a:	68 28 5b 80 00       	push   $0x805b28
+  800f5f:	e8 08 f4 ff ff       	call   80036c <_panic>
+
+00800f64 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f64:	55                   	push   %ebp
+  800f65:	89 e5                	mov    %esp,%ebp
+  800f67:	57                   	push   %edi
+  800f68:	56                   	push   %esi
+  800f69:	53                   	push   %ebx
+  800f6a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f73:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f78:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f7b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f7e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f81:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f83:	85 c0                	test   %eax,%eax
+  800f85:	7f 08                	jg     800f8f <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f8a:	5b                   	pop    %ebx
+  800f8b:	5e                   	pop    %esi
+  800f8c:	5f                   	pop    %edi
+  800f8d:	5d                   	pop    %ebp
+  800f8e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f8f:	83 ec 0c             	sub    $0xc,%esp
+  800f92:	50                   	push   %eax
+  800f93:	6a 05                	push   $0x5
+  800f95:	68 0b 5b 80 00       	push   $0x805b0b
+  800f9a:	6a 23                	push   $0x23
+  800f9c:	68 28 5b 80 00       	push   $0x805b28
+  800fa1:	e8 c6 f3 ff ff       	call   80036c <_panic>
+
+00800fa6 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800fa6:	55                   	push   %ebp
+  800fa7:	89 e5                	mov    %esp,%ebp
+  800fa9:	57                   	push   %edi
+  800faa:	56                   	push   %esi
+  800fab:	53                   	push   %ebx
+  800fac:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800faf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fba:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fbf:	89 df                	mov    %ebx,%edi
+  800fc1:	89 de                	mov    %ebx,%esi
+  800fc3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc5:	85 c0                	test   %eax,%eax
+  800fc7:	7f 08                	jg     800fd1 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800fc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fcc:	5b                   	pop    %ebx
+  800fcd:	5e                   	pop    %esi
+  800fce:	5f                   	pop    %edi
+  800fcf:	5d                   	pop    %ebp
+  800fd0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd1:	83 ec 0c             	sub    $0xc,%esp
+  800fd4:	50                   	push   %eax
+  800fd5:	6a 06                	push   $0x6
+  800fd7:	68 0b 5b 80 00       	push   $0x805b0b
+  800fdc:	6a 23                	push   $0x23
+  800fde:	68 28 5b 80 00       	push   $0x805b28
+  800fe3:	e8 84 f3 ff ff       	call   80036c <_panic>
+
+00800fe8 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800fe8:	55                   	push   %ebp
+  800fe9:	89 e5                	mov    %esp,%ebp
+  800feb:	57                   	push   %edi
+  800fec:	56                   	push   %esi
+  800fed:	53                   	push   %ebx
+  800fee:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ff1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffc:	b8 18 00 00 00       	mov    $0x18,%eax
+  801001:	89 df                	mov    %ebx,%edi
+  801003:	89 de                	mov    %ebx,%esi
+  801005:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801007:	85 c0                	test   %eax,%eax
+  801009:	7f 08                	jg     801013 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80100b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100e:	5b                   	pop    %ebx
+  80100f:	5e                   	pop    %esi
+  801010:	5f                   	pop    %edi
+  801011:	5d                   	pop    %ebp
+  801012:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801013:	83 ec 0c             	sub    $0xc,%esp
+  801016:	50                   	push   %eax
+  801017:	6a 18                	push   $0x18
+  801019:	68 0b 5b 80 00       	push   $0x805b0b
+  80101e:	6a 23                	push   $0x23
+  801020:	68 28 5b 80 00       	push   $0x805b28
+  801025:	e8 42 f3 ff ff       	call   80036c <_panic>
+
+0080102a <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  80102a:	55                   	push   %ebp
+  80102b:	89 e5                	mov    %esp,%ebp
+  80102d:	57                   	push   %edi
+  80102e:	56                   	push   %esi
+  80102f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801030:	be 00 00 00 00       	mov    $0x0,%esi
+  801035:	8b 55 08             	mov    0x8(%ebp),%edx
+  801038:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103b:	b8 19 00 00 00       	mov    $0x19,%eax
+  801040:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801043:	89 f7                	mov    %esi,%edi
+  801045:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  801047:	5b                   	pop    %ebx
+  801048:	5e                   	pop    %esi
+  801049:	5f                   	pop    %edi
+  80104a:	5d                   	pop    %ebp
+  80104b:	c3                   	ret
+
+0080104c <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  80104c:	55                   	push   %ebp
+  80104d:	89 e5                	mov    %esp,%ebp
+  80104f:	57                   	push   %edi
+  801050:	56                   	push   %esi
+  801051:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801052:	8b 55 08             	mov    0x8(%ebp),%edx
+  801055:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801058:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80105d:	be 00 00 00 00       	mov    $0x0,%esi
+  801062:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801065:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801068:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  80106a:	5b                   	pop    %ebx
+  80106b:	5e                   	pop    %esi
+  80106c:	5f                   	pop    %edi
+  80106d:	5d                   	pop    %ebp
+  80106e:	c3                   	ret
+
+0080106f <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  80106f:	55                   	push   %ebp
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	57                   	push   %edi
+  801073:	56                   	push   %esi
+  801074:	53                   	push   %ebx
+  801075:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  801078:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  80107b:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801081:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  801084:	8b 55 08             	mov    0x8(%ebp),%edx
+  801087:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80108f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801092:	8b 75 18             	mov    0x18(%ebp),%esi
+  801095:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801097:	85 c0                	test   %eax,%eax
+  801099:	7f 08                	jg     8010a3 <sys_page_map_range+0x34>
+}
+  80109b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109e:	5b                   	pop    %ebx
+  80109f:	5e                   	pop    %esi
+  8010a0:	5f                   	pop    %edi
+  8010a1:	5d                   	pop    %ebp
+  8010a2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a3:	83 ec 0c             	sub    $0xc,%esp
+  8010a6:	50                   	push   %eax
+  8010a7:	6a 10                	push   $0x10
+  8010a9:	68 0b 5b 80 00       	push   $0x805b0b
+  8010ae:	6a 23                	push   $0x23
+  8010b0:	68 28 5b 80 00       	push   $0x805b28
+  8010b5:	e8 b2 f2 ff ff       	call   80036c <_panic>
+
+008010ba <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  8010ba:	55                   	push   %ebp
+  8010bb:	89 e5                	mov    %esp,%ebp
+  8010bd:	57                   	push   %edi
+  8010be:	56                   	push   %esi
+  8010bf:	53                   	push   %ebx
+  8010c0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ce:	b8 11 00 00 00       	mov    $0x11,%eax
+  8010d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d6:	89 f7                	mov    %esi,%edi
+  8010d8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010da:	85 c0                	test   %eax,%eax
+  8010dc:	7f 08                	jg     8010e6 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8010de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e1:	5b                   	pop    %ebx
+  8010e2:	5e                   	pop    %esi
+  8010e3:	5f                   	pop    %edi
+  8010e4:	5d                   	pop    %ebp
+  8010e5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e6:	83 ec 0c             	sub    $0xc,%esp
+  8010e9:	50                   	push   %eax
+  8010ea:	6a 11                	push   $0x11
+  8010ec:	68 0b 5b 80 00       	push   $0x805b0b
+  8010f1:	6a 23                	push   $0x23
+  8010f3:	68 28 5b 80 00       	push   $0x805b28
+  8010f8:	e8 6f f2 ff ff       	call   80036c <_panic>
+
+008010fd <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  8010fd:	55                   	push   %ebp
+  8010fe:	89 e5                	mov    %esp,%ebp
+  801100:	57                   	push   %edi
+  801101:	56                   	push   %esi
+  801102:	53                   	push   %ebx
+  801103:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801106:	be 00 00 00 00       	mov    $0x0,%esi
+  80110b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801111:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801116:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801119:	89 f7                	mov    %esi,%edi
+  80111b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80111d:	85 c0                	test   %eax,%eax
+  80111f:	7f 08                	jg     801129 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  801121:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801124:	5b                   	pop    %ebx
+  801125:	5e                   	pop    %esi
+  801126:	5f                   	pop    %edi
+  801127:	5d                   	pop    %ebp
+  801128:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801129:	83 ec 0c             	sub    $0xc,%esp
+  80112c:	50                   	push   %eax
+  80112d:	6a 1b                	push   $0x1b
+  80112f:	68 0b 5b 80 00       	push   $0x805b0b
+  801134:	6a 23                	push   $0x23
+  801136:	68 28 5b 80 00       	push   $0x805b28
+  80113b:	e8 2c f2 ff ff       	call   80036c <_panic>
+
+00801140 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  801140:	55                   	push   %ebp
+  801141:	89 e5                	mov    %esp,%ebp
+  801143:	57                   	push   %edi
+  801144:	56                   	push   %esi
+  801145:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801146:	ba 00 00 00 00       	mov    $0x0,%edx
+  80114b:	b8 12 00 00 00       	mov    $0x12,%eax
+  801150:	89 d1                	mov    %edx,%ecx
+  801152:	89 d3                	mov    %edx,%ebx
+  801154:	89 d7                	mov    %edx,%edi
+  801156:	89 d6                	mov    %edx,%esi
+  801158:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80115a:	5b                   	pop    %ebx
+  80115b:	5e                   	pop    %esi
+  80115c:	5f                   	pop    %edi
+  80115d:	5d                   	pop    %ebp
+  80115e:	c3                   	ret
+
+0080115f <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80115f:	55                   	push   %ebp
+  801160:	89 e5                	mov    %esp,%ebp
+  801162:	57                   	push   %edi
+  801163:	56                   	push   %esi
+  801164:	53                   	push   %ebx
+  801165:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801168:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801170:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801173:	b8 08 00 00 00       	mov    $0x8,%eax
+  801178:	89 df                	mov    %ebx,%edi
+  80117a:	89 de                	mov    %ebx,%esi
+  80117c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80117e:	85 c0                	test   %eax,%eax
+  801180:	7f 08                	jg     80118a <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801182:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801185:	5b                   	pop    %ebx
+  801186:	5e                   	pop    %esi
+  801187:	5f                   	pop    %edi
+  801188:	5d                   	pop    %ebp
+  801189:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80118a:	83 ec 0c             	sub    $0xc,%esp
+  80118d:	50                   	push   %eax
+  80118e:	6a 08                	push   $0x8
+  801190:	68 0b 5b 80 00       	push   $0x805b0b
+  801195:	6a 23                	push   $0x23
+  801197:	68 28 5b 80 00       	push   $0x805b28
+  80119c:	e8 cb f1 ff ff       	call   80036c <_panic>
+
+008011a1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8011a1:	55                   	push   %ebp
+  8011a2:	89 e5                	mov    %esp,%ebp
+  8011a4:	57                   	push   %edi
+  8011a5:	56                   	push   %esi
+  8011a6:	53                   	push   %ebx
+  8011a7:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  8011aa:	6a 44                	push   $0x44
+  8011ac:	ff 75 0c             	push   0xc(%ebp)
+  8011af:	e8 7a fc ff ff       	call   800e2e <touch_mem>
+	asm volatile("int %1\n"
+  8011b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bc:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c4:	89 df                	mov    %ebx,%edi
+  8011c6:	89 de                	mov    %ebx,%esi
+  8011c8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011ca:	83 c4 08             	add    $0x8,%esp
+  8011cd:	85 c0                	test   %eax,%eax
+  8011cf:	7f 08                	jg     8011d9 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8011d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d4:	5b                   	pop    %ebx
+  8011d5:	5e                   	pop    %esi
+  8011d6:	5f                   	pop    %edi
+  8011d7:	5d                   	pop    %ebp
+  8011d8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011d9:	83 ec 0c             	sub    $0xc,%esp
+  8011dc:	50                   	push   %eax
+  8011dd:	6a 09                	push   $0x9
+  8011df:	68 0b 5b 80 00       	push   $0x805b0b
+  8011e4:	6a 23                	push   $0x23
+  8011e6:	68 28 5b 80 00       	push   $0x805b28
+  8011eb:	e8 7c f1 ff ff       	call   80036c <_panic>
+
+008011f0 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  8011f0:	55                   	push   %ebp
+  8011f1:	89 e5                	mov    %esp,%ebp
+  8011f3:	57                   	push   %edi
+  8011f4:	56                   	push   %esi
+  8011f5:	53                   	push   %ebx
+  8011f6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801201:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801204:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801209:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80120c:	89 f7                	mov    %esi,%edi
+  80120e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801210:	85 c0                	test   %eax,%eax
+  801212:	7f 08                	jg     80121c <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  801214:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801217:	5b                   	pop    %ebx
+  801218:	5e                   	pop    %esi
+  801219:	5f                   	pop    %edi
+  80121a:	5d                   	pop    %ebp
+  80121b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80121c:	83 ec 0c             	sub    $0xc,%esp
+  80121f:	50                   	push   %eax
+  801220:	6a 1a                	push   $0x1a
+  801222:	68 0b 5b 80 00       	push   $0x805b0b
+  801227:	6a 23                	push   $0x23
+  801229:	68 28 5b 80 00       	push   $0x805b28
+  80122e:	e8 39 f1 ff ff       	call   80036c <_panic>
+
+00801233 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  801233:	55                   	push   %ebp
+  801234:	89 e5                	mov    %esp,%ebp
+  801236:	57                   	push   %edi
+  801237:	56                   	push   %esi
+  801238:	53                   	push   %ebx
+  801239:	83 ec 0c             	sub    $0xc,%esp
+  80123c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  80123f:	89 d8                	mov    %ebx,%eax
+  801241:	c1 e0 05             	shl    $0x5,%eax
+  801244:	50                   	push   %eax
+  801245:	ff 75 0c             	push   0xc(%ebp)
+  801248:	e8 e1 fb ff ff       	call   800e2e <touch_mem>
+	asm volatile("int %1\n"
+  80124d:	be 00 00 00 00       	mov    $0x0,%esi
+  801252:	8b 55 08             	mov    0x8(%ebp),%edx
+  801255:	b8 13 00 00 00       	mov    $0x13,%eax
+  80125a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125d:	89 f7                	mov    %esi,%edi
+  80125f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801261:	83 c4 08             	add    $0x8,%esp
+  801264:	85 c0                	test   %eax,%eax
+  801266:	7f 08                	jg     801270 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  801268:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80126b:	5b                   	pop    %ebx
+  80126c:	5e                   	pop    %esi
+  80126d:	5f                   	pop    %edi
+  80126e:	5d                   	pop    %ebp
+  80126f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801270:	83 ec 0c             	sub    $0xc,%esp
+  801273:	50                   	push   %eax
+  801274:	6a 13                	push   $0x13
+  801276:	68 0b 5b 80 00       	push   $0x805b0b
+  80127b:	6a 23                	push   $0x23
+  80127d:	68 28 5b 80 00       	push   $0x805b28
+  801282:	e8 e5 f0 ff ff       	call   80036c <_panic>
+
+00801287 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801287:	55                   	push   %ebp
+  801288:	89 e5                	mov    %esp,%ebp
+  80128a:	57                   	push   %edi
+  80128b:	56                   	push   %esi
+  80128c:	53                   	push   %ebx
+  80128d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801290:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801295:	8b 55 08             	mov    0x8(%ebp),%edx
+  801298:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012a0:	89 df                	mov    %ebx,%edi
+  8012a2:	89 de                	mov    %ebx,%esi
+  8012a4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012a6:	85 c0                	test   %eax,%eax
+  8012a8:	7f 08                	jg     8012b2 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8012aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ad:	5b                   	pop    %ebx
+  8012ae:	5e                   	pop    %esi
+  8012af:	5f                   	pop    %edi
+  8012b0:	5d                   	pop    %ebp
+  8012b1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012b2:	83 ec 0c             	sub    $0xc,%esp
+  8012b5:	50                   	push   %eax
+  8012b6:	6a 0a                	push   $0xa
+  8012b8:	68 0b 5b 80 00       	push   $0x805b0b
+  8012bd:	6a 23                	push   $0x23
+  8012bf:	68 28 5b 80 00       	push   $0x805b28
+  8012c4:	e8 a3 f0 ff ff       	call   80036c <_panic>
+
+008012c9 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8012c9:	55                   	push   %ebp
+  8012ca:	89 e5                	mov    %esp,%ebp
+  8012cc:	57                   	push   %edi
+  8012cd:	56                   	push   %esi
+  8012ce:	53                   	push   %ebx
+  8012cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  8012d2:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8012d8:	76 1d                	jbe    8012f7 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  8012da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012e5:	be 01 00 00 00       	mov    $0x1,%esi
+  8012ea:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012ed:	cd 30                	int    $0x30
+}
+  8012ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f2:	5b                   	pop    %ebx
+  8012f3:	5e                   	pop    %esi
+  8012f4:	5f                   	pop    %edi
+  8012f5:	5d                   	pop    %ebp
+  8012f6:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8012f7:	68 00 10 00 00       	push   $0x1000
+  8012fc:	53                   	push   %ebx
+  8012fd:	e8 2c fb ff ff       	call   800e2e <touch_mem>
+  801302:	83 c4 08             	add    $0x8,%esp
+  801305:	eb d3                	jmp    8012da <sys_ipc_send+0x11>
+
+00801307 <sys_ipc_send_pages>:
+{
+  801307:	55                   	push   %ebp
+  801308:	89 e5                	mov    %esp,%ebp
+  80130a:	57                   	push   %edi
+  80130b:	56                   	push   %esi
+  80130c:	53                   	push   %ebx
+  80130d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801310:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801313:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801319:	76 18                	jbe    801333 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80131b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801321:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801326:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801329:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  80132b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132e:	5b                   	pop    %ebx
+  80132f:	5e                   	pop    %esi
+  801330:	5f                   	pop    %edi
+  801331:	5d                   	pop    %ebp
+  801332:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801333:	89 f0                	mov    %esi,%eax
+  801335:	c1 e0 0c             	shl    $0xc,%eax
+  801338:	50                   	push   %eax
+  801339:	53                   	push   %ebx
+  80133a:	e8 ef fa ff ff       	call   800e2e <touch_mem>
+  80133f:	83 c4 08             	add    $0x8,%esp
+  801342:	eb d7                	jmp    80131b <sys_ipc_send_pages+0x14>
+
+00801344 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801344:	55                   	push   %ebp
+  801345:	89 e5                	mov    %esp,%ebp
+  801347:	57                   	push   %edi
+  801348:	56                   	push   %esi
+  801349:	53                   	push   %ebx
+  80134a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80134d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801352:	8b 55 08             	mov    0x8(%ebp),%edx
+  801355:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801358:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80135d:	89 df                	mov    %ebx,%edi
+  80135f:	89 de                	mov    %ebx,%esi
+  801361:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801363:	85 c0                	test   %eax,%eax
+  801365:	7f 08                	jg     80136f <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801367:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80136a:	5b                   	pop    %ebx
+  80136b:	5e                   	pop    %esi
+  80136c:	5f                   	pop    %edi
+  80136d:	5d                   	pop    %ebp
+  80136e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80136f:	83 ec 0c             	sub    $0xc,%esp
+  801372:	50                   	push   %eax
+  801373:	6a 0d                	push   $0xd
+  801375:	68 0b 5b 80 00       	push   $0x805b0b
+  80137a:	6a 23                	push   $0x23
+  80137c:	68 28 5b 80 00       	push   $0x805b28
+  801381:	e8 e6 ef ff ff       	call   80036c <_panic>
+
+00801386 <sys_ipc_recv>:
+{
+  801386:	55                   	push   %ebp
+  801387:	89 e5                	mov    %esp,%ebp
+  801389:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80138c:	6a 01                	push   $0x1
+  80138e:	ff 75 08             	push   0x8(%ebp)
+  801391:	e8 ae ff ff ff       	call   801344 <sys_ipc_recv_pages>
+}
+  801396:	c9                   	leave
+  801397:	c3                   	ret
+
+00801398 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801398:	55                   	push   %ebp
+  801399:	89 e5                	mov    %esp,%ebp
+  80139b:	57                   	push   %edi
+  80139c:	56                   	push   %esi
+  80139d:	53                   	push   %ebx
+  80139e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013a4:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  8013a7:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8013ad:	77 04                	ja     8013b3 <sys_ipc_call+0x1b>
+  8013af:	85 f6                	test   %esi,%esi
+  8013b1:	75 15                	jne    8013c8 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8013b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b9:	b8 14 00 00 00       	mov    $0x14,%eax
+  8013be:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8013c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c3:	5b                   	pop    %ebx
+  8013c4:	5e                   	pop    %esi
+  8013c5:	5f                   	pop    %edi
+  8013c6:	5d                   	pop    %ebp
+  8013c7:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8013c8:	89 f8                	mov    %edi,%eax
+  8013ca:	c1 e0 0c             	shl    $0xc,%eax
+  8013cd:	50                   	push   %eax
+  8013ce:	53                   	push   %ebx
+  8013cf:	e8 5a fa ff ff       	call   800e2e <touch_mem>
+  8013d4:	83 c4 08             	add    $0x8,%esp
+  8013d7:	eb da                	jmp    8013b3 <sys_ipc_call+0x1b>
+
+008013d9 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8013d9:	55                   	push   %ebp
+  8013da:	89 e5                	mov    %esp,%ebp
+  8013dc:	57                   	push   %edi
+  8013dd:	56                   	push   %esi
+  8013de:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e5:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013ea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ed:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013f0:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013f3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8013f5:	5b                   	pop    %ebx
+  8013f6:	5e                   	pop    %esi
+  8013f7:	5f                   	pop    %edi
+  8013f8:	5d                   	pop    %ebp
+  8013f9:	c3                   	ret
+
+008013fa <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8013fa:	55                   	push   %ebp
+  8013fb:	89 e5                	mov    %esp,%ebp
+  8013fd:	57                   	push   %edi
+  8013fe:	56                   	push   %esi
+  8013ff:	53                   	push   %ebx
+  801400:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801403:	6a 04                	push   $0x4
+  801405:	ff 75 08             	push   0x8(%ebp)
+  801408:	e8 21 fa ff ff       	call   800e2e <touch_mem>
+	asm volatile("int %1\n"
+  80140d:	be 00 00 00 00       	mov    $0x0,%esi
+  801412:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801415:	b8 16 00 00 00       	mov    $0x16,%eax
+  80141a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801420:	89 f7                	mov    %esi,%edi
+  801422:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801424:	83 c4 08             	add    $0x8,%esp
+  801427:	85 c0                	test   %eax,%eax
+  801429:	7f 08                	jg     801433 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  80142b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142e:	5b                   	pop    %ebx
+  80142f:	5e                   	pop    %esi
+  801430:	5f                   	pop    %edi
+  801431:	5d                   	pop    %ebp
+  801432:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801433:	83 ec 0c             	sub    $0xc,%esp
+  801436:	50                   	push   %eax
+  801437:	6a 16                	push   $0x16
+  801439:	68 0b 5b 80 00       	push   $0x805b0b
+  80143e:	6a 23                	push   $0x23
+  801440:	68 28 5b 80 00       	push   $0x805b28
+  801445:	e8 22 ef ff ff       	call   80036c <_panic>
+
+0080144a <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80144a:	55                   	push   %ebp
+  80144b:	89 e5                	mov    %esp,%ebp
+  80144d:	57                   	push   %edi
+  80144e:	56                   	push   %esi
+  80144f:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801450:	6a 04                	push   $0x4
+  801452:	ff 75 08             	push   0x8(%ebp)
+  801455:	e8 d4 f9 ff ff       	call   800e2e <touch_mem>
+	asm volatile("int %1\n"
+  80145a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80145f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801462:	b8 17 00 00 00       	mov    $0x17,%eax
+  801467:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146a:	89 df                	mov    %ebx,%edi
+  80146c:	89 de                	mov    %ebx,%esi
+  80146e:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801470:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801473:	5b                   	pop    %ebx
+  801474:	5e                   	pop    %esi
+  801475:	5f                   	pop    %edi
+  801476:	5d                   	pop    %ebp
+  801477:	c3                   	ret
+
+00801478 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  801478:	55                   	push   %ebp
+  801479:	89 e5                	mov    %esp,%ebp
+  80147b:	57                   	push   %edi
+  80147c:	56                   	push   %esi
+  80147d:	53                   	push   %ebx
+  80147e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801481:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801486:	8b 55 08             	mov    0x8(%ebp),%edx
+  801489:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80148e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801493:	89 df                	mov    %ebx,%edi
+  801495:	89 de                	mov    %ebx,%esi
+  801497:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801499:	85 c0                	test   %eax,%eax
+  80149b:	7f 08                	jg     8014a5 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80149d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014a0:	5b                   	pop    %ebx
+  8014a1:	5e                   	pop    %esi
+  8014a2:	5f                   	pop    %edi
+  8014a3:	5d                   	pop    %ebp
+  8014a4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014a5:	83 ec 0c             	sub    $0xc,%esp
+  8014a8:	50                   	push   %eax
+  8014a9:	6a 0e                	push   $0xe
+  8014ab:	68 0b 5b 80 00       	push   $0x805b0b
+  8014b0:	6a 23                	push   $0x23
+  8014b2:	68 28 5b 80 00       	push   $0x805b28
+  8014b7:	e8 b0 ee ff ff       	call   80036c <_panic>
+
+008014bc <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  8014bc:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014c3:	f6 c6 06             	test   $0x6,%dh
+  8014c6:	75 37                	jne    8014ff <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  8014c8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014cf:	f6 c2 02             	test   $0x2,%dl
+  8014d2:	75 19                	jne    8014ed <dupperm+0x31>
+  8014d4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014db:	f6 c6 08             	test   $0x8,%dh
+  8014de:	75 0d                	jne    8014ed <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  8014e0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014e7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014ec:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  8014ed:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014f4:	25 00 06 00 00       	and    $0x600,%eax
+  8014f9:	0d 05 08 00 00       	or     $0x805,%eax
+  8014fe:	c3                   	ret
+		return 0;
+  8014ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801504:	c3                   	ret
+
+00801505 <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  801505:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  801507:	c1 e0 0c             	shl    $0xc,%eax
+  80150a:	c1 e8 16             	shr    $0x16,%eax
+  80150d:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801514:	f6 c1 01             	test   $0x1,%cl
+  801517:	74 2c                	je     801545 <dupable+0x40>
+  801519:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801520:	b8 00 00 00 00       	mov    $0x0,%eax
+  801525:	f6 c1 04             	test   $0x4,%cl
+  801528:	74 20                	je     80154a <dupable+0x45>
+  80152a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801531:	f6 c1 01             	test   $0x1,%cl
+  801534:	74 14                	je     80154a <dupable+0x45>
+  801536:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  80153d:	c1 e8 02             	shr    $0x2,%eax
+  801540:	83 e0 01             	and    $0x1,%eax
+  801543:	eb 05                	jmp    80154a <dupable+0x45>
+  801545:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154a:	83 e0 01             	and    $0x1,%eax
+}
+  80154d:	c3                   	ret
+
+0080154e <pgfault>:
+{
+  80154e:	55                   	push   %ebp
+  80154f:	89 e5                	mov    %esp,%ebp
+  801551:	56                   	push   %esi
+  801552:	53                   	push   %ebx
+  801553:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801556:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  801558:	89 ca                	mov    %ecx,%edx
+  80155a:	c1 ea 0c             	shr    $0xc,%edx
+  80155d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801564:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801568:	0f 84 8e 00 00 00    	je     8015fc <pgfault+0xae>
+		return 0;
+  80156e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801573:	f6 c6 08             	test   $0x8,%dh
+  801576:	0f 84 85 00 00 00    	je     801601 <pgfault+0xb3>
+	perm |= PTE_W;
+  80157c:	81 e2 07 06 00 00    	and    $0x607,%edx
+  801582:	89 d3                	mov    %edx,%ebx
+  801584:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801587:	89 ce                	mov    %ecx,%esi
+  801589:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  80158f:	6a 01                	push   $0x1
+  801591:	53                   	push   %ebx
+  801592:	68 00 f0 7f 00       	push   $0x7ff000
+  801597:	6a 00                	push   $0x0
+  801599:	e8 a5 27 00 00       	call   803d43 <page_alloc>
+  80159e:	83 c4 10             	add    $0x10,%esp
+  8015a1:	85 c0                	test   %eax,%eax
+  8015a3:	78 33                	js     8015d8 <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  8015a5:	83 ec 04             	sub    $0x4,%esp
+  8015a8:	68 00 10 00 00       	push   $0x1000
+  8015ad:	56                   	push   %esi
+  8015ae:	68 00 f0 7f 00       	push   $0x7ff000
+  8015b3:	e8 fc f5 ff ff       	call   800bb4 <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  8015b8:	89 1c 24             	mov    %ebx,(%esp)
+  8015bb:	56                   	push   %esi
+  8015bc:	6a 00                	push   $0x0
+  8015be:	68 00 f0 7f 00       	push   $0x7ff000
+  8015c3:	6a 00                	push   $0x0
+  8015c5:	e8 da 2d 00 00       	call   8043a4 <page_map>
+  8015ca:	83 c4 20             	add    $0x20,%esp
+  8015cd:	85 c0                	test   %eax,%eax
+  8015cf:	78 19                	js     8015ea <pgfault+0x9c>
+	return 1;
+  8015d1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015d6:	eb 29                	jmp    801601 <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  8015d8:	50                   	push   %eax
+  8015d9:	68 38 5b 80 00       	push   $0x805b38
+  8015de:	6a 2e                	push   $0x2e
+  8015e0:	68 8b 5b 80 00       	push   $0x805b8b
+  8015e5:	e8 82 ed ff ff       	call   80036c <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  8015ea:	50                   	push   %eax
+  8015eb:	68 64 5b 80 00       	push   $0x805b64
+  8015f0:	6a 32                	push   $0x32
+  8015f2:	68 8b 5b 80 00       	push   $0x805b8b
+  8015f7:	e8 70 ed ff ff       	call   80036c <_panic>
+		return 0;
+  8015fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801601:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801604:	5b                   	pop    %ebx
+  801605:	5e                   	pop    %esi
+  801606:	5d                   	pop    %ebp
+  801607:	c3                   	ret
+
+00801608 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  801608:	55                   	push   %ebp
+  801609:	89 e5                	mov    %esp,%ebp
+  80160b:	57                   	push   %edi
+  80160c:	56                   	push   %esi
+  80160d:	53                   	push   %ebx
+  80160e:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  801611:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  801618:	74 5d                	je     801677 <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  80161a:	83 ec 0c             	sub    $0xc,%esp
+  80161d:	68 4e 15 80 00       	push   $0x80154e
+  801622:	e8 de 39 00 00       	call   805005 <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  801627:	e8 14 fb ff ff       	call   801140 <sys_fork>
+  80162c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80162f:	83 c4 10             	add    $0x10,%esp
+  801632:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  801635:	74 47                	je     80167e <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  801637:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80163b:	0f 84 c5 03 00 00    	je     801a06 <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  801641:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801645:	78 25                	js     80166c <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  801647:	e8 6f 20 00 00       	call   8036bb <page_share_paged_out>
+  80164c:	85 c0                	test   %eax,%eax
+  80164e:	0f 88 d8 03 00 00    	js     801a2c <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801654:	83 ec 08             	sub    $0x8,%esp
+  801657:	6a 02                	push   $0x2
+  801659:	ff 75 e4             	push   -0x1c(%ebp)
+  80165c:	e8 fe fa ff ff       	call   80115f <sys_env_set_status>
+  801661:	83 c4 10             	add    $0x10,%esp
+  801664:	85 c0                	test   %eax,%eax
+  801666:	0f 88 d5 03 00 00    	js     801a41 <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  80166c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80166f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801672:	5b                   	pop    %ebx
+  801673:	5e                   	pop    %esi
+  801674:	5f                   	pop    %edi
+  801675:	5d                   	pop    %ebp
+  801676:	c3                   	ret
+		init_map_dir();
+  801677:	e8 47 23 00 00       	call   8039c3 <init_map_dir>
+  80167c:	eb 9c                	jmp    80161a <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80167e:	b8 07 00 00 00       	mov    $0x7,%eax
+  801683:	cd 30                	int    $0x30
+  801685:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  801688:	85 c0                	test   %eax,%eax
+  80168a:	78 10                	js     80169c <fork+0x94>
+	if (envid == 0)
+  80168c:	0f 84 74 03 00 00    	je     801a06 <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801692:	be 00 00 00 00       	mov    $0x0,%esi
+  801697:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80169a:	eb 30                	jmp    8016cc <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  80169c:	50                   	push   %eax
+  80169d:	68 96 5b 80 00       	push   $0x805b96
+  8016a2:	68 cd 00 00 00       	push   $0xcd
+  8016a7:	68 8b 5b 80 00       	push   $0x805b8b
+  8016ac:	e8 bb ec ff ff       	call   80036c <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  8016b1:	89 f2                	mov    %esi,%edx
+  8016b3:	c1 fa 1f             	sar    $0x1f,%edx
+  8016b6:	c1 ea 16             	shr    $0x16,%edx
+  8016b9:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8016bc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016c1:	29 d0                	sub    %edx,%eax
+  8016c3:	ba 00 04 00 00       	mov    $0x400,%edx
+  8016c8:	29 c2                	sub    %eax,%edx
+  8016ca:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  8016cc:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8016cf:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  8016d5:	0f 87 ff 02 00 00    	ja     8019da <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  8016db:	89 f3                	mov    %esi,%ebx
+  8016dd:	c1 e3 0c             	shl    $0xc,%ebx
+  8016e0:	89 d8                	mov    %ebx,%eax
+  8016e2:	c1 e8 16             	shr    $0x16,%eax
+  8016e5:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8016ec:	f6 c2 01             	test   $0x1,%dl
+  8016ef:	74 c0                	je     8016b1 <fork+0xa9>
+  8016f1:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8016f8:	f6 c2 04             	test   $0x4,%dl
+  8016fb:	74 b4                	je     8016b1 <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  8016fd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801704:	a8 80                	test   $0x80,%al
+  801706:	75 24                	jne    80172c <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  801708:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  80170f:	25 81 00 00 00       	and    $0x81,%eax
+  801714:	3d 80 00 00 00       	cmp    $0x80,%eax
+  801719:	74 21                	je     80173c <fork+0x134>
+		if (!dupable(pn)) {
+  80171b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80171e:	e8 e2 fd ff ff       	call   801505 <dupable>
+  801723:	84 c0                	test   %al,%al
+  801725:	75 1a                	jne    801741 <fork+0x139>
+			++pn;
+  801727:	83 c6 01             	add    $0x1,%esi
+			continue;
+  80172a:	eb a0                	jmp    8016cc <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  80172c:	83 ec 08             	sub    $0x8,%esp
+  80172f:	53                   	push   %ebx
+  801730:	6a 00                	push   $0x0
+  801732:	e8 b1 f8 ff ff       	call   800fe8 <sys_page_split>
+  801737:	83 c4 10             	add    $0x10,%esp
+  80173a:	eb cc                	jmp    801708 <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  80173c:	0f b6 03             	movzbl (%ebx),%eax
+  80173f:	eb da                	jmp    80171b <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  801741:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801744:	89 f8                	mov    %edi,%eax
+  801746:	e8 71 fd ff ff       	call   8014bc <dupperm>
+  80174b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80174e:	85 c0                	test   %eax,%eax
+  801750:	74 16                	je     801768 <fork+0x160>
+  801752:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  801757:	29 f8                	sub    %edi,%eax
+  801759:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  80175c:	bf 01 00 00 00       	mov    $0x1,%edi
+  801761:	89 c6                	mov    %eax,%esi
+  801763:	e9 c4 01 00 00       	jmp    80192c <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  801768:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80176b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801772:	f6 c4 04             	test   $0x4,%ah
+  801775:	0f 85 89 00 00 00    	jne    801804 <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  80177b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80177e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801785:	f6 c4 02             	test   $0x2,%ah
+  801788:	0f 85 b1 00 00 00    	jne    80183f <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  80178e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801791:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801798:	a8 02                	test   $0x2,%al
+  80179a:	75 10                	jne    8017ac <fork+0x1a4>
+  80179c:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8017a3:	f6 c4 08             	test   $0x8,%ah
+  8017a6:	0f 84 3e 01 00 00    	je     8018ea <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  8017ac:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8017af:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8017b6:	25 00 06 00 00       	and    $0x600,%eax
+  8017bb:	0d 05 08 00 00       	or     $0x805,%eax
+  8017c0:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  8017c2:	c1 e1 0c             	shl    $0xc,%ecx
+  8017c5:	89 cb                	mov    %ecx,%ebx
+  8017c7:	83 ec 0c             	sub    $0xc,%esp
+  8017ca:	50                   	push   %eax
+  8017cb:	51                   	push   %ecx
+  8017cc:	ff 75 e4             	push   -0x1c(%ebp)
+  8017cf:	51                   	push   %ecx
+  8017d0:	6a 00                	push   $0x0
+  8017d2:	e8 cd 2b 00 00       	call   8043a4 <page_map>
+  8017d7:	83 c4 20             	add    $0x20,%esp
+  8017da:	85 c0                	test   %eax,%eax
+  8017dc:	0f 88 e4 00 00 00    	js     8018c6 <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  8017e2:	83 ec 0c             	sub    $0xc,%esp
+  8017e5:	57                   	push   %edi
+  8017e6:	53                   	push   %ebx
+  8017e7:	6a 00                	push   $0x0
+  8017e9:	53                   	push   %ebx
+  8017ea:	6a 00                	push   $0x0
+  8017ec:	e8 b3 2b 00 00       	call   8043a4 <page_map>
+  8017f1:	83 c4 20             	add    $0x20,%esp
+  8017f4:	85 c0                	test   %eax,%eax
+  8017f6:	0f 88 dc 00 00 00    	js     8018d8 <fork+0x2d0>
+			++pn;
+  8017fc:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8017ff:	e9 c8 fe ff ff       	jmp    8016cc <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  801804:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801807:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80180e:	c1 e1 0c             	shl    $0xc,%ecx
+  801811:	83 ec 0c             	sub    $0xc,%esp
+  801814:	25 07 0e 00 00       	and    $0xe07,%eax
+  801819:	50                   	push   %eax
+  80181a:	51                   	push   %ecx
+  80181b:	ff 75 e4             	push   -0x1c(%ebp)
+  80181e:	51                   	push   %ecx
+  80181f:	6a 00                	push   $0x0
+  801821:	e8 7e 2b 00 00       	call   8043a4 <page_map>
+  801826:	83 c4 20             	add    $0x20,%esp
+  801829:	85 c0                	test   %eax,%eax
+  80182b:	79 cf                	jns    8017fc <fork+0x1f4>
+			panic("page_map %d", r);
+  80182d:	50                   	push   %eax
+  80182e:	68 a6 5b 80 00       	push   $0x805ba6
+  801833:	6a 4d                	push   $0x4d
+  801835:	68 8b 5b 80 00       	push   $0x805b8b
+  80183a:	e8 2d eb ff ff       	call   80036c <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  80183f:	83 ec 0c             	sub    $0xc,%esp
+  801842:	68 00 10 00 00       	push   $0x1000
+  801847:	e8 4a 31 00 00       	call   804996 <malloc>
+  80184c:	89 c7                	mov    %eax,%edi
+  80184e:	83 c4 10             	add    $0x10,%esp
+  801851:	85 c0                	test   %eax,%eax
+  801853:	74 4b                	je     8018a0 <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  801855:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801858:	c1 e3 0c             	shl    $0xc,%ebx
+  80185b:	83 ec 04             	sub    $0x4,%esp
+  80185e:	68 00 10 00 00       	push   $0x1000
+  801863:	53                   	push   %ebx
+  801864:	50                   	push   %eax
+  801865:	e8 ac f3 ff ff       	call   800c16 <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  80186a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80186d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801874:	25 07 0e 00 00       	and    $0xe07,%eax
+  801879:	89 04 24             	mov    %eax,(%esp)
+  80187c:	53                   	push   %ebx
+  80187d:	ff 75 e4             	push   -0x1c(%ebp)
+  801880:	57                   	push   %edi
+  801881:	6a 00                	push   $0x0
+  801883:	e8 1c 2b 00 00       	call   8043a4 <page_map>
+  801888:	83 c4 20             	add    $0x20,%esp
+  80188b:	85 c0                	test   %eax,%eax
+  80188d:	78 25                	js     8018b4 <fork+0x2ac>
+		free(temp);
+  80188f:	83 ec 0c             	sub    $0xc,%esp
+  801892:	57                   	push   %edi
+  801893:	e8 fc 2e 00 00       	call   804794 <free>
+  801898:	83 c4 10             	add    $0x10,%esp
+  80189b:	e9 5c ff ff ff       	jmp    8017fc <fork+0x1f4>
+			panic("malloc failed");
+  8018a0:	83 ec 04             	sub    $0x4,%esp
+  8018a3:	68 b2 5b 80 00       	push   $0x805bb2
+  8018a8:	6a 56                	push   $0x56
+  8018aa:	68 8b 5b 80 00       	push   $0x805b8b
+  8018af:	e8 b8 ea ff ff       	call   80036c <_panic>
+			panic("page_map: %e", r);
+  8018b4:	50                   	push   %eax
+  8018b5:	68 c0 5b 80 00       	push   $0x805bc0
+  8018ba:	6a 59                	push   $0x59
+  8018bc:	68 8b 5b 80 00       	push   $0x805b8b
+  8018c1:	e8 a6 ea ff ff       	call   80036c <_panic>
+			panic("page_map %d", r);
+  8018c6:	50                   	push   %eax
+  8018c7:	68 a6 5b 80 00       	push   $0x805ba6
+  8018cc:	6a 65                	push   $0x65
+  8018ce:	68 8b 5b 80 00       	push   $0x805b8b
+  8018d3:	e8 94 ea ff ff       	call   80036c <_panic>
+			panic("page_map %d", r);
+  8018d8:	50                   	push   %eax
+  8018d9:	68 a6 5b 80 00       	push   $0x805ba6
+  8018de:	6a 78                	push   $0x78
+  8018e0:	68 8b 5b 80 00       	push   $0x805b8b
+  8018e5:	e8 82 ea ff ff       	call   80036c <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8018ea:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8018ed:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8018f4:	c1 e1 0c             	shl    $0xc,%ecx
+  8018f7:	83 ec 0c             	sub    $0xc,%esp
+  8018fa:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018ff:	50                   	push   %eax
+  801900:	51                   	push   %ecx
+  801901:	ff 75 e4             	push   -0x1c(%ebp)
+  801904:	51                   	push   %ecx
+  801905:	6a 00                	push   $0x0
+  801907:	e8 98 2a 00 00       	call   8043a4 <page_map>
+  80190c:	83 c4 20             	add    $0x20,%esp
+  80190f:	85 c0                	test   %eax,%eax
+  801911:	0f 89 e5 fe ff ff    	jns    8017fc <fork+0x1f4>
+			panic("page_map %d", r);
+  801917:	50                   	push   %eax
+  801918:	68 a6 5b 80 00       	push   $0x805ba6
+  80191d:	6a 7f                	push   $0x7f
+  80191f:	68 8b 5b 80 00       	push   $0x805b8b
+  801924:	e8 43 ea ff ff       	call   80036c <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801929:	83 c7 01             	add    $0x1,%edi
+  80192c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80192f:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  801932:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  801935:	39 f7                	cmp    %esi,%edi
+  801937:	74 1c                	je     801955 <fork+0x34d>
+  801939:	89 d8                	mov    %ebx,%eax
+  80193b:	e8 c5 fb ff ff       	call   801505 <dupable>
+  801940:	84 c0                	test   %al,%al
+  801942:	74 7c                	je     8019c0 <fork+0x3b8>
+  801944:	89 d8                	mov    %ebx,%eax
+  801946:	e8 71 fb ff ff       	call   8014bc <dupperm>
+  80194b:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  80194e:	74 d9                	je     801929 <fork+0x321>
+  801950:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801953:	eb 06                	jmp    80195b <fork+0x353>
+  801955:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801958:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  80195b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80195e:	c1 e0 0c             	shl    $0xc,%eax
+  801961:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801964:	83 ec 08             	sub    $0x8,%esp
+  801967:	ff 75 dc             	push   -0x24(%ebp)
+  80196a:	57                   	push   %edi
+  80196b:	50                   	push   %eax
+  80196c:	ff 75 e4             	push   -0x1c(%ebp)
+  80196f:	50                   	push   %eax
+  801970:	6a 00                	push   $0x0
+  801972:	e8 24 2c 00 00       	call   80459b <page_map_range>
+  801977:	83 c4 20             	add    $0x20,%esp
+  80197a:	85 c0                	test   %eax,%eax
+  80197c:	78 47                	js     8019c5 <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  80197e:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801985:	0f 84 41 fd ff ff    	je     8016cc <fork+0xc4>
+  80198b:	83 ec 08             	sub    $0x8,%esp
+  80198e:	ff 75 dc             	push   -0x24(%ebp)
+  801991:	57                   	push   %edi
+  801992:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801995:	50                   	push   %eax
+  801996:	6a 00                	push   $0x0
+  801998:	50                   	push   %eax
+  801999:	6a 00                	push   $0x0
+  80199b:	e8 fb 2b 00 00       	call   80459b <page_map_range>
+  8019a0:	83 c4 20             	add    $0x20,%esp
+  8019a3:	85 c0                	test   %eax,%eax
+  8019a5:	0f 89 21 fd ff ff    	jns    8016cc <fork+0xc4>
+		panic("page_map_range %e", r);
+  8019ab:	50                   	push   %eax
+  8019ac:	68 cd 5b 80 00       	push   $0x805bcd
+  8019b1:	68 a2 00 00 00       	push   $0xa2
+  8019b6:	68 8b 5b 80 00       	push   $0x805b8b
+  8019bb:	e8 ac e9 ff ff       	call   80036c <_panic>
+  8019c0:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8019c3:	eb 96                	jmp    80195b <fork+0x353>
+		panic("page_map_range %e", r);
+  8019c5:	50                   	push   %eax
+  8019c6:	68 cd 5b 80 00       	push   $0x805bcd
+  8019cb:	68 a0 00 00 00       	push   $0xa0
+  8019d0:	68 8b 5b 80 00       	push   $0x805b8b
+  8019d5:	e8 92 e9 ff ff       	call   80036c <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  8019da:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  8019dd:	6a 01                	push   $0x1
+  8019df:	6a 07                	push   $0x7
+  8019e1:	68 00 f0 bf ee       	push   $0xeebff000
+  8019e6:	53                   	push   %ebx
+  8019e7:	e8 57 23 00 00       	call   803d43 <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8019ec:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8019f1:	8b 40 74             	mov    0x74(%eax),%eax
+  8019f4:	83 c4 08             	add    $0x8,%esp
+  8019f7:	50                   	push   %eax
+  8019f8:	53                   	push   %ebx
+  8019f9:	e8 89 f8 ff ff       	call   801287 <sys_env_set_pgfault_upcall>
+  8019fe:	83 c4 10             	add    $0x10,%esp
+  801a01:	e9 41 fc ff ff       	jmp    801647 <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801a06:	e8 d8 f4 ff ff       	call   800ee3 <sys_getenvid>
+  801a0b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801a10:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801a13:	c1 e0 06             	shl    $0x6,%eax
+  801a16:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a1b:	a3 18 f9 80 00       	mov    %eax,0x80f918
+		return 0;
+  801a20:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801a27:	e9 40 fc ff ff       	jmp    80166c <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  801a2c:	50                   	push   %eax
+  801a2d:	68 df 5b 80 00       	push   $0x805bdf
+  801a32:	68 27 01 00 00       	push   $0x127
+  801a37:	68 8b 5b 80 00       	push   $0x805b8b
+  801a3c:	e8 2b e9 ff ff       	call   80036c <_panic>
+		panic("sys_env_set_status: %d", r);
+  801a41:	50                   	push   %eax
+  801a42:	68 f8 5b 80 00       	push   $0x805bf8
+  801a47:	68 2b 01 00 00       	push   $0x12b
+  801a4c:	68 8b 5b 80 00       	push   $0x805b8b
+  801a51:	e8 16 e9 ff ff       	call   80036c <_panic>
+
+00801a56 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801a56:	55                   	push   %ebp
+  801a57:	89 e5                	mov    %esp,%ebp
+  801a59:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801a5c:	68 0f 5c 80 00       	push   $0x805c0f
+  801a61:	68 35 01 00 00       	push   $0x135
+  801a66:	68 8b 5b 80 00       	push   $0x805b8b
+  801a6b:	e8 fc e8 ff ff       	call   80036c <_panic>
+
+00801a70 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801a70:	55                   	push   %ebp
+  801a71:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a73:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a76:	05 00 00 00 30       	add    $0x30000000,%eax
+  801a7b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801a7e:	5d                   	pop    %ebp
+  801a7f:	c3                   	ret
+
+00801a80 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801a80:	55                   	push   %ebp
+  801a81:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a83:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a86:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801a8b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a90:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801a95:	5d                   	pop    %ebp
+  801a96:	c3                   	ret
+
+00801a97 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801a97:	55                   	push   %ebp
+  801a98:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801a9a:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801a9f:	a8 01                	test   $0x1,%al
+  801aa1:	74 3c                	je     801adf <fd_alloc+0x48>
+  801aa3:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801aa8:	89 c2                	mov    %eax,%edx
+  801aaa:	c1 ea 0c             	shr    $0xc,%edx
+  801aad:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801ab4:	89 c1                	mov    %eax,%ecx
+  801ab6:	05 00 10 00 00       	add    $0x1000,%eax
+  801abb:	f6 c2 01             	test   $0x1,%dl
+  801abe:	74 13                	je     801ad3 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801ac0:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801ac5:	75 e1                	jne    801aa8 <fd_alloc+0x11>
+  801ac7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801acc:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801ad1:	eb 05                	jmp    801ad8 <fd_alloc+0x41>
+			return 0;
+  801ad3:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801ad8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801adb:	89 0a                	mov    %ecx,(%edx)
+}
+  801add:	5d                   	pop    %ebp
+  801ade:	c3                   	ret
+  801adf:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae9:	eb ed                	jmp    801ad8 <fd_alloc+0x41>
+
+00801aeb <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801aeb:	55                   	push   %ebp
+  801aec:	89 e5                	mov    %esp,%ebp
+  801aee:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801af1:	83 f8 1f             	cmp    $0x1f,%eax
+  801af4:	77 30                	ja     801b26 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801af6:	c1 e0 0c             	shl    $0xc,%eax
+  801af9:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801afe:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801b04:	f6 c2 01             	test   $0x1,%dl
+  801b07:	74 24                	je     801b2d <fd_lookup+0x42>
+  801b09:	89 c2                	mov    %eax,%edx
+  801b0b:	c1 ea 0c             	shr    $0xc,%edx
+  801b0e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b15:	f6 c2 01             	test   $0x1,%dl
+  801b18:	74 1a                	je     801b34 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801b1a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b1d:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b24:	5d                   	pop    %ebp
+  801b25:	c3                   	ret
+		return -E_INVAL;
+  801b26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b2b:	eb f7                	jmp    801b24 <fd_lookup+0x39>
+		return -E_INVAL;
+  801b2d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b32:	eb f0                	jmp    801b24 <fd_lookup+0x39>
+  801b34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b39:	eb e9                	jmp    801b24 <fd_lookup+0x39>
+
+00801b3b <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801b3b:	55                   	push   %ebp
+  801b3c:	89 e5                	mov    %esp,%ebp
+  801b3e:	53                   	push   %ebx
+  801b3f:	83 ec 04             	sub    $0x4,%esp
+  801b42:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801b45:	b8 a4 5c 80 00       	mov    $0x805ca4,%eax
+  801b4a:	8b 18                	mov    (%eax),%ebx
+  801b4c:	85 db                	test   %ebx,%ebx
+  801b4e:	74 0e                	je     801b5e <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801b50:	83 c0 04             	add    $0x4,%eax
+  801b53:	39 13                	cmp    %edx,(%ebx)
+  801b55:	75 f3                	jne    801b4a <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801b57:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5c:	eb 1f                	jmp    801b7d <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b5e:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801b63:	8b 40 48             	mov    0x48(%eax),%eax
+  801b66:	83 ec 04             	sub    $0x4,%esp
+  801b69:	52                   	push   %edx
+  801b6a:	50                   	push   %eax
+  801b6b:	68 28 5c 80 00       	push   $0x805c28
+  801b70:	e8 d2 e8 ff ff       	call   800447 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801b75:	83 c4 10             	add    $0x10,%esp
+  801b78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801b7d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b80:	89 1a                	mov    %ebx,(%edx)
+}
+  801b82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b85:	c9                   	leave
+  801b86:	c3                   	ret
+
+00801b87 <fd_close>:
+{
+  801b87:	55                   	push   %ebp
+  801b88:	89 e5                	mov    %esp,%ebp
+  801b8a:	57                   	push   %edi
+  801b8b:	56                   	push   %esi
+  801b8c:	53                   	push   %ebx
+  801b8d:	83 ec 24             	sub    $0x24,%esp
+  801b90:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b93:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b96:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b99:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b9a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801ba0:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ba3:	50                   	push   %eax
+  801ba4:	e8 42 ff ff ff       	call   801aeb <fd_lookup>
+  801ba9:	89 c3                	mov    %eax,%ebx
+  801bab:	83 c4 10             	add    $0x10,%esp
+  801bae:	85 c0                	test   %eax,%eax
+  801bb0:	78 05                	js     801bb7 <fd_close+0x30>
+	    || fd != fd2)
+  801bb2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801bb5:	74 16                	je     801bcd <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801bb7:	89 f8                	mov    %edi,%eax
+  801bb9:	84 c0                	test   %al,%al
+  801bbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801bc3:	89 d8                	mov    %ebx,%eax
+  801bc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bc8:	5b                   	pop    %ebx
+  801bc9:	5e                   	pop    %esi
+  801bca:	5f                   	pop    %edi
+  801bcb:	5d                   	pop    %ebp
+  801bcc:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bcd:	83 ec 08             	sub    $0x8,%esp
+  801bd0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801bd3:	50                   	push   %eax
+  801bd4:	ff 36                	push   (%esi)
+  801bd6:	e8 60 ff ff ff       	call   801b3b <dev_lookup>
+  801bdb:	89 c3                	mov    %eax,%ebx
+  801bdd:	83 c4 10             	add    $0x10,%esp
+  801be0:	85 c0                	test   %eax,%eax
+  801be2:	78 1a                	js     801bfe <fd_close+0x77>
+		if (dev->dev_close)
+  801be4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801be7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801bea:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801bef:	85 c0                	test   %eax,%eax
+  801bf1:	74 0b                	je     801bfe <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801bf3:	83 ec 0c             	sub    $0xc,%esp
+  801bf6:	56                   	push   %esi
+  801bf7:	ff d0                	call   *%eax
+  801bf9:	89 c3                	mov    %eax,%ebx
+  801bfb:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801bfe:	83 ec 08             	sub    $0x8,%esp
+  801c01:	56                   	push   %esi
+  801c02:	6a 00                	push   $0x0
+  801c04:	e8 9d f3 ff ff       	call   800fa6 <sys_page_unmap>
+	return r;
+  801c09:	83 c4 10             	add    $0x10,%esp
+  801c0c:	eb b5                	jmp    801bc3 <fd_close+0x3c>
+
+00801c0e <close>:
+
+int
+close(int fdnum)
+{
+  801c0e:	55                   	push   %ebp
+  801c0f:	89 e5                	mov    %esp,%ebp
+  801c11:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c14:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c17:	50                   	push   %eax
+  801c18:	ff 75 08             	push   0x8(%ebp)
+  801c1b:	e8 cb fe ff ff       	call   801aeb <fd_lookup>
+  801c20:	83 c4 10             	add    $0x10,%esp
+  801c23:	85 c0                	test   %eax,%eax
+  801c25:	79 02                	jns    801c29 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801c27:	c9                   	leave
+  801c28:	c3                   	ret
+		return fd_close(fd, 1);
+  801c29:	83 ec 08             	sub    $0x8,%esp
+  801c2c:	6a 01                	push   $0x1
+  801c2e:	ff 75 f4             	push   -0xc(%ebp)
+  801c31:	e8 51 ff ff ff       	call   801b87 <fd_close>
+  801c36:	83 c4 10             	add    $0x10,%esp
+  801c39:	eb ec                	jmp    801c27 <close+0x19>
+
+00801c3b <close_all>:
+
+void
+close_all(void)
+{
+  801c3b:	55                   	push   %ebp
+  801c3c:	89 e5                	mov    %esp,%ebp
+  801c3e:	53                   	push   %ebx
+  801c3f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801c42:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801c47:	83 ec 0c             	sub    $0xc,%esp
+  801c4a:	53                   	push   %ebx
+  801c4b:	e8 be ff ff ff       	call   801c0e <close>
+	for (i = 0; i < MAXFD; i++)
+  801c50:	83 c3 01             	add    $0x1,%ebx
+  801c53:	83 c4 10             	add    $0x10,%esp
+  801c56:	83 fb 20             	cmp    $0x20,%ebx
+  801c59:	75 ec                	jne    801c47 <close_all+0xc>
+}
+  801c5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c5e:	c9                   	leave
+  801c5f:	c3                   	ret
+
+00801c60 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801c60:	55                   	push   %ebp
+  801c61:	89 e5                	mov    %esp,%ebp
+  801c63:	57                   	push   %edi
+  801c64:	56                   	push   %esi
+  801c65:	53                   	push   %ebx
+  801c66:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801c69:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c6c:	50                   	push   %eax
+  801c6d:	ff 75 08             	push   0x8(%ebp)
+  801c70:	e8 76 fe ff ff       	call   801aeb <fd_lookup>
+  801c75:	89 c3                	mov    %eax,%ebx
+  801c77:	83 c4 10             	add    $0x10,%esp
+  801c7a:	85 c0                	test   %eax,%eax
+  801c7c:	78 7f                	js     801cfd <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801c7e:	83 ec 0c             	sub    $0xc,%esp
+  801c81:	ff 75 0c             	push   0xc(%ebp)
+  801c84:	e8 85 ff ff ff       	call   801c0e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801c89:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c8c:	c1 e6 0c             	shl    $0xc,%esi
+  801c8f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801c95:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801c98:	89 3c 24             	mov    %edi,(%esp)
+  801c9b:	e8 e0 fd ff ff       	call   801a80 <fd2data>
+  801ca0:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801ca2:	89 34 24             	mov    %esi,(%esp)
+  801ca5:	e8 d6 fd ff ff       	call   801a80 <fd2data>
+  801caa:	83 c4 10             	add    $0x10,%esp
+  801cad:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801cb0:	89 d8                	mov    %ebx,%eax
+  801cb2:	c1 e8 16             	shr    $0x16,%eax
+  801cb5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801cbc:	a8 01                	test   $0x1,%al
+  801cbe:	74 11                	je     801cd1 <dup+0x71>
+  801cc0:	89 d8                	mov    %ebx,%eax
+  801cc2:	c1 e8 0c             	shr    $0xc,%eax
+  801cc5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ccc:	f6 c2 01             	test   $0x1,%dl
+  801ccf:	75 36                	jne    801d07 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801cd1:	89 f8                	mov    %edi,%eax
+  801cd3:	c1 e8 0c             	shr    $0xc,%eax
+  801cd6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801cdd:	83 ec 0c             	sub    $0xc,%esp
+  801ce0:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ce5:	50                   	push   %eax
+  801ce6:	56                   	push   %esi
+  801ce7:	6a 00                	push   $0x0
+  801ce9:	57                   	push   %edi
+  801cea:	6a 00                	push   $0x0
+  801cec:	e8 73 f2 ff ff       	call   800f64 <sys_page_map>
+  801cf1:	89 c3                	mov    %eax,%ebx
+  801cf3:	83 c4 20             	add    $0x20,%esp
+  801cf6:	85 c0                	test   %eax,%eax
+  801cf8:	78 33                	js     801d2d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801cfa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801cfd:	89 d8                	mov    %ebx,%eax
+  801cff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d02:	5b                   	pop    %ebx
+  801d03:	5e                   	pop    %esi
+  801d04:	5f                   	pop    %edi
+  801d05:	5d                   	pop    %ebp
+  801d06:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801d07:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d0e:	83 ec 0c             	sub    $0xc,%esp
+  801d11:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d16:	50                   	push   %eax
+  801d17:	ff 75 d4             	push   -0x2c(%ebp)
+  801d1a:	6a 00                	push   $0x0
+  801d1c:	53                   	push   %ebx
+  801d1d:	6a 00                	push   $0x0
+  801d1f:	e8 40 f2 ff ff       	call   800f64 <sys_page_map>
+  801d24:	89 c3                	mov    %eax,%ebx
+  801d26:	83 c4 20             	add    $0x20,%esp
+  801d29:	85 c0                	test   %eax,%eax
+  801d2b:	79 a4                	jns    801cd1 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801d2d:	83 ec 08             	sub    $0x8,%esp
+  801d30:	56                   	push   %esi
+  801d31:	6a 00                	push   $0x0
+  801d33:	e8 6e f2 ff ff       	call   800fa6 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801d38:	83 c4 08             	add    $0x8,%esp
+  801d3b:	ff 75 d4             	push   -0x2c(%ebp)
+  801d3e:	6a 00                	push   $0x0
+  801d40:	e8 61 f2 ff ff       	call   800fa6 <sys_page_unmap>
+	return r;
+  801d45:	83 c4 10             	add    $0x10,%esp
+  801d48:	eb b3                	jmp    801cfd <dup+0x9d>
+
+00801d4a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801d4a:	55                   	push   %ebp
+  801d4b:	89 e5                	mov    %esp,%ebp
+  801d4d:	56                   	push   %esi
+  801d4e:	53                   	push   %ebx
+  801d4f:	83 ec 18             	sub    $0x18,%esp
+  801d52:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d55:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d58:	50                   	push   %eax
+  801d59:	56                   	push   %esi
+  801d5a:	e8 8c fd ff ff       	call   801aeb <fd_lookup>
+  801d5f:	83 c4 10             	add    $0x10,%esp
+  801d62:	85 c0                	test   %eax,%eax
+  801d64:	78 3c                	js     801da2 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d66:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801d69:	83 ec 08             	sub    $0x8,%esp
+  801d6c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d6f:	50                   	push   %eax
+  801d70:	ff 33                	push   (%ebx)
+  801d72:	e8 c4 fd ff ff       	call   801b3b <dev_lookup>
+  801d77:	83 c4 10             	add    $0x10,%esp
+  801d7a:	85 c0                	test   %eax,%eax
+  801d7c:	78 24                	js     801da2 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d7e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801d81:	83 e0 03             	and    $0x3,%eax
+  801d84:	83 f8 01             	cmp    $0x1,%eax
+  801d87:	74 20                	je     801da9 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801d89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d8c:	8b 40 08             	mov    0x8(%eax),%eax
+  801d8f:	85 c0                	test   %eax,%eax
+  801d91:	74 37                	je     801dca <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801d93:	83 ec 04             	sub    $0x4,%esp
+  801d96:	ff 75 10             	push   0x10(%ebp)
+  801d99:	ff 75 0c             	push   0xc(%ebp)
+  801d9c:	53                   	push   %ebx
+  801d9d:	ff d0                	call   *%eax
+  801d9f:	83 c4 10             	add    $0x10,%esp
+}
+  801da2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801da5:	5b                   	pop    %ebx
+  801da6:	5e                   	pop    %esi
+  801da7:	5d                   	pop    %ebp
+  801da8:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801da9:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801dae:	8b 40 48             	mov    0x48(%eax),%eax
+  801db1:	83 ec 04             	sub    $0x4,%esp
+  801db4:	56                   	push   %esi
+  801db5:	50                   	push   %eax
+  801db6:	68 69 5c 80 00       	push   $0x805c69
+  801dbb:	e8 87 e6 ff ff       	call   800447 <cprintf>
+		return -E_INVAL;
+  801dc0:	83 c4 10             	add    $0x10,%esp
+  801dc3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dc8:	eb d8                	jmp    801da2 <read+0x58>
+		return -E_NOT_SUPP;
+  801dca:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dcf:	eb d1                	jmp    801da2 <read+0x58>
+
+00801dd1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801dd1:	55                   	push   %ebp
+  801dd2:	89 e5                	mov    %esp,%ebp
+  801dd4:	57                   	push   %edi
+  801dd5:	56                   	push   %esi
+  801dd6:	53                   	push   %ebx
+  801dd7:	83 ec 0c             	sub    $0xc,%esp
+  801dda:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ddd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801de0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801de5:	eb 02                	jmp    801de9 <readn+0x18>
+  801de7:	01 c3                	add    %eax,%ebx
+  801de9:	39 f3                	cmp    %esi,%ebx
+  801deb:	73 21                	jae    801e0e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801ded:	83 ec 04             	sub    $0x4,%esp
+  801df0:	89 f0                	mov    %esi,%eax
+  801df2:	29 d8                	sub    %ebx,%eax
+  801df4:	50                   	push   %eax
+  801df5:	89 d8                	mov    %ebx,%eax
+  801df7:	03 45 0c             	add    0xc(%ebp),%eax
+  801dfa:	50                   	push   %eax
+  801dfb:	57                   	push   %edi
+  801dfc:	e8 49 ff ff ff       	call   801d4a <read>
+		if (m < 0)
+  801e01:	83 c4 10             	add    $0x10,%esp
+  801e04:	85 c0                	test   %eax,%eax
+  801e06:	78 04                	js     801e0c <readn+0x3b>
+			return m;
+		if (m == 0)
+  801e08:	75 dd                	jne    801de7 <readn+0x16>
+  801e0a:	eb 02                	jmp    801e0e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801e0c:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801e0e:	89 d8                	mov    %ebx,%eax
+  801e10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e13:	5b                   	pop    %ebx
+  801e14:	5e                   	pop    %esi
+  801e15:	5f                   	pop    %edi
+  801e16:	5d                   	pop    %ebp
+  801e17:	c3                   	ret
+
+00801e18 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801e18:	55                   	push   %ebp
+  801e19:	89 e5                	mov    %esp,%ebp
+  801e1b:	56                   	push   %esi
+  801e1c:	53                   	push   %ebx
+  801e1d:	83 ec 18             	sub    $0x18,%esp
+  801e20:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e23:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e26:	50                   	push   %eax
+  801e27:	53                   	push   %ebx
+  801e28:	e8 be fc ff ff       	call   801aeb <fd_lookup>
+  801e2d:	83 c4 10             	add    $0x10,%esp
+  801e30:	85 c0                	test   %eax,%eax
+  801e32:	78 37                	js     801e6b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e34:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e37:	83 ec 08             	sub    $0x8,%esp
+  801e3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e3d:	50                   	push   %eax
+  801e3e:	ff 36                	push   (%esi)
+  801e40:	e8 f6 fc ff ff       	call   801b3b <dev_lookup>
+  801e45:	83 c4 10             	add    $0x10,%esp
+  801e48:	85 c0                	test   %eax,%eax
+  801e4a:	78 1f                	js     801e6b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e4c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e50:	74 20                	je     801e72 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801e52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e55:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e58:	85 c0                	test   %eax,%eax
+  801e5a:	74 37                	je     801e93 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801e5c:	83 ec 04             	sub    $0x4,%esp
+  801e5f:	ff 75 10             	push   0x10(%ebp)
+  801e62:	ff 75 0c             	push   0xc(%ebp)
+  801e65:	56                   	push   %esi
+  801e66:	ff d0                	call   *%eax
+  801e68:	83 c4 10             	add    $0x10,%esp
+}
+  801e6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e6e:	5b                   	pop    %ebx
+  801e6f:	5e                   	pop    %esi
+  801e70:	5d                   	pop    %ebp
+  801e71:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e72:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801e77:	8b 40 48             	mov    0x48(%eax),%eax
+  801e7a:	83 ec 04             	sub    $0x4,%esp
+  801e7d:	53                   	push   %ebx
+  801e7e:	50                   	push   %eax
+  801e7f:	68 85 5c 80 00       	push   $0x805c85
+  801e84:	e8 be e5 ff ff       	call   800447 <cprintf>
+		return -E_INVAL;
+  801e89:	83 c4 10             	add    $0x10,%esp
+  801e8c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e91:	eb d8                	jmp    801e6b <write+0x53>
+		return -E_NOT_SUPP;
+  801e93:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e98:	eb d1                	jmp    801e6b <write+0x53>
+
+00801e9a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801e9a:	55                   	push   %ebp
+  801e9b:	89 e5                	mov    %esp,%ebp
+  801e9d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ea0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ea3:	50                   	push   %eax
+  801ea4:	ff 75 08             	push   0x8(%ebp)
+  801ea7:	e8 3f fc ff ff       	call   801aeb <fd_lookup>
+  801eac:	83 c4 10             	add    $0x10,%esp
+  801eaf:	85 c0                	test   %eax,%eax
+  801eb1:	78 0e                	js     801ec1 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801eb3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801eb6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eb9:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ec1:	c9                   	leave
+  801ec2:	c3                   	ret
+
+00801ec3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801ec3:	55                   	push   %ebp
+  801ec4:	89 e5                	mov    %esp,%ebp
+  801ec6:	56                   	push   %esi
+  801ec7:	53                   	push   %ebx
+  801ec8:	83 ec 18             	sub    $0x18,%esp
+  801ecb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ece:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ed1:	50                   	push   %eax
+  801ed2:	53                   	push   %ebx
+  801ed3:	e8 13 fc ff ff       	call   801aeb <fd_lookup>
+  801ed8:	83 c4 10             	add    $0x10,%esp
+  801edb:	85 c0                	test   %eax,%eax
+  801edd:	78 34                	js     801f13 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801edf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ee2:	83 ec 08             	sub    $0x8,%esp
+  801ee5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ee8:	50                   	push   %eax
+  801ee9:	ff 36                	push   (%esi)
+  801eeb:	e8 4b fc ff ff       	call   801b3b <dev_lookup>
+  801ef0:	83 c4 10             	add    $0x10,%esp
+  801ef3:	85 c0                	test   %eax,%eax
+  801ef5:	78 1c                	js     801f13 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ef7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801efb:	74 1d                	je     801f1a <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801efd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f00:	8b 40 18             	mov    0x18(%eax),%eax
+  801f03:	85 c0                	test   %eax,%eax
+  801f05:	74 34                	je     801f3b <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801f07:	83 ec 08             	sub    $0x8,%esp
+  801f0a:	ff 75 0c             	push   0xc(%ebp)
+  801f0d:	56                   	push   %esi
+  801f0e:	ff d0                	call   *%eax
+  801f10:	83 c4 10             	add    $0x10,%esp
+}
+  801f13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f16:	5b                   	pop    %ebx
+  801f17:	5e                   	pop    %esi
+  801f18:	5d                   	pop    %ebp
+  801f19:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801f1a:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801f1f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f22:	83 ec 04             	sub    $0x4,%esp
+  801f25:	53                   	push   %ebx
+  801f26:	50                   	push   %eax
+  801f27:	68 48 5c 80 00       	push   $0x805c48
+  801f2c:	e8 16 e5 ff ff       	call   800447 <cprintf>
+		return -E_INVAL;
+  801f31:	83 c4 10             	add    $0x10,%esp
+  801f34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f39:	eb d8                	jmp    801f13 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801f3b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f40:	eb d1                	jmp    801f13 <ftruncate+0x50>
+
+00801f42 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801f42:	55                   	push   %ebp
+  801f43:	89 e5                	mov    %esp,%ebp
+  801f45:	56                   	push   %esi
+  801f46:	53                   	push   %ebx
+  801f47:	83 ec 18             	sub    $0x18,%esp
+  801f4a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f4d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f50:	50                   	push   %eax
+  801f51:	ff 75 08             	push   0x8(%ebp)
+  801f54:	e8 92 fb ff ff       	call   801aeb <fd_lookup>
+  801f59:	83 c4 10             	add    $0x10,%esp
+  801f5c:	85 c0                	test   %eax,%eax
+  801f5e:	78 49                	js     801fa9 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f60:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f63:	83 ec 08             	sub    $0x8,%esp
+  801f66:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f69:	50                   	push   %eax
+  801f6a:	ff 36                	push   (%esi)
+  801f6c:	e8 ca fb ff ff       	call   801b3b <dev_lookup>
+  801f71:	83 c4 10             	add    $0x10,%esp
+  801f74:	85 c0                	test   %eax,%eax
+  801f76:	78 31                	js     801fa9 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801f78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f7b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801f7f:	74 2f                	je     801fb0 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801f81:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801f84:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801f8b:	00 00 00 
+	stat->st_isdir = 0;
+  801f8e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f95:	00 00 00 
+	stat->st_dev = dev;
+  801f98:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801f9e:	83 ec 08             	sub    $0x8,%esp
+  801fa1:	53                   	push   %ebx
+  801fa2:	56                   	push   %esi
+  801fa3:	ff 50 14             	call   *0x14(%eax)
+  801fa6:	83 c4 10             	add    $0x10,%esp
+}
+  801fa9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fac:	5b                   	pop    %ebx
+  801fad:	5e                   	pop    %esi
+  801fae:	5d                   	pop    %ebp
+  801faf:	c3                   	ret
+		return -E_NOT_SUPP;
+  801fb0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fb5:	eb f2                	jmp    801fa9 <fstat+0x67>
+
+00801fb7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801fb7:	55                   	push   %ebp
+  801fb8:	89 e5                	mov    %esp,%ebp
+  801fba:	56                   	push   %esi
+  801fbb:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801fbc:	83 ec 08             	sub    $0x8,%esp
+  801fbf:	6a 00                	push   $0x0
+  801fc1:	ff 75 08             	push   0x8(%ebp)
+  801fc4:	e8 bc 02 00 00       	call   802285 <open>
+  801fc9:	89 c3                	mov    %eax,%ebx
+  801fcb:	83 c4 10             	add    $0x10,%esp
+  801fce:	85 c0                	test   %eax,%eax
+  801fd0:	78 1b                	js     801fed <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801fd2:	83 ec 08             	sub    $0x8,%esp
+  801fd5:	ff 75 0c             	push   0xc(%ebp)
+  801fd8:	50                   	push   %eax
+  801fd9:	e8 64 ff ff ff       	call   801f42 <fstat>
+  801fde:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801fe0:	89 1c 24             	mov    %ebx,(%esp)
+  801fe3:	e8 26 fc ff ff       	call   801c0e <close>
+	return r;
+  801fe8:	83 c4 10             	add    $0x10,%esp
+  801feb:	89 f3                	mov    %esi,%ebx
+}
+  801fed:	89 d8                	mov    %ebx,%eax
+  801fef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ff2:	5b                   	pop    %ebx
+  801ff3:	5e                   	pop    %esi
+  801ff4:	5d                   	pop    %ebp
+  801ff5:	c3                   	ret
+
+00801ff6 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801ff6:	55                   	push   %ebp
+  801ff7:	89 e5                	mov    %esp,%ebp
+  801ff9:	57                   	push   %edi
+  801ffa:	56                   	push   %esi
+  801ffb:	53                   	push   %ebx
+  801ffc:	83 ec 0c             	sub    $0xc,%esp
+  801fff:	89 c7                	mov    %eax,%edi
+  802001:	89 d3                	mov    %edx,%ebx
+  802003:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802005:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80200c:	74 2d                	je     80203b <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80200e:	6a 07                	push   $0x7
+  802010:	68 00 00 81 00       	push   $0x810000
+  802015:	57                   	push   %edi
+  802016:	ff 35 00 80 80 00    	push   0x808000
+  80201c:	e8 ba 31 00 00       	call   8051db <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  802021:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802028:	6a 00                	push   $0x0
+  80202a:	56                   	push   %esi
+  80202b:	53                   	push   %ebx
+  80202c:	6a 00                	push   $0x0
+  80202e:	e8 5a 30 00 00       	call   80508d <ipc_recv_pages>
+}
+  802033:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802036:	5b                   	pop    %ebx
+  802037:	5e                   	pop    %esi
+  802038:	5f                   	pop    %edi
+  802039:	5d                   	pop    %ebp
+  80203a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80203b:	83 ec 0c             	sub    $0xc,%esp
+  80203e:	6a 01                	push   $0x1
+  802040:	e8 8b 32 00 00       	call   8052d0 <ipc_find_env>
+  802045:	a3 00 80 80 00       	mov    %eax,0x808000
+  80204a:	83 c4 10             	add    $0x10,%esp
+  80204d:	eb bf                	jmp    80200e <fsipc_pages+0x18>
+
+0080204f <fsipc>:
+{
+  80204f:	55                   	push   %ebp
+  802050:	89 e5                	mov    %esp,%ebp
+  802052:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  802055:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80205a:	e8 97 ff ff ff       	call   801ff6 <fsipc_pages>
+}
+  80205f:	c9                   	leave
+  802060:	c3                   	ret
+
+00802061 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802061:	55                   	push   %ebp
+  802062:	89 e5                	mov    %esp,%ebp
+  802064:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802067:	8b 45 08             	mov    0x8(%ebp),%eax
+  80206a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80206d:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.set_size.req_size = newsize;
+  802072:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802075:	a3 04 00 81 00       	mov    %eax,0x810004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80207a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80207f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802084:	e8 c6 ff ff ff       	call   80204f <fsipc>
+}
+  802089:	c9                   	leave
+  80208a:	c3                   	ret
+
+0080208b <devfile_flush>:
+{
+  80208b:	55                   	push   %ebp
+  80208c:	89 e5                	mov    %esp,%ebp
+  80208e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802091:	8b 45 08             	mov    0x8(%ebp),%eax
+  802094:	8b 40 0c             	mov    0xc(%eax),%eax
+  802097:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80209c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020a1:	b8 06 00 00 00       	mov    $0x6,%eax
+  8020a6:	e8 a4 ff ff ff       	call   80204f <fsipc>
+}
+  8020ab:	c9                   	leave
+  8020ac:	c3                   	ret
+
+008020ad <devfile_stat>:
+{
+  8020ad:	55                   	push   %ebp
+  8020ae:	89 e5                	mov    %esp,%ebp
+  8020b0:	53                   	push   %ebx
+  8020b1:	83 ec 04             	sub    $0x4,%esp
+  8020b4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8020b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ba:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020bd:	a3 00 00 81 00       	mov    %eax,0x810000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8020c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8020cc:	e8 7e ff ff ff       	call   80204f <fsipc>
+  8020d1:	85 c0                	test   %eax,%eax
+  8020d3:	78 2c                	js     802101 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8020d5:	83 ec 08             	sub    $0x8,%esp
+  8020d8:	68 00 00 81 00       	push   $0x810000
+  8020dd:	53                   	push   %ebx
+  8020de:	e8 4b e9 ff ff       	call   800a2e <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8020e3:	a1 80 00 81 00       	mov    0x810080,%eax
+  8020e8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020ee:	a1 84 00 81 00       	mov    0x810084,%eax
+  8020f3:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8020f9:	83 c4 10             	add    $0x10,%esp
+  8020fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802101:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802104:	c9                   	leave
+  802105:	c3                   	ret
+
+00802106 <devfile_write>:
+{
+  802106:	55                   	push   %ebp
+  802107:	89 e5                	mov    %esp,%ebp
+  802109:	83 ec 0c             	sub    $0xc,%esp
+  80210c:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80210f:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802114:	39 d0                	cmp    %edx,%eax
+  802116:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802119:	8b 55 08             	mov    0x8(%ebp),%edx
+  80211c:	8b 52 0c             	mov    0xc(%edx),%edx
+  80211f:	89 15 00 00 81 00    	mov    %edx,0x810000
+	fsipcbuf.write.req_n = n;
+  802125:	a3 04 00 81 00       	mov    %eax,0x810004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80212a:	50                   	push   %eax
+  80212b:	ff 75 0c             	push   0xc(%ebp)
+  80212e:	68 08 00 81 00       	push   $0x810008
+  802133:	e8 7c ea ff ff       	call   800bb4 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  802138:	ba 00 00 00 00       	mov    $0x0,%edx
+  80213d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802142:	e8 08 ff ff ff       	call   80204f <fsipc>
+}
+  802147:	c9                   	leave
+  802148:	c3                   	ret
+
+00802149 <devfile_read>:
+{
+  802149:	55                   	push   %ebp
+  80214a:	89 e5                	mov    %esp,%ebp
+  80214c:	57                   	push   %edi
+  80214d:	56                   	push   %esi
+  80214e:	53                   	push   %ebx
+  80214f:	83 ec 1c             	sub    $0x1c,%esp
+  802152:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802155:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802158:	89 fe                	mov    %edi,%esi
+  80215a:	c1 ee 0c             	shr    $0xc,%esi
+  80215d:	b8 20 00 00 00       	mov    $0x20,%eax
+  802162:	39 c6                	cmp    %eax,%esi
+  802164:	0f 47 f0             	cmova  %eax,%esi
+  802167:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80216a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80216f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802172:	eb 14                	jmp    802188 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802174:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  80217b:	05 00 10 00 00       	add    $0x1000,%eax
+  802180:	f6 c6 06             	test   $0x6,%dh
+  802183:	75 42                	jne    8021c7 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802185:	83 c1 01             	add    $0x1,%ecx
+  802188:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80218b:	39 f1                	cmp    %esi,%ecx
+  80218d:	0f 84 95 00 00 00    	je     802228 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  802193:	89 c2                	mov    %eax,%edx
+  802195:	c1 ea 16             	shr    $0x16,%edx
+  802198:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  80219f:	f6 c2 01             	test   $0x1,%dl
+  8021a2:	74 23                	je     8021c7 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8021a4:	89 c2                	mov    %eax,%edx
+  8021a6:	c1 ea 0c             	shr    $0xc,%edx
+  8021a9:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8021b0:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  8021b6:	74 0f                	je     8021c7 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  8021b8:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8021bf:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  8021c5:	75 ad                	jne    802174 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  8021c7:	85 c9                	test   %ecx,%ecx
+  8021c9:	74 11                	je     8021dc <devfile_read+0x93>
+  8021cb:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  8021d2:	75 08                	jne    8021dc <devfile_read+0x93>
+  8021d4:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  8021da:	74 50                	je     80222c <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8021dc:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8021df:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.read.req_n = n;
+  8021e4:	89 3d 04 00 81 00    	mov    %edi,0x810004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8021ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ef:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021f4:	e8 56 fe ff ff       	call   80204f <fsipc>
+  8021f9:	89 c6                	mov    %eax,%esi
+  8021fb:	85 c0                	test   %eax,%eax
+  8021fd:	78 1f                	js     80221e <devfile_read+0xd5>
+	assert(r <= n);
+  8021ff:	39 c7                	cmp    %eax,%edi
+  802201:	72 50                	jb     802253 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  802203:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802208:	7f 62                	jg     80226c <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  80220a:	83 ec 04             	sub    $0x4,%esp
+  80220d:	50                   	push   %eax
+  80220e:	68 00 00 81 00       	push   $0x810000
+  802213:	ff 75 0c             	push   0xc(%ebp)
+  802216:	e8 99 e9 ff ff       	call   800bb4 <memmove>
+	return r;
+  80221b:	83 c4 10             	add    $0x10,%esp
+}
+  80221e:	89 f0                	mov    %esi,%eax
+  802220:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802223:	5b                   	pop    %ebx
+  802224:	5e                   	pop    %esi
+  802225:	5f                   	pop    %edi
+  802226:	5d                   	pop    %ebp
+  802227:	c3                   	ret
+  802228:	89 f1                	mov    %esi,%ecx
+  80222a:	eb 9b                	jmp    8021c7 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  80222c:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80222f:	a3 00 00 81 00       	mov    %eax,0x810000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  802234:	89 c8                	mov    %ecx,%eax
+  802236:	c1 e0 0c             	shl    $0xc,%eax
+  802239:	a3 04 00 81 00       	mov    %eax,0x810004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  80223e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802241:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802246:	e8 ab fd ff ff       	call   801ff6 <fsipc_pages>
+  80224b:	89 c6                	mov    %eax,%esi
+  80224d:	85 c0                	test   %eax,%eax
+  80224f:	78 8b                	js     8021dc <devfile_read+0x93>
+  802251:	eb cb                	jmp    80221e <devfile_read+0xd5>
+	assert(r <= n);
+  802253:	68 b4 5c 80 00       	push   $0x805cb4
+  802258:	68 6a 55 80 00       	push   $0x80556a
+  80225d:	68 a0 00 00 00       	push   $0xa0
+  802262:	68 bb 5c 80 00       	push   $0x805cbb
+  802267:	e8 00 e1 ff ff       	call   80036c <_panic>
+	assert(r <= PGSIZE);
+  80226c:	68 c6 5c 80 00       	push   $0x805cc6
+  802271:	68 6a 55 80 00       	push   $0x80556a
+  802276:	68 a1 00 00 00       	push   $0xa1
+  80227b:	68 bb 5c 80 00       	push   $0x805cbb
+  802280:	e8 e7 e0 ff ff       	call   80036c <_panic>
+
+00802285 <open>:
+{
+  802285:	55                   	push   %ebp
+  802286:	89 e5                	mov    %esp,%ebp
+  802288:	56                   	push   %esi
+  802289:	53                   	push   %ebx
+  80228a:	83 ec 1c             	sub    $0x1c,%esp
+  80228d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802290:	56                   	push   %esi
+  802291:	e8 5d e7 ff ff       	call   8009f3 <strlen>
+  802296:	83 c4 10             	add    $0x10,%esp
+  802299:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80229e:	7f 6c                	jg     80230c <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8022a0:	83 ec 0c             	sub    $0xc,%esp
+  8022a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022a6:	50                   	push   %eax
+  8022a7:	e8 eb f7 ff ff       	call   801a97 <fd_alloc>
+  8022ac:	89 c3                	mov    %eax,%ebx
+  8022ae:	83 c4 10             	add    $0x10,%esp
+  8022b1:	85 c0                	test   %eax,%eax
+  8022b3:	78 3c                	js     8022f1 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8022b5:	83 ec 08             	sub    $0x8,%esp
+  8022b8:	56                   	push   %esi
+  8022b9:	68 00 00 81 00       	push   $0x810000
+  8022be:	e8 6b e7 ff ff       	call   800a2e <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8022c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022c6:	a3 00 04 81 00       	mov    %eax,0x810400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8022cb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022d3:	e8 77 fd ff ff       	call   80204f <fsipc>
+  8022d8:	89 c3                	mov    %eax,%ebx
+  8022da:	83 c4 10             	add    $0x10,%esp
+  8022dd:	85 c0                	test   %eax,%eax
+  8022df:	78 19                	js     8022fa <open+0x75>
+	return fd2num(fd);
+  8022e1:	83 ec 0c             	sub    $0xc,%esp
+  8022e4:	ff 75 f4             	push   -0xc(%ebp)
+  8022e7:	e8 84 f7 ff ff       	call   801a70 <fd2num>
+  8022ec:	89 c3                	mov    %eax,%ebx
+  8022ee:	83 c4 10             	add    $0x10,%esp
+}
+  8022f1:	89 d8                	mov    %ebx,%eax
+  8022f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022f6:	5b                   	pop    %ebx
+  8022f7:	5e                   	pop    %esi
+  8022f8:	5d                   	pop    %ebp
+  8022f9:	c3                   	ret
+		fd_close(fd, 0);
+  8022fa:	83 ec 08             	sub    $0x8,%esp
+  8022fd:	6a 00                	push   $0x0
+  8022ff:	ff 75 f4             	push   -0xc(%ebp)
+  802302:	e8 80 f8 ff ff       	call   801b87 <fd_close>
+		return r;
+  802307:	83 c4 10             	add    $0x10,%esp
+  80230a:	eb e5                	jmp    8022f1 <open+0x6c>
+		return -E_BAD_PATH;
+  80230c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802311:	eb de                	jmp    8022f1 <open+0x6c>
+
+00802313 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802313:	55                   	push   %ebp
+  802314:	89 e5                	mov    %esp,%ebp
+  802316:	53                   	push   %ebx
+  802317:	83 ec 10             	sub    $0x10,%esp
+  80231a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80231d:	53                   	push   %ebx
+  80231e:	e8 d0 e6 ff ff       	call   8009f3 <strlen>
+  802323:	83 c4 10             	add    $0x10,%esp
+  802326:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80232b:	7f 25                	jg     802352 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80232d:	83 ec 08             	sub    $0x8,%esp
+  802330:	53                   	push   %ebx
+  802331:	68 00 00 81 00       	push   $0x810000
+  802336:	e8 f3 e6 ff ff       	call   800a2e <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80233b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802340:	b8 07 00 00 00       	mov    $0x7,%eax
+  802345:	e8 05 fd ff ff       	call   80204f <fsipc>
+  80234a:	83 c4 10             	add    $0x10,%esp
+}
+  80234d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802350:	c9                   	leave
+  802351:	c3                   	ret
+		return -E_BAD_PATH;
+  802352:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802357:	eb f4                	jmp    80234d <remove+0x3a>
+
+00802359 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802359:	55                   	push   %ebp
+  80235a:	89 e5                	mov    %esp,%ebp
+  80235c:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80235f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802364:	b8 08 00 00 00       	mov    $0x8,%eax
+  802369:	e8 e1 fc ff ff       	call   80204f <fsipc>
+}
+  80236e:	c9                   	leave
+  80236f:	c3                   	ret
+
+00802370 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  802370:	55                   	push   %ebp
+  802371:	89 e5                	mov    %esp,%ebp
+  802373:	53                   	push   %ebx
+  802374:	83 ec 04             	sub    $0x4,%esp
+  802377:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  80237a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80237f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802384:	e8 c6 fc ff ff       	call   80204f <fsipc>
+  802389:	85 c0                	test   %eax,%eax
+  80238b:	78 3c                	js     8023c9 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  80238d:	a1 00 00 81 00       	mov    0x810000,%eax
+  802392:	89 03                	mov    %eax,(%ebx)
+  802394:	a1 04 00 81 00       	mov    0x810004,%eax
+  802399:	89 43 04             	mov    %eax,0x4(%ebx)
+  80239c:	a1 08 00 81 00       	mov    0x810008,%eax
+  8023a1:	89 43 08             	mov    %eax,0x8(%ebx)
+  8023a4:	a1 0c 00 81 00       	mov    0x81000c,%eax
+  8023a9:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8023ac:	a1 10 00 81 00       	mov    0x810010,%eax
+  8023b1:	89 43 10             	mov    %eax,0x10(%ebx)
+  8023b4:	a1 14 00 81 00       	mov    0x810014,%eax
+  8023b9:	89 43 14             	mov    %eax,0x14(%ebx)
+  8023bc:	a1 18 00 81 00       	mov    0x810018,%eax
+  8023c1:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  8023c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023cc:	c9                   	leave
+  8023cd:	c3                   	ret
+
+008023ce <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  8023ce:	55                   	push   %ebp
+  8023cf:	89 e5                	mov    %esp,%ebp
+  8023d1:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  8023d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d7:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_BCSET, NULL);
+  8023dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8023e6:	e8 64 fc ff ff       	call   80204f <fsipc>
+}
+  8023eb:	c9                   	leave
+  8023ec:	c3                   	ret
+
+008023ed <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023ed:	55                   	push   %ebp
+  8023ee:	89 e5                	mov    %esp,%ebp
+  8023f0:	56                   	push   %esi
+  8023f1:	53                   	push   %ebx
+  8023f2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8023f5:	83 ec 0c             	sub    $0xc,%esp
+  8023f8:	ff 75 08             	push   0x8(%ebp)
+  8023fb:	e8 80 f6 ff ff       	call   801a80 <fd2data>
+  802400:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802402:	83 c4 08             	add    $0x8,%esp
+  802405:	68 d2 5c 80 00       	push   $0x805cd2
+  80240a:	53                   	push   %ebx
+  80240b:	e8 1e e6 ff ff       	call   800a2e <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802410:	8b 46 04             	mov    0x4(%esi),%eax
+  802413:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  802419:	2b 0e                	sub    (%esi),%ecx
+  80241b:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802420:	89 c8                	mov    %ecx,%eax
+  802422:	f7 e2                	mul    %edx
+  802424:	c1 ea 0c             	shr    $0xc,%edx
+  802427:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80242d:	29 d1                	sub    %edx,%ecx
+  80242f:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  802435:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80243c:	00 00 00 
+	stat->st_dev = &devpipe;
+  80243f:	c7 83 88 00 00 00 20 	movl   $0x807020,0x88(%ebx)
+  802446:	70 80 00 
+	return 0;
+}
+  802449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802451:	5b                   	pop    %ebx
+  802452:	5e                   	pop    %esi
+  802453:	5d                   	pop    %ebp
+  802454:	c3                   	ret
+
+00802455 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802455:	55                   	push   %ebp
+  802456:	89 e5                	mov    %esp,%ebp
+  802458:	53                   	push   %ebx
+  802459:	83 ec 0c             	sub    $0xc,%esp
+  80245c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80245f:	53                   	push   %ebx
+  802460:	6a 00                	push   $0x0
+  802462:	e8 3f eb ff ff       	call   800fa6 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802467:	89 1c 24             	mov    %ebx,(%esp)
+  80246a:	e8 11 f6 ff ff       	call   801a80 <fd2data>
+  80246f:	83 c4 08             	add    $0x8,%esp
+  802472:	50                   	push   %eax
+  802473:	6a 00                	push   $0x0
+  802475:	e8 2c eb ff ff       	call   800fa6 <sys_page_unmap>
+}
+  80247a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80247d:	c9                   	leave
+  80247e:	c3                   	ret
+
+0080247f <_pipeisclosed>:
+{
+  80247f:	55                   	push   %ebp
+  802480:	89 e5                	mov    %esp,%ebp
+  802482:	57                   	push   %edi
+  802483:	56                   	push   %esi
+  802484:	53                   	push   %ebx
+  802485:	83 ec 1c             	sub    $0x1c,%esp
+  802488:	89 c7                	mov    %eax,%edi
+  80248a:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80248c:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802491:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802494:	83 ec 0c             	sub    $0xc,%esp
+  802497:	57                   	push   %edi
+  802498:	e8 72 2e 00 00       	call   80530f <pageref>
+  80249d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024a0:	89 34 24             	mov    %esi,(%esp)
+  8024a3:	e8 67 2e 00 00       	call   80530f <pageref>
+		nn = thisenv->env_runs;
+  8024a8:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  8024ae:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8024b1:	83 c4 10             	add    $0x10,%esp
+  8024b4:	39 cb                	cmp    %ecx,%ebx
+  8024b6:	74 1b                	je     8024d3 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8024b8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024bb:	75 cf                	jne    80248c <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8024bd:	8b 42 58             	mov    0x58(%edx),%eax
+  8024c0:	6a 01                	push   $0x1
+  8024c2:	50                   	push   %eax
+  8024c3:	53                   	push   %ebx
+  8024c4:	68 d9 5c 80 00       	push   $0x805cd9
+  8024c9:	e8 79 df ff ff       	call   800447 <cprintf>
+  8024ce:	83 c4 10             	add    $0x10,%esp
+  8024d1:	eb b9                	jmp    80248c <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8024d3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024d6:	0f 94 c0             	sete   %al
+  8024d9:	0f b6 c0             	movzbl %al,%eax
+}
+  8024dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024df:	5b                   	pop    %ebx
+  8024e0:	5e                   	pop    %esi
+  8024e1:	5f                   	pop    %edi
+  8024e2:	5d                   	pop    %ebp
+  8024e3:	c3                   	ret
+
+008024e4 <devpipe_read>:
+{
+  8024e4:	55                   	push   %ebp
+  8024e5:	89 e5                	mov    %esp,%ebp
+  8024e7:	57                   	push   %edi
+  8024e8:	56                   	push   %esi
+  8024e9:	53                   	push   %ebx
+  8024ea:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8024ed:	ff 75 08             	push   0x8(%ebp)
+  8024f0:	e8 8b f5 ff ff       	call   801a80 <fd2data>
+  8024f5:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8024f7:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8024fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8024fd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802500:	8b 7b 04             	mov    0x4(%ebx),%edi
+  802503:	8b 0b                	mov    (%ebx),%ecx
+  802505:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  80250b:	29 ce                	sub    %ecx,%esi
+  80250d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802512:	f7 e6                	mul    %esi
+  802514:	c1 ea 0c             	shr    $0xc,%edx
+  802517:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  80251d:	29 c6                	sub    %eax,%esi
+  80251f:	89 f2                	mov    %esi,%edx
+  802521:	75 43                	jne    802566 <devpipe_read+0x82>
+		ref = pageref(p);
+  802523:	83 ec 0c             	sub    $0xc,%esp
+  802526:	53                   	push   %ebx
+  802527:	e8 e3 2d 00 00       	call   80530f <pageref>
+  80252c:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  80252e:	89 da                	mov    %ebx,%edx
+  802530:	8b 45 08             	mov    0x8(%ebp),%eax
+  802533:	e8 47 ff ff ff       	call   80247f <_pipeisclosed>
+  802538:	83 c4 10             	add    $0x10,%esp
+  80253b:	85 c0                	test   %eax,%eax
+  80253d:	0f 85 c1 00 00 00    	jne    802604 <devpipe_read+0x120>
+	*sleeping = 1;
+  802543:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  80254a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80254f:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  802552:	75 ac                	jne    802500 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  802554:	83 ec 04             	sub    $0x4,%esp
+  802557:	56                   	push   %esi
+  802558:	57                   	push   %edi
+  802559:	ff 75 e4             	push   -0x1c(%ebp)
+  80255c:	e8 99 ee ff ff       	call   8013fa <sys_futex_wait>
+  802561:	83 c4 10             	add    $0x10,%esp
+  802564:	eb 9a                	jmp    802500 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  802566:	39 75 10             	cmp    %esi,0x10(%ebp)
+  802569:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  80256d:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80256f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802574:	f7 e1                	mul    %ecx
+  802576:	c1 ea 0b             	shr    $0xb,%edx
+  802579:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80257f:	29 c1                	sub    %eax,%ecx
+  802581:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  802583:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802588:	29 cf                	sub    %ecx,%edi
+  80258a:	39 f7                	cmp    %esi,%edi
+  80258c:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  80258f:	8d 43 10             	lea    0x10(%ebx),%eax
+  802592:	83 ec 04             	sub    $0x4,%esp
+  802595:	57                   	push   %edi
+  802596:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802599:	01 c2                	add    %eax,%edx
+  80259b:	52                   	push   %edx
+  80259c:	ff 75 0c             	push   0xc(%ebp)
+  80259f:	e8 10 e6 ff ff       	call   800bb4 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  8025a4:	83 c4 0c             	add    $0xc,%esp
+  8025a7:	89 f1                	mov    %esi,%ecx
+  8025a9:	29 f9                	sub    %edi,%ecx
+  8025ab:	51                   	push   %ecx
+  8025ac:	ff 75 e4             	push   -0x1c(%ebp)
+  8025af:	89 f8                	mov    %edi,%eax
+  8025b1:	03 45 0c             	add    0xc(%ebp),%eax
+  8025b4:	50                   	push   %eax
+  8025b5:	e8 fa e5 ff ff       	call   800bb4 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  8025ba:	89 f1                	mov    %esi,%ecx
+  8025bc:	03 0b                	add    (%ebx),%ecx
+  8025be:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8025c3:	f7 e1                	mul    %ecx
+  8025c5:	c1 ea 0c             	shr    $0xc,%edx
+  8025c8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8025ce:	29 d1                	sub    %edx,%ecx
+  8025d0:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  8025d2:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8025d7:	83 c4 10             	add    $0x10,%esp
+  8025da:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  8025de:	75 0a                	jne    8025ea <devpipe_read+0x106>
+	return n;
+  8025e0:	89 f0                	mov    %esi,%eax
+}
+  8025e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025e5:	5b                   	pop    %ebx
+  8025e6:	5e                   	pop    %esi
+  8025e7:	5f                   	pop    %edi
+  8025e8:	5d                   	pop    %ebp
+  8025e9:	c3                   	ret
+		*sleeping = 0;
+  8025ea:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8025f1:	83 ec 08             	sub    $0x8,%esp
+  8025f4:	68 00 04 00 00       	push   $0x400
+  8025f9:	53                   	push   %ebx
+  8025fa:	e8 4b ee ff ff       	call   80144a <sys_futex_wake>
+  8025ff:	83 c4 10             	add    $0x10,%esp
+  802602:	eb dc                	jmp    8025e0 <devpipe_read+0xfc>
+			return 0;
+  802604:	b8 00 00 00 00       	mov    $0x0,%eax
+  802609:	eb d7                	jmp    8025e2 <devpipe_read+0xfe>
+
+0080260b <devpipe_write>:
+{
+  80260b:	55                   	push   %ebp
+  80260c:	89 e5                	mov    %esp,%ebp
+  80260e:	57                   	push   %edi
+  80260f:	56                   	push   %esi
+  802610:	53                   	push   %ebx
+  802611:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802614:	ff 75 08             	push   0x8(%ebp)
+  802617:	e8 64 f4 ff ff       	call   801a80 <fd2data>
+  80261c:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  80261e:	83 c4 10             	add    $0x10,%esp
+  802621:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802628:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80262b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80262e:	0f 83 23 01 00 00    	jae    802757 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802634:	8b 77 04             	mov    0x4(%edi),%esi
+  802637:	8b 1f                	mov    (%edi),%ebx
+  802639:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  80263f:	29 d9                	sub    %ebx,%ecx
+  802641:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802646:	f7 e1                	mul    %ecx
+  802648:	c1 ea 0c             	shr    $0xc,%edx
+  80264b:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802651:	29 c1                	sub    %eax,%ecx
+  802653:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802655:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80265b:	75 40                	jne    80269d <devpipe_write+0x92>
+			ref = pageref(p);
+  80265d:	83 ec 0c             	sub    $0xc,%esp
+  802660:	57                   	push   %edi
+  802661:	e8 a9 2c 00 00       	call   80530f <pageref>
+  802666:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  802668:	89 fa                	mov    %edi,%edx
+  80266a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80266d:	e8 0d fe ff ff       	call   80247f <_pipeisclosed>
+  802672:	83 c4 10             	add    $0x10,%esp
+  802675:	85 c0                	test   %eax,%eax
+  802677:	0f 85 d5 00 00 00    	jne    802752 <devpipe_write+0x147>
+	*sleeping = 1;
+  80267d:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  802684:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802689:	39 1f                	cmp    %ebx,(%edi)
+  80268b:	75 a7                	jne    802634 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  80268d:	83 ec 04             	sub    $0x4,%esp
+  802690:	56                   	push   %esi
+  802691:	53                   	push   %ebx
+  802692:	57                   	push   %edi
+  802693:	e8 62 ed ff ff       	call   8013fa <sys_futex_wait>
+  802698:	83 c4 10             	add    $0x10,%esp
+  80269b:	eb 97                	jmp    802634 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80269d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8026a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026a3:	29 c1                	sub    %eax,%ecx
+  8026a5:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8026aa:	89 d8                	mov    %ebx,%eax
+  8026ac:	29 d0                	sub    %edx,%eax
+  8026ae:	39 c1                	cmp    %eax,%ecx
+  8026b0:	0f 46 c1             	cmovbe %ecx,%eax
+  8026b3:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  8026b5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8026ba:	f7 e6                	mul    %esi
+  8026bc:	c1 ea 0b             	shr    $0xb,%edx
+  8026bf:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8026c5:	29 c6                	sub    %eax,%esi
+  8026c7:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8026c9:	29 f3                	sub    %esi,%ebx
+  8026cb:	39 cb                	cmp    %ecx,%ebx
+  8026cd:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8026d0:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  8026d3:	8d 77 10             	lea    0x10(%edi),%esi
+  8026d6:	83 ec 04             	sub    $0x4,%esp
+  8026d9:	53                   	push   %ebx
+  8026da:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026dd:	03 45 0c             	add    0xc(%ebp),%eax
+  8026e0:	50                   	push   %eax
+  8026e1:	01 f2                	add    %esi,%edx
+  8026e3:	52                   	push   %edx
+  8026e4:	e8 cb e4 ff ff       	call   800bb4 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8026e9:	83 c4 0c             	add    $0xc,%esp
+  8026ec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8026ef:	29 d8                	sub    %ebx,%eax
+  8026f1:	50                   	push   %eax
+  8026f2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8026f5:	01 d3                	add    %edx,%ebx
+  8026f7:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8026fa:	53                   	push   %ebx
+  8026fb:	56                   	push   %esi
+  8026fc:	e8 b3 e4 ff ff       	call   800bb4 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802701:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802704:	03 4f 04             	add    0x4(%edi),%ecx
+  802707:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80270c:	f7 e1                	mul    %ecx
+  80270e:	c1 ea 0c             	shr    $0xc,%edx
+  802711:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802717:	29 d1                	sub    %edx,%ecx
+  802719:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  80271c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802721:	83 c4 10             	add    $0x10,%esp
+  802724:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802728:	75 0b                	jne    802735 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  80272a:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  80272d:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802730:	e9 f3 fe ff ff       	jmp    802628 <devpipe_write+0x1d>
+		*sleeping = 0;
+  802735:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  80273c:	83 ec 08             	sub    $0x8,%esp
+  80273f:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802744:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802747:	50                   	push   %eax
+  802748:	e8 fd ec ff ff       	call   80144a <sys_futex_wake>
+  80274d:	83 c4 10             	add    $0x10,%esp
+  802750:	eb d8                	jmp    80272a <devpipe_write+0x11f>
+				return 0;
+  802752:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802757:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80275a:	5b                   	pop    %ebx
+  80275b:	5e                   	pop    %esi
+  80275c:	5f                   	pop    %edi
+  80275d:	5d                   	pop    %ebp
+  80275e:	c3                   	ret
+
+0080275f <pipe>:
+{
+  80275f:	55                   	push   %ebp
+  802760:	89 e5                	mov    %esp,%ebp
+  802762:	56                   	push   %esi
+  802763:	53                   	push   %ebx
+  802764:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802767:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80276a:	50                   	push   %eax
+  80276b:	e8 27 f3 ff ff       	call   801a97 <fd_alloc>
+  802770:	89 c3                	mov    %eax,%ebx
+  802772:	83 c4 10             	add    $0x10,%esp
+  802775:	85 c0                	test   %eax,%eax
+  802777:	0f 88 23 01 00 00    	js     8028a0 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80277d:	83 ec 04             	sub    $0x4,%esp
+  802780:	68 07 04 00 00       	push   $0x407
+  802785:	ff 75 f4             	push   -0xc(%ebp)
+  802788:	6a 00                	push   $0x0
+  80278a:	e8 92 e7 ff ff       	call   800f21 <sys_page_alloc>
+  80278f:	89 c3                	mov    %eax,%ebx
+  802791:	83 c4 10             	add    $0x10,%esp
+  802794:	85 c0                	test   %eax,%eax
+  802796:	0f 88 04 01 00 00    	js     8028a0 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80279c:	83 ec 0c             	sub    $0xc,%esp
+  80279f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8027a2:	50                   	push   %eax
+  8027a3:	e8 ef f2 ff ff       	call   801a97 <fd_alloc>
+  8027a8:	89 c3                	mov    %eax,%ebx
+  8027aa:	83 c4 10             	add    $0x10,%esp
+  8027ad:	85 c0                	test   %eax,%eax
+  8027af:	0f 88 db 00 00 00    	js     802890 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027b5:	83 ec 04             	sub    $0x4,%esp
+  8027b8:	68 07 04 00 00       	push   $0x407
+  8027bd:	ff 75 f0             	push   -0x10(%ebp)
+  8027c0:	6a 00                	push   $0x0
+  8027c2:	e8 5a e7 ff ff       	call   800f21 <sys_page_alloc>
+  8027c7:	89 c3                	mov    %eax,%ebx
+  8027c9:	83 c4 10             	add    $0x10,%esp
+  8027cc:	85 c0                	test   %eax,%eax
+  8027ce:	0f 88 bc 00 00 00    	js     802890 <pipe+0x131>
+	va = fd2data(fd0);
+  8027d4:	83 ec 0c             	sub    $0xc,%esp
+  8027d7:	ff 75 f4             	push   -0xc(%ebp)
+  8027da:	e8 a1 f2 ff ff       	call   801a80 <fd2data>
+  8027df:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027e1:	83 c4 0c             	add    $0xc,%esp
+  8027e4:	68 07 04 00 00       	push   $0x407
+  8027e9:	50                   	push   %eax
+  8027ea:	6a 00                	push   $0x0
+  8027ec:	e8 30 e7 ff ff       	call   800f21 <sys_page_alloc>
+  8027f1:	89 c3                	mov    %eax,%ebx
+  8027f3:	83 c4 10             	add    $0x10,%esp
+  8027f6:	85 c0                	test   %eax,%eax
+  8027f8:	0f 88 82 00 00 00    	js     802880 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027fe:	83 ec 0c             	sub    $0xc,%esp
+  802801:	ff 75 f0             	push   -0x10(%ebp)
+  802804:	e8 77 f2 ff ff       	call   801a80 <fd2data>
+  802809:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802810:	50                   	push   %eax
+  802811:	6a 00                	push   $0x0
+  802813:	56                   	push   %esi
+  802814:	6a 00                	push   $0x0
+  802816:	e8 49 e7 ff ff       	call   800f64 <sys_page_map>
+  80281b:	89 c3                	mov    %eax,%ebx
+  80281d:	83 c4 20             	add    $0x20,%esp
+  802820:	85 c0                	test   %eax,%eax
+  802822:	78 4e                	js     802872 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802824:	a1 20 70 80 00       	mov    0x807020,%eax
+  802829:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80282c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80282e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802831:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802838:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80283b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80283d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802840:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802847:	83 ec 0c             	sub    $0xc,%esp
+  80284a:	ff 75 f4             	push   -0xc(%ebp)
+  80284d:	e8 1e f2 ff ff       	call   801a70 <fd2num>
+  802852:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802855:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802857:	83 c4 04             	add    $0x4,%esp
+  80285a:	ff 75 f0             	push   -0x10(%ebp)
+  80285d:	e8 0e f2 ff ff       	call   801a70 <fd2num>
+  802862:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802865:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802868:	83 c4 10             	add    $0x10,%esp
+  80286b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802870:	eb 2e                	jmp    8028a0 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802872:	83 ec 08             	sub    $0x8,%esp
+  802875:	56                   	push   %esi
+  802876:	6a 00                	push   $0x0
+  802878:	e8 29 e7 ff ff       	call   800fa6 <sys_page_unmap>
+  80287d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802880:	83 ec 08             	sub    $0x8,%esp
+  802883:	ff 75 f0             	push   -0x10(%ebp)
+  802886:	6a 00                	push   $0x0
+  802888:	e8 19 e7 ff ff       	call   800fa6 <sys_page_unmap>
+  80288d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802890:	83 ec 08             	sub    $0x8,%esp
+  802893:	ff 75 f4             	push   -0xc(%ebp)
+  802896:	6a 00                	push   $0x0
+  802898:	e8 09 e7 ff ff       	call   800fa6 <sys_page_unmap>
+  80289d:	83 c4 10             	add    $0x10,%esp
+}
+  8028a0:	89 d8                	mov    %ebx,%eax
+  8028a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028a5:	5b                   	pop    %ebx
+  8028a6:	5e                   	pop    %esi
+  8028a7:	5d                   	pop    %ebp
+  8028a8:	c3                   	ret
+
+008028a9 <pipeisclosed>:
+{
+  8028a9:	55                   	push   %ebp
+  8028aa:	89 e5                	mov    %esp,%ebp
+  8028ac:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8028af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028b2:	50                   	push   %eax
+  8028b3:	ff 75 08             	push   0x8(%ebp)
+  8028b6:	e8 30 f2 ff ff       	call   801aeb <fd_lookup>
+  8028bb:	83 c4 10             	add    $0x10,%esp
+  8028be:	85 c0                	test   %eax,%eax
+  8028c0:	78 18                	js     8028da <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8028c2:	83 ec 0c             	sub    $0xc,%esp
+  8028c5:	ff 75 f4             	push   -0xc(%ebp)
+  8028c8:	e8 b3 f1 ff ff       	call   801a80 <fd2data>
+  8028cd:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8028cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028d2:	e8 a8 fb ff ff       	call   80247f <_pipeisclosed>
+  8028d7:	83 c4 10             	add    $0x10,%esp
+}
+  8028da:	c9                   	leave
+  8028db:	c3                   	ret
+
+008028dc <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8028dc:	55                   	push   %ebp
+  8028dd:	89 e5                	mov    %esp,%ebp
+  8028df:	57                   	push   %edi
+  8028e0:	56                   	push   %esi
+  8028e1:	53                   	push   %ebx
+  8028e2:	83 ec 0c             	sub    $0xc,%esp
+  8028e5:	8b 7d 08             	mov    0x8(%ebp),%edi
+	const volatile struct Env *e;
+	unsigned status;
+
+	assert(envid != 0);
+  8028e8:	85 ff                	test   %edi,%edi
+  8028ea:	74 21                	je     80290d <wait+0x31>
+	e = &envs[ENVX(envid)];
+  8028ec:	89 f8                	mov    %edi,%eax
+  8028ee:	25 ff 03 00 00       	and    $0x3ff,%eax
+	// The kernel wakes us when it frees the environment.  Until then
+	// we sleep, unless its status changed since we looked.
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  8028f3:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  8028f6:	c1 e6 06             	shl    $0x6,%esi
+  8028f9:	81 c6 54 00 c0 ee    	add    $0xeec00054,%esi
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  8028ff:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  802902:	c1 e3 06             	shl    $0x6,%ebx
+  802905:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  80290b:	eb 25                	jmp    802932 <wait+0x56>
+	assert(envid != 0);
+  80290d:	68 f1 5c 80 00       	push   $0x805cf1
+  802912:	68 6a 55 80 00       	push   $0x80556a
+  802917:	6a 0a                	push   $0xa
+  802919:	68 fc 5c 80 00       	push   $0x805cfc
+  80291e:	e8 49 da ff ff       	call   80036c <_panic>
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  802923:	83 ec 04             	sub    $0x4,%esp
+  802926:	6a ff                	push   $0xffffffff
+  802928:	50                   	push   %eax
+  802929:	56                   	push   %esi
+  80292a:	e8 cb ea ff ff       	call   8013fa <sys_futex_wait>
+  80292f:	83 c4 10             	add    $0x10,%esp
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  802932:	8b 43 48             	mov    0x48(%ebx),%eax
+  802935:	39 f8                	cmp    %edi,%eax
+  802937:	75 07                	jne    802940 <wait+0x64>
+  802939:	8b 43 54             	mov    0x54(%ebx),%eax
+  80293c:	85 c0                	test   %eax,%eax
+  80293e:	75 e3                	jne    802923 <wait+0x47>
+}
+  802940:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802943:	5b                   	pop    %ebx
+  802944:	5e                   	pop    %esi
+  802945:	5f                   	pop    %edi
+  802946:	5d                   	pop    %ebp
+  802947:	c3                   	ret
+
+00802948 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802948:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  80294a:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  802950:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802956:	81 c2 34 01 00 00    	add    $0x134,%edx
+  80295c:	39 d0                	cmp    %edx,%eax
+  80295e:	74 2e                	je     80298e <segment_lookup+0x46>
+{
+  802960:	55                   	push   %ebp
+  802961:	89 e5                	mov    %esp,%ebp
+  802963:	57                   	push   %edi
+  802964:	56                   	push   %esi
+  802965:	53                   	push   %ebx
+  802966:	eb 07                	jmp    80296f <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802968:	83 c0 20             	add    $0x20,%eax
+  80296b:	39 d0                	cmp    %edx,%eax
+  80296d:	74 15                	je     802984 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  80296f:	8b 18                	mov    (%eax),%ebx
+  802971:	39 d9                	cmp    %ebx,%ecx
+  802973:	72 f3                	jb     802968 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  802975:	8b 38                	mov    (%eax),%edi
+  802977:	8b 58 04             	mov    0x4(%eax),%ebx
+  80297a:	89 ce                	mov    %ecx,%esi
+  80297c:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  80297e:	39 de                	cmp    %ebx,%esi
+  802980:	73 e6                	jae    802968 <segment_lookup+0x20>
+  802982:	eb 05                	jmp    802989 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  802984:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802989:	5b                   	pop    %ebx
+  80298a:	5e                   	pop    %esi
+  80298b:	5f                   	pop    %edi
+  80298c:	5d                   	pop    %ebp
+  80298d:	c3                   	ret
+	return NULL;
+  80298e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802993:	c3                   	ret
+
+00802994 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802994:	55                   	push   %ebp
+  802995:	89 e5                	mov    %esp,%ebp
+  802997:	53                   	push   %ebx
+  802998:	83 ec 04             	sub    $0x4,%esp
+  80299b:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80299d:	c1 e8 16             	shr    $0x16,%eax
+  8029a0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8029a7:	25 81 00 00 00       	and    $0x81,%eax
+  8029ac:	83 f8 01             	cmp    $0x1,%eax
+  8029af:	75 6b                	jne    802a1c <page_is_clean+0x88>
+  8029b1:	89 da                	mov    %ebx,%edx
+  8029b3:	c1 ea 0c             	shr    $0xc,%edx
+  8029b6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  8029bd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8029c2:	f6 c1 01             	test   $0x1,%cl
+  8029c5:	74 5a                	je     802a21 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  8029c7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8029ce:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  8029d4:	75 4b                	jne    802a21 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  8029d6:	89 d8                	mov    %ebx,%eax
+  8029d8:	e8 6b ff ff ff       	call   802948 <segment_lookup>
+  8029dd:	89 c2                	mov    %eax,%edx
+		return 1;
+  8029df:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  8029e4:	85 d2                	test   %edx,%edx
+  8029e6:	75 39                	jne    802a21 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  8029e8:	8b 15 0c c0 80 00    	mov    0x80c00c,%edx
+  8029ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f3:	eb 03                	jmp    8029f8 <page_is_clean+0x64>
+  8029f5:	83 c0 01             	add    $0x1,%eax
+  8029f8:	39 c2                	cmp    %eax,%edx
+  8029fa:	7e 19                	jle    802a15 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  8029fc:	3b 1c c5 20 c0 80 00 	cmp    0x80c020(,%eax,8),%ebx
+  802a03:	72 f0                	jb     8029f5 <page_is_clean+0x61>
+  802a05:	3b 1c c5 24 c0 80 00 	cmp    0x80c024(,%eax,8),%ebx
+  802a0c:	73 e7                	jae    8029f5 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  802a0e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a13:	eb 0c                	jmp    802a21 <page_is_clean+0x8d>
+	return 0;
+  802a15:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a1a:	eb 05                	jmp    802a21 <page_is_clean+0x8d>
+		return 0;
+  802a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a24:	c9                   	leave
+  802a25:	c3                   	ret
+
+00802a26 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  802a26:	55                   	push   %ebp
+  802a27:	89 e5                	mov    %esp,%ebp
+  802a29:	57                   	push   %edi
+  802a2a:	56                   	push   %esi
+  802a2b:	53                   	push   %ebx
+  802a2c:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802a2f:	be 00 00 00 00       	mov    $0x0,%esi
+  802a34:	eb 19                	jmp    802a4f <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802a36:	f7 d3                	not    %ebx
+  802a38:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802a3e:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802a40:	83 c6 01             	add    $0x1,%esi
+  802a43:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802a49:	0f 87 97 00 00 00    	ja     802ae6 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802a4f:	89 f3                	mov    %esi,%ebx
+  802a51:	03 1d 34 90 80 00    	add    0x809034,%ebx
+  802a57:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802a5d:	89 d8                	mov    %ebx,%eax
+  802a5f:	c1 e8 0a             	shr    $0xa,%eax
+  802a62:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802a69:	25 81 00 00 00       	and    $0x81,%eax
+  802a6e:	83 f8 01             	cmp    $0x1,%eax
+  802a71:	75 c3                	jne    802a36 <linear_walk+0x10>
+  802a73:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802a79:	77 bb                	ja     802a36 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802a7b:	89 df                	mov    %ebx,%edi
+  802a7d:	c1 e7 0c             	shl    $0xc,%edi
+  802a80:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802a83:	89 f8                	mov    %edi,%eax
+  802a85:	e8 0a ff ff ff       	call   802994 <page_is_clean>
+  802a8a:	84 c0                	test   %al,%al
+  802a8c:	75 64                	jne    802af2 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a8e:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802a94:	77 aa                	ja     802a40 <linear_walk+0x1a>
+  802a96:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  802a9c:	72 a2                	jb     802a40 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802a9e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802aa5:	a8 01                	test   $0x1,%al
+  802aa7:	74 97                	je     802a40 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802aa9:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802ab0:	f6 c4 04             	test   $0x4,%ah
+  802ab3:	75 8b                	jne    802a40 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802ab5:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802abc:	f6 c4 02             	test   $0x2,%ah
+  802abf:	0f 85 7b ff ff ff    	jne    802a40 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802ac5:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802acc:	c1 e8 0c             	shr    $0xc,%eax
+  802acf:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802ad2:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802ad7:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802adb:	66 83 f8 01          	cmp    $0x1,%ax
+  802adf:	76 11                	jbe    802af2 <linear_walk+0xcc>
+  802ae1:	e9 5a ff ff ff       	jmp    802a40 <linear_walk+0x1a>
+  802ae6:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  802aeb:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802af2:	89 1d 34 90 80 00    	mov    %ebx,0x809034
+}
+  802af8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802afb:	83 c4 1c             	add    $0x1c,%esp
+  802afe:	5b                   	pop    %ebx
+  802aff:	5e                   	pop    %esi
+  802b00:	5f                   	pop    %edi
+  802b01:	5d                   	pop    %ebp
+  802b02:	c3                   	ret
+
+00802b03 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802b03:	55                   	push   %ebp
+  802b04:	89 e5                	mov    %esp,%ebp
+  802b06:	56                   	push   %esi
+  802b07:	53                   	push   %ebx
+  802b08:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  802b0a:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802b0f:	83 e0 7f             	and    $0x7f,%eax
+  802b12:	c1 e0 04             	shl    $0x4,%eax
+  802b15:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  802b1b:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802b21:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802b27:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  802b2d:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802b32:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  802b35:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802b3a:	83 c0 01             	add    $0x1,%eax
+  802b3d:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  802b42:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802b45:	5b                   	pop    %ebx
+  802b46:	5e                   	pop    %esi
+  802b47:	5d                   	pop    %ebp
+  802b48:	c3                   	ret
+
+00802b49 <page_ring_enter>:
+{
+  802b49:	55                   	push   %ebp
+  802b4a:	89 e5                	mov    %esp,%ebp
+  802b4c:	57                   	push   %edi
+  802b4d:	56                   	push   %esi
+  802b4e:	53                   	push   %ebx
+  802b4f:	83 ec 18             	sub    $0x18,%esp
+  802b52:	89 c6                	mov    %eax,%esi
+  802b54:	89 d7                	mov    %edx,%edi
+  802b56:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802b58:	6a 00                	push   $0x0
+  802b5a:	6a 00                	push   $0x0
+  802b5c:	6a 00                	push   $0x0
+  802b5e:	6a 07                	push   $0x7
+  802b60:	ff 35 40 c0 80 00    	push   0x80c040
+  802b66:	e8 8e 26 00 00       	call   8051f9 <ipc_call>
+  802b6b:	83 c4 20             	add    $0x20,%esp
+  802b6e:	85 c0                	test   %eax,%eax
+  802b70:	79 22                	jns    802b94 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802b72:	50                   	push   %eax
+  802b73:	68 07 5d 80 00       	push   $0x805d07
+  802b78:	68 13 02 00 00       	push   $0x213
+  802b7d:	68 1b 5d 80 00       	push   $0x805d1b
+  802b82:	e8 e5 d7 ff ff       	call   80036c <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802b87:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802b8c:	83 c0 01             	add    $0x1,%eax
+  802b8f:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802b94:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802b9a:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802b9f:	39 c2                	cmp    %eax,%edx
+  802ba1:	74 24                	je     802bc7 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802ba3:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802ba8:	83 e0 7f             	and    $0x7f,%eax
+  802bab:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802bb2:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802bb9:	29 f0                	sub    %esi,%eax
+  802bbb:	39 d8                	cmp    %ebx,%eax
+  802bbd:	73 c8                	jae    802b87 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802bbf:	8b 52 04             	mov    0x4(%edx),%edx
+  802bc2:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802bc5:	eb c0                	jmp    802b87 <page_ring_enter+0x3e>
+}
+  802bc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bca:	5b                   	pop    %ebx
+  802bcb:	5e                   	pop    %esi
+  802bcc:	5f                   	pop    %edi
+  802bcd:	5d                   	pop    %ebp
+  802bce:	c3                   	ret
+
+00802bcf <page_ring_reserve>:
+{
+  802bcf:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802bd1:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802bd6:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802bdc:	29 d0                	sub    %edx,%eax
+  802bde:	ba 80 00 00 00       	mov    $0x80,%edx
+  802be3:	29 ca                	sub    %ecx,%edx
+  802be5:	39 c2                	cmp    %eax,%edx
+  802be7:	72 01                	jb     802bea <page_ring_reserve+0x1b>
+  802be9:	c3                   	ret
+{
+  802bea:	55                   	push   %ebp
+  802beb:	89 e5                	mov    %esp,%ebp
+  802bed:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802bf0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bf5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bff:	e8 45 ff ff ff       	call   802b49 <page_ring_enter>
+}
+  802c04:	c9                   	leave
+  802c05:	c3                   	ret
+
+00802c06 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802c06:	55                   	push   %ebp
+  802c07:	89 e5                	mov    %esp,%ebp
+  802c09:	53                   	push   %ebx
+  802c0a:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802c0d:	6a 07                	push   $0x7
+  802c0f:	6a 01                	push   $0x1
+  802c11:	89 c3                	mov    %eax,%ebx
+  802c13:	c1 e3 0c             	shl    $0xc,%ebx
+  802c16:	8d 93 00 a0 80 00    	lea    0x80a000(%ebx),%edx
+  802c1c:	52                   	push   %edx
+  802c1d:	6a 04                	push   $0x4
+  802c1f:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  802c26:	e8 ce 25 00 00       	call   8051f9 <ipc_call>
+	sharereqs[i].nslots = 0;
+  802c2b:	c7 83 00 a0 80 00 00 	movl   $0x0,0x80a000(%ebx)
+  802c32:	00 00 00 
+	return r;
+}
+  802c35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c38:	c9                   	leave
+  802c39:	c3                   	ret
+
+00802c3a <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802c3a:	55                   	push   %ebp
+  802c3b:	89 e5                	mov    %esp,%ebp
+  802c3d:	56                   	push   %esi
+  802c3e:	53                   	push   %ebx
+  802c3f:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802c41:	c1 e8 10             	shr    $0x10,%eax
+  802c44:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802c47:	89 c2                	mov    %eax,%edx
+  802c49:	c1 e2 0c             	shl    $0xc,%edx
+  802c4c:	8b b2 00 a0 80 00    	mov    0x80a000(%edx),%esi
+  802c52:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802c55:	89 9a 00 a0 80 00    	mov    %ebx,0x80a000(%edx)
+  802c5b:	89 c2                	mov    %eax,%edx
+  802c5d:	c1 e2 0a             	shl    $0xa,%edx
+  802c60:	01 f2                	add    %esi,%edx
+  802c62:	89 0c 95 04 a0 80 00 	mov    %ecx,0x80a004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802c69:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802c6f:	74 09                	je     802c7a <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802c71:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c76:	5b                   	pop    %ebx
+  802c77:	5e                   	pop    %esi
+  802c78:	5d                   	pop    %ebp
+  802c79:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802c7a:	e8 87 ff ff ff       	call   802c06 <page_share_send>
+  802c7f:	eb f5                	jmp    802c76 <page_share_slot+0x3c>
+
+00802c81 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802c81:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802c86:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802c89:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802c8e:	3b 15 00 c0 80 00    	cmp    0x80c000,%edx
+  802c94:	74 09                	je     802c9f <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802c96:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  802c9b:	85 c0                	test   %eax,%eax
+  802c9d:	75 01                	jne    802ca0 <page_ring_ready+0x1f>
+}
+  802c9f:	c3                   	ret
+{
+  802ca0:	55                   	push   %ebp
+  802ca1:	89 e5                	mov    %esp,%ebp
+  802ca3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802ca6:	68 07 06 00 00       	push   $0x607
+  802cab:	6a 08                	push   $0x8
+  802cad:	68 00 30 ad de       	push   $0xdead3000
+  802cb2:	6a 00                	push   $0x0
+  802cb4:	e8 93 e3 ff ff       	call   80104c <sys_page_alloc_range>
+  802cb9:	83 c4 10             	add    $0x10,%esp
+  802cbc:	83 f8 08             	cmp    $0x8,%eax
+  802cbf:	74 1b                	je     802cdc <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802cc1:	83 ec 04             	sub    $0x4,%esp
+  802cc4:	6a 08                	push   $0x8
+  802cc6:	68 00 30 ad de       	push   $0xdead3000
+  802ccb:	6a 00                	push   $0x0
+  802ccd:	e8 e8 e3 ff ff       	call   8010ba <sys_page_unmap_range>
+		return 0;
+  802cd2:	83 c4 10             	add    $0x10,%esp
+  802cd5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cda:	c9                   	leave
+  802cdb:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802cdc:	83 ec 0c             	sub    $0xc,%esp
+  802cdf:	68 07 04 00 00       	push   $0x407
+  802ce4:	6a 08                	push   $0x8
+  802ce6:	68 00 30 ad de       	push   $0xdead3000
+  802ceb:	6a 06                	push   $0x6
+  802ced:	ff 35 40 c0 80 00    	push   0x80c040
+  802cf3:	e8 01 25 00 00       	call   8051f9 <ipc_call>
+  802cf8:	83 c4 20             	add    $0x20,%esp
+  802cfb:	85 c0                	test   %eax,%eax
+  802cfd:	78 14                	js     802d13 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802cff:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802d04:	8b 40 48             	mov    0x48(%eax),%eax
+  802d07:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	return 1;
+  802d0c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d11:	eb c7                	jmp    802cda <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802d13:	83 ec 04             	sub    $0x4,%esp
+  802d16:	6a 08                	push   $0x8
+  802d18:	68 00 30 ad de       	push   $0xdead3000
+  802d1d:	6a 00                	push   $0x0
+  802d1f:	e8 96 e3 ff ff       	call   8010ba <sys_page_unmap_range>
+		return 0;
+  802d24:	83 c4 10             	add    $0x10,%esp
+  802d27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2c:	eb ac                	jmp    802cda <page_ring_ready+0x59>
+
+00802d2e <page_remove_slot>:
+{
+  802d2e:	55                   	push   %ebp
+  802d2f:	89 e5                	mov    %esp,%ebp
+  802d31:	56                   	push   %esi
+  802d32:	53                   	push   %ebx
+  802d33:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802d35:	89 c6                	mov    %eax,%esi
+  802d37:	c1 ee 10             	shr    $0x10,%esi
+  802d3a:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802d3d:	8b 04 b5 44 c0 80 00 	mov    0x80c044(,%esi,4),%eax
+  802d44:	39 05 40 c0 80 00    	cmp    %eax,0x80c040
+  802d4a:	74 2a                	je     802d76 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802d4c:	83 ec 0c             	sub    $0xc,%esp
+  802d4f:	6a 00                	push   $0x0
+  802d51:	6a 00                	push   $0x0
+  802d53:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802d55:	c1 e3 04             	shl    $0x4,%ebx
+  802d58:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802d5b:	53                   	push   %ebx
+  802d5c:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  802d63:	e8 91 24 00 00       	call   8051f9 <ipc_call>
+  802d68:	83 c4 20             	add    $0x20,%esp
+  802d6b:	85 c0                	test   %eax,%eax
+  802d6d:	78 2d                	js     802d9c <page_remove_slot+0x6e>
+}
+  802d6f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d72:	5b                   	pop    %ebx
+  802d73:	5e                   	pop    %esi
+  802d74:	5d                   	pop    %ebp
+  802d75:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802d76:	e8 06 ff ff ff       	call   802c81 <page_ring_ready>
+  802d7b:	85 c0                	test   %eax,%eax
+  802d7d:	74 cd                	je     802d4c <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802d7f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d84:	e8 46 fe ff ff       	call   802bcf <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802d89:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d8e:	89 da                	mov    %ebx,%edx
+  802d90:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d95:	e8 69 fd ff ff       	call   802b03 <page_ring_post>
+		return;
+  802d9a:	eb d3                	jmp    802d6f <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802d9c:	50                   	push   %eax
+  802d9d:	68 74 5d 80 00       	push   $0x805d74
+  802da2:	68 ac 03 00 00       	push   $0x3ac
+  802da7:	68 1b 5d 80 00       	push   $0x805d1b
+  802dac:	e8 bb d5 ff ff       	call   80036c <_panic>
+
+00802db1 <find_paging_env>:
+	if(pagingenv)
+  802db1:	a1 40 c0 80 00       	mov    0x80c040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802db6:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802db8:	85 c0                	test   %eax,%eax
+  802dba:	74 05                	je     802dc1 <find_paging_env+0x10>
+  802dbc:	eb 56                	jmp    802e14 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802dbe:	83 c0 01             	add    $0x1,%eax
+  802dc1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802dc6:	7f 47                	jg     802e0f <find_paging_env+0x5e>
+  802dc8:	83 f9 01             	cmp    $0x1,%ecx
+  802dcb:	7f 42                	jg     802e0f <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802dcd:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802dd0:	c1 e2 06             	shl    $0x6,%edx
+  802dd3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802dd9:	8b 52 50             	mov    0x50(%edx),%edx
+  802ddc:	83 fa 02             	cmp    $0x2,%edx
+  802ddf:	75 dd                	jne    802dbe <find_paging_env+0xd>
+  802de1:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802de4:	c1 e2 06             	shl    $0x6,%edx
+  802de7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802ded:	8b 52 54             	mov    0x54(%edx),%edx
+  802df0:	85 d2                	test   %edx,%edx
+  802df2:	74 ca                	je     802dbe <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802df4:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802df7:	c1 e2 06             	shl    $0x6,%edx
+  802dfa:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802e00:	8b 52 48             	mov    0x48(%edx),%edx
+  802e03:	89 14 8d 44 c0 80 00 	mov    %edx,0x80c044(,%ecx,4)
+  802e0a:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802e0d:	eb af                	jmp    802dbe <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802e0f:	83 f9 02             	cmp    $0x2,%ecx
+  802e12:	74 01                	je     802e15 <find_paging_env+0x64>
+}
+  802e14:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802e15:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802e1a:	8b 40 48             	mov    0x48(%eax),%eax
+  802e1d:	83 e0 01             	and    $0x1,%eax
+  802e20:	8b 04 85 44 c0 80 00 	mov    0x80c044(,%eax,4),%eax
+  802e27:	a3 40 c0 80 00       	mov    %eax,0x80c040
+  802e2c:	eb e6                	jmp    802e14 <find_paging_env+0x63>
+
+00802e2e <page_add_backed>:
+{
+  802e2e:	55                   	push   %ebp
+  802e2f:	89 e5                	mov    %esp,%ebp
+  802e31:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802e34:	a1 0c c0 80 00       	mov    0x80c00c,%eax
+  802e39:	83 f8 04             	cmp    $0x4,%eax
+  802e3c:	74 35                	je     802e73 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802e3e:	89 d1                	mov    %edx,%ecx
+  802e40:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802e46:	89 0c c5 20 c0 80 00 	mov    %ecx,0x80c020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802e4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e50:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802e57:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802e5d:	89 14 c5 24 c0 80 00 	mov    %edx,0x80c024(,%eax,8)
+	num_backed_ranges++;
+  802e64:	83 c0 01             	add    $0x1,%eax
+  802e67:	a3 0c c0 80 00       	mov    %eax,0x80c00c
+	return 0;
+  802e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e71:	5d                   	pop    %ebp
+  802e72:	c3                   	ret
+		return -E_NO_MEM;
+  802e73:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802e78:	eb f7                	jmp    802e71 <page_add_backed+0x43>
+
+00802e7a <percentage_of_pgdir_to_walk>:
+{
+  802e7a:	55                   	push   %ebp
+  802e7b:	89 e5                	mov    %esp,%ebp
+  802e7d:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802e80:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802e84:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802e87:	db 45 fc             	fildl  -0x4(%ebp)
+  802e8a:	d8 35 00 62 80 00    	fdivs  0x806200
+	return ret*ret;
+  802e90:	d8 c8                	fmul   %st(0),%st
+}
+  802e92:	c9                   	leave
+  802e93:	c3                   	ret
+
+00802e94 <nfu_with_aging_page_choice_func>:
+{
+  802e94:	55                   	push   %ebp
+  802e95:	89 e5                	mov    %esp,%ebp
+  802e97:	57                   	push   %edi
+  802e98:	56                   	push   %esi
+  802e99:	53                   	push   %ebx
+  802e9a:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802e9d:	8b 35 30 90 80 00    	mov    0x809030,%esi
+	float pct_to_walk = 1.0f;
+  802ea3:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802ea5:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802eaa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802eaf:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802eb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ebb:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802ebe:	eb 18                	jmp    802ed8 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802ec0:	f7 d0                	not    %eax
+  802ec2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802ec7:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802ec9:	83 c2 01             	add    $0x1,%edx
+  802ecc:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802ed2:	0f 87 13 01 00 00    	ja     802feb <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802ed8:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802edc:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802edf:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802ee4:	89 c1                	mov    %eax,%ecx
+  802ee6:	c1 e9 0a             	shr    $0xa,%ecx
+  802ee9:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802ef0:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802ef6:	83 f9 01             	cmp    $0x1,%ecx
+  802ef9:	75 c5                	jne    802ec0 <nfu_with_aging_page_choice_func+0x2c>
+  802efb:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802f00:	77 be                	ja     802ec0 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802f02:	89 c1                	mov    %eax,%ecx
+  802f04:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f07:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  802f0d:	0f 82 a5 00 00 00    	jb     802fb8 <nfu_with_aging_page_choice_func+0x124>
+  802f13:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802f19:	0f 87 99 00 00 00    	ja     802fb8 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802f1f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f26:	f6 c1 01             	test   $0x1,%cl
+  802f29:	0f 84 89 00 00 00    	je     802fb8 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802f2f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802f36:	f6 c5 04             	test   $0x4,%ch
+  802f39:	75 7d                	jne    802fb8 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802f3b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802f42:	f6 c5 02             	test   $0x2,%ch
+  802f45:	75 71                	jne    802fb8 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802f47:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802f4e:	c1 e9 0c             	shr    $0xc,%ecx
+  802f51:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802f54:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802f5a:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802f5e:	66 83 f9 01          	cmp    $0x1,%cx
+  802f62:	77 54                	ja     802fb8 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802f64:	89 f9                	mov    %edi,%ecx
+  802f66:	80 f9 ff             	cmp    $0xff,%cl
+  802f69:	74 21                	je     802f8c <nfu_with_aging_page_choice_func+0xf8>
+  802f6b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802f72:	c1 e9 0c             	shr    $0xc,%ecx
+  802f75:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802f78:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802f7e:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802f82:	89 fb                	mov    %edi,%ebx
+  802f84:	38 d9                	cmp    %bl,%cl
+  802f86:	73 30                	jae    802fb8 <nfu_with_aging_page_choice_func+0x124>
+  802f88:	dd d8                	fstp   %st(0)
+  802f8a:	eb 02                	jmp    802f8e <nfu_with_aging_page_choice_func+0xfa>
+  802f8c:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802f8e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802f95:	c1 e9 0c             	shr    $0xc,%ecx
+  802f98:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802f9b:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802fa2:	89 fb                	mov    %edi,%ebx
+  802fa4:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802fa7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802faa:	db 45 e0             	fildl  -0x20(%ebp)
+  802fad:	d8 35 00 62 80 00    	fdivs  0x806200
+	return ret*ret;
+  802fb3:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802fb5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802fb8:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802fbb:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802fbe:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802fc5:	df 6d e0             	fildll -0x20(%ebp)
+  802fc8:	d9 c1                	fld    %st(1)
+  802fca:	d8 0d 04 62 80 00    	fmuls  0x806204
+  802fd0:	d9 c9                	fxch   %st(1)
+  802fd2:	df f1                	fcomip %st(1),%st
+  802fd4:	dd d8                	fstp   %st(0)
+  802fd6:	0f 82 ed fe ff ff    	jb     802ec9 <nfu_with_aging_page_choice_func+0x35>
+  802fdc:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802fde:	a3 30 90 80 00       	mov    %eax,0x809030
+			return (void*)(pgnum_opt*PGSIZE);
+  802fe3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802fe6:	c1 e0 0c             	shl    $0xc,%eax
+  802fe9:	eb 0e                	jmp    802ff9 <nfu_with_aging_page_choice_func+0x165>
+  802feb:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802fed:	89 f8                	mov    %edi,%eax
+  802fef:	3c ff                	cmp    $0xff,%al
+  802ff1:	74 0e                	je     803001 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802ff3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802ff6:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802ff9:	83 c4 14             	add    $0x14,%esp
+  802ffc:	5b                   	pop    %ebx
+  802ffd:	5e                   	pop    %esi
+  802ffe:	5f                   	pop    %edi
+  802fff:	5d                   	pop    %ebp
+  803000:	c3                   	ret
+	pgnum = 0;
+  803001:	c7 05 30 90 80 00 00 	movl   $0x0,0x809030
+  803008:	00 00 00 
+	return (void*)UTOP;
+  80300b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803010:	eb e7                	jmp    802ff9 <nfu_with_aging_page_choice_func+0x165>
+
+00803012 <myRand>:
+    state = state * 1664525 + 1013904223;
+  803012:	69 05 40 70 80 00 0d 	imul   $0x19660d,0x807040,%eax
+  803019:	66 19 00 
+  80301c:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  803021:	a3 40 70 80 00       	mov    %eax,0x807040
+    return state >> 24;
+  803026:	c1 e8 18             	shr    $0x18,%eax
+}
+  803029:	c3                   	ret
+
+0080302a <random_page_choice_func>:
+{
+  80302a:	55                   	push   %ebp
+  80302b:	89 e5                	mov    %esp,%ebp
+  80302d:	57                   	push   %edi
+  80302e:	56                   	push   %esi
+  80302f:	53                   	push   %ebx
+  803030:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803033:	be 00 00 00 00       	mov    $0x0,%esi
+  803038:	eb 19                	jmp    803053 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80303a:	f7 d3                	not    %ebx
+  80303c:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  803042:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803044:	83 c6 01             	add    $0x1,%esi
+  803047:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  80304d:	0f 87 a0 00 00 00    	ja     8030f3 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803053:	89 f3                	mov    %esi,%ebx
+  803055:	03 1d 2c 90 80 00    	add    0x80902c,%ebx
+  80305b:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803061:	89 d8                	mov    %ebx,%eax
+  803063:	c1 e8 0a             	shr    $0xa,%eax
+  803066:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80306d:	25 81 00 00 00       	and    $0x81,%eax
+  803072:	83 f8 01             	cmp    $0x1,%eax
+  803075:	75 c3                	jne    80303a <random_page_choice_func+0x10>
+  803077:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80307d:	77 bb                	ja     80303a <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  80307f:	89 df                	mov    %ebx,%edi
+  803081:	c1 e7 0c             	shl    $0xc,%edi
+  803084:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  803087:	89 f8                	mov    %edi,%eax
+  803089:	e8 06 f9 ff ff       	call   802994 <page_is_clean>
+  80308e:	84 c0                	test   %al,%al
+  803090:	0f 85 82 00 00 00    	jne    803118 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803096:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  80309c:	72 a6                	jb     803044 <random_page_choice_func+0x1a>
+  80309e:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  8030a4:	77 9e                	ja     803044 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8030a6:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8030ad:	a8 01                	test   $0x1,%al
+  8030af:	74 93                	je     803044 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8030b1:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8030b8:	f6 c4 04             	test   $0x4,%ah
+  8030bb:	75 87                	jne    803044 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8030bd:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8030c4:	f6 c4 02             	test   $0x2,%ah
+  8030c7:	0f 85 77 ff ff ff    	jne    803044 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8030cd:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8030d4:	c1 e8 0c             	shr    $0xc,%eax
+  8030d7:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8030da:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8030df:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8030e3:	66 83 f8 01          	cmp    $0x1,%ax
+  8030e7:	0f 87 57 ff ff ff    	ja     803044 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  8030ed:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8030f3:	e8 1a ff ff ff       	call   803012 <myRand>
+  8030f8:	8b 3d 2c 90 80 00    	mov    0x80902c,%edi
+  8030fe:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  803103:	29 fe                	sub    %edi,%esi
+  803105:	0f be c0             	movsbl %al,%eax
+  803108:	ba 00 00 00 00       	mov    $0x0,%edx
+  80310d:	f7 f6                	div    %esi
+  80310f:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  803111:	bb 15 00 00 00       	mov    $0x15,%ebx
+  803116:	eb 1c                	jmp    803134 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  803118:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+			return (void*)(pgnum*PGSIZE);
+  80311e:	e9 8f 00 00 00       	jmp    8031b2 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  803123:	e8 ea fe ff ff       	call   803012 <myRand>
+  803128:	0f be c0             	movsbl %al,%eax
+  80312b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803130:	f7 f6                	div    %esi
+  803132:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  803134:	83 eb 01             	sub    $0x1,%ebx
+  803137:	0f 84 c2 00 00 00    	je     8031ff <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  80313d:	89 d0                	mov    %edx,%eax
+  80313f:	c1 e8 0a             	shr    $0xa,%eax
+  803142:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803149:	25 81 00 00 00       	and    $0x81,%eax
+  80314e:	83 f8 01             	cmp    $0x1,%eax
+  803151:	75 d0                	jne    803123 <random_page_choice_func+0xf9>
+  803153:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  803159:	77 c8                	ja     803123 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  80315b:	89 d0                	mov    %edx,%eax
+  80315d:	c1 e0 0c             	shl    $0xc,%eax
+  803160:	3d 2c 10 81 00       	cmp    $0x81102c,%eax
+  803165:	72 56                	jb     8031bd <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  803167:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  80316c:	77 65                	ja     8031d3 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  80316e:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  803175:	f6 c1 01             	test   $0x1,%cl
+  803178:	74 59                	je     8031d3 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  80317a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  803181:	f6 c5 04             	test   $0x4,%ch
+  803184:	75 4d                	jne    8031d3 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  803186:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  80318d:	f6 c5 02             	test   $0x2,%ch
+  803190:	75 41                	jne    8031d3 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  803192:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803199:	c1 ea 0c             	shr    $0xc,%edx
+  80319c:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  80319f:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  8031a5:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  8031a9:	66 83 fa 01          	cmp    $0x1,%dx
+  8031ad:	77 3a                	ja     8031e9 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  8031af:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  8031b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8031b5:	83 c4 1c             	add    $0x1c,%esp
+  8031b8:	5b                   	pop    %ebx
+  8031b9:	5e                   	pop    %esi
+  8031ba:	5f                   	pop    %edi
+  8031bb:	5d                   	pop    %ebp
+  8031bc:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8031bd:	e8 50 fe ff ff       	call   803012 <myRand>
+  8031c2:	0f be c0             	movsbl %al,%eax
+  8031c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031ca:	f7 f6                	div    %esi
+  8031cc:	01 fa                	add    %edi,%edx
+			continue;
+  8031ce:	e9 61 ff ff ff       	jmp    803134 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  8031d3:	e8 3a fe ff ff       	call   803012 <myRand>
+  8031d8:	0f be c0             	movsbl %al,%eax
+  8031db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031e0:	f7 f6                	div    %esi
+  8031e2:	01 fa                	add    %edi,%edx
+			continue;
+  8031e4:	e9 4b ff ff ff       	jmp    803134 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  8031e9:	e8 24 fe ff ff       	call   803012 <myRand>
+  8031ee:	0f be c0             	movsbl %al,%eax
+  8031f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031f6:	f7 f6                	div    %esi
+  8031f8:	01 fa                	add    %edi,%edx
+			continue;
+  8031fa:	e9 35 ff ff ff       	jmp    803134 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  8031ff:	c7 05 2c 90 80 00 00 	movl   $0x0,0x80902c
+  803206:	00 00 00 
+	return (void*)UTOP;
+  803209:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  803210:	eb a0                	jmp    8031b2 <random_page_choice_func+0x188>
+
+00803212 <nfu>:
+{
+  803212:	55                   	push   %ebp
+  803213:	89 e5                	mov    %esp,%ebp
+  803215:	57                   	push   %edi
+  803216:	56                   	push   %esi
+  803217:	53                   	push   %ebx
+  803218:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80321b:	8b 35 28 90 80 00    	mov    0x809028,%esi
+	float pct_to_walk = 1.0f;
+  803221:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  803223:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803228:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80322d:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803234:	ba 00 00 00 00       	mov    $0x0,%edx
+  803239:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  80323c:	eb 18                	jmp    803256 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80323e:	f7 d0                	not    %eax
+  803240:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803245:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803247:	83 c2 01             	add    $0x1,%edx
+  80324a:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803250:	0f 87 13 01 00 00    	ja     803369 <nfu+0x157>
+		++num_searched_ptes;
+  803256:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80325a:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  80325d:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803262:	89 c1                	mov    %eax,%ecx
+  803264:	c1 e9 0a             	shr    $0xa,%ecx
+  803267:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80326e:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803274:	83 f9 01             	cmp    $0x1,%ecx
+  803277:	75 c5                	jne    80323e <nfu+0x2c>
+  803279:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  80327e:	77 be                	ja     80323e <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803280:	89 c1                	mov    %eax,%ecx
+  803282:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803285:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  80328b:	0f 82 a5 00 00 00    	jb     803336 <nfu+0x124>
+  803291:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803297:	0f 87 99 00 00 00    	ja     803336 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80329d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8032a4:	f6 c1 01             	test   $0x1,%cl
+  8032a7:	0f 84 89 00 00 00    	je     803336 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8032ad:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8032b4:	f6 c5 04             	test   $0x4,%ch
+  8032b7:	75 7d                	jne    803336 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8032b9:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8032c0:	f6 c5 02             	test   $0x2,%ch
+  8032c3:	75 71                	jne    803336 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8032c5:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032cc:	c1 e9 0c             	shr    $0xc,%ecx
+  8032cf:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032d2:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032d8:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8032dc:	66 83 f9 01          	cmp    $0x1,%cx
+  8032e0:	77 54                	ja     803336 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  8032e2:	89 f9                	mov    %edi,%ecx
+  8032e4:	80 f9 ff             	cmp    $0xff,%cl
+  8032e7:	74 21                	je     80330a <nfu+0xf8>
+  8032e9:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032f0:	c1 e9 0c             	shr    $0xc,%ecx
+  8032f3:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032f6:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032fc:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  803300:	89 fb                	mov    %edi,%ebx
+  803302:	38 d9                	cmp    %bl,%cl
+  803304:	73 30                	jae    803336 <nfu+0x124>
+  803306:	dd d8                	fstp   %st(0)
+  803308:	eb 02                	jmp    80330c <nfu+0xfa>
+  80330a:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  80330c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803313:	c1 e9 0c             	shr    $0xc,%ecx
+  803316:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803319:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  803320:	89 fb                	mov    %edi,%ebx
+  803322:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  803325:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803328:	db 45 e0             	fildl  -0x20(%ebp)
+  80332b:	d8 35 00 62 80 00    	fdivs  0x806200
+	return ret*ret;
+  803331:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803333:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803336:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  803339:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80333c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803343:	df 6d e0             	fildll -0x20(%ebp)
+  803346:	d9 c1                	fld    %st(1)
+  803348:	d8 0d 04 62 80 00    	fmuls  0x806204
+  80334e:	d9 c9                	fxch   %st(1)
+  803350:	df f1                	fcomip %st(1),%st
+  803352:	dd d8                	fstp   %st(0)
+  803354:	0f 82 ed fe ff ff    	jb     803247 <nfu+0x35>
+  80335a:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  80335c:	a3 28 90 80 00       	mov    %eax,0x809028
+			return (void*)(pgnum_opt*PGSIZE);
+  803361:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803364:	c1 e0 0c             	shl    $0xc,%eax
+  803367:	eb 0e                	jmp    803377 <nfu+0x165>
+  803369:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  80336b:	89 f8                	mov    %edi,%eax
+  80336d:	3c ff                	cmp    $0xff,%al
+  80336f:	74 0e                	je     80337f <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  803371:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803374:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803377:	83 c4 14             	add    $0x14,%esp
+  80337a:	5b                   	pop    %ebx
+  80337b:	5e                   	pop    %esi
+  80337c:	5f                   	pop    %edi
+  80337d:	5d                   	pop    %ebp
+  80337e:	c3                   	ret
+	pgnum = 0;
+  80337f:	c7 05 28 90 80 00 00 	movl   $0x0,0x809028
+  803386:	00 00 00 
+	return (void*)UTOP;
+  803389:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80338e:	eb e7                	jmp    803377 <nfu+0x165>
+
+00803390 <lru>:
+{
+  803390:	55                   	push   %ebp
+  803391:	89 e5                	mov    %esp,%ebp
+  803393:	57                   	push   %edi
+  803394:	56                   	push   %esi
+  803395:	53                   	push   %ebx
+  803396:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803399:	8b 3d 24 90 80 00    	mov    0x809024,%edi
+	long long time_min = 9223372036854775807;
+  80339f:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  8033a6:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8033ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8033b2:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8033b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033be:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  8033c1:	eb 18                	jmp    8033db <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8033c3:	f7 d0                	not    %eax
+  8033c5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8033ca:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8033cc:	83 c2 01             	add    $0x1,%edx
+  8033cf:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  8033d5:	0f 87 fa 00 00 00    	ja     8034d5 <lru+0x145>
+		++num_searched_ptes;
+  8033db:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8033de:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8033e1:	01 d0                	add    %edx,%eax
+  8033e3:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8033e8:	89 c1                	mov    %eax,%ecx
+  8033ea:	c1 e9 0a             	shr    $0xa,%ecx
+  8033ed:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8033f4:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8033fa:	83 f9 01             	cmp    $0x1,%ecx
+  8033fd:	75 c4                	jne    8033c3 <lru+0x33>
+  8033ff:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803404:	77 bd                	ja     8033c3 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803406:	89 c1                	mov    %eax,%ecx
+  803408:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80340b:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803411:	0f 87 92 00 00 00    	ja     8034a9 <lru+0x119>
+  803417:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  80341d:	0f 82 86 00 00 00    	jb     8034a9 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803423:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80342a:	f6 c1 01             	test   $0x1,%cl
+  80342d:	74 7a                	je     8034a9 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80342f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803436:	f6 c5 04             	test   $0x4,%ch
+  803439:	75 6e                	jne    8034a9 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80343b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803442:	f6 c5 02             	test   $0x2,%ch
+  803445:	75 62                	jne    8034a9 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803447:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80344e:	c1 e9 0c             	shr    $0xc,%ecx
+  803451:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803454:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80345a:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  80345e:	66 83 f9 01          	cmp    $0x1,%cx
+  803462:	77 45                	ja     8034a9 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  803464:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80346b:	c1 e9 0c             	shr    $0xc,%ecx
+  80346e:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803471:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803477:	8b 59 14             	mov    0x14(%ecx),%ebx
+  80347a:	8b 49 10             	mov    0x10(%ecx),%ecx
+  80347d:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  803480:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803483:	19 df                	sbb    %ebx,%edi
+  803485:	7c 22                	jl     8034a9 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  803487:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80348e:	c1 e9 0c             	shr    $0xc,%ecx
+  803491:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803494:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80349a:	8b 59 14             	mov    0x14(%ecx),%ebx
+  80349d:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8034a0:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8034a3:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8034a6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8034a9:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8034ac:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8034b3:	df 6d e0             	fildll -0x20(%ebp)
+  8034b6:	d9 05 04 62 80 00    	flds   0x806204
+  8034bc:	d9 c9                	fxch   %st(1)
+  8034be:	df f1                	fcomip %st(1),%st
+  8034c0:	dd d8                	fstp   %st(0)
+  8034c2:	0f 82 04 ff ff ff    	jb     8033cc <lru+0x3c>
+			pgnum = pgnum_actual;
+  8034c8:	a3 24 90 80 00       	mov    %eax,0x809024
+			return (void*)(pgnum_opt*PGSIZE);
+  8034cd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8034d0:	c1 e0 0c             	shl    $0xc,%eax
+  8034d3:	eb 06                	jmp    8034db <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  8034d5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8034d8:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8034db:	83 c4 1c             	add    $0x1c,%esp
+  8034de:	5b                   	pop    %ebx
+  8034df:	5e                   	pop    %esi
+  8034e0:	5f                   	pop    %edi
+  8034e1:	5d                   	pop    %ebp
+  8034e2:	c3                   	ret
+
+008034e3 <set_page_choice_func>:
+{
+  8034e3:	55                   	push   %ebp
+  8034e4:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  8034e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034e9:	a3 3c 70 80 00       	mov    %eax,0x80703c
+}
+  8034ee:	5d                   	pop    %ebp
+  8034ef:	c3                   	ret
+
+008034f0 <get_page_choice>:
+{
+  8034f0:	55                   	push   %ebp
+  8034f1:	89 e5                	mov    %esp,%ebp
+  8034f3:	57                   	push   %edi
+  8034f4:	56                   	push   %esi
+  8034f5:	53                   	push   %ebx
+  8034f6:	83 ec 24             	sub    $0x24,%esp
+  8034f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034fc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  8034ff:	57                   	push   %edi
+  803500:	56                   	push   %esi
+  803501:	ff 15 3c 70 80 00    	call   *0x80703c
+  803507:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803509:	83 c4 10             	add    $0x10,%esp
+  80350c:	eb 25                	jmp    803533 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  80350e:	83 ec 08             	sub    $0x8,%esp
+  803511:	c1 e0 16             	shl    $0x16,%eax
+  803514:	50                   	push   %eax
+  803515:	6a 00                	push   $0x0
+  803517:	e8 cc da ff ff       	call   800fe8 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80351c:	83 c4 10             	add    $0x10,%esp
+  80351f:	85 c0                	test   %eax,%eax
+  803521:	75 43                	jne    803566 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  803523:	83 ec 08             	sub    $0x8,%esp
+  803526:	57                   	push   %edi
+  803527:	56                   	push   %esi
+  803528:	ff 15 3c 70 80 00    	call   *0x80703c
+  80352e:	89 c3                	mov    %eax,%ebx
+  803530:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803533:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  803536:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80353c:	0f 86 ae 00 00 00    	jbe    8035f0 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803542:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  803547:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80354e:	81 e2 81 00 00 00    	and    $0x81,%edx
+  803554:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  80355a:	74 b2                	je     80350e <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80355c:	83 c0 01             	add    $0x1,%eax
+  80355f:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  803564:	75 e1                	jne    803547 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803566:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803569:	05 00 10 40 11       	add    $0x11401000,%eax
+  80356e:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803573:	76 1f                	jbe    803594 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  803575:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  80357a:	89 d8                	mov    %ebx,%eax
+  80357c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80357f:	5b                   	pop    %ebx
+  803580:	5e                   	pop    %esi
+  803581:	5f                   	pop    %edi
+  803582:	5d                   	pop    %ebp
+  803583:	c3                   	ret
+		sys_page_split(0, pg_out);
+  803584:	83 ec 08             	sub    $0x8,%esp
+  803587:	53                   	push   %ebx
+  803588:	6a 00                	push   $0x0
+  80358a:	e8 59 da ff ff       	call   800fe8 <sys_page_split>
+  80358f:	83 c4 10             	add    $0x10,%esp
+  803592:	eb 6c                	jmp    803600 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  803594:	83 ec 04             	sub    $0x4,%esp
+  803597:	68 ac 5d 80 00       	push   $0x805dac
+  80359c:	68 cc 01 00 00       	push   $0x1cc
+  8035a1:	68 1b 5d 80 00       	push   $0x805d1b
+  8035a6:	e8 c1 cd ff ff       	call   80036c <_panic>
+		panic("We tried to page out code pages\n");
+  8035ab:	83 ec 04             	sub    $0x4,%esp
+  8035ae:	68 dc 5d 80 00       	push   $0x805ddc
+  8035b3:	68 d6 01 00 00       	push   $0x1d6
+  8035b8:	68 1b 5d 80 00       	push   $0x805d1b
+  8035bd:	e8 aa cd ff ff       	call   80036c <_panic>
+		panic("Invalid mapping for the va\n");
+  8035c2:	83 ec 04             	sub    $0x4,%esp
+  8035c5:	68 28 5d 80 00       	push   $0x805d28
+  8035ca:	68 da 01 00 00       	push   $0x1da
+  8035cf:	68 1b 5d 80 00       	push   $0x805d1b
+  8035d4:	e8 93 cd ff ff       	call   80036c <_panic>
+		panic("We tried to page out a shared page\n");
+  8035d9:	83 ec 04             	sub    $0x4,%esp
+  8035dc:	68 00 5e 80 00       	push   $0x805e00
+  8035e1:	68 e0 01 00 00       	push   $0x1e0
+  8035e6:	68 1b 5d 80 00       	push   $0x805d1b
+  8035eb:	e8 7c cd ff ff       	call   80036c <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  8035f0:	89 de                	mov    %ebx,%esi
+  8035f2:	c1 ee 16             	shr    $0x16,%esi
+  8035f5:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8035fc:	a8 80                	test   $0x80,%al
+  8035fe:	75 84                	jne    803584 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803600:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803603:	05 00 10 40 11       	add    $0x11401000,%eax
+  803608:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80360d:	76 85                	jbe    803594 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  80360f:	89 d8                	mov    %ebx,%eax
+  803611:	e8 7e f3 ff ff       	call   802994 <page_is_clean>
+  803616:	84 c0                	test   %al,%al
+  803618:	0f 85 5c ff ff ff    	jne    80357a <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  80361e:	81 7d e4 2c 10 81 00 	cmpl   $0x81102c,-0x1c(%ebp)
+  803625:	76 84                	jbe    8035ab <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  803627:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80362e:	a8 01                	test   $0x1,%al
+  803630:	74 90                	je     8035c2 <get_page_choice+0xd2>
+  803632:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803635:	c1 e8 0c             	shr    $0xc,%eax
+  803638:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80363f:	f6 c2 01             	test   $0x1,%dl
+  803642:	0f 84 7a ff ff ff    	je     8035c2 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803648:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  80364f:	f6 c2 01             	test   $0x1,%dl
+  803652:	74 85                	je     8035d9 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803654:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  80365b:	f6 c2 01             	test   $0x1,%dl
+  80365e:	0f 84 75 ff ff ff    	je     8035d9 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  803664:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  80366b:	f6 c6 04             	test   $0x4,%dh
+  80366e:	0f 85 65 ff ff ff    	jne    8035d9 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  803674:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  80367b:	f6 c6 02             	test   $0x2,%dh
+  80367e:	0f 85 55 ff ff ff    	jne    8035d9 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  803684:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80368b:	c1 e8 0c             	shr    $0xc,%eax
+  80368e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803691:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803696:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80369a:	66 83 f8 01          	cmp    $0x1,%ax
+  80369e:	0f 86 d6 fe ff ff    	jbe    80357a <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  8036a4:	83 ec 04             	sub    $0x4,%esp
+  8036a7:	68 24 5e 80 00       	push   $0x805e24
+  8036ac:	68 e2 01 00 00       	push   $0x1e2
+  8036b1:	68 1b 5d 80 00       	push   $0x805d1b
+  8036b6:	e8 b1 cc ff ff       	call   80036c <_panic>
+
+008036bb <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  8036bb:	55                   	push   %ebp
+  8036bc:	89 e5                	mov    %esp,%ebp
+  8036be:	57                   	push   %edi
+  8036bf:	56                   	push   %esi
+  8036c0:	53                   	push   %ebx
+  8036c1:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  8036c4:	e8 e8 f6 ff ff       	call   802db1 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  8036c9:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  8036ce:	85 c0                	test   %eax,%eax
+  8036d0:	74 41                	je     803713 <page_share_paged_out+0x58>
+  8036d2:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  8036d9:	0f 84 fd 00 00 00    	je     8037dc <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  8036df:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  8036e6:	00 00 00 
+  8036e9:	c7 05 00 b0 80 00 00 	movl   $0x0,0x80b000
+  8036f0:	00 00 00 
+  8036f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036f8:	eb 2c                	jmp    803726 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8036fa:	83 c3 04             	add    $0x4,%ebx
+  8036fd:	39 f3                	cmp    %esi,%ebx
+  8036ff:	74 1a                	je     80371b <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  803701:	8b 03                	mov    (%ebx),%eax
+  803703:	a8 01                	test   $0x1,%al
+  803705:	74 f3                	je     8036fa <page_share_paged_out+0x3f>
+  803707:	c1 e8 0c             	shr    $0xc,%eax
+  80370a:	e8 2b f5 ff ff       	call   802c3a <page_share_slot>
+  80370f:	85 c0                	test   %eax,%eax
+  803711:	79 e7                	jns    8036fa <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  803713:	83 c4 0c             	add    $0xc,%esp
+  803716:	5b                   	pop    %ebx
+  803717:	5e                   	pop    %esi
+  803718:	5f                   	pop    %edi
+  803719:	5d                   	pop    %ebp
+  80371a:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  80371b:	83 c7 04             	add    $0x4,%edi
+  80371e:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  803724:	74 1b                	je     803741 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  803726:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  80372b:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  80372e:	f6 c3 01             	test   $0x1,%bl
+  803731:	74 e8                	je     80371b <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  803733:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803739:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  80373f:	eb bc                	jmp    8036fd <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803741:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803746:	eb 11                	jmp    803759 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  803748:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80374e:	83 c3 01             	add    $0x1,%ebx
+  803751:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803757:	77 41                	ja     80379a <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  803759:	89 d8                	mov    %ebx,%eax
+  80375b:	c1 e8 0a             	shr    $0xa,%eax
+  80375e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803765:	25 81 00 00 00       	and    $0x81,%eax
+  80376a:	83 f8 01             	cmp    $0x1,%eax
+  80376d:	75 d9                	jne    803748 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  80376f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803776:	25 81 00 00 00       	and    $0x81,%eax
+  80377b:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803780:	75 cc                	jne    80374e <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803782:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803789:	c1 e8 0c             	shr    $0xc,%eax
+  80378c:	e8 a9 f4 ff ff       	call   802c3a <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803791:	85 c0                	test   %eax,%eax
+  803793:	79 b9                	jns    80374e <page_share_paged_out+0x93>
+  803795:	e9 79 ff ff ff       	jmp    803713 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80379a:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8037a1:	75 13                	jne    8037b6 <page_share_paged_out+0xfb>
+  8037a3:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  8037aa:	75 1d                	jne    8037c9 <page_share_paged_out+0x10e>
+	return 0;
+  8037ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b1:	e9 5d ff ff ff       	jmp    803713 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8037b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037bb:	e8 46 f4 ff ff       	call   802c06 <page_share_send>
+  8037c0:	85 c0                	test   %eax,%eax
+  8037c2:	79 df                	jns    8037a3 <page_share_paged_out+0xe8>
+  8037c4:	e9 4a ff ff ff       	jmp    803713 <page_share_paged_out+0x58>
+  8037c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8037ce:	e8 33 f4 ff ff       	call   802c06 <page_share_send>
+  8037d3:	85 c0                	test   %eax,%eax
+  8037d5:	79 d5                	jns    8037ac <page_share_paged_out+0xf1>
+  8037d7:	e9 37 ff ff ff       	jmp    803713 <page_share_paged_out+0x58>
+		return 0;
+  8037dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e1:	e9 2d ff ff ff       	jmp    803713 <page_share_paged_out+0x58>
+
+008037e6 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  8037e6:	55                   	push   %ebp
+  8037e7:	89 e5                	mov    %esp,%ebp
+  8037e9:	56                   	push   %esi
+  8037ea:	53                   	push   %ebx
+  8037eb:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  8037ee:	e8 be f5 ff ff       	call   802db1 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  8037f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  8037f8:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  8037ff:	0f 84 82 00 00 00    	je     803887 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  803805:	83 ec 0c             	sub    $0xc,%esp
+  803808:	68 00 10 00 00       	push   $0x1000
+  80380d:	e8 84 11 00 00       	call   804996 <malloc>
+  803812:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  803814:	83 c4 0c             	add    $0xc,%esp
+  803817:	6a 14                	push   $0x14
+  803819:	6a 00                	push   $0x0
+  80381b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80381e:	50                   	push   %eax
+  80381f:	e8 5b d3 ff ff       	call   800b7f <memset>
+  803824:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  803827:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  80382c:	83 ec 0c             	sub    $0xc,%esp
+  80382f:	6a 07                	push   $0x7
+  803831:	6a 01                	push   $0x1
+  803833:	53                   	push   %ebx
+  803834:	6a 03                	push   $0x3
+  803836:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  80383d:	e8 b7 19 00 00       	call   8051f9 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  803842:	8b 03                	mov    (%ebx),%eax
+  803844:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803847:	8b 43 04             	mov    0x4(%ebx),%eax
+  80384a:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  80384d:	8b 43 08             	mov    0x8(%ebx),%eax
+  803850:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  803853:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803856:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  803859:	8b 43 10             	mov    0x10(%ebx),%eax
+  80385c:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  80385f:	83 c6 01             	add    $0x1,%esi
+  803862:	83 c4 20             	add    $0x20,%esp
+  803865:	83 fe 02             	cmp    $0x2,%esi
+  803868:	75 c2                	jne    80382c <get_paging_stats+0x46>
+	}
+	*stats = total;
+  80386a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80386d:	89 03                	mov    %eax,(%ebx)
+  80386f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803872:	89 43 04             	mov    %eax,0x4(%ebx)
+  803875:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803878:	89 43 08             	mov    %eax,0x8(%ebx)
+  80387b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80387e:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803881:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803884:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  803887:	89 d8                	mov    %ebx,%eax
+  803889:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80388c:	5b                   	pop    %ebx
+  80388d:	5e                   	pop    %esi
+  80388e:	5d                   	pop    %ebp
+  80388f:	c3                   	ret
+
+00803890 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803890:	55                   	push   %ebp
+  803891:	89 e5                	mov    %esp,%ebp
+  803893:	53                   	push   %ebx
+  803894:	83 ec 10             	sub    $0x10,%esp
+  803897:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  80389a:	68 42 5d 80 00       	push   $0x805d42
+  80389f:	e8 a3 cb ff ff       	call   800447 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  8038a4:	83 c4 08             	add    $0x8,%esp
+  8038a7:	ff 33                	push   (%ebx)
+  8038a9:	68 58 5e 80 00       	push   $0x805e58
+  8038ae:	e8 94 cb ff ff       	call   800447 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  8038b3:	83 c4 08             	add    $0x8,%esp
+  8038b6:	ff 73 04             	push   0x4(%ebx)
+  8038b9:	68 44 5d 80 00       	push   $0x805d44
+  8038be:	e8 84 cb ff ff       	call   800447 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  8038c3:	83 c4 08             	add    $0x8,%esp
+  8038c6:	ff 73 08             	push   0x8(%ebx)
+  8038c9:	68 78 5e 80 00       	push   $0x805e78
+  8038ce:	e8 74 cb ff ff       	call   800447 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  8038d3:	83 c4 08             	add    $0x8,%esp
+  8038d6:	ff 73 0c             	push   0xc(%ebx)
+  8038d9:	68 9c 5e 80 00       	push   $0x805e9c
+  8038de:	e8 64 cb ff ff       	call   800447 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  8038e3:	83 c4 08             	add    $0x8,%esp
+  8038e6:	ff 73 10             	push   0x10(%ebx)
+  8038e9:	68 c0 5e 80 00       	push   $0x805ec0
+  8038ee:	e8 54 cb ff ff       	call   800447 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  8038f3:	83 c4 08             	add    $0x8,%esp
+  8038f6:	ff 35 08 c0 80 00    	push   0x80c008
+  8038fc:	68 fc 5e 80 00       	push   $0x805efc
+  803901:	e8 41 cb ff ff       	call   800447 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  803906:	83 c4 08             	add    $0x8,%esp
+  803909:	ff 35 04 c0 80 00    	push   0x80c004
+  80390f:	68 30 5f 80 00       	push   $0x805f30
+  803914:	e8 2e cb ff ff       	call   800447 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  803919:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80391e:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  803921:	8b 50 68             	mov    0x68(%eax),%edx
+  803924:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  803927:	51                   	push   %ecx
+  803928:	52                   	push   %edx
+  803929:	50                   	push   %eax
+  80392a:	68 70 5f 80 00       	push   $0x805f70
+  80392f:	e8 13 cb ff ff       	call   800447 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  803934:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803939:	8b 40 70             	mov    0x70(%eax),%eax
+  80393c:	83 c4 18             	add    $0x18,%esp
+  80393f:	50                   	push   %eax
+  803940:	68 a4 5f 80 00       	push   $0x805fa4
+  803945:	e8 fd ca ff ff       	call   800447 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  80394a:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  803950:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803956:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  80395b:	51                   	push   %ecx
+  80395c:	52                   	push   %edx
+  80395d:	50                   	push   %eax
+  80395e:	68 d4 5f 80 00       	push   $0x805fd4
+  803963:	e8 df ca ff ff       	call   800447 <cprintf>
+	cprintf("\n");
+  803968:	83 c4 14             	add    $0x14,%esp
+  80396b:	68 42 5d 80 00       	push   $0x805d42
+  803970:	e8 d2 ca ff ff       	call   800447 <cprintf>
+}
+  803975:	83 c4 10             	add    $0x10,%esp
+  803978:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80397b:	c9                   	leave
+  80397c:	c3                   	ret
+
+0080397d <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  80397d:	55                   	push   %ebp
+  80397e:	89 e5                	mov    %esp,%ebp
+  803980:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  803983:	e8 5e fe ff ff       	call   8037e6 <get_paging_stats>
+  803988:	83 ec 0c             	sub    $0xc,%esp
+  80398b:	50                   	push   %eax
+  80398c:	e8 ff fe ff ff       	call   803890 <print_paging_stats>
+}
+  803991:	83 c4 10             	add    $0x10,%esp
+  803994:	c9                   	leave
+  803995:	c3                   	ret
+
+00803996 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803996:	55                   	push   %ebp
+  803997:	89 e5                	mov    %esp,%ebp
+  803999:	53                   	push   %ebx
+  80399a:	83 ec 04             	sub    $0x4,%esp
+  80399d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  8039a0:	eb 13                	jmp    8039b5 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  8039a2:	83 ec 04             	sub    $0x4,%esp
+  8039a5:	6a ff                	push   $0xffffffff
+  8039a7:	53                   	push   %ebx
+  8039a8:	68 00 f0 ff ee       	push   $0xeefff000
+  8039ad:	e8 48 da ff ff       	call   8013fa <sys_futex_wait>
+  8039b2:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  8039b5:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  8039ba:	39 d8                	cmp    %ebx,%eax
+  8039bc:	74 e4                	je     8039a2 <mem_pressure_wait+0xc>
+	return now;
+}
+  8039be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039c1:	c9                   	leave
+  8039c2:	c3                   	ret
+
+008039c3 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  8039c3:	55                   	push   %ebp
+  8039c4:	89 e5                	mov    %esp,%ebp
+  8039c6:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  8039c9:	68 35 46 80 00       	push   $0x804635
+  8039ce:	e8 32 16 00 00       	call   805005 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  8039d3:	c7 05 14 f9 80 00 00 	movl   $0xdeadb000,0x80f914
+  8039da:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  8039dd:	83 c4 0c             	add    $0xc,%esp
+  8039e0:	68 07 02 00 00       	push   $0x207
+  8039e5:	68 00 b0 ad de       	push   $0xdeadb000
+  8039ea:	6a 00                	push   $0x0
+  8039ec:	e8 30 d5 ff ff       	call   800f21 <sys_page_alloc>
+  8039f1:	83 c4 10             	add    $0x10,%esp
+  8039f4:	85 c0                	test   %eax,%eax
+  8039f6:	78 0c                	js     803a04 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  8039f8:	e8 b4 f3 ff ff       	call   802db1 <find_paging_env>
+	page_ring_ready();
+  8039fd:	e8 7f f2 ff ff       	call   802c81 <page_ring_ready>
+}
+  803a02:	c9                   	leave
+  803a03:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  803a04:	50                   	push   %eax
+  803a05:	68 62 5d 80 00       	push   $0x805d62
+  803a0a:	68 13 05 00 00       	push   $0x513
+  803a0f:	68 1b 5d 80 00       	push   $0x805d1b
+  803a14:	e8 53 c9 ff ff       	call   80036c <_panic>
+
+00803a19 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  803a19:	55                   	push   %ebp
+  803a1a:	89 e5                	mov    %esp,%ebp
+  803a1c:	57                   	push   %edi
+  803a1d:	56                   	push   %esi
+  803a1e:	53                   	push   %ebx
+  803a1f:	83 ec 0c             	sub    $0xc,%esp
+  803a22:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  803a25:	89 fa                	mov    %edi,%edx
+  803a27:	c1 ea 16             	shr    $0x16,%edx
+  803a2a:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  803a2f:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  803a32:	f6 06 01             	testb  $0x1,(%esi)
+  803a35:	75 3e                	jne    803a75 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803a37:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  803a3c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803a40:	74 47                	je     803a89 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  803a42:	83 ec 0c             	sub    $0xc,%esp
+  803a45:	6a 01                	push   $0x1
+  803a47:	e8 f2 11 00 00       	call   804c3e <va_alloc>
+  803a4c:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  803a4e:	83 c4 10             	add    $0x10,%esp
+  803a51:	85 c0                	test   %eax,%eax
+  803a53:	74 34                	je     803a89 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803a55:	6a 00                	push   $0x0
+  803a57:	68 07 02 00 00       	push   $0x207
+  803a5c:	50                   	push   %eax
+  803a5d:	6a 00                	push   $0x0
+  803a5f:	e8 df 02 00 00       	call   803d43 <page_alloc>
+  803a64:	83 c4 10             	add    $0x10,%esp
+  803a67:	85 c0                	test   %eax,%eax
+  803a69:	78 28                	js     803a93 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  803a6b:	f6 06 01             	testb  $0x1,(%esi)
+  803a6e:	75 38                	jne    803aa8 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803a70:	83 cb 01             	or     $0x1,%ebx
+  803a73:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803a75:	89 f8                	mov    %edi,%eax
+  803a77:	c1 e8 0a             	shr    $0xa,%eax
+  803a7a:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803a7f:	8b 1e                	mov    (%esi),%ebx
+  803a81:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803a87:	01 c3                	add    %eax,%ebx
+}
+  803a89:	89 d8                	mov    %ebx,%eax
+  803a8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a8e:	5b                   	pop    %ebx
+  803a8f:	5e                   	pop    %esi
+  803a90:	5f                   	pop    %edi
+  803a91:	5d                   	pop    %ebp
+  803a92:	c3                   	ret
+			va_free(page, 1);
+  803a93:	83 ec 08             	sub    $0x8,%esp
+  803a96:	6a 01                	push   $0x1
+  803a98:	53                   	push   %ebx
+  803a99:	e8 d8 12 00 00       	call   804d76 <va_free>
+			return NULL;
+  803a9e:	83 c4 10             	add    $0x10,%esp
+  803aa1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803aa6:	eb e1                	jmp    803a89 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  803aa8:	83 ec 08             	sub    $0x8,%esp
+  803aab:	53                   	push   %ebx
+  803aac:	6a 00                	push   $0x0
+  803aae:	e8 f3 d4 ff ff       	call   800fa6 <sys_page_unmap>
+			va_free(page, 1);
+  803ab3:	83 c4 08             	add    $0x8,%esp
+  803ab6:	6a 01                	push   $0x1
+  803ab8:	53                   	push   %ebx
+  803ab9:	e8 b8 12 00 00       	call   804d76 <va_free>
+  803abe:	83 c4 10             	add    $0x10,%esp
+  803ac1:	eb b2                	jmp    803a75 <umapdir_walk+0x5c>
+
+00803ac3 <page_out>:
+{
+  803ac3:	55                   	push   %ebp
+  803ac4:	89 e5                	mov    %esp,%ebp
+  803ac6:	57                   	push   %edi
+  803ac7:	56                   	push   %esi
+  803ac8:	53                   	push   %ebx
+  803ac9:	83 ec 5c             	sub    $0x5c,%esp
+  803acc:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803acf:	e8 dd f2 ff ff       	call   802db1 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803ad4:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  803ad9:	85 c0                	test   %eax,%eax
+  803adb:	74 1e                	je     803afb <page_out+0x38>
+  803add:	83 ec 0c             	sub    $0xc,%esp
+  803ae0:	6a 00                	push   $0x0
+  803ae2:	6a 00                	push   $0x0
+  803ae4:	6a 00                	push   $0x0
+  803ae6:	6a 08                	push   $0x8
+  803ae8:	50                   	push   %eax
+  803ae9:	e8 0b 17 00 00       	call   8051f9 <ipc_call>
+  803aee:	89 c3                	mov    %eax,%ebx
+  803af0:	83 c4 20             	add    $0x20,%esp
+  803af3:	85 c0                	test   %eax,%eax
+  803af5:	0f 84 ac 00 00 00    	je     803ba7 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  803afb:	83 ec 08             	sub    $0x8,%esp
+  803afe:	ff 75 0c             	push   0xc(%ebp)
+  803b01:	57                   	push   %edi
+  803b02:	e8 e9 f9 ff ff       	call   8034f0 <get_page_choice>
+  803b07:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  803b09:	83 c4 10             	add    $0x10,%esp
+  803b0c:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803b11:	0f 84 18 02 00 00    	je     803d2f <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803b17:	e8 78 ee ff ff       	call   802994 <page_is_clean>
+  803b1c:	84 c0                	test   %al,%al
+  803b1e:	0f 85 8c 00 00 00    	jne    803bb0 <page_out+0xed>
+	if (pagingenv == 0)
+  803b24:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803b2b:	0f 84 08 02 00 00    	je     803d39 <page_out+0x276>
+	if (page_ring_ready())
+  803b31:	e8 4b f1 ff ff       	call   802c81 <page_ring_ready>
+  803b36:	89 c3                	mov    %eax,%ebx
+  803b38:	85 c0                	test   %eax,%eax
+  803b3a:	0f 85 89 00 00 00    	jne    803bc9 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  803b40:	83 ec 0c             	sub    $0xc,%esp
+  803b43:	6a 05                	push   $0x5
+  803b45:	6a 01                	push   $0x1
+  803b47:	56                   	push   %esi
+  803b48:	6a 01                	push   $0x1
+  803b4a:	ff 35 40 c0 80 00    	push   0x80c040
+  803b50:	e8 a4 16 00 00       	call   8051f9 <ipc_call>
+  803b55:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803b57:	83 c4 20             	add    $0x20,%esp
+  803b5a:	85 c0                	test   %eax,%eax
+  803b5c:	0f 88 b8 01 00 00    	js     803d1a <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803b62:	89 f0                	mov    %esi,%eax
+  803b64:	c1 e8 0c             	shr    $0xc,%eax
+  803b67:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b6e:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803b71:	83 ec 08             	sub    $0x8,%esp
+  803b74:	56                   	push   %esi
+  803b75:	6a 00                	push   $0x0
+  803b77:	e8 2a d4 ff ff       	call   800fa6 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803b7c:	83 c4 08             	add    $0x8,%esp
+  803b7f:	6a 01                	push   $0x1
+  803b81:	56                   	push   %esi
+  803b82:	e8 92 fe ff ff       	call   803a19 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803b87:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803b8a:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803b90:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803b93:	09 fe                	or     %edi,%esi
+  803b95:	83 ce 01             	or     $0x1,%esi
+  803b98:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803b9a:	83 c4 10             	add    $0x10,%esp
+}
+  803b9d:	89 d8                	mov    %ebx,%eax
+  803b9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ba2:	5b                   	pop    %ebx
+  803ba3:	5e                   	pop    %esi
+  803ba4:	5f                   	pop    %edi
+  803ba5:	5d                   	pop    %ebp
+  803ba6:	c3                   	ret
+		num_page_reclaims++;
+  803ba7:	83 05 04 c0 80 00 01 	addl   $0x1,0x80c004
+		return 0;
+  803bae:	eb ed                	jmp    803b9d <page_out+0xda>
+		num_page_drops++;
+  803bb0:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+		return sys_page_unmap(0, map_out_addr);
+  803bb7:	83 ec 08             	sub    $0x8,%esp
+  803bba:	56                   	push   %esi
+  803bbb:	6a 00                	push   $0x0
+  803bbd:	e8 e4 d3 ff ff       	call   800fa6 <sys_page_unmap>
+  803bc2:	89 c3                	mov    %eax,%ebx
+  803bc4:	83 c4 10             	add    $0x10,%esp
+  803bc7:	eb d4                	jmp    803b9d <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803bc9:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803bcb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803bd0:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803bd5:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803bd8:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803bda:	83 c0 08             	add    $0x8,%eax
+  803bdd:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803be0:	b8 07 00 00 00       	mov    $0x7,%eax
+  803be5:	e8 e5 ef ff ff       	call   802bcf <page_ring_reserve>
+	first = ring->sq_tail;
+  803bea:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803bef:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803bf2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803bf7:	83 ec 04             	sub    $0x4,%esp
+  803bfa:	68 00 10 00 00       	push   $0x1000
+  803bff:	56                   	push   %esi
+  803c00:	89 d8                	mov    %ebx,%eax
+  803c02:	c1 e0 0c             	shl    $0xc,%eax
+  803c05:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803c0a:	50                   	push   %eax
+  803c0b:	e8 06 d0 ff ff       	call   800c16 <memcpy>
+		vas[n] = va;
+  803c10:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803c14:	89 d9                	mov    %ebx,%ecx
+  803c16:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c1b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803c20:	e8 de ee ff ff       	call   802b03 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803c25:	8d 43 01             	lea    0x1(%ebx),%eax
+  803c28:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803c2b:	83 c4 10             	add    $0x10,%esp
+  803c2e:	83 fb 06             	cmp    $0x6,%ebx
+  803c31:	74 62                	je     803c95 <page_out+0x1d2>
+  803c33:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803c36:	eb 15                	jmp    803c4d <page_out+0x18a>
+			num_page_drops++;
+  803c38:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+			sys_page_unmap(0, va);
+  803c3f:	83 ec 08             	sub    $0x8,%esp
+  803c42:	56                   	push   %esi
+  803c43:	6a 00                	push   $0x0
+  803c45:	e8 5c d3 ff ff       	call   800fa6 <sys_page_unmap>
+  803c4a:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803c4d:	83 ec 08             	sub    $0x8,%esp
+  803c50:	53                   	push   %ebx
+  803c51:	57                   	push   %edi
+  803c52:	e8 99 f8 ff ff       	call   8034f0 <get_page_choice>
+  803c57:	89 c6                	mov    %eax,%esi
+  803c59:	83 c4 10             	add    $0x10,%esp
+  803c5c:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803c61:	74 32                	je     803c95 <page_out+0x1d2>
+  803c63:	e8 2c ed ff ff       	call   802994 <page_is_clean>
+  803c68:	84 c0                	test   %al,%al
+  803c6a:	75 cc                	jne    803c38 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803c6c:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803c6f:	39 c6                	cmp    %eax,%esi
+  803c71:	72 07                	jb     803c7a <page_out+0x1b7>
+  803c73:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803c76:	39 c6                	cmp    %eax,%esi
+  803c78:	72 1b                	jb     803c95 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803c7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c7f:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803c82:	eb 03                	jmp    803c87 <page_out+0x1c4>
+  803c84:	83 c3 01             	add    $0x1,%ebx
+  803c87:	39 da                	cmp    %ebx,%edx
+  803c89:	0f 84 68 ff ff ff    	je     803bf7 <page_out+0x134>
+  803c8f:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803c93:	75 ef                	jne    803c84 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803c95:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803c98:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803c9b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803c9e:	e8 a6 ee ff ff       	call   802b49 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803ca3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ca8:	eb 42                	jmp    803cec <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803caa:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803cae:	89 f8                	mov    %edi,%eax
+  803cb0:	c1 e8 0c             	shr    $0xc,%eax
+  803cb3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803cba:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803cbd:	83 ec 08             	sub    $0x8,%esp
+  803cc0:	57                   	push   %edi
+  803cc1:	6a 00                	push   $0x0
+  803cc3:	e8 de d2 ff ff       	call   800fa6 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803cc8:	83 c4 08             	add    $0x8,%esp
+  803ccb:	6a 01                	push   $0x1
+  803ccd:	57                   	push   %edi
+  803cce:	e8 46 fd ff ff       	call   803a19 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803cd3:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803cd6:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803cdc:	c1 e6 0c             	shl    $0xc,%esi
+  803cdf:	09 d6                	or     %edx,%esi
+  803ce1:	83 ce 01             	or     $0x1,%esi
+  803ce4:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803ce6:	83 c3 01             	add    $0x1,%ebx
+  803ce9:	83 c4 10             	add    $0x10,%esp
+  803cec:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803cef:	39 c3                	cmp    %eax,%ebx
+  803cf1:	74 1d                	je     803d10 <page_out+0x24d>
+		if (res[i] < 0)
+  803cf3:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803cf7:	85 f6                	test   %esi,%esi
+  803cf9:	79 af                	jns    803caa <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803cfb:	56                   	push   %esi
+  803cfc:	68 04 60 80 00       	push   $0x806004
+  803d01:	68 d1 02 00 00       	push   $0x2d1
+  803d06:	68 1b 5d 80 00       	push   $0x805d1b
+  803d0b:	e8 5c c6 ff ff       	call   80036c <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803d10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d15:	e9 83 fe ff ff       	jmp    803b9d <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803d1a:	50                   	push   %eax
+  803d1b:	68 04 60 80 00       	push   $0x806004
+  803d20:	68 0a 03 00 00       	push   $0x30a
+  803d25:	68 1b 5d 80 00       	push   $0x805d1b
+  803d2a:	e8 3d c6 ff ff       	call   80036c <_panic>
+		return -E_NO_MEM;
+  803d2f:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803d34:	e9 64 fe ff ff       	jmp    803b9d <page_out+0xda>
+		return -E_PAGING;
+  803d39:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803d3e:	e9 5a fe ff ff       	jmp    803b9d <page_out+0xda>
+
+00803d43 <page_alloc>:
+{
+  803d43:	55                   	push   %ebp
+  803d44:	89 e5                	mov    %esp,%ebp
+  803d46:	57                   	push   %edi
+  803d47:	56                   	push   %esi
+  803d48:	53                   	push   %ebx
+  803d49:	83 ec 0c             	sub    $0xc,%esp
+  803d4c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803d4f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803d52:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803d59:	74 34                	je     803d8f <page_alloc+0x4c>
+	if (check_mte)
+  803d5b:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803d5f:	75 35                	jne    803d96 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803d61:	83 ec 04             	sub    $0x4,%esp
+  803d64:	ff 75 10             	push   0x10(%ebp)
+  803d67:	56                   	push   %esi
+  803d68:	57                   	push   %edi
+  803d69:	e8 b3 d1 ff ff       	call   800f21 <sys_page_alloc>
+  803d6e:	89 c3                	mov    %eax,%ebx
+  803d70:	83 c4 10             	add    $0x10,%esp
+  803d73:	85 c0                	test   %eax,%eax
+  803d75:	79 52                	jns    803dc9 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803d77:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803d7a:	75 52                	jne    803dce <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803d7c:	83 ec 08             	sub    $0x8,%esp
+  803d7f:	56                   	push   %esi
+  803d80:	57                   	push   %edi
+  803d81:	e8 3d fd ff ff       	call   803ac3 <page_out>
+  803d86:	83 c4 10             	add    $0x10,%esp
+  803d89:	85 c0                	test   %eax,%eax
+  803d8b:	79 d4                	jns    803d61 <page_alloc+0x1e>
+  803d8d:	eb 3f                	jmp    803dce <page_alloc+0x8b>
+		init_map_dir();
+  803d8f:	e8 2f fc ff ff       	call   8039c3 <init_map_dir>
+  803d94:	eb c5                	jmp    803d5b <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803d96:	83 ec 08             	sub    $0x8,%esp
+  803d99:	6a 00                	push   $0x0
+  803d9b:	56                   	push   %esi
+  803d9c:	e8 78 fc ff ff       	call   803a19 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803da1:	83 c4 10             	add    $0x10,%esp
+  803da4:	85 c0                	test   %eax,%eax
+  803da6:	74 b9                	je     803d61 <page_alloc+0x1e>
+  803da8:	8b 10                	mov    (%eax),%edx
+  803daa:	f6 c2 01             	test   $0x1,%dl
+  803dad:	74 b2                	je     803d61 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803daf:	83 ec 08             	sub    $0x8,%esp
+  803db2:	56                   	push   %esi
+  803db3:	52                   	push   %edx
+  803db4:	50                   	push   %eax
+  803db5:	68 28 60 80 00       	push   $0x806028
+  803dba:	68 34 03 00 00       	push   $0x334
+  803dbf:	68 1b 5d 80 00       	push   $0x805d1b
+  803dc4:	e8 a3 c5 ff ff       	call   80036c <_panic>
+	return 0;
+  803dc9:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803dce:	89 d8                	mov    %ebx,%eax
+  803dd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dd3:	5b                   	pop    %ebx
+  803dd4:	5e                   	pop    %esi
+  803dd5:	5f                   	pop    %edi
+  803dd6:	5d                   	pop    %ebp
+  803dd7:	c3                   	ret
+
+00803dd8 <page_adopt>:
+{
+  803dd8:	55                   	push   %ebp
+  803dd9:	89 e5                	mov    %esp,%ebp
+  803ddb:	56                   	push   %esi
+  803ddc:	53                   	push   %ebx
+  803ddd:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803ddf:	c1 e8 16             	shr    $0x16,%eax
+  803de2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803de9:	25 81 00 00 00       	and    $0x81,%eax
+  803dee:	83 f8 01             	cmp    $0x1,%eax
+  803df1:	75 53                	jne    803e46 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803df3:	89 d8                	mov    %ebx,%eax
+  803df5:	c1 e8 0c             	shr    $0xc,%eax
+  803df8:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803dff:	89 f2                	mov    %esi,%edx
+  803e01:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803e07:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803e0c:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803e12:	75 37                	jne    803e4b <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803e14:	83 ec 08             	sub    $0x8,%esp
+  803e17:	6a 01                	push   $0x1
+  803e19:	53                   	push   %ebx
+  803e1a:	e8 fa fb ff ff       	call   803a19 <umapdir_walk>
+  803e1f:	83 c4 10             	add    $0x10,%esp
+  803e22:	85 c0                	test   %eax,%eax
+  803e24:	74 2c                	je     803e52 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803e26:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803e2c:	83 ce 01             	or     $0x1,%esi
+  803e2f:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803e31:	83 ec 08             	sub    $0x8,%esp
+  803e34:	53                   	push   %ebx
+  803e35:	6a 00                	push   $0x0
+  803e37:	e8 6a d1 ff ff       	call   800fa6 <sys_page_unmap>
+	return 1;
+  803e3c:	83 c4 10             	add    $0x10,%esp
+  803e3f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803e44:	eb 05                	jmp    803e4b <page_adopt+0x73>
+		return 0;
+  803e46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e4e:	5b                   	pop    %ebx
+  803e4f:	5e                   	pop    %esi
+  803e50:	5d                   	pop    %ebp
+  803e51:	c3                   	ret
+		return -E_NO_MEM;
+  803e52:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803e57:	eb f2                	jmp    803e4b <page_adopt+0x73>
+
+00803e59 <page_forget>:
+{
+  803e59:	55                   	push   %ebp
+  803e5a:	89 e5                	mov    %esp,%ebp
+  803e5c:	53                   	push   %ebx
+  803e5d:	83 ec 04             	sub    $0x4,%esp
+  803e60:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803e62:	e8 4a ef ff ff       	call   802db1 <find_paging_env>
+	if (pagingenv == 0)
+  803e67:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803e6e:	74 39                	je     803ea9 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803e70:	89 d8                	mov    %ebx,%eax
+  803e72:	c1 e8 16             	shr    $0x16,%eax
+  803e75:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803e7c:	25 81 00 00 00       	and    $0x81,%eax
+  803e81:	83 f8 01             	cmp    $0x1,%eax
+  803e84:	74 28                	je     803eae <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803e86:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803e8d:	74 1a                	je     803ea9 <page_forget+0x50>
+  803e8f:	83 ec 08             	sub    $0x8,%esp
+  803e92:	6a 00                	push   $0x0
+  803e94:	53                   	push   %ebx
+  803e95:	e8 7f fb ff ff       	call   803a19 <umapdir_walk>
+  803e9a:	89 c3                	mov    %eax,%ebx
+  803e9c:	83 c4 10             	add    $0x10,%esp
+  803e9f:	85 c0                	test   %eax,%eax
+  803ea1:	74 06                	je     803ea9 <page_forget+0x50>
+  803ea3:	8b 00                	mov    (%eax),%eax
+  803ea5:	a8 01                	test   $0x1,%al
+  803ea7:	75 2b                	jne    803ed4 <page_forget+0x7b>
+}
+  803ea9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803eac:	c9                   	leave
+  803ead:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803eae:	89 d8                	mov    %ebx,%eax
+  803eb0:	c1 e8 0c             	shr    $0xc,%eax
+  803eb3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803eba:	89 c2                	mov    %eax,%edx
+  803ebc:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803ec2:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803ec8:	75 bc                	jne    803e86 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803eca:	c1 e8 0c             	shr    $0xc,%eax
+  803ecd:	e8 5c ee ff ff       	call   802d2e <page_remove_slot>
+		return;
+  803ed2:	eb d5                	jmp    803ea9 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803ed4:	c1 e8 0c             	shr    $0xc,%eax
+  803ed7:	e8 52 ee ff ff       	call   802d2e <page_remove_slot>
+	*mte = 0;
+  803edc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803ee2:	eb c5                	jmp    803ea9 <page_forget+0x50>
+
+00803ee4 <page_unmap>:
+{
+  803ee4:	55                   	push   %ebp
+  803ee5:	89 e5                	mov    %esp,%ebp
+  803ee7:	57                   	push   %edi
+  803ee8:	56                   	push   %esi
+  803ee9:	53                   	push   %ebx
+  803eea:	83 ec 0c             	sub    $0xc,%esp
+  803eed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803ef0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803ef3:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803ef8:	8b 40 48             	mov    0x48(%eax),%eax
+  803efb:	85 db                	test   %ebx,%ebx
+  803efd:	0f 8e b4 00 00 00    	jle    803fb7 <page_unmap+0xd3>
+  803f03:	39 d8                	cmp    %ebx,%eax
+  803f05:	0f 84 ac 00 00 00    	je     803fb7 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803f0b:	83 ec 08             	sub    $0x8,%esp
+  803f0e:	57                   	push   %edi
+  803f0f:	53                   	push   %ebx
+  803f10:	e8 91 d0 ff ff       	call   800fa6 <sys_page_unmap>
+  803f15:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803f17:	e8 95 ee ff ff       	call   802db1 <find_paging_env>
+	if (pagingenv == 0)
+  803f1c:	83 c4 10             	add    $0x10,%esp
+  803f1f:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803f26:	0f 84 a1 00 00 00    	je     803fcd <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803f2c:	83 ec 0c             	sub    $0xc,%esp
+  803f2f:	6a 05                	push   $0x5
+  803f31:	68 00 00 40 00       	push   $0x400000
+  803f36:	6a 00                	push   $0x0
+  803f38:	68 00 b0 ad de       	push   $0xdeadb000
+  803f3d:	53                   	push   %ebx
+  803f3e:	e8 21 d0 ff ff       	call   800f64 <sys_page_map>
+  803f43:	83 c4 20             	add    $0x20,%esp
+  803f46:	85 c0                	test   %eax,%eax
+  803f48:	0f 88 89 00 00 00    	js     803fd7 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803f4e:	89 f8                	mov    %edi,%eax
+  803f50:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803f53:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803f5a:	a8 01                	test   $0x1,%al
+  803f5c:	74 6f                	je     803fcd <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803f5e:	83 ec 0c             	sub    $0xc,%esp
+  803f61:	6a 05                	push   $0x5
+  803f63:	68 00 00 40 00       	push   $0x400000
+  803f68:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803f6a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803f6f:	50                   	push   %eax
+  803f70:	53                   	push   %ebx
+  803f71:	e8 ee cf ff ff       	call   800f64 <sys_page_map>
+  803f76:	83 c4 20             	add    $0x20,%esp
+  803f79:	85 c0                	test   %eax,%eax
+  803f7b:	78 6f                	js     803fec <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803f7d:	c1 ef 0c             	shr    $0xc,%edi
+  803f80:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803f86:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803f8d:	01 
+  803f8e:	74 3d                	je     803fcd <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803f90:	83 ec 08             	sub    $0x8,%esp
+  803f93:	68 00 00 40 00       	push   $0x400000
+  803f98:	6a 00                	push   $0x0
+  803f9a:	e8 07 d0 ff ff       	call   800fa6 <sys_page_unmap>
+  803f9f:	83 c4 10             	add    $0x10,%esp
+  803fa2:	85 c0                	test   %eax,%eax
+  803fa4:	78 5b                	js     804001 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803fa6:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803fad:	c1 e8 0c             	shr    $0xc,%eax
+  803fb0:	e8 79 ed ff ff       	call   802d2e <page_remove_slot>
+	return r;
+  803fb5:	eb 16                	jmp    803fcd <page_unmap+0xe9>
+		page_forget(va);
+  803fb7:	89 f8                	mov    %edi,%eax
+  803fb9:	e8 9b fe ff ff       	call   803e59 <page_forget>
+		return sys_page_unmap(envid, va);
+  803fbe:	83 ec 08             	sub    $0x8,%esp
+  803fc1:	57                   	push   %edi
+  803fc2:	53                   	push   %ebx
+  803fc3:	e8 de cf ff ff       	call   800fa6 <sys_page_unmap>
+  803fc8:	89 c6                	mov    %eax,%esi
+  803fca:	83 c4 10             	add    $0x10,%esp
+}
+  803fcd:	89 f0                	mov    %esi,%eax
+  803fcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fd2:	5b                   	pop    %ebx
+  803fd3:	5e                   	pop    %esi
+  803fd4:	5f                   	pop    %edi
+  803fd5:	5d                   	pop    %ebp
+  803fd6:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803fd7:	50                   	push   %eax
+  803fd8:	68 64 60 80 00       	push   $0x806064
+  803fdd:	68 e4 03 00 00       	push   $0x3e4
+  803fe2:	68 1b 5d 80 00       	push   $0x805d1b
+  803fe7:	e8 80 c3 ff ff       	call   80036c <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803fec:	50                   	push   %eax
+  803fed:	68 90 60 80 00       	push   $0x806090
+  803ff2:	68 ea 03 00 00       	push   $0x3ea
+  803ff7:	68 1b 5d 80 00       	push   $0x805d1b
+  803ffc:	e8 6b c3 ff ff       	call   80036c <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  804001:	50                   	push   %eax
+  804002:	68 bc 60 80 00       	push   $0x8060bc
+  804007:	68 ef 03 00 00       	push   $0x3ef
+  80400c:	68 1b 5d 80 00       	push   $0x805d1b
+  804011:	e8 56 c3 ff ff       	call   80036c <_panic>
+
+00804016 <page_unmap_range>:
+{
+  804016:	55                   	push   %ebp
+  804017:	89 e5                	mov    %esp,%ebp
+  804019:	57                   	push   %edi
+  80401a:	56                   	push   %esi
+  80401b:	53                   	push   %ebx
+  80401c:	83 ec 0c             	sub    $0xc,%esp
+  80401f:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  804022:	e8 8a ed ff ff       	call   802db1 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  804027:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80402c:	8b 40 48             	mov    0x48(%eax),%eax
+  80402f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804033:	7e 38                	jle    80406d <page_unmap_range+0x57>
+  804035:	3b 45 08             	cmp    0x8(%ebp),%eax
+  804038:	74 33                	je     80406d <page_unmap_range+0x57>
+  80403a:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  804041:	74 2a                	je     80406d <page_unmap_range+0x57>
+  804043:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  804046:	be 00 00 00 00       	mov    $0x0,%esi
+  80404b:	39 fe                	cmp    %edi,%esi
+  80404d:	74 56                	je     8040a5 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  80404f:	83 ec 08             	sub    $0x8,%esp
+  804052:	53                   	push   %ebx
+  804053:	ff 75 08             	push   0x8(%ebp)
+  804056:	e8 89 fe ff ff       	call   803ee4 <page_unmap>
+  80405b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  804061:	83 c4 10             	add    $0x10,%esp
+  804064:	85 c0                	test   %eax,%eax
+  804066:	78 35                	js     80409d <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  804068:	83 c6 01             	add    $0x1,%esi
+  80406b:	eb de                	jmp    80404b <page_unmap_range+0x35>
+  80406d:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  804070:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804075:	eb 10                	jmp    804087 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  804077:	89 f0                	mov    %esi,%eax
+  804079:	e8 db fd ff ff       	call   803e59 <page_forget>
+		for (i = 0; i < npages; i++)
+  80407e:	83 c3 01             	add    $0x1,%ebx
+  804081:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  804087:	39 fb                	cmp    %edi,%ebx
+  804089:	75 ec                	jne    804077 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  80408b:	83 ec 04             	sub    $0x4,%esp
+  80408e:	57                   	push   %edi
+  80408f:	ff 75 0c             	push   0xc(%ebp)
+  804092:	ff 75 08             	push   0x8(%ebp)
+  804095:	e8 20 d0 ff ff       	call   8010ba <sys_page_unmap_range>
+  80409a:	83 c4 10             	add    $0x10,%esp
+}
+  80409d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040a0:	5b                   	pop    %ebx
+  8040a1:	5e                   	pop    %esi
+  8040a2:	5f                   	pop    %edi
+  8040a3:	5d                   	pop    %ebp
+  8040a4:	c3                   	ret
+	return 0;
+  8040a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040aa:	eb f1                	jmp    80409d <page_unmap_range+0x87>
+
+008040ac <page_alloc_range>:
+{
+  8040ac:	55                   	push   %ebp
+  8040ad:	89 e5                	mov    %esp,%ebp
+  8040af:	57                   	push   %edi
+  8040b0:	56                   	push   %esi
+  8040b1:	53                   	push   %ebx
+  8040b2:	83 ec 1c             	sub    $0x1c,%esp
+  8040b5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8040b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  8040bb:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  8040c2:	74 14                	je     8040d8 <page_alloc_range+0x2c>
+	if (check_mte)
+  8040c4:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8040c8:	74 66                	je     804130 <page_alloc_range+0x84>
+  8040ca:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  8040cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040d1:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  8040d4:	89 c7                	mov    %eax,%edi
+  8040d6:	eb 10                	jmp    8040e8 <page_alloc_range+0x3c>
+		init_map_dir();
+  8040d8:	e8 e6 f8 ff ff       	call   8039c3 <init_map_dir>
+  8040dd:	eb e5                	jmp    8040c4 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  8040df:	83 c7 01             	add    $0x1,%edi
+  8040e2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8040e8:	39 df                	cmp    %ebx,%edi
+  8040ea:	74 38                	je     804124 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  8040ec:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8040ef:	83 ec 08             	sub    $0x8,%esp
+  8040f2:	6a 00                	push   $0x0
+  8040f4:	56                   	push   %esi
+  8040f5:	e8 1f f9 ff ff       	call   803a19 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  8040fa:	83 c4 10             	add    $0x10,%esp
+  8040fd:	85 c0                	test   %eax,%eax
+  8040ff:	74 de                	je     8040df <page_alloc_range+0x33>
+  804101:	8b 10                	mov    (%eax),%edx
+  804103:	f6 c2 01             	test   $0x1,%dl
+  804106:	74 d7                	je     8040df <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  804108:	83 ec 08             	sub    $0x8,%esp
+  80410b:	ff 75 e4             	push   -0x1c(%ebp)
+  80410e:	52                   	push   %edx
+  80410f:	50                   	push   %eax
+  804110:	68 28 60 80 00       	push   $0x806028
+  804115:	68 0b 04 00 00       	push   $0x40b
+  80411a:	68 1b 5d 80 00       	push   $0x805d1b
+  80411f:	e8 48 c2 ff ff       	call   80036c <_panic>
+  804124:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804127:	eb 07                	jmp    804130 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  804129:	c1 e0 0c             	shl    $0xc,%eax
+  80412c:	01 c7                	add    %eax,%edi
+			npages -= r;
+  80412e:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  804130:	85 db                	test   %ebx,%ebx
+  804132:	74 30                	je     804164 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  804134:	ff 75 14             	push   0x14(%ebp)
+  804137:	53                   	push   %ebx
+  804138:	57                   	push   %edi
+  804139:	ff 75 08             	push   0x8(%ebp)
+  80413c:	e8 0b cf ff ff       	call   80104c <sys_page_alloc_range>
+  804141:	89 c6                	mov    %eax,%esi
+  804143:	83 c4 10             	add    $0x10,%esp
+  804146:	85 c0                	test   %eax,%eax
+  804148:	7f df                	jg     804129 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  80414a:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  80414d:	75 1a                	jne    804169 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  80414f:	83 ec 08             	sub    $0x8,%esp
+  804152:	57                   	push   %edi
+  804153:	ff 75 08             	push   0x8(%ebp)
+  804156:	e8 68 f9 ff ff       	call   803ac3 <page_out>
+  80415b:	83 c4 10             	add    $0x10,%esp
+  80415e:	85 c0                	test   %eax,%eax
+  804160:	79 ce                	jns    804130 <page_alloc_range+0x84>
+  804162:	eb 05                	jmp    804169 <page_alloc_range+0xbd>
+	return 0;
+  804164:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  804169:	89 f0                	mov    %esi,%eax
+  80416b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80416e:	5b                   	pop    %ebx
+  80416f:	5e                   	pop    %esi
+  804170:	5f                   	pop    %edi
+  804171:	5d                   	pop    %ebp
+  804172:	c3                   	ret
+
+00804173 <page_in>:
+{
+  804173:	55                   	push   %ebp
+  804174:	89 e5                	mov    %esp,%ebp
+  804176:	57                   	push   %edi
+  804177:	56                   	push   %esi
+  804178:	53                   	push   %ebx
+  804179:	83 ec 3c             	sub    $0x3c,%esp
+  80417c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  80417f:	e8 2d ec ff ff       	call   802db1 <find_paging_env>
+	if (pagingenv == 0)
+  804184:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  80418b:	0f 84 09 02 00 00    	je     80439a <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  804191:	83 ec 08             	sub    $0x8,%esp
+  804194:	6a 00                	push   $0x0
+  804196:	56                   	push   %esi
+  804197:	e8 7d f8 ff ff       	call   803a19 <umapdir_walk>
+  80419c:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80419e:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8041a4:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  8041a7:	83 c4 10             	add    $0x10,%esp
+  8041aa:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8041ae:	74 0d                	je     8041bd <page_in+0x4a>
+  8041b0:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8041b5:	8b 40 48             	mov    0x48(%eax),%eax
+  8041b8:	3b 45 08             	cmp    0x8(%ebp),%eax
+  8041bb:	75 06                	jne    8041c3 <page_in+0x50>
+  8041bd:	8b 03                	mov    (%ebx),%eax
+  8041bf:	a8 02                	test   $0x2,%al
+  8041c1:	75 63                	jne    804226 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  8041c3:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  8041c5:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  8041c7:	89 f0                	mov    %esi,%eax
+  8041c9:	25 06 0e 00 00       	and    $0xe06,%eax
+  8041ce:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  8041d1:	50                   	push   %eax
+  8041d2:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  8041d5:	57                   	push   %edi
+  8041d6:	ff 75 08             	push   0x8(%ebp)
+  8041d9:	e8 65 fb ff ff       	call   803d43 <page_alloc>
+  8041de:	83 c4 10             	add    $0x10,%esp
+  8041e1:	85 c0                	test   %eax,%eax
+  8041e3:	78 39                	js     80421e <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  8041e5:	89 f0                	mov    %esi,%eax
+  8041e7:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8041ea:	83 ec 0c             	sub    $0xc,%esp
+  8041ed:	6a 07                	push   $0x7
+  8041ef:	6a 01                	push   $0x1
+  8041f1:	57                   	push   %edi
+  8041f2:	c1 e0 04             	shl    $0x4,%eax
+  8041f5:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8041f6:	c1 ee 1c             	shr    $0x1c,%esi
+  8041f9:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8041fc:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  804203:	e8 f1 0f 00 00       	call   8051f9 <ipc_call>
+  804208:	83 c4 20             	add    $0x20,%esp
+  80420b:	85 c0                	test   %eax,%eax
+  80420d:	0f 88 72 01 00 00    	js     804385 <page_in+0x212>
+	*mte = 0;
+  804213:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  804219:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80421e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804221:	5b                   	pop    %ebx
+  804222:	5e                   	pop    %esi
+  804223:	5f                   	pop    %edi
+  804224:	5d                   	pop    %ebp
+  804225:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804226:	25 06 0e 00 00       	and    $0xe06,%eax
+  80422b:	83 c8 01             	or     $0x1,%eax
+  80422e:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  804231:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804234:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  804237:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  80423d:	be 01 00 00 00       	mov    $0x1,%esi
+  804242:	eb 46                	jmp    80428a <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  804244:	83 ec 08             	sub    $0x8,%esp
+  804247:	6a 00                	push   $0x0
+  804249:	51                   	push   %ecx
+  80424a:	e8 ca f7 ff ff       	call   803a19 <umapdir_walk>
+  80424f:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  804253:	83 c4 10             	add    $0x10,%esp
+  804256:	85 c0                	test   %eax,%eax
+  804258:	74 66                	je     8042c0 <page_in+0x14d>
+  80425a:	8b 00                	mov    (%eax),%eax
+  80425c:	a8 01                	test   $0x1,%al
+  80425e:	74 60                	je     8042c0 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  804260:	89 c2                	mov    %eax,%edx
+  804262:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  804268:	83 ca 01             	or     $0x1,%edx
+  80426b:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  80426e:	75 50                	jne    8042c0 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  804270:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804276:	c1 e8 1c             	shr    $0x1c,%eax
+  804279:	8b 13                	mov    (%ebx),%edx
+  80427b:	c1 ea 1c             	shr    $0x1c,%edx
+  80427e:	39 d0                	cmp    %edx,%eax
+  804280:	75 3e                	jne    8042c0 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804282:	83 c6 01             	add    $0x1,%esi
+  804285:	83 fe 08             	cmp    $0x8,%esi
+  804288:	74 3f                	je     8042c9 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  80428a:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  80428c:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  804292:	77 2c                	ja     8042c0 <page_in+0x14d>
+  804294:	89 f8                	mov    %edi,%eax
+  804296:	c1 e8 16             	shr    $0x16,%eax
+  804299:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8042a0:	f6 c2 01             	test   $0x1,%dl
+  8042a3:	74 9f                	je     804244 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  8042a5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8042ac:	a8 80                	test   $0x80,%al
+  8042ae:	75 10                	jne    8042c0 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  8042b0:	89 f8                	mov    %edi,%eax
+  8042b2:	c1 e8 0c             	shr    $0xc,%eax
+  8042b5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8042bc:	a8 01                	test   $0x1,%al
+  8042be:	74 84                	je     804244 <page_in+0xd1>
+	if (n == 1)
+  8042c0:	83 fe 01             	cmp    $0x1,%esi
+  8042c3:	0f 84 fa fe ff ff    	je     8041c3 <page_in+0x50>
+	req.nslots = n;
+  8042c9:	89 35 00 90 80 00    	mov    %esi,0x809000
+	for (i = 0; i < n; i++)
+  8042cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042d4:	eb 13                	jmp    8042e9 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  8042d6:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  8042da:	8b 12                	mov    (%edx),%edx
+  8042dc:	c1 ea 0c             	shr    $0xc,%edx
+  8042df:	89 14 85 04 90 80 00 	mov    %edx,0x809004(,%eax,4)
+	for (i = 0; i < n; i++)
+  8042e6:	83 c0 01             	add    $0x1,%eax
+  8042e9:	39 c6                	cmp    %eax,%esi
+  8042eb:	75 e9                	jne    8042d6 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  8042ed:	83 ec 0c             	sub    $0xc,%esp
+  8042f0:	6a 00                	push   $0x0
+  8042f2:	ff 75 c0             	push   -0x40(%ebp)
+  8042f5:	56                   	push   %esi
+  8042f6:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  8042f9:	57                   	push   %edi
+  8042fa:	6a 00                	push   $0x0
+  8042fc:	e8 ab fd ff ff       	call   8040ac <page_alloc_range>
+  804301:	83 c4 20             	add    $0x20,%esp
+  804304:	85 c0                	test   %eax,%eax
+  804306:	78 6e                	js     804376 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  804308:	83 ec 04             	sub    $0x4,%esp
+  80430b:	6a 24                	push   $0x24
+  80430d:	68 00 90 80 00       	push   $0x809000
+  804312:	57                   	push   %edi
+  804313:	e8 9c c8 ff ff       	call   800bb4 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804318:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80431f:	56                   	push   %esi
+  804320:	57                   	push   %edi
+  804321:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  804323:	0f b7 05 06 90 80 00 	movzwl 0x809006,%eax
+  80432a:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  80432d:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  804334:	e8 c0 0e 00 00       	call   8051f9 <ipc_call>
+  804339:	83 c4 20             	add    $0x20,%esp
+  80433c:	85 c0                	test   %eax,%eax
+  80433e:	78 08                	js     804348 <page_in+0x1d5>
+  804340:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  804343:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  804346:	eb 20                	jmp    804368 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  804348:	50                   	push   %eax
+  804349:	68 e8 60 80 00       	push   $0x8060e8
+  80434e:	68 59 02 00 00       	push   $0x259
+  804353:	68 1b 5d 80 00       	push   $0x805d1b
+  804358:	e8 0f c0 ff ff       	call   80036c <_panic>
+		*mtes[i] = 0;
+  80435d:	8b 10                	mov    (%eax),%edx
+  80435f:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  804365:	83 c0 04             	add    $0x4,%eax
+  804368:	39 c8                	cmp    %ecx,%eax
+  80436a:	75 f1                	jne    80435d <page_in+0x1ea>
+	return n;
+  80436c:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  80436e:	85 f6                	test   %esi,%esi
+  804370:	0f 84 4d fe ff ff    	je     8041c3 <page_in+0x50>
+		return r < 0 ? r : 0;
+  804376:	85 c0                	test   %eax,%eax
+  804378:	ba 00 00 00 00       	mov    $0x0,%edx
+  80437d:	0f 4f c2             	cmovg  %edx,%eax
+  804380:	e9 99 fe ff ff       	jmp    80421e <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  804385:	50                   	push   %eax
+  804386:	68 20 61 80 00       	push   $0x806120
+  80438b:	68 9a 02 00 00       	push   $0x29a
+  804390:	68 1b 5d 80 00       	push   $0x805d1b
+  804395:	e8 d2 bf ff ff       	call   80036c <_panic>
+		return -E_PAGING;
+  80439a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80439f:	e9 7a fe ff ff       	jmp    80421e <page_in+0xab>
+
+008043a4 <page_map>:
+{
+  8043a4:	55                   	push   %ebp
+  8043a5:	89 e5                	mov    %esp,%ebp
+  8043a7:	57                   	push   %edi
+  8043a8:	56                   	push   %esi
+  8043a9:	53                   	push   %ebx
+  8043aa:	83 ec 1c             	sub    $0x1c,%esp
+  8043ad:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8043b0:	83 ec 0c             	sub    $0xc,%esp
+  8043b3:	ff 75 18             	push   0x18(%ebp)
+  8043b6:	ff 75 14             	push   0x14(%ebp)
+  8043b9:	ff 75 10             	push   0x10(%ebp)
+  8043bc:	ff 75 0c             	push   0xc(%ebp)
+  8043bf:	56                   	push   %esi
+  8043c0:	e8 9f cb ff ff       	call   800f64 <sys_page_map>
+  8043c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8043c8:	83 c4 20             	add    $0x20,%esp
+  8043cb:	85 c0                	test   %eax,%eax
+  8043cd:	0f 89 a9 01 00 00    	jns    80457c <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  8043d3:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  8043d7:	74 5f                	je     804438 <page_map+0x94>
+		if (r != -E_INVAL)
+  8043d9:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  8043dd:	0f 85 a0 01 00 00    	jne    804583 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8043e3:	85 f6                	test   %esi,%esi
+  8043e5:	74 70                	je     804457 <page_map+0xb3>
+  8043e7:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8043ec:	8b 40 48             	mov    0x48(%eax),%eax
+  8043ef:	39 f0                	cmp    %esi,%eax
+  8043f1:	74 64                	je     804457 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8043f3:	83 ec 0c             	sub    $0xc,%esp
+  8043f6:	6a 05                	push   $0x5
+  8043f8:	68 00 00 40 00       	push   $0x400000
+  8043fd:	6a 00                	push   $0x0
+  8043ff:	68 00 b0 ad de       	push   $0xdeadb000
+  804404:	56                   	push   %esi
+  804405:	e8 5a cb ff ff       	call   800f64 <sys_page_map>
+  80440a:	89 c3                	mov    %eax,%ebx
+  80440c:	83 c4 20             	add    $0x20,%esp
+  80440f:	85 c0                	test   %eax,%eax
+  804411:	79 6a                	jns    80447d <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  804413:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804416:	75 50                	jne    804468 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  804418:	83 ec 08             	sub    $0x8,%esp
+  80441b:	68 00 00 40 00       	push   $0x400000
+  804420:	6a fc                	push   $0xfffffffc
+  804422:	e8 9c f6 ff ff       	call   803ac3 <page_out>
+  804427:	83 c4 10             	add    $0x10,%esp
+  80442a:	85 c0                	test   %eax,%eax
+  80442c:	79 c5                	jns    8043f3 <page_map+0x4f>
+}
+  80442e:	89 d8                	mov    %ebx,%eax
+  804430:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804433:	5b                   	pop    %ebx
+  804434:	5e                   	pop    %esi
+  804435:	5f                   	pop    %edi
+  804436:	5d                   	pop    %ebp
+  804437:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  804438:	83 ec 08             	sub    $0x8,%esp
+  80443b:	68 00 00 40 00       	push   $0x400000
+  804440:	6a 00                	push   $0x0
+  804442:	e8 7c f6 ff ff       	call   803ac3 <page_out>
+  804447:	83 c4 10             	add    $0x10,%esp
+  80444a:	85 c0                	test   %eax,%eax
+  80444c:	0f 89 5e ff ff ff    	jns    8043b0 <page_map+0xc>
+				return r;
+  804452:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804455:	eb d7                	jmp    80442e <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804457:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80445a:	e8 79 f9 ff ff       	call   803dd8 <page_adopt>
+  80445f:	85 c0                	test   %eax,%eax
+  804461:	79 90                	jns    8043f3 <page_map+0x4f>
+			return r;
+  804463:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804466:	eb c6                	jmp    80442e <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  804468:	53                   	push   %ebx
+  804469:	68 54 61 80 00       	push   $0x806154
+  80446e:	68 77 03 00 00       	push   $0x377
+  804473:	68 1b 5d 80 00       	push   $0x805d1b
+  804478:	e8 ef be ff ff       	call   80036c <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  80447d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804480:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  804483:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  80448a:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  804490:	0f 84 f5 00 00 00    	je     80458b <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  804496:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80449c:	83 ec 0c             	sub    $0xc,%esp
+  80449f:	6a 05                	push   $0x5
+  8044a1:	68 00 00 40 00       	push   $0x400000
+  8044a6:	6a 00                	push   $0x0
+  8044a8:	57                   	push   %edi
+  8044a9:	56                   	push   %esi
+  8044aa:	e8 b5 ca ff ff       	call   800f64 <sys_page_map>
+  8044af:	89 c3                	mov    %eax,%ebx
+  8044b1:	83 c4 20             	add    $0x20,%esp
+  8044b4:	85 c0                	test   %eax,%eax
+  8044b6:	79 35                	jns    8044ed <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  8044b8:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8044bb:	75 1b                	jne    8044d8 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8044bd:	83 ec 08             	sub    $0x8,%esp
+  8044c0:	68 00 00 40 00       	push   $0x400000
+  8044c5:	6a 00                	push   $0x0
+  8044c7:	e8 f7 f5 ff ff       	call   803ac3 <page_out>
+  8044cc:	83 c4 10             	add    $0x10,%esp
+  8044cf:	85 c0                	test   %eax,%eax
+  8044d1:	79 c9                	jns    80449c <page_map+0xf8>
+  8044d3:	e9 56 ff ff ff       	jmp    80442e <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  8044d8:	53                   	push   %ebx
+  8044d9:	68 7c 61 80 00       	push   $0x80617c
+  8044de:	68 83 03 00 00       	push   $0x383
+  8044e3:	68 1b 5d 80 00       	push   $0x805d1b
+  8044e8:	e8 7f be ff ff       	call   80036c <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  8044ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8044f0:	c1 e8 0c             	shr    $0xc,%eax
+  8044f3:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8044f8:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  8044ff:	01 
+  804500:	0f 84 8d 00 00 00    	je     804593 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  804506:	83 ec 08             	sub    $0x8,%esp
+  804509:	68 00 00 40 00       	push   $0x400000
+  80450e:	6a 00                	push   $0x0
+  804510:	e8 91 ca ff ff       	call   800fa6 <sys_page_unmap>
+  804515:	83 c4 10             	add    $0x10,%esp
+  804518:	85 c0                	test   %eax,%eax
+  80451a:	78 36                	js     804552 <page_map+0x1ae>
+  80451c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  80451f:	83 ec 08             	sub    $0x8,%esp
+  804522:	57                   	push   %edi
+  804523:	56                   	push   %esi
+  804524:	e8 4a fc ff ff       	call   804173 <page_in>
+  804529:	89 c3                	mov    %eax,%ebx
+  80452b:	83 c4 10             	add    $0x10,%esp
+  80452e:	85 c0                	test   %eax,%eax
+  804530:	0f 89 7a fe ff ff    	jns    8043b0 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  804536:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804539:	75 2c                	jne    804567 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  80453b:	83 ec 08             	sub    $0x8,%esp
+  80453e:	57                   	push   %edi
+  80453f:	6a 00                	push   $0x0
+  804541:	e8 7d f5 ff ff       	call   803ac3 <page_out>
+  804546:	83 c4 10             	add    $0x10,%esp
+  804549:	85 c0                	test   %eax,%eax
+  80454b:	79 d2                	jns    80451f <page_map+0x17b>
+  80454d:	e9 dc fe ff ff       	jmp    80442e <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  804552:	50                   	push   %eax
+  804553:	68 a8 61 80 00       	push   $0x8061a8
+  804558:	68 8b 03 00 00       	push   $0x38b
+  80455d:	68 1b 5d 80 00       	push   $0x805d1b
+  804562:	e8 05 be ff ff       	call   80036c <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  804567:	53                   	push   %ebx
+  804568:	68 d0 61 80 00       	push   $0x8061d0
+  80456d:	68 91 03 00 00       	push   $0x391
+  804572:	68 1b 5d 80 00       	push   $0x805d1b
+  804577:	e8 f0 bd ff ff       	call   80036c <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  80457c:	89 c3                	mov    %eax,%ebx
+  80457e:	e9 ab fe ff ff       	jmp    80442e <page_map+0x8a>
+  804583:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804586:	e9 a3 fe ff ff       	jmp    80442e <page_map+0x8a>
+			return r; // Pass through the error
+  80458b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80458e:	e9 9b fe ff ff       	jmp    80442e <page_map+0x8a>
+			return r; // Pass through the error
+  804593:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804596:	e9 93 fe ff ff       	jmp    80442e <page_map+0x8a>
+
+0080459b <page_map_range>:
+{
+  80459b:	55                   	push   %ebp
+  80459c:	89 e5                	mov    %esp,%ebp
+  80459e:	57                   	push   %edi
+  80459f:	56                   	push   %esi
+  8045a0:	53                   	push   %ebx
+  8045a1:	83 ec 0c             	sub    $0xc,%esp
+  8045a4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8045a7:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  8045aa:	83 ec 08             	sub    $0x8,%esp
+  8045ad:	ff 75 1c             	push   0x1c(%ebp)
+  8045b0:	ff 75 18             	push   0x18(%ebp)
+  8045b3:	56                   	push   %esi
+  8045b4:	ff 75 10             	push   0x10(%ebp)
+  8045b7:	57                   	push   %edi
+  8045b8:	ff 75 08             	push   0x8(%ebp)
+  8045bb:	e8 af ca ff ff       	call   80106f <sys_page_map_range>
+  8045c0:	89 c3                	mov    %eax,%ebx
+  8045c2:	83 c4 20             	add    $0x20,%esp
+  8045c5:	85 c0                	test   %eax,%eax
+  8045c7:	79 1b                	jns    8045e4 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  8045c9:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8045cc:	75 20                	jne    8045ee <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8045ce:	83 ec 08             	sub    $0x8,%esp
+  8045d1:	68 00 00 40 00       	push   $0x400000
+  8045d6:	6a 00                	push   $0x0
+  8045d8:	e8 e6 f4 ff ff       	call   803ac3 <page_out>
+  8045dd:	83 c4 10             	add    $0x10,%esp
+  8045e0:	85 c0                	test   %eax,%eax
+  8045e2:	79 c6                	jns    8045aa <page_map_range+0xf>
+}
+  8045e4:	89 d8                	mov    %ebx,%eax
+  8045e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045e9:	5b                   	pop    %ebx
+  8045ea:	5e                   	pop    %esi
+  8045eb:	5f                   	pop    %edi
+  8045ec:	5d                   	pop    %ebp
+  8045ed:	c3                   	ret
+		if (r != -E_INVAL)
+  8045ee:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  8045f1:	75 f1                	jne    8045e4 <page_map_range+0x49>
+  8045f3:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  8045f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8045fa:	eb 03                	jmp    8045ff <page_map_range+0x64>
+  8045fc:	83 c6 01             	add    $0x1,%esi
+  8045ff:	3b 75 18             	cmp    0x18(%ebp),%esi
+  804602:	74 2a                	je     80462e <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  804604:	83 ec 0c             	sub    $0xc,%esp
+  804607:	ff 75 1c             	push   0x1c(%ebp)
+  80460a:	53                   	push   %ebx
+  80460b:	ff 75 10             	push   0x10(%ebp)
+  80460e:	57                   	push   %edi
+  80460f:	ff 75 08             	push   0x8(%ebp)
+  804612:	e8 8d fd ff ff       	call   8043a4 <page_map>
+  804617:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80461d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  804623:	83 c4 20             	add    $0x20,%esp
+  804626:	85 c0                	test   %eax,%eax
+  804628:	79 d2                	jns    8045fc <page_map_range+0x61>
+  80462a:	89 c3                	mov    %eax,%ebx
+  80462c:	eb b6                	jmp    8045e4 <page_map_range+0x49>
+		return 0;
+  80462e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804633:	eb af                	jmp    8045e4 <page_map_range+0x49>
+
+00804635 <paging_pgfault_handler>:
+{
+  804635:	55                   	push   %ebp
+  804636:	89 e5                	mov    %esp,%ebp
+  804638:	56                   	push   %esi
+  804639:	53                   	push   %ebx
+  80463a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  80463d:	e8 6f e7 ff ff       	call   802db1 <find_paging_env>
+	if (pagingenv == 0)
+  804642:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  804647:	85 c0                	test   %eax,%eax
+  804649:	74 3c                	je     804687 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  80464b:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  80464d:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804651:	75 12                	jne    804665 <paging_pgfault_handler+0x30>
+  804653:	89 f0                	mov    %esi,%eax
+  804655:	e8 7e f7 ff ff       	call   803dd8 <page_adopt>
+  80465a:	89 c2                	mov    %eax,%edx
+		return 0;
+  80465c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804661:	85 d2                	test   %edx,%edx
+  804663:	78 22                	js     804687 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  804665:	83 ec 08             	sub    $0x8,%esp
+  804668:	6a 00                	push   $0x0
+  80466a:	56                   	push   %esi
+  80466b:	e8 a9 f3 ff ff       	call   803a19 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  804670:	83 c4 10             	add    $0x10,%esp
+  804673:	85 c0                	test   %eax,%eax
+  804675:	74 05                	je     80467c <paging_pgfault_handler+0x47>
+  804677:	f6 00 01             	testb  $0x1,(%eax)
+  80467a:	75 12                	jne    80468e <paging_pgfault_handler+0x59>
+	return 0;
+  80467c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804681:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804685:	74 23                	je     8046aa <paging_pgfault_handler+0x75>
+}
+  804687:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80468a:	5b                   	pop    %ebx
+  80468b:	5e                   	pop    %esi
+  80468c:	5d                   	pop    %ebp
+  80468d:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  80468e:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804693:	8b 40 48             	mov    0x48(%eax),%eax
+  804696:	83 ec 08             	sub    $0x8,%esp
+  804699:	56                   	push   %esi
+  80469a:	50                   	push   %eax
+  80469b:	e8 d3 fa ff ff       	call   804173 <page_in>
+  8046a0:	f7 d0                	not    %eax
+  8046a2:	c1 e8 1f             	shr    $0x1f,%eax
+  8046a5:	83 c4 10             	add    $0x10,%esp
+  8046a8:	eb dd                	jmp    804687 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8046aa:	89 f0                	mov    %esi,%eax
+  8046ac:	e8 97 e2 ff ff       	call   802948 <segment_lookup>
+  8046b1:	89 c2                	mov    %eax,%edx
+	return 0;
+  8046b3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8046b8:	85 d2                	test   %edx,%edx
+  8046ba:	74 cb                	je     804687 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  8046bc:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8046c1:	8b 40 48             	mov    0x48(%eax),%eax
+  8046c4:	83 ec 08             	sub    $0x8,%esp
+  8046c7:	56                   	push   %esi
+  8046c8:	50                   	push   %eax
+  8046c9:	e8 f5 f3 ff ff       	call   803ac3 <page_out>
+  8046ce:	f7 d0                	not    %eax
+  8046d0:	c1 e8 1f             	shr    $0x1f,%eax
+  8046d3:	83 c4 10             	add    $0x10,%esp
+  8046d6:	eb af                	jmp    804687 <paging_pgfault_handler+0x52>
+
+008046d8 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  8046d8:	55                   	push   %ebp
+  8046d9:	89 e5                	mov    %esp,%ebp
+  8046db:	57                   	push   %edi
+  8046dc:	56                   	push   %esi
+  8046dd:	53                   	push   %ebx
+  8046de:	83 ec 2c             	sub    $0x2c,%esp
+  8046e1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8046e4:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  8046e9:	89 c1                	mov    %eax,%ecx
+  8046eb:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  8046ee:	c1 e8 11             	shr    $0x11,%eax
+  8046f1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8046f4:	8b 3c 85 80 dc 80 00 	mov    0x80dc80(,%eax,4),%edi
+  8046fb:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  8046fe:	b8 01 00 00 00       	mov    $0x1,%eax
+  804703:	d3 e0                	shl    %cl,%eax
+  804705:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  804708:	85 c7                	test   %eax,%edi
+  80470a:	74 12                	je     80471e <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  80470c:	bb 01 00 00 00       	mov    $0x1,%ebx
+  804711:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  804714:	bf 01 00 00 00       	mov    $0x1,%edi
+  804719:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80471c:	eb 17                	jmp    804735 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  80471e:	ff 75 e0             	push   -0x20(%ebp)
+  804721:	68 08 62 80 00       	push   $0x806208
+  804726:	6a 48                	push   $0x48
+  804728:	68 22 62 80 00       	push   $0x806222
+  80472d:	e8 3a bc ff ff       	call   80036c <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804732:	83 c3 01             	add    $0x1,%ebx
+  804735:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804738:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  80473b:	89 c8                	mov    %ecx,%eax
+  80473d:	c1 e8 05             	shr    $0x5,%eax
+  804740:	8b 14 85 80 ce 80 00 	mov    0x80ce80(,%eax,4),%edx
+  804747:	89 fe                	mov    %edi,%esi
+  804749:	d3 e6                	shl    %cl,%esi
+  80474b:	89 f1                	mov    %esi,%ecx
+  80474d:	85 d6                	test   %edx,%esi
+  80474f:	74 e1                	je     804732 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  804751:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  804754:	f7 d6                	not    %esi
+  804756:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804759:	21 fe                	and    %edi,%esi
+  80475b:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80475e:	89 34 bd 80 dc 80 00 	mov    %esi,0x80dc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  804765:	f7 d1                	not    %ecx
+  804767:	21 d1                	and    %edx,%ecx
+  804769:	89 0c 85 80 ce 80 00 	mov    %ecx,0x80ce80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804770:	83 ec 04             	sub    $0x4,%esp
+  804773:	53                   	push   %ebx
+  804774:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804777:	57                   	push   %edi
+  804778:	6a 00                	push   $0x0
+  80477a:	e8 97 f8 ff ff       	call   804016 <page_unmap_range>
+	va_free(va, n);
+  80477f:	83 c4 08             	add    $0x8,%esp
+  804782:	53                   	push   %ebx
+  804783:	57                   	push   %edi
+  804784:	e8 ed 05 00 00       	call   804d76 <va_free>
+}
+  804789:	83 c4 10             	add    $0x10,%esp
+  80478c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80478f:	5b                   	pop    %ebx
+  804790:	5e                   	pop    %esi
+  804791:	5f                   	pop    %edi
+  804792:	5d                   	pop    %ebp
+  804793:	c3                   	ret
+
+00804794 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  804794:	55                   	push   %ebp
+  804795:	89 e5                	mov    %esp,%ebp
+  804797:	57                   	push   %edi
+  804798:	56                   	push   %esi
+  804799:	53                   	push   %ebx
+  80479a:	83 ec 1c             	sub    $0x1c,%esp
+  80479d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  8047a0:	85 db                	test   %ebx,%ebx
+  8047a2:	74 34                	je     8047d8 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  8047a4:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8047aa:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  8047af:	77 2f                	ja     8047e0 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  8047b1:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8047b7:	75 51                	jne    80480a <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  8047b9:	89 c1                	mov    %eax,%ecx
+  8047bb:	c1 e9 0c             	shr    $0xc,%ecx
+  8047be:	ba 01 00 00 00       	mov    $0x1,%edx
+  8047c3:	d3 e2                	shl    %cl,%edx
+  8047c5:	c1 e8 11             	shr    $0x11,%eax
+  8047c8:	23 14 85 80 c0 80 00 	and    0x80c080(,%eax,4),%edx
+  8047cf:	75 24                	jne    8047f5 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  8047d1:	89 d8                	mov    %ebx,%eax
+  8047d3:	e8 00 ff ff ff       	call   8046d8 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  8047d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8047db:	5b                   	pop    %ebx
+  8047dc:	5e                   	pop    %esi
+  8047dd:	5f                   	pop    %edi
+  8047de:	5d                   	pop    %ebp
+  8047df:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  8047e0:	53                   	push   %ebx
+  8047e1:	68 2f 62 80 00       	push   $0x80622f
+  8047e6:	68 a2 00 00 00       	push   $0xa2
+  8047eb:	68 22 62 80 00       	push   $0x806222
+  8047f0:	e8 77 bb ff ff       	call   80036c <_panic>
+			panic("free: %p is not allocated", va);
+  8047f5:	53                   	push   %ebx
+  8047f6:	68 08 62 80 00       	push   $0x806208
+  8047fb:	68 a5 00 00 00       	push   $0xa5
+  804800:	68 22 62 80 00       	push   $0x806222
+  804805:	e8 62 bb ff ff       	call   80036c <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  80480a:	89 de                	mov    %ebx,%esi
+  80480c:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  804812:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  804818:	89 c8                	mov    %ecx,%eax
+  80481a:	c1 e8 11             	shr    $0x11,%eax
+  80481d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804820:	8b 3c 85 80 c0 80 00 	mov    0x80c080(,%eax,4),%edi
+  804827:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  80482a:	c1 e9 0c             	shr    $0xc,%ecx
+  80482d:	b8 01 00 00 00       	mov    $0x1,%eax
+  804832:	d3 e0                	shl    %cl,%eax
+  804834:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804837:	85 c7                	test   %eax,%edi
+  804839:	74 1b                	je     804856 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  80483b:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  80483f:	89 d8                	mov    %ebx,%eax
+  804841:	29 f0                	sub    %esi,%eax
+  804843:	83 e8 10             	sub    $0x10,%eax
+  804846:	99                   	cltd
+  804847:	f7 ff                	idiv   %edi
+  804849:	89 d1                	mov    %edx,%ecx
+  80484b:	85 d2                	test   %edx,%edx
+  80484d:	75 07                	jne    804856 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80484f:	ba 10 00 00 00       	mov    $0x10,%edx
+  804854:	eb 18                	jmp    80486e <free+0xda>
+		panic("free: %p is not allocated", va);
+  804856:	53                   	push   %ebx
+  804857:	68 08 62 80 00       	push   $0x806208
+  80485c:	68 ad 00 00 00       	push   $0xad
+  804861:	68 22 62 80 00       	push   $0x806222
+  804866:	e8 01 bb ff ff       	call   80036c <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80486b:	83 c1 01             	add    $0x1,%ecx
+  80486e:	89 d0                	mov    %edx,%eax
+  804870:	d3 e0                	shl    %cl,%eax
+  804872:	39 c7                	cmp    %eax,%edi
+  804874:	7f f5                	jg     80486b <free+0xd7>
+	*(void **) va = s->free;
+  804876:	8b 46 08             	mov    0x8(%esi),%eax
+  804879:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  80487b:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  80487e:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  804882:	8d 58 01             	lea    0x1(%eax),%ebx
+  804885:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  804889:	66 85 c0             	test   %ax,%ax
+  80488c:	74 52                	je     8048e0 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  80488e:	0f b7 db             	movzwl %bx,%ebx
+  804891:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804895:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80489a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80489f:	f7 ff                	idiv   %edi
+  8048a1:	39 c3                	cmp    %eax,%ebx
+  8048a3:	0f 85 2f ff ff ff    	jne    8047d8 <free+0x44>
+  8048a9:	8b 46 04             	mov    0x4(%esi),%eax
+  8048ac:	85 c0                	test   %eax,%eax
+  8048ae:	74 53                	je     804903 <free+0x16f>
+		s->prev->next = s->next;
+  8048b0:	8b 16                	mov    (%esi),%edx
+  8048b2:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8048b4:	8b 06                	mov    (%esi),%eax
+  8048b6:	85 c0                	test   %eax,%eax
+  8048b8:	74 06                	je     8048c0 <free+0x12c>
+		s->next->prev = s->prev;
+  8048ba:	8b 56 04             	mov    0x4(%esi),%edx
+  8048bd:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8048c0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8048c3:	f7 d0                	not    %eax
+  8048c5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8048c8:	21 d0                	and    %edx,%eax
+  8048ca:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8048cd:	89 04 95 80 c0 80 00 	mov    %eax,0x80c080(,%edx,4)
+		heap_free_pages(s);
+  8048d4:	89 f0                	mov    %esi,%eax
+  8048d6:	e8 fd fd ff ff       	call   8046d8 <heap_free_pages>
+  8048db:	e9 f8 fe ff ff       	jmp    8047d8 <free+0x44>
+	s->prev = NULL;
+  8048e0:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  8048e7:	8b 04 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%eax
+  8048ee:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  8048f0:	85 c0                	test   %eax,%eax
+  8048f2:	74 03                	je     8048f7 <free+0x163>
+		slabs[c]->prev = s;
+  8048f4:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  8048f7:	89 34 8d 60 c0 80 00 	mov    %esi,0x80c060(,%ecx,4)
+}
+  8048fe:	e9 d5 fe ff ff       	jmp    8047d8 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804903:	8b 06                	mov    (%esi),%eax
+  804905:	85 c0                	test   %eax,%eax
+  804907:	0f 84 cb fe ff ff    	je     8047d8 <free+0x44>
+		slabs[c] = s->next;
+  80490d:	89 04 8d 60 c0 80 00 	mov    %eax,0x80c060(,%ecx,4)
+	if (s->next)
+  804914:	8b 06                	mov    (%esi),%eax
+  804916:	eb a2                	jmp    8048ba <free+0x126>
+
+00804918 <heap_alloc_pages>:
+{
+  804918:	55                   	push   %ebp
+  804919:	89 e5                	mov    %esp,%ebp
+  80491b:	57                   	push   %edi
+  80491c:	56                   	push   %esi
+  80491d:	53                   	push   %ebx
+  80491e:	83 ec 18             	sub    $0x18,%esp
+  804921:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  804923:	50                   	push   %eax
+  804924:	e8 15 03 00 00       	call   804c3e <va_alloc>
+  804929:	89 c3                	mov    %eax,%ebx
+  80492b:	83 c4 10             	add    $0x10,%esp
+  80492e:	85 c0                	test   %eax,%eax
+  804930:	74 47                	je     804979 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804932:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804938:	89 c1                	mov    %eax,%ecx
+  80493a:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  80493d:	c1 e8 11             	shr    $0x11,%eax
+  804940:	ba 01 00 00 00       	mov    $0x1,%edx
+  804945:	89 d7                	mov    %edx,%edi
+  804947:	d3 e7                	shl    %cl,%edi
+  804949:	09 3c 85 80 dc 80 00 	or     %edi,0x80dc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  804950:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  804954:	89 c8                	mov    %ecx,%eax
+  804956:	c1 e8 05             	shr    $0x5,%eax
+  804959:	d3 e2                	shl    %cl,%edx
+  80495b:	09 14 85 80 ce 80 00 	or     %edx,0x80ce80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  804962:	83 ec 0c             	sub    $0xc,%esp
+  804965:	6a 00                	push   $0x0
+  804967:	6a 07                	push   $0x7
+  804969:	56                   	push   %esi
+  80496a:	53                   	push   %ebx
+  80496b:	6a 00                	push   $0x0
+  80496d:	e8 3a f7 ff ff       	call   8040ac <page_alloc_range>
+  804972:	83 c4 20             	add    $0x20,%esp
+  804975:	85 c0                	test   %eax,%eax
+  804977:	78 0a                	js     804983 <heap_alloc_pages+0x6b>
+}
+  804979:	89 d8                	mov    %ebx,%eax
+  80497b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80497e:	5b                   	pop    %ebx
+  80497f:	5e                   	pop    %esi
+  804980:	5f                   	pop    %edi
+  804981:	5d                   	pop    %ebp
+  804982:	c3                   	ret
+		free(va);
+  804983:	83 ec 0c             	sub    $0xc,%esp
+  804986:	53                   	push   %ebx
+  804987:	e8 08 fe ff ff       	call   804794 <free>
+		return NULL;
+  80498c:	83 c4 10             	add    $0x10,%esp
+  80498f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804994:	eb e3                	jmp    804979 <heap_alloc_pages+0x61>
+
+00804996 <malloc>:
+{
+  804996:	55                   	push   %ebp
+  804997:	89 e5                	mov    %esp,%ebp
+  804999:	57                   	push   %edi
+  80499a:	56                   	push   %esi
+  80499b:	53                   	push   %ebx
+  80499c:	83 ec 1c             	sub    $0x1c,%esp
+  80499f:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  8049a2:	8d 50 ff             	lea    -0x1(%eax),%edx
+  8049a5:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  8049ab:	0f 87 21 01 00 00    	ja     804ad2 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8049b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8049b6:	ba 10 00 00 00       	mov    $0x10,%edx
+  8049bb:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  8049bd:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8049c2:	76 15                	jbe    8049d9 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  8049c4:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8049c9:	c1 e8 0c             	shr    $0xc,%eax
+  8049cc:	e8 47 ff ff ff       	call   804918 <heap_alloc_pages>
+  8049d1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8049d4:	eb 37                	jmp    804a0d <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8049d6:	83 c1 01             	add    $0x1,%ecx
+  8049d9:	89 d6                	mov    %edx,%esi
+  8049db:	d3 e6                	shl    %cl,%esi
+  8049dd:	39 c6                	cmp    %eax,%esi
+  8049df:	72 f5                	jb     8049d6 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  8049e1:	89 cb                	mov    %ecx,%ebx
+  8049e3:	8b 3c 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%edi
+  8049ea:	85 ff                	test   %edi,%edi
+  8049ec:	74 2a                	je     804a18 <malloc+0x82>
+	v = s->free;
+  8049ee:	8b 47 08             	mov    0x8(%edi),%eax
+  8049f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  8049f4:	8b 00                	mov    (%eax),%eax
+  8049f6:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  8049f9:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  8049fd:	83 e8 01             	sub    $0x1,%eax
+  804a00:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  804a04:	66 85 c0             	test   %ax,%ax
+  804a07:	0f 84 9a 00 00 00    	je     804aa7 <malloc+0x111>
+}
+  804a0d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804a10:	83 c4 1c             	add    $0x1c,%esp
+  804a13:	5b                   	pop    %ebx
+  804a14:	5e                   	pop    %esi
+  804a15:	5f                   	pop    %edi
+  804a16:	5d                   	pop    %ebp
+  804a17:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  804a18:	b8 01 00 00 00       	mov    $0x1,%eax
+  804a1d:	e8 f6 fe ff ff       	call   804918 <heap_alloc_pages>
+  804a22:	89 c1                	mov    %eax,%ecx
+  804a24:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804a27:	85 c0                	test   %eax,%eax
+  804a29:	74 e2                	je     804a0d <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804a2b:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  804a31:	89 c8                	mov    %ecx,%eax
+  804a33:	c1 e8 11             	shr    $0x11,%eax
+  804a36:	c1 e9 0c             	shr    $0xc,%ecx
+  804a39:	ba 01 00 00 00       	mov    $0x1,%edx
+  804a3e:	d3 e2                	shl    %cl,%edx
+  804a40:	09 14 85 80 c0 80 00 	or     %edx,0x80c080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804a47:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804a4a:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  804a4e:	0f b7 f6             	movzwl %si,%esi
+  804a51:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804a56:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a5b:	f7 fe                	idiv   %esi
+  804a5d:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804a61:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  804a64:	85 c0                	test   %eax,%eax
+  804a66:	74 14                	je     804a7c <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  804a68:	83 e8 01             	sub    $0x1,%eax
+  804a6b:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804a6f:	0f af d0             	imul   %eax,%edx
+  804a72:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804a76:	89 3a                	mov    %edi,(%edx)
+  804a78:	89 d7                	mov    %edx,%edi
+  804a7a:	eb e5                	jmp    804a61 <malloc+0xcb>
+	s->prev = NULL;
+  804a7c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804a7f:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804a86:	8b 04 9d 60 c0 80 00 	mov    0x80c060(,%ebx,4),%eax
+  804a8d:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804a8f:	85 c0                	test   %eax,%eax
+  804a91:	74 03                	je     804a96 <malloc+0x100>
+		slabs[c]->prev = s;
+  804a93:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804a96:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804a99:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+	return s;
+  804aa0:	89 c7                	mov    %eax,%edi
+  804aa2:	e9 47 ff ff ff       	jmp    8049ee <malloc+0x58>
+	if (s->prev)
+  804aa7:	8b 47 04             	mov    0x4(%edi),%eax
+  804aaa:	85 c0                	test   %eax,%eax
+  804aac:	74 19                	je     804ac7 <malloc+0x131>
+		s->prev->next = s->next;
+  804aae:	8b 17                	mov    (%edi),%edx
+  804ab0:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804ab2:	8b 07                	mov    (%edi),%eax
+  804ab4:	85 c0                	test   %eax,%eax
+  804ab6:	0f 84 51 ff ff ff    	je     804a0d <malloc+0x77>
+		s->next->prev = s->prev;
+  804abc:	8b 57 04             	mov    0x4(%edi),%edx
+  804abf:	89 50 04             	mov    %edx,0x4(%eax)
+  804ac2:	e9 46 ff ff ff       	jmp    804a0d <malloc+0x77>
+		slabs[c] = s->next;
+  804ac7:	8b 07                	mov    (%edi),%eax
+  804ac9:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+  804ad0:	eb e0                	jmp    804ab2 <malloc+0x11c>
+		return NULL;
+  804ad2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804ad9:	e9 2f ff ff ff       	jmp    804a0d <malloc+0x77>
+
+00804ade <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804ade:	55                   	push   %ebp
+  804adf:	89 e5                	mov    %esp,%ebp
+  804ae1:	57                   	push   %edi
+  804ae2:	56                   	push   %esi
+  804ae3:	53                   	push   %ebx
+  804ae4:	83 ec 0c             	sub    $0xc,%esp
+  804ae7:	89 c6                	mov    %eax,%esi
+  804ae9:	89 d7                	mov    %edx,%edi
+  804aeb:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804aee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804af3:	ba 00 00 00 00       	mov    $0x0,%edx
+  804af8:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  804afd:	83 ef 01             	sub    $0x1,%edi
+  804b00:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804b03:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  804b06:	eb 34                	jmp    804b3c <va_chunk_scan+0x5e>
+			i += 31;
+  804b08:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  804b0b:	89 ca                	mov    %ecx,%edx
+			continue;
+  804b0d:	eb 23                	jmp    804b32 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804b0f:	89 c7                	mov    %eax,%edi
+  804b11:	c1 ef 05             	shr    $0x5,%edi
+  804b14:	be 01 00 00 00       	mov    $0x1,%esi
+  804b19:	d3 e6                	shl    %cl,%esi
+  804b1b:	89 f1                	mov    %esi,%ecx
+  804b1d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804b20:	23 0c be             	and    (%esi,%edi,4),%ecx
+  804b23:	75 41                	jne    804b66 <va_chunk_scan+0x88>
+			len++;
+  804b25:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804b28:	39 d3                	cmp    %edx,%ebx
+  804b2a:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  804b2d:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  804b30:	72 2d                	jb     804b5f <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804b32:	83 c0 01             	add    $0x1,%eax
+  804b35:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804b3a:	77 31                	ja     804b6d <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  804b3c:	89 c1                	mov    %eax,%ecx
+  804b3e:	83 e1 1f             	and    $0x1f,%ecx
+  804b41:	75 cc                	jne    804b0f <va_chunk_scan+0x31>
+  804b43:	89 c7                	mov    %eax,%edi
+  804b45:	c1 ef 05             	shr    $0x5,%edi
+  804b48:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804b4b:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804b4e:	83 ff ff             	cmp    $0xffffffff,%edi
+  804b51:	74 b5                	je     804b08 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  804b53:	85 ff                	test   %edi,%edi
+  804b55:	75 b8                	jne    804b0f <va_chunk_scan+0x31>
+			i += 31;
+  804b57:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804b5a:	83 c2 20             	add    $0x20,%edx
+  804b5d:	eb c9                	jmp    804b28 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804b5f:	83 c0 01             	add    $0x1,%eax
+  804b62:	29 d0                	sub    %edx,%eax
+  804b64:	eb 15                	jmp    804b7b <va_chunk_scan+0x9d>
+			len = 0;
+  804b66:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b6b:	eb c5                	jmp    804b32 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804b6d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804b72:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804b75:	85 d2                	test   %edx,%edx
+  804b77:	74 02                	je     804b7b <va_chunk_scan+0x9d>
+		*run_store = best;
+  804b79:	89 1a                	mov    %ebx,(%edx)
+}
+  804b7b:	83 c4 0c             	add    $0xc,%esp
+  804b7e:	5b                   	pop    %ebx
+  804b7f:	5e                   	pop    %esi
+  804b80:	5f                   	pop    %edi
+  804b81:	5d                   	pop    %ebp
+  804b82:	c3                   	ret
+
+00804b83 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804b83:	55                   	push   %ebp
+  804b84:	89 e5                	mov    %esp,%ebp
+  804b86:	57                   	push   %edi
+  804b87:	56                   	push   %esi
+  804b88:	53                   	push   %ebx
+  804b89:	83 ec 14             	sub    $0x14,%esp
+  804b8c:	89 c3                	mov    %eax,%ebx
+  804b8e:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804b90:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804b96:	8d ba a0 ea 80 00    	lea    0x80eaa0(%edx),%edi
+  804b9c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804b9f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804ba2:	89 d6                	mov    %edx,%esi
+  804ba4:	81 c6 a0 ea 80 00    	add    $0x80eaa0,%esi
+  804baa:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804bac:	eb 34                	jmp    804be2 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804bae:	89 c8                	mov    %ecx,%eax
+  804bb0:	c1 e8 05             	shr    $0x5,%eax
+  804bb3:	89 da                	mov    %ebx,%edx
+  804bb5:	c1 e2 05             	shl    $0x5,%edx
+  804bb8:	01 da                	add    %ebx,%edx
+  804bba:	01 c2                	add    %eax,%edx
+  804bbc:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804bc1:	d3 c0                	rol    %cl,%eax
+  804bc3:	21 04 95 a0 ea 80 00 	and    %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804bca:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804bd1:	b8 01 00 00 00       	mov    $0x1,%eax
+  804bd6:	01 d0                	add    %edx,%eax
+  804bd8:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804bdf:	83 c1 01             	add    $0x1,%ecx
+  804be2:	39 f9                	cmp    %edi,%ecx
+  804be4:	74 30                	je     804c16 <va_chunk_mark+0x93>
+		if (alloc)
+  804be6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804bea:	74 c2                	je     804bae <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804bec:	89 c8                	mov    %ecx,%eax
+  804bee:	c1 e8 05             	shr    $0x5,%eax
+  804bf1:	89 da                	mov    %ebx,%edx
+  804bf3:	c1 e2 05             	shl    $0x5,%edx
+  804bf6:	01 da                	add    %ebx,%edx
+  804bf8:	01 c2                	add    %eax,%edx
+  804bfa:	b8 01 00 00 00       	mov    $0x1,%eax
+  804bff:	d3 e0                	shl    %cl,%eax
+  804c01:	09 04 95 a0 ea 80 00 	or     %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804c08:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804c0f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804c14:	eb c0                	jmp    804bd6 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804c16:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804c19:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c1e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804c21:	e8 b8 fe ff ff       	call   804ade <va_chunk_scan>
+	ch->run = run;
+  804c26:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804c2c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804c2f:	66 89 83 22 eb 80 00 	mov    %ax,0x80eb22(%ebx)
+}
+  804c36:	83 c4 14             	add    $0x14,%esp
+  804c39:	5b                   	pop    %ebx
+  804c3a:	5e                   	pop    %esi
+  804c3b:	5f                   	pop    %edi
+  804c3c:	5d                   	pop    %ebp
+  804c3d:	c3                   	ret
+
+00804c3e <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804c3e:	55                   	push   %ebp
+  804c3f:	89 e5                	mov    %esp,%ebp
+  804c41:	57                   	push   %edi
+  804c42:	56                   	push   %esi
+  804c43:	53                   	push   %ebx
+  804c44:	83 ec 04             	sub    $0x4,%esp
+  804c47:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804c4a:	b8 20 eb 80 00       	mov    $0x80eb20,%eax
+  804c4f:	ba 90 f9 80 00       	mov    $0x80f990,%edx
+  804c54:	80 3d 80 ea 80 00 00 	cmpb   $0x0,0x80ea80
+  804c5b:	74 4f                	je     804cac <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804c5d:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804c60:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804c65:	0f 87 01 01 00 00    	ja     804d6c <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804c6b:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804c71:	0f 87 80 00 00 00    	ja     804cf7 <va_alloc+0xb9>
+  804c77:	b8 22 eb 80 00       	mov    $0x80eb22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804c7c:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804c81:	0f b7 10             	movzwl (%eax),%edx
+  804c84:	05 84 00 00 00       	add    $0x84,%eax
+  804c89:	39 da                	cmp    %ebx,%edx
+  804c8b:	73 2c                	jae    804cb9 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804c8d:	83 c6 01             	add    $0x1,%esi
+  804c90:	83 fe 1c             	cmp    $0x1c,%esi
+  804c93:	75 ec                	jne    804c81 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804c95:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c9a:	eb 53                	jmp    804cef <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804c9c:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804ca2:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804ca7:	05 84 00 00 00       	add    $0x84,%eax
+  804cac:	39 d0                	cmp    %edx,%eax
+  804cae:	75 ec                	jne    804c9c <va_alloc+0x5e>
+	va_inited = 1;
+  804cb0:	c6 05 80 ea 80 00 01 	movb   $0x1,0x80ea80
+}
+  804cb7:	eb a4                	jmp    804c5d <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804cb9:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804cbf:	05 a0 ea 80 00       	add    $0x80eaa0,%eax
+  804cc4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804cc9:	89 da                	mov    %ebx,%edx
+  804ccb:	e8 0e fe ff ff       	call   804ade <va_chunk_scan>
+  804cd0:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804cd2:	6a 01                	push   $0x1
+  804cd4:	89 d9                	mov    %ebx,%ecx
+  804cd6:	89 c2                	mov    %eax,%edx
+  804cd8:	89 f0                	mov    %esi,%eax
+  804cda:	e8 a4 fe ff ff       	call   804b83 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804cdf:	c1 e6 16             	shl    $0x16,%esi
+  804ce2:	c1 e7 0c             	shl    $0xc,%edi
+  804ce5:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804cec:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804cef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804cf2:	5b                   	pop    %ebx
+  804cf3:	5e                   	pop    %esi
+  804cf4:	5f                   	pop    %edi
+  804cf5:	5d                   	pop    %ebp
+  804cf6:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804cf7:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804cfd:	c1 ee 0a             	shr    $0xa,%esi
+  804d00:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804d05:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d0a:	eb 0a                	jmp    804d16 <va_alloc+0xd8>
+			first = c + 1;
+  804d0c:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804d0e:	83 c2 01             	add    $0x1,%edx
+  804d11:	83 fa 1d             	cmp    $0x1d,%edx
+  804d14:	74 4f                	je     804d65 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804d16:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804d1c:	66 81 b9 9c ea 80 00 	cmpw   $0x400,0x80ea9c(%ecx)
+  804d23:	00 04 
+  804d25:	75 e5                	jne    804d0c <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804d27:	89 d1                	mov    %edx,%ecx
+  804d29:	29 c1                	sub    %eax,%ecx
+  804d2b:	39 f1                	cmp    %esi,%ecx
+  804d2d:	75 df                	jne    804d0e <va_alloc+0xd0>
+  804d2f:	89 c7                	mov    %eax,%edi
+  804d31:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804d34:	be 00 04 00 00       	mov    $0x400,%esi
+  804d39:	39 f3                	cmp    %esi,%ebx
+  804d3b:	0f 46 f3             	cmovbe %ebx,%esi
+  804d3e:	6a 01                	push   $0x1
+  804d40:	89 f1                	mov    %esi,%ecx
+  804d42:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d47:	89 f8                	mov    %edi,%eax
+  804d49:	e8 35 fe ff ff       	call   804b83 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804d4e:	83 c7 01             	add    $0x1,%edi
+  804d51:	83 c4 04             	add    $0x4,%esp
+  804d54:	29 f3                	sub    %esi,%ebx
+  804d56:	75 dc                	jne    804d34 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804d58:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804d5b:	c1 e0 16             	shl    $0x16,%eax
+  804d5e:	05 00 00 00 08       	add    $0x8000000,%eax
+  804d63:	eb 8a                	jmp    804cef <va_alloc+0xb1>
+	return NULL;
+  804d65:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d6a:	eb 83                	jmp    804cef <va_alloc+0xb1>
+		return NULL;
+  804d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d71:	e9 79 ff ff ff       	jmp    804cef <va_alloc+0xb1>
+
+00804d76 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804d76:	55                   	push   %ebp
+  804d77:	89 e5                	mov    %esp,%ebp
+  804d79:	57                   	push   %edi
+  804d7a:	56                   	push   %esi
+  804d7b:	53                   	push   %ebx
+  804d7c:	83 ec 0c             	sub    $0xc,%esp
+  804d7f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804d82:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804d85:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804d8b:	76 21                	jbe    804dae <va_free+0x38>
+  804d8d:	89 f0                	mov    %esi,%eax
+  804d8f:	c1 e0 0c             	shl    $0xc,%eax
+  804d92:	01 f8                	add    %edi,%eax
+  804d94:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804d99:	77 13                	ja     804dae <va_free+0x38>
+	    || PGOFF(va))
+  804d9b:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804da1:	75 0b                	jne    804dae <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804da3:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804da9:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804dac:	eb 45                	jmp    804df3 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804dae:	83 ec 0c             	sub    $0xc,%esp
+  804db1:	56                   	push   %esi
+  804db2:	57                   	push   %edi
+  804db3:	68 4c 62 80 00       	push   $0x80624c
+  804db8:	68 8e 00 00 00       	push   $0x8e
+  804dbd:	68 6c 62 80 00       	push   $0x80626c
+  804dc2:	e8 a5 b5 ff ff       	call   80036c <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804dc7:	89 fa                	mov    %edi,%edx
+  804dc9:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804dcf:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804dd4:	29 d3                	sub    %edx,%ebx
+  804dd6:	39 f3                	cmp    %esi,%ebx
+  804dd8:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804ddb:	89 f8                	mov    %edi,%eax
+  804ddd:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804de0:	83 ec 0c             	sub    $0xc,%esp
+  804de3:	6a 00                	push   $0x0
+  804de5:	89 d9                	mov    %ebx,%ecx
+  804de7:	e8 97 fd ff ff       	call   804b83 <va_chunk_mark>
+		i += n;
+  804dec:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804dee:	29 de                	sub    %ebx,%esi
+  804df0:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804df3:	85 f6                	test   %esi,%esi
+  804df5:	75 d0                	jne    804dc7 <va_free+0x51>
+	}
+}
+  804df7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804dfa:	5b                   	pop    %ebx
+  804dfb:	5e                   	pop    %esi
+  804dfc:	5f                   	pop    %edi
+  804dfd:	5d                   	pop    %ebp
+  804dfe:	c3                   	ret
+
+00804dff <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804dff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e04:	c3                   	ret
+
+00804e05 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804e05:	55                   	push   %ebp
+  804e06:	89 e5                	mov    %esp,%ebp
+  804e08:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804e0b:	68 79 62 80 00       	push   $0x806279
+  804e10:	ff 75 0c             	push   0xc(%ebp)
+  804e13:	e8 16 bc ff ff       	call   800a2e <strcpy>
+	return 0;
+}
+  804e18:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e1d:	c9                   	leave
+  804e1e:	c3                   	ret
+
+00804e1f <devcons_write>:
+{
+  804e1f:	55                   	push   %ebp
+  804e20:	89 e5                	mov    %esp,%ebp
+  804e22:	57                   	push   %edi
+  804e23:	56                   	push   %esi
+  804e24:	53                   	push   %ebx
+  804e25:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804e2b:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804e30:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804e36:	eb 2e                	jmp    804e66 <devcons_write+0x47>
+		m = n - tot;
+  804e38:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804e3b:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804e3d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804e42:	39 c3                	cmp    %eax,%ebx
+  804e44:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804e47:	83 ec 04             	sub    $0x4,%esp
+  804e4a:	53                   	push   %ebx
+  804e4b:	89 f0                	mov    %esi,%eax
+  804e4d:	03 45 0c             	add    0xc(%ebp),%eax
+  804e50:	50                   	push   %eax
+  804e51:	57                   	push   %edi
+  804e52:	e8 5d bd ff ff       	call   800bb4 <memmove>
+		sys_cputs(buf, m);
+  804e57:	83 c4 08             	add    $0x8,%esp
+  804e5a:	53                   	push   %ebx
+  804e5b:	57                   	push   %edi
+  804e5c:	e8 f3 bf ff ff       	call   800e54 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804e61:	01 de                	add    %ebx,%esi
+  804e63:	83 c4 10             	add    $0x10,%esp
+  804e66:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804e69:	72 cd                	jb     804e38 <devcons_write+0x19>
+}
+  804e6b:	89 f0                	mov    %esi,%eax
+  804e6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804e70:	5b                   	pop    %ebx
+  804e71:	5e                   	pop    %esi
+  804e72:	5f                   	pop    %edi
+  804e73:	5d                   	pop    %ebp
+  804e74:	c3                   	ret
+
+00804e75 <devcons_read>:
+{
+  804e75:	55                   	push   %ebp
+  804e76:	89 e5                	mov    %esp,%ebp
+  804e78:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804e7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e80:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804e84:	75 07                	jne    804e8d <devcons_read+0x18>
+  804e86:	eb 1f                	jmp    804ea7 <devcons_read+0x32>
+		sys_yield();
+  804e88:	e8 75 c0 ff ff       	call   800f02 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804e8d:	e8 f1 bf ff ff       	call   800e83 <sys_cgetc>
+  804e92:	85 c0                	test   %eax,%eax
+  804e94:	74 f2                	je     804e88 <devcons_read+0x13>
+	if (c < 0)
+  804e96:	78 0f                	js     804ea7 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804e98:	83 f8 04             	cmp    $0x4,%eax
+  804e9b:	74 0c                	je     804ea9 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804e9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804ea0:	88 02                	mov    %al,(%edx)
+	return 1;
+  804ea2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804ea7:	c9                   	leave
+  804ea8:	c3                   	ret
+		return 0;
+  804ea9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804eae:	eb f7                	jmp    804ea7 <devcons_read+0x32>
+
+00804eb0 <cputchar>:
+{
+  804eb0:	55                   	push   %ebp
+  804eb1:	89 e5                	mov    %esp,%ebp
+  804eb3:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804eb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  804eb9:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804ebc:	6a 01                	push   $0x1
+  804ebe:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804ec1:	50                   	push   %eax
+  804ec2:	e8 8d bf ff ff       	call   800e54 <sys_cputs>
+}
+  804ec7:	83 c4 10             	add    $0x10,%esp
+  804eca:	c9                   	leave
+  804ecb:	c3                   	ret
+
+00804ecc <getchar>:
+{
+  804ecc:	55                   	push   %ebp
+  804ecd:	89 e5                	mov    %esp,%ebp
+  804ecf:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804ed2:	6a 01                	push   $0x1
+  804ed4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804ed7:	50                   	push   %eax
+  804ed8:	6a 00                	push   $0x0
+  804eda:	e8 6b ce ff ff       	call   801d4a <read>
+	if (r < 0)
+  804edf:	83 c4 10             	add    $0x10,%esp
+  804ee2:	85 c0                	test   %eax,%eax
+  804ee4:	78 06                	js     804eec <getchar+0x20>
+	if (r < 1)
+  804ee6:	74 06                	je     804eee <getchar+0x22>
+	return c;
+  804ee8:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804eec:	c9                   	leave
+  804eed:	c3                   	ret
+		return -E_EOF;
+  804eee:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804ef3:	eb f7                	jmp    804eec <getchar+0x20>
+
+00804ef5 <iscons>:
+{
+  804ef5:	55                   	push   %ebp
+  804ef6:	89 e5                	mov    %esp,%ebp
+  804ef8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804efb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804efe:	50                   	push   %eax
+  804eff:	ff 75 08             	push   0x8(%ebp)
+  804f02:	e8 e4 cb ff ff       	call   801aeb <fd_lookup>
+  804f07:	83 c4 10             	add    $0x10,%esp
+  804f0a:	85 c0                	test   %eax,%eax
+  804f0c:	78 11                	js     804f1f <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804f0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804f11:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  804f17:	39 10                	cmp    %edx,(%eax)
+  804f19:	0f 94 c0             	sete   %al
+  804f1c:	0f b6 c0             	movzbl %al,%eax
+}
+  804f1f:	c9                   	leave
+  804f20:	c3                   	ret
+
+00804f21 <opencons>:
+{
+  804f21:	55                   	push   %ebp
+  804f22:	89 e5                	mov    %esp,%ebp
+  804f24:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804f27:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804f2a:	50                   	push   %eax
+  804f2b:	e8 67 cb ff ff       	call   801a97 <fd_alloc>
+  804f30:	83 c4 10             	add    $0x10,%esp
+  804f33:	85 c0                	test   %eax,%eax
+  804f35:	78 3a                	js     804f71 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804f37:	83 ec 04             	sub    $0x4,%esp
+  804f3a:	68 07 04 00 00       	push   $0x407
+  804f3f:	ff 75 f4             	push   -0xc(%ebp)
+  804f42:	6a 00                	push   $0x0
+  804f44:	e8 d8 bf ff ff       	call   800f21 <sys_page_alloc>
+  804f49:	83 c4 10             	add    $0x10,%esp
+  804f4c:	85 c0                	test   %eax,%eax
+  804f4e:	78 21                	js     804f71 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804f50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804f53:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  804f59:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804f5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804f5e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804f65:	83 ec 0c             	sub    $0xc,%esp
+  804f68:	50                   	push   %eax
+  804f69:	e8 02 cb ff ff       	call   801a70 <fd2num>
+  804f6e:	83 c4 10             	add    $0x10,%esp
+}
+  804f71:	c9                   	leave
+  804f72:	c3                   	ret
+
+00804f73 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804f73:	55                   	push   %ebp
+  804f74:	89 e5                	mov    %esp,%ebp
+  804f76:	56                   	push   %esi
+  804f77:	53                   	push   %ebx
+  804f78:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804f7b:	a1 10 f9 80 00       	mov    0x80f910,%eax
+  804f80:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804f83:	85 db                	test   %ebx,%ebx
+  804f85:	78 17                	js     804f9e <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804f87:	83 ec 0c             	sub    $0xc,%esp
+  804f8a:	56                   	push   %esi
+  804f8b:	ff 14 9d 00 10 81 00 	call   *0x811000(,%ebx,4)
+  804f92:	83 c4 10             	add    $0x10,%esp
+  804f95:	85 c0                	test   %eax,%eax
+  804f97:	75 27                	jne    804fc0 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804f99:	83 eb 01             	sub    $0x1,%ebx
+  804f9c:	eb e5                	jmp    804f83 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804f9e:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804fa3:	8b 40 48             	mov    0x48(%eax),%eax
+  804fa6:	83 ec 08             	sub    $0x8,%esp
+  804fa9:	ff 76 28             	push   0x28(%esi)
+  804fac:	ff 36                	push   (%esi)
+  804fae:	50                   	push   %eax
+  804faf:	68 88 62 80 00       	push   $0x806288
+  804fb4:	6a 1d                	push   $0x1d
+  804fb6:	68 ab 62 80 00       	push   $0x8062ab
+  804fbb:	e8 ac b3 ff ff       	call   80036c <_panic>
+}
+  804fc0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804fc3:	5b                   	pop    %ebx
+  804fc4:	5e                   	pop    %esi
+  804fc5:	5d                   	pop    %ebp
+  804fc6:	c3                   	ret
+
+00804fc7 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804fc7:	55                   	push   %ebp
+  804fc8:	89 e5                	mov    %esp,%ebp
+  804fca:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804fcd:	83 3d 28 10 81 00 00 	cmpl   $0x0,0x811028
+  804fd4:	74 0a                	je     804fe0 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804fd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  804fd9:	a3 28 10 81 00       	mov    %eax,0x811028
+}
+  804fde:	c9                   	leave
+  804fdf:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804fe0:	83 ec 04             	sub    $0x4,%esp
+  804fe3:	6a 07                	push   $0x7
+  804fe5:	68 00 f0 bf ee       	push   $0xeebff000
+  804fea:	6a 00                	push   $0x0
+  804fec:	e8 30 bf ff ff       	call   800f21 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804ff1:	83 c4 08             	add    $0x8,%esp
+  804ff4:	68 67 50 80 00       	push   $0x805067
+  804ff9:	6a 00                	push   $0x0
+  804ffb:	e8 87 c2 ff ff       	call   801287 <sys_env_set_pgfault_upcall>
+  805000:	83 c4 10             	add    $0x10,%esp
+  805003:	eb d1                	jmp    804fd6 <set_pgfault_handler+0xf>
+
+00805005 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  805005:	55                   	push   %ebp
+  805006:	89 e5                	mov    %esp,%ebp
+  805008:	83 ec 08             	sub    $0x8,%esp
+  80500b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  80500e:	8b 15 10 f9 80 00    	mov    0x80f910,%edx
+  805014:	b8 00 00 00 00       	mov    $0x0,%eax
+  805019:	eb 03                	jmp    80501e <add_pgfault_handler+0x19>
+  80501b:	83 c0 01             	add    $0x1,%eax
+  80501e:	39 d0                	cmp    %edx,%eax
+  805020:	74 0b                	je     80502d <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  805022:	39 0c 85 00 10 81 00 	cmp    %ecx,0x811000(,%eax,4)
+  805029:	75 f0                	jne    80501b <add_pgfault_handler+0x16>
+  80502b:	eb 24                	jmp    805051 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  80502d:	83 fa 0a             	cmp    $0xa,%edx
+  805030:	74 21                	je     805053 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  805032:	8d 42 01             	lea    0x1(%edx),%eax
+  805035:	a3 10 f9 80 00       	mov    %eax,0x80f910
+  80503a:	89 0c 95 00 10 81 00 	mov    %ecx,0x811000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  805041:	83 ec 0c             	sub    $0xc,%esp
+  805044:	68 73 4f 80 00       	push   $0x804f73
+  805049:	e8 79 ff ff ff       	call   804fc7 <set_pgfault_handler>
+  80504e:	83 c4 10             	add    $0x10,%esp
+}
+  805051:	c9                   	leave
+  805052:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  805053:	83 ec 04             	sub    $0x4,%esp
+  805056:	68 b9 62 80 00       	push   $0x8062b9
+  80505b:	6a 44                	push   $0x44
+  80505d:	68 ab 62 80 00       	push   $0x8062ab
+  805062:	e8 05 b3 ff ff       	call   80036c <_panic>
+
+00805067 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  805067:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  805068:	a1 28 10 81 00       	mov    0x811028,%eax
+	call *%eax
+  80506d:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80506f:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  805072:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  805076:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  80507a:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  80507d:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  80507f:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  805083:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  805086:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  805087:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  80508a:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  80508b:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80508c:	c3                   	ret
+
+0080508d <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  80508d:	55                   	push   %ebp
+  80508e:	89 e5                	mov    %esp,%ebp
+  805090:	57                   	push   %edi
+  805091:	56                   	push   %esi
+  805092:	53                   	push   %ebx
+  805093:	83 ec 14             	sub    $0x14,%esp
+  805096:	8b 7d 08             	mov    0x8(%ebp),%edi
+  805099:	8b 75 14             	mov    0x14(%ebp),%esi
+  80509c:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  80509f:	ff 75 10             	push   0x10(%ebp)
+  8050a2:	ff 75 0c             	push   0xc(%ebp)
+  8050a5:	e8 9a c2 ff ff       	call   801344 <sys_ipc_recv_pages>
+  8050aa:	83 c4 10             	add    $0x10,%esp
+  8050ad:	85 c0                	test   %eax,%eax
+  8050af:	78 46                	js     8050f7 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8050b1:	85 ff                	test   %edi,%edi
+  8050b3:	74 0d                	je     8050c2 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  8050b5:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050ba:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8050c0:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8050c2:	85 f6                	test   %esi,%esi
+  8050c4:	74 0d                	je     8050d3 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  8050c6:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050cb:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8050d1:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8050d3:	85 db                	test   %ebx,%ebx
+  8050d5:	74 0d                	je     8050e4 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  8050d7:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050dc:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8050e2:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8050e4:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050e9:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8050ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8050f2:	5b                   	pop    %ebx
+  8050f3:	5e                   	pop    %esi
+  8050f4:	5f                   	pop    %edi
+  8050f5:	5d                   	pop    %ebp
+  8050f6:	c3                   	ret
+		if (from_env_store) {
+  8050f7:	85 ff                	test   %edi,%edi
+  8050f9:	74 06                	je     805101 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  8050fb:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  805101:	85 f6                	test   %esi,%esi
+  805103:	74 06                	je     80510b <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  805105:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80510b:	85 db                	test   %ebx,%ebx
+  80510d:	74 e0                	je     8050ef <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  80510f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  805115:	eb d8                	jmp    8050ef <ipc_recv_pages+0x62>
+
+00805117 <ipc_recv>:
+{
+  805117:	55                   	push   %ebp
+  805118:	89 e5                	mov    %esp,%ebp
+  80511a:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  80511d:	6a 00                	push   $0x0
+  80511f:	ff 75 10             	push   0x10(%ebp)
+  805122:	6a 01                	push   $0x1
+  805124:	ff 75 0c             	push   0xc(%ebp)
+  805127:	ff 75 08             	push   0x8(%ebp)
+  80512a:	e8 5e ff ff ff       	call   80508d <ipc_recv_pages>
+}
+  80512f:	c9                   	leave
+  805130:	c3                   	ret
+
+00805131 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805131:	55                   	push   %ebp
+  805132:	89 e5                	mov    %esp,%ebp
+  805134:	56                   	push   %esi
+  805135:	53                   	push   %ebx
+  805136:	8b 75 08             	mov    0x8(%ebp),%esi
+  805139:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  80513c:	83 ec 0c             	sub    $0xc,%esp
+  80513f:	ff 75 0c             	push   0xc(%ebp)
+  805142:	e8 31 c3 ff ff       	call   801478 <sys_ipc_try_recv>
+  805147:	83 c4 10             	add    $0x10,%esp
+  80514a:	85 c0                	test   %eax,%eax
+  80514c:	78 34                	js     805182 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80514e:	85 f6                	test   %esi,%esi
+  805150:	74 0d                	je     80515f <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  805152:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805157:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80515d:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  80515f:	85 db                	test   %ebx,%ebx
+  805161:	74 0d                	je     805170 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  805163:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805168:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80516e:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  805170:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805175:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80517b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80517e:	5b                   	pop    %ebx
+  80517f:	5e                   	pop    %esi
+  805180:	5d                   	pop    %ebp
+  805181:	c3                   	ret
+		if (from_env_store) {
+  805182:	85 f6                	test   %esi,%esi
+  805184:	74 06                	je     80518c <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  805186:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  80518c:	85 db                	test   %ebx,%ebx
+  80518e:	74 eb                	je     80517b <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  805190:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  805196:	eb e3                	jmp    80517b <ipc_try_recv+0x4a>
+
+00805198 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  805198:	55                   	push   %ebp
+  805199:	89 e5                	mov    %esp,%ebp
+  80519b:	83 ec 14             	sub    $0x14,%esp
+  80519e:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8051a1:	85 c0                	test   %eax,%eax
+  8051a3:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8051a8:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8051ab:	ff 75 18             	push   0x18(%ebp)
+  8051ae:	ff 75 14             	push   0x14(%ebp)
+  8051b1:	50                   	push   %eax
+  8051b2:	ff 75 0c             	push   0xc(%ebp)
+  8051b5:	ff 75 08             	push   0x8(%ebp)
+  8051b8:	e8 4a c1 ff ff       	call   801307 <sys_ipc_send_pages>
+  8051bd:	83 c4 20             	add    $0x20,%esp
+  8051c0:	85 c0                	test   %eax,%eax
+  8051c2:	78 02                	js     8051c6 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  8051c4:	c9                   	leave
+  8051c5:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  8051c6:	50                   	push   %eax
+  8051c7:	68 d4 62 80 00       	push   $0x8062d4
+  8051cc:	68 80 00 00 00       	push   $0x80
+  8051d1:	68 00 63 80 00       	push   $0x806300
+  8051d6:	e8 91 b1 ff ff       	call   80036c <_panic>
+
+008051db <ipc_send>:
+{
+  8051db:	55                   	push   %ebp
+  8051dc:	89 e5                	mov    %esp,%ebp
+  8051de:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  8051e1:	ff 75 14             	push   0x14(%ebp)
+  8051e4:	6a 01                	push   $0x1
+  8051e6:	ff 75 10             	push   0x10(%ebp)
+  8051e9:	ff 75 0c             	push   0xc(%ebp)
+  8051ec:	ff 75 08             	push   0x8(%ebp)
+  8051ef:	e8 a4 ff ff ff       	call   805198 <ipc_send_pages>
+}
+  8051f4:	83 c4 20             	add    $0x20,%esp
+  8051f7:	c9                   	leave
+  8051f8:	c3                   	ret
+
+008051f9 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8051f9:	55                   	push   %ebp
+  8051fa:	89 e5                	mov    %esp,%ebp
+  8051fc:	83 ec 14             	sub    $0x14,%esp
+  8051ff:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805202:	85 c0                	test   %eax,%eax
+  805204:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805209:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80520c:	ff 75 18             	push   0x18(%ebp)
+  80520f:	ff 75 14             	push   0x14(%ebp)
+  805212:	50                   	push   %eax
+  805213:	ff 75 0c             	push   0xc(%ebp)
+  805216:	ff 75 08             	push   0x8(%ebp)
+  805219:	e8 7a c1 ff ff       	call   801398 <sys_ipc_call>
+  80521e:	83 c4 20             	add    $0x20,%esp
+  805221:	85 c0                	test   %eax,%eax
+  805223:	78 0b                	js     805230 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  805225:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80522a:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  805230:	c9                   	leave
+  805231:	c3                   	ret
+
+00805232 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  805232:	55                   	push   %ebp
+  805233:	89 e5                	mov    %esp,%ebp
+  805235:	57                   	push   %edi
+  805236:	56                   	push   %esi
+  805237:	53                   	push   %ebx
+  805238:	83 ec 18             	sub    $0x18,%esp
+  80523b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80523e:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  805241:	8b 75 20             	mov    0x20(%ebp),%esi
+  805244:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805247:	85 c0                	test   %eax,%eax
+  805249:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80524e:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  805251:	ff 75 18             	push   0x18(%ebp)
+  805254:	ff 75 14             	push   0x14(%ebp)
+  805257:	50                   	push   %eax
+  805258:	ff 75 0c             	push   0xc(%ebp)
+  80525b:	ff 75 08             	push   0x8(%ebp)
+  80525e:	e8 76 c1 ff ff       	call   8013d9 <sys_ipc_reply_recv>
+  805263:	83 c4 20             	add    $0x20,%esp
+  805266:	85 c0                	test   %eax,%eax
+  805268:	78 46                	js     8052b0 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80526a:	85 ff                	test   %edi,%edi
+  80526c:	74 0d                	je     80527b <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  80526e:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805273:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  805279:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80527b:	85 f6                	test   %esi,%esi
+  80527d:	74 0d                	je     80528c <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  80527f:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805284:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80528a:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80528c:	85 db                	test   %ebx,%ebx
+  80528e:	74 0d                	je     80529d <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  805290:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805295:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80529b:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80529d:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8052a2:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8052a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8052ab:	5b                   	pop    %ebx
+  8052ac:	5e                   	pop    %esi
+  8052ad:	5f                   	pop    %edi
+  8052ae:	5d                   	pop    %ebp
+  8052af:	c3                   	ret
+		if (from_env_store) {
+  8052b0:	85 ff                	test   %edi,%edi
+  8052b2:	74 06                	je     8052ba <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  8052b4:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8052ba:	85 f6                	test   %esi,%esi
+  8052bc:	74 06                	je     8052c4 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  8052be:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8052c4:	85 db                	test   %ebx,%ebx
+  8052c6:	74 e0                	je     8052a8 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  8052c8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8052ce:	eb d8                	jmp    8052a8 <ipc_reply_recv+0x76>
+
+008052d0 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8052d0:	55                   	push   %ebp
+  8052d1:	89 e5                	mov    %esp,%ebp
+  8052d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8052d6:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8052db:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8052de:	c1 e0 06             	shl    $0x6,%eax
+  8052e1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8052e6:	8b 40 50             	mov    0x50(%eax),%eax
+  8052e9:	39 c8                	cmp    %ecx,%eax
+  8052eb:	74 12                	je     8052ff <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8052ed:	83 c2 01             	add    $0x1,%edx
+  8052f0:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8052f6:	75 e3                	jne    8052db <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8052f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052fd:	eb 0e                	jmp    80530d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8052ff:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  805302:	c1 e0 06             	shl    $0x6,%eax
+  805305:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80530a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80530d:	5d                   	pop    %ebp
+  80530e:	c3                   	ret
+
+0080530f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80530f:	55                   	push   %ebp
+  805310:	89 e5                	mov    %esp,%ebp
+  805312:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805315:	89 c2                	mov    %eax,%edx
+  805317:	c1 ea 16             	shr    $0x16,%edx
+  80531a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  805321:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805326:	f6 c1 01             	test   $0x1,%cl
+  805329:	74 1e                	je     805349 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  80532b:	c1 e8 0c             	shr    $0xc,%eax
+  80532e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  805335:	a8 01                	test   $0x1,%al
+  805337:	74 10                	je     805349 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  805339:	c1 e8 0c             	shr    $0xc,%eax
+  80533c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80533f:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  805346:	0f b7 d2             	movzwl %dx,%edx
+}
+  805349:	89 d0                	mov    %edx,%eax
+  80534b:	5d                   	pop    %ebp
+  80534c:	c3                   	ret
+
+0080534d <udivmod>:
+  80534d:	55                   	push   %ebp
+  80534e:	57                   	push   %edi
+  80534f:	56                   	push   %esi
+  805350:	53                   	push   %ebx
+  805351:	83 ec 24             	sub    $0x24,%esp
+  805354:	89 44 24 08          	mov    %eax,0x8(%esp)
+  805358:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80535c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  805360:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  805364:	89 44 24 10          	mov    %eax,0x10(%esp)
+  805368:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80536c:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  805370:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  805375:	b8 00 00 00 00       	mov    $0x0,%eax
+  80537a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80537f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  805386:	00 
+  805387:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80538e:	00 
+  80538f:	89 fb                	mov    %edi,%ebx
+  805391:	eb 08                	jmp    80539b <udivmod+0x4e>
+  805393:	83 e9 01             	sub    $0x1,%ecx
+  805396:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  805399:	74 68                	je     805403 <udivmod+0xb6>
+  80539b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80539f:	01 c0                	add    %eax,%eax
+  8053a1:	89 c6                	mov    %eax,%esi
+  8053a3:	89 d7                	mov    %edx,%edi
+  8053a5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8053a9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8053ad:	0f ad d0             	shrd   %cl,%edx,%eax
+  8053b0:	d3 ea                	shr    %cl,%edx
+  8053b2:	f6 c1 20             	test   $0x20,%cl
+  8053b5:	74 04                	je     8053bb <udivmod+0x6e>
+  8053b7:	89 d0                	mov    %edx,%eax
+  8053b9:	31 d2                	xor    %edx,%edx
+  8053bb:	83 e0 01             	and    $0x1,%eax
+  8053be:	89 04 24             	mov    %eax,(%esp)
+  8053c1:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8053c8:	00 
+  8053c9:	8b 04 24             	mov    (%esp),%eax
+  8053cc:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8053d0:	09 f0                	or     %esi,%eax
+  8053d2:	09 fa                	or     %edi,%edx
+  8053d4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8053d8:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8053dc:	39 f0                	cmp    %esi,%eax
+  8053de:	89 d5                	mov    %edx,%ebp
+  8053e0:	19 fd                	sbb    %edi,%ebp
+  8053e2:	72 af                	jb     805393 <udivmod+0x46>
+  8053e4:	29 f0                	sub    %esi,%eax
+  8053e6:	19 fa                	sbb    %edi,%edx
+  8053e8:	89 cf                	mov    %ecx,%edi
+  8053ea:	c1 ef 05             	shr    $0x5,%edi
+  8053ed:	83 e7 01             	and    $0x1,%edi
+  8053f0:	89 fe                	mov    %edi,%esi
+  8053f2:	83 f6 01             	xor    $0x1,%esi
+  8053f5:	d3 e6                	shl    %cl,%esi
+  8053f7:	d3 e7                	shl    %cl,%edi
+  8053f9:	09 74 24 18          	or     %esi,0x18(%esp)
+  8053fd:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  805401:	eb 90                	jmp    805393 <udivmod+0x46>
+  805403:	85 db                	test   %ebx,%ebx
+  805405:	74 05                	je     80540c <udivmod+0xbf>
+  805407:	89 03                	mov    %eax,(%ebx)
+  805409:	89 53 04             	mov    %edx,0x4(%ebx)
+  80540c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805410:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805414:	83 c4 24             	add    $0x24,%esp
+  805417:	5b                   	pop    %ebx
+  805418:	5e                   	pop    %esi
+  805419:	5f                   	pop    %edi
+  80541a:	5d                   	pop    %ebp
+  80541b:	c3                   	ret
+
+0080541c <__udivdi3>:
+  80541c:	83 ec 08             	sub    $0x8,%esp
+  80541f:	6a 00                	push   $0x0
+  805421:	ff 74 24 1c          	push   0x1c(%esp)
+  805425:	ff 74 24 1c          	push   0x1c(%esp)
+  805429:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80542d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805431:	e8 17 ff ff ff       	call   80534d <udivmod>
+  805436:	83 c4 14             	add    $0x14,%esp
+  805439:	c3                   	ret
+
+0080543a <__umoddi3>:
+  80543a:	83 ec 18             	sub    $0x18,%esp
+  80543d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805441:	50                   	push   %eax
+  805442:	ff 74 24 2c          	push   0x2c(%esp)
+  805446:	ff 74 24 2c          	push   0x2c(%esp)
+  80544a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80544e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  805452:	e8 f6 fe ff ff       	call   80534d <udivmod>
+  805457:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80545b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80545f:	83 c4 24             	add    $0x24,%esp
+  805462:	c3                   	ret
+
+00805463 <__divdi3>:
+  805463:	55                   	push   %ebp
+  805464:	57                   	push   %edi
+  805465:	56                   	push   %esi
+  805466:	53                   	push   %ebx
+  805467:	83 ec 10             	sub    $0x10,%esp
+  80546a:	8b 44 24 24          	mov    0x24(%esp),%eax
+  80546e:	8b 54 24 28          	mov    0x28(%esp),%edx
+  805472:	89 c6                	mov    %eax,%esi
+  805474:	89 d7                	mov    %edx,%edi
+  805476:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  80547a:	33 7c 24 30          	xor    0x30(%esp),%edi
+  80547e:	89 74 24 04          	mov    %esi,0x4(%esp)
+  805482:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  805486:	89 c5                	mov    %eax,%ebp
+  805488:	f7 dd                	neg    %ebp
+  80548a:	89 d6                	mov    %edx,%esi
+  80548c:	83 d6 00             	adc    $0x0,%esi
+  80548f:	f7 de                	neg    %esi
+  805491:	0f 48 e8             	cmovs  %eax,%ebp
+  805494:	0f 49 d6             	cmovns %esi,%edx
+  805497:	6a 00                	push   $0x0
+  805499:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80549d:	f7 de                	neg    %esi
+  80549f:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8054a3:	83 d0 00             	adc    $0x0,%eax
+  8054a6:	f7 d8                	neg    %eax
+  8054a8:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  8054ad:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  8054b2:	50                   	push   %eax
+  8054b3:	56                   	push   %esi
+  8054b4:	89 e8                	mov    %ebp,%eax
+  8054b6:	e8 92 fe ff ff       	call   80534d <udivmod>
+  8054bb:	83 c4 10             	add    $0x10,%esp
+  8054be:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  8054c3:	78 08                	js     8054cd <__divdi3+0x6a>
+  8054c5:	83 c4 0c             	add    $0xc,%esp
+  8054c8:	5b                   	pop    %ebx
+  8054c9:	5e                   	pop    %esi
+  8054ca:	5f                   	pop    %edi
+  8054cb:	5d                   	pop    %ebp
+  8054cc:	c3                   	ret
+  8054cd:	f7 d8                	neg    %eax
+  8054cf:	83 d2 00             	adc    $0x0,%edx
+  8054d2:	f7 da                	neg    %edx
+  8054d4:	eb ef                	jmp    8054c5 <__divdi3+0x62>
+
+008054d6 <__moddi3>:
+  8054d6:	55                   	push   %ebp
+  8054d7:	57                   	push   %edi
+  8054d8:	56                   	push   %esi
+  8054d9:	53                   	push   %ebx
+  8054da:	83 ec 18             	sub    $0x18,%esp
+  8054dd:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8054e1:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8054e5:	89 f1                	mov    %esi,%ecx
+  8054e7:	f7 d9                	neg    %ecx
+  8054e9:	89 da                	mov    %ebx,%edx
+  8054eb:	83 d2 00             	adc    $0x0,%edx
+  8054ee:	f7 da                	neg    %edx
+  8054f0:	0f 48 ce             	cmovs  %esi,%ecx
+  8054f3:	0f 48 d3             	cmovs  %ebx,%edx
+  8054f6:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8054fa:	50                   	push   %eax
+  8054fb:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8054ff:	f7 de                	neg    %esi
+  805501:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  805505:	83 d0 00             	adc    $0x0,%eax
+  805508:	f7 d8                	neg    %eax
+  80550a:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80550f:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  805514:	50                   	push   %eax
+  805515:	56                   	push   %esi
+  805516:	89 c8                	mov    %ecx,%eax
+  805518:	e8 30 fe ff ff       	call   80534d <udivmod>
+  80551d:	83 c4 10             	add    $0x10,%esp
+  805520:	85 db                	test   %ebx,%ebx
+  805522:	78 10                	js     805534 <__moddi3+0x5e>
+  805524:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805528:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80552c:	83 c4 14             	add    $0x14,%esp
+  80552f:	5b                   	pop    %ebx
+  805530:	5e                   	pop    %esi
+  805531:	5f                   	pop    %edi
+  805532:	5d                   	pop    %ebp
+  805533:	c3                   	ret
+  805534:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805538:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80553c:	f7 d8                	neg    %eax
+  80553e:	83 d2 00             	adc    $0x0,%edx
+  805541:	f7 da                	neg    %edx
+  805543:	eb e7                	jmp    80552c <__moddi3+0x56>
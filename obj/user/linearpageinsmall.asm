@@ -0,0 +1,10006 @@
+
+obj/user/linearpageinsmall.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 89 01 00 00       	call   8001ba <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define SIZE 0x2000000
+#define BASE 0x10000000
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	int r, perm;
+	uintptr_t va;
+
+	if((r = page_alloc(0, (void*) 0x0f000000, PTE_P|PTE_U|PTE_W, 1)) < 0)
+  80003f:	6a 01                	push   $0x1
+  800041:	6a 07                	push   $0x7
+  800043:	68 00 00 00 0f       	push   $0xf000000
+  800048:	6a 00                	push   $0x0
+  80004a:	e8 85 35 00 00       	call   8035d4 <page_alloc>
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	85 c0                	test   %eax,%eax
+  800054:	78 6c                	js     8000c2 <umain+0x8f>
+		panic("sys_page_alloc on %p: %e", (void*) 0x0f000000, r);
+	*((char*)0x0f000000) = argc > 0 ? argv[0][0] : 'l';
+  800056:	b8 6c 00 00 00       	mov    $0x6c,%eax
+  80005b:	85 ff                	test   %edi,%edi
+  80005d:	7e 08                	jle    800067 <umain+0x34>
+  80005f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800062:	8b 00                	mov    (%eax),%eax
+  800064:	0f b6 00             	movzbl (%eax),%eax
+  800067:	a2 00 00 00 0f       	mov    %al,0xf000000
+
+	for(va = BASE; va < BASE+SIZE; va+=PGSIZE){
+  80006c:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+		//cprintf("[ls]+%x\n", va);
+		perm = PTE_P|PTE_U|PTE_W;
+		if ((va % 1000) == 0)
+  800071:	be d3 4d 62 10       	mov    $0x10624dd3,%esi
+  800076:	89 d8                	mov    %ebx,%eax
+  800078:	f7 e6                	mul    %esi
+  80007a:	c1 ea 06             	shr    $0x6,%edx
+  80007d:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+  800083:	89 d8                	mov    %ebx,%eax
+  800085:	29 d0                	sub    %edx,%eax
+		perm = PTE_P|PTE_U|PTE_W;
+  800087:	83 f8 01             	cmp    $0x1,%eax
+  80008a:	19 c0                	sbb    %eax,%eax
+  80008c:	25 00 04 00 00       	and    $0x400,%eax
+  800091:	83 c0 07             	add    $0x7,%eax
+			perm |= PTE_SHARE;
+		if((r = page_alloc(0, (void*) va, perm, 1)) < 0)
+  800094:	6a 01                	push   $0x1
+  800096:	50                   	push   %eax
+  800097:	53                   	push   %ebx
+  800098:	6a 00                	push   $0x0
+  80009a:	e8 35 35 00 00       	call   8035d4 <page_alloc>
+  80009f:	83 c4 10             	add    $0x10,%esp
+  8000a2:	85 c0                	test   %eax,%eax
+  8000a4:	78 36                	js     8000dc <umain+0xa9>
+			panic("sys_page_alloc on %p: %e", va, r);
+
+		// Store the address in the page
+		*(uintptr_t*)va = (uintptr_t)va;
+  8000a6:	89 1b                	mov    %ebx,(%ebx)
+	for(va = BASE; va < BASE+SIZE; va+=PGSIZE){
+  8000a8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8000ae:	81 fb 00 00 00 12    	cmp    $0x12000000,%ebx
+  8000b4:	75 c0                	jne    800076 <umain+0x43>
+	}
+
+	for(va = BASE; va < BASE+SIZE; va+=PGSIZE){
+  8000b6:	b9 00 00 00 10       	mov    $0x10000000,%ecx
+		//cprintf("[ls]+%x=%x\n", va, *(uintptr_t*)va);
+		assert(*(uintptr_t*)va == (uintptr_t)va);
+		if ((va % 1000) == 0)
+  8000bb:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  8000c0:	eb 65                	jmp    800127 <umain+0xf4>
+		panic("sys_page_alloc on %p: %e", (void*) 0x0f000000, r);
+  8000c2:	83 ec 0c             	sub    $0xc,%esp
+  8000c5:	50                   	push   %eax
+  8000c6:	68 00 00 00 0f       	push   $0xf000000
+  8000cb:	68 ec 4d 80 00       	push   $0x804dec
+  8000d0:	6a 12                	push   $0x12
+  8000d2:	68 50 4e 80 00       	push   $0x804e50
+  8000d7:	e8 41 01 00 00       	call   80021d <_panic>
+			panic("sys_page_alloc on %p: %e", va, r);
+  8000dc:	83 ec 0c             	sub    $0xc,%esp
+  8000df:	50                   	push   %eax
+  8000e0:	53                   	push   %ebx
+  8000e1:	68 ec 4d 80 00       	push   $0x804dec
+  8000e6:	6a 1b                	push   $0x1b
+  8000e8:	68 50 4e 80 00       	push   $0x804e50
+  8000ed:	e8 2b 01 00 00       	call   80021d <_panic>
+		assert(*(uintptr_t*)va == (uintptr_t)va);
+  8000f2:	68 78 4e 80 00       	push   $0x804e78
+  8000f7:	68 05 4e 80 00       	push   $0x804e05
+  8000fc:	6a 23                	push   $0x23
+  8000fe:	68 50 4e 80 00       	push   $0x804e50
+  800103:	e8 15 01 00 00       	call   80021d <_panic>
+			assert(uvpt[PGNUM(va)] & PTE_SHARE);
+		else
+			assert(!(uvpt[PGNUM(va)] & PTE_SHARE));
+  800108:	89 c8                	mov    %ecx,%eax
+  80010a:	c1 e8 0c             	shr    $0xc,%eax
+  80010d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800114:	f6 c4 04             	test   $0x4,%ah
+  800117:	75 4a                	jne    800163 <umain+0x130>
+	for(va = BASE; va < BASE+SIZE; va+=PGSIZE){
+  800119:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  80011f:	81 f9 00 00 00 12    	cmp    $0x12000000,%ecx
+  800125:	74 52                	je     800179 <umain+0x146>
+		assert(*(uintptr_t*)va == (uintptr_t)va);
+  800127:	39 09                	cmp    %ecx,(%ecx)
+  800129:	75 c7                	jne    8000f2 <umain+0xbf>
+		if ((va % 1000) == 0)
+  80012b:	89 c8                	mov    %ecx,%eax
+  80012d:	f7 e3                	mul    %ebx
+  80012f:	c1 ea 06             	shr    $0x6,%edx
+  800132:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+  800138:	39 d1                	cmp    %edx,%ecx
+  80013a:	75 cc                	jne    800108 <umain+0xd5>
+			assert(uvpt[PGNUM(va)] & PTE_SHARE);
+  80013c:	89 c8                	mov    %ecx,%eax
+  80013e:	c1 e8 0c             	shr    $0xc,%eax
+  800141:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800148:	f6 c4 04             	test   $0x4,%ah
+  80014b:	75 cc                	jne    800119 <umain+0xe6>
+  80014d:	68 1a 4e 80 00       	push   $0x804e1a
+  800152:	68 05 4e 80 00       	push   $0x804e05
+  800157:	6a 25                	push   $0x25
+  800159:	68 50 4e 80 00       	push   $0x804e50
+  80015e:	e8 ba 00 00 00       	call   80021d <_panic>
+			assert(!(uvpt[PGNUM(va)] & PTE_SHARE));
+  800163:	68 9c 4e 80 00       	push   $0x804e9c
+  800168:	68 05 4e 80 00       	push   $0x804e05
+  80016d:	6a 27                	push   $0x27
+  80016f:	68 50 4e 80 00       	push   $0x804e50
+  800174:	e8 a4 00 00 00       	call   80021d <_panic>
+	}
+
+	sys_cputs((char*)0x0f000000, 1);
+  800179:	83 ec 08             	sub    $0x8,%esp
+  80017c:	6a 01                	push   $0x1
+  80017e:	68 00 00 00 0f       	push   $0xf000000
+  800183:	e8 7d 0b 00 00       	call   800d05 <sys_cputs>
+
+	cprintf("%s: Passed all checks!\n", argc > 0 ? &(argv[0][1]) : "inearpagein");
+  800188:	83 c4 10             	add    $0x10,%esp
+  80018b:	b8 e0 4d 80 00       	mov    $0x804de0,%eax
+  800190:	85 ff                	test   %edi,%edi
+  800192:	7e 08                	jle    80019c <umain+0x169>
+  800194:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800197:	8b 00                	mov    (%eax),%eax
+  800199:	83 c0 01             	add    $0x1,%eax
+  80019c:	83 ec 08             	sub    $0x8,%esp
+  80019f:	50                   	push   %eax
+  8001a0:	68 36 4e 80 00       	push   $0x804e36
+  8001a5:	e8 4e 01 00 00       	call   8002f8 <cprintf>
+	get_and_print_paging_stats();
+  8001aa:	e8 5f 30 00 00       	call   80320e <get_and_print_paging_stats>
+}
+  8001af:	83 c4 10             	add    $0x10,%esp
+  8001b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001b5:	5b                   	pop    %ebx
+  8001b6:	5e                   	pop    %esi
+  8001b7:	5f                   	pop    %edi
+  8001b8:	5d                   	pop    %ebp
+  8001b9:	c3                   	ret
+
+008001ba <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ba:	55                   	push   %ebp
+  8001bb:	89 e5                	mov    %esp,%ebp
+  8001bd:	56                   	push   %esi
+  8001be:	53                   	push   %ebx
+  8001bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001c2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8001c5:	e8 ca 0b 00 00       	call   800d94 <sys_getenvid>
+  8001ca:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001cf:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8001d2:	c1 e0 06             	shl    $0x6,%eax
+  8001d5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001da:	a3 18 e9 80 00       	mov    %eax,0x80e918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001df:	85 db                	test   %ebx,%ebx
+  8001e1:	7e 07                	jle    8001ea <libmain+0x30>
+		binaryname = argv[0];
+  8001e3:	8b 06                	mov    (%esi),%eax
+  8001e5:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  8001ea:	83 ec 08             	sub    $0x8,%esp
+  8001ed:	56                   	push   %esi
+  8001ee:	53                   	push   %ebx
+  8001ef:	e8 3f fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8001f4:	e8 0a 00 00 00       	call   800203 <exit>
+}
+  8001f9:	83 c4 10             	add    $0x10,%esp
+  8001fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001ff:	5b                   	pop    %ebx
+  800200:	5e                   	pop    %esi
+  800201:	5d                   	pop    %ebp
+  800202:	c3                   	ret
+
+00800203 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800203:	55                   	push   %ebp
+  800204:	89 e5                	mov    %esp,%ebp
+  800206:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800209:	e8 2a 13 00 00       	call   801538 <close_all>
+	sys_env_destroy(0);
+  80020e:	83 ec 0c             	sub    $0xc,%esp
+  800211:	6a 00                	push   $0x0
+  800213:	e8 3b 0b 00 00       	call   800d53 <sys_env_destroy>
+}
+  800218:	83 c4 10             	add    $0x10,%esp
+  80021b:	c9                   	leave
+  80021c:	c3                   	ret
+
+0080021d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80021d:	55                   	push   %ebp
+  80021e:	89 e5                	mov    %esp,%ebp
+  800220:	56                   	push   %esi
+  800221:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800222:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800225:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80022b:	e8 64 0b 00 00       	call   800d94 <sys_getenvid>
+  800230:	83 ec 0c             	sub    $0xc,%esp
+  800233:	ff 75 0c             	push   0xc(%ebp)
+  800236:	ff 75 08             	push   0x8(%ebp)
+  800239:	56                   	push   %esi
+  80023a:	50                   	push   %eax
+  80023b:	68 c8 4e 80 00       	push   $0x804ec8
+  800240:	e8 b3 00 00 00       	call   8002f8 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800245:	83 c4 18             	add    $0x18,%esp
+  800248:	53                   	push   %ebx
+  800249:	ff 75 10             	push   0x10(%ebp)
+  80024c:	e8 56 00 00 00       	call   8002a7 <vcprintf>
+	cprintf("\n");
+  800251:	c7 04 24 4c 4e 80 00 	movl   $0x804e4c,(%esp)
+  800258:	e8 9b 00 00 00       	call   8002f8 <cprintf>
+  80025d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800260:	cc                   	int3
+	while (1)
+  800261:	eb fd                	jmp    800260 <_panic+0x43>
+
+00800263 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800263:	55                   	push   %ebp
+  800264:	89 e5                	mov    %esp,%ebp
+  800266:	53                   	push   %ebx
+  800267:	83 ec 04             	sub    $0x4,%esp
+  80026a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80026d:	8b 13                	mov    (%ebx),%edx
+  80026f:	8d 42 01             	lea    0x1(%edx),%eax
+  800272:	89 03                	mov    %eax,(%ebx)
+  800274:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800277:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80027b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800280:	74 09                	je     80028b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800282:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800286:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800289:	c9                   	leave
+  80028a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80028b:	83 ec 08             	sub    $0x8,%esp
+  80028e:	68 ff 00 00 00       	push   $0xff
+  800293:	8d 43 08             	lea    0x8(%ebx),%eax
+  800296:	50                   	push   %eax
+  800297:	e8 69 0a 00 00       	call   800d05 <sys_cputs>
+		b->idx = 0;
+  80029c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002a2:	83 c4 10             	add    $0x10,%esp
+  8002a5:	eb db                	jmp    800282 <putch+0x1f>
+
+008002a7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002a7:	55                   	push   %ebp
+  8002a8:	89 e5                	mov    %esp,%ebp
+  8002aa:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002b0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002b7:	00 00 00 
+	b.cnt = 0;
+  8002ba:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002c1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002c4:	ff 75 0c             	push   0xc(%ebp)
+  8002c7:	ff 75 08             	push   0x8(%ebp)
+  8002ca:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002d0:	50                   	push   %eax
+  8002d1:	68 63 02 80 00       	push   $0x800263
+  8002d6:	e8 14 01 00 00       	call   8003ef <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002db:	83 c4 08             	add    $0x8,%esp
+  8002de:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002e4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002ea:	50                   	push   %eax
+  8002eb:	e8 15 0a 00 00       	call   800d05 <sys_cputs>
+
+	return b.cnt;
+}
+  8002f0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002f6:	c9                   	leave
+  8002f7:	c3                   	ret
+
+008002f8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002f8:	55                   	push   %ebp
+  8002f9:	89 e5                	mov    %esp,%ebp
+  8002fb:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002fe:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800301:	50                   	push   %eax
+  800302:	ff 75 08             	push   0x8(%ebp)
+  800305:	e8 9d ff ff ff       	call   8002a7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80030a:	c9                   	leave
+  80030b:	c3                   	ret
+
+0080030c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80030c:	55                   	push   %ebp
+  80030d:	89 e5                	mov    %esp,%ebp
+  80030f:	57                   	push   %edi
+  800310:	56                   	push   %esi
+  800311:	53                   	push   %ebx
+  800312:	83 ec 1c             	sub    $0x1c,%esp
+  800315:	89 c7                	mov    %eax,%edi
+  800317:	89 d6                	mov    %edx,%esi
+  800319:	8b 45 08             	mov    0x8(%ebp),%eax
+  80031c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80031f:	89 d1                	mov    %edx,%ecx
+  800321:	89 c2                	mov    %eax,%edx
+  800323:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800326:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800329:	8b 45 10             	mov    0x10(%ebp),%eax
+  80032c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80032f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800332:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800339:	39 c2                	cmp    %eax,%edx
+  80033b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80033e:	72 3e                	jb     80037e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800340:	83 ec 0c             	sub    $0xc,%esp
+  800343:	ff 75 18             	push   0x18(%ebp)
+  800346:	83 eb 01             	sub    $0x1,%ebx
+  800349:	53                   	push   %ebx
+  80034a:	50                   	push   %eax
+  80034b:	83 ec 08             	sub    $0x8,%esp
+  80034e:	ff 75 e4             	push   -0x1c(%ebp)
+  800351:	ff 75 e0             	push   -0x20(%ebp)
+  800354:	ff 75 dc             	push   -0x24(%ebp)
+  800357:	ff 75 d8             	push   -0x28(%ebp)
+  80035a:	e8 4e 49 00 00       	call   804cad <__udivdi3>
+  80035f:	83 c4 18             	add    $0x18,%esp
+  800362:	52                   	push   %edx
+  800363:	50                   	push   %eax
+  800364:	89 f2                	mov    %esi,%edx
+  800366:	89 f8                	mov    %edi,%eax
+  800368:	e8 9f ff ff ff       	call   80030c <printnum>
+  80036d:	83 c4 20             	add    $0x20,%esp
+  800370:	eb 13                	jmp    800385 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800372:	83 ec 08             	sub    $0x8,%esp
+  800375:	56                   	push   %esi
+  800376:	ff 75 18             	push   0x18(%ebp)
+  800379:	ff d7                	call   *%edi
+  80037b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80037e:	83 eb 01             	sub    $0x1,%ebx
+  800381:	85 db                	test   %ebx,%ebx
+  800383:	7f ed                	jg     800372 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800385:	83 ec 08             	sub    $0x8,%esp
+  800388:	56                   	push   %esi
+  800389:	83 ec 04             	sub    $0x4,%esp
+  80038c:	ff 75 e4             	push   -0x1c(%ebp)
+  80038f:	ff 75 e0             	push   -0x20(%ebp)
+  800392:	ff 75 dc             	push   -0x24(%ebp)
+  800395:	ff 75 d8             	push   -0x28(%ebp)
+  800398:	e8 2e 49 00 00       	call   804ccb <__umoddi3>
+  80039d:	83 c4 14             	add    $0x14,%esp
+  8003a0:	0f be 80 eb 4e 80 00 	movsbl 0x804eeb(%eax),%eax
+  8003a7:	50                   	push   %eax
+  8003a8:	ff d7                	call   *%edi
+}
+  8003aa:	83 c4 10             	add    $0x10,%esp
+  8003ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003b0:	5b                   	pop    %ebx
+  8003b1:	5e                   	pop    %esi
+  8003b2:	5f                   	pop    %edi
+  8003b3:	5d                   	pop    %ebp
+  8003b4:	c3                   	ret
+
+008003b5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003b5:	55                   	push   %ebp
+  8003b6:	89 e5                	mov    %esp,%ebp
+  8003b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003bb:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003bf:	8b 10                	mov    (%eax),%edx
+  8003c1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003c4:	73 0a                	jae    8003d0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003c6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003c9:	89 08                	mov    %ecx,(%eax)
+  8003cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003ce:	88 02                	mov    %al,(%edx)
+}
+  8003d0:	5d                   	pop    %ebp
+  8003d1:	c3                   	ret
+
+008003d2 <printfmt>:
+{
+  8003d2:	55                   	push   %ebp
+  8003d3:	89 e5                	mov    %esp,%ebp
+  8003d5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003d8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003db:	50                   	push   %eax
+  8003dc:	ff 75 10             	push   0x10(%ebp)
+  8003df:	ff 75 0c             	push   0xc(%ebp)
+  8003e2:	ff 75 08             	push   0x8(%ebp)
+  8003e5:	e8 05 00 00 00       	call   8003ef <vprintfmt>
+}
+  8003ea:	83 c4 10             	add    $0x10,%esp
+  8003ed:	c9                   	leave
+  8003ee:	c3                   	ret
+
+008003ef <vprintfmt>:
+{
+  8003ef:	55                   	push   %ebp
+  8003f0:	89 e5                	mov    %esp,%ebp
+  8003f2:	57                   	push   %edi
+  8003f3:	56                   	push   %esi
+  8003f4:	53                   	push   %ebx
+  8003f5:	83 ec 2c             	sub    $0x2c,%esp
+  8003f8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003fe:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800401:	eb 0a                	jmp    80040d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800403:	83 ec 08             	sub    $0x8,%esp
+  800406:	53                   	push   %ebx
+  800407:	50                   	push   %eax
+  800408:	ff d6                	call   *%esi
+  80040a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80040d:	83 c7 01             	add    $0x1,%edi
+  800410:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800414:	83 f8 25             	cmp    $0x25,%eax
+  800417:	74 0c                	je     800425 <vprintfmt+0x36>
+			if (ch == '\0')
+  800419:	85 c0                	test   %eax,%eax
+  80041b:	75 e6                	jne    800403 <vprintfmt+0x14>
+}
+  80041d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800420:	5b                   	pop    %ebx
+  800421:	5e                   	pop    %esi
+  800422:	5f                   	pop    %edi
+  800423:	5d                   	pop    %ebp
+  800424:	c3                   	ret
+		padc = ' ';
+  800425:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800429:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800430:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800437:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80043e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800443:	8d 47 01             	lea    0x1(%edi),%eax
+  800446:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800449:	0f b6 17             	movzbl (%edi),%edx
+  80044c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80044f:	3c 55                	cmp    $0x55,%al
+  800451:	0f 87 c5 03 00 00    	ja     80081c <vprintfmt+0x42d>
+  800457:	0f b6 c0             	movzbl %al,%eax
+  80045a:	ff 24 85 80 50 80 00 	jmp    *0x805080(,%eax,4)
+  800461:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800464:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800468:	eb d9                	jmp    800443 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80046a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80046d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800471:	eb d0                	jmp    800443 <vprintfmt+0x54>
+  800473:	0f b6 d2             	movzbl %dl,%edx
+  800476:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800479:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800481:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800484:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800488:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80048b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80048e:	83 f9 09             	cmp    $0x9,%ecx
+  800491:	77 55                	ja     8004e8 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800493:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800496:	eb e9                	jmp    800481 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800498:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049b:	8b 00                	mov    (%eax),%eax
+  80049d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8004a6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004a9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004ac:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004b0:	79 91                	jns    800443 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004b2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004b5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004b8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004bf:	eb 82                	jmp    800443 <vprintfmt+0x54>
+			if (width < 0)
+  8004c1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004c4:	85 d2                	test   %edx,%edx
+  8004c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004cb:	0f 49 c2             	cmovns %edx,%eax
+  8004ce:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004d1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004d4:	e9 6a ff ff ff       	jmp    800443 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004dc:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004e3:	e9 5b ff ff ff       	jmp    800443 <vprintfmt+0x54>
+  8004e8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ee:	eb bc                	jmp    8004ac <vprintfmt+0xbd>
+			lflag++;
+  8004f0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004f6:	e9 48 ff ff ff       	jmp    800443 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fe:	8d 78 04             	lea    0x4(%eax),%edi
+  800501:	83 ec 08             	sub    $0x8,%esp
+  800504:	53                   	push   %ebx
+  800505:	ff 30                	push   (%eax)
+  800507:	ff d6                	call   *%esi
+			break;
+  800509:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80050c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80050f:	e9 63 02 00 00       	jmp    800777 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800514:	8b 45 14             	mov    0x14(%ebp),%eax
+  800517:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80051a:	8b 10                	mov    (%eax),%edx
+  80051c:	89 d0                	mov    %edx,%eax
+  80051e:	f7 d8                	neg    %eax
+  800520:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800523:	83 f8 12             	cmp    $0x12,%eax
+  800526:	7f 23                	jg     80054b <vprintfmt+0x15c>
+  800528:	8b 14 85 e0 51 80 00 	mov    0x8051e0(,%eax,4),%edx
+  80052f:	85 d2                	test   %edx,%edx
+  800531:	74 18                	je     80054b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800533:	52                   	push   %edx
+  800534:	68 17 4e 80 00       	push   $0x804e17
+  800539:	53                   	push   %ebx
+  80053a:	56                   	push   %esi
+  80053b:	e8 92 fe ff ff       	call   8003d2 <printfmt>
+  800540:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800543:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800546:	e9 2c 02 00 00       	jmp    800777 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80054b:	50                   	push   %eax
+  80054c:	68 03 4f 80 00       	push   $0x804f03
+  800551:	53                   	push   %ebx
+  800552:	56                   	push   %esi
+  800553:	e8 7a fe ff ff       	call   8003d2 <printfmt>
+  800558:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80055b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80055e:	e9 14 02 00 00       	jmp    800777 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800563:	8b 45 14             	mov    0x14(%ebp),%eax
+  800566:	83 c0 04             	add    $0x4,%eax
+  800569:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80056c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800571:	85 c9                	test   %ecx,%ecx
+  800573:	b8 fc 4e 80 00       	mov    $0x804efc,%eax
+  800578:	0f 45 c1             	cmovne %ecx,%eax
+  80057b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80057e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800582:	7e 06                	jle    80058a <vprintfmt+0x19b>
+  800584:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800588:	75 0b                	jne    800595 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80058a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80058d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800590:	89 75 08             	mov    %esi,0x8(%ebp)
+  800593:	eb 5c                	jmp    8005f1 <vprintfmt+0x202>
+  800595:	83 ec 08             	sub    $0x8,%esp
+  800598:	ff 75 d0             	push   -0x30(%ebp)
+  80059b:	ff 75 cc             	push   -0x34(%ebp)
+  80059e:	e8 19 03 00 00       	call   8008bc <strnlen>
+  8005a3:	89 c2                	mov    %eax,%edx
+  8005a5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005a8:	29 d0                	sub    %edx,%eax
+  8005aa:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005ad:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005b4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005b7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005b9:	eb 0e                	jmp    8005c9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005bb:	83 ec 08             	sub    $0x8,%esp
+  8005be:	53                   	push   %ebx
+  8005bf:	57                   	push   %edi
+  8005c0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c3:	83 ee 01             	sub    $0x1,%esi
+  8005c6:	83 c4 10             	add    $0x10,%esp
+  8005c9:	85 f6                	test   %esi,%esi
+  8005cb:	7f ee                	jg     8005bb <vprintfmt+0x1cc>
+  8005cd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005d3:	85 c0                	test   %eax,%eax
+  8005d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005da:	0f 49 d0             	cmovns %eax,%edx
+  8005dd:	29 d0                	sub    %edx,%eax
+  8005df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005e2:	eb a6                	jmp    80058a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005e4:	83 ec 08             	sub    $0x8,%esp
+  8005e7:	53                   	push   %ebx
+  8005e8:	52                   	push   %edx
+  8005e9:	ff 55 08             	call   *0x8(%ebp)
+  8005ec:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005ef:	89 f1                	mov    %esi,%ecx
+  8005f1:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005f4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005f8:	0f be d0             	movsbl %al,%edx
+  8005fb:	85 d2                	test   %edx,%edx
+  8005fd:	74 28                	je     800627 <vprintfmt+0x238>
+  8005ff:	85 ff                	test   %edi,%edi
+  800601:	78 05                	js     800608 <vprintfmt+0x219>
+  800603:	83 ef 01             	sub    $0x1,%edi
+  800606:	78 30                	js     800638 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800608:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80060c:	74 d6                	je     8005e4 <vprintfmt+0x1f5>
+  80060e:	0f be c0             	movsbl %al,%eax
+  800611:	83 e8 20             	sub    $0x20,%eax
+  800614:	83 f8 5e             	cmp    $0x5e,%eax
+  800617:	76 cb                	jbe    8005e4 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800619:	83 ec 08             	sub    $0x8,%esp
+  80061c:	53                   	push   %ebx
+  80061d:	6a 3f                	push   $0x3f
+  80061f:	ff 55 08             	call   *0x8(%ebp)
+  800622:	83 c4 10             	add    $0x10,%esp
+  800625:	eb c8                	jmp    8005ef <vprintfmt+0x200>
+  800627:	8b 75 08             	mov    0x8(%ebp),%esi
+  80062a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80062d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800630:	01 d0                	add    %edx,%eax
+  800632:	29 c8                	sub    %ecx,%eax
+  800634:	89 c7                	mov    %eax,%edi
+  800636:	eb 13                	jmp    80064b <vprintfmt+0x25c>
+  800638:	8b 75 08             	mov    0x8(%ebp),%esi
+  80063b:	eb ed                	jmp    80062a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80063d:	83 ec 08             	sub    $0x8,%esp
+  800640:	53                   	push   %ebx
+  800641:	6a 20                	push   $0x20
+  800643:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800645:	83 ef 01             	sub    $0x1,%edi
+  800648:	83 c4 10             	add    $0x10,%esp
+  80064b:	85 ff                	test   %edi,%edi
+  80064d:	7f ee                	jg     80063d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80064f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800652:	89 45 14             	mov    %eax,0x14(%ebp)
+  800655:	e9 1d 01 00 00       	jmp    800777 <vprintfmt+0x388>
+	if (lflag >= 2)
+  80065a:	83 f9 01             	cmp    $0x1,%ecx
+  80065d:	7f 1b                	jg     80067a <vprintfmt+0x28b>
+	else if (lflag)
+  80065f:	85 c9                	test   %ecx,%ecx
+  800661:	74 63                	je     8006c6 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800663:	8b 45 14             	mov    0x14(%ebp),%eax
+  800666:	8b 00                	mov    (%eax),%eax
+  800668:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80066b:	99                   	cltd
+  80066c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80066f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800672:	8d 40 04             	lea    0x4(%eax),%eax
+  800675:	89 45 14             	mov    %eax,0x14(%ebp)
+  800678:	eb 17                	jmp    800691 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80067a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067d:	8b 50 04             	mov    0x4(%eax),%edx
+  800680:	8b 00                	mov    (%eax),%eax
+  800682:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800685:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800688:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068b:	8d 40 08             	lea    0x8(%eax),%eax
+  80068e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800691:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800694:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800697:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80069c:	85 c9                	test   %ecx,%ecx
+  80069e:	0f 89 b9 00 00 00    	jns    80075d <vprintfmt+0x36e>
+				putch('-', putdat);
+  8006a4:	83 ec 08             	sub    $0x8,%esp
+  8006a7:	53                   	push   %ebx
+  8006a8:	6a 2d                	push   $0x2d
+  8006aa:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006ac:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006af:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006b2:	f7 da                	neg    %edx
+  8006b4:	83 d1 00             	adc    $0x0,%ecx
+  8006b7:	f7 d9                	neg    %ecx
+  8006b9:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006bc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006c1:	e9 97 00 00 00       	jmp    80075d <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8006c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c9:	8b 00                	mov    (%eax),%eax
+  8006cb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ce:	99                   	cltd
+  8006cf:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006db:	eb b4                	jmp    800691 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8006dd:	83 f9 01             	cmp    $0x1,%ecx
+  8006e0:	7f 1b                	jg     8006fd <vprintfmt+0x30e>
+	else if (lflag)
+  8006e2:	85 c9                	test   %ecx,%ecx
+  8006e4:	74 2c                	je     800712 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8006e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e9:	8b 10                	mov    (%eax),%edx
+  8006eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006f6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006fb:	eb 60                	jmp    80075d <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8006fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800700:	8b 10                	mov    (%eax),%edx
+  800702:	8b 48 04             	mov    0x4(%eax),%ecx
+  800705:	8d 40 08             	lea    0x8(%eax),%eax
+  800708:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80070b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800710:	eb 4b                	jmp    80075d <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800712:	8b 45 14             	mov    0x14(%ebp),%eax
+  800715:	8b 10                	mov    (%eax),%edx
+  800717:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071c:	8d 40 04             	lea    0x4(%eax),%eax
+  80071f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800722:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800727:	eb 34                	jmp    80075d <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800729:	83 f9 01             	cmp    $0x1,%ecx
+  80072c:	7f 15                	jg     800743 <vprintfmt+0x354>
+	else if (lflag)
+  80072e:	85 c9                	test   %ecx,%ecx
+  800730:	74 4d                	je     80077f <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800732:	8b 45 14             	mov    0x14(%ebp),%eax
+  800735:	8b 00                	mov    (%eax),%eax
+  800737:	99                   	cltd
+  800738:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80073b:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80073e:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800741:	eb 11                	jmp    800754 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800743:	8b 45 14             	mov    0x14(%ebp),%eax
+  800746:	8b 50 04             	mov    0x4(%eax),%edx
+  800749:	8b 00                	mov    (%eax),%eax
+  80074b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80074e:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800751:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800754:	89 d1                	mov    %edx,%ecx
+  800756:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800758:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80075d:	83 ec 0c             	sub    $0xc,%esp
+  800760:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800764:	50                   	push   %eax
+  800765:	ff 75 e0             	push   -0x20(%ebp)
+  800768:	57                   	push   %edi
+  800769:	51                   	push   %ecx
+  80076a:	52                   	push   %edx
+  80076b:	89 da                	mov    %ebx,%edx
+  80076d:	89 f0                	mov    %esi,%eax
+  80076f:	e8 98 fb ff ff       	call   80030c <printnum>
+			break;
+  800774:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800777:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80077a:	e9 8e fc ff ff       	jmp    80040d <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  80077f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800782:	8b 00                	mov    (%eax),%eax
+  800784:	99                   	cltd
+  800785:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800788:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80078b:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80078e:	eb c4                	jmp    800754 <vprintfmt+0x365>
+			putch('0', putdat);
+  800790:	83 ec 08             	sub    $0x8,%esp
+  800793:	53                   	push   %ebx
+  800794:	6a 30                	push   $0x30
+  800796:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800798:	83 c4 08             	add    $0x8,%esp
+  80079b:	53                   	push   %ebx
+  80079c:	6a 78                	push   $0x78
+  80079e:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a3:	8b 10                	mov    (%eax),%edx
+  8007a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007aa:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b3:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8007b8:	eb a3                	jmp    80075d <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8007ba:	83 f9 01             	cmp    $0x1,%ecx
+  8007bd:	7f 1b                	jg     8007da <vprintfmt+0x3eb>
+	else if (lflag)
+  8007bf:	85 c9                	test   %ecx,%ecx
+  8007c1:	74 2f                	je     8007f2 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8007c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c6:	8b 10                	mov    (%eax),%edx
+  8007c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007cd:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007d3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007d8:	eb 83                	jmp    80075d <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8007da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007dd:	8b 10                	mov    (%eax),%edx
+  8007df:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007e2:	8d 40 08             	lea    0x8(%eax),%eax
+  8007e5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007e8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007ed:	e9 6b ff ff ff       	jmp    80075d <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8007f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f5:	8b 10                	mov    (%eax),%edx
+  8007f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007fc:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800802:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800807:	e9 51 ff ff ff       	jmp    80075d <vprintfmt+0x36e>
+			putch(ch, putdat);
+  80080c:	83 ec 08             	sub    $0x8,%esp
+  80080f:	53                   	push   %ebx
+  800810:	6a 25                	push   $0x25
+  800812:	ff d6                	call   *%esi
+			break;
+  800814:	83 c4 10             	add    $0x10,%esp
+  800817:	e9 5b ff ff ff       	jmp    800777 <vprintfmt+0x388>
+			putch('%', putdat);
+  80081c:	83 ec 08             	sub    $0x8,%esp
+  80081f:	53                   	push   %ebx
+  800820:	6a 25                	push   $0x25
+  800822:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800824:	83 c4 10             	add    $0x10,%esp
+  800827:	89 f8                	mov    %edi,%eax
+  800829:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80082d:	74 05                	je     800834 <vprintfmt+0x445>
+  80082f:	83 e8 01             	sub    $0x1,%eax
+  800832:	eb f5                	jmp    800829 <vprintfmt+0x43a>
+  800834:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800837:	e9 3b ff ff ff       	jmp    800777 <vprintfmt+0x388>
+
+0080083c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80083c:	55                   	push   %ebp
+  80083d:	89 e5                	mov    %esp,%ebp
+  80083f:	83 ec 18             	sub    $0x18,%esp
+  800842:	8b 45 08             	mov    0x8(%ebp),%eax
+  800845:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800848:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80084b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80084f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800852:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800859:	85 c0                	test   %eax,%eax
+  80085b:	74 26                	je     800883 <vsnprintf+0x47>
+  80085d:	85 d2                	test   %edx,%edx
+  80085f:	7e 22                	jle    800883 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800861:	ff 75 14             	push   0x14(%ebp)
+  800864:	ff 75 10             	push   0x10(%ebp)
+  800867:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80086a:	50                   	push   %eax
+  80086b:	68 b5 03 80 00       	push   $0x8003b5
+  800870:	e8 7a fb ff ff       	call   8003ef <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800875:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800878:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80087b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80087e:	83 c4 10             	add    $0x10,%esp
+}
+  800881:	c9                   	leave
+  800882:	c3                   	ret
+		return -E_INVAL;
+  800883:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800888:	eb f7                	jmp    800881 <vsnprintf+0x45>
+
+0080088a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80088a:	55                   	push   %ebp
+  80088b:	89 e5                	mov    %esp,%ebp
+  80088d:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800890:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800893:	50                   	push   %eax
+  800894:	ff 75 10             	push   0x10(%ebp)
+  800897:	ff 75 0c             	push   0xc(%ebp)
+  80089a:	ff 75 08             	push   0x8(%ebp)
+  80089d:	e8 9a ff ff ff       	call   80083c <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008a2:	c9                   	leave
+  8008a3:	c3                   	ret
+
+008008a4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008a4:	55                   	push   %ebp
+  8008a5:	89 e5                	mov    %esp,%ebp
+  8008a7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008af:	eb 03                	jmp    8008b4 <strlen+0x10>
+		n++;
+  8008b1:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008b4:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008b8:	75 f7                	jne    8008b1 <strlen+0xd>
+	return n;
+}
+  8008ba:	5d                   	pop    %ebp
+  8008bb:	c3                   	ret
+
+008008bc <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008bc:	55                   	push   %ebp
+  8008bd:	89 e5                	mov    %esp,%ebp
+  8008bf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ca:	eb 03                	jmp    8008cf <strnlen+0x13>
+		n++;
+  8008cc:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008cf:	39 d0                	cmp    %edx,%eax
+  8008d1:	74 08                	je     8008db <strnlen+0x1f>
+  8008d3:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008d7:	75 f3                	jne    8008cc <strnlen+0x10>
+  8008d9:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008db:	89 d0                	mov    %edx,%eax
+  8008dd:	5d                   	pop    %ebp
+  8008de:	c3                   	ret
+
+008008df <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008df:	55                   	push   %ebp
+  8008e0:	89 e5                	mov    %esp,%ebp
+  8008e2:	53                   	push   %ebx
+  8008e3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008e6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ee:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008f2:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008f5:	83 c0 01             	add    $0x1,%eax
+  8008f8:	84 d2                	test   %dl,%dl
+  8008fa:	75 f2                	jne    8008ee <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008fc:	89 c8                	mov    %ecx,%eax
+  8008fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800901:	c9                   	leave
+  800902:	c3                   	ret
+
+00800903 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800903:	55                   	push   %ebp
+  800904:	89 e5                	mov    %esp,%ebp
+  800906:	53                   	push   %ebx
+  800907:	83 ec 10             	sub    $0x10,%esp
+  80090a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80090d:	53                   	push   %ebx
+  80090e:	e8 91 ff ff ff       	call   8008a4 <strlen>
+  800913:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800916:	ff 75 0c             	push   0xc(%ebp)
+  800919:	01 d8                	add    %ebx,%eax
+  80091b:	50                   	push   %eax
+  80091c:	e8 be ff ff ff       	call   8008df <strcpy>
+	return dst;
+}
+  800921:	89 d8                	mov    %ebx,%eax
+  800923:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800926:	c9                   	leave
+  800927:	c3                   	ret
+
+00800928 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800928:	55                   	push   %ebp
+  800929:	89 e5                	mov    %esp,%ebp
+  80092b:	56                   	push   %esi
+  80092c:	53                   	push   %ebx
+  80092d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800930:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800933:	89 f3                	mov    %esi,%ebx
+  800935:	03 5d 10             	add    0x10(%ebp),%ebx
+  800938:	89 f0                	mov    %esi,%eax
+  80093a:	eb 0f                	jmp    80094b <strncpy+0x23>
+		*dst++ = *src;
+  80093c:	83 c0 01             	add    $0x1,%eax
+  80093f:	0f b6 0a             	movzbl (%edx),%ecx
+  800942:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800945:	80 f9 01             	cmp    $0x1,%cl
+  800948:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80094b:	39 d8                	cmp    %ebx,%eax
+  80094d:	75 ed                	jne    80093c <strncpy+0x14>
+	}
+	return ret;
+}
+  80094f:	89 f0                	mov    %esi,%eax
+  800951:	5b                   	pop    %ebx
+  800952:	5e                   	pop    %esi
+  800953:	5d                   	pop    %ebp
+  800954:	c3                   	ret
+
+00800955 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800955:	55                   	push   %ebp
+  800956:	89 e5                	mov    %esp,%ebp
+  800958:	56                   	push   %esi
+  800959:	53                   	push   %ebx
+  80095a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80095d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800960:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800963:	89 f0                	mov    %esi,%eax
+  800965:	85 d2                	test   %edx,%edx
+  800967:	74 21                	je     80098a <strlcpy+0x35>
+  800969:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80096d:	89 f2                	mov    %esi,%edx
+  80096f:	eb 09                	jmp    80097a <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800971:	83 c1 01             	add    $0x1,%ecx
+  800974:	83 c2 01             	add    $0x1,%edx
+  800977:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80097a:	39 c2                	cmp    %eax,%edx
+  80097c:	74 09                	je     800987 <strlcpy+0x32>
+  80097e:	0f b6 19             	movzbl (%ecx),%ebx
+  800981:	84 db                	test   %bl,%bl
+  800983:	75 ec                	jne    800971 <strlcpy+0x1c>
+  800985:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800987:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80098a:	29 f0                	sub    %esi,%eax
+}
+  80098c:	5b                   	pop    %ebx
+  80098d:	5e                   	pop    %esi
+  80098e:	5d                   	pop    %ebp
+  80098f:	c3                   	ret
+
+00800990 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800990:	55                   	push   %ebp
+  800991:	89 e5                	mov    %esp,%ebp
+  800993:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800996:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800999:	eb 06                	jmp    8009a1 <strcmp+0x11>
+		p++, q++;
+  80099b:	83 c1 01             	add    $0x1,%ecx
+  80099e:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009a1:	0f b6 01             	movzbl (%ecx),%eax
+  8009a4:	84 c0                	test   %al,%al
+  8009a6:	74 04                	je     8009ac <strcmp+0x1c>
+  8009a8:	3a 02                	cmp    (%edx),%al
+  8009aa:	74 ef                	je     80099b <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009ac:	0f b6 c0             	movzbl %al,%eax
+  8009af:	0f b6 12             	movzbl (%edx),%edx
+  8009b2:	29 d0                	sub    %edx,%eax
+}
+  8009b4:	5d                   	pop    %ebp
+  8009b5:	c3                   	ret
+
+008009b6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009b6:	55                   	push   %ebp
+  8009b7:	89 e5                	mov    %esp,%ebp
+  8009b9:	53                   	push   %ebx
+  8009ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009c0:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009c3:	eb 09                	jmp    8009ce <strncmp+0x18>
+		n--, p++, q++;
+  8009c5:	83 ea 01             	sub    $0x1,%edx
+  8009c8:	83 c0 01             	add    $0x1,%eax
+  8009cb:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009ce:	85 d2                	test   %edx,%edx
+  8009d0:	74 18                	je     8009ea <strncmp+0x34>
+  8009d2:	0f b6 18             	movzbl (%eax),%ebx
+  8009d5:	84 db                	test   %bl,%bl
+  8009d7:	74 04                	je     8009dd <strncmp+0x27>
+  8009d9:	3a 19                	cmp    (%ecx),%bl
+  8009db:	74 e8                	je     8009c5 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009dd:	0f b6 00             	movzbl (%eax),%eax
+  8009e0:	0f b6 11             	movzbl (%ecx),%edx
+  8009e3:	29 d0                	sub    %edx,%eax
+}
+  8009e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009e8:	c9                   	leave
+  8009e9:	c3                   	ret
+		return 0;
+  8009ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ef:	eb f4                	jmp    8009e5 <strncmp+0x2f>
+
+008009f1 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009f1:	55                   	push   %ebp
+  8009f2:	89 e5                	mov    %esp,%ebp
+  8009f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009fb:	eb 03                	jmp    800a00 <strchr+0xf>
+  8009fd:	83 c0 01             	add    $0x1,%eax
+  800a00:	0f b6 10             	movzbl (%eax),%edx
+  800a03:	84 d2                	test   %dl,%dl
+  800a05:	74 06                	je     800a0d <strchr+0x1c>
+		if (*s == c)
+  800a07:	38 ca                	cmp    %cl,%dl
+  800a09:	75 f2                	jne    8009fd <strchr+0xc>
+  800a0b:	eb 05                	jmp    800a12 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a0d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a12:	5d                   	pop    %ebp
+  800a13:	c3                   	ret
+
+00800a14 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a14:	55                   	push   %ebp
+  800a15:	89 e5                	mov    %esp,%ebp
+  800a17:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a1e:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a21:	38 ca                	cmp    %cl,%dl
+  800a23:	74 09                	je     800a2e <strfind+0x1a>
+  800a25:	84 d2                	test   %dl,%dl
+  800a27:	74 05                	je     800a2e <strfind+0x1a>
+	for (; *s; s++)
+  800a29:	83 c0 01             	add    $0x1,%eax
+  800a2c:	eb f0                	jmp    800a1e <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a2e:	5d                   	pop    %ebp
+  800a2f:	c3                   	ret
+
+00800a30 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a30:	55                   	push   %ebp
+  800a31:	89 e5                	mov    %esp,%ebp
+  800a33:	57                   	push   %edi
+  800a34:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a37:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a3a:	85 c9                	test   %ecx,%ecx
+  800a3c:	74 20                	je     800a5e <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a3e:	89 f8                	mov    %edi,%eax
+  800a40:	09 c8                	or     %ecx,%eax
+  800a42:	a8 03                	test   $0x3,%al
+  800a44:	75 12                	jne    800a58 <memset+0x28>
+		c &= 0xFF;
+  800a46:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a4a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a50:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a53:	fc                   	cld
+  800a54:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a56:	eb 06                	jmp    800a5e <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a58:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a5b:	fc                   	cld
+  800a5c:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a5e:	89 f8                	mov    %edi,%eax
+  800a60:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a63:	c9                   	leave
+  800a64:	c3                   	ret
+
+00800a65 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a65:	55                   	push   %ebp
+  800a66:	89 e5                	mov    %esp,%ebp
+  800a68:	57                   	push   %edi
+  800a69:	56                   	push   %esi
+  800a6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a6d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a70:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a73:	39 c6                	cmp    %eax,%esi
+  800a75:	73 32                	jae    800aa9 <memmove+0x44>
+  800a77:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a7a:	39 d0                	cmp    %edx,%eax
+  800a7c:	73 2b                	jae    800aa9 <memmove+0x44>
+		s += n;
+		d += n;
+  800a7e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a81:	89 d6                	mov    %edx,%esi
+  800a83:	09 fe                	or     %edi,%esi
+  800a85:	09 ce                	or     %ecx,%esi
+  800a87:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a8d:	75 0e                	jne    800a9d <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a8f:	83 ef 04             	sub    $0x4,%edi
+  800a92:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a95:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a98:	fd                   	std
+  800a99:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a9b:	eb 09                	jmp    800aa6 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a9d:	83 ef 01             	sub    $0x1,%edi
+  800aa0:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800aa3:	fd                   	std
+  800aa4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800aa6:	fc                   	cld
+  800aa7:	eb 1a                	jmp    800ac3 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aa9:	89 f2                	mov    %esi,%edx
+  800aab:	09 c2                	or     %eax,%edx
+  800aad:	09 ca                	or     %ecx,%edx
+  800aaf:	f6 c2 03             	test   $0x3,%dl
+  800ab2:	75 0a                	jne    800abe <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ab4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ab7:	89 c7                	mov    %eax,%edi
+  800ab9:	fc                   	cld
+  800aba:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800abc:	eb 05                	jmp    800ac3 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800abe:	89 c7                	mov    %eax,%edi
+  800ac0:	fc                   	cld
+  800ac1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ac3:	5e                   	pop    %esi
+  800ac4:	5f                   	pop    %edi
+  800ac5:	5d                   	pop    %ebp
+  800ac6:	c3                   	ret
+
+00800ac7 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ac7:	55                   	push   %ebp
+  800ac8:	89 e5                	mov    %esp,%ebp
+  800aca:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800acd:	ff 75 10             	push   0x10(%ebp)
+  800ad0:	ff 75 0c             	push   0xc(%ebp)
+  800ad3:	ff 75 08             	push   0x8(%ebp)
+  800ad6:	e8 8a ff ff ff       	call   800a65 <memmove>
+}
+  800adb:	c9                   	leave
+  800adc:	c3                   	ret
+
+00800add <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800add:	55                   	push   %ebp
+  800ade:	89 e5                	mov    %esp,%ebp
+  800ae0:	56                   	push   %esi
+  800ae1:	53                   	push   %ebx
+  800ae2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ae8:	89 c6                	mov    %eax,%esi
+  800aea:	03 75 10             	add    0x10(%ebp),%esi
+  800aed:	eb 06                	jmp    800af5 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800aef:	83 c0 01             	add    $0x1,%eax
+  800af2:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800af5:	39 f0                	cmp    %esi,%eax
+  800af7:	74 14                	je     800b0d <memcmp+0x30>
+		if (*s1 != *s2)
+  800af9:	0f b6 08             	movzbl (%eax),%ecx
+  800afc:	0f b6 1a             	movzbl (%edx),%ebx
+  800aff:	38 d9                	cmp    %bl,%cl
+  800b01:	74 ec                	je     800aef <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b03:	0f b6 c1             	movzbl %cl,%eax
+  800b06:	0f b6 db             	movzbl %bl,%ebx
+  800b09:	29 d8                	sub    %ebx,%eax
+  800b0b:	eb 05                	jmp    800b12 <memcmp+0x35>
+	}
+
+	return 0;
+  800b0d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b12:	5b                   	pop    %ebx
+  800b13:	5e                   	pop    %esi
+  800b14:	5d                   	pop    %ebp
+  800b15:	c3                   	ret
+
+00800b16 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b16:	55                   	push   %ebp
+  800b17:	89 e5                	mov    %esp,%ebp
+  800b19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b1f:	89 c2                	mov    %eax,%edx
+  800b21:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b24:	eb 03                	jmp    800b29 <memfind+0x13>
+  800b26:	83 c0 01             	add    $0x1,%eax
+  800b29:	39 d0                	cmp    %edx,%eax
+  800b2b:	73 04                	jae    800b31 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b2d:	38 08                	cmp    %cl,(%eax)
+  800b2f:	75 f5                	jne    800b26 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b31:	5d                   	pop    %ebp
+  800b32:	c3                   	ret
+
+00800b33 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b33:	55                   	push   %ebp
+  800b34:	89 e5                	mov    %esp,%ebp
+  800b36:	57                   	push   %edi
+  800b37:	56                   	push   %esi
+  800b38:	53                   	push   %ebx
+  800b39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b3c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b3f:	eb 03                	jmp    800b44 <strtol+0x11>
+		s++;
+  800b41:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b44:	0f b6 02             	movzbl (%edx),%eax
+  800b47:	3c 20                	cmp    $0x20,%al
+  800b49:	74 f6                	je     800b41 <strtol+0xe>
+  800b4b:	3c 09                	cmp    $0x9,%al
+  800b4d:	74 f2                	je     800b41 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b4f:	3c 2b                	cmp    $0x2b,%al
+  800b51:	74 2a                	je     800b7d <strtol+0x4a>
+	int neg = 0;
+  800b53:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b58:	3c 2d                	cmp    $0x2d,%al
+  800b5a:	74 2b                	je     800b87 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b5c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b62:	75 0f                	jne    800b73 <strtol+0x40>
+  800b64:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b67:	74 28                	je     800b91 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b69:	85 db                	test   %ebx,%ebx
+  800b6b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b70:	0f 44 d8             	cmove  %eax,%ebx
+  800b73:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b78:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b7b:	eb 46                	jmp    800bc3 <strtol+0x90>
+		s++;
+  800b7d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b80:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b85:	eb d5                	jmp    800b5c <strtol+0x29>
+		s++, neg = 1;
+  800b87:	83 c2 01             	add    $0x1,%edx
+  800b8a:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b8f:	eb cb                	jmp    800b5c <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b91:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b95:	74 0e                	je     800ba5 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b97:	85 db                	test   %ebx,%ebx
+  800b99:	75 d8                	jne    800b73 <strtol+0x40>
+		s++, base = 8;
+  800b9b:	83 c2 01             	add    $0x1,%edx
+  800b9e:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ba3:	eb ce                	jmp    800b73 <strtol+0x40>
+		s += 2, base = 16;
+  800ba5:	83 c2 02             	add    $0x2,%edx
+  800ba8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bad:	eb c4                	jmp    800b73 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800baf:	0f be c0             	movsbl %al,%eax
+  800bb2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bb5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bb8:	7d 3a                	jge    800bf4 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bba:	83 c2 01             	add    $0x1,%edx
+  800bbd:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bc1:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bc3:	0f b6 02             	movzbl (%edx),%eax
+  800bc6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bc9:	89 f3                	mov    %esi,%ebx
+  800bcb:	80 fb 09             	cmp    $0x9,%bl
+  800bce:	76 df                	jbe    800baf <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bd0:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bd3:	89 f3                	mov    %esi,%ebx
+  800bd5:	80 fb 19             	cmp    $0x19,%bl
+  800bd8:	77 08                	ja     800be2 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bda:	0f be c0             	movsbl %al,%eax
+  800bdd:	83 e8 57             	sub    $0x57,%eax
+  800be0:	eb d3                	jmp    800bb5 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800be2:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800be5:	89 f3                	mov    %esi,%ebx
+  800be7:	80 fb 19             	cmp    $0x19,%bl
+  800bea:	77 08                	ja     800bf4 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bec:	0f be c0             	movsbl %al,%eax
+  800bef:	83 e8 37             	sub    $0x37,%eax
+  800bf2:	eb c1                	jmp    800bb5 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bf4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bf8:	74 05                	je     800bff <strtol+0xcc>
+		*endptr = (char *) s;
+  800bfa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bfd:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800bff:	89 c8                	mov    %ecx,%eax
+  800c01:	f7 d8                	neg    %eax
+  800c03:	85 ff                	test   %edi,%edi
+  800c05:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c08:	89 c8                	mov    %ecx,%eax
+  800c0a:	5b                   	pop    %ebx
+  800c0b:	5e                   	pop    %esi
+  800c0c:	5f                   	pop    %edi
+  800c0d:	5d                   	pop    %ebp
+  800c0e:	c3                   	ret
+
+00800c0f <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800c0f:	55                   	push   %ebp
+  800c10:	89 e5                	mov    %esp,%ebp
+  800c12:	57                   	push   %edi
+  800c13:	56                   	push   %esi
+  800c14:	53                   	push   %ebx
+  800c15:	83 ec 0c             	sub    $0xc,%esp
+  800c18:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800c1b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c1e:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800c21:	85 ff                	test   %edi,%edi
+  800c23:	74 16                	je     800c3b <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800c25:	83 ec 04             	sub    $0x4,%esp
+  800c28:	56                   	push   %esi
+  800c29:	6a 00                	push   $0x0
+  800c2b:	53                   	push   %ebx
+  800c2c:	e8 02 ff ff ff       	call   800b33 <strtol>
+  800c31:	89 07                	mov    %eax,(%edi)
+  800c33:	83 c4 10             	add    $0x10,%esp
+  800c36:	eb 03                	jmp    800c3b <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800c38:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800c3b:	0f b6 03             	movzbl (%ebx),%eax
+  800c3e:	3c 20                	cmp    $0x20,%al
+  800c40:	74 f6                	je     800c38 <strisl+0x29>
+  800c42:	3c 09                	cmp    $0x9,%al
+  800c44:	74 f2                	je     800c38 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c46:	3c 2b                	cmp    $0x2b,%al
+  800c48:	74 23                	je     800c6d <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800c4a:	3c 2d                	cmp    $0x2d,%al
+  800c4c:	0f 94 c0             	sete   %al
+  800c4f:	0f b6 c0             	movzbl %al,%eax
+  800c52:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c54:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800c5a:	75 41                	jne    800c9d <strisl+0x8e>
+  800c5c:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800c5f:	74 11                	je     800c72 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c61:	85 f6                	test   %esi,%esi
+  800c63:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c68:	0f 44 f0             	cmove  %eax,%esi
+  800c6b:	eb 30                	jmp    800c9d <strisl+0x8e>
+		s++;
+  800c6d:	83 c3 01             	add    $0x1,%ebx
+  800c70:	eb e2                	jmp    800c54 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c72:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800c76:	74 0e                	je     800c86 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800c78:	85 f6                	test   %esi,%esi
+  800c7a:	75 21                	jne    800c9d <strisl+0x8e>
+		s++, base = 8;
+  800c7c:	83 c3 01             	add    $0x1,%ebx
+  800c7f:	be 08 00 00 00       	mov    $0x8,%esi
+  800c84:	eb 17                	jmp    800c9d <strisl+0x8e>
+		s += 2, base = 16;
+  800c86:	83 c3 02             	add    $0x2,%ebx
+  800c89:	be 10 00 00 00       	mov    $0x10,%esi
+  800c8e:	eb 0d                	jmp    800c9d <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c90:	0f be c0             	movsbl %al,%eax
+  800c93:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800c96:	39 f0                	cmp    %esi,%eax
+  800c98:	7d 38                	jge    800cd2 <strisl+0xc3>
+			return 0;
+		s++;
+  800c9a:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800c9d:	0f b6 03             	movzbl (%ebx),%eax
+  800ca0:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800ca3:	80 fa 09             	cmp    $0x9,%dl
+  800ca6:	76 e8                	jbe    800c90 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800ca8:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800cab:	80 fa 19             	cmp    $0x19,%dl
+  800cae:	77 08                	ja     800cb8 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800cb0:	0f be c0             	movsbl %al,%eax
+  800cb3:	83 e8 57             	sub    $0x57,%eax
+  800cb6:	eb de                	jmp    800c96 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cb8:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800cbb:	80 fa 19             	cmp    $0x19,%dl
+  800cbe:	77 08                	ja     800cc8 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800cc0:	0f be c0             	movsbl %al,%eax
+  800cc3:	83 e8 37             	sub    $0x37,%eax
+  800cc6:	eb ce                	jmp    800c96 <strisl+0x87>
+		else if (!*s)
+  800cc8:	84 c0                	test   %al,%al
+  800cca:	0f 94 c0             	sete   %al
+  800ccd:	0f b6 c0             	movzbl %al,%eax
+  800cd0:	eb 05                	jmp    800cd7 <strisl+0xc8>
+			return 0;
+  800cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800cd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cda:	5b                   	pop    %ebx
+  800cdb:	5e                   	pop    %esi
+  800cdc:	5f                   	pop    %edi
+  800cdd:	5d                   	pop    %ebp
+  800cde:	c3                   	ret
+
+00800cdf <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800cdf:	55                   	push   %ebp
+  800ce0:	89 e5                	mov    %esp,%ebp
+  800ce2:	83 ec 10             	sub    $0x10,%esp
+  800ce5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800ce8:	89 c8                	mov    %ecx,%eax
+  800cea:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800cef:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800cf2:	eb 0b                	jmp    800cff <touch_mem+0x20>
+		c = *(char *)page;
+  800cf4:	0f b6 10             	movzbl (%eax),%edx
+  800cf7:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800cfa:	05 00 10 00 00       	add    $0x1000,%eax
+  800cff:	39 c8                	cmp    %ecx,%eax
+  800d01:	72 f1                	jb     800cf4 <touch_mem+0x15>
+}
+  800d03:	c9                   	leave
+  800d04:	c3                   	ret
+
+00800d05 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d05:	55                   	push   %ebp
+  800d06:	89 e5                	mov    %esp,%ebp
+  800d08:	57                   	push   %edi
+  800d09:	56                   	push   %esi
+  800d0a:	53                   	push   %ebx
+	touch_mem(s, len);
+  800d0b:	ff 75 0c             	push   0xc(%ebp)
+  800d0e:	ff 75 08             	push   0x8(%ebp)
+  800d11:	e8 c9 ff ff ff       	call   800cdf <touch_mem>
+	asm volatile("int %1\n"
+  800d16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d21:	89 c3                	mov    %eax,%ebx
+  800d23:	89 c7                	mov    %eax,%edi
+  800d25:	89 c6                	mov    %eax,%esi
+  800d27:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d29:	83 c4 08             	add    $0x8,%esp
+  800d2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d2f:	5b                   	pop    %ebx
+  800d30:	5e                   	pop    %esi
+  800d31:	5f                   	pop    %edi
+  800d32:	5d                   	pop    %ebp
+  800d33:	c3                   	ret
+
+00800d34 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d34:	55                   	push   %ebp
+  800d35:	89 e5                	mov    %esp,%ebp
+  800d37:	57                   	push   %edi
+  800d38:	56                   	push   %esi
+  800d39:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d3f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d44:	89 d1                	mov    %edx,%ecx
+  800d46:	89 d3                	mov    %edx,%ebx
+  800d48:	89 d7                	mov    %edx,%edi
+  800d4a:	89 d6                	mov    %edx,%esi
+  800d4c:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d4e:	5b                   	pop    %ebx
+  800d4f:	5e                   	pop    %esi
+  800d50:	5f                   	pop    %edi
+  800d51:	5d                   	pop    %ebp
+  800d52:	c3                   	ret
+
+00800d53 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d53:	55                   	push   %ebp
+  800d54:	89 e5                	mov    %esp,%ebp
+  800d56:	57                   	push   %edi
+  800d57:	56                   	push   %esi
+  800d58:	53                   	push   %ebx
+  800d59:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d64:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d69:	89 cb                	mov    %ecx,%ebx
+  800d6b:	89 cf                	mov    %ecx,%edi
+  800d6d:	89 ce                	mov    %ecx,%esi
+  800d6f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d71:	85 c0                	test   %eax,%eax
+  800d73:	7f 08                	jg     800d7d <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d78:	5b                   	pop    %ebx
+  800d79:	5e                   	pop    %esi
+  800d7a:	5f                   	pop    %edi
+  800d7b:	5d                   	pop    %ebp
+  800d7c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d7d:	83 ec 0c             	sub    $0xc,%esp
+  800d80:	50                   	push   %eax
+  800d81:	6a 03                	push   $0x3
+  800d83:	68 4b 52 80 00       	push   $0x80524b
+  800d88:	6a 23                	push   $0x23
+  800d8a:	68 68 52 80 00       	push   $0x805268
+  800d8f:	e8 89 f4 ff ff       	call   80021d <_panic>
+
+00800d94 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d94:	55                   	push   %ebp
+  800d95:	89 e5                	mov    %esp,%ebp
+  800d97:	57                   	push   %edi
+  800d98:	56                   	push   %esi
+  800d99:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800da4:	89 d1                	mov    %edx,%ecx
+  800da6:	89 d3                	mov    %edx,%ebx
+  800da8:	89 d7                	mov    %edx,%edi
+  800daa:	89 d6                	mov    %edx,%esi
+  800dac:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dae:	5b                   	pop    %ebx
+  800daf:	5e                   	pop    %esi
+  800db0:	5f                   	pop    %edi
+  800db1:	5d                   	pop    %ebp
+  800db2:	c3                   	ret
+
+00800db3 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800db3:	55                   	push   %ebp
+  800db4:	89 e5                	mov    %esp,%ebp
+  800db6:	57                   	push   %edi
+  800db7:	56                   	push   %esi
+  800db8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800db9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbe:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dc3:	89 d1                	mov    %edx,%ecx
+  800dc5:	89 d3                	mov    %edx,%ebx
+  800dc7:	89 d7                	mov    %edx,%edi
+  800dc9:	89 d6                	mov    %edx,%esi
+  800dcb:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800dcd:	5b                   	pop    %ebx
+  800dce:	5e                   	pop    %esi
+  800dcf:	5f                   	pop    %edi
+  800dd0:	5d                   	pop    %ebp
+  800dd1:	c3                   	ret
+
+00800dd2 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800dd2:	55                   	push   %ebp
+  800dd3:	89 e5                	mov    %esp,%ebp
+  800dd5:	57                   	push   %edi
+  800dd6:	56                   	push   %esi
+  800dd7:	53                   	push   %ebx
+  800dd8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ddb:	be 00 00 00 00       	mov    $0x0,%esi
+  800de0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de6:	b8 04 00 00 00       	mov    $0x4,%eax
+  800deb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dee:	89 f7                	mov    %esi,%edi
+  800df0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800df2:	85 c0                	test   %eax,%eax
+  800df4:	7f 08                	jg     800dfe <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800df6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df9:	5b                   	pop    %ebx
+  800dfa:	5e                   	pop    %esi
+  800dfb:	5f                   	pop    %edi
+  800dfc:	5d                   	pop    %ebp
+  800dfd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dfe:	83 ec 0c             	sub    $0xc,%esp
+  800e01:	50                   	push   %eax
+  800e02:	6a 04                	push   $0x4
+  800e04:	68 4b 52 80 00       	push   $0x80524b
+  800e09:	6a 23                	push   $0x23
+  800e0b:	68 68 52 80 00       	push   $0x805268
+  800e10:	e8 08 f4 ff ff       	call   80021d <_panic>
+
+00800e15 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e15:	55                   	push   %ebp
+  800e16:	89 e5                	mov    %esp,%ebp
+  800e18:	57                   	push   %edi
+  800e19:	56                   	push   %esi
+  800e1a:	53                   	push   %ebx
+  800e1b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e24:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e2c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e2f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e32:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e34:	85 c0                	test   %eax,%eax
+  800e36:	7f 08                	jg     800e40 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e3b:	5b                   	pop    %ebx
+  800e3c:	5e                   	pop    %esi
+  800e3d:	5f                   	pop    %edi
+  800e3e:	5d                   	pop    %ebp
+  800e3f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e40:	83 ec 0c             	sub    $0xc,%esp
+  800e43:	50                   	push   %eax
+  800e44:	6a 05                	push   $0x5
+  800e46:	68 4b 52 80 00       	push   $0x80524b
+  800e4b:	6a 23                	push   $0x23
+  800e4d:	68 68 52 80 00       	push   $0x805268
+  800e52:	e8 c6 f3 ff ff       	call   80021d <_panic>
+
+00800e57 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e57:	55                   	push   %ebp
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	57                   	push   %edi
+  800e5b:	56                   	push   %esi
+  800e5c:	53                   	push   %ebx
+  800e5d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e70:	89 df                	mov    %ebx,%edi
+  800e72:	89 de                	mov    %ebx,%esi
+  800e74:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e76:	85 c0                	test   %eax,%eax
+  800e78:	7f 08                	jg     800e82 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7d:	5b                   	pop    %ebx
+  800e7e:	5e                   	pop    %esi
+  800e7f:	5f                   	pop    %edi
+  800e80:	5d                   	pop    %ebp
+  800e81:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e82:	83 ec 0c             	sub    $0xc,%esp
+  800e85:	50                   	push   %eax
+  800e86:	6a 06                	push   $0x6
+  800e88:	68 4b 52 80 00       	push   $0x80524b
+  800e8d:	6a 23                	push   $0x23
+  800e8f:	68 68 52 80 00       	push   $0x805268
+  800e94:	e8 84 f3 ff ff       	call   80021d <_panic>
+
+00800e99 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800e99:	55                   	push   %ebp
+  800e9a:	89 e5                	mov    %esp,%ebp
+  800e9c:	57                   	push   %edi
+  800e9d:	56                   	push   %esi
+  800e9e:	53                   	push   %ebx
+  800e9f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ea2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eaa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ead:	b8 18 00 00 00       	mov    $0x18,%eax
+  800eb2:	89 df                	mov    %ebx,%edi
+  800eb4:	89 de                	mov    %ebx,%esi
+  800eb6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb8:	85 c0                	test   %eax,%eax
+  800eba:	7f 08                	jg     800ec4 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ebc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ebf:	5b                   	pop    %ebx
+  800ec0:	5e                   	pop    %esi
+  800ec1:	5f                   	pop    %edi
+  800ec2:	5d                   	pop    %ebp
+  800ec3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec4:	83 ec 0c             	sub    $0xc,%esp
+  800ec7:	50                   	push   %eax
+  800ec8:	6a 18                	push   $0x18
+  800eca:	68 4b 52 80 00       	push   $0x80524b
+  800ecf:	6a 23                	push   $0x23
+  800ed1:	68 68 52 80 00       	push   $0x805268
+  800ed6:	e8 42 f3 ff ff       	call   80021d <_panic>
+
+00800edb <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800edb:	55                   	push   %ebp
+  800edc:	89 e5                	mov    %esp,%ebp
+  800ede:	57                   	push   %edi
+  800edf:	56                   	push   %esi
+  800ee0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ee1:	be 00 00 00 00       	mov    $0x0,%esi
+  800ee6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eec:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ef1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef4:	89 f7                	mov    %esi,%edi
+  800ef6:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800ef8:	5b                   	pop    %ebx
+  800ef9:	5e                   	pop    %esi
+  800efa:	5f                   	pop    %edi
+  800efb:	5d                   	pop    %ebp
+  800efc:	c3                   	ret
+
+00800efd <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800efd:	55                   	push   %ebp
+  800efe:	89 e5                	mov    %esp,%ebp
+  800f00:	57                   	push   %edi
+  800f01:	56                   	push   %esi
+  800f02:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f09:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f0e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f13:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f16:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f19:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800f1b:	5b                   	pop    %ebx
+  800f1c:	5e                   	pop    %esi
+  800f1d:	5f                   	pop    %edi
+  800f1e:	5d                   	pop    %ebp
+  800f1f:	c3                   	ret
+
+00800f20 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800f20:	55                   	push   %ebp
+  800f21:	89 e5                	mov    %esp,%ebp
+  800f23:	57                   	push   %edi
+  800f24:	56                   	push   %esi
+  800f25:	53                   	push   %ebx
+  800f26:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800f29:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800f2c:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800f32:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800f35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f40:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f43:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f46:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f48:	85 c0                	test   %eax,%eax
+  800f4a:	7f 08                	jg     800f54 <sys_page_map_range+0x34>
+}
+  800f4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4f:	5b                   	pop    %ebx
+  800f50:	5e                   	pop    %esi
+  800f51:	5f                   	pop    %edi
+  800f52:	5d                   	pop    %ebp
+  800f53:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f54:	83 ec 0c             	sub    $0xc,%esp
+  800f57:	50                   	push   %eax
+  800f58:	6a 10                	push   $0x10
+  800f5a:	68 4b 52 80 00       	push   $0x80524b
+  800f5f:	6a 23                	push   $0x23
+  800f61:	68 68 52 80 00       	push   $0x805268
+  800f66:	e8 b2 f2 ff ff       	call   80021d <_panic>
+
+00800f6b <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f6b:	55                   	push   %ebp
+  800f6c:	89 e5                	mov    %esp,%ebp
+  800f6e:	57                   	push   %edi
+  800f6f:	56                   	push   %esi
+  800f70:	53                   	push   %ebx
+  800f71:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f74:	be 00 00 00 00       	mov    $0x0,%esi
+  800f79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7f:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f84:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f87:	89 f7                	mov    %esi,%edi
+  800f89:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f8b:	85 c0                	test   %eax,%eax
+  800f8d:	7f 08                	jg     800f97 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f92:	5b                   	pop    %ebx
+  800f93:	5e                   	pop    %esi
+  800f94:	5f                   	pop    %edi
+  800f95:	5d                   	pop    %ebp
+  800f96:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f97:	83 ec 0c             	sub    $0xc,%esp
+  800f9a:	50                   	push   %eax
+  800f9b:	6a 11                	push   $0x11
+  800f9d:	68 4b 52 80 00       	push   $0x80524b
+  800fa2:	6a 23                	push   $0x23
+  800fa4:	68 68 52 80 00       	push   $0x805268
+  800fa9:	e8 6f f2 ff ff       	call   80021d <_panic>
+
+00800fae <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800fae:	55                   	push   %ebp
+  800faf:	89 e5                	mov    %esp,%ebp
+  800fb1:	57                   	push   %edi
+  800fb2:	56                   	push   %esi
+  800fb3:	53                   	push   %ebx
+  800fb4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fb7:	be 00 00 00 00       	mov    $0x0,%esi
+  800fbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800fc7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fca:	89 f7                	mov    %esi,%edi
+  800fcc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fce:	85 c0                	test   %eax,%eax
+  800fd0:	7f 08                	jg     800fda <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800fd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd5:	5b                   	pop    %ebx
+  800fd6:	5e                   	pop    %esi
+  800fd7:	5f                   	pop    %edi
+  800fd8:	5d                   	pop    %ebp
+  800fd9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fda:	83 ec 0c             	sub    $0xc,%esp
+  800fdd:	50                   	push   %eax
+  800fde:	6a 1b                	push   $0x1b
+  800fe0:	68 4b 52 80 00       	push   $0x80524b
+  800fe5:	6a 23                	push   $0x23
+  800fe7:	68 68 52 80 00       	push   $0x805268
+  800fec:	e8 2c f2 ff ff       	call   80021d <_panic>
+
+00800ff1 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800ff1:	55                   	push   %ebp
+  800ff2:	89 e5                	mov    %esp,%ebp
+  800ff4:	57                   	push   %edi
+  800ff5:	56                   	push   %esi
+  800ff6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ff7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ffc:	b8 12 00 00 00       	mov    $0x12,%eax
+  801001:	89 d1                	mov    %edx,%ecx
+  801003:	89 d3                	mov    %edx,%ebx
+  801005:	89 d7                	mov    %edx,%edi
+  801007:	89 d6                	mov    %edx,%esi
+  801009:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80100b:	5b                   	pop    %ebx
+  80100c:	5e                   	pop    %esi
+  80100d:	5f                   	pop    %edi
+  80100e:	5d                   	pop    %ebp
+  80100f:	c3                   	ret
+
+00801010 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801010:	55                   	push   %ebp
+  801011:	89 e5                	mov    %esp,%ebp
+  801013:	57                   	push   %edi
+  801014:	56                   	push   %esi
+  801015:	53                   	push   %ebx
+  801016:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801019:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801021:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801024:	b8 08 00 00 00       	mov    $0x8,%eax
+  801029:	89 df                	mov    %ebx,%edi
+  80102b:	89 de                	mov    %ebx,%esi
+  80102d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80102f:	85 c0                	test   %eax,%eax
+  801031:	7f 08                	jg     80103b <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801033:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801036:	5b                   	pop    %ebx
+  801037:	5e                   	pop    %esi
+  801038:	5f                   	pop    %edi
+  801039:	5d                   	pop    %ebp
+  80103a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80103b:	83 ec 0c             	sub    $0xc,%esp
+  80103e:	50                   	push   %eax
+  80103f:	6a 08                	push   $0x8
+  801041:	68 4b 52 80 00       	push   $0x80524b
+  801046:	6a 23                	push   $0x23
+  801048:	68 68 52 80 00       	push   $0x805268
+  80104d:	e8 cb f1 ff ff       	call   80021d <_panic>
+
+00801052 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801052:	55                   	push   %ebp
+  801053:	89 e5                	mov    %esp,%ebp
+  801055:	57                   	push   %edi
+  801056:	56                   	push   %esi
+  801057:	53                   	push   %ebx
+  801058:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  80105b:	6a 44                	push   $0x44
+  80105d:	ff 75 0c             	push   0xc(%ebp)
+  801060:	e8 7a fc ff ff       	call   800cdf <touch_mem>
+	asm volatile("int %1\n"
+  801065:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801072:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801075:	89 df                	mov    %ebx,%edi
+  801077:	89 de                	mov    %ebx,%esi
+  801079:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80107b:	83 c4 08             	add    $0x8,%esp
+  80107e:	85 c0                	test   %eax,%eax
+  801080:	7f 08                	jg     80108a <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801082:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801085:	5b                   	pop    %ebx
+  801086:	5e                   	pop    %esi
+  801087:	5f                   	pop    %edi
+  801088:	5d                   	pop    %ebp
+  801089:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80108a:	83 ec 0c             	sub    $0xc,%esp
+  80108d:	50                   	push   %eax
+  80108e:	6a 09                	push   $0x9
+  801090:	68 4b 52 80 00       	push   $0x80524b
+  801095:	6a 23                	push   $0x23
+  801097:	68 68 52 80 00       	push   $0x805268
+  80109c:	e8 7c f1 ff ff       	call   80021d <_panic>
+
+008010a1 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  8010a1:	55                   	push   %ebp
+  8010a2:	89 e5                	mov    %esp,%ebp
+  8010a4:	57                   	push   %edi
+  8010a5:	56                   	push   %esi
+  8010a6:	53                   	push   %ebx
+  8010a7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8010af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8010ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010bd:	89 f7                	mov    %esi,%edi
+  8010bf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010c1:	85 c0                	test   %eax,%eax
+  8010c3:	7f 08                	jg     8010cd <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  8010c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c8:	5b                   	pop    %ebx
+  8010c9:	5e                   	pop    %esi
+  8010ca:	5f                   	pop    %edi
+  8010cb:	5d                   	pop    %ebp
+  8010cc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010cd:	83 ec 0c             	sub    $0xc,%esp
+  8010d0:	50                   	push   %eax
+  8010d1:	6a 1a                	push   $0x1a
+  8010d3:	68 4b 52 80 00       	push   $0x80524b
+  8010d8:	6a 23                	push   $0x23
+  8010da:	68 68 52 80 00       	push   $0x805268
+  8010df:	e8 39 f1 ff ff       	call   80021d <_panic>
+
+008010e4 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8010e4:	55                   	push   %ebp
+  8010e5:	89 e5                	mov    %esp,%ebp
+  8010e7:	57                   	push   %edi
+  8010e8:	56                   	push   %esi
+  8010e9:	53                   	push   %ebx
+  8010ea:	83 ec 0c             	sub    $0xc,%esp
+  8010ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8010f0:	89 d8                	mov    %ebx,%eax
+  8010f2:	c1 e0 05             	shl    $0x5,%eax
+  8010f5:	50                   	push   %eax
+  8010f6:	ff 75 0c             	push   0xc(%ebp)
+  8010f9:	e8 e1 fb ff ff       	call   800cdf <touch_mem>
+	asm volatile("int %1\n"
+  8010fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801103:	8b 55 08             	mov    0x8(%ebp),%edx
+  801106:	b8 13 00 00 00       	mov    $0x13,%eax
+  80110b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110e:	89 f7                	mov    %esi,%edi
+  801110:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801112:	83 c4 08             	add    $0x8,%esp
+  801115:	85 c0                	test   %eax,%eax
+  801117:	7f 08                	jg     801121 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  801119:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111c:	5b                   	pop    %ebx
+  80111d:	5e                   	pop    %esi
+  80111e:	5f                   	pop    %edi
+  80111f:	5d                   	pop    %ebp
+  801120:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801121:	83 ec 0c             	sub    $0xc,%esp
+  801124:	50                   	push   %eax
+  801125:	6a 13                	push   $0x13
+  801127:	68 4b 52 80 00       	push   $0x80524b
+  80112c:	6a 23                	push   $0x23
+  80112e:	68 68 52 80 00       	push   $0x805268
+  801133:	e8 e5 f0 ff ff       	call   80021d <_panic>
+
+00801138 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801138:	55                   	push   %ebp
+  801139:	89 e5                	mov    %esp,%ebp
+  80113b:	57                   	push   %edi
+  80113c:	56                   	push   %esi
+  80113d:	53                   	push   %ebx
+  80113e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801141:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801146:	8b 55 08             	mov    0x8(%ebp),%edx
+  801149:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801151:	89 df                	mov    %ebx,%edi
+  801153:	89 de                	mov    %ebx,%esi
+  801155:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801157:	85 c0                	test   %eax,%eax
+  801159:	7f 08                	jg     801163 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80115b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115e:	5b                   	pop    %ebx
+  80115f:	5e                   	pop    %esi
+  801160:	5f                   	pop    %edi
+  801161:	5d                   	pop    %ebp
+  801162:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801163:	83 ec 0c             	sub    $0xc,%esp
+  801166:	50                   	push   %eax
+  801167:	6a 0a                	push   $0xa
+  801169:	68 4b 52 80 00       	push   $0x80524b
+  80116e:	6a 23                	push   $0x23
+  801170:	68 68 52 80 00       	push   $0x805268
+  801175:	e8 a3 f0 ff ff       	call   80021d <_panic>
+
+0080117a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	57                   	push   %edi
+  80117e:	56                   	push   %esi
+  80117f:	53                   	push   %ebx
+  801180:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801183:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801189:	76 1d                	jbe    8011a8 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80118b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801191:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801196:	be 01 00 00 00       	mov    $0x1,%esi
+  80119b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80119e:	cd 30                	int    $0x30
+}
+  8011a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a3:	5b                   	pop    %ebx
+  8011a4:	5e                   	pop    %esi
+  8011a5:	5f                   	pop    %edi
+  8011a6:	5d                   	pop    %ebp
+  8011a7:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011a8:	68 00 10 00 00       	push   $0x1000
+  8011ad:	53                   	push   %ebx
+  8011ae:	e8 2c fb ff ff       	call   800cdf <touch_mem>
+  8011b3:	83 c4 08             	add    $0x8,%esp
+  8011b6:	eb d3                	jmp    80118b <sys_ipc_send+0x11>
+
+008011b8 <sys_ipc_send_pages>:
+{
+  8011b8:	55                   	push   %ebp
+  8011b9:	89 e5                	mov    %esp,%ebp
+  8011bb:	57                   	push   %edi
+  8011bc:	56                   	push   %esi
+  8011bd:	53                   	push   %ebx
+  8011be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c1:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8011c4:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011ca:	76 18                	jbe    8011e4 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8011cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011d7:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8011da:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8011dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011df:	5b                   	pop    %ebx
+  8011e0:	5e                   	pop    %esi
+  8011e1:	5f                   	pop    %edi
+  8011e2:	5d                   	pop    %ebp
+  8011e3:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011e4:	89 f0                	mov    %esi,%eax
+  8011e6:	c1 e0 0c             	shl    $0xc,%eax
+  8011e9:	50                   	push   %eax
+  8011ea:	53                   	push   %ebx
+  8011eb:	e8 ef fa ff ff       	call   800cdf <touch_mem>
+  8011f0:	83 c4 08             	add    $0x8,%esp
+  8011f3:	eb d7                	jmp    8011cc <sys_ipc_send_pages+0x14>
+
+008011f5 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8011f5:	55                   	push   %ebp
+  8011f6:	89 e5                	mov    %esp,%ebp
+  8011f8:	57                   	push   %edi
+  8011f9:	56                   	push   %esi
+  8011fa:	53                   	push   %ebx
+  8011fb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801203:	8b 55 08             	mov    0x8(%ebp),%edx
+  801206:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801209:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80120e:	89 df                	mov    %ebx,%edi
+  801210:	89 de                	mov    %ebx,%esi
+  801212:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801214:	85 c0                	test   %eax,%eax
+  801216:	7f 08                	jg     801220 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801218:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80121b:	5b                   	pop    %ebx
+  80121c:	5e                   	pop    %esi
+  80121d:	5f                   	pop    %edi
+  80121e:	5d                   	pop    %ebp
+  80121f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801220:	83 ec 0c             	sub    $0xc,%esp
+  801223:	50                   	push   %eax
+  801224:	6a 0d                	push   $0xd
+  801226:	68 4b 52 80 00       	push   $0x80524b
+  80122b:	6a 23                	push   $0x23
+  80122d:	68 68 52 80 00       	push   $0x805268
+  801232:	e8 e6 ef ff ff       	call   80021d <_panic>
+
+00801237 <sys_ipc_recv>:
+{
+  801237:	55                   	push   %ebp
+  801238:	89 e5                	mov    %esp,%ebp
+  80123a:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80123d:	6a 01                	push   $0x1
+  80123f:	ff 75 08             	push   0x8(%ebp)
+  801242:	e8 ae ff ff ff       	call   8011f5 <sys_ipc_recv_pages>
+}
+  801247:	c9                   	leave
+  801248:	c3                   	ret
+
+00801249 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801249:	55                   	push   %ebp
+  80124a:	89 e5                	mov    %esp,%ebp
+  80124c:	57                   	push   %edi
+  80124d:	56                   	push   %esi
+  80124e:	53                   	push   %ebx
+  80124f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801252:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801255:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801258:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80125e:	77 04                	ja     801264 <sys_ipc_call+0x1b>
+  801260:	85 f6                	test   %esi,%esi
+  801262:	75 15                	jne    801279 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801264:	8b 55 08             	mov    0x8(%ebp),%edx
+  801267:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80126f:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801271:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801274:	5b                   	pop    %ebx
+  801275:	5e                   	pop    %esi
+  801276:	5f                   	pop    %edi
+  801277:	5d                   	pop    %ebp
+  801278:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  801279:	89 f8                	mov    %edi,%eax
+  80127b:	c1 e0 0c             	shl    $0xc,%eax
+  80127e:	50                   	push   %eax
+  80127f:	53                   	push   %ebx
+  801280:	e8 5a fa ff ff       	call   800cdf <touch_mem>
+  801285:	83 c4 08             	add    $0x8,%esp
+  801288:	eb da                	jmp    801264 <sys_ipc_call+0x1b>
+
+0080128a <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80128a:	55                   	push   %ebp
+  80128b:	89 e5                	mov    %esp,%ebp
+  80128d:	57                   	push   %edi
+  80128e:	56                   	push   %esi
+  80128f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801290:	8b 55 08             	mov    0x8(%ebp),%edx
+  801293:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801296:	b8 15 00 00 00       	mov    $0x15,%eax
+  80129b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80129e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012a1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012a4:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8012a6:	5b                   	pop    %ebx
+  8012a7:	5e                   	pop    %esi
+  8012a8:	5f                   	pop    %edi
+  8012a9:	5d                   	pop    %ebp
+  8012aa:	c3                   	ret
+
+008012ab <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8012ab:	55                   	push   %ebp
+  8012ac:	89 e5                	mov    %esp,%ebp
+  8012ae:	57                   	push   %edi
+  8012af:	56                   	push   %esi
+  8012b0:	53                   	push   %ebx
+  8012b1:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8012b4:	6a 04                	push   $0x4
+  8012b6:	ff 75 08             	push   0x8(%ebp)
+  8012b9:	e8 21 fa ff ff       	call   800cdf <touch_mem>
+	asm volatile("int %1\n"
+  8012be:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c6:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012d1:	89 f7                	mov    %esi,%edi
+  8012d3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012d5:	83 c4 08             	add    $0x8,%esp
+  8012d8:	85 c0                	test   %eax,%eax
+  8012da:	7f 08                	jg     8012e4 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8012dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012df:	5b                   	pop    %ebx
+  8012e0:	5e                   	pop    %esi
+  8012e1:	5f                   	pop    %edi
+  8012e2:	5d                   	pop    %ebp
+  8012e3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012e4:	83 ec 0c             	sub    $0xc,%esp
+  8012e7:	50                   	push   %eax
+  8012e8:	6a 16                	push   $0x16
+  8012ea:	68 4b 52 80 00       	push   $0x80524b
+  8012ef:	6a 23                	push   $0x23
+  8012f1:	68 68 52 80 00       	push   $0x805268
+  8012f6:	e8 22 ef ff ff       	call   80021d <_panic>
+
+008012fb <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8012fb:	55                   	push   %ebp
+  8012fc:	89 e5                	mov    %esp,%ebp
+  8012fe:	57                   	push   %edi
+  8012ff:	56                   	push   %esi
+  801300:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801301:	6a 04                	push   $0x4
+  801303:	ff 75 08             	push   0x8(%ebp)
+  801306:	e8 d4 f9 ff ff       	call   800cdf <touch_mem>
+	asm volatile("int %1\n"
+  80130b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801310:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801313:	b8 17 00 00 00       	mov    $0x17,%eax
+  801318:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131b:	89 df                	mov    %ebx,%edi
+  80131d:	89 de                	mov    %ebx,%esi
+  80131f:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801321:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801324:	5b                   	pop    %ebx
+  801325:	5e                   	pop    %esi
+  801326:	5f                   	pop    %edi
+  801327:	5d                   	pop    %ebp
+  801328:	c3                   	ret
+
+00801329 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  801329:	55                   	push   %ebp
+  80132a:	89 e5                	mov    %esp,%ebp
+  80132c:	57                   	push   %edi
+  80132d:	56                   	push   %esi
+  80132e:	53                   	push   %ebx
+  80132f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801332:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801337:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80133f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801344:	89 df                	mov    %ebx,%edi
+  801346:	89 de                	mov    %ebx,%esi
+  801348:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80134a:	85 c0                	test   %eax,%eax
+  80134c:	7f 08                	jg     801356 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80134e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801351:	5b                   	pop    %ebx
+  801352:	5e                   	pop    %esi
+  801353:	5f                   	pop    %edi
+  801354:	5d                   	pop    %ebp
+  801355:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801356:	83 ec 0c             	sub    $0xc,%esp
+  801359:	50                   	push   %eax
+  80135a:	6a 0e                	push   $0xe
+  80135c:	68 4b 52 80 00       	push   $0x80524b
+  801361:	6a 23                	push   $0x23
+  801363:	68 68 52 80 00       	push   $0x805268
+  801368:	e8 b0 ee ff ff       	call   80021d <_panic>
+
+0080136d <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80136d:	55                   	push   %ebp
+  80136e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801370:	8b 45 08             	mov    0x8(%ebp),%eax
+  801373:	05 00 00 00 30       	add    $0x30000000,%eax
+  801378:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80137b:	5d                   	pop    %ebp
+  80137c:	c3                   	ret
+
+0080137d <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80137d:	55                   	push   %ebp
+  80137e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801380:	8b 45 08             	mov    0x8(%ebp),%eax
+  801383:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801388:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80138d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801392:	5d                   	pop    %ebp
+  801393:	c3                   	ret
+
+00801394 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801394:	55                   	push   %ebp
+  801395:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801397:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  80139c:	a8 01                	test   $0x1,%al
+  80139e:	74 3c                	je     8013dc <fd_alloc+0x48>
+  8013a0:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013a5:	89 c2                	mov    %eax,%edx
+  8013a7:	c1 ea 0c             	shr    $0xc,%edx
+  8013aa:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013b1:	89 c1                	mov    %eax,%ecx
+  8013b3:	05 00 10 00 00       	add    $0x1000,%eax
+  8013b8:	f6 c2 01             	test   $0x1,%dl
+  8013bb:	74 13                	je     8013d0 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8013bd:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8013c2:	75 e1                	jne    8013a5 <fd_alloc+0x11>
+  8013c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8013c9:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8013ce:	eb 05                	jmp    8013d5 <fd_alloc+0x41>
+			return 0;
+  8013d0:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8013d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d8:	89 0a                	mov    %ecx,(%edx)
+}
+  8013da:	5d                   	pop    %ebp
+  8013db:	c3                   	ret
+  8013dc:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8013e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e6:	eb ed                	jmp    8013d5 <fd_alloc+0x41>
+
+008013e8 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013e8:	55                   	push   %ebp
+  8013e9:	89 e5                	mov    %esp,%ebp
+  8013eb:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8013ee:	83 f8 1f             	cmp    $0x1f,%eax
+  8013f1:	77 30                	ja     801423 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8013f3:	c1 e0 0c             	shl    $0xc,%eax
+  8013f6:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8013fb:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801401:	f6 c2 01             	test   $0x1,%dl
+  801404:	74 24                	je     80142a <fd_lookup+0x42>
+  801406:	89 c2                	mov    %eax,%edx
+  801408:	c1 ea 0c             	shr    $0xc,%edx
+  80140b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801412:	f6 c2 01             	test   $0x1,%dl
+  801415:	74 1a                	je     801431 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801417:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80141a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80141c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801421:	5d                   	pop    %ebp
+  801422:	c3                   	ret
+		return -E_INVAL;
+  801423:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801428:	eb f7                	jmp    801421 <fd_lookup+0x39>
+		return -E_INVAL;
+  80142a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80142f:	eb f0                	jmp    801421 <fd_lookup+0x39>
+  801431:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801436:	eb e9                	jmp    801421 <fd_lookup+0x39>
+
+00801438 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801438:	55                   	push   %ebp
+  801439:	89 e5                	mov    %esp,%ebp
+  80143b:	53                   	push   %ebx
+  80143c:	83 ec 04             	sub    $0x4,%esp
+  80143f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801442:	b8 f4 52 80 00       	mov    $0x8052f4,%eax
+  801447:	8b 18                	mov    (%eax),%ebx
+  801449:	85 db                	test   %ebx,%ebx
+  80144b:	74 0e                	je     80145b <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  80144d:	83 c0 04             	add    $0x4,%eax
+  801450:	39 13                	cmp    %edx,(%ebx)
+  801452:	75 f3                	jne    801447 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801454:	b8 00 00 00 00       	mov    $0x0,%eax
+  801459:	eb 1f                	jmp    80147a <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80145b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801460:	8b 40 48             	mov    0x48(%eax),%eax
+  801463:	83 ec 04             	sub    $0x4,%esp
+  801466:	52                   	push   %edx
+  801467:	50                   	push   %eax
+  801468:	68 78 52 80 00       	push   $0x805278
+  80146d:	e8 86 ee ff ff       	call   8002f8 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801472:	83 c4 10             	add    $0x10,%esp
+  801475:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80147a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80147d:	89 1a                	mov    %ebx,(%edx)
+}
+  80147f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801482:	c9                   	leave
+  801483:	c3                   	ret
+
+00801484 <fd_close>:
+{
+  801484:	55                   	push   %ebp
+  801485:	89 e5                	mov    %esp,%ebp
+  801487:	57                   	push   %edi
+  801488:	56                   	push   %esi
+  801489:	53                   	push   %ebx
+  80148a:	83 ec 24             	sub    $0x24,%esp
+  80148d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801490:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801493:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801496:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801497:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80149d:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014a0:	50                   	push   %eax
+  8014a1:	e8 42 ff ff ff       	call   8013e8 <fd_lookup>
+  8014a6:	89 c3                	mov    %eax,%ebx
+  8014a8:	83 c4 10             	add    $0x10,%esp
+  8014ab:	85 c0                	test   %eax,%eax
+  8014ad:	78 05                	js     8014b4 <fd_close+0x30>
+	    || fd != fd2)
+  8014af:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8014b2:	74 16                	je     8014ca <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8014b4:	89 f8                	mov    %edi,%eax
+  8014b6:	84 c0                	test   %al,%al
+  8014b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014bd:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014c0:	89 d8                	mov    %ebx,%eax
+  8014c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c5:	5b                   	pop    %ebx
+  8014c6:	5e                   	pop    %esi
+  8014c7:	5f                   	pop    %edi
+  8014c8:	5d                   	pop    %ebp
+  8014c9:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014ca:	83 ec 08             	sub    $0x8,%esp
+  8014cd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014d0:	50                   	push   %eax
+  8014d1:	ff 36                	push   (%esi)
+  8014d3:	e8 60 ff ff ff       	call   801438 <dev_lookup>
+  8014d8:	89 c3                	mov    %eax,%ebx
+  8014da:	83 c4 10             	add    $0x10,%esp
+  8014dd:	85 c0                	test   %eax,%eax
+  8014df:	78 1a                	js     8014fb <fd_close+0x77>
+		if (dev->dev_close)
+  8014e1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014e4:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8014e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8014ec:	85 c0                	test   %eax,%eax
+  8014ee:	74 0b                	je     8014fb <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8014f0:	83 ec 0c             	sub    $0xc,%esp
+  8014f3:	56                   	push   %esi
+  8014f4:	ff d0                	call   *%eax
+  8014f6:	89 c3                	mov    %eax,%ebx
+  8014f8:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8014fb:	83 ec 08             	sub    $0x8,%esp
+  8014fe:	56                   	push   %esi
+  8014ff:	6a 00                	push   $0x0
+  801501:	e8 51 f9 ff ff       	call   800e57 <sys_page_unmap>
+	return r;
+  801506:	83 c4 10             	add    $0x10,%esp
+  801509:	eb b5                	jmp    8014c0 <fd_close+0x3c>
+
+0080150b <close>:
+
+int
+close(int fdnum)
+{
+  80150b:	55                   	push   %ebp
+  80150c:	89 e5                	mov    %esp,%ebp
+  80150e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801511:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801514:	50                   	push   %eax
+  801515:	ff 75 08             	push   0x8(%ebp)
+  801518:	e8 cb fe ff ff       	call   8013e8 <fd_lookup>
+  80151d:	83 c4 10             	add    $0x10,%esp
+  801520:	85 c0                	test   %eax,%eax
+  801522:	79 02                	jns    801526 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801524:	c9                   	leave
+  801525:	c3                   	ret
+		return fd_close(fd, 1);
+  801526:	83 ec 08             	sub    $0x8,%esp
+  801529:	6a 01                	push   $0x1
+  80152b:	ff 75 f4             	push   -0xc(%ebp)
+  80152e:	e8 51 ff ff ff       	call   801484 <fd_close>
+  801533:	83 c4 10             	add    $0x10,%esp
+  801536:	eb ec                	jmp    801524 <close+0x19>
+
+00801538 <close_all>:
+
+void
+close_all(void)
+{
+  801538:	55                   	push   %ebp
+  801539:	89 e5                	mov    %esp,%ebp
+  80153b:	53                   	push   %ebx
+  80153c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80153f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801544:	83 ec 0c             	sub    $0xc,%esp
+  801547:	53                   	push   %ebx
+  801548:	e8 be ff ff ff       	call   80150b <close>
+	for (i = 0; i < MAXFD; i++)
+  80154d:	83 c3 01             	add    $0x1,%ebx
+  801550:	83 c4 10             	add    $0x10,%esp
+  801553:	83 fb 20             	cmp    $0x20,%ebx
+  801556:	75 ec                	jne    801544 <close_all+0xc>
+}
+  801558:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80155b:	c9                   	leave
+  80155c:	c3                   	ret
+
+0080155d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80155d:	55                   	push   %ebp
+  80155e:	89 e5                	mov    %esp,%ebp
+  801560:	57                   	push   %edi
+  801561:	56                   	push   %esi
+  801562:	53                   	push   %ebx
+  801563:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801566:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801569:	50                   	push   %eax
+  80156a:	ff 75 08             	push   0x8(%ebp)
+  80156d:	e8 76 fe ff ff       	call   8013e8 <fd_lookup>
+  801572:	89 c3                	mov    %eax,%ebx
+  801574:	83 c4 10             	add    $0x10,%esp
+  801577:	85 c0                	test   %eax,%eax
+  801579:	78 7f                	js     8015fa <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80157b:	83 ec 0c             	sub    $0xc,%esp
+  80157e:	ff 75 0c             	push   0xc(%ebp)
+  801581:	e8 85 ff ff ff       	call   80150b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801586:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801589:	c1 e6 0c             	shl    $0xc,%esi
+  80158c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801592:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801595:	89 3c 24             	mov    %edi,(%esp)
+  801598:	e8 e0 fd ff ff       	call   80137d <fd2data>
+  80159d:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80159f:	89 34 24             	mov    %esi,(%esp)
+  8015a2:	e8 d6 fd ff ff       	call   80137d <fd2data>
+  8015a7:	83 c4 10             	add    $0x10,%esp
+  8015aa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8015ad:	89 d8                	mov    %ebx,%eax
+  8015af:	c1 e8 16             	shr    $0x16,%eax
+  8015b2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015b9:	a8 01                	test   $0x1,%al
+  8015bb:	74 11                	je     8015ce <dup+0x71>
+  8015bd:	89 d8                	mov    %ebx,%eax
+  8015bf:	c1 e8 0c             	shr    $0xc,%eax
+  8015c2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015c9:	f6 c2 01             	test   $0x1,%dl
+  8015cc:	75 36                	jne    801604 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015ce:	89 f8                	mov    %edi,%eax
+  8015d0:	c1 e8 0c             	shr    $0xc,%eax
+  8015d3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015da:	83 ec 0c             	sub    $0xc,%esp
+  8015dd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015e2:	50                   	push   %eax
+  8015e3:	56                   	push   %esi
+  8015e4:	6a 00                	push   $0x0
+  8015e6:	57                   	push   %edi
+  8015e7:	6a 00                	push   $0x0
+  8015e9:	e8 27 f8 ff ff       	call   800e15 <sys_page_map>
+  8015ee:	89 c3                	mov    %eax,%ebx
+  8015f0:	83 c4 20             	add    $0x20,%esp
+  8015f3:	85 c0                	test   %eax,%eax
+  8015f5:	78 33                	js     80162a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8015f7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8015fa:	89 d8                	mov    %ebx,%eax
+  8015fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ff:	5b                   	pop    %ebx
+  801600:	5e                   	pop    %esi
+  801601:	5f                   	pop    %edi
+  801602:	5d                   	pop    %ebp
+  801603:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801604:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80160b:	83 ec 0c             	sub    $0xc,%esp
+  80160e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801613:	50                   	push   %eax
+  801614:	ff 75 d4             	push   -0x2c(%ebp)
+  801617:	6a 00                	push   $0x0
+  801619:	53                   	push   %ebx
+  80161a:	6a 00                	push   $0x0
+  80161c:	e8 f4 f7 ff ff       	call   800e15 <sys_page_map>
+  801621:	89 c3                	mov    %eax,%ebx
+  801623:	83 c4 20             	add    $0x20,%esp
+  801626:	85 c0                	test   %eax,%eax
+  801628:	79 a4                	jns    8015ce <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80162a:	83 ec 08             	sub    $0x8,%esp
+  80162d:	56                   	push   %esi
+  80162e:	6a 00                	push   $0x0
+  801630:	e8 22 f8 ff ff       	call   800e57 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801635:	83 c4 08             	add    $0x8,%esp
+  801638:	ff 75 d4             	push   -0x2c(%ebp)
+  80163b:	6a 00                	push   $0x0
+  80163d:	e8 15 f8 ff ff       	call   800e57 <sys_page_unmap>
+	return r;
+  801642:	83 c4 10             	add    $0x10,%esp
+  801645:	eb b3                	jmp    8015fa <dup+0x9d>
+
+00801647 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801647:	55                   	push   %ebp
+  801648:	89 e5                	mov    %esp,%ebp
+  80164a:	56                   	push   %esi
+  80164b:	53                   	push   %ebx
+  80164c:	83 ec 18             	sub    $0x18,%esp
+  80164f:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801652:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801655:	50                   	push   %eax
+  801656:	56                   	push   %esi
+  801657:	e8 8c fd ff ff       	call   8013e8 <fd_lookup>
+  80165c:	83 c4 10             	add    $0x10,%esp
+  80165f:	85 c0                	test   %eax,%eax
+  801661:	78 3c                	js     80169f <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801663:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801666:	83 ec 08             	sub    $0x8,%esp
+  801669:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80166c:	50                   	push   %eax
+  80166d:	ff 33                	push   (%ebx)
+  80166f:	e8 c4 fd ff ff       	call   801438 <dev_lookup>
+  801674:	83 c4 10             	add    $0x10,%esp
+  801677:	85 c0                	test   %eax,%eax
+  801679:	78 24                	js     80169f <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80167b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80167e:	83 e0 03             	and    $0x3,%eax
+  801681:	83 f8 01             	cmp    $0x1,%eax
+  801684:	74 20                	je     8016a6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801686:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801689:	8b 40 08             	mov    0x8(%eax),%eax
+  80168c:	85 c0                	test   %eax,%eax
+  80168e:	74 37                	je     8016c7 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801690:	83 ec 04             	sub    $0x4,%esp
+  801693:	ff 75 10             	push   0x10(%ebp)
+  801696:	ff 75 0c             	push   0xc(%ebp)
+  801699:	53                   	push   %ebx
+  80169a:	ff d0                	call   *%eax
+  80169c:	83 c4 10             	add    $0x10,%esp
+}
+  80169f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016a2:	5b                   	pop    %ebx
+  8016a3:	5e                   	pop    %esi
+  8016a4:	5d                   	pop    %ebp
+  8016a5:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016a6:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8016ab:	8b 40 48             	mov    0x48(%eax),%eax
+  8016ae:	83 ec 04             	sub    $0x4,%esp
+  8016b1:	56                   	push   %esi
+  8016b2:	50                   	push   %eax
+  8016b3:	68 b9 52 80 00       	push   $0x8052b9
+  8016b8:	e8 3b ec ff ff       	call   8002f8 <cprintf>
+		return -E_INVAL;
+  8016bd:	83 c4 10             	add    $0x10,%esp
+  8016c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016c5:	eb d8                	jmp    80169f <read+0x58>
+		return -E_NOT_SUPP;
+  8016c7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016cc:	eb d1                	jmp    80169f <read+0x58>
+
+008016ce <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016ce:	55                   	push   %ebp
+  8016cf:	89 e5                	mov    %esp,%ebp
+  8016d1:	57                   	push   %edi
+  8016d2:	56                   	push   %esi
+  8016d3:	53                   	push   %ebx
+  8016d4:	83 ec 0c             	sub    $0xc,%esp
+  8016d7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016da:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e2:	eb 02                	jmp    8016e6 <readn+0x18>
+  8016e4:	01 c3                	add    %eax,%ebx
+  8016e6:	39 f3                	cmp    %esi,%ebx
+  8016e8:	73 21                	jae    80170b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016ea:	83 ec 04             	sub    $0x4,%esp
+  8016ed:	89 f0                	mov    %esi,%eax
+  8016ef:	29 d8                	sub    %ebx,%eax
+  8016f1:	50                   	push   %eax
+  8016f2:	89 d8                	mov    %ebx,%eax
+  8016f4:	03 45 0c             	add    0xc(%ebp),%eax
+  8016f7:	50                   	push   %eax
+  8016f8:	57                   	push   %edi
+  8016f9:	e8 49 ff ff ff       	call   801647 <read>
+		if (m < 0)
+  8016fe:	83 c4 10             	add    $0x10,%esp
+  801701:	85 c0                	test   %eax,%eax
+  801703:	78 04                	js     801709 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801705:	75 dd                	jne    8016e4 <readn+0x16>
+  801707:	eb 02                	jmp    80170b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801709:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80170b:	89 d8                	mov    %ebx,%eax
+  80170d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801710:	5b                   	pop    %ebx
+  801711:	5e                   	pop    %esi
+  801712:	5f                   	pop    %edi
+  801713:	5d                   	pop    %ebp
+  801714:	c3                   	ret
+
+00801715 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801715:	55                   	push   %ebp
+  801716:	89 e5                	mov    %esp,%ebp
+  801718:	56                   	push   %esi
+  801719:	53                   	push   %ebx
+  80171a:	83 ec 18             	sub    $0x18,%esp
+  80171d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801720:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801723:	50                   	push   %eax
+  801724:	53                   	push   %ebx
+  801725:	e8 be fc ff ff       	call   8013e8 <fd_lookup>
+  80172a:	83 c4 10             	add    $0x10,%esp
+  80172d:	85 c0                	test   %eax,%eax
+  80172f:	78 37                	js     801768 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801731:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801734:	83 ec 08             	sub    $0x8,%esp
+  801737:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80173a:	50                   	push   %eax
+  80173b:	ff 36                	push   (%esi)
+  80173d:	e8 f6 fc ff ff       	call   801438 <dev_lookup>
+  801742:	83 c4 10             	add    $0x10,%esp
+  801745:	85 c0                	test   %eax,%eax
+  801747:	78 1f                	js     801768 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801749:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80174d:	74 20                	je     80176f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80174f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801752:	8b 40 0c             	mov    0xc(%eax),%eax
+  801755:	85 c0                	test   %eax,%eax
+  801757:	74 37                	je     801790 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801759:	83 ec 04             	sub    $0x4,%esp
+  80175c:	ff 75 10             	push   0x10(%ebp)
+  80175f:	ff 75 0c             	push   0xc(%ebp)
+  801762:	56                   	push   %esi
+  801763:	ff d0                	call   *%eax
+  801765:	83 c4 10             	add    $0x10,%esp
+}
+  801768:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80176b:	5b                   	pop    %ebx
+  80176c:	5e                   	pop    %esi
+  80176d:	5d                   	pop    %ebp
+  80176e:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80176f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801774:	8b 40 48             	mov    0x48(%eax),%eax
+  801777:	83 ec 04             	sub    $0x4,%esp
+  80177a:	53                   	push   %ebx
+  80177b:	50                   	push   %eax
+  80177c:	68 d5 52 80 00       	push   $0x8052d5
+  801781:	e8 72 eb ff ff       	call   8002f8 <cprintf>
+		return -E_INVAL;
+  801786:	83 c4 10             	add    $0x10,%esp
+  801789:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80178e:	eb d8                	jmp    801768 <write+0x53>
+		return -E_NOT_SUPP;
+  801790:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801795:	eb d1                	jmp    801768 <write+0x53>
+
+00801797 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801797:	55                   	push   %ebp
+  801798:	89 e5                	mov    %esp,%ebp
+  80179a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80179d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017a0:	50                   	push   %eax
+  8017a1:	ff 75 08             	push   0x8(%ebp)
+  8017a4:	e8 3f fc ff ff       	call   8013e8 <fd_lookup>
+  8017a9:	83 c4 10             	add    $0x10,%esp
+  8017ac:	85 c0                	test   %eax,%eax
+  8017ae:	78 0e                	js     8017be <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8017b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017b6:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8017b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017be:	c9                   	leave
+  8017bf:	c3                   	ret
+
+008017c0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017c0:	55                   	push   %ebp
+  8017c1:	89 e5                	mov    %esp,%ebp
+  8017c3:	56                   	push   %esi
+  8017c4:	53                   	push   %ebx
+  8017c5:	83 ec 18             	sub    $0x18,%esp
+  8017c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017cb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017ce:	50                   	push   %eax
+  8017cf:	53                   	push   %ebx
+  8017d0:	e8 13 fc ff ff       	call   8013e8 <fd_lookup>
+  8017d5:	83 c4 10             	add    $0x10,%esp
+  8017d8:	85 c0                	test   %eax,%eax
+  8017da:	78 34                	js     801810 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017dc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017df:	83 ec 08             	sub    $0x8,%esp
+  8017e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017e5:	50                   	push   %eax
+  8017e6:	ff 36                	push   (%esi)
+  8017e8:	e8 4b fc ff ff       	call   801438 <dev_lookup>
+  8017ed:	83 c4 10             	add    $0x10,%esp
+  8017f0:	85 c0                	test   %eax,%eax
+  8017f2:	78 1c                	js     801810 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017f4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017f8:	74 1d                	je     801817 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8017fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017fd:	8b 40 18             	mov    0x18(%eax),%eax
+  801800:	85 c0                	test   %eax,%eax
+  801802:	74 34                	je     801838 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801804:	83 ec 08             	sub    $0x8,%esp
+  801807:	ff 75 0c             	push   0xc(%ebp)
+  80180a:	56                   	push   %esi
+  80180b:	ff d0                	call   *%eax
+  80180d:	83 c4 10             	add    $0x10,%esp
+}
+  801810:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801813:	5b                   	pop    %ebx
+  801814:	5e                   	pop    %esi
+  801815:	5d                   	pop    %ebp
+  801816:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801817:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80181c:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80181f:	83 ec 04             	sub    $0x4,%esp
+  801822:	53                   	push   %ebx
+  801823:	50                   	push   %eax
+  801824:	68 98 52 80 00       	push   $0x805298
+  801829:	e8 ca ea ff ff       	call   8002f8 <cprintf>
+		return -E_INVAL;
+  80182e:	83 c4 10             	add    $0x10,%esp
+  801831:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801836:	eb d8                	jmp    801810 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801838:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80183d:	eb d1                	jmp    801810 <ftruncate+0x50>
+
+0080183f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80183f:	55                   	push   %ebp
+  801840:	89 e5                	mov    %esp,%ebp
+  801842:	56                   	push   %esi
+  801843:	53                   	push   %ebx
+  801844:	83 ec 18             	sub    $0x18,%esp
+  801847:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80184a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80184d:	50                   	push   %eax
+  80184e:	ff 75 08             	push   0x8(%ebp)
+  801851:	e8 92 fb ff ff       	call   8013e8 <fd_lookup>
+  801856:	83 c4 10             	add    $0x10,%esp
+  801859:	85 c0                	test   %eax,%eax
+  80185b:	78 49                	js     8018a6 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80185d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801860:	83 ec 08             	sub    $0x8,%esp
+  801863:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801866:	50                   	push   %eax
+  801867:	ff 36                	push   (%esi)
+  801869:	e8 ca fb ff ff       	call   801438 <dev_lookup>
+  80186e:	83 c4 10             	add    $0x10,%esp
+  801871:	85 c0                	test   %eax,%eax
+  801873:	78 31                	js     8018a6 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801875:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801878:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80187c:	74 2f                	je     8018ad <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80187e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801881:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801888:	00 00 00 
+	stat->st_isdir = 0;
+  80188b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801892:	00 00 00 
+	stat->st_dev = dev;
+  801895:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80189b:	83 ec 08             	sub    $0x8,%esp
+  80189e:	53                   	push   %ebx
+  80189f:	56                   	push   %esi
+  8018a0:	ff 50 14             	call   *0x14(%eax)
+  8018a3:	83 c4 10             	add    $0x10,%esp
+}
+  8018a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018a9:	5b                   	pop    %ebx
+  8018aa:	5e                   	pop    %esi
+  8018ab:	5d                   	pop    %ebp
+  8018ac:	c3                   	ret
+		return -E_NOT_SUPP;
+  8018ad:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018b2:	eb f2                	jmp    8018a6 <fstat+0x67>
+
+008018b4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018b4:	55                   	push   %ebp
+  8018b5:	89 e5                	mov    %esp,%ebp
+  8018b7:	56                   	push   %esi
+  8018b8:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8018b9:	83 ec 08             	sub    $0x8,%esp
+  8018bc:	6a 00                	push   $0x0
+  8018be:	ff 75 08             	push   0x8(%ebp)
+  8018c1:	e8 bc 02 00 00       	call   801b82 <open>
+  8018c6:	89 c3                	mov    %eax,%ebx
+  8018c8:	83 c4 10             	add    $0x10,%esp
+  8018cb:	85 c0                	test   %eax,%eax
+  8018cd:	78 1b                	js     8018ea <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8018cf:	83 ec 08             	sub    $0x8,%esp
+  8018d2:	ff 75 0c             	push   0xc(%ebp)
+  8018d5:	50                   	push   %eax
+  8018d6:	e8 64 ff ff ff       	call   80183f <fstat>
+  8018db:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8018dd:	89 1c 24             	mov    %ebx,(%esp)
+  8018e0:	e8 26 fc ff ff       	call   80150b <close>
+	return r;
+  8018e5:	83 c4 10             	add    $0x10,%esp
+  8018e8:	89 f3                	mov    %esi,%ebx
+}
+  8018ea:	89 d8                	mov    %ebx,%eax
+  8018ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018ef:	5b                   	pop    %ebx
+  8018f0:	5e                   	pop    %esi
+  8018f1:	5d                   	pop    %ebp
+  8018f2:	c3                   	ret
+
+008018f3 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  8018f3:	55                   	push   %ebp
+  8018f4:	89 e5                	mov    %esp,%ebp
+  8018f6:	57                   	push   %edi
+  8018f7:	56                   	push   %esi
+  8018f8:	53                   	push   %ebx
+  8018f9:	83 ec 0c             	sub    $0xc,%esp
+  8018fc:	89 c7                	mov    %eax,%edi
+  8018fe:	89 d3                	mov    %edx,%ebx
+  801900:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801902:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801909:	74 2d                	je     801938 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80190b:	6a 07                	push   $0x7
+  80190d:	68 00 f0 80 00       	push   $0x80f000
+  801912:	57                   	push   %edi
+  801913:	ff 35 00 70 80 00    	push   0x807000
+  801919:	e8 4e 31 00 00       	call   804a6c <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  80191e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801925:	6a 00                	push   $0x0
+  801927:	56                   	push   %esi
+  801928:	53                   	push   %ebx
+  801929:	6a 00                	push   $0x0
+  80192b:	e8 ee 2f 00 00       	call   80491e <ipc_recv_pages>
+}
+  801930:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801933:	5b                   	pop    %ebx
+  801934:	5e                   	pop    %esi
+  801935:	5f                   	pop    %edi
+  801936:	5d                   	pop    %ebp
+  801937:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801938:	83 ec 0c             	sub    $0xc,%esp
+  80193b:	6a 01                	push   $0x1
+  80193d:	e8 1f 32 00 00       	call   804b61 <ipc_find_env>
+  801942:	a3 00 70 80 00       	mov    %eax,0x807000
+  801947:	83 c4 10             	add    $0x10,%esp
+  80194a:	eb bf                	jmp    80190b <fsipc_pages+0x18>
+
+0080194c <fsipc>:
+{
+  80194c:	55                   	push   %ebp
+  80194d:	89 e5                	mov    %esp,%ebp
+  80194f:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801952:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801957:	e8 97 ff ff ff       	call   8018f3 <fsipc_pages>
+}
+  80195c:	c9                   	leave
+  80195d:	c3                   	ret
+
+0080195e <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80195e:	55                   	push   %ebp
+  80195f:	89 e5                	mov    %esp,%ebp
+  801961:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801964:	8b 45 08             	mov    0x8(%ebp),%eax
+  801967:	8b 40 0c             	mov    0xc(%eax),%eax
+  80196a:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  80196f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801972:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801977:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801981:	e8 c6 ff ff ff       	call   80194c <fsipc>
+}
+  801986:	c9                   	leave
+  801987:	c3                   	ret
+
+00801988 <devfile_flush>:
+{
+  801988:	55                   	push   %ebp
+  801989:	89 e5                	mov    %esp,%ebp
+  80198b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80198e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801991:	8b 40 0c             	mov    0xc(%eax),%eax
+  801994:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801999:	ba 00 00 00 00       	mov    $0x0,%edx
+  80199e:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019a3:	e8 a4 ff ff ff       	call   80194c <fsipc>
+}
+  8019a8:	c9                   	leave
+  8019a9:	c3                   	ret
+
+008019aa <devfile_stat>:
+{
+  8019aa:	55                   	push   %ebp
+  8019ab:	89 e5                	mov    %esp,%ebp
+  8019ad:	53                   	push   %ebx
+  8019ae:	83 ec 04             	sub    $0x4,%esp
+  8019b1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019ba:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019c4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019c9:	e8 7e ff ff ff       	call   80194c <fsipc>
+  8019ce:	85 c0                	test   %eax,%eax
+  8019d0:	78 2c                	js     8019fe <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019d2:	83 ec 08             	sub    $0x8,%esp
+  8019d5:	68 00 f0 80 00       	push   $0x80f000
+  8019da:	53                   	push   %ebx
+  8019db:	e8 ff ee ff ff       	call   8008df <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8019e0:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  8019e5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019eb:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  8019f0:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8019f6:	83 c4 10             	add    $0x10,%esp
+  8019f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a01:	c9                   	leave
+  801a02:	c3                   	ret
+
+00801a03 <devfile_write>:
+{
+  801a03:	55                   	push   %ebp
+  801a04:	89 e5                	mov    %esp,%ebp
+  801a06:	83 ec 0c             	sub    $0xc,%esp
+  801a09:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801a0c:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a11:	39 d0                	cmp    %edx,%eax
+  801a13:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a16:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a19:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a1c:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  801a22:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801a27:	50                   	push   %eax
+  801a28:	ff 75 0c             	push   0xc(%ebp)
+  801a2b:	68 08 f0 80 00       	push   $0x80f008
+  801a30:	e8 30 f0 ff ff       	call   800a65 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801a35:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a3a:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a3f:	e8 08 ff ff ff       	call   80194c <fsipc>
+}
+  801a44:	c9                   	leave
+  801a45:	c3                   	ret
+
+00801a46 <devfile_read>:
+{
+  801a46:	55                   	push   %ebp
+  801a47:	89 e5                	mov    %esp,%ebp
+  801a49:	57                   	push   %edi
+  801a4a:	56                   	push   %esi
+  801a4b:	53                   	push   %ebx
+  801a4c:	83 ec 1c             	sub    $0x1c,%esp
+  801a4f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a52:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a55:	89 fe                	mov    %edi,%esi
+  801a57:	c1 ee 0c             	shr    $0xc,%esi
+  801a5a:	b8 20 00 00 00       	mov    $0x20,%eax
+  801a5f:	39 c6                	cmp    %eax,%esi
+  801a61:	0f 47 f0             	cmova  %eax,%esi
+  801a64:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a6c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801a6f:	eb 14                	jmp    801a85 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a71:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801a78:	05 00 10 00 00       	add    $0x1000,%eax
+  801a7d:	f6 c6 06             	test   $0x6,%dh
+  801a80:	75 42                	jne    801ac4 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a82:	83 c1 01             	add    $0x1,%ecx
+  801a85:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801a88:	39 f1                	cmp    %esi,%ecx
+  801a8a:	0f 84 95 00 00 00    	je     801b25 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801a90:	89 c2                	mov    %eax,%edx
+  801a92:	c1 ea 16             	shr    $0x16,%edx
+  801a95:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a9c:	f6 c2 01             	test   $0x1,%dl
+  801a9f:	74 23                	je     801ac4 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801aa1:	89 c2                	mov    %eax,%edx
+  801aa3:	c1 ea 0c             	shr    $0xc,%edx
+  801aa6:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801aad:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801ab3:	74 0f                	je     801ac4 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801ab5:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801abc:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801ac2:	75 ad                	jne    801a71 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801ac4:	85 c9                	test   %ecx,%ecx
+  801ac6:	74 11                	je     801ad9 <devfile_read+0x93>
+  801ac8:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801acf:	75 08                	jne    801ad9 <devfile_read+0x93>
+  801ad1:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801ad7:	74 50                	je     801b29 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ad9:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801adc:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  801ae1:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ae7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aec:	b8 03 00 00 00       	mov    $0x3,%eax
+  801af1:	e8 56 fe ff ff       	call   80194c <fsipc>
+  801af6:	89 c6                	mov    %eax,%esi
+  801af8:	85 c0                	test   %eax,%eax
+  801afa:	78 1f                	js     801b1b <devfile_read+0xd5>
+	assert(r <= n);
+  801afc:	39 c7                	cmp    %eax,%edi
+  801afe:	72 50                	jb     801b50 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801b00:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b05:	7f 62                	jg     801b69 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801b07:	83 ec 04             	sub    $0x4,%esp
+  801b0a:	50                   	push   %eax
+  801b0b:	68 00 f0 80 00       	push   $0x80f000
+  801b10:	ff 75 0c             	push   0xc(%ebp)
+  801b13:	e8 4d ef ff ff       	call   800a65 <memmove>
+	return r;
+  801b18:	83 c4 10             	add    $0x10,%esp
+}
+  801b1b:	89 f0                	mov    %esi,%eax
+  801b1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b20:	5b                   	pop    %ebx
+  801b21:	5e                   	pop    %esi
+  801b22:	5f                   	pop    %edi
+  801b23:	5d                   	pop    %ebp
+  801b24:	c3                   	ret
+  801b25:	89 f1                	mov    %esi,%ecx
+  801b27:	eb 9b                	jmp    801ac4 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801b29:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b2c:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801b31:	89 c8                	mov    %ecx,%eax
+  801b33:	c1 e0 0c             	shl    $0xc,%eax
+  801b36:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801b3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b3e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801b43:	e8 ab fd ff ff       	call   8018f3 <fsipc_pages>
+  801b48:	89 c6                	mov    %eax,%esi
+  801b4a:	85 c0                	test   %eax,%eax
+  801b4c:	78 8b                	js     801ad9 <devfile_read+0x93>
+  801b4e:	eb cb                	jmp    801b1b <devfile_read+0xd5>
+	assert(r <= n);
+  801b50:	68 04 53 80 00       	push   $0x805304
+  801b55:	68 05 4e 80 00       	push   $0x804e05
+  801b5a:	68 a0 00 00 00       	push   $0xa0
+  801b5f:	68 0b 53 80 00       	push   $0x80530b
+  801b64:	e8 b4 e6 ff ff       	call   80021d <_panic>
+	assert(r <= PGSIZE);
+  801b69:	68 16 53 80 00       	push   $0x805316
+  801b6e:	68 05 4e 80 00       	push   $0x804e05
+  801b73:	68 a1 00 00 00       	push   $0xa1
+  801b78:	68 0b 53 80 00       	push   $0x80530b
+  801b7d:	e8 9b e6 ff ff       	call   80021d <_panic>
+
+00801b82 <open>:
+{
+  801b82:	55                   	push   %ebp
+  801b83:	89 e5                	mov    %esp,%ebp
+  801b85:	56                   	push   %esi
+  801b86:	53                   	push   %ebx
+  801b87:	83 ec 1c             	sub    $0x1c,%esp
+  801b8a:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801b8d:	56                   	push   %esi
+  801b8e:	e8 11 ed ff ff       	call   8008a4 <strlen>
+  801b93:	83 c4 10             	add    $0x10,%esp
+  801b96:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b9b:	7f 6c                	jg     801c09 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801b9d:	83 ec 0c             	sub    $0xc,%esp
+  801ba0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ba3:	50                   	push   %eax
+  801ba4:	e8 eb f7 ff ff       	call   801394 <fd_alloc>
+  801ba9:	89 c3                	mov    %eax,%ebx
+  801bab:	83 c4 10             	add    $0x10,%esp
+  801bae:	85 c0                	test   %eax,%eax
+  801bb0:	78 3c                	js     801bee <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801bb2:	83 ec 08             	sub    $0x8,%esp
+  801bb5:	56                   	push   %esi
+  801bb6:	68 00 f0 80 00       	push   $0x80f000
+  801bbb:	e8 1f ed ff ff       	call   8008df <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801bc0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bc3:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bc8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801bcb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bd0:	e8 77 fd ff ff       	call   80194c <fsipc>
+  801bd5:	89 c3                	mov    %eax,%ebx
+  801bd7:	83 c4 10             	add    $0x10,%esp
+  801bda:	85 c0                	test   %eax,%eax
+  801bdc:	78 19                	js     801bf7 <open+0x75>
+	return fd2num(fd);
+  801bde:	83 ec 0c             	sub    $0xc,%esp
+  801be1:	ff 75 f4             	push   -0xc(%ebp)
+  801be4:	e8 84 f7 ff ff       	call   80136d <fd2num>
+  801be9:	89 c3                	mov    %eax,%ebx
+  801beb:	83 c4 10             	add    $0x10,%esp
+}
+  801bee:	89 d8                	mov    %ebx,%eax
+  801bf0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bf3:	5b                   	pop    %ebx
+  801bf4:	5e                   	pop    %esi
+  801bf5:	5d                   	pop    %ebp
+  801bf6:	c3                   	ret
+		fd_close(fd, 0);
+  801bf7:	83 ec 08             	sub    $0x8,%esp
+  801bfa:	6a 00                	push   $0x0
+  801bfc:	ff 75 f4             	push   -0xc(%ebp)
+  801bff:	e8 80 f8 ff ff       	call   801484 <fd_close>
+		return r;
+  801c04:	83 c4 10             	add    $0x10,%esp
+  801c07:	eb e5                	jmp    801bee <open+0x6c>
+		return -E_BAD_PATH;
+  801c09:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c0e:	eb de                	jmp    801bee <open+0x6c>
+
+00801c10 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801c10:	55                   	push   %ebp
+  801c11:	89 e5                	mov    %esp,%ebp
+  801c13:	53                   	push   %ebx
+  801c14:	83 ec 10             	sub    $0x10,%esp
+  801c17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801c1a:	53                   	push   %ebx
+  801c1b:	e8 84 ec ff ff       	call   8008a4 <strlen>
+  801c20:	83 c4 10             	add    $0x10,%esp
+  801c23:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c28:	7f 25                	jg     801c4f <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801c2a:	83 ec 08             	sub    $0x8,%esp
+  801c2d:	53                   	push   %ebx
+  801c2e:	68 00 f0 80 00       	push   $0x80f000
+  801c33:	e8 a7 ec ff ff       	call   8008df <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801c38:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c3d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c42:	e8 05 fd ff ff       	call   80194c <fsipc>
+  801c47:	83 c4 10             	add    $0x10,%esp
+}
+  801c4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c4d:	c9                   	leave
+  801c4e:	c3                   	ret
+		return -E_BAD_PATH;
+  801c4f:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801c54:	eb f4                	jmp    801c4a <remove+0x3a>
+
+00801c56 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c56:	55                   	push   %ebp
+  801c57:	89 e5                	mov    %esp,%ebp
+  801c59:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c61:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c66:	e8 e1 fc ff ff       	call   80194c <fsipc>
+}
+  801c6b:	c9                   	leave
+  801c6c:	c3                   	ret
+
+00801c6d <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801c6d:	55                   	push   %ebp
+  801c6e:	89 e5                	mov    %esp,%ebp
+  801c70:	53                   	push   %ebx
+  801c71:	83 ec 04             	sub    $0x4,%esp
+  801c74:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801c77:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c7c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c81:	e8 c6 fc ff ff       	call   80194c <fsipc>
+  801c86:	85 c0                	test   %eax,%eax
+  801c88:	78 3c                	js     801cc6 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801c8a:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  801c8f:	89 03                	mov    %eax,(%ebx)
+  801c91:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  801c96:	89 43 04             	mov    %eax,0x4(%ebx)
+  801c99:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  801c9e:	89 43 08             	mov    %eax,0x8(%ebx)
+  801ca1:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  801ca6:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801ca9:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  801cae:	89 43 10             	mov    %eax,0x10(%ebx)
+  801cb1:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  801cb6:	89 43 14             	mov    %eax,0x14(%ebx)
+  801cb9:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  801cbe:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801cc1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cc6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cc9:	c9                   	leave
+  801cca:	c3                   	ret
+
+00801ccb <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801ccb:	55                   	push   %ebp
+  801ccc:	89 e5                	mov    %esp,%ebp
+  801cce:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801cd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cd4:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  801cd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cde:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801ce3:	e8 64 fc ff ff       	call   80194c <fsipc>
+}
+  801ce8:	c9                   	leave
+  801ce9:	c3                   	ret
+
+00801cea <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801cea:	55                   	push   %ebp
+  801ceb:	89 e5                	mov    %esp,%ebp
+  801ced:	56                   	push   %esi
+  801cee:	53                   	push   %ebx
+  801cef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801cf2:	83 ec 0c             	sub    $0xc,%esp
+  801cf5:	ff 75 08             	push   0x8(%ebp)
+  801cf8:	e8 80 f6 ff ff       	call   80137d <fd2data>
+  801cfd:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801cff:	83 c4 08             	add    $0x8,%esp
+  801d02:	68 22 53 80 00       	push   $0x805322
+  801d07:	53                   	push   %ebx
+  801d08:	e8 d2 eb ff ff       	call   8008df <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801d0d:	8b 46 04             	mov    0x4(%esi),%eax
+  801d10:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801d16:	2b 0e                	sub    (%esi),%ecx
+  801d18:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801d1d:	89 c8                	mov    %ecx,%eax
+  801d1f:	f7 e2                	mul    %edx
+  801d21:	c1 ea 0c             	shr    $0xc,%edx
+  801d24:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801d2a:	29 d1                	sub    %edx,%ecx
+  801d2c:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801d32:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d39:	00 00 00 
+	stat->st_dev = &devpipe;
+  801d3c:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  801d43:	60 80 00 
+	return 0;
+}
+  801d46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d4e:	5b                   	pop    %ebx
+  801d4f:	5e                   	pop    %esi
+  801d50:	5d                   	pop    %ebp
+  801d51:	c3                   	ret
+
+00801d52 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801d52:	55                   	push   %ebp
+  801d53:	89 e5                	mov    %esp,%ebp
+  801d55:	53                   	push   %ebx
+  801d56:	83 ec 0c             	sub    $0xc,%esp
+  801d59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801d5c:	53                   	push   %ebx
+  801d5d:	6a 00                	push   $0x0
+  801d5f:	e8 f3 f0 ff ff       	call   800e57 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801d64:	89 1c 24             	mov    %ebx,(%esp)
+  801d67:	e8 11 f6 ff ff       	call   80137d <fd2data>
+  801d6c:	83 c4 08             	add    $0x8,%esp
+  801d6f:	50                   	push   %eax
+  801d70:	6a 00                	push   $0x0
+  801d72:	e8 e0 f0 ff ff       	call   800e57 <sys_page_unmap>
+}
+  801d77:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d7a:	c9                   	leave
+  801d7b:	c3                   	ret
+
+00801d7c <_pipeisclosed>:
+{
+  801d7c:	55                   	push   %ebp
+  801d7d:	89 e5                	mov    %esp,%ebp
+  801d7f:	57                   	push   %edi
+  801d80:	56                   	push   %esi
+  801d81:	53                   	push   %ebx
+  801d82:	83 ec 1c             	sub    $0x1c,%esp
+  801d85:	89 c7                	mov    %eax,%edi
+  801d87:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801d89:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801d8e:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801d91:	83 ec 0c             	sub    $0xc,%esp
+  801d94:	57                   	push   %edi
+  801d95:	e8 06 2e 00 00       	call   804ba0 <pageref>
+  801d9a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d9d:	89 34 24             	mov    %esi,(%esp)
+  801da0:	e8 fb 2d 00 00       	call   804ba0 <pageref>
+		nn = thisenv->env_runs;
+  801da5:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  801dab:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801dae:	83 c4 10             	add    $0x10,%esp
+  801db1:	39 cb                	cmp    %ecx,%ebx
+  801db3:	74 1b                	je     801dd0 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801db5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801db8:	75 cf                	jne    801d89 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801dba:	8b 42 58             	mov    0x58(%edx),%eax
+  801dbd:	6a 01                	push   $0x1
+  801dbf:	50                   	push   %eax
+  801dc0:	53                   	push   %ebx
+  801dc1:	68 29 53 80 00       	push   $0x805329
+  801dc6:	e8 2d e5 ff ff       	call   8002f8 <cprintf>
+  801dcb:	83 c4 10             	add    $0x10,%esp
+  801dce:	eb b9                	jmp    801d89 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801dd0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801dd3:	0f 94 c0             	sete   %al
+  801dd6:	0f b6 c0             	movzbl %al,%eax
+}
+  801dd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ddc:	5b                   	pop    %ebx
+  801ddd:	5e                   	pop    %esi
+  801dde:	5f                   	pop    %edi
+  801ddf:	5d                   	pop    %ebp
+  801de0:	c3                   	ret
+
+00801de1 <devpipe_read>:
+{
+  801de1:	55                   	push   %ebp
+  801de2:	89 e5                	mov    %esp,%ebp
+  801de4:	57                   	push   %edi
+  801de5:	56                   	push   %esi
+  801de6:	53                   	push   %ebx
+  801de7:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801dea:	ff 75 08             	push   0x8(%ebp)
+  801ded:	e8 8b f5 ff ff       	call   80137d <fd2data>
+  801df2:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801df4:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801df7:	8d 40 04             	lea    0x4(%eax),%eax
+  801dfa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801dfd:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801e00:	8b 0b                	mov    (%ebx),%ecx
+  801e02:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801e08:	29 ce                	sub    %ecx,%esi
+  801e0a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e0f:	f7 e6                	mul    %esi
+  801e11:	c1 ea 0c             	shr    $0xc,%edx
+  801e14:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801e1a:	29 c6                	sub    %eax,%esi
+  801e1c:	89 f2                	mov    %esi,%edx
+  801e1e:	75 43                	jne    801e63 <devpipe_read+0x82>
+		ref = pageref(p);
+  801e20:	83 ec 0c             	sub    $0xc,%esp
+  801e23:	53                   	push   %ebx
+  801e24:	e8 77 2d 00 00       	call   804ba0 <pageref>
+  801e29:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801e2b:	89 da                	mov    %ebx,%edx
+  801e2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e30:	e8 47 ff ff ff       	call   801d7c <_pipeisclosed>
+  801e35:	83 c4 10             	add    $0x10,%esp
+  801e38:	85 c0                	test   %eax,%eax
+  801e3a:	0f 85 c1 00 00 00    	jne    801f01 <devpipe_read+0x120>
+	*sleeping = 1;
+  801e40:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801e47:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801e4c:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801e4f:	75 ac                	jne    801dfd <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801e51:	83 ec 04             	sub    $0x4,%esp
+  801e54:	56                   	push   %esi
+  801e55:	57                   	push   %edi
+  801e56:	ff 75 e4             	push   -0x1c(%ebp)
+  801e59:	e8 4d f4 ff ff       	call   8012ab <sys_futex_wait>
+  801e5e:	83 c4 10             	add    $0x10,%esp
+  801e61:	eb 9a                	jmp    801dfd <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801e63:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801e66:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801e6a:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801e6c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e71:	f7 e1                	mul    %ecx
+  801e73:	c1 ea 0b             	shr    $0xb,%edx
+  801e76:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801e7c:	29 c1                	sub    %eax,%ecx
+  801e7e:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801e80:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801e85:	29 cf                	sub    %ecx,%edi
+  801e87:	39 f7                	cmp    %esi,%edi
+  801e89:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801e8c:	8d 43 10             	lea    0x10(%ebx),%eax
+  801e8f:	83 ec 04             	sub    $0x4,%esp
+  801e92:	57                   	push   %edi
+  801e93:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e96:	01 c2                	add    %eax,%edx
+  801e98:	52                   	push   %edx
+  801e99:	ff 75 0c             	push   0xc(%ebp)
+  801e9c:	e8 c4 eb ff ff       	call   800a65 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801ea1:	83 c4 0c             	add    $0xc,%esp
+  801ea4:	89 f1                	mov    %esi,%ecx
+  801ea6:	29 f9                	sub    %edi,%ecx
+  801ea8:	51                   	push   %ecx
+  801ea9:	ff 75 e4             	push   -0x1c(%ebp)
+  801eac:	89 f8                	mov    %edi,%eax
+  801eae:	03 45 0c             	add    0xc(%ebp),%eax
+  801eb1:	50                   	push   %eax
+  801eb2:	e8 ae eb ff ff       	call   800a65 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801eb7:	89 f1                	mov    %esi,%ecx
+  801eb9:	03 0b                	add    (%ebx),%ecx
+  801ebb:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801ec0:	f7 e1                	mul    %ecx
+  801ec2:	c1 ea 0c             	shr    $0xc,%edx
+  801ec5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801ecb:	29 d1                	sub    %edx,%ecx
+  801ecd:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801ecf:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801ed4:	83 c4 10             	add    $0x10,%esp
+  801ed7:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801edb:	75 0a                	jne    801ee7 <devpipe_read+0x106>
+	return n;
+  801edd:	89 f0                	mov    %esi,%eax
+}
+  801edf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ee2:	5b                   	pop    %ebx
+  801ee3:	5e                   	pop    %esi
+  801ee4:	5f                   	pop    %edi
+  801ee5:	5d                   	pop    %ebp
+  801ee6:	c3                   	ret
+		*sleeping = 0;
+  801ee7:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801eee:	83 ec 08             	sub    $0x8,%esp
+  801ef1:	68 00 04 00 00       	push   $0x400
+  801ef6:	53                   	push   %ebx
+  801ef7:	e8 ff f3 ff ff       	call   8012fb <sys_futex_wake>
+  801efc:	83 c4 10             	add    $0x10,%esp
+  801eff:	eb dc                	jmp    801edd <devpipe_read+0xfc>
+			return 0;
+  801f01:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f06:	eb d7                	jmp    801edf <devpipe_read+0xfe>
+
+00801f08 <devpipe_write>:
+{
+  801f08:	55                   	push   %ebp
+  801f09:	89 e5                	mov    %esp,%ebp
+  801f0b:	57                   	push   %edi
+  801f0c:	56                   	push   %esi
+  801f0d:	53                   	push   %ebx
+  801f0e:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801f11:	ff 75 08             	push   0x8(%ebp)
+  801f14:	e8 64 f4 ff ff       	call   80137d <fd2data>
+  801f19:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801f1b:	83 c4 10             	add    $0x10,%esp
+  801f1e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801f25:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f28:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801f2b:	0f 83 23 01 00 00    	jae    802054 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801f31:	8b 77 04             	mov    0x4(%edi),%esi
+  801f34:	8b 1f                	mov    (%edi),%ebx
+  801f36:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801f3c:	29 d9                	sub    %ebx,%ecx
+  801f3e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f43:	f7 e1                	mul    %ecx
+  801f45:	c1 ea 0c             	shr    $0xc,%edx
+  801f48:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801f4e:	29 c1                	sub    %eax,%ecx
+  801f50:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801f52:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801f58:	75 40                	jne    801f9a <devpipe_write+0x92>
+			ref = pageref(p);
+  801f5a:	83 ec 0c             	sub    $0xc,%esp
+  801f5d:	57                   	push   %edi
+  801f5e:	e8 3d 2c 00 00       	call   804ba0 <pageref>
+  801f63:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801f65:	89 fa                	mov    %edi,%edx
+  801f67:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6a:	e8 0d fe ff ff       	call   801d7c <_pipeisclosed>
+  801f6f:	83 c4 10             	add    $0x10,%esp
+  801f72:	85 c0                	test   %eax,%eax
+  801f74:	0f 85 d5 00 00 00    	jne    80204f <devpipe_write+0x147>
+	*sleeping = 1;
+  801f7a:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801f81:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801f86:	39 1f                	cmp    %ebx,(%edi)
+  801f88:	75 a7                	jne    801f31 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801f8a:	83 ec 04             	sub    $0x4,%esp
+  801f8d:	56                   	push   %esi
+  801f8e:	53                   	push   %ebx
+  801f8f:	57                   	push   %edi
+  801f90:	e8 16 f3 ff ff       	call   8012ab <sys_futex_wait>
+  801f95:	83 c4 10             	add    $0x10,%esp
+  801f98:	eb 97                	jmp    801f31 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801f9a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801f9d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fa0:	29 c1                	sub    %eax,%ecx
+  801fa2:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801fa7:	89 d8                	mov    %ebx,%eax
+  801fa9:	29 d0                	sub    %edx,%eax
+  801fab:	39 c1                	cmp    %eax,%ecx
+  801fad:	0f 46 c1             	cmovbe %ecx,%eax
+  801fb0:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801fb2:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801fb7:	f7 e6                	mul    %esi
+  801fb9:	c1 ea 0b             	shr    $0xb,%edx
+  801fbc:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801fc2:	29 c6                	sub    %eax,%esi
+  801fc4:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801fc6:	29 f3                	sub    %esi,%ebx
+  801fc8:	39 cb                	cmp    %ecx,%ebx
+  801fca:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801fcd:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801fd0:	8d 77 10             	lea    0x10(%edi),%esi
+  801fd3:	83 ec 04             	sub    $0x4,%esp
+  801fd6:	53                   	push   %ebx
+  801fd7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fda:	03 45 0c             	add    0xc(%ebp),%eax
+  801fdd:	50                   	push   %eax
+  801fde:	01 f2                	add    %esi,%edx
+  801fe0:	52                   	push   %edx
+  801fe1:	e8 7f ea ff ff       	call   800a65 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  801fe6:	83 c4 0c             	add    $0xc,%esp
+  801fe9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801fec:	29 d8                	sub    %ebx,%eax
+  801fee:	50                   	push   %eax
+  801fef:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ff2:	01 d3                	add    %edx,%ebx
+  801ff4:	03 5d 0c             	add    0xc(%ebp),%ebx
+  801ff7:	53                   	push   %ebx
+  801ff8:	56                   	push   %esi
+  801ff9:	e8 67 ea ff ff       	call   800a65 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  801ffe:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802001:	03 4f 04             	add    0x4(%edi),%ecx
+  802004:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802009:	f7 e1                	mul    %ecx
+  80200b:	c1 ea 0c             	shr    $0xc,%edx
+  80200e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802014:	29 d1                	sub    %edx,%ecx
+  802016:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  802019:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80201e:	83 c4 10             	add    $0x10,%esp
+  802021:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802025:	75 0b                	jne    802032 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802027:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  80202a:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80202d:	e9 f3 fe ff ff       	jmp    801f25 <devpipe_write+0x1d>
+		*sleeping = 0;
+  802032:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  802039:	83 ec 08             	sub    $0x8,%esp
+  80203c:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802041:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802044:	50                   	push   %eax
+  802045:	e8 b1 f2 ff ff       	call   8012fb <sys_futex_wake>
+  80204a:	83 c4 10             	add    $0x10,%esp
+  80204d:	eb d8                	jmp    802027 <devpipe_write+0x11f>
+				return 0;
+  80204f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802054:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802057:	5b                   	pop    %ebx
+  802058:	5e                   	pop    %esi
+  802059:	5f                   	pop    %edi
+  80205a:	5d                   	pop    %ebp
+  80205b:	c3                   	ret
+
+0080205c <pipe>:
+{
+  80205c:	55                   	push   %ebp
+  80205d:	89 e5                	mov    %esp,%ebp
+  80205f:	56                   	push   %esi
+  802060:	53                   	push   %ebx
+  802061:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802064:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802067:	50                   	push   %eax
+  802068:	e8 27 f3 ff ff       	call   801394 <fd_alloc>
+  80206d:	89 c3                	mov    %eax,%ebx
+  80206f:	83 c4 10             	add    $0x10,%esp
+  802072:	85 c0                	test   %eax,%eax
+  802074:	0f 88 23 01 00 00    	js     80219d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80207a:	83 ec 04             	sub    $0x4,%esp
+  80207d:	68 07 04 00 00       	push   $0x407
+  802082:	ff 75 f4             	push   -0xc(%ebp)
+  802085:	6a 00                	push   $0x0
+  802087:	e8 46 ed ff ff       	call   800dd2 <sys_page_alloc>
+  80208c:	89 c3                	mov    %eax,%ebx
+  80208e:	83 c4 10             	add    $0x10,%esp
+  802091:	85 c0                	test   %eax,%eax
+  802093:	0f 88 04 01 00 00    	js     80219d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802099:	83 ec 0c             	sub    $0xc,%esp
+  80209c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80209f:	50                   	push   %eax
+  8020a0:	e8 ef f2 ff ff       	call   801394 <fd_alloc>
+  8020a5:	89 c3                	mov    %eax,%ebx
+  8020a7:	83 c4 10             	add    $0x10,%esp
+  8020aa:	85 c0                	test   %eax,%eax
+  8020ac:	0f 88 db 00 00 00    	js     80218d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020b2:	83 ec 04             	sub    $0x4,%esp
+  8020b5:	68 07 04 00 00       	push   $0x407
+  8020ba:	ff 75 f0             	push   -0x10(%ebp)
+  8020bd:	6a 00                	push   $0x0
+  8020bf:	e8 0e ed ff ff       	call   800dd2 <sys_page_alloc>
+  8020c4:	89 c3                	mov    %eax,%ebx
+  8020c6:	83 c4 10             	add    $0x10,%esp
+  8020c9:	85 c0                	test   %eax,%eax
+  8020cb:	0f 88 bc 00 00 00    	js     80218d <pipe+0x131>
+	va = fd2data(fd0);
+  8020d1:	83 ec 0c             	sub    $0xc,%esp
+  8020d4:	ff 75 f4             	push   -0xc(%ebp)
+  8020d7:	e8 a1 f2 ff ff       	call   80137d <fd2data>
+  8020dc:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020de:	83 c4 0c             	add    $0xc,%esp
+  8020e1:	68 07 04 00 00       	push   $0x407
+  8020e6:	50                   	push   %eax
+  8020e7:	6a 00                	push   $0x0
+  8020e9:	e8 e4 ec ff ff       	call   800dd2 <sys_page_alloc>
+  8020ee:	89 c3                	mov    %eax,%ebx
+  8020f0:	83 c4 10             	add    $0x10,%esp
+  8020f3:	85 c0                	test   %eax,%eax
+  8020f5:	0f 88 82 00 00 00    	js     80217d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020fb:	83 ec 0c             	sub    $0xc,%esp
+  8020fe:	ff 75 f0             	push   -0x10(%ebp)
+  802101:	e8 77 f2 ff ff       	call   80137d <fd2data>
+  802106:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80210d:	50                   	push   %eax
+  80210e:	6a 00                	push   $0x0
+  802110:	56                   	push   %esi
+  802111:	6a 00                	push   $0x0
+  802113:	e8 fd ec ff ff       	call   800e15 <sys_page_map>
+  802118:	89 c3                	mov    %eax,%ebx
+  80211a:	83 c4 20             	add    $0x20,%esp
+  80211d:	85 c0                	test   %eax,%eax
+  80211f:	78 4e                	js     80216f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802121:	a1 20 60 80 00       	mov    0x806020,%eax
+  802126:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802129:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80212b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80212e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802135:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802138:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80213a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80213d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802144:	83 ec 0c             	sub    $0xc,%esp
+  802147:	ff 75 f4             	push   -0xc(%ebp)
+  80214a:	e8 1e f2 ff ff       	call   80136d <fd2num>
+  80214f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802152:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802154:	83 c4 04             	add    $0x4,%esp
+  802157:	ff 75 f0             	push   -0x10(%ebp)
+  80215a:	e8 0e f2 ff ff       	call   80136d <fd2num>
+  80215f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802162:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802165:	83 c4 10             	add    $0x10,%esp
+  802168:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80216d:	eb 2e                	jmp    80219d <pipe+0x141>
+	sys_page_unmap(0, va);
+  80216f:	83 ec 08             	sub    $0x8,%esp
+  802172:	56                   	push   %esi
+  802173:	6a 00                	push   $0x0
+  802175:	e8 dd ec ff ff       	call   800e57 <sys_page_unmap>
+  80217a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80217d:	83 ec 08             	sub    $0x8,%esp
+  802180:	ff 75 f0             	push   -0x10(%ebp)
+  802183:	6a 00                	push   $0x0
+  802185:	e8 cd ec ff ff       	call   800e57 <sys_page_unmap>
+  80218a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80218d:	83 ec 08             	sub    $0x8,%esp
+  802190:	ff 75 f4             	push   -0xc(%ebp)
+  802193:	6a 00                	push   $0x0
+  802195:	e8 bd ec ff ff       	call   800e57 <sys_page_unmap>
+  80219a:	83 c4 10             	add    $0x10,%esp
+}
+  80219d:	89 d8                	mov    %ebx,%eax
+  80219f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021a2:	5b                   	pop    %ebx
+  8021a3:	5e                   	pop    %esi
+  8021a4:	5d                   	pop    %ebp
+  8021a5:	c3                   	ret
+
+008021a6 <pipeisclosed>:
+{
+  8021a6:	55                   	push   %ebp
+  8021a7:	89 e5                	mov    %esp,%ebp
+  8021a9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021af:	50                   	push   %eax
+  8021b0:	ff 75 08             	push   0x8(%ebp)
+  8021b3:	e8 30 f2 ff ff       	call   8013e8 <fd_lookup>
+  8021b8:	83 c4 10             	add    $0x10,%esp
+  8021bb:	85 c0                	test   %eax,%eax
+  8021bd:	78 18                	js     8021d7 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8021bf:	83 ec 0c             	sub    $0xc,%esp
+  8021c2:	ff 75 f4             	push   -0xc(%ebp)
+  8021c5:	e8 b3 f1 ff ff       	call   80137d <fd2data>
+  8021ca:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8021cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021cf:	e8 a8 fb ff ff       	call   801d7c <_pipeisclosed>
+  8021d4:	83 c4 10             	add    $0x10,%esp
+}
+  8021d7:	c9                   	leave
+  8021d8:	c3                   	ret
+
+008021d9 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  8021d9:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8021db:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  8021e1:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  8021e7:	81 c2 34 01 00 00    	add    $0x134,%edx
+  8021ed:	39 d0                	cmp    %edx,%eax
+  8021ef:	74 2e                	je     80221f <segment_lookup+0x46>
+{
+  8021f1:	55                   	push   %ebp
+  8021f2:	89 e5                	mov    %esp,%ebp
+  8021f4:	57                   	push   %edi
+  8021f5:	56                   	push   %esi
+  8021f6:	53                   	push   %ebx
+  8021f7:	eb 07                	jmp    802200 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8021f9:	83 c0 20             	add    $0x20,%eax
+  8021fc:	39 d0                	cmp    %edx,%eax
+  8021fe:	74 15                	je     802215 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802200:	8b 18                	mov    (%eax),%ebx
+  802202:	39 d9                	cmp    %ebx,%ecx
+  802204:	72 f3                	jb     8021f9 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  802206:	8b 38                	mov    (%eax),%edi
+  802208:	8b 58 04             	mov    0x4(%eax),%ebx
+  80220b:	89 ce                	mov    %ecx,%esi
+  80220d:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  80220f:	39 de                	cmp    %ebx,%esi
+  802211:	73 e6                	jae    8021f9 <segment_lookup+0x20>
+  802213:	eb 05                	jmp    80221a <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  802215:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80221a:	5b                   	pop    %ebx
+  80221b:	5e                   	pop    %esi
+  80221c:	5f                   	pop    %edi
+  80221d:	5d                   	pop    %ebp
+  80221e:	c3                   	ret
+	return NULL;
+  80221f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802224:	c3                   	ret
+
+00802225 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802225:	55                   	push   %ebp
+  802226:	89 e5                	mov    %esp,%ebp
+  802228:	53                   	push   %ebx
+  802229:	83 ec 04             	sub    $0x4,%esp
+  80222c:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80222e:	c1 e8 16             	shr    $0x16,%eax
+  802231:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802238:	25 81 00 00 00       	and    $0x81,%eax
+  80223d:	83 f8 01             	cmp    $0x1,%eax
+  802240:	75 6b                	jne    8022ad <page_is_clean+0x88>
+  802242:	89 da                	mov    %ebx,%edx
+  802244:	c1 ea 0c             	shr    $0xc,%edx
+  802247:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  80224e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802253:	f6 c1 01             	test   $0x1,%cl
+  802256:	74 5a                	je     8022b2 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802258:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80225f:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802265:	75 4b                	jne    8022b2 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  802267:	89 d8                	mov    %ebx,%eax
+  802269:	e8 6b ff ff ff       	call   8021d9 <segment_lookup>
+  80226e:	89 c2                	mov    %eax,%edx
+		return 1;
+  802270:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  802275:	85 d2                	test   %edx,%edx
+  802277:	75 39                	jne    8022b2 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  802279:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  80227f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802284:	eb 03                	jmp    802289 <page_is_clean+0x64>
+  802286:	83 c0 01             	add    $0x1,%eax
+  802289:	39 c2                	cmp    %eax,%edx
+  80228b:	7e 19                	jle    8022a6 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  80228d:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  802294:	72 f0                	jb     802286 <page_is_clean+0x61>
+  802296:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  80229d:	73 e7                	jae    802286 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  80229f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022a4:	eb 0c                	jmp    8022b2 <page_is_clean+0x8d>
+	return 0;
+  8022a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ab:	eb 05                	jmp    8022b2 <page_is_clean+0x8d>
+		return 0;
+  8022ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022b5:	c9                   	leave
+  8022b6:	c3                   	ret
+
+008022b7 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  8022b7:	55                   	push   %ebp
+  8022b8:	89 e5                	mov    %esp,%ebp
+  8022ba:	57                   	push   %edi
+  8022bb:	56                   	push   %esi
+  8022bc:	53                   	push   %ebx
+  8022bd:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8022c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8022c5:	eb 19                	jmp    8022e0 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8022c7:	f7 d3                	not    %ebx
+  8022c9:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8022cf:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8022d1:	83 c6 01             	add    $0x1,%esi
+  8022d4:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8022da:	0f 87 97 00 00 00    	ja     802377 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8022e0:	89 f3                	mov    %esi,%ebx
+  8022e2:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  8022e8:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8022ee:	89 d8                	mov    %ebx,%eax
+  8022f0:	c1 e8 0a             	shr    $0xa,%eax
+  8022f3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8022fa:	25 81 00 00 00       	and    $0x81,%eax
+  8022ff:	83 f8 01             	cmp    $0x1,%eax
+  802302:	75 c3                	jne    8022c7 <linear_walk+0x10>
+  802304:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80230a:	77 bb                	ja     8022c7 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  80230c:	89 df                	mov    %ebx,%edi
+  80230e:	c1 e7 0c             	shl    $0xc,%edi
+  802311:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802314:	89 f8                	mov    %edi,%eax
+  802316:	e8 0a ff ff ff       	call   802225 <page_is_clean>
+  80231b:	84 c0                	test   %al,%al
+  80231d:	75 64                	jne    802383 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80231f:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802325:	77 aa                	ja     8022d1 <linear_walk+0x1a>
+  802327:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  80232d:	72 a2                	jb     8022d1 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80232f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802336:	a8 01                	test   $0x1,%al
+  802338:	74 97                	je     8022d1 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80233a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802341:	f6 c4 04             	test   $0x4,%ah
+  802344:	75 8b                	jne    8022d1 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802346:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80234d:	f6 c4 02             	test   $0x2,%ah
+  802350:	0f 85 7b ff ff ff    	jne    8022d1 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802356:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80235d:	c1 e8 0c             	shr    $0xc,%eax
+  802360:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802363:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802368:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80236c:	66 83 f8 01          	cmp    $0x1,%ax
+  802370:	76 11                	jbe    802383 <linear_walk+0xcc>
+  802372:	e9 5a ff ff ff       	jmp    8022d1 <linear_walk+0x1a>
+  802377:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  80237c:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802383:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  802389:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80238c:	83 c4 1c             	add    $0x1c,%esp
+  80238f:	5b                   	pop    %ebx
+  802390:	5e                   	pop    %esi
+  802391:	5f                   	pop    %edi
+  802392:	5d                   	pop    %ebp
+  802393:	c3                   	ret
+
+00802394 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802394:	55                   	push   %ebp
+  802395:	89 e5                	mov    %esp,%ebp
+  802397:	56                   	push   %esi
+  802398:	53                   	push   %ebx
+  802399:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  80239b:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023a0:	83 e0 7f             	and    $0x7f,%eax
+  8023a3:	c1 e0 04             	shl    $0x4,%eax
+  8023a6:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  8023ac:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  8023b2:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  8023b8:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  8023be:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023c3:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  8023c6:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023cb:	83 c0 01             	add    $0x1,%eax
+  8023ce:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  8023d3:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  8023d6:	5b                   	pop    %ebx
+  8023d7:	5e                   	pop    %esi
+  8023d8:	5d                   	pop    %ebp
+  8023d9:	c3                   	ret
+
+008023da <page_ring_enter>:
+{
+  8023da:	55                   	push   %ebp
+  8023db:	89 e5                	mov    %esp,%ebp
+  8023dd:	57                   	push   %edi
+  8023de:	56                   	push   %esi
+  8023df:	53                   	push   %ebx
+  8023e0:	83 ec 18             	sub    $0x18,%esp
+  8023e3:	89 c6                	mov    %eax,%esi
+  8023e5:	89 d7                	mov    %edx,%edi
+  8023e7:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  8023e9:	6a 00                	push   $0x0
+  8023eb:	6a 00                	push   $0x0
+  8023ed:	6a 00                	push   $0x0
+  8023ef:	6a 07                	push   $0x7
+  8023f1:	ff 35 40 b0 80 00    	push   0x80b040
+  8023f7:	e8 8e 26 00 00       	call   804a8a <ipc_call>
+  8023fc:	83 c4 20             	add    $0x20,%esp
+  8023ff:	85 c0                	test   %eax,%eax
+  802401:	79 22                	jns    802425 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802403:	50                   	push   %eax
+  802404:	68 41 53 80 00       	push   $0x805341
+  802409:	68 13 02 00 00       	push   $0x213
+  80240e:	68 55 53 80 00       	push   $0x805355
+  802413:	e8 05 de ff ff       	call   80021d <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802418:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  80241d:	83 c0 01             	add    $0x1,%eax
+  802420:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802425:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  80242b:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802430:	39 c2                	cmp    %eax,%edx
+  802432:	74 24                	je     802458 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802434:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802439:	83 e0 7f             	and    $0x7f,%eax
+  80243c:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802443:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  80244a:	29 f0                	sub    %esi,%eax
+  80244c:	39 d8                	cmp    %ebx,%eax
+  80244e:	73 c8                	jae    802418 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802450:	8b 52 04             	mov    0x4(%edx),%edx
+  802453:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802456:	eb c0                	jmp    802418 <page_ring_enter+0x3e>
+}
+  802458:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80245b:	5b                   	pop    %ebx
+  80245c:	5e                   	pop    %esi
+  80245d:	5f                   	pop    %edi
+  80245e:	5d                   	pop    %ebp
+  80245f:	c3                   	ret
+
+00802460 <page_ring_reserve>:
+{
+  802460:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802462:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802467:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  80246d:	29 d0                	sub    %edx,%eax
+  80246f:	ba 80 00 00 00       	mov    $0x80,%edx
+  802474:	29 ca                	sub    %ecx,%edx
+  802476:	39 c2                	cmp    %eax,%edx
+  802478:	72 01                	jb     80247b <page_ring_reserve+0x1b>
+  80247a:	c3                   	ret
+{
+  80247b:	55                   	push   %ebp
+  80247c:	89 e5                	mov    %esp,%ebp
+  80247e:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802481:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802486:	ba 00 00 00 00       	mov    $0x0,%edx
+  80248b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802490:	e8 45 ff ff ff       	call   8023da <page_ring_enter>
+}
+  802495:	c9                   	leave
+  802496:	c3                   	ret
+
+00802497 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802497:	55                   	push   %ebp
+  802498:	89 e5                	mov    %esp,%ebp
+  80249a:	53                   	push   %ebx
+  80249b:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  80249e:	6a 07                	push   $0x7
+  8024a0:	6a 01                	push   $0x1
+  8024a2:	89 c3                	mov    %eax,%ebx
+  8024a4:	c1 e3 0c             	shl    $0xc,%ebx
+  8024a7:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  8024ad:	52                   	push   %edx
+  8024ae:	6a 04                	push   $0x4
+  8024b0:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  8024b7:	e8 ce 25 00 00       	call   804a8a <ipc_call>
+	sharereqs[i].nslots = 0;
+  8024bc:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  8024c3:	00 00 00 
+	return r;
+}
+  8024c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024c9:	c9                   	leave
+  8024ca:	c3                   	ret
+
+008024cb <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  8024cb:	55                   	push   %ebp
+  8024cc:	89 e5                	mov    %esp,%ebp
+  8024ce:	56                   	push   %esi
+  8024cf:	53                   	push   %ebx
+  8024d0:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  8024d2:	c1 e8 10             	shr    $0x10,%eax
+  8024d5:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  8024d8:	89 c2                	mov    %eax,%edx
+  8024da:	c1 e2 0c             	shl    $0xc,%edx
+  8024dd:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  8024e3:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8024e6:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  8024ec:	89 c2                	mov    %eax,%edx
+  8024ee:	c1 e2 0a             	shl    $0xa,%edx
+  8024f1:	01 f2                	add    %esi,%edx
+  8024f3:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  8024fa:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802500:	74 09                	je     80250b <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802502:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802507:	5b                   	pop    %ebx
+  802508:	5e                   	pop    %esi
+  802509:	5d                   	pop    %ebp
+  80250a:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  80250b:	e8 87 ff ff ff       	call   802497 <page_share_send>
+  802510:	eb f5                	jmp    802507 <page_share_slot+0x3c>
+
+00802512 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802512:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802517:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  80251a:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  80251f:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  802525:	74 09                	je     802530 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802527:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80252c:	85 c0                	test   %eax,%eax
+  80252e:	75 01                	jne    802531 <page_ring_ready+0x1f>
+}
+  802530:	c3                   	ret
+{
+  802531:	55                   	push   %ebp
+  802532:	89 e5                	mov    %esp,%ebp
+  802534:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802537:	68 07 06 00 00       	push   $0x607
+  80253c:	6a 08                	push   $0x8
+  80253e:	68 00 30 ad de       	push   $0xdead3000
+  802543:	6a 00                	push   $0x0
+  802545:	e8 b3 e9 ff ff       	call   800efd <sys_page_alloc_range>
+  80254a:	83 c4 10             	add    $0x10,%esp
+  80254d:	83 f8 08             	cmp    $0x8,%eax
+  802550:	74 1b                	je     80256d <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802552:	83 ec 04             	sub    $0x4,%esp
+  802555:	6a 08                	push   $0x8
+  802557:	68 00 30 ad de       	push   $0xdead3000
+  80255c:	6a 00                	push   $0x0
+  80255e:	e8 08 ea ff ff       	call   800f6b <sys_page_unmap_range>
+		return 0;
+  802563:	83 c4 10             	add    $0x10,%esp
+  802566:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80256b:	c9                   	leave
+  80256c:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  80256d:	83 ec 0c             	sub    $0xc,%esp
+  802570:	68 07 04 00 00       	push   $0x407
+  802575:	6a 08                	push   $0x8
+  802577:	68 00 30 ad de       	push   $0xdead3000
+  80257c:	6a 06                	push   $0x6
+  80257e:	ff 35 40 b0 80 00    	push   0x80b040
+  802584:	e8 01 25 00 00       	call   804a8a <ipc_call>
+  802589:	83 c4 20             	add    $0x20,%esp
+  80258c:	85 c0                	test   %eax,%eax
+  80258e:	78 14                	js     8025a4 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802590:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802595:	8b 40 48             	mov    0x48(%eax),%eax
+  802598:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  80259d:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025a2:	eb c7                	jmp    80256b <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  8025a4:	83 ec 04             	sub    $0x4,%esp
+  8025a7:	6a 08                	push   $0x8
+  8025a9:	68 00 30 ad de       	push   $0xdead3000
+  8025ae:	6a 00                	push   $0x0
+  8025b0:	e8 b6 e9 ff ff       	call   800f6b <sys_page_unmap_range>
+		return 0;
+  8025b5:	83 c4 10             	add    $0x10,%esp
+  8025b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025bd:	eb ac                	jmp    80256b <page_ring_ready+0x59>
+
+008025bf <page_remove_slot>:
+{
+  8025bf:	55                   	push   %ebp
+  8025c0:	89 e5                	mov    %esp,%ebp
+  8025c2:	56                   	push   %esi
+  8025c3:	53                   	push   %ebx
+  8025c4:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8025c6:	89 c6                	mov    %eax,%esi
+  8025c8:	c1 ee 10             	shr    $0x10,%esi
+  8025cb:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8025ce:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  8025d5:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  8025db:	74 2a                	je     802607 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8025dd:	83 ec 0c             	sub    $0xc,%esp
+  8025e0:	6a 00                	push   $0x0
+  8025e2:	6a 00                	push   $0x0
+  8025e4:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  8025e6:	c1 e3 04             	shl    $0x4,%ebx
+  8025e9:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8025ec:	53                   	push   %ebx
+  8025ed:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8025f4:	e8 91 24 00 00       	call   804a8a <ipc_call>
+  8025f9:	83 c4 20             	add    $0x20,%esp
+  8025fc:	85 c0                	test   %eax,%eax
+  8025fe:	78 2d                	js     80262d <page_remove_slot+0x6e>
+}
+  802600:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802603:	5b                   	pop    %ebx
+  802604:	5e                   	pop    %esi
+  802605:	5d                   	pop    %ebp
+  802606:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802607:	e8 06 ff ff ff       	call   802512 <page_ring_ready>
+  80260c:	85 c0                	test   %eax,%eax
+  80260e:	74 cd                	je     8025dd <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802610:	b8 01 00 00 00       	mov    $0x1,%eax
+  802615:	e8 46 fe ff ff       	call   802460 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  80261a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80261f:	89 da                	mov    %ebx,%edx
+  802621:	b8 02 00 00 00       	mov    $0x2,%eax
+  802626:	e8 69 fd ff ff       	call   802394 <page_ring_post>
+		return;
+  80262b:	eb d3                	jmp    802600 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  80262d:	50                   	push   %eax
+  80262e:	68 b0 53 80 00       	push   $0x8053b0
+  802633:	68 ac 03 00 00       	push   $0x3ac
+  802638:	68 55 53 80 00       	push   $0x805355
+  80263d:	e8 db db ff ff       	call   80021d <_panic>
+
+00802642 <find_paging_env>:
+	if(pagingenv)
+  802642:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802647:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802649:	85 c0                	test   %eax,%eax
+  80264b:	74 05                	je     802652 <find_paging_env+0x10>
+  80264d:	eb 56                	jmp    8026a5 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  80264f:	83 c0 01             	add    $0x1,%eax
+  802652:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802657:	7f 47                	jg     8026a0 <find_paging_env+0x5e>
+  802659:	83 f9 01             	cmp    $0x1,%ecx
+  80265c:	7f 42                	jg     8026a0 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  80265e:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802661:	c1 e2 06             	shl    $0x6,%edx
+  802664:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80266a:	8b 52 50             	mov    0x50(%edx),%edx
+  80266d:	83 fa 02             	cmp    $0x2,%edx
+  802670:	75 dd                	jne    80264f <find_paging_env+0xd>
+  802672:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802675:	c1 e2 06             	shl    $0x6,%edx
+  802678:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80267e:	8b 52 54             	mov    0x54(%edx),%edx
+  802681:	85 d2                	test   %edx,%edx
+  802683:	74 ca                	je     80264f <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802685:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802688:	c1 e2 06             	shl    $0x6,%edx
+  80268b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802691:	8b 52 48             	mov    0x48(%edx),%edx
+  802694:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  80269b:	8d 49 01             	lea    0x1(%ecx),%ecx
+  80269e:	eb af                	jmp    80264f <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  8026a0:	83 f9 02             	cmp    $0x2,%ecx
+  8026a3:	74 01                	je     8026a6 <find_paging_env+0x64>
+}
+  8026a5:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  8026a6:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8026ab:	8b 40 48             	mov    0x48(%eax),%eax
+  8026ae:	83 e0 01             	and    $0x1,%eax
+  8026b1:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  8026b8:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  8026bd:	eb e6                	jmp    8026a5 <find_paging_env+0x63>
+
+008026bf <page_add_backed>:
+{
+  8026bf:	55                   	push   %ebp
+  8026c0:	89 e5                	mov    %esp,%ebp
+  8026c2:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  8026c5:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  8026ca:	83 f8 04             	cmp    $0x4,%eax
+  8026cd:	74 35                	je     802704 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  8026cf:	89 d1                	mov    %edx,%ecx
+  8026d1:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  8026d7:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  8026de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026e1:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  8026e8:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8026ee:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  8026f5:	83 c0 01             	add    $0x1,%eax
+  8026f8:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  8026fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802702:	5d                   	pop    %ebp
+  802703:	c3                   	ret
+		return -E_NO_MEM;
+  802704:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802709:	eb f7                	jmp    802702 <page_add_backed+0x43>
+
+0080270b <percentage_of_pgdir_to_walk>:
+{
+  80270b:	55                   	push   %ebp
+  80270c:	89 e5                	mov    %esp,%ebp
+  80270e:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802711:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802715:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802718:	db 45 fc             	fildl  -0x4(%ebp)
+  80271b:	d8 35 3c 58 80 00    	fdivs  0x80583c
+	return ret*ret;
+  802721:	d8 c8                	fmul   %st(0),%st
+}
+  802723:	c9                   	leave
+  802724:	c3                   	ret
+
+00802725 <nfu_with_aging_page_choice_func>:
+{
+  802725:	55                   	push   %ebp
+  802726:	89 e5                	mov    %esp,%ebp
+  802728:	57                   	push   %edi
+  802729:	56                   	push   %esi
+  80272a:	53                   	push   %ebx
+  80272b:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80272e:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  802734:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802736:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80273b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802740:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802747:	ba 00 00 00 00       	mov    $0x0,%edx
+  80274c:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  80274f:	eb 18                	jmp    802769 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802751:	f7 d0                	not    %eax
+  802753:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802758:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80275a:	83 c2 01             	add    $0x1,%edx
+  80275d:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802763:	0f 87 13 01 00 00    	ja     80287c <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802769:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80276d:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802770:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802775:	89 c1                	mov    %eax,%ecx
+  802777:	c1 e9 0a             	shr    $0xa,%ecx
+  80277a:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802781:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802787:	83 f9 01             	cmp    $0x1,%ecx
+  80278a:	75 c5                	jne    802751 <nfu_with_aging_page_choice_func+0x2c>
+  80278c:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802791:	77 be                	ja     802751 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802793:	89 c1                	mov    %eax,%ecx
+  802795:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802798:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  80279e:	0f 82 a5 00 00 00    	jb     802849 <nfu_with_aging_page_choice_func+0x124>
+  8027a4:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8027aa:	0f 87 99 00 00 00    	ja     802849 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8027b0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8027b7:	f6 c1 01             	test   $0x1,%cl
+  8027ba:	0f 84 89 00 00 00    	je     802849 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027c0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8027c7:	f6 c5 04             	test   $0x4,%ch
+  8027ca:	75 7d                	jne    802849 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8027cc:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027d3:	f6 c5 02             	test   $0x2,%ch
+  8027d6:	75 71                	jne    802849 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8027d8:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8027df:	c1 e9 0c             	shr    $0xc,%ecx
+  8027e2:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8027e5:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8027eb:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8027ef:	66 83 f9 01          	cmp    $0x1,%cx
+  8027f3:	77 54                	ja     802849 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  8027f5:	89 f9                	mov    %edi,%ecx
+  8027f7:	80 f9 ff             	cmp    $0xff,%cl
+  8027fa:	74 21                	je     80281d <nfu_with_aging_page_choice_func+0xf8>
+  8027fc:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802803:	c1 e9 0c             	shr    $0xc,%ecx
+  802806:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802809:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80280f:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802813:	89 fb                	mov    %edi,%ebx
+  802815:	38 d9                	cmp    %bl,%cl
+  802817:	73 30                	jae    802849 <nfu_with_aging_page_choice_func+0x124>
+  802819:	dd d8                	fstp   %st(0)
+  80281b:	eb 02                	jmp    80281f <nfu_with_aging_page_choice_func+0xfa>
+  80281d:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  80281f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802826:	c1 e9 0c             	shr    $0xc,%ecx
+  802829:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80282c:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802833:	89 fb                	mov    %edi,%ebx
+  802835:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802838:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80283b:	db 45 e0             	fildl  -0x20(%ebp)
+  80283e:	d8 35 3c 58 80 00    	fdivs  0x80583c
+	return ret*ret;
+  802844:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802846:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802849:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80284c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80284f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802856:	df 6d e0             	fildll -0x20(%ebp)
+  802859:	d9 c1                	fld    %st(1)
+  80285b:	d8 0d 40 58 80 00    	fmuls  0x805840
+  802861:	d9 c9                	fxch   %st(1)
+  802863:	df f1                	fcomip %st(1),%st
+  802865:	dd d8                	fstp   %st(0)
+  802867:	0f 82 ed fe ff ff    	jb     80275a <nfu_with_aging_page_choice_func+0x35>
+  80286d:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  80286f:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  802874:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802877:	c1 e0 0c             	shl    $0xc,%eax
+  80287a:	eb 0e                	jmp    80288a <nfu_with_aging_page_choice_func+0x165>
+  80287c:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  80287e:	89 f8                	mov    %edi,%eax
+  802880:	3c ff                	cmp    $0xff,%al
+  802882:	74 0e                	je     802892 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802884:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802887:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80288a:	83 c4 14             	add    $0x14,%esp
+  80288d:	5b                   	pop    %ebx
+  80288e:	5e                   	pop    %esi
+  80288f:	5f                   	pop    %edi
+  802890:	5d                   	pop    %ebp
+  802891:	c3                   	ret
+	pgnum = 0;
+  802892:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  802899:	00 00 00 
+	return (void*)UTOP;
+  80289c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8028a1:	eb e7                	jmp    80288a <nfu_with_aging_page_choice_func+0x165>
+
+008028a3 <myRand>:
+    state = state * 1664525 + 1013904223;
+  8028a3:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  8028aa:	66 19 00 
+  8028ad:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  8028b2:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  8028b7:	c1 e8 18             	shr    $0x18,%eax
+}
+  8028ba:	c3                   	ret
+
+008028bb <random_page_choice_func>:
+{
+  8028bb:	55                   	push   %ebp
+  8028bc:	89 e5                	mov    %esp,%ebp
+  8028be:	57                   	push   %edi
+  8028bf:	56                   	push   %esi
+  8028c0:	53                   	push   %ebx
+  8028c1:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8028c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8028c9:	eb 19                	jmp    8028e4 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8028cb:	f7 d3                	not    %ebx
+  8028cd:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8028d3:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8028d5:	83 c6 01             	add    $0x1,%esi
+  8028d8:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8028de:	0f 87 a0 00 00 00    	ja     802984 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8028e4:	89 f3                	mov    %esi,%ebx
+  8028e6:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  8028ec:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8028f2:	89 d8                	mov    %ebx,%eax
+  8028f4:	c1 e8 0a             	shr    $0xa,%eax
+  8028f7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8028fe:	25 81 00 00 00       	and    $0x81,%eax
+  802903:	83 f8 01             	cmp    $0x1,%eax
+  802906:	75 c3                	jne    8028cb <random_page_choice_func+0x10>
+  802908:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80290e:	77 bb                	ja     8028cb <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802910:	89 df                	mov    %ebx,%edi
+  802912:	c1 e7 0c             	shl    $0xc,%edi
+  802915:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802918:	89 f8                	mov    %edi,%eax
+  80291a:	e8 06 f9 ff ff       	call   802225 <page_is_clean>
+  80291f:	84 c0                	test   %al,%al
+  802921:	0f 85 82 00 00 00    	jne    8029a9 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802927:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  80292d:	72 a6                	jb     8028d5 <random_page_choice_func+0x1a>
+  80292f:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802935:	77 9e                	ja     8028d5 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802937:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80293e:	a8 01                	test   $0x1,%al
+  802940:	74 93                	je     8028d5 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802942:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802949:	f6 c4 04             	test   $0x4,%ah
+  80294c:	75 87                	jne    8028d5 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80294e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802955:	f6 c4 02             	test   $0x2,%ah
+  802958:	0f 85 77 ff ff ff    	jne    8028d5 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80295e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802965:	c1 e8 0c             	shr    $0xc,%eax
+  802968:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80296b:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802970:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802974:	66 83 f8 01          	cmp    $0x1,%ax
+  802978:	0f 87 57 ff ff ff    	ja     8028d5 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  80297e:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802984:	e8 1a ff ff ff       	call   8028a3 <myRand>
+  802989:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  80298f:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  802994:	29 fe                	sub    %edi,%esi
+  802996:	0f be c0             	movsbl %al,%eax
+  802999:	ba 00 00 00 00       	mov    $0x0,%edx
+  80299e:	f7 f6                	div    %esi
+  8029a0:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8029a2:	bb 15 00 00 00       	mov    $0x15,%ebx
+  8029a7:	eb 1c                	jmp    8029c5 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  8029a9:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  8029af:	e9 8f 00 00 00       	jmp    802a43 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8029b4:	e8 ea fe ff ff       	call   8028a3 <myRand>
+  8029b9:	0f be c0             	movsbl %al,%eax
+  8029bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029c1:	f7 f6                	div    %esi
+  8029c3:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8029c5:	83 eb 01             	sub    $0x1,%ebx
+  8029c8:	0f 84 c2 00 00 00    	je     802a90 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  8029ce:	89 d0                	mov    %edx,%eax
+  8029d0:	c1 e8 0a             	shr    $0xa,%eax
+  8029d3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8029da:	25 81 00 00 00       	and    $0x81,%eax
+  8029df:	83 f8 01             	cmp    $0x1,%eax
+  8029e2:	75 d0                	jne    8029b4 <random_page_choice_func+0xf9>
+  8029e4:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  8029ea:	77 c8                	ja     8029b4 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  8029ec:	89 d0                	mov    %edx,%eax
+  8029ee:	c1 e0 0c             	shl    $0xc,%eax
+  8029f1:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  8029f6:	72 56                	jb     802a4e <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8029f8:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  8029fd:	77 65                	ja     802a64 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8029ff:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a06:	f6 c1 01             	test   $0x1,%cl
+  802a09:	74 59                	je     802a64 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802a0b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802a12:	f6 c5 04             	test   $0x4,%ch
+  802a15:	75 4d                	jne    802a64 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  802a17:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802a1e:	f6 c5 02             	test   $0x2,%ch
+  802a21:	75 41                	jne    802a64 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  802a23:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802a2a:	c1 ea 0c             	shr    $0xc,%edx
+  802a2d:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  802a30:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  802a36:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  802a3a:	66 83 fa 01          	cmp    $0x1,%dx
+  802a3e:	77 3a                	ja     802a7a <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  802a40:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  802a43:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a46:	83 c4 1c             	add    $0x1c,%esp
+  802a49:	5b                   	pop    %ebx
+  802a4a:	5e                   	pop    %esi
+  802a4b:	5f                   	pop    %edi
+  802a4c:	5d                   	pop    %ebp
+  802a4d:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802a4e:	e8 50 fe ff ff       	call   8028a3 <myRand>
+  802a53:	0f be c0             	movsbl %al,%eax
+  802a56:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a5b:	f7 f6                	div    %esi
+  802a5d:	01 fa                	add    %edi,%edx
+			continue;
+  802a5f:	e9 61 ff ff ff       	jmp    8029c5 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802a64:	e8 3a fe ff ff       	call   8028a3 <myRand>
+  802a69:	0f be c0             	movsbl %al,%eax
+  802a6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a71:	f7 f6                	div    %esi
+  802a73:	01 fa                	add    %edi,%edx
+			continue;
+  802a75:	e9 4b ff ff ff       	jmp    8029c5 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802a7a:	e8 24 fe ff ff       	call   8028a3 <myRand>
+  802a7f:	0f be c0             	movsbl %al,%eax
+  802a82:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a87:	f7 f6                	div    %esi
+  802a89:	01 fa                	add    %edi,%edx
+			continue;
+  802a8b:	e9 35 ff ff ff       	jmp    8029c5 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  802a90:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  802a97:	00 00 00 
+	return (void*)UTOP;
+  802a9a:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  802aa1:	eb a0                	jmp    802a43 <random_page_choice_func+0x188>
+
+00802aa3 <nfu>:
+{
+  802aa3:	55                   	push   %ebp
+  802aa4:	89 e5                	mov    %esp,%ebp
+  802aa6:	57                   	push   %edi
+  802aa7:	56                   	push   %esi
+  802aa8:	53                   	push   %ebx
+  802aa9:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802aac:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  802ab2:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802ab4:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802ab9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802abe:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802ac5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aca:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802acd:	eb 18                	jmp    802ae7 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802acf:	f7 d0                	not    %eax
+  802ad1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802ad6:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802ad8:	83 c2 01             	add    $0x1,%edx
+  802adb:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802ae1:	0f 87 13 01 00 00    	ja     802bfa <nfu+0x157>
+		++num_searched_ptes;
+  802ae7:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802aeb:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802aee:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802af3:	89 c1                	mov    %eax,%ecx
+  802af5:	c1 e9 0a             	shr    $0xa,%ecx
+  802af8:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802aff:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802b05:	83 f9 01             	cmp    $0x1,%ecx
+  802b08:	75 c5                	jne    802acf <nfu+0x2c>
+  802b0a:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802b0f:	77 be                	ja     802acf <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802b11:	89 c1                	mov    %eax,%ecx
+  802b13:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b16:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802b1c:	0f 82 a5 00 00 00    	jb     802bc7 <nfu+0x124>
+  802b22:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802b28:	0f 87 99 00 00 00    	ja     802bc7 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b2e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b35:	f6 c1 01             	test   $0x1,%cl
+  802b38:	0f 84 89 00 00 00    	je     802bc7 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802b3e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b45:	f6 c5 04             	test   $0x4,%ch
+  802b48:	75 7d                	jne    802bc7 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802b4a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802b51:	f6 c5 02             	test   $0x2,%ch
+  802b54:	75 71                	jne    802bc7 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802b56:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b5d:	c1 e9 0c             	shr    $0xc,%ecx
+  802b60:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b63:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802b69:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802b6d:	66 83 f9 01          	cmp    $0x1,%cx
+  802b71:	77 54                	ja     802bc7 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  802b73:	89 f9                	mov    %edi,%ecx
+  802b75:	80 f9 ff             	cmp    $0xff,%cl
+  802b78:	74 21                	je     802b9b <nfu+0xf8>
+  802b7a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b81:	c1 e9 0c             	shr    $0xc,%ecx
+  802b84:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b87:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802b8d:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  802b91:	89 fb                	mov    %edi,%ebx
+  802b93:	38 d9                	cmp    %bl,%cl
+  802b95:	73 30                	jae    802bc7 <nfu+0x124>
+  802b97:	dd d8                	fstp   %st(0)
+  802b99:	eb 02                	jmp    802b9d <nfu+0xfa>
+  802b9b:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  802b9d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802ba4:	c1 e9 0c             	shr    $0xc,%ecx
+  802ba7:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802baa:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802bb1:	89 fb                	mov    %edi,%ebx
+  802bb3:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802bb6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802bb9:	db 45 e0             	fildl  -0x20(%ebp)
+  802bbc:	d8 35 3c 58 80 00    	fdivs  0x80583c
+	return ret*ret;
+  802bc2:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802bc4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802bc7:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802bca:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802bcd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802bd4:	df 6d e0             	fildll -0x20(%ebp)
+  802bd7:	d9 c1                	fld    %st(1)
+  802bd9:	d8 0d 40 58 80 00    	fmuls  0x805840
+  802bdf:	d9 c9                	fxch   %st(1)
+  802be1:	df f1                	fcomip %st(1),%st
+  802be3:	dd d8                	fstp   %st(0)
+  802be5:	0f 82 ed fe ff ff    	jb     802ad8 <nfu+0x35>
+  802beb:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802bed:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  802bf2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802bf5:	c1 e0 0c             	shl    $0xc,%eax
+  802bf8:	eb 0e                	jmp    802c08 <nfu+0x165>
+  802bfa:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802bfc:	89 f8                	mov    %edi,%eax
+  802bfe:	3c ff                	cmp    $0xff,%al
+  802c00:	74 0e                	je     802c10 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802c02:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802c05:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802c08:	83 c4 14             	add    $0x14,%esp
+  802c0b:	5b                   	pop    %ebx
+  802c0c:	5e                   	pop    %esi
+  802c0d:	5f                   	pop    %edi
+  802c0e:	5d                   	pop    %ebp
+  802c0f:	c3                   	ret
+	pgnum = 0;
+  802c10:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  802c17:	00 00 00 
+	return (void*)UTOP;
+  802c1a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802c1f:	eb e7                	jmp    802c08 <nfu+0x165>
+
+00802c21 <lru>:
+{
+  802c21:	55                   	push   %ebp
+  802c22:	89 e5                	mov    %esp,%ebp
+  802c24:	57                   	push   %edi
+  802c25:	56                   	push   %esi
+  802c26:	53                   	push   %ebx
+  802c27:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c2a:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  802c30:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  802c37:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802c3e:	be 00 00 00 00       	mov    $0x0,%esi
+  802c43:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c4f:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  802c52:	eb 18                	jmp    802c6c <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802c54:	f7 d0                	not    %eax
+  802c56:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802c5b:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c5d:	83 c2 01             	add    $0x1,%edx
+  802c60:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802c66:	0f 87 fa 00 00 00    	ja     802d66 <lru+0x145>
+		++num_searched_ptes;
+  802c6c:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c6f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802c72:	01 d0                	add    %edx,%eax
+  802c74:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802c79:	89 c1                	mov    %eax,%ecx
+  802c7b:	c1 e9 0a             	shr    $0xa,%ecx
+  802c7e:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802c85:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802c8b:	83 f9 01             	cmp    $0x1,%ecx
+  802c8e:	75 c4                	jne    802c54 <lru+0x33>
+  802c90:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802c95:	77 bd                	ja     802c54 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802c97:	89 c1                	mov    %eax,%ecx
+  802c99:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802c9c:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802ca2:	0f 87 92 00 00 00    	ja     802d3a <lru+0x119>
+  802ca8:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802cae:	0f 82 86 00 00 00    	jb     802d3a <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802cb4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802cbb:	f6 c1 01             	test   $0x1,%cl
+  802cbe:	74 7a                	je     802d3a <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802cc0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802cc7:	f6 c5 04             	test   $0x4,%ch
+  802cca:	75 6e                	jne    802d3a <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802ccc:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802cd3:	f6 c5 02             	test   $0x2,%ch
+  802cd6:	75 62                	jne    802d3a <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802cd8:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802cdf:	c1 e9 0c             	shr    $0xc,%ecx
+  802ce2:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802ce5:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802ceb:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802cef:	66 83 f9 01          	cmp    $0x1,%cx
+  802cf3:	77 45                	ja     802d3a <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  802cf5:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802cfc:	c1 e9 0c             	shr    $0xc,%ecx
+  802cff:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d02:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d08:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802d0b:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802d0e:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  802d11:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802d14:	19 df                	sbb    %ebx,%edi
+  802d16:	7c 22                	jl     802d3a <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  802d18:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d1f:	c1 e9 0c             	shr    $0xc,%ecx
+  802d22:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d25:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d2b:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802d2e:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802d31:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802d34:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d37:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802d3a:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  802d3d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802d44:	df 6d e0             	fildll -0x20(%ebp)
+  802d47:	d9 05 40 58 80 00    	flds   0x805840
+  802d4d:	d9 c9                	fxch   %st(1)
+  802d4f:	df f1                	fcomip %st(1),%st
+  802d51:	dd d8                	fstp   %st(0)
+  802d53:	0f 82 04 ff ff ff    	jb     802c5d <lru+0x3c>
+			pgnum = pgnum_actual;
+  802d59:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  802d5e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d61:	c1 e0 0c             	shl    $0xc,%eax
+  802d64:	eb 06                	jmp    802d6c <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  802d66:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d69:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802d6c:	83 c4 1c             	add    $0x1c,%esp
+  802d6f:	5b                   	pop    %ebx
+  802d70:	5e                   	pop    %esi
+  802d71:	5f                   	pop    %edi
+  802d72:	5d                   	pop    %ebp
+  802d73:	c3                   	ret
+
+00802d74 <set_page_choice_func>:
+{
+  802d74:	55                   	push   %ebp
+  802d75:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  802d77:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d7a:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  802d7f:	5d                   	pop    %ebp
+  802d80:	c3                   	ret
+
+00802d81 <get_page_choice>:
+{
+  802d81:	55                   	push   %ebp
+  802d82:	89 e5                	mov    %esp,%ebp
+  802d84:	57                   	push   %edi
+  802d85:	56                   	push   %esi
+  802d86:	53                   	push   %ebx
+  802d87:	83 ec 24             	sub    $0x24,%esp
+  802d8a:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d8d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  802d90:	57                   	push   %edi
+  802d91:	56                   	push   %esi
+  802d92:	ff 15 3c 60 80 00    	call   *0x80603c
+  802d98:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802d9a:	83 c4 10             	add    $0x10,%esp
+  802d9d:	eb 25                	jmp    802dc4 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  802d9f:	83 ec 08             	sub    $0x8,%esp
+  802da2:	c1 e0 16             	shl    $0x16,%eax
+  802da5:	50                   	push   %eax
+  802da6:	6a 00                	push   $0x0
+  802da8:	e8 ec e0 ff ff       	call   800e99 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802dad:	83 c4 10             	add    $0x10,%esp
+  802db0:	85 c0                	test   %eax,%eax
+  802db2:	75 43                	jne    802df7 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  802db4:	83 ec 08             	sub    $0x8,%esp
+  802db7:	57                   	push   %edi
+  802db8:	56                   	push   %esi
+  802db9:	ff 15 3c 60 80 00    	call   *0x80603c
+  802dbf:	89 c3                	mov    %eax,%ebx
+  802dc1:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802dc4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802dc7:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  802dcd:	0f 86 ae 00 00 00    	jbe    802e81 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802dd3:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  802dd8:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802ddf:	81 e2 81 00 00 00    	and    $0x81,%edx
+  802de5:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  802deb:	74 b2                	je     802d9f <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802ded:	83 c0 01             	add    $0x1,%eax
+  802df0:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  802df5:	75 e1                	jne    802dd8 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802df7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802dfa:	05 00 10 40 11       	add    $0x11401000,%eax
+  802dff:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802e04:	76 1f                	jbe    802e25 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  802e06:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  802e0b:	89 d8                	mov    %ebx,%eax
+  802e0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e10:	5b                   	pop    %ebx
+  802e11:	5e                   	pop    %esi
+  802e12:	5f                   	pop    %edi
+  802e13:	5d                   	pop    %ebp
+  802e14:	c3                   	ret
+		sys_page_split(0, pg_out);
+  802e15:	83 ec 08             	sub    $0x8,%esp
+  802e18:	53                   	push   %ebx
+  802e19:	6a 00                	push   $0x0
+  802e1b:	e8 79 e0 ff ff       	call   800e99 <sys_page_split>
+  802e20:	83 c4 10             	add    $0x10,%esp
+  802e23:	eb 6c                	jmp    802e91 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  802e25:	83 ec 04             	sub    $0x4,%esp
+  802e28:	68 e8 53 80 00       	push   $0x8053e8
+  802e2d:	68 cc 01 00 00       	push   $0x1cc
+  802e32:	68 55 53 80 00       	push   $0x805355
+  802e37:	e8 e1 d3 ff ff       	call   80021d <_panic>
+		panic("We tried to page out code pages\n");
+  802e3c:	83 ec 04             	sub    $0x4,%esp
+  802e3f:	68 18 54 80 00       	push   $0x805418
+  802e44:	68 d6 01 00 00       	push   $0x1d6
+  802e49:	68 55 53 80 00       	push   $0x805355
+  802e4e:	e8 ca d3 ff ff       	call   80021d <_panic>
+		panic("Invalid mapping for the va\n");
+  802e53:	83 ec 04             	sub    $0x4,%esp
+  802e56:	68 62 53 80 00       	push   $0x805362
+  802e5b:	68 da 01 00 00       	push   $0x1da
+  802e60:	68 55 53 80 00       	push   $0x805355
+  802e65:	e8 b3 d3 ff ff       	call   80021d <_panic>
+		panic("We tried to page out a shared page\n");
+  802e6a:	83 ec 04             	sub    $0x4,%esp
+  802e6d:	68 3c 54 80 00       	push   $0x80543c
+  802e72:	68 e0 01 00 00       	push   $0x1e0
+  802e77:	68 55 53 80 00       	push   $0x805355
+  802e7c:	e8 9c d3 ff ff       	call   80021d <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  802e81:	89 de                	mov    %ebx,%esi
+  802e83:	c1 ee 16             	shr    $0x16,%esi
+  802e86:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802e8d:	a8 80                	test   $0x80,%al
+  802e8f:	75 84                	jne    802e15 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802e91:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e94:	05 00 10 40 11       	add    $0x11401000,%eax
+  802e99:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802e9e:	76 85                	jbe    802e25 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  802ea0:	89 d8                	mov    %ebx,%eax
+  802ea2:	e8 7e f3 ff ff       	call   802225 <page_is_clean>
+  802ea7:	84 c0                	test   %al,%al
+  802ea9:	0f 85 5c ff ff ff    	jne    802e0b <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  802eaf:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  802eb6:	76 84                	jbe    802e3c <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  802eb8:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802ebf:	a8 01                	test   $0x1,%al
+  802ec1:	74 90                	je     802e53 <get_page_choice+0xd2>
+  802ec3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ec6:	c1 e8 0c             	shr    $0xc,%eax
+  802ec9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802ed0:	f6 c2 01             	test   $0x1,%dl
+  802ed3:	0f 84 7a ff ff ff    	je     802e53 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802ed9:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  802ee0:	f6 c2 01             	test   $0x1,%dl
+  802ee3:	74 85                	je     802e6a <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802ee5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802eec:	f6 c2 01             	test   $0x1,%dl
+  802eef:	0f 84 75 ff ff ff    	je     802e6a <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802ef5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802efc:	f6 c6 04             	test   $0x4,%dh
+  802eff:	0f 85 65 ff ff ff    	jne    802e6a <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  802f05:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802f0c:	f6 c6 02             	test   $0x2,%dh
+  802f0f:	0f 85 55 ff ff ff    	jne    802e6a <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  802f15:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f1c:	c1 e8 0c             	shr    $0xc,%eax
+  802f1f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802f22:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802f27:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802f2b:	66 83 f8 01          	cmp    $0x1,%ax
+  802f2f:	0f 86 d6 fe ff ff    	jbe    802e0b <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  802f35:	83 ec 04             	sub    $0x4,%esp
+  802f38:	68 60 54 80 00       	push   $0x805460
+  802f3d:	68 e2 01 00 00       	push   $0x1e2
+  802f42:	68 55 53 80 00       	push   $0x805355
+  802f47:	e8 d1 d2 ff ff       	call   80021d <_panic>
+
+00802f4c <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  802f4c:	55                   	push   %ebp
+  802f4d:	89 e5                	mov    %esp,%ebp
+  802f4f:	57                   	push   %edi
+  802f50:	56                   	push   %esi
+  802f51:	53                   	push   %ebx
+  802f52:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  802f55:	e8 e8 f6 ff ff       	call   802642 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  802f5a:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802f5f:	85 c0                	test   %eax,%eax
+  802f61:	74 41                	je     802fa4 <page_share_paged_out+0x58>
+  802f63:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  802f6a:	0f 84 fd 00 00 00    	je     80306d <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  802f70:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802f77:	00 00 00 
+  802f7a:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  802f81:	00 00 00 
+  802f84:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f89:	eb 2c                	jmp    802fb7 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802f8b:	83 c3 04             	add    $0x4,%ebx
+  802f8e:	39 f3                	cmp    %esi,%ebx
+  802f90:	74 1a                	je     802fac <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  802f92:	8b 03                	mov    (%ebx),%eax
+  802f94:	a8 01                	test   $0x1,%al
+  802f96:	74 f3                	je     802f8b <page_share_paged_out+0x3f>
+  802f98:	c1 e8 0c             	shr    $0xc,%eax
+  802f9b:	e8 2b f5 ff ff       	call   8024cb <page_share_slot>
+  802fa0:	85 c0                	test   %eax,%eax
+  802fa2:	79 e7                	jns    802f8b <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  802fa4:	83 c4 0c             	add    $0xc,%esp
+  802fa7:	5b                   	pop    %ebx
+  802fa8:	5e                   	pop    %esi
+  802fa9:	5f                   	pop    %edi
+  802faa:	5d                   	pop    %ebp
+  802fab:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  802fac:	83 c7 04             	add    $0x4,%edi
+  802faf:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  802fb5:	74 1b                	je     802fd2 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  802fb7:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  802fbc:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  802fbf:	f6 c3 01             	test   $0x1,%bl
+  802fc2:	74 e8                	je     802fac <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  802fc4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802fca:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  802fd0:	eb bc                	jmp    802f8e <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802fd2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fd7:	eb 11                	jmp    802fea <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  802fd9:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802fdf:	83 c3 01             	add    $0x1,%ebx
+  802fe2:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802fe8:	77 41                	ja     80302b <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  802fea:	89 d8                	mov    %ebx,%eax
+  802fec:	c1 e8 0a             	shr    $0xa,%eax
+  802fef:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802ff6:	25 81 00 00 00       	and    $0x81,%eax
+  802ffb:	83 f8 01             	cmp    $0x1,%eax
+  802ffe:	75 d9                	jne    802fd9 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803000:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803007:	25 81 00 00 00       	and    $0x81,%eax
+  80300c:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803011:	75 cc                	jne    802fdf <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803013:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80301a:	c1 e8 0c             	shr    $0xc,%eax
+  80301d:	e8 a9 f4 ff ff       	call   8024cb <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803022:	85 c0                	test   %eax,%eax
+  803024:	79 b9                	jns    802fdf <page_share_paged_out+0x93>
+  803026:	e9 79 ff ff ff       	jmp    802fa4 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80302b:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803032:	75 13                	jne    803047 <page_share_paged_out+0xfb>
+  803034:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80303b:	75 1d                	jne    80305a <page_share_paged_out+0x10e>
+	return 0;
+  80303d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803042:	e9 5d ff ff ff       	jmp    802fa4 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803047:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304c:	e8 46 f4 ff ff       	call   802497 <page_share_send>
+  803051:	85 c0                	test   %eax,%eax
+  803053:	79 df                	jns    803034 <page_share_paged_out+0xe8>
+  803055:	e9 4a ff ff ff       	jmp    802fa4 <page_share_paged_out+0x58>
+  80305a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80305f:	e8 33 f4 ff ff       	call   802497 <page_share_send>
+  803064:	85 c0                	test   %eax,%eax
+  803066:	79 d5                	jns    80303d <page_share_paged_out+0xf1>
+  803068:	e9 37 ff ff ff       	jmp    802fa4 <page_share_paged_out+0x58>
+		return 0;
+  80306d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803072:	e9 2d ff ff ff       	jmp    802fa4 <page_share_paged_out+0x58>
+
+00803077 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  803077:	55                   	push   %ebp
+  803078:	89 e5                	mov    %esp,%ebp
+  80307a:	56                   	push   %esi
+  80307b:	53                   	push   %ebx
+  80307c:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  80307f:	e8 be f5 ff ff       	call   802642 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  803084:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  803089:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803090:	0f 84 82 00 00 00    	je     803118 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  803096:	83 ec 0c             	sub    $0xc,%esp
+  803099:	68 00 10 00 00       	push   $0x1000
+  80309e:	e8 84 11 00 00       	call   804227 <malloc>
+  8030a3:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  8030a5:	83 c4 0c             	add    $0xc,%esp
+  8030a8:	6a 14                	push   $0x14
+  8030aa:	6a 00                	push   $0x0
+  8030ac:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8030af:	50                   	push   %eax
+  8030b0:	e8 7b d9 ff ff       	call   800a30 <memset>
+  8030b5:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  8030b8:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  8030bd:	83 ec 0c             	sub    $0xc,%esp
+  8030c0:	6a 07                	push   $0x7
+  8030c2:	6a 01                	push   $0x1
+  8030c4:	53                   	push   %ebx
+  8030c5:	6a 03                	push   $0x3
+  8030c7:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8030ce:	e8 b7 19 00 00       	call   804a8a <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  8030d3:	8b 03                	mov    (%ebx),%eax
+  8030d5:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  8030d8:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030db:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  8030de:	8b 43 08             	mov    0x8(%ebx),%eax
+  8030e1:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  8030e4:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8030e7:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  8030ea:	8b 43 10             	mov    0x10(%ebx),%eax
+  8030ed:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  8030f0:	83 c6 01             	add    $0x1,%esi
+  8030f3:	83 c4 20             	add    $0x20,%esp
+  8030f6:	83 fe 02             	cmp    $0x2,%esi
+  8030f9:	75 c2                	jne    8030bd <get_paging_stats+0x46>
+	}
+	*stats = total;
+  8030fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030fe:	89 03                	mov    %eax,(%ebx)
+  803100:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803103:	89 43 04             	mov    %eax,0x4(%ebx)
+  803106:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803109:	89 43 08             	mov    %eax,0x8(%ebx)
+  80310c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80310f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803112:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803115:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  803118:	89 d8                	mov    %ebx,%eax
+  80311a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80311d:	5b                   	pop    %ebx
+  80311e:	5e                   	pop    %esi
+  80311f:	5d                   	pop    %ebp
+  803120:	c3                   	ret
+
+00803121 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803121:	55                   	push   %ebp
+  803122:	89 e5                	mov    %esp,%ebp
+  803124:	53                   	push   %ebx
+  803125:	83 ec 10             	sub    $0x10,%esp
+  803128:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  80312b:	68 4c 4e 80 00       	push   $0x804e4c
+  803130:	e8 c3 d1 ff ff       	call   8002f8 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  803135:	83 c4 08             	add    $0x8,%esp
+  803138:	ff 33                	push   (%ebx)
+  80313a:	68 94 54 80 00       	push   $0x805494
+  80313f:	e8 b4 d1 ff ff       	call   8002f8 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  803144:	83 c4 08             	add    $0x8,%esp
+  803147:	ff 73 04             	push   0x4(%ebx)
+  80314a:	68 7e 53 80 00       	push   $0x80537e
+  80314f:	e8 a4 d1 ff ff       	call   8002f8 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  803154:	83 c4 08             	add    $0x8,%esp
+  803157:	ff 73 08             	push   0x8(%ebx)
+  80315a:	68 b4 54 80 00       	push   $0x8054b4
+  80315f:	e8 94 d1 ff ff       	call   8002f8 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  803164:	83 c4 08             	add    $0x8,%esp
+  803167:	ff 73 0c             	push   0xc(%ebx)
+  80316a:	68 d8 54 80 00       	push   $0x8054d8
+  80316f:	e8 84 d1 ff ff       	call   8002f8 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  803174:	83 c4 08             	add    $0x8,%esp
+  803177:	ff 73 10             	push   0x10(%ebx)
+  80317a:	68 fc 54 80 00       	push   $0x8054fc
+  80317f:	e8 74 d1 ff ff       	call   8002f8 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  803184:	83 c4 08             	add    $0x8,%esp
+  803187:	ff 35 08 b0 80 00    	push   0x80b008
+  80318d:	68 38 55 80 00       	push   $0x805538
+  803192:	e8 61 d1 ff ff       	call   8002f8 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  803197:	83 c4 08             	add    $0x8,%esp
+  80319a:	ff 35 04 b0 80 00    	push   0x80b004
+  8031a0:	68 6c 55 80 00       	push   $0x80556c
+  8031a5:	e8 4e d1 ff ff       	call   8002f8 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  8031aa:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8031af:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  8031b2:	8b 50 68             	mov    0x68(%eax),%edx
+  8031b5:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  8031b8:	51                   	push   %ecx
+  8031b9:	52                   	push   %edx
+  8031ba:	50                   	push   %eax
+  8031bb:	68 ac 55 80 00       	push   $0x8055ac
+  8031c0:	e8 33 d1 ff ff       	call   8002f8 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  8031c5:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8031ca:	8b 40 70             	mov    0x70(%eax),%eax
+  8031cd:	83 c4 18             	add    $0x18,%esp
+  8031d0:	50                   	push   %eax
+  8031d1:	68 e0 55 80 00       	push   $0x8055e0
+  8031d6:	e8 1d d1 ff ff       	call   8002f8 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  8031db:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  8031e1:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  8031e7:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  8031ec:	51                   	push   %ecx
+  8031ed:	52                   	push   %edx
+  8031ee:	50                   	push   %eax
+  8031ef:	68 10 56 80 00       	push   $0x805610
+  8031f4:	e8 ff d0 ff ff       	call   8002f8 <cprintf>
+	cprintf("\n");
+  8031f9:	83 c4 14             	add    $0x14,%esp
+  8031fc:	68 4c 4e 80 00       	push   $0x804e4c
+  803201:	e8 f2 d0 ff ff       	call   8002f8 <cprintf>
+}
+  803206:	83 c4 10             	add    $0x10,%esp
+  803209:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80320c:	c9                   	leave
+  80320d:	c3                   	ret
+
+0080320e <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  80320e:	55                   	push   %ebp
+  80320f:	89 e5                	mov    %esp,%ebp
+  803211:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  803214:	e8 5e fe ff ff       	call   803077 <get_paging_stats>
+  803219:	83 ec 0c             	sub    $0xc,%esp
+  80321c:	50                   	push   %eax
+  80321d:	e8 ff fe ff ff       	call   803121 <print_paging_stats>
+}
+  803222:	83 c4 10             	add    $0x10,%esp
+  803225:	c9                   	leave
+  803226:	c3                   	ret
+
+00803227 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803227:	55                   	push   %ebp
+  803228:	89 e5                	mov    %esp,%ebp
+  80322a:	53                   	push   %ebx
+  80322b:	83 ec 04             	sub    $0x4,%esp
+  80322e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803231:	eb 13                	jmp    803246 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803233:	83 ec 04             	sub    $0x4,%esp
+  803236:	6a ff                	push   $0xffffffff
+  803238:	53                   	push   %ebx
+  803239:	68 00 f0 ff ee       	push   $0xeefff000
+  80323e:	e8 68 e0 ff ff       	call   8012ab <sys_futex_wait>
+  803243:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803246:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  80324b:	39 d8                	cmp    %ebx,%eax
+  80324d:	74 e4                	je     803233 <mem_pressure_wait+0xc>
+	return now;
+}
+  80324f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803252:	c9                   	leave
+  803253:	c3                   	ret
+
+00803254 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803254:	55                   	push   %ebp
+  803255:	89 e5                	mov    %esp,%ebp
+  803257:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  80325a:	68 c6 3e 80 00       	push   $0x803ec6
+  80325f:	e8 32 16 00 00       	call   804896 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803264:	c7 05 14 e9 80 00 00 	movl   $0xdeadb000,0x80e914
+  80326b:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  80326e:	83 c4 0c             	add    $0xc,%esp
+  803271:	68 07 02 00 00       	push   $0x207
+  803276:	68 00 b0 ad de       	push   $0xdeadb000
+  80327b:	6a 00                	push   $0x0
+  80327d:	e8 50 db ff ff       	call   800dd2 <sys_page_alloc>
+  803282:	83 c4 10             	add    $0x10,%esp
+  803285:	85 c0                	test   %eax,%eax
+  803287:	78 0c                	js     803295 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  803289:	e8 b4 f3 ff ff       	call   802642 <find_paging_env>
+	page_ring_ready();
+  80328e:	e8 7f f2 ff ff       	call   802512 <page_ring_ready>
+}
+  803293:	c9                   	leave
+  803294:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  803295:	50                   	push   %eax
+  803296:	68 9c 53 80 00       	push   $0x80539c
+  80329b:	68 13 05 00 00       	push   $0x513
+  8032a0:	68 55 53 80 00       	push   $0x805355
+  8032a5:	e8 73 cf ff ff       	call   80021d <_panic>
+
+008032aa <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  8032aa:	55                   	push   %ebp
+  8032ab:	89 e5                	mov    %esp,%ebp
+  8032ad:	57                   	push   %edi
+  8032ae:	56                   	push   %esi
+  8032af:	53                   	push   %ebx
+  8032b0:	83 ec 0c             	sub    $0xc,%esp
+  8032b3:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  8032b6:	89 fa                	mov    %edi,%edx
+  8032b8:	c1 ea 16             	shr    $0x16,%edx
+  8032bb:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8032c0:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  8032c3:	f6 06 01             	testb  $0x1,(%esi)
+  8032c6:	75 3e                	jne    803306 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  8032c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  8032cd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8032d1:	74 47                	je     80331a <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  8032d3:	83 ec 0c             	sub    $0xc,%esp
+  8032d6:	6a 01                	push   $0x1
+  8032d8:	e8 f2 11 00 00       	call   8044cf <va_alloc>
+  8032dd:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  8032df:	83 c4 10             	add    $0x10,%esp
+  8032e2:	85 c0                	test   %eax,%eax
+  8032e4:	74 34                	je     80331a <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  8032e6:	6a 00                	push   $0x0
+  8032e8:	68 07 02 00 00       	push   $0x207
+  8032ed:	50                   	push   %eax
+  8032ee:	6a 00                	push   $0x0
+  8032f0:	e8 df 02 00 00       	call   8035d4 <page_alloc>
+  8032f5:	83 c4 10             	add    $0x10,%esp
+  8032f8:	85 c0                	test   %eax,%eax
+  8032fa:	78 28                	js     803324 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  8032fc:	f6 06 01             	testb  $0x1,(%esi)
+  8032ff:	75 38                	jne    803339 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803301:	83 cb 01             	or     $0x1,%ebx
+  803304:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803306:	89 f8                	mov    %edi,%eax
+  803308:	c1 e8 0a             	shr    $0xa,%eax
+  80330b:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803310:	8b 1e                	mov    (%esi),%ebx
+  803312:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803318:	01 c3                	add    %eax,%ebx
+}
+  80331a:	89 d8                	mov    %ebx,%eax
+  80331c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80331f:	5b                   	pop    %ebx
+  803320:	5e                   	pop    %esi
+  803321:	5f                   	pop    %edi
+  803322:	5d                   	pop    %ebp
+  803323:	c3                   	ret
+			va_free(page, 1);
+  803324:	83 ec 08             	sub    $0x8,%esp
+  803327:	6a 01                	push   $0x1
+  803329:	53                   	push   %ebx
+  80332a:	e8 d8 12 00 00       	call   804607 <va_free>
+			return NULL;
+  80332f:	83 c4 10             	add    $0x10,%esp
+  803332:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803337:	eb e1                	jmp    80331a <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  803339:	83 ec 08             	sub    $0x8,%esp
+  80333c:	53                   	push   %ebx
+  80333d:	6a 00                	push   $0x0
+  80333f:	e8 13 db ff ff       	call   800e57 <sys_page_unmap>
+			va_free(page, 1);
+  803344:	83 c4 08             	add    $0x8,%esp
+  803347:	6a 01                	push   $0x1
+  803349:	53                   	push   %ebx
+  80334a:	e8 b8 12 00 00       	call   804607 <va_free>
+  80334f:	83 c4 10             	add    $0x10,%esp
+  803352:	eb b2                	jmp    803306 <umapdir_walk+0x5c>
+
+00803354 <page_out>:
+{
+  803354:	55                   	push   %ebp
+  803355:	89 e5                	mov    %esp,%ebp
+  803357:	57                   	push   %edi
+  803358:	56                   	push   %esi
+  803359:	53                   	push   %ebx
+  80335a:	83 ec 5c             	sub    $0x5c,%esp
+  80335d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803360:	e8 dd f2 ff ff       	call   802642 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803365:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80336a:	85 c0                	test   %eax,%eax
+  80336c:	74 1e                	je     80338c <page_out+0x38>
+  80336e:	83 ec 0c             	sub    $0xc,%esp
+  803371:	6a 00                	push   $0x0
+  803373:	6a 00                	push   $0x0
+  803375:	6a 00                	push   $0x0
+  803377:	6a 08                	push   $0x8
+  803379:	50                   	push   %eax
+  80337a:	e8 0b 17 00 00       	call   804a8a <ipc_call>
+  80337f:	89 c3                	mov    %eax,%ebx
+  803381:	83 c4 20             	add    $0x20,%esp
+  803384:	85 c0                	test   %eax,%eax
+  803386:	0f 84 ac 00 00 00    	je     803438 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  80338c:	83 ec 08             	sub    $0x8,%esp
+  80338f:	ff 75 0c             	push   0xc(%ebp)
+  803392:	57                   	push   %edi
+  803393:	e8 e9 f9 ff ff       	call   802d81 <get_page_choice>
+  803398:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  80339a:	83 c4 10             	add    $0x10,%esp
+  80339d:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8033a2:	0f 84 18 02 00 00    	je     8035c0 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  8033a8:	e8 78 ee ff ff       	call   802225 <page_is_clean>
+  8033ad:	84 c0                	test   %al,%al
+  8033af:	0f 85 8c 00 00 00    	jne    803441 <page_out+0xed>
+	if (pagingenv == 0)
+  8033b5:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8033bc:	0f 84 08 02 00 00    	je     8035ca <page_out+0x276>
+	if (page_ring_ready())
+  8033c2:	e8 4b f1 ff ff       	call   802512 <page_ring_ready>
+  8033c7:	89 c3                	mov    %eax,%ebx
+  8033c9:	85 c0                	test   %eax,%eax
+  8033cb:	0f 85 89 00 00 00    	jne    80345a <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  8033d1:	83 ec 0c             	sub    $0xc,%esp
+  8033d4:	6a 05                	push   $0x5
+  8033d6:	6a 01                	push   $0x1
+  8033d8:	56                   	push   %esi
+  8033d9:	6a 01                	push   $0x1
+  8033db:	ff 35 40 b0 80 00    	push   0x80b040
+  8033e1:	e8 a4 16 00 00       	call   804a8a <ipc_call>
+  8033e6:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  8033e8:	83 c4 20             	add    $0x20,%esp
+  8033eb:	85 c0                	test   %eax,%eax
+  8033ed:	0f 88 b8 01 00 00    	js     8035ab <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  8033f3:	89 f0                	mov    %esi,%eax
+  8033f5:	c1 e8 0c             	shr    $0xc,%eax
+  8033f8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8033ff:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803402:	83 ec 08             	sub    $0x8,%esp
+  803405:	56                   	push   %esi
+  803406:	6a 00                	push   $0x0
+  803408:	e8 4a da ff ff       	call   800e57 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  80340d:	83 c4 08             	add    $0x8,%esp
+  803410:	6a 01                	push   $0x1
+  803412:	56                   	push   %esi
+  803413:	e8 92 fe ff ff       	call   8032aa <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803418:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  80341b:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803421:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803424:	09 fe                	or     %edi,%esi
+  803426:	83 ce 01             	or     $0x1,%esi
+  803429:	89 30                	mov    %esi,(%eax)
+	return 0;
+  80342b:	83 c4 10             	add    $0x10,%esp
+}
+  80342e:	89 d8                	mov    %ebx,%eax
+  803430:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803433:	5b                   	pop    %ebx
+  803434:	5e                   	pop    %esi
+  803435:	5f                   	pop    %edi
+  803436:	5d                   	pop    %ebp
+  803437:	c3                   	ret
+		num_page_reclaims++;
+  803438:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  80343f:	eb ed                	jmp    80342e <page_out+0xda>
+		num_page_drops++;
+  803441:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  803448:	83 ec 08             	sub    $0x8,%esp
+  80344b:	56                   	push   %esi
+  80344c:	6a 00                	push   $0x0
+  80344e:	e8 04 da ff ff       	call   800e57 <sys_page_unmap>
+  803453:	89 c3                	mov    %eax,%ebx
+  803455:	83 c4 10             	add    $0x10,%esp
+  803458:	eb d4                	jmp    80342e <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80345a:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  80345c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803461:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803466:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803469:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  80346b:	83 c0 08             	add    $0x8,%eax
+  80346e:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803471:	b8 07 00 00 00       	mov    $0x7,%eax
+  803476:	e8 e5 ef ff ff       	call   802460 <page_ring_reserve>
+	first = ring->sq_tail;
+  80347b:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803480:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803483:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803488:	83 ec 04             	sub    $0x4,%esp
+  80348b:	68 00 10 00 00       	push   $0x1000
+  803490:	56                   	push   %esi
+  803491:	89 d8                	mov    %ebx,%eax
+  803493:	c1 e0 0c             	shl    $0xc,%eax
+  803496:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  80349b:	50                   	push   %eax
+  80349c:	e8 26 d6 ff ff       	call   800ac7 <memcpy>
+		vas[n] = va;
+  8034a1:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  8034a5:	89 d9                	mov    %ebx,%ecx
+  8034a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034b1:	e8 de ee ff ff       	call   802394 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  8034b6:	8d 43 01             	lea    0x1(%ebx),%eax
+  8034b9:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  8034bc:	83 c4 10             	add    $0x10,%esp
+  8034bf:	83 fb 06             	cmp    $0x6,%ebx
+  8034c2:	74 62                	je     803526 <page_out+0x1d2>
+  8034c4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8034c7:	eb 15                	jmp    8034de <page_out+0x18a>
+			num_page_drops++;
+  8034c9:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  8034d0:	83 ec 08             	sub    $0x8,%esp
+  8034d3:	56                   	push   %esi
+  8034d4:	6a 00                	push   $0x0
+  8034d6:	e8 7c d9 ff ff       	call   800e57 <sys_page_unmap>
+  8034db:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  8034de:	83 ec 08             	sub    $0x8,%esp
+  8034e1:	53                   	push   %ebx
+  8034e2:	57                   	push   %edi
+  8034e3:	e8 99 f8 ff ff       	call   802d81 <get_page_choice>
+  8034e8:	89 c6                	mov    %eax,%esi
+  8034ea:	83 c4 10             	add    $0x10,%esp
+  8034ed:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8034f2:	74 32                	je     803526 <page_out+0x1d2>
+  8034f4:	e8 2c ed ff ff       	call   802225 <page_is_clean>
+  8034f9:	84 c0                	test   %al,%al
+  8034fb:	75 cc                	jne    8034c9 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  8034fd:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803500:	39 c6                	cmp    %eax,%esi
+  803502:	72 07                	jb     80350b <page_out+0x1b7>
+  803504:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803507:	39 c6                	cmp    %eax,%esi
+  803509:	72 1b                	jb     803526 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  80350b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803510:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803513:	eb 03                	jmp    803518 <page_out+0x1c4>
+  803515:	83 c3 01             	add    $0x1,%ebx
+  803518:	39 da                	cmp    %ebx,%edx
+  80351a:	0f 84 68 ff ff ff    	je     803488 <page_out+0x134>
+  803520:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803524:	75 ef                	jne    803515 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803526:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803529:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  80352c:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  80352f:	e8 a6 ee ff ff       	call   8023da <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803534:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803539:	eb 42                	jmp    80357d <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  80353b:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  80353f:	89 f8                	mov    %edi,%eax
+  803541:	c1 e8 0c             	shr    $0xc,%eax
+  803544:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80354b:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  80354e:	83 ec 08             	sub    $0x8,%esp
+  803551:	57                   	push   %edi
+  803552:	6a 00                	push   $0x0
+  803554:	e8 fe d8 ff ff       	call   800e57 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803559:	83 c4 08             	add    $0x8,%esp
+  80355c:	6a 01                	push   $0x1
+  80355e:	57                   	push   %edi
+  80355f:	e8 46 fd ff ff       	call   8032aa <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803564:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803567:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  80356d:	c1 e6 0c             	shl    $0xc,%esi
+  803570:	09 d6                	or     %edx,%esi
+  803572:	83 ce 01             	or     $0x1,%esi
+  803575:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803577:	83 c3 01             	add    $0x1,%ebx
+  80357a:	83 c4 10             	add    $0x10,%esp
+  80357d:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803580:	39 c3                	cmp    %eax,%ebx
+  803582:	74 1d                	je     8035a1 <page_out+0x24d>
+		if (res[i] < 0)
+  803584:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803588:	85 f6                	test   %esi,%esi
+  80358a:	79 af                	jns    80353b <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  80358c:	56                   	push   %esi
+  80358d:	68 40 56 80 00       	push   $0x805640
+  803592:	68 d1 02 00 00       	push   $0x2d1
+  803597:	68 55 53 80 00       	push   $0x805355
+  80359c:	e8 7c cc ff ff       	call   80021d <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  8035a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035a6:	e9 83 fe ff ff       	jmp    80342e <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  8035ab:	50                   	push   %eax
+  8035ac:	68 40 56 80 00       	push   $0x805640
+  8035b1:	68 0a 03 00 00       	push   $0x30a
+  8035b6:	68 55 53 80 00       	push   $0x805355
+  8035bb:	e8 5d cc ff ff       	call   80021d <_panic>
+		return -E_NO_MEM;
+  8035c0:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  8035c5:	e9 64 fe ff ff       	jmp    80342e <page_out+0xda>
+		return -E_PAGING;
+  8035ca:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8035cf:	e9 5a fe ff ff       	jmp    80342e <page_out+0xda>
+
+008035d4 <page_alloc>:
+{
+  8035d4:	55                   	push   %ebp
+  8035d5:	89 e5                	mov    %esp,%ebp
+  8035d7:	57                   	push   %edi
+  8035d8:	56                   	push   %esi
+  8035d9:	53                   	push   %ebx
+  8035da:	83 ec 0c             	sub    $0xc,%esp
+  8035dd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035e0:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  8035e3:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  8035ea:	74 34                	je     803620 <page_alloc+0x4c>
+	if (check_mte)
+  8035ec:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8035f0:	75 35                	jne    803627 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  8035f2:	83 ec 04             	sub    $0x4,%esp
+  8035f5:	ff 75 10             	push   0x10(%ebp)
+  8035f8:	56                   	push   %esi
+  8035f9:	57                   	push   %edi
+  8035fa:	e8 d3 d7 ff ff       	call   800dd2 <sys_page_alloc>
+  8035ff:	89 c3                	mov    %eax,%ebx
+  803601:	83 c4 10             	add    $0x10,%esp
+  803604:	85 c0                	test   %eax,%eax
+  803606:	79 52                	jns    80365a <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803608:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80360b:	75 52                	jne    80365f <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  80360d:	83 ec 08             	sub    $0x8,%esp
+  803610:	56                   	push   %esi
+  803611:	57                   	push   %edi
+  803612:	e8 3d fd ff ff       	call   803354 <page_out>
+  803617:	83 c4 10             	add    $0x10,%esp
+  80361a:	85 c0                	test   %eax,%eax
+  80361c:	79 d4                	jns    8035f2 <page_alloc+0x1e>
+  80361e:	eb 3f                	jmp    80365f <page_alloc+0x8b>
+		init_map_dir();
+  803620:	e8 2f fc ff ff       	call   803254 <init_map_dir>
+  803625:	eb c5                	jmp    8035ec <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803627:	83 ec 08             	sub    $0x8,%esp
+  80362a:	6a 00                	push   $0x0
+  80362c:	56                   	push   %esi
+  80362d:	e8 78 fc ff ff       	call   8032aa <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803632:	83 c4 10             	add    $0x10,%esp
+  803635:	85 c0                	test   %eax,%eax
+  803637:	74 b9                	je     8035f2 <page_alloc+0x1e>
+  803639:	8b 10                	mov    (%eax),%edx
+  80363b:	f6 c2 01             	test   $0x1,%dl
+  80363e:	74 b2                	je     8035f2 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803640:	83 ec 08             	sub    $0x8,%esp
+  803643:	56                   	push   %esi
+  803644:	52                   	push   %edx
+  803645:	50                   	push   %eax
+  803646:	68 64 56 80 00       	push   $0x805664
+  80364b:	68 34 03 00 00       	push   $0x334
+  803650:	68 55 53 80 00       	push   $0x805355
+  803655:	e8 c3 cb ff ff       	call   80021d <_panic>
+	return 0;
+  80365a:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80365f:	89 d8                	mov    %ebx,%eax
+  803661:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803664:	5b                   	pop    %ebx
+  803665:	5e                   	pop    %esi
+  803666:	5f                   	pop    %edi
+  803667:	5d                   	pop    %ebp
+  803668:	c3                   	ret
+
+00803669 <page_adopt>:
+{
+  803669:	55                   	push   %ebp
+  80366a:	89 e5                	mov    %esp,%ebp
+  80366c:	56                   	push   %esi
+  80366d:	53                   	push   %ebx
+  80366e:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803670:	c1 e8 16             	shr    $0x16,%eax
+  803673:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80367a:	25 81 00 00 00       	and    $0x81,%eax
+  80367f:	83 f8 01             	cmp    $0x1,%eax
+  803682:	75 53                	jne    8036d7 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803684:	89 d8                	mov    %ebx,%eax
+  803686:	c1 e8 0c             	shr    $0xc,%eax
+  803689:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803690:	89 f2                	mov    %esi,%edx
+  803692:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803698:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  80369d:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  8036a3:	75 37                	jne    8036dc <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  8036a5:	83 ec 08             	sub    $0x8,%esp
+  8036a8:	6a 01                	push   $0x1
+  8036aa:	53                   	push   %ebx
+  8036ab:	e8 fa fb ff ff       	call   8032aa <umapdir_walk>
+  8036b0:	83 c4 10             	add    $0x10,%esp
+  8036b3:	85 c0                	test   %eax,%eax
+  8036b5:	74 2c                	je     8036e3 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  8036b7:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  8036bd:	83 ce 01             	or     $0x1,%esi
+  8036c0:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  8036c2:	83 ec 08             	sub    $0x8,%esp
+  8036c5:	53                   	push   %ebx
+  8036c6:	6a 00                	push   $0x0
+  8036c8:	e8 8a d7 ff ff       	call   800e57 <sys_page_unmap>
+	return 1;
+  8036cd:	83 c4 10             	add    $0x10,%esp
+  8036d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036d5:	eb 05                	jmp    8036dc <page_adopt+0x73>
+		return 0;
+  8036d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036df:	5b                   	pop    %ebx
+  8036e0:	5e                   	pop    %esi
+  8036e1:	5d                   	pop    %ebp
+  8036e2:	c3                   	ret
+		return -E_NO_MEM;
+  8036e3:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8036e8:	eb f2                	jmp    8036dc <page_adopt+0x73>
+
+008036ea <page_forget>:
+{
+  8036ea:	55                   	push   %ebp
+  8036eb:	89 e5                	mov    %esp,%ebp
+  8036ed:	53                   	push   %ebx
+  8036ee:	83 ec 04             	sub    $0x4,%esp
+  8036f1:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  8036f3:	e8 4a ef ff ff       	call   802642 <find_paging_env>
+	if (pagingenv == 0)
+  8036f8:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8036ff:	74 39                	je     80373a <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803701:	89 d8                	mov    %ebx,%eax
+  803703:	c1 e8 16             	shr    $0x16,%eax
+  803706:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80370d:	25 81 00 00 00       	and    $0x81,%eax
+  803712:	83 f8 01             	cmp    $0x1,%eax
+  803715:	74 28                	je     80373f <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803717:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  80371e:	74 1a                	je     80373a <page_forget+0x50>
+  803720:	83 ec 08             	sub    $0x8,%esp
+  803723:	6a 00                	push   $0x0
+  803725:	53                   	push   %ebx
+  803726:	e8 7f fb ff ff       	call   8032aa <umapdir_walk>
+  80372b:	89 c3                	mov    %eax,%ebx
+  80372d:	83 c4 10             	add    $0x10,%esp
+  803730:	85 c0                	test   %eax,%eax
+  803732:	74 06                	je     80373a <page_forget+0x50>
+  803734:	8b 00                	mov    (%eax),%eax
+  803736:	a8 01                	test   $0x1,%al
+  803738:	75 2b                	jne    803765 <page_forget+0x7b>
+}
+  80373a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80373d:	c9                   	leave
+  80373e:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  80373f:	89 d8                	mov    %ebx,%eax
+  803741:	c1 e8 0c             	shr    $0xc,%eax
+  803744:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80374b:	89 c2                	mov    %eax,%edx
+  80374d:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803753:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803759:	75 bc                	jne    803717 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  80375b:	c1 e8 0c             	shr    $0xc,%eax
+  80375e:	e8 5c ee ff ff       	call   8025bf <page_remove_slot>
+		return;
+  803763:	eb d5                	jmp    80373a <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803765:	c1 e8 0c             	shr    $0xc,%eax
+  803768:	e8 52 ee ff ff       	call   8025bf <page_remove_slot>
+	*mte = 0;
+  80376d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803773:	eb c5                	jmp    80373a <page_forget+0x50>
+
+00803775 <page_unmap>:
+{
+  803775:	55                   	push   %ebp
+  803776:	89 e5                	mov    %esp,%ebp
+  803778:	57                   	push   %edi
+  803779:	56                   	push   %esi
+  80377a:	53                   	push   %ebx
+  80377b:	83 ec 0c             	sub    $0xc,%esp
+  80377e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803781:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803784:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803789:	8b 40 48             	mov    0x48(%eax),%eax
+  80378c:	85 db                	test   %ebx,%ebx
+  80378e:	0f 8e b4 00 00 00    	jle    803848 <page_unmap+0xd3>
+  803794:	39 d8                	cmp    %ebx,%eax
+  803796:	0f 84 ac 00 00 00    	je     803848 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  80379c:	83 ec 08             	sub    $0x8,%esp
+  80379f:	57                   	push   %edi
+  8037a0:	53                   	push   %ebx
+  8037a1:	e8 b1 d6 ff ff       	call   800e57 <sys_page_unmap>
+  8037a6:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  8037a8:	e8 95 ee ff ff       	call   802642 <find_paging_env>
+	if (pagingenv == 0)
+  8037ad:	83 c4 10             	add    $0x10,%esp
+  8037b0:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8037b7:	0f 84 a1 00 00 00    	je     80385e <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8037bd:	83 ec 0c             	sub    $0xc,%esp
+  8037c0:	6a 05                	push   $0x5
+  8037c2:	68 00 00 40 00       	push   $0x400000
+  8037c7:	6a 00                	push   $0x0
+  8037c9:	68 00 b0 ad de       	push   $0xdeadb000
+  8037ce:	53                   	push   %ebx
+  8037cf:	e8 41 d6 ff ff       	call   800e15 <sys_page_map>
+  8037d4:	83 c4 20             	add    $0x20,%esp
+  8037d7:	85 c0                	test   %eax,%eax
+  8037d9:	0f 88 89 00 00 00    	js     803868 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  8037df:	89 f8                	mov    %edi,%eax
+  8037e1:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8037e4:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  8037eb:	a8 01                	test   $0x1,%al
+  8037ed:	74 6f                	je     80385e <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8037ef:	83 ec 0c             	sub    $0xc,%esp
+  8037f2:	6a 05                	push   $0x5
+  8037f4:	68 00 00 40 00       	push   $0x400000
+  8037f9:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8037fb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803800:	50                   	push   %eax
+  803801:	53                   	push   %ebx
+  803802:	e8 0e d6 ff ff       	call   800e15 <sys_page_map>
+  803807:	83 c4 20             	add    $0x20,%esp
+  80380a:	85 c0                	test   %eax,%eax
+  80380c:	78 6f                	js     80387d <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  80380e:	c1 ef 0c             	shr    $0xc,%edi
+  803811:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803817:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  80381e:	01 
+  80381f:	74 3d                	je     80385e <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803821:	83 ec 08             	sub    $0x8,%esp
+  803824:	68 00 00 40 00       	push   $0x400000
+  803829:	6a 00                	push   $0x0
+  80382b:	e8 27 d6 ff ff       	call   800e57 <sys_page_unmap>
+  803830:	83 c4 10             	add    $0x10,%esp
+  803833:	85 c0                	test   %eax,%eax
+  803835:	78 5b                	js     803892 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803837:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  80383e:	c1 e8 0c             	shr    $0xc,%eax
+  803841:	e8 79 ed ff ff       	call   8025bf <page_remove_slot>
+	return r;
+  803846:	eb 16                	jmp    80385e <page_unmap+0xe9>
+		page_forget(va);
+  803848:	89 f8                	mov    %edi,%eax
+  80384a:	e8 9b fe ff ff       	call   8036ea <page_forget>
+		return sys_page_unmap(envid, va);
+  80384f:	83 ec 08             	sub    $0x8,%esp
+  803852:	57                   	push   %edi
+  803853:	53                   	push   %ebx
+  803854:	e8 fe d5 ff ff       	call   800e57 <sys_page_unmap>
+  803859:	89 c6                	mov    %eax,%esi
+  80385b:	83 c4 10             	add    $0x10,%esp
+}
+  80385e:	89 f0                	mov    %esi,%eax
+  803860:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803863:	5b                   	pop    %ebx
+  803864:	5e                   	pop    %esi
+  803865:	5f                   	pop    %edi
+  803866:	5d                   	pop    %ebp
+  803867:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803868:	50                   	push   %eax
+  803869:	68 a0 56 80 00       	push   $0x8056a0
+  80386e:	68 e4 03 00 00       	push   $0x3e4
+  803873:	68 55 53 80 00       	push   $0x805355
+  803878:	e8 a0 c9 ff ff       	call   80021d <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  80387d:	50                   	push   %eax
+  80387e:	68 cc 56 80 00       	push   $0x8056cc
+  803883:	68 ea 03 00 00       	push   $0x3ea
+  803888:	68 55 53 80 00       	push   $0x805355
+  80388d:	e8 8b c9 ff ff       	call   80021d <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803892:	50                   	push   %eax
+  803893:	68 f8 56 80 00       	push   $0x8056f8
+  803898:	68 ef 03 00 00       	push   $0x3ef
+  80389d:	68 55 53 80 00       	push   $0x805355
+  8038a2:	e8 76 c9 ff ff       	call   80021d <_panic>
+
+008038a7 <page_unmap_range>:
+{
+  8038a7:	55                   	push   %ebp
+  8038a8:	89 e5                	mov    %esp,%ebp
+  8038aa:	57                   	push   %edi
+  8038ab:	56                   	push   %esi
+  8038ac:	53                   	push   %ebx
+  8038ad:	83 ec 0c             	sub    $0xc,%esp
+  8038b0:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  8038b3:	e8 8a ed ff ff       	call   802642 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  8038b8:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8038bd:	8b 40 48             	mov    0x48(%eax),%eax
+  8038c0:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8038c4:	7e 38                	jle    8038fe <page_unmap_range+0x57>
+  8038c6:	3b 45 08             	cmp    0x8(%ebp),%eax
+  8038c9:	74 33                	je     8038fe <page_unmap_range+0x57>
+  8038cb:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8038d2:	74 2a                	je     8038fe <page_unmap_range+0x57>
+  8038d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  8038d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8038dc:	39 fe                	cmp    %edi,%esi
+  8038de:	74 56                	je     803936 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  8038e0:	83 ec 08             	sub    $0x8,%esp
+  8038e3:	53                   	push   %ebx
+  8038e4:	ff 75 08             	push   0x8(%ebp)
+  8038e7:	e8 89 fe ff ff       	call   803775 <page_unmap>
+  8038ec:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8038f2:	83 c4 10             	add    $0x10,%esp
+  8038f5:	85 c0                	test   %eax,%eax
+  8038f7:	78 35                	js     80392e <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  8038f9:	83 c6 01             	add    $0x1,%esi
+  8038fc:	eb de                	jmp    8038dc <page_unmap_range+0x35>
+  8038fe:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803901:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803906:	eb 10                	jmp    803918 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803908:	89 f0                	mov    %esi,%eax
+  80390a:	e8 db fd ff ff       	call   8036ea <page_forget>
+		for (i = 0; i < npages; i++)
+  80390f:	83 c3 01             	add    $0x1,%ebx
+  803912:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803918:	39 fb                	cmp    %edi,%ebx
+  80391a:	75 ec                	jne    803908 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  80391c:	83 ec 04             	sub    $0x4,%esp
+  80391f:	57                   	push   %edi
+  803920:	ff 75 0c             	push   0xc(%ebp)
+  803923:	ff 75 08             	push   0x8(%ebp)
+  803926:	e8 40 d6 ff ff       	call   800f6b <sys_page_unmap_range>
+  80392b:	83 c4 10             	add    $0x10,%esp
+}
+  80392e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803931:	5b                   	pop    %ebx
+  803932:	5e                   	pop    %esi
+  803933:	5f                   	pop    %edi
+  803934:	5d                   	pop    %ebp
+  803935:	c3                   	ret
+	return 0;
+  803936:	b8 00 00 00 00       	mov    $0x0,%eax
+  80393b:	eb f1                	jmp    80392e <page_unmap_range+0x87>
+
+0080393d <page_alloc_range>:
+{
+  80393d:	55                   	push   %ebp
+  80393e:	89 e5                	mov    %esp,%ebp
+  803940:	57                   	push   %edi
+  803941:	56                   	push   %esi
+  803942:	53                   	push   %ebx
+  803943:	83 ec 1c             	sub    $0x1c,%esp
+  803946:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803949:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  80394c:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803953:	74 14                	je     803969 <page_alloc_range+0x2c>
+	if (check_mte)
+  803955:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803959:	74 66                	je     8039c1 <page_alloc_range+0x84>
+  80395b:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  80395d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803962:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803965:	89 c7                	mov    %eax,%edi
+  803967:	eb 10                	jmp    803979 <page_alloc_range+0x3c>
+		init_map_dir();
+  803969:	e8 e6 f8 ff ff       	call   803254 <init_map_dir>
+  80396e:	eb e5                	jmp    803955 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803970:	83 c7 01             	add    $0x1,%edi
+  803973:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803979:	39 df                	cmp    %ebx,%edi
+  80397b:	74 38                	je     8039b5 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  80397d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803980:	83 ec 08             	sub    $0x8,%esp
+  803983:	6a 00                	push   $0x0
+  803985:	56                   	push   %esi
+  803986:	e8 1f f9 ff ff       	call   8032aa <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  80398b:	83 c4 10             	add    $0x10,%esp
+  80398e:	85 c0                	test   %eax,%eax
+  803990:	74 de                	je     803970 <page_alloc_range+0x33>
+  803992:	8b 10                	mov    (%eax),%edx
+  803994:	f6 c2 01             	test   $0x1,%dl
+  803997:	74 d7                	je     803970 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  803999:	83 ec 08             	sub    $0x8,%esp
+  80399c:	ff 75 e4             	push   -0x1c(%ebp)
+  80399f:	52                   	push   %edx
+  8039a0:	50                   	push   %eax
+  8039a1:	68 64 56 80 00       	push   $0x805664
+  8039a6:	68 0b 04 00 00       	push   $0x40b
+  8039ab:	68 55 53 80 00       	push   $0x805355
+  8039b0:	e8 68 c8 ff ff       	call   80021d <_panic>
+  8039b5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8039b8:	eb 07                	jmp    8039c1 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  8039ba:	c1 e0 0c             	shl    $0xc,%eax
+  8039bd:	01 c7                	add    %eax,%edi
+			npages -= r;
+  8039bf:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  8039c1:	85 db                	test   %ebx,%ebx
+  8039c3:	74 30                	je     8039f5 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  8039c5:	ff 75 14             	push   0x14(%ebp)
+  8039c8:	53                   	push   %ebx
+  8039c9:	57                   	push   %edi
+  8039ca:	ff 75 08             	push   0x8(%ebp)
+  8039cd:	e8 2b d5 ff ff       	call   800efd <sys_page_alloc_range>
+  8039d2:	89 c6                	mov    %eax,%esi
+  8039d4:	83 c4 10             	add    $0x10,%esp
+  8039d7:	85 c0                	test   %eax,%eax
+  8039d9:	7f df                	jg     8039ba <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  8039db:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8039de:	75 1a                	jne    8039fa <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  8039e0:	83 ec 08             	sub    $0x8,%esp
+  8039e3:	57                   	push   %edi
+  8039e4:	ff 75 08             	push   0x8(%ebp)
+  8039e7:	e8 68 f9 ff ff       	call   803354 <page_out>
+  8039ec:	83 c4 10             	add    $0x10,%esp
+  8039ef:	85 c0                	test   %eax,%eax
+  8039f1:	79 ce                	jns    8039c1 <page_alloc_range+0x84>
+  8039f3:	eb 05                	jmp    8039fa <page_alloc_range+0xbd>
+	return 0;
+  8039f5:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8039fa:	89 f0                	mov    %esi,%eax
+  8039fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039ff:	5b                   	pop    %ebx
+  803a00:	5e                   	pop    %esi
+  803a01:	5f                   	pop    %edi
+  803a02:	5d                   	pop    %ebp
+  803a03:	c3                   	ret
+
+00803a04 <page_in>:
+{
+  803a04:	55                   	push   %ebp
+  803a05:	89 e5                	mov    %esp,%ebp
+  803a07:	57                   	push   %edi
+  803a08:	56                   	push   %esi
+  803a09:	53                   	push   %ebx
+  803a0a:	83 ec 3c             	sub    $0x3c,%esp
+  803a0d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  803a10:	e8 2d ec ff ff       	call   802642 <find_paging_env>
+	if (pagingenv == 0)
+  803a15:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803a1c:	0f 84 09 02 00 00    	je     803c2b <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  803a22:	83 ec 08             	sub    $0x8,%esp
+  803a25:	6a 00                	push   $0x0
+  803a27:	56                   	push   %esi
+  803a28:	e8 7d f8 ff ff       	call   8032aa <umapdir_walk>
+  803a2d:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803a2f:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803a35:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  803a38:	83 c4 10             	add    $0x10,%esp
+  803a3b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803a3f:	74 0d                	je     803a4e <page_in+0x4a>
+  803a41:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803a46:	8b 40 48             	mov    0x48(%eax),%eax
+  803a49:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803a4c:	75 06                	jne    803a54 <page_in+0x50>
+  803a4e:	8b 03                	mov    (%ebx),%eax
+  803a50:	a8 02                	test   $0x2,%al
+  803a52:	75 63                	jne    803ab7 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  803a54:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803a56:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803a58:	89 f0                	mov    %esi,%eax
+  803a5a:	25 06 0e 00 00       	and    $0xe06,%eax
+  803a5f:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803a62:	50                   	push   %eax
+  803a63:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803a66:	57                   	push   %edi
+  803a67:	ff 75 08             	push   0x8(%ebp)
+  803a6a:	e8 65 fb ff ff       	call   8035d4 <page_alloc>
+  803a6f:	83 c4 10             	add    $0x10,%esp
+  803a72:	85 c0                	test   %eax,%eax
+  803a74:	78 39                	js     803aaf <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  803a76:	89 f0                	mov    %esi,%eax
+  803a78:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803a7b:	83 ec 0c             	sub    $0xc,%esp
+  803a7e:	6a 07                	push   $0x7
+  803a80:	6a 01                	push   $0x1
+  803a82:	57                   	push   %edi
+  803a83:	c1 e0 04             	shl    $0x4,%eax
+  803a86:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803a87:	c1 ee 1c             	shr    $0x1c,%esi
+  803a8a:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803a8d:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803a94:	e8 f1 0f 00 00       	call   804a8a <ipc_call>
+  803a99:	83 c4 20             	add    $0x20,%esp
+  803a9c:	85 c0                	test   %eax,%eax
+  803a9e:	0f 88 72 01 00 00    	js     803c16 <page_in+0x212>
+	*mte = 0;
+  803aa4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  803aaa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803aaf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ab2:	5b                   	pop    %ebx
+  803ab3:	5e                   	pop    %esi
+  803ab4:	5f                   	pop    %edi
+  803ab5:	5d                   	pop    %ebp
+  803ab6:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803ab7:	25 06 0e 00 00       	and    $0xe06,%eax
+  803abc:	83 c8 01             	or     $0x1,%eax
+  803abf:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  803ac2:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803ac5:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  803ac8:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  803ace:	be 01 00 00 00       	mov    $0x1,%esi
+  803ad3:	eb 46                	jmp    803b1b <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  803ad5:	83 ec 08             	sub    $0x8,%esp
+  803ad8:	6a 00                	push   $0x0
+  803ada:	51                   	push   %ecx
+  803adb:	e8 ca f7 ff ff       	call   8032aa <umapdir_walk>
+  803ae0:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  803ae4:	83 c4 10             	add    $0x10,%esp
+  803ae7:	85 c0                	test   %eax,%eax
+  803ae9:	74 66                	je     803b51 <page_in+0x14d>
+  803aeb:	8b 00                	mov    (%eax),%eax
+  803aed:	a8 01                	test   $0x1,%al
+  803aef:	74 60                	je     803b51 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  803af1:	89 c2                	mov    %eax,%edx
+  803af3:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  803af9:	83 ca 01             	or     $0x1,%edx
+  803afc:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  803aff:	75 50                	jne    803b51 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  803b01:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803b07:	c1 e8 1c             	shr    $0x1c,%eax
+  803b0a:	8b 13                	mov    (%ebx),%edx
+  803b0c:	c1 ea 1c             	shr    $0x1c,%edx
+  803b0f:	39 d0                	cmp    %edx,%eax
+  803b11:	75 3e                	jne    803b51 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803b13:	83 c6 01             	add    $0x1,%esi
+  803b16:	83 fe 08             	cmp    $0x8,%esi
+  803b19:	74 3f                	je     803b5a <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  803b1b:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803b1d:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  803b23:	77 2c                	ja     803b51 <page_in+0x14d>
+  803b25:	89 f8                	mov    %edi,%eax
+  803b27:	c1 e8 16             	shr    $0x16,%eax
+  803b2a:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803b31:	f6 c2 01             	test   $0x1,%dl
+  803b34:	74 9f                	je     803ad5 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803b36:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803b3d:	a8 80                	test   $0x80,%al
+  803b3f:	75 10                	jne    803b51 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803b41:	89 f8                	mov    %edi,%eax
+  803b43:	c1 e8 0c             	shr    $0xc,%eax
+  803b46:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b4d:	a8 01                	test   $0x1,%al
+  803b4f:	74 84                	je     803ad5 <page_in+0xd1>
+	if (n == 1)
+  803b51:	83 fe 01             	cmp    $0x1,%esi
+  803b54:	0f 84 fa fe ff ff    	je     803a54 <page_in+0x50>
+	req.nslots = n;
+  803b5a:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  803b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b65:	eb 13                	jmp    803b7a <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  803b67:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  803b6b:	8b 12                	mov    (%edx),%edx
+  803b6d:	c1 ea 0c             	shr    $0xc,%edx
+  803b70:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  803b77:	83 c0 01             	add    $0x1,%eax
+  803b7a:	39 c6                	cmp    %eax,%esi
+  803b7c:	75 e9                	jne    803b67 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  803b7e:	83 ec 0c             	sub    $0xc,%esp
+  803b81:	6a 00                	push   $0x0
+  803b83:	ff 75 c0             	push   -0x40(%ebp)
+  803b86:	56                   	push   %esi
+  803b87:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803b8a:	57                   	push   %edi
+  803b8b:	6a 00                	push   $0x0
+  803b8d:	e8 ab fd ff ff       	call   80393d <page_alloc_range>
+  803b92:	83 c4 20             	add    $0x20,%esp
+  803b95:	85 c0                	test   %eax,%eax
+  803b97:	78 6e                	js     803c07 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  803b99:	83 ec 04             	sub    $0x4,%esp
+  803b9c:	6a 24                	push   $0x24
+  803b9e:	68 00 80 80 00       	push   $0x808000
+  803ba3:	57                   	push   %edi
+  803ba4:	e8 bc ce ff ff       	call   800a65 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803ba9:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803bb0:	56                   	push   %esi
+  803bb1:	57                   	push   %edi
+  803bb2:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803bb4:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  803bbb:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803bbe:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  803bc5:	e8 c0 0e 00 00       	call   804a8a <ipc_call>
+  803bca:	83 c4 20             	add    $0x20,%esp
+  803bcd:	85 c0                	test   %eax,%eax
+  803bcf:	78 08                	js     803bd9 <page_in+0x1d5>
+  803bd1:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  803bd4:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  803bd7:	eb 20                	jmp    803bf9 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  803bd9:	50                   	push   %eax
+  803bda:	68 24 57 80 00       	push   $0x805724
+  803bdf:	68 59 02 00 00       	push   $0x259
+  803be4:	68 55 53 80 00       	push   $0x805355
+  803be9:	e8 2f c6 ff ff       	call   80021d <_panic>
+		*mtes[i] = 0;
+  803bee:	8b 10                	mov    (%eax),%edx
+  803bf0:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  803bf6:	83 c0 04             	add    $0x4,%eax
+  803bf9:	39 c8                	cmp    %ecx,%eax
+  803bfb:	75 f1                	jne    803bee <page_in+0x1ea>
+	return n;
+  803bfd:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  803bff:	85 f6                	test   %esi,%esi
+  803c01:	0f 84 4d fe ff ff    	je     803a54 <page_in+0x50>
+		return r < 0 ? r : 0;
+  803c07:	85 c0                	test   %eax,%eax
+  803c09:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c0e:	0f 4f c2             	cmovg  %edx,%eax
+  803c11:	e9 99 fe ff ff       	jmp    803aaf <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  803c16:	50                   	push   %eax
+  803c17:	68 5c 57 80 00       	push   $0x80575c
+  803c1c:	68 9a 02 00 00       	push   $0x29a
+  803c21:	68 55 53 80 00       	push   $0x805355
+  803c26:	e8 f2 c5 ff ff       	call   80021d <_panic>
+		return -E_PAGING;
+  803c2b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803c30:	e9 7a fe ff ff       	jmp    803aaf <page_in+0xab>
+
+00803c35 <page_map>:
+{
+  803c35:	55                   	push   %ebp
+  803c36:	89 e5                	mov    %esp,%ebp
+  803c38:	57                   	push   %edi
+  803c39:	56                   	push   %esi
+  803c3a:	53                   	push   %ebx
+  803c3b:	83 ec 1c             	sub    $0x1c,%esp
+  803c3e:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803c41:	83 ec 0c             	sub    $0xc,%esp
+  803c44:	ff 75 18             	push   0x18(%ebp)
+  803c47:	ff 75 14             	push   0x14(%ebp)
+  803c4a:	ff 75 10             	push   0x10(%ebp)
+  803c4d:	ff 75 0c             	push   0xc(%ebp)
+  803c50:	56                   	push   %esi
+  803c51:	e8 bf d1 ff ff       	call   800e15 <sys_page_map>
+  803c56:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803c59:	83 c4 20             	add    $0x20,%esp
+  803c5c:	85 c0                	test   %eax,%eax
+  803c5e:	0f 89 a9 01 00 00    	jns    803e0d <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  803c64:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  803c68:	74 5f                	je     803cc9 <page_map+0x94>
+		if (r != -E_INVAL)
+  803c6a:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  803c6e:	0f 85 a0 01 00 00    	jne    803e14 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803c74:	85 f6                	test   %esi,%esi
+  803c76:	74 70                	je     803ce8 <page_map+0xb3>
+  803c78:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803c7d:	8b 40 48             	mov    0x48(%eax),%eax
+  803c80:	39 f0                	cmp    %esi,%eax
+  803c82:	74 64                	je     803ce8 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803c84:	83 ec 0c             	sub    $0xc,%esp
+  803c87:	6a 05                	push   $0x5
+  803c89:	68 00 00 40 00       	push   $0x400000
+  803c8e:	6a 00                	push   $0x0
+  803c90:	68 00 b0 ad de       	push   $0xdeadb000
+  803c95:	56                   	push   %esi
+  803c96:	e8 7a d1 ff ff       	call   800e15 <sys_page_map>
+  803c9b:	89 c3                	mov    %eax,%ebx
+  803c9d:	83 c4 20             	add    $0x20,%esp
+  803ca0:	85 c0                	test   %eax,%eax
+  803ca2:	79 6a                	jns    803d0e <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  803ca4:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803ca7:	75 50                	jne    803cf9 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  803ca9:	83 ec 08             	sub    $0x8,%esp
+  803cac:	68 00 00 40 00       	push   $0x400000
+  803cb1:	6a fc                	push   $0xfffffffc
+  803cb3:	e8 9c f6 ff ff       	call   803354 <page_out>
+  803cb8:	83 c4 10             	add    $0x10,%esp
+  803cbb:	85 c0                	test   %eax,%eax
+  803cbd:	79 c5                	jns    803c84 <page_map+0x4f>
+}
+  803cbf:	89 d8                	mov    %ebx,%eax
+  803cc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cc4:	5b                   	pop    %ebx
+  803cc5:	5e                   	pop    %esi
+  803cc6:	5f                   	pop    %edi
+  803cc7:	5d                   	pop    %ebp
+  803cc8:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  803cc9:	83 ec 08             	sub    $0x8,%esp
+  803ccc:	68 00 00 40 00       	push   $0x400000
+  803cd1:	6a 00                	push   $0x0
+  803cd3:	e8 7c f6 ff ff       	call   803354 <page_out>
+  803cd8:	83 c4 10             	add    $0x10,%esp
+  803cdb:	85 c0                	test   %eax,%eax
+  803cdd:	0f 89 5e ff ff ff    	jns    803c41 <page_map+0xc>
+				return r;
+  803ce3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803ce6:	eb d7                	jmp    803cbf <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803ce8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803ceb:	e8 79 f9 ff ff       	call   803669 <page_adopt>
+  803cf0:	85 c0                	test   %eax,%eax
+  803cf2:	79 90                	jns    803c84 <page_map+0x4f>
+			return r;
+  803cf4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803cf7:	eb c6                	jmp    803cbf <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  803cf9:	53                   	push   %ebx
+  803cfa:	68 90 57 80 00       	push   $0x805790
+  803cff:	68 77 03 00 00       	push   $0x377
+  803d04:	68 55 53 80 00       	push   $0x805355
+  803d09:	e8 0f c5 ff ff       	call   80021d <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  803d0e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d11:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803d14:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  803d1b:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  803d21:	0f 84 f5 00 00 00    	je     803e1c <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803d27:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803d2d:	83 ec 0c             	sub    $0xc,%esp
+  803d30:	6a 05                	push   $0x5
+  803d32:	68 00 00 40 00       	push   $0x400000
+  803d37:	6a 00                	push   $0x0
+  803d39:	57                   	push   %edi
+  803d3a:	56                   	push   %esi
+  803d3b:	e8 d5 d0 ff ff       	call   800e15 <sys_page_map>
+  803d40:	89 c3                	mov    %eax,%ebx
+  803d42:	83 c4 20             	add    $0x20,%esp
+  803d45:	85 c0                	test   %eax,%eax
+  803d47:	79 35                	jns    803d7e <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  803d49:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803d4c:	75 1b                	jne    803d69 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803d4e:	83 ec 08             	sub    $0x8,%esp
+  803d51:	68 00 00 40 00       	push   $0x400000
+  803d56:	6a 00                	push   $0x0
+  803d58:	e8 f7 f5 ff ff       	call   803354 <page_out>
+  803d5d:	83 c4 10             	add    $0x10,%esp
+  803d60:	85 c0                	test   %eax,%eax
+  803d62:	79 c9                	jns    803d2d <page_map+0xf8>
+  803d64:	e9 56 ff ff ff       	jmp    803cbf <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  803d69:	53                   	push   %ebx
+  803d6a:	68 b8 57 80 00       	push   $0x8057b8
+  803d6f:	68 83 03 00 00       	push   $0x383
+  803d74:	68 55 53 80 00       	push   $0x805355
+  803d79:	e8 9f c4 ff ff       	call   80021d <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  803d7e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d81:	c1 e8 0c             	shr    $0xc,%eax
+  803d84:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803d89:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  803d90:	01 
+  803d91:	0f 84 8d 00 00 00    	je     803e24 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803d97:	83 ec 08             	sub    $0x8,%esp
+  803d9a:	68 00 00 40 00       	push   $0x400000
+  803d9f:	6a 00                	push   $0x0
+  803da1:	e8 b1 d0 ff ff       	call   800e57 <sys_page_unmap>
+  803da6:	83 c4 10             	add    $0x10,%esp
+  803da9:	85 c0                	test   %eax,%eax
+  803dab:	78 36                	js     803de3 <page_map+0x1ae>
+  803dad:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  803db0:	83 ec 08             	sub    $0x8,%esp
+  803db3:	57                   	push   %edi
+  803db4:	56                   	push   %esi
+  803db5:	e8 4a fc ff ff       	call   803a04 <page_in>
+  803dba:	89 c3                	mov    %eax,%ebx
+  803dbc:	83 c4 10             	add    $0x10,%esp
+  803dbf:	85 c0                	test   %eax,%eax
+  803dc1:	0f 89 7a fe ff ff    	jns    803c41 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  803dc7:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803dca:	75 2c                	jne    803df8 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  803dcc:	83 ec 08             	sub    $0x8,%esp
+  803dcf:	57                   	push   %edi
+  803dd0:	6a 00                	push   $0x0
+  803dd2:	e8 7d f5 ff ff       	call   803354 <page_out>
+  803dd7:	83 c4 10             	add    $0x10,%esp
+  803dda:	85 c0                	test   %eax,%eax
+  803ddc:	79 d2                	jns    803db0 <page_map+0x17b>
+  803dde:	e9 dc fe ff ff       	jmp    803cbf <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  803de3:	50                   	push   %eax
+  803de4:	68 e4 57 80 00       	push   $0x8057e4
+  803de9:	68 8b 03 00 00       	push   $0x38b
+  803dee:	68 55 53 80 00       	push   $0x805355
+  803df3:	e8 25 c4 ff ff       	call   80021d <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  803df8:	53                   	push   %ebx
+  803df9:	68 0c 58 80 00       	push   $0x80580c
+  803dfe:	68 91 03 00 00       	push   $0x391
+  803e03:	68 55 53 80 00       	push   $0x805355
+  803e08:	e8 10 c4 ff ff       	call   80021d <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803e0d:	89 c3                	mov    %eax,%ebx
+  803e0f:	e9 ab fe ff ff       	jmp    803cbf <page_map+0x8a>
+  803e14:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e17:	e9 a3 fe ff ff       	jmp    803cbf <page_map+0x8a>
+			return r; // Pass through the error
+  803e1c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e1f:	e9 9b fe ff ff       	jmp    803cbf <page_map+0x8a>
+			return r; // Pass through the error
+  803e24:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e27:	e9 93 fe ff ff       	jmp    803cbf <page_map+0x8a>
+
+00803e2c <page_map_range>:
+{
+  803e2c:	55                   	push   %ebp
+  803e2d:	89 e5                	mov    %esp,%ebp
+  803e2f:	57                   	push   %edi
+  803e30:	56                   	push   %esi
+  803e31:	53                   	push   %ebx
+  803e32:	83 ec 0c             	sub    $0xc,%esp
+  803e35:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803e38:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  803e3b:	83 ec 08             	sub    $0x8,%esp
+  803e3e:	ff 75 1c             	push   0x1c(%ebp)
+  803e41:	ff 75 18             	push   0x18(%ebp)
+  803e44:	56                   	push   %esi
+  803e45:	ff 75 10             	push   0x10(%ebp)
+  803e48:	57                   	push   %edi
+  803e49:	ff 75 08             	push   0x8(%ebp)
+  803e4c:	e8 cf d0 ff ff       	call   800f20 <sys_page_map_range>
+  803e51:	89 c3                	mov    %eax,%ebx
+  803e53:	83 c4 20             	add    $0x20,%esp
+  803e56:	85 c0                	test   %eax,%eax
+  803e58:	79 1b                	jns    803e75 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  803e5a:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803e5d:	75 20                	jne    803e7f <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803e5f:	83 ec 08             	sub    $0x8,%esp
+  803e62:	68 00 00 40 00       	push   $0x400000
+  803e67:	6a 00                	push   $0x0
+  803e69:	e8 e6 f4 ff ff       	call   803354 <page_out>
+  803e6e:	83 c4 10             	add    $0x10,%esp
+  803e71:	85 c0                	test   %eax,%eax
+  803e73:	79 c6                	jns    803e3b <page_map_range+0xf>
+}
+  803e75:	89 d8                	mov    %ebx,%eax
+  803e77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e7a:	5b                   	pop    %ebx
+  803e7b:	5e                   	pop    %esi
+  803e7c:	5f                   	pop    %edi
+  803e7d:	5d                   	pop    %ebp
+  803e7e:	c3                   	ret
+		if (r != -E_INVAL)
+  803e7f:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  803e82:	75 f1                	jne    803e75 <page_map_range+0x49>
+  803e84:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  803e86:	be 00 00 00 00       	mov    $0x0,%esi
+  803e8b:	eb 03                	jmp    803e90 <page_map_range+0x64>
+  803e8d:	83 c6 01             	add    $0x1,%esi
+  803e90:	3b 75 18             	cmp    0x18(%ebp),%esi
+  803e93:	74 2a                	je     803ebf <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  803e95:	83 ec 0c             	sub    $0xc,%esp
+  803e98:	ff 75 1c             	push   0x1c(%ebp)
+  803e9b:	53                   	push   %ebx
+  803e9c:	ff 75 10             	push   0x10(%ebp)
+  803e9f:	57                   	push   %edi
+  803ea0:	ff 75 08             	push   0x8(%ebp)
+  803ea3:	e8 8d fd ff ff       	call   803c35 <page_map>
+  803ea8:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803eae:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803eb4:	83 c4 20             	add    $0x20,%esp
+  803eb7:	85 c0                	test   %eax,%eax
+  803eb9:	79 d2                	jns    803e8d <page_map_range+0x61>
+  803ebb:	89 c3                	mov    %eax,%ebx
+  803ebd:	eb b6                	jmp    803e75 <page_map_range+0x49>
+		return 0;
+  803ebf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ec4:	eb af                	jmp    803e75 <page_map_range+0x49>
+
+00803ec6 <paging_pgfault_handler>:
+{
+  803ec6:	55                   	push   %ebp
+  803ec7:	89 e5                	mov    %esp,%ebp
+  803ec9:	56                   	push   %esi
+  803eca:	53                   	push   %ebx
+  803ecb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  803ece:	e8 6f e7 ff ff       	call   802642 <find_paging_env>
+	if (pagingenv == 0)
+  803ed3:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803ed8:	85 c0                	test   %eax,%eax
+  803eda:	74 3c                	je     803f18 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  803edc:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803ede:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803ee2:	75 12                	jne    803ef6 <paging_pgfault_handler+0x30>
+  803ee4:	89 f0                	mov    %esi,%eax
+  803ee6:	e8 7e f7 ff ff       	call   803669 <page_adopt>
+  803eeb:	89 c2                	mov    %eax,%edx
+		return 0;
+  803eed:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803ef2:	85 d2                	test   %edx,%edx
+  803ef4:	78 22                	js     803f18 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  803ef6:	83 ec 08             	sub    $0x8,%esp
+  803ef9:	6a 00                	push   $0x0
+  803efb:	56                   	push   %esi
+  803efc:	e8 a9 f3 ff ff       	call   8032aa <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  803f01:	83 c4 10             	add    $0x10,%esp
+  803f04:	85 c0                	test   %eax,%eax
+  803f06:	74 05                	je     803f0d <paging_pgfault_handler+0x47>
+  803f08:	f6 00 01             	testb  $0x1,(%eax)
+  803f0b:	75 12                	jne    803f1f <paging_pgfault_handler+0x59>
+	return 0;
+  803f0d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f12:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803f16:	74 23                	je     803f3b <paging_pgfault_handler+0x75>
+}
+  803f18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f1b:	5b                   	pop    %ebx
+  803f1c:	5e                   	pop    %esi
+  803f1d:	5d                   	pop    %ebp
+  803f1e:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  803f1f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803f24:	8b 40 48             	mov    0x48(%eax),%eax
+  803f27:	83 ec 08             	sub    $0x8,%esp
+  803f2a:	56                   	push   %esi
+  803f2b:	50                   	push   %eax
+  803f2c:	e8 d3 fa ff ff       	call   803a04 <page_in>
+  803f31:	f7 d0                	not    %eax
+  803f33:	c1 e8 1f             	shr    $0x1f,%eax
+  803f36:	83 c4 10             	add    $0x10,%esp
+  803f39:	eb dd                	jmp    803f18 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f3b:	89 f0                	mov    %esi,%eax
+  803f3d:	e8 97 e2 ff ff       	call   8021d9 <segment_lookup>
+  803f42:	89 c2                	mov    %eax,%edx
+	return 0;
+  803f44:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f49:	85 d2                	test   %edx,%edx
+  803f4b:	74 cb                	je     803f18 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  803f4d:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803f52:	8b 40 48             	mov    0x48(%eax),%eax
+  803f55:	83 ec 08             	sub    $0x8,%esp
+  803f58:	56                   	push   %esi
+  803f59:	50                   	push   %eax
+  803f5a:	e8 f5 f3 ff ff       	call   803354 <page_out>
+  803f5f:	f7 d0                	not    %eax
+  803f61:	c1 e8 1f             	shr    $0x1f,%eax
+  803f64:	83 c4 10             	add    $0x10,%esp
+  803f67:	eb af                	jmp    803f18 <paging_pgfault_handler+0x52>
+
+00803f69 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  803f69:	55                   	push   %ebp
+  803f6a:	89 e5                	mov    %esp,%ebp
+  803f6c:	57                   	push   %edi
+  803f6d:	56                   	push   %esi
+  803f6e:	53                   	push   %ebx
+  803f6f:	83 ec 2c             	sub    $0x2c,%esp
+  803f72:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  803f75:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  803f7a:	89 c1                	mov    %eax,%ecx
+  803f7c:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  803f7f:	c1 e8 11             	shr    $0x11,%eax
+  803f82:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803f85:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  803f8c:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  803f8f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f94:	d3 e0                	shl    %cl,%eax
+  803f96:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803f99:	85 c7                	test   %eax,%edi
+  803f9b:	74 12                	je     803faf <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803f9d:	bb 01 00 00 00       	mov    $0x1,%ebx
+  803fa2:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  803fa5:	bf 01 00 00 00       	mov    $0x1,%edi
+  803faa:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803fad:	eb 17                	jmp    803fc6 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  803faf:	ff 75 e0             	push   -0x20(%ebp)
+  803fb2:	68 44 58 80 00       	push   $0x805844
+  803fb7:	6a 48                	push   $0x48
+  803fb9:	68 5e 58 80 00       	push   $0x80585e
+  803fbe:	e8 5a c2 ff ff       	call   80021d <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803fc3:	83 c3 01             	add    $0x1,%ebx
+  803fc6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803fc9:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  803fcc:	89 c8                	mov    %ecx,%eax
+  803fce:	c1 e8 05             	shr    $0x5,%eax
+  803fd1:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  803fd8:	89 fe                	mov    %edi,%esi
+  803fda:	d3 e6                	shl    %cl,%esi
+  803fdc:	89 f1                	mov    %esi,%ecx
+  803fde:	85 d6                	test   %edx,%esi
+  803fe0:	74 e1                	je     803fc3 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  803fe2:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  803fe5:	f7 d6                	not    %esi
+  803fe7:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  803fea:	21 fe                	and    %edi,%esi
+  803fec:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803fef:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  803ff6:	f7 d1                	not    %ecx
+  803ff8:	21 d1                	and    %edx,%ecx
+  803ffa:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804001:	83 ec 04             	sub    $0x4,%esp
+  804004:	53                   	push   %ebx
+  804005:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804008:	57                   	push   %edi
+  804009:	6a 00                	push   $0x0
+  80400b:	e8 97 f8 ff ff       	call   8038a7 <page_unmap_range>
+	va_free(va, n);
+  804010:	83 c4 08             	add    $0x8,%esp
+  804013:	53                   	push   %ebx
+  804014:	57                   	push   %edi
+  804015:	e8 ed 05 00 00       	call   804607 <va_free>
+}
+  80401a:	83 c4 10             	add    $0x10,%esp
+  80401d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804020:	5b                   	pop    %ebx
+  804021:	5e                   	pop    %esi
+  804022:	5f                   	pop    %edi
+  804023:	5d                   	pop    %ebp
+  804024:	c3                   	ret
+
+00804025 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  804025:	55                   	push   %ebp
+  804026:	89 e5                	mov    %esp,%ebp
+  804028:	57                   	push   %edi
+  804029:	56                   	push   %esi
+  80402a:	53                   	push   %ebx
+  80402b:	83 ec 1c             	sub    $0x1c,%esp
+  80402e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804031:	85 db                	test   %ebx,%ebx
+  804033:	74 34                	je     804069 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  804035:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80403b:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  804040:	77 2f                	ja     804071 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  804042:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  804048:	75 51                	jne    80409b <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  80404a:	89 c1                	mov    %eax,%ecx
+  80404c:	c1 e9 0c             	shr    $0xc,%ecx
+  80404f:	ba 01 00 00 00       	mov    $0x1,%edx
+  804054:	d3 e2                	shl    %cl,%edx
+  804056:	c1 e8 11             	shr    $0x11,%eax
+  804059:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  804060:	75 24                	jne    804086 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  804062:	89 d8                	mov    %ebx,%eax
+  804064:	e8 00 ff ff ff       	call   803f69 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  804069:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80406c:	5b                   	pop    %ebx
+  80406d:	5e                   	pop    %esi
+  80406e:	5f                   	pop    %edi
+  80406f:	5d                   	pop    %ebp
+  804070:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  804071:	53                   	push   %ebx
+  804072:	68 6b 58 80 00       	push   $0x80586b
+  804077:	68 a2 00 00 00       	push   $0xa2
+  80407c:	68 5e 58 80 00       	push   $0x80585e
+  804081:	e8 97 c1 ff ff       	call   80021d <_panic>
+			panic("free: %p is not allocated", va);
+  804086:	53                   	push   %ebx
+  804087:	68 44 58 80 00       	push   $0x805844
+  80408c:	68 a5 00 00 00       	push   $0xa5
+  804091:	68 5e 58 80 00       	push   $0x80585e
+  804096:	e8 82 c1 ff ff       	call   80021d <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  80409b:	89 de                	mov    %ebx,%esi
+  80409d:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  8040a3:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  8040a9:	89 c8                	mov    %ecx,%eax
+  8040ab:	c1 e8 11             	shr    $0x11,%eax
+  8040ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8040b1:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  8040b8:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8040bb:	c1 e9 0c             	shr    $0xc,%ecx
+  8040be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8040c3:	d3 e0                	shl    %cl,%eax
+  8040c5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8040c8:	85 c7                	test   %eax,%edi
+  8040ca:	74 1b                	je     8040e7 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  8040cc:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8040d0:	89 d8                	mov    %ebx,%eax
+  8040d2:	29 f0                	sub    %esi,%eax
+  8040d4:	83 e8 10             	sub    $0x10,%eax
+  8040d7:	99                   	cltd
+  8040d8:	f7 ff                	idiv   %edi
+  8040da:	89 d1                	mov    %edx,%ecx
+  8040dc:	85 d2                	test   %edx,%edx
+  8040de:	75 07                	jne    8040e7 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8040e0:	ba 10 00 00 00       	mov    $0x10,%edx
+  8040e5:	eb 18                	jmp    8040ff <free+0xda>
+		panic("free: %p is not allocated", va);
+  8040e7:	53                   	push   %ebx
+  8040e8:	68 44 58 80 00       	push   $0x805844
+  8040ed:	68 ad 00 00 00       	push   $0xad
+  8040f2:	68 5e 58 80 00       	push   $0x80585e
+  8040f7:	e8 21 c1 ff ff       	call   80021d <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8040fc:	83 c1 01             	add    $0x1,%ecx
+  8040ff:	89 d0                	mov    %edx,%eax
+  804101:	d3 e0                	shl    %cl,%eax
+  804103:	39 c7                	cmp    %eax,%edi
+  804105:	7f f5                	jg     8040fc <free+0xd7>
+	*(void **) va = s->free;
+  804107:	8b 46 08             	mov    0x8(%esi),%eax
+  80410a:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  80410c:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  80410f:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  804113:	8d 58 01             	lea    0x1(%eax),%ebx
+  804116:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  80411a:	66 85 c0             	test   %ax,%ax
+  80411d:	74 52                	je     804171 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  80411f:	0f b7 db             	movzwl %bx,%ebx
+  804122:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804126:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80412b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804130:	f7 ff                	idiv   %edi
+  804132:	39 c3                	cmp    %eax,%ebx
+  804134:	0f 85 2f ff ff ff    	jne    804069 <free+0x44>
+  80413a:	8b 46 04             	mov    0x4(%esi),%eax
+  80413d:	85 c0                	test   %eax,%eax
+  80413f:	74 53                	je     804194 <free+0x16f>
+		s->prev->next = s->next;
+  804141:	8b 16                	mov    (%esi),%edx
+  804143:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804145:	8b 06                	mov    (%esi),%eax
+  804147:	85 c0                	test   %eax,%eax
+  804149:	74 06                	je     804151 <free+0x12c>
+		s->next->prev = s->prev;
+  80414b:	8b 56 04             	mov    0x4(%esi),%edx
+  80414e:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804151:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804154:	f7 d0                	not    %eax
+  804156:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804159:	21 d0                	and    %edx,%eax
+  80415b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80415e:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  804165:	89 f0                	mov    %esi,%eax
+  804167:	e8 fd fd ff ff       	call   803f69 <heap_free_pages>
+  80416c:	e9 f8 fe ff ff       	jmp    804069 <free+0x44>
+	s->prev = NULL;
+  804171:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  804178:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  80417f:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  804181:	85 c0                	test   %eax,%eax
+  804183:	74 03                	je     804188 <free+0x163>
+		slabs[c]->prev = s;
+  804185:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  804188:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  80418f:	e9 d5 fe ff ff       	jmp    804069 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804194:	8b 06                	mov    (%esi),%eax
+  804196:	85 c0                	test   %eax,%eax
+  804198:	0f 84 cb fe ff ff    	je     804069 <free+0x44>
+		slabs[c] = s->next;
+  80419e:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  8041a5:	8b 06                	mov    (%esi),%eax
+  8041a7:	eb a2                	jmp    80414b <free+0x126>
+
+008041a9 <heap_alloc_pages>:
+{
+  8041a9:	55                   	push   %ebp
+  8041aa:	89 e5                	mov    %esp,%ebp
+  8041ac:	57                   	push   %edi
+  8041ad:	56                   	push   %esi
+  8041ae:	53                   	push   %ebx
+  8041af:	83 ec 18             	sub    $0x18,%esp
+  8041b2:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  8041b4:	50                   	push   %eax
+  8041b5:	e8 15 03 00 00       	call   8044cf <va_alloc>
+  8041ba:	89 c3                	mov    %eax,%ebx
+  8041bc:	83 c4 10             	add    $0x10,%esp
+  8041bf:	85 c0                	test   %eax,%eax
+  8041c1:	74 47                	je     80420a <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8041c3:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  8041c9:	89 c1                	mov    %eax,%ecx
+  8041cb:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  8041ce:	c1 e8 11             	shr    $0x11,%eax
+  8041d1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8041d6:	89 d7                	mov    %edx,%edi
+  8041d8:	d3 e7                	shl    %cl,%edi
+  8041da:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  8041e1:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  8041e5:	89 c8                	mov    %ecx,%eax
+  8041e7:	c1 e8 05             	shr    $0x5,%eax
+  8041ea:	d3 e2                	shl    %cl,%edx
+  8041ec:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  8041f3:	83 ec 0c             	sub    $0xc,%esp
+  8041f6:	6a 00                	push   $0x0
+  8041f8:	6a 07                	push   $0x7
+  8041fa:	56                   	push   %esi
+  8041fb:	53                   	push   %ebx
+  8041fc:	6a 00                	push   $0x0
+  8041fe:	e8 3a f7 ff ff       	call   80393d <page_alloc_range>
+  804203:	83 c4 20             	add    $0x20,%esp
+  804206:	85 c0                	test   %eax,%eax
+  804208:	78 0a                	js     804214 <heap_alloc_pages+0x6b>
+}
+  80420a:	89 d8                	mov    %ebx,%eax
+  80420c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80420f:	5b                   	pop    %ebx
+  804210:	5e                   	pop    %esi
+  804211:	5f                   	pop    %edi
+  804212:	5d                   	pop    %ebp
+  804213:	c3                   	ret
+		free(va);
+  804214:	83 ec 0c             	sub    $0xc,%esp
+  804217:	53                   	push   %ebx
+  804218:	e8 08 fe ff ff       	call   804025 <free>
+		return NULL;
+  80421d:	83 c4 10             	add    $0x10,%esp
+  804220:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804225:	eb e3                	jmp    80420a <heap_alloc_pages+0x61>
+
+00804227 <malloc>:
+{
+  804227:	55                   	push   %ebp
+  804228:	89 e5                	mov    %esp,%ebp
+  80422a:	57                   	push   %edi
+  80422b:	56                   	push   %esi
+  80422c:	53                   	push   %ebx
+  80422d:	83 ec 1c             	sub    $0x1c,%esp
+  804230:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804233:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804236:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  80423c:	0f 87 21 01 00 00    	ja     804363 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804242:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804247:	ba 10 00 00 00       	mov    $0x10,%edx
+  80424c:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  80424e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804253:	76 15                	jbe    80426a <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804255:	05 ff 0f 00 00       	add    $0xfff,%eax
+  80425a:	c1 e8 0c             	shr    $0xc,%eax
+  80425d:	e8 47 ff ff ff       	call   8041a9 <heap_alloc_pages>
+  804262:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804265:	eb 37                	jmp    80429e <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804267:	83 c1 01             	add    $0x1,%ecx
+  80426a:	89 d6                	mov    %edx,%esi
+  80426c:	d3 e6                	shl    %cl,%esi
+  80426e:	39 c6                	cmp    %eax,%esi
+  804270:	72 f5                	jb     804267 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804272:	89 cb                	mov    %ecx,%ebx
+  804274:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  80427b:	85 ff                	test   %edi,%edi
+  80427d:	74 2a                	je     8042a9 <malloc+0x82>
+	v = s->free;
+  80427f:	8b 47 08             	mov    0x8(%edi),%eax
+  804282:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  804285:	8b 00                	mov    (%eax),%eax
+  804287:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  80428a:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  80428e:	83 e8 01             	sub    $0x1,%eax
+  804291:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  804295:	66 85 c0             	test   %ax,%ax
+  804298:	0f 84 9a 00 00 00    	je     804338 <malloc+0x111>
+}
+  80429e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8042a1:	83 c4 1c             	add    $0x1c,%esp
+  8042a4:	5b                   	pop    %ebx
+  8042a5:	5e                   	pop    %esi
+  8042a6:	5f                   	pop    %edi
+  8042a7:	5d                   	pop    %ebp
+  8042a8:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  8042a9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8042ae:	e8 f6 fe ff ff       	call   8041a9 <heap_alloc_pages>
+  8042b3:	89 c1                	mov    %eax,%ecx
+  8042b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8042b8:	85 c0                	test   %eax,%eax
+  8042ba:	74 e2                	je     80429e <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8042bc:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  8042c2:	89 c8                	mov    %ecx,%eax
+  8042c4:	c1 e8 11             	shr    $0x11,%eax
+  8042c7:	c1 e9 0c             	shr    $0xc,%ecx
+  8042ca:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042cf:	d3 e2                	shl    %cl,%edx
+  8042d1:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  8042d8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8042db:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  8042df:	0f b7 f6             	movzwl %si,%esi
+  8042e2:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8042e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042ec:	f7 fe                	idiv   %esi
+  8042ee:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  8042f2:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  8042f5:	85 c0                	test   %eax,%eax
+  8042f7:	74 14                	je     80430d <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  8042f9:	83 e8 01             	sub    $0x1,%eax
+  8042fc:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804300:	0f af d0             	imul   %eax,%edx
+  804303:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804307:	89 3a                	mov    %edi,(%edx)
+  804309:	89 d7                	mov    %edx,%edi
+  80430b:	eb e5                	jmp    8042f2 <malloc+0xcb>
+	s->prev = NULL;
+  80430d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804310:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804317:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  80431e:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804320:	85 c0                	test   %eax,%eax
+  804322:	74 03                	je     804327 <malloc+0x100>
+		slabs[c]->prev = s;
+  804324:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804327:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80432a:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  804331:	89 c7                	mov    %eax,%edi
+  804333:	e9 47 ff ff ff       	jmp    80427f <malloc+0x58>
+	if (s->prev)
+  804338:	8b 47 04             	mov    0x4(%edi),%eax
+  80433b:	85 c0                	test   %eax,%eax
+  80433d:	74 19                	je     804358 <malloc+0x131>
+		s->prev->next = s->next;
+  80433f:	8b 17                	mov    (%edi),%edx
+  804341:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804343:	8b 07                	mov    (%edi),%eax
+  804345:	85 c0                	test   %eax,%eax
+  804347:	0f 84 51 ff ff ff    	je     80429e <malloc+0x77>
+		s->next->prev = s->prev;
+  80434d:	8b 57 04             	mov    0x4(%edi),%edx
+  804350:	89 50 04             	mov    %edx,0x4(%eax)
+  804353:	e9 46 ff ff ff       	jmp    80429e <malloc+0x77>
+		slabs[c] = s->next;
+  804358:	8b 07                	mov    (%edi),%eax
+  80435a:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  804361:	eb e0                	jmp    804343 <malloc+0x11c>
+		return NULL;
+  804363:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80436a:	e9 2f ff ff ff       	jmp    80429e <malloc+0x77>
+
+0080436f <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  80436f:	55                   	push   %ebp
+  804370:	89 e5                	mov    %esp,%ebp
+  804372:	57                   	push   %edi
+  804373:	56                   	push   %esi
+  804374:	53                   	push   %ebx
+  804375:	83 ec 0c             	sub    $0xc,%esp
+  804378:	89 c6                	mov    %eax,%esi
+  80437a:	89 d7                	mov    %edx,%edi
+  80437c:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  80437f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804384:	ba 00 00 00 00       	mov    $0x0,%edx
+  804389:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  80438e:	83 ef 01             	sub    $0x1,%edi
+  804391:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804394:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  804397:	eb 34                	jmp    8043cd <va_chunk_scan+0x5e>
+			i += 31;
+  804399:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  80439c:	89 ca                	mov    %ecx,%edx
+			continue;
+  80439e:	eb 23                	jmp    8043c3 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8043a0:	89 c7                	mov    %eax,%edi
+  8043a2:	c1 ef 05             	shr    $0x5,%edi
+  8043a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8043aa:	d3 e6                	shl    %cl,%esi
+  8043ac:	89 f1                	mov    %esi,%ecx
+  8043ae:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8043b1:	23 0c be             	and    (%esi,%edi,4),%ecx
+  8043b4:	75 41                	jne    8043f7 <va_chunk_scan+0x88>
+			len++;
+  8043b6:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  8043b9:	39 d3                	cmp    %edx,%ebx
+  8043bb:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  8043be:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  8043c1:	72 2d                	jb     8043f0 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8043c3:	83 c0 01             	add    $0x1,%eax
+  8043c6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8043cb:	77 31                	ja     8043fe <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  8043cd:	89 c1                	mov    %eax,%ecx
+  8043cf:	83 e1 1f             	and    $0x1f,%ecx
+  8043d2:	75 cc                	jne    8043a0 <va_chunk_scan+0x31>
+  8043d4:	89 c7                	mov    %eax,%edi
+  8043d6:	c1 ef 05             	shr    $0x5,%edi
+  8043d9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8043dc:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  8043df:	83 ff ff             	cmp    $0xffffffff,%edi
+  8043e2:	74 b5                	je     804399 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  8043e4:	85 ff                	test   %edi,%edi
+  8043e6:	75 b8                	jne    8043a0 <va_chunk_scan+0x31>
+			i += 31;
+  8043e8:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  8043eb:	83 c2 20             	add    $0x20,%edx
+  8043ee:	eb c9                	jmp    8043b9 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  8043f0:	83 c0 01             	add    $0x1,%eax
+  8043f3:	29 d0                	sub    %edx,%eax
+  8043f5:	eb 15                	jmp    80440c <va_chunk_scan+0x9d>
+			len = 0;
+  8043f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043fc:	eb c5                	jmp    8043c3 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  8043fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804403:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804406:	85 d2                	test   %edx,%edx
+  804408:	74 02                	je     80440c <va_chunk_scan+0x9d>
+		*run_store = best;
+  80440a:	89 1a                	mov    %ebx,(%edx)
+}
+  80440c:	83 c4 0c             	add    $0xc,%esp
+  80440f:	5b                   	pop    %ebx
+  804410:	5e                   	pop    %esi
+  804411:	5f                   	pop    %edi
+  804412:	5d                   	pop    %ebp
+  804413:	c3                   	ret
+
+00804414 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804414:	55                   	push   %ebp
+  804415:	89 e5                	mov    %esp,%ebp
+  804417:	57                   	push   %edi
+  804418:	56                   	push   %esi
+  804419:	53                   	push   %ebx
+  80441a:	83 ec 14             	sub    $0x14,%esp
+  80441d:	89 c3                	mov    %eax,%ebx
+  80441f:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804421:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804427:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  80442d:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804430:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804433:	89 d6                	mov    %edx,%esi
+  804435:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  80443b:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  80443d:	eb 34                	jmp    804473 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  80443f:	89 c8                	mov    %ecx,%eax
+  804441:	c1 e8 05             	shr    $0x5,%eax
+  804444:	89 da                	mov    %ebx,%edx
+  804446:	c1 e2 05             	shl    $0x5,%edx
+  804449:	01 da                	add    %ebx,%edx
+  80444b:	01 c2                	add    %eax,%edx
+  80444d:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804452:	d3 c0                	rol    %cl,%eax
+  804454:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  80445b:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804462:	b8 01 00 00 00       	mov    $0x1,%eax
+  804467:	01 d0                	add    %edx,%eax
+  804469:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804470:	83 c1 01             	add    $0x1,%ecx
+  804473:	39 f9                	cmp    %edi,%ecx
+  804475:	74 30                	je     8044a7 <va_chunk_mark+0x93>
+		if (alloc)
+  804477:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80447b:	74 c2                	je     80443f <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  80447d:	89 c8                	mov    %ecx,%eax
+  80447f:	c1 e8 05             	shr    $0x5,%eax
+  804482:	89 da                	mov    %ebx,%edx
+  804484:	c1 e2 05             	shl    $0x5,%edx
+  804487:	01 da                	add    %ebx,%edx
+  804489:	01 c2                	add    %eax,%edx
+  80448b:	b8 01 00 00 00       	mov    $0x1,%eax
+  804490:	d3 e0                	shl    %cl,%eax
+  804492:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804499:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  8044a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8044a5:	eb c0                	jmp    804467 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  8044a7:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  8044aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044af:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8044b2:	e8 b8 fe ff ff       	call   80436f <va_chunk_scan>
+	ch->run = run;
+  8044b7:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  8044bd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8044c0:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  8044c7:	83 c4 14             	add    $0x14,%esp
+  8044ca:	5b                   	pop    %ebx
+  8044cb:	5e                   	pop    %esi
+  8044cc:	5f                   	pop    %edi
+  8044cd:	5d                   	pop    %ebp
+  8044ce:	c3                   	ret
+
+008044cf <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  8044cf:	55                   	push   %ebp
+  8044d0:	89 e5                	mov    %esp,%ebp
+  8044d2:	57                   	push   %edi
+  8044d3:	56                   	push   %esi
+  8044d4:	53                   	push   %ebx
+  8044d5:	83 ec 04             	sub    $0x4,%esp
+  8044d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  8044db:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  8044e0:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  8044e5:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  8044ec:	74 4f                	je     80453d <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  8044ee:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8044f1:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  8044f6:	0f 87 01 01 00 00    	ja     8045fd <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  8044fc:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804502:	0f 87 80 00 00 00    	ja     804588 <va_alloc+0xb9>
+  804508:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  80450d:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804512:	0f b7 10             	movzwl (%eax),%edx
+  804515:	05 84 00 00 00       	add    $0x84,%eax
+  80451a:	39 da                	cmp    %ebx,%edx
+  80451c:	73 2c                	jae    80454a <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  80451e:	83 c6 01             	add    $0x1,%esi
+  804521:	83 fe 1c             	cmp    $0x1c,%esi
+  804524:	75 ec                	jne    804512 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804526:	b8 00 00 00 00       	mov    $0x0,%eax
+  80452b:	eb 53                	jmp    804580 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  80452d:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804533:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804538:	05 84 00 00 00       	add    $0x84,%eax
+  80453d:	39 d0                	cmp    %edx,%eax
+  80453f:	75 ec                	jne    80452d <va_alloc+0x5e>
+	va_inited = 1;
+  804541:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  804548:	eb a4                	jmp    8044ee <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  80454a:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804550:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  804555:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80455a:	89 da                	mov    %ebx,%edx
+  80455c:	e8 0e fe ff ff       	call   80436f <va_chunk_scan>
+  804561:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804563:	6a 01                	push   $0x1
+  804565:	89 d9                	mov    %ebx,%ecx
+  804567:	89 c2                	mov    %eax,%edx
+  804569:	89 f0                	mov    %esi,%eax
+  80456b:	e8 a4 fe ff ff       	call   804414 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804570:	c1 e6 16             	shl    $0x16,%esi
+  804573:	c1 e7 0c             	shl    $0xc,%edi
+  804576:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  80457d:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804580:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804583:	5b                   	pop    %ebx
+  804584:	5e                   	pop    %esi
+  804585:	5f                   	pop    %edi
+  804586:	5d                   	pop    %ebp
+  804587:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804588:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  80458e:	c1 ee 0a             	shr    $0xa,%esi
+  804591:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804596:	b8 00 00 00 00       	mov    $0x0,%eax
+  80459b:	eb 0a                	jmp    8045a7 <va_alloc+0xd8>
+			first = c + 1;
+  80459d:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  80459f:	83 c2 01             	add    $0x1,%edx
+  8045a2:	83 fa 1d             	cmp    $0x1d,%edx
+  8045a5:	74 4f                	je     8045f6 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  8045a7:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  8045ad:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  8045b4:	00 04 
+  8045b6:	75 e5                	jne    80459d <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  8045b8:	89 d1                	mov    %edx,%ecx
+  8045ba:	29 c1                	sub    %eax,%ecx
+  8045bc:	39 f1                	cmp    %esi,%ecx
+  8045be:	75 df                	jne    80459f <va_alloc+0xd0>
+  8045c0:	89 c7                	mov    %eax,%edi
+  8045c2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  8045c5:	be 00 04 00 00       	mov    $0x400,%esi
+  8045ca:	39 f3                	cmp    %esi,%ebx
+  8045cc:	0f 46 f3             	cmovbe %ebx,%esi
+  8045cf:	6a 01                	push   $0x1
+  8045d1:	89 f1                	mov    %esi,%ecx
+  8045d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045d8:	89 f8                	mov    %edi,%eax
+  8045da:	e8 35 fe ff ff       	call   804414 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  8045df:	83 c7 01             	add    $0x1,%edi
+  8045e2:	83 c4 04             	add    $0x4,%esp
+  8045e5:	29 f3                	sub    %esi,%ebx
+  8045e7:	75 dc                	jne    8045c5 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  8045e9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8045ec:	c1 e0 16             	shl    $0x16,%eax
+  8045ef:	05 00 00 00 08       	add    $0x8000000,%eax
+  8045f4:	eb 8a                	jmp    804580 <va_alloc+0xb1>
+	return NULL;
+  8045f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045fb:	eb 83                	jmp    804580 <va_alloc+0xb1>
+		return NULL;
+  8045fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804602:	e9 79 ff ff ff       	jmp    804580 <va_alloc+0xb1>
+
+00804607 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804607:	55                   	push   %ebp
+  804608:	89 e5                	mov    %esp,%ebp
+  80460a:	57                   	push   %edi
+  80460b:	56                   	push   %esi
+  80460c:	53                   	push   %ebx
+  80460d:	83 ec 0c             	sub    $0xc,%esp
+  804610:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804613:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804616:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  80461c:	76 21                	jbe    80463f <va_free+0x38>
+  80461e:	89 f0                	mov    %esi,%eax
+  804620:	c1 e0 0c             	shl    $0xc,%eax
+  804623:	01 f8                	add    %edi,%eax
+  804625:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  80462a:	77 13                	ja     80463f <va_free+0x38>
+	    || PGOFF(va))
+  80462c:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804632:	75 0b                	jne    80463f <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804634:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  80463a:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  80463d:	eb 45                	jmp    804684 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  80463f:	83 ec 0c             	sub    $0xc,%esp
+  804642:	56                   	push   %esi
+  804643:	57                   	push   %edi
+  804644:	68 88 58 80 00       	push   $0x805888
+  804649:	68 8e 00 00 00       	push   $0x8e
+  80464e:	68 a8 58 80 00       	push   $0x8058a8
+  804653:	e8 c5 bb ff ff       	call   80021d <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804658:	89 fa                	mov    %edi,%edx
+  80465a:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804660:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804665:	29 d3                	sub    %edx,%ebx
+  804667:	39 f3                	cmp    %esi,%ebx
+  804669:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  80466c:	89 f8                	mov    %edi,%eax
+  80466e:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804671:	83 ec 0c             	sub    $0xc,%esp
+  804674:	6a 00                	push   $0x0
+  804676:	89 d9                	mov    %ebx,%ecx
+  804678:	e8 97 fd ff ff       	call   804414 <va_chunk_mark>
+		i += n;
+  80467d:	01 df                	add    %ebx,%edi
+		npages -= n;
+  80467f:	29 de                	sub    %ebx,%esi
+  804681:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804684:	85 f6                	test   %esi,%esi
+  804686:	75 d0                	jne    804658 <va_free+0x51>
+	}
+}
+  804688:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80468b:	5b                   	pop    %ebx
+  80468c:	5e                   	pop    %esi
+  80468d:	5f                   	pop    %edi
+  80468e:	5d                   	pop    %ebp
+  80468f:	c3                   	ret
+
+00804690 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804690:	b8 00 00 00 00       	mov    $0x0,%eax
+  804695:	c3                   	ret
+
+00804696 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804696:	55                   	push   %ebp
+  804697:	89 e5                	mov    %esp,%ebp
+  804699:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80469c:	68 b5 58 80 00       	push   $0x8058b5
+  8046a1:	ff 75 0c             	push   0xc(%ebp)
+  8046a4:	e8 36 c2 ff ff       	call   8008df <strcpy>
+	return 0;
+}
+  8046a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046ae:	c9                   	leave
+  8046af:	c3                   	ret
+
+008046b0 <devcons_write>:
+{
+  8046b0:	55                   	push   %ebp
+  8046b1:	89 e5                	mov    %esp,%ebp
+  8046b3:	57                   	push   %edi
+  8046b4:	56                   	push   %esi
+  8046b5:	53                   	push   %ebx
+  8046b6:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8046bc:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8046c1:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8046c7:	eb 2e                	jmp    8046f7 <devcons_write+0x47>
+		m = n - tot;
+  8046c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8046cc:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8046ce:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8046d3:	39 c3                	cmp    %eax,%ebx
+  8046d5:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8046d8:	83 ec 04             	sub    $0x4,%esp
+  8046db:	53                   	push   %ebx
+  8046dc:	89 f0                	mov    %esi,%eax
+  8046de:	03 45 0c             	add    0xc(%ebp),%eax
+  8046e1:	50                   	push   %eax
+  8046e2:	57                   	push   %edi
+  8046e3:	e8 7d c3 ff ff       	call   800a65 <memmove>
+		sys_cputs(buf, m);
+  8046e8:	83 c4 08             	add    $0x8,%esp
+  8046eb:	53                   	push   %ebx
+  8046ec:	57                   	push   %edi
+  8046ed:	e8 13 c6 ff ff       	call   800d05 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8046f2:	01 de                	add    %ebx,%esi
+  8046f4:	83 c4 10             	add    $0x10,%esp
+  8046f7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8046fa:	72 cd                	jb     8046c9 <devcons_write+0x19>
+}
+  8046fc:	89 f0                	mov    %esi,%eax
+  8046fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804701:	5b                   	pop    %ebx
+  804702:	5e                   	pop    %esi
+  804703:	5f                   	pop    %edi
+  804704:	5d                   	pop    %ebp
+  804705:	c3                   	ret
+
+00804706 <devcons_read>:
+{
+  804706:	55                   	push   %ebp
+  804707:	89 e5                	mov    %esp,%ebp
+  804709:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80470c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804711:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804715:	75 07                	jne    80471e <devcons_read+0x18>
+  804717:	eb 1f                	jmp    804738 <devcons_read+0x32>
+		sys_yield();
+  804719:	e8 95 c6 ff ff       	call   800db3 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80471e:	e8 11 c6 ff ff       	call   800d34 <sys_cgetc>
+  804723:	85 c0                	test   %eax,%eax
+  804725:	74 f2                	je     804719 <devcons_read+0x13>
+	if (c < 0)
+  804727:	78 0f                	js     804738 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804729:	83 f8 04             	cmp    $0x4,%eax
+  80472c:	74 0c                	je     80473a <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80472e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804731:	88 02                	mov    %al,(%edx)
+	return 1;
+  804733:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804738:	c9                   	leave
+  804739:	c3                   	ret
+		return 0;
+  80473a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80473f:	eb f7                	jmp    804738 <devcons_read+0x32>
+
+00804741 <cputchar>:
+{
+  804741:	55                   	push   %ebp
+  804742:	89 e5                	mov    %esp,%ebp
+  804744:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804747:	8b 45 08             	mov    0x8(%ebp),%eax
+  80474a:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80474d:	6a 01                	push   $0x1
+  80474f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804752:	50                   	push   %eax
+  804753:	e8 ad c5 ff ff       	call   800d05 <sys_cputs>
+}
+  804758:	83 c4 10             	add    $0x10,%esp
+  80475b:	c9                   	leave
+  80475c:	c3                   	ret
+
+0080475d <getchar>:
+{
+  80475d:	55                   	push   %ebp
+  80475e:	89 e5                	mov    %esp,%ebp
+  804760:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804763:	6a 01                	push   $0x1
+  804765:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804768:	50                   	push   %eax
+  804769:	6a 00                	push   $0x0
+  80476b:	e8 d7 ce ff ff       	call   801647 <read>
+	if (r < 0)
+  804770:	83 c4 10             	add    $0x10,%esp
+  804773:	85 c0                	test   %eax,%eax
+  804775:	78 06                	js     80477d <getchar+0x20>
+	if (r < 1)
+  804777:	74 06                	je     80477f <getchar+0x22>
+	return c;
+  804779:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80477d:	c9                   	leave
+  80477e:	c3                   	ret
+		return -E_EOF;
+  80477f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804784:	eb f7                	jmp    80477d <getchar+0x20>
+
+00804786 <iscons>:
+{
+  804786:	55                   	push   %ebp
+  804787:	89 e5                	mov    %esp,%ebp
+  804789:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80478c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80478f:	50                   	push   %eax
+  804790:	ff 75 08             	push   0x8(%ebp)
+  804793:	e8 50 cc ff ff       	call   8013e8 <fd_lookup>
+  804798:	83 c4 10             	add    $0x10,%esp
+  80479b:	85 c0                	test   %eax,%eax
+  80479d:	78 11                	js     8047b0 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80479f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047a2:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  8047a8:	39 10                	cmp    %edx,(%eax)
+  8047aa:	0f 94 c0             	sete   %al
+  8047ad:	0f b6 c0             	movzbl %al,%eax
+}
+  8047b0:	c9                   	leave
+  8047b1:	c3                   	ret
+
+008047b2 <opencons>:
+{
+  8047b2:	55                   	push   %ebp
+  8047b3:	89 e5                	mov    %esp,%ebp
+  8047b5:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8047b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8047bb:	50                   	push   %eax
+  8047bc:	e8 d3 cb ff ff       	call   801394 <fd_alloc>
+  8047c1:	83 c4 10             	add    $0x10,%esp
+  8047c4:	85 c0                	test   %eax,%eax
+  8047c6:	78 3a                	js     804802 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8047c8:	83 ec 04             	sub    $0x4,%esp
+  8047cb:	68 07 04 00 00       	push   $0x407
+  8047d0:	ff 75 f4             	push   -0xc(%ebp)
+  8047d3:	6a 00                	push   $0x0
+  8047d5:	e8 f8 c5 ff ff       	call   800dd2 <sys_page_alloc>
+  8047da:	83 c4 10             	add    $0x10,%esp
+  8047dd:	85 c0                	test   %eax,%eax
+  8047df:	78 21                	js     804802 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8047e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047e4:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  8047ea:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8047ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047ef:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8047f6:	83 ec 0c             	sub    $0xc,%esp
+  8047f9:	50                   	push   %eax
+  8047fa:	e8 6e cb ff ff       	call   80136d <fd2num>
+  8047ff:	83 c4 10             	add    $0x10,%esp
+}
+  804802:	c9                   	leave
+  804803:	c3                   	ret
+
+00804804 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804804:	55                   	push   %ebp
+  804805:	89 e5                	mov    %esp,%ebp
+  804807:	56                   	push   %esi
+  804808:	53                   	push   %ebx
+  804809:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  80480c:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  804811:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804814:	85 db                	test   %ebx,%ebx
+  804816:	78 17                	js     80482f <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804818:	83 ec 0c             	sub    $0xc,%esp
+  80481b:	56                   	push   %esi
+  80481c:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  804823:	83 c4 10             	add    $0x10,%esp
+  804826:	85 c0                	test   %eax,%eax
+  804828:	75 27                	jne    804851 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  80482a:	83 eb 01             	sub    $0x1,%ebx
+  80482d:	eb e5                	jmp    804814 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  80482f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804834:	8b 40 48             	mov    0x48(%eax),%eax
+  804837:	83 ec 08             	sub    $0x8,%esp
+  80483a:	ff 76 28             	push   0x28(%esi)
+  80483d:	ff 36                	push   (%esi)
+  80483f:	50                   	push   %eax
+  804840:	68 c4 58 80 00       	push   $0x8058c4
+  804845:	6a 1d                	push   $0x1d
+  804847:	68 e7 58 80 00       	push   $0x8058e7
+  80484c:	e8 cc b9 ff ff       	call   80021d <_panic>
+}
+  804851:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804854:	5b                   	pop    %ebx
+  804855:	5e                   	pop    %esi
+  804856:	5d                   	pop    %ebp
+  804857:	c3                   	ret
+
+00804858 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804858:	55                   	push   %ebp
+  804859:	89 e5                	mov    %esp,%ebp
+  80485b:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  80485e:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  804865:	74 0a                	je     804871 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804867:	8b 45 08             	mov    0x8(%ebp),%eax
+  80486a:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  80486f:	c9                   	leave
+  804870:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804871:	83 ec 04             	sub    $0x4,%esp
+  804874:	6a 07                	push   $0x7
+  804876:	68 00 f0 bf ee       	push   $0xeebff000
+  80487b:	6a 00                	push   $0x0
+  80487d:	e8 50 c5 ff ff       	call   800dd2 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804882:	83 c4 08             	add    $0x8,%esp
+  804885:	68 f8 48 80 00       	push   $0x8048f8
+  80488a:	6a 00                	push   $0x0
+  80488c:	e8 a7 c8 ff ff       	call   801138 <sys_env_set_pgfault_upcall>
+  804891:	83 c4 10             	add    $0x10,%esp
+  804894:	eb d1                	jmp    804867 <set_pgfault_handler+0xf>
+
+00804896 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804896:	55                   	push   %ebp
+  804897:	89 e5                	mov    %esp,%ebp
+  804899:	83 ec 08             	sub    $0x8,%esp
+  80489c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  80489f:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  8048a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048aa:	eb 03                	jmp    8048af <add_pgfault_handler+0x19>
+  8048ac:	83 c0 01             	add    $0x1,%eax
+  8048af:	39 d0                	cmp    %edx,%eax
+  8048b1:	74 0b                	je     8048be <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  8048b3:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  8048ba:	75 f0                	jne    8048ac <add_pgfault_handler+0x16>
+  8048bc:	eb 24                	jmp    8048e2 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  8048be:	83 fa 0a             	cmp    $0xa,%edx
+  8048c1:	74 21                	je     8048e4 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  8048c3:	8d 42 01             	lea    0x1(%edx),%eax
+  8048c6:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  8048cb:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  8048d2:	83 ec 0c             	sub    $0xc,%esp
+  8048d5:	68 04 48 80 00       	push   $0x804804
+  8048da:	e8 79 ff ff ff       	call   804858 <set_pgfault_handler>
+  8048df:	83 c4 10             	add    $0x10,%esp
+}
+  8048e2:	c9                   	leave
+  8048e3:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  8048e4:	83 ec 04             	sub    $0x4,%esp
+  8048e7:	68 f5 58 80 00       	push   $0x8058f5
+  8048ec:	6a 44                	push   $0x44
+  8048ee:	68 e7 58 80 00       	push   $0x8058e7
+  8048f3:	e8 25 b9 ff ff       	call   80021d <_panic>
+
+008048f8 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8048f8:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8048f9:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  8048fe:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804900:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  804903:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  804907:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  80490b:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  80490e:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  804910:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  804914:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  804917:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  804918:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  80491b:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  80491c:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80491d:	c3                   	ret
+
+0080491e <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  80491e:	55                   	push   %ebp
+  80491f:	89 e5                	mov    %esp,%ebp
+  804921:	57                   	push   %edi
+  804922:	56                   	push   %esi
+  804923:	53                   	push   %ebx
+  804924:	83 ec 14             	sub    $0x14,%esp
+  804927:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80492a:	8b 75 14             	mov    0x14(%ebp),%esi
+  80492d:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804930:	ff 75 10             	push   0x10(%ebp)
+  804933:	ff 75 0c             	push   0xc(%ebp)
+  804936:	e8 ba c8 ff ff       	call   8011f5 <sys_ipc_recv_pages>
+  80493b:	83 c4 10             	add    $0x10,%esp
+  80493e:	85 c0                	test   %eax,%eax
+  804940:	78 46                	js     804988 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804942:	85 ff                	test   %edi,%edi
+  804944:	74 0d                	je     804953 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804946:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80494b:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804951:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804953:	85 f6                	test   %esi,%esi
+  804955:	74 0d                	je     804964 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804957:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80495c:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804962:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804964:	85 db                	test   %ebx,%ebx
+  804966:	74 0d                	je     804975 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804968:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80496d:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804973:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804975:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80497a:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804980:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804983:	5b                   	pop    %ebx
+  804984:	5e                   	pop    %esi
+  804985:	5f                   	pop    %edi
+  804986:	5d                   	pop    %ebp
+  804987:	c3                   	ret
+		if (from_env_store) {
+  804988:	85 ff                	test   %edi,%edi
+  80498a:	74 06                	je     804992 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80498c:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804992:	85 f6                	test   %esi,%esi
+  804994:	74 06                	je     80499c <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804996:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80499c:	85 db                	test   %ebx,%ebx
+  80499e:	74 e0                	je     804980 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8049a0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8049a6:	eb d8                	jmp    804980 <ipc_recv_pages+0x62>
+
+008049a8 <ipc_recv>:
+{
+  8049a8:	55                   	push   %ebp
+  8049a9:	89 e5                	mov    %esp,%ebp
+  8049ab:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8049ae:	6a 00                	push   $0x0
+  8049b0:	ff 75 10             	push   0x10(%ebp)
+  8049b3:	6a 01                	push   $0x1
+  8049b5:	ff 75 0c             	push   0xc(%ebp)
+  8049b8:	ff 75 08             	push   0x8(%ebp)
+  8049bb:	e8 5e ff ff ff       	call   80491e <ipc_recv_pages>
+}
+  8049c0:	c9                   	leave
+  8049c1:	c3                   	ret
+
+008049c2 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8049c2:	55                   	push   %ebp
+  8049c3:	89 e5                	mov    %esp,%ebp
+  8049c5:	56                   	push   %esi
+  8049c6:	53                   	push   %ebx
+  8049c7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8049ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8049cd:	83 ec 0c             	sub    $0xc,%esp
+  8049d0:	ff 75 0c             	push   0xc(%ebp)
+  8049d3:	e8 51 c9 ff ff       	call   801329 <sys_ipc_try_recv>
+  8049d8:	83 c4 10             	add    $0x10,%esp
+  8049db:	85 c0                	test   %eax,%eax
+  8049dd:	78 34                	js     804a13 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8049df:	85 f6                	test   %esi,%esi
+  8049e1:	74 0d                	je     8049f0 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8049e3:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049e8:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8049ee:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8049f0:	85 db                	test   %ebx,%ebx
+  8049f2:	74 0d                	je     804a01 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8049f4:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049f9:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8049ff:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804a01:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804a06:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804a0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804a0f:	5b                   	pop    %ebx
+  804a10:	5e                   	pop    %esi
+  804a11:	5d                   	pop    %ebp
+  804a12:	c3                   	ret
+		if (from_env_store) {
+  804a13:	85 f6                	test   %esi,%esi
+  804a15:	74 06                	je     804a1d <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  804a17:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  804a1d:	85 db                	test   %ebx,%ebx
+  804a1f:	74 eb                	je     804a0c <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  804a21:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804a27:	eb e3                	jmp    804a0c <ipc_try_recv+0x4a>
+
+00804a29 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804a29:	55                   	push   %ebp
+  804a2a:	89 e5                	mov    %esp,%ebp
+  804a2c:	83 ec 14             	sub    $0x14,%esp
+  804a2f:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804a32:	85 c0                	test   %eax,%eax
+  804a34:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804a39:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804a3c:	ff 75 18             	push   0x18(%ebp)
+  804a3f:	ff 75 14             	push   0x14(%ebp)
+  804a42:	50                   	push   %eax
+  804a43:	ff 75 0c             	push   0xc(%ebp)
+  804a46:	ff 75 08             	push   0x8(%ebp)
+  804a49:	e8 6a c7 ff ff       	call   8011b8 <sys_ipc_send_pages>
+  804a4e:	83 c4 20             	add    $0x20,%esp
+  804a51:	85 c0                	test   %eax,%eax
+  804a53:	78 02                	js     804a57 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804a55:	c9                   	leave
+  804a56:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804a57:	50                   	push   %eax
+  804a58:	68 10 59 80 00       	push   $0x805910
+  804a5d:	68 80 00 00 00       	push   $0x80
+  804a62:	68 3c 59 80 00       	push   $0x80593c
+  804a67:	e8 b1 b7 ff ff       	call   80021d <_panic>
+
+00804a6c <ipc_send>:
+{
+  804a6c:	55                   	push   %ebp
+  804a6d:	89 e5                	mov    %esp,%ebp
+  804a6f:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  804a72:	ff 75 14             	push   0x14(%ebp)
+  804a75:	6a 01                	push   $0x1
+  804a77:	ff 75 10             	push   0x10(%ebp)
+  804a7a:	ff 75 0c             	push   0xc(%ebp)
+  804a7d:	ff 75 08             	push   0x8(%ebp)
+  804a80:	e8 a4 ff ff ff       	call   804a29 <ipc_send_pages>
+}
+  804a85:	83 c4 20             	add    $0x20,%esp
+  804a88:	c9                   	leave
+  804a89:	c3                   	ret
+
+00804a8a <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804a8a:	55                   	push   %ebp
+  804a8b:	89 e5                	mov    %esp,%ebp
+  804a8d:	83 ec 14             	sub    $0x14,%esp
+  804a90:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804a93:	85 c0                	test   %eax,%eax
+  804a95:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804a9a:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804a9d:	ff 75 18             	push   0x18(%ebp)
+  804aa0:	ff 75 14             	push   0x14(%ebp)
+  804aa3:	50                   	push   %eax
+  804aa4:	ff 75 0c             	push   0xc(%ebp)
+  804aa7:	ff 75 08             	push   0x8(%ebp)
+  804aaa:	e8 9a c7 ff ff       	call   801249 <sys_ipc_call>
+  804aaf:	83 c4 20             	add    $0x20,%esp
+  804ab2:	85 c0                	test   %eax,%eax
+  804ab4:	78 0b                	js     804ac1 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  804ab6:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804abb:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804ac1:	c9                   	leave
+  804ac2:	c3                   	ret
+
+00804ac3 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  804ac3:	55                   	push   %ebp
+  804ac4:	89 e5                	mov    %esp,%ebp
+  804ac6:	57                   	push   %edi
+  804ac7:	56                   	push   %esi
+  804ac8:	53                   	push   %ebx
+  804ac9:	83 ec 18             	sub    $0x18,%esp
+  804acc:	8b 45 10             	mov    0x10(%ebp),%eax
+  804acf:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  804ad2:	8b 75 20             	mov    0x20(%ebp),%esi
+  804ad5:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804ad8:	85 c0                	test   %eax,%eax
+  804ada:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804adf:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804ae2:	ff 75 18             	push   0x18(%ebp)
+  804ae5:	ff 75 14             	push   0x14(%ebp)
+  804ae8:	50                   	push   %eax
+  804ae9:	ff 75 0c             	push   0xc(%ebp)
+  804aec:	ff 75 08             	push   0x8(%ebp)
+  804aef:	e8 96 c7 ff ff       	call   80128a <sys_ipc_reply_recv>
+  804af4:	83 c4 20             	add    $0x20,%esp
+  804af7:	85 c0                	test   %eax,%eax
+  804af9:	78 46                	js     804b41 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804afb:	85 ff                	test   %edi,%edi
+  804afd:	74 0d                	je     804b0c <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  804aff:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b04:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804b0a:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804b0c:	85 f6                	test   %esi,%esi
+  804b0e:	74 0d                	je     804b1d <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  804b10:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b15:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804b1b:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804b1d:	85 db                	test   %ebx,%ebx
+  804b1f:	74 0d                	je     804b2e <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  804b21:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b26:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804b2c:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804b2e:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b33:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804b39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b3c:	5b                   	pop    %ebx
+  804b3d:	5e                   	pop    %esi
+  804b3e:	5f                   	pop    %edi
+  804b3f:	5d                   	pop    %ebp
+  804b40:	c3                   	ret
+		if (from_env_store) {
+  804b41:	85 ff                	test   %edi,%edi
+  804b43:	74 06                	je     804b4b <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  804b45:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804b4b:	85 f6                	test   %esi,%esi
+  804b4d:	74 06                	je     804b55 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  804b4f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804b55:	85 db                	test   %ebx,%ebx
+  804b57:	74 e0                	je     804b39 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  804b59:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804b5f:	eb d8                	jmp    804b39 <ipc_reply_recv+0x76>
+
+00804b61 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804b61:	55                   	push   %ebp
+  804b62:	89 e5                	mov    %esp,%ebp
+  804b64:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804b67:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804b6c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804b6f:	c1 e0 06             	shl    $0x6,%eax
+  804b72:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804b77:	8b 40 50             	mov    0x50(%eax),%eax
+  804b7a:	39 c8                	cmp    %ecx,%eax
+  804b7c:	74 12                	je     804b90 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804b7e:	83 c2 01             	add    $0x1,%edx
+  804b81:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804b87:	75 e3                	jne    804b6c <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804b89:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b8e:	eb 0e                	jmp    804b9e <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804b90:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804b93:	c1 e0 06             	shl    $0x6,%eax
+  804b96:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804b9b:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804b9e:	5d                   	pop    %ebp
+  804b9f:	c3                   	ret
+
+00804ba0 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804ba0:	55                   	push   %ebp
+  804ba1:	89 e5                	mov    %esp,%ebp
+  804ba3:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804ba6:	89 c2                	mov    %eax,%edx
+  804ba8:	c1 ea 16             	shr    $0x16,%edx
+  804bab:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804bb2:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804bb7:	f6 c1 01             	test   $0x1,%cl
+  804bba:	74 1e                	je     804bda <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  804bbc:	c1 e8 0c             	shr    $0xc,%eax
+  804bbf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804bc6:	a8 01                	test   $0x1,%al
+  804bc8:	74 10                	je     804bda <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804bca:	c1 e8 0c             	shr    $0xc,%eax
+  804bcd:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  804bd0:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  804bd7:	0f b7 d2             	movzwl %dx,%edx
+}
+  804bda:	89 d0                	mov    %edx,%eax
+  804bdc:	5d                   	pop    %ebp
+  804bdd:	c3                   	ret
+
+00804bde <udivmod>:
+  804bde:	55                   	push   %ebp
+  804bdf:	57                   	push   %edi
+  804be0:	56                   	push   %esi
+  804be1:	53                   	push   %ebx
+  804be2:	83 ec 24             	sub    $0x24,%esp
+  804be5:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804be9:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804bed:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804bf1:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804bf5:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804bf9:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804bfd:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  804c01:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804c06:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c10:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804c17:	00 
+  804c18:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804c1f:	00 
+  804c20:	89 fb                	mov    %edi,%ebx
+  804c22:	eb 08                	jmp    804c2c <udivmod+0x4e>
+  804c24:	83 e9 01             	sub    $0x1,%ecx
+  804c27:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804c2a:	74 68                	je     804c94 <udivmod+0xb6>
+  804c2c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804c30:	01 c0                	add    %eax,%eax
+  804c32:	89 c6                	mov    %eax,%esi
+  804c34:	89 d7                	mov    %edx,%edi
+  804c36:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804c3a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804c3e:	0f ad d0             	shrd   %cl,%edx,%eax
+  804c41:	d3 ea                	shr    %cl,%edx
+  804c43:	f6 c1 20             	test   $0x20,%cl
+  804c46:	74 04                	je     804c4c <udivmod+0x6e>
+  804c48:	89 d0                	mov    %edx,%eax
+  804c4a:	31 d2                	xor    %edx,%edx
+  804c4c:	83 e0 01             	and    $0x1,%eax
+  804c4f:	89 04 24             	mov    %eax,(%esp)
+  804c52:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804c59:	00 
+  804c5a:	8b 04 24             	mov    (%esp),%eax
+  804c5d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804c61:	09 f0                	or     %esi,%eax
+  804c63:	09 fa                	or     %edi,%edx
+  804c65:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804c69:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804c6d:	39 f0                	cmp    %esi,%eax
+  804c6f:	89 d5                	mov    %edx,%ebp
+  804c71:	19 fd                	sbb    %edi,%ebp
+  804c73:	72 af                	jb     804c24 <udivmod+0x46>
+  804c75:	29 f0                	sub    %esi,%eax
+  804c77:	19 fa                	sbb    %edi,%edx
+  804c79:	89 cf                	mov    %ecx,%edi
+  804c7b:	c1 ef 05             	shr    $0x5,%edi
+  804c7e:	83 e7 01             	and    $0x1,%edi
+  804c81:	89 fe                	mov    %edi,%esi
+  804c83:	83 f6 01             	xor    $0x1,%esi
+  804c86:	d3 e6                	shl    %cl,%esi
+  804c88:	d3 e7                	shl    %cl,%edi
+  804c8a:	09 74 24 18          	or     %esi,0x18(%esp)
+  804c8e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804c92:	eb 90                	jmp    804c24 <udivmod+0x46>
+  804c94:	85 db                	test   %ebx,%ebx
+  804c96:	74 05                	je     804c9d <udivmod+0xbf>
+  804c98:	89 03                	mov    %eax,(%ebx)
+  804c9a:	89 53 04             	mov    %edx,0x4(%ebx)
+  804c9d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804ca1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804ca5:	83 c4 24             	add    $0x24,%esp
+  804ca8:	5b                   	pop    %ebx
+  804ca9:	5e                   	pop    %esi
+  804caa:	5f                   	pop    %edi
+  804cab:	5d                   	pop    %ebp
+  804cac:	c3                   	ret
+
+00804cad <__udivdi3>:
+  804cad:	83 ec 08             	sub    $0x8,%esp
+  804cb0:	6a 00                	push   $0x0
+  804cb2:	ff 74 24 1c          	push   0x1c(%esp)
+  804cb6:	ff 74 24 1c          	push   0x1c(%esp)
+  804cba:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804cbe:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804cc2:	e8 17 ff ff ff       	call   804bde <udivmod>
+  804cc7:	83 c4 14             	add    $0x14,%esp
+  804cca:	c3                   	ret
+
+00804ccb <__umoddi3>:
+  804ccb:	83 ec 18             	sub    $0x18,%esp
+  804cce:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804cd2:	50                   	push   %eax
+  804cd3:	ff 74 24 2c          	push   0x2c(%esp)
+  804cd7:	ff 74 24 2c          	push   0x2c(%esp)
+  804cdb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804cdf:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804ce3:	e8 f6 fe ff ff       	call   804bde <udivmod>
+  804ce8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804cec:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804cf0:	83 c4 24             	add    $0x24,%esp
+  804cf3:	c3                   	ret
+
+00804cf4 <__divdi3>:
+  804cf4:	55                   	push   %ebp
+  804cf5:	57                   	push   %edi
+  804cf6:	56                   	push   %esi
+  804cf7:	53                   	push   %ebx
+  804cf8:	83 ec 10             	sub    $0x10,%esp
+  804cfb:	8b 44 24 24          	mov    0x24(%esp),%eax
+  804cff:	8b 54 24 28          	mov    0x28(%esp),%edx
+  804d03:	89 c6                	mov    %eax,%esi
+  804d05:	89 d7                	mov    %edx,%edi
+  804d07:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  804d0b:	33 7c 24 30          	xor    0x30(%esp),%edi
+  804d0f:	89 74 24 04          	mov    %esi,0x4(%esp)
+  804d13:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  804d17:	89 c5                	mov    %eax,%ebp
+  804d19:	f7 dd                	neg    %ebp
+  804d1b:	89 d6                	mov    %edx,%esi
+  804d1d:	83 d6 00             	adc    $0x0,%esi
+  804d20:	f7 de                	neg    %esi
+  804d22:	0f 48 e8             	cmovs  %eax,%ebp
+  804d25:	0f 49 d6             	cmovns %esi,%edx
+  804d28:	6a 00                	push   $0x0
+  804d2a:	8b 74 24 30          	mov    0x30(%esp),%esi
+  804d2e:	f7 de                	neg    %esi
+  804d30:	8b 44 24 34          	mov    0x34(%esp),%eax
+  804d34:	83 d0 00             	adc    $0x0,%eax
+  804d37:	f7 d8                	neg    %eax
+  804d39:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  804d3e:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  804d43:	50                   	push   %eax
+  804d44:	56                   	push   %esi
+  804d45:	89 e8                	mov    %ebp,%eax
+  804d47:	e8 92 fe ff ff       	call   804bde <udivmod>
+  804d4c:	83 c4 10             	add    $0x10,%esp
+  804d4f:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  804d54:	78 08                	js     804d5e <__divdi3+0x6a>
+  804d56:	83 c4 0c             	add    $0xc,%esp
+  804d59:	5b                   	pop    %ebx
+  804d5a:	5e                   	pop    %esi
+  804d5b:	5f                   	pop    %edi
+  804d5c:	5d                   	pop    %ebp
+  804d5d:	c3                   	ret
+  804d5e:	f7 d8                	neg    %eax
+  804d60:	83 d2 00             	adc    $0x0,%edx
+  804d63:	f7 da                	neg    %edx
+  804d65:	eb ef                	jmp    804d56 <__divdi3+0x62>
+
+00804d67 <__moddi3>:
+  804d67:	55                   	push   %ebp
+  804d68:	57                   	push   %edi
+  804d69:	56                   	push   %esi
+  804d6a:	53                   	push   %ebx
+  804d6b:	83 ec 18             	sub    $0x18,%esp
+  804d6e:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  804d72:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  804d76:	89 f1                	mov    %esi,%ecx
+  804d78:	f7 d9                	neg    %ecx
+  804d7a:	89 da                	mov    %ebx,%edx
+  804d7c:	83 d2 00             	adc    $0x0,%edx
+  804d7f:	f7 da                	neg    %edx
+  804d81:	0f 48 ce             	cmovs  %esi,%ecx
+  804d84:	0f 48 d3             	cmovs  %ebx,%edx
+  804d87:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804d8b:	50                   	push   %eax
+  804d8c:	8b 74 24 38          	mov    0x38(%esp),%esi
+  804d90:	f7 de                	neg    %esi
+  804d92:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  804d96:	83 d0 00             	adc    $0x0,%eax
+  804d99:	f7 d8                	neg    %eax
+  804d9b:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  804da0:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  804da5:	50                   	push   %eax
+  804da6:	56                   	push   %esi
+  804da7:	89 c8                	mov    %ecx,%eax
+  804da9:	e8 30 fe ff ff       	call   804bde <udivmod>
+  804dae:	83 c4 10             	add    $0x10,%esp
+  804db1:	85 db                	test   %ebx,%ebx
+  804db3:	78 10                	js     804dc5 <__moddi3+0x5e>
+  804db5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804db9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804dbd:	83 c4 14             	add    $0x14,%esp
+  804dc0:	5b                   	pop    %ebx
+  804dc1:	5e                   	pop    %esi
+  804dc2:	5f                   	pop    %edi
+  804dc3:	5d                   	pop    %ebp
+  804dc4:	c3                   	ret
+  804dc5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804dc9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804dcd:	f7 d8                	neg    %eax
+  804dcf:	83 d2 00             	adc    $0x0,%edx
+  804dd2:	f7 da                	neg    %edx
+  804dd4:	eb e7                	jmp    804dbd <__moddi3+0x56>
@@ -0,0 +1,9996 @@
+
+obj/user/linearspecials.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 7c 01 00 00       	call   8001ad <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	uintptr_t va;
+
+	// Setup
+	for(va = 0x10000000; va < 0x14000000; va+=PGSIZE){
+  80003c:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+		cprintf("+%x\n", va);
+  800041:	83 ec 08             	sub    $0x8,%esp
+  800044:	53                   	push   %ebx
+  800045:	68 e0 4d 80 00       	push   $0x804de0
+  80004a:	e8 9c 02 00 00       	call   8002eb <cprintf>
+		if((r = page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W, 1)) < 0)
+  80004f:	6a 01                	push   $0x1
+  800051:	6a 07                	push   $0x7
+  800053:	53                   	push   %ebx
+  800054:	6a 00                	push   $0x0
+  800056:	e8 6c 35 00 00       	call   8035c7 <page_alloc>
+  80005b:	83 c4 20             	add    $0x20,%esp
+  80005e:	85 c0                	test   %eax,%eax
+  800060:	0f 88 ef 00 00 00    	js     800155 <umain+0x122>
+			panic("sys_page_alloc on %p: %e", va, r);
+
+		// Store the address in the page
+		*(uintptr_t*)va = (uintptr_t)va;
+  800066:	89 1b                	mov    %ebx,(%ebx)
+	for(va = 0x10000000; va < 0x14000000; va+=PGSIZE){
+  800068:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80006e:	81 fb 00 00 00 14    	cmp    $0x14000000,%ebx
+  800074:	75 cb                	jne    800041 <umain+0xe>
+	}
+
+	// Try page mapping
+	for(va = 0x10000000; va < 0x1000f000; va += PGSIZE)
+  800076:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+	{
+		cprintf("-%x\n", va);
+  80007b:	83 ec 08             	sub    $0x8,%esp
+  80007e:	53                   	push   %ebx
+  80007f:	68 fe 4d 80 00       	push   $0x804dfe
+  800084:	e8 62 02 00 00       	call   8002eb <cprintf>
+		assert(page_map(0, (void*)va, 0, (void*)(va-PGSIZE), PTE_P|PTE_U) == 0);
+  800089:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+  800090:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  800096:	50                   	push   %eax
+  800097:	6a 00                	push   $0x0
+  800099:	53                   	push   %ebx
+  80009a:	6a 00                	push   $0x0
+  80009c:	e8 87 3b 00 00       	call   803c28 <page_map>
+  8000a1:	83 c4 20             	add    $0x20,%esp
+  8000a4:	85 c0                	test   %eax,%eax
+  8000a6:	0f 85 bf 00 00 00    	jne    80016b <umain+0x138>
+	for(va = 0x10000000; va < 0x1000f000; va += PGSIZE)
+  8000ac:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8000b2:	81 fb 00 f0 00 10    	cmp    $0x1000f000,%ebx
+  8000b8:	75 c1                	jne    80007b <umain+0x48>
+	}
+	cprintf("linearspecials: Done page mapping\n");
+  8000ba:	83 ec 0c             	sub    $0xc,%esp
+  8000bd:	68 a4 4e 80 00       	push   $0x804ea4
+  8000c2:	e8 24 02 00 00       	call   8002eb <cprintf>
+  8000c7:	83 c4 10             	add    $0x10,%esp
+	
+	// Test paging in
+	for(va = 0x10000000; va < 0x1000e000; va+=PGSIZE){
+  8000ca:	be 00 00 00 10       	mov    $0x10000000,%esi
+		cprintf("+%x=%x\n", va, *(uintptr_t*)va);
+  8000cf:	89 f7                	mov    %esi,%edi
+  8000d1:	83 ec 04             	sub    $0x4,%esp
+  8000d4:	ff 36                	push   (%esi)
+  8000d6:	56                   	push   %esi
+  8000d7:	68 18 4e 80 00       	push   $0x804e18
+  8000dc:	e8 0a 02 00 00       	call   8002eb <cprintf>
+		assert(*(uintptr_t*)va == (va+PGSIZE));
+  8000e1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8000e7:	83 c4 10             	add    $0x10,%esp
+  8000ea:	39 37                	cmp    %esi,(%edi)
+  8000ec:	0f 85 8f 00 00 00    	jne    800181 <umain+0x14e>
+	for(va = 0x10000000; va < 0x1000e000; va+=PGSIZE){
+  8000f2:	81 fe 00 e0 00 10    	cmp    $0x1000e000,%esi
+  8000f8:	75 d5                	jne    8000cf <umain+0x9c>
+	}
+	cprintf("linearspecials: Passed paging in\n");
+  8000fa:	83 ec 0c             	sub    $0xc,%esp
+  8000fd:	68 e8 4e 80 00       	push   $0x804ee8
+  800102:	e8 e4 01 00 00       	call   8002eb <cprintf>
+  800107:	83 c4 10             	add    $0x10,%esp
+
+	// Test unmapping paged out page
+	for(va = 0x1000f000; va < 0x1001f000; va += PGSIZE)
+	{
+		cprintf("-%x\n", va);
+  80010a:	83 ec 08             	sub    $0x8,%esp
+  80010d:	53                   	push   %ebx
+  80010e:	68 fe 4d 80 00       	push   $0x804dfe
+  800113:	e8 d3 01 00 00       	call   8002eb <cprintf>
+		assert(page_unmap(0, (void*)va) == 0);
+  800118:	83 c4 08             	add    $0x8,%esp
+  80011b:	53                   	push   %ebx
+  80011c:	6a 00                	push   $0x0
+  80011e:	e8 45 36 00 00       	call   803768 <page_unmap>
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	85 c0                	test   %eax,%eax
+  800128:	75 6d                	jne    800197 <umain+0x164>
+	for(va = 0x1000f000; va < 0x1001f000; va += PGSIZE)
+  80012a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800130:	81 fb 00 f0 01 10    	cmp    $0x1001f000,%ebx
+  800136:	75 d2                	jne    80010a <umain+0xd7>
+	}
+
+	cprintf("linearspecials: Passed all checks!\n");
+  800138:	83 ec 0c             	sub    $0xc,%esp
+  80013b:	68 0c 4f 80 00       	push   $0x804f0c
+  800140:	e8 a6 01 00 00       	call   8002eb <cprintf>
+	get_and_print_paging_stats();
+  800145:	e8 b7 30 00 00       	call   803201 <get_and_print_paging_stats>
+}
+  80014a:	83 c4 10             	add    $0x10,%esp
+  80014d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800150:	5b                   	pop    %ebx
+  800151:	5e                   	pop    %esi
+  800152:	5f                   	pop    %edi
+  800153:	5d                   	pop    %ebp
+  800154:	c3                   	ret
+			panic("sys_page_alloc on %p: %e", va, r);
+  800155:	83 ec 0c             	sub    $0xc,%esp
+  800158:	50                   	push   %eax
+  800159:	53                   	push   %ebx
+  80015a:	68 e5 4d 80 00       	push   $0x804de5
+  80015f:	6a 12                	push   $0x12
+  800161:	68 40 4e 80 00       	push   $0x804e40
+  800166:	e8 a5 00 00 00       	call   800210 <_panic>
+		assert(page_map(0, (void*)va, 0, (void*)(va-PGSIZE), PTE_P|PTE_U) == 0);
+  80016b:	68 64 4e 80 00       	push   $0x804e64
+  800170:	68 03 4e 80 00       	push   $0x804e03
+  800175:	6a 1c                	push   $0x1c
+  800177:	68 40 4e 80 00       	push   $0x804e40
+  80017c:	e8 8f 00 00 00       	call   800210 <_panic>
+		assert(*(uintptr_t*)va == (va+PGSIZE));
+  800181:	68 c8 4e 80 00       	push   $0x804ec8
+  800186:	68 03 4e 80 00       	push   $0x804e03
+  80018b:	6a 23                	push   $0x23
+  80018d:	68 40 4e 80 00       	push   $0x804e40
+  800192:	e8 79 00 00 00       	call   800210 <_panic>
+		assert(page_unmap(0, (void*)va) == 0);
+  800197:	68 20 4e 80 00       	push   $0x804e20
+  80019c:	68 03 4e 80 00       	push   $0x804e03
+  8001a1:	6a 2b                	push   $0x2b
+  8001a3:	68 40 4e 80 00       	push   $0x804e40
+  8001a8:	e8 63 00 00 00       	call   800210 <_panic>
+
+008001ad <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ad:	55                   	push   %ebp
+  8001ae:	89 e5                	mov    %esp,%ebp
+  8001b0:	56                   	push   %esi
+  8001b1:	53                   	push   %ebx
+  8001b2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001b5:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8001b8:	e8 ca 0b 00 00       	call   800d87 <sys_getenvid>
+  8001bd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001c2:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8001c5:	c1 e0 06             	shl    $0x6,%eax
+  8001c8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001cd:	a3 18 e9 80 00       	mov    %eax,0x80e918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001d2:	85 db                	test   %ebx,%ebx
+  8001d4:	7e 07                	jle    8001dd <libmain+0x30>
+		binaryname = argv[0];
+  8001d6:	8b 06                	mov    (%esi),%eax
+  8001d8:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  8001dd:	83 ec 08             	sub    $0x8,%esp
+  8001e0:	56                   	push   %esi
+  8001e1:	53                   	push   %ebx
+  8001e2:	e8 4c fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8001e7:	e8 0a 00 00 00       	call   8001f6 <exit>
+}
+  8001ec:	83 c4 10             	add    $0x10,%esp
+  8001ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001f2:	5b                   	pop    %ebx
+  8001f3:	5e                   	pop    %esi
+  8001f4:	5d                   	pop    %ebp
+  8001f5:	c3                   	ret
+
+008001f6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001f6:	55                   	push   %ebp
+  8001f7:	89 e5                	mov    %esp,%ebp
+  8001f9:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001fc:	e8 2a 13 00 00       	call   80152b <close_all>
+	sys_env_destroy(0);
+  800201:	83 ec 0c             	sub    $0xc,%esp
+  800204:	6a 00                	push   $0x0
+  800206:	e8 3b 0b 00 00       	call   800d46 <sys_env_destroy>
+}
+  80020b:	83 c4 10             	add    $0x10,%esp
+  80020e:	c9                   	leave
+  80020f:	c3                   	ret
+
+00800210 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800210:	55                   	push   %ebp
+  800211:	89 e5                	mov    %esp,%ebp
+  800213:	56                   	push   %esi
+  800214:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800215:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800218:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80021e:	e8 64 0b 00 00       	call   800d87 <sys_getenvid>
+  800223:	83 ec 0c             	sub    $0xc,%esp
+  800226:	ff 75 0c             	push   0xc(%ebp)
+  800229:	ff 75 08             	push   0x8(%ebp)
+  80022c:	56                   	push   %esi
+  80022d:	50                   	push   %eax
+  80022e:	68 3c 4f 80 00       	push   $0x804f3c
+  800233:	e8 b3 00 00 00       	call   8002eb <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800238:	83 c4 18             	add    $0x18,%esp
+  80023b:	53                   	push   %ebx
+  80023c:	ff 75 10             	push   0x10(%ebp)
+  80023f:	e8 56 00 00 00       	call   80029a <vcprintf>
+	cprintf("\n");
+  800244:	c7 04 24 dc 53 80 00 	movl   $0x8053dc,(%esp)
+  80024b:	e8 9b 00 00 00       	call   8002eb <cprintf>
+  800250:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800253:	cc                   	int3
+	while (1)
+  800254:	eb fd                	jmp    800253 <_panic+0x43>
+
+00800256 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800256:	55                   	push   %ebp
+  800257:	89 e5                	mov    %esp,%ebp
+  800259:	53                   	push   %ebx
+  80025a:	83 ec 04             	sub    $0x4,%esp
+  80025d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800260:	8b 13                	mov    (%ebx),%edx
+  800262:	8d 42 01             	lea    0x1(%edx),%eax
+  800265:	89 03                	mov    %eax,(%ebx)
+  800267:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80026a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80026e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800273:	74 09                	je     80027e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800275:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800279:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80027c:	c9                   	leave
+  80027d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80027e:	83 ec 08             	sub    $0x8,%esp
+  800281:	68 ff 00 00 00       	push   $0xff
+  800286:	8d 43 08             	lea    0x8(%ebx),%eax
+  800289:	50                   	push   %eax
+  80028a:	e8 69 0a 00 00       	call   800cf8 <sys_cputs>
+		b->idx = 0;
+  80028f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800295:	83 c4 10             	add    $0x10,%esp
+  800298:	eb db                	jmp    800275 <putch+0x1f>
+
+0080029a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80029a:	55                   	push   %ebp
+  80029b:	89 e5                	mov    %esp,%ebp
+  80029d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002a3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002aa:	00 00 00 
+	b.cnt = 0;
+  8002ad:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002b4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002b7:	ff 75 0c             	push   0xc(%ebp)
+  8002ba:	ff 75 08             	push   0x8(%ebp)
+  8002bd:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002c3:	50                   	push   %eax
+  8002c4:	68 56 02 80 00       	push   $0x800256
+  8002c9:	e8 14 01 00 00       	call   8003e2 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002ce:	83 c4 08             	add    $0x8,%esp
+  8002d1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002d7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002dd:	50                   	push   %eax
+  8002de:	e8 15 0a 00 00       	call   800cf8 <sys_cputs>
+
+	return b.cnt;
+}
+  8002e3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002e9:	c9                   	leave
+  8002ea:	c3                   	ret
+
+008002eb <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002eb:	55                   	push   %ebp
+  8002ec:	89 e5                	mov    %esp,%ebp
+  8002ee:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002f1:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002f4:	50                   	push   %eax
+  8002f5:	ff 75 08             	push   0x8(%ebp)
+  8002f8:	e8 9d ff ff ff       	call   80029a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002fd:	c9                   	leave
+  8002fe:	c3                   	ret
+
+008002ff <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002ff:	55                   	push   %ebp
+  800300:	89 e5                	mov    %esp,%ebp
+  800302:	57                   	push   %edi
+  800303:	56                   	push   %esi
+  800304:	53                   	push   %ebx
+  800305:	83 ec 1c             	sub    $0x1c,%esp
+  800308:	89 c7                	mov    %eax,%edi
+  80030a:	89 d6                	mov    %edx,%esi
+  80030c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80030f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800312:	89 d1                	mov    %edx,%ecx
+  800314:	89 c2                	mov    %eax,%edx
+  800316:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800319:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80031c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80031f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800322:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800325:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80032c:	39 c2                	cmp    %eax,%edx
+  80032e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800331:	72 3e                	jb     800371 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800333:	83 ec 0c             	sub    $0xc,%esp
+  800336:	ff 75 18             	push   0x18(%ebp)
+  800339:	83 eb 01             	sub    $0x1,%ebx
+  80033c:	53                   	push   %ebx
+  80033d:	50                   	push   %eax
+  80033e:	83 ec 08             	sub    $0x8,%esp
+  800341:	ff 75 e4             	push   -0x1c(%ebp)
+  800344:	ff 75 e0             	push   -0x20(%ebp)
+  800347:	ff 75 dc             	push   -0x24(%ebp)
+  80034a:	ff 75 d8             	push   -0x28(%ebp)
+  80034d:	e8 4e 49 00 00       	call   804ca0 <__udivdi3>
+  800352:	83 c4 18             	add    $0x18,%esp
+  800355:	52                   	push   %edx
+  800356:	50                   	push   %eax
+  800357:	89 f2                	mov    %esi,%edx
+  800359:	89 f8                	mov    %edi,%eax
+  80035b:	e8 9f ff ff ff       	call   8002ff <printnum>
+  800360:	83 c4 20             	add    $0x20,%esp
+  800363:	eb 13                	jmp    800378 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800365:	83 ec 08             	sub    $0x8,%esp
+  800368:	56                   	push   %esi
+  800369:	ff 75 18             	push   0x18(%ebp)
+  80036c:	ff d7                	call   *%edi
+  80036e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800371:	83 eb 01             	sub    $0x1,%ebx
+  800374:	85 db                	test   %ebx,%ebx
+  800376:	7f ed                	jg     800365 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800378:	83 ec 08             	sub    $0x8,%esp
+  80037b:	56                   	push   %esi
+  80037c:	83 ec 04             	sub    $0x4,%esp
+  80037f:	ff 75 e4             	push   -0x1c(%ebp)
+  800382:	ff 75 e0             	push   -0x20(%ebp)
+  800385:	ff 75 dc             	push   -0x24(%ebp)
+  800388:	ff 75 d8             	push   -0x28(%ebp)
+  80038b:	e8 2e 49 00 00       	call   804cbe <__umoddi3>
+  800390:	83 c4 14             	add    $0x14,%esp
+  800393:	0f be 80 5f 4f 80 00 	movsbl 0x804f5f(%eax),%eax
+  80039a:	50                   	push   %eax
+  80039b:	ff d7                	call   *%edi
+}
+  80039d:	83 c4 10             	add    $0x10,%esp
+  8003a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a3:	5b                   	pop    %ebx
+  8003a4:	5e                   	pop    %esi
+  8003a5:	5f                   	pop    %edi
+  8003a6:	5d                   	pop    %ebp
+  8003a7:	c3                   	ret
+
+008003a8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003a8:	55                   	push   %ebp
+  8003a9:	89 e5                	mov    %esp,%ebp
+  8003ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003ae:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003b2:	8b 10                	mov    (%eax),%edx
+  8003b4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003b7:	73 0a                	jae    8003c3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003b9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003bc:	89 08                	mov    %ecx,(%eax)
+  8003be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003c1:	88 02                	mov    %al,(%edx)
+}
+  8003c3:	5d                   	pop    %ebp
+  8003c4:	c3                   	ret
+
+008003c5 <printfmt>:
+{
+  8003c5:	55                   	push   %ebp
+  8003c6:	89 e5                	mov    %esp,%ebp
+  8003c8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003cb:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003ce:	50                   	push   %eax
+  8003cf:	ff 75 10             	push   0x10(%ebp)
+  8003d2:	ff 75 0c             	push   0xc(%ebp)
+  8003d5:	ff 75 08             	push   0x8(%ebp)
+  8003d8:	e8 05 00 00 00       	call   8003e2 <vprintfmt>
+}
+  8003dd:	83 c4 10             	add    $0x10,%esp
+  8003e0:	c9                   	leave
+  8003e1:	c3                   	ret
+
+008003e2 <vprintfmt>:
+{
+  8003e2:	55                   	push   %ebp
+  8003e3:	89 e5                	mov    %esp,%ebp
+  8003e5:	57                   	push   %edi
+  8003e6:	56                   	push   %esi
+  8003e7:	53                   	push   %ebx
+  8003e8:	83 ec 2c             	sub    $0x2c,%esp
+  8003eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003ee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003f1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003f4:	eb 0a                	jmp    800400 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003f6:	83 ec 08             	sub    $0x8,%esp
+  8003f9:	53                   	push   %ebx
+  8003fa:	50                   	push   %eax
+  8003fb:	ff d6                	call   *%esi
+  8003fd:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800400:	83 c7 01             	add    $0x1,%edi
+  800403:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800407:	83 f8 25             	cmp    $0x25,%eax
+  80040a:	74 0c                	je     800418 <vprintfmt+0x36>
+			if (ch == '\0')
+  80040c:	85 c0                	test   %eax,%eax
+  80040e:	75 e6                	jne    8003f6 <vprintfmt+0x14>
+}
+  800410:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800413:	5b                   	pop    %ebx
+  800414:	5e                   	pop    %esi
+  800415:	5f                   	pop    %edi
+  800416:	5d                   	pop    %ebp
+  800417:	c3                   	ret
+		padc = ' ';
+  800418:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80041c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800423:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80042a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800431:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800436:	8d 47 01             	lea    0x1(%edi),%eax
+  800439:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80043c:	0f b6 17             	movzbl (%edi),%edx
+  80043f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800442:	3c 55                	cmp    $0x55,%al
+  800444:	0f 87 c5 03 00 00    	ja     80080f <vprintfmt+0x42d>
+  80044a:	0f b6 c0             	movzbl %al,%eax
+  80044d:	ff 24 85 e0 50 80 00 	jmp    *0x8050e0(,%eax,4)
+  800454:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800457:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80045b:	eb d9                	jmp    800436 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80045d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800460:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800464:	eb d0                	jmp    800436 <vprintfmt+0x54>
+  800466:	0f b6 d2             	movzbl %dl,%edx
+  800469:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80046c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800471:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800474:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800477:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80047b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80047e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800481:	83 f9 09             	cmp    $0x9,%ecx
+  800484:	77 55                	ja     8004db <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800486:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800489:	eb e9                	jmp    800474 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80048b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048e:	8b 00                	mov    (%eax),%eax
+  800490:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800493:	8b 45 14             	mov    0x14(%ebp),%eax
+  800496:	8d 40 04             	lea    0x4(%eax),%eax
+  800499:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80049c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80049f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004a3:	79 91                	jns    800436 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004a5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004a8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ab:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004b2:	eb 82                	jmp    800436 <vprintfmt+0x54>
+			if (width < 0)
+  8004b4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004b7:	85 d2                	test   %edx,%edx
+  8004b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004be:	0f 49 c2             	cmovns %edx,%eax
+  8004c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004c4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004c7:	e9 6a ff ff ff       	jmp    800436 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004cf:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004d6:	e9 5b ff ff ff       	jmp    800436 <vprintfmt+0x54>
+  8004db:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004de:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004e1:	eb bc                	jmp    80049f <vprintfmt+0xbd>
+			lflag++;
+  8004e3:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004e9:	e9 48 ff ff ff       	jmp    800436 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f1:	8d 78 04             	lea    0x4(%eax),%edi
+  8004f4:	83 ec 08             	sub    $0x8,%esp
+  8004f7:	53                   	push   %ebx
+  8004f8:	ff 30                	push   (%eax)
+  8004fa:	ff d6                	call   *%esi
+			break;
+  8004fc:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004ff:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800502:	e9 63 02 00 00       	jmp    80076a <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800507:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050a:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80050d:	8b 10                	mov    (%eax),%edx
+  80050f:	89 d0                	mov    %edx,%eax
+  800511:	f7 d8                	neg    %eax
+  800513:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800516:	83 f8 12             	cmp    $0x12,%eax
+  800519:	7f 23                	jg     80053e <vprintfmt+0x15c>
+  80051b:	8b 14 85 40 52 80 00 	mov    0x805240(,%eax,4),%edx
+  800522:	85 d2                	test   %edx,%edx
+  800524:	74 18                	je     80053e <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800526:	52                   	push   %edx
+  800527:	68 15 4e 80 00       	push   $0x804e15
+  80052c:	53                   	push   %ebx
+  80052d:	56                   	push   %esi
+  80052e:	e8 92 fe ff ff       	call   8003c5 <printfmt>
+  800533:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800536:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800539:	e9 2c 02 00 00       	jmp    80076a <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80053e:	50                   	push   %eax
+  80053f:	68 77 4f 80 00       	push   $0x804f77
+  800544:	53                   	push   %ebx
+  800545:	56                   	push   %esi
+  800546:	e8 7a fe ff ff       	call   8003c5 <printfmt>
+  80054b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80054e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800551:	e9 14 02 00 00       	jmp    80076a <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800556:	8b 45 14             	mov    0x14(%ebp),%eax
+  800559:	83 c0 04             	add    $0x4,%eax
+  80055c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80055f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800562:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800564:	85 c9                	test   %ecx,%ecx
+  800566:	b8 70 4f 80 00       	mov    $0x804f70,%eax
+  80056b:	0f 45 c1             	cmovne %ecx,%eax
+  80056e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800571:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800575:	7e 06                	jle    80057d <vprintfmt+0x19b>
+  800577:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80057b:	75 0b                	jne    800588 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80057d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800580:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800583:	89 75 08             	mov    %esi,0x8(%ebp)
+  800586:	eb 5c                	jmp    8005e4 <vprintfmt+0x202>
+  800588:	83 ec 08             	sub    $0x8,%esp
+  80058b:	ff 75 d0             	push   -0x30(%ebp)
+  80058e:	ff 75 cc             	push   -0x34(%ebp)
+  800591:	e8 19 03 00 00       	call   8008af <strnlen>
+  800596:	89 c2                	mov    %eax,%edx
+  800598:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80059b:	29 d0                	sub    %edx,%eax
+  80059d:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005a0:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005a4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005a7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005aa:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005ac:	eb 0e                	jmp    8005bc <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005ae:	83 ec 08             	sub    $0x8,%esp
+  8005b1:	53                   	push   %ebx
+  8005b2:	57                   	push   %edi
+  8005b3:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005b6:	83 ee 01             	sub    $0x1,%esi
+  8005b9:	83 c4 10             	add    $0x10,%esp
+  8005bc:	85 f6                	test   %esi,%esi
+  8005be:	7f ee                	jg     8005ae <vprintfmt+0x1cc>
+  8005c0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005c6:	85 c0                	test   %eax,%eax
+  8005c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005cd:	0f 49 d0             	cmovns %eax,%edx
+  8005d0:	29 d0                	sub    %edx,%eax
+  8005d2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005d5:	eb a6                	jmp    80057d <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005d7:	83 ec 08             	sub    $0x8,%esp
+  8005da:	53                   	push   %ebx
+  8005db:	52                   	push   %edx
+  8005dc:	ff 55 08             	call   *0x8(%ebp)
+  8005df:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005e2:	89 f1                	mov    %esi,%ecx
+  8005e4:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005e7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005eb:	0f be d0             	movsbl %al,%edx
+  8005ee:	85 d2                	test   %edx,%edx
+  8005f0:	74 28                	je     80061a <vprintfmt+0x238>
+  8005f2:	85 ff                	test   %edi,%edi
+  8005f4:	78 05                	js     8005fb <vprintfmt+0x219>
+  8005f6:	83 ef 01             	sub    $0x1,%edi
+  8005f9:	78 30                	js     80062b <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005fb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005ff:	74 d6                	je     8005d7 <vprintfmt+0x1f5>
+  800601:	0f be c0             	movsbl %al,%eax
+  800604:	83 e8 20             	sub    $0x20,%eax
+  800607:	83 f8 5e             	cmp    $0x5e,%eax
+  80060a:	76 cb                	jbe    8005d7 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80060c:	83 ec 08             	sub    $0x8,%esp
+  80060f:	53                   	push   %ebx
+  800610:	6a 3f                	push   $0x3f
+  800612:	ff 55 08             	call   *0x8(%ebp)
+  800615:	83 c4 10             	add    $0x10,%esp
+  800618:	eb c8                	jmp    8005e2 <vprintfmt+0x200>
+  80061a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80061d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800620:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800623:	01 d0                	add    %edx,%eax
+  800625:	29 c8                	sub    %ecx,%eax
+  800627:	89 c7                	mov    %eax,%edi
+  800629:	eb 13                	jmp    80063e <vprintfmt+0x25c>
+  80062b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80062e:	eb ed                	jmp    80061d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800630:	83 ec 08             	sub    $0x8,%esp
+  800633:	53                   	push   %ebx
+  800634:	6a 20                	push   $0x20
+  800636:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800638:	83 ef 01             	sub    $0x1,%edi
+  80063b:	83 c4 10             	add    $0x10,%esp
+  80063e:	85 ff                	test   %edi,%edi
+  800640:	7f ee                	jg     800630 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800642:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800645:	89 45 14             	mov    %eax,0x14(%ebp)
+  800648:	e9 1d 01 00 00       	jmp    80076a <vprintfmt+0x388>
+	if (lflag >= 2)
+  80064d:	83 f9 01             	cmp    $0x1,%ecx
+  800650:	7f 1b                	jg     80066d <vprintfmt+0x28b>
+	else if (lflag)
+  800652:	85 c9                	test   %ecx,%ecx
+  800654:	74 63                	je     8006b9 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800656:	8b 45 14             	mov    0x14(%ebp),%eax
+  800659:	8b 00                	mov    (%eax),%eax
+  80065b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80065e:	99                   	cltd
+  80065f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800662:	8b 45 14             	mov    0x14(%ebp),%eax
+  800665:	8d 40 04             	lea    0x4(%eax),%eax
+  800668:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066b:	eb 17                	jmp    800684 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80066d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800670:	8b 50 04             	mov    0x4(%eax),%edx
+  800673:	8b 00                	mov    (%eax),%eax
+  800675:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800678:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	8d 40 08             	lea    0x8(%eax),%eax
+  800681:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800684:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800687:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80068a:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80068f:	85 c9                	test   %ecx,%ecx
+  800691:	0f 89 b9 00 00 00    	jns    800750 <vprintfmt+0x36e>
+				putch('-', putdat);
+  800697:	83 ec 08             	sub    $0x8,%esp
+  80069a:	53                   	push   %ebx
+  80069b:	6a 2d                	push   $0x2d
+  80069d:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80069f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006a2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006a5:	f7 da                	neg    %edx
+  8006a7:	83 d1 00             	adc    $0x0,%ecx
+  8006aa:	f7 d9                	neg    %ecx
+  8006ac:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006af:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006b4:	e9 97 00 00 00       	jmp    800750 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8006b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bc:	8b 00                	mov    (%eax),%eax
+  8006be:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006c1:	99                   	cltd
+  8006c2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ce:	eb b4                	jmp    800684 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8006d0:	83 f9 01             	cmp    $0x1,%ecx
+  8006d3:	7f 1b                	jg     8006f0 <vprintfmt+0x30e>
+	else if (lflag)
+  8006d5:	85 c9                	test   %ecx,%ecx
+  8006d7:	74 2c                	je     800705 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8006d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dc:	8b 10                	mov    (%eax),%edx
+  8006de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006e9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006ee:	eb 60                	jmp    800750 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8006f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f3:	8b 10                	mov    (%eax),%edx
+  8006f5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f8:	8d 40 08             	lea    0x8(%eax),%eax
+  8006fb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006fe:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800703:	eb 4b                	jmp    800750 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800705:	8b 45 14             	mov    0x14(%ebp),%eax
+  800708:	8b 10                	mov    (%eax),%edx
+  80070a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070f:	8d 40 04             	lea    0x4(%eax),%eax
+  800712:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800715:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80071a:	eb 34                	jmp    800750 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80071c:	83 f9 01             	cmp    $0x1,%ecx
+  80071f:	7f 15                	jg     800736 <vprintfmt+0x354>
+	else if (lflag)
+  800721:	85 c9                	test   %ecx,%ecx
+  800723:	74 4d                	je     800772 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800725:	8b 45 14             	mov    0x14(%ebp),%eax
+  800728:	8b 00                	mov    (%eax),%eax
+  80072a:	99                   	cltd
+  80072b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80072e:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800731:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800734:	eb 11                	jmp    800747 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800736:	8b 45 14             	mov    0x14(%ebp),%eax
+  800739:	8b 50 04             	mov    0x4(%eax),%edx
+  80073c:	8b 00                	mov    (%eax),%eax
+  80073e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800741:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800744:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800747:	89 d1                	mov    %edx,%ecx
+  800749:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  80074b:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800750:	83 ec 0c             	sub    $0xc,%esp
+  800753:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800757:	50                   	push   %eax
+  800758:	ff 75 e0             	push   -0x20(%ebp)
+  80075b:	57                   	push   %edi
+  80075c:	51                   	push   %ecx
+  80075d:	52                   	push   %edx
+  80075e:	89 da                	mov    %ebx,%edx
+  800760:	89 f0                	mov    %esi,%eax
+  800762:	e8 98 fb ff ff       	call   8002ff <printnum>
+			break;
+  800767:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80076a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80076d:	e9 8e fc ff ff       	jmp    800400 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800772:	8b 45 14             	mov    0x14(%ebp),%eax
+  800775:	8b 00                	mov    (%eax),%eax
+  800777:	99                   	cltd
+  800778:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80077b:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80077e:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800781:	eb c4                	jmp    800747 <vprintfmt+0x365>
+			putch('0', putdat);
+  800783:	83 ec 08             	sub    $0x8,%esp
+  800786:	53                   	push   %ebx
+  800787:	6a 30                	push   $0x30
+  800789:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80078b:	83 c4 08             	add    $0x8,%esp
+  80078e:	53                   	push   %ebx
+  80078f:	6a 78                	push   $0x78
+  800791:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800793:	8b 45 14             	mov    0x14(%ebp),%eax
+  800796:	8b 10                	mov    (%eax),%edx
+  800798:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80079d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007a6:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8007ab:	eb a3                	jmp    800750 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8007ad:	83 f9 01             	cmp    $0x1,%ecx
+  8007b0:	7f 1b                	jg     8007cd <vprintfmt+0x3eb>
+	else if (lflag)
+  8007b2:	85 c9                	test   %ecx,%ecx
+  8007b4:	74 2f                	je     8007e5 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8007b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b9:	8b 10                	mov    (%eax),%edx
+  8007bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007cb:	eb 83                	jmp    800750 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8007cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d0:	8b 10                	mov    (%eax),%edx
+  8007d2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007d5:	8d 40 08             	lea    0x8(%eax),%eax
+  8007d8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007db:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007e0:	e9 6b ff ff ff       	jmp    800750 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8007e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e8:	8b 10                	mov    (%eax),%edx
+  8007ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007fa:	e9 51 ff ff ff       	jmp    800750 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8007ff:	83 ec 08             	sub    $0x8,%esp
+  800802:	53                   	push   %ebx
+  800803:	6a 25                	push   $0x25
+  800805:	ff d6                	call   *%esi
+			break;
+  800807:	83 c4 10             	add    $0x10,%esp
+  80080a:	e9 5b ff ff ff       	jmp    80076a <vprintfmt+0x388>
+			putch('%', putdat);
+  80080f:	83 ec 08             	sub    $0x8,%esp
+  800812:	53                   	push   %ebx
+  800813:	6a 25                	push   $0x25
+  800815:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800817:	83 c4 10             	add    $0x10,%esp
+  80081a:	89 f8                	mov    %edi,%eax
+  80081c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800820:	74 05                	je     800827 <vprintfmt+0x445>
+  800822:	83 e8 01             	sub    $0x1,%eax
+  800825:	eb f5                	jmp    80081c <vprintfmt+0x43a>
+  800827:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80082a:	e9 3b ff ff ff       	jmp    80076a <vprintfmt+0x388>
+
+0080082f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80082f:	55                   	push   %ebp
+  800830:	89 e5                	mov    %esp,%ebp
+  800832:	83 ec 18             	sub    $0x18,%esp
+  800835:	8b 45 08             	mov    0x8(%ebp),%eax
+  800838:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80083b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80083e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800842:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800845:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80084c:	85 c0                	test   %eax,%eax
+  80084e:	74 26                	je     800876 <vsnprintf+0x47>
+  800850:	85 d2                	test   %edx,%edx
+  800852:	7e 22                	jle    800876 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800854:	ff 75 14             	push   0x14(%ebp)
+  800857:	ff 75 10             	push   0x10(%ebp)
+  80085a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80085d:	50                   	push   %eax
+  80085e:	68 a8 03 80 00       	push   $0x8003a8
+  800863:	e8 7a fb ff ff       	call   8003e2 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800868:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80086b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80086e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800871:	83 c4 10             	add    $0x10,%esp
+}
+  800874:	c9                   	leave
+  800875:	c3                   	ret
+		return -E_INVAL;
+  800876:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80087b:	eb f7                	jmp    800874 <vsnprintf+0x45>
+
+0080087d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80087d:	55                   	push   %ebp
+  80087e:	89 e5                	mov    %esp,%ebp
+  800880:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800883:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800886:	50                   	push   %eax
+  800887:	ff 75 10             	push   0x10(%ebp)
+  80088a:	ff 75 0c             	push   0xc(%ebp)
+  80088d:	ff 75 08             	push   0x8(%ebp)
+  800890:	e8 9a ff ff ff       	call   80082f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800895:	c9                   	leave
+  800896:	c3                   	ret
+
+00800897 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800897:	55                   	push   %ebp
+  800898:	89 e5                	mov    %esp,%ebp
+  80089a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80089d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a2:	eb 03                	jmp    8008a7 <strlen+0x10>
+		n++;
+  8008a4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008a7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008ab:	75 f7                	jne    8008a4 <strlen+0xd>
+	return n;
+}
+  8008ad:	5d                   	pop    %ebp
+  8008ae:	c3                   	ret
+
+008008af <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008af:	55                   	push   %ebp
+  8008b0:	89 e5                	mov    %esp,%ebp
+  8008b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008bd:	eb 03                	jmp    8008c2 <strnlen+0x13>
+		n++;
+  8008bf:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008c2:	39 d0                	cmp    %edx,%eax
+  8008c4:	74 08                	je     8008ce <strnlen+0x1f>
+  8008c6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008ca:	75 f3                	jne    8008bf <strnlen+0x10>
+  8008cc:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008ce:	89 d0                	mov    %edx,%eax
+  8008d0:	5d                   	pop    %ebp
+  8008d1:	c3                   	ret
+
+008008d2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008d2:	55                   	push   %ebp
+  8008d3:	89 e5                	mov    %esp,%ebp
+  8008d5:	53                   	push   %ebx
+  8008d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008e5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008e8:	83 c0 01             	add    $0x1,%eax
+  8008eb:	84 d2                	test   %dl,%dl
+  8008ed:	75 f2                	jne    8008e1 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008ef:	89 c8                	mov    %ecx,%eax
+  8008f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008f4:	c9                   	leave
+  8008f5:	c3                   	ret
+
+008008f6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008f6:	55                   	push   %ebp
+  8008f7:	89 e5                	mov    %esp,%ebp
+  8008f9:	53                   	push   %ebx
+  8008fa:	83 ec 10             	sub    $0x10,%esp
+  8008fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800900:	53                   	push   %ebx
+  800901:	e8 91 ff ff ff       	call   800897 <strlen>
+  800906:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800909:	ff 75 0c             	push   0xc(%ebp)
+  80090c:	01 d8                	add    %ebx,%eax
+  80090e:	50                   	push   %eax
+  80090f:	e8 be ff ff ff       	call   8008d2 <strcpy>
+	return dst;
+}
+  800914:	89 d8                	mov    %ebx,%eax
+  800916:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800919:	c9                   	leave
+  80091a:	c3                   	ret
+
+0080091b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80091b:	55                   	push   %ebp
+  80091c:	89 e5                	mov    %esp,%ebp
+  80091e:	56                   	push   %esi
+  80091f:	53                   	push   %ebx
+  800920:	8b 75 08             	mov    0x8(%ebp),%esi
+  800923:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800926:	89 f3                	mov    %esi,%ebx
+  800928:	03 5d 10             	add    0x10(%ebp),%ebx
+  80092b:	89 f0                	mov    %esi,%eax
+  80092d:	eb 0f                	jmp    80093e <strncpy+0x23>
+		*dst++ = *src;
+  80092f:	83 c0 01             	add    $0x1,%eax
+  800932:	0f b6 0a             	movzbl (%edx),%ecx
+  800935:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800938:	80 f9 01             	cmp    $0x1,%cl
+  80093b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80093e:	39 d8                	cmp    %ebx,%eax
+  800940:	75 ed                	jne    80092f <strncpy+0x14>
+	}
+	return ret;
+}
+  800942:	89 f0                	mov    %esi,%eax
+  800944:	5b                   	pop    %ebx
+  800945:	5e                   	pop    %esi
+  800946:	5d                   	pop    %ebp
+  800947:	c3                   	ret
+
+00800948 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800948:	55                   	push   %ebp
+  800949:	89 e5                	mov    %esp,%ebp
+  80094b:	56                   	push   %esi
+  80094c:	53                   	push   %ebx
+  80094d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800950:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800953:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800956:	89 f0                	mov    %esi,%eax
+  800958:	85 d2                	test   %edx,%edx
+  80095a:	74 21                	je     80097d <strlcpy+0x35>
+  80095c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800960:	89 f2                	mov    %esi,%edx
+  800962:	eb 09                	jmp    80096d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800964:	83 c1 01             	add    $0x1,%ecx
+  800967:	83 c2 01             	add    $0x1,%edx
+  80096a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80096d:	39 c2                	cmp    %eax,%edx
+  80096f:	74 09                	je     80097a <strlcpy+0x32>
+  800971:	0f b6 19             	movzbl (%ecx),%ebx
+  800974:	84 db                	test   %bl,%bl
+  800976:	75 ec                	jne    800964 <strlcpy+0x1c>
+  800978:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80097a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80097d:	29 f0                	sub    %esi,%eax
+}
+  80097f:	5b                   	pop    %ebx
+  800980:	5e                   	pop    %esi
+  800981:	5d                   	pop    %ebp
+  800982:	c3                   	ret
+
+00800983 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800983:	55                   	push   %ebp
+  800984:	89 e5                	mov    %esp,%ebp
+  800986:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800989:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80098c:	eb 06                	jmp    800994 <strcmp+0x11>
+		p++, q++;
+  80098e:	83 c1 01             	add    $0x1,%ecx
+  800991:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800994:	0f b6 01             	movzbl (%ecx),%eax
+  800997:	84 c0                	test   %al,%al
+  800999:	74 04                	je     80099f <strcmp+0x1c>
+  80099b:	3a 02                	cmp    (%edx),%al
+  80099d:	74 ef                	je     80098e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80099f:	0f b6 c0             	movzbl %al,%eax
+  8009a2:	0f b6 12             	movzbl (%edx),%edx
+  8009a5:	29 d0                	sub    %edx,%eax
+}
+  8009a7:	5d                   	pop    %ebp
+  8009a8:	c3                   	ret
+
+008009a9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	53                   	push   %ebx
+  8009ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009b3:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009b6:	eb 09                	jmp    8009c1 <strncmp+0x18>
+		n--, p++, q++;
+  8009b8:	83 ea 01             	sub    $0x1,%edx
+  8009bb:	83 c0 01             	add    $0x1,%eax
+  8009be:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009c1:	85 d2                	test   %edx,%edx
+  8009c3:	74 18                	je     8009dd <strncmp+0x34>
+  8009c5:	0f b6 18             	movzbl (%eax),%ebx
+  8009c8:	84 db                	test   %bl,%bl
+  8009ca:	74 04                	je     8009d0 <strncmp+0x27>
+  8009cc:	3a 19                	cmp    (%ecx),%bl
+  8009ce:	74 e8                	je     8009b8 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009d0:	0f b6 00             	movzbl (%eax),%eax
+  8009d3:	0f b6 11             	movzbl (%ecx),%edx
+  8009d6:	29 d0                	sub    %edx,%eax
+}
+  8009d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009db:	c9                   	leave
+  8009dc:	c3                   	ret
+		return 0;
+  8009dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e2:	eb f4                	jmp    8009d8 <strncmp+0x2f>
+
+008009e4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009e4:	55                   	push   %ebp
+  8009e5:	89 e5                	mov    %esp,%ebp
+  8009e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ea:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009ee:	eb 03                	jmp    8009f3 <strchr+0xf>
+  8009f0:	83 c0 01             	add    $0x1,%eax
+  8009f3:	0f b6 10             	movzbl (%eax),%edx
+  8009f6:	84 d2                	test   %dl,%dl
+  8009f8:	74 06                	je     800a00 <strchr+0x1c>
+		if (*s == c)
+  8009fa:	38 ca                	cmp    %cl,%dl
+  8009fc:	75 f2                	jne    8009f0 <strchr+0xc>
+  8009fe:	eb 05                	jmp    800a05 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a05:	5d                   	pop    %ebp
+  800a06:	c3                   	ret
+
+00800a07 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a07:	55                   	push   %ebp
+  800a08:	89 e5                	mov    %esp,%ebp
+  800a0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a11:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a14:	38 ca                	cmp    %cl,%dl
+  800a16:	74 09                	je     800a21 <strfind+0x1a>
+  800a18:	84 d2                	test   %dl,%dl
+  800a1a:	74 05                	je     800a21 <strfind+0x1a>
+	for (; *s; s++)
+  800a1c:	83 c0 01             	add    $0x1,%eax
+  800a1f:	eb f0                	jmp    800a11 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a21:	5d                   	pop    %ebp
+  800a22:	c3                   	ret
+
+00800a23 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a23:	55                   	push   %ebp
+  800a24:	89 e5                	mov    %esp,%ebp
+  800a26:	57                   	push   %edi
+  800a27:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a2a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a2d:	85 c9                	test   %ecx,%ecx
+  800a2f:	74 20                	je     800a51 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a31:	89 f8                	mov    %edi,%eax
+  800a33:	09 c8                	or     %ecx,%eax
+  800a35:	a8 03                	test   $0x3,%al
+  800a37:	75 12                	jne    800a4b <memset+0x28>
+		c &= 0xFF;
+  800a39:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a3d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a43:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a46:	fc                   	cld
+  800a47:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a49:	eb 06                	jmp    800a51 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a4b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a4e:	fc                   	cld
+  800a4f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a51:	89 f8                	mov    %edi,%eax
+  800a53:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a56:	c9                   	leave
+  800a57:	c3                   	ret
+
+00800a58 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a58:	55                   	push   %ebp
+  800a59:	89 e5                	mov    %esp,%ebp
+  800a5b:	57                   	push   %edi
+  800a5c:	56                   	push   %esi
+  800a5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a60:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a63:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a66:	39 c6                	cmp    %eax,%esi
+  800a68:	73 32                	jae    800a9c <memmove+0x44>
+  800a6a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a6d:	39 d0                	cmp    %edx,%eax
+  800a6f:	73 2b                	jae    800a9c <memmove+0x44>
+		s += n;
+		d += n;
+  800a71:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a74:	89 d6                	mov    %edx,%esi
+  800a76:	09 fe                	or     %edi,%esi
+  800a78:	09 ce                	or     %ecx,%esi
+  800a7a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a80:	75 0e                	jne    800a90 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a82:	83 ef 04             	sub    $0x4,%edi
+  800a85:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a88:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a8b:	fd                   	std
+  800a8c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a8e:	eb 09                	jmp    800a99 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a90:	83 ef 01             	sub    $0x1,%edi
+  800a93:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a96:	fd                   	std
+  800a97:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a99:	fc                   	cld
+  800a9a:	eb 1a                	jmp    800ab6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a9c:	89 f2                	mov    %esi,%edx
+  800a9e:	09 c2                	or     %eax,%edx
+  800aa0:	09 ca                	or     %ecx,%edx
+  800aa2:	f6 c2 03             	test   $0x3,%dl
+  800aa5:	75 0a                	jne    800ab1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800aa7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800aaa:	89 c7                	mov    %eax,%edi
+  800aac:	fc                   	cld
+  800aad:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aaf:	eb 05                	jmp    800ab6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ab1:	89 c7                	mov    %eax,%edi
+  800ab3:	fc                   	cld
+  800ab4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ab6:	5e                   	pop    %esi
+  800ab7:	5f                   	pop    %edi
+  800ab8:	5d                   	pop    %ebp
+  800ab9:	c3                   	ret
+
+00800aba <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800aba:	55                   	push   %ebp
+  800abb:	89 e5                	mov    %esp,%ebp
+  800abd:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ac0:	ff 75 10             	push   0x10(%ebp)
+  800ac3:	ff 75 0c             	push   0xc(%ebp)
+  800ac6:	ff 75 08             	push   0x8(%ebp)
+  800ac9:	e8 8a ff ff ff       	call   800a58 <memmove>
+}
+  800ace:	c9                   	leave
+  800acf:	c3                   	ret
+
+00800ad0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ad0:	55                   	push   %ebp
+  800ad1:	89 e5                	mov    %esp,%ebp
+  800ad3:	56                   	push   %esi
+  800ad4:	53                   	push   %ebx
+  800ad5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800adb:	89 c6                	mov    %eax,%esi
+  800add:	03 75 10             	add    0x10(%ebp),%esi
+  800ae0:	eb 06                	jmp    800ae8 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ae2:	83 c0 01             	add    $0x1,%eax
+  800ae5:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ae8:	39 f0                	cmp    %esi,%eax
+  800aea:	74 14                	je     800b00 <memcmp+0x30>
+		if (*s1 != *s2)
+  800aec:	0f b6 08             	movzbl (%eax),%ecx
+  800aef:	0f b6 1a             	movzbl (%edx),%ebx
+  800af2:	38 d9                	cmp    %bl,%cl
+  800af4:	74 ec                	je     800ae2 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800af6:	0f b6 c1             	movzbl %cl,%eax
+  800af9:	0f b6 db             	movzbl %bl,%ebx
+  800afc:	29 d8                	sub    %ebx,%eax
+  800afe:	eb 05                	jmp    800b05 <memcmp+0x35>
+	}
+
+	return 0;
+  800b00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b05:	5b                   	pop    %ebx
+  800b06:	5e                   	pop    %esi
+  800b07:	5d                   	pop    %ebp
+  800b08:	c3                   	ret
+
+00800b09 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b09:	55                   	push   %ebp
+  800b0a:	89 e5                	mov    %esp,%ebp
+  800b0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b12:	89 c2                	mov    %eax,%edx
+  800b14:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b17:	eb 03                	jmp    800b1c <memfind+0x13>
+  800b19:	83 c0 01             	add    $0x1,%eax
+  800b1c:	39 d0                	cmp    %edx,%eax
+  800b1e:	73 04                	jae    800b24 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b20:	38 08                	cmp    %cl,(%eax)
+  800b22:	75 f5                	jne    800b19 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b24:	5d                   	pop    %ebp
+  800b25:	c3                   	ret
+
+00800b26 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b26:	55                   	push   %ebp
+  800b27:	89 e5                	mov    %esp,%ebp
+  800b29:	57                   	push   %edi
+  800b2a:	56                   	push   %esi
+  800b2b:	53                   	push   %ebx
+  800b2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b2f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b32:	eb 03                	jmp    800b37 <strtol+0x11>
+		s++;
+  800b34:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b37:	0f b6 02             	movzbl (%edx),%eax
+  800b3a:	3c 20                	cmp    $0x20,%al
+  800b3c:	74 f6                	je     800b34 <strtol+0xe>
+  800b3e:	3c 09                	cmp    $0x9,%al
+  800b40:	74 f2                	je     800b34 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b42:	3c 2b                	cmp    $0x2b,%al
+  800b44:	74 2a                	je     800b70 <strtol+0x4a>
+	int neg = 0;
+  800b46:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b4b:	3c 2d                	cmp    $0x2d,%al
+  800b4d:	74 2b                	je     800b7a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b4f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b55:	75 0f                	jne    800b66 <strtol+0x40>
+  800b57:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b5a:	74 28                	je     800b84 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b5c:	85 db                	test   %ebx,%ebx
+  800b5e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b63:	0f 44 d8             	cmove  %eax,%ebx
+  800b66:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b6b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b6e:	eb 46                	jmp    800bb6 <strtol+0x90>
+		s++;
+  800b70:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b73:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b78:	eb d5                	jmp    800b4f <strtol+0x29>
+		s++, neg = 1;
+  800b7a:	83 c2 01             	add    $0x1,%edx
+  800b7d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b82:	eb cb                	jmp    800b4f <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b84:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b88:	74 0e                	je     800b98 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b8a:	85 db                	test   %ebx,%ebx
+  800b8c:	75 d8                	jne    800b66 <strtol+0x40>
+		s++, base = 8;
+  800b8e:	83 c2 01             	add    $0x1,%edx
+  800b91:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b96:	eb ce                	jmp    800b66 <strtol+0x40>
+		s += 2, base = 16;
+  800b98:	83 c2 02             	add    $0x2,%edx
+  800b9b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ba0:	eb c4                	jmp    800b66 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ba2:	0f be c0             	movsbl %al,%eax
+  800ba5:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ba8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bab:	7d 3a                	jge    800be7 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bad:	83 c2 01             	add    $0x1,%edx
+  800bb0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bb4:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bb6:	0f b6 02             	movzbl (%edx),%eax
+  800bb9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bbc:	89 f3                	mov    %esi,%ebx
+  800bbe:	80 fb 09             	cmp    $0x9,%bl
+  800bc1:	76 df                	jbe    800ba2 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bc3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bc6:	89 f3                	mov    %esi,%ebx
+  800bc8:	80 fb 19             	cmp    $0x19,%bl
+  800bcb:	77 08                	ja     800bd5 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bcd:	0f be c0             	movsbl %al,%eax
+  800bd0:	83 e8 57             	sub    $0x57,%eax
+  800bd3:	eb d3                	jmp    800ba8 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bd5:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bd8:	89 f3                	mov    %esi,%ebx
+  800bda:	80 fb 19             	cmp    $0x19,%bl
+  800bdd:	77 08                	ja     800be7 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bdf:	0f be c0             	movsbl %al,%eax
+  800be2:	83 e8 37             	sub    $0x37,%eax
+  800be5:	eb c1                	jmp    800ba8 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800be7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800beb:	74 05                	je     800bf2 <strtol+0xcc>
+		*endptr = (char *) s;
+  800bed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bf0:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800bf2:	89 c8                	mov    %ecx,%eax
+  800bf4:	f7 d8                	neg    %eax
+  800bf6:	85 ff                	test   %edi,%edi
+  800bf8:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bfb:	89 c8                	mov    %ecx,%eax
+  800bfd:	5b                   	pop    %ebx
+  800bfe:	5e                   	pop    %esi
+  800bff:	5f                   	pop    %edi
+  800c00:	5d                   	pop    %ebp
+  800c01:	c3                   	ret
+
+00800c02 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800c02:	55                   	push   %ebp
+  800c03:	89 e5                	mov    %esp,%ebp
+  800c05:	57                   	push   %edi
+  800c06:	56                   	push   %esi
+  800c07:	53                   	push   %ebx
+  800c08:	83 ec 0c             	sub    $0xc,%esp
+  800c0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800c0e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c11:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800c14:	85 ff                	test   %edi,%edi
+  800c16:	74 16                	je     800c2e <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800c18:	83 ec 04             	sub    $0x4,%esp
+  800c1b:	56                   	push   %esi
+  800c1c:	6a 00                	push   $0x0
+  800c1e:	53                   	push   %ebx
+  800c1f:	e8 02 ff ff ff       	call   800b26 <strtol>
+  800c24:	89 07                	mov    %eax,(%edi)
+  800c26:	83 c4 10             	add    $0x10,%esp
+  800c29:	eb 03                	jmp    800c2e <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800c2b:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800c2e:	0f b6 03             	movzbl (%ebx),%eax
+  800c31:	3c 20                	cmp    $0x20,%al
+  800c33:	74 f6                	je     800c2b <strisl+0x29>
+  800c35:	3c 09                	cmp    $0x9,%al
+  800c37:	74 f2                	je     800c2b <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c39:	3c 2b                	cmp    $0x2b,%al
+  800c3b:	74 23                	je     800c60 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800c3d:	3c 2d                	cmp    $0x2d,%al
+  800c3f:	0f 94 c0             	sete   %al
+  800c42:	0f b6 c0             	movzbl %al,%eax
+  800c45:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c47:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800c4d:	75 41                	jne    800c90 <strisl+0x8e>
+  800c4f:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800c52:	74 11                	je     800c65 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c54:	85 f6                	test   %esi,%esi
+  800c56:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c5b:	0f 44 f0             	cmove  %eax,%esi
+  800c5e:	eb 30                	jmp    800c90 <strisl+0x8e>
+		s++;
+  800c60:	83 c3 01             	add    $0x1,%ebx
+  800c63:	eb e2                	jmp    800c47 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c65:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800c69:	74 0e                	je     800c79 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800c6b:	85 f6                	test   %esi,%esi
+  800c6d:	75 21                	jne    800c90 <strisl+0x8e>
+		s++, base = 8;
+  800c6f:	83 c3 01             	add    $0x1,%ebx
+  800c72:	be 08 00 00 00       	mov    $0x8,%esi
+  800c77:	eb 17                	jmp    800c90 <strisl+0x8e>
+		s += 2, base = 16;
+  800c79:	83 c3 02             	add    $0x2,%ebx
+  800c7c:	be 10 00 00 00       	mov    $0x10,%esi
+  800c81:	eb 0d                	jmp    800c90 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c83:	0f be c0             	movsbl %al,%eax
+  800c86:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800c89:	39 f0                	cmp    %esi,%eax
+  800c8b:	7d 38                	jge    800cc5 <strisl+0xc3>
+			return 0;
+		s++;
+  800c8d:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800c90:	0f b6 03             	movzbl (%ebx),%eax
+  800c93:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800c96:	80 fa 09             	cmp    $0x9,%dl
+  800c99:	76 e8                	jbe    800c83 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800c9b:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800c9e:	80 fa 19             	cmp    $0x19,%dl
+  800ca1:	77 08                	ja     800cab <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800ca3:	0f be c0             	movsbl %al,%eax
+  800ca6:	83 e8 57             	sub    $0x57,%eax
+  800ca9:	eb de                	jmp    800c89 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cab:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800cae:	80 fa 19             	cmp    $0x19,%dl
+  800cb1:	77 08                	ja     800cbb <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800cb3:	0f be c0             	movsbl %al,%eax
+  800cb6:	83 e8 37             	sub    $0x37,%eax
+  800cb9:	eb ce                	jmp    800c89 <strisl+0x87>
+		else if (!*s)
+  800cbb:	84 c0                	test   %al,%al
+  800cbd:	0f 94 c0             	sete   %al
+  800cc0:	0f b6 c0             	movzbl %al,%eax
+  800cc3:	eb 05                	jmp    800cca <strisl+0xc8>
+			return 0;
+  800cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800cca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ccd:	5b                   	pop    %ebx
+  800cce:	5e                   	pop    %esi
+  800ccf:	5f                   	pop    %edi
+  800cd0:	5d                   	pop    %ebp
+  800cd1:	c3                   	ret
+
+00800cd2 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800cd2:	55                   	push   %ebp
+  800cd3:	89 e5                	mov    %esp,%ebp
+  800cd5:	83 ec 10             	sub    $0x10,%esp
+  800cd8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800cdb:	89 c8                	mov    %ecx,%eax
+  800cdd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800ce2:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800ce5:	eb 0b                	jmp    800cf2 <touch_mem+0x20>
+		c = *(char *)page;
+  800ce7:	0f b6 10             	movzbl (%eax),%edx
+  800cea:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800ced:	05 00 10 00 00       	add    $0x1000,%eax
+  800cf2:	39 c8                	cmp    %ecx,%eax
+  800cf4:	72 f1                	jb     800ce7 <touch_mem+0x15>
+}
+  800cf6:	c9                   	leave
+  800cf7:	c3                   	ret
+
+00800cf8 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800cf8:	55                   	push   %ebp
+  800cf9:	89 e5                	mov    %esp,%ebp
+  800cfb:	57                   	push   %edi
+  800cfc:	56                   	push   %esi
+  800cfd:	53                   	push   %ebx
+	touch_mem(s, len);
+  800cfe:	ff 75 0c             	push   0xc(%ebp)
+  800d01:	ff 75 08             	push   0x8(%ebp)
+  800d04:	e8 c9 ff ff ff       	call   800cd2 <touch_mem>
+	asm volatile("int %1\n"
+  800d09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d14:	89 c3                	mov    %eax,%ebx
+  800d16:	89 c7                	mov    %eax,%edi
+  800d18:	89 c6                	mov    %eax,%esi
+  800d1a:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d1c:	83 c4 08             	add    $0x8,%esp
+  800d1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d22:	5b                   	pop    %ebx
+  800d23:	5e                   	pop    %esi
+  800d24:	5f                   	pop    %edi
+  800d25:	5d                   	pop    %ebp
+  800d26:	c3                   	ret
+
+00800d27 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d27:	55                   	push   %ebp
+  800d28:	89 e5                	mov    %esp,%ebp
+  800d2a:	57                   	push   %edi
+  800d2b:	56                   	push   %esi
+  800d2c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d32:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d37:	89 d1                	mov    %edx,%ecx
+  800d39:	89 d3                	mov    %edx,%ebx
+  800d3b:	89 d7                	mov    %edx,%edi
+  800d3d:	89 d6                	mov    %edx,%esi
+  800d3f:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d41:	5b                   	pop    %ebx
+  800d42:	5e                   	pop    %esi
+  800d43:	5f                   	pop    %edi
+  800d44:	5d                   	pop    %ebp
+  800d45:	c3                   	ret
+
+00800d46 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d46:	55                   	push   %ebp
+  800d47:	89 e5                	mov    %esp,%ebp
+  800d49:	57                   	push   %edi
+  800d4a:	56                   	push   %esi
+  800d4b:	53                   	push   %ebx
+  800d4c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d57:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d5c:	89 cb                	mov    %ecx,%ebx
+  800d5e:	89 cf                	mov    %ecx,%edi
+  800d60:	89 ce                	mov    %ecx,%esi
+  800d62:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d64:	85 c0                	test   %eax,%eax
+  800d66:	7f 08                	jg     800d70 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6b:	5b                   	pop    %ebx
+  800d6c:	5e                   	pop    %esi
+  800d6d:	5f                   	pop    %edi
+  800d6e:	5d                   	pop    %ebp
+  800d6f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d70:	83 ec 0c             	sub    $0xc,%esp
+  800d73:	50                   	push   %eax
+  800d74:	6a 03                	push   $0x3
+  800d76:	68 ab 52 80 00       	push   $0x8052ab
+  800d7b:	6a 23                	push   $0x23
+  800d7d:	68 c8 52 80 00       	push   $0x8052c8
+  800d82:	e8 89 f4 ff ff       	call   800210 <_panic>
+
+00800d87 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	57                   	push   %edi
+  800d8b:	56                   	push   %esi
+  800d8c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d92:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d97:	89 d1                	mov    %edx,%ecx
+  800d99:	89 d3                	mov    %edx,%ebx
+  800d9b:	89 d7                	mov    %edx,%edi
+  800d9d:	89 d6                	mov    %edx,%esi
+  800d9f:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800da1:	5b                   	pop    %ebx
+  800da2:	5e                   	pop    %esi
+  800da3:	5f                   	pop    %edi
+  800da4:	5d                   	pop    %ebp
+  800da5:	c3                   	ret
+
+00800da6 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800da6:	55                   	push   %ebp
+  800da7:	89 e5                	mov    %esp,%ebp
+  800da9:	57                   	push   %edi
+  800daa:	56                   	push   %esi
+  800dab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dac:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800db6:	89 d1                	mov    %edx,%ecx
+  800db8:	89 d3                	mov    %edx,%ebx
+  800dba:	89 d7                	mov    %edx,%edi
+  800dbc:	89 d6                	mov    %edx,%esi
+  800dbe:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800dc0:	5b                   	pop    %ebx
+  800dc1:	5e                   	pop    %esi
+  800dc2:	5f                   	pop    %edi
+  800dc3:	5d                   	pop    %ebp
+  800dc4:	c3                   	ret
+
+00800dc5 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800dc5:	55                   	push   %ebp
+  800dc6:	89 e5                	mov    %esp,%ebp
+  800dc8:	57                   	push   %edi
+  800dc9:	56                   	push   %esi
+  800dca:	53                   	push   %ebx
+  800dcb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dce:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd9:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dde:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de1:	89 f7                	mov    %esi,%edi
+  800de3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de5:	85 c0                	test   %eax,%eax
+  800de7:	7f 08                	jg     800df1 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800de9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dec:	5b                   	pop    %ebx
+  800ded:	5e                   	pop    %esi
+  800dee:	5f                   	pop    %edi
+  800def:	5d                   	pop    %ebp
+  800df0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df1:	83 ec 0c             	sub    $0xc,%esp
+  800df4:	50                   	push   %eax
+  800df5:	6a 04                	push   $0x4
+  800df7:	68 ab 52 80 00       	push   $0x8052ab
+  800dfc:	6a 23                	push   $0x23
+  800dfe:	68 c8 52 80 00       	push   $0x8052c8
+  800e03:	e8 08 f4 ff ff       	call   800210 <_panic>
+
+00800e08 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e08:	55                   	push   %ebp
+  800e09:	89 e5                	mov    %esp,%ebp
+  800e0b:	57                   	push   %edi
+  800e0c:	56                   	push   %esi
+  800e0d:	53                   	push   %ebx
+  800e0e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e11:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e14:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e17:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e1f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e22:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e25:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e27:	85 c0                	test   %eax,%eax
+  800e29:	7f 08                	jg     800e33 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2e:	5b                   	pop    %ebx
+  800e2f:	5e                   	pop    %esi
+  800e30:	5f                   	pop    %edi
+  800e31:	5d                   	pop    %ebp
+  800e32:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e33:	83 ec 0c             	sub    $0xc,%esp
+  800e36:	50                   	push   %eax
+  800e37:	6a 05                	push   $0x5
+  800e39:	68 ab 52 80 00       	push   $0x8052ab
+  800e3e:	6a 23                	push   $0x23
+  800e40:	68 c8 52 80 00       	push   $0x8052c8
+  800e45:	e8 c6 f3 ff ff       	call   800210 <_panic>
+
+00800e4a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e4a:	55                   	push   %ebp
+  800e4b:	89 e5                	mov    %esp,%ebp
+  800e4d:	57                   	push   %edi
+  800e4e:	56                   	push   %esi
+  800e4f:	53                   	push   %ebx
+  800e50:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e63:	89 df                	mov    %ebx,%edi
+  800e65:	89 de                	mov    %ebx,%esi
+  800e67:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e69:	85 c0                	test   %eax,%eax
+  800e6b:	7f 08                	jg     800e75 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e70:	5b                   	pop    %ebx
+  800e71:	5e                   	pop    %esi
+  800e72:	5f                   	pop    %edi
+  800e73:	5d                   	pop    %ebp
+  800e74:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e75:	83 ec 0c             	sub    $0xc,%esp
+  800e78:	50                   	push   %eax
+  800e79:	6a 06                	push   $0x6
+  800e7b:	68 ab 52 80 00       	push   $0x8052ab
+  800e80:	6a 23                	push   $0x23
+  800e82:	68 c8 52 80 00       	push   $0x8052c8
+  800e87:	e8 84 f3 ff ff       	call   800210 <_panic>
+
+00800e8c <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800e8c:	55                   	push   %ebp
+  800e8d:	89 e5                	mov    %esp,%ebp
+  800e8f:	57                   	push   %edi
+  800e90:	56                   	push   %esi
+  800e91:	53                   	push   %ebx
+  800e92:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea0:	b8 18 00 00 00       	mov    $0x18,%eax
+  800ea5:	89 df                	mov    %ebx,%edi
+  800ea7:	89 de                	mov    %ebx,%esi
+  800ea9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eab:	85 c0                	test   %eax,%eax
+  800ead:	7f 08                	jg     800eb7 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800eaf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb2:	5b                   	pop    %ebx
+  800eb3:	5e                   	pop    %esi
+  800eb4:	5f                   	pop    %edi
+  800eb5:	5d                   	pop    %ebp
+  800eb6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb7:	83 ec 0c             	sub    $0xc,%esp
+  800eba:	50                   	push   %eax
+  800ebb:	6a 18                	push   $0x18
+  800ebd:	68 ab 52 80 00       	push   $0x8052ab
+  800ec2:	6a 23                	push   $0x23
+  800ec4:	68 c8 52 80 00       	push   $0x8052c8
+  800ec9:	e8 42 f3 ff ff       	call   800210 <_panic>
+
+00800ece <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800ece:	55                   	push   %ebp
+  800ecf:	89 e5                	mov    %esp,%ebp
+  800ed1:	57                   	push   %edi
+  800ed2:	56                   	push   %esi
+  800ed3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ed4:	be 00 00 00 00       	mov    $0x0,%esi
+  800ed9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edf:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ee4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ee7:	89 f7                	mov    %esi,%edi
+  800ee9:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800eeb:	5b                   	pop    %ebx
+  800eec:	5e                   	pop    %esi
+  800eed:	5f                   	pop    %edi
+  800eee:	5d                   	pop    %ebp
+  800eef:	c3                   	ret
+
+00800ef0 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800ef0:	55                   	push   %ebp
+  800ef1:	89 e5                	mov    %esp,%ebp
+  800ef3:	57                   	push   %edi
+  800ef4:	56                   	push   %esi
+  800ef5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ef6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f01:	be 00 00 00 00       	mov    $0x0,%esi
+  800f06:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f09:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f0c:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800f0e:	5b                   	pop    %ebx
+  800f0f:	5e                   	pop    %esi
+  800f10:	5f                   	pop    %edi
+  800f11:	5d                   	pop    %ebp
+  800f12:	c3                   	ret
+
+00800f13 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	57                   	push   %edi
+  800f17:	56                   	push   %esi
+  800f18:	53                   	push   %ebx
+  800f19:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800f1c:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800f1f:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800f25:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800f28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f33:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f36:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f39:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f3b:	85 c0                	test   %eax,%eax
+  800f3d:	7f 08                	jg     800f47 <sys_page_map_range+0x34>
+}
+  800f3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f42:	5b                   	pop    %ebx
+  800f43:	5e                   	pop    %esi
+  800f44:	5f                   	pop    %edi
+  800f45:	5d                   	pop    %ebp
+  800f46:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f47:	83 ec 0c             	sub    $0xc,%esp
+  800f4a:	50                   	push   %eax
+  800f4b:	6a 10                	push   $0x10
+  800f4d:	68 ab 52 80 00       	push   $0x8052ab
+  800f52:	6a 23                	push   $0x23
+  800f54:	68 c8 52 80 00       	push   $0x8052c8
+  800f59:	e8 b2 f2 ff ff       	call   800210 <_panic>
+
+00800f5e <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	57                   	push   %edi
+  800f62:	56                   	push   %esi
+  800f63:	53                   	push   %ebx
+  800f64:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f67:	be 00 00 00 00       	mov    $0x0,%esi
+  800f6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f72:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f7a:	89 f7                	mov    %esi,%edi
+  800f7c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f7e:	85 c0                	test   %eax,%eax
+  800f80:	7f 08                	jg     800f8a <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f85:	5b                   	pop    %ebx
+  800f86:	5e                   	pop    %esi
+  800f87:	5f                   	pop    %edi
+  800f88:	5d                   	pop    %ebp
+  800f89:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f8a:	83 ec 0c             	sub    $0xc,%esp
+  800f8d:	50                   	push   %eax
+  800f8e:	6a 11                	push   $0x11
+  800f90:	68 ab 52 80 00       	push   $0x8052ab
+  800f95:	6a 23                	push   $0x23
+  800f97:	68 c8 52 80 00       	push   $0x8052c8
+  800f9c:	e8 6f f2 ff ff       	call   800210 <_panic>
+
+00800fa1 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800fa1:	55                   	push   %ebp
+  800fa2:	89 e5                	mov    %esp,%ebp
+  800fa4:	57                   	push   %edi
+  800fa5:	56                   	push   %esi
+  800fa6:	53                   	push   %ebx
+  800fa7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800faa:	be 00 00 00 00       	mov    $0x0,%esi
+  800faf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800fba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fbd:	89 f7                	mov    %esi,%edi
+  800fbf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc1:	85 c0                	test   %eax,%eax
+  800fc3:	7f 08                	jg     800fcd <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800fc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc8:	5b                   	pop    %ebx
+  800fc9:	5e                   	pop    %esi
+  800fca:	5f                   	pop    %edi
+  800fcb:	5d                   	pop    %ebp
+  800fcc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fcd:	83 ec 0c             	sub    $0xc,%esp
+  800fd0:	50                   	push   %eax
+  800fd1:	6a 1b                	push   $0x1b
+  800fd3:	68 ab 52 80 00       	push   $0x8052ab
+  800fd8:	6a 23                	push   $0x23
+  800fda:	68 c8 52 80 00       	push   $0x8052c8
+  800fdf:	e8 2c f2 ff ff       	call   800210 <_panic>
+
+00800fe4 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800fe4:	55                   	push   %ebp
+  800fe5:	89 e5                	mov    %esp,%ebp
+  800fe7:	57                   	push   %edi
+  800fe8:	56                   	push   %esi
+  800fe9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fef:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ff4:	89 d1                	mov    %edx,%ecx
+  800ff6:	89 d3                	mov    %edx,%ebx
+  800ff8:	89 d7                	mov    %edx,%edi
+  800ffa:	89 d6                	mov    %edx,%esi
+  800ffc:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800ffe:	5b                   	pop    %ebx
+  800fff:	5e                   	pop    %esi
+  801000:	5f                   	pop    %edi
+  801001:	5d                   	pop    %ebp
+  801002:	c3                   	ret
+
+00801003 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801003:	55                   	push   %ebp
+  801004:	89 e5                	mov    %esp,%ebp
+  801006:	57                   	push   %edi
+  801007:	56                   	push   %esi
+  801008:	53                   	push   %ebx
+  801009:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80100c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801011:	8b 55 08             	mov    0x8(%ebp),%edx
+  801014:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801017:	b8 08 00 00 00       	mov    $0x8,%eax
+  80101c:	89 df                	mov    %ebx,%edi
+  80101e:	89 de                	mov    %ebx,%esi
+  801020:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801022:	85 c0                	test   %eax,%eax
+  801024:	7f 08                	jg     80102e <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801026:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801029:	5b                   	pop    %ebx
+  80102a:	5e                   	pop    %esi
+  80102b:	5f                   	pop    %edi
+  80102c:	5d                   	pop    %ebp
+  80102d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80102e:	83 ec 0c             	sub    $0xc,%esp
+  801031:	50                   	push   %eax
+  801032:	6a 08                	push   $0x8
+  801034:	68 ab 52 80 00       	push   $0x8052ab
+  801039:	6a 23                	push   $0x23
+  80103b:	68 c8 52 80 00       	push   $0x8052c8
+  801040:	e8 cb f1 ff ff       	call   800210 <_panic>
+
+00801045 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801045:	55                   	push   %ebp
+  801046:	89 e5                	mov    %esp,%ebp
+  801048:	57                   	push   %edi
+  801049:	56                   	push   %esi
+  80104a:	53                   	push   %ebx
+  80104b:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  80104e:	6a 44                	push   $0x44
+  801050:	ff 75 0c             	push   0xc(%ebp)
+  801053:	e8 7a fc ff ff       	call   800cd2 <touch_mem>
+	asm volatile("int %1\n"
+  801058:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801060:	b8 09 00 00 00       	mov    $0x9,%eax
+  801065:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801068:	89 df                	mov    %ebx,%edi
+  80106a:	89 de                	mov    %ebx,%esi
+  80106c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80106e:	83 c4 08             	add    $0x8,%esp
+  801071:	85 c0                	test   %eax,%eax
+  801073:	7f 08                	jg     80107d <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801075:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801078:	5b                   	pop    %ebx
+  801079:	5e                   	pop    %esi
+  80107a:	5f                   	pop    %edi
+  80107b:	5d                   	pop    %ebp
+  80107c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107d:	83 ec 0c             	sub    $0xc,%esp
+  801080:	50                   	push   %eax
+  801081:	6a 09                	push   $0x9
+  801083:	68 ab 52 80 00       	push   $0x8052ab
+  801088:	6a 23                	push   $0x23
+  80108a:	68 c8 52 80 00       	push   $0x8052c8
+  80108f:	e8 7c f1 ff ff       	call   800210 <_panic>
+
+00801094 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  801094:	55                   	push   %ebp
+  801095:	89 e5                	mov    %esp,%ebp
+  801097:	57                   	push   %edi
+  801098:	56                   	push   %esi
+  801099:	53                   	push   %ebx
+  80109a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80109d:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8010ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b0:	89 f7                	mov    %esi,%edi
+  8010b2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010b4:	85 c0                	test   %eax,%eax
+  8010b6:	7f 08                	jg     8010c0 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  8010b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010bb:	5b                   	pop    %ebx
+  8010bc:	5e                   	pop    %esi
+  8010bd:	5f                   	pop    %edi
+  8010be:	5d                   	pop    %ebp
+  8010bf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c0:	83 ec 0c             	sub    $0xc,%esp
+  8010c3:	50                   	push   %eax
+  8010c4:	6a 1a                	push   $0x1a
+  8010c6:	68 ab 52 80 00       	push   $0x8052ab
+  8010cb:	6a 23                	push   $0x23
+  8010cd:	68 c8 52 80 00       	push   $0x8052c8
+  8010d2:	e8 39 f1 ff ff       	call   800210 <_panic>
+
+008010d7 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8010d7:	55                   	push   %ebp
+  8010d8:	89 e5                	mov    %esp,%ebp
+  8010da:	57                   	push   %edi
+  8010db:	56                   	push   %esi
+  8010dc:	53                   	push   %ebx
+  8010dd:	83 ec 0c             	sub    $0xc,%esp
+  8010e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8010e3:	89 d8                	mov    %ebx,%eax
+  8010e5:	c1 e0 05             	shl    $0x5,%eax
+  8010e8:	50                   	push   %eax
+  8010e9:	ff 75 0c             	push   0xc(%ebp)
+  8010ec:	e8 e1 fb ff ff       	call   800cd2 <touch_mem>
+	asm volatile("int %1\n"
+  8010f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801101:	89 f7                	mov    %esi,%edi
+  801103:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801105:	83 c4 08             	add    $0x8,%esp
+  801108:	85 c0                	test   %eax,%eax
+  80110a:	7f 08                	jg     801114 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  80110c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110f:	5b                   	pop    %ebx
+  801110:	5e                   	pop    %esi
+  801111:	5f                   	pop    %edi
+  801112:	5d                   	pop    %ebp
+  801113:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801114:	83 ec 0c             	sub    $0xc,%esp
+  801117:	50                   	push   %eax
+  801118:	6a 13                	push   $0x13
+  80111a:	68 ab 52 80 00       	push   $0x8052ab
+  80111f:	6a 23                	push   $0x23
+  801121:	68 c8 52 80 00       	push   $0x8052c8
+  801126:	e8 e5 f0 ff ff       	call   800210 <_panic>
+
+0080112b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80112b:	55                   	push   %ebp
+  80112c:	89 e5                	mov    %esp,%ebp
+  80112e:	57                   	push   %edi
+  80112f:	56                   	push   %esi
+  801130:	53                   	push   %ebx
+  801131:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801134:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801139:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801144:	89 df                	mov    %ebx,%edi
+  801146:	89 de                	mov    %ebx,%esi
+  801148:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80114a:	85 c0                	test   %eax,%eax
+  80114c:	7f 08                	jg     801156 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80114e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801151:	5b                   	pop    %ebx
+  801152:	5e                   	pop    %esi
+  801153:	5f                   	pop    %edi
+  801154:	5d                   	pop    %ebp
+  801155:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801156:	83 ec 0c             	sub    $0xc,%esp
+  801159:	50                   	push   %eax
+  80115a:	6a 0a                	push   $0xa
+  80115c:	68 ab 52 80 00       	push   $0x8052ab
+  801161:	6a 23                	push   $0x23
+  801163:	68 c8 52 80 00       	push   $0x8052c8
+  801168:	e8 a3 f0 ff ff       	call   800210 <_panic>
+
+0080116d <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80116d:	55                   	push   %ebp
+  80116e:	89 e5                	mov    %esp,%ebp
+  801170:	57                   	push   %edi
+  801171:	56                   	push   %esi
+  801172:	53                   	push   %ebx
+  801173:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801176:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80117c:	76 1d                	jbe    80119b <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80117e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801181:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801184:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801189:	be 01 00 00 00       	mov    $0x1,%esi
+  80118e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801191:	cd 30                	int    $0x30
+}
+  801193:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801196:	5b                   	pop    %ebx
+  801197:	5e                   	pop    %esi
+  801198:	5f                   	pop    %edi
+  801199:	5d                   	pop    %ebp
+  80119a:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80119b:	68 00 10 00 00       	push   $0x1000
+  8011a0:	53                   	push   %ebx
+  8011a1:	e8 2c fb ff ff       	call   800cd2 <touch_mem>
+  8011a6:	83 c4 08             	add    $0x8,%esp
+  8011a9:	eb d3                	jmp    80117e <sys_ipc_send+0x11>
+
+008011ab <sys_ipc_send_pages>:
+{
+  8011ab:	55                   	push   %ebp
+  8011ac:	89 e5                	mov    %esp,%ebp
+  8011ae:	57                   	push   %edi
+  8011af:	56                   	push   %esi
+  8011b0:	53                   	push   %ebx
+  8011b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b4:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8011b7:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011bd:	76 18                	jbe    8011d7 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8011bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011ca:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8011cd:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8011cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d2:	5b                   	pop    %ebx
+  8011d3:	5e                   	pop    %esi
+  8011d4:	5f                   	pop    %edi
+  8011d5:	5d                   	pop    %ebp
+  8011d6:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011d7:	89 f0                	mov    %esi,%eax
+  8011d9:	c1 e0 0c             	shl    $0xc,%eax
+  8011dc:	50                   	push   %eax
+  8011dd:	53                   	push   %ebx
+  8011de:	e8 ef fa ff ff       	call   800cd2 <touch_mem>
+  8011e3:	83 c4 08             	add    $0x8,%esp
+  8011e6:	eb d7                	jmp    8011bf <sys_ipc_send_pages+0x14>
+
+008011e8 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8011e8:	55                   	push   %ebp
+  8011e9:	89 e5                	mov    %esp,%ebp
+  8011eb:	57                   	push   %edi
+  8011ec:	56                   	push   %esi
+  8011ed:	53                   	push   %ebx
+  8011ee:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011fc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801201:	89 df                	mov    %ebx,%edi
+  801203:	89 de                	mov    %ebx,%esi
+  801205:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801207:	85 c0                	test   %eax,%eax
+  801209:	7f 08                	jg     801213 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  80120b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80120e:	5b                   	pop    %ebx
+  80120f:	5e                   	pop    %esi
+  801210:	5f                   	pop    %edi
+  801211:	5d                   	pop    %ebp
+  801212:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801213:	83 ec 0c             	sub    $0xc,%esp
+  801216:	50                   	push   %eax
+  801217:	6a 0d                	push   $0xd
+  801219:	68 ab 52 80 00       	push   $0x8052ab
+  80121e:	6a 23                	push   $0x23
+  801220:	68 c8 52 80 00       	push   $0x8052c8
+  801225:	e8 e6 ef ff ff       	call   800210 <_panic>
+
+0080122a <sys_ipc_recv>:
+{
+  80122a:	55                   	push   %ebp
+  80122b:	89 e5                	mov    %esp,%ebp
+  80122d:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801230:	6a 01                	push   $0x1
+  801232:	ff 75 08             	push   0x8(%ebp)
+  801235:	e8 ae ff ff ff       	call   8011e8 <sys_ipc_recv_pages>
+}
+  80123a:	c9                   	leave
+  80123b:	c3                   	ret
+
+0080123c <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+  80123f:	57                   	push   %edi
+  801240:	56                   	push   %esi
+  801241:	53                   	push   %ebx
+  801242:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801245:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801248:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  80124b:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801251:	77 04                	ja     801257 <sys_ipc_call+0x1b>
+  801253:	85 f6                	test   %esi,%esi
+  801255:	75 15                	jne    80126c <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801257:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801262:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801264:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801267:	5b                   	pop    %ebx
+  801268:	5e                   	pop    %esi
+  801269:	5f                   	pop    %edi
+  80126a:	5d                   	pop    %ebp
+  80126b:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80126c:	89 f8                	mov    %edi,%eax
+  80126e:	c1 e0 0c             	shl    $0xc,%eax
+  801271:	50                   	push   %eax
+  801272:	53                   	push   %ebx
+  801273:	e8 5a fa ff ff       	call   800cd2 <touch_mem>
+  801278:	83 c4 08             	add    $0x8,%esp
+  80127b:	eb da                	jmp    801257 <sys_ipc_call+0x1b>
+
+0080127d <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80127d:	55                   	push   %ebp
+  80127e:	89 e5                	mov    %esp,%ebp
+  801280:	57                   	push   %edi
+  801281:	56                   	push   %esi
+  801282:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801283:	8b 55 08             	mov    0x8(%ebp),%edx
+  801286:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801289:	b8 15 00 00 00       	mov    $0x15,%eax
+  80128e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801291:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801294:	8b 75 18             	mov    0x18(%ebp),%esi
+  801297:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801299:	5b                   	pop    %ebx
+  80129a:	5e                   	pop    %esi
+  80129b:	5f                   	pop    %edi
+  80129c:	5d                   	pop    %ebp
+  80129d:	c3                   	ret
+
+0080129e <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  80129e:	55                   	push   %ebp
+  80129f:	89 e5                	mov    %esp,%ebp
+  8012a1:	57                   	push   %edi
+  8012a2:	56                   	push   %esi
+  8012a3:	53                   	push   %ebx
+  8012a4:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8012a7:	6a 04                	push   $0x4
+  8012a9:	ff 75 08             	push   0x8(%ebp)
+  8012ac:	e8 21 fa ff ff       	call   800cd2 <touch_mem>
+	asm volatile("int %1\n"
+  8012b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b9:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012c4:	89 f7                	mov    %esi,%edi
+  8012c6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012c8:	83 c4 08             	add    $0x8,%esp
+  8012cb:	85 c0                	test   %eax,%eax
+  8012cd:	7f 08                	jg     8012d7 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8012cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d2:	5b                   	pop    %ebx
+  8012d3:	5e                   	pop    %esi
+  8012d4:	5f                   	pop    %edi
+  8012d5:	5d                   	pop    %ebp
+  8012d6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012d7:	83 ec 0c             	sub    $0xc,%esp
+  8012da:	50                   	push   %eax
+  8012db:	6a 16                	push   $0x16
+  8012dd:	68 ab 52 80 00       	push   $0x8052ab
+  8012e2:	6a 23                	push   $0x23
+  8012e4:	68 c8 52 80 00       	push   $0x8052c8
+  8012e9:	e8 22 ef ff ff       	call   800210 <_panic>
+
+008012ee <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8012ee:	55                   	push   %ebp
+  8012ef:	89 e5                	mov    %esp,%ebp
+  8012f1:	57                   	push   %edi
+  8012f2:	56                   	push   %esi
+  8012f3:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8012f4:	6a 04                	push   $0x4
+  8012f6:	ff 75 08             	push   0x8(%ebp)
+  8012f9:	e8 d4 f9 ff ff       	call   800cd2 <touch_mem>
+	asm volatile("int %1\n"
+  8012fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801303:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801306:	b8 17 00 00 00       	mov    $0x17,%eax
+  80130b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130e:	89 df                	mov    %ebx,%edi
+  801310:	89 de                	mov    %ebx,%esi
+  801312:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801314:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801317:	5b                   	pop    %ebx
+  801318:	5e                   	pop    %esi
+  801319:	5f                   	pop    %edi
+  80131a:	5d                   	pop    %ebp
+  80131b:	c3                   	ret
+
+0080131c <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80131c:	55                   	push   %ebp
+  80131d:	89 e5                	mov    %esp,%ebp
+  80131f:	57                   	push   %edi
+  801320:	56                   	push   %esi
+  801321:	53                   	push   %ebx
+  801322:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801325:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801332:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801337:	89 df                	mov    %ebx,%edi
+  801339:	89 de                	mov    %ebx,%esi
+  80133b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80133d:	85 c0                	test   %eax,%eax
+  80133f:	7f 08                	jg     801349 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801341:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801344:	5b                   	pop    %ebx
+  801345:	5e                   	pop    %esi
+  801346:	5f                   	pop    %edi
+  801347:	5d                   	pop    %ebp
+  801348:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801349:	83 ec 0c             	sub    $0xc,%esp
+  80134c:	50                   	push   %eax
+  80134d:	6a 0e                	push   $0xe
+  80134f:	68 ab 52 80 00       	push   $0x8052ab
+  801354:	6a 23                	push   $0x23
+  801356:	68 c8 52 80 00       	push   $0x8052c8
+  80135b:	e8 b0 ee ff ff       	call   800210 <_panic>
+
+00801360 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801360:	55                   	push   %ebp
+  801361:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801363:	8b 45 08             	mov    0x8(%ebp),%eax
+  801366:	05 00 00 00 30       	add    $0x30000000,%eax
+  80136b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80136e:	5d                   	pop    %ebp
+  80136f:	c3                   	ret
+
+00801370 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801370:	55                   	push   %ebp
+  801371:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801373:	8b 45 08             	mov    0x8(%ebp),%eax
+  801376:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80137b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801380:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801385:	5d                   	pop    %ebp
+  801386:	c3                   	ret
+
+00801387 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801387:	55                   	push   %ebp
+  801388:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  80138a:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  80138f:	a8 01                	test   $0x1,%al
+  801391:	74 3c                	je     8013cf <fd_alloc+0x48>
+  801393:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801398:	89 c2                	mov    %eax,%edx
+  80139a:	c1 ea 0c             	shr    $0xc,%edx
+  80139d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013a4:	89 c1                	mov    %eax,%ecx
+  8013a6:	05 00 10 00 00       	add    $0x1000,%eax
+  8013ab:	f6 c2 01             	test   $0x1,%dl
+  8013ae:	74 13                	je     8013c3 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8013b0:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8013b5:	75 e1                	jne    801398 <fd_alloc+0x11>
+  8013b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8013bc:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8013c1:	eb 05                	jmp    8013c8 <fd_alloc+0x41>
+			return 0;
+  8013c3:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8013c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cb:	89 0a                	mov    %ecx,(%edx)
+}
+  8013cd:	5d                   	pop    %ebp
+  8013ce:	c3                   	ret
+  8013cf:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8013d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d9:	eb ed                	jmp    8013c8 <fd_alloc+0x41>
+
+008013db <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013db:	55                   	push   %ebp
+  8013dc:	89 e5                	mov    %esp,%ebp
+  8013de:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8013e1:	83 f8 1f             	cmp    $0x1f,%eax
+  8013e4:	77 30                	ja     801416 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8013e6:	c1 e0 0c             	shl    $0xc,%eax
+  8013e9:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8013ee:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8013f4:	f6 c2 01             	test   $0x1,%dl
+  8013f7:	74 24                	je     80141d <fd_lookup+0x42>
+  8013f9:	89 c2                	mov    %eax,%edx
+  8013fb:	c1 ea 0c             	shr    $0xc,%edx
+  8013fe:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801405:	f6 c2 01             	test   $0x1,%dl
+  801408:	74 1a                	je     801424 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80140a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80140d:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80140f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801414:	5d                   	pop    %ebp
+  801415:	c3                   	ret
+		return -E_INVAL;
+  801416:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80141b:	eb f7                	jmp    801414 <fd_lookup+0x39>
+		return -E_INVAL;
+  80141d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801422:	eb f0                	jmp    801414 <fd_lookup+0x39>
+  801424:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801429:	eb e9                	jmp    801414 <fd_lookup+0x39>
+
+0080142b <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80142b:	55                   	push   %ebp
+  80142c:	89 e5                	mov    %esp,%ebp
+  80142e:	53                   	push   %ebx
+  80142f:	83 ec 04             	sub    $0x4,%esp
+  801432:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801435:	b8 54 53 80 00       	mov    $0x805354,%eax
+  80143a:	8b 18                	mov    (%eax),%ebx
+  80143c:	85 db                	test   %ebx,%ebx
+  80143e:	74 0e                	je     80144e <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801440:	83 c0 04             	add    $0x4,%eax
+  801443:	39 13                	cmp    %edx,(%ebx)
+  801445:	75 f3                	jne    80143a <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801447:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144c:	eb 1f                	jmp    80146d <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80144e:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801453:	8b 40 48             	mov    0x48(%eax),%eax
+  801456:	83 ec 04             	sub    $0x4,%esp
+  801459:	52                   	push   %edx
+  80145a:	50                   	push   %eax
+  80145b:	68 d8 52 80 00       	push   $0x8052d8
+  801460:	e8 86 ee ff ff       	call   8002eb <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801465:	83 c4 10             	add    $0x10,%esp
+  801468:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80146d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801470:	89 1a                	mov    %ebx,(%edx)
+}
+  801472:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801475:	c9                   	leave
+  801476:	c3                   	ret
+
+00801477 <fd_close>:
+{
+  801477:	55                   	push   %ebp
+  801478:	89 e5                	mov    %esp,%ebp
+  80147a:	57                   	push   %edi
+  80147b:	56                   	push   %esi
+  80147c:	53                   	push   %ebx
+  80147d:	83 ec 24             	sub    $0x24,%esp
+  801480:	8b 75 08             	mov    0x8(%ebp),%esi
+  801483:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801486:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801489:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80148a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801490:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801493:	50                   	push   %eax
+  801494:	e8 42 ff ff ff       	call   8013db <fd_lookup>
+  801499:	89 c3                	mov    %eax,%ebx
+  80149b:	83 c4 10             	add    $0x10,%esp
+  80149e:	85 c0                	test   %eax,%eax
+  8014a0:	78 05                	js     8014a7 <fd_close+0x30>
+	    || fd != fd2)
+  8014a2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8014a5:	74 16                	je     8014bd <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8014a7:	89 f8                	mov    %edi,%eax
+  8014a9:	84 c0                	test   %al,%al
+  8014ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014b3:	89 d8                	mov    %ebx,%eax
+  8014b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b8:	5b                   	pop    %ebx
+  8014b9:	5e                   	pop    %esi
+  8014ba:	5f                   	pop    %edi
+  8014bb:	5d                   	pop    %ebp
+  8014bc:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014bd:	83 ec 08             	sub    $0x8,%esp
+  8014c0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014c3:	50                   	push   %eax
+  8014c4:	ff 36                	push   (%esi)
+  8014c6:	e8 60 ff ff ff       	call   80142b <dev_lookup>
+  8014cb:	89 c3                	mov    %eax,%ebx
+  8014cd:	83 c4 10             	add    $0x10,%esp
+  8014d0:	85 c0                	test   %eax,%eax
+  8014d2:	78 1a                	js     8014ee <fd_close+0x77>
+		if (dev->dev_close)
+  8014d4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014d7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8014da:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8014df:	85 c0                	test   %eax,%eax
+  8014e1:	74 0b                	je     8014ee <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8014e3:	83 ec 0c             	sub    $0xc,%esp
+  8014e6:	56                   	push   %esi
+  8014e7:	ff d0                	call   *%eax
+  8014e9:	89 c3                	mov    %eax,%ebx
+  8014eb:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8014ee:	83 ec 08             	sub    $0x8,%esp
+  8014f1:	56                   	push   %esi
+  8014f2:	6a 00                	push   $0x0
+  8014f4:	e8 51 f9 ff ff       	call   800e4a <sys_page_unmap>
+	return r;
+  8014f9:	83 c4 10             	add    $0x10,%esp
+  8014fc:	eb b5                	jmp    8014b3 <fd_close+0x3c>
+
+008014fe <close>:
+
+int
+close(int fdnum)
+{
+  8014fe:	55                   	push   %ebp
+  8014ff:	89 e5                	mov    %esp,%ebp
+  801501:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801504:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801507:	50                   	push   %eax
+  801508:	ff 75 08             	push   0x8(%ebp)
+  80150b:	e8 cb fe ff ff       	call   8013db <fd_lookup>
+  801510:	83 c4 10             	add    $0x10,%esp
+  801513:	85 c0                	test   %eax,%eax
+  801515:	79 02                	jns    801519 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801517:	c9                   	leave
+  801518:	c3                   	ret
+		return fd_close(fd, 1);
+  801519:	83 ec 08             	sub    $0x8,%esp
+  80151c:	6a 01                	push   $0x1
+  80151e:	ff 75 f4             	push   -0xc(%ebp)
+  801521:	e8 51 ff ff ff       	call   801477 <fd_close>
+  801526:	83 c4 10             	add    $0x10,%esp
+  801529:	eb ec                	jmp    801517 <close+0x19>
+
+0080152b <close_all>:
+
+void
+close_all(void)
+{
+  80152b:	55                   	push   %ebp
+  80152c:	89 e5                	mov    %esp,%ebp
+  80152e:	53                   	push   %ebx
+  80152f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801532:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801537:	83 ec 0c             	sub    $0xc,%esp
+  80153a:	53                   	push   %ebx
+  80153b:	e8 be ff ff ff       	call   8014fe <close>
+	for (i = 0; i < MAXFD; i++)
+  801540:	83 c3 01             	add    $0x1,%ebx
+  801543:	83 c4 10             	add    $0x10,%esp
+  801546:	83 fb 20             	cmp    $0x20,%ebx
+  801549:	75 ec                	jne    801537 <close_all+0xc>
+}
+  80154b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80154e:	c9                   	leave
+  80154f:	c3                   	ret
+
+00801550 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801550:	55                   	push   %ebp
+  801551:	89 e5                	mov    %esp,%ebp
+  801553:	57                   	push   %edi
+  801554:	56                   	push   %esi
+  801555:	53                   	push   %ebx
+  801556:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801559:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80155c:	50                   	push   %eax
+  80155d:	ff 75 08             	push   0x8(%ebp)
+  801560:	e8 76 fe ff ff       	call   8013db <fd_lookup>
+  801565:	89 c3                	mov    %eax,%ebx
+  801567:	83 c4 10             	add    $0x10,%esp
+  80156a:	85 c0                	test   %eax,%eax
+  80156c:	78 7f                	js     8015ed <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80156e:	83 ec 0c             	sub    $0xc,%esp
+  801571:	ff 75 0c             	push   0xc(%ebp)
+  801574:	e8 85 ff ff ff       	call   8014fe <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801579:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80157c:	c1 e6 0c             	shl    $0xc,%esi
+  80157f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801585:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801588:	89 3c 24             	mov    %edi,(%esp)
+  80158b:	e8 e0 fd ff ff       	call   801370 <fd2data>
+  801590:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801592:	89 34 24             	mov    %esi,(%esp)
+  801595:	e8 d6 fd ff ff       	call   801370 <fd2data>
+  80159a:	83 c4 10             	add    $0x10,%esp
+  80159d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8015a0:	89 d8                	mov    %ebx,%eax
+  8015a2:	c1 e8 16             	shr    $0x16,%eax
+  8015a5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015ac:	a8 01                	test   $0x1,%al
+  8015ae:	74 11                	je     8015c1 <dup+0x71>
+  8015b0:	89 d8                	mov    %ebx,%eax
+  8015b2:	c1 e8 0c             	shr    $0xc,%eax
+  8015b5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015bc:	f6 c2 01             	test   $0x1,%dl
+  8015bf:	75 36                	jne    8015f7 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015c1:	89 f8                	mov    %edi,%eax
+  8015c3:	c1 e8 0c             	shr    $0xc,%eax
+  8015c6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015cd:	83 ec 0c             	sub    $0xc,%esp
+  8015d0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015d5:	50                   	push   %eax
+  8015d6:	56                   	push   %esi
+  8015d7:	6a 00                	push   $0x0
+  8015d9:	57                   	push   %edi
+  8015da:	6a 00                	push   $0x0
+  8015dc:	e8 27 f8 ff ff       	call   800e08 <sys_page_map>
+  8015e1:	89 c3                	mov    %eax,%ebx
+  8015e3:	83 c4 20             	add    $0x20,%esp
+  8015e6:	85 c0                	test   %eax,%eax
+  8015e8:	78 33                	js     80161d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8015ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8015ed:	89 d8                	mov    %ebx,%eax
+  8015ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015f2:	5b                   	pop    %ebx
+  8015f3:	5e                   	pop    %esi
+  8015f4:	5f                   	pop    %edi
+  8015f5:	5d                   	pop    %ebp
+  8015f6:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8015f7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015fe:	83 ec 0c             	sub    $0xc,%esp
+  801601:	25 07 0e 00 00       	and    $0xe07,%eax
+  801606:	50                   	push   %eax
+  801607:	ff 75 d4             	push   -0x2c(%ebp)
+  80160a:	6a 00                	push   $0x0
+  80160c:	53                   	push   %ebx
+  80160d:	6a 00                	push   $0x0
+  80160f:	e8 f4 f7 ff ff       	call   800e08 <sys_page_map>
+  801614:	89 c3                	mov    %eax,%ebx
+  801616:	83 c4 20             	add    $0x20,%esp
+  801619:	85 c0                	test   %eax,%eax
+  80161b:	79 a4                	jns    8015c1 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80161d:	83 ec 08             	sub    $0x8,%esp
+  801620:	56                   	push   %esi
+  801621:	6a 00                	push   $0x0
+  801623:	e8 22 f8 ff ff       	call   800e4a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801628:	83 c4 08             	add    $0x8,%esp
+  80162b:	ff 75 d4             	push   -0x2c(%ebp)
+  80162e:	6a 00                	push   $0x0
+  801630:	e8 15 f8 ff ff       	call   800e4a <sys_page_unmap>
+	return r;
+  801635:	83 c4 10             	add    $0x10,%esp
+  801638:	eb b3                	jmp    8015ed <dup+0x9d>
+
+0080163a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80163a:	55                   	push   %ebp
+  80163b:	89 e5                	mov    %esp,%ebp
+  80163d:	56                   	push   %esi
+  80163e:	53                   	push   %ebx
+  80163f:	83 ec 18             	sub    $0x18,%esp
+  801642:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801645:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801648:	50                   	push   %eax
+  801649:	56                   	push   %esi
+  80164a:	e8 8c fd ff ff       	call   8013db <fd_lookup>
+  80164f:	83 c4 10             	add    $0x10,%esp
+  801652:	85 c0                	test   %eax,%eax
+  801654:	78 3c                	js     801692 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801656:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801659:	83 ec 08             	sub    $0x8,%esp
+  80165c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80165f:	50                   	push   %eax
+  801660:	ff 33                	push   (%ebx)
+  801662:	e8 c4 fd ff ff       	call   80142b <dev_lookup>
+  801667:	83 c4 10             	add    $0x10,%esp
+  80166a:	85 c0                	test   %eax,%eax
+  80166c:	78 24                	js     801692 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80166e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801671:	83 e0 03             	and    $0x3,%eax
+  801674:	83 f8 01             	cmp    $0x1,%eax
+  801677:	74 20                	je     801699 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801679:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80167c:	8b 40 08             	mov    0x8(%eax),%eax
+  80167f:	85 c0                	test   %eax,%eax
+  801681:	74 37                	je     8016ba <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801683:	83 ec 04             	sub    $0x4,%esp
+  801686:	ff 75 10             	push   0x10(%ebp)
+  801689:	ff 75 0c             	push   0xc(%ebp)
+  80168c:	53                   	push   %ebx
+  80168d:	ff d0                	call   *%eax
+  80168f:	83 c4 10             	add    $0x10,%esp
+}
+  801692:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801695:	5b                   	pop    %ebx
+  801696:	5e                   	pop    %esi
+  801697:	5d                   	pop    %ebp
+  801698:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801699:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80169e:	8b 40 48             	mov    0x48(%eax),%eax
+  8016a1:	83 ec 04             	sub    $0x4,%esp
+  8016a4:	56                   	push   %esi
+  8016a5:	50                   	push   %eax
+  8016a6:	68 19 53 80 00       	push   $0x805319
+  8016ab:	e8 3b ec ff ff       	call   8002eb <cprintf>
+		return -E_INVAL;
+  8016b0:	83 c4 10             	add    $0x10,%esp
+  8016b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016b8:	eb d8                	jmp    801692 <read+0x58>
+		return -E_NOT_SUPP;
+  8016ba:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016bf:	eb d1                	jmp    801692 <read+0x58>
+
+008016c1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016c1:	55                   	push   %ebp
+  8016c2:	89 e5                	mov    %esp,%ebp
+  8016c4:	57                   	push   %edi
+  8016c5:	56                   	push   %esi
+  8016c6:	53                   	push   %ebx
+  8016c7:	83 ec 0c             	sub    $0xc,%esp
+  8016ca:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016cd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d5:	eb 02                	jmp    8016d9 <readn+0x18>
+  8016d7:	01 c3                	add    %eax,%ebx
+  8016d9:	39 f3                	cmp    %esi,%ebx
+  8016db:	73 21                	jae    8016fe <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016dd:	83 ec 04             	sub    $0x4,%esp
+  8016e0:	89 f0                	mov    %esi,%eax
+  8016e2:	29 d8                	sub    %ebx,%eax
+  8016e4:	50                   	push   %eax
+  8016e5:	89 d8                	mov    %ebx,%eax
+  8016e7:	03 45 0c             	add    0xc(%ebp),%eax
+  8016ea:	50                   	push   %eax
+  8016eb:	57                   	push   %edi
+  8016ec:	e8 49 ff ff ff       	call   80163a <read>
+		if (m < 0)
+  8016f1:	83 c4 10             	add    $0x10,%esp
+  8016f4:	85 c0                	test   %eax,%eax
+  8016f6:	78 04                	js     8016fc <readn+0x3b>
+			return m;
+		if (m == 0)
+  8016f8:	75 dd                	jne    8016d7 <readn+0x16>
+  8016fa:	eb 02                	jmp    8016fe <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016fc:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8016fe:	89 d8                	mov    %ebx,%eax
+  801700:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801703:	5b                   	pop    %ebx
+  801704:	5e                   	pop    %esi
+  801705:	5f                   	pop    %edi
+  801706:	5d                   	pop    %ebp
+  801707:	c3                   	ret
+
+00801708 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801708:	55                   	push   %ebp
+  801709:	89 e5                	mov    %esp,%ebp
+  80170b:	56                   	push   %esi
+  80170c:	53                   	push   %ebx
+  80170d:	83 ec 18             	sub    $0x18,%esp
+  801710:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801713:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801716:	50                   	push   %eax
+  801717:	53                   	push   %ebx
+  801718:	e8 be fc ff ff       	call   8013db <fd_lookup>
+  80171d:	83 c4 10             	add    $0x10,%esp
+  801720:	85 c0                	test   %eax,%eax
+  801722:	78 37                	js     80175b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801724:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801727:	83 ec 08             	sub    $0x8,%esp
+  80172a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80172d:	50                   	push   %eax
+  80172e:	ff 36                	push   (%esi)
+  801730:	e8 f6 fc ff ff       	call   80142b <dev_lookup>
+  801735:	83 c4 10             	add    $0x10,%esp
+  801738:	85 c0                	test   %eax,%eax
+  80173a:	78 1f                	js     80175b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80173c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801740:	74 20                	je     801762 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801742:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801745:	8b 40 0c             	mov    0xc(%eax),%eax
+  801748:	85 c0                	test   %eax,%eax
+  80174a:	74 37                	je     801783 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80174c:	83 ec 04             	sub    $0x4,%esp
+  80174f:	ff 75 10             	push   0x10(%ebp)
+  801752:	ff 75 0c             	push   0xc(%ebp)
+  801755:	56                   	push   %esi
+  801756:	ff d0                	call   *%eax
+  801758:	83 c4 10             	add    $0x10,%esp
+}
+  80175b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80175e:	5b                   	pop    %ebx
+  80175f:	5e                   	pop    %esi
+  801760:	5d                   	pop    %ebp
+  801761:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801762:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801767:	8b 40 48             	mov    0x48(%eax),%eax
+  80176a:	83 ec 04             	sub    $0x4,%esp
+  80176d:	53                   	push   %ebx
+  80176e:	50                   	push   %eax
+  80176f:	68 35 53 80 00       	push   $0x805335
+  801774:	e8 72 eb ff ff       	call   8002eb <cprintf>
+		return -E_INVAL;
+  801779:	83 c4 10             	add    $0x10,%esp
+  80177c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801781:	eb d8                	jmp    80175b <write+0x53>
+		return -E_NOT_SUPP;
+  801783:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801788:	eb d1                	jmp    80175b <write+0x53>
+
+0080178a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80178a:	55                   	push   %ebp
+  80178b:	89 e5                	mov    %esp,%ebp
+  80178d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801790:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801793:	50                   	push   %eax
+  801794:	ff 75 08             	push   0x8(%ebp)
+  801797:	e8 3f fc ff ff       	call   8013db <fd_lookup>
+  80179c:	83 c4 10             	add    $0x10,%esp
+  80179f:	85 c0                	test   %eax,%eax
+  8017a1:	78 0e                	js     8017b1 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8017a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017a9:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8017ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017b1:	c9                   	leave
+  8017b2:	c3                   	ret
+
+008017b3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017b3:	55                   	push   %ebp
+  8017b4:	89 e5                	mov    %esp,%ebp
+  8017b6:	56                   	push   %esi
+  8017b7:	53                   	push   %ebx
+  8017b8:	83 ec 18             	sub    $0x18,%esp
+  8017bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017be:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017c1:	50                   	push   %eax
+  8017c2:	53                   	push   %ebx
+  8017c3:	e8 13 fc ff ff       	call   8013db <fd_lookup>
+  8017c8:	83 c4 10             	add    $0x10,%esp
+  8017cb:	85 c0                	test   %eax,%eax
+  8017cd:	78 34                	js     801803 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017cf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017d2:	83 ec 08             	sub    $0x8,%esp
+  8017d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017d8:	50                   	push   %eax
+  8017d9:	ff 36                	push   (%esi)
+  8017db:	e8 4b fc ff ff       	call   80142b <dev_lookup>
+  8017e0:	83 c4 10             	add    $0x10,%esp
+  8017e3:	85 c0                	test   %eax,%eax
+  8017e5:	78 1c                	js     801803 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017e7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017eb:	74 1d                	je     80180a <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8017ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017f0:	8b 40 18             	mov    0x18(%eax),%eax
+  8017f3:	85 c0                	test   %eax,%eax
+  8017f5:	74 34                	je     80182b <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8017f7:	83 ec 08             	sub    $0x8,%esp
+  8017fa:	ff 75 0c             	push   0xc(%ebp)
+  8017fd:	56                   	push   %esi
+  8017fe:	ff d0                	call   *%eax
+  801800:	83 c4 10             	add    $0x10,%esp
+}
+  801803:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801806:	5b                   	pop    %ebx
+  801807:	5e                   	pop    %esi
+  801808:	5d                   	pop    %ebp
+  801809:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80180a:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80180f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801812:	83 ec 04             	sub    $0x4,%esp
+  801815:	53                   	push   %ebx
+  801816:	50                   	push   %eax
+  801817:	68 f8 52 80 00       	push   $0x8052f8
+  80181c:	e8 ca ea ff ff       	call   8002eb <cprintf>
+		return -E_INVAL;
+  801821:	83 c4 10             	add    $0x10,%esp
+  801824:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801829:	eb d8                	jmp    801803 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80182b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801830:	eb d1                	jmp    801803 <ftruncate+0x50>
+
+00801832 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801832:	55                   	push   %ebp
+  801833:	89 e5                	mov    %esp,%ebp
+  801835:	56                   	push   %esi
+  801836:	53                   	push   %ebx
+  801837:	83 ec 18             	sub    $0x18,%esp
+  80183a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80183d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801840:	50                   	push   %eax
+  801841:	ff 75 08             	push   0x8(%ebp)
+  801844:	e8 92 fb ff ff       	call   8013db <fd_lookup>
+  801849:	83 c4 10             	add    $0x10,%esp
+  80184c:	85 c0                	test   %eax,%eax
+  80184e:	78 49                	js     801899 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801850:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801853:	83 ec 08             	sub    $0x8,%esp
+  801856:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801859:	50                   	push   %eax
+  80185a:	ff 36                	push   (%esi)
+  80185c:	e8 ca fb ff ff       	call   80142b <dev_lookup>
+  801861:	83 c4 10             	add    $0x10,%esp
+  801864:	85 c0                	test   %eax,%eax
+  801866:	78 31                	js     801899 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801868:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80186b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80186f:	74 2f                	je     8018a0 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801871:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801874:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80187b:	00 00 00 
+	stat->st_isdir = 0;
+  80187e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801885:	00 00 00 
+	stat->st_dev = dev;
+  801888:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80188e:	83 ec 08             	sub    $0x8,%esp
+  801891:	53                   	push   %ebx
+  801892:	56                   	push   %esi
+  801893:	ff 50 14             	call   *0x14(%eax)
+  801896:	83 c4 10             	add    $0x10,%esp
+}
+  801899:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80189c:	5b                   	pop    %ebx
+  80189d:	5e                   	pop    %esi
+  80189e:	5d                   	pop    %ebp
+  80189f:	c3                   	ret
+		return -E_NOT_SUPP;
+  8018a0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018a5:	eb f2                	jmp    801899 <fstat+0x67>
+
+008018a7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018a7:	55                   	push   %ebp
+  8018a8:	89 e5                	mov    %esp,%ebp
+  8018aa:	56                   	push   %esi
+  8018ab:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8018ac:	83 ec 08             	sub    $0x8,%esp
+  8018af:	6a 00                	push   $0x0
+  8018b1:	ff 75 08             	push   0x8(%ebp)
+  8018b4:	e8 bc 02 00 00       	call   801b75 <open>
+  8018b9:	89 c3                	mov    %eax,%ebx
+  8018bb:	83 c4 10             	add    $0x10,%esp
+  8018be:	85 c0                	test   %eax,%eax
+  8018c0:	78 1b                	js     8018dd <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8018c2:	83 ec 08             	sub    $0x8,%esp
+  8018c5:	ff 75 0c             	push   0xc(%ebp)
+  8018c8:	50                   	push   %eax
+  8018c9:	e8 64 ff ff ff       	call   801832 <fstat>
+  8018ce:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8018d0:	89 1c 24             	mov    %ebx,(%esp)
+  8018d3:	e8 26 fc ff ff       	call   8014fe <close>
+	return r;
+  8018d8:	83 c4 10             	add    $0x10,%esp
+  8018db:	89 f3                	mov    %esi,%ebx
+}
+  8018dd:	89 d8                	mov    %ebx,%eax
+  8018df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018e2:	5b                   	pop    %ebx
+  8018e3:	5e                   	pop    %esi
+  8018e4:	5d                   	pop    %ebp
+  8018e5:	c3                   	ret
+
+008018e6 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  8018e6:	55                   	push   %ebp
+  8018e7:	89 e5                	mov    %esp,%ebp
+  8018e9:	57                   	push   %edi
+  8018ea:	56                   	push   %esi
+  8018eb:	53                   	push   %ebx
+  8018ec:	83 ec 0c             	sub    $0xc,%esp
+  8018ef:	89 c7                	mov    %eax,%edi
+  8018f1:	89 d3                	mov    %edx,%ebx
+  8018f3:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8018f5:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8018fc:	74 2d                	je     80192b <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018fe:	6a 07                	push   $0x7
+  801900:	68 00 f0 80 00       	push   $0x80f000
+  801905:	57                   	push   %edi
+  801906:	ff 35 00 70 80 00    	push   0x807000
+  80190c:	e8 4e 31 00 00       	call   804a5f <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801911:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801918:	6a 00                	push   $0x0
+  80191a:	56                   	push   %esi
+  80191b:	53                   	push   %ebx
+  80191c:	6a 00                	push   $0x0
+  80191e:	e8 ee 2f 00 00       	call   804911 <ipc_recv_pages>
+}
+  801923:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801926:	5b                   	pop    %ebx
+  801927:	5e                   	pop    %esi
+  801928:	5f                   	pop    %edi
+  801929:	5d                   	pop    %ebp
+  80192a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80192b:	83 ec 0c             	sub    $0xc,%esp
+  80192e:	6a 01                	push   $0x1
+  801930:	e8 1f 32 00 00       	call   804b54 <ipc_find_env>
+  801935:	a3 00 70 80 00       	mov    %eax,0x807000
+  80193a:	83 c4 10             	add    $0x10,%esp
+  80193d:	eb bf                	jmp    8018fe <fsipc_pages+0x18>
+
+0080193f <fsipc>:
+{
+  80193f:	55                   	push   %ebp
+  801940:	89 e5                	mov    %esp,%ebp
+  801942:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801945:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80194a:	e8 97 ff ff ff       	call   8018e6 <fsipc_pages>
+}
+  80194f:	c9                   	leave
+  801950:	c3                   	ret
+
+00801951 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801951:	55                   	push   %ebp
+  801952:	89 e5                	mov    %esp,%ebp
+  801954:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801957:	8b 45 08             	mov    0x8(%ebp),%eax
+  80195a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80195d:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  801962:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801965:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80196a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80196f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801974:	e8 c6 ff ff ff       	call   80193f <fsipc>
+}
+  801979:	c9                   	leave
+  80197a:	c3                   	ret
+
+0080197b <devfile_flush>:
+{
+  80197b:	55                   	push   %ebp
+  80197c:	89 e5                	mov    %esp,%ebp
+  80197e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801981:	8b 45 08             	mov    0x8(%ebp),%eax
+  801984:	8b 40 0c             	mov    0xc(%eax),%eax
+  801987:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80198c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801991:	b8 06 00 00 00       	mov    $0x6,%eax
+  801996:	e8 a4 ff ff ff       	call   80193f <fsipc>
+}
+  80199b:	c9                   	leave
+  80199c:	c3                   	ret
+
+0080199d <devfile_stat>:
+{
+  80199d:	55                   	push   %ebp
+  80199e:	89 e5                	mov    %esp,%ebp
+  8019a0:	53                   	push   %ebx
+  8019a1:	83 ec 04             	sub    $0x4,%esp
+  8019a4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019aa:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019ad:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019bc:	e8 7e ff ff ff       	call   80193f <fsipc>
+  8019c1:	85 c0                	test   %eax,%eax
+  8019c3:	78 2c                	js     8019f1 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019c5:	83 ec 08             	sub    $0x8,%esp
+  8019c8:	68 00 f0 80 00       	push   $0x80f000
+  8019cd:	53                   	push   %ebx
+  8019ce:	e8 ff ee ff ff       	call   8008d2 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8019d3:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  8019d8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019de:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  8019e3:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8019e9:	83 c4 10             	add    $0x10,%esp
+  8019ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019f4:	c9                   	leave
+  8019f5:	c3                   	ret
+
+008019f6 <devfile_write>:
+{
+  8019f6:	55                   	push   %ebp
+  8019f7:	89 e5                	mov    %esp,%ebp
+  8019f9:	83 ec 0c             	sub    $0xc,%esp
+  8019fc:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8019ff:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a04:	39 d0                	cmp    %edx,%eax
+  801a06:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a09:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a0c:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a0f:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  801a15:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801a1a:	50                   	push   %eax
+  801a1b:	ff 75 0c             	push   0xc(%ebp)
+  801a1e:	68 08 f0 80 00       	push   $0x80f008
+  801a23:	e8 30 f0 ff ff       	call   800a58 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801a28:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a2d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a32:	e8 08 ff ff ff       	call   80193f <fsipc>
+}
+  801a37:	c9                   	leave
+  801a38:	c3                   	ret
+
+00801a39 <devfile_read>:
+{
+  801a39:	55                   	push   %ebp
+  801a3a:	89 e5                	mov    %esp,%ebp
+  801a3c:	57                   	push   %edi
+  801a3d:	56                   	push   %esi
+  801a3e:	53                   	push   %ebx
+  801a3f:	83 ec 1c             	sub    $0x1c,%esp
+  801a42:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a45:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a48:	89 fe                	mov    %edi,%esi
+  801a4a:	c1 ee 0c             	shr    $0xc,%esi
+  801a4d:	b8 20 00 00 00       	mov    $0x20,%eax
+  801a52:	39 c6                	cmp    %eax,%esi
+  801a54:	0f 47 f0             	cmova  %eax,%esi
+  801a57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a5f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801a62:	eb 14                	jmp    801a78 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a64:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801a6b:	05 00 10 00 00       	add    $0x1000,%eax
+  801a70:	f6 c6 06             	test   $0x6,%dh
+  801a73:	75 42                	jne    801ab7 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a75:	83 c1 01             	add    $0x1,%ecx
+  801a78:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801a7b:	39 f1                	cmp    %esi,%ecx
+  801a7d:	0f 84 95 00 00 00    	je     801b18 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801a83:	89 c2                	mov    %eax,%edx
+  801a85:	c1 ea 16             	shr    $0x16,%edx
+  801a88:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a8f:	f6 c2 01             	test   $0x1,%dl
+  801a92:	74 23                	je     801ab7 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801a94:	89 c2                	mov    %eax,%edx
+  801a96:	c1 ea 0c             	shr    $0xc,%edx
+  801a99:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801aa0:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801aa6:	74 0f                	je     801ab7 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801aa8:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801aaf:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801ab5:	75 ad                	jne    801a64 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801ab7:	85 c9                	test   %ecx,%ecx
+  801ab9:	74 11                	je     801acc <devfile_read+0x93>
+  801abb:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801ac2:	75 08                	jne    801acc <devfile_read+0x93>
+  801ac4:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801aca:	74 50                	je     801b1c <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801acc:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801acf:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  801ad4:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ada:	ba 00 00 00 00       	mov    $0x0,%edx
+  801adf:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ae4:	e8 56 fe ff ff       	call   80193f <fsipc>
+  801ae9:	89 c6                	mov    %eax,%esi
+  801aeb:	85 c0                	test   %eax,%eax
+  801aed:	78 1f                	js     801b0e <devfile_read+0xd5>
+	assert(r <= n);
+  801aef:	39 c7                	cmp    %eax,%edi
+  801af1:	72 50                	jb     801b43 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801af3:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801af8:	7f 62                	jg     801b5c <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801afa:	83 ec 04             	sub    $0x4,%esp
+  801afd:	50                   	push   %eax
+  801afe:	68 00 f0 80 00       	push   $0x80f000
+  801b03:	ff 75 0c             	push   0xc(%ebp)
+  801b06:	e8 4d ef ff ff       	call   800a58 <memmove>
+	return r;
+  801b0b:	83 c4 10             	add    $0x10,%esp
+}
+  801b0e:	89 f0                	mov    %esi,%eax
+  801b10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b13:	5b                   	pop    %ebx
+  801b14:	5e                   	pop    %esi
+  801b15:	5f                   	pop    %edi
+  801b16:	5d                   	pop    %ebp
+  801b17:	c3                   	ret
+  801b18:	89 f1                	mov    %esi,%ecx
+  801b1a:	eb 9b                	jmp    801ab7 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801b1c:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b1f:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801b24:	89 c8                	mov    %ecx,%eax
+  801b26:	c1 e0 0c             	shl    $0xc,%eax
+  801b29:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801b2e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b31:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801b36:	e8 ab fd ff ff       	call   8018e6 <fsipc_pages>
+  801b3b:	89 c6                	mov    %eax,%esi
+  801b3d:	85 c0                	test   %eax,%eax
+  801b3f:	78 8b                	js     801acc <devfile_read+0x93>
+  801b41:	eb cb                	jmp    801b0e <devfile_read+0xd5>
+	assert(r <= n);
+  801b43:	68 64 53 80 00       	push   $0x805364
+  801b48:	68 03 4e 80 00       	push   $0x804e03
+  801b4d:	68 a0 00 00 00       	push   $0xa0
+  801b52:	68 6b 53 80 00       	push   $0x80536b
+  801b57:	e8 b4 e6 ff ff       	call   800210 <_panic>
+	assert(r <= PGSIZE);
+  801b5c:	68 76 53 80 00       	push   $0x805376
+  801b61:	68 03 4e 80 00       	push   $0x804e03
+  801b66:	68 a1 00 00 00       	push   $0xa1
+  801b6b:	68 6b 53 80 00       	push   $0x80536b
+  801b70:	e8 9b e6 ff ff       	call   800210 <_panic>
+
+00801b75 <open>:
+{
+  801b75:	55                   	push   %ebp
+  801b76:	89 e5                	mov    %esp,%ebp
+  801b78:	56                   	push   %esi
+  801b79:	53                   	push   %ebx
+  801b7a:	83 ec 1c             	sub    $0x1c,%esp
+  801b7d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801b80:	56                   	push   %esi
+  801b81:	e8 11 ed ff ff       	call   800897 <strlen>
+  801b86:	83 c4 10             	add    $0x10,%esp
+  801b89:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b8e:	7f 6c                	jg     801bfc <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801b90:	83 ec 0c             	sub    $0xc,%esp
+  801b93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b96:	50                   	push   %eax
+  801b97:	e8 eb f7 ff ff       	call   801387 <fd_alloc>
+  801b9c:	89 c3                	mov    %eax,%ebx
+  801b9e:	83 c4 10             	add    $0x10,%esp
+  801ba1:	85 c0                	test   %eax,%eax
+  801ba3:	78 3c                	js     801be1 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801ba5:	83 ec 08             	sub    $0x8,%esp
+  801ba8:	56                   	push   %esi
+  801ba9:	68 00 f0 80 00       	push   $0x80f000
+  801bae:	e8 1f ed ff ff       	call   8008d2 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801bb3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bb6:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bbb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801bbe:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bc3:	e8 77 fd ff ff       	call   80193f <fsipc>
+  801bc8:	89 c3                	mov    %eax,%ebx
+  801bca:	83 c4 10             	add    $0x10,%esp
+  801bcd:	85 c0                	test   %eax,%eax
+  801bcf:	78 19                	js     801bea <open+0x75>
+	return fd2num(fd);
+  801bd1:	83 ec 0c             	sub    $0xc,%esp
+  801bd4:	ff 75 f4             	push   -0xc(%ebp)
+  801bd7:	e8 84 f7 ff ff       	call   801360 <fd2num>
+  801bdc:	89 c3                	mov    %eax,%ebx
+  801bde:	83 c4 10             	add    $0x10,%esp
+}
+  801be1:	89 d8                	mov    %ebx,%eax
+  801be3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be6:	5b                   	pop    %ebx
+  801be7:	5e                   	pop    %esi
+  801be8:	5d                   	pop    %ebp
+  801be9:	c3                   	ret
+		fd_close(fd, 0);
+  801bea:	83 ec 08             	sub    $0x8,%esp
+  801bed:	6a 00                	push   $0x0
+  801bef:	ff 75 f4             	push   -0xc(%ebp)
+  801bf2:	e8 80 f8 ff ff       	call   801477 <fd_close>
+		return r;
+  801bf7:	83 c4 10             	add    $0x10,%esp
+  801bfa:	eb e5                	jmp    801be1 <open+0x6c>
+		return -E_BAD_PATH;
+  801bfc:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c01:	eb de                	jmp    801be1 <open+0x6c>
+
+00801c03 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801c03:	55                   	push   %ebp
+  801c04:	89 e5                	mov    %esp,%ebp
+  801c06:	53                   	push   %ebx
+  801c07:	83 ec 10             	sub    $0x10,%esp
+  801c0a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801c0d:	53                   	push   %ebx
+  801c0e:	e8 84 ec ff ff       	call   800897 <strlen>
+  801c13:	83 c4 10             	add    $0x10,%esp
+  801c16:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c1b:	7f 25                	jg     801c42 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801c1d:	83 ec 08             	sub    $0x8,%esp
+  801c20:	53                   	push   %ebx
+  801c21:	68 00 f0 80 00       	push   $0x80f000
+  801c26:	e8 a7 ec ff ff       	call   8008d2 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801c2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c30:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c35:	e8 05 fd ff ff       	call   80193f <fsipc>
+  801c3a:	83 c4 10             	add    $0x10,%esp
+}
+  801c3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c40:	c9                   	leave
+  801c41:	c3                   	ret
+		return -E_BAD_PATH;
+  801c42:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801c47:	eb f4                	jmp    801c3d <remove+0x3a>
+
+00801c49 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c49:	55                   	push   %ebp
+  801c4a:	89 e5                	mov    %esp,%ebp
+  801c4c:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c54:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c59:	e8 e1 fc ff ff       	call   80193f <fsipc>
+}
+  801c5e:	c9                   	leave
+  801c5f:	c3                   	ret
+
+00801c60 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801c60:	55                   	push   %ebp
+  801c61:	89 e5                	mov    %esp,%ebp
+  801c63:	53                   	push   %ebx
+  801c64:	83 ec 04             	sub    $0x4,%esp
+  801c67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801c6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c6f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c74:	e8 c6 fc ff ff       	call   80193f <fsipc>
+  801c79:	85 c0                	test   %eax,%eax
+  801c7b:	78 3c                	js     801cb9 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801c7d:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  801c82:	89 03                	mov    %eax,(%ebx)
+  801c84:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  801c89:	89 43 04             	mov    %eax,0x4(%ebx)
+  801c8c:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  801c91:	89 43 08             	mov    %eax,0x8(%ebx)
+  801c94:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  801c99:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801c9c:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  801ca1:	89 43 10             	mov    %eax,0x10(%ebx)
+  801ca4:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  801ca9:	89 43 14             	mov    %eax,0x14(%ebx)
+  801cac:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  801cb1:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801cb4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cb9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cbc:	c9                   	leave
+  801cbd:	c3                   	ret
+
+00801cbe <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801cbe:	55                   	push   %ebp
+  801cbf:	89 e5                	mov    %esp,%ebp
+  801cc1:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801cc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cc7:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  801ccc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cd1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801cd6:	e8 64 fc ff ff       	call   80193f <fsipc>
+}
+  801cdb:	c9                   	leave
+  801cdc:	c3                   	ret
+
+00801cdd <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801cdd:	55                   	push   %ebp
+  801cde:	89 e5                	mov    %esp,%ebp
+  801ce0:	56                   	push   %esi
+  801ce1:	53                   	push   %ebx
+  801ce2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801ce5:	83 ec 0c             	sub    $0xc,%esp
+  801ce8:	ff 75 08             	push   0x8(%ebp)
+  801ceb:	e8 80 f6 ff ff       	call   801370 <fd2data>
+  801cf0:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801cf2:	83 c4 08             	add    $0x8,%esp
+  801cf5:	68 82 53 80 00       	push   $0x805382
+  801cfa:	53                   	push   %ebx
+  801cfb:	e8 d2 eb ff ff       	call   8008d2 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801d00:	8b 46 04             	mov    0x4(%esi),%eax
+  801d03:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801d09:	2b 0e                	sub    (%esi),%ecx
+  801d0b:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801d10:	89 c8                	mov    %ecx,%eax
+  801d12:	f7 e2                	mul    %edx
+  801d14:	c1 ea 0c             	shr    $0xc,%edx
+  801d17:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801d1d:	29 d1                	sub    %edx,%ecx
+  801d1f:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801d25:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d2c:	00 00 00 
+	stat->st_dev = &devpipe;
+  801d2f:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  801d36:	60 80 00 
+	return 0;
+}
+  801d39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d41:	5b                   	pop    %ebx
+  801d42:	5e                   	pop    %esi
+  801d43:	5d                   	pop    %ebp
+  801d44:	c3                   	ret
+
+00801d45 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801d45:	55                   	push   %ebp
+  801d46:	89 e5                	mov    %esp,%ebp
+  801d48:	53                   	push   %ebx
+  801d49:	83 ec 0c             	sub    $0xc,%esp
+  801d4c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801d4f:	53                   	push   %ebx
+  801d50:	6a 00                	push   $0x0
+  801d52:	e8 f3 f0 ff ff       	call   800e4a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801d57:	89 1c 24             	mov    %ebx,(%esp)
+  801d5a:	e8 11 f6 ff ff       	call   801370 <fd2data>
+  801d5f:	83 c4 08             	add    $0x8,%esp
+  801d62:	50                   	push   %eax
+  801d63:	6a 00                	push   $0x0
+  801d65:	e8 e0 f0 ff ff       	call   800e4a <sys_page_unmap>
+}
+  801d6a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d6d:	c9                   	leave
+  801d6e:	c3                   	ret
+
+00801d6f <_pipeisclosed>:
+{
+  801d6f:	55                   	push   %ebp
+  801d70:	89 e5                	mov    %esp,%ebp
+  801d72:	57                   	push   %edi
+  801d73:	56                   	push   %esi
+  801d74:	53                   	push   %ebx
+  801d75:	83 ec 1c             	sub    $0x1c,%esp
+  801d78:	89 c7                	mov    %eax,%edi
+  801d7a:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801d7c:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801d81:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801d84:	83 ec 0c             	sub    $0xc,%esp
+  801d87:	57                   	push   %edi
+  801d88:	e8 06 2e 00 00       	call   804b93 <pageref>
+  801d8d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d90:	89 34 24             	mov    %esi,(%esp)
+  801d93:	e8 fb 2d 00 00       	call   804b93 <pageref>
+		nn = thisenv->env_runs;
+  801d98:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  801d9e:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801da1:	83 c4 10             	add    $0x10,%esp
+  801da4:	39 cb                	cmp    %ecx,%ebx
+  801da6:	74 1b                	je     801dc3 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801da8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801dab:	75 cf                	jne    801d7c <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801dad:	8b 42 58             	mov    0x58(%edx),%eax
+  801db0:	6a 01                	push   $0x1
+  801db2:	50                   	push   %eax
+  801db3:	53                   	push   %ebx
+  801db4:	68 89 53 80 00       	push   $0x805389
+  801db9:	e8 2d e5 ff ff       	call   8002eb <cprintf>
+  801dbe:	83 c4 10             	add    $0x10,%esp
+  801dc1:	eb b9                	jmp    801d7c <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801dc3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801dc6:	0f 94 c0             	sete   %al
+  801dc9:	0f b6 c0             	movzbl %al,%eax
+}
+  801dcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dcf:	5b                   	pop    %ebx
+  801dd0:	5e                   	pop    %esi
+  801dd1:	5f                   	pop    %edi
+  801dd2:	5d                   	pop    %ebp
+  801dd3:	c3                   	ret
+
+00801dd4 <devpipe_read>:
+{
+  801dd4:	55                   	push   %ebp
+  801dd5:	89 e5                	mov    %esp,%ebp
+  801dd7:	57                   	push   %edi
+  801dd8:	56                   	push   %esi
+  801dd9:	53                   	push   %ebx
+  801dda:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801ddd:	ff 75 08             	push   0x8(%ebp)
+  801de0:	e8 8b f5 ff ff       	call   801370 <fd2data>
+  801de5:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801de7:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801dea:	8d 40 04             	lea    0x4(%eax),%eax
+  801ded:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801df0:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801df3:	8b 0b                	mov    (%ebx),%ecx
+  801df5:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801dfb:	29 ce                	sub    %ecx,%esi
+  801dfd:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e02:	f7 e6                	mul    %esi
+  801e04:	c1 ea 0c             	shr    $0xc,%edx
+  801e07:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801e0d:	29 c6                	sub    %eax,%esi
+  801e0f:	89 f2                	mov    %esi,%edx
+  801e11:	75 43                	jne    801e56 <devpipe_read+0x82>
+		ref = pageref(p);
+  801e13:	83 ec 0c             	sub    $0xc,%esp
+  801e16:	53                   	push   %ebx
+  801e17:	e8 77 2d 00 00       	call   804b93 <pageref>
+  801e1c:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801e1e:	89 da                	mov    %ebx,%edx
+  801e20:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e23:	e8 47 ff ff ff       	call   801d6f <_pipeisclosed>
+  801e28:	83 c4 10             	add    $0x10,%esp
+  801e2b:	85 c0                	test   %eax,%eax
+  801e2d:	0f 85 c1 00 00 00    	jne    801ef4 <devpipe_read+0x120>
+	*sleeping = 1;
+  801e33:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801e3a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801e3f:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801e42:	75 ac                	jne    801df0 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801e44:	83 ec 04             	sub    $0x4,%esp
+  801e47:	56                   	push   %esi
+  801e48:	57                   	push   %edi
+  801e49:	ff 75 e4             	push   -0x1c(%ebp)
+  801e4c:	e8 4d f4 ff ff       	call   80129e <sys_futex_wait>
+  801e51:	83 c4 10             	add    $0x10,%esp
+  801e54:	eb 9a                	jmp    801df0 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801e56:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801e59:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801e5d:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801e5f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e64:	f7 e1                	mul    %ecx
+  801e66:	c1 ea 0b             	shr    $0xb,%edx
+  801e69:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801e6f:	29 c1                	sub    %eax,%ecx
+  801e71:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801e73:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801e78:	29 cf                	sub    %ecx,%edi
+  801e7a:	39 f7                	cmp    %esi,%edi
+  801e7c:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801e7f:	8d 43 10             	lea    0x10(%ebx),%eax
+  801e82:	83 ec 04             	sub    $0x4,%esp
+  801e85:	57                   	push   %edi
+  801e86:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e89:	01 c2                	add    %eax,%edx
+  801e8b:	52                   	push   %edx
+  801e8c:	ff 75 0c             	push   0xc(%ebp)
+  801e8f:	e8 c4 eb ff ff       	call   800a58 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801e94:	83 c4 0c             	add    $0xc,%esp
+  801e97:	89 f1                	mov    %esi,%ecx
+  801e99:	29 f9                	sub    %edi,%ecx
+  801e9b:	51                   	push   %ecx
+  801e9c:	ff 75 e4             	push   -0x1c(%ebp)
+  801e9f:	89 f8                	mov    %edi,%eax
+  801ea1:	03 45 0c             	add    0xc(%ebp),%eax
+  801ea4:	50                   	push   %eax
+  801ea5:	e8 ae eb ff ff       	call   800a58 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801eaa:	89 f1                	mov    %esi,%ecx
+  801eac:	03 0b                	add    (%ebx),%ecx
+  801eae:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801eb3:	f7 e1                	mul    %ecx
+  801eb5:	c1 ea 0c             	shr    $0xc,%edx
+  801eb8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801ebe:	29 d1                	sub    %edx,%ecx
+  801ec0:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801ec2:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801ec7:	83 c4 10             	add    $0x10,%esp
+  801eca:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801ece:	75 0a                	jne    801eda <devpipe_read+0x106>
+	return n;
+  801ed0:	89 f0                	mov    %esi,%eax
+}
+  801ed2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ed5:	5b                   	pop    %ebx
+  801ed6:	5e                   	pop    %esi
+  801ed7:	5f                   	pop    %edi
+  801ed8:	5d                   	pop    %ebp
+  801ed9:	c3                   	ret
+		*sleeping = 0;
+  801eda:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801ee1:	83 ec 08             	sub    $0x8,%esp
+  801ee4:	68 00 04 00 00       	push   $0x400
+  801ee9:	53                   	push   %ebx
+  801eea:	e8 ff f3 ff ff       	call   8012ee <sys_futex_wake>
+  801eef:	83 c4 10             	add    $0x10,%esp
+  801ef2:	eb dc                	jmp    801ed0 <devpipe_read+0xfc>
+			return 0;
+  801ef4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef9:	eb d7                	jmp    801ed2 <devpipe_read+0xfe>
+
+00801efb <devpipe_write>:
+{
+  801efb:	55                   	push   %ebp
+  801efc:	89 e5                	mov    %esp,%ebp
+  801efe:	57                   	push   %edi
+  801eff:	56                   	push   %esi
+  801f00:	53                   	push   %ebx
+  801f01:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801f04:	ff 75 08             	push   0x8(%ebp)
+  801f07:	e8 64 f4 ff ff       	call   801370 <fd2data>
+  801f0c:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801f0e:	83 c4 10             	add    $0x10,%esp
+  801f11:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801f18:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f1b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801f1e:	0f 83 23 01 00 00    	jae    802047 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801f24:	8b 77 04             	mov    0x4(%edi),%esi
+  801f27:	8b 1f                	mov    (%edi),%ebx
+  801f29:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801f2f:	29 d9                	sub    %ebx,%ecx
+  801f31:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f36:	f7 e1                	mul    %ecx
+  801f38:	c1 ea 0c             	shr    $0xc,%edx
+  801f3b:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801f41:	29 c1                	sub    %eax,%ecx
+  801f43:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801f45:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801f4b:	75 40                	jne    801f8d <devpipe_write+0x92>
+			ref = pageref(p);
+  801f4d:	83 ec 0c             	sub    $0xc,%esp
+  801f50:	57                   	push   %edi
+  801f51:	e8 3d 2c 00 00       	call   804b93 <pageref>
+  801f56:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801f58:	89 fa                	mov    %edi,%edx
+  801f5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5d:	e8 0d fe ff ff       	call   801d6f <_pipeisclosed>
+  801f62:	83 c4 10             	add    $0x10,%esp
+  801f65:	85 c0                	test   %eax,%eax
+  801f67:	0f 85 d5 00 00 00    	jne    802042 <devpipe_write+0x147>
+	*sleeping = 1;
+  801f6d:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801f74:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801f79:	39 1f                	cmp    %ebx,(%edi)
+  801f7b:	75 a7                	jne    801f24 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801f7d:	83 ec 04             	sub    $0x4,%esp
+  801f80:	56                   	push   %esi
+  801f81:	53                   	push   %ebx
+  801f82:	57                   	push   %edi
+  801f83:	e8 16 f3 ff ff       	call   80129e <sys_futex_wait>
+  801f88:	83 c4 10             	add    $0x10,%esp
+  801f8b:	eb 97                	jmp    801f24 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801f8d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801f90:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f93:	29 c1                	sub    %eax,%ecx
+  801f95:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801f9a:	89 d8                	mov    %ebx,%eax
+  801f9c:	29 d0                	sub    %edx,%eax
+  801f9e:	39 c1                	cmp    %eax,%ecx
+  801fa0:	0f 46 c1             	cmovbe %ecx,%eax
+  801fa3:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801fa5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801faa:	f7 e6                	mul    %esi
+  801fac:	c1 ea 0b             	shr    $0xb,%edx
+  801faf:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801fb5:	29 c6                	sub    %eax,%esi
+  801fb7:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801fb9:	29 f3                	sub    %esi,%ebx
+  801fbb:	39 cb                	cmp    %ecx,%ebx
+  801fbd:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801fc0:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801fc3:	8d 77 10             	lea    0x10(%edi),%esi
+  801fc6:	83 ec 04             	sub    $0x4,%esp
+  801fc9:	53                   	push   %ebx
+  801fca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fcd:	03 45 0c             	add    0xc(%ebp),%eax
+  801fd0:	50                   	push   %eax
+  801fd1:	01 f2                	add    %esi,%edx
+  801fd3:	52                   	push   %edx
+  801fd4:	e8 7f ea ff ff       	call   800a58 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  801fd9:	83 c4 0c             	add    $0xc,%esp
+  801fdc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801fdf:	29 d8                	sub    %ebx,%eax
+  801fe1:	50                   	push   %eax
+  801fe2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fe5:	01 d3                	add    %edx,%ebx
+  801fe7:	03 5d 0c             	add    0xc(%ebp),%ebx
+  801fea:	53                   	push   %ebx
+  801feb:	56                   	push   %esi
+  801fec:	e8 67 ea ff ff       	call   800a58 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  801ff1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801ff4:	03 4f 04             	add    0x4(%edi),%ecx
+  801ff7:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801ffc:	f7 e1                	mul    %ecx
+  801ffe:	c1 ea 0c             	shr    $0xc,%edx
+  802001:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802007:	29 d1                	sub    %edx,%ecx
+  802009:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  80200c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802011:	83 c4 10             	add    $0x10,%esp
+  802014:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802018:	75 0b                	jne    802025 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  80201a:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  80201d:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802020:	e9 f3 fe ff ff       	jmp    801f18 <devpipe_write+0x1d>
+		*sleeping = 0;
+  802025:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  80202c:	83 ec 08             	sub    $0x8,%esp
+  80202f:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802034:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802037:	50                   	push   %eax
+  802038:	e8 b1 f2 ff ff       	call   8012ee <sys_futex_wake>
+  80203d:	83 c4 10             	add    $0x10,%esp
+  802040:	eb d8                	jmp    80201a <devpipe_write+0x11f>
+				return 0;
+  802042:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802047:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80204a:	5b                   	pop    %ebx
+  80204b:	5e                   	pop    %esi
+  80204c:	5f                   	pop    %edi
+  80204d:	5d                   	pop    %ebp
+  80204e:	c3                   	ret
+
+0080204f <pipe>:
+{
+  80204f:	55                   	push   %ebp
+  802050:	89 e5                	mov    %esp,%ebp
+  802052:	56                   	push   %esi
+  802053:	53                   	push   %ebx
+  802054:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802057:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80205a:	50                   	push   %eax
+  80205b:	e8 27 f3 ff ff       	call   801387 <fd_alloc>
+  802060:	89 c3                	mov    %eax,%ebx
+  802062:	83 c4 10             	add    $0x10,%esp
+  802065:	85 c0                	test   %eax,%eax
+  802067:	0f 88 23 01 00 00    	js     802190 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80206d:	83 ec 04             	sub    $0x4,%esp
+  802070:	68 07 04 00 00       	push   $0x407
+  802075:	ff 75 f4             	push   -0xc(%ebp)
+  802078:	6a 00                	push   $0x0
+  80207a:	e8 46 ed ff ff       	call   800dc5 <sys_page_alloc>
+  80207f:	89 c3                	mov    %eax,%ebx
+  802081:	83 c4 10             	add    $0x10,%esp
+  802084:	85 c0                	test   %eax,%eax
+  802086:	0f 88 04 01 00 00    	js     802190 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80208c:	83 ec 0c             	sub    $0xc,%esp
+  80208f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802092:	50                   	push   %eax
+  802093:	e8 ef f2 ff ff       	call   801387 <fd_alloc>
+  802098:	89 c3                	mov    %eax,%ebx
+  80209a:	83 c4 10             	add    $0x10,%esp
+  80209d:	85 c0                	test   %eax,%eax
+  80209f:	0f 88 db 00 00 00    	js     802180 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020a5:	83 ec 04             	sub    $0x4,%esp
+  8020a8:	68 07 04 00 00       	push   $0x407
+  8020ad:	ff 75 f0             	push   -0x10(%ebp)
+  8020b0:	6a 00                	push   $0x0
+  8020b2:	e8 0e ed ff ff       	call   800dc5 <sys_page_alloc>
+  8020b7:	89 c3                	mov    %eax,%ebx
+  8020b9:	83 c4 10             	add    $0x10,%esp
+  8020bc:	85 c0                	test   %eax,%eax
+  8020be:	0f 88 bc 00 00 00    	js     802180 <pipe+0x131>
+	va = fd2data(fd0);
+  8020c4:	83 ec 0c             	sub    $0xc,%esp
+  8020c7:	ff 75 f4             	push   -0xc(%ebp)
+  8020ca:	e8 a1 f2 ff ff       	call   801370 <fd2data>
+  8020cf:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020d1:	83 c4 0c             	add    $0xc,%esp
+  8020d4:	68 07 04 00 00       	push   $0x407
+  8020d9:	50                   	push   %eax
+  8020da:	6a 00                	push   $0x0
+  8020dc:	e8 e4 ec ff ff       	call   800dc5 <sys_page_alloc>
+  8020e1:	89 c3                	mov    %eax,%ebx
+  8020e3:	83 c4 10             	add    $0x10,%esp
+  8020e6:	85 c0                	test   %eax,%eax
+  8020e8:	0f 88 82 00 00 00    	js     802170 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020ee:	83 ec 0c             	sub    $0xc,%esp
+  8020f1:	ff 75 f0             	push   -0x10(%ebp)
+  8020f4:	e8 77 f2 ff ff       	call   801370 <fd2data>
+  8020f9:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802100:	50                   	push   %eax
+  802101:	6a 00                	push   $0x0
+  802103:	56                   	push   %esi
+  802104:	6a 00                	push   $0x0
+  802106:	e8 fd ec ff ff       	call   800e08 <sys_page_map>
+  80210b:	89 c3                	mov    %eax,%ebx
+  80210d:	83 c4 20             	add    $0x20,%esp
+  802110:	85 c0                	test   %eax,%eax
+  802112:	78 4e                	js     802162 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802114:	a1 20 60 80 00       	mov    0x806020,%eax
+  802119:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80211c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80211e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802121:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802128:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80212b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80212d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802130:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802137:	83 ec 0c             	sub    $0xc,%esp
+  80213a:	ff 75 f4             	push   -0xc(%ebp)
+  80213d:	e8 1e f2 ff ff       	call   801360 <fd2num>
+  802142:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802145:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802147:	83 c4 04             	add    $0x4,%esp
+  80214a:	ff 75 f0             	push   -0x10(%ebp)
+  80214d:	e8 0e f2 ff ff       	call   801360 <fd2num>
+  802152:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802155:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802158:	83 c4 10             	add    $0x10,%esp
+  80215b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802160:	eb 2e                	jmp    802190 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802162:	83 ec 08             	sub    $0x8,%esp
+  802165:	56                   	push   %esi
+  802166:	6a 00                	push   $0x0
+  802168:	e8 dd ec ff ff       	call   800e4a <sys_page_unmap>
+  80216d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802170:	83 ec 08             	sub    $0x8,%esp
+  802173:	ff 75 f0             	push   -0x10(%ebp)
+  802176:	6a 00                	push   $0x0
+  802178:	e8 cd ec ff ff       	call   800e4a <sys_page_unmap>
+  80217d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802180:	83 ec 08             	sub    $0x8,%esp
+  802183:	ff 75 f4             	push   -0xc(%ebp)
+  802186:	6a 00                	push   $0x0
+  802188:	e8 bd ec ff ff       	call   800e4a <sys_page_unmap>
+  80218d:	83 c4 10             	add    $0x10,%esp
+}
+  802190:	89 d8                	mov    %ebx,%eax
+  802192:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802195:	5b                   	pop    %ebx
+  802196:	5e                   	pop    %esi
+  802197:	5d                   	pop    %ebp
+  802198:	c3                   	ret
+
+00802199 <pipeisclosed>:
+{
+  802199:	55                   	push   %ebp
+  80219a:	89 e5                	mov    %esp,%ebp
+  80219c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80219f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021a2:	50                   	push   %eax
+  8021a3:	ff 75 08             	push   0x8(%ebp)
+  8021a6:	e8 30 f2 ff ff       	call   8013db <fd_lookup>
+  8021ab:	83 c4 10             	add    $0x10,%esp
+  8021ae:	85 c0                	test   %eax,%eax
+  8021b0:	78 18                	js     8021ca <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8021b2:	83 ec 0c             	sub    $0xc,%esp
+  8021b5:	ff 75 f4             	push   -0xc(%ebp)
+  8021b8:	e8 b3 f1 ff ff       	call   801370 <fd2data>
+  8021bd:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8021bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021c2:	e8 a8 fb ff ff       	call   801d6f <_pipeisclosed>
+  8021c7:	83 c4 10             	add    $0x10,%esp
+}
+  8021ca:	c9                   	leave
+  8021cb:	c3                   	ret
+
+008021cc <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  8021cc:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8021ce:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  8021d4:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  8021da:	81 c2 34 01 00 00    	add    $0x134,%edx
+  8021e0:	39 d0                	cmp    %edx,%eax
+  8021e2:	74 2e                	je     802212 <segment_lookup+0x46>
+{
+  8021e4:	55                   	push   %ebp
+  8021e5:	89 e5                	mov    %esp,%ebp
+  8021e7:	57                   	push   %edi
+  8021e8:	56                   	push   %esi
+  8021e9:	53                   	push   %ebx
+  8021ea:	eb 07                	jmp    8021f3 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8021ec:	83 c0 20             	add    $0x20,%eax
+  8021ef:	39 d0                	cmp    %edx,%eax
+  8021f1:	74 15                	je     802208 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  8021f3:	8b 18                	mov    (%eax),%ebx
+  8021f5:	39 d9                	cmp    %ebx,%ecx
+  8021f7:	72 f3                	jb     8021ec <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  8021f9:	8b 38                	mov    (%eax),%edi
+  8021fb:	8b 58 04             	mov    0x4(%eax),%ebx
+  8021fe:	89 ce                	mov    %ecx,%esi
+  802200:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  802202:	39 de                	cmp    %ebx,%esi
+  802204:	73 e6                	jae    8021ec <segment_lookup+0x20>
+  802206:	eb 05                	jmp    80220d <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  802208:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80220d:	5b                   	pop    %ebx
+  80220e:	5e                   	pop    %esi
+  80220f:	5f                   	pop    %edi
+  802210:	5d                   	pop    %ebp
+  802211:	c3                   	ret
+	return NULL;
+  802212:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802217:	c3                   	ret
+
+00802218 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802218:	55                   	push   %ebp
+  802219:	89 e5                	mov    %esp,%ebp
+  80221b:	53                   	push   %ebx
+  80221c:	83 ec 04             	sub    $0x4,%esp
+  80221f:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802221:	c1 e8 16             	shr    $0x16,%eax
+  802224:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80222b:	25 81 00 00 00       	and    $0x81,%eax
+  802230:	83 f8 01             	cmp    $0x1,%eax
+  802233:	75 6b                	jne    8022a0 <page_is_clean+0x88>
+  802235:	89 da                	mov    %ebx,%edx
+  802237:	c1 ea 0c             	shr    $0xc,%edx
+  80223a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  802241:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802246:	f6 c1 01             	test   $0x1,%cl
+  802249:	74 5a                	je     8022a5 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  80224b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802252:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802258:	75 4b                	jne    8022a5 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  80225a:	89 d8                	mov    %ebx,%eax
+  80225c:	e8 6b ff ff ff       	call   8021cc <segment_lookup>
+  802261:	89 c2                	mov    %eax,%edx
+		return 1;
+  802263:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  802268:	85 d2                	test   %edx,%edx
+  80226a:	75 39                	jne    8022a5 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  80226c:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  802272:	b8 00 00 00 00       	mov    $0x0,%eax
+  802277:	eb 03                	jmp    80227c <page_is_clean+0x64>
+  802279:	83 c0 01             	add    $0x1,%eax
+  80227c:	39 c2                	cmp    %eax,%edx
+  80227e:	7e 19                	jle    802299 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  802280:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  802287:	72 f0                	jb     802279 <page_is_clean+0x61>
+  802289:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  802290:	73 e7                	jae    802279 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  802292:	b8 01 00 00 00       	mov    $0x1,%eax
+  802297:	eb 0c                	jmp    8022a5 <page_is_clean+0x8d>
+	return 0;
+  802299:	b8 00 00 00 00       	mov    $0x0,%eax
+  80229e:	eb 05                	jmp    8022a5 <page_is_clean+0x8d>
+		return 0;
+  8022a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022a8:	c9                   	leave
+  8022a9:	c3                   	ret
+
+008022aa <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  8022aa:	55                   	push   %ebp
+  8022ab:	89 e5                	mov    %esp,%ebp
+  8022ad:	57                   	push   %edi
+  8022ae:	56                   	push   %esi
+  8022af:	53                   	push   %ebx
+  8022b0:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8022b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b8:	eb 19                	jmp    8022d3 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8022ba:	f7 d3                	not    %ebx
+  8022bc:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8022c2:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8022c4:	83 c6 01             	add    $0x1,%esi
+  8022c7:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8022cd:	0f 87 97 00 00 00    	ja     80236a <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8022d3:	89 f3                	mov    %esi,%ebx
+  8022d5:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  8022db:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8022e1:	89 d8                	mov    %ebx,%eax
+  8022e3:	c1 e8 0a             	shr    $0xa,%eax
+  8022e6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8022ed:	25 81 00 00 00       	and    $0x81,%eax
+  8022f2:	83 f8 01             	cmp    $0x1,%eax
+  8022f5:	75 c3                	jne    8022ba <linear_walk+0x10>
+  8022f7:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8022fd:	77 bb                	ja     8022ba <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8022ff:	89 df                	mov    %ebx,%edi
+  802301:	c1 e7 0c             	shl    $0xc,%edi
+  802304:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802307:	89 f8                	mov    %edi,%eax
+  802309:	e8 0a ff ff ff       	call   802218 <page_is_clean>
+  80230e:	84 c0                	test   %al,%al
+  802310:	75 64                	jne    802376 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802312:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802318:	77 aa                	ja     8022c4 <linear_walk+0x1a>
+  80231a:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  802320:	72 a2                	jb     8022c4 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802322:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802329:	a8 01                	test   $0x1,%al
+  80232b:	74 97                	je     8022c4 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80232d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802334:	f6 c4 04             	test   $0x4,%ah
+  802337:	75 8b                	jne    8022c4 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802339:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802340:	f6 c4 02             	test   $0x2,%ah
+  802343:	0f 85 7b ff ff ff    	jne    8022c4 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802349:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802350:	c1 e8 0c             	shr    $0xc,%eax
+  802353:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802356:	05 00 00 00 ef       	add    $0xef000000,%eax
+  80235b:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80235f:	66 83 f8 01          	cmp    $0x1,%ax
+  802363:	76 11                	jbe    802376 <linear_walk+0xcc>
+  802365:	e9 5a ff ff ff       	jmp    8022c4 <linear_walk+0x1a>
+  80236a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  80236f:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802376:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  80237c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80237f:	83 c4 1c             	add    $0x1c,%esp
+  802382:	5b                   	pop    %ebx
+  802383:	5e                   	pop    %esi
+  802384:	5f                   	pop    %edi
+  802385:	5d                   	pop    %ebp
+  802386:	c3                   	ret
+
+00802387 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802387:	55                   	push   %ebp
+  802388:	89 e5                	mov    %esp,%ebp
+  80238a:	56                   	push   %esi
+  80238b:	53                   	push   %ebx
+  80238c:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  80238e:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802393:	83 e0 7f             	and    $0x7f,%eax
+  802396:	c1 e0 04             	shl    $0x4,%eax
+  802399:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  80239f:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  8023a5:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  8023ab:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  8023b1:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023b6:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  8023b9:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023be:	83 c0 01             	add    $0x1,%eax
+  8023c1:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  8023c6:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  8023c9:	5b                   	pop    %ebx
+  8023ca:	5e                   	pop    %esi
+  8023cb:	5d                   	pop    %ebp
+  8023cc:	c3                   	ret
+
+008023cd <page_ring_enter>:
+{
+  8023cd:	55                   	push   %ebp
+  8023ce:	89 e5                	mov    %esp,%ebp
+  8023d0:	57                   	push   %edi
+  8023d1:	56                   	push   %esi
+  8023d2:	53                   	push   %ebx
+  8023d3:	83 ec 18             	sub    $0x18,%esp
+  8023d6:	89 c6                	mov    %eax,%esi
+  8023d8:	89 d7                	mov    %edx,%edi
+  8023da:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  8023dc:	6a 00                	push   $0x0
+  8023de:	6a 00                	push   $0x0
+  8023e0:	6a 00                	push   $0x0
+  8023e2:	6a 07                	push   $0x7
+  8023e4:	ff 35 40 b0 80 00    	push   0x80b040
+  8023ea:	e8 8e 26 00 00       	call   804a7d <ipc_call>
+  8023ef:	83 c4 20             	add    $0x20,%esp
+  8023f2:	85 c0                	test   %eax,%eax
+  8023f4:	79 22                	jns    802418 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  8023f6:	50                   	push   %eax
+  8023f7:	68 a1 53 80 00       	push   $0x8053a1
+  8023fc:	68 13 02 00 00       	push   $0x213
+  802401:	68 b5 53 80 00       	push   $0x8053b5
+  802406:	e8 05 de ff ff       	call   800210 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  80240b:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802410:	83 c0 01             	add    $0x1,%eax
+  802413:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802418:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  80241e:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802423:	39 c2                	cmp    %eax,%edx
+  802425:	74 24                	je     80244b <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802427:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  80242c:	83 e0 7f             	and    $0x7f,%eax
+  80242f:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802436:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  80243d:	29 f0                	sub    %esi,%eax
+  80243f:	39 d8                	cmp    %ebx,%eax
+  802441:	73 c8                	jae    80240b <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802443:	8b 52 04             	mov    0x4(%edx),%edx
+  802446:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802449:	eb c0                	jmp    80240b <page_ring_enter+0x3e>
+}
+  80244b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80244e:	5b                   	pop    %ebx
+  80244f:	5e                   	pop    %esi
+  802450:	5f                   	pop    %edi
+  802451:	5d                   	pop    %ebp
+  802452:	c3                   	ret
+
+00802453 <page_ring_reserve>:
+{
+  802453:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802455:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80245a:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802460:	29 d0                	sub    %edx,%eax
+  802462:	ba 80 00 00 00       	mov    $0x80,%edx
+  802467:	29 ca                	sub    %ecx,%edx
+  802469:	39 c2                	cmp    %eax,%edx
+  80246b:	72 01                	jb     80246e <page_ring_reserve+0x1b>
+  80246d:	c3                   	ret
+{
+  80246e:	55                   	push   %ebp
+  80246f:	89 e5                	mov    %esp,%ebp
+  802471:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802474:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802479:	ba 00 00 00 00       	mov    $0x0,%edx
+  80247e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802483:	e8 45 ff ff ff       	call   8023cd <page_ring_enter>
+}
+  802488:	c9                   	leave
+  802489:	c3                   	ret
+
+0080248a <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  80248a:	55                   	push   %ebp
+  80248b:	89 e5                	mov    %esp,%ebp
+  80248d:	53                   	push   %ebx
+  80248e:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802491:	6a 07                	push   $0x7
+  802493:	6a 01                	push   $0x1
+  802495:	89 c3                	mov    %eax,%ebx
+  802497:	c1 e3 0c             	shl    $0xc,%ebx
+  80249a:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  8024a0:	52                   	push   %edx
+  8024a1:	6a 04                	push   $0x4
+  8024a3:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  8024aa:	e8 ce 25 00 00       	call   804a7d <ipc_call>
+	sharereqs[i].nslots = 0;
+  8024af:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  8024b6:	00 00 00 
+	return r;
+}
+  8024b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024bc:	c9                   	leave
+  8024bd:	c3                   	ret
+
+008024be <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  8024be:	55                   	push   %ebp
+  8024bf:	89 e5                	mov    %esp,%ebp
+  8024c1:	56                   	push   %esi
+  8024c2:	53                   	push   %ebx
+  8024c3:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  8024c5:	c1 e8 10             	shr    $0x10,%eax
+  8024c8:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  8024cb:	89 c2                	mov    %eax,%edx
+  8024cd:	c1 e2 0c             	shl    $0xc,%edx
+  8024d0:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  8024d6:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8024d9:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  8024df:	89 c2                	mov    %eax,%edx
+  8024e1:	c1 e2 0a             	shl    $0xa,%edx
+  8024e4:	01 f2                	add    %esi,%edx
+  8024e6:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  8024ed:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  8024f3:	74 09                	je     8024fe <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  8024f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024fa:	5b                   	pop    %ebx
+  8024fb:	5e                   	pop    %esi
+  8024fc:	5d                   	pop    %ebp
+  8024fd:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  8024fe:	e8 87 ff ff ff       	call   80248a <page_share_send>
+  802503:	eb f5                	jmp    8024fa <page_share_slot+0x3c>
+
+00802505 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802505:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80250a:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  80250d:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802512:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  802518:	74 09                	je     802523 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  80251a:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80251f:	85 c0                	test   %eax,%eax
+  802521:	75 01                	jne    802524 <page_ring_ready+0x1f>
+}
+  802523:	c3                   	ret
+{
+  802524:	55                   	push   %ebp
+  802525:	89 e5                	mov    %esp,%ebp
+  802527:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  80252a:	68 07 06 00 00       	push   $0x607
+  80252f:	6a 08                	push   $0x8
+  802531:	68 00 30 ad de       	push   $0xdead3000
+  802536:	6a 00                	push   $0x0
+  802538:	e8 b3 e9 ff ff       	call   800ef0 <sys_page_alloc_range>
+  80253d:	83 c4 10             	add    $0x10,%esp
+  802540:	83 f8 08             	cmp    $0x8,%eax
+  802543:	74 1b                	je     802560 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802545:	83 ec 04             	sub    $0x4,%esp
+  802548:	6a 08                	push   $0x8
+  80254a:	68 00 30 ad de       	push   $0xdead3000
+  80254f:	6a 00                	push   $0x0
+  802551:	e8 08 ea ff ff       	call   800f5e <sys_page_unmap_range>
+		return 0;
+  802556:	83 c4 10             	add    $0x10,%esp
+  802559:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80255e:	c9                   	leave
+  80255f:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802560:	83 ec 0c             	sub    $0xc,%esp
+  802563:	68 07 04 00 00       	push   $0x407
+  802568:	6a 08                	push   $0x8
+  80256a:	68 00 30 ad de       	push   $0xdead3000
+  80256f:	6a 06                	push   $0x6
+  802571:	ff 35 40 b0 80 00    	push   0x80b040
+  802577:	e8 01 25 00 00       	call   804a7d <ipc_call>
+  80257c:	83 c4 20             	add    $0x20,%esp
+  80257f:	85 c0                	test   %eax,%eax
+  802581:	78 14                	js     802597 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802583:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802588:	8b 40 48             	mov    0x48(%eax),%eax
+  80258b:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  802590:	b8 01 00 00 00       	mov    $0x1,%eax
+  802595:	eb c7                	jmp    80255e <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802597:	83 ec 04             	sub    $0x4,%esp
+  80259a:	6a 08                	push   $0x8
+  80259c:	68 00 30 ad de       	push   $0xdead3000
+  8025a1:	6a 00                	push   $0x0
+  8025a3:	e8 b6 e9 ff ff       	call   800f5e <sys_page_unmap_range>
+		return 0;
+  8025a8:	83 c4 10             	add    $0x10,%esp
+  8025ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b0:	eb ac                	jmp    80255e <page_ring_ready+0x59>
+
+008025b2 <page_remove_slot>:
+{
+  8025b2:	55                   	push   %ebp
+  8025b3:	89 e5                	mov    %esp,%ebp
+  8025b5:	56                   	push   %esi
+  8025b6:	53                   	push   %ebx
+  8025b7:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8025b9:	89 c6                	mov    %eax,%esi
+  8025bb:	c1 ee 10             	shr    $0x10,%esi
+  8025be:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8025c1:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  8025c8:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  8025ce:	74 2a                	je     8025fa <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8025d0:	83 ec 0c             	sub    $0xc,%esp
+  8025d3:	6a 00                	push   $0x0
+  8025d5:	6a 00                	push   $0x0
+  8025d7:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  8025d9:	c1 e3 04             	shl    $0x4,%ebx
+  8025dc:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8025df:	53                   	push   %ebx
+  8025e0:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8025e7:	e8 91 24 00 00       	call   804a7d <ipc_call>
+  8025ec:	83 c4 20             	add    $0x20,%esp
+  8025ef:	85 c0                	test   %eax,%eax
+  8025f1:	78 2d                	js     802620 <page_remove_slot+0x6e>
+}
+  8025f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025f6:	5b                   	pop    %ebx
+  8025f7:	5e                   	pop    %esi
+  8025f8:	5d                   	pop    %ebp
+  8025f9:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8025fa:	e8 06 ff ff ff       	call   802505 <page_ring_ready>
+  8025ff:	85 c0                	test   %eax,%eax
+  802601:	74 cd                	je     8025d0 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802603:	b8 01 00 00 00       	mov    $0x1,%eax
+  802608:	e8 46 fe ff ff       	call   802453 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  80260d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802612:	89 da                	mov    %ebx,%edx
+  802614:	b8 02 00 00 00       	mov    $0x2,%eax
+  802619:	e8 69 fd ff ff       	call   802387 <page_ring_post>
+		return;
+  80261e:	eb d3                	jmp    8025f3 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802620:	50                   	push   %eax
+  802621:	68 10 54 80 00       	push   $0x805410
+  802626:	68 ac 03 00 00       	push   $0x3ac
+  80262b:	68 b5 53 80 00       	push   $0x8053b5
+  802630:	e8 db db ff ff       	call   800210 <_panic>
+
+00802635 <find_paging_env>:
+	if(pagingenv)
+  802635:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  80263a:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  80263c:	85 c0                	test   %eax,%eax
+  80263e:	74 05                	je     802645 <find_paging_env+0x10>
+  802640:	eb 56                	jmp    802698 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802642:	83 c0 01             	add    $0x1,%eax
+  802645:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80264a:	7f 47                	jg     802693 <find_paging_env+0x5e>
+  80264c:	83 f9 01             	cmp    $0x1,%ecx
+  80264f:	7f 42                	jg     802693 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802651:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802654:	c1 e2 06             	shl    $0x6,%edx
+  802657:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80265d:	8b 52 50             	mov    0x50(%edx),%edx
+  802660:	83 fa 02             	cmp    $0x2,%edx
+  802663:	75 dd                	jne    802642 <find_paging_env+0xd>
+  802665:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802668:	c1 e2 06             	shl    $0x6,%edx
+  80266b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802671:	8b 52 54             	mov    0x54(%edx),%edx
+  802674:	85 d2                	test   %edx,%edx
+  802676:	74 ca                	je     802642 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802678:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  80267b:	c1 e2 06             	shl    $0x6,%edx
+  80267e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802684:	8b 52 48             	mov    0x48(%edx),%edx
+  802687:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  80268e:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802691:	eb af                	jmp    802642 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802693:	83 f9 02             	cmp    $0x2,%ecx
+  802696:	74 01                	je     802699 <find_paging_env+0x64>
+}
+  802698:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802699:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80269e:	8b 40 48             	mov    0x48(%eax),%eax
+  8026a1:	83 e0 01             	and    $0x1,%eax
+  8026a4:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  8026ab:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  8026b0:	eb e6                	jmp    802698 <find_paging_env+0x63>
+
+008026b2 <page_add_backed>:
+{
+  8026b2:	55                   	push   %ebp
+  8026b3:	89 e5                	mov    %esp,%ebp
+  8026b5:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  8026b8:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  8026bd:	83 f8 04             	cmp    $0x4,%eax
+  8026c0:	74 35                	je     8026f7 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  8026c2:	89 d1                	mov    %edx,%ecx
+  8026c4:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  8026ca:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  8026d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026d4:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  8026db:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8026e1:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  8026e8:	83 c0 01             	add    $0x1,%eax
+  8026eb:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  8026f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026f5:	5d                   	pop    %ebp
+  8026f6:	c3                   	ret
+		return -E_NO_MEM;
+  8026f7:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8026fc:	eb f7                	jmp    8026f5 <page_add_backed+0x43>
+
+008026fe <percentage_of_pgdir_to_walk>:
+{
+  8026fe:	55                   	push   %ebp
+  8026ff:	89 e5                	mov    %esp,%ebp
+  802701:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802704:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802708:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  80270b:	db 45 fc             	fildl  -0x4(%ebp)
+  80270e:	d8 35 9c 58 80 00    	fdivs  0x80589c
+	return ret*ret;
+  802714:	d8 c8                	fmul   %st(0),%st
+}
+  802716:	c9                   	leave
+  802717:	c3                   	ret
+
+00802718 <nfu_with_aging_page_choice_func>:
+{
+  802718:	55                   	push   %ebp
+  802719:	89 e5                	mov    %esp,%ebp
+  80271b:	57                   	push   %edi
+  80271c:	56                   	push   %esi
+  80271d:	53                   	push   %ebx
+  80271e:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802721:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  802727:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802729:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80272e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802733:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80273a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80273f:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802742:	eb 18                	jmp    80275c <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802744:	f7 d0                	not    %eax
+  802746:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80274b:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80274d:	83 c2 01             	add    $0x1,%edx
+  802750:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802756:	0f 87 13 01 00 00    	ja     80286f <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  80275c:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802760:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802763:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802768:	89 c1                	mov    %eax,%ecx
+  80276a:	c1 e9 0a             	shr    $0xa,%ecx
+  80276d:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802774:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  80277a:	83 f9 01             	cmp    $0x1,%ecx
+  80277d:	75 c5                	jne    802744 <nfu_with_aging_page_choice_func+0x2c>
+  80277f:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802784:	77 be                	ja     802744 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802786:	89 c1                	mov    %eax,%ecx
+  802788:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80278b:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802791:	0f 82 a5 00 00 00    	jb     80283c <nfu_with_aging_page_choice_func+0x124>
+  802797:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  80279d:	0f 87 99 00 00 00    	ja     80283c <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8027a3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8027aa:	f6 c1 01             	test   $0x1,%cl
+  8027ad:	0f 84 89 00 00 00    	je     80283c <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027b3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8027ba:	f6 c5 04             	test   $0x4,%ch
+  8027bd:	75 7d                	jne    80283c <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8027bf:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027c6:	f6 c5 02             	test   $0x2,%ch
+  8027c9:	75 71                	jne    80283c <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8027cb:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8027d2:	c1 e9 0c             	shr    $0xc,%ecx
+  8027d5:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8027d8:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8027de:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8027e2:	66 83 f9 01          	cmp    $0x1,%cx
+  8027e6:	77 54                	ja     80283c <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  8027e8:	89 f9                	mov    %edi,%ecx
+  8027ea:	80 f9 ff             	cmp    $0xff,%cl
+  8027ed:	74 21                	je     802810 <nfu_with_aging_page_choice_func+0xf8>
+  8027ef:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8027f6:	c1 e9 0c             	shr    $0xc,%ecx
+  8027f9:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8027fc:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802802:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802806:	89 fb                	mov    %edi,%ebx
+  802808:	38 d9                	cmp    %bl,%cl
+  80280a:	73 30                	jae    80283c <nfu_with_aging_page_choice_func+0x124>
+  80280c:	dd d8                	fstp   %st(0)
+  80280e:	eb 02                	jmp    802812 <nfu_with_aging_page_choice_func+0xfa>
+  802810:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802812:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802819:	c1 e9 0c             	shr    $0xc,%ecx
+  80281c:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80281f:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802826:	89 fb                	mov    %edi,%ebx
+  802828:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  80282b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80282e:	db 45 e0             	fildl  -0x20(%ebp)
+  802831:	d8 35 9c 58 80 00    	fdivs  0x80589c
+	return ret*ret;
+  802837:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802839:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  80283c:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80283f:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802842:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802849:	df 6d e0             	fildll -0x20(%ebp)
+  80284c:	d9 c1                	fld    %st(1)
+  80284e:	d8 0d a0 58 80 00    	fmuls  0x8058a0
+  802854:	d9 c9                	fxch   %st(1)
+  802856:	df f1                	fcomip %st(1),%st
+  802858:	dd d8                	fstp   %st(0)
+  80285a:	0f 82 ed fe ff ff    	jb     80274d <nfu_with_aging_page_choice_func+0x35>
+  802860:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802862:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  802867:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80286a:	c1 e0 0c             	shl    $0xc,%eax
+  80286d:	eb 0e                	jmp    80287d <nfu_with_aging_page_choice_func+0x165>
+  80286f:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802871:	89 f8                	mov    %edi,%eax
+  802873:	3c ff                	cmp    $0xff,%al
+  802875:	74 0e                	je     802885 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802877:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80287a:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80287d:	83 c4 14             	add    $0x14,%esp
+  802880:	5b                   	pop    %ebx
+  802881:	5e                   	pop    %esi
+  802882:	5f                   	pop    %edi
+  802883:	5d                   	pop    %ebp
+  802884:	c3                   	ret
+	pgnum = 0;
+  802885:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  80288c:	00 00 00 
+	return (void*)UTOP;
+  80288f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802894:	eb e7                	jmp    80287d <nfu_with_aging_page_choice_func+0x165>
+
+00802896 <myRand>:
+    state = state * 1664525 + 1013904223;
+  802896:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  80289d:	66 19 00 
+  8028a0:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  8028a5:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  8028aa:	c1 e8 18             	shr    $0x18,%eax
+}
+  8028ad:	c3                   	ret
+
+008028ae <random_page_choice_func>:
+{
+  8028ae:	55                   	push   %ebp
+  8028af:	89 e5                	mov    %esp,%ebp
+  8028b1:	57                   	push   %edi
+  8028b2:	56                   	push   %esi
+  8028b3:	53                   	push   %ebx
+  8028b4:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8028b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8028bc:	eb 19                	jmp    8028d7 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8028be:	f7 d3                	not    %ebx
+  8028c0:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8028c6:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8028c8:	83 c6 01             	add    $0x1,%esi
+  8028cb:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8028d1:	0f 87 a0 00 00 00    	ja     802977 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8028d7:	89 f3                	mov    %esi,%ebx
+  8028d9:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  8028df:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8028e5:	89 d8                	mov    %ebx,%eax
+  8028e7:	c1 e8 0a             	shr    $0xa,%eax
+  8028ea:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8028f1:	25 81 00 00 00       	and    $0x81,%eax
+  8028f6:	83 f8 01             	cmp    $0x1,%eax
+  8028f9:	75 c3                	jne    8028be <random_page_choice_func+0x10>
+  8028fb:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802901:	77 bb                	ja     8028be <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802903:	89 df                	mov    %ebx,%edi
+  802905:	c1 e7 0c             	shl    $0xc,%edi
+  802908:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80290b:	89 f8                	mov    %edi,%eax
+  80290d:	e8 06 f9 ff ff       	call   802218 <page_is_clean>
+  802912:	84 c0                	test   %al,%al
+  802914:	0f 85 82 00 00 00    	jne    80299c <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80291a:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  802920:	72 a6                	jb     8028c8 <random_page_choice_func+0x1a>
+  802922:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802928:	77 9e                	ja     8028c8 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80292a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802931:	a8 01                	test   $0x1,%al
+  802933:	74 93                	je     8028c8 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802935:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80293c:	f6 c4 04             	test   $0x4,%ah
+  80293f:	75 87                	jne    8028c8 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802941:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802948:	f6 c4 02             	test   $0x2,%ah
+  80294b:	0f 85 77 ff ff ff    	jne    8028c8 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802951:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802958:	c1 e8 0c             	shr    $0xc,%eax
+  80295b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80295e:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802963:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802967:	66 83 f8 01          	cmp    $0x1,%ax
+  80296b:	0f 87 57 ff ff ff    	ja     8028c8 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  802971:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802977:	e8 1a ff ff ff       	call   802896 <myRand>
+  80297c:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  802982:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  802987:	29 fe                	sub    %edi,%esi
+  802989:	0f be c0             	movsbl %al,%eax
+  80298c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802991:	f7 f6                	div    %esi
+  802993:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802995:	bb 15 00 00 00       	mov    $0x15,%ebx
+  80299a:	eb 1c                	jmp    8029b8 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  80299c:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  8029a2:	e9 8f 00 00 00       	jmp    802a36 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8029a7:	e8 ea fe ff ff       	call   802896 <myRand>
+  8029ac:	0f be c0             	movsbl %al,%eax
+  8029af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b4:	f7 f6                	div    %esi
+  8029b6:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8029b8:	83 eb 01             	sub    $0x1,%ebx
+  8029bb:	0f 84 c2 00 00 00    	je     802a83 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  8029c1:	89 d0                	mov    %edx,%eax
+  8029c3:	c1 e8 0a             	shr    $0xa,%eax
+  8029c6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8029cd:	25 81 00 00 00       	and    $0x81,%eax
+  8029d2:	83 f8 01             	cmp    $0x1,%eax
+  8029d5:	75 d0                	jne    8029a7 <random_page_choice_func+0xf9>
+  8029d7:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  8029dd:	77 c8                	ja     8029a7 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  8029df:	89 d0                	mov    %edx,%eax
+  8029e1:	c1 e0 0c             	shl    $0xc,%eax
+  8029e4:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  8029e9:	72 56                	jb     802a41 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8029eb:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  8029f0:	77 65                	ja     802a57 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8029f2:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8029f9:	f6 c1 01             	test   $0x1,%cl
+  8029fc:	74 59                	je     802a57 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8029fe:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802a05:	f6 c5 04             	test   $0x4,%ch
+  802a08:	75 4d                	jne    802a57 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  802a0a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802a11:	f6 c5 02             	test   $0x2,%ch
+  802a14:	75 41                	jne    802a57 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  802a16:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802a1d:	c1 ea 0c             	shr    $0xc,%edx
+  802a20:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  802a23:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  802a29:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  802a2d:	66 83 fa 01          	cmp    $0x1,%dx
+  802a31:	77 3a                	ja     802a6d <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  802a33:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  802a36:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a39:	83 c4 1c             	add    $0x1c,%esp
+  802a3c:	5b                   	pop    %ebx
+  802a3d:	5e                   	pop    %esi
+  802a3e:	5f                   	pop    %edi
+  802a3f:	5d                   	pop    %ebp
+  802a40:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802a41:	e8 50 fe ff ff       	call   802896 <myRand>
+  802a46:	0f be c0             	movsbl %al,%eax
+  802a49:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a4e:	f7 f6                	div    %esi
+  802a50:	01 fa                	add    %edi,%edx
+			continue;
+  802a52:	e9 61 ff ff ff       	jmp    8029b8 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802a57:	e8 3a fe ff ff       	call   802896 <myRand>
+  802a5c:	0f be c0             	movsbl %al,%eax
+  802a5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a64:	f7 f6                	div    %esi
+  802a66:	01 fa                	add    %edi,%edx
+			continue;
+  802a68:	e9 4b ff ff ff       	jmp    8029b8 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802a6d:	e8 24 fe ff ff       	call   802896 <myRand>
+  802a72:	0f be c0             	movsbl %al,%eax
+  802a75:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a7a:	f7 f6                	div    %esi
+  802a7c:	01 fa                	add    %edi,%edx
+			continue;
+  802a7e:	e9 35 ff ff ff       	jmp    8029b8 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  802a83:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  802a8a:	00 00 00 
+	return (void*)UTOP;
+  802a8d:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  802a94:	eb a0                	jmp    802a36 <random_page_choice_func+0x188>
+
+00802a96 <nfu>:
+{
+  802a96:	55                   	push   %ebp
+  802a97:	89 e5                	mov    %esp,%ebp
+  802a99:	57                   	push   %edi
+  802a9a:	56                   	push   %esi
+  802a9b:	53                   	push   %ebx
+  802a9c:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802a9f:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  802aa5:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802aa7:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802aac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ab1:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802ab8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802abd:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802ac0:	eb 18                	jmp    802ada <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802ac2:	f7 d0                	not    %eax
+  802ac4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802ac9:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802acb:	83 c2 01             	add    $0x1,%edx
+  802ace:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802ad4:	0f 87 13 01 00 00    	ja     802bed <nfu+0x157>
+		++num_searched_ptes;
+  802ada:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802ade:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802ae1:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802ae6:	89 c1                	mov    %eax,%ecx
+  802ae8:	c1 e9 0a             	shr    $0xa,%ecx
+  802aeb:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802af2:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802af8:	83 f9 01             	cmp    $0x1,%ecx
+  802afb:	75 c5                	jne    802ac2 <nfu+0x2c>
+  802afd:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802b02:	77 be                	ja     802ac2 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802b04:	89 c1                	mov    %eax,%ecx
+  802b06:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b09:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802b0f:	0f 82 a5 00 00 00    	jb     802bba <nfu+0x124>
+  802b15:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802b1b:	0f 87 99 00 00 00    	ja     802bba <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b21:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b28:	f6 c1 01             	test   $0x1,%cl
+  802b2b:	0f 84 89 00 00 00    	je     802bba <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802b31:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b38:	f6 c5 04             	test   $0x4,%ch
+  802b3b:	75 7d                	jne    802bba <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802b3d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802b44:	f6 c5 02             	test   $0x2,%ch
+  802b47:	75 71                	jne    802bba <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802b49:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b50:	c1 e9 0c             	shr    $0xc,%ecx
+  802b53:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b56:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802b5c:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802b60:	66 83 f9 01          	cmp    $0x1,%cx
+  802b64:	77 54                	ja     802bba <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  802b66:	89 f9                	mov    %edi,%ecx
+  802b68:	80 f9 ff             	cmp    $0xff,%cl
+  802b6b:	74 21                	je     802b8e <nfu+0xf8>
+  802b6d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b74:	c1 e9 0c             	shr    $0xc,%ecx
+  802b77:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b7a:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802b80:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  802b84:	89 fb                	mov    %edi,%ebx
+  802b86:	38 d9                	cmp    %bl,%cl
+  802b88:	73 30                	jae    802bba <nfu+0x124>
+  802b8a:	dd d8                	fstp   %st(0)
+  802b8c:	eb 02                	jmp    802b90 <nfu+0xfa>
+  802b8e:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  802b90:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b97:	c1 e9 0c             	shr    $0xc,%ecx
+  802b9a:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b9d:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802ba4:	89 fb                	mov    %edi,%ebx
+  802ba6:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802ba9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802bac:	db 45 e0             	fildl  -0x20(%ebp)
+  802baf:	d8 35 9c 58 80 00    	fdivs  0x80589c
+	return ret*ret;
+  802bb5:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802bb7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802bba:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802bbd:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802bc0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802bc7:	df 6d e0             	fildll -0x20(%ebp)
+  802bca:	d9 c1                	fld    %st(1)
+  802bcc:	d8 0d a0 58 80 00    	fmuls  0x8058a0
+  802bd2:	d9 c9                	fxch   %st(1)
+  802bd4:	df f1                	fcomip %st(1),%st
+  802bd6:	dd d8                	fstp   %st(0)
+  802bd8:	0f 82 ed fe ff ff    	jb     802acb <nfu+0x35>
+  802bde:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802be0:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  802be5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802be8:	c1 e0 0c             	shl    $0xc,%eax
+  802beb:	eb 0e                	jmp    802bfb <nfu+0x165>
+  802bed:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802bef:	89 f8                	mov    %edi,%eax
+  802bf1:	3c ff                	cmp    $0xff,%al
+  802bf3:	74 0e                	je     802c03 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802bf5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802bf8:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802bfb:	83 c4 14             	add    $0x14,%esp
+  802bfe:	5b                   	pop    %ebx
+  802bff:	5e                   	pop    %esi
+  802c00:	5f                   	pop    %edi
+  802c01:	5d                   	pop    %ebp
+  802c02:	c3                   	ret
+	pgnum = 0;
+  802c03:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  802c0a:	00 00 00 
+	return (void*)UTOP;
+  802c0d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802c12:	eb e7                	jmp    802bfb <nfu+0x165>
+
+00802c14 <lru>:
+{
+  802c14:	55                   	push   %ebp
+  802c15:	89 e5                	mov    %esp,%ebp
+  802c17:	57                   	push   %edi
+  802c18:	56                   	push   %esi
+  802c19:	53                   	push   %ebx
+  802c1a:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c1d:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  802c23:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  802c2a:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802c31:	be 00 00 00 00       	mov    $0x0,%esi
+  802c36:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c42:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  802c45:	eb 18                	jmp    802c5f <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802c47:	f7 d0                	not    %eax
+  802c49:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802c4e:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c50:	83 c2 01             	add    $0x1,%edx
+  802c53:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802c59:	0f 87 fa 00 00 00    	ja     802d59 <lru+0x145>
+		++num_searched_ptes;
+  802c5f:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c62:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802c65:	01 d0                	add    %edx,%eax
+  802c67:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802c6c:	89 c1                	mov    %eax,%ecx
+  802c6e:	c1 e9 0a             	shr    $0xa,%ecx
+  802c71:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802c78:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802c7e:	83 f9 01             	cmp    $0x1,%ecx
+  802c81:	75 c4                	jne    802c47 <lru+0x33>
+  802c83:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802c88:	77 bd                	ja     802c47 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802c8a:	89 c1                	mov    %eax,%ecx
+  802c8c:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802c8f:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802c95:	0f 87 92 00 00 00    	ja     802d2d <lru+0x119>
+  802c9b:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802ca1:	0f 82 86 00 00 00    	jb     802d2d <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802ca7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802cae:	f6 c1 01             	test   $0x1,%cl
+  802cb1:	74 7a                	je     802d2d <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802cb3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802cba:	f6 c5 04             	test   $0x4,%ch
+  802cbd:	75 6e                	jne    802d2d <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802cbf:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802cc6:	f6 c5 02             	test   $0x2,%ch
+  802cc9:	75 62                	jne    802d2d <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802ccb:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802cd2:	c1 e9 0c             	shr    $0xc,%ecx
+  802cd5:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802cd8:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802cde:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802ce2:	66 83 f9 01          	cmp    $0x1,%cx
+  802ce6:	77 45                	ja     802d2d <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  802ce8:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802cef:	c1 e9 0c             	shr    $0xc,%ecx
+  802cf2:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802cf5:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802cfb:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802cfe:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802d01:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  802d04:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802d07:	19 df                	sbb    %ebx,%edi
+  802d09:	7c 22                	jl     802d2d <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  802d0b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d12:	c1 e9 0c             	shr    $0xc,%ecx
+  802d15:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d18:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d1e:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802d21:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802d24:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802d27:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d2a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802d2d:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  802d30:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802d37:	df 6d e0             	fildll -0x20(%ebp)
+  802d3a:	d9 05 a0 58 80 00    	flds   0x8058a0
+  802d40:	d9 c9                	fxch   %st(1)
+  802d42:	df f1                	fcomip %st(1),%st
+  802d44:	dd d8                	fstp   %st(0)
+  802d46:	0f 82 04 ff ff ff    	jb     802c50 <lru+0x3c>
+			pgnum = pgnum_actual;
+  802d4c:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  802d51:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d54:	c1 e0 0c             	shl    $0xc,%eax
+  802d57:	eb 06                	jmp    802d5f <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  802d59:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d5c:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802d5f:	83 c4 1c             	add    $0x1c,%esp
+  802d62:	5b                   	pop    %ebx
+  802d63:	5e                   	pop    %esi
+  802d64:	5f                   	pop    %edi
+  802d65:	5d                   	pop    %ebp
+  802d66:	c3                   	ret
+
+00802d67 <set_page_choice_func>:
+{
+  802d67:	55                   	push   %ebp
+  802d68:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  802d6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d6d:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  802d72:	5d                   	pop    %ebp
+  802d73:	c3                   	ret
+
+00802d74 <get_page_choice>:
+{
+  802d74:	55                   	push   %ebp
+  802d75:	89 e5                	mov    %esp,%ebp
+  802d77:	57                   	push   %edi
+  802d78:	56                   	push   %esi
+  802d79:	53                   	push   %ebx
+  802d7a:	83 ec 24             	sub    $0x24,%esp
+  802d7d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d80:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  802d83:	57                   	push   %edi
+  802d84:	56                   	push   %esi
+  802d85:	ff 15 3c 60 80 00    	call   *0x80603c
+  802d8b:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802d8d:	83 c4 10             	add    $0x10,%esp
+  802d90:	eb 25                	jmp    802db7 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  802d92:	83 ec 08             	sub    $0x8,%esp
+  802d95:	c1 e0 16             	shl    $0x16,%eax
+  802d98:	50                   	push   %eax
+  802d99:	6a 00                	push   $0x0
+  802d9b:	e8 ec e0 ff ff       	call   800e8c <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802da0:	83 c4 10             	add    $0x10,%esp
+  802da3:	85 c0                	test   %eax,%eax
+  802da5:	75 43                	jne    802dea <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  802da7:	83 ec 08             	sub    $0x8,%esp
+  802daa:	57                   	push   %edi
+  802dab:	56                   	push   %esi
+  802dac:	ff 15 3c 60 80 00    	call   *0x80603c
+  802db2:	89 c3                	mov    %eax,%ebx
+  802db4:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802db7:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802dba:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  802dc0:	0f 86 ae 00 00 00    	jbe    802e74 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  802dcb:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802dd2:	81 e2 81 00 00 00    	and    $0x81,%edx
+  802dd8:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  802dde:	74 b2                	je     802d92 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802de0:	83 c0 01             	add    $0x1,%eax
+  802de3:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  802de8:	75 e1                	jne    802dcb <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802dea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ded:	05 00 10 40 11       	add    $0x11401000,%eax
+  802df2:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802df7:	76 1f                	jbe    802e18 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  802df9:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  802dfe:	89 d8                	mov    %ebx,%eax
+  802e00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e03:	5b                   	pop    %ebx
+  802e04:	5e                   	pop    %esi
+  802e05:	5f                   	pop    %edi
+  802e06:	5d                   	pop    %ebp
+  802e07:	c3                   	ret
+		sys_page_split(0, pg_out);
+  802e08:	83 ec 08             	sub    $0x8,%esp
+  802e0b:	53                   	push   %ebx
+  802e0c:	6a 00                	push   $0x0
+  802e0e:	e8 79 e0 ff ff       	call   800e8c <sys_page_split>
+  802e13:	83 c4 10             	add    $0x10,%esp
+  802e16:	eb 6c                	jmp    802e84 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  802e18:	83 ec 04             	sub    $0x4,%esp
+  802e1b:	68 48 54 80 00       	push   $0x805448
+  802e20:	68 cc 01 00 00       	push   $0x1cc
+  802e25:	68 b5 53 80 00       	push   $0x8053b5
+  802e2a:	e8 e1 d3 ff ff       	call   800210 <_panic>
+		panic("We tried to page out code pages\n");
+  802e2f:	83 ec 04             	sub    $0x4,%esp
+  802e32:	68 78 54 80 00       	push   $0x805478
+  802e37:	68 d6 01 00 00       	push   $0x1d6
+  802e3c:	68 b5 53 80 00       	push   $0x8053b5
+  802e41:	e8 ca d3 ff ff       	call   800210 <_panic>
+		panic("Invalid mapping for the va\n");
+  802e46:	83 ec 04             	sub    $0x4,%esp
+  802e49:	68 c2 53 80 00       	push   $0x8053c2
+  802e4e:	68 da 01 00 00       	push   $0x1da
+  802e53:	68 b5 53 80 00       	push   $0x8053b5
+  802e58:	e8 b3 d3 ff ff       	call   800210 <_panic>
+		panic("We tried to page out a shared page\n");
+  802e5d:	83 ec 04             	sub    $0x4,%esp
+  802e60:	68 9c 54 80 00       	push   $0x80549c
+  802e65:	68 e0 01 00 00       	push   $0x1e0
+  802e6a:	68 b5 53 80 00       	push   $0x8053b5
+  802e6f:	e8 9c d3 ff ff       	call   800210 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  802e74:	89 de                	mov    %ebx,%esi
+  802e76:	c1 ee 16             	shr    $0x16,%esi
+  802e79:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802e80:	a8 80                	test   $0x80,%al
+  802e82:	75 84                	jne    802e08 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802e84:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e87:	05 00 10 40 11       	add    $0x11401000,%eax
+  802e8c:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802e91:	76 85                	jbe    802e18 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  802e93:	89 d8                	mov    %ebx,%eax
+  802e95:	e8 7e f3 ff ff       	call   802218 <page_is_clean>
+  802e9a:	84 c0                	test   %al,%al
+  802e9c:	0f 85 5c ff ff ff    	jne    802dfe <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  802ea2:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  802ea9:	76 84                	jbe    802e2f <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  802eab:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802eb2:	a8 01                	test   $0x1,%al
+  802eb4:	74 90                	je     802e46 <get_page_choice+0xd2>
+  802eb6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802eb9:	c1 e8 0c             	shr    $0xc,%eax
+  802ebc:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802ec3:	f6 c2 01             	test   $0x1,%dl
+  802ec6:	0f 84 7a ff ff ff    	je     802e46 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802ecc:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  802ed3:	f6 c2 01             	test   $0x1,%dl
+  802ed6:	74 85                	je     802e5d <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802ed8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802edf:	f6 c2 01             	test   $0x1,%dl
+  802ee2:	0f 84 75 ff ff ff    	je     802e5d <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802ee8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802eef:	f6 c6 04             	test   $0x4,%dh
+  802ef2:	0f 85 65 ff ff ff    	jne    802e5d <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  802ef8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802eff:	f6 c6 02             	test   $0x2,%dh
+  802f02:	0f 85 55 ff ff ff    	jne    802e5d <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  802f08:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f0f:	c1 e8 0c             	shr    $0xc,%eax
+  802f12:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802f15:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802f1a:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802f1e:	66 83 f8 01          	cmp    $0x1,%ax
+  802f22:	0f 86 d6 fe ff ff    	jbe    802dfe <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  802f28:	83 ec 04             	sub    $0x4,%esp
+  802f2b:	68 c0 54 80 00       	push   $0x8054c0
+  802f30:	68 e2 01 00 00       	push   $0x1e2
+  802f35:	68 b5 53 80 00       	push   $0x8053b5
+  802f3a:	e8 d1 d2 ff ff       	call   800210 <_panic>
+
+00802f3f <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  802f3f:	55                   	push   %ebp
+  802f40:	89 e5                	mov    %esp,%ebp
+  802f42:	57                   	push   %edi
+  802f43:	56                   	push   %esi
+  802f44:	53                   	push   %ebx
+  802f45:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  802f48:	e8 e8 f6 ff ff       	call   802635 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  802f4d:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802f52:	85 c0                	test   %eax,%eax
+  802f54:	74 41                	je     802f97 <page_share_paged_out+0x58>
+  802f56:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  802f5d:	0f 84 fd 00 00 00    	je     803060 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  802f63:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802f6a:	00 00 00 
+  802f6d:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  802f74:	00 00 00 
+  802f77:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f7c:	eb 2c                	jmp    802faa <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802f7e:	83 c3 04             	add    $0x4,%ebx
+  802f81:	39 f3                	cmp    %esi,%ebx
+  802f83:	74 1a                	je     802f9f <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  802f85:	8b 03                	mov    (%ebx),%eax
+  802f87:	a8 01                	test   $0x1,%al
+  802f89:	74 f3                	je     802f7e <page_share_paged_out+0x3f>
+  802f8b:	c1 e8 0c             	shr    $0xc,%eax
+  802f8e:	e8 2b f5 ff ff       	call   8024be <page_share_slot>
+  802f93:	85 c0                	test   %eax,%eax
+  802f95:	79 e7                	jns    802f7e <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  802f97:	83 c4 0c             	add    $0xc,%esp
+  802f9a:	5b                   	pop    %ebx
+  802f9b:	5e                   	pop    %esi
+  802f9c:	5f                   	pop    %edi
+  802f9d:	5d                   	pop    %ebp
+  802f9e:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  802f9f:	83 c7 04             	add    $0x4,%edi
+  802fa2:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  802fa8:	74 1b                	je     802fc5 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  802faa:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  802faf:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  802fb2:	f6 c3 01             	test   $0x1,%bl
+  802fb5:	74 e8                	je     802f9f <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  802fb7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802fbd:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  802fc3:	eb bc                	jmp    802f81 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802fc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fca:	eb 11                	jmp    802fdd <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  802fcc:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802fd2:	83 c3 01             	add    $0x1,%ebx
+  802fd5:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802fdb:	77 41                	ja     80301e <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  802fdd:	89 d8                	mov    %ebx,%eax
+  802fdf:	c1 e8 0a             	shr    $0xa,%eax
+  802fe2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802fe9:	25 81 00 00 00       	and    $0x81,%eax
+  802fee:	83 f8 01             	cmp    $0x1,%eax
+  802ff1:	75 d9                	jne    802fcc <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  802ff3:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802ffa:	25 81 00 00 00       	and    $0x81,%eax
+  802fff:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803004:	75 cc                	jne    802fd2 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803006:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80300d:	c1 e8 0c             	shr    $0xc,%eax
+  803010:	e8 a9 f4 ff ff       	call   8024be <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803015:	85 c0                	test   %eax,%eax
+  803017:	79 b9                	jns    802fd2 <page_share_paged_out+0x93>
+  803019:	e9 79 ff ff ff       	jmp    802f97 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80301e:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803025:	75 13                	jne    80303a <page_share_paged_out+0xfb>
+  803027:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80302e:	75 1d                	jne    80304d <page_share_paged_out+0x10e>
+	return 0;
+  803030:	b8 00 00 00 00       	mov    $0x0,%eax
+  803035:	e9 5d ff ff ff       	jmp    802f97 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80303a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303f:	e8 46 f4 ff ff       	call   80248a <page_share_send>
+  803044:	85 c0                	test   %eax,%eax
+  803046:	79 df                	jns    803027 <page_share_paged_out+0xe8>
+  803048:	e9 4a ff ff ff       	jmp    802f97 <page_share_paged_out+0x58>
+  80304d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803052:	e8 33 f4 ff ff       	call   80248a <page_share_send>
+  803057:	85 c0                	test   %eax,%eax
+  803059:	79 d5                	jns    803030 <page_share_paged_out+0xf1>
+  80305b:	e9 37 ff ff ff       	jmp    802f97 <page_share_paged_out+0x58>
+		return 0;
+  803060:	b8 00 00 00 00       	mov    $0x0,%eax
+  803065:	e9 2d ff ff ff       	jmp    802f97 <page_share_paged_out+0x58>
+
+0080306a <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  80306a:	55                   	push   %ebp
+  80306b:	89 e5                	mov    %esp,%ebp
+  80306d:	56                   	push   %esi
+  80306e:	53                   	push   %ebx
+  80306f:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  803072:	e8 be f5 ff ff       	call   802635 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  803077:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  80307c:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803083:	0f 84 82 00 00 00    	je     80310b <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  803089:	83 ec 0c             	sub    $0xc,%esp
+  80308c:	68 00 10 00 00       	push   $0x1000
+  803091:	e8 84 11 00 00       	call   80421a <malloc>
+  803096:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  803098:	83 c4 0c             	add    $0xc,%esp
+  80309b:	6a 14                	push   $0x14
+  80309d:	6a 00                	push   $0x0
+  80309f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8030a2:	50                   	push   %eax
+  8030a3:	e8 7b d9 ff ff       	call   800a23 <memset>
+  8030a8:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  8030ab:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  8030b0:	83 ec 0c             	sub    $0xc,%esp
+  8030b3:	6a 07                	push   $0x7
+  8030b5:	6a 01                	push   $0x1
+  8030b7:	53                   	push   %ebx
+  8030b8:	6a 03                	push   $0x3
+  8030ba:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8030c1:	e8 b7 19 00 00       	call   804a7d <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  8030c6:	8b 03                	mov    (%ebx),%eax
+  8030c8:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  8030cb:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030ce:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  8030d1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8030d4:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  8030d7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8030da:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  8030dd:	8b 43 10             	mov    0x10(%ebx),%eax
+  8030e0:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  8030e3:	83 c6 01             	add    $0x1,%esi
+  8030e6:	83 c4 20             	add    $0x20,%esp
+  8030e9:	83 fe 02             	cmp    $0x2,%esi
+  8030ec:	75 c2                	jne    8030b0 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  8030ee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030f1:	89 03                	mov    %eax,(%ebx)
+  8030f3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8030f6:	89 43 04             	mov    %eax,0x4(%ebx)
+  8030f9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8030fc:	89 43 08             	mov    %eax,0x8(%ebx)
+  8030ff:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803102:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803105:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803108:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  80310b:	89 d8                	mov    %ebx,%eax
+  80310d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803110:	5b                   	pop    %ebx
+  803111:	5e                   	pop    %esi
+  803112:	5d                   	pop    %ebp
+  803113:	c3                   	ret
+
+00803114 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803114:	55                   	push   %ebp
+  803115:	89 e5                	mov    %esp,%ebp
+  803117:	53                   	push   %ebx
+  803118:	83 ec 10             	sub    $0x10,%esp
+  80311b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  80311e:	68 dc 53 80 00       	push   $0x8053dc
+  803123:	e8 c3 d1 ff ff       	call   8002eb <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  803128:	83 c4 08             	add    $0x8,%esp
+  80312b:	ff 33                	push   (%ebx)
+  80312d:	68 f4 54 80 00       	push   $0x8054f4
+  803132:	e8 b4 d1 ff ff       	call   8002eb <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  803137:	83 c4 08             	add    $0x8,%esp
+  80313a:	ff 73 04             	push   0x4(%ebx)
+  80313d:	68 de 53 80 00       	push   $0x8053de
+  803142:	e8 a4 d1 ff ff       	call   8002eb <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  803147:	83 c4 08             	add    $0x8,%esp
+  80314a:	ff 73 08             	push   0x8(%ebx)
+  80314d:	68 14 55 80 00       	push   $0x805514
+  803152:	e8 94 d1 ff ff       	call   8002eb <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  803157:	83 c4 08             	add    $0x8,%esp
+  80315a:	ff 73 0c             	push   0xc(%ebx)
+  80315d:	68 38 55 80 00       	push   $0x805538
+  803162:	e8 84 d1 ff ff       	call   8002eb <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  803167:	83 c4 08             	add    $0x8,%esp
+  80316a:	ff 73 10             	push   0x10(%ebx)
+  80316d:	68 5c 55 80 00       	push   $0x80555c
+  803172:	e8 74 d1 ff ff       	call   8002eb <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  803177:	83 c4 08             	add    $0x8,%esp
+  80317a:	ff 35 08 b0 80 00    	push   0x80b008
+  803180:	68 98 55 80 00       	push   $0x805598
+  803185:	e8 61 d1 ff ff       	call   8002eb <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  80318a:	83 c4 08             	add    $0x8,%esp
+  80318d:	ff 35 04 b0 80 00    	push   0x80b004
+  803193:	68 cc 55 80 00       	push   $0x8055cc
+  803198:	e8 4e d1 ff ff       	call   8002eb <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  80319d:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8031a2:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  8031a5:	8b 50 68             	mov    0x68(%eax),%edx
+  8031a8:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  8031ab:	51                   	push   %ecx
+  8031ac:	52                   	push   %edx
+  8031ad:	50                   	push   %eax
+  8031ae:	68 0c 56 80 00       	push   $0x80560c
+  8031b3:	e8 33 d1 ff ff       	call   8002eb <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  8031b8:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8031bd:	8b 40 70             	mov    0x70(%eax),%eax
+  8031c0:	83 c4 18             	add    $0x18,%esp
+  8031c3:	50                   	push   %eax
+  8031c4:	68 40 56 80 00       	push   $0x805640
+  8031c9:	e8 1d d1 ff ff       	call   8002eb <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  8031ce:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  8031d4:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  8031da:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  8031df:	51                   	push   %ecx
+  8031e0:	52                   	push   %edx
+  8031e1:	50                   	push   %eax
+  8031e2:	68 70 56 80 00       	push   $0x805670
+  8031e7:	e8 ff d0 ff ff       	call   8002eb <cprintf>
+	cprintf("\n");
+  8031ec:	83 c4 14             	add    $0x14,%esp
+  8031ef:	68 dc 53 80 00       	push   $0x8053dc
+  8031f4:	e8 f2 d0 ff ff       	call   8002eb <cprintf>
+}
+  8031f9:	83 c4 10             	add    $0x10,%esp
+  8031fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031ff:	c9                   	leave
+  803200:	c3                   	ret
+
+00803201 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  803201:	55                   	push   %ebp
+  803202:	89 e5                	mov    %esp,%ebp
+  803204:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  803207:	e8 5e fe ff ff       	call   80306a <get_paging_stats>
+  80320c:	83 ec 0c             	sub    $0xc,%esp
+  80320f:	50                   	push   %eax
+  803210:	e8 ff fe ff ff       	call   803114 <print_paging_stats>
+}
+  803215:	83 c4 10             	add    $0x10,%esp
+  803218:	c9                   	leave
+  803219:	c3                   	ret
+
+0080321a <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  80321a:	55                   	push   %ebp
+  80321b:	89 e5                	mov    %esp,%ebp
+  80321d:	53                   	push   %ebx
+  80321e:	83 ec 04             	sub    $0x4,%esp
+  803221:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803224:	eb 13                	jmp    803239 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803226:	83 ec 04             	sub    $0x4,%esp
+  803229:	6a ff                	push   $0xffffffff
+  80322b:	53                   	push   %ebx
+  80322c:	68 00 f0 ff ee       	push   $0xeefff000
+  803231:	e8 68 e0 ff ff       	call   80129e <sys_futex_wait>
+  803236:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803239:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  80323e:	39 d8                	cmp    %ebx,%eax
+  803240:	74 e4                	je     803226 <mem_pressure_wait+0xc>
+	return now;
+}
+  803242:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803245:	c9                   	leave
+  803246:	c3                   	ret
+
+00803247 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803247:	55                   	push   %ebp
+  803248:	89 e5                	mov    %esp,%ebp
+  80324a:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  80324d:	68 b9 3e 80 00       	push   $0x803eb9
+  803252:	e8 32 16 00 00       	call   804889 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803257:	c7 05 14 e9 80 00 00 	movl   $0xdeadb000,0x80e914
+  80325e:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  803261:	83 c4 0c             	add    $0xc,%esp
+  803264:	68 07 02 00 00       	push   $0x207
+  803269:	68 00 b0 ad de       	push   $0xdeadb000
+  80326e:	6a 00                	push   $0x0
+  803270:	e8 50 db ff ff       	call   800dc5 <sys_page_alloc>
+  803275:	83 c4 10             	add    $0x10,%esp
+  803278:	85 c0                	test   %eax,%eax
+  80327a:	78 0c                	js     803288 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  80327c:	e8 b4 f3 ff ff       	call   802635 <find_paging_env>
+	page_ring_ready();
+  803281:	e8 7f f2 ff ff       	call   802505 <page_ring_ready>
+}
+  803286:	c9                   	leave
+  803287:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  803288:	50                   	push   %eax
+  803289:	68 fc 53 80 00       	push   $0x8053fc
+  80328e:	68 13 05 00 00       	push   $0x513
+  803293:	68 b5 53 80 00       	push   $0x8053b5
+  803298:	e8 73 cf ff ff       	call   800210 <_panic>
+
+0080329d <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  80329d:	55                   	push   %ebp
+  80329e:	89 e5                	mov    %esp,%ebp
+  8032a0:	57                   	push   %edi
+  8032a1:	56                   	push   %esi
+  8032a2:	53                   	push   %ebx
+  8032a3:	83 ec 0c             	sub    $0xc,%esp
+  8032a6:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  8032a9:	89 fa                	mov    %edi,%edx
+  8032ab:	c1 ea 16             	shr    $0x16,%edx
+  8032ae:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8032b3:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  8032b6:	f6 06 01             	testb  $0x1,(%esi)
+  8032b9:	75 3e                	jne    8032f9 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  8032bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  8032c0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8032c4:	74 47                	je     80330d <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  8032c6:	83 ec 0c             	sub    $0xc,%esp
+  8032c9:	6a 01                	push   $0x1
+  8032cb:	e8 f2 11 00 00       	call   8044c2 <va_alloc>
+  8032d0:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  8032d2:	83 c4 10             	add    $0x10,%esp
+  8032d5:	85 c0                	test   %eax,%eax
+  8032d7:	74 34                	je     80330d <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  8032d9:	6a 00                	push   $0x0
+  8032db:	68 07 02 00 00       	push   $0x207
+  8032e0:	50                   	push   %eax
+  8032e1:	6a 00                	push   $0x0
+  8032e3:	e8 df 02 00 00       	call   8035c7 <page_alloc>
+  8032e8:	83 c4 10             	add    $0x10,%esp
+  8032eb:	85 c0                	test   %eax,%eax
+  8032ed:	78 28                	js     803317 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  8032ef:	f6 06 01             	testb  $0x1,(%esi)
+  8032f2:	75 38                	jne    80332c <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  8032f4:	83 cb 01             	or     $0x1,%ebx
+  8032f7:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  8032f9:	89 f8                	mov    %edi,%eax
+  8032fb:	c1 e8 0a             	shr    $0xa,%eax
+  8032fe:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803303:	8b 1e                	mov    (%esi),%ebx
+  803305:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  80330b:	01 c3                	add    %eax,%ebx
+}
+  80330d:	89 d8                	mov    %ebx,%eax
+  80330f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803312:	5b                   	pop    %ebx
+  803313:	5e                   	pop    %esi
+  803314:	5f                   	pop    %edi
+  803315:	5d                   	pop    %ebp
+  803316:	c3                   	ret
+			va_free(page, 1);
+  803317:	83 ec 08             	sub    $0x8,%esp
+  80331a:	6a 01                	push   $0x1
+  80331c:	53                   	push   %ebx
+  80331d:	e8 d8 12 00 00       	call   8045fa <va_free>
+			return NULL;
+  803322:	83 c4 10             	add    $0x10,%esp
+  803325:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80332a:	eb e1                	jmp    80330d <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  80332c:	83 ec 08             	sub    $0x8,%esp
+  80332f:	53                   	push   %ebx
+  803330:	6a 00                	push   $0x0
+  803332:	e8 13 db ff ff       	call   800e4a <sys_page_unmap>
+			va_free(page, 1);
+  803337:	83 c4 08             	add    $0x8,%esp
+  80333a:	6a 01                	push   $0x1
+  80333c:	53                   	push   %ebx
+  80333d:	e8 b8 12 00 00       	call   8045fa <va_free>
+  803342:	83 c4 10             	add    $0x10,%esp
+  803345:	eb b2                	jmp    8032f9 <umapdir_walk+0x5c>
+
+00803347 <page_out>:
+{
+  803347:	55                   	push   %ebp
+  803348:	89 e5                	mov    %esp,%ebp
+  80334a:	57                   	push   %edi
+  80334b:	56                   	push   %esi
+  80334c:	53                   	push   %ebx
+  80334d:	83 ec 5c             	sub    $0x5c,%esp
+  803350:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803353:	e8 dd f2 ff ff       	call   802635 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803358:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80335d:	85 c0                	test   %eax,%eax
+  80335f:	74 1e                	je     80337f <page_out+0x38>
+  803361:	83 ec 0c             	sub    $0xc,%esp
+  803364:	6a 00                	push   $0x0
+  803366:	6a 00                	push   $0x0
+  803368:	6a 00                	push   $0x0
+  80336a:	6a 08                	push   $0x8
+  80336c:	50                   	push   %eax
+  80336d:	e8 0b 17 00 00       	call   804a7d <ipc_call>
+  803372:	89 c3                	mov    %eax,%ebx
+  803374:	83 c4 20             	add    $0x20,%esp
+  803377:	85 c0                	test   %eax,%eax
+  803379:	0f 84 ac 00 00 00    	je     80342b <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  80337f:	83 ec 08             	sub    $0x8,%esp
+  803382:	ff 75 0c             	push   0xc(%ebp)
+  803385:	57                   	push   %edi
+  803386:	e8 e9 f9 ff ff       	call   802d74 <get_page_choice>
+  80338b:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  80338d:	83 c4 10             	add    $0x10,%esp
+  803390:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803395:	0f 84 18 02 00 00    	je     8035b3 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  80339b:	e8 78 ee ff ff       	call   802218 <page_is_clean>
+  8033a0:	84 c0                	test   %al,%al
+  8033a2:	0f 85 8c 00 00 00    	jne    803434 <page_out+0xed>
+	if (pagingenv == 0)
+  8033a8:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8033af:	0f 84 08 02 00 00    	je     8035bd <page_out+0x276>
+	if (page_ring_ready())
+  8033b5:	e8 4b f1 ff ff       	call   802505 <page_ring_ready>
+  8033ba:	89 c3                	mov    %eax,%ebx
+  8033bc:	85 c0                	test   %eax,%eax
+  8033be:	0f 85 89 00 00 00    	jne    80344d <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  8033c4:	83 ec 0c             	sub    $0xc,%esp
+  8033c7:	6a 05                	push   $0x5
+  8033c9:	6a 01                	push   $0x1
+  8033cb:	56                   	push   %esi
+  8033cc:	6a 01                	push   $0x1
+  8033ce:	ff 35 40 b0 80 00    	push   0x80b040
+  8033d4:	e8 a4 16 00 00       	call   804a7d <ipc_call>
+  8033d9:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  8033db:	83 c4 20             	add    $0x20,%esp
+  8033de:	85 c0                	test   %eax,%eax
+  8033e0:	0f 88 b8 01 00 00    	js     80359e <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  8033e6:	89 f0                	mov    %esi,%eax
+  8033e8:	c1 e8 0c             	shr    $0xc,%eax
+  8033eb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8033f2:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  8033f5:	83 ec 08             	sub    $0x8,%esp
+  8033f8:	56                   	push   %esi
+  8033f9:	6a 00                	push   $0x0
+  8033fb:	e8 4a da ff ff       	call   800e4a <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803400:	83 c4 08             	add    $0x8,%esp
+  803403:	6a 01                	push   $0x1
+  803405:	56                   	push   %esi
+  803406:	e8 92 fe ff ff       	call   80329d <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  80340b:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  80340e:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803414:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803417:	09 fe                	or     %edi,%esi
+  803419:	83 ce 01             	or     $0x1,%esi
+  80341c:	89 30                	mov    %esi,(%eax)
+	return 0;
+  80341e:	83 c4 10             	add    $0x10,%esp
+}
+  803421:	89 d8                	mov    %ebx,%eax
+  803423:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803426:	5b                   	pop    %ebx
+  803427:	5e                   	pop    %esi
+  803428:	5f                   	pop    %edi
+  803429:	5d                   	pop    %ebp
+  80342a:	c3                   	ret
+		num_page_reclaims++;
+  80342b:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  803432:	eb ed                	jmp    803421 <page_out+0xda>
+		num_page_drops++;
+  803434:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  80343b:	83 ec 08             	sub    $0x8,%esp
+  80343e:	56                   	push   %esi
+  80343f:	6a 00                	push   $0x0
+  803441:	e8 04 da ff ff       	call   800e4a <sys_page_unmap>
+  803446:	89 c3                	mov    %eax,%ebx
+  803448:	83 c4 10             	add    $0x10,%esp
+  80344b:	eb d4                	jmp    803421 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80344d:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  80344f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803454:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803459:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  80345c:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  80345e:	83 c0 08             	add    $0x8,%eax
+  803461:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803464:	b8 07 00 00 00       	mov    $0x7,%eax
+  803469:	e8 e5 ef ff ff       	call   802453 <page_ring_reserve>
+	first = ring->sq_tail;
+  80346e:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803473:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803476:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  80347b:	83 ec 04             	sub    $0x4,%esp
+  80347e:	68 00 10 00 00       	push   $0x1000
+  803483:	56                   	push   %esi
+  803484:	89 d8                	mov    %ebx,%eax
+  803486:	c1 e0 0c             	shl    $0xc,%eax
+  803489:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  80348e:	50                   	push   %eax
+  80348f:	e8 26 d6 ff ff       	call   800aba <memcpy>
+		vas[n] = va;
+  803494:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803498:	89 d9                	mov    %ebx,%ecx
+  80349a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80349f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034a4:	e8 de ee ff ff       	call   802387 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  8034a9:	8d 43 01             	lea    0x1(%ebx),%eax
+  8034ac:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  8034af:	83 c4 10             	add    $0x10,%esp
+  8034b2:	83 fb 06             	cmp    $0x6,%ebx
+  8034b5:	74 62                	je     803519 <page_out+0x1d2>
+  8034b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8034ba:	eb 15                	jmp    8034d1 <page_out+0x18a>
+			num_page_drops++;
+  8034bc:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  8034c3:	83 ec 08             	sub    $0x8,%esp
+  8034c6:	56                   	push   %esi
+  8034c7:	6a 00                	push   $0x0
+  8034c9:	e8 7c d9 ff ff       	call   800e4a <sys_page_unmap>
+  8034ce:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  8034d1:	83 ec 08             	sub    $0x8,%esp
+  8034d4:	53                   	push   %ebx
+  8034d5:	57                   	push   %edi
+  8034d6:	e8 99 f8 ff ff       	call   802d74 <get_page_choice>
+  8034db:	89 c6                	mov    %eax,%esi
+  8034dd:	83 c4 10             	add    $0x10,%esp
+  8034e0:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8034e5:	74 32                	je     803519 <page_out+0x1d2>
+  8034e7:	e8 2c ed ff ff       	call   802218 <page_is_clean>
+  8034ec:	84 c0                	test   %al,%al
+  8034ee:	75 cc                	jne    8034bc <page_out+0x175>
+		if (va == (void *) UTOP ||
+  8034f0:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  8034f3:	39 c6                	cmp    %eax,%esi
+  8034f5:	72 07                	jb     8034fe <page_out+0x1b7>
+  8034f7:	8b 45 98             	mov    -0x68(%ebp),%eax
+  8034fa:	39 c6                	cmp    %eax,%esi
+  8034fc:	72 1b                	jb     803519 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  8034fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803503:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803506:	eb 03                	jmp    80350b <page_out+0x1c4>
+  803508:	83 c3 01             	add    $0x1,%ebx
+  80350b:	39 da                	cmp    %ebx,%edx
+  80350d:	0f 84 68 ff ff ff    	je     80347b <page_out+0x134>
+  803513:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803517:	75 ef                	jne    803508 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803519:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  80351c:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  80351f:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803522:	e8 a6 ee ff ff       	call   8023cd <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803527:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80352c:	eb 42                	jmp    803570 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  80352e:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803532:	89 f8                	mov    %edi,%eax
+  803534:	c1 e8 0c             	shr    $0xc,%eax
+  803537:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80353e:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803541:	83 ec 08             	sub    $0x8,%esp
+  803544:	57                   	push   %edi
+  803545:	6a 00                	push   $0x0
+  803547:	e8 fe d8 ff ff       	call   800e4a <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  80354c:	83 c4 08             	add    $0x8,%esp
+  80354f:	6a 01                	push   $0x1
+  803551:	57                   	push   %edi
+  803552:	e8 46 fd ff ff       	call   80329d <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803557:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  80355a:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803560:	c1 e6 0c             	shl    $0xc,%esi
+  803563:	09 d6                	or     %edx,%esi
+  803565:	83 ce 01             	or     $0x1,%esi
+  803568:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  80356a:	83 c3 01             	add    $0x1,%ebx
+  80356d:	83 c4 10             	add    $0x10,%esp
+  803570:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803573:	39 c3                	cmp    %eax,%ebx
+  803575:	74 1d                	je     803594 <page_out+0x24d>
+		if (res[i] < 0)
+  803577:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  80357b:	85 f6                	test   %esi,%esi
+  80357d:	79 af                	jns    80352e <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  80357f:	56                   	push   %esi
+  803580:	68 a0 56 80 00       	push   $0x8056a0
+  803585:	68 d1 02 00 00       	push   $0x2d1
+  80358a:	68 b5 53 80 00       	push   $0x8053b5
+  80358f:	e8 7c cc ff ff       	call   800210 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803594:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803599:	e9 83 fe ff ff       	jmp    803421 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  80359e:	50                   	push   %eax
+  80359f:	68 a0 56 80 00       	push   $0x8056a0
+  8035a4:	68 0a 03 00 00       	push   $0x30a
+  8035a9:	68 b5 53 80 00       	push   $0x8053b5
+  8035ae:	e8 5d cc ff ff       	call   800210 <_panic>
+		return -E_NO_MEM;
+  8035b3:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  8035b8:	e9 64 fe ff ff       	jmp    803421 <page_out+0xda>
+		return -E_PAGING;
+  8035bd:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8035c2:	e9 5a fe ff ff       	jmp    803421 <page_out+0xda>
+
+008035c7 <page_alloc>:
+{
+  8035c7:	55                   	push   %ebp
+  8035c8:	89 e5                	mov    %esp,%ebp
+  8035ca:	57                   	push   %edi
+  8035cb:	56                   	push   %esi
+  8035cc:	53                   	push   %ebx
+  8035cd:	83 ec 0c             	sub    $0xc,%esp
+  8035d0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035d3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  8035d6:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  8035dd:	74 34                	je     803613 <page_alloc+0x4c>
+	if (check_mte)
+  8035df:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8035e3:	75 35                	jne    80361a <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  8035e5:	83 ec 04             	sub    $0x4,%esp
+  8035e8:	ff 75 10             	push   0x10(%ebp)
+  8035eb:	56                   	push   %esi
+  8035ec:	57                   	push   %edi
+  8035ed:	e8 d3 d7 ff ff       	call   800dc5 <sys_page_alloc>
+  8035f2:	89 c3                	mov    %eax,%ebx
+  8035f4:	83 c4 10             	add    $0x10,%esp
+  8035f7:	85 c0                	test   %eax,%eax
+  8035f9:	79 52                	jns    80364d <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  8035fb:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8035fe:	75 52                	jne    803652 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803600:	83 ec 08             	sub    $0x8,%esp
+  803603:	56                   	push   %esi
+  803604:	57                   	push   %edi
+  803605:	e8 3d fd ff ff       	call   803347 <page_out>
+  80360a:	83 c4 10             	add    $0x10,%esp
+  80360d:	85 c0                	test   %eax,%eax
+  80360f:	79 d4                	jns    8035e5 <page_alloc+0x1e>
+  803611:	eb 3f                	jmp    803652 <page_alloc+0x8b>
+		init_map_dir();
+  803613:	e8 2f fc ff ff       	call   803247 <init_map_dir>
+  803618:	eb c5                	jmp    8035df <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  80361a:	83 ec 08             	sub    $0x8,%esp
+  80361d:	6a 00                	push   $0x0
+  80361f:	56                   	push   %esi
+  803620:	e8 78 fc ff ff       	call   80329d <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803625:	83 c4 10             	add    $0x10,%esp
+  803628:	85 c0                	test   %eax,%eax
+  80362a:	74 b9                	je     8035e5 <page_alloc+0x1e>
+  80362c:	8b 10                	mov    (%eax),%edx
+  80362e:	f6 c2 01             	test   $0x1,%dl
+  803631:	74 b2                	je     8035e5 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803633:	83 ec 08             	sub    $0x8,%esp
+  803636:	56                   	push   %esi
+  803637:	52                   	push   %edx
+  803638:	50                   	push   %eax
+  803639:	68 c4 56 80 00       	push   $0x8056c4
+  80363e:	68 34 03 00 00       	push   $0x334
+  803643:	68 b5 53 80 00       	push   $0x8053b5
+  803648:	e8 c3 cb ff ff       	call   800210 <_panic>
+	return 0;
+  80364d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803652:	89 d8                	mov    %ebx,%eax
+  803654:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803657:	5b                   	pop    %ebx
+  803658:	5e                   	pop    %esi
+  803659:	5f                   	pop    %edi
+  80365a:	5d                   	pop    %ebp
+  80365b:	c3                   	ret
+
+0080365c <page_adopt>:
+{
+  80365c:	55                   	push   %ebp
+  80365d:	89 e5                	mov    %esp,%ebp
+  80365f:	56                   	push   %esi
+  803660:	53                   	push   %ebx
+  803661:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803663:	c1 e8 16             	shr    $0x16,%eax
+  803666:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80366d:	25 81 00 00 00       	and    $0x81,%eax
+  803672:	83 f8 01             	cmp    $0x1,%eax
+  803675:	75 53                	jne    8036ca <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803677:	89 d8                	mov    %ebx,%eax
+  803679:	c1 e8 0c             	shr    $0xc,%eax
+  80367c:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803683:	89 f2                	mov    %esi,%edx
+  803685:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  80368b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803690:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803696:	75 37                	jne    8036cf <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803698:	83 ec 08             	sub    $0x8,%esp
+  80369b:	6a 01                	push   $0x1
+  80369d:	53                   	push   %ebx
+  80369e:	e8 fa fb ff ff       	call   80329d <umapdir_walk>
+  8036a3:	83 c4 10             	add    $0x10,%esp
+  8036a6:	85 c0                	test   %eax,%eax
+  8036a8:	74 2c                	je     8036d6 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  8036aa:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  8036b0:	83 ce 01             	or     $0x1,%esi
+  8036b3:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  8036b5:	83 ec 08             	sub    $0x8,%esp
+  8036b8:	53                   	push   %ebx
+  8036b9:	6a 00                	push   $0x0
+  8036bb:	e8 8a d7 ff ff       	call   800e4a <sys_page_unmap>
+	return 1;
+  8036c0:	83 c4 10             	add    $0x10,%esp
+  8036c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036c8:	eb 05                	jmp    8036cf <page_adopt+0x73>
+		return 0;
+  8036ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036d2:	5b                   	pop    %ebx
+  8036d3:	5e                   	pop    %esi
+  8036d4:	5d                   	pop    %ebp
+  8036d5:	c3                   	ret
+		return -E_NO_MEM;
+  8036d6:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8036db:	eb f2                	jmp    8036cf <page_adopt+0x73>
+
+008036dd <page_forget>:
+{
+  8036dd:	55                   	push   %ebp
+  8036de:	89 e5                	mov    %esp,%ebp
+  8036e0:	53                   	push   %ebx
+  8036e1:	83 ec 04             	sub    $0x4,%esp
+  8036e4:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  8036e6:	e8 4a ef ff ff       	call   802635 <find_paging_env>
+	if (pagingenv == 0)
+  8036eb:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8036f2:	74 39                	je     80372d <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  8036f4:	89 d8                	mov    %ebx,%eax
+  8036f6:	c1 e8 16             	shr    $0x16,%eax
+  8036f9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803700:	25 81 00 00 00       	and    $0x81,%eax
+  803705:	83 f8 01             	cmp    $0x1,%eax
+  803708:	74 28                	je     803732 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  80370a:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803711:	74 1a                	je     80372d <page_forget+0x50>
+  803713:	83 ec 08             	sub    $0x8,%esp
+  803716:	6a 00                	push   $0x0
+  803718:	53                   	push   %ebx
+  803719:	e8 7f fb ff ff       	call   80329d <umapdir_walk>
+  80371e:	89 c3                	mov    %eax,%ebx
+  803720:	83 c4 10             	add    $0x10,%esp
+  803723:	85 c0                	test   %eax,%eax
+  803725:	74 06                	je     80372d <page_forget+0x50>
+  803727:	8b 00                	mov    (%eax),%eax
+  803729:	a8 01                	test   $0x1,%al
+  80372b:	75 2b                	jne    803758 <page_forget+0x7b>
+}
+  80372d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803730:	c9                   	leave
+  803731:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803732:	89 d8                	mov    %ebx,%eax
+  803734:	c1 e8 0c             	shr    $0xc,%eax
+  803737:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80373e:	89 c2                	mov    %eax,%edx
+  803740:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803746:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  80374c:	75 bc                	jne    80370a <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  80374e:	c1 e8 0c             	shr    $0xc,%eax
+  803751:	e8 5c ee ff ff       	call   8025b2 <page_remove_slot>
+		return;
+  803756:	eb d5                	jmp    80372d <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803758:	c1 e8 0c             	shr    $0xc,%eax
+  80375b:	e8 52 ee ff ff       	call   8025b2 <page_remove_slot>
+	*mte = 0;
+  803760:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803766:	eb c5                	jmp    80372d <page_forget+0x50>
+
+00803768 <page_unmap>:
+{
+  803768:	55                   	push   %ebp
+  803769:	89 e5                	mov    %esp,%ebp
+  80376b:	57                   	push   %edi
+  80376c:	56                   	push   %esi
+  80376d:	53                   	push   %ebx
+  80376e:	83 ec 0c             	sub    $0xc,%esp
+  803771:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803774:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803777:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80377c:	8b 40 48             	mov    0x48(%eax),%eax
+  80377f:	85 db                	test   %ebx,%ebx
+  803781:	0f 8e b4 00 00 00    	jle    80383b <page_unmap+0xd3>
+  803787:	39 d8                	cmp    %ebx,%eax
+  803789:	0f 84 ac 00 00 00    	je     80383b <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  80378f:	83 ec 08             	sub    $0x8,%esp
+  803792:	57                   	push   %edi
+  803793:	53                   	push   %ebx
+  803794:	e8 b1 d6 ff ff       	call   800e4a <sys_page_unmap>
+  803799:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  80379b:	e8 95 ee ff ff       	call   802635 <find_paging_env>
+	if (pagingenv == 0)
+  8037a0:	83 c4 10             	add    $0x10,%esp
+  8037a3:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8037aa:	0f 84 a1 00 00 00    	je     803851 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8037b0:	83 ec 0c             	sub    $0xc,%esp
+  8037b3:	6a 05                	push   $0x5
+  8037b5:	68 00 00 40 00       	push   $0x400000
+  8037ba:	6a 00                	push   $0x0
+  8037bc:	68 00 b0 ad de       	push   $0xdeadb000
+  8037c1:	53                   	push   %ebx
+  8037c2:	e8 41 d6 ff ff       	call   800e08 <sys_page_map>
+  8037c7:	83 c4 20             	add    $0x20,%esp
+  8037ca:	85 c0                	test   %eax,%eax
+  8037cc:	0f 88 89 00 00 00    	js     80385b <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  8037d2:	89 f8                	mov    %edi,%eax
+  8037d4:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8037d7:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  8037de:	a8 01                	test   $0x1,%al
+  8037e0:	74 6f                	je     803851 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8037e2:	83 ec 0c             	sub    $0xc,%esp
+  8037e5:	6a 05                	push   $0x5
+  8037e7:	68 00 00 40 00       	push   $0x400000
+  8037ec:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8037ee:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8037f3:	50                   	push   %eax
+  8037f4:	53                   	push   %ebx
+  8037f5:	e8 0e d6 ff ff       	call   800e08 <sys_page_map>
+  8037fa:	83 c4 20             	add    $0x20,%esp
+  8037fd:	85 c0                	test   %eax,%eax
+  8037ff:	78 6f                	js     803870 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803801:	c1 ef 0c             	shr    $0xc,%edi
+  803804:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  80380a:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803811:	01 
+  803812:	74 3d                	je     803851 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803814:	83 ec 08             	sub    $0x8,%esp
+  803817:	68 00 00 40 00       	push   $0x400000
+  80381c:	6a 00                	push   $0x0
+  80381e:	e8 27 d6 ff ff       	call   800e4a <sys_page_unmap>
+  803823:	83 c4 10             	add    $0x10,%esp
+  803826:	85 c0                	test   %eax,%eax
+  803828:	78 5b                	js     803885 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  80382a:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803831:	c1 e8 0c             	shr    $0xc,%eax
+  803834:	e8 79 ed ff ff       	call   8025b2 <page_remove_slot>
+	return r;
+  803839:	eb 16                	jmp    803851 <page_unmap+0xe9>
+		page_forget(va);
+  80383b:	89 f8                	mov    %edi,%eax
+  80383d:	e8 9b fe ff ff       	call   8036dd <page_forget>
+		return sys_page_unmap(envid, va);
+  803842:	83 ec 08             	sub    $0x8,%esp
+  803845:	57                   	push   %edi
+  803846:	53                   	push   %ebx
+  803847:	e8 fe d5 ff ff       	call   800e4a <sys_page_unmap>
+  80384c:	89 c6                	mov    %eax,%esi
+  80384e:	83 c4 10             	add    $0x10,%esp
+}
+  803851:	89 f0                	mov    %esi,%eax
+  803853:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803856:	5b                   	pop    %ebx
+  803857:	5e                   	pop    %esi
+  803858:	5f                   	pop    %edi
+  803859:	5d                   	pop    %ebp
+  80385a:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  80385b:	50                   	push   %eax
+  80385c:	68 00 57 80 00       	push   $0x805700
+  803861:	68 e4 03 00 00       	push   $0x3e4
+  803866:	68 b5 53 80 00       	push   $0x8053b5
+  80386b:	e8 a0 c9 ff ff       	call   800210 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803870:	50                   	push   %eax
+  803871:	68 2c 57 80 00       	push   $0x80572c
+  803876:	68 ea 03 00 00       	push   $0x3ea
+  80387b:	68 b5 53 80 00       	push   $0x8053b5
+  803880:	e8 8b c9 ff ff       	call   800210 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803885:	50                   	push   %eax
+  803886:	68 58 57 80 00       	push   $0x805758
+  80388b:	68 ef 03 00 00       	push   $0x3ef
+  803890:	68 b5 53 80 00       	push   $0x8053b5
+  803895:	e8 76 c9 ff ff       	call   800210 <_panic>
+
+0080389a <page_unmap_range>:
+{
+  80389a:	55                   	push   %ebp
+  80389b:	89 e5                	mov    %esp,%ebp
+  80389d:	57                   	push   %edi
+  80389e:	56                   	push   %esi
+  80389f:	53                   	push   %ebx
+  8038a0:	83 ec 0c             	sub    $0xc,%esp
+  8038a3:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  8038a6:	e8 8a ed ff ff       	call   802635 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  8038ab:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8038b0:	8b 40 48             	mov    0x48(%eax),%eax
+  8038b3:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8038b7:	7e 38                	jle    8038f1 <page_unmap_range+0x57>
+  8038b9:	3b 45 08             	cmp    0x8(%ebp),%eax
+  8038bc:	74 33                	je     8038f1 <page_unmap_range+0x57>
+  8038be:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8038c5:	74 2a                	je     8038f1 <page_unmap_range+0x57>
+  8038c7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  8038ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8038cf:	39 fe                	cmp    %edi,%esi
+  8038d1:	74 56                	je     803929 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  8038d3:	83 ec 08             	sub    $0x8,%esp
+  8038d6:	53                   	push   %ebx
+  8038d7:	ff 75 08             	push   0x8(%ebp)
+  8038da:	e8 89 fe ff ff       	call   803768 <page_unmap>
+  8038df:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8038e5:	83 c4 10             	add    $0x10,%esp
+  8038e8:	85 c0                	test   %eax,%eax
+  8038ea:	78 35                	js     803921 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  8038ec:	83 c6 01             	add    $0x1,%esi
+  8038ef:	eb de                	jmp    8038cf <page_unmap_range+0x35>
+  8038f1:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  8038f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038f9:	eb 10                	jmp    80390b <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  8038fb:	89 f0                	mov    %esi,%eax
+  8038fd:	e8 db fd ff ff       	call   8036dd <page_forget>
+		for (i = 0; i < npages; i++)
+  803902:	83 c3 01             	add    $0x1,%ebx
+  803905:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80390b:	39 fb                	cmp    %edi,%ebx
+  80390d:	75 ec                	jne    8038fb <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  80390f:	83 ec 04             	sub    $0x4,%esp
+  803912:	57                   	push   %edi
+  803913:	ff 75 0c             	push   0xc(%ebp)
+  803916:	ff 75 08             	push   0x8(%ebp)
+  803919:	e8 40 d6 ff ff       	call   800f5e <sys_page_unmap_range>
+  80391e:	83 c4 10             	add    $0x10,%esp
+}
+  803921:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803924:	5b                   	pop    %ebx
+  803925:	5e                   	pop    %esi
+  803926:	5f                   	pop    %edi
+  803927:	5d                   	pop    %ebp
+  803928:	c3                   	ret
+	return 0;
+  803929:	b8 00 00 00 00       	mov    $0x0,%eax
+  80392e:	eb f1                	jmp    803921 <page_unmap_range+0x87>
+
+00803930 <page_alloc_range>:
+{
+  803930:	55                   	push   %ebp
+  803931:	89 e5                	mov    %esp,%ebp
+  803933:	57                   	push   %edi
+  803934:	56                   	push   %esi
+  803935:	53                   	push   %ebx
+  803936:	83 ec 1c             	sub    $0x1c,%esp
+  803939:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80393c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  80393f:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803946:	74 14                	je     80395c <page_alloc_range+0x2c>
+	if (check_mte)
+  803948:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80394c:	74 66                	je     8039b4 <page_alloc_range+0x84>
+  80394e:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  803950:	b8 00 00 00 00       	mov    $0x0,%eax
+  803955:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803958:	89 c7                	mov    %eax,%edi
+  80395a:	eb 10                	jmp    80396c <page_alloc_range+0x3c>
+		init_map_dir();
+  80395c:	e8 e6 f8 ff ff       	call   803247 <init_map_dir>
+  803961:	eb e5                	jmp    803948 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803963:	83 c7 01             	add    $0x1,%edi
+  803966:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80396c:	39 df                	cmp    %ebx,%edi
+  80396e:	74 38                	je     8039a8 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  803970:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803973:	83 ec 08             	sub    $0x8,%esp
+  803976:	6a 00                	push   $0x0
+  803978:	56                   	push   %esi
+  803979:	e8 1f f9 ff ff       	call   80329d <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  80397e:	83 c4 10             	add    $0x10,%esp
+  803981:	85 c0                	test   %eax,%eax
+  803983:	74 de                	je     803963 <page_alloc_range+0x33>
+  803985:	8b 10                	mov    (%eax),%edx
+  803987:	f6 c2 01             	test   $0x1,%dl
+  80398a:	74 d7                	je     803963 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  80398c:	83 ec 08             	sub    $0x8,%esp
+  80398f:	ff 75 e4             	push   -0x1c(%ebp)
+  803992:	52                   	push   %edx
+  803993:	50                   	push   %eax
+  803994:	68 c4 56 80 00       	push   $0x8056c4
+  803999:	68 0b 04 00 00       	push   $0x40b
+  80399e:	68 b5 53 80 00       	push   $0x8053b5
+  8039a3:	e8 68 c8 ff ff       	call   800210 <_panic>
+  8039a8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8039ab:	eb 07                	jmp    8039b4 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  8039ad:	c1 e0 0c             	shl    $0xc,%eax
+  8039b0:	01 c7                	add    %eax,%edi
+			npages -= r;
+  8039b2:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  8039b4:	85 db                	test   %ebx,%ebx
+  8039b6:	74 30                	je     8039e8 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  8039b8:	ff 75 14             	push   0x14(%ebp)
+  8039bb:	53                   	push   %ebx
+  8039bc:	57                   	push   %edi
+  8039bd:	ff 75 08             	push   0x8(%ebp)
+  8039c0:	e8 2b d5 ff ff       	call   800ef0 <sys_page_alloc_range>
+  8039c5:	89 c6                	mov    %eax,%esi
+  8039c7:	83 c4 10             	add    $0x10,%esp
+  8039ca:	85 c0                	test   %eax,%eax
+  8039cc:	7f df                	jg     8039ad <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  8039ce:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8039d1:	75 1a                	jne    8039ed <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  8039d3:	83 ec 08             	sub    $0x8,%esp
+  8039d6:	57                   	push   %edi
+  8039d7:	ff 75 08             	push   0x8(%ebp)
+  8039da:	e8 68 f9 ff ff       	call   803347 <page_out>
+  8039df:	83 c4 10             	add    $0x10,%esp
+  8039e2:	85 c0                	test   %eax,%eax
+  8039e4:	79 ce                	jns    8039b4 <page_alloc_range+0x84>
+  8039e6:	eb 05                	jmp    8039ed <page_alloc_range+0xbd>
+	return 0;
+  8039e8:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8039ed:	89 f0                	mov    %esi,%eax
+  8039ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039f2:	5b                   	pop    %ebx
+  8039f3:	5e                   	pop    %esi
+  8039f4:	5f                   	pop    %edi
+  8039f5:	5d                   	pop    %ebp
+  8039f6:	c3                   	ret
+
+008039f7 <page_in>:
+{
+  8039f7:	55                   	push   %ebp
+  8039f8:	89 e5                	mov    %esp,%ebp
+  8039fa:	57                   	push   %edi
+  8039fb:	56                   	push   %esi
+  8039fc:	53                   	push   %ebx
+  8039fd:	83 ec 3c             	sub    $0x3c,%esp
+  803a00:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  803a03:	e8 2d ec ff ff       	call   802635 <find_paging_env>
+	if (pagingenv == 0)
+  803a08:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803a0f:	0f 84 09 02 00 00    	je     803c1e <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  803a15:	83 ec 08             	sub    $0x8,%esp
+  803a18:	6a 00                	push   $0x0
+  803a1a:	56                   	push   %esi
+  803a1b:	e8 7d f8 ff ff       	call   80329d <umapdir_walk>
+  803a20:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803a22:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803a28:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  803a2b:	83 c4 10             	add    $0x10,%esp
+  803a2e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803a32:	74 0d                	je     803a41 <page_in+0x4a>
+  803a34:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803a39:	8b 40 48             	mov    0x48(%eax),%eax
+  803a3c:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803a3f:	75 06                	jne    803a47 <page_in+0x50>
+  803a41:	8b 03                	mov    (%ebx),%eax
+  803a43:	a8 02                	test   $0x2,%al
+  803a45:	75 63                	jne    803aaa <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  803a47:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803a49:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803a4b:	89 f0                	mov    %esi,%eax
+  803a4d:	25 06 0e 00 00       	and    $0xe06,%eax
+  803a52:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803a55:	50                   	push   %eax
+  803a56:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803a59:	57                   	push   %edi
+  803a5a:	ff 75 08             	push   0x8(%ebp)
+  803a5d:	e8 65 fb ff ff       	call   8035c7 <page_alloc>
+  803a62:	83 c4 10             	add    $0x10,%esp
+  803a65:	85 c0                	test   %eax,%eax
+  803a67:	78 39                	js     803aa2 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  803a69:	89 f0                	mov    %esi,%eax
+  803a6b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803a6e:	83 ec 0c             	sub    $0xc,%esp
+  803a71:	6a 07                	push   $0x7
+  803a73:	6a 01                	push   $0x1
+  803a75:	57                   	push   %edi
+  803a76:	c1 e0 04             	shl    $0x4,%eax
+  803a79:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803a7a:	c1 ee 1c             	shr    $0x1c,%esi
+  803a7d:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803a80:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803a87:	e8 f1 0f 00 00       	call   804a7d <ipc_call>
+  803a8c:	83 c4 20             	add    $0x20,%esp
+  803a8f:	85 c0                	test   %eax,%eax
+  803a91:	0f 88 72 01 00 00    	js     803c09 <page_in+0x212>
+	*mte = 0;
+  803a97:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  803a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803aa2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803aa5:	5b                   	pop    %ebx
+  803aa6:	5e                   	pop    %esi
+  803aa7:	5f                   	pop    %edi
+  803aa8:	5d                   	pop    %ebp
+  803aa9:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803aaa:	25 06 0e 00 00       	and    $0xe06,%eax
+  803aaf:	83 c8 01             	or     $0x1,%eax
+  803ab2:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  803ab5:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803ab8:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  803abb:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  803ac1:	be 01 00 00 00       	mov    $0x1,%esi
+  803ac6:	eb 46                	jmp    803b0e <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  803ac8:	83 ec 08             	sub    $0x8,%esp
+  803acb:	6a 00                	push   $0x0
+  803acd:	51                   	push   %ecx
+  803ace:	e8 ca f7 ff ff       	call   80329d <umapdir_walk>
+  803ad3:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  803ad7:	83 c4 10             	add    $0x10,%esp
+  803ada:	85 c0                	test   %eax,%eax
+  803adc:	74 66                	je     803b44 <page_in+0x14d>
+  803ade:	8b 00                	mov    (%eax),%eax
+  803ae0:	a8 01                	test   $0x1,%al
+  803ae2:	74 60                	je     803b44 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  803ae4:	89 c2                	mov    %eax,%edx
+  803ae6:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  803aec:	83 ca 01             	or     $0x1,%edx
+  803aef:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  803af2:	75 50                	jne    803b44 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  803af4:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803afa:	c1 e8 1c             	shr    $0x1c,%eax
+  803afd:	8b 13                	mov    (%ebx),%edx
+  803aff:	c1 ea 1c             	shr    $0x1c,%edx
+  803b02:	39 d0                	cmp    %edx,%eax
+  803b04:	75 3e                	jne    803b44 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803b06:	83 c6 01             	add    $0x1,%esi
+  803b09:	83 fe 08             	cmp    $0x8,%esi
+  803b0c:	74 3f                	je     803b4d <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  803b0e:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803b10:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  803b16:	77 2c                	ja     803b44 <page_in+0x14d>
+  803b18:	89 f8                	mov    %edi,%eax
+  803b1a:	c1 e8 16             	shr    $0x16,%eax
+  803b1d:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803b24:	f6 c2 01             	test   $0x1,%dl
+  803b27:	74 9f                	je     803ac8 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803b29:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803b30:	a8 80                	test   $0x80,%al
+  803b32:	75 10                	jne    803b44 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803b34:	89 f8                	mov    %edi,%eax
+  803b36:	c1 e8 0c             	shr    $0xc,%eax
+  803b39:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b40:	a8 01                	test   $0x1,%al
+  803b42:	74 84                	je     803ac8 <page_in+0xd1>
+	if (n == 1)
+  803b44:	83 fe 01             	cmp    $0x1,%esi
+  803b47:	0f 84 fa fe ff ff    	je     803a47 <page_in+0x50>
+	req.nslots = n;
+  803b4d:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  803b53:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b58:	eb 13                	jmp    803b6d <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  803b5a:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  803b5e:	8b 12                	mov    (%edx),%edx
+  803b60:	c1 ea 0c             	shr    $0xc,%edx
+  803b63:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  803b6a:	83 c0 01             	add    $0x1,%eax
+  803b6d:	39 c6                	cmp    %eax,%esi
+  803b6f:	75 e9                	jne    803b5a <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  803b71:	83 ec 0c             	sub    $0xc,%esp
+  803b74:	6a 00                	push   $0x0
+  803b76:	ff 75 c0             	push   -0x40(%ebp)
+  803b79:	56                   	push   %esi
+  803b7a:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803b7d:	57                   	push   %edi
+  803b7e:	6a 00                	push   $0x0
+  803b80:	e8 ab fd ff ff       	call   803930 <page_alloc_range>
+  803b85:	83 c4 20             	add    $0x20,%esp
+  803b88:	85 c0                	test   %eax,%eax
+  803b8a:	78 6e                	js     803bfa <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  803b8c:	83 ec 04             	sub    $0x4,%esp
+  803b8f:	6a 24                	push   $0x24
+  803b91:	68 00 80 80 00       	push   $0x808000
+  803b96:	57                   	push   %edi
+  803b97:	e8 bc ce ff ff       	call   800a58 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803b9c:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803ba3:	56                   	push   %esi
+  803ba4:	57                   	push   %edi
+  803ba5:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803ba7:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  803bae:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803bb1:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  803bb8:	e8 c0 0e 00 00       	call   804a7d <ipc_call>
+  803bbd:	83 c4 20             	add    $0x20,%esp
+  803bc0:	85 c0                	test   %eax,%eax
+  803bc2:	78 08                	js     803bcc <page_in+0x1d5>
+  803bc4:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  803bc7:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  803bca:	eb 20                	jmp    803bec <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  803bcc:	50                   	push   %eax
+  803bcd:	68 84 57 80 00       	push   $0x805784
+  803bd2:	68 59 02 00 00       	push   $0x259
+  803bd7:	68 b5 53 80 00       	push   $0x8053b5
+  803bdc:	e8 2f c6 ff ff       	call   800210 <_panic>
+		*mtes[i] = 0;
+  803be1:	8b 10                	mov    (%eax),%edx
+  803be3:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  803be9:	83 c0 04             	add    $0x4,%eax
+  803bec:	39 c8                	cmp    %ecx,%eax
+  803bee:	75 f1                	jne    803be1 <page_in+0x1ea>
+	return n;
+  803bf0:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  803bf2:	85 f6                	test   %esi,%esi
+  803bf4:	0f 84 4d fe ff ff    	je     803a47 <page_in+0x50>
+		return r < 0 ? r : 0;
+  803bfa:	85 c0                	test   %eax,%eax
+  803bfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c01:	0f 4f c2             	cmovg  %edx,%eax
+  803c04:	e9 99 fe ff ff       	jmp    803aa2 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  803c09:	50                   	push   %eax
+  803c0a:	68 bc 57 80 00       	push   $0x8057bc
+  803c0f:	68 9a 02 00 00       	push   $0x29a
+  803c14:	68 b5 53 80 00       	push   $0x8053b5
+  803c19:	e8 f2 c5 ff ff       	call   800210 <_panic>
+		return -E_PAGING;
+  803c1e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803c23:	e9 7a fe ff ff       	jmp    803aa2 <page_in+0xab>
+
+00803c28 <page_map>:
+{
+  803c28:	55                   	push   %ebp
+  803c29:	89 e5                	mov    %esp,%ebp
+  803c2b:	57                   	push   %edi
+  803c2c:	56                   	push   %esi
+  803c2d:	53                   	push   %ebx
+  803c2e:	83 ec 1c             	sub    $0x1c,%esp
+  803c31:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803c34:	83 ec 0c             	sub    $0xc,%esp
+  803c37:	ff 75 18             	push   0x18(%ebp)
+  803c3a:	ff 75 14             	push   0x14(%ebp)
+  803c3d:	ff 75 10             	push   0x10(%ebp)
+  803c40:	ff 75 0c             	push   0xc(%ebp)
+  803c43:	56                   	push   %esi
+  803c44:	e8 bf d1 ff ff       	call   800e08 <sys_page_map>
+  803c49:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803c4c:	83 c4 20             	add    $0x20,%esp
+  803c4f:	85 c0                	test   %eax,%eax
+  803c51:	0f 89 a9 01 00 00    	jns    803e00 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  803c57:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  803c5b:	74 5f                	je     803cbc <page_map+0x94>
+		if (r != -E_INVAL)
+  803c5d:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  803c61:	0f 85 a0 01 00 00    	jne    803e07 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803c67:	85 f6                	test   %esi,%esi
+  803c69:	74 70                	je     803cdb <page_map+0xb3>
+  803c6b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803c70:	8b 40 48             	mov    0x48(%eax),%eax
+  803c73:	39 f0                	cmp    %esi,%eax
+  803c75:	74 64                	je     803cdb <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803c77:	83 ec 0c             	sub    $0xc,%esp
+  803c7a:	6a 05                	push   $0x5
+  803c7c:	68 00 00 40 00       	push   $0x400000
+  803c81:	6a 00                	push   $0x0
+  803c83:	68 00 b0 ad de       	push   $0xdeadb000
+  803c88:	56                   	push   %esi
+  803c89:	e8 7a d1 ff ff       	call   800e08 <sys_page_map>
+  803c8e:	89 c3                	mov    %eax,%ebx
+  803c90:	83 c4 20             	add    $0x20,%esp
+  803c93:	85 c0                	test   %eax,%eax
+  803c95:	79 6a                	jns    803d01 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  803c97:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803c9a:	75 50                	jne    803cec <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  803c9c:	83 ec 08             	sub    $0x8,%esp
+  803c9f:	68 00 00 40 00       	push   $0x400000
+  803ca4:	6a fc                	push   $0xfffffffc
+  803ca6:	e8 9c f6 ff ff       	call   803347 <page_out>
+  803cab:	83 c4 10             	add    $0x10,%esp
+  803cae:	85 c0                	test   %eax,%eax
+  803cb0:	79 c5                	jns    803c77 <page_map+0x4f>
+}
+  803cb2:	89 d8                	mov    %ebx,%eax
+  803cb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cb7:	5b                   	pop    %ebx
+  803cb8:	5e                   	pop    %esi
+  803cb9:	5f                   	pop    %edi
+  803cba:	5d                   	pop    %ebp
+  803cbb:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  803cbc:	83 ec 08             	sub    $0x8,%esp
+  803cbf:	68 00 00 40 00       	push   $0x400000
+  803cc4:	6a 00                	push   $0x0
+  803cc6:	e8 7c f6 ff ff       	call   803347 <page_out>
+  803ccb:	83 c4 10             	add    $0x10,%esp
+  803cce:	85 c0                	test   %eax,%eax
+  803cd0:	0f 89 5e ff ff ff    	jns    803c34 <page_map+0xc>
+				return r;
+  803cd6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803cd9:	eb d7                	jmp    803cb2 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803cdb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803cde:	e8 79 f9 ff ff       	call   80365c <page_adopt>
+  803ce3:	85 c0                	test   %eax,%eax
+  803ce5:	79 90                	jns    803c77 <page_map+0x4f>
+			return r;
+  803ce7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803cea:	eb c6                	jmp    803cb2 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  803cec:	53                   	push   %ebx
+  803ced:	68 f0 57 80 00       	push   $0x8057f0
+  803cf2:	68 77 03 00 00       	push   $0x377
+  803cf7:	68 b5 53 80 00       	push   $0x8053b5
+  803cfc:	e8 0f c5 ff ff       	call   800210 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  803d01:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d04:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803d07:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  803d0e:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  803d14:	0f 84 f5 00 00 00    	je     803e0f <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803d1a:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803d20:	83 ec 0c             	sub    $0xc,%esp
+  803d23:	6a 05                	push   $0x5
+  803d25:	68 00 00 40 00       	push   $0x400000
+  803d2a:	6a 00                	push   $0x0
+  803d2c:	57                   	push   %edi
+  803d2d:	56                   	push   %esi
+  803d2e:	e8 d5 d0 ff ff       	call   800e08 <sys_page_map>
+  803d33:	89 c3                	mov    %eax,%ebx
+  803d35:	83 c4 20             	add    $0x20,%esp
+  803d38:	85 c0                	test   %eax,%eax
+  803d3a:	79 35                	jns    803d71 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  803d3c:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803d3f:	75 1b                	jne    803d5c <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803d41:	83 ec 08             	sub    $0x8,%esp
+  803d44:	68 00 00 40 00       	push   $0x400000
+  803d49:	6a 00                	push   $0x0
+  803d4b:	e8 f7 f5 ff ff       	call   803347 <page_out>
+  803d50:	83 c4 10             	add    $0x10,%esp
+  803d53:	85 c0                	test   %eax,%eax
+  803d55:	79 c9                	jns    803d20 <page_map+0xf8>
+  803d57:	e9 56 ff ff ff       	jmp    803cb2 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  803d5c:	53                   	push   %ebx
+  803d5d:	68 18 58 80 00       	push   $0x805818
+  803d62:	68 83 03 00 00       	push   $0x383
+  803d67:	68 b5 53 80 00       	push   $0x8053b5
+  803d6c:	e8 9f c4 ff ff       	call   800210 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  803d71:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d74:	c1 e8 0c             	shr    $0xc,%eax
+  803d77:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803d7c:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  803d83:	01 
+  803d84:	0f 84 8d 00 00 00    	je     803e17 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803d8a:	83 ec 08             	sub    $0x8,%esp
+  803d8d:	68 00 00 40 00       	push   $0x400000
+  803d92:	6a 00                	push   $0x0
+  803d94:	e8 b1 d0 ff ff       	call   800e4a <sys_page_unmap>
+  803d99:	83 c4 10             	add    $0x10,%esp
+  803d9c:	85 c0                	test   %eax,%eax
+  803d9e:	78 36                	js     803dd6 <page_map+0x1ae>
+  803da0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  803da3:	83 ec 08             	sub    $0x8,%esp
+  803da6:	57                   	push   %edi
+  803da7:	56                   	push   %esi
+  803da8:	e8 4a fc ff ff       	call   8039f7 <page_in>
+  803dad:	89 c3                	mov    %eax,%ebx
+  803daf:	83 c4 10             	add    $0x10,%esp
+  803db2:	85 c0                	test   %eax,%eax
+  803db4:	0f 89 7a fe ff ff    	jns    803c34 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  803dba:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803dbd:	75 2c                	jne    803deb <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  803dbf:	83 ec 08             	sub    $0x8,%esp
+  803dc2:	57                   	push   %edi
+  803dc3:	6a 00                	push   $0x0
+  803dc5:	e8 7d f5 ff ff       	call   803347 <page_out>
+  803dca:	83 c4 10             	add    $0x10,%esp
+  803dcd:	85 c0                	test   %eax,%eax
+  803dcf:	79 d2                	jns    803da3 <page_map+0x17b>
+  803dd1:	e9 dc fe ff ff       	jmp    803cb2 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  803dd6:	50                   	push   %eax
+  803dd7:	68 44 58 80 00       	push   $0x805844
+  803ddc:	68 8b 03 00 00       	push   $0x38b
+  803de1:	68 b5 53 80 00       	push   $0x8053b5
+  803de6:	e8 25 c4 ff ff       	call   800210 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  803deb:	53                   	push   %ebx
+  803dec:	68 6c 58 80 00       	push   $0x80586c
+  803df1:	68 91 03 00 00       	push   $0x391
+  803df6:	68 b5 53 80 00       	push   $0x8053b5
+  803dfb:	e8 10 c4 ff ff       	call   800210 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803e00:	89 c3                	mov    %eax,%ebx
+  803e02:	e9 ab fe ff ff       	jmp    803cb2 <page_map+0x8a>
+  803e07:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e0a:	e9 a3 fe ff ff       	jmp    803cb2 <page_map+0x8a>
+			return r; // Pass through the error
+  803e0f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e12:	e9 9b fe ff ff       	jmp    803cb2 <page_map+0x8a>
+			return r; // Pass through the error
+  803e17:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e1a:	e9 93 fe ff ff       	jmp    803cb2 <page_map+0x8a>
+
+00803e1f <page_map_range>:
+{
+  803e1f:	55                   	push   %ebp
+  803e20:	89 e5                	mov    %esp,%ebp
+  803e22:	57                   	push   %edi
+  803e23:	56                   	push   %esi
+  803e24:	53                   	push   %ebx
+  803e25:	83 ec 0c             	sub    $0xc,%esp
+  803e28:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803e2b:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  803e2e:	83 ec 08             	sub    $0x8,%esp
+  803e31:	ff 75 1c             	push   0x1c(%ebp)
+  803e34:	ff 75 18             	push   0x18(%ebp)
+  803e37:	56                   	push   %esi
+  803e38:	ff 75 10             	push   0x10(%ebp)
+  803e3b:	57                   	push   %edi
+  803e3c:	ff 75 08             	push   0x8(%ebp)
+  803e3f:	e8 cf d0 ff ff       	call   800f13 <sys_page_map_range>
+  803e44:	89 c3                	mov    %eax,%ebx
+  803e46:	83 c4 20             	add    $0x20,%esp
+  803e49:	85 c0                	test   %eax,%eax
+  803e4b:	79 1b                	jns    803e68 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  803e4d:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803e50:	75 20                	jne    803e72 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803e52:	83 ec 08             	sub    $0x8,%esp
+  803e55:	68 00 00 40 00       	push   $0x400000
+  803e5a:	6a 00                	push   $0x0
+  803e5c:	e8 e6 f4 ff ff       	call   803347 <page_out>
+  803e61:	83 c4 10             	add    $0x10,%esp
+  803e64:	85 c0                	test   %eax,%eax
+  803e66:	79 c6                	jns    803e2e <page_map_range+0xf>
+}
+  803e68:	89 d8                	mov    %ebx,%eax
+  803e6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e6d:	5b                   	pop    %ebx
+  803e6e:	5e                   	pop    %esi
+  803e6f:	5f                   	pop    %edi
+  803e70:	5d                   	pop    %ebp
+  803e71:	c3                   	ret
+		if (r != -E_INVAL)
+  803e72:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  803e75:	75 f1                	jne    803e68 <page_map_range+0x49>
+  803e77:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  803e79:	be 00 00 00 00       	mov    $0x0,%esi
+  803e7e:	eb 03                	jmp    803e83 <page_map_range+0x64>
+  803e80:	83 c6 01             	add    $0x1,%esi
+  803e83:	3b 75 18             	cmp    0x18(%ebp),%esi
+  803e86:	74 2a                	je     803eb2 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  803e88:	83 ec 0c             	sub    $0xc,%esp
+  803e8b:	ff 75 1c             	push   0x1c(%ebp)
+  803e8e:	53                   	push   %ebx
+  803e8f:	ff 75 10             	push   0x10(%ebp)
+  803e92:	57                   	push   %edi
+  803e93:	ff 75 08             	push   0x8(%ebp)
+  803e96:	e8 8d fd ff ff       	call   803c28 <page_map>
+  803e9b:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803ea1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803ea7:	83 c4 20             	add    $0x20,%esp
+  803eaa:	85 c0                	test   %eax,%eax
+  803eac:	79 d2                	jns    803e80 <page_map_range+0x61>
+  803eae:	89 c3                	mov    %eax,%ebx
+  803eb0:	eb b6                	jmp    803e68 <page_map_range+0x49>
+		return 0;
+  803eb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803eb7:	eb af                	jmp    803e68 <page_map_range+0x49>
+
+00803eb9 <paging_pgfault_handler>:
+{
+  803eb9:	55                   	push   %ebp
+  803eba:	89 e5                	mov    %esp,%ebp
+  803ebc:	56                   	push   %esi
+  803ebd:	53                   	push   %ebx
+  803ebe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  803ec1:	e8 6f e7 ff ff       	call   802635 <find_paging_env>
+	if (pagingenv == 0)
+  803ec6:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803ecb:	85 c0                	test   %eax,%eax
+  803ecd:	74 3c                	je     803f0b <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  803ecf:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803ed1:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803ed5:	75 12                	jne    803ee9 <paging_pgfault_handler+0x30>
+  803ed7:	89 f0                	mov    %esi,%eax
+  803ed9:	e8 7e f7 ff ff       	call   80365c <page_adopt>
+  803ede:	89 c2                	mov    %eax,%edx
+		return 0;
+  803ee0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803ee5:	85 d2                	test   %edx,%edx
+  803ee7:	78 22                	js     803f0b <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  803ee9:	83 ec 08             	sub    $0x8,%esp
+  803eec:	6a 00                	push   $0x0
+  803eee:	56                   	push   %esi
+  803eef:	e8 a9 f3 ff ff       	call   80329d <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  803ef4:	83 c4 10             	add    $0x10,%esp
+  803ef7:	85 c0                	test   %eax,%eax
+  803ef9:	74 05                	je     803f00 <paging_pgfault_handler+0x47>
+  803efb:	f6 00 01             	testb  $0x1,(%eax)
+  803efe:	75 12                	jne    803f12 <paging_pgfault_handler+0x59>
+	return 0;
+  803f00:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f05:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803f09:	74 23                	je     803f2e <paging_pgfault_handler+0x75>
+}
+  803f0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f0e:	5b                   	pop    %ebx
+  803f0f:	5e                   	pop    %esi
+  803f10:	5d                   	pop    %ebp
+  803f11:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  803f12:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803f17:	8b 40 48             	mov    0x48(%eax),%eax
+  803f1a:	83 ec 08             	sub    $0x8,%esp
+  803f1d:	56                   	push   %esi
+  803f1e:	50                   	push   %eax
+  803f1f:	e8 d3 fa ff ff       	call   8039f7 <page_in>
+  803f24:	f7 d0                	not    %eax
+  803f26:	c1 e8 1f             	shr    $0x1f,%eax
+  803f29:	83 c4 10             	add    $0x10,%esp
+  803f2c:	eb dd                	jmp    803f0b <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f2e:	89 f0                	mov    %esi,%eax
+  803f30:	e8 97 e2 ff ff       	call   8021cc <segment_lookup>
+  803f35:	89 c2                	mov    %eax,%edx
+	return 0;
+  803f37:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f3c:	85 d2                	test   %edx,%edx
+  803f3e:	74 cb                	je     803f0b <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  803f40:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803f45:	8b 40 48             	mov    0x48(%eax),%eax
+  803f48:	83 ec 08             	sub    $0x8,%esp
+  803f4b:	56                   	push   %esi
+  803f4c:	50                   	push   %eax
+  803f4d:	e8 f5 f3 ff ff       	call   803347 <page_out>
+  803f52:	f7 d0                	not    %eax
+  803f54:	c1 e8 1f             	shr    $0x1f,%eax
+  803f57:	83 c4 10             	add    $0x10,%esp
+  803f5a:	eb af                	jmp    803f0b <paging_pgfault_handler+0x52>
+
+00803f5c <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  803f5c:	55                   	push   %ebp
+  803f5d:	89 e5                	mov    %esp,%ebp
+  803f5f:	57                   	push   %edi
+  803f60:	56                   	push   %esi
+  803f61:	53                   	push   %ebx
+  803f62:	83 ec 2c             	sub    $0x2c,%esp
+  803f65:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  803f68:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  803f6d:	89 c1                	mov    %eax,%ecx
+  803f6f:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  803f72:	c1 e8 11             	shr    $0x11,%eax
+  803f75:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803f78:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  803f7f:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  803f82:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f87:	d3 e0                	shl    %cl,%eax
+  803f89:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803f8c:	85 c7                	test   %eax,%edi
+  803f8e:	74 12                	je     803fa2 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803f90:	bb 01 00 00 00       	mov    $0x1,%ebx
+  803f95:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  803f98:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f9d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803fa0:	eb 17                	jmp    803fb9 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  803fa2:	ff 75 e0             	push   -0x20(%ebp)
+  803fa5:	68 a4 58 80 00       	push   $0x8058a4
+  803faa:	6a 48                	push   $0x48
+  803fac:	68 be 58 80 00       	push   $0x8058be
+  803fb1:	e8 5a c2 ff ff       	call   800210 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803fb6:	83 c3 01             	add    $0x1,%ebx
+  803fb9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803fbc:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  803fbf:	89 c8                	mov    %ecx,%eax
+  803fc1:	c1 e8 05             	shr    $0x5,%eax
+  803fc4:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  803fcb:	89 fe                	mov    %edi,%esi
+  803fcd:	d3 e6                	shl    %cl,%esi
+  803fcf:	89 f1                	mov    %esi,%ecx
+  803fd1:	85 d6                	test   %edx,%esi
+  803fd3:	74 e1                	je     803fb6 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  803fd5:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  803fd8:	f7 d6                	not    %esi
+  803fda:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  803fdd:	21 fe                	and    %edi,%esi
+  803fdf:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803fe2:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  803fe9:	f7 d1                	not    %ecx
+  803feb:	21 d1                	and    %edx,%ecx
+  803fed:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  803ff4:	83 ec 04             	sub    $0x4,%esp
+  803ff7:	53                   	push   %ebx
+  803ff8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803ffb:	57                   	push   %edi
+  803ffc:	6a 00                	push   $0x0
+  803ffe:	e8 97 f8 ff ff       	call   80389a <page_unmap_range>
+	va_free(va, n);
+  804003:	83 c4 08             	add    $0x8,%esp
+  804006:	53                   	push   %ebx
+  804007:	57                   	push   %edi
+  804008:	e8 ed 05 00 00       	call   8045fa <va_free>
+}
+  80400d:	83 c4 10             	add    $0x10,%esp
+  804010:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804013:	5b                   	pop    %ebx
+  804014:	5e                   	pop    %esi
+  804015:	5f                   	pop    %edi
+  804016:	5d                   	pop    %ebp
+  804017:	c3                   	ret
+
+00804018 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  804018:	55                   	push   %ebp
+  804019:	89 e5                	mov    %esp,%ebp
+  80401b:	57                   	push   %edi
+  80401c:	56                   	push   %esi
+  80401d:	53                   	push   %ebx
+  80401e:	83 ec 1c             	sub    $0x1c,%esp
+  804021:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804024:	85 db                	test   %ebx,%ebx
+  804026:	74 34                	je     80405c <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  804028:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80402e:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  804033:	77 2f                	ja     804064 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  804035:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80403b:	75 51                	jne    80408e <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  80403d:	89 c1                	mov    %eax,%ecx
+  80403f:	c1 e9 0c             	shr    $0xc,%ecx
+  804042:	ba 01 00 00 00       	mov    $0x1,%edx
+  804047:	d3 e2                	shl    %cl,%edx
+  804049:	c1 e8 11             	shr    $0x11,%eax
+  80404c:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  804053:	75 24                	jne    804079 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  804055:	89 d8                	mov    %ebx,%eax
+  804057:	e8 00 ff ff ff       	call   803f5c <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  80405c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80405f:	5b                   	pop    %ebx
+  804060:	5e                   	pop    %esi
+  804061:	5f                   	pop    %edi
+  804062:	5d                   	pop    %ebp
+  804063:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  804064:	53                   	push   %ebx
+  804065:	68 cb 58 80 00       	push   $0x8058cb
+  80406a:	68 a2 00 00 00       	push   $0xa2
+  80406f:	68 be 58 80 00       	push   $0x8058be
+  804074:	e8 97 c1 ff ff       	call   800210 <_panic>
+			panic("free: %p is not allocated", va);
+  804079:	53                   	push   %ebx
+  80407a:	68 a4 58 80 00       	push   $0x8058a4
+  80407f:	68 a5 00 00 00       	push   $0xa5
+  804084:	68 be 58 80 00       	push   $0x8058be
+  804089:	e8 82 c1 ff ff       	call   800210 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  80408e:	89 de                	mov    %ebx,%esi
+  804090:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  804096:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  80409c:	89 c8                	mov    %ecx,%eax
+  80409e:	c1 e8 11             	shr    $0x11,%eax
+  8040a1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8040a4:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  8040ab:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8040ae:	c1 e9 0c             	shr    $0xc,%ecx
+  8040b1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8040b6:	d3 e0                	shl    %cl,%eax
+  8040b8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8040bb:	85 c7                	test   %eax,%edi
+  8040bd:	74 1b                	je     8040da <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  8040bf:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8040c3:	89 d8                	mov    %ebx,%eax
+  8040c5:	29 f0                	sub    %esi,%eax
+  8040c7:	83 e8 10             	sub    $0x10,%eax
+  8040ca:	99                   	cltd
+  8040cb:	f7 ff                	idiv   %edi
+  8040cd:	89 d1                	mov    %edx,%ecx
+  8040cf:	85 d2                	test   %edx,%edx
+  8040d1:	75 07                	jne    8040da <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8040d3:	ba 10 00 00 00       	mov    $0x10,%edx
+  8040d8:	eb 18                	jmp    8040f2 <free+0xda>
+		panic("free: %p is not allocated", va);
+  8040da:	53                   	push   %ebx
+  8040db:	68 a4 58 80 00       	push   $0x8058a4
+  8040e0:	68 ad 00 00 00       	push   $0xad
+  8040e5:	68 be 58 80 00       	push   $0x8058be
+  8040ea:	e8 21 c1 ff ff       	call   800210 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8040ef:	83 c1 01             	add    $0x1,%ecx
+  8040f2:	89 d0                	mov    %edx,%eax
+  8040f4:	d3 e0                	shl    %cl,%eax
+  8040f6:	39 c7                	cmp    %eax,%edi
+  8040f8:	7f f5                	jg     8040ef <free+0xd7>
+	*(void **) va = s->free;
+  8040fa:	8b 46 08             	mov    0x8(%esi),%eax
+  8040fd:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  8040ff:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  804102:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  804106:	8d 58 01             	lea    0x1(%eax),%ebx
+  804109:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  80410d:	66 85 c0             	test   %ax,%ax
+  804110:	74 52                	je     804164 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804112:	0f b7 db             	movzwl %bx,%ebx
+  804115:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804119:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80411e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804123:	f7 ff                	idiv   %edi
+  804125:	39 c3                	cmp    %eax,%ebx
+  804127:	0f 85 2f ff ff ff    	jne    80405c <free+0x44>
+  80412d:	8b 46 04             	mov    0x4(%esi),%eax
+  804130:	85 c0                	test   %eax,%eax
+  804132:	74 53                	je     804187 <free+0x16f>
+		s->prev->next = s->next;
+  804134:	8b 16                	mov    (%esi),%edx
+  804136:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804138:	8b 06                	mov    (%esi),%eax
+  80413a:	85 c0                	test   %eax,%eax
+  80413c:	74 06                	je     804144 <free+0x12c>
+		s->next->prev = s->prev;
+  80413e:	8b 56 04             	mov    0x4(%esi),%edx
+  804141:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804144:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804147:	f7 d0                	not    %eax
+  804149:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80414c:	21 d0                	and    %edx,%eax
+  80414e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  804151:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  804158:	89 f0                	mov    %esi,%eax
+  80415a:	e8 fd fd ff ff       	call   803f5c <heap_free_pages>
+  80415f:	e9 f8 fe ff ff       	jmp    80405c <free+0x44>
+	s->prev = NULL;
+  804164:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  80416b:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  804172:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  804174:	85 c0                	test   %eax,%eax
+  804176:	74 03                	je     80417b <free+0x163>
+		slabs[c]->prev = s;
+  804178:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  80417b:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  804182:	e9 d5 fe ff ff       	jmp    80405c <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804187:	8b 06                	mov    (%esi),%eax
+  804189:	85 c0                	test   %eax,%eax
+  80418b:	0f 84 cb fe ff ff    	je     80405c <free+0x44>
+		slabs[c] = s->next;
+  804191:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  804198:	8b 06                	mov    (%esi),%eax
+  80419a:	eb a2                	jmp    80413e <free+0x126>
+
+0080419c <heap_alloc_pages>:
+{
+  80419c:	55                   	push   %ebp
+  80419d:	89 e5                	mov    %esp,%ebp
+  80419f:	57                   	push   %edi
+  8041a0:	56                   	push   %esi
+  8041a1:	53                   	push   %ebx
+  8041a2:	83 ec 18             	sub    $0x18,%esp
+  8041a5:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  8041a7:	50                   	push   %eax
+  8041a8:	e8 15 03 00 00       	call   8044c2 <va_alloc>
+  8041ad:	89 c3                	mov    %eax,%ebx
+  8041af:	83 c4 10             	add    $0x10,%esp
+  8041b2:	85 c0                	test   %eax,%eax
+  8041b4:	74 47                	je     8041fd <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8041b6:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  8041bc:	89 c1                	mov    %eax,%ecx
+  8041be:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  8041c1:	c1 e8 11             	shr    $0x11,%eax
+  8041c4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8041c9:	89 d7                	mov    %edx,%edi
+  8041cb:	d3 e7                	shl    %cl,%edi
+  8041cd:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  8041d4:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  8041d8:	89 c8                	mov    %ecx,%eax
+  8041da:	c1 e8 05             	shr    $0x5,%eax
+  8041dd:	d3 e2                	shl    %cl,%edx
+  8041df:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  8041e6:	83 ec 0c             	sub    $0xc,%esp
+  8041e9:	6a 00                	push   $0x0
+  8041eb:	6a 07                	push   $0x7
+  8041ed:	56                   	push   %esi
+  8041ee:	53                   	push   %ebx
+  8041ef:	6a 00                	push   $0x0
+  8041f1:	e8 3a f7 ff ff       	call   803930 <page_alloc_range>
+  8041f6:	83 c4 20             	add    $0x20,%esp
+  8041f9:	85 c0                	test   %eax,%eax
+  8041fb:	78 0a                	js     804207 <heap_alloc_pages+0x6b>
+}
+  8041fd:	89 d8                	mov    %ebx,%eax
+  8041ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804202:	5b                   	pop    %ebx
+  804203:	5e                   	pop    %esi
+  804204:	5f                   	pop    %edi
+  804205:	5d                   	pop    %ebp
+  804206:	c3                   	ret
+		free(va);
+  804207:	83 ec 0c             	sub    $0xc,%esp
+  80420a:	53                   	push   %ebx
+  80420b:	e8 08 fe ff ff       	call   804018 <free>
+		return NULL;
+  804210:	83 c4 10             	add    $0x10,%esp
+  804213:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804218:	eb e3                	jmp    8041fd <heap_alloc_pages+0x61>
+
+0080421a <malloc>:
+{
+  80421a:	55                   	push   %ebp
+  80421b:	89 e5                	mov    %esp,%ebp
+  80421d:	57                   	push   %edi
+  80421e:	56                   	push   %esi
+  80421f:	53                   	push   %ebx
+  804220:	83 ec 1c             	sub    $0x1c,%esp
+  804223:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804226:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804229:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  80422f:	0f 87 21 01 00 00    	ja     804356 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804235:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80423a:	ba 10 00 00 00       	mov    $0x10,%edx
+  80423f:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  804241:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804246:	76 15                	jbe    80425d <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804248:	05 ff 0f 00 00       	add    $0xfff,%eax
+  80424d:	c1 e8 0c             	shr    $0xc,%eax
+  804250:	e8 47 ff ff ff       	call   80419c <heap_alloc_pages>
+  804255:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804258:	eb 37                	jmp    804291 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  80425a:	83 c1 01             	add    $0x1,%ecx
+  80425d:	89 d6                	mov    %edx,%esi
+  80425f:	d3 e6                	shl    %cl,%esi
+  804261:	39 c6                	cmp    %eax,%esi
+  804263:	72 f5                	jb     80425a <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804265:	89 cb                	mov    %ecx,%ebx
+  804267:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  80426e:	85 ff                	test   %edi,%edi
+  804270:	74 2a                	je     80429c <malloc+0x82>
+	v = s->free;
+  804272:	8b 47 08             	mov    0x8(%edi),%eax
+  804275:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  804278:	8b 00                	mov    (%eax),%eax
+  80427a:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  80427d:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  804281:	83 e8 01             	sub    $0x1,%eax
+  804284:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  804288:	66 85 c0             	test   %ax,%ax
+  80428b:	0f 84 9a 00 00 00    	je     80432b <malloc+0x111>
+}
+  804291:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804294:	83 c4 1c             	add    $0x1c,%esp
+  804297:	5b                   	pop    %ebx
+  804298:	5e                   	pop    %esi
+  804299:	5f                   	pop    %edi
+  80429a:	5d                   	pop    %ebp
+  80429b:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  80429c:	b8 01 00 00 00       	mov    $0x1,%eax
+  8042a1:	e8 f6 fe ff ff       	call   80419c <heap_alloc_pages>
+  8042a6:	89 c1                	mov    %eax,%ecx
+  8042a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8042ab:	85 c0                	test   %eax,%eax
+  8042ad:	74 e2                	je     804291 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8042af:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  8042b5:	89 c8                	mov    %ecx,%eax
+  8042b7:	c1 e8 11             	shr    $0x11,%eax
+  8042ba:	c1 e9 0c             	shr    $0xc,%ecx
+  8042bd:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042c2:	d3 e2                	shl    %cl,%edx
+  8042c4:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  8042cb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8042ce:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  8042d2:	0f b7 f6             	movzwl %si,%esi
+  8042d5:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8042da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042df:	f7 fe                	idiv   %esi
+  8042e1:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  8042e5:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  8042e8:	85 c0                	test   %eax,%eax
+  8042ea:	74 14                	je     804300 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  8042ec:	83 e8 01             	sub    $0x1,%eax
+  8042ef:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  8042f3:	0f af d0             	imul   %eax,%edx
+  8042f6:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  8042fa:	89 3a                	mov    %edi,(%edx)
+  8042fc:	89 d7                	mov    %edx,%edi
+  8042fe:	eb e5                	jmp    8042e5 <malloc+0xcb>
+	s->prev = NULL;
+  804300:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804303:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  80430a:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  804311:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804313:	85 c0                	test   %eax,%eax
+  804315:	74 03                	je     80431a <malloc+0x100>
+		slabs[c]->prev = s;
+  804317:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  80431a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80431d:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  804324:	89 c7                	mov    %eax,%edi
+  804326:	e9 47 ff ff ff       	jmp    804272 <malloc+0x58>
+	if (s->prev)
+  80432b:	8b 47 04             	mov    0x4(%edi),%eax
+  80432e:	85 c0                	test   %eax,%eax
+  804330:	74 19                	je     80434b <malloc+0x131>
+		s->prev->next = s->next;
+  804332:	8b 17                	mov    (%edi),%edx
+  804334:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804336:	8b 07                	mov    (%edi),%eax
+  804338:	85 c0                	test   %eax,%eax
+  80433a:	0f 84 51 ff ff ff    	je     804291 <malloc+0x77>
+		s->next->prev = s->prev;
+  804340:	8b 57 04             	mov    0x4(%edi),%edx
+  804343:	89 50 04             	mov    %edx,0x4(%eax)
+  804346:	e9 46 ff ff ff       	jmp    804291 <malloc+0x77>
+		slabs[c] = s->next;
+  80434b:	8b 07                	mov    (%edi),%eax
+  80434d:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  804354:	eb e0                	jmp    804336 <malloc+0x11c>
+		return NULL;
+  804356:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80435d:	e9 2f ff ff ff       	jmp    804291 <malloc+0x77>
+
+00804362 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804362:	55                   	push   %ebp
+  804363:	89 e5                	mov    %esp,%ebp
+  804365:	57                   	push   %edi
+  804366:	56                   	push   %esi
+  804367:	53                   	push   %ebx
+  804368:	83 ec 0c             	sub    $0xc,%esp
+  80436b:	89 c6                	mov    %eax,%esi
+  80436d:	89 d7                	mov    %edx,%edi
+  80436f:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804372:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804377:	ba 00 00 00 00       	mov    $0x0,%edx
+  80437c:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  804381:	83 ef 01             	sub    $0x1,%edi
+  804384:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804387:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  80438a:	eb 34                	jmp    8043c0 <va_chunk_scan+0x5e>
+			i += 31;
+  80438c:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  80438f:	89 ca                	mov    %ecx,%edx
+			continue;
+  804391:	eb 23                	jmp    8043b6 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804393:	89 c7                	mov    %eax,%edi
+  804395:	c1 ef 05             	shr    $0x5,%edi
+  804398:	be 01 00 00 00       	mov    $0x1,%esi
+  80439d:	d3 e6                	shl    %cl,%esi
+  80439f:	89 f1                	mov    %esi,%ecx
+  8043a1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8043a4:	23 0c be             	and    (%esi,%edi,4),%ecx
+  8043a7:	75 41                	jne    8043ea <va_chunk_scan+0x88>
+			len++;
+  8043a9:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  8043ac:	39 d3                	cmp    %edx,%ebx
+  8043ae:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  8043b1:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  8043b4:	72 2d                	jb     8043e3 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8043b6:	83 c0 01             	add    $0x1,%eax
+  8043b9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8043be:	77 31                	ja     8043f1 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  8043c0:	89 c1                	mov    %eax,%ecx
+  8043c2:	83 e1 1f             	and    $0x1f,%ecx
+  8043c5:	75 cc                	jne    804393 <va_chunk_scan+0x31>
+  8043c7:	89 c7                	mov    %eax,%edi
+  8043c9:	c1 ef 05             	shr    $0x5,%edi
+  8043cc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8043cf:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  8043d2:	83 ff ff             	cmp    $0xffffffff,%edi
+  8043d5:	74 b5                	je     80438c <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  8043d7:	85 ff                	test   %edi,%edi
+  8043d9:	75 b8                	jne    804393 <va_chunk_scan+0x31>
+			i += 31;
+  8043db:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  8043de:	83 c2 20             	add    $0x20,%edx
+  8043e1:	eb c9                	jmp    8043ac <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  8043e3:	83 c0 01             	add    $0x1,%eax
+  8043e6:	29 d0                	sub    %edx,%eax
+  8043e8:	eb 15                	jmp    8043ff <va_chunk_scan+0x9d>
+			len = 0;
+  8043ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043ef:	eb c5                	jmp    8043b6 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  8043f1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  8043f6:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  8043f9:	85 d2                	test   %edx,%edx
+  8043fb:	74 02                	je     8043ff <va_chunk_scan+0x9d>
+		*run_store = best;
+  8043fd:	89 1a                	mov    %ebx,(%edx)
+}
+  8043ff:	83 c4 0c             	add    $0xc,%esp
+  804402:	5b                   	pop    %ebx
+  804403:	5e                   	pop    %esi
+  804404:	5f                   	pop    %edi
+  804405:	5d                   	pop    %ebp
+  804406:	c3                   	ret
+
+00804407 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804407:	55                   	push   %ebp
+  804408:	89 e5                	mov    %esp,%ebp
+  80440a:	57                   	push   %edi
+  80440b:	56                   	push   %esi
+  80440c:	53                   	push   %ebx
+  80440d:	83 ec 14             	sub    $0x14,%esp
+  804410:	89 c3                	mov    %eax,%ebx
+  804412:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804414:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  80441a:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  804420:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804423:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804426:	89 d6                	mov    %edx,%esi
+  804428:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  80442e:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804430:	eb 34                	jmp    804466 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804432:	89 c8                	mov    %ecx,%eax
+  804434:	c1 e8 05             	shr    $0x5,%eax
+  804437:	89 da                	mov    %ebx,%edx
+  804439:	c1 e2 05             	shl    $0x5,%edx
+  80443c:	01 da                	add    %ebx,%edx
+  80443e:	01 c2                	add    %eax,%edx
+  804440:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804445:	d3 c0                	rol    %cl,%eax
+  804447:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  80444e:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804455:	b8 01 00 00 00       	mov    $0x1,%eax
+  80445a:	01 d0                	add    %edx,%eax
+  80445c:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804463:	83 c1 01             	add    $0x1,%ecx
+  804466:	39 f9                	cmp    %edi,%ecx
+  804468:	74 30                	je     80449a <va_chunk_mark+0x93>
+		if (alloc)
+  80446a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80446e:	74 c2                	je     804432 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804470:	89 c8                	mov    %ecx,%eax
+  804472:	c1 e8 05             	shr    $0x5,%eax
+  804475:	89 da                	mov    %ebx,%edx
+  804477:	c1 e2 05             	shl    $0x5,%edx
+  80447a:	01 da                	add    %ebx,%edx
+  80447c:	01 c2                	add    %eax,%edx
+  80447e:	b8 01 00 00 00       	mov    $0x1,%eax
+  804483:	d3 e0                	shl    %cl,%eax
+  804485:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  80448c:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804493:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804498:	eb c0                	jmp    80445a <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  80449a:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  80449d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044a2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8044a5:	e8 b8 fe ff ff       	call   804362 <va_chunk_scan>
+	ch->run = run;
+  8044aa:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  8044b0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8044b3:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  8044ba:	83 c4 14             	add    $0x14,%esp
+  8044bd:	5b                   	pop    %ebx
+  8044be:	5e                   	pop    %esi
+  8044bf:	5f                   	pop    %edi
+  8044c0:	5d                   	pop    %ebp
+  8044c1:	c3                   	ret
+
+008044c2 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  8044c2:	55                   	push   %ebp
+  8044c3:	89 e5                	mov    %esp,%ebp
+  8044c5:	57                   	push   %edi
+  8044c6:	56                   	push   %esi
+  8044c7:	53                   	push   %ebx
+  8044c8:	83 ec 04             	sub    $0x4,%esp
+  8044cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  8044ce:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  8044d3:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  8044d8:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  8044df:	74 4f                	je     804530 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  8044e1:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8044e4:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  8044e9:	0f 87 01 01 00 00    	ja     8045f0 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  8044ef:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  8044f5:	0f 87 80 00 00 00    	ja     80457b <va_alloc+0xb9>
+  8044fb:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804500:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804505:	0f b7 10             	movzwl (%eax),%edx
+  804508:	05 84 00 00 00       	add    $0x84,%eax
+  80450d:	39 da                	cmp    %ebx,%edx
+  80450f:	73 2c                	jae    80453d <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804511:	83 c6 01             	add    $0x1,%esi
+  804514:	83 fe 1c             	cmp    $0x1c,%esi
+  804517:	75 ec                	jne    804505 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804519:	b8 00 00 00 00       	mov    $0x0,%eax
+  80451e:	eb 53                	jmp    804573 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804520:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804526:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  80452b:	05 84 00 00 00       	add    $0x84,%eax
+  804530:	39 d0                	cmp    %edx,%eax
+  804532:	75 ec                	jne    804520 <va_alloc+0x5e>
+	va_inited = 1;
+  804534:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  80453b:	eb a4                	jmp    8044e1 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  80453d:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804543:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  804548:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80454d:	89 da                	mov    %ebx,%edx
+  80454f:	e8 0e fe ff ff       	call   804362 <va_chunk_scan>
+  804554:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804556:	6a 01                	push   $0x1
+  804558:	89 d9                	mov    %ebx,%ecx
+  80455a:	89 c2                	mov    %eax,%edx
+  80455c:	89 f0                	mov    %esi,%eax
+  80455e:	e8 a4 fe ff ff       	call   804407 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804563:	c1 e6 16             	shl    $0x16,%esi
+  804566:	c1 e7 0c             	shl    $0xc,%edi
+  804569:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804570:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804573:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804576:	5b                   	pop    %ebx
+  804577:	5e                   	pop    %esi
+  804578:	5f                   	pop    %edi
+  804579:	5d                   	pop    %ebp
+  80457a:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  80457b:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804581:	c1 ee 0a             	shr    $0xa,%esi
+  804584:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804589:	b8 00 00 00 00       	mov    $0x0,%eax
+  80458e:	eb 0a                	jmp    80459a <va_alloc+0xd8>
+			first = c + 1;
+  804590:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804592:	83 c2 01             	add    $0x1,%edx
+  804595:	83 fa 1d             	cmp    $0x1d,%edx
+  804598:	74 4f                	je     8045e9 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  80459a:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  8045a0:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  8045a7:	00 04 
+  8045a9:	75 e5                	jne    804590 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  8045ab:	89 d1                	mov    %edx,%ecx
+  8045ad:	29 c1                	sub    %eax,%ecx
+  8045af:	39 f1                	cmp    %esi,%ecx
+  8045b1:	75 df                	jne    804592 <va_alloc+0xd0>
+  8045b3:	89 c7                	mov    %eax,%edi
+  8045b5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  8045b8:	be 00 04 00 00       	mov    $0x400,%esi
+  8045bd:	39 f3                	cmp    %esi,%ebx
+  8045bf:	0f 46 f3             	cmovbe %ebx,%esi
+  8045c2:	6a 01                	push   $0x1
+  8045c4:	89 f1                	mov    %esi,%ecx
+  8045c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045cb:	89 f8                	mov    %edi,%eax
+  8045cd:	e8 35 fe ff ff       	call   804407 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  8045d2:	83 c7 01             	add    $0x1,%edi
+  8045d5:	83 c4 04             	add    $0x4,%esp
+  8045d8:	29 f3                	sub    %esi,%ebx
+  8045da:	75 dc                	jne    8045b8 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  8045dc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8045df:	c1 e0 16             	shl    $0x16,%eax
+  8045e2:	05 00 00 00 08       	add    $0x8000000,%eax
+  8045e7:	eb 8a                	jmp    804573 <va_alloc+0xb1>
+	return NULL;
+  8045e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045ee:	eb 83                	jmp    804573 <va_alloc+0xb1>
+		return NULL;
+  8045f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045f5:	e9 79 ff ff ff       	jmp    804573 <va_alloc+0xb1>
+
+008045fa <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  8045fa:	55                   	push   %ebp
+  8045fb:	89 e5                	mov    %esp,%ebp
+  8045fd:	57                   	push   %edi
+  8045fe:	56                   	push   %esi
+  8045ff:	53                   	push   %ebx
+  804600:	83 ec 0c             	sub    $0xc,%esp
+  804603:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804606:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804609:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  80460f:	76 21                	jbe    804632 <va_free+0x38>
+  804611:	89 f0                	mov    %esi,%eax
+  804613:	c1 e0 0c             	shl    $0xc,%eax
+  804616:	01 f8                	add    %edi,%eax
+  804618:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  80461d:	77 13                	ja     804632 <va_free+0x38>
+	    || PGOFF(va))
+  80461f:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804625:	75 0b                	jne    804632 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804627:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  80462d:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804630:	eb 45                	jmp    804677 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804632:	83 ec 0c             	sub    $0xc,%esp
+  804635:	56                   	push   %esi
+  804636:	57                   	push   %edi
+  804637:	68 e8 58 80 00       	push   $0x8058e8
+  80463c:	68 8e 00 00 00       	push   $0x8e
+  804641:	68 08 59 80 00       	push   $0x805908
+  804646:	e8 c5 bb ff ff       	call   800210 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  80464b:	89 fa                	mov    %edi,%edx
+  80464d:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804653:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804658:	29 d3                	sub    %edx,%ebx
+  80465a:	39 f3                	cmp    %esi,%ebx
+  80465c:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  80465f:	89 f8                	mov    %edi,%eax
+  804661:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804664:	83 ec 0c             	sub    $0xc,%esp
+  804667:	6a 00                	push   $0x0
+  804669:	89 d9                	mov    %ebx,%ecx
+  80466b:	e8 97 fd ff ff       	call   804407 <va_chunk_mark>
+		i += n;
+  804670:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804672:	29 de                	sub    %ebx,%esi
+  804674:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804677:	85 f6                	test   %esi,%esi
+  804679:	75 d0                	jne    80464b <va_free+0x51>
+	}
+}
+  80467b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80467e:	5b                   	pop    %ebx
+  80467f:	5e                   	pop    %esi
+  804680:	5f                   	pop    %edi
+  804681:	5d                   	pop    %ebp
+  804682:	c3                   	ret
+
+00804683 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804683:	b8 00 00 00 00       	mov    $0x0,%eax
+  804688:	c3                   	ret
+
+00804689 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804689:	55                   	push   %ebp
+  80468a:	89 e5                	mov    %esp,%ebp
+  80468c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80468f:	68 15 59 80 00       	push   $0x805915
+  804694:	ff 75 0c             	push   0xc(%ebp)
+  804697:	e8 36 c2 ff ff       	call   8008d2 <strcpy>
+	return 0;
+}
+  80469c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046a1:	c9                   	leave
+  8046a2:	c3                   	ret
+
+008046a3 <devcons_write>:
+{
+  8046a3:	55                   	push   %ebp
+  8046a4:	89 e5                	mov    %esp,%ebp
+  8046a6:	57                   	push   %edi
+  8046a7:	56                   	push   %esi
+  8046a8:	53                   	push   %ebx
+  8046a9:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8046af:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8046b4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8046ba:	eb 2e                	jmp    8046ea <devcons_write+0x47>
+		m = n - tot;
+  8046bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8046bf:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8046c1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8046c6:	39 c3                	cmp    %eax,%ebx
+  8046c8:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8046cb:	83 ec 04             	sub    $0x4,%esp
+  8046ce:	53                   	push   %ebx
+  8046cf:	89 f0                	mov    %esi,%eax
+  8046d1:	03 45 0c             	add    0xc(%ebp),%eax
+  8046d4:	50                   	push   %eax
+  8046d5:	57                   	push   %edi
+  8046d6:	e8 7d c3 ff ff       	call   800a58 <memmove>
+		sys_cputs(buf, m);
+  8046db:	83 c4 08             	add    $0x8,%esp
+  8046de:	53                   	push   %ebx
+  8046df:	57                   	push   %edi
+  8046e0:	e8 13 c6 ff ff       	call   800cf8 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8046e5:	01 de                	add    %ebx,%esi
+  8046e7:	83 c4 10             	add    $0x10,%esp
+  8046ea:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8046ed:	72 cd                	jb     8046bc <devcons_write+0x19>
+}
+  8046ef:	89 f0                	mov    %esi,%eax
+  8046f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046f4:	5b                   	pop    %ebx
+  8046f5:	5e                   	pop    %esi
+  8046f6:	5f                   	pop    %edi
+  8046f7:	5d                   	pop    %ebp
+  8046f8:	c3                   	ret
+
+008046f9 <devcons_read>:
+{
+  8046f9:	55                   	push   %ebp
+  8046fa:	89 e5                	mov    %esp,%ebp
+  8046fc:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8046ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804704:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804708:	75 07                	jne    804711 <devcons_read+0x18>
+  80470a:	eb 1f                	jmp    80472b <devcons_read+0x32>
+		sys_yield();
+  80470c:	e8 95 c6 ff ff       	call   800da6 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804711:	e8 11 c6 ff ff       	call   800d27 <sys_cgetc>
+  804716:	85 c0                	test   %eax,%eax
+  804718:	74 f2                	je     80470c <devcons_read+0x13>
+	if (c < 0)
+  80471a:	78 0f                	js     80472b <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80471c:	83 f8 04             	cmp    $0x4,%eax
+  80471f:	74 0c                	je     80472d <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804721:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804724:	88 02                	mov    %al,(%edx)
+	return 1;
+  804726:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80472b:	c9                   	leave
+  80472c:	c3                   	ret
+		return 0;
+  80472d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804732:	eb f7                	jmp    80472b <devcons_read+0x32>
+
+00804734 <cputchar>:
+{
+  804734:	55                   	push   %ebp
+  804735:	89 e5                	mov    %esp,%ebp
+  804737:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80473a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80473d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804740:	6a 01                	push   $0x1
+  804742:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804745:	50                   	push   %eax
+  804746:	e8 ad c5 ff ff       	call   800cf8 <sys_cputs>
+}
+  80474b:	83 c4 10             	add    $0x10,%esp
+  80474e:	c9                   	leave
+  80474f:	c3                   	ret
+
+00804750 <getchar>:
+{
+  804750:	55                   	push   %ebp
+  804751:	89 e5                	mov    %esp,%ebp
+  804753:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804756:	6a 01                	push   $0x1
+  804758:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80475b:	50                   	push   %eax
+  80475c:	6a 00                	push   $0x0
+  80475e:	e8 d7 ce ff ff       	call   80163a <read>
+	if (r < 0)
+  804763:	83 c4 10             	add    $0x10,%esp
+  804766:	85 c0                	test   %eax,%eax
+  804768:	78 06                	js     804770 <getchar+0x20>
+	if (r < 1)
+  80476a:	74 06                	je     804772 <getchar+0x22>
+	return c;
+  80476c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804770:	c9                   	leave
+  804771:	c3                   	ret
+		return -E_EOF;
+  804772:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804777:	eb f7                	jmp    804770 <getchar+0x20>
+
+00804779 <iscons>:
+{
+  804779:	55                   	push   %ebp
+  80477a:	89 e5                	mov    %esp,%ebp
+  80477c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80477f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804782:	50                   	push   %eax
+  804783:	ff 75 08             	push   0x8(%ebp)
+  804786:	e8 50 cc ff ff       	call   8013db <fd_lookup>
+  80478b:	83 c4 10             	add    $0x10,%esp
+  80478e:	85 c0                	test   %eax,%eax
+  804790:	78 11                	js     8047a3 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804792:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804795:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  80479b:	39 10                	cmp    %edx,(%eax)
+  80479d:	0f 94 c0             	sete   %al
+  8047a0:	0f b6 c0             	movzbl %al,%eax
+}
+  8047a3:	c9                   	leave
+  8047a4:	c3                   	ret
+
+008047a5 <opencons>:
+{
+  8047a5:	55                   	push   %ebp
+  8047a6:	89 e5                	mov    %esp,%ebp
+  8047a8:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8047ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8047ae:	50                   	push   %eax
+  8047af:	e8 d3 cb ff ff       	call   801387 <fd_alloc>
+  8047b4:	83 c4 10             	add    $0x10,%esp
+  8047b7:	85 c0                	test   %eax,%eax
+  8047b9:	78 3a                	js     8047f5 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8047bb:	83 ec 04             	sub    $0x4,%esp
+  8047be:	68 07 04 00 00       	push   $0x407
+  8047c3:	ff 75 f4             	push   -0xc(%ebp)
+  8047c6:	6a 00                	push   $0x0
+  8047c8:	e8 f8 c5 ff ff       	call   800dc5 <sys_page_alloc>
+  8047cd:	83 c4 10             	add    $0x10,%esp
+  8047d0:	85 c0                	test   %eax,%eax
+  8047d2:	78 21                	js     8047f5 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8047d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047d7:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  8047dd:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8047df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047e2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8047e9:	83 ec 0c             	sub    $0xc,%esp
+  8047ec:	50                   	push   %eax
+  8047ed:	e8 6e cb ff ff       	call   801360 <fd2num>
+  8047f2:	83 c4 10             	add    $0x10,%esp
+}
+  8047f5:	c9                   	leave
+  8047f6:	c3                   	ret
+
+008047f7 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  8047f7:	55                   	push   %ebp
+  8047f8:	89 e5                	mov    %esp,%ebp
+  8047fa:	56                   	push   %esi
+  8047fb:	53                   	push   %ebx
+  8047fc:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8047ff:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  804804:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804807:	85 db                	test   %ebx,%ebx
+  804809:	78 17                	js     804822 <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  80480b:	83 ec 0c             	sub    $0xc,%esp
+  80480e:	56                   	push   %esi
+  80480f:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  804816:	83 c4 10             	add    $0x10,%esp
+  804819:	85 c0                	test   %eax,%eax
+  80481b:	75 27                	jne    804844 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  80481d:	83 eb 01             	sub    $0x1,%ebx
+  804820:	eb e5                	jmp    804807 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804822:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804827:	8b 40 48             	mov    0x48(%eax),%eax
+  80482a:	83 ec 08             	sub    $0x8,%esp
+  80482d:	ff 76 28             	push   0x28(%esi)
+  804830:	ff 36                	push   (%esi)
+  804832:	50                   	push   %eax
+  804833:	68 24 59 80 00       	push   $0x805924
+  804838:	6a 1d                	push   $0x1d
+  80483a:	68 47 59 80 00       	push   $0x805947
+  80483f:	e8 cc b9 ff ff       	call   800210 <_panic>
+}
+  804844:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804847:	5b                   	pop    %ebx
+  804848:	5e                   	pop    %esi
+  804849:	5d                   	pop    %ebp
+  80484a:	c3                   	ret
+
+0080484b <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80484b:	55                   	push   %ebp
+  80484c:	89 e5                	mov    %esp,%ebp
+  80484e:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804851:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  804858:	74 0a                	je     804864 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80485a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80485d:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  804862:	c9                   	leave
+  804863:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804864:	83 ec 04             	sub    $0x4,%esp
+  804867:	6a 07                	push   $0x7
+  804869:	68 00 f0 bf ee       	push   $0xeebff000
+  80486e:	6a 00                	push   $0x0
+  804870:	e8 50 c5 ff ff       	call   800dc5 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804875:	83 c4 08             	add    $0x8,%esp
+  804878:	68 eb 48 80 00       	push   $0x8048eb
+  80487d:	6a 00                	push   $0x0
+  80487f:	e8 a7 c8 ff ff       	call   80112b <sys_env_set_pgfault_upcall>
+  804884:	83 c4 10             	add    $0x10,%esp
+  804887:	eb d1                	jmp    80485a <set_pgfault_handler+0xf>
+
+00804889 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804889:	55                   	push   %ebp
+  80488a:	89 e5                	mov    %esp,%ebp
+  80488c:	83 ec 08             	sub    $0x8,%esp
+  80488f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  804892:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  804898:	b8 00 00 00 00       	mov    $0x0,%eax
+  80489d:	eb 03                	jmp    8048a2 <add_pgfault_handler+0x19>
+  80489f:	83 c0 01             	add    $0x1,%eax
+  8048a2:	39 d0                	cmp    %edx,%eax
+  8048a4:	74 0b                	je     8048b1 <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  8048a6:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  8048ad:	75 f0                	jne    80489f <add_pgfault_handler+0x16>
+  8048af:	eb 24                	jmp    8048d5 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  8048b1:	83 fa 0a             	cmp    $0xa,%edx
+  8048b4:	74 21                	je     8048d7 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  8048b6:	8d 42 01             	lea    0x1(%edx),%eax
+  8048b9:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  8048be:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  8048c5:	83 ec 0c             	sub    $0xc,%esp
+  8048c8:	68 f7 47 80 00       	push   $0x8047f7
+  8048cd:	e8 79 ff ff ff       	call   80484b <set_pgfault_handler>
+  8048d2:	83 c4 10             	add    $0x10,%esp
+}
+  8048d5:	c9                   	leave
+  8048d6:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  8048d7:	83 ec 04             	sub    $0x4,%esp
+  8048da:	68 55 59 80 00       	push   $0x805955
+  8048df:	6a 44                	push   $0x44
+  8048e1:	68 47 59 80 00       	push   $0x805947
+  8048e6:	e8 25 b9 ff ff       	call   800210 <_panic>
+
+008048eb <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8048eb:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8048ec:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  8048f1:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8048f3:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  8048f6:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  8048fa:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  8048fe:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  804901:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  804903:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  804907:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  80490a:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  80490b:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  80490e:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  80490f:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  804910:	c3                   	ret
+
+00804911 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  804911:	55                   	push   %ebp
+  804912:	89 e5                	mov    %esp,%ebp
+  804914:	57                   	push   %edi
+  804915:	56                   	push   %esi
+  804916:	53                   	push   %ebx
+  804917:	83 ec 14             	sub    $0x14,%esp
+  80491a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80491d:	8b 75 14             	mov    0x14(%ebp),%esi
+  804920:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804923:	ff 75 10             	push   0x10(%ebp)
+  804926:	ff 75 0c             	push   0xc(%ebp)
+  804929:	e8 ba c8 ff ff       	call   8011e8 <sys_ipc_recv_pages>
+  80492e:	83 c4 10             	add    $0x10,%esp
+  804931:	85 c0                	test   %eax,%eax
+  804933:	78 46                	js     80497b <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804935:	85 ff                	test   %edi,%edi
+  804937:	74 0d                	je     804946 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804939:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80493e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804944:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804946:	85 f6                	test   %esi,%esi
+  804948:	74 0d                	je     804957 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  80494a:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80494f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804955:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804957:	85 db                	test   %ebx,%ebx
+  804959:	74 0d                	je     804968 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  80495b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804960:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804966:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804968:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80496d:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804973:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804976:	5b                   	pop    %ebx
+  804977:	5e                   	pop    %esi
+  804978:	5f                   	pop    %edi
+  804979:	5d                   	pop    %ebp
+  80497a:	c3                   	ret
+		if (from_env_store) {
+  80497b:	85 ff                	test   %edi,%edi
+  80497d:	74 06                	je     804985 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80497f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804985:	85 f6                	test   %esi,%esi
+  804987:	74 06                	je     80498f <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804989:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80498f:	85 db                	test   %ebx,%ebx
+  804991:	74 e0                	je     804973 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  804993:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804999:	eb d8                	jmp    804973 <ipc_recv_pages+0x62>
+
+0080499b <ipc_recv>:
+{
+  80499b:	55                   	push   %ebp
+  80499c:	89 e5                	mov    %esp,%ebp
+  80499e:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8049a1:	6a 00                	push   $0x0
+  8049a3:	ff 75 10             	push   0x10(%ebp)
+  8049a6:	6a 01                	push   $0x1
+  8049a8:	ff 75 0c             	push   0xc(%ebp)
+  8049ab:	ff 75 08             	push   0x8(%ebp)
+  8049ae:	e8 5e ff ff ff       	call   804911 <ipc_recv_pages>
+}
+  8049b3:	c9                   	leave
+  8049b4:	c3                   	ret
+
+008049b5 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8049b5:	55                   	push   %ebp
+  8049b6:	89 e5                	mov    %esp,%ebp
+  8049b8:	56                   	push   %esi
+  8049b9:	53                   	push   %ebx
+  8049ba:	8b 75 08             	mov    0x8(%ebp),%esi
+  8049bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8049c0:	83 ec 0c             	sub    $0xc,%esp
+  8049c3:	ff 75 0c             	push   0xc(%ebp)
+  8049c6:	e8 51 c9 ff ff       	call   80131c <sys_ipc_try_recv>
+  8049cb:	83 c4 10             	add    $0x10,%esp
+  8049ce:	85 c0                	test   %eax,%eax
+  8049d0:	78 34                	js     804a06 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8049d2:	85 f6                	test   %esi,%esi
+  8049d4:	74 0d                	je     8049e3 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8049d6:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049db:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8049e1:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8049e3:	85 db                	test   %ebx,%ebx
+  8049e5:	74 0d                	je     8049f4 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8049e7:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049ec:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8049f2:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8049f4:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049f9:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8049ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804a02:	5b                   	pop    %ebx
+  804a03:	5e                   	pop    %esi
+  804a04:	5d                   	pop    %ebp
+  804a05:	c3                   	ret
+		if (from_env_store) {
+  804a06:	85 f6                	test   %esi,%esi
+  804a08:	74 06                	je     804a10 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  804a0a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  804a10:	85 db                	test   %ebx,%ebx
+  804a12:	74 eb                	je     8049ff <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  804a14:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804a1a:	eb e3                	jmp    8049ff <ipc_try_recv+0x4a>
+
+00804a1c <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804a1c:	55                   	push   %ebp
+  804a1d:	89 e5                	mov    %esp,%ebp
+  804a1f:	83 ec 14             	sub    $0x14,%esp
+  804a22:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804a25:	85 c0                	test   %eax,%eax
+  804a27:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804a2c:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804a2f:	ff 75 18             	push   0x18(%ebp)
+  804a32:	ff 75 14             	push   0x14(%ebp)
+  804a35:	50                   	push   %eax
+  804a36:	ff 75 0c             	push   0xc(%ebp)
+  804a39:	ff 75 08             	push   0x8(%ebp)
+  804a3c:	e8 6a c7 ff ff       	call   8011ab <sys_ipc_send_pages>
+  804a41:	83 c4 20             	add    $0x20,%esp
+  804a44:	85 c0                	test   %eax,%eax
+  804a46:	78 02                	js     804a4a <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804a48:	c9                   	leave
+  804a49:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804a4a:	50                   	push   %eax
+  804a4b:	68 70 59 80 00       	push   $0x805970
+  804a50:	68 80 00 00 00       	push   $0x80
+  804a55:	68 9c 59 80 00       	push   $0x80599c
+  804a5a:	e8 b1 b7 ff ff       	call   800210 <_panic>
+
+00804a5f <ipc_send>:
+{
+  804a5f:	55                   	push   %ebp
+  804a60:	89 e5                	mov    %esp,%ebp
+  804a62:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  804a65:	ff 75 14             	push   0x14(%ebp)
+  804a68:	6a 01                	push   $0x1
+  804a6a:	ff 75 10             	push   0x10(%ebp)
+  804a6d:	ff 75 0c             	push   0xc(%ebp)
+  804a70:	ff 75 08             	push   0x8(%ebp)
+  804a73:	e8 a4 ff ff ff       	call   804a1c <ipc_send_pages>
+}
+  804a78:	83 c4 20             	add    $0x20,%esp
+  804a7b:	c9                   	leave
+  804a7c:	c3                   	ret
+
+00804a7d <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804a7d:	55                   	push   %ebp
+  804a7e:	89 e5                	mov    %esp,%ebp
+  804a80:	83 ec 14             	sub    $0x14,%esp
+  804a83:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804a86:	85 c0                	test   %eax,%eax
+  804a88:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804a8d:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804a90:	ff 75 18             	push   0x18(%ebp)
+  804a93:	ff 75 14             	push   0x14(%ebp)
+  804a96:	50                   	push   %eax
+  804a97:	ff 75 0c             	push   0xc(%ebp)
+  804a9a:	ff 75 08             	push   0x8(%ebp)
+  804a9d:	e8 9a c7 ff ff       	call   80123c <sys_ipc_call>
+  804aa2:	83 c4 20             	add    $0x20,%esp
+  804aa5:	85 c0                	test   %eax,%eax
+  804aa7:	78 0b                	js     804ab4 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  804aa9:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804aae:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804ab4:	c9                   	leave
+  804ab5:	c3                   	ret
+
+00804ab6 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  804ab6:	55                   	push   %ebp
+  804ab7:	89 e5                	mov    %esp,%ebp
+  804ab9:	57                   	push   %edi
+  804aba:	56                   	push   %esi
+  804abb:	53                   	push   %ebx
+  804abc:	83 ec 18             	sub    $0x18,%esp
+  804abf:	8b 45 10             	mov    0x10(%ebp),%eax
+  804ac2:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  804ac5:	8b 75 20             	mov    0x20(%ebp),%esi
+  804ac8:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804acb:	85 c0                	test   %eax,%eax
+  804acd:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804ad2:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804ad5:	ff 75 18             	push   0x18(%ebp)
+  804ad8:	ff 75 14             	push   0x14(%ebp)
+  804adb:	50                   	push   %eax
+  804adc:	ff 75 0c             	push   0xc(%ebp)
+  804adf:	ff 75 08             	push   0x8(%ebp)
+  804ae2:	e8 96 c7 ff ff       	call   80127d <sys_ipc_reply_recv>
+  804ae7:	83 c4 20             	add    $0x20,%esp
+  804aea:	85 c0                	test   %eax,%eax
+  804aec:	78 46                	js     804b34 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804aee:	85 ff                	test   %edi,%edi
+  804af0:	74 0d                	je     804aff <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  804af2:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804af7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804afd:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804aff:	85 f6                	test   %esi,%esi
+  804b01:	74 0d                	je     804b10 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  804b03:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b08:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804b0e:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804b10:	85 db                	test   %ebx,%ebx
+  804b12:	74 0d                	je     804b21 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  804b14:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b19:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804b1f:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804b21:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b26:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804b2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b2f:	5b                   	pop    %ebx
+  804b30:	5e                   	pop    %esi
+  804b31:	5f                   	pop    %edi
+  804b32:	5d                   	pop    %ebp
+  804b33:	c3                   	ret
+		if (from_env_store) {
+  804b34:	85 ff                	test   %edi,%edi
+  804b36:	74 06                	je     804b3e <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  804b38:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804b3e:	85 f6                	test   %esi,%esi
+  804b40:	74 06                	je     804b48 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  804b42:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804b48:	85 db                	test   %ebx,%ebx
+  804b4a:	74 e0                	je     804b2c <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  804b4c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804b52:	eb d8                	jmp    804b2c <ipc_reply_recv+0x76>
+
+00804b54 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804b54:	55                   	push   %ebp
+  804b55:	89 e5                	mov    %esp,%ebp
+  804b57:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804b5a:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804b5f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804b62:	c1 e0 06             	shl    $0x6,%eax
+  804b65:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804b6a:	8b 40 50             	mov    0x50(%eax),%eax
+  804b6d:	39 c8                	cmp    %ecx,%eax
+  804b6f:	74 12                	je     804b83 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804b71:	83 c2 01             	add    $0x1,%edx
+  804b74:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804b7a:	75 e3                	jne    804b5f <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804b7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b81:	eb 0e                	jmp    804b91 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804b83:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804b86:	c1 e0 06             	shl    $0x6,%eax
+  804b89:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804b8e:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804b91:	5d                   	pop    %ebp
+  804b92:	c3                   	ret
+
+00804b93 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804b93:	55                   	push   %ebp
+  804b94:	89 e5                	mov    %esp,%ebp
+  804b96:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804b99:	89 c2                	mov    %eax,%edx
+  804b9b:	c1 ea 16             	shr    $0x16,%edx
+  804b9e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804ba5:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804baa:	f6 c1 01             	test   $0x1,%cl
+  804bad:	74 1e                	je     804bcd <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  804baf:	c1 e8 0c             	shr    $0xc,%eax
+  804bb2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804bb9:	a8 01                	test   $0x1,%al
+  804bbb:	74 10                	je     804bcd <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804bbd:	c1 e8 0c             	shr    $0xc,%eax
+  804bc0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  804bc3:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  804bca:	0f b7 d2             	movzwl %dx,%edx
+}
+  804bcd:	89 d0                	mov    %edx,%eax
+  804bcf:	5d                   	pop    %ebp
+  804bd0:	c3                   	ret
+
+00804bd1 <udivmod>:
+  804bd1:	55                   	push   %ebp
+  804bd2:	57                   	push   %edi
+  804bd3:	56                   	push   %esi
+  804bd4:	53                   	push   %ebx
+  804bd5:	83 ec 24             	sub    $0x24,%esp
+  804bd8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804bdc:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804be0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804be4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804be8:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804bec:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804bf0:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  804bf4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c03:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804c0a:	00 
+  804c0b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804c12:	00 
+  804c13:	89 fb                	mov    %edi,%ebx
+  804c15:	eb 08                	jmp    804c1f <udivmod+0x4e>
+  804c17:	83 e9 01             	sub    $0x1,%ecx
+  804c1a:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804c1d:	74 68                	je     804c87 <udivmod+0xb6>
+  804c1f:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804c23:	01 c0                	add    %eax,%eax
+  804c25:	89 c6                	mov    %eax,%esi
+  804c27:	89 d7                	mov    %edx,%edi
+  804c29:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804c2d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804c31:	0f ad d0             	shrd   %cl,%edx,%eax
+  804c34:	d3 ea                	shr    %cl,%edx
+  804c36:	f6 c1 20             	test   $0x20,%cl
+  804c39:	74 04                	je     804c3f <udivmod+0x6e>
+  804c3b:	89 d0                	mov    %edx,%eax
+  804c3d:	31 d2                	xor    %edx,%edx
+  804c3f:	83 e0 01             	and    $0x1,%eax
+  804c42:	89 04 24             	mov    %eax,(%esp)
+  804c45:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804c4c:	00 
+  804c4d:	8b 04 24             	mov    (%esp),%eax
+  804c50:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804c54:	09 f0                	or     %esi,%eax
+  804c56:	09 fa                	or     %edi,%edx
+  804c58:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804c5c:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804c60:	39 f0                	cmp    %esi,%eax
+  804c62:	89 d5                	mov    %edx,%ebp
+  804c64:	19 fd                	sbb    %edi,%ebp
+  804c66:	72 af                	jb     804c17 <udivmod+0x46>
+  804c68:	29 f0                	sub    %esi,%eax
+  804c6a:	19 fa                	sbb    %edi,%edx
+  804c6c:	89 cf                	mov    %ecx,%edi
+  804c6e:	c1 ef 05             	shr    $0x5,%edi
+  804c71:	83 e7 01             	and    $0x1,%edi
+  804c74:	89 fe                	mov    %edi,%esi
+  804c76:	83 f6 01             	xor    $0x1,%esi
+  804c79:	d3 e6                	shl    %cl,%esi
+  804c7b:	d3 e7                	shl    %cl,%edi
+  804c7d:	09 74 24 18          	or     %esi,0x18(%esp)
+  804c81:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804c85:	eb 90                	jmp    804c17 <udivmod+0x46>
+  804c87:	85 db                	test   %ebx,%ebx
+  804c89:	74 05                	je     804c90 <udivmod+0xbf>
+  804c8b:	89 03                	mov    %eax,(%ebx)
+  804c8d:	89 53 04             	mov    %edx,0x4(%ebx)
+  804c90:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804c94:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804c98:	83 c4 24             	add    $0x24,%esp
+  804c9b:	5b                   	pop    %ebx
+  804c9c:	5e                   	pop    %esi
+  804c9d:	5f                   	pop    %edi
+  804c9e:	5d                   	pop    %ebp
+  804c9f:	c3                   	ret
+
+00804ca0 <__udivdi3>:
+  804ca0:	83 ec 08             	sub    $0x8,%esp
+  804ca3:	6a 00                	push   $0x0
+  804ca5:	ff 74 24 1c          	push   0x1c(%esp)
+  804ca9:	ff 74 24 1c          	push   0x1c(%esp)
+  804cad:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804cb1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804cb5:	e8 17 ff ff ff       	call   804bd1 <udivmod>
+  804cba:	83 c4 14             	add    $0x14,%esp
+  804cbd:	c3                   	ret
+
+00804cbe <__umoddi3>:
+  804cbe:	83 ec 18             	sub    $0x18,%esp
+  804cc1:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804cc5:	50                   	push   %eax
+  804cc6:	ff 74 24 2c          	push   0x2c(%esp)
+  804cca:	ff 74 24 2c          	push   0x2c(%esp)
+  804cce:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804cd2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804cd6:	e8 f6 fe ff ff       	call   804bd1 <udivmod>
+  804cdb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804cdf:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804ce3:	83 c4 24             	add    $0x24,%esp
+  804ce6:	c3                   	ret
+
+00804ce7 <__divdi3>:
+  804ce7:	55                   	push   %ebp
+  804ce8:	57                   	push   %edi
+  804ce9:	56                   	push   %esi
+  804cea:	53                   	push   %ebx
+  804ceb:	83 ec 10             	sub    $0x10,%esp
+  804cee:	8b 44 24 24          	mov    0x24(%esp),%eax
+  804cf2:	8b 54 24 28          	mov    0x28(%esp),%edx
+  804cf6:	89 c6                	mov    %eax,%esi
+  804cf8:	89 d7                	mov    %edx,%edi
+  804cfa:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  804cfe:	33 7c 24 30          	xor    0x30(%esp),%edi
+  804d02:	89 74 24 04          	mov    %esi,0x4(%esp)
+  804d06:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  804d0a:	89 c5                	mov    %eax,%ebp
+  804d0c:	f7 dd                	neg    %ebp
+  804d0e:	89 d6                	mov    %edx,%esi
+  804d10:	83 d6 00             	adc    $0x0,%esi
+  804d13:	f7 de                	neg    %esi
+  804d15:	0f 48 e8             	cmovs  %eax,%ebp
+  804d18:	0f 49 d6             	cmovns %esi,%edx
+  804d1b:	6a 00                	push   $0x0
+  804d1d:	8b 74 24 30          	mov    0x30(%esp),%esi
+  804d21:	f7 de                	neg    %esi
+  804d23:	8b 44 24 34          	mov    0x34(%esp),%eax
+  804d27:	83 d0 00             	adc    $0x0,%eax
+  804d2a:	f7 d8                	neg    %eax
+  804d2c:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  804d31:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  804d36:	50                   	push   %eax
+  804d37:	56                   	push   %esi
+  804d38:	89 e8                	mov    %ebp,%eax
+  804d3a:	e8 92 fe ff ff       	call   804bd1 <udivmod>
+  804d3f:	83 c4 10             	add    $0x10,%esp
+  804d42:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  804d47:	78 08                	js     804d51 <__divdi3+0x6a>
+  804d49:	83 c4 0c             	add    $0xc,%esp
+  804d4c:	5b                   	pop    %ebx
+  804d4d:	5e                   	pop    %esi
+  804d4e:	5f                   	pop    %edi
+  804d4f:	5d                   	pop    %ebp
+  804d50:	c3                   	ret
+  804d51:	f7 d8                	neg    %eax
+  804d53:	83 d2 00             	adc    $0x0,%edx
+  804d56:	f7 da                	neg    %edx
+  804d58:	eb ef                	jmp    804d49 <__divdi3+0x62>
+
+00804d5a <__moddi3>:
+  804d5a:	55                   	push   %ebp
+  804d5b:	57                   	push   %edi
+  804d5c:	56                   	push   %esi
+  804d5d:	53                   	push   %ebx
+  804d5e:	83 ec 18             	sub    $0x18,%esp
+  804d61:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  804d65:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  804d69:	89 f1                	mov    %esi,%ecx
+  804d6b:	f7 d9                	neg    %ecx
+  804d6d:	89 da                	mov    %ebx,%edx
+  804d6f:	83 d2 00             	adc    $0x0,%edx
+  804d72:	f7 da                	neg    %edx
+  804d74:	0f 48 ce             	cmovs  %esi,%ecx
+  804d77:	0f 48 d3             	cmovs  %ebx,%edx
+  804d7a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804d7e:	50                   	push   %eax
+  804d7f:	8b 74 24 38          	mov    0x38(%esp),%esi
+  804d83:	f7 de                	neg    %esi
+  804d85:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  804d89:	83 d0 00             	adc    $0x0,%eax
+  804d8c:	f7 d8                	neg    %eax
+  804d8e:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  804d93:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  804d98:	50                   	push   %eax
+  804d99:	56                   	push   %esi
+  804d9a:	89 c8                	mov    %ecx,%eax
+  804d9c:	e8 30 fe ff ff       	call   804bd1 <udivmod>
+  804da1:	83 c4 10             	add    $0x10,%esp
+  804da4:	85 db                	test   %ebx,%ebx
+  804da6:	78 10                	js     804db8 <__moddi3+0x5e>
+  804da8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804dac:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804db0:	83 c4 14             	add    $0x14,%esp
+  804db3:	5b                   	pop    %ebx
+  804db4:	5e                   	pop    %esi
+  804db5:	5f                   	pop    %edi
+  804db6:	5d                   	pop    %ebp
+  804db7:	c3                   	ret
+  804db8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804dbc:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804dc0:	f7 d8                	neg    %eax
+  804dc2:	83 d2 00             	adc    $0x0,%edx
+  804dc5:	f7 da                	neg    %edx
+  804dc7:	eb e7                	jmp    804db0 <__moddi3+0x56>
@@ -0,0 +1,6252 @@
+
+obj/user/ls.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9b 02 00 00       	call   8002cc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ls1>:
+		panic("error reading directory %s: %e", path, n);
+}
+
+void
+ls1(const char *prefix, bool isdir, off_t size, const char *name)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	const char *sep;
+
+	if(flag['l'])
+  80003e:	83 3d d0 51 80 00 00 	cmpl   $0x0,0x8051d0
+  800045:	74 20                	je     800067 <ls1+0x34>
+		printf("%11d %c ", size, isdir ? 'd' : '-');
+  800047:	89 f0                	mov    %esi,%eax
+  800049:	3c 01                	cmp    $0x1,%al
+  80004b:	19 c0                	sbb    %eax,%eax
+  80004d:	83 e0 c9             	and    $0xffffffc9,%eax
+  800050:	83 c0 64             	add    $0x64,%eax
+  800053:	83 ec 04             	sub    $0x4,%esp
+  800056:	50                   	push   %eax
+  800057:	ff 75 10             	push   0x10(%ebp)
+  80005a:	68 82 2b 80 00       	push   $0x802b82
+  80005f:	e8 e5 1f 00 00       	call   802049 <printf>
+  800064:	83 c4 10             	add    $0x10,%esp
+	if(prefix) {
+  800067:	85 db                	test   %ebx,%ebx
+  800069:	74 1c                	je     800087 <ls1+0x54>
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+			sep = "/";
+		else
+			sep = "";
+  80006b:	b8 e8 2b 80 00       	mov    $0x802be8,%eax
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  800070:	80 3b 00             	cmpb   $0x0,(%ebx)
+  800073:	75 4b                	jne    8000c0 <ls1+0x8d>
+		printf("%s%s", prefix, sep);
+  800075:	83 ec 04             	sub    $0x4,%esp
+  800078:	50                   	push   %eax
+  800079:	53                   	push   %ebx
+  80007a:	68 8b 2b 80 00       	push   $0x802b8b
+  80007f:	e8 c5 1f 00 00       	call   802049 <printf>
+  800084:	83 c4 10             	add    $0x10,%esp
+	}
+	printf("%s", name);
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	ff 75 14             	push   0x14(%ebp)
+  80008d:	68 5d 30 80 00       	push   $0x80305d
+  800092:	e8 b2 1f 00 00       	call   802049 <printf>
+	if(flag['F'] && isdir)
+  800097:	83 c4 10             	add    $0x10,%esp
+  80009a:	83 3d 38 51 80 00 00 	cmpl   $0x0,0x805138
+  8000a1:	74 06                	je     8000a9 <ls1+0x76>
+  8000a3:	89 f0                	mov    %esi,%eax
+  8000a5:	84 c0                	test   %al,%al
+  8000a7:	75 37                	jne    8000e0 <ls1+0xad>
+		printf("/");
+	printf("\n");
+  8000a9:	83 ec 0c             	sub    $0xc,%esp
+  8000ac:	68 e7 2b 80 00       	push   $0x802be7
+  8000b1:	e8 93 1f 00 00       	call   802049 <printf>
+}
+  8000b6:	83 c4 10             	add    $0x10,%esp
+  8000b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000bc:	5b                   	pop    %ebx
+  8000bd:	5e                   	pop    %esi
+  8000be:	5d                   	pop    %ebp
+  8000bf:	c3                   	ret
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  8000c0:	83 ec 0c             	sub    $0xc,%esp
+  8000c3:	53                   	push   %ebx
+  8000c4:	e8 ed 08 00 00       	call   8009b6 <strlen>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+			sep = "/";
+  8000cc:	80 7c 03 ff 2f       	cmpb   $0x2f,-0x1(%ebx,%eax,1)
+  8000d1:	b8 e8 2b 80 00       	mov    $0x802be8,%eax
+  8000d6:	ba 80 2b 80 00       	mov    $0x802b80,%edx
+  8000db:	0f 45 c2             	cmovne %edx,%eax
+  8000de:	eb 95                	jmp    800075 <ls1+0x42>
+		printf("/");
+  8000e0:	83 ec 0c             	sub    $0xc,%esp
+  8000e3:	68 80 2b 80 00       	push   $0x802b80
+  8000e8:	e8 5c 1f 00 00       	call   802049 <printf>
+  8000ed:	83 c4 10             	add    $0x10,%esp
+  8000f0:	eb b7                	jmp    8000a9 <ls1+0x76>
+
+008000f2 <lsdir>:
+{
+  8000f2:	55                   	push   %ebp
+  8000f3:	89 e5                	mov    %esp,%ebp
+  8000f5:	57                   	push   %edi
+  8000f6:	56                   	push   %esi
+  8000f7:	53                   	push   %ebx
+  8000f8:	81 ec 14 01 00 00    	sub    $0x114,%esp
+  8000fe:	8b 7d 08             	mov    0x8(%ebp),%edi
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800101:	6a 00                	push   $0x0
+  800103:	57                   	push   %edi
+  800104:	e8 da 1c 00 00       	call   801de3 <open>
+  800109:	89 c3                	mov    %eax,%ebx
+  80010b:	83 c4 10             	add    $0x10,%esp
+  80010e:	85 c0                	test   %eax,%eax
+  800110:	78 50                	js     800162 <lsdir+0x70>
+	while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+  800112:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  800118:	83 ec 04             	sub    $0x4,%esp
+  80011b:	68 00 01 00 00       	push   $0x100
+  800120:	56                   	push   %esi
+  800121:	53                   	push   %ebx
+  800122:	e8 08 18 00 00       	call   80192f <readn>
+  800127:	83 c4 10             	add    $0x10,%esp
+  80012a:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80012f:	75 47                	jne    800178 <lsdir+0x86>
+		if (f.f_name[0])
+  800131:	80 bd e8 fe ff ff 00 	cmpb   $0x0,-0x118(%ebp)
+  800138:	74 de                	je     800118 <lsdir+0x26>
+			ls1(prefix, f.f_type==FTYPE_DIR, f.f_size, f.f_name);
+  80013a:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  800140:	50                   	push   %eax
+  800141:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+  800147:	83 bd 6c ff ff ff 01 	cmpl   $0x1,-0x94(%ebp)
+  80014e:	0f 94 c0             	sete   %al
+  800151:	0f b6 c0             	movzbl %al,%eax
+  800154:	50                   	push   %eax
+  800155:	ff 75 0c             	push   0xc(%ebp)
+  800158:	e8 d6 fe ff ff       	call   800033 <ls1>
+  80015d:	83 c4 10             	add    $0x10,%esp
+  800160:	eb b6                	jmp    800118 <lsdir+0x26>
+		panic("open %s: %e", path, fd);
+  800162:	83 ec 0c             	sub    $0xc,%esp
+  800165:	50                   	push   %eax
+  800166:	57                   	push   %edi
+  800167:	68 90 2b 80 00       	push   $0x802b90
+  80016c:	6a 1d                	push   $0x1d
+  80016e:	68 9c 2b 80 00       	push   $0x802b9c
+  800173:	e8 b7 01 00 00       	call   80032f <_panic>
+	if (n > 0)
+  800178:	85 c0                	test   %eax,%eax
+  80017a:	7f 0a                	jg     800186 <lsdir+0x94>
+	if (n < 0)
+  80017c:	78 1a                	js     800198 <lsdir+0xa6>
+}
+  80017e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800181:	5b                   	pop    %ebx
+  800182:	5e                   	pop    %esi
+  800183:	5f                   	pop    %edi
+  800184:	5d                   	pop    %ebp
+  800185:	c3                   	ret
+		panic("short read in directory %s", path);
+  800186:	57                   	push   %edi
+  800187:	68 a6 2b 80 00       	push   $0x802ba6
+  80018c:	6a 22                	push   $0x22
+  80018e:	68 9c 2b 80 00       	push   $0x802b9c
+  800193:	e8 97 01 00 00       	call   80032f <_panic>
+		panic("error reading directory %s: %e", path, n);
+  800198:	83 ec 0c             	sub    $0xc,%esp
+  80019b:	50                   	push   %eax
+  80019c:	57                   	push   %edi
+  80019d:	68 ec 2b 80 00       	push   $0x802bec
+  8001a2:	6a 24                	push   $0x24
+  8001a4:	68 9c 2b 80 00       	push   $0x802b9c
+  8001a9:	e8 81 01 00 00       	call   80032f <_panic>
+
+008001ae <ls>:
+{
+  8001ae:	55                   	push   %ebp
+  8001af:	89 e5                	mov    %esp,%ebp
+  8001b1:	53                   	push   %ebx
+  8001b2:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8001b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = stat(path, &st)) < 0)
+  8001bb:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  8001c1:	50                   	push   %eax
+  8001c2:	53                   	push   %ebx
+  8001c3:	e8 4d 19 00 00       	call   801b15 <stat>
+  8001c8:	83 c4 10             	add    $0x10,%esp
+  8001cb:	85 c0                	test   %eax,%eax
+  8001cd:	78 2c                	js     8001fb <ls+0x4d>
+	if (st.st_isdir && !flag['d'])
+  8001cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8001d2:	85 c0                	test   %eax,%eax
+  8001d4:	74 09                	je     8001df <ls+0x31>
+  8001d6:	83 3d b0 51 80 00 00 	cmpl   $0x0,0x8051b0
+  8001dd:	74 32                	je     800211 <ls+0x63>
+		ls1(0, st.st_isdir, st.st_size, path);
+  8001df:	53                   	push   %ebx
+  8001e0:	ff 75 ec             	push   -0x14(%ebp)
+  8001e3:	85 c0                	test   %eax,%eax
+  8001e5:	0f 95 c0             	setne  %al
+  8001e8:	0f b6 c0             	movzbl %al,%eax
+  8001eb:	50                   	push   %eax
+  8001ec:	6a 00                	push   $0x0
+  8001ee:	e8 40 fe ff ff       	call   800033 <ls1>
+  8001f3:	83 c4 10             	add    $0x10,%esp
+}
+  8001f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001f9:	c9                   	leave
+  8001fa:	c3                   	ret
+		panic("stat %s: %e", path, r);
+  8001fb:	83 ec 0c             	sub    $0xc,%esp
+  8001fe:	50                   	push   %eax
+  8001ff:	53                   	push   %ebx
+  800200:	68 c1 2b 80 00       	push   $0x802bc1
+  800205:	6a 0f                	push   $0xf
+  800207:	68 9c 2b 80 00       	push   $0x802b9c
+  80020c:	e8 1e 01 00 00       	call   80032f <_panic>
+		lsdir(path, prefix);
+  800211:	83 ec 08             	sub    $0x8,%esp
+  800214:	ff 75 0c             	push   0xc(%ebp)
+  800217:	53                   	push   %ebx
+  800218:	e8 d5 fe ff ff       	call   8000f2 <lsdir>
+  80021d:	83 c4 10             	add    $0x10,%esp
+  800220:	eb d4                	jmp    8001f6 <ls+0x48>
+
+00800222 <usage>:
+
+void
+usage(void)
+{
+  800222:	55                   	push   %ebp
+  800223:	89 e5                	mov    %esp,%ebp
+  800225:	83 ec 14             	sub    $0x14,%esp
+	printf("usage: ls [-dFl] [file...]\n");
+  800228:	68 cd 2b 80 00       	push   $0x802bcd
+  80022d:	e8 17 1e 00 00       	call   802049 <printf>
+	exit();
+  800232:	e8 de 00 00 00       	call   800315 <exit>
+}
+  800237:	83 c4 10             	add    $0x10,%esp
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+0080023c <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	56                   	push   %esi
+  800240:	53                   	push   %ebx
+  800241:	83 ec 14             	sub    $0x14,%esp
+  800244:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int i;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  800247:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  80024a:	50                   	push   %eax
+  80024b:	56                   	push   %esi
+  80024c:	8d 45 08             	lea    0x8(%ebp),%eax
+  80024f:	50                   	push   %eax
+  800250:	e8 2a 12 00 00       	call   80147f <argstart>
+	while ((i = argnext(&args)) >= 0)
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	8d 5d e8             	lea    -0x18(%ebp),%ebx
+  80025b:	eb 08                	jmp    800265 <umain+0x29>
+		switch (i) {
+		case 'd':
+		case 'F':
+		case 'l':
+			flag[i]++;
+  80025d:	83 04 85 20 50 80 00 	addl   $0x1,0x805020(,%eax,4)
+  800264:	01 
+	while ((i = argnext(&args)) >= 0)
+  800265:	83 ec 0c             	sub    $0xc,%esp
+  800268:	53                   	push   %ebx
+  800269:	e8 41 12 00 00       	call   8014af <argnext>
+  80026e:	83 c4 10             	add    $0x10,%esp
+  800271:	85 c0                	test   %eax,%eax
+  800273:	78 16                	js     80028b <umain+0x4f>
+		switch (i) {
+  800275:	89 c2                	mov    %eax,%edx
+  800277:	83 e2 f7             	and    $0xfffffff7,%edx
+  80027a:	83 fa 64             	cmp    $0x64,%edx
+  80027d:	74 de                	je     80025d <umain+0x21>
+  80027f:	83 f8 46             	cmp    $0x46,%eax
+  800282:	74 d9                	je     80025d <umain+0x21>
+			break;
+		default:
+			usage();
+  800284:	e8 99 ff ff ff       	call   800222 <usage>
+  800289:	eb da                	jmp    800265 <umain+0x29>
+		}
+
+	if (argc == 1)
+		ls("/", "");
+	else {
+		for (i = 1; i < argc; i++)
+  80028b:	bb 01 00 00 00       	mov    $0x1,%ebx
+	if (argc == 1)
+  800290:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800294:	75 2a                	jne    8002c0 <umain+0x84>
+		ls("/", "");
+  800296:	83 ec 08             	sub    $0x8,%esp
+  800299:	68 e8 2b 80 00       	push   $0x802be8
+  80029e:	68 80 2b 80 00       	push   $0x802b80
+  8002a3:	e8 06 ff ff ff       	call   8001ae <ls>
+  8002a8:	83 c4 10             	add    $0x10,%esp
+  8002ab:	eb 18                	jmp    8002c5 <umain+0x89>
+			ls(argv[i], argv[i]);
+  8002ad:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  8002b0:	83 ec 08             	sub    $0x8,%esp
+  8002b3:	50                   	push   %eax
+  8002b4:	50                   	push   %eax
+  8002b5:	e8 f4 fe ff ff       	call   8001ae <ls>
+		for (i = 1; i < argc; i++)
+  8002ba:	83 c3 01             	add    $0x1,%ebx
+  8002bd:	83 c4 10             	add    $0x10,%esp
+  8002c0:	39 5d 08             	cmp    %ebx,0x8(%ebp)
+  8002c3:	7f e8                	jg     8002ad <umain+0x71>
+	}
+}
+  8002c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002c8:	5b                   	pop    %ebx
+  8002c9:	5e                   	pop    %esi
+  8002ca:	5d                   	pop    %ebp
+  8002cb:	c3                   	ret
+
+008002cc <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002cc:	55                   	push   %ebp
+  8002cd:	89 e5                	mov    %esp,%ebp
+  8002cf:	56                   	push   %esi
+  8002d0:	53                   	push   %ebx
+  8002d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002d4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8002d7:	e8 ca 0b 00 00       	call   800ea6 <sys_getenvid>
+  8002dc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002e1:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002e4:	c1 e0 06             	shl    $0x6,%eax
+  8002e7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002ec:	a3 24 54 80 00       	mov    %eax,0x805424
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002f1:	85 db                	test   %ebx,%ebx
+  8002f3:	7e 07                	jle    8002fc <libmain+0x30>
+		binaryname = argv[0];
+  8002f5:	8b 06                	mov    (%esi),%eax
+  8002f7:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8002fc:	83 ec 08             	sub    $0x8,%esp
+  8002ff:	56                   	push   %esi
+  800300:	53                   	push   %ebx
+  800301:	e8 36 ff ff ff       	call   80023c <umain>
+
+	// exit gracefully
+	exit();
+  800306:	e8 0a 00 00 00       	call   800315 <exit>
+}
+  80030b:	83 c4 10             	add    $0x10,%esp
+  80030e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800311:	5b                   	pop    %ebx
+  800312:	5e                   	pop    %esi
+  800313:	5d                   	pop    %ebp
+  800314:	c3                   	ret
+
+00800315 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800315:	55                   	push   %ebp
+  800316:	89 e5                	mov    %esp,%ebp
+  800318:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80031b:	e8 79 14 00 00       	call   801799 <close_all>
+	sys_env_destroy(0);
+  800320:	83 ec 0c             	sub    $0xc,%esp
+  800323:	6a 00                	push   $0x0
+  800325:	e8 3b 0b 00 00       	call   800e65 <sys_env_destroy>
+}
+  80032a:	83 c4 10             	add    $0x10,%esp
+  80032d:	c9                   	leave
+  80032e:	c3                   	ret
+
+0080032f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80032f:	55                   	push   %ebp
+  800330:	89 e5                	mov    %esp,%ebp
+  800332:	56                   	push   %esi
+  800333:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800334:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800337:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80033d:	e8 64 0b 00 00       	call   800ea6 <sys_getenvid>
+  800342:	83 ec 0c             	sub    $0xc,%esp
+  800345:	ff 75 0c             	push   0xc(%ebp)
+  800348:	ff 75 08             	push   0x8(%ebp)
+  80034b:	56                   	push   %esi
+  80034c:	50                   	push   %eax
+  80034d:	68 18 2c 80 00       	push   $0x802c18
+  800352:	e8 b3 00 00 00       	call   80040a <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800357:	83 c4 18             	add    $0x18,%esp
+  80035a:	53                   	push   %ebx
+  80035b:	ff 75 10             	push   0x10(%ebp)
+  80035e:	e8 56 00 00 00       	call   8003b9 <vcprintf>
+	cprintf("\n");
+  800363:	c7 04 24 e7 2b 80 00 	movl   $0x802be7,(%esp)
+  80036a:	e8 9b 00 00 00       	call   80040a <cprintf>
+  80036f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800372:	cc                   	int3
+	while (1)
+  800373:	eb fd                	jmp    800372 <_panic+0x43>
+
+00800375 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800375:	55                   	push   %ebp
+  800376:	89 e5                	mov    %esp,%ebp
+  800378:	53                   	push   %ebx
+  800379:	83 ec 04             	sub    $0x4,%esp
+  80037c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80037f:	8b 13                	mov    (%ebx),%edx
+  800381:	8d 42 01             	lea    0x1(%edx),%eax
+  800384:	89 03                	mov    %eax,(%ebx)
+  800386:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800389:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80038d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800392:	74 09                	je     80039d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800394:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800398:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80039b:	c9                   	leave
+  80039c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80039d:	83 ec 08             	sub    $0x8,%esp
+  8003a0:	68 ff 00 00 00       	push   $0xff
+  8003a5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003a8:	50                   	push   %eax
+  8003a9:	e8 69 0a 00 00       	call   800e17 <sys_cputs>
+		b->idx = 0;
+  8003ae:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003b4:	83 c4 10             	add    $0x10,%esp
+  8003b7:	eb db                	jmp    800394 <putch+0x1f>
+
+008003b9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003b9:	55                   	push   %ebp
+  8003ba:	89 e5                	mov    %esp,%ebp
+  8003bc:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003c2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003c9:	00 00 00 
+	b.cnt = 0;
+  8003cc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003d3:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8003d6:	ff 75 0c             	push   0xc(%ebp)
+  8003d9:	ff 75 08             	push   0x8(%ebp)
+  8003dc:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003e2:	50                   	push   %eax
+  8003e3:	68 75 03 80 00       	push   $0x800375
+  8003e8:	e8 14 01 00 00       	call   800501 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8003ed:	83 c4 08             	add    $0x8,%esp
+  8003f0:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003f6:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003fc:	50                   	push   %eax
+  8003fd:	e8 15 0a 00 00       	call   800e17 <sys_cputs>
+
+	return b.cnt;
+}
+  800402:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800408:	c9                   	leave
+  800409:	c3                   	ret
+
+0080040a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80040a:	55                   	push   %ebp
+  80040b:	89 e5                	mov    %esp,%ebp
+  80040d:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800410:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800413:	50                   	push   %eax
+  800414:	ff 75 08             	push   0x8(%ebp)
+  800417:	e8 9d ff ff ff       	call   8003b9 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80041c:	c9                   	leave
+  80041d:	c3                   	ret
+
+0080041e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80041e:	55                   	push   %ebp
+  80041f:	89 e5                	mov    %esp,%ebp
+  800421:	57                   	push   %edi
+  800422:	56                   	push   %esi
+  800423:	53                   	push   %ebx
+  800424:	83 ec 1c             	sub    $0x1c,%esp
+  800427:	89 c7                	mov    %eax,%edi
+  800429:	89 d6                	mov    %edx,%esi
+  80042b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80042e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800431:	89 d1                	mov    %edx,%ecx
+  800433:	89 c2                	mov    %eax,%edx
+  800435:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800438:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80043b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80043e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800441:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800444:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80044b:	39 c2                	cmp    %eax,%edx
+  80044d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800450:	72 3e                	jb     800490 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800452:	83 ec 0c             	sub    $0xc,%esp
+  800455:	ff 75 18             	push   0x18(%ebp)
+  800458:	83 eb 01             	sub    $0x1,%ebx
+  80045b:	53                   	push   %ebx
+  80045c:	50                   	push   %eax
+  80045d:	83 ec 08             	sub    $0x8,%esp
+  800460:	ff 75 e4             	push   -0x1c(%ebp)
+  800463:	ff 75 e0             	push   -0x20(%ebp)
+  800466:	ff 75 dc             	push   -0x24(%ebp)
+  800469:	ff 75 d8             	push   -0x28(%ebp)
+  80046c:	e8 e0 25 00 00       	call   802a51 <__udivdi3>
+  800471:	83 c4 18             	add    $0x18,%esp
+  800474:	52                   	push   %edx
+  800475:	50                   	push   %eax
+  800476:	89 f2                	mov    %esi,%edx
+  800478:	89 f8                	mov    %edi,%eax
+  80047a:	e8 9f ff ff ff       	call   80041e <printnum>
+  80047f:	83 c4 20             	add    $0x20,%esp
+  800482:	eb 13                	jmp    800497 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800484:	83 ec 08             	sub    $0x8,%esp
+  800487:	56                   	push   %esi
+  800488:	ff 75 18             	push   0x18(%ebp)
+  80048b:	ff d7                	call   *%edi
+  80048d:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800490:	83 eb 01             	sub    $0x1,%ebx
+  800493:	85 db                	test   %ebx,%ebx
+  800495:	7f ed                	jg     800484 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800497:	83 ec 08             	sub    $0x8,%esp
+  80049a:	56                   	push   %esi
+  80049b:	83 ec 04             	sub    $0x4,%esp
+  80049e:	ff 75 e4             	push   -0x1c(%ebp)
+  8004a1:	ff 75 e0             	push   -0x20(%ebp)
+  8004a4:	ff 75 dc             	push   -0x24(%ebp)
+  8004a7:	ff 75 d8             	push   -0x28(%ebp)
+  8004aa:	e8 c0 25 00 00       	call   802a6f <__umoddi3>
+  8004af:	83 c4 14             	add    $0x14,%esp
+  8004b2:	0f be 80 3b 2c 80 00 	movsbl 0x802c3b(%eax),%eax
+  8004b9:	50                   	push   %eax
+  8004ba:	ff d7                	call   *%edi
+}
+  8004bc:	83 c4 10             	add    $0x10,%esp
+  8004bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c2:	5b                   	pop    %ebx
+  8004c3:	5e                   	pop    %esi
+  8004c4:	5f                   	pop    %edi
+  8004c5:	5d                   	pop    %ebp
+  8004c6:	c3                   	ret
+
+008004c7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004c7:	55                   	push   %ebp
+  8004c8:	89 e5                	mov    %esp,%ebp
+  8004ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8004cd:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8004d1:	8b 10                	mov    (%eax),%edx
+  8004d3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004d6:	73 0a                	jae    8004e2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8004d8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004db:	89 08                	mov    %ecx,(%eax)
+  8004dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004e0:	88 02                	mov    %al,(%edx)
+}
+  8004e2:	5d                   	pop    %ebp
+  8004e3:	c3                   	ret
+
+008004e4 <printfmt>:
+{
+  8004e4:	55                   	push   %ebp
+  8004e5:	89 e5                	mov    %esp,%ebp
+  8004e7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8004ea:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8004ed:	50                   	push   %eax
+  8004ee:	ff 75 10             	push   0x10(%ebp)
+  8004f1:	ff 75 0c             	push   0xc(%ebp)
+  8004f4:	ff 75 08             	push   0x8(%ebp)
+  8004f7:	e8 05 00 00 00       	call   800501 <vprintfmt>
+}
+  8004fc:	83 c4 10             	add    $0x10,%esp
+  8004ff:	c9                   	leave
+  800500:	c3                   	ret
+
+00800501 <vprintfmt>:
+{
+  800501:	55                   	push   %ebp
+  800502:	89 e5                	mov    %esp,%ebp
+  800504:	57                   	push   %edi
+  800505:	56                   	push   %esi
+  800506:	53                   	push   %ebx
+  800507:	83 ec 2c             	sub    $0x2c,%esp
+  80050a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800510:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800513:	eb 0a                	jmp    80051f <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800515:	83 ec 08             	sub    $0x8,%esp
+  800518:	53                   	push   %ebx
+  800519:	50                   	push   %eax
+  80051a:	ff d6                	call   *%esi
+  80051c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80051f:	83 c7 01             	add    $0x1,%edi
+  800522:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800526:	83 f8 25             	cmp    $0x25,%eax
+  800529:	74 0c                	je     800537 <vprintfmt+0x36>
+			if (ch == '\0')
+  80052b:	85 c0                	test   %eax,%eax
+  80052d:	75 e6                	jne    800515 <vprintfmt+0x14>
+}
+  80052f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800532:	5b                   	pop    %ebx
+  800533:	5e                   	pop    %esi
+  800534:	5f                   	pop    %edi
+  800535:	5d                   	pop    %ebp
+  800536:	c3                   	ret
+		padc = ' ';
+  800537:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80053b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800542:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800549:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800550:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800555:	8d 47 01             	lea    0x1(%edi),%eax
+  800558:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80055b:	0f b6 17             	movzbl (%edi),%edx
+  80055e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800561:	3c 55                	cmp    $0x55,%al
+  800563:	0f 87 c5 03 00 00    	ja     80092e <vprintfmt+0x42d>
+  800569:	0f b6 c0             	movzbl %al,%eax
+  80056c:	ff 24 85 c0 2d 80 00 	jmp    *0x802dc0(,%eax,4)
+  800573:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800576:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80057a:	eb d9                	jmp    800555 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80057c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80057f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800583:	eb d0                	jmp    800555 <vprintfmt+0x54>
+  800585:	0f b6 d2             	movzbl %dl,%edx
+  800588:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80058b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800590:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800593:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800596:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80059a:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80059d:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005a0:	83 f9 09             	cmp    $0x9,%ecx
+  8005a3:	77 55                	ja     8005fa <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8005a5:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8005a8:	eb e9                	jmp    800593 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8005aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ad:	8b 00                	mov    (%eax),%eax
+  8005af:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b8:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005bb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8005be:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005c2:	79 91                	jns    800555 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8005c4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005c7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005ca:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005d1:	eb 82                	jmp    800555 <vprintfmt+0x54>
+			if (width < 0)
+  8005d3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005d6:	85 d2                	test   %edx,%edx
+  8005d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005dd:	0f 49 c2             	cmovns %edx,%eax
+  8005e0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005e3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005e6:	e9 6a ff ff ff       	jmp    800555 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8005ee:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005f5:	e9 5b ff ff ff       	jmp    800555 <vprintfmt+0x54>
+  8005fa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005fd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800600:	eb bc                	jmp    8005be <vprintfmt+0xbd>
+			lflag++;
+  800602:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800605:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800608:	e9 48 ff ff ff       	jmp    800555 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80060d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800610:	8d 78 04             	lea    0x4(%eax),%edi
+  800613:	83 ec 08             	sub    $0x8,%esp
+  800616:	53                   	push   %ebx
+  800617:	ff 30                	push   (%eax)
+  800619:	ff d6                	call   *%esi
+			break;
+  80061b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80061e:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800621:	e9 63 02 00 00       	jmp    800889 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800626:	8b 45 14             	mov    0x14(%ebp),%eax
+  800629:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80062c:	8b 10                	mov    (%eax),%edx
+  80062e:	89 d0                	mov    %edx,%eax
+  800630:	f7 d8                	neg    %eax
+  800632:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800635:	83 f8 12             	cmp    $0x12,%eax
+  800638:	7f 23                	jg     80065d <vprintfmt+0x15c>
+  80063a:	8b 14 85 20 2f 80 00 	mov    0x802f20(,%eax,4),%edx
+  800641:	85 d2                	test   %edx,%edx
+  800643:	74 18                	je     80065d <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800645:	52                   	push   %edx
+  800646:	68 5d 30 80 00       	push   $0x80305d
+  80064b:	53                   	push   %ebx
+  80064c:	56                   	push   %esi
+  80064d:	e8 92 fe ff ff       	call   8004e4 <printfmt>
+  800652:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800655:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800658:	e9 2c 02 00 00       	jmp    800889 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80065d:	50                   	push   %eax
+  80065e:	68 53 2c 80 00       	push   $0x802c53
+  800663:	53                   	push   %ebx
+  800664:	56                   	push   %esi
+  800665:	e8 7a fe ff ff       	call   8004e4 <printfmt>
+  80066a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80066d:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800670:	e9 14 02 00 00       	jmp    800889 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800675:	8b 45 14             	mov    0x14(%ebp),%eax
+  800678:	83 c0 04             	add    $0x4,%eax
+  80067b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80067e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800681:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800683:	85 c9                	test   %ecx,%ecx
+  800685:	b8 4c 2c 80 00       	mov    $0x802c4c,%eax
+  80068a:	0f 45 c1             	cmovne %ecx,%eax
+  80068d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800690:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800694:	7e 06                	jle    80069c <vprintfmt+0x19b>
+  800696:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80069a:	75 0b                	jne    8006a7 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80069c:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80069f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006a2:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006a5:	eb 5c                	jmp    800703 <vprintfmt+0x202>
+  8006a7:	83 ec 08             	sub    $0x8,%esp
+  8006aa:	ff 75 d0             	push   -0x30(%ebp)
+  8006ad:	ff 75 cc             	push   -0x34(%ebp)
+  8006b0:	e8 19 03 00 00       	call   8009ce <strnlen>
+  8006b5:	89 c2                	mov    %eax,%edx
+  8006b7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006ba:	29 d0                	sub    %edx,%eax
+  8006bc:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8006bf:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006c3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006c6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006c9:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006cb:	eb 0e                	jmp    8006db <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8006cd:	83 ec 08             	sub    $0x8,%esp
+  8006d0:	53                   	push   %ebx
+  8006d1:	57                   	push   %edi
+  8006d2:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006d5:	83 ee 01             	sub    $0x1,%esi
+  8006d8:	83 c4 10             	add    $0x10,%esp
+  8006db:	85 f6                	test   %esi,%esi
+  8006dd:	7f ee                	jg     8006cd <vprintfmt+0x1cc>
+  8006df:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006e2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006e5:	85 c0                	test   %eax,%eax
+  8006e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006ec:	0f 49 d0             	cmovns %eax,%edx
+  8006ef:	29 d0                	sub    %edx,%eax
+  8006f1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006f4:	eb a6                	jmp    80069c <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8006f6:	83 ec 08             	sub    $0x8,%esp
+  8006f9:	53                   	push   %ebx
+  8006fa:	52                   	push   %edx
+  8006fb:	ff 55 08             	call   *0x8(%ebp)
+  8006fe:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800701:	89 f1                	mov    %esi,%ecx
+  800703:	8d 71 01             	lea    0x1(%ecx),%esi
+  800706:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80070a:	0f be d0             	movsbl %al,%edx
+  80070d:	85 d2                	test   %edx,%edx
+  80070f:	74 28                	je     800739 <vprintfmt+0x238>
+  800711:	85 ff                	test   %edi,%edi
+  800713:	78 05                	js     80071a <vprintfmt+0x219>
+  800715:	83 ef 01             	sub    $0x1,%edi
+  800718:	78 30                	js     80074a <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80071a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80071e:	74 d6                	je     8006f6 <vprintfmt+0x1f5>
+  800720:	0f be c0             	movsbl %al,%eax
+  800723:	83 e8 20             	sub    $0x20,%eax
+  800726:	83 f8 5e             	cmp    $0x5e,%eax
+  800729:	76 cb                	jbe    8006f6 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80072b:	83 ec 08             	sub    $0x8,%esp
+  80072e:	53                   	push   %ebx
+  80072f:	6a 3f                	push   $0x3f
+  800731:	ff 55 08             	call   *0x8(%ebp)
+  800734:	83 c4 10             	add    $0x10,%esp
+  800737:	eb c8                	jmp    800701 <vprintfmt+0x200>
+  800739:	8b 75 08             	mov    0x8(%ebp),%esi
+  80073c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80073f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800742:	01 d0                	add    %edx,%eax
+  800744:	29 c8                	sub    %ecx,%eax
+  800746:	89 c7                	mov    %eax,%edi
+  800748:	eb 13                	jmp    80075d <vprintfmt+0x25c>
+  80074a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80074d:	eb ed                	jmp    80073c <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80074f:	83 ec 08             	sub    $0x8,%esp
+  800752:	53                   	push   %ebx
+  800753:	6a 20                	push   $0x20
+  800755:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800757:	83 ef 01             	sub    $0x1,%edi
+  80075a:	83 c4 10             	add    $0x10,%esp
+  80075d:	85 ff                	test   %edi,%edi
+  80075f:	7f ee                	jg     80074f <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800761:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800764:	89 45 14             	mov    %eax,0x14(%ebp)
+  800767:	e9 1d 01 00 00       	jmp    800889 <vprintfmt+0x388>
+	if (lflag >= 2)
+  80076c:	83 f9 01             	cmp    $0x1,%ecx
+  80076f:	7f 1b                	jg     80078c <vprintfmt+0x28b>
+	else if (lflag)
+  800771:	85 c9                	test   %ecx,%ecx
+  800773:	74 63                	je     8007d8 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800775:	8b 45 14             	mov    0x14(%ebp),%eax
+  800778:	8b 00                	mov    (%eax),%eax
+  80077a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80077d:	99                   	cltd
+  80077e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800781:	8b 45 14             	mov    0x14(%ebp),%eax
+  800784:	8d 40 04             	lea    0x4(%eax),%eax
+  800787:	89 45 14             	mov    %eax,0x14(%ebp)
+  80078a:	eb 17                	jmp    8007a3 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80078c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078f:	8b 50 04             	mov    0x4(%eax),%edx
+  800792:	8b 00                	mov    (%eax),%eax
+  800794:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800797:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80079a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079d:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007a3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007a6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8007a9:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8007ae:	85 c9                	test   %ecx,%ecx
+  8007b0:	0f 89 b9 00 00 00    	jns    80086f <vprintfmt+0x36e>
+				putch('-', putdat);
+  8007b6:	83 ec 08             	sub    $0x8,%esp
+  8007b9:	53                   	push   %ebx
+  8007ba:	6a 2d                	push   $0x2d
+  8007bc:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8007be:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007c1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007c4:	f7 da                	neg    %edx
+  8007c6:	83 d1 00             	adc    $0x0,%ecx
+  8007c9:	f7 d9                	neg    %ecx
+  8007cb:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007ce:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007d3:	e9 97 00 00 00       	jmp    80086f <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8007d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007db:	8b 00                	mov    (%eax),%eax
+  8007dd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007e0:	99                   	cltd
+  8007e1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ea:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ed:	eb b4                	jmp    8007a3 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8007ef:	83 f9 01             	cmp    $0x1,%ecx
+  8007f2:	7f 1b                	jg     80080f <vprintfmt+0x30e>
+	else if (lflag)
+  8007f4:	85 c9                	test   %ecx,%ecx
+  8007f6:	74 2c                	je     800824 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8007f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fb:	8b 10                	mov    (%eax),%edx
+  8007fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800802:	8d 40 04             	lea    0x4(%eax),%eax
+  800805:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800808:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80080d:	eb 60                	jmp    80086f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80080f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800812:	8b 10                	mov    (%eax),%edx
+  800814:	8b 48 04             	mov    0x4(%eax),%ecx
+  800817:	8d 40 08             	lea    0x8(%eax),%eax
+  80081a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80081d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800822:	eb 4b                	jmp    80086f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800824:	8b 45 14             	mov    0x14(%ebp),%eax
+  800827:	8b 10                	mov    (%eax),%edx
+  800829:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80082e:	8d 40 04             	lea    0x4(%eax),%eax
+  800831:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800834:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800839:	eb 34                	jmp    80086f <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80083b:	83 f9 01             	cmp    $0x1,%ecx
+  80083e:	7f 15                	jg     800855 <vprintfmt+0x354>
+	else if (lflag)
+  800840:	85 c9                	test   %ecx,%ecx
+  800842:	74 4d                	je     800891 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800844:	8b 45 14             	mov    0x14(%ebp),%eax
+  800847:	8b 00                	mov    (%eax),%eax
+  800849:	99                   	cltd
+  80084a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80084d:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800850:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800853:	eb 11                	jmp    800866 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800855:	8b 45 14             	mov    0x14(%ebp),%eax
+  800858:	8b 50 04             	mov    0x4(%eax),%edx
+  80085b:	8b 00                	mov    (%eax),%eax
+  80085d:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800860:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800863:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800866:	89 d1                	mov    %edx,%ecx
+  800868:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  80086a:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80086f:	83 ec 0c             	sub    $0xc,%esp
+  800872:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800876:	50                   	push   %eax
+  800877:	ff 75 e0             	push   -0x20(%ebp)
+  80087a:	57                   	push   %edi
+  80087b:	51                   	push   %ecx
+  80087c:	52                   	push   %edx
+  80087d:	89 da                	mov    %ebx,%edx
+  80087f:	89 f0                	mov    %esi,%eax
+  800881:	e8 98 fb ff ff       	call   80041e <printnum>
+			break;
+  800886:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800889:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80088c:	e9 8e fc ff ff       	jmp    80051f <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800891:	8b 45 14             	mov    0x14(%ebp),%eax
+  800894:	8b 00                	mov    (%eax),%eax
+  800896:	99                   	cltd
+  800897:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80089a:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80089d:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8008a0:	eb c4                	jmp    800866 <vprintfmt+0x365>
+			putch('0', putdat);
+  8008a2:	83 ec 08             	sub    $0x8,%esp
+  8008a5:	53                   	push   %ebx
+  8008a6:	6a 30                	push   $0x30
+  8008a8:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8008aa:	83 c4 08             	add    $0x8,%esp
+  8008ad:	53                   	push   %ebx
+  8008ae:	6a 78                	push   $0x78
+  8008b0:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8008b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b5:	8b 10                	mov    (%eax),%edx
+  8008b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8008bc:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008c5:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8008ca:	eb a3                	jmp    80086f <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8008cc:	83 f9 01             	cmp    $0x1,%ecx
+  8008cf:	7f 1b                	jg     8008ec <vprintfmt+0x3eb>
+	else if (lflag)
+  8008d1:	85 c9                	test   %ecx,%ecx
+  8008d3:	74 2f                	je     800904 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8008d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d8:	8b 10                	mov    (%eax),%edx
+  8008da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008df:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008e5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8008ea:	eb 83                	jmp    80086f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8008ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ef:	8b 10                	mov    (%eax),%edx
+  8008f1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008f4:	8d 40 08             	lea    0x8(%eax),%eax
+  8008f7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008fa:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8008ff:	e9 6b ff ff ff       	jmp    80086f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800904:	8b 45 14             	mov    0x14(%ebp),%eax
+  800907:	8b 10                	mov    (%eax),%edx
+  800909:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80090e:	8d 40 04             	lea    0x4(%eax),%eax
+  800911:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800914:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800919:	e9 51 ff ff ff       	jmp    80086f <vprintfmt+0x36e>
+			putch(ch, putdat);
+  80091e:	83 ec 08             	sub    $0x8,%esp
+  800921:	53                   	push   %ebx
+  800922:	6a 25                	push   $0x25
+  800924:	ff d6                	call   *%esi
+			break;
+  800926:	83 c4 10             	add    $0x10,%esp
+  800929:	e9 5b ff ff ff       	jmp    800889 <vprintfmt+0x388>
+			putch('%', putdat);
+  80092e:	83 ec 08             	sub    $0x8,%esp
+  800931:	53                   	push   %ebx
+  800932:	6a 25                	push   $0x25
+  800934:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800936:	83 c4 10             	add    $0x10,%esp
+  800939:	89 f8                	mov    %edi,%eax
+  80093b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80093f:	74 05                	je     800946 <vprintfmt+0x445>
+  800941:	83 e8 01             	sub    $0x1,%eax
+  800944:	eb f5                	jmp    80093b <vprintfmt+0x43a>
+  800946:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800949:	e9 3b ff ff ff       	jmp    800889 <vprintfmt+0x388>
+
+0080094e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80094e:	55                   	push   %ebp
+  80094f:	89 e5                	mov    %esp,%ebp
+  800951:	83 ec 18             	sub    $0x18,%esp
+  800954:	8b 45 08             	mov    0x8(%ebp),%eax
+  800957:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80095a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80095d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800961:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800964:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80096b:	85 c0                	test   %eax,%eax
+  80096d:	74 26                	je     800995 <vsnprintf+0x47>
+  80096f:	85 d2                	test   %edx,%edx
+  800971:	7e 22                	jle    800995 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800973:	ff 75 14             	push   0x14(%ebp)
+  800976:	ff 75 10             	push   0x10(%ebp)
+  800979:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80097c:	50                   	push   %eax
+  80097d:	68 c7 04 80 00       	push   $0x8004c7
+  800982:	e8 7a fb ff ff       	call   800501 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800987:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80098a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80098d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800990:	83 c4 10             	add    $0x10,%esp
+}
+  800993:	c9                   	leave
+  800994:	c3                   	ret
+		return -E_INVAL;
+  800995:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80099a:	eb f7                	jmp    800993 <vsnprintf+0x45>
+
+0080099c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80099c:	55                   	push   %ebp
+  80099d:	89 e5                	mov    %esp,%ebp
+  80099f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009a2:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009a5:	50                   	push   %eax
+  8009a6:	ff 75 10             	push   0x10(%ebp)
+  8009a9:	ff 75 0c             	push   0xc(%ebp)
+  8009ac:	ff 75 08             	push   0x8(%ebp)
+  8009af:	e8 9a ff ff ff       	call   80094e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009b4:	c9                   	leave
+  8009b5:	c3                   	ret
+
+008009b6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009b6:	55                   	push   %ebp
+  8009b7:	89 e5                	mov    %esp,%ebp
+  8009b9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c1:	eb 03                	jmp    8009c6 <strlen+0x10>
+		n++;
+  8009c3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009c6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009ca:	75 f7                	jne    8009c3 <strlen+0xd>
+	return n;
+}
+  8009cc:	5d                   	pop    %ebp
+  8009cd:	c3                   	ret
+
+008009ce <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009ce:	55                   	push   %ebp
+  8009cf:	89 e5                	mov    %esp,%ebp
+  8009d1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009dc:	eb 03                	jmp    8009e1 <strnlen+0x13>
+		n++;
+  8009de:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009e1:	39 d0                	cmp    %edx,%eax
+  8009e3:	74 08                	je     8009ed <strnlen+0x1f>
+  8009e5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009e9:	75 f3                	jne    8009de <strnlen+0x10>
+  8009eb:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009ed:	89 d0                	mov    %edx,%eax
+  8009ef:	5d                   	pop    %ebp
+  8009f0:	c3                   	ret
+
+008009f1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009f1:	55                   	push   %ebp
+  8009f2:	89 e5                	mov    %esp,%ebp
+  8009f4:	53                   	push   %ebx
+  8009f5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a00:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a04:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a07:	83 c0 01             	add    $0x1,%eax
+  800a0a:	84 d2                	test   %dl,%dl
+  800a0c:	75 f2                	jne    800a00 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a0e:	89 c8                	mov    %ecx,%eax
+  800a10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a13:	c9                   	leave
+  800a14:	c3                   	ret
+
+00800a15 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	53                   	push   %ebx
+  800a19:	83 ec 10             	sub    $0x10,%esp
+  800a1c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a1f:	53                   	push   %ebx
+  800a20:	e8 91 ff ff ff       	call   8009b6 <strlen>
+  800a25:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a28:	ff 75 0c             	push   0xc(%ebp)
+  800a2b:	01 d8                	add    %ebx,%eax
+  800a2d:	50                   	push   %eax
+  800a2e:	e8 be ff ff ff       	call   8009f1 <strcpy>
+	return dst;
+}
+  800a33:	89 d8                	mov    %ebx,%eax
+  800a35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a38:	c9                   	leave
+  800a39:	c3                   	ret
+
+00800a3a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a3a:	55                   	push   %ebp
+  800a3b:	89 e5                	mov    %esp,%ebp
+  800a3d:	56                   	push   %esi
+  800a3e:	53                   	push   %ebx
+  800a3f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a42:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a45:	89 f3                	mov    %esi,%ebx
+  800a47:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a4a:	89 f0                	mov    %esi,%eax
+  800a4c:	eb 0f                	jmp    800a5d <strncpy+0x23>
+		*dst++ = *src;
+  800a4e:	83 c0 01             	add    $0x1,%eax
+  800a51:	0f b6 0a             	movzbl (%edx),%ecx
+  800a54:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a57:	80 f9 01             	cmp    $0x1,%cl
+  800a5a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a5d:	39 d8                	cmp    %ebx,%eax
+  800a5f:	75 ed                	jne    800a4e <strncpy+0x14>
+	}
+	return ret;
+}
+  800a61:	89 f0                	mov    %esi,%eax
+  800a63:	5b                   	pop    %ebx
+  800a64:	5e                   	pop    %esi
+  800a65:	5d                   	pop    %ebp
+  800a66:	c3                   	ret
+
+00800a67 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a67:	55                   	push   %ebp
+  800a68:	89 e5                	mov    %esp,%ebp
+  800a6a:	56                   	push   %esi
+  800a6b:	53                   	push   %ebx
+  800a6c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a72:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a75:	89 f0                	mov    %esi,%eax
+  800a77:	85 d2                	test   %edx,%edx
+  800a79:	74 21                	je     800a9c <strlcpy+0x35>
+  800a7b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a7f:	89 f2                	mov    %esi,%edx
+  800a81:	eb 09                	jmp    800a8c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a83:	83 c1 01             	add    $0x1,%ecx
+  800a86:	83 c2 01             	add    $0x1,%edx
+  800a89:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a8c:	39 c2                	cmp    %eax,%edx
+  800a8e:	74 09                	je     800a99 <strlcpy+0x32>
+  800a90:	0f b6 19             	movzbl (%ecx),%ebx
+  800a93:	84 db                	test   %bl,%bl
+  800a95:	75 ec                	jne    800a83 <strlcpy+0x1c>
+  800a97:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a99:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a9c:	29 f0                	sub    %esi,%eax
+}
+  800a9e:	5b                   	pop    %ebx
+  800a9f:	5e                   	pop    %esi
+  800aa0:	5d                   	pop    %ebp
+  800aa1:	c3                   	ret
+
+00800aa2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800aa2:	55                   	push   %ebp
+  800aa3:	89 e5                	mov    %esp,%ebp
+  800aa5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aa8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800aab:	eb 06                	jmp    800ab3 <strcmp+0x11>
+		p++, q++;
+  800aad:	83 c1 01             	add    $0x1,%ecx
+  800ab0:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ab3:	0f b6 01             	movzbl (%ecx),%eax
+  800ab6:	84 c0                	test   %al,%al
+  800ab8:	74 04                	je     800abe <strcmp+0x1c>
+  800aba:	3a 02                	cmp    (%edx),%al
+  800abc:	74 ef                	je     800aad <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800abe:	0f b6 c0             	movzbl %al,%eax
+  800ac1:	0f b6 12             	movzbl (%edx),%edx
+  800ac4:	29 d0                	sub    %edx,%eax
+}
+  800ac6:	5d                   	pop    %ebp
+  800ac7:	c3                   	ret
+
+00800ac8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ac8:	55                   	push   %ebp
+  800ac9:	89 e5                	mov    %esp,%ebp
+  800acb:	53                   	push   %ebx
+  800acc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800acf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ad2:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800ad5:	eb 09                	jmp    800ae0 <strncmp+0x18>
+		n--, p++, q++;
+  800ad7:	83 ea 01             	sub    $0x1,%edx
+  800ada:	83 c0 01             	add    $0x1,%eax
+  800add:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ae0:	85 d2                	test   %edx,%edx
+  800ae2:	74 18                	je     800afc <strncmp+0x34>
+  800ae4:	0f b6 18             	movzbl (%eax),%ebx
+  800ae7:	84 db                	test   %bl,%bl
+  800ae9:	74 04                	je     800aef <strncmp+0x27>
+  800aeb:	3a 19                	cmp    (%ecx),%bl
+  800aed:	74 e8                	je     800ad7 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800aef:	0f b6 00             	movzbl (%eax),%eax
+  800af2:	0f b6 11             	movzbl (%ecx),%edx
+  800af5:	29 d0                	sub    %edx,%eax
+}
+  800af7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800afa:	c9                   	leave
+  800afb:	c3                   	ret
+		return 0;
+  800afc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b01:	eb f4                	jmp    800af7 <strncmp+0x2f>
+
+00800b03 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b03:	55                   	push   %ebp
+  800b04:	89 e5                	mov    %esp,%ebp
+  800b06:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b09:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b0d:	eb 03                	jmp    800b12 <strchr+0xf>
+  800b0f:	83 c0 01             	add    $0x1,%eax
+  800b12:	0f b6 10             	movzbl (%eax),%edx
+  800b15:	84 d2                	test   %dl,%dl
+  800b17:	74 06                	je     800b1f <strchr+0x1c>
+		if (*s == c)
+  800b19:	38 ca                	cmp    %cl,%dl
+  800b1b:	75 f2                	jne    800b0f <strchr+0xc>
+  800b1d:	eb 05                	jmp    800b24 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b24:	5d                   	pop    %ebp
+  800b25:	c3                   	ret
+
+00800b26 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b26:	55                   	push   %ebp
+  800b27:	89 e5                	mov    %esp,%ebp
+  800b29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b30:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b33:	38 ca                	cmp    %cl,%dl
+  800b35:	74 09                	je     800b40 <strfind+0x1a>
+  800b37:	84 d2                	test   %dl,%dl
+  800b39:	74 05                	je     800b40 <strfind+0x1a>
+	for (; *s; s++)
+  800b3b:	83 c0 01             	add    $0x1,%eax
+  800b3e:	eb f0                	jmp    800b30 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b40:	5d                   	pop    %ebp
+  800b41:	c3                   	ret
+
+00800b42 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	57                   	push   %edi
+  800b46:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b49:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b4c:	85 c9                	test   %ecx,%ecx
+  800b4e:	74 20                	je     800b70 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b50:	89 f8                	mov    %edi,%eax
+  800b52:	09 c8                	or     %ecx,%eax
+  800b54:	a8 03                	test   $0x3,%al
+  800b56:	75 12                	jne    800b6a <memset+0x28>
+		c &= 0xFF;
+  800b58:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b5c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b62:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b65:	fc                   	cld
+  800b66:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b68:	eb 06                	jmp    800b70 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b6a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b6d:	fc                   	cld
+  800b6e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b70:	89 f8                	mov    %edi,%eax
+  800b72:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b75:	c9                   	leave
+  800b76:	c3                   	ret
+
+00800b77 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b77:	55                   	push   %ebp
+  800b78:	89 e5                	mov    %esp,%ebp
+  800b7a:	57                   	push   %edi
+  800b7b:	56                   	push   %esi
+  800b7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b7f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b82:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b85:	39 c6                	cmp    %eax,%esi
+  800b87:	73 32                	jae    800bbb <memmove+0x44>
+  800b89:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b8c:	39 d0                	cmp    %edx,%eax
+  800b8e:	73 2b                	jae    800bbb <memmove+0x44>
+		s += n;
+		d += n;
+  800b90:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b93:	89 d6                	mov    %edx,%esi
+  800b95:	09 fe                	or     %edi,%esi
+  800b97:	09 ce                	or     %ecx,%esi
+  800b99:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b9f:	75 0e                	jne    800baf <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ba1:	83 ef 04             	sub    $0x4,%edi
+  800ba4:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ba7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800baa:	fd                   	std
+  800bab:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bad:	eb 09                	jmp    800bb8 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800baf:	83 ef 01             	sub    $0x1,%edi
+  800bb2:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800bb5:	fd                   	std
+  800bb6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800bb8:	fc                   	cld
+  800bb9:	eb 1a                	jmp    800bd5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bbb:	89 f2                	mov    %esi,%edx
+  800bbd:	09 c2                	or     %eax,%edx
+  800bbf:	09 ca                	or     %ecx,%edx
+  800bc1:	f6 c2 03             	test   $0x3,%dl
+  800bc4:	75 0a                	jne    800bd0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bc6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bc9:	89 c7                	mov    %eax,%edi
+  800bcb:	fc                   	cld
+  800bcc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bce:	eb 05                	jmp    800bd5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800bd0:	89 c7                	mov    %eax,%edi
+  800bd2:	fc                   	cld
+  800bd3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800bd5:	5e                   	pop    %esi
+  800bd6:	5f                   	pop    %edi
+  800bd7:	5d                   	pop    %ebp
+  800bd8:	c3                   	ret
+
+00800bd9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bd9:	55                   	push   %ebp
+  800bda:	89 e5                	mov    %esp,%ebp
+  800bdc:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800bdf:	ff 75 10             	push   0x10(%ebp)
+  800be2:	ff 75 0c             	push   0xc(%ebp)
+  800be5:	ff 75 08             	push   0x8(%ebp)
+  800be8:	e8 8a ff ff ff       	call   800b77 <memmove>
+}
+  800bed:	c9                   	leave
+  800bee:	c3                   	ret
+
+00800bef <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bef:	55                   	push   %ebp
+  800bf0:	89 e5                	mov    %esp,%ebp
+  800bf2:	56                   	push   %esi
+  800bf3:	53                   	push   %ebx
+  800bf4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800bfa:	89 c6                	mov    %eax,%esi
+  800bfc:	03 75 10             	add    0x10(%ebp),%esi
+  800bff:	eb 06                	jmp    800c07 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c01:	83 c0 01             	add    $0x1,%eax
+  800c04:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c07:	39 f0                	cmp    %esi,%eax
+  800c09:	74 14                	je     800c1f <memcmp+0x30>
+		if (*s1 != *s2)
+  800c0b:	0f b6 08             	movzbl (%eax),%ecx
+  800c0e:	0f b6 1a             	movzbl (%edx),%ebx
+  800c11:	38 d9                	cmp    %bl,%cl
+  800c13:	74 ec                	je     800c01 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c15:	0f b6 c1             	movzbl %cl,%eax
+  800c18:	0f b6 db             	movzbl %bl,%ebx
+  800c1b:	29 d8                	sub    %ebx,%eax
+  800c1d:	eb 05                	jmp    800c24 <memcmp+0x35>
+	}
+
+	return 0;
+  800c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c24:	5b                   	pop    %ebx
+  800c25:	5e                   	pop    %esi
+  800c26:	5d                   	pop    %ebp
+  800c27:	c3                   	ret
+
+00800c28 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c28:	55                   	push   %ebp
+  800c29:	89 e5                	mov    %esp,%ebp
+  800c2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c31:	89 c2                	mov    %eax,%edx
+  800c33:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c36:	eb 03                	jmp    800c3b <memfind+0x13>
+  800c38:	83 c0 01             	add    $0x1,%eax
+  800c3b:	39 d0                	cmp    %edx,%eax
+  800c3d:	73 04                	jae    800c43 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c3f:	38 08                	cmp    %cl,(%eax)
+  800c41:	75 f5                	jne    800c38 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c43:	5d                   	pop    %ebp
+  800c44:	c3                   	ret
+
+00800c45 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c45:	55                   	push   %ebp
+  800c46:	89 e5                	mov    %esp,%ebp
+  800c48:	57                   	push   %edi
+  800c49:	56                   	push   %esi
+  800c4a:	53                   	push   %ebx
+  800c4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c51:	eb 03                	jmp    800c56 <strtol+0x11>
+		s++;
+  800c53:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c56:	0f b6 02             	movzbl (%edx),%eax
+  800c59:	3c 20                	cmp    $0x20,%al
+  800c5b:	74 f6                	je     800c53 <strtol+0xe>
+  800c5d:	3c 09                	cmp    $0x9,%al
+  800c5f:	74 f2                	je     800c53 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c61:	3c 2b                	cmp    $0x2b,%al
+  800c63:	74 2a                	je     800c8f <strtol+0x4a>
+	int neg = 0;
+  800c65:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c6a:	3c 2d                	cmp    $0x2d,%al
+  800c6c:	74 2b                	je     800c99 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c6e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c74:	75 0f                	jne    800c85 <strtol+0x40>
+  800c76:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c79:	74 28                	je     800ca3 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c7b:	85 db                	test   %ebx,%ebx
+  800c7d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c82:	0f 44 d8             	cmove  %eax,%ebx
+  800c85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c8a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c8d:	eb 46                	jmp    800cd5 <strtol+0x90>
+		s++;
+  800c8f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c92:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c97:	eb d5                	jmp    800c6e <strtol+0x29>
+		s++, neg = 1;
+  800c99:	83 c2 01             	add    $0x1,%edx
+  800c9c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ca1:	eb cb                	jmp    800c6e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ca3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ca7:	74 0e                	je     800cb7 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ca9:	85 db                	test   %ebx,%ebx
+  800cab:	75 d8                	jne    800c85 <strtol+0x40>
+		s++, base = 8;
+  800cad:	83 c2 01             	add    $0x1,%edx
+  800cb0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cb5:	eb ce                	jmp    800c85 <strtol+0x40>
+		s += 2, base = 16;
+  800cb7:	83 c2 02             	add    $0x2,%edx
+  800cba:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cbf:	eb c4                	jmp    800c85 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800cc1:	0f be c0             	movsbl %al,%eax
+  800cc4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800cc7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cca:	7d 3a                	jge    800d06 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ccc:	83 c2 01             	add    $0x1,%edx
+  800ccf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cd3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800cd5:	0f b6 02             	movzbl (%edx),%eax
+  800cd8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cdb:	89 f3                	mov    %esi,%ebx
+  800cdd:	80 fb 09             	cmp    $0x9,%bl
+  800ce0:	76 df                	jbe    800cc1 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ce2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ce5:	89 f3                	mov    %esi,%ebx
+  800ce7:	80 fb 19             	cmp    $0x19,%bl
+  800cea:	77 08                	ja     800cf4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800cec:	0f be c0             	movsbl %al,%eax
+  800cef:	83 e8 57             	sub    $0x57,%eax
+  800cf2:	eb d3                	jmp    800cc7 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cf4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800cf7:	89 f3                	mov    %esi,%ebx
+  800cf9:	80 fb 19             	cmp    $0x19,%bl
+  800cfc:	77 08                	ja     800d06 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800cfe:	0f be c0             	movsbl %al,%eax
+  800d01:	83 e8 37             	sub    $0x37,%eax
+  800d04:	eb c1                	jmp    800cc7 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d06:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d0a:	74 05                	je     800d11 <strtol+0xcc>
+		*endptr = (char *) s;
+  800d0c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d0f:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d11:	89 c8                	mov    %ecx,%eax
+  800d13:	f7 d8                	neg    %eax
+  800d15:	85 ff                	test   %edi,%edi
+  800d17:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d1a:	89 c8                	mov    %ecx,%eax
+  800d1c:	5b                   	pop    %ebx
+  800d1d:	5e                   	pop    %esi
+  800d1e:	5f                   	pop    %edi
+  800d1f:	5d                   	pop    %ebp
+  800d20:	c3                   	ret
+
+00800d21 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800d21:	55                   	push   %ebp
+  800d22:	89 e5                	mov    %esp,%ebp
+  800d24:	57                   	push   %edi
+  800d25:	56                   	push   %esi
+  800d26:	53                   	push   %ebx
+  800d27:	83 ec 0c             	sub    $0xc,%esp
+  800d2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800d2d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d30:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800d33:	85 ff                	test   %edi,%edi
+  800d35:	74 16                	je     800d4d <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800d37:	83 ec 04             	sub    $0x4,%esp
+  800d3a:	56                   	push   %esi
+  800d3b:	6a 00                	push   $0x0
+  800d3d:	53                   	push   %ebx
+  800d3e:	e8 02 ff ff ff       	call   800c45 <strtol>
+  800d43:	89 07                	mov    %eax,(%edi)
+  800d45:	83 c4 10             	add    $0x10,%esp
+  800d48:	eb 03                	jmp    800d4d <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800d4a:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800d4d:	0f b6 03             	movzbl (%ebx),%eax
+  800d50:	3c 20                	cmp    $0x20,%al
+  800d52:	74 f6                	je     800d4a <strisl+0x29>
+  800d54:	3c 09                	cmp    $0x9,%al
+  800d56:	74 f2                	je     800d4a <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d58:	3c 2b                	cmp    $0x2b,%al
+  800d5a:	74 23                	je     800d7f <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800d5c:	3c 2d                	cmp    $0x2d,%al
+  800d5e:	0f 94 c0             	sete   %al
+  800d61:	0f b6 c0             	movzbl %al,%eax
+  800d64:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d66:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800d6c:	75 41                	jne    800daf <strisl+0x8e>
+  800d6e:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800d71:	74 11                	je     800d84 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d73:	85 f6                	test   %esi,%esi
+  800d75:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d7a:	0f 44 f0             	cmove  %eax,%esi
+  800d7d:	eb 30                	jmp    800daf <strisl+0x8e>
+		s++;
+  800d7f:	83 c3 01             	add    $0x1,%ebx
+  800d82:	eb e2                	jmp    800d66 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d84:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800d88:	74 0e                	je     800d98 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800d8a:	85 f6                	test   %esi,%esi
+  800d8c:	75 21                	jne    800daf <strisl+0x8e>
+		s++, base = 8;
+  800d8e:	83 c3 01             	add    $0x1,%ebx
+  800d91:	be 08 00 00 00       	mov    $0x8,%esi
+  800d96:	eb 17                	jmp    800daf <strisl+0x8e>
+		s += 2, base = 16;
+  800d98:	83 c3 02             	add    $0x2,%ebx
+  800d9b:	be 10 00 00 00       	mov    $0x10,%esi
+  800da0:	eb 0d                	jmp    800daf <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800da2:	0f be c0             	movsbl %al,%eax
+  800da5:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800da8:	39 f0                	cmp    %esi,%eax
+  800daa:	7d 38                	jge    800de4 <strisl+0xc3>
+			return 0;
+		s++;
+  800dac:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800daf:	0f b6 03             	movzbl (%ebx),%eax
+  800db2:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800db5:	80 fa 09             	cmp    $0x9,%dl
+  800db8:	76 e8                	jbe    800da2 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800dba:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800dbd:	80 fa 19             	cmp    $0x19,%dl
+  800dc0:	77 08                	ja     800dca <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800dc2:	0f be c0             	movsbl %al,%eax
+  800dc5:	83 e8 57             	sub    $0x57,%eax
+  800dc8:	eb de                	jmp    800da8 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800dca:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800dcd:	80 fa 19             	cmp    $0x19,%dl
+  800dd0:	77 08                	ja     800dda <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800dd2:	0f be c0             	movsbl %al,%eax
+  800dd5:	83 e8 37             	sub    $0x37,%eax
+  800dd8:	eb ce                	jmp    800da8 <strisl+0x87>
+		else if (!*s)
+  800dda:	84 c0                	test   %al,%al
+  800ddc:	0f 94 c0             	sete   %al
+  800ddf:	0f b6 c0             	movzbl %al,%eax
+  800de2:	eb 05                	jmp    800de9 <strisl+0xc8>
+			return 0;
+  800de4:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800de9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dec:	5b                   	pop    %ebx
+  800ded:	5e                   	pop    %esi
+  800dee:	5f                   	pop    %edi
+  800def:	5d                   	pop    %ebp
+  800df0:	c3                   	ret
+
+00800df1 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800df1:	55                   	push   %ebp
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	83 ec 10             	sub    $0x10,%esp
+  800df7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800dfa:	89 c8                	mov    %ecx,%eax
+  800dfc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800e01:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800e04:	eb 0b                	jmp    800e11 <touch_mem+0x20>
+		c = *(char *)page;
+  800e06:	0f b6 10             	movzbl (%eax),%edx
+  800e09:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800e0c:	05 00 10 00 00       	add    $0x1000,%eax
+  800e11:	39 c8                	cmp    %ecx,%eax
+  800e13:	72 f1                	jb     800e06 <touch_mem+0x15>
+}
+  800e15:	c9                   	leave
+  800e16:	c3                   	ret
+
+00800e17 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800e17:	55                   	push   %ebp
+  800e18:	89 e5                	mov    %esp,%ebp
+  800e1a:	57                   	push   %edi
+  800e1b:	56                   	push   %esi
+  800e1c:	53                   	push   %ebx
+	touch_mem(s, len);
+  800e1d:	ff 75 0c             	push   0xc(%ebp)
+  800e20:	ff 75 08             	push   0x8(%ebp)
+  800e23:	e8 c9 ff ff ff       	call   800df1 <touch_mem>
+	asm volatile("int %1\n"
+  800e28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e33:	89 c3                	mov    %eax,%ebx
+  800e35:	89 c7                	mov    %eax,%edi
+  800e37:	89 c6                	mov    %eax,%esi
+  800e39:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e3b:	83 c4 08             	add    $0x8,%esp
+  800e3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e41:	5b                   	pop    %ebx
+  800e42:	5e                   	pop    %esi
+  800e43:	5f                   	pop    %edi
+  800e44:	5d                   	pop    %ebp
+  800e45:	c3                   	ret
+
+00800e46 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e46:	55                   	push   %ebp
+  800e47:	89 e5                	mov    %esp,%ebp
+  800e49:	57                   	push   %edi
+  800e4a:	56                   	push   %esi
+  800e4b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e51:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e56:	89 d1                	mov    %edx,%ecx
+  800e58:	89 d3                	mov    %edx,%ebx
+  800e5a:	89 d7                	mov    %edx,%edi
+  800e5c:	89 d6                	mov    %edx,%esi
+  800e5e:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e60:	5b                   	pop    %ebx
+  800e61:	5e                   	pop    %esi
+  800e62:	5f                   	pop    %edi
+  800e63:	5d                   	pop    %ebp
+  800e64:	c3                   	ret
+
+00800e65 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e65:	55                   	push   %ebp
+  800e66:	89 e5                	mov    %esp,%ebp
+  800e68:	57                   	push   %edi
+  800e69:	56                   	push   %esi
+  800e6a:	53                   	push   %ebx
+  800e6b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e76:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e7b:	89 cb                	mov    %ecx,%ebx
+  800e7d:	89 cf                	mov    %ecx,%edi
+  800e7f:	89 ce                	mov    %ecx,%esi
+  800e81:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e83:	85 c0                	test   %eax,%eax
+  800e85:	7f 08                	jg     800e8f <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8a:	5b                   	pop    %ebx
+  800e8b:	5e                   	pop    %esi
+  800e8c:	5f                   	pop    %edi
+  800e8d:	5d                   	pop    %ebp
+  800e8e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8f:	83 ec 0c             	sub    $0xc,%esp
+  800e92:	50                   	push   %eax
+  800e93:	6a 03                	push   $0x3
+  800e95:	68 8b 2f 80 00       	push   $0x802f8b
+  800e9a:	6a 23                	push   $0x23
+  800e9c:	68 a8 2f 80 00       	push   $0x802fa8
+  800ea1:	e8 89 f4 ff ff       	call   80032f <_panic>
+
+00800ea6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ea6:	55                   	push   %ebp
+  800ea7:	89 e5                	mov    %esp,%ebp
+  800ea9:	57                   	push   %edi
+  800eaa:	56                   	push   %esi
+  800eab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eac:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb1:	b8 02 00 00 00       	mov    $0x2,%eax
+  800eb6:	89 d1                	mov    %edx,%ecx
+  800eb8:	89 d3                	mov    %edx,%ebx
+  800eba:	89 d7                	mov    %edx,%edi
+  800ebc:	89 d6                	mov    %edx,%esi
+  800ebe:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ec0:	5b                   	pop    %ebx
+  800ec1:	5e                   	pop    %esi
+  800ec2:	5f                   	pop    %edi
+  800ec3:	5d                   	pop    %ebp
+  800ec4:	c3                   	ret
+
+00800ec5 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ec5:	55                   	push   %ebp
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	57                   	push   %edi
+  800ec9:	56                   	push   %esi
+  800eca:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ecb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ed5:	89 d1                	mov    %edx,%ecx
+  800ed7:	89 d3                	mov    %edx,%ebx
+  800ed9:	89 d7                	mov    %edx,%edi
+  800edb:	89 d6                	mov    %edx,%esi
+  800edd:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800edf:	5b                   	pop    %ebx
+  800ee0:	5e                   	pop    %esi
+  800ee1:	5f                   	pop    %edi
+  800ee2:	5d                   	pop    %ebp
+  800ee3:	c3                   	ret
+
+00800ee4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ee4:	55                   	push   %ebp
+  800ee5:	89 e5                	mov    %esp,%ebp
+  800ee7:	57                   	push   %edi
+  800ee8:	56                   	push   %esi
+  800ee9:	53                   	push   %ebx
+  800eea:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eed:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800efd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f00:	89 f7                	mov    %esi,%edi
+  800f02:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f04:	85 c0                	test   %eax,%eax
+  800f06:	7f 08                	jg     800f10 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0b:	5b                   	pop    %ebx
+  800f0c:	5e                   	pop    %esi
+  800f0d:	5f                   	pop    %edi
+  800f0e:	5d                   	pop    %ebp
+  800f0f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f10:	83 ec 0c             	sub    $0xc,%esp
+  800f13:	50                   	push   %eax
+  800f14:	6a 04                	push   $0x4
+  800f16:	68 8b 2f 80 00       	push   $0x802f8b
+  800f1b:	6a 23                	push   $0x23
+  800f1d:	68 a8 2f 80 00       	push   $0x802fa8
+  800f22:	e8 08 f4 ff ff       	call   80032f <_panic>
+
+00800f27 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f27:	55                   	push   %ebp
+  800f28:	89 e5                	mov    %esp,%ebp
+  800f2a:	57                   	push   %edi
+  800f2b:	56                   	push   %esi
+  800f2c:	53                   	push   %ebx
+  800f2d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f36:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f3e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f41:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f44:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f46:	85 c0                	test   %eax,%eax
+  800f48:	7f 08                	jg     800f52 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4d:	5b                   	pop    %ebx
+  800f4e:	5e                   	pop    %esi
+  800f4f:	5f                   	pop    %edi
+  800f50:	5d                   	pop    %ebp
+  800f51:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f52:	83 ec 0c             	sub    $0xc,%esp
+  800f55:	50                   	push   %eax
+  800f56:	6a 05                	push   $0x5
+  800f58:	68 8b 2f 80 00       	push   $0x802f8b
+  800f5d:	6a 23                	push   $0x23
+  800f5f:	68 a8 2f 80 00       	push   $0x802fa8
+  800f64:	e8 c6 f3 ff ff       	call   80032f <_panic>
+
+00800f69 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f69:	55                   	push   %ebp
+  800f6a:	89 e5                	mov    %esp,%ebp
+  800f6c:	57                   	push   %edi
+  800f6d:	56                   	push   %esi
+  800f6e:	53                   	push   %ebx
+  800f6f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f82:	89 df                	mov    %ebx,%edi
+  800f84:	89 de                	mov    %ebx,%esi
+  800f86:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f88:	85 c0                	test   %eax,%eax
+  800f8a:	7f 08                	jg     800f94 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f8f:	5b                   	pop    %ebx
+  800f90:	5e                   	pop    %esi
+  800f91:	5f                   	pop    %edi
+  800f92:	5d                   	pop    %ebp
+  800f93:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f94:	83 ec 0c             	sub    $0xc,%esp
+  800f97:	50                   	push   %eax
+  800f98:	6a 06                	push   $0x6
+  800f9a:	68 8b 2f 80 00       	push   $0x802f8b
+  800f9f:	6a 23                	push   $0x23
+  800fa1:	68 a8 2f 80 00       	push   $0x802fa8
+  800fa6:	e8 84 f3 ff ff       	call   80032f <_panic>
+
+00800fab <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800fab:	55                   	push   %ebp
+  800fac:	89 e5                	mov    %esp,%ebp
+  800fae:	57                   	push   %edi
+  800faf:	56                   	push   %esi
+  800fb0:	53                   	push   %ebx
+  800fb1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbf:	b8 18 00 00 00       	mov    $0x18,%eax
+  800fc4:	89 df                	mov    %ebx,%edi
+  800fc6:	89 de                	mov    %ebx,%esi
+  800fc8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fca:	85 c0                	test   %eax,%eax
+  800fcc:	7f 08                	jg     800fd6 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800fce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd1:	5b                   	pop    %ebx
+  800fd2:	5e                   	pop    %esi
+  800fd3:	5f                   	pop    %edi
+  800fd4:	5d                   	pop    %ebp
+  800fd5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd6:	83 ec 0c             	sub    $0xc,%esp
+  800fd9:	50                   	push   %eax
+  800fda:	6a 18                	push   $0x18
+  800fdc:	68 8b 2f 80 00       	push   $0x802f8b
+  800fe1:	6a 23                	push   $0x23
+  800fe3:	68 a8 2f 80 00       	push   $0x802fa8
+  800fe8:	e8 42 f3 ff ff       	call   80032f <_panic>
+
+00800fed <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800fed:	55                   	push   %ebp
+  800fee:	89 e5                	mov    %esp,%ebp
+  800ff0:	57                   	push   %edi
+  800ff1:	56                   	push   %esi
+  800ff2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ff3:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffe:	b8 19 00 00 00       	mov    $0x19,%eax
+  801003:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801006:	89 f7                	mov    %esi,%edi
+  801008:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  80100a:	5b                   	pop    %ebx
+  80100b:	5e                   	pop    %esi
+  80100c:	5f                   	pop    %edi
+  80100d:	5d                   	pop    %ebp
+  80100e:	c3                   	ret
+
+0080100f <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	57                   	push   %edi
+  801013:	56                   	push   %esi
+  801014:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801015:	8b 55 08             	mov    0x8(%ebp),%edx
+  801018:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801020:	be 00 00 00 00       	mov    $0x0,%esi
+  801025:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801028:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80102b:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  80102d:	5b                   	pop    %ebx
+  80102e:	5e                   	pop    %esi
+  80102f:	5f                   	pop    %edi
+  801030:	5d                   	pop    %ebp
+  801031:	c3                   	ret
+
+00801032 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  801032:	55                   	push   %ebp
+  801033:	89 e5                	mov    %esp,%ebp
+  801035:	57                   	push   %edi
+  801036:	56                   	push   %esi
+  801037:	53                   	push   %ebx
+  801038:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  80103b:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  80103e:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801044:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  801047:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801052:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801055:	8b 75 18             	mov    0x18(%ebp),%esi
+  801058:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80105a:	85 c0                	test   %eax,%eax
+  80105c:	7f 08                	jg     801066 <sys_page_map_range+0x34>
+}
+  80105e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801061:	5b                   	pop    %ebx
+  801062:	5e                   	pop    %esi
+  801063:	5f                   	pop    %edi
+  801064:	5d                   	pop    %ebp
+  801065:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801066:	83 ec 0c             	sub    $0xc,%esp
+  801069:	50                   	push   %eax
+  80106a:	6a 10                	push   $0x10
+  80106c:	68 8b 2f 80 00       	push   $0x802f8b
+  801071:	6a 23                	push   $0x23
+  801073:	68 a8 2f 80 00       	push   $0x802fa8
+  801078:	e8 b2 f2 ff ff       	call   80032f <_panic>
+
+0080107d <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  80107d:	55                   	push   %ebp
+  80107e:	89 e5                	mov    %esp,%ebp
+  801080:	57                   	push   %edi
+  801081:	56                   	push   %esi
+  801082:	53                   	push   %ebx
+  801083:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801086:	be 00 00 00 00       	mov    $0x0,%esi
+  80108b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801091:	b8 11 00 00 00       	mov    $0x11,%eax
+  801096:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801099:	89 f7                	mov    %esi,%edi
+  80109b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80109d:	85 c0                	test   %eax,%eax
+  80109f:	7f 08                	jg     8010a9 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8010a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a4:	5b                   	pop    %ebx
+  8010a5:	5e                   	pop    %esi
+  8010a6:	5f                   	pop    %edi
+  8010a7:	5d                   	pop    %ebp
+  8010a8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a9:	83 ec 0c             	sub    $0xc,%esp
+  8010ac:	50                   	push   %eax
+  8010ad:	6a 11                	push   $0x11
+  8010af:	68 8b 2f 80 00       	push   $0x802f8b
+  8010b4:	6a 23                	push   $0x23
+  8010b6:	68 a8 2f 80 00       	push   $0x802fa8
+  8010bb:	e8 6f f2 ff ff       	call   80032f <_panic>
+
+008010c0 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  8010c0:	55                   	push   %ebp
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	57                   	push   %edi
+  8010c4:	56                   	push   %esi
+  8010c5:	53                   	push   %ebx
+  8010c6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8010d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010dc:	89 f7                	mov    %esi,%edi
+  8010de:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010e0:	85 c0                	test   %eax,%eax
+  8010e2:	7f 08                	jg     8010ec <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8010e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e7:	5b                   	pop    %ebx
+  8010e8:	5e                   	pop    %esi
+  8010e9:	5f                   	pop    %edi
+  8010ea:	5d                   	pop    %ebp
+  8010eb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ec:	83 ec 0c             	sub    $0xc,%esp
+  8010ef:	50                   	push   %eax
+  8010f0:	6a 1b                	push   $0x1b
+  8010f2:	68 8b 2f 80 00       	push   $0x802f8b
+  8010f7:	6a 23                	push   $0x23
+  8010f9:	68 a8 2f 80 00       	push   $0x802fa8
+  8010fe:	e8 2c f2 ff ff       	call   80032f <_panic>
+
+00801103 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  801103:	55                   	push   %ebp
+  801104:	89 e5                	mov    %esp,%ebp
+  801106:	57                   	push   %edi
+  801107:	56                   	push   %esi
+  801108:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801109:	ba 00 00 00 00       	mov    $0x0,%edx
+  80110e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801113:	89 d1                	mov    %edx,%ecx
+  801115:	89 d3                	mov    %edx,%ebx
+  801117:	89 d7                	mov    %edx,%edi
+  801119:	89 d6                	mov    %edx,%esi
+  80111b:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80111d:	5b                   	pop    %ebx
+  80111e:	5e                   	pop    %esi
+  80111f:	5f                   	pop    %edi
+  801120:	5d                   	pop    %ebp
+  801121:	c3                   	ret
+
+00801122 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801122:	55                   	push   %ebp
+  801123:	89 e5                	mov    %esp,%ebp
+  801125:	57                   	push   %edi
+  801126:	56                   	push   %esi
+  801127:	53                   	push   %ebx
+  801128:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80112b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801130:	8b 55 08             	mov    0x8(%ebp),%edx
+  801133:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801136:	b8 08 00 00 00       	mov    $0x8,%eax
+  80113b:	89 df                	mov    %ebx,%edi
+  80113d:	89 de                	mov    %ebx,%esi
+  80113f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801141:	85 c0                	test   %eax,%eax
+  801143:	7f 08                	jg     80114d <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801145:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801148:	5b                   	pop    %ebx
+  801149:	5e                   	pop    %esi
+  80114a:	5f                   	pop    %edi
+  80114b:	5d                   	pop    %ebp
+  80114c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80114d:	83 ec 0c             	sub    $0xc,%esp
+  801150:	50                   	push   %eax
+  801151:	6a 08                	push   $0x8
+  801153:	68 8b 2f 80 00       	push   $0x802f8b
+  801158:	6a 23                	push   $0x23
+  80115a:	68 a8 2f 80 00       	push   $0x802fa8
+  80115f:	e8 cb f1 ff ff       	call   80032f <_panic>
+
+00801164 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	57                   	push   %edi
+  801168:	56                   	push   %esi
+  801169:	53                   	push   %ebx
+  80116a:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  80116d:	6a 44                	push   $0x44
+  80116f:	ff 75 0c             	push   0xc(%ebp)
+  801172:	e8 7a fc ff ff       	call   800df1 <touch_mem>
+	asm volatile("int %1\n"
+  801177:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801184:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801187:	89 df                	mov    %ebx,%edi
+  801189:	89 de                	mov    %ebx,%esi
+  80118b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80118d:	83 c4 08             	add    $0x8,%esp
+  801190:	85 c0                	test   %eax,%eax
+  801192:	7f 08                	jg     80119c <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801194:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801197:	5b                   	pop    %ebx
+  801198:	5e                   	pop    %esi
+  801199:	5f                   	pop    %edi
+  80119a:	5d                   	pop    %ebp
+  80119b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80119c:	83 ec 0c             	sub    $0xc,%esp
+  80119f:	50                   	push   %eax
+  8011a0:	6a 09                	push   $0x9
+  8011a2:	68 8b 2f 80 00       	push   $0x802f8b
+  8011a7:	6a 23                	push   $0x23
+  8011a9:	68 a8 2f 80 00       	push   $0x802fa8
+  8011ae:	e8 7c f1 ff ff       	call   80032f <_panic>
+
+008011b3 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  8011b3:	55                   	push   %ebp
+  8011b4:	89 e5                	mov    %esp,%ebp
+  8011b6:	57                   	push   %edi
+  8011b7:	56                   	push   %esi
+  8011b8:	53                   	push   %ebx
+  8011b9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8011cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011cf:	89 f7                	mov    %esi,%edi
+  8011d1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011d3:	85 c0                	test   %eax,%eax
+  8011d5:	7f 08                	jg     8011df <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  8011d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011da:	5b                   	pop    %ebx
+  8011db:	5e                   	pop    %esi
+  8011dc:	5f                   	pop    %edi
+  8011dd:	5d                   	pop    %ebp
+  8011de:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011df:	83 ec 0c             	sub    $0xc,%esp
+  8011e2:	50                   	push   %eax
+  8011e3:	6a 1a                	push   $0x1a
+  8011e5:	68 8b 2f 80 00       	push   $0x802f8b
+  8011ea:	6a 23                	push   $0x23
+  8011ec:	68 a8 2f 80 00       	push   $0x802fa8
+  8011f1:	e8 39 f1 ff ff       	call   80032f <_panic>
+
+008011f6 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8011f6:	55                   	push   %ebp
+  8011f7:	89 e5                	mov    %esp,%ebp
+  8011f9:	57                   	push   %edi
+  8011fa:	56                   	push   %esi
+  8011fb:	53                   	push   %ebx
+  8011fc:	83 ec 0c             	sub    $0xc,%esp
+  8011ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801202:	89 d8                	mov    %ebx,%eax
+  801204:	c1 e0 05             	shl    $0x5,%eax
+  801207:	50                   	push   %eax
+  801208:	ff 75 0c             	push   0xc(%ebp)
+  80120b:	e8 e1 fb ff ff       	call   800df1 <touch_mem>
+	asm volatile("int %1\n"
+  801210:	be 00 00 00 00       	mov    $0x0,%esi
+  801215:	8b 55 08             	mov    0x8(%ebp),%edx
+  801218:	b8 13 00 00 00       	mov    $0x13,%eax
+  80121d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801220:	89 f7                	mov    %esi,%edi
+  801222:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801224:	83 c4 08             	add    $0x8,%esp
+  801227:	85 c0                	test   %eax,%eax
+  801229:	7f 08                	jg     801233 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  80122b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80122e:	5b                   	pop    %ebx
+  80122f:	5e                   	pop    %esi
+  801230:	5f                   	pop    %edi
+  801231:	5d                   	pop    %ebp
+  801232:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801233:	83 ec 0c             	sub    $0xc,%esp
+  801236:	50                   	push   %eax
+  801237:	6a 13                	push   $0x13
+  801239:	68 8b 2f 80 00       	push   $0x802f8b
+  80123e:	6a 23                	push   $0x23
+  801240:	68 a8 2f 80 00       	push   $0x802fa8
+  801245:	e8 e5 f0 ff ff       	call   80032f <_panic>
+
+0080124a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80124a:	55                   	push   %ebp
+  80124b:	89 e5                	mov    %esp,%ebp
+  80124d:	57                   	push   %edi
+  80124e:	56                   	push   %esi
+  80124f:	53                   	push   %ebx
+  801250:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801253:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801258:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801263:	89 df                	mov    %ebx,%edi
+  801265:	89 de                	mov    %ebx,%esi
+  801267:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801269:	85 c0                	test   %eax,%eax
+  80126b:	7f 08                	jg     801275 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80126d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801270:	5b                   	pop    %ebx
+  801271:	5e                   	pop    %esi
+  801272:	5f                   	pop    %edi
+  801273:	5d                   	pop    %ebp
+  801274:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801275:	83 ec 0c             	sub    $0xc,%esp
+  801278:	50                   	push   %eax
+  801279:	6a 0a                	push   $0xa
+  80127b:	68 8b 2f 80 00       	push   $0x802f8b
+  801280:	6a 23                	push   $0x23
+  801282:	68 a8 2f 80 00       	push   $0x802fa8
+  801287:	e8 a3 f0 ff ff       	call   80032f <_panic>
+
+0080128c <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80128c:	55                   	push   %ebp
+  80128d:	89 e5                	mov    %esp,%ebp
+  80128f:	57                   	push   %edi
+  801290:	56                   	push   %esi
+  801291:	53                   	push   %ebx
+  801292:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801295:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80129b:	76 1d                	jbe    8012ba <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80129d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8012ad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012b0:	cd 30                	int    $0x30
+}
+  8012b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b5:	5b                   	pop    %ebx
+  8012b6:	5e                   	pop    %esi
+  8012b7:	5f                   	pop    %edi
+  8012b8:	5d                   	pop    %ebp
+  8012b9:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8012ba:	68 00 10 00 00       	push   $0x1000
+  8012bf:	53                   	push   %ebx
+  8012c0:	e8 2c fb ff ff       	call   800df1 <touch_mem>
+  8012c5:	83 c4 08             	add    $0x8,%esp
+  8012c8:	eb d3                	jmp    80129d <sys_ipc_send+0x11>
+
+008012ca <sys_ipc_send_pages>:
+{
+  8012ca:	55                   	push   %ebp
+  8012cb:	89 e5                	mov    %esp,%ebp
+  8012cd:	57                   	push   %edi
+  8012ce:	56                   	push   %esi
+  8012cf:	53                   	push   %ebx
+  8012d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012d3:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8012d6:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8012dc:	76 18                	jbe    8012f6 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8012de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012e9:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8012ec:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8012ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f1:	5b                   	pop    %ebx
+  8012f2:	5e                   	pop    %esi
+  8012f3:	5f                   	pop    %edi
+  8012f4:	5d                   	pop    %ebp
+  8012f5:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8012f6:	89 f0                	mov    %esi,%eax
+  8012f8:	c1 e0 0c             	shl    $0xc,%eax
+  8012fb:	50                   	push   %eax
+  8012fc:	53                   	push   %ebx
+  8012fd:	e8 ef fa ff ff       	call   800df1 <touch_mem>
+  801302:	83 c4 08             	add    $0x8,%esp
+  801305:	eb d7                	jmp    8012de <sys_ipc_send_pages+0x14>
+
+00801307 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801307:	55                   	push   %ebp
+  801308:	89 e5                	mov    %esp,%ebp
+  80130a:	57                   	push   %edi
+  80130b:	56                   	push   %esi
+  80130c:	53                   	push   %ebx
+  80130d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801310:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801315:	8b 55 08             	mov    0x8(%ebp),%edx
+  801318:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801320:	89 df                	mov    %ebx,%edi
+  801322:	89 de                	mov    %ebx,%esi
+  801324:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801326:	85 c0                	test   %eax,%eax
+  801328:	7f 08                	jg     801332 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  80132a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132d:	5b                   	pop    %ebx
+  80132e:	5e                   	pop    %esi
+  80132f:	5f                   	pop    %edi
+  801330:	5d                   	pop    %ebp
+  801331:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801332:	83 ec 0c             	sub    $0xc,%esp
+  801335:	50                   	push   %eax
+  801336:	6a 0d                	push   $0xd
+  801338:	68 8b 2f 80 00       	push   $0x802f8b
+  80133d:	6a 23                	push   $0x23
+  80133f:	68 a8 2f 80 00       	push   $0x802fa8
+  801344:	e8 e6 ef ff ff       	call   80032f <_panic>
+
+00801349 <sys_ipc_recv>:
+{
+  801349:	55                   	push   %ebp
+  80134a:	89 e5                	mov    %esp,%ebp
+  80134c:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80134f:	6a 01                	push   $0x1
+  801351:	ff 75 08             	push   0x8(%ebp)
+  801354:	e8 ae ff ff ff       	call   801307 <sys_ipc_recv_pages>
+}
+  801359:	c9                   	leave
+  80135a:	c3                   	ret
+
+0080135b <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80135b:	55                   	push   %ebp
+  80135c:	89 e5                	mov    %esp,%ebp
+  80135e:	57                   	push   %edi
+  80135f:	56                   	push   %esi
+  801360:	53                   	push   %ebx
+  801361:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801364:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801367:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  80136a:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801370:	77 04                	ja     801376 <sys_ipc_call+0x1b>
+  801372:	85 f6                	test   %esi,%esi
+  801374:	75 15                	jne    80138b <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801376:	8b 55 08             	mov    0x8(%ebp),%edx
+  801379:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801381:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801383:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801386:	5b                   	pop    %ebx
+  801387:	5e                   	pop    %esi
+  801388:	5f                   	pop    %edi
+  801389:	5d                   	pop    %ebp
+  80138a:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80138b:	89 f8                	mov    %edi,%eax
+  80138d:	c1 e0 0c             	shl    $0xc,%eax
+  801390:	50                   	push   %eax
+  801391:	53                   	push   %ebx
+  801392:	e8 5a fa ff ff       	call   800df1 <touch_mem>
+  801397:	83 c4 08             	add    $0x8,%esp
+  80139a:	eb da                	jmp    801376 <sys_ipc_call+0x1b>
+
+0080139c <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80139c:	55                   	push   %ebp
+  80139d:	89 e5                	mov    %esp,%ebp
+  80139f:	57                   	push   %edi
+  8013a0:	56                   	push   %esi
+  8013a1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a8:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013b3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013b6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8013b8:	5b                   	pop    %ebx
+  8013b9:	5e                   	pop    %esi
+  8013ba:	5f                   	pop    %edi
+  8013bb:	5d                   	pop    %ebp
+  8013bc:	c3                   	ret
+
+008013bd <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8013bd:	55                   	push   %ebp
+  8013be:	89 e5                	mov    %esp,%ebp
+  8013c0:	57                   	push   %edi
+  8013c1:	56                   	push   %esi
+  8013c2:	53                   	push   %ebx
+  8013c3:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8013c6:	6a 04                	push   $0x4
+  8013c8:	ff 75 08             	push   0x8(%ebp)
+  8013cb:	e8 21 fa ff ff       	call   800df1 <touch_mem>
+	asm volatile("int %1\n"
+  8013d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d8:	b8 16 00 00 00       	mov    $0x16,%eax
+  8013dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013e3:	89 f7                	mov    %esi,%edi
+  8013e5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013e7:	83 c4 08             	add    $0x8,%esp
+  8013ea:	85 c0                	test   %eax,%eax
+  8013ec:	7f 08                	jg     8013f6 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8013ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f1:	5b                   	pop    %ebx
+  8013f2:	5e                   	pop    %esi
+  8013f3:	5f                   	pop    %edi
+  8013f4:	5d                   	pop    %ebp
+  8013f5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013f6:	83 ec 0c             	sub    $0xc,%esp
+  8013f9:	50                   	push   %eax
+  8013fa:	6a 16                	push   $0x16
+  8013fc:	68 8b 2f 80 00       	push   $0x802f8b
+  801401:	6a 23                	push   $0x23
+  801403:	68 a8 2f 80 00       	push   $0x802fa8
+  801408:	e8 22 ef ff ff       	call   80032f <_panic>
+
+0080140d <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80140d:	55                   	push   %ebp
+  80140e:	89 e5                	mov    %esp,%ebp
+  801410:	57                   	push   %edi
+  801411:	56                   	push   %esi
+  801412:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801413:	6a 04                	push   $0x4
+  801415:	ff 75 08             	push   0x8(%ebp)
+  801418:	e8 d4 f9 ff ff       	call   800df1 <touch_mem>
+	asm volatile("int %1\n"
+  80141d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801422:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801425:	b8 17 00 00 00       	mov    $0x17,%eax
+  80142a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142d:	89 df                	mov    %ebx,%edi
+  80142f:	89 de                	mov    %ebx,%esi
+  801431:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801433:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801436:	5b                   	pop    %ebx
+  801437:	5e                   	pop    %esi
+  801438:	5f                   	pop    %edi
+  801439:	5d                   	pop    %ebp
+  80143a:	c3                   	ret
+
+0080143b <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80143b:	55                   	push   %ebp
+  80143c:	89 e5                	mov    %esp,%ebp
+  80143e:	57                   	push   %edi
+  80143f:	56                   	push   %esi
+  801440:	53                   	push   %ebx
+  801441:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801444:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801449:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801451:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801456:	89 df                	mov    %ebx,%edi
+  801458:	89 de                	mov    %ebx,%esi
+  80145a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80145c:	85 c0                	test   %eax,%eax
+  80145e:	7f 08                	jg     801468 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801460:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801463:	5b                   	pop    %ebx
+  801464:	5e                   	pop    %esi
+  801465:	5f                   	pop    %edi
+  801466:	5d                   	pop    %ebp
+  801467:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801468:	83 ec 0c             	sub    $0xc,%esp
+  80146b:	50                   	push   %eax
+  80146c:	6a 0e                	push   $0xe
+  80146e:	68 8b 2f 80 00       	push   $0x802f8b
+  801473:	6a 23                	push   $0x23
+  801475:	68 a8 2f 80 00       	push   $0x802fa8
+  80147a:	e8 b0 ee ff ff       	call   80032f <_panic>
+
+0080147f <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  80147f:	55                   	push   %ebp
+  801480:	89 e5                	mov    %esp,%ebp
+  801482:	8b 55 08             	mov    0x8(%ebp),%edx
+  801485:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801488:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  80148b:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  80148d:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  801490:	83 3a 01             	cmpl   $0x1,(%edx)
+  801493:	7e 09                	jle    80149e <argstart+0x1f>
+  801495:	ba e8 2b 80 00       	mov    $0x802be8,%edx
+  80149a:	85 c9                	test   %ecx,%ecx
+  80149c:	75 05                	jne    8014a3 <argstart+0x24>
+  80149e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a3:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  8014a6:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  8014ad:	5d                   	pop    %ebp
+  8014ae:	c3                   	ret
+
+008014af <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  8014af:	55                   	push   %ebp
+  8014b0:	89 e5                	mov    %esp,%ebp
+  8014b2:	53                   	push   %ebx
+  8014b3:	83 ec 04             	sub    $0x4,%esp
+  8014b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  8014b9:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  8014c0:	8b 43 08             	mov    0x8(%ebx),%eax
+  8014c3:	85 c0                	test   %eax,%eax
+  8014c5:	74 74                	je     80153b <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  8014c7:	80 38 00             	cmpb   $0x0,(%eax)
+  8014ca:	75 48                	jne    801514 <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  8014cc:	8b 0b                	mov    (%ebx),%ecx
+  8014ce:	83 39 01             	cmpl   $0x1,(%ecx)
+  8014d1:	74 5a                	je     80152d <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  8014d3:	8b 53 04             	mov    0x4(%ebx),%edx
+  8014d6:	8b 42 04             	mov    0x4(%edx),%eax
+  8014d9:	80 38 2d             	cmpb   $0x2d,(%eax)
+  8014dc:	75 4f                	jne    80152d <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  8014de:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  8014e2:	74 49                	je     80152d <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  8014e4:	83 c0 01             	add    $0x1,%eax
+  8014e7:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8014ea:	83 ec 04             	sub    $0x4,%esp
+  8014ed:	8b 01                	mov    (%ecx),%eax
+  8014ef:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  8014f6:	50                   	push   %eax
+  8014f7:	8d 42 08             	lea    0x8(%edx),%eax
+  8014fa:	50                   	push   %eax
+  8014fb:	83 c2 04             	add    $0x4,%edx
+  8014fe:	52                   	push   %edx
+  8014ff:	e8 73 f6 ff ff       	call   800b77 <memmove>
+		(*args->argc)--;
+  801504:	8b 03                	mov    (%ebx),%eax
+  801506:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801509:	8b 43 08             	mov    0x8(%ebx),%eax
+  80150c:	83 c4 10             	add    $0x10,%esp
+  80150f:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801512:	74 13                	je     801527 <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  801514:	8b 43 08             	mov    0x8(%ebx),%eax
+  801517:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  80151a:	83 c0 01             	add    $0x1,%eax
+  80151d:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  801520:	89 d0                	mov    %edx,%eax
+  801522:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801525:	c9                   	leave
+  801526:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801527:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  80152b:	75 e7                	jne    801514 <argnext+0x65>
+	args->curarg = 0;
+  80152d:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  801534:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801539:	eb e5                	jmp    801520 <argnext+0x71>
+		return -1;
+  80153b:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801540:	eb de                	jmp    801520 <argnext+0x71>
+
+00801542 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  801542:	55                   	push   %ebp
+  801543:	89 e5                	mov    %esp,%ebp
+  801545:	53                   	push   %ebx
+  801546:	83 ec 04             	sub    $0x4,%esp
+  801549:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  80154c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80154f:	85 c0                	test   %eax,%eax
+  801551:	74 12                	je     801565 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  801553:	80 38 00             	cmpb   $0x0,(%eax)
+  801556:	74 12                	je     80156a <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  801558:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  80155b:	c7 43 08 e8 2b 80 00 	movl   $0x802be8,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  801562:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  801565:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801568:	c9                   	leave
+  801569:	c3                   	ret
+	} else if (*args->argc > 1) {
+  80156a:	8b 13                	mov    (%ebx),%edx
+  80156c:	83 3a 01             	cmpl   $0x1,(%edx)
+  80156f:	7f 10                	jg     801581 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  801571:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  801578:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  80157f:	eb e1                	jmp    801562 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  801581:	8b 43 04             	mov    0x4(%ebx),%eax
+  801584:	8b 48 04             	mov    0x4(%eax),%ecx
+  801587:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  80158a:	83 ec 04             	sub    $0x4,%esp
+  80158d:	8b 12                	mov    (%edx),%edx
+  80158f:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  801596:	52                   	push   %edx
+  801597:	8d 50 08             	lea    0x8(%eax),%edx
+  80159a:	52                   	push   %edx
+  80159b:	83 c0 04             	add    $0x4,%eax
+  80159e:	50                   	push   %eax
+  80159f:	e8 d3 f5 ff ff       	call   800b77 <memmove>
+		(*args->argc)--;
+  8015a4:	8b 03                	mov    (%ebx),%eax
+  8015a6:	83 28 01             	subl   $0x1,(%eax)
+  8015a9:	83 c4 10             	add    $0x10,%esp
+  8015ac:	eb b4                	jmp    801562 <argnextvalue+0x20>
+
+008015ae <argvalue>:
+{
+  8015ae:	55                   	push   %ebp
+  8015af:	89 e5                	mov    %esp,%ebp
+  8015b1:	83 ec 08             	sub    $0x8,%esp
+  8015b4:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8015b7:	8b 42 0c             	mov    0xc(%edx),%eax
+  8015ba:	85 c0                	test   %eax,%eax
+  8015bc:	74 02                	je     8015c0 <argvalue+0x12>
+}
+  8015be:	c9                   	leave
+  8015bf:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8015c0:	83 ec 0c             	sub    $0xc,%esp
+  8015c3:	52                   	push   %edx
+  8015c4:	e8 79 ff ff ff       	call   801542 <argnextvalue>
+  8015c9:	83 c4 10             	add    $0x10,%esp
+  8015cc:	eb f0                	jmp    8015be <argvalue+0x10>
+
+008015ce <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8015ce:	55                   	push   %ebp
+  8015cf:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015d4:	05 00 00 00 30       	add    $0x30000000,%eax
+  8015d9:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8015dc:	5d                   	pop    %ebp
+  8015dd:	c3                   	ret
+
+008015de <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8015de:	55                   	push   %ebp
+  8015df:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015e4:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8015e9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8015ee:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8015f3:	5d                   	pop    %ebp
+  8015f4:	c3                   	ret
+
+008015f5 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8015f5:	55                   	push   %ebp
+  8015f6:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8015f8:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8015fd:	a8 01                	test   $0x1,%al
+  8015ff:	74 3c                	je     80163d <fd_alloc+0x48>
+  801601:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801606:	89 c2                	mov    %eax,%edx
+  801608:	c1 ea 0c             	shr    $0xc,%edx
+  80160b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801612:	89 c1                	mov    %eax,%ecx
+  801614:	05 00 10 00 00       	add    $0x1000,%eax
+  801619:	f6 c2 01             	test   $0x1,%dl
+  80161c:	74 13                	je     801631 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80161e:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801623:	75 e1                	jne    801606 <fd_alloc+0x11>
+  801625:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80162a:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80162f:	eb 05                	jmp    801636 <fd_alloc+0x41>
+			return 0;
+  801631:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801636:	8b 55 08             	mov    0x8(%ebp),%edx
+  801639:	89 0a                	mov    %ecx,(%edx)
+}
+  80163b:	5d                   	pop    %ebp
+  80163c:	c3                   	ret
+  80163d:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801642:	b8 00 00 00 00       	mov    $0x0,%eax
+  801647:	eb ed                	jmp    801636 <fd_alloc+0x41>
+
+00801649 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801649:	55                   	push   %ebp
+  80164a:	89 e5                	mov    %esp,%ebp
+  80164c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80164f:	83 f8 1f             	cmp    $0x1f,%eax
+  801652:	77 30                	ja     801684 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801654:	c1 e0 0c             	shl    $0xc,%eax
+  801657:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80165c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801662:	f6 c2 01             	test   $0x1,%dl
+  801665:	74 24                	je     80168b <fd_lookup+0x42>
+  801667:	89 c2                	mov    %eax,%edx
+  801669:	c1 ea 0c             	shr    $0xc,%edx
+  80166c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801673:	f6 c2 01             	test   $0x1,%dl
+  801676:	74 1a                	je     801692 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801678:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80167b:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80167d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801682:	5d                   	pop    %ebp
+  801683:	c3                   	ret
+		return -E_INVAL;
+  801684:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801689:	eb f7                	jmp    801682 <fd_lookup+0x39>
+		return -E_INVAL;
+  80168b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801690:	eb f0                	jmp    801682 <fd_lookup+0x39>
+  801692:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801697:	eb e9                	jmp    801682 <fd_lookup+0x39>
+
+00801699 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801699:	55                   	push   %ebp
+  80169a:	89 e5                	mov    %esp,%ebp
+  80169c:	53                   	push   %ebx
+  80169d:	83 ec 04             	sub    $0x4,%esp
+  8016a0:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8016a3:	b8 34 30 80 00       	mov    $0x803034,%eax
+  8016a8:	8b 18                	mov    (%eax),%ebx
+  8016aa:	85 db                	test   %ebx,%ebx
+  8016ac:	74 0e                	je     8016bc <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  8016ae:	83 c0 04             	add    $0x4,%eax
+  8016b1:	39 13                	cmp    %edx,(%ebx)
+  8016b3:	75 f3                	jne    8016a8 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  8016b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ba:	eb 1f                	jmp    8016db <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8016bc:	a1 24 54 80 00       	mov    0x805424,%eax
+  8016c1:	8b 40 48             	mov    0x48(%eax),%eax
+  8016c4:	83 ec 04             	sub    $0x4,%esp
+  8016c7:	52                   	push   %edx
+  8016c8:	50                   	push   %eax
+  8016c9:	68 b8 2f 80 00       	push   $0x802fb8
+  8016ce:	e8 37 ed ff ff       	call   80040a <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8016d3:	83 c4 10             	add    $0x10,%esp
+  8016d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8016db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016de:	89 1a                	mov    %ebx,(%edx)
+}
+  8016e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016e3:	c9                   	leave
+  8016e4:	c3                   	ret
+
+008016e5 <fd_close>:
+{
+  8016e5:	55                   	push   %ebp
+  8016e6:	89 e5                	mov    %esp,%ebp
+  8016e8:	57                   	push   %edi
+  8016e9:	56                   	push   %esi
+  8016ea:	53                   	push   %ebx
+  8016eb:	83 ec 24             	sub    $0x24,%esp
+  8016ee:	8b 75 08             	mov    0x8(%ebp),%esi
+  8016f1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8016f4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016f7:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8016f8:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8016fe:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801701:	50                   	push   %eax
+  801702:	e8 42 ff ff ff       	call   801649 <fd_lookup>
+  801707:	89 c3                	mov    %eax,%ebx
+  801709:	83 c4 10             	add    $0x10,%esp
+  80170c:	85 c0                	test   %eax,%eax
+  80170e:	78 05                	js     801715 <fd_close+0x30>
+	    || fd != fd2)
+  801710:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801713:	74 16                	je     80172b <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801715:	89 f8                	mov    %edi,%eax
+  801717:	84 c0                	test   %al,%al
+  801719:	b8 00 00 00 00       	mov    $0x0,%eax
+  80171e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801721:	89 d8                	mov    %ebx,%eax
+  801723:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801726:	5b                   	pop    %ebx
+  801727:	5e                   	pop    %esi
+  801728:	5f                   	pop    %edi
+  801729:	5d                   	pop    %ebp
+  80172a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80172b:	83 ec 08             	sub    $0x8,%esp
+  80172e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801731:	50                   	push   %eax
+  801732:	ff 36                	push   (%esi)
+  801734:	e8 60 ff ff ff       	call   801699 <dev_lookup>
+  801739:	89 c3                	mov    %eax,%ebx
+  80173b:	83 c4 10             	add    $0x10,%esp
+  80173e:	85 c0                	test   %eax,%eax
+  801740:	78 1a                	js     80175c <fd_close+0x77>
+		if (dev->dev_close)
+  801742:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801745:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801748:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80174d:	85 c0                	test   %eax,%eax
+  80174f:	74 0b                	je     80175c <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801751:	83 ec 0c             	sub    $0xc,%esp
+  801754:	56                   	push   %esi
+  801755:	ff d0                	call   *%eax
+  801757:	89 c3                	mov    %eax,%ebx
+  801759:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80175c:	83 ec 08             	sub    $0x8,%esp
+  80175f:	56                   	push   %esi
+  801760:	6a 00                	push   $0x0
+  801762:	e8 02 f8 ff ff       	call   800f69 <sys_page_unmap>
+	return r;
+  801767:	83 c4 10             	add    $0x10,%esp
+  80176a:	eb b5                	jmp    801721 <fd_close+0x3c>
+
+0080176c <close>:
+
+int
+close(int fdnum)
+{
+  80176c:	55                   	push   %ebp
+  80176d:	89 e5                	mov    %esp,%ebp
+  80176f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801772:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801775:	50                   	push   %eax
+  801776:	ff 75 08             	push   0x8(%ebp)
+  801779:	e8 cb fe ff ff       	call   801649 <fd_lookup>
+  80177e:	83 c4 10             	add    $0x10,%esp
+  801781:	85 c0                	test   %eax,%eax
+  801783:	79 02                	jns    801787 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801785:	c9                   	leave
+  801786:	c3                   	ret
+		return fd_close(fd, 1);
+  801787:	83 ec 08             	sub    $0x8,%esp
+  80178a:	6a 01                	push   $0x1
+  80178c:	ff 75 f4             	push   -0xc(%ebp)
+  80178f:	e8 51 ff ff ff       	call   8016e5 <fd_close>
+  801794:	83 c4 10             	add    $0x10,%esp
+  801797:	eb ec                	jmp    801785 <close+0x19>
+
+00801799 <close_all>:
+
+void
+close_all(void)
+{
+  801799:	55                   	push   %ebp
+  80179a:	89 e5                	mov    %esp,%ebp
+  80179c:	53                   	push   %ebx
+  80179d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8017a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8017a5:	83 ec 0c             	sub    $0xc,%esp
+  8017a8:	53                   	push   %ebx
+  8017a9:	e8 be ff ff ff       	call   80176c <close>
+	for (i = 0; i < MAXFD; i++)
+  8017ae:	83 c3 01             	add    $0x1,%ebx
+  8017b1:	83 c4 10             	add    $0x10,%esp
+  8017b4:	83 fb 20             	cmp    $0x20,%ebx
+  8017b7:	75 ec                	jne    8017a5 <close_all+0xc>
+}
+  8017b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017bc:	c9                   	leave
+  8017bd:	c3                   	ret
+
+008017be <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8017be:	55                   	push   %ebp
+  8017bf:	89 e5                	mov    %esp,%ebp
+  8017c1:	57                   	push   %edi
+  8017c2:	56                   	push   %esi
+  8017c3:	53                   	push   %ebx
+  8017c4:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8017c7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017ca:	50                   	push   %eax
+  8017cb:	ff 75 08             	push   0x8(%ebp)
+  8017ce:	e8 76 fe ff ff       	call   801649 <fd_lookup>
+  8017d3:	89 c3                	mov    %eax,%ebx
+  8017d5:	83 c4 10             	add    $0x10,%esp
+  8017d8:	85 c0                	test   %eax,%eax
+  8017da:	78 7f                	js     80185b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8017dc:	83 ec 0c             	sub    $0xc,%esp
+  8017df:	ff 75 0c             	push   0xc(%ebp)
+  8017e2:	e8 85 ff ff ff       	call   80176c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8017e7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8017ea:	c1 e6 0c             	shl    $0xc,%esi
+  8017ed:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8017f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8017f6:	89 3c 24             	mov    %edi,(%esp)
+  8017f9:	e8 e0 fd ff ff       	call   8015de <fd2data>
+  8017fe:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801800:	89 34 24             	mov    %esi,(%esp)
+  801803:	e8 d6 fd ff ff       	call   8015de <fd2data>
+  801808:	83 c4 10             	add    $0x10,%esp
+  80180b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80180e:	89 d8                	mov    %ebx,%eax
+  801810:	c1 e8 16             	shr    $0x16,%eax
+  801813:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80181a:	a8 01                	test   $0x1,%al
+  80181c:	74 11                	je     80182f <dup+0x71>
+  80181e:	89 d8                	mov    %ebx,%eax
+  801820:	c1 e8 0c             	shr    $0xc,%eax
+  801823:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80182a:	f6 c2 01             	test   $0x1,%dl
+  80182d:	75 36                	jne    801865 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80182f:	89 f8                	mov    %edi,%eax
+  801831:	c1 e8 0c             	shr    $0xc,%eax
+  801834:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80183b:	83 ec 0c             	sub    $0xc,%esp
+  80183e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801843:	50                   	push   %eax
+  801844:	56                   	push   %esi
+  801845:	6a 00                	push   $0x0
+  801847:	57                   	push   %edi
+  801848:	6a 00                	push   $0x0
+  80184a:	e8 d8 f6 ff ff       	call   800f27 <sys_page_map>
+  80184f:	89 c3                	mov    %eax,%ebx
+  801851:	83 c4 20             	add    $0x20,%esp
+  801854:	85 c0                	test   %eax,%eax
+  801856:	78 33                	js     80188b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801858:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80185b:	89 d8                	mov    %ebx,%eax
+  80185d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801860:	5b                   	pop    %ebx
+  801861:	5e                   	pop    %esi
+  801862:	5f                   	pop    %edi
+  801863:	5d                   	pop    %ebp
+  801864:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801865:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80186c:	83 ec 0c             	sub    $0xc,%esp
+  80186f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801874:	50                   	push   %eax
+  801875:	ff 75 d4             	push   -0x2c(%ebp)
+  801878:	6a 00                	push   $0x0
+  80187a:	53                   	push   %ebx
+  80187b:	6a 00                	push   $0x0
+  80187d:	e8 a5 f6 ff ff       	call   800f27 <sys_page_map>
+  801882:	89 c3                	mov    %eax,%ebx
+  801884:	83 c4 20             	add    $0x20,%esp
+  801887:	85 c0                	test   %eax,%eax
+  801889:	79 a4                	jns    80182f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80188b:	83 ec 08             	sub    $0x8,%esp
+  80188e:	56                   	push   %esi
+  80188f:	6a 00                	push   $0x0
+  801891:	e8 d3 f6 ff ff       	call   800f69 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801896:	83 c4 08             	add    $0x8,%esp
+  801899:	ff 75 d4             	push   -0x2c(%ebp)
+  80189c:	6a 00                	push   $0x0
+  80189e:	e8 c6 f6 ff ff       	call   800f69 <sys_page_unmap>
+	return r;
+  8018a3:	83 c4 10             	add    $0x10,%esp
+  8018a6:	eb b3                	jmp    80185b <dup+0x9d>
+
+008018a8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8018a8:	55                   	push   %ebp
+  8018a9:	89 e5                	mov    %esp,%ebp
+  8018ab:	56                   	push   %esi
+  8018ac:	53                   	push   %ebx
+  8018ad:	83 ec 18             	sub    $0x18,%esp
+  8018b0:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018b3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018b6:	50                   	push   %eax
+  8018b7:	56                   	push   %esi
+  8018b8:	e8 8c fd ff ff       	call   801649 <fd_lookup>
+  8018bd:	83 c4 10             	add    $0x10,%esp
+  8018c0:	85 c0                	test   %eax,%eax
+  8018c2:	78 3c                	js     801900 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018c4:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8018c7:	83 ec 08             	sub    $0x8,%esp
+  8018ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018cd:	50                   	push   %eax
+  8018ce:	ff 33                	push   (%ebx)
+  8018d0:	e8 c4 fd ff ff       	call   801699 <dev_lookup>
+  8018d5:	83 c4 10             	add    $0x10,%esp
+  8018d8:	85 c0                	test   %eax,%eax
+  8018da:	78 24                	js     801900 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8018dc:	8b 43 08             	mov    0x8(%ebx),%eax
+  8018df:	83 e0 03             	and    $0x3,%eax
+  8018e2:	83 f8 01             	cmp    $0x1,%eax
+  8018e5:	74 20                	je     801907 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8018e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018ea:	8b 40 08             	mov    0x8(%eax),%eax
+  8018ed:	85 c0                	test   %eax,%eax
+  8018ef:	74 37                	je     801928 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8018f1:	83 ec 04             	sub    $0x4,%esp
+  8018f4:	ff 75 10             	push   0x10(%ebp)
+  8018f7:	ff 75 0c             	push   0xc(%ebp)
+  8018fa:	53                   	push   %ebx
+  8018fb:	ff d0                	call   *%eax
+  8018fd:	83 c4 10             	add    $0x10,%esp
+}
+  801900:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801903:	5b                   	pop    %ebx
+  801904:	5e                   	pop    %esi
+  801905:	5d                   	pop    %ebp
+  801906:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801907:	a1 24 54 80 00       	mov    0x805424,%eax
+  80190c:	8b 40 48             	mov    0x48(%eax),%eax
+  80190f:	83 ec 04             	sub    $0x4,%esp
+  801912:	56                   	push   %esi
+  801913:	50                   	push   %eax
+  801914:	68 f9 2f 80 00       	push   $0x802ff9
+  801919:	e8 ec ea ff ff       	call   80040a <cprintf>
+		return -E_INVAL;
+  80191e:	83 c4 10             	add    $0x10,%esp
+  801921:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801926:	eb d8                	jmp    801900 <read+0x58>
+		return -E_NOT_SUPP;
+  801928:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80192d:	eb d1                	jmp    801900 <read+0x58>
+
+0080192f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80192f:	55                   	push   %ebp
+  801930:	89 e5                	mov    %esp,%ebp
+  801932:	57                   	push   %edi
+  801933:	56                   	push   %esi
+  801934:	53                   	push   %ebx
+  801935:	83 ec 0c             	sub    $0xc,%esp
+  801938:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80193b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80193e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801943:	eb 02                	jmp    801947 <readn+0x18>
+  801945:	01 c3                	add    %eax,%ebx
+  801947:	39 f3                	cmp    %esi,%ebx
+  801949:	73 21                	jae    80196c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80194b:	83 ec 04             	sub    $0x4,%esp
+  80194e:	89 f0                	mov    %esi,%eax
+  801950:	29 d8                	sub    %ebx,%eax
+  801952:	50                   	push   %eax
+  801953:	89 d8                	mov    %ebx,%eax
+  801955:	03 45 0c             	add    0xc(%ebp),%eax
+  801958:	50                   	push   %eax
+  801959:	57                   	push   %edi
+  80195a:	e8 49 ff ff ff       	call   8018a8 <read>
+		if (m < 0)
+  80195f:	83 c4 10             	add    $0x10,%esp
+  801962:	85 c0                	test   %eax,%eax
+  801964:	78 04                	js     80196a <readn+0x3b>
+			return m;
+		if (m == 0)
+  801966:	75 dd                	jne    801945 <readn+0x16>
+  801968:	eb 02                	jmp    80196c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80196a:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80196c:	89 d8                	mov    %ebx,%eax
+  80196e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801971:	5b                   	pop    %ebx
+  801972:	5e                   	pop    %esi
+  801973:	5f                   	pop    %edi
+  801974:	5d                   	pop    %ebp
+  801975:	c3                   	ret
+
+00801976 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801976:	55                   	push   %ebp
+  801977:	89 e5                	mov    %esp,%ebp
+  801979:	56                   	push   %esi
+  80197a:	53                   	push   %ebx
+  80197b:	83 ec 18             	sub    $0x18,%esp
+  80197e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801981:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801984:	50                   	push   %eax
+  801985:	53                   	push   %ebx
+  801986:	e8 be fc ff ff       	call   801649 <fd_lookup>
+  80198b:	83 c4 10             	add    $0x10,%esp
+  80198e:	85 c0                	test   %eax,%eax
+  801990:	78 37                	js     8019c9 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801992:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801995:	83 ec 08             	sub    $0x8,%esp
+  801998:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80199b:	50                   	push   %eax
+  80199c:	ff 36                	push   (%esi)
+  80199e:	e8 f6 fc ff ff       	call   801699 <dev_lookup>
+  8019a3:	83 c4 10             	add    $0x10,%esp
+  8019a6:	85 c0                	test   %eax,%eax
+  8019a8:	78 1f                	js     8019c9 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019aa:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019ae:	74 20                	je     8019d0 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8019b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019b3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019b6:	85 c0                	test   %eax,%eax
+  8019b8:	74 37                	je     8019f1 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8019ba:	83 ec 04             	sub    $0x4,%esp
+  8019bd:	ff 75 10             	push   0x10(%ebp)
+  8019c0:	ff 75 0c             	push   0xc(%ebp)
+  8019c3:	56                   	push   %esi
+  8019c4:	ff d0                	call   *%eax
+  8019c6:	83 c4 10             	add    $0x10,%esp
+}
+  8019c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019cc:	5b                   	pop    %ebx
+  8019cd:	5e                   	pop    %esi
+  8019ce:	5d                   	pop    %ebp
+  8019cf:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019d0:	a1 24 54 80 00       	mov    0x805424,%eax
+  8019d5:	8b 40 48             	mov    0x48(%eax),%eax
+  8019d8:	83 ec 04             	sub    $0x4,%esp
+  8019db:	53                   	push   %ebx
+  8019dc:	50                   	push   %eax
+  8019dd:	68 15 30 80 00       	push   $0x803015
+  8019e2:	e8 23 ea ff ff       	call   80040a <cprintf>
+		return -E_INVAL;
+  8019e7:	83 c4 10             	add    $0x10,%esp
+  8019ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019ef:	eb d8                	jmp    8019c9 <write+0x53>
+		return -E_NOT_SUPP;
+  8019f1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019f6:	eb d1                	jmp    8019c9 <write+0x53>
+
+008019f8 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8019f8:	55                   	push   %ebp
+  8019f9:	89 e5                	mov    %esp,%ebp
+  8019fb:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a01:	50                   	push   %eax
+  801a02:	ff 75 08             	push   0x8(%ebp)
+  801a05:	e8 3f fc ff ff       	call   801649 <fd_lookup>
+  801a0a:	83 c4 10             	add    $0x10,%esp
+  801a0d:	85 c0                	test   %eax,%eax
+  801a0f:	78 0e                	js     801a1f <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801a11:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a14:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a17:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801a1a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a1f:	c9                   	leave
+  801a20:	c3                   	ret
+
+00801a21 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801a21:	55                   	push   %ebp
+  801a22:	89 e5                	mov    %esp,%ebp
+  801a24:	56                   	push   %esi
+  801a25:	53                   	push   %ebx
+  801a26:	83 ec 18             	sub    $0x18,%esp
+  801a29:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a2c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a2f:	50                   	push   %eax
+  801a30:	53                   	push   %ebx
+  801a31:	e8 13 fc ff ff       	call   801649 <fd_lookup>
+  801a36:	83 c4 10             	add    $0x10,%esp
+  801a39:	85 c0                	test   %eax,%eax
+  801a3b:	78 34                	js     801a71 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a3d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a40:	83 ec 08             	sub    $0x8,%esp
+  801a43:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a46:	50                   	push   %eax
+  801a47:	ff 36                	push   (%esi)
+  801a49:	e8 4b fc ff ff       	call   801699 <dev_lookup>
+  801a4e:	83 c4 10             	add    $0x10,%esp
+  801a51:	85 c0                	test   %eax,%eax
+  801a53:	78 1c                	js     801a71 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a55:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a59:	74 1d                	je     801a78 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801a5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a5e:	8b 40 18             	mov    0x18(%eax),%eax
+  801a61:	85 c0                	test   %eax,%eax
+  801a63:	74 34                	je     801a99 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801a65:	83 ec 08             	sub    $0x8,%esp
+  801a68:	ff 75 0c             	push   0xc(%ebp)
+  801a6b:	56                   	push   %esi
+  801a6c:	ff d0                	call   *%eax
+  801a6e:	83 c4 10             	add    $0x10,%esp
+}
+  801a71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a74:	5b                   	pop    %ebx
+  801a75:	5e                   	pop    %esi
+  801a76:	5d                   	pop    %ebp
+  801a77:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801a78:	a1 24 54 80 00       	mov    0x805424,%eax
+  801a7d:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801a80:	83 ec 04             	sub    $0x4,%esp
+  801a83:	53                   	push   %ebx
+  801a84:	50                   	push   %eax
+  801a85:	68 d8 2f 80 00       	push   $0x802fd8
+  801a8a:	e8 7b e9 ff ff       	call   80040a <cprintf>
+		return -E_INVAL;
+  801a8f:	83 c4 10             	add    $0x10,%esp
+  801a92:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a97:	eb d8                	jmp    801a71 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801a99:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a9e:	eb d1                	jmp    801a71 <ftruncate+0x50>
+
+00801aa0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801aa0:	55                   	push   %ebp
+  801aa1:	89 e5                	mov    %esp,%ebp
+  801aa3:	56                   	push   %esi
+  801aa4:	53                   	push   %ebx
+  801aa5:	83 ec 18             	sub    $0x18,%esp
+  801aa8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801aab:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801aae:	50                   	push   %eax
+  801aaf:	ff 75 08             	push   0x8(%ebp)
+  801ab2:	e8 92 fb ff ff       	call   801649 <fd_lookup>
+  801ab7:	83 c4 10             	add    $0x10,%esp
+  801aba:	85 c0                	test   %eax,%eax
+  801abc:	78 49                	js     801b07 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801abe:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ac1:	83 ec 08             	sub    $0x8,%esp
+  801ac4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ac7:	50                   	push   %eax
+  801ac8:	ff 36                	push   (%esi)
+  801aca:	e8 ca fb ff ff       	call   801699 <dev_lookup>
+  801acf:	83 c4 10             	add    $0x10,%esp
+  801ad2:	85 c0                	test   %eax,%eax
+  801ad4:	78 31                	js     801b07 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801ad6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ad9:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801add:	74 2f                	je     801b0e <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801adf:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801ae2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801ae9:	00 00 00 
+	stat->st_isdir = 0;
+  801aec:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801af3:	00 00 00 
+	stat->st_dev = dev;
+  801af6:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801afc:	83 ec 08             	sub    $0x8,%esp
+  801aff:	53                   	push   %ebx
+  801b00:	56                   	push   %esi
+  801b01:	ff 50 14             	call   *0x14(%eax)
+  801b04:	83 c4 10             	add    $0x10,%esp
+}
+  801b07:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b0a:	5b                   	pop    %ebx
+  801b0b:	5e                   	pop    %esi
+  801b0c:	5d                   	pop    %ebp
+  801b0d:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b0e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b13:	eb f2                	jmp    801b07 <fstat+0x67>
+
+00801b15 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801b15:	55                   	push   %ebp
+  801b16:	89 e5                	mov    %esp,%ebp
+  801b18:	56                   	push   %esi
+  801b19:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801b1a:	83 ec 08             	sub    $0x8,%esp
+  801b1d:	6a 00                	push   $0x0
+  801b1f:	ff 75 08             	push   0x8(%ebp)
+  801b22:	e8 bc 02 00 00       	call   801de3 <open>
+  801b27:	89 c3                	mov    %eax,%ebx
+  801b29:	83 c4 10             	add    $0x10,%esp
+  801b2c:	85 c0                	test   %eax,%eax
+  801b2e:	78 1b                	js     801b4b <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801b30:	83 ec 08             	sub    $0x8,%esp
+  801b33:	ff 75 0c             	push   0xc(%ebp)
+  801b36:	50                   	push   %eax
+  801b37:	e8 64 ff ff ff       	call   801aa0 <fstat>
+  801b3c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801b3e:	89 1c 24             	mov    %ebx,(%esp)
+  801b41:	e8 26 fc ff ff       	call   80176c <close>
+	return r;
+  801b46:	83 c4 10             	add    $0x10,%esp
+  801b49:	89 f3                	mov    %esi,%ebx
+}
+  801b4b:	89 d8                	mov    %ebx,%eax
+  801b4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b50:	5b                   	pop    %ebx
+  801b51:	5e                   	pop    %esi
+  801b52:	5d                   	pop    %ebp
+  801b53:	c3                   	ret
+
+00801b54 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801b54:	55                   	push   %ebp
+  801b55:	89 e5                	mov    %esp,%ebp
+  801b57:	57                   	push   %edi
+  801b58:	56                   	push   %esi
+  801b59:	53                   	push   %ebx
+  801b5a:	83 ec 0c             	sub    $0xc,%esp
+  801b5d:	89 c7                	mov    %eax,%edi
+  801b5f:	89 d3                	mov    %edx,%ebx
+  801b61:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801b63:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801b6a:	74 2d                	je     801b99 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b6c:	6a 07                	push   $0x7
+  801b6e:	68 00 60 80 00       	push   $0x806000
+  801b73:	57                   	push   %edi
+  801b74:	ff 35 00 50 80 00    	push   0x805000
+  801b7a:	e8 91 0c 00 00       	call   802810 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801b7f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801b86:	6a 00                	push   $0x0
+  801b88:	56                   	push   %esi
+  801b89:	53                   	push   %ebx
+  801b8a:	6a 00                	push   $0x0
+  801b8c:	e8 31 0b 00 00       	call   8026c2 <ipc_recv_pages>
+}
+  801b91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b94:	5b                   	pop    %ebx
+  801b95:	5e                   	pop    %esi
+  801b96:	5f                   	pop    %edi
+  801b97:	5d                   	pop    %ebp
+  801b98:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b99:	83 ec 0c             	sub    $0xc,%esp
+  801b9c:	6a 01                	push   $0x1
+  801b9e:	e8 62 0d 00 00       	call   802905 <ipc_find_env>
+  801ba3:	a3 00 50 80 00       	mov    %eax,0x805000
+  801ba8:	83 c4 10             	add    $0x10,%esp
+  801bab:	eb bf                	jmp    801b6c <fsipc_pages+0x18>
+
+00801bad <fsipc>:
+{
+  801bad:	55                   	push   %ebp
+  801bae:	89 e5                	mov    %esp,%ebp
+  801bb0:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801bb3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bb8:	e8 97 ff ff ff       	call   801b54 <fsipc_pages>
+}
+  801bbd:	c9                   	leave
+  801bbe:	c3                   	ret
+
+00801bbf <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801bbf:	55                   	push   %ebp
+  801bc0:	89 e5                	mov    %esp,%ebp
+  801bc2:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801bc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bc8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bcb:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801bd0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bd3:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801bd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bdd:	b8 02 00 00 00       	mov    $0x2,%eax
+  801be2:	e8 c6 ff ff ff       	call   801bad <fsipc>
+}
+  801be7:	c9                   	leave
+  801be8:	c3                   	ret
+
+00801be9 <devfile_flush>:
+{
+  801be9:	55                   	push   %ebp
+  801bea:	89 e5                	mov    %esp,%ebp
+  801bec:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801bef:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bf2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bf5:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801bfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bff:	b8 06 00 00 00       	mov    $0x6,%eax
+  801c04:	e8 a4 ff ff ff       	call   801bad <fsipc>
+}
+  801c09:	c9                   	leave
+  801c0a:	c3                   	ret
+
+00801c0b <devfile_stat>:
+{
+  801c0b:	55                   	push   %ebp
+  801c0c:	89 e5                	mov    %esp,%ebp
+  801c0e:	53                   	push   %ebx
+  801c0f:	83 ec 04             	sub    $0x4,%esp
+  801c12:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801c15:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c18:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c1b:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801c20:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c25:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c2a:	e8 7e ff ff ff       	call   801bad <fsipc>
+  801c2f:	85 c0                	test   %eax,%eax
+  801c31:	78 2c                	js     801c5f <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801c33:	83 ec 08             	sub    $0x8,%esp
+  801c36:	68 00 60 80 00       	push   $0x806000
+  801c3b:	53                   	push   %ebx
+  801c3c:	e8 b0 ed ff ff       	call   8009f1 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801c41:	a1 80 60 80 00       	mov    0x806080,%eax
+  801c46:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801c4c:	a1 84 60 80 00       	mov    0x806084,%eax
+  801c51:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801c57:	83 c4 10             	add    $0x10,%esp
+  801c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c62:	c9                   	leave
+  801c63:	c3                   	ret
+
+00801c64 <devfile_write>:
+{
+  801c64:	55                   	push   %ebp
+  801c65:	89 e5                	mov    %esp,%ebp
+  801c67:	83 ec 0c             	sub    $0xc,%esp
+  801c6a:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801c6d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801c72:	39 d0                	cmp    %edx,%eax
+  801c74:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c77:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c7a:	8b 52 0c             	mov    0xc(%edx),%edx
+  801c7d:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801c83:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801c88:	50                   	push   %eax
+  801c89:	ff 75 0c             	push   0xc(%ebp)
+  801c8c:	68 08 60 80 00       	push   $0x806008
+  801c91:	e8 e1 ee ff ff       	call   800b77 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801c96:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c9b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ca0:	e8 08 ff ff ff       	call   801bad <fsipc>
+}
+  801ca5:	c9                   	leave
+  801ca6:	c3                   	ret
+
+00801ca7 <devfile_read>:
+{
+  801ca7:	55                   	push   %ebp
+  801ca8:	89 e5                	mov    %esp,%ebp
+  801caa:	57                   	push   %edi
+  801cab:	56                   	push   %esi
+  801cac:	53                   	push   %ebx
+  801cad:	83 ec 1c             	sub    $0x1c,%esp
+  801cb0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801cb3:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801cb6:	89 fe                	mov    %edi,%esi
+  801cb8:	c1 ee 0c             	shr    $0xc,%esi
+  801cbb:	b8 20 00 00 00       	mov    $0x20,%eax
+  801cc0:	39 c6                	cmp    %eax,%esi
+  801cc2:	0f 47 f0             	cmova  %eax,%esi
+  801cc5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cc8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ccd:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801cd0:	eb 14                	jmp    801ce6 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801cd2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801cd9:	05 00 10 00 00       	add    $0x1000,%eax
+  801cde:	f6 c6 06             	test   $0x6,%dh
+  801ce1:	75 42                	jne    801d25 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801ce3:	83 c1 01             	add    $0x1,%ecx
+  801ce6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801ce9:	39 f1                	cmp    %esi,%ecx
+  801ceb:	0f 84 95 00 00 00    	je     801d86 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801cf1:	89 c2                	mov    %eax,%edx
+  801cf3:	c1 ea 16             	shr    $0x16,%edx
+  801cf6:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801cfd:	f6 c2 01             	test   $0x1,%dl
+  801d00:	74 23                	je     801d25 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801d02:	89 c2                	mov    %eax,%edx
+  801d04:	c1 ea 0c             	shr    $0xc,%edx
+  801d07:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801d0e:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801d14:	74 0f                	je     801d25 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801d16:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801d1d:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801d23:	75 ad                	jne    801cd2 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801d25:	85 c9                	test   %ecx,%ecx
+  801d27:	74 11                	je     801d3a <devfile_read+0x93>
+  801d29:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801d30:	75 08                	jne    801d3a <devfile_read+0x93>
+  801d32:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801d38:	74 50                	je     801d8a <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801d3a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801d3d:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801d42:	89 3d 04 60 80 00    	mov    %edi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801d48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d4d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d52:	e8 56 fe ff ff       	call   801bad <fsipc>
+  801d57:	89 c6                	mov    %eax,%esi
+  801d59:	85 c0                	test   %eax,%eax
+  801d5b:	78 1f                	js     801d7c <devfile_read+0xd5>
+	assert(r <= n);
+  801d5d:	39 c7                	cmp    %eax,%edi
+  801d5f:	72 50                	jb     801db1 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801d61:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801d66:	7f 62                	jg     801dca <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801d68:	83 ec 04             	sub    $0x4,%esp
+  801d6b:	50                   	push   %eax
+  801d6c:	68 00 60 80 00       	push   $0x806000
+  801d71:	ff 75 0c             	push   0xc(%ebp)
+  801d74:	e8 fe ed ff ff       	call   800b77 <memmove>
+	return r;
+  801d79:	83 c4 10             	add    $0x10,%esp
+}
+  801d7c:	89 f0                	mov    %esi,%eax
+  801d7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d81:	5b                   	pop    %ebx
+  801d82:	5e                   	pop    %esi
+  801d83:	5f                   	pop    %edi
+  801d84:	5d                   	pop    %ebp
+  801d85:	c3                   	ret
+  801d86:	89 f1                	mov    %esi,%ecx
+  801d88:	eb 9b                	jmp    801d25 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801d8a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801d8d:	a3 00 60 80 00       	mov    %eax,0x806000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801d92:	89 c8                	mov    %ecx,%eax
+  801d94:	c1 e0 0c             	shl    $0xc,%eax
+  801d97:	a3 04 60 80 00       	mov    %eax,0x806004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801d9c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d9f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801da4:	e8 ab fd ff ff       	call   801b54 <fsipc_pages>
+  801da9:	89 c6                	mov    %eax,%esi
+  801dab:	85 c0                	test   %eax,%eax
+  801dad:	78 8b                	js     801d3a <devfile_read+0x93>
+  801daf:	eb cb                	jmp    801d7c <devfile_read+0xd5>
+	assert(r <= n);
+  801db1:	68 44 30 80 00       	push   $0x803044
+  801db6:	68 4b 30 80 00       	push   $0x80304b
+  801dbb:	68 a0 00 00 00       	push   $0xa0
+  801dc0:	68 60 30 80 00       	push   $0x803060
+  801dc5:	e8 65 e5 ff ff       	call   80032f <_panic>
+	assert(r <= PGSIZE);
+  801dca:	68 6b 30 80 00       	push   $0x80306b
+  801dcf:	68 4b 30 80 00       	push   $0x80304b
+  801dd4:	68 a1 00 00 00       	push   $0xa1
+  801dd9:	68 60 30 80 00       	push   $0x803060
+  801dde:	e8 4c e5 ff ff       	call   80032f <_panic>
+
+00801de3 <open>:
+{
+  801de3:	55                   	push   %ebp
+  801de4:	89 e5                	mov    %esp,%ebp
+  801de6:	56                   	push   %esi
+  801de7:	53                   	push   %ebx
+  801de8:	83 ec 1c             	sub    $0x1c,%esp
+  801deb:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801dee:	56                   	push   %esi
+  801def:	e8 c2 eb ff ff       	call   8009b6 <strlen>
+  801df4:	83 c4 10             	add    $0x10,%esp
+  801df7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801dfc:	7f 6c                	jg     801e6a <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801dfe:	83 ec 0c             	sub    $0xc,%esp
+  801e01:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e04:	50                   	push   %eax
+  801e05:	e8 eb f7 ff ff       	call   8015f5 <fd_alloc>
+  801e0a:	89 c3                	mov    %eax,%ebx
+  801e0c:	83 c4 10             	add    $0x10,%esp
+  801e0f:	85 c0                	test   %eax,%eax
+  801e11:	78 3c                	js     801e4f <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801e13:	83 ec 08             	sub    $0x8,%esp
+  801e16:	56                   	push   %esi
+  801e17:	68 00 60 80 00       	push   $0x806000
+  801e1c:	e8 d0 eb ff ff       	call   8009f1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801e21:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e24:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801e29:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e2c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e31:	e8 77 fd ff ff       	call   801bad <fsipc>
+  801e36:	89 c3                	mov    %eax,%ebx
+  801e38:	83 c4 10             	add    $0x10,%esp
+  801e3b:	85 c0                	test   %eax,%eax
+  801e3d:	78 19                	js     801e58 <open+0x75>
+	return fd2num(fd);
+  801e3f:	83 ec 0c             	sub    $0xc,%esp
+  801e42:	ff 75 f4             	push   -0xc(%ebp)
+  801e45:	e8 84 f7 ff ff       	call   8015ce <fd2num>
+  801e4a:	89 c3                	mov    %eax,%ebx
+  801e4c:	83 c4 10             	add    $0x10,%esp
+}
+  801e4f:	89 d8                	mov    %ebx,%eax
+  801e51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e54:	5b                   	pop    %ebx
+  801e55:	5e                   	pop    %esi
+  801e56:	5d                   	pop    %ebp
+  801e57:	c3                   	ret
+		fd_close(fd, 0);
+  801e58:	83 ec 08             	sub    $0x8,%esp
+  801e5b:	6a 00                	push   $0x0
+  801e5d:	ff 75 f4             	push   -0xc(%ebp)
+  801e60:	e8 80 f8 ff ff       	call   8016e5 <fd_close>
+		return r;
+  801e65:	83 c4 10             	add    $0x10,%esp
+  801e68:	eb e5                	jmp    801e4f <open+0x6c>
+		return -E_BAD_PATH;
+  801e6a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e6f:	eb de                	jmp    801e4f <open+0x6c>
+
+00801e71 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801e71:	55                   	push   %ebp
+  801e72:	89 e5                	mov    %esp,%ebp
+  801e74:	53                   	push   %ebx
+  801e75:	83 ec 10             	sub    $0x10,%esp
+  801e78:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801e7b:	53                   	push   %ebx
+  801e7c:	e8 35 eb ff ff       	call   8009b6 <strlen>
+  801e81:	83 c4 10             	add    $0x10,%esp
+  801e84:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e89:	7f 25                	jg     801eb0 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801e8b:	83 ec 08             	sub    $0x8,%esp
+  801e8e:	53                   	push   %ebx
+  801e8f:	68 00 60 80 00       	push   $0x806000
+  801e94:	e8 58 eb ff ff       	call   8009f1 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801e99:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e9e:	b8 07 00 00 00       	mov    $0x7,%eax
+  801ea3:	e8 05 fd ff ff       	call   801bad <fsipc>
+  801ea8:	83 c4 10             	add    $0x10,%esp
+}
+  801eab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eae:	c9                   	leave
+  801eaf:	c3                   	ret
+		return -E_BAD_PATH;
+  801eb0:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801eb5:	eb f4                	jmp    801eab <remove+0x3a>
+
+00801eb7 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801eb7:	55                   	push   %ebp
+  801eb8:	89 e5                	mov    %esp,%ebp
+  801eba:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801ebd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec2:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ec7:	e8 e1 fc ff ff       	call   801bad <fsipc>
+}
+  801ecc:	c9                   	leave
+  801ecd:	c3                   	ret
+
+00801ece <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801ece:	55                   	push   %ebp
+  801ecf:	89 e5                	mov    %esp,%ebp
+  801ed1:	53                   	push   %ebx
+  801ed2:	83 ec 04             	sub    $0x4,%esp
+  801ed5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801ed8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801edd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801ee2:	e8 c6 fc ff ff       	call   801bad <fsipc>
+  801ee7:	85 c0                	test   %eax,%eax
+  801ee9:	78 3c                	js     801f27 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801eeb:	a1 00 60 80 00       	mov    0x806000,%eax
+  801ef0:	89 03                	mov    %eax,(%ebx)
+  801ef2:	a1 04 60 80 00       	mov    0x806004,%eax
+  801ef7:	89 43 04             	mov    %eax,0x4(%ebx)
+  801efa:	a1 08 60 80 00       	mov    0x806008,%eax
+  801eff:	89 43 08             	mov    %eax,0x8(%ebx)
+  801f02:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  801f07:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801f0a:	a1 10 60 80 00       	mov    0x806010,%eax
+  801f0f:	89 43 10             	mov    %eax,0x10(%ebx)
+  801f12:	a1 14 60 80 00       	mov    0x806014,%eax
+  801f17:	89 43 14             	mov    %eax,0x14(%ebx)
+  801f1a:	a1 18 60 80 00       	mov    0x806018,%eax
+  801f1f:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801f22:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f2a:	c9                   	leave
+  801f2b:	c3                   	ret
+
+00801f2c <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801f2c:	55                   	push   %ebp
+  801f2d:	89 e5                	mov    %esp,%ebp
+  801f2f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801f32:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f35:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_BCSET, NULL);
+  801f3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801f44:	e8 64 fc ff ff       	call   801bad <fsipc>
+}
+  801f49:	c9                   	leave
+  801f4a:	c3                   	ret
+
+00801f4b <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  801f4b:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801f4f:	7f 01                	jg     801f52 <writebuf+0x7>
+  801f51:	c3                   	ret
+{
+  801f52:	55                   	push   %ebp
+  801f53:	89 e5                	mov    %esp,%ebp
+  801f55:	53                   	push   %ebx
+  801f56:	83 ec 08             	sub    $0x8,%esp
+  801f59:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  801f5b:	ff 70 04             	push   0x4(%eax)
+  801f5e:	8d 40 10             	lea    0x10(%eax),%eax
+  801f61:	50                   	push   %eax
+  801f62:	ff 33                	push   (%ebx)
+  801f64:	e8 0d fa ff ff       	call   801976 <write>
+		if (result > 0)
+  801f69:	83 c4 10             	add    $0x10,%esp
+  801f6c:	85 c0                	test   %eax,%eax
+  801f6e:	7e 03                	jle    801f73 <writebuf+0x28>
+			b->result += result;
+  801f70:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  801f73:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801f76:	74 0d                	je     801f85 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  801f78:	85 c0                	test   %eax,%eax
+  801f7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f7f:	0f 4f c2             	cmovg  %edx,%eax
+  801f82:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  801f85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f88:	c9                   	leave
+  801f89:	c3                   	ret
+
+00801f8a <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801f8a:	55                   	push   %ebp
+  801f8b:	89 e5                	mov    %esp,%ebp
+  801f8d:	53                   	push   %ebx
+  801f8e:	83 ec 04             	sub    $0x4,%esp
+  801f91:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801f94:	8b 53 04             	mov    0x4(%ebx),%edx
+  801f97:	8d 42 01             	lea    0x1(%edx),%eax
+  801f9a:	89 43 04             	mov    %eax,0x4(%ebx)
+  801f9d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fa0:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801fa4:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801fa9:	74 05                	je     801fb0 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801fab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fae:	c9                   	leave
+  801faf:	c3                   	ret
+		writebuf(b);
+  801fb0:	89 d8                	mov    %ebx,%eax
+  801fb2:	e8 94 ff ff ff       	call   801f4b <writebuf>
+		b->idx = 0;
+  801fb7:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801fbe:	eb eb                	jmp    801fab <putch+0x21>
+
+00801fc0 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801fc0:	55                   	push   %ebp
+  801fc1:	89 e5                	mov    %esp,%ebp
+  801fc3:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801fc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fcc:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801fd2:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801fd9:	00 00 00 
+	b.result = 0;
+  801fdc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801fe3:	00 00 00 
+	b.error = 1;
+  801fe6:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801fed:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801ff0:	ff 75 10             	push   0x10(%ebp)
+  801ff3:	ff 75 0c             	push   0xc(%ebp)
+  801ff6:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801ffc:	50                   	push   %eax
+  801ffd:	68 8a 1f 80 00       	push   $0x801f8a
+  802002:	e8 fa e4 ff ff       	call   800501 <vprintfmt>
+	if (b.idx > 0)
+  802007:	83 c4 10             	add    $0x10,%esp
+  80200a:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  802011:	7f 12                	jg     802025 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  802013:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  802019:	85 c0                	test   %eax,%eax
+  80201b:	75 06                	jne    802023 <vfprintf+0x63>
+  80201d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  802023:	c9                   	leave
+  802024:	c3                   	ret
+		writebuf(&b);
+  802025:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80202b:	e8 1b ff ff ff       	call   801f4b <writebuf>
+  802030:	eb e1                	jmp    802013 <vfprintf+0x53>
+
+00802032 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  802032:	55                   	push   %ebp
+  802033:	89 e5                	mov    %esp,%ebp
+  802035:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802038:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  80203b:	50                   	push   %eax
+  80203c:	ff 75 0c             	push   0xc(%ebp)
+  80203f:	ff 75 08             	push   0x8(%ebp)
+  802042:	e8 79 ff ff ff       	call   801fc0 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802047:	c9                   	leave
+  802048:	c3                   	ret
+
+00802049 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  802049:	55                   	push   %ebp
+  80204a:	89 e5                	mov    %esp,%ebp
+  80204c:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80204f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  802052:	50                   	push   %eax
+  802053:	ff 75 08             	push   0x8(%ebp)
+  802056:	6a 01                	push   $0x1
+  802058:	e8 63 ff ff ff       	call   801fc0 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80205d:	c9                   	leave
+  80205e:	c3                   	ret
+
+0080205f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80205f:	55                   	push   %ebp
+  802060:	89 e5                	mov    %esp,%ebp
+  802062:	56                   	push   %esi
+  802063:	53                   	push   %ebx
+  802064:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802067:	83 ec 0c             	sub    $0xc,%esp
+  80206a:	ff 75 08             	push   0x8(%ebp)
+  80206d:	e8 6c f5 ff ff       	call   8015de <fd2data>
+  802072:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802074:	83 c4 08             	add    $0x8,%esp
+  802077:	68 77 30 80 00       	push   $0x803077
+  80207c:	53                   	push   %ebx
+  80207d:	e8 6f e9 ff ff       	call   8009f1 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802082:	8b 46 04             	mov    0x4(%esi),%eax
+  802085:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  80208b:	2b 0e                	sub    (%esi),%ecx
+  80208d:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802092:	89 c8                	mov    %ecx,%eax
+  802094:	f7 e2                	mul    %edx
+  802096:	c1 ea 0c             	shr    $0xc,%edx
+  802099:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80209f:	29 d1                	sub    %edx,%ecx
+  8020a1:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8020a7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020ae:	00 00 00 
+	stat->st_dev = &devpipe;
+  8020b1:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8020b8:	40 80 00 
+	return 0;
+}
+  8020bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020c3:	5b                   	pop    %ebx
+  8020c4:	5e                   	pop    %esi
+  8020c5:	5d                   	pop    %ebp
+  8020c6:	c3                   	ret
+
+008020c7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020c7:	55                   	push   %ebp
+  8020c8:	89 e5                	mov    %esp,%ebp
+  8020ca:	53                   	push   %ebx
+  8020cb:	83 ec 0c             	sub    $0xc,%esp
+  8020ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8020d1:	53                   	push   %ebx
+  8020d2:	6a 00                	push   $0x0
+  8020d4:	e8 90 ee ff ff       	call   800f69 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8020d9:	89 1c 24             	mov    %ebx,(%esp)
+  8020dc:	e8 fd f4 ff ff       	call   8015de <fd2data>
+  8020e1:	83 c4 08             	add    $0x8,%esp
+  8020e4:	50                   	push   %eax
+  8020e5:	6a 00                	push   $0x0
+  8020e7:	e8 7d ee ff ff       	call   800f69 <sys_page_unmap>
+}
+  8020ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020ef:	c9                   	leave
+  8020f0:	c3                   	ret
+
+008020f1 <_pipeisclosed>:
+{
+  8020f1:	55                   	push   %ebp
+  8020f2:	89 e5                	mov    %esp,%ebp
+  8020f4:	57                   	push   %edi
+  8020f5:	56                   	push   %esi
+  8020f6:	53                   	push   %ebx
+  8020f7:	83 ec 1c             	sub    $0x1c,%esp
+  8020fa:	89 c7                	mov    %eax,%edi
+  8020fc:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8020fe:	a1 24 54 80 00       	mov    0x805424,%eax
+  802103:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802106:	83 ec 0c             	sub    $0xc,%esp
+  802109:	57                   	push   %edi
+  80210a:	e8 35 08 00 00       	call   802944 <pageref>
+  80210f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802112:	89 34 24             	mov    %esi,(%esp)
+  802115:	e8 2a 08 00 00       	call   802944 <pageref>
+		nn = thisenv->env_runs;
+  80211a:	8b 15 24 54 80 00    	mov    0x805424,%edx
+  802120:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802123:	83 c4 10             	add    $0x10,%esp
+  802126:	39 cb                	cmp    %ecx,%ebx
+  802128:	74 1b                	je     802145 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80212a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80212d:	75 cf                	jne    8020fe <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80212f:	8b 42 58             	mov    0x58(%edx),%eax
+  802132:	6a 01                	push   $0x1
+  802134:	50                   	push   %eax
+  802135:	53                   	push   %ebx
+  802136:	68 7e 30 80 00       	push   $0x80307e
+  80213b:	e8 ca e2 ff ff       	call   80040a <cprintf>
+  802140:	83 c4 10             	add    $0x10,%esp
+  802143:	eb b9                	jmp    8020fe <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802145:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802148:	0f 94 c0             	sete   %al
+  80214b:	0f b6 c0             	movzbl %al,%eax
+}
+  80214e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802151:	5b                   	pop    %ebx
+  802152:	5e                   	pop    %esi
+  802153:	5f                   	pop    %edi
+  802154:	5d                   	pop    %ebp
+  802155:	c3                   	ret
+
+00802156 <devpipe_read>:
+{
+  802156:	55                   	push   %ebp
+  802157:	89 e5                	mov    %esp,%ebp
+  802159:	57                   	push   %edi
+  80215a:	56                   	push   %esi
+  80215b:	53                   	push   %ebx
+  80215c:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80215f:	ff 75 08             	push   0x8(%ebp)
+  802162:	e8 77 f4 ff ff       	call   8015de <fd2data>
+  802167:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  802169:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  80216c:	8d 40 04             	lea    0x4(%eax),%eax
+  80216f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802172:	8b 7b 04             	mov    0x4(%ebx),%edi
+  802175:	8b 0b                	mov    (%ebx),%ecx
+  802177:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  80217d:	29 ce                	sub    %ecx,%esi
+  80217f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802184:	f7 e6                	mul    %esi
+  802186:	c1 ea 0c             	shr    $0xc,%edx
+  802189:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  80218f:	29 c6                	sub    %eax,%esi
+  802191:	89 f2                	mov    %esi,%edx
+  802193:	75 43                	jne    8021d8 <devpipe_read+0x82>
+		ref = pageref(p);
+  802195:	83 ec 0c             	sub    $0xc,%esp
+  802198:	53                   	push   %ebx
+  802199:	e8 a6 07 00 00       	call   802944 <pageref>
+  80219e:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8021a0:	89 da                	mov    %ebx,%edx
+  8021a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a5:	e8 47 ff ff ff       	call   8020f1 <_pipeisclosed>
+  8021aa:	83 c4 10             	add    $0x10,%esp
+  8021ad:	85 c0                	test   %eax,%eax
+  8021af:	0f 85 c1 00 00 00    	jne    802276 <devpipe_read+0x120>
+	*sleeping = 1;
+  8021b5:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  8021bc:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8021c1:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  8021c4:	75 ac                	jne    802172 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  8021c6:	83 ec 04             	sub    $0x4,%esp
+  8021c9:	56                   	push   %esi
+  8021ca:	57                   	push   %edi
+  8021cb:	ff 75 e4             	push   -0x1c(%ebp)
+  8021ce:	e8 ea f1 ff ff       	call   8013bd <sys_futex_wait>
+  8021d3:	83 c4 10             	add    $0x10,%esp
+  8021d6:	eb 9a                	jmp    802172 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  8021d8:	39 75 10             	cmp    %esi,0x10(%ebp)
+  8021db:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  8021df:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8021e1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021e6:	f7 e1                	mul    %ecx
+  8021e8:	c1 ea 0b             	shr    $0xb,%edx
+  8021eb:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8021f1:	29 c1                	sub    %eax,%ecx
+  8021f3:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  8021f5:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8021fa:	29 cf                	sub    %ecx,%edi
+  8021fc:	39 f7                	cmp    %esi,%edi
+  8021fe:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  802201:	8d 43 10             	lea    0x10(%ebx),%eax
+  802204:	83 ec 04             	sub    $0x4,%esp
+  802207:	57                   	push   %edi
+  802208:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80220b:	01 c2                	add    %eax,%edx
+  80220d:	52                   	push   %edx
+  80220e:	ff 75 0c             	push   0xc(%ebp)
+  802211:	e8 61 e9 ff ff       	call   800b77 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  802216:	83 c4 0c             	add    $0xc,%esp
+  802219:	89 f1                	mov    %esi,%ecx
+  80221b:	29 f9                	sub    %edi,%ecx
+  80221d:	51                   	push   %ecx
+  80221e:	ff 75 e4             	push   -0x1c(%ebp)
+  802221:	89 f8                	mov    %edi,%eax
+  802223:	03 45 0c             	add    0xc(%ebp),%eax
+  802226:	50                   	push   %eax
+  802227:	e8 4b e9 ff ff       	call   800b77 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  80222c:	89 f1                	mov    %esi,%ecx
+  80222e:	03 0b                	add    (%ebx),%ecx
+  802230:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802235:	f7 e1                	mul    %ecx
+  802237:	c1 ea 0c             	shr    $0xc,%edx
+  80223a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802240:	29 d1                	sub    %edx,%ecx
+  802242:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  802244:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802249:	83 c4 10             	add    $0x10,%esp
+  80224c:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  802250:	75 0a                	jne    80225c <devpipe_read+0x106>
+	return n;
+  802252:	89 f0                	mov    %esi,%eax
+}
+  802254:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802257:	5b                   	pop    %ebx
+  802258:	5e                   	pop    %esi
+  802259:	5f                   	pop    %edi
+  80225a:	5d                   	pop    %ebp
+  80225b:	c3                   	ret
+		*sleeping = 0;
+  80225c:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  802263:	83 ec 08             	sub    $0x8,%esp
+  802266:	68 00 04 00 00       	push   $0x400
+  80226b:	53                   	push   %ebx
+  80226c:	e8 9c f1 ff ff       	call   80140d <sys_futex_wake>
+  802271:	83 c4 10             	add    $0x10,%esp
+  802274:	eb dc                	jmp    802252 <devpipe_read+0xfc>
+			return 0;
+  802276:	b8 00 00 00 00       	mov    $0x0,%eax
+  80227b:	eb d7                	jmp    802254 <devpipe_read+0xfe>
+
+0080227d <devpipe_write>:
+{
+  80227d:	55                   	push   %ebp
+  80227e:	89 e5                	mov    %esp,%ebp
+  802280:	57                   	push   %edi
+  802281:	56                   	push   %esi
+  802282:	53                   	push   %ebx
+  802283:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802286:	ff 75 08             	push   0x8(%ebp)
+  802289:	e8 50 f3 ff ff       	call   8015de <fd2data>
+  80228e:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  802290:	83 c4 10             	add    $0x10,%esp
+  802293:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80229a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80229d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8022a0:	0f 83 23 01 00 00    	jae    8023c9 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8022a6:	8b 77 04             	mov    0x4(%edi),%esi
+  8022a9:	8b 1f                	mov    (%edi),%ebx
+  8022ab:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  8022b1:	29 d9                	sub    %ebx,%ecx
+  8022b3:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8022b8:	f7 e1                	mul    %ecx
+  8022ba:	c1 ea 0c             	shr    $0xc,%edx
+  8022bd:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8022c3:	29 c1                	sub    %eax,%ecx
+  8022c5:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8022c7:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8022cd:	75 40                	jne    80230f <devpipe_write+0x92>
+			ref = pageref(p);
+  8022cf:	83 ec 0c             	sub    $0xc,%esp
+  8022d2:	57                   	push   %edi
+  8022d3:	e8 6c 06 00 00       	call   802944 <pageref>
+  8022d8:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  8022da:	89 fa                	mov    %edi,%edx
+  8022dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022df:	e8 0d fe ff ff       	call   8020f1 <_pipeisclosed>
+  8022e4:	83 c4 10             	add    $0x10,%esp
+  8022e7:	85 c0                	test   %eax,%eax
+  8022e9:	0f 85 d5 00 00 00    	jne    8023c4 <devpipe_write+0x147>
+	*sleeping = 1;
+  8022ef:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  8022f6:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8022fb:	39 1f                	cmp    %ebx,(%edi)
+  8022fd:	75 a7                	jne    8022a6 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  8022ff:	83 ec 04             	sub    $0x4,%esp
+  802302:	56                   	push   %esi
+  802303:	53                   	push   %ebx
+  802304:	57                   	push   %edi
+  802305:	e8 b3 f0 ff ff       	call   8013bd <sys_futex_wait>
+  80230a:	83 c4 10             	add    $0x10,%esp
+  80230d:	eb 97                	jmp    8022a6 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80230f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802312:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802315:	29 c1                	sub    %eax,%ecx
+  802317:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80231c:	89 d8                	mov    %ebx,%eax
+  80231e:	29 d0                	sub    %edx,%eax
+  802320:	39 c1                	cmp    %eax,%ecx
+  802322:	0f 46 c1             	cmovbe %ecx,%eax
+  802325:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  802327:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80232c:	f7 e6                	mul    %esi
+  80232e:	c1 ea 0b             	shr    $0xb,%edx
+  802331:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802337:	29 c6                	sub    %eax,%esi
+  802339:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80233b:	29 f3                	sub    %esi,%ebx
+  80233d:	39 cb                	cmp    %ecx,%ebx
+  80233f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802342:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  802345:	8d 77 10             	lea    0x10(%edi),%esi
+  802348:	83 ec 04             	sub    $0x4,%esp
+  80234b:	53                   	push   %ebx
+  80234c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80234f:	03 45 0c             	add    0xc(%ebp),%eax
+  802352:	50                   	push   %eax
+  802353:	01 f2                	add    %esi,%edx
+  802355:	52                   	push   %edx
+  802356:	e8 1c e8 ff ff       	call   800b77 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80235b:	83 c4 0c             	add    $0xc,%esp
+  80235e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802361:	29 d8                	sub    %ebx,%eax
+  802363:	50                   	push   %eax
+  802364:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802367:	01 d3                	add    %edx,%ebx
+  802369:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80236c:	53                   	push   %ebx
+  80236d:	56                   	push   %esi
+  80236e:	e8 04 e8 ff ff       	call   800b77 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802373:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802376:	03 4f 04             	add    0x4(%edi),%ecx
+  802379:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80237e:	f7 e1                	mul    %ecx
+  802380:	c1 ea 0c             	shr    $0xc,%edx
+  802383:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802389:	29 d1                	sub    %edx,%ecx
+  80238b:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  80238e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802393:	83 c4 10             	add    $0x10,%esp
+  802396:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  80239a:	75 0b                	jne    8023a7 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  80239c:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  80239f:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8023a2:	e9 f3 fe ff ff       	jmp    80229a <devpipe_write+0x1d>
+		*sleeping = 0;
+  8023a7:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8023ae:	83 ec 08             	sub    $0x8,%esp
+  8023b1:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  8023b6:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  8023b9:	50                   	push   %eax
+  8023ba:	e8 4e f0 ff ff       	call   80140d <sys_futex_wake>
+  8023bf:	83 c4 10             	add    $0x10,%esp
+  8023c2:	eb d8                	jmp    80239c <devpipe_write+0x11f>
+				return 0;
+  8023c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023cc:	5b                   	pop    %ebx
+  8023cd:	5e                   	pop    %esi
+  8023ce:	5f                   	pop    %edi
+  8023cf:	5d                   	pop    %ebp
+  8023d0:	c3                   	ret
+
+008023d1 <pipe>:
+{
+  8023d1:	55                   	push   %ebp
+  8023d2:	89 e5                	mov    %esp,%ebp
+  8023d4:	56                   	push   %esi
+  8023d5:	53                   	push   %ebx
+  8023d6:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8023d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023dc:	50                   	push   %eax
+  8023dd:	e8 13 f2 ff ff       	call   8015f5 <fd_alloc>
+  8023e2:	89 c3                	mov    %eax,%ebx
+  8023e4:	83 c4 10             	add    $0x10,%esp
+  8023e7:	85 c0                	test   %eax,%eax
+  8023e9:	0f 88 23 01 00 00    	js     802512 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8023ef:	83 ec 04             	sub    $0x4,%esp
+  8023f2:	68 07 04 00 00       	push   $0x407
+  8023f7:	ff 75 f4             	push   -0xc(%ebp)
+  8023fa:	6a 00                	push   $0x0
+  8023fc:	e8 e3 ea ff ff       	call   800ee4 <sys_page_alloc>
+  802401:	89 c3                	mov    %eax,%ebx
+  802403:	83 c4 10             	add    $0x10,%esp
+  802406:	85 c0                	test   %eax,%eax
+  802408:	0f 88 04 01 00 00    	js     802512 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80240e:	83 ec 0c             	sub    $0xc,%esp
+  802411:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802414:	50                   	push   %eax
+  802415:	e8 db f1 ff ff       	call   8015f5 <fd_alloc>
+  80241a:	89 c3                	mov    %eax,%ebx
+  80241c:	83 c4 10             	add    $0x10,%esp
+  80241f:	85 c0                	test   %eax,%eax
+  802421:	0f 88 db 00 00 00    	js     802502 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802427:	83 ec 04             	sub    $0x4,%esp
+  80242a:	68 07 04 00 00       	push   $0x407
+  80242f:	ff 75 f0             	push   -0x10(%ebp)
+  802432:	6a 00                	push   $0x0
+  802434:	e8 ab ea ff ff       	call   800ee4 <sys_page_alloc>
+  802439:	89 c3                	mov    %eax,%ebx
+  80243b:	83 c4 10             	add    $0x10,%esp
+  80243e:	85 c0                	test   %eax,%eax
+  802440:	0f 88 bc 00 00 00    	js     802502 <pipe+0x131>
+	va = fd2data(fd0);
+  802446:	83 ec 0c             	sub    $0xc,%esp
+  802449:	ff 75 f4             	push   -0xc(%ebp)
+  80244c:	e8 8d f1 ff ff       	call   8015de <fd2data>
+  802451:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802453:	83 c4 0c             	add    $0xc,%esp
+  802456:	68 07 04 00 00       	push   $0x407
+  80245b:	50                   	push   %eax
+  80245c:	6a 00                	push   $0x0
+  80245e:	e8 81 ea ff ff       	call   800ee4 <sys_page_alloc>
+  802463:	89 c3                	mov    %eax,%ebx
+  802465:	83 c4 10             	add    $0x10,%esp
+  802468:	85 c0                	test   %eax,%eax
+  80246a:	0f 88 82 00 00 00    	js     8024f2 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802470:	83 ec 0c             	sub    $0xc,%esp
+  802473:	ff 75 f0             	push   -0x10(%ebp)
+  802476:	e8 63 f1 ff ff       	call   8015de <fd2data>
+  80247b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802482:	50                   	push   %eax
+  802483:	6a 00                	push   $0x0
+  802485:	56                   	push   %esi
+  802486:	6a 00                	push   $0x0
+  802488:	e8 9a ea ff ff       	call   800f27 <sys_page_map>
+  80248d:	89 c3                	mov    %eax,%ebx
+  80248f:	83 c4 20             	add    $0x20,%esp
+  802492:	85 c0                	test   %eax,%eax
+  802494:	78 4e                	js     8024e4 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802496:	a1 20 40 80 00       	mov    0x804020,%eax
+  80249b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80249e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8024a0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8024a3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8024aa:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8024ad:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8024af:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8024b2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8024b9:	83 ec 0c             	sub    $0xc,%esp
+  8024bc:	ff 75 f4             	push   -0xc(%ebp)
+  8024bf:	e8 0a f1 ff ff       	call   8015ce <fd2num>
+  8024c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8024c7:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8024c9:	83 c4 04             	add    $0x4,%esp
+  8024cc:	ff 75 f0             	push   -0x10(%ebp)
+  8024cf:	e8 fa f0 ff ff       	call   8015ce <fd2num>
+  8024d4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8024d7:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8024da:	83 c4 10             	add    $0x10,%esp
+  8024dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024e2:	eb 2e                	jmp    802512 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8024e4:	83 ec 08             	sub    $0x8,%esp
+  8024e7:	56                   	push   %esi
+  8024e8:	6a 00                	push   $0x0
+  8024ea:	e8 7a ea ff ff       	call   800f69 <sys_page_unmap>
+  8024ef:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8024f2:	83 ec 08             	sub    $0x8,%esp
+  8024f5:	ff 75 f0             	push   -0x10(%ebp)
+  8024f8:	6a 00                	push   $0x0
+  8024fa:	e8 6a ea ff ff       	call   800f69 <sys_page_unmap>
+  8024ff:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802502:	83 ec 08             	sub    $0x8,%esp
+  802505:	ff 75 f4             	push   -0xc(%ebp)
+  802508:	6a 00                	push   $0x0
+  80250a:	e8 5a ea ff ff       	call   800f69 <sys_page_unmap>
+  80250f:	83 c4 10             	add    $0x10,%esp
+}
+  802512:	89 d8                	mov    %ebx,%eax
+  802514:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802517:	5b                   	pop    %ebx
+  802518:	5e                   	pop    %esi
+  802519:	5d                   	pop    %ebp
+  80251a:	c3                   	ret
+
+0080251b <pipeisclosed>:
+{
+  80251b:	55                   	push   %ebp
+  80251c:	89 e5                	mov    %esp,%ebp
+  80251e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802521:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802524:	50                   	push   %eax
+  802525:	ff 75 08             	push   0x8(%ebp)
+  802528:	e8 1c f1 ff ff       	call   801649 <fd_lookup>
+  80252d:	83 c4 10             	add    $0x10,%esp
+  802530:	85 c0                	test   %eax,%eax
+  802532:	78 18                	js     80254c <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802534:	83 ec 0c             	sub    $0xc,%esp
+  802537:	ff 75 f4             	push   -0xc(%ebp)
+  80253a:	e8 9f f0 ff ff       	call   8015de <fd2data>
+  80253f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802541:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802544:	e8 a8 fb ff ff       	call   8020f1 <_pipeisclosed>
+  802549:	83 c4 10             	add    $0x10,%esp
+}
+  80254c:	c9                   	leave
+  80254d:	c3                   	ret
+
+0080254e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80254e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802553:	c3                   	ret
+
+00802554 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802554:	55                   	push   %ebp
+  802555:	89 e5                	mov    %esp,%ebp
+  802557:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80255a:	68 96 30 80 00       	push   $0x803096
+  80255f:	ff 75 0c             	push   0xc(%ebp)
+  802562:	e8 8a e4 ff ff       	call   8009f1 <strcpy>
+	return 0;
+}
+  802567:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256c:	c9                   	leave
+  80256d:	c3                   	ret
+
+0080256e <devcons_write>:
+{
+  80256e:	55                   	push   %ebp
+  80256f:	89 e5                	mov    %esp,%ebp
+  802571:	57                   	push   %edi
+  802572:	56                   	push   %esi
+  802573:	53                   	push   %ebx
+  802574:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80257a:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80257f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802585:	eb 2e                	jmp    8025b5 <devcons_write+0x47>
+		m = n - tot;
+  802587:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80258a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80258c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802591:	39 c3                	cmp    %eax,%ebx
+  802593:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802596:	83 ec 04             	sub    $0x4,%esp
+  802599:	53                   	push   %ebx
+  80259a:	89 f0                	mov    %esi,%eax
+  80259c:	03 45 0c             	add    0xc(%ebp),%eax
+  80259f:	50                   	push   %eax
+  8025a0:	57                   	push   %edi
+  8025a1:	e8 d1 e5 ff ff       	call   800b77 <memmove>
+		sys_cputs(buf, m);
+  8025a6:	83 c4 08             	add    $0x8,%esp
+  8025a9:	53                   	push   %ebx
+  8025aa:	57                   	push   %edi
+  8025ab:	e8 67 e8 ff ff       	call   800e17 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8025b0:	01 de                	add    %ebx,%esi
+  8025b2:	83 c4 10             	add    $0x10,%esp
+  8025b5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8025b8:	72 cd                	jb     802587 <devcons_write+0x19>
+}
+  8025ba:	89 f0                	mov    %esi,%eax
+  8025bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025bf:	5b                   	pop    %ebx
+  8025c0:	5e                   	pop    %esi
+  8025c1:	5f                   	pop    %edi
+  8025c2:	5d                   	pop    %ebp
+  8025c3:	c3                   	ret
+
+008025c4 <devcons_read>:
+{
+  8025c4:	55                   	push   %ebp
+  8025c5:	89 e5                	mov    %esp,%ebp
+  8025c7:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8025ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025cf:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8025d3:	75 07                	jne    8025dc <devcons_read+0x18>
+  8025d5:	eb 1f                	jmp    8025f6 <devcons_read+0x32>
+		sys_yield();
+  8025d7:	e8 e9 e8 ff ff       	call   800ec5 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8025dc:	e8 65 e8 ff ff       	call   800e46 <sys_cgetc>
+  8025e1:	85 c0                	test   %eax,%eax
+  8025e3:	74 f2                	je     8025d7 <devcons_read+0x13>
+	if (c < 0)
+  8025e5:	78 0f                	js     8025f6 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8025e7:	83 f8 04             	cmp    $0x4,%eax
+  8025ea:	74 0c                	je     8025f8 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8025ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8025ef:	88 02                	mov    %al,(%edx)
+	return 1;
+  8025f1:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8025f6:	c9                   	leave
+  8025f7:	c3                   	ret
+		return 0;
+  8025f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025fd:	eb f7                	jmp    8025f6 <devcons_read+0x32>
+
+008025ff <cputchar>:
+{
+  8025ff:	55                   	push   %ebp
+  802600:	89 e5                	mov    %esp,%ebp
+  802602:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802605:	8b 45 08             	mov    0x8(%ebp),%eax
+  802608:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80260b:	6a 01                	push   $0x1
+  80260d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802610:	50                   	push   %eax
+  802611:	e8 01 e8 ff ff       	call   800e17 <sys_cputs>
+}
+  802616:	83 c4 10             	add    $0x10,%esp
+  802619:	c9                   	leave
+  80261a:	c3                   	ret
+
+0080261b <getchar>:
+{
+  80261b:	55                   	push   %ebp
+  80261c:	89 e5                	mov    %esp,%ebp
+  80261e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802621:	6a 01                	push   $0x1
+  802623:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802626:	50                   	push   %eax
+  802627:	6a 00                	push   $0x0
+  802629:	e8 7a f2 ff ff       	call   8018a8 <read>
+	if (r < 0)
+  80262e:	83 c4 10             	add    $0x10,%esp
+  802631:	85 c0                	test   %eax,%eax
+  802633:	78 06                	js     80263b <getchar+0x20>
+	if (r < 1)
+  802635:	74 06                	je     80263d <getchar+0x22>
+	return c;
+  802637:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80263b:	c9                   	leave
+  80263c:	c3                   	ret
+		return -E_EOF;
+  80263d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802642:	eb f7                	jmp    80263b <getchar+0x20>
+
+00802644 <iscons>:
+{
+  802644:	55                   	push   %ebp
+  802645:	89 e5                	mov    %esp,%ebp
+  802647:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80264a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80264d:	50                   	push   %eax
+  80264e:	ff 75 08             	push   0x8(%ebp)
+  802651:	e8 f3 ef ff ff       	call   801649 <fd_lookup>
+  802656:	83 c4 10             	add    $0x10,%esp
+  802659:	85 c0                	test   %eax,%eax
+  80265b:	78 11                	js     80266e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80265d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802660:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802666:	39 10                	cmp    %edx,(%eax)
+  802668:	0f 94 c0             	sete   %al
+  80266b:	0f b6 c0             	movzbl %al,%eax
+}
+  80266e:	c9                   	leave
+  80266f:	c3                   	ret
+
+00802670 <opencons>:
+{
+  802670:	55                   	push   %ebp
+  802671:	89 e5                	mov    %esp,%ebp
+  802673:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802676:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802679:	50                   	push   %eax
+  80267a:	e8 76 ef ff ff       	call   8015f5 <fd_alloc>
+  80267f:	83 c4 10             	add    $0x10,%esp
+  802682:	85 c0                	test   %eax,%eax
+  802684:	78 3a                	js     8026c0 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802686:	83 ec 04             	sub    $0x4,%esp
+  802689:	68 07 04 00 00       	push   $0x407
+  80268e:	ff 75 f4             	push   -0xc(%ebp)
+  802691:	6a 00                	push   $0x0
+  802693:	e8 4c e8 ff ff       	call   800ee4 <sys_page_alloc>
+  802698:	83 c4 10             	add    $0x10,%esp
+  80269b:	85 c0                	test   %eax,%eax
+  80269d:	78 21                	js     8026c0 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80269f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026a2:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  8026a8:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8026aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026ad:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8026b4:	83 ec 0c             	sub    $0xc,%esp
+  8026b7:	50                   	push   %eax
+  8026b8:	e8 11 ef ff ff       	call   8015ce <fd2num>
+  8026bd:	83 c4 10             	add    $0x10,%esp
+}
+  8026c0:	c9                   	leave
+  8026c1:	c3                   	ret
+
+008026c2 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8026c2:	55                   	push   %ebp
+  8026c3:	89 e5                	mov    %esp,%ebp
+  8026c5:	57                   	push   %edi
+  8026c6:	56                   	push   %esi
+  8026c7:	53                   	push   %ebx
+  8026c8:	83 ec 14             	sub    $0x14,%esp
+  8026cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8026ce:	8b 75 14             	mov    0x14(%ebp),%esi
+  8026d1:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8026d4:	ff 75 10             	push   0x10(%ebp)
+  8026d7:	ff 75 0c             	push   0xc(%ebp)
+  8026da:	e8 28 ec ff ff       	call   801307 <sys_ipc_recv_pages>
+  8026df:	83 c4 10             	add    $0x10,%esp
+  8026e2:	85 c0                	test   %eax,%eax
+  8026e4:	78 46                	js     80272c <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8026e6:	85 ff                	test   %edi,%edi
+  8026e8:	74 0d                	je     8026f7 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  8026ea:	a1 24 54 80 00       	mov    0x805424,%eax
+  8026ef:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8026f5:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8026f7:	85 f6                	test   %esi,%esi
+  8026f9:	74 0d                	je     802708 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  8026fb:	a1 24 54 80 00       	mov    0x805424,%eax
+  802700:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802706:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802708:	85 db                	test   %ebx,%ebx
+  80270a:	74 0d                	je     802719 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  80270c:	a1 24 54 80 00       	mov    0x805424,%eax
+  802711:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802717:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802719:	a1 24 54 80 00       	mov    0x805424,%eax
+  80271e:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802724:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802727:	5b                   	pop    %ebx
+  802728:	5e                   	pop    %esi
+  802729:	5f                   	pop    %edi
+  80272a:	5d                   	pop    %ebp
+  80272b:	c3                   	ret
+		if (from_env_store) {
+  80272c:	85 ff                	test   %edi,%edi
+  80272e:	74 06                	je     802736 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  802730:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802736:	85 f6                	test   %esi,%esi
+  802738:	74 06                	je     802740 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  80273a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802740:	85 db                	test   %ebx,%ebx
+  802742:	74 e0                	je     802724 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  802744:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80274a:	eb d8                	jmp    802724 <ipc_recv_pages+0x62>
+
+0080274c <ipc_recv>:
+{
+  80274c:	55                   	push   %ebp
+  80274d:	89 e5                	mov    %esp,%ebp
+  80274f:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  802752:	6a 00                	push   $0x0
+  802754:	ff 75 10             	push   0x10(%ebp)
+  802757:	6a 01                	push   $0x1
+  802759:	ff 75 0c             	push   0xc(%ebp)
+  80275c:	ff 75 08             	push   0x8(%ebp)
+  80275f:	e8 5e ff ff ff       	call   8026c2 <ipc_recv_pages>
+}
+  802764:	c9                   	leave
+  802765:	c3                   	ret
+
+00802766 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802766:	55                   	push   %ebp
+  802767:	89 e5                	mov    %esp,%ebp
+  802769:	56                   	push   %esi
+  80276a:	53                   	push   %ebx
+  80276b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80276e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  802771:	83 ec 0c             	sub    $0xc,%esp
+  802774:	ff 75 0c             	push   0xc(%ebp)
+  802777:	e8 bf ec ff ff       	call   80143b <sys_ipc_try_recv>
+  80277c:	83 c4 10             	add    $0x10,%esp
+  80277f:	85 c0                	test   %eax,%eax
+  802781:	78 34                	js     8027b7 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802783:	85 f6                	test   %esi,%esi
+  802785:	74 0d                	je     802794 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  802787:	a1 24 54 80 00       	mov    0x805424,%eax
+  80278c:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802792:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  802794:	85 db                	test   %ebx,%ebx
+  802796:	74 0d                	je     8027a5 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  802798:	a1 24 54 80 00       	mov    0x805424,%eax
+  80279d:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8027a3:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8027a5:	a1 24 54 80 00       	mov    0x805424,%eax
+  8027aa:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8027b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027b3:	5b                   	pop    %ebx
+  8027b4:	5e                   	pop    %esi
+  8027b5:	5d                   	pop    %ebp
+  8027b6:	c3                   	ret
+		if (from_env_store) {
+  8027b7:	85 f6                	test   %esi,%esi
+  8027b9:	74 06                	je     8027c1 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8027bb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8027c1:	85 db                	test   %ebx,%ebx
+  8027c3:	74 eb                	je     8027b0 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8027c5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8027cb:	eb e3                	jmp    8027b0 <ipc_try_recv+0x4a>
+
+008027cd <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8027cd:	55                   	push   %ebp
+  8027ce:	89 e5                	mov    %esp,%ebp
+  8027d0:	83 ec 14             	sub    $0x14,%esp
+  8027d3:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8027d6:	85 c0                	test   %eax,%eax
+  8027d8:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8027dd:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8027e0:	ff 75 18             	push   0x18(%ebp)
+  8027e3:	ff 75 14             	push   0x14(%ebp)
+  8027e6:	50                   	push   %eax
+  8027e7:	ff 75 0c             	push   0xc(%ebp)
+  8027ea:	ff 75 08             	push   0x8(%ebp)
+  8027ed:	e8 d8 ea ff ff       	call   8012ca <sys_ipc_send_pages>
+  8027f2:	83 c4 20             	add    $0x20,%esp
+  8027f5:	85 c0                	test   %eax,%eax
+  8027f7:	78 02                	js     8027fb <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  8027f9:	c9                   	leave
+  8027fa:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  8027fb:	50                   	push   %eax
+  8027fc:	68 a4 30 80 00       	push   $0x8030a4
+  802801:	68 80 00 00 00       	push   $0x80
+  802806:	68 d0 30 80 00       	push   $0x8030d0
+  80280b:	e8 1f db ff ff       	call   80032f <_panic>
+
+00802810 <ipc_send>:
+{
+  802810:	55                   	push   %ebp
+  802811:	89 e5                	mov    %esp,%ebp
+  802813:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  802816:	ff 75 14             	push   0x14(%ebp)
+  802819:	6a 01                	push   $0x1
+  80281b:	ff 75 10             	push   0x10(%ebp)
+  80281e:	ff 75 0c             	push   0xc(%ebp)
+  802821:	ff 75 08             	push   0x8(%ebp)
+  802824:	e8 a4 ff ff ff       	call   8027cd <ipc_send_pages>
+}
+  802829:	83 c4 20             	add    $0x20,%esp
+  80282c:	c9                   	leave
+  80282d:	c3                   	ret
+
+0080282e <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80282e:	55                   	push   %ebp
+  80282f:	89 e5                	mov    %esp,%ebp
+  802831:	83 ec 14             	sub    $0x14,%esp
+  802834:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802837:	85 c0                	test   %eax,%eax
+  802839:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80283e:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802841:	ff 75 18             	push   0x18(%ebp)
+  802844:	ff 75 14             	push   0x14(%ebp)
+  802847:	50                   	push   %eax
+  802848:	ff 75 0c             	push   0xc(%ebp)
+  80284b:	ff 75 08             	push   0x8(%ebp)
+  80284e:	e8 08 eb ff ff       	call   80135b <sys_ipc_call>
+  802853:	83 c4 20             	add    $0x20,%esp
+  802856:	85 c0                	test   %eax,%eax
+  802858:	78 0b                	js     802865 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  80285a:	a1 24 54 80 00       	mov    0x805424,%eax
+  80285f:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802865:	c9                   	leave
+  802866:	c3                   	ret
+
+00802867 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  802867:	55                   	push   %ebp
+  802868:	89 e5                	mov    %esp,%ebp
+  80286a:	57                   	push   %edi
+  80286b:	56                   	push   %esi
+  80286c:	53                   	push   %ebx
+  80286d:	83 ec 18             	sub    $0x18,%esp
+  802870:	8b 45 10             	mov    0x10(%ebp),%eax
+  802873:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  802876:	8b 75 20             	mov    0x20(%ebp),%esi
+  802879:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80287c:	85 c0                	test   %eax,%eax
+  80287e:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802883:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802886:	ff 75 18             	push   0x18(%ebp)
+  802889:	ff 75 14             	push   0x14(%ebp)
+  80288c:	50                   	push   %eax
+  80288d:	ff 75 0c             	push   0xc(%ebp)
+  802890:	ff 75 08             	push   0x8(%ebp)
+  802893:	e8 04 eb ff ff       	call   80139c <sys_ipc_reply_recv>
+  802898:	83 c4 20             	add    $0x20,%esp
+  80289b:	85 c0                	test   %eax,%eax
+  80289d:	78 46                	js     8028e5 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80289f:	85 ff                	test   %edi,%edi
+  8028a1:	74 0d                	je     8028b0 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8028a3:	a1 24 54 80 00       	mov    0x805424,%eax
+  8028a8:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8028ae:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8028b0:	85 f6                	test   %esi,%esi
+  8028b2:	74 0d                	je     8028c1 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8028b4:	a1 24 54 80 00       	mov    0x805424,%eax
+  8028b9:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8028bf:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8028c1:	85 db                	test   %ebx,%ebx
+  8028c3:	74 0d                	je     8028d2 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8028c5:	a1 24 54 80 00       	mov    0x805424,%eax
+  8028ca:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8028d0:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8028d2:	a1 24 54 80 00       	mov    0x805424,%eax
+  8028d7:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8028dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028e0:	5b                   	pop    %ebx
+  8028e1:	5e                   	pop    %esi
+  8028e2:	5f                   	pop    %edi
+  8028e3:	5d                   	pop    %ebp
+  8028e4:	c3                   	ret
+		if (from_env_store) {
+  8028e5:	85 ff                	test   %edi,%edi
+  8028e7:	74 06                	je     8028ef <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  8028e9:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8028ef:	85 f6                	test   %esi,%esi
+  8028f1:	74 06                	je     8028f9 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  8028f3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8028f9:	85 db                	test   %ebx,%ebx
+  8028fb:	74 e0                	je     8028dd <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  8028fd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802903:	eb d8                	jmp    8028dd <ipc_reply_recv+0x76>
+
+00802905 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802905:	55                   	push   %ebp
+  802906:	89 e5                	mov    %esp,%ebp
+  802908:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80290b:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  802910:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802913:	c1 e0 06             	shl    $0x6,%eax
+  802916:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80291b:	8b 40 50             	mov    0x50(%eax),%eax
+  80291e:	39 c8                	cmp    %ecx,%eax
+  802920:	74 12                	je     802934 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802922:	83 c2 01             	add    $0x1,%edx
+  802925:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80292b:	75 e3                	jne    802910 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80292d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802932:	eb 0e                	jmp    802942 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802934:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802937:	c1 e0 06             	shl    $0x6,%eax
+  80293a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80293f:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802942:	5d                   	pop    %ebp
+  802943:	c3                   	ret
+
+00802944 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802944:	55                   	push   %ebp
+  802945:	89 e5                	mov    %esp,%ebp
+  802947:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80294a:	89 c2                	mov    %eax,%edx
+  80294c:	c1 ea 16             	shr    $0x16,%edx
+  80294f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802956:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80295b:	f6 c1 01             	test   $0x1,%cl
+  80295e:	74 1e                	je     80297e <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  802960:	c1 e8 0c             	shr    $0xc,%eax
+  802963:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80296a:	a8 01                	test   $0x1,%al
+  80296c:	74 10                	je     80297e <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80296e:	c1 e8 0c             	shr    $0xc,%eax
+  802971:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802974:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  80297b:	0f b7 d2             	movzwl %dx,%edx
+}
+  80297e:	89 d0                	mov    %edx,%eax
+  802980:	5d                   	pop    %ebp
+  802981:	c3                   	ret
+
+00802982 <udivmod>:
+  802982:	55                   	push   %ebp
+  802983:	57                   	push   %edi
+  802984:	56                   	push   %esi
+  802985:	53                   	push   %ebx
+  802986:	83 ec 24             	sub    $0x24,%esp
+  802989:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80298d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802991:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802995:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802999:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80299d:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8029a1:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8029a5:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8029aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b4:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8029bb:	00 
+  8029bc:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8029c3:	00 
+  8029c4:	89 fb                	mov    %edi,%ebx
+  8029c6:	eb 08                	jmp    8029d0 <udivmod+0x4e>
+  8029c8:	83 e9 01             	sub    $0x1,%ecx
+  8029cb:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8029ce:	74 68                	je     802a38 <udivmod+0xb6>
+  8029d0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8029d4:	01 c0                	add    %eax,%eax
+  8029d6:	89 c6                	mov    %eax,%esi
+  8029d8:	89 d7                	mov    %edx,%edi
+  8029da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029e2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8029e5:	d3 ea                	shr    %cl,%edx
+  8029e7:	f6 c1 20             	test   $0x20,%cl
+  8029ea:	74 04                	je     8029f0 <udivmod+0x6e>
+  8029ec:	89 d0                	mov    %edx,%eax
+  8029ee:	31 d2                	xor    %edx,%edx
+  8029f0:	83 e0 01             	and    $0x1,%eax
+  8029f3:	89 04 24             	mov    %eax,(%esp)
+  8029f6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8029fd:	00 
+  8029fe:	8b 04 24             	mov    (%esp),%eax
+  802a01:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802a05:	09 f0                	or     %esi,%eax
+  802a07:	09 fa                	or     %edi,%edx
+  802a09:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802a0d:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802a11:	39 f0                	cmp    %esi,%eax
+  802a13:	89 d5                	mov    %edx,%ebp
+  802a15:	19 fd                	sbb    %edi,%ebp
+  802a17:	72 af                	jb     8029c8 <udivmod+0x46>
+  802a19:	29 f0                	sub    %esi,%eax
+  802a1b:	19 fa                	sbb    %edi,%edx
+  802a1d:	89 cf                	mov    %ecx,%edi
+  802a1f:	c1 ef 05             	shr    $0x5,%edi
+  802a22:	83 e7 01             	and    $0x1,%edi
+  802a25:	89 fe                	mov    %edi,%esi
+  802a27:	83 f6 01             	xor    $0x1,%esi
+  802a2a:	d3 e6                	shl    %cl,%esi
+  802a2c:	d3 e7                	shl    %cl,%edi
+  802a2e:	09 74 24 18          	or     %esi,0x18(%esp)
+  802a32:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802a36:	eb 90                	jmp    8029c8 <udivmod+0x46>
+  802a38:	85 db                	test   %ebx,%ebx
+  802a3a:	74 05                	je     802a41 <udivmod+0xbf>
+  802a3c:	89 03                	mov    %eax,(%ebx)
+  802a3e:	89 53 04             	mov    %edx,0x4(%ebx)
+  802a41:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802a45:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802a49:	83 c4 24             	add    $0x24,%esp
+  802a4c:	5b                   	pop    %ebx
+  802a4d:	5e                   	pop    %esi
+  802a4e:	5f                   	pop    %edi
+  802a4f:	5d                   	pop    %ebp
+  802a50:	c3                   	ret
+
+00802a51 <__udivdi3>:
+  802a51:	83 ec 08             	sub    $0x8,%esp
+  802a54:	6a 00                	push   $0x0
+  802a56:	ff 74 24 1c          	push   0x1c(%esp)
+  802a5a:	ff 74 24 1c          	push   0x1c(%esp)
+  802a5e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802a62:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802a66:	e8 17 ff ff ff       	call   802982 <udivmod>
+  802a6b:	83 c4 14             	add    $0x14,%esp
+  802a6e:	c3                   	ret
+
+00802a6f <__umoddi3>:
+  802a6f:	83 ec 18             	sub    $0x18,%esp
+  802a72:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802a76:	50                   	push   %eax
+  802a77:	ff 74 24 2c          	push   0x2c(%esp)
+  802a7b:	ff 74 24 2c          	push   0x2c(%esp)
+  802a7f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802a83:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802a87:	e8 f6 fe ff ff       	call   802982 <udivmod>
+  802a8c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802a90:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802a94:	83 c4 24             	add    $0x24,%esp
+  802a97:	c3                   	ret
+
+00802a98 <__divdi3>:
+  802a98:	55                   	push   %ebp
+  802a99:	57                   	push   %edi
+  802a9a:	56                   	push   %esi
+  802a9b:	53                   	push   %ebx
+  802a9c:	83 ec 10             	sub    $0x10,%esp
+  802a9f:	8b 44 24 24          	mov    0x24(%esp),%eax
+  802aa3:	8b 54 24 28          	mov    0x28(%esp),%edx
+  802aa7:	89 c6                	mov    %eax,%esi
+  802aa9:	89 d7                	mov    %edx,%edi
+  802aab:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  802aaf:	33 7c 24 30          	xor    0x30(%esp),%edi
+  802ab3:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802ab7:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  802abb:	89 c5                	mov    %eax,%ebp
+  802abd:	f7 dd                	neg    %ebp
+  802abf:	89 d6                	mov    %edx,%esi
+  802ac1:	83 d6 00             	adc    $0x0,%esi
+  802ac4:	f7 de                	neg    %esi
+  802ac6:	0f 48 e8             	cmovs  %eax,%ebp
+  802ac9:	0f 49 d6             	cmovns %esi,%edx
+  802acc:	6a 00                	push   $0x0
+  802ace:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802ad2:	f7 de                	neg    %esi
+  802ad4:	8b 44 24 34          	mov    0x34(%esp),%eax
+  802ad8:	83 d0 00             	adc    $0x0,%eax
+  802adb:	f7 d8                	neg    %eax
+  802add:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  802ae2:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  802ae7:	50                   	push   %eax
+  802ae8:	56                   	push   %esi
+  802ae9:	89 e8                	mov    %ebp,%eax
+  802aeb:	e8 92 fe ff ff       	call   802982 <udivmod>
+  802af0:	83 c4 10             	add    $0x10,%esp
+  802af3:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  802af8:	78 08                	js     802b02 <__divdi3+0x6a>
+  802afa:	83 c4 0c             	add    $0xc,%esp
+  802afd:	5b                   	pop    %ebx
+  802afe:	5e                   	pop    %esi
+  802aff:	5f                   	pop    %edi
+  802b00:	5d                   	pop    %ebp
+  802b01:	c3                   	ret
+  802b02:	f7 d8                	neg    %eax
+  802b04:	83 d2 00             	adc    $0x0,%edx
+  802b07:	f7 da                	neg    %edx
+  802b09:	eb ef                	jmp    802afa <__divdi3+0x62>
+
+00802b0b <__moddi3>:
+  802b0b:	55                   	push   %ebp
+  802b0c:	57                   	push   %edi
+  802b0d:	56                   	push   %esi
+  802b0e:	53                   	push   %ebx
+  802b0f:	83 ec 18             	sub    $0x18,%esp
+  802b12:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802b16:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802b1a:	89 f1                	mov    %esi,%ecx
+  802b1c:	f7 d9                	neg    %ecx
+  802b1e:	89 da                	mov    %ebx,%edx
+  802b20:	83 d2 00             	adc    $0x0,%edx
+  802b23:	f7 da                	neg    %edx
+  802b25:	0f 48 ce             	cmovs  %esi,%ecx
+  802b28:	0f 48 d3             	cmovs  %ebx,%edx
+  802b2b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802b2f:	50                   	push   %eax
+  802b30:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802b34:	f7 de                	neg    %esi
+  802b36:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802b3a:	83 d0 00             	adc    $0x0,%eax
+  802b3d:	f7 d8                	neg    %eax
+  802b3f:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802b44:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802b49:	50                   	push   %eax
+  802b4a:	56                   	push   %esi
+  802b4b:	89 c8                	mov    %ecx,%eax
+  802b4d:	e8 30 fe ff ff       	call   802982 <udivmod>
+  802b52:	83 c4 10             	add    $0x10,%esp
+  802b55:	85 db                	test   %ebx,%ebx
+  802b57:	78 10                	js     802b69 <__moddi3+0x5e>
+  802b59:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802b5d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802b61:	83 c4 14             	add    $0x14,%esp
+  802b64:	5b                   	pop    %ebx
+  802b65:	5e                   	pop    %esi
+  802b66:	5f                   	pop    %edi
+  802b67:	5d                   	pop    %ebp
+  802b68:	c3                   	ret
+  802b69:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802b6d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802b71:	f7 d8                	neg    %eax
+  802b73:	83 d2 00             	adc    $0x0,%edx
+  802b76:	f7 da                	neg    %edx
+  802b78:	eb e7                	jmp    802b61 <__moddi3+0x56>
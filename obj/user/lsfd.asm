@@ -0,0 +1,6056 @@
+
+obj/user/lsfd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 e0 00 00 00       	call   800111 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <usage>:
+#include <inc/lib.h>
+
+void
+usage(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	cprintf("usage: lsfd [-1]\n");
+  800039:	68 c0 29 80 00       	push   $0x8029c0
+  80003e:	e8 c6 01 00 00       	call   800209 <cprintf>
+	exit();
+  800043:	e8 12 01 00 00       	call   80015a <exit>
+}
+  800048:	83 c4 10             	add    $0x10,%esp
+  80004b:	c9                   	leave
+  80004c:	c3                   	ret
+
+0080004d <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80004d:	55                   	push   %ebp
+  80004e:	89 e5                	mov    %esp,%ebp
+  800050:	57                   	push   %edi
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	81 ec b0 00 00 00    	sub    $0xb0,%esp
+	int i, usefprint = 0;
+	struct Stat st;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  800059:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  80005f:	50                   	push   %eax
+  800060:	ff 75 0c             	push   0xc(%ebp)
+  800063:	8d 45 08             	lea    0x8(%ebp),%eax
+  800066:	50                   	push   %eax
+  800067:	e8 12 12 00 00       	call   80127e <argstart>
+	while ((i = argnext(&args)) >= 0)
+  80006c:	83 c4 10             	add    $0x10,%esp
+	int i, usefprint = 0;
+  80006f:	be 00 00 00 00       	mov    $0x0,%esi
+	while ((i = argnext(&args)) >= 0)
+  800074:	8d 9d 4c ff ff ff    	lea    -0xb4(%ebp),%ebx
+		if (i == '1')
+			usefprint = 1;
+  80007a:	bf 01 00 00 00       	mov    $0x1,%edi
+	while ((i = argnext(&args)) >= 0)
+  80007f:	83 ec 0c             	sub    $0xc,%esp
+  800082:	53                   	push   %ebx
+  800083:	e8 26 12 00 00       	call   8012ae <argnext>
+  800088:	83 c4 10             	add    $0x10,%esp
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	78 10                	js     80009f <umain+0x52>
+		if (i == '1')
+  80008f:	83 f8 31             	cmp    $0x31,%eax
+  800092:	75 04                	jne    800098 <umain+0x4b>
+			usefprint = 1;
+  800094:	89 fe                	mov    %edi,%esi
+  800096:	eb e7                	jmp    80007f <umain+0x32>
+		else
+			usage();
+  800098:	e8 96 ff ff ff       	call   800033 <usage>
+  80009d:	eb e0                	jmp    80007f <umain+0x32>
+
+	for (i = 0; i < 32; i++)
+  80009f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (fstat(i, &st) >= 0) {
+  8000a4:	8d bd 5c ff ff ff    	lea    -0xa4(%ebp),%edi
+  8000aa:	eb 26                	jmp    8000d2 <umain+0x85>
+			if (usefprint)
+				fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+					i, st.st_name, st.st_isdir,
+					st.st_size, st.st_dev->dev_name);
+			else
+				cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+  8000ac:	83 ec 08             	sub    $0x8,%esp
+  8000af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000b2:	ff 70 04             	push   0x4(%eax)
+  8000b5:	ff 75 dc             	push   -0x24(%ebp)
+  8000b8:	ff 75 e0             	push   -0x20(%ebp)
+  8000bb:	57                   	push   %edi
+  8000bc:	53                   	push   %ebx
+  8000bd:	68 d4 29 80 00       	push   $0x8029d4
+  8000c2:	e8 42 01 00 00       	call   800209 <cprintf>
+  8000c7:	83 c4 20             	add    $0x20,%esp
+	for (i = 0; i < 32; i++)
+  8000ca:	83 c3 01             	add    $0x1,%ebx
+  8000cd:	83 fb 20             	cmp    $0x20,%ebx
+  8000d0:	74 37                	je     800109 <umain+0xbc>
+		if (fstat(i, &st) >= 0) {
+  8000d2:	83 ec 08             	sub    $0x8,%esp
+  8000d5:	57                   	push   %edi
+  8000d6:	53                   	push   %ebx
+  8000d7:	e8 c3 17 00 00       	call   80189f <fstat>
+  8000dc:	83 c4 10             	add    $0x10,%esp
+  8000df:	85 c0                	test   %eax,%eax
+  8000e1:	78 e7                	js     8000ca <umain+0x7d>
+			if (usefprint)
+  8000e3:	85 f6                	test   %esi,%esi
+  8000e5:	74 c5                	je     8000ac <umain+0x5f>
+				fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+  8000e7:	83 ec 04             	sub    $0x4,%esp
+  8000ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000ed:	ff 70 04             	push   0x4(%eax)
+  8000f0:	ff 75 dc             	push   -0x24(%ebp)
+  8000f3:	ff 75 e0             	push   -0x20(%ebp)
+  8000f6:	57                   	push   %edi
+  8000f7:	53                   	push   %ebx
+  8000f8:	68 d4 29 80 00       	push   $0x8029d4
+  8000fd:	6a 01                	push   $0x1
+  8000ff:	e8 2d 1d 00 00       	call   801e31 <fprintf>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	eb c1                	jmp    8000ca <umain+0x7d>
+					i, st.st_name, st.st_isdir,
+					st.st_size, st.st_dev->dev_name);
+		}
+}
+  800109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80010c:	5b                   	pop    %ebx
+  80010d:	5e                   	pop    %esi
+  80010e:	5f                   	pop    %edi
+  80010f:	5d                   	pop    %ebp
+  800110:	c3                   	ret
+
+00800111 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800111:	55                   	push   %ebp
+  800112:	89 e5                	mov    %esp,%ebp
+  800114:	56                   	push   %esi
+  800115:	53                   	push   %ebx
+  800116:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800119:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  80011c:	e8 84 0b 00 00       	call   800ca5 <sys_getenvid>
+  800121:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800126:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800129:	c1 e0 06             	shl    $0x6,%eax
+  80012c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800131:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800136:	85 db                	test   %ebx,%ebx
+  800138:	7e 07                	jle    800141 <libmain+0x30>
+		binaryname = argv[0];
+  80013a:	8b 06                	mov    (%esi),%eax
+  80013c:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800141:	83 ec 08             	sub    $0x8,%esp
+  800144:	56                   	push   %esi
+  800145:	53                   	push   %ebx
+  800146:	e8 02 ff ff ff       	call   80004d <umain>
+
+	// exit gracefully
+	exit();
+  80014b:	e8 0a 00 00 00       	call   80015a <exit>
+}
+  800150:	83 c4 10             	add    $0x10,%esp
+  800153:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800156:	5b                   	pop    %ebx
+  800157:	5e                   	pop    %esi
+  800158:	5d                   	pop    %ebp
+  800159:	c3                   	ret
+
+0080015a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80015a:	55                   	push   %ebp
+  80015b:	89 e5                	mov    %esp,%ebp
+  80015d:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800160:	e8 33 14 00 00       	call   801598 <close_all>
+	sys_env_destroy(0);
+  800165:	83 ec 0c             	sub    $0xc,%esp
+  800168:	6a 00                	push   $0x0
+  80016a:	e8 f5 0a 00 00       	call   800c64 <sys_env_destroy>
+}
+  80016f:	83 c4 10             	add    $0x10,%esp
+  800172:	c9                   	leave
+  800173:	c3                   	ret
+
+00800174 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800174:	55                   	push   %ebp
+  800175:	89 e5                	mov    %esp,%ebp
+  800177:	53                   	push   %ebx
+  800178:	83 ec 04             	sub    $0x4,%esp
+  80017b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80017e:	8b 13                	mov    (%ebx),%edx
+  800180:	8d 42 01             	lea    0x1(%edx),%eax
+  800183:	89 03                	mov    %eax,(%ebx)
+  800185:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800188:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80018c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800191:	74 09                	je     80019c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800193:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800197:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80019a:	c9                   	leave
+  80019b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80019c:	83 ec 08             	sub    $0x8,%esp
+  80019f:	68 ff 00 00 00       	push   $0xff
+  8001a4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001a7:	50                   	push   %eax
+  8001a8:	e8 69 0a 00 00       	call   800c16 <sys_cputs>
+		b->idx = 0;
+  8001ad:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001b3:	83 c4 10             	add    $0x10,%esp
+  8001b6:	eb db                	jmp    800193 <putch+0x1f>
+
+008001b8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001b8:	55                   	push   %ebp
+  8001b9:	89 e5                	mov    %esp,%ebp
+  8001bb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001c1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001c8:	00 00 00 
+	b.cnt = 0;
+  8001cb:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001d2:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001d5:	ff 75 0c             	push   0xc(%ebp)
+  8001d8:	ff 75 08             	push   0x8(%ebp)
+  8001db:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001e1:	50                   	push   %eax
+  8001e2:	68 74 01 80 00       	push   $0x800174
+  8001e7:	e8 14 01 00 00       	call   800300 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001ec:	83 c4 08             	add    $0x8,%esp
+  8001ef:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001f5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001fb:	50                   	push   %eax
+  8001fc:	e8 15 0a 00 00       	call   800c16 <sys_cputs>
+
+	return b.cnt;
+}
+  800201:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+00800209 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80020f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800212:	50                   	push   %eax
+  800213:	ff 75 08             	push   0x8(%ebp)
+  800216:	e8 9d ff ff ff       	call   8001b8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80021b:	c9                   	leave
+  80021c:	c3                   	ret
+
+0080021d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80021d:	55                   	push   %ebp
+  80021e:	89 e5                	mov    %esp,%ebp
+  800220:	57                   	push   %edi
+  800221:	56                   	push   %esi
+  800222:	53                   	push   %ebx
+  800223:	83 ec 1c             	sub    $0x1c,%esp
+  800226:	89 c7                	mov    %eax,%edi
+  800228:	89 d6                	mov    %edx,%esi
+  80022a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80022d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800230:	89 d1                	mov    %edx,%ecx
+  800232:	89 c2                	mov    %eax,%edx
+  800234:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800237:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80023a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80023d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800240:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800243:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80024a:	39 c2                	cmp    %eax,%edx
+  80024c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80024f:	72 3e                	jb     80028f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800251:	83 ec 0c             	sub    $0xc,%esp
+  800254:	ff 75 18             	push   0x18(%ebp)
+  800257:	83 eb 01             	sub    $0x1,%ebx
+  80025a:	53                   	push   %ebx
+  80025b:	50                   	push   %eax
+  80025c:	83 ec 08             	sub    $0x8,%esp
+  80025f:	ff 75 e4             	push   -0x1c(%ebp)
+  800262:	ff 75 e0             	push   -0x20(%ebp)
+  800265:	ff 75 dc             	push   -0x24(%ebp)
+  800268:	ff 75 d8             	push   -0x28(%ebp)
+  80026b:	e8 26 26 00 00       	call   802896 <__udivdi3>
+  800270:	83 c4 18             	add    $0x18,%esp
+  800273:	52                   	push   %edx
+  800274:	50                   	push   %eax
+  800275:	89 f2                	mov    %esi,%edx
+  800277:	89 f8                	mov    %edi,%eax
+  800279:	e8 9f ff ff ff       	call   80021d <printnum>
+  80027e:	83 c4 20             	add    $0x20,%esp
+  800281:	eb 13                	jmp    800296 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800283:	83 ec 08             	sub    $0x8,%esp
+  800286:	56                   	push   %esi
+  800287:	ff 75 18             	push   0x18(%ebp)
+  80028a:	ff d7                	call   *%edi
+  80028c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80028f:	83 eb 01             	sub    $0x1,%ebx
+  800292:	85 db                	test   %ebx,%ebx
+  800294:	7f ed                	jg     800283 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800296:	83 ec 08             	sub    $0x8,%esp
+  800299:	56                   	push   %esi
+  80029a:	83 ec 04             	sub    $0x4,%esp
+  80029d:	ff 75 e4             	push   -0x1c(%ebp)
+  8002a0:	ff 75 e0             	push   -0x20(%ebp)
+  8002a3:	ff 75 dc             	push   -0x24(%ebp)
+  8002a6:	ff 75 d8             	push   -0x28(%ebp)
+  8002a9:	e8 06 26 00 00       	call   8028b4 <__umoddi3>
+  8002ae:	83 c4 14             	add    $0x14,%esp
+  8002b1:	0f be 80 06 2a 80 00 	movsbl 0x802a06(%eax),%eax
+  8002b8:	50                   	push   %eax
+  8002b9:	ff d7                	call   *%edi
+}
+  8002bb:	83 c4 10             	add    $0x10,%esp
+  8002be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c1:	5b                   	pop    %ebx
+  8002c2:	5e                   	pop    %esi
+  8002c3:	5f                   	pop    %edi
+  8002c4:	5d                   	pop    %ebp
+  8002c5:	c3                   	ret
+
+008002c6 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002c6:	55                   	push   %ebp
+  8002c7:	89 e5                	mov    %esp,%ebp
+  8002c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002cc:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002d0:	8b 10                	mov    (%eax),%edx
+  8002d2:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002d5:	73 0a                	jae    8002e1 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002d7:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002da:	89 08                	mov    %ecx,(%eax)
+  8002dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002df:	88 02                	mov    %al,(%edx)
+}
+  8002e1:	5d                   	pop    %ebp
+  8002e2:	c3                   	ret
+
+008002e3 <printfmt>:
+{
+  8002e3:	55                   	push   %ebp
+  8002e4:	89 e5                	mov    %esp,%ebp
+  8002e6:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002e9:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002ec:	50                   	push   %eax
+  8002ed:	ff 75 10             	push   0x10(%ebp)
+  8002f0:	ff 75 0c             	push   0xc(%ebp)
+  8002f3:	ff 75 08             	push   0x8(%ebp)
+  8002f6:	e8 05 00 00 00       	call   800300 <vprintfmt>
+}
+  8002fb:	83 c4 10             	add    $0x10,%esp
+  8002fe:	c9                   	leave
+  8002ff:	c3                   	ret
+
+00800300 <vprintfmt>:
+{
+  800300:	55                   	push   %ebp
+  800301:	89 e5                	mov    %esp,%ebp
+  800303:	57                   	push   %edi
+  800304:	56                   	push   %esi
+  800305:	53                   	push   %ebx
+  800306:	83 ec 2c             	sub    $0x2c,%esp
+  800309:	8b 75 08             	mov    0x8(%ebp),%esi
+  80030c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80030f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800312:	eb 0a                	jmp    80031e <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800314:	83 ec 08             	sub    $0x8,%esp
+  800317:	53                   	push   %ebx
+  800318:	50                   	push   %eax
+  800319:	ff d6                	call   *%esi
+  80031b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80031e:	83 c7 01             	add    $0x1,%edi
+  800321:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800325:	83 f8 25             	cmp    $0x25,%eax
+  800328:	74 0c                	je     800336 <vprintfmt+0x36>
+			if (ch == '\0')
+  80032a:	85 c0                	test   %eax,%eax
+  80032c:	75 e6                	jne    800314 <vprintfmt+0x14>
+}
+  80032e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800331:	5b                   	pop    %ebx
+  800332:	5e                   	pop    %esi
+  800333:	5f                   	pop    %edi
+  800334:	5d                   	pop    %ebp
+  800335:	c3                   	ret
+		padc = ' ';
+  800336:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80033a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800341:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800348:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80034f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800354:	8d 47 01             	lea    0x1(%edi),%eax
+  800357:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80035a:	0f b6 17             	movzbl (%edi),%edx
+  80035d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800360:	3c 55                	cmp    $0x55,%al
+  800362:	0f 87 c5 03 00 00    	ja     80072d <vprintfmt+0x42d>
+  800368:	0f b6 c0             	movzbl %al,%eax
+  80036b:	ff 24 85 80 2b 80 00 	jmp    *0x802b80(,%eax,4)
+  800372:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800375:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800379:	eb d9                	jmp    800354 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80037b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80037e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800382:	eb d0                	jmp    800354 <vprintfmt+0x54>
+  800384:	0f b6 d2             	movzbl %dl,%edx
+  800387:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80038a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800392:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800395:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800399:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80039c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80039f:	83 f9 09             	cmp    $0x9,%ecx
+  8003a2:	77 55                	ja     8003f9 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003a4:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003a7:	eb e9                	jmp    800392 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ac:	8b 00                	mov    (%eax),%eax
+  8003ae:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8003b7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ba:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003bd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003c1:	79 91                	jns    800354 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003c3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003c9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003d0:	eb 82                	jmp    800354 <vprintfmt+0x54>
+			if (width < 0)
+  8003d2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003d5:	85 d2                	test   %edx,%edx
+  8003d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003dc:	0f 49 c2             	cmovns %edx,%eax
+  8003df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003e5:	e9 6a ff ff ff       	jmp    800354 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003ed:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003f4:	e9 5b ff ff ff       	jmp    800354 <vprintfmt+0x54>
+  8003f9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003fc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ff:	eb bc                	jmp    8003bd <vprintfmt+0xbd>
+			lflag++;
+  800401:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800404:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800407:	e9 48 ff ff ff       	jmp    800354 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80040c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040f:	8d 78 04             	lea    0x4(%eax),%edi
+  800412:	83 ec 08             	sub    $0x8,%esp
+  800415:	53                   	push   %ebx
+  800416:	ff 30                	push   (%eax)
+  800418:	ff d6                	call   *%esi
+			break;
+  80041a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80041d:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800420:	e9 63 02 00 00       	jmp    800688 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800425:	8b 45 14             	mov    0x14(%ebp),%eax
+  800428:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80042b:	8b 10                	mov    (%eax),%edx
+  80042d:	89 d0                	mov    %edx,%eax
+  80042f:	f7 d8                	neg    %eax
+  800431:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800434:	83 f8 12             	cmp    $0x12,%eax
+  800437:	7f 23                	jg     80045c <vprintfmt+0x15c>
+  800439:	8b 14 85 e0 2c 80 00 	mov    0x802ce0(,%eax,4),%edx
+  800440:	85 d2                	test   %edx,%edx
+  800442:	74 18                	je     80045c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800444:	52                   	push   %edx
+  800445:	68 1d 2e 80 00       	push   $0x802e1d
+  80044a:	53                   	push   %ebx
+  80044b:	56                   	push   %esi
+  80044c:	e8 92 fe ff ff       	call   8002e3 <printfmt>
+  800451:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800454:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800457:	e9 2c 02 00 00       	jmp    800688 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80045c:	50                   	push   %eax
+  80045d:	68 1e 2a 80 00       	push   $0x802a1e
+  800462:	53                   	push   %ebx
+  800463:	56                   	push   %esi
+  800464:	e8 7a fe ff ff       	call   8002e3 <printfmt>
+  800469:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80046c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80046f:	e9 14 02 00 00       	jmp    800688 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800474:	8b 45 14             	mov    0x14(%ebp),%eax
+  800477:	83 c0 04             	add    $0x4,%eax
+  80047a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80047d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800480:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800482:	85 c9                	test   %ecx,%ecx
+  800484:	b8 17 2a 80 00       	mov    $0x802a17,%eax
+  800489:	0f 45 c1             	cmovne %ecx,%eax
+  80048c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80048f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800493:	7e 06                	jle    80049b <vprintfmt+0x19b>
+  800495:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800499:	75 0b                	jne    8004a6 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80049b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80049e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004a1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004a4:	eb 5c                	jmp    800502 <vprintfmt+0x202>
+  8004a6:	83 ec 08             	sub    $0x8,%esp
+  8004a9:	ff 75 d0             	push   -0x30(%ebp)
+  8004ac:	ff 75 cc             	push   -0x34(%ebp)
+  8004af:	e8 19 03 00 00       	call   8007cd <strnlen>
+  8004b4:	89 c2                	mov    %eax,%edx
+  8004b6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004b9:	29 d0                	sub    %edx,%eax
+  8004bb:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004be:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004c8:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ca:	eb 0e                	jmp    8004da <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004cc:	83 ec 08             	sub    $0x8,%esp
+  8004cf:	53                   	push   %ebx
+  8004d0:	57                   	push   %edi
+  8004d1:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d4:	83 ee 01             	sub    $0x1,%esi
+  8004d7:	83 c4 10             	add    $0x10,%esp
+  8004da:	85 f6                	test   %esi,%esi
+  8004dc:	7f ee                	jg     8004cc <vprintfmt+0x1cc>
+  8004de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e4:	85 c0                	test   %eax,%eax
+  8004e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004eb:	0f 49 d0             	cmovns %eax,%edx
+  8004ee:	29 d0                	sub    %edx,%eax
+  8004f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f3:	eb a6                	jmp    80049b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004f5:	83 ec 08             	sub    $0x8,%esp
+  8004f8:	53                   	push   %ebx
+  8004f9:	52                   	push   %edx
+  8004fa:	ff 55 08             	call   *0x8(%ebp)
+  8004fd:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800500:	89 f1                	mov    %esi,%ecx
+  800502:	8d 71 01             	lea    0x1(%ecx),%esi
+  800505:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800509:	0f be d0             	movsbl %al,%edx
+  80050c:	85 d2                	test   %edx,%edx
+  80050e:	74 28                	je     800538 <vprintfmt+0x238>
+  800510:	85 ff                	test   %edi,%edi
+  800512:	78 05                	js     800519 <vprintfmt+0x219>
+  800514:	83 ef 01             	sub    $0x1,%edi
+  800517:	78 30                	js     800549 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800519:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80051d:	74 d6                	je     8004f5 <vprintfmt+0x1f5>
+  80051f:	0f be c0             	movsbl %al,%eax
+  800522:	83 e8 20             	sub    $0x20,%eax
+  800525:	83 f8 5e             	cmp    $0x5e,%eax
+  800528:	76 cb                	jbe    8004f5 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80052a:	83 ec 08             	sub    $0x8,%esp
+  80052d:	53                   	push   %ebx
+  80052e:	6a 3f                	push   $0x3f
+  800530:	ff 55 08             	call   *0x8(%ebp)
+  800533:	83 c4 10             	add    $0x10,%esp
+  800536:	eb c8                	jmp    800500 <vprintfmt+0x200>
+  800538:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80053e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800541:	01 d0                	add    %edx,%eax
+  800543:	29 c8                	sub    %ecx,%eax
+  800545:	89 c7                	mov    %eax,%edi
+  800547:	eb 13                	jmp    80055c <vprintfmt+0x25c>
+  800549:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054c:	eb ed                	jmp    80053b <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80054e:	83 ec 08             	sub    $0x8,%esp
+  800551:	53                   	push   %ebx
+  800552:	6a 20                	push   $0x20
+  800554:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800556:	83 ef 01             	sub    $0x1,%edi
+  800559:	83 c4 10             	add    $0x10,%esp
+  80055c:	85 ff                	test   %edi,%edi
+  80055e:	7f ee                	jg     80054e <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800560:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800563:	89 45 14             	mov    %eax,0x14(%ebp)
+  800566:	e9 1d 01 00 00       	jmp    800688 <vprintfmt+0x388>
+	if (lflag >= 2)
+  80056b:	83 f9 01             	cmp    $0x1,%ecx
+  80056e:	7f 1b                	jg     80058b <vprintfmt+0x28b>
+	else if (lflag)
+  800570:	85 c9                	test   %ecx,%ecx
+  800572:	74 63                	je     8005d7 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800574:	8b 45 14             	mov    0x14(%ebp),%eax
+  800577:	8b 00                	mov    (%eax),%eax
+  800579:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80057c:	99                   	cltd
+  80057d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800580:	8b 45 14             	mov    0x14(%ebp),%eax
+  800583:	8d 40 04             	lea    0x4(%eax),%eax
+  800586:	89 45 14             	mov    %eax,0x14(%ebp)
+  800589:	eb 17                	jmp    8005a2 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80058b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058e:	8b 50 04             	mov    0x4(%eax),%edx
+  800591:	8b 00                	mov    (%eax),%eax
+  800593:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800596:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800599:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059c:	8d 40 08             	lea    0x8(%eax),%eax
+  80059f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005a2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005a5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005a8:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005ad:	85 c9                	test   %ecx,%ecx
+  8005af:	0f 89 b9 00 00 00    	jns    80066e <vprintfmt+0x36e>
+				putch('-', putdat);
+  8005b5:	83 ec 08             	sub    $0x8,%esp
+  8005b8:	53                   	push   %ebx
+  8005b9:	6a 2d                	push   $0x2d
+  8005bb:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005bd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005c3:	f7 da                	neg    %edx
+  8005c5:	83 d1 00             	adc    $0x0,%ecx
+  8005c8:	f7 d9                	neg    %ecx
+  8005ca:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005cd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005d2:	e9 97 00 00 00       	jmp    80066e <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8005d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005da:	8b 00                	mov    (%eax),%eax
+  8005dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005df:	99                   	cltd
+  8005e0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ec:	eb b4                	jmp    8005a2 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8005ee:	83 f9 01             	cmp    $0x1,%ecx
+  8005f1:	7f 1b                	jg     80060e <vprintfmt+0x30e>
+	else if (lflag)
+  8005f3:	85 c9                	test   %ecx,%ecx
+  8005f5:	74 2c                	je     800623 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8005f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fa:	8b 10                	mov    (%eax),%edx
+  8005fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800601:	8d 40 04             	lea    0x4(%eax),%eax
+  800604:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800607:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80060c:	eb 60                	jmp    80066e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80060e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800611:	8b 10                	mov    (%eax),%edx
+  800613:	8b 48 04             	mov    0x4(%eax),%ecx
+  800616:	8d 40 08             	lea    0x8(%eax),%eax
+  800619:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80061c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800621:	eb 4b                	jmp    80066e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800623:	8b 45 14             	mov    0x14(%ebp),%eax
+  800626:	8b 10                	mov    (%eax),%edx
+  800628:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062d:	8d 40 04             	lea    0x4(%eax),%eax
+  800630:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800633:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800638:	eb 34                	jmp    80066e <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80063a:	83 f9 01             	cmp    $0x1,%ecx
+  80063d:	7f 15                	jg     800654 <vprintfmt+0x354>
+	else if (lflag)
+  80063f:	85 c9                	test   %ecx,%ecx
+  800641:	74 4d                	je     800690 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800643:	8b 45 14             	mov    0x14(%ebp),%eax
+  800646:	8b 00                	mov    (%eax),%eax
+  800648:	99                   	cltd
+  800649:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80064c:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80064f:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800652:	eb 11                	jmp    800665 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800654:	8b 45 14             	mov    0x14(%ebp),%eax
+  800657:	8b 50 04             	mov    0x4(%eax),%edx
+  80065a:	8b 00                	mov    (%eax),%eax
+  80065c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80065f:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800662:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800665:	89 d1                	mov    %edx,%ecx
+  800667:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800669:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80066e:	83 ec 0c             	sub    $0xc,%esp
+  800671:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800675:	50                   	push   %eax
+  800676:	ff 75 e0             	push   -0x20(%ebp)
+  800679:	57                   	push   %edi
+  80067a:	51                   	push   %ecx
+  80067b:	52                   	push   %edx
+  80067c:	89 da                	mov    %ebx,%edx
+  80067e:	89 f0                	mov    %esi,%eax
+  800680:	e8 98 fb ff ff       	call   80021d <printnum>
+			break;
+  800685:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800688:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80068b:	e9 8e fc ff ff       	jmp    80031e <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800690:	8b 45 14             	mov    0x14(%ebp),%eax
+  800693:	8b 00                	mov    (%eax),%eax
+  800695:	99                   	cltd
+  800696:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800699:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80069c:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80069f:	eb c4                	jmp    800665 <vprintfmt+0x365>
+			putch('0', putdat);
+  8006a1:	83 ec 08             	sub    $0x8,%esp
+  8006a4:	53                   	push   %ebx
+  8006a5:	6a 30                	push   $0x30
+  8006a7:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006a9:	83 c4 08             	add    $0x8,%esp
+  8006ac:	53                   	push   %ebx
+  8006ad:	6a 78                	push   $0x78
+  8006af:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b4:	8b 10                	mov    (%eax),%edx
+  8006b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006bb:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006be:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c4:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8006c9:	eb a3                	jmp    80066e <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8006cb:	83 f9 01             	cmp    $0x1,%ecx
+  8006ce:	7f 1b                	jg     8006eb <vprintfmt+0x3eb>
+	else if (lflag)
+  8006d0:	85 c9                	test   %ecx,%ecx
+  8006d2:	74 2f                	je     800703 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8006d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d7:	8b 10                	mov    (%eax),%edx
+  8006d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006de:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006e9:	eb 83                	jmp    80066e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8006eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ee:	8b 10                	mov    (%eax),%edx
+  8006f0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f3:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006fe:	e9 6b ff ff ff       	jmp    80066e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800703:	8b 45 14             	mov    0x14(%ebp),%eax
+  800706:	8b 10                	mov    (%eax),%edx
+  800708:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070d:	8d 40 04             	lea    0x4(%eax),%eax
+  800710:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800713:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800718:	e9 51 ff ff ff       	jmp    80066e <vprintfmt+0x36e>
+			putch(ch, putdat);
+  80071d:	83 ec 08             	sub    $0x8,%esp
+  800720:	53                   	push   %ebx
+  800721:	6a 25                	push   $0x25
+  800723:	ff d6                	call   *%esi
+			break;
+  800725:	83 c4 10             	add    $0x10,%esp
+  800728:	e9 5b ff ff ff       	jmp    800688 <vprintfmt+0x388>
+			putch('%', putdat);
+  80072d:	83 ec 08             	sub    $0x8,%esp
+  800730:	53                   	push   %ebx
+  800731:	6a 25                	push   $0x25
+  800733:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800735:	83 c4 10             	add    $0x10,%esp
+  800738:	89 f8                	mov    %edi,%eax
+  80073a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80073e:	74 05                	je     800745 <vprintfmt+0x445>
+  800740:	83 e8 01             	sub    $0x1,%eax
+  800743:	eb f5                	jmp    80073a <vprintfmt+0x43a>
+  800745:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800748:	e9 3b ff ff ff       	jmp    800688 <vprintfmt+0x388>
+
+0080074d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80074d:	55                   	push   %ebp
+  80074e:	89 e5                	mov    %esp,%ebp
+  800750:	83 ec 18             	sub    $0x18,%esp
+  800753:	8b 45 08             	mov    0x8(%ebp),%eax
+  800756:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800759:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80075c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800760:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800763:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80076a:	85 c0                	test   %eax,%eax
+  80076c:	74 26                	je     800794 <vsnprintf+0x47>
+  80076e:	85 d2                	test   %edx,%edx
+  800770:	7e 22                	jle    800794 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800772:	ff 75 14             	push   0x14(%ebp)
+  800775:	ff 75 10             	push   0x10(%ebp)
+  800778:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80077b:	50                   	push   %eax
+  80077c:	68 c6 02 80 00       	push   $0x8002c6
+  800781:	e8 7a fb ff ff       	call   800300 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800786:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800789:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80078c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80078f:	83 c4 10             	add    $0x10,%esp
+}
+  800792:	c9                   	leave
+  800793:	c3                   	ret
+		return -E_INVAL;
+  800794:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800799:	eb f7                	jmp    800792 <vsnprintf+0x45>
+
+0080079b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80079b:	55                   	push   %ebp
+  80079c:	89 e5                	mov    %esp,%ebp
+  80079e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007a1:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007a4:	50                   	push   %eax
+  8007a5:	ff 75 10             	push   0x10(%ebp)
+  8007a8:	ff 75 0c             	push   0xc(%ebp)
+  8007ab:	ff 75 08             	push   0x8(%ebp)
+  8007ae:	e8 9a ff ff ff       	call   80074d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007b3:	c9                   	leave
+  8007b4:	c3                   	ret
+
+008007b5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007b5:	55                   	push   %ebp
+  8007b6:	89 e5                	mov    %esp,%ebp
+  8007b8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c0:	eb 03                	jmp    8007c5 <strlen+0x10>
+		n++;
+  8007c2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007c5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007c9:	75 f7                	jne    8007c2 <strlen+0xd>
+	return n;
+}
+  8007cb:	5d                   	pop    %ebp
+  8007cc:	c3                   	ret
+
+008007cd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007cd:	55                   	push   %ebp
+  8007ce:	89 e5                	mov    %esp,%ebp
+  8007d0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007db:	eb 03                	jmp    8007e0 <strnlen+0x13>
+		n++;
+  8007dd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007e0:	39 d0                	cmp    %edx,%eax
+  8007e2:	74 08                	je     8007ec <strnlen+0x1f>
+  8007e4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007e8:	75 f3                	jne    8007dd <strnlen+0x10>
+  8007ea:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007ec:	89 d0                	mov    %edx,%eax
+  8007ee:	5d                   	pop    %ebp
+  8007ef:	c3                   	ret
+
+008007f0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007f0:	55                   	push   %ebp
+  8007f1:	89 e5                	mov    %esp,%ebp
+  8007f3:	53                   	push   %ebx
+  8007f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007f7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ff:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800803:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800806:	83 c0 01             	add    $0x1,%eax
+  800809:	84 d2                	test   %dl,%dl
+  80080b:	75 f2                	jne    8007ff <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80080d:	89 c8                	mov    %ecx,%eax
+  80080f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800812:	c9                   	leave
+  800813:	c3                   	ret
+
+00800814 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800814:	55                   	push   %ebp
+  800815:	89 e5                	mov    %esp,%ebp
+  800817:	53                   	push   %ebx
+  800818:	83 ec 10             	sub    $0x10,%esp
+  80081b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80081e:	53                   	push   %ebx
+  80081f:	e8 91 ff ff ff       	call   8007b5 <strlen>
+  800824:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800827:	ff 75 0c             	push   0xc(%ebp)
+  80082a:	01 d8                	add    %ebx,%eax
+  80082c:	50                   	push   %eax
+  80082d:	e8 be ff ff ff       	call   8007f0 <strcpy>
+	return dst;
+}
+  800832:	89 d8                	mov    %ebx,%eax
+  800834:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800837:	c9                   	leave
+  800838:	c3                   	ret
+
+00800839 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800839:	55                   	push   %ebp
+  80083a:	89 e5                	mov    %esp,%ebp
+  80083c:	56                   	push   %esi
+  80083d:	53                   	push   %ebx
+  80083e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800841:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800844:	89 f3                	mov    %esi,%ebx
+  800846:	03 5d 10             	add    0x10(%ebp),%ebx
+  800849:	89 f0                	mov    %esi,%eax
+  80084b:	eb 0f                	jmp    80085c <strncpy+0x23>
+		*dst++ = *src;
+  80084d:	83 c0 01             	add    $0x1,%eax
+  800850:	0f b6 0a             	movzbl (%edx),%ecx
+  800853:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800856:	80 f9 01             	cmp    $0x1,%cl
+  800859:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80085c:	39 d8                	cmp    %ebx,%eax
+  80085e:	75 ed                	jne    80084d <strncpy+0x14>
+	}
+	return ret;
+}
+  800860:	89 f0                	mov    %esi,%eax
+  800862:	5b                   	pop    %ebx
+  800863:	5e                   	pop    %esi
+  800864:	5d                   	pop    %ebp
+  800865:	c3                   	ret
+
+00800866 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800866:	55                   	push   %ebp
+  800867:	89 e5                	mov    %esp,%ebp
+  800869:	56                   	push   %esi
+  80086a:	53                   	push   %ebx
+  80086b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80086e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800871:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800874:	89 f0                	mov    %esi,%eax
+  800876:	85 d2                	test   %edx,%edx
+  800878:	74 21                	je     80089b <strlcpy+0x35>
+  80087a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80087e:	89 f2                	mov    %esi,%edx
+  800880:	eb 09                	jmp    80088b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800882:	83 c1 01             	add    $0x1,%ecx
+  800885:	83 c2 01             	add    $0x1,%edx
+  800888:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80088b:	39 c2                	cmp    %eax,%edx
+  80088d:	74 09                	je     800898 <strlcpy+0x32>
+  80088f:	0f b6 19             	movzbl (%ecx),%ebx
+  800892:	84 db                	test   %bl,%bl
+  800894:	75 ec                	jne    800882 <strlcpy+0x1c>
+  800896:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800898:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80089b:	29 f0                	sub    %esi,%eax
+}
+  80089d:	5b                   	pop    %ebx
+  80089e:	5e                   	pop    %esi
+  80089f:	5d                   	pop    %ebp
+  8008a0:	c3                   	ret
+
+008008a1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008a1:	55                   	push   %ebp
+  8008a2:	89 e5                	mov    %esp,%ebp
+  8008a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008aa:	eb 06                	jmp    8008b2 <strcmp+0x11>
+		p++, q++;
+  8008ac:	83 c1 01             	add    $0x1,%ecx
+  8008af:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008b2:	0f b6 01             	movzbl (%ecx),%eax
+  8008b5:	84 c0                	test   %al,%al
+  8008b7:	74 04                	je     8008bd <strcmp+0x1c>
+  8008b9:	3a 02                	cmp    (%edx),%al
+  8008bb:	74 ef                	je     8008ac <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008bd:	0f b6 c0             	movzbl %al,%eax
+  8008c0:	0f b6 12             	movzbl (%edx),%edx
+  8008c3:	29 d0                	sub    %edx,%eax
+}
+  8008c5:	5d                   	pop    %ebp
+  8008c6:	c3                   	ret
+
+008008c7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008c7:	55                   	push   %ebp
+  8008c8:	89 e5                	mov    %esp,%ebp
+  8008ca:	53                   	push   %ebx
+  8008cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008d1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008d4:	eb 09                	jmp    8008df <strncmp+0x18>
+		n--, p++, q++;
+  8008d6:	83 ea 01             	sub    $0x1,%edx
+  8008d9:	83 c0 01             	add    $0x1,%eax
+  8008dc:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008df:	85 d2                	test   %edx,%edx
+  8008e1:	74 18                	je     8008fb <strncmp+0x34>
+  8008e3:	0f b6 18             	movzbl (%eax),%ebx
+  8008e6:	84 db                	test   %bl,%bl
+  8008e8:	74 04                	je     8008ee <strncmp+0x27>
+  8008ea:	3a 19                	cmp    (%ecx),%bl
+  8008ec:	74 e8                	je     8008d6 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008ee:	0f b6 00             	movzbl (%eax),%eax
+  8008f1:	0f b6 11             	movzbl (%ecx),%edx
+  8008f4:	29 d0                	sub    %edx,%eax
+}
+  8008f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008f9:	c9                   	leave
+  8008fa:	c3                   	ret
+		return 0;
+  8008fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800900:	eb f4                	jmp    8008f6 <strncmp+0x2f>
+
+00800902 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800902:	55                   	push   %ebp
+  800903:	89 e5                	mov    %esp,%ebp
+  800905:	8b 45 08             	mov    0x8(%ebp),%eax
+  800908:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80090c:	eb 03                	jmp    800911 <strchr+0xf>
+  80090e:	83 c0 01             	add    $0x1,%eax
+  800911:	0f b6 10             	movzbl (%eax),%edx
+  800914:	84 d2                	test   %dl,%dl
+  800916:	74 06                	je     80091e <strchr+0x1c>
+		if (*s == c)
+  800918:	38 ca                	cmp    %cl,%dl
+  80091a:	75 f2                	jne    80090e <strchr+0xc>
+  80091c:	eb 05                	jmp    800923 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80091e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800923:	5d                   	pop    %ebp
+  800924:	c3                   	ret
+
+00800925 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800925:	55                   	push   %ebp
+  800926:	89 e5                	mov    %esp,%ebp
+  800928:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80092f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800932:	38 ca                	cmp    %cl,%dl
+  800934:	74 09                	je     80093f <strfind+0x1a>
+  800936:	84 d2                	test   %dl,%dl
+  800938:	74 05                	je     80093f <strfind+0x1a>
+	for (; *s; s++)
+  80093a:	83 c0 01             	add    $0x1,%eax
+  80093d:	eb f0                	jmp    80092f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80093f:	5d                   	pop    %ebp
+  800940:	c3                   	ret
+
+00800941 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800941:	55                   	push   %ebp
+  800942:	89 e5                	mov    %esp,%ebp
+  800944:	57                   	push   %edi
+  800945:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800948:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80094b:	85 c9                	test   %ecx,%ecx
+  80094d:	74 20                	je     80096f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80094f:	89 f8                	mov    %edi,%eax
+  800951:	09 c8                	or     %ecx,%eax
+  800953:	a8 03                	test   $0x3,%al
+  800955:	75 12                	jne    800969 <memset+0x28>
+		c &= 0xFF;
+  800957:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80095b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800961:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800964:	fc                   	cld
+  800965:	f3 ab                	rep stos %eax,%es:(%edi)
+  800967:	eb 06                	jmp    80096f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800969:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80096c:	fc                   	cld
+  80096d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80096f:	89 f8                	mov    %edi,%eax
+  800971:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800974:	c9                   	leave
+  800975:	c3                   	ret
+
+00800976 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800976:	55                   	push   %ebp
+  800977:	89 e5                	mov    %esp,%ebp
+  800979:	57                   	push   %edi
+  80097a:	56                   	push   %esi
+  80097b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800981:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800984:	39 c6                	cmp    %eax,%esi
+  800986:	73 32                	jae    8009ba <memmove+0x44>
+  800988:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80098b:	39 d0                	cmp    %edx,%eax
+  80098d:	73 2b                	jae    8009ba <memmove+0x44>
+		s += n;
+		d += n;
+  80098f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800992:	89 d6                	mov    %edx,%esi
+  800994:	09 fe                	or     %edi,%esi
+  800996:	09 ce                	or     %ecx,%esi
+  800998:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80099e:	75 0e                	jne    8009ae <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009a0:	83 ef 04             	sub    $0x4,%edi
+  8009a3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009a6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009a9:	fd                   	std
+  8009aa:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009ac:	eb 09                	jmp    8009b7 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009ae:	83 ef 01             	sub    $0x1,%edi
+  8009b1:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009b4:	fd                   	std
+  8009b5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009b7:	fc                   	cld
+  8009b8:	eb 1a                	jmp    8009d4 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ba:	89 f2                	mov    %esi,%edx
+  8009bc:	09 c2                	or     %eax,%edx
+  8009be:	09 ca                	or     %ecx,%edx
+  8009c0:	f6 c2 03             	test   $0x3,%dl
+  8009c3:	75 0a                	jne    8009cf <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009c5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009c8:	89 c7                	mov    %eax,%edi
+  8009ca:	fc                   	cld
+  8009cb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009cd:	eb 05                	jmp    8009d4 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009cf:	89 c7                	mov    %eax,%edi
+  8009d1:	fc                   	cld
+  8009d2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009d4:	5e                   	pop    %esi
+  8009d5:	5f                   	pop    %edi
+  8009d6:	5d                   	pop    %ebp
+  8009d7:	c3                   	ret
+
+008009d8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009d8:	55                   	push   %ebp
+  8009d9:	89 e5                	mov    %esp,%ebp
+  8009db:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009de:	ff 75 10             	push   0x10(%ebp)
+  8009e1:	ff 75 0c             	push   0xc(%ebp)
+  8009e4:	ff 75 08             	push   0x8(%ebp)
+  8009e7:	e8 8a ff ff ff       	call   800976 <memmove>
+}
+  8009ec:	c9                   	leave
+  8009ed:	c3                   	ret
+
+008009ee <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009ee:	55                   	push   %ebp
+  8009ef:	89 e5                	mov    %esp,%ebp
+  8009f1:	56                   	push   %esi
+  8009f2:	53                   	push   %ebx
+  8009f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009f9:	89 c6                	mov    %eax,%esi
+  8009fb:	03 75 10             	add    0x10(%ebp),%esi
+  8009fe:	eb 06                	jmp    800a06 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a00:	83 c0 01             	add    $0x1,%eax
+  800a03:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a06:	39 f0                	cmp    %esi,%eax
+  800a08:	74 14                	je     800a1e <memcmp+0x30>
+		if (*s1 != *s2)
+  800a0a:	0f b6 08             	movzbl (%eax),%ecx
+  800a0d:	0f b6 1a             	movzbl (%edx),%ebx
+  800a10:	38 d9                	cmp    %bl,%cl
+  800a12:	74 ec                	je     800a00 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a14:	0f b6 c1             	movzbl %cl,%eax
+  800a17:	0f b6 db             	movzbl %bl,%ebx
+  800a1a:	29 d8                	sub    %ebx,%eax
+  800a1c:	eb 05                	jmp    800a23 <memcmp+0x35>
+	}
+
+	return 0;
+  800a1e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a23:	5b                   	pop    %ebx
+  800a24:	5e                   	pop    %esi
+  800a25:	5d                   	pop    %ebp
+  800a26:	c3                   	ret
+
+00800a27 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a27:	55                   	push   %ebp
+  800a28:	89 e5                	mov    %esp,%ebp
+  800a2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a30:	89 c2                	mov    %eax,%edx
+  800a32:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a35:	eb 03                	jmp    800a3a <memfind+0x13>
+  800a37:	83 c0 01             	add    $0x1,%eax
+  800a3a:	39 d0                	cmp    %edx,%eax
+  800a3c:	73 04                	jae    800a42 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a3e:	38 08                	cmp    %cl,(%eax)
+  800a40:	75 f5                	jne    800a37 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a42:	5d                   	pop    %ebp
+  800a43:	c3                   	ret
+
+00800a44 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a44:	55                   	push   %ebp
+  800a45:	89 e5                	mov    %esp,%ebp
+  800a47:	57                   	push   %edi
+  800a48:	56                   	push   %esi
+  800a49:	53                   	push   %ebx
+  800a4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a4d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a50:	eb 03                	jmp    800a55 <strtol+0x11>
+		s++;
+  800a52:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a55:	0f b6 02             	movzbl (%edx),%eax
+  800a58:	3c 20                	cmp    $0x20,%al
+  800a5a:	74 f6                	je     800a52 <strtol+0xe>
+  800a5c:	3c 09                	cmp    $0x9,%al
+  800a5e:	74 f2                	je     800a52 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a60:	3c 2b                	cmp    $0x2b,%al
+  800a62:	74 2a                	je     800a8e <strtol+0x4a>
+	int neg = 0;
+  800a64:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a69:	3c 2d                	cmp    $0x2d,%al
+  800a6b:	74 2b                	je     800a98 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a6d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a73:	75 0f                	jne    800a84 <strtol+0x40>
+  800a75:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a78:	74 28                	je     800aa2 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a7a:	85 db                	test   %ebx,%ebx
+  800a7c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a81:	0f 44 d8             	cmove  %eax,%ebx
+  800a84:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a89:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a8c:	eb 46                	jmp    800ad4 <strtol+0x90>
+		s++;
+  800a8e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a91:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a96:	eb d5                	jmp    800a6d <strtol+0x29>
+		s++, neg = 1;
+  800a98:	83 c2 01             	add    $0x1,%edx
+  800a9b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800aa0:	eb cb                	jmp    800a6d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aa2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800aa6:	74 0e                	je     800ab6 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800aa8:	85 db                	test   %ebx,%ebx
+  800aaa:	75 d8                	jne    800a84 <strtol+0x40>
+		s++, base = 8;
+  800aac:	83 c2 01             	add    $0x1,%edx
+  800aaf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ab4:	eb ce                	jmp    800a84 <strtol+0x40>
+		s += 2, base = 16;
+  800ab6:	83 c2 02             	add    $0x2,%edx
+  800ab9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800abe:	eb c4                	jmp    800a84 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ac0:	0f be c0             	movsbl %al,%eax
+  800ac3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ac6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ac9:	7d 3a                	jge    800b05 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800acb:	83 c2 01             	add    $0x1,%edx
+  800ace:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ad2:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ad4:	0f b6 02             	movzbl (%edx),%eax
+  800ad7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ada:	89 f3                	mov    %esi,%ebx
+  800adc:	80 fb 09             	cmp    $0x9,%bl
+  800adf:	76 df                	jbe    800ac0 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ae1:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ae4:	89 f3                	mov    %esi,%ebx
+  800ae6:	80 fb 19             	cmp    $0x19,%bl
+  800ae9:	77 08                	ja     800af3 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800aeb:	0f be c0             	movsbl %al,%eax
+  800aee:	83 e8 57             	sub    $0x57,%eax
+  800af1:	eb d3                	jmp    800ac6 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800af3:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800af6:	89 f3                	mov    %esi,%ebx
+  800af8:	80 fb 19             	cmp    $0x19,%bl
+  800afb:	77 08                	ja     800b05 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800afd:	0f be c0             	movsbl %al,%eax
+  800b00:	83 e8 37             	sub    $0x37,%eax
+  800b03:	eb c1                	jmp    800ac6 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b05:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b09:	74 05                	je     800b10 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b0e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b10:	89 c8                	mov    %ecx,%eax
+  800b12:	f7 d8                	neg    %eax
+  800b14:	85 ff                	test   %edi,%edi
+  800b16:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b19:	89 c8                	mov    %ecx,%eax
+  800b1b:	5b                   	pop    %ebx
+  800b1c:	5e                   	pop    %esi
+  800b1d:	5f                   	pop    %edi
+  800b1e:	5d                   	pop    %ebp
+  800b1f:	c3                   	ret
+
+00800b20 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800b20:	55                   	push   %ebp
+  800b21:	89 e5                	mov    %esp,%ebp
+  800b23:	57                   	push   %edi
+  800b24:	56                   	push   %esi
+  800b25:	53                   	push   %ebx
+  800b26:	83 ec 0c             	sub    $0xc,%esp
+  800b29:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b2c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b2f:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800b32:	85 ff                	test   %edi,%edi
+  800b34:	74 16                	je     800b4c <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800b36:	83 ec 04             	sub    $0x4,%esp
+  800b39:	56                   	push   %esi
+  800b3a:	6a 00                	push   $0x0
+  800b3c:	53                   	push   %ebx
+  800b3d:	e8 02 ff ff ff       	call   800a44 <strtol>
+  800b42:	89 07                	mov    %eax,(%edi)
+  800b44:	83 c4 10             	add    $0x10,%esp
+  800b47:	eb 03                	jmp    800b4c <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800b49:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800b4c:	0f b6 03             	movzbl (%ebx),%eax
+  800b4f:	3c 20                	cmp    $0x20,%al
+  800b51:	74 f6                	je     800b49 <strisl+0x29>
+  800b53:	3c 09                	cmp    $0x9,%al
+  800b55:	74 f2                	je     800b49 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b57:	3c 2b                	cmp    $0x2b,%al
+  800b59:	74 23                	je     800b7e <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800b5b:	3c 2d                	cmp    $0x2d,%al
+  800b5d:	0f 94 c0             	sete   %al
+  800b60:	0f b6 c0             	movzbl %al,%eax
+  800b63:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b65:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800b6b:	75 41                	jne    800bae <strisl+0x8e>
+  800b6d:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800b70:	74 11                	je     800b83 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b72:	85 f6                	test   %esi,%esi
+  800b74:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b79:	0f 44 f0             	cmove  %eax,%esi
+  800b7c:	eb 30                	jmp    800bae <strisl+0x8e>
+		s++;
+  800b7e:	83 c3 01             	add    $0x1,%ebx
+  800b81:	eb e2                	jmp    800b65 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b83:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800b87:	74 0e                	je     800b97 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800b89:	85 f6                	test   %esi,%esi
+  800b8b:	75 21                	jne    800bae <strisl+0x8e>
+		s++, base = 8;
+  800b8d:	83 c3 01             	add    $0x1,%ebx
+  800b90:	be 08 00 00 00       	mov    $0x8,%esi
+  800b95:	eb 17                	jmp    800bae <strisl+0x8e>
+		s += 2, base = 16;
+  800b97:	83 c3 02             	add    $0x2,%ebx
+  800b9a:	be 10 00 00 00       	mov    $0x10,%esi
+  800b9f:	eb 0d                	jmp    800bae <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ba1:	0f be c0             	movsbl %al,%eax
+  800ba4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800ba7:	39 f0                	cmp    %esi,%eax
+  800ba9:	7d 38                	jge    800be3 <strisl+0xc3>
+			return 0;
+		s++;
+  800bab:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800bae:	0f b6 03             	movzbl (%ebx),%eax
+  800bb1:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800bb4:	80 fa 09             	cmp    $0x9,%dl
+  800bb7:	76 e8                	jbe    800ba1 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800bb9:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800bbc:	80 fa 19             	cmp    $0x19,%dl
+  800bbf:	77 08                	ja     800bc9 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800bc1:	0f be c0             	movsbl %al,%eax
+  800bc4:	83 e8 57             	sub    $0x57,%eax
+  800bc7:	eb de                	jmp    800ba7 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bc9:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800bcc:	80 fa 19             	cmp    $0x19,%dl
+  800bcf:	77 08                	ja     800bd9 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800bd1:	0f be c0             	movsbl %al,%eax
+  800bd4:	83 e8 37             	sub    $0x37,%eax
+  800bd7:	eb ce                	jmp    800ba7 <strisl+0x87>
+		else if (!*s)
+  800bd9:	84 c0                	test   %al,%al
+  800bdb:	0f 94 c0             	sete   %al
+  800bde:	0f b6 c0             	movzbl %al,%eax
+  800be1:	eb 05                	jmp    800be8 <strisl+0xc8>
+			return 0;
+  800be3:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800be8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800beb:	5b                   	pop    %ebx
+  800bec:	5e                   	pop    %esi
+  800bed:	5f                   	pop    %edi
+  800bee:	5d                   	pop    %ebp
+  800bef:	c3                   	ret
+
+00800bf0 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800bf0:	55                   	push   %ebp
+  800bf1:	89 e5                	mov    %esp,%ebp
+  800bf3:	83 ec 10             	sub    $0x10,%esp
+  800bf6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800bf9:	89 c8                	mov    %ecx,%eax
+  800bfb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800c00:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800c03:	eb 0b                	jmp    800c10 <touch_mem+0x20>
+		c = *(char *)page;
+  800c05:	0f b6 10             	movzbl (%eax),%edx
+  800c08:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c0b:	05 00 10 00 00       	add    $0x1000,%eax
+  800c10:	39 c8                	cmp    %ecx,%eax
+  800c12:	72 f1                	jb     800c05 <touch_mem+0x15>
+}
+  800c14:	c9                   	leave
+  800c15:	c3                   	ret
+
+00800c16 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c16:	55                   	push   %ebp
+  800c17:	89 e5                	mov    %esp,%ebp
+  800c19:	57                   	push   %edi
+  800c1a:	56                   	push   %esi
+  800c1b:	53                   	push   %ebx
+	touch_mem(s, len);
+  800c1c:	ff 75 0c             	push   0xc(%ebp)
+  800c1f:	ff 75 08             	push   0x8(%ebp)
+  800c22:	e8 c9 ff ff ff       	call   800bf0 <touch_mem>
+	asm volatile("int %1\n"
+  800c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c32:	89 c3                	mov    %eax,%ebx
+  800c34:	89 c7                	mov    %eax,%edi
+  800c36:	89 c6                	mov    %eax,%esi
+  800c38:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c3a:	83 c4 08             	add    $0x8,%esp
+  800c3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c40:	5b                   	pop    %ebx
+  800c41:	5e                   	pop    %esi
+  800c42:	5f                   	pop    %edi
+  800c43:	5d                   	pop    %ebp
+  800c44:	c3                   	ret
+
+00800c45 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c45:	55                   	push   %ebp
+  800c46:	89 e5                	mov    %esp,%ebp
+  800c48:	57                   	push   %edi
+  800c49:	56                   	push   %esi
+  800c4a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c50:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c55:	89 d1                	mov    %edx,%ecx
+  800c57:	89 d3                	mov    %edx,%ebx
+  800c59:	89 d7                	mov    %edx,%edi
+  800c5b:	89 d6                	mov    %edx,%esi
+  800c5d:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c5f:	5b                   	pop    %ebx
+  800c60:	5e                   	pop    %esi
+  800c61:	5f                   	pop    %edi
+  800c62:	5d                   	pop    %ebp
+  800c63:	c3                   	ret
+
+00800c64 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c64:	55                   	push   %ebp
+  800c65:	89 e5                	mov    %esp,%ebp
+  800c67:	57                   	push   %edi
+  800c68:	56                   	push   %esi
+  800c69:	53                   	push   %ebx
+  800c6a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c75:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c7a:	89 cb                	mov    %ecx,%ebx
+  800c7c:	89 cf                	mov    %ecx,%edi
+  800c7e:	89 ce                	mov    %ecx,%esi
+  800c80:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c82:	85 c0                	test   %eax,%eax
+  800c84:	7f 08                	jg     800c8e <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c89:	5b                   	pop    %ebx
+  800c8a:	5e                   	pop    %esi
+  800c8b:	5f                   	pop    %edi
+  800c8c:	5d                   	pop    %ebp
+  800c8d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c8e:	83 ec 0c             	sub    $0xc,%esp
+  800c91:	50                   	push   %eax
+  800c92:	6a 03                	push   $0x3
+  800c94:	68 4b 2d 80 00       	push   $0x802d4b
+  800c99:	6a 23                	push   $0x23
+  800c9b:	68 68 2d 80 00       	push   $0x802d68
+  800ca0:	e8 1c 18 00 00       	call   8024c1 <_panic>
+
+00800ca5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ca5:	55                   	push   %ebp
+  800ca6:	89 e5                	mov    %esp,%ebp
+  800ca8:	57                   	push   %edi
+  800ca9:	56                   	push   %esi
+  800caa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cab:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb0:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cb5:	89 d1                	mov    %edx,%ecx
+  800cb7:	89 d3                	mov    %edx,%ebx
+  800cb9:	89 d7                	mov    %edx,%edi
+  800cbb:	89 d6                	mov    %edx,%esi
+  800cbd:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cbf:	5b                   	pop    %ebx
+  800cc0:	5e                   	pop    %esi
+  800cc1:	5f                   	pop    %edi
+  800cc2:	5d                   	pop    %ebp
+  800cc3:	c3                   	ret
+
+00800cc4 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cc4:	55                   	push   %ebp
+  800cc5:	89 e5                	mov    %esp,%ebp
+  800cc7:	57                   	push   %edi
+  800cc8:	56                   	push   %esi
+  800cc9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cca:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ccf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cd4:	89 d1                	mov    %edx,%ecx
+  800cd6:	89 d3                	mov    %edx,%ebx
+  800cd8:	89 d7                	mov    %edx,%edi
+  800cda:	89 d6                	mov    %edx,%esi
+  800cdc:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cde:	5b                   	pop    %ebx
+  800cdf:	5e                   	pop    %esi
+  800ce0:	5f                   	pop    %edi
+  800ce1:	5d                   	pop    %ebp
+  800ce2:	c3                   	ret
+
+00800ce3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ce3:	55                   	push   %ebp
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	57                   	push   %edi
+  800ce7:	56                   	push   %esi
+  800ce8:	53                   	push   %ebx
+  800ce9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cec:	be 00 00 00 00       	mov    $0x0,%esi
+  800cf1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf7:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cfc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cff:	89 f7                	mov    %esi,%edi
+  800d01:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d03:	85 c0                	test   %eax,%eax
+  800d05:	7f 08                	jg     800d0f <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0a:	5b                   	pop    %ebx
+  800d0b:	5e                   	pop    %esi
+  800d0c:	5f                   	pop    %edi
+  800d0d:	5d                   	pop    %ebp
+  800d0e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d0f:	83 ec 0c             	sub    $0xc,%esp
+  800d12:	50                   	push   %eax
+  800d13:	6a 04                	push   $0x4
+  800d15:	68 4b 2d 80 00       	push   $0x802d4b
+  800d1a:	6a 23                	push   $0x23
+  800d1c:	68 68 2d 80 00       	push   $0x802d68
+  800d21:	e8 9b 17 00 00       	call   8024c1 <_panic>
+
+00800d26 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d26:	55                   	push   %ebp
+  800d27:	89 e5                	mov    %esp,%ebp
+  800d29:	57                   	push   %edi
+  800d2a:	56                   	push   %esi
+  800d2b:	53                   	push   %ebx
+  800d2c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d35:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d3d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d40:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d43:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d45:	85 c0                	test   %eax,%eax
+  800d47:	7f 08                	jg     800d51 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4c:	5b                   	pop    %ebx
+  800d4d:	5e                   	pop    %esi
+  800d4e:	5f                   	pop    %edi
+  800d4f:	5d                   	pop    %ebp
+  800d50:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d51:	83 ec 0c             	sub    $0xc,%esp
+  800d54:	50                   	push   %eax
+  800d55:	6a 05                	push   $0x5
+  800d57:	68 4b 2d 80 00       	push   $0x802d4b
+  800d5c:	6a 23                	push   $0x23
+  800d5e:	68 68 2d 80 00       	push   $0x802d68
+  800d63:	e8 59 17 00 00       	call   8024c1 <_panic>
+
+00800d68 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d68:	55                   	push   %ebp
+  800d69:	89 e5                	mov    %esp,%ebp
+  800d6b:	57                   	push   %edi
+  800d6c:	56                   	push   %esi
+  800d6d:	53                   	push   %ebx
+  800d6e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d71:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d81:	89 df                	mov    %ebx,%edi
+  800d83:	89 de                	mov    %ebx,%esi
+  800d85:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d87:	85 c0                	test   %eax,%eax
+  800d89:	7f 08                	jg     800d93 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8e:	5b                   	pop    %ebx
+  800d8f:	5e                   	pop    %esi
+  800d90:	5f                   	pop    %edi
+  800d91:	5d                   	pop    %ebp
+  800d92:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d93:	83 ec 0c             	sub    $0xc,%esp
+  800d96:	50                   	push   %eax
+  800d97:	6a 06                	push   $0x6
+  800d99:	68 4b 2d 80 00       	push   $0x802d4b
+  800d9e:	6a 23                	push   $0x23
+  800da0:	68 68 2d 80 00       	push   $0x802d68
+  800da5:	e8 17 17 00 00       	call   8024c1 <_panic>
+
+00800daa <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800daa:	55                   	push   %ebp
+  800dab:	89 e5                	mov    %esp,%ebp
+  800dad:	57                   	push   %edi
+  800dae:	56                   	push   %esi
+  800daf:	53                   	push   %ebx
+  800db0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800db3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbe:	b8 18 00 00 00       	mov    $0x18,%eax
+  800dc3:	89 df                	mov    %ebx,%edi
+  800dc5:	89 de                	mov    %ebx,%esi
+  800dc7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dc9:	85 c0                	test   %eax,%eax
+  800dcb:	7f 08                	jg     800dd5 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800dcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd0:	5b                   	pop    %ebx
+  800dd1:	5e                   	pop    %esi
+  800dd2:	5f                   	pop    %edi
+  800dd3:	5d                   	pop    %ebp
+  800dd4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd5:	83 ec 0c             	sub    $0xc,%esp
+  800dd8:	50                   	push   %eax
+  800dd9:	6a 18                	push   $0x18
+  800ddb:	68 4b 2d 80 00       	push   $0x802d4b
+  800de0:	6a 23                	push   $0x23
+  800de2:	68 68 2d 80 00       	push   $0x802d68
+  800de7:	e8 d5 16 00 00       	call   8024c1 <_panic>
+
+00800dec <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800dec:	55                   	push   %ebp
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	57                   	push   %edi
+  800df0:	56                   	push   %esi
+  800df1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800df2:	be 00 00 00 00       	mov    $0x0,%esi
+  800df7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfd:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e05:	89 f7                	mov    %esi,%edi
+  800e07:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800e09:	5b                   	pop    %ebx
+  800e0a:	5e                   	pop    %esi
+  800e0b:	5f                   	pop    %edi
+  800e0c:	5d                   	pop    %ebp
+  800e0d:	c3                   	ret
+
+00800e0e <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800e0e:	55                   	push   %ebp
+  800e0f:	89 e5                	mov    %esp,%ebp
+  800e11:	57                   	push   %edi
+  800e12:	56                   	push   %esi
+  800e13:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e1f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e24:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e27:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e2a:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e2c:	5b                   	pop    %ebx
+  800e2d:	5e                   	pop    %esi
+  800e2e:	5f                   	pop    %edi
+  800e2f:	5d                   	pop    %ebp
+  800e30:	c3                   	ret
+
+00800e31 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	57                   	push   %edi
+  800e35:	56                   	push   %esi
+  800e36:	53                   	push   %ebx
+  800e37:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800e3a:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800e3d:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800e43:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800e46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e54:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e57:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e59:	85 c0                	test   %eax,%eax
+  800e5b:	7f 08                	jg     800e65 <sys_page_map_range+0x34>
+}
+  800e5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e60:	5b                   	pop    %ebx
+  800e61:	5e                   	pop    %esi
+  800e62:	5f                   	pop    %edi
+  800e63:	5d                   	pop    %ebp
+  800e64:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e65:	83 ec 0c             	sub    $0xc,%esp
+  800e68:	50                   	push   %eax
+  800e69:	6a 10                	push   $0x10
+  800e6b:	68 4b 2d 80 00       	push   $0x802d4b
+  800e70:	6a 23                	push   $0x23
+  800e72:	68 68 2d 80 00       	push   $0x802d68
+  800e77:	e8 45 16 00 00       	call   8024c1 <_panic>
+
+00800e7c <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e7c:	55                   	push   %ebp
+  800e7d:	89 e5                	mov    %esp,%ebp
+  800e7f:	57                   	push   %edi
+  800e80:	56                   	push   %esi
+  800e81:	53                   	push   %ebx
+  800e82:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e85:	be 00 00 00 00       	mov    $0x0,%esi
+  800e8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e90:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e98:	89 f7                	mov    %esi,%edi
+  800e9a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e9c:	85 c0                	test   %eax,%eax
+  800e9e:	7f 08                	jg     800ea8 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ea0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea3:	5b                   	pop    %ebx
+  800ea4:	5e                   	pop    %esi
+  800ea5:	5f                   	pop    %edi
+  800ea6:	5d                   	pop    %ebp
+  800ea7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea8:	83 ec 0c             	sub    $0xc,%esp
+  800eab:	50                   	push   %eax
+  800eac:	6a 11                	push   $0x11
+  800eae:	68 4b 2d 80 00       	push   $0x802d4b
+  800eb3:	6a 23                	push   $0x23
+  800eb5:	68 68 2d 80 00       	push   $0x802d68
+  800eba:	e8 02 16 00 00       	call   8024c1 <_panic>
+
+00800ebf <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800ebf:	55                   	push   %ebp
+  800ec0:	89 e5                	mov    %esp,%ebp
+  800ec2:	57                   	push   %edi
+  800ec3:	56                   	push   %esi
+  800ec4:	53                   	push   %ebx
+  800ec5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ec8:	be 00 00 00 00       	mov    $0x0,%esi
+  800ecd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800ed8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800edb:	89 f7                	mov    %esi,%edi
+  800edd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800edf:	85 c0                	test   %eax,%eax
+  800ee1:	7f 08                	jg     800eeb <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ee3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee6:	5b                   	pop    %ebx
+  800ee7:	5e                   	pop    %esi
+  800ee8:	5f                   	pop    %edi
+  800ee9:	5d                   	pop    %ebp
+  800eea:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eeb:	83 ec 0c             	sub    $0xc,%esp
+  800eee:	50                   	push   %eax
+  800eef:	6a 1b                	push   $0x1b
+  800ef1:	68 4b 2d 80 00       	push   $0x802d4b
+  800ef6:	6a 23                	push   $0x23
+  800ef8:	68 68 2d 80 00       	push   $0x802d68
+  800efd:	e8 bf 15 00 00       	call   8024c1 <_panic>
+
+00800f02 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800f02:	55                   	push   %ebp
+  800f03:	89 e5                	mov    %esp,%ebp
+  800f05:	57                   	push   %edi
+  800f06:	56                   	push   %esi
+  800f07:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f08:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f0d:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f12:	89 d1                	mov    %edx,%ecx
+  800f14:	89 d3                	mov    %edx,%ebx
+  800f16:	89 d7                	mov    %edx,%edi
+  800f18:	89 d6                	mov    %edx,%esi
+  800f1a:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f1c:	5b                   	pop    %ebx
+  800f1d:	5e                   	pop    %esi
+  800f1e:	5f                   	pop    %edi
+  800f1f:	5d                   	pop    %ebp
+  800f20:	c3                   	ret
+
+00800f21 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f21:	55                   	push   %ebp
+  800f22:	89 e5                	mov    %esp,%ebp
+  800f24:	57                   	push   %edi
+  800f25:	56                   	push   %esi
+  800f26:	53                   	push   %ebx
+  800f27:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f35:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f3a:	89 df                	mov    %ebx,%edi
+  800f3c:	89 de                	mov    %ebx,%esi
+  800f3e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f40:	85 c0                	test   %eax,%eax
+  800f42:	7f 08                	jg     800f4c <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f47:	5b                   	pop    %ebx
+  800f48:	5e                   	pop    %esi
+  800f49:	5f                   	pop    %edi
+  800f4a:	5d                   	pop    %ebp
+  800f4b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f4c:	83 ec 0c             	sub    $0xc,%esp
+  800f4f:	50                   	push   %eax
+  800f50:	6a 08                	push   $0x8
+  800f52:	68 4b 2d 80 00       	push   $0x802d4b
+  800f57:	6a 23                	push   $0x23
+  800f59:	68 68 2d 80 00       	push   $0x802d68
+  800f5e:	e8 5e 15 00 00       	call   8024c1 <_panic>
+
+00800f63 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f63:	55                   	push   %ebp
+  800f64:	89 e5                	mov    %esp,%ebp
+  800f66:	57                   	push   %edi
+  800f67:	56                   	push   %esi
+  800f68:	53                   	push   %ebx
+  800f69:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800f6c:	6a 44                	push   $0x44
+  800f6e:	ff 75 0c             	push   0xc(%ebp)
+  800f71:	e8 7a fc ff ff       	call   800bf0 <touch_mem>
+	asm volatile("int %1\n"
+  800f76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7e:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f86:	89 df                	mov    %ebx,%edi
+  800f88:	89 de                	mov    %ebx,%esi
+  800f8a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f8c:	83 c4 08             	add    $0x8,%esp
+  800f8f:	85 c0                	test   %eax,%eax
+  800f91:	7f 08                	jg     800f9b <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f96:	5b                   	pop    %ebx
+  800f97:	5e                   	pop    %esi
+  800f98:	5f                   	pop    %edi
+  800f99:	5d                   	pop    %ebp
+  800f9a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9b:	83 ec 0c             	sub    $0xc,%esp
+  800f9e:	50                   	push   %eax
+  800f9f:	6a 09                	push   $0x9
+  800fa1:	68 4b 2d 80 00       	push   $0x802d4b
+  800fa6:	6a 23                	push   $0x23
+  800fa8:	68 68 2d 80 00       	push   $0x802d68
+  800fad:	e8 0f 15 00 00       	call   8024c1 <_panic>
+
+00800fb2 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800fb2:	55                   	push   %ebp
+  800fb3:	89 e5                	mov    %esp,%ebp
+  800fb5:	57                   	push   %edi
+  800fb6:	56                   	push   %esi
+  800fb7:	53                   	push   %ebx
+  800fb8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fbb:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800fcb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fce:	89 f7                	mov    %esi,%edi
+  800fd0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd2:	85 c0                	test   %eax,%eax
+  800fd4:	7f 08                	jg     800fde <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800fd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd9:	5b                   	pop    %ebx
+  800fda:	5e                   	pop    %esi
+  800fdb:	5f                   	pop    %edi
+  800fdc:	5d                   	pop    %ebp
+  800fdd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fde:	83 ec 0c             	sub    $0xc,%esp
+  800fe1:	50                   	push   %eax
+  800fe2:	6a 1a                	push   $0x1a
+  800fe4:	68 4b 2d 80 00       	push   $0x802d4b
+  800fe9:	6a 23                	push   $0x23
+  800feb:	68 68 2d 80 00       	push   $0x802d68
+  800ff0:	e8 cc 14 00 00       	call   8024c1 <_panic>
+
+00800ff5 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  800ff5:	55                   	push   %ebp
+  800ff6:	89 e5                	mov    %esp,%ebp
+  800ff8:	57                   	push   %edi
+  800ff9:	56                   	push   %esi
+  800ffa:	53                   	push   %ebx
+  800ffb:	83 ec 0c             	sub    $0xc,%esp
+  800ffe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801001:	89 d8                	mov    %ebx,%eax
+  801003:	c1 e0 05             	shl    $0x5,%eax
+  801006:	50                   	push   %eax
+  801007:	ff 75 0c             	push   0xc(%ebp)
+  80100a:	e8 e1 fb ff ff       	call   800bf0 <touch_mem>
+	asm volatile("int %1\n"
+  80100f:	be 00 00 00 00       	mov    $0x0,%esi
+  801014:	8b 55 08             	mov    0x8(%ebp),%edx
+  801017:	b8 13 00 00 00       	mov    $0x13,%eax
+  80101c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101f:	89 f7                	mov    %esi,%edi
+  801021:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801023:	83 c4 08             	add    $0x8,%esp
+  801026:	85 c0                	test   %eax,%eax
+  801028:	7f 08                	jg     801032 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  80102a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80102d:	5b                   	pop    %ebx
+  80102e:	5e                   	pop    %esi
+  80102f:	5f                   	pop    %edi
+  801030:	5d                   	pop    %ebp
+  801031:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801032:	83 ec 0c             	sub    $0xc,%esp
+  801035:	50                   	push   %eax
+  801036:	6a 13                	push   $0x13
+  801038:	68 4b 2d 80 00       	push   $0x802d4b
+  80103d:	6a 23                	push   $0x23
+  80103f:	68 68 2d 80 00       	push   $0x802d68
+  801044:	e8 78 14 00 00       	call   8024c1 <_panic>
+
+00801049 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801049:	55                   	push   %ebp
+  80104a:	89 e5                	mov    %esp,%ebp
+  80104c:	57                   	push   %edi
+  80104d:	56                   	push   %esi
+  80104e:	53                   	push   %ebx
+  80104f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801052:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801057:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801062:	89 df                	mov    %ebx,%edi
+  801064:	89 de                	mov    %ebx,%esi
+  801066:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801068:	85 c0                	test   %eax,%eax
+  80106a:	7f 08                	jg     801074 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80106c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80106f:	5b                   	pop    %ebx
+  801070:	5e                   	pop    %esi
+  801071:	5f                   	pop    %edi
+  801072:	5d                   	pop    %ebp
+  801073:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801074:	83 ec 0c             	sub    $0xc,%esp
+  801077:	50                   	push   %eax
+  801078:	6a 0a                	push   $0xa
+  80107a:	68 4b 2d 80 00       	push   $0x802d4b
+  80107f:	6a 23                	push   $0x23
+  801081:	68 68 2d 80 00       	push   $0x802d68
+  801086:	e8 36 14 00 00       	call   8024c1 <_panic>
+
+0080108b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80108b:	55                   	push   %ebp
+  80108c:	89 e5                	mov    %esp,%ebp
+  80108e:	57                   	push   %edi
+  80108f:	56                   	push   %esi
+  801090:	53                   	push   %ebx
+  801091:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801094:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80109a:	76 1d                	jbe    8010b9 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80109c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010a7:	be 01 00 00 00       	mov    $0x1,%esi
+  8010ac:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010af:	cd 30                	int    $0x30
+}
+  8010b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b4:	5b                   	pop    %ebx
+  8010b5:	5e                   	pop    %esi
+  8010b6:	5f                   	pop    %edi
+  8010b7:	5d                   	pop    %ebp
+  8010b8:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8010b9:	68 00 10 00 00       	push   $0x1000
+  8010be:	53                   	push   %ebx
+  8010bf:	e8 2c fb ff ff       	call   800bf0 <touch_mem>
+  8010c4:	83 c4 08             	add    $0x8,%esp
+  8010c7:	eb d3                	jmp    80109c <sys_ipc_send+0x11>
+
+008010c9 <sys_ipc_send_pages>:
+{
+  8010c9:	55                   	push   %ebp
+  8010ca:	89 e5                	mov    %esp,%ebp
+  8010cc:	57                   	push   %edi
+  8010cd:	56                   	push   %esi
+  8010ce:	53                   	push   %ebx
+  8010cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d2:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8010d5:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010db:	76 18                	jbe    8010f5 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8010dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010e8:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8010eb:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8010ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f0:	5b                   	pop    %ebx
+  8010f1:	5e                   	pop    %esi
+  8010f2:	5f                   	pop    %edi
+  8010f3:	5d                   	pop    %ebp
+  8010f4:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8010f5:	89 f0                	mov    %esi,%eax
+  8010f7:	c1 e0 0c             	shl    $0xc,%eax
+  8010fa:	50                   	push   %eax
+  8010fb:	53                   	push   %ebx
+  8010fc:	e8 ef fa ff ff       	call   800bf0 <touch_mem>
+  801101:	83 c4 08             	add    $0x8,%esp
+  801104:	eb d7                	jmp    8010dd <sys_ipc_send_pages+0x14>
+
+00801106 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801106:	55                   	push   %ebp
+  801107:	89 e5                	mov    %esp,%ebp
+  801109:	57                   	push   %edi
+  80110a:	56                   	push   %esi
+  80110b:	53                   	push   %ebx
+  80110c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80110f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801114:	8b 55 08             	mov    0x8(%ebp),%edx
+  801117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80111f:	89 df                	mov    %ebx,%edi
+  801121:	89 de                	mov    %ebx,%esi
+  801123:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801125:	85 c0                	test   %eax,%eax
+  801127:	7f 08                	jg     801131 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801129:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112c:	5b                   	pop    %ebx
+  80112d:	5e                   	pop    %esi
+  80112e:	5f                   	pop    %edi
+  80112f:	5d                   	pop    %ebp
+  801130:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801131:	83 ec 0c             	sub    $0xc,%esp
+  801134:	50                   	push   %eax
+  801135:	6a 0d                	push   $0xd
+  801137:	68 4b 2d 80 00       	push   $0x802d4b
+  80113c:	6a 23                	push   $0x23
+  80113e:	68 68 2d 80 00       	push   $0x802d68
+  801143:	e8 79 13 00 00       	call   8024c1 <_panic>
+
+00801148 <sys_ipc_recv>:
+{
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80114e:	6a 01                	push   $0x1
+  801150:	ff 75 08             	push   0x8(%ebp)
+  801153:	e8 ae ff ff ff       	call   801106 <sys_ipc_recv_pages>
+}
+  801158:	c9                   	leave
+  801159:	c3                   	ret
+
+0080115a <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80115a:	55                   	push   %ebp
+  80115b:	89 e5                	mov    %esp,%ebp
+  80115d:	57                   	push   %edi
+  80115e:	56                   	push   %esi
+  80115f:	53                   	push   %ebx
+  801160:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801163:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801166:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801169:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80116f:	77 04                	ja     801175 <sys_ipc_call+0x1b>
+  801171:	85 f6                	test   %esi,%esi
+  801173:	75 15                	jne    80118a <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801175:	8b 55 08             	mov    0x8(%ebp),%edx
+  801178:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801180:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801182:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801185:	5b                   	pop    %ebx
+  801186:	5e                   	pop    %esi
+  801187:	5f                   	pop    %edi
+  801188:	5d                   	pop    %ebp
+  801189:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80118a:	89 f8                	mov    %edi,%eax
+  80118c:	c1 e0 0c             	shl    $0xc,%eax
+  80118f:	50                   	push   %eax
+  801190:	53                   	push   %ebx
+  801191:	e8 5a fa ff ff       	call   800bf0 <touch_mem>
+  801196:	83 c4 08             	add    $0x8,%esp
+  801199:	eb da                	jmp    801175 <sys_ipc_call+0x1b>
+
+0080119b <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80119b:	55                   	push   %ebp
+  80119c:	89 e5                	mov    %esp,%ebp
+  80119e:	57                   	push   %edi
+  80119f:	56                   	push   %esi
+  8011a0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011af:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011b2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011b5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8011b7:	5b                   	pop    %ebx
+  8011b8:	5e                   	pop    %esi
+  8011b9:	5f                   	pop    %edi
+  8011ba:	5d                   	pop    %ebp
+  8011bb:	c3                   	ret
+
+008011bc <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	57                   	push   %edi
+  8011c0:	56                   	push   %esi
+  8011c1:	53                   	push   %ebx
+  8011c2:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8011c5:	6a 04                	push   $0x4
+  8011c7:	ff 75 08             	push   0x8(%ebp)
+  8011ca:	e8 21 fa ff ff       	call   800bf0 <touch_mem>
+	asm volatile("int %1\n"
+  8011cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d7:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e2:	89 f7                	mov    %esi,%edi
+  8011e4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011e6:	83 c4 08             	add    $0x8,%esp
+  8011e9:	85 c0                	test   %eax,%eax
+  8011eb:	7f 08                	jg     8011f5 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8011ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f0:	5b                   	pop    %ebx
+  8011f1:	5e                   	pop    %esi
+  8011f2:	5f                   	pop    %edi
+  8011f3:	5d                   	pop    %ebp
+  8011f4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f5:	83 ec 0c             	sub    $0xc,%esp
+  8011f8:	50                   	push   %eax
+  8011f9:	6a 16                	push   $0x16
+  8011fb:	68 4b 2d 80 00       	push   $0x802d4b
+  801200:	6a 23                	push   $0x23
+  801202:	68 68 2d 80 00       	push   $0x802d68
+  801207:	e8 b5 12 00 00       	call   8024c1 <_panic>
+
+0080120c <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80120c:	55                   	push   %ebp
+  80120d:	89 e5                	mov    %esp,%ebp
+  80120f:	57                   	push   %edi
+  801210:	56                   	push   %esi
+  801211:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801212:	6a 04                	push   $0x4
+  801214:	ff 75 08             	push   0x8(%ebp)
+  801217:	e8 d4 f9 ff ff       	call   800bf0 <touch_mem>
+	asm volatile("int %1\n"
+  80121c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801221:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801224:	b8 17 00 00 00       	mov    $0x17,%eax
+  801229:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122c:	89 df                	mov    %ebx,%edi
+  80122e:	89 de                	mov    %ebx,%esi
+  801230:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801232:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801235:	5b                   	pop    %ebx
+  801236:	5e                   	pop    %esi
+  801237:	5f                   	pop    %edi
+  801238:	5d                   	pop    %ebp
+  801239:	c3                   	ret
+
+0080123a <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80123a:	55                   	push   %ebp
+  80123b:	89 e5                	mov    %esp,%ebp
+  80123d:	57                   	push   %edi
+  80123e:	56                   	push   %esi
+  80123f:	53                   	push   %ebx
+  801240:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801243:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801248:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801250:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801255:	89 df                	mov    %ebx,%edi
+  801257:	89 de                	mov    %ebx,%esi
+  801259:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80125b:	85 c0                	test   %eax,%eax
+  80125d:	7f 08                	jg     801267 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80125f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801262:	5b                   	pop    %ebx
+  801263:	5e                   	pop    %esi
+  801264:	5f                   	pop    %edi
+  801265:	5d                   	pop    %ebp
+  801266:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801267:	83 ec 0c             	sub    $0xc,%esp
+  80126a:	50                   	push   %eax
+  80126b:	6a 0e                	push   $0xe
+  80126d:	68 4b 2d 80 00       	push   $0x802d4b
+  801272:	6a 23                	push   $0x23
+  801274:	68 68 2d 80 00       	push   $0x802d68
+  801279:	e8 43 12 00 00       	call   8024c1 <_panic>
+
+0080127e <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  80127e:	55                   	push   %ebp
+  80127f:	89 e5                	mov    %esp,%ebp
+  801281:	8b 55 08             	mov    0x8(%ebp),%edx
+  801284:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801287:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  80128a:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  80128c:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  80128f:	83 3a 01             	cmpl   $0x1,(%edx)
+  801292:	7e 09                	jle    80129d <argstart+0x1f>
+  801294:	ba d1 29 80 00       	mov    $0x8029d1,%edx
+  801299:	85 c9                	test   %ecx,%ecx
+  80129b:	75 05                	jne    8012a2 <argstart+0x24>
+  80129d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a2:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  8012a5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  8012ac:	5d                   	pop    %ebp
+  8012ad:	c3                   	ret
+
+008012ae <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  8012ae:	55                   	push   %ebp
+  8012af:	89 e5                	mov    %esp,%ebp
+  8012b1:	53                   	push   %ebx
+  8012b2:	83 ec 04             	sub    $0x4,%esp
+  8012b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  8012b8:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  8012bf:	8b 43 08             	mov    0x8(%ebx),%eax
+  8012c2:	85 c0                	test   %eax,%eax
+  8012c4:	74 74                	je     80133a <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  8012c6:	80 38 00             	cmpb   $0x0,(%eax)
+  8012c9:	75 48                	jne    801313 <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  8012cb:	8b 0b                	mov    (%ebx),%ecx
+  8012cd:	83 39 01             	cmpl   $0x1,(%ecx)
+  8012d0:	74 5a                	je     80132c <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  8012d2:	8b 53 04             	mov    0x4(%ebx),%edx
+  8012d5:	8b 42 04             	mov    0x4(%edx),%eax
+  8012d8:	80 38 2d             	cmpb   $0x2d,(%eax)
+  8012db:	75 4f                	jne    80132c <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  8012dd:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  8012e1:	74 49                	je     80132c <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  8012e3:	83 c0 01             	add    $0x1,%eax
+  8012e6:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8012e9:	83 ec 04             	sub    $0x4,%esp
+  8012ec:	8b 01                	mov    (%ecx),%eax
+  8012ee:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  8012f5:	50                   	push   %eax
+  8012f6:	8d 42 08             	lea    0x8(%edx),%eax
+  8012f9:	50                   	push   %eax
+  8012fa:	83 c2 04             	add    $0x4,%edx
+  8012fd:	52                   	push   %edx
+  8012fe:	e8 73 f6 ff ff       	call   800976 <memmove>
+		(*args->argc)--;
+  801303:	8b 03                	mov    (%ebx),%eax
+  801305:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801308:	8b 43 08             	mov    0x8(%ebx),%eax
+  80130b:	83 c4 10             	add    $0x10,%esp
+  80130e:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801311:	74 13                	je     801326 <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  801313:	8b 43 08             	mov    0x8(%ebx),%eax
+  801316:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  801319:	83 c0 01             	add    $0x1,%eax
+  80131c:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  80131f:	89 d0                	mov    %edx,%eax
+  801321:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801324:	c9                   	leave
+  801325:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801326:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  80132a:	75 e7                	jne    801313 <argnext+0x65>
+	args->curarg = 0;
+  80132c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  801333:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801338:	eb e5                	jmp    80131f <argnext+0x71>
+		return -1;
+  80133a:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80133f:	eb de                	jmp    80131f <argnext+0x71>
+
+00801341 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  801341:	55                   	push   %ebp
+  801342:	89 e5                	mov    %esp,%ebp
+  801344:	53                   	push   %ebx
+  801345:	83 ec 04             	sub    $0x4,%esp
+  801348:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  80134b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80134e:	85 c0                	test   %eax,%eax
+  801350:	74 12                	je     801364 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  801352:	80 38 00             	cmpb   $0x0,(%eax)
+  801355:	74 12                	je     801369 <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  801357:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  80135a:	c7 43 08 d1 29 80 00 	movl   $0x8029d1,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  801361:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  801364:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801367:	c9                   	leave
+  801368:	c3                   	ret
+	} else if (*args->argc > 1) {
+  801369:	8b 13                	mov    (%ebx),%edx
+  80136b:	83 3a 01             	cmpl   $0x1,(%edx)
+  80136e:	7f 10                	jg     801380 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  801370:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  801377:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  80137e:	eb e1                	jmp    801361 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  801380:	8b 43 04             	mov    0x4(%ebx),%eax
+  801383:	8b 48 04             	mov    0x4(%eax),%ecx
+  801386:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801389:	83 ec 04             	sub    $0x4,%esp
+  80138c:	8b 12                	mov    (%edx),%edx
+  80138e:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  801395:	52                   	push   %edx
+  801396:	8d 50 08             	lea    0x8(%eax),%edx
+  801399:	52                   	push   %edx
+  80139a:	83 c0 04             	add    $0x4,%eax
+  80139d:	50                   	push   %eax
+  80139e:	e8 d3 f5 ff ff       	call   800976 <memmove>
+		(*args->argc)--;
+  8013a3:	8b 03                	mov    (%ebx),%eax
+  8013a5:	83 28 01             	subl   $0x1,(%eax)
+  8013a8:	83 c4 10             	add    $0x10,%esp
+  8013ab:	eb b4                	jmp    801361 <argnextvalue+0x20>
+
+008013ad <argvalue>:
+{
+  8013ad:	55                   	push   %ebp
+  8013ae:	89 e5                	mov    %esp,%ebp
+  8013b0:	83 ec 08             	sub    $0x8,%esp
+  8013b3:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8013b6:	8b 42 0c             	mov    0xc(%edx),%eax
+  8013b9:	85 c0                	test   %eax,%eax
+  8013bb:	74 02                	je     8013bf <argvalue+0x12>
+}
+  8013bd:	c9                   	leave
+  8013be:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8013bf:	83 ec 0c             	sub    $0xc,%esp
+  8013c2:	52                   	push   %edx
+  8013c3:	e8 79 ff ff ff       	call   801341 <argnextvalue>
+  8013c8:	83 c4 10             	add    $0x10,%esp
+  8013cb:	eb f0                	jmp    8013bd <argvalue+0x10>
+
+008013cd <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8013cd:	55                   	push   %ebp
+  8013ce:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013d3:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013d8:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013db:	5d                   	pop    %ebp
+  8013dc:	c3                   	ret
+
+008013dd <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013dd:	55                   	push   %ebp
+  8013de:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013e3:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8013e8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8013ed:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013f2:	5d                   	pop    %ebp
+  8013f3:	c3                   	ret
+
+008013f4 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013f4:	55                   	push   %ebp
+  8013f5:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8013f7:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8013fc:	a8 01                	test   $0x1,%al
+  8013fe:	74 3c                	je     80143c <fd_alloc+0x48>
+  801400:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801405:	89 c2                	mov    %eax,%edx
+  801407:	c1 ea 0c             	shr    $0xc,%edx
+  80140a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801411:	89 c1                	mov    %eax,%ecx
+  801413:	05 00 10 00 00       	add    $0x1000,%eax
+  801418:	f6 c2 01             	test   $0x1,%dl
+  80141b:	74 13                	je     801430 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80141d:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801422:	75 e1                	jne    801405 <fd_alloc+0x11>
+  801424:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801429:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80142e:	eb 05                	jmp    801435 <fd_alloc+0x41>
+			return 0;
+  801430:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801435:	8b 55 08             	mov    0x8(%ebp),%edx
+  801438:	89 0a                	mov    %ecx,(%edx)
+}
+  80143a:	5d                   	pop    %ebp
+  80143b:	c3                   	ret
+  80143c:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801441:	b8 00 00 00 00       	mov    $0x0,%eax
+  801446:	eb ed                	jmp    801435 <fd_alloc+0x41>
+
+00801448 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801448:	55                   	push   %ebp
+  801449:	89 e5                	mov    %esp,%ebp
+  80144b:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80144e:	83 f8 1f             	cmp    $0x1f,%eax
+  801451:	77 30                	ja     801483 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801453:	c1 e0 0c             	shl    $0xc,%eax
+  801456:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80145b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801461:	f6 c2 01             	test   $0x1,%dl
+  801464:	74 24                	je     80148a <fd_lookup+0x42>
+  801466:	89 c2                	mov    %eax,%edx
+  801468:	c1 ea 0c             	shr    $0xc,%edx
+  80146b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801472:	f6 c2 01             	test   $0x1,%dl
+  801475:	74 1a                	je     801491 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801477:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80147a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80147c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801481:	5d                   	pop    %ebp
+  801482:	c3                   	ret
+		return -E_INVAL;
+  801483:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801488:	eb f7                	jmp    801481 <fd_lookup+0x39>
+		return -E_INVAL;
+  80148a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80148f:	eb f0                	jmp    801481 <fd_lookup+0x39>
+  801491:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801496:	eb e9                	jmp    801481 <fd_lookup+0x39>
+
+00801498 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801498:	55                   	push   %ebp
+  801499:	89 e5                	mov    %esp,%ebp
+  80149b:	53                   	push   %ebx
+  80149c:	83 ec 04             	sub    $0x4,%esp
+  80149f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8014a2:	b8 f4 2d 80 00       	mov    $0x802df4,%eax
+  8014a7:	8b 18                	mov    (%eax),%ebx
+  8014a9:	85 db                	test   %ebx,%ebx
+  8014ab:	74 0e                	je     8014bb <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  8014ad:	83 c0 04             	add    $0x4,%eax
+  8014b0:	39 13                	cmp    %edx,(%ebx)
+  8014b2:	75 f3                	jne    8014a7 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  8014b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b9:	eb 1f                	jmp    8014da <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8014bb:	a1 08 40 80 00       	mov    0x804008,%eax
+  8014c0:	8b 40 48             	mov    0x48(%eax),%eax
+  8014c3:	83 ec 04             	sub    $0x4,%esp
+  8014c6:	52                   	push   %edx
+  8014c7:	50                   	push   %eax
+  8014c8:	68 78 2d 80 00       	push   $0x802d78
+  8014cd:	e8 37 ed ff ff       	call   800209 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8014d2:	83 c4 10             	add    $0x10,%esp
+  8014d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8014da:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014dd:	89 1a                	mov    %ebx,(%edx)
+}
+  8014df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014e2:	c9                   	leave
+  8014e3:	c3                   	ret
+
+008014e4 <fd_close>:
+{
+  8014e4:	55                   	push   %ebp
+  8014e5:	89 e5                	mov    %esp,%ebp
+  8014e7:	57                   	push   %edi
+  8014e8:	56                   	push   %esi
+  8014e9:	53                   	push   %ebx
+  8014ea:	83 ec 24             	sub    $0x24,%esp
+  8014ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014f0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014f3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014f6:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014f7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014fd:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801500:	50                   	push   %eax
+  801501:	e8 42 ff ff ff       	call   801448 <fd_lookup>
+  801506:	89 c3                	mov    %eax,%ebx
+  801508:	83 c4 10             	add    $0x10,%esp
+  80150b:	85 c0                	test   %eax,%eax
+  80150d:	78 05                	js     801514 <fd_close+0x30>
+	    || fd != fd2)
+  80150f:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801512:	74 16                	je     80152a <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801514:	89 f8                	mov    %edi,%eax
+  801516:	84 c0                	test   %al,%al
+  801518:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151d:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801520:	89 d8                	mov    %ebx,%eax
+  801522:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801525:	5b                   	pop    %ebx
+  801526:	5e                   	pop    %esi
+  801527:	5f                   	pop    %edi
+  801528:	5d                   	pop    %ebp
+  801529:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80152a:	83 ec 08             	sub    $0x8,%esp
+  80152d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801530:	50                   	push   %eax
+  801531:	ff 36                	push   (%esi)
+  801533:	e8 60 ff ff ff       	call   801498 <dev_lookup>
+  801538:	89 c3                	mov    %eax,%ebx
+  80153a:	83 c4 10             	add    $0x10,%esp
+  80153d:	85 c0                	test   %eax,%eax
+  80153f:	78 1a                	js     80155b <fd_close+0x77>
+		if (dev->dev_close)
+  801541:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801544:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801547:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80154c:	85 c0                	test   %eax,%eax
+  80154e:	74 0b                	je     80155b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801550:	83 ec 0c             	sub    $0xc,%esp
+  801553:	56                   	push   %esi
+  801554:	ff d0                	call   *%eax
+  801556:	89 c3                	mov    %eax,%ebx
+  801558:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80155b:	83 ec 08             	sub    $0x8,%esp
+  80155e:	56                   	push   %esi
+  80155f:	6a 00                	push   $0x0
+  801561:	e8 02 f8 ff ff       	call   800d68 <sys_page_unmap>
+	return r;
+  801566:	83 c4 10             	add    $0x10,%esp
+  801569:	eb b5                	jmp    801520 <fd_close+0x3c>
+
+0080156b <close>:
+
+int
+close(int fdnum)
+{
+  80156b:	55                   	push   %ebp
+  80156c:	89 e5                	mov    %esp,%ebp
+  80156e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801571:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801574:	50                   	push   %eax
+  801575:	ff 75 08             	push   0x8(%ebp)
+  801578:	e8 cb fe ff ff       	call   801448 <fd_lookup>
+  80157d:	83 c4 10             	add    $0x10,%esp
+  801580:	85 c0                	test   %eax,%eax
+  801582:	79 02                	jns    801586 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801584:	c9                   	leave
+  801585:	c3                   	ret
+		return fd_close(fd, 1);
+  801586:	83 ec 08             	sub    $0x8,%esp
+  801589:	6a 01                	push   $0x1
+  80158b:	ff 75 f4             	push   -0xc(%ebp)
+  80158e:	e8 51 ff ff ff       	call   8014e4 <fd_close>
+  801593:	83 c4 10             	add    $0x10,%esp
+  801596:	eb ec                	jmp    801584 <close+0x19>
+
+00801598 <close_all>:
+
+void
+close_all(void)
+{
+  801598:	55                   	push   %ebp
+  801599:	89 e5                	mov    %esp,%ebp
+  80159b:	53                   	push   %ebx
+  80159c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80159f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8015a4:	83 ec 0c             	sub    $0xc,%esp
+  8015a7:	53                   	push   %ebx
+  8015a8:	e8 be ff ff ff       	call   80156b <close>
+	for (i = 0; i < MAXFD; i++)
+  8015ad:	83 c3 01             	add    $0x1,%ebx
+  8015b0:	83 c4 10             	add    $0x10,%esp
+  8015b3:	83 fb 20             	cmp    $0x20,%ebx
+  8015b6:	75 ec                	jne    8015a4 <close_all+0xc>
+}
+  8015b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015bb:	c9                   	leave
+  8015bc:	c3                   	ret
+
+008015bd <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8015bd:	55                   	push   %ebp
+  8015be:	89 e5                	mov    %esp,%ebp
+  8015c0:	57                   	push   %edi
+  8015c1:	56                   	push   %esi
+  8015c2:	53                   	push   %ebx
+  8015c3:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8015c6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015c9:	50                   	push   %eax
+  8015ca:	ff 75 08             	push   0x8(%ebp)
+  8015cd:	e8 76 fe ff ff       	call   801448 <fd_lookup>
+  8015d2:	89 c3                	mov    %eax,%ebx
+  8015d4:	83 c4 10             	add    $0x10,%esp
+  8015d7:	85 c0                	test   %eax,%eax
+  8015d9:	78 7f                	js     80165a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8015db:	83 ec 0c             	sub    $0xc,%esp
+  8015de:	ff 75 0c             	push   0xc(%ebp)
+  8015e1:	e8 85 ff ff ff       	call   80156b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8015e6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8015e9:	c1 e6 0c             	shl    $0xc,%esi
+  8015ec:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8015f2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015f5:	89 3c 24             	mov    %edi,(%esp)
+  8015f8:	e8 e0 fd ff ff       	call   8013dd <fd2data>
+  8015fd:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8015ff:	89 34 24             	mov    %esi,(%esp)
+  801602:	e8 d6 fd ff ff       	call   8013dd <fd2data>
+  801607:	83 c4 10             	add    $0x10,%esp
+  80160a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80160d:	89 d8                	mov    %ebx,%eax
+  80160f:	c1 e8 16             	shr    $0x16,%eax
+  801612:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801619:	a8 01                	test   $0x1,%al
+  80161b:	74 11                	je     80162e <dup+0x71>
+  80161d:	89 d8                	mov    %ebx,%eax
+  80161f:	c1 e8 0c             	shr    $0xc,%eax
+  801622:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801629:	f6 c2 01             	test   $0x1,%dl
+  80162c:	75 36                	jne    801664 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80162e:	89 f8                	mov    %edi,%eax
+  801630:	c1 e8 0c             	shr    $0xc,%eax
+  801633:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80163a:	83 ec 0c             	sub    $0xc,%esp
+  80163d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801642:	50                   	push   %eax
+  801643:	56                   	push   %esi
+  801644:	6a 00                	push   $0x0
+  801646:	57                   	push   %edi
+  801647:	6a 00                	push   $0x0
+  801649:	e8 d8 f6 ff ff       	call   800d26 <sys_page_map>
+  80164e:	89 c3                	mov    %eax,%ebx
+  801650:	83 c4 20             	add    $0x20,%esp
+  801653:	85 c0                	test   %eax,%eax
+  801655:	78 33                	js     80168a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801657:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80165a:	89 d8                	mov    %ebx,%eax
+  80165c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80165f:	5b                   	pop    %ebx
+  801660:	5e                   	pop    %esi
+  801661:	5f                   	pop    %edi
+  801662:	5d                   	pop    %ebp
+  801663:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801664:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80166b:	83 ec 0c             	sub    $0xc,%esp
+  80166e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801673:	50                   	push   %eax
+  801674:	ff 75 d4             	push   -0x2c(%ebp)
+  801677:	6a 00                	push   $0x0
+  801679:	53                   	push   %ebx
+  80167a:	6a 00                	push   $0x0
+  80167c:	e8 a5 f6 ff ff       	call   800d26 <sys_page_map>
+  801681:	89 c3                	mov    %eax,%ebx
+  801683:	83 c4 20             	add    $0x20,%esp
+  801686:	85 c0                	test   %eax,%eax
+  801688:	79 a4                	jns    80162e <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80168a:	83 ec 08             	sub    $0x8,%esp
+  80168d:	56                   	push   %esi
+  80168e:	6a 00                	push   $0x0
+  801690:	e8 d3 f6 ff ff       	call   800d68 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801695:	83 c4 08             	add    $0x8,%esp
+  801698:	ff 75 d4             	push   -0x2c(%ebp)
+  80169b:	6a 00                	push   $0x0
+  80169d:	e8 c6 f6 ff ff       	call   800d68 <sys_page_unmap>
+	return r;
+  8016a2:	83 c4 10             	add    $0x10,%esp
+  8016a5:	eb b3                	jmp    80165a <dup+0x9d>
+
+008016a7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016a7:	55                   	push   %ebp
+  8016a8:	89 e5                	mov    %esp,%ebp
+  8016aa:	56                   	push   %esi
+  8016ab:	53                   	push   %ebx
+  8016ac:	83 ec 18             	sub    $0x18,%esp
+  8016af:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016b2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016b5:	50                   	push   %eax
+  8016b6:	56                   	push   %esi
+  8016b7:	e8 8c fd ff ff       	call   801448 <fd_lookup>
+  8016bc:	83 c4 10             	add    $0x10,%esp
+  8016bf:	85 c0                	test   %eax,%eax
+  8016c1:	78 3c                	js     8016ff <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016c3:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8016c6:	83 ec 08             	sub    $0x8,%esp
+  8016c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016cc:	50                   	push   %eax
+  8016cd:	ff 33                	push   (%ebx)
+  8016cf:	e8 c4 fd ff ff       	call   801498 <dev_lookup>
+  8016d4:	83 c4 10             	add    $0x10,%esp
+  8016d7:	85 c0                	test   %eax,%eax
+  8016d9:	78 24                	js     8016ff <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016db:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016de:	83 e0 03             	and    $0x3,%eax
+  8016e1:	83 f8 01             	cmp    $0x1,%eax
+  8016e4:	74 20                	je     801706 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8016e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e9:	8b 40 08             	mov    0x8(%eax),%eax
+  8016ec:	85 c0                	test   %eax,%eax
+  8016ee:	74 37                	je     801727 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8016f0:	83 ec 04             	sub    $0x4,%esp
+  8016f3:	ff 75 10             	push   0x10(%ebp)
+  8016f6:	ff 75 0c             	push   0xc(%ebp)
+  8016f9:	53                   	push   %ebx
+  8016fa:	ff d0                	call   *%eax
+  8016fc:	83 c4 10             	add    $0x10,%esp
+}
+  8016ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801702:	5b                   	pop    %ebx
+  801703:	5e                   	pop    %esi
+  801704:	5d                   	pop    %ebp
+  801705:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801706:	a1 08 40 80 00       	mov    0x804008,%eax
+  80170b:	8b 40 48             	mov    0x48(%eax),%eax
+  80170e:	83 ec 04             	sub    $0x4,%esp
+  801711:	56                   	push   %esi
+  801712:	50                   	push   %eax
+  801713:	68 b9 2d 80 00       	push   $0x802db9
+  801718:	e8 ec ea ff ff       	call   800209 <cprintf>
+		return -E_INVAL;
+  80171d:	83 c4 10             	add    $0x10,%esp
+  801720:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801725:	eb d8                	jmp    8016ff <read+0x58>
+		return -E_NOT_SUPP;
+  801727:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80172c:	eb d1                	jmp    8016ff <read+0x58>
+
+0080172e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80172e:	55                   	push   %ebp
+  80172f:	89 e5                	mov    %esp,%ebp
+  801731:	57                   	push   %edi
+  801732:	56                   	push   %esi
+  801733:	53                   	push   %ebx
+  801734:	83 ec 0c             	sub    $0xc,%esp
+  801737:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80173a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80173d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801742:	eb 02                	jmp    801746 <readn+0x18>
+  801744:	01 c3                	add    %eax,%ebx
+  801746:	39 f3                	cmp    %esi,%ebx
+  801748:	73 21                	jae    80176b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80174a:	83 ec 04             	sub    $0x4,%esp
+  80174d:	89 f0                	mov    %esi,%eax
+  80174f:	29 d8                	sub    %ebx,%eax
+  801751:	50                   	push   %eax
+  801752:	89 d8                	mov    %ebx,%eax
+  801754:	03 45 0c             	add    0xc(%ebp),%eax
+  801757:	50                   	push   %eax
+  801758:	57                   	push   %edi
+  801759:	e8 49 ff ff ff       	call   8016a7 <read>
+		if (m < 0)
+  80175e:	83 c4 10             	add    $0x10,%esp
+  801761:	85 c0                	test   %eax,%eax
+  801763:	78 04                	js     801769 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801765:	75 dd                	jne    801744 <readn+0x16>
+  801767:	eb 02                	jmp    80176b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801769:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80176b:	89 d8                	mov    %ebx,%eax
+  80176d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801770:	5b                   	pop    %ebx
+  801771:	5e                   	pop    %esi
+  801772:	5f                   	pop    %edi
+  801773:	5d                   	pop    %ebp
+  801774:	c3                   	ret
+
+00801775 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801775:	55                   	push   %ebp
+  801776:	89 e5                	mov    %esp,%ebp
+  801778:	56                   	push   %esi
+  801779:	53                   	push   %ebx
+  80177a:	83 ec 18             	sub    $0x18,%esp
+  80177d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801780:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801783:	50                   	push   %eax
+  801784:	53                   	push   %ebx
+  801785:	e8 be fc ff ff       	call   801448 <fd_lookup>
+  80178a:	83 c4 10             	add    $0x10,%esp
+  80178d:	85 c0                	test   %eax,%eax
+  80178f:	78 37                	js     8017c8 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801791:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801794:	83 ec 08             	sub    $0x8,%esp
+  801797:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80179a:	50                   	push   %eax
+  80179b:	ff 36                	push   (%esi)
+  80179d:	e8 f6 fc ff ff       	call   801498 <dev_lookup>
+  8017a2:	83 c4 10             	add    $0x10,%esp
+  8017a5:	85 c0                	test   %eax,%eax
+  8017a7:	78 1f                	js     8017c8 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017a9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017ad:	74 20                	je     8017cf <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8017af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017b2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017b5:	85 c0                	test   %eax,%eax
+  8017b7:	74 37                	je     8017f0 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8017b9:	83 ec 04             	sub    $0x4,%esp
+  8017bc:	ff 75 10             	push   0x10(%ebp)
+  8017bf:	ff 75 0c             	push   0xc(%ebp)
+  8017c2:	56                   	push   %esi
+  8017c3:	ff d0                	call   *%eax
+  8017c5:	83 c4 10             	add    $0x10,%esp
+}
+  8017c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017cb:	5b                   	pop    %ebx
+  8017cc:	5e                   	pop    %esi
+  8017cd:	5d                   	pop    %ebp
+  8017ce:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017cf:	a1 08 40 80 00       	mov    0x804008,%eax
+  8017d4:	8b 40 48             	mov    0x48(%eax),%eax
+  8017d7:	83 ec 04             	sub    $0x4,%esp
+  8017da:	53                   	push   %ebx
+  8017db:	50                   	push   %eax
+  8017dc:	68 d5 2d 80 00       	push   $0x802dd5
+  8017e1:	e8 23 ea ff ff       	call   800209 <cprintf>
+		return -E_INVAL;
+  8017e6:	83 c4 10             	add    $0x10,%esp
+  8017e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ee:	eb d8                	jmp    8017c8 <write+0x53>
+		return -E_NOT_SUPP;
+  8017f0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017f5:	eb d1                	jmp    8017c8 <write+0x53>
+
+008017f7 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017f7:	55                   	push   %ebp
+  8017f8:	89 e5                	mov    %esp,%ebp
+  8017fa:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801800:	50                   	push   %eax
+  801801:	ff 75 08             	push   0x8(%ebp)
+  801804:	e8 3f fc ff ff       	call   801448 <fd_lookup>
+  801809:	83 c4 10             	add    $0x10,%esp
+  80180c:	85 c0                	test   %eax,%eax
+  80180e:	78 0e                	js     80181e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801810:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801813:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801816:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801819:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80181e:	c9                   	leave
+  80181f:	c3                   	ret
+
+00801820 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801820:	55                   	push   %ebp
+  801821:	89 e5                	mov    %esp,%ebp
+  801823:	56                   	push   %esi
+  801824:	53                   	push   %ebx
+  801825:	83 ec 18             	sub    $0x18,%esp
+  801828:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80182b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80182e:	50                   	push   %eax
+  80182f:	53                   	push   %ebx
+  801830:	e8 13 fc ff ff       	call   801448 <fd_lookup>
+  801835:	83 c4 10             	add    $0x10,%esp
+  801838:	85 c0                	test   %eax,%eax
+  80183a:	78 34                	js     801870 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80183c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80183f:	83 ec 08             	sub    $0x8,%esp
+  801842:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801845:	50                   	push   %eax
+  801846:	ff 36                	push   (%esi)
+  801848:	e8 4b fc ff ff       	call   801498 <dev_lookup>
+  80184d:	83 c4 10             	add    $0x10,%esp
+  801850:	85 c0                	test   %eax,%eax
+  801852:	78 1c                	js     801870 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801854:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801858:	74 1d                	je     801877 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80185a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80185d:	8b 40 18             	mov    0x18(%eax),%eax
+  801860:	85 c0                	test   %eax,%eax
+  801862:	74 34                	je     801898 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801864:	83 ec 08             	sub    $0x8,%esp
+  801867:	ff 75 0c             	push   0xc(%ebp)
+  80186a:	56                   	push   %esi
+  80186b:	ff d0                	call   *%eax
+  80186d:	83 c4 10             	add    $0x10,%esp
+}
+  801870:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801873:	5b                   	pop    %ebx
+  801874:	5e                   	pop    %esi
+  801875:	5d                   	pop    %ebp
+  801876:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801877:	a1 08 40 80 00       	mov    0x804008,%eax
+  80187c:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80187f:	83 ec 04             	sub    $0x4,%esp
+  801882:	53                   	push   %ebx
+  801883:	50                   	push   %eax
+  801884:	68 98 2d 80 00       	push   $0x802d98
+  801889:	e8 7b e9 ff ff       	call   800209 <cprintf>
+		return -E_INVAL;
+  80188e:	83 c4 10             	add    $0x10,%esp
+  801891:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801896:	eb d8                	jmp    801870 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801898:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80189d:	eb d1                	jmp    801870 <ftruncate+0x50>
+
+0080189f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80189f:	55                   	push   %ebp
+  8018a0:	89 e5                	mov    %esp,%ebp
+  8018a2:	56                   	push   %esi
+  8018a3:	53                   	push   %ebx
+  8018a4:	83 ec 18             	sub    $0x18,%esp
+  8018a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018aa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018ad:	50                   	push   %eax
+  8018ae:	ff 75 08             	push   0x8(%ebp)
+  8018b1:	e8 92 fb ff ff       	call   801448 <fd_lookup>
+  8018b6:	83 c4 10             	add    $0x10,%esp
+  8018b9:	85 c0                	test   %eax,%eax
+  8018bb:	78 49                	js     801906 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018bd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018c0:	83 ec 08             	sub    $0x8,%esp
+  8018c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018c6:	50                   	push   %eax
+  8018c7:	ff 36                	push   (%esi)
+  8018c9:	e8 ca fb ff ff       	call   801498 <dev_lookup>
+  8018ce:	83 c4 10             	add    $0x10,%esp
+  8018d1:	85 c0                	test   %eax,%eax
+  8018d3:	78 31                	js     801906 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8018d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018d8:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018dc:	74 2f                	je     80190d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8018de:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8018e1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8018e8:	00 00 00 
+	stat->st_isdir = 0;
+  8018eb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018f2:	00 00 00 
+	stat->st_dev = dev;
+  8018f5:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8018fb:	83 ec 08             	sub    $0x8,%esp
+  8018fe:	53                   	push   %ebx
+  8018ff:	56                   	push   %esi
+  801900:	ff 50 14             	call   *0x14(%eax)
+  801903:	83 c4 10             	add    $0x10,%esp
+}
+  801906:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801909:	5b                   	pop    %ebx
+  80190a:	5e                   	pop    %esi
+  80190b:	5d                   	pop    %ebp
+  80190c:	c3                   	ret
+		return -E_NOT_SUPP;
+  80190d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801912:	eb f2                	jmp    801906 <fstat+0x67>
+
+00801914 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801914:	55                   	push   %ebp
+  801915:	89 e5                	mov    %esp,%ebp
+  801917:	56                   	push   %esi
+  801918:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801919:	83 ec 08             	sub    $0x8,%esp
+  80191c:	6a 00                	push   $0x0
+  80191e:	ff 75 08             	push   0x8(%ebp)
+  801921:	e8 bc 02 00 00       	call   801be2 <open>
+  801926:	89 c3                	mov    %eax,%ebx
+  801928:	83 c4 10             	add    $0x10,%esp
+  80192b:	85 c0                	test   %eax,%eax
+  80192d:	78 1b                	js     80194a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80192f:	83 ec 08             	sub    $0x8,%esp
+  801932:	ff 75 0c             	push   0xc(%ebp)
+  801935:	50                   	push   %eax
+  801936:	e8 64 ff ff ff       	call   80189f <fstat>
+  80193b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80193d:	89 1c 24             	mov    %ebx,(%esp)
+  801940:	e8 26 fc ff ff       	call   80156b <close>
+	return r;
+  801945:	83 c4 10             	add    $0x10,%esp
+  801948:	89 f3                	mov    %esi,%ebx
+}
+  80194a:	89 d8                	mov    %ebx,%eax
+  80194c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80194f:	5b                   	pop    %ebx
+  801950:	5e                   	pop    %esi
+  801951:	5d                   	pop    %ebp
+  801952:	c3                   	ret
+
+00801953 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801953:	55                   	push   %ebp
+  801954:	89 e5                	mov    %esp,%ebp
+  801956:	57                   	push   %edi
+  801957:	56                   	push   %esi
+  801958:	53                   	push   %ebx
+  801959:	83 ec 0c             	sub    $0xc,%esp
+  80195c:	89 c7                	mov    %eax,%edi
+  80195e:	89 d3                	mov    %edx,%ebx
+  801960:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801962:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  801969:	74 2d                	je     801998 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80196b:	6a 07                	push   $0x7
+  80196d:	68 00 50 80 00       	push   $0x805000
+  801972:	57                   	push   %edi
+  801973:	ff 35 00 40 80 00    	push   0x804000
+  801979:	e8 d7 0c 00 00       	call   802655 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  80197e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801985:	6a 00                	push   $0x0
+  801987:	56                   	push   %esi
+  801988:	53                   	push   %ebx
+  801989:	6a 00                	push   $0x0
+  80198b:	e8 77 0b 00 00       	call   802507 <ipc_recv_pages>
+}
+  801990:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801993:	5b                   	pop    %ebx
+  801994:	5e                   	pop    %esi
+  801995:	5f                   	pop    %edi
+  801996:	5d                   	pop    %ebp
+  801997:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801998:	83 ec 0c             	sub    $0xc,%esp
+  80199b:	6a 01                	push   $0x1
+  80199d:	e8 a8 0d 00 00       	call   80274a <ipc_find_env>
+  8019a2:	a3 00 40 80 00       	mov    %eax,0x804000
+  8019a7:	83 c4 10             	add    $0x10,%esp
+  8019aa:	eb bf                	jmp    80196b <fsipc_pages+0x18>
+
+008019ac <fsipc>:
+{
+  8019ac:	55                   	push   %ebp
+  8019ad:	89 e5                	mov    %esp,%ebp
+  8019af:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  8019b2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019b7:	e8 97 ff ff ff       	call   801953 <fsipc_pages>
+}
+  8019bc:	c9                   	leave
+  8019bd:	c3                   	ret
+
+008019be <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8019be:	55                   	push   %ebp
+  8019bf:	89 e5                	mov    %esp,%ebp
+  8019c1:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8019c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019c7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019ca:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  8019cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019d2:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8019d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019dc:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019e1:	e8 c6 ff ff ff       	call   8019ac <fsipc>
+}
+  8019e6:	c9                   	leave
+  8019e7:	c3                   	ret
+
+008019e8 <devfile_flush>:
+{
+  8019e8:	55                   	push   %ebp
+  8019e9:	89 e5                	mov    %esp,%ebp
+  8019eb:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019f1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019f4:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8019f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019fe:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a03:	e8 a4 ff ff ff       	call   8019ac <fsipc>
+}
+  801a08:	c9                   	leave
+  801a09:	c3                   	ret
+
+00801a0a <devfile_stat>:
+{
+  801a0a:	55                   	push   %ebp
+  801a0b:	89 e5                	mov    %esp,%ebp
+  801a0d:	53                   	push   %ebx
+  801a0e:	83 ec 04             	sub    $0x4,%esp
+  801a11:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a14:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a17:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a1a:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a24:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a29:	e8 7e ff ff ff       	call   8019ac <fsipc>
+  801a2e:	85 c0                	test   %eax,%eax
+  801a30:	78 2c                	js     801a5e <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a32:	83 ec 08             	sub    $0x8,%esp
+  801a35:	68 00 50 80 00       	push   $0x805000
+  801a3a:	53                   	push   %ebx
+  801a3b:	e8 b0 ed ff ff       	call   8007f0 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801a40:	a1 80 50 80 00       	mov    0x805080,%eax
+  801a45:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a4b:	a1 84 50 80 00       	mov    0x805084,%eax
+  801a50:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801a56:	83 c4 10             	add    $0x10,%esp
+  801a59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a61:	c9                   	leave
+  801a62:	c3                   	ret
+
+00801a63 <devfile_write>:
+{
+  801a63:	55                   	push   %ebp
+  801a64:	89 e5                	mov    %esp,%ebp
+  801a66:	83 ec 0c             	sub    $0xc,%esp
+  801a69:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801a6c:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a71:	39 d0                	cmp    %edx,%eax
+  801a73:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a76:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a79:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a7c:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  801a82:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801a87:	50                   	push   %eax
+  801a88:	ff 75 0c             	push   0xc(%ebp)
+  801a8b:	68 08 50 80 00       	push   $0x805008
+  801a90:	e8 e1 ee ff ff       	call   800976 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801a95:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a9a:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a9f:	e8 08 ff ff ff       	call   8019ac <fsipc>
+}
+  801aa4:	c9                   	leave
+  801aa5:	c3                   	ret
+
+00801aa6 <devfile_read>:
+{
+  801aa6:	55                   	push   %ebp
+  801aa7:	89 e5                	mov    %esp,%ebp
+  801aa9:	57                   	push   %edi
+  801aaa:	56                   	push   %esi
+  801aab:	53                   	push   %ebx
+  801aac:	83 ec 1c             	sub    $0x1c,%esp
+  801aaf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ab2:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801ab5:	89 fe                	mov    %edi,%esi
+  801ab7:	c1 ee 0c             	shr    $0xc,%esi
+  801aba:	b8 20 00 00 00       	mov    $0x20,%eax
+  801abf:	39 c6                	cmp    %eax,%esi
+  801ac1:	0f 47 f0             	cmova  %eax,%esi
+  801ac4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ac7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801acc:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801acf:	eb 14                	jmp    801ae5 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801ad1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801ad8:	05 00 10 00 00       	add    $0x1000,%eax
+  801add:	f6 c6 06             	test   $0x6,%dh
+  801ae0:	75 42                	jne    801b24 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801ae2:	83 c1 01             	add    $0x1,%ecx
+  801ae5:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801ae8:	39 f1                	cmp    %esi,%ecx
+  801aea:	0f 84 95 00 00 00    	je     801b85 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801af0:	89 c2                	mov    %eax,%edx
+  801af2:	c1 ea 16             	shr    $0x16,%edx
+  801af5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801afc:	f6 c2 01             	test   $0x1,%dl
+  801aff:	74 23                	je     801b24 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801b01:	89 c2                	mov    %eax,%edx
+  801b03:	c1 ea 0c             	shr    $0xc,%edx
+  801b06:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801b0d:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801b13:	74 0f                	je     801b24 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801b15:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801b1c:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801b22:	75 ad                	jne    801ad1 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801b24:	85 c9                	test   %ecx,%ecx
+  801b26:	74 11                	je     801b39 <devfile_read+0x93>
+  801b28:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801b2f:	75 08                	jne    801b39 <devfile_read+0x93>
+  801b31:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801b37:	74 50                	je     801b89 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b39:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b3c:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  801b41:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b47:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b4c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b51:	e8 56 fe ff ff       	call   8019ac <fsipc>
+  801b56:	89 c6                	mov    %eax,%esi
+  801b58:	85 c0                	test   %eax,%eax
+  801b5a:	78 1f                	js     801b7b <devfile_read+0xd5>
+	assert(r <= n);
+  801b5c:	39 c7                	cmp    %eax,%edi
+  801b5e:	72 50                	jb     801bb0 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801b60:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b65:	7f 62                	jg     801bc9 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801b67:	83 ec 04             	sub    $0x4,%esp
+  801b6a:	50                   	push   %eax
+  801b6b:	68 00 50 80 00       	push   $0x805000
+  801b70:	ff 75 0c             	push   0xc(%ebp)
+  801b73:	e8 fe ed ff ff       	call   800976 <memmove>
+	return r;
+  801b78:	83 c4 10             	add    $0x10,%esp
+}
+  801b7b:	89 f0                	mov    %esi,%eax
+  801b7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b80:	5b                   	pop    %ebx
+  801b81:	5e                   	pop    %esi
+  801b82:	5f                   	pop    %edi
+  801b83:	5d                   	pop    %ebp
+  801b84:	c3                   	ret
+  801b85:	89 f1                	mov    %esi,%ecx
+  801b87:	eb 9b                	jmp    801b24 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801b89:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b8c:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801b91:	89 c8                	mov    %ecx,%eax
+  801b93:	c1 e0 0c             	shl    $0xc,%eax
+  801b96:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801b9b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b9e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801ba3:	e8 ab fd ff ff       	call   801953 <fsipc_pages>
+  801ba8:	89 c6                	mov    %eax,%esi
+  801baa:	85 c0                	test   %eax,%eax
+  801bac:	78 8b                	js     801b39 <devfile_read+0x93>
+  801bae:	eb cb                	jmp    801b7b <devfile_read+0xd5>
+	assert(r <= n);
+  801bb0:	68 04 2e 80 00       	push   $0x802e04
+  801bb5:	68 0b 2e 80 00       	push   $0x802e0b
+  801bba:	68 a0 00 00 00       	push   $0xa0
+  801bbf:	68 20 2e 80 00       	push   $0x802e20
+  801bc4:	e8 f8 08 00 00       	call   8024c1 <_panic>
+	assert(r <= PGSIZE);
+  801bc9:	68 2b 2e 80 00       	push   $0x802e2b
+  801bce:	68 0b 2e 80 00       	push   $0x802e0b
+  801bd3:	68 a1 00 00 00       	push   $0xa1
+  801bd8:	68 20 2e 80 00       	push   $0x802e20
+  801bdd:	e8 df 08 00 00       	call   8024c1 <_panic>
+
+00801be2 <open>:
+{
+  801be2:	55                   	push   %ebp
+  801be3:	89 e5                	mov    %esp,%ebp
+  801be5:	56                   	push   %esi
+  801be6:	53                   	push   %ebx
+  801be7:	83 ec 1c             	sub    $0x1c,%esp
+  801bea:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801bed:	56                   	push   %esi
+  801bee:	e8 c2 eb ff ff       	call   8007b5 <strlen>
+  801bf3:	83 c4 10             	add    $0x10,%esp
+  801bf6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bfb:	7f 6c                	jg     801c69 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801bfd:	83 ec 0c             	sub    $0xc,%esp
+  801c00:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c03:	50                   	push   %eax
+  801c04:	e8 eb f7 ff ff       	call   8013f4 <fd_alloc>
+  801c09:	89 c3                	mov    %eax,%ebx
+  801c0b:	83 c4 10             	add    $0x10,%esp
+  801c0e:	85 c0                	test   %eax,%eax
+  801c10:	78 3c                	js     801c4e <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801c12:	83 ec 08             	sub    $0x8,%esp
+  801c15:	56                   	push   %esi
+  801c16:	68 00 50 80 00       	push   $0x805000
+  801c1b:	e8 d0 eb ff ff       	call   8007f0 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801c20:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c23:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801c28:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c2b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c30:	e8 77 fd ff ff       	call   8019ac <fsipc>
+  801c35:	89 c3                	mov    %eax,%ebx
+  801c37:	83 c4 10             	add    $0x10,%esp
+  801c3a:	85 c0                	test   %eax,%eax
+  801c3c:	78 19                	js     801c57 <open+0x75>
+	return fd2num(fd);
+  801c3e:	83 ec 0c             	sub    $0xc,%esp
+  801c41:	ff 75 f4             	push   -0xc(%ebp)
+  801c44:	e8 84 f7 ff ff       	call   8013cd <fd2num>
+  801c49:	89 c3                	mov    %eax,%ebx
+  801c4b:	83 c4 10             	add    $0x10,%esp
+}
+  801c4e:	89 d8                	mov    %ebx,%eax
+  801c50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c53:	5b                   	pop    %ebx
+  801c54:	5e                   	pop    %esi
+  801c55:	5d                   	pop    %ebp
+  801c56:	c3                   	ret
+		fd_close(fd, 0);
+  801c57:	83 ec 08             	sub    $0x8,%esp
+  801c5a:	6a 00                	push   $0x0
+  801c5c:	ff 75 f4             	push   -0xc(%ebp)
+  801c5f:	e8 80 f8 ff ff       	call   8014e4 <fd_close>
+		return r;
+  801c64:	83 c4 10             	add    $0x10,%esp
+  801c67:	eb e5                	jmp    801c4e <open+0x6c>
+		return -E_BAD_PATH;
+  801c69:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c6e:	eb de                	jmp    801c4e <open+0x6c>
+
+00801c70 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801c70:	55                   	push   %ebp
+  801c71:	89 e5                	mov    %esp,%ebp
+  801c73:	53                   	push   %ebx
+  801c74:	83 ec 10             	sub    $0x10,%esp
+  801c77:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801c7a:	53                   	push   %ebx
+  801c7b:	e8 35 eb ff ff       	call   8007b5 <strlen>
+  801c80:	83 c4 10             	add    $0x10,%esp
+  801c83:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c88:	7f 25                	jg     801caf <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801c8a:	83 ec 08             	sub    $0x8,%esp
+  801c8d:	53                   	push   %ebx
+  801c8e:	68 00 50 80 00       	push   $0x805000
+  801c93:	e8 58 eb ff ff       	call   8007f0 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801c98:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c9d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801ca2:	e8 05 fd ff ff       	call   8019ac <fsipc>
+  801ca7:	83 c4 10             	add    $0x10,%esp
+}
+  801caa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cad:	c9                   	leave
+  801cae:	c3                   	ret
+		return -E_BAD_PATH;
+  801caf:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801cb4:	eb f4                	jmp    801caa <remove+0x3a>
+
+00801cb6 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801cb6:	55                   	push   %ebp
+  801cb7:	89 e5                	mov    %esp,%ebp
+  801cb9:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801cbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc1:	b8 08 00 00 00       	mov    $0x8,%eax
+  801cc6:	e8 e1 fc ff ff       	call   8019ac <fsipc>
+}
+  801ccb:	c9                   	leave
+  801ccc:	c3                   	ret
+
+00801ccd <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801ccd:	55                   	push   %ebp
+  801cce:	89 e5                	mov    %esp,%ebp
+  801cd0:	53                   	push   %ebx
+  801cd1:	83 ec 04             	sub    $0x4,%esp
+  801cd4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801cd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cdc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801ce1:	e8 c6 fc ff ff       	call   8019ac <fsipc>
+  801ce6:	85 c0                	test   %eax,%eax
+  801ce8:	78 3c                	js     801d26 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801cea:	a1 00 50 80 00       	mov    0x805000,%eax
+  801cef:	89 03                	mov    %eax,(%ebx)
+  801cf1:	a1 04 50 80 00       	mov    0x805004,%eax
+  801cf6:	89 43 04             	mov    %eax,0x4(%ebx)
+  801cf9:	a1 08 50 80 00       	mov    0x805008,%eax
+  801cfe:	89 43 08             	mov    %eax,0x8(%ebx)
+  801d01:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801d06:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801d09:	a1 10 50 80 00       	mov    0x805010,%eax
+  801d0e:	89 43 10             	mov    %eax,0x10(%ebx)
+  801d11:	a1 14 50 80 00       	mov    0x805014,%eax
+  801d16:	89 43 14             	mov    %eax,0x14(%ebx)
+  801d19:	a1 18 50 80 00       	mov    0x805018,%eax
+  801d1e:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801d21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d29:	c9                   	leave
+  801d2a:	c3                   	ret
+
+00801d2b <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801d2b:	55                   	push   %ebp
+  801d2c:	89 e5                	mov    %esp,%ebp
+  801d2e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801d31:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d34:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  801d39:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d3e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801d43:	e8 64 fc ff ff       	call   8019ac <fsipc>
+}
+  801d48:	c9                   	leave
+  801d49:	c3                   	ret
+
+00801d4a <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  801d4a:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801d4e:	7f 01                	jg     801d51 <writebuf+0x7>
+  801d50:	c3                   	ret
+{
+  801d51:	55                   	push   %ebp
+  801d52:	89 e5                	mov    %esp,%ebp
+  801d54:	53                   	push   %ebx
+  801d55:	83 ec 08             	sub    $0x8,%esp
+  801d58:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  801d5a:	ff 70 04             	push   0x4(%eax)
+  801d5d:	8d 40 10             	lea    0x10(%eax),%eax
+  801d60:	50                   	push   %eax
+  801d61:	ff 33                	push   (%ebx)
+  801d63:	e8 0d fa ff ff       	call   801775 <write>
+		if (result > 0)
+  801d68:	83 c4 10             	add    $0x10,%esp
+  801d6b:	85 c0                	test   %eax,%eax
+  801d6d:	7e 03                	jle    801d72 <writebuf+0x28>
+			b->result += result;
+  801d6f:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  801d72:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801d75:	74 0d                	je     801d84 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  801d77:	85 c0                	test   %eax,%eax
+  801d79:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d7e:	0f 4f c2             	cmovg  %edx,%eax
+  801d81:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  801d84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d87:	c9                   	leave
+  801d88:	c3                   	ret
+
+00801d89 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801d89:	55                   	push   %ebp
+  801d8a:	89 e5                	mov    %esp,%ebp
+  801d8c:	53                   	push   %ebx
+  801d8d:	83 ec 04             	sub    $0x4,%esp
+  801d90:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801d93:	8b 53 04             	mov    0x4(%ebx),%edx
+  801d96:	8d 42 01             	lea    0x1(%edx),%eax
+  801d99:	89 43 04             	mov    %eax,0x4(%ebx)
+  801d9c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d9f:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801da3:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801da8:	74 05                	je     801daf <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801daa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dad:	c9                   	leave
+  801dae:	c3                   	ret
+		writebuf(b);
+  801daf:	89 d8                	mov    %ebx,%eax
+  801db1:	e8 94 ff ff ff       	call   801d4a <writebuf>
+		b->idx = 0;
+  801db6:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801dbd:	eb eb                	jmp    801daa <putch+0x21>
+
+00801dbf <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801dbf:	55                   	push   %ebp
+  801dc0:	89 e5                	mov    %esp,%ebp
+  801dc2:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801dc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dcb:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801dd1:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801dd8:	00 00 00 
+	b.result = 0;
+  801ddb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801de2:	00 00 00 
+	b.error = 1;
+  801de5:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801dec:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801def:	ff 75 10             	push   0x10(%ebp)
+  801df2:	ff 75 0c             	push   0xc(%ebp)
+  801df5:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801dfb:	50                   	push   %eax
+  801dfc:	68 89 1d 80 00       	push   $0x801d89
+  801e01:	e8 fa e4 ff ff       	call   800300 <vprintfmt>
+	if (b.idx > 0)
+  801e06:	83 c4 10             	add    $0x10,%esp
+  801e09:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801e10:	7f 12                	jg     801e24 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801e12:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801e18:	85 c0                	test   %eax,%eax
+  801e1a:	75 06                	jne    801e22 <vfprintf+0x63>
+  801e1c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  801e22:	c9                   	leave
+  801e23:	c3                   	ret
+		writebuf(&b);
+  801e24:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801e2a:	e8 1b ff ff ff       	call   801d4a <writebuf>
+  801e2f:	eb e1                	jmp    801e12 <vfprintf+0x53>
+
+00801e31 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  801e31:	55                   	push   %ebp
+  801e32:	89 e5                	mov    %esp,%ebp
+  801e34:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801e37:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  801e3a:	50                   	push   %eax
+  801e3b:	ff 75 0c             	push   0xc(%ebp)
+  801e3e:	ff 75 08             	push   0x8(%ebp)
+  801e41:	e8 79 ff ff ff       	call   801dbf <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801e46:	c9                   	leave
+  801e47:	c3                   	ret
+
+00801e48 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  801e48:	55                   	push   %ebp
+  801e49:	89 e5                	mov    %esp,%ebp
+  801e4b:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801e4e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  801e51:	50                   	push   %eax
+  801e52:	ff 75 08             	push   0x8(%ebp)
+  801e55:	6a 01                	push   $0x1
+  801e57:	e8 63 ff ff ff       	call   801dbf <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801e5c:	c9                   	leave
+  801e5d:	c3                   	ret
+
+00801e5e <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801e5e:	55                   	push   %ebp
+  801e5f:	89 e5                	mov    %esp,%ebp
+  801e61:	56                   	push   %esi
+  801e62:	53                   	push   %ebx
+  801e63:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801e66:	83 ec 0c             	sub    $0xc,%esp
+  801e69:	ff 75 08             	push   0x8(%ebp)
+  801e6c:	e8 6c f5 ff ff       	call   8013dd <fd2data>
+  801e71:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801e73:	83 c4 08             	add    $0x8,%esp
+  801e76:	68 37 2e 80 00       	push   $0x802e37
+  801e7b:	53                   	push   %ebx
+  801e7c:	e8 6f e9 ff ff       	call   8007f0 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801e81:	8b 46 04             	mov    0x4(%esi),%eax
+  801e84:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801e8a:	2b 0e                	sub    (%esi),%ecx
+  801e8c:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801e91:	89 c8                	mov    %ecx,%eax
+  801e93:	f7 e2                	mul    %edx
+  801e95:	c1 ea 0c             	shr    $0xc,%edx
+  801e98:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801e9e:	29 d1                	sub    %edx,%ecx
+  801ea0:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801ea6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ead:	00 00 00 
+	stat->st_dev = &devpipe;
+  801eb0:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  801eb7:	30 80 00 
+	return 0;
+}
+  801eba:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ebf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ec2:	5b                   	pop    %ebx
+  801ec3:	5e                   	pop    %esi
+  801ec4:	5d                   	pop    %ebp
+  801ec5:	c3                   	ret
+
+00801ec6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801ec6:	55                   	push   %ebp
+  801ec7:	89 e5                	mov    %esp,%ebp
+  801ec9:	53                   	push   %ebx
+  801eca:	83 ec 0c             	sub    $0xc,%esp
+  801ecd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801ed0:	53                   	push   %ebx
+  801ed1:	6a 00                	push   $0x0
+  801ed3:	e8 90 ee ff ff       	call   800d68 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801ed8:	89 1c 24             	mov    %ebx,(%esp)
+  801edb:	e8 fd f4 ff ff       	call   8013dd <fd2data>
+  801ee0:	83 c4 08             	add    $0x8,%esp
+  801ee3:	50                   	push   %eax
+  801ee4:	6a 00                	push   $0x0
+  801ee6:	e8 7d ee ff ff       	call   800d68 <sys_page_unmap>
+}
+  801eeb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eee:	c9                   	leave
+  801eef:	c3                   	ret
+
+00801ef0 <_pipeisclosed>:
+{
+  801ef0:	55                   	push   %ebp
+  801ef1:	89 e5                	mov    %esp,%ebp
+  801ef3:	57                   	push   %edi
+  801ef4:	56                   	push   %esi
+  801ef5:	53                   	push   %ebx
+  801ef6:	83 ec 1c             	sub    $0x1c,%esp
+  801ef9:	89 c7                	mov    %eax,%edi
+  801efb:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801efd:	a1 08 40 80 00       	mov    0x804008,%eax
+  801f02:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801f05:	83 ec 0c             	sub    $0xc,%esp
+  801f08:	57                   	push   %edi
+  801f09:	e8 7b 08 00 00       	call   802789 <pageref>
+  801f0e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f11:	89 34 24             	mov    %esi,(%esp)
+  801f14:	e8 70 08 00 00       	call   802789 <pageref>
+		nn = thisenv->env_runs;
+  801f19:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801f1f:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801f22:	83 c4 10             	add    $0x10,%esp
+  801f25:	39 cb                	cmp    %ecx,%ebx
+  801f27:	74 1b                	je     801f44 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801f29:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f2c:	75 cf                	jne    801efd <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801f2e:	8b 42 58             	mov    0x58(%edx),%eax
+  801f31:	6a 01                	push   $0x1
+  801f33:	50                   	push   %eax
+  801f34:	53                   	push   %ebx
+  801f35:	68 3e 2e 80 00       	push   $0x802e3e
+  801f3a:	e8 ca e2 ff ff       	call   800209 <cprintf>
+  801f3f:	83 c4 10             	add    $0x10,%esp
+  801f42:	eb b9                	jmp    801efd <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801f44:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f47:	0f 94 c0             	sete   %al
+  801f4a:	0f b6 c0             	movzbl %al,%eax
+}
+  801f4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f50:	5b                   	pop    %ebx
+  801f51:	5e                   	pop    %esi
+  801f52:	5f                   	pop    %edi
+  801f53:	5d                   	pop    %ebp
+  801f54:	c3                   	ret
+
+00801f55 <devpipe_read>:
+{
+  801f55:	55                   	push   %ebp
+  801f56:	89 e5                	mov    %esp,%ebp
+  801f58:	57                   	push   %edi
+  801f59:	56                   	push   %esi
+  801f5a:	53                   	push   %ebx
+  801f5b:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801f5e:	ff 75 08             	push   0x8(%ebp)
+  801f61:	e8 77 f4 ff ff       	call   8013dd <fd2data>
+  801f66:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801f68:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801f6b:	8d 40 04             	lea    0x4(%eax),%eax
+  801f6e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801f71:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801f74:	8b 0b                	mov    (%ebx),%ecx
+  801f76:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801f7c:	29 ce                	sub    %ecx,%esi
+  801f7e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f83:	f7 e6                	mul    %esi
+  801f85:	c1 ea 0c             	shr    $0xc,%edx
+  801f88:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801f8e:	29 c6                	sub    %eax,%esi
+  801f90:	89 f2                	mov    %esi,%edx
+  801f92:	75 43                	jne    801fd7 <devpipe_read+0x82>
+		ref = pageref(p);
+  801f94:	83 ec 0c             	sub    $0xc,%esp
+  801f97:	53                   	push   %ebx
+  801f98:	e8 ec 07 00 00       	call   802789 <pageref>
+  801f9d:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801f9f:	89 da                	mov    %ebx,%edx
+  801fa1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa4:	e8 47 ff ff ff       	call   801ef0 <_pipeisclosed>
+  801fa9:	83 c4 10             	add    $0x10,%esp
+  801fac:	85 c0                	test   %eax,%eax
+  801fae:	0f 85 c1 00 00 00    	jne    802075 <devpipe_read+0x120>
+	*sleeping = 1;
+  801fb4:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801fbb:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801fc0:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801fc3:	75 ac                	jne    801f71 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801fc5:	83 ec 04             	sub    $0x4,%esp
+  801fc8:	56                   	push   %esi
+  801fc9:	57                   	push   %edi
+  801fca:	ff 75 e4             	push   -0x1c(%ebp)
+  801fcd:	e8 ea f1 ff ff       	call   8011bc <sys_futex_wait>
+  801fd2:	83 c4 10             	add    $0x10,%esp
+  801fd5:	eb 9a                	jmp    801f71 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801fd7:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801fda:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801fde:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801fe0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801fe5:	f7 e1                	mul    %ecx
+  801fe7:	c1 ea 0b             	shr    $0xb,%edx
+  801fea:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801ff0:	29 c1                	sub    %eax,%ecx
+  801ff2:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801ff4:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801ff9:	29 cf                	sub    %ecx,%edi
+  801ffb:	39 f7                	cmp    %esi,%edi
+  801ffd:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  802000:	8d 43 10             	lea    0x10(%ebx),%eax
+  802003:	83 ec 04             	sub    $0x4,%esp
+  802006:	57                   	push   %edi
+  802007:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80200a:	01 c2                	add    %eax,%edx
+  80200c:	52                   	push   %edx
+  80200d:	ff 75 0c             	push   0xc(%ebp)
+  802010:	e8 61 e9 ff ff       	call   800976 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  802015:	83 c4 0c             	add    $0xc,%esp
+  802018:	89 f1                	mov    %esi,%ecx
+  80201a:	29 f9                	sub    %edi,%ecx
+  80201c:	51                   	push   %ecx
+  80201d:	ff 75 e4             	push   -0x1c(%ebp)
+  802020:	89 f8                	mov    %edi,%eax
+  802022:	03 45 0c             	add    0xc(%ebp),%eax
+  802025:	50                   	push   %eax
+  802026:	e8 4b e9 ff ff       	call   800976 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  80202b:	89 f1                	mov    %esi,%ecx
+  80202d:	03 0b                	add    (%ebx),%ecx
+  80202f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802034:	f7 e1                	mul    %ecx
+  802036:	c1 ea 0c             	shr    $0xc,%edx
+  802039:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80203f:	29 d1                	sub    %edx,%ecx
+  802041:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  802043:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802048:	83 c4 10             	add    $0x10,%esp
+  80204b:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  80204f:	75 0a                	jne    80205b <devpipe_read+0x106>
+	return n;
+  802051:	89 f0                	mov    %esi,%eax
+}
+  802053:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802056:	5b                   	pop    %ebx
+  802057:	5e                   	pop    %esi
+  802058:	5f                   	pop    %edi
+  802059:	5d                   	pop    %ebp
+  80205a:	c3                   	ret
+		*sleeping = 0;
+  80205b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  802062:	83 ec 08             	sub    $0x8,%esp
+  802065:	68 00 04 00 00       	push   $0x400
+  80206a:	53                   	push   %ebx
+  80206b:	e8 9c f1 ff ff       	call   80120c <sys_futex_wake>
+  802070:	83 c4 10             	add    $0x10,%esp
+  802073:	eb dc                	jmp    802051 <devpipe_read+0xfc>
+			return 0;
+  802075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80207a:	eb d7                	jmp    802053 <devpipe_read+0xfe>
+
+0080207c <devpipe_write>:
+{
+  80207c:	55                   	push   %ebp
+  80207d:	89 e5                	mov    %esp,%ebp
+  80207f:	57                   	push   %edi
+  802080:	56                   	push   %esi
+  802081:	53                   	push   %ebx
+  802082:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802085:	ff 75 08             	push   0x8(%ebp)
+  802088:	e8 50 f3 ff ff       	call   8013dd <fd2data>
+  80208d:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  80208f:	83 c4 10             	add    $0x10,%esp
+  802092:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802099:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80209c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80209f:	0f 83 23 01 00 00    	jae    8021c8 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8020a5:	8b 77 04             	mov    0x4(%edi),%esi
+  8020a8:	8b 1f                	mov    (%edi),%ebx
+  8020aa:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  8020b0:	29 d9                	sub    %ebx,%ecx
+  8020b2:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8020b7:	f7 e1                	mul    %ecx
+  8020b9:	c1 ea 0c             	shr    $0xc,%edx
+  8020bc:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8020c2:	29 c1                	sub    %eax,%ecx
+  8020c4:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8020c6:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8020cc:	75 40                	jne    80210e <devpipe_write+0x92>
+			ref = pageref(p);
+  8020ce:	83 ec 0c             	sub    $0xc,%esp
+  8020d1:	57                   	push   %edi
+  8020d2:	e8 b2 06 00 00       	call   802789 <pageref>
+  8020d7:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  8020d9:	89 fa                	mov    %edi,%edx
+  8020db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020de:	e8 0d fe ff ff       	call   801ef0 <_pipeisclosed>
+  8020e3:	83 c4 10             	add    $0x10,%esp
+  8020e6:	85 c0                	test   %eax,%eax
+  8020e8:	0f 85 d5 00 00 00    	jne    8021c3 <devpipe_write+0x147>
+	*sleeping = 1;
+  8020ee:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  8020f5:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8020fa:	39 1f                	cmp    %ebx,(%edi)
+  8020fc:	75 a7                	jne    8020a5 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  8020fe:	83 ec 04             	sub    $0x4,%esp
+  802101:	56                   	push   %esi
+  802102:	53                   	push   %ebx
+  802103:	57                   	push   %edi
+  802104:	e8 b3 f0 ff ff       	call   8011bc <sys_futex_wait>
+  802109:	83 c4 10             	add    $0x10,%esp
+  80210c:	eb 97                	jmp    8020a5 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80210e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802111:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802114:	29 c1                	sub    %eax,%ecx
+  802116:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80211b:	89 d8                	mov    %ebx,%eax
+  80211d:	29 d0                	sub    %edx,%eax
+  80211f:	39 c1                	cmp    %eax,%ecx
+  802121:	0f 46 c1             	cmovbe %ecx,%eax
+  802124:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  802126:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80212b:	f7 e6                	mul    %esi
+  80212d:	c1 ea 0b             	shr    $0xb,%edx
+  802130:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802136:	29 c6                	sub    %eax,%esi
+  802138:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80213a:	29 f3                	sub    %esi,%ebx
+  80213c:	39 cb                	cmp    %ecx,%ebx
+  80213e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802141:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  802144:	8d 77 10             	lea    0x10(%edi),%esi
+  802147:	83 ec 04             	sub    $0x4,%esp
+  80214a:	53                   	push   %ebx
+  80214b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80214e:	03 45 0c             	add    0xc(%ebp),%eax
+  802151:	50                   	push   %eax
+  802152:	01 f2                	add    %esi,%edx
+  802154:	52                   	push   %edx
+  802155:	e8 1c e8 ff ff       	call   800976 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80215a:	83 c4 0c             	add    $0xc,%esp
+  80215d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802160:	29 d8                	sub    %ebx,%eax
+  802162:	50                   	push   %eax
+  802163:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802166:	01 d3                	add    %edx,%ebx
+  802168:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80216b:	53                   	push   %ebx
+  80216c:	56                   	push   %esi
+  80216d:	e8 04 e8 ff ff       	call   800976 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802172:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802175:	03 4f 04             	add    0x4(%edi),%ecx
+  802178:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80217d:	f7 e1                	mul    %ecx
+  80217f:	c1 ea 0c             	shr    $0xc,%edx
+  802182:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802188:	29 d1                	sub    %edx,%ecx
+  80218a:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  80218d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802192:	83 c4 10             	add    $0x10,%esp
+  802195:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802199:	75 0b                	jne    8021a6 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  80219b:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  80219e:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8021a1:	e9 f3 fe ff ff       	jmp    802099 <devpipe_write+0x1d>
+		*sleeping = 0;
+  8021a6:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8021ad:	83 ec 08             	sub    $0x8,%esp
+  8021b0:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  8021b5:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  8021b8:	50                   	push   %eax
+  8021b9:	e8 4e f0 ff ff       	call   80120c <sys_futex_wake>
+  8021be:	83 c4 10             	add    $0x10,%esp
+  8021c1:	eb d8                	jmp    80219b <devpipe_write+0x11f>
+				return 0;
+  8021c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021cb:	5b                   	pop    %ebx
+  8021cc:	5e                   	pop    %esi
+  8021cd:	5f                   	pop    %edi
+  8021ce:	5d                   	pop    %ebp
+  8021cf:	c3                   	ret
+
+008021d0 <pipe>:
+{
+  8021d0:	55                   	push   %ebp
+  8021d1:	89 e5                	mov    %esp,%ebp
+  8021d3:	56                   	push   %esi
+  8021d4:	53                   	push   %ebx
+  8021d5:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8021d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021db:	50                   	push   %eax
+  8021dc:	e8 13 f2 ff ff       	call   8013f4 <fd_alloc>
+  8021e1:	89 c3                	mov    %eax,%ebx
+  8021e3:	83 c4 10             	add    $0x10,%esp
+  8021e6:	85 c0                	test   %eax,%eax
+  8021e8:	0f 88 23 01 00 00    	js     802311 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8021ee:	83 ec 04             	sub    $0x4,%esp
+  8021f1:	68 07 04 00 00       	push   $0x407
+  8021f6:	ff 75 f4             	push   -0xc(%ebp)
+  8021f9:	6a 00                	push   $0x0
+  8021fb:	e8 e3 ea ff ff       	call   800ce3 <sys_page_alloc>
+  802200:	89 c3                	mov    %eax,%ebx
+  802202:	83 c4 10             	add    $0x10,%esp
+  802205:	85 c0                	test   %eax,%eax
+  802207:	0f 88 04 01 00 00    	js     802311 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80220d:	83 ec 0c             	sub    $0xc,%esp
+  802210:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802213:	50                   	push   %eax
+  802214:	e8 db f1 ff ff       	call   8013f4 <fd_alloc>
+  802219:	89 c3                	mov    %eax,%ebx
+  80221b:	83 c4 10             	add    $0x10,%esp
+  80221e:	85 c0                	test   %eax,%eax
+  802220:	0f 88 db 00 00 00    	js     802301 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802226:	83 ec 04             	sub    $0x4,%esp
+  802229:	68 07 04 00 00       	push   $0x407
+  80222e:	ff 75 f0             	push   -0x10(%ebp)
+  802231:	6a 00                	push   $0x0
+  802233:	e8 ab ea ff ff       	call   800ce3 <sys_page_alloc>
+  802238:	89 c3                	mov    %eax,%ebx
+  80223a:	83 c4 10             	add    $0x10,%esp
+  80223d:	85 c0                	test   %eax,%eax
+  80223f:	0f 88 bc 00 00 00    	js     802301 <pipe+0x131>
+	va = fd2data(fd0);
+  802245:	83 ec 0c             	sub    $0xc,%esp
+  802248:	ff 75 f4             	push   -0xc(%ebp)
+  80224b:	e8 8d f1 ff ff       	call   8013dd <fd2data>
+  802250:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802252:	83 c4 0c             	add    $0xc,%esp
+  802255:	68 07 04 00 00       	push   $0x407
+  80225a:	50                   	push   %eax
+  80225b:	6a 00                	push   $0x0
+  80225d:	e8 81 ea ff ff       	call   800ce3 <sys_page_alloc>
+  802262:	89 c3                	mov    %eax,%ebx
+  802264:	83 c4 10             	add    $0x10,%esp
+  802267:	85 c0                	test   %eax,%eax
+  802269:	0f 88 82 00 00 00    	js     8022f1 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80226f:	83 ec 0c             	sub    $0xc,%esp
+  802272:	ff 75 f0             	push   -0x10(%ebp)
+  802275:	e8 63 f1 ff ff       	call   8013dd <fd2data>
+  80227a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802281:	50                   	push   %eax
+  802282:	6a 00                	push   $0x0
+  802284:	56                   	push   %esi
+  802285:	6a 00                	push   $0x0
+  802287:	e8 9a ea ff ff       	call   800d26 <sys_page_map>
+  80228c:	89 c3                	mov    %eax,%ebx
+  80228e:	83 c4 20             	add    $0x20,%esp
+  802291:	85 c0                	test   %eax,%eax
+  802293:	78 4e                	js     8022e3 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802295:	a1 20 30 80 00       	mov    0x803020,%eax
+  80229a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80229d:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80229f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022a2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8022a9:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8022ac:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8022ae:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8022b1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8022b8:	83 ec 0c             	sub    $0xc,%esp
+  8022bb:	ff 75 f4             	push   -0xc(%ebp)
+  8022be:	e8 0a f1 ff ff       	call   8013cd <fd2num>
+  8022c3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8022c6:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8022c8:	83 c4 04             	add    $0x4,%esp
+  8022cb:	ff 75 f0             	push   -0x10(%ebp)
+  8022ce:	e8 fa f0 ff ff       	call   8013cd <fd2num>
+  8022d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8022d6:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8022d9:	83 c4 10             	add    $0x10,%esp
+  8022dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022e1:	eb 2e                	jmp    802311 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8022e3:	83 ec 08             	sub    $0x8,%esp
+  8022e6:	56                   	push   %esi
+  8022e7:	6a 00                	push   $0x0
+  8022e9:	e8 7a ea ff ff       	call   800d68 <sys_page_unmap>
+  8022ee:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8022f1:	83 ec 08             	sub    $0x8,%esp
+  8022f4:	ff 75 f0             	push   -0x10(%ebp)
+  8022f7:	6a 00                	push   $0x0
+  8022f9:	e8 6a ea ff ff       	call   800d68 <sys_page_unmap>
+  8022fe:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802301:	83 ec 08             	sub    $0x8,%esp
+  802304:	ff 75 f4             	push   -0xc(%ebp)
+  802307:	6a 00                	push   $0x0
+  802309:	e8 5a ea ff ff       	call   800d68 <sys_page_unmap>
+  80230e:	83 c4 10             	add    $0x10,%esp
+}
+  802311:	89 d8                	mov    %ebx,%eax
+  802313:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802316:	5b                   	pop    %ebx
+  802317:	5e                   	pop    %esi
+  802318:	5d                   	pop    %ebp
+  802319:	c3                   	ret
+
+0080231a <pipeisclosed>:
+{
+  80231a:	55                   	push   %ebp
+  80231b:	89 e5                	mov    %esp,%ebp
+  80231d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802320:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802323:	50                   	push   %eax
+  802324:	ff 75 08             	push   0x8(%ebp)
+  802327:	e8 1c f1 ff ff       	call   801448 <fd_lookup>
+  80232c:	83 c4 10             	add    $0x10,%esp
+  80232f:	85 c0                	test   %eax,%eax
+  802331:	78 18                	js     80234b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802333:	83 ec 0c             	sub    $0xc,%esp
+  802336:	ff 75 f4             	push   -0xc(%ebp)
+  802339:	e8 9f f0 ff ff       	call   8013dd <fd2data>
+  80233e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802340:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802343:	e8 a8 fb ff ff       	call   801ef0 <_pipeisclosed>
+  802348:	83 c4 10             	add    $0x10,%esp
+}
+  80234b:	c9                   	leave
+  80234c:	c3                   	ret
+
+0080234d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80234d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802352:	c3                   	ret
+
+00802353 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802353:	55                   	push   %ebp
+  802354:	89 e5                	mov    %esp,%ebp
+  802356:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802359:	68 56 2e 80 00       	push   $0x802e56
+  80235e:	ff 75 0c             	push   0xc(%ebp)
+  802361:	e8 8a e4 ff ff       	call   8007f0 <strcpy>
+	return 0;
+}
+  802366:	b8 00 00 00 00       	mov    $0x0,%eax
+  80236b:	c9                   	leave
+  80236c:	c3                   	ret
+
+0080236d <devcons_write>:
+{
+  80236d:	55                   	push   %ebp
+  80236e:	89 e5                	mov    %esp,%ebp
+  802370:	57                   	push   %edi
+  802371:	56                   	push   %esi
+  802372:	53                   	push   %ebx
+  802373:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802379:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80237e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802384:	eb 2e                	jmp    8023b4 <devcons_write+0x47>
+		m = n - tot;
+  802386:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802389:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80238b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802390:	39 c3                	cmp    %eax,%ebx
+  802392:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802395:	83 ec 04             	sub    $0x4,%esp
+  802398:	53                   	push   %ebx
+  802399:	89 f0                	mov    %esi,%eax
+  80239b:	03 45 0c             	add    0xc(%ebp),%eax
+  80239e:	50                   	push   %eax
+  80239f:	57                   	push   %edi
+  8023a0:	e8 d1 e5 ff ff       	call   800976 <memmove>
+		sys_cputs(buf, m);
+  8023a5:	83 c4 08             	add    $0x8,%esp
+  8023a8:	53                   	push   %ebx
+  8023a9:	57                   	push   %edi
+  8023aa:	e8 67 e8 ff ff       	call   800c16 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8023af:	01 de                	add    %ebx,%esi
+  8023b1:	83 c4 10             	add    $0x10,%esp
+  8023b4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8023b7:	72 cd                	jb     802386 <devcons_write+0x19>
+}
+  8023b9:	89 f0                	mov    %esi,%eax
+  8023bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023be:	5b                   	pop    %ebx
+  8023bf:	5e                   	pop    %esi
+  8023c0:	5f                   	pop    %edi
+  8023c1:	5d                   	pop    %ebp
+  8023c2:	c3                   	ret
+
+008023c3 <devcons_read>:
+{
+  8023c3:	55                   	push   %ebp
+  8023c4:	89 e5                	mov    %esp,%ebp
+  8023c6:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8023c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ce:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8023d2:	75 07                	jne    8023db <devcons_read+0x18>
+  8023d4:	eb 1f                	jmp    8023f5 <devcons_read+0x32>
+		sys_yield();
+  8023d6:	e8 e9 e8 ff ff       	call   800cc4 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8023db:	e8 65 e8 ff ff       	call   800c45 <sys_cgetc>
+  8023e0:	85 c0                	test   %eax,%eax
+  8023e2:	74 f2                	je     8023d6 <devcons_read+0x13>
+	if (c < 0)
+  8023e4:	78 0f                	js     8023f5 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8023e6:	83 f8 04             	cmp    $0x4,%eax
+  8023e9:	74 0c                	je     8023f7 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8023eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023ee:	88 02                	mov    %al,(%edx)
+	return 1;
+  8023f0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8023f5:	c9                   	leave
+  8023f6:	c3                   	ret
+		return 0;
+  8023f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023fc:	eb f7                	jmp    8023f5 <devcons_read+0x32>
+
+008023fe <cputchar>:
+{
+  8023fe:	55                   	push   %ebp
+  8023ff:	89 e5                	mov    %esp,%ebp
+  802401:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802404:	8b 45 08             	mov    0x8(%ebp),%eax
+  802407:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80240a:	6a 01                	push   $0x1
+  80240c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80240f:	50                   	push   %eax
+  802410:	e8 01 e8 ff ff       	call   800c16 <sys_cputs>
+}
+  802415:	83 c4 10             	add    $0x10,%esp
+  802418:	c9                   	leave
+  802419:	c3                   	ret
+
+0080241a <getchar>:
+{
+  80241a:	55                   	push   %ebp
+  80241b:	89 e5                	mov    %esp,%ebp
+  80241d:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802420:	6a 01                	push   $0x1
+  802422:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802425:	50                   	push   %eax
+  802426:	6a 00                	push   $0x0
+  802428:	e8 7a f2 ff ff       	call   8016a7 <read>
+	if (r < 0)
+  80242d:	83 c4 10             	add    $0x10,%esp
+  802430:	85 c0                	test   %eax,%eax
+  802432:	78 06                	js     80243a <getchar+0x20>
+	if (r < 1)
+  802434:	74 06                	je     80243c <getchar+0x22>
+	return c;
+  802436:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80243a:	c9                   	leave
+  80243b:	c3                   	ret
+		return -E_EOF;
+  80243c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802441:	eb f7                	jmp    80243a <getchar+0x20>
+
+00802443 <iscons>:
+{
+  802443:	55                   	push   %ebp
+  802444:	89 e5                	mov    %esp,%ebp
+  802446:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802449:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80244c:	50                   	push   %eax
+  80244d:	ff 75 08             	push   0x8(%ebp)
+  802450:	e8 f3 ef ff ff       	call   801448 <fd_lookup>
+  802455:	83 c4 10             	add    $0x10,%esp
+  802458:	85 c0                	test   %eax,%eax
+  80245a:	78 11                	js     80246d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80245c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80245f:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  802465:	39 10                	cmp    %edx,(%eax)
+  802467:	0f 94 c0             	sete   %al
+  80246a:	0f b6 c0             	movzbl %al,%eax
+}
+  80246d:	c9                   	leave
+  80246e:	c3                   	ret
+
+0080246f <opencons>:
+{
+  80246f:	55                   	push   %ebp
+  802470:	89 e5                	mov    %esp,%ebp
+  802472:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802475:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802478:	50                   	push   %eax
+  802479:	e8 76 ef ff ff       	call   8013f4 <fd_alloc>
+  80247e:	83 c4 10             	add    $0x10,%esp
+  802481:	85 c0                	test   %eax,%eax
+  802483:	78 3a                	js     8024bf <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802485:	83 ec 04             	sub    $0x4,%esp
+  802488:	68 07 04 00 00       	push   $0x407
+  80248d:	ff 75 f4             	push   -0xc(%ebp)
+  802490:	6a 00                	push   $0x0
+  802492:	e8 4c e8 ff ff       	call   800ce3 <sys_page_alloc>
+  802497:	83 c4 10             	add    $0x10,%esp
+  80249a:	85 c0                	test   %eax,%eax
+  80249c:	78 21                	js     8024bf <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80249e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024a1:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  8024a7:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8024a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024ac:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8024b3:	83 ec 0c             	sub    $0xc,%esp
+  8024b6:	50                   	push   %eax
+  8024b7:	e8 11 ef ff ff       	call   8013cd <fd2num>
+  8024bc:	83 c4 10             	add    $0x10,%esp
+}
+  8024bf:	c9                   	leave
+  8024c0:	c3                   	ret
+
+008024c1 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8024c1:	55                   	push   %ebp
+  8024c2:	89 e5                	mov    %esp,%ebp
+  8024c4:	56                   	push   %esi
+  8024c5:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8024c6:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8024c9:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  8024cf:	e8 d1 e7 ff ff       	call   800ca5 <sys_getenvid>
+  8024d4:	83 ec 0c             	sub    $0xc,%esp
+  8024d7:	ff 75 0c             	push   0xc(%ebp)
+  8024da:	ff 75 08             	push   0x8(%ebp)
+  8024dd:	56                   	push   %esi
+  8024de:	50                   	push   %eax
+  8024df:	68 64 2e 80 00       	push   $0x802e64
+  8024e4:	e8 20 dd ff ff       	call   800209 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8024e9:	83 c4 18             	add    $0x18,%esp
+  8024ec:	53                   	push   %ebx
+  8024ed:	ff 75 10             	push   0x10(%ebp)
+  8024f0:	e8 c3 dc ff ff       	call   8001b8 <vcprintf>
+	cprintf("\n");
+  8024f5:	c7 04 24 d0 29 80 00 	movl   $0x8029d0,(%esp)
+  8024fc:	e8 08 dd ff ff       	call   800209 <cprintf>
+  802501:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802504:	cc                   	int3
+	while (1)
+  802505:	eb fd                	jmp    802504 <_panic+0x43>
+
+00802507 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  802507:	55                   	push   %ebp
+  802508:	89 e5                	mov    %esp,%ebp
+  80250a:	57                   	push   %edi
+  80250b:	56                   	push   %esi
+  80250c:	53                   	push   %ebx
+  80250d:	83 ec 14             	sub    $0x14,%esp
+  802510:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802513:	8b 75 14             	mov    0x14(%ebp),%esi
+  802516:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  802519:	ff 75 10             	push   0x10(%ebp)
+  80251c:	ff 75 0c             	push   0xc(%ebp)
+  80251f:	e8 e2 eb ff ff       	call   801106 <sys_ipc_recv_pages>
+  802524:	83 c4 10             	add    $0x10,%esp
+  802527:	85 c0                	test   %eax,%eax
+  802529:	78 46                	js     802571 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80252b:	85 ff                	test   %edi,%edi
+  80252d:	74 0d                	je     80253c <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  80252f:	a1 08 40 80 00       	mov    0x804008,%eax
+  802534:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80253a:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80253c:	85 f6                	test   %esi,%esi
+  80253e:	74 0d                	je     80254d <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  802540:	a1 08 40 80 00       	mov    0x804008,%eax
+  802545:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80254b:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80254d:	85 db                	test   %ebx,%ebx
+  80254f:	74 0d                	je     80255e <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  802551:	a1 08 40 80 00       	mov    0x804008,%eax
+  802556:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80255c:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80255e:	a1 08 40 80 00       	mov    0x804008,%eax
+  802563:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802569:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80256c:	5b                   	pop    %ebx
+  80256d:	5e                   	pop    %esi
+  80256e:	5f                   	pop    %edi
+  80256f:	5d                   	pop    %ebp
+  802570:	c3                   	ret
+		if (from_env_store) {
+  802571:	85 ff                	test   %edi,%edi
+  802573:	74 06                	je     80257b <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  802575:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80257b:	85 f6                	test   %esi,%esi
+  80257d:	74 06                	je     802585 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  80257f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802585:	85 db                	test   %ebx,%ebx
+  802587:	74 e0                	je     802569 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  802589:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80258f:	eb d8                	jmp    802569 <ipc_recv_pages+0x62>
+
+00802591 <ipc_recv>:
+{
+  802591:	55                   	push   %ebp
+  802592:	89 e5                	mov    %esp,%ebp
+  802594:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  802597:	6a 00                	push   $0x0
+  802599:	ff 75 10             	push   0x10(%ebp)
+  80259c:	6a 01                	push   $0x1
+  80259e:	ff 75 0c             	push   0xc(%ebp)
+  8025a1:	ff 75 08             	push   0x8(%ebp)
+  8025a4:	e8 5e ff ff ff       	call   802507 <ipc_recv_pages>
+}
+  8025a9:	c9                   	leave
+  8025aa:	c3                   	ret
+
+008025ab <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8025ab:	55                   	push   %ebp
+  8025ac:	89 e5                	mov    %esp,%ebp
+  8025ae:	56                   	push   %esi
+  8025af:	53                   	push   %ebx
+  8025b0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8025b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8025b6:	83 ec 0c             	sub    $0xc,%esp
+  8025b9:	ff 75 0c             	push   0xc(%ebp)
+  8025bc:	e8 79 ec ff ff       	call   80123a <sys_ipc_try_recv>
+  8025c1:	83 c4 10             	add    $0x10,%esp
+  8025c4:	85 c0                	test   %eax,%eax
+  8025c6:	78 34                	js     8025fc <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8025c8:	85 f6                	test   %esi,%esi
+  8025ca:	74 0d                	je     8025d9 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8025cc:	a1 08 40 80 00       	mov    0x804008,%eax
+  8025d1:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8025d7:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8025d9:	85 db                	test   %ebx,%ebx
+  8025db:	74 0d                	je     8025ea <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8025dd:	a1 08 40 80 00       	mov    0x804008,%eax
+  8025e2:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8025e8:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8025ea:	a1 08 40 80 00       	mov    0x804008,%eax
+  8025ef:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8025f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025f8:	5b                   	pop    %ebx
+  8025f9:	5e                   	pop    %esi
+  8025fa:	5d                   	pop    %ebp
+  8025fb:	c3                   	ret
+		if (from_env_store) {
+  8025fc:	85 f6                	test   %esi,%esi
+  8025fe:	74 06                	je     802606 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  802600:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  802606:	85 db                	test   %ebx,%ebx
+  802608:	74 eb                	je     8025f5 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  80260a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802610:	eb e3                	jmp    8025f5 <ipc_try_recv+0x4a>
+
+00802612 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802612:	55                   	push   %ebp
+  802613:	89 e5                	mov    %esp,%ebp
+  802615:	83 ec 14             	sub    $0x14,%esp
+  802618:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80261b:	85 c0                	test   %eax,%eax
+  80261d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802622:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802625:	ff 75 18             	push   0x18(%ebp)
+  802628:	ff 75 14             	push   0x14(%ebp)
+  80262b:	50                   	push   %eax
+  80262c:	ff 75 0c             	push   0xc(%ebp)
+  80262f:	ff 75 08             	push   0x8(%ebp)
+  802632:	e8 92 ea ff ff       	call   8010c9 <sys_ipc_send_pages>
+  802637:	83 c4 20             	add    $0x20,%esp
+  80263a:	85 c0                	test   %eax,%eax
+  80263c:	78 02                	js     802640 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  80263e:	c9                   	leave
+  80263f:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  802640:	50                   	push   %eax
+  802641:	68 88 2e 80 00       	push   $0x802e88
+  802646:	68 80 00 00 00       	push   $0x80
+  80264b:	68 b4 2e 80 00       	push   $0x802eb4
+  802650:	e8 6c fe ff ff       	call   8024c1 <_panic>
+
+00802655 <ipc_send>:
+{
+  802655:	55                   	push   %ebp
+  802656:	89 e5                	mov    %esp,%ebp
+  802658:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  80265b:	ff 75 14             	push   0x14(%ebp)
+  80265e:	6a 01                	push   $0x1
+  802660:	ff 75 10             	push   0x10(%ebp)
+  802663:	ff 75 0c             	push   0xc(%ebp)
+  802666:	ff 75 08             	push   0x8(%ebp)
+  802669:	e8 a4 ff ff ff       	call   802612 <ipc_send_pages>
+}
+  80266e:	83 c4 20             	add    $0x20,%esp
+  802671:	c9                   	leave
+  802672:	c3                   	ret
+
+00802673 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802673:	55                   	push   %ebp
+  802674:	89 e5                	mov    %esp,%ebp
+  802676:	83 ec 14             	sub    $0x14,%esp
+  802679:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80267c:	85 c0                	test   %eax,%eax
+  80267e:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802683:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802686:	ff 75 18             	push   0x18(%ebp)
+  802689:	ff 75 14             	push   0x14(%ebp)
+  80268c:	50                   	push   %eax
+  80268d:	ff 75 0c             	push   0xc(%ebp)
+  802690:	ff 75 08             	push   0x8(%ebp)
+  802693:	e8 c2 ea ff ff       	call   80115a <sys_ipc_call>
+  802698:	83 c4 20             	add    $0x20,%esp
+  80269b:	85 c0                	test   %eax,%eax
+  80269d:	78 0b                	js     8026aa <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  80269f:	a1 08 40 80 00       	mov    0x804008,%eax
+  8026a4:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8026aa:	c9                   	leave
+  8026ab:	c3                   	ret
+
+008026ac <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  8026ac:	55                   	push   %ebp
+  8026ad:	89 e5                	mov    %esp,%ebp
+  8026af:	57                   	push   %edi
+  8026b0:	56                   	push   %esi
+  8026b1:	53                   	push   %ebx
+  8026b2:	83 ec 18             	sub    $0x18,%esp
+  8026b5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8026b8:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8026bb:	8b 75 20             	mov    0x20(%ebp),%esi
+  8026be:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8026c1:	85 c0                	test   %eax,%eax
+  8026c3:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8026c8:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8026cb:	ff 75 18             	push   0x18(%ebp)
+  8026ce:	ff 75 14             	push   0x14(%ebp)
+  8026d1:	50                   	push   %eax
+  8026d2:	ff 75 0c             	push   0xc(%ebp)
+  8026d5:	ff 75 08             	push   0x8(%ebp)
+  8026d8:	e8 be ea ff ff       	call   80119b <sys_ipc_reply_recv>
+  8026dd:	83 c4 20             	add    $0x20,%esp
+  8026e0:	85 c0                	test   %eax,%eax
+  8026e2:	78 46                	js     80272a <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8026e4:	85 ff                	test   %edi,%edi
+  8026e6:	74 0d                	je     8026f5 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8026e8:	a1 08 40 80 00       	mov    0x804008,%eax
+  8026ed:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8026f3:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8026f5:	85 f6                	test   %esi,%esi
+  8026f7:	74 0d                	je     802706 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8026f9:	a1 08 40 80 00       	mov    0x804008,%eax
+  8026fe:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802704:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802706:	85 db                	test   %ebx,%ebx
+  802708:	74 0d                	je     802717 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  80270a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80270f:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802715:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802717:	a1 08 40 80 00       	mov    0x804008,%eax
+  80271c:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802722:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802725:	5b                   	pop    %ebx
+  802726:	5e                   	pop    %esi
+  802727:	5f                   	pop    %edi
+  802728:	5d                   	pop    %ebp
+  802729:	c3                   	ret
+		if (from_env_store) {
+  80272a:	85 ff                	test   %edi,%edi
+  80272c:	74 06                	je     802734 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  80272e:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802734:	85 f6                	test   %esi,%esi
+  802736:	74 06                	je     80273e <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  802738:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80273e:	85 db                	test   %ebx,%ebx
+  802740:	74 e0                	je     802722 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  802742:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802748:	eb d8                	jmp    802722 <ipc_reply_recv+0x76>
+
+0080274a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80274a:	55                   	push   %ebp
+  80274b:	89 e5                	mov    %esp,%ebp
+  80274d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802750:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  802755:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802758:	c1 e0 06             	shl    $0x6,%eax
+  80275b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802760:	8b 40 50             	mov    0x50(%eax),%eax
+  802763:	39 c8                	cmp    %ecx,%eax
+  802765:	74 12                	je     802779 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802767:	83 c2 01             	add    $0x1,%edx
+  80276a:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802770:	75 e3                	jne    802755 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802772:	b8 00 00 00 00       	mov    $0x0,%eax
+  802777:	eb 0e                	jmp    802787 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802779:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80277c:	c1 e0 06             	shl    $0x6,%eax
+  80277f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802784:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802787:	5d                   	pop    %ebp
+  802788:	c3                   	ret
+
+00802789 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802789:	55                   	push   %ebp
+  80278a:	89 e5                	mov    %esp,%ebp
+  80278c:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80278f:	89 c2                	mov    %eax,%edx
+  802791:	c1 ea 16             	shr    $0x16,%edx
+  802794:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80279b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8027a0:	f6 c1 01             	test   $0x1,%cl
+  8027a3:	74 1e                	je     8027c3 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  8027a5:	c1 e8 0c             	shr    $0xc,%eax
+  8027a8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8027af:	a8 01                	test   $0x1,%al
+  8027b1:	74 10                	je     8027c3 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8027b3:	c1 e8 0c             	shr    $0xc,%eax
+  8027b6:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8027b9:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  8027c0:	0f b7 d2             	movzwl %dx,%edx
+}
+  8027c3:	89 d0                	mov    %edx,%eax
+  8027c5:	5d                   	pop    %ebp
+  8027c6:	c3                   	ret
+
+008027c7 <udivmod>:
+  8027c7:	55                   	push   %ebp
+  8027c8:	57                   	push   %edi
+  8027c9:	56                   	push   %esi
+  8027ca:	53                   	push   %ebx
+  8027cb:	83 ec 24             	sub    $0x24,%esp
+  8027ce:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8027d2:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8027d6:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8027da:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8027de:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8027e2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8027e6:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8027ea:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8027ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f9:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802800:	00 
+  802801:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802808:	00 
+  802809:	89 fb                	mov    %edi,%ebx
+  80280b:	eb 08                	jmp    802815 <udivmod+0x4e>
+  80280d:	83 e9 01             	sub    $0x1,%ecx
+  802810:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802813:	74 68                	je     80287d <udivmod+0xb6>
+  802815:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802819:	01 c0                	add    %eax,%eax
+  80281b:	89 c6                	mov    %eax,%esi
+  80281d:	89 d7                	mov    %edx,%edi
+  80281f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802823:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802827:	0f ad d0             	shrd   %cl,%edx,%eax
+  80282a:	d3 ea                	shr    %cl,%edx
+  80282c:	f6 c1 20             	test   $0x20,%cl
+  80282f:	74 04                	je     802835 <udivmod+0x6e>
+  802831:	89 d0                	mov    %edx,%eax
+  802833:	31 d2                	xor    %edx,%edx
+  802835:	83 e0 01             	and    $0x1,%eax
+  802838:	89 04 24             	mov    %eax,(%esp)
+  80283b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802842:	00 
+  802843:	8b 04 24             	mov    (%esp),%eax
+  802846:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80284a:	09 f0                	or     %esi,%eax
+  80284c:	09 fa                	or     %edi,%edx
+  80284e:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802852:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802856:	39 f0                	cmp    %esi,%eax
+  802858:	89 d5                	mov    %edx,%ebp
+  80285a:	19 fd                	sbb    %edi,%ebp
+  80285c:	72 af                	jb     80280d <udivmod+0x46>
+  80285e:	29 f0                	sub    %esi,%eax
+  802860:	19 fa                	sbb    %edi,%edx
+  802862:	89 cf                	mov    %ecx,%edi
+  802864:	c1 ef 05             	shr    $0x5,%edi
+  802867:	83 e7 01             	and    $0x1,%edi
+  80286a:	89 fe                	mov    %edi,%esi
+  80286c:	83 f6 01             	xor    $0x1,%esi
+  80286f:	d3 e6                	shl    %cl,%esi
+  802871:	d3 e7                	shl    %cl,%edi
+  802873:	09 74 24 18          	or     %esi,0x18(%esp)
+  802877:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80287b:	eb 90                	jmp    80280d <udivmod+0x46>
+  80287d:	85 db                	test   %ebx,%ebx
+  80287f:	74 05                	je     802886 <udivmod+0xbf>
+  802881:	89 03                	mov    %eax,(%ebx)
+  802883:	89 53 04             	mov    %edx,0x4(%ebx)
+  802886:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80288a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80288e:	83 c4 24             	add    $0x24,%esp
+  802891:	5b                   	pop    %ebx
+  802892:	5e                   	pop    %esi
+  802893:	5f                   	pop    %edi
+  802894:	5d                   	pop    %ebp
+  802895:	c3                   	ret
+
+00802896 <__udivdi3>:
+  802896:	83 ec 08             	sub    $0x8,%esp
+  802899:	6a 00                	push   $0x0
+  80289b:	ff 74 24 1c          	push   0x1c(%esp)
+  80289f:	ff 74 24 1c          	push   0x1c(%esp)
+  8028a3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8028a7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8028ab:	e8 17 ff ff ff       	call   8027c7 <udivmod>
+  8028b0:	83 c4 14             	add    $0x14,%esp
+  8028b3:	c3                   	ret
+
+008028b4 <__umoddi3>:
+  8028b4:	83 ec 18             	sub    $0x18,%esp
+  8028b7:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8028bb:	50                   	push   %eax
+  8028bc:	ff 74 24 2c          	push   0x2c(%esp)
+  8028c0:	ff 74 24 2c          	push   0x2c(%esp)
+  8028c4:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8028c8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8028cc:	e8 f6 fe ff ff       	call   8027c7 <udivmod>
+  8028d1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8028d5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8028d9:	83 c4 24             	add    $0x24,%esp
+  8028dc:	c3                   	ret
+
+008028dd <__divdi3>:
+  8028dd:	55                   	push   %ebp
+  8028de:	57                   	push   %edi
+  8028df:	56                   	push   %esi
+  8028e0:	53                   	push   %ebx
+  8028e1:	83 ec 10             	sub    $0x10,%esp
+  8028e4:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8028e8:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8028ec:	89 c6                	mov    %eax,%esi
+  8028ee:	89 d7                	mov    %edx,%edi
+  8028f0:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8028f4:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8028f8:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8028fc:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  802900:	89 c5                	mov    %eax,%ebp
+  802902:	f7 dd                	neg    %ebp
+  802904:	89 d6                	mov    %edx,%esi
+  802906:	83 d6 00             	adc    $0x0,%esi
+  802909:	f7 de                	neg    %esi
+  80290b:	0f 48 e8             	cmovs  %eax,%ebp
+  80290e:	0f 49 d6             	cmovns %esi,%edx
+  802911:	6a 00                	push   $0x0
+  802913:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802917:	f7 de                	neg    %esi
+  802919:	8b 44 24 34          	mov    0x34(%esp),%eax
+  80291d:	83 d0 00             	adc    $0x0,%eax
+  802920:	f7 d8                	neg    %eax
+  802922:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  802927:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  80292c:	50                   	push   %eax
+  80292d:	56                   	push   %esi
+  80292e:	89 e8                	mov    %ebp,%eax
+  802930:	e8 92 fe ff ff       	call   8027c7 <udivmod>
+  802935:	83 c4 10             	add    $0x10,%esp
+  802938:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  80293d:	78 08                	js     802947 <__divdi3+0x6a>
+  80293f:	83 c4 0c             	add    $0xc,%esp
+  802942:	5b                   	pop    %ebx
+  802943:	5e                   	pop    %esi
+  802944:	5f                   	pop    %edi
+  802945:	5d                   	pop    %ebp
+  802946:	c3                   	ret
+  802947:	f7 d8                	neg    %eax
+  802949:	83 d2 00             	adc    $0x0,%edx
+  80294c:	f7 da                	neg    %edx
+  80294e:	eb ef                	jmp    80293f <__divdi3+0x62>
+
+00802950 <__moddi3>:
+  802950:	55                   	push   %ebp
+  802951:	57                   	push   %edi
+  802952:	56                   	push   %esi
+  802953:	53                   	push   %ebx
+  802954:	83 ec 18             	sub    $0x18,%esp
+  802957:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80295b:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80295f:	89 f1                	mov    %esi,%ecx
+  802961:	f7 d9                	neg    %ecx
+  802963:	89 da                	mov    %ebx,%edx
+  802965:	83 d2 00             	adc    $0x0,%edx
+  802968:	f7 da                	neg    %edx
+  80296a:	0f 48 ce             	cmovs  %esi,%ecx
+  80296d:	0f 48 d3             	cmovs  %ebx,%edx
+  802970:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802974:	50                   	push   %eax
+  802975:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802979:	f7 de                	neg    %esi
+  80297b:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  80297f:	83 d0 00             	adc    $0x0,%eax
+  802982:	f7 d8                	neg    %eax
+  802984:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802989:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  80298e:	50                   	push   %eax
+  80298f:	56                   	push   %esi
+  802990:	89 c8                	mov    %ecx,%eax
+  802992:	e8 30 fe ff ff       	call   8027c7 <udivmod>
+  802997:	83 c4 10             	add    $0x10,%esp
+  80299a:	85 db                	test   %ebx,%ebx
+  80299c:	78 10                	js     8029ae <__moddi3+0x5e>
+  80299e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029a2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029a6:	83 c4 14             	add    $0x14,%esp
+  8029a9:	5b                   	pop    %ebx
+  8029aa:	5e                   	pop    %esi
+  8029ab:	5f                   	pop    %edi
+  8029ac:	5d                   	pop    %ebp
+  8029ad:	c3                   	ret
+  8029ae:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8029b2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8029b6:	f7 d8                	neg    %eax
+  8029b8:	83 d2 00             	adc    $0x0,%edx
+  8029bb:	f7 da                	neg    %edx
+  8029bd:	eb e7                	jmp    8029a6 <__moddi3+0x56>
@@ -0,0 +1,10673 @@
+
+obj/user/mempressure.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ca 01 00 00       	call   8001fb <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define BASE 0x10000000
+#define TOP  0xD0000000
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	int r;
+	uint32_t level;
+	uintptr_t va;
+	envid_t envid;
+
+	assert(meminfo.mi_npages > 0);
+  800038:	a1 08 f0 ff ee       	mov    0xeefff008,%eax
+  80003d:	85 c0                	test   %eax,%eax
+  80003f:	74 53                	je     800094 <umain+0x61>
+	if (meminfo.mi_level != MEM_PRESSURE_NONE)
+  800041:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  800046:	85 c0                	test   %eax,%eax
+  800048:	75 60                	jne    8000aa <umain+0x77>
+		panic("memory pressure already at level %d", meminfo.mi_level);
+
+	if ((envid = fork()) < 0)
+  80004a:	e8 ab 14 00 00       	call   8014fa <fork>
+  80004f:	89 c6                	mov    %eax,%esi
+  800051:	85 c0                	test   %eax,%eax
+  800053:	78 6c                	js     8000c1 <umain+0x8e>
+		return;
+	}
+
+	// Allocate straight from the kernel, so nothing gets paged out,
+	// until the level goes up on a clock tick
+	for (va = BASE; va < TOP && meminfo.mi_level == MEM_PRESSURE_NONE; va += PGSIZE) {
+  800055:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+	if (envid == 0) {
+  80005a:	74 77                	je     8000d3 <umain+0xa0>
+	for (va = BASE; va < TOP && meminfo.mi_level == MEM_PRESSURE_NONE; va += PGSIZE) {
+  80005c:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  800061:	85 c0                	test   %eax,%eax
+  800063:	0f 85 d7 00 00 00    	jne    800140 <umain+0x10d>
+		if ((r = sys_page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W)) < 0) {
+  800069:	83 ec 04             	sub    $0x4,%esp
+  80006c:	6a 07                	push   $0x7
+  80006e:	53                   	push   %ebx
+  80006f:	6a 00                	push   $0x0
+  800071:	e8 9d 0d 00 00       	call   800e13 <sys_page_alloc>
+  800076:	83 c4 10             	add    $0x10,%esp
+  800079:	85 c0                	test   %eax,%eax
+  80007b:	0f 88 96 00 00 00    	js     800117 <umain+0xe4>
+	for (va = BASE; va < TOP && meminfo.mi_level == MEM_PRESSURE_NONE; va += PGSIZE) {
+  800081:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800087:	81 fb 00 00 00 d0    	cmp    $0xd0000000,%ebx
+  80008d:	75 cd                	jne    80005c <umain+0x29>
+  80008f:	e9 ac 00 00 00       	jmp    800140 <umain+0x10d>
+	assert(meminfo.mi_npages > 0);
+  800094:	68 40 54 80 00       	push   $0x805440
+  800099:	68 56 54 80 00       	push   $0x805456
+  80009e:	6a 12                	push   $0x12
+  8000a0:	68 c4 54 80 00       	push   $0x8054c4
+  8000a5:	e8 b4 01 00 00       	call   80025e <_panic>
+		panic("memory pressure already at level %d", meminfo.mi_level);
+  8000aa:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  8000af:	50                   	push   %eax
+  8000b0:	68 e4 54 80 00       	push   $0x8054e4
+  8000b5:	6a 14                	push   $0x14
+  8000b7:	68 c4 54 80 00       	push   $0x8054c4
+  8000bc:	e8 9d 01 00 00       	call   80025e <_panic>
+		panic("fork: %e", envid);
+  8000c1:	50                   	push   %eax
+  8000c2:	68 6b 54 80 00       	push   $0x80546b
+  8000c7:	6a 17                	push   $0x17
+  8000c9:	68 c4 54 80 00       	push   $0x8054c4
+  8000ce:	e8 8b 01 00 00       	call   80025e <_panic>
+		level = mem_pressure_wait(MEM_PRESSURE_NONE);
+  8000d3:	83 ec 0c             	sub    $0xc,%esp
+  8000d6:	6a 00                	push   $0x0
+  8000d8:	e8 ab 37 00 00       	call   803888 <mem_pressure_wait>
+		assert(level != MEM_PRESSURE_NONE);
+  8000dd:	83 c4 10             	add    $0x10,%esp
+  8000e0:	85 c0                	test   %eax,%eax
+  8000e2:	74 1d                	je     800101 <umain+0xce>
+			level, meminfo.mi_free_pages);
+  8000e4:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+		cprintf("mempressure: child woken at level %d, %d pages free\n",
+  8000ea:	83 ec 04             	sub    $0x4,%esp
+  8000ed:	52                   	push   %edx
+  8000ee:	50                   	push   %eax
+  8000ef:	68 08 55 80 00       	push   $0x805508
+  8000f4:	e8 40 02 00 00       	call   800339 <cprintf>
+		return;
+  8000f9:	83 c4 10             	add    $0x10,%esp
+  8000fc:	e9 f3 00 00 00       	jmp    8001f4 <umain+0x1c1>
+		assert(level != MEM_PRESSURE_NONE);
+  800101:	68 74 54 80 00       	push   $0x805474
+  800106:	68 56 54 80 00       	push   $0x805456
+  80010b:	6a 1a                	push   $0x1a
+  80010d:	68 c4 54 80 00       	push   $0x8054c4
+  800112:	e8 47 01 00 00       	call   80025e <_panic>
+			if (r != -E_NO_MEM)
+  800117:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  80011a:	74 1b                	je     800137 <umain+0x104>
+				panic("sys_page_alloc on %p: %e", va, r);
+  80011c:	83 ec 0c             	sub    $0xc,%esp
+  80011f:	50                   	push   %eax
+  800120:	53                   	push   %ebx
+  800121:	68 8f 54 80 00       	push   $0x80548f
+  800126:	6a 25                	push   $0x25
+  800128:	68 c4 54 80 00       	push   $0x8054c4
+  80012d:	e8 2c 01 00 00       	call   80025e <_panic>
+			// Out of memory: the next tick must notice
+			while (meminfo.mi_level == MEM_PRESSURE_NONE)
+				sys_yield();
+  800132:	e8 bd 0c 00 00       	call   800df4 <sys_yield>
+			while (meminfo.mi_level == MEM_PRESSURE_NONE)
+  800137:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  80013c:	85 c0                	test   %eax,%eax
+  80013e:	74 f2                	je     800132 <umain+0xff>
+			break;
+		}
+	}
+	assert(meminfo.mi_level != MEM_PRESSURE_NONE);
+  800140:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  800145:	85 c0                	test   %eax,%eax
+  800147:	74 5a                	je     8001a3 <umain+0x170>
+	assert(meminfo.mi_free_pages < MEM_PRESSURE_LOW_PAGES);
+  800149:	a1 04 f0 ff ee       	mov    0xeefff004,%eax
+  80014e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800153:	77 64                	ja     8001b9 <umain+0x186>
+	cprintf("mempressure: level %d after allocating %d pages\n",
+		meminfo.mi_level, (va - BASE) / PGSIZE);
+  800155:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+	cprintf("mempressure: level %d after allocating %d pages\n",
+  80015b:	c1 eb 0c             	shr    $0xc,%ebx
+		meminfo.mi_level, (va - BASE) / PGSIZE);
+  80015e:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("mempressure: level %d after allocating %d pages\n",
+  800163:	83 ec 04             	sub    $0x4,%esp
+  800166:	53                   	push   %ebx
+  800167:	50                   	push   %eax
+  800168:	68 98 55 80 00       	push   $0x805598
+  80016d:	e8 c7 01 00 00       	call   800339 <cprintf>
+
+	wait(envid);
+  800172:	89 34 24             	mov    %esi,(%esp)
+  800175:	e8 54 26 00 00       	call   8027ce <wait>
+	if ((r = sys_page_unmap_range(0, (void*) BASE, (va - BASE) / PGSIZE)) < 0)
+  80017a:	83 c4 0c             	add    $0xc,%esp
+  80017d:	53                   	push   %ebx
+  80017e:	68 00 00 00 10       	push   $0x10000000
+  800183:	6a 00                	push   $0x0
+  800185:	e8 22 0e 00 00       	call   800fac <sys_page_unmap_range>
+  80018a:	83 c4 10             	add    $0x10,%esp
+  80018d:	85 c0                	test   %eax,%eax
+  80018f:	79 4a                	jns    8001db <umain+0x1a8>
+		panic("sys_page_unmap_range: %e", r);
+  800191:	50                   	push   %eax
+  800192:	68 a8 54 80 00       	push   $0x8054a8
+  800197:	6a 33                	push   $0x33
+  800199:	68 c4 54 80 00       	push   $0x8054c4
+  80019e:	e8 bb 00 00 00       	call   80025e <_panic>
+	assert(meminfo.mi_level != MEM_PRESSURE_NONE);
+  8001a3:	68 40 55 80 00       	push   $0x805540
+  8001a8:	68 56 54 80 00       	push   $0x805456
+  8001ad:	6a 2c                	push   $0x2c
+  8001af:	68 c4 54 80 00       	push   $0x8054c4
+  8001b4:	e8 a5 00 00 00       	call   80025e <_panic>
+	assert(meminfo.mi_free_pages < MEM_PRESSURE_LOW_PAGES);
+  8001b9:	68 68 55 80 00       	push   $0x805568
+  8001be:	68 56 54 80 00       	push   $0x805456
+  8001c3:	6a 2d                	push   $0x2d
+  8001c5:	68 c4 54 80 00       	push   $0x8054c4
+  8001ca:	e8 8f 00 00 00       	call   80025e <_panic>
+	while ((level = meminfo.mi_level) != MEM_PRESSURE_NONE)
+		mem_pressure_wait(level);
+  8001cf:	83 ec 0c             	sub    $0xc,%esp
+  8001d2:	50                   	push   %eax
+  8001d3:	e8 b0 36 00 00       	call   803888 <mem_pressure_wait>
+  8001d8:	83 c4 10             	add    $0x10,%esp
+	while ((level = meminfo.mi_level) != MEM_PRESSURE_NONE)
+  8001db:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  8001e0:	85 c0                	test   %eax,%eax
+  8001e2:	75 eb                	jne    8001cf <umain+0x19c>
+	cprintf("mempressure: Passed all checks!\n");
+  8001e4:	83 ec 0c             	sub    $0xc,%esp
+  8001e7:	68 cc 55 80 00       	push   $0x8055cc
+  8001ec:	e8 48 01 00 00       	call   800339 <cprintf>
+  8001f1:	83 c4 10             	add    $0x10,%esp
+}
+  8001f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001f7:	5b                   	pop    %ebx
+  8001f8:	5e                   	pop    %esi
+  8001f9:	5d                   	pop    %ebp
+  8001fa:	c3                   	ret
+
+008001fb <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001fb:	55                   	push   %ebp
+  8001fc:	89 e5                	mov    %esp,%ebp
+  8001fe:	56                   	push   %esi
+  8001ff:	53                   	push   %ebx
+  800200:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800203:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800206:	e8 ca 0b 00 00       	call   800dd5 <sys_getenvid>
+  80020b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800210:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800213:	c1 e0 06             	shl    $0x6,%eax
+  800216:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80021b:	a3 18 f9 80 00       	mov    %eax,0x80f918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800220:	85 db                	test   %ebx,%ebx
+  800222:	7e 07                	jle    80022b <libmain+0x30>
+		binaryname = argv[0];
+  800224:	8b 06                	mov    (%esi),%eax
+  800226:	a3 00 70 80 00       	mov    %eax,0x807000
+
+	// call user main routine
+	umain(argc, argv);
+  80022b:	83 ec 08             	sub    $0x8,%esp
+  80022e:	56                   	push   %esi
+  80022f:	53                   	push   %ebx
+  800230:	e8 fe fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800235:	e8 0a 00 00 00       	call   800244 <exit>
+}
+  80023a:	83 c4 10             	add    $0x10,%esp
+  80023d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800240:	5b                   	pop    %ebx
+  800241:	5e                   	pop    %esi
+  800242:	5d                   	pop    %ebp
+  800243:	c3                   	ret
+
+00800244 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800244:	55                   	push   %ebp
+  800245:	89 e5                	mov    %esp,%ebp
+  800247:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80024a:	e8 de 18 00 00       	call   801b2d <close_all>
+	sys_env_destroy(0);
+  80024f:	83 ec 0c             	sub    $0xc,%esp
+  800252:	6a 00                	push   $0x0
+  800254:	e8 3b 0b 00 00       	call   800d94 <sys_env_destroy>
+}
+  800259:	83 c4 10             	add    $0x10,%esp
+  80025c:	c9                   	leave
+  80025d:	c3                   	ret
+
+0080025e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80025e:	55                   	push   %ebp
+  80025f:	89 e5                	mov    %esp,%ebp
+  800261:	56                   	push   %esi
+  800262:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800263:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800266:	8b 35 00 70 80 00    	mov    0x807000,%esi
+  80026c:	e8 64 0b 00 00       	call   800dd5 <sys_getenvid>
+  800271:	83 ec 0c             	sub    $0xc,%esp
+  800274:	ff 75 0c             	push   0xc(%ebp)
+  800277:	ff 75 08             	push   0x8(%ebp)
+  80027a:	56                   	push   %esi
+  80027b:	50                   	push   %eax
+  80027c:	68 f8 55 80 00       	push   $0x8055f8
+  800281:	e8 b3 00 00 00       	call   800339 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800286:	83 c4 18             	add    $0x18,%esp
+  800289:	53                   	push   %ebx
+  80028a:	ff 75 10             	push   0x10(%ebp)
+  80028d:	e8 56 00 00 00       	call   8002e8 <vcprintf>
+	cprintf("\n");
+  800292:	c7 04 24 a2 5b 80 00 	movl   $0x805ba2,(%esp)
+  800299:	e8 9b 00 00 00       	call   800339 <cprintf>
+  80029e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002a1:	cc                   	int3
+	while (1)
+  8002a2:	eb fd                	jmp    8002a1 <_panic+0x43>
+
+008002a4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  8002a7:	53                   	push   %ebx
+  8002a8:	83 ec 04             	sub    $0x4,%esp
+  8002ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002ae:	8b 13                	mov    (%ebx),%edx
+  8002b0:	8d 42 01             	lea    0x1(%edx),%eax
+  8002b3:	89 03                	mov    %eax,(%ebx)
+  8002b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002b8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002bc:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002c1:	74 09                	je     8002cc <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002c3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002ca:	c9                   	leave
+  8002cb:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002cc:	83 ec 08             	sub    $0x8,%esp
+  8002cf:	68 ff 00 00 00       	push   $0xff
+  8002d4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002d7:	50                   	push   %eax
+  8002d8:	e8 69 0a 00 00       	call   800d46 <sys_cputs>
+		b->idx = 0;
+  8002dd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002e3:	83 c4 10             	add    $0x10,%esp
+  8002e6:	eb db                	jmp    8002c3 <putch+0x1f>
+
+008002e8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002e8:	55                   	push   %ebp
+  8002e9:	89 e5                	mov    %esp,%ebp
+  8002eb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002f1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002f8:	00 00 00 
+	b.cnt = 0;
+  8002fb:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800302:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800305:	ff 75 0c             	push   0xc(%ebp)
+  800308:	ff 75 08             	push   0x8(%ebp)
+  80030b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800311:	50                   	push   %eax
+  800312:	68 a4 02 80 00       	push   $0x8002a4
+  800317:	e8 14 01 00 00       	call   800430 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80031c:	83 c4 08             	add    $0x8,%esp
+  80031f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800325:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80032b:	50                   	push   %eax
+  80032c:	e8 15 0a 00 00       	call   800d46 <sys_cputs>
+
+	return b.cnt;
+}
+  800331:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800337:	c9                   	leave
+  800338:	c3                   	ret
+
+00800339 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800339:	55                   	push   %ebp
+  80033a:	89 e5                	mov    %esp,%ebp
+  80033c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80033f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800342:	50                   	push   %eax
+  800343:	ff 75 08             	push   0x8(%ebp)
+  800346:	e8 9d ff ff ff       	call   8002e8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80034b:	c9                   	leave
+  80034c:	c3                   	ret
+
+0080034d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80034d:	55                   	push   %ebp
+  80034e:	89 e5                	mov    %esp,%ebp
+  800350:	57                   	push   %edi
+  800351:	56                   	push   %esi
+  800352:	53                   	push   %ebx
+  800353:	83 ec 1c             	sub    $0x1c,%esp
+  800356:	89 c7                	mov    %eax,%edi
+  800358:	89 d6                	mov    %edx,%esi
+  80035a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80035d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800360:	89 d1                	mov    %edx,%ecx
+  800362:	89 c2                	mov    %eax,%edx
+  800364:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800367:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80036a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80036d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800370:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800373:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80037a:	39 c2                	cmp    %eax,%edx
+  80037c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80037f:	72 3e                	jb     8003bf <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800381:	83 ec 0c             	sub    $0xc,%esp
+  800384:	ff 75 18             	push   0x18(%ebp)
+  800387:	83 eb 01             	sub    $0x1,%ebx
+  80038a:	53                   	push   %ebx
+  80038b:	50                   	push   %eax
+  80038c:	83 ec 08             	sub    $0x8,%esp
+  80038f:	ff 75 e4             	push   -0x1c(%ebp)
+  800392:	ff 75 e0             	push   -0x20(%ebp)
+  800395:	ff 75 dc             	push   -0x24(%ebp)
+  800398:	ff 75 d8             	push   -0x28(%ebp)
+  80039b:	e8 6e 4f 00 00       	call   80530e <__udivdi3>
+  8003a0:	83 c4 18             	add    $0x18,%esp
+  8003a3:	52                   	push   %edx
+  8003a4:	50                   	push   %eax
+  8003a5:	89 f2                	mov    %esi,%edx
+  8003a7:	89 f8                	mov    %edi,%eax
+  8003a9:	e8 9f ff ff ff       	call   80034d <printnum>
+  8003ae:	83 c4 20             	add    $0x20,%esp
+  8003b1:	eb 13                	jmp    8003c6 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003b3:	83 ec 08             	sub    $0x8,%esp
+  8003b6:	56                   	push   %esi
+  8003b7:	ff 75 18             	push   0x18(%ebp)
+  8003ba:	ff d7                	call   *%edi
+  8003bc:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003bf:	83 eb 01             	sub    $0x1,%ebx
+  8003c2:	85 db                	test   %ebx,%ebx
+  8003c4:	7f ed                	jg     8003b3 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003c6:	83 ec 08             	sub    $0x8,%esp
+  8003c9:	56                   	push   %esi
+  8003ca:	83 ec 04             	sub    $0x4,%esp
+  8003cd:	ff 75 e4             	push   -0x1c(%ebp)
+  8003d0:	ff 75 e0             	push   -0x20(%ebp)
+  8003d3:	ff 75 dc             	push   -0x24(%ebp)
+  8003d6:	ff 75 d8             	push   -0x28(%ebp)
+  8003d9:	e8 4e 4f 00 00       	call   80532c <__umoddi3>
+  8003de:	83 c4 14             	add    $0x14,%esp
+  8003e1:	0f be 80 1b 56 80 00 	movsbl 0x80561b(%eax),%eax
+  8003e8:	50                   	push   %eax
+  8003e9:	ff d7                	call   *%edi
+}
+  8003eb:	83 c4 10             	add    $0x10,%esp
+  8003ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f1:	5b                   	pop    %ebx
+  8003f2:	5e                   	pop    %esi
+  8003f3:	5f                   	pop    %edi
+  8003f4:	5d                   	pop    %ebp
+  8003f5:	c3                   	ret
+
+008003f6 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003f6:	55                   	push   %ebp
+  8003f7:	89 e5                	mov    %esp,%ebp
+  8003f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003fc:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800400:	8b 10                	mov    (%eax),%edx
+  800402:	3b 50 04             	cmp    0x4(%eax),%edx
+  800405:	73 0a                	jae    800411 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800407:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80040a:	89 08                	mov    %ecx,(%eax)
+  80040c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80040f:	88 02                	mov    %al,(%edx)
+}
+  800411:	5d                   	pop    %ebp
+  800412:	c3                   	ret
+
+00800413 <printfmt>:
+{
+  800413:	55                   	push   %ebp
+  800414:	89 e5                	mov    %esp,%ebp
+  800416:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800419:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80041c:	50                   	push   %eax
+  80041d:	ff 75 10             	push   0x10(%ebp)
+  800420:	ff 75 0c             	push   0xc(%ebp)
+  800423:	ff 75 08             	push   0x8(%ebp)
+  800426:	e8 05 00 00 00       	call   800430 <vprintfmt>
+}
+  80042b:	83 c4 10             	add    $0x10,%esp
+  80042e:	c9                   	leave
+  80042f:	c3                   	ret
+
+00800430 <vprintfmt>:
+{
+  800430:	55                   	push   %ebp
+  800431:	89 e5                	mov    %esp,%ebp
+  800433:	57                   	push   %edi
+  800434:	56                   	push   %esi
+  800435:	53                   	push   %ebx
+  800436:	83 ec 2c             	sub    $0x2c,%esp
+  800439:	8b 75 08             	mov    0x8(%ebp),%esi
+  80043c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80043f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800442:	eb 0a                	jmp    80044e <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800444:	83 ec 08             	sub    $0x8,%esp
+  800447:	53                   	push   %ebx
+  800448:	50                   	push   %eax
+  800449:	ff d6                	call   *%esi
+  80044b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80044e:	83 c7 01             	add    $0x1,%edi
+  800451:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800455:	83 f8 25             	cmp    $0x25,%eax
+  800458:	74 0c                	je     800466 <vprintfmt+0x36>
+			if (ch == '\0')
+  80045a:	85 c0                	test   %eax,%eax
+  80045c:	75 e6                	jne    800444 <vprintfmt+0x14>
+}
+  80045e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800461:	5b                   	pop    %ebx
+  800462:	5e                   	pop    %esi
+  800463:	5f                   	pop    %edi
+  800464:	5d                   	pop    %ebp
+  800465:	c3                   	ret
+		padc = ' ';
+  800466:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80046a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800471:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800478:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80047f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800484:	8d 47 01             	lea    0x1(%edi),%eax
+  800487:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80048a:	0f b6 17             	movzbl (%edi),%edx
+  80048d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800490:	3c 55                	cmp    $0x55,%al
+  800492:	0f 87 c5 03 00 00    	ja     80085d <vprintfmt+0x42d>
+  800498:	0f b6 c0             	movzbl %al,%eax
+  80049b:	ff 24 85 a0 57 80 00 	jmp    *0x8057a0(,%eax,4)
+  8004a2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8004a5:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8004a9:	eb d9                	jmp    800484 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004ae:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004b2:	eb d0                	jmp    800484 <vprintfmt+0x54>
+  8004b4:	0f b6 d2             	movzbl %dl,%edx
+  8004b7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004bf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004c2:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004c5:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004c9:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8004cc:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004cf:	83 f9 09             	cmp    $0x9,%ecx
+  8004d2:	77 55                	ja     800529 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004d4:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004d7:	eb e9                	jmp    8004c2 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004dc:	8b 00                	mov    (%eax),%eax
+  8004de:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8004e7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004ed:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004f1:	79 91                	jns    800484 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004f3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004f6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800500:	eb 82                	jmp    800484 <vprintfmt+0x54>
+			if (width < 0)
+  800502:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800505:	85 d2                	test   %edx,%edx
+  800507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050c:	0f 49 c2             	cmovns %edx,%eax
+  80050f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800512:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800515:	e9 6a ff ff ff       	jmp    800484 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80051a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80051d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800524:	e9 5b ff ff ff       	jmp    800484 <vprintfmt+0x54>
+  800529:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80052c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80052f:	eb bc                	jmp    8004ed <vprintfmt+0xbd>
+			lflag++;
+  800531:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800534:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800537:	e9 48 ff ff ff       	jmp    800484 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80053c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053f:	8d 78 04             	lea    0x4(%eax),%edi
+  800542:	83 ec 08             	sub    $0x8,%esp
+  800545:	53                   	push   %ebx
+  800546:	ff 30                	push   (%eax)
+  800548:	ff d6                	call   *%esi
+			break;
+  80054a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80054d:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800550:	e9 63 02 00 00       	jmp    8007b8 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800555:	8b 45 14             	mov    0x14(%ebp),%eax
+  800558:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80055b:	8b 10                	mov    (%eax),%edx
+  80055d:	89 d0                	mov    %edx,%eax
+  80055f:	f7 d8                	neg    %eax
+  800561:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800564:	83 f8 12             	cmp    $0x12,%eax
+  800567:	7f 23                	jg     80058c <vprintfmt+0x15c>
+  800569:	8b 14 85 00 59 80 00 	mov    0x805900(,%eax,4),%edx
+  800570:	85 d2                	test   %edx,%edx
+  800572:	74 18                	je     80058c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800574:	52                   	push   %edx
+  800575:	68 68 54 80 00       	push   $0x805468
+  80057a:	53                   	push   %ebx
+  80057b:	56                   	push   %esi
+  80057c:	e8 92 fe ff ff       	call   800413 <printfmt>
+  800581:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800584:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800587:	e9 2c 02 00 00       	jmp    8007b8 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80058c:	50                   	push   %eax
+  80058d:	68 33 56 80 00       	push   $0x805633
+  800592:	53                   	push   %ebx
+  800593:	56                   	push   %esi
+  800594:	e8 7a fe ff ff       	call   800413 <printfmt>
+  800599:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80059c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80059f:	e9 14 02 00 00       	jmp    8007b8 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a7:	83 c0 04             	add    $0x4,%eax
+  8005aa:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b0:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005b2:	85 c9                	test   %ecx,%ecx
+  8005b4:	b8 2c 56 80 00       	mov    $0x80562c,%eax
+  8005b9:	0f 45 c1             	cmovne %ecx,%eax
+  8005bc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005bf:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005c3:	7e 06                	jle    8005cb <vprintfmt+0x19b>
+  8005c5:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005c9:	75 0b                	jne    8005d6 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005cb:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005ce:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005d1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005d4:	eb 5c                	jmp    800632 <vprintfmt+0x202>
+  8005d6:	83 ec 08             	sub    $0x8,%esp
+  8005d9:	ff 75 d0             	push   -0x30(%ebp)
+  8005dc:	ff 75 cc             	push   -0x34(%ebp)
+  8005df:	e8 19 03 00 00       	call   8008fd <strnlen>
+  8005e4:	89 c2                	mov    %eax,%edx
+  8005e6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e9:	29 d0                	sub    %edx,%eax
+  8005eb:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005ee:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005f8:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005fa:	eb 0e                	jmp    80060a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005fc:	83 ec 08             	sub    $0x8,%esp
+  8005ff:	53                   	push   %ebx
+  800600:	57                   	push   %edi
+  800601:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800604:	83 ee 01             	sub    $0x1,%esi
+  800607:	83 c4 10             	add    $0x10,%esp
+  80060a:	85 f6                	test   %esi,%esi
+  80060c:	7f ee                	jg     8005fc <vprintfmt+0x1cc>
+  80060e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800611:	8b 75 08             	mov    0x8(%ebp),%esi
+  800614:	85 c0                	test   %eax,%eax
+  800616:	ba 00 00 00 00       	mov    $0x0,%edx
+  80061b:	0f 49 d0             	cmovns %eax,%edx
+  80061e:	29 d0                	sub    %edx,%eax
+  800620:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800623:	eb a6                	jmp    8005cb <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800625:	83 ec 08             	sub    $0x8,%esp
+  800628:	53                   	push   %ebx
+  800629:	52                   	push   %edx
+  80062a:	ff 55 08             	call   *0x8(%ebp)
+  80062d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800630:	89 f1                	mov    %esi,%ecx
+  800632:	8d 71 01             	lea    0x1(%ecx),%esi
+  800635:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800639:	0f be d0             	movsbl %al,%edx
+  80063c:	85 d2                	test   %edx,%edx
+  80063e:	74 28                	je     800668 <vprintfmt+0x238>
+  800640:	85 ff                	test   %edi,%edi
+  800642:	78 05                	js     800649 <vprintfmt+0x219>
+  800644:	83 ef 01             	sub    $0x1,%edi
+  800647:	78 30                	js     800679 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800649:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80064d:	74 d6                	je     800625 <vprintfmt+0x1f5>
+  80064f:	0f be c0             	movsbl %al,%eax
+  800652:	83 e8 20             	sub    $0x20,%eax
+  800655:	83 f8 5e             	cmp    $0x5e,%eax
+  800658:	76 cb                	jbe    800625 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80065a:	83 ec 08             	sub    $0x8,%esp
+  80065d:	53                   	push   %ebx
+  80065e:	6a 3f                	push   $0x3f
+  800660:	ff 55 08             	call   *0x8(%ebp)
+  800663:	83 c4 10             	add    $0x10,%esp
+  800666:	eb c8                	jmp    800630 <vprintfmt+0x200>
+  800668:	8b 75 08             	mov    0x8(%ebp),%esi
+  80066b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80066e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800671:	01 d0                	add    %edx,%eax
+  800673:	29 c8                	sub    %ecx,%eax
+  800675:	89 c7                	mov    %eax,%edi
+  800677:	eb 13                	jmp    80068c <vprintfmt+0x25c>
+  800679:	8b 75 08             	mov    0x8(%ebp),%esi
+  80067c:	eb ed                	jmp    80066b <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80067e:	83 ec 08             	sub    $0x8,%esp
+  800681:	53                   	push   %ebx
+  800682:	6a 20                	push   $0x20
+  800684:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800686:	83 ef 01             	sub    $0x1,%edi
+  800689:	83 c4 10             	add    $0x10,%esp
+  80068c:	85 ff                	test   %edi,%edi
+  80068e:	7f ee                	jg     80067e <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800690:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800693:	89 45 14             	mov    %eax,0x14(%ebp)
+  800696:	e9 1d 01 00 00       	jmp    8007b8 <vprintfmt+0x388>
+	if (lflag >= 2)
+  80069b:	83 f9 01             	cmp    $0x1,%ecx
+  80069e:	7f 1b                	jg     8006bb <vprintfmt+0x28b>
+	else if (lflag)
+  8006a0:	85 c9                	test   %ecx,%ecx
+  8006a2:	74 63                	je     800707 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  8006a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a7:	8b 00                	mov    (%eax),%eax
+  8006a9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ac:	99                   	cltd
+  8006ad:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b9:	eb 17                	jmp    8006d2 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  8006bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006be:	8b 50 04             	mov    0x4(%eax),%edx
+  8006c1:	8b 00                	mov    (%eax),%eax
+  8006c3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006c6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cc:	8d 40 08             	lea    0x8(%eax),%eax
+  8006cf:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006d2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006d5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006d8:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006dd:	85 c9                	test   %ecx,%ecx
+  8006df:	0f 89 b9 00 00 00    	jns    80079e <vprintfmt+0x36e>
+				putch('-', putdat);
+  8006e5:	83 ec 08             	sub    $0x8,%esp
+  8006e8:	53                   	push   %ebx
+  8006e9:	6a 2d                	push   $0x2d
+  8006eb:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006ed:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006f0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006f3:	f7 da                	neg    %edx
+  8006f5:	83 d1 00             	adc    $0x0,%ecx
+  8006f8:	f7 d9                	neg    %ecx
+  8006fa:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006fd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800702:	e9 97 00 00 00       	jmp    80079e <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070a:	8b 00                	mov    (%eax),%eax
+  80070c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80070f:	99                   	cltd
+  800710:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800713:	8b 45 14             	mov    0x14(%ebp),%eax
+  800716:	8d 40 04             	lea    0x4(%eax),%eax
+  800719:	89 45 14             	mov    %eax,0x14(%ebp)
+  80071c:	eb b4                	jmp    8006d2 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  80071e:	83 f9 01             	cmp    $0x1,%ecx
+  800721:	7f 1b                	jg     80073e <vprintfmt+0x30e>
+	else if (lflag)
+  800723:	85 c9                	test   %ecx,%ecx
+  800725:	74 2c                	je     800753 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800727:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072a:	8b 10                	mov    (%eax),%edx
+  80072c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800731:	8d 40 04             	lea    0x4(%eax),%eax
+  800734:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800737:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80073c:	eb 60                	jmp    80079e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80073e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800741:	8b 10                	mov    (%eax),%edx
+  800743:	8b 48 04             	mov    0x4(%eax),%ecx
+  800746:	8d 40 08             	lea    0x8(%eax),%eax
+  800749:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80074c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800751:	eb 4b                	jmp    80079e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800753:	8b 45 14             	mov    0x14(%ebp),%eax
+  800756:	8b 10                	mov    (%eax),%edx
+  800758:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80075d:	8d 40 04             	lea    0x4(%eax),%eax
+  800760:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800763:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800768:	eb 34                	jmp    80079e <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80076a:	83 f9 01             	cmp    $0x1,%ecx
+  80076d:	7f 15                	jg     800784 <vprintfmt+0x354>
+	else if (lflag)
+  80076f:	85 c9                	test   %ecx,%ecx
+  800771:	74 4d                	je     8007c0 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800773:	8b 45 14             	mov    0x14(%ebp),%eax
+  800776:	8b 00                	mov    (%eax),%eax
+  800778:	99                   	cltd
+  800779:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80077c:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80077f:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800782:	eb 11                	jmp    800795 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800784:	8b 45 14             	mov    0x14(%ebp),%eax
+  800787:	8b 50 04             	mov    0x4(%eax),%edx
+  80078a:	8b 00                	mov    (%eax),%eax
+  80078c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80078f:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800792:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800795:	89 d1                	mov    %edx,%ecx
+  800797:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800799:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80079e:	83 ec 0c             	sub    $0xc,%esp
+  8007a1:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007a5:	50                   	push   %eax
+  8007a6:	ff 75 e0             	push   -0x20(%ebp)
+  8007a9:	57                   	push   %edi
+  8007aa:	51                   	push   %ecx
+  8007ab:	52                   	push   %edx
+  8007ac:	89 da                	mov    %ebx,%edx
+  8007ae:	89 f0                	mov    %esi,%eax
+  8007b0:	e8 98 fb ff ff       	call   80034d <printnum>
+			break;
+  8007b5:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007b8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007bb:	e9 8e fc ff ff       	jmp    80044e <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  8007c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c3:	8b 00                	mov    (%eax),%eax
+  8007c5:	99                   	cltd
+  8007c6:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8007c9:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8007cc:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8007cf:	eb c4                	jmp    800795 <vprintfmt+0x365>
+			putch('0', putdat);
+  8007d1:	83 ec 08             	sub    $0x8,%esp
+  8007d4:	53                   	push   %ebx
+  8007d5:	6a 30                	push   $0x30
+  8007d7:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007d9:	83 c4 08             	add    $0x8,%esp
+  8007dc:	53                   	push   %ebx
+  8007dd:	6a 78                	push   $0x78
+  8007df:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e4:	8b 10                	mov    (%eax),%edx
+  8007e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007eb:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f4:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8007f9:	eb a3                	jmp    80079e <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8007fb:	83 f9 01             	cmp    $0x1,%ecx
+  8007fe:	7f 1b                	jg     80081b <vprintfmt+0x3eb>
+	else if (lflag)
+  800800:	85 c9                	test   %ecx,%ecx
+  800802:	74 2f                	je     800833 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800804:	8b 45 14             	mov    0x14(%ebp),%eax
+  800807:	8b 10                	mov    (%eax),%edx
+  800809:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80080e:	8d 40 04             	lea    0x4(%eax),%eax
+  800811:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800814:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800819:	eb 83                	jmp    80079e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80081b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081e:	8b 10                	mov    (%eax),%edx
+  800820:	8b 48 04             	mov    0x4(%eax),%ecx
+  800823:	8d 40 08             	lea    0x8(%eax),%eax
+  800826:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800829:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80082e:	e9 6b ff ff ff       	jmp    80079e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800833:	8b 45 14             	mov    0x14(%ebp),%eax
+  800836:	8b 10                	mov    (%eax),%edx
+  800838:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80083d:	8d 40 04             	lea    0x4(%eax),%eax
+  800840:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800843:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800848:	e9 51 ff ff ff       	jmp    80079e <vprintfmt+0x36e>
+			putch(ch, putdat);
+  80084d:	83 ec 08             	sub    $0x8,%esp
+  800850:	53                   	push   %ebx
+  800851:	6a 25                	push   $0x25
+  800853:	ff d6                	call   *%esi
+			break;
+  800855:	83 c4 10             	add    $0x10,%esp
+  800858:	e9 5b ff ff ff       	jmp    8007b8 <vprintfmt+0x388>
+			putch('%', putdat);
+  80085d:	83 ec 08             	sub    $0x8,%esp
+  800860:	53                   	push   %ebx
+  800861:	6a 25                	push   $0x25
+  800863:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800865:	83 c4 10             	add    $0x10,%esp
+  800868:	89 f8                	mov    %edi,%eax
+  80086a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80086e:	74 05                	je     800875 <vprintfmt+0x445>
+  800870:	83 e8 01             	sub    $0x1,%eax
+  800873:	eb f5                	jmp    80086a <vprintfmt+0x43a>
+  800875:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800878:	e9 3b ff ff ff       	jmp    8007b8 <vprintfmt+0x388>
+
+0080087d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80087d:	55                   	push   %ebp
+  80087e:	89 e5                	mov    %esp,%ebp
+  800880:	83 ec 18             	sub    $0x18,%esp
+  800883:	8b 45 08             	mov    0x8(%ebp),%eax
+  800886:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800889:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80088c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800890:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800893:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80089a:	85 c0                	test   %eax,%eax
+  80089c:	74 26                	je     8008c4 <vsnprintf+0x47>
+  80089e:	85 d2                	test   %edx,%edx
+  8008a0:	7e 22                	jle    8008c4 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008a2:	ff 75 14             	push   0x14(%ebp)
+  8008a5:	ff 75 10             	push   0x10(%ebp)
+  8008a8:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008ab:	50                   	push   %eax
+  8008ac:	68 f6 03 80 00       	push   $0x8003f6
+  8008b1:	e8 7a fb ff ff       	call   800430 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008b6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008b9:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008bf:	83 c4 10             	add    $0x10,%esp
+}
+  8008c2:	c9                   	leave
+  8008c3:	c3                   	ret
+		return -E_INVAL;
+  8008c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008c9:	eb f7                	jmp    8008c2 <vsnprintf+0x45>
+
+008008cb <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008cb:	55                   	push   %ebp
+  8008cc:	89 e5                	mov    %esp,%ebp
+  8008ce:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008d1:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008d4:	50                   	push   %eax
+  8008d5:	ff 75 10             	push   0x10(%ebp)
+  8008d8:	ff 75 0c             	push   0xc(%ebp)
+  8008db:	ff 75 08             	push   0x8(%ebp)
+  8008de:	e8 9a ff ff ff       	call   80087d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008e3:	c9                   	leave
+  8008e4:	c3                   	ret
+
+008008e5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008e5:	55                   	push   %ebp
+  8008e6:	89 e5                	mov    %esp,%ebp
+  8008e8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f0:	eb 03                	jmp    8008f5 <strlen+0x10>
+		n++;
+  8008f2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008f5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008f9:	75 f7                	jne    8008f2 <strlen+0xd>
+	return n;
+}
+  8008fb:	5d                   	pop    %ebp
+  8008fc:	c3                   	ret
+
+008008fd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008fd:	55                   	push   %ebp
+  8008fe:	89 e5                	mov    %esp,%ebp
+  800900:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800903:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800906:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090b:	eb 03                	jmp    800910 <strnlen+0x13>
+		n++;
+  80090d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800910:	39 d0                	cmp    %edx,%eax
+  800912:	74 08                	je     80091c <strnlen+0x1f>
+  800914:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800918:	75 f3                	jne    80090d <strnlen+0x10>
+  80091a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80091c:	89 d0                	mov    %edx,%eax
+  80091e:	5d                   	pop    %ebp
+  80091f:	c3                   	ret
+
+00800920 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800920:	55                   	push   %ebp
+  800921:	89 e5                	mov    %esp,%ebp
+  800923:	53                   	push   %ebx
+  800924:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800927:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80092a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800933:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800936:	83 c0 01             	add    $0x1,%eax
+  800939:	84 d2                	test   %dl,%dl
+  80093b:	75 f2                	jne    80092f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80093d:	89 c8                	mov    %ecx,%eax
+  80093f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800942:	c9                   	leave
+  800943:	c3                   	ret
+
+00800944 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800944:	55                   	push   %ebp
+  800945:	89 e5                	mov    %esp,%ebp
+  800947:	53                   	push   %ebx
+  800948:	83 ec 10             	sub    $0x10,%esp
+  80094b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80094e:	53                   	push   %ebx
+  80094f:	e8 91 ff ff ff       	call   8008e5 <strlen>
+  800954:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800957:	ff 75 0c             	push   0xc(%ebp)
+  80095a:	01 d8                	add    %ebx,%eax
+  80095c:	50                   	push   %eax
+  80095d:	e8 be ff ff ff       	call   800920 <strcpy>
+	return dst;
+}
+  800962:	89 d8                	mov    %ebx,%eax
+  800964:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800967:	c9                   	leave
+  800968:	c3                   	ret
+
+00800969 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800969:	55                   	push   %ebp
+  80096a:	89 e5                	mov    %esp,%ebp
+  80096c:	56                   	push   %esi
+  80096d:	53                   	push   %ebx
+  80096e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800971:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800974:	89 f3                	mov    %esi,%ebx
+  800976:	03 5d 10             	add    0x10(%ebp),%ebx
+  800979:	89 f0                	mov    %esi,%eax
+  80097b:	eb 0f                	jmp    80098c <strncpy+0x23>
+		*dst++ = *src;
+  80097d:	83 c0 01             	add    $0x1,%eax
+  800980:	0f b6 0a             	movzbl (%edx),%ecx
+  800983:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800986:	80 f9 01             	cmp    $0x1,%cl
+  800989:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80098c:	39 d8                	cmp    %ebx,%eax
+  80098e:	75 ed                	jne    80097d <strncpy+0x14>
+	}
+	return ret;
+}
+  800990:	89 f0                	mov    %esi,%eax
+  800992:	5b                   	pop    %ebx
+  800993:	5e                   	pop    %esi
+  800994:	5d                   	pop    %ebp
+  800995:	c3                   	ret
+
+00800996 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800996:	55                   	push   %ebp
+  800997:	89 e5                	mov    %esp,%ebp
+  800999:	56                   	push   %esi
+  80099a:	53                   	push   %ebx
+  80099b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80099e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009a1:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009a4:	89 f0                	mov    %esi,%eax
+  8009a6:	85 d2                	test   %edx,%edx
+  8009a8:	74 21                	je     8009cb <strlcpy+0x35>
+  8009aa:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009ae:	89 f2                	mov    %esi,%edx
+  8009b0:	eb 09                	jmp    8009bb <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009b2:	83 c1 01             	add    $0x1,%ecx
+  8009b5:	83 c2 01             	add    $0x1,%edx
+  8009b8:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009bb:	39 c2                	cmp    %eax,%edx
+  8009bd:	74 09                	je     8009c8 <strlcpy+0x32>
+  8009bf:	0f b6 19             	movzbl (%ecx),%ebx
+  8009c2:	84 db                	test   %bl,%bl
+  8009c4:	75 ec                	jne    8009b2 <strlcpy+0x1c>
+  8009c6:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009c8:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009cb:	29 f0                	sub    %esi,%eax
+}
+  8009cd:	5b                   	pop    %ebx
+  8009ce:	5e                   	pop    %esi
+  8009cf:	5d                   	pop    %ebp
+  8009d0:	c3                   	ret
+
+008009d1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009da:	eb 06                	jmp    8009e2 <strcmp+0x11>
+		p++, q++;
+  8009dc:	83 c1 01             	add    $0x1,%ecx
+  8009df:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009e2:	0f b6 01             	movzbl (%ecx),%eax
+  8009e5:	84 c0                	test   %al,%al
+  8009e7:	74 04                	je     8009ed <strcmp+0x1c>
+  8009e9:	3a 02                	cmp    (%edx),%al
+  8009eb:	74 ef                	je     8009dc <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009ed:	0f b6 c0             	movzbl %al,%eax
+  8009f0:	0f b6 12             	movzbl (%edx),%edx
+  8009f3:	29 d0                	sub    %edx,%eax
+}
+  8009f5:	5d                   	pop    %ebp
+  8009f6:	c3                   	ret
+
+008009f7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009f7:	55                   	push   %ebp
+  8009f8:	89 e5                	mov    %esp,%ebp
+  8009fa:	53                   	push   %ebx
+  8009fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a01:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a04:	eb 09                	jmp    800a0f <strncmp+0x18>
+		n--, p++, q++;
+  800a06:	83 ea 01             	sub    $0x1,%edx
+  800a09:	83 c0 01             	add    $0x1,%eax
+  800a0c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a0f:	85 d2                	test   %edx,%edx
+  800a11:	74 18                	je     800a2b <strncmp+0x34>
+  800a13:	0f b6 18             	movzbl (%eax),%ebx
+  800a16:	84 db                	test   %bl,%bl
+  800a18:	74 04                	je     800a1e <strncmp+0x27>
+  800a1a:	3a 19                	cmp    (%ecx),%bl
+  800a1c:	74 e8                	je     800a06 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a1e:	0f b6 00             	movzbl (%eax),%eax
+  800a21:	0f b6 11             	movzbl (%ecx),%edx
+  800a24:	29 d0                	sub    %edx,%eax
+}
+  800a26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a29:	c9                   	leave
+  800a2a:	c3                   	ret
+		return 0;
+  800a2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a30:	eb f4                	jmp    800a26 <strncmp+0x2f>
+
+00800a32 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a32:	55                   	push   %ebp
+  800a33:	89 e5                	mov    %esp,%ebp
+  800a35:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a38:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a3c:	eb 03                	jmp    800a41 <strchr+0xf>
+  800a3e:	83 c0 01             	add    $0x1,%eax
+  800a41:	0f b6 10             	movzbl (%eax),%edx
+  800a44:	84 d2                	test   %dl,%dl
+  800a46:	74 06                	je     800a4e <strchr+0x1c>
+		if (*s == c)
+  800a48:	38 ca                	cmp    %cl,%dl
+  800a4a:	75 f2                	jne    800a3e <strchr+0xc>
+  800a4c:	eb 05                	jmp    800a53 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a53:	5d                   	pop    %ebp
+  800a54:	c3                   	ret
+
+00800a55 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a55:	55                   	push   %ebp
+  800a56:	89 e5                	mov    %esp,%ebp
+  800a58:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a5f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a62:	38 ca                	cmp    %cl,%dl
+  800a64:	74 09                	je     800a6f <strfind+0x1a>
+  800a66:	84 d2                	test   %dl,%dl
+  800a68:	74 05                	je     800a6f <strfind+0x1a>
+	for (; *s; s++)
+  800a6a:	83 c0 01             	add    $0x1,%eax
+  800a6d:	eb f0                	jmp    800a5f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a6f:	5d                   	pop    %ebp
+  800a70:	c3                   	ret
+
+00800a71 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a71:	55                   	push   %ebp
+  800a72:	89 e5                	mov    %esp,%ebp
+  800a74:	57                   	push   %edi
+  800a75:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a78:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a7b:	85 c9                	test   %ecx,%ecx
+  800a7d:	74 20                	je     800a9f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a7f:	89 f8                	mov    %edi,%eax
+  800a81:	09 c8                	or     %ecx,%eax
+  800a83:	a8 03                	test   $0x3,%al
+  800a85:	75 12                	jne    800a99 <memset+0x28>
+		c &= 0xFF;
+  800a87:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a8b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a91:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a94:	fc                   	cld
+  800a95:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a97:	eb 06                	jmp    800a9f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a99:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a9c:	fc                   	cld
+  800a9d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a9f:	89 f8                	mov    %edi,%eax
+  800aa1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800aa4:	c9                   	leave
+  800aa5:	c3                   	ret
+
+00800aa6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800aa6:	55                   	push   %ebp
+  800aa7:	89 e5                	mov    %esp,%ebp
+  800aa9:	57                   	push   %edi
+  800aaa:	56                   	push   %esi
+  800aab:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aae:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ab1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ab4:	39 c6                	cmp    %eax,%esi
+  800ab6:	73 32                	jae    800aea <memmove+0x44>
+  800ab8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800abb:	39 d0                	cmp    %edx,%eax
+  800abd:	73 2b                	jae    800aea <memmove+0x44>
+		s += n;
+		d += n;
+  800abf:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ac2:	89 d6                	mov    %edx,%esi
+  800ac4:	09 fe                	or     %edi,%esi
+  800ac6:	09 ce                	or     %ecx,%esi
+  800ac8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ace:	75 0e                	jne    800ade <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ad0:	83 ef 04             	sub    $0x4,%edi
+  800ad3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ad6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ad9:	fd                   	std
+  800ada:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800adc:	eb 09                	jmp    800ae7 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ade:	83 ef 01             	sub    $0x1,%edi
+  800ae1:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ae4:	fd                   	std
+  800ae5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ae7:	fc                   	cld
+  800ae8:	eb 1a                	jmp    800b04 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aea:	89 f2                	mov    %esi,%edx
+  800aec:	09 c2                	or     %eax,%edx
+  800aee:	09 ca                	or     %ecx,%edx
+  800af0:	f6 c2 03             	test   $0x3,%dl
+  800af3:	75 0a                	jne    800aff <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800af5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800af8:	89 c7                	mov    %eax,%edi
+  800afa:	fc                   	cld
+  800afb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800afd:	eb 05                	jmp    800b04 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800aff:	89 c7                	mov    %eax,%edi
+  800b01:	fc                   	cld
+  800b02:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b04:	5e                   	pop    %esi
+  800b05:	5f                   	pop    %edi
+  800b06:	5d                   	pop    %ebp
+  800b07:	c3                   	ret
+
+00800b08 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b08:	55                   	push   %ebp
+  800b09:	89 e5                	mov    %esp,%ebp
+  800b0b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b0e:	ff 75 10             	push   0x10(%ebp)
+  800b11:	ff 75 0c             	push   0xc(%ebp)
+  800b14:	ff 75 08             	push   0x8(%ebp)
+  800b17:	e8 8a ff ff ff       	call   800aa6 <memmove>
+}
+  800b1c:	c9                   	leave
+  800b1d:	c3                   	ret
+
+00800b1e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b1e:	55                   	push   %ebp
+  800b1f:	89 e5                	mov    %esp,%ebp
+  800b21:	56                   	push   %esi
+  800b22:	53                   	push   %ebx
+  800b23:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b26:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b29:	89 c6                	mov    %eax,%esi
+  800b2b:	03 75 10             	add    0x10(%ebp),%esi
+  800b2e:	eb 06                	jmp    800b36 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b30:	83 c0 01             	add    $0x1,%eax
+  800b33:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b36:	39 f0                	cmp    %esi,%eax
+  800b38:	74 14                	je     800b4e <memcmp+0x30>
+		if (*s1 != *s2)
+  800b3a:	0f b6 08             	movzbl (%eax),%ecx
+  800b3d:	0f b6 1a             	movzbl (%edx),%ebx
+  800b40:	38 d9                	cmp    %bl,%cl
+  800b42:	74 ec                	je     800b30 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b44:	0f b6 c1             	movzbl %cl,%eax
+  800b47:	0f b6 db             	movzbl %bl,%ebx
+  800b4a:	29 d8                	sub    %ebx,%eax
+  800b4c:	eb 05                	jmp    800b53 <memcmp+0x35>
+	}
+
+	return 0;
+  800b4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b53:	5b                   	pop    %ebx
+  800b54:	5e                   	pop    %esi
+  800b55:	5d                   	pop    %ebp
+  800b56:	c3                   	ret
+
+00800b57 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b57:	55                   	push   %ebp
+  800b58:	89 e5                	mov    %esp,%ebp
+  800b5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b60:	89 c2                	mov    %eax,%edx
+  800b62:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b65:	eb 03                	jmp    800b6a <memfind+0x13>
+  800b67:	83 c0 01             	add    $0x1,%eax
+  800b6a:	39 d0                	cmp    %edx,%eax
+  800b6c:	73 04                	jae    800b72 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b6e:	38 08                	cmp    %cl,(%eax)
+  800b70:	75 f5                	jne    800b67 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b72:	5d                   	pop    %ebp
+  800b73:	c3                   	ret
+
+00800b74 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b74:	55                   	push   %ebp
+  800b75:	89 e5                	mov    %esp,%ebp
+  800b77:	57                   	push   %edi
+  800b78:	56                   	push   %esi
+  800b79:	53                   	push   %ebx
+  800b7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b7d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b80:	eb 03                	jmp    800b85 <strtol+0x11>
+		s++;
+  800b82:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b85:	0f b6 02             	movzbl (%edx),%eax
+  800b88:	3c 20                	cmp    $0x20,%al
+  800b8a:	74 f6                	je     800b82 <strtol+0xe>
+  800b8c:	3c 09                	cmp    $0x9,%al
+  800b8e:	74 f2                	je     800b82 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b90:	3c 2b                	cmp    $0x2b,%al
+  800b92:	74 2a                	je     800bbe <strtol+0x4a>
+	int neg = 0;
+  800b94:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b99:	3c 2d                	cmp    $0x2d,%al
+  800b9b:	74 2b                	je     800bc8 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b9d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ba3:	75 0f                	jne    800bb4 <strtol+0x40>
+  800ba5:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ba8:	74 28                	je     800bd2 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800baa:	85 db                	test   %ebx,%ebx
+  800bac:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bb1:	0f 44 d8             	cmove  %eax,%ebx
+  800bb4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bb9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bbc:	eb 46                	jmp    800c04 <strtol+0x90>
+		s++;
+  800bbe:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bc6:	eb d5                	jmp    800b9d <strtol+0x29>
+		s++, neg = 1;
+  800bc8:	83 c2 01             	add    $0x1,%edx
+  800bcb:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bd0:	eb cb                	jmp    800b9d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bd2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bd6:	74 0e                	je     800be6 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800bd8:	85 db                	test   %ebx,%ebx
+  800bda:	75 d8                	jne    800bb4 <strtol+0x40>
+		s++, base = 8;
+  800bdc:	83 c2 01             	add    $0x1,%edx
+  800bdf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800be4:	eb ce                	jmp    800bb4 <strtol+0x40>
+		s += 2, base = 16;
+  800be6:	83 c2 02             	add    $0x2,%edx
+  800be9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bee:	eb c4                	jmp    800bb4 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bf0:	0f be c0             	movsbl %al,%eax
+  800bf3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bf6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bf9:	7d 3a                	jge    800c35 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bfb:	83 c2 01             	add    $0x1,%edx
+  800bfe:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c02:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c04:	0f b6 02             	movzbl (%edx),%eax
+  800c07:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c0a:	89 f3                	mov    %esi,%ebx
+  800c0c:	80 fb 09             	cmp    $0x9,%bl
+  800c0f:	76 df                	jbe    800bf0 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c11:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c14:	89 f3                	mov    %esi,%ebx
+  800c16:	80 fb 19             	cmp    $0x19,%bl
+  800c19:	77 08                	ja     800c23 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c1b:	0f be c0             	movsbl %al,%eax
+  800c1e:	83 e8 57             	sub    $0x57,%eax
+  800c21:	eb d3                	jmp    800bf6 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c23:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c26:	89 f3                	mov    %esi,%ebx
+  800c28:	80 fb 19             	cmp    $0x19,%bl
+  800c2b:	77 08                	ja     800c35 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c2d:	0f be c0             	movsbl %al,%eax
+  800c30:	83 e8 37             	sub    $0x37,%eax
+  800c33:	eb c1                	jmp    800bf6 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c35:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c39:	74 05                	je     800c40 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c3b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c3e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c40:	89 c8                	mov    %ecx,%eax
+  800c42:	f7 d8                	neg    %eax
+  800c44:	85 ff                	test   %edi,%edi
+  800c46:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c49:	89 c8                	mov    %ecx,%eax
+  800c4b:	5b                   	pop    %ebx
+  800c4c:	5e                   	pop    %esi
+  800c4d:	5f                   	pop    %edi
+  800c4e:	5d                   	pop    %ebp
+  800c4f:	c3                   	ret
+
+00800c50 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800c50:	55                   	push   %ebp
+  800c51:	89 e5                	mov    %esp,%ebp
+  800c53:	57                   	push   %edi
+  800c54:	56                   	push   %esi
+  800c55:	53                   	push   %ebx
+  800c56:	83 ec 0c             	sub    $0xc,%esp
+  800c59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800c5c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c5f:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800c62:	85 ff                	test   %edi,%edi
+  800c64:	74 16                	je     800c7c <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800c66:	83 ec 04             	sub    $0x4,%esp
+  800c69:	56                   	push   %esi
+  800c6a:	6a 00                	push   $0x0
+  800c6c:	53                   	push   %ebx
+  800c6d:	e8 02 ff ff ff       	call   800b74 <strtol>
+  800c72:	89 07                	mov    %eax,(%edi)
+  800c74:	83 c4 10             	add    $0x10,%esp
+  800c77:	eb 03                	jmp    800c7c <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800c79:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800c7c:	0f b6 03             	movzbl (%ebx),%eax
+  800c7f:	3c 20                	cmp    $0x20,%al
+  800c81:	74 f6                	je     800c79 <strisl+0x29>
+  800c83:	3c 09                	cmp    $0x9,%al
+  800c85:	74 f2                	je     800c79 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c87:	3c 2b                	cmp    $0x2b,%al
+  800c89:	74 23                	je     800cae <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800c8b:	3c 2d                	cmp    $0x2d,%al
+  800c8d:	0f 94 c0             	sete   %al
+  800c90:	0f b6 c0             	movzbl %al,%eax
+  800c93:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c95:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800c9b:	75 41                	jne    800cde <strisl+0x8e>
+  800c9d:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800ca0:	74 11                	je     800cb3 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ca2:	85 f6                	test   %esi,%esi
+  800ca4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ca9:	0f 44 f0             	cmove  %eax,%esi
+  800cac:	eb 30                	jmp    800cde <strisl+0x8e>
+		s++;
+  800cae:	83 c3 01             	add    $0x1,%ebx
+  800cb1:	eb e2                	jmp    800c95 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cb3:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800cb7:	74 0e                	je     800cc7 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800cb9:	85 f6                	test   %esi,%esi
+  800cbb:	75 21                	jne    800cde <strisl+0x8e>
+		s++, base = 8;
+  800cbd:	83 c3 01             	add    $0x1,%ebx
+  800cc0:	be 08 00 00 00       	mov    $0x8,%esi
+  800cc5:	eb 17                	jmp    800cde <strisl+0x8e>
+		s += 2, base = 16;
+  800cc7:	83 c3 02             	add    $0x2,%ebx
+  800cca:	be 10 00 00 00       	mov    $0x10,%esi
+  800ccf:	eb 0d                	jmp    800cde <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800cd1:	0f be c0             	movsbl %al,%eax
+  800cd4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800cd7:	39 f0                	cmp    %esi,%eax
+  800cd9:	7d 38                	jge    800d13 <strisl+0xc3>
+			return 0;
+		s++;
+  800cdb:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800cde:	0f b6 03             	movzbl (%ebx),%eax
+  800ce1:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800ce4:	80 fa 09             	cmp    $0x9,%dl
+  800ce7:	76 e8                	jbe    800cd1 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800ce9:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800cec:	80 fa 19             	cmp    $0x19,%dl
+  800cef:	77 08                	ja     800cf9 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800cf1:	0f be c0             	movsbl %al,%eax
+  800cf4:	83 e8 57             	sub    $0x57,%eax
+  800cf7:	eb de                	jmp    800cd7 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cf9:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800cfc:	80 fa 19             	cmp    $0x19,%dl
+  800cff:	77 08                	ja     800d09 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800d01:	0f be c0             	movsbl %al,%eax
+  800d04:	83 e8 37             	sub    $0x37,%eax
+  800d07:	eb ce                	jmp    800cd7 <strisl+0x87>
+		else if (!*s)
+  800d09:	84 c0                	test   %al,%al
+  800d0b:	0f 94 c0             	sete   %al
+  800d0e:	0f b6 c0             	movzbl %al,%eax
+  800d11:	eb 05                	jmp    800d18 <strisl+0xc8>
+			return 0;
+  800d13:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800d18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1b:	5b                   	pop    %ebx
+  800d1c:	5e                   	pop    %esi
+  800d1d:	5f                   	pop    %edi
+  800d1e:	5d                   	pop    %ebp
+  800d1f:	c3                   	ret
+
+00800d20 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800d20:	55                   	push   %ebp
+  800d21:	89 e5                	mov    %esp,%ebp
+  800d23:	83 ec 10             	sub    $0x10,%esp
+  800d26:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800d29:	89 c8                	mov    %ecx,%eax
+  800d2b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800d30:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800d33:	eb 0b                	jmp    800d40 <touch_mem+0x20>
+		c = *(char *)page;
+  800d35:	0f b6 10             	movzbl (%eax),%edx
+  800d38:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800d3b:	05 00 10 00 00       	add    $0x1000,%eax
+  800d40:	39 c8                	cmp    %ecx,%eax
+  800d42:	72 f1                	jb     800d35 <touch_mem+0x15>
+}
+  800d44:	c9                   	leave
+  800d45:	c3                   	ret
+
+00800d46 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d46:	55                   	push   %ebp
+  800d47:	89 e5                	mov    %esp,%ebp
+  800d49:	57                   	push   %edi
+  800d4a:	56                   	push   %esi
+  800d4b:	53                   	push   %ebx
+	touch_mem(s, len);
+  800d4c:	ff 75 0c             	push   0xc(%ebp)
+  800d4f:	ff 75 08             	push   0x8(%ebp)
+  800d52:	e8 c9 ff ff ff       	call   800d20 <touch_mem>
+	asm volatile("int %1\n"
+  800d57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d62:	89 c3                	mov    %eax,%ebx
+  800d64:	89 c7                	mov    %eax,%edi
+  800d66:	89 c6                	mov    %eax,%esi
+  800d68:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d6a:	83 c4 08             	add    $0x8,%esp
+  800d6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d70:	5b                   	pop    %ebx
+  800d71:	5e                   	pop    %esi
+  800d72:	5f                   	pop    %edi
+  800d73:	5d                   	pop    %ebp
+  800d74:	c3                   	ret
+
+00800d75 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	57                   	push   %edi
+  800d79:	56                   	push   %esi
+  800d7a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d80:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d85:	89 d1                	mov    %edx,%ecx
+  800d87:	89 d3                	mov    %edx,%ebx
+  800d89:	89 d7                	mov    %edx,%edi
+  800d8b:	89 d6                	mov    %edx,%esi
+  800d8d:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d8f:	5b                   	pop    %ebx
+  800d90:	5e                   	pop    %esi
+  800d91:	5f                   	pop    %edi
+  800d92:	5d                   	pop    %ebp
+  800d93:	c3                   	ret
+
+00800d94 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d94:	55                   	push   %ebp
+  800d95:	89 e5                	mov    %esp,%ebp
+  800d97:	57                   	push   %edi
+  800d98:	56                   	push   %esi
+  800d99:	53                   	push   %ebx
+  800d9a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800da2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800daa:	89 cb                	mov    %ecx,%ebx
+  800dac:	89 cf                	mov    %ecx,%edi
+  800dae:	89 ce                	mov    %ecx,%esi
+  800db0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800db2:	85 c0                	test   %eax,%eax
+  800db4:	7f 08                	jg     800dbe <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800db6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db9:	5b                   	pop    %ebx
+  800dba:	5e                   	pop    %esi
+  800dbb:	5f                   	pop    %edi
+  800dbc:	5d                   	pop    %ebp
+  800dbd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dbe:	83 ec 0c             	sub    $0xc,%esp
+  800dc1:	50                   	push   %eax
+  800dc2:	6a 03                	push   $0x3
+  800dc4:	68 6b 59 80 00       	push   $0x80596b
+  800dc9:	6a 23                	push   $0x23
+  800dcb:	68 88 59 80 00       	push   $0x805988
+  800dd0:	e8 89 f4 ff ff       	call   80025e <_panic>
+
+00800dd5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800dd5:	55                   	push   %ebp
+  800dd6:	89 e5                	mov    %esp,%ebp
+  800dd8:	57                   	push   %edi
+  800dd9:	56                   	push   %esi
+  800dda:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ddb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de0:	b8 02 00 00 00       	mov    $0x2,%eax
+  800de5:	89 d1                	mov    %edx,%ecx
+  800de7:	89 d3                	mov    %edx,%ebx
+  800de9:	89 d7                	mov    %edx,%edi
+  800deb:	89 d6                	mov    %edx,%esi
+  800ded:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800def:	5b                   	pop    %ebx
+  800df0:	5e                   	pop    %esi
+  800df1:	5f                   	pop    %edi
+  800df2:	5d                   	pop    %ebp
+  800df3:	c3                   	ret
+
+00800df4 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	57                   	push   %edi
+  800df8:	56                   	push   %esi
+  800df9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dff:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e04:	89 d1                	mov    %edx,%ecx
+  800e06:	89 d3                	mov    %edx,%ebx
+  800e08:	89 d7                	mov    %edx,%edi
+  800e0a:	89 d6                	mov    %edx,%esi
+  800e0c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e0e:	5b                   	pop    %ebx
+  800e0f:	5e                   	pop    %esi
+  800e10:	5f                   	pop    %edi
+  800e11:	5d                   	pop    %ebp
+  800e12:	c3                   	ret
+
+00800e13 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	57                   	push   %edi
+  800e17:	56                   	push   %esi
+  800e18:	53                   	push   %ebx
+  800e19:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e1c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e27:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e2c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e2f:	89 f7                	mov    %esi,%edi
+  800e31:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e33:	85 c0                	test   %eax,%eax
+  800e35:	7f 08                	jg     800e3f <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e3a:	5b                   	pop    %ebx
+  800e3b:	5e                   	pop    %esi
+  800e3c:	5f                   	pop    %edi
+  800e3d:	5d                   	pop    %ebp
+  800e3e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e3f:	83 ec 0c             	sub    $0xc,%esp
+  800e42:	50                   	push   %eax
+  800e43:	6a 04                	push   $0x4
+  800e45:	68 6b 59 80 00       	push   $0x80596b
+  800e4a:	6a 23                	push   $0x23
+  800e4c:	68 88 59 80 00       	push   $0x805988
+  800e51:	e8 08 f4 ff ff       	call   80025e <_panic>
+
+00800e56 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e56:	55                   	push   %ebp
+  800e57:	89 e5                	mov    %esp,%ebp
+  800e59:	57                   	push   %edi
+  800e5a:	56                   	push   %esi
+  800e5b:	53                   	push   %ebx
+  800e5c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e65:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e6d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e70:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e73:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e75:	85 c0                	test   %eax,%eax
+  800e77:	7f 08                	jg     800e81 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7c:	5b                   	pop    %ebx
+  800e7d:	5e                   	pop    %esi
+  800e7e:	5f                   	pop    %edi
+  800e7f:	5d                   	pop    %ebp
+  800e80:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e81:	83 ec 0c             	sub    $0xc,%esp
+  800e84:	50                   	push   %eax
+  800e85:	6a 05                	push   $0x5
+  800e87:	68 6b 59 80 00       	push   $0x80596b
+  800e8c:	6a 23                	push   $0x23
+  800e8e:	68 88 59 80 00       	push   $0x805988
+  800e93:	e8 c6 f3 ff ff       	call   80025e <_panic>
+
+00800e98 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e98:	55                   	push   %ebp
+  800e99:	89 e5                	mov    %esp,%ebp
+  800e9b:	57                   	push   %edi
+  800e9c:	56                   	push   %esi
+  800e9d:	53                   	push   %ebx
+  800e9e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ea1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eac:	b8 06 00 00 00       	mov    $0x6,%eax
+  800eb1:	89 df                	mov    %ebx,%edi
+  800eb3:	89 de                	mov    %ebx,%esi
+  800eb5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb7:	85 c0                	test   %eax,%eax
+  800eb9:	7f 08                	jg     800ec3 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ebb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ebe:	5b                   	pop    %ebx
+  800ebf:	5e                   	pop    %esi
+  800ec0:	5f                   	pop    %edi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec3:	83 ec 0c             	sub    $0xc,%esp
+  800ec6:	50                   	push   %eax
+  800ec7:	6a 06                	push   $0x6
+  800ec9:	68 6b 59 80 00       	push   $0x80596b
+  800ece:	6a 23                	push   $0x23
+  800ed0:	68 88 59 80 00       	push   $0x805988
+  800ed5:	e8 84 f3 ff ff       	call   80025e <_panic>
+
+00800eda <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800eda:	55                   	push   %ebp
+  800edb:	89 e5                	mov    %esp,%ebp
+  800edd:	57                   	push   %edi
+  800ede:	56                   	push   %esi
+  800edf:	53                   	push   %ebx
+  800ee0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ee3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eeb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eee:	b8 18 00 00 00       	mov    $0x18,%eax
+  800ef3:	89 df                	mov    %ebx,%edi
+  800ef5:	89 de                	mov    %ebx,%esi
+  800ef7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef9:	85 c0                	test   %eax,%eax
+  800efb:	7f 08                	jg     800f05 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800efd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f00:	5b                   	pop    %ebx
+  800f01:	5e                   	pop    %esi
+  800f02:	5f                   	pop    %edi
+  800f03:	5d                   	pop    %ebp
+  800f04:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f05:	83 ec 0c             	sub    $0xc,%esp
+  800f08:	50                   	push   %eax
+  800f09:	6a 18                	push   $0x18
+  800f0b:	68 6b 59 80 00       	push   $0x80596b
+  800f10:	6a 23                	push   $0x23
+  800f12:	68 88 59 80 00       	push   $0x805988
+  800f17:	e8 42 f3 ff ff       	call   80025e <_panic>
+
+00800f1c <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800f1c:	55                   	push   %ebp
+  800f1d:	89 e5                	mov    %esp,%ebp
+  800f1f:	57                   	push   %edi
+  800f20:	56                   	push   %esi
+  800f21:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f22:	be 00 00 00 00       	mov    $0x0,%esi
+  800f27:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2d:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f35:	89 f7                	mov    %esi,%edi
+  800f37:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800f39:	5b                   	pop    %ebx
+  800f3a:	5e                   	pop    %esi
+  800f3b:	5f                   	pop    %edi
+  800f3c:	5d                   	pop    %ebp
+  800f3d:	c3                   	ret
+
+00800f3e <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800f3e:	55                   	push   %ebp
+  800f3f:	89 e5                	mov    %esp,%ebp
+  800f41:	57                   	push   %edi
+  800f42:	56                   	push   %esi
+  800f43:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f4f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f57:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f5a:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800f5c:	5b                   	pop    %ebx
+  800f5d:	5e                   	pop    %esi
+  800f5e:	5f                   	pop    %edi
+  800f5f:	5d                   	pop    %ebp
+  800f60:	c3                   	ret
+
+00800f61 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800f61:	55                   	push   %ebp
+  800f62:	89 e5                	mov    %esp,%ebp
+  800f64:	57                   	push   %edi
+  800f65:	56                   	push   %esi
+  800f66:	53                   	push   %ebx
+  800f67:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800f6a:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800f6d:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800f73:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800f76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f84:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f87:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f89:	85 c0                	test   %eax,%eax
+  800f8b:	7f 08                	jg     800f95 <sys_page_map_range+0x34>
+}
+  800f8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f90:	5b                   	pop    %ebx
+  800f91:	5e                   	pop    %esi
+  800f92:	5f                   	pop    %edi
+  800f93:	5d                   	pop    %ebp
+  800f94:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f95:	83 ec 0c             	sub    $0xc,%esp
+  800f98:	50                   	push   %eax
+  800f99:	6a 10                	push   $0x10
+  800f9b:	68 6b 59 80 00       	push   $0x80596b
+  800fa0:	6a 23                	push   $0x23
+  800fa2:	68 88 59 80 00       	push   $0x805988
+  800fa7:	e8 b2 f2 ff ff       	call   80025e <_panic>
+
+00800fac <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800fac:	55                   	push   %ebp
+  800fad:	89 e5                	mov    %esp,%ebp
+  800faf:	57                   	push   %edi
+  800fb0:	56                   	push   %esi
+  800fb1:	53                   	push   %ebx
+  800fb2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fb5:	be 00 00 00 00       	mov    $0x0,%esi
+  800fba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc0:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fc5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc8:	89 f7                	mov    %esi,%edi
+  800fca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fcc:	85 c0                	test   %eax,%eax
+  800fce:	7f 08                	jg     800fd8 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800fd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd3:	5b                   	pop    %ebx
+  800fd4:	5e                   	pop    %esi
+  800fd5:	5f                   	pop    %edi
+  800fd6:	5d                   	pop    %ebp
+  800fd7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd8:	83 ec 0c             	sub    $0xc,%esp
+  800fdb:	50                   	push   %eax
+  800fdc:	6a 11                	push   $0x11
+  800fde:	68 6b 59 80 00       	push   $0x80596b
+  800fe3:	6a 23                	push   $0x23
+  800fe5:	68 88 59 80 00       	push   $0x805988
+  800fea:	e8 6f f2 ff ff       	call   80025e <_panic>
+
+00800fef <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800fef:	55                   	push   %ebp
+  800ff0:	89 e5                	mov    %esp,%ebp
+  800ff2:	57                   	push   %edi
+  800ff3:	56                   	push   %esi
+  800ff4:	53                   	push   %ebx
+  800ff5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ff8:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801000:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801003:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801008:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80100b:	89 f7                	mov    %esi,%edi
+  80100d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80100f:	85 c0                	test   %eax,%eax
+  801011:	7f 08                	jg     80101b <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  801013:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801016:	5b                   	pop    %ebx
+  801017:	5e                   	pop    %esi
+  801018:	5f                   	pop    %edi
+  801019:	5d                   	pop    %ebp
+  80101a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80101b:	83 ec 0c             	sub    $0xc,%esp
+  80101e:	50                   	push   %eax
+  80101f:	6a 1b                	push   $0x1b
+  801021:	68 6b 59 80 00       	push   $0x80596b
+  801026:	6a 23                	push   $0x23
+  801028:	68 88 59 80 00       	push   $0x805988
+  80102d:	e8 2c f2 ff ff       	call   80025e <_panic>
+
+00801032 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  801032:	55                   	push   %ebp
+  801033:	89 e5                	mov    %esp,%ebp
+  801035:	57                   	push   %edi
+  801036:	56                   	push   %esi
+  801037:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801038:	ba 00 00 00 00       	mov    $0x0,%edx
+  80103d:	b8 12 00 00 00       	mov    $0x12,%eax
+  801042:	89 d1                	mov    %edx,%ecx
+  801044:	89 d3                	mov    %edx,%ebx
+  801046:	89 d7                	mov    %edx,%edi
+  801048:	89 d6                	mov    %edx,%esi
+  80104a:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80104c:	5b                   	pop    %ebx
+  80104d:	5e                   	pop    %esi
+  80104e:	5f                   	pop    %edi
+  80104f:	5d                   	pop    %ebp
+  801050:	c3                   	ret
+
+00801051 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801051:	55                   	push   %ebp
+  801052:	89 e5                	mov    %esp,%ebp
+  801054:	57                   	push   %edi
+  801055:	56                   	push   %esi
+  801056:	53                   	push   %ebx
+  801057:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80105a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801062:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801065:	b8 08 00 00 00       	mov    $0x8,%eax
+  80106a:	89 df                	mov    %ebx,%edi
+  80106c:	89 de                	mov    %ebx,%esi
+  80106e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801070:	85 c0                	test   %eax,%eax
+  801072:	7f 08                	jg     80107c <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801074:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801077:	5b                   	pop    %ebx
+  801078:	5e                   	pop    %esi
+  801079:	5f                   	pop    %edi
+  80107a:	5d                   	pop    %ebp
+  80107b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107c:	83 ec 0c             	sub    $0xc,%esp
+  80107f:	50                   	push   %eax
+  801080:	6a 08                	push   $0x8
+  801082:	68 6b 59 80 00       	push   $0x80596b
+  801087:	6a 23                	push   $0x23
+  801089:	68 88 59 80 00       	push   $0x805988
+  80108e:	e8 cb f1 ff ff       	call   80025e <_panic>
+
+00801093 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801093:	55                   	push   %ebp
+  801094:	89 e5                	mov    %esp,%ebp
+  801096:	57                   	push   %edi
+  801097:	56                   	push   %esi
+  801098:	53                   	push   %ebx
+  801099:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  80109c:	6a 44                	push   $0x44
+  80109e:	ff 75 0c             	push   0xc(%ebp)
+  8010a1:	e8 7a fc ff ff       	call   800d20 <touch_mem>
+	asm volatile("int %1\n"
+  8010a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ae:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b6:	89 df                	mov    %ebx,%edi
+  8010b8:	89 de                	mov    %ebx,%esi
+  8010ba:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010bc:	83 c4 08             	add    $0x8,%esp
+  8010bf:	85 c0                	test   %eax,%eax
+  8010c1:	7f 08                	jg     8010cb <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c6:	5b                   	pop    %ebx
+  8010c7:	5e                   	pop    %esi
+  8010c8:	5f                   	pop    %edi
+  8010c9:	5d                   	pop    %ebp
+  8010ca:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010cb:	83 ec 0c             	sub    $0xc,%esp
+  8010ce:	50                   	push   %eax
+  8010cf:	6a 09                	push   $0x9
+  8010d1:	68 6b 59 80 00       	push   $0x80596b
+  8010d6:	6a 23                	push   $0x23
+  8010d8:	68 88 59 80 00       	push   $0x805988
+  8010dd:	e8 7c f1 ff ff       	call   80025e <_panic>
+
+008010e2 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  8010e2:	55                   	push   %ebp
+  8010e3:	89 e5                	mov    %esp,%ebp
+  8010e5:	57                   	push   %edi
+  8010e6:	56                   	push   %esi
+  8010e7:	53                   	push   %ebx
+  8010e8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8010fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010fe:	89 f7                	mov    %esi,%edi
+  801100:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801102:	85 c0                	test   %eax,%eax
+  801104:	7f 08                	jg     80110e <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  801106:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801109:	5b                   	pop    %ebx
+  80110a:	5e                   	pop    %esi
+  80110b:	5f                   	pop    %edi
+  80110c:	5d                   	pop    %ebp
+  80110d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110e:	83 ec 0c             	sub    $0xc,%esp
+  801111:	50                   	push   %eax
+  801112:	6a 1a                	push   $0x1a
+  801114:	68 6b 59 80 00       	push   $0x80596b
+  801119:	6a 23                	push   $0x23
+  80111b:	68 88 59 80 00       	push   $0x805988
+  801120:	e8 39 f1 ff ff       	call   80025e <_panic>
+
+00801125 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  801125:	55                   	push   %ebp
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	57                   	push   %edi
+  801129:	56                   	push   %esi
+  80112a:	53                   	push   %ebx
+  80112b:	83 ec 0c             	sub    $0xc,%esp
+  80112e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801131:	89 d8                	mov    %ebx,%eax
+  801133:	c1 e0 05             	shl    $0x5,%eax
+  801136:	50                   	push   %eax
+  801137:	ff 75 0c             	push   0xc(%ebp)
+  80113a:	e8 e1 fb ff ff       	call   800d20 <touch_mem>
+	asm volatile("int %1\n"
+  80113f:	be 00 00 00 00       	mov    $0x0,%esi
+  801144:	8b 55 08             	mov    0x8(%ebp),%edx
+  801147:	b8 13 00 00 00       	mov    $0x13,%eax
+  80114c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114f:	89 f7                	mov    %esi,%edi
+  801151:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801153:	83 c4 08             	add    $0x8,%esp
+  801156:	85 c0                	test   %eax,%eax
+  801158:	7f 08                	jg     801162 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  80115a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115d:	5b                   	pop    %ebx
+  80115e:	5e                   	pop    %esi
+  80115f:	5f                   	pop    %edi
+  801160:	5d                   	pop    %ebp
+  801161:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801162:	83 ec 0c             	sub    $0xc,%esp
+  801165:	50                   	push   %eax
+  801166:	6a 13                	push   $0x13
+  801168:	68 6b 59 80 00       	push   $0x80596b
+  80116d:	6a 23                	push   $0x23
+  80116f:	68 88 59 80 00       	push   $0x805988
+  801174:	e8 e5 f0 ff ff       	call   80025e <_panic>
+
+00801179 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801179:	55                   	push   %ebp
+  80117a:	89 e5                	mov    %esp,%ebp
+  80117c:	57                   	push   %edi
+  80117d:	56                   	push   %esi
+  80117e:	53                   	push   %ebx
+  80117f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801182:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801187:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801192:	89 df                	mov    %ebx,%edi
+  801194:	89 de                	mov    %ebx,%esi
+  801196:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801198:	85 c0                	test   %eax,%eax
+  80119a:	7f 08                	jg     8011a4 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80119c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80119f:	5b                   	pop    %ebx
+  8011a0:	5e                   	pop    %esi
+  8011a1:	5f                   	pop    %edi
+  8011a2:	5d                   	pop    %ebp
+  8011a3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a4:	83 ec 0c             	sub    $0xc,%esp
+  8011a7:	50                   	push   %eax
+  8011a8:	6a 0a                	push   $0xa
+  8011aa:	68 6b 59 80 00       	push   $0x80596b
+  8011af:	6a 23                	push   $0x23
+  8011b1:	68 88 59 80 00       	push   $0x805988
+  8011b6:	e8 a3 f0 ff ff       	call   80025e <_panic>
+
+008011bb <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011bb:	55                   	push   %ebp
+  8011bc:	89 e5                	mov    %esp,%ebp
+  8011be:	57                   	push   %edi
+  8011bf:	56                   	push   %esi
+  8011c0:	53                   	push   %ebx
+  8011c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  8011c4:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011ca:	76 1d                	jbe    8011e9 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  8011cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011d7:	be 01 00 00 00       	mov    $0x1,%esi
+  8011dc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011df:	cd 30                	int    $0x30
+}
+  8011e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e4:	5b                   	pop    %ebx
+  8011e5:	5e                   	pop    %esi
+  8011e6:	5f                   	pop    %edi
+  8011e7:	5d                   	pop    %ebp
+  8011e8:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011e9:	68 00 10 00 00       	push   $0x1000
+  8011ee:	53                   	push   %ebx
+  8011ef:	e8 2c fb ff ff       	call   800d20 <touch_mem>
+  8011f4:	83 c4 08             	add    $0x8,%esp
+  8011f7:	eb d3                	jmp    8011cc <sys_ipc_send+0x11>
+
+008011f9 <sys_ipc_send_pages>:
+{
+  8011f9:	55                   	push   %ebp
+  8011fa:	89 e5                	mov    %esp,%ebp
+  8011fc:	57                   	push   %edi
+  8011fd:	56                   	push   %esi
+  8011fe:	53                   	push   %ebx
+  8011ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801202:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801205:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80120b:	76 18                	jbe    801225 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80120d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801210:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801213:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801218:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80121b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  80121d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801220:	5b                   	pop    %ebx
+  801221:	5e                   	pop    %esi
+  801222:	5f                   	pop    %edi
+  801223:	5d                   	pop    %ebp
+  801224:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801225:	89 f0                	mov    %esi,%eax
+  801227:	c1 e0 0c             	shl    $0xc,%eax
+  80122a:	50                   	push   %eax
+  80122b:	53                   	push   %ebx
+  80122c:	e8 ef fa ff ff       	call   800d20 <touch_mem>
+  801231:	83 c4 08             	add    $0x8,%esp
+  801234:	eb d7                	jmp    80120d <sys_ipc_send_pages+0x14>
+
+00801236 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801236:	55                   	push   %ebp
+  801237:	89 e5                	mov    %esp,%ebp
+  801239:	57                   	push   %edi
+  80123a:	56                   	push   %esi
+  80123b:	53                   	push   %ebx
+  80123c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80123f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801244:	8b 55 08             	mov    0x8(%ebp),%edx
+  801247:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80124f:	89 df                	mov    %ebx,%edi
+  801251:	89 de                	mov    %ebx,%esi
+  801253:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801255:	85 c0                	test   %eax,%eax
+  801257:	7f 08                	jg     801261 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801259:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125c:	5b                   	pop    %ebx
+  80125d:	5e                   	pop    %esi
+  80125e:	5f                   	pop    %edi
+  80125f:	5d                   	pop    %ebp
+  801260:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801261:	83 ec 0c             	sub    $0xc,%esp
+  801264:	50                   	push   %eax
+  801265:	6a 0d                	push   $0xd
+  801267:	68 6b 59 80 00       	push   $0x80596b
+  80126c:	6a 23                	push   $0x23
+  80126e:	68 88 59 80 00       	push   $0x805988
+  801273:	e8 e6 ef ff ff       	call   80025e <_panic>
+
+00801278 <sys_ipc_recv>:
+{
+  801278:	55                   	push   %ebp
+  801279:	89 e5                	mov    %esp,%ebp
+  80127b:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80127e:	6a 01                	push   $0x1
+  801280:	ff 75 08             	push   0x8(%ebp)
+  801283:	e8 ae ff ff ff       	call   801236 <sys_ipc_recv_pages>
+}
+  801288:	c9                   	leave
+  801289:	c3                   	ret
+
+0080128a <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80128a:	55                   	push   %ebp
+  80128b:	89 e5                	mov    %esp,%ebp
+  80128d:	57                   	push   %edi
+  80128e:	56                   	push   %esi
+  80128f:	53                   	push   %ebx
+  801290:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801293:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801296:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801299:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80129f:	77 04                	ja     8012a5 <sys_ipc_call+0x1b>
+  8012a1:	85 f6                	test   %esi,%esi
+  8012a3:	75 15                	jne    8012ba <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8012a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ab:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012b0:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8012b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b5:	5b                   	pop    %ebx
+  8012b6:	5e                   	pop    %esi
+  8012b7:	5f                   	pop    %edi
+  8012b8:	5d                   	pop    %ebp
+  8012b9:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8012ba:	89 f8                	mov    %edi,%eax
+  8012bc:	c1 e0 0c             	shl    $0xc,%eax
+  8012bf:	50                   	push   %eax
+  8012c0:	53                   	push   %ebx
+  8012c1:	e8 5a fa ff ff       	call   800d20 <touch_mem>
+  8012c6:	83 c4 08             	add    $0x8,%esp
+  8012c9:	eb da                	jmp    8012a5 <sys_ipc_call+0x1b>
+
+008012cb <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8012cb:	55                   	push   %ebp
+  8012cc:	89 e5                	mov    %esp,%ebp
+  8012ce:	57                   	push   %edi
+  8012cf:	56                   	push   %esi
+  8012d0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012df:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012e2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012e5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8012e7:	5b                   	pop    %ebx
+  8012e8:	5e                   	pop    %esi
+  8012e9:	5f                   	pop    %edi
+  8012ea:	5d                   	pop    %ebp
+  8012eb:	c3                   	ret
+
+008012ec <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8012ec:	55                   	push   %ebp
+  8012ed:	89 e5                	mov    %esp,%ebp
+  8012ef:	57                   	push   %edi
+  8012f0:	56                   	push   %esi
+  8012f1:	53                   	push   %ebx
+  8012f2:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8012f5:	6a 04                	push   $0x4
+  8012f7:	ff 75 08             	push   0x8(%ebp)
+  8012fa:	e8 21 fa ff ff       	call   800d20 <touch_mem>
+	asm volatile("int %1\n"
+  8012ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801304:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801307:	b8 16 00 00 00       	mov    $0x16,%eax
+  80130c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801312:	89 f7                	mov    %esi,%edi
+  801314:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801316:	83 c4 08             	add    $0x8,%esp
+  801319:	85 c0                	test   %eax,%eax
+  80131b:	7f 08                	jg     801325 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  80131d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801320:	5b                   	pop    %ebx
+  801321:	5e                   	pop    %esi
+  801322:	5f                   	pop    %edi
+  801323:	5d                   	pop    %ebp
+  801324:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801325:	83 ec 0c             	sub    $0xc,%esp
+  801328:	50                   	push   %eax
+  801329:	6a 16                	push   $0x16
+  80132b:	68 6b 59 80 00       	push   $0x80596b
+  801330:	6a 23                	push   $0x23
+  801332:	68 88 59 80 00       	push   $0x805988
+  801337:	e8 22 ef ff ff       	call   80025e <_panic>
+
+0080133c <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80133c:	55                   	push   %ebp
+  80133d:	89 e5                	mov    %esp,%ebp
+  80133f:	57                   	push   %edi
+  801340:	56                   	push   %esi
+  801341:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801342:	6a 04                	push   $0x4
+  801344:	ff 75 08             	push   0x8(%ebp)
+  801347:	e8 d4 f9 ff ff       	call   800d20 <touch_mem>
+	asm volatile("int %1\n"
+  80134c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801351:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801354:	b8 17 00 00 00       	mov    $0x17,%eax
+  801359:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135c:	89 df                	mov    %ebx,%edi
+  80135e:	89 de                	mov    %ebx,%esi
+  801360:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801362:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801365:	5b                   	pop    %ebx
+  801366:	5e                   	pop    %esi
+  801367:	5f                   	pop    %edi
+  801368:	5d                   	pop    %ebp
+  801369:	c3                   	ret
+
+0080136a <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80136a:	55                   	push   %ebp
+  80136b:	89 e5                	mov    %esp,%ebp
+  80136d:	57                   	push   %edi
+  80136e:	56                   	push   %esi
+  80136f:	53                   	push   %ebx
+  801370:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801373:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801378:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801380:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801385:	89 df                	mov    %ebx,%edi
+  801387:	89 de                	mov    %ebx,%esi
+  801389:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80138b:	85 c0                	test   %eax,%eax
+  80138d:	7f 08                	jg     801397 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80138f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801392:	5b                   	pop    %ebx
+  801393:	5e                   	pop    %esi
+  801394:	5f                   	pop    %edi
+  801395:	5d                   	pop    %ebp
+  801396:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801397:	83 ec 0c             	sub    $0xc,%esp
+  80139a:	50                   	push   %eax
+  80139b:	6a 0e                	push   $0xe
+  80139d:	68 6b 59 80 00       	push   $0x80596b
+  8013a2:	6a 23                	push   $0x23
+  8013a4:	68 88 59 80 00       	push   $0x805988
+  8013a9:	e8 b0 ee ff ff       	call   80025e <_panic>
+
+008013ae <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  8013ae:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013b5:	f6 c6 06             	test   $0x6,%dh
+  8013b8:	75 37                	jne    8013f1 <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  8013ba:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013c1:	f6 c2 02             	test   $0x2,%dl
+  8013c4:	75 19                	jne    8013df <dupperm+0x31>
+  8013c6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013cd:	f6 c6 08             	test   $0x8,%dh
+  8013d0:	75 0d                	jne    8013df <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  8013d2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013d9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013de:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  8013df:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013e6:	25 00 06 00 00       	and    $0x600,%eax
+  8013eb:	0d 05 08 00 00       	or     $0x805,%eax
+  8013f0:	c3                   	ret
+		return 0;
+  8013f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013f6:	c3                   	ret
+
+008013f7 <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  8013f7:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  8013f9:	c1 e0 0c             	shl    $0xc,%eax
+  8013fc:	c1 e8 16             	shr    $0x16,%eax
+  8013ff:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801406:	f6 c1 01             	test   $0x1,%cl
+  801409:	74 2c                	je     801437 <dupable+0x40>
+  80140b:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801412:	b8 00 00 00 00       	mov    $0x0,%eax
+  801417:	f6 c1 04             	test   $0x4,%cl
+  80141a:	74 20                	je     80143c <dupable+0x45>
+  80141c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801423:	f6 c1 01             	test   $0x1,%cl
+  801426:	74 14                	je     80143c <dupable+0x45>
+  801428:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  80142f:	c1 e8 02             	shr    $0x2,%eax
+  801432:	83 e0 01             	and    $0x1,%eax
+  801435:	eb 05                	jmp    80143c <dupable+0x45>
+  801437:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143c:	83 e0 01             	and    $0x1,%eax
+}
+  80143f:	c3                   	ret
+
+00801440 <pgfault>:
+{
+  801440:	55                   	push   %ebp
+  801441:	89 e5                	mov    %esp,%ebp
+  801443:	56                   	push   %esi
+  801444:	53                   	push   %ebx
+  801445:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801448:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  80144a:	89 ca                	mov    %ecx,%edx
+  80144c:	c1 ea 0c             	shr    $0xc,%edx
+  80144f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801456:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  80145a:	0f 84 8e 00 00 00    	je     8014ee <pgfault+0xae>
+		return 0;
+  801460:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801465:	f6 c6 08             	test   $0x8,%dh
+  801468:	0f 84 85 00 00 00    	je     8014f3 <pgfault+0xb3>
+	perm |= PTE_W;
+  80146e:	81 e2 07 06 00 00    	and    $0x607,%edx
+  801474:	89 d3                	mov    %edx,%ebx
+  801476:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801479:	89 ce                	mov    %ecx,%esi
+  80147b:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  801481:	6a 01                	push   $0x1
+  801483:	53                   	push   %ebx
+  801484:	68 00 f0 7f 00       	push   $0x7ff000
+  801489:	6a 00                	push   $0x0
+  80148b:	e8 a5 27 00 00       	call   803c35 <page_alloc>
+  801490:	83 c4 10             	add    $0x10,%esp
+  801493:	85 c0                	test   %eax,%eax
+  801495:	78 33                	js     8014ca <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  801497:	83 ec 04             	sub    $0x4,%esp
+  80149a:	68 00 10 00 00       	push   $0x1000
+  80149f:	56                   	push   %esi
+  8014a0:	68 00 f0 7f 00       	push   $0x7ff000
+  8014a5:	e8 fc f5 ff ff       	call   800aa6 <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  8014aa:	89 1c 24             	mov    %ebx,(%esp)
+  8014ad:	56                   	push   %esi
+  8014ae:	6a 00                	push   $0x0
+  8014b0:	68 00 f0 7f 00       	push   $0x7ff000
+  8014b5:	6a 00                	push   $0x0
+  8014b7:	e8 da 2d 00 00       	call   804296 <page_map>
+  8014bc:	83 c4 20             	add    $0x20,%esp
+  8014bf:	85 c0                	test   %eax,%eax
+  8014c1:	78 19                	js     8014dc <pgfault+0x9c>
+	return 1;
+  8014c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014c8:	eb 29                	jmp    8014f3 <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  8014ca:	50                   	push   %eax
+  8014cb:	68 98 59 80 00       	push   $0x805998
+  8014d0:	6a 2e                	push   $0x2e
+  8014d2:	68 eb 59 80 00       	push   $0x8059eb
+  8014d7:	e8 82 ed ff ff       	call   80025e <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  8014dc:	50                   	push   %eax
+  8014dd:	68 c4 59 80 00       	push   $0x8059c4
+  8014e2:	6a 32                	push   $0x32
+  8014e4:	68 eb 59 80 00       	push   $0x8059eb
+  8014e9:	e8 70 ed ff ff       	call   80025e <_panic>
+		return 0;
+  8014ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014f6:	5b                   	pop    %ebx
+  8014f7:	5e                   	pop    %esi
+  8014f8:	5d                   	pop    %ebp
+  8014f9:	c3                   	ret
+
+008014fa <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8014fa:	55                   	push   %ebp
+  8014fb:	89 e5                	mov    %esp,%ebp
+  8014fd:	57                   	push   %edi
+  8014fe:	56                   	push   %esi
+  8014ff:	53                   	push   %ebx
+  801500:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  801503:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  80150a:	74 5d                	je     801569 <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  80150c:	83 ec 0c             	sub    $0xc,%esp
+  80150f:	68 40 14 80 00       	push   $0x801440
+  801514:	e8 de 39 00 00       	call   804ef7 <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  801519:	e8 14 fb ff ff       	call   801032 <sys_fork>
+  80151e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801521:	83 c4 10             	add    $0x10,%esp
+  801524:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  801527:	74 47                	je     801570 <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  801529:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80152d:	0f 84 c5 03 00 00    	je     8018f8 <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  801533:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801537:	78 25                	js     80155e <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  801539:	e8 6f 20 00 00       	call   8035ad <page_share_paged_out>
+  80153e:	85 c0                	test   %eax,%eax
+  801540:	0f 88 d8 03 00 00    	js     80191e <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801546:	83 ec 08             	sub    $0x8,%esp
+  801549:	6a 02                	push   $0x2
+  80154b:	ff 75 e4             	push   -0x1c(%ebp)
+  80154e:	e8 fe fa ff ff       	call   801051 <sys_env_set_status>
+  801553:	83 c4 10             	add    $0x10,%esp
+  801556:	85 c0                	test   %eax,%eax
+  801558:	0f 88 d5 03 00 00    	js     801933 <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  80155e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801561:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801564:	5b                   	pop    %ebx
+  801565:	5e                   	pop    %esi
+  801566:	5f                   	pop    %edi
+  801567:	5d                   	pop    %ebp
+  801568:	c3                   	ret
+		init_map_dir();
+  801569:	e8 47 23 00 00       	call   8038b5 <init_map_dir>
+  80156e:	eb 9c                	jmp    80150c <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801570:	b8 07 00 00 00       	mov    $0x7,%eax
+  801575:	cd 30                	int    $0x30
+  801577:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  80157a:	85 c0                	test   %eax,%eax
+  80157c:	78 10                	js     80158e <fork+0x94>
+	if (envid == 0)
+  80157e:	0f 84 74 03 00 00    	je     8018f8 <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801584:	be 00 00 00 00       	mov    $0x0,%esi
+  801589:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80158c:	eb 30                	jmp    8015be <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  80158e:	50                   	push   %eax
+  80158f:	68 f6 59 80 00       	push   $0x8059f6
+  801594:	68 cd 00 00 00       	push   $0xcd
+  801599:	68 eb 59 80 00       	push   $0x8059eb
+  80159e:	e8 bb ec ff ff       	call   80025e <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  8015a3:	89 f2                	mov    %esi,%edx
+  8015a5:	c1 fa 1f             	sar    $0x1f,%edx
+  8015a8:	c1 ea 16             	shr    $0x16,%edx
+  8015ab:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8015ae:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8015b3:	29 d0                	sub    %edx,%eax
+  8015b5:	ba 00 04 00 00       	mov    $0x400,%edx
+  8015ba:	29 c2                	sub    %eax,%edx
+  8015bc:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  8015be:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8015c1:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  8015c7:	0f 87 ff 02 00 00    	ja     8018cc <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  8015cd:	89 f3                	mov    %esi,%ebx
+  8015cf:	c1 e3 0c             	shl    $0xc,%ebx
+  8015d2:	89 d8                	mov    %ebx,%eax
+  8015d4:	c1 e8 16             	shr    $0x16,%eax
+  8015d7:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8015de:	f6 c2 01             	test   $0x1,%dl
+  8015e1:	74 c0                	je     8015a3 <fork+0xa9>
+  8015e3:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8015ea:	f6 c2 04             	test   $0x4,%dl
+  8015ed:	74 b4                	je     8015a3 <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  8015ef:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015f6:	a8 80                	test   $0x80,%al
+  8015f8:	75 24                	jne    80161e <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  8015fa:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801601:	25 81 00 00 00       	and    $0x81,%eax
+  801606:	3d 80 00 00 00       	cmp    $0x80,%eax
+  80160b:	74 21                	je     80162e <fork+0x134>
+		if (!dupable(pn)) {
+  80160d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801610:	e8 e2 fd ff ff       	call   8013f7 <dupable>
+  801615:	84 c0                	test   %al,%al
+  801617:	75 1a                	jne    801633 <fork+0x139>
+			++pn;
+  801619:	83 c6 01             	add    $0x1,%esi
+			continue;
+  80161c:	eb a0                	jmp    8015be <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  80161e:	83 ec 08             	sub    $0x8,%esp
+  801621:	53                   	push   %ebx
+  801622:	6a 00                	push   $0x0
+  801624:	e8 b1 f8 ff ff       	call   800eda <sys_page_split>
+  801629:	83 c4 10             	add    $0x10,%esp
+  80162c:	eb cc                	jmp    8015fa <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  80162e:	0f b6 03             	movzbl (%ebx),%eax
+  801631:	eb da                	jmp    80160d <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  801633:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801636:	89 f8                	mov    %edi,%eax
+  801638:	e8 71 fd ff ff       	call   8013ae <dupperm>
+  80163d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801640:	85 c0                	test   %eax,%eax
+  801642:	74 16                	je     80165a <fork+0x160>
+  801644:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  801649:	29 f8                	sub    %edi,%eax
+  80164b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  80164e:	bf 01 00 00 00       	mov    $0x1,%edi
+  801653:	89 c6                	mov    %eax,%esi
+  801655:	e9 c4 01 00 00       	jmp    80181e <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  80165a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80165d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801664:	f6 c4 04             	test   $0x4,%ah
+  801667:	0f 85 89 00 00 00    	jne    8016f6 <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  80166d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801670:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801677:	f6 c4 02             	test   $0x2,%ah
+  80167a:	0f 85 b1 00 00 00    	jne    801731 <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  801680:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801683:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80168a:	a8 02                	test   $0x2,%al
+  80168c:	75 10                	jne    80169e <fork+0x1a4>
+  80168e:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801695:	f6 c4 08             	test   $0x8,%ah
+  801698:	0f 84 3e 01 00 00    	je     8017dc <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  80169e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8016a1:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8016a8:	25 00 06 00 00       	and    $0x600,%eax
+  8016ad:	0d 05 08 00 00       	or     $0x805,%eax
+  8016b2:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  8016b4:	c1 e1 0c             	shl    $0xc,%ecx
+  8016b7:	89 cb                	mov    %ecx,%ebx
+  8016b9:	83 ec 0c             	sub    $0xc,%esp
+  8016bc:	50                   	push   %eax
+  8016bd:	51                   	push   %ecx
+  8016be:	ff 75 e4             	push   -0x1c(%ebp)
+  8016c1:	51                   	push   %ecx
+  8016c2:	6a 00                	push   $0x0
+  8016c4:	e8 cd 2b 00 00       	call   804296 <page_map>
+  8016c9:	83 c4 20             	add    $0x20,%esp
+  8016cc:	85 c0                	test   %eax,%eax
+  8016ce:	0f 88 e4 00 00 00    	js     8017b8 <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  8016d4:	83 ec 0c             	sub    $0xc,%esp
+  8016d7:	57                   	push   %edi
+  8016d8:	53                   	push   %ebx
+  8016d9:	6a 00                	push   $0x0
+  8016db:	53                   	push   %ebx
+  8016dc:	6a 00                	push   $0x0
+  8016de:	e8 b3 2b 00 00       	call   804296 <page_map>
+  8016e3:	83 c4 20             	add    $0x20,%esp
+  8016e6:	85 c0                	test   %eax,%eax
+  8016e8:	0f 88 dc 00 00 00    	js     8017ca <fork+0x2d0>
+			++pn;
+  8016ee:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8016f1:	e9 c8 fe ff ff       	jmp    8015be <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8016f6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8016f9:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801700:	c1 e1 0c             	shl    $0xc,%ecx
+  801703:	83 ec 0c             	sub    $0xc,%esp
+  801706:	25 07 0e 00 00       	and    $0xe07,%eax
+  80170b:	50                   	push   %eax
+  80170c:	51                   	push   %ecx
+  80170d:	ff 75 e4             	push   -0x1c(%ebp)
+  801710:	51                   	push   %ecx
+  801711:	6a 00                	push   $0x0
+  801713:	e8 7e 2b 00 00       	call   804296 <page_map>
+  801718:	83 c4 20             	add    $0x20,%esp
+  80171b:	85 c0                	test   %eax,%eax
+  80171d:	79 cf                	jns    8016ee <fork+0x1f4>
+			panic("page_map %d", r);
+  80171f:	50                   	push   %eax
+  801720:	68 06 5a 80 00       	push   $0x805a06
+  801725:	6a 4d                	push   $0x4d
+  801727:	68 eb 59 80 00       	push   $0x8059eb
+  80172c:	e8 2d eb ff ff       	call   80025e <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  801731:	83 ec 0c             	sub    $0xc,%esp
+  801734:	68 00 10 00 00       	push   $0x1000
+  801739:	e8 4a 31 00 00       	call   804888 <malloc>
+  80173e:	89 c7                	mov    %eax,%edi
+  801740:	83 c4 10             	add    $0x10,%esp
+  801743:	85 c0                	test   %eax,%eax
+  801745:	74 4b                	je     801792 <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  801747:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80174a:	c1 e3 0c             	shl    $0xc,%ebx
+  80174d:	83 ec 04             	sub    $0x4,%esp
+  801750:	68 00 10 00 00       	push   $0x1000
+  801755:	53                   	push   %ebx
+  801756:	50                   	push   %eax
+  801757:	e8 ac f3 ff ff       	call   800b08 <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  80175c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80175f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801766:	25 07 0e 00 00       	and    $0xe07,%eax
+  80176b:	89 04 24             	mov    %eax,(%esp)
+  80176e:	53                   	push   %ebx
+  80176f:	ff 75 e4             	push   -0x1c(%ebp)
+  801772:	57                   	push   %edi
+  801773:	6a 00                	push   $0x0
+  801775:	e8 1c 2b 00 00       	call   804296 <page_map>
+  80177a:	83 c4 20             	add    $0x20,%esp
+  80177d:	85 c0                	test   %eax,%eax
+  80177f:	78 25                	js     8017a6 <fork+0x2ac>
+		free(temp);
+  801781:	83 ec 0c             	sub    $0xc,%esp
+  801784:	57                   	push   %edi
+  801785:	e8 fc 2e 00 00       	call   804686 <free>
+  80178a:	83 c4 10             	add    $0x10,%esp
+  80178d:	e9 5c ff ff ff       	jmp    8016ee <fork+0x1f4>
+			panic("malloc failed");
+  801792:	83 ec 04             	sub    $0x4,%esp
+  801795:	68 12 5a 80 00       	push   $0x805a12
+  80179a:	6a 56                	push   $0x56
+  80179c:	68 eb 59 80 00       	push   $0x8059eb
+  8017a1:	e8 b8 ea ff ff       	call   80025e <_panic>
+			panic("page_map: %e", r);
+  8017a6:	50                   	push   %eax
+  8017a7:	68 20 5a 80 00       	push   $0x805a20
+  8017ac:	6a 59                	push   $0x59
+  8017ae:	68 eb 59 80 00       	push   $0x8059eb
+  8017b3:	e8 a6 ea ff ff       	call   80025e <_panic>
+			panic("page_map %d", r);
+  8017b8:	50                   	push   %eax
+  8017b9:	68 06 5a 80 00       	push   $0x805a06
+  8017be:	6a 65                	push   $0x65
+  8017c0:	68 eb 59 80 00       	push   $0x8059eb
+  8017c5:	e8 94 ea ff ff       	call   80025e <_panic>
+			panic("page_map %d", r);
+  8017ca:	50                   	push   %eax
+  8017cb:	68 06 5a 80 00       	push   $0x805a06
+  8017d0:	6a 78                	push   $0x78
+  8017d2:	68 eb 59 80 00       	push   $0x8059eb
+  8017d7:	e8 82 ea ff ff       	call   80025e <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8017dc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8017df:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8017e6:	c1 e1 0c             	shl    $0xc,%ecx
+  8017e9:	83 ec 0c             	sub    $0xc,%esp
+  8017ec:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017f1:	50                   	push   %eax
+  8017f2:	51                   	push   %ecx
+  8017f3:	ff 75 e4             	push   -0x1c(%ebp)
+  8017f6:	51                   	push   %ecx
+  8017f7:	6a 00                	push   $0x0
+  8017f9:	e8 98 2a 00 00       	call   804296 <page_map>
+  8017fe:	83 c4 20             	add    $0x20,%esp
+  801801:	85 c0                	test   %eax,%eax
+  801803:	0f 89 e5 fe ff ff    	jns    8016ee <fork+0x1f4>
+			panic("page_map %d", r);
+  801809:	50                   	push   %eax
+  80180a:	68 06 5a 80 00       	push   $0x805a06
+  80180f:	6a 7f                	push   $0x7f
+  801811:	68 eb 59 80 00       	push   $0x8059eb
+  801816:	e8 43 ea ff ff       	call   80025e <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  80181b:	83 c7 01             	add    $0x1,%edi
+  80181e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801821:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  801824:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  801827:	39 f7                	cmp    %esi,%edi
+  801829:	74 1c                	je     801847 <fork+0x34d>
+  80182b:	89 d8                	mov    %ebx,%eax
+  80182d:	e8 c5 fb ff ff       	call   8013f7 <dupable>
+  801832:	84 c0                	test   %al,%al
+  801834:	74 7c                	je     8018b2 <fork+0x3b8>
+  801836:	89 d8                	mov    %ebx,%eax
+  801838:	e8 71 fb ff ff       	call   8013ae <dupperm>
+  80183d:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  801840:	74 d9                	je     80181b <fork+0x321>
+  801842:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801845:	eb 06                	jmp    80184d <fork+0x353>
+  801847:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80184a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  80184d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801850:	c1 e0 0c             	shl    $0xc,%eax
+  801853:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801856:	83 ec 08             	sub    $0x8,%esp
+  801859:	ff 75 dc             	push   -0x24(%ebp)
+  80185c:	57                   	push   %edi
+  80185d:	50                   	push   %eax
+  80185e:	ff 75 e4             	push   -0x1c(%ebp)
+  801861:	50                   	push   %eax
+  801862:	6a 00                	push   $0x0
+  801864:	e8 24 2c 00 00       	call   80448d <page_map_range>
+  801869:	83 c4 20             	add    $0x20,%esp
+  80186c:	85 c0                	test   %eax,%eax
+  80186e:	78 47                	js     8018b7 <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  801870:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801877:	0f 84 41 fd ff ff    	je     8015be <fork+0xc4>
+  80187d:	83 ec 08             	sub    $0x8,%esp
+  801880:	ff 75 dc             	push   -0x24(%ebp)
+  801883:	57                   	push   %edi
+  801884:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801887:	50                   	push   %eax
+  801888:	6a 00                	push   $0x0
+  80188a:	50                   	push   %eax
+  80188b:	6a 00                	push   $0x0
+  80188d:	e8 fb 2b 00 00       	call   80448d <page_map_range>
+  801892:	83 c4 20             	add    $0x20,%esp
+  801895:	85 c0                	test   %eax,%eax
+  801897:	0f 89 21 fd ff ff    	jns    8015be <fork+0xc4>
+		panic("page_map_range %e", r);
+  80189d:	50                   	push   %eax
+  80189e:	68 2d 5a 80 00       	push   $0x805a2d
+  8018a3:	68 a2 00 00 00       	push   $0xa2
+  8018a8:	68 eb 59 80 00       	push   $0x8059eb
+  8018ad:	e8 ac e9 ff ff       	call   80025e <_panic>
+  8018b2:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8018b5:	eb 96                	jmp    80184d <fork+0x353>
+		panic("page_map_range %e", r);
+  8018b7:	50                   	push   %eax
+  8018b8:	68 2d 5a 80 00       	push   $0x805a2d
+  8018bd:	68 a0 00 00 00       	push   $0xa0
+  8018c2:	68 eb 59 80 00       	push   $0x8059eb
+  8018c7:	e8 92 e9 ff ff       	call   80025e <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  8018cc:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  8018cf:	6a 01                	push   $0x1
+  8018d1:	6a 07                	push   $0x7
+  8018d3:	68 00 f0 bf ee       	push   $0xeebff000
+  8018d8:	53                   	push   %ebx
+  8018d9:	e8 57 23 00 00       	call   803c35 <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8018de:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8018e3:	8b 40 74             	mov    0x74(%eax),%eax
+  8018e6:	83 c4 08             	add    $0x8,%esp
+  8018e9:	50                   	push   %eax
+  8018ea:	53                   	push   %ebx
+  8018eb:	e8 89 f8 ff ff       	call   801179 <sys_env_set_pgfault_upcall>
+  8018f0:	83 c4 10             	add    $0x10,%esp
+  8018f3:	e9 41 fc ff ff       	jmp    801539 <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8018f8:	e8 d8 f4 ff ff       	call   800dd5 <sys_getenvid>
+  8018fd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801902:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801905:	c1 e0 06             	shl    $0x6,%eax
+  801908:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80190d:	a3 18 f9 80 00       	mov    %eax,0x80f918
+		return 0;
+  801912:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801919:	e9 40 fc ff ff       	jmp    80155e <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  80191e:	50                   	push   %eax
+  80191f:	68 3f 5a 80 00       	push   $0x805a3f
+  801924:	68 27 01 00 00       	push   $0x127
+  801929:	68 eb 59 80 00       	push   $0x8059eb
+  80192e:	e8 2b e9 ff ff       	call   80025e <_panic>
+		panic("sys_env_set_status: %d", r);
+  801933:	50                   	push   %eax
+  801934:	68 58 5a 80 00       	push   $0x805a58
+  801939:	68 2b 01 00 00       	push   $0x12b
+  80193e:	68 eb 59 80 00       	push   $0x8059eb
+  801943:	e8 16 e9 ff ff       	call   80025e <_panic>
+
+00801948 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801948:	55                   	push   %ebp
+  801949:	89 e5                	mov    %esp,%ebp
+  80194b:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80194e:	68 6f 5a 80 00       	push   $0x805a6f
+  801953:	68 35 01 00 00       	push   $0x135
+  801958:	68 eb 59 80 00       	push   $0x8059eb
+  80195d:	e8 fc e8 ff ff       	call   80025e <_panic>
+
+00801962 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801962:	55                   	push   %ebp
+  801963:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801965:	8b 45 08             	mov    0x8(%ebp),%eax
+  801968:	05 00 00 00 30       	add    $0x30000000,%eax
+  80196d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801970:	5d                   	pop    %ebp
+  801971:	c3                   	ret
+
+00801972 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801972:	55                   	push   %ebp
+  801973:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801975:	8b 45 08             	mov    0x8(%ebp),%eax
+  801978:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80197d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801982:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801987:	5d                   	pop    %ebp
+  801988:	c3                   	ret
+
+00801989 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801989:	55                   	push   %ebp
+  80198a:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  80198c:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801991:	a8 01                	test   $0x1,%al
+  801993:	74 3c                	je     8019d1 <fd_alloc+0x48>
+  801995:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80199a:	89 c2                	mov    %eax,%edx
+  80199c:	c1 ea 0c             	shr    $0xc,%edx
+  80199f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019a6:	89 c1                	mov    %eax,%ecx
+  8019a8:	05 00 10 00 00       	add    $0x1000,%eax
+  8019ad:	f6 c2 01             	test   $0x1,%dl
+  8019b0:	74 13                	je     8019c5 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8019b2:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8019b7:	75 e1                	jne    80199a <fd_alloc+0x11>
+  8019b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8019be:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8019c3:	eb 05                	jmp    8019ca <fd_alloc+0x41>
+			return 0;
+  8019c5:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8019ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019cd:	89 0a                	mov    %ecx,(%edx)
+}
+  8019cf:	5d                   	pop    %ebp
+  8019d0:	c3                   	ret
+  8019d1:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8019d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019db:	eb ed                	jmp    8019ca <fd_alloc+0x41>
+
+008019dd <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8019dd:	55                   	push   %ebp
+  8019de:	89 e5                	mov    %esp,%ebp
+  8019e0:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8019e3:	83 f8 1f             	cmp    $0x1f,%eax
+  8019e6:	77 30                	ja     801a18 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8019e8:	c1 e0 0c             	shl    $0xc,%eax
+  8019eb:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8019f0:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8019f6:	f6 c2 01             	test   $0x1,%dl
+  8019f9:	74 24                	je     801a1f <fd_lookup+0x42>
+  8019fb:	89 c2                	mov    %eax,%edx
+  8019fd:	c1 ea 0c             	shr    $0xc,%edx
+  801a00:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a07:	f6 c2 01             	test   $0x1,%dl
+  801a0a:	74 1a                	je     801a26 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801a0c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a0f:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801a11:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a16:	5d                   	pop    %ebp
+  801a17:	c3                   	ret
+		return -E_INVAL;
+  801a18:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a1d:	eb f7                	jmp    801a16 <fd_lookup+0x39>
+		return -E_INVAL;
+  801a1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a24:	eb f0                	jmp    801a16 <fd_lookup+0x39>
+  801a26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a2b:	eb e9                	jmp    801a16 <fd_lookup+0x39>
+
+00801a2d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801a2d:	55                   	push   %ebp
+  801a2e:	89 e5                	mov    %esp,%ebp
+  801a30:	53                   	push   %ebx
+  801a31:	83 ec 04             	sub    $0x4,%esp
+  801a34:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801a37:	b8 04 5b 80 00       	mov    $0x805b04,%eax
+  801a3c:	8b 18                	mov    (%eax),%ebx
+  801a3e:	85 db                	test   %ebx,%ebx
+  801a40:	74 0e                	je     801a50 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801a42:	83 c0 04             	add    $0x4,%eax
+  801a45:	39 13                	cmp    %edx,(%ebx)
+  801a47:	75 f3                	jne    801a3c <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801a49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a4e:	eb 1f                	jmp    801a6f <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a50:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801a55:	8b 40 48             	mov    0x48(%eax),%eax
+  801a58:	83 ec 04             	sub    $0x4,%esp
+  801a5b:	52                   	push   %edx
+  801a5c:	50                   	push   %eax
+  801a5d:	68 88 5a 80 00       	push   $0x805a88
+  801a62:	e8 d2 e8 ff ff       	call   800339 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801a67:	83 c4 10             	add    $0x10,%esp
+  801a6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801a6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a72:	89 1a                	mov    %ebx,(%edx)
+}
+  801a74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a77:	c9                   	leave
+  801a78:	c3                   	ret
+
+00801a79 <fd_close>:
+{
+  801a79:	55                   	push   %ebp
+  801a7a:	89 e5                	mov    %esp,%ebp
+  801a7c:	57                   	push   %edi
+  801a7d:	56                   	push   %esi
+  801a7e:	53                   	push   %ebx
+  801a7f:	83 ec 24             	sub    $0x24,%esp
+  801a82:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a85:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a88:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a8b:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a8c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a92:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a95:	50                   	push   %eax
+  801a96:	e8 42 ff ff ff       	call   8019dd <fd_lookup>
+  801a9b:	89 c3                	mov    %eax,%ebx
+  801a9d:	83 c4 10             	add    $0x10,%esp
+  801aa0:	85 c0                	test   %eax,%eax
+  801aa2:	78 05                	js     801aa9 <fd_close+0x30>
+	    || fd != fd2)
+  801aa4:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801aa7:	74 16                	je     801abf <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801aa9:	89 f8                	mov    %edi,%eax
+  801aab:	84 c0                	test   %al,%al
+  801aad:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab2:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801ab5:	89 d8                	mov    %ebx,%eax
+  801ab7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aba:	5b                   	pop    %ebx
+  801abb:	5e                   	pop    %esi
+  801abc:	5f                   	pop    %edi
+  801abd:	5d                   	pop    %ebp
+  801abe:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801abf:	83 ec 08             	sub    $0x8,%esp
+  801ac2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801ac5:	50                   	push   %eax
+  801ac6:	ff 36                	push   (%esi)
+  801ac8:	e8 60 ff ff ff       	call   801a2d <dev_lookup>
+  801acd:	89 c3                	mov    %eax,%ebx
+  801acf:	83 c4 10             	add    $0x10,%esp
+  801ad2:	85 c0                	test   %eax,%eax
+  801ad4:	78 1a                	js     801af0 <fd_close+0x77>
+		if (dev->dev_close)
+  801ad6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ad9:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801adc:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801ae1:	85 c0                	test   %eax,%eax
+  801ae3:	74 0b                	je     801af0 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801ae5:	83 ec 0c             	sub    $0xc,%esp
+  801ae8:	56                   	push   %esi
+  801ae9:	ff d0                	call   *%eax
+  801aeb:	89 c3                	mov    %eax,%ebx
+  801aed:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801af0:	83 ec 08             	sub    $0x8,%esp
+  801af3:	56                   	push   %esi
+  801af4:	6a 00                	push   $0x0
+  801af6:	e8 9d f3 ff ff       	call   800e98 <sys_page_unmap>
+	return r;
+  801afb:	83 c4 10             	add    $0x10,%esp
+  801afe:	eb b5                	jmp    801ab5 <fd_close+0x3c>
+
+00801b00 <close>:
+
+int
+close(int fdnum)
+{
+  801b00:	55                   	push   %ebp
+  801b01:	89 e5                	mov    %esp,%ebp
+  801b03:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b09:	50                   	push   %eax
+  801b0a:	ff 75 08             	push   0x8(%ebp)
+  801b0d:	e8 cb fe ff ff       	call   8019dd <fd_lookup>
+  801b12:	83 c4 10             	add    $0x10,%esp
+  801b15:	85 c0                	test   %eax,%eax
+  801b17:	79 02                	jns    801b1b <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801b19:	c9                   	leave
+  801b1a:	c3                   	ret
+		return fd_close(fd, 1);
+  801b1b:	83 ec 08             	sub    $0x8,%esp
+  801b1e:	6a 01                	push   $0x1
+  801b20:	ff 75 f4             	push   -0xc(%ebp)
+  801b23:	e8 51 ff ff ff       	call   801a79 <fd_close>
+  801b28:	83 c4 10             	add    $0x10,%esp
+  801b2b:	eb ec                	jmp    801b19 <close+0x19>
+
+00801b2d <close_all>:
+
+void
+close_all(void)
+{
+  801b2d:	55                   	push   %ebp
+  801b2e:	89 e5                	mov    %esp,%ebp
+  801b30:	53                   	push   %ebx
+  801b31:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801b34:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801b39:	83 ec 0c             	sub    $0xc,%esp
+  801b3c:	53                   	push   %ebx
+  801b3d:	e8 be ff ff ff       	call   801b00 <close>
+	for (i = 0; i < MAXFD; i++)
+  801b42:	83 c3 01             	add    $0x1,%ebx
+  801b45:	83 c4 10             	add    $0x10,%esp
+  801b48:	83 fb 20             	cmp    $0x20,%ebx
+  801b4b:	75 ec                	jne    801b39 <close_all+0xc>
+}
+  801b4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b50:	c9                   	leave
+  801b51:	c3                   	ret
+
+00801b52 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801b52:	55                   	push   %ebp
+  801b53:	89 e5                	mov    %esp,%ebp
+  801b55:	57                   	push   %edi
+  801b56:	56                   	push   %esi
+  801b57:	53                   	push   %ebx
+  801b58:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801b5b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b5e:	50                   	push   %eax
+  801b5f:	ff 75 08             	push   0x8(%ebp)
+  801b62:	e8 76 fe ff ff       	call   8019dd <fd_lookup>
+  801b67:	89 c3                	mov    %eax,%ebx
+  801b69:	83 c4 10             	add    $0x10,%esp
+  801b6c:	85 c0                	test   %eax,%eax
+  801b6e:	78 7f                	js     801bef <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801b70:	83 ec 0c             	sub    $0xc,%esp
+  801b73:	ff 75 0c             	push   0xc(%ebp)
+  801b76:	e8 85 ff ff ff       	call   801b00 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801b7b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b7e:	c1 e6 0c             	shl    $0xc,%esi
+  801b81:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801b87:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b8a:	89 3c 24             	mov    %edi,(%esp)
+  801b8d:	e8 e0 fd ff ff       	call   801972 <fd2data>
+  801b92:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801b94:	89 34 24             	mov    %esi,(%esp)
+  801b97:	e8 d6 fd ff ff       	call   801972 <fd2data>
+  801b9c:	83 c4 10             	add    $0x10,%esp
+  801b9f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801ba2:	89 d8                	mov    %ebx,%eax
+  801ba4:	c1 e8 16             	shr    $0x16,%eax
+  801ba7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801bae:	a8 01                	test   $0x1,%al
+  801bb0:	74 11                	je     801bc3 <dup+0x71>
+  801bb2:	89 d8                	mov    %ebx,%eax
+  801bb4:	c1 e8 0c             	shr    $0xc,%eax
+  801bb7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801bbe:	f6 c2 01             	test   $0x1,%dl
+  801bc1:	75 36                	jne    801bf9 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801bc3:	89 f8                	mov    %edi,%eax
+  801bc5:	c1 e8 0c             	shr    $0xc,%eax
+  801bc8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801bcf:	83 ec 0c             	sub    $0xc,%esp
+  801bd2:	25 07 0e 00 00       	and    $0xe07,%eax
+  801bd7:	50                   	push   %eax
+  801bd8:	56                   	push   %esi
+  801bd9:	6a 00                	push   $0x0
+  801bdb:	57                   	push   %edi
+  801bdc:	6a 00                	push   $0x0
+  801bde:	e8 73 f2 ff ff       	call   800e56 <sys_page_map>
+  801be3:	89 c3                	mov    %eax,%ebx
+  801be5:	83 c4 20             	add    $0x20,%esp
+  801be8:	85 c0                	test   %eax,%eax
+  801bea:	78 33                	js     801c1f <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801bec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801bef:	89 d8                	mov    %ebx,%eax
+  801bf1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bf4:	5b                   	pop    %ebx
+  801bf5:	5e                   	pop    %esi
+  801bf6:	5f                   	pop    %edi
+  801bf7:	5d                   	pop    %ebp
+  801bf8:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801bf9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c00:	83 ec 0c             	sub    $0xc,%esp
+  801c03:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c08:	50                   	push   %eax
+  801c09:	ff 75 d4             	push   -0x2c(%ebp)
+  801c0c:	6a 00                	push   $0x0
+  801c0e:	53                   	push   %ebx
+  801c0f:	6a 00                	push   $0x0
+  801c11:	e8 40 f2 ff ff       	call   800e56 <sys_page_map>
+  801c16:	89 c3                	mov    %eax,%ebx
+  801c18:	83 c4 20             	add    $0x20,%esp
+  801c1b:	85 c0                	test   %eax,%eax
+  801c1d:	79 a4                	jns    801bc3 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801c1f:	83 ec 08             	sub    $0x8,%esp
+  801c22:	56                   	push   %esi
+  801c23:	6a 00                	push   $0x0
+  801c25:	e8 6e f2 ff ff       	call   800e98 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801c2a:	83 c4 08             	add    $0x8,%esp
+  801c2d:	ff 75 d4             	push   -0x2c(%ebp)
+  801c30:	6a 00                	push   $0x0
+  801c32:	e8 61 f2 ff ff       	call   800e98 <sys_page_unmap>
+	return r;
+  801c37:	83 c4 10             	add    $0x10,%esp
+  801c3a:	eb b3                	jmp    801bef <dup+0x9d>
+
+00801c3c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801c3c:	55                   	push   %ebp
+  801c3d:	89 e5                	mov    %esp,%ebp
+  801c3f:	56                   	push   %esi
+  801c40:	53                   	push   %ebx
+  801c41:	83 ec 18             	sub    $0x18,%esp
+  801c44:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c47:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c4a:	50                   	push   %eax
+  801c4b:	56                   	push   %esi
+  801c4c:	e8 8c fd ff ff       	call   8019dd <fd_lookup>
+  801c51:	83 c4 10             	add    $0x10,%esp
+  801c54:	85 c0                	test   %eax,%eax
+  801c56:	78 3c                	js     801c94 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c58:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801c5b:	83 ec 08             	sub    $0x8,%esp
+  801c5e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c61:	50                   	push   %eax
+  801c62:	ff 33                	push   (%ebx)
+  801c64:	e8 c4 fd ff ff       	call   801a2d <dev_lookup>
+  801c69:	83 c4 10             	add    $0x10,%esp
+  801c6c:	85 c0                	test   %eax,%eax
+  801c6e:	78 24                	js     801c94 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c70:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c73:	83 e0 03             	and    $0x3,%eax
+  801c76:	83 f8 01             	cmp    $0x1,%eax
+  801c79:	74 20                	je     801c9b <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801c7b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c7e:	8b 40 08             	mov    0x8(%eax),%eax
+  801c81:	85 c0                	test   %eax,%eax
+  801c83:	74 37                	je     801cbc <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801c85:	83 ec 04             	sub    $0x4,%esp
+  801c88:	ff 75 10             	push   0x10(%ebp)
+  801c8b:	ff 75 0c             	push   0xc(%ebp)
+  801c8e:	53                   	push   %ebx
+  801c8f:	ff d0                	call   *%eax
+  801c91:	83 c4 10             	add    $0x10,%esp
+}
+  801c94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c97:	5b                   	pop    %ebx
+  801c98:	5e                   	pop    %esi
+  801c99:	5d                   	pop    %ebp
+  801c9a:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c9b:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801ca0:	8b 40 48             	mov    0x48(%eax),%eax
+  801ca3:	83 ec 04             	sub    $0x4,%esp
+  801ca6:	56                   	push   %esi
+  801ca7:	50                   	push   %eax
+  801ca8:	68 c9 5a 80 00       	push   $0x805ac9
+  801cad:	e8 87 e6 ff ff       	call   800339 <cprintf>
+		return -E_INVAL;
+  801cb2:	83 c4 10             	add    $0x10,%esp
+  801cb5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cba:	eb d8                	jmp    801c94 <read+0x58>
+		return -E_NOT_SUPP;
+  801cbc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cc1:	eb d1                	jmp    801c94 <read+0x58>
+
+00801cc3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801cc3:	55                   	push   %ebp
+  801cc4:	89 e5                	mov    %esp,%ebp
+  801cc6:	57                   	push   %edi
+  801cc7:	56                   	push   %esi
+  801cc8:	53                   	push   %ebx
+  801cc9:	83 ec 0c             	sub    $0xc,%esp
+  801ccc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ccf:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801cd2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cd7:	eb 02                	jmp    801cdb <readn+0x18>
+  801cd9:	01 c3                	add    %eax,%ebx
+  801cdb:	39 f3                	cmp    %esi,%ebx
+  801cdd:	73 21                	jae    801d00 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801cdf:	83 ec 04             	sub    $0x4,%esp
+  801ce2:	89 f0                	mov    %esi,%eax
+  801ce4:	29 d8                	sub    %ebx,%eax
+  801ce6:	50                   	push   %eax
+  801ce7:	89 d8                	mov    %ebx,%eax
+  801ce9:	03 45 0c             	add    0xc(%ebp),%eax
+  801cec:	50                   	push   %eax
+  801ced:	57                   	push   %edi
+  801cee:	e8 49 ff ff ff       	call   801c3c <read>
+		if (m < 0)
+  801cf3:	83 c4 10             	add    $0x10,%esp
+  801cf6:	85 c0                	test   %eax,%eax
+  801cf8:	78 04                	js     801cfe <readn+0x3b>
+			return m;
+		if (m == 0)
+  801cfa:	75 dd                	jne    801cd9 <readn+0x16>
+  801cfc:	eb 02                	jmp    801d00 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801cfe:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801d00:	89 d8                	mov    %ebx,%eax
+  801d02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d05:	5b                   	pop    %ebx
+  801d06:	5e                   	pop    %esi
+  801d07:	5f                   	pop    %edi
+  801d08:	5d                   	pop    %ebp
+  801d09:	c3                   	ret
+
+00801d0a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801d0a:	55                   	push   %ebp
+  801d0b:	89 e5                	mov    %esp,%ebp
+  801d0d:	56                   	push   %esi
+  801d0e:	53                   	push   %ebx
+  801d0f:	83 ec 18             	sub    $0x18,%esp
+  801d12:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d15:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d18:	50                   	push   %eax
+  801d19:	53                   	push   %ebx
+  801d1a:	e8 be fc ff ff       	call   8019dd <fd_lookup>
+  801d1f:	83 c4 10             	add    $0x10,%esp
+  801d22:	85 c0                	test   %eax,%eax
+  801d24:	78 37                	js     801d5d <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d26:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d29:	83 ec 08             	sub    $0x8,%esp
+  801d2c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d2f:	50                   	push   %eax
+  801d30:	ff 36                	push   (%esi)
+  801d32:	e8 f6 fc ff ff       	call   801a2d <dev_lookup>
+  801d37:	83 c4 10             	add    $0x10,%esp
+  801d3a:	85 c0                	test   %eax,%eax
+  801d3c:	78 1f                	js     801d5d <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d3e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d42:	74 20                	je     801d64 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801d44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d47:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d4a:	85 c0                	test   %eax,%eax
+  801d4c:	74 37                	je     801d85 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801d4e:	83 ec 04             	sub    $0x4,%esp
+  801d51:	ff 75 10             	push   0x10(%ebp)
+  801d54:	ff 75 0c             	push   0xc(%ebp)
+  801d57:	56                   	push   %esi
+  801d58:	ff d0                	call   *%eax
+  801d5a:	83 c4 10             	add    $0x10,%esp
+}
+  801d5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d60:	5b                   	pop    %ebx
+  801d61:	5e                   	pop    %esi
+  801d62:	5d                   	pop    %ebp
+  801d63:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d64:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801d69:	8b 40 48             	mov    0x48(%eax),%eax
+  801d6c:	83 ec 04             	sub    $0x4,%esp
+  801d6f:	53                   	push   %ebx
+  801d70:	50                   	push   %eax
+  801d71:	68 e5 5a 80 00       	push   $0x805ae5
+  801d76:	e8 be e5 ff ff       	call   800339 <cprintf>
+		return -E_INVAL;
+  801d7b:	83 c4 10             	add    $0x10,%esp
+  801d7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d83:	eb d8                	jmp    801d5d <write+0x53>
+		return -E_NOT_SUPP;
+  801d85:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d8a:	eb d1                	jmp    801d5d <write+0x53>
+
+00801d8c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d8c:	55                   	push   %ebp
+  801d8d:	89 e5                	mov    %esp,%ebp
+  801d8f:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d92:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d95:	50                   	push   %eax
+  801d96:	ff 75 08             	push   0x8(%ebp)
+  801d99:	e8 3f fc ff ff       	call   8019dd <fd_lookup>
+  801d9e:	83 c4 10             	add    $0x10,%esp
+  801da1:	85 c0                	test   %eax,%eax
+  801da3:	78 0e                	js     801db3 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801da5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801da8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dab:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801dae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801db3:	c9                   	leave
+  801db4:	c3                   	ret
+
+00801db5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801db5:	55                   	push   %ebp
+  801db6:	89 e5                	mov    %esp,%ebp
+  801db8:	56                   	push   %esi
+  801db9:	53                   	push   %ebx
+  801dba:	83 ec 18             	sub    $0x18,%esp
+  801dbd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dc0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dc3:	50                   	push   %eax
+  801dc4:	53                   	push   %ebx
+  801dc5:	e8 13 fc ff ff       	call   8019dd <fd_lookup>
+  801dca:	83 c4 10             	add    $0x10,%esp
+  801dcd:	85 c0                	test   %eax,%eax
+  801dcf:	78 34                	js     801e05 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dd1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dd4:	83 ec 08             	sub    $0x8,%esp
+  801dd7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dda:	50                   	push   %eax
+  801ddb:	ff 36                	push   (%esi)
+  801ddd:	e8 4b fc ff ff       	call   801a2d <dev_lookup>
+  801de2:	83 c4 10             	add    $0x10,%esp
+  801de5:	85 c0                	test   %eax,%eax
+  801de7:	78 1c                	js     801e05 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801de9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ded:	74 1d                	je     801e0c <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801def:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801df2:	8b 40 18             	mov    0x18(%eax),%eax
+  801df5:	85 c0                	test   %eax,%eax
+  801df7:	74 34                	je     801e2d <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801df9:	83 ec 08             	sub    $0x8,%esp
+  801dfc:	ff 75 0c             	push   0xc(%ebp)
+  801dff:	56                   	push   %esi
+  801e00:	ff d0                	call   *%eax
+  801e02:	83 c4 10             	add    $0x10,%esp
+}
+  801e05:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e08:	5b                   	pop    %ebx
+  801e09:	5e                   	pop    %esi
+  801e0a:	5d                   	pop    %ebp
+  801e0b:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801e0c:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801e11:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e14:	83 ec 04             	sub    $0x4,%esp
+  801e17:	53                   	push   %ebx
+  801e18:	50                   	push   %eax
+  801e19:	68 a8 5a 80 00       	push   $0x805aa8
+  801e1e:	e8 16 e5 ff ff       	call   800339 <cprintf>
+		return -E_INVAL;
+  801e23:	83 c4 10             	add    $0x10,%esp
+  801e26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e2b:	eb d8                	jmp    801e05 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801e2d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e32:	eb d1                	jmp    801e05 <ftruncate+0x50>
+
+00801e34 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801e34:	55                   	push   %ebp
+  801e35:	89 e5                	mov    %esp,%ebp
+  801e37:	56                   	push   %esi
+  801e38:	53                   	push   %ebx
+  801e39:	83 ec 18             	sub    $0x18,%esp
+  801e3c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e3f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e42:	50                   	push   %eax
+  801e43:	ff 75 08             	push   0x8(%ebp)
+  801e46:	e8 92 fb ff ff       	call   8019dd <fd_lookup>
+  801e4b:	83 c4 10             	add    $0x10,%esp
+  801e4e:	85 c0                	test   %eax,%eax
+  801e50:	78 49                	js     801e9b <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e52:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e55:	83 ec 08             	sub    $0x8,%esp
+  801e58:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e5b:	50                   	push   %eax
+  801e5c:	ff 36                	push   (%esi)
+  801e5e:	e8 ca fb ff ff       	call   801a2d <dev_lookup>
+  801e63:	83 c4 10             	add    $0x10,%esp
+  801e66:	85 c0                	test   %eax,%eax
+  801e68:	78 31                	js     801e9b <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e6d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e71:	74 2f                	je     801ea2 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e73:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e76:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e7d:	00 00 00 
+	stat->st_isdir = 0;
+  801e80:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e87:	00 00 00 
+	stat->st_dev = dev;
+  801e8a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e90:	83 ec 08             	sub    $0x8,%esp
+  801e93:	53                   	push   %ebx
+  801e94:	56                   	push   %esi
+  801e95:	ff 50 14             	call   *0x14(%eax)
+  801e98:	83 c4 10             	add    $0x10,%esp
+}
+  801e9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e9e:	5b                   	pop    %ebx
+  801e9f:	5e                   	pop    %esi
+  801ea0:	5d                   	pop    %ebp
+  801ea1:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ea2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ea7:	eb f2                	jmp    801e9b <fstat+0x67>
+
+00801ea9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801ea9:	55                   	push   %ebp
+  801eaa:	89 e5                	mov    %esp,%ebp
+  801eac:	56                   	push   %esi
+  801ead:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801eae:	83 ec 08             	sub    $0x8,%esp
+  801eb1:	6a 00                	push   $0x0
+  801eb3:	ff 75 08             	push   0x8(%ebp)
+  801eb6:	e8 bc 02 00 00       	call   802177 <open>
+  801ebb:	89 c3                	mov    %eax,%ebx
+  801ebd:	83 c4 10             	add    $0x10,%esp
+  801ec0:	85 c0                	test   %eax,%eax
+  801ec2:	78 1b                	js     801edf <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801ec4:	83 ec 08             	sub    $0x8,%esp
+  801ec7:	ff 75 0c             	push   0xc(%ebp)
+  801eca:	50                   	push   %eax
+  801ecb:	e8 64 ff ff ff       	call   801e34 <fstat>
+  801ed0:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801ed2:	89 1c 24             	mov    %ebx,(%esp)
+  801ed5:	e8 26 fc ff ff       	call   801b00 <close>
+	return r;
+  801eda:	83 c4 10             	add    $0x10,%esp
+  801edd:	89 f3                	mov    %esi,%ebx
+}
+  801edf:	89 d8                	mov    %ebx,%eax
+  801ee1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ee4:	5b                   	pop    %ebx
+  801ee5:	5e                   	pop    %esi
+  801ee6:	5d                   	pop    %ebp
+  801ee7:	c3                   	ret
+
+00801ee8 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801ee8:	55                   	push   %ebp
+  801ee9:	89 e5                	mov    %esp,%ebp
+  801eeb:	57                   	push   %edi
+  801eec:	56                   	push   %esi
+  801eed:	53                   	push   %ebx
+  801eee:	83 ec 0c             	sub    $0xc,%esp
+  801ef1:	89 c7                	mov    %eax,%edi
+  801ef3:	89 d3                	mov    %edx,%ebx
+  801ef5:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801ef7:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  801efe:	74 2d                	je     801f2d <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801f00:	6a 07                	push   $0x7
+  801f02:	68 00 00 81 00       	push   $0x810000
+  801f07:	57                   	push   %edi
+  801f08:	ff 35 00 80 80 00    	push   0x808000
+  801f0e:	e8 ba 31 00 00       	call   8050cd <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801f13:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801f1a:	6a 00                	push   $0x0
+  801f1c:	56                   	push   %esi
+  801f1d:	53                   	push   %ebx
+  801f1e:	6a 00                	push   $0x0
+  801f20:	e8 5a 30 00 00       	call   804f7f <ipc_recv_pages>
+}
+  801f25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f28:	5b                   	pop    %ebx
+  801f29:	5e                   	pop    %esi
+  801f2a:	5f                   	pop    %edi
+  801f2b:	5d                   	pop    %ebp
+  801f2c:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f2d:	83 ec 0c             	sub    $0xc,%esp
+  801f30:	6a 01                	push   $0x1
+  801f32:	e8 8b 32 00 00       	call   8051c2 <ipc_find_env>
+  801f37:	a3 00 80 80 00       	mov    %eax,0x808000
+  801f3c:	83 c4 10             	add    $0x10,%esp
+  801f3f:	eb bf                	jmp    801f00 <fsipc_pages+0x18>
+
+00801f41 <fsipc>:
+{
+  801f41:	55                   	push   %ebp
+  801f42:	89 e5                	mov    %esp,%ebp
+  801f44:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801f47:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f4c:	e8 97 ff ff ff       	call   801ee8 <fsipc_pages>
+}
+  801f51:	c9                   	leave
+  801f52:	c3                   	ret
+
+00801f53 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801f53:	55                   	push   %ebp
+  801f54:	89 e5                	mov    %esp,%ebp
+  801f56:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f59:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f5f:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.set_size.req_size = newsize;
+  801f64:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f67:	a3 04 00 81 00       	mov    %eax,0x810004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801f6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f71:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f76:	e8 c6 ff ff ff       	call   801f41 <fsipc>
+}
+  801f7b:	c9                   	leave
+  801f7c:	c3                   	ret
+
+00801f7d <devfile_flush>:
+{
+  801f7d:	55                   	push   %ebp
+  801f7e:	89 e5                	mov    %esp,%ebp
+  801f80:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f83:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f86:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f89:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801f8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f93:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f98:	e8 a4 ff ff ff       	call   801f41 <fsipc>
+}
+  801f9d:	c9                   	leave
+  801f9e:	c3                   	ret
+
+00801f9f <devfile_stat>:
+{
+  801f9f:	55                   	push   %ebp
+  801fa0:	89 e5                	mov    %esp,%ebp
+  801fa2:	53                   	push   %ebx
+  801fa3:	83 ec 04             	sub    $0x4,%esp
+  801fa6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801fa9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fac:	8b 40 0c             	mov    0xc(%eax),%eax
+  801faf:	a3 00 00 81 00       	mov    %eax,0x810000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801fb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fb9:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fbe:	e8 7e ff ff ff       	call   801f41 <fsipc>
+  801fc3:	85 c0                	test   %eax,%eax
+  801fc5:	78 2c                	js     801ff3 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801fc7:	83 ec 08             	sub    $0x8,%esp
+  801fca:	68 00 00 81 00       	push   $0x810000
+  801fcf:	53                   	push   %ebx
+  801fd0:	e8 4b e9 ff ff       	call   800920 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801fd5:	a1 80 00 81 00       	mov    0x810080,%eax
+  801fda:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801fe0:	a1 84 00 81 00       	mov    0x810084,%eax
+  801fe5:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801feb:	83 c4 10             	add    $0x10,%esp
+  801fee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ff3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ff6:	c9                   	leave
+  801ff7:	c3                   	ret
+
+00801ff8 <devfile_write>:
+{
+  801ff8:	55                   	push   %ebp
+  801ff9:	89 e5                	mov    %esp,%ebp
+  801ffb:	83 ec 0c             	sub    $0xc,%esp
+  801ffe:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802001:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802006:	39 d0                	cmp    %edx,%eax
+  802008:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80200b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80200e:	8b 52 0c             	mov    0xc(%edx),%edx
+  802011:	89 15 00 00 81 00    	mov    %edx,0x810000
+	fsipcbuf.write.req_n = n;
+  802017:	a3 04 00 81 00       	mov    %eax,0x810004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80201c:	50                   	push   %eax
+  80201d:	ff 75 0c             	push   0xc(%ebp)
+  802020:	68 08 00 81 00       	push   $0x810008
+  802025:	e8 7c ea ff ff       	call   800aa6 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  80202a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80202f:	b8 04 00 00 00       	mov    $0x4,%eax
+  802034:	e8 08 ff ff ff       	call   801f41 <fsipc>
+}
+  802039:	c9                   	leave
+  80203a:	c3                   	ret
+
+0080203b <devfile_read>:
+{
+  80203b:	55                   	push   %ebp
+  80203c:	89 e5                	mov    %esp,%ebp
+  80203e:	57                   	push   %edi
+  80203f:	56                   	push   %esi
+  802040:	53                   	push   %ebx
+  802041:	83 ec 1c             	sub    $0x1c,%esp
+  802044:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802047:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  80204a:	89 fe                	mov    %edi,%esi
+  80204c:	c1 ee 0c             	shr    $0xc,%esi
+  80204f:	b8 20 00 00 00       	mov    $0x20,%eax
+  802054:	39 c6                	cmp    %eax,%esi
+  802056:	0f 47 f0             	cmova  %eax,%esi
+  802059:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80205c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802061:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802064:	eb 14                	jmp    80207a <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802066:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  80206d:	05 00 10 00 00       	add    $0x1000,%eax
+  802072:	f6 c6 06             	test   $0x6,%dh
+  802075:	75 42                	jne    8020b9 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802077:	83 c1 01             	add    $0x1,%ecx
+  80207a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80207d:	39 f1                	cmp    %esi,%ecx
+  80207f:	0f 84 95 00 00 00    	je     80211a <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  802085:	89 c2                	mov    %eax,%edx
+  802087:	c1 ea 16             	shr    $0x16,%edx
+  80208a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802091:	f6 c2 01             	test   $0x1,%dl
+  802094:	74 23                	je     8020b9 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  802096:	89 c2                	mov    %eax,%edx
+  802098:	c1 ea 0c             	shr    $0xc,%edx
+  80209b:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8020a2:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  8020a8:	74 0f                	je     8020b9 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  8020aa:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8020b1:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  8020b7:	75 ad                	jne    802066 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  8020b9:	85 c9                	test   %ecx,%ecx
+  8020bb:	74 11                	je     8020ce <devfile_read+0x93>
+  8020bd:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  8020c4:	75 08                	jne    8020ce <devfile_read+0x93>
+  8020c6:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  8020cc:	74 50                	je     80211e <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020ce:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8020d1:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.read.req_n = n;
+  8020d6:	89 3d 04 00 81 00    	mov    %edi,0x810004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8020dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020e6:	e8 56 fe ff ff       	call   801f41 <fsipc>
+  8020eb:	89 c6                	mov    %eax,%esi
+  8020ed:	85 c0                	test   %eax,%eax
+  8020ef:	78 1f                	js     802110 <devfile_read+0xd5>
+	assert(r <= n);
+  8020f1:	39 c7                	cmp    %eax,%edi
+  8020f3:	72 50                	jb     802145 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  8020f5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8020fa:	7f 62                	jg     80215e <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  8020fc:	83 ec 04             	sub    $0x4,%esp
+  8020ff:	50                   	push   %eax
+  802100:	68 00 00 81 00       	push   $0x810000
+  802105:	ff 75 0c             	push   0xc(%ebp)
+  802108:	e8 99 e9 ff ff       	call   800aa6 <memmove>
+	return r;
+  80210d:	83 c4 10             	add    $0x10,%esp
+}
+  802110:	89 f0                	mov    %esi,%eax
+  802112:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802115:	5b                   	pop    %ebx
+  802116:	5e                   	pop    %esi
+  802117:	5f                   	pop    %edi
+  802118:	5d                   	pop    %ebp
+  802119:	c3                   	ret
+  80211a:	89 f1                	mov    %esi,%ecx
+  80211c:	eb 9b                	jmp    8020b9 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  80211e:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802121:	a3 00 00 81 00       	mov    %eax,0x810000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  802126:	89 c8                	mov    %ecx,%eax
+  802128:	c1 e0 0c             	shl    $0xc,%eax
+  80212b:	a3 04 00 81 00       	mov    %eax,0x810004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  802130:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802133:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802138:	e8 ab fd ff ff       	call   801ee8 <fsipc_pages>
+  80213d:	89 c6                	mov    %eax,%esi
+  80213f:	85 c0                	test   %eax,%eax
+  802141:	78 8b                	js     8020ce <devfile_read+0x93>
+  802143:	eb cb                	jmp    802110 <devfile_read+0xd5>
+	assert(r <= n);
+  802145:	68 14 5b 80 00       	push   $0x805b14
+  80214a:	68 56 54 80 00       	push   $0x805456
+  80214f:	68 a0 00 00 00       	push   $0xa0
+  802154:	68 1b 5b 80 00       	push   $0x805b1b
+  802159:	e8 00 e1 ff ff       	call   80025e <_panic>
+	assert(r <= PGSIZE);
+  80215e:	68 26 5b 80 00       	push   $0x805b26
+  802163:	68 56 54 80 00       	push   $0x805456
+  802168:	68 a1 00 00 00       	push   $0xa1
+  80216d:	68 1b 5b 80 00       	push   $0x805b1b
+  802172:	e8 e7 e0 ff ff       	call   80025e <_panic>
+
+00802177 <open>:
+{
+  802177:	55                   	push   %ebp
+  802178:	89 e5                	mov    %esp,%ebp
+  80217a:	56                   	push   %esi
+  80217b:	53                   	push   %ebx
+  80217c:	83 ec 1c             	sub    $0x1c,%esp
+  80217f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802182:	56                   	push   %esi
+  802183:	e8 5d e7 ff ff       	call   8008e5 <strlen>
+  802188:	83 c4 10             	add    $0x10,%esp
+  80218b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802190:	7f 6c                	jg     8021fe <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802192:	83 ec 0c             	sub    $0xc,%esp
+  802195:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802198:	50                   	push   %eax
+  802199:	e8 eb f7 ff ff       	call   801989 <fd_alloc>
+  80219e:	89 c3                	mov    %eax,%ebx
+  8021a0:	83 c4 10             	add    $0x10,%esp
+  8021a3:	85 c0                	test   %eax,%eax
+  8021a5:	78 3c                	js     8021e3 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8021a7:	83 ec 08             	sub    $0x8,%esp
+  8021aa:	56                   	push   %esi
+  8021ab:	68 00 00 81 00       	push   $0x810000
+  8021b0:	e8 6b e7 ff ff       	call   800920 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8021b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021b8:	a3 00 04 81 00       	mov    %eax,0x810400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021bd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021c5:	e8 77 fd ff ff       	call   801f41 <fsipc>
+  8021ca:	89 c3                	mov    %eax,%ebx
+  8021cc:	83 c4 10             	add    $0x10,%esp
+  8021cf:	85 c0                	test   %eax,%eax
+  8021d1:	78 19                	js     8021ec <open+0x75>
+	return fd2num(fd);
+  8021d3:	83 ec 0c             	sub    $0xc,%esp
+  8021d6:	ff 75 f4             	push   -0xc(%ebp)
+  8021d9:	e8 84 f7 ff ff       	call   801962 <fd2num>
+  8021de:	89 c3                	mov    %eax,%ebx
+  8021e0:	83 c4 10             	add    $0x10,%esp
+}
+  8021e3:	89 d8                	mov    %ebx,%eax
+  8021e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021e8:	5b                   	pop    %ebx
+  8021e9:	5e                   	pop    %esi
+  8021ea:	5d                   	pop    %ebp
+  8021eb:	c3                   	ret
+		fd_close(fd, 0);
+  8021ec:	83 ec 08             	sub    $0x8,%esp
+  8021ef:	6a 00                	push   $0x0
+  8021f1:	ff 75 f4             	push   -0xc(%ebp)
+  8021f4:	e8 80 f8 ff ff       	call   801a79 <fd_close>
+		return r;
+  8021f9:	83 c4 10             	add    $0x10,%esp
+  8021fc:	eb e5                	jmp    8021e3 <open+0x6c>
+		return -E_BAD_PATH;
+  8021fe:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802203:	eb de                	jmp    8021e3 <open+0x6c>
+
+00802205 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802205:	55                   	push   %ebp
+  802206:	89 e5                	mov    %esp,%ebp
+  802208:	53                   	push   %ebx
+  802209:	83 ec 10             	sub    $0x10,%esp
+  80220c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80220f:	53                   	push   %ebx
+  802210:	e8 d0 e6 ff ff       	call   8008e5 <strlen>
+  802215:	83 c4 10             	add    $0x10,%esp
+  802218:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80221d:	7f 25                	jg     802244 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80221f:	83 ec 08             	sub    $0x8,%esp
+  802222:	53                   	push   %ebx
+  802223:	68 00 00 81 00       	push   $0x810000
+  802228:	e8 f3 e6 ff ff       	call   800920 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80222d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802232:	b8 07 00 00 00       	mov    $0x7,%eax
+  802237:	e8 05 fd ff ff       	call   801f41 <fsipc>
+  80223c:	83 c4 10             	add    $0x10,%esp
+}
+  80223f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802242:	c9                   	leave
+  802243:	c3                   	ret
+		return -E_BAD_PATH;
+  802244:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802249:	eb f4                	jmp    80223f <remove+0x3a>
+
+0080224b <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80224b:	55                   	push   %ebp
+  80224c:	89 e5                	mov    %esp,%ebp
+  80224e:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802251:	ba 00 00 00 00       	mov    $0x0,%edx
+  802256:	b8 08 00 00 00       	mov    $0x8,%eax
+  80225b:	e8 e1 fc ff ff       	call   801f41 <fsipc>
+}
+  802260:	c9                   	leave
+  802261:	c3                   	ret
+
+00802262 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  802262:	55                   	push   %ebp
+  802263:	89 e5                	mov    %esp,%ebp
+  802265:	53                   	push   %ebx
+  802266:	83 ec 04             	sub    $0x4,%esp
+  802269:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  80226c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802271:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802276:	e8 c6 fc ff ff       	call   801f41 <fsipc>
+  80227b:	85 c0                	test   %eax,%eax
+  80227d:	78 3c                	js     8022bb <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  80227f:	a1 00 00 81 00       	mov    0x810000,%eax
+  802284:	89 03                	mov    %eax,(%ebx)
+  802286:	a1 04 00 81 00       	mov    0x810004,%eax
+  80228b:	89 43 04             	mov    %eax,0x4(%ebx)
+  80228e:	a1 08 00 81 00       	mov    0x810008,%eax
+  802293:	89 43 08             	mov    %eax,0x8(%ebx)
+  802296:	a1 0c 00 81 00       	mov    0x81000c,%eax
+  80229b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80229e:	a1 10 00 81 00       	mov    0x810010,%eax
+  8022a3:	89 43 10             	mov    %eax,0x10(%ebx)
+  8022a6:	a1 14 00 81 00       	mov    0x810014,%eax
+  8022ab:	89 43 14             	mov    %eax,0x14(%ebx)
+  8022ae:	a1 18 00 81 00       	mov    0x810018,%eax
+  8022b3:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  8022b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022be:	c9                   	leave
+  8022bf:	c3                   	ret
+
+008022c0 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  8022c0:	55                   	push   %ebp
+  8022c1:	89 e5                	mov    %esp,%ebp
+  8022c3:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  8022c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c9:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_BCSET, NULL);
+  8022ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8022d8:	e8 64 fc ff ff       	call   801f41 <fsipc>
+}
+  8022dd:	c9                   	leave
+  8022de:	c3                   	ret
+
+008022df <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8022df:	55                   	push   %ebp
+  8022e0:	89 e5                	mov    %esp,%ebp
+  8022e2:	56                   	push   %esi
+  8022e3:	53                   	push   %ebx
+  8022e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8022e7:	83 ec 0c             	sub    $0xc,%esp
+  8022ea:	ff 75 08             	push   0x8(%ebp)
+  8022ed:	e8 80 f6 ff ff       	call   801972 <fd2data>
+  8022f2:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8022f4:	83 c4 08             	add    $0x8,%esp
+  8022f7:	68 32 5b 80 00       	push   $0x805b32
+  8022fc:	53                   	push   %ebx
+  8022fd:	e8 1e e6 ff ff       	call   800920 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802302:	8b 46 04             	mov    0x4(%esi),%eax
+  802305:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  80230b:	2b 0e                	sub    (%esi),%ecx
+  80230d:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802312:	89 c8                	mov    %ecx,%eax
+  802314:	f7 e2                	mul    %edx
+  802316:	c1 ea 0c             	shr    $0xc,%edx
+  802319:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80231f:	29 d1                	sub    %edx,%ecx
+  802321:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  802327:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80232e:	00 00 00 
+	stat->st_dev = &devpipe;
+  802331:	c7 83 88 00 00 00 20 	movl   $0x807020,0x88(%ebx)
+  802338:	70 80 00 
+	return 0;
+}
+  80233b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802340:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802343:	5b                   	pop    %ebx
+  802344:	5e                   	pop    %esi
+  802345:	5d                   	pop    %ebp
+  802346:	c3                   	ret
+
+00802347 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802347:	55                   	push   %ebp
+  802348:	89 e5                	mov    %esp,%ebp
+  80234a:	53                   	push   %ebx
+  80234b:	83 ec 0c             	sub    $0xc,%esp
+  80234e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802351:	53                   	push   %ebx
+  802352:	6a 00                	push   $0x0
+  802354:	e8 3f eb ff ff       	call   800e98 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802359:	89 1c 24             	mov    %ebx,(%esp)
+  80235c:	e8 11 f6 ff ff       	call   801972 <fd2data>
+  802361:	83 c4 08             	add    $0x8,%esp
+  802364:	50                   	push   %eax
+  802365:	6a 00                	push   $0x0
+  802367:	e8 2c eb ff ff       	call   800e98 <sys_page_unmap>
+}
+  80236c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80236f:	c9                   	leave
+  802370:	c3                   	ret
+
+00802371 <_pipeisclosed>:
+{
+  802371:	55                   	push   %ebp
+  802372:	89 e5                	mov    %esp,%ebp
+  802374:	57                   	push   %edi
+  802375:	56                   	push   %esi
+  802376:	53                   	push   %ebx
+  802377:	83 ec 1c             	sub    $0x1c,%esp
+  80237a:	89 c7                	mov    %eax,%edi
+  80237c:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80237e:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802383:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802386:	83 ec 0c             	sub    $0xc,%esp
+  802389:	57                   	push   %edi
+  80238a:	e8 72 2e 00 00       	call   805201 <pageref>
+  80238f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802392:	89 34 24             	mov    %esi,(%esp)
+  802395:	e8 67 2e 00 00       	call   805201 <pageref>
+		nn = thisenv->env_runs;
+  80239a:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  8023a0:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8023a3:	83 c4 10             	add    $0x10,%esp
+  8023a6:	39 cb                	cmp    %ecx,%ebx
+  8023a8:	74 1b                	je     8023c5 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8023aa:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8023ad:	75 cf                	jne    80237e <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8023af:	8b 42 58             	mov    0x58(%edx),%eax
+  8023b2:	6a 01                	push   $0x1
+  8023b4:	50                   	push   %eax
+  8023b5:	53                   	push   %ebx
+  8023b6:	68 39 5b 80 00       	push   $0x805b39
+  8023bb:	e8 79 df ff ff       	call   800339 <cprintf>
+  8023c0:	83 c4 10             	add    $0x10,%esp
+  8023c3:	eb b9                	jmp    80237e <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8023c5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8023c8:	0f 94 c0             	sete   %al
+  8023cb:	0f b6 c0             	movzbl %al,%eax
+}
+  8023ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023d1:	5b                   	pop    %ebx
+  8023d2:	5e                   	pop    %esi
+  8023d3:	5f                   	pop    %edi
+  8023d4:	5d                   	pop    %ebp
+  8023d5:	c3                   	ret
+
+008023d6 <devpipe_read>:
+{
+  8023d6:	55                   	push   %ebp
+  8023d7:	89 e5                	mov    %esp,%ebp
+  8023d9:	57                   	push   %edi
+  8023da:	56                   	push   %esi
+  8023db:	53                   	push   %ebx
+  8023dc:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8023df:	ff 75 08             	push   0x8(%ebp)
+  8023e2:	e8 8b f5 ff ff       	call   801972 <fd2data>
+  8023e7:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8023e9:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8023ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8023ef:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8023f2:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8023f5:	8b 0b                	mov    (%ebx),%ecx
+  8023f7:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8023fd:	29 ce                	sub    %ecx,%esi
+  8023ff:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802404:	f7 e6                	mul    %esi
+  802406:	c1 ea 0c             	shr    $0xc,%edx
+  802409:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  80240f:	29 c6                	sub    %eax,%esi
+  802411:	89 f2                	mov    %esi,%edx
+  802413:	75 43                	jne    802458 <devpipe_read+0x82>
+		ref = pageref(p);
+  802415:	83 ec 0c             	sub    $0xc,%esp
+  802418:	53                   	push   %ebx
+  802419:	e8 e3 2d 00 00       	call   805201 <pageref>
+  80241e:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  802420:	89 da                	mov    %ebx,%edx
+  802422:	8b 45 08             	mov    0x8(%ebp),%eax
+  802425:	e8 47 ff ff ff       	call   802371 <_pipeisclosed>
+  80242a:	83 c4 10             	add    $0x10,%esp
+  80242d:	85 c0                	test   %eax,%eax
+  80242f:	0f 85 c1 00 00 00    	jne    8024f6 <devpipe_read+0x120>
+	*sleeping = 1;
+  802435:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  80243c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802441:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  802444:	75 ac                	jne    8023f2 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  802446:	83 ec 04             	sub    $0x4,%esp
+  802449:	56                   	push   %esi
+  80244a:	57                   	push   %edi
+  80244b:	ff 75 e4             	push   -0x1c(%ebp)
+  80244e:	e8 99 ee ff ff       	call   8012ec <sys_futex_wait>
+  802453:	83 c4 10             	add    $0x10,%esp
+  802456:	eb 9a                	jmp    8023f2 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  802458:	39 75 10             	cmp    %esi,0x10(%ebp)
+  80245b:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  80245f:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802461:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802466:	f7 e1                	mul    %ecx
+  802468:	c1 ea 0b             	shr    $0xb,%edx
+  80246b:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802471:	29 c1                	sub    %eax,%ecx
+  802473:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  802475:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80247a:	29 cf                	sub    %ecx,%edi
+  80247c:	39 f7                	cmp    %esi,%edi
+  80247e:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  802481:	8d 43 10             	lea    0x10(%ebx),%eax
+  802484:	83 ec 04             	sub    $0x4,%esp
+  802487:	57                   	push   %edi
+  802488:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80248b:	01 c2                	add    %eax,%edx
+  80248d:	52                   	push   %edx
+  80248e:	ff 75 0c             	push   0xc(%ebp)
+  802491:	e8 10 e6 ff ff       	call   800aa6 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  802496:	83 c4 0c             	add    $0xc,%esp
+  802499:	89 f1                	mov    %esi,%ecx
+  80249b:	29 f9                	sub    %edi,%ecx
+  80249d:	51                   	push   %ecx
+  80249e:	ff 75 e4             	push   -0x1c(%ebp)
+  8024a1:	89 f8                	mov    %edi,%eax
+  8024a3:	03 45 0c             	add    0xc(%ebp),%eax
+  8024a6:	50                   	push   %eax
+  8024a7:	e8 fa e5 ff ff       	call   800aa6 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  8024ac:	89 f1                	mov    %esi,%ecx
+  8024ae:	03 0b                	add    (%ebx),%ecx
+  8024b0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8024b5:	f7 e1                	mul    %ecx
+  8024b7:	c1 ea 0c             	shr    $0xc,%edx
+  8024ba:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8024c0:	29 d1                	sub    %edx,%ecx
+  8024c2:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  8024c4:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8024c9:	83 c4 10             	add    $0x10,%esp
+  8024cc:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  8024d0:	75 0a                	jne    8024dc <devpipe_read+0x106>
+	return n;
+  8024d2:	89 f0                	mov    %esi,%eax
+}
+  8024d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024d7:	5b                   	pop    %ebx
+  8024d8:	5e                   	pop    %esi
+  8024d9:	5f                   	pop    %edi
+  8024da:	5d                   	pop    %ebp
+  8024db:	c3                   	ret
+		*sleeping = 0;
+  8024dc:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8024e3:	83 ec 08             	sub    $0x8,%esp
+  8024e6:	68 00 04 00 00       	push   $0x400
+  8024eb:	53                   	push   %ebx
+  8024ec:	e8 4b ee ff ff       	call   80133c <sys_futex_wake>
+  8024f1:	83 c4 10             	add    $0x10,%esp
+  8024f4:	eb dc                	jmp    8024d2 <devpipe_read+0xfc>
+			return 0;
+  8024f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024fb:	eb d7                	jmp    8024d4 <devpipe_read+0xfe>
+
+008024fd <devpipe_write>:
+{
+  8024fd:	55                   	push   %ebp
+  8024fe:	89 e5                	mov    %esp,%ebp
+  802500:	57                   	push   %edi
+  802501:	56                   	push   %esi
+  802502:	53                   	push   %ebx
+  802503:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802506:	ff 75 08             	push   0x8(%ebp)
+  802509:	e8 64 f4 ff ff       	call   801972 <fd2data>
+  80250e:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  802510:	83 c4 10             	add    $0x10,%esp
+  802513:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80251a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80251d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802520:	0f 83 23 01 00 00    	jae    802649 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802526:	8b 77 04             	mov    0x4(%edi),%esi
+  802529:	8b 1f                	mov    (%edi),%ebx
+  80252b:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  802531:	29 d9                	sub    %ebx,%ecx
+  802533:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802538:	f7 e1                	mul    %ecx
+  80253a:	c1 ea 0c             	shr    $0xc,%edx
+  80253d:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802543:	29 c1                	sub    %eax,%ecx
+  802545:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802547:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80254d:	75 40                	jne    80258f <devpipe_write+0x92>
+			ref = pageref(p);
+  80254f:	83 ec 0c             	sub    $0xc,%esp
+  802552:	57                   	push   %edi
+  802553:	e8 a9 2c 00 00       	call   805201 <pageref>
+  802558:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  80255a:	89 fa                	mov    %edi,%edx
+  80255c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80255f:	e8 0d fe ff ff       	call   802371 <_pipeisclosed>
+  802564:	83 c4 10             	add    $0x10,%esp
+  802567:	85 c0                	test   %eax,%eax
+  802569:	0f 85 d5 00 00 00    	jne    802644 <devpipe_write+0x147>
+	*sleeping = 1;
+  80256f:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  802576:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80257b:	39 1f                	cmp    %ebx,(%edi)
+  80257d:	75 a7                	jne    802526 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  80257f:	83 ec 04             	sub    $0x4,%esp
+  802582:	56                   	push   %esi
+  802583:	53                   	push   %ebx
+  802584:	57                   	push   %edi
+  802585:	e8 62 ed ff ff       	call   8012ec <sys_futex_wait>
+  80258a:	83 c4 10             	add    $0x10,%esp
+  80258d:	eb 97                	jmp    802526 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80258f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802592:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802595:	29 c1                	sub    %eax,%ecx
+  802597:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80259c:	89 d8                	mov    %ebx,%eax
+  80259e:	29 d0                	sub    %edx,%eax
+  8025a0:	39 c1                	cmp    %eax,%ecx
+  8025a2:	0f 46 c1             	cmovbe %ecx,%eax
+  8025a5:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  8025a7:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8025ac:	f7 e6                	mul    %esi
+  8025ae:	c1 ea 0b             	shr    $0xb,%edx
+  8025b1:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8025b7:	29 c6                	sub    %eax,%esi
+  8025b9:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8025bb:	29 f3                	sub    %esi,%ebx
+  8025bd:	39 cb                	cmp    %ecx,%ebx
+  8025bf:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8025c2:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  8025c5:	8d 77 10             	lea    0x10(%edi),%esi
+  8025c8:	83 ec 04             	sub    $0x4,%esp
+  8025cb:	53                   	push   %ebx
+  8025cc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025cf:	03 45 0c             	add    0xc(%ebp),%eax
+  8025d2:	50                   	push   %eax
+  8025d3:	01 f2                	add    %esi,%edx
+  8025d5:	52                   	push   %edx
+  8025d6:	e8 cb e4 ff ff       	call   800aa6 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8025db:	83 c4 0c             	add    $0xc,%esp
+  8025de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8025e1:	29 d8                	sub    %ebx,%eax
+  8025e3:	50                   	push   %eax
+  8025e4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025e7:	01 d3                	add    %edx,%ebx
+  8025e9:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8025ec:	53                   	push   %ebx
+  8025ed:	56                   	push   %esi
+  8025ee:	e8 b3 e4 ff ff       	call   800aa6 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8025f3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8025f6:	03 4f 04             	add    0x4(%edi),%ecx
+  8025f9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8025fe:	f7 e1                	mul    %ecx
+  802600:	c1 ea 0c             	shr    $0xc,%edx
+  802603:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802609:	29 d1                	sub    %edx,%ecx
+  80260b:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  80260e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802613:	83 c4 10             	add    $0x10,%esp
+  802616:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  80261a:	75 0b                	jne    802627 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  80261c:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  80261f:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802622:	e9 f3 fe ff ff       	jmp    80251a <devpipe_write+0x1d>
+		*sleeping = 0;
+  802627:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  80262e:	83 ec 08             	sub    $0x8,%esp
+  802631:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802636:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802639:	50                   	push   %eax
+  80263a:	e8 fd ec ff ff       	call   80133c <sys_futex_wake>
+  80263f:	83 c4 10             	add    $0x10,%esp
+  802642:	eb d8                	jmp    80261c <devpipe_write+0x11f>
+				return 0;
+  802644:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80264c:	5b                   	pop    %ebx
+  80264d:	5e                   	pop    %esi
+  80264e:	5f                   	pop    %edi
+  80264f:	5d                   	pop    %ebp
+  802650:	c3                   	ret
+
+00802651 <pipe>:
+{
+  802651:	55                   	push   %ebp
+  802652:	89 e5                	mov    %esp,%ebp
+  802654:	56                   	push   %esi
+  802655:	53                   	push   %ebx
+  802656:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802659:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80265c:	50                   	push   %eax
+  80265d:	e8 27 f3 ff ff       	call   801989 <fd_alloc>
+  802662:	89 c3                	mov    %eax,%ebx
+  802664:	83 c4 10             	add    $0x10,%esp
+  802667:	85 c0                	test   %eax,%eax
+  802669:	0f 88 23 01 00 00    	js     802792 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80266f:	83 ec 04             	sub    $0x4,%esp
+  802672:	68 07 04 00 00       	push   $0x407
+  802677:	ff 75 f4             	push   -0xc(%ebp)
+  80267a:	6a 00                	push   $0x0
+  80267c:	e8 92 e7 ff ff       	call   800e13 <sys_page_alloc>
+  802681:	89 c3                	mov    %eax,%ebx
+  802683:	83 c4 10             	add    $0x10,%esp
+  802686:	85 c0                	test   %eax,%eax
+  802688:	0f 88 04 01 00 00    	js     802792 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80268e:	83 ec 0c             	sub    $0xc,%esp
+  802691:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802694:	50                   	push   %eax
+  802695:	e8 ef f2 ff ff       	call   801989 <fd_alloc>
+  80269a:	89 c3                	mov    %eax,%ebx
+  80269c:	83 c4 10             	add    $0x10,%esp
+  80269f:	85 c0                	test   %eax,%eax
+  8026a1:	0f 88 db 00 00 00    	js     802782 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026a7:	83 ec 04             	sub    $0x4,%esp
+  8026aa:	68 07 04 00 00       	push   $0x407
+  8026af:	ff 75 f0             	push   -0x10(%ebp)
+  8026b2:	6a 00                	push   $0x0
+  8026b4:	e8 5a e7 ff ff       	call   800e13 <sys_page_alloc>
+  8026b9:	89 c3                	mov    %eax,%ebx
+  8026bb:	83 c4 10             	add    $0x10,%esp
+  8026be:	85 c0                	test   %eax,%eax
+  8026c0:	0f 88 bc 00 00 00    	js     802782 <pipe+0x131>
+	va = fd2data(fd0);
+  8026c6:	83 ec 0c             	sub    $0xc,%esp
+  8026c9:	ff 75 f4             	push   -0xc(%ebp)
+  8026cc:	e8 a1 f2 ff ff       	call   801972 <fd2data>
+  8026d1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026d3:	83 c4 0c             	add    $0xc,%esp
+  8026d6:	68 07 04 00 00       	push   $0x407
+  8026db:	50                   	push   %eax
+  8026dc:	6a 00                	push   $0x0
+  8026de:	e8 30 e7 ff ff       	call   800e13 <sys_page_alloc>
+  8026e3:	89 c3                	mov    %eax,%ebx
+  8026e5:	83 c4 10             	add    $0x10,%esp
+  8026e8:	85 c0                	test   %eax,%eax
+  8026ea:	0f 88 82 00 00 00    	js     802772 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026f0:	83 ec 0c             	sub    $0xc,%esp
+  8026f3:	ff 75 f0             	push   -0x10(%ebp)
+  8026f6:	e8 77 f2 ff ff       	call   801972 <fd2data>
+  8026fb:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802702:	50                   	push   %eax
+  802703:	6a 00                	push   $0x0
+  802705:	56                   	push   %esi
+  802706:	6a 00                	push   $0x0
+  802708:	e8 49 e7 ff ff       	call   800e56 <sys_page_map>
+  80270d:	89 c3                	mov    %eax,%ebx
+  80270f:	83 c4 20             	add    $0x20,%esp
+  802712:	85 c0                	test   %eax,%eax
+  802714:	78 4e                	js     802764 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802716:	a1 20 70 80 00       	mov    0x807020,%eax
+  80271b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80271e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802720:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802723:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80272a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80272d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80272f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802732:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802739:	83 ec 0c             	sub    $0xc,%esp
+  80273c:	ff 75 f4             	push   -0xc(%ebp)
+  80273f:	e8 1e f2 ff ff       	call   801962 <fd2num>
+  802744:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802747:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802749:	83 c4 04             	add    $0x4,%esp
+  80274c:	ff 75 f0             	push   -0x10(%ebp)
+  80274f:	e8 0e f2 ff ff       	call   801962 <fd2num>
+  802754:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802757:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80275a:	83 c4 10             	add    $0x10,%esp
+  80275d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802762:	eb 2e                	jmp    802792 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802764:	83 ec 08             	sub    $0x8,%esp
+  802767:	56                   	push   %esi
+  802768:	6a 00                	push   $0x0
+  80276a:	e8 29 e7 ff ff       	call   800e98 <sys_page_unmap>
+  80276f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802772:	83 ec 08             	sub    $0x8,%esp
+  802775:	ff 75 f0             	push   -0x10(%ebp)
+  802778:	6a 00                	push   $0x0
+  80277a:	e8 19 e7 ff ff       	call   800e98 <sys_page_unmap>
+  80277f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802782:	83 ec 08             	sub    $0x8,%esp
+  802785:	ff 75 f4             	push   -0xc(%ebp)
+  802788:	6a 00                	push   $0x0
+  80278a:	e8 09 e7 ff ff       	call   800e98 <sys_page_unmap>
+  80278f:	83 c4 10             	add    $0x10,%esp
+}
+  802792:	89 d8                	mov    %ebx,%eax
+  802794:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802797:	5b                   	pop    %ebx
+  802798:	5e                   	pop    %esi
+  802799:	5d                   	pop    %ebp
+  80279a:	c3                   	ret
+
+0080279b <pipeisclosed>:
+{
+  80279b:	55                   	push   %ebp
+  80279c:	89 e5                	mov    %esp,%ebp
+  80279e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027a4:	50                   	push   %eax
+  8027a5:	ff 75 08             	push   0x8(%ebp)
+  8027a8:	e8 30 f2 ff ff       	call   8019dd <fd_lookup>
+  8027ad:	83 c4 10             	add    $0x10,%esp
+  8027b0:	85 c0                	test   %eax,%eax
+  8027b2:	78 18                	js     8027cc <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8027b4:	83 ec 0c             	sub    $0xc,%esp
+  8027b7:	ff 75 f4             	push   -0xc(%ebp)
+  8027ba:	e8 b3 f1 ff ff       	call   801972 <fd2data>
+  8027bf:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8027c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027c4:	e8 a8 fb ff ff       	call   802371 <_pipeisclosed>
+  8027c9:	83 c4 10             	add    $0x10,%esp
+}
+  8027cc:	c9                   	leave
+  8027cd:	c3                   	ret
+
+008027ce <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8027ce:	55                   	push   %ebp
+  8027cf:	89 e5                	mov    %esp,%ebp
+  8027d1:	57                   	push   %edi
+  8027d2:	56                   	push   %esi
+  8027d3:	53                   	push   %ebx
+  8027d4:	83 ec 0c             	sub    $0xc,%esp
+  8027d7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	const volatile struct Env *e;
+	unsigned status;
+
+	assert(envid != 0);
+  8027da:	85 ff                	test   %edi,%edi
+  8027dc:	74 21                	je     8027ff <wait+0x31>
+	e = &envs[ENVX(envid)];
+  8027de:	89 f8                	mov    %edi,%eax
+  8027e0:	25 ff 03 00 00       	and    $0x3ff,%eax
+	// The kernel wakes us when it frees the environment.  Until then
+	// we sleep, unless its status changed since we looked.
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  8027e5:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  8027e8:	c1 e6 06             	shl    $0x6,%esi
+  8027eb:	81 c6 54 00 c0 ee    	add    $0xeec00054,%esi
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  8027f1:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  8027f4:	c1 e3 06             	shl    $0x6,%ebx
+  8027f7:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8027fd:	eb 25                	jmp    802824 <wait+0x56>
+	assert(envid != 0);
+  8027ff:	68 51 5b 80 00       	push   $0x805b51
+  802804:	68 56 54 80 00       	push   $0x805456
+  802809:	6a 0a                	push   $0xa
+  80280b:	68 5c 5b 80 00       	push   $0x805b5c
+  802810:	e8 49 da ff ff       	call   80025e <_panic>
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  802815:	83 ec 04             	sub    $0x4,%esp
+  802818:	6a ff                	push   $0xffffffff
+  80281a:	50                   	push   %eax
+  80281b:	56                   	push   %esi
+  80281c:	e8 cb ea ff ff       	call   8012ec <sys_futex_wait>
+  802821:	83 c4 10             	add    $0x10,%esp
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  802824:	8b 43 48             	mov    0x48(%ebx),%eax
+  802827:	39 f8                	cmp    %edi,%eax
+  802829:	75 07                	jne    802832 <wait+0x64>
+  80282b:	8b 43 54             	mov    0x54(%ebx),%eax
+  80282e:	85 c0                	test   %eax,%eax
+  802830:	75 e3                	jne    802815 <wait+0x47>
+}
+  802832:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802835:	5b                   	pop    %ebx
+  802836:	5e                   	pop    %esi
+  802837:	5f                   	pop    %edi
+  802838:	5d                   	pop    %ebp
+  802839:	c3                   	ret
+
+0080283a <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  80283a:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  80283c:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  802842:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802848:	81 c2 34 01 00 00    	add    $0x134,%edx
+  80284e:	39 d0                	cmp    %edx,%eax
+  802850:	74 2e                	je     802880 <segment_lookup+0x46>
+{
+  802852:	55                   	push   %ebp
+  802853:	89 e5                	mov    %esp,%ebp
+  802855:	57                   	push   %edi
+  802856:	56                   	push   %esi
+  802857:	53                   	push   %ebx
+  802858:	eb 07                	jmp    802861 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  80285a:	83 c0 20             	add    $0x20,%eax
+  80285d:	39 d0                	cmp    %edx,%eax
+  80285f:	74 15                	je     802876 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802861:	8b 18                	mov    (%eax),%ebx
+  802863:	39 d9                	cmp    %ebx,%ecx
+  802865:	72 f3                	jb     80285a <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  802867:	8b 38                	mov    (%eax),%edi
+  802869:	8b 58 04             	mov    0x4(%eax),%ebx
+  80286c:	89 ce                	mov    %ecx,%esi
+  80286e:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  802870:	39 de                	cmp    %ebx,%esi
+  802872:	73 e6                	jae    80285a <segment_lookup+0x20>
+  802874:	eb 05                	jmp    80287b <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  802876:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80287b:	5b                   	pop    %ebx
+  80287c:	5e                   	pop    %esi
+  80287d:	5f                   	pop    %edi
+  80287e:	5d                   	pop    %ebp
+  80287f:	c3                   	ret
+	return NULL;
+  802880:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802885:	c3                   	ret
+
+00802886 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802886:	55                   	push   %ebp
+  802887:	89 e5                	mov    %esp,%ebp
+  802889:	53                   	push   %ebx
+  80288a:	83 ec 04             	sub    $0x4,%esp
+  80288d:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80288f:	c1 e8 16             	shr    $0x16,%eax
+  802892:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802899:	25 81 00 00 00       	and    $0x81,%eax
+  80289e:	83 f8 01             	cmp    $0x1,%eax
+  8028a1:	75 6b                	jne    80290e <page_is_clean+0x88>
+  8028a3:	89 da                	mov    %ebx,%edx
+  8028a5:	c1 ea 0c             	shr    $0xc,%edx
+  8028a8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  8028af:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8028b4:	f6 c1 01             	test   $0x1,%cl
+  8028b7:	74 5a                	je     802913 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  8028b9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8028c0:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  8028c6:	75 4b                	jne    802913 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  8028c8:	89 d8                	mov    %ebx,%eax
+  8028ca:	e8 6b ff ff ff       	call   80283a <segment_lookup>
+  8028cf:	89 c2                	mov    %eax,%edx
+		return 1;
+  8028d1:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  8028d6:	85 d2                	test   %edx,%edx
+  8028d8:	75 39                	jne    802913 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  8028da:	8b 15 0c c0 80 00    	mov    0x80c00c,%edx
+  8028e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e5:	eb 03                	jmp    8028ea <page_is_clean+0x64>
+  8028e7:	83 c0 01             	add    $0x1,%eax
+  8028ea:	39 c2                	cmp    %eax,%edx
+  8028ec:	7e 19                	jle    802907 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  8028ee:	3b 1c c5 20 c0 80 00 	cmp    0x80c020(,%eax,8),%ebx
+  8028f5:	72 f0                	jb     8028e7 <page_is_clean+0x61>
+  8028f7:	3b 1c c5 24 c0 80 00 	cmp    0x80c024(,%eax,8),%ebx
+  8028fe:	73 e7                	jae    8028e7 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  802900:	b8 01 00 00 00       	mov    $0x1,%eax
+  802905:	eb 0c                	jmp    802913 <page_is_clean+0x8d>
+	return 0;
+  802907:	b8 00 00 00 00       	mov    $0x0,%eax
+  80290c:	eb 05                	jmp    802913 <page_is_clean+0x8d>
+		return 0;
+  80290e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802913:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802916:	c9                   	leave
+  802917:	c3                   	ret
+
+00802918 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  802918:	55                   	push   %ebp
+  802919:	89 e5                	mov    %esp,%ebp
+  80291b:	57                   	push   %edi
+  80291c:	56                   	push   %esi
+  80291d:	53                   	push   %ebx
+  80291e:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802921:	be 00 00 00 00       	mov    $0x0,%esi
+  802926:	eb 19                	jmp    802941 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802928:	f7 d3                	not    %ebx
+  80292a:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802930:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802932:	83 c6 01             	add    $0x1,%esi
+  802935:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  80293b:	0f 87 97 00 00 00    	ja     8029d8 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802941:	89 f3                	mov    %esi,%ebx
+  802943:	03 1d 34 90 80 00    	add    0x809034,%ebx
+  802949:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80294f:	89 d8                	mov    %ebx,%eax
+  802951:	c1 e8 0a             	shr    $0xa,%eax
+  802954:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80295b:	25 81 00 00 00       	and    $0x81,%eax
+  802960:	83 f8 01             	cmp    $0x1,%eax
+  802963:	75 c3                	jne    802928 <linear_walk+0x10>
+  802965:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80296b:	77 bb                	ja     802928 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  80296d:	89 df                	mov    %ebx,%edi
+  80296f:	c1 e7 0c             	shl    $0xc,%edi
+  802972:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802975:	89 f8                	mov    %edi,%eax
+  802977:	e8 0a ff ff ff       	call   802886 <page_is_clean>
+  80297c:	84 c0                	test   %al,%al
+  80297e:	75 64                	jne    8029e4 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802980:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802986:	77 aa                	ja     802932 <linear_walk+0x1a>
+  802988:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  80298e:	72 a2                	jb     802932 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802990:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802997:	a8 01                	test   $0x1,%al
+  802999:	74 97                	je     802932 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80299b:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8029a2:	f6 c4 04             	test   $0x4,%ah
+  8029a5:	75 8b                	jne    802932 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8029a7:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8029ae:	f6 c4 02             	test   $0x2,%ah
+  8029b1:	0f 85 7b ff ff ff    	jne    802932 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8029b7:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8029be:	c1 e8 0c             	shr    $0xc,%eax
+  8029c1:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8029c4:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8029c9:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8029cd:	66 83 f8 01          	cmp    $0x1,%ax
+  8029d1:	76 11                	jbe    8029e4 <linear_walk+0xcc>
+  8029d3:	e9 5a ff ff ff       	jmp    802932 <linear_walk+0x1a>
+  8029d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  8029dd:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  8029e4:	89 1d 34 90 80 00    	mov    %ebx,0x809034
+}
+  8029ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029ed:	83 c4 1c             	add    $0x1c,%esp
+  8029f0:	5b                   	pop    %ebx
+  8029f1:	5e                   	pop    %esi
+  8029f2:	5f                   	pop    %edi
+  8029f3:	5d                   	pop    %ebp
+  8029f4:	c3                   	ret
+
+008029f5 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  8029f5:	55                   	push   %ebp
+  8029f6:	89 e5                	mov    %esp,%ebp
+  8029f8:	56                   	push   %esi
+  8029f9:	53                   	push   %ebx
+  8029fa:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  8029fc:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802a01:	83 e0 7f             	and    $0x7f,%eax
+  802a04:	c1 e0 04             	shl    $0x4,%eax
+  802a07:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  802a0d:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802a13:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802a19:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  802a1f:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802a24:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  802a27:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802a2c:	83 c0 01             	add    $0x1,%eax
+  802a2f:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  802a34:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802a37:	5b                   	pop    %ebx
+  802a38:	5e                   	pop    %esi
+  802a39:	5d                   	pop    %ebp
+  802a3a:	c3                   	ret
+
+00802a3b <page_ring_enter>:
+{
+  802a3b:	55                   	push   %ebp
+  802a3c:	89 e5                	mov    %esp,%ebp
+  802a3e:	57                   	push   %edi
+  802a3f:	56                   	push   %esi
+  802a40:	53                   	push   %ebx
+  802a41:	83 ec 18             	sub    $0x18,%esp
+  802a44:	89 c6                	mov    %eax,%esi
+  802a46:	89 d7                	mov    %edx,%edi
+  802a48:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802a4a:	6a 00                	push   $0x0
+  802a4c:	6a 00                	push   $0x0
+  802a4e:	6a 00                	push   $0x0
+  802a50:	6a 07                	push   $0x7
+  802a52:	ff 35 40 c0 80 00    	push   0x80c040
+  802a58:	e8 8e 26 00 00       	call   8050eb <ipc_call>
+  802a5d:	83 c4 20             	add    $0x20,%esp
+  802a60:	85 c0                	test   %eax,%eax
+  802a62:	79 22                	jns    802a86 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802a64:	50                   	push   %eax
+  802a65:	68 67 5b 80 00       	push   $0x805b67
+  802a6a:	68 13 02 00 00       	push   $0x213
+  802a6f:	68 7b 5b 80 00       	push   $0x805b7b
+  802a74:	e8 e5 d7 ff ff       	call   80025e <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802a79:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802a7e:	83 c0 01             	add    $0x1,%eax
+  802a81:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802a86:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802a8c:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802a91:	39 c2                	cmp    %eax,%edx
+  802a93:	74 24                	je     802ab9 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802a95:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802a9a:	83 e0 7f             	and    $0x7f,%eax
+  802a9d:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802aa4:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802aab:	29 f0                	sub    %esi,%eax
+  802aad:	39 d8                	cmp    %ebx,%eax
+  802aaf:	73 c8                	jae    802a79 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802ab1:	8b 52 04             	mov    0x4(%edx),%edx
+  802ab4:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802ab7:	eb c0                	jmp    802a79 <page_ring_enter+0x3e>
+}
+  802ab9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802abc:	5b                   	pop    %ebx
+  802abd:	5e                   	pop    %esi
+  802abe:	5f                   	pop    %edi
+  802abf:	5d                   	pop    %ebp
+  802ac0:	c3                   	ret
+
+00802ac1 <page_ring_reserve>:
+{
+  802ac1:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802ac3:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802ac8:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802ace:	29 d0                	sub    %edx,%eax
+  802ad0:	ba 80 00 00 00       	mov    $0x80,%edx
+  802ad5:	29 ca                	sub    %ecx,%edx
+  802ad7:	39 c2                	cmp    %eax,%edx
+  802ad9:	72 01                	jb     802adc <page_ring_reserve+0x1b>
+  802adb:	c3                   	ret
+{
+  802adc:	55                   	push   %ebp
+  802add:	89 e5                	mov    %esp,%ebp
+  802adf:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802ae2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ae7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aec:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af1:	e8 45 ff ff ff       	call   802a3b <page_ring_enter>
+}
+  802af6:	c9                   	leave
+  802af7:	c3                   	ret
+
+00802af8 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802af8:	55                   	push   %ebp
+  802af9:	89 e5                	mov    %esp,%ebp
+  802afb:	53                   	push   %ebx
+  802afc:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802aff:	6a 07                	push   $0x7
+  802b01:	6a 01                	push   $0x1
+  802b03:	89 c3                	mov    %eax,%ebx
+  802b05:	c1 e3 0c             	shl    $0xc,%ebx
+  802b08:	8d 93 00 a0 80 00    	lea    0x80a000(%ebx),%edx
+  802b0e:	52                   	push   %edx
+  802b0f:	6a 04                	push   $0x4
+  802b11:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  802b18:	e8 ce 25 00 00       	call   8050eb <ipc_call>
+	sharereqs[i].nslots = 0;
+  802b1d:	c7 83 00 a0 80 00 00 	movl   $0x0,0x80a000(%ebx)
+  802b24:	00 00 00 
+	return r;
+}
+  802b27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b2a:	c9                   	leave
+  802b2b:	c3                   	ret
+
+00802b2c <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802b2c:	55                   	push   %ebp
+  802b2d:	89 e5                	mov    %esp,%ebp
+  802b2f:	56                   	push   %esi
+  802b30:	53                   	push   %ebx
+  802b31:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802b33:	c1 e8 10             	shr    $0x10,%eax
+  802b36:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802b39:	89 c2                	mov    %eax,%edx
+  802b3b:	c1 e2 0c             	shl    $0xc,%edx
+  802b3e:	8b b2 00 a0 80 00    	mov    0x80a000(%edx),%esi
+  802b44:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802b47:	89 9a 00 a0 80 00    	mov    %ebx,0x80a000(%edx)
+  802b4d:	89 c2                	mov    %eax,%edx
+  802b4f:	c1 e2 0a             	shl    $0xa,%edx
+  802b52:	01 f2                	add    %esi,%edx
+  802b54:	89 0c 95 04 a0 80 00 	mov    %ecx,0x80a004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802b5b:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802b61:	74 09                	je     802b6c <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802b63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b68:	5b                   	pop    %ebx
+  802b69:	5e                   	pop    %esi
+  802b6a:	5d                   	pop    %ebp
+  802b6b:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802b6c:	e8 87 ff ff ff       	call   802af8 <page_share_send>
+  802b71:	eb f5                	jmp    802b68 <page_share_slot+0x3c>
+
+00802b73 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802b73:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802b78:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802b7b:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802b80:	3b 15 00 c0 80 00    	cmp    0x80c000,%edx
+  802b86:	74 09                	je     802b91 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802b88:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  802b8d:	85 c0                	test   %eax,%eax
+  802b8f:	75 01                	jne    802b92 <page_ring_ready+0x1f>
+}
+  802b91:	c3                   	ret
+{
+  802b92:	55                   	push   %ebp
+  802b93:	89 e5                	mov    %esp,%ebp
+  802b95:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802b98:	68 07 06 00 00       	push   $0x607
+  802b9d:	6a 08                	push   $0x8
+  802b9f:	68 00 30 ad de       	push   $0xdead3000
+  802ba4:	6a 00                	push   $0x0
+  802ba6:	e8 93 e3 ff ff       	call   800f3e <sys_page_alloc_range>
+  802bab:	83 c4 10             	add    $0x10,%esp
+  802bae:	83 f8 08             	cmp    $0x8,%eax
+  802bb1:	74 1b                	je     802bce <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802bb3:	83 ec 04             	sub    $0x4,%esp
+  802bb6:	6a 08                	push   $0x8
+  802bb8:	68 00 30 ad de       	push   $0xdead3000
+  802bbd:	6a 00                	push   $0x0
+  802bbf:	e8 e8 e3 ff ff       	call   800fac <sys_page_unmap_range>
+		return 0;
+  802bc4:	83 c4 10             	add    $0x10,%esp
+  802bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bcc:	c9                   	leave
+  802bcd:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802bce:	83 ec 0c             	sub    $0xc,%esp
+  802bd1:	68 07 04 00 00       	push   $0x407
+  802bd6:	6a 08                	push   $0x8
+  802bd8:	68 00 30 ad de       	push   $0xdead3000
+  802bdd:	6a 06                	push   $0x6
+  802bdf:	ff 35 40 c0 80 00    	push   0x80c040
+  802be5:	e8 01 25 00 00       	call   8050eb <ipc_call>
+  802bea:	83 c4 20             	add    $0x20,%esp
+  802bed:	85 c0                	test   %eax,%eax
+  802bef:	78 14                	js     802c05 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802bf1:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802bf6:	8b 40 48             	mov    0x48(%eax),%eax
+  802bf9:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	return 1;
+  802bfe:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c03:	eb c7                	jmp    802bcc <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802c05:	83 ec 04             	sub    $0x4,%esp
+  802c08:	6a 08                	push   $0x8
+  802c0a:	68 00 30 ad de       	push   $0xdead3000
+  802c0f:	6a 00                	push   $0x0
+  802c11:	e8 96 e3 ff ff       	call   800fac <sys_page_unmap_range>
+		return 0;
+  802c16:	83 c4 10             	add    $0x10,%esp
+  802c19:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1e:	eb ac                	jmp    802bcc <page_ring_ready+0x59>
+
+00802c20 <page_remove_slot>:
+{
+  802c20:	55                   	push   %ebp
+  802c21:	89 e5                	mov    %esp,%ebp
+  802c23:	56                   	push   %esi
+  802c24:	53                   	push   %ebx
+  802c25:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802c27:	89 c6                	mov    %eax,%esi
+  802c29:	c1 ee 10             	shr    $0x10,%esi
+  802c2c:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802c2f:	8b 04 b5 44 c0 80 00 	mov    0x80c044(,%esi,4),%eax
+  802c36:	39 05 40 c0 80 00    	cmp    %eax,0x80c040
+  802c3c:	74 2a                	je     802c68 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802c3e:	83 ec 0c             	sub    $0xc,%esp
+  802c41:	6a 00                	push   $0x0
+  802c43:	6a 00                	push   $0x0
+  802c45:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802c47:	c1 e3 04             	shl    $0x4,%ebx
+  802c4a:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802c4d:	53                   	push   %ebx
+  802c4e:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  802c55:	e8 91 24 00 00       	call   8050eb <ipc_call>
+  802c5a:	83 c4 20             	add    $0x20,%esp
+  802c5d:	85 c0                	test   %eax,%eax
+  802c5f:	78 2d                	js     802c8e <page_remove_slot+0x6e>
+}
+  802c61:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c64:	5b                   	pop    %ebx
+  802c65:	5e                   	pop    %esi
+  802c66:	5d                   	pop    %ebp
+  802c67:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802c68:	e8 06 ff ff ff       	call   802b73 <page_ring_ready>
+  802c6d:	85 c0                	test   %eax,%eax
+  802c6f:	74 cd                	je     802c3e <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802c71:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c76:	e8 46 fe ff ff       	call   802ac1 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802c7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c80:	89 da                	mov    %ebx,%edx
+  802c82:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c87:	e8 69 fd ff ff       	call   8029f5 <page_ring_post>
+		return;
+  802c8c:	eb d3                	jmp    802c61 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802c8e:	50                   	push   %eax
+  802c8f:	68 d4 5b 80 00       	push   $0x805bd4
+  802c94:	68 ac 03 00 00       	push   $0x3ac
+  802c99:	68 7b 5b 80 00       	push   $0x805b7b
+  802c9e:	e8 bb d5 ff ff       	call   80025e <_panic>
+
+00802ca3 <find_paging_env>:
+	if(pagingenv)
+  802ca3:	a1 40 c0 80 00       	mov    0x80c040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802ca8:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802caa:	85 c0                	test   %eax,%eax
+  802cac:	74 05                	je     802cb3 <find_paging_env+0x10>
+  802cae:	eb 56                	jmp    802d06 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802cb0:	83 c0 01             	add    $0x1,%eax
+  802cb3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802cb8:	7f 47                	jg     802d01 <find_paging_env+0x5e>
+  802cba:	83 f9 01             	cmp    $0x1,%ecx
+  802cbd:	7f 42                	jg     802d01 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802cbf:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802cc2:	c1 e2 06             	shl    $0x6,%edx
+  802cc5:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802ccb:	8b 52 50             	mov    0x50(%edx),%edx
+  802cce:	83 fa 02             	cmp    $0x2,%edx
+  802cd1:	75 dd                	jne    802cb0 <find_paging_env+0xd>
+  802cd3:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802cd6:	c1 e2 06             	shl    $0x6,%edx
+  802cd9:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802cdf:	8b 52 54             	mov    0x54(%edx),%edx
+  802ce2:	85 d2                	test   %edx,%edx
+  802ce4:	74 ca                	je     802cb0 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802ce6:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802ce9:	c1 e2 06             	shl    $0x6,%edx
+  802cec:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802cf2:	8b 52 48             	mov    0x48(%edx),%edx
+  802cf5:	89 14 8d 44 c0 80 00 	mov    %edx,0x80c044(,%ecx,4)
+  802cfc:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802cff:	eb af                	jmp    802cb0 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802d01:	83 f9 02             	cmp    $0x2,%ecx
+  802d04:	74 01                	je     802d07 <find_paging_env+0x64>
+}
+  802d06:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802d07:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802d0c:	8b 40 48             	mov    0x48(%eax),%eax
+  802d0f:	83 e0 01             	and    $0x1,%eax
+  802d12:	8b 04 85 44 c0 80 00 	mov    0x80c044(,%eax,4),%eax
+  802d19:	a3 40 c0 80 00       	mov    %eax,0x80c040
+  802d1e:	eb e6                	jmp    802d06 <find_paging_env+0x63>
+
+00802d20 <page_add_backed>:
+{
+  802d20:	55                   	push   %ebp
+  802d21:	89 e5                	mov    %esp,%ebp
+  802d23:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802d26:	a1 0c c0 80 00       	mov    0x80c00c,%eax
+  802d2b:	83 f8 04             	cmp    $0x4,%eax
+  802d2e:	74 35                	je     802d65 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802d30:	89 d1                	mov    %edx,%ecx
+  802d32:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802d38:	89 0c c5 20 c0 80 00 	mov    %ecx,0x80c020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802d3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d42:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802d49:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802d4f:	89 14 c5 24 c0 80 00 	mov    %edx,0x80c024(,%eax,8)
+	num_backed_ranges++;
+  802d56:	83 c0 01             	add    $0x1,%eax
+  802d59:	a3 0c c0 80 00       	mov    %eax,0x80c00c
+	return 0;
+  802d5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d63:	5d                   	pop    %ebp
+  802d64:	c3                   	ret
+		return -E_NO_MEM;
+  802d65:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802d6a:	eb f7                	jmp    802d63 <page_add_backed+0x43>
+
+00802d6c <percentage_of_pgdir_to_walk>:
+{
+  802d6c:	55                   	push   %ebp
+  802d6d:	89 e5                	mov    %esp,%ebp
+  802d6f:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802d72:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802d76:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802d79:	db 45 fc             	fildl  -0x4(%ebp)
+  802d7c:	d8 35 60 60 80 00    	fdivs  0x806060
+	return ret*ret;
+  802d82:	d8 c8                	fmul   %st(0),%st
+}
+  802d84:	c9                   	leave
+  802d85:	c3                   	ret
+
+00802d86 <nfu_with_aging_page_choice_func>:
+{
+  802d86:	55                   	push   %ebp
+  802d87:	89 e5                	mov    %esp,%ebp
+  802d89:	57                   	push   %edi
+  802d8a:	56                   	push   %esi
+  802d8b:	53                   	push   %ebx
+  802d8c:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d8f:	8b 35 30 90 80 00    	mov    0x809030,%esi
+	float pct_to_walk = 1.0f;
+  802d95:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802d97:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802d9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802da1:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802da8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dad:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802db0:	eb 18                	jmp    802dca <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802db2:	f7 d0                	not    %eax
+  802db4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802db9:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802dbb:	83 c2 01             	add    $0x1,%edx
+  802dbe:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802dc4:	0f 87 13 01 00 00    	ja     802edd <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802dca:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802dce:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802dd1:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802dd6:	89 c1                	mov    %eax,%ecx
+  802dd8:	c1 e9 0a             	shr    $0xa,%ecx
+  802ddb:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802de2:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802de8:	83 f9 01             	cmp    $0x1,%ecx
+  802deb:	75 c5                	jne    802db2 <nfu_with_aging_page_choice_func+0x2c>
+  802ded:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802df2:	77 be                	ja     802db2 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802df4:	89 c1                	mov    %eax,%ecx
+  802df6:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802df9:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  802dff:	0f 82 a5 00 00 00    	jb     802eaa <nfu_with_aging_page_choice_func+0x124>
+  802e05:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802e0b:	0f 87 99 00 00 00    	ja     802eaa <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802e11:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802e18:	f6 c1 01             	test   $0x1,%cl
+  802e1b:	0f 84 89 00 00 00    	je     802eaa <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802e21:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802e28:	f6 c5 04             	test   $0x4,%ch
+  802e2b:	75 7d                	jne    802eaa <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802e2d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802e34:	f6 c5 02             	test   $0x2,%ch
+  802e37:	75 71                	jne    802eaa <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802e39:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802e40:	c1 e9 0c             	shr    $0xc,%ecx
+  802e43:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802e46:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802e4c:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802e50:	66 83 f9 01          	cmp    $0x1,%cx
+  802e54:	77 54                	ja     802eaa <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802e56:	89 f9                	mov    %edi,%ecx
+  802e58:	80 f9 ff             	cmp    $0xff,%cl
+  802e5b:	74 21                	je     802e7e <nfu_with_aging_page_choice_func+0xf8>
+  802e5d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802e64:	c1 e9 0c             	shr    $0xc,%ecx
+  802e67:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802e6a:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802e70:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802e74:	89 fb                	mov    %edi,%ebx
+  802e76:	38 d9                	cmp    %bl,%cl
+  802e78:	73 30                	jae    802eaa <nfu_with_aging_page_choice_func+0x124>
+  802e7a:	dd d8                	fstp   %st(0)
+  802e7c:	eb 02                	jmp    802e80 <nfu_with_aging_page_choice_func+0xfa>
+  802e7e:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802e80:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802e87:	c1 e9 0c             	shr    $0xc,%ecx
+  802e8a:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802e8d:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802e94:	89 fb                	mov    %edi,%ebx
+  802e96:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802e99:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802e9c:	db 45 e0             	fildl  -0x20(%ebp)
+  802e9f:	d8 35 60 60 80 00    	fdivs  0x806060
+	return ret*ret;
+  802ea5:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802ea7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802eaa:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802ead:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802eb0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802eb7:	df 6d e0             	fildll -0x20(%ebp)
+  802eba:	d9 c1                	fld    %st(1)
+  802ebc:	d8 0d 64 60 80 00    	fmuls  0x806064
+  802ec2:	d9 c9                	fxch   %st(1)
+  802ec4:	df f1                	fcomip %st(1),%st
+  802ec6:	dd d8                	fstp   %st(0)
+  802ec8:	0f 82 ed fe ff ff    	jb     802dbb <nfu_with_aging_page_choice_func+0x35>
+  802ece:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802ed0:	a3 30 90 80 00       	mov    %eax,0x809030
+			return (void*)(pgnum_opt*PGSIZE);
+  802ed5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802ed8:	c1 e0 0c             	shl    $0xc,%eax
+  802edb:	eb 0e                	jmp    802eeb <nfu_with_aging_page_choice_func+0x165>
+  802edd:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802edf:	89 f8                	mov    %edi,%eax
+  802ee1:	3c ff                	cmp    $0xff,%al
+  802ee3:	74 0e                	je     802ef3 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802ee5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802ee8:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802eeb:	83 c4 14             	add    $0x14,%esp
+  802eee:	5b                   	pop    %ebx
+  802eef:	5e                   	pop    %esi
+  802ef0:	5f                   	pop    %edi
+  802ef1:	5d                   	pop    %ebp
+  802ef2:	c3                   	ret
+	pgnum = 0;
+  802ef3:	c7 05 30 90 80 00 00 	movl   $0x0,0x809030
+  802efa:	00 00 00 
+	return (void*)UTOP;
+  802efd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802f02:	eb e7                	jmp    802eeb <nfu_with_aging_page_choice_func+0x165>
+
+00802f04 <myRand>:
+    state = state * 1664525 + 1013904223;
+  802f04:	69 05 40 70 80 00 0d 	imul   $0x19660d,0x807040,%eax
+  802f0b:	66 19 00 
+  802f0e:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802f13:	a3 40 70 80 00       	mov    %eax,0x807040
+    return state >> 24;
+  802f18:	c1 e8 18             	shr    $0x18,%eax
+}
+  802f1b:	c3                   	ret
+
+00802f1c <random_page_choice_func>:
+{
+  802f1c:	55                   	push   %ebp
+  802f1d:	89 e5                	mov    %esp,%ebp
+  802f1f:	57                   	push   %edi
+  802f20:	56                   	push   %esi
+  802f21:	53                   	push   %ebx
+  802f22:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802f25:	be 00 00 00 00       	mov    $0x0,%esi
+  802f2a:	eb 19                	jmp    802f45 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802f2c:	f7 d3                	not    %ebx
+  802f2e:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802f34:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802f36:	83 c6 01             	add    $0x1,%esi
+  802f39:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802f3f:	0f 87 a0 00 00 00    	ja     802fe5 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802f45:	89 f3                	mov    %esi,%ebx
+  802f47:	03 1d 2c 90 80 00    	add    0x80902c,%ebx
+  802f4d:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802f53:	89 d8                	mov    %ebx,%eax
+  802f55:	c1 e8 0a             	shr    $0xa,%eax
+  802f58:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802f5f:	25 81 00 00 00       	and    $0x81,%eax
+  802f64:	83 f8 01             	cmp    $0x1,%eax
+  802f67:	75 c3                	jne    802f2c <random_page_choice_func+0x10>
+  802f69:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802f6f:	77 bb                	ja     802f2c <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802f71:	89 df                	mov    %ebx,%edi
+  802f73:	c1 e7 0c             	shl    $0xc,%edi
+  802f76:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802f79:	89 f8                	mov    %edi,%eax
+  802f7b:	e8 06 f9 ff ff       	call   802886 <page_is_clean>
+  802f80:	84 c0                	test   %al,%al
+  802f82:	0f 85 82 00 00 00    	jne    80300a <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f88:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  802f8e:	72 a6                	jb     802f36 <random_page_choice_func+0x1a>
+  802f90:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802f96:	77 9e                	ja     802f36 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802f98:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f9f:	a8 01                	test   $0x1,%al
+  802fa1:	74 93                	je     802f36 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802fa3:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802faa:	f6 c4 04             	test   $0x4,%ah
+  802fad:	75 87                	jne    802f36 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802faf:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802fb6:	f6 c4 02             	test   $0x2,%ah
+  802fb9:	0f 85 77 ff ff ff    	jne    802f36 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802fbf:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802fc6:	c1 e8 0c             	shr    $0xc,%eax
+  802fc9:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802fcc:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802fd1:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802fd5:	66 83 f8 01          	cmp    $0x1,%ax
+  802fd9:	0f 87 57 ff ff ff    	ja     802f36 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  802fdf:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802fe5:	e8 1a ff ff ff       	call   802f04 <myRand>
+  802fea:	8b 3d 2c 90 80 00    	mov    0x80902c,%edi
+  802ff0:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  802ff5:	29 fe                	sub    %edi,%esi
+  802ff7:	0f be c0             	movsbl %al,%eax
+  802ffa:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fff:	f7 f6                	div    %esi
+  803001:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  803003:	bb 15 00 00 00       	mov    $0x15,%ebx
+  803008:	eb 1c                	jmp    803026 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  80300a:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+			return (void*)(pgnum*PGSIZE);
+  803010:	e9 8f 00 00 00       	jmp    8030a4 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  803015:	e8 ea fe ff ff       	call   802f04 <myRand>
+  80301a:	0f be c0             	movsbl %al,%eax
+  80301d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803022:	f7 f6                	div    %esi
+  803024:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  803026:	83 eb 01             	sub    $0x1,%ebx
+  803029:	0f 84 c2 00 00 00    	je     8030f1 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  80302f:	89 d0                	mov    %edx,%eax
+  803031:	c1 e8 0a             	shr    $0xa,%eax
+  803034:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80303b:	25 81 00 00 00       	and    $0x81,%eax
+  803040:	83 f8 01             	cmp    $0x1,%eax
+  803043:	75 d0                	jne    803015 <random_page_choice_func+0xf9>
+  803045:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  80304b:	77 c8                	ja     803015 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  80304d:	89 d0                	mov    %edx,%eax
+  80304f:	c1 e0 0c             	shl    $0xc,%eax
+  803052:	3d 2c 10 81 00       	cmp    $0x81102c,%eax
+  803057:	72 56                	jb     8030af <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  803059:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  80305e:	77 65                	ja     8030c5 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  803060:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  803067:	f6 c1 01             	test   $0x1,%cl
+  80306a:	74 59                	je     8030c5 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  80306c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  803073:	f6 c5 04             	test   $0x4,%ch
+  803076:	75 4d                	jne    8030c5 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  803078:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  80307f:	f6 c5 02             	test   $0x2,%ch
+  803082:	75 41                	jne    8030c5 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  803084:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80308b:	c1 ea 0c             	shr    $0xc,%edx
+  80308e:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  803091:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  803097:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  80309b:	66 83 fa 01          	cmp    $0x1,%dx
+  80309f:	77 3a                	ja     8030db <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  8030a1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  8030a4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030a7:	83 c4 1c             	add    $0x1c,%esp
+  8030aa:	5b                   	pop    %ebx
+  8030ab:	5e                   	pop    %esi
+  8030ac:	5f                   	pop    %edi
+  8030ad:	5d                   	pop    %ebp
+  8030ae:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8030af:	e8 50 fe ff ff       	call   802f04 <myRand>
+  8030b4:	0f be c0             	movsbl %al,%eax
+  8030b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030bc:	f7 f6                	div    %esi
+  8030be:	01 fa                	add    %edi,%edx
+			continue;
+  8030c0:	e9 61 ff ff ff       	jmp    803026 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  8030c5:	e8 3a fe ff ff       	call   802f04 <myRand>
+  8030ca:	0f be c0             	movsbl %al,%eax
+  8030cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030d2:	f7 f6                	div    %esi
+  8030d4:	01 fa                	add    %edi,%edx
+			continue;
+  8030d6:	e9 4b ff ff ff       	jmp    803026 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  8030db:	e8 24 fe ff ff       	call   802f04 <myRand>
+  8030e0:	0f be c0             	movsbl %al,%eax
+  8030e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030e8:	f7 f6                	div    %esi
+  8030ea:	01 fa                	add    %edi,%edx
+			continue;
+  8030ec:	e9 35 ff ff ff       	jmp    803026 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  8030f1:	c7 05 2c 90 80 00 00 	movl   $0x0,0x80902c
+  8030f8:	00 00 00 
+	return (void*)UTOP;
+  8030fb:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  803102:	eb a0                	jmp    8030a4 <random_page_choice_func+0x188>
+
+00803104 <nfu>:
+{
+  803104:	55                   	push   %ebp
+  803105:	89 e5                	mov    %esp,%ebp
+  803107:	57                   	push   %edi
+  803108:	56                   	push   %esi
+  803109:	53                   	push   %ebx
+  80310a:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80310d:	8b 35 28 90 80 00    	mov    0x809028,%esi
+	float pct_to_walk = 1.0f;
+  803113:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  803115:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80311a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80311f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803126:	ba 00 00 00 00       	mov    $0x0,%edx
+  80312b:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  80312e:	eb 18                	jmp    803148 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803130:	f7 d0                	not    %eax
+  803132:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803137:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803139:	83 c2 01             	add    $0x1,%edx
+  80313c:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803142:	0f 87 13 01 00 00    	ja     80325b <nfu+0x157>
+		++num_searched_ptes;
+  803148:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80314c:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  80314f:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803154:	89 c1                	mov    %eax,%ecx
+  803156:	c1 e9 0a             	shr    $0xa,%ecx
+  803159:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  803160:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803166:	83 f9 01             	cmp    $0x1,%ecx
+  803169:	75 c5                	jne    803130 <nfu+0x2c>
+  80316b:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803170:	77 be                	ja     803130 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803172:	89 c1                	mov    %eax,%ecx
+  803174:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803177:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  80317d:	0f 82 a5 00 00 00    	jb     803228 <nfu+0x124>
+  803183:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803189:	0f 87 99 00 00 00    	ja     803228 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80318f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803196:	f6 c1 01             	test   $0x1,%cl
+  803199:	0f 84 89 00 00 00    	je     803228 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80319f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8031a6:	f6 c5 04             	test   $0x4,%ch
+  8031a9:	75 7d                	jne    803228 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8031ab:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8031b2:	f6 c5 02             	test   $0x2,%ch
+  8031b5:	75 71                	jne    803228 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8031b7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8031be:	c1 e9 0c             	shr    $0xc,%ecx
+  8031c1:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8031c4:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8031ca:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8031ce:	66 83 f9 01          	cmp    $0x1,%cx
+  8031d2:	77 54                	ja     803228 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  8031d4:	89 f9                	mov    %edi,%ecx
+  8031d6:	80 f9 ff             	cmp    $0xff,%cl
+  8031d9:	74 21                	je     8031fc <nfu+0xf8>
+  8031db:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8031e2:	c1 e9 0c             	shr    $0xc,%ecx
+  8031e5:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8031e8:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8031ee:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  8031f2:	89 fb                	mov    %edi,%ebx
+  8031f4:	38 d9                	cmp    %bl,%cl
+  8031f6:	73 30                	jae    803228 <nfu+0x124>
+  8031f8:	dd d8                	fstp   %st(0)
+  8031fa:	eb 02                	jmp    8031fe <nfu+0xfa>
+  8031fc:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  8031fe:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803205:	c1 e9 0c             	shr    $0xc,%ecx
+  803208:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80320b:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  803212:	89 fb                	mov    %edi,%ebx
+  803214:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  803217:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80321a:	db 45 e0             	fildl  -0x20(%ebp)
+  80321d:	d8 35 60 60 80 00    	fdivs  0x806060
+	return ret*ret;
+  803223:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803225:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803228:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80322b:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80322e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803235:	df 6d e0             	fildll -0x20(%ebp)
+  803238:	d9 c1                	fld    %st(1)
+  80323a:	d8 0d 64 60 80 00    	fmuls  0x806064
+  803240:	d9 c9                	fxch   %st(1)
+  803242:	df f1                	fcomip %st(1),%st
+  803244:	dd d8                	fstp   %st(0)
+  803246:	0f 82 ed fe ff ff    	jb     803139 <nfu+0x35>
+  80324c:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  80324e:	a3 28 90 80 00       	mov    %eax,0x809028
+			return (void*)(pgnum_opt*PGSIZE);
+  803253:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803256:	c1 e0 0c             	shl    $0xc,%eax
+  803259:	eb 0e                	jmp    803269 <nfu+0x165>
+  80325b:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  80325d:	89 f8                	mov    %edi,%eax
+  80325f:	3c ff                	cmp    $0xff,%al
+  803261:	74 0e                	je     803271 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  803263:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803266:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803269:	83 c4 14             	add    $0x14,%esp
+  80326c:	5b                   	pop    %ebx
+  80326d:	5e                   	pop    %esi
+  80326e:	5f                   	pop    %edi
+  80326f:	5d                   	pop    %ebp
+  803270:	c3                   	ret
+	pgnum = 0;
+  803271:	c7 05 28 90 80 00 00 	movl   $0x0,0x809028
+  803278:	00 00 00 
+	return (void*)UTOP;
+  80327b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803280:	eb e7                	jmp    803269 <nfu+0x165>
+
+00803282 <lru>:
+{
+  803282:	55                   	push   %ebp
+  803283:	89 e5                	mov    %esp,%ebp
+  803285:	57                   	push   %edi
+  803286:	56                   	push   %esi
+  803287:	53                   	push   %ebx
+  803288:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80328b:	8b 3d 24 90 80 00    	mov    0x809024,%edi
+	long long time_min = 9223372036854775807;
+  803291:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  803298:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80329f:	be 00 00 00 00       	mov    $0x0,%esi
+  8032a4:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8032ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032b0:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  8032b3:	eb 18                	jmp    8032cd <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8032b5:	f7 d0                	not    %eax
+  8032b7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8032bc:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8032be:	83 c2 01             	add    $0x1,%edx
+  8032c1:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  8032c7:	0f 87 fa 00 00 00    	ja     8033c7 <lru+0x145>
+		++num_searched_ptes;
+  8032cd:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8032d0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8032d3:	01 d0                	add    %edx,%eax
+  8032d5:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8032da:	89 c1                	mov    %eax,%ecx
+  8032dc:	c1 e9 0a             	shr    $0xa,%ecx
+  8032df:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8032e6:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8032ec:	83 f9 01             	cmp    $0x1,%ecx
+  8032ef:	75 c4                	jne    8032b5 <lru+0x33>
+  8032f1:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8032f6:	77 bd                	ja     8032b5 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8032f8:	89 c1                	mov    %eax,%ecx
+  8032fa:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8032fd:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803303:	0f 87 92 00 00 00    	ja     80339b <lru+0x119>
+  803309:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  80330f:	0f 82 86 00 00 00    	jb     80339b <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803315:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80331c:	f6 c1 01             	test   $0x1,%cl
+  80331f:	74 7a                	je     80339b <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803321:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803328:	f6 c5 04             	test   $0x4,%ch
+  80332b:	75 6e                	jne    80339b <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80332d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803334:	f6 c5 02             	test   $0x2,%ch
+  803337:	75 62                	jne    80339b <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803339:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803340:	c1 e9 0c             	shr    $0xc,%ecx
+  803343:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803346:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80334c:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803350:	66 83 f9 01          	cmp    $0x1,%cx
+  803354:	77 45                	ja     80339b <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  803356:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80335d:	c1 e9 0c             	shr    $0xc,%ecx
+  803360:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803363:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803369:	8b 59 14             	mov    0x14(%ecx),%ebx
+  80336c:	8b 49 10             	mov    0x10(%ecx),%ecx
+  80336f:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  803372:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803375:	19 df                	sbb    %ebx,%edi
+  803377:	7c 22                	jl     80339b <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  803379:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803380:	c1 e9 0c             	shr    $0xc,%ecx
+  803383:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803386:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80338c:	8b 59 14             	mov    0x14(%ecx),%ebx
+  80338f:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803392:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  803395:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803398:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  80339b:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  80339e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8033a5:	df 6d e0             	fildll -0x20(%ebp)
+  8033a8:	d9 05 64 60 80 00    	flds   0x806064
+  8033ae:	d9 c9                	fxch   %st(1)
+  8033b0:	df f1                	fcomip %st(1),%st
+  8033b2:	dd d8                	fstp   %st(0)
+  8033b4:	0f 82 04 ff ff ff    	jb     8032be <lru+0x3c>
+			pgnum = pgnum_actual;
+  8033ba:	a3 24 90 80 00       	mov    %eax,0x809024
+			return (void*)(pgnum_opt*PGSIZE);
+  8033bf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8033c2:	c1 e0 0c             	shl    $0xc,%eax
+  8033c5:	eb 06                	jmp    8033cd <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  8033c7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8033ca:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8033cd:	83 c4 1c             	add    $0x1c,%esp
+  8033d0:	5b                   	pop    %ebx
+  8033d1:	5e                   	pop    %esi
+  8033d2:	5f                   	pop    %edi
+  8033d3:	5d                   	pop    %ebp
+  8033d4:	c3                   	ret
+
+008033d5 <set_page_choice_func>:
+{
+  8033d5:	55                   	push   %ebp
+  8033d6:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  8033d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033db:	a3 3c 70 80 00       	mov    %eax,0x80703c
+}
+  8033e0:	5d                   	pop    %ebp
+  8033e1:	c3                   	ret
+
+008033e2 <get_page_choice>:
+{
+  8033e2:	55                   	push   %ebp
+  8033e3:	89 e5                	mov    %esp,%ebp
+  8033e5:	57                   	push   %edi
+  8033e6:	56                   	push   %esi
+  8033e7:	53                   	push   %ebx
+  8033e8:	83 ec 24             	sub    $0x24,%esp
+  8033eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8033ee:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  8033f1:	57                   	push   %edi
+  8033f2:	56                   	push   %esi
+  8033f3:	ff 15 3c 70 80 00    	call   *0x80703c
+  8033f9:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8033fb:	83 c4 10             	add    $0x10,%esp
+  8033fe:	eb 25                	jmp    803425 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  803400:	83 ec 08             	sub    $0x8,%esp
+  803403:	c1 e0 16             	shl    $0x16,%eax
+  803406:	50                   	push   %eax
+  803407:	6a 00                	push   $0x0
+  803409:	e8 cc da ff ff       	call   800eda <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80340e:	83 c4 10             	add    $0x10,%esp
+  803411:	85 c0                	test   %eax,%eax
+  803413:	75 43                	jne    803458 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  803415:	83 ec 08             	sub    $0x8,%esp
+  803418:	57                   	push   %edi
+  803419:	56                   	push   %esi
+  80341a:	ff 15 3c 70 80 00    	call   *0x80703c
+  803420:	89 c3                	mov    %eax,%ebx
+  803422:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803425:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  803428:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80342e:	0f 86 ae 00 00 00    	jbe    8034e2 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803434:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  803439:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803440:	81 e2 81 00 00 00    	and    $0x81,%edx
+  803446:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  80344c:	74 b2                	je     803400 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80344e:	83 c0 01             	add    $0x1,%eax
+  803451:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  803456:	75 e1                	jne    803439 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803458:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80345b:	05 00 10 40 11       	add    $0x11401000,%eax
+  803460:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803465:	76 1f                	jbe    803486 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  803467:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  80346c:	89 d8                	mov    %ebx,%eax
+  80346e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803471:	5b                   	pop    %ebx
+  803472:	5e                   	pop    %esi
+  803473:	5f                   	pop    %edi
+  803474:	5d                   	pop    %ebp
+  803475:	c3                   	ret
+		sys_page_split(0, pg_out);
+  803476:	83 ec 08             	sub    $0x8,%esp
+  803479:	53                   	push   %ebx
+  80347a:	6a 00                	push   $0x0
+  80347c:	e8 59 da ff ff       	call   800eda <sys_page_split>
+  803481:	83 c4 10             	add    $0x10,%esp
+  803484:	eb 6c                	jmp    8034f2 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  803486:	83 ec 04             	sub    $0x4,%esp
+  803489:	68 0c 5c 80 00       	push   $0x805c0c
+  80348e:	68 cc 01 00 00       	push   $0x1cc
+  803493:	68 7b 5b 80 00       	push   $0x805b7b
+  803498:	e8 c1 cd ff ff       	call   80025e <_panic>
+		panic("We tried to page out code pages\n");
+  80349d:	83 ec 04             	sub    $0x4,%esp
+  8034a0:	68 3c 5c 80 00       	push   $0x805c3c
+  8034a5:	68 d6 01 00 00       	push   $0x1d6
+  8034aa:	68 7b 5b 80 00       	push   $0x805b7b
+  8034af:	e8 aa cd ff ff       	call   80025e <_panic>
+		panic("Invalid mapping for the va\n");
+  8034b4:	83 ec 04             	sub    $0x4,%esp
+  8034b7:	68 88 5b 80 00       	push   $0x805b88
+  8034bc:	68 da 01 00 00       	push   $0x1da
+  8034c1:	68 7b 5b 80 00       	push   $0x805b7b
+  8034c6:	e8 93 cd ff ff       	call   80025e <_panic>
+		panic("We tried to page out a shared page\n");
+  8034cb:	83 ec 04             	sub    $0x4,%esp
+  8034ce:	68 60 5c 80 00       	push   $0x805c60
+  8034d3:	68 e0 01 00 00       	push   $0x1e0
+  8034d8:	68 7b 5b 80 00       	push   $0x805b7b
+  8034dd:	e8 7c cd ff ff       	call   80025e <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  8034e2:	89 de                	mov    %ebx,%esi
+  8034e4:	c1 ee 16             	shr    $0x16,%esi
+  8034e7:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8034ee:	a8 80                	test   $0x80,%al
+  8034f0:	75 84                	jne    803476 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  8034f2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8034f5:	05 00 10 40 11       	add    $0x11401000,%eax
+  8034fa:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8034ff:	76 85                	jbe    803486 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  803501:	89 d8                	mov    %ebx,%eax
+  803503:	e8 7e f3 ff ff       	call   802886 <page_is_clean>
+  803508:	84 c0                	test   %al,%al
+  80350a:	0f 85 5c ff ff ff    	jne    80346c <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  803510:	81 7d e4 2c 10 81 00 	cmpl   $0x81102c,-0x1c(%ebp)
+  803517:	76 84                	jbe    80349d <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  803519:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803520:	a8 01                	test   $0x1,%al
+  803522:	74 90                	je     8034b4 <get_page_choice+0xd2>
+  803524:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803527:	c1 e8 0c             	shr    $0xc,%eax
+  80352a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803531:	f6 c2 01             	test   $0x1,%dl
+  803534:	0f 84 7a ff ff ff    	je     8034b4 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  80353a:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  803541:	f6 c2 01             	test   $0x1,%dl
+  803544:	74 85                	je     8034cb <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803546:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  80354d:	f6 c2 01             	test   $0x1,%dl
+  803550:	0f 84 75 ff ff ff    	je     8034cb <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  803556:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  80355d:	f6 c6 04             	test   $0x4,%dh
+  803560:	0f 85 65 ff ff ff    	jne    8034cb <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  803566:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  80356d:	f6 c6 02             	test   $0x2,%dh
+  803570:	0f 85 55 ff ff ff    	jne    8034cb <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  803576:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80357d:	c1 e8 0c             	shr    $0xc,%eax
+  803580:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803583:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803588:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80358c:	66 83 f8 01          	cmp    $0x1,%ax
+  803590:	0f 86 d6 fe ff ff    	jbe    80346c <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  803596:	83 ec 04             	sub    $0x4,%esp
+  803599:	68 84 5c 80 00       	push   $0x805c84
+  80359e:	68 e2 01 00 00       	push   $0x1e2
+  8035a3:	68 7b 5b 80 00       	push   $0x805b7b
+  8035a8:	e8 b1 cc ff ff       	call   80025e <_panic>
+
+008035ad <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  8035ad:	55                   	push   %ebp
+  8035ae:	89 e5                	mov    %esp,%ebp
+  8035b0:	57                   	push   %edi
+  8035b1:	56                   	push   %esi
+  8035b2:	53                   	push   %ebx
+  8035b3:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  8035b6:	e8 e8 f6 ff ff       	call   802ca3 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  8035bb:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  8035c0:	85 c0                	test   %eax,%eax
+  8035c2:	74 41                	je     803605 <page_share_paged_out+0x58>
+  8035c4:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  8035cb:	0f 84 fd 00 00 00    	je     8036ce <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  8035d1:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  8035d8:	00 00 00 
+  8035db:	c7 05 00 b0 80 00 00 	movl   $0x0,0x80b000
+  8035e2:	00 00 00 
+  8035e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035ea:	eb 2c                	jmp    803618 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8035ec:	83 c3 04             	add    $0x4,%ebx
+  8035ef:	39 f3                	cmp    %esi,%ebx
+  8035f1:	74 1a                	je     80360d <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  8035f3:	8b 03                	mov    (%ebx),%eax
+  8035f5:	a8 01                	test   $0x1,%al
+  8035f7:	74 f3                	je     8035ec <page_share_paged_out+0x3f>
+  8035f9:	c1 e8 0c             	shr    $0xc,%eax
+  8035fc:	e8 2b f5 ff ff       	call   802b2c <page_share_slot>
+  803601:	85 c0                	test   %eax,%eax
+  803603:	79 e7                	jns    8035ec <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  803605:	83 c4 0c             	add    $0xc,%esp
+  803608:	5b                   	pop    %ebx
+  803609:	5e                   	pop    %esi
+  80360a:	5f                   	pop    %edi
+  80360b:	5d                   	pop    %ebp
+  80360c:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  80360d:	83 c7 04             	add    $0x4,%edi
+  803610:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  803616:	74 1b                	je     803633 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  803618:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  80361d:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  803620:	f6 c3 01             	test   $0x1,%bl
+  803623:	74 e8                	je     80360d <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  803625:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  80362b:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  803631:	eb bc                	jmp    8035ef <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803633:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803638:	eb 11                	jmp    80364b <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  80363a:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803640:	83 c3 01             	add    $0x1,%ebx
+  803643:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803649:	77 41                	ja     80368c <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  80364b:	89 d8                	mov    %ebx,%eax
+  80364d:	c1 e8 0a             	shr    $0xa,%eax
+  803650:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803657:	25 81 00 00 00       	and    $0x81,%eax
+  80365c:	83 f8 01             	cmp    $0x1,%eax
+  80365f:	75 d9                	jne    80363a <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803661:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803668:	25 81 00 00 00       	and    $0x81,%eax
+  80366d:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803672:	75 cc                	jne    803640 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803674:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80367b:	c1 e8 0c             	shr    $0xc,%eax
+  80367e:	e8 a9 f4 ff ff       	call   802b2c <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803683:	85 c0                	test   %eax,%eax
+  803685:	79 b9                	jns    803640 <page_share_paged_out+0x93>
+  803687:	e9 79 ff ff ff       	jmp    803605 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80368c:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  803693:	75 13                	jne    8036a8 <page_share_paged_out+0xfb>
+  803695:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  80369c:	75 1d                	jne    8036bb <page_share_paged_out+0x10e>
+	return 0;
+  80369e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a3:	e9 5d ff ff ff       	jmp    803605 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8036a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ad:	e8 46 f4 ff ff       	call   802af8 <page_share_send>
+  8036b2:	85 c0                	test   %eax,%eax
+  8036b4:	79 df                	jns    803695 <page_share_paged_out+0xe8>
+  8036b6:	e9 4a ff ff ff       	jmp    803605 <page_share_paged_out+0x58>
+  8036bb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036c0:	e8 33 f4 ff ff       	call   802af8 <page_share_send>
+  8036c5:	85 c0                	test   %eax,%eax
+  8036c7:	79 d5                	jns    80369e <page_share_paged_out+0xf1>
+  8036c9:	e9 37 ff ff ff       	jmp    803605 <page_share_paged_out+0x58>
+		return 0;
+  8036ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d3:	e9 2d ff ff ff       	jmp    803605 <page_share_paged_out+0x58>
+
+008036d8 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  8036d8:	55                   	push   %ebp
+  8036d9:	89 e5                	mov    %esp,%ebp
+  8036db:	56                   	push   %esi
+  8036dc:	53                   	push   %ebx
+  8036dd:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  8036e0:	e8 be f5 ff ff       	call   802ca3 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  8036e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  8036ea:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  8036f1:	0f 84 82 00 00 00    	je     803779 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  8036f7:	83 ec 0c             	sub    $0xc,%esp
+  8036fa:	68 00 10 00 00       	push   $0x1000
+  8036ff:	e8 84 11 00 00       	call   804888 <malloc>
+  803704:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  803706:	83 c4 0c             	add    $0xc,%esp
+  803709:	6a 14                	push   $0x14
+  80370b:	6a 00                	push   $0x0
+  80370d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803710:	50                   	push   %eax
+  803711:	e8 5b d3 ff ff       	call   800a71 <memset>
+  803716:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  803719:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  80371e:	83 ec 0c             	sub    $0xc,%esp
+  803721:	6a 07                	push   $0x7
+  803723:	6a 01                	push   $0x1
+  803725:	53                   	push   %ebx
+  803726:	6a 03                	push   $0x3
+  803728:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  80372f:	e8 b7 19 00 00       	call   8050eb <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  803734:	8b 03                	mov    (%ebx),%eax
+  803736:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803739:	8b 43 04             	mov    0x4(%ebx),%eax
+  80373c:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  80373f:	8b 43 08             	mov    0x8(%ebx),%eax
+  803742:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  803745:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803748:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  80374b:	8b 43 10             	mov    0x10(%ebx),%eax
+  80374e:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803751:	83 c6 01             	add    $0x1,%esi
+  803754:	83 c4 20             	add    $0x20,%esp
+  803757:	83 fe 02             	cmp    $0x2,%esi
+  80375a:	75 c2                	jne    80371e <get_paging_stats+0x46>
+	}
+	*stats = total;
+  80375c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80375f:	89 03                	mov    %eax,(%ebx)
+  803761:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803764:	89 43 04             	mov    %eax,0x4(%ebx)
+  803767:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80376a:	89 43 08             	mov    %eax,0x8(%ebx)
+  80376d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803770:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803773:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803776:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  803779:	89 d8                	mov    %ebx,%eax
+  80377b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80377e:	5b                   	pop    %ebx
+  80377f:	5e                   	pop    %esi
+  803780:	5d                   	pop    %ebp
+  803781:	c3                   	ret
+
+00803782 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803782:	55                   	push   %ebp
+  803783:	89 e5                	mov    %esp,%ebp
+  803785:	53                   	push   %ebx
+  803786:	83 ec 10             	sub    $0x10,%esp
+  803789:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  80378c:	68 a2 5b 80 00       	push   $0x805ba2
+  803791:	e8 a3 cb ff ff       	call   800339 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  803796:	83 c4 08             	add    $0x8,%esp
+  803799:	ff 33                	push   (%ebx)
+  80379b:	68 b8 5c 80 00       	push   $0x805cb8
+  8037a0:	e8 94 cb ff ff       	call   800339 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  8037a5:	83 c4 08             	add    $0x8,%esp
+  8037a8:	ff 73 04             	push   0x4(%ebx)
+  8037ab:	68 a4 5b 80 00       	push   $0x805ba4
+  8037b0:	e8 84 cb ff ff       	call   800339 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  8037b5:	83 c4 08             	add    $0x8,%esp
+  8037b8:	ff 73 08             	push   0x8(%ebx)
+  8037bb:	68 d8 5c 80 00       	push   $0x805cd8
+  8037c0:	e8 74 cb ff ff       	call   800339 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  8037c5:	83 c4 08             	add    $0x8,%esp
+  8037c8:	ff 73 0c             	push   0xc(%ebx)
+  8037cb:	68 fc 5c 80 00       	push   $0x805cfc
+  8037d0:	e8 64 cb ff ff       	call   800339 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  8037d5:	83 c4 08             	add    $0x8,%esp
+  8037d8:	ff 73 10             	push   0x10(%ebx)
+  8037db:	68 20 5d 80 00       	push   $0x805d20
+  8037e0:	e8 54 cb ff ff       	call   800339 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  8037e5:	83 c4 08             	add    $0x8,%esp
+  8037e8:	ff 35 08 c0 80 00    	push   0x80c008
+  8037ee:	68 5c 5d 80 00       	push   $0x805d5c
+  8037f3:	e8 41 cb ff ff       	call   800339 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  8037f8:	83 c4 08             	add    $0x8,%esp
+  8037fb:	ff 35 04 c0 80 00    	push   0x80c004
+  803801:	68 90 5d 80 00       	push   $0x805d90
+  803806:	e8 2e cb ff ff       	call   800339 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  80380b:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803810:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  803813:	8b 50 68             	mov    0x68(%eax),%edx
+  803816:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  803819:	51                   	push   %ecx
+  80381a:	52                   	push   %edx
+  80381b:	50                   	push   %eax
+  80381c:	68 d0 5d 80 00       	push   $0x805dd0
+  803821:	e8 13 cb ff ff       	call   800339 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  803826:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80382b:	8b 40 70             	mov    0x70(%eax),%eax
+  80382e:	83 c4 18             	add    $0x18,%esp
+  803831:	50                   	push   %eax
+  803832:	68 04 5e 80 00       	push   $0x805e04
+  803837:	e8 fd ca ff ff       	call   800339 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  80383c:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  803842:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803848:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  80384d:	51                   	push   %ecx
+  80384e:	52                   	push   %edx
+  80384f:	50                   	push   %eax
+  803850:	68 34 5e 80 00       	push   $0x805e34
+  803855:	e8 df ca ff ff       	call   800339 <cprintf>
+	cprintf("\n");
+  80385a:	83 c4 14             	add    $0x14,%esp
+  80385d:	68 a2 5b 80 00       	push   $0x805ba2
+  803862:	e8 d2 ca ff ff       	call   800339 <cprintf>
+}
+  803867:	83 c4 10             	add    $0x10,%esp
+  80386a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80386d:	c9                   	leave
+  80386e:	c3                   	ret
+
+0080386f <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  80386f:	55                   	push   %ebp
+  803870:	89 e5                	mov    %esp,%ebp
+  803872:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  803875:	e8 5e fe ff ff       	call   8036d8 <get_paging_stats>
+  80387a:	83 ec 0c             	sub    $0xc,%esp
+  80387d:	50                   	push   %eax
+  80387e:	e8 ff fe ff ff       	call   803782 <print_paging_stats>
+}
+  803883:	83 c4 10             	add    $0x10,%esp
+  803886:	c9                   	leave
+  803887:	c3                   	ret
+
+00803888 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803888:	55                   	push   %ebp
+  803889:	89 e5                	mov    %esp,%ebp
+  80388b:	53                   	push   %ebx
+  80388c:	83 ec 04             	sub    $0x4,%esp
+  80388f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803892:	eb 13                	jmp    8038a7 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803894:	83 ec 04             	sub    $0x4,%esp
+  803897:	6a ff                	push   $0xffffffff
+  803899:	53                   	push   %ebx
+  80389a:	68 00 f0 ff ee       	push   $0xeefff000
+  80389f:	e8 48 da ff ff       	call   8012ec <sys_futex_wait>
+  8038a4:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  8038a7:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  8038ac:	39 d8                	cmp    %ebx,%eax
+  8038ae:	74 e4                	je     803894 <mem_pressure_wait+0xc>
+	return now;
+}
+  8038b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038b3:	c9                   	leave
+  8038b4:	c3                   	ret
+
+008038b5 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  8038b5:	55                   	push   %ebp
+  8038b6:	89 e5                	mov    %esp,%ebp
+  8038b8:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  8038bb:	68 27 45 80 00       	push   $0x804527
+  8038c0:	e8 32 16 00 00       	call   804ef7 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  8038c5:	c7 05 14 f9 80 00 00 	movl   $0xdeadb000,0x80f914
+  8038cc:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  8038cf:	83 c4 0c             	add    $0xc,%esp
+  8038d2:	68 07 02 00 00       	push   $0x207
+  8038d7:	68 00 b0 ad de       	push   $0xdeadb000
+  8038dc:	6a 00                	push   $0x0
+  8038de:	e8 30 d5 ff ff       	call   800e13 <sys_page_alloc>
+  8038e3:	83 c4 10             	add    $0x10,%esp
+  8038e6:	85 c0                	test   %eax,%eax
+  8038e8:	78 0c                	js     8038f6 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  8038ea:	e8 b4 f3 ff ff       	call   802ca3 <find_paging_env>
+	page_ring_ready();
+  8038ef:	e8 7f f2 ff ff       	call   802b73 <page_ring_ready>
+}
+  8038f4:	c9                   	leave
+  8038f5:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  8038f6:	50                   	push   %eax
+  8038f7:	68 c2 5b 80 00       	push   $0x805bc2
+  8038fc:	68 13 05 00 00       	push   $0x513
+  803901:	68 7b 5b 80 00       	push   $0x805b7b
+  803906:	e8 53 c9 ff ff       	call   80025e <_panic>
+
+0080390b <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  80390b:	55                   	push   %ebp
+  80390c:	89 e5                	mov    %esp,%ebp
+  80390e:	57                   	push   %edi
+  80390f:	56                   	push   %esi
+  803910:	53                   	push   %ebx
+  803911:	83 ec 0c             	sub    $0xc,%esp
+  803914:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  803917:	89 fa                	mov    %edi,%edx
+  803919:	c1 ea 16             	shr    $0x16,%edx
+  80391c:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  803921:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  803924:	f6 06 01             	testb  $0x1,(%esi)
+  803927:	75 3e                	jne    803967 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803929:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  80392e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803932:	74 47                	je     80397b <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  803934:	83 ec 0c             	sub    $0xc,%esp
+  803937:	6a 01                	push   $0x1
+  803939:	e8 f2 11 00 00       	call   804b30 <va_alloc>
+  80393e:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  803940:	83 c4 10             	add    $0x10,%esp
+  803943:	85 c0                	test   %eax,%eax
+  803945:	74 34                	je     80397b <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803947:	6a 00                	push   $0x0
+  803949:	68 07 02 00 00       	push   $0x207
+  80394e:	50                   	push   %eax
+  80394f:	6a 00                	push   $0x0
+  803951:	e8 df 02 00 00       	call   803c35 <page_alloc>
+  803956:	83 c4 10             	add    $0x10,%esp
+  803959:	85 c0                	test   %eax,%eax
+  80395b:	78 28                	js     803985 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  80395d:	f6 06 01             	testb  $0x1,(%esi)
+  803960:	75 38                	jne    80399a <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803962:	83 cb 01             	or     $0x1,%ebx
+  803965:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803967:	89 f8                	mov    %edi,%eax
+  803969:	c1 e8 0a             	shr    $0xa,%eax
+  80396c:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803971:	8b 1e                	mov    (%esi),%ebx
+  803973:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803979:	01 c3                	add    %eax,%ebx
+}
+  80397b:	89 d8                	mov    %ebx,%eax
+  80397d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803980:	5b                   	pop    %ebx
+  803981:	5e                   	pop    %esi
+  803982:	5f                   	pop    %edi
+  803983:	5d                   	pop    %ebp
+  803984:	c3                   	ret
+			va_free(page, 1);
+  803985:	83 ec 08             	sub    $0x8,%esp
+  803988:	6a 01                	push   $0x1
+  80398a:	53                   	push   %ebx
+  80398b:	e8 d8 12 00 00       	call   804c68 <va_free>
+			return NULL;
+  803990:	83 c4 10             	add    $0x10,%esp
+  803993:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803998:	eb e1                	jmp    80397b <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  80399a:	83 ec 08             	sub    $0x8,%esp
+  80399d:	53                   	push   %ebx
+  80399e:	6a 00                	push   $0x0
+  8039a0:	e8 f3 d4 ff ff       	call   800e98 <sys_page_unmap>
+			va_free(page, 1);
+  8039a5:	83 c4 08             	add    $0x8,%esp
+  8039a8:	6a 01                	push   $0x1
+  8039aa:	53                   	push   %ebx
+  8039ab:	e8 b8 12 00 00       	call   804c68 <va_free>
+  8039b0:	83 c4 10             	add    $0x10,%esp
+  8039b3:	eb b2                	jmp    803967 <umapdir_walk+0x5c>
+
+008039b5 <page_out>:
+{
+  8039b5:	55                   	push   %ebp
+  8039b6:	89 e5                	mov    %esp,%ebp
+  8039b8:	57                   	push   %edi
+  8039b9:	56                   	push   %esi
+  8039ba:	53                   	push   %ebx
+  8039bb:	83 ec 5c             	sub    $0x5c,%esp
+  8039be:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  8039c1:	e8 dd f2 ff ff       	call   802ca3 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  8039c6:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  8039cb:	85 c0                	test   %eax,%eax
+  8039cd:	74 1e                	je     8039ed <page_out+0x38>
+  8039cf:	83 ec 0c             	sub    $0xc,%esp
+  8039d2:	6a 00                	push   $0x0
+  8039d4:	6a 00                	push   $0x0
+  8039d6:	6a 00                	push   $0x0
+  8039d8:	6a 08                	push   $0x8
+  8039da:	50                   	push   %eax
+  8039db:	e8 0b 17 00 00       	call   8050eb <ipc_call>
+  8039e0:	89 c3                	mov    %eax,%ebx
+  8039e2:	83 c4 20             	add    $0x20,%esp
+  8039e5:	85 c0                	test   %eax,%eax
+  8039e7:	0f 84 ac 00 00 00    	je     803a99 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  8039ed:	83 ec 08             	sub    $0x8,%esp
+  8039f0:	ff 75 0c             	push   0xc(%ebp)
+  8039f3:	57                   	push   %edi
+  8039f4:	e8 e9 f9 ff ff       	call   8033e2 <get_page_choice>
+  8039f9:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  8039fb:	83 c4 10             	add    $0x10,%esp
+  8039fe:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803a03:	0f 84 18 02 00 00    	je     803c21 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803a09:	e8 78 ee ff ff       	call   802886 <page_is_clean>
+  803a0e:	84 c0                	test   %al,%al
+  803a10:	0f 85 8c 00 00 00    	jne    803aa2 <page_out+0xed>
+	if (pagingenv == 0)
+  803a16:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803a1d:	0f 84 08 02 00 00    	je     803c2b <page_out+0x276>
+	if (page_ring_ready())
+  803a23:	e8 4b f1 ff ff       	call   802b73 <page_ring_ready>
+  803a28:	89 c3                	mov    %eax,%ebx
+  803a2a:	85 c0                	test   %eax,%eax
+  803a2c:	0f 85 89 00 00 00    	jne    803abb <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  803a32:	83 ec 0c             	sub    $0xc,%esp
+  803a35:	6a 05                	push   $0x5
+  803a37:	6a 01                	push   $0x1
+  803a39:	56                   	push   %esi
+  803a3a:	6a 01                	push   $0x1
+  803a3c:	ff 35 40 c0 80 00    	push   0x80c040
+  803a42:	e8 a4 16 00 00       	call   8050eb <ipc_call>
+  803a47:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803a49:	83 c4 20             	add    $0x20,%esp
+  803a4c:	85 c0                	test   %eax,%eax
+  803a4e:	0f 88 b8 01 00 00    	js     803c0c <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803a54:	89 f0                	mov    %esi,%eax
+  803a56:	c1 e8 0c             	shr    $0xc,%eax
+  803a59:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803a60:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803a63:	83 ec 08             	sub    $0x8,%esp
+  803a66:	56                   	push   %esi
+  803a67:	6a 00                	push   $0x0
+  803a69:	e8 2a d4 ff ff       	call   800e98 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803a6e:	83 c4 08             	add    $0x8,%esp
+  803a71:	6a 01                	push   $0x1
+  803a73:	56                   	push   %esi
+  803a74:	e8 92 fe ff ff       	call   80390b <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803a79:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803a7c:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803a82:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803a85:	09 fe                	or     %edi,%esi
+  803a87:	83 ce 01             	or     $0x1,%esi
+  803a8a:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803a8c:	83 c4 10             	add    $0x10,%esp
+}
+  803a8f:	89 d8                	mov    %ebx,%eax
+  803a91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a94:	5b                   	pop    %ebx
+  803a95:	5e                   	pop    %esi
+  803a96:	5f                   	pop    %edi
+  803a97:	5d                   	pop    %ebp
+  803a98:	c3                   	ret
+		num_page_reclaims++;
+  803a99:	83 05 04 c0 80 00 01 	addl   $0x1,0x80c004
+		return 0;
+  803aa0:	eb ed                	jmp    803a8f <page_out+0xda>
+		num_page_drops++;
+  803aa2:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+		return sys_page_unmap(0, map_out_addr);
+  803aa9:	83 ec 08             	sub    $0x8,%esp
+  803aac:	56                   	push   %esi
+  803aad:	6a 00                	push   $0x0
+  803aaf:	e8 e4 d3 ff ff       	call   800e98 <sys_page_unmap>
+  803ab4:	89 c3                	mov    %eax,%ebx
+  803ab6:	83 c4 10             	add    $0x10,%esp
+  803ab9:	eb d4                	jmp    803a8f <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803abb:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803abd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803ac2:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803ac7:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803aca:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803acc:	83 c0 08             	add    $0x8,%eax
+  803acf:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803ad2:	b8 07 00 00 00       	mov    $0x7,%eax
+  803ad7:	e8 e5 ef ff ff       	call   802ac1 <page_ring_reserve>
+	first = ring->sq_tail;
+  803adc:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803ae1:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803ae4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803ae9:	83 ec 04             	sub    $0x4,%esp
+  803aec:	68 00 10 00 00       	push   $0x1000
+  803af1:	56                   	push   %esi
+  803af2:	89 d8                	mov    %ebx,%eax
+  803af4:	c1 e0 0c             	shl    $0xc,%eax
+  803af7:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803afc:	50                   	push   %eax
+  803afd:	e8 06 d0 ff ff       	call   800b08 <memcpy>
+		vas[n] = va;
+  803b02:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803b06:	89 d9                	mov    %ebx,%ecx
+  803b08:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b0d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803b12:	e8 de ee ff ff       	call   8029f5 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803b17:	8d 43 01             	lea    0x1(%ebx),%eax
+  803b1a:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803b1d:	83 c4 10             	add    $0x10,%esp
+  803b20:	83 fb 06             	cmp    $0x6,%ebx
+  803b23:	74 62                	je     803b87 <page_out+0x1d2>
+  803b25:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803b28:	eb 15                	jmp    803b3f <page_out+0x18a>
+			num_page_drops++;
+  803b2a:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+			sys_page_unmap(0, va);
+  803b31:	83 ec 08             	sub    $0x8,%esp
+  803b34:	56                   	push   %esi
+  803b35:	6a 00                	push   $0x0
+  803b37:	e8 5c d3 ff ff       	call   800e98 <sys_page_unmap>
+  803b3c:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803b3f:	83 ec 08             	sub    $0x8,%esp
+  803b42:	53                   	push   %ebx
+  803b43:	57                   	push   %edi
+  803b44:	e8 99 f8 ff ff       	call   8033e2 <get_page_choice>
+  803b49:	89 c6                	mov    %eax,%esi
+  803b4b:	83 c4 10             	add    $0x10,%esp
+  803b4e:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803b53:	74 32                	je     803b87 <page_out+0x1d2>
+  803b55:	e8 2c ed ff ff       	call   802886 <page_is_clean>
+  803b5a:	84 c0                	test   %al,%al
+  803b5c:	75 cc                	jne    803b2a <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803b5e:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803b61:	39 c6                	cmp    %eax,%esi
+  803b63:	72 07                	jb     803b6c <page_out+0x1b7>
+  803b65:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803b68:	39 c6                	cmp    %eax,%esi
+  803b6a:	72 1b                	jb     803b87 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803b6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b71:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803b74:	eb 03                	jmp    803b79 <page_out+0x1c4>
+  803b76:	83 c3 01             	add    $0x1,%ebx
+  803b79:	39 da                	cmp    %ebx,%edx
+  803b7b:	0f 84 68 ff ff ff    	je     803ae9 <page_out+0x134>
+  803b81:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803b85:	75 ef                	jne    803b76 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803b87:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803b8a:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803b8d:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803b90:	e8 a6 ee ff ff       	call   802a3b <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803b95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b9a:	eb 42                	jmp    803bde <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803b9c:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803ba0:	89 f8                	mov    %edi,%eax
+  803ba2:	c1 e8 0c             	shr    $0xc,%eax
+  803ba5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803bac:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803baf:	83 ec 08             	sub    $0x8,%esp
+  803bb2:	57                   	push   %edi
+  803bb3:	6a 00                	push   $0x0
+  803bb5:	e8 de d2 ff ff       	call   800e98 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803bba:	83 c4 08             	add    $0x8,%esp
+  803bbd:	6a 01                	push   $0x1
+  803bbf:	57                   	push   %edi
+  803bc0:	e8 46 fd ff ff       	call   80390b <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803bc5:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803bc8:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803bce:	c1 e6 0c             	shl    $0xc,%esi
+  803bd1:	09 d6                	or     %edx,%esi
+  803bd3:	83 ce 01             	or     $0x1,%esi
+  803bd6:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803bd8:	83 c3 01             	add    $0x1,%ebx
+  803bdb:	83 c4 10             	add    $0x10,%esp
+  803bde:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803be1:	39 c3                	cmp    %eax,%ebx
+  803be3:	74 1d                	je     803c02 <page_out+0x24d>
+		if (res[i] < 0)
+  803be5:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803be9:	85 f6                	test   %esi,%esi
+  803beb:	79 af                	jns    803b9c <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803bed:	56                   	push   %esi
+  803bee:	68 64 5e 80 00       	push   $0x805e64
+  803bf3:	68 d1 02 00 00       	push   $0x2d1
+  803bf8:	68 7b 5b 80 00       	push   $0x805b7b
+  803bfd:	e8 5c c6 ff ff       	call   80025e <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803c02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c07:	e9 83 fe ff ff       	jmp    803a8f <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803c0c:	50                   	push   %eax
+  803c0d:	68 64 5e 80 00       	push   $0x805e64
+  803c12:	68 0a 03 00 00       	push   $0x30a
+  803c17:	68 7b 5b 80 00       	push   $0x805b7b
+  803c1c:	e8 3d c6 ff ff       	call   80025e <_panic>
+		return -E_NO_MEM;
+  803c21:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803c26:	e9 64 fe ff ff       	jmp    803a8f <page_out+0xda>
+		return -E_PAGING;
+  803c2b:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803c30:	e9 5a fe ff ff       	jmp    803a8f <page_out+0xda>
+
+00803c35 <page_alloc>:
+{
+  803c35:	55                   	push   %ebp
+  803c36:	89 e5                	mov    %esp,%ebp
+  803c38:	57                   	push   %edi
+  803c39:	56                   	push   %esi
+  803c3a:	53                   	push   %ebx
+  803c3b:	83 ec 0c             	sub    $0xc,%esp
+  803c3e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803c41:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803c44:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803c4b:	74 34                	je     803c81 <page_alloc+0x4c>
+	if (check_mte)
+  803c4d:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803c51:	75 35                	jne    803c88 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803c53:	83 ec 04             	sub    $0x4,%esp
+  803c56:	ff 75 10             	push   0x10(%ebp)
+  803c59:	56                   	push   %esi
+  803c5a:	57                   	push   %edi
+  803c5b:	e8 b3 d1 ff ff       	call   800e13 <sys_page_alloc>
+  803c60:	89 c3                	mov    %eax,%ebx
+  803c62:	83 c4 10             	add    $0x10,%esp
+  803c65:	85 c0                	test   %eax,%eax
+  803c67:	79 52                	jns    803cbb <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803c69:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803c6c:	75 52                	jne    803cc0 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803c6e:	83 ec 08             	sub    $0x8,%esp
+  803c71:	56                   	push   %esi
+  803c72:	57                   	push   %edi
+  803c73:	e8 3d fd ff ff       	call   8039b5 <page_out>
+  803c78:	83 c4 10             	add    $0x10,%esp
+  803c7b:	85 c0                	test   %eax,%eax
+  803c7d:	79 d4                	jns    803c53 <page_alloc+0x1e>
+  803c7f:	eb 3f                	jmp    803cc0 <page_alloc+0x8b>
+		init_map_dir();
+  803c81:	e8 2f fc ff ff       	call   8038b5 <init_map_dir>
+  803c86:	eb c5                	jmp    803c4d <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803c88:	83 ec 08             	sub    $0x8,%esp
+  803c8b:	6a 00                	push   $0x0
+  803c8d:	56                   	push   %esi
+  803c8e:	e8 78 fc ff ff       	call   80390b <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803c93:	83 c4 10             	add    $0x10,%esp
+  803c96:	85 c0                	test   %eax,%eax
+  803c98:	74 b9                	je     803c53 <page_alloc+0x1e>
+  803c9a:	8b 10                	mov    (%eax),%edx
+  803c9c:	f6 c2 01             	test   $0x1,%dl
+  803c9f:	74 b2                	je     803c53 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803ca1:	83 ec 08             	sub    $0x8,%esp
+  803ca4:	56                   	push   %esi
+  803ca5:	52                   	push   %edx
+  803ca6:	50                   	push   %eax
+  803ca7:	68 88 5e 80 00       	push   $0x805e88
+  803cac:	68 34 03 00 00       	push   $0x334
+  803cb1:	68 7b 5b 80 00       	push   $0x805b7b
+  803cb6:	e8 a3 c5 ff ff       	call   80025e <_panic>
+	return 0;
+  803cbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803cc0:	89 d8                	mov    %ebx,%eax
+  803cc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cc5:	5b                   	pop    %ebx
+  803cc6:	5e                   	pop    %esi
+  803cc7:	5f                   	pop    %edi
+  803cc8:	5d                   	pop    %ebp
+  803cc9:	c3                   	ret
+
+00803cca <page_adopt>:
+{
+  803cca:	55                   	push   %ebp
+  803ccb:	89 e5                	mov    %esp,%ebp
+  803ccd:	56                   	push   %esi
+  803cce:	53                   	push   %ebx
+  803ccf:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803cd1:	c1 e8 16             	shr    $0x16,%eax
+  803cd4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803cdb:	25 81 00 00 00       	and    $0x81,%eax
+  803ce0:	83 f8 01             	cmp    $0x1,%eax
+  803ce3:	75 53                	jne    803d38 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803ce5:	89 d8                	mov    %ebx,%eax
+  803ce7:	c1 e8 0c             	shr    $0xc,%eax
+  803cea:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803cf1:	89 f2                	mov    %esi,%edx
+  803cf3:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803cfe:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803d04:	75 37                	jne    803d3d <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803d06:	83 ec 08             	sub    $0x8,%esp
+  803d09:	6a 01                	push   $0x1
+  803d0b:	53                   	push   %ebx
+  803d0c:	e8 fa fb ff ff       	call   80390b <umapdir_walk>
+  803d11:	83 c4 10             	add    $0x10,%esp
+  803d14:	85 c0                	test   %eax,%eax
+  803d16:	74 2c                	je     803d44 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803d18:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803d1e:	83 ce 01             	or     $0x1,%esi
+  803d21:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803d23:	83 ec 08             	sub    $0x8,%esp
+  803d26:	53                   	push   %ebx
+  803d27:	6a 00                	push   $0x0
+  803d29:	e8 6a d1 ff ff       	call   800e98 <sys_page_unmap>
+	return 1;
+  803d2e:	83 c4 10             	add    $0x10,%esp
+  803d31:	b8 01 00 00 00       	mov    $0x1,%eax
+  803d36:	eb 05                	jmp    803d3d <page_adopt+0x73>
+		return 0;
+  803d38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d3d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d40:	5b                   	pop    %ebx
+  803d41:	5e                   	pop    %esi
+  803d42:	5d                   	pop    %ebp
+  803d43:	c3                   	ret
+		return -E_NO_MEM;
+  803d44:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803d49:	eb f2                	jmp    803d3d <page_adopt+0x73>
+
+00803d4b <page_forget>:
+{
+  803d4b:	55                   	push   %ebp
+  803d4c:	89 e5                	mov    %esp,%ebp
+  803d4e:	53                   	push   %ebx
+  803d4f:	83 ec 04             	sub    $0x4,%esp
+  803d52:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803d54:	e8 4a ef ff ff       	call   802ca3 <find_paging_env>
+	if (pagingenv == 0)
+  803d59:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803d60:	74 39                	je     803d9b <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803d62:	89 d8                	mov    %ebx,%eax
+  803d64:	c1 e8 16             	shr    $0x16,%eax
+  803d67:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803d6e:	25 81 00 00 00       	and    $0x81,%eax
+  803d73:	83 f8 01             	cmp    $0x1,%eax
+  803d76:	74 28                	je     803da0 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803d78:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803d7f:	74 1a                	je     803d9b <page_forget+0x50>
+  803d81:	83 ec 08             	sub    $0x8,%esp
+  803d84:	6a 00                	push   $0x0
+  803d86:	53                   	push   %ebx
+  803d87:	e8 7f fb ff ff       	call   80390b <umapdir_walk>
+  803d8c:	89 c3                	mov    %eax,%ebx
+  803d8e:	83 c4 10             	add    $0x10,%esp
+  803d91:	85 c0                	test   %eax,%eax
+  803d93:	74 06                	je     803d9b <page_forget+0x50>
+  803d95:	8b 00                	mov    (%eax),%eax
+  803d97:	a8 01                	test   $0x1,%al
+  803d99:	75 2b                	jne    803dc6 <page_forget+0x7b>
+}
+  803d9b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d9e:	c9                   	leave
+  803d9f:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803da0:	89 d8                	mov    %ebx,%eax
+  803da2:	c1 e8 0c             	shr    $0xc,%eax
+  803da5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803dac:	89 c2                	mov    %eax,%edx
+  803dae:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803db4:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803dba:	75 bc                	jne    803d78 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803dbc:	c1 e8 0c             	shr    $0xc,%eax
+  803dbf:	e8 5c ee ff ff       	call   802c20 <page_remove_slot>
+		return;
+  803dc4:	eb d5                	jmp    803d9b <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803dc6:	c1 e8 0c             	shr    $0xc,%eax
+  803dc9:	e8 52 ee ff ff       	call   802c20 <page_remove_slot>
+	*mte = 0;
+  803dce:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803dd4:	eb c5                	jmp    803d9b <page_forget+0x50>
+
+00803dd6 <page_unmap>:
+{
+  803dd6:	55                   	push   %ebp
+  803dd7:	89 e5                	mov    %esp,%ebp
+  803dd9:	57                   	push   %edi
+  803dda:	56                   	push   %esi
+  803ddb:	53                   	push   %ebx
+  803ddc:	83 ec 0c             	sub    $0xc,%esp
+  803ddf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803de2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803de5:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803dea:	8b 40 48             	mov    0x48(%eax),%eax
+  803ded:	85 db                	test   %ebx,%ebx
+  803def:	0f 8e b4 00 00 00    	jle    803ea9 <page_unmap+0xd3>
+  803df5:	39 d8                	cmp    %ebx,%eax
+  803df7:	0f 84 ac 00 00 00    	je     803ea9 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803dfd:	83 ec 08             	sub    $0x8,%esp
+  803e00:	57                   	push   %edi
+  803e01:	53                   	push   %ebx
+  803e02:	e8 91 d0 ff ff       	call   800e98 <sys_page_unmap>
+  803e07:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803e09:	e8 95 ee ff ff       	call   802ca3 <find_paging_env>
+	if (pagingenv == 0)
+  803e0e:	83 c4 10             	add    $0x10,%esp
+  803e11:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803e18:	0f 84 a1 00 00 00    	je     803ebf <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803e1e:	83 ec 0c             	sub    $0xc,%esp
+  803e21:	6a 05                	push   $0x5
+  803e23:	68 00 00 40 00       	push   $0x400000
+  803e28:	6a 00                	push   $0x0
+  803e2a:	68 00 b0 ad de       	push   $0xdeadb000
+  803e2f:	53                   	push   %ebx
+  803e30:	e8 21 d0 ff ff       	call   800e56 <sys_page_map>
+  803e35:	83 c4 20             	add    $0x20,%esp
+  803e38:	85 c0                	test   %eax,%eax
+  803e3a:	0f 88 89 00 00 00    	js     803ec9 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803e40:	89 f8                	mov    %edi,%eax
+  803e42:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803e45:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803e4c:	a8 01                	test   $0x1,%al
+  803e4e:	74 6f                	je     803ebf <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803e50:	83 ec 0c             	sub    $0xc,%esp
+  803e53:	6a 05                	push   $0x5
+  803e55:	68 00 00 40 00       	push   $0x400000
+  803e5a:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803e5c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803e61:	50                   	push   %eax
+  803e62:	53                   	push   %ebx
+  803e63:	e8 ee cf ff ff       	call   800e56 <sys_page_map>
+  803e68:	83 c4 20             	add    $0x20,%esp
+  803e6b:	85 c0                	test   %eax,%eax
+  803e6d:	78 6f                	js     803ede <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803e6f:	c1 ef 0c             	shr    $0xc,%edi
+  803e72:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803e78:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803e7f:	01 
+  803e80:	74 3d                	je     803ebf <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803e82:	83 ec 08             	sub    $0x8,%esp
+  803e85:	68 00 00 40 00       	push   $0x400000
+  803e8a:	6a 00                	push   $0x0
+  803e8c:	e8 07 d0 ff ff       	call   800e98 <sys_page_unmap>
+  803e91:	83 c4 10             	add    $0x10,%esp
+  803e94:	85 c0                	test   %eax,%eax
+  803e96:	78 5b                	js     803ef3 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803e98:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803e9f:	c1 e8 0c             	shr    $0xc,%eax
+  803ea2:	e8 79 ed ff ff       	call   802c20 <page_remove_slot>
+	return r;
+  803ea7:	eb 16                	jmp    803ebf <page_unmap+0xe9>
+		page_forget(va);
+  803ea9:	89 f8                	mov    %edi,%eax
+  803eab:	e8 9b fe ff ff       	call   803d4b <page_forget>
+		return sys_page_unmap(envid, va);
+  803eb0:	83 ec 08             	sub    $0x8,%esp
+  803eb3:	57                   	push   %edi
+  803eb4:	53                   	push   %ebx
+  803eb5:	e8 de cf ff ff       	call   800e98 <sys_page_unmap>
+  803eba:	89 c6                	mov    %eax,%esi
+  803ebc:	83 c4 10             	add    $0x10,%esp
+}
+  803ebf:	89 f0                	mov    %esi,%eax
+  803ec1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ec4:	5b                   	pop    %ebx
+  803ec5:	5e                   	pop    %esi
+  803ec6:	5f                   	pop    %edi
+  803ec7:	5d                   	pop    %ebp
+  803ec8:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803ec9:	50                   	push   %eax
+  803eca:	68 c4 5e 80 00       	push   $0x805ec4
+  803ecf:	68 e4 03 00 00       	push   $0x3e4
+  803ed4:	68 7b 5b 80 00       	push   $0x805b7b
+  803ed9:	e8 80 c3 ff ff       	call   80025e <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803ede:	50                   	push   %eax
+  803edf:	68 f0 5e 80 00       	push   $0x805ef0
+  803ee4:	68 ea 03 00 00       	push   $0x3ea
+  803ee9:	68 7b 5b 80 00       	push   $0x805b7b
+  803eee:	e8 6b c3 ff ff       	call   80025e <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803ef3:	50                   	push   %eax
+  803ef4:	68 1c 5f 80 00       	push   $0x805f1c
+  803ef9:	68 ef 03 00 00       	push   $0x3ef
+  803efe:	68 7b 5b 80 00       	push   $0x805b7b
+  803f03:	e8 56 c3 ff ff       	call   80025e <_panic>
+
+00803f08 <page_unmap_range>:
+{
+  803f08:	55                   	push   %ebp
+  803f09:	89 e5                	mov    %esp,%ebp
+  803f0b:	57                   	push   %edi
+  803f0c:	56                   	push   %esi
+  803f0d:	53                   	push   %ebx
+  803f0e:	83 ec 0c             	sub    $0xc,%esp
+  803f11:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803f14:	e8 8a ed ff ff       	call   802ca3 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803f19:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803f1e:	8b 40 48             	mov    0x48(%eax),%eax
+  803f21:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803f25:	7e 38                	jle    803f5f <page_unmap_range+0x57>
+  803f27:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803f2a:	74 33                	je     803f5f <page_unmap_range+0x57>
+  803f2c:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803f33:	74 2a                	je     803f5f <page_unmap_range+0x57>
+  803f35:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  803f38:	be 00 00 00 00       	mov    $0x0,%esi
+  803f3d:	39 fe                	cmp    %edi,%esi
+  803f3f:	74 56                	je     803f97 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  803f41:	83 ec 08             	sub    $0x8,%esp
+  803f44:	53                   	push   %ebx
+  803f45:	ff 75 08             	push   0x8(%ebp)
+  803f48:	e8 89 fe ff ff       	call   803dd6 <page_unmap>
+  803f4d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803f53:	83 c4 10             	add    $0x10,%esp
+  803f56:	85 c0                	test   %eax,%eax
+  803f58:	78 35                	js     803f8f <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  803f5a:	83 c6 01             	add    $0x1,%esi
+  803f5d:	eb de                	jmp    803f3d <page_unmap_range+0x35>
+  803f5f:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803f62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f67:	eb 10                	jmp    803f79 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803f69:	89 f0                	mov    %esi,%eax
+  803f6b:	e8 db fd ff ff       	call   803d4b <page_forget>
+		for (i = 0; i < npages; i++)
+  803f70:	83 c3 01             	add    $0x1,%ebx
+  803f73:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803f79:	39 fb                	cmp    %edi,%ebx
+  803f7b:	75 ec                	jne    803f69 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  803f7d:	83 ec 04             	sub    $0x4,%esp
+  803f80:	57                   	push   %edi
+  803f81:	ff 75 0c             	push   0xc(%ebp)
+  803f84:	ff 75 08             	push   0x8(%ebp)
+  803f87:	e8 20 d0 ff ff       	call   800fac <sys_page_unmap_range>
+  803f8c:	83 c4 10             	add    $0x10,%esp
+}
+  803f8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f92:	5b                   	pop    %ebx
+  803f93:	5e                   	pop    %esi
+  803f94:	5f                   	pop    %edi
+  803f95:	5d                   	pop    %ebp
+  803f96:	c3                   	ret
+	return 0;
+  803f97:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f9c:	eb f1                	jmp    803f8f <page_unmap_range+0x87>
+
+00803f9e <page_alloc_range>:
+{
+  803f9e:	55                   	push   %ebp
+  803f9f:	89 e5                	mov    %esp,%ebp
+  803fa1:	57                   	push   %edi
+  803fa2:	56                   	push   %esi
+  803fa3:	53                   	push   %ebx
+  803fa4:	83 ec 1c             	sub    $0x1c,%esp
+  803fa7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803faa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  803fad:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803fb4:	74 14                	je     803fca <page_alloc_range+0x2c>
+	if (check_mte)
+  803fb6:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803fba:	74 66                	je     804022 <page_alloc_range+0x84>
+  803fbc:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  803fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fc3:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803fc6:	89 c7                	mov    %eax,%edi
+  803fc8:	eb 10                	jmp    803fda <page_alloc_range+0x3c>
+		init_map_dir();
+  803fca:	e8 e6 f8 ff ff       	call   8038b5 <init_map_dir>
+  803fcf:	eb e5                	jmp    803fb6 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803fd1:	83 c7 01             	add    $0x1,%edi
+  803fd4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803fda:	39 df                	cmp    %ebx,%edi
+  803fdc:	74 38                	je     804016 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  803fde:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803fe1:	83 ec 08             	sub    $0x8,%esp
+  803fe4:	6a 00                	push   $0x0
+  803fe6:	56                   	push   %esi
+  803fe7:	e8 1f f9 ff ff       	call   80390b <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  803fec:	83 c4 10             	add    $0x10,%esp
+  803fef:	85 c0                	test   %eax,%eax
+  803ff1:	74 de                	je     803fd1 <page_alloc_range+0x33>
+  803ff3:	8b 10                	mov    (%eax),%edx
+  803ff5:	f6 c2 01             	test   $0x1,%dl
+  803ff8:	74 d7                	je     803fd1 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  803ffa:	83 ec 08             	sub    $0x8,%esp
+  803ffd:	ff 75 e4             	push   -0x1c(%ebp)
+  804000:	52                   	push   %edx
+  804001:	50                   	push   %eax
+  804002:	68 88 5e 80 00       	push   $0x805e88
+  804007:	68 0b 04 00 00       	push   $0x40b
+  80400c:	68 7b 5b 80 00       	push   $0x805b7b
+  804011:	e8 48 c2 ff ff       	call   80025e <_panic>
+  804016:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804019:	eb 07                	jmp    804022 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  80401b:	c1 e0 0c             	shl    $0xc,%eax
+  80401e:	01 c7                	add    %eax,%edi
+			npages -= r;
+  804020:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  804022:	85 db                	test   %ebx,%ebx
+  804024:	74 30                	je     804056 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  804026:	ff 75 14             	push   0x14(%ebp)
+  804029:	53                   	push   %ebx
+  80402a:	57                   	push   %edi
+  80402b:	ff 75 08             	push   0x8(%ebp)
+  80402e:	e8 0b cf ff ff       	call   800f3e <sys_page_alloc_range>
+  804033:	89 c6                	mov    %eax,%esi
+  804035:	83 c4 10             	add    $0x10,%esp
+  804038:	85 c0                	test   %eax,%eax
+  80403a:	7f df                	jg     80401b <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  80403c:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  80403f:	75 1a                	jne    80405b <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  804041:	83 ec 08             	sub    $0x8,%esp
+  804044:	57                   	push   %edi
+  804045:	ff 75 08             	push   0x8(%ebp)
+  804048:	e8 68 f9 ff ff       	call   8039b5 <page_out>
+  80404d:	83 c4 10             	add    $0x10,%esp
+  804050:	85 c0                	test   %eax,%eax
+  804052:	79 ce                	jns    804022 <page_alloc_range+0x84>
+  804054:	eb 05                	jmp    80405b <page_alloc_range+0xbd>
+	return 0;
+  804056:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  80405b:	89 f0                	mov    %esi,%eax
+  80405d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804060:	5b                   	pop    %ebx
+  804061:	5e                   	pop    %esi
+  804062:	5f                   	pop    %edi
+  804063:	5d                   	pop    %ebp
+  804064:	c3                   	ret
+
+00804065 <page_in>:
+{
+  804065:	55                   	push   %ebp
+  804066:	89 e5                	mov    %esp,%ebp
+  804068:	57                   	push   %edi
+  804069:	56                   	push   %esi
+  80406a:	53                   	push   %ebx
+  80406b:	83 ec 3c             	sub    $0x3c,%esp
+  80406e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  804071:	e8 2d ec ff ff       	call   802ca3 <find_paging_env>
+	if (pagingenv == 0)
+  804076:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  80407d:	0f 84 09 02 00 00    	je     80428c <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  804083:	83 ec 08             	sub    $0x8,%esp
+  804086:	6a 00                	push   $0x0
+  804088:	56                   	push   %esi
+  804089:	e8 7d f8 ff ff       	call   80390b <umapdir_walk>
+  80408e:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  804090:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  804096:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  804099:	83 c4 10             	add    $0x10,%esp
+  80409c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8040a0:	74 0d                	je     8040af <page_in+0x4a>
+  8040a2:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8040a7:	8b 40 48             	mov    0x48(%eax),%eax
+  8040aa:	3b 45 08             	cmp    0x8(%ebp),%eax
+  8040ad:	75 06                	jne    8040b5 <page_in+0x50>
+  8040af:	8b 03                	mov    (%ebx),%eax
+  8040b1:	a8 02                	test   $0x2,%al
+  8040b3:	75 63                	jne    804118 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  8040b5:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  8040b7:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  8040b9:	89 f0                	mov    %esi,%eax
+  8040bb:	25 06 0e 00 00       	and    $0xe06,%eax
+  8040c0:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  8040c3:	50                   	push   %eax
+  8040c4:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  8040c7:	57                   	push   %edi
+  8040c8:	ff 75 08             	push   0x8(%ebp)
+  8040cb:	e8 65 fb ff ff       	call   803c35 <page_alloc>
+  8040d0:	83 c4 10             	add    $0x10,%esp
+  8040d3:	85 c0                	test   %eax,%eax
+  8040d5:	78 39                	js     804110 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  8040d7:	89 f0                	mov    %esi,%eax
+  8040d9:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8040dc:	83 ec 0c             	sub    $0xc,%esp
+  8040df:	6a 07                	push   $0x7
+  8040e1:	6a 01                	push   $0x1
+  8040e3:	57                   	push   %edi
+  8040e4:	c1 e0 04             	shl    $0x4,%eax
+  8040e7:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8040e8:	c1 ee 1c             	shr    $0x1c,%esi
+  8040eb:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8040ee:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  8040f5:	e8 f1 0f 00 00       	call   8050eb <ipc_call>
+  8040fa:	83 c4 20             	add    $0x20,%esp
+  8040fd:	85 c0                	test   %eax,%eax
+  8040ff:	0f 88 72 01 00 00    	js     804277 <page_in+0x212>
+	*mte = 0;
+  804105:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  80410b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804110:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804113:	5b                   	pop    %ebx
+  804114:	5e                   	pop    %esi
+  804115:	5f                   	pop    %edi
+  804116:	5d                   	pop    %ebp
+  804117:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804118:	25 06 0e 00 00       	and    $0xe06,%eax
+  80411d:	83 c8 01             	or     $0x1,%eax
+  804120:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  804123:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804126:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  804129:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  80412f:	be 01 00 00 00       	mov    $0x1,%esi
+  804134:	eb 46                	jmp    80417c <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  804136:	83 ec 08             	sub    $0x8,%esp
+  804139:	6a 00                	push   $0x0
+  80413b:	51                   	push   %ecx
+  80413c:	e8 ca f7 ff ff       	call   80390b <umapdir_walk>
+  804141:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  804145:	83 c4 10             	add    $0x10,%esp
+  804148:	85 c0                	test   %eax,%eax
+  80414a:	74 66                	je     8041b2 <page_in+0x14d>
+  80414c:	8b 00                	mov    (%eax),%eax
+  80414e:	a8 01                	test   $0x1,%al
+  804150:	74 60                	je     8041b2 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  804152:	89 c2                	mov    %eax,%edx
+  804154:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  80415a:	83 ca 01             	or     $0x1,%edx
+  80415d:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  804160:	75 50                	jne    8041b2 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  804162:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804168:	c1 e8 1c             	shr    $0x1c,%eax
+  80416b:	8b 13                	mov    (%ebx),%edx
+  80416d:	c1 ea 1c             	shr    $0x1c,%edx
+  804170:	39 d0                	cmp    %edx,%eax
+  804172:	75 3e                	jne    8041b2 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804174:	83 c6 01             	add    $0x1,%esi
+  804177:	83 fe 08             	cmp    $0x8,%esi
+  80417a:	74 3f                	je     8041bb <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  80417c:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  80417e:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  804184:	77 2c                	ja     8041b2 <page_in+0x14d>
+  804186:	89 f8                	mov    %edi,%eax
+  804188:	c1 e8 16             	shr    $0x16,%eax
+  80418b:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  804192:	f6 c2 01             	test   $0x1,%dl
+  804195:	74 9f                	je     804136 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804197:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  80419e:	a8 80                	test   $0x80,%al
+  8041a0:	75 10                	jne    8041b2 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  8041a2:	89 f8                	mov    %edi,%eax
+  8041a4:	c1 e8 0c             	shr    $0xc,%eax
+  8041a7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8041ae:	a8 01                	test   $0x1,%al
+  8041b0:	74 84                	je     804136 <page_in+0xd1>
+	if (n == 1)
+  8041b2:	83 fe 01             	cmp    $0x1,%esi
+  8041b5:	0f 84 fa fe ff ff    	je     8040b5 <page_in+0x50>
+	req.nslots = n;
+  8041bb:	89 35 00 90 80 00    	mov    %esi,0x809000
+	for (i = 0; i < n; i++)
+  8041c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c6:	eb 13                	jmp    8041db <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  8041c8:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  8041cc:	8b 12                	mov    (%edx),%edx
+  8041ce:	c1 ea 0c             	shr    $0xc,%edx
+  8041d1:	89 14 85 04 90 80 00 	mov    %edx,0x809004(,%eax,4)
+	for (i = 0; i < n; i++)
+  8041d8:	83 c0 01             	add    $0x1,%eax
+  8041db:	39 c6                	cmp    %eax,%esi
+  8041dd:	75 e9                	jne    8041c8 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  8041df:	83 ec 0c             	sub    $0xc,%esp
+  8041e2:	6a 00                	push   $0x0
+  8041e4:	ff 75 c0             	push   -0x40(%ebp)
+  8041e7:	56                   	push   %esi
+  8041e8:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  8041eb:	57                   	push   %edi
+  8041ec:	6a 00                	push   $0x0
+  8041ee:	e8 ab fd ff ff       	call   803f9e <page_alloc_range>
+  8041f3:	83 c4 20             	add    $0x20,%esp
+  8041f6:	85 c0                	test   %eax,%eax
+  8041f8:	78 6e                	js     804268 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  8041fa:	83 ec 04             	sub    $0x4,%esp
+  8041fd:	6a 24                	push   $0x24
+  8041ff:	68 00 90 80 00       	push   $0x809000
+  804204:	57                   	push   %edi
+  804205:	e8 9c c8 ff ff       	call   800aa6 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  80420a:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  804211:	56                   	push   %esi
+  804212:	57                   	push   %edi
+  804213:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  804215:	0f b7 05 06 90 80 00 	movzwl 0x809006,%eax
+  80421c:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  80421f:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  804226:	e8 c0 0e 00 00       	call   8050eb <ipc_call>
+  80422b:	83 c4 20             	add    $0x20,%esp
+  80422e:	85 c0                	test   %eax,%eax
+  804230:	78 08                	js     80423a <page_in+0x1d5>
+  804232:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  804235:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  804238:	eb 20                	jmp    80425a <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  80423a:	50                   	push   %eax
+  80423b:	68 48 5f 80 00       	push   $0x805f48
+  804240:	68 59 02 00 00       	push   $0x259
+  804245:	68 7b 5b 80 00       	push   $0x805b7b
+  80424a:	e8 0f c0 ff ff       	call   80025e <_panic>
+		*mtes[i] = 0;
+  80424f:	8b 10                	mov    (%eax),%edx
+  804251:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  804257:	83 c0 04             	add    $0x4,%eax
+  80425a:	39 c8                	cmp    %ecx,%eax
+  80425c:	75 f1                	jne    80424f <page_in+0x1ea>
+	return n;
+  80425e:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  804260:	85 f6                	test   %esi,%esi
+  804262:	0f 84 4d fe ff ff    	je     8040b5 <page_in+0x50>
+		return r < 0 ? r : 0;
+  804268:	85 c0                	test   %eax,%eax
+  80426a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80426f:	0f 4f c2             	cmovg  %edx,%eax
+  804272:	e9 99 fe ff ff       	jmp    804110 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  804277:	50                   	push   %eax
+  804278:	68 80 5f 80 00       	push   $0x805f80
+  80427d:	68 9a 02 00 00       	push   $0x29a
+  804282:	68 7b 5b 80 00       	push   $0x805b7b
+  804287:	e8 d2 bf ff ff       	call   80025e <_panic>
+		return -E_PAGING;
+  80428c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804291:	e9 7a fe ff ff       	jmp    804110 <page_in+0xab>
+
+00804296 <page_map>:
+{
+  804296:	55                   	push   %ebp
+  804297:	89 e5                	mov    %esp,%ebp
+  804299:	57                   	push   %edi
+  80429a:	56                   	push   %esi
+  80429b:	53                   	push   %ebx
+  80429c:	83 ec 1c             	sub    $0x1c,%esp
+  80429f:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8042a2:	83 ec 0c             	sub    $0xc,%esp
+  8042a5:	ff 75 18             	push   0x18(%ebp)
+  8042a8:	ff 75 14             	push   0x14(%ebp)
+  8042ab:	ff 75 10             	push   0x10(%ebp)
+  8042ae:	ff 75 0c             	push   0xc(%ebp)
+  8042b1:	56                   	push   %esi
+  8042b2:	e8 9f cb ff ff       	call   800e56 <sys_page_map>
+  8042b7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8042ba:	83 c4 20             	add    $0x20,%esp
+  8042bd:	85 c0                	test   %eax,%eax
+  8042bf:	0f 89 a9 01 00 00    	jns    80446e <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  8042c5:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  8042c9:	74 5f                	je     80432a <page_map+0x94>
+		if (r != -E_INVAL)
+  8042cb:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  8042cf:	0f 85 a0 01 00 00    	jne    804475 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8042d5:	85 f6                	test   %esi,%esi
+  8042d7:	74 70                	je     804349 <page_map+0xb3>
+  8042d9:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8042de:	8b 40 48             	mov    0x48(%eax),%eax
+  8042e1:	39 f0                	cmp    %esi,%eax
+  8042e3:	74 64                	je     804349 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8042e5:	83 ec 0c             	sub    $0xc,%esp
+  8042e8:	6a 05                	push   $0x5
+  8042ea:	68 00 00 40 00       	push   $0x400000
+  8042ef:	6a 00                	push   $0x0
+  8042f1:	68 00 b0 ad de       	push   $0xdeadb000
+  8042f6:	56                   	push   %esi
+  8042f7:	e8 5a cb ff ff       	call   800e56 <sys_page_map>
+  8042fc:	89 c3                	mov    %eax,%ebx
+  8042fe:	83 c4 20             	add    $0x20,%esp
+  804301:	85 c0                	test   %eax,%eax
+  804303:	79 6a                	jns    80436f <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  804305:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804308:	75 50                	jne    80435a <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  80430a:	83 ec 08             	sub    $0x8,%esp
+  80430d:	68 00 00 40 00       	push   $0x400000
+  804312:	6a fc                	push   $0xfffffffc
+  804314:	e8 9c f6 ff ff       	call   8039b5 <page_out>
+  804319:	83 c4 10             	add    $0x10,%esp
+  80431c:	85 c0                	test   %eax,%eax
+  80431e:	79 c5                	jns    8042e5 <page_map+0x4f>
+}
+  804320:	89 d8                	mov    %ebx,%eax
+  804322:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804325:	5b                   	pop    %ebx
+  804326:	5e                   	pop    %esi
+  804327:	5f                   	pop    %edi
+  804328:	5d                   	pop    %ebp
+  804329:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  80432a:	83 ec 08             	sub    $0x8,%esp
+  80432d:	68 00 00 40 00       	push   $0x400000
+  804332:	6a 00                	push   $0x0
+  804334:	e8 7c f6 ff ff       	call   8039b5 <page_out>
+  804339:	83 c4 10             	add    $0x10,%esp
+  80433c:	85 c0                	test   %eax,%eax
+  80433e:	0f 89 5e ff ff ff    	jns    8042a2 <page_map+0xc>
+				return r;
+  804344:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804347:	eb d7                	jmp    804320 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804349:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80434c:	e8 79 f9 ff ff       	call   803cca <page_adopt>
+  804351:	85 c0                	test   %eax,%eax
+  804353:	79 90                	jns    8042e5 <page_map+0x4f>
+			return r;
+  804355:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804358:	eb c6                	jmp    804320 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  80435a:	53                   	push   %ebx
+  80435b:	68 b4 5f 80 00       	push   $0x805fb4
+  804360:	68 77 03 00 00       	push   $0x377
+  804365:	68 7b 5b 80 00       	push   $0x805b7b
+  80436a:	e8 ef be ff ff       	call   80025e <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  80436f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804372:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  804375:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  80437c:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  804382:	0f 84 f5 00 00 00    	je     80447d <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  804388:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80438e:	83 ec 0c             	sub    $0xc,%esp
+  804391:	6a 05                	push   $0x5
+  804393:	68 00 00 40 00       	push   $0x400000
+  804398:	6a 00                	push   $0x0
+  80439a:	57                   	push   %edi
+  80439b:	56                   	push   %esi
+  80439c:	e8 b5 ca ff ff       	call   800e56 <sys_page_map>
+  8043a1:	89 c3                	mov    %eax,%ebx
+  8043a3:	83 c4 20             	add    $0x20,%esp
+  8043a6:	85 c0                	test   %eax,%eax
+  8043a8:	79 35                	jns    8043df <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  8043aa:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8043ad:	75 1b                	jne    8043ca <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8043af:	83 ec 08             	sub    $0x8,%esp
+  8043b2:	68 00 00 40 00       	push   $0x400000
+  8043b7:	6a 00                	push   $0x0
+  8043b9:	e8 f7 f5 ff ff       	call   8039b5 <page_out>
+  8043be:	83 c4 10             	add    $0x10,%esp
+  8043c1:	85 c0                	test   %eax,%eax
+  8043c3:	79 c9                	jns    80438e <page_map+0xf8>
+  8043c5:	e9 56 ff ff ff       	jmp    804320 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  8043ca:	53                   	push   %ebx
+  8043cb:	68 dc 5f 80 00       	push   $0x805fdc
+  8043d0:	68 83 03 00 00       	push   $0x383
+  8043d5:	68 7b 5b 80 00       	push   $0x805b7b
+  8043da:	e8 7f be ff ff       	call   80025e <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  8043df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8043e2:	c1 e8 0c             	shr    $0xc,%eax
+  8043e5:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8043ea:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  8043f1:	01 
+  8043f2:	0f 84 8d 00 00 00    	je     804485 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  8043f8:	83 ec 08             	sub    $0x8,%esp
+  8043fb:	68 00 00 40 00       	push   $0x400000
+  804400:	6a 00                	push   $0x0
+  804402:	e8 91 ca ff ff       	call   800e98 <sys_page_unmap>
+  804407:	83 c4 10             	add    $0x10,%esp
+  80440a:	85 c0                	test   %eax,%eax
+  80440c:	78 36                	js     804444 <page_map+0x1ae>
+  80440e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  804411:	83 ec 08             	sub    $0x8,%esp
+  804414:	57                   	push   %edi
+  804415:	56                   	push   %esi
+  804416:	e8 4a fc ff ff       	call   804065 <page_in>
+  80441b:	89 c3                	mov    %eax,%ebx
+  80441d:	83 c4 10             	add    $0x10,%esp
+  804420:	85 c0                	test   %eax,%eax
+  804422:	0f 89 7a fe ff ff    	jns    8042a2 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  804428:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80442b:	75 2c                	jne    804459 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  80442d:	83 ec 08             	sub    $0x8,%esp
+  804430:	57                   	push   %edi
+  804431:	6a 00                	push   $0x0
+  804433:	e8 7d f5 ff ff       	call   8039b5 <page_out>
+  804438:	83 c4 10             	add    $0x10,%esp
+  80443b:	85 c0                	test   %eax,%eax
+  80443d:	79 d2                	jns    804411 <page_map+0x17b>
+  80443f:	e9 dc fe ff ff       	jmp    804320 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  804444:	50                   	push   %eax
+  804445:	68 08 60 80 00       	push   $0x806008
+  80444a:	68 8b 03 00 00       	push   $0x38b
+  80444f:	68 7b 5b 80 00       	push   $0x805b7b
+  804454:	e8 05 be ff ff       	call   80025e <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  804459:	53                   	push   %ebx
+  80445a:	68 30 60 80 00       	push   $0x806030
+  80445f:	68 91 03 00 00       	push   $0x391
+  804464:	68 7b 5b 80 00       	push   $0x805b7b
+  804469:	e8 f0 bd ff ff       	call   80025e <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  80446e:	89 c3                	mov    %eax,%ebx
+  804470:	e9 ab fe ff ff       	jmp    804320 <page_map+0x8a>
+  804475:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804478:	e9 a3 fe ff ff       	jmp    804320 <page_map+0x8a>
+			return r; // Pass through the error
+  80447d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804480:	e9 9b fe ff ff       	jmp    804320 <page_map+0x8a>
+			return r; // Pass through the error
+  804485:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804488:	e9 93 fe ff ff       	jmp    804320 <page_map+0x8a>
+
+0080448d <page_map_range>:
+{
+  80448d:	55                   	push   %ebp
+  80448e:	89 e5                	mov    %esp,%ebp
+  804490:	57                   	push   %edi
+  804491:	56                   	push   %esi
+  804492:	53                   	push   %ebx
+  804493:	83 ec 0c             	sub    $0xc,%esp
+  804496:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804499:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  80449c:	83 ec 08             	sub    $0x8,%esp
+  80449f:	ff 75 1c             	push   0x1c(%ebp)
+  8044a2:	ff 75 18             	push   0x18(%ebp)
+  8044a5:	56                   	push   %esi
+  8044a6:	ff 75 10             	push   0x10(%ebp)
+  8044a9:	57                   	push   %edi
+  8044aa:	ff 75 08             	push   0x8(%ebp)
+  8044ad:	e8 af ca ff ff       	call   800f61 <sys_page_map_range>
+  8044b2:	89 c3                	mov    %eax,%ebx
+  8044b4:	83 c4 20             	add    $0x20,%esp
+  8044b7:	85 c0                	test   %eax,%eax
+  8044b9:	79 1b                	jns    8044d6 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  8044bb:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8044be:	75 20                	jne    8044e0 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8044c0:	83 ec 08             	sub    $0x8,%esp
+  8044c3:	68 00 00 40 00       	push   $0x400000
+  8044c8:	6a 00                	push   $0x0
+  8044ca:	e8 e6 f4 ff ff       	call   8039b5 <page_out>
+  8044cf:	83 c4 10             	add    $0x10,%esp
+  8044d2:	85 c0                	test   %eax,%eax
+  8044d4:	79 c6                	jns    80449c <page_map_range+0xf>
+}
+  8044d6:	89 d8                	mov    %ebx,%eax
+  8044d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044db:	5b                   	pop    %ebx
+  8044dc:	5e                   	pop    %esi
+  8044dd:	5f                   	pop    %edi
+  8044de:	5d                   	pop    %ebp
+  8044df:	c3                   	ret
+		if (r != -E_INVAL)
+  8044e0:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  8044e3:	75 f1                	jne    8044d6 <page_map_range+0x49>
+  8044e5:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  8044e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8044ec:	eb 03                	jmp    8044f1 <page_map_range+0x64>
+  8044ee:	83 c6 01             	add    $0x1,%esi
+  8044f1:	3b 75 18             	cmp    0x18(%ebp),%esi
+  8044f4:	74 2a                	je     804520 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  8044f6:	83 ec 0c             	sub    $0xc,%esp
+  8044f9:	ff 75 1c             	push   0x1c(%ebp)
+  8044fc:	53                   	push   %ebx
+  8044fd:	ff 75 10             	push   0x10(%ebp)
+  804500:	57                   	push   %edi
+  804501:	ff 75 08             	push   0x8(%ebp)
+  804504:	e8 8d fd ff ff       	call   804296 <page_map>
+  804509:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80450f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  804515:	83 c4 20             	add    $0x20,%esp
+  804518:	85 c0                	test   %eax,%eax
+  80451a:	79 d2                	jns    8044ee <page_map_range+0x61>
+  80451c:	89 c3                	mov    %eax,%ebx
+  80451e:	eb b6                	jmp    8044d6 <page_map_range+0x49>
+		return 0;
+  804520:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804525:	eb af                	jmp    8044d6 <page_map_range+0x49>
+
+00804527 <paging_pgfault_handler>:
+{
+  804527:	55                   	push   %ebp
+  804528:	89 e5                	mov    %esp,%ebp
+  80452a:	56                   	push   %esi
+  80452b:	53                   	push   %ebx
+  80452c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  80452f:	e8 6f e7 ff ff       	call   802ca3 <find_paging_env>
+	if (pagingenv == 0)
+  804534:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  804539:	85 c0                	test   %eax,%eax
+  80453b:	74 3c                	je     804579 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  80453d:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  80453f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804543:	75 12                	jne    804557 <paging_pgfault_handler+0x30>
+  804545:	89 f0                	mov    %esi,%eax
+  804547:	e8 7e f7 ff ff       	call   803cca <page_adopt>
+  80454c:	89 c2                	mov    %eax,%edx
+		return 0;
+  80454e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804553:	85 d2                	test   %edx,%edx
+  804555:	78 22                	js     804579 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  804557:	83 ec 08             	sub    $0x8,%esp
+  80455a:	6a 00                	push   $0x0
+  80455c:	56                   	push   %esi
+  80455d:	e8 a9 f3 ff ff       	call   80390b <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  804562:	83 c4 10             	add    $0x10,%esp
+  804565:	85 c0                	test   %eax,%eax
+  804567:	74 05                	je     80456e <paging_pgfault_handler+0x47>
+  804569:	f6 00 01             	testb  $0x1,(%eax)
+  80456c:	75 12                	jne    804580 <paging_pgfault_handler+0x59>
+	return 0;
+  80456e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804573:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804577:	74 23                	je     80459c <paging_pgfault_handler+0x75>
+}
+  804579:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80457c:	5b                   	pop    %ebx
+  80457d:	5e                   	pop    %esi
+  80457e:	5d                   	pop    %ebp
+  80457f:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  804580:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804585:	8b 40 48             	mov    0x48(%eax),%eax
+  804588:	83 ec 08             	sub    $0x8,%esp
+  80458b:	56                   	push   %esi
+  80458c:	50                   	push   %eax
+  80458d:	e8 d3 fa ff ff       	call   804065 <page_in>
+  804592:	f7 d0                	not    %eax
+  804594:	c1 e8 1f             	shr    $0x1f,%eax
+  804597:	83 c4 10             	add    $0x10,%esp
+  80459a:	eb dd                	jmp    804579 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  80459c:	89 f0                	mov    %esi,%eax
+  80459e:	e8 97 e2 ff ff       	call   80283a <segment_lookup>
+  8045a3:	89 c2                	mov    %eax,%edx
+	return 0;
+  8045a5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8045aa:	85 d2                	test   %edx,%edx
+  8045ac:	74 cb                	je     804579 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  8045ae:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8045b3:	8b 40 48             	mov    0x48(%eax),%eax
+  8045b6:	83 ec 08             	sub    $0x8,%esp
+  8045b9:	56                   	push   %esi
+  8045ba:	50                   	push   %eax
+  8045bb:	e8 f5 f3 ff ff       	call   8039b5 <page_out>
+  8045c0:	f7 d0                	not    %eax
+  8045c2:	c1 e8 1f             	shr    $0x1f,%eax
+  8045c5:	83 c4 10             	add    $0x10,%esp
+  8045c8:	eb af                	jmp    804579 <paging_pgfault_handler+0x52>
+
+008045ca <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  8045ca:	55                   	push   %ebp
+  8045cb:	89 e5                	mov    %esp,%ebp
+  8045cd:	57                   	push   %edi
+  8045ce:	56                   	push   %esi
+  8045cf:	53                   	push   %ebx
+  8045d0:	83 ec 2c             	sub    $0x2c,%esp
+  8045d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8045d6:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  8045db:	89 c1                	mov    %eax,%ecx
+  8045dd:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  8045e0:	c1 e8 11             	shr    $0x11,%eax
+  8045e3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8045e6:	8b 3c 85 80 dc 80 00 	mov    0x80dc80(,%eax,4),%edi
+  8045ed:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  8045f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8045f5:	d3 e0                	shl    %cl,%eax
+  8045f7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8045fa:	85 c7                	test   %eax,%edi
+  8045fc:	74 12                	je     804610 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  8045fe:	bb 01 00 00 00       	mov    $0x1,%ebx
+  804603:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  804606:	bf 01 00 00 00       	mov    $0x1,%edi
+  80460b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80460e:	eb 17                	jmp    804627 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  804610:	ff 75 e0             	push   -0x20(%ebp)
+  804613:	68 68 60 80 00       	push   $0x806068
+  804618:	6a 48                	push   $0x48
+  80461a:	68 82 60 80 00       	push   $0x806082
+  80461f:	e8 3a bc ff ff       	call   80025e <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804624:	83 c3 01             	add    $0x1,%ebx
+  804627:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80462a:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  80462d:	89 c8                	mov    %ecx,%eax
+  80462f:	c1 e8 05             	shr    $0x5,%eax
+  804632:	8b 14 85 80 ce 80 00 	mov    0x80ce80(,%eax,4),%edx
+  804639:	89 fe                	mov    %edi,%esi
+  80463b:	d3 e6                	shl    %cl,%esi
+  80463d:	89 f1                	mov    %esi,%ecx
+  80463f:	85 d6                	test   %edx,%esi
+  804641:	74 e1                	je     804624 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  804643:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  804646:	f7 d6                	not    %esi
+  804648:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80464b:	21 fe                	and    %edi,%esi
+  80464d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804650:	89 34 bd 80 dc 80 00 	mov    %esi,0x80dc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  804657:	f7 d1                	not    %ecx
+  804659:	21 d1                	and    %edx,%ecx
+  80465b:	89 0c 85 80 ce 80 00 	mov    %ecx,0x80ce80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804662:	83 ec 04             	sub    $0x4,%esp
+  804665:	53                   	push   %ebx
+  804666:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804669:	57                   	push   %edi
+  80466a:	6a 00                	push   $0x0
+  80466c:	e8 97 f8 ff ff       	call   803f08 <page_unmap_range>
+	va_free(va, n);
+  804671:	83 c4 08             	add    $0x8,%esp
+  804674:	53                   	push   %ebx
+  804675:	57                   	push   %edi
+  804676:	e8 ed 05 00 00       	call   804c68 <va_free>
+}
+  80467b:	83 c4 10             	add    $0x10,%esp
+  80467e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804681:	5b                   	pop    %ebx
+  804682:	5e                   	pop    %esi
+  804683:	5f                   	pop    %edi
+  804684:	5d                   	pop    %ebp
+  804685:	c3                   	ret
+
+00804686 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  804686:	55                   	push   %ebp
+  804687:	89 e5                	mov    %esp,%ebp
+  804689:	57                   	push   %edi
+  80468a:	56                   	push   %esi
+  80468b:	53                   	push   %ebx
+  80468c:	83 ec 1c             	sub    $0x1c,%esp
+  80468f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804692:	85 db                	test   %ebx,%ebx
+  804694:	74 34                	je     8046ca <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  804696:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80469c:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  8046a1:	77 2f                	ja     8046d2 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  8046a3:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8046a9:	75 51                	jne    8046fc <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  8046ab:	89 c1                	mov    %eax,%ecx
+  8046ad:	c1 e9 0c             	shr    $0xc,%ecx
+  8046b0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8046b5:	d3 e2                	shl    %cl,%edx
+  8046b7:	c1 e8 11             	shr    $0x11,%eax
+  8046ba:	23 14 85 80 c0 80 00 	and    0x80c080(,%eax,4),%edx
+  8046c1:	75 24                	jne    8046e7 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  8046c3:	89 d8                	mov    %ebx,%eax
+  8046c5:	e8 00 ff ff ff       	call   8045ca <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  8046ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046cd:	5b                   	pop    %ebx
+  8046ce:	5e                   	pop    %esi
+  8046cf:	5f                   	pop    %edi
+  8046d0:	5d                   	pop    %ebp
+  8046d1:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  8046d2:	53                   	push   %ebx
+  8046d3:	68 8f 60 80 00       	push   $0x80608f
+  8046d8:	68 a2 00 00 00       	push   $0xa2
+  8046dd:	68 82 60 80 00       	push   $0x806082
+  8046e2:	e8 77 bb ff ff       	call   80025e <_panic>
+			panic("free: %p is not allocated", va);
+  8046e7:	53                   	push   %ebx
+  8046e8:	68 68 60 80 00       	push   $0x806068
+  8046ed:	68 a5 00 00 00       	push   $0xa5
+  8046f2:	68 82 60 80 00       	push   $0x806082
+  8046f7:	e8 62 bb ff ff       	call   80025e <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  8046fc:	89 de                	mov    %ebx,%esi
+  8046fe:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  804704:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  80470a:	89 c8                	mov    %ecx,%eax
+  80470c:	c1 e8 11             	shr    $0x11,%eax
+  80470f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804712:	8b 3c 85 80 c0 80 00 	mov    0x80c080(,%eax,4),%edi
+  804719:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  80471c:	c1 e9 0c             	shr    $0xc,%ecx
+  80471f:	b8 01 00 00 00       	mov    $0x1,%eax
+  804724:	d3 e0                	shl    %cl,%eax
+  804726:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804729:	85 c7                	test   %eax,%edi
+  80472b:	74 1b                	je     804748 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  80472d:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804731:	89 d8                	mov    %ebx,%eax
+  804733:	29 f0                	sub    %esi,%eax
+  804735:	83 e8 10             	sub    $0x10,%eax
+  804738:	99                   	cltd
+  804739:	f7 ff                	idiv   %edi
+  80473b:	89 d1                	mov    %edx,%ecx
+  80473d:	85 d2                	test   %edx,%edx
+  80473f:	75 07                	jne    804748 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804741:	ba 10 00 00 00       	mov    $0x10,%edx
+  804746:	eb 18                	jmp    804760 <free+0xda>
+		panic("free: %p is not allocated", va);
+  804748:	53                   	push   %ebx
+  804749:	68 68 60 80 00       	push   $0x806068
+  80474e:	68 ad 00 00 00       	push   $0xad
+  804753:	68 82 60 80 00       	push   $0x806082
+  804758:	e8 01 bb ff ff       	call   80025e <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80475d:	83 c1 01             	add    $0x1,%ecx
+  804760:	89 d0                	mov    %edx,%eax
+  804762:	d3 e0                	shl    %cl,%eax
+  804764:	39 c7                	cmp    %eax,%edi
+  804766:	7f f5                	jg     80475d <free+0xd7>
+	*(void **) va = s->free;
+  804768:	8b 46 08             	mov    0x8(%esi),%eax
+  80476b:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  80476d:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  804770:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  804774:	8d 58 01             	lea    0x1(%eax),%ebx
+  804777:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  80477b:	66 85 c0             	test   %ax,%ax
+  80477e:	74 52                	je     8047d2 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804780:	0f b7 db             	movzwl %bx,%ebx
+  804783:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804787:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80478c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804791:	f7 ff                	idiv   %edi
+  804793:	39 c3                	cmp    %eax,%ebx
+  804795:	0f 85 2f ff ff ff    	jne    8046ca <free+0x44>
+  80479b:	8b 46 04             	mov    0x4(%esi),%eax
+  80479e:	85 c0                	test   %eax,%eax
+  8047a0:	74 53                	je     8047f5 <free+0x16f>
+		s->prev->next = s->next;
+  8047a2:	8b 16                	mov    (%esi),%edx
+  8047a4:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8047a6:	8b 06                	mov    (%esi),%eax
+  8047a8:	85 c0                	test   %eax,%eax
+  8047aa:	74 06                	je     8047b2 <free+0x12c>
+		s->next->prev = s->prev;
+  8047ac:	8b 56 04             	mov    0x4(%esi),%edx
+  8047af:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8047b2:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8047b5:	f7 d0                	not    %eax
+  8047b7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8047ba:	21 d0                	and    %edx,%eax
+  8047bc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8047bf:	89 04 95 80 c0 80 00 	mov    %eax,0x80c080(,%edx,4)
+		heap_free_pages(s);
+  8047c6:	89 f0                	mov    %esi,%eax
+  8047c8:	e8 fd fd ff ff       	call   8045ca <heap_free_pages>
+  8047cd:	e9 f8 fe ff ff       	jmp    8046ca <free+0x44>
+	s->prev = NULL;
+  8047d2:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  8047d9:	8b 04 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%eax
+  8047e0:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  8047e2:	85 c0                	test   %eax,%eax
+  8047e4:	74 03                	je     8047e9 <free+0x163>
+		slabs[c]->prev = s;
+  8047e6:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  8047e9:	89 34 8d 60 c0 80 00 	mov    %esi,0x80c060(,%ecx,4)
+}
+  8047f0:	e9 d5 fe ff ff       	jmp    8046ca <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8047f5:	8b 06                	mov    (%esi),%eax
+  8047f7:	85 c0                	test   %eax,%eax
+  8047f9:	0f 84 cb fe ff ff    	je     8046ca <free+0x44>
+		slabs[c] = s->next;
+  8047ff:	89 04 8d 60 c0 80 00 	mov    %eax,0x80c060(,%ecx,4)
+	if (s->next)
+  804806:	8b 06                	mov    (%esi),%eax
+  804808:	eb a2                	jmp    8047ac <free+0x126>
+
+0080480a <heap_alloc_pages>:
+{
+  80480a:	55                   	push   %ebp
+  80480b:	89 e5                	mov    %esp,%ebp
+  80480d:	57                   	push   %edi
+  80480e:	56                   	push   %esi
+  80480f:	53                   	push   %ebx
+  804810:	83 ec 18             	sub    $0x18,%esp
+  804813:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  804815:	50                   	push   %eax
+  804816:	e8 15 03 00 00       	call   804b30 <va_alloc>
+  80481b:	89 c3                	mov    %eax,%ebx
+  80481d:	83 c4 10             	add    $0x10,%esp
+  804820:	85 c0                	test   %eax,%eax
+  804822:	74 47                	je     80486b <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804824:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  80482a:	89 c1                	mov    %eax,%ecx
+  80482c:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  80482f:	c1 e8 11             	shr    $0x11,%eax
+  804832:	ba 01 00 00 00       	mov    $0x1,%edx
+  804837:	89 d7                	mov    %edx,%edi
+  804839:	d3 e7                	shl    %cl,%edi
+  80483b:	09 3c 85 80 dc 80 00 	or     %edi,0x80dc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  804842:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  804846:	89 c8                	mov    %ecx,%eax
+  804848:	c1 e8 05             	shr    $0x5,%eax
+  80484b:	d3 e2                	shl    %cl,%edx
+  80484d:	09 14 85 80 ce 80 00 	or     %edx,0x80ce80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  804854:	83 ec 0c             	sub    $0xc,%esp
+  804857:	6a 00                	push   $0x0
+  804859:	6a 07                	push   $0x7
+  80485b:	56                   	push   %esi
+  80485c:	53                   	push   %ebx
+  80485d:	6a 00                	push   $0x0
+  80485f:	e8 3a f7 ff ff       	call   803f9e <page_alloc_range>
+  804864:	83 c4 20             	add    $0x20,%esp
+  804867:	85 c0                	test   %eax,%eax
+  804869:	78 0a                	js     804875 <heap_alloc_pages+0x6b>
+}
+  80486b:	89 d8                	mov    %ebx,%eax
+  80486d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804870:	5b                   	pop    %ebx
+  804871:	5e                   	pop    %esi
+  804872:	5f                   	pop    %edi
+  804873:	5d                   	pop    %ebp
+  804874:	c3                   	ret
+		free(va);
+  804875:	83 ec 0c             	sub    $0xc,%esp
+  804878:	53                   	push   %ebx
+  804879:	e8 08 fe ff ff       	call   804686 <free>
+		return NULL;
+  80487e:	83 c4 10             	add    $0x10,%esp
+  804881:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804886:	eb e3                	jmp    80486b <heap_alloc_pages+0x61>
+
+00804888 <malloc>:
+{
+  804888:	55                   	push   %ebp
+  804889:	89 e5                	mov    %esp,%ebp
+  80488b:	57                   	push   %edi
+  80488c:	56                   	push   %esi
+  80488d:	53                   	push   %ebx
+  80488e:	83 ec 1c             	sub    $0x1c,%esp
+  804891:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804894:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804897:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  80489d:	0f 87 21 01 00 00    	ja     8049c4 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8048a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8048a8:	ba 10 00 00 00       	mov    $0x10,%edx
+  8048ad:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  8048af:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8048b4:	76 15                	jbe    8048cb <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  8048b6:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8048bb:	c1 e8 0c             	shr    $0xc,%eax
+  8048be:	e8 47 ff ff ff       	call   80480a <heap_alloc_pages>
+  8048c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8048c6:	eb 37                	jmp    8048ff <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8048c8:	83 c1 01             	add    $0x1,%ecx
+  8048cb:	89 d6                	mov    %edx,%esi
+  8048cd:	d3 e6                	shl    %cl,%esi
+  8048cf:	39 c6                	cmp    %eax,%esi
+  8048d1:	72 f5                	jb     8048c8 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  8048d3:	89 cb                	mov    %ecx,%ebx
+  8048d5:	8b 3c 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%edi
+  8048dc:	85 ff                	test   %edi,%edi
+  8048de:	74 2a                	je     80490a <malloc+0x82>
+	v = s->free;
+  8048e0:	8b 47 08             	mov    0x8(%edi),%eax
+  8048e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  8048e6:	8b 00                	mov    (%eax),%eax
+  8048e8:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  8048eb:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  8048ef:	83 e8 01             	sub    $0x1,%eax
+  8048f2:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  8048f6:	66 85 c0             	test   %ax,%ax
+  8048f9:	0f 84 9a 00 00 00    	je     804999 <malloc+0x111>
+}
+  8048ff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804902:	83 c4 1c             	add    $0x1c,%esp
+  804905:	5b                   	pop    %ebx
+  804906:	5e                   	pop    %esi
+  804907:	5f                   	pop    %edi
+  804908:	5d                   	pop    %ebp
+  804909:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  80490a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80490f:	e8 f6 fe ff ff       	call   80480a <heap_alloc_pages>
+  804914:	89 c1                	mov    %eax,%ecx
+  804916:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804919:	85 c0                	test   %eax,%eax
+  80491b:	74 e2                	je     8048ff <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  80491d:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  804923:	89 c8                	mov    %ecx,%eax
+  804925:	c1 e8 11             	shr    $0x11,%eax
+  804928:	c1 e9 0c             	shr    $0xc,%ecx
+  80492b:	ba 01 00 00 00       	mov    $0x1,%edx
+  804930:	d3 e2                	shl    %cl,%edx
+  804932:	09 14 85 80 c0 80 00 	or     %edx,0x80c080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804939:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80493c:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  804940:	0f b7 f6             	movzwl %si,%esi
+  804943:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804948:	ba 00 00 00 00       	mov    $0x0,%edx
+  80494d:	f7 fe                	idiv   %esi
+  80494f:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804953:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  804956:	85 c0                	test   %eax,%eax
+  804958:	74 14                	je     80496e <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  80495a:	83 e8 01             	sub    $0x1,%eax
+  80495d:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804961:	0f af d0             	imul   %eax,%edx
+  804964:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804968:	89 3a                	mov    %edi,(%edx)
+  80496a:	89 d7                	mov    %edx,%edi
+  80496c:	eb e5                	jmp    804953 <malloc+0xcb>
+	s->prev = NULL;
+  80496e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804971:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804978:	8b 04 9d 60 c0 80 00 	mov    0x80c060(,%ebx,4),%eax
+  80497f:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804981:	85 c0                	test   %eax,%eax
+  804983:	74 03                	je     804988 <malloc+0x100>
+		slabs[c]->prev = s;
+  804985:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804988:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80498b:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+	return s;
+  804992:	89 c7                	mov    %eax,%edi
+  804994:	e9 47 ff ff ff       	jmp    8048e0 <malloc+0x58>
+	if (s->prev)
+  804999:	8b 47 04             	mov    0x4(%edi),%eax
+  80499c:	85 c0                	test   %eax,%eax
+  80499e:	74 19                	je     8049b9 <malloc+0x131>
+		s->prev->next = s->next;
+  8049a0:	8b 17                	mov    (%edi),%edx
+  8049a2:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8049a4:	8b 07                	mov    (%edi),%eax
+  8049a6:	85 c0                	test   %eax,%eax
+  8049a8:	0f 84 51 ff ff ff    	je     8048ff <malloc+0x77>
+		s->next->prev = s->prev;
+  8049ae:	8b 57 04             	mov    0x4(%edi),%edx
+  8049b1:	89 50 04             	mov    %edx,0x4(%eax)
+  8049b4:	e9 46 ff ff ff       	jmp    8048ff <malloc+0x77>
+		slabs[c] = s->next;
+  8049b9:	8b 07                	mov    (%edi),%eax
+  8049bb:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+  8049c2:	eb e0                	jmp    8049a4 <malloc+0x11c>
+		return NULL;
+  8049c4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8049cb:	e9 2f ff ff ff       	jmp    8048ff <malloc+0x77>
+
+008049d0 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  8049d0:	55                   	push   %ebp
+  8049d1:	89 e5                	mov    %esp,%ebp
+  8049d3:	57                   	push   %edi
+  8049d4:	56                   	push   %esi
+  8049d5:	53                   	push   %ebx
+  8049d6:	83 ec 0c             	sub    $0xc,%esp
+  8049d9:	89 c6                	mov    %eax,%esi
+  8049db:	89 d7                	mov    %edx,%edi
+  8049dd:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8049e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8049e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049ea:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  8049ef:	83 ef 01             	sub    $0x1,%edi
+  8049f2:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8049f5:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8049f8:	eb 34                	jmp    804a2e <va_chunk_scan+0x5e>
+			i += 31;
+  8049fa:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  8049fd:	89 ca                	mov    %ecx,%edx
+			continue;
+  8049ff:	eb 23                	jmp    804a24 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804a01:	89 c7                	mov    %eax,%edi
+  804a03:	c1 ef 05             	shr    $0x5,%edi
+  804a06:	be 01 00 00 00       	mov    $0x1,%esi
+  804a0b:	d3 e6                	shl    %cl,%esi
+  804a0d:	89 f1                	mov    %esi,%ecx
+  804a0f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804a12:	23 0c be             	and    (%esi,%edi,4),%ecx
+  804a15:	75 41                	jne    804a58 <va_chunk_scan+0x88>
+			len++;
+  804a17:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804a1a:	39 d3                	cmp    %edx,%ebx
+  804a1c:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  804a1f:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  804a22:	72 2d                	jb     804a51 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804a24:	83 c0 01             	add    $0x1,%eax
+  804a27:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804a2c:	77 31                	ja     804a5f <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  804a2e:	89 c1                	mov    %eax,%ecx
+  804a30:	83 e1 1f             	and    $0x1f,%ecx
+  804a33:	75 cc                	jne    804a01 <va_chunk_scan+0x31>
+  804a35:	89 c7                	mov    %eax,%edi
+  804a37:	c1 ef 05             	shr    $0x5,%edi
+  804a3a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804a3d:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804a40:	83 ff ff             	cmp    $0xffffffff,%edi
+  804a43:	74 b5                	je     8049fa <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  804a45:	85 ff                	test   %edi,%edi
+  804a47:	75 b8                	jne    804a01 <va_chunk_scan+0x31>
+			i += 31;
+  804a49:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804a4c:	83 c2 20             	add    $0x20,%edx
+  804a4f:	eb c9                	jmp    804a1a <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804a51:	83 c0 01             	add    $0x1,%eax
+  804a54:	29 d0                	sub    %edx,%eax
+  804a56:	eb 15                	jmp    804a6d <va_chunk_scan+0x9d>
+			len = 0;
+  804a58:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a5d:	eb c5                	jmp    804a24 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804a5f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804a64:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804a67:	85 d2                	test   %edx,%edx
+  804a69:	74 02                	je     804a6d <va_chunk_scan+0x9d>
+		*run_store = best;
+  804a6b:	89 1a                	mov    %ebx,(%edx)
+}
+  804a6d:	83 c4 0c             	add    $0xc,%esp
+  804a70:	5b                   	pop    %ebx
+  804a71:	5e                   	pop    %esi
+  804a72:	5f                   	pop    %edi
+  804a73:	5d                   	pop    %ebp
+  804a74:	c3                   	ret
+
+00804a75 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804a75:	55                   	push   %ebp
+  804a76:	89 e5                	mov    %esp,%ebp
+  804a78:	57                   	push   %edi
+  804a79:	56                   	push   %esi
+  804a7a:	53                   	push   %ebx
+  804a7b:	83 ec 14             	sub    $0x14,%esp
+  804a7e:	89 c3                	mov    %eax,%ebx
+  804a80:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804a82:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804a88:	8d ba a0 ea 80 00    	lea    0x80eaa0(%edx),%edi
+  804a8e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804a91:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804a94:	89 d6                	mov    %edx,%esi
+  804a96:	81 c6 a0 ea 80 00    	add    $0x80eaa0,%esi
+  804a9c:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804a9e:	eb 34                	jmp    804ad4 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804aa0:	89 c8                	mov    %ecx,%eax
+  804aa2:	c1 e8 05             	shr    $0x5,%eax
+  804aa5:	89 da                	mov    %ebx,%edx
+  804aa7:	c1 e2 05             	shl    $0x5,%edx
+  804aaa:	01 da                	add    %ebx,%edx
+  804aac:	01 c2                	add    %eax,%edx
+  804aae:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804ab3:	d3 c0                	rol    %cl,%eax
+  804ab5:	21 04 95 a0 ea 80 00 	and    %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804abc:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804ac3:	b8 01 00 00 00       	mov    $0x1,%eax
+  804ac8:	01 d0                	add    %edx,%eax
+  804aca:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804ad1:	83 c1 01             	add    $0x1,%ecx
+  804ad4:	39 f9                	cmp    %edi,%ecx
+  804ad6:	74 30                	je     804b08 <va_chunk_mark+0x93>
+		if (alloc)
+  804ad8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804adc:	74 c2                	je     804aa0 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804ade:	89 c8                	mov    %ecx,%eax
+  804ae0:	c1 e8 05             	shr    $0x5,%eax
+  804ae3:	89 da                	mov    %ebx,%edx
+  804ae5:	c1 e2 05             	shl    $0x5,%edx
+  804ae8:	01 da                	add    %ebx,%edx
+  804aea:	01 c2                	add    %eax,%edx
+  804aec:	b8 01 00 00 00       	mov    $0x1,%eax
+  804af1:	d3 e0                	shl    %cl,%eax
+  804af3:	09 04 95 a0 ea 80 00 	or     %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804afa:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804b01:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804b06:	eb c0                	jmp    804ac8 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804b08:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804b0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b10:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804b13:	e8 b8 fe ff ff       	call   8049d0 <va_chunk_scan>
+	ch->run = run;
+  804b18:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804b1e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804b21:	66 89 83 22 eb 80 00 	mov    %ax,0x80eb22(%ebx)
+}
+  804b28:	83 c4 14             	add    $0x14,%esp
+  804b2b:	5b                   	pop    %ebx
+  804b2c:	5e                   	pop    %esi
+  804b2d:	5f                   	pop    %edi
+  804b2e:	5d                   	pop    %ebp
+  804b2f:	c3                   	ret
+
+00804b30 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804b30:	55                   	push   %ebp
+  804b31:	89 e5                	mov    %esp,%ebp
+  804b33:	57                   	push   %edi
+  804b34:	56                   	push   %esi
+  804b35:	53                   	push   %ebx
+  804b36:	83 ec 04             	sub    $0x4,%esp
+  804b39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804b3c:	b8 20 eb 80 00       	mov    $0x80eb20,%eax
+  804b41:	ba 90 f9 80 00       	mov    $0x80f990,%edx
+  804b46:	80 3d 80 ea 80 00 00 	cmpb   $0x0,0x80ea80
+  804b4d:	74 4f                	je     804b9e <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804b4f:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804b52:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804b57:	0f 87 01 01 00 00    	ja     804c5e <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804b5d:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804b63:	0f 87 80 00 00 00    	ja     804be9 <va_alloc+0xb9>
+  804b69:	b8 22 eb 80 00       	mov    $0x80eb22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804b6e:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804b73:	0f b7 10             	movzwl (%eax),%edx
+  804b76:	05 84 00 00 00       	add    $0x84,%eax
+  804b7b:	39 da                	cmp    %ebx,%edx
+  804b7d:	73 2c                	jae    804bab <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804b7f:	83 c6 01             	add    $0x1,%esi
+  804b82:	83 fe 1c             	cmp    $0x1c,%esi
+  804b85:	75 ec                	jne    804b73 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804b87:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b8c:	eb 53                	jmp    804be1 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804b8e:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804b94:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804b99:	05 84 00 00 00       	add    $0x84,%eax
+  804b9e:	39 d0                	cmp    %edx,%eax
+  804ba0:	75 ec                	jne    804b8e <va_alloc+0x5e>
+	va_inited = 1;
+  804ba2:	c6 05 80 ea 80 00 01 	movb   $0x1,0x80ea80
+}
+  804ba9:	eb a4                	jmp    804b4f <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804bab:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804bb1:	05 a0 ea 80 00       	add    $0x80eaa0,%eax
+  804bb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804bbb:	89 da                	mov    %ebx,%edx
+  804bbd:	e8 0e fe ff ff       	call   8049d0 <va_chunk_scan>
+  804bc2:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804bc4:	6a 01                	push   $0x1
+  804bc6:	89 d9                	mov    %ebx,%ecx
+  804bc8:	89 c2                	mov    %eax,%edx
+  804bca:	89 f0                	mov    %esi,%eax
+  804bcc:	e8 a4 fe ff ff       	call   804a75 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804bd1:	c1 e6 16             	shl    $0x16,%esi
+  804bd4:	c1 e7 0c             	shl    $0xc,%edi
+  804bd7:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804bde:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804be1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804be4:	5b                   	pop    %ebx
+  804be5:	5e                   	pop    %esi
+  804be6:	5f                   	pop    %edi
+  804be7:	5d                   	pop    %ebp
+  804be8:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804be9:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804bef:	c1 ee 0a             	shr    $0xa,%esi
+  804bf2:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804bf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bfc:	eb 0a                	jmp    804c08 <va_alloc+0xd8>
+			first = c + 1;
+  804bfe:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804c00:	83 c2 01             	add    $0x1,%edx
+  804c03:	83 fa 1d             	cmp    $0x1d,%edx
+  804c06:	74 4f                	je     804c57 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804c08:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804c0e:	66 81 b9 9c ea 80 00 	cmpw   $0x400,0x80ea9c(%ecx)
+  804c15:	00 04 
+  804c17:	75 e5                	jne    804bfe <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804c19:	89 d1                	mov    %edx,%ecx
+  804c1b:	29 c1                	sub    %eax,%ecx
+  804c1d:	39 f1                	cmp    %esi,%ecx
+  804c1f:	75 df                	jne    804c00 <va_alloc+0xd0>
+  804c21:	89 c7                	mov    %eax,%edi
+  804c23:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804c26:	be 00 04 00 00       	mov    $0x400,%esi
+  804c2b:	39 f3                	cmp    %esi,%ebx
+  804c2d:	0f 46 f3             	cmovbe %ebx,%esi
+  804c30:	6a 01                	push   $0x1
+  804c32:	89 f1                	mov    %esi,%ecx
+  804c34:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c39:	89 f8                	mov    %edi,%eax
+  804c3b:	e8 35 fe ff ff       	call   804a75 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804c40:	83 c7 01             	add    $0x1,%edi
+  804c43:	83 c4 04             	add    $0x4,%esp
+  804c46:	29 f3                	sub    %esi,%ebx
+  804c48:	75 dc                	jne    804c26 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804c4a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804c4d:	c1 e0 16             	shl    $0x16,%eax
+  804c50:	05 00 00 00 08       	add    $0x8000000,%eax
+  804c55:	eb 8a                	jmp    804be1 <va_alloc+0xb1>
+	return NULL;
+  804c57:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c5c:	eb 83                	jmp    804be1 <va_alloc+0xb1>
+		return NULL;
+  804c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c63:	e9 79 ff ff ff       	jmp    804be1 <va_alloc+0xb1>
+
+00804c68 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804c68:	55                   	push   %ebp
+  804c69:	89 e5                	mov    %esp,%ebp
+  804c6b:	57                   	push   %edi
+  804c6c:	56                   	push   %esi
+  804c6d:	53                   	push   %ebx
+  804c6e:	83 ec 0c             	sub    $0xc,%esp
+  804c71:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804c74:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804c77:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804c7d:	76 21                	jbe    804ca0 <va_free+0x38>
+  804c7f:	89 f0                	mov    %esi,%eax
+  804c81:	c1 e0 0c             	shl    $0xc,%eax
+  804c84:	01 f8                	add    %edi,%eax
+  804c86:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804c8b:	77 13                	ja     804ca0 <va_free+0x38>
+	    || PGOFF(va))
+  804c8d:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804c93:	75 0b                	jne    804ca0 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804c95:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804c9b:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804c9e:	eb 45                	jmp    804ce5 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804ca0:	83 ec 0c             	sub    $0xc,%esp
+  804ca3:	56                   	push   %esi
+  804ca4:	57                   	push   %edi
+  804ca5:	68 ac 60 80 00       	push   $0x8060ac
+  804caa:	68 8e 00 00 00       	push   $0x8e
+  804caf:	68 cc 60 80 00       	push   $0x8060cc
+  804cb4:	e8 a5 b5 ff ff       	call   80025e <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804cb9:	89 fa                	mov    %edi,%edx
+  804cbb:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804cc1:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804cc6:	29 d3                	sub    %edx,%ebx
+  804cc8:	39 f3                	cmp    %esi,%ebx
+  804cca:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804ccd:	89 f8                	mov    %edi,%eax
+  804ccf:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804cd2:	83 ec 0c             	sub    $0xc,%esp
+  804cd5:	6a 00                	push   $0x0
+  804cd7:	89 d9                	mov    %ebx,%ecx
+  804cd9:	e8 97 fd ff ff       	call   804a75 <va_chunk_mark>
+		i += n;
+  804cde:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804ce0:	29 de                	sub    %ebx,%esi
+  804ce2:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804ce5:	85 f6                	test   %esi,%esi
+  804ce7:	75 d0                	jne    804cb9 <va_free+0x51>
+	}
+}
+  804ce9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804cec:	5b                   	pop    %ebx
+  804ced:	5e                   	pop    %esi
+  804cee:	5f                   	pop    %edi
+  804cef:	5d                   	pop    %ebp
+  804cf0:	c3                   	ret
+
+00804cf1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cf6:	c3                   	ret
+
+00804cf7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804cf7:	55                   	push   %ebp
+  804cf8:	89 e5                	mov    %esp,%ebp
+  804cfa:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804cfd:	68 d9 60 80 00       	push   $0x8060d9
+  804d02:	ff 75 0c             	push   0xc(%ebp)
+  804d05:	e8 16 bc ff ff       	call   800920 <strcpy>
+	return 0;
+}
+  804d0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d0f:	c9                   	leave
+  804d10:	c3                   	ret
+
+00804d11 <devcons_write>:
+{
+  804d11:	55                   	push   %ebp
+  804d12:	89 e5                	mov    %esp,%ebp
+  804d14:	57                   	push   %edi
+  804d15:	56                   	push   %esi
+  804d16:	53                   	push   %ebx
+  804d17:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804d1d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804d22:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804d28:	eb 2e                	jmp    804d58 <devcons_write+0x47>
+		m = n - tot;
+  804d2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804d2d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804d2f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804d34:	39 c3                	cmp    %eax,%ebx
+  804d36:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804d39:	83 ec 04             	sub    $0x4,%esp
+  804d3c:	53                   	push   %ebx
+  804d3d:	89 f0                	mov    %esi,%eax
+  804d3f:	03 45 0c             	add    0xc(%ebp),%eax
+  804d42:	50                   	push   %eax
+  804d43:	57                   	push   %edi
+  804d44:	e8 5d bd ff ff       	call   800aa6 <memmove>
+		sys_cputs(buf, m);
+  804d49:	83 c4 08             	add    $0x8,%esp
+  804d4c:	53                   	push   %ebx
+  804d4d:	57                   	push   %edi
+  804d4e:	e8 f3 bf ff ff       	call   800d46 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804d53:	01 de                	add    %ebx,%esi
+  804d55:	83 c4 10             	add    $0x10,%esp
+  804d58:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804d5b:	72 cd                	jb     804d2a <devcons_write+0x19>
+}
+  804d5d:	89 f0                	mov    %esi,%eax
+  804d5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804d62:	5b                   	pop    %ebx
+  804d63:	5e                   	pop    %esi
+  804d64:	5f                   	pop    %edi
+  804d65:	5d                   	pop    %ebp
+  804d66:	c3                   	ret
+
+00804d67 <devcons_read>:
+{
+  804d67:	55                   	push   %ebp
+  804d68:	89 e5                	mov    %esp,%ebp
+  804d6a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804d6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d72:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804d76:	75 07                	jne    804d7f <devcons_read+0x18>
+  804d78:	eb 1f                	jmp    804d99 <devcons_read+0x32>
+		sys_yield();
+  804d7a:	e8 75 c0 ff ff       	call   800df4 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804d7f:	e8 f1 bf ff ff       	call   800d75 <sys_cgetc>
+  804d84:	85 c0                	test   %eax,%eax
+  804d86:	74 f2                	je     804d7a <devcons_read+0x13>
+	if (c < 0)
+  804d88:	78 0f                	js     804d99 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804d8a:	83 f8 04             	cmp    $0x4,%eax
+  804d8d:	74 0c                	je     804d9b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804d8f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804d92:	88 02                	mov    %al,(%edx)
+	return 1;
+  804d94:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804d99:	c9                   	leave
+  804d9a:	c3                   	ret
+		return 0;
+  804d9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804da0:	eb f7                	jmp    804d99 <devcons_read+0x32>
+
+00804da2 <cputchar>:
+{
+  804da2:	55                   	push   %ebp
+  804da3:	89 e5                	mov    %esp,%ebp
+  804da5:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804da8:	8b 45 08             	mov    0x8(%ebp),%eax
+  804dab:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804dae:	6a 01                	push   $0x1
+  804db0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804db3:	50                   	push   %eax
+  804db4:	e8 8d bf ff ff       	call   800d46 <sys_cputs>
+}
+  804db9:	83 c4 10             	add    $0x10,%esp
+  804dbc:	c9                   	leave
+  804dbd:	c3                   	ret
+
+00804dbe <getchar>:
+{
+  804dbe:	55                   	push   %ebp
+  804dbf:	89 e5                	mov    %esp,%ebp
+  804dc1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804dc4:	6a 01                	push   $0x1
+  804dc6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804dc9:	50                   	push   %eax
+  804dca:	6a 00                	push   $0x0
+  804dcc:	e8 6b ce ff ff       	call   801c3c <read>
+	if (r < 0)
+  804dd1:	83 c4 10             	add    $0x10,%esp
+  804dd4:	85 c0                	test   %eax,%eax
+  804dd6:	78 06                	js     804dde <getchar+0x20>
+	if (r < 1)
+  804dd8:	74 06                	je     804de0 <getchar+0x22>
+	return c;
+  804dda:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804dde:	c9                   	leave
+  804ddf:	c3                   	ret
+		return -E_EOF;
+  804de0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804de5:	eb f7                	jmp    804dde <getchar+0x20>
+
+00804de7 <iscons>:
+{
+  804de7:	55                   	push   %ebp
+  804de8:	89 e5                	mov    %esp,%ebp
+  804dea:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804ded:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804df0:	50                   	push   %eax
+  804df1:	ff 75 08             	push   0x8(%ebp)
+  804df4:	e8 e4 cb ff ff       	call   8019dd <fd_lookup>
+  804df9:	83 c4 10             	add    $0x10,%esp
+  804dfc:	85 c0                	test   %eax,%eax
+  804dfe:	78 11                	js     804e11 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804e00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804e03:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  804e09:	39 10                	cmp    %edx,(%eax)
+  804e0b:	0f 94 c0             	sete   %al
+  804e0e:	0f b6 c0             	movzbl %al,%eax
+}
+  804e11:	c9                   	leave
+  804e12:	c3                   	ret
+
+00804e13 <opencons>:
+{
+  804e13:	55                   	push   %ebp
+  804e14:	89 e5                	mov    %esp,%ebp
+  804e16:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804e19:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804e1c:	50                   	push   %eax
+  804e1d:	e8 67 cb ff ff       	call   801989 <fd_alloc>
+  804e22:	83 c4 10             	add    $0x10,%esp
+  804e25:	85 c0                	test   %eax,%eax
+  804e27:	78 3a                	js     804e63 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804e29:	83 ec 04             	sub    $0x4,%esp
+  804e2c:	68 07 04 00 00       	push   $0x407
+  804e31:	ff 75 f4             	push   -0xc(%ebp)
+  804e34:	6a 00                	push   $0x0
+  804e36:	e8 d8 bf ff ff       	call   800e13 <sys_page_alloc>
+  804e3b:	83 c4 10             	add    $0x10,%esp
+  804e3e:	85 c0                	test   %eax,%eax
+  804e40:	78 21                	js     804e63 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804e42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804e45:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  804e4b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804e4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804e50:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804e57:	83 ec 0c             	sub    $0xc,%esp
+  804e5a:	50                   	push   %eax
+  804e5b:	e8 02 cb ff ff       	call   801962 <fd2num>
+  804e60:	83 c4 10             	add    $0x10,%esp
+}
+  804e63:	c9                   	leave
+  804e64:	c3                   	ret
+
+00804e65 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804e65:	55                   	push   %ebp
+  804e66:	89 e5                	mov    %esp,%ebp
+  804e68:	56                   	push   %esi
+  804e69:	53                   	push   %ebx
+  804e6a:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804e6d:	a1 10 f9 80 00       	mov    0x80f910,%eax
+  804e72:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804e75:	85 db                	test   %ebx,%ebx
+  804e77:	78 17                	js     804e90 <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804e79:	83 ec 0c             	sub    $0xc,%esp
+  804e7c:	56                   	push   %esi
+  804e7d:	ff 14 9d 00 10 81 00 	call   *0x811000(,%ebx,4)
+  804e84:	83 c4 10             	add    $0x10,%esp
+  804e87:	85 c0                	test   %eax,%eax
+  804e89:	75 27                	jne    804eb2 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804e8b:	83 eb 01             	sub    $0x1,%ebx
+  804e8e:	eb e5                	jmp    804e75 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804e90:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804e95:	8b 40 48             	mov    0x48(%eax),%eax
+  804e98:	83 ec 08             	sub    $0x8,%esp
+  804e9b:	ff 76 28             	push   0x28(%esi)
+  804e9e:	ff 36                	push   (%esi)
+  804ea0:	50                   	push   %eax
+  804ea1:	68 e8 60 80 00       	push   $0x8060e8
+  804ea6:	6a 1d                	push   $0x1d
+  804ea8:	68 0b 61 80 00       	push   $0x80610b
+  804ead:	e8 ac b3 ff ff       	call   80025e <_panic>
+}
+  804eb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804eb5:	5b                   	pop    %ebx
+  804eb6:	5e                   	pop    %esi
+  804eb7:	5d                   	pop    %ebp
+  804eb8:	c3                   	ret
+
+00804eb9 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804eb9:	55                   	push   %ebp
+  804eba:	89 e5                	mov    %esp,%ebp
+  804ebc:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804ebf:	83 3d 28 10 81 00 00 	cmpl   $0x0,0x811028
+  804ec6:	74 0a                	je     804ed2 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804ec8:	8b 45 08             	mov    0x8(%ebp),%eax
+  804ecb:	a3 28 10 81 00       	mov    %eax,0x811028
+}
+  804ed0:	c9                   	leave
+  804ed1:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804ed2:	83 ec 04             	sub    $0x4,%esp
+  804ed5:	6a 07                	push   $0x7
+  804ed7:	68 00 f0 bf ee       	push   $0xeebff000
+  804edc:	6a 00                	push   $0x0
+  804ede:	e8 30 bf ff ff       	call   800e13 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804ee3:	83 c4 08             	add    $0x8,%esp
+  804ee6:	68 59 4f 80 00       	push   $0x804f59
+  804eeb:	6a 00                	push   $0x0
+  804eed:	e8 87 c2 ff ff       	call   801179 <sys_env_set_pgfault_upcall>
+  804ef2:	83 c4 10             	add    $0x10,%esp
+  804ef5:	eb d1                	jmp    804ec8 <set_pgfault_handler+0xf>
+
+00804ef7 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804ef7:	55                   	push   %ebp
+  804ef8:	89 e5                	mov    %esp,%ebp
+  804efa:	83 ec 08             	sub    $0x8,%esp
+  804efd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  804f00:	8b 15 10 f9 80 00    	mov    0x80f910,%edx
+  804f06:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f0b:	eb 03                	jmp    804f10 <add_pgfault_handler+0x19>
+  804f0d:	83 c0 01             	add    $0x1,%eax
+  804f10:	39 d0                	cmp    %edx,%eax
+  804f12:	74 0b                	je     804f1f <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804f14:	39 0c 85 00 10 81 00 	cmp    %ecx,0x811000(,%eax,4)
+  804f1b:	75 f0                	jne    804f0d <add_pgfault_handler+0x16>
+  804f1d:	eb 24                	jmp    804f43 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  804f1f:	83 fa 0a             	cmp    $0xa,%edx
+  804f22:	74 21                	je     804f45 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  804f24:	8d 42 01             	lea    0x1(%edx),%eax
+  804f27:	a3 10 f9 80 00       	mov    %eax,0x80f910
+  804f2c:	89 0c 95 00 10 81 00 	mov    %ecx,0x811000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  804f33:	83 ec 0c             	sub    $0xc,%esp
+  804f36:	68 65 4e 80 00       	push   $0x804e65
+  804f3b:	e8 79 ff ff ff       	call   804eb9 <set_pgfault_handler>
+  804f40:	83 c4 10             	add    $0x10,%esp
+}
+  804f43:	c9                   	leave
+  804f44:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  804f45:	83 ec 04             	sub    $0x4,%esp
+  804f48:	68 19 61 80 00       	push   $0x806119
+  804f4d:	6a 44                	push   $0x44
+  804f4f:	68 0b 61 80 00       	push   $0x80610b
+  804f54:	e8 05 b3 ff ff       	call   80025e <_panic>
+
+00804f59 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804f59:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804f5a:	a1 28 10 81 00       	mov    0x811028,%eax
+	call *%eax
+  804f5f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804f61:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  804f64:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  804f68:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  804f6c:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  804f6f:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  804f71:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  804f75:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  804f78:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  804f79:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  804f7c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  804f7d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  804f7e:	c3                   	ret
+
+00804f7f <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  804f7f:	55                   	push   %ebp
+  804f80:	89 e5                	mov    %esp,%ebp
+  804f82:	57                   	push   %edi
+  804f83:	56                   	push   %esi
+  804f84:	53                   	push   %ebx
+  804f85:	83 ec 14             	sub    $0x14,%esp
+  804f88:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804f8b:	8b 75 14             	mov    0x14(%ebp),%esi
+  804f8e:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804f91:	ff 75 10             	push   0x10(%ebp)
+  804f94:	ff 75 0c             	push   0xc(%ebp)
+  804f97:	e8 9a c2 ff ff       	call   801236 <sys_ipc_recv_pages>
+  804f9c:	83 c4 10             	add    $0x10,%esp
+  804f9f:	85 c0                	test   %eax,%eax
+  804fa1:	78 46                	js     804fe9 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804fa3:	85 ff                	test   %edi,%edi
+  804fa5:	74 0d                	je     804fb4 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804fa7:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804fac:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804fb2:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804fb4:	85 f6                	test   %esi,%esi
+  804fb6:	74 0d                	je     804fc5 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804fb8:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804fbd:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804fc3:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804fc5:	85 db                	test   %ebx,%ebx
+  804fc7:	74 0d                	je     804fd6 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804fc9:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804fce:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804fd4:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804fd6:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804fdb:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804fe1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804fe4:	5b                   	pop    %ebx
+  804fe5:	5e                   	pop    %esi
+  804fe6:	5f                   	pop    %edi
+  804fe7:	5d                   	pop    %ebp
+  804fe8:	c3                   	ret
+		if (from_env_store) {
+  804fe9:	85 ff                	test   %edi,%edi
+  804feb:	74 06                	je     804ff3 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  804fed:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804ff3:	85 f6                	test   %esi,%esi
+  804ff5:	74 06                	je     804ffd <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804ff7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804ffd:	85 db                	test   %ebx,%ebx
+  804fff:	74 e0                	je     804fe1 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  805001:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  805007:	eb d8                	jmp    804fe1 <ipc_recv_pages+0x62>
+
+00805009 <ipc_recv>:
+{
+  805009:	55                   	push   %ebp
+  80500a:	89 e5                	mov    %esp,%ebp
+  80500c:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  80500f:	6a 00                	push   $0x0
+  805011:	ff 75 10             	push   0x10(%ebp)
+  805014:	6a 01                	push   $0x1
+  805016:	ff 75 0c             	push   0xc(%ebp)
+  805019:	ff 75 08             	push   0x8(%ebp)
+  80501c:	e8 5e ff ff ff       	call   804f7f <ipc_recv_pages>
+}
+  805021:	c9                   	leave
+  805022:	c3                   	ret
+
+00805023 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805023:	55                   	push   %ebp
+  805024:	89 e5                	mov    %esp,%ebp
+  805026:	56                   	push   %esi
+  805027:	53                   	push   %ebx
+  805028:	8b 75 08             	mov    0x8(%ebp),%esi
+  80502b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  80502e:	83 ec 0c             	sub    $0xc,%esp
+  805031:	ff 75 0c             	push   0xc(%ebp)
+  805034:	e8 31 c3 ff ff       	call   80136a <sys_ipc_try_recv>
+  805039:	83 c4 10             	add    $0x10,%esp
+  80503c:	85 c0                	test   %eax,%eax
+  80503e:	78 34                	js     805074 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  805040:	85 f6                	test   %esi,%esi
+  805042:	74 0d                	je     805051 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  805044:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805049:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80504f:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  805051:	85 db                	test   %ebx,%ebx
+  805053:	74 0d                	je     805062 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  805055:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80505a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  805060:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  805062:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805067:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80506d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805070:	5b                   	pop    %ebx
+  805071:	5e                   	pop    %esi
+  805072:	5d                   	pop    %ebp
+  805073:	c3                   	ret
+		if (from_env_store) {
+  805074:	85 f6                	test   %esi,%esi
+  805076:	74 06                	je     80507e <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  805078:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  80507e:	85 db                	test   %ebx,%ebx
+  805080:	74 eb                	je     80506d <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  805082:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  805088:	eb e3                	jmp    80506d <ipc_try_recv+0x4a>
+
+0080508a <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80508a:	55                   	push   %ebp
+  80508b:	89 e5                	mov    %esp,%ebp
+  80508d:	83 ec 14             	sub    $0x14,%esp
+  805090:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805093:	85 c0                	test   %eax,%eax
+  805095:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80509a:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80509d:	ff 75 18             	push   0x18(%ebp)
+  8050a0:	ff 75 14             	push   0x14(%ebp)
+  8050a3:	50                   	push   %eax
+  8050a4:	ff 75 0c             	push   0xc(%ebp)
+  8050a7:	ff 75 08             	push   0x8(%ebp)
+  8050aa:	e8 4a c1 ff ff       	call   8011f9 <sys_ipc_send_pages>
+  8050af:	83 c4 20             	add    $0x20,%esp
+  8050b2:	85 c0                	test   %eax,%eax
+  8050b4:	78 02                	js     8050b8 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  8050b6:	c9                   	leave
+  8050b7:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  8050b8:	50                   	push   %eax
+  8050b9:	68 34 61 80 00       	push   $0x806134
+  8050be:	68 80 00 00 00       	push   $0x80
+  8050c3:	68 60 61 80 00       	push   $0x806160
+  8050c8:	e8 91 b1 ff ff       	call   80025e <_panic>
+
+008050cd <ipc_send>:
+{
+  8050cd:	55                   	push   %ebp
+  8050ce:	89 e5                	mov    %esp,%ebp
+  8050d0:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  8050d3:	ff 75 14             	push   0x14(%ebp)
+  8050d6:	6a 01                	push   $0x1
+  8050d8:	ff 75 10             	push   0x10(%ebp)
+  8050db:	ff 75 0c             	push   0xc(%ebp)
+  8050de:	ff 75 08             	push   0x8(%ebp)
+  8050e1:	e8 a4 ff ff ff       	call   80508a <ipc_send_pages>
+}
+  8050e6:	83 c4 20             	add    $0x20,%esp
+  8050e9:	c9                   	leave
+  8050ea:	c3                   	ret
+
+008050eb <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8050eb:	55                   	push   %ebp
+  8050ec:	89 e5                	mov    %esp,%ebp
+  8050ee:	83 ec 14             	sub    $0x14,%esp
+  8050f1:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8050f4:	85 c0                	test   %eax,%eax
+  8050f6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8050fb:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8050fe:	ff 75 18             	push   0x18(%ebp)
+  805101:	ff 75 14             	push   0x14(%ebp)
+  805104:	50                   	push   %eax
+  805105:	ff 75 0c             	push   0xc(%ebp)
+  805108:	ff 75 08             	push   0x8(%ebp)
+  80510b:	e8 7a c1 ff ff       	call   80128a <sys_ipc_call>
+  805110:	83 c4 20             	add    $0x20,%esp
+  805113:	85 c0                	test   %eax,%eax
+  805115:	78 0b                	js     805122 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  805117:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80511c:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  805122:	c9                   	leave
+  805123:	c3                   	ret
+
+00805124 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  805124:	55                   	push   %ebp
+  805125:	89 e5                	mov    %esp,%ebp
+  805127:	57                   	push   %edi
+  805128:	56                   	push   %esi
+  805129:	53                   	push   %ebx
+  80512a:	83 ec 18             	sub    $0x18,%esp
+  80512d:	8b 45 10             	mov    0x10(%ebp),%eax
+  805130:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  805133:	8b 75 20             	mov    0x20(%ebp),%esi
+  805136:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805139:	85 c0                	test   %eax,%eax
+  80513b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805140:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  805143:	ff 75 18             	push   0x18(%ebp)
+  805146:	ff 75 14             	push   0x14(%ebp)
+  805149:	50                   	push   %eax
+  80514a:	ff 75 0c             	push   0xc(%ebp)
+  80514d:	ff 75 08             	push   0x8(%ebp)
+  805150:	e8 76 c1 ff ff       	call   8012cb <sys_ipc_reply_recv>
+  805155:	83 c4 20             	add    $0x20,%esp
+  805158:	85 c0                	test   %eax,%eax
+  80515a:	78 46                	js     8051a2 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80515c:	85 ff                	test   %edi,%edi
+  80515e:	74 0d                	je     80516d <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  805160:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805165:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80516b:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80516d:	85 f6                	test   %esi,%esi
+  80516f:	74 0d                	je     80517e <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  805171:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805176:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80517c:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80517e:	85 db                	test   %ebx,%ebx
+  805180:	74 0d                	je     80518f <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  805182:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805187:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80518d:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80518f:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805194:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80519a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80519d:	5b                   	pop    %ebx
+  80519e:	5e                   	pop    %esi
+  80519f:	5f                   	pop    %edi
+  8051a0:	5d                   	pop    %ebp
+  8051a1:	c3                   	ret
+		if (from_env_store) {
+  8051a2:	85 ff                	test   %edi,%edi
+  8051a4:	74 06                	je     8051ac <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  8051a6:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8051ac:	85 f6                	test   %esi,%esi
+  8051ae:	74 06                	je     8051b6 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  8051b0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8051b6:	85 db                	test   %ebx,%ebx
+  8051b8:	74 e0                	je     80519a <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  8051ba:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8051c0:	eb d8                	jmp    80519a <ipc_reply_recv+0x76>
+
+008051c2 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8051c2:	55                   	push   %ebp
+  8051c3:	89 e5                	mov    %esp,%ebp
+  8051c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8051c8:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8051cd:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8051d0:	c1 e0 06             	shl    $0x6,%eax
+  8051d3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8051d8:	8b 40 50             	mov    0x50(%eax),%eax
+  8051db:	39 c8                	cmp    %ecx,%eax
+  8051dd:	74 12                	je     8051f1 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8051df:	83 c2 01             	add    $0x1,%edx
+  8051e2:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8051e8:	75 e3                	jne    8051cd <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8051ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051ef:	eb 0e                	jmp    8051ff <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8051f1:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8051f4:	c1 e0 06             	shl    $0x6,%eax
+  8051f7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8051fc:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8051ff:	5d                   	pop    %ebp
+  805200:	c3                   	ret
+
+00805201 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  805201:	55                   	push   %ebp
+  805202:	89 e5                	mov    %esp,%ebp
+  805204:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805207:	89 c2                	mov    %eax,%edx
+  805209:	c1 ea 16             	shr    $0x16,%edx
+  80520c:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  805213:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805218:	f6 c1 01             	test   $0x1,%cl
+  80521b:	74 1e                	je     80523b <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  80521d:	c1 e8 0c             	shr    $0xc,%eax
+  805220:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  805227:	a8 01                	test   $0x1,%al
+  805229:	74 10                	je     80523b <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80522b:	c1 e8 0c             	shr    $0xc,%eax
+  80522e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  805231:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  805238:	0f b7 d2             	movzwl %dx,%edx
+}
+  80523b:	89 d0                	mov    %edx,%eax
+  80523d:	5d                   	pop    %ebp
+  80523e:	c3                   	ret
+
+0080523f <udivmod>:
+  80523f:	55                   	push   %ebp
+  805240:	57                   	push   %edi
+  805241:	56                   	push   %esi
+  805242:	53                   	push   %ebx
+  805243:	83 ec 24             	sub    $0x24,%esp
+  805246:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80524a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80524e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  805252:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  805256:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80525a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80525e:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  805262:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  805267:	b8 00 00 00 00       	mov    $0x0,%eax
+  80526c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805271:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  805278:	00 
+  805279:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  805280:	00 
+  805281:	89 fb                	mov    %edi,%ebx
+  805283:	eb 08                	jmp    80528d <udivmod+0x4e>
+  805285:	83 e9 01             	sub    $0x1,%ecx
+  805288:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80528b:	74 68                	je     8052f5 <udivmod+0xb6>
+  80528d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  805291:	01 c0                	add    %eax,%eax
+  805293:	89 c6                	mov    %eax,%esi
+  805295:	89 d7                	mov    %edx,%edi
+  805297:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80529b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80529f:	0f ad d0             	shrd   %cl,%edx,%eax
+  8052a2:	d3 ea                	shr    %cl,%edx
+  8052a4:	f6 c1 20             	test   $0x20,%cl
+  8052a7:	74 04                	je     8052ad <udivmod+0x6e>
+  8052a9:	89 d0                	mov    %edx,%eax
+  8052ab:	31 d2                	xor    %edx,%edx
+  8052ad:	83 e0 01             	and    $0x1,%eax
+  8052b0:	89 04 24             	mov    %eax,(%esp)
+  8052b3:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8052ba:	00 
+  8052bb:	8b 04 24             	mov    (%esp),%eax
+  8052be:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8052c2:	09 f0                	or     %esi,%eax
+  8052c4:	09 fa                	or     %edi,%edx
+  8052c6:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8052ca:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8052ce:	39 f0                	cmp    %esi,%eax
+  8052d0:	89 d5                	mov    %edx,%ebp
+  8052d2:	19 fd                	sbb    %edi,%ebp
+  8052d4:	72 af                	jb     805285 <udivmod+0x46>
+  8052d6:	29 f0                	sub    %esi,%eax
+  8052d8:	19 fa                	sbb    %edi,%edx
+  8052da:	89 cf                	mov    %ecx,%edi
+  8052dc:	c1 ef 05             	shr    $0x5,%edi
+  8052df:	83 e7 01             	and    $0x1,%edi
+  8052e2:	89 fe                	mov    %edi,%esi
+  8052e4:	83 f6 01             	xor    $0x1,%esi
+  8052e7:	d3 e6                	shl    %cl,%esi
+  8052e9:	d3 e7                	shl    %cl,%edi
+  8052eb:	09 74 24 18          	or     %esi,0x18(%esp)
+  8052ef:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8052f3:	eb 90                	jmp    805285 <udivmod+0x46>
+  8052f5:	85 db                	test   %ebx,%ebx
+  8052f7:	74 05                	je     8052fe <udivmod+0xbf>
+  8052f9:	89 03                	mov    %eax,(%ebx)
+  8052fb:	89 53 04             	mov    %edx,0x4(%ebx)
+  8052fe:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805302:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805306:	83 c4 24             	add    $0x24,%esp
+  805309:	5b                   	pop    %ebx
+  80530a:	5e                   	pop    %esi
+  80530b:	5f                   	pop    %edi
+  80530c:	5d                   	pop    %ebp
+  80530d:	c3                   	ret
+
+0080530e <__udivdi3>:
+  80530e:	83 ec 08             	sub    $0x8,%esp
+  805311:	6a 00                	push   $0x0
+  805313:	ff 74 24 1c          	push   0x1c(%esp)
+  805317:	ff 74 24 1c          	push   0x1c(%esp)
+  80531b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80531f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805323:	e8 17 ff ff ff       	call   80523f <udivmod>
+  805328:	83 c4 14             	add    $0x14,%esp
+  80532b:	c3                   	ret
+
+0080532c <__umoddi3>:
+  80532c:	83 ec 18             	sub    $0x18,%esp
+  80532f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805333:	50                   	push   %eax
+  805334:	ff 74 24 2c          	push   0x2c(%esp)
+  805338:	ff 74 24 2c          	push   0x2c(%esp)
+  80533c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  805340:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  805344:	e8 f6 fe ff ff       	call   80523f <udivmod>
+  805349:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80534d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805351:	83 c4 24             	add    $0x24,%esp
+  805354:	c3                   	ret
+
+00805355 <__divdi3>:
+  805355:	55                   	push   %ebp
+  805356:	57                   	push   %edi
+  805357:	56                   	push   %esi
+  805358:	53                   	push   %ebx
+  805359:	83 ec 10             	sub    $0x10,%esp
+  80535c:	8b 44 24 24          	mov    0x24(%esp),%eax
+  805360:	8b 54 24 28          	mov    0x28(%esp),%edx
+  805364:	89 c6                	mov    %eax,%esi
+  805366:	89 d7                	mov    %edx,%edi
+  805368:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  80536c:	33 7c 24 30          	xor    0x30(%esp),%edi
+  805370:	89 74 24 04          	mov    %esi,0x4(%esp)
+  805374:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  805378:	89 c5                	mov    %eax,%ebp
+  80537a:	f7 dd                	neg    %ebp
+  80537c:	89 d6                	mov    %edx,%esi
+  80537e:	83 d6 00             	adc    $0x0,%esi
+  805381:	f7 de                	neg    %esi
+  805383:	0f 48 e8             	cmovs  %eax,%ebp
+  805386:	0f 49 d6             	cmovns %esi,%edx
+  805389:	6a 00                	push   $0x0
+  80538b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80538f:	f7 de                	neg    %esi
+  805391:	8b 44 24 34          	mov    0x34(%esp),%eax
+  805395:	83 d0 00             	adc    $0x0,%eax
+  805398:	f7 d8                	neg    %eax
+  80539a:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  80539f:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  8053a4:	50                   	push   %eax
+  8053a5:	56                   	push   %esi
+  8053a6:	89 e8                	mov    %ebp,%eax
+  8053a8:	e8 92 fe ff ff       	call   80523f <udivmod>
+  8053ad:	83 c4 10             	add    $0x10,%esp
+  8053b0:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  8053b5:	78 08                	js     8053bf <__divdi3+0x6a>
+  8053b7:	83 c4 0c             	add    $0xc,%esp
+  8053ba:	5b                   	pop    %ebx
+  8053bb:	5e                   	pop    %esi
+  8053bc:	5f                   	pop    %edi
+  8053bd:	5d                   	pop    %ebp
+  8053be:	c3                   	ret
+  8053bf:	f7 d8                	neg    %eax
+  8053c1:	83 d2 00             	adc    $0x0,%edx
+  8053c4:	f7 da                	neg    %edx
+  8053c6:	eb ef                	jmp    8053b7 <__divdi3+0x62>
+
+008053c8 <__moddi3>:
+  8053c8:	55                   	push   %ebp
+  8053c9:	57                   	push   %edi
+  8053ca:	56                   	push   %esi
+  8053cb:	53                   	push   %ebx
+  8053cc:	83 ec 18             	sub    $0x18,%esp
+  8053cf:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8053d3:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8053d7:	89 f1                	mov    %esi,%ecx
+  8053d9:	f7 d9                	neg    %ecx
+  8053db:	89 da                	mov    %ebx,%edx
+  8053dd:	83 d2 00             	adc    $0x0,%edx
+  8053e0:	f7 da                	neg    %edx
+  8053e2:	0f 48 ce             	cmovs  %esi,%ecx
+  8053e5:	0f 48 d3             	cmovs  %ebx,%edx
+  8053e8:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8053ec:	50                   	push   %eax
+  8053ed:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8053f1:	f7 de                	neg    %esi
+  8053f3:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8053f7:	83 d0 00             	adc    $0x0,%eax
+  8053fa:	f7 d8                	neg    %eax
+  8053fc:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  805401:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  805406:	50                   	push   %eax
+  805407:	56                   	push   %esi
+  805408:	89 c8                	mov    %ecx,%eax
+  80540a:	e8 30 fe ff ff       	call   80523f <udivmod>
+  80540f:	83 c4 10             	add    $0x10,%esp
+  805412:	85 db                	test   %ebx,%ebx
+  805414:	78 10                	js     805426 <__moddi3+0x5e>
+  805416:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80541a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80541e:	83 c4 14             	add    $0x14,%esp
+  805421:	5b                   	pop    %ebx
+  805422:	5e                   	pop    %esi
+  805423:	5f                   	pop    %edi
+  805424:	5d                   	pop    %ebp
+  805425:	c3                   	ret
+  805426:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80542a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80542e:	f7 d8                	neg    %eax
+  805430:	83 d2 00             	adc    $0x0,%edx
+  805433:	f7 da                	neg    %edx
+  805435:	eb e7                	jmp    80541e <__moddi3+0x56>
@@ -0,0 +1,5892 @@
+
+obj/user/num.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4a 01 00 00       	call   80017b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <num>:
+int bol = 1;
+int line = 0;
+
+void
+num(int f, const char *s)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+  80003b:	8b 75 08             	mov    0x8(%ebp),%esi
+	long n;
+	int r;
+	char c;
+
+	while ((n = read(f, &c, 1)) > 0) {
+  80003e:	8d 5d f7             	lea    -0x9(%ebp),%ebx
+  800041:	eb 1b                	jmp    80005e <num+0x2b>
+		if (bol) {
+			printf("%5d ", ++line);
+			bol = 0;
+		}
+		if ((r = write(1, &c, 1)) != 1)
+  800043:	83 ec 04             	sub    $0x4,%esp
+  800046:	6a 01                	push   $0x1
+  800048:	53                   	push   %ebx
+  800049:	6a 01                	push   $0x1
+  80004b:	e8 86 16 00 00       	call   8016d6 <write>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	83 f8 01             	cmp    $0x1,%eax
+  800056:	75 4c                	jne    8000a4 <num+0x71>
+			panic("write error copying %s: %e", s, r);
+		if (c == '\n')
+  800058:	80 7d f7 0a          	cmpb   $0xa,-0x9(%ebp)
+  80005c:	74 5e                	je     8000bc <num+0x89>
+	while ((n = read(f, &c, 1)) > 0) {
+  80005e:	83 ec 04             	sub    $0x4,%esp
+  800061:	6a 01                	push   $0x1
+  800063:	53                   	push   %ebx
+  800064:	56                   	push   %esi
+  800065:	e8 9e 15 00 00       	call   801608 <read>
+  80006a:	83 c4 10             	add    $0x10,%esp
+  80006d:	85 c0                	test   %eax,%eax
+  80006f:	7e 57                	jle    8000c8 <num+0x95>
+		if (bol) {
+  800071:	83 3d 00 30 80 00 00 	cmpl   $0x0,0x803000
+  800078:	74 c9                	je     800043 <num+0x10>
+			printf("%5d ", ++line);
+  80007a:	a1 00 40 80 00       	mov    0x804000,%eax
+  80007f:	83 c0 01             	add    $0x1,%eax
+  800082:	a3 00 40 80 00       	mov    %eax,0x804000
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	50                   	push   %eax
+  80008b:	68 e0 28 80 00       	push   $0x8028e0
+  800090:	e8 14 1d 00 00       	call   801da9 <printf>
+			bol = 0;
+  800095:	c7 05 00 30 80 00 00 	movl   $0x0,0x803000
+  80009c:	00 00 00 
+  80009f:	83 c4 10             	add    $0x10,%esp
+  8000a2:	eb 9f                	jmp    800043 <num+0x10>
+			panic("write error copying %s: %e", s, r);
+  8000a4:	83 ec 0c             	sub    $0xc,%esp
+  8000a7:	50                   	push   %eax
+  8000a8:	ff 75 0c             	push   0xc(%ebp)
+  8000ab:	68 e5 28 80 00       	push   $0x8028e5
+  8000b0:	6a 13                	push   $0x13
+  8000b2:	68 00 29 80 00       	push   $0x802900
+  8000b7:	e8 22 01 00 00       	call   8001de <_panic>
+			bol = 1;
+  8000bc:	c7 05 00 30 80 00 01 	movl   $0x1,0x803000
+  8000c3:	00 00 00 
+  8000c6:	eb 96                	jmp    80005e <num+0x2b>
+	}
+	if (n < 0)
+  8000c8:	78 07                	js     8000d1 <num+0x9e>
+		panic("error reading %s: %e", s, n);
+}
+  8000ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000cd:	5b                   	pop    %ebx
+  8000ce:	5e                   	pop    %esi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+		panic("error reading %s: %e", s, n);
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	50                   	push   %eax
+  8000d5:	ff 75 0c             	push   0xc(%ebp)
+  8000d8:	68 0b 29 80 00       	push   $0x80290b
+  8000dd:	6a 18                	push   $0x18
+  8000df:	68 00 29 80 00       	push   $0x802900
+  8000e4:	e8 f5 00 00 00       	call   8001de <_panic>
+
+008000e9 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000e9:	55                   	push   %ebp
+  8000ea:	89 e5                	mov    %esp,%ebp
+  8000ec:	57                   	push   %edi
+  8000ed:	56                   	push   %esi
+  8000ee:	53                   	push   %ebx
+  8000ef:	83 ec 0c             	sub    $0xc,%esp
+	int f, i;
+
+	binaryname = "num";
+  8000f2:	c7 05 04 30 80 00 20 	movl   $0x802920,0x803004
+  8000f9:	29 80 00 
+	if (argc == 1)
+  8000fc:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800100:	74 0d                	je     80010f <umain+0x26>
+  800102:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800105:	8d 70 04             	lea    0x4(%eax),%esi
+		num(0, "<stdin>");
+	else
+		for (i = 1; i < argc; i++) {
+  800108:	bf 01 00 00 00       	mov    $0x1,%edi
+  80010d:	eb 3b                	jmp    80014a <umain+0x61>
+		num(0, "<stdin>");
+  80010f:	83 ec 08             	sub    $0x8,%esp
+  800112:	68 24 29 80 00       	push   $0x802924
+  800117:	6a 00                	push   $0x0
+  800119:	e8 15 ff ff ff       	call   800033 <num>
+  80011e:	83 c4 10             	add    $0x10,%esp
+			else {
+				num(f, argv[i]);
+				close(f);
+			}
+		}
+	exit();
+  800121:	e8 9e 00 00 00       	call   8001c4 <exit>
+}
+  800126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800129:	5b                   	pop    %ebx
+  80012a:	5e                   	pop    %esi
+  80012b:	5f                   	pop    %edi
+  80012c:	5d                   	pop    %ebp
+  80012d:	c3                   	ret
+				num(f, argv[i]);
+  80012e:	83 ec 08             	sub    $0x8,%esp
+  800131:	ff 36                	push   (%esi)
+  800133:	50                   	push   %eax
+  800134:	e8 fa fe ff ff       	call   800033 <num>
+				close(f);
+  800139:	89 1c 24             	mov    %ebx,(%esp)
+  80013c:	e8 8b 13 00 00       	call   8014cc <close>
+		for (i = 1; i < argc; i++) {
+  800141:	83 c7 01             	add    $0x1,%edi
+  800144:	83 c6 04             	add    $0x4,%esi
+  800147:	83 c4 10             	add    $0x10,%esp
+  80014a:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80014d:	7d d2                	jge    800121 <umain+0x38>
+			f = open(argv[i], O_RDONLY);
+  80014f:	83 ec 08             	sub    $0x8,%esp
+  800152:	6a 00                	push   $0x0
+  800154:	ff 36                	push   (%esi)
+  800156:	e8 e8 19 00 00       	call   801b43 <open>
+  80015b:	89 c3                	mov    %eax,%ebx
+			if (f < 0)
+  80015d:	83 c4 10             	add    $0x10,%esp
+  800160:	85 c0                	test   %eax,%eax
+  800162:	79 ca                	jns    80012e <umain+0x45>
+				panic("can't open %s: %e", argv[i], f);
+  800164:	83 ec 0c             	sub    $0xc,%esp
+  800167:	50                   	push   %eax
+  800168:	ff 36                	push   (%esi)
+  80016a:	68 2c 29 80 00       	push   $0x80292c
+  80016f:	6a 27                	push   $0x27
+  800171:	68 00 29 80 00       	push   $0x802900
+  800176:	e8 63 00 00 00       	call   8001de <_panic>
+
+0080017b <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80017b:	55                   	push   %ebp
+  80017c:	89 e5                	mov    %esp,%ebp
+  80017e:	56                   	push   %esi
+  80017f:	53                   	push   %ebx
+  800180:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800183:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800186:	e8 ca 0b 00 00       	call   800d55 <sys_getenvid>
+  80018b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800190:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800193:	c1 e0 06             	shl    $0x6,%eax
+  800196:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80019b:	a3 0c 40 80 00       	mov    %eax,0x80400c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001a0:	85 db                	test   %ebx,%ebx
+  8001a2:	7e 07                	jle    8001ab <libmain+0x30>
+		binaryname = argv[0];
+  8001a4:	8b 06                	mov    (%esi),%eax
+  8001a6:	a3 04 30 80 00       	mov    %eax,0x803004
+
+	// call user main routine
+	umain(argc, argv);
+  8001ab:	83 ec 08             	sub    $0x8,%esp
+  8001ae:	56                   	push   %esi
+  8001af:	53                   	push   %ebx
+  8001b0:	e8 34 ff ff ff       	call   8000e9 <umain>
+
+	// exit gracefully
+	exit();
+  8001b5:	e8 0a 00 00 00       	call   8001c4 <exit>
+}
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001c0:	5b                   	pop    %ebx
+  8001c1:	5e                   	pop    %esi
+  8001c2:	5d                   	pop    %ebp
+  8001c3:	c3                   	ret
+
+008001c4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001c4:	55                   	push   %ebp
+  8001c5:	89 e5                	mov    %esp,%ebp
+  8001c7:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001ca:	e8 2a 13 00 00       	call   8014f9 <close_all>
+	sys_env_destroy(0);
+  8001cf:	83 ec 0c             	sub    $0xc,%esp
+  8001d2:	6a 00                	push   $0x0
+  8001d4:	e8 3b 0b 00 00       	call   800d14 <sys_env_destroy>
+}
+  8001d9:	83 c4 10             	add    $0x10,%esp
+  8001dc:	c9                   	leave
+  8001dd:	c3                   	ret
+
+008001de <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001de:	55                   	push   %ebp
+  8001df:	89 e5                	mov    %esp,%ebp
+  8001e1:	56                   	push   %esi
+  8001e2:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001e3:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001e6:	8b 35 04 30 80 00    	mov    0x803004,%esi
+  8001ec:	e8 64 0b 00 00       	call   800d55 <sys_getenvid>
+  8001f1:	83 ec 0c             	sub    $0xc,%esp
+  8001f4:	ff 75 0c             	push   0xc(%ebp)
+  8001f7:	ff 75 08             	push   0x8(%ebp)
+  8001fa:	56                   	push   %esi
+  8001fb:	50                   	push   %eax
+  8001fc:	68 48 29 80 00       	push   $0x802948
+  800201:	e8 b3 00 00 00       	call   8002b9 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800206:	83 c4 18             	add    $0x18,%esp
+  800209:	53                   	push   %ebx
+  80020a:	ff 75 10             	push   0x10(%ebp)
+  80020d:	e8 56 00 00 00       	call   800268 <vcprintf>
+	cprintf("\n");
+  800212:	c7 04 24 cf 2d 80 00 	movl   $0x802dcf,(%esp)
+  800219:	e8 9b 00 00 00       	call   8002b9 <cprintf>
+  80021e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800221:	cc                   	int3
+	while (1)
+  800222:	eb fd                	jmp    800221 <_panic+0x43>
+
+00800224 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800224:	55                   	push   %ebp
+  800225:	89 e5                	mov    %esp,%ebp
+  800227:	53                   	push   %ebx
+  800228:	83 ec 04             	sub    $0x4,%esp
+  80022b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80022e:	8b 13                	mov    (%ebx),%edx
+  800230:	8d 42 01             	lea    0x1(%edx),%eax
+  800233:	89 03                	mov    %eax,(%ebx)
+  800235:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800238:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80023c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800241:	74 09                	je     80024c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800243:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800247:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80024a:	c9                   	leave
+  80024b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80024c:	83 ec 08             	sub    $0x8,%esp
+  80024f:	68 ff 00 00 00       	push   $0xff
+  800254:	8d 43 08             	lea    0x8(%ebx),%eax
+  800257:	50                   	push   %eax
+  800258:	e8 69 0a 00 00       	call   800cc6 <sys_cputs>
+		b->idx = 0;
+  80025d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800263:	83 c4 10             	add    $0x10,%esp
+  800266:	eb db                	jmp    800243 <putch+0x1f>
+
+00800268 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800268:	55                   	push   %ebp
+  800269:	89 e5                	mov    %esp,%ebp
+  80026b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800271:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800278:	00 00 00 
+	b.cnt = 0;
+  80027b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800282:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800285:	ff 75 0c             	push   0xc(%ebp)
+  800288:	ff 75 08             	push   0x8(%ebp)
+  80028b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800291:	50                   	push   %eax
+  800292:	68 24 02 80 00       	push   $0x800224
+  800297:	e8 14 01 00 00       	call   8003b0 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80029c:	83 c4 08             	add    $0x8,%esp
+  80029f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002a5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002ab:	50                   	push   %eax
+  8002ac:	e8 15 0a 00 00       	call   800cc6 <sys_cputs>
+
+	return b.cnt;
+}
+  8002b1:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002b7:	c9                   	leave
+  8002b8:	c3                   	ret
+
+008002b9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002b9:	55                   	push   %ebp
+  8002ba:	89 e5                	mov    %esp,%ebp
+  8002bc:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002bf:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002c2:	50                   	push   %eax
+  8002c3:	ff 75 08             	push   0x8(%ebp)
+  8002c6:	e8 9d ff ff ff       	call   800268 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002cb:	c9                   	leave
+  8002cc:	c3                   	ret
+
+008002cd <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002cd:	55                   	push   %ebp
+  8002ce:	89 e5                	mov    %esp,%ebp
+  8002d0:	57                   	push   %edi
+  8002d1:	56                   	push   %esi
+  8002d2:	53                   	push   %ebx
+  8002d3:	83 ec 1c             	sub    $0x1c,%esp
+  8002d6:	89 c7                	mov    %eax,%edi
+  8002d8:	89 d6                	mov    %edx,%esi
+  8002da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002e0:	89 d1                	mov    %edx,%ecx
+  8002e2:	89 c2                	mov    %eax,%edx
+  8002e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002e7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002ea:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002ed:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002f3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002fa:	39 c2                	cmp    %eax,%edx
+  8002fc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002ff:	72 3e                	jb     80033f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800301:	83 ec 0c             	sub    $0xc,%esp
+  800304:	ff 75 18             	push   0x18(%ebp)
+  800307:	83 eb 01             	sub    $0x1,%ebx
+  80030a:	53                   	push   %ebx
+  80030b:	50                   	push   %eax
+  80030c:	83 ec 08             	sub    $0x8,%esp
+  80030f:	ff 75 e4             	push   -0x1c(%ebp)
+  800312:	ff 75 e0             	push   -0x20(%ebp)
+  800315:	ff 75 dc             	push   -0x24(%ebp)
+  800318:	ff 75 d8             	push   -0x28(%ebp)
+  80031b:	e8 91 24 00 00       	call   8027b1 <__udivdi3>
+  800320:	83 c4 18             	add    $0x18,%esp
+  800323:	52                   	push   %edx
+  800324:	50                   	push   %eax
+  800325:	89 f2                	mov    %esi,%edx
+  800327:	89 f8                	mov    %edi,%eax
+  800329:	e8 9f ff ff ff       	call   8002cd <printnum>
+  80032e:	83 c4 20             	add    $0x20,%esp
+  800331:	eb 13                	jmp    800346 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800333:	83 ec 08             	sub    $0x8,%esp
+  800336:	56                   	push   %esi
+  800337:	ff 75 18             	push   0x18(%ebp)
+  80033a:	ff d7                	call   *%edi
+  80033c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80033f:	83 eb 01             	sub    $0x1,%ebx
+  800342:	85 db                	test   %ebx,%ebx
+  800344:	7f ed                	jg     800333 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800346:	83 ec 08             	sub    $0x8,%esp
+  800349:	56                   	push   %esi
+  80034a:	83 ec 04             	sub    $0x4,%esp
+  80034d:	ff 75 e4             	push   -0x1c(%ebp)
+  800350:	ff 75 e0             	push   -0x20(%ebp)
+  800353:	ff 75 dc             	push   -0x24(%ebp)
+  800356:	ff 75 d8             	push   -0x28(%ebp)
+  800359:	e8 71 24 00 00       	call   8027cf <__umoddi3>
+  80035e:	83 c4 14             	add    $0x14,%esp
+  800361:	0f be 80 6b 29 80 00 	movsbl 0x80296b(%eax),%eax
+  800368:	50                   	push   %eax
+  800369:	ff d7                	call   *%edi
+}
+  80036b:	83 c4 10             	add    $0x10,%esp
+  80036e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800371:	5b                   	pop    %ebx
+  800372:	5e                   	pop    %esi
+  800373:	5f                   	pop    %edi
+  800374:	5d                   	pop    %ebp
+  800375:	c3                   	ret
+
+00800376 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800376:	55                   	push   %ebp
+  800377:	89 e5                	mov    %esp,%ebp
+  800379:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80037c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800380:	8b 10                	mov    (%eax),%edx
+  800382:	3b 50 04             	cmp    0x4(%eax),%edx
+  800385:	73 0a                	jae    800391 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800387:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80038a:	89 08                	mov    %ecx,(%eax)
+  80038c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80038f:	88 02                	mov    %al,(%edx)
+}
+  800391:	5d                   	pop    %ebp
+  800392:	c3                   	ret
+
+00800393 <printfmt>:
+{
+  800393:	55                   	push   %ebp
+  800394:	89 e5                	mov    %esp,%ebp
+  800396:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800399:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80039c:	50                   	push   %eax
+  80039d:	ff 75 10             	push   0x10(%ebp)
+  8003a0:	ff 75 0c             	push   0xc(%ebp)
+  8003a3:	ff 75 08             	push   0x8(%ebp)
+  8003a6:	e8 05 00 00 00       	call   8003b0 <vprintfmt>
+}
+  8003ab:	83 c4 10             	add    $0x10,%esp
+  8003ae:	c9                   	leave
+  8003af:	c3                   	ret
+
+008003b0 <vprintfmt>:
+{
+  8003b0:	55                   	push   %ebp
+  8003b1:	89 e5                	mov    %esp,%ebp
+  8003b3:	57                   	push   %edi
+  8003b4:	56                   	push   %esi
+  8003b5:	53                   	push   %ebx
+  8003b6:	83 ec 2c             	sub    $0x2c,%esp
+  8003b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003bf:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003c2:	eb 0a                	jmp    8003ce <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003c4:	83 ec 08             	sub    $0x8,%esp
+  8003c7:	53                   	push   %ebx
+  8003c8:	50                   	push   %eax
+  8003c9:	ff d6                	call   *%esi
+  8003cb:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003ce:	83 c7 01             	add    $0x1,%edi
+  8003d1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003d5:	83 f8 25             	cmp    $0x25,%eax
+  8003d8:	74 0c                	je     8003e6 <vprintfmt+0x36>
+			if (ch == '\0')
+  8003da:	85 c0                	test   %eax,%eax
+  8003dc:	75 e6                	jne    8003c4 <vprintfmt+0x14>
+}
+  8003de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003e1:	5b                   	pop    %ebx
+  8003e2:	5e                   	pop    %esi
+  8003e3:	5f                   	pop    %edi
+  8003e4:	5d                   	pop    %ebp
+  8003e5:	c3                   	ret
+		padc = ' ';
+  8003e6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003ea:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003f1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003f8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800404:	8d 47 01             	lea    0x1(%edi),%eax
+  800407:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80040a:	0f b6 17             	movzbl (%edi),%edx
+  80040d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800410:	3c 55                	cmp    $0x55,%al
+  800412:	0f 87 c5 03 00 00    	ja     8007dd <vprintfmt+0x42d>
+  800418:	0f b6 c0             	movzbl %al,%eax
+  80041b:	ff 24 85 00 2b 80 00 	jmp    *0x802b00(,%eax,4)
+  800422:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800425:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800429:	eb d9                	jmp    800404 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80042b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80042e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800432:	eb d0                	jmp    800404 <vprintfmt+0x54>
+  800434:	0f b6 d2             	movzbl %dl,%edx
+  800437:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80043a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800442:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800445:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800449:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80044c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80044f:	83 f9 09             	cmp    $0x9,%ecx
+  800452:	77 55                	ja     8004a9 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800454:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800457:	eb e9                	jmp    800442 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800459:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045c:	8b 00                	mov    (%eax),%eax
+  80045e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800461:	8b 45 14             	mov    0x14(%ebp),%eax
+  800464:	8d 40 04             	lea    0x4(%eax),%eax
+  800467:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80046a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80046d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800471:	79 91                	jns    800404 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800473:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800476:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800479:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800480:	eb 82                	jmp    800404 <vprintfmt+0x54>
+			if (width < 0)
+  800482:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800485:	85 d2                	test   %edx,%edx
+  800487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048c:	0f 49 c2             	cmovns %edx,%eax
+  80048f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800492:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800495:	e9 6a ff ff ff       	jmp    800404 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80049a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80049d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004a4:	e9 5b ff ff ff       	jmp    800404 <vprintfmt+0x54>
+  8004a9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004af:	eb bc                	jmp    80046d <vprintfmt+0xbd>
+			lflag++;
+  8004b1:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004b7:	e9 48 ff ff ff       	jmp    800404 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bf:	8d 78 04             	lea    0x4(%eax),%edi
+  8004c2:	83 ec 08             	sub    $0x8,%esp
+  8004c5:	53                   	push   %ebx
+  8004c6:	ff 30                	push   (%eax)
+  8004c8:	ff d6                	call   *%esi
+			break;
+  8004ca:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004cd:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004d0:	e9 63 02 00 00       	jmp    800738 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8004d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d8:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004db:	8b 10                	mov    (%eax),%edx
+  8004dd:	89 d0                	mov    %edx,%eax
+  8004df:	f7 d8                	neg    %eax
+  8004e1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004e4:	83 f8 12             	cmp    $0x12,%eax
+  8004e7:	7f 23                	jg     80050c <vprintfmt+0x15c>
+  8004e9:	8b 14 85 60 2c 80 00 	mov    0x802c60(,%eax,4),%edx
+  8004f0:	85 d2                	test   %edx,%edx
+  8004f2:	74 18                	je     80050c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004f4:	52                   	push   %edx
+  8004f5:	68 9d 2d 80 00       	push   $0x802d9d
+  8004fa:	53                   	push   %ebx
+  8004fb:	56                   	push   %esi
+  8004fc:	e8 92 fe ff ff       	call   800393 <printfmt>
+  800501:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800504:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800507:	e9 2c 02 00 00       	jmp    800738 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80050c:	50                   	push   %eax
+  80050d:	68 83 29 80 00       	push   $0x802983
+  800512:	53                   	push   %ebx
+  800513:	56                   	push   %esi
+  800514:	e8 7a fe ff ff       	call   800393 <printfmt>
+  800519:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80051c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80051f:	e9 14 02 00 00       	jmp    800738 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800524:	8b 45 14             	mov    0x14(%ebp),%eax
+  800527:	83 c0 04             	add    $0x4,%eax
+  80052a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80052d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800530:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800532:	85 c9                	test   %ecx,%ecx
+  800534:	b8 7c 29 80 00       	mov    $0x80297c,%eax
+  800539:	0f 45 c1             	cmovne %ecx,%eax
+  80053c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80053f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800543:	7e 06                	jle    80054b <vprintfmt+0x19b>
+  800545:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800549:	75 0b                	jne    800556 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80054b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80054e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800551:	89 75 08             	mov    %esi,0x8(%ebp)
+  800554:	eb 5c                	jmp    8005b2 <vprintfmt+0x202>
+  800556:	83 ec 08             	sub    $0x8,%esp
+  800559:	ff 75 d0             	push   -0x30(%ebp)
+  80055c:	ff 75 cc             	push   -0x34(%ebp)
+  80055f:	e8 19 03 00 00       	call   80087d <strnlen>
+  800564:	89 c2                	mov    %eax,%edx
+  800566:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800569:	29 d0                	sub    %edx,%eax
+  80056b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80056e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800572:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800575:	89 75 08             	mov    %esi,0x8(%ebp)
+  800578:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80057a:	eb 0e                	jmp    80058a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80057c:	83 ec 08             	sub    $0x8,%esp
+  80057f:	53                   	push   %ebx
+  800580:	57                   	push   %edi
+  800581:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800584:	83 ee 01             	sub    $0x1,%esi
+  800587:	83 c4 10             	add    $0x10,%esp
+  80058a:	85 f6                	test   %esi,%esi
+  80058c:	7f ee                	jg     80057c <vprintfmt+0x1cc>
+  80058e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800591:	8b 75 08             	mov    0x8(%ebp),%esi
+  800594:	85 c0                	test   %eax,%eax
+  800596:	ba 00 00 00 00       	mov    $0x0,%edx
+  80059b:	0f 49 d0             	cmovns %eax,%edx
+  80059e:	29 d0                	sub    %edx,%eax
+  8005a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005a3:	eb a6                	jmp    80054b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005a5:	83 ec 08             	sub    $0x8,%esp
+  8005a8:	53                   	push   %ebx
+  8005a9:	52                   	push   %edx
+  8005aa:	ff 55 08             	call   *0x8(%ebp)
+  8005ad:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005b0:	89 f1                	mov    %esi,%ecx
+  8005b2:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005b5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005b9:	0f be d0             	movsbl %al,%edx
+  8005bc:	85 d2                	test   %edx,%edx
+  8005be:	74 28                	je     8005e8 <vprintfmt+0x238>
+  8005c0:	85 ff                	test   %edi,%edi
+  8005c2:	78 05                	js     8005c9 <vprintfmt+0x219>
+  8005c4:	83 ef 01             	sub    $0x1,%edi
+  8005c7:	78 30                	js     8005f9 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005c9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005cd:	74 d6                	je     8005a5 <vprintfmt+0x1f5>
+  8005cf:	0f be c0             	movsbl %al,%eax
+  8005d2:	83 e8 20             	sub    $0x20,%eax
+  8005d5:	83 f8 5e             	cmp    $0x5e,%eax
+  8005d8:	76 cb                	jbe    8005a5 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005da:	83 ec 08             	sub    $0x8,%esp
+  8005dd:	53                   	push   %ebx
+  8005de:	6a 3f                	push   $0x3f
+  8005e0:	ff 55 08             	call   *0x8(%ebp)
+  8005e3:	83 c4 10             	add    $0x10,%esp
+  8005e6:	eb c8                	jmp    8005b0 <vprintfmt+0x200>
+  8005e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005eb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005ee:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005f1:	01 d0                	add    %edx,%eax
+  8005f3:	29 c8                	sub    %ecx,%eax
+  8005f5:	89 c7                	mov    %eax,%edi
+  8005f7:	eb 13                	jmp    80060c <vprintfmt+0x25c>
+  8005f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005fc:	eb ed                	jmp    8005eb <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005fe:	83 ec 08             	sub    $0x8,%esp
+  800601:	53                   	push   %ebx
+  800602:	6a 20                	push   $0x20
+  800604:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800606:	83 ef 01             	sub    $0x1,%edi
+  800609:	83 c4 10             	add    $0x10,%esp
+  80060c:	85 ff                	test   %edi,%edi
+  80060e:	7f ee                	jg     8005fe <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800610:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800613:	89 45 14             	mov    %eax,0x14(%ebp)
+  800616:	e9 1d 01 00 00       	jmp    800738 <vprintfmt+0x388>
+	if (lflag >= 2)
+  80061b:	83 f9 01             	cmp    $0x1,%ecx
+  80061e:	7f 1b                	jg     80063b <vprintfmt+0x28b>
+	else if (lflag)
+  800620:	85 c9                	test   %ecx,%ecx
+  800622:	74 63                	je     800687 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800624:	8b 45 14             	mov    0x14(%ebp),%eax
+  800627:	8b 00                	mov    (%eax),%eax
+  800629:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80062c:	99                   	cltd
+  80062d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800630:	8b 45 14             	mov    0x14(%ebp),%eax
+  800633:	8d 40 04             	lea    0x4(%eax),%eax
+  800636:	89 45 14             	mov    %eax,0x14(%ebp)
+  800639:	eb 17                	jmp    800652 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80063b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063e:	8b 50 04             	mov    0x4(%eax),%edx
+  800641:	8b 00                	mov    (%eax),%eax
+  800643:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800646:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800649:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064c:	8d 40 08             	lea    0x8(%eax),%eax
+  80064f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800652:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800655:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800658:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80065d:	85 c9                	test   %ecx,%ecx
+  80065f:	0f 89 b9 00 00 00    	jns    80071e <vprintfmt+0x36e>
+				putch('-', putdat);
+  800665:	83 ec 08             	sub    $0x8,%esp
+  800668:	53                   	push   %ebx
+  800669:	6a 2d                	push   $0x2d
+  80066b:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80066d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800670:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800673:	f7 da                	neg    %edx
+  800675:	83 d1 00             	adc    $0x0,%ecx
+  800678:	f7 d9                	neg    %ecx
+  80067a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80067d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800682:	e9 97 00 00 00       	jmp    80071e <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800687:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068a:	8b 00                	mov    (%eax),%eax
+  80068c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80068f:	99                   	cltd
+  800690:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800693:	8b 45 14             	mov    0x14(%ebp),%eax
+  800696:	8d 40 04             	lea    0x4(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+  80069c:	eb b4                	jmp    800652 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  80069e:	83 f9 01             	cmp    $0x1,%ecx
+  8006a1:	7f 1b                	jg     8006be <vprintfmt+0x30e>
+	else if (lflag)
+  8006a3:	85 c9                	test   %ecx,%ecx
+  8006a5:	74 2c                	je     8006d3 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8006a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006aa:	8b 10                	mov    (%eax),%edx
+  8006ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006b7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006bc:	eb 60                	jmp    80071e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8006be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c1:	8b 10                	mov    (%eax),%edx
+  8006c3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006c6:	8d 40 08             	lea    0x8(%eax),%eax
+  8006c9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006cc:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006d1:	eb 4b                	jmp    80071e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8006d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d6:	8b 10                	mov    (%eax),%edx
+  8006d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006e3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006e8:	eb 34                	jmp    80071e <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8006ea:	83 f9 01             	cmp    $0x1,%ecx
+  8006ed:	7f 15                	jg     800704 <vprintfmt+0x354>
+	else if (lflag)
+  8006ef:	85 c9                	test   %ecx,%ecx
+  8006f1:	74 4d                	je     800740 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8006f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f6:	8b 00                	mov    (%eax),%eax
+  8006f8:	99                   	cltd
+  8006f9:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006fc:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8006ff:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800702:	eb 11                	jmp    800715 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800704:	8b 45 14             	mov    0x14(%ebp),%eax
+  800707:	8b 50 04             	mov    0x4(%eax),%edx
+  80070a:	8b 00                	mov    (%eax),%eax
+  80070c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80070f:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800712:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800715:	89 d1                	mov    %edx,%ecx
+  800717:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800719:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80071e:	83 ec 0c             	sub    $0xc,%esp
+  800721:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800725:	50                   	push   %eax
+  800726:	ff 75 e0             	push   -0x20(%ebp)
+  800729:	57                   	push   %edi
+  80072a:	51                   	push   %ecx
+  80072b:	52                   	push   %edx
+  80072c:	89 da                	mov    %ebx,%edx
+  80072e:	89 f0                	mov    %esi,%eax
+  800730:	e8 98 fb ff ff       	call   8002cd <printnum>
+			break;
+  800735:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800738:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80073b:	e9 8e fc ff ff       	jmp    8003ce <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800740:	8b 45 14             	mov    0x14(%ebp),%eax
+  800743:	8b 00                	mov    (%eax),%eax
+  800745:	99                   	cltd
+  800746:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800749:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80074c:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80074f:	eb c4                	jmp    800715 <vprintfmt+0x365>
+			putch('0', putdat);
+  800751:	83 ec 08             	sub    $0x8,%esp
+  800754:	53                   	push   %ebx
+  800755:	6a 30                	push   $0x30
+  800757:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800759:	83 c4 08             	add    $0x8,%esp
+  80075c:	53                   	push   %ebx
+  80075d:	6a 78                	push   $0x78
+  80075f:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800761:	8b 45 14             	mov    0x14(%ebp),%eax
+  800764:	8b 10                	mov    (%eax),%edx
+  800766:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80076b:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80076e:	8d 40 04             	lea    0x4(%eax),%eax
+  800771:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800774:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800779:	eb a3                	jmp    80071e <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80077b:	83 f9 01             	cmp    $0x1,%ecx
+  80077e:	7f 1b                	jg     80079b <vprintfmt+0x3eb>
+	else if (lflag)
+  800780:	85 c9                	test   %ecx,%ecx
+  800782:	74 2f                	je     8007b3 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800784:	8b 45 14             	mov    0x14(%ebp),%eax
+  800787:	8b 10                	mov    (%eax),%edx
+  800789:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80078e:	8d 40 04             	lea    0x4(%eax),%eax
+  800791:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800794:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800799:	eb 83                	jmp    80071e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80079b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079e:	8b 10                	mov    (%eax),%edx
+  8007a0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007a3:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007a9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007ae:	e9 6b ff ff ff       	jmp    80071e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8007b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b6:	8b 10                	mov    (%eax),%edx
+  8007b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007c8:	e9 51 ff ff ff       	jmp    80071e <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8007cd:	83 ec 08             	sub    $0x8,%esp
+  8007d0:	53                   	push   %ebx
+  8007d1:	6a 25                	push   $0x25
+  8007d3:	ff d6                	call   *%esi
+			break;
+  8007d5:	83 c4 10             	add    $0x10,%esp
+  8007d8:	e9 5b ff ff ff       	jmp    800738 <vprintfmt+0x388>
+			putch('%', putdat);
+  8007dd:	83 ec 08             	sub    $0x8,%esp
+  8007e0:	53                   	push   %ebx
+  8007e1:	6a 25                	push   $0x25
+  8007e3:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007e5:	83 c4 10             	add    $0x10,%esp
+  8007e8:	89 f8                	mov    %edi,%eax
+  8007ea:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007ee:	74 05                	je     8007f5 <vprintfmt+0x445>
+  8007f0:	83 e8 01             	sub    $0x1,%eax
+  8007f3:	eb f5                	jmp    8007ea <vprintfmt+0x43a>
+  8007f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007f8:	e9 3b ff ff ff       	jmp    800738 <vprintfmt+0x388>
+
+008007fd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007fd:	55                   	push   %ebp
+  8007fe:	89 e5                	mov    %esp,%ebp
+  800800:	83 ec 18             	sub    $0x18,%esp
+  800803:	8b 45 08             	mov    0x8(%ebp),%eax
+  800806:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800809:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80080c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800810:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800813:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80081a:	85 c0                	test   %eax,%eax
+  80081c:	74 26                	je     800844 <vsnprintf+0x47>
+  80081e:	85 d2                	test   %edx,%edx
+  800820:	7e 22                	jle    800844 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800822:	ff 75 14             	push   0x14(%ebp)
+  800825:	ff 75 10             	push   0x10(%ebp)
+  800828:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80082b:	50                   	push   %eax
+  80082c:	68 76 03 80 00       	push   $0x800376
+  800831:	e8 7a fb ff ff       	call   8003b0 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800836:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800839:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80083c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80083f:	83 c4 10             	add    $0x10,%esp
+}
+  800842:	c9                   	leave
+  800843:	c3                   	ret
+		return -E_INVAL;
+  800844:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800849:	eb f7                	jmp    800842 <vsnprintf+0x45>
+
+0080084b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80084b:	55                   	push   %ebp
+  80084c:	89 e5                	mov    %esp,%ebp
+  80084e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800851:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800854:	50                   	push   %eax
+  800855:	ff 75 10             	push   0x10(%ebp)
+  800858:	ff 75 0c             	push   0xc(%ebp)
+  80085b:	ff 75 08             	push   0x8(%ebp)
+  80085e:	e8 9a ff ff ff       	call   8007fd <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800863:	c9                   	leave
+  800864:	c3                   	ret
+
+00800865 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800865:	55                   	push   %ebp
+  800866:	89 e5                	mov    %esp,%ebp
+  800868:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80086b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800870:	eb 03                	jmp    800875 <strlen+0x10>
+		n++;
+  800872:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800875:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800879:	75 f7                	jne    800872 <strlen+0xd>
+	return n;
+}
+  80087b:	5d                   	pop    %ebp
+  80087c:	c3                   	ret
+
+0080087d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80087d:	55                   	push   %ebp
+  80087e:	89 e5                	mov    %esp,%ebp
+  800880:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800883:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800886:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088b:	eb 03                	jmp    800890 <strnlen+0x13>
+		n++;
+  80088d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800890:	39 d0                	cmp    %edx,%eax
+  800892:	74 08                	je     80089c <strnlen+0x1f>
+  800894:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800898:	75 f3                	jne    80088d <strnlen+0x10>
+  80089a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80089c:	89 d0                	mov    %edx,%eax
+  80089e:	5d                   	pop    %ebp
+  80089f:	c3                   	ret
+
+008008a0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008a0:	55                   	push   %ebp
+  8008a1:	89 e5                	mov    %esp,%ebp
+  8008a3:	53                   	push   %ebx
+  8008a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008af:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008b3:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008b6:	83 c0 01             	add    $0x1,%eax
+  8008b9:	84 d2                	test   %dl,%dl
+  8008bb:	75 f2                	jne    8008af <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008bd:	89 c8                	mov    %ecx,%eax
+  8008bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008c2:	c9                   	leave
+  8008c3:	c3                   	ret
+
+008008c4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008c4:	55                   	push   %ebp
+  8008c5:	89 e5                	mov    %esp,%ebp
+  8008c7:	53                   	push   %ebx
+  8008c8:	83 ec 10             	sub    $0x10,%esp
+  8008cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008ce:	53                   	push   %ebx
+  8008cf:	e8 91 ff ff ff       	call   800865 <strlen>
+  8008d4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008d7:	ff 75 0c             	push   0xc(%ebp)
+  8008da:	01 d8                	add    %ebx,%eax
+  8008dc:	50                   	push   %eax
+  8008dd:	e8 be ff ff ff       	call   8008a0 <strcpy>
+	return dst;
+}
+  8008e2:	89 d8                	mov    %ebx,%eax
+  8008e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e7:	c9                   	leave
+  8008e8:	c3                   	ret
+
+008008e9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008e9:	55                   	push   %ebp
+  8008ea:	89 e5                	mov    %esp,%ebp
+  8008ec:	56                   	push   %esi
+  8008ed:	53                   	push   %ebx
+  8008ee:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008f4:	89 f3                	mov    %esi,%ebx
+  8008f6:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008f9:	89 f0                	mov    %esi,%eax
+  8008fb:	eb 0f                	jmp    80090c <strncpy+0x23>
+		*dst++ = *src;
+  8008fd:	83 c0 01             	add    $0x1,%eax
+  800900:	0f b6 0a             	movzbl (%edx),%ecx
+  800903:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800906:	80 f9 01             	cmp    $0x1,%cl
+  800909:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80090c:	39 d8                	cmp    %ebx,%eax
+  80090e:	75 ed                	jne    8008fd <strncpy+0x14>
+	}
+	return ret;
+}
+  800910:	89 f0                	mov    %esi,%eax
+  800912:	5b                   	pop    %ebx
+  800913:	5e                   	pop    %esi
+  800914:	5d                   	pop    %ebp
+  800915:	c3                   	ret
+
+00800916 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800916:	55                   	push   %ebp
+  800917:	89 e5                	mov    %esp,%ebp
+  800919:	56                   	push   %esi
+  80091a:	53                   	push   %ebx
+  80091b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80091e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800921:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800924:	89 f0                	mov    %esi,%eax
+  800926:	85 d2                	test   %edx,%edx
+  800928:	74 21                	je     80094b <strlcpy+0x35>
+  80092a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80092e:	89 f2                	mov    %esi,%edx
+  800930:	eb 09                	jmp    80093b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800932:	83 c1 01             	add    $0x1,%ecx
+  800935:	83 c2 01             	add    $0x1,%edx
+  800938:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80093b:	39 c2                	cmp    %eax,%edx
+  80093d:	74 09                	je     800948 <strlcpy+0x32>
+  80093f:	0f b6 19             	movzbl (%ecx),%ebx
+  800942:	84 db                	test   %bl,%bl
+  800944:	75 ec                	jne    800932 <strlcpy+0x1c>
+  800946:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800948:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80094b:	29 f0                	sub    %esi,%eax
+}
+  80094d:	5b                   	pop    %ebx
+  80094e:	5e                   	pop    %esi
+  80094f:	5d                   	pop    %ebp
+  800950:	c3                   	ret
+
+00800951 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800951:	55                   	push   %ebp
+  800952:	89 e5                	mov    %esp,%ebp
+  800954:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800957:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80095a:	eb 06                	jmp    800962 <strcmp+0x11>
+		p++, q++;
+  80095c:	83 c1 01             	add    $0x1,%ecx
+  80095f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800962:	0f b6 01             	movzbl (%ecx),%eax
+  800965:	84 c0                	test   %al,%al
+  800967:	74 04                	je     80096d <strcmp+0x1c>
+  800969:	3a 02                	cmp    (%edx),%al
+  80096b:	74 ef                	je     80095c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80096d:	0f b6 c0             	movzbl %al,%eax
+  800970:	0f b6 12             	movzbl (%edx),%edx
+  800973:	29 d0                	sub    %edx,%eax
+}
+  800975:	5d                   	pop    %ebp
+  800976:	c3                   	ret
+
+00800977 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800977:	55                   	push   %ebp
+  800978:	89 e5                	mov    %esp,%ebp
+  80097a:	53                   	push   %ebx
+  80097b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800981:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800984:	eb 09                	jmp    80098f <strncmp+0x18>
+		n--, p++, q++;
+  800986:	83 ea 01             	sub    $0x1,%edx
+  800989:	83 c0 01             	add    $0x1,%eax
+  80098c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80098f:	85 d2                	test   %edx,%edx
+  800991:	74 18                	je     8009ab <strncmp+0x34>
+  800993:	0f b6 18             	movzbl (%eax),%ebx
+  800996:	84 db                	test   %bl,%bl
+  800998:	74 04                	je     80099e <strncmp+0x27>
+  80099a:	3a 19                	cmp    (%ecx),%bl
+  80099c:	74 e8                	je     800986 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80099e:	0f b6 00             	movzbl (%eax),%eax
+  8009a1:	0f b6 11             	movzbl (%ecx),%edx
+  8009a4:	29 d0                	sub    %edx,%eax
+}
+  8009a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009a9:	c9                   	leave
+  8009aa:	c3                   	ret
+		return 0;
+  8009ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b0:	eb f4                	jmp    8009a6 <strncmp+0x2f>
+
+008009b2 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009b2:	55                   	push   %ebp
+  8009b3:	89 e5                	mov    %esp,%ebp
+  8009b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009bc:	eb 03                	jmp    8009c1 <strchr+0xf>
+  8009be:	83 c0 01             	add    $0x1,%eax
+  8009c1:	0f b6 10             	movzbl (%eax),%edx
+  8009c4:	84 d2                	test   %dl,%dl
+  8009c6:	74 06                	je     8009ce <strchr+0x1c>
+		if (*s == c)
+  8009c8:	38 ca                	cmp    %cl,%dl
+  8009ca:	75 f2                	jne    8009be <strchr+0xc>
+  8009cc:	eb 05                	jmp    8009d3 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009d3:	5d                   	pop    %ebp
+  8009d4:	c3                   	ret
+
+008009d5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009d5:	55                   	push   %ebp
+  8009d6:	89 e5                	mov    %esp,%ebp
+  8009d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009db:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009df:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009e2:	38 ca                	cmp    %cl,%dl
+  8009e4:	74 09                	je     8009ef <strfind+0x1a>
+  8009e6:	84 d2                	test   %dl,%dl
+  8009e8:	74 05                	je     8009ef <strfind+0x1a>
+	for (; *s; s++)
+  8009ea:	83 c0 01             	add    $0x1,%eax
+  8009ed:	eb f0                	jmp    8009df <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009ef:	5d                   	pop    %ebp
+  8009f0:	c3                   	ret
+
+008009f1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009f1:	55                   	push   %ebp
+  8009f2:	89 e5                	mov    %esp,%ebp
+  8009f4:	57                   	push   %edi
+  8009f5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009f8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009fb:	85 c9                	test   %ecx,%ecx
+  8009fd:	74 20                	je     800a1f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009ff:	89 f8                	mov    %edi,%eax
+  800a01:	09 c8                	or     %ecx,%eax
+  800a03:	a8 03                	test   $0x3,%al
+  800a05:	75 12                	jne    800a19 <memset+0x28>
+		c &= 0xFF;
+  800a07:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a0b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a11:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a14:	fc                   	cld
+  800a15:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a17:	eb 06                	jmp    800a1f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a1c:	fc                   	cld
+  800a1d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a1f:	89 f8                	mov    %edi,%eax
+  800a21:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a24:	c9                   	leave
+  800a25:	c3                   	ret
+
+00800a26 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a26:	55                   	push   %ebp
+  800a27:	89 e5                	mov    %esp,%ebp
+  800a29:	57                   	push   %edi
+  800a2a:	56                   	push   %esi
+  800a2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a31:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a34:	39 c6                	cmp    %eax,%esi
+  800a36:	73 32                	jae    800a6a <memmove+0x44>
+  800a38:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a3b:	39 d0                	cmp    %edx,%eax
+  800a3d:	73 2b                	jae    800a6a <memmove+0x44>
+		s += n;
+		d += n;
+  800a3f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a42:	89 d6                	mov    %edx,%esi
+  800a44:	09 fe                	or     %edi,%esi
+  800a46:	09 ce                	or     %ecx,%esi
+  800a48:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a4e:	75 0e                	jne    800a5e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a50:	83 ef 04             	sub    $0x4,%edi
+  800a53:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a56:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a59:	fd                   	std
+  800a5a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a5c:	eb 09                	jmp    800a67 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a5e:	83 ef 01             	sub    $0x1,%edi
+  800a61:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a64:	fd                   	std
+  800a65:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a67:	fc                   	cld
+  800a68:	eb 1a                	jmp    800a84 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a6a:	89 f2                	mov    %esi,%edx
+  800a6c:	09 c2                	or     %eax,%edx
+  800a6e:	09 ca                	or     %ecx,%edx
+  800a70:	f6 c2 03             	test   $0x3,%dl
+  800a73:	75 0a                	jne    800a7f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a75:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a78:	89 c7                	mov    %eax,%edi
+  800a7a:	fc                   	cld
+  800a7b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a7d:	eb 05                	jmp    800a84 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a7f:	89 c7                	mov    %eax,%edi
+  800a81:	fc                   	cld
+  800a82:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a84:	5e                   	pop    %esi
+  800a85:	5f                   	pop    %edi
+  800a86:	5d                   	pop    %ebp
+  800a87:	c3                   	ret
+
+00800a88 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a88:	55                   	push   %ebp
+  800a89:	89 e5                	mov    %esp,%ebp
+  800a8b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a8e:	ff 75 10             	push   0x10(%ebp)
+  800a91:	ff 75 0c             	push   0xc(%ebp)
+  800a94:	ff 75 08             	push   0x8(%ebp)
+  800a97:	e8 8a ff ff ff       	call   800a26 <memmove>
+}
+  800a9c:	c9                   	leave
+  800a9d:	c3                   	ret
+
+00800a9e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a9e:	55                   	push   %ebp
+  800a9f:	89 e5                	mov    %esp,%ebp
+  800aa1:	56                   	push   %esi
+  800aa2:	53                   	push   %ebx
+  800aa3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800aa9:	89 c6                	mov    %eax,%esi
+  800aab:	03 75 10             	add    0x10(%ebp),%esi
+  800aae:	eb 06                	jmp    800ab6 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ab0:	83 c0 01             	add    $0x1,%eax
+  800ab3:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ab6:	39 f0                	cmp    %esi,%eax
+  800ab8:	74 14                	je     800ace <memcmp+0x30>
+		if (*s1 != *s2)
+  800aba:	0f b6 08             	movzbl (%eax),%ecx
+  800abd:	0f b6 1a             	movzbl (%edx),%ebx
+  800ac0:	38 d9                	cmp    %bl,%cl
+  800ac2:	74 ec                	je     800ab0 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ac4:	0f b6 c1             	movzbl %cl,%eax
+  800ac7:	0f b6 db             	movzbl %bl,%ebx
+  800aca:	29 d8                	sub    %ebx,%eax
+  800acc:	eb 05                	jmp    800ad3 <memcmp+0x35>
+	}
+
+	return 0;
+  800ace:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ad3:	5b                   	pop    %ebx
+  800ad4:	5e                   	pop    %esi
+  800ad5:	5d                   	pop    %ebp
+  800ad6:	c3                   	ret
+
+00800ad7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	8b 45 08             	mov    0x8(%ebp),%eax
+  800add:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ae0:	89 c2                	mov    %eax,%edx
+  800ae2:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ae5:	eb 03                	jmp    800aea <memfind+0x13>
+  800ae7:	83 c0 01             	add    $0x1,%eax
+  800aea:	39 d0                	cmp    %edx,%eax
+  800aec:	73 04                	jae    800af2 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800aee:	38 08                	cmp    %cl,(%eax)
+  800af0:	75 f5                	jne    800ae7 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800af2:	5d                   	pop    %ebp
+  800af3:	c3                   	ret
+
+00800af4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800af4:	55                   	push   %ebp
+  800af5:	89 e5                	mov    %esp,%ebp
+  800af7:	57                   	push   %edi
+  800af8:	56                   	push   %esi
+  800af9:	53                   	push   %ebx
+  800afa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800afd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b00:	eb 03                	jmp    800b05 <strtol+0x11>
+		s++;
+  800b02:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b05:	0f b6 02             	movzbl (%edx),%eax
+  800b08:	3c 20                	cmp    $0x20,%al
+  800b0a:	74 f6                	je     800b02 <strtol+0xe>
+  800b0c:	3c 09                	cmp    $0x9,%al
+  800b0e:	74 f2                	je     800b02 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b10:	3c 2b                	cmp    $0x2b,%al
+  800b12:	74 2a                	je     800b3e <strtol+0x4a>
+	int neg = 0;
+  800b14:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b19:	3c 2d                	cmp    $0x2d,%al
+  800b1b:	74 2b                	je     800b48 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b1d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b23:	75 0f                	jne    800b34 <strtol+0x40>
+  800b25:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b28:	74 28                	je     800b52 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b2a:	85 db                	test   %ebx,%ebx
+  800b2c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b31:	0f 44 d8             	cmove  %eax,%ebx
+  800b34:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b39:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b3c:	eb 46                	jmp    800b84 <strtol+0x90>
+		s++;
+  800b3e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b41:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b46:	eb d5                	jmp    800b1d <strtol+0x29>
+		s++, neg = 1;
+  800b48:	83 c2 01             	add    $0x1,%edx
+  800b4b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b50:	eb cb                	jmp    800b1d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b52:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b56:	74 0e                	je     800b66 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b58:	85 db                	test   %ebx,%ebx
+  800b5a:	75 d8                	jne    800b34 <strtol+0x40>
+		s++, base = 8;
+  800b5c:	83 c2 01             	add    $0x1,%edx
+  800b5f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b64:	eb ce                	jmp    800b34 <strtol+0x40>
+		s += 2, base = 16;
+  800b66:	83 c2 02             	add    $0x2,%edx
+  800b69:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b6e:	eb c4                	jmp    800b34 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b70:	0f be c0             	movsbl %al,%eax
+  800b73:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b76:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b79:	7d 3a                	jge    800bb5 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b7b:	83 c2 01             	add    $0x1,%edx
+  800b7e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b82:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b84:	0f b6 02             	movzbl (%edx),%eax
+  800b87:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b8a:	89 f3                	mov    %esi,%ebx
+  800b8c:	80 fb 09             	cmp    $0x9,%bl
+  800b8f:	76 df                	jbe    800b70 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b91:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b94:	89 f3                	mov    %esi,%ebx
+  800b96:	80 fb 19             	cmp    $0x19,%bl
+  800b99:	77 08                	ja     800ba3 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b9b:	0f be c0             	movsbl %al,%eax
+  800b9e:	83 e8 57             	sub    $0x57,%eax
+  800ba1:	eb d3                	jmp    800b76 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ba3:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ba6:	89 f3                	mov    %esi,%ebx
+  800ba8:	80 fb 19             	cmp    $0x19,%bl
+  800bab:	77 08                	ja     800bb5 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bad:	0f be c0             	movsbl %al,%eax
+  800bb0:	83 e8 37             	sub    $0x37,%eax
+  800bb3:	eb c1                	jmp    800b76 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bb5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bb9:	74 05                	je     800bc0 <strtol+0xcc>
+		*endptr = (char *) s;
+  800bbb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bbe:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800bc0:	89 c8                	mov    %ecx,%eax
+  800bc2:	f7 d8                	neg    %eax
+  800bc4:	85 ff                	test   %edi,%edi
+  800bc6:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bc9:	89 c8                	mov    %ecx,%eax
+  800bcb:	5b                   	pop    %ebx
+  800bcc:	5e                   	pop    %esi
+  800bcd:	5f                   	pop    %edi
+  800bce:	5d                   	pop    %ebp
+  800bcf:	c3                   	ret
+
+00800bd0 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800bd0:	55                   	push   %ebp
+  800bd1:	89 e5                	mov    %esp,%ebp
+  800bd3:	57                   	push   %edi
+  800bd4:	56                   	push   %esi
+  800bd5:	53                   	push   %ebx
+  800bd6:	83 ec 0c             	sub    $0xc,%esp
+  800bd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800bdc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bdf:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800be2:	85 ff                	test   %edi,%edi
+  800be4:	74 16                	je     800bfc <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800be6:	83 ec 04             	sub    $0x4,%esp
+  800be9:	56                   	push   %esi
+  800bea:	6a 00                	push   $0x0
+  800bec:	53                   	push   %ebx
+  800bed:	e8 02 ff ff ff       	call   800af4 <strtol>
+  800bf2:	89 07                	mov    %eax,(%edi)
+  800bf4:	83 c4 10             	add    $0x10,%esp
+  800bf7:	eb 03                	jmp    800bfc <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800bf9:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800bfc:	0f b6 03             	movzbl (%ebx),%eax
+  800bff:	3c 20                	cmp    $0x20,%al
+  800c01:	74 f6                	je     800bf9 <strisl+0x29>
+  800c03:	3c 09                	cmp    $0x9,%al
+  800c05:	74 f2                	je     800bf9 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c07:	3c 2b                	cmp    $0x2b,%al
+  800c09:	74 23                	je     800c2e <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800c0b:	3c 2d                	cmp    $0x2d,%al
+  800c0d:	0f 94 c0             	sete   %al
+  800c10:	0f b6 c0             	movzbl %al,%eax
+  800c13:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c15:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800c1b:	75 41                	jne    800c5e <strisl+0x8e>
+  800c1d:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800c20:	74 11                	je     800c33 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c22:	85 f6                	test   %esi,%esi
+  800c24:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c29:	0f 44 f0             	cmove  %eax,%esi
+  800c2c:	eb 30                	jmp    800c5e <strisl+0x8e>
+		s++;
+  800c2e:	83 c3 01             	add    $0x1,%ebx
+  800c31:	eb e2                	jmp    800c15 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c33:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800c37:	74 0e                	je     800c47 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800c39:	85 f6                	test   %esi,%esi
+  800c3b:	75 21                	jne    800c5e <strisl+0x8e>
+		s++, base = 8;
+  800c3d:	83 c3 01             	add    $0x1,%ebx
+  800c40:	be 08 00 00 00       	mov    $0x8,%esi
+  800c45:	eb 17                	jmp    800c5e <strisl+0x8e>
+		s += 2, base = 16;
+  800c47:	83 c3 02             	add    $0x2,%ebx
+  800c4a:	be 10 00 00 00       	mov    $0x10,%esi
+  800c4f:	eb 0d                	jmp    800c5e <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c51:	0f be c0             	movsbl %al,%eax
+  800c54:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800c57:	39 f0                	cmp    %esi,%eax
+  800c59:	7d 38                	jge    800c93 <strisl+0xc3>
+			return 0;
+		s++;
+  800c5b:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800c5e:	0f b6 03             	movzbl (%ebx),%eax
+  800c61:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800c64:	80 fa 09             	cmp    $0x9,%dl
+  800c67:	76 e8                	jbe    800c51 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800c69:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800c6c:	80 fa 19             	cmp    $0x19,%dl
+  800c6f:	77 08                	ja     800c79 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800c71:	0f be c0             	movsbl %al,%eax
+  800c74:	83 e8 57             	sub    $0x57,%eax
+  800c77:	eb de                	jmp    800c57 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c79:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800c7c:	80 fa 19             	cmp    $0x19,%dl
+  800c7f:	77 08                	ja     800c89 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800c81:	0f be c0             	movsbl %al,%eax
+  800c84:	83 e8 37             	sub    $0x37,%eax
+  800c87:	eb ce                	jmp    800c57 <strisl+0x87>
+		else if (!*s)
+  800c89:	84 c0                	test   %al,%al
+  800c8b:	0f 94 c0             	sete   %al
+  800c8e:	0f b6 c0             	movzbl %al,%eax
+  800c91:	eb 05                	jmp    800c98 <strisl+0xc8>
+			return 0;
+  800c93:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800c98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9b:	5b                   	pop    %ebx
+  800c9c:	5e                   	pop    %esi
+  800c9d:	5f                   	pop    %edi
+  800c9e:	5d                   	pop    %ebp
+  800c9f:	c3                   	ret
+
+00800ca0 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800ca0:	55                   	push   %ebp
+  800ca1:	89 e5                	mov    %esp,%ebp
+  800ca3:	83 ec 10             	sub    $0x10,%esp
+  800ca6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800ca9:	89 c8                	mov    %ecx,%eax
+  800cab:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800cb0:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800cb3:	eb 0b                	jmp    800cc0 <touch_mem+0x20>
+		c = *(char *)page;
+  800cb5:	0f b6 10             	movzbl (%eax),%edx
+  800cb8:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800cbb:	05 00 10 00 00       	add    $0x1000,%eax
+  800cc0:	39 c8                	cmp    %ecx,%eax
+  800cc2:	72 f1                	jb     800cb5 <touch_mem+0x15>
+}
+  800cc4:	c9                   	leave
+  800cc5:	c3                   	ret
+
+00800cc6 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800cc6:	55                   	push   %ebp
+  800cc7:	89 e5                	mov    %esp,%ebp
+  800cc9:	57                   	push   %edi
+  800cca:	56                   	push   %esi
+  800ccb:	53                   	push   %ebx
+	touch_mem(s, len);
+  800ccc:	ff 75 0c             	push   0xc(%ebp)
+  800ccf:	ff 75 08             	push   0x8(%ebp)
+  800cd2:	e8 c9 ff ff ff       	call   800ca0 <touch_mem>
+	asm volatile("int %1\n"
+  800cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cdc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce2:	89 c3                	mov    %eax,%ebx
+  800ce4:	89 c7                	mov    %eax,%edi
+  800ce6:	89 c6                	mov    %eax,%esi
+  800ce8:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cea:	83 c4 08             	add    $0x8,%esp
+  800ced:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf0:	5b                   	pop    %ebx
+  800cf1:	5e                   	pop    %esi
+  800cf2:	5f                   	pop    %edi
+  800cf3:	5d                   	pop    %ebp
+  800cf4:	c3                   	ret
+
+00800cf5 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cf5:	55                   	push   %ebp
+  800cf6:	89 e5                	mov    %esp,%ebp
+  800cf8:	57                   	push   %edi
+  800cf9:	56                   	push   %esi
+  800cfa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cfb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d00:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d05:	89 d1                	mov    %edx,%ecx
+  800d07:	89 d3                	mov    %edx,%ebx
+  800d09:	89 d7                	mov    %edx,%edi
+  800d0b:	89 d6                	mov    %edx,%esi
+  800d0d:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d0f:	5b                   	pop    %ebx
+  800d10:	5e                   	pop    %esi
+  800d11:	5f                   	pop    %edi
+  800d12:	5d                   	pop    %ebp
+  800d13:	c3                   	ret
+
+00800d14 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d14:	55                   	push   %ebp
+  800d15:	89 e5                	mov    %esp,%ebp
+  800d17:	57                   	push   %edi
+  800d18:	56                   	push   %esi
+  800d19:	53                   	push   %ebx
+  800d1a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d25:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d2a:	89 cb                	mov    %ecx,%ebx
+  800d2c:	89 cf                	mov    %ecx,%edi
+  800d2e:	89 ce                	mov    %ecx,%esi
+  800d30:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d32:	85 c0                	test   %eax,%eax
+  800d34:	7f 08                	jg     800d3e <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d39:	5b                   	pop    %ebx
+  800d3a:	5e                   	pop    %esi
+  800d3b:	5f                   	pop    %edi
+  800d3c:	5d                   	pop    %ebp
+  800d3d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d3e:	83 ec 0c             	sub    $0xc,%esp
+  800d41:	50                   	push   %eax
+  800d42:	6a 03                	push   $0x3
+  800d44:	68 cb 2c 80 00       	push   $0x802ccb
+  800d49:	6a 23                	push   $0x23
+  800d4b:	68 e8 2c 80 00       	push   $0x802ce8
+  800d50:	e8 89 f4 ff ff       	call   8001de <_panic>
+
+00800d55 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d55:	55                   	push   %ebp
+  800d56:	89 e5                	mov    %esp,%ebp
+  800d58:	57                   	push   %edi
+  800d59:	56                   	push   %esi
+  800d5a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d60:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d65:	89 d1                	mov    %edx,%ecx
+  800d67:	89 d3                	mov    %edx,%ebx
+  800d69:	89 d7                	mov    %edx,%edi
+  800d6b:	89 d6                	mov    %edx,%esi
+  800d6d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d6f:	5b                   	pop    %ebx
+  800d70:	5e                   	pop    %esi
+  800d71:	5f                   	pop    %edi
+  800d72:	5d                   	pop    %ebp
+  800d73:	c3                   	ret
+
+00800d74 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d74:	55                   	push   %ebp
+  800d75:	89 e5                	mov    %esp,%ebp
+  800d77:	57                   	push   %edi
+  800d78:	56                   	push   %esi
+  800d79:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d84:	89 d1                	mov    %edx,%ecx
+  800d86:	89 d3                	mov    %edx,%ebx
+  800d88:	89 d7                	mov    %edx,%edi
+  800d8a:	89 d6                	mov    %edx,%esi
+  800d8c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d8e:	5b                   	pop    %ebx
+  800d8f:	5e                   	pop    %esi
+  800d90:	5f                   	pop    %edi
+  800d91:	5d                   	pop    %ebp
+  800d92:	c3                   	ret
+
+00800d93 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d93:	55                   	push   %ebp
+  800d94:	89 e5                	mov    %esp,%ebp
+  800d96:	57                   	push   %edi
+  800d97:	56                   	push   %esi
+  800d98:	53                   	push   %ebx
+  800d99:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d9c:	be 00 00 00 00       	mov    $0x0,%esi
+  800da1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da7:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800daf:	89 f7                	mov    %esi,%edi
+  800db1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800db3:	85 c0                	test   %eax,%eax
+  800db5:	7f 08                	jg     800dbf <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800db7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dba:	5b                   	pop    %ebx
+  800dbb:	5e                   	pop    %esi
+  800dbc:	5f                   	pop    %edi
+  800dbd:	5d                   	pop    %ebp
+  800dbe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dbf:	83 ec 0c             	sub    $0xc,%esp
+  800dc2:	50                   	push   %eax
+  800dc3:	6a 04                	push   $0x4
+  800dc5:	68 cb 2c 80 00       	push   $0x802ccb
+  800dca:	6a 23                	push   $0x23
+  800dcc:	68 e8 2c 80 00       	push   $0x802ce8
+  800dd1:	e8 08 f4 ff ff       	call   8001de <_panic>
+
+00800dd6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800dd6:	55                   	push   %ebp
+  800dd7:	89 e5                	mov    %esp,%ebp
+  800dd9:	57                   	push   %edi
+  800dda:	56                   	push   %esi
+  800ddb:	53                   	push   %ebx
+  800ddc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ddf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de5:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ded:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800df0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800df3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800df5:	85 c0                	test   %eax,%eax
+  800df7:	7f 08                	jg     800e01 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800df9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dfc:	5b                   	pop    %ebx
+  800dfd:	5e                   	pop    %esi
+  800dfe:	5f                   	pop    %edi
+  800dff:	5d                   	pop    %ebp
+  800e00:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e01:	83 ec 0c             	sub    $0xc,%esp
+  800e04:	50                   	push   %eax
+  800e05:	6a 05                	push   $0x5
+  800e07:	68 cb 2c 80 00       	push   $0x802ccb
+  800e0c:	6a 23                	push   $0x23
+  800e0e:	68 e8 2c 80 00       	push   $0x802ce8
+  800e13:	e8 c6 f3 ff ff       	call   8001de <_panic>
+
+00800e18 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e18:	55                   	push   %ebp
+  800e19:	89 e5                	mov    %esp,%ebp
+  800e1b:	57                   	push   %edi
+  800e1c:	56                   	push   %esi
+  800e1d:	53                   	push   %ebx
+  800e1e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e21:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e29:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e31:	89 df                	mov    %ebx,%edi
+  800e33:	89 de                	mov    %ebx,%esi
+  800e35:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e37:	85 c0                	test   %eax,%eax
+  800e39:	7f 08                	jg     800e43 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e3e:	5b                   	pop    %ebx
+  800e3f:	5e                   	pop    %esi
+  800e40:	5f                   	pop    %edi
+  800e41:	5d                   	pop    %ebp
+  800e42:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e43:	83 ec 0c             	sub    $0xc,%esp
+  800e46:	50                   	push   %eax
+  800e47:	6a 06                	push   $0x6
+  800e49:	68 cb 2c 80 00       	push   $0x802ccb
+  800e4e:	6a 23                	push   $0x23
+  800e50:	68 e8 2c 80 00       	push   $0x802ce8
+  800e55:	e8 84 f3 ff ff       	call   8001de <_panic>
+
+00800e5a <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800e5a:	55                   	push   %ebp
+  800e5b:	89 e5                	mov    %esp,%ebp
+  800e5d:	57                   	push   %edi
+  800e5e:	56                   	push   %esi
+  800e5f:	53                   	push   %ebx
+  800e60:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6e:	b8 18 00 00 00       	mov    $0x18,%eax
+  800e73:	89 df                	mov    %ebx,%edi
+  800e75:	89 de                	mov    %ebx,%esi
+  800e77:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e79:	85 c0                	test   %eax,%eax
+  800e7b:	7f 08                	jg     800e85 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e80:	5b                   	pop    %ebx
+  800e81:	5e                   	pop    %esi
+  800e82:	5f                   	pop    %edi
+  800e83:	5d                   	pop    %ebp
+  800e84:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e85:	83 ec 0c             	sub    $0xc,%esp
+  800e88:	50                   	push   %eax
+  800e89:	6a 18                	push   $0x18
+  800e8b:	68 cb 2c 80 00       	push   $0x802ccb
+  800e90:	6a 23                	push   $0x23
+  800e92:	68 e8 2c 80 00       	push   $0x802ce8
+  800e97:	e8 42 f3 ff ff       	call   8001de <_panic>
+
+00800e9c <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800e9c:	55                   	push   %ebp
+  800e9d:	89 e5                	mov    %esp,%ebp
+  800e9f:	57                   	push   %edi
+  800ea0:	56                   	push   %esi
+  800ea1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ea2:	be 00 00 00 00       	mov    $0x0,%esi
+  800ea7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eaa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ead:	b8 19 00 00 00       	mov    $0x19,%eax
+  800eb2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eb5:	89 f7                	mov    %esi,%edi
+  800eb7:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800eb9:	5b                   	pop    %ebx
+  800eba:	5e                   	pop    %esi
+  800ebb:	5f                   	pop    %edi
+  800ebc:	5d                   	pop    %ebp
+  800ebd:	c3                   	ret
+
+00800ebe <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800ebe:	55                   	push   %ebp
+  800ebf:	89 e5                	mov    %esp,%ebp
+  800ec1:	57                   	push   %edi
+  800ec2:	56                   	push   %esi
+  800ec3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ec4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eca:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ecf:	be 00 00 00 00       	mov    $0x0,%esi
+  800ed4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ed7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eda:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800edc:	5b                   	pop    %ebx
+  800edd:	5e                   	pop    %esi
+  800ede:	5f                   	pop    %edi
+  800edf:	5d                   	pop    %ebp
+  800ee0:	c3                   	ret
+
+00800ee1 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800ee1:	55                   	push   %ebp
+  800ee2:	89 e5                	mov    %esp,%ebp
+  800ee4:	57                   	push   %edi
+  800ee5:	56                   	push   %esi
+  800ee6:	53                   	push   %ebx
+  800ee7:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800eea:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800eed:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800ef3:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800ef6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efc:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f04:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f07:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f09:	85 c0                	test   %eax,%eax
+  800f0b:	7f 08                	jg     800f15 <sys_page_map_range+0x34>
+}
+  800f0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f10:	5b                   	pop    %ebx
+  800f11:	5e                   	pop    %esi
+  800f12:	5f                   	pop    %edi
+  800f13:	5d                   	pop    %ebp
+  800f14:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f15:	83 ec 0c             	sub    $0xc,%esp
+  800f18:	50                   	push   %eax
+  800f19:	6a 10                	push   $0x10
+  800f1b:	68 cb 2c 80 00       	push   $0x802ccb
+  800f20:	6a 23                	push   $0x23
+  800f22:	68 e8 2c 80 00       	push   $0x802ce8
+  800f27:	e8 b2 f2 ff ff       	call   8001de <_panic>
+
+00800f2c <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f2c:	55                   	push   %ebp
+  800f2d:	89 e5                	mov    %esp,%ebp
+  800f2f:	57                   	push   %edi
+  800f30:	56                   	push   %esi
+  800f31:	53                   	push   %ebx
+  800f32:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f35:	be 00 00 00 00       	mov    $0x0,%esi
+  800f3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f40:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f48:	89 f7                	mov    %esi,%edi
+  800f4a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f4c:	85 c0                	test   %eax,%eax
+  800f4e:	7f 08                	jg     800f58 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f53:	5b                   	pop    %ebx
+  800f54:	5e                   	pop    %esi
+  800f55:	5f                   	pop    %edi
+  800f56:	5d                   	pop    %ebp
+  800f57:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f58:	83 ec 0c             	sub    $0xc,%esp
+  800f5b:	50                   	push   %eax
+  800f5c:	6a 11                	push   $0x11
+  800f5e:	68 cb 2c 80 00       	push   $0x802ccb
+  800f63:	6a 23                	push   $0x23
+  800f65:	68 e8 2c 80 00       	push   $0x802ce8
+  800f6a:	e8 6f f2 ff ff       	call   8001de <_panic>
+
+00800f6f <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800f6f:	55                   	push   %ebp
+  800f70:	89 e5                	mov    %esp,%ebp
+  800f72:	57                   	push   %edi
+  800f73:	56                   	push   %esi
+  800f74:	53                   	push   %ebx
+  800f75:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f78:	be 00 00 00 00       	mov    $0x0,%esi
+  800f7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f83:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800f88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f8b:	89 f7                	mov    %esi,%edi
+  800f8d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f8f:	85 c0                	test   %eax,%eax
+  800f91:	7f 08                	jg     800f9b <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f96:	5b                   	pop    %ebx
+  800f97:	5e                   	pop    %esi
+  800f98:	5f                   	pop    %edi
+  800f99:	5d                   	pop    %ebp
+  800f9a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9b:	83 ec 0c             	sub    $0xc,%esp
+  800f9e:	50                   	push   %eax
+  800f9f:	6a 1b                	push   $0x1b
+  800fa1:	68 cb 2c 80 00       	push   $0x802ccb
+  800fa6:	6a 23                	push   $0x23
+  800fa8:	68 e8 2c 80 00       	push   $0x802ce8
+  800fad:	e8 2c f2 ff ff       	call   8001de <_panic>
+
+00800fb2 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800fb2:	55                   	push   %ebp
+  800fb3:	89 e5                	mov    %esp,%ebp
+  800fb5:	57                   	push   %edi
+  800fb6:	56                   	push   %esi
+  800fb7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fbd:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fc2:	89 d1                	mov    %edx,%ecx
+  800fc4:	89 d3                	mov    %edx,%ebx
+  800fc6:	89 d7                	mov    %edx,%edi
+  800fc8:	89 d6                	mov    %edx,%esi
+  800fca:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800fcc:	5b                   	pop    %ebx
+  800fcd:	5e                   	pop    %esi
+  800fce:	5f                   	pop    %edi
+  800fcf:	5d                   	pop    %ebp
+  800fd0:	c3                   	ret
+
+00800fd1 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800fd1:	55                   	push   %ebp
+  800fd2:	89 e5                	mov    %esp,%ebp
+  800fd4:	57                   	push   %edi
+  800fd5:	56                   	push   %esi
+  800fd6:	53                   	push   %ebx
+  800fd7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe5:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fea:	89 df                	mov    %ebx,%edi
+  800fec:	89 de                	mov    %ebx,%esi
+  800fee:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff0:	85 c0                	test   %eax,%eax
+  800ff2:	7f 08                	jg     800ffc <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ff4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff7:	5b                   	pop    %ebx
+  800ff8:	5e                   	pop    %esi
+  800ff9:	5f                   	pop    %edi
+  800ffa:	5d                   	pop    %ebp
+  800ffb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ffc:	83 ec 0c             	sub    $0xc,%esp
+  800fff:	50                   	push   %eax
+  801000:	6a 08                	push   $0x8
+  801002:	68 cb 2c 80 00       	push   $0x802ccb
+  801007:	6a 23                	push   $0x23
+  801009:	68 e8 2c 80 00       	push   $0x802ce8
+  80100e:	e8 cb f1 ff ff       	call   8001de <_panic>
+
+00801013 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801013:	55                   	push   %ebp
+  801014:	89 e5                	mov    %esp,%ebp
+  801016:	57                   	push   %edi
+  801017:	56                   	push   %esi
+  801018:	53                   	push   %ebx
+  801019:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  80101c:	6a 44                	push   $0x44
+  80101e:	ff 75 0c             	push   0xc(%ebp)
+  801021:	e8 7a fc ff ff       	call   800ca0 <touch_mem>
+	asm volatile("int %1\n"
+  801026:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801033:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801036:	89 df                	mov    %ebx,%edi
+  801038:	89 de                	mov    %ebx,%esi
+  80103a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80103c:	83 c4 08             	add    $0x8,%esp
+  80103f:	85 c0                	test   %eax,%eax
+  801041:	7f 08                	jg     80104b <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801043:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801046:	5b                   	pop    %ebx
+  801047:	5e                   	pop    %esi
+  801048:	5f                   	pop    %edi
+  801049:	5d                   	pop    %ebp
+  80104a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80104b:	83 ec 0c             	sub    $0xc,%esp
+  80104e:	50                   	push   %eax
+  80104f:	6a 09                	push   $0x9
+  801051:	68 cb 2c 80 00       	push   $0x802ccb
+  801056:	6a 23                	push   $0x23
+  801058:	68 e8 2c 80 00       	push   $0x802ce8
+  80105d:	e8 7c f1 ff ff       	call   8001de <_panic>
+
+00801062 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  801062:	55                   	push   %ebp
+  801063:	89 e5                	mov    %esp,%ebp
+  801065:	57                   	push   %edi
+  801066:	56                   	push   %esi
+  801067:	53                   	push   %ebx
+  801068:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80106b:	be 00 00 00 00       	mov    $0x0,%esi
+  801070:	8b 55 08             	mov    0x8(%ebp),%edx
+  801073:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801076:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80107b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80107e:	89 f7                	mov    %esi,%edi
+  801080:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801082:	85 c0                	test   %eax,%eax
+  801084:	7f 08                	jg     80108e <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  801086:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801089:	5b                   	pop    %ebx
+  80108a:	5e                   	pop    %esi
+  80108b:	5f                   	pop    %edi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80108e:	83 ec 0c             	sub    $0xc,%esp
+  801091:	50                   	push   %eax
+  801092:	6a 1a                	push   $0x1a
+  801094:	68 cb 2c 80 00       	push   $0x802ccb
+  801099:	6a 23                	push   $0x23
+  80109b:	68 e8 2c 80 00       	push   $0x802ce8
+  8010a0:	e8 39 f1 ff ff       	call   8001de <_panic>
+
+008010a5 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8010a5:	55                   	push   %ebp
+  8010a6:	89 e5                	mov    %esp,%ebp
+  8010a8:	57                   	push   %edi
+  8010a9:	56                   	push   %esi
+  8010aa:	53                   	push   %ebx
+  8010ab:	83 ec 0c             	sub    $0xc,%esp
+  8010ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8010b1:	89 d8                	mov    %ebx,%eax
+  8010b3:	c1 e0 05             	shl    $0x5,%eax
+  8010b6:	50                   	push   %eax
+  8010b7:	ff 75 0c             	push   0xc(%ebp)
+  8010ba:	e8 e1 fb ff ff       	call   800ca0 <touch_mem>
+	asm volatile("int %1\n"
+  8010bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cf:	89 f7                	mov    %esi,%edi
+  8010d1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010d3:	83 c4 08             	add    $0x8,%esp
+  8010d6:	85 c0                	test   %eax,%eax
+  8010d8:	7f 08                	jg     8010e2 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8010da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010dd:	5b                   	pop    %ebx
+  8010de:	5e                   	pop    %esi
+  8010df:	5f                   	pop    %edi
+  8010e0:	5d                   	pop    %ebp
+  8010e1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e2:	83 ec 0c             	sub    $0xc,%esp
+  8010e5:	50                   	push   %eax
+  8010e6:	6a 13                	push   $0x13
+  8010e8:	68 cb 2c 80 00       	push   $0x802ccb
+  8010ed:	6a 23                	push   $0x23
+  8010ef:	68 e8 2c 80 00       	push   $0x802ce8
+  8010f4:	e8 e5 f0 ff ff       	call   8001de <_panic>
+
+008010f9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010f9:	55                   	push   %ebp
+  8010fa:	89 e5                	mov    %esp,%ebp
+  8010fc:	57                   	push   %edi
+  8010fd:	56                   	push   %esi
+  8010fe:	53                   	push   %ebx
+  8010ff:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801102:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801107:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801112:	89 df                	mov    %ebx,%edi
+  801114:	89 de                	mov    %ebx,%esi
+  801116:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801118:	85 c0                	test   %eax,%eax
+  80111a:	7f 08                	jg     801124 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80111c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111f:	5b                   	pop    %ebx
+  801120:	5e                   	pop    %esi
+  801121:	5f                   	pop    %edi
+  801122:	5d                   	pop    %ebp
+  801123:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801124:	83 ec 0c             	sub    $0xc,%esp
+  801127:	50                   	push   %eax
+  801128:	6a 0a                	push   $0xa
+  80112a:	68 cb 2c 80 00       	push   $0x802ccb
+  80112f:	6a 23                	push   $0x23
+  801131:	68 e8 2c 80 00       	push   $0x802ce8
+  801136:	e8 a3 f0 ff ff       	call   8001de <_panic>
+
+0080113b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80113b:	55                   	push   %ebp
+  80113c:	89 e5                	mov    %esp,%ebp
+  80113e:	57                   	push   %edi
+  80113f:	56                   	push   %esi
+  801140:	53                   	push   %ebx
+  801141:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801144:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80114a:	76 1d                	jbe    801169 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80114c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801152:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801157:	be 01 00 00 00       	mov    $0x1,%esi
+  80115c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80115f:	cd 30                	int    $0x30
+}
+  801161:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801164:	5b                   	pop    %ebx
+  801165:	5e                   	pop    %esi
+  801166:	5f                   	pop    %edi
+  801167:	5d                   	pop    %ebp
+  801168:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801169:	68 00 10 00 00       	push   $0x1000
+  80116e:	53                   	push   %ebx
+  80116f:	e8 2c fb ff ff       	call   800ca0 <touch_mem>
+  801174:	83 c4 08             	add    $0x8,%esp
+  801177:	eb d3                	jmp    80114c <sys_ipc_send+0x11>
+
+00801179 <sys_ipc_send_pages>:
+{
+  801179:	55                   	push   %ebp
+  80117a:	89 e5                	mov    %esp,%ebp
+  80117c:	57                   	push   %edi
+  80117d:	56                   	push   %esi
+  80117e:	53                   	push   %ebx
+  80117f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801182:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801185:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80118b:	76 18                	jbe    8011a5 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80118d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801190:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801193:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801198:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80119b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  80119d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a0:	5b                   	pop    %ebx
+  8011a1:	5e                   	pop    %esi
+  8011a2:	5f                   	pop    %edi
+  8011a3:	5d                   	pop    %ebp
+  8011a4:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011a5:	89 f0                	mov    %esi,%eax
+  8011a7:	c1 e0 0c             	shl    $0xc,%eax
+  8011aa:	50                   	push   %eax
+  8011ab:	53                   	push   %ebx
+  8011ac:	e8 ef fa ff ff       	call   800ca0 <touch_mem>
+  8011b1:	83 c4 08             	add    $0x8,%esp
+  8011b4:	eb d7                	jmp    80118d <sys_ipc_send_pages+0x14>
+
+008011b6 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8011b6:	55                   	push   %ebp
+  8011b7:	89 e5                	mov    %esp,%ebp
+  8011b9:	57                   	push   %edi
+  8011ba:	56                   	push   %esi
+  8011bb:	53                   	push   %ebx
+  8011bc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ca:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011cf:	89 df                	mov    %ebx,%edi
+  8011d1:	89 de                	mov    %ebx,%esi
+  8011d3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011d5:	85 c0                	test   %eax,%eax
+  8011d7:	7f 08                	jg     8011e1 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8011d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011dc:	5b                   	pop    %ebx
+  8011dd:	5e                   	pop    %esi
+  8011de:	5f                   	pop    %edi
+  8011df:	5d                   	pop    %ebp
+  8011e0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e1:	83 ec 0c             	sub    $0xc,%esp
+  8011e4:	50                   	push   %eax
+  8011e5:	6a 0d                	push   $0xd
+  8011e7:	68 cb 2c 80 00       	push   $0x802ccb
+  8011ec:	6a 23                	push   $0x23
+  8011ee:	68 e8 2c 80 00       	push   $0x802ce8
+  8011f3:	e8 e6 ef ff ff       	call   8001de <_panic>
+
+008011f8 <sys_ipc_recv>:
+{
+  8011f8:	55                   	push   %ebp
+  8011f9:	89 e5                	mov    %esp,%ebp
+  8011fb:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8011fe:	6a 01                	push   $0x1
+  801200:	ff 75 08             	push   0x8(%ebp)
+  801203:	e8 ae ff ff ff       	call   8011b6 <sys_ipc_recv_pages>
+}
+  801208:	c9                   	leave
+  801209:	c3                   	ret
+
+0080120a <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80120a:	55                   	push   %ebp
+  80120b:	89 e5                	mov    %esp,%ebp
+  80120d:	57                   	push   %edi
+  80120e:	56                   	push   %esi
+  80120f:	53                   	push   %ebx
+  801210:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801213:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801216:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801219:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80121f:	77 04                	ja     801225 <sys_ipc_call+0x1b>
+  801221:	85 f6                	test   %esi,%esi
+  801223:	75 15                	jne    80123a <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801225:	8b 55 08             	mov    0x8(%ebp),%edx
+  801228:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801230:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801232:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801235:	5b                   	pop    %ebx
+  801236:	5e                   	pop    %esi
+  801237:	5f                   	pop    %edi
+  801238:	5d                   	pop    %ebp
+  801239:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80123a:	89 f8                	mov    %edi,%eax
+  80123c:	c1 e0 0c             	shl    $0xc,%eax
+  80123f:	50                   	push   %eax
+  801240:	53                   	push   %ebx
+  801241:	e8 5a fa ff ff       	call   800ca0 <touch_mem>
+  801246:	83 c4 08             	add    $0x8,%esp
+  801249:	eb da                	jmp    801225 <sys_ipc_call+0x1b>
+
+0080124b <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80124b:	55                   	push   %ebp
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	57                   	push   %edi
+  80124f:	56                   	push   %esi
+  801250:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801251:	8b 55 08             	mov    0x8(%ebp),%edx
+  801254:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801257:	b8 15 00 00 00       	mov    $0x15,%eax
+  80125c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80125f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801262:	8b 75 18             	mov    0x18(%ebp),%esi
+  801265:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801267:	5b                   	pop    %ebx
+  801268:	5e                   	pop    %esi
+  801269:	5f                   	pop    %edi
+  80126a:	5d                   	pop    %ebp
+  80126b:	c3                   	ret
+
+0080126c <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  80126c:	55                   	push   %ebp
+  80126d:	89 e5                	mov    %esp,%ebp
+  80126f:	57                   	push   %edi
+  801270:	56                   	push   %esi
+  801271:	53                   	push   %ebx
+  801272:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801275:	6a 04                	push   $0x4
+  801277:	ff 75 08             	push   0x8(%ebp)
+  80127a:	e8 21 fa ff ff       	call   800ca0 <touch_mem>
+	asm volatile("int %1\n"
+  80127f:	be 00 00 00 00       	mov    $0x0,%esi
+  801284:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801287:	b8 16 00 00 00       	mov    $0x16,%eax
+  80128c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801292:	89 f7                	mov    %esi,%edi
+  801294:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801296:	83 c4 08             	add    $0x8,%esp
+  801299:	85 c0                	test   %eax,%eax
+  80129b:	7f 08                	jg     8012a5 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  80129d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a0:	5b                   	pop    %ebx
+  8012a1:	5e                   	pop    %esi
+  8012a2:	5f                   	pop    %edi
+  8012a3:	5d                   	pop    %ebp
+  8012a4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012a5:	83 ec 0c             	sub    $0xc,%esp
+  8012a8:	50                   	push   %eax
+  8012a9:	6a 16                	push   $0x16
+  8012ab:	68 cb 2c 80 00       	push   $0x802ccb
+  8012b0:	6a 23                	push   $0x23
+  8012b2:	68 e8 2c 80 00       	push   $0x802ce8
+  8012b7:	e8 22 ef ff ff       	call   8001de <_panic>
+
+008012bc <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8012bc:	55                   	push   %ebp
+  8012bd:	89 e5                	mov    %esp,%ebp
+  8012bf:	57                   	push   %edi
+  8012c0:	56                   	push   %esi
+  8012c1:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8012c2:	6a 04                	push   $0x4
+  8012c4:	ff 75 08             	push   0x8(%ebp)
+  8012c7:	e8 d4 f9 ff ff       	call   800ca0 <touch_mem>
+	asm volatile("int %1\n"
+  8012cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d4:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012dc:	89 df                	mov    %ebx,%edi
+  8012de:	89 de                	mov    %ebx,%esi
+  8012e0:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8012e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e5:	5b                   	pop    %ebx
+  8012e6:	5e                   	pop    %esi
+  8012e7:	5f                   	pop    %edi
+  8012e8:	5d                   	pop    %ebp
+  8012e9:	c3                   	ret
+
+008012ea <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8012ea:	55                   	push   %ebp
+  8012eb:	89 e5                	mov    %esp,%ebp
+  8012ed:	57                   	push   %edi
+  8012ee:	56                   	push   %esi
+  8012ef:	53                   	push   %ebx
+  8012f0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801300:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801305:	89 df                	mov    %ebx,%edi
+  801307:	89 de                	mov    %ebx,%esi
+  801309:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80130b:	85 c0                	test   %eax,%eax
+  80130d:	7f 08                	jg     801317 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80130f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801312:	5b                   	pop    %ebx
+  801313:	5e                   	pop    %esi
+  801314:	5f                   	pop    %edi
+  801315:	5d                   	pop    %ebp
+  801316:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801317:	83 ec 0c             	sub    $0xc,%esp
+  80131a:	50                   	push   %eax
+  80131b:	6a 0e                	push   $0xe
+  80131d:	68 cb 2c 80 00       	push   $0x802ccb
+  801322:	6a 23                	push   $0x23
+  801324:	68 e8 2c 80 00       	push   $0x802ce8
+  801329:	e8 b0 ee ff ff       	call   8001de <_panic>
+
+0080132e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80132e:	55                   	push   %ebp
+  80132f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801331:	8b 45 08             	mov    0x8(%ebp),%eax
+  801334:	05 00 00 00 30       	add    $0x30000000,%eax
+  801339:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80133c:	5d                   	pop    %ebp
+  80133d:	c3                   	ret
+
+0080133e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80133e:	55                   	push   %ebp
+  80133f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801341:	8b 45 08             	mov    0x8(%ebp),%eax
+  801344:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801349:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80134e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801353:	5d                   	pop    %ebp
+  801354:	c3                   	ret
+
+00801355 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801355:	55                   	push   %ebp
+  801356:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801358:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  80135d:	a8 01                	test   $0x1,%al
+  80135f:	74 3c                	je     80139d <fd_alloc+0x48>
+  801361:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801366:	89 c2                	mov    %eax,%edx
+  801368:	c1 ea 0c             	shr    $0xc,%edx
+  80136b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801372:	89 c1                	mov    %eax,%ecx
+  801374:	05 00 10 00 00       	add    $0x1000,%eax
+  801379:	f6 c2 01             	test   $0x1,%dl
+  80137c:	74 13                	je     801391 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80137e:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801383:	75 e1                	jne    801366 <fd_alloc+0x11>
+  801385:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80138a:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80138f:	eb 05                	jmp    801396 <fd_alloc+0x41>
+			return 0;
+  801391:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801396:	8b 55 08             	mov    0x8(%ebp),%edx
+  801399:	89 0a                	mov    %ecx,(%edx)
+}
+  80139b:	5d                   	pop    %ebp
+  80139c:	c3                   	ret
+  80139d:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8013a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a7:	eb ed                	jmp    801396 <fd_alloc+0x41>
+
+008013a9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013a9:	55                   	push   %ebp
+  8013aa:	89 e5                	mov    %esp,%ebp
+  8013ac:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8013af:	83 f8 1f             	cmp    $0x1f,%eax
+  8013b2:	77 30                	ja     8013e4 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8013b4:	c1 e0 0c             	shl    $0xc,%eax
+  8013b7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8013bc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8013c2:	f6 c2 01             	test   $0x1,%dl
+  8013c5:	74 24                	je     8013eb <fd_lookup+0x42>
+  8013c7:	89 c2                	mov    %eax,%edx
+  8013c9:	c1 ea 0c             	shr    $0xc,%edx
+  8013cc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013d3:	f6 c2 01             	test   $0x1,%dl
+  8013d6:	74 1a                	je     8013f2 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8013d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013db:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8013dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013e2:	5d                   	pop    %ebp
+  8013e3:	c3                   	ret
+		return -E_INVAL;
+  8013e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013e9:	eb f7                	jmp    8013e2 <fd_lookup+0x39>
+		return -E_INVAL;
+  8013eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013f0:	eb f0                	jmp    8013e2 <fd_lookup+0x39>
+  8013f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013f7:	eb e9                	jmp    8013e2 <fd_lookup+0x39>
+
+008013f9 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013f9:	55                   	push   %ebp
+  8013fa:	89 e5                	mov    %esp,%ebp
+  8013fc:	53                   	push   %ebx
+  8013fd:	83 ec 04             	sub    $0x4,%esp
+  801400:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801403:	b8 74 2d 80 00       	mov    $0x802d74,%eax
+  801408:	8b 18                	mov    (%eax),%ebx
+  80140a:	85 db                	test   %ebx,%ebx
+  80140c:	74 0e                	je     80141c <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  80140e:	83 c0 04             	add    $0x4,%eax
+  801411:	39 13                	cmp    %edx,(%ebx)
+  801413:	75 f3                	jne    801408 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801415:	b8 00 00 00 00       	mov    $0x0,%eax
+  80141a:	eb 1f                	jmp    80143b <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80141c:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801421:	8b 40 48             	mov    0x48(%eax),%eax
+  801424:	83 ec 04             	sub    $0x4,%esp
+  801427:	52                   	push   %edx
+  801428:	50                   	push   %eax
+  801429:	68 f8 2c 80 00       	push   $0x802cf8
+  80142e:	e8 86 ee ff ff       	call   8002b9 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801433:	83 c4 10             	add    $0x10,%esp
+  801436:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80143b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80143e:	89 1a                	mov    %ebx,(%edx)
+}
+  801440:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801443:	c9                   	leave
+  801444:	c3                   	ret
+
+00801445 <fd_close>:
+{
+  801445:	55                   	push   %ebp
+  801446:	89 e5                	mov    %esp,%ebp
+  801448:	57                   	push   %edi
+  801449:	56                   	push   %esi
+  80144a:	53                   	push   %ebx
+  80144b:	83 ec 24             	sub    $0x24,%esp
+  80144e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801451:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801454:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801457:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801458:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80145e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801461:	50                   	push   %eax
+  801462:	e8 42 ff ff ff       	call   8013a9 <fd_lookup>
+  801467:	89 c3                	mov    %eax,%ebx
+  801469:	83 c4 10             	add    $0x10,%esp
+  80146c:	85 c0                	test   %eax,%eax
+  80146e:	78 05                	js     801475 <fd_close+0x30>
+	    || fd != fd2)
+  801470:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801473:	74 16                	je     80148b <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801475:	89 f8                	mov    %edi,%eax
+  801477:	84 c0                	test   %al,%al
+  801479:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801481:	89 d8                	mov    %ebx,%eax
+  801483:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801486:	5b                   	pop    %ebx
+  801487:	5e                   	pop    %esi
+  801488:	5f                   	pop    %edi
+  801489:	5d                   	pop    %ebp
+  80148a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80148b:	83 ec 08             	sub    $0x8,%esp
+  80148e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801491:	50                   	push   %eax
+  801492:	ff 36                	push   (%esi)
+  801494:	e8 60 ff ff ff       	call   8013f9 <dev_lookup>
+  801499:	89 c3                	mov    %eax,%ebx
+  80149b:	83 c4 10             	add    $0x10,%esp
+  80149e:	85 c0                	test   %eax,%eax
+  8014a0:	78 1a                	js     8014bc <fd_close+0x77>
+		if (dev->dev_close)
+  8014a2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014a5:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8014a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8014ad:	85 c0                	test   %eax,%eax
+  8014af:	74 0b                	je     8014bc <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8014b1:	83 ec 0c             	sub    $0xc,%esp
+  8014b4:	56                   	push   %esi
+  8014b5:	ff d0                	call   *%eax
+  8014b7:	89 c3                	mov    %eax,%ebx
+  8014b9:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8014bc:	83 ec 08             	sub    $0x8,%esp
+  8014bf:	56                   	push   %esi
+  8014c0:	6a 00                	push   $0x0
+  8014c2:	e8 51 f9 ff ff       	call   800e18 <sys_page_unmap>
+	return r;
+  8014c7:	83 c4 10             	add    $0x10,%esp
+  8014ca:	eb b5                	jmp    801481 <fd_close+0x3c>
+
+008014cc <close>:
+
+int
+close(int fdnum)
+{
+  8014cc:	55                   	push   %ebp
+  8014cd:	89 e5                	mov    %esp,%ebp
+  8014cf:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d5:	50                   	push   %eax
+  8014d6:	ff 75 08             	push   0x8(%ebp)
+  8014d9:	e8 cb fe ff ff       	call   8013a9 <fd_lookup>
+  8014de:	83 c4 10             	add    $0x10,%esp
+  8014e1:	85 c0                	test   %eax,%eax
+  8014e3:	79 02                	jns    8014e7 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8014e5:	c9                   	leave
+  8014e6:	c3                   	ret
+		return fd_close(fd, 1);
+  8014e7:	83 ec 08             	sub    $0x8,%esp
+  8014ea:	6a 01                	push   $0x1
+  8014ec:	ff 75 f4             	push   -0xc(%ebp)
+  8014ef:	e8 51 ff ff ff       	call   801445 <fd_close>
+  8014f4:	83 c4 10             	add    $0x10,%esp
+  8014f7:	eb ec                	jmp    8014e5 <close+0x19>
+
+008014f9 <close_all>:
+
+void
+close_all(void)
+{
+  8014f9:	55                   	push   %ebp
+  8014fa:	89 e5                	mov    %esp,%ebp
+  8014fc:	53                   	push   %ebx
+  8014fd:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801500:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801505:	83 ec 0c             	sub    $0xc,%esp
+  801508:	53                   	push   %ebx
+  801509:	e8 be ff ff ff       	call   8014cc <close>
+	for (i = 0; i < MAXFD; i++)
+  80150e:	83 c3 01             	add    $0x1,%ebx
+  801511:	83 c4 10             	add    $0x10,%esp
+  801514:	83 fb 20             	cmp    $0x20,%ebx
+  801517:	75 ec                	jne    801505 <close_all+0xc>
+}
+  801519:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80151c:	c9                   	leave
+  80151d:	c3                   	ret
+
+0080151e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80151e:	55                   	push   %ebp
+  80151f:	89 e5                	mov    %esp,%ebp
+  801521:	57                   	push   %edi
+  801522:	56                   	push   %esi
+  801523:	53                   	push   %ebx
+  801524:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801527:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80152a:	50                   	push   %eax
+  80152b:	ff 75 08             	push   0x8(%ebp)
+  80152e:	e8 76 fe ff ff       	call   8013a9 <fd_lookup>
+  801533:	89 c3                	mov    %eax,%ebx
+  801535:	83 c4 10             	add    $0x10,%esp
+  801538:	85 c0                	test   %eax,%eax
+  80153a:	78 7f                	js     8015bb <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80153c:	83 ec 0c             	sub    $0xc,%esp
+  80153f:	ff 75 0c             	push   0xc(%ebp)
+  801542:	e8 85 ff ff ff       	call   8014cc <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801547:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80154a:	c1 e6 0c             	shl    $0xc,%esi
+  80154d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801553:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801556:	89 3c 24             	mov    %edi,(%esp)
+  801559:	e8 e0 fd ff ff       	call   80133e <fd2data>
+  80155e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801560:	89 34 24             	mov    %esi,(%esp)
+  801563:	e8 d6 fd ff ff       	call   80133e <fd2data>
+  801568:	83 c4 10             	add    $0x10,%esp
+  80156b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80156e:	89 d8                	mov    %ebx,%eax
+  801570:	c1 e8 16             	shr    $0x16,%eax
+  801573:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80157a:	a8 01                	test   $0x1,%al
+  80157c:	74 11                	je     80158f <dup+0x71>
+  80157e:	89 d8                	mov    %ebx,%eax
+  801580:	c1 e8 0c             	shr    $0xc,%eax
+  801583:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80158a:	f6 c2 01             	test   $0x1,%dl
+  80158d:	75 36                	jne    8015c5 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80158f:	89 f8                	mov    %edi,%eax
+  801591:	c1 e8 0c             	shr    $0xc,%eax
+  801594:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80159b:	83 ec 0c             	sub    $0xc,%esp
+  80159e:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015a3:	50                   	push   %eax
+  8015a4:	56                   	push   %esi
+  8015a5:	6a 00                	push   $0x0
+  8015a7:	57                   	push   %edi
+  8015a8:	6a 00                	push   $0x0
+  8015aa:	e8 27 f8 ff ff       	call   800dd6 <sys_page_map>
+  8015af:	89 c3                	mov    %eax,%ebx
+  8015b1:	83 c4 20             	add    $0x20,%esp
+  8015b4:	85 c0                	test   %eax,%eax
+  8015b6:	78 33                	js     8015eb <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8015b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8015bb:	89 d8                	mov    %ebx,%eax
+  8015bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c0:	5b                   	pop    %ebx
+  8015c1:	5e                   	pop    %esi
+  8015c2:	5f                   	pop    %edi
+  8015c3:	5d                   	pop    %ebp
+  8015c4:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8015c5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015cc:	83 ec 0c             	sub    $0xc,%esp
+  8015cf:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015d4:	50                   	push   %eax
+  8015d5:	ff 75 d4             	push   -0x2c(%ebp)
+  8015d8:	6a 00                	push   $0x0
+  8015da:	53                   	push   %ebx
+  8015db:	6a 00                	push   $0x0
+  8015dd:	e8 f4 f7 ff ff       	call   800dd6 <sys_page_map>
+  8015e2:	89 c3                	mov    %eax,%ebx
+  8015e4:	83 c4 20             	add    $0x20,%esp
+  8015e7:	85 c0                	test   %eax,%eax
+  8015e9:	79 a4                	jns    80158f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8015eb:	83 ec 08             	sub    $0x8,%esp
+  8015ee:	56                   	push   %esi
+  8015ef:	6a 00                	push   $0x0
+  8015f1:	e8 22 f8 ff ff       	call   800e18 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8015f6:	83 c4 08             	add    $0x8,%esp
+  8015f9:	ff 75 d4             	push   -0x2c(%ebp)
+  8015fc:	6a 00                	push   $0x0
+  8015fe:	e8 15 f8 ff ff       	call   800e18 <sys_page_unmap>
+	return r;
+  801603:	83 c4 10             	add    $0x10,%esp
+  801606:	eb b3                	jmp    8015bb <dup+0x9d>
+
+00801608 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801608:	55                   	push   %ebp
+  801609:	89 e5                	mov    %esp,%ebp
+  80160b:	56                   	push   %esi
+  80160c:	53                   	push   %ebx
+  80160d:	83 ec 18             	sub    $0x18,%esp
+  801610:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801613:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801616:	50                   	push   %eax
+  801617:	56                   	push   %esi
+  801618:	e8 8c fd ff ff       	call   8013a9 <fd_lookup>
+  80161d:	83 c4 10             	add    $0x10,%esp
+  801620:	85 c0                	test   %eax,%eax
+  801622:	78 3c                	js     801660 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801624:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801627:	83 ec 08             	sub    $0x8,%esp
+  80162a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80162d:	50                   	push   %eax
+  80162e:	ff 33                	push   (%ebx)
+  801630:	e8 c4 fd ff ff       	call   8013f9 <dev_lookup>
+  801635:	83 c4 10             	add    $0x10,%esp
+  801638:	85 c0                	test   %eax,%eax
+  80163a:	78 24                	js     801660 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80163c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80163f:	83 e0 03             	and    $0x3,%eax
+  801642:	83 f8 01             	cmp    $0x1,%eax
+  801645:	74 20                	je     801667 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801647:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80164a:	8b 40 08             	mov    0x8(%eax),%eax
+  80164d:	85 c0                	test   %eax,%eax
+  80164f:	74 37                	je     801688 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801651:	83 ec 04             	sub    $0x4,%esp
+  801654:	ff 75 10             	push   0x10(%ebp)
+  801657:	ff 75 0c             	push   0xc(%ebp)
+  80165a:	53                   	push   %ebx
+  80165b:	ff d0                	call   *%eax
+  80165d:	83 c4 10             	add    $0x10,%esp
+}
+  801660:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801663:	5b                   	pop    %ebx
+  801664:	5e                   	pop    %esi
+  801665:	5d                   	pop    %ebp
+  801666:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801667:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80166c:	8b 40 48             	mov    0x48(%eax),%eax
+  80166f:	83 ec 04             	sub    $0x4,%esp
+  801672:	56                   	push   %esi
+  801673:	50                   	push   %eax
+  801674:	68 39 2d 80 00       	push   $0x802d39
+  801679:	e8 3b ec ff ff       	call   8002b9 <cprintf>
+		return -E_INVAL;
+  80167e:	83 c4 10             	add    $0x10,%esp
+  801681:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801686:	eb d8                	jmp    801660 <read+0x58>
+		return -E_NOT_SUPP;
+  801688:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80168d:	eb d1                	jmp    801660 <read+0x58>
+
+0080168f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80168f:	55                   	push   %ebp
+  801690:	89 e5                	mov    %esp,%ebp
+  801692:	57                   	push   %edi
+  801693:	56                   	push   %esi
+  801694:	53                   	push   %ebx
+  801695:	83 ec 0c             	sub    $0xc,%esp
+  801698:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80169b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80169e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a3:	eb 02                	jmp    8016a7 <readn+0x18>
+  8016a5:	01 c3                	add    %eax,%ebx
+  8016a7:	39 f3                	cmp    %esi,%ebx
+  8016a9:	73 21                	jae    8016cc <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016ab:	83 ec 04             	sub    $0x4,%esp
+  8016ae:	89 f0                	mov    %esi,%eax
+  8016b0:	29 d8                	sub    %ebx,%eax
+  8016b2:	50                   	push   %eax
+  8016b3:	89 d8                	mov    %ebx,%eax
+  8016b5:	03 45 0c             	add    0xc(%ebp),%eax
+  8016b8:	50                   	push   %eax
+  8016b9:	57                   	push   %edi
+  8016ba:	e8 49 ff ff ff       	call   801608 <read>
+		if (m < 0)
+  8016bf:	83 c4 10             	add    $0x10,%esp
+  8016c2:	85 c0                	test   %eax,%eax
+  8016c4:	78 04                	js     8016ca <readn+0x3b>
+			return m;
+		if (m == 0)
+  8016c6:	75 dd                	jne    8016a5 <readn+0x16>
+  8016c8:	eb 02                	jmp    8016cc <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016ca:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8016cc:	89 d8                	mov    %ebx,%eax
+  8016ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d1:	5b                   	pop    %ebx
+  8016d2:	5e                   	pop    %esi
+  8016d3:	5f                   	pop    %edi
+  8016d4:	5d                   	pop    %ebp
+  8016d5:	c3                   	ret
+
+008016d6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8016d6:	55                   	push   %ebp
+  8016d7:	89 e5                	mov    %esp,%ebp
+  8016d9:	56                   	push   %esi
+  8016da:	53                   	push   %ebx
+  8016db:	83 ec 18             	sub    $0x18,%esp
+  8016de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016e1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016e4:	50                   	push   %eax
+  8016e5:	53                   	push   %ebx
+  8016e6:	e8 be fc ff ff       	call   8013a9 <fd_lookup>
+  8016eb:	83 c4 10             	add    $0x10,%esp
+  8016ee:	85 c0                	test   %eax,%eax
+  8016f0:	78 37                	js     801729 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016f2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016f5:	83 ec 08             	sub    $0x8,%esp
+  8016f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016fb:	50                   	push   %eax
+  8016fc:	ff 36                	push   (%esi)
+  8016fe:	e8 f6 fc ff ff       	call   8013f9 <dev_lookup>
+  801703:	83 c4 10             	add    $0x10,%esp
+  801706:	85 c0                	test   %eax,%eax
+  801708:	78 1f                	js     801729 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80170a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80170e:	74 20                	je     801730 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801710:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801713:	8b 40 0c             	mov    0xc(%eax),%eax
+  801716:	85 c0                	test   %eax,%eax
+  801718:	74 37                	je     801751 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80171a:	83 ec 04             	sub    $0x4,%esp
+  80171d:	ff 75 10             	push   0x10(%ebp)
+  801720:	ff 75 0c             	push   0xc(%ebp)
+  801723:	56                   	push   %esi
+  801724:	ff d0                	call   *%eax
+  801726:	83 c4 10             	add    $0x10,%esp
+}
+  801729:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80172c:	5b                   	pop    %ebx
+  80172d:	5e                   	pop    %esi
+  80172e:	5d                   	pop    %ebp
+  80172f:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801730:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801735:	8b 40 48             	mov    0x48(%eax),%eax
+  801738:	83 ec 04             	sub    $0x4,%esp
+  80173b:	53                   	push   %ebx
+  80173c:	50                   	push   %eax
+  80173d:	68 55 2d 80 00       	push   $0x802d55
+  801742:	e8 72 eb ff ff       	call   8002b9 <cprintf>
+		return -E_INVAL;
+  801747:	83 c4 10             	add    $0x10,%esp
+  80174a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80174f:	eb d8                	jmp    801729 <write+0x53>
+		return -E_NOT_SUPP;
+  801751:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801756:	eb d1                	jmp    801729 <write+0x53>
+
+00801758 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801758:	55                   	push   %ebp
+  801759:	89 e5                	mov    %esp,%ebp
+  80175b:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80175e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801761:	50                   	push   %eax
+  801762:	ff 75 08             	push   0x8(%ebp)
+  801765:	e8 3f fc ff ff       	call   8013a9 <fd_lookup>
+  80176a:	83 c4 10             	add    $0x10,%esp
+  80176d:	85 c0                	test   %eax,%eax
+  80176f:	78 0e                	js     80177f <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801771:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801774:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801777:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80177a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80177f:	c9                   	leave
+  801780:	c3                   	ret
+
+00801781 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801781:	55                   	push   %ebp
+  801782:	89 e5                	mov    %esp,%ebp
+  801784:	56                   	push   %esi
+  801785:	53                   	push   %ebx
+  801786:	83 ec 18             	sub    $0x18,%esp
+  801789:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80178c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80178f:	50                   	push   %eax
+  801790:	53                   	push   %ebx
+  801791:	e8 13 fc ff ff       	call   8013a9 <fd_lookup>
+  801796:	83 c4 10             	add    $0x10,%esp
+  801799:	85 c0                	test   %eax,%eax
+  80179b:	78 34                	js     8017d1 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80179d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017a0:	83 ec 08             	sub    $0x8,%esp
+  8017a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017a6:	50                   	push   %eax
+  8017a7:	ff 36                	push   (%esi)
+  8017a9:	e8 4b fc ff ff       	call   8013f9 <dev_lookup>
+  8017ae:	83 c4 10             	add    $0x10,%esp
+  8017b1:	85 c0                	test   %eax,%eax
+  8017b3:	78 1c                	js     8017d1 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017b5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017b9:	74 1d                	je     8017d8 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8017bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017be:	8b 40 18             	mov    0x18(%eax),%eax
+  8017c1:	85 c0                	test   %eax,%eax
+  8017c3:	74 34                	je     8017f9 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8017c5:	83 ec 08             	sub    $0x8,%esp
+  8017c8:	ff 75 0c             	push   0xc(%ebp)
+  8017cb:	56                   	push   %esi
+  8017cc:	ff d0                	call   *%eax
+  8017ce:	83 c4 10             	add    $0x10,%esp
+}
+  8017d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017d4:	5b                   	pop    %ebx
+  8017d5:	5e                   	pop    %esi
+  8017d6:	5d                   	pop    %ebp
+  8017d7:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8017d8:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8017dd:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017e0:	83 ec 04             	sub    $0x4,%esp
+  8017e3:	53                   	push   %ebx
+  8017e4:	50                   	push   %eax
+  8017e5:	68 18 2d 80 00       	push   $0x802d18
+  8017ea:	e8 ca ea ff ff       	call   8002b9 <cprintf>
+		return -E_INVAL;
+  8017ef:	83 c4 10             	add    $0x10,%esp
+  8017f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017f7:	eb d8                	jmp    8017d1 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017f9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017fe:	eb d1                	jmp    8017d1 <ftruncate+0x50>
+
+00801800 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801800:	55                   	push   %ebp
+  801801:	89 e5                	mov    %esp,%ebp
+  801803:	56                   	push   %esi
+  801804:	53                   	push   %ebx
+  801805:	83 ec 18             	sub    $0x18,%esp
+  801808:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80180b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80180e:	50                   	push   %eax
+  80180f:	ff 75 08             	push   0x8(%ebp)
+  801812:	e8 92 fb ff ff       	call   8013a9 <fd_lookup>
+  801817:	83 c4 10             	add    $0x10,%esp
+  80181a:	85 c0                	test   %eax,%eax
+  80181c:	78 49                	js     801867 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80181e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801821:	83 ec 08             	sub    $0x8,%esp
+  801824:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801827:	50                   	push   %eax
+  801828:	ff 36                	push   (%esi)
+  80182a:	e8 ca fb ff ff       	call   8013f9 <dev_lookup>
+  80182f:	83 c4 10             	add    $0x10,%esp
+  801832:	85 c0                	test   %eax,%eax
+  801834:	78 31                	js     801867 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801836:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801839:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80183d:	74 2f                	je     80186e <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80183f:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801842:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801849:	00 00 00 
+	stat->st_isdir = 0;
+  80184c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801853:	00 00 00 
+	stat->st_dev = dev;
+  801856:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80185c:	83 ec 08             	sub    $0x8,%esp
+  80185f:	53                   	push   %ebx
+  801860:	56                   	push   %esi
+  801861:	ff 50 14             	call   *0x14(%eax)
+  801864:	83 c4 10             	add    $0x10,%esp
+}
+  801867:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80186a:	5b                   	pop    %ebx
+  80186b:	5e                   	pop    %esi
+  80186c:	5d                   	pop    %ebp
+  80186d:	c3                   	ret
+		return -E_NOT_SUPP;
+  80186e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801873:	eb f2                	jmp    801867 <fstat+0x67>
+
+00801875 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801875:	55                   	push   %ebp
+  801876:	89 e5                	mov    %esp,%ebp
+  801878:	56                   	push   %esi
+  801879:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80187a:	83 ec 08             	sub    $0x8,%esp
+  80187d:	6a 00                	push   $0x0
+  80187f:	ff 75 08             	push   0x8(%ebp)
+  801882:	e8 bc 02 00 00       	call   801b43 <open>
+  801887:	89 c3                	mov    %eax,%ebx
+  801889:	83 c4 10             	add    $0x10,%esp
+  80188c:	85 c0                	test   %eax,%eax
+  80188e:	78 1b                	js     8018ab <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801890:	83 ec 08             	sub    $0x8,%esp
+  801893:	ff 75 0c             	push   0xc(%ebp)
+  801896:	50                   	push   %eax
+  801897:	e8 64 ff ff ff       	call   801800 <fstat>
+  80189c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80189e:	89 1c 24             	mov    %ebx,(%esp)
+  8018a1:	e8 26 fc ff ff       	call   8014cc <close>
+	return r;
+  8018a6:	83 c4 10             	add    $0x10,%esp
+  8018a9:	89 f3                	mov    %esi,%ebx
+}
+  8018ab:	89 d8                	mov    %ebx,%eax
+  8018ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b0:	5b                   	pop    %ebx
+  8018b1:	5e                   	pop    %esi
+  8018b2:	5d                   	pop    %ebp
+  8018b3:	c3                   	ret
+
+008018b4 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  8018b4:	55                   	push   %ebp
+  8018b5:	89 e5                	mov    %esp,%ebp
+  8018b7:	57                   	push   %edi
+  8018b8:	56                   	push   %esi
+  8018b9:	53                   	push   %ebx
+  8018ba:	83 ec 0c             	sub    $0xc,%esp
+  8018bd:	89 c7                	mov    %eax,%edi
+  8018bf:	89 d3                	mov    %edx,%ebx
+  8018c1:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8018c3:	83 3d 04 40 80 00 00 	cmpl   $0x0,0x804004
+  8018ca:	74 2d                	je     8018f9 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018cc:	6a 07                	push   $0x7
+  8018ce:	68 00 50 80 00       	push   $0x805000
+  8018d3:	57                   	push   %edi
+  8018d4:	ff 35 04 40 80 00    	push   0x804004
+  8018da:	e8 91 0c 00 00       	call   802570 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  8018df:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8018e6:	6a 00                	push   $0x0
+  8018e8:	56                   	push   %esi
+  8018e9:	53                   	push   %ebx
+  8018ea:	6a 00                	push   $0x0
+  8018ec:	e8 31 0b 00 00       	call   802422 <ipc_recv_pages>
+}
+  8018f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018f4:	5b                   	pop    %ebx
+  8018f5:	5e                   	pop    %esi
+  8018f6:	5f                   	pop    %edi
+  8018f7:	5d                   	pop    %ebp
+  8018f8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018f9:	83 ec 0c             	sub    $0xc,%esp
+  8018fc:	6a 01                	push   $0x1
+  8018fe:	e8 62 0d 00 00       	call   802665 <ipc_find_env>
+  801903:	a3 04 40 80 00       	mov    %eax,0x804004
+  801908:	83 c4 10             	add    $0x10,%esp
+  80190b:	eb bf                	jmp    8018cc <fsipc_pages+0x18>
+
+0080190d <fsipc>:
+{
+  80190d:	55                   	push   %ebp
+  80190e:	89 e5                	mov    %esp,%ebp
+  801910:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801913:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801918:	e8 97 ff ff ff       	call   8018b4 <fsipc_pages>
+}
+  80191d:	c9                   	leave
+  80191e:	c3                   	ret
+
+0080191f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80191f:	55                   	push   %ebp
+  801920:	89 e5                	mov    %esp,%ebp
+  801922:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801925:	8b 45 08             	mov    0x8(%ebp),%eax
+  801928:	8b 40 0c             	mov    0xc(%eax),%eax
+  80192b:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  801930:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801933:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801938:	ba 00 00 00 00       	mov    $0x0,%edx
+  80193d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801942:	e8 c6 ff ff ff       	call   80190d <fsipc>
+}
+  801947:	c9                   	leave
+  801948:	c3                   	ret
+
+00801949 <devfile_flush>:
+{
+  801949:	55                   	push   %ebp
+  80194a:	89 e5                	mov    %esp,%ebp
+  80194c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80194f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801952:	8b 40 0c             	mov    0xc(%eax),%eax
+  801955:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80195a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80195f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801964:	e8 a4 ff ff ff       	call   80190d <fsipc>
+}
+  801969:	c9                   	leave
+  80196a:	c3                   	ret
+
+0080196b <devfile_stat>:
+{
+  80196b:	55                   	push   %ebp
+  80196c:	89 e5                	mov    %esp,%ebp
+  80196e:	53                   	push   %ebx
+  80196f:	83 ec 04             	sub    $0x4,%esp
+  801972:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801975:	8b 45 08             	mov    0x8(%ebp),%eax
+  801978:	8b 40 0c             	mov    0xc(%eax),%eax
+  80197b:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801980:	ba 00 00 00 00       	mov    $0x0,%edx
+  801985:	b8 05 00 00 00       	mov    $0x5,%eax
+  80198a:	e8 7e ff ff ff       	call   80190d <fsipc>
+  80198f:	85 c0                	test   %eax,%eax
+  801991:	78 2c                	js     8019bf <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801993:	83 ec 08             	sub    $0x8,%esp
+  801996:	68 00 50 80 00       	push   $0x805000
+  80199b:	53                   	push   %ebx
+  80199c:	e8 ff ee ff ff       	call   8008a0 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8019a1:	a1 80 50 80 00       	mov    0x805080,%eax
+  8019a6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019ac:	a1 84 50 80 00       	mov    0x805084,%eax
+  8019b1:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8019b7:	83 c4 10             	add    $0x10,%esp
+  8019ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019c2:	c9                   	leave
+  8019c3:	c3                   	ret
+
+008019c4 <devfile_write>:
+{
+  8019c4:	55                   	push   %ebp
+  8019c5:	89 e5                	mov    %esp,%ebp
+  8019c7:	83 ec 0c             	sub    $0xc,%esp
+  8019ca:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8019cd:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8019d2:	39 d0                	cmp    %edx,%eax
+  8019d4:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8019d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019da:	8b 52 0c             	mov    0xc(%edx),%edx
+  8019dd:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  8019e3:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8019e8:	50                   	push   %eax
+  8019e9:	ff 75 0c             	push   0xc(%ebp)
+  8019ec:	68 08 50 80 00       	push   $0x805008
+  8019f1:	e8 30 f0 ff ff       	call   800a26 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8019f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019fb:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a00:	e8 08 ff ff ff       	call   80190d <fsipc>
+}
+  801a05:	c9                   	leave
+  801a06:	c3                   	ret
+
+00801a07 <devfile_read>:
+{
+  801a07:	55                   	push   %ebp
+  801a08:	89 e5                	mov    %esp,%ebp
+  801a0a:	57                   	push   %edi
+  801a0b:	56                   	push   %esi
+  801a0c:	53                   	push   %ebx
+  801a0d:	83 ec 1c             	sub    $0x1c,%esp
+  801a10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a13:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a16:	89 fe                	mov    %edi,%esi
+  801a18:	c1 ee 0c             	shr    $0xc,%esi
+  801a1b:	b8 20 00 00 00       	mov    $0x20,%eax
+  801a20:	39 c6                	cmp    %eax,%esi
+  801a22:	0f 47 f0             	cmova  %eax,%esi
+  801a25:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a2d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801a30:	eb 14                	jmp    801a46 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a32:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801a39:	05 00 10 00 00       	add    $0x1000,%eax
+  801a3e:	f6 c6 06             	test   $0x6,%dh
+  801a41:	75 42                	jne    801a85 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a43:	83 c1 01             	add    $0x1,%ecx
+  801a46:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801a49:	39 f1                	cmp    %esi,%ecx
+  801a4b:	0f 84 95 00 00 00    	je     801ae6 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801a51:	89 c2                	mov    %eax,%edx
+  801a53:	c1 ea 16             	shr    $0x16,%edx
+  801a56:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a5d:	f6 c2 01             	test   $0x1,%dl
+  801a60:	74 23                	je     801a85 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801a62:	89 c2                	mov    %eax,%edx
+  801a64:	c1 ea 0c             	shr    $0xc,%edx
+  801a67:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801a6e:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801a74:	74 0f                	je     801a85 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801a76:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801a7d:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801a83:	75 ad                	jne    801a32 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801a85:	85 c9                	test   %ecx,%ecx
+  801a87:	74 11                	je     801a9a <devfile_read+0x93>
+  801a89:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801a90:	75 08                	jne    801a9a <devfile_read+0x93>
+  801a92:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801a98:	74 50                	je     801aea <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a9a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a9d:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  801aa2:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801aa8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aad:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ab2:	e8 56 fe ff ff       	call   80190d <fsipc>
+  801ab7:	89 c6                	mov    %eax,%esi
+  801ab9:	85 c0                	test   %eax,%eax
+  801abb:	78 1f                	js     801adc <devfile_read+0xd5>
+	assert(r <= n);
+  801abd:	39 c7                	cmp    %eax,%edi
+  801abf:	72 50                	jb     801b11 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801ac1:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ac6:	7f 62                	jg     801b2a <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801ac8:	83 ec 04             	sub    $0x4,%esp
+  801acb:	50                   	push   %eax
+  801acc:	68 00 50 80 00       	push   $0x805000
+  801ad1:	ff 75 0c             	push   0xc(%ebp)
+  801ad4:	e8 4d ef ff ff       	call   800a26 <memmove>
+	return r;
+  801ad9:	83 c4 10             	add    $0x10,%esp
+}
+  801adc:	89 f0                	mov    %esi,%eax
+  801ade:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ae1:	5b                   	pop    %ebx
+  801ae2:	5e                   	pop    %esi
+  801ae3:	5f                   	pop    %edi
+  801ae4:	5d                   	pop    %ebp
+  801ae5:	c3                   	ret
+  801ae6:	89 f1                	mov    %esi,%ecx
+  801ae8:	eb 9b                	jmp    801a85 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801aea:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801aed:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801af2:	89 c8                	mov    %ecx,%eax
+  801af4:	c1 e0 0c             	shl    $0xc,%eax
+  801af7:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801afc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801aff:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801b04:	e8 ab fd ff ff       	call   8018b4 <fsipc_pages>
+  801b09:	89 c6                	mov    %eax,%esi
+  801b0b:	85 c0                	test   %eax,%eax
+  801b0d:	78 8b                	js     801a9a <devfile_read+0x93>
+  801b0f:	eb cb                	jmp    801adc <devfile_read+0xd5>
+	assert(r <= n);
+  801b11:	68 84 2d 80 00       	push   $0x802d84
+  801b16:	68 8b 2d 80 00       	push   $0x802d8b
+  801b1b:	68 a0 00 00 00       	push   $0xa0
+  801b20:	68 a0 2d 80 00       	push   $0x802da0
+  801b25:	e8 b4 e6 ff ff       	call   8001de <_panic>
+	assert(r <= PGSIZE);
+  801b2a:	68 ab 2d 80 00       	push   $0x802dab
+  801b2f:	68 8b 2d 80 00       	push   $0x802d8b
+  801b34:	68 a1 00 00 00       	push   $0xa1
+  801b39:	68 a0 2d 80 00       	push   $0x802da0
+  801b3e:	e8 9b e6 ff ff       	call   8001de <_panic>
+
+00801b43 <open>:
+{
+  801b43:	55                   	push   %ebp
+  801b44:	89 e5                	mov    %esp,%ebp
+  801b46:	56                   	push   %esi
+  801b47:	53                   	push   %ebx
+  801b48:	83 ec 1c             	sub    $0x1c,%esp
+  801b4b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801b4e:	56                   	push   %esi
+  801b4f:	e8 11 ed ff ff       	call   800865 <strlen>
+  801b54:	83 c4 10             	add    $0x10,%esp
+  801b57:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b5c:	7f 6c                	jg     801bca <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801b5e:	83 ec 0c             	sub    $0xc,%esp
+  801b61:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b64:	50                   	push   %eax
+  801b65:	e8 eb f7 ff ff       	call   801355 <fd_alloc>
+  801b6a:	89 c3                	mov    %eax,%ebx
+  801b6c:	83 c4 10             	add    $0x10,%esp
+  801b6f:	85 c0                	test   %eax,%eax
+  801b71:	78 3c                	js     801baf <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801b73:	83 ec 08             	sub    $0x8,%esp
+  801b76:	56                   	push   %esi
+  801b77:	68 00 50 80 00       	push   $0x805000
+  801b7c:	e8 1f ed ff ff       	call   8008a0 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b84:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b89:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b8c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b91:	e8 77 fd ff ff       	call   80190d <fsipc>
+  801b96:	89 c3                	mov    %eax,%ebx
+  801b98:	83 c4 10             	add    $0x10,%esp
+  801b9b:	85 c0                	test   %eax,%eax
+  801b9d:	78 19                	js     801bb8 <open+0x75>
+	return fd2num(fd);
+  801b9f:	83 ec 0c             	sub    $0xc,%esp
+  801ba2:	ff 75 f4             	push   -0xc(%ebp)
+  801ba5:	e8 84 f7 ff ff       	call   80132e <fd2num>
+  801baa:	89 c3                	mov    %eax,%ebx
+  801bac:	83 c4 10             	add    $0x10,%esp
+}
+  801baf:	89 d8                	mov    %ebx,%eax
+  801bb1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bb4:	5b                   	pop    %ebx
+  801bb5:	5e                   	pop    %esi
+  801bb6:	5d                   	pop    %ebp
+  801bb7:	c3                   	ret
+		fd_close(fd, 0);
+  801bb8:	83 ec 08             	sub    $0x8,%esp
+  801bbb:	6a 00                	push   $0x0
+  801bbd:	ff 75 f4             	push   -0xc(%ebp)
+  801bc0:	e8 80 f8 ff ff       	call   801445 <fd_close>
+		return r;
+  801bc5:	83 c4 10             	add    $0x10,%esp
+  801bc8:	eb e5                	jmp    801baf <open+0x6c>
+		return -E_BAD_PATH;
+  801bca:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801bcf:	eb de                	jmp    801baf <open+0x6c>
+
+00801bd1 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801bd1:	55                   	push   %ebp
+  801bd2:	89 e5                	mov    %esp,%ebp
+  801bd4:	53                   	push   %ebx
+  801bd5:	83 ec 10             	sub    $0x10,%esp
+  801bd8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801bdb:	53                   	push   %ebx
+  801bdc:	e8 84 ec ff ff       	call   800865 <strlen>
+  801be1:	83 c4 10             	add    $0x10,%esp
+  801be4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801be9:	7f 25                	jg     801c10 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801beb:	83 ec 08             	sub    $0x8,%esp
+  801bee:	53                   	push   %ebx
+  801bef:	68 00 50 80 00       	push   $0x805000
+  801bf4:	e8 a7 ec ff ff       	call   8008a0 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801bf9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bfe:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c03:	e8 05 fd ff ff       	call   80190d <fsipc>
+  801c08:	83 c4 10             	add    $0x10,%esp
+}
+  801c0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c0e:	c9                   	leave
+  801c0f:	c3                   	ret
+		return -E_BAD_PATH;
+  801c10:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801c15:	eb f4                	jmp    801c0b <remove+0x3a>
+
+00801c17 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c17:	55                   	push   %ebp
+  801c18:	89 e5                	mov    %esp,%ebp
+  801c1a:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c22:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c27:	e8 e1 fc ff ff       	call   80190d <fsipc>
+}
+  801c2c:	c9                   	leave
+  801c2d:	c3                   	ret
+
+00801c2e <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801c2e:	55                   	push   %ebp
+  801c2f:	89 e5                	mov    %esp,%ebp
+  801c31:	53                   	push   %ebx
+  801c32:	83 ec 04             	sub    $0x4,%esp
+  801c35:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801c38:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c3d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c42:	e8 c6 fc ff ff       	call   80190d <fsipc>
+  801c47:	85 c0                	test   %eax,%eax
+  801c49:	78 3c                	js     801c87 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801c4b:	a1 00 50 80 00       	mov    0x805000,%eax
+  801c50:	89 03                	mov    %eax,(%ebx)
+  801c52:	a1 04 50 80 00       	mov    0x805004,%eax
+  801c57:	89 43 04             	mov    %eax,0x4(%ebx)
+  801c5a:	a1 08 50 80 00       	mov    0x805008,%eax
+  801c5f:	89 43 08             	mov    %eax,0x8(%ebx)
+  801c62:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801c67:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801c6a:	a1 10 50 80 00       	mov    0x805010,%eax
+  801c6f:	89 43 10             	mov    %eax,0x10(%ebx)
+  801c72:	a1 14 50 80 00       	mov    0x805014,%eax
+  801c77:	89 43 14             	mov    %eax,0x14(%ebx)
+  801c7a:	a1 18 50 80 00       	mov    0x805018,%eax
+  801c7f:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801c82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c8a:	c9                   	leave
+  801c8b:	c3                   	ret
+
+00801c8c <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801c8c:	55                   	push   %ebp
+  801c8d:	89 e5                	mov    %esp,%ebp
+  801c8f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801c92:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c95:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  801c9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c9f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801ca4:	e8 64 fc ff ff       	call   80190d <fsipc>
+}
+  801ca9:	c9                   	leave
+  801caa:	c3                   	ret
+
+00801cab <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  801cab:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801caf:	7f 01                	jg     801cb2 <writebuf+0x7>
+  801cb1:	c3                   	ret
+{
+  801cb2:	55                   	push   %ebp
+  801cb3:	89 e5                	mov    %esp,%ebp
+  801cb5:	53                   	push   %ebx
+  801cb6:	83 ec 08             	sub    $0x8,%esp
+  801cb9:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  801cbb:	ff 70 04             	push   0x4(%eax)
+  801cbe:	8d 40 10             	lea    0x10(%eax),%eax
+  801cc1:	50                   	push   %eax
+  801cc2:	ff 33                	push   (%ebx)
+  801cc4:	e8 0d fa ff ff       	call   8016d6 <write>
+		if (result > 0)
+  801cc9:	83 c4 10             	add    $0x10,%esp
+  801ccc:	85 c0                	test   %eax,%eax
+  801cce:	7e 03                	jle    801cd3 <writebuf+0x28>
+			b->result += result;
+  801cd0:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  801cd3:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801cd6:	74 0d                	je     801ce5 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  801cd8:	85 c0                	test   %eax,%eax
+  801cda:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cdf:	0f 4f c2             	cmovg  %edx,%eax
+  801ce2:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  801ce5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ce8:	c9                   	leave
+  801ce9:	c3                   	ret
+
+00801cea <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801cea:	55                   	push   %ebp
+  801ceb:	89 e5                	mov    %esp,%ebp
+  801ced:	53                   	push   %ebx
+  801cee:	83 ec 04             	sub    $0x4,%esp
+  801cf1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801cf4:	8b 53 04             	mov    0x4(%ebx),%edx
+  801cf7:	8d 42 01             	lea    0x1(%edx),%eax
+  801cfa:	89 43 04             	mov    %eax,0x4(%ebx)
+  801cfd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d00:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801d04:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801d09:	74 05                	je     801d10 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801d0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d0e:	c9                   	leave
+  801d0f:	c3                   	ret
+		writebuf(b);
+  801d10:	89 d8                	mov    %ebx,%eax
+  801d12:	e8 94 ff ff ff       	call   801cab <writebuf>
+		b->idx = 0;
+  801d17:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801d1e:	eb eb                	jmp    801d0b <putch+0x21>
+
+00801d20 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801d20:	55                   	push   %ebp
+  801d21:	89 e5                	mov    %esp,%ebp
+  801d23:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801d29:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d2c:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801d32:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801d39:	00 00 00 
+	b.result = 0;
+  801d3c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801d43:	00 00 00 
+	b.error = 1;
+  801d46:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801d4d:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801d50:	ff 75 10             	push   0x10(%ebp)
+  801d53:	ff 75 0c             	push   0xc(%ebp)
+  801d56:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801d5c:	50                   	push   %eax
+  801d5d:	68 ea 1c 80 00       	push   $0x801cea
+  801d62:	e8 49 e6 ff ff       	call   8003b0 <vprintfmt>
+	if (b.idx > 0)
+  801d67:	83 c4 10             	add    $0x10,%esp
+  801d6a:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801d71:	7f 12                	jg     801d85 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801d73:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801d79:	85 c0                	test   %eax,%eax
+  801d7b:	75 06                	jne    801d83 <vfprintf+0x63>
+  801d7d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  801d83:	c9                   	leave
+  801d84:	c3                   	ret
+		writebuf(&b);
+  801d85:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801d8b:	e8 1b ff ff ff       	call   801cab <writebuf>
+  801d90:	eb e1                	jmp    801d73 <vfprintf+0x53>
+
+00801d92 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  801d92:	55                   	push   %ebp
+  801d93:	89 e5                	mov    %esp,%ebp
+  801d95:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801d98:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  801d9b:	50                   	push   %eax
+  801d9c:	ff 75 0c             	push   0xc(%ebp)
+  801d9f:	ff 75 08             	push   0x8(%ebp)
+  801da2:	e8 79 ff ff ff       	call   801d20 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801da7:	c9                   	leave
+  801da8:	c3                   	ret
+
+00801da9 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  801da9:	55                   	push   %ebp
+  801daa:	89 e5                	mov    %esp,%ebp
+  801dac:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801daf:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  801db2:	50                   	push   %eax
+  801db3:	ff 75 08             	push   0x8(%ebp)
+  801db6:	6a 01                	push   $0x1
+  801db8:	e8 63 ff ff ff       	call   801d20 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801dbd:	c9                   	leave
+  801dbe:	c3                   	ret
+
+00801dbf <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801dbf:	55                   	push   %ebp
+  801dc0:	89 e5                	mov    %esp,%ebp
+  801dc2:	56                   	push   %esi
+  801dc3:	53                   	push   %ebx
+  801dc4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801dc7:	83 ec 0c             	sub    $0xc,%esp
+  801dca:	ff 75 08             	push   0x8(%ebp)
+  801dcd:	e8 6c f5 ff ff       	call   80133e <fd2data>
+  801dd2:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801dd4:	83 c4 08             	add    $0x8,%esp
+  801dd7:	68 b7 2d 80 00       	push   $0x802db7
+  801ddc:	53                   	push   %ebx
+  801ddd:	e8 be ea ff ff       	call   8008a0 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801de2:	8b 46 04             	mov    0x4(%esi),%eax
+  801de5:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801deb:	2b 0e                	sub    (%esi),%ecx
+  801ded:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801df2:	89 c8                	mov    %ecx,%eax
+  801df4:	f7 e2                	mul    %edx
+  801df6:	c1 ea 0c             	shr    $0xc,%edx
+  801df9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801dff:	29 d1                	sub    %edx,%ecx
+  801e01:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801e07:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e0e:	00 00 00 
+	stat->st_dev = &devpipe;
+  801e11:	c7 83 88 00 00 00 24 	movl   $0x803024,0x88(%ebx)
+  801e18:	30 80 00 
+	return 0;
+}
+  801e1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e23:	5b                   	pop    %ebx
+  801e24:	5e                   	pop    %esi
+  801e25:	5d                   	pop    %ebp
+  801e26:	c3                   	ret
+
+00801e27 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801e27:	55                   	push   %ebp
+  801e28:	89 e5                	mov    %esp,%ebp
+  801e2a:	53                   	push   %ebx
+  801e2b:	83 ec 0c             	sub    $0xc,%esp
+  801e2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801e31:	53                   	push   %ebx
+  801e32:	6a 00                	push   $0x0
+  801e34:	e8 df ef ff ff       	call   800e18 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801e39:	89 1c 24             	mov    %ebx,(%esp)
+  801e3c:	e8 fd f4 ff ff       	call   80133e <fd2data>
+  801e41:	83 c4 08             	add    $0x8,%esp
+  801e44:	50                   	push   %eax
+  801e45:	6a 00                	push   $0x0
+  801e47:	e8 cc ef ff ff       	call   800e18 <sys_page_unmap>
+}
+  801e4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e4f:	c9                   	leave
+  801e50:	c3                   	ret
+
+00801e51 <_pipeisclosed>:
+{
+  801e51:	55                   	push   %ebp
+  801e52:	89 e5                	mov    %esp,%ebp
+  801e54:	57                   	push   %edi
+  801e55:	56                   	push   %esi
+  801e56:	53                   	push   %ebx
+  801e57:	83 ec 1c             	sub    $0x1c,%esp
+  801e5a:	89 c7                	mov    %eax,%edi
+  801e5c:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801e5e:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  801e63:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801e66:	83 ec 0c             	sub    $0xc,%esp
+  801e69:	57                   	push   %edi
+  801e6a:	e8 35 08 00 00       	call   8026a4 <pageref>
+  801e6f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e72:	89 34 24             	mov    %esi,(%esp)
+  801e75:	e8 2a 08 00 00       	call   8026a4 <pageref>
+		nn = thisenv->env_runs;
+  801e7a:	8b 15 0c 40 80 00    	mov    0x80400c,%edx
+  801e80:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801e83:	83 c4 10             	add    $0x10,%esp
+  801e86:	39 cb                	cmp    %ecx,%ebx
+  801e88:	74 1b                	je     801ea5 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801e8a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801e8d:	75 cf                	jne    801e5e <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801e8f:	8b 42 58             	mov    0x58(%edx),%eax
+  801e92:	6a 01                	push   $0x1
+  801e94:	50                   	push   %eax
+  801e95:	53                   	push   %ebx
+  801e96:	68 be 2d 80 00       	push   $0x802dbe
+  801e9b:	e8 19 e4 ff ff       	call   8002b9 <cprintf>
+  801ea0:	83 c4 10             	add    $0x10,%esp
+  801ea3:	eb b9                	jmp    801e5e <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801ea5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801ea8:	0f 94 c0             	sete   %al
+  801eab:	0f b6 c0             	movzbl %al,%eax
+}
+  801eae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eb1:	5b                   	pop    %ebx
+  801eb2:	5e                   	pop    %esi
+  801eb3:	5f                   	pop    %edi
+  801eb4:	5d                   	pop    %ebp
+  801eb5:	c3                   	ret
+
+00801eb6 <devpipe_read>:
+{
+  801eb6:	55                   	push   %ebp
+  801eb7:	89 e5                	mov    %esp,%ebp
+  801eb9:	57                   	push   %edi
+  801eba:	56                   	push   %esi
+  801ebb:	53                   	push   %ebx
+  801ebc:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801ebf:	ff 75 08             	push   0x8(%ebp)
+  801ec2:	e8 77 f4 ff ff       	call   80133e <fd2data>
+  801ec7:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801ec9:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801ecc:	8d 40 04             	lea    0x4(%eax),%eax
+  801ecf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801ed2:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801ed5:	8b 0b                	mov    (%ebx),%ecx
+  801ed7:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801edd:	29 ce                	sub    %ecx,%esi
+  801edf:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801ee4:	f7 e6                	mul    %esi
+  801ee6:	c1 ea 0c             	shr    $0xc,%edx
+  801ee9:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801eef:	29 c6                	sub    %eax,%esi
+  801ef1:	89 f2                	mov    %esi,%edx
+  801ef3:	75 43                	jne    801f38 <devpipe_read+0x82>
+		ref = pageref(p);
+  801ef5:	83 ec 0c             	sub    $0xc,%esp
+  801ef8:	53                   	push   %ebx
+  801ef9:	e8 a6 07 00 00       	call   8026a4 <pageref>
+  801efe:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801f00:	89 da                	mov    %ebx,%edx
+  801f02:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f05:	e8 47 ff ff ff       	call   801e51 <_pipeisclosed>
+  801f0a:	83 c4 10             	add    $0x10,%esp
+  801f0d:	85 c0                	test   %eax,%eax
+  801f0f:	0f 85 c1 00 00 00    	jne    801fd6 <devpipe_read+0x120>
+	*sleeping = 1;
+  801f15:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801f1c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801f21:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801f24:	75 ac                	jne    801ed2 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801f26:	83 ec 04             	sub    $0x4,%esp
+  801f29:	56                   	push   %esi
+  801f2a:	57                   	push   %edi
+  801f2b:	ff 75 e4             	push   -0x1c(%ebp)
+  801f2e:	e8 39 f3 ff ff       	call   80126c <sys_futex_wait>
+  801f33:	83 c4 10             	add    $0x10,%esp
+  801f36:	eb 9a                	jmp    801ed2 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801f38:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801f3b:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801f3f:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801f41:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f46:	f7 e1                	mul    %ecx
+  801f48:	c1 ea 0b             	shr    $0xb,%edx
+  801f4b:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801f51:	29 c1                	sub    %eax,%ecx
+  801f53:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801f55:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801f5a:	29 cf                	sub    %ecx,%edi
+  801f5c:	39 f7                	cmp    %esi,%edi
+  801f5e:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801f61:	8d 43 10             	lea    0x10(%ebx),%eax
+  801f64:	83 ec 04             	sub    $0x4,%esp
+  801f67:	57                   	push   %edi
+  801f68:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f6b:	01 c2                	add    %eax,%edx
+  801f6d:	52                   	push   %edx
+  801f6e:	ff 75 0c             	push   0xc(%ebp)
+  801f71:	e8 b0 ea ff ff       	call   800a26 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801f76:	83 c4 0c             	add    $0xc,%esp
+  801f79:	89 f1                	mov    %esi,%ecx
+  801f7b:	29 f9                	sub    %edi,%ecx
+  801f7d:	51                   	push   %ecx
+  801f7e:	ff 75 e4             	push   -0x1c(%ebp)
+  801f81:	89 f8                	mov    %edi,%eax
+  801f83:	03 45 0c             	add    0xc(%ebp),%eax
+  801f86:	50                   	push   %eax
+  801f87:	e8 9a ea ff ff       	call   800a26 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801f8c:	89 f1                	mov    %esi,%ecx
+  801f8e:	03 0b                	add    (%ebx),%ecx
+  801f90:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f95:	f7 e1                	mul    %ecx
+  801f97:	c1 ea 0c             	shr    $0xc,%edx
+  801f9a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801fa0:	29 d1                	sub    %edx,%ecx
+  801fa2:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801fa4:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801fa9:	83 c4 10             	add    $0x10,%esp
+  801fac:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801fb0:	75 0a                	jne    801fbc <devpipe_read+0x106>
+	return n;
+  801fb2:	89 f0                	mov    %esi,%eax
+}
+  801fb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fb7:	5b                   	pop    %ebx
+  801fb8:	5e                   	pop    %esi
+  801fb9:	5f                   	pop    %edi
+  801fba:	5d                   	pop    %ebp
+  801fbb:	c3                   	ret
+		*sleeping = 0;
+  801fbc:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801fc3:	83 ec 08             	sub    $0x8,%esp
+  801fc6:	68 00 04 00 00       	push   $0x400
+  801fcb:	53                   	push   %ebx
+  801fcc:	e8 eb f2 ff ff       	call   8012bc <sys_futex_wake>
+  801fd1:	83 c4 10             	add    $0x10,%esp
+  801fd4:	eb dc                	jmp    801fb2 <devpipe_read+0xfc>
+			return 0;
+  801fd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fdb:	eb d7                	jmp    801fb4 <devpipe_read+0xfe>
+
+00801fdd <devpipe_write>:
+{
+  801fdd:	55                   	push   %ebp
+  801fde:	89 e5                	mov    %esp,%ebp
+  801fe0:	57                   	push   %edi
+  801fe1:	56                   	push   %esi
+  801fe2:	53                   	push   %ebx
+  801fe3:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801fe6:	ff 75 08             	push   0x8(%ebp)
+  801fe9:	e8 50 f3 ff ff       	call   80133e <fd2data>
+  801fee:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801ff0:	83 c4 10             	add    $0x10,%esp
+  801ff3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801ffa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ffd:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802000:	0f 83 23 01 00 00    	jae    802129 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802006:	8b 77 04             	mov    0x4(%edi),%esi
+  802009:	8b 1f                	mov    (%edi),%ebx
+  80200b:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  802011:	29 d9                	sub    %ebx,%ecx
+  802013:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802018:	f7 e1                	mul    %ecx
+  80201a:	c1 ea 0c             	shr    $0xc,%edx
+  80201d:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802023:	29 c1                	sub    %eax,%ecx
+  802025:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802027:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80202d:	75 40                	jne    80206f <devpipe_write+0x92>
+			ref = pageref(p);
+  80202f:	83 ec 0c             	sub    $0xc,%esp
+  802032:	57                   	push   %edi
+  802033:	e8 6c 06 00 00       	call   8026a4 <pageref>
+  802038:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  80203a:	89 fa                	mov    %edi,%edx
+  80203c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80203f:	e8 0d fe ff ff       	call   801e51 <_pipeisclosed>
+  802044:	83 c4 10             	add    $0x10,%esp
+  802047:	85 c0                	test   %eax,%eax
+  802049:	0f 85 d5 00 00 00    	jne    802124 <devpipe_write+0x147>
+	*sleeping = 1;
+  80204f:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  802056:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80205b:	39 1f                	cmp    %ebx,(%edi)
+  80205d:	75 a7                	jne    802006 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  80205f:	83 ec 04             	sub    $0x4,%esp
+  802062:	56                   	push   %esi
+  802063:	53                   	push   %ebx
+  802064:	57                   	push   %edi
+  802065:	e8 02 f2 ff ff       	call   80126c <sys_futex_wait>
+  80206a:	83 c4 10             	add    $0x10,%esp
+  80206d:	eb 97                	jmp    802006 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80206f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802072:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802075:	29 c1                	sub    %eax,%ecx
+  802077:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80207c:	89 d8                	mov    %ebx,%eax
+  80207e:	29 d0                	sub    %edx,%eax
+  802080:	39 c1                	cmp    %eax,%ecx
+  802082:	0f 46 c1             	cmovbe %ecx,%eax
+  802085:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  802087:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80208c:	f7 e6                	mul    %esi
+  80208e:	c1 ea 0b             	shr    $0xb,%edx
+  802091:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802097:	29 c6                	sub    %eax,%esi
+  802099:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80209b:	29 f3                	sub    %esi,%ebx
+  80209d:	39 cb                	cmp    %ecx,%ebx
+  80209f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8020a2:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  8020a5:	8d 77 10             	lea    0x10(%edi),%esi
+  8020a8:	83 ec 04             	sub    $0x4,%esp
+  8020ab:	53                   	push   %ebx
+  8020ac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8020af:	03 45 0c             	add    0xc(%ebp),%eax
+  8020b2:	50                   	push   %eax
+  8020b3:	01 f2                	add    %esi,%edx
+  8020b5:	52                   	push   %edx
+  8020b6:	e8 6b e9 ff ff       	call   800a26 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8020bb:	83 c4 0c             	add    $0xc,%esp
+  8020be:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8020c1:	29 d8                	sub    %ebx,%eax
+  8020c3:	50                   	push   %eax
+  8020c4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8020c7:	01 d3                	add    %edx,%ebx
+  8020c9:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8020cc:	53                   	push   %ebx
+  8020cd:	56                   	push   %esi
+  8020ce:	e8 53 e9 ff ff       	call   800a26 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8020d3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8020d6:	03 4f 04             	add    0x4(%edi),%ecx
+  8020d9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8020de:	f7 e1                	mul    %ecx
+  8020e0:	c1 ea 0c             	shr    $0xc,%edx
+  8020e3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8020e9:	29 d1                	sub    %edx,%ecx
+  8020eb:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8020ee:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8020f3:	83 c4 10             	add    $0x10,%esp
+  8020f6:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8020fa:	75 0b                	jne    802107 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8020fc:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8020ff:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802102:	e9 f3 fe ff ff       	jmp    801ffa <devpipe_write+0x1d>
+		*sleeping = 0;
+  802107:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  80210e:	83 ec 08             	sub    $0x8,%esp
+  802111:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802116:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802119:	50                   	push   %eax
+  80211a:	e8 9d f1 ff ff       	call   8012bc <sys_futex_wake>
+  80211f:	83 c4 10             	add    $0x10,%esp
+  802122:	eb d8                	jmp    8020fc <devpipe_write+0x11f>
+				return 0;
+  802124:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802129:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80212c:	5b                   	pop    %ebx
+  80212d:	5e                   	pop    %esi
+  80212e:	5f                   	pop    %edi
+  80212f:	5d                   	pop    %ebp
+  802130:	c3                   	ret
+
+00802131 <pipe>:
+{
+  802131:	55                   	push   %ebp
+  802132:	89 e5                	mov    %esp,%ebp
+  802134:	56                   	push   %esi
+  802135:	53                   	push   %ebx
+  802136:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802139:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80213c:	50                   	push   %eax
+  80213d:	e8 13 f2 ff ff       	call   801355 <fd_alloc>
+  802142:	89 c3                	mov    %eax,%ebx
+  802144:	83 c4 10             	add    $0x10,%esp
+  802147:	85 c0                	test   %eax,%eax
+  802149:	0f 88 23 01 00 00    	js     802272 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80214f:	83 ec 04             	sub    $0x4,%esp
+  802152:	68 07 04 00 00       	push   $0x407
+  802157:	ff 75 f4             	push   -0xc(%ebp)
+  80215a:	6a 00                	push   $0x0
+  80215c:	e8 32 ec ff ff       	call   800d93 <sys_page_alloc>
+  802161:	89 c3                	mov    %eax,%ebx
+  802163:	83 c4 10             	add    $0x10,%esp
+  802166:	85 c0                	test   %eax,%eax
+  802168:	0f 88 04 01 00 00    	js     802272 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80216e:	83 ec 0c             	sub    $0xc,%esp
+  802171:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802174:	50                   	push   %eax
+  802175:	e8 db f1 ff ff       	call   801355 <fd_alloc>
+  80217a:	89 c3                	mov    %eax,%ebx
+  80217c:	83 c4 10             	add    $0x10,%esp
+  80217f:	85 c0                	test   %eax,%eax
+  802181:	0f 88 db 00 00 00    	js     802262 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802187:	83 ec 04             	sub    $0x4,%esp
+  80218a:	68 07 04 00 00       	push   $0x407
+  80218f:	ff 75 f0             	push   -0x10(%ebp)
+  802192:	6a 00                	push   $0x0
+  802194:	e8 fa eb ff ff       	call   800d93 <sys_page_alloc>
+  802199:	89 c3                	mov    %eax,%ebx
+  80219b:	83 c4 10             	add    $0x10,%esp
+  80219e:	85 c0                	test   %eax,%eax
+  8021a0:	0f 88 bc 00 00 00    	js     802262 <pipe+0x131>
+	va = fd2data(fd0);
+  8021a6:	83 ec 0c             	sub    $0xc,%esp
+  8021a9:	ff 75 f4             	push   -0xc(%ebp)
+  8021ac:	e8 8d f1 ff ff       	call   80133e <fd2data>
+  8021b1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8021b3:	83 c4 0c             	add    $0xc,%esp
+  8021b6:	68 07 04 00 00       	push   $0x407
+  8021bb:	50                   	push   %eax
+  8021bc:	6a 00                	push   $0x0
+  8021be:	e8 d0 eb ff ff       	call   800d93 <sys_page_alloc>
+  8021c3:	89 c3                	mov    %eax,%ebx
+  8021c5:	83 c4 10             	add    $0x10,%esp
+  8021c8:	85 c0                	test   %eax,%eax
+  8021ca:	0f 88 82 00 00 00    	js     802252 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8021d0:	83 ec 0c             	sub    $0xc,%esp
+  8021d3:	ff 75 f0             	push   -0x10(%ebp)
+  8021d6:	e8 63 f1 ff ff       	call   80133e <fd2data>
+  8021db:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8021e2:	50                   	push   %eax
+  8021e3:	6a 00                	push   $0x0
+  8021e5:	56                   	push   %esi
+  8021e6:	6a 00                	push   $0x0
+  8021e8:	e8 e9 eb ff ff       	call   800dd6 <sys_page_map>
+  8021ed:	89 c3                	mov    %eax,%ebx
+  8021ef:	83 c4 20             	add    $0x20,%esp
+  8021f2:	85 c0                	test   %eax,%eax
+  8021f4:	78 4e                	js     802244 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8021f6:	a1 24 30 80 00       	mov    0x803024,%eax
+  8021fb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021fe:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802200:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802203:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80220a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80220d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80220f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802212:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802219:	83 ec 0c             	sub    $0xc,%esp
+  80221c:	ff 75 f4             	push   -0xc(%ebp)
+  80221f:	e8 0a f1 ff ff       	call   80132e <fd2num>
+  802224:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802227:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802229:	83 c4 04             	add    $0x4,%esp
+  80222c:	ff 75 f0             	push   -0x10(%ebp)
+  80222f:	e8 fa f0 ff ff       	call   80132e <fd2num>
+  802234:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802237:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80223a:	83 c4 10             	add    $0x10,%esp
+  80223d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802242:	eb 2e                	jmp    802272 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802244:	83 ec 08             	sub    $0x8,%esp
+  802247:	56                   	push   %esi
+  802248:	6a 00                	push   $0x0
+  80224a:	e8 c9 eb ff ff       	call   800e18 <sys_page_unmap>
+  80224f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802252:	83 ec 08             	sub    $0x8,%esp
+  802255:	ff 75 f0             	push   -0x10(%ebp)
+  802258:	6a 00                	push   $0x0
+  80225a:	e8 b9 eb ff ff       	call   800e18 <sys_page_unmap>
+  80225f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802262:	83 ec 08             	sub    $0x8,%esp
+  802265:	ff 75 f4             	push   -0xc(%ebp)
+  802268:	6a 00                	push   $0x0
+  80226a:	e8 a9 eb ff ff       	call   800e18 <sys_page_unmap>
+  80226f:	83 c4 10             	add    $0x10,%esp
+}
+  802272:	89 d8                	mov    %ebx,%eax
+  802274:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802277:	5b                   	pop    %ebx
+  802278:	5e                   	pop    %esi
+  802279:	5d                   	pop    %ebp
+  80227a:	c3                   	ret
+
+0080227b <pipeisclosed>:
+{
+  80227b:	55                   	push   %ebp
+  80227c:	89 e5                	mov    %esp,%ebp
+  80227e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802281:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802284:	50                   	push   %eax
+  802285:	ff 75 08             	push   0x8(%ebp)
+  802288:	e8 1c f1 ff ff       	call   8013a9 <fd_lookup>
+  80228d:	83 c4 10             	add    $0x10,%esp
+  802290:	85 c0                	test   %eax,%eax
+  802292:	78 18                	js     8022ac <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802294:	83 ec 0c             	sub    $0xc,%esp
+  802297:	ff 75 f4             	push   -0xc(%ebp)
+  80229a:	e8 9f f0 ff ff       	call   80133e <fd2data>
+  80229f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8022a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022a4:	e8 a8 fb ff ff       	call   801e51 <_pipeisclosed>
+  8022a9:	83 c4 10             	add    $0x10,%esp
+}
+  8022ac:	c9                   	leave
+  8022ad:	c3                   	ret
+
+008022ae <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8022ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b3:	c3                   	ret
+
+008022b4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8022b4:	55                   	push   %ebp
+  8022b5:	89 e5                	mov    %esp,%ebp
+  8022b7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8022ba:	68 d6 2d 80 00       	push   $0x802dd6
+  8022bf:	ff 75 0c             	push   0xc(%ebp)
+  8022c2:	e8 d9 e5 ff ff       	call   8008a0 <strcpy>
+	return 0;
+}
+  8022c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022cc:	c9                   	leave
+  8022cd:	c3                   	ret
+
+008022ce <devcons_write>:
+{
+  8022ce:	55                   	push   %ebp
+  8022cf:	89 e5                	mov    %esp,%ebp
+  8022d1:	57                   	push   %edi
+  8022d2:	56                   	push   %esi
+  8022d3:	53                   	push   %ebx
+  8022d4:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8022da:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8022df:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8022e5:	eb 2e                	jmp    802315 <devcons_write+0x47>
+		m = n - tot;
+  8022e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8022ea:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8022ec:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8022f1:	39 c3                	cmp    %eax,%ebx
+  8022f3:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8022f6:	83 ec 04             	sub    $0x4,%esp
+  8022f9:	53                   	push   %ebx
+  8022fa:	89 f0                	mov    %esi,%eax
+  8022fc:	03 45 0c             	add    0xc(%ebp),%eax
+  8022ff:	50                   	push   %eax
+  802300:	57                   	push   %edi
+  802301:	e8 20 e7 ff ff       	call   800a26 <memmove>
+		sys_cputs(buf, m);
+  802306:	83 c4 08             	add    $0x8,%esp
+  802309:	53                   	push   %ebx
+  80230a:	57                   	push   %edi
+  80230b:	e8 b6 e9 ff ff       	call   800cc6 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802310:	01 de                	add    %ebx,%esi
+  802312:	83 c4 10             	add    $0x10,%esp
+  802315:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802318:	72 cd                	jb     8022e7 <devcons_write+0x19>
+}
+  80231a:	89 f0                	mov    %esi,%eax
+  80231c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80231f:	5b                   	pop    %ebx
+  802320:	5e                   	pop    %esi
+  802321:	5f                   	pop    %edi
+  802322:	5d                   	pop    %ebp
+  802323:	c3                   	ret
+
+00802324 <devcons_read>:
+{
+  802324:	55                   	push   %ebp
+  802325:	89 e5                	mov    %esp,%ebp
+  802327:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80232a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80232f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802333:	75 07                	jne    80233c <devcons_read+0x18>
+  802335:	eb 1f                	jmp    802356 <devcons_read+0x32>
+		sys_yield();
+  802337:	e8 38 ea ff ff       	call   800d74 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80233c:	e8 b4 e9 ff ff       	call   800cf5 <sys_cgetc>
+  802341:	85 c0                	test   %eax,%eax
+  802343:	74 f2                	je     802337 <devcons_read+0x13>
+	if (c < 0)
+  802345:	78 0f                	js     802356 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802347:	83 f8 04             	cmp    $0x4,%eax
+  80234a:	74 0c                	je     802358 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80234c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80234f:	88 02                	mov    %al,(%edx)
+	return 1;
+  802351:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802356:	c9                   	leave
+  802357:	c3                   	ret
+		return 0;
+  802358:	b8 00 00 00 00       	mov    $0x0,%eax
+  80235d:	eb f7                	jmp    802356 <devcons_read+0x32>
+
+0080235f <cputchar>:
+{
+  80235f:	55                   	push   %ebp
+  802360:	89 e5                	mov    %esp,%ebp
+  802362:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802365:	8b 45 08             	mov    0x8(%ebp),%eax
+  802368:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80236b:	6a 01                	push   $0x1
+  80236d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802370:	50                   	push   %eax
+  802371:	e8 50 e9 ff ff       	call   800cc6 <sys_cputs>
+}
+  802376:	83 c4 10             	add    $0x10,%esp
+  802379:	c9                   	leave
+  80237a:	c3                   	ret
+
+0080237b <getchar>:
+{
+  80237b:	55                   	push   %ebp
+  80237c:	89 e5                	mov    %esp,%ebp
+  80237e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802381:	6a 01                	push   $0x1
+  802383:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802386:	50                   	push   %eax
+  802387:	6a 00                	push   $0x0
+  802389:	e8 7a f2 ff ff       	call   801608 <read>
+	if (r < 0)
+  80238e:	83 c4 10             	add    $0x10,%esp
+  802391:	85 c0                	test   %eax,%eax
+  802393:	78 06                	js     80239b <getchar+0x20>
+	if (r < 1)
+  802395:	74 06                	je     80239d <getchar+0x22>
+	return c;
+  802397:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80239b:	c9                   	leave
+  80239c:	c3                   	ret
+		return -E_EOF;
+  80239d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8023a2:	eb f7                	jmp    80239b <getchar+0x20>
+
+008023a4 <iscons>:
+{
+  8023a4:	55                   	push   %ebp
+  8023a5:	89 e5                	mov    %esp,%ebp
+  8023a7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023ad:	50                   	push   %eax
+  8023ae:	ff 75 08             	push   0x8(%ebp)
+  8023b1:	e8 f3 ef ff ff       	call   8013a9 <fd_lookup>
+  8023b6:	83 c4 10             	add    $0x10,%esp
+  8023b9:	85 c0                	test   %eax,%eax
+  8023bb:	78 11                	js     8023ce <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8023bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023c0:	8b 15 40 30 80 00    	mov    0x803040,%edx
+  8023c6:	39 10                	cmp    %edx,(%eax)
+  8023c8:	0f 94 c0             	sete   %al
+  8023cb:	0f b6 c0             	movzbl %al,%eax
+}
+  8023ce:	c9                   	leave
+  8023cf:	c3                   	ret
+
+008023d0 <opencons>:
+{
+  8023d0:	55                   	push   %ebp
+  8023d1:	89 e5                	mov    %esp,%ebp
+  8023d3:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8023d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023d9:	50                   	push   %eax
+  8023da:	e8 76 ef ff ff       	call   801355 <fd_alloc>
+  8023df:	83 c4 10             	add    $0x10,%esp
+  8023e2:	85 c0                	test   %eax,%eax
+  8023e4:	78 3a                	js     802420 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8023e6:	83 ec 04             	sub    $0x4,%esp
+  8023e9:	68 07 04 00 00       	push   $0x407
+  8023ee:	ff 75 f4             	push   -0xc(%ebp)
+  8023f1:	6a 00                	push   $0x0
+  8023f3:	e8 9b e9 ff ff       	call   800d93 <sys_page_alloc>
+  8023f8:	83 c4 10             	add    $0x10,%esp
+  8023fb:	85 c0                	test   %eax,%eax
+  8023fd:	78 21                	js     802420 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8023ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802402:	8b 15 40 30 80 00    	mov    0x803040,%edx
+  802408:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80240a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80240d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802414:	83 ec 0c             	sub    $0xc,%esp
+  802417:	50                   	push   %eax
+  802418:	e8 11 ef ff ff       	call   80132e <fd2num>
+  80241d:	83 c4 10             	add    $0x10,%esp
+}
+  802420:	c9                   	leave
+  802421:	c3                   	ret
+
+00802422 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  802422:	55                   	push   %ebp
+  802423:	89 e5                	mov    %esp,%ebp
+  802425:	57                   	push   %edi
+  802426:	56                   	push   %esi
+  802427:	53                   	push   %ebx
+  802428:	83 ec 14             	sub    $0x14,%esp
+  80242b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80242e:	8b 75 14             	mov    0x14(%ebp),%esi
+  802431:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  802434:	ff 75 10             	push   0x10(%ebp)
+  802437:	ff 75 0c             	push   0xc(%ebp)
+  80243a:	e8 77 ed ff ff       	call   8011b6 <sys_ipc_recv_pages>
+  80243f:	83 c4 10             	add    $0x10,%esp
+  802442:	85 c0                	test   %eax,%eax
+  802444:	78 46                	js     80248c <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802446:	85 ff                	test   %edi,%edi
+  802448:	74 0d                	je     802457 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  80244a:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80244f:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802455:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802457:	85 f6                	test   %esi,%esi
+  802459:	74 0d                	je     802468 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  80245b:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802460:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802466:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802468:	85 db                	test   %ebx,%ebx
+  80246a:	74 0d                	je     802479 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  80246c:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802471:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802477:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802479:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80247e:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802484:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802487:	5b                   	pop    %ebx
+  802488:	5e                   	pop    %esi
+  802489:	5f                   	pop    %edi
+  80248a:	5d                   	pop    %ebp
+  80248b:	c3                   	ret
+		if (from_env_store) {
+  80248c:	85 ff                	test   %edi,%edi
+  80248e:	74 06                	je     802496 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  802490:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802496:	85 f6                	test   %esi,%esi
+  802498:	74 06                	je     8024a0 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  80249a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8024a0:	85 db                	test   %ebx,%ebx
+  8024a2:	74 e0                	je     802484 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8024a4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8024aa:	eb d8                	jmp    802484 <ipc_recv_pages+0x62>
+
+008024ac <ipc_recv>:
+{
+  8024ac:	55                   	push   %ebp
+  8024ad:	89 e5                	mov    %esp,%ebp
+  8024af:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8024b2:	6a 00                	push   $0x0
+  8024b4:	ff 75 10             	push   0x10(%ebp)
+  8024b7:	6a 01                	push   $0x1
+  8024b9:	ff 75 0c             	push   0xc(%ebp)
+  8024bc:	ff 75 08             	push   0x8(%ebp)
+  8024bf:	e8 5e ff ff ff       	call   802422 <ipc_recv_pages>
+}
+  8024c4:	c9                   	leave
+  8024c5:	c3                   	ret
+
+008024c6 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8024c6:	55                   	push   %ebp
+  8024c7:	89 e5                	mov    %esp,%ebp
+  8024c9:	56                   	push   %esi
+  8024ca:	53                   	push   %ebx
+  8024cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8024ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8024d1:	83 ec 0c             	sub    $0xc,%esp
+  8024d4:	ff 75 0c             	push   0xc(%ebp)
+  8024d7:	e8 0e ee ff ff       	call   8012ea <sys_ipc_try_recv>
+  8024dc:	83 c4 10             	add    $0x10,%esp
+  8024df:	85 c0                	test   %eax,%eax
+  8024e1:	78 34                	js     802517 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8024e3:	85 f6                	test   %esi,%esi
+  8024e5:	74 0d                	je     8024f4 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8024e7:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8024ec:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8024f2:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8024f4:	85 db                	test   %ebx,%ebx
+  8024f6:	74 0d                	je     802505 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8024f8:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8024fd:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802503:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802505:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80250a:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802510:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802513:	5b                   	pop    %ebx
+  802514:	5e                   	pop    %esi
+  802515:	5d                   	pop    %ebp
+  802516:	c3                   	ret
+		if (from_env_store) {
+  802517:	85 f6                	test   %esi,%esi
+  802519:	74 06                	je     802521 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  80251b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  802521:	85 db                	test   %ebx,%ebx
+  802523:	74 eb                	je     802510 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  802525:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80252b:	eb e3                	jmp    802510 <ipc_try_recv+0x4a>
+
+0080252d <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80252d:	55                   	push   %ebp
+  80252e:	89 e5                	mov    %esp,%ebp
+  802530:	83 ec 14             	sub    $0x14,%esp
+  802533:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802536:	85 c0                	test   %eax,%eax
+  802538:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80253d:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802540:	ff 75 18             	push   0x18(%ebp)
+  802543:	ff 75 14             	push   0x14(%ebp)
+  802546:	50                   	push   %eax
+  802547:	ff 75 0c             	push   0xc(%ebp)
+  80254a:	ff 75 08             	push   0x8(%ebp)
+  80254d:	e8 27 ec ff ff       	call   801179 <sys_ipc_send_pages>
+  802552:	83 c4 20             	add    $0x20,%esp
+  802555:	85 c0                	test   %eax,%eax
+  802557:	78 02                	js     80255b <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  802559:	c9                   	leave
+  80255a:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  80255b:	50                   	push   %eax
+  80255c:	68 e4 2d 80 00       	push   $0x802de4
+  802561:	68 80 00 00 00       	push   $0x80
+  802566:	68 10 2e 80 00       	push   $0x802e10
+  80256b:	e8 6e dc ff ff       	call   8001de <_panic>
+
+00802570 <ipc_send>:
+{
+  802570:	55                   	push   %ebp
+  802571:	89 e5                	mov    %esp,%ebp
+  802573:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  802576:	ff 75 14             	push   0x14(%ebp)
+  802579:	6a 01                	push   $0x1
+  80257b:	ff 75 10             	push   0x10(%ebp)
+  80257e:	ff 75 0c             	push   0xc(%ebp)
+  802581:	ff 75 08             	push   0x8(%ebp)
+  802584:	e8 a4 ff ff ff       	call   80252d <ipc_send_pages>
+}
+  802589:	83 c4 20             	add    $0x20,%esp
+  80258c:	c9                   	leave
+  80258d:	c3                   	ret
+
+0080258e <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80258e:	55                   	push   %ebp
+  80258f:	89 e5                	mov    %esp,%ebp
+  802591:	83 ec 14             	sub    $0x14,%esp
+  802594:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802597:	85 c0                	test   %eax,%eax
+  802599:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80259e:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8025a1:	ff 75 18             	push   0x18(%ebp)
+  8025a4:	ff 75 14             	push   0x14(%ebp)
+  8025a7:	50                   	push   %eax
+  8025a8:	ff 75 0c             	push   0xc(%ebp)
+  8025ab:	ff 75 08             	push   0x8(%ebp)
+  8025ae:	e8 57 ec ff ff       	call   80120a <sys_ipc_call>
+  8025b3:	83 c4 20             	add    $0x20,%esp
+  8025b6:	85 c0                	test   %eax,%eax
+  8025b8:	78 0b                	js     8025c5 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  8025ba:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  8025bf:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8025c5:	c9                   	leave
+  8025c6:	c3                   	ret
+
+008025c7 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  8025c7:	55                   	push   %ebp
+  8025c8:	89 e5                	mov    %esp,%ebp
+  8025ca:	57                   	push   %edi
+  8025cb:	56                   	push   %esi
+  8025cc:	53                   	push   %ebx
+  8025cd:	83 ec 18             	sub    $0x18,%esp
+  8025d0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8025d3:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8025d6:	8b 75 20             	mov    0x20(%ebp),%esi
+  8025d9:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8025dc:	85 c0                	test   %eax,%eax
+  8025de:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8025e3:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8025e6:	ff 75 18             	push   0x18(%ebp)
+  8025e9:	ff 75 14             	push   0x14(%ebp)
+  8025ec:	50                   	push   %eax
+  8025ed:	ff 75 0c             	push   0xc(%ebp)
+  8025f0:	ff 75 08             	push   0x8(%ebp)
+  8025f3:	e8 53 ec ff ff       	call   80124b <sys_ipc_reply_recv>
+  8025f8:	83 c4 20             	add    $0x20,%esp
+  8025fb:	85 c0                	test   %eax,%eax
+  8025fd:	78 46                	js     802645 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8025ff:	85 ff                	test   %edi,%edi
+  802601:	74 0d                	je     802610 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  802603:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802608:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80260e:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802610:	85 f6                	test   %esi,%esi
+  802612:	74 0d                	je     802621 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  802614:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802619:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80261f:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802621:	85 db                	test   %ebx,%ebx
+  802623:	74 0d                	je     802632 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  802625:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  80262a:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802630:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802632:	a1 0c 40 80 00       	mov    0x80400c,%eax
+  802637:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80263d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802640:	5b                   	pop    %ebx
+  802641:	5e                   	pop    %esi
+  802642:	5f                   	pop    %edi
+  802643:	5d                   	pop    %ebp
+  802644:	c3                   	ret
+		if (from_env_store) {
+  802645:	85 ff                	test   %edi,%edi
+  802647:	74 06                	je     80264f <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  802649:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80264f:	85 f6                	test   %esi,%esi
+  802651:	74 06                	je     802659 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  802653:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802659:	85 db                	test   %ebx,%ebx
+  80265b:	74 e0                	je     80263d <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  80265d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802663:	eb d8                	jmp    80263d <ipc_reply_recv+0x76>
+
+00802665 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802665:	55                   	push   %ebp
+  802666:	89 e5                	mov    %esp,%ebp
+  802668:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80266b:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  802670:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802673:	c1 e0 06             	shl    $0x6,%eax
+  802676:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80267b:	8b 40 50             	mov    0x50(%eax),%eax
+  80267e:	39 c8                	cmp    %ecx,%eax
+  802680:	74 12                	je     802694 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802682:	83 c2 01             	add    $0x1,%edx
+  802685:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80268b:	75 e3                	jne    802670 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80268d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802692:	eb 0e                	jmp    8026a2 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802694:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802697:	c1 e0 06             	shl    $0x6,%eax
+  80269a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80269f:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8026a2:	5d                   	pop    %ebp
+  8026a3:	c3                   	ret
+
+008026a4 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8026a4:	55                   	push   %ebp
+  8026a5:	89 e5                	mov    %esp,%ebp
+  8026a7:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8026aa:	89 c2                	mov    %eax,%edx
+  8026ac:	c1 ea 16             	shr    $0x16,%edx
+  8026af:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8026b6:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8026bb:	f6 c1 01             	test   $0x1,%cl
+  8026be:	74 1e                	je     8026de <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  8026c0:	c1 e8 0c             	shr    $0xc,%eax
+  8026c3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8026ca:	a8 01                	test   $0x1,%al
+  8026cc:	74 10                	je     8026de <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8026ce:	c1 e8 0c             	shr    $0xc,%eax
+  8026d1:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8026d4:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  8026db:	0f b7 d2             	movzwl %dx,%edx
+}
+  8026de:	89 d0                	mov    %edx,%eax
+  8026e0:	5d                   	pop    %ebp
+  8026e1:	c3                   	ret
+
+008026e2 <udivmod>:
+  8026e2:	55                   	push   %ebp
+  8026e3:	57                   	push   %edi
+  8026e4:	56                   	push   %esi
+  8026e5:	53                   	push   %ebx
+  8026e6:	83 ec 24             	sub    $0x24,%esp
+  8026e9:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8026ed:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8026f1:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8026f5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8026f9:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8026fd:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802701:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802705:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80270a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80270f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802714:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80271b:	00 
+  80271c:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802723:	00 
+  802724:	89 fb                	mov    %edi,%ebx
+  802726:	eb 08                	jmp    802730 <udivmod+0x4e>
+  802728:	83 e9 01             	sub    $0x1,%ecx
+  80272b:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80272e:	74 68                	je     802798 <udivmod+0xb6>
+  802730:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802734:	01 c0                	add    %eax,%eax
+  802736:	89 c6                	mov    %eax,%esi
+  802738:	89 d7                	mov    %edx,%edi
+  80273a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80273e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802742:	0f ad d0             	shrd   %cl,%edx,%eax
+  802745:	d3 ea                	shr    %cl,%edx
+  802747:	f6 c1 20             	test   $0x20,%cl
+  80274a:	74 04                	je     802750 <udivmod+0x6e>
+  80274c:	89 d0                	mov    %edx,%eax
+  80274e:	31 d2                	xor    %edx,%edx
+  802750:	83 e0 01             	and    $0x1,%eax
+  802753:	89 04 24             	mov    %eax,(%esp)
+  802756:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80275d:	00 
+  80275e:	8b 04 24             	mov    (%esp),%eax
+  802761:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802765:	09 f0                	or     %esi,%eax
+  802767:	09 fa                	or     %edi,%edx
+  802769:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80276d:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802771:	39 f0                	cmp    %esi,%eax
+  802773:	89 d5                	mov    %edx,%ebp
+  802775:	19 fd                	sbb    %edi,%ebp
+  802777:	72 af                	jb     802728 <udivmod+0x46>
+  802779:	29 f0                	sub    %esi,%eax
+  80277b:	19 fa                	sbb    %edi,%edx
+  80277d:	89 cf                	mov    %ecx,%edi
+  80277f:	c1 ef 05             	shr    $0x5,%edi
+  802782:	83 e7 01             	and    $0x1,%edi
+  802785:	89 fe                	mov    %edi,%esi
+  802787:	83 f6 01             	xor    $0x1,%esi
+  80278a:	d3 e6                	shl    %cl,%esi
+  80278c:	d3 e7                	shl    %cl,%edi
+  80278e:	09 74 24 18          	or     %esi,0x18(%esp)
+  802792:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802796:	eb 90                	jmp    802728 <udivmod+0x46>
+  802798:	85 db                	test   %ebx,%ebx
+  80279a:	74 05                	je     8027a1 <udivmod+0xbf>
+  80279c:	89 03                	mov    %eax,(%ebx)
+  80279e:	89 53 04             	mov    %edx,0x4(%ebx)
+  8027a1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027a5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027a9:	83 c4 24             	add    $0x24,%esp
+  8027ac:	5b                   	pop    %ebx
+  8027ad:	5e                   	pop    %esi
+  8027ae:	5f                   	pop    %edi
+  8027af:	5d                   	pop    %ebp
+  8027b0:	c3                   	ret
+
+008027b1 <__udivdi3>:
+  8027b1:	83 ec 08             	sub    $0x8,%esp
+  8027b4:	6a 00                	push   $0x0
+  8027b6:	ff 74 24 1c          	push   0x1c(%esp)
+  8027ba:	ff 74 24 1c          	push   0x1c(%esp)
+  8027be:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027c2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027c6:	e8 17 ff ff ff       	call   8026e2 <udivmod>
+  8027cb:	83 c4 14             	add    $0x14,%esp
+  8027ce:	c3                   	ret
+
+008027cf <__umoddi3>:
+  8027cf:	83 ec 18             	sub    $0x18,%esp
+  8027d2:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8027d6:	50                   	push   %eax
+  8027d7:	ff 74 24 2c          	push   0x2c(%esp)
+  8027db:	ff 74 24 2c          	push   0x2c(%esp)
+  8027df:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8027e3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8027e7:	e8 f6 fe ff ff       	call   8026e2 <udivmod>
+  8027ec:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8027f0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8027f4:	83 c4 24             	add    $0x24,%esp
+  8027f7:	c3                   	ret
+
+008027f8 <__divdi3>:
+  8027f8:	55                   	push   %ebp
+  8027f9:	57                   	push   %edi
+  8027fa:	56                   	push   %esi
+  8027fb:	53                   	push   %ebx
+  8027fc:	83 ec 10             	sub    $0x10,%esp
+  8027ff:	8b 44 24 24          	mov    0x24(%esp),%eax
+  802803:	8b 54 24 28          	mov    0x28(%esp),%edx
+  802807:	89 c6                	mov    %eax,%esi
+  802809:	89 d7                	mov    %edx,%edi
+  80280b:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  80280f:	33 7c 24 30          	xor    0x30(%esp),%edi
+  802813:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802817:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  80281b:	89 c5                	mov    %eax,%ebp
+  80281d:	f7 dd                	neg    %ebp
+  80281f:	89 d6                	mov    %edx,%esi
+  802821:	83 d6 00             	adc    $0x0,%esi
+  802824:	f7 de                	neg    %esi
+  802826:	0f 48 e8             	cmovs  %eax,%ebp
+  802829:	0f 49 d6             	cmovns %esi,%edx
+  80282c:	6a 00                	push   $0x0
+  80282e:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802832:	f7 de                	neg    %esi
+  802834:	8b 44 24 34          	mov    0x34(%esp),%eax
+  802838:	83 d0 00             	adc    $0x0,%eax
+  80283b:	f7 d8                	neg    %eax
+  80283d:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  802842:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  802847:	50                   	push   %eax
+  802848:	56                   	push   %esi
+  802849:	89 e8                	mov    %ebp,%eax
+  80284b:	e8 92 fe ff ff       	call   8026e2 <udivmod>
+  802850:	83 c4 10             	add    $0x10,%esp
+  802853:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  802858:	78 08                	js     802862 <__divdi3+0x6a>
+  80285a:	83 c4 0c             	add    $0xc,%esp
+  80285d:	5b                   	pop    %ebx
+  80285e:	5e                   	pop    %esi
+  80285f:	5f                   	pop    %edi
+  802860:	5d                   	pop    %ebp
+  802861:	c3                   	ret
+  802862:	f7 d8                	neg    %eax
+  802864:	83 d2 00             	adc    $0x0,%edx
+  802867:	f7 da                	neg    %edx
+  802869:	eb ef                	jmp    80285a <__divdi3+0x62>
+
+0080286b <__moddi3>:
+  80286b:	55                   	push   %ebp
+  80286c:	57                   	push   %edi
+  80286d:	56                   	push   %esi
+  80286e:	53                   	push   %ebx
+  80286f:	83 ec 18             	sub    $0x18,%esp
+  802872:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802876:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80287a:	89 f1                	mov    %esi,%ecx
+  80287c:	f7 d9                	neg    %ecx
+  80287e:	89 da                	mov    %ebx,%edx
+  802880:	83 d2 00             	adc    $0x0,%edx
+  802883:	f7 da                	neg    %edx
+  802885:	0f 48 ce             	cmovs  %esi,%ecx
+  802888:	0f 48 d3             	cmovs  %ebx,%edx
+  80288b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80288f:	50                   	push   %eax
+  802890:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802894:	f7 de                	neg    %esi
+  802896:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  80289a:	83 d0 00             	adc    $0x0,%eax
+  80289d:	f7 d8                	neg    %eax
+  80289f:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8028a4:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8028a9:	50                   	push   %eax
+  8028aa:	56                   	push   %esi
+  8028ab:	89 c8                	mov    %ecx,%eax
+  8028ad:	e8 30 fe ff ff       	call   8026e2 <udivmod>
+  8028b2:	83 c4 10             	add    $0x10,%esp
+  8028b5:	85 db                	test   %ebx,%ebx
+  8028b7:	78 10                	js     8028c9 <__moddi3+0x5e>
+  8028b9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8028bd:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8028c1:	83 c4 14             	add    $0x14,%esp
+  8028c4:	5b                   	pop    %ebx
+  8028c5:	5e                   	pop    %esi
+  8028c6:	5f                   	pop    %edi
+  8028c7:	5d                   	pop    %ebp
+  8028c8:	c3                   	ret
+  8028c9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8028cd:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8028d1:	f7 d8                	neg    %eax
+  8028d3:	83 d2 00             	adc    $0x0,%edx
+  8028d6:	f7 da                	neg    %edx
+  8028d8:	eb e7                	jmp    8028c1 <__moddi3+0x56>
@@ -0,0 +1,10497 @@
+
+obj/user/pingpong.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 8f 00 00 00       	call   8000c0 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	envid_t who;
+
+	if ((who = fork()) != 0) {
+  80003c:	e8 38 13 00 00       	call   801379 <fork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 4f                	jne    800097 <umain+0x64>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+		ipc_send(who, 0, 0, 0);
+	}
+
+	while (1) {
+		uint32_t i = ipc_recv(&who, 0, 0);
+  800048:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80004b:	83 ec 04             	sub    $0x4,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	6a 00                	push   $0x0
+  800052:	56                   	push   %esi
+  800053:	e8 13 18 00 00       	call   80186b <ipc_recv>
+  800058:	89 c3                	mov    %eax,%ebx
+		cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  80005a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80005d:	e8 f2 0b 00 00       	call   800c54 <sys_getenvid>
+  800062:	57                   	push   %edi
+  800063:	53                   	push   %ebx
+  800064:	50                   	push   %eax
+  800065:	68 b6 52 80 00       	push   $0x8052b6
+  80006a:	e8 49 01 00 00       	call   8001b8 <cprintf>
+		if (i == 10)
+  80006f:	83 c4 20             	add    $0x20,%esp
+  800072:	83 fb 0a             	cmp    $0xa,%ebx
+  800075:	74 18                	je     80008f <umain+0x5c>
+			return;
+		i++;
+  800077:	83 c3 01             	add    $0x1,%ebx
+		ipc_send(who, i, 0, 0);
+  80007a:	6a 00                	push   $0x0
+  80007c:	6a 00                	push   $0x0
+  80007e:	53                   	push   %ebx
+  80007f:	ff 75 e4             	push   -0x1c(%ebp)
+  800082:	e8 a8 18 00 00       	call   80192f <ipc_send>
+		if (i == 10)
+  800087:	83 c4 10             	add    $0x10,%esp
+  80008a:	83 fb 0a             	cmp    $0xa,%ebx
+  80008d:	75 bc                	jne    80004b <umain+0x18>
+			return;
+	}
+
+}
+  80008f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800092:	5b                   	pop    %ebx
+  800093:	5e                   	pop    %esi
+  800094:	5f                   	pop    %edi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+  800097:	89 c3                	mov    %eax,%ebx
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  800099:	e8 b6 0b 00 00       	call   800c54 <sys_getenvid>
+  80009e:	83 ec 04             	sub    $0x4,%esp
+  8000a1:	53                   	push   %ebx
+  8000a2:	50                   	push   %eax
+  8000a3:	68 a0 52 80 00       	push   $0x8052a0
+  8000a8:	e8 0b 01 00 00       	call   8001b8 <cprintf>
+		ipc_send(who, 0, 0, 0);
+  8000ad:	6a 00                	push   $0x0
+  8000af:	6a 00                	push   $0x0
+  8000b1:	6a 00                	push   $0x0
+  8000b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000b6:	e8 74 18 00 00       	call   80192f <ipc_send>
+  8000bb:	83 c4 20             	add    $0x20,%esp
+  8000be:	eb 88                	jmp    800048 <umain+0x15>
+
+008000c0 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	56                   	push   %esi
+  8000c4:	53                   	push   %ebx
+  8000c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000c8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8000cb:	e8 84 0b 00 00       	call   800c54 <sys_getenvid>
+  8000d0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000d5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8000d8:	c1 e0 06             	shl    $0x6,%eax
+  8000db:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000e0:	a3 18 e9 80 00       	mov    %eax,0x80e918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000e5:	85 db                	test   %ebx,%ebx
+  8000e7:	7e 07                	jle    8000f0 <libmain+0x30>
+		binaryname = argv[0];
+  8000e9:	8b 06                	mov    (%esi),%eax
+  8000eb:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  8000f0:	83 ec 08             	sub    $0x8,%esp
+  8000f3:	56                   	push   %esi
+  8000f4:	53                   	push   %ebx
+  8000f5:	e8 39 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000fa:	e8 0a 00 00 00       	call   800109 <exit>
+}
+  8000ff:	83 c4 10             	add    $0x10,%esp
+  800102:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800105:	5b                   	pop    %ebx
+  800106:	5e                   	pop    %esi
+  800107:	5d                   	pop    %ebp
+  800108:	c3                   	ret
+
+00800109 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800109:	55                   	push   %ebp
+  80010a:	89 e5                	mov    %esp,%ebp
+  80010c:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80010f:	e8 1a 1b 00 00       	call   801c2e <close_all>
+	sys_env_destroy(0);
+  800114:	83 ec 0c             	sub    $0xc,%esp
+  800117:	6a 00                	push   $0x0
+  800119:	e8 f5 0a 00 00       	call   800c13 <sys_env_destroy>
+}
+  80011e:	83 c4 10             	add    $0x10,%esp
+  800121:	c9                   	leave
+  800122:	c3                   	ret
+
+00800123 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800123:	55                   	push   %ebp
+  800124:	89 e5                	mov    %esp,%ebp
+  800126:	53                   	push   %ebx
+  800127:	83 ec 04             	sub    $0x4,%esp
+  80012a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80012d:	8b 13                	mov    (%ebx),%edx
+  80012f:	8d 42 01             	lea    0x1(%edx),%eax
+  800132:	89 03                	mov    %eax,(%ebx)
+  800134:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800137:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80013b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800140:	74 09                	je     80014b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800142:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800146:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800149:	c9                   	leave
+  80014a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80014b:	83 ec 08             	sub    $0x8,%esp
+  80014e:	68 ff 00 00 00       	push   $0xff
+  800153:	8d 43 08             	lea    0x8(%ebx),%eax
+  800156:	50                   	push   %eax
+  800157:	e8 69 0a 00 00       	call   800bc5 <sys_cputs>
+		b->idx = 0;
+  80015c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800162:	83 c4 10             	add    $0x10,%esp
+  800165:	eb db                	jmp    800142 <putch+0x1f>
+
+00800167 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800167:	55                   	push   %ebp
+  800168:	89 e5                	mov    %esp,%ebp
+  80016a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800170:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800177:	00 00 00 
+	b.cnt = 0;
+  80017a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800181:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800184:	ff 75 0c             	push   0xc(%ebp)
+  800187:	ff 75 08             	push   0x8(%ebp)
+  80018a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800190:	50                   	push   %eax
+  800191:	68 23 01 80 00       	push   $0x800123
+  800196:	e8 14 01 00 00       	call   8002af <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80019b:	83 c4 08             	add    $0x8,%esp
+  80019e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001a4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001aa:	50                   	push   %eax
+  8001ab:	e8 15 0a 00 00       	call   800bc5 <sys_cputs>
+
+	return b.cnt;
+}
+  8001b0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001b6:	c9                   	leave
+  8001b7:	c3                   	ret
+
+008001b8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001b8:	55                   	push   %ebp
+  8001b9:	89 e5                	mov    %esp,%ebp
+  8001bb:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001be:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001c1:	50                   	push   %eax
+  8001c2:	ff 75 08             	push   0x8(%ebp)
+  8001c5:	e8 9d ff ff ff       	call   800167 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001ca:	c9                   	leave
+  8001cb:	c3                   	ret
+
+008001cc <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001cc:	55                   	push   %ebp
+  8001cd:	89 e5                	mov    %esp,%ebp
+  8001cf:	57                   	push   %edi
+  8001d0:	56                   	push   %esi
+  8001d1:	53                   	push   %ebx
+  8001d2:	83 ec 1c             	sub    $0x1c,%esp
+  8001d5:	89 c7                	mov    %eax,%edi
+  8001d7:	89 d6                	mov    %edx,%esi
+  8001d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001df:	89 d1                	mov    %edx,%ecx
+  8001e1:	89 c2                	mov    %eax,%edx
+  8001e3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001e6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001e9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001ec:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001f2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001f9:	39 c2                	cmp    %eax,%edx
+  8001fb:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001fe:	72 3e                	jb     80023e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800200:	83 ec 0c             	sub    $0xc,%esp
+  800203:	ff 75 18             	push   0x18(%ebp)
+  800206:	83 eb 01             	sub    $0x1,%ebx
+  800209:	53                   	push   %ebx
+  80020a:	50                   	push   %eax
+  80020b:	83 ec 08             	sub    $0x8,%esp
+  80020e:	ff 75 e4             	push   -0x1c(%ebp)
+  800211:	ff 75 e0             	push   -0x20(%ebp)
+  800214:	ff 75 dc             	push   -0x24(%ebp)
+  800217:	ff 75 d8             	push   -0x28(%ebp)
+  80021a:	e8 48 4f 00 00       	call   805167 <__udivdi3>
+  80021f:	83 c4 18             	add    $0x18,%esp
+  800222:	52                   	push   %edx
+  800223:	50                   	push   %eax
+  800224:	89 f2                	mov    %esi,%edx
+  800226:	89 f8                	mov    %edi,%eax
+  800228:	e8 9f ff ff ff       	call   8001cc <printnum>
+  80022d:	83 c4 20             	add    $0x20,%esp
+  800230:	eb 13                	jmp    800245 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800232:	83 ec 08             	sub    $0x8,%esp
+  800235:	56                   	push   %esi
+  800236:	ff 75 18             	push   0x18(%ebp)
+  800239:	ff d7                	call   *%edi
+  80023b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80023e:	83 eb 01             	sub    $0x1,%ebx
+  800241:	85 db                	test   %ebx,%ebx
+  800243:	7f ed                	jg     800232 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800245:	83 ec 08             	sub    $0x8,%esp
+  800248:	56                   	push   %esi
+  800249:	83 ec 04             	sub    $0x4,%esp
+  80024c:	ff 75 e4             	push   -0x1c(%ebp)
+  80024f:	ff 75 e0             	push   -0x20(%ebp)
+  800252:	ff 75 dc             	push   -0x24(%ebp)
+  800255:	ff 75 d8             	push   -0x28(%ebp)
+  800258:	e8 28 4f 00 00       	call   805185 <__umoddi3>
+  80025d:	83 c4 14             	add    $0x14,%esp
+  800260:	0f be 80 d3 52 80 00 	movsbl 0x8052d3(%eax),%eax
+  800267:	50                   	push   %eax
+  800268:	ff d7                	call   *%edi
+}
+  80026a:	83 c4 10             	add    $0x10,%esp
+  80026d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800270:	5b                   	pop    %ebx
+  800271:	5e                   	pop    %esi
+  800272:	5f                   	pop    %edi
+  800273:	5d                   	pop    %ebp
+  800274:	c3                   	ret
+
+00800275 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800275:	55                   	push   %ebp
+  800276:	89 e5                	mov    %esp,%ebp
+  800278:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80027b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80027f:	8b 10                	mov    (%eax),%edx
+  800281:	3b 50 04             	cmp    0x4(%eax),%edx
+  800284:	73 0a                	jae    800290 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800286:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800289:	89 08                	mov    %ecx,(%eax)
+  80028b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028e:	88 02                	mov    %al,(%edx)
+}
+  800290:	5d                   	pop    %ebp
+  800291:	c3                   	ret
+
+00800292 <printfmt>:
+{
+  800292:	55                   	push   %ebp
+  800293:	89 e5                	mov    %esp,%ebp
+  800295:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800298:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80029b:	50                   	push   %eax
+  80029c:	ff 75 10             	push   0x10(%ebp)
+  80029f:	ff 75 0c             	push   0xc(%ebp)
+  8002a2:	ff 75 08             	push   0x8(%ebp)
+  8002a5:	e8 05 00 00 00       	call   8002af <vprintfmt>
+}
+  8002aa:	83 c4 10             	add    $0x10,%esp
+  8002ad:	c9                   	leave
+  8002ae:	c3                   	ret
+
+008002af <vprintfmt>:
+{
+  8002af:	55                   	push   %ebp
+  8002b0:	89 e5                	mov    %esp,%ebp
+  8002b2:	57                   	push   %edi
+  8002b3:	56                   	push   %esi
+  8002b4:	53                   	push   %ebx
+  8002b5:	83 ec 2c             	sub    $0x2c,%esp
+  8002b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002be:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002c1:	eb 0a                	jmp    8002cd <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002c3:	83 ec 08             	sub    $0x8,%esp
+  8002c6:	53                   	push   %ebx
+  8002c7:	50                   	push   %eax
+  8002c8:	ff d6                	call   *%esi
+  8002ca:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002cd:	83 c7 01             	add    $0x1,%edi
+  8002d0:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002d4:	83 f8 25             	cmp    $0x25,%eax
+  8002d7:	74 0c                	je     8002e5 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	75 e6                	jne    8002c3 <vprintfmt+0x14>
+}
+  8002dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e0:	5b                   	pop    %ebx
+  8002e1:	5e                   	pop    %esi
+  8002e2:	5f                   	pop    %edi
+  8002e3:	5d                   	pop    %ebp
+  8002e4:	c3                   	ret
+		padc = ' ';
+  8002e5:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002e9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002f0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002f7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800303:	8d 47 01             	lea    0x1(%edi),%eax
+  800306:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800309:	0f b6 17             	movzbl (%edi),%edx
+  80030c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80030f:	3c 55                	cmp    $0x55,%al
+  800311:	0f 87 c5 03 00 00    	ja     8006dc <vprintfmt+0x42d>
+  800317:	0f b6 c0             	movzbl %al,%eax
+  80031a:	ff 24 85 60 54 80 00 	jmp    *0x805460(,%eax,4)
+  800321:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800324:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800328:	eb d9                	jmp    800303 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80032a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80032d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800331:	eb d0                	jmp    800303 <vprintfmt+0x54>
+  800333:	0f b6 d2             	movzbl %dl,%edx
+  800336:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800339:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800341:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800344:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800348:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80034b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80034e:	83 f9 09             	cmp    $0x9,%ecx
+  800351:	77 55                	ja     8003a8 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800353:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800356:	eb e9                	jmp    800341 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800358:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035b:	8b 00                	mov    (%eax),%eax
+  80035d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800360:	8b 45 14             	mov    0x14(%ebp),%eax
+  800363:	8d 40 04             	lea    0x4(%eax),%eax
+  800366:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800369:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80036c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800370:	79 91                	jns    800303 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800372:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800375:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800378:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80037f:	eb 82                	jmp    800303 <vprintfmt+0x54>
+			if (width < 0)
+  800381:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800384:	85 d2                	test   %edx,%edx
+  800386:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038b:	0f 49 c2             	cmovns %edx,%eax
+  80038e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800391:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800394:	e9 6a ff ff ff       	jmp    800303 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800399:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80039c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003a3:	e9 5b ff ff ff       	jmp    800303 <vprintfmt+0x54>
+  8003a8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ab:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ae:	eb bc                	jmp    80036c <vprintfmt+0xbd>
+			lflag++;
+  8003b0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003b6:	e9 48 ff ff ff       	jmp    800303 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003be:	8d 78 04             	lea    0x4(%eax),%edi
+  8003c1:	83 ec 08             	sub    $0x8,%esp
+  8003c4:	53                   	push   %ebx
+  8003c5:	ff 30                	push   (%eax)
+  8003c7:	ff d6                	call   *%esi
+			break;
+  8003c9:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003cc:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003cf:	e9 63 02 00 00       	jmp    800637 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8003d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d7:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003da:	8b 10                	mov    (%eax),%edx
+  8003dc:	89 d0                	mov    %edx,%eax
+  8003de:	f7 d8                	neg    %eax
+  8003e0:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003e3:	83 f8 12             	cmp    $0x12,%eax
+  8003e6:	7f 23                	jg     80040b <vprintfmt+0x15c>
+  8003e8:	8b 14 85 c0 55 80 00 	mov    0x8055c0(,%eax,4),%edx
+  8003ef:	85 d2                	test   %edx,%edx
+  8003f1:	74 18                	je     80040b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003f3:	52                   	push   %edx
+  8003f4:	68 25 58 80 00       	push   $0x805825
+  8003f9:	53                   	push   %ebx
+  8003fa:	56                   	push   %esi
+  8003fb:	e8 92 fe ff ff       	call   800292 <printfmt>
+  800400:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800403:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800406:	e9 2c 02 00 00       	jmp    800637 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80040b:	50                   	push   %eax
+  80040c:	68 eb 52 80 00       	push   $0x8052eb
+  800411:	53                   	push   %ebx
+  800412:	56                   	push   %esi
+  800413:	e8 7a fe ff ff       	call   800292 <printfmt>
+  800418:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80041b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80041e:	e9 14 02 00 00       	jmp    800637 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800423:	8b 45 14             	mov    0x14(%ebp),%eax
+  800426:	83 c0 04             	add    $0x4,%eax
+  800429:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80042c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800431:	85 c9                	test   %ecx,%ecx
+  800433:	b8 e4 52 80 00       	mov    $0x8052e4,%eax
+  800438:	0f 45 c1             	cmovne %ecx,%eax
+  80043b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80043e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800442:	7e 06                	jle    80044a <vprintfmt+0x19b>
+  800444:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800448:	75 0b                	jne    800455 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80044a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80044d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800450:	89 75 08             	mov    %esi,0x8(%ebp)
+  800453:	eb 5c                	jmp    8004b1 <vprintfmt+0x202>
+  800455:	83 ec 08             	sub    $0x8,%esp
+  800458:	ff 75 d0             	push   -0x30(%ebp)
+  80045b:	ff 75 cc             	push   -0x34(%ebp)
+  80045e:	e8 19 03 00 00       	call   80077c <strnlen>
+  800463:	89 c2                	mov    %eax,%edx
+  800465:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800468:	29 d0                	sub    %edx,%eax
+  80046a:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80046d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800471:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800474:	89 75 08             	mov    %esi,0x8(%ebp)
+  800477:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800479:	eb 0e                	jmp    800489 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80047b:	83 ec 08             	sub    $0x8,%esp
+  80047e:	53                   	push   %ebx
+  80047f:	57                   	push   %edi
+  800480:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800483:	83 ee 01             	sub    $0x1,%esi
+  800486:	83 c4 10             	add    $0x10,%esp
+  800489:	85 f6                	test   %esi,%esi
+  80048b:	7f ee                	jg     80047b <vprintfmt+0x1cc>
+  80048d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800490:	8b 75 08             	mov    0x8(%ebp),%esi
+  800493:	85 c0                	test   %eax,%eax
+  800495:	ba 00 00 00 00       	mov    $0x0,%edx
+  80049a:	0f 49 d0             	cmovns %eax,%edx
+  80049d:	29 d0                	sub    %edx,%eax
+  80049f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004a2:	eb a6                	jmp    80044a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004a4:	83 ec 08             	sub    $0x8,%esp
+  8004a7:	53                   	push   %ebx
+  8004a8:	52                   	push   %edx
+  8004a9:	ff 55 08             	call   *0x8(%ebp)
+  8004ac:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004af:	89 f1                	mov    %esi,%ecx
+  8004b1:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004b4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004b8:	0f be d0             	movsbl %al,%edx
+  8004bb:	85 d2                	test   %edx,%edx
+  8004bd:	74 28                	je     8004e7 <vprintfmt+0x238>
+  8004bf:	85 ff                	test   %edi,%edi
+  8004c1:	78 05                	js     8004c8 <vprintfmt+0x219>
+  8004c3:	83 ef 01             	sub    $0x1,%edi
+  8004c6:	78 30                	js     8004f8 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004c8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004cc:	74 d6                	je     8004a4 <vprintfmt+0x1f5>
+  8004ce:	0f be c0             	movsbl %al,%eax
+  8004d1:	83 e8 20             	sub    $0x20,%eax
+  8004d4:	83 f8 5e             	cmp    $0x5e,%eax
+  8004d7:	76 cb                	jbe    8004a4 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004d9:	83 ec 08             	sub    $0x8,%esp
+  8004dc:	53                   	push   %ebx
+  8004dd:	6a 3f                	push   $0x3f
+  8004df:	ff 55 08             	call   *0x8(%ebp)
+  8004e2:	83 c4 10             	add    $0x10,%esp
+  8004e5:	eb c8                	jmp    8004af <vprintfmt+0x200>
+  8004e7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ea:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ed:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004f0:	01 d0                	add    %edx,%eax
+  8004f2:	29 c8                	sub    %ecx,%eax
+  8004f4:	89 c7                	mov    %eax,%edi
+  8004f6:	eb 13                	jmp    80050b <vprintfmt+0x25c>
+  8004f8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004fb:	eb ed                	jmp    8004ea <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004fd:	83 ec 08             	sub    $0x8,%esp
+  800500:	53                   	push   %ebx
+  800501:	6a 20                	push   $0x20
+  800503:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800505:	83 ef 01             	sub    $0x1,%edi
+  800508:	83 c4 10             	add    $0x10,%esp
+  80050b:	85 ff                	test   %edi,%edi
+  80050d:	7f ee                	jg     8004fd <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80050f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800512:	89 45 14             	mov    %eax,0x14(%ebp)
+  800515:	e9 1d 01 00 00       	jmp    800637 <vprintfmt+0x388>
+	if (lflag >= 2)
+  80051a:	83 f9 01             	cmp    $0x1,%ecx
+  80051d:	7f 1b                	jg     80053a <vprintfmt+0x28b>
+	else if (lflag)
+  80051f:	85 c9                	test   %ecx,%ecx
+  800521:	74 63                	je     800586 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800523:	8b 45 14             	mov    0x14(%ebp),%eax
+  800526:	8b 00                	mov    (%eax),%eax
+  800528:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052b:	99                   	cltd
+  80052c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80052f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800532:	8d 40 04             	lea    0x4(%eax),%eax
+  800535:	89 45 14             	mov    %eax,0x14(%ebp)
+  800538:	eb 17                	jmp    800551 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80053a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053d:	8b 50 04             	mov    0x4(%eax),%edx
+  800540:	8b 00                	mov    (%eax),%eax
+  800542:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800545:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800548:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054b:	8d 40 08             	lea    0x8(%eax),%eax
+  80054e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800551:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800554:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800557:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80055c:	85 c9                	test   %ecx,%ecx
+  80055e:	0f 89 b9 00 00 00    	jns    80061d <vprintfmt+0x36e>
+				putch('-', putdat);
+  800564:	83 ec 08             	sub    $0x8,%esp
+  800567:	53                   	push   %ebx
+  800568:	6a 2d                	push   $0x2d
+  80056a:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80056c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80056f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800572:	f7 da                	neg    %edx
+  800574:	83 d1 00             	adc    $0x0,%ecx
+  800577:	f7 d9                	neg    %ecx
+  800579:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80057c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800581:	e9 97 00 00 00       	jmp    80061d <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800586:	8b 45 14             	mov    0x14(%ebp),%eax
+  800589:	8b 00                	mov    (%eax),%eax
+  80058b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80058e:	99                   	cltd
+  80058f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800592:	8b 45 14             	mov    0x14(%ebp),%eax
+  800595:	8d 40 04             	lea    0x4(%eax),%eax
+  800598:	89 45 14             	mov    %eax,0x14(%ebp)
+  80059b:	eb b4                	jmp    800551 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  80059d:	83 f9 01             	cmp    $0x1,%ecx
+  8005a0:	7f 1b                	jg     8005bd <vprintfmt+0x30e>
+	else if (lflag)
+  8005a2:	85 c9                	test   %ecx,%ecx
+  8005a4:	74 2c                	je     8005d2 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8005a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a9:	8b 10                	mov    (%eax),%edx
+  8005ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005b6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005bb:	eb 60                	jmp    80061d <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8005bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c0:	8b 10                	mov    (%eax),%edx
+  8005c2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005c5:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005cb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005d0:	eb 4b                	jmp    80061d <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8005d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d5:	8b 10                	mov    (%eax),%edx
+  8005d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8005df:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005e2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005e7:	eb 34                	jmp    80061d <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8005e9:	83 f9 01             	cmp    $0x1,%ecx
+  8005ec:	7f 15                	jg     800603 <vprintfmt+0x354>
+	else if (lflag)
+  8005ee:	85 c9                	test   %ecx,%ecx
+  8005f0:	74 4d                	je     80063f <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8005f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f5:	8b 00                	mov    (%eax),%eax
+  8005f7:	99                   	cltd
+  8005f8:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005fb:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8005fe:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800601:	eb 11                	jmp    800614 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800603:	8b 45 14             	mov    0x14(%ebp),%eax
+  800606:	8b 50 04             	mov    0x4(%eax),%edx
+  800609:	8b 00                	mov    (%eax),%eax
+  80060b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80060e:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800611:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800614:	89 d1                	mov    %edx,%ecx
+  800616:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800618:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80061d:	83 ec 0c             	sub    $0xc,%esp
+  800620:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800624:	50                   	push   %eax
+  800625:	ff 75 e0             	push   -0x20(%ebp)
+  800628:	57                   	push   %edi
+  800629:	51                   	push   %ecx
+  80062a:	52                   	push   %edx
+  80062b:	89 da                	mov    %ebx,%edx
+  80062d:	89 f0                	mov    %esi,%eax
+  80062f:	e8 98 fb ff ff       	call   8001cc <printnum>
+			break;
+  800634:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800637:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80063a:	e9 8e fc ff ff       	jmp    8002cd <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  80063f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800642:	8b 00                	mov    (%eax),%eax
+  800644:	99                   	cltd
+  800645:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800648:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80064b:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80064e:	eb c4                	jmp    800614 <vprintfmt+0x365>
+			putch('0', putdat);
+  800650:	83 ec 08             	sub    $0x8,%esp
+  800653:	53                   	push   %ebx
+  800654:	6a 30                	push   $0x30
+  800656:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800658:	83 c4 08             	add    $0x8,%esp
+  80065b:	53                   	push   %ebx
+  80065c:	6a 78                	push   $0x78
+  80065e:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800660:	8b 45 14             	mov    0x14(%ebp),%eax
+  800663:	8b 10                	mov    (%eax),%edx
+  800665:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80066a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80066d:	8d 40 04             	lea    0x4(%eax),%eax
+  800670:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800673:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800678:	eb a3                	jmp    80061d <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80067a:	83 f9 01             	cmp    $0x1,%ecx
+  80067d:	7f 1b                	jg     80069a <vprintfmt+0x3eb>
+	else if (lflag)
+  80067f:	85 c9                	test   %ecx,%ecx
+  800681:	74 2f                	je     8006b2 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800683:	8b 45 14             	mov    0x14(%ebp),%eax
+  800686:	8b 10                	mov    (%eax),%edx
+  800688:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068d:	8d 40 04             	lea    0x4(%eax),%eax
+  800690:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800693:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800698:	eb 83                	jmp    80061d <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80069a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069d:	8b 10                	mov    (%eax),%edx
+  80069f:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006a2:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006ad:	e9 6b ff ff ff       	jmp    80061d <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8006b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b5:	8b 10                	mov    (%eax),%edx
+  8006b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006c7:	e9 51 ff ff ff       	jmp    80061d <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8006cc:	83 ec 08             	sub    $0x8,%esp
+  8006cf:	53                   	push   %ebx
+  8006d0:	6a 25                	push   $0x25
+  8006d2:	ff d6                	call   *%esi
+			break;
+  8006d4:	83 c4 10             	add    $0x10,%esp
+  8006d7:	e9 5b ff ff ff       	jmp    800637 <vprintfmt+0x388>
+			putch('%', putdat);
+  8006dc:	83 ec 08             	sub    $0x8,%esp
+  8006df:	53                   	push   %ebx
+  8006e0:	6a 25                	push   $0x25
+  8006e2:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006e4:	83 c4 10             	add    $0x10,%esp
+  8006e7:	89 f8                	mov    %edi,%eax
+  8006e9:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006ed:	74 05                	je     8006f4 <vprintfmt+0x445>
+  8006ef:	83 e8 01             	sub    $0x1,%eax
+  8006f2:	eb f5                	jmp    8006e9 <vprintfmt+0x43a>
+  8006f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006f7:	e9 3b ff ff ff       	jmp    800637 <vprintfmt+0x388>
+
+008006fc <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006fc:	55                   	push   %ebp
+  8006fd:	89 e5                	mov    %esp,%ebp
+  8006ff:	83 ec 18             	sub    $0x18,%esp
+  800702:	8b 45 08             	mov    0x8(%ebp),%eax
+  800705:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800708:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80070b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80070f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800712:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800719:	85 c0                	test   %eax,%eax
+  80071b:	74 26                	je     800743 <vsnprintf+0x47>
+  80071d:	85 d2                	test   %edx,%edx
+  80071f:	7e 22                	jle    800743 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800721:	ff 75 14             	push   0x14(%ebp)
+  800724:	ff 75 10             	push   0x10(%ebp)
+  800727:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80072a:	50                   	push   %eax
+  80072b:	68 75 02 80 00       	push   $0x800275
+  800730:	e8 7a fb ff ff       	call   8002af <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800735:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800738:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80073b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80073e:	83 c4 10             	add    $0x10,%esp
+}
+  800741:	c9                   	leave
+  800742:	c3                   	ret
+		return -E_INVAL;
+  800743:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800748:	eb f7                	jmp    800741 <vsnprintf+0x45>
+
+0080074a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80074a:	55                   	push   %ebp
+  80074b:	89 e5                	mov    %esp,%ebp
+  80074d:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800750:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800753:	50                   	push   %eax
+  800754:	ff 75 10             	push   0x10(%ebp)
+  800757:	ff 75 0c             	push   0xc(%ebp)
+  80075a:	ff 75 08             	push   0x8(%ebp)
+  80075d:	e8 9a ff ff ff       	call   8006fc <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800762:	c9                   	leave
+  800763:	c3                   	ret
+
+00800764 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800764:	55                   	push   %ebp
+  800765:	89 e5                	mov    %esp,%ebp
+  800767:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80076a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076f:	eb 03                	jmp    800774 <strlen+0x10>
+		n++;
+  800771:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800774:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800778:	75 f7                	jne    800771 <strlen+0xd>
+	return n;
+}
+  80077a:	5d                   	pop    %ebp
+  80077b:	c3                   	ret
+
+0080077c <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80077c:	55                   	push   %ebp
+  80077d:	89 e5                	mov    %esp,%ebp
+  80077f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800782:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800785:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078a:	eb 03                	jmp    80078f <strnlen+0x13>
+		n++;
+  80078c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80078f:	39 d0                	cmp    %edx,%eax
+  800791:	74 08                	je     80079b <strnlen+0x1f>
+  800793:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800797:	75 f3                	jne    80078c <strnlen+0x10>
+  800799:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80079b:	89 d0                	mov    %edx,%eax
+  80079d:	5d                   	pop    %ebp
+  80079e:	c3                   	ret
+
+0080079f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80079f:	55                   	push   %ebp
+  8007a0:	89 e5                	mov    %esp,%ebp
+  8007a2:	53                   	push   %ebx
+  8007a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ae:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007b2:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007b5:	83 c0 01             	add    $0x1,%eax
+  8007b8:	84 d2                	test   %dl,%dl
+  8007ba:	75 f2                	jne    8007ae <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007bc:	89 c8                	mov    %ecx,%eax
+  8007be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c1:	c9                   	leave
+  8007c2:	c3                   	ret
+
+008007c3 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007c3:	55                   	push   %ebp
+  8007c4:	89 e5                	mov    %esp,%ebp
+  8007c6:	53                   	push   %ebx
+  8007c7:	83 ec 10             	sub    $0x10,%esp
+  8007ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007cd:	53                   	push   %ebx
+  8007ce:	e8 91 ff ff ff       	call   800764 <strlen>
+  8007d3:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007d6:	ff 75 0c             	push   0xc(%ebp)
+  8007d9:	01 d8                	add    %ebx,%eax
+  8007db:	50                   	push   %eax
+  8007dc:	e8 be ff ff ff       	call   80079f <strcpy>
+	return dst;
+}
+  8007e1:	89 d8                	mov    %ebx,%eax
+  8007e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007e6:	c9                   	leave
+  8007e7:	c3                   	ret
+
+008007e8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007e8:	55                   	push   %ebp
+  8007e9:	89 e5                	mov    %esp,%ebp
+  8007eb:	56                   	push   %esi
+  8007ec:	53                   	push   %ebx
+  8007ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007f3:	89 f3                	mov    %esi,%ebx
+  8007f5:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007f8:	89 f0                	mov    %esi,%eax
+  8007fa:	eb 0f                	jmp    80080b <strncpy+0x23>
+		*dst++ = *src;
+  8007fc:	83 c0 01             	add    $0x1,%eax
+  8007ff:	0f b6 0a             	movzbl (%edx),%ecx
+  800802:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800805:	80 f9 01             	cmp    $0x1,%cl
+  800808:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80080b:	39 d8                	cmp    %ebx,%eax
+  80080d:	75 ed                	jne    8007fc <strncpy+0x14>
+	}
+	return ret;
+}
+  80080f:	89 f0                	mov    %esi,%eax
+  800811:	5b                   	pop    %ebx
+  800812:	5e                   	pop    %esi
+  800813:	5d                   	pop    %ebp
+  800814:	c3                   	ret
+
+00800815 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800815:	55                   	push   %ebp
+  800816:	89 e5                	mov    %esp,%ebp
+  800818:	56                   	push   %esi
+  800819:	53                   	push   %ebx
+  80081a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80081d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800820:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800823:	89 f0                	mov    %esi,%eax
+  800825:	85 d2                	test   %edx,%edx
+  800827:	74 21                	je     80084a <strlcpy+0x35>
+  800829:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80082d:	89 f2                	mov    %esi,%edx
+  80082f:	eb 09                	jmp    80083a <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800831:	83 c1 01             	add    $0x1,%ecx
+  800834:	83 c2 01             	add    $0x1,%edx
+  800837:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80083a:	39 c2                	cmp    %eax,%edx
+  80083c:	74 09                	je     800847 <strlcpy+0x32>
+  80083e:	0f b6 19             	movzbl (%ecx),%ebx
+  800841:	84 db                	test   %bl,%bl
+  800843:	75 ec                	jne    800831 <strlcpy+0x1c>
+  800845:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800847:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80084a:	29 f0                	sub    %esi,%eax
+}
+  80084c:	5b                   	pop    %ebx
+  80084d:	5e                   	pop    %esi
+  80084e:	5d                   	pop    %ebp
+  80084f:	c3                   	ret
+
+00800850 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800850:	55                   	push   %ebp
+  800851:	89 e5                	mov    %esp,%ebp
+  800853:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800856:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800859:	eb 06                	jmp    800861 <strcmp+0x11>
+		p++, q++;
+  80085b:	83 c1 01             	add    $0x1,%ecx
+  80085e:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800861:	0f b6 01             	movzbl (%ecx),%eax
+  800864:	84 c0                	test   %al,%al
+  800866:	74 04                	je     80086c <strcmp+0x1c>
+  800868:	3a 02                	cmp    (%edx),%al
+  80086a:	74 ef                	je     80085b <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80086c:	0f b6 c0             	movzbl %al,%eax
+  80086f:	0f b6 12             	movzbl (%edx),%edx
+  800872:	29 d0                	sub    %edx,%eax
+}
+  800874:	5d                   	pop    %ebp
+  800875:	c3                   	ret
+
+00800876 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800876:	55                   	push   %ebp
+  800877:	89 e5                	mov    %esp,%ebp
+  800879:	53                   	push   %ebx
+  80087a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80087d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800880:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800883:	eb 09                	jmp    80088e <strncmp+0x18>
+		n--, p++, q++;
+  800885:	83 ea 01             	sub    $0x1,%edx
+  800888:	83 c0 01             	add    $0x1,%eax
+  80088b:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80088e:	85 d2                	test   %edx,%edx
+  800890:	74 18                	je     8008aa <strncmp+0x34>
+  800892:	0f b6 18             	movzbl (%eax),%ebx
+  800895:	84 db                	test   %bl,%bl
+  800897:	74 04                	je     80089d <strncmp+0x27>
+  800899:	3a 19                	cmp    (%ecx),%bl
+  80089b:	74 e8                	je     800885 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80089d:	0f b6 00             	movzbl (%eax),%eax
+  8008a0:	0f b6 11             	movzbl (%ecx),%edx
+  8008a3:	29 d0                	sub    %edx,%eax
+}
+  8008a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a8:	c9                   	leave
+  8008a9:	c3                   	ret
+		return 0;
+  8008aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008af:	eb f4                	jmp    8008a5 <strncmp+0x2f>
+
+008008b1 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008b1:	55                   	push   %ebp
+  8008b2:	89 e5                	mov    %esp,%ebp
+  8008b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008bb:	eb 03                	jmp    8008c0 <strchr+0xf>
+  8008bd:	83 c0 01             	add    $0x1,%eax
+  8008c0:	0f b6 10             	movzbl (%eax),%edx
+  8008c3:	84 d2                	test   %dl,%dl
+  8008c5:	74 06                	je     8008cd <strchr+0x1c>
+		if (*s == c)
+  8008c7:	38 ca                	cmp    %cl,%dl
+  8008c9:	75 f2                	jne    8008bd <strchr+0xc>
+  8008cb:	eb 05                	jmp    8008d2 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008d2:	5d                   	pop    %ebp
+  8008d3:	c3                   	ret
+
+008008d4 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008d4:	55                   	push   %ebp
+  8008d5:	89 e5                	mov    %esp,%ebp
+  8008d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008da:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008de:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008e1:	38 ca                	cmp    %cl,%dl
+  8008e3:	74 09                	je     8008ee <strfind+0x1a>
+  8008e5:	84 d2                	test   %dl,%dl
+  8008e7:	74 05                	je     8008ee <strfind+0x1a>
+	for (; *s; s++)
+  8008e9:	83 c0 01             	add    $0x1,%eax
+  8008ec:	eb f0                	jmp    8008de <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008ee:	5d                   	pop    %ebp
+  8008ef:	c3                   	ret
+
+008008f0 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008f0:	55                   	push   %ebp
+  8008f1:	89 e5                	mov    %esp,%ebp
+  8008f3:	57                   	push   %edi
+  8008f4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008fa:	85 c9                	test   %ecx,%ecx
+  8008fc:	74 20                	je     80091e <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008fe:	89 f8                	mov    %edi,%eax
+  800900:	09 c8                	or     %ecx,%eax
+  800902:	a8 03                	test   $0x3,%al
+  800904:	75 12                	jne    800918 <memset+0x28>
+		c &= 0xFF;
+  800906:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80090a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800910:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800913:	fc                   	cld
+  800914:	f3 ab                	rep stos %eax,%es:(%edi)
+  800916:	eb 06                	jmp    80091e <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800918:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80091b:	fc                   	cld
+  80091c:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80091e:	89 f8                	mov    %edi,%eax
+  800920:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800923:	c9                   	leave
+  800924:	c3                   	ret
+
+00800925 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800925:	55                   	push   %ebp
+  800926:	89 e5                	mov    %esp,%ebp
+  800928:	57                   	push   %edi
+  800929:	56                   	push   %esi
+  80092a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800930:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800933:	39 c6                	cmp    %eax,%esi
+  800935:	73 32                	jae    800969 <memmove+0x44>
+  800937:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80093a:	39 d0                	cmp    %edx,%eax
+  80093c:	73 2b                	jae    800969 <memmove+0x44>
+		s += n;
+		d += n;
+  80093e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800941:	89 d6                	mov    %edx,%esi
+  800943:	09 fe                	or     %edi,%esi
+  800945:	09 ce                	or     %ecx,%esi
+  800947:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80094d:	75 0e                	jne    80095d <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80094f:	83 ef 04             	sub    $0x4,%edi
+  800952:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800955:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800958:	fd                   	std
+  800959:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80095b:	eb 09                	jmp    800966 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80095d:	83 ef 01             	sub    $0x1,%edi
+  800960:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800963:	fd                   	std
+  800964:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800966:	fc                   	cld
+  800967:	eb 1a                	jmp    800983 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800969:	89 f2                	mov    %esi,%edx
+  80096b:	09 c2                	or     %eax,%edx
+  80096d:	09 ca                	or     %ecx,%edx
+  80096f:	f6 c2 03             	test   $0x3,%dl
+  800972:	75 0a                	jne    80097e <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800974:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800977:	89 c7                	mov    %eax,%edi
+  800979:	fc                   	cld
+  80097a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80097c:	eb 05                	jmp    800983 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80097e:	89 c7                	mov    %eax,%edi
+  800980:	fc                   	cld
+  800981:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800983:	5e                   	pop    %esi
+  800984:	5f                   	pop    %edi
+  800985:	5d                   	pop    %ebp
+  800986:	c3                   	ret
+
+00800987 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800987:	55                   	push   %ebp
+  800988:	89 e5                	mov    %esp,%ebp
+  80098a:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80098d:	ff 75 10             	push   0x10(%ebp)
+  800990:	ff 75 0c             	push   0xc(%ebp)
+  800993:	ff 75 08             	push   0x8(%ebp)
+  800996:	e8 8a ff ff ff       	call   800925 <memmove>
+}
+  80099b:	c9                   	leave
+  80099c:	c3                   	ret
+
+0080099d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80099d:	55                   	push   %ebp
+  80099e:	89 e5                	mov    %esp,%ebp
+  8009a0:	56                   	push   %esi
+  8009a1:	53                   	push   %ebx
+  8009a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009a8:	89 c6                	mov    %eax,%esi
+  8009aa:	03 75 10             	add    0x10(%ebp),%esi
+  8009ad:	eb 06                	jmp    8009b5 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009af:	83 c0 01             	add    $0x1,%eax
+  8009b2:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009b5:	39 f0                	cmp    %esi,%eax
+  8009b7:	74 14                	je     8009cd <memcmp+0x30>
+		if (*s1 != *s2)
+  8009b9:	0f b6 08             	movzbl (%eax),%ecx
+  8009bc:	0f b6 1a             	movzbl (%edx),%ebx
+  8009bf:	38 d9                	cmp    %bl,%cl
+  8009c1:	74 ec                	je     8009af <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009c3:	0f b6 c1             	movzbl %cl,%eax
+  8009c6:	0f b6 db             	movzbl %bl,%ebx
+  8009c9:	29 d8                	sub    %ebx,%eax
+  8009cb:	eb 05                	jmp    8009d2 <memcmp+0x35>
+	}
+
+	return 0;
+  8009cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009d2:	5b                   	pop    %ebx
+  8009d3:	5e                   	pop    %esi
+  8009d4:	5d                   	pop    %ebp
+  8009d5:	c3                   	ret
+
+008009d6 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009d6:	55                   	push   %ebp
+  8009d7:	89 e5                	mov    %esp,%ebp
+  8009d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009df:	89 c2                	mov    %eax,%edx
+  8009e1:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009e4:	eb 03                	jmp    8009e9 <memfind+0x13>
+  8009e6:	83 c0 01             	add    $0x1,%eax
+  8009e9:	39 d0                	cmp    %edx,%eax
+  8009eb:	73 04                	jae    8009f1 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009ed:	38 08                	cmp    %cl,(%eax)
+  8009ef:	75 f5                	jne    8009e6 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009f1:	5d                   	pop    %ebp
+  8009f2:	c3                   	ret
+
+008009f3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009f3:	55                   	push   %ebp
+  8009f4:	89 e5                	mov    %esp,%ebp
+  8009f6:	57                   	push   %edi
+  8009f7:	56                   	push   %esi
+  8009f8:	53                   	push   %ebx
+  8009f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009ff:	eb 03                	jmp    800a04 <strtol+0x11>
+		s++;
+  800a01:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a04:	0f b6 02             	movzbl (%edx),%eax
+  800a07:	3c 20                	cmp    $0x20,%al
+  800a09:	74 f6                	je     800a01 <strtol+0xe>
+  800a0b:	3c 09                	cmp    $0x9,%al
+  800a0d:	74 f2                	je     800a01 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a0f:	3c 2b                	cmp    $0x2b,%al
+  800a11:	74 2a                	je     800a3d <strtol+0x4a>
+	int neg = 0;
+  800a13:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a18:	3c 2d                	cmp    $0x2d,%al
+  800a1a:	74 2b                	je     800a47 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a1c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a22:	75 0f                	jne    800a33 <strtol+0x40>
+  800a24:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a27:	74 28                	je     800a51 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a29:	85 db                	test   %ebx,%ebx
+  800a2b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a30:	0f 44 d8             	cmove  %eax,%ebx
+  800a33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a38:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a3b:	eb 46                	jmp    800a83 <strtol+0x90>
+		s++;
+  800a3d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a40:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a45:	eb d5                	jmp    800a1c <strtol+0x29>
+		s++, neg = 1;
+  800a47:	83 c2 01             	add    $0x1,%edx
+  800a4a:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a4f:	eb cb                	jmp    800a1c <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a51:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a55:	74 0e                	je     800a65 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a57:	85 db                	test   %ebx,%ebx
+  800a59:	75 d8                	jne    800a33 <strtol+0x40>
+		s++, base = 8;
+  800a5b:	83 c2 01             	add    $0x1,%edx
+  800a5e:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a63:	eb ce                	jmp    800a33 <strtol+0x40>
+		s += 2, base = 16;
+  800a65:	83 c2 02             	add    $0x2,%edx
+  800a68:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a6d:	eb c4                	jmp    800a33 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a6f:	0f be c0             	movsbl %al,%eax
+  800a72:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a75:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a78:	7d 3a                	jge    800ab4 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a7a:	83 c2 01             	add    $0x1,%edx
+  800a7d:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a81:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a83:	0f b6 02             	movzbl (%edx),%eax
+  800a86:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a89:	89 f3                	mov    %esi,%ebx
+  800a8b:	80 fb 09             	cmp    $0x9,%bl
+  800a8e:	76 df                	jbe    800a6f <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a90:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a93:	89 f3                	mov    %esi,%ebx
+  800a95:	80 fb 19             	cmp    $0x19,%bl
+  800a98:	77 08                	ja     800aa2 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a9a:	0f be c0             	movsbl %al,%eax
+  800a9d:	83 e8 57             	sub    $0x57,%eax
+  800aa0:	eb d3                	jmp    800a75 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800aa2:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800aa5:	89 f3                	mov    %esi,%ebx
+  800aa7:	80 fb 19             	cmp    $0x19,%bl
+  800aaa:	77 08                	ja     800ab4 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800aac:	0f be c0             	movsbl %al,%eax
+  800aaf:	83 e8 37             	sub    $0x37,%eax
+  800ab2:	eb c1                	jmp    800a75 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ab4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ab8:	74 05                	je     800abf <strtol+0xcc>
+		*endptr = (char *) s;
+  800aba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800abd:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800abf:	89 c8                	mov    %ecx,%eax
+  800ac1:	f7 d8                	neg    %eax
+  800ac3:	85 ff                	test   %edi,%edi
+  800ac5:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ac8:	89 c8                	mov    %ecx,%eax
+  800aca:	5b                   	pop    %ebx
+  800acb:	5e                   	pop    %esi
+  800acc:	5f                   	pop    %edi
+  800acd:	5d                   	pop    %ebp
+  800ace:	c3                   	ret
+
+00800acf <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800acf:	55                   	push   %ebp
+  800ad0:	89 e5                	mov    %esp,%ebp
+  800ad2:	57                   	push   %edi
+  800ad3:	56                   	push   %esi
+  800ad4:	53                   	push   %ebx
+  800ad5:	83 ec 0c             	sub    $0xc,%esp
+  800ad8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800adb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ade:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800ae1:	85 ff                	test   %edi,%edi
+  800ae3:	74 16                	je     800afb <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800ae5:	83 ec 04             	sub    $0x4,%esp
+  800ae8:	56                   	push   %esi
+  800ae9:	6a 00                	push   $0x0
+  800aeb:	53                   	push   %ebx
+  800aec:	e8 02 ff ff ff       	call   8009f3 <strtol>
+  800af1:	89 07                	mov    %eax,(%edi)
+  800af3:	83 c4 10             	add    $0x10,%esp
+  800af6:	eb 03                	jmp    800afb <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800af8:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800afb:	0f b6 03             	movzbl (%ebx),%eax
+  800afe:	3c 20                	cmp    $0x20,%al
+  800b00:	74 f6                	je     800af8 <strisl+0x29>
+  800b02:	3c 09                	cmp    $0x9,%al
+  800b04:	74 f2                	je     800af8 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b06:	3c 2b                	cmp    $0x2b,%al
+  800b08:	74 23                	je     800b2d <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800b0a:	3c 2d                	cmp    $0x2d,%al
+  800b0c:	0f 94 c0             	sete   %al
+  800b0f:	0f b6 c0             	movzbl %al,%eax
+  800b12:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b14:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800b1a:	75 41                	jne    800b5d <strisl+0x8e>
+  800b1c:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800b1f:	74 11                	je     800b32 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b21:	85 f6                	test   %esi,%esi
+  800b23:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b28:	0f 44 f0             	cmove  %eax,%esi
+  800b2b:	eb 30                	jmp    800b5d <strisl+0x8e>
+		s++;
+  800b2d:	83 c3 01             	add    $0x1,%ebx
+  800b30:	eb e2                	jmp    800b14 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b32:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800b36:	74 0e                	je     800b46 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800b38:	85 f6                	test   %esi,%esi
+  800b3a:	75 21                	jne    800b5d <strisl+0x8e>
+		s++, base = 8;
+  800b3c:	83 c3 01             	add    $0x1,%ebx
+  800b3f:	be 08 00 00 00       	mov    $0x8,%esi
+  800b44:	eb 17                	jmp    800b5d <strisl+0x8e>
+		s += 2, base = 16;
+  800b46:	83 c3 02             	add    $0x2,%ebx
+  800b49:	be 10 00 00 00       	mov    $0x10,%esi
+  800b4e:	eb 0d                	jmp    800b5d <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b50:	0f be c0             	movsbl %al,%eax
+  800b53:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800b56:	39 f0                	cmp    %esi,%eax
+  800b58:	7d 38                	jge    800b92 <strisl+0xc3>
+			return 0;
+		s++;
+  800b5a:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800b5d:	0f b6 03             	movzbl (%ebx),%eax
+  800b60:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800b63:	80 fa 09             	cmp    $0x9,%dl
+  800b66:	76 e8                	jbe    800b50 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800b68:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800b6b:	80 fa 19             	cmp    $0x19,%dl
+  800b6e:	77 08                	ja     800b78 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800b70:	0f be c0             	movsbl %al,%eax
+  800b73:	83 e8 57             	sub    $0x57,%eax
+  800b76:	eb de                	jmp    800b56 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b78:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800b7b:	80 fa 19             	cmp    $0x19,%dl
+  800b7e:	77 08                	ja     800b88 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800b80:	0f be c0             	movsbl %al,%eax
+  800b83:	83 e8 37             	sub    $0x37,%eax
+  800b86:	eb ce                	jmp    800b56 <strisl+0x87>
+		else if (!*s)
+  800b88:	84 c0                	test   %al,%al
+  800b8a:	0f 94 c0             	sete   %al
+  800b8d:	0f b6 c0             	movzbl %al,%eax
+  800b90:	eb 05                	jmp    800b97 <strisl+0xc8>
+			return 0;
+  800b92:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800b97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b9a:	5b                   	pop    %ebx
+  800b9b:	5e                   	pop    %esi
+  800b9c:	5f                   	pop    %edi
+  800b9d:	5d                   	pop    %ebp
+  800b9e:	c3                   	ret
+
+00800b9f <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800b9f:	55                   	push   %ebp
+  800ba0:	89 e5                	mov    %esp,%ebp
+  800ba2:	83 ec 10             	sub    $0x10,%esp
+  800ba5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800ba8:	89 c8                	mov    %ecx,%eax
+  800baa:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800baf:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800bb2:	eb 0b                	jmp    800bbf <touch_mem+0x20>
+		c = *(char *)page;
+  800bb4:	0f b6 10             	movzbl (%eax),%edx
+  800bb7:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800bba:	05 00 10 00 00       	add    $0x1000,%eax
+  800bbf:	39 c8                	cmp    %ecx,%eax
+  800bc1:	72 f1                	jb     800bb4 <touch_mem+0x15>
+}
+  800bc3:	c9                   	leave
+  800bc4:	c3                   	ret
+
+00800bc5 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bc5:	55                   	push   %ebp
+  800bc6:	89 e5                	mov    %esp,%ebp
+  800bc8:	57                   	push   %edi
+  800bc9:	56                   	push   %esi
+  800bca:	53                   	push   %ebx
+	touch_mem(s, len);
+  800bcb:	ff 75 0c             	push   0xc(%ebp)
+  800bce:	ff 75 08             	push   0x8(%ebp)
+  800bd1:	e8 c9 ff ff ff       	call   800b9f <touch_mem>
+	asm volatile("int %1\n"
+  800bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be1:	89 c3                	mov    %eax,%ebx
+  800be3:	89 c7                	mov    %eax,%edi
+  800be5:	89 c6                	mov    %eax,%esi
+  800be7:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800be9:	83 c4 08             	add    $0x8,%esp
+  800bec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bef:	5b                   	pop    %ebx
+  800bf0:	5e                   	pop    %esi
+  800bf1:	5f                   	pop    %edi
+  800bf2:	5d                   	pop    %ebp
+  800bf3:	c3                   	ret
+
+00800bf4 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bf4:	55                   	push   %ebp
+  800bf5:	89 e5                	mov    %esp,%ebp
+  800bf7:	57                   	push   %edi
+  800bf8:	56                   	push   %esi
+  800bf9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bff:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c04:	89 d1                	mov    %edx,%ecx
+  800c06:	89 d3                	mov    %edx,%ebx
+  800c08:	89 d7                	mov    %edx,%edi
+  800c0a:	89 d6                	mov    %edx,%esi
+  800c0c:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c0e:	5b                   	pop    %ebx
+  800c0f:	5e                   	pop    %esi
+  800c10:	5f                   	pop    %edi
+  800c11:	5d                   	pop    %ebp
+  800c12:	c3                   	ret
+
+00800c13 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c13:	55                   	push   %ebp
+  800c14:	89 e5                	mov    %esp,%ebp
+  800c16:	57                   	push   %edi
+  800c17:	56                   	push   %esi
+  800c18:	53                   	push   %ebx
+  800c19:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c24:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c29:	89 cb                	mov    %ecx,%ebx
+  800c2b:	89 cf                	mov    %ecx,%edi
+  800c2d:	89 ce                	mov    %ecx,%esi
+  800c2f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c31:	85 c0                	test   %eax,%eax
+  800c33:	7f 08                	jg     800c3d <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c38:	5b                   	pop    %ebx
+  800c39:	5e                   	pop    %esi
+  800c3a:	5f                   	pop    %edi
+  800c3b:	5d                   	pop    %ebp
+  800c3c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c3d:	83 ec 0c             	sub    $0xc,%esp
+  800c40:	50                   	push   %eax
+  800c41:	6a 03                	push   $0x3
+  800c43:	68 2b 56 80 00       	push   $0x80562b
+  800c48:	6a 23                	push   $0x23
+  800c4a:	68 48 56 80 00       	push   $0x805648
+  800c4f:	e8 a6 42 00 00       	call   804efa <_panic>
+
+00800c54 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c54:	55                   	push   %ebp
+  800c55:	89 e5                	mov    %esp,%ebp
+  800c57:	57                   	push   %edi
+  800c58:	56                   	push   %esi
+  800c59:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c5f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c64:	89 d1                	mov    %edx,%ecx
+  800c66:	89 d3                	mov    %edx,%ebx
+  800c68:	89 d7                	mov    %edx,%edi
+  800c6a:	89 d6                	mov    %edx,%esi
+  800c6c:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c6e:	5b                   	pop    %ebx
+  800c6f:	5e                   	pop    %esi
+  800c70:	5f                   	pop    %edi
+  800c71:	5d                   	pop    %ebp
+  800c72:	c3                   	ret
+
+00800c73 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c73:	55                   	push   %ebp
+  800c74:	89 e5                	mov    %esp,%ebp
+  800c76:	57                   	push   %edi
+  800c77:	56                   	push   %esi
+  800c78:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c79:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c7e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c83:	89 d1                	mov    %edx,%ecx
+  800c85:	89 d3                	mov    %edx,%ebx
+  800c87:	89 d7                	mov    %edx,%edi
+  800c89:	89 d6                	mov    %edx,%esi
+  800c8b:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c8d:	5b                   	pop    %ebx
+  800c8e:	5e                   	pop    %esi
+  800c8f:	5f                   	pop    %edi
+  800c90:	5d                   	pop    %ebp
+  800c91:	c3                   	ret
+
+00800c92 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c92:	55                   	push   %ebp
+  800c93:	89 e5                	mov    %esp,%ebp
+  800c95:	57                   	push   %edi
+  800c96:	56                   	push   %esi
+  800c97:	53                   	push   %ebx
+  800c98:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c9b:	be 00 00 00 00       	mov    $0x0,%esi
+  800ca0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca6:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cae:	89 f7                	mov    %esi,%edi
+  800cb0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cb2:	85 c0                	test   %eax,%eax
+  800cb4:	7f 08                	jg     800cbe <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb9:	5b                   	pop    %ebx
+  800cba:	5e                   	pop    %esi
+  800cbb:	5f                   	pop    %edi
+  800cbc:	5d                   	pop    %ebp
+  800cbd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cbe:	83 ec 0c             	sub    $0xc,%esp
+  800cc1:	50                   	push   %eax
+  800cc2:	6a 04                	push   $0x4
+  800cc4:	68 2b 56 80 00       	push   $0x80562b
+  800cc9:	6a 23                	push   $0x23
+  800ccb:	68 48 56 80 00       	push   $0x805648
+  800cd0:	e8 25 42 00 00       	call   804efa <_panic>
+
+00800cd5 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cd5:	55                   	push   %ebp
+  800cd6:	89 e5                	mov    %esp,%ebp
+  800cd8:	57                   	push   %edi
+  800cd9:	56                   	push   %esi
+  800cda:	53                   	push   %ebx
+  800cdb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce4:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ce9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cef:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cf2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cf4:	85 c0                	test   %eax,%eax
+  800cf6:	7f 08                	jg     800d00 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cfb:	5b                   	pop    %ebx
+  800cfc:	5e                   	pop    %esi
+  800cfd:	5f                   	pop    %edi
+  800cfe:	5d                   	pop    %ebp
+  800cff:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d00:	83 ec 0c             	sub    $0xc,%esp
+  800d03:	50                   	push   %eax
+  800d04:	6a 05                	push   $0x5
+  800d06:	68 2b 56 80 00       	push   $0x80562b
+  800d0b:	6a 23                	push   $0x23
+  800d0d:	68 48 56 80 00       	push   $0x805648
+  800d12:	e8 e3 41 00 00       	call   804efa <_panic>
+
+00800d17 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d17:	55                   	push   %ebp
+  800d18:	89 e5                	mov    %esp,%ebp
+  800d1a:	57                   	push   %edi
+  800d1b:	56                   	push   %esi
+  800d1c:	53                   	push   %ebx
+  800d1d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d30:	89 df                	mov    %ebx,%edi
+  800d32:	89 de                	mov    %ebx,%esi
+  800d34:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d36:	85 c0                	test   %eax,%eax
+  800d38:	7f 08                	jg     800d42 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3d:	5b                   	pop    %ebx
+  800d3e:	5e                   	pop    %esi
+  800d3f:	5f                   	pop    %edi
+  800d40:	5d                   	pop    %ebp
+  800d41:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d42:	83 ec 0c             	sub    $0xc,%esp
+  800d45:	50                   	push   %eax
+  800d46:	6a 06                	push   $0x6
+  800d48:	68 2b 56 80 00       	push   $0x80562b
+  800d4d:	6a 23                	push   $0x23
+  800d4f:	68 48 56 80 00       	push   $0x805648
+  800d54:	e8 a1 41 00 00       	call   804efa <_panic>
+
+00800d59 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800d59:	55                   	push   %ebp
+  800d5a:	89 e5                	mov    %esp,%ebp
+  800d5c:	57                   	push   %edi
+  800d5d:	56                   	push   %esi
+  800d5e:	53                   	push   %ebx
+  800d5f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d67:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6d:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d72:	89 df                	mov    %ebx,%edi
+  800d74:	89 de                	mov    %ebx,%esi
+  800d76:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d78:	85 c0                	test   %eax,%eax
+  800d7a:	7f 08                	jg     800d84 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d7f:	5b                   	pop    %ebx
+  800d80:	5e                   	pop    %esi
+  800d81:	5f                   	pop    %edi
+  800d82:	5d                   	pop    %ebp
+  800d83:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d84:	83 ec 0c             	sub    $0xc,%esp
+  800d87:	50                   	push   %eax
+  800d88:	6a 18                	push   $0x18
+  800d8a:	68 2b 56 80 00       	push   $0x80562b
+  800d8f:	6a 23                	push   $0x23
+  800d91:	68 48 56 80 00       	push   $0x805648
+  800d96:	e8 5f 41 00 00       	call   804efa <_panic>
+
+00800d9b <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800d9b:	55                   	push   %ebp
+  800d9c:	89 e5                	mov    %esp,%ebp
+  800d9e:	57                   	push   %edi
+  800d9f:	56                   	push   %esi
+  800da0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800da1:	be 00 00 00 00       	mov    $0x0,%esi
+  800da6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dac:	b8 19 00 00 00       	mov    $0x19,%eax
+  800db1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db4:	89 f7                	mov    %esi,%edi
+  800db6:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800db8:	5b                   	pop    %ebx
+  800db9:	5e                   	pop    %esi
+  800dba:	5f                   	pop    %edi
+  800dbb:	5d                   	pop    %ebp
+  800dbc:	c3                   	ret
+
+00800dbd <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800dbd:	55                   	push   %ebp
+  800dbe:	89 e5                	mov    %esp,%ebp
+  800dc0:	57                   	push   %edi
+  800dc1:	56                   	push   %esi
+  800dc2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800dce:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dd9:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800ddb:	5b                   	pop    %ebx
+  800ddc:	5e                   	pop    %esi
+  800ddd:	5f                   	pop    %edi
+  800dde:	5d                   	pop    %ebp
+  800ddf:	c3                   	ret
+
+00800de0 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800de0:	55                   	push   %ebp
+  800de1:	89 e5                	mov    %esp,%ebp
+  800de3:	57                   	push   %edi
+  800de4:	56                   	push   %esi
+  800de5:	53                   	push   %ebx
+  800de6:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800de9:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800dec:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800df2:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800df5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfb:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e03:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e06:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e08:	85 c0                	test   %eax,%eax
+  800e0a:	7f 08                	jg     800e14 <sys_page_map_range+0x34>
+}
+  800e0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0f:	5b                   	pop    %ebx
+  800e10:	5e                   	pop    %esi
+  800e11:	5f                   	pop    %edi
+  800e12:	5d                   	pop    %ebp
+  800e13:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e14:	83 ec 0c             	sub    $0xc,%esp
+  800e17:	50                   	push   %eax
+  800e18:	6a 10                	push   $0x10
+  800e1a:	68 2b 56 80 00       	push   $0x80562b
+  800e1f:	6a 23                	push   $0x23
+  800e21:	68 48 56 80 00       	push   $0x805648
+  800e26:	e8 cf 40 00 00       	call   804efa <_panic>
+
+00800e2b <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e2b:	55                   	push   %ebp
+  800e2c:	89 e5                	mov    %esp,%ebp
+  800e2e:	57                   	push   %edi
+  800e2f:	56                   	push   %esi
+  800e30:	53                   	push   %ebx
+  800e31:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e34:	be 00 00 00 00       	mov    $0x0,%esi
+  800e39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3f:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e47:	89 f7                	mov    %esi,%edi
+  800e49:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e4b:	85 c0                	test   %eax,%eax
+  800e4d:	7f 08                	jg     800e57 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e52:	5b                   	pop    %ebx
+  800e53:	5e                   	pop    %esi
+  800e54:	5f                   	pop    %edi
+  800e55:	5d                   	pop    %ebp
+  800e56:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e57:	83 ec 0c             	sub    $0xc,%esp
+  800e5a:	50                   	push   %eax
+  800e5b:	6a 11                	push   $0x11
+  800e5d:	68 2b 56 80 00       	push   $0x80562b
+  800e62:	6a 23                	push   $0x23
+  800e64:	68 48 56 80 00       	push   $0x805648
+  800e69:	e8 8c 40 00 00       	call   804efa <_panic>
+
+00800e6e <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800e6e:	55                   	push   %ebp
+  800e6f:	89 e5                	mov    %esp,%ebp
+  800e71:	57                   	push   %edi
+  800e72:	56                   	push   %esi
+  800e73:	53                   	push   %ebx
+  800e74:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e77:	be 00 00 00 00       	mov    $0x0,%esi
+  800e7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e82:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800e87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8a:	89 f7                	mov    %esi,%edi
+  800e8c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e8e:	85 c0                	test   %eax,%eax
+  800e90:	7f 08                	jg     800e9a <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e95:	5b                   	pop    %ebx
+  800e96:	5e                   	pop    %esi
+  800e97:	5f                   	pop    %edi
+  800e98:	5d                   	pop    %ebp
+  800e99:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9a:	83 ec 0c             	sub    $0xc,%esp
+  800e9d:	50                   	push   %eax
+  800e9e:	6a 1b                	push   $0x1b
+  800ea0:	68 2b 56 80 00       	push   $0x80562b
+  800ea5:	6a 23                	push   $0x23
+  800ea7:	68 48 56 80 00       	push   $0x805648
+  800eac:	e8 49 40 00 00       	call   804efa <_panic>
+
+00800eb1 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800eb1:	55                   	push   %ebp
+  800eb2:	89 e5                	mov    %esp,%ebp
+  800eb4:	57                   	push   %edi
+  800eb5:	56                   	push   %esi
+  800eb6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ebc:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ec1:	89 d1                	mov    %edx,%ecx
+  800ec3:	89 d3                	mov    %edx,%ebx
+  800ec5:	89 d7                	mov    %edx,%edi
+  800ec7:	89 d6                	mov    %edx,%esi
+  800ec9:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800ecb:	5b                   	pop    %ebx
+  800ecc:	5e                   	pop    %esi
+  800ecd:	5f                   	pop    %edi
+  800ece:	5d                   	pop    %ebp
+  800ecf:	c3                   	ret
+
+00800ed0 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ed0:	55                   	push   %ebp
+  800ed1:	89 e5                	mov    %esp,%ebp
+  800ed3:	57                   	push   %edi
+  800ed4:	56                   	push   %esi
+  800ed5:	53                   	push   %ebx
+  800ed6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ede:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee4:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ee9:	89 df                	mov    %ebx,%edi
+  800eeb:	89 de                	mov    %ebx,%esi
+  800eed:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eef:	85 c0                	test   %eax,%eax
+  800ef1:	7f 08                	jg     800efb <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ef3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef6:	5b                   	pop    %ebx
+  800ef7:	5e                   	pop    %esi
+  800ef8:	5f                   	pop    %edi
+  800ef9:	5d                   	pop    %ebp
+  800efa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800efb:	83 ec 0c             	sub    $0xc,%esp
+  800efe:	50                   	push   %eax
+  800eff:	6a 08                	push   $0x8
+  800f01:	68 2b 56 80 00       	push   $0x80562b
+  800f06:	6a 23                	push   $0x23
+  800f08:	68 48 56 80 00       	push   $0x805648
+  800f0d:	e8 e8 3f 00 00       	call   804efa <_panic>
+
+00800f12 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f12:	55                   	push   %ebp
+  800f13:	89 e5                	mov    %esp,%ebp
+  800f15:	57                   	push   %edi
+  800f16:	56                   	push   %esi
+  800f17:	53                   	push   %ebx
+  800f18:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800f1b:	6a 44                	push   $0x44
+  800f1d:	ff 75 0c             	push   0xc(%ebp)
+  800f20:	e8 7a fc ff ff       	call   800b9f <touch_mem>
+	asm volatile("int %1\n"
+  800f25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2d:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f35:	89 df                	mov    %ebx,%edi
+  800f37:	89 de                	mov    %ebx,%esi
+  800f39:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f3b:	83 c4 08             	add    $0x8,%esp
+  800f3e:	85 c0                	test   %eax,%eax
+  800f40:	7f 08                	jg     800f4a <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f45:	5b                   	pop    %ebx
+  800f46:	5e                   	pop    %esi
+  800f47:	5f                   	pop    %edi
+  800f48:	5d                   	pop    %ebp
+  800f49:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f4a:	83 ec 0c             	sub    $0xc,%esp
+  800f4d:	50                   	push   %eax
+  800f4e:	6a 09                	push   $0x9
+  800f50:	68 2b 56 80 00       	push   $0x80562b
+  800f55:	6a 23                	push   $0x23
+  800f57:	68 48 56 80 00       	push   $0x805648
+  800f5c:	e8 99 3f 00 00       	call   804efa <_panic>
+
+00800f61 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800f61:	55                   	push   %ebp
+  800f62:	89 e5                	mov    %esp,%ebp
+  800f64:	57                   	push   %edi
+  800f65:	56                   	push   %esi
+  800f66:	53                   	push   %ebx
+  800f67:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f6a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f75:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800f7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f7d:	89 f7                	mov    %esi,%edi
+  800f7f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f81:	85 c0                	test   %eax,%eax
+  800f83:	7f 08                	jg     800f8d <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800f85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f88:	5b                   	pop    %ebx
+  800f89:	5e                   	pop    %esi
+  800f8a:	5f                   	pop    %edi
+  800f8b:	5d                   	pop    %ebp
+  800f8c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f8d:	83 ec 0c             	sub    $0xc,%esp
+  800f90:	50                   	push   %eax
+  800f91:	6a 1a                	push   $0x1a
+  800f93:	68 2b 56 80 00       	push   $0x80562b
+  800f98:	6a 23                	push   $0x23
+  800f9a:	68 48 56 80 00       	push   $0x805648
+  800f9f:	e8 56 3f 00 00       	call   804efa <_panic>
+
+00800fa4 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  800fa4:	55                   	push   %ebp
+  800fa5:	89 e5                	mov    %esp,%ebp
+  800fa7:	57                   	push   %edi
+  800fa8:	56                   	push   %esi
+  800fa9:	53                   	push   %ebx
+  800faa:	83 ec 0c             	sub    $0xc,%esp
+  800fad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  800fb0:	89 d8                	mov    %ebx,%eax
+  800fb2:	c1 e0 05             	shl    $0x5,%eax
+  800fb5:	50                   	push   %eax
+  800fb6:	ff 75 0c             	push   0xc(%ebp)
+  800fb9:	e8 e1 fb ff ff       	call   800b9f <touch_mem>
+	asm volatile("int %1\n"
+  800fbe:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc6:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fcb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fce:	89 f7                	mov    %esi,%edi
+  800fd0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd2:	83 c4 08             	add    $0x8,%esp
+  800fd5:	85 c0                	test   %eax,%eax
+  800fd7:	7f 08                	jg     800fe1 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  800fd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdc:	5b                   	pop    %ebx
+  800fdd:	5e                   	pop    %esi
+  800fde:	5f                   	pop    %edi
+  800fdf:	5d                   	pop    %ebp
+  800fe0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe1:	83 ec 0c             	sub    $0xc,%esp
+  800fe4:	50                   	push   %eax
+  800fe5:	6a 13                	push   $0x13
+  800fe7:	68 2b 56 80 00       	push   $0x80562b
+  800fec:	6a 23                	push   $0x23
+  800fee:	68 48 56 80 00       	push   $0x805648
+  800ff3:	e8 02 3f 00 00       	call   804efa <_panic>
+
+00800ff8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ff8:	55                   	push   %ebp
+  800ff9:	89 e5                	mov    %esp,%ebp
+  800ffb:	57                   	push   %edi
+  800ffc:	56                   	push   %esi
+  800ffd:	53                   	push   %ebx
+  800ffe:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801001:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801006:	8b 55 08             	mov    0x8(%ebp),%edx
+  801009:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801011:	89 df                	mov    %ebx,%edi
+  801013:	89 de                	mov    %ebx,%esi
+  801015:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801017:	85 c0                	test   %eax,%eax
+  801019:	7f 08                	jg     801023 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80101b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101e:	5b                   	pop    %ebx
+  80101f:	5e                   	pop    %esi
+  801020:	5f                   	pop    %edi
+  801021:	5d                   	pop    %ebp
+  801022:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801023:	83 ec 0c             	sub    $0xc,%esp
+  801026:	50                   	push   %eax
+  801027:	6a 0a                	push   $0xa
+  801029:	68 2b 56 80 00       	push   $0x80562b
+  80102e:	6a 23                	push   $0x23
+  801030:	68 48 56 80 00       	push   $0x805648
+  801035:	e8 c0 3e 00 00       	call   804efa <_panic>
+
+0080103a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80103a:	55                   	push   %ebp
+  80103b:	89 e5                	mov    %esp,%ebp
+  80103d:	57                   	push   %edi
+  80103e:	56                   	push   %esi
+  80103f:	53                   	push   %ebx
+  801040:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801043:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801049:	76 1d                	jbe    801068 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80104b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801051:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801056:	be 01 00 00 00       	mov    $0x1,%esi
+  80105b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80105e:	cd 30                	int    $0x30
+}
+  801060:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801063:	5b                   	pop    %ebx
+  801064:	5e                   	pop    %esi
+  801065:	5f                   	pop    %edi
+  801066:	5d                   	pop    %ebp
+  801067:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801068:	68 00 10 00 00       	push   $0x1000
+  80106d:	53                   	push   %ebx
+  80106e:	e8 2c fb ff ff       	call   800b9f <touch_mem>
+  801073:	83 c4 08             	add    $0x8,%esp
+  801076:	eb d3                	jmp    80104b <sys_ipc_send+0x11>
+
+00801078 <sys_ipc_send_pages>:
+{
+  801078:	55                   	push   %ebp
+  801079:	89 e5                	mov    %esp,%ebp
+  80107b:	57                   	push   %edi
+  80107c:	56                   	push   %esi
+  80107d:	53                   	push   %ebx
+  80107e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801081:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801084:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80108a:	76 18                	jbe    8010a4 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80108c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801092:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801097:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80109a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  80109c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109f:	5b                   	pop    %ebx
+  8010a0:	5e                   	pop    %esi
+  8010a1:	5f                   	pop    %edi
+  8010a2:	5d                   	pop    %ebp
+  8010a3:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8010a4:	89 f0                	mov    %esi,%eax
+  8010a6:	c1 e0 0c             	shl    $0xc,%eax
+  8010a9:	50                   	push   %eax
+  8010aa:	53                   	push   %ebx
+  8010ab:	e8 ef fa ff ff       	call   800b9f <touch_mem>
+  8010b0:	83 c4 08             	add    $0x8,%esp
+  8010b3:	eb d7                	jmp    80108c <sys_ipc_send_pages+0x14>
+
+008010b5 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8010b5:	55                   	push   %ebp
+  8010b6:	89 e5                	mov    %esp,%ebp
+  8010b8:	57                   	push   %edi
+  8010b9:	56                   	push   %esi
+  8010ba:	53                   	push   %ebx
+  8010bb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010ce:	89 df                	mov    %ebx,%edi
+  8010d0:	89 de                	mov    %ebx,%esi
+  8010d2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010d4:	85 c0                	test   %eax,%eax
+  8010d6:	7f 08                	jg     8010e0 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8010d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010db:	5b                   	pop    %ebx
+  8010dc:	5e                   	pop    %esi
+  8010dd:	5f                   	pop    %edi
+  8010de:	5d                   	pop    %ebp
+  8010df:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e0:	83 ec 0c             	sub    $0xc,%esp
+  8010e3:	50                   	push   %eax
+  8010e4:	6a 0d                	push   $0xd
+  8010e6:	68 2b 56 80 00       	push   $0x80562b
+  8010eb:	6a 23                	push   $0x23
+  8010ed:	68 48 56 80 00       	push   $0x805648
+  8010f2:	e8 03 3e 00 00       	call   804efa <_panic>
+
+008010f7 <sys_ipc_recv>:
+{
+  8010f7:	55                   	push   %ebp
+  8010f8:	89 e5                	mov    %esp,%ebp
+  8010fa:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8010fd:	6a 01                	push   $0x1
+  8010ff:	ff 75 08             	push   0x8(%ebp)
+  801102:	e8 ae ff ff ff       	call   8010b5 <sys_ipc_recv_pages>
+}
+  801107:	c9                   	leave
+  801108:	c3                   	ret
+
+00801109 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801109:	55                   	push   %ebp
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	57                   	push   %edi
+  80110d:	56                   	push   %esi
+  80110e:	53                   	push   %ebx
+  80110f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801112:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801115:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801118:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80111e:	77 04                	ja     801124 <sys_ipc_call+0x1b>
+  801120:	85 f6                	test   %esi,%esi
+  801122:	75 15                	jne    801139 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801124:	8b 55 08             	mov    0x8(%ebp),%edx
+  801127:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80112f:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801131:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801134:	5b                   	pop    %ebx
+  801135:	5e                   	pop    %esi
+  801136:	5f                   	pop    %edi
+  801137:	5d                   	pop    %ebp
+  801138:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  801139:	89 f8                	mov    %edi,%eax
+  80113b:	c1 e0 0c             	shl    $0xc,%eax
+  80113e:	50                   	push   %eax
+  80113f:	53                   	push   %ebx
+  801140:	e8 5a fa ff ff       	call   800b9f <touch_mem>
+  801145:	83 c4 08             	add    $0x8,%esp
+  801148:	eb da                	jmp    801124 <sys_ipc_call+0x1b>
+
+0080114a <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80114a:	55                   	push   %ebp
+  80114b:	89 e5                	mov    %esp,%ebp
+  80114d:	57                   	push   %edi
+  80114e:	56                   	push   %esi
+  80114f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801150:	8b 55 08             	mov    0x8(%ebp),%edx
+  801153:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801156:	b8 15 00 00 00       	mov    $0x15,%eax
+  80115b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801161:	8b 75 18             	mov    0x18(%ebp),%esi
+  801164:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801166:	5b                   	pop    %ebx
+  801167:	5e                   	pop    %esi
+  801168:	5f                   	pop    %edi
+  801169:	5d                   	pop    %ebp
+  80116a:	c3                   	ret
+
+0080116b <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  80116b:	55                   	push   %ebp
+  80116c:	89 e5                	mov    %esp,%ebp
+  80116e:	57                   	push   %edi
+  80116f:	56                   	push   %esi
+  801170:	53                   	push   %ebx
+  801171:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801174:	6a 04                	push   $0x4
+  801176:	ff 75 08             	push   0x8(%ebp)
+  801179:	e8 21 fa ff ff       	call   800b9f <touch_mem>
+	asm volatile("int %1\n"
+  80117e:	be 00 00 00 00       	mov    $0x0,%esi
+  801183:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801186:	b8 16 00 00 00       	mov    $0x16,%eax
+  80118b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801191:	89 f7                	mov    %esi,%edi
+  801193:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801195:	83 c4 08             	add    $0x8,%esp
+  801198:	85 c0                	test   %eax,%eax
+  80119a:	7f 08                	jg     8011a4 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  80119c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80119f:	5b                   	pop    %ebx
+  8011a0:	5e                   	pop    %esi
+  8011a1:	5f                   	pop    %edi
+  8011a2:	5d                   	pop    %ebp
+  8011a3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a4:	83 ec 0c             	sub    $0xc,%esp
+  8011a7:	50                   	push   %eax
+  8011a8:	6a 16                	push   $0x16
+  8011aa:	68 2b 56 80 00       	push   $0x80562b
+  8011af:	6a 23                	push   $0x23
+  8011b1:	68 48 56 80 00       	push   $0x805648
+  8011b6:	e8 3f 3d 00 00       	call   804efa <_panic>
+
+008011bb <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8011bb:	55                   	push   %ebp
+  8011bc:	89 e5                	mov    %esp,%ebp
+  8011be:	57                   	push   %edi
+  8011bf:	56                   	push   %esi
+  8011c0:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8011c1:	6a 04                	push   $0x4
+  8011c3:	ff 75 08             	push   0x8(%ebp)
+  8011c6:	e8 d4 f9 ff ff       	call   800b9f <touch_mem>
+	asm volatile("int %1\n"
+  8011cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d3:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011db:	89 df                	mov    %ebx,%edi
+  8011dd:	89 de                	mov    %ebx,%esi
+  8011df:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8011e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e4:	5b                   	pop    %ebx
+  8011e5:	5e                   	pop    %esi
+  8011e6:	5f                   	pop    %edi
+  8011e7:	5d                   	pop    %ebp
+  8011e8:	c3                   	ret
+
+008011e9 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8011e9:	55                   	push   %ebp
+  8011ea:	89 e5                	mov    %esp,%ebp
+  8011ec:	57                   	push   %edi
+  8011ed:	56                   	push   %esi
+  8011ee:	53                   	push   %ebx
+  8011ef:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fa:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011ff:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801204:	89 df                	mov    %ebx,%edi
+  801206:	89 de                	mov    %ebx,%esi
+  801208:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80120a:	85 c0                	test   %eax,%eax
+  80120c:	7f 08                	jg     801216 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80120e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801211:	5b                   	pop    %ebx
+  801212:	5e                   	pop    %esi
+  801213:	5f                   	pop    %edi
+  801214:	5d                   	pop    %ebp
+  801215:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801216:	83 ec 0c             	sub    $0xc,%esp
+  801219:	50                   	push   %eax
+  80121a:	6a 0e                	push   $0xe
+  80121c:	68 2b 56 80 00       	push   $0x80562b
+  801221:	6a 23                	push   $0x23
+  801223:	68 48 56 80 00       	push   $0x805648
+  801228:	e8 cd 3c 00 00       	call   804efa <_panic>
+
+0080122d <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  80122d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801234:	f6 c6 06             	test   $0x6,%dh
+  801237:	75 37                	jne    801270 <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  801239:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801240:	f6 c2 02             	test   $0x2,%dl
+  801243:	75 19                	jne    80125e <dupperm+0x31>
+  801245:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80124c:	f6 c6 08             	test   $0x8,%dh
+  80124f:	75 0d                	jne    80125e <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  801251:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801258:	25 07 0e 00 00       	and    $0xe07,%eax
+  80125d:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  80125e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801265:	25 00 06 00 00       	and    $0x600,%eax
+  80126a:	0d 05 08 00 00       	or     $0x805,%eax
+  80126f:	c3                   	ret
+		return 0;
+  801270:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801275:	c3                   	ret
+
+00801276 <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  801276:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  801278:	c1 e0 0c             	shl    $0xc,%eax
+  80127b:	c1 e8 16             	shr    $0x16,%eax
+  80127e:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801285:	f6 c1 01             	test   $0x1,%cl
+  801288:	74 2c                	je     8012b6 <dupable+0x40>
+  80128a:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801291:	b8 00 00 00 00       	mov    $0x0,%eax
+  801296:	f6 c1 04             	test   $0x4,%cl
+  801299:	74 20                	je     8012bb <dupable+0x45>
+  80129b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8012a2:	f6 c1 01             	test   $0x1,%cl
+  8012a5:	74 14                	je     8012bb <dupable+0x45>
+  8012a7:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8012ae:	c1 e8 02             	shr    $0x2,%eax
+  8012b1:	83 e0 01             	and    $0x1,%eax
+  8012b4:	eb 05                	jmp    8012bb <dupable+0x45>
+  8012b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012bb:	83 e0 01             	and    $0x1,%eax
+}
+  8012be:	c3                   	ret
+
+008012bf <pgfault>:
+{
+  8012bf:	55                   	push   %ebp
+  8012c0:	89 e5                	mov    %esp,%ebp
+  8012c2:	56                   	push   %esi
+  8012c3:	53                   	push   %ebx
+  8012c4:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8012c7:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  8012c9:	89 ca                	mov    %ecx,%edx
+  8012cb:	c1 ea 0c             	shr    $0xc,%edx
+  8012ce:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  8012d5:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8012d9:	0f 84 8e 00 00 00    	je     80136d <pgfault+0xae>
+		return 0;
+  8012df:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  8012e4:	f6 c6 08             	test   $0x8,%dh
+  8012e7:	0f 84 85 00 00 00    	je     801372 <pgfault+0xb3>
+	perm |= PTE_W;
+  8012ed:	81 e2 07 06 00 00    	and    $0x607,%edx
+  8012f3:	89 d3                	mov    %edx,%ebx
+  8012f5:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8012f8:	89 ce                	mov    %ecx,%esi
+  8012fa:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  801300:	6a 01                	push   $0x1
+  801302:	53                   	push   %ebx
+  801303:	68 00 f0 7f 00       	push   $0x7ff000
+  801308:	6a 00                	push   $0x0
+  80130a:	e8 bb 29 00 00       	call   803cca <page_alloc>
+  80130f:	83 c4 10             	add    $0x10,%esp
+  801312:	85 c0                	test   %eax,%eax
+  801314:	78 33                	js     801349 <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  801316:	83 ec 04             	sub    $0x4,%esp
+  801319:	68 00 10 00 00       	push   $0x1000
+  80131e:	56                   	push   %esi
+  80131f:	68 00 f0 7f 00       	push   $0x7ff000
+  801324:	e8 fc f5 ff ff       	call   800925 <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  801329:	89 1c 24             	mov    %ebx,(%esp)
+  80132c:	56                   	push   %esi
+  80132d:	6a 00                	push   $0x0
+  80132f:	68 00 f0 7f 00       	push   $0x7ff000
+  801334:	6a 00                	push   $0x0
+  801336:	e8 f0 2f 00 00       	call   80432b <page_map>
+  80133b:	83 c4 20             	add    $0x20,%esp
+  80133e:	85 c0                	test   %eax,%eax
+  801340:	78 19                	js     80135b <pgfault+0x9c>
+	return 1;
+  801342:	b8 01 00 00 00       	mov    $0x1,%eax
+  801347:	eb 29                	jmp    801372 <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  801349:	50                   	push   %eax
+  80134a:	68 58 56 80 00       	push   $0x805658
+  80134f:	6a 2e                	push   $0x2e
+  801351:	68 ab 56 80 00       	push   $0x8056ab
+  801356:	e8 9f 3b 00 00       	call   804efa <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  80135b:	50                   	push   %eax
+  80135c:	68 84 56 80 00       	push   $0x805684
+  801361:	6a 32                	push   $0x32
+  801363:	68 ab 56 80 00       	push   $0x8056ab
+  801368:	e8 8d 3b 00 00       	call   804efa <_panic>
+		return 0;
+  80136d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801372:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801375:	5b                   	pop    %ebx
+  801376:	5e                   	pop    %esi
+  801377:	5d                   	pop    %ebp
+  801378:	c3                   	ret
+
+00801379 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  801379:	55                   	push   %ebp
+  80137a:	89 e5                	mov    %esp,%ebp
+  80137c:	57                   	push   %edi
+  80137d:	56                   	push   %esi
+  80137e:	53                   	push   %ebx
+  80137f:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  801382:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  801389:	74 5d                	je     8013e8 <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  80138b:	83 ec 0c             	sub    $0xc,%esp
+  80138e:	68 bf 12 80 00       	push   $0x8012bf
+  801393:	e8 3a 3c 00 00       	call   804fd2 <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  801398:	e8 14 fb ff ff       	call   800eb1 <sys_fork>
+  80139d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8013a0:	83 c4 10             	add    $0x10,%esp
+  8013a3:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8013a6:	74 47                	je     8013ef <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  8013a8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8013ac:	0f 84 c5 03 00 00    	je     801777 <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  8013b2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8013b6:	78 25                	js     8013dd <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  8013b8:	e8 85 22 00 00       	call   803642 <page_share_paged_out>
+  8013bd:	85 c0                	test   %eax,%eax
+  8013bf:	0f 88 d8 03 00 00    	js     80179d <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  8013c5:	83 ec 08             	sub    $0x8,%esp
+  8013c8:	6a 02                	push   $0x2
+  8013ca:	ff 75 e4             	push   -0x1c(%ebp)
+  8013cd:	e8 fe fa ff ff       	call   800ed0 <sys_env_set_status>
+  8013d2:	83 c4 10             	add    $0x10,%esp
+  8013d5:	85 c0                	test   %eax,%eax
+  8013d7:	0f 88 d5 03 00 00    	js     8017b2 <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  8013dd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8013e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e3:	5b                   	pop    %ebx
+  8013e4:	5e                   	pop    %esi
+  8013e5:	5f                   	pop    %edi
+  8013e6:	5d                   	pop    %ebp
+  8013e7:	c3                   	ret
+		init_map_dir();
+  8013e8:	e8 5d 25 00 00       	call   80394a <init_map_dir>
+  8013ed:	eb 9c                	jmp    80138b <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8013ef:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013f4:	cd 30                	int    $0x30
+  8013f6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  8013f9:	85 c0                	test   %eax,%eax
+  8013fb:	78 10                	js     80140d <fork+0x94>
+	if (envid == 0)
+  8013fd:	0f 84 74 03 00 00    	je     801777 <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801403:	be 00 00 00 00       	mov    $0x0,%esi
+  801408:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80140b:	eb 30                	jmp    80143d <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  80140d:	50                   	push   %eax
+  80140e:	68 b6 56 80 00       	push   $0x8056b6
+  801413:	68 cd 00 00 00       	push   $0xcd
+  801418:	68 ab 56 80 00       	push   $0x8056ab
+  80141d:	e8 d8 3a 00 00       	call   804efa <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  801422:	89 f2                	mov    %esi,%edx
+  801424:	c1 fa 1f             	sar    $0x1f,%edx
+  801427:	c1 ea 16             	shr    $0x16,%edx
+  80142a:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  80142d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801432:	29 d0                	sub    %edx,%eax
+  801434:	ba 00 04 00 00       	mov    $0x400,%edx
+  801439:	29 c2                	sub    %eax,%edx
+  80143b:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  80143d:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  801440:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801446:	0f 87 ff 02 00 00    	ja     80174b <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  80144c:	89 f3                	mov    %esi,%ebx
+  80144e:	c1 e3 0c             	shl    $0xc,%ebx
+  801451:	89 d8                	mov    %ebx,%eax
+  801453:	c1 e8 16             	shr    $0x16,%eax
+  801456:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80145d:	f6 c2 01             	test   $0x1,%dl
+  801460:	74 c0                	je     801422 <fork+0xa9>
+  801462:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801469:	f6 c2 04             	test   $0x4,%dl
+  80146c:	74 b4                	je     801422 <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  80146e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801475:	a8 80                	test   $0x80,%al
+  801477:	75 24                	jne    80149d <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  801479:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801480:	25 81 00 00 00       	and    $0x81,%eax
+  801485:	3d 80 00 00 00       	cmp    $0x80,%eax
+  80148a:	74 21                	je     8014ad <fork+0x134>
+		if (!dupable(pn)) {
+  80148c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80148f:	e8 e2 fd ff ff       	call   801276 <dupable>
+  801494:	84 c0                	test   %al,%al
+  801496:	75 1a                	jne    8014b2 <fork+0x139>
+			++pn;
+  801498:	83 c6 01             	add    $0x1,%esi
+			continue;
+  80149b:	eb a0                	jmp    80143d <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  80149d:	83 ec 08             	sub    $0x8,%esp
+  8014a0:	53                   	push   %ebx
+  8014a1:	6a 00                	push   $0x0
+  8014a3:	e8 b1 f8 ff ff       	call   800d59 <sys_page_split>
+  8014a8:	83 c4 10             	add    $0x10,%esp
+  8014ab:	eb cc                	jmp    801479 <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  8014ad:	0f b6 03             	movzbl (%ebx),%eax
+  8014b0:	eb da                	jmp    80148c <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  8014b2:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8014b5:	89 f8                	mov    %edi,%eax
+  8014b7:	e8 71 fd ff ff       	call   80122d <dupperm>
+  8014bc:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8014bf:	85 c0                	test   %eax,%eax
+  8014c1:	74 16                	je     8014d9 <fork+0x160>
+  8014c3:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  8014c8:	29 f8                	sub    %edi,%eax
+  8014ca:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  8014cd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8014d2:	89 c6                	mov    %eax,%esi
+  8014d4:	e9 c4 01 00 00       	jmp    80169d <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  8014d9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014dc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014e3:	f6 c4 04             	test   $0x4,%ah
+  8014e6:	0f 85 89 00 00 00    	jne    801575 <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  8014ec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014ef:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014f6:	f6 c4 02             	test   $0x2,%ah
+  8014f9:	0f 85 b1 00 00 00    	jne    8015b0 <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  8014ff:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801502:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801509:	a8 02                	test   $0x2,%al
+  80150b:	75 10                	jne    80151d <fork+0x1a4>
+  80150d:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801514:	f6 c4 08             	test   $0x8,%ah
+  801517:	0f 84 3e 01 00 00    	je     80165b <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  80151d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801520:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801527:	25 00 06 00 00       	and    $0x600,%eax
+  80152c:	0d 05 08 00 00       	or     $0x805,%eax
+  801531:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  801533:	c1 e1 0c             	shl    $0xc,%ecx
+  801536:	89 cb                	mov    %ecx,%ebx
+  801538:	83 ec 0c             	sub    $0xc,%esp
+  80153b:	50                   	push   %eax
+  80153c:	51                   	push   %ecx
+  80153d:	ff 75 e4             	push   -0x1c(%ebp)
+  801540:	51                   	push   %ecx
+  801541:	6a 00                	push   $0x0
+  801543:	e8 e3 2d 00 00       	call   80432b <page_map>
+  801548:	83 c4 20             	add    $0x20,%esp
+  80154b:	85 c0                	test   %eax,%eax
+  80154d:	0f 88 e4 00 00 00    	js     801637 <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  801553:	83 ec 0c             	sub    $0xc,%esp
+  801556:	57                   	push   %edi
+  801557:	53                   	push   %ebx
+  801558:	6a 00                	push   $0x0
+  80155a:	53                   	push   %ebx
+  80155b:	6a 00                	push   $0x0
+  80155d:	e8 c9 2d 00 00       	call   80432b <page_map>
+  801562:	83 c4 20             	add    $0x20,%esp
+  801565:	85 c0                	test   %eax,%eax
+  801567:	0f 88 dc 00 00 00    	js     801649 <fork+0x2d0>
+			++pn;
+  80156d:	83 c6 01             	add    $0x1,%esi
+			continue;
+  801570:	e9 c8 fe ff ff       	jmp    80143d <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  801575:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801578:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80157f:	c1 e1 0c             	shl    $0xc,%ecx
+  801582:	83 ec 0c             	sub    $0xc,%esp
+  801585:	25 07 0e 00 00       	and    $0xe07,%eax
+  80158a:	50                   	push   %eax
+  80158b:	51                   	push   %ecx
+  80158c:	ff 75 e4             	push   -0x1c(%ebp)
+  80158f:	51                   	push   %ecx
+  801590:	6a 00                	push   $0x0
+  801592:	e8 94 2d 00 00       	call   80432b <page_map>
+  801597:	83 c4 20             	add    $0x20,%esp
+  80159a:	85 c0                	test   %eax,%eax
+  80159c:	79 cf                	jns    80156d <fork+0x1f4>
+			panic("page_map %d", r);
+  80159e:	50                   	push   %eax
+  80159f:	68 c6 56 80 00       	push   $0x8056c6
+  8015a4:	6a 4d                	push   $0x4d
+  8015a6:	68 ab 56 80 00       	push   $0x8056ab
+  8015ab:	e8 4a 39 00 00       	call   804efa <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  8015b0:	83 ec 0c             	sub    $0xc,%esp
+  8015b3:	68 00 10 00 00       	push   $0x1000
+  8015b8:	e8 60 33 00 00       	call   80491d <malloc>
+  8015bd:	89 c7                	mov    %eax,%edi
+  8015bf:	83 c4 10             	add    $0x10,%esp
+  8015c2:	85 c0                	test   %eax,%eax
+  8015c4:	74 4b                	je     801611 <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  8015c6:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8015c9:	c1 e3 0c             	shl    $0xc,%ebx
+  8015cc:	83 ec 04             	sub    $0x4,%esp
+  8015cf:	68 00 10 00 00       	push   $0x1000
+  8015d4:	53                   	push   %ebx
+  8015d5:	50                   	push   %eax
+  8015d6:	e8 ac f3 ff ff       	call   800987 <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  8015db:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015de:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015e5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015ea:	89 04 24             	mov    %eax,(%esp)
+  8015ed:	53                   	push   %ebx
+  8015ee:	ff 75 e4             	push   -0x1c(%ebp)
+  8015f1:	57                   	push   %edi
+  8015f2:	6a 00                	push   $0x0
+  8015f4:	e8 32 2d 00 00       	call   80432b <page_map>
+  8015f9:	83 c4 20             	add    $0x20,%esp
+  8015fc:	85 c0                	test   %eax,%eax
+  8015fe:	78 25                	js     801625 <fork+0x2ac>
+		free(temp);
+  801600:	83 ec 0c             	sub    $0xc,%esp
+  801603:	57                   	push   %edi
+  801604:	e8 12 31 00 00       	call   80471b <free>
+  801609:	83 c4 10             	add    $0x10,%esp
+  80160c:	e9 5c ff ff ff       	jmp    80156d <fork+0x1f4>
+			panic("malloc failed");
+  801611:	83 ec 04             	sub    $0x4,%esp
+  801614:	68 d2 56 80 00       	push   $0x8056d2
+  801619:	6a 56                	push   $0x56
+  80161b:	68 ab 56 80 00       	push   $0x8056ab
+  801620:	e8 d5 38 00 00       	call   804efa <_panic>
+			panic("page_map: %e", r);
+  801625:	50                   	push   %eax
+  801626:	68 e0 56 80 00       	push   $0x8056e0
+  80162b:	6a 59                	push   $0x59
+  80162d:	68 ab 56 80 00       	push   $0x8056ab
+  801632:	e8 c3 38 00 00       	call   804efa <_panic>
+			panic("page_map %d", r);
+  801637:	50                   	push   %eax
+  801638:	68 c6 56 80 00       	push   $0x8056c6
+  80163d:	6a 65                	push   $0x65
+  80163f:	68 ab 56 80 00       	push   $0x8056ab
+  801644:	e8 b1 38 00 00       	call   804efa <_panic>
+			panic("page_map %d", r);
+  801649:	50                   	push   %eax
+  80164a:	68 c6 56 80 00       	push   $0x8056c6
+  80164f:	6a 78                	push   $0x78
+  801651:	68 ab 56 80 00       	push   $0x8056ab
+  801656:	e8 9f 38 00 00       	call   804efa <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  80165b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80165e:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801665:	c1 e1 0c             	shl    $0xc,%ecx
+  801668:	83 ec 0c             	sub    $0xc,%esp
+  80166b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801670:	50                   	push   %eax
+  801671:	51                   	push   %ecx
+  801672:	ff 75 e4             	push   -0x1c(%ebp)
+  801675:	51                   	push   %ecx
+  801676:	6a 00                	push   $0x0
+  801678:	e8 ae 2c 00 00       	call   80432b <page_map>
+  80167d:	83 c4 20             	add    $0x20,%esp
+  801680:	85 c0                	test   %eax,%eax
+  801682:	0f 89 e5 fe ff ff    	jns    80156d <fork+0x1f4>
+			panic("page_map %d", r);
+  801688:	50                   	push   %eax
+  801689:	68 c6 56 80 00       	push   $0x8056c6
+  80168e:	6a 7f                	push   $0x7f
+  801690:	68 ab 56 80 00       	push   $0x8056ab
+  801695:	e8 60 38 00 00       	call   804efa <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  80169a:	83 c7 01             	add    $0x1,%edi
+  80169d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016a0:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  8016a3:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  8016a6:	39 f7                	cmp    %esi,%edi
+  8016a8:	74 1c                	je     8016c6 <fork+0x34d>
+  8016aa:	89 d8                	mov    %ebx,%eax
+  8016ac:	e8 c5 fb ff ff       	call   801276 <dupable>
+  8016b1:	84 c0                	test   %al,%al
+  8016b3:	74 7c                	je     801731 <fork+0x3b8>
+  8016b5:	89 d8                	mov    %ebx,%eax
+  8016b7:	e8 71 fb ff ff       	call   80122d <dupperm>
+  8016bc:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  8016bf:	74 d9                	je     80169a <fork+0x321>
+  8016c1:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8016c4:	eb 06                	jmp    8016cc <fork+0x353>
+  8016c6:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8016c9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  8016cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016cf:	c1 e0 0c             	shl    $0xc,%eax
+  8016d2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8016d5:	83 ec 08             	sub    $0x8,%esp
+  8016d8:	ff 75 dc             	push   -0x24(%ebp)
+  8016db:	57                   	push   %edi
+  8016dc:	50                   	push   %eax
+  8016dd:	ff 75 e4             	push   -0x1c(%ebp)
+  8016e0:	50                   	push   %eax
+  8016e1:	6a 00                	push   $0x0
+  8016e3:	e8 3a 2e 00 00       	call   804522 <page_map_range>
+  8016e8:	83 c4 20             	add    $0x20,%esp
+  8016eb:	85 c0                	test   %eax,%eax
+  8016ed:	78 47                	js     801736 <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  8016ef:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  8016f6:	0f 84 41 fd ff ff    	je     80143d <fork+0xc4>
+  8016fc:	83 ec 08             	sub    $0x8,%esp
+  8016ff:	ff 75 dc             	push   -0x24(%ebp)
+  801702:	57                   	push   %edi
+  801703:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801706:	50                   	push   %eax
+  801707:	6a 00                	push   $0x0
+  801709:	50                   	push   %eax
+  80170a:	6a 00                	push   $0x0
+  80170c:	e8 11 2e 00 00       	call   804522 <page_map_range>
+  801711:	83 c4 20             	add    $0x20,%esp
+  801714:	85 c0                	test   %eax,%eax
+  801716:	0f 89 21 fd ff ff    	jns    80143d <fork+0xc4>
+		panic("page_map_range %e", r);
+  80171c:	50                   	push   %eax
+  80171d:	68 ed 56 80 00       	push   $0x8056ed
+  801722:	68 a2 00 00 00       	push   $0xa2
+  801727:	68 ab 56 80 00       	push   $0x8056ab
+  80172c:	e8 c9 37 00 00       	call   804efa <_panic>
+  801731:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801734:	eb 96                	jmp    8016cc <fork+0x353>
+		panic("page_map_range %e", r);
+  801736:	50                   	push   %eax
+  801737:	68 ed 56 80 00       	push   $0x8056ed
+  80173c:	68 a0 00 00 00       	push   $0xa0
+  801741:	68 ab 56 80 00       	push   $0x8056ab
+  801746:	e8 af 37 00 00       	call   804efa <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  80174b:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  80174e:	6a 01                	push   $0x1
+  801750:	6a 07                	push   $0x7
+  801752:	68 00 f0 bf ee       	push   $0xeebff000
+  801757:	53                   	push   %ebx
+  801758:	e8 6d 25 00 00       	call   803cca <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  80175d:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801762:	8b 40 74             	mov    0x74(%eax),%eax
+  801765:	83 c4 08             	add    $0x8,%esp
+  801768:	50                   	push   %eax
+  801769:	53                   	push   %ebx
+  80176a:	e8 89 f8 ff ff       	call   800ff8 <sys_env_set_pgfault_upcall>
+  80176f:	83 c4 10             	add    $0x10,%esp
+  801772:	e9 41 fc ff ff       	jmp    8013b8 <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801777:	e8 d8 f4 ff ff       	call   800c54 <sys_getenvid>
+  80177c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801781:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801784:	c1 e0 06             	shl    $0x6,%eax
+  801787:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80178c:	a3 18 e9 80 00       	mov    %eax,0x80e918
+		return 0;
+  801791:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801798:	e9 40 fc ff ff       	jmp    8013dd <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  80179d:	50                   	push   %eax
+  80179e:	68 ff 56 80 00       	push   $0x8056ff
+  8017a3:	68 27 01 00 00       	push   $0x127
+  8017a8:	68 ab 56 80 00       	push   $0x8056ab
+  8017ad:	e8 48 37 00 00       	call   804efa <_panic>
+		panic("sys_env_set_status: %d", r);
+  8017b2:	50                   	push   %eax
+  8017b3:	68 18 57 80 00       	push   $0x805718
+  8017b8:	68 2b 01 00 00       	push   $0x12b
+  8017bd:	68 ab 56 80 00       	push   $0x8056ab
+  8017c2:	e8 33 37 00 00       	call   804efa <_panic>
+
+008017c7 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8017c7:	55                   	push   %ebp
+  8017c8:	89 e5                	mov    %esp,%ebp
+  8017ca:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8017cd:	68 2f 57 80 00       	push   $0x80572f
+  8017d2:	68 35 01 00 00       	push   $0x135
+  8017d7:	68 ab 56 80 00       	push   $0x8056ab
+  8017dc:	e8 19 37 00 00       	call   804efa <_panic>
+
+008017e1 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8017e1:	55                   	push   %ebp
+  8017e2:	89 e5                	mov    %esp,%ebp
+  8017e4:	57                   	push   %edi
+  8017e5:	56                   	push   %esi
+  8017e6:	53                   	push   %ebx
+  8017e7:	83 ec 14             	sub    $0x14,%esp
+  8017ea:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8017ed:	8b 75 14             	mov    0x14(%ebp),%esi
+  8017f0:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8017f3:	ff 75 10             	push   0x10(%ebp)
+  8017f6:	ff 75 0c             	push   0xc(%ebp)
+  8017f9:	e8 b7 f8 ff ff       	call   8010b5 <sys_ipc_recv_pages>
+  8017fe:	83 c4 10             	add    $0x10,%esp
+  801801:	85 c0                	test   %eax,%eax
+  801803:	78 46                	js     80184b <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  801805:	85 ff                	test   %edi,%edi
+  801807:	74 0d                	je     801816 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  801809:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80180e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  801814:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  801816:	85 f6                	test   %esi,%esi
+  801818:	74 0d                	je     801827 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  80181a:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80181f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801825:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  801827:	85 db                	test   %ebx,%ebx
+  801829:	74 0d                	je     801838 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  80182b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801830:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801836:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  801838:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80183d:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  801843:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801846:	5b                   	pop    %ebx
+  801847:	5e                   	pop    %esi
+  801848:	5f                   	pop    %edi
+  801849:	5d                   	pop    %ebp
+  80184a:	c3                   	ret
+		if (from_env_store) {
+  80184b:	85 ff                	test   %edi,%edi
+  80184d:	74 06                	je     801855 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80184f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  801855:	85 f6                	test   %esi,%esi
+  801857:	74 06                	je     80185f <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  801859:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80185f:	85 db                	test   %ebx,%ebx
+  801861:	74 e0                	je     801843 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  801863:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801869:	eb d8                	jmp    801843 <ipc_recv_pages+0x62>
+
+0080186b <ipc_recv>:
+{
+  80186b:	55                   	push   %ebp
+  80186c:	89 e5                	mov    %esp,%ebp
+  80186e:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  801871:	6a 00                	push   $0x0
+  801873:	ff 75 10             	push   0x10(%ebp)
+  801876:	6a 01                	push   $0x1
+  801878:	ff 75 0c             	push   0xc(%ebp)
+  80187b:	ff 75 08             	push   0x8(%ebp)
+  80187e:	e8 5e ff ff ff       	call   8017e1 <ipc_recv_pages>
+}
+  801883:	c9                   	leave
+  801884:	c3                   	ret
+
+00801885 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801885:	55                   	push   %ebp
+  801886:	89 e5                	mov    %esp,%ebp
+  801888:	56                   	push   %esi
+  801889:	53                   	push   %ebx
+  80188a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80188d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  801890:	83 ec 0c             	sub    $0xc,%esp
+  801893:	ff 75 0c             	push   0xc(%ebp)
+  801896:	e8 4e f9 ff ff       	call   8011e9 <sys_ipc_try_recv>
+  80189b:	83 c4 10             	add    $0x10,%esp
+  80189e:	85 c0                	test   %eax,%eax
+  8018a0:	78 34                	js     8018d6 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8018a2:	85 f6                	test   %esi,%esi
+  8018a4:	74 0d                	je     8018b3 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8018a6:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8018ab:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8018b1:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8018b3:	85 db                	test   %ebx,%ebx
+  8018b5:	74 0d                	je     8018c4 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8018b7:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8018bc:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8018c2:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8018c4:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8018c9:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8018cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018d2:	5b                   	pop    %ebx
+  8018d3:	5e                   	pop    %esi
+  8018d4:	5d                   	pop    %ebp
+  8018d5:	c3                   	ret
+		if (from_env_store) {
+  8018d6:	85 f6                	test   %esi,%esi
+  8018d8:	74 06                	je     8018e0 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8018da:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8018e0:	85 db                	test   %ebx,%ebx
+  8018e2:	74 eb                	je     8018cf <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8018e4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8018ea:	eb e3                	jmp    8018cf <ipc_try_recv+0x4a>
+
+008018ec <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8018ec:	55                   	push   %ebp
+  8018ed:	89 e5                	mov    %esp,%ebp
+  8018ef:	83 ec 14             	sub    $0x14,%esp
+  8018f2:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8018f5:	85 c0                	test   %eax,%eax
+  8018f7:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8018fc:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8018ff:	ff 75 18             	push   0x18(%ebp)
+  801902:	ff 75 14             	push   0x14(%ebp)
+  801905:	50                   	push   %eax
+  801906:	ff 75 0c             	push   0xc(%ebp)
+  801909:	ff 75 08             	push   0x8(%ebp)
+  80190c:	e8 67 f7 ff ff       	call   801078 <sys_ipc_send_pages>
+  801911:	83 c4 20             	add    $0x20,%esp
+  801914:	85 c0                	test   %eax,%eax
+  801916:	78 02                	js     80191a <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  801918:	c9                   	leave
+  801919:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  80191a:	50                   	push   %eax
+  80191b:	68 48 57 80 00       	push   $0x805748
+  801920:	68 80 00 00 00       	push   $0x80
+  801925:	68 74 57 80 00       	push   $0x805774
+  80192a:	e8 cb 35 00 00       	call   804efa <_panic>
+
+0080192f <ipc_send>:
+{
+  80192f:	55                   	push   %ebp
+  801930:	89 e5                	mov    %esp,%ebp
+  801932:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  801935:	ff 75 14             	push   0x14(%ebp)
+  801938:	6a 01                	push   $0x1
+  80193a:	ff 75 10             	push   0x10(%ebp)
+  80193d:	ff 75 0c             	push   0xc(%ebp)
+  801940:	ff 75 08             	push   0x8(%ebp)
+  801943:	e8 a4 ff ff ff       	call   8018ec <ipc_send_pages>
+}
+  801948:	83 c4 20             	add    $0x20,%esp
+  80194b:	c9                   	leave
+  80194c:	c3                   	ret
+
+0080194d <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80194d:	55                   	push   %ebp
+  80194e:	89 e5                	mov    %esp,%ebp
+  801950:	83 ec 14             	sub    $0x14,%esp
+  801953:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  801956:	85 c0                	test   %eax,%eax
+  801958:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80195d:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  801960:	ff 75 18             	push   0x18(%ebp)
+  801963:	ff 75 14             	push   0x14(%ebp)
+  801966:	50                   	push   %eax
+  801967:	ff 75 0c             	push   0xc(%ebp)
+  80196a:	ff 75 08             	push   0x8(%ebp)
+  80196d:	e8 97 f7 ff ff       	call   801109 <sys_ipc_call>
+  801972:	83 c4 20             	add    $0x20,%esp
+  801975:	85 c0                	test   %eax,%eax
+  801977:	78 0b                	js     801984 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  801979:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80197e:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  801984:	c9                   	leave
+  801985:	c3                   	ret
+
+00801986 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  801986:	55                   	push   %ebp
+  801987:	89 e5                	mov    %esp,%ebp
+  801989:	57                   	push   %edi
+  80198a:	56                   	push   %esi
+  80198b:	53                   	push   %ebx
+  80198c:	83 ec 18             	sub    $0x18,%esp
+  80198f:	8b 45 10             	mov    0x10(%ebp),%eax
+  801992:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  801995:	8b 75 20             	mov    0x20(%ebp),%esi
+  801998:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80199b:	85 c0                	test   %eax,%eax
+  80199d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8019a2:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8019a5:	ff 75 18             	push   0x18(%ebp)
+  8019a8:	ff 75 14             	push   0x14(%ebp)
+  8019ab:	50                   	push   %eax
+  8019ac:	ff 75 0c             	push   0xc(%ebp)
+  8019af:	ff 75 08             	push   0x8(%ebp)
+  8019b2:	e8 93 f7 ff ff       	call   80114a <sys_ipc_reply_recv>
+  8019b7:	83 c4 20             	add    $0x20,%esp
+  8019ba:	85 c0                	test   %eax,%eax
+  8019bc:	78 46                	js     801a04 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8019be:	85 ff                	test   %edi,%edi
+  8019c0:	74 0d                	je     8019cf <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8019c2:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8019c7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8019cd:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8019cf:	85 f6                	test   %esi,%esi
+  8019d1:	74 0d                	je     8019e0 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8019d3:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8019d8:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8019de:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8019e0:	85 db                	test   %ebx,%ebx
+  8019e2:	74 0d                	je     8019f1 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8019e4:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8019e9:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8019ef:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8019f1:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8019f6:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8019fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ff:	5b                   	pop    %ebx
+  801a00:	5e                   	pop    %esi
+  801a01:	5f                   	pop    %edi
+  801a02:	5d                   	pop    %ebp
+  801a03:	c3                   	ret
+		if (from_env_store) {
+  801a04:	85 ff                	test   %edi,%edi
+  801a06:	74 06                	je     801a0e <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  801a08:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  801a0e:	85 f6                	test   %esi,%esi
+  801a10:	74 06                	je     801a18 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  801a12:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  801a18:	85 db                	test   %ebx,%ebx
+  801a1a:	74 e0                	je     8019fc <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  801a1c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801a22:	eb d8                	jmp    8019fc <ipc_reply_recv+0x76>
+
+00801a24 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801a24:	55                   	push   %ebp
+  801a25:	89 e5                	mov    %esp,%ebp
+  801a27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801a2a:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  801a2f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  801a32:	c1 e0 06             	shl    $0x6,%eax
+  801a35:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a3a:	8b 40 50             	mov    0x50(%eax),%eax
+  801a3d:	39 c8                	cmp    %ecx,%eax
+  801a3f:	74 12                	je     801a53 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801a41:	83 c2 01             	add    $0x1,%edx
+  801a44:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801a4a:	75 e3                	jne    801a2f <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a51:	eb 0e                	jmp    801a61 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801a53:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  801a56:	c1 e0 06             	shl    $0x6,%eax
+  801a59:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a5e:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801a61:	5d                   	pop    %ebp
+  801a62:	c3                   	ret
+
+00801a63 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801a63:	55                   	push   %ebp
+  801a64:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a66:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a69:	05 00 00 00 30       	add    $0x30000000,%eax
+  801a6e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801a71:	5d                   	pop    %ebp
+  801a72:	c3                   	ret
+
+00801a73 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801a73:	55                   	push   %ebp
+  801a74:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a76:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a79:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801a7e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a83:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801a88:	5d                   	pop    %ebp
+  801a89:	c3                   	ret
+
+00801a8a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801a8a:	55                   	push   %ebp
+  801a8b:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801a8d:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801a92:	a8 01                	test   $0x1,%al
+  801a94:	74 3c                	je     801ad2 <fd_alloc+0x48>
+  801a96:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801a9b:	89 c2                	mov    %eax,%edx
+  801a9d:	c1 ea 0c             	shr    $0xc,%edx
+  801aa0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801aa7:	89 c1                	mov    %eax,%ecx
+  801aa9:	05 00 10 00 00       	add    $0x1000,%eax
+  801aae:	f6 c2 01             	test   $0x1,%dl
+  801ab1:	74 13                	je     801ac6 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801ab3:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801ab8:	75 e1                	jne    801a9b <fd_alloc+0x11>
+  801aba:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801abf:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801ac4:	eb 05                	jmp    801acb <fd_alloc+0x41>
+			return 0;
+  801ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801acb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ace:	89 0a                	mov    %ecx,(%edx)
+}
+  801ad0:	5d                   	pop    %ebp
+  801ad1:	c3                   	ret
+  801ad2:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801adc:	eb ed                	jmp    801acb <fd_alloc+0x41>
+
+00801ade <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801ade:	55                   	push   %ebp
+  801adf:	89 e5                	mov    %esp,%ebp
+  801ae1:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801ae4:	83 f8 1f             	cmp    $0x1f,%eax
+  801ae7:	77 30                	ja     801b19 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801ae9:	c1 e0 0c             	shl    $0xc,%eax
+  801aec:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801af1:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801af7:	f6 c2 01             	test   $0x1,%dl
+  801afa:	74 24                	je     801b20 <fd_lookup+0x42>
+  801afc:	89 c2                	mov    %eax,%edx
+  801afe:	c1 ea 0c             	shr    $0xc,%edx
+  801b01:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b08:	f6 c2 01             	test   $0x1,%dl
+  801b0b:	74 1a                	je     801b27 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801b0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b10:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801b12:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b17:	5d                   	pop    %ebp
+  801b18:	c3                   	ret
+		return -E_INVAL;
+  801b19:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b1e:	eb f7                	jmp    801b17 <fd_lookup+0x39>
+		return -E_INVAL;
+  801b20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b25:	eb f0                	jmp    801b17 <fd_lookup+0x39>
+  801b27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b2c:	eb e9                	jmp    801b17 <fd_lookup+0x39>
+
+00801b2e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801b2e:	55                   	push   %ebp
+  801b2f:	89 e5                	mov    %esp,%ebp
+  801b31:	53                   	push   %ebx
+  801b32:	83 ec 04             	sub    $0x4,%esp
+  801b35:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801b38:	b8 fc 57 80 00       	mov    $0x8057fc,%eax
+  801b3d:	8b 18                	mov    (%eax),%ebx
+  801b3f:	85 db                	test   %ebx,%ebx
+  801b41:	74 0e                	je     801b51 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801b43:	83 c0 04             	add    $0x4,%eax
+  801b46:	39 13                	cmp    %edx,(%ebx)
+  801b48:	75 f3                	jne    801b3d <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4f:	eb 1f                	jmp    801b70 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b51:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801b56:	8b 40 48             	mov    0x48(%eax),%eax
+  801b59:	83 ec 04             	sub    $0x4,%esp
+  801b5c:	52                   	push   %edx
+  801b5d:	50                   	push   %eax
+  801b5e:	68 80 57 80 00       	push   $0x805780
+  801b63:	e8 50 e6 ff ff       	call   8001b8 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801b68:	83 c4 10             	add    $0x10,%esp
+  801b6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801b70:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b73:	89 1a                	mov    %ebx,(%edx)
+}
+  801b75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b78:	c9                   	leave
+  801b79:	c3                   	ret
+
+00801b7a <fd_close>:
+{
+  801b7a:	55                   	push   %ebp
+  801b7b:	89 e5                	mov    %esp,%ebp
+  801b7d:	57                   	push   %edi
+  801b7e:	56                   	push   %esi
+  801b7f:	53                   	push   %ebx
+  801b80:	83 ec 24             	sub    $0x24,%esp
+  801b83:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b86:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b89:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b8c:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b8d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801b93:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b96:	50                   	push   %eax
+  801b97:	e8 42 ff ff ff       	call   801ade <fd_lookup>
+  801b9c:	89 c3                	mov    %eax,%ebx
+  801b9e:	83 c4 10             	add    $0x10,%esp
+  801ba1:	85 c0                	test   %eax,%eax
+  801ba3:	78 05                	js     801baa <fd_close+0x30>
+	    || fd != fd2)
+  801ba5:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ba8:	74 16                	je     801bc0 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801baa:	89 f8                	mov    %edi,%eax
+  801bac:	84 c0                	test   %al,%al
+  801bae:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb3:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801bb6:	89 d8                	mov    %ebx,%eax
+  801bb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bbb:	5b                   	pop    %ebx
+  801bbc:	5e                   	pop    %esi
+  801bbd:	5f                   	pop    %edi
+  801bbe:	5d                   	pop    %ebp
+  801bbf:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bc0:	83 ec 08             	sub    $0x8,%esp
+  801bc3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801bc6:	50                   	push   %eax
+  801bc7:	ff 36                	push   (%esi)
+  801bc9:	e8 60 ff ff ff       	call   801b2e <dev_lookup>
+  801bce:	89 c3                	mov    %eax,%ebx
+  801bd0:	83 c4 10             	add    $0x10,%esp
+  801bd3:	85 c0                	test   %eax,%eax
+  801bd5:	78 1a                	js     801bf1 <fd_close+0x77>
+		if (dev->dev_close)
+  801bd7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801bda:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801bdd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801be2:	85 c0                	test   %eax,%eax
+  801be4:	74 0b                	je     801bf1 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801be6:	83 ec 0c             	sub    $0xc,%esp
+  801be9:	56                   	push   %esi
+  801bea:	ff d0                	call   *%eax
+  801bec:	89 c3                	mov    %eax,%ebx
+  801bee:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801bf1:	83 ec 08             	sub    $0x8,%esp
+  801bf4:	56                   	push   %esi
+  801bf5:	6a 00                	push   $0x0
+  801bf7:	e8 1b f1 ff ff       	call   800d17 <sys_page_unmap>
+	return r;
+  801bfc:	83 c4 10             	add    $0x10,%esp
+  801bff:	eb b5                	jmp    801bb6 <fd_close+0x3c>
+
+00801c01 <close>:
+
+int
+close(int fdnum)
+{
+  801c01:	55                   	push   %ebp
+  801c02:	89 e5                	mov    %esp,%ebp
+  801c04:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c07:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c0a:	50                   	push   %eax
+  801c0b:	ff 75 08             	push   0x8(%ebp)
+  801c0e:	e8 cb fe ff ff       	call   801ade <fd_lookup>
+  801c13:	83 c4 10             	add    $0x10,%esp
+  801c16:	85 c0                	test   %eax,%eax
+  801c18:	79 02                	jns    801c1c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801c1a:	c9                   	leave
+  801c1b:	c3                   	ret
+		return fd_close(fd, 1);
+  801c1c:	83 ec 08             	sub    $0x8,%esp
+  801c1f:	6a 01                	push   $0x1
+  801c21:	ff 75 f4             	push   -0xc(%ebp)
+  801c24:	e8 51 ff ff ff       	call   801b7a <fd_close>
+  801c29:	83 c4 10             	add    $0x10,%esp
+  801c2c:	eb ec                	jmp    801c1a <close+0x19>
+
+00801c2e <close_all>:
+
+void
+close_all(void)
+{
+  801c2e:	55                   	push   %ebp
+  801c2f:	89 e5                	mov    %esp,%ebp
+  801c31:	53                   	push   %ebx
+  801c32:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801c35:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801c3a:	83 ec 0c             	sub    $0xc,%esp
+  801c3d:	53                   	push   %ebx
+  801c3e:	e8 be ff ff ff       	call   801c01 <close>
+	for (i = 0; i < MAXFD; i++)
+  801c43:	83 c3 01             	add    $0x1,%ebx
+  801c46:	83 c4 10             	add    $0x10,%esp
+  801c49:	83 fb 20             	cmp    $0x20,%ebx
+  801c4c:	75 ec                	jne    801c3a <close_all+0xc>
+}
+  801c4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c51:	c9                   	leave
+  801c52:	c3                   	ret
+
+00801c53 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801c53:	55                   	push   %ebp
+  801c54:	89 e5                	mov    %esp,%ebp
+  801c56:	57                   	push   %edi
+  801c57:	56                   	push   %esi
+  801c58:	53                   	push   %ebx
+  801c59:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801c5c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c5f:	50                   	push   %eax
+  801c60:	ff 75 08             	push   0x8(%ebp)
+  801c63:	e8 76 fe ff ff       	call   801ade <fd_lookup>
+  801c68:	89 c3                	mov    %eax,%ebx
+  801c6a:	83 c4 10             	add    $0x10,%esp
+  801c6d:	85 c0                	test   %eax,%eax
+  801c6f:	78 7f                	js     801cf0 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801c71:	83 ec 0c             	sub    $0xc,%esp
+  801c74:	ff 75 0c             	push   0xc(%ebp)
+  801c77:	e8 85 ff ff ff       	call   801c01 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801c7c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c7f:	c1 e6 0c             	shl    $0xc,%esi
+  801c82:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801c88:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801c8b:	89 3c 24             	mov    %edi,(%esp)
+  801c8e:	e8 e0 fd ff ff       	call   801a73 <fd2data>
+  801c93:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801c95:	89 34 24             	mov    %esi,(%esp)
+  801c98:	e8 d6 fd ff ff       	call   801a73 <fd2data>
+  801c9d:	83 c4 10             	add    $0x10,%esp
+  801ca0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801ca3:	89 d8                	mov    %ebx,%eax
+  801ca5:	c1 e8 16             	shr    $0x16,%eax
+  801ca8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801caf:	a8 01                	test   $0x1,%al
+  801cb1:	74 11                	je     801cc4 <dup+0x71>
+  801cb3:	89 d8                	mov    %ebx,%eax
+  801cb5:	c1 e8 0c             	shr    $0xc,%eax
+  801cb8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801cbf:	f6 c2 01             	test   $0x1,%dl
+  801cc2:	75 36                	jne    801cfa <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801cc4:	89 f8                	mov    %edi,%eax
+  801cc6:	c1 e8 0c             	shr    $0xc,%eax
+  801cc9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801cd0:	83 ec 0c             	sub    $0xc,%esp
+  801cd3:	25 07 0e 00 00       	and    $0xe07,%eax
+  801cd8:	50                   	push   %eax
+  801cd9:	56                   	push   %esi
+  801cda:	6a 00                	push   $0x0
+  801cdc:	57                   	push   %edi
+  801cdd:	6a 00                	push   $0x0
+  801cdf:	e8 f1 ef ff ff       	call   800cd5 <sys_page_map>
+  801ce4:	89 c3                	mov    %eax,%ebx
+  801ce6:	83 c4 20             	add    $0x20,%esp
+  801ce9:	85 c0                	test   %eax,%eax
+  801ceb:	78 33                	js     801d20 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801ced:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801cf0:	89 d8                	mov    %ebx,%eax
+  801cf2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf5:	5b                   	pop    %ebx
+  801cf6:	5e                   	pop    %esi
+  801cf7:	5f                   	pop    %edi
+  801cf8:	5d                   	pop    %ebp
+  801cf9:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801cfa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d01:	83 ec 0c             	sub    $0xc,%esp
+  801d04:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d09:	50                   	push   %eax
+  801d0a:	ff 75 d4             	push   -0x2c(%ebp)
+  801d0d:	6a 00                	push   $0x0
+  801d0f:	53                   	push   %ebx
+  801d10:	6a 00                	push   $0x0
+  801d12:	e8 be ef ff ff       	call   800cd5 <sys_page_map>
+  801d17:	89 c3                	mov    %eax,%ebx
+  801d19:	83 c4 20             	add    $0x20,%esp
+  801d1c:	85 c0                	test   %eax,%eax
+  801d1e:	79 a4                	jns    801cc4 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801d20:	83 ec 08             	sub    $0x8,%esp
+  801d23:	56                   	push   %esi
+  801d24:	6a 00                	push   $0x0
+  801d26:	e8 ec ef ff ff       	call   800d17 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801d2b:	83 c4 08             	add    $0x8,%esp
+  801d2e:	ff 75 d4             	push   -0x2c(%ebp)
+  801d31:	6a 00                	push   $0x0
+  801d33:	e8 df ef ff ff       	call   800d17 <sys_page_unmap>
+	return r;
+  801d38:	83 c4 10             	add    $0x10,%esp
+  801d3b:	eb b3                	jmp    801cf0 <dup+0x9d>
+
+00801d3d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801d3d:	55                   	push   %ebp
+  801d3e:	89 e5                	mov    %esp,%ebp
+  801d40:	56                   	push   %esi
+  801d41:	53                   	push   %ebx
+  801d42:	83 ec 18             	sub    $0x18,%esp
+  801d45:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d48:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d4b:	50                   	push   %eax
+  801d4c:	56                   	push   %esi
+  801d4d:	e8 8c fd ff ff       	call   801ade <fd_lookup>
+  801d52:	83 c4 10             	add    $0x10,%esp
+  801d55:	85 c0                	test   %eax,%eax
+  801d57:	78 3c                	js     801d95 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d59:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801d5c:	83 ec 08             	sub    $0x8,%esp
+  801d5f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d62:	50                   	push   %eax
+  801d63:	ff 33                	push   (%ebx)
+  801d65:	e8 c4 fd ff ff       	call   801b2e <dev_lookup>
+  801d6a:	83 c4 10             	add    $0x10,%esp
+  801d6d:	85 c0                	test   %eax,%eax
+  801d6f:	78 24                	js     801d95 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d71:	8b 43 08             	mov    0x8(%ebx),%eax
+  801d74:	83 e0 03             	and    $0x3,%eax
+  801d77:	83 f8 01             	cmp    $0x1,%eax
+  801d7a:	74 20                	je     801d9c <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801d7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d7f:	8b 40 08             	mov    0x8(%eax),%eax
+  801d82:	85 c0                	test   %eax,%eax
+  801d84:	74 37                	je     801dbd <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801d86:	83 ec 04             	sub    $0x4,%esp
+  801d89:	ff 75 10             	push   0x10(%ebp)
+  801d8c:	ff 75 0c             	push   0xc(%ebp)
+  801d8f:	53                   	push   %ebx
+  801d90:	ff d0                	call   *%eax
+  801d92:	83 c4 10             	add    $0x10,%esp
+}
+  801d95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d98:	5b                   	pop    %ebx
+  801d99:	5e                   	pop    %esi
+  801d9a:	5d                   	pop    %ebp
+  801d9b:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d9c:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801da1:	8b 40 48             	mov    0x48(%eax),%eax
+  801da4:	83 ec 04             	sub    $0x4,%esp
+  801da7:	56                   	push   %esi
+  801da8:	50                   	push   %eax
+  801da9:	68 c1 57 80 00       	push   $0x8057c1
+  801dae:	e8 05 e4 ff ff       	call   8001b8 <cprintf>
+		return -E_INVAL;
+  801db3:	83 c4 10             	add    $0x10,%esp
+  801db6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dbb:	eb d8                	jmp    801d95 <read+0x58>
+		return -E_NOT_SUPP;
+  801dbd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dc2:	eb d1                	jmp    801d95 <read+0x58>
+
+00801dc4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801dc4:	55                   	push   %ebp
+  801dc5:	89 e5                	mov    %esp,%ebp
+  801dc7:	57                   	push   %edi
+  801dc8:	56                   	push   %esi
+  801dc9:	53                   	push   %ebx
+  801dca:	83 ec 0c             	sub    $0xc,%esp
+  801dcd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801dd0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801dd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dd8:	eb 02                	jmp    801ddc <readn+0x18>
+  801dda:	01 c3                	add    %eax,%ebx
+  801ddc:	39 f3                	cmp    %esi,%ebx
+  801dde:	73 21                	jae    801e01 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801de0:	83 ec 04             	sub    $0x4,%esp
+  801de3:	89 f0                	mov    %esi,%eax
+  801de5:	29 d8                	sub    %ebx,%eax
+  801de7:	50                   	push   %eax
+  801de8:	89 d8                	mov    %ebx,%eax
+  801dea:	03 45 0c             	add    0xc(%ebp),%eax
+  801ded:	50                   	push   %eax
+  801dee:	57                   	push   %edi
+  801def:	e8 49 ff ff ff       	call   801d3d <read>
+		if (m < 0)
+  801df4:	83 c4 10             	add    $0x10,%esp
+  801df7:	85 c0                	test   %eax,%eax
+  801df9:	78 04                	js     801dff <readn+0x3b>
+			return m;
+		if (m == 0)
+  801dfb:	75 dd                	jne    801dda <readn+0x16>
+  801dfd:	eb 02                	jmp    801e01 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801dff:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801e01:	89 d8                	mov    %ebx,%eax
+  801e03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e06:	5b                   	pop    %ebx
+  801e07:	5e                   	pop    %esi
+  801e08:	5f                   	pop    %edi
+  801e09:	5d                   	pop    %ebp
+  801e0a:	c3                   	ret
+
+00801e0b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801e0b:	55                   	push   %ebp
+  801e0c:	89 e5                	mov    %esp,%ebp
+  801e0e:	56                   	push   %esi
+  801e0f:	53                   	push   %ebx
+  801e10:	83 ec 18             	sub    $0x18,%esp
+  801e13:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e16:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e19:	50                   	push   %eax
+  801e1a:	53                   	push   %ebx
+  801e1b:	e8 be fc ff ff       	call   801ade <fd_lookup>
+  801e20:	83 c4 10             	add    $0x10,%esp
+  801e23:	85 c0                	test   %eax,%eax
+  801e25:	78 37                	js     801e5e <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e27:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e2a:	83 ec 08             	sub    $0x8,%esp
+  801e2d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e30:	50                   	push   %eax
+  801e31:	ff 36                	push   (%esi)
+  801e33:	e8 f6 fc ff ff       	call   801b2e <dev_lookup>
+  801e38:	83 c4 10             	add    $0x10,%esp
+  801e3b:	85 c0                	test   %eax,%eax
+  801e3d:	78 1f                	js     801e5e <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e3f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e43:	74 20                	je     801e65 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801e45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e48:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e4b:	85 c0                	test   %eax,%eax
+  801e4d:	74 37                	je     801e86 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801e4f:	83 ec 04             	sub    $0x4,%esp
+  801e52:	ff 75 10             	push   0x10(%ebp)
+  801e55:	ff 75 0c             	push   0xc(%ebp)
+  801e58:	56                   	push   %esi
+  801e59:	ff d0                	call   *%eax
+  801e5b:	83 c4 10             	add    $0x10,%esp
+}
+  801e5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e61:	5b                   	pop    %ebx
+  801e62:	5e                   	pop    %esi
+  801e63:	5d                   	pop    %ebp
+  801e64:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e65:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801e6a:	8b 40 48             	mov    0x48(%eax),%eax
+  801e6d:	83 ec 04             	sub    $0x4,%esp
+  801e70:	53                   	push   %ebx
+  801e71:	50                   	push   %eax
+  801e72:	68 dd 57 80 00       	push   $0x8057dd
+  801e77:	e8 3c e3 ff ff       	call   8001b8 <cprintf>
+		return -E_INVAL;
+  801e7c:	83 c4 10             	add    $0x10,%esp
+  801e7f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e84:	eb d8                	jmp    801e5e <write+0x53>
+		return -E_NOT_SUPP;
+  801e86:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e8b:	eb d1                	jmp    801e5e <write+0x53>
+
+00801e8d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801e8d:	55                   	push   %ebp
+  801e8e:	89 e5                	mov    %esp,%ebp
+  801e90:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e96:	50                   	push   %eax
+  801e97:	ff 75 08             	push   0x8(%ebp)
+  801e9a:	e8 3f fc ff ff       	call   801ade <fd_lookup>
+  801e9f:	83 c4 10             	add    $0x10,%esp
+  801ea2:	85 c0                	test   %eax,%eax
+  801ea4:	78 0e                	js     801eb4 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801ea6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ea9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eac:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eb4:	c9                   	leave
+  801eb5:	c3                   	ret
+
+00801eb6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801eb6:	55                   	push   %ebp
+  801eb7:	89 e5                	mov    %esp,%ebp
+  801eb9:	56                   	push   %esi
+  801eba:	53                   	push   %ebx
+  801ebb:	83 ec 18             	sub    $0x18,%esp
+  801ebe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ec1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ec4:	50                   	push   %eax
+  801ec5:	53                   	push   %ebx
+  801ec6:	e8 13 fc ff ff       	call   801ade <fd_lookup>
+  801ecb:	83 c4 10             	add    $0x10,%esp
+  801ece:	85 c0                	test   %eax,%eax
+  801ed0:	78 34                	js     801f06 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ed2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ed5:	83 ec 08             	sub    $0x8,%esp
+  801ed8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801edb:	50                   	push   %eax
+  801edc:	ff 36                	push   (%esi)
+  801ede:	e8 4b fc ff ff       	call   801b2e <dev_lookup>
+  801ee3:	83 c4 10             	add    $0x10,%esp
+  801ee6:	85 c0                	test   %eax,%eax
+  801ee8:	78 1c                	js     801f06 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801eea:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801eee:	74 1d                	je     801f0d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801ef0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ef3:	8b 40 18             	mov    0x18(%eax),%eax
+  801ef6:	85 c0                	test   %eax,%eax
+  801ef8:	74 34                	je     801f2e <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801efa:	83 ec 08             	sub    $0x8,%esp
+  801efd:	ff 75 0c             	push   0xc(%ebp)
+  801f00:	56                   	push   %esi
+  801f01:	ff d0                	call   *%eax
+  801f03:	83 c4 10             	add    $0x10,%esp
+}
+  801f06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f09:	5b                   	pop    %ebx
+  801f0a:	5e                   	pop    %esi
+  801f0b:	5d                   	pop    %ebp
+  801f0c:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801f0d:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801f12:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f15:	83 ec 04             	sub    $0x4,%esp
+  801f18:	53                   	push   %ebx
+  801f19:	50                   	push   %eax
+  801f1a:	68 a0 57 80 00       	push   $0x8057a0
+  801f1f:	e8 94 e2 ff ff       	call   8001b8 <cprintf>
+		return -E_INVAL;
+  801f24:	83 c4 10             	add    $0x10,%esp
+  801f27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f2c:	eb d8                	jmp    801f06 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801f2e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f33:	eb d1                	jmp    801f06 <ftruncate+0x50>
+
+00801f35 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801f35:	55                   	push   %ebp
+  801f36:	89 e5                	mov    %esp,%ebp
+  801f38:	56                   	push   %esi
+  801f39:	53                   	push   %ebx
+  801f3a:	83 ec 18             	sub    $0x18,%esp
+  801f3d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f40:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f43:	50                   	push   %eax
+  801f44:	ff 75 08             	push   0x8(%ebp)
+  801f47:	e8 92 fb ff ff       	call   801ade <fd_lookup>
+  801f4c:	83 c4 10             	add    $0x10,%esp
+  801f4f:	85 c0                	test   %eax,%eax
+  801f51:	78 49                	js     801f9c <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f53:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f56:	83 ec 08             	sub    $0x8,%esp
+  801f59:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f5c:	50                   	push   %eax
+  801f5d:	ff 36                	push   (%esi)
+  801f5f:	e8 ca fb ff ff       	call   801b2e <dev_lookup>
+  801f64:	83 c4 10             	add    $0x10,%esp
+  801f67:	85 c0                	test   %eax,%eax
+  801f69:	78 31                	js     801f9c <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801f6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f6e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801f72:	74 2f                	je     801fa3 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801f74:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801f77:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801f7e:	00 00 00 
+	stat->st_isdir = 0;
+  801f81:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f88:	00 00 00 
+	stat->st_dev = dev;
+  801f8b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801f91:	83 ec 08             	sub    $0x8,%esp
+  801f94:	53                   	push   %ebx
+  801f95:	56                   	push   %esi
+  801f96:	ff 50 14             	call   *0x14(%eax)
+  801f99:	83 c4 10             	add    $0x10,%esp
+}
+  801f9c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f9f:	5b                   	pop    %ebx
+  801fa0:	5e                   	pop    %esi
+  801fa1:	5d                   	pop    %ebp
+  801fa2:	c3                   	ret
+		return -E_NOT_SUPP;
+  801fa3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fa8:	eb f2                	jmp    801f9c <fstat+0x67>
+
+00801faa <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801faa:	55                   	push   %ebp
+  801fab:	89 e5                	mov    %esp,%ebp
+  801fad:	56                   	push   %esi
+  801fae:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801faf:	83 ec 08             	sub    $0x8,%esp
+  801fb2:	6a 00                	push   $0x0
+  801fb4:	ff 75 08             	push   0x8(%ebp)
+  801fb7:	e8 bc 02 00 00       	call   802278 <open>
+  801fbc:	89 c3                	mov    %eax,%ebx
+  801fbe:	83 c4 10             	add    $0x10,%esp
+  801fc1:	85 c0                	test   %eax,%eax
+  801fc3:	78 1b                	js     801fe0 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801fc5:	83 ec 08             	sub    $0x8,%esp
+  801fc8:	ff 75 0c             	push   0xc(%ebp)
+  801fcb:	50                   	push   %eax
+  801fcc:	e8 64 ff ff ff       	call   801f35 <fstat>
+  801fd1:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801fd3:	89 1c 24             	mov    %ebx,(%esp)
+  801fd6:	e8 26 fc ff ff       	call   801c01 <close>
+	return r;
+  801fdb:	83 c4 10             	add    $0x10,%esp
+  801fde:	89 f3                	mov    %esi,%ebx
+}
+  801fe0:	89 d8                	mov    %ebx,%eax
+  801fe2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe5:	5b                   	pop    %ebx
+  801fe6:	5e                   	pop    %esi
+  801fe7:	5d                   	pop    %ebp
+  801fe8:	c3                   	ret
+
+00801fe9 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801fe9:	55                   	push   %ebp
+  801fea:	89 e5                	mov    %esp,%ebp
+  801fec:	57                   	push   %edi
+  801fed:	56                   	push   %esi
+  801fee:	53                   	push   %ebx
+  801fef:	83 ec 0c             	sub    $0xc,%esp
+  801ff2:	89 c7                	mov    %eax,%edi
+  801ff4:	89 d3                	mov    %edx,%ebx
+  801ff6:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801ff8:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801fff:	74 2d                	je     80202e <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802001:	6a 07                	push   $0x7
+  802003:	68 00 f0 80 00       	push   $0x80f000
+  802008:	57                   	push   %edi
+  802009:	ff 35 00 70 80 00    	push   0x807000
+  80200f:	e8 1b f9 ff ff       	call   80192f <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  802014:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80201b:	6a 00                	push   $0x0
+  80201d:	56                   	push   %esi
+  80201e:	53                   	push   %ebx
+  80201f:	6a 00                	push   $0x0
+  802021:	e8 bb f7 ff ff       	call   8017e1 <ipc_recv_pages>
+}
+  802026:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802029:	5b                   	pop    %ebx
+  80202a:	5e                   	pop    %esi
+  80202b:	5f                   	pop    %edi
+  80202c:	5d                   	pop    %ebp
+  80202d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80202e:	83 ec 0c             	sub    $0xc,%esp
+  802031:	6a 01                	push   $0x1
+  802033:	e8 ec f9 ff ff       	call   801a24 <ipc_find_env>
+  802038:	a3 00 70 80 00       	mov    %eax,0x807000
+  80203d:	83 c4 10             	add    $0x10,%esp
+  802040:	eb bf                	jmp    802001 <fsipc_pages+0x18>
+
+00802042 <fsipc>:
+{
+  802042:	55                   	push   %ebp
+  802043:	89 e5                	mov    %esp,%ebp
+  802045:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  802048:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80204d:	e8 97 ff ff ff       	call   801fe9 <fsipc_pages>
+}
+  802052:	c9                   	leave
+  802053:	c3                   	ret
+
+00802054 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802054:	55                   	push   %ebp
+  802055:	89 e5                	mov    %esp,%ebp
+  802057:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80205a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80205d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802060:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  802065:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802068:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80206d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802072:	b8 02 00 00 00       	mov    $0x2,%eax
+  802077:	e8 c6 ff ff ff       	call   802042 <fsipc>
+}
+  80207c:	c9                   	leave
+  80207d:	c3                   	ret
+
+0080207e <devfile_flush>:
+{
+  80207e:	55                   	push   %ebp
+  80207f:	89 e5                	mov    %esp,%ebp
+  802081:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802084:	8b 45 08             	mov    0x8(%ebp),%eax
+  802087:	8b 40 0c             	mov    0xc(%eax),%eax
+  80208a:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80208f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802094:	b8 06 00 00 00       	mov    $0x6,%eax
+  802099:	e8 a4 ff ff ff       	call   802042 <fsipc>
+}
+  80209e:	c9                   	leave
+  80209f:	c3                   	ret
+
+008020a0 <devfile_stat>:
+{
+  8020a0:	55                   	push   %ebp
+  8020a1:	89 e5                	mov    %esp,%ebp
+  8020a3:	53                   	push   %ebx
+  8020a4:	83 ec 04             	sub    $0x4,%esp
+  8020a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8020aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ad:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020b0:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8020b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ba:	b8 05 00 00 00       	mov    $0x5,%eax
+  8020bf:	e8 7e ff ff ff       	call   802042 <fsipc>
+  8020c4:	85 c0                	test   %eax,%eax
+  8020c6:	78 2c                	js     8020f4 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8020c8:	83 ec 08             	sub    $0x8,%esp
+  8020cb:	68 00 f0 80 00       	push   $0x80f000
+  8020d0:	53                   	push   %ebx
+  8020d1:	e8 c9 e6 ff ff       	call   80079f <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8020d6:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  8020db:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020e1:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  8020e6:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8020ec:	83 c4 10             	add    $0x10,%esp
+  8020ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020f7:	c9                   	leave
+  8020f8:	c3                   	ret
+
+008020f9 <devfile_write>:
+{
+  8020f9:	55                   	push   %ebp
+  8020fa:	89 e5                	mov    %esp,%ebp
+  8020fc:	83 ec 0c             	sub    $0xc,%esp
+  8020ff:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802102:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802107:	39 d0                	cmp    %edx,%eax
+  802109:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80210c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80210f:	8b 52 0c             	mov    0xc(%edx),%edx
+  802112:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  802118:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80211d:	50                   	push   %eax
+  80211e:	ff 75 0c             	push   0xc(%ebp)
+  802121:	68 08 f0 80 00       	push   $0x80f008
+  802126:	e8 fa e7 ff ff       	call   800925 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  80212b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802130:	b8 04 00 00 00       	mov    $0x4,%eax
+  802135:	e8 08 ff ff ff       	call   802042 <fsipc>
+}
+  80213a:	c9                   	leave
+  80213b:	c3                   	ret
+
+0080213c <devfile_read>:
+{
+  80213c:	55                   	push   %ebp
+  80213d:	89 e5                	mov    %esp,%ebp
+  80213f:	57                   	push   %edi
+  802140:	56                   	push   %esi
+  802141:	53                   	push   %ebx
+  802142:	83 ec 1c             	sub    $0x1c,%esp
+  802145:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802148:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  80214b:	89 fe                	mov    %edi,%esi
+  80214d:	c1 ee 0c             	shr    $0xc,%esi
+  802150:	b8 20 00 00 00       	mov    $0x20,%eax
+  802155:	39 c6                	cmp    %eax,%esi
+  802157:	0f 47 f0             	cmova  %eax,%esi
+  80215a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80215d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802162:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802165:	eb 14                	jmp    80217b <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802167:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  80216e:	05 00 10 00 00       	add    $0x1000,%eax
+  802173:	f6 c6 06             	test   $0x6,%dh
+  802176:	75 42                	jne    8021ba <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802178:	83 c1 01             	add    $0x1,%ecx
+  80217b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80217e:	39 f1                	cmp    %esi,%ecx
+  802180:	0f 84 95 00 00 00    	je     80221b <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  802186:	89 c2                	mov    %eax,%edx
+  802188:	c1 ea 16             	shr    $0x16,%edx
+  80218b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802192:	f6 c2 01             	test   $0x1,%dl
+  802195:	74 23                	je     8021ba <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  802197:	89 c2                	mov    %eax,%edx
+  802199:	c1 ea 0c             	shr    $0xc,%edx
+  80219c:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8021a3:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  8021a9:	74 0f                	je     8021ba <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  8021ab:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8021b2:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  8021b8:	75 ad                	jne    802167 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  8021ba:	85 c9                	test   %ecx,%ecx
+  8021bc:	74 11                	je     8021cf <devfile_read+0x93>
+  8021be:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  8021c5:	75 08                	jne    8021cf <devfile_read+0x93>
+  8021c7:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  8021cd:	74 50                	je     80221f <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8021cf:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8021d2:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  8021d7:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8021dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021e7:	e8 56 fe ff ff       	call   802042 <fsipc>
+  8021ec:	89 c6                	mov    %eax,%esi
+  8021ee:	85 c0                	test   %eax,%eax
+  8021f0:	78 1f                	js     802211 <devfile_read+0xd5>
+	assert(r <= n);
+  8021f2:	39 c7                	cmp    %eax,%edi
+  8021f4:	72 50                	jb     802246 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  8021f6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8021fb:	7f 62                	jg     80225f <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  8021fd:	83 ec 04             	sub    $0x4,%esp
+  802200:	50                   	push   %eax
+  802201:	68 00 f0 80 00       	push   $0x80f000
+  802206:	ff 75 0c             	push   0xc(%ebp)
+  802209:	e8 17 e7 ff ff       	call   800925 <memmove>
+	return r;
+  80220e:	83 c4 10             	add    $0x10,%esp
+}
+  802211:	89 f0                	mov    %esi,%eax
+  802213:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802216:	5b                   	pop    %ebx
+  802217:	5e                   	pop    %esi
+  802218:	5f                   	pop    %edi
+  802219:	5d                   	pop    %ebp
+  80221a:	c3                   	ret
+  80221b:	89 f1                	mov    %esi,%ecx
+  80221d:	eb 9b                	jmp    8021ba <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  80221f:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802222:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  802227:	89 c8                	mov    %ecx,%eax
+  802229:	c1 e0 0c             	shl    $0xc,%eax
+  80222c:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  802231:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802234:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802239:	e8 ab fd ff ff       	call   801fe9 <fsipc_pages>
+  80223e:	89 c6                	mov    %eax,%esi
+  802240:	85 c0                	test   %eax,%eax
+  802242:	78 8b                	js     8021cf <devfile_read+0x93>
+  802244:	eb cb                	jmp    802211 <devfile_read+0xd5>
+	assert(r <= n);
+  802246:	68 0c 58 80 00       	push   $0x80580c
+  80224b:	68 13 58 80 00       	push   $0x805813
+  802250:	68 a0 00 00 00       	push   $0xa0
+  802255:	68 28 58 80 00       	push   $0x805828
+  80225a:	e8 9b 2c 00 00       	call   804efa <_panic>
+	assert(r <= PGSIZE);
+  80225f:	68 33 58 80 00       	push   $0x805833
+  802264:	68 13 58 80 00       	push   $0x805813
+  802269:	68 a1 00 00 00       	push   $0xa1
+  80226e:	68 28 58 80 00       	push   $0x805828
+  802273:	e8 82 2c 00 00       	call   804efa <_panic>
+
+00802278 <open>:
+{
+  802278:	55                   	push   %ebp
+  802279:	89 e5                	mov    %esp,%ebp
+  80227b:	56                   	push   %esi
+  80227c:	53                   	push   %ebx
+  80227d:	83 ec 1c             	sub    $0x1c,%esp
+  802280:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802283:	56                   	push   %esi
+  802284:	e8 db e4 ff ff       	call   800764 <strlen>
+  802289:	83 c4 10             	add    $0x10,%esp
+  80228c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802291:	7f 6c                	jg     8022ff <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802293:	83 ec 0c             	sub    $0xc,%esp
+  802296:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802299:	50                   	push   %eax
+  80229a:	e8 eb f7 ff ff       	call   801a8a <fd_alloc>
+  80229f:	89 c3                	mov    %eax,%ebx
+  8022a1:	83 c4 10             	add    $0x10,%esp
+  8022a4:	85 c0                	test   %eax,%eax
+  8022a6:	78 3c                	js     8022e4 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8022a8:	83 ec 08             	sub    $0x8,%esp
+  8022ab:	56                   	push   %esi
+  8022ac:	68 00 f0 80 00       	push   $0x80f000
+  8022b1:	e8 e9 e4 ff ff       	call   80079f <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8022b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022b9:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8022be:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022c1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022c6:	e8 77 fd ff ff       	call   802042 <fsipc>
+  8022cb:	89 c3                	mov    %eax,%ebx
+  8022cd:	83 c4 10             	add    $0x10,%esp
+  8022d0:	85 c0                	test   %eax,%eax
+  8022d2:	78 19                	js     8022ed <open+0x75>
+	return fd2num(fd);
+  8022d4:	83 ec 0c             	sub    $0xc,%esp
+  8022d7:	ff 75 f4             	push   -0xc(%ebp)
+  8022da:	e8 84 f7 ff ff       	call   801a63 <fd2num>
+  8022df:	89 c3                	mov    %eax,%ebx
+  8022e1:	83 c4 10             	add    $0x10,%esp
+}
+  8022e4:	89 d8                	mov    %ebx,%eax
+  8022e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022e9:	5b                   	pop    %ebx
+  8022ea:	5e                   	pop    %esi
+  8022eb:	5d                   	pop    %ebp
+  8022ec:	c3                   	ret
+		fd_close(fd, 0);
+  8022ed:	83 ec 08             	sub    $0x8,%esp
+  8022f0:	6a 00                	push   $0x0
+  8022f2:	ff 75 f4             	push   -0xc(%ebp)
+  8022f5:	e8 80 f8 ff ff       	call   801b7a <fd_close>
+		return r;
+  8022fa:	83 c4 10             	add    $0x10,%esp
+  8022fd:	eb e5                	jmp    8022e4 <open+0x6c>
+		return -E_BAD_PATH;
+  8022ff:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802304:	eb de                	jmp    8022e4 <open+0x6c>
+
+00802306 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802306:	55                   	push   %ebp
+  802307:	89 e5                	mov    %esp,%ebp
+  802309:	53                   	push   %ebx
+  80230a:	83 ec 10             	sub    $0x10,%esp
+  80230d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802310:	53                   	push   %ebx
+  802311:	e8 4e e4 ff ff       	call   800764 <strlen>
+  802316:	83 c4 10             	add    $0x10,%esp
+  802319:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80231e:	7f 25                	jg     802345 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802320:	83 ec 08             	sub    $0x8,%esp
+  802323:	53                   	push   %ebx
+  802324:	68 00 f0 80 00       	push   $0x80f000
+  802329:	e8 71 e4 ff ff       	call   80079f <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80232e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802333:	b8 07 00 00 00       	mov    $0x7,%eax
+  802338:	e8 05 fd ff ff       	call   802042 <fsipc>
+  80233d:	83 c4 10             	add    $0x10,%esp
+}
+  802340:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802343:	c9                   	leave
+  802344:	c3                   	ret
+		return -E_BAD_PATH;
+  802345:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80234a:	eb f4                	jmp    802340 <remove+0x3a>
+
+0080234c <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80234c:	55                   	push   %ebp
+  80234d:	89 e5                	mov    %esp,%ebp
+  80234f:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802352:	ba 00 00 00 00       	mov    $0x0,%edx
+  802357:	b8 08 00 00 00       	mov    $0x8,%eax
+  80235c:	e8 e1 fc ff ff       	call   802042 <fsipc>
+}
+  802361:	c9                   	leave
+  802362:	c3                   	ret
+
+00802363 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  802363:	55                   	push   %ebp
+  802364:	89 e5                	mov    %esp,%ebp
+  802366:	53                   	push   %ebx
+  802367:	83 ec 04             	sub    $0x4,%esp
+  80236a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  80236d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802372:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802377:	e8 c6 fc ff ff       	call   802042 <fsipc>
+  80237c:	85 c0                	test   %eax,%eax
+  80237e:	78 3c                	js     8023bc <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  802380:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  802385:	89 03                	mov    %eax,(%ebx)
+  802387:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  80238c:	89 43 04             	mov    %eax,0x4(%ebx)
+  80238f:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  802394:	89 43 08             	mov    %eax,0x8(%ebx)
+  802397:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  80239c:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80239f:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  8023a4:	89 43 10             	mov    %eax,0x10(%ebx)
+  8023a7:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  8023ac:	89 43 14             	mov    %eax,0x14(%ebx)
+  8023af:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  8023b4:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  8023b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023bf:	c9                   	leave
+  8023c0:	c3                   	ret
+
+008023c1 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  8023c1:	55                   	push   %ebp
+  8023c2:	89 e5                	mov    %esp,%ebp
+  8023c4:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  8023c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ca:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  8023cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023d4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8023d9:	e8 64 fc ff ff       	call   802042 <fsipc>
+}
+  8023de:	c9                   	leave
+  8023df:	c3                   	ret
+
+008023e0 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023e0:	55                   	push   %ebp
+  8023e1:	89 e5                	mov    %esp,%ebp
+  8023e3:	56                   	push   %esi
+  8023e4:	53                   	push   %ebx
+  8023e5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8023e8:	83 ec 0c             	sub    $0xc,%esp
+  8023eb:	ff 75 08             	push   0x8(%ebp)
+  8023ee:	e8 80 f6 ff ff       	call   801a73 <fd2data>
+  8023f3:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023f5:	83 c4 08             	add    $0x8,%esp
+  8023f8:	68 3f 58 80 00       	push   $0x80583f
+  8023fd:	53                   	push   %ebx
+  8023fe:	e8 9c e3 ff ff       	call   80079f <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802403:	8b 46 04             	mov    0x4(%esi),%eax
+  802406:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  80240c:	2b 0e                	sub    (%esi),%ecx
+  80240e:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802413:	89 c8                	mov    %ecx,%eax
+  802415:	f7 e2                	mul    %edx
+  802417:	c1 ea 0c             	shr    $0xc,%edx
+  80241a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802420:	29 d1                	sub    %edx,%ecx
+  802422:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  802428:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80242f:	00 00 00 
+	stat->st_dev = &devpipe;
+  802432:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  802439:	60 80 00 
+	return 0;
+}
+  80243c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802441:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802444:	5b                   	pop    %ebx
+  802445:	5e                   	pop    %esi
+  802446:	5d                   	pop    %ebp
+  802447:	c3                   	ret
+
+00802448 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802448:	55                   	push   %ebp
+  802449:	89 e5                	mov    %esp,%ebp
+  80244b:	53                   	push   %ebx
+  80244c:	83 ec 0c             	sub    $0xc,%esp
+  80244f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802452:	53                   	push   %ebx
+  802453:	6a 00                	push   $0x0
+  802455:	e8 bd e8 ff ff       	call   800d17 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80245a:	89 1c 24             	mov    %ebx,(%esp)
+  80245d:	e8 11 f6 ff ff       	call   801a73 <fd2data>
+  802462:	83 c4 08             	add    $0x8,%esp
+  802465:	50                   	push   %eax
+  802466:	6a 00                	push   $0x0
+  802468:	e8 aa e8 ff ff       	call   800d17 <sys_page_unmap>
+}
+  80246d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802470:	c9                   	leave
+  802471:	c3                   	ret
+
+00802472 <_pipeisclosed>:
+{
+  802472:	55                   	push   %ebp
+  802473:	89 e5                	mov    %esp,%ebp
+  802475:	57                   	push   %edi
+  802476:	56                   	push   %esi
+  802477:	53                   	push   %ebx
+  802478:	83 ec 1c             	sub    $0x1c,%esp
+  80247b:	89 c7                	mov    %eax,%edi
+  80247d:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80247f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802484:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802487:	83 ec 0c             	sub    $0xc,%esp
+  80248a:	57                   	push   %edi
+  80248b:	e8 ca 2b 00 00       	call   80505a <pageref>
+  802490:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802493:	89 34 24             	mov    %esi,(%esp)
+  802496:	e8 bf 2b 00 00       	call   80505a <pageref>
+		nn = thisenv->env_runs;
+  80249b:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  8024a1:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8024a4:	83 c4 10             	add    $0x10,%esp
+  8024a7:	39 cb                	cmp    %ecx,%ebx
+  8024a9:	74 1b                	je     8024c6 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8024ab:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024ae:	75 cf                	jne    80247f <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8024b0:	8b 42 58             	mov    0x58(%edx),%eax
+  8024b3:	6a 01                	push   $0x1
+  8024b5:	50                   	push   %eax
+  8024b6:	53                   	push   %ebx
+  8024b7:	68 46 58 80 00       	push   $0x805846
+  8024bc:	e8 f7 dc ff ff       	call   8001b8 <cprintf>
+  8024c1:	83 c4 10             	add    $0x10,%esp
+  8024c4:	eb b9                	jmp    80247f <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8024c6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024c9:	0f 94 c0             	sete   %al
+  8024cc:	0f b6 c0             	movzbl %al,%eax
+}
+  8024cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024d2:	5b                   	pop    %ebx
+  8024d3:	5e                   	pop    %esi
+  8024d4:	5f                   	pop    %edi
+  8024d5:	5d                   	pop    %ebp
+  8024d6:	c3                   	ret
+
+008024d7 <devpipe_read>:
+{
+  8024d7:	55                   	push   %ebp
+  8024d8:	89 e5                	mov    %esp,%ebp
+  8024da:	57                   	push   %edi
+  8024db:	56                   	push   %esi
+  8024dc:	53                   	push   %ebx
+  8024dd:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8024e0:	ff 75 08             	push   0x8(%ebp)
+  8024e3:	e8 8b f5 ff ff       	call   801a73 <fd2data>
+  8024e8:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8024ea:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8024ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8024f0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8024f3:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8024f6:	8b 0b                	mov    (%ebx),%ecx
+  8024f8:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8024fe:	29 ce                	sub    %ecx,%esi
+  802500:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802505:	f7 e6                	mul    %esi
+  802507:	c1 ea 0c             	shr    $0xc,%edx
+  80250a:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  802510:	29 c6                	sub    %eax,%esi
+  802512:	89 f2                	mov    %esi,%edx
+  802514:	75 43                	jne    802559 <devpipe_read+0x82>
+		ref = pageref(p);
+  802516:	83 ec 0c             	sub    $0xc,%esp
+  802519:	53                   	push   %ebx
+  80251a:	e8 3b 2b 00 00       	call   80505a <pageref>
+  80251f:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  802521:	89 da                	mov    %ebx,%edx
+  802523:	8b 45 08             	mov    0x8(%ebp),%eax
+  802526:	e8 47 ff ff ff       	call   802472 <_pipeisclosed>
+  80252b:	83 c4 10             	add    $0x10,%esp
+  80252e:	85 c0                	test   %eax,%eax
+  802530:	0f 85 c1 00 00 00    	jne    8025f7 <devpipe_read+0x120>
+	*sleeping = 1;
+  802536:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  80253d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802542:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  802545:	75 ac                	jne    8024f3 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  802547:	83 ec 04             	sub    $0x4,%esp
+  80254a:	56                   	push   %esi
+  80254b:	57                   	push   %edi
+  80254c:	ff 75 e4             	push   -0x1c(%ebp)
+  80254f:	e8 17 ec ff ff       	call   80116b <sys_futex_wait>
+  802554:	83 c4 10             	add    $0x10,%esp
+  802557:	eb 9a                	jmp    8024f3 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  802559:	39 75 10             	cmp    %esi,0x10(%ebp)
+  80255c:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  802560:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802562:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802567:	f7 e1                	mul    %ecx
+  802569:	c1 ea 0b             	shr    $0xb,%edx
+  80256c:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802572:	29 c1                	sub    %eax,%ecx
+  802574:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  802576:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80257b:	29 cf                	sub    %ecx,%edi
+  80257d:	39 f7                	cmp    %esi,%edi
+  80257f:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  802582:	8d 43 10             	lea    0x10(%ebx),%eax
+  802585:	83 ec 04             	sub    $0x4,%esp
+  802588:	57                   	push   %edi
+  802589:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80258c:	01 c2                	add    %eax,%edx
+  80258e:	52                   	push   %edx
+  80258f:	ff 75 0c             	push   0xc(%ebp)
+  802592:	e8 8e e3 ff ff       	call   800925 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  802597:	83 c4 0c             	add    $0xc,%esp
+  80259a:	89 f1                	mov    %esi,%ecx
+  80259c:	29 f9                	sub    %edi,%ecx
+  80259e:	51                   	push   %ecx
+  80259f:	ff 75 e4             	push   -0x1c(%ebp)
+  8025a2:	89 f8                	mov    %edi,%eax
+  8025a4:	03 45 0c             	add    0xc(%ebp),%eax
+  8025a7:	50                   	push   %eax
+  8025a8:	e8 78 e3 ff ff       	call   800925 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  8025ad:	89 f1                	mov    %esi,%ecx
+  8025af:	03 0b                	add    (%ebx),%ecx
+  8025b1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8025b6:	f7 e1                	mul    %ecx
+  8025b8:	c1 ea 0c             	shr    $0xc,%edx
+  8025bb:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8025c1:	29 d1                	sub    %edx,%ecx
+  8025c3:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  8025c5:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8025ca:	83 c4 10             	add    $0x10,%esp
+  8025cd:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  8025d1:	75 0a                	jne    8025dd <devpipe_read+0x106>
+	return n;
+  8025d3:	89 f0                	mov    %esi,%eax
+}
+  8025d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025d8:	5b                   	pop    %ebx
+  8025d9:	5e                   	pop    %esi
+  8025da:	5f                   	pop    %edi
+  8025db:	5d                   	pop    %ebp
+  8025dc:	c3                   	ret
+		*sleeping = 0;
+  8025dd:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8025e4:	83 ec 08             	sub    $0x8,%esp
+  8025e7:	68 00 04 00 00       	push   $0x400
+  8025ec:	53                   	push   %ebx
+  8025ed:	e8 c9 eb ff ff       	call   8011bb <sys_futex_wake>
+  8025f2:	83 c4 10             	add    $0x10,%esp
+  8025f5:	eb dc                	jmp    8025d3 <devpipe_read+0xfc>
+			return 0;
+  8025f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025fc:	eb d7                	jmp    8025d5 <devpipe_read+0xfe>
+
+008025fe <devpipe_write>:
+{
+  8025fe:	55                   	push   %ebp
+  8025ff:	89 e5                	mov    %esp,%ebp
+  802601:	57                   	push   %edi
+  802602:	56                   	push   %esi
+  802603:	53                   	push   %ebx
+  802604:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802607:	ff 75 08             	push   0x8(%ebp)
+  80260a:	e8 64 f4 ff ff       	call   801a73 <fd2data>
+  80260f:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  802611:	83 c4 10             	add    $0x10,%esp
+  802614:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80261b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80261e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802621:	0f 83 23 01 00 00    	jae    80274a <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802627:	8b 77 04             	mov    0x4(%edi),%esi
+  80262a:	8b 1f                	mov    (%edi),%ebx
+  80262c:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  802632:	29 d9                	sub    %ebx,%ecx
+  802634:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802639:	f7 e1                	mul    %ecx
+  80263b:	c1 ea 0c             	shr    $0xc,%edx
+  80263e:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802644:	29 c1                	sub    %eax,%ecx
+  802646:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802648:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80264e:	75 40                	jne    802690 <devpipe_write+0x92>
+			ref = pageref(p);
+  802650:	83 ec 0c             	sub    $0xc,%esp
+  802653:	57                   	push   %edi
+  802654:	e8 01 2a 00 00       	call   80505a <pageref>
+  802659:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  80265b:	89 fa                	mov    %edi,%edx
+  80265d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802660:	e8 0d fe ff ff       	call   802472 <_pipeisclosed>
+  802665:	83 c4 10             	add    $0x10,%esp
+  802668:	85 c0                	test   %eax,%eax
+  80266a:	0f 85 d5 00 00 00    	jne    802745 <devpipe_write+0x147>
+	*sleeping = 1;
+  802670:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  802677:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80267c:	39 1f                	cmp    %ebx,(%edi)
+  80267e:	75 a7                	jne    802627 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  802680:	83 ec 04             	sub    $0x4,%esp
+  802683:	56                   	push   %esi
+  802684:	53                   	push   %ebx
+  802685:	57                   	push   %edi
+  802686:	e8 e0 ea ff ff       	call   80116b <sys_futex_wait>
+  80268b:	83 c4 10             	add    $0x10,%esp
+  80268e:	eb 97                	jmp    802627 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802690:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802693:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802696:	29 c1                	sub    %eax,%ecx
+  802698:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80269d:	89 d8                	mov    %ebx,%eax
+  80269f:	29 d0                	sub    %edx,%eax
+  8026a1:	39 c1                	cmp    %eax,%ecx
+  8026a3:	0f 46 c1             	cmovbe %ecx,%eax
+  8026a6:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  8026a8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8026ad:	f7 e6                	mul    %esi
+  8026af:	c1 ea 0b             	shr    $0xb,%edx
+  8026b2:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8026b8:	29 c6                	sub    %eax,%esi
+  8026ba:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8026bc:	29 f3                	sub    %esi,%ebx
+  8026be:	39 cb                	cmp    %ecx,%ebx
+  8026c0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8026c3:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  8026c6:	8d 77 10             	lea    0x10(%edi),%esi
+  8026c9:	83 ec 04             	sub    $0x4,%esp
+  8026cc:	53                   	push   %ebx
+  8026cd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026d0:	03 45 0c             	add    0xc(%ebp),%eax
+  8026d3:	50                   	push   %eax
+  8026d4:	01 f2                	add    %esi,%edx
+  8026d6:	52                   	push   %edx
+  8026d7:	e8 49 e2 ff ff       	call   800925 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8026dc:	83 c4 0c             	add    $0xc,%esp
+  8026df:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8026e2:	29 d8                	sub    %ebx,%eax
+  8026e4:	50                   	push   %eax
+  8026e5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8026e8:	01 d3                	add    %edx,%ebx
+  8026ea:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8026ed:	53                   	push   %ebx
+  8026ee:	56                   	push   %esi
+  8026ef:	e8 31 e2 ff ff       	call   800925 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8026f4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8026f7:	03 4f 04             	add    0x4(%edi),%ecx
+  8026fa:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8026ff:	f7 e1                	mul    %ecx
+  802701:	c1 ea 0c             	shr    $0xc,%edx
+  802704:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80270a:	29 d1                	sub    %edx,%ecx
+  80270c:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  80270f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802714:	83 c4 10             	add    $0x10,%esp
+  802717:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  80271b:	75 0b                	jne    802728 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  80271d:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  802720:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802723:	e9 f3 fe ff ff       	jmp    80261b <devpipe_write+0x1d>
+		*sleeping = 0;
+  802728:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  80272f:	83 ec 08             	sub    $0x8,%esp
+  802732:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802737:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  80273a:	50                   	push   %eax
+  80273b:	e8 7b ea ff ff       	call   8011bb <sys_futex_wake>
+  802740:	83 c4 10             	add    $0x10,%esp
+  802743:	eb d8                	jmp    80271d <devpipe_write+0x11f>
+				return 0;
+  802745:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80274a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80274d:	5b                   	pop    %ebx
+  80274e:	5e                   	pop    %esi
+  80274f:	5f                   	pop    %edi
+  802750:	5d                   	pop    %ebp
+  802751:	c3                   	ret
+
+00802752 <pipe>:
+{
+  802752:	55                   	push   %ebp
+  802753:	89 e5                	mov    %esp,%ebp
+  802755:	56                   	push   %esi
+  802756:	53                   	push   %ebx
+  802757:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80275a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80275d:	50                   	push   %eax
+  80275e:	e8 27 f3 ff ff       	call   801a8a <fd_alloc>
+  802763:	89 c3                	mov    %eax,%ebx
+  802765:	83 c4 10             	add    $0x10,%esp
+  802768:	85 c0                	test   %eax,%eax
+  80276a:	0f 88 23 01 00 00    	js     802893 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802770:	83 ec 04             	sub    $0x4,%esp
+  802773:	68 07 04 00 00       	push   $0x407
+  802778:	ff 75 f4             	push   -0xc(%ebp)
+  80277b:	6a 00                	push   $0x0
+  80277d:	e8 10 e5 ff ff       	call   800c92 <sys_page_alloc>
+  802782:	89 c3                	mov    %eax,%ebx
+  802784:	83 c4 10             	add    $0x10,%esp
+  802787:	85 c0                	test   %eax,%eax
+  802789:	0f 88 04 01 00 00    	js     802893 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80278f:	83 ec 0c             	sub    $0xc,%esp
+  802792:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802795:	50                   	push   %eax
+  802796:	e8 ef f2 ff ff       	call   801a8a <fd_alloc>
+  80279b:	89 c3                	mov    %eax,%ebx
+  80279d:	83 c4 10             	add    $0x10,%esp
+  8027a0:	85 c0                	test   %eax,%eax
+  8027a2:	0f 88 db 00 00 00    	js     802883 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027a8:	83 ec 04             	sub    $0x4,%esp
+  8027ab:	68 07 04 00 00       	push   $0x407
+  8027b0:	ff 75 f0             	push   -0x10(%ebp)
+  8027b3:	6a 00                	push   $0x0
+  8027b5:	e8 d8 e4 ff ff       	call   800c92 <sys_page_alloc>
+  8027ba:	89 c3                	mov    %eax,%ebx
+  8027bc:	83 c4 10             	add    $0x10,%esp
+  8027bf:	85 c0                	test   %eax,%eax
+  8027c1:	0f 88 bc 00 00 00    	js     802883 <pipe+0x131>
+	va = fd2data(fd0);
+  8027c7:	83 ec 0c             	sub    $0xc,%esp
+  8027ca:	ff 75 f4             	push   -0xc(%ebp)
+  8027cd:	e8 a1 f2 ff ff       	call   801a73 <fd2data>
+  8027d2:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027d4:	83 c4 0c             	add    $0xc,%esp
+  8027d7:	68 07 04 00 00       	push   $0x407
+  8027dc:	50                   	push   %eax
+  8027dd:	6a 00                	push   $0x0
+  8027df:	e8 ae e4 ff ff       	call   800c92 <sys_page_alloc>
+  8027e4:	89 c3                	mov    %eax,%ebx
+  8027e6:	83 c4 10             	add    $0x10,%esp
+  8027e9:	85 c0                	test   %eax,%eax
+  8027eb:	0f 88 82 00 00 00    	js     802873 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027f1:	83 ec 0c             	sub    $0xc,%esp
+  8027f4:	ff 75 f0             	push   -0x10(%ebp)
+  8027f7:	e8 77 f2 ff ff       	call   801a73 <fd2data>
+  8027fc:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802803:	50                   	push   %eax
+  802804:	6a 00                	push   $0x0
+  802806:	56                   	push   %esi
+  802807:	6a 00                	push   $0x0
+  802809:	e8 c7 e4 ff ff       	call   800cd5 <sys_page_map>
+  80280e:	89 c3                	mov    %eax,%ebx
+  802810:	83 c4 20             	add    $0x20,%esp
+  802813:	85 c0                	test   %eax,%eax
+  802815:	78 4e                	js     802865 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802817:	a1 20 60 80 00       	mov    0x806020,%eax
+  80281c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80281f:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802821:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802824:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80282b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80282e:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802830:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802833:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80283a:	83 ec 0c             	sub    $0xc,%esp
+  80283d:	ff 75 f4             	push   -0xc(%ebp)
+  802840:	e8 1e f2 ff ff       	call   801a63 <fd2num>
+  802845:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802848:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80284a:	83 c4 04             	add    $0x4,%esp
+  80284d:	ff 75 f0             	push   -0x10(%ebp)
+  802850:	e8 0e f2 ff ff       	call   801a63 <fd2num>
+  802855:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802858:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80285b:	83 c4 10             	add    $0x10,%esp
+  80285e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802863:	eb 2e                	jmp    802893 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802865:	83 ec 08             	sub    $0x8,%esp
+  802868:	56                   	push   %esi
+  802869:	6a 00                	push   $0x0
+  80286b:	e8 a7 e4 ff ff       	call   800d17 <sys_page_unmap>
+  802870:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802873:	83 ec 08             	sub    $0x8,%esp
+  802876:	ff 75 f0             	push   -0x10(%ebp)
+  802879:	6a 00                	push   $0x0
+  80287b:	e8 97 e4 ff ff       	call   800d17 <sys_page_unmap>
+  802880:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802883:	83 ec 08             	sub    $0x8,%esp
+  802886:	ff 75 f4             	push   -0xc(%ebp)
+  802889:	6a 00                	push   $0x0
+  80288b:	e8 87 e4 ff ff       	call   800d17 <sys_page_unmap>
+  802890:	83 c4 10             	add    $0x10,%esp
+}
+  802893:	89 d8                	mov    %ebx,%eax
+  802895:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802898:	5b                   	pop    %ebx
+  802899:	5e                   	pop    %esi
+  80289a:	5d                   	pop    %ebp
+  80289b:	c3                   	ret
+
+0080289c <pipeisclosed>:
+{
+  80289c:	55                   	push   %ebp
+  80289d:	89 e5                	mov    %esp,%ebp
+  80289f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8028a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028a5:	50                   	push   %eax
+  8028a6:	ff 75 08             	push   0x8(%ebp)
+  8028a9:	e8 30 f2 ff ff       	call   801ade <fd_lookup>
+  8028ae:	83 c4 10             	add    $0x10,%esp
+  8028b1:	85 c0                	test   %eax,%eax
+  8028b3:	78 18                	js     8028cd <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8028b5:	83 ec 0c             	sub    $0xc,%esp
+  8028b8:	ff 75 f4             	push   -0xc(%ebp)
+  8028bb:	e8 b3 f1 ff ff       	call   801a73 <fd2data>
+  8028c0:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8028c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028c5:	e8 a8 fb ff ff       	call   802472 <_pipeisclosed>
+  8028ca:	83 c4 10             	add    $0x10,%esp
+}
+  8028cd:	c9                   	leave
+  8028ce:	c3                   	ret
+
+008028cf <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  8028cf:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8028d1:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  8028d7:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  8028dd:	81 c2 34 01 00 00    	add    $0x134,%edx
+  8028e3:	39 d0                	cmp    %edx,%eax
+  8028e5:	74 2e                	je     802915 <segment_lookup+0x46>
+{
+  8028e7:	55                   	push   %ebp
+  8028e8:	89 e5                	mov    %esp,%ebp
+  8028ea:	57                   	push   %edi
+  8028eb:	56                   	push   %esi
+  8028ec:	53                   	push   %ebx
+  8028ed:	eb 07                	jmp    8028f6 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8028ef:	83 c0 20             	add    $0x20,%eax
+  8028f2:	39 d0                	cmp    %edx,%eax
+  8028f4:	74 15                	je     80290b <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  8028f6:	8b 18                	mov    (%eax),%ebx
+  8028f8:	39 d9                	cmp    %ebx,%ecx
+  8028fa:	72 f3                	jb     8028ef <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  8028fc:	8b 38                	mov    (%eax),%edi
+  8028fe:	8b 58 04             	mov    0x4(%eax),%ebx
+  802901:	89 ce                	mov    %ecx,%esi
+  802903:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  802905:	39 de                	cmp    %ebx,%esi
+  802907:	73 e6                	jae    8028ef <segment_lookup+0x20>
+  802909:	eb 05                	jmp    802910 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  80290b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802910:	5b                   	pop    %ebx
+  802911:	5e                   	pop    %esi
+  802912:	5f                   	pop    %edi
+  802913:	5d                   	pop    %ebp
+  802914:	c3                   	ret
+	return NULL;
+  802915:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80291a:	c3                   	ret
+
+0080291b <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  80291b:	55                   	push   %ebp
+  80291c:	89 e5                	mov    %esp,%ebp
+  80291e:	53                   	push   %ebx
+  80291f:	83 ec 04             	sub    $0x4,%esp
+  802922:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802924:	c1 e8 16             	shr    $0x16,%eax
+  802927:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80292e:	25 81 00 00 00       	and    $0x81,%eax
+  802933:	83 f8 01             	cmp    $0x1,%eax
+  802936:	75 6b                	jne    8029a3 <page_is_clean+0x88>
+  802938:	89 da                	mov    %ebx,%edx
+  80293a:	c1 ea 0c             	shr    $0xc,%edx
+  80293d:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  802944:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802949:	f6 c1 01             	test   $0x1,%cl
+  80294c:	74 5a                	je     8029a8 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  80294e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802955:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  80295b:	75 4b                	jne    8029a8 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  80295d:	89 d8                	mov    %ebx,%eax
+  80295f:	e8 6b ff ff ff       	call   8028cf <segment_lookup>
+  802964:	89 c2                	mov    %eax,%edx
+		return 1;
+  802966:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  80296b:	85 d2                	test   %edx,%edx
+  80296d:	75 39                	jne    8029a8 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  80296f:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  802975:	b8 00 00 00 00       	mov    $0x0,%eax
+  80297a:	eb 03                	jmp    80297f <page_is_clean+0x64>
+  80297c:	83 c0 01             	add    $0x1,%eax
+  80297f:	39 c2                	cmp    %eax,%edx
+  802981:	7e 19                	jle    80299c <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  802983:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  80298a:	72 f0                	jb     80297c <page_is_clean+0x61>
+  80298c:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  802993:	73 e7                	jae    80297c <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  802995:	b8 01 00 00 00       	mov    $0x1,%eax
+  80299a:	eb 0c                	jmp    8029a8 <page_is_clean+0x8d>
+	return 0;
+  80299c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a1:	eb 05                	jmp    8029a8 <page_is_clean+0x8d>
+		return 0;
+  8029a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029ab:	c9                   	leave
+  8029ac:	c3                   	ret
+
+008029ad <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  8029ad:	55                   	push   %ebp
+  8029ae:	89 e5                	mov    %esp,%ebp
+  8029b0:	57                   	push   %edi
+  8029b1:	56                   	push   %esi
+  8029b2:	53                   	push   %ebx
+  8029b3:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8029b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8029bb:	eb 19                	jmp    8029d6 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8029bd:	f7 d3                	not    %ebx
+  8029bf:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8029c5:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8029c7:	83 c6 01             	add    $0x1,%esi
+  8029ca:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8029d0:	0f 87 97 00 00 00    	ja     802a6d <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8029d6:	89 f3                	mov    %esi,%ebx
+  8029d8:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  8029de:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8029e4:	89 d8                	mov    %ebx,%eax
+  8029e6:	c1 e8 0a             	shr    $0xa,%eax
+  8029e9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8029f0:	25 81 00 00 00       	and    $0x81,%eax
+  8029f5:	83 f8 01             	cmp    $0x1,%eax
+  8029f8:	75 c3                	jne    8029bd <linear_walk+0x10>
+  8029fa:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802a00:	77 bb                	ja     8029bd <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802a02:	89 df                	mov    %ebx,%edi
+  802a04:	c1 e7 0c             	shl    $0xc,%edi
+  802a07:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802a0a:	89 f8                	mov    %edi,%eax
+  802a0c:	e8 0a ff ff ff       	call   80291b <page_is_clean>
+  802a11:	84 c0                	test   %al,%al
+  802a13:	75 64                	jne    802a79 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a15:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802a1b:	77 aa                	ja     8029c7 <linear_walk+0x1a>
+  802a1d:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  802a23:	72 a2                	jb     8029c7 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802a25:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a2c:	a8 01                	test   $0x1,%al
+  802a2e:	74 97                	je     8029c7 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802a30:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802a37:	f6 c4 04             	test   $0x4,%ah
+  802a3a:	75 8b                	jne    8029c7 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802a3c:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802a43:	f6 c4 02             	test   $0x2,%ah
+  802a46:	0f 85 7b ff ff ff    	jne    8029c7 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802a4c:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802a53:	c1 e8 0c             	shr    $0xc,%eax
+  802a56:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802a59:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802a5e:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802a62:	66 83 f8 01          	cmp    $0x1,%ax
+  802a66:	76 11                	jbe    802a79 <linear_walk+0xcc>
+  802a68:	e9 5a ff ff ff       	jmp    8029c7 <linear_walk+0x1a>
+  802a6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  802a72:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802a79:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  802a7f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a82:	83 c4 1c             	add    $0x1c,%esp
+  802a85:	5b                   	pop    %ebx
+  802a86:	5e                   	pop    %esi
+  802a87:	5f                   	pop    %edi
+  802a88:	5d                   	pop    %ebp
+  802a89:	c3                   	ret
+
+00802a8a <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802a8a:	55                   	push   %ebp
+  802a8b:	89 e5                	mov    %esp,%ebp
+  802a8d:	56                   	push   %esi
+  802a8e:	53                   	push   %ebx
+  802a8f:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  802a91:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802a96:	83 e0 7f             	and    $0x7f,%eax
+  802a99:	c1 e0 04             	shl    $0x4,%eax
+  802a9c:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  802aa2:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802aa8:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802aae:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  802ab4:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802ab9:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  802abc:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802ac1:	83 c0 01             	add    $0x1,%eax
+  802ac4:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  802ac9:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802acc:	5b                   	pop    %ebx
+  802acd:	5e                   	pop    %esi
+  802ace:	5d                   	pop    %ebp
+  802acf:	c3                   	ret
+
+00802ad0 <page_ring_enter>:
+{
+  802ad0:	55                   	push   %ebp
+  802ad1:	89 e5                	mov    %esp,%ebp
+  802ad3:	57                   	push   %edi
+  802ad4:	56                   	push   %esi
+  802ad5:	53                   	push   %ebx
+  802ad6:	83 ec 18             	sub    $0x18,%esp
+  802ad9:	89 c6                	mov    %eax,%esi
+  802adb:	89 d7                	mov    %edx,%edi
+  802add:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802adf:	6a 00                	push   $0x0
+  802ae1:	6a 00                	push   $0x0
+  802ae3:	6a 00                	push   $0x0
+  802ae5:	6a 07                	push   $0x7
+  802ae7:	ff 35 40 b0 80 00    	push   0x80b040
+  802aed:	e8 5b ee ff ff       	call   80194d <ipc_call>
+  802af2:	83 c4 20             	add    $0x20,%esp
+  802af5:	85 c0                	test   %eax,%eax
+  802af7:	79 22                	jns    802b1b <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802af9:	50                   	push   %eax
+  802afa:	68 5e 58 80 00       	push   $0x80585e
+  802aff:	68 13 02 00 00       	push   $0x213
+  802b04:	68 72 58 80 00       	push   $0x805872
+  802b09:	e8 ec 23 00 00       	call   804efa <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802b0e:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802b13:	83 c0 01             	add    $0x1,%eax
+  802b16:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802b1b:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802b21:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802b26:	39 c2                	cmp    %eax,%edx
+  802b28:	74 24                	je     802b4e <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802b2a:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802b2f:	83 e0 7f             	and    $0x7f,%eax
+  802b32:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802b39:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802b40:	29 f0                	sub    %esi,%eax
+  802b42:	39 d8                	cmp    %ebx,%eax
+  802b44:	73 c8                	jae    802b0e <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802b46:	8b 52 04             	mov    0x4(%edx),%edx
+  802b49:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802b4c:	eb c0                	jmp    802b0e <page_ring_enter+0x3e>
+}
+  802b4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b51:	5b                   	pop    %ebx
+  802b52:	5e                   	pop    %esi
+  802b53:	5f                   	pop    %edi
+  802b54:	5d                   	pop    %ebp
+  802b55:	c3                   	ret
+
+00802b56 <page_ring_reserve>:
+{
+  802b56:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802b58:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802b5d:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802b63:	29 d0                	sub    %edx,%eax
+  802b65:	ba 80 00 00 00       	mov    $0x80,%edx
+  802b6a:	29 ca                	sub    %ecx,%edx
+  802b6c:	39 c2                	cmp    %eax,%edx
+  802b6e:	72 01                	jb     802b71 <page_ring_reserve+0x1b>
+  802b70:	c3                   	ret
+{
+  802b71:	55                   	push   %ebp
+  802b72:	89 e5                	mov    %esp,%ebp
+  802b74:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802b77:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b81:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b86:	e8 45 ff ff ff       	call   802ad0 <page_ring_enter>
+}
+  802b8b:	c9                   	leave
+  802b8c:	c3                   	ret
+
+00802b8d <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802b8d:	55                   	push   %ebp
+  802b8e:	89 e5                	mov    %esp,%ebp
+  802b90:	53                   	push   %ebx
+  802b91:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802b94:	6a 07                	push   $0x7
+  802b96:	6a 01                	push   $0x1
+  802b98:	89 c3                	mov    %eax,%ebx
+  802b9a:	c1 e3 0c             	shl    $0xc,%ebx
+  802b9d:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  802ba3:	52                   	push   %edx
+  802ba4:	6a 04                	push   $0x4
+  802ba6:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  802bad:	e8 9b ed ff ff       	call   80194d <ipc_call>
+	sharereqs[i].nslots = 0;
+  802bb2:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  802bb9:	00 00 00 
+	return r;
+}
+  802bbc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bbf:	c9                   	leave
+  802bc0:	c3                   	ret
+
+00802bc1 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802bc1:	55                   	push   %ebp
+  802bc2:	89 e5                	mov    %esp,%ebp
+  802bc4:	56                   	push   %esi
+  802bc5:	53                   	push   %ebx
+  802bc6:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802bc8:	c1 e8 10             	shr    $0x10,%eax
+  802bcb:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802bce:	89 c2                	mov    %eax,%edx
+  802bd0:	c1 e2 0c             	shl    $0xc,%edx
+  802bd3:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  802bd9:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802bdc:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  802be2:	89 c2                	mov    %eax,%edx
+  802be4:	c1 e2 0a             	shl    $0xa,%edx
+  802be7:	01 f2                	add    %esi,%edx
+  802be9:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802bf0:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802bf6:	74 09                	je     802c01 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bfd:	5b                   	pop    %ebx
+  802bfe:	5e                   	pop    %esi
+  802bff:	5d                   	pop    %ebp
+  802c00:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802c01:	e8 87 ff ff ff       	call   802b8d <page_share_send>
+  802c06:	eb f5                	jmp    802bfd <page_share_slot+0x3c>
+
+00802c08 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802c08:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802c0d:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802c10:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802c15:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  802c1b:	74 09                	je     802c26 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802c1d:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802c22:	85 c0                	test   %eax,%eax
+  802c24:	75 01                	jne    802c27 <page_ring_ready+0x1f>
+}
+  802c26:	c3                   	ret
+{
+  802c27:	55                   	push   %ebp
+  802c28:	89 e5                	mov    %esp,%ebp
+  802c2a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802c2d:	68 07 06 00 00       	push   $0x607
+  802c32:	6a 08                	push   $0x8
+  802c34:	68 00 30 ad de       	push   $0xdead3000
+  802c39:	6a 00                	push   $0x0
+  802c3b:	e8 7d e1 ff ff       	call   800dbd <sys_page_alloc_range>
+  802c40:	83 c4 10             	add    $0x10,%esp
+  802c43:	83 f8 08             	cmp    $0x8,%eax
+  802c46:	74 1b                	je     802c63 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802c48:	83 ec 04             	sub    $0x4,%esp
+  802c4b:	6a 08                	push   $0x8
+  802c4d:	68 00 30 ad de       	push   $0xdead3000
+  802c52:	6a 00                	push   $0x0
+  802c54:	e8 d2 e1 ff ff       	call   800e2b <sys_page_unmap_range>
+		return 0;
+  802c59:	83 c4 10             	add    $0x10,%esp
+  802c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c61:	c9                   	leave
+  802c62:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802c63:	83 ec 0c             	sub    $0xc,%esp
+  802c66:	68 07 04 00 00       	push   $0x407
+  802c6b:	6a 08                	push   $0x8
+  802c6d:	68 00 30 ad de       	push   $0xdead3000
+  802c72:	6a 06                	push   $0x6
+  802c74:	ff 35 40 b0 80 00    	push   0x80b040
+  802c7a:	e8 ce ec ff ff       	call   80194d <ipc_call>
+  802c7f:	83 c4 20             	add    $0x20,%esp
+  802c82:	85 c0                	test   %eax,%eax
+  802c84:	78 14                	js     802c9a <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802c86:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802c8b:	8b 40 48             	mov    0x48(%eax),%eax
+  802c8e:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  802c93:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c98:	eb c7                	jmp    802c61 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802c9a:	83 ec 04             	sub    $0x4,%esp
+  802c9d:	6a 08                	push   $0x8
+  802c9f:	68 00 30 ad de       	push   $0xdead3000
+  802ca4:	6a 00                	push   $0x0
+  802ca6:	e8 80 e1 ff ff       	call   800e2b <sys_page_unmap_range>
+		return 0;
+  802cab:	83 c4 10             	add    $0x10,%esp
+  802cae:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb3:	eb ac                	jmp    802c61 <page_ring_ready+0x59>
+
+00802cb5 <page_remove_slot>:
+{
+  802cb5:	55                   	push   %ebp
+  802cb6:	89 e5                	mov    %esp,%ebp
+  802cb8:	56                   	push   %esi
+  802cb9:	53                   	push   %ebx
+  802cba:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802cbc:	89 c6                	mov    %eax,%esi
+  802cbe:	c1 ee 10             	shr    $0x10,%esi
+  802cc1:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802cc4:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  802ccb:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  802cd1:	74 2a                	je     802cfd <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802cd3:	83 ec 0c             	sub    $0xc,%esp
+  802cd6:	6a 00                	push   $0x0
+  802cd8:	6a 00                	push   $0x0
+  802cda:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802cdc:	c1 e3 04             	shl    $0x4,%ebx
+  802cdf:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802ce2:	53                   	push   %ebx
+  802ce3:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  802cea:	e8 5e ec ff ff       	call   80194d <ipc_call>
+  802cef:	83 c4 20             	add    $0x20,%esp
+  802cf2:	85 c0                	test   %eax,%eax
+  802cf4:	78 2d                	js     802d23 <page_remove_slot+0x6e>
+}
+  802cf6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cf9:	5b                   	pop    %ebx
+  802cfa:	5e                   	pop    %esi
+  802cfb:	5d                   	pop    %ebp
+  802cfc:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802cfd:	e8 06 ff ff ff       	call   802c08 <page_ring_ready>
+  802d02:	85 c0                	test   %eax,%eax
+  802d04:	74 cd                	je     802cd3 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802d06:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d0b:	e8 46 fe ff ff       	call   802b56 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802d10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d15:	89 da                	mov    %ebx,%edx
+  802d17:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d1c:	e8 69 fd ff ff       	call   802a8a <page_ring_post>
+		return;
+  802d21:	eb d3                	jmp    802cf6 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802d23:	50                   	push   %eax
+  802d24:	68 cc 58 80 00       	push   $0x8058cc
+  802d29:	68 ac 03 00 00       	push   $0x3ac
+  802d2e:	68 72 58 80 00       	push   $0x805872
+  802d33:	e8 c2 21 00 00       	call   804efa <_panic>
+
+00802d38 <find_paging_env>:
+	if(pagingenv)
+  802d38:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802d3d:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802d3f:	85 c0                	test   %eax,%eax
+  802d41:	74 05                	je     802d48 <find_paging_env+0x10>
+  802d43:	eb 56                	jmp    802d9b <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802d45:	83 c0 01             	add    $0x1,%eax
+  802d48:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802d4d:	7f 47                	jg     802d96 <find_paging_env+0x5e>
+  802d4f:	83 f9 01             	cmp    $0x1,%ecx
+  802d52:	7f 42                	jg     802d96 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802d54:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802d57:	c1 e2 06             	shl    $0x6,%edx
+  802d5a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802d60:	8b 52 50             	mov    0x50(%edx),%edx
+  802d63:	83 fa 02             	cmp    $0x2,%edx
+  802d66:	75 dd                	jne    802d45 <find_paging_env+0xd>
+  802d68:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802d6b:	c1 e2 06             	shl    $0x6,%edx
+  802d6e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802d74:	8b 52 54             	mov    0x54(%edx),%edx
+  802d77:	85 d2                	test   %edx,%edx
+  802d79:	74 ca                	je     802d45 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802d7b:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802d7e:	c1 e2 06             	shl    $0x6,%edx
+  802d81:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802d87:	8b 52 48             	mov    0x48(%edx),%edx
+  802d8a:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  802d91:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802d94:	eb af                	jmp    802d45 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802d96:	83 f9 02             	cmp    $0x2,%ecx
+  802d99:	74 01                	je     802d9c <find_paging_env+0x64>
+}
+  802d9b:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802d9c:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802da1:	8b 40 48             	mov    0x48(%eax),%eax
+  802da4:	83 e0 01             	and    $0x1,%eax
+  802da7:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  802dae:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  802db3:	eb e6                	jmp    802d9b <find_paging_env+0x63>
+
+00802db5 <page_add_backed>:
+{
+  802db5:	55                   	push   %ebp
+  802db6:	89 e5                	mov    %esp,%ebp
+  802db8:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802dbb:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  802dc0:	83 f8 04             	cmp    $0x4,%eax
+  802dc3:	74 35                	je     802dfa <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802dc5:	89 d1                	mov    %edx,%ecx
+  802dc7:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802dcd:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802dd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802dd7:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802dde:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802de4:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  802deb:	83 c0 01             	add    $0x1,%eax
+  802dee:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  802df3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802df8:	5d                   	pop    %ebp
+  802df9:	c3                   	ret
+		return -E_NO_MEM;
+  802dfa:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802dff:	eb f7                	jmp    802df8 <page_add_backed+0x43>
+
+00802e01 <percentage_of_pgdir_to_walk>:
+{
+  802e01:	55                   	push   %ebp
+  802e02:	89 e5                	mov    %esp,%ebp
+  802e04:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802e07:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802e0b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802e0e:	db 45 fc             	fildl  -0x4(%ebp)
+  802e11:	d8 35 58 5d 80 00    	fdivs  0x805d58
+	return ret*ret;
+  802e17:	d8 c8                	fmul   %st(0),%st
+}
+  802e19:	c9                   	leave
+  802e1a:	c3                   	ret
+
+00802e1b <nfu_with_aging_page_choice_func>:
+{
+  802e1b:	55                   	push   %ebp
+  802e1c:	89 e5                	mov    %esp,%ebp
+  802e1e:	57                   	push   %edi
+  802e1f:	56                   	push   %esi
+  802e20:	53                   	push   %ebx
+  802e21:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802e24:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  802e2a:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802e2c:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802e31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e36:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802e3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e42:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802e45:	eb 18                	jmp    802e5f <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802e47:	f7 d0                	not    %eax
+  802e49:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802e4e:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802e50:	83 c2 01             	add    $0x1,%edx
+  802e53:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802e59:	0f 87 13 01 00 00    	ja     802f72 <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802e5f:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802e63:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802e66:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802e6b:	89 c1                	mov    %eax,%ecx
+  802e6d:	c1 e9 0a             	shr    $0xa,%ecx
+  802e70:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802e77:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802e7d:	83 f9 01             	cmp    $0x1,%ecx
+  802e80:	75 c5                	jne    802e47 <nfu_with_aging_page_choice_func+0x2c>
+  802e82:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802e87:	77 be                	ja     802e47 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802e89:	89 c1                	mov    %eax,%ecx
+  802e8b:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802e8e:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802e94:	0f 82 a5 00 00 00    	jb     802f3f <nfu_with_aging_page_choice_func+0x124>
+  802e9a:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802ea0:	0f 87 99 00 00 00    	ja     802f3f <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802ea6:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802ead:	f6 c1 01             	test   $0x1,%cl
+  802eb0:	0f 84 89 00 00 00    	je     802f3f <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802eb6:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802ebd:	f6 c5 04             	test   $0x4,%ch
+  802ec0:	75 7d                	jne    802f3f <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802ec2:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802ec9:	f6 c5 02             	test   $0x2,%ch
+  802ecc:	75 71                	jne    802f3f <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802ece:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802ed5:	c1 e9 0c             	shr    $0xc,%ecx
+  802ed8:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802edb:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802ee1:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802ee5:	66 83 f9 01          	cmp    $0x1,%cx
+  802ee9:	77 54                	ja     802f3f <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802eeb:	89 f9                	mov    %edi,%ecx
+  802eed:	80 f9 ff             	cmp    $0xff,%cl
+  802ef0:	74 21                	je     802f13 <nfu_with_aging_page_choice_func+0xf8>
+  802ef2:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802ef9:	c1 e9 0c             	shr    $0xc,%ecx
+  802efc:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802eff:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802f05:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802f09:	89 fb                	mov    %edi,%ebx
+  802f0b:	38 d9                	cmp    %bl,%cl
+  802f0d:	73 30                	jae    802f3f <nfu_with_aging_page_choice_func+0x124>
+  802f0f:	dd d8                	fstp   %st(0)
+  802f11:	eb 02                	jmp    802f15 <nfu_with_aging_page_choice_func+0xfa>
+  802f13:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802f15:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802f1c:	c1 e9 0c             	shr    $0xc,%ecx
+  802f1f:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802f22:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802f29:	89 fb                	mov    %edi,%ebx
+  802f2b:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802f2e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802f31:	db 45 e0             	fildl  -0x20(%ebp)
+  802f34:	d8 35 58 5d 80 00    	fdivs  0x805d58
+	return ret*ret;
+  802f3a:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802f3c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802f3f:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802f42:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802f45:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802f4c:	df 6d e0             	fildll -0x20(%ebp)
+  802f4f:	d9 c1                	fld    %st(1)
+  802f51:	d8 0d 5c 5d 80 00    	fmuls  0x805d5c
+  802f57:	d9 c9                	fxch   %st(1)
+  802f59:	df f1                	fcomip %st(1),%st
+  802f5b:	dd d8                	fstp   %st(0)
+  802f5d:	0f 82 ed fe ff ff    	jb     802e50 <nfu_with_aging_page_choice_func+0x35>
+  802f63:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802f65:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  802f6a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802f6d:	c1 e0 0c             	shl    $0xc,%eax
+  802f70:	eb 0e                	jmp    802f80 <nfu_with_aging_page_choice_func+0x165>
+  802f72:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802f74:	89 f8                	mov    %edi,%eax
+  802f76:	3c ff                	cmp    $0xff,%al
+  802f78:	74 0e                	je     802f88 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802f7a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802f7d:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802f80:	83 c4 14             	add    $0x14,%esp
+  802f83:	5b                   	pop    %ebx
+  802f84:	5e                   	pop    %esi
+  802f85:	5f                   	pop    %edi
+  802f86:	5d                   	pop    %ebp
+  802f87:	c3                   	ret
+	pgnum = 0;
+  802f88:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  802f8f:	00 00 00 
+	return (void*)UTOP;
+  802f92:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802f97:	eb e7                	jmp    802f80 <nfu_with_aging_page_choice_func+0x165>
+
+00802f99 <myRand>:
+    state = state * 1664525 + 1013904223;
+  802f99:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  802fa0:	66 19 00 
+  802fa3:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802fa8:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  802fad:	c1 e8 18             	shr    $0x18,%eax
+}
+  802fb0:	c3                   	ret
+
+00802fb1 <random_page_choice_func>:
+{
+  802fb1:	55                   	push   %ebp
+  802fb2:	89 e5                	mov    %esp,%ebp
+  802fb4:	57                   	push   %edi
+  802fb5:	56                   	push   %esi
+  802fb6:	53                   	push   %ebx
+  802fb7:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802fba:	be 00 00 00 00       	mov    $0x0,%esi
+  802fbf:	eb 19                	jmp    802fda <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802fc1:	f7 d3                	not    %ebx
+  802fc3:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802fc9:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802fcb:	83 c6 01             	add    $0x1,%esi
+  802fce:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802fd4:	0f 87 a0 00 00 00    	ja     80307a <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802fda:	89 f3                	mov    %esi,%ebx
+  802fdc:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  802fe2:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802fe8:	89 d8                	mov    %ebx,%eax
+  802fea:	c1 e8 0a             	shr    $0xa,%eax
+  802fed:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802ff4:	25 81 00 00 00       	and    $0x81,%eax
+  802ff9:	83 f8 01             	cmp    $0x1,%eax
+  802ffc:	75 c3                	jne    802fc1 <random_page_choice_func+0x10>
+  802ffe:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803004:	77 bb                	ja     802fc1 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  803006:	89 df                	mov    %ebx,%edi
+  803008:	c1 e7 0c             	shl    $0xc,%edi
+  80300b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80300e:	89 f8                	mov    %edi,%eax
+  803010:	e8 06 f9 ff ff       	call   80291b <page_is_clean>
+  803015:	84 c0                	test   %al,%al
+  803017:	0f 85 82 00 00 00    	jne    80309f <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80301d:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  803023:	72 a6                	jb     802fcb <random_page_choice_func+0x1a>
+  803025:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  80302b:	77 9e                	ja     802fcb <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80302d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803034:	a8 01                	test   $0x1,%al
+  803036:	74 93                	je     802fcb <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803038:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80303f:	f6 c4 04             	test   $0x4,%ah
+  803042:	75 87                	jne    802fcb <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803044:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80304b:	f6 c4 02             	test   $0x2,%ah
+  80304e:	0f 85 77 ff ff ff    	jne    802fcb <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803054:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80305b:	c1 e8 0c             	shr    $0xc,%eax
+  80305e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803061:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803066:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80306a:	66 83 f8 01          	cmp    $0x1,%ax
+  80306e:	0f 87 57 ff ff ff    	ja     802fcb <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  803074:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  80307a:	e8 1a ff ff ff       	call   802f99 <myRand>
+  80307f:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  803085:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  80308a:	29 fe                	sub    %edi,%esi
+  80308c:	0f be c0             	movsbl %al,%eax
+  80308f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803094:	f7 f6                	div    %esi
+  803096:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  803098:	bb 15 00 00 00       	mov    $0x15,%ebx
+  80309d:	eb 1c                	jmp    8030bb <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  80309f:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  8030a5:	e9 8f 00 00 00       	jmp    803139 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8030aa:	e8 ea fe ff ff       	call   802f99 <myRand>
+  8030af:	0f be c0             	movsbl %al,%eax
+  8030b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030b7:	f7 f6                	div    %esi
+  8030b9:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8030bb:	83 eb 01             	sub    $0x1,%ebx
+  8030be:	0f 84 c2 00 00 00    	je     803186 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  8030c4:	89 d0                	mov    %edx,%eax
+  8030c6:	c1 e8 0a             	shr    $0xa,%eax
+  8030c9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8030d0:	25 81 00 00 00       	and    $0x81,%eax
+  8030d5:	83 f8 01             	cmp    $0x1,%eax
+  8030d8:	75 d0                	jne    8030aa <random_page_choice_func+0xf9>
+  8030da:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  8030e0:	77 c8                	ja     8030aa <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  8030e2:	89 d0                	mov    %edx,%eax
+  8030e4:	c1 e0 0c             	shl    $0xc,%eax
+  8030e7:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  8030ec:	72 56                	jb     803144 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8030ee:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  8030f3:	77 65                	ja     80315a <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8030f5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8030fc:	f6 c1 01             	test   $0x1,%cl
+  8030ff:	74 59                	je     80315a <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  803101:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  803108:	f6 c5 04             	test   $0x4,%ch
+  80310b:	75 4d                	jne    80315a <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  80310d:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  803114:	f6 c5 02             	test   $0x2,%ch
+  803117:	75 41                	jne    80315a <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  803119:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803120:	c1 ea 0c             	shr    $0xc,%edx
+  803123:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  803126:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  80312c:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  803130:	66 83 fa 01          	cmp    $0x1,%dx
+  803134:	77 3a                	ja     803170 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  803136:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  803139:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80313c:	83 c4 1c             	add    $0x1c,%esp
+  80313f:	5b                   	pop    %ebx
+  803140:	5e                   	pop    %esi
+  803141:	5f                   	pop    %edi
+  803142:	5d                   	pop    %ebp
+  803143:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  803144:	e8 50 fe ff ff       	call   802f99 <myRand>
+  803149:	0f be c0             	movsbl %al,%eax
+  80314c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803151:	f7 f6                	div    %esi
+  803153:	01 fa                	add    %edi,%edx
+			continue;
+  803155:	e9 61 ff ff ff       	jmp    8030bb <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  80315a:	e8 3a fe ff ff       	call   802f99 <myRand>
+  80315f:	0f be c0             	movsbl %al,%eax
+  803162:	ba 00 00 00 00       	mov    $0x0,%edx
+  803167:	f7 f6                	div    %esi
+  803169:	01 fa                	add    %edi,%edx
+			continue;
+  80316b:	e9 4b ff ff ff       	jmp    8030bb <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  803170:	e8 24 fe ff ff       	call   802f99 <myRand>
+  803175:	0f be c0             	movsbl %al,%eax
+  803178:	ba 00 00 00 00       	mov    $0x0,%edx
+  80317d:	f7 f6                	div    %esi
+  80317f:	01 fa                	add    %edi,%edx
+			continue;
+  803181:	e9 35 ff ff ff       	jmp    8030bb <random_page_choice_func+0x10a>
+	pgnum = 0;
+  803186:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  80318d:	00 00 00 
+	return (void*)UTOP;
+  803190:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  803197:	eb a0                	jmp    803139 <random_page_choice_func+0x188>
+
+00803199 <nfu>:
+{
+  803199:	55                   	push   %ebp
+  80319a:	89 e5                	mov    %esp,%ebp
+  80319c:	57                   	push   %edi
+  80319d:	56                   	push   %esi
+  80319e:	53                   	push   %ebx
+  80319f:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8031a2:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  8031a8:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  8031aa:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8031af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031b4:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8031bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031c0:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  8031c3:	eb 18                	jmp    8031dd <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8031c5:	f7 d0                	not    %eax
+  8031c7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031cc:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8031ce:	83 c2 01             	add    $0x1,%edx
+  8031d1:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  8031d7:	0f 87 13 01 00 00    	ja     8032f0 <nfu+0x157>
+		++num_searched_ptes;
+  8031dd:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8031e1:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8031e4:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8031e9:	89 c1                	mov    %eax,%ecx
+  8031eb:	c1 e9 0a             	shr    $0xa,%ecx
+  8031ee:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8031f5:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8031fb:	83 f9 01             	cmp    $0x1,%ecx
+  8031fe:	75 c5                	jne    8031c5 <nfu+0x2c>
+  803200:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803205:	77 be                	ja     8031c5 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803207:	89 c1                	mov    %eax,%ecx
+  803209:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80320c:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  803212:	0f 82 a5 00 00 00    	jb     8032bd <nfu+0x124>
+  803218:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  80321e:	0f 87 99 00 00 00    	ja     8032bd <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803224:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80322b:	f6 c1 01             	test   $0x1,%cl
+  80322e:	0f 84 89 00 00 00    	je     8032bd <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803234:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80323b:	f6 c5 04             	test   $0x4,%ch
+  80323e:	75 7d                	jne    8032bd <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803240:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803247:	f6 c5 02             	test   $0x2,%ch
+  80324a:	75 71                	jne    8032bd <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80324c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803253:	c1 e9 0c             	shr    $0xc,%ecx
+  803256:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803259:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80325f:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803263:	66 83 f9 01          	cmp    $0x1,%cx
+  803267:	77 54                	ja     8032bd <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  803269:	89 f9                	mov    %edi,%ecx
+  80326b:	80 f9 ff             	cmp    $0xff,%cl
+  80326e:	74 21                	je     803291 <nfu+0xf8>
+  803270:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803277:	c1 e9 0c             	shr    $0xc,%ecx
+  80327a:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80327d:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803283:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  803287:	89 fb                	mov    %edi,%ebx
+  803289:	38 d9                	cmp    %bl,%cl
+  80328b:	73 30                	jae    8032bd <nfu+0x124>
+  80328d:	dd d8                	fstp   %st(0)
+  80328f:	eb 02                	jmp    803293 <nfu+0xfa>
+  803291:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  803293:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80329a:	c1 e9 0c             	shr    $0xc,%ecx
+  80329d:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032a0:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  8032a7:	89 fb                	mov    %edi,%ebx
+  8032a9:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  8032ac:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8032af:	db 45 e0             	fildl  -0x20(%ebp)
+  8032b2:	d8 35 58 5d 80 00    	fdivs  0x805d58
+	return ret*ret;
+  8032b8:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8032ba:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8032bd:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8032c0:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8032c3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8032ca:	df 6d e0             	fildll -0x20(%ebp)
+  8032cd:	d9 c1                	fld    %st(1)
+  8032cf:	d8 0d 5c 5d 80 00    	fmuls  0x805d5c
+  8032d5:	d9 c9                	fxch   %st(1)
+  8032d7:	df f1                	fcomip %st(1),%st
+  8032d9:	dd d8                	fstp   %st(0)
+  8032db:	0f 82 ed fe ff ff    	jb     8031ce <nfu+0x35>
+  8032e1:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  8032e3:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  8032e8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8032eb:	c1 e0 0c             	shl    $0xc,%eax
+  8032ee:	eb 0e                	jmp    8032fe <nfu+0x165>
+  8032f0:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  8032f2:	89 f8                	mov    %edi,%eax
+  8032f4:	3c ff                	cmp    $0xff,%al
+  8032f6:	74 0e                	je     803306 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  8032f8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8032fb:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8032fe:	83 c4 14             	add    $0x14,%esp
+  803301:	5b                   	pop    %ebx
+  803302:	5e                   	pop    %esi
+  803303:	5f                   	pop    %edi
+  803304:	5d                   	pop    %ebp
+  803305:	c3                   	ret
+	pgnum = 0;
+  803306:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  80330d:	00 00 00 
+	return (void*)UTOP;
+  803310:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803315:	eb e7                	jmp    8032fe <nfu+0x165>
+
+00803317 <lru>:
+{
+  803317:	55                   	push   %ebp
+  803318:	89 e5                	mov    %esp,%ebp
+  80331a:	57                   	push   %edi
+  80331b:	56                   	push   %esi
+  80331c:	53                   	push   %ebx
+  80331d:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803320:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  803326:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  80332d:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803334:	be 00 00 00 00       	mov    $0x0,%esi
+  803339:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803340:	ba 00 00 00 00       	mov    $0x0,%edx
+  803345:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  803348:	eb 18                	jmp    803362 <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80334a:	f7 d0                	not    %eax
+  80334c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803351:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803353:	83 c2 01             	add    $0x1,%edx
+  803356:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  80335c:	0f 87 fa 00 00 00    	ja     80345c <lru+0x145>
+		++num_searched_ptes;
+  803362:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803365:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803368:	01 d0                	add    %edx,%eax
+  80336a:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80336f:	89 c1                	mov    %eax,%ecx
+  803371:	c1 e9 0a             	shr    $0xa,%ecx
+  803374:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80337b:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803381:	83 f9 01             	cmp    $0x1,%ecx
+  803384:	75 c4                	jne    80334a <lru+0x33>
+  803386:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  80338b:	77 bd                	ja     80334a <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  80338d:	89 c1                	mov    %eax,%ecx
+  80338f:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803392:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803398:	0f 87 92 00 00 00    	ja     803430 <lru+0x119>
+  80339e:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  8033a4:	0f 82 86 00 00 00    	jb     803430 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8033aa:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8033b1:	f6 c1 01             	test   $0x1,%cl
+  8033b4:	74 7a                	je     803430 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8033b6:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8033bd:	f6 c5 04             	test   $0x4,%ch
+  8033c0:	75 6e                	jne    803430 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8033c2:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8033c9:	f6 c5 02             	test   $0x2,%ch
+  8033cc:	75 62                	jne    803430 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8033ce:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8033d5:	c1 e9 0c             	shr    $0xc,%ecx
+  8033d8:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8033db:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8033e1:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8033e5:	66 83 f9 01          	cmp    $0x1,%cx
+  8033e9:	77 45                	ja     803430 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  8033eb:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8033f2:	c1 e9 0c             	shr    $0xc,%ecx
+  8033f5:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8033f8:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8033fe:	8b 59 14             	mov    0x14(%ecx),%ebx
+  803401:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803404:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  803407:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80340a:	19 df                	sbb    %ebx,%edi
+  80340c:	7c 22                	jl     803430 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  80340e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803415:	c1 e9 0c             	shr    $0xc,%ecx
+  803418:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80341b:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803421:	8b 59 14             	mov    0x14(%ecx),%ebx
+  803424:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803427:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  80342a:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80342d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803430:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  803433:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80343a:	df 6d e0             	fildll -0x20(%ebp)
+  80343d:	d9 05 5c 5d 80 00    	flds   0x805d5c
+  803443:	d9 c9                	fxch   %st(1)
+  803445:	df f1                	fcomip %st(1),%st
+  803447:	dd d8                	fstp   %st(0)
+  803449:	0f 82 04 ff ff ff    	jb     803353 <lru+0x3c>
+			pgnum = pgnum_actual;
+  80344f:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  803454:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803457:	c1 e0 0c             	shl    $0xc,%eax
+  80345a:	eb 06                	jmp    803462 <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  80345c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80345f:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803462:	83 c4 1c             	add    $0x1c,%esp
+  803465:	5b                   	pop    %ebx
+  803466:	5e                   	pop    %esi
+  803467:	5f                   	pop    %edi
+  803468:	5d                   	pop    %ebp
+  803469:	c3                   	ret
+
+0080346a <set_page_choice_func>:
+{
+  80346a:	55                   	push   %ebp
+  80346b:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  80346d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803470:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  803475:	5d                   	pop    %ebp
+  803476:	c3                   	ret
+
+00803477 <get_page_choice>:
+{
+  803477:	55                   	push   %ebp
+  803478:	89 e5                	mov    %esp,%ebp
+  80347a:	57                   	push   %edi
+  80347b:	56                   	push   %esi
+  80347c:	53                   	push   %ebx
+  80347d:	83 ec 24             	sub    $0x24,%esp
+  803480:	8b 75 08             	mov    0x8(%ebp),%esi
+  803483:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  803486:	57                   	push   %edi
+  803487:	56                   	push   %esi
+  803488:	ff 15 3c 60 80 00    	call   *0x80603c
+  80348e:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803490:	83 c4 10             	add    $0x10,%esp
+  803493:	eb 25                	jmp    8034ba <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  803495:	83 ec 08             	sub    $0x8,%esp
+  803498:	c1 e0 16             	shl    $0x16,%eax
+  80349b:	50                   	push   %eax
+  80349c:	6a 00                	push   $0x0
+  80349e:	e8 b6 d8 ff ff       	call   800d59 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8034a3:	83 c4 10             	add    $0x10,%esp
+  8034a6:	85 c0                	test   %eax,%eax
+  8034a8:	75 43                	jne    8034ed <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  8034aa:	83 ec 08             	sub    $0x8,%esp
+  8034ad:	57                   	push   %edi
+  8034ae:	56                   	push   %esi
+  8034af:	ff 15 3c 60 80 00    	call   *0x80603c
+  8034b5:	89 c3                	mov    %eax,%ebx
+  8034b7:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8034ba:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8034bd:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8034c3:	0f 86 ae 00 00 00    	jbe    803577 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  8034c9:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  8034ce:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8034d5:	81 e2 81 00 00 00    	and    $0x81,%edx
+  8034db:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  8034e1:	74 b2                	je     803495 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  8034e3:	83 c0 01             	add    $0x1,%eax
+  8034e6:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  8034eb:	75 e1                	jne    8034ce <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  8034ed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8034f0:	05 00 10 40 11       	add    $0x11401000,%eax
+  8034f5:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8034fa:	76 1f                	jbe    80351b <get_page_choice+0xa4>
+		return (void *) UTOP;
+  8034fc:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  803501:	89 d8                	mov    %ebx,%eax
+  803503:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803506:	5b                   	pop    %ebx
+  803507:	5e                   	pop    %esi
+  803508:	5f                   	pop    %edi
+  803509:	5d                   	pop    %ebp
+  80350a:	c3                   	ret
+		sys_page_split(0, pg_out);
+  80350b:	83 ec 08             	sub    $0x8,%esp
+  80350e:	53                   	push   %ebx
+  80350f:	6a 00                	push   $0x0
+  803511:	e8 43 d8 ff ff       	call   800d59 <sys_page_split>
+  803516:	83 c4 10             	add    $0x10,%esp
+  803519:	eb 6c                	jmp    803587 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  80351b:	83 ec 04             	sub    $0x4,%esp
+  80351e:	68 04 59 80 00       	push   $0x805904
+  803523:	68 cc 01 00 00       	push   $0x1cc
+  803528:	68 72 58 80 00       	push   $0x805872
+  80352d:	e8 c8 19 00 00       	call   804efa <_panic>
+		panic("We tried to page out code pages\n");
+  803532:	83 ec 04             	sub    $0x4,%esp
+  803535:	68 34 59 80 00       	push   $0x805934
+  80353a:	68 d6 01 00 00       	push   $0x1d6
+  80353f:	68 72 58 80 00       	push   $0x805872
+  803544:	e8 b1 19 00 00       	call   804efa <_panic>
+		panic("Invalid mapping for the va\n");
+  803549:	83 ec 04             	sub    $0x4,%esp
+  80354c:	68 7f 58 80 00       	push   $0x80587f
+  803551:	68 da 01 00 00       	push   $0x1da
+  803556:	68 72 58 80 00       	push   $0x805872
+  80355b:	e8 9a 19 00 00       	call   804efa <_panic>
+		panic("We tried to page out a shared page\n");
+  803560:	83 ec 04             	sub    $0x4,%esp
+  803563:	68 58 59 80 00       	push   $0x805958
+  803568:	68 e0 01 00 00       	push   $0x1e0
+  80356d:	68 72 58 80 00       	push   $0x805872
+  803572:	e8 83 19 00 00       	call   804efa <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  803577:	89 de                	mov    %ebx,%esi
+  803579:	c1 ee 16             	shr    $0x16,%esi
+  80357c:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803583:	a8 80                	test   $0x80,%al
+  803585:	75 84                	jne    80350b <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803587:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80358a:	05 00 10 40 11       	add    $0x11401000,%eax
+  80358f:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803594:	76 85                	jbe    80351b <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  803596:	89 d8                	mov    %ebx,%eax
+  803598:	e8 7e f3 ff ff       	call   80291b <page_is_clean>
+  80359d:	84 c0                	test   %al,%al
+  80359f:	0f 85 5c ff ff ff    	jne    803501 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  8035a5:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  8035ac:	76 84                	jbe    803532 <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  8035ae:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8035b5:	a8 01                	test   $0x1,%al
+  8035b7:	74 90                	je     803549 <get_page_choice+0xd2>
+  8035b9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8035bc:	c1 e8 0c             	shr    $0xc,%eax
+  8035bf:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8035c6:	f6 c2 01             	test   $0x1,%dl
+  8035c9:	0f 84 7a ff ff ff    	je     803549 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  8035cf:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  8035d6:	f6 c2 01             	test   $0x1,%dl
+  8035d9:	74 85                	je     803560 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  8035db:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  8035e2:	f6 c2 01             	test   $0x1,%dl
+  8035e5:	0f 84 75 ff ff ff    	je     803560 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8035eb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  8035f2:	f6 c6 04             	test   $0x4,%dh
+  8035f5:	0f 85 65 ff ff ff    	jne    803560 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  8035fb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  803602:	f6 c6 02             	test   $0x2,%dh
+  803605:	0f 85 55 ff ff ff    	jne    803560 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  80360b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803612:	c1 e8 0c             	shr    $0xc,%eax
+  803615:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803618:	05 00 00 00 ef       	add    $0xef000000,%eax
+  80361d:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  803621:	66 83 f8 01          	cmp    $0x1,%ax
+  803625:	0f 86 d6 fe ff ff    	jbe    803501 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  80362b:	83 ec 04             	sub    $0x4,%esp
+  80362e:	68 7c 59 80 00       	push   $0x80597c
+  803633:	68 e2 01 00 00       	push   $0x1e2
+  803638:	68 72 58 80 00       	push   $0x805872
+  80363d:	e8 b8 18 00 00       	call   804efa <_panic>
+
+00803642 <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  803642:	55                   	push   %ebp
+  803643:	89 e5                	mov    %esp,%ebp
+  803645:	57                   	push   %edi
+  803646:	56                   	push   %esi
+  803647:	53                   	push   %ebx
+  803648:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  80364b:	e8 e8 f6 ff ff       	call   802d38 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  803650:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803655:	85 c0                	test   %eax,%eax
+  803657:	74 41                	je     80369a <page_share_paged_out+0x58>
+  803659:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803660:	0f 84 fd 00 00 00    	je     803763 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  803666:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  80366d:	00 00 00 
+  803670:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  803677:	00 00 00 
+  80367a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80367f:	eb 2c                	jmp    8036ad <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803681:	83 c3 04             	add    $0x4,%ebx
+  803684:	39 f3                	cmp    %esi,%ebx
+  803686:	74 1a                	je     8036a2 <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  803688:	8b 03                	mov    (%ebx),%eax
+  80368a:	a8 01                	test   $0x1,%al
+  80368c:	74 f3                	je     803681 <page_share_paged_out+0x3f>
+  80368e:	c1 e8 0c             	shr    $0xc,%eax
+  803691:	e8 2b f5 ff ff       	call   802bc1 <page_share_slot>
+  803696:	85 c0                	test   %eax,%eax
+  803698:	79 e7                	jns    803681 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  80369a:	83 c4 0c             	add    $0xc,%esp
+  80369d:	5b                   	pop    %ebx
+  80369e:	5e                   	pop    %esi
+  80369f:	5f                   	pop    %edi
+  8036a0:	5d                   	pop    %ebp
+  8036a1:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  8036a2:	83 c7 04             	add    $0x4,%edi
+  8036a5:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  8036ab:	74 1b                	je     8036c8 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  8036ad:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8036b2:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  8036b5:	f6 c3 01             	test   $0x1,%bl
+  8036b8:	74 e8                	je     8036a2 <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  8036ba:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8036c0:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  8036c6:	eb bc                	jmp    803684 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8036c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8036cd:	eb 11                	jmp    8036e0 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  8036cf:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8036d5:	83 c3 01             	add    $0x1,%ebx
+  8036d8:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8036de:	77 41                	ja     803721 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  8036e0:	89 d8                	mov    %ebx,%eax
+  8036e2:	c1 e8 0a             	shr    $0xa,%eax
+  8036e5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8036ec:	25 81 00 00 00       	and    $0x81,%eax
+  8036f1:	83 f8 01             	cmp    $0x1,%eax
+  8036f4:	75 d9                	jne    8036cf <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  8036f6:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8036fd:	25 81 00 00 00       	and    $0x81,%eax
+  803702:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803707:	75 cc                	jne    8036d5 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803709:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803710:	c1 e8 0c             	shr    $0xc,%eax
+  803713:	e8 a9 f4 ff ff       	call   802bc1 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803718:	85 c0                	test   %eax,%eax
+  80371a:	79 b9                	jns    8036d5 <page_share_paged_out+0x93>
+  80371c:	e9 79 ff ff ff       	jmp    80369a <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803721:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803728:	75 13                	jne    80373d <page_share_paged_out+0xfb>
+  80372a:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  803731:	75 1d                	jne    803750 <page_share_paged_out+0x10e>
+	return 0;
+  803733:	b8 00 00 00 00       	mov    $0x0,%eax
+  803738:	e9 5d ff ff ff       	jmp    80369a <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80373d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803742:	e8 46 f4 ff ff       	call   802b8d <page_share_send>
+  803747:	85 c0                	test   %eax,%eax
+  803749:	79 df                	jns    80372a <page_share_paged_out+0xe8>
+  80374b:	e9 4a ff ff ff       	jmp    80369a <page_share_paged_out+0x58>
+  803750:	b8 01 00 00 00       	mov    $0x1,%eax
+  803755:	e8 33 f4 ff ff       	call   802b8d <page_share_send>
+  80375a:	85 c0                	test   %eax,%eax
+  80375c:	79 d5                	jns    803733 <page_share_paged_out+0xf1>
+  80375e:	e9 37 ff ff ff       	jmp    80369a <page_share_paged_out+0x58>
+		return 0;
+  803763:	b8 00 00 00 00       	mov    $0x0,%eax
+  803768:	e9 2d ff ff ff       	jmp    80369a <page_share_paged_out+0x58>
+
+0080376d <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  80376d:	55                   	push   %ebp
+  80376e:	89 e5                	mov    %esp,%ebp
+  803770:	56                   	push   %esi
+  803771:	53                   	push   %ebx
+  803772:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  803775:	e8 be f5 ff ff       	call   802d38 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  80377a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  80377f:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803786:	0f 84 82 00 00 00    	je     80380e <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  80378c:	83 ec 0c             	sub    $0xc,%esp
+  80378f:	68 00 10 00 00       	push   $0x1000
+  803794:	e8 84 11 00 00       	call   80491d <malloc>
+  803799:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  80379b:	83 c4 0c             	add    $0xc,%esp
+  80379e:	6a 14                	push   $0x14
+  8037a0:	6a 00                	push   $0x0
+  8037a2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8037a5:	50                   	push   %eax
+  8037a6:	e8 45 d1 ff ff       	call   8008f0 <memset>
+  8037ab:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  8037ae:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  8037b3:	83 ec 0c             	sub    $0xc,%esp
+  8037b6:	6a 07                	push   $0x7
+  8037b8:	6a 01                	push   $0x1
+  8037ba:	53                   	push   %ebx
+  8037bb:	6a 03                	push   $0x3
+  8037bd:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8037c4:	e8 84 e1 ff ff       	call   80194d <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  8037c9:	8b 03                	mov    (%ebx),%eax
+  8037cb:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  8037ce:	8b 43 04             	mov    0x4(%ebx),%eax
+  8037d1:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  8037d4:	8b 43 08             	mov    0x8(%ebx),%eax
+  8037d7:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  8037da:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8037dd:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  8037e0:	8b 43 10             	mov    0x10(%ebx),%eax
+  8037e3:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  8037e6:	83 c6 01             	add    $0x1,%esi
+  8037e9:	83 c4 20             	add    $0x20,%esp
+  8037ec:	83 fe 02             	cmp    $0x2,%esi
+  8037ef:	75 c2                	jne    8037b3 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  8037f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8037f4:	89 03                	mov    %eax,(%ebx)
+  8037f6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8037f9:	89 43 04             	mov    %eax,0x4(%ebx)
+  8037fc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8037ff:	89 43 08             	mov    %eax,0x8(%ebx)
+  803802:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803805:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803808:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80380b:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  80380e:	89 d8                	mov    %ebx,%eax
+  803810:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803813:	5b                   	pop    %ebx
+  803814:	5e                   	pop    %esi
+  803815:	5d                   	pop    %ebp
+  803816:	c3                   	ret
+
+00803817 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803817:	55                   	push   %ebp
+  803818:	89 e5                	mov    %esp,%ebp
+  80381a:	53                   	push   %ebx
+  80381b:	83 ec 10             	sub    $0x10,%esp
+  80381e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  803821:	68 99 58 80 00       	push   $0x805899
+  803826:	e8 8d c9 ff ff       	call   8001b8 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  80382b:	83 c4 08             	add    $0x8,%esp
+  80382e:	ff 33                	push   (%ebx)
+  803830:	68 b0 59 80 00       	push   $0x8059b0
+  803835:	e8 7e c9 ff ff       	call   8001b8 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  80383a:	83 c4 08             	add    $0x8,%esp
+  80383d:	ff 73 04             	push   0x4(%ebx)
+  803840:	68 9b 58 80 00       	push   $0x80589b
+  803845:	e8 6e c9 ff ff       	call   8001b8 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  80384a:	83 c4 08             	add    $0x8,%esp
+  80384d:	ff 73 08             	push   0x8(%ebx)
+  803850:	68 d0 59 80 00       	push   $0x8059d0
+  803855:	e8 5e c9 ff ff       	call   8001b8 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  80385a:	83 c4 08             	add    $0x8,%esp
+  80385d:	ff 73 0c             	push   0xc(%ebx)
+  803860:	68 f4 59 80 00       	push   $0x8059f4
+  803865:	e8 4e c9 ff ff       	call   8001b8 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  80386a:	83 c4 08             	add    $0x8,%esp
+  80386d:	ff 73 10             	push   0x10(%ebx)
+  803870:	68 18 5a 80 00       	push   $0x805a18
+  803875:	e8 3e c9 ff ff       	call   8001b8 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  80387a:	83 c4 08             	add    $0x8,%esp
+  80387d:	ff 35 08 b0 80 00    	push   0x80b008
+  803883:	68 54 5a 80 00       	push   $0x805a54
+  803888:	e8 2b c9 ff ff       	call   8001b8 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  80388d:	83 c4 08             	add    $0x8,%esp
+  803890:	ff 35 04 b0 80 00    	push   0x80b004
+  803896:	68 88 5a 80 00       	push   $0x805a88
+  80389b:	e8 18 c9 ff ff       	call   8001b8 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  8038a0:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8038a5:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  8038a8:	8b 50 68             	mov    0x68(%eax),%edx
+  8038ab:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  8038ae:	51                   	push   %ecx
+  8038af:	52                   	push   %edx
+  8038b0:	50                   	push   %eax
+  8038b1:	68 c8 5a 80 00       	push   $0x805ac8
+  8038b6:	e8 fd c8 ff ff       	call   8001b8 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  8038bb:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8038c0:	8b 40 70             	mov    0x70(%eax),%eax
+  8038c3:	83 c4 18             	add    $0x18,%esp
+  8038c6:	50                   	push   %eax
+  8038c7:	68 fc 5a 80 00       	push   $0x805afc
+  8038cc:	e8 e7 c8 ff ff       	call   8001b8 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  8038d1:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  8038d7:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  8038dd:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  8038e2:	51                   	push   %ecx
+  8038e3:	52                   	push   %edx
+  8038e4:	50                   	push   %eax
+  8038e5:	68 2c 5b 80 00       	push   $0x805b2c
+  8038ea:	e8 c9 c8 ff ff       	call   8001b8 <cprintf>
+	cprintf("\n");
+  8038ef:	83 c4 14             	add    $0x14,%esp
+  8038f2:	68 99 58 80 00       	push   $0x805899
+  8038f7:	e8 bc c8 ff ff       	call   8001b8 <cprintf>
+}
+  8038fc:	83 c4 10             	add    $0x10,%esp
+  8038ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803902:	c9                   	leave
+  803903:	c3                   	ret
+
+00803904 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  803904:	55                   	push   %ebp
+  803905:	89 e5                	mov    %esp,%ebp
+  803907:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  80390a:	e8 5e fe ff ff       	call   80376d <get_paging_stats>
+  80390f:	83 ec 0c             	sub    $0xc,%esp
+  803912:	50                   	push   %eax
+  803913:	e8 ff fe ff ff       	call   803817 <print_paging_stats>
+}
+  803918:	83 c4 10             	add    $0x10,%esp
+  80391b:	c9                   	leave
+  80391c:	c3                   	ret
+
+0080391d <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  80391d:	55                   	push   %ebp
+  80391e:	89 e5                	mov    %esp,%ebp
+  803920:	53                   	push   %ebx
+  803921:	83 ec 04             	sub    $0x4,%esp
+  803924:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803927:	eb 13                	jmp    80393c <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803929:	83 ec 04             	sub    $0x4,%esp
+  80392c:	6a ff                	push   $0xffffffff
+  80392e:	53                   	push   %ebx
+  80392f:	68 00 f0 ff ee       	push   $0xeefff000
+  803934:	e8 32 d8 ff ff       	call   80116b <sys_futex_wait>
+  803939:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  80393c:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  803941:	39 d8                	cmp    %ebx,%eax
+  803943:	74 e4                	je     803929 <mem_pressure_wait+0xc>
+	return now;
+}
+  803945:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803948:	c9                   	leave
+  803949:	c3                   	ret
+
+0080394a <init_map_dir>:
+
+void
+init_map_dir()
+{
+  80394a:	55                   	push   %ebp
+  80394b:	89 e5                	mov    %esp,%ebp
+  80394d:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  803950:	68 bc 45 80 00       	push   $0x8045bc
+  803955:	e8 78 16 00 00       	call   804fd2 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  80395a:	c7 05 14 e9 80 00 00 	movl   $0xdeadb000,0x80e914
+  803961:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  803964:	83 c4 0c             	add    $0xc,%esp
+  803967:	68 07 02 00 00       	push   $0x207
+  80396c:	68 00 b0 ad de       	push   $0xdeadb000
+  803971:	6a 00                	push   $0x0
+  803973:	e8 1a d3 ff ff       	call   800c92 <sys_page_alloc>
+  803978:	83 c4 10             	add    $0x10,%esp
+  80397b:	85 c0                	test   %eax,%eax
+  80397d:	78 0c                	js     80398b <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  80397f:	e8 b4 f3 ff ff       	call   802d38 <find_paging_env>
+	page_ring_ready();
+  803984:	e8 7f f2 ff ff       	call   802c08 <page_ring_ready>
+}
+  803989:	c9                   	leave
+  80398a:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  80398b:	50                   	push   %eax
+  80398c:	68 b9 58 80 00       	push   $0x8058b9
+  803991:	68 13 05 00 00       	push   $0x513
+  803996:	68 72 58 80 00       	push   $0x805872
+  80399b:	e8 5a 15 00 00       	call   804efa <_panic>
+
+008039a0 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  8039a0:	55                   	push   %ebp
+  8039a1:	89 e5                	mov    %esp,%ebp
+  8039a3:	57                   	push   %edi
+  8039a4:	56                   	push   %esi
+  8039a5:	53                   	push   %ebx
+  8039a6:	83 ec 0c             	sub    $0xc,%esp
+  8039a9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  8039ac:	89 fa                	mov    %edi,%edx
+  8039ae:	c1 ea 16             	shr    $0x16,%edx
+  8039b1:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8039b6:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  8039b9:	f6 06 01             	testb  $0x1,(%esi)
+  8039bc:	75 3e                	jne    8039fc <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  8039be:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  8039c3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8039c7:	74 47                	je     803a10 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  8039c9:	83 ec 0c             	sub    $0xc,%esp
+  8039cc:	6a 01                	push   $0x1
+  8039ce:	e8 f2 11 00 00       	call   804bc5 <va_alloc>
+  8039d3:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  8039d5:	83 c4 10             	add    $0x10,%esp
+  8039d8:	85 c0                	test   %eax,%eax
+  8039da:	74 34                	je     803a10 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  8039dc:	6a 00                	push   $0x0
+  8039de:	68 07 02 00 00       	push   $0x207
+  8039e3:	50                   	push   %eax
+  8039e4:	6a 00                	push   $0x0
+  8039e6:	e8 df 02 00 00       	call   803cca <page_alloc>
+  8039eb:	83 c4 10             	add    $0x10,%esp
+  8039ee:	85 c0                	test   %eax,%eax
+  8039f0:	78 28                	js     803a1a <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  8039f2:	f6 06 01             	testb  $0x1,(%esi)
+  8039f5:	75 38                	jne    803a2f <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  8039f7:	83 cb 01             	or     $0x1,%ebx
+  8039fa:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  8039fc:	89 f8                	mov    %edi,%eax
+  8039fe:	c1 e8 0a             	shr    $0xa,%eax
+  803a01:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803a06:	8b 1e                	mov    (%esi),%ebx
+  803a08:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803a0e:	01 c3                	add    %eax,%ebx
+}
+  803a10:	89 d8                	mov    %ebx,%eax
+  803a12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a15:	5b                   	pop    %ebx
+  803a16:	5e                   	pop    %esi
+  803a17:	5f                   	pop    %edi
+  803a18:	5d                   	pop    %ebp
+  803a19:	c3                   	ret
+			va_free(page, 1);
+  803a1a:	83 ec 08             	sub    $0x8,%esp
+  803a1d:	6a 01                	push   $0x1
+  803a1f:	53                   	push   %ebx
+  803a20:	e8 d8 12 00 00       	call   804cfd <va_free>
+			return NULL;
+  803a25:	83 c4 10             	add    $0x10,%esp
+  803a28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a2d:	eb e1                	jmp    803a10 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  803a2f:	83 ec 08             	sub    $0x8,%esp
+  803a32:	53                   	push   %ebx
+  803a33:	6a 00                	push   $0x0
+  803a35:	e8 dd d2 ff ff       	call   800d17 <sys_page_unmap>
+			va_free(page, 1);
+  803a3a:	83 c4 08             	add    $0x8,%esp
+  803a3d:	6a 01                	push   $0x1
+  803a3f:	53                   	push   %ebx
+  803a40:	e8 b8 12 00 00       	call   804cfd <va_free>
+  803a45:	83 c4 10             	add    $0x10,%esp
+  803a48:	eb b2                	jmp    8039fc <umapdir_walk+0x5c>
+
+00803a4a <page_out>:
+{
+  803a4a:	55                   	push   %ebp
+  803a4b:	89 e5                	mov    %esp,%ebp
+  803a4d:	57                   	push   %edi
+  803a4e:	56                   	push   %esi
+  803a4f:	53                   	push   %ebx
+  803a50:	83 ec 5c             	sub    $0x5c,%esp
+  803a53:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803a56:	e8 dd f2 ff ff       	call   802d38 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803a5b:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803a60:	85 c0                	test   %eax,%eax
+  803a62:	74 1e                	je     803a82 <page_out+0x38>
+  803a64:	83 ec 0c             	sub    $0xc,%esp
+  803a67:	6a 00                	push   $0x0
+  803a69:	6a 00                	push   $0x0
+  803a6b:	6a 00                	push   $0x0
+  803a6d:	6a 08                	push   $0x8
+  803a6f:	50                   	push   %eax
+  803a70:	e8 d8 de ff ff       	call   80194d <ipc_call>
+  803a75:	89 c3                	mov    %eax,%ebx
+  803a77:	83 c4 20             	add    $0x20,%esp
+  803a7a:	85 c0                	test   %eax,%eax
+  803a7c:	0f 84 ac 00 00 00    	je     803b2e <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  803a82:	83 ec 08             	sub    $0x8,%esp
+  803a85:	ff 75 0c             	push   0xc(%ebp)
+  803a88:	57                   	push   %edi
+  803a89:	e8 e9 f9 ff ff       	call   803477 <get_page_choice>
+  803a8e:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  803a90:	83 c4 10             	add    $0x10,%esp
+  803a93:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803a98:	0f 84 18 02 00 00    	je     803cb6 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803a9e:	e8 78 ee ff ff       	call   80291b <page_is_clean>
+  803aa3:	84 c0                	test   %al,%al
+  803aa5:	0f 85 8c 00 00 00    	jne    803b37 <page_out+0xed>
+	if (pagingenv == 0)
+  803aab:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803ab2:	0f 84 08 02 00 00    	je     803cc0 <page_out+0x276>
+	if (page_ring_ready())
+  803ab8:	e8 4b f1 ff ff       	call   802c08 <page_ring_ready>
+  803abd:	89 c3                	mov    %eax,%ebx
+  803abf:	85 c0                	test   %eax,%eax
+  803ac1:	0f 85 89 00 00 00    	jne    803b50 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  803ac7:	83 ec 0c             	sub    $0xc,%esp
+  803aca:	6a 05                	push   $0x5
+  803acc:	6a 01                	push   $0x1
+  803ace:	56                   	push   %esi
+  803acf:	6a 01                	push   $0x1
+  803ad1:	ff 35 40 b0 80 00    	push   0x80b040
+  803ad7:	e8 71 de ff ff       	call   80194d <ipc_call>
+  803adc:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803ade:	83 c4 20             	add    $0x20,%esp
+  803ae1:	85 c0                	test   %eax,%eax
+  803ae3:	0f 88 b8 01 00 00    	js     803ca1 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803ae9:	89 f0                	mov    %esi,%eax
+  803aeb:	c1 e8 0c             	shr    $0xc,%eax
+  803aee:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803af5:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803af8:	83 ec 08             	sub    $0x8,%esp
+  803afb:	56                   	push   %esi
+  803afc:	6a 00                	push   $0x0
+  803afe:	e8 14 d2 ff ff       	call   800d17 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803b03:	83 c4 08             	add    $0x8,%esp
+  803b06:	6a 01                	push   $0x1
+  803b08:	56                   	push   %esi
+  803b09:	e8 92 fe ff ff       	call   8039a0 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803b0e:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803b11:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803b17:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803b1a:	09 fe                	or     %edi,%esi
+  803b1c:	83 ce 01             	or     $0x1,%esi
+  803b1f:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803b21:	83 c4 10             	add    $0x10,%esp
+}
+  803b24:	89 d8                	mov    %ebx,%eax
+  803b26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b29:	5b                   	pop    %ebx
+  803b2a:	5e                   	pop    %esi
+  803b2b:	5f                   	pop    %edi
+  803b2c:	5d                   	pop    %ebp
+  803b2d:	c3                   	ret
+		num_page_reclaims++;
+  803b2e:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  803b35:	eb ed                	jmp    803b24 <page_out+0xda>
+		num_page_drops++;
+  803b37:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  803b3e:	83 ec 08             	sub    $0x8,%esp
+  803b41:	56                   	push   %esi
+  803b42:	6a 00                	push   $0x0
+  803b44:	e8 ce d1 ff ff       	call   800d17 <sys_page_unmap>
+  803b49:	89 c3                	mov    %eax,%ebx
+  803b4b:	83 c4 10             	add    $0x10,%esp
+  803b4e:	eb d4                	jmp    803b24 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803b50:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803b52:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803b57:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803b5c:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803b5f:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803b61:	83 c0 08             	add    $0x8,%eax
+  803b64:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803b67:	b8 07 00 00 00       	mov    $0x7,%eax
+  803b6c:	e8 e5 ef ff ff       	call   802b56 <page_ring_reserve>
+	first = ring->sq_tail;
+  803b71:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803b76:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803b79:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803b7e:	83 ec 04             	sub    $0x4,%esp
+  803b81:	68 00 10 00 00       	push   $0x1000
+  803b86:	56                   	push   %esi
+  803b87:	89 d8                	mov    %ebx,%eax
+  803b89:	c1 e0 0c             	shl    $0xc,%eax
+  803b8c:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803b91:	50                   	push   %eax
+  803b92:	e8 f0 cd ff ff       	call   800987 <memcpy>
+		vas[n] = va;
+  803b97:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803b9b:	89 d9                	mov    %ebx,%ecx
+  803b9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ba2:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ba7:	e8 de ee ff ff       	call   802a8a <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803bac:	8d 43 01             	lea    0x1(%ebx),%eax
+  803baf:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803bb2:	83 c4 10             	add    $0x10,%esp
+  803bb5:	83 fb 06             	cmp    $0x6,%ebx
+  803bb8:	74 62                	je     803c1c <page_out+0x1d2>
+  803bba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803bbd:	eb 15                	jmp    803bd4 <page_out+0x18a>
+			num_page_drops++;
+  803bbf:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  803bc6:	83 ec 08             	sub    $0x8,%esp
+  803bc9:	56                   	push   %esi
+  803bca:	6a 00                	push   $0x0
+  803bcc:	e8 46 d1 ff ff       	call   800d17 <sys_page_unmap>
+  803bd1:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803bd4:	83 ec 08             	sub    $0x8,%esp
+  803bd7:	53                   	push   %ebx
+  803bd8:	57                   	push   %edi
+  803bd9:	e8 99 f8 ff ff       	call   803477 <get_page_choice>
+  803bde:	89 c6                	mov    %eax,%esi
+  803be0:	83 c4 10             	add    $0x10,%esp
+  803be3:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803be8:	74 32                	je     803c1c <page_out+0x1d2>
+  803bea:	e8 2c ed ff ff       	call   80291b <page_is_clean>
+  803bef:	84 c0                	test   %al,%al
+  803bf1:	75 cc                	jne    803bbf <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803bf3:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803bf6:	39 c6                	cmp    %eax,%esi
+  803bf8:	72 07                	jb     803c01 <page_out+0x1b7>
+  803bfa:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803bfd:	39 c6                	cmp    %eax,%esi
+  803bff:	72 1b                	jb     803c1c <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803c01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c06:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803c09:	eb 03                	jmp    803c0e <page_out+0x1c4>
+  803c0b:	83 c3 01             	add    $0x1,%ebx
+  803c0e:	39 da                	cmp    %ebx,%edx
+  803c10:	0f 84 68 ff ff ff    	je     803b7e <page_out+0x134>
+  803c16:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803c1a:	75 ef                	jne    803c0b <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803c1c:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803c1f:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803c22:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803c25:	e8 a6 ee ff ff       	call   802ad0 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803c2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c2f:	eb 42                	jmp    803c73 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803c31:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803c35:	89 f8                	mov    %edi,%eax
+  803c37:	c1 e8 0c             	shr    $0xc,%eax
+  803c3a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803c41:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803c44:	83 ec 08             	sub    $0x8,%esp
+  803c47:	57                   	push   %edi
+  803c48:	6a 00                	push   $0x0
+  803c4a:	e8 c8 d0 ff ff       	call   800d17 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803c4f:	83 c4 08             	add    $0x8,%esp
+  803c52:	6a 01                	push   $0x1
+  803c54:	57                   	push   %edi
+  803c55:	e8 46 fd ff ff       	call   8039a0 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803c5a:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803c5d:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803c63:	c1 e6 0c             	shl    $0xc,%esi
+  803c66:	09 d6                	or     %edx,%esi
+  803c68:	83 ce 01             	or     $0x1,%esi
+  803c6b:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803c6d:	83 c3 01             	add    $0x1,%ebx
+  803c70:	83 c4 10             	add    $0x10,%esp
+  803c73:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803c76:	39 c3                	cmp    %eax,%ebx
+  803c78:	74 1d                	je     803c97 <page_out+0x24d>
+		if (res[i] < 0)
+  803c7a:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803c7e:	85 f6                	test   %esi,%esi
+  803c80:	79 af                	jns    803c31 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803c82:	56                   	push   %esi
+  803c83:	68 5c 5b 80 00       	push   $0x805b5c
+  803c88:	68 d1 02 00 00       	push   $0x2d1
+  803c8d:	68 72 58 80 00       	push   $0x805872
+  803c92:	e8 63 12 00 00       	call   804efa <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803c97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c9c:	e9 83 fe ff ff       	jmp    803b24 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803ca1:	50                   	push   %eax
+  803ca2:	68 5c 5b 80 00       	push   $0x805b5c
+  803ca7:	68 0a 03 00 00       	push   $0x30a
+  803cac:	68 72 58 80 00       	push   $0x805872
+  803cb1:	e8 44 12 00 00       	call   804efa <_panic>
+		return -E_NO_MEM;
+  803cb6:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803cbb:	e9 64 fe ff ff       	jmp    803b24 <page_out+0xda>
+		return -E_PAGING;
+  803cc0:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803cc5:	e9 5a fe ff ff       	jmp    803b24 <page_out+0xda>
+
+00803cca <page_alloc>:
+{
+  803cca:	55                   	push   %ebp
+  803ccb:	89 e5                	mov    %esp,%ebp
+  803ccd:	57                   	push   %edi
+  803cce:	56                   	push   %esi
+  803ccf:	53                   	push   %ebx
+  803cd0:	83 ec 0c             	sub    $0xc,%esp
+  803cd3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803cd6:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803cd9:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803ce0:	74 34                	je     803d16 <page_alloc+0x4c>
+	if (check_mte)
+  803ce2:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803ce6:	75 35                	jne    803d1d <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803ce8:	83 ec 04             	sub    $0x4,%esp
+  803ceb:	ff 75 10             	push   0x10(%ebp)
+  803cee:	56                   	push   %esi
+  803cef:	57                   	push   %edi
+  803cf0:	e8 9d cf ff ff       	call   800c92 <sys_page_alloc>
+  803cf5:	89 c3                	mov    %eax,%ebx
+  803cf7:	83 c4 10             	add    $0x10,%esp
+  803cfa:	85 c0                	test   %eax,%eax
+  803cfc:	79 52                	jns    803d50 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803cfe:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803d01:	75 52                	jne    803d55 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803d03:	83 ec 08             	sub    $0x8,%esp
+  803d06:	56                   	push   %esi
+  803d07:	57                   	push   %edi
+  803d08:	e8 3d fd ff ff       	call   803a4a <page_out>
+  803d0d:	83 c4 10             	add    $0x10,%esp
+  803d10:	85 c0                	test   %eax,%eax
+  803d12:	79 d4                	jns    803ce8 <page_alloc+0x1e>
+  803d14:	eb 3f                	jmp    803d55 <page_alloc+0x8b>
+		init_map_dir();
+  803d16:	e8 2f fc ff ff       	call   80394a <init_map_dir>
+  803d1b:	eb c5                	jmp    803ce2 <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803d1d:	83 ec 08             	sub    $0x8,%esp
+  803d20:	6a 00                	push   $0x0
+  803d22:	56                   	push   %esi
+  803d23:	e8 78 fc ff ff       	call   8039a0 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803d28:	83 c4 10             	add    $0x10,%esp
+  803d2b:	85 c0                	test   %eax,%eax
+  803d2d:	74 b9                	je     803ce8 <page_alloc+0x1e>
+  803d2f:	8b 10                	mov    (%eax),%edx
+  803d31:	f6 c2 01             	test   $0x1,%dl
+  803d34:	74 b2                	je     803ce8 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803d36:	83 ec 08             	sub    $0x8,%esp
+  803d39:	56                   	push   %esi
+  803d3a:	52                   	push   %edx
+  803d3b:	50                   	push   %eax
+  803d3c:	68 80 5b 80 00       	push   $0x805b80
+  803d41:	68 34 03 00 00       	push   $0x334
+  803d46:	68 72 58 80 00       	push   $0x805872
+  803d4b:	e8 aa 11 00 00       	call   804efa <_panic>
+	return 0;
+  803d50:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803d55:	89 d8                	mov    %ebx,%eax
+  803d57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d5a:	5b                   	pop    %ebx
+  803d5b:	5e                   	pop    %esi
+  803d5c:	5f                   	pop    %edi
+  803d5d:	5d                   	pop    %ebp
+  803d5e:	c3                   	ret
+
+00803d5f <page_adopt>:
+{
+  803d5f:	55                   	push   %ebp
+  803d60:	89 e5                	mov    %esp,%ebp
+  803d62:	56                   	push   %esi
+  803d63:	53                   	push   %ebx
+  803d64:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803d66:	c1 e8 16             	shr    $0x16,%eax
+  803d69:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803d70:	25 81 00 00 00       	and    $0x81,%eax
+  803d75:	83 f8 01             	cmp    $0x1,%eax
+  803d78:	75 53                	jne    803dcd <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803d7a:	89 d8                	mov    %ebx,%eax
+  803d7c:	c1 e8 0c             	shr    $0xc,%eax
+  803d7f:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803d86:	89 f2                	mov    %esi,%edx
+  803d88:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803d93:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803d99:	75 37                	jne    803dd2 <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803d9b:	83 ec 08             	sub    $0x8,%esp
+  803d9e:	6a 01                	push   $0x1
+  803da0:	53                   	push   %ebx
+  803da1:	e8 fa fb ff ff       	call   8039a0 <umapdir_walk>
+  803da6:	83 c4 10             	add    $0x10,%esp
+  803da9:	85 c0                	test   %eax,%eax
+  803dab:	74 2c                	je     803dd9 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803dad:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803db3:	83 ce 01             	or     $0x1,%esi
+  803db6:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803db8:	83 ec 08             	sub    $0x8,%esp
+  803dbb:	53                   	push   %ebx
+  803dbc:	6a 00                	push   $0x0
+  803dbe:	e8 54 cf ff ff       	call   800d17 <sys_page_unmap>
+	return 1;
+  803dc3:	83 c4 10             	add    $0x10,%esp
+  803dc6:	b8 01 00 00 00       	mov    $0x1,%eax
+  803dcb:	eb 05                	jmp    803dd2 <page_adopt+0x73>
+		return 0;
+  803dcd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dd2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803dd5:	5b                   	pop    %ebx
+  803dd6:	5e                   	pop    %esi
+  803dd7:	5d                   	pop    %ebp
+  803dd8:	c3                   	ret
+		return -E_NO_MEM;
+  803dd9:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803dde:	eb f2                	jmp    803dd2 <page_adopt+0x73>
+
+00803de0 <page_forget>:
+{
+  803de0:	55                   	push   %ebp
+  803de1:	89 e5                	mov    %esp,%ebp
+  803de3:	53                   	push   %ebx
+  803de4:	83 ec 04             	sub    $0x4,%esp
+  803de7:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803de9:	e8 4a ef ff ff       	call   802d38 <find_paging_env>
+	if (pagingenv == 0)
+  803dee:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803df5:	74 39                	je     803e30 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803df7:	89 d8                	mov    %ebx,%eax
+  803df9:	c1 e8 16             	shr    $0x16,%eax
+  803dfc:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803e03:	25 81 00 00 00       	and    $0x81,%eax
+  803e08:	83 f8 01             	cmp    $0x1,%eax
+  803e0b:	74 28                	je     803e35 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803e0d:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803e14:	74 1a                	je     803e30 <page_forget+0x50>
+  803e16:	83 ec 08             	sub    $0x8,%esp
+  803e19:	6a 00                	push   $0x0
+  803e1b:	53                   	push   %ebx
+  803e1c:	e8 7f fb ff ff       	call   8039a0 <umapdir_walk>
+  803e21:	89 c3                	mov    %eax,%ebx
+  803e23:	83 c4 10             	add    $0x10,%esp
+  803e26:	85 c0                	test   %eax,%eax
+  803e28:	74 06                	je     803e30 <page_forget+0x50>
+  803e2a:	8b 00                	mov    (%eax),%eax
+  803e2c:	a8 01                	test   $0x1,%al
+  803e2e:	75 2b                	jne    803e5b <page_forget+0x7b>
+}
+  803e30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e33:	c9                   	leave
+  803e34:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803e35:	89 d8                	mov    %ebx,%eax
+  803e37:	c1 e8 0c             	shr    $0xc,%eax
+  803e3a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803e41:	89 c2                	mov    %eax,%edx
+  803e43:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803e49:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803e4f:	75 bc                	jne    803e0d <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803e51:	c1 e8 0c             	shr    $0xc,%eax
+  803e54:	e8 5c ee ff ff       	call   802cb5 <page_remove_slot>
+		return;
+  803e59:	eb d5                	jmp    803e30 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803e5b:	c1 e8 0c             	shr    $0xc,%eax
+  803e5e:	e8 52 ee ff ff       	call   802cb5 <page_remove_slot>
+	*mte = 0;
+  803e63:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803e69:	eb c5                	jmp    803e30 <page_forget+0x50>
+
+00803e6b <page_unmap>:
+{
+  803e6b:	55                   	push   %ebp
+  803e6c:	89 e5                	mov    %esp,%ebp
+  803e6e:	57                   	push   %edi
+  803e6f:	56                   	push   %esi
+  803e70:	53                   	push   %ebx
+  803e71:	83 ec 0c             	sub    $0xc,%esp
+  803e74:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803e77:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803e7a:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803e7f:	8b 40 48             	mov    0x48(%eax),%eax
+  803e82:	85 db                	test   %ebx,%ebx
+  803e84:	0f 8e b4 00 00 00    	jle    803f3e <page_unmap+0xd3>
+  803e8a:	39 d8                	cmp    %ebx,%eax
+  803e8c:	0f 84 ac 00 00 00    	je     803f3e <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803e92:	83 ec 08             	sub    $0x8,%esp
+  803e95:	57                   	push   %edi
+  803e96:	53                   	push   %ebx
+  803e97:	e8 7b ce ff ff       	call   800d17 <sys_page_unmap>
+  803e9c:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803e9e:	e8 95 ee ff ff       	call   802d38 <find_paging_env>
+	if (pagingenv == 0)
+  803ea3:	83 c4 10             	add    $0x10,%esp
+  803ea6:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803ead:	0f 84 a1 00 00 00    	je     803f54 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803eb3:	83 ec 0c             	sub    $0xc,%esp
+  803eb6:	6a 05                	push   $0x5
+  803eb8:	68 00 00 40 00       	push   $0x400000
+  803ebd:	6a 00                	push   $0x0
+  803ebf:	68 00 b0 ad de       	push   $0xdeadb000
+  803ec4:	53                   	push   %ebx
+  803ec5:	e8 0b ce ff ff       	call   800cd5 <sys_page_map>
+  803eca:	83 c4 20             	add    $0x20,%esp
+  803ecd:	85 c0                	test   %eax,%eax
+  803ecf:	0f 88 89 00 00 00    	js     803f5e <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803ed5:	89 f8                	mov    %edi,%eax
+  803ed7:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803eda:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803ee1:	a8 01                	test   $0x1,%al
+  803ee3:	74 6f                	je     803f54 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803ee5:	83 ec 0c             	sub    $0xc,%esp
+  803ee8:	6a 05                	push   $0x5
+  803eea:	68 00 00 40 00       	push   $0x400000
+  803eef:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803ef1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803ef6:	50                   	push   %eax
+  803ef7:	53                   	push   %ebx
+  803ef8:	e8 d8 cd ff ff       	call   800cd5 <sys_page_map>
+  803efd:	83 c4 20             	add    $0x20,%esp
+  803f00:	85 c0                	test   %eax,%eax
+  803f02:	78 6f                	js     803f73 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803f04:	c1 ef 0c             	shr    $0xc,%edi
+  803f07:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803f0d:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803f14:	01 
+  803f15:	74 3d                	je     803f54 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803f17:	83 ec 08             	sub    $0x8,%esp
+  803f1a:	68 00 00 40 00       	push   $0x400000
+  803f1f:	6a 00                	push   $0x0
+  803f21:	e8 f1 cd ff ff       	call   800d17 <sys_page_unmap>
+  803f26:	83 c4 10             	add    $0x10,%esp
+  803f29:	85 c0                	test   %eax,%eax
+  803f2b:	78 5b                	js     803f88 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803f2d:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803f34:	c1 e8 0c             	shr    $0xc,%eax
+  803f37:	e8 79 ed ff ff       	call   802cb5 <page_remove_slot>
+	return r;
+  803f3c:	eb 16                	jmp    803f54 <page_unmap+0xe9>
+		page_forget(va);
+  803f3e:	89 f8                	mov    %edi,%eax
+  803f40:	e8 9b fe ff ff       	call   803de0 <page_forget>
+		return sys_page_unmap(envid, va);
+  803f45:	83 ec 08             	sub    $0x8,%esp
+  803f48:	57                   	push   %edi
+  803f49:	53                   	push   %ebx
+  803f4a:	e8 c8 cd ff ff       	call   800d17 <sys_page_unmap>
+  803f4f:	89 c6                	mov    %eax,%esi
+  803f51:	83 c4 10             	add    $0x10,%esp
+}
+  803f54:	89 f0                	mov    %esi,%eax
+  803f56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f59:	5b                   	pop    %ebx
+  803f5a:	5e                   	pop    %esi
+  803f5b:	5f                   	pop    %edi
+  803f5c:	5d                   	pop    %ebp
+  803f5d:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803f5e:	50                   	push   %eax
+  803f5f:	68 bc 5b 80 00       	push   $0x805bbc
+  803f64:	68 e4 03 00 00       	push   $0x3e4
+  803f69:	68 72 58 80 00       	push   $0x805872
+  803f6e:	e8 87 0f 00 00       	call   804efa <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803f73:	50                   	push   %eax
+  803f74:	68 e8 5b 80 00       	push   $0x805be8
+  803f79:	68 ea 03 00 00       	push   $0x3ea
+  803f7e:	68 72 58 80 00       	push   $0x805872
+  803f83:	e8 72 0f 00 00       	call   804efa <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803f88:	50                   	push   %eax
+  803f89:	68 14 5c 80 00       	push   $0x805c14
+  803f8e:	68 ef 03 00 00       	push   $0x3ef
+  803f93:	68 72 58 80 00       	push   $0x805872
+  803f98:	e8 5d 0f 00 00       	call   804efa <_panic>
+
+00803f9d <page_unmap_range>:
+{
+  803f9d:	55                   	push   %ebp
+  803f9e:	89 e5                	mov    %esp,%ebp
+  803fa0:	57                   	push   %edi
+  803fa1:	56                   	push   %esi
+  803fa2:	53                   	push   %ebx
+  803fa3:	83 ec 0c             	sub    $0xc,%esp
+  803fa6:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803fa9:	e8 8a ed ff ff       	call   802d38 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803fae:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803fb3:	8b 40 48             	mov    0x48(%eax),%eax
+  803fb6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803fba:	7e 38                	jle    803ff4 <page_unmap_range+0x57>
+  803fbc:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803fbf:	74 33                	je     803ff4 <page_unmap_range+0x57>
+  803fc1:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803fc8:	74 2a                	je     803ff4 <page_unmap_range+0x57>
+  803fca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  803fcd:	be 00 00 00 00       	mov    $0x0,%esi
+  803fd2:	39 fe                	cmp    %edi,%esi
+  803fd4:	74 56                	je     80402c <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  803fd6:	83 ec 08             	sub    $0x8,%esp
+  803fd9:	53                   	push   %ebx
+  803fda:	ff 75 08             	push   0x8(%ebp)
+  803fdd:	e8 89 fe ff ff       	call   803e6b <page_unmap>
+  803fe2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803fe8:	83 c4 10             	add    $0x10,%esp
+  803feb:	85 c0                	test   %eax,%eax
+  803fed:	78 35                	js     804024 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  803fef:	83 c6 01             	add    $0x1,%esi
+  803ff2:	eb de                	jmp    803fd2 <page_unmap_range+0x35>
+  803ff4:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803ff7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ffc:	eb 10                	jmp    80400e <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803ffe:	89 f0                	mov    %esi,%eax
+  804000:	e8 db fd ff ff       	call   803de0 <page_forget>
+		for (i = 0; i < npages; i++)
+  804005:	83 c3 01             	add    $0x1,%ebx
+  804008:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80400e:	39 fb                	cmp    %edi,%ebx
+  804010:	75 ec                	jne    803ffe <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  804012:	83 ec 04             	sub    $0x4,%esp
+  804015:	57                   	push   %edi
+  804016:	ff 75 0c             	push   0xc(%ebp)
+  804019:	ff 75 08             	push   0x8(%ebp)
+  80401c:	e8 0a ce ff ff       	call   800e2b <sys_page_unmap_range>
+  804021:	83 c4 10             	add    $0x10,%esp
+}
+  804024:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804027:	5b                   	pop    %ebx
+  804028:	5e                   	pop    %esi
+  804029:	5f                   	pop    %edi
+  80402a:	5d                   	pop    %ebp
+  80402b:	c3                   	ret
+	return 0;
+  80402c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804031:	eb f1                	jmp    804024 <page_unmap_range+0x87>
+
+00804033 <page_alloc_range>:
+{
+  804033:	55                   	push   %ebp
+  804034:	89 e5                	mov    %esp,%ebp
+  804036:	57                   	push   %edi
+  804037:	56                   	push   %esi
+  804038:	53                   	push   %ebx
+  804039:	83 ec 1c             	sub    $0x1c,%esp
+  80403c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80403f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  804042:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  804049:	74 14                	je     80405f <page_alloc_range+0x2c>
+	if (check_mte)
+  80404b:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80404f:	74 66                	je     8040b7 <page_alloc_range+0x84>
+  804051:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  804053:	b8 00 00 00 00       	mov    $0x0,%eax
+  804058:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  80405b:	89 c7                	mov    %eax,%edi
+  80405d:	eb 10                	jmp    80406f <page_alloc_range+0x3c>
+		init_map_dir();
+  80405f:	e8 e6 f8 ff ff       	call   80394a <init_map_dir>
+  804064:	eb e5                	jmp    80404b <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  804066:	83 c7 01             	add    $0x1,%edi
+  804069:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80406f:	39 df                	cmp    %ebx,%edi
+  804071:	74 38                	je     8040ab <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  804073:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804076:	83 ec 08             	sub    $0x8,%esp
+  804079:	6a 00                	push   $0x0
+  80407b:	56                   	push   %esi
+  80407c:	e8 1f f9 ff ff       	call   8039a0 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  804081:	83 c4 10             	add    $0x10,%esp
+  804084:	85 c0                	test   %eax,%eax
+  804086:	74 de                	je     804066 <page_alloc_range+0x33>
+  804088:	8b 10                	mov    (%eax),%edx
+  80408a:	f6 c2 01             	test   $0x1,%dl
+  80408d:	74 d7                	je     804066 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  80408f:	83 ec 08             	sub    $0x8,%esp
+  804092:	ff 75 e4             	push   -0x1c(%ebp)
+  804095:	52                   	push   %edx
+  804096:	50                   	push   %eax
+  804097:	68 80 5b 80 00       	push   $0x805b80
+  80409c:	68 0b 04 00 00       	push   $0x40b
+  8040a1:	68 72 58 80 00       	push   $0x805872
+  8040a6:	e8 4f 0e 00 00       	call   804efa <_panic>
+  8040ab:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8040ae:	eb 07                	jmp    8040b7 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  8040b0:	c1 e0 0c             	shl    $0xc,%eax
+  8040b3:	01 c7                	add    %eax,%edi
+			npages -= r;
+  8040b5:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  8040b7:	85 db                	test   %ebx,%ebx
+  8040b9:	74 30                	je     8040eb <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  8040bb:	ff 75 14             	push   0x14(%ebp)
+  8040be:	53                   	push   %ebx
+  8040bf:	57                   	push   %edi
+  8040c0:	ff 75 08             	push   0x8(%ebp)
+  8040c3:	e8 f5 cc ff ff       	call   800dbd <sys_page_alloc_range>
+  8040c8:	89 c6                	mov    %eax,%esi
+  8040ca:	83 c4 10             	add    $0x10,%esp
+  8040cd:	85 c0                	test   %eax,%eax
+  8040cf:	7f df                	jg     8040b0 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  8040d1:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8040d4:	75 1a                	jne    8040f0 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  8040d6:	83 ec 08             	sub    $0x8,%esp
+  8040d9:	57                   	push   %edi
+  8040da:	ff 75 08             	push   0x8(%ebp)
+  8040dd:	e8 68 f9 ff ff       	call   803a4a <page_out>
+  8040e2:	83 c4 10             	add    $0x10,%esp
+  8040e5:	85 c0                	test   %eax,%eax
+  8040e7:	79 ce                	jns    8040b7 <page_alloc_range+0x84>
+  8040e9:	eb 05                	jmp    8040f0 <page_alloc_range+0xbd>
+	return 0;
+  8040eb:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8040f0:	89 f0                	mov    %esi,%eax
+  8040f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040f5:	5b                   	pop    %ebx
+  8040f6:	5e                   	pop    %esi
+  8040f7:	5f                   	pop    %edi
+  8040f8:	5d                   	pop    %ebp
+  8040f9:	c3                   	ret
+
+008040fa <page_in>:
+{
+  8040fa:	55                   	push   %ebp
+  8040fb:	89 e5                	mov    %esp,%ebp
+  8040fd:	57                   	push   %edi
+  8040fe:	56                   	push   %esi
+  8040ff:	53                   	push   %ebx
+  804100:	83 ec 3c             	sub    $0x3c,%esp
+  804103:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  804106:	e8 2d ec ff ff       	call   802d38 <find_paging_env>
+	if (pagingenv == 0)
+  80410b:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  804112:	0f 84 09 02 00 00    	je     804321 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  804118:	83 ec 08             	sub    $0x8,%esp
+  80411b:	6a 00                	push   $0x0
+  80411d:	56                   	push   %esi
+  80411e:	e8 7d f8 ff ff       	call   8039a0 <umapdir_walk>
+  804123:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  804125:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80412b:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  80412e:	83 c4 10             	add    $0x10,%esp
+  804131:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804135:	74 0d                	je     804144 <page_in+0x4a>
+  804137:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80413c:	8b 40 48             	mov    0x48(%eax),%eax
+  80413f:	3b 45 08             	cmp    0x8(%ebp),%eax
+  804142:	75 06                	jne    80414a <page_in+0x50>
+  804144:	8b 03                	mov    (%ebx),%eax
+  804146:	a8 02                	test   $0x2,%al
+  804148:	75 63                	jne    8041ad <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  80414a:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  80414c:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  80414e:	89 f0                	mov    %esi,%eax
+  804150:	25 06 0e 00 00       	and    $0xe06,%eax
+  804155:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  804158:	50                   	push   %eax
+  804159:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  80415c:	57                   	push   %edi
+  80415d:	ff 75 08             	push   0x8(%ebp)
+  804160:	e8 65 fb ff ff       	call   803cca <page_alloc>
+  804165:	83 c4 10             	add    $0x10,%esp
+  804168:	85 c0                	test   %eax,%eax
+  80416a:	78 39                	js     8041a5 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  80416c:	89 f0                	mov    %esi,%eax
+  80416e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  804171:	83 ec 0c             	sub    $0xc,%esp
+  804174:	6a 07                	push   $0x7
+  804176:	6a 01                	push   $0x1
+  804178:	57                   	push   %edi
+  804179:	c1 e0 04             	shl    $0x4,%eax
+  80417c:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  80417d:	c1 ee 1c             	shr    $0x1c,%esi
+  804180:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  804183:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  80418a:	e8 be d7 ff ff       	call   80194d <ipc_call>
+  80418f:	83 c4 20             	add    $0x20,%esp
+  804192:	85 c0                	test   %eax,%eax
+  804194:	0f 88 72 01 00 00    	js     80430c <page_in+0x212>
+	*mte = 0;
+  80419a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  8041a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041a8:	5b                   	pop    %ebx
+  8041a9:	5e                   	pop    %esi
+  8041aa:	5f                   	pop    %edi
+  8041ab:	5d                   	pop    %ebp
+  8041ac:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  8041ad:	25 06 0e 00 00       	and    $0xe06,%eax
+  8041b2:	83 c8 01             	or     $0x1,%eax
+  8041b5:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  8041b8:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  8041bb:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8041be:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  8041c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8041c9:	eb 46                	jmp    804211 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  8041cb:	83 ec 08             	sub    $0x8,%esp
+  8041ce:	6a 00                	push   $0x0
+  8041d0:	51                   	push   %ecx
+  8041d1:	e8 ca f7 ff ff       	call   8039a0 <umapdir_walk>
+  8041d6:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  8041da:	83 c4 10             	add    $0x10,%esp
+  8041dd:	85 c0                	test   %eax,%eax
+  8041df:	74 66                	je     804247 <page_in+0x14d>
+  8041e1:	8b 00                	mov    (%eax),%eax
+  8041e3:	a8 01                	test   $0x1,%al
+  8041e5:	74 60                	je     804247 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  8041e7:	89 c2                	mov    %eax,%edx
+  8041e9:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  8041ef:	83 ca 01             	or     $0x1,%edx
+  8041f2:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  8041f5:	75 50                	jne    804247 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  8041f7:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8041fd:	c1 e8 1c             	shr    $0x1c,%eax
+  804200:	8b 13                	mov    (%ebx),%edx
+  804202:	c1 ea 1c             	shr    $0x1c,%edx
+  804205:	39 d0                	cmp    %edx,%eax
+  804207:	75 3e                	jne    804247 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804209:	83 c6 01             	add    $0x1,%esi
+  80420c:	83 fe 08             	cmp    $0x8,%esi
+  80420f:	74 3f                	je     804250 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  804211:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  804213:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  804219:	77 2c                	ja     804247 <page_in+0x14d>
+  80421b:	89 f8                	mov    %edi,%eax
+  80421d:	c1 e8 16             	shr    $0x16,%eax
+  804220:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  804227:	f6 c2 01             	test   $0x1,%dl
+  80422a:	74 9f                	je     8041cb <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  80422c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  804233:	a8 80                	test   $0x80,%al
+  804235:	75 10                	jne    804247 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804237:	89 f8                	mov    %edi,%eax
+  804239:	c1 e8 0c             	shr    $0xc,%eax
+  80423c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804243:	a8 01                	test   $0x1,%al
+  804245:	74 84                	je     8041cb <page_in+0xd1>
+	if (n == 1)
+  804247:	83 fe 01             	cmp    $0x1,%esi
+  80424a:	0f 84 fa fe ff ff    	je     80414a <page_in+0x50>
+	req.nslots = n;
+  804250:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  804256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80425b:	eb 13                	jmp    804270 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  80425d:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  804261:	8b 12                	mov    (%edx),%edx
+  804263:	c1 ea 0c             	shr    $0xc,%edx
+  804266:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  80426d:	83 c0 01             	add    $0x1,%eax
+  804270:	39 c6                	cmp    %eax,%esi
+  804272:	75 e9                	jne    80425d <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  804274:	83 ec 0c             	sub    $0xc,%esp
+  804277:	6a 00                	push   $0x0
+  804279:	ff 75 c0             	push   -0x40(%ebp)
+  80427c:	56                   	push   %esi
+  80427d:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804280:	57                   	push   %edi
+  804281:	6a 00                	push   $0x0
+  804283:	e8 ab fd ff ff       	call   804033 <page_alloc_range>
+  804288:	83 c4 20             	add    $0x20,%esp
+  80428b:	85 c0                	test   %eax,%eax
+  80428d:	78 6e                	js     8042fd <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  80428f:	83 ec 04             	sub    $0x4,%esp
+  804292:	6a 24                	push   $0x24
+  804294:	68 00 80 80 00       	push   $0x808000
+  804299:	57                   	push   %edi
+  80429a:	e8 86 c6 ff ff       	call   800925 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  80429f:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8042a6:	56                   	push   %esi
+  8042a7:	57                   	push   %edi
+  8042a8:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8042aa:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  8042b1:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  8042b4:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  8042bb:	e8 8d d6 ff ff       	call   80194d <ipc_call>
+  8042c0:	83 c4 20             	add    $0x20,%esp
+  8042c3:	85 c0                	test   %eax,%eax
+  8042c5:	78 08                	js     8042cf <page_in+0x1d5>
+  8042c7:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8042ca:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  8042cd:	eb 20                	jmp    8042ef <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  8042cf:	50                   	push   %eax
+  8042d0:	68 40 5c 80 00       	push   $0x805c40
+  8042d5:	68 59 02 00 00       	push   $0x259
+  8042da:	68 72 58 80 00       	push   $0x805872
+  8042df:	e8 16 0c 00 00       	call   804efa <_panic>
+		*mtes[i] = 0;
+  8042e4:	8b 10                	mov    (%eax),%edx
+  8042e6:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  8042ec:	83 c0 04             	add    $0x4,%eax
+  8042ef:	39 c8                	cmp    %ecx,%eax
+  8042f1:	75 f1                	jne    8042e4 <page_in+0x1ea>
+	return n;
+  8042f3:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  8042f5:	85 f6                	test   %esi,%esi
+  8042f7:	0f 84 4d fe ff ff    	je     80414a <page_in+0x50>
+		return r < 0 ? r : 0;
+  8042fd:	85 c0                	test   %eax,%eax
+  8042ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  804304:	0f 4f c2             	cmovg  %edx,%eax
+  804307:	e9 99 fe ff ff       	jmp    8041a5 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  80430c:	50                   	push   %eax
+  80430d:	68 78 5c 80 00       	push   $0x805c78
+  804312:	68 9a 02 00 00       	push   $0x29a
+  804317:	68 72 58 80 00       	push   $0x805872
+  80431c:	e8 d9 0b 00 00       	call   804efa <_panic>
+		return -E_PAGING;
+  804321:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804326:	e9 7a fe ff ff       	jmp    8041a5 <page_in+0xab>
+
+0080432b <page_map>:
+{
+  80432b:	55                   	push   %ebp
+  80432c:	89 e5                	mov    %esp,%ebp
+  80432e:	57                   	push   %edi
+  80432f:	56                   	push   %esi
+  804330:	53                   	push   %ebx
+  804331:	83 ec 1c             	sub    $0x1c,%esp
+  804334:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  804337:	83 ec 0c             	sub    $0xc,%esp
+  80433a:	ff 75 18             	push   0x18(%ebp)
+  80433d:	ff 75 14             	push   0x14(%ebp)
+  804340:	ff 75 10             	push   0x10(%ebp)
+  804343:	ff 75 0c             	push   0xc(%ebp)
+  804346:	56                   	push   %esi
+  804347:	e8 89 c9 ff ff       	call   800cd5 <sys_page_map>
+  80434c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80434f:	83 c4 20             	add    $0x20,%esp
+  804352:	85 c0                	test   %eax,%eax
+  804354:	0f 89 a9 01 00 00    	jns    804503 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  80435a:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  80435e:	74 5f                	je     8043bf <page_map+0x94>
+		if (r != -E_INVAL)
+  804360:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  804364:	0f 85 a0 01 00 00    	jne    80450a <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  80436a:	85 f6                	test   %esi,%esi
+  80436c:	74 70                	je     8043de <page_map+0xb3>
+  80436e:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804373:	8b 40 48             	mov    0x48(%eax),%eax
+  804376:	39 f0                	cmp    %esi,%eax
+  804378:	74 64                	je     8043de <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80437a:	83 ec 0c             	sub    $0xc,%esp
+  80437d:	6a 05                	push   $0x5
+  80437f:	68 00 00 40 00       	push   $0x400000
+  804384:	6a 00                	push   $0x0
+  804386:	68 00 b0 ad de       	push   $0xdeadb000
+  80438b:	56                   	push   %esi
+  80438c:	e8 44 c9 ff ff       	call   800cd5 <sys_page_map>
+  804391:	89 c3                	mov    %eax,%ebx
+  804393:	83 c4 20             	add    $0x20,%esp
+  804396:	85 c0                	test   %eax,%eax
+  804398:	79 6a                	jns    804404 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  80439a:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80439d:	75 50                	jne    8043ef <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  80439f:	83 ec 08             	sub    $0x8,%esp
+  8043a2:	68 00 00 40 00       	push   $0x400000
+  8043a7:	6a fc                	push   $0xfffffffc
+  8043a9:	e8 9c f6 ff ff       	call   803a4a <page_out>
+  8043ae:	83 c4 10             	add    $0x10,%esp
+  8043b1:	85 c0                	test   %eax,%eax
+  8043b3:	79 c5                	jns    80437a <page_map+0x4f>
+}
+  8043b5:	89 d8                	mov    %ebx,%eax
+  8043b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043ba:	5b                   	pop    %ebx
+  8043bb:	5e                   	pop    %esi
+  8043bc:	5f                   	pop    %edi
+  8043bd:	5d                   	pop    %ebp
+  8043be:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  8043bf:	83 ec 08             	sub    $0x8,%esp
+  8043c2:	68 00 00 40 00       	push   $0x400000
+  8043c7:	6a 00                	push   $0x0
+  8043c9:	e8 7c f6 ff ff       	call   803a4a <page_out>
+  8043ce:	83 c4 10             	add    $0x10,%esp
+  8043d1:	85 c0                	test   %eax,%eax
+  8043d3:	0f 89 5e ff ff ff    	jns    804337 <page_map+0xc>
+				return r;
+  8043d9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8043dc:	eb d7                	jmp    8043b5 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8043de:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8043e1:	e8 79 f9 ff ff       	call   803d5f <page_adopt>
+  8043e6:	85 c0                	test   %eax,%eax
+  8043e8:	79 90                	jns    80437a <page_map+0x4f>
+			return r;
+  8043ea:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8043ed:	eb c6                	jmp    8043b5 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  8043ef:	53                   	push   %ebx
+  8043f0:	68 ac 5c 80 00       	push   $0x805cac
+  8043f5:	68 77 03 00 00       	push   $0x377
+  8043fa:	68 72 58 80 00       	push   $0x805872
+  8043ff:	e8 f6 0a 00 00       	call   804efa <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  804404:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804407:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  80440a:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  804411:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  804417:	0f 84 f5 00 00 00    	je     804512 <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  80441d:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804423:	83 ec 0c             	sub    $0xc,%esp
+  804426:	6a 05                	push   $0x5
+  804428:	68 00 00 40 00       	push   $0x400000
+  80442d:	6a 00                	push   $0x0
+  80442f:	57                   	push   %edi
+  804430:	56                   	push   %esi
+  804431:	e8 9f c8 ff ff       	call   800cd5 <sys_page_map>
+  804436:	89 c3                	mov    %eax,%ebx
+  804438:	83 c4 20             	add    $0x20,%esp
+  80443b:	85 c0                	test   %eax,%eax
+  80443d:	79 35                	jns    804474 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  80443f:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804442:	75 1b                	jne    80445f <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  804444:	83 ec 08             	sub    $0x8,%esp
+  804447:	68 00 00 40 00       	push   $0x400000
+  80444c:	6a 00                	push   $0x0
+  80444e:	e8 f7 f5 ff ff       	call   803a4a <page_out>
+  804453:	83 c4 10             	add    $0x10,%esp
+  804456:	85 c0                	test   %eax,%eax
+  804458:	79 c9                	jns    804423 <page_map+0xf8>
+  80445a:	e9 56 ff ff ff       	jmp    8043b5 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  80445f:	53                   	push   %ebx
+  804460:	68 d4 5c 80 00       	push   $0x805cd4
+  804465:	68 83 03 00 00       	push   $0x383
+  80446a:	68 72 58 80 00       	push   $0x805872
+  80446f:	e8 86 0a 00 00       	call   804efa <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  804474:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804477:	c1 e8 0c             	shr    $0xc,%eax
+  80447a:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  80447f:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  804486:	01 
+  804487:	0f 84 8d 00 00 00    	je     80451a <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  80448d:	83 ec 08             	sub    $0x8,%esp
+  804490:	68 00 00 40 00       	push   $0x400000
+  804495:	6a 00                	push   $0x0
+  804497:	e8 7b c8 ff ff       	call   800d17 <sys_page_unmap>
+  80449c:	83 c4 10             	add    $0x10,%esp
+  80449f:	85 c0                	test   %eax,%eax
+  8044a1:	78 36                	js     8044d9 <page_map+0x1ae>
+  8044a3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  8044a6:	83 ec 08             	sub    $0x8,%esp
+  8044a9:	57                   	push   %edi
+  8044aa:	56                   	push   %esi
+  8044ab:	e8 4a fc ff ff       	call   8040fa <page_in>
+  8044b0:	89 c3                	mov    %eax,%ebx
+  8044b2:	83 c4 10             	add    $0x10,%esp
+  8044b5:	85 c0                	test   %eax,%eax
+  8044b7:	0f 89 7a fe ff ff    	jns    804337 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  8044bd:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8044c0:	75 2c                	jne    8044ee <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  8044c2:	83 ec 08             	sub    $0x8,%esp
+  8044c5:	57                   	push   %edi
+  8044c6:	6a 00                	push   $0x0
+  8044c8:	e8 7d f5 ff ff       	call   803a4a <page_out>
+  8044cd:	83 c4 10             	add    $0x10,%esp
+  8044d0:	85 c0                	test   %eax,%eax
+  8044d2:	79 d2                	jns    8044a6 <page_map+0x17b>
+  8044d4:	e9 dc fe ff ff       	jmp    8043b5 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  8044d9:	50                   	push   %eax
+  8044da:	68 00 5d 80 00       	push   $0x805d00
+  8044df:	68 8b 03 00 00       	push   $0x38b
+  8044e4:	68 72 58 80 00       	push   $0x805872
+  8044e9:	e8 0c 0a 00 00       	call   804efa <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  8044ee:	53                   	push   %ebx
+  8044ef:	68 28 5d 80 00       	push   $0x805d28
+  8044f4:	68 91 03 00 00       	push   $0x391
+  8044f9:	68 72 58 80 00       	push   $0x805872
+  8044fe:	e8 f7 09 00 00       	call   804efa <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  804503:	89 c3                	mov    %eax,%ebx
+  804505:	e9 ab fe ff ff       	jmp    8043b5 <page_map+0x8a>
+  80450a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80450d:	e9 a3 fe ff ff       	jmp    8043b5 <page_map+0x8a>
+			return r; // Pass through the error
+  804512:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804515:	e9 9b fe ff ff       	jmp    8043b5 <page_map+0x8a>
+			return r; // Pass through the error
+  80451a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80451d:	e9 93 fe ff ff       	jmp    8043b5 <page_map+0x8a>
+
+00804522 <page_map_range>:
+{
+  804522:	55                   	push   %ebp
+  804523:	89 e5                	mov    %esp,%ebp
+  804525:	57                   	push   %edi
+  804526:	56                   	push   %esi
+  804527:	53                   	push   %ebx
+  804528:	83 ec 0c             	sub    $0xc,%esp
+  80452b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80452e:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  804531:	83 ec 08             	sub    $0x8,%esp
+  804534:	ff 75 1c             	push   0x1c(%ebp)
+  804537:	ff 75 18             	push   0x18(%ebp)
+  80453a:	56                   	push   %esi
+  80453b:	ff 75 10             	push   0x10(%ebp)
+  80453e:	57                   	push   %edi
+  80453f:	ff 75 08             	push   0x8(%ebp)
+  804542:	e8 99 c8 ff ff       	call   800de0 <sys_page_map_range>
+  804547:	89 c3                	mov    %eax,%ebx
+  804549:	83 c4 20             	add    $0x20,%esp
+  80454c:	85 c0                	test   %eax,%eax
+  80454e:	79 1b                	jns    80456b <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  804550:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804553:	75 20                	jne    804575 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  804555:	83 ec 08             	sub    $0x8,%esp
+  804558:	68 00 00 40 00       	push   $0x400000
+  80455d:	6a 00                	push   $0x0
+  80455f:	e8 e6 f4 ff ff       	call   803a4a <page_out>
+  804564:	83 c4 10             	add    $0x10,%esp
+  804567:	85 c0                	test   %eax,%eax
+  804569:	79 c6                	jns    804531 <page_map_range+0xf>
+}
+  80456b:	89 d8                	mov    %ebx,%eax
+  80456d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804570:	5b                   	pop    %ebx
+  804571:	5e                   	pop    %esi
+  804572:	5f                   	pop    %edi
+  804573:	5d                   	pop    %ebp
+  804574:	c3                   	ret
+		if (r != -E_INVAL)
+  804575:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  804578:	75 f1                	jne    80456b <page_map_range+0x49>
+  80457a:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  80457c:	be 00 00 00 00       	mov    $0x0,%esi
+  804581:	eb 03                	jmp    804586 <page_map_range+0x64>
+  804583:	83 c6 01             	add    $0x1,%esi
+  804586:	3b 75 18             	cmp    0x18(%ebp),%esi
+  804589:	74 2a                	je     8045b5 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  80458b:	83 ec 0c             	sub    $0xc,%esp
+  80458e:	ff 75 1c             	push   0x1c(%ebp)
+  804591:	53                   	push   %ebx
+  804592:	ff 75 10             	push   0x10(%ebp)
+  804595:	57                   	push   %edi
+  804596:	ff 75 08             	push   0x8(%ebp)
+  804599:	e8 8d fd ff ff       	call   80432b <page_map>
+  80459e:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8045a4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8045aa:	83 c4 20             	add    $0x20,%esp
+  8045ad:	85 c0                	test   %eax,%eax
+  8045af:	79 d2                	jns    804583 <page_map_range+0x61>
+  8045b1:	89 c3                	mov    %eax,%ebx
+  8045b3:	eb b6                	jmp    80456b <page_map_range+0x49>
+		return 0;
+  8045b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8045ba:	eb af                	jmp    80456b <page_map_range+0x49>
+
+008045bc <paging_pgfault_handler>:
+{
+  8045bc:	55                   	push   %ebp
+  8045bd:	89 e5                	mov    %esp,%ebp
+  8045bf:	56                   	push   %esi
+  8045c0:	53                   	push   %ebx
+  8045c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  8045c4:	e8 6f e7 ff ff       	call   802d38 <find_paging_env>
+	if (pagingenv == 0)
+  8045c9:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  8045ce:	85 c0                	test   %eax,%eax
+  8045d0:	74 3c                	je     80460e <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  8045d2:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  8045d4:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8045d8:	75 12                	jne    8045ec <paging_pgfault_handler+0x30>
+  8045da:	89 f0                	mov    %esi,%eax
+  8045dc:	e8 7e f7 ff ff       	call   803d5f <page_adopt>
+  8045e1:	89 c2                	mov    %eax,%edx
+		return 0;
+  8045e3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  8045e8:	85 d2                	test   %edx,%edx
+  8045ea:	78 22                	js     80460e <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  8045ec:	83 ec 08             	sub    $0x8,%esp
+  8045ef:	6a 00                	push   $0x0
+  8045f1:	56                   	push   %esi
+  8045f2:	e8 a9 f3 ff ff       	call   8039a0 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  8045f7:	83 c4 10             	add    $0x10,%esp
+  8045fa:	85 c0                	test   %eax,%eax
+  8045fc:	74 05                	je     804603 <paging_pgfault_handler+0x47>
+  8045fe:	f6 00 01             	testb  $0x1,(%eax)
+  804601:	75 12                	jne    804615 <paging_pgfault_handler+0x59>
+	return 0;
+  804603:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804608:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80460c:	74 23                	je     804631 <paging_pgfault_handler+0x75>
+}
+  80460e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804611:	5b                   	pop    %ebx
+  804612:	5e                   	pop    %esi
+  804613:	5d                   	pop    %ebp
+  804614:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  804615:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80461a:	8b 40 48             	mov    0x48(%eax),%eax
+  80461d:	83 ec 08             	sub    $0x8,%esp
+  804620:	56                   	push   %esi
+  804621:	50                   	push   %eax
+  804622:	e8 d3 fa ff ff       	call   8040fa <page_in>
+  804627:	f7 d0                	not    %eax
+  804629:	c1 e8 1f             	shr    $0x1f,%eax
+  80462c:	83 c4 10             	add    $0x10,%esp
+  80462f:	eb dd                	jmp    80460e <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804631:	89 f0                	mov    %esi,%eax
+  804633:	e8 97 e2 ff ff       	call   8028cf <segment_lookup>
+  804638:	89 c2                	mov    %eax,%edx
+	return 0;
+  80463a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  80463f:	85 d2                	test   %edx,%edx
+  804641:	74 cb                	je     80460e <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  804643:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804648:	8b 40 48             	mov    0x48(%eax),%eax
+  80464b:	83 ec 08             	sub    $0x8,%esp
+  80464e:	56                   	push   %esi
+  80464f:	50                   	push   %eax
+  804650:	e8 f5 f3 ff ff       	call   803a4a <page_out>
+  804655:	f7 d0                	not    %eax
+  804657:	c1 e8 1f             	shr    $0x1f,%eax
+  80465a:	83 c4 10             	add    $0x10,%esp
+  80465d:	eb af                	jmp    80460e <paging_pgfault_handler+0x52>
+
+0080465f <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  80465f:	55                   	push   %ebp
+  804660:	89 e5                	mov    %esp,%ebp
+  804662:	57                   	push   %edi
+  804663:	56                   	push   %esi
+  804664:	53                   	push   %ebx
+  804665:	83 ec 2c             	sub    $0x2c,%esp
+  804668:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  80466b:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  804670:	89 c1                	mov    %eax,%ecx
+  804672:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  804675:	c1 e8 11             	shr    $0x11,%eax
+  804678:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80467b:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  804682:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  804685:	b8 01 00 00 00       	mov    $0x1,%eax
+  80468a:	d3 e0                	shl    %cl,%eax
+  80468c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80468f:	85 c7                	test   %eax,%edi
+  804691:	74 12                	je     8046a5 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804693:	bb 01 00 00 00       	mov    $0x1,%ebx
+  804698:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  80469b:	bf 01 00 00 00       	mov    $0x1,%edi
+  8046a0:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8046a3:	eb 17                	jmp    8046bc <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  8046a5:	ff 75 e0             	push   -0x20(%ebp)
+  8046a8:	68 60 5d 80 00       	push   $0x805d60
+  8046ad:	6a 48                	push   $0x48
+  8046af:	68 7a 5d 80 00       	push   $0x805d7a
+  8046b4:	e8 41 08 00 00       	call   804efa <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  8046b9:	83 c3 01             	add    $0x1,%ebx
+  8046bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8046bf:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  8046c2:	89 c8                	mov    %ecx,%eax
+  8046c4:	c1 e8 05             	shr    $0x5,%eax
+  8046c7:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  8046ce:	89 fe                	mov    %edi,%esi
+  8046d0:	d3 e6                	shl    %cl,%esi
+  8046d2:	89 f1                	mov    %esi,%ecx
+  8046d4:	85 d6                	test   %edx,%esi
+  8046d6:	74 e1                	je     8046b9 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  8046d8:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  8046db:	f7 d6                	not    %esi
+  8046dd:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8046e0:	21 fe                	and    %edi,%esi
+  8046e2:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8046e5:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  8046ec:	f7 d1                	not    %ecx
+  8046ee:	21 d1                	and    %edx,%ecx
+  8046f0:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  8046f7:	83 ec 04             	sub    $0x4,%esp
+  8046fa:	53                   	push   %ebx
+  8046fb:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8046fe:	57                   	push   %edi
+  8046ff:	6a 00                	push   $0x0
+  804701:	e8 97 f8 ff ff       	call   803f9d <page_unmap_range>
+	va_free(va, n);
+  804706:	83 c4 08             	add    $0x8,%esp
+  804709:	53                   	push   %ebx
+  80470a:	57                   	push   %edi
+  80470b:	e8 ed 05 00 00       	call   804cfd <va_free>
+}
+  804710:	83 c4 10             	add    $0x10,%esp
+  804713:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804716:	5b                   	pop    %ebx
+  804717:	5e                   	pop    %esi
+  804718:	5f                   	pop    %edi
+  804719:	5d                   	pop    %ebp
+  80471a:	c3                   	ret
+
+0080471b <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  80471b:	55                   	push   %ebp
+  80471c:	89 e5                	mov    %esp,%ebp
+  80471e:	57                   	push   %edi
+  80471f:	56                   	push   %esi
+  804720:	53                   	push   %ebx
+  804721:	83 ec 1c             	sub    $0x1c,%esp
+  804724:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804727:	85 db                	test   %ebx,%ebx
+  804729:	74 34                	je     80475f <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  80472b:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  804731:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  804736:	77 2f                	ja     804767 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  804738:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80473e:	75 51                	jne    804791 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  804740:	89 c1                	mov    %eax,%ecx
+  804742:	c1 e9 0c             	shr    $0xc,%ecx
+  804745:	ba 01 00 00 00       	mov    $0x1,%edx
+  80474a:	d3 e2                	shl    %cl,%edx
+  80474c:	c1 e8 11             	shr    $0x11,%eax
+  80474f:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  804756:	75 24                	jne    80477c <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  804758:	89 d8                	mov    %ebx,%eax
+  80475a:	e8 00 ff ff ff       	call   80465f <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  80475f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804762:	5b                   	pop    %ebx
+  804763:	5e                   	pop    %esi
+  804764:	5f                   	pop    %edi
+  804765:	5d                   	pop    %ebp
+  804766:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  804767:	53                   	push   %ebx
+  804768:	68 87 5d 80 00       	push   $0x805d87
+  80476d:	68 a2 00 00 00       	push   $0xa2
+  804772:	68 7a 5d 80 00       	push   $0x805d7a
+  804777:	e8 7e 07 00 00       	call   804efa <_panic>
+			panic("free: %p is not allocated", va);
+  80477c:	53                   	push   %ebx
+  80477d:	68 60 5d 80 00       	push   $0x805d60
+  804782:	68 a5 00 00 00       	push   $0xa5
+  804787:	68 7a 5d 80 00       	push   $0x805d7a
+  80478c:	e8 69 07 00 00       	call   804efa <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  804791:	89 de                	mov    %ebx,%esi
+  804793:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  804799:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  80479f:	89 c8                	mov    %ecx,%eax
+  8047a1:	c1 e8 11             	shr    $0x11,%eax
+  8047a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8047a7:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  8047ae:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8047b1:	c1 e9 0c             	shr    $0xc,%ecx
+  8047b4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8047b9:	d3 e0                	shl    %cl,%eax
+  8047bb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8047be:	85 c7                	test   %eax,%edi
+  8047c0:	74 1b                	je     8047dd <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  8047c2:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8047c6:	89 d8                	mov    %ebx,%eax
+  8047c8:	29 f0                	sub    %esi,%eax
+  8047ca:	83 e8 10             	sub    $0x10,%eax
+  8047cd:	99                   	cltd
+  8047ce:	f7 ff                	idiv   %edi
+  8047d0:	89 d1                	mov    %edx,%ecx
+  8047d2:	85 d2                	test   %edx,%edx
+  8047d4:	75 07                	jne    8047dd <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8047d6:	ba 10 00 00 00       	mov    $0x10,%edx
+  8047db:	eb 18                	jmp    8047f5 <free+0xda>
+		panic("free: %p is not allocated", va);
+  8047dd:	53                   	push   %ebx
+  8047de:	68 60 5d 80 00       	push   $0x805d60
+  8047e3:	68 ad 00 00 00       	push   $0xad
+  8047e8:	68 7a 5d 80 00       	push   $0x805d7a
+  8047ed:	e8 08 07 00 00       	call   804efa <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8047f2:	83 c1 01             	add    $0x1,%ecx
+  8047f5:	89 d0                	mov    %edx,%eax
+  8047f7:	d3 e0                	shl    %cl,%eax
+  8047f9:	39 c7                	cmp    %eax,%edi
+  8047fb:	7f f5                	jg     8047f2 <free+0xd7>
+	*(void **) va = s->free;
+  8047fd:	8b 46 08             	mov    0x8(%esi),%eax
+  804800:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  804802:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  804805:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  804809:	8d 58 01             	lea    0x1(%eax),%ebx
+  80480c:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  804810:	66 85 c0             	test   %ax,%ax
+  804813:	74 52                	je     804867 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804815:	0f b7 db             	movzwl %bx,%ebx
+  804818:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  80481c:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804821:	ba 00 00 00 00       	mov    $0x0,%edx
+  804826:	f7 ff                	idiv   %edi
+  804828:	39 c3                	cmp    %eax,%ebx
+  80482a:	0f 85 2f ff ff ff    	jne    80475f <free+0x44>
+  804830:	8b 46 04             	mov    0x4(%esi),%eax
+  804833:	85 c0                	test   %eax,%eax
+  804835:	74 53                	je     80488a <free+0x16f>
+		s->prev->next = s->next;
+  804837:	8b 16                	mov    (%esi),%edx
+  804839:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  80483b:	8b 06                	mov    (%esi),%eax
+  80483d:	85 c0                	test   %eax,%eax
+  80483f:	74 06                	je     804847 <free+0x12c>
+		s->next->prev = s->prev;
+  804841:	8b 56 04             	mov    0x4(%esi),%edx
+  804844:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804847:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80484a:	f7 d0                	not    %eax
+  80484c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80484f:	21 d0                	and    %edx,%eax
+  804851:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  804854:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  80485b:	89 f0                	mov    %esi,%eax
+  80485d:	e8 fd fd ff ff       	call   80465f <heap_free_pages>
+  804862:	e9 f8 fe ff ff       	jmp    80475f <free+0x44>
+	s->prev = NULL;
+  804867:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  80486e:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  804875:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  804877:	85 c0                	test   %eax,%eax
+  804879:	74 03                	je     80487e <free+0x163>
+		slabs[c]->prev = s;
+  80487b:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  80487e:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  804885:	e9 d5 fe ff ff       	jmp    80475f <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  80488a:	8b 06                	mov    (%esi),%eax
+  80488c:	85 c0                	test   %eax,%eax
+  80488e:	0f 84 cb fe ff ff    	je     80475f <free+0x44>
+		slabs[c] = s->next;
+  804894:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  80489b:	8b 06                	mov    (%esi),%eax
+  80489d:	eb a2                	jmp    804841 <free+0x126>
+
+0080489f <heap_alloc_pages>:
+{
+  80489f:	55                   	push   %ebp
+  8048a0:	89 e5                	mov    %esp,%ebp
+  8048a2:	57                   	push   %edi
+  8048a3:	56                   	push   %esi
+  8048a4:	53                   	push   %ebx
+  8048a5:	83 ec 18             	sub    $0x18,%esp
+  8048a8:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  8048aa:	50                   	push   %eax
+  8048ab:	e8 15 03 00 00       	call   804bc5 <va_alloc>
+  8048b0:	89 c3                	mov    %eax,%ebx
+  8048b2:	83 c4 10             	add    $0x10,%esp
+  8048b5:	85 c0                	test   %eax,%eax
+  8048b7:	74 47                	je     804900 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8048b9:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  8048bf:	89 c1                	mov    %eax,%ecx
+  8048c1:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  8048c4:	c1 e8 11             	shr    $0x11,%eax
+  8048c7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8048cc:	89 d7                	mov    %edx,%edi
+  8048ce:	d3 e7                	shl    %cl,%edi
+  8048d0:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  8048d7:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  8048db:	89 c8                	mov    %ecx,%eax
+  8048dd:	c1 e8 05             	shr    $0x5,%eax
+  8048e0:	d3 e2                	shl    %cl,%edx
+  8048e2:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  8048e9:	83 ec 0c             	sub    $0xc,%esp
+  8048ec:	6a 00                	push   $0x0
+  8048ee:	6a 07                	push   $0x7
+  8048f0:	56                   	push   %esi
+  8048f1:	53                   	push   %ebx
+  8048f2:	6a 00                	push   $0x0
+  8048f4:	e8 3a f7 ff ff       	call   804033 <page_alloc_range>
+  8048f9:	83 c4 20             	add    $0x20,%esp
+  8048fc:	85 c0                	test   %eax,%eax
+  8048fe:	78 0a                	js     80490a <heap_alloc_pages+0x6b>
+}
+  804900:	89 d8                	mov    %ebx,%eax
+  804902:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804905:	5b                   	pop    %ebx
+  804906:	5e                   	pop    %esi
+  804907:	5f                   	pop    %edi
+  804908:	5d                   	pop    %ebp
+  804909:	c3                   	ret
+		free(va);
+  80490a:	83 ec 0c             	sub    $0xc,%esp
+  80490d:	53                   	push   %ebx
+  80490e:	e8 08 fe ff ff       	call   80471b <free>
+		return NULL;
+  804913:	83 c4 10             	add    $0x10,%esp
+  804916:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80491b:	eb e3                	jmp    804900 <heap_alloc_pages+0x61>
+
+0080491d <malloc>:
+{
+  80491d:	55                   	push   %ebp
+  80491e:	89 e5                	mov    %esp,%ebp
+  804920:	57                   	push   %edi
+  804921:	56                   	push   %esi
+  804922:	53                   	push   %ebx
+  804923:	83 ec 1c             	sub    $0x1c,%esp
+  804926:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804929:	8d 50 ff             	lea    -0x1(%eax),%edx
+  80492c:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  804932:	0f 87 21 01 00 00    	ja     804a59 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804938:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80493d:	ba 10 00 00 00       	mov    $0x10,%edx
+  804942:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  804944:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804949:	76 15                	jbe    804960 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  80494b:	05 ff 0f 00 00       	add    $0xfff,%eax
+  804950:	c1 e8 0c             	shr    $0xc,%eax
+  804953:	e8 47 ff ff ff       	call   80489f <heap_alloc_pages>
+  804958:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80495b:	eb 37                	jmp    804994 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  80495d:	83 c1 01             	add    $0x1,%ecx
+  804960:	89 d6                	mov    %edx,%esi
+  804962:	d3 e6                	shl    %cl,%esi
+  804964:	39 c6                	cmp    %eax,%esi
+  804966:	72 f5                	jb     80495d <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804968:	89 cb                	mov    %ecx,%ebx
+  80496a:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  804971:	85 ff                	test   %edi,%edi
+  804973:	74 2a                	je     80499f <malloc+0x82>
+	v = s->free;
+  804975:	8b 47 08             	mov    0x8(%edi),%eax
+  804978:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  80497b:	8b 00                	mov    (%eax),%eax
+  80497d:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  804980:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  804984:	83 e8 01             	sub    $0x1,%eax
+  804987:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  80498b:	66 85 c0             	test   %ax,%ax
+  80498e:	0f 84 9a 00 00 00    	je     804a2e <malloc+0x111>
+}
+  804994:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804997:	83 c4 1c             	add    $0x1c,%esp
+  80499a:	5b                   	pop    %ebx
+  80499b:	5e                   	pop    %esi
+  80499c:	5f                   	pop    %edi
+  80499d:	5d                   	pop    %ebp
+  80499e:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  80499f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8049a4:	e8 f6 fe ff ff       	call   80489f <heap_alloc_pages>
+  8049a9:	89 c1                	mov    %eax,%ecx
+  8049ab:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8049ae:	85 c0                	test   %eax,%eax
+  8049b0:	74 e2                	je     804994 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8049b2:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  8049b8:	89 c8                	mov    %ecx,%eax
+  8049ba:	c1 e8 11             	shr    $0x11,%eax
+  8049bd:	c1 e9 0c             	shr    $0xc,%ecx
+  8049c0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8049c5:	d3 e2                	shl    %cl,%edx
+  8049c7:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  8049ce:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8049d1:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  8049d5:	0f b7 f6             	movzwl %si,%esi
+  8049d8:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8049dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049e2:	f7 fe                	idiv   %esi
+  8049e4:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  8049e8:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  8049eb:	85 c0                	test   %eax,%eax
+  8049ed:	74 14                	je     804a03 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  8049ef:	83 e8 01             	sub    $0x1,%eax
+  8049f2:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  8049f6:	0f af d0             	imul   %eax,%edx
+  8049f9:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  8049fd:	89 3a                	mov    %edi,(%edx)
+  8049ff:	89 d7                	mov    %edx,%edi
+  804a01:	eb e5                	jmp    8049e8 <malloc+0xcb>
+	s->prev = NULL;
+  804a03:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804a06:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804a0d:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  804a14:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804a16:	85 c0                	test   %eax,%eax
+  804a18:	74 03                	je     804a1d <malloc+0x100>
+		slabs[c]->prev = s;
+  804a1a:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804a1d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804a20:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  804a27:	89 c7                	mov    %eax,%edi
+  804a29:	e9 47 ff ff ff       	jmp    804975 <malloc+0x58>
+	if (s->prev)
+  804a2e:	8b 47 04             	mov    0x4(%edi),%eax
+  804a31:	85 c0                	test   %eax,%eax
+  804a33:	74 19                	je     804a4e <malloc+0x131>
+		s->prev->next = s->next;
+  804a35:	8b 17                	mov    (%edi),%edx
+  804a37:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804a39:	8b 07                	mov    (%edi),%eax
+  804a3b:	85 c0                	test   %eax,%eax
+  804a3d:	0f 84 51 ff ff ff    	je     804994 <malloc+0x77>
+		s->next->prev = s->prev;
+  804a43:	8b 57 04             	mov    0x4(%edi),%edx
+  804a46:	89 50 04             	mov    %edx,0x4(%eax)
+  804a49:	e9 46 ff ff ff       	jmp    804994 <malloc+0x77>
+		slabs[c] = s->next;
+  804a4e:	8b 07                	mov    (%edi),%eax
+  804a50:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  804a57:	eb e0                	jmp    804a39 <malloc+0x11c>
+		return NULL;
+  804a59:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804a60:	e9 2f ff ff ff       	jmp    804994 <malloc+0x77>
+
+00804a65 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804a65:	55                   	push   %ebp
+  804a66:	89 e5                	mov    %esp,%ebp
+  804a68:	57                   	push   %edi
+  804a69:	56                   	push   %esi
+  804a6a:	53                   	push   %ebx
+  804a6b:	83 ec 0c             	sub    $0xc,%esp
+  804a6e:	89 c6                	mov    %eax,%esi
+  804a70:	89 d7                	mov    %edx,%edi
+  804a72:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804a75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804a7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  804a84:	83 ef 01             	sub    $0x1,%edi
+  804a87:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804a8a:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  804a8d:	eb 34                	jmp    804ac3 <va_chunk_scan+0x5e>
+			i += 31;
+  804a8f:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  804a92:	89 ca                	mov    %ecx,%edx
+			continue;
+  804a94:	eb 23                	jmp    804ab9 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804a96:	89 c7                	mov    %eax,%edi
+  804a98:	c1 ef 05             	shr    $0x5,%edi
+  804a9b:	be 01 00 00 00       	mov    $0x1,%esi
+  804aa0:	d3 e6                	shl    %cl,%esi
+  804aa2:	89 f1                	mov    %esi,%ecx
+  804aa4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804aa7:	23 0c be             	and    (%esi,%edi,4),%ecx
+  804aaa:	75 41                	jne    804aed <va_chunk_scan+0x88>
+			len++;
+  804aac:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804aaf:	39 d3                	cmp    %edx,%ebx
+  804ab1:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  804ab4:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  804ab7:	72 2d                	jb     804ae6 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804ab9:	83 c0 01             	add    $0x1,%eax
+  804abc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804ac1:	77 31                	ja     804af4 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  804ac3:	89 c1                	mov    %eax,%ecx
+  804ac5:	83 e1 1f             	and    $0x1f,%ecx
+  804ac8:	75 cc                	jne    804a96 <va_chunk_scan+0x31>
+  804aca:	89 c7                	mov    %eax,%edi
+  804acc:	c1 ef 05             	shr    $0x5,%edi
+  804acf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804ad2:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804ad5:	83 ff ff             	cmp    $0xffffffff,%edi
+  804ad8:	74 b5                	je     804a8f <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  804ada:	85 ff                	test   %edi,%edi
+  804adc:	75 b8                	jne    804a96 <va_chunk_scan+0x31>
+			i += 31;
+  804ade:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804ae1:	83 c2 20             	add    $0x20,%edx
+  804ae4:	eb c9                	jmp    804aaf <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804ae6:	83 c0 01             	add    $0x1,%eax
+  804ae9:	29 d0                	sub    %edx,%eax
+  804aeb:	eb 15                	jmp    804b02 <va_chunk_scan+0x9d>
+			len = 0;
+  804aed:	ba 00 00 00 00       	mov    $0x0,%edx
+  804af2:	eb c5                	jmp    804ab9 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804af4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804af9:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804afc:	85 d2                	test   %edx,%edx
+  804afe:	74 02                	je     804b02 <va_chunk_scan+0x9d>
+		*run_store = best;
+  804b00:	89 1a                	mov    %ebx,(%edx)
+}
+  804b02:	83 c4 0c             	add    $0xc,%esp
+  804b05:	5b                   	pop    %ebx
+  804b06:	5e                   	pop    %esi
+  804b07:	5f                   	pop    %edi
+  804b08:	5d                   	pop    %ebp
+  804b09:	c3                   	ret
+
+00804b0a <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804b0a:	55                   	push   %ebp
+  804b0b:	89 e5                	mov    %esp,%ebp
+  804b0d:	57                   	push   %edi
+  804b0e:	56                   	push   %esi
+  804b0f:	53                   	push   %ebx
+  804b10:	83 ec 14             	sub    $0x14,%esp
+  804b13:	89 c3                	mov    %eax,%ebx
+  804b15:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804b17:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804b1d:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  804b23:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804b26:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804b29:	89 d6                	mov    %edx,%esi
+  804b2b:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  804b31:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804b33:	eb 34                	jmp    804b69 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804b35:	89 c8                	mov    %ecx,%eax
+  804b37:	c1 e8 05             	shr    $0x5,%eax
+  804b3a:	89 da                	mov    %ebx,%edx
+  804b3c:	c1 e2 05             	shl    $0x5,%edx
+  804b3f:	01 da                	add    %ebx,%edx
+  804b41:	01 c2                	add    %eax,%edx
+  804b43:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804b48:	d3 c0                	rol    %cl,%eax
+  804b4a:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804b51:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804b58:	b8 01 00 00 00       	mov    $0x1,%eax
+  804b5d:	01 d0                	add    %edx,%eax
+  804b5f:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804b66:	83 c1 01             	add    $0x1,%ecx
+  804b69:	39 f9                	cmp    %edi,%ecx
+  804b6b:	74 30                	je     804b9d <va_chunk_mark+0x93>
+		if (alloc)
+  804b6d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804b71:	74 c2                	je     804b35 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804b73:	89 c8                	mov    %ecx,%eax
+  804b75:	c1 e8 05             	shr    $0x5,%eax
+  804b78:	89 da                	mov    %ebx,%edx
+  804b7a:	c1 e2 05             	shl    $0x5,%edx
+  804b7d:	01 da                	add    %ebx,%edx
+  804b7f:	01 c2                	add    %eax,%edx
+  804b81:	b8 01 00 00 00       	mov    $0x1,%eax
+  804b86:	d3 e0                	shl    %cl,%eax
+  804b88:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804b8f:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804b96:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804b9b:	eb c0                	jmp    804b5d <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804b9d:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804ba0:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ba5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804ba8:	e8 b8 fe ff ff       	call   804a65 <va_chunk_scan>
+	ch->run = run;
+  804bad:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804bb3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804bb6:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  804bbd:	83 c4 14             	add    $0x14,%esp
+  804bc0:	5b                   	pop    %ebx
+  804bc1:	5e                   	pop    %esi
+  804bc2:	5f                   	pop    %edi
+  804bc3:	5d                   	pop    %ebp
+  804bc4:	c3                   	ret
+
+00804bc5 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804bc5:	55                   	push   %ebp
+  804bc6:	89 e5                	mov    %esp,%ebp
+  804bc8:	57                   	push   %edi
+  804bc9:	56                   	push   %esi
+  804bca:	53                   	push   %ebx
+  804bcb:	83 ec 04             	sub    $0x4,%esp
+  804bce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804bd1:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  804bd6:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  804bdb:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  804be2:	74 4f                	je     804c33 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804be4:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804be7:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804bec:	0f 87 01 01 00 00    	ja     804cf3 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804bf2:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804bf8:	0f 87 80 00 00 00    	ja     804c7e <va_alloc+0xb9>
+  804bfe:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804c03:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804c08:	0f b7 10             	movzwl (%eax),%edx
+  804c0b:	05 84 00 00 00       	add    $0x84,%eax
+  804c10:	39 da                	cmp    %ebx,%edx
+  804c12:	73 2c                	jae    804c40 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804c14:	83 c6 01             	add    $0x1,%esi
+  804c17:	83 fe 1c             	cmp    $0x1c,%esi
+  804c1a:	75 ec                	jne    804c08 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c21:	eb 53                	jmp    804c76 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804c23:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804c29:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804c2e:	05 84 00 00 00       	add    $0x84,%eax
+  804c33:	39 d0                	cmp    %edx,%eax
+  804c35:	75 ec                	jne    804c23 <va_alloc+0x5e>
+	va_inited = 1;
+  804c37:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  804c3e:	eb a4                	jmp    804be4 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804c40:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804c46:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  804c4b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804c50:	89 da                	mov    %ebx,%edx
+  804c52:	e8 0e fe ff ff       	call   804a65 <va_chunk_scan>
+  804c57:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804c59:	6a 01                	push   $0x1
+  804c5b:	89 d9                	mov    %ebx,%ecx
+  804c5d:	89 c2                	mov    %eax,%edx
+  804c5f:	89 f0                	mov    %esi,%eax
+  804c61:	e8 a4 fe ff ff       	call   804b0a <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804c66:	c1 e6 16             	shl    $0x16,%esi
+  804c69:	c1 e7 0c             	shl    $0xc,%edi
+  804c6c:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804c73:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804c76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804c79:	5b                   	pop    %ebx
+  804c7a:	5e                   	pop    %esi
+  804c7b:	5f                   	pop    %edi
+  804c7c:	5d                   	pop    %ebp
+  804c7d:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804c7e:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804c84:	c1 ee 0a             	shr    $0xa,%esi
+  804c87:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c91:	eb 0a                	jmp    804c9d <va_alloc+0xd8>
+			first = c + 1;
+  804c93:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804c95:	83 c2 01             	add    $0x1,%edx
+  804c98:	83 fa 1d             	cmp    $0x1d,%edx
+  804c9b:	74 4f                	je     804cec <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804c9d:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804ca3:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  804caa:	00 04 
+  804cac:	75 e5                	jne    804c93 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804cae:	89 d1                	mov    %edx,%ecx
+  804cb0:	29 c1                	sub    %eax,%ecx
+  804cb2:	39 f1                	cmp    %esi,%ecx
+  804cb4:	75 df                	jne    804c95 <va_alloc+0xd0>
+  804cb6:	89 c7                	mov    %eax,%edi
+  804cb8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804cbb:	be 00 04 00 00       	mov    $0x400,%esi
+  804cc0:	39 f3                	cmp    %esi,%ebx
+  804cc2:	0f 46 f3             	cmovbe %ebx,%esi
+  804cc5:	6a 01                	push   $0x1
+  804cc7:	89 f1                	mov    %esi,%ecx
+  804cc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  804cce:	89 f8                	mov    %edi,%eax
+  804cd0:	e8 35 fe ff ff       	call   804b0a <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804cd5:	83 c7 01             	add    $0x1,%edi
+  804cd8:	83 c4 04             	add    $0x4,%esp
+  804cdb:	29 f3                	sub    %esi,%ebx
+  804cdd:	75 dc                	jne    804cbb <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804cdf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804ce2:	c1 e0 16             	shl    $0x16,%eax
+  804ce5:	05 00 00 00 08       	add    $0x8000000,%eax
+  804cea:	eb 8a                	jmp    804c76 <va_alloc+0xb1>
+	return NULL;
+  804cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cf1:	eb 83                	jmp    804c76 <va_alloc+0xb1>
+		return NULL;
+  804cf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cf8:	e9 79 ff ff ff       	jmp    804c76 <va_alloc+0xb1>
+
+00804cfd <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804cfd:	55                   	push   %ebp
+  804cfe:	89 e5                	mov    %esp,%ebp
+  804d00:	57                   	push   %edi
+  804d01:	56                   	push   %esi
+  804d02:	53                   	push   %ebx
+  804d03:	83 ec 0c             	sub    $0xc,%esp
+  804d06:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804d09:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804d0c:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804d12:	76 21                	jbe    804d35 <va_free+0x38>
+  804d14:	89 f0                	mov    %esi,%eax
+  804d16:	c1 e0 0c             	shl    $0xc,%eax
+  804d19:	01 f8                	add    %edi,%eax
+  804d1b:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804d20:	77 13                	ja     804d35 <va_free+0x38>
+	    || PGOFF(va))
+  804d22:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804d28:	75 0b                	jne    804d35 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804d2a:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804d30:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804d33:	eb 45                	jmp    804d7a <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804d35:	83 ec 0c             	sub    $0xc,%esp
+  804d38:	56                   	push   %esi
+  804d39:	57                   	push   %edi
+  804d3a:	68 a4 5d 80 00       	push   $0x805da4
+  804d3f:	68 8e 00 00 00       	push   $0x8e
+  804d44:	68 c4 5d 80 00       	push   $0x805dc4
+  804d49:	e8 ac 01 00 00       	call   804efa <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804d4e:	89 fa                	mov    %edi,%edx
+  804d50:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804d56:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804d5b:	29 d3                	sub    %edx,%ebx
+  804d5d:	39 f3                	cmp    %esi,%ebx
+  804d5f:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804d62:	89 f8                	mov    %edi,%eax
+  804d64:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804d67:	83 ec 0c             	sub    $0xc,%esp
+  804d6a:	6a 00                	push   $0x0
+  804d6c:	89 d9                	mov    %ebx,%ecx
+  804d6e:	e8 97 fd ff ff       	call   804b0a <va_chunk_mark>
+		i += n;
+  804d73:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804d75:	29 de                	sub    %ebx,%esi
+  804d77:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804d7a:	85 f6                	test   %esi,%esi
+  804d7c:	75 d0                	jne    804d4e <va_free+0x51>
+	}
+}
+  804d7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804d81:	5b                   	pop    %ebx
+  804d82:	5e                   	pop    %esi
+  804d83:	5f                   	pop    %edi
+  804d84:	5d                   	pop    %ebp
+  804d85:	c3                   	ret
+
+00804d86 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804d86:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d8b:	c3                   	ret
+
+00804d8c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804d8c:	55                   	push   %ebp
+  804d8d:	89 e5                	mov    %esp,%ebp
+  804d8f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804d92:	68 d1 5d 80 00       	push   $0x805dd1
+  804d97:	ff 75 0c             	push   0xc(%ebp)
+  804d9a:	e8 00 ba ff ff       	call   80079f <strcpy>
+	return 0;
+}
+  804d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804da4:	c9                   	leave
+  804da5:	c3                   	ret
+
+00804da6 <devcons_write>:
+{
+  804da6:	55                   	push   %ebp
+  804da7:	89 e5                	mov    %esp,%ebp
+  804da9:	57                   	push   %edi
+  804daa:	56                   	push   %esi
+  804dab:	53                   	push   %ebx
+  804dac:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804db2:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804db7:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804dbd:	eb 2e                	jmp    804ded <devcons_write+0x47>
+		m = n - tot;
+  804dbf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804dc2:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804dc4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804dc9:	39 c3                	cmp    %eax,%ebx
+  804dcb:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804dce:	83 ec 04             	sub    $0x4,%esp
+  804dd1:	53                   	push   %ebx
+  804dd2:	89 f0                	mov    %esi,%eax
+  804dd4:	03 45 0c             	add    0xc(%ebp),%eax
+  804dd7:	50                   	push   %eax
+  804dd8:	57                   	push   %edi
+  804dd9:	e8 47 bb ff ff       	call   800925 <memmove>
+		sys_cputs(buf, m);
+  804dde:	83 c4 08             	add    $0x8,%esp
+  804de1:	53                   	push   %ebx
+  804de2:	57                   	push   %edi
+  804de3:	e8 dd bd ff ff       	call   800bc5 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804de8:	01 de                	add    %ebx,%esi
+  804dea:	83 c4 10             	add    $0x10,%esp
+  804ded:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804df0:	72 cd                	jb     804dbf <devcons_write+0x19>
+}
+  804df2:	89 f0                	mov    %esi,%eax
+  804df4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804df7:	5b                   	pop    %ebx
+  804df8:	5e                   	pop    %esi
+  804df9:	5f                   	pop    %edi
+  804dfa:	5d                   	pop    %ebp
+  804dfb:	c3                   	ret
+
+00804dfc <devcons_read>:
+{
+  804dfc:	55                   	push   %ebp
+  804dfd:	89 e5                	mov    %esp,%ebp
+  804dff:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804e02:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e07:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804e0b:	75 07                	jne    804e14 <devcons_read+0x18>
+  804e0d:	eb 1f                	jmp    804e2e <devcons_read+0x32>
+		sys_yield();
+  804e0f:	e8 5f be ff ff       	call   800c73 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804e14:	e8 db bd ff ff       	call   800bf4 <sys_cgetc>
+  804e19:	85 c0                	test   %eax,%eax
+  804e1b:	74 f2                	je     804e0f <devcons_read+0x13>
+	if (c < 0)
+  804e1d:	78 0f                	js     804e2e <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804e1f:	83 f8 04             	cmp    $0x4,%eax
+  804e22:	74 0c                	je     804e30 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804e24:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804e27:	88 02                	mov    %al,(%edx)
+	return 1;
+  804e29:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804e2e:	c9                   	leave
+  804e2f:	c3                   	ret
+		return 0;
+  804e30:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e35:	eb f7                	jmp    804e2e <devcons_read+0x32>
+
+00804e37 <cputchar>:
+{
+  804e37:	55                   	push   %ebp
+  804e38:	89 e5                	mov    %esp,%ebp
+  804e3a:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804e3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804e40:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804e43:	6a 01                	push   $0x1
+  804e45:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804e48:	50                   	push   %eax
+  804e49:	e8 77 bd ff ff       	call   800bc5 <sys_cputs>
+}
+  804e4e:	83 c4 10             	add    $0x10,%esp
+  804e51:	c9                   	leave
+  804e52:	c3                   	ret
+
+00804e53 <getchar>:
+{
+  804e53:	55                   	push   %ebp
+  804e54:	89 e5                	mov    %esp,%ebp
+  804e56:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804e59:	6a 01                	push   $0x1
+  804e5b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804e5e:	50                   	push   %eax
+  804e5f:	6a 00                	push   $0x0
+  804e61:	e8 d7 ce ff ff       	call   801d3d <read>
+	if (r < 0)
+  804e66:	83 c4 10             	add    $0x10,%esp
+  804e69:	85 c0                	test   %eax,%eax
+  804e6b:	78 06                	js     804e73 <getchar+0x20>
+	if (r < 1)
+  804e6d:	74 06                	je     804e75 <getchar+0x22>
+	return c;
+  804e6f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804e73:	c9                   	leave
+  804e74:	c3                   	ret
+		return -E_EOF;
+  804e75:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804e7a:	eb f7                	jmp    804e73 <getchar+0x20>
+
+00804e7c <iscons>:
+{
+  804e7c:	55                   	push   %ebp
+  804e7d:	89 e5                	mov    %esp,%ebp
+  804e7f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804e82:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804e85:	50                   	push   %eax
+  804e86:	ff 75 08             	push   0x8(%ebp)
+  804e89:	e8 50 cc ff ff       	call   801ade <fd_lookup>
+  804e8e:	83 c4 10             	add    $0x10,%esp
+  804e91:	85 c0                	test   %eax,%eax
+  804e93:	78 11                	js     804ea6 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804e95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804e98:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804e9e:	39 10                	cmp    %edx,(%eax)
+  804ea0:	0f 94 c0             	sete   %al
+  804ea3:	0f b6 c0             	movzbl %al,%eax
+}
+  804ea6:	c9                   	leave
+  804ea7:	c3                   	ret
+
+00804ea8 <opencons>:
+{
+  804ea8:	55                   	push   %ebp
+  804ea9:	89 e5                	mov    %esp,%ebp
+  804eab:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804eae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804eb1:	50                   	push   %eax
+  804eb2:	e8 d3 cb ff ff       	call   801a8a <fd_alloc>
+  804eb7:	83 c4 10             	add    $0x10,%esp
+  804eba:	85 c0                	test   %eax,%eax
+  804ebc:	78 3a                	js     804ef8 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804ebe:	83 ec 04             	sub    $0x4,%esp
+  804ec1:	68 07 04 00 00       	push   $0x407
+  804ec6:	ff 75 f4             	push   -0xc(%ebp)
+  804ec9:	6a 00                	push   $0x0
+  804ecb:	e8 c2 bd ff ff       	call   800c92 <sys_page_alloc>
+  804ed0:	83 c4 10             	add    $0x10,%esp
+  804ed3:	85 c0                	test   %eax,%eax
+  804ed5:	78 21                	js     804ef8 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804ed7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804eda:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804ee0:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804ee2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804ee5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804eec:	83 ec 0c             	sub    $0xc,%esp
+  804eef:	50                   	push   %eax
+  804ef0:	e8 6e cb ff ff       	call   801a63 <fd2num>
+  804ef5:	83 c4 10             	add    $0x10,%esp
+}
+  804ef8:	c9                   	leave
+  804ef9:	c3                   	ret
+
+00804efa <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  804efa:	55                   	push   %ebp
+  804efb:	89 e5                	mov    %esp,%ebp
+  804efd:	56                   	push   %esi
+  804efe:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  804eff:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  804f02:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  804f08:	e8 47 bd ff ff       	call   800c54 <sys_getenvid>
+  804f0d:	83 ec 0c             	sub    $0xc,%esp
+  804f10:	ff 75 0c             	push   0xc(%ebp)
+  804f13:	ff 75 08             	push   0x8(%ebp)
+  804f16:	56                   	push   %esi
+  804f17:	50                   	push   %eax
+  804f18:	68 e0 5d 80 00       	push   $0x805de0
+  804f1d:	e8 96 b2 ff ff       	call   8001b8 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  804f22:	83 c4 18             	add    $0x18,%esp
+  804f25:	53                   	push   %ebx
+  804f26:	ff 75 10             	push   0x10(%ebp)
+  804f29:	e8 39 b2 ff ff       	call   800167 <vcprintf>
+	cprintf("\n");
+  804f2e:	c7 04 24 99 58 80 00 	movl   $0x805899,(%esp)
+  804f35:	e8 7e b2 ff ff       	call   8001b8 <cprintf>
+  804f3a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  804f3d:	cc                   	int3
+	while (1)
+  804f3e:	eb fd                	jmp    804f3d <_panic+0x43>
+
+00804f40 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804f40:	55                   	push   %ebp
+  804f41:	89 e5                	mov    %esp,%ebp
+  804f43:	56                   	push   %esi
+  804f44:	53                   	push   %ebx
+  804f45:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804f48:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  804f4d:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804f50:	85 db                	test   %ebx,%ebx
+  804f52:	78 17                	js     804f6b <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804f54:	83 ec 0c             	sub    $0xc,%esp
+  804f57:	56                   	push   %esi
+  804f58:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  804f5f:	83 c4 10             	add    $0x10,%esp
+  804f62:	85 c0                	test   %eax,%eax
+  804f64:	75 27                	jne    804f8d <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804f66:	83 eb 01             	sub    $0x1,%ebx
+  804f69:	eb e5                	jmp    804f50 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804f6b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804f70:	8b 40 48             	mov    0x48(%eax),%eax
+  804f73:	83 ec 08             	sub    $0x8,%esp
+  804f76:	ff 76 28             	push   0x28(%esi)
+  804f79:	ff 36                	push   (%esi)
+  804f7b:	50                   	push   %eax
+  804f7c:	68 04 5e 80 00       	push   $0x805e04
+  804f81:	6a 1d                	push   $0x1d
+  804f83:	68 27 5e 80 00       	push   $0x805e27
+  804f88:	e8 6d ff ff ff       	call   804efa <_panic>
+}
+  804f8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804f90:	5b                   	pop    %ebx
+  804f91:	5e                   	pop    %esi
+  804f92:	5d                   	pop    %ebp
+  804f93:	c3                   	ret
+
+00804f94 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804f94:	55                   	push   %ebp
+  804f95:	89 e5                	mov    %esp,%ebp
+  804f97:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804f9a:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  804fa1:	74 0a                	je     804fad <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804fa3:	8b 45 08             	mov    0x8(%ebp),%eax
+  804fa6:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  804fab:	c9                   	leave
+  804fac:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804fad:	83 ec 04             	sub    $0x4,%esp
+  804fb0:	6a 07                	push   $0x7
+  804fb2:	68 00 f0 bf ee       	push   $0xeebff000
+  804fb7:	6a 00                	push   $0x0
+  804fb9:	e8 d4 bc ff ff       	call   800c92 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804fbe:	83 c4 08             	add    $0x8,%esp
+  804fc1:	68 34 50 80 00       	push   $0x805034
+  804fc6:	6a 00                	push   $0x0
+  804fc8:	e8 2b c0 ff ff       	call   800ff8 <sys_env_set_pgfault_upcall>
+  804fcd:	83 c4 10             	add    $0x10,%esp
+  804fd0:	eb d1                	jmp    804fa3 <set_pgfault_handler+0xf>
+
+00804fd2 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804fd2:	55                   	push   %ebp
+  804fd3:	89 e5                	mov    %esp,%ebp
+  804fd5:	83 ec 08             	sub    $0x8,%esp
+  804fd8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  804fdb:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  804fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fe6:	eb 03                	jmp    804feb <add_pgfault_handler+0x19>
+  804fe8:	83 c0 01             	add    $0x1,%eax
+  804feb:	39 d0                	cmp    %edx,%eax
+  804fed:	74 0b                	je     804ffa <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804fef:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  804ff6:	75 f0                	jne    804fe8 <add_pgfault_handler+0x16>
+  804ff8:	eb 24                	jmp    80501e <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  804ffa:	83 fa 0a             	cmp    $0xa,%edx
+  804ffd:	74 21                	je     805020 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  804fff:	8d 42 01             	lea    0x1(%edx),%eax
+  805002:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  805007:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  80500e:	83 ec 0c             	sub    $0xc,%esp
+  805011:	68 40 4f 80 00       	push   $0x804f40
+  805016:	e8 79 ff ff ff       	call   804f94 <set_pgfault_handler>
+  80501b:	83 c4 10             	add    $0x10,%esp
+}
+  80501e:	c9                   	leave
+  80501f:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  805020:	83 ec 04             	sub    $0x4,%esp
+  805023:	68 35 5e 80 00       	push   $0x805e35
+  805028:	6a 44                	push   $0x44
+  80502a:	68 27 5e 80 00       	push   $0x805e27
+  80502f:	e8 c6 fe ff ff       	call   804efa <_panic>
+
+00805034 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  805034:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  805035:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  80503a:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80503c:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  80503f:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  805043:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  805047:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  80504a:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  80504c:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  805050:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  805053:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  805054:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  805057:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  805058:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  805059:	c3                   	ret
+
+0080505a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80505a:	55                   	push   %ebp
+  80505b:	89 e5                	mov    %esp,%ebp
+  80505d:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805060:	89 c2                	mov    %eax,%edx
+  805062:	c1 ea 16             	shr    $0x16,%edx
+  805065:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80506c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805071:	f6 c1 01             	test   $0x1,%cl
+  805074:	74 1e                	je     805094 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  805076:	c1 e8 0c             	shr    $0xc,%eax
+  805079:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  805080:	a8 01                	test   $0x1,%al
+  805082:	74 10                	je     805094 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  805084:	c1 e8 0c             	shr    $0xc,%eax
+  805087:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80508a:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  805091:	0f b7 d2             	movzwl %dx,%edx
+}
+  805094:	89 d0                	mov    %edx,%eax
+  805096:	5d                   	pop    %ebp
+  805097:	c3                   	ret
+
+00805098 <udivmod>:
+  805098:	55                   	push   %ebp
+  805099:	57                   	push   %edi
+  80509a:	56                   	push   %esi
+  80509b:	53                   	push   %ebx
+  80509c:	83 ec 24             	sub    $0x24,%esp
+  80509f:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8050a3:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8050a7:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8050ab:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8050af:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8050b3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8050b7:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8050bb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8050c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050ca:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8050d1:	00 
+  8050d2:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8050d9:	00 
+  8050da:	89 fb                	mov    %edi,%ebx
+  8050dc:	eb 08                	jmp    8050e6 <udivmod+0x4e>
+  8050de:	83 e9 01             	sub    $0x1,%ecx
+  8050e1:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8050e4:	74 68                	je     80514e <udivmod+0xb6>
+  8050e6:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8050ea:	01 c0                	add    %eax,%eax
+  8050ec:	89 c6                	mov    %eax,%esi
+  8050ee:	89 d7                	mov    %edx,%edi
+  8050f0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8050f4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8050f8:	0f ad d0             	shrd   %cl,%edx,%eax
+  8050fb:	d3 ea                	shr    %cl,%edx
+  8050fd:	f6 c1 20             	test   $0x20,%cl
+  805100:	74 04                	je     805106 <udivmod+0x6e>
+  805102:	89 d0                	mov    %edx,%eax
+  805104:	31 d2                	xor    %edx,%edx
+  805106:	83 e0 01             	and    $0x1,%eax
+  805109:	89 04 24             	mov    %eax,(%esp)
+  80510c:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805113:	00 
+  805114:	8b 04 24             	mov    (%esp),%eax
+  805117:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80511b:	09 f0                	or     %esi,%eax
+  80511d:	09 fa                	or     %edi,%edx
+  80511f:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805123:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  805127:	39 f0                	cmp    %esi,%eax
+  805129:	89 d5                	mov    %edx,%ebp
+  80512b:	19 fd                	sbb    %edi,%ebp
+  80512d:	72 af                	jb     8050de <udivmod+0x46>
+  80512f:	29 f0                	sub    %esi,%eax
+  805131:	19 fa                	sbb    %edi,%edx
+  805133:	89 cf                	mov    %ecx,%edi
+  805135:	c1 ef 05             	shr    $0x5,%edi
+  805138:	83 e7 01             	and    $0x1,%edi
+  80513b:	89 fe                	mov    %edi,%esi
+  80513d:	83 f6 01             	xor    $0x1,%esi
+  805140:	d3 e6                	shl    %cl,%esi
+  805142:	d3 e7                	shl    %cl,%edi
+  805144:	09 74 24 18          	or     %esi,0x18(%esp)
+  805148:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80514c:	eb 90                	jmp    8050de <udivmod+0x46>
+  80514e:	85 db                	test   %ebx,%ebx
+  805150:	74 05                	je     805157 <udivmod+0xbf>
+  805152:	89 03                	mov    %eax,(%ebx)
+  805154:	89 53 04             	mov    %edx,0x4(%ebx)
+  805157:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80515b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80515f:	83 c4 24             	add    $0x24,%esp
+  805162:	5b                   	pop    %ebx
+  805163:	5e                   	pop    %esi
+  805164:	5f                   	pop    %edi
+  805165:	5d                   	pop    %ebp
+  805166:	c3                   	ret
+
+00805167 <__udivdi3>:
+  805167:	83 ec 08             	sub    $0x8,%esp
+  80516a:	6a 00                	push   $0x0
+  80516c:	ff 74 24 1c          	push   0x1c(%esp)
+  805170:	ff 74 24 1c          	push   0x1c(%esp)
+  805174:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805178:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80517c:	e8 17 ff ff ff       	call   805098 <udivmod>
+  805181:	83 c4 14             	add    $0x14,%esp
+  805184:	c3                   	ret
+
+00805185 <__umoddi3>:
+  805185:	83 ec 18             	sub    $0x18,%esp
+  805188:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80518c:	50                   	push   %eax
+  80518d:	ff 74 24 2c          	push   0x2c(%esp)
+  805191:	ff 74 24 2c          	push   0x2c(%esp)
+  805195:	8b 44 24 28          	mov    0x28(%esp),%eax
+  805199:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80519d:	e8 f6 fe ff ff       	call   805098 <udivmod>
+  8051a2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8051a6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8051aa:	83 c4 24             	add    $0x24,%esp
+  8051ad:	c3                   	ret
+
+008051ae <__divdi3>:
+  8051ae:	55                   	push   %ebp
+  8051af:	57                   	push   %edi
+  8051b0:	56                   	push   %esi
+  8051b1:	53                   	push   %ebx
+  8051b2:	83 ec 10             	sub    $0x10,%esp
+  8051b5:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8051b9:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8051bd:	89 c6                	mov    %eax,%esi
+  8051bf:	89 d7                	mov    %edx,%edi
+  8051c1:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8051c5:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8051c9:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8051cd:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8051d1:	89 c5                	mov    %eax,%ebp
+  8051d3:	f7 dd                	neg    %ebp
+  8051d5:	89 d6                	mov    %edx,%esi
+  8051d7:	83 d6 00             	adc    $0x0,%esi
+  8051da:	f7 de                	neg    %esi
+  8051dc:	0f 48 e8             	cmovs  %eax,%ebp
+  8051df:	0f 49 d6             	cmovns %esi,%edx
+  8051e2:	6a 00                	push   $0x0
+  8051e4:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8051e8:	f7 de                	neg    %esi
+  8051ea:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8051ee:	83 d0 00             	adc    $0x0,%eax
+  8051f1:	f7 d8                	neg    %eax
+  8051f3:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  8051f8:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  8051fd:	50                   	push   %eax
+  8051fe:	56                   	push   %esi
+  8051ff:	89 e8                	mov    %ebp,%eax
+  805201:	e8 92 fe ff ff       	call   805098 <udivmod>
+  805206:	83 c4 10             	add    $0x10,%esp
+  805209:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  80520e:	78 08                	js     805218 <__divdi3+0x6a>
+  805210:	83 c4 0c             	add    $0xc,%esp
+  805213:	5b                   	pop    %ebx
+  805214:	5e                   	pop    %esi
+  805215:	5f                   	pop    %edi
+  805216:	5d                   	pop    %ebp
+  805217:	c3                   	ret
+  805218:	f7 d8                	neg    %eax
+  80521a:	83 d2 00             	adc    $0x0,%edx
+  80521d:	f7 da                	neg    %edx
+  80521f:	eb ef                	jmp    805210 <__divdi3+0x62>
+
+00805221 <__moddi3>:
+  805221:	55                   	push   %ebp
+  805222:	57                   	push   %edi
+  805223:	56                   	push   %esi
+  805224:	53                   	push   %ebx
+  805225:	83 ec 18             	sub    $0x18,%esp
+  805228:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80522c:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  805230:	89 f1                	mov    %esi,%ecx
+  805232:	f7 d9                	neg    %ecx
+  805234:	89 da                	mov    %ebx,%edx
+  805236:	83 d2 00             	adc    $0x0,%edx
+  805239:	f7 da                	neg    %edx
+  80523b:	0f 48 ce             	cmovs  %esi,%ecx
+  80523e:	0f 48 d3             	cmovs  %ebx,%edx
+  805241:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805245:	50                   	push   %eax
+  805246:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80524a:	f7 de                	neg    %esi
+  80524c:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  805250:	83 d0 00             	adc    $0x0,%eax
+  805253:	f7 d8                	neg    %eax
+  805255:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80525a:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  80525f:	50                   	push   %eax
+  805260:	56                   	push   %esi
+  805261:	89 c8                	mov    %ecx,%eax
+  805263:	e8 30 fe ff ff       	call   805098 <udivmod>
+  805268:	83 c4 10             	add    $0x10,%esp
+  80526b:	85 db                	test   %ebx,%ebx
+  80526d:	78 10                	js     80527f <__moddi3+0x5e>
+  80526f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805273:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805277:	83 c4 14             	add    $0x14,%esp
+  80527a:	5b                   	pop    %ebx
+  80527b:	5e                   	pop    %esi
+  80527c:	5f                   	pop    %edi
+  80527d:	5d                   	pop    %ebp
+  80527e:	c3                   	ret
+  80527f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805283:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805287:	f7 d8                	neg    %eax
+  805289:	83 d2 00             	adc    $0x0,%edx
+  80528c:	f7 da                	neg    %edx
+  80528e:	eb e7                	jmp    805277 <__moddi3+0x56>
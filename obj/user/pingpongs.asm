@@ -0,0 +1,10515 @@
+
+obj/user/pingpongs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 d2 00 00 00       	call   800103 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+uint32_t val;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t who;
+	uint32_t i;
+
+	i = 0;
+	if ((who = sfork()) != 0) {
+  80003c:	e8 c9 17 00 00       	call   80180a <sfork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 74                	jne    8000bc <umain+0x89>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+		ipc_send(who, 0, 0, 0);
+	}
+
+	while (1) {
+		ipc_recv(&who, 0, 0);
+  800048:	83 ec 04             	sub    $0x4,%esp
+  80004b:	6a 00                	push   $0x0
+  80004d:	6a 00                	push   $0x0
+  80004f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800052:	50                   	push   %eax
+  800053:	e8 56 18 00 00       	call   8018ae <ipc_recv>
+		cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  800058:	8b 1d 1c e9 80 00    	mov    0x80e91c,%ebx
+  80005e:	8b 7b 48             	mov    0x48(%ebx),%edi
+  800061:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800064:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  800069:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80006c:	e8 26 0c 00 00       	call   800c97 <sys_getenvid>
+  800071:	83 c4 08             	add    $0x8,%esp
+  800074:	57                   	push   %edi
+  800075:	53                   	push   %ebx
+  800076:	56                   	push   %esi
+  800077:	ff 75 d4             	push   -0x2c(%ebp)
+  80007a:	50                   	push   %eax
+  80007b:	68 10 53 80 00       	push   $0x805310
+  800080:	e8 76 01 00 00       	call   8001fb <cprintf>
+		if (val == 10)
+  800085:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  80008a:	83 c4 20             	add    $0x20,%esp
+  80008d:	83 f8 0a             	cmp    $0xa,%eax
+  800090:	74 22                	je     8000b4 <umain+0x81>
+			return;
+		++val;
+  800092:	83 c0 01             	add    $0x1,%eax
+  800095:	a3 14 e9 80 00       	mov    %eax,0x80e914
+		ipc_send(who, 0, 0, 0);
+  80009a:	6a 00                	push   $0x0
+  80009c:	6a 00                	push   $0x0
+  80009e:	6a 00                	push   $0x0
+  8000a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8000a3:	e8 ca 18 00 00       	call   801972 <ipc_send>
+		if (val == 10)
+  8000a8:	83 c4 10             	add    $0x10,%esp
+  8000ab:	83 3d 14 e9 80 00 0a 	cmpl   $0xa,0x80e914
+  8000b2:	75 94                	jne    800048 <umain+0x15>
+			return;
+	}
+
+}
+  8000b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000b7:	5b                   	pop    %ebx
+  8000b8:	5e                   	pop    %esi
+  8000b9:	5f                   	pop    %edi
+  8000ba:	5d                   	pop    %ebp
+  8000bb:	c3                   	ret
+		cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  8000bc:	8b 1d 1c e9 80 00    	mov    0x80e91c,%ebx
+  8000c2:	e8 d0 0b 00 00       	call   800c97 <sys_getenvid>
+  8000c7:	83 ec 04             	sub    $0x4,%esp
+  8000ca:	53                   	push   %ebx
+  8000cb:	50                   	push   %eax
+  8000cc:	68 e0 52 80 00       	push   $0x8052e0
+  8000d1:	e8 25 01 00 00       	call   8001fb <cprintf>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  8000d6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8000d9:	e8 b9 0b 00 00       	call   800c97 <sys_getenvid>
+  8000de:	83 c4 0c             	add    $0xc,%esp
+  8000e1:	53                   	push   %ebx
+  8000e2:	50                   	push   %eax
+  8000e3:	68 fa 52 80 00       	push   $0x8052fa
+  8000e8:	e8 0e 01 00 00       	call   8001fb <cprintf>
+		ipc_send(who, 0, 0, 0);
+  8000ed:	6a 00                	push   $0x0
+  8000ef:	6a 00                	push   $0x0
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000f6:	e8 77 18 00 00       	call   801972 <ipc_send>
+  8000fb:	83 c4 20             	add    $0x20,%esp
+  8000fe:	e9 45 ff ff ff       	jmp    800048 <umain+0x15>
+
+00800103 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800103:	55                   	push   %ebp
+  800104:	89 e5                	mov    %esp,%ebp
+  800106:	56                   	push   %esi
+  800107:	53                   	push   %ebx
+  800108:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80010b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  80010e:	e8 84 0b 00 00       	call   800c97 <sys_getenvid>
+  800113:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800118:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80011b:	c1 e0 06             	shl    $0x6,%eax
+  80011e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800123:	a3 1c e9 80 00       	mov    %eax,0x80e91c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800128:	85 db                	test   %ebx,%ebx
+  80012a:	7e 07                	jle    800133 <libmain+0x30>
+		binaryname = argv[0];
+  80012c:	8b 06                	mov    (%esi),%eax
+  80012e:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800133:	83 ec 08             	sub    $0x8,%esp
+  800136:	56                   	push   %esi
+  800137:	53                   	push   %ebx
+  800138:	e8 f6 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80013d:	e8 0a 00 00 00       	call   80014c <exit>
+}
+  800142:	83 c4 10             	add    $0x10,%esp
+  800145:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800148:	5b                   	pop    %ebx
+  800149:	5e                   	pop    %esi
+  80014a:	5d                   	pop    %ebp
+  80014b:	c3                   	ret
+
+0080014c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80014c:	55                   	push   %ebp
+  80014d:	89 e5                	mov    %esp,%ebp
+  80014f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800152:	e8 1a 1b 00 00       	call   801c71 <close_all>
+	sys_env_destroy(0);
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	6a 00                	push   $0x0
+  80015c:	e8 f5 0a 00 00       	call   800c56 <sys_env_destroy>
+}
+  800161:	83 c4 10             	add    $0x10,%esp
+  800164:	c9                   	leave
+  800165:	c3                   	ret
+
+00800166 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800166:	55                   	push   %ebp
+  800167:	89 e5                	mov    %esp,%ebp
+  800169:	53                   	push   %ebx
+  80016a:	83 ec 04             	sub    $0x4,%esp
+  80016d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800170:	8b 13                	mov    (%ebx),%edx
+  800172:	8d 42 01             	lea    0x1(%edx),%eax
+  800175:	89 03                	mov    %eax,(%ebx)
+  800177:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80017a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80017e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800183:	74 09                	je     80018e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800185:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800189:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80018c:	c9                   	leave
+  80018d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80018e:	83 ec 08             	sub    $0x8,%esp
+  800191:	68 ff 00 00 00       	push   $0xff
+  800196:	8d 43 08             	lea    0x8(%ebx),%eax
+  800199:	50                   	push   %eax
+  80019a:	e8 69 0a 00 00       	call   800c08 <sys_cputs>
+		b->idx = 0;
+  80019f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001a5:	83 c4 10             	add    $0x10,%esp
+  8001a8:	eb db                	jmp    800185 <putch+0x1f>
+
+008001aa <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001aa:	55                   	push   %ebp
+  8001ab:	89 e5                	mov    %esp,%ebp
+  8001ad:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001b3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001ba:	00 00 00 
+	b.cnt = 0;
+  8001bd:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001c4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001c7:	ff 75 0c             	push   0xc(%ebp)
+  8001ca:	ff 75 08             	push   0x8(%ebp)
+  8001cd:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001d3:	50                   	push   %eax
+  8001d4:	68 66 01 80 00       	push   $0x800166
+  8001d9:	e8 14 01 00 00       	call   8002f2 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001de:	83 c4 08             	add    $0x8,%esp
+  8001e1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001e7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001ed:	50                   	push   %eax
+  8001ee:	e8 15 0a 00 00       	call   800c08 <sys_cputs>
+
+	return b.cnt;
+}
+  8001f3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001f9:	c9                   	leave
+  8001fa:	c3                   	ret
+
+008001fb <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001fb:	55                   	push   %ebp
+  8001fc:	89 e5                	mov    %esp,%ebp
+  8001fe:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800201:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800204:	50                   	push   %eax
+  800205:	ff 75 08             	push   0x8(%ebp)
+  800208:	e8 9d ff ff ff       	call   8001aa <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80020d:	c9                   	leave
+  80020e:	c3                   	ret
+
+0080020f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80020f:	55                   	push   %ebp
+  800210:	89 e5                	mov    %esp,%ebp
+  800212:	57                   	push   %edi
+  800213:	56                   	push   %esi
+  800214:	53                   	push   %ebx
+  800215:	83 ec 1c             	sub    $0x1c,%esp
+  800218:	89 c7                	mov    %eax,%edi
+  80021a:	89 d6                	mov    %edx,%esi
+  80021c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80021f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800222:	89 d1                	mov    %edx,%ecx
+  800224:	89 c2                	mov    %eax,%edx
+  800226:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800229:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80022c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80022f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800232:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800235:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80023c:	39 c2                	cmp    %eax,%edx
+  80023e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800241:	72 3e                	jb     800281 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800243:	83 ec 0c             	sub    $0xc,%esp
+  800246:	ff 75 18             	push   0x18(%ebp)
+  800249:	83 eb 01             	sub    $0x1,%ebx
+  80024c:	53                   	push   %ebx
+  80024d:	50                   	push   %eax
+  80024e:	83 ec 08             	sub    $0x8,%esp
+  800251:	ff 75 e4             	push   -0x1c(%ebp)
+  800254:	ff 75 e0             	push   -0x20(%ebp)
+  800257:	ff 75 dc             	push   -0x24(%ebp)
+  80025a:	ff 75 d8             	push   -0x28(%ebp)
+  80025d:	e8 48 4f 00 00       	call   8051aa <__udivdi3>
+  800262:	83 c4 18             	add    $0x18,%esp
+  800265:	52                   	push   %edx
+  800266:	50                   	push   %eax
+  800267:	89 f2                	mov    %esi,%edx
+  800269:	89 f8                	mov    %edi,%eax
+  80026b:	e8 9f ff ff ff       	call   80020f <printnum>
+  800270:	83 c4 20             	add    $0x20,%esp
+  800273:	eb 13                	jmp    800288 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800275:	83 ec 08             	sub    $0x8,%esp
+  800278:	56                   	push   %esi
+  800279:	ff 75 18             	push   0x18(%ebp)
+  80027c:	ff d7                	call   *%edi
+  80027e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800281:	83 eb 01             	sub    $0x1,%ebx
+  800284:	85 db                	test   %ebx,%ebx
+  800286:	7f ed                	jg     800275 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800288:	83 ec 08             	sub    $0x8,%esp
+  80028b:	56                   	push   %esi
+  80028c:	83 ec 04             	sub    $0x4,%esp
+  80028f:	ff 75 e4             	push   -0x1c(%ebp)
+  800292:	ff 75 e0             	push   -0x20(%ebp)
+  800295:	ff 75 dc             	push   -0x24(%ebp)
+  800298:	ff 75 d8             	push   -0x28(%ebp)
+  80029b:	e8 28 4f 00 00       	call   8051c8 <__umoddi3>
+  8002a0:	83 c4 14             	add    $0x14,%esp
+  8002a3:	0f be 80 40 53 80 00 	movsbl 0x805340(%eax),%eax
+  8002aa:	50                   	push   %eax
+  8002ab:	ff d7                	call   *%edi
+}
+  8002ad:	83 c4 10             	add    $0x10,%esp
+  8002b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b3:	5b                   	pop    %ebx
+  8002b4:	5e                   	pop    %esi
+  8002b5:	5f                   	pop    %edi
+  8002b6:	5d                   	pop    %ebp
+  8002b7:	c3                   	ret
+
+008002b8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002b8:	55                   	push   %ebp
+  8002b9:	89 e5                	mov    %esp,%ebp
+  8002bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002be:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002c2:	8b 10                	mov    (%eax),%edx
+  8002c4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002c7:	73 0a                	jae    8002d3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002c9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002cc:	89 08                	mov    %ecx,(%eax)
+  8002ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d1:	88 02                	mov    %al,(%edx)
+}
+  8002d3:	5d                   	pop    %ebp
+  8002d4:	c3                   	ret
+
+008002d5 <printfmt>:
+{
+  8002d5:	55                   	push   %ebp
+  8002d6:	89 e5                	mov    %esp,%ebp
+  8002d8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002db:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002de:	50                   	push   %eax
+  8002df:	ff 75 10             	push   0x10(%ebp)
+  8002e2:	ff 75 0c             	push   0xc(%ebp)
+  8002e5:	ff 75 08             	push   0x8(%ebp)
+  8002e8:	e8 05 00 00 00       	call   8002f2 <vprintfmt>
+}
+  8002ed:	83 c4 10             	add    $0x10,%esp
+  8002f0:	c9                   	leave
+  8002f1:	c3                   	ret
+
+008002f2 <vprintfmt>:
+{
+  8002f2:	55                   	push   %ebp
+  8002f3:	89 e5                	mov    %esp,%ebp
+  8002f5:	57                   	push   %edi
+  8002f6:	56                   	push   %esi
+  8002f7:	53                   	push   %ebx
+  8002f8:	83 ec 2c             	sub    $0x2c,%esp
+  8002fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800301:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800304:	eb 0a                	jmp    800310 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800306:	83 ec 08             	sub    $0x8,%esp
+  800309:	53                   	push   %ebx
+  80030a:	50                   	push   %eax
+  80030b:	ff d6                	call   *%esi
+  80030d:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800310:	83 c7 01             	add    $0x1,%edi
+  800313:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800317:	83 f8 25             	cmp    $0x25,%eax
+  80031a:	74 0c                	je     800328 <vprintfmt+0x36>
+			if (ch == '\0')
+  80031c:	85 c0                	test   %eax,%eax
+  80031e:	75 e6                	jne    800306 <vprintfmt+0x14>
+}
+  800320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800323:	5b                   	pop    %ebx
+  800324:	5e                   	pop    %esi
+  800325:	5f                   	pop    %edi
+  800326:	5d                   	pop    %ebp
+  800327:	c3                   	ret
+		padc = ' ';
+  800328:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80032c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800333:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80033a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800341:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800346:	8d 47 01             	lea    0x1(%edi),%eax
+  800349:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80034c:	0f b6 17             	movzbl (%edi),%edx
+  80034f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800352:	3c 55                	cmp    $0x55,%al
+  800354:	0f 87 c5 03 00 00    	ja     80071f <vprintfmt+0x42d>
+  80035a:	0f b6 c0             	movzbl %al,%eax
+  80035d:	ff 24 85 c0 54 80 00 	jmp    *0x8054c0(,%eax,4)
+  800364:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800367:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80036b:	eb d9                	jmp    800346 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80036d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800370:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800374:	eb d0                	jmp    800346 <vprintfmt+0x54>
+  800376:	0f b6 d2             	movzbl %dl,%edx
+  800379:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80037c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800381:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800384:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800387:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80038b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80038e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800391:	83 f9 09             	cmp    $0x9,%ecx
+  800394:	77 55                	ja     8003eb <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800396:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800399:	eb e9                	jmp    800384 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80039b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039e:	8b 00                	mov    (%eax),%eax
+  8003a0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8003a9:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003af:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003b3:	79 91                	jns    800346 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003b5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003b8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003bb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003c2:	eb 82                	jmp    800346 <vprintfmt+0x54>
+			if (width < 0)
+  8003c4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003c7:	85 d2                	test   %edx,%edx
+  8003c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ce:	0f 49 c2             	cmovns %edx,%eax
+  8003d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003d7:	e9 6a ff ff ff       	jmp    800346 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003dc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003df:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003e6:	e9 5b ff ff ff       	jmp    800346 <vprintfmt+0x54>
+  8003eb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ee:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003f1:	eb bc                	jmp    8003af <vprintfmt+0xbd>
+			lflag++;
+  8003f3:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003f9:	e9 48 ff ff ff       	jmp    800346 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800401:	8d 78 04             	lea    0x4(%eax),%edi
+  800404:	83 ec 08             	sub    $0x8,%esp
+  800407:	53                   	push   %ebx
+  800408:	ff 30                	push   (%eax)
+  80040a:	ff d6                	call   *%esi
+			break;
+  80040c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80040f:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800412:	e9 63 02 00 00       	jmp    80067a <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800417:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041a:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80041d:	8b 10                	mov    (%eax),%edx
+  80041f:	89 d0                	mov    %edx,%eax
+  800421:	f7 d8                	neg    %eax
+  800423:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800426:	83 f8 12             	cmp    $0x12,%eax
+  800429:	7f 23                	jg     80044e <vprintfmt+0x15c>
+  80042b:	8b 14 85 20 56 80 00 	mov    0x805620(,%eax,4),%edx
+  800432:	85 d2                	test   %edx,%edx
+  800434:	74 18                	je     80044e <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800436:	52                   	push   %edx
+  800437:	68 85 58 80 00       	push   $0x805885
+  80043c:	53                   	push   %ebx
+  80043d:	56                   	push   %esi
+  80043e:	e8 92 fe ff ff       	call   8002d5 <printfmt>
+  800443:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800446:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800449:	e9 2c 02 00 00       	jmp    80067a <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80044e:	50                   	push   %eax
+  80044f:	68 58 53 80 00       	push   $0x805358
+  800454:	53                   	push   %ebx
+  800455:	56                   	push   %esi
+  800456:	e8 7a fe ff ff       	call   8002d5 <printfmt>
+  80045b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80045e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800461:	e9 14 02 00 00       	jmp    80067a <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800466:	8b 45 14             	mov    0x14(%ebp),%eax
+  800469:	83 c0 04             	add    $0x4,%eax
+  80046c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80046f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800472:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800474:	85 c9                	test   %ecx,%ecx
+  800476:	b8 51 53 80 00       	mov    $0x805351,%eax
+  80047b:	0f 45 c1             	cmovne %ecx,%eax
+  80047e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800481:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800485:	7e 06                	jle    80048d <vprintfmt+0x19b>
+  800487:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80048b:	75 0b                	jne    800498 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80048d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800490:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800493:	89 75 08             	mov    %esi,0x8(%ebp)
+  800496:	eb 5c                	jmp    8004f4 <vprintfmt+0x202>
+  800498:	83 ec 08             	sub    $0x8,%esp
+  80049b:	ff 75 d0             	push   -0x30(%ebp)
+  80049e:	ff 75 cc             	push   -0x34(%ebp)
+  8004a1:	e8 19 03 00 00       	call   8007bf <strnlen>
+  8004a6:	89 c2                	mov    %eax,%edx
+  8004a8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ab:	29 d0                	sub    %edx,%eax
+  8004ad:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004b0:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004b4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004b7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004ba:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004bc:	eb 0e                	jmp    8004cc <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004be:	83 ec 08             	sub    $0x8,%esp
+  8004c1:	53                   	push   %ebx
+  8004c2:	57                   	push   %edi
+  8004c3:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c6:	83 ee 01             	sub    $0x1,%esi
+  8004c9:	83 c4 10             	add    $0x10,%esp
+  8004cc:	85 f6                	test   %esi,%esi
+  8004ce:	7f ee                	jg     8004be <vprintfmt+0x1cc>
+  8004d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d6:	85 c0                	test   %eax,%eax
+  8004d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004dd:	0f 49 d0             	cmovns %eax,%edx
+  8004e0:	29 d0                	sub    %edx,%eax
+  8004e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e5:	eb a6                	jmp    80048d <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004e7:	83 ec 08             	sub    $0x8,%esp
+  8004ea:	53                   	push   %ebx
+  8004eb:	52                   	push   %edx
+  8004ec:	ff 55 08             	call   *0x8(%ebp)
+  8004ef:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004f2:	89 f1                	mov    %esi,%ecx
+  8004f4:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004f7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004fb:	0f be d0             	movsbl %al,%edx
+  8004fe:	85 d2                	test   %edx,%edx
+  800500:	74 28                	je     80052a <vprintfmt+0x238>
+  800502:	85 ff                	test   %edi,%edi
+  800504:	78 05                	js     80050b <vprintfmt+0x219>
+  800506:	83 ef 01             	sub    $0x1,%edi
+  800509:	78 30                	js     80053b <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80050b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80050f:	74 d6                	je     8004e7 <vprintfmt+0x1f5>
+  800511:	0f be c0             	movsbl %al,%eax
+  800514:	83 e8 20             	sub    $0x20,%eax
+  800517:	83 f8 5e             	cmp    $0x5e,%eax
+  80051a:	76 cb                	jbe    8004e7 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80051c:	83 ec 08             	sub    $0x8,%esp
+  80051f:	53                   	push   %ebx
+  800520:	6a 3f                	push   $0x3f
+  800522:	ff 55 08             	call   *0x8(%ebp)
+  800525:	83 c4 10             	add    $0x10,%esp
+  800528:	eb c8                	jmp    8004f2 <vprintfmt+0x200>
+  80052a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80052d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800530:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800533:	01 d0                	add    %edx,%eax
+  800535:	29 c8                	sub    %ecx,%eax
+  800537:	89 c7                	mov    %eax,%edi
+  800539:	eb 13                	jmp    80054e <vprintfmt+0x25c>
+  80053b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053e:	eb ed                	jmp    80052d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800540:	83 ec 08             	sub    $0x8,%esp
+  800543:	53                   	push   %ebx
+  800544:	6a 20                	push   $0x20
+  800546:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800548:	83 ef 01             	sub    $0x1,%edi
+  80054b:	83 c4 10             	add    $0x10,%esp
+  80054e:	85 ff                	test   %edi,%edi
+  800550:	7f ee                	jg     800540 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800552:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800555:	89 45 14             	mov    %eax,0x14(%ebp)
+  800558:	e9 1d 01 00 00       	jmp    80067a <vprintfmt+0x388>
+	if (lflag >= 2)
+  80055d:	83 f9 01             	cmp    $0x1,%ecx
+  800560:	7f 1b                	jg     80057d <vprintfmt+0x28b>
+	else if (lflag)
+  800562:	85 c9                	test   %ecx,%ecx
+  800564:	74 63                	je     8005c9 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800566:	8b 45 14             	mov    0x14(%ebp),%eax
+  800569:	8b 00                	mov    (%eax),%eax
+  80056b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80056e:	99                   	cltd
+  80056f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800572:	8b 45 14             	mov    0x14(%ebp),%eax
+  800575:	8d 40 04             	lea    0x4(%eax),%eax
+  800578:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057b:	eb 17                	jmp    800594 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80057d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800580:	8b 50 04             	mov    0x4(%eax),%edx
+  800583:	8b 00                	mov    (%eax),%eax
+  800585:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800588:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80058b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058e:	8d 40 08             	lea    0x8(%eax),%eax
+  800591:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800594:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800597:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80059a:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80059f:	85 c9                	test   %ecx,%ecx
+  8005a1:	0f 89 b9 00 00 00    	jns    800660 <vprintfmt+0x36e>
+				putch('-', putdat);
+  8005a7:	83 ec 08             	sub    $0x8,%esp
+  8005aa:	53                   	push   %ebx
+  8005ab:	6a 2d                	push   $0x2d
+  8005ad:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005af:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005b2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005b5:	f7 da                	neg    %edx
+  8005b7:	83 d1 00             	adc    $0x0,%ecx
+  8005ba:	f7 d9                	neg    %ecx
+  8005bc:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005bf:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005c4:	e9 97 00 00 00       	jmp    800660 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8005c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cc:	8b 00                	mov    (%eax),%eax
+  8005ce:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005d1:	99                   	cltd
+  8005d2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005db:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005de:	eb b4                	jmp    800594 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8005e0:	83 f9 01             	cmp    $0x1,%ecx
+  8005e3:	7f 1b                	jg     800600 <vprintfmt+0x30e>
+	else if (lflag)
+  8005e5:	85 c9                	test   %ecx,%ecx
+  8005e7:	74 2c                	je     800615 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8005e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ec:	8b 10                	mov    (%eax),%edx
+  8005ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005fe:	eb 60                	jmp    800660 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800600:	8b 45 14             	mov    0x14(%ebp),%eax
+  800603:	8b 10                	mov    (%eax),%edx
+  800605:	8b 48 04             	mov    0x4(%eax),%ecx
+  800608:	8d 40 08             	lea    0x8(%eax),%eax
+  80060b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80060e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800613:	eb 4b                	jmp    800660 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800615:	8b 45 14             	mov    0x14(%ebp),%eax
+  800618:	8b 10                	mov    (%eax),%edx
+  80061a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80061f:	8d 40 04             	lea    0x4(%eax),%eax
+  800622:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800625:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80062a:	eb 34                	jmp    800660 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80062c:	83 f9 01             	cmp    $0x1,%ecx
+  80062f:	7f 15                	jg     800646 <vprintfmt+0x354>
+	else if (lflag)
+  800631:	85 c9                	test   %ecx,%ecx
+  800633:	74 4d                	je     800682 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800635:	8b 45 14             	mov    0x14(%ebp),%eax
+  800638:	8b 00                	mov    (%eax),%eax
+  80063a:	99                   	cltd
+  80063b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80063e:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800641:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800644:	eb 11                	jmp    800657 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800646:	8b 45 14             	mov    0x14(%ebp),%eax
+  800649:	8b 50 04             	mov    0x4(%eax),%edx
+  80064c:	8b 00                	mov    (%eax),%eax
+  80064e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800651:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800654:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800657:	89 d1                	mov    %edx,%ecx
+  800659:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  80065b:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800660:	83 ec 0c             	sub    $0xc,%esp
+  800663:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800667:	50                   	push   %eax
+  800668:	ff 75 e0             	push   -0x20(%ebp)
+  80066b:	57                   	push   %edi
+  80066c:	51                   	push   %ecx
+  80066d:	52                   	push   %edx
+  80066e:	89 da                	mov    %ebx,%edx
+  800670:	89 f0                	mov    %esi,%eax
+  800672:	e8 98 fb ff ff       	call   80020f <printnum>
+			break;
+  800677:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80067a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80067d:	e9 8e fc ff ff       	jmp    800310 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800682:	8b 45 14             	mov    0x14(%ebp),%eax
+  800685:	8b 00                	mov    (%eax),%eax
+  800687:	99                   	cltd
+  800688:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80068b:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80068e:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800691:	eb c4                	jmp    800657 <vprintfmt+0x365>
+			putch('0', putdat);
+  800693:	83 ec 08             	sub    $0x8,%esp
+  800696:	53                   	push   %ebx
+  800697:	6a 30                	push   $0x30
+  800699:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80069b:	83 c4 08             	add    $0x8,%esp
+  80069e:	53                   	push   %ebx
+  80069f:	6a 78                	push   $0x78
+  8006a1:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a6:	8b 10                	mov    (%eax),%edx
+  8006a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006ad:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b6:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8006bb:	eb a3                	jmp    800660 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8006bd:	83 f9 01             	cmp    $0x1,%ecx
+  8006c0:	7f 1b                	jg     8006dd <vprintfmt+0x3eb>
+	else if (lflag)
+  8006c2:	85 c9                	test   %ecx,%ecx
+  8006c4:	74 2f                	je     8006f5 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8006c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c9:	8b 10                	mov    (%eax),%edx
+  8006cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006db:	eb 83                	jmp    800660 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8006dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e0:	8b 10                	mov    (%eax),%edx
+  8006e2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006e5:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006eb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006f0:	e9 6b ff ff ff       	jmp    800660 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8006f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f8:	8b 10                	mov    (%eax),%edx
+  8006fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800702:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800705:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80070a:	e9 51 ff ff ff       	jmp    800660 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  80070f:	83 ec 08             	sub    $0x8,%esp
+  800712:	53                   	push   %ebx
+  800713:	6a 25                	push   $0x25
+  800715:	ff d6                	call   *%esi
+			break;
+  800717:	83 c4 10             	add    $0x10,%esp
+  80071a:	e9 5b ff ff ff       	jmp    80067a <vprintfmt+0x388>
+			putch('%', putdat);
+  80071f:	83 ec 08             	sub    $0x8,%esp
+  800722:	53                   	push   %ebx
+  800723:	6a 25                	push   $0x25
+  800725:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800727:	83 c4 10             	add    $0x10,%esp
+  80072a:	89 f8                	mov    %edi,%eax
+  80072c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800730:	74 05                	je     800737 <vprintfmt+0x445>
+  800732:	83 e8 01             	sub    $0x1,%eax
+  800735:	eb f5                	jmp    80072c <vprintfmt+0x43a>
+  800737:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80073a:	e9 3b ff ff ff       	jmp    80067a <vprintfmt+0x388>
+
+0080073f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80073f:	55                   	push   %ebp
+  800740:	89 e5                	mov    %esp,%ebp
+  800742:	83 ec 18             	sub    $0x18,%esp
+  800745:	8b 45 08             	mov    0x8(%ebp),%eax
+  800748:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80074b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80074e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800752:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800755:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80075c:	85 c0                	test   %eax,%eax
+  80075e:	74 26                	je     800786 <vsnprintf+0x47>
+  800760:	85 d2                	test   %edx,%edx
+  800762:	7e 22                	jle    800786 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800764:	ff 75 14             	push   0x14(%ebp)
+  800767:	ff 75 10             	push   0x10(%ebp)
+  80076a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80076d:	50                   	push   %eax
+  80076e:	68 b8 02 80 00       	push   $0x8002b8
+  800773:	e8 7a fb ff ff       	call   8002f2 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800778:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80077b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80077e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800781:	83 c4 10             	add    $0x10,%esp
+}
+  800784:	c9                   	leave
+  800785:	c3                   	ret
+		return -E_INVAL;
+  800786:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80078b:	eb f7                	jmp    800784 <vsnprintf+0x45>
+
+0080078d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80078d:	55                   	push   %ebp
+  80078e:	89 e5                	mov    %esp,%ebp
+  800790:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800793:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800796:	50                   	push   %eax
+  800797:	ff 75 10             	push   0x10(%ebp)
+  80079a:	ff 75 0c             	push   0xc(%ebp)
+  80079d:	ff 75 08             	push   0x8(%ebp)
+  8007a0:	e8 9a ff ff ff       	call   80073f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007a5:	c9                   	leave
+  8007a6:	c3                   	ret
+
+008007a7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007a7:	55                   	push   %ebp
+  8007a8:	89 e5                	mov    %esp,%ebp
+  8007aa:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b2:	eb 03                	jmp    8007b7 <strlen+0x10>
+		n++;
+  8007b4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007b7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007bb:	75 f7                	jne    8007b4 <strlen+0xd>
+	return n;
+}
+  8007bd:	5d                   	pop    %ebp
+  8007be:	c3                   	ret
+
+008007bf <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007bf:	55                   	push   %ebp
+  8007c0:	89 e5                	mov    %esp,%ebp
+  8007c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007cd:	eb 03                	jmp    8007d2 <strnlen+0x13>
+		n++;
+  8007cf:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007d2:	39 d0                	cmp    %edx,%eax
+  8007d4:	74 08                	je     8007de <strnlen+0x1f>
+  8007d6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007da:	75 f3                	jne    8007cf <strnlen+0x10>
+  8007dc:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007de:	89 d0                	mov    %edx,%eax
+  8007e0:	5d                   	pop    %ebp
+  8007e1:	c3                   	ret
+
+008007e2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007e2:	55                   	push   %ebp
+  8007e3:	89 e5                	mov    %esp,%ebp
+  8007e5:	53                   	push   %ebx
+  8007e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007f5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007f8:	83 c0 01             	add    $0x1,%eax
+  8007fb:	84 d2                	test   %dl,%dl
+  8007fd:	75 f2                	jne    8007f1 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007ff:	89 c8                	mov    %ecx,%eax
+  800801:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800804:	c9                   	leave
+  800805:	c3                   	ret
+
+00800806 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800806:	55                   	push   %ebp
+  800807:	89 e5                	mov    %esp,%ebp
+  800809:	53                   	push   %ebx
+  80080a:	83 ec 10             	sub    $0x10,%esp
+  80080d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800810:	53                   	push   %ebx
+  800811:	e8 91 ff ff ff       	call   8007a7 <strlen>
+  800816:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800819:	ff 75 0c             	push   0xc(%ebp)
+  80081c:	01 d8                	add    %ebx,%eax
+  80081e:	50                   	push   %eax
+  80081f:	e8 be ff ff ff       	call   8007e2 <strcpy>
+	return dst;
+}
+  800824:	89 d8                	mov    %ebx,%eax
+  800826:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800829:	c9                   	leave
+  80082a:	c3                   	ret
+
+0080082b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80082b:	55                   	push   %ebp
+  80082c:	89 e5                	mov    %esp,%ebp
+  80082e:	56                   	push   %esi
+  80082f:	53                   	push   %ebx
+  800830:	8b 75 08             	mov    0x8(%ebp),%esi
+  800833:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800836:	89 f3                	mov    %esi,%ebx
+  800838:	03 5d 10             	add    0x10(%ebp),%ebx
+  80083b:	89 f0                	mov    %esi,%eax
+  80083d:	eb 0f                	jmp    80084e <strncpy+0x23>
+		*dst++ = *src;
+  80083f:	83 c0 01             	add    $0x1,%eax
+  800842:	0f b6 0a             	movzbl (%edx),%ecx
+  800845:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800848:	80 f9 01             	cmp    $0x1,%cl
+  80084b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80084e:	39 d8                	cmp    %ebx,%eax
+  800850:	75 ed                	jne    80083f <strncpy+0x14>
+	}
+	return ret;
+}
+  800852:	89 f0                	mov    %esi,%eax
+  800854:	5b                   	pop    %ebx
+  800855:	5e                   	pop    %esi
+  800856:	5d                   	pop    %ebp
+  800857:	c3                   	ret
+
+00800858 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800858:	55                   	push   %ebp
+  800859:	89 e5                	mov    %esp,%ebp
+  80085b:	56                   	push   %esi
+  80085c:	53                   	push   %ebx
+  80085d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800860:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800863:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800866:	89 f0                	mov    %esi,%eax
+  800868:	85 d2                	test   %edx,%edx
+  80086a:	74 21                	je     80088d <strlcpy+0x35>
+  80086c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800870:	89 f2                	mov    %esi,%edx
+  800872:	eb 09                	jmp    80087d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800874:	83 c1 01             	add    $0x1,%ecx
+  800877:	83 c2 01             	add    $0x1,%edx
+  80087a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80087d:	39 c2                	cmp    %eax,%edx
+  80087f:	74 09                	je     80088a <strlcpy+0x32>
+  800881:	0f b6 19             	movzbl (%ecx),%ebx
+  800884:	84 db                	test   %bl,%bl
+  800886:	75 ec                	jne    800874 <strlcpy+0x1c>
+  800888:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80088a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80088d:	29 f0                	sub    %esi,%eax
+}
+  80088f:	5b                   	pop    %ebx
+  800890:	5e                   	pop    %esi
+  800891:	5d                   	pop    %ebp
+  800892:	c3                   	ret
+
+00800893 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800893:	55                   	push   %ebp
+  800894:	89 e5                	mov    %esp,%ebp
+  800896:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800899:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80089c:	eb 06                	jmp    8008a4 <strcmp+0x11>
+		p++, q++;
+  80089e:	83 c1 01             	add    $0x1,%ecx
+  8008a1:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008a4:	0f b6 01             	movzbl (%ecx),%eax
+  8008a7:	84 c0                	test   %al,%al
+  8008a9:	74 04                	je     8008af <strcmp+0x1c>
+  8008ab:	3a 02                	cmp    (%edx),%al
+  8008ad:	74 ef                	je     80089e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008af:	0f b6 c0             	movzbl %al,%eax
+  8008b2:	0f b6 12             	movzbl (%edx),%edx
+  8008b5:	29 d0                	sub    %edx,%eax
+}
+  8008b7:	5d                   	pop    %ebp
+  8008b8:	c3                   	ret
+
+008008b9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008b9:	55                   	push   %ebp
+  8008ba:	89 e5                	mov    %esp,%ebp
+  8008bc:	53                   	push   %ebx
+  8008bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008c3:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008c6:	eb 09                	jmp    8008d1 <strncmp+0x18>
+		n--, p++, q++;
+  8008c8:	83 ea 01             	sub    $0x1,%edx
+  8008cb:	83 c0 01             	add    $0x1,%eax
+  8008ce:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008d1:	85 d2                	test   %edx,%edx
+  8008d3:	74 18                	je     8008ed <strncmp+0x34>
+  8008d5:	0f b6 18             	movzbl (%eax),%ebx
+  8008d8:	84 db                	test   %bl,%bl
+  8008da:	74 04                	je     8008e0 <strncmp+0x27>
+  8008dc:	3a 19                	cmp    (%ecx),%bl
+  8008de:	74 e8                	je     8008c8 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008e0:	0f b6 00             	movzbl (%eax),%eax
+  8008e3:	0f b6 11             	movzbl (%ecx),%edx
+  8008e6:	29 d0                	sub    %edx,%eax
+}
+  8008e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008eb:	c9                   	leave
+  8008ec:	c3                   	ret
+		return 0;
+  8008ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f2:	eb f4                	jmp    8008e8 <strncmp+0x2f>
+
+008008f4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008f4:	55                   	push   %ebp
+  8008f5:	89 e5                	mov    %esp,%ebp
+  8008f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008fa:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008fe:	eb 03                	jmp    800903 <strchr+0xf>
+  800900:	83 c0 01             	add    $0x1,%eax
+  800903:	0f b6 10             	movzbl (%eax),%edx
+  800906:	84 d2                	test   %dl,%dl
+  800908:	74 06                	je     800910 <strchr+0x1c>
+		if (*s == c)
+  80090a:	38 ca                	cmp    %cl,%dl
+  80090c:	75 f2                	jne    800900 <strchr+0xc>
+  80090e:	eb 05                	jmp    800915 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800910:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800915:	5d                   	pop    %ebp
+  800916:	c3                   	ret
+
+00800917 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800917:	55                   	push   %ebp
+  800918:	89 e5                	mov    %esp,%ebp
+  80091a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80091d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800921:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800924:	38 ca                	cmp    %cl,%dl
+  800926:	74 09                	je     800931 <strfind+0x1a>
+  800928:	84 d2                	test   %dl,%dl
+  80092a:	74 05                	je     800931 <strfind+0x1a>
+	for (; *s; s++)
+  80092c:	83 c0 01             	add    $0x1,%eax
+  80092f:	eb f0                	jmp    800921 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800931:	5d                   	pop    %ebp
+  800932:	c3                   	ret
+
+00800933 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800933:	55                   	push   %ebp
+  800934:	89 e5                	mov    %esp,%ebp
+  800936:	57                   	push   %edi
+  800937:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80093a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80093d:	85 c9                	test   %ecx,%ecx
+  80093f:	74 20                	je     800961 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800941:	89 f8                	mov    %edi,%eax
+  800943:	09 c8                	or     %ecx,%eax
+  800945:	a8 03                	test   $0x3,%al
+  800947:	75 12                	jne    80095b <memset+0x28>
+		c &= 0xFF;
+  800949:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80094d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800953:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800956:	fc                   	cld
+  800957:	f3 ab                	rep stos %eax,%es:(%edi)
+  800959:	eb 06                	jmp    800961 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80095b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80095e:	fc                   	cld
+  80095f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800961:	89 f8                	mov    %edi,%eax
+  800963:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800966:	c9                   	leave
+  800967:	c3                   	ret
+
+00800968 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800968:	55                   	push   %ebp
+  800969:	89 e5                	mov    %esp,%ebp
+  80096b:	57                   	push   %edi
+  80096c:	56                   	push   %esi
+  80096d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800970:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800973:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800976:	39 c6                	cmp    %eax,%esi
+  800978:	73 32                	jae    8009ac <memmove+0x44>
+  80097a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80097d:	39 d0                	cmp    %edx,%eax
+  80097f:	73 2b                	jae    8009ac <memmove+0x44>
+		s += n;
+		d += n;
+  800981:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800984:	89 d6                	mov    %edx,%esi
+  800986:	09 fe                	or     %edi,%esi
+  800988:	09 ce                	or     %ecx,%esi
+  80098a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800990:	75 0e                	jne    8009a0 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800992:	83 ef 04             	sub    $0x4,%edi
+  800995:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800998:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80099b:	fd                   	std
+  80099c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80099e:	eb 09                	jmp    8009a9 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009a0:	83 ef 01             	sub    $0x1,%edi
+  8009a3:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009a6:	fd                   	std
+  8009a7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009a9:	fc                   	cld
+  8009aa:	eb 1a                	jmp    8009c6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ac:	89 f2                	mov    %esi,%edx
+  8009ae:	09 c2                	or     %eax,%edx
+  8009b0:	09 ca                	or     %ecx,%edx
+  8009b2:	f6 c2 03             	test   $0x3,%dl
+  8009b5:	75 0a                	jne    8009c1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009b7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009ba:	89 c7                	mov    %eax,%edi
+  8009bc:	fc                   	cld
+  8009bd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009bf:	eb 05                	jmp    8009c6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009c1:	89 c7                	mov    %eax,%edi
+  8009c3:	fc                   	cld
+  8009c4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009c6:	5e                   	pop    %esi
+  8009c7:	5f                   	pop    %edi
+  8009c8:	5d                   	pop    %ebp
+  8009c9:	c3                   	ret
+
+008009ca <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009ca:	55                   	push   %ebp
+  8009cb:	89 e5                	mov    %esp,%ebp
+  8009cd:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009d0:	ff 75 10             	push   0x10(%ebp)
+  8009d3:	ff 75 0c             	push   0xc(%ebp)
+  8009d6:	ff 75 08             	push   0x8(%ebp)
+  8009d9:	e8 8a ff ff ff       	call   800968 <memmove>
+}
+  8009de:	c9                   	leave
+  8009df:	c3                   	ret
+
+008009e0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009e0:	55                   	push   %ebp
+  8009e1:	89 e5                	mov    %esp,%ebp
+  8009e3:	56                   	push   %esi
+  8009e4:	53                   	push   %ebx
+  8009e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009eb:	89 c6                	mov    %eax,%esi
+  8009ed:	03 75 10             	add    0x10(%ebp),%esi
+  8009f0:	eb 06                	jmp    8009f8 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009f2:	83 c0 01             	add    $0x1,%eax
+  8009f5:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009f8:	39 f0                	cmp    %esi,%eax
+  8009fa:	74 14                	je     800a10 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009fc:	0f b6 08             	movzbl (%eax),%ecx
+  8009ff:	0f b6 1a             	movzbl (%edx),%ebx
+  800a02:	38 d9                	cmp    %bl,%cl
+  800a04:	74 ec                	je     8009f2 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a06:	0f b6 c1             	movzbl %cl,%eax
+  800a09:	0f b6 db             	movzbl %bl,%ebx
+  800a0c:	29 d8                	sub    %ebx,%eax
+  800a0e:	eb 05                	jmp    800a15 <memcmp+0x35>
+	}
+
+	return 0;
+  800a10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a15:	5b                   	pop    %ebx
+  800a16:	5e                   	pop    %esi
+  800a17:	5d                   	pop    %ebp
+  800a18:	c3                   	ret
+
+00800a19 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a19:	55                   	push   %ebp
+  800a1a:	89 e5                	mov    %esp,%ebp
+  800a1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a22:	89 c2                	mov    %eax,%edx
+  800a24:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a27:	eb 03                	jmp    800a2c <memfind+0x13>
+  800a29:	83 c0 01             	add    $0x1,%eax
+  800a2c:	39 d0                	cmp    %edx,%eax
+  800a2e:	73 04                	jae    800a34 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a30:	38 08                	cmp    %cl,(%eax)
+  800a32:	75 f5                	jne    800a29 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a34:	5d                   	pop    %ebp
+  800a35:	c3                   	ret
+
+00800a36 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a36:	55                   	push   %ebp
+  800a37:	89 e5                	mov    %esp,%ebp
+  800a39:	57                   	push   %edi
+  800a3a:	56                   	push   %esi
+  800a3b:	53                   	push   %ebx
+  800a3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a42:	eb 03                	jmp    800a47 <strtol+0x11>
+		s++;
+  800a44:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a47:	0f b6 02             	movzbl (%edx),%eax
+  800a4a:	3c 20                	cmp    $0x20,%al
+  800a4c:	74 f6                	je     800a44 <strtol+0xe>
+  800a4e:	3c 09                	cmp    $0x9,%al
+  800a50:	74 f2                	je     800a44 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a52:	3c 2b                	cmp    $0x2b,%al
+  800a54:	74 2a                	je     800a80 <strtol+0x4a>
+	int neg = 0;
+  800a56:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a5b:	3c 2d                	cmp    $0x2d,%al
+  800a5d:	74 2b                	je     800a8a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a5f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a65:	75 0f                	jne    800a76 <strtol+0x40>
+  800a67:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a6a:	74 28                	je     800a94 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a6c:	85 db                	test   %ebx,%ebx
+  800a6e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a73:	0f 44 d8             	cmove  %eax,%ebx
+  800a76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a7b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a7e:	eb 46                	jmp    800ac6 <strtol+0x90>
+		s++;
+  800a80:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a83:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a88:	eb d5                	jmp    800a5f <strtol+0x29>
+		s++, neg = 1;
+  800a8a:	83 c2 01             	add    $0x1,%edx
+  800a8d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a92:	eb cb                	jmp    800a5f <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a94:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a98:	74 0e                	je     800aa8 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a9a:	85 db                	test   %ebx,%ebx
+  800a9c:	75 d8                	jne    800a76 <strtol+0x40>
+		s++, base = 8;
+  800a9e:	83 c2 01             	add    $0x1,%edx
+  800aa1:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800aa6:	eb ce                	jmp    800a76 <strtol+0x40>
+		s += 2, base = 16;
+  800aa8:	83 c2 02             	add    $0x2,%edx
+  800aab:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ab0:	eb c4                	jmp    800a76 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ab2:	0f be c0             	movsbl %al,%eax
+  800ab5:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ab8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800abb:	7d 3a                	jge    800af7 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800abd:	83 c2 01             	add    $0x1,%edx
+  800ac0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ac4:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ac6:	0f b6 02             	movzbl (%edx),%eax
+  800ac9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800acc:	89 f3                	mov    %esi,%ebx
+  800ace:	80 fb 09             	cmp    $0x9,%bl
+  800ad1:	76 df                	jbe    800ab2 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ad3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ad6:	89 f3                	mov    %esi,%ebx
+  800ad8:	80 fb 19             	cmp    $0x19,%bl
+  800adb:	77 08                	ja     800ae5 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800add:	0f be c0             	movsbl %al,%eax
+  800ae0:	83 e8 57             	sub    $0x57,%eax
+  800ae3:	eb d3                	jmp    800ab8 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ae5:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ae8:	89 f3                	mov    %esi,%ebx
+  800aea:	80 fb 19             	cmp    $0x19,%bl
+  800aed:	77 08                	ja     800af7 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800aef:	0f be c0             	movsbl %al,%eax
+  800af2:	83 e8 37             	sub    $0x37,%eax
+  800af5:	eb c1                	jmp    800ab8 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800af7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800afb:	74 05                	je     800b02 <strtol+0xcc>
+		*endptr = (char *) s;
+  800afd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b00:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b02:	89 c8                	mov    %ecx,%eax
+  800b04:	f7 d8                	neg    %eax
+  800b06:	85 ff                	test   %edi,%edi
+  800b08:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b0b:	89 c8                	mov    %ecx,%eax
+  800b0d:	5b                   	pop    %ebx
+  800b0e:	5e                   	pop    %esi
+  800b0f:	5f                   	pop    %edi
+  800b10:	5d                   	pop    %ebp
+  800b11:	c3                   	ret
+
+00800b12 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800b12:	55                   	push   %ebp
+  800b13:	89 e5                	mov    %esp,%ebp
+  800b15:	57                   	push   %edi
+  800b16:	56                   	push   %esi
+  800b17:	53                   	push   %ebx
+  800b18:	83 ec 0c             	sub    $0xc,%esp
+  800b1b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b1e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b21:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800b24:	85 ff                	test   %edi,%edi
+  800b26:	74 16                	je     800b3e <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800b28:	83 ec 04             	sub    $0x4,%esp
+  800b2b:	56                   	push   %esi
+  800b2c:	6a 00                	push   $0x0
+  800b2e:	53                   	push   %ebx
+  800b2f:	e8 02 ff ff ff       	call   800a36 <strtol>
+  800b34:	89 07                	mov    %eax,(%edi)
+  800b36:	83 c4 10             	add    $0x10,%esp
+  800b39:	eb 03                	jmp    800b3e <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800b3b:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800b3e:	0f b6 03             	movzbl (%ebx),%eax
+  800b41:	3c 20                	cmp    $0x20,%al
+  800b43:	74 f6                	je     800b3b <strisl+0x29>
+  800b45:	3c 09                	cmp    $0x9,%al
+  800b47:	74 f2                	je     800b3b <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b49:	3c 2b                	cmp    $0x2b,%al
+  800b4b:	74 23                	je     800b70 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800b4d:	3c 2d                	cmp    $0x2d,%al
+  800b4f:	0f 94 c0             	sete   %al
+  800b52:	0f b6 c0             	movzbl %al,%eax
+  800b55:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b57:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800b5d:	75 41                	jne    800ba0 <strisl+0x8e>
+  800b5f:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800b62:	74 11                	je     800b75 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b64:	85 f6                	test   %esi,%esi
+  800b66:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b6b:	0f 44 f0             	cmove  %eax,%esi
+  800b6e:	eb 30                	jmp    800ba0 <strisl+0x8e>
+		s++;
+  800b70:	83 c3 01             	add    $0x1,%ebx
+  800b73:	eb e2                	jmp    800b57 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b75:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800b79:	74 0e                	je     800b89 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800b7b:	85 f6                	test   %esi,%esi
+  800b7d:	75 21                	jne    800ba0 <strisl+0x8e>
+		s++, base = 8;
+  800b7f:	83 c3 01             	add    $0x1,%ebx
+  800b82:	be 08 00 00 00       	mov    $0x8,%esi
+  800b87:	eb 17                	jmp    800ba0 <strisl+0x8e>
+		s += 2, base = 16;
+  800b89:	83 c3 02             	add    $0x2,%ebx
+  800b8c:	be 10 00 00 00       	mov    $0x10,%esi
+  800b91:	eb 0d                	jmp    800ba0 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b93:	0f be c0             	movsbl %al,%eax
+  800b96:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800b99:	39 f0                	cmp    %esi,%eax
+  800b9b:	7d 38                	jge    800bd5 <strisl+0xc3>
+			return 0;
+		s++;
+  800b9d:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800ba0:	0f b6 03             	movzbl (%ebx),%eax
+  800ba3:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800ba6:	80 fa 09             	cmp    $0x9,%dl
+  800ba9:	76 e8                	jbe    800b93 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800bab:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800bae:	80 fa 19             	cmp    $0x19,%dl
+  800bb1:	77 08                	ja     800bbb <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800bb3:	0f be c0             	movsbl %al,%eax
+  800bb6:	83 e8 57             	sub    $0x57,%eax
+  800bb9:	eb de                	jmp    800b99 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bbb:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800bbe:	80 fa 19             	cmp    $0x19,%dl
+  800bc1:	77 08                	ja     800bcb <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800bc3:	0f be c0             	movsbl %al,%eax
+  800bc6:	83 e8 37             	sub    $0x37,%eax
+  800bc9:	eb ce                	jmp    800b99 <strisl+0x87>
+		else if (!*s)
+  800bcb:	84 c0                	test   %al,%al
+  800bcd:	0f 94 c0             	sete   %al
+  800bd0:	0f b6 c0             	movzbl %al,%eax
+  800bd3:	eb 05                	jmp    800bda <strisl+0xc8>
+			return 0;
+  800bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800bda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bdd:	5b                   	pop    %ebx
+  800bde:	5e                   	pop    %esi
+  800bdf:	5f                   	pop    %edi
+  800be0:	5d                   	pop    %ebp
+  800be1:	c3                   	ret
+
+00800be2 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800be2:	55                   	push   %ebp
+  800be3:	89 e5                	mov    %esp,%ebp
+  800be5:	83 ec 10             	sub    $0x10,%esp
+  800be8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800beb:	89 c8                	mov    %ecx,%eax
+  800bed:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800bf2:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800bf5:	eb 0b                	jmp    800c02 <touch_mem+0x20>
+		c = *(char *)page;
+  800bf7:	0f b6 10             	movzbl (%eax),%edx
+  800bfa:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800bfd:	05 00 10 00 00       	add    $0x1000,%eax
+  800c02:	39 c8                	cmp    %ecx,%eax
+  800c04:	72 f1                	jb     800bf7 <touch_mem+0x15>
+}
+  800c06:	c9                   	leave
+  800c07:	c3                   	ret
+
+00800c08 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c08:	55                   	push   %ebp
+  800c09:	89 e5                	mov    %esp,%ebp
+  800c0b:	57                   	push   %edi
+  800c0c:	56                   	push   %esi
+  800c0d:	53                   	push   %ebx
+	touch_mem(s, len);
+  800c0e:	ff 75 0c             	push   0xc(%ebp)
+  800c11:	ff 75 08             	push   0x8(%ebp)
+  800c14:	e8 c9 ff ff ff       	call   800be2 <touch_mem>
+	asm volatile("int %1\n"
+  800c19:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c24:	89 c3                	mov    %eax,%ebx
+  800c26:	89 c7                	mov    %eax,%edi
+  800c28:	89 c6                	mov    %eax,%esi
+  800c2a:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c2c:	83 c4 08             	add    $0x8,%esp
+  800c2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c32:	5b                   	pop    %ebx
+  800c33:	5e                   	pop    %esi
+  800c34:	5f                   	pop    %edi
+  800c35:	5d                   	pop    %ebp
+  800c36:	c3                   	ret
+
+00800c37 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c37:	55                   	push   %ebp
+  800c38:	89 e5                	mov    %esp,%ebp
+  800c3a:	57                   	push   %edi
+  800c3b:	56                   	push   %esi
+  800c3c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c42:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c47:	89 d1                	mov    %edx,%ecx
+  800c49:	89 d3                	mov    %edx,%ebx
+  800c4b:	89 d7                	mov    %edx,%edi
+  800c4d:	89 d6                	mov    %edx,%esi
+  800c4f:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c51:	5b                   	pop    %ebx
+  800c52:	5e                   	pop    %esi
+  800c53:	5f                   	pop    %edi
+  800c54:	5d                   	pop    %ebp
+  800c55:	c3                   	ret
+
+00800c56 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c56:	55                   	push   %ebp
+  800c57:	89 e5                	mov    %esp,%ebp
+  800c59:	57                   	push   %edi
+  800c5a:	56                   	push   %esi
+  800c5b:	53                   	push   %ebx
+  800c5c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c67:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c6c:	89 cb                	mov    %ecx,%ebx
+  800c6e:	89 cf                	mov    %ecx,%edi
+  800c70:	89 ce                	mov    %ecx,%esi
+  800c72:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c74:	85 c0                	test   %eax,%eax
+  800c76:	7f 08                	jg     800c80 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c7b:	5b                   	pop    %ebx
+  800c7c:	5e                   	pop    %esi
+  800c7d:	5f                   	pop    %edi
+  800c7e:	5d                   	pop    %ebp
+  800c7f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c80:	83 ec 0c             	sub    $0xc,%esp
+  800c83:	50                   	push   %eax
+  800c84:	6a 03                	push   $0x3
+  800c86:	68 8b 56 80 00       	push   $0x80568b
+  800c8b:	6a 23                	push   $0x23
+  800c8d:	68 a8 56 80 00       	push   $0x8056a8
+  800c92:	e8 a6 42 00 00       	call   804f3d <_panic>
+
+00800c97 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c97:	55                   	push   %ebp
+  800c98:	89 e5                	mov    %esp,%ebp
+  800c9a:	57                   	push   %edi
+  800c9b:	56                   	push   %esi
+  800c9c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca2:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ca7:	89 d1                	mov    %edx,%ecx
+  800ca9:	89 d3                	mov    %edx,%ebx
+  800cab:	89 d7                	mov    %edx,%edi
+  800cad:	89 d6                	mov    %edx,%esi
+  800caf:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cb1:	5b                   	pop    %ebx
+  800cb2:	5e                   	pop    %esi
+  800cb3:	5f                   	pop    %edi
+  800cb4:	5d                   	pop    %ebp
+  800cb5:	c3                   	ret
+
+00800cb6 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cb6:	55                   	push   %ebp
+  800cb7:	89 e5                	mov    %esp,%ebp
+  800cb9:	57                   	push   %edi
+  800cba:	56                   	push   %esi
+  800cbb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cc6:	89 d1                	mov    %edx,%ecx
+  800cc8:	89 d3                	mov    %edx,%ebx
+  800cca:	89 d7                	mov    %edx,%edi
+  800ccc:	89 d6                	mov    %edx,%esi
+  800cce:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cd0:	5b                   	pop    %ebx
+  800cd1:	5e                   	pop    %esi
+  800cd2:	5f                   	pop    %edi
+  800cd3:	5d                   	pop    %ebp
+  800cd4:	c3                   	ret
+
+00800cd5 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cd5:	55                   	push   %ebp
+  800cd6:	89 e5                	mov    %esp,%ebp
+  800cd8:	57                   	push   %edi
+  800cd9:	56                   	push   %esi
+  800cda:	53                   	push   %ebx
+  800cdb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cde:	be 00 00 00 00       	mov    $0x0,%esi
+  800ce3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce9:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cf1:	89 f7                	mov    %esi,%edi
+  800cf3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cf5:	85 c0                	test   %eax,%eax
+  800cf7:	7f 08                	jg     800d01 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cf9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cfc:	5b                   	pop    %ebx
+  800cfd:	5e                   	pop    %esi
+  800cfe:	5f                   	pop    %edi
+  800cff:	5d                   	pop    %ebp
+  800d00:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d01:	83 ec 0c             	sub    $0xc,%esp
+  800d04:	50                   	push   %eax
+  800d05:	6a 04                	push   $0x4
+  800d07:	68 8b 56 80 00       	push   $0x80568b
+  800d0c:	6a 23                	push   $0x23
+  800d0e:	68 a8 56 80 00       	push   $0x8056a8
+  800d13:	e8 25 42 00 00       	call   804f3d <_panic>
+
+00800d18 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d18:	55                   	push   %ebp
+  800d19:	89 e5                	mov    %esp,%ebp
+  800d1b:	57                   	push   %edi
+  800d1c:	56                   	push   %esi
+  800d1d:	53                   	push   %ebx
+  800d1e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d27:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d2c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d2f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d32:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d35:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d37:	85 c0                	test   %eax,%eax
+  800d39:	7f 08                	jg     800d43 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3e:	5b                   	pop    %ebx
+  800d3f:	5e                   	pop    %esi
+  800d40:	5f                   	pop    %edi
+  800d41:	5d                   	pop    %ebp
+  800d42:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d43:	83 ec 0c             	sub    $0xc,%esp
+  800d46:	50                   	push   %eax
+  800d47:	6a 05                	push   $0x5
+  800d49:	68 8b 56 80 00       	push   $0x80568b
+  800d4e:	6a 23                	push   $0x23
+  800d50:	68 a8 56 80 00       	push   $0x8056a8
+  800d55:	e8 e3 41 00 00       	call   804f3d <_panic>
+
+00800d5a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d5a:	55                   	push   %ebp
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	57                   	push   %edi
+  800d5e:	56                   	push   %esi
+  800d5f:	53                   	push   %ebx
+  800d60:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d73:	89 df                	mov    %ebx,%edi
+  800d75:	89 de                	mov    %ebx,%esi
+  800d77:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d79:	85 c0                	test   %eax,%eax
+  800d7b:	7f 08                	jg     800d85 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d80:	5b                   	pop    %ebx
+  800d81:	5e                   	pop    %esi
+  800d82:	5f                   	pop    %edi
+  800d83:	5d                   	pop    %ebp
+  800d84:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d85:	83 ec 0c             	sub    $0xc,%esp
+  800d88:	50                   	push   %eax
+  800d89:	6a 06                	push   $0x6
+  800d8b:	68 8b 56 80 00       	push   $0x80568b
+  800d90:	6a 23                	push   $0x23
+  800d92:	68 a8 56 80 00       	push   $0x8056a8
+  800d97:	e8 a1 41 00 00       	call   804f3d <_panic>
+
+00800d9c <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800d9c:	55                   	push   %ebp
+  800d9d:	89 e5                	mov    %esp,%ebp
+  800d9f:	57                   	push   %edi
+  800da0:	56                   	push   %esi
+  800da1:	53                   	push   %ebx
+  800da2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800da5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800daa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db0:	b8 18 00 00 00       	mov    $0x18,%eax
+  800db5:	89 df                	mov    %ebx,%edi
+  800db7:	89 de                	mov    %ebx,%esi
+  800db9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dbb:	85 c0                	test   %eax,%eax
+  800dbd:	7f 08                	jg     800dc7 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800dbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc2:	5b                   	pop    %ebx
+  800dc3:	5e                   	pop    %esi
+  800dc4:	5f                   	pop    %edi
+  800dc5:	5d                   	pop    %ebp
+  800dc6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dc7:	83 ec 0c             	sub    $0xc,%esp
+  800dca:	50                   	push   %eax
+  800dcb:	6a 18                	push   $0x18
+  800dcd:	68 8b 56 80 00       	push   $0x80568b
+  800dd2:	6a 23                	push   $0x23
+  800dd4:	68 a8 56 80 00       	push   $0x8056a8
+  800dd9:	e8 5f 41 00 00       	call   804f3d <_panic>
+
+00800dde <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800dde:	55                   	push   %ebp
+  800ddf:	89 e5                	mov    %esp,%ebp
+  800de1:	57                   	push   %edi
+  800de2:	56                   	push   %esi
+  800de3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800de4:	be 00 00 00 00       	mov    $0x0,%esi
+  800de9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800def:	b8 19 00 00 00       	mov    $0x19,%eax
+  800df4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df7:	89 f7                	mov    %esi,%edi
+  800df9:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800dfb:	5b                   	pop    %ebx
+  800dfc:	5e                   	pop    %esi
+  800dfd:	5f                   	pop    %edi
+  800dfe:	5d                   	pop    %ebp
+  800dff:	c3                   	ret
+
+00800e00 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800e00:	55                   	push   %ebp
+  800e01:	89 e5                	mov    %esp,%ebp
+  800e03:	57                   	push   %edi
+  800e04:	56                   	push   %esi
+  800e05:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e11:	be 00 00 00 00       	mov    $0x0,%esi
+  800e16:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e19:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e1c:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e1e:	5b                   	pop    %ebx
+  800e1f:	5e                   	pop    %esi
+  800e20:	5f                   	pop    %edi
+  800e21:	5d                   	pop    %ebp
+  800e22:	c3                   	ret
+
+00800e23 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e23:	55                   	push   %ebp
+  800e24:	89 e5                	mov    %esp,%ebp
+  800e26:	57                   	push   %edi
+  800e27:	56                   	push   %esi
+  800e28:	53                   	push   %ebx
+  800e29:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800e2c:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800e2f:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800e35:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800e38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e46:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e49:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e4b:	85 c0                	test   %eax,%eax
+  800e4d:	7f 08                	jg     800e57 <sys_page_map_range+0x34>
+}
+  800e4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e52:	5b                   	pop    %ebx
+  800e53:	5e                   	pop    %esi
+  800e54:	5f                   	pop    %edi
+  800e55:	5d                   	pop    %ebp
+  800e56:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e57:	83 ec 0c             	sub    $0xc,%esp
+  800e5a:	50                   	push   %eax
+  800e5b:	6a 10                	push   $0x10
+  800e5d:	68 8b 56 80 00       	push   $0x80568b
+  800e62:	6a 23                	push   $0x23
+  800e64:	68 a8 56 80 00       	push   $0x8056a8
+  800e69:	e8 cf 40 00 00       	call   804f3d <_panic>
+
+00800e6e <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e6e:	55                   	push   %ebp
+  800e6f:	89 e5                	mov    %esp,%ebp
+  800e71:	57                   	push   %edi
+  800e72:	56                   	push   %esi
+  800e73:	53                   	push   %ebx
+  800e74:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e77:	be 00 00 00 00       	mov    $0x0,%esi
+  800e7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e82:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8a:	89 f7                	mov    %esi,%edi
+  800e8c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e8e:	85 c0                	test   %eax,%eax
+  800e90:	7f 08                	jg     800e9a <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e95:	5b                   	pop    %ebx
+  800e96:	5e                   	pop    %esi
+  800e97:	5f                   	pop    %edi
+  800e98:	5d                   	pop    %ebp
+  800e99:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9a:	83 ec 0c             	sub    $0xc,%esp
+  800e9d:	50                   	push   %eax
+  800e9e:	6a 11                	push   $0x11
+  800ea0:	68 8b 56 80 00       	push   $0x80568b
+  800ea5:	6a 23                	push   $0x23
+  800ea7:	68 a8 56 80 00       	push   $0x8056a8
+  800eac:	e8 8c 40 00 00       	call   804f3d <_panic>
+
+00800eb1 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800eb1:	55                   	push   %ebp
+  800eb2:	89 e5                	mov    %esp,%ebp
+  800eb4:	57                   	push   %edi
+  800eb5:	56                   	push   %esi
+  800eb6:	53                   	push   %ebx
+  800eb7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eba:	be 00 00 00 00       	mov    $0x0,%esi
+  800ebf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800eca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecd:	89 f7                	mov    %esi,%edi
+  800ecf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ed1:	85 c0                	test   %eax,%eax
+  800ed3:	7f 08                	jg     800edd <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ed5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed8:	5b                   	pop    %ebx
+  800ed9:	5e                   	pop    %esi
+  800eda:	5f                   	pop    %edi
+  800edb:	5d                   	pop    %ebp
+  800edc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800edd:	83 ec 0c             	sub    $0xc,%esp
+  800ee0:	50                   	push   %eax
+  800ee1:	6a 1b                	push   $0x1b
+  800ee3:	68 8b 56 80 00       	push   $0x80568b
+  800ee8:	6a 23                	push   $0x23
+  800eea:	68 a8 56 80 00       	push   $0x8056a8
+  800eef:	e8 49 40 00 00       	call   804f3d <_panic>
+
+00800ef4 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800ef4:	55                   	push   %ebp
+  800ef5:	89 e5                	mov    %esp,%ebp
+  800ef7:	57                   	push   %edi
+  800ef8:	56                   	push   %esi
+  800ef9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800efa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eff:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f04:	89 d1                	mov    %edx,%ecx
+  800f06:	89 d3                	mov    %edx,%ebx
+  800f08:	89 d7                	mov    %edx,%edi
+  800f0a:	89 d6                	mov    %edx,%esi
+  800f0c:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f0e:	5b                   	pop    %ebx
+  800f0f:	5e                   	pop    %esi
+  800f10:	5f                   	pop    %edi
+  800f11:	5d                   	pop    %ebp
+  800f12:	c3                   	ret
+
+00800f13 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	57                   	push   %edi
+  800f17:	56                   	push   %esi
+  800f18:	53                   	push   %ebx
+  800f19:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f27:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f2c:	89 df                	mov    %ebx,%edi
+  800f2e:	89 de                	mov    %ebx,%esi
+  800f30:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f32:	85 c0                	test   %eax,%eax
+  800f34:	7f 08                	jg     800f3e <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f39:	5b                   	pop    %ebx
+  800f3a:	5e                   	pop    %esi
+  800f3b:	5f                   	pop    %edi
+  800f3c:	5d                   	pop    %ebp
+  800f3d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f3e:	83 ec 0c             	sub    $0xc,%esp
+  800f41:	50                   	push   %eax
+  800f42:	6a 08                	push   $0x8
+  800f44:	68 8b 56 80 00       	push   $0x80568b
+  800f49:	6a 23                	push   $0x23
+  800f4b:	68 a8 56 80 00       	push   $0x8056a8
+  800f50:	e8 e8 3f 00 00       	call   804f3d <_panic>
+
+00800f55 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f55:	55                   	push   %ebp
+  800f56:	89 e5                	mov    %esp,%ebp
+  800f58:	57                   	push   %edi
+  800f59:	56                   	push   %esi
+  800f5a:	53                   	push   %ebx
+  800f5b:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800f5e:	6a 44                	push   $0x44
+  800f60:	ff 75 0c             	push   0xc(%ebp)
+  800f63:	e8 7a fc ff ff       	call   800be2 <touch_mem>
+	asm volatile("int %1\n"
+  800f68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f70:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f78:	89 df                	mov    %ebx,%edi
+  800f7a:	89 de                	mov    %ebx,%esi
+  800f7c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f7e:	83 c4 08             	add    $0x8,%esp
+  800f81:	85 c0                	test   %eax,%eax
+  800f83:	7f 08                	jg     800f8d <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f88:	5b                   	pop    %ebx
+  800f89:	5e                   	pop    %esi
+  800f8a:	5f                   	pop    %edi
+  800f8b:	5d                   	pop    %ebp
+  800f8c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f8d:	83 ec 0c             	sub    $0xc,%esp
+  800f90:	50                   	push   %eax
+  800f91:	6a 09                	push   $0x9
+  800f93:	68 8b 56 80 00       	push   $0x80568b
+  800f98:	6a 23                	push   $0x23
+  800f9a:	68 a8 56 80 00       	push   $0x8056a8
+  800f9f:	e8 99 3f 00 00       	call   804f3d <_panic>
+
+00800fa4 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800fa4:	55                   	push   %ebp
+  800fa5:	89 e5                	mov    %esp,%ebp
+  800fa7:	57                   	push   %edi
+  800fa8:	56                   	push   %esi
+  800fa9:	53                   	push   %ebx
+  800faa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fad:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800fbd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc0:	89 f7                	mov    %esi,%edi
+  800fc2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc4:	85 c0                	test   %eax,%eax
+  800fc6:	7f 08                	jg     800fd0 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800fc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fcb:	5b                   	pop    %ebx
+  800fcc:	5e                   	pop    %esi
+  800fcd:	5f                   	pop    %edi
+  800fce:	5d                   	pop    %ebp
+  800fcf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd0:	83 ec 0c             	sub    $0xc,%esp
+  800fd3:	50                   	push   %eax
+  800fd4:	6a 1a                	push   $0x1a
+  800fd6:	68 8b 56 80 00       	push   $0x80568b
+  800fdb:	6a 23                	push   $0x23
+  800fdd:	68 a8 56 80 00       	push   $0x8056a8
+  800fe2:	e8 56 3f 00 00       	call   804f3d <_panic>
+
+00800fe7 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  800fe7:	55                   	push   %ebp
+  800fe8:	89 e5                	mov    %esp,%ebp
+  800fea:	57                   	push   %edi
+  800feb:	56                   	push   %esi
+  800fec:	53                   	push   %ebx
+  800fed:	83 ec 0c             	sub    $0xc,%esp
+  800ff0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  800ff3:	89 d8                	mov    %ebx,%eax
+  800ff5:	c1 e0 05             	shl    $0x5,%eax
+  800ff8:	50                   	push   %eax
+  800ff9:	ff 75 0c             	push   0xc(%ebp)
+  800ffc:	e8 e1 fb ff ff       	call   800be2 <touch_mem>
+	asm volatile("int %1\n"
+  801001:	be 00 00 00 00       	mov    $0x0,%esi
+  801006:	8b 55 08             	mov    0x8(%ebp),%edx
+  801009:	b8 13 00 00 00       	mov    $0x13,%eax
+  80100e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801011:	89 f7                	mov    %esi,%edi
+  801013:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801015:	83 c4 08             	add    $0x8,%esp
+  801018:	85 c0                	test   %eax,%eax
+  80101a:	7f 08                	jg     801024 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  80101c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101f:	5b                   	pop    %ebx
+  801020:	5e                   	pop    %esi
+  801021:	5f                   	pop    %edi
+  801022:	5d                   	pop    %ebp
+  801023:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801024:	83 ec 0c             	sub    $0xc,%esp
+  801027:	50                   	push   %eax
+  801028:	6a 13                	push   $0x13
+  80102a:	68 8b 56 80 00       	push   $0x80568b
+  80102f:	6a 23                	push   $0x23
+  801031:	68 a8 56 80 00       	push   $0x8056a8
+  801036:	e8 02 3f 00 00       	call   804f3d <_panic>
+
+0080103b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80103b:	55                   	push   %ebp
+  80103c:	89 e5                	mov    %esp,%ebp
+  80103e:	57                   	push   %edi
+  80103f:	56                   	push   %esi
+  801040:	53                   	push   %ebx
+  801041:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801044:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801049:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801054:	89 df                	mov    %ebx,%edi
+  801056:	89 de                	mov    %ebx,%esi
+  801058:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80105a:	85 c0                	test   %eax,%eax
+  80105c:	7f 08                	jg     801066 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80105e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801061:	5b                   	pop    %ebx
+  801062:	5e                   	pop    %esi
+  801063:	5f                   	pop    %edi
+  801064:	5d                   	pop    %ebp
+  801065:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801066:	83 ec 0c             	sub    $0xc,%esp
+  801069:	50                   	push   %eax
+  80106a:	6a 0a                	push   $0xa
+  80106c:	68 8b 56 80 00       	push   $0x80568b
+  801071:	6a 23                	push   $0x23
+  801073:	68 a8 56 80 00       	push   $0x8056a8
+  801078:	e8 c0 3e 00 00       	call   804f3d <_panic>
+
+0080107d <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80107d:	55                   	push   %ebp
+  80107e:	89 e5                	mov    %esp,%ebp
+  801080:	57                   	push   %edi
+  801081:	56                   	push   %esi
+  801082:	53                   	push   %ebx
+  801083:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801086:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80108c:	76 1d                	jbe    8010ab <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80108e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801091:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801094:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801099:	be 01 00 00 00       	mov    $0x1,%esi
+  80109e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010a1:	cd 30                	int    $0x30
+}
+  8010a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a6:	5b                   	pop    %ebx
+  8010a7:	5e                   	pop    %esi
+  8010a8:	5f                   	pop    %edi
+  8010a9:	5d                   	pop    %ebp
+  8010aa:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8010ab:	68 00 10 00 00       	push   $0x1000
+  8010b0:	53                   	push   %ebx
+  8010b1:	e8 2c fb ff ff       	call   800be2 <touch_mem>
+  8010b6:	83 c4 08             	add    $0x8,%esp
+  8010b9:	eb d3                	jmp    80108e <sys_ipc_send+0x11>
+
+008010bb <sys_ipc_send_pages>:
+{
+  8010bb:	55                   	push   %ebp
+  8010bc:	89 e5                	mov    %esp,%ebp
+  8010be:	57                   	push   %edi
+  8010bf:	56                   	push   %esi
+  8010c0:	53                   	push   %ebx
+  8010c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c4:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8010c7:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010cd:	76 18                	jbe    8010e7 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8010cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010da:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8010dd:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8010df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e2:	5b                   	pop    %ebx
+  8010e3:	5e                   	pop    %esi
+  8010e4:	5f                   	pop    %edi
+  8010e5:	5d                   	pop    %ebp
+  8010e6:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8010e7:	89 f0                	mov    %esi,%eax
+  8010e9:	c1 e0 0c             	shl    $0xc,%eax
+  8010ec:	50                   	push   %eax
+  8010ed:	53                   	push   %ebx
+  8010ee:	e8 ef fa ff ff       	call   800be2 <touch_mem>
+  8010f3:	83 c4 08             	add    $0x8,%esp
+  8010f6:	eb d7                	jmp    8010cf <sys_ipc_send_pages+0x14>
+
+008010f8 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8010f8:	55                   	push   %ebp
+  8010f9:	89 e5                	mov    %esp,%ebp
+  8010fb:	57                   	push   %edi
+  8010fc:	56                   	push   %esi
+  8010fd:	53                   	push   %ebx
+  8010fe:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801101:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801106:	8b 55 08             	mov    0x8(%ebp),%edx
+  801109:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801111:	89 df                	mov    %ebx,%edi
+  801113:	89 de                	mov    %ebx,%esi
+  801115:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801117:	85 c0                	test   %eax,%eax
+  801119:	7f 08                	jg     801123 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  80111b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111e:	5b                   	pop    %ebx
+  80111f:	5e                   	pop    %esi
+  801120:	5f                   	pop    %edi
+  801121:	5d                   	pop    %ebp
+  801122:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801123:	83 ec 0c             	sub    $0xc,%esp
+  801126:	50                   	push   %eax
+  801127:	6a 0d                	push   $0xd
+  801129:	68 8b 56 80 00       	push   $0x80568b
+  80112e:	6a 23                	push   $0x23
+  801130:	68 a8 56 80 00       	push   $0x8056a8
+  801135:	e8 03 3e 00 00       	call   804f3d <_panic>
+
+0080113a <sys_ipc_recv>:
+{
+  80113a:	55                   	push   %ebp
+  80113b:	89 e5                	mov    %esp,%ebp
+  80113d:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801140:	6a 01                	push   $0x1
+  801142:	ff 75 08             	push   0x8(%ebp)
+  801145:	e8 ae ff ff ff       	call   8010f8 <sys_ipc_recv_pages>
+}
+  80114a:	c9                   	leave
+  80114b:	c3                   	ret
+
+0080114c <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80114c:	55                   	push   %ebp
+  80114d:	89 e5                	mov    %esp,%ebp
+  80114f:	57                   	push   %edi
+  801150:	56                   	push   %esi
+  801151:	53                   	push   %ebx
+  801152:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801155:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801158:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  80115b:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801161:	77 04                	ja     801167 <sys_ipc_call+0x1b>
+  801163:	85 f6                	test   %esi,%esi
+  801165:	75 15                	jne    80117c <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801167:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801172:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801174:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801177:	5b                   	pop    %ebx
+  801178:	5e                   	pop    %esi
+  801179:	5f                   	pop    %edi
+  80117a:	5d                   	pop    %ebp
+  80117b:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80117c:	89 f8                	mov    %edi,%eax
+  80117e:	c1 e0 0c             	shl    $0xc,%eax
+  801181:	50                   	push   %eax
+  801182:	53                   	push   %ebx
+  801183:	e8 5a fa ff ff       	call   800be2 <touch_mem>
+  801188:	83 c4 08             	add    $0x8,%esp
+  80118b:	eb da                	jmp    801167 <sys_ipc_call+0x1b>
+
+0080118d <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80118d:	55                   	push   %ebp
+  80118e:	89 e5                	mov    %esp,%ebp
+  801190:	57                   	push   %edi
+  801191:	56                   	push   %esi
+  801192:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801193:	8b 55 08             	mov    0x8(%ebp),%edx
+  801196:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801199:	b8 15 00 00 00       	mov    $0x15,%eax
+  80119e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011a4:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011a7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8011a9:	5b                   	pop    %ebx
+  8011aa:	5e                   	pop    %esi
+  8011ab:	5f                   	pop    %edi
+  8011ac:	5d                   	pop    %ebp
+  8011ad:	c3                   	ret
+
+008011ae <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8011ae:	55                   	push   %ebp
+  8011af:	89 e5                	mov    %esp,%ebp
+  8011b1:	57                   	push   %edi
+  8011b2:	56                   	push   %esi
+  8011b3:	53                   	push   %ebx
+  8011b4:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8011b7:	6a 04                	push   $0x4
+  8011b9:	ff 75 08             	push   0x8(%ebp)
+  8011bc:	e8 21 fa ff ff       	call   800be2 <touch_mem>
+	asm volatile("int %1\n"
+  8011c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c9:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d4:	89 f7                	mov    %esi,%edi
+  8011d6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011d8:	83 c4 08             	add    $0x8,%esp
+  8011db:	85 c0                	test   %eax,%eax
+  8011dd:	7f 08                	jg     8011e7 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8011df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e2:	5b                   	pop    %ebx
+  8011e3:	5e                   	pop    %esi
+  8011e4:	5f                   	pop    %edi
+  8011e5:	5d                   	pop    %ebp
+  8011e6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e7:	83 ec 0c             	sub    $0xc,%esp
+  8011ea:	50                   	push   %eax
+  8011eb:	6a 16                	push   $0x16
+  8011ed:	68 8b 56 80 00       	push   $0x80568b
+  8011f2:	6a 23                	push   $0x23
+  8011f4:	68 a8 56 80 00       	push   $0x8056a8
+  8011f9:	e8 3f 3d 00 00       	call   804f3d <_panic>
+
+008011fe <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8011fe:	55                   	push   %ebp
+  8011ff:	89 e5                	mov    %esp,%ebp
+  801201:	57                   	push   %edi
+  801202:	56                   	push   %esi
+  801203:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801204:	6a 04                	push   $0x4
+  801206:	ff 75 08             	push   0x8(%ebp)
+  801209:	e8 d4 f9 ff ff       	call   800be2 <touch_mem>
+	asm volatile("int %1\n"
+  80120e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801213:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801216:	b8 17 00 00 00       	mov    $0x17,%eax
+  80121b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121e:	89 df                	mov    %ebx,%edi
+  801220:	89 de                	mov    %ebx,%esi
+  801222:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801224:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801227:	5b                   	pop    %ebx
+  801228:	5e                   	pop    %esi
+  801229:	5f                   	pop    %edi
+  80122a:	5d                   	pop    %ebp
+  80122b:	c3                   	ret
+
+0080122c <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80122c:	55                   	push   %ebp
+  80122d:	89 e5                	mov    %esp,%ebp
+  80122f:	57                   	push   %edi
+  801230:	56                   	push   %esi
+  801231:	53                   	push   %ebx
+  801232:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801235:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80123a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801242:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801247:	89 df                	mov    %ebx,%edi
+  801249:	89 de                	mov    %ebx,%esi
+  80124b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80124d:	85 c0                	test   %eax,%eax
+  80124f:	7f 08                	jg     801259 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801251:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801254:	5b                   	pop    %ebx
+  801255:	5e                   	pop    %esi
+  801256:	5f                   	pop    %edi
+  801257:	5d                   	pop    %ebp
+  801258:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801259:	83 ec 0c             	sub    $0xc,%esp
+  80125c:	50                   	push   %eax
+  80125d:	6a 0e                	push   $0xe
+  80125f:	68 8b 56 80 00       	push   $0x80568b
+  801264:	6a 23                	push   $0x23
+  801266:	68 a8 56 80 00       	push   $0x8056a8
+  80126b:	e8 cd 3c 00 00       	call   804f3d <_panic>
+
+00801270 <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  801270:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801277:	f6 c6 06             	test   $0x6,%dh
+  80127a:	75 37                	jne    8012b3 <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  80127c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801283:	f6 c2 02             	test   $0x2,%dl
+  801286:	75 19                	jne    8012a1 <dupperm+0x31>
+  801288:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80128f:	f6 c6 08             	test   $0x8,%dh
+  801292:	75 0d                	jne    8012a1 <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  801294:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80129b:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012a0:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  8012a1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012a8:	25 00 06 00 00       	and    $0x600,%eax
+  8012ad:	0d 05 08 00 00       	or     $0x805,%eax
+  8012b2:	c3                   	ret
+		return 0;
+  8012b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012b8:	c3                   	ret
+
+008012b9 <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  8012b9:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  8012bb:	c1 e0 0c             	shl    $0xc,%eax
+  8012be:	c1 e8 16             	shr    $0x16,%eax
+  8012c1:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8012c8:	f6 c1 01             	test   $0x1,%cl
+  8012cb:	74 2c                	je     8012f9 <dupable+0x40>
+  8012cd:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8012d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d9:	f6 c1 04             	test   $0x4,%cl
+  8012dc:	74 20                	je     8012fe <dupable+0x45>
+  8012de:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8012e5:	f6 c1 01             	test   $0x1,%cl
+  8012e8:	74 14                	je     8012fe <dupable+0x45>
+  8012ea:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8012f1:	c1 e8 02             	shr    $0x2,%eax
+  8012f4:	83 e0 01             	and    $0x1,%eax
+  8012f7:	eb 05                	jmp    8012fe <dupable+0x45>
+  8012f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012fe:	83 e0 01             	and    $0x1,%eax
+}
+  801301:	c3                   	ret
+
+00801302 <pgfault>:
+{
+  801302:	55                   	push   %ebp
+  801303:	89 e5                	mov    %esp,%ebp
+  801305:	56                   	push   %esi
+  801306:	53                   	push   %ebx
+  801307:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  80130a:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  80130c:	89 ca                	mov    %ecx,%edx
+  80130e:	c1 ea 0c             	shr    $0xc,%edx
+  801311:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801318:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  80131c:	0f 84 8e 00 00 00    	je     8013b0 <pgfault+0xae>
+		return 0;
+  801322:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801327:	f6 c6 08             	test   $0x8,%dh
+  80132a:	0f 84 85 00 00 00    	je     8013b5 <pgfault+0xb3>
+	perm |= PTE_W;
+  801330:	81 e2 07 06 00 00    	and    $0x607,%edx
+  801336:	89 d3                	mov    %edx,%ebx
+  801338:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80133b:	89 ce                	mov    %ecx,%esi
+  80133d:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  801343:	6a 01                	push   $0x1
+  801345:	53                   	push   %ebx
+  801346:	68 00 f0 7f 00       	push   $0x7ff000
+  80134b:	6a 00                	push   $0x0
+  80134d:	e8 bb 29 00 00       	call   803d0d <page_alloc>
+  801352:	83 c4 10             	add    $0x10,%esp
+  801355:	85 c0                	test   %eax,%eax
+  801357:	78 33                	js     80138c <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  801359:	83 ec 04             	sub    $0x4,%esp
+  80135c:	68 00 10 00 00       	push   $0x1000
+  801361:	56                   	push   %esi
+  801362:	68 00 f0 7f 00       	push   $0x7ff000
+  801367:	e8 fc f5 ff ff       	call   800968 <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  80136c:	89 1c 24             	mov    %ebx,(%esp)
+  80136f:	56                   	push   %esi
+  801370:	6a 00                	push   $0x0
+  801372:	68 00 f0 7f 00       	push   $0x7ff000
+  801377:	6a 00                	push   $0x0
+  801379:	e8 f0 2f 00 00       	call   80436e <page_map>
+  80137e:	83 c4 20             	add    $0x20,%esp
+  801381:	85 c0                	test   %eax,%eax
+  801383:	78 19                	js     80139e <pgfault+0x9c>
+	return 1;
+  801385:	b8 01 00 00 00       	mov    $0x1,%eax
+  80138a:	eb 29                	jmp    8013b5 <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  80138c:	50                   	push   %eax
+  80138d:	68 b8 56 80 00       	push   $0x8056b8
+  801392:	6a 2e                	push   $0x2e
+  801394:	68 0b 57 80 00       	push   $0x80570b
+  801399:	e8 9f 3b 00 00       	call   804f3d <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  80139e:	50                   	push   %eax
+  80139f:	68 e4 56 80 00       	push   $0x8056e4
+  8013a4:	6a 32                	push   $0x32
+  8013a6:	68 0b 57 80 00       	push   $0x80570b
+  8013ab:	e8 8d 3b 00 00       	call   804f3d <_panic>
+		return 0;
+  8013b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013b8:	5b                   	pop    %ebx
+  8013b9:	5e                   	pop    %esi
+  8013ba:	5d                   	pop    %ebp
+  8013bb:	c3                   	ret
+
+008013bc <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8013bc:	55                   	push   %ebp
+  8013bd:	89 e5                	mov    %esp,%ebp
+  8013bf:	57                   	push   %edi
+  8013c0:	56                   	push   %esi
+  8013c1:	53                   	push   %ebx
+  8013c2:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  8013c5:	83 3d 18 e9 80 00 00 	cmpl   $0x0,0x80e918
+  8013cc:	74 5d                	je     80142b <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  8013ce:	83 ec 0c             	sub    $0xc,%esp
+  8013d1:	68 02 13 80 00       	push   $0x801302
+  8013d6:	e8 3a 3c 00 00       	call   805015 <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  8013db:	e8 14 fb ff ff       	call   800ef4 <sys_fork>
+  8013e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8013e3:	83 c4 10             	add    $0x10,%esp
+  8013e6:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8013e9:	74 47                	je     801432 <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  8013eb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8013ef:	0f 84 c5 03 00 00    	je     8017ba <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  8013f5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8013f9:	78 25                	js     801420 <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  8013fb:	e8 85 22 00 00       	call   803685 <page_share_paged_out>
+  801400:	85 c0                	test   %eax,%eax
+  801402:	0f 88 d8 03 00 00    	js     8017e0 <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801408:	83 ec 08             	sub    $0x8,%esp
+  80140b:	6a 02                	push   $0x2
+  80140d:	ff 75 e4             	push   -0x1c(%ebp)
+  801410:	e8 fe fa ff ff       	call   800f13 <sys_env_set_status>
+  801415:	83 c4 10             	add    $0x10,%esp
+  801418:	85 c0                	test   %eax,%eax
+  80141a:	0f 88 d5 03 00 00    	js     8017f5 <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  801420:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801423:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801426:	5b                   	pop    %ebx
+  801427:	5e                   	pop    %esi
+  801428:	5f                   	pop    %edi
+  801429:	5d                   	pop    %ebp
+  80142a:	c3                   	ret
+		init_map_dir();
+  80142b:	e8 5d 25 00 00       	call   80398d <init_map_dir>
+  801430:	eb 9c                	jmp    8013ce <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801432:	b8 07 00 00 00       	mov    $0x7,%eax
+  801437:	cd 30                	int    $0x30
+  801439:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  80143c:	85 c0                	test   %eax,%eax
+  80143e:	78 10                	js     801450 <fork+0x94>
+	if (envid == 0)
+  801440:	0f 84 74 03 00 00    	je     8017ba <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801446:	be 00 00 00 00       	mov    $0x0,%esi
+  80144b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80144e:	eb 30                	jmp    801480 <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  801450:	50                   	push   %eax
+  801451:	68 16 57 80 00       	push   $0x805716
+  801456:	68 cd 00 00 00       	push   $0xcd
+  80145b:	68 0b 57 80 00       	push   $0x80570b
+  801460:	e8 d8 3a 00 00       	call   804f3d <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  801465:	89 f2                	mov    %esi,%edx
+  801467:	c1 fa 1f             	sar    $0x1f,%edx
+  80146a:	c1 ea 16             	shr    $0x16,%edx
+  80146d:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  801470:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801475:	29 d0                	sub    %edx,%eax
+  801477:	ba 00 04 00 00       	mov    $0x400,%edx
+  80147c:	29 c2                	sub    %eax,%edx
+  80147e:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801480:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  801483:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801489:	0f 87 ff 02 00 00    	ja     80178e <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  80148f:	89 f3                	mov    %esi,%ebx
+  801491:	c1 e3 0c             	shl    $0xc,%ebx
+  801494:	89 d8                	mov    %ebx,%eax
+  801496:	c1 e8 16             	shr    $0x16,%eax
+  801499:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8014a0:	f6 c2 01             	test   $0x1,%dl
+  8014a3:	74 c0                	je     801465 <fork+0xa9>
+  8014a5:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8014ac:	f6 c2 04             	test   $0x4,%dl
+  8014af:	74 b4                	je     801465 <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  8014b1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014b8:	a8 80                	test   $0x80,%al
+  8014ba:	75 24                	jne    8014e0 <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  8014bc:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8014c3:	25 81 00 00 00       	and    $0x81,%eax
+  8014c8:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8014cd:	74 21                	je     8014f0 <fork+0x134>
+		if (!dupable(pn)) {
+  8014cf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014d2:	e8 e2 fd ff ff       	call   8012b9 <dupable>
+  8014d7:	84 c0                	test   %al,%al
+  8014d9:	75 1a                	jne    8014f5 <fork+0x139>
+			++pn;
+  8014db:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8014de:	eb a0                	jmp    801480 <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  8014e0:	83 ec 08             	sub    $0x8,%esp
+  8014e3:	53                   	push   %ebx
+  8014e4:	6a 00                	push   $0x0
+  8014e6:	e8 b1 f8 ff ff       	call   800d9c <sys_page_split>
+  8014eb:	83 c4 10             	add    $0x10,%esp
+  8014ee:	eb cc                	jmp    8014bc <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  8014f0:	0f b6 03             	movzbl (%ebx),%eax
+  8014f3:	eb da                	jmp    8014cf <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  8014f5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8014f8:	89 f8                	mov    %edi,%eax
+  8014fa:	e8 71 fd ff ff       	call   801270 <dupperm>
+  8014ff:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801502:	85 c0                	test   %eax,%eax
+  801504:	74 16                	je     80151c <fork+0x160>
+  801506:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  80150b:	29 f8                	sub    %edi,%eax
+  80150d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801510:	bf 01 00 00 00       	mov    $0x1,%edi
+  801515:	89 c6                	mov    %eax,%esi
+  801517:	e9 c4 01 00 00       	jmp    8016e0 <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  80151c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80151f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801526:	f6 c4 04             	test   $0x4,%ah
+  801529:	0f 85 89 00 00 00    	jne    8015b8 <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  80152f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801532:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801539:	f6 c4 02             	test   $0x2,%ah
+  80153c:	0f 85 b1 00 00 00    	jne    8015f3 <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  801542:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801545:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80154c:	a8 02                	test   $0x2,%al
+  80154e:	75 10                	jne    801560 <fork+0x1a4>
+  801550:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801557:	f6 c4 08             	test   $0x8,%ah
+  80155a:	0f 84 3e 01 00 00    	je     80169e <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801560:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801563:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80156a:	25 00 06 00 00       	and    $0x600,%eax
+  80156f:	0d 05 08 00 00       	or     $0x805,%eax
+  801574:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  801576:	c1 e1 0c             	shl    $0xc,%ecx
+  801579:	89 cb                	mov    %ecx,%ebx
+  80157b:	83 ec 0c             	sub    $0xc,%esp
+  80157e:	50                   	push   %eax
+  80157f:	51                   	push   %ecx
+  801580:	ff 75 e4             	push   -0x1c(%ebp)
+  801583:	51                   	push   %ecx
+  801584:	6a 00                	push   $0x0
+  801586:	e8 e3 2d 00 00       	call   80436e <page_map>
+  80158b:	83 c4 20             	add    $0x20,%esp
+  80158e:	85 c0                	test   %eax,%eax
+  801590:	0f 88 e4 00 00 00    	js     80167a <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  801596:	83 ec 0c             	sub    $0xc,%esp
+  801599:	57                   	push   %edi
+  80159a:	53                   	push   %ebx
+  80159b:	6a 00                	push   $0x0
+  80159d:	53                   	push   %ebx
+  80159e:	6a 00                	push   $0x0
+  8015a0:	e8 c9 2d 00 00       	call   80436e <page_map>
+  8015a5:	83 c4 20             	add    $0x20,%esp
+  8015a8:	85 c0                	test   %eax,%eax
+  8015aa:	0f 88 dc 00 00 00    	js     80168c <fork+0x2d0>
+			++pn;
+  8015b0:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8015b3:	e9 c8 fe ff ff       	jmp    801480 <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8015b8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8015bb:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8015c2:	c1 e1 0c             	shl    $0xc,%ecx
+  8015c5:	83 ec 0c             	sub    $0xc,%esp
+  8015c8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015cd:	50                   	push   %eax
+  8015ce:	51                   	push   %ecx
+  8015cf:	ff 75 e4             	push   -0x1c(%ebp)
+  8015d2:	51                   	push   %ecx
+  8015d3:	6a 00                	push   $0x0
+  8015d5:	e8 94 2d 00 00       	call   80436e <page_map>
+  8015da:	83 c4 20             	add    $0x20,%esp
+  8015dd:	85 c0                	test   %eax,%eax
+  8015df:	79 cf                	jns    8015b0 <fork+0x1f4>
+			panic("page_map %d", r);
+  8015e1:	50                   	push   %eax
+  8015e2:	68 26 57 80 00       	push   $0x805726
+  8015e7:	6a 4d                	push   $0x4d
+  8015e9:	68 0b 57 80 00       	push   $0x80570b
+  8015ee:	e8 4a 39 00 00       	call   804f3d <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  8015f3:	83 ec 0c             	sub    $0xc,%esp
+  8015f6:	68 00 10 00 00       	push   $0x1000
+  8015fb:	e8 60 33 00 00       	call   804960 <malloc>
+  801600:	89 c7                	mov    %eax,%edi
+  801602:	83 c4 10             	add    $0x10,%esp
+  801605:	85 c0                	test   %eax,%eax
+  801607:	74 4b                	je     801654 <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  801609:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80160c:	c1 e3 0c             	shl    $0xc,%ebx
+  80160f:	83 ec 04             	sub    $0x4,%esp
+  801612:	68 00 10 00 00       	push   $0x1000
+  801617:	53                   	push   %ebx
+  801618:	50                   	push   %eax
+  801619:	e8 ac f3 ff ff       	call   8009ca <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  80161e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801621:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801628:	25 07 0e 00 00       	and    $0xe07,%eax
+  80162d:	89 04 24             	mov    %eax,(%esp)
+  801630:	53                   	push   %ebx
+  801631:	ff 75 e4             	push   -0x1c(%ebp)
+  801634:	57                   	push   %edi
+  801635:	6a 00                	push   $0x0
+  801637:	e8 32 2d 00 00       	call   80436e <page_map>
+  80163c:	83 c4 20             	add    $0x20,%esp
+  80163f:	85 c0                	test   %eax,%eax
+  801641:	78 25                	js     801668 <fork+0x2ac>
+		free(temp);
+  801643:	83 ec 0c             	sub    $0xc,%esp
+  801646:	57                   	push   %edi
+  801647:	e8 12 31 00 00       	call   80475e <free>
+  80164c:	83 c4 10             	add    $0x10,%esp
+  80164f:	e9 5c ff ff ff       	jmp    8015b0 <fork+0x1f4>
+			panic("malloc failed");
+  801654:	83 ec 04             	sub    $0x4,%esp
+  801657:	68 32 57 80 00       	push   $0x805732
+  80165c:	6a 56                	push   $0x56
+  80165e:	68 0b 57 80 00       	push   $0x80570b
+  801663:	e8 d5 38 00 00       	call   804f3d <_panic>
+			panic("page_map: %e", r);
+  801668:	50                   	push   %eax
+  801669:	68 40 57 80 00       	push   $0x805740
+  80166e:	6a 59                	push   $0x59
+  801670:	68 0b 57 80 00       	push   $0x80570b
+  801675:	e8 c3 38 00 00       	call   804f3d <_panic>
+			panic("page_map %d", r);
+  80167a:	50                   	push   %eax
+  80167b:	68 26 57 80 00       	push   $0x805726
+  801680:	6a 65                	push   $0x65
+  801682:	68 0b 57 80 00       	push   $0x80570b
+  801687:	e8 b1 38 00 00       	call   804f3d <_panic>
+			panic("page_map %d", r);
+  80168c:	50                   	push   %eax
+  80168d:	68 26 57 80 00       	push   $0x805726
+  801692:	6a 78                	push   $0x78
+  801694:	68 0b 57 80 00       	push   $0x80570b
+  801699:	e8 9f 38 00 00       	call   804f3d <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  80169e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8016a1:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8016a8:	c1 e1 0c             	shl    $0xc,%ecx
+  8016ab:	83 ec 0c             	sub    $0xc,%esp
+  8016ae:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016b3:	50                   	push   %eax
+  8016b4:	51                   	push   %ecx
+  8016b5:	ff 75 e4             	push   -0x1c(%ebp)
+  8016b8:	51                   	push   %ecx
+  8016b9:	6a 00                	push   $0x0
+  8016bb:	e8 ae 2c 00 00       	call   80436e <page_map>
+  8016c0:	83 c4 20             	add    $0x20,%esp
+  8016c3:	85 c0                	test   %eax,%eax
+  8016c5:	0f 89 e5 fe ff ff    	jns    8015b0 <fork+0x1f4>
+			panic("page_map %d", r);
+  8016cb:	50                   	push   %eax
+  8016cc:	68 26 57 80 00       	push   $0x805726
+  8016d1:	6a 7f                	push   $0x7f
+  8016d3:	68 0b 57 80 00       	push   $0x80570b
+  8016d8:	e8 60 38 00 00       	call   804f3d <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  8016dd:	83 c7 01             	add    $0x1,%edi
+  8016e0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016e3:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  8016e6:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  8016e9:	39 f7                	cmp    %esi,%edi
+  8016eb:	74 1c                	je     801709 <fork+0x34d>
+  8016ed:	89 d8                	mov    %ebx,%eax
+  8016ef:	e8 c5 fb ff ff       	call   8012b9 <dupable>
+  8016f4:	84 c0                	test   %al,%al
+  8016f6:	74 7c                	je     801774 <fork+0x3b8>
+  8016f8:	89 d8                	mov    %ebx,%eax
+  8016fa:	e8 71 fb ff ff       	call   801270 <dupperm>
+  8016ff:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  801702:	74 d9                	je     8016dd <fork+0x321>
+  801704:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801707:	eb 06                	jmp    80170f <fork+0x353>
+  801709:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80170c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  80170f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801712:	c1 e0 0c             	shl    $0xc,%eax
+  801715:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801718:	83 ec 08             	sub    $0x8,%esp
+  80171b:	ff 75 dc             	push   -0x24(%ebp)
+  80171e:	57                   	push   %edi
+  80171f:	50                   	push   %eax
+  801720:	ff 75 e4             	push   -0x1c(%ebp)
+  801723:	50                   	push   %eax
+  801724:	6a 00                	push   $0x0
+  801726:	e8 3a 2e 00 00       	call   804565 <page_map_range>
+  80172b:	83 c4 20             	add    $0x20,%esp
+  80172e:	85 c0                	test   %eax,%eax
+  801730:	78 47                	js     801779 <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  801732:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801739:	0f 84 41 fd ff ff    	je     801480 <fork+0xc4>
+  80173f:	83 ec 08             	sub    $0x8,%esp
+  801742:	ff 75 dc             	push   -0x24(%ebp)
+  801745:	57                   	push   %edi
+  801746:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801749:	50                   	push   %eax
+  80174a:	6a 00                	push   $0x0
+  80174c:	50                   	push   %eax
+  80174d:	6a 00                	push   $0x0
+  80174f:	e8 11 2e 00 00       	call   804565 <page_map_range>
+  801754:	83 c4 20             	add    $0x20,%esp
+  801757:	85 c0                	test   %eax,%eax
+  801759:	0f 89 21 fd ff ff    	jns    801480 <fork+0xc4>
+		panic("page_map_range %e", r);
+  80175f:	50                   	push   %eax
+  801760:	68 4d 57 80 00       	push   $0x80574d
+  801765:	68 a2 00 00 00       	push   $0xa2
+  80176a:	68 0b 57 80 00       	push   $0x80570b
+  80176f:	e8 c9 37 00 00       	call   804f3d <_panic>
+  801774:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801777:	eb 96                	jmp    80170f <fork+0x353>
+		panic("page_map_range %e", r);
+  801779:	50                   	push   %eax
+  80177a:	68 4d 57 80 00       	push   $0x80574d
+  80177f:	68 a0 00 00 00       	push   $0xa0
+  801784:	68 0b 57 80 00       	push   $0x80570b
+  801789:	e8 af 37 00 00       	call   804f3d <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  80178e:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  801791:	6a 01                	push   $0x1
+  801793:	6a 07                	push   $0x7
+  801795:	68 00 f0 bf ee       	push   $0xeebff000
+  80179a:	53                   	push   %ebx
+  80179b:	e8 6d 25 00 00       	call   803d0d <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8017a0:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  8017a5:	8b 40 74             	mov    0x74(%eax),%eax
+  8017a8:	83 c4 08             	add    $0x8,%esp
+  8017ab:	50                   	push   %eax
+  8017ac:	53                   	push   %ebx
+  8017ad:	e8 89 f8 ff ff       	call   80103b <sys_env_set_pgfault_upcall>
+  8017b2:	83 c4 10             	add    $0x10,%esp
+  8017b5:	e9 41 fc ff ff       	jmp    8013fb <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8017ba:	e8 d8 f4 ff ff       	call   800c97 <sys_getenvid>
+  8017bf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017c4:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8017c7:	c1 e0 06             	shl    $0x6,%eax
+  8017ca:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017cf:	a3 1c e9 80 00       	mov    %eax,0x80e91c
+		return 0;
+  8017d4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8017db:	e9 40 fc ff ff       	jmp    801420 <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  8017e0:	50                   	push   %eax
+  8017e1:	68 5f 57 80 00       	push   $0x80575f
+  8017e6:	68 27 01 00 00       	push   $0x127
+  8017eb:	68 0b 57 80 00       	push   $0x80570b
+  8017f0:	e8 48 37 00 00       	call   804f3d <_panic>
+		panic("sys_env_set_status: %d", r);
+  8017f5:	50                   	push   %eax
+  8017f6:	68 78 57 80 00       	push   $0x805778
+  8017fb:	68 2b 01 00 00       	push   $0x12b
+  801800:	68 0b 57 80 00       	push   $0x80570b
+  801805:	e8 33 37 00 00       	call   804f3d <_panic>
+
+0080180a <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80180a:	55                   	push   %ebp
+  80180b:	89 e5                	mov    %esp,%ebp
+  80180d:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801810:	68 8f 57 80 00       	push   $0x80578f
+  801815:	68 35 01 00 00       	push   $0x135
+  80181a:	68 0b 57 80 00       	push   $0x80570b
+  80181f:	e8 19 37 00 00       	call   804f3d <_panic>
+
+00801824 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  801824:	55                   	push   %ebp
+  801825:	89 e5                	mov    %esp,%ebp
+  801827:	57                   	push   %edi
+  801828:	56                   	push   %esi
+  801829:	53                   	push   %ebx
+  80182a:	83 ec 14             	sub    $0x14,%esp
+  80182d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801830:	8b 75 14             	mov    0x14(%ebp),%esi
+  801833:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  801836:	ff 75 10             	push   0x10(%ebp)
+  801839:	ff 75 0c             	push   0xc(%ebp)
+  80183c:	e8 b7 f8 ff ff       	call   8010f8 <sys_ipc_recv_pages>
+  801841:	83 c4 10             	add    $0x10,%esp
+  801844:	85 c0                	test   %eax,%eax
+  801846:	78 46                	js     80188e <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  801848:	85 ff                	test   %edi,%edi
+  80184a:	74 0d                	je     801859 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  80184c:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  801851:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  801857:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  801859:	85 f6                	test   %esi,%esi
+  80185b:	74 0d                	je     80186a <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  80185d:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  801862:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801868:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80186a:	85 db                	test   %ebx,%ebx
+  80186c:	74 0d                	je     80187b <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  80186e:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  801873:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801879:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80187b:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  801880:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  801886:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801889:	5b                   	pop    %ebx
+  80188a:	5e                   	pop    %esi
+  80188b:	5f                   	pop    %edi
+  80188c:	5d                   	pop    %ebp
+  80188d:	c3                   	ret
+		if (from_env_store) {
+  80188e:	85 ff                	test   %edi,%edi
+  801890:	74 06                	je     801898 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  801892:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  801898:	85 f6                	test   %esi,%esi
+  80189a:	74 06                	je     8018a2 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  80189c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8018a2:	85 db                	test   %ebx,%ebx
+  8018a4:	74 e0                	je     801886 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8018a6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8018ac:	eb d8                	jmp    801886 <ipc_recv_pages+0x62>
+
+008018ae <ipc_recv>:
+{
+  8018ae:	55                   	push   %ebp
+  8018af:	89 e5                	mov    %esp,%ebp
+  8018b1:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8018b4:	6a 00                	push   $0x0
+  8018b6:	ff 75 10             	push   0x10(%ebp)
+  8018b9:	6a 01                	push   $0x1
+  8018bb:	ff 75 0c             	push   0xc(%ebp)
+  8018be:	ff 75 08             	push   0x8(%ebp)
+  8018c1:	e8 5e ff ff ff       	call   801824 <ipc_recv_pages>
+}
+  8018c6:	c9                   	leave
+  8018c7:	c3                   	ret
+
+008018c8 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8018c8:	55                   	push   %ebp
+  8018c9:	89 e5                	mov    %esp,%ebp
+  8018cb:	56                   	push   %esi
+  8018cc:	53                   	push   %ebx
+  8018cd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8018d3:	83 ec 0c             	sub    $0xc,%esp
+  8018d6:	ff 75 0c             	push   0xc(%ebp)
+  8018d9:	e8 4e f9 ff ff       	call   80122c <sys_ipc_try_recv>
+  8018de:	83 c4 10             	add    $0x10,%esp
+  8018e1:	85 c0                	test   %eax,%eax
+  8018e3:	78 34                	js     801919 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8018e5:	85 f6                	test   %esi,%esi
+  8018e7:	74 0d                	je     8018f6 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8018e9:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  8018ee:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8018f4:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8018f6:	85 db                	test   %ebx,%ebx
+  8018f8:	74 0d                	je     801907 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8018fa:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  8018ff:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801905:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  801907:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  80190c:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  801912:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801915:	5b                   	pop    %ebx
+  801916:	5e                   	pop    %esi
+  801917:	5d                   	pop    %ebp
+  801918:	c3                   	ret
+		if (from_env_store) {
+  801919:	85 f6                	test   %esi,%esi
+  80191b:	74 06                	je     801923 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  80191d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  801923:	85 db                	test   %ebx,%ebx
+  801925:	74 eb                	je     801912 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  801927:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80192d:	eb e3                	jmp    801912 <ipc_try_recv+0x4a>
+
+0080192f <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80192f:	55                   	push   %ebp
+  801930:	89 e5                	mov    %esp,%ebp
+  801932:	83 ec 14             	sub    $0x14,%esp
+  801935:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  801938:	85 c0                	test   %eax,%eax
+  80193a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80193f:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  801942:	ff 75 18             	push   0x18(%ebp)
+  801945:	ff 75 14             	push   0x14(%ebp)
+  801948:	50                   	push   %eax
+  801949:	ff 75 0c             	push   0xc(%ebp)
+  80194c:	ff 75 08             	push   0x8(%ebp)
+  80194f:	e8 67 f7 ff ff       	call   8010bb <sys_ipc_send_pages>
+  801954:	83 c4 20             	add    $0x20,%esp
+  801957:	85 c0                	test   %eax,%eax
+  801959:	78 02                	js     80195d <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  80195b:	c9                   	leave
+  80195c:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  80195d:	50                   	push   %eax
+  80195e:	68 a8 57 80 00       	push   $0x8057a8
+  801963:	68 80 00 00 00       	push   $0x80
+  801968:	68 d4 57 80 00       	push   $0x8057d4
+  80196d:	e8 cb 35 00 00       	call   804f3d <_panic>
+
+00801972 <ipc_send>:
+{
+  801972:	55                   	push   %ebp
+  801973:	89 e5                	mov    %esp,%ebp
+  801975:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  801978:	ff 75 14             	push   0x14(%ebp)
+  80197b:	6a 01                	push   $0x1
+  80197d:	ff 75 10             	push   0x10(%ebp)
+  801980:	ff 75 0c             	push   0xc(%ebp)
+  801983:	ff 75 08             	push   0x8(%ebp)
+  801986:	e8 a4 ff ff ff       	call   80192f <ipc_send_pages>
+}
+  80198b:	83 c4 20             	add    $0x20,%esp
+  80198e:	c9                   	leave
+  80198f:	c3                   	ret
+
+00801990 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  801990:	55                   	push   %ebp
+  801991:	89 e5                	mov    %esp,%ebp
+  801993:	83 ec 14             	sub    $0x14,%esp
+  801996:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  801999:	85 c0                	test   %eax,%eax
+  80199b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8019a0:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8019a3:	ff 75 18             	push   0x18(%ebp)
+  8019a6:	ff 75 14             	push   0x14(%ebp)
+  8019a9:	50                   	push   %eax
+  8019aa:	ff 75 0c             	push   0xc(%ebp)
+  8019ad:	ff 75 08             	push   0x8(%ebp)
+  8019b0:	e8 97 f7 ff ff       	call   80114c <sys_ipc_call>
+  8019b5:	83 c4 20             	add    $0x20,%esp
+  8019b8:	85 c0                	test   %eax,%eax
+  8019ba:	78 0b                	js     8019c7 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  8019bc:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  8019c1:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8019c7:	c9                   	leave
+  8019c8:	c3                   	ret
+
+008019c9 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  8019c9:	55                   	push   %ebp
+  8019ca:	89 e5                	mov    %esp,%ebp
+  8019cc:	57                   	push   %edi
+  8019cd:	56                   	push   %esi
+  8019ce:	53                   	push   %ebx
+  8019cf:	83 ec 18             	sub    $0x18,%esp
+  8019d2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8019d5:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8019d8:	8b 75 20             	mov    0x20(%ebp),%esi
+  8019db:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8019de:	85 c0                	test   %eax,%eax
+  8019e0:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8019e5:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8019e8:	ff 75 18             	push   0x18(%ebp)
+  8019eb:	ff 75 14             	push   0x14(%ebp)
+  8019ee:	50                   	push   %eax
+  8019ef:	ff 75 0c             	push   0xc(%ebp)
+  8019f2:	ff 75 08             	push   0x8(%ebp)
+  8019f5:	e8 93 f7 ff ff       	call   80118d <sys_ipc_reply_recv>
+  8019fa:	83 c4 20             	add    $0x20,%esp
+  8019fd:	85 c0                	test   %eax,%eax
+  8019ff:	78 46                	js     801a47 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  801a01:	85 ff                	test   %edi,%edi
+  801a03:	74 0d                	je     801a12 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  801a05:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  801a0a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  801a10:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  801a12:	85 f6                	test   %esi,%esi
+  801a14:	74 0d                	je     801a23 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  801a16:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  801a1b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801a21:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  801a23:	85 db                	test   %ebx,%ebx
+  801a25:	74 0d                	je     801a34 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  801a27:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  801a2c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801a32:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  801a34:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  801a39:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  801a3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a42:	5b                   	pop    %ebx
+  801a43:	5e                   	pop    %esi
+  801a44:	5f                   	pop    %edi
+  801a45:	5d                   	pop    %ebp
+  801a46:	c3                   	ret
+		if (from_env_store) {
+  801a47:	85 ff                	test   %edi,%edi
+  801a49:	74 06                	je     801a51 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  801a4b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  801a51:	85 f6                	test   %esi,%esi
+  801a53:	74 06                	je     801a5b <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  801a55:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  801a5b:	85 db                	test   %ebx,%ebx
+  801a5d:	74 e0                	je     801a3f <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  801a5f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801a65:	eb d8                	jmp    801a3f <ipc_reply_recv+0x76>
+
+00801a67 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801a67:	55                   	push   %ebp
+  801a68:	89 e5                	mov    %esp,%ebp
+  801a6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801a6d:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  801a72:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  801a75:	c1 e0 06             	shl    $0x6,%eax
+  801a78:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a7d:	8b 40 50             	mov    0x50(%eax),%eax
+  801a80:	39 c8                	cmp    %ecx,%eax
+  801a82:	74 12                	je     801a96 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801a84:	83 c2 01             	add    $0x1,%edx
+  801a87:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801a8d:	75 e3                	jne    801a72 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a94:	eb 0e                	jmp    801aa4 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801a96:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  801a99:	c1 e0 06             	shl    $0x6,%eax
+  801a9c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801aa1:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801aa4:	5d                   	pop    %ebp
+  801aa5:	c3                   	ret
+
+00801aa6 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801aa6:	55                   	push   %ebp
+  801aa7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801aa9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aac:	05 00 00 00 30       	add    $0x30000000,%eax
+  801ab1:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801ab4:	5d                   	pop    %ebp
+  801ab5:	c3                   	ret
+
+00801ab6 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801ab6:	55                   	push   %ebp
+  801ab7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ab9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801abc:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801ac1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801ac6:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801acb:	5d                   	pop    %ebp
+  801acc:	c3                   	ret
+
+00801acd <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801acd:	55                   	push   %ebp
+  801ace:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801ad0:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801ad5:	a8 01                	test   $0x1,%al
+  801ad7:	74 3c                	je     801b15 <fd_alloc+0x48>
+  801ad9:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801ade:	89 c2                	mov    %eax,%edx
+  801ae0:	c1 ea 0c             	shr    $0xc,%edx
+  801ae3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801aea:	89 c1                	mov    %eax,%ecx
+  801aec:	05 00 10 00 00       	add    $0x1000,%eax
+  801af1:	f6 c2 01             	test   $0x1,%dl
+  801af4:	74 13                	je     801b09 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801af6:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801afb:	75 e1                	jne    801ade <fd_alloc+0x11>
+  801afd:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801b02:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801b07:	eb 05                	jmp    801b0e <fd_alloc+0x41>
+			return 0;
+  801b09:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801b0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b11:	89 0a                	mov    %ecx,(%edx)
+}
+  801b13:	5d                   	pop    %ebp
+  801b14:	c3                   	ret
+  801b15:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801b1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1f:	eb ed                	jmp    801b0e <fd_alloc+0x41>
+
+00801b21 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801b21:	55                   	push   %ebp
+  801b22:	89 e5                	mov    %esp,%ebp
+  801b24:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801b27:	83 f8 1f             	cmp    $0x1f,%eax
+  801b2a:	77 30                	ja     801b5c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801b2c:	c1 e0 0c             	shl    $0xc,%eax
+  801b2f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801b34:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801b3a:	f6 c2 01             	test   $0x1,%dl
+  801b3d:	74 24                	je     801b63 <fd_lookup+0x42>
+  801b3f:	89 c2                	mov    %eax,%edx
+  801b41:	c1 ea 0c             	shr    $0xc,%edx
+  801b44:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b4b:	f6 c2 01             	test   $0x1,%dl
+  801b4e:	74 1a                	je     801b6a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801b50:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b53:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801b55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b5a:	5d                   	pop    %ebp
+  801b5b:	c3                   	ret
+		return -E_INVAL;
+  801b5c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b61:	eb f7                	jmp    801b5a <fd_lookup+0x39>
+		return -E_INVAL;
+  801b63:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b68:	eb f0                	jmp    801b5a <fd_lookup+0x39>
+  801b6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b6f:	eb e9                	jmp    801b5a <fd_lookup+0x39>
+
+00801b71 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801b71:	55                   	push   %ebp
+  801b72:	89 e5                	mov    %esp,%ebp
+  801b74:	53                   	push   %ebx
+  801b75:	83 ec 04             	sub    $0x4,%esp
+  801b78:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801b7b:	b8 5c 58 80 00       	mov    $0x80585c,%eax
+  801b80:	8b 18                	mov    (%eax),%ebx
+  801b82:	85 db                	test   %ebx,%ebx
+  801b84:	74 0e                	je     801b94 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801b86:	83 c0 04             	add    $0x4,%eax
+  801b89:	39 13                	cmp    %edx,(%ebx)
+  801b8b:	75 f3                	jne    801b80 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801b8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b92:	eb 1f                	jmp    801bb3 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b94:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  801b99:	8b 40 48             	mov    0x48(%eax),%eax
+  801b9c:	83 ec 04             	sub    $0x4,%esp
+  801b9f:	52                   	push   %edx
+  801ba0:	50                   	push   %eax
+  801ba1:	68 e0 57 80 00       	push   $0x8057e0
+  801ba6:	e8 50 e6 ff ff       	call   8001fb <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801bab:	83 c4 10             	add    $0x10,%esp
+  801bae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801bb3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bb6:	89 1a                	mov    %ebx,(%edx)
+}
+  801bb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bbb:	c9                   	leave
+  801bbc:	c3                   	ret
+
+00801bbd <fd_close>:
+{
+  801bbd:	55                   	push   %ebp
+  801bbe:	89 e5                	mov    %esp,%ebp
+  801bc0:	57                   	push   %edi
+  801bc1:	56                   	push   %esi
+  801bc2:	53                   	push   %ebx
+  801bc3:	83 ec 24             	sub    $0x24,%esp
+  801bc6:	8b 75 08             	mov    0x8(%ebp),%esi
+  801bc9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801bcc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bcf:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801bd0:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801bd6:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801bd9:	50                   	push   %eax
+  801bda:	e8 42 ff ff ff       	call   801b21 <fd_lookup>
+  801bdf:	89 c3                	mov    %eax,%ebx
+  801be1:	83 c4 10             	add    $0x10,%esp
+  801be4:	85 c0                	test   %eax,%eax
+  801be6:	78 05                	js     801bed <fd_close+0x30>
+	    || fd != fd2)
+  801be8:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801beb:	74 16                	je     801c03 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801bed:	89 f8                	mov    %edi,%eax
+  801bef:	84 c0                	test   %al,%al
+  801bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf6:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801bf9:	89 d8                	mov    %ebx,%eax
+  801bfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bfe:	5b                   	pop    %ebx
+  801bff:	5e                   	pop    %esi
+  801c00:	5f                   	pop    %edi
+  801c01:	5d                   	pop    %ebp
+  801c02:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c03:	83 ec 08             	sub    $0x8,%esp
+  801c06:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801c09:	50                   	push   %eax
+  801c0a:	ff 36                	push   (%esi)
+  801c0c:	e8 60 ff ff ff       	call   801b71 <dev_lookup>
+  801c11:	89 c3                	mov    %eax,%ebx
+  801c13:	83 c4 10             	add    $0x10,%esp
+  801c16:	85 c0                	test   %eax,%eax
+  801c18:	78 1a                	js     801c34 <fd_close+0x77>
+		if (dev->dev_close)
+  801c1a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c1d:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801c20:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801c25:	85 c0                	test   %eax,%eax
+  801c27:	74 0b                	je     801c34 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801c29:	83 ec 0c             	sub    $0xc,%esp
+  801c2c:	56                   	push   %esi
+  801c2d:	ff d0                	call   *%eax
+  801c2f:	89 c3                	mov    %eax,%ebx
+  801c31:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801c34:	83 ec 08             	sub    $0x8,%esp
+  801c37:	56                   	push   %esi
+  801c38:	6a 00                	push   $0x0
+  801c3a:	e8 1b f1 ff ff       	call   800d5a <sys_page_unmap>
+	return r;
+  801c3f:	83 c4 10             	add    $0x10,%esp
+  801c42:	eb b5                	jmp    801bf9 <fd_close+0x3c>
+
+00801c44 <close>:
+
+int
+close(int fdnum)
+{
+  801c44:	55                   	push   %ebp
+  801c45:	89 e5                	mov    %esp,%ebp
+  801c47:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c4a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c4d:	50                   	push   %eax
+  801c4e:	ff 75 08             	push   0x8(%ebp)
+  801c51:	e8 cb fe ff ff       	call   801b21 <fd_lookup>
+  801c56:	83 c4 10             	add    $0x10,%esp
+  801c59:	85 c0                	test   %eax,%eax
+  801c5b:	79 02                	jns    801c5f <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801c5d:	c9                   	leave
+  801c5e:	c3                   	ret
+		return fd_close(fd, 1);
+  801c5f:	83 ec 08             	sub    $0x8,%esp
+  801c62:	6a 01                	push   $0x1
+  801c64:	ff 75 f4             	push   -0xc(%ebp)
+  801c67:	e8 51 ff ff ff       	call   801bbd <fd_close>
+  801c6c:	83 c4 10             	add    $0x10,%esp
+  801c6f:	eb ec                	jmp    801c5d <close+0x19>
+
+00801c71 <close_all>:
+
+void
+close_all(void)
+{
+  801c71:	55                   	push   %ebp
+  801c72:	89 e5                	mov    %esp,%ebp
+  801c74:	53                   	push   %ebx
+  801c75:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801c78:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801c7d:	83 ec 0c             	sub    $0xc,%esp
+  801c80:	53                   	push   %ebx
+  801c81:	e8 be ff ff ff       	call   801c44 <close>
+	for (i = 0; i < MAXFD; i++)
+  801c86:	83 c3 01             	add    $0x1,%ebx
+  801c89:	83 c4 10             	add    $0x10,%esp
+  801c8c:	83 fb 20             	cmp    $0x20,%ebx
+  801c8f:	75 ec                	jne    801c7d <close_all+0xc>
+}
+  801c91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c94:	c9                   	leave
+  801c95:	c3                   	ret
+
+00801c96 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801c96:	55                   	push   %ebp
+  801c97:	89 e5                	mov    %esp,%ebp
+  801c99:	57                   	push   %edi
+  801c9a:	56                   	push   %esi
+  801c9b:	53                   	push   %ebx
+  801c9c:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801c9f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ca2:	50                   	push   %eax
+  801ca3:	ff 75 08             	push   0x8(%ebp)
+  801ca6:	e8 76 fe ff ff       	call   801b21 <fd_lookup>
+  801cab:	89 c3                	mov    %eax,%ebx
+  801cad:	83 c4 10             	add    $0x10,%esp
+  801cb0:	85 c0                	test   %eax,%eax
+  801cb2:	78 7f                	js     801d33 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801cb4:	83 ec 0c             	sub    $0xc,%esp
+  801cb7:	ff 75 0c             	push   0xc(%ebp)
+  801cba:	e8 85 ff ff ff       	call   801c44 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801cbf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801cc2:	c1 e6 0c             	shl    $0xc,%esi
+  801cc5:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801ccb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801cce:	89 3c 24             	mov    %edi,(%esp)
+  801cd1:	e8 e0 fd ff ff       	call   801ab6 <fd2data>
+  801cd6:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801cd8:	89 34 24             	mov    %esi,(%esp)
+  801cdb:	e8 d6 fd ff ff       	call   801ab6 <fd2data>
+  801ce0:	83 c4 10             	add    $0x10,%esp
+  801ce3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801ce6:	89 d8                	mov    %ebx,%eax
+  801ce8:	c1 e8 16             	shr    $0x16,%eax
+  801ceb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801cf2:	a8 01                	test   $0x1,%al
+  801cf4:	74 11                	je     801d07 <dup+0x71>
+  801cf6:	89 d8                	mov    %ebx,%eax
+  801cf8:	c1 e8 0c             	shr    $0xc,%eax
+  801cfb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d02:	f6 c2 01             	test   $0x1,%dl
+  801d05:	75 36                	jne    801d3d <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801d07:	89 f8                	mov    %edi,%eax
+  801d09:	c1 e8 0c             	shr    $0xc,%eax
+  801d0c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d13:	83 ec 0c             	sub    $0xc,%esp
+  801d16:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d1b:	50                   	push   %eax
+  801d1c:	56                   	push   %esi
+  801d1d:	6a 00                	push   $0x0
+  801d1f:	57                   	push   %edi
+  801d20:	6a 00                	push   $0x0
+  801d22:	e8 f1 ef ff ff       	call   800d18 <sys_page_map>
+  801d27:	89 c3                	mov    %eax,%ebx
+  801d29:	83 c4 20             	add    $0x20,%esp
+  801d2c:	85 c0                	test   %eax,%eax
+  801d2e:	78 33                	js     801d63 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801d30:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801d33:	89 d8                	mov    %ebx,%eax
+  801d35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d38:	5b                   	pop    %ebx
+  801d39:	5e                   	pop    %esi
+  801d3a:	5f                   	pop    %edi
+  801d3b:	5d                   	pop    %ebp
+  801d3c:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801d3d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d44:	83 ec 0c             	sub    $0xc,%esp
+  801d47:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d4c:	50                   	push   %eax
+  801d4d:	ff 75 d4             	push   -0x2c(%ebp)
+  801d50:	6a 00                	push   $0x0
+  801d52:	53                   	push   %ebx
+  801d53:	6a 00                	push   $0x0
+  801d55:	e8 be ef ff ff       	call   800d18 <sys_page_map>
+  801d5a:	89 c3                	mov    %eax,%ebx
+  801d5c:	83 c4 20             	add    $0x20,%esp
+  801d5f:	85 c0                	test   %eax,%eax
+  801d61:	79 a4                	jns    801d07 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801d63:	83 ec 08             	sub    $0x8,%esp
+  801d66:	56                   	push   %esi
+  801d67:	6a 00                	push   $0x0
+  801d69:	e8 ec ef ff ff       	call   800d5a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801d6e:	83 c4 08             	add    $0x8,%esp
+  801d71:	ff 75 d4             	push   -0x2c(%ebp)
+  801d74:	6a 00                	push   $0x0
+  801d76:	e8 df ef ff ff       	call   800d5a <sys_page_unmap>
+	return r;
+  801d7b:	83 c4 10             	add    $0x10,%esp
+  801d7e:	eb b3                	jmp    801d33 <dup+0x9d>
+
+00801d80 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801d80:	55                   	push   %ebp
+  801d81:	89 e5                	mov    %esp,%ebp
+  801d83:	56                   	push   %esi
+  801d84:	53                   	push   %ebx
+  801d85:	83 ec 18             	sub    $0x18,%esp
+  801d88:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d8b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d8e:	50                   	push   %eax
+  801d8f:	56                   	push   %esi
+  801d90:	e8 8c fd ff ff       	call   801b21 <fd_lookup>
+  801d95:	83 c4 10             	add    $0x10,%esp
+  801d98:	85 c0                	test   %eax,%eax
+  801d9a:	78 3c                	js     801dd8 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d9c:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801d9f:	83 ec 08             	sub    $0x8,%esp
+  801da2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801da5:	50                   	push   %eax
+  801da6:	ff 33                	push   (%ebx)
+  801da8:	e8 c4 fd ff ff       	call   801b71 <dev_lookup>
+  801dad:	83 c4 10             	add    $0x10,%esp
+  801db0:	85 c0                	test   %eax,%eax
+  801db2:	78 24                	js     801dd8 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801db4:	8b 43 08             	mov    0x8(%ebx),%eax
+  801db7:	83 e0 03             	and    $0x3,%eax
+  801dba:	83 f8 01             	cmp    $0x1,%eax
+  801dbd:	74 20                	je     801ddf <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801dbf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc2:	8b 40 08             	mov    0x8(%eax),%eax
+  801dc5:	85 c0                	test   %eax,%eax
+  801dc7:	74 37                	je     801e00 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801dc9:	83 ec 04             	sub    $0x4,%esp
+  801dcc:	ff 75 10             	push   0x10(%ebp)
+  801dcf:	ff 75 0c             	push   0xc(%ebp)
+  801dd2:	53                   	push   %ebx
+  801dd3:	ff d0                	call   *%eax
+  801dd5:	83 c4 10             	add    $0x10,%esp
+}
+  801dd8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ddb:	5b                   	pop    %ebx
+  801ddc:	5e                   	pop    %esi
+  801ddd:	5d                   	pop    %ebp
+  801dde:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ddf:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  801de4:	8b 40 48             	mov    0x48(%eax),%eax
+  801de7:	83 ec 04             	sub    $0x4,%esp
+  801dea:	56                   	push   %esi
+  801deb:	50                   	push   %eax
+  801dec:	68 21 58 80 00       	push   $0x805821
+  801df1:	e8 05 e4 ff ff       	call   8001fb <cprintf>
+		return -E_INVAL;
+  801df6:	83 c4 10             	add    $0x10,%esp
+  801df9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dfe:	eb d8                	jmp    801dd8 <read+0x58>
+		return -E_NOT_SUPP;
+  801e00:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e05:	eb d1                	jmp    801dd8 <read+0x58>
+
+00801e07 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801e07:	55                   	push   %ebp
+  801e08:	89 e5                	mov    %esp,%ebp
+  801e0a:	57                   	push   %edi
+  801e0b:	56                   	push   %esi
+  801e0c:	53                   	push   %ebx
+  801e0d:	83 ec 0c             	sub    $0xc,%esp
+  801e10:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e13:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801e16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e1b:	eb 02                	jmp    801e1f <readn+0x18>
+  801e1d:	01 c3                	add    %eax,%ebx
+  801e1f:	39 f3                	cmp    %esi,%ebx
+  801e21:	73 21                	jae    801e44 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801e23:	83 ec 04             	sub    $0x4,%esp
+  801e26:	89 f0                	mov    %esi,%eax
+  801e28:	29 d8                	sub    %ebx,%eax
+  801e2a:	50                   	push   %eax
+  801e2b:	89 d8                	mov    %ebx,%eax
+  801e2d:	03 45 0c             	add    0xc(%ebp),%eax
+  801e30:	50                   	push   %eax
+  801e31:	57                   	push   %edi
+  801e32:	e8 49 ff ff ff       	call   801d80 <read>
+		if (m < 0)
+  801e37:	83 c4 10             	add    $0x10,%esp
+  801e3a:	85 c0                	test   %eax,%eax
+  801e3c:	78 04                	js     801e42 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801e3e:	75 dd                	jne    801e1d <readn+0x16>
+  801e40:	eb 02                	jmp    801e44 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801e42:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801e44:	89 d8                	mov    %ebx,%eax
+  801e46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e49:	5b                   	pop    %ebx
+  801e4a:	5e                   	pop    %esi
+  801e4b:	5f                   	pop    %edi
+  801e4c:	5d                   	pop    %ebp
+  801e4d:	c3                   	ret
+
+00801e4e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801e4e:	55                   	push   %ebp
+  801e4f:	89 e5                	mov    %esp,%ebp
+  801e51:	56                   	push   %esi
+  801e52:	53                   	push   %ebx
+  801e53:	83 ec 18             	sub    $0x18,%esp
+  801e56:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e59:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e5c:	50                   	push   %eax
+  801e5d:	53                   	push   %ebx
+  801e5e:	e8 be fc ff ff       	call   801b21 <fd_lookup>
+  801e63:	83 c4 10             	add    $0x10,%esp
+  801e66:	85 c0                	test   %eax,%eax
+  801e68:	78 37                	js     801ea1 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e6a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e6d:	83 ec 08             	sub    $0x8,%esp
+  801e70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e73:	50                   	push   %eax
+  801e74:	ff 36                	push   (%esi)
+  801e76:	e8 f6 fc ff ff       	call   801b71 <dev_lookup>
+  801e7b:	83 c4 10             	add    $0x10,%esp
+  801e7e:	85 c0                	test   %eax,%eax
+  801e80:	78 1f                	js     801ea1 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e82:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e86:	74 20                	je     801ea8 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801e88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e8b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e8e:	85 c0                	test   %eax,%eax
+  801e90:	74 37                	je     801ec9 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801e92:	83 ec 04             	sub    $0x4,%esp
+  801e95:	ff 75 10             	push   0x10(%ebp)
+  801e98:	ff 75 0c             	push   0xc(%ebp)
+  801e9b:	56                   	push   %esi
+  801e9c:	ff d0                	call   *%eax
+  801e9e:	83 c4 10             	add    $0x10,%esp
+}
+  801ea1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ea4:	5b                   	pop    %ebx
+  801ea5:	5e                   	pop    %esi
+  801ea6:	5d                   	pop    %ebp
+  801ea7:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ea8:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  801ead:	8b 40 48             	mov    0x48(%eax),%eax
+  801eb0:	83 ec 04             	sub    $0x4,%esp
+  801eb3:	53                   	push   %ebx
+  801eb4:	50                   	push   %eax
+  801eb5:	68 3d 58 80 00       	push   $0x80583d
+  801eba:	e8 3c e3 ff ff       	call   8001fb <cprintf>
+		return -E_INVAL;
+  801ebf:	83 c4 10             	add    $0x10,%esp
+  801ec2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ec7:	eb d8                	jmp    801ea1 <write+0x53>
+		return -E_NOT_SUPP;
+  801ec9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ece:	eb d1                	jmp    801ea1 <write+0x53>
+
+00801ed0 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801ed0:	55                   	push   %ebp
+  801ed1:	89 e5                	mov    %esp,%ebp
+  801ed3:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ed6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ed9:	50                   	push   %eax
+  801eda:	ff 75 08             	push   0x8(%ebp)
+  801edd:	e8 3f fc ff ff       	call   801b21 <fd_lookup>
+  801ee2:	83 c4 10             	add    $0x10,%esp
+  801ee5:	85 c0                	test   %eax,%eax
+  801ee7:	78 0e                	js     801ef7 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801ee9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801eec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eef:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ef7:	c9                   	leave
+  801ef8:	c3                   	ret
+
+00801ef9 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801ef9:	55                   	push   %ebp
+  801efa:	89 e5                	mov    %esp,%ebp
+  801efc:	56                   	push   %esi
+  801efd:	53                   	push   %ebx
+  801efe:	83 ec 18             	sub    $0x18,%esp
+  801f01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f04:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f07:	50                   	push   %eax
+  801f08:	53                   	push   %ebx
+  801f09:	e8 13 fc ff ff       	call   801b21 <fd_lookup>
+  801f0e:	83 c4 10             	add    $0x10,%esp
+  801f11:	85 c0                	test   %eax,%eax
+  801f13:	78 34                	js     801f49 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f15:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f18:	83 ec 08             	sub    $0x8,%esp
+  801f1b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f1e:	50                   	push   %eax
+  801f1f:	ff 36                	push   (%esi)
+  801f21:	e8 4b fc ff ff       	call   801b71 <dev_lookup>
+  801f26:	83 c4 10             	add    $0x10,%esp
+  801f29:	85 c0                	test   %eax,%eax
+  801f2b:	78 1c                	js     801f49 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f2d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f31:	74 1d                	je     801f50 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801f33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f36:	8b 40 18             	mov    0x18(%eax),%eax
+  801f39:	85 c0                	test   %eax,%eax
+  801f3b:	74 34                	je     801f71 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801f3d:	83 ec 08             	sub    $0x8,%esp
+  801f40:	ff 75 0c             	push   0xc(%ebp)
+  801f43:	56                   	push   %esi
+  801f44:	ff d0                	call   *%eax
+  801f46:	83 c4 10             	add    $0x10,%esp
+}
+  801f49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f4c:	5b                   	pop    %ebx
+  801f4d:	5e                   	pop    %esi
+  801f4e:	5d                   	pop    %ebp
+  801f4f:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801f50:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  801f55:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f58:	83 ec 04             	sub    $0x4,%esp
+  801f5b:	53                   	push   %ebx
+  801f5c:	50                   	push   %eax
+  801f5d:	68 00 58 80 00       	push   $0x805800
+  801f62:	e8 94 e2 ff ff       	call   8001fb <cprintf>
+		return -E_INVAL;
+  801f67:	83 c4 10             	add    $0x10,%esp
+  801f6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f6f:	eb d8                	jmp    801f49 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801f71:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f76:	eb d1                	jmp    801f49 <ftruncate+0x50>
+
+00801f78 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801f78:	55                   	push   %ebp
+  801f79:	89 e5                	mov    %esp,%ebp
+  801f7b:	56                   	push   %esi
+  801f7c:	53                   	push   %ebx
+  801f7d:	83 ec 18             	sub    $0x18,%esp
+  801f80:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f83:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f86:	50                   	push   %eax
+  801f87:	ff 75 08             	push   0x8(%ebp)
+  801f8a:	e8 92 fb ff ff       	call   801b21 <fd_lookup>
+  801f8f:	83 c4 10             	add    $0x10,%esp
+  801f92:	85 c0                	test   %eax,%eax
+  801f94:	78 49                	js     801fdf <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f96:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f99:	83 ec 08             	sub    $0x8,%esp
+  801f9c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f9f:	50                   	push   %eax
+  801fa0:	ff 36                	push   (%esi)
+  801fa2:	e8 ca fb ff ff       	call   801b71 <dev_lookup>
+  801fa7:	83 c4 10             	add    $0x10,%esp
+  801faa:	85 c0                	test   %eax,%eax
+  801fac:	78 31                	js     801fdf <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801fae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fb1:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801fb5:	74 2f                	je     801fe6 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801fb7:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801fba:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801fc1:	00 00 00 
+	stat->st_isdir = 0;
+  801fc4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801fcb:	00 00 00 
+	stat->st_dev = dev;
+  801fce:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801fd4:	83 ec 08             	sub    $0x8,%esp
+  801fd7:	53                   	push   %ebx
+  801fd8:	56                   	push   %esi
+  801fd9:	ff 50 14             	call   *0x14(%eax)
+  801fdc:	83 c4 10             	add    $0x10,%esp
+}
+  801fdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe2:	5b                   	pop    %ebx
+  801fe3:	5e                   	pop    %esi
+  801fe4:	5d                   	pop    %ebp
+  801fe5:	c3                   	ret
+		return -E_NOT_SUPP;
+  801fe6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801feb:	eb f2                	jmp    801fdf <fstat+0x67>
+
+00801fed <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801fed:	55                   	push   %ebp
+  801fee:	89 e5                	mov    %esp,%ebp
+  801ff0:	56                   	push   %esi
+  801ff1:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801ff2:	83 ec 08             	sub    $0x8,%esp
+  801ff5:	6a 00                	push   $0x0
+  801ff7:	ff 75 08             	push   0x8(%ebp)
+  801ffa:	e8 bc 02 00 00       	call   8022bb <open>
+  801fff:	89 c3                	mov    %eax,%ebx
+  802001:	83 c4 10             	add    $0x10,%esp
+  802004:	85 c0                	test   %eax,%eax
+  802006:	78 1b                	js     802023 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802008:	83 ec 08             	sub    $0x8,%esp
+  80200b:	ff 75 0c             	push   0xc(%ebp)
+  80200e:	50                   	push   %eax
+  80200f:	e8 64 ff ff ff       	call   801f78 <fstat>
+  802014:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802016:	89 1c 24             	mov    %ebx,(%esp)
+  802019:	e8 26 fc ff ff       	call   801c44 <close>
+	return r;
+  80201e:	83 c4 10             	add    $0x10,%esp
+  802021:	89 f3                	mov    %esi,%ebx
+}
+  802023:	89 d8                	mov    %ebx,%eax
+  802025:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802028:	5b                   	pop    %ebx
+  802029:	5e                   	pop    %esi
+  80202a:	5d                   	pop    %ebp
+  80202b:	c3                   	ret
+
+0080202c <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  80202c:	55                   	push   %ebp
+  80202d:	89 e5                	mov    %esp,%ebp
+  80202f:	57                   	push   %edi
+  802030:	56                   	push   %esi
+  802031:	53                   	push   %ebx
+  802032:	83 ec 0c             	sub    $0xc,%esp
+  802035:	89 c7                	mov    %eax,%edi
+  802037:	89 d3                	mov    %edx,%ebx
+  802039:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80203b:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  802042:	74 2d                	je     802071 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802044:	6a 07                	push   $0x7
+  802046:	68 00 f0 80 00       	push   $0x80f000
+  80204b:	57                   	push   %edi
+  80204c:	ff 35 00 70 80 00    	push   0x807000
+  802052:	e8 1b f9 ff ff       	call   801972 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  802057:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80205e:	6a 00                	push   $0x0
+  802060:	56                   	push   %esi
+  802061:	53                   	push   %ebx
+  802062:	6a 00                	push   $0x0
+  802064:	e8 bb f7 ff ff       	call   801824 <ipc_recv_pages>
+}
+  802069:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206c:	5b                   	pop    %ebx
+  80206d:	5e                   	pop    %esi
+  80206e:	5f                   	pop    %edi
+  80206f:	5d                   	pop    %ebp
+  802070:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802071:	83 ec 0c             	sub    $0xc,%esp
+  802074:	6a 01                	push   $0x1
+  802076:	e8 ec f9 ff ff       	call   801a67 <ipc_find_env>
+  80207b:	a3 00 70 80 00       	mov    %eax,0x807000
+  802080:	83 c4 10             	add    $0x10,%esp
+  802083:	eb bf                	jmp    802044 <fsipc_pages+0x18>
+
+00802085 <fsipc>:
+{
+  802085:	55                   	push   %ebp
+  802086:	89 e5                	mov    %esp,%ebp
+  802088:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  80208b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802090:	e8 97 ff ff ff       	call   80202c <fsipc_pages>
+}
+  802095:	c9                   	leave
+  802096:	c3                   	ret
+
+00802097 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802097:	55                   	push   %ebp
+  802098:	89 e5                	mov    %esp,%ebp
+  80209a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80209d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020a0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020a3:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  8020a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020ab:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8020b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020b5:	b8 02 00 00 00       	mov    $0x2,%eax
+  8020ba:	e8 c6 ff ff ff       	call   802085 <fsipc>
+}
+  8020bf:	c9                   	leave
+  8020c0:	c3                   	ret
+
+008020c1 <devfile_flush>:
+{
+  8020c1:	55                   	push   %ebp
+  8020c2:	89 e5                	mov    %esp,%ebp
+  8020c4:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8020c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ca:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020cd:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8020d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020d7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8020dc:	e8 a4 ff ff ff       	call   802085 <fsipc>
+}
+  8020e1:	c9                   	leave
+  8020e2:	c3                   	ret
+
+008020e3 <devfile_stat>:
+{
+  8020e3:	55                   	push   %ebp
+  8020e4:	89 e5                	mov    %esp,%ebp
+  8020e6:	53                   	push   %ebx
+  8020e7:	83 ec 04             	sub    $0x4,%esp
+  8020ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8020ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020f0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020f3:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8020f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020fd:	b8 05 00 00 00       	mov    $0x5,%eax
+  802102:	e8 7e ff ff ff       	call   802085 <fsipc>
+  802107:	85 c0                	test   %eax,%eax
+  802109:	78 2c                	js     802137 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80210b:	83 ec 08             	sub    $0x8,%esp
+  80210e:	68 00 f0 80 00       	push   $0x80f000
+  802113:	53                   	push   %ebx
+  802114:	e8 c9 e6 ff ff       	call   8007e2 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802119:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  80211e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802124:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  802129:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  80212f:	83 c4 10             	add    $0x10,%esp
+  802132:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802137:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80213a:	c9                   	leave
+  80213b:	c3                   	ret
+
+0080213c <devfile_write>:
+{
+  80213c:	55                   	push   %ebp
+  80213d:	89 e5                	mov    %esp,%ebp
+  80213f:	83 ec 0c             	sub    $0xc,%esp
+  802142:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802145:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80214a:	39 d0                	cmp    %edx,%eax
+  80214c:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80214f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802152:	8b 52 0c             	mov    0xc(%edx),%edx
+  802155:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  80215b:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  802160:	50                   	push   %eax
+  802161:	ff 75 0c             	push   0xc(%ebp)
+  802164:	68 08 f0 80 00       	push   $0x80f008
+  802169:	e8 fa e7 ff ff       	call   800968 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  80216e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802173:	b8 04 00 00 00       	mov    $0x4,%eax
+  802178:	e8 08 ff ff ff       	call   802085 <fsipc>
+}
+  80217d:	c9                   	leave
+  80217e:	c3                   	ret
+
+0080217f <devfile_read>:
+{
+  80217f:	55                   	push   %ebp
+  802180:	89 e5                	mov    %esp,%ebp
+  802182:	57                   	push   %edi
+  802183:	56                   	push   %esi
+  802184:	53                   	push   %ebx
+  802185:	83 ec 1c             	sub    $0x1c,%esp
+  802188:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80218b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  80218e:	89 fe                	mov    %edi,%esi
+  802190:	c1 ee 0c             	shr    $0xc,%esi
+  802193:	b8 20 00 00 00       	mov    $0x20,%eax
+  802198:	39 c6                	cmp    %eax,%esi
+  80219a:	0f 47 f0             	cmova  %eax,%esi
+  80219d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021a5:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8021a8:	eb 14                	jmp    8021be <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8021aa:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  8021b1:	05 00 10 00 00       	add    $0x1000,%eax
+  8021b6:	f6 c6 06             	test   $0x6,%dh
+  8021b9:	75 42                	jne    8021fd <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8021bb:	83 c1 01             	add    $0x1,%ecx
+  8021be:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8021c1:	39 f1                	cmp    %esi,%ecx
+  8021c3:	0f 84 95 00 00 00    	je     80225e <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8021c9:	89 c2                	mov    %eax,%edx
+  8021cb:	c1 ea 16             	shr    $0x16,%edx
+  8021ce:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8021d5:	f6 c2 01             	test   $0x1,%dl
+  8021d8:	74 23                	je     8021fd <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8021da:	89 c2                	mov    %eax,%edx
+  8021dc:	c1 ea 0c             	shr    $0xc,%edx
+  8021df:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8021e6:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  8021ec:	74 0f                	je     8021fd <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  8021ee:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8021f5:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  8021fb:	75 ad                	jne    8021aa <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  8021fd:	85 c9                	test   %ecx,%ecx
+  8021ff:	74 11                	je     802212 <devfile_read+0x93>
+  802201:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802208:	75 08                	jne    802212 <devfile_read+0x93>
+  80220a:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  802210:	74 50                	je     802262 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802212:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802215:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  80221a:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802220:	ba 00 00 00 00       	mov    $0x0,%edx
+  802225:	b8 03 00 00 00       	mov    $0x3,%eax
+  80222a:	e8 56 fe ff ff       	call   802085 <fsipc>
+  80222f:	89 c6                	mov    %eax,%esi
+  802231:	85 c0                	test   %eax,%eax
+  802233:	78 1f                	js     802254 <devfile_read+0xd5>
+	assert(r <= n);
+  802235:	39 c7                	cmp    %eax,%edi
+  802237:	72 50                	jb     802289 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  802239:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80223e:	7f 62                	jg     8022a2 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  802240:	83 ec 04             	sub    $0x4,%esp
+  802243:	50                   	push   %eax
+  802244:	68 00 f0 80 00       	push   $0x80f000
+  802249:	ff 75 0c             	push   0xc(%ebp)
+  80224c:	e8 17 e7 ff ff       	call   800968 <memmove>
+	return r;
+  802251:	83 c4 10             	add    $0x10,%esp
+}
+  802254:	89 f0                	mov    %esi,%eax
+  802256:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802259:	5b                   	pop    %ebx
+  80225a:	5e                   	pop    %esi
+  80225b:	5f                   	pop    %edi
+  80225c:	5d                   	pop    %ebp
+  80225d:	c3                   	ret
+  80225e:	89 f1                	mov    %esi,%ecx
+  802260:	eb 9b                	jmp    8021fd <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  802262:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802265:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  80226a:	89 c8                	mov    %ecx,%eax
+  80226c:	c1 e0 0c             	shl    $0xc,%eax
+  80226f:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  802274:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802277:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80227c:	e8 ab fd ff ff       	call   80202c <fsipc_pages>
+  802281:	89 c6                	mov    %eax,%esi
+  802283:	85 c0                	test   %eax,%eax
+  802285:	78 8b                	js     802212 <devfile_read+0x93>
+  802287:	eb cb                	jmp    802254 <devfile_read+0xd5>
+	assert(r <= n);
+  802289:	68 6c 58 80 00       	push   $0x80586c
+  80228e:	68 73 58 80 00       	push   $0x805873
+  802293:	68 a0 00 00 00       	push   $0xa0
+  802298:	68 88 58 80 00       	push   $0x805888
+  80229d:	e8 9b 2c 00 00       	call   804f3d <_panic>
+	assert(r <= PGSIZE);
+  8022a2:	68 93 58 80 00       	push   $0x805893
+  8022a7:	68 73 58 80 00       	push   $0x805873
+  8022ac:	68 a1 00 00 00       	push   $0xa1
+  8022b1:	68 88 58 80 00       	push   $0x805888
+  8022b6:	e8 82 2c 00 00       	call   804f3d <_panic>
+
+008022bb <open>:
+{
+  8022bb:	55                   	push   %ebp
+  8022bc:	89 e5                	mov    %esp,%ebp
+  8022be:	56                   	push   %esi
+  8022bf:	53                   	push   %ebx
+  8022c0:	83 ec 1c             	sub    $0x1c,%esp
+  8022c3:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8022c6:	56                   	push   %esi
+  8022c7:	e8 db e4 ff ff       	call   8007a7 <strlen>
+  8022cc:	83 c4 10             	add    $0x10,%esp
+  8022cf:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8022d4:	7f 6c                	jg     802342 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8022d6:	83 ec 0c             	sub    $0xc,%esp
+  8022d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022dc:	50                   	push   %eax
+  8022dd:	e8 eb f7 ff ff       	call   801acd <fd_alloc>
+  8022e2:	89 c3                	mov    %eax,%ebx
+  8022e4:	83 c4 10             	add    $0x10,%esp
+  8022e7:	85 c0                	test   %eax,%eax
+  8022e9:	78 3c                	js     802327 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8022eb:	83 ec 08             	sub    $0x8,%esp
+  8022ee:	56                   	push   %esi
+  8022ef:	68 00 f0 80 00       	push   $0x80f000
+  8022f4:	e8 e9 e4 ff ff       	call   8007e2 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8022f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022fc:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802301:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802304:	b8 01 00 00 00       	mov    $0x1,%eax
+  802309:	e8 77 fd ff ff       	call   802085 <fsipc>
+  80230e:	89 c3                	mov    %eax,%ebx
+  802310:	83 c4 10             	add    $0x10,%esp
+  802313:	85 c0                	test   %eax,%eax
+  802315:	78 19                	js     802330 <open+0x75>
+	return fd2num(fd);
+  802317:	83 ec 0c             	sub    $0xc,%esp
+  80231a:	ff 75 f4             	push   -0xc(%ebp)
+  80231d:	e8 84 f7 ff ff       	call   801aa6 <fd2num>
+  802322:	89 c3                	mov    %eax,%ebx
+  802324:	83 c4 10             	add    $0x10,%esp
+}
+  802327:	89 d8                	mov    %ebx,%eax
+  802329:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80232c:	5b                   	pop    %ebx
+  80232d:	5e                   	pop    %esi
+  80232e:	5d                   	pop    %ebp
+  80232f:	c3                   	ret
+		fd_close(fd, 0);
+  802330:	83 ec 08             	sub    $0x8,%esp
+  802333:	6a 00                	push   $0x0
+  802335:	ff 75 f4             	push   -0xc(%ebp)
+  802338:	e8 80 f8 ff ff       	call   801bbd <fd_close>
+		return r;
+  80233d:	83 c4 10             	add    $0x10,%esp
+  802340:	eb e5                	jmp    802327 <open+0x6c>
+		return -E_BAD_PATH;
+  802342:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802347:	eb de                	jmp    802327 <open+0x6c>
+
+00802349 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802349:	55                   	push   %ebp
+  80234a:	89 e5                	mov    %esp,%ebp
+  80234c:	53                   	push   %ebx
+  80234d:	83 ec 10             	sub    $0x10,%esp
+  802350:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802353:	53                   	push   %ebx
+  802354:	e8 4e e4 ff ff       	call   8007a7 <strlen>
+  802359:	83 c4 10             	add    $0x10,%esp
+  80235c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802361:	7f 25                	jg     802388 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802363:	83 ec 08             	sub    $0x8,%esp
+  802366:	53                   	push   %ebx
+  802367:	68 00 f0 80 00       	push   $0x80f000
+  80236c:	e8 71 e4 ff ff       	call   8007e2 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802371:	ba 00 00 00 00       	mov    $0x0,%edx
+  802376:	b8 07 00 00 00       	mov    $0x7,%eax
+  80237b:	e8 05 fd ff ff       	call   802085 <fsipc>
+  802380:	83 c4 10             	add    $0x10,%esp
+}
+  802383:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802386:	c9                   	leave
+  802387:	c3                   	ret
+		return -E_BAD_PATH;
+  802388:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80238d:	eb f4                	jmp    802383 <remove+0x3a>
+
+0080238f <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80238f:	55                   	push   %ebp
+  802390:	89 e5                	mov    %esp,%ebp
+  802392:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802395:	ba 00 00 00 00       	mov    $0x0,%edx
+  80239a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80239f:	e8 e1 fc ff ff       	call   802085 <fsipc>
+}
+  8023a4:	c9                   	leave
+  8023a5:	c3                   	ret
+
+008023a6 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  8023a6:	55                   	push   %ebp
+  8023a7:	89 e5                	mov    %esp,%ebp
+  8023a9:	53                   	push   %ebx
+  8023aa:	83 ec 04             	sub    $0x4,%esp
+  8023ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  8023b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023b5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8023ba:	e8 c6 fc ff ff       	call   802085 <fsipc>
+  8023bf:	85 c0                	test   %eax,%eax
+  8023c1:	78 3c                	js     8023ff <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  8023c3:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  8023c8:	89 03                	mov    %eax,(%ebx)
+  8023ca:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  8023cf:	89 43 04             	mov    %eax,0x4(%ebx)
+  8023d2:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  8023d7:	89 43 08             	mov    %eax,0x8(%ebx)
+  8023da:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  8023df:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8023e2:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  8023e7:	89 43 10             	mov    %eax,0x10(%ebx)
+  8023ea:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  8023ef:	89 43 14             	mov    %eax,0x14(%ebx)
+  8023f2:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  8023f7:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  8023fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802402:	c9                   	leave
+  802403:	c3                   	ret
+
+00802404 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  802404:	55                   	push   %ebp
+  802405:	89 e5                	mov    %esp,%ebp
+  802407:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  80240a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80240d:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  802412:	ba 00 00 00 00       	mov    $0x0,%edx
+  802417:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80241c:	e8 64 fc ff ff       	call   802085 <fsipc>
+}
+  802421:	c9                   	leave
+  802422:	c3                   	ret
+
+00802423 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802423:	55                   	push   %ebp
+  802424:	89 e5                	mov    %esp,%ebp
+  802426:	56                   	push   %esi
+  802427:	53                   	push   %ebx
+  802428:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80242b:	83 ec 0c             	sub    $0xc,%esp
+  80242e:	ff 75 08             	push   0x8(%ebp)
+  802431:	e8 80 f6 ff ff       	call   801ab6 <fd2data>
+  802436:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802438:	83 c4 08             	add    $0x8,%esp
+  80243b:	68 9f 58 80 00       	push   $0x80589f
+  802440:	53                   	push   %ebx
+  802441:	e8 9c e3 ff ff       	call   8007e2 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802446:	8b 46 04             	mov    0x4(%esi),%eax
+  802449:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  80244f:	2b 0e                	sub    (%esi),%ecx
+  802451:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802456:	89 c8                	mov    %ecx,%eax
+  802458:	f7 e2                	mul    %edx
+  80245a:	c1 ea 0c             	shr    $0xc,%edx
+  80245d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802463:	29 d1                	sub    %edx,%ecx
+  802465:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  80246b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802472:	00 00 00 
+	stat->st_dev = &devpipe;
+  802475:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  80247c:	60 80 00 
+	return 0;
+}
+  80247f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802484:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802487:	5b                   	pop    %ebx
+  802488:	5e                   	pop    %esi
+  802489:	5d                   	pop    %ebp
+  80248a:	c3                   	ret
+
+0080248b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80248b:	55                   	push   %ebp
+  80248c:	89 e5                	mov    %esp,%ebp
+  80248e:	53                   	push   %ebx
+  80248f:	83 ec 0c             	sub    $0xc,%esp
+  802492:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802495:	53                   	push   %ebx
+  802496:	6a 00                	push   $0x0
+  802498:	e8 bd e8 ff ff       	call   800d5a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80249d:	89 1c 24             	mov    %ebx,(%esp)
+  8024a0:	e8 11 f6 ff ff       	call   801ab6 <fd2data>
+  8024a5:	83 c4 08             	add    $0x8,%esp
+  8024a8:	50                   	push   %eax
+  8024a9:	6a 00                	push   $0x0
+  8024ab:	e8 aa e8 ff ff       	call   800d5a <sys_page_unmap>
+}
+  8024b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024b3:	c9                   	leave
+  8024b4:	c3                   	ret
+
+008024b5 <_pipeisclosed>:
+{
+  8024b5:	55                   	push   %ebp
+  8024b6:	89 e5                	mov    %esp,%ebp
+  8024b8:	57                   	push   %edi
+  8024b9:	56                   	push   %esi
+  8024ba:	53                   	push   %ebx
+  8024bb:	83 ec 1c             	sub    $0x1c,%esp
+  8024be:	89 c7                	mov    %eax,%edi
+  8024c0:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8024c2:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  8024c7:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8024ca:	83 ec 0c             	sub    $0xc,%esp
+  8024cd:	57                   	push   %edi
+  8024ce:	e8 ca 2b 00 00       	call   80509d <pageref>
+  8024d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024d6:	89 34 24             	mov    %esi,(%esp)
+  8024d9:	e8 bf 2b 00 00       	call   80509d <pageref>
+		nn = thisenv->env_runs;
+  8024de:	8b 15 1c e9 80 00    	mov    0x80e91c,%edx
+  8024e4:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8024e7:	83 c4 10             	add    $0x10,%esp
+  8024ea:	39 cb                	cmp    %ecx,%ebx
+  8024ec:	74 1b                	je     802509 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8024ee:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024f1:	75 cf                	jne    8024c2 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8024f3:	8b 42 58             	mov    0x58(%edx),%eax
+  8024f6:	6a 01                	push   $0x1
+  8024f8:	50                   	push   %eax
+  8024f9:	53                   	push   %ebx
+  8024fa:	68 a6 58 80 00       	push   $0x8058a6
+  8024ff:	e8 f7 dc ff ff       	call   8001fb <cprintf>
+  802504:	83 c4 10             	add    $0x10,%esp
+  802507:	eb b9                	jmp    8024c2 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802509:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80250c:	0f 94 c0             	sete   %al
+  80250f:	0f b6 c0             	movzbl %al,%eax
+}
+  802512:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802515:	5b                   	pop    %ebx
+  802516:	5e                   	pop    %esi
+  802517:	5f                   	pop    %edi
+  802518:	5d                   	pop    %ebp
+  802519:	c3                   	ret
+
+0080251a <devpipe_read>:
+{
+  80251a:	55                   	push   %ebp
+  80251b:	89 e5                	mov    %esp,%ebp
+  80251d:	57                   	push   %edi
+  80251e:	56                   	push   %esi
+  80251f:	53                   	push   %ebx
+  802520:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802523:	ff 75 08             	push   0x8(%ebp)
+  802526:	e8 8b f5 ff ff       	call   801ab6 <fd2data>
+  80252b:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  80252d:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  802530:	8d 40 04             	lea    0x4(%eax),%eax
+  802533:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802536:	8b 7b 04             	mov    0x4(%ebx),%edi
+  802539:	8b 0b                	mov    (%ebx),%ecx
+  80253b:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  802541:	29 ce                	sub    %ecx,%esi
+  802543:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802548:	f7 e6                	mul    %esi
+  80254a:	c1 ea 0c             	shr    $0xc,%edx
+  80254d:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  802553:	29 c6                	sub    %eax,%esi
+  802555:	89 f2                	mov    %esi,%edx
+  802557:	75 43                	jne    80259c <devpipe_read+0x82>
+		ref = pageref(p);
+  802559:	83 ec 0c             	sub    $0xc,%esp
+  80255c:	53                   	push   %ebx
+  80255d:	e8 3b 2b 00 00       	call   80509d <pageref>
+  802562:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  802564:	89 da                	mov    %ebx,%edx
+  802566:	8b 45 08             	mov    0x8(%ebp),%eax
+  802569:	e8 47 ff ff ff       	call   8024b5 <_pipeisclosed>
+  80256e:	83 c4 10             	add    $0x10,%esp
+  802571:	85 c0                	test   %eax,%eax
+  802573:	0f 85 c1 00 00 00    	jne    80263a <devpipe_read+0x120>
+	*sleeping = 1;
+  802579:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  802580:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802585:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  802588:	75 ac                	jne    802536 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  80258a:	83 ec 04             	sub    $0x4,%esp
+  80258d:	56                   	push   %esi
+  80258e:	57                   	push   %edi
+  80258f:	ff 75 e4             	push   -0x1c(%ebp)
+  802592:	e8 17 ec ff ff       	call   8011ae <sys_futex_wait>
+  802597:	83 c4 10             	add    $0x10,%esp
+  80259a:	eb 9a                	jmp    802536 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  80259c:	39 75 10             	cmp    %esi,0x10(%ebp)
+  80259f:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  8025a3:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8025a5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8025aa:	f7 e1                	mul    %ecx
+  8025ac:	c1 ea 0b             	shr    $0xb,%edx
+  8025af:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8025b5:	29 c1                	sub    %eax,%ecx
+  8025b7:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  8025b9:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8025be:	29 cf                	sub    %ecx,%edi
+  8025c0:	39 f7                	cmp    %esi,%edi
+  8025c2:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  8025c5:	8d 43 10             	lea    0x10(%ebx),%eax
+  8025c8:	83 ec 04             	sub    $0x4,%esp
+  8025cb:	57                   	push   %edi
+  8025cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025cf:	01 c2                	add    %eax,%edx
+  8025d1:	52                   	push   %edx
+  8025d2:	ff 75 0c             	push   0xc(%ebp)
+  8025d5:	e8 8e e3 ff ff       	call   800968 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  8025da:	83 c4 0c             	add    $0xc,%esp
+  8025dd:	89 f1                	mov    %esi,%ecx
+  8025df:	29 f9                	sub    %edi,%ecx
+  8025e1:	51                   	push   %ecx
+  8025e2:	ff 75 e4             	push   -0x1c(%ebp)
+  8025e5:	89 f8                	mov    %edi,%eax
+  8025e7:	03 45 0c             	add    0xc(%ebp),%eax
+  8025ea:	50                   	push   %eax
+  8025eb:	e8 78 e3 ff ff       	call   800968 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  8025f0:	89 f1                	mov    %esi,%ecx
+  8025f2:	03 0b                	add    (%ebx),%ecx
+  8025f4:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8025f9:	f7 e1                	mul    %ecx
+  8025fb:	c1 ea 0c             	shr    $0xc,%edx
+  8025fe:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802604:	29 d1                	sub    %edx,%ecx
+  802606:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  802608:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80260d:	83 c4 10             	add    $0x10,%esp
+  802610:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  802614:	75 0a                	jne    802620 <devpipe_read+0x106>
+	return n;
+  802616:	89 f0                	mov    %esi,%eax
+}
+  802618:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80261b:	5b                   	pop    %ebx
+  80261c:	5e                   	pop    %esi
+  80261d:	5f                   	pop    %edi
+  80261e:	5d                   	pop    %ebp
+  80261f:	c3                   	ret
+		*sleeping = 0;
+  802620:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  802627:	83 ec 08             	sub    $0x8,%esp
+  80262a:	68 00 04 00 00       	push   $0x400
+  80262f:	53                   	push   %ebx
+  802630:	e8 c9 eb ff ff       	call   8011fe <sys_futex_wake>
+  802635:	83 c4 10             	add    $0x10,%esp
+  802638:	eb dc                	jmp    802616 <devpipe_read+0xfc>
+			return 0;
+  80263a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80263f:	eb d7                	jmp    802618 <devpipe_read+0xfe>
+
+00802641 <devpipe_write>:
+{
+  802641:	55                   	push   %ebp
+  802642:	89 e5                	mov    %esp,%ebp
+  802644:	57                   	push   %edi
+  802645:	56                   	push   %esi
+  802646:	53                   	push   %ebx
+  802647:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80264a:	ff 75 08             	push   0x8(%ebp)
+  80264d:	e8 64 f4 ff ff       	call   801ab6 <fd2data>
+  802652:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  802654:	83 c4 10             	add    $0x10,%esp
+  802657:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80265e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802661:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802664:	0f 83 23 01 00 00    	jae    80278d <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80266a:	8b 77 04             	mov    0x4(%edi),%esi
+  80266d:	8b 1f                	mov    (%edi),%ebx
+  80266f:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  802675:	29 d9                	sub    %ebx,%ecx
+  802677:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80267c:	f7 e1                	mul    %ecx
+  80267e:	c1 ea 0c             	shr    $0xc,%edx
+  802681:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802687:	29 c1                	sub    %eax,%ecx
+  802689:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80268b:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802691:	75 40                	jne    8026d3 <devpipe_write+0x92>
+			ref = pageref(p);
+  802693:	83 ec 0c             	sub    $0xc,%esp
+  802696:	57                   	push   %edi
+  802697:	e8 01 2a 00 00       	call   80509d <pageref>
+  80269c:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  80269e:	89 fa                	mov    %edi,%edx
+  8026a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a3:	e8 0d fe ff ff       	call   8024b5 <_pipeisclosed>
+  8026a8:	83 c4 10             	add    $0x10,%esp
+  8026ab:	85 c0                	test   %eax,%eax
+  8026ad:	0f 85 d5 00 00 00    	jne    802788 <devpipe_write+0x147>
+	*sleeping = 1;
+  8026b3:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  8026ba:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8026bf:	39 1f                	cmp    %ebx,(%edi)
+  8026c1:	75 a7                	jne    80266a <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  8026c3:	83 ec 04             	sub    $0x4,%esp
+  8026c6:	56                   	push   %esi
+  8026c7:	53                   	push   %ebx
+  8026c8:	57                   	push   %edi
+  8026c9:	e8 e0 ea ff ff       	call   8011ae <sys_futex_wait>
+  8026ce:	83 c4 10             	add    $0x10,%esp
+  8026d1:	eb 97                	jmp    80266a <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8026d3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8026d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026d9:	29 c1                	sub    %eax,%ecx
+  8026db:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8026e0:	89 d8                	mov    %ebx,%eax
+  8026e2:	29 d0                	sub    %edx,%eax
+  8026e4:	39 c1                	cmp    %eax,%ecx
+  8026e6:	0f 46 c1             	cmovbe %ecx,%eax
+  8026e9:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  8026eb:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8026f0:	f7 e6                	mul    %esi
+  8026f2:	c1 ea 0b             	shr    $0xb,%edx
+  8026f5:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8026fb:	29 c6                	sub    %eax,%esi
+  8026fd:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8026ff:	29 f3                	sub    %esi,%ebx
+  802701:	39 cb                	cmp    %ecx,%ebx
+  802703:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802706:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  802709:	8d 77 10             	lea    0x10(%edi),%esi
+  80270c:	83 ec 04             	sub    $0x4,%esp
+  80270f:	53                   	push   %ebx
+  802710:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802713:	03 45 0c             	add    0xc(%ebp),%eax
+  802716:	50                   	push   %eax
+  802717:	01 f2                	add    %esi,%edx
+  802719:	52                   	push   %edx
+  80271a:	e8 49 e2 ff ff       	call   800968 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80271f:	83 c4 0c             	add    $0xc,%esp
+  802722:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802725:	29 d8                	sub    %ebx,%eax
+  802727:	50                   	push   %eax
+  802728:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80272b:	01 d3                	add    %edx,%ebx
+  80272d:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802730:	53                   	push   %ebx
+  802731:	56                   	push   %esi
+  802732:	e8 31 e2 ff ff       	call   800968 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802737:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80273a:	03 4f 04             	add    0x4(%edi),%ecx
+  80273d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802742:	f7 e1                	mul    %ecx
+  802744:	c1 ea 0c             	shr    $0xc,%edx
+  802747:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80274d:	29 d1                	sub    %edx,%ecx
+  80274f:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  802752:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802757:	83 c4 10             	add    $0x10,%esp
+  80275a:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  80275e:	75 0b                	jne    80276b <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802760:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  802763:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802766:	e9 f3 fe ff ff       	jmp    80265e <devpipe_write+0x1d>
+		*sleeping = 0;
+  80276b:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  802772:	83 ec 08             	sub    $0x8,%esp
+  802775:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  80277a:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  80277d:	50                   	push   %eax
+  80277e:	e8 7b ea ff ff       	call   8011fe <sys_futex_wake>
+  802783:	83 c4 10             	add    $0x10,%esp
+  802786:	eb d8                	jmp    802760 <devpipe_write+0x11f>
+				return 0;
+  802788:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80278d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802790:	5b                   	pop    %ebx
+  802791:	5e                   	pop    %esi
+  802792:	5f                   	pop    %edi
+  802793:	5d                   	pop    %ebp
+  802794:	c3                   	ret
+
+00802795 <pipe>:
+{
+  802795:	55                   	push   %ebp
+  802796:	89 e5                	mov    %esp,%ebp
+  802798:	56                   	push   %esi
+  802799:	53                   	push   %ebx
+  80279a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80279d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027a0:	50                   	push   %eax
+  8027a1:	e8 27 f3 ff ff       	call   801acd <fd_alloc>
+  8027a6:	89 c3                	mov    %eax,%ebx
+  8027a8:	83 c4 10             	add    $0x10,%esp
+  8027ab:	85 c0                	test   %eax,%eax
+  8027ad:	0f 88 23 01 00 00    	js     8028d6 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027b3:	83 ec 04             	sub    $0x4,%esp
+  8027b6:	68 07 04 00 00       	push   $0x407
+  8027bb:	ff 75 f4             	push   -0xc(%ebp)
+  8027be:	6a 00                	push   $0x0
+  8027c0:	e8 10 e5 ff ff       	call   800cd5 <sys_page_alloc>
+  8027c5:	89 c3                	mov    %eax,%ebx
+  8027c7:	83 c4 10             	add    $0x10,%esp
+  8027ca:	85 c0                	test   %eax,%eax
+  8027cc:	0f 88 04 01 00 00    	js     8028d6 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8027d2:	83 ec 0c             	sub    $0xc,%esp
+  8027d5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8027d8:	50                   	push   %eax
+  8027d9:	e8 ef f2 ff ff       	call   801acd <fd_alloc>
+  8027de:	89 c3                	mov    %eax,%ebx
+  8027e0:	83 c4 10             	add    $0x10,%esp
+  8027e3:	85 c0                	test   %eax,%eax
+  8027e5:	0f 88 db 00 00 00    	js     8028c6 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027eb:	83 ec 04             	sub    $0x4,%esp
+  8027ee:	68 07 04 00 00       	push   $0x407
+  8027f3:	ff 75 f0             	push   -0x10(%ebp)
+  8027f6:	6a 00                	push   $0x0
+  8027f8:	e8 d8 e4 ff ff       	call   800cd5 <sys_page_alloc>
+  8027fd:	89 c3                	mov    %eax,%ebx
+  8027ff:	83 c4 10             	add    $0x10,%esp
+  802802:	85 c0                	test   %eax,%eax
+  802804:	0f 88 bc 00 00 00    	js     8028c6 <pipe+0x131>
+	va = fd2data(fd0);
+  80280a:	83 ec 0c             	sub    $0xc,%esp
+  80280d:	ff 75 f4             	push   -0xc(%ebp)
+  802810:	e8 a1 f2 ff ff       	call   801ab6 <fd2data>
+  802815:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802817:	83 c4 0c             	add    $0xc,%esp
+  80281a:	68 07 04 00 00       	push   $0x407
+  80281f:	50                   	push   %eax
+  802820:	6a 00                	push   $0x0
+  802822:	e8 ae e4 ff ff       	call   800cd5 <sys_page_alloc>
+  802827:	89 c3                	mov    %eax,%ebx
+  802829:	83 c4 10             	add    $0x10,%esp
+  80282c:	85 c0                	test   %eax,%eax
+  80282e:	0f 88 82 00 00 00    	js     8028b6 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802834:	83 ec 0c             	sub    $0xc,%esp
+  802837:	ff 75 f0             	push   -0x10(%ebp)
+  80283a:	e8 77 f2 ff ff       	call   801ab6 <fd2data>
+  80283f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802846:	50                   	push   %eax
+  802847:	6a 00                	push   $0x0
+  802849:	56                   	push   %esi
+  80284a:	6a 00                	push   $0x0
+  80284c:	e8 c7 e4 ff ff       	call   800d18 <sys_page_map>
+  802851:	89 c3                	mov    %eax,%ebx
+  802853:	83 c4 20             	add    $0x20,%esp
+  802856:	85 c0                	test   %eax,%eax
+  802858:	78 4e                	js     8028a8 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80285a:	a1 20 60 80 00       	mov    0x806020,%eax
+  80285f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802862:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802864:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802867:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80286e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802871:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802873:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802876:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80287d:	83 ec 0c             	sub    $0xc,%esp
+  802880:	ff 75 f4             	push   -0xc(%ebp)
+  802883:	e8 1e f2 ff ff       	call   801aa6 <fd2num>
+  802888:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80288b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80288d:	83 c4 04             	add    $0x4,%esp
+  802890:	ff 75 f0             	push   -0x10(%ebp)
+  802893:	e8 0e f2 ff ff       	call   801aa6 <fd2num>
+  802898:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80289b:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80289e:	83 c4 10             	add    $0x10,%esp
+  8028a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028a6:	eb 2e                	jmp    8028d6 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8028a8:	83 ec 08             	sub    $0x8,%esp
+  8028ab:	56                   	push   %esi
+  8028ac:	6a 00                	push   $0x0
+  8028ae:	e8 a7 e4 ff ff       	call   800d5a <sys_page_unmap>
+  8028b3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8028b6:	83 ec 08             	sub    $0x8,%esp
+  8028b9:	ff 75 f0             	push   -0x10(%ebp)
+  8028bc:	6a 00                	push   $0x0
+  8028be:	e8 97 e4 ff ff       	call   800d5a <sys_page_unmap>
+  8028c3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8028c6:	83 ec 08             	sub    $0x8,%esp
+  8028c9:	ff 75 f4             	push   -0xc(%ebp)
+  8028cc:	6a 00                	push   $0x0
+  8028ce:	e8 87 e4 ff ff       	call   800d5a <sys_page_unmap>
+  8028d3:	83 c4 10             	add    $0x10,%esp
+}
+  8028d6:	89 d8                	mov    %ebx,%eax
+  8028d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028db:	5b                   	pop    %ebx
+  8028dc:	5e                   	pop    %esi
+  8028dd:	5d                   	pop    %ebp
+  8028de:	c3                   	ret
+
+008028df <pipeisclosed>:
+{
+  8028df:	55                   	push   %ebp
+  8028e0:	89 e5                	mov    %esp,%ebp
+  8028e2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8028e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028e8:	50                   	push   %eax
+  8028e9:	ff 75 08             	push   0x8(%ebp)
+  8028ec:	e8 30 f2 ff ff       	call   801b21 <fd_lookup>
+  8028f1:	83 c4 10             	add    $0x10,%esp
+  8028f4:	85 c0                	test   %eax,%eax
+  8028f6:	78 18                	js     802910 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8028f8:	83 ec 0c             	sub    $0xc,%esp
+  8028fb:	ff 75 f4             	push   -0xc(%ebp)
+  8028fe:	e8 b3 f1 ff ff       	call   801ab6 <fd2data>
+  802903:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802905:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802908:	e8 a8 fb ff ff       	call   8024b5 <_pipeisclosed>
+  80290d:	83 c4 10             	add    $0x10,%esp
+}
+  802910:	c9                   	leave
+  802911:	c3                   	ret
+
+00802912 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802912:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802914:	8b 15 1c e9 80 00    	mov    0x80e91c,%edx
+  80291a:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802920:	81 c2 34 01 00 00    	add    $0x134,%edx
+  802926:	39 d0                	cmp    %edx,%eax
+  802928:	74 2e                	je     802958 <segment_lookup+0x46>
+{
+  80292a:	55                   	push   %ebp
+  80292b:	89 e5                	mov    %esp,%ebp
+  80292d:	57                   	push   %edi
+  80292e:	56                   	push   %esi
+  80292f:	53                   	push   %ebx
+  802930:	eb 07                	jmp    802939 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802932:	83 c0 20             	add    $0x20,%eax
+  802935:	39 d0                	cmp    %edx,%eax
+  802937:	74 15                	je     80294e <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802939:	8b 18                	mov    (%eax),%ebx
+  80293b:	39 d9                	cmp    %ebx,%ecx
+  80293d:	72 f3                	jb     802932 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  80293f:	8b 38                	mov    (%eax),%edi
+  802941:	8b 58 04             	mov    0x4(%eax),%ebx
+  802944:	89 ce                	mov    %ecx,%esi
+  802946:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  802948:	39 de                	cmp    %ebx,%esi
+  80294a:	73 e6                	jae    802932 <segment_lookup+0x20>
+  80294c:	eb 05                	jmp    802953 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  80294e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802953:	5b                   	pop    %ebx
+  802954:	5e                   	pop    %esi
+  802955:	5f                   	pop    %edi
+  802956:	5d                   	pop    %ebp
+  802957:	c3                   	ret
+	return NULL;
+  802958:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80295d:	c3                   	ret
+
+0080295e <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  80295e:	55                   	push   %ebp
+  80295f:	89 e5                	mov    %esp,%ebp
+  802961:	53                   	push   %ebx
+  802962:	83 ec 04             	sub    $0x4,%esp
+  802965:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802967:	c1 e8 16             	shr    $0x16,%eax
+  80296a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802971:	25 81 00 00 00       	and    $0x81,%eax
+  802976:	83 f8 01             	cmp    $0x1,%eax
+  802979:	75 6b                	jne    8029e6 <page_is_clean+0x88>
+  80297b:	89 da                	mov    %ebx,%edx
+  80297d:	c1 ea 0c             	shr    $0xc,%edx
+  802980:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  802987:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80298c:	f6 c1 01             	test   $0x1,%cl
+  80298f:	74 5a                	je     8029eb <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802991:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802998:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  80299e:	75 4b                	jne    8029eb <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  8029a0:	89 d8                	mov    %ebx,%eax
+  8029a2:	e8 6b ff ff ff       	call   802912 <segment_lookup>
+  8029a7:	89 c2                	mov    %eax,%edx
+		return 1;
+  8029a9:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  8029ae:	85 d2                	test   %edx,%edx
+  8029b0:	75 39                	jne    8029eb <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  8029b2:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  8029b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029bd:	eb 03                	jmp    8029c2 <page_is_clean+0x64>
+  8029bf:	83 c0 01             	add    $0x1,%eax
+  8029c2:	39 c2                	cmp    %eax,%edx
+  8029c4:	7e 19                	jle    8029df <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  8029c6:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  8029cd:	72 f0                	jb     8029bf <page_is_clean+0x61>
+  8029cf:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  8029d6:	73 e7                	jae    8029bf <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  8029d8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029dd:	eb 0c                	jmp    8029eb <page_is_clean+0x8d>
+	return 0;
+  8029df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e4:	eb 05                	jmp    8029eb <page_is_clean+0x8d>
+		return 0;
+  8029e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029ee:	c9                   	leave
+  8029ef:	c3                   	ret
+
+008029f0 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  8029f0:	55                   	push   %ebp
+  8029f1:	89 e5                	mov    %esp,%ebp
+  8029f3:	57                   	push   %edi
+  8029f4:	56                   	push   %esi
+  8029f5:	53                   	push   %ebx
+  8029f6:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8029f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8029fe:	eb 19                	jmp    802a19 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802a00:	f7 d3                	not    %ebx
+  802a02:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802a08:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802a0a:	83 c6 01             	add    $0x1,%esi
+  802a0d:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802a13:	0f 87 97 00 00 00    	ja     802ab0 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802a19:	89 f3                	mov    %esi,%ebx
+  802a1b:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  802a21:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802a27:	89 d8                	mov    %ebx,%eax
+  802a29:	c1 e8 0a             	shr    $0xa,%eax
+  802a2c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802a33:	25 81 00 00 00       	and    $0x81,%eax
+  802a38:	83 f8 01             	cmp    $0x1,%eax
+  802a3b:	75 c3                	jne    802a00 <linear_walk+0x10>
+  802a3d:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802a43:	77 bb                	ja     802a00 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802a45:	89 df                	mov    %ebx,%edi
+  802a47:	c1 e7 0c             	shl    $0xc,%edi
+  802a4a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802a4d:	89 f8                	mov    %edi,%eax
+  802a4f:	e8 0a ff ff ff       	call   80295e <page_is_clean>
+  802a54:	84 c0                	test   %al,%al
+  802a56:	75 64                	jne    802abc <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a58:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802a5e:	77 aa                	ja     802a0a <linear_walk+0x1a>
+  802a60:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  802a66:	72 a2                	jb     802a0a <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802a68:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a6f:	a8 01                	test   $0x1,%al
+  802a71:	74 97                	je     802a0a <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802a73:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802a7a:	f6 c4 04             	test   $0x4,%ah
+  802a7d:	75 8b                	jne    802a0a <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802a7f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802a86:	f6 c4 02             	test   $0x2,%ah
+  802a89:	0f 85 7b ff ff ff    	jne    802a0a <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802a8f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802a96:	c1 e8 0c             	shr    $0xc,%eax
+  802a99:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802a9c:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802aa1:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802aa5:	66 83 f8 01          	cmp    $0x1,%ax
+  802aa9:	76 11                	jbe    802abc <linear_walk+0xcc>
+  802aab:	e9 5a ff ff ff       	jmp    802a0a <linear_walk+0x1a>
+  802ab0:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  802ab5:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802abc:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  802ac2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ac5:	83 c4 1c             	add    $0x1c,%esp
+  802ac8:	5b                   	pop    %ebx
+  802ac9:	5e                   	pop    %esi
+  802aca:	5f                   	pop    %edi
+  802acb:	5d                   	pop    %ebp
+  802acc:	c3                   	ret
+
+00802acd <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802acd:	55                   	push   %ebp
+  802ace:	89 e5                	mov    %esp,%ebp
+  802ad0:	56                   	push   %esi
+  802ad1:	53                   	push   %ebx
+  802ad2:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  802ad4:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802ad9:	83 e0 7f             	and    $0x7f,%eax
+  802adc:	c1 e0 04             	shl    $0x4,%eax
+  802adf:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  802ae5:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802aeb:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802af1:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  802af7:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802afc:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  802aff:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802b04:	83 c0 01             	add    $0x1,%eax
+  802b07:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  802b0c:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802b0f:	5b                   	pop    %ebx
+  802b10:	5e                   	pop    %esi
+  802b11:	5d                   	pop    %ebp
+  802b12:	c3                   	ret
+
+00802b13 <page_ring_enter>:
+{
+  802b13:	55                   	push   %ebp
+  802b14:	89 e5                	mov    %esp,%ebp
+  802b16:	57                   	push   %edi
+  802b17:	56                   	push   %esi
+  802b18:	53                   	push   %ebx
+  802b19:	83 ec 18             	sub    $0x18,%esp
+  802b1c:	89 c6                	mov    %eax,%esi
+  802b1e:	89 d7                	mov    %edx,%edi
+  802b20:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802b22:	6a 00                	push   $0x0
+  802b24:	6a 00                	push   $0x0
+  802b26:	6a 00                	push   $0x0
+  802b28:	6a 07                	push   $0x7
+  802b2a:	ff 35 40 b0 80 00    	push   0x80b040
+  802b30:	e8 5b ee ff ff       	call   801990 <ipc_call>
+  802b35:	83 c4 20             	add    $0x20,%esp
+  802b38:	85 c0                	test   %eax,%eax
+  802b3a:	79 22                	jns    802b5e <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802b3c:	50                   	push   %eax
+  802b3d:	68 be 58 80 00       	push   $0x8058be
+  802b42:	68 13 02 00 00       	push   $0x213
+  802b47:	68 d2 58 80 00       	push   $0x8058d2
+  802b4c:	e8 ec 23 00 00       	call   804f3d <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802b51:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802b56:	83 c0 01             	add    $0x1,%eax
+  802b59:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802b5e:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802b64:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802b69:	39 c2                	cmp    %eax,%edx
+  802b6b:	74 24                	je     802b91 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802b6d:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802b72:	83 e0 7f             	and    $0x7f,%eax
+  802b75:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802b7c:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802b83:	29 f0                	sub    %esi,%eax
+  802b85:	39 d8                	cmp    %ebx,%eax
+  802b87:	73 c8                	jae    802b51 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802b89:	8b 52 04             	mov    0x4(%edx),%edx
+  802b8c:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802b8f:	eb c0                	jmp    802b51 <page_ring_enter+0x3e>
+}
+  802b91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b94:	5b                   	pop    %ebx
+  802b95:	5e                   	pop    %esi
+  802b96:	5f                   	pop    %edi
+  802b97:	5d                   	pop    %ebp
+  802b98:	c3                   	ret
+
+00802b99 <page_ring_reserve>:
+{
+  802b99:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802b9b:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802ba0:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802ba6:	29 d0                	sub    %edx,%eax
+  802ba8:	ba 80 00 00 00       	mov    $0x80,%edx
+  802bad:	29 ca                	sub    %ecx,%edx
+  802baf:	39 c2                	cmp    %eax,%edx
+  802bb1:	72 01                	jb     802bb4 <page_ring_reserve+0x1b>
+  802bb3:	c3                   	ret
+{
+  802bb4:	55                   	push   %ebp
+  802bb5:	89 e5                	mov    %esp,%ebp
+  802bb7:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802bba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc9:	e8 45 ff ff ff       	call   802b13 <page_ring_enter>
+}
+  802bce:	c9                   	leave
+  802bcf:	c3                   	ret
+
+00802bd0 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802bd0:	55                   	push   %ebp
+  802bd1:	89 e5                	mov    %esp,%ebp
+  802bd3:	53                   	push   %ebx
+  802bd4:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802bd7:	6a 07                	push   $0x7
+  802bd9:	6a 01                	push   $0x1
+  802bdb:	89 c3                	mov    %eax,%ebx
+  802bdd:	c1 e3 0c             	shl    $0xc,%ebx
+  802be0:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  802be6:	52                   	push   %edx
+  802be7:	6a 04                	push   $0x4
+  802be9:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  802bf0:	e8 9b ed ff ff       	call   801990 <ipc_call>
+	sharereqs[i].nslots = 0;
+  802bf5:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  802bfc:	00 00 00 
+	return r;
+}
+  802bff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c02:	c9                   	leave
+  802c03:	c3                   	ret
+
+00802c04 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802c04:	55                   	push   %ebp
+  802c05:	89 e5                	mov    %esp,%ebp
+  802c07:	56                   	push   %esi
+  802c08:	53                   	push   %ebx
+  802c09:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802c0b:	c1 e8 10             	shr    $0x10,%eax
+  802c0e:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802c11:	89 c2                	mov    %eax,%edx
+  802c13:	c1 e2 0c             	shl    $0xc,%edx
+  802c16:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  802c1c:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802c1f:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  802c25:	89 c2                	mov    %eax,%edx
+  802c27:	c1 e2 0a             	shl    $0xa,%edx
+  802c2a:	01 f2                	add    %esi,%edx
+  802c2c:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802c33:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802c39:	74 09                	je     802c44 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c40:	5b                   	pop    %ebx
+  802c41:	5e                   	pop    %esi
+  802c42:	5d                   	pop    %ebp
+  802c43:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802c44:	e8 87 ff ff ff       	call   802bd0 <page_share_send>
+  802c49:	eb f5                	jmp    802c40 <page_share_slot+0x3c>
+
+00802c4b <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802c4b:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  802c50:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802c53:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802c58:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  802c5e:	74 09                	je     802c69 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802c60:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802c65:	85 c0                	test   %eax,%eax
+  802c67:	75 01                	jne    802c6a <page_ring_ready+0x1f>
+}
+  802c69:	c3                   	ret
+{
+  802c6a:	55                   	push   %ebp
+  802c6b:	89 e5                	mov    %esp,%ebp
+  802c6d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802c70:	68 07 06 00 00       	push   $0x607
+  802c75:	6a 08                	push   $0x8
+  802c77:	68 00 30 ad de       	push   $0xdead3000
+  802c7c:	6a 00                	push   $0x0
+  802c7e:	e8 7d e1 ff ff       	call   800e00 <sys_page_alloc_range>
+  802c83:	83 c4 10             	add    $0x10,%esp
+  802c86:	83 f8 08             	cmp    $0x8,%eax
+  802c89:	74 1b                	je     802ca6 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802c8b:	83 ec 04             	sub    $0x4,%esp
+  802c8e:	6a 08                	push   $0x8
+  802c90:	68 00 30 ad de       	push   $0xdead3000
+  802c95:	6a 00                	push   $0x0
+  802c97:	e8 d2 e1 ff ff       	call   800e6e <sys_page_unmap_range>
+		return 0;
+  802c9c:	83 c4 10             	add    $0x10,%esp
+  802c9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ca4:	c9                   	leave
+  802ca5:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802ca6:	83 ec 0c             	sub    $0xc,%esp
+  802ca9:	68 07 04 00 00       	push   $0x407
+  802cae:	6a 08                	push   $0x8
+  802cb0:	68 00 30 ad de       	push   $0xdead3000
+  802cb5:	6a 06                	push   $0x6
+  802cb7:	ff 35 40 b0 80 00    	push   0x80b040
+  802cbd:	e8 ce ec ff ff       	call   801990 <ipc_call>
+  802cc2:	83 c4 20             	add    $0x20,%esp
+  802cc5:	85 c0                	test   %eax,%eax
+  802cc7:	78 14                	js     802cdd <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802cc9:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  802cce:	8b 40 48             	mov    0x48(%eax),%eax
+  802cd1:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  802cd6:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cdb:	eb c7                	jmp    802ca4 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802cdd:	83 ec 04             	sub    $0x4,%esp
+  802ce0:	6a 08                	push   $0x8
+  802ce2:	68 00 30 ad de       	push   $0xdead3000
+  802ce7:	6a 00                	push   $0x0
+  802ce9:	e8 80 e1 ff ff       	call   800e6e <sys_page_unmap_range>
+		return 0;
+  802cee:	83 c4 10             	add    $0x10,%esp
+  802cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf6:	eb ac                	jmp    802ca4 <page_ring_ready+0x59>
+
+00802cf8 <page_remove_slot>:
+{
+  802cf8:	55                   	push   %ebp
+  802cf9:	89 e5                	mov    %esp,%ebp
+  802cfb:	56                   	push   %esi
+  802cfc:	53                   	push   %ebx
+  802cfd:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802cff:	89 c6                	mov    %eax,%esi
+  802d01:	c1 ee 10             	shr    $0x10,%esi
+  802d04:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802d07:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  802d0e:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  802d14:	74 2a                	je     802d40 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802d16:	83 ec 0c             	sub    $0xc,%esp
+  802d19:	6a 00                	push   $0x0
+  802d1b:	6a 00                	push   $0x0
+  802d1d:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802d1f:	c1 e3 04             	shl    $0x4,%ebx
+  802d22:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802d25:	53                   	push   %ebx
+  802d26:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  802d2d:	e8 5e ec ff ff       	call   801990 <ipc_call>
+  802d32:	83 c4 20             	add    $0x20,%esp
+  802d35:	85 c0                	test   %eax,%eax
+  802d37:	78 2d                	js     802d66 <page_remove_slot+0x6e>
+}
+  802d39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d3c:	5b                   	pop    %ebx
+  802d3d:	5e                   	pop    %esi
+  802d3e:	5d                   	pop    %ebp
+  802d3f:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802d40:	e8 06 ff ff ff       	call   802c4b <page_ring_ready>
+  802d45:	85 c0                	test   %eax,%eax
+  802d47:	74 cd                	je     802d16 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802d49:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d4e:	e8 46 fe ff ff       	call   802b99 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802d53:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d58:	89 da                	mov    %ebx,%edx
+  802d5a:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d5f:	e8 69 fd ff ff       	call   802acd <page_ring_post>
+		return;
+  802d64:	eb d3                	jmp    802d39 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802d66:	50                   	push   %eax
+  802d67:	68 2c 59 80 00       	push   $0x80592c
+  802d6c:	68 ac 03 00 00       	push   $0x3ac
+  802d71:	68 d2 58 80 00       	push   $0x8058d2
+  802d76:	e8 c2 21 00 00       	call   804f3d <_panic>
+
+00802d7b <find_paging_env>:
+	if(pagingenv)
+  802d7b:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802d80:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802d82:	85 c0                	test   %eax,%eax
+  802d84:	74 05                	je     802d8b <find_paging_env+0x10>
+  802d86:	eb 56                	jmp    802dde <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802d88:	83 c0 01             	add    $0x1,%eax
+  802d8b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802d90:	7f 47                	jg     802dd9 <find_paging_env+0x5e>
+  802d92:	83 f9 01             	cmp    $0x1,%ecx
+  802d95:	7f 42                	jg     802dd9 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802d97:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802d9a:	c1 e2 06             	shl    $0x6,%edx
+  802d9d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802da3:	8b 52 50             	mov    0x50(%edx),%edx
+  802da6:	83 fa 02             	cmp    $0x2,%edx
+  802da9:	75 dd                	jne    802d88 <find_paging_env+0xd>
+  802dab:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802dae:	c1 e2 06             	shl    $0x6,%edx
+  802db1:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802db7:	8b 52 54             	mov    0x54(%edx),%edx
+  802dba:	85 d2                	test   %edx,%edx
+  802dbc:	74 ca                	je     802d88 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802dbe:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802dc1:	c1 e2 06             	shl    $0x6,%edx
+  802dc4:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802dca:	8b 52 48             	mov    0x48(%edx),%edx
+  802dcd:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  802dd4:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802dd7:	eb af                	jmp    802d88 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802dd9:	83 f9 02             	cmp    $0x2,%ecx
+  802ddc:	74 01                	je     802ddf <find_paging_env+0x64>
+}
+  802dde:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802ddf:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  802de4:	8b 40 48             	mov    0x48(%eax),%eax
+  802de7:	83 e0 01             	and    $0x1,%eax
+  802dea:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  802df1:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  802df6:	eb e6                	jmp    802dde <find_paging_env+0x63>
+
+00802df8 <page_add_backed>:
+{
+  802df8:	55                   	push   %ebp
+  802df9:	89 e5                	mov    %esp,%ebp
+  802dfb:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802dfe:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  802e03:	83 f8 04             	cmp    $0x4,%eax
+  802e06:	74 35                	je     802e3d <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802e08:	89 d1                	mov    %edx,%ecx
+  802e0a:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802e10:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e1a:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802e21:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802e27:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  802e2e:	83 c0 01             	add    $0x1,%eax
+  802e31:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  802e36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e3b:	5d                   	pop    %ebp
+  802e3c:	c3                   	ret
+		return -E_NO_MEM;
+  802e3d:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802e42:	eb f7                	jmp    802e3b <page_add_backed+0x43>
+
+00802e44 <percentage_of_pgdir_to_walk>:
+{
+  802e44:	55                   	push   %ebp
+  802e45:	89 e5                	mov    %esp,%ebp
+  802e47:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802e4a:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802e4e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802e51:	db 45 fc             	fildl  -0x4(%ebp)
+  802e54:	d8 35 b8 5d 80 00    	fdivs  0x805db8
+	return ret*ret;
+  802e5a:	d8 c8                	fmul   %st(0),%st
+}
+  802e5c:	c9                   	leave
+  802e5d:	c3                   	ret
+
+00802e5e <nfu_with_aging_page_choice_func>:
+{
+  802e5e:	55                   	push   %ebp
+  802e5f:	89 e5                	mov    %esp,%ebp
+  802e61:	57                   	push   %edi
+  802e62:	56                   	push   %esi
+  802e63:	53                   	push   %ebx
+  802e64:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802e67:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  802e6d:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802e6f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802e74:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e79:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802e80:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e85:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802e88:	eb 18                	jmp    802ea2 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802e8a:	f7 d0                	not    %eax
+  802e8c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802e91:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802e93:	83 c2 01             	add    $0x1,%edx
+  802e96:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802e9c:	0f 87 13 01 00 00    	ja     802fb5 <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802ea2:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802ea6:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802ea9:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802eae:	89 c1                	mov    %eax,%ecx
+  802eb0:	c1 e9 0a             	shr    $0xa,%ecx
+  802eb3:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802eba:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802ec0:	83 f9 01             	cmp    $0x1,%ecx
+  802ec3:	75 c5                	jne    802e8a <nfu_with_aging_page_choice_func+0x2c>
+  802ec5:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802eca:	77 be                	ja     802e8a <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802ecc:	89 c1                	mov    %eax,%ecx
+  802ece:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802ed1:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802ed7:	0f 82 a5 00 00 00    	jb     802f82 <nfu_with_aging_page_choice_func+0x124>
+  802edd:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802ee3:	0f 87 99 00 00 00    	ja     802f82 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802ee9:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802ef0:	f6 c1 01             	test   $0x1,%cl
+  802ef3:	0f 84 89 00 00 00    	je     802f82 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802ef9:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802f00:	f6 c5 04             	test   $0x4,%ch
+  802f03:	75 7d                	jne    802f82 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802f05:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802f0c:	f6 c5 02             	test   $0x2,%ch
+  802f0f:	75 71                	jne    802f82 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802f11:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802f18:	c1 e9 0c             	shr    $0xc,%ecx
+  802f1b:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802f1e:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802f24:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802f28:	66 83 f9 01          	cmp    $0x1,%cx
+  802f2c:	77 54                	ja     802f82 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802f2e:	89 f9                	mov    %edi,%ecx
+  802f30:	80 f9 ff             	cmp    $0xff,%cl
+  802f33:	74 21                	je     802f56 <nfu_with_aging_page_choice_func+0xf8>
+  802f35:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802f3c:	c1 e9 0c             	shr    $0xc,%ecx
+  802f3f:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802f42:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802f48:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802f4c:	89 fb                	mov    %edi,%ebx
+  802f4e:	38 d9                	cmp    %bl,%cl
+  802f50:	73 30                	jae    802f82 <nfu_with_aging_page_choice_func+0x124>
+  802f52:	dd d8                	fstp   %st(0)
+  802f54:	eb 02                	jmp    802f58 <nfu_with_aging_page_choice_func+0xfa>
+  802f56:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802f58:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802f5f:	c1 e9 0c             	shr    $0xc,%ecx
+  802f62:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802f65:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802f6c:	89 fb                	mov    %edi,%ebx
+  802f6e:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802f71:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802f74:	db 45 e0             	fildl  -0x20(%ebp)
+  802f77:	d8 35 b8 5d 80 00    	fdivs  0x805db8
+	return ret*ret;
+  802f7d:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802f7f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802f82:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802f85:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802f88:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802f8f:	df 6d e0             	fildll -0x20(%ebp)
+  802f92:	d9 c1                	fld    %st(1)
+  802f94:	d8 0d bc 5d 80 00    	fmuls  0x805dbc
+  802f9a:	d9 c9                	fxch   %st(1)
+  802f9c:	df f1                	fcomip %st(1),%st
+  802f9e:	dd d8                	fstp   %st(0)
+  802fa0:	0f 82 ed fe ff ff    	jb     802e93 <nfu_with_aging_page_choice_func+0x35>
+  802fa6:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802fa8:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  802fad:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802fb0:	c1 e0 0c             	shl    $0xc,%eax
+  802fb3:	eb 0e                	jmp    802fc3 <nfu_with_aging_page_choice_func+0x165>
+  802fb5:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802fb7:	89 f8                	mov    %edi,%eax
+  802fb9:	3c ff                	cmp    $0xff,%al
+  802fbb:	74 0e                	je     802fcb <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802fbd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802fc0:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802fc3:	83 c4 14             	add    $0x14,%esp
+  802fc6:	5b                   	pop    %ebx
+  802fc7:	5e                   	pop    %esi
+  802fc8:	5f                   	pop    %edi
+  802fc9:	5d                   	pop    %ebp
+  802fca:	c3                   	ret
+	pgnum = 0;
+  802fcb:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  802fd2:	00 00 00 
+	return (void*)UTOP;
+  802fd5:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802fda:	eb e7                	jmp    802fc3 <nfu_with_aging_page_choice_func+0x165>
+
+00802fdc <myRand>:
+    state = state * 1664525 + 1013904223;
+  802fdc:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  802fe3:	66 19 00 
+  802fe6:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802feb:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  802ff0:	c1 e8 18             	shr    $0x18,%eax
+}
+  802ff3:	c3                   	ret
+
+00802ff4 <random_page_choice_func>:
+{
+  802ff4:	55                   	push   %ebp
+  802ff5:	89 e5                	mov    %esp,%ebp
+  802ff7:	57                   	push   %edi
+  802ff8:	56                   	push   %esi
+  802ff9:	53                   	push   %ebx
+  802ffa:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802ffd:	be 00 00 00 00       	mov    $0x0,%esi
+  803002:	eb 19                	jmp    80301d <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803004:	f7 d3                	not    %ebx
+  803006:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80300c:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80300e:	83 c6 01             	add    $0x1,%esi
+  803011:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  803017:	0f 87 a0 00 00 00    	ja     8030bd <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80301d:	89 f3                	mov    %esi,%ebx
+  80301f:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  803025:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80302b:	89 d8                	mov    %ebx,%eax
+  80302d:	c1 e8 0a             	shr    $0xa,%eax
+  803030:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803037:	25 81 00 00 00       	and    $0x81,%eax
+  80303c:	83 f8 01             	cmp    $0x1,%eax
+  80303f:	75 c3                	jne    803004 <random_page_choice_func+0x10>
+  803041:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803047:	77 bb                	ja     803004 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  803049:	89 df                	mov    %ebx,%edi
+  80304b:	c1 e7 0c             	shl    $0xc,%edi
+  80304e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  803051:	89 f8                	mov    %edi,%eax
+  803053:	e8 06 f9 ff ff       	call   80295e <page_is_clean>
+  803058:	84 c0                	test   %al,%al
+  80305a:	0f 85 82 00 00 00    	jne    8030e2 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803060:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  803066:	72 a6                	jb     80300e <random_page_choice_func+0x1a>
+  803068:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  80306e:	77 9e                	ja     80300e <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803070:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803077:	a8 01                	test   $0x1,%al
+  803079:	74 93                	je     80300e <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80307b:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803082:	f6 c4 04             	test   $0x4,%ah
+  803085:	75 87                	jne    80300e <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803087:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80308e:	f6 c4 02             	test   $0x2,%ah
+  803091:	0f 85 77 ff ff ff    	jne    80300e <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803097:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80309e:	c1 e8 0c             	shr    $0xc,%eax
+  8030a1:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8030a4:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8030a9:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8030ad:	66 83 f8 01          	cmp    $0x1,%ax
+  8030b1:	0f 87 57 ff ff ff    	ja     80300e <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  8030b7:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8030bd:	e8 1a ff ff ff       	call   802fdc <myRand>
+  8030c2:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  8030c8:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  8030cd:	29 fe                	sub    %edi,%esi
+  8030cf:	0f be c0             	movsbl %al,%eax
+  8030d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030d7:	f7 f6                	div    %esi
+  8030d9:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8030db:	bb 15 00 00 00       	mov    $0x15,%ebx
+  8030e0:	eb 1c                	jmp    8030fe <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  8030e2:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  8030e8:	e9 8f 00 00 00       	jmp    80317c <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8030ed:	e8 ea fe ff ff       	call   802fdc <myRand>
+  8030f2:	0f be c0             	movsbl %al,%eax
+  8030f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030fa:	f7 f6                	div    %esi
+  8030fc:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8030fe:	83 eb 01             	sub    $0x1,%ebx
+  803101:	0f 84 c2 00 00 00    	je     8031c9 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  803107:	89 d0                	mov    %edx,%eax
+  803109:	c1 e8 0a             	shr    $0xa,%eax
+  80310c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803113:	25 81 00 00 00       	and    $0x81,%eax
+  803118:	83 f8 01             	cmp    $0x1,%eax
+  80311b:	75 d0                	jne    8030ed <random_page_choice_func+0xf9>
+  80311d:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  803123:	77 c8                	ja     8030ed <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  803125:	89 d0                	mov    %edx,%eax
+  803127:	c1 e0 0c             	shl    $0xc,%eax
+  80312a:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  80312f:	72 56                	jb     803187 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  803131:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  803136:	77 65                	ja     80319d <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  803138:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  80313f:	f6 c1 01             	test   $0x1,%cl
+  803142:	74 59                	je     80319d <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  803144:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  80314b:	f6 c5 04             	test   $0x4,%ch
+  80314e:	75 4d                	jne    80319d <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  803150:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  803157:	f6 c5 02             	test   $0x2,%ch
+  80315a:	75 41                	jne    80319d <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  80315c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803163:	c1 ea 0c             	shr    $0xc,%edx
+  803166:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  803169:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  80316f:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  803173:	66 83 fa 01          	cmp    $0x1,%dx
+  803177:	77 3a                	ja     8031b3 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  803179:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  80317c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80317f:	83 c4 1c             	add    $0x1c,%esp
+  803182:	5b                   	pop    %ebx
+  803183:	5e                   	pop    %esi
+  803184:	5f                   	pop    %edi
+  803185:	5d                   	pop    %ebp
+  803186:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  803187:	e8 50 fe ff ff       	call   802fdc <myRand>
+  80318c:	0f be c0             	movsbl %al,%eax
+  80318f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803194:	f7 f6                	div    %esi
+  803196:	01 fa                	add    %edi,%edx
+			continue;
+  803198:	e9 61 ff ff ff       	jmp    8030fe <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  80319d:	e8 3a fe ff ff       	call   802fdc <myRand>
+  8031a2:	0f be c0             	movsbl %al,%eax
+  8031a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031aa:	f7 f6                	div    %esi
+  8031ac:	01 fa                	add    %edi,%edx
+			continue;
+  8031ae:	e9 4b ff ff ff       	jmp    8030fe <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  8031b3:	e8 24 fe ff ff       	call   802fdc <myRand>
+  8031b8:	0f be c0             	movsbl %al,%eax
+  8031bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031c0:	f7 f6                	div    %esi
+  8031c2:	01 fa                	add    %edi,%edx
+			continue;
+  8031c4:	e9 35 ff ff ff       	jmp    8030fe <random_page_choice_func+0x10a>
+	pgnum = 0;
+  8031c9:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  8031d0:	00 00 00 
+	return (void*)UTOP;
+  8031d3:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  8031da:	eb a0                	jmp    80317c <random_page_choice_func+0x188>
+
+008031dc <nfu>:
+{
+  8031dc:	55                   	push   %ebp
+  8031dd:	89 e5                	mov    %esp,%ebp
+  8031df:	57                   	push   %edi
+  8031e0:	56                   	push   %esi
+  8031e1:	53                   	push   %ebx
+  8031e2:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8031e5:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  8031eb:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  8031ed:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8031f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031f7:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8031fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  803203:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  803206:	eb 18                	jmp    803220 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803208:	f7 d0                	not    %eax
+  80320a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80320f:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803211:	83 c2 01             	add    $0x1,%edx
+  803214:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  80321a:	0f 87 13 01 00 00    	ja     803333 <nfu+0x157>
+		++num_searched_ptes;
+  803220:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803224:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  803227:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80322c:	89 c1                	mov    %eax,%ecx
+  80322e:	c1 e9 0a             	shr    $0xa,%ecx
+  803231:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  803238:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  80323e:	83 f9 01             	cmp    $0x1,%ecx
+  803241:	75 c5                	jne    803208 <nfu+0x2c>
+  803243:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803248:	77 be                	ja     803208 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  80324a:	89 c1                	mov    %eax,%ecx
+  80324c:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80324f:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  803255:	0f 82 a5 00 00 00    	jb     803300 <nfu+0x124>
+  80325b:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803261:	0f 87 99 00 00 00    	ja     803300 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803267:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80326e:	f6 c1 01             	test   $0x1,%cl
+  803271:	0f 84 89 00 00 00    	je     803300 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803277:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80327e:	f6 c5 04             	test   $0x4,%ch
+  803281:	75 7d                	jne    803300 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803283:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80328a:	f6 c5 02             	test   $0x2,%ch
+  80328d:	75 71                	jne    803300 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80328f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803296:	c1 e9 0c             	shr    $0xc,%ecx
+  803299:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80329c:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032a2:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8032a6:	66 83 f9 01          	cmp    $0x1,%cx
+  8032aa:	77 54                	ja     803300 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  8032ac:	89 f9                	mov    %edi,%ecx
+  8032ae:	80 f9 ff             	cmp    $0xff,%cl
+  8032b1:	74 21                	je     8032d4 <nfu+0xf8>
+  8032b3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032ba:	c1 e9 0c             	shr    $0xc,%ecx
+  8032bd:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032c0:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032c6:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  8032ca:	89 fb                	mov    %edi,%ebx
+  8032cc:	38 d9                	cmp    %bl,%cl
+  8032ce:	73 30                	jae    803300 <nfu+0x124>
+  8032d0:	dd d8                	fstp   %st(0)
+  8032d2:	eb 02                	jmp    8032d6 <nfu+0xfa>
+  8032d4:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  8032d6:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032dd:	c1 e9 0c             	shr    $0xc,%ecx
+  8032e0:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032e3:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  8032ea:	89 fb                	mov    %edi,%ebx
+  8032ec:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  8032ef:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8032f2:	db 45 e0             	fildl  -0x20(%ebp)
+  8032f5:	d8 35 b8 5d 80 00    	fdivs  0x805db8
+	return ret*ret;
+  8032fb:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8032fd:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803300:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  803303:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803306:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80330d:	df 6d e0             	fildll -0x20(%ebp)
+  803310:	d9 c1                	fld    %st(1)
+  803312:	d8 0d bc 5d 80 00    	fmuls  0x805dbc
+  803318:	d9 c9                	fxch   %st(1)
+  80331a:	df f1                	fcomip %st(1),%st
+  80331c:	dd d8                	fstp   %st(0)
+  80331e:	0f 82 ed fe ff ff    	jb     803211 <nfu+0x35>
+  803324:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  803326:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  80332b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80332e:	c1 e0 0c             	shl    $0xc,%eax
+  803331:	eb 0e                	jmp    803341 <nfu+0x165>
+  803333:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  803335:	89 f8                	mov    %edi,%eax
+  803337:	3c ff                	cmp    $0xff,%al
+  803339:	74 0e                	je     803349 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  80333b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80333e:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803341:	83 c4 14             	add    $0x14,%esp
+  803344:	5b                   	pop    %ebx
+  803345:	5e                   	pop    %esi
+  803346:	5f                   	pop    %edi
+  803347:	5d                   	pop    %ebp
+  803348:	c3                   	ret
+	pgnum = 0;
+  803349:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  803350:	00 00 00 
+	return (void*)UTOP;
+  803353:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803358:	eb e7                	jmp    803341 <nfu+0x165>
+
+0080335a <lru>:
+{
+  80335a:	55                   	push   %ebp
+  80335b:	89 e5                	mov    %esp,%ebp
+  80335d:	57                   	push   %edi
+  80335e:	56                   	push   %esi
+  80335f:	53                   	push   %ebx
+  803360:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803363:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  803369:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  803370:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803377:	be 00 00 00 00       	mov    $0x0,%esi
+  80337c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803383:	ba 00 00 00 00       	mov    $0x0,%edx
+  803388:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  80338b:	eb 18                	jmp    8033a5 <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80338d:	f7 d0                	not    %eax
+  80338f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803394:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803396:	83 c2 01             	add    $0x1,%edx
+  803399:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  80339f:	0f 87 fa 00 00 00    	ja     80349f <lru+0x145>
+		++num_searched_ptes;
+  8033a5:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8033a8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8033ab:	01 d0                	add    %edx,%eax
+  8033ad:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8033b2:	89 c1                	mov    %eax,%ecx
+  8033b4:	c1 e9 0a             	shr    $0xa,%ecx
+  8033b7:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8033be:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8033c4:	83 f9 01             	cmp    $0x1,%ecx
+  8033c7:	75 c4                	jne    80338d <lru+0x33>
+  8033c9:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8033ce:	77 bd                	ja     80338d <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8033d0:	89 c1                	mov    %eax,%ecx
+  8033d2:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8033d5:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8033db:	0f 87 92 00 00 00    	ja     803473 <lru+0x119>
+  8033e1:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  8033e7:	0f 82 86 00 00 00    	jb     803473 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8033ed:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8033f4:	f6 c1 01             	test   $0x1,%cl
+  8033f7:	74 7a                	je     803473 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8033f9:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803400:	f6 c5 04             	test   $0x4,%ch
+  803403:	75 6e                	jne    803473 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803405:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80340c:	f6 c5 02             	test   $0x2,%ch
+  80340f:	75 62                	jne    803473 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803411:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803418:	c1 e9 0c             	shr    $0xc,%ecx
+  80341b:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80341e:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803424:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803428:	66 83 f9 01          	cmp    $0x1,%cx
+  80342c:	77 45                	ja     803473 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  80342e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803435:	c1 e9 0c             	shr    $0xc,%ecx
+  803438:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80343b:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803441:	8b 59 14             	mov    0x14(%ecx),%ebx
+  803444:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803447:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  80344a:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80344d:	19 df                	sbb    %ebx,%edi
+  80344f:	7c 22                	jl     803473 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  803451:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803458:	c1 e9 0c             	shr    $0xc,%ecx
+  80345b:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80345e:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803464:	8b 59 14             	mov    0x14(%ecx),%ebx
+  803467:	8b 49 10             	mov    0x10(%ecx),%ecx
+  80346a:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  80346d:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803470:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803473:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  803476:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80347d:	df 6d e0             	fildll -0x20(%ebp)
+  803480:	d9 05 bc 5d 80 00    	flds   0x805dbc
+  803486:	d9 c9                	fxch   %st(1)
+  803488:	df f1                	fcomip %st(1),%st
+  80348a:	dd d8                	fstp   %st(0)
+  80348c:	0f 82 04 ff ff ff    	jb     803396 <lru+0x3c>
+			pgnum = pgnum_actual;
+  803492:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  803497:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80349a:	c1 e0 0c             	shl    $0xc,%eax
+  80349d:	eb 06                	jmp    8034a5 <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  80349f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8034a2:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8034a5:	83 c4 1c             	add    $0x1c,%esp
+  8034a8:	5b                   	pop    %ebx
+  8034a9:	5e                   	pop    %esi
+  8034aa:	5f                   	pop    %edi
+  8034ab:	5d                   	pop    %ebp
+  8034ac:	c3                   	ret
+
+008034ad <set_page_choice_func>:
+{
+  8034ad:	55                   	push   %ebp
+  8034ae:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  8034b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034b3:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  8034b8:	5d                   	pop    %ebp
+  8034b9:	c3                   	ret
+
+008034ba <get_page_choice>:
+{
+  8034ba:	55                   	push   %ebp
+  8034bb:	89 e5                	mov    %esp,%ebp
+  8034bd:	57                   	push   %edi
+  8034be:	56                   	push   %esi
+  8034bf:	53                   	push   %ebx
+  8034c0:	83 ec 24             	sub    $0x24,%esp
+  8034c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034c6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  8034c9:	57                   	push   %edi
+  8034ca:	56                   	push   %esi
+  8034cb:	ff 15 3c 60 80 00    	call   *0x80603c
+  8034d1:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8034d3:	83 c4 10             	add    $0x10,%esp
+  8034d6:	eb 25                	jmp    8034fd <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  8034d8:	83 ec 08             	sub    $0x8,%esp
+  8034db:	c1 e0 16             	shl    $0x16,%eax
+  8034de:	50                   	push   %eax
+  8034df:	6a 00                	push   $0x0
+  8034e1:	e8 b6 d8 ff ff       	call   800d9c <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8034e6:	83 c4 10             	add    $0x10,%esp
+  8034e9:	85 c0                	test   %eax,%eax
+  8034eb:	75 43                	jne    803530 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  8034ed:	83 ec 08             	sub    $0x8,%esp
+  8034f0:	57                   	push   %edi
+  8034f1:	56                   	push   %esi
+  8034f2:	ff 15 3c 60 80 00    	call   *0x80603c
+  8034f8:	89 c3                	mov    %eax,%ebx
+  8034fa:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8034fd:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  803500:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803506:	0f 86 ae 00 00 00    	jbe    8035ba <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80350c:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  803511:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803518:	81 e2 81 00 00 00    	and    $0x81,%edx
+  80351e:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  803524:	74 b2                	je     8034d8 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803526:	83 c0 01             	add    $0x1,%eax
+  803529:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  80352e:	75 e1                	jne    803511 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803530:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803533:	05 00 10 40 11       	add    $0x11401000,%eax
+  803538:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80353d:	76 1f                	jbe    80355e <get_page_choice+0xa4>
+		return (void *) UTOP;
+  80353f:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  803544:	89 d8                	mov    %ebx,%eax
+  803546:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803549:	5b                   	pop    %ebx
+  80354a:	5e                   	pop    %esi
+  80354b:	5f                   	pop    %edi
+  80354c:	5d                   	pop    %ebp
+  80354d:	c3                   	ret
+		sys_page_split(0, pg_out);
+  80354e:	83 ec 08             	sub    $0x8,%esp
+  803551:	53                   	push   %ebx
+  803552:	6a 00                	push   $0x0
+  803554:	e8 43 d8 ff ff       	call   800d9c <sys_page_split>
+  803559:	83 c4 10             	add    $0x10,%esp
+  80355c:	eb 6c                	jmp    8035ca <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  80355e:	83 ec 04             	sub    $0x4,%esp
+  803561:	68 64 59 80 00       	push   $0x805964
+  803566:	68 cc 01 00 00       	push   $0x1cc
+  80356b:	68 d2 58 80 00       	push   $0x8058d2
+  803570:	e8 c8 19 00 00       	call   804f3d <_panic>
+		panic("We tried to page out code pages\n");
+  803575:	83 ec 04             	sub    $0x4,%esp
+  803578:	68 94 59 80 00       	push   $0x805994
+  80357d:	68 d6 01 00 00       	push   $0x1d6
+  803582:	68 d2 58 80 00       	push   $0x8058d2
+  803587:	e8 b1 19 00 00       	call   804f3d <_panic>
+		panic("Invalid mapping for the va\n");
+  80358c:	83 ec 04             	sub    $0x4,%esp
+  80358f:	68 df 58 80 00       	push   $0x8058df
+  803594:	68 da 01 00 00       	push   $0x1da
+  803599:	68 d2 58 80 00       	push   $0x8058d2
+  80359e:	e8 9a 19 00 00       	call   804f3d <_panic>
+		panic("We tried to page out a shared page\n");
+  8035a3:	83 ec 04             	sub    $0x4,%esp
+  8035a6:	68 b8 59 80 00       	push   $0x8059b8
+  8035ab:	68 e0 01 00 00       	push   $0x1e0
+  8035b0:	68 d2 58 80 00       	push   $0x8058d2
+  8035b5:	e8 83 19 00 00       	call   804f3d <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  8035ba:	89 de                	mov    %ebx,%esi
+  8035bc:	c1 ee 16             	shr    $0x16,%esi
+  8035bf:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8035c6:	a8 80                	test   $0x80,%al
+  8035c8:	75 84                	jne    80354e <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  8035ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8035cd:	05 00 10 40 11       	add    $0x11401000,%eax
+  8035d2:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8035d7:	76 85                	jbe    80355e <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  8035d9:	89 d8                	mov    %ebx,%eax
+  8035db:	e8 7e f3 ff ff       	call   80295e <page_is_clean>
+  8035e0:	84 c0                	test   %al,%al
+  8035e2:	0f 85 5c ff ff ff    	jne    803544 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  8035e8:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  8035ef:	76 84                	jbe    803575 <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  8035f1:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8035f8:	a8 01                	test   $0x1,%al
+  8035fa:	74 90                	je     80358c <get_page_choice+0xd2>
+  8035fc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8035ff:	c1 e8 0c             	shr    $0xc,%eax
+  803602:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803609:	f6 c2 01             	test   $0x1,%dl
+  80360c:	0f 84 7a ff ff ff    	je     80358c <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803612:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  803619:	f6 c2 01             	test   $0x1,%dl
+  80361c:	74 85                	je     8035a3 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  80361e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803625:	f6 c2 01             	test   $0x1,%dl
+  803628:	0f 84 75 ff ff ff    	je     8035a3 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  80362e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803635:	f6 c6 04             	test   $0x4,%dh
+  803638:	0f 85 65 ff ff ff    	jne    8035a3 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  80363e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  803645:	f6 c6 02             	test   $0x2,%dh
+  803648:	0f 85 55 ff ff ff    	jne    8035a3 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  80364e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803655:	c1 e8 0c             	shr    $0xc,%eax
+  803658:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80365b:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803660:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  803664:	66 83 f8 01          	cmp    $0x1,%ax
+  803668:	0f 86 d6 fe ff ff    	jbe    803544 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  80366e:	83 ec 04             	sub    $0x4,%esp
+  803671:	68 dc 59 80 00       	push   $0x8059dc
+  803676:	68 e2 01 00 00       	push   $0x1e2
+  80367b:	68 d2 58 80 00       	push   $0x8058d2
+  803680:	e8 b8 18 00 00       	call   804f3d <_panic>
+
+00803685 <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  803685:	55                   	push   %ebp
+  803686:	89 e5                	mov    %esp,%ebp
+  803688:	57                   	push   %edi
+  803689:	56                   	push   %esi
+  80368a:	53                   	push   %ebx
+  80368b:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  80368e:	e8 e8 f6 ff ff       	call   802d7b <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  803693:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803698:	85 c0                	test   %eax,%eax
+  80369a:	74 41                	je     8036dd <page_share_paged_out+0x58>
+  80369c:	83 3d 18 e9 80 00 00 	cmpl   $0x0,0x80e918
+  8036a3:	0f 84 fd 00 00 00    	je     8037a6 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  8036a9:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  8036b0:	00 00 00 
+  8036b3:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  8036ba:	00 00 00 
+  8036bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036c2:	eb 2c                	jmp    8036f0 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8036c4:	83 c3 04             	add    $0x4,%ebx
+  8036c7:	39 f3                	cmp    %esi,%ebx
+  8036c9:	74 1a                	je     8036e5 <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  8036cb:	8b 03                	mov    (%ebx),%eax
+  8036cd:	a8 01                	test   $0x1,%al
+  8036cf:	74 f3                	je     8036c4 <page_share_paged_out+0x3f>
+  8036d1:	c1 e8 0c             	shr    $0xc,%eax
+  8036d4:	e8 2b f5 ff ff       	call   802c04 <page_share_slot>
+  8036d9:	85 c0                	test   %eax,%eax
+  8036db:	79 e7                	jns    8036c4 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  8036dd:	83 c4 0c             	add    $0xc,%esp
+  8036e0:	5b                   	pop    %ebx
+  8036e1:	5e                   	pop    %esi
+  8036e2:	5f                   	pop    %edi
+  8036e3:	5d                   	pop    %ebp
+  8036e4:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  8036e5:	83 c7 04             	add    $0x4,%edi
+  8036e8:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  8036ee:	74 1b                	je     80370b <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  8036f0:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8036f5:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  8036f8:	f6 c3 01             	test   $0x1,%bl
+  8036fb:	74 e8                	je     8036e5 <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  8036fd:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803703:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  803709:	eb bc                	jmp    8036c7 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80370b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803710:	eb 11                	jmp    803723 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  803712:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803718:	83 c3 01             	add    $0x1,%ebx
+  80371b:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803721:	77 41                	ja     803764 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  803723:	89 d8                	mov    %ebx,%eax
+  803725:	c1 e8 0a             	shr    $0xa,%eax
+  803728:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80372f:	25 81 00 00 00       	and    $0x81,%eax
+  803734:	83 f8 01             	cmp    $0x1,%eax
+  803737:	75 d9                	jne    803712 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803739:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803740:	25 81 00 00 00       	and    $0x81,%eax
+  803745:	3d 80 00 00 00       	cmp    $0x80,%eax
+  80374a:	75 cc                	jne    803718 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  80374c:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803753:	c1 e8 0c             	shr    $0xc,%eax
+  803756:	e8 a9 f4 ff ff       	call   802c04 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  80375b:	85 c0                	test   %eax,%eax
+  80375d:	79 b9                	jns    803718 <page_share_paged_out+0x93>
+  80375f:	e9 79 ff ff ff       	jmp    8036dd <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803764:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80376b:	75 13                	jne    803780 <page_share_paged_out+0xfb>
+  80376d:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  803774:	75 1d                	jne    803793 <page_share_paged_out+0x10e>
+	return 0;
+  803776:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377b:	e9 5d ff ff ff       	jmp    8036dd <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803780:	b8 00 00 00 00       	mov    $0x0,%eax
+  803785:	e8 46 f4 ff ff       	call   802bd0 <page_share_send>
+  80378a:	85 c0                	test   %eax,%eax
+  80378c:	79 df                	jns    80376d <page_share_paged_out+0xe8>
+  80378e:	e9 4a ff ff ff       	jmp    8036dd <page_share_paged_out+0x58>
+  803793:	b8 01 00 00 00       	mov    $0x1,%eax
+  803798:	e8 33 f4 ff ff       	call   802bd0 <page_share_send>
+  80379d:	85 c0                	test   %eax,%eax
+  80379f:	79 d5                	jns    803776 <page_share_paged_out+0xf1>
+  8037a1:	e9 37 ff ff ff       	jmp    8036dd <page_share_paged_out+0x58>
+		return 0;
+  8037a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ab:	e9 2d ff ff ff       	jmp    8036dd <page_share_paged_out+0x58>
+
+008037b0 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  8037b0:	55                   	push   %ebp
+  8037b1:	89 e5                	mov    %esp,%ebp
+  8037b3:	56                   	push   %esi
+  8037b4:	53                   	push   %ebx
+  8037b5:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  8037b8:	e8 be f5 ff ff       	call   802d7b <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  8037bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  8037c2:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8037c9:	0f 84 82 00 00 00    	je     803851 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  8037cf:	83 ec 0c             	sub    $0xc,%esp
+  8037d2:	68 00 10 00 00       	push   $0x1000
+  8037d7:	e8 84 11 00 00       	call   804960 <malloc>
+  8037dc:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  8037de:	83 c4 0c             	add    $0xc,%esp
+  8037e1:	6a 14                	push   $0x14
+  8037e3:	6a 00                	push   $0x0
+  8037e5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8037e8:	50                   	push   %eax
+  8037e9:	e8 45 d1 ff ff       	call   800933 <memset>
+  8037ee:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  8037f1:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  8037f6:	83 ec 0c             	sub    $0xc,%esp
+  8037f9:	6a 07                	push   $0x7
+  8037fb:	6a 01                	push   $0x1
+  8037fd:	53                   	push   %ebx
+  8037fe:	6a 03                	push   $0x3
+  803800:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803807:	e8 84 e1 ff ff       	call   801990 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  80380c:	8b 03                	mov    (%ebx),%eax
+  80380e:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803811:	8b 43 04             	mov    0x4(%ebx),%eax
+  803814:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  803817:	8b 43 08             	mov    0x8(%ebx),%eax
+  80381a:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  80381d:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803820:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  803823:	8b 43 10             	mov    0x10(%ebx),%eax
+  803826:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803829:	83 c6 01             	add    $0x1,%esi
+  80382c:	83 c4 20             	add    $0x20,%esp
+  80382f:	83 fe 02             	cmp    $0x2,%esi
+  803832:	75 c2                	jne    8037f6 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  803834:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803837:	89 03                	mov    %eax,(%ebx)
+  803839:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80383c:	89 43 04             	mov    %eax,0x4(%ebx)
+  80383f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803842:	89 43 08             	mov    %eax,0x8(%ebx)
+  803845:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803848:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80384b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80384e:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  803851:	89 d8                	mov    %ebx,%eax
+  803853:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803856:	5b                   	pop    %ebx
+  803857:	5e                   	pop    %esi
+  803858:	5d                   	pop    %ebp
+  803859:	c3                   	ret
+
+0080385a <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  80385a:	55                   	push   %ebp
+  80385b:	89 e5                	mov    %esp,%ebp
+  80385d:	53                   	push   %ebx
+  80385e:	83 ec 10             	sub    $0x10,%esp
+  803861:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  803864:	68 f9 58 80 00       	push   $0x8058f9
+  803869:	e8 8d c9 ff ff       	call   8001fb <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  80386e:	83 c4 08             	add    $0x8,%esp
+  803871:	ff 33                	push   (%ebx)
+  803873:	68 10 5a 80 00       	push   $0x805a10
+  803878:	e8 7e c9 ff ff       	call   8001fb <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  80387d:	83 c4 08             	add    $0x8,%esp
+  803880:	ff 73 04             	push   0x4(%ebx)
+  803883:	68 fb 58 80 00       	push   $0x8058fb
+  803888:	e8 6e c9 ff ff       	call   8001fb <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  80388d:	83 c4 08             	add    $0x8,%esp
+  803890:	ff 73 08             	push   0x8(%ebx)
+  803893:	68 30 5a 80 00       	push   $0x805a30
+  803898:	e8 5e c9 ff ff       	call   8001fb <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  80389d:	83 c4 08             	add    $0x8,%esp
+  8038a0:	ff 73 0c             	push   0xc(%ebx)
+  8038a3:	68 54 5a 80 00       	push   $0x805a54
+  8038a8:	e8 4e c9 ff ff       	call   8001fb <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  8038ad:	83 c4 08             	add    $0x8,%esp
+  8038b0:	ff 73 10             	push   0x10(%ebx)
+  8038b3:	68 78 5a 80 00       	push   $0x805a78
+  8038b8:	e8 3e c9 ff ff       	call   8001fb <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  8038bd:	83 c4 08             	add    $0x8,%esp
+  8038c0:	ff 35 08 b0 80 00    	push   0x80b008
+  8038c6:	68 b4 5a 80 00       	push   $0x805ab4
+  8038cb:	e8 2b c9 ff ff       	call   8001fb <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  8038d0:	83 c4 08             	add    $0x8,%esp
+  8038d3:	ff 35 04 b0 80 00    	push   0x80b004
+  8038d9:	68 e8 5a 80 00       	push   $0x805ae8
+  8038de:	e8 18 c9 ff ff       	call   8001fb <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  8038e3:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  8038e8:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  8038eb:	8b 50 68             	mov    0x68(%eax),%edx
+  8038ee:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  8038f1:	51                   	push   %ecx
+  8038f2:	52                   	push   %edx
+  8038f3:	50                   	push   %eax
+  8038f4:	68 28 5b 80 00       	push   $0x805b28
+  8038f9:	e8 fd c8 ff ff       	call   8001fb <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  8038fe:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  803903:	8b 40 70             	mov    0x70(%eax),%eax
+  803906:	83 c4 18             	add    $0x18,%esp
+  803909:	50                   	push   %eax
+  80390a:	68 5c 5b 80 00       	push   $0x805b5c
+  80390f:	e8 e7 c8 ff ff       	call   8001fb <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  803914:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  80391a:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803920:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  803925:	51                   	push   %ecx
+  803926:	52                   	push   %edx
+  803927:	50                   	push   %eax
+  803928:	68 8c 5b 80 00       	push   $0x805b8c
+  80392d:	e8 c9 c8 ff ff       	call   8001fb <cprintf>
+	cprintf("\n");
+  803932:	83 c4 14             	add    $0x14,%esp
+  803935:	68 f9 58 80 00       	push   $0x8058f9
+  80393a:	e8 bc c8 ff ff       	call   8001fb <cprintf>
+}
+  80393f:	83 c4 10             	add    $0x10,%esp
+  803942:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803945:	c9                   	leave
+  803946:	c3                   	ret
+
+00803947 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  803947:	55                   	push   %ebp
+  803948:	89 e5                	mov    %esp,%ebp
+  80394a:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  80394d:	e8 5e fe ff ff       	call   8037b0 <get_paging_stats>
+  803952:	83 ec 0c             	sub    $0xc,%esp
+  803955:	50                   	push   %eax
+  803956:	e8 ff fe ff ff       	call   80385a <print_paging_stats>
+}
+  80395b:	83 c4 10             	add    $0x10,%esp
+  80395e:	c9                   	leave
+  80395f:	c3                   	ret
+
+00803960 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803960:	55                   	push   %ebp
+  803961:	89 e5                	mov    %esp,%ebp
+  803963:	53                   	push   %ebx
+  803964:	83 ec 04             	sub    $0x4,%esp
+  803967:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  80396a:	eb 13                	jmp    80397f <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  80396c:	83 ec 04             	sub    $0x4,%esp
+  80396f:	6a ff                	push   $0xffffffff
+  803971:	53                   	push   %ebx
+  803972:	68 00 f0 ff ee       	push   $0xeefff000
+  803977:	e8 32 d8 ff ff       	call   8011ae <sys_futex_wait>
+  80397c:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  80397f:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  803984:	39 d8                	cmp    %ebx,%eax
+  803986:	74 e4                	je     80396c <mem_pressure_wait+0xc>
+	return now;
+}
+  803988:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80398b:	c9                   	leave
+  80398c:	c3                   	ret
+
+0080398d <init_map_dir>:
+
+void
+init_map_dir()
+{
+  80398d:	55                   	push   %ebp
+  80398e:	89 e5                	mov    %esp,%ebp
+  803990:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  803993:	68 ff 45 80 00       	push   $0x8045ff
+  803998:	e8 78 16 00 00       	call   805015 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  80399d:	c7 05 18 e9 80 00 00 	movl   $0xdeadb000,0x80e918
+  8039a4:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  8039a7:	83 c4 0c             	add    $0xc,%esp
+  8039aa:	68 07 02 00 00       	push   $0x207
+  8039af:	68 00 b0 ad de       	push   $0xdeadb000
+  8039b4:	6a 00                	push   $0x0
+  8039b6:	e8 1a d3 ff ff       	call   800cd5 <sys_page_alloc>
+  8039bb:	83 c4 10             	add    $0x10,%esp
+  8039be:	85 c0                	test   %eax,%eax
+  8039c0:	78 0c                	js     8039ce <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  8039c2:	e8 b4 f3 ff ff       	call   802d7b <find_paging_env>
+	page_ring_ready();
+  8039c7:	e8 7f f2 ff ff       	call   802c4b <page_ring_ready>
+}
+  8039cc:	c9                   	leave
+  8039cd:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  8039ce:	50                   	push   %eax
+  8039cf:	68 19 59 80 00       	push   $0x805919
+  8039d4:	68 13 05 00 00       	push   $0x513
+  8039d9:	68 d2 58 80 00       	push   $0x8058d2
+  8039de:	e8 5a 15 00 00       	call   804f3d <_panic>
+
+008039e3 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  8039e3:	55                   	push   %ebp
+  8039e4:	89 e5                	mov    %esp,%ebp
+  8039e6:	57                   	push   %edi
+  8039e7:	56                   	push   %esi
+  8039e8:	53                   	push   %ebx
+  8039e9:	83 ec 0c             	sub    $0xc,%esp
+  8039ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  8039ef:	89 fa                	mov    %edi,%edx
+  8039f1:	c1 ea 16             	shr    $0x16,%edx
+  8039f4:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8039f9:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  8039fc:	f6 06 01             	testb  $0x1,(%esi)
+  8039ff:	75 3e                	jne    803a3f <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803a01:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  803a06:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803a0a:	74 47                	je     803a53 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  803a0c:	83 ec 0c             	sub    $0xc,%esp
+  803a0f:	6a 01                	push   $0x1
+  803a11:	e8 f2 11 00 00       	call   804c08 <va_alloc>
+  803a16:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  803a18:	83 c4 10             	add    $0x10,%esp
+  803a1b:	85 c0                	test   %eax,%eax
+  803a1d:	74 34                	je     803a53 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803a1f:	6a 00                	push   $0x0
+  803a21:	68 07 02 00 00       	push   $0x207
+  803a26:	50                   	push   %eax
+  803a27:	6a 00                	push   $0x0
+  803a29:	e8 df 02 00 00       	call   803d0d <page_alloc>
+  803a2e:	83 c4 10             	add    $0x10,%esp
+  803a31:	85 c0                	test   %eax,%eax
+  803a33:	78 28                	js     803a5d <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  803a35:	f6 06 01             	testb  $0x1,(%esi)
+  803a38:	75 38                	jne    803a72 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803a3a:	83 cb 01             	or     $0x1,%ebx
+  803a3d:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803a3f:	89 f8                	mov    %edi,%eax
+  803a41:	c1 e8 0a             	shr    $0xa,%eax
+  803a44:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803a49:	8b 1e                	mov    (%esi),%ebx
+  803a4b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803a51:	01 c3                	add    %eax,%ebx
+}
+  803a53:	89 d8                	mov    %ebx,%eax
+  803a55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a58:	5b                   	pop    %ebx
+  803a59:	5e                   	pop    %esi
+  803a5a:	5f                   	pop    %edi
+  803a5b:	5d                   	pop    %ebp
+  803a5c:	c3                   	ret
+			va_free(page, 1);
+  803a5d:	83 ec 08             	sub    $0x8,%esp
+  803a60:	6a 01                	push   $0x1
+  803a62:	53                   	push   %ebx
+  803a63:	e8 d8 12 00 00       	call   804d40 <va_free>
+			return NULL;
+  803a68:	83 c4 10             	add    $0x10,%esp
+  803a6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a70:	eb e1                	jmp    803a53 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  803a72:	83 ec 08             	sub    $0x8,%esp
+  803a75:	53                   	push   %ebx
+  803a76:	6a 00                	push   $0x0
+  803a78:	e8 dd d2 ff ff       	call   800d5a <sys_page_unmap>
+			va_free(page, 1);
+  803a7d:	83 c4 08             	add    $0x8,%esp
+  803a80:	6a 01                	push   $0x1
+  803a82:	53                   	push   %ebx
+  803a83:	e8 b8 12 00 00       	call   804d40 <va_free>
+  803a88:	83 c4 10             	add    $0x10,%esp
+  803a8b:	eb b2                	jmp    803a3f <umapdir_walk+0x5c>
+
+00803a8d <page_out>:
+{
+  803a8d:	55                   	push   %ebp
+  803a8e:	89 e5                	mov    %esp,%ebp
+  803a90:	57                   	push   %edi
+  803a91:	56                   	push   %esi
+  803a92:	53                   	push   %ebx
+  803a93:	83 ec 5c             	sub    $0x5c,%esp
+  803a96:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803a99:	e8 dd f2 ff ff       	call   802d7b <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803a9e:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803aa3:	85 c0                	test   %eax,%eax
+  803aa5:	74 1e                	je     803ac5 <page_out+0x38>
+  803aa7:	83 ec 0c             	sub    $0xc,%esp
+  803aaa:	6a 00                	push   $0x0
+  803aac:	6a 00                	push   $0x0
+  803aae:	6a 00                	push   $0x0
+  803ab0:	6a 08                	push   $0x8
+  803ab2:	50                   	push   %eax
+  803ab3:	e8 d8 de ff ff       	call   801990 <ipc_call>
+  803ab8:	89 c3                	mov    %eax,%ebx
+  803aba:	83 c4 20             	add    $0x20,%esp
+  803abd:	85 c0                	test   %eax,%eax
+  803abf:	0f 84 ac 00 00 00    	je     803b71 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  803ac5:	83 ec 08             	sub    $0x8,%esp
+  803ac8:	ff 75 0c             	push   0xc(%ebp)
+  803acb:	57                   	push   %edi
+  803acc:	e8 e9 f9 ff ff       	call   8034ba <get_page_choice>
+  803ad1:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  803ad3:	83 c4 10             	add    $0x10,%esp
+  803ad6:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803adb:	0f 84 18 02 00 00    	je     803cf9 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803ae1:	e8 78 ee ff ff       	call   80295e <page_is_clean>
+  803ae6:	84 c0                	test   %al,%al
+  803ae8:	0f 85 8c 00 00 00    	jne    803b7a <page_out+0xed>
+	if (pagingenv == 0)
+  803aee:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803af5:	0f 84 08 02 00 00    	je     803d03 <page_out+0x276>
+	if (page_ring_ready())
+  803afb:	e8 4b f1 ff ff       	call   802c4b <page_ring_ready>
+  803b00:	89 c3                	mov    %eax,%ebx
+  803b02:	85 c0                	test   %eax,%eax
+  803b04:	0f 85 89 00 00 00    	jne    803b93 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  803b0a:	83 ec 0c             	sub    $0xc,%esp
+  803b0d:	6a 05                	push   $0x5
+  803b0f:	6a 01                	push   $0x1
+  803b11:	56                   	push   %esi
+  803b12:	6a 01                	push   $0x1
+  803b14:	ff 35 40 b0 80 00    	push   0x80b040
+  803b1a:	e8 71 de ff ff       	call   801990 <ipc_call>
+  803b1f:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803b21:	83 c4 20             	add    $0x20,%esp
+  803b24:	85 c0                	test   %eax,%eax
+  803b26:	0f 88 b8 01 00 00    	js     803ce4 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803b2c:	89 f0                	mov    %esi,%eax
+  803b2e:	c1 e8 0c             	shr    $0xc,%eax
+  803b31:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b38:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803b3b:	83 ec 08             	sub    $0x8,%esp
+  803b3e:	56                   	push   %esi
+  803b3f:	6a 00                	push   $0x0
+  803b41:	e8 14 d2 ff ff       	call   800d5a <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803b46:	83 c4 08             	add    $0x8,%esp
+  803b49:	6a 01                	push   $0x1
+  803b4b:	56                   	push   %esi
+  803b4c:	e8 92 fe ff ff       	call   8039e3 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803b51:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803b54:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803b5a:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803b5d:	09 fe                	or     %edi,%esi
+  803b5f:	83 ce 01             	or     $0x1,%esi
+  803b62:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803b64:	83 c4 10             	add    $0x10,%esp
+}
+  803b67:	89 d8                	mov    %ebx,%eax
+  803b69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b6c:	5b                   	pop    %ebx
+  803b6d:	5e                   	pop    %esi
+  803b6e:	5f                   	pop    %edi
+  803b6f:	5d                   	pop    %ebp
+  803b70:	c3                   	ret
+		num_page_reclaims++;
+  803b71:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  803b78:	eb ed                	jmp    803b67 <page_out+0xda>
+		num_page_drops++;
+  803b7a:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  803b81:	83 ec 08             	sub    $0x8,%esp
+  803b84:	56                   	push   %esi
+  803b85:	6a 00                	push   $0x0
+  803b87:	e8 ce d1 ff ff       	call   800d5a <sys_page_unmap>
+  803b8c:	89 c3                	mov    %eax,%ebx
+  803b8e:	83 c4 10             	add    $0x10,%esp
+  803b91:	eb d4                	jmp    803b67 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803b93:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803b95:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803b9a:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803b9f:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803ba2:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803ba4:	83 c0 08             	add    $0x8,%eax
+  803ba7:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803baa:	b8 07 00 00 00       	mov    $0x7,%eax
+  803baf:	e8 e5 ef ff ff       	call   802b99 <page_ring_reserve>
+	first = ring->sq_tail;
+  803bb4:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803bb9:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803bbc:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803bc1:	83 ec 04             	sub    $0x4,%esp
+  803bc4:	68 00 10 00 00       	push   $0x1000
+  803bc9:	56                   	push   %esi
+  803bca:	89 d8                	mov    %ebx,%eax
+  803bcc:	c1 e0 0c             	shl    $0xc,%eax
+  803bcf:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803bd4:	50                   	push   %eax
+  803bd5:	e8 f0 cd ff ff       	call   8009ca <memcpy>
+		vas[n] = va;
+  803bda:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803bde:	89 d9                	mov    %ebx,%ecx
+  803be0:	ba 00 00 00 00       	mov    $0x0,%edx
+  803be5:	b8 01 00 00 00       	mov    $0x1,%eax
+  803bea:	e8 de ee ff ff       	call   802acd <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803bef:	8d 43 01             	lea    0x1(%ebx),%eax
+  803bf2:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803bf5:	83 c4 10             	add    $0x10,%esp
+  803bf8:	83 fb 06             	cmp    $0x6,%ebx
+  803bfb:	74 62                	je     803c5f <page_out+0x1d2>
+  803bfd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803c00:	eb 15                	jmp    803c17 <page_out+0x18a>
+			num_page_drops++;
+  803c02:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  803c09:	83 ec 08             	sub    $0x8,%esp
+  803c0c:	56                   	push   %esi
+  803c0d:	6a 00                	push   $0x0
+  803c0f:	e8 46 d1 ff ff       	call   800d5a <sys_page_unmap>
+  803c14:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803c17:	83 ec 08             	sub    $0x8,%esp
+  803c1a:	53                   	push   %ebx
+  803c1b:	57                   	push   %edi
+  803c1c:	e8 99 f8 ff ff       	call   8034ba <get_page_choice>
+  803c21:	89 c6                	mov    %eax,%esi
+  803c23:	83 c4 10             	add    $0x10,%esp
+  803c26:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803c2b:	74 32                	je     803c5f <page_out+0x1d2>
+  803c2d:	e8 2c ed ff ff       	call   80295e <page_is_clean>
+  803c32:	84 c0                	test   %al,%al
+  803c34:	75 cc                	jne    803c02 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803c36:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803c39:	39 c6                	cmp    %eax,%esi
+  803c3b:	72 07                	jb     803c44 <page_out+0x1b7>
+  803c3d:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803c40:	39 c6                	cmp    %eax,%esi
+  803c42:	72 1b                	jb     803c5f <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803c44:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c49:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803c4c:	eb 03                	jmp    803c51 <page_out+0x1c4>
+  803c4e:	83 c3 01             	add    $0x1,%ebx
+  803c51:	39 da                	cmp    %ebx,%edx
+  803c53:	0f 84 68 ff ff ff    	je     803bc1 <page_out+0x134>
+  803c59:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803c5d:	75 ef                	jne    803c4e <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803c5f:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803c62:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803c65:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803c68:	e8 a6 ee ff ff       	call   802b13 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803c6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c72:	eb 42                	jmp    803cb6 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803c74:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803c78:	89 f8                	mov    %edi,%eax
+  803c7a:	c1 e8 0c             	shr    $0xc,%eax
+  803c7d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803c84:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803c87:	83 ec 08             	sub    $0x8,%esp
+  803c8a:	57                   	push   %edi
+  803c8b:	6a 00                	push   $0x0
+  803c8d:	e8 c8 d0 ff ff       	call   800d5a <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803c92:	83 c4 08             	add    $0x8,%esp
+  803c95:	6a 01                	push   $0x1
+  803c97:	57                   	push   %edi
+  803c98:	e8 46 fd ff ff       	call   8039e3 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803c9d:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803ca0:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803ca6:	c1 e6 0c             	shl    $0xc,%esi
+  803ca9:	09 d6                	or     %edx,%esi
+  803cab:	83 ce 01             	or     $0x1,%esi
+  803cae:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803cb0:	83 c3 01             	add    $0x1,%ebx
+  803cb3:	83 c4 10             	add    $0x10,%esp
+  803cb6:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803cb9:	39 c3                	cmp    %eax,%ebx
+  803cbb:	74 1d                	je     803cda <page_out+0x24d>
+		if (res[i] < 0)
+  803cbd:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803cc1:	85 f6                	test   %esi,%esi
+  803cc3:	79 af                	jns    803c74 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803cc5:	56                   	push   %esi
+  803cc6:	68 bc 5b 80 00       	push   $0x805bbc
+  803ccb:	68 d1 02 00 00       	push   $0x2d1
+  803cd0:	68 d2 58 80 00       	push   $0x8058d2
+  803cd5:	e8 63 12 00 00       	call   804f3d <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803cda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803cdf:	e9 83 fe ff ff       	jmp    803b67 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803ce4:	50                   	push   %eax
+  803ce5:	68 bc 5b 80 00       	push   $0x805bbc
+  803cea:	68 0a 03 00 00       	push   $0x30a
+  803cef:	68 d2 58 80 00       	push   $0x8058d2
+  803cf4:	e8 44 12 00 00       	call   804f3d <_panic>
+		return -E_NO_MEM;
+  803cf9:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803cfe:	e9 64 fe ff ff       	jmp    803b67 <page_out+0xda>
+		return -E_PAGING;
+  803d03:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803d08:	e9 5a fe ff ff       	jmp    803b67 <page_out+0xda>
+
+00803d0d <page_alloc>:
+{
+  803d0d:	55                   	push   %ebp
+  803d0e:	89 e5                	mov    %esp,%ebp
+  803d10:	57                   	push   %edi
+  803d11:	56                   	push   %esi
+  803d12:	53                   	push   %ebx
+  803d13:	83 ec 0c             	sub    $0xc,%esp
+  803d16:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803d19:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803d1c:	83 3d 18 e9 80 00 00 	cmpl   $0x0,0x80e918
+  803d23:	74 34                	je     803d59 <page_alloc+0x4c>
+	if (check_mte)
+  803d25:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803d29:	75 35                	jne    803d60 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803d2b:	83 ec 04             	sub    $0x4,%esp
+  803d2e:	ff 75 10             	push   0x10(%ebp)
+  803d31:	56                   	push   %esi
+  803d32:	57                   	push   %edi
+  803d33:	e8 9d cf ff ff       	call   800cd5 <sys_page_alloc>
+  803d38:	89 c3                	mov    %eax,%ebx
+  803d3a:	83 c4 10             	add    $0x10,%esp
+  803d3d:	85 c0                	test   %eax,%eax
+  803d3f:	79 52                	jns    803d93 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803d41:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803d44:	75 52                	jne    803d98 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803d46:	83 ec 08             	sub    $0x8,%esp
+  803d49:	56                   	push   %esi
+  803d4a:	57                   	push   %edi
+  803d4b:	e8 3d fd ff ff       	call   803a8d <page_out>
+  803d50:	83 c4 10             	add    $0x10,%esp
+  803d53:	85 c0                	test   %eax,%eax
+  803d55:	79 d4                	jns    803d2b <page_alloc+0x1e>
+  803d57:	eb 3f                	jmp    803d98 <page_alloc+0x8b>
+		init_map_dir();
+  803d59:	e8 2f fc ff ff       	call   80398d <init_map_dir>
+  803d5e:	eb c5                	jmp    803d25 <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803d60:	83 ec 08             	sub    $0x8,%esp
+  803d63:	6a 00                	push   $0x0
+  803d65:	56                   	push   %esi
+  803d66:	e8 78 fc ff ff       	call   8039e3 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803d6b:	83 c4 10             	add    $0x10,%esp
+  803d6e:	85 c0                	test   %eax,%eax
+  803d70:	74 b9                	je     803d2b <page_alloc+0x1e>
+  803d72:	8b 10                	mov    (%eax),%edx
+  803d74:	f6 c2 01             	test   $0x1,%dl
+  803d77:	74 b2                	je     803d2b <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803d79:	83 ec 08             	sub    $0x8,%esp
+  803d7c:	56                   	push   %esi
+  803d7d:	52                   	push   %edx
+  803d7e:	50                   	push   %eax
+  803d7f:	68 e0 5b 80 00       	push   $0x805be0
+  803d84:	68 34 03 00 00       	push   $0x334
+  803d89:	68 d2 58 80 00       	push   $0x8058d2
+  803d8e:	e8 aa 11 00 00       	call   804f3d <_panic>
+	return 0;
+  803d93:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803d98:	89 d8                	mov    %ebx,%eax
+  803d9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d9d:	5b                   	pop    %ebx
+  803d9e:	5e                   	pop    %esi
+  803d9f:	5f                   	pop    %edi
+  803da0:	5d                   	pop    %ebp
+  803da1:	c3                   	ret
+
+00803da2 <page_adopt>:
+{
+  803da2:	55                   	push   %ebp
+  803da3:	89 e5                	mov    %esp,%ebp
+  803da5:	56                   	push   %esi
+  803da6:	53                   	push   %ebx
+  803da7:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803da9:	c1 e8 16             	shr    $0x16,%eax
+  803dac:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803db3:	25 81 00 00 00       	and    $0x81,%eax
+  803db8:	83 f8 01             	cmp    $0x1,%eax
+  803dbb:	75 53                	jne    803e10 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803dbd:	89 d8                	mov    %ebx,%eax
+  803dbf:	c1 e8 0c             	shr    $0xc,%eax
+  803dc2:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803dc9:	89 f2                	mov    %esi,%edx
+  803dcb:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803dd1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803dd6:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803ddc:	75 37                	jne    803e15 <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803dde:	83 ec 08             	sub    $0x8,%esp
+  803de1:	6a 01                	push   $0x1
+  803de3:	53                   	push   %ebx
+  803de4:	e8 fa fb ff ff       	call   8039e3 <umapdir_walk>
+  803de9:	83 c4 10             	add    $0x10,%esp
+  803dec:	85 c0                	test   %eax,%eax
+  803dee:	74 2c                	je     803e1c <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803df0:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803df6:	83 ce 01             	or     $0x1,%esi
+  803df9:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803dfb:	83 ec 08             	sub    $0x8,%esp
+  803dfe:	53                   	push   %ebx
+  803dff:	6a 00                	push   $0x0
+  803e01:	e8 54 cf ff ff       	call   800d5a <sys_page_unmap>
+	return 1;
+  803e06:	83 c4 10             	add    $0x10,%esp
+  803e09:	b8 01 00 00 00       	mov    $0x1,%eax
+  803e0e:	eb 05                	jmp    803e15 <page_adopt+0x73>
+		return 0;
+  803e10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e18:	5b                   	pop    %ebx
+  803e19:	5e                   	pop    %esi
+  803e1a:	5d                   	pop    %ebp
+  803e1b:	c3                   	ret
+		return -E_NO_MEM;
+  803e1c:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803e21:	eb f2                	jmp    803e15 <page_adopt+0x73>
+
+00803e23 <page_forget>:
+{
+  803e23:	55                   	push   %ebp
+  803e24:	89 e5                	mov    %esp,%ebp
+  803e26:	53                   	push   %ebx
+  803e27:	83 ec 04             	sub    $0x4,%esp
+  803e2a:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803e2c:	e8 4a ef ff ff       	call   802d7b <find_paging_env>
+	if (pagingenv == 0)
+  803e31:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803e38:	74 39                	je     803e73 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803e3a:	89 d8                	mov    %ebx,%eax
+  803e3c:	c1 e8 16             	shr    $0x16,%eax
+  803e3f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803e46:	25 81 00 00 00       	and    $0x81,%eax
+  803e4b:	83 f8 01             	cmp    $0x1,%eax
+  803e4e:	74 28                	je     803e78 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803e50:	83 3d 18 e9 80 00 00 	cmpl   $0x0,0x80e918
+  803e57:	74 1a                	je     803e73 <page_forget+0x50>
+  803e59:	83 ec 08             	sub    $0x8,%esp
+  803e5c:	6a 00                	push   $0x0
+  803e5e:	53                   	push   %ebx
+  803e5f:	e8 7f fb ff ff       	call   8039e3 <umapdir_walk>
+  803e64:	89 c3                	mov    %eax,%ebx
+  803e66:	83 c4 10             	add    $0x10,%esp
+  803e69:	85 c0                	test   %eax,%eax
+  803e6b:	74 06                	je     803e73 <page_forget+0x50>
+  803e6d:	8b 00                	mov    (%eax),%eax
+  803e6f:	a8 01                	test   $0x1,%al
+  803e71:	75 2b                	jne    803e9e <page_forget+0x7b>
+}
+  803e73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e76:	c9                   	leave
+  803e77:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803e78:	89 d8                	mov    %ebx,%eax
+  803e7a:	c1 e8 0c             	shr    $0xc,%eax
+  803e7d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803e84:	89 c2                	mov    %eax,%edx
+  803e86:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803e8c:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803e92:	75 bc                	jne    803e50 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803e94:	c1 e8 0c             	shr    $0xc,%eax
+  803e97:	e8 5c ee ff ff       	call   802cf8 <page_remove_slot>
+		return;
+  803e9c:	eb d5                	jmp    803e73 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803e9e:	c1 e8 0c             	shr    $0xc,%eax
+  803ea1:	e8 52 ee ff ff       	call   802cf8 <page_remove_slot>
+	*mte = 0;
+  803ea6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803eac:	eb c5                	jmp    803e73 <page_forget+0x50>
+
+00803eae <page_unmap>:
+{
+  803eae:	55                   	push   %ebp
+  803eaf:	89 e5                	mov    %esp,%ebp
+  803eb1:	57                   	push   %edi
+  803eb2:	56                   	push   %esi
+  803eb3:	53                   	push   %ebx
+  803eb4:	83 ec 0c             	sub    $0xc,%esp
+  803eb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803eba:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803ebd:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  803ec2:	8b 40 48             	mov    0x48(%eax),%eax
+  803ec5:	85 db                	test   %ebx,%ebx
+  803ec7:	0f 8e b4 00 00 00    	jle    803f81 <page_unmap+0xd3>
+  803ecd:	39 d8                	cmp    %ebx,%eax
+  803ecf:	0f 84 ac 00 00 00    	je     803f81 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803ed5:	83 ec 08             	sub    $0x8,%esp
+  803ed8:	57                   	push   %edi
+  803ed9:	53                   	push   %ebx
+  803eda:	e8 7b ce ff ff       	call   800d5a <sys_page_unmap>
+  803edf:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803ee1:	e8 95 ee ff ff       	call   802d7b <find_paging_env>
+	if (pagingenv == 0)
+  803ee6:	83 c4 10             	add    $0x10,%esp
+  803ee9:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803ef0:	0f 84 a1 00 00 00    	je     803f97 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803ef6:	83 ec 0c             	sub    $0xc,%esp
+  803ef9:	6a 05                	push   $0x5
+  803efb:	68 00 00 40 00       	push   $0x400000
+  803f00:	6a 00                	push   $0x0
+  803f02:	68 00 b0 ad de       	push   $0xdeadb000
+  803f07:	53                   	push   %ebx
+  803f08:	e8 0b ce ff ff       	call   800d18 <sys_page_map>
+  803f0d:	83 c4 20             	add    $0x20,%esp
+  803f10:	85 c0                	test   %eax,%eax
+  803f12:	0f 88 89 00 00 00    	js     803fa1 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803f18:	89 f8                	mov    %edi,%eax
+  803f1a:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803f1d:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803f24:	a8 01                	test   $0x1,%al
+  803f26:	74 6f                	je     803f97 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803f28:	83 ec 0c             	sub    $0xc,%esp
+  803f2b:	6a 05                	push   $0x5
+  803f2d:	68 00 00 40 00       	push   $0x400000
+  803f32:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803f34:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803f39:	50                   	push   %eax
+  803f3a:	53                   	push   %ebx
+  803f3b:	e8 d8 cd ff ff       	call   800d18 <sys_page_map>
+  803f40:	83 c4 20             	add    $0x20,%esp
+  803f43:	85 c0                	test   %eax,%eax
+  803f45:	78 6f                	js     803fb6 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803f47:	c1 ef 0c             	shr    $0xc,%edi
+  803f4a:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803f50:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803f57:	01 
+  803f58:	74 3d                	je     803f97 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803f5a:	83 ec 08             	sub    $0x8,%esp
+  803f5d:	68 00 00 40 00       	push   $0x400000
+  803f62:	6a 00                	push   $0x0
+  803f64:	e8 f1 cd ff ff       	call   800d5a <sys_page_unmap>
+  803f69:	83 c4 10             	add    $0x10,%esp
+  803f6c:	85 c0                	test   %eax,%eax
+  803f6e:	78 5b                	js     803fcb <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803f70:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803f77:	c1 e8 0c             	shr    $0xc,%eax
+  803f7a:	e8 79 ed ff ff       	call   802cf8 <page_remove_slot>
+	return r;
+  803f7f:	eb 16                	jmp    803f97 <page_unmap+0xe9>
+		page_forget(va);
+  803f81:	89 f8                	mov    %edi,%eax
+  803f83:	e8 9b fe ff ff       	call   803e23 <page_forget>
+		return sys_page_unmap(envid, va);
+  803f88:	83 ec 08             	sub    $0x8,%esp
+  803f8b:	57                   	push   %edi
+  803f8c:	53                   	push   %ebx
+  803f8d:	e8 c8 cd ff ff       	call   800d5a <sys_page_unmap>
+  803f92:	89 c6                	mov    %eax,%esi
+  803f94:	83 c4 10             	add    $0x10,%esp
+}
+  803f97:	89 f0                	mov    %esi,%eax
+  803f99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f9c:	5b                   	pop    %ebx
+  803f9d:	5e                   	pop    %esi
+  803f9e:	5f                   	pop    %edi
+  803f9f:	5d                   	pop    %ebp
+  803fa0:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803fa1:	50                   	push   %eax
+  803fa2:	68 1c 5c 80 00       	push   $0x805c1c
+  803fa7:	68 e4 03 00 00       	push   $0x3e4
+  803fac:	68 d2 58 80 00       	push   $0x8058d2
+  803fb1:	e8 87 0f 00 00       	call   804f3d <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803fb6:	50                   	push   %eax
+  803fb7:	68 48 5c 80 00       	push   $0x805c48
+  803fbc:	68 ea 03 00 00       	push   $0x3ea
+  803fc1:	68 d2 58 80 00       	push   $0x8058d2
+  803fc6:	e8 72 0f 00 00       	call   804f3d <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803fcb:	50                   	push   %eax
+  803fcc:	68 74 5c 80 00       	push   $0x805c74
+  803fd1:	68 ef 03 00 00       	push   $0x3ef
+  803fd6:	68 d2 58 80 00       	push   $0x8058d2
+  803fdb:	e8 5d 0f 00 00       	call   804f3d <_panic>
+
+00803fe0 <page_unmap_range>:
+{
+  803fe0:	55                   	push   %ebp
+  803fe1:	89 e5                	mov    %esp,%ebp
+  803fe3:	57                   	push   %edi
+  803fe4:	56                   	push   %esi
+  803fe5:	53                   	push   %ebx
+  803fe6:	83 ec 0c             	sub    $0xc,%esp
+  803fe9:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803fec:	e8 8a ed ff ff       	call   802d7b <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803ff1:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  803ff6:	8b 40 48             	mov    0x48(%eax),%eax
+  803ff9:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803ffd:	7e 38                	jle    804037 <page_unmap_range+0x57>
+  803fff:	3b 45 08             	cmp    0x8(%ebp),%eax
+  804002:	74 33                	je     804037 <page_unmap_range+0x57>
+  804004:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  80400b:	74 2a                	je     804037 <page_unmap_range+0x57>
+  80400d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  804010:	be 00 00 00 00       	mov    $0x0,%esi
+  804015:	39 fe                	cmp    %edi,%esi
+  804017:	74 56                	je     80406f <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  804019:	83 ec 08             	sub    $0x8,%esp
+  80401c:	53                   	push   %ebx
+  80401d:	ff 75 08             	push   0x8(%ebp)
+  804020:	e8 89 fe ff ff       	call   803eae <page_unmap>
+  804025:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80402b:	83 c4 10             	add    $0x10,%esp
+  80402e:	85 c0                	test   %eax,%eax
+  804030:	78 35                	js     804067 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  804032:	83 c6 01             	add    $0x1,%esi
+  804035:	eb de                	jmp    804015 <page_unmap_range+0x35>
+  804037:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  80403a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80403f:	eb 10                	jmp    804051 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  804041:	89 f0                	mov    %esi,%eax
+  804043:	e8 db fd ff ff       	call   803e23 <page_forget>
+		for (i = 0; i < npages; i++)
+  804048:	83 c3 01             	add    $0x1,%ebx
+  80404b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  804051:	39 fb                	cmp    %edi,%ebx
+  804053:	75 ec                	jne    804041 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  804055:	83 ec 04             	sub    $0x4,%esp
+  804058:	57                   	push   %edi
+  804059:	ff 75 0c             	push   0xc(%ebp)
+  80405c:	ff 75 08             	push   0x8(%ebp)
+  80405f:	e8 0a ce ff ff       	call   800e6e <sys_page_unmap_range>
+  804064:	83 c4 10             	add    $0x10,%esp
+}
+  804067:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80406a:	5b                   	pop    %ebx
+  80406b:	5e                   	pop    %esi
+  80406c:	5f                   	pop    %edi
+  80406d:	5d                   	pop    %ebp
+  80406e:	c3                   	ret
+	return 0;
+  80406f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804074:	eb f1                	jmp    804067 <page_unmap_range+0x87>
+
+00804076 <page_alloc_range>:
+{
+  804076:	55                   	push   %ebp
+  804077:	89 e5                	mov    %esp,%ebp
+  804079:	57                   	push   %edi
+  80407a:	56                   	push   %esi
+  80407b:	53                   	push   %ebx
+  80407c:	83 ec 1c             	sub    $0x1c,%esp
+  80407f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804082:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  804085:	83 3d 18 e9 80 00 00 	cmpl   $0x0,0x80e918
+  80408c:	74 14                	je     8040a2 <page_alloc_range+0x2c>
+	if (check_mte)
+  80408e:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  804092:	74 66                	je     8040fa <page_alloc_range+0x84>
+  804094:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  804096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80409b:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  80409e:	89 c7                	mov    %eax,%edi
+  8040a0:	eb 10                	jmp    8040b2 <page_alloc_range+0x3c>
+		init_map_dir();
+  8040a2:	e8 e6 f8 ff ff       	call   80398d <init_map_dir>
+  8040a7:	eb e5                	jmp    80408e <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  8040a9:	83 c7 01             	add    $0x1,%edi
+  8040ac:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8040b2:	39 df                	cmp    %ebx,%edi
+  8040b4:	74 38                	je     8040ee <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  8040b6:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8040b9:	83 ec 08             	sub    $0x8,%esp
+  8040bc:	6a 00                	push   $0x0
+  8040be:	56                   	push   %esi
+  8040bf:	e8 1f f9 ff ff       	call   8039e3 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  8040c4:	83 c4 10             	add    $0x10,%esp
+  8040c7:	85 c0                	test   %eax,%eax
+  8040c9:	74 de                	je     8040a9 <page_alloc_range+0x33>
+  8040cb:	8b 10                	mov    (%eax),%edx
+  8040cd:	f6 c2 01             	test   $0x1,%dl
+  8040d0:	74 d7                	je     8040a9 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  8040d2:	83 ec 08             	sub    $0x8,%esp
+  8040d5:	ff 75 e4             	push   -0x1c(%ebp)
+  8040d8:	52                   	push   %edx
+  8040d9:	50                   	push   %eax
+  8040da:	68 e0 5b 80 00       	push   $0x805be0
+  8040df:	68 0b 04 00 00       	push   $0x40b
+  8040e4:	68 d2 58 80 00       	push   $0x8058d2
+  8040e9:	e8 4f 0e 00 00       	call   804f3d <_panic>
+  8040ee:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8040f1:	eb 07                	jmp    8040fa <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  8040f3:	c1 e0 0c             	shl    $0xc,%eax
+  8040f6:	01 c7                	add    %eax,%edi
+			npages -= r;
+  8040f8:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  8040fa:	85 db                	test   %ebx,%ebx
+  8040fc:	74 30                	je     80412e <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  8040fe:	ff 75 14             	push   0x14(%ebp)
+  804101:	53                   	push   %ebx
+  804102:	57                   	push   %edi
+  804103:	ff 75 08             	push   0x8(%ebp)
+  804106:	e8 f5 cc ff ff       	call   800e00 <sys_page_alloc_range>
+  80410b:	89 c6                	mov    %eax,%esi
+  80410d:	83 c4 10             	add    $0x10,%esp
+  804110:	85 c0                	test   %eax,%eax
+  804112:	7f df                	jg     8040f3 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  804114:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  804117:	75 1a                	jne    804133 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  804119:	83 ec 08             	sub    $0x8,%esp
+  80411c:	57                   	push   %edi
+  80411d:	ff 75 08             	push   0x8(%ebp)
+  804120:	e8 68 f9 ff ff       	call   803a8d <page_out>
+  804125:	83 c4 10             	add    $0x10,%esp
+  804128:	85 c0                	test   %eax,%eax
+  80412a:	79 ce                	jns    8040fa <page_alloc_range+0x84>
+  80412c:	eb 05                	jmp    804133 <page_alloc_range+0xbd>
+	return 0;
+  80412e:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  804133:	89 f0                	mov    %esi,%eax
+  804135:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804138:	5b                   	pop    %ebx
+  804139:	5e                   	pop    %esi
+  80413a:	5f                   	pop    %edi
+  80413b:	5d                   	pop    %ebp
+  80413c:	c3                   	ret
+
+0080413d <page_in>:
+{
+  80413d:	55                   	push   %ebp
+  80413e:	89 e5                	mov    %esp,%ebp
+  804140:	57                   	push   %edi
+  804141:	56                   	push   %esi
+  804142:	53                   	push   %ebx
+  804143:	83 ec 3c             	sub    $0x3c,%esp
+  804146:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  804149:	e8 2d ec ff ff       	call   802d7b <find_paging_env>
+	if (pagingenv == 0)
+  80414e:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  804155:	0f 84 09 02 00 00    	je     804364 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  80415b:	83 ec 08             	sub    $0x8,%esp
+  80415e:	6a 00                	push   $0x0
+  804160:	56                   	push   %esi
+  804161:	e8 7d f8 ff ff       	call   8039e3 <umapdir_walk>
+  804166:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  804168:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80416e:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  804171:	83 c4 10             	add    $0x10,%esp
+  804174:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804178:	74 0d                	je     804187 <page_in+0x4a>
+  80417a:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  80417f:	8b 40 48             	mov    0x48(%eax),%eax
+  804182:	3b 45 08             	cmp    0x8(%ebp),%eax
+  804185:	75 06                	jne    80418d <page_in+0x50>
+  804187:	8b 03                	mov    (%ebx),%eax
+  804189:	a8 02                	test   $0x2,%al
+  80418b:	75 63                	jne    8041f0 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  80418d:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  80418f:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804191:	89 f0                	mov    %esi,%eax
+  804193:	25 06 0e 00 00       	and    $0xe06,%eax
+  804198:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  80419b:	50                   	push   %eax
+  80419c:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  80419f:	57                   	push   %edi
+  8041a0:	ff 75 08             	push   0x8(%ebp)
+  8041a3:	e8 65 fb ff ff       	call   803d0d <page_alloc>
+  8041a8:	83 c4 10             	add    $0x10,%esp
+  8041ab:	85 c0                	test   %eax,%eax
+  8041ad:	78 39                	js     8041e8 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  8041af:	89 f0                	mov    %esi,%eax
+  8041b1:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8041b4:	83 ec 0c             	sub    $0xc,%esp
+  8041b7:	6a 07                	push   $0x7
+  8041b9:	6a 01                	push   $0x1
+  8041bb:	57                   	push   %edi
+  8041bc:	c1 e0 04             	shl    $0x4,%eax
+  8041bf:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8041c0:	c1 ee 1c             	shr    $0x1c,%esi
+  8041c3:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8041c6:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8041cd:	e8 be d7 ff ff       	call   801990 <ipc_call>
+  8041d2:	83 c4 20             	add    $0x20,%esp
+  8041d5:	85 c0                	test   %eax,%eax
+  8041d7:	0f 88 72 01 00 00    	js     80434f <page_in+0x212>
+	*mte = 0;
+  8041dd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  8041e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041eb:	5b                   	pop    %ebx
+  8041ec:	5e                   	pop    %esi
+  8041ed:	5f                   	pop    %edi
+  8041ee:	5d                   	pop    %ebp
+  8041ef:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  8041f0:	25 06 0e 00 00       	and    $0xe06,%eax
+  8041f5:	83 c8 01             	or     $0x1,%eax
+  8041f8:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  8041fb:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  8041fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  804201:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  804207:	be 01 00 00 00       	mov    $0x1,%esi
+  80420c:	eb 46                	jmp    804254 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  80420e:	83 ec 08             	sub    $0x8,%esp
+  804211:	6a 00                	push   $0x0
+  804213:	51                   	push   %ecx
+  804214:	e8 ca f7 ff ff       	call   8039e3 <umapdir_walk>
+  804219:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  80421d:	83 c4 10             	add    $0x10,%esp
+  804220:	85 c0                	test   %eax,%eax
+  804222:	74 66                	je     80428a <page_in+0x14d>
+  804224:	8b 00                	mov    (%eax),%eax
+  804226:	a8 01                	test   $0x1,%al
+  804228:	74 60                	je     80428a <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  80422a:	89 c2                	mov    %eax,%edx
+  80422c:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  804232:	83 ca 01             	or     $0x1,%edx
+  804235:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  804238:	75 50                	jne    80428a <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  80423a:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804240:	c1 e8 1c             	shr    $0x1c,%eax
+  804243:	8b 13                	mov    (%ebx),%edx
+  804245:	c1 ea 1c             	shr    $0x1c,%edx
+  804248:	39 d0                	cmp    %edx,%eax
+  80424a:	75 3e                	jne    80428a <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  80424c:	83 c6 01             	add    $0x1,%esi
+  80424f:	83 fe 08             	cmp    $0x8,%esi
+  804252:	74 3f                	je     804293 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  804254:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  804256:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  80425c:	77 2c                	ja     80428a <page_in+0x14d>
+  80425e:	89 f8                	mov    %edi,%eax
+  804260:	c1 e8 16             	shr    $0x16,%eax
+  804263:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80426a:	f6 c2 01             	test   $0x1,%dl
+  80426d:	74 9f                	je     80420e <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  80426f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  804276:	a8 80                	test   $0x80,%al
+  804278:	75 10                	jne    80428a <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  80427a:	89 f8                	mov    %edi,%eax
+  80427c:	c1 e8 0c             	shr    $0xc,%eax
+  80427f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804286:	a8 01                	test   $0x1,%al
+  804288:	74 84                	je     80420e <page_in+0xd1>
+	if (n == 1)
+  80428a:	83 fe 01             	cmp    $0x1,%esi
+  80428d:	0f 84 fa fe ff ff    	je     80418d <page_in+0x50>
+	req.nslots = n;
+  804293:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  804299:	b8 00 00 00 00       	mov    $0x0,%eax
+  80429e:	eb 13                	jmp    8042b3 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  8042a0:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  8042a4:	8b 12                	mov    (%edx),%edx
+  8042a6:	c1 ea 0c             	shr    $0xc,%edx
+  8042a9:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  8042b0:	83 c0 01             	add    $0x1,%eax
+  8042b3:	39 c6                	cmp    %eax,%esi
+  8042b5:	75 e9                	jne    8042a0 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  8042b7:	83 ec 0c             	sub    $0xc,%esp
+  8042ba:	6a 00                	push   $0x0
+  8042bc:	ff 75 c0             	push   -0x40(%ebp)
+  8042bf:	56                   	push   %esi
+  8042c0:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  8042c3:	57                   	push   %edi
+  8042c4:	6a 00                	push   $0x0
+  8042c6:	e8 ab fd ff ff       	call   804076 <page_alloc_range>
+  8042cb:	83 c4 20             	add    $0x20,%esp
+  8042ce:	85 c0                	test   %eax,%eax
+  8042d0:	78 6e                	js     804340 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  8042d2:	83 ec 04             	sub    $0x4,%esp
+  8042d5:	6a 24                	push   $0x24
+  8042d7:	68 00 80 80 00       	push   $0x808000
+  8042dc:	57                   	push   %edi
+  8042dd:	e8 86 c6 ff ff       	call   800968 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  8042e2:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8042e9:	56                   	push   %esi
+  8042ea:	57                   	push   %edi
+  8042eb:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8042ed:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  8042f4:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  8042f7:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  8042fe:	e8 8d d6 ff ff       	call   801990 <ipc_call>
+  804303:	83 c4 20             	add    $0x20,%esp
+  804306:	85 c0                	test   %eax,%eax
+  804308:	78 08                	js     804312 <page_in+0x1d5>
+  80430a:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80430d:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  804310:	eb 20                	jmp    804332 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  804312:	50                   	push   %eax
+  804313:	68 a0 5c 80 00       	push   $0x805ca0
+  804318:	68 59 02 00 00       	push   $0x259
+  80431d:	68 d2 58 80 00       	push   $0x8058d2
+  804322:	e8 16 0c 00 00       	call   804f3d <_panic>
+		*mtes[i] = 0;
+  804327:	8b 10                	mov    (%eax),%edx
+  804329:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  80432f:	83 c0 04             	add    $0x4,%eax
+  804332:	39 c8                	cmp    %ecx,%eax
+  804334:	75 f1                	jne    804327 <page_in+0x1ea>
+	return n;
+  804336:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  804338:	85 f6                	test   %esi,%esi
+  80433a:	0f 84 4d fe ff ff    	je     80418d <page_in+0x50>
+		return r < 0 ? r : 0;
+  804340:	85 c0                	test   %eax,%eax
+  804342:	ba 00 00 00 00       	mov    $0x0,%edx
+  804347:	0f 4f c2             	cmovg  %edx,%eax
+  80434a:	e9 99 fe ff ff       	jmp    8041e8 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  80434f:	50                   	push   %eax
+  804350:	68 d8 5c 80 00       	push   $0x805cd8
+  804355:	68 9a 02 00 00       	push   $0x29a
+  80435a:	68 d2 58 80 00       	push   $0x8058d2
+  80435f:	e8 d9 0b 00 00       	call   804f3d <_panic>
+		return -E_PAGING;
+  804364:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804369:	e9 7a fe ff ff       	jmp    8041e8 <page_in+0xab>
+
+0080436e <page_map>:
+{
+  80436e:	55                   	push   %ebp
+  80436f:	89 e5                	mov    %esp,%ebp
+  804371:	57                   	push   %edi
+  804372:	56                   	push   %esi
+  804373:	53                   	push   %ebx
+  804374:	83 ec 1c             	sub    $0x1c,%esp
+  804377:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  80437a:	83 ec 0c             	sub    $0xc,%esp
+  80437d:	ff 75 18             	push   0x18(%ebp)
+  804380:	ff 75 14             	push   0x14(%ebp)
+  804383:	ff 75 10             	push   0x10(%ebp)
+  804386:	ff 75 0c             	push   0xc(%ebp)
+  804389:	56                   	push   %esi
+  80438a:	e8 89 c9 ff ff       	call   800d18 <sys_page_map>
+  80438f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804392:	83 c4 20             	add    $0x20,%esp
+  804395:	85 c0                	test   %eax,%eax
+  804397:	0f 89 a9 01 00 00    	jns    804546 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  80439d:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  8043a1:	74 5f                	je     804402 <page_map+0x94>
+		if (r != -E_INVAL)
+  8043a3:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  8043a7:	0f 85 a0 01 00 00    	jne    80454d <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8043ad:	85 f6                	test   %esi,%esi
+  8043af:	74 70                	je     804421 <page_map+0xb3>
+  8043b1:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  8043b6:	8b 40 48             	mov    0x48(%eax),%eax
+  8043b9:	39 f0                	cmp    %esi,%eax
+  8043bb:	74 64                	je     804421 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8043bd:	83 ec 0c             	sub    $0xc,%esp
+  8043c0:	6a 05                	push   $0x5
+  8043c2:	68 00 00 40 00       	push   $0x400000
+  8043c7:	6a 00                	push   $0x0
+  8043c9:	68 00 b0 ad de       	push   $0xdeadb000
+  8043ce:	56                   	push   %esi
+  8043cf:	e8 44 c9 ff ff       	call   800d18 <sys_page_map>
+  8043d4:	89 c3                	mov    %eax,%ebx
+  8043d6:	83 c4 20             	add    $0x20,%esp
+  8043d9:	85 c0                	test   %eax,%eax
+  8043db:	79 6a                	jns    804447 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  8043dd:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8043e0:	75 50                	jne    804432 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  8043e2:	83 ec 08             	sub    $0x8,%esp
+  8043e5:	68 00 00 40 00       	push   $0x400000
+  8043ea:	6a fc                	push   $0xfffffffc
+  8043ec:	e8 9c f6 ff ff       	call   803a8d <page_out>
+  8043f1:	83 c4 10             	add    $0x10,%esp
+  8043f4:	85 c0                	test   %eax,%eax
+  8043f6:	79 c5                	jns    8043bd <page_map+0x4f>
+}
+  8043f8:	89 d8                	mov    %ebx,%eax
+  8043fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043fd:	5b                   	pop    %ebx
+  8043fe:	5e                   	pop    %esi
+  8043ff:	5f                   	pop    %edi
+  804400:	5d                   	pop    %ebp
+  804401:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  804402:	83 ec 08             	sub    $0x8,%esp
+  804405:	68 00 00 40 00       	push   $0x400000
+  80440a:	6a 00                	push   $0x0
+  80440c:	e8 7c f6 ff ff       	call   803a8d <page_out>
+  804411:	83 c4 10             	add    $0x10,%esp
+  804414:	85 c0                	test   %eax,%eax
+  804416:	0f 89 5e ff ff ff    	jns    80437a <page_map+0xc>
+				return r;
+  80441c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80441f:	eb d7                	jmp    8043f8 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804421:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804424:	e8 79 f9 ff ff       	call   803da2 <page_adopt>
+  804429:	85 c0                	test   %eax,%eax
+  80442b:	79 90                	jns    8043bd <page_map+0x4f>
+			return r;
+  80442d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804430:	eb c6                	jmp    8043f8 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  804432:	53                   	push   %ebx
+  804433:	68 0c 5d 80 00       	push   $0x805d0c
+  804438:	68 77 03 00 00       	push   $0x377
+  80443d:	68 d2 58 80 00       	push   $0x8058d2
+  804442:	e8 f6 0a 00 00       	call   804f3d <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  804447:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80444a:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  80444d:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  804454:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  80445a:	0f 84 f5 00 00 00    	je     804555 <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  804460:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804466:	83 ec 0c             	sub    $0xc,%esp
+  804469:	6a 05                	push   $0x5
+  80446b:	68 00 00 40 00       	push   $0x400000
+  804470:	6a 00                	push   $0x0
+  804472:	57                   	push   %edi
+  804473:	56                   	push   %esi
+  804474:	e8 9f c8 ff ff       	call   800d18 <sys_page_map>
+  804479:	89 c3                	mov    %eax,%ebx
+  80447b:	83 c4 20             	add    $0x20,%esp
+  80447e:	85 c0                	test   %eax,%eax
+  804480:	79 35                	jns    8044b7 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  804482:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804485:	75 1b                	jne    8044a2 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  804487:	83 ec 08             	sub    $0x8,%esp
+  80448a:	68 00 00 40 00       	push   $0x400000
+  80448f:	6a 00                	push   $0x0
+  804491:	e8 f7 f5 ff ff       	call   803a8d <page_out>
+  804496:	83 c4 10             	add    $0x10,%esp
+  804499:	85 c0                	test   %eax,%eax
+  80449b:	79 c9                	jns    804466 <page_map+0xf8>
+  80449d:	e9 56 ff ff ff       	jmp    8043f8 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  8044a2:	53                   	push   %ebx
+  8044a3:	68 34 5d 80 00       	push   $0x805d34
+  8044a8:	68 83 03 00 00       	push   $0x383
+  8044ad:	68 d2 58 80 00       	push   $0x8058d2
+  8044b2:	e8 86 0a 00 00       	call   804f3d <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  8044b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8044ba:	c1 e8 0c             	shr    $0xc,%eax
+  8044bd:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8044c2:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  8044c9:	01 
+  8044ca:	0f 84 8d 00 00 00    	je     80455d <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  8044d0:	83 ec 08             	sub    $0x8,%esp
+  8044d3:	68 00 00 40 00       	push   $0x400000
+  8044d8:	6a 00                	push   $0x0
+  8044da:	e8 7b c8 ff ff       	call   800d5a <sys_page_unmap>
+  8044df:	83 c4 10             	add    $0x10,%esp
+  8044e2:	85 c0                	test   %eax,%eax
+  8044e4:	78 36                	js     80451c <page_map+0x1ae>
+  8044e6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  8044e9:	83 ec 08             	sub    $0x8,%esp
+  8044ec:	57                   	push   %edi
+  8044ed:	56                   	push   %esi
+  8044ee:	e8 4a fc ff ff       	call   80413d <page_in>
+  8044f3:	89 c3                	mov    %eax,%ebx
+  8044f5:	83 c4 10             	add    $0x10,%esp
+  8044f8:	85 c0                	test   %eax,%eax
+  8044fa:	0f 89 7a fe ff ff    	jns    80437a <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  804500:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804503:	75 2c                	jne    804531 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  804505:	83 ec 08             	sub    $0x8,%esp
+  804508:	57                   	push   %edi
+  804509:	6a 00                	push   $0x0
+  80450b:	e8 7d f5 ff ff       	call   803a8d <page_out>
+  804510:	83 c4 10             	add    $0x10,%esp
+  804513:	85 c0                	test   %eax,%eax
+  804515:	79 d2                	jns    8044e9 <page_map+0x17b>
+  804517:	e9 dc fe ff ff       	jmp    8043f8 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  80451c:	50                   	push   %eax
+  80451d:	68 60 5d 80 00       	push   $0x805d60
+  804522:	68 8b 03 00 00       	push   $0x38b
+  804527:	68 d2 58 80 00       	push   $0x8058d2
+  80452c:	e8 0c 0a 00 00       	call   804f3d <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  804531:	53                   	push   %ebx
+  804532:	68 88 5d 80 00       	push   $0x805d88
+  804537:	68 91 03 00 00       	push   $0x391
+  80453c:	68 d2 58 80 00       	push   $0x8058d2
+  804541:	e8 f7 09 00 00       	call   804f3d <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  804546:	89 c3                	mov    %eax,%ebx
+  804548:	e9 ab fe ff ff       	jmp    8043f8 <page_map+0x8a>
+  80454d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804550:	e9 a3 fe ff ff       	jmp    8043f8 <page_map+0x8a>
+			return r; // Pass through the error
+  804555:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804558:	e9 9b fe ff ff       	jmp    8043f8 <page_map+0x8a>
+			return r; // Pass through the error
+  80455d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804560:	e9 93 fe ff ff       	jmp    8043f8 <page_map+0x8a>
+
+00804565 <page_map_range>:
+{
+  804565:	55                   	push   %ebp
+  804566:	89 e5                	mov    %esp,%ebp
+  804568:	57                   	push   %edi
+  804569:	56                   	push   %esi
+  80456a:	53                   	push   %ebx
+  80456b:	83 ec 0c             	sub    $0xc,%esp
+  80456e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804571:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  804574:	83 ec 08             	sub    $0x8,%esp
+  804577:	ff 75 1c             	push   0x1c(%ebp)
+  80457a:	ff 75 18             	push   0x18(%ebp)
+  80457d:	56                   	push   %esi
+  80457e:	ff 75 10             	push   0x10(%ebp)
+  804581:	57                   	push   %edi
+  804582:	ff 75 08             	push   0x8(%ebp)
+  804585:	e8 99 c8 ff ff       	call   800e23 <sys_page_map_range>
+  80458a:	89 c3                	mov    %eax,%ebx
+  80458c:	83 c4 20             	add    $0x20,%esp
+  80458f:	85 c0                	test   %eax,%eax
+  804591:	79 1b                	jns    8045ae <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  804593:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804596:	75 20                	jne    8045b8 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  804598:	83 ec 08             	sub    $0x8,%esp
+  80459b:	68 00 00 40 00       	push   $0x400000
+  8045a0:	6a 00                	push   $0x0
+  8045a2:	e8 e6 f4 ff ff       	call   803a8d <page_out>
+  8045a7:	83 c4 10             	add    $0x10,%esp
+  8045aa:	85 c0                	test   %eax,%eax
+  8045ac:	79 c6                	jns    804574 <page_map_range+0xf>
+}
+  8045ae:	89 d8                	mov    %ebx,%eax
+  8045b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045b3:	5b                   	pop    %ebx
+  8045b4:	5e                   	pop    %esi
+  8045b5:	5f                   	pop    %edi
+  8045b6:	5d                   	pop    %ebp
+  8045b7:	c3                   	ret
+		if (r != -E_INVAL)
+  8045b8:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  8045bb:	75 f1                	jne    8045ae <page_map_range+0x49>
+  8045bd:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  8045bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8045c4:	eb 03                	jmp    8045c9 <page_map_range+0x64>
+  8045c6:	83 c6 01             	add    $0x1,%esi
+  8045c9:	3b 75 18             	cmp    0x18(%ebp),%esi
+  8045cc:	74 2a                	je     8045f8 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  8045ce:	83 ec 0c             	sub    $0xc,%esp
+  8045d1:	ff 75 1c             	push   0x1c(%ebp)
+  8045d4:	53                   	push   %ebx
+  8045d5:	ff 75 10             	push   0x10(%ebp)
+  8045d8:	57                   	push   %edi
+  8045d9:	ff 75 08             	push   0x8(%ebp)
+  8045dc:	e8 8d fd ff ff       	call   80436e <page_map>
+  8045e1:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8045e7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8045ed:	83 c4 20             	add    $0x20,%esp
+  8045f0:	85 c0                	test   %eax,%eax
+  8045f2:	79 d2                	jns    8045c6 <page_map_range+0x61>
+  8045f4:	89 c3                	mov    %eax,%ebx
+  8045f6:	eb b6                	jmp    8045ae <page_map_range+0x49>
+		return 0;
+  8045f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8045fd:	eb af                	jmp    8045ae <page_map_range+0x49>
+
+008045ff <paging_pgfault_handler>:
+{
+  8045ff:	55                   	push   %ebp
+  804600:	89 e5                	mov    %esp,%ebp
+  804602:	56                   	push   %esi
+  804603:	53                   	push   %ebx
+  804604:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  804607:	e8 6f e7 ff ff       	call   802d7b <find_paging_env>
+	if (pagingenv == 0)
+  80460c:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  804611:	85 c0                	test   %eax,%eax
+  804613:	74 3c                	je     804651 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  804615:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804617:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80461b:	75 12                	jne    80462f <paging_pgfault_handler+0x30>
+  80461d:	89 f0                	mov    %esi,%eax
+  80461f:	e8 7e f7 ff ff       	call   803da2 <page_adopt>
+  804624:	89 c2                	mov    %eax,%edx
+		return 0;
+  804626:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  80462b:	85 d2                	test   %edx,%edx
+  80462d:	78 22                	js     804651 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  80462f:	83 ec 08             	sub    $0x8,%esp
+  804632:	6a 00                	push   $0x0
+  804634:	56                   	push   %esi
+  804635:	e8 a9 f3 ff ff       	call   8039e3 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  80463a:	83 c4 10             	add    $0x10,%esp
+  80463d:	85 c0                	test   %eax,%eax
+  80463f:	74 05                	je     804646 <paging_pgfault_handler+0x47>
+  804641:	f6 00 01             	testb  $0x1,(%eax)
+  804644:	75 12                	jne    804658 <paging_pgfault_handler+0x59>
+	return 0;
+  804646:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  80464b:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80464f:	74 23                	je     804674 <paging_pgfault_handler+0x75>
+}
+  804651:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804654:	5b                   	pop    %ebx
+  804655:	5e                   	pop    %esi
+  804656:	5d                   	pop    %ebp
+  804657:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  804658:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  80465d:	8b 40 48             	mov    0x48(%eax),%eax
+  804660:	83 ec 08             	sub    $0x8,%esp
+  804663:	56                   	push   %esi
+  804664:	50                   	push   %eax
+  804665:	e8 d3 fa ff ff       	call   80413d <page_in>
+  80466a:	f7 d0                	not    %eax
+  80466c:	c1 e8 1f             	shr    $0x1f,%eax
+  80466f:	83 c4 10             	add    $0x10,%esp
+  804672:	eb dd                	jmp    804651 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804674:	89 f0                	mov    %esi,%eax
+  804676:	e8 97 e2 ff ff       	call   802912 <segment_lookup>
+  80467b:	89 c2                	mov    %eax,%edx
+	return 0;
+  80467d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804682:	85 d2                	test   %edx,%edx
+  804684:	74 cb                	je     804651 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  804686:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  80468b:	8b 40 48             	mov    0x48(%eax),%eax
+  80468e:	83 ec 08             	sub    $0x8,%esp
+  804691:	56                   	push   %esi
+  804692:	50                   	push   %eax
+  804693:	e8 f5 f3 ff ff       	call   803a8d <page_out>
+  804698:	f7 d0                	not    %eax
+  80469a:	c1 e8 1f             	shr    $0x1f,%eax
+  80469d:	83 c4 10             	add    $0x10,%esp
+  8046a0:	eb af                	jmp    804651 <paging_pgfault_handler+0x52>
+
+008046a2 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  8046a2:	55                   	push   %ebp
+  8046a3:	89 e5                	mov    %esp,%ebp
+  8046a5:	57                   	push   %edi
+  8046a6:	56                   	push   %esi
+  8046a7:	53                   	push   %ebx
+  8046a8:	83 ec 2c             	sub    $0x2c,%esp
+  8046ab:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8046ae:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  8046b3:	89 c1                	mov    %eax,%ecx
+  8046b5:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  8046b8:	c1 e8 11             	shr    $0x11,%eax
+  8046bb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8046be:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  8046c5:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  8046c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8046cd:	d3 e0                	shl    %cl,%eax
+  8046cf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8046d2:	85 c7                	test   %eax,%edi
+  8046d4:	74 12                	je     8046e8 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  8046d6:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8046db:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  8046de:	bf 01 00 00 00       	mov    $0x1,%edi
+  8046e3:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8046e6:	eb 17                	jmp    8046ff <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  8046e8:	ff 75 e0             	push   -0x20(%ebp)
+  8046eb:	68 c0 5d 80 00       	push   $0x805dc0
+  8046f0:	6a 48                	push   $0x48
+  8046f2:	68 da 5d 80 00       	push   $0x805dda
+  8046f7:	e8 41 08 00 00       	call   804f3d <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  8046fc:	83 c3 01             	add    $0x1,%ebx
+  8046ff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804702:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  804705:	89 c8                	mov    %ecx,%eax
+  804707:	c1 e8 05             	shr    $0x5,%eax
+  80470a:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  804711:	89 fe                	mov    %edi,%esi
+  804713:	d3 e6                	shl    %cl,%esi
+  804715:	89 f1                	mov    %esi,%ecx
+  804717:	85 d6                	test   %edx,%esi
+  804719:	74 e1                	je     8046fc <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  80471b:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  80471e:	f7 d6                	not    %esi
+  804720:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804723:	21 fe                	and    %edi,%esi
+  804725:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804728:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  80472f:	f7 d1                	not    %ecx
+  804731:	21 d1                	and    %edx,%ecx
+  804733:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  80473a:	83 ec 04             	sub    $0x4,%esp
+  80473d:	53                   	push   %ebx
+  80473e:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804741:	57                   	push   %edi
+  804742:	6a 00                	push   $0x0
+  804744:	e8 97 f8 ff ff       	call   803fe0 <page_unmap_range>
+	va_free(va, n);
+  804749:	83 c4 08             	add    $0x8,%esp
+  80474c:	53                   	push   %ebx
+  80474d:	57                   	push   %edi
+  80474e:	e8 ed 05 00 00       	call   804d40 <va_free>
+}
+  804753:	83 c4 10             	add    $0x10,%esp
+  804756:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804759:	5b                   	pop    %ebx
+  80475a:	5e                   	pop    %esi
+  80475b:	5f                   	pop    %edi
+  80475c:	5d                   	pop    %ebp
+  80475d:	c3                   	ret
+
+0080475e <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  80475e:	55                   	push   %ebp
+  80475f:	89 e5                	mov    %esp,%ebp
+  804761:	57                   	push   %edi
+  804762:	56                   	push   %esi
+  804763:	53                   	push   %ebx
+  804764:	83 ec 1c             	sub    $0x1c,%esp
+  804767:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  80476a:	85 db                	test   %ebx,%ebx
+  80476c:	74 34                	je     8047a2 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  80476e:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  804774:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  804779:	77 2f                	ja     8047aa <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  80477b:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  804781:	75 51                	jne    8047d4 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  804783:	89 c1                	mov    %eax,%ecx
+  804785:	c1 e9 0c             	shr    $0xc,%ecx
+  804788:	ba 01 00 00 00       	mov    $0x1,%edx
+  80478d:	d3 e2                	shl    %cl,%edx
+  80478f:	c1 e8 11             	shr    $0x11,%eax
+  804792:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  804799:	75 24                	jne    8047bf <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  80479b:	89 d8                	mov    %ebx,%eax
+  80479d:	e8 00 ff ff ff       	call   8046a2 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  8047a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8047a5:	5b                   	pop    %ebx
+  8047a6:	5e                   	pop    %esi
+  8047a7:	5f                   	pop    %edi
+  8047a8:	5d                   	pop    %ebp
+  8047a9:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  8047aa:	53                   	push   %ebx
+  8047ab:	68 e7 5d 80 00       	push   $0x805de7
+  8047b0:	68 a2 00 00 00       	push   $0xa2
+  8047b5:	68 da 5d 80 00       	push   $0x805dda
+  8047ba:	e8 7e 07 00 00       	call   804f3d <_panic>
+			panic("free: %p is not allocated", va);
+  8047bf:	53                   	push   %ebx
+  8047c0:	68 c0 5d 80 00       	push   $0x805dc0
+  8047c5:	68 a5 00 00 00       	push   $0xa5
+  8047ca:	68 da 5d 80 00       	push   $0x805dda
+  8047cf:	e8 69 07 00 00       	call   804f3d <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  8047d4:	89 de                	mov    %ebx,%esi
+  8047d6:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  8047dc:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  8047e2:	89 c8                	mov    %ecx,%eax
+  8047e4:	c1 e8 11             	shr    $0x11,%eax
+  8047e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8047ea:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  8047f1:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8047f4:	c1 e9 0c             	shr    $0xc,%ecx
+  8047f7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8047fc:	d3 e0                	shl    %cl,%eax
+  8047fe:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804801:	85 c7                	test   %eax,%edi
+  804803:	74 1b                	je     804820 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  804805:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804809:	89 d8                	mov    %ebx,%eax
+  80480b:	29 f0                	sub    %esi,%eax
+  80480d:	83 e8 10             	sub    $0x10,%eax
+  804810:	99                   	cltd
+  804811:	f7 ff                	idiv   %edi
+  804813:	89 d1                	mov    %edx,%ecx
+  804815:	85 d2                	test   %edx,%edx
+  804817:	75 07                	jne    804820 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804819:	ba 10 00 00 00       	mov    $0x10,%edx
+  80481e:	eb 18                	jmp    804838 <free+0xda>
+		panic("free: %p is not allocated", va);
+  804820:	53                   	push   %ebx
+  804821:	68 c0 5d 80 00       	push   $0x805dc0
+  804826:	68 ad 00 00 00       	push   $0xad
+  80482b:	68 da 5d 80 00       	push   $0x805dda
+  804830:	e8 08 07 00 00       	call   804f3d <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804835:	83 c1 01             	add    $0x1,%ecx
+  804838:	89 d0                	mov    %edx,%eax
+  80483a:	d3 e0                	shl    %cl,%eax
+  80483c:	39 c7                	cmp    %eax,%edi
+  80483e:	7f f5                	jg     804835 <free+0xd7>
+	*(void **) va = s->free;
+  804840:	8b 46 08             	mov    0x8(%esi),%eax
+  804843:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  804845:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  804848:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  80484c:	8d 58 01             	lea    0x1(%eax),%ebx
+  80484f:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  804853:	66 85 c0             	test   %ax,%ax
+  804856:	74 52                	je     8048aa <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804858:	0f b7 db             	movzwl %bx,%ebx
+  80485b:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  80485f:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804864:	ba 00 00 00 00       	mov    $0x0,%edx
+  804869:	f7 ff                	idiv   %edi
+  80486b:	39 c3                	cmp    %eax,%ebx
+  80486d:	0f 85 2f ff ff ff    	jne    8047a2 <free+0x44>
+  804873:	8b 46 04             	mov    0x4(%esi),%eax
+  804876:	85 c0                	test   %eax,%eax
+  804878:	74 53                	je     8048cd <free+0x16f>
+		s->prev->next = s->next;
+  80487a:	8b 16                	mov    (%esi),%edx
+  80487c:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  80487e:	8b 06                	mov    (%esi),%eax
+  804880:	85 c0                	test   %eax,%eax
+  804882:	74 06                	je     80488a <free+0x12c>
+		s->next->prev = s->prev;
+  804884:	8b 56 04             	mov    0x4(%esi),%edx
+  804887:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  80488a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80488d:	f7 d0                	not    %eax
+  80488f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804892:	21 d0                	and    %edx,%eax
+  804894:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  804897:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  80489e:	89 f0                	mov    %esi,%eax
+  8048a0:	e8 fd fd ff ff       	call   8046a2 <heap_free_pages>
+  8048a5:	e9 f8 fe ff ff       	jmp    8047a2 <free+0x44>
+	s->prev = NULL;
+  8048aa:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  8048b1:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  8048b8:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  8048ba:	85 c0                	test   %eax,%eax
+  8048bc:	74 03                	je     8048c1 <free+0x163>
+		slabs[c]->prev = s;
+  8048be:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  8048c1:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  8048c8:	e9 d5 fe ff ff       	jmp    8047a2 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8048cd:	8b 06                	mov    (%esi),%eax
+  8048cf:	85 c0                	test   %eax,%eax
+  8048d1:	0f 84 cb fe ff ff    	je     8047a2 <free+0x44>
+		slabs[c] = s->next;
+  8048d7:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  8048de:	8b 06                	mov    (%esi),%eax
+  8048e0:	eb a2                	jmp    804884 <free+0x126>
+
+008048e2 <heap_alloc_pages>:
+{
+  8048e2:	55                   	push   %ebp
+  8048e3:	89 e5                	mov    %esp,%ebp
+  8048e5:	57                   	push   %edi
+  8048e6:	56                   	push   %esi
+  8048e7:	53                   	push   %ebx
+  8048e8:	83 ec 18             	sub    $0x18,%esp
+  8048eb:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  8048ed:	50                   	push   %eax
+  8048ee:	e8 15 03 00 00       	call   804c08 <va_alloc>
+  8048f3:	89 c3                	mov    %eax,%ebx
+  8048f5:	83 c4 10             	add    $0x10,%esp
+  8048f8:	85 c0                	test   %eax,%eax
+  8048fa:	74 47                	je     804943 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8048fc:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804902:	89 c1                	mov    %eax,%ecx
+  804904:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  804907:	c1 e8 11             	shr    $0x11,%eax
+  80490a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80490f:	89 d7                	mov    %edx,%edi
+  804911:	d3 e7                	shl    %cl,%edi
+  804913:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  80491a:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  80491e:	89 c8                	mov    %ecx,%eax
+  804920:	c1 e8 05             	shr    $0x5,%eax
+  804923:	d3 e2                	shl    %cl,%edx
+  804925:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  80492c:	83 ec 0c             	sub    $0xc,%esp
+  80492f:	6a 00                	push   $0x0
+  804931:	6a 07                	push   $0x7
+  804933:	56                   	push   %esi
+  804934:	53                   	push   %ebx
+  804935:	6a 00                	push   $0x0
+  804937:	e8 3a f7 ff ff       	call   804076 <page_alloc_range>
+  80493c:	83 c4 20             	add    $0x20,%esp
+  80493f:	85 c0                	test   %eax,%eax
+  804941:	78 0a                	js     80494d <heap_alloc_pages+0x6b>
+}
+  804943:	89 d8                	mov    %ebx,%eax
+  804945:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804948:	5b                   	pop    %ebx
+  804949:	5e                   	pop    %esi
+  80494a:	5f                   	pop    %edi
+  80494b:	5d                   	pop    %ebp
+  80494c:	c3                   	ret
+		free(va);
+  80494d:	83 ec 0c             	sub    $0xc,%esp
+  804950:	53                   	push   %ebx
+  804951:	e8 08 fe ff ff       	call   80475e <free>
+		return NULL;
+  804956:	83 c4 10             	add    $0x10,%esp
+  804959:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80495e:	eb e3                	jmp    804943 <heap_alloc_pages+0x61>
+
+00804960 <malloc>:
+{
+  804960:	55                   	push   %ebp
+  804961:	89 e5                	mov    %esp,%ebp
+  804963:	57                   	push   %edi
+  804964:	56                   	push   %esi
+  804965:	53                   	push   %ebx
+  804966:	83 ec 1c             	sub    $0x1c,%esp
+  804969:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  80496c:	8d 50 ff             	lea    -0x1(%eax),%edx
+  80496f:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  804975:	0f 87 21 01 00 00    	ja     804a9c <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  80497b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804980:	ba 10 00 00 00       	mov    $0x10,%edx
+  804985:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  804987:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80498c:	76 15                	jbe    8049a3 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  80498e:	05 ff 0f 00 00       	add    $0xfff,%eax
+  804993:	c1 e8 0c             	shr    $0xc,%eax
+  804996:	e8 47 ff ff ff       	call   8048e2 <heap_alloc_pages>
+  80499b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80499e:	eb 37                	jmp    8049d7 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8049a0:	83 c1 01             	add    $0x1,%ecx
+  8049a3:	89 d6                	mov    %edx,%esi
+  8049a5:	d3 e6                	shl    %cl,%esi
+  8049a7:	39 c6                	cmp    %eax,%esi
+  8049a9:	72 f5                	jb     8049a0 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  8049ab:	89 cb                	mov    %ecx,%ebx
+  8049ad:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  8049b4:	85 ff                	test   %edi,%edi
+  8049b6:	74 2a                	je     8049e2 <malloc+0x82>
+	v = s->free;
+  8049b8:	8b 47 08             	mov    0x8(%edi),%eax
+  8049bb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  8049be:	8b 00                	mov    (%eax),%eax
+  8049c0:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  8049c3:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  8049c7:	83 e8 01             	sub    $0x1,%eax
+  8049ca:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  8049ce:	66 85 c0             	test   %ax,%ax
+  8049d1:	0f 84 9a 00 00 00    	je     804a71 <malloc+0x111>
+}
+  8049d7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8049da:	83 c4 1c             	add    $0x1c,%esp
+  8049dd:	5b                   	pop    %ebx
+  8049de:	5e                   	pop    %esi
+  8049df:	5f                   	pop    %edi
+  8049e0:	5d                   	pop    %ebp
+  8049e1:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  8049e2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8049e7:	e8 f6 fe ff ff       	call   8048e2 <heap_alloc_pages>
+  8049ec:	89 c1                	mov    %eax,%ecx
+  8049ee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8049f1:	85 c0                	test   %eax,%eax
+  8049f3:	74 e2                	je     8049d7 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8049f5:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  8049fb:	89 c8                	mov    %ecx,%eax
+  8049fd:	c1 e8 11             	shr    $0x11,%eax
+  804a00:	c1 e9 0c             	shr    $0xc,%ecx
+  804a03:	ba 01 00 00 00       	mov    $0x1,%edx
+  804a08:	d3 e2                	shl    %cl,%edx
+  804a0a:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804a11:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804a14:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  804a18:	0f b7 f6             	movzwl %si,%esi
+  804a1b:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804a20:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a25:	f7 fe                	idiv   %esi
+  804a27:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804a2b:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  804a2e:	85 c0                	test   %eax,%eax
+  804a30:	74 14                	je     804a46 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  804a32:	83 e8 01             	sub    $0x1,%eax
+  804a35:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804a39:	0f af d0             	imul   %eax,%edx
+  804a3c:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804a40:	89 3a                	mov    %edi,(%edx)
+  804a42:	89 d7                	mov    %edx,%edi
+  804a44:	eb e5                	jmp    804a2b <malloc+0xcb>
+	s->prev = NULL;
+  804a46:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804a49:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804a50:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  804a57:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804a59:	85 c0                	test   %eax,%eax
+  804a5b:	74 03                	je     804a60 <malloc+0x100>
+		slabs[c]->prev = s;
+  804a5d:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804a60:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804a63:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  804a6a:	89 c7                	mov    %eax,%edi
+  804a6c:	e9 47 ff ff ff       	jmp    8049b8 <malloc+0x58>
+	if (s->prev)
+  804a71:	8b 47 04             	mov    0x4(%edi),%eax
+  804a74:	85 c0                	test   %eax,%eax
+  804a76:	74 19                	je     804a91 <malloc+0x131>
+		s->prev->next = s->next;
+  804a78:	8b 17                	mov    (%edi),%edx
+  804a7a:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804a7c:	8b 07                	mov    (%edi),%eax
+  804a7e:	85 c0                	test   %eax,%eax
+  804a80:	0f 84 51 ff ff ff    	je     8049d7 <malloc+0x77>
+		s->next->prev = s->prev;
+  804a86:	8b 57 04             	mov    0x4(%edi),%edx
+  804a89:	89 50 04             	mov    %edx,0x4(%eax)
+  804a8c:	e9 46 ff ff ff       	jmp    8049d7 <malloc+0x77>
+		slabs[c] = s->next;
+  804a91:	8b 07                	mov    (%edi),%eax
+  804a93:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  804a9a:	eb e0                	jmp    804a7c <malloc+0x11c>
+		return NULL;
+  804a9c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804aa3:	e9 2f ff ff ff       	jmp    8049d7 <malloc+0x77>
+
+00804aa8 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804aa8:	55                   	push   %ebp
+  804aa9:	89 e5                	mov    %esp,%ebp
+  804aab:	57                   	push   %edi
+  804aac:	56                   	push   %esi
+  804aad:	53                   	push   %ebx
+  804aae:	83 ec 0c             	sub    $0xc,%esp
+  804ab1:	89 c6                	mov    %eax,%esi
+  804ab3:	89 d7                	mov    %edx,%edi
+  804ab5:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804ab8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804abd:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  804ac7:	83 ef 01             	sub    $0x1,%edi
+  804aca:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804acd:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  804ad0:	eb 34                	jmp    804b06 <va_chunk_scan+0x5e>
+			i += 31;
+  804ad2:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  804ad5:	89 ca                	mov    %ecx,%edx
+			continue;
+  804ad7:	eb 23                	jmp    804afc <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804ad9:	89 c7                	mov    %eax,%edi
+  804adb:	c1 ef 05             	shr    $0x5,%edi
+  804ade:	be 01 00 00 00       	mov    $0x1,%esi
+  804ae3:	d3 e6                	shl    %cl,%esi
+  804ae5:	89 f1                	mov    %esi,%ecx
+  804ae7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804aea:	23 0c be             	and    (%esi,%edi,4),%ecx
+  804aed:	75 41                	jne    804b30 <va_chunk_scan+0x88>
+			len++;
+  804aef:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804af2:	39 d3                	cmp    %edx,%ebx
+  804af4:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  804af7:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  804afa:	72 2d                	jb     804b29 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804afc:	83 c0 01             	add    $0x1,%eax
+  804aff:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804b04:	77 31                	ja     804b37 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  804b06:	89 c1                	mov    %eax,%ecx
+  804b08:	83 e1 1f             	and    $0x1f,%ecx
+  804b0b:	75 cc                	jne    804ad9 <va_chunk_scan+0x31>
+  804b0d:	89 c7                	mov    %eax,%edi
+  804b0f:	c1 ef 05             	shr    $0x5,%edi
+  804b12:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804b15:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804b18:	83 ff ff             	cmp    $0xffffffff,%edi
+  804b1b:	74 b5                	je     804ad2 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  804b1d:	85 ff                	test   %edi,%edi
+  804b1f:	75 b8                	jne    804ad9 <va_chunk_scan+0x31>
+			i += 31;
+  804b21:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804b24:	83 c2 20             	add    $0x20,%edx
+  804b27:	eb c9                	jmp    804af2 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804b29:	83 c0 01             	add    $0x1,%eax
+  804b2c:	29 d0                	sub    %edx,%eax
+  804b2e:	eb 15                	jmp    804b45 <va_chunk_scan+0x9d>
+			len = 0;
+  804b30:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b35:	eb c5                	jmp    804afc <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804b37:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804b3c:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804b3f:	85 d2                	test   %edx,%edx
+  804b41:	74 02                	je     804b45 <va_chunk_scan+0x9d>
+		*run_store = best;
+  804b43:	89 1a                	mov    %ebx,(%edx)
+}
+  804b45:	83 c4 0c             	add    $0xc,%esp
+  804b48:	5b                   	pop    %ebx
+  804b49:	5e                   	pop    %esi
+  804b4a:	5f                   	pop    %edi
+  804b4b:	5d                   	pop    %ebp
+  804b4c:	c3                   	ret
+
+00804b4d <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804b4d:	55                   	push   %ebp
+  804b4e:	89 e5                	mov    %esp,%ebp
+  804b50:	57                   	push   %edi
+  804b51:	56                   	push   %esi
+  804b52:	53                   	push   %ebx
+  804b53:	83 ec 14             	sub    $0x14,%esp
+  804b56:	89 c3                	mov    %eax,%ebx
+  804b58:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804b5a:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804b60:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  804b66:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804b69:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804b6c:	89 d6                	mov    %edx,%esi
+  804b6e:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  804b74:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804b76:	eb 34                	jmp    804bac <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804b78:	89 c8                	mov    %ecx,%eax
+  804b7a:	c1 e8 05             	shr    $0x5,%eax
+  804b7d:	89 da                	mov    %ebx,%edx
+  804b7f:	c1 e2 05             	shl    $0x5,%edx
+  804b82:	01 da                	add    %ebx,%edx
+  804b84:	01 c2                	add    %eax,%edx
+  804b86:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804b8b:	d3 c0                	rol    %cl,%eax
+  804b8d:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804b94:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804b9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  804ba0:	01 d0                	add    %edx,%eax
+  804ba2:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804ba9:	83 c1 01             	add    $0x1,%ecx
+  804bac:	39 f9                	cmp    %edi,%ecx
+  804bae:	74 30                	je     804be0 <va_chunk_mark+0x93>
+		if (alloc)
+  804bb0:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804bb4:	74 c2                	je     804b78 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804bb6:	89 c8                	mov    %ecx,%eax
+  804bb8:	c1 e8 05             	shr    $0x5,%eax
+  804bbb:	89 da                	mov    %ebx,%edx
+  804bbd:	c1 e2 05             	shl    $0x5,%edx
+  804bc0:	01 da                	add    %ebx,%edx
+  804bc2:	01 c2                	add    %eax,%edx
+  804bc4:	b8 01 00 00 00       	mov    $0x1,%eax
+  804bc9:	d3 e0                	shl    %cl,%eax
+  804bcb:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804bd2:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804bd9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804bde:	eb c0                	jmp    804ba0 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804be0:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804be3:	ba 00 00 00 00       	mov    $0x0,%edx
+  804be8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804beb:	e8 b8 fe ff ff       	call   804aa8 <va_chunk_scan>
+	ch->run = run;
+  804bf0:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804bf6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804bf9:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  804c00:	83 c4 14             	add    $0x14,%esp
+  804c03:	5b                   	pop    %ebx
+  804c04:	5e                   	pop    %esi
+  804c05:	5f                   	pop    %edi
+  804c06:	5d                   	pop    %ebp
+  804c07:	c3                   	ret
+
+00804c08 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804c08:	55                   	push   %ebp
+  804c09:	89 e5                	mov    %esp,%ebp
+  804c0b:	57                   	push   %edi
+  804c0c:	56                   	push   %esi
+  804c0d:	53                   	push   %ebx
+  804c0e:	83 ec 04             	sub    $0x4,%esp
+  804c11:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804c14:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  804c19:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  804c1e:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  804c25:	74 4f                	je     804c76 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804c27:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804c2a:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804c2f:	0f 87 01 01 00 00    	ja     804d36 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804c35:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804c3b:	0f 87 80 00 00 00    	ja     804cc1 <va_alloc+0xb9>
+  804c41:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804c46:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804c4b:	0f b7 10             	movzwl (%eax),%edx
+  804c4e:	05 84 00 00 00       	add    $0x84,%eax
+  804c53:	39 da                	cmp    %ebx,%edx
+  804c55:	73 2c                	jae    804c83 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804c57:	83 c6 01             	add    $0x1,%esi
+  804c5a:	83 fe 1c             	cmp    $0x1c,%esi
+  804c5d:	75 ec                	jne    804c4b <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c64:	eb 53                	jmp    804cb9 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804c66:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804c6c:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804c71:	05 84 00 00 00       	add    $0x84,%eax
+  804c76:	39 d0                	cmp    %edx,%eax
+  804c78:	75 ec                	jne    804c66 <va_alloc+0x5e>
+	va_inited = 1;
+  804c7a:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  804c81:	eb a4                	jmp    804c27 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804c83:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804c89:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  804c8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804c93:	89 da                	mov    %ebx,%edx
+  804c95:	e8 0e fe ff ff       	call   804aa8 <va_chunk_scan>
+  804c9a:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804c9c:	6a 01                	push   $0x1
+  804c9e:	89 d9                	mov    %ebx,%ecx
+  804ca0:	89 c2                	mov    %eax,%edx
+  804ca2:	89 f0                	mov    %esi,%eax
+  804ca4:	e8 a4 fe ff ff       	call   804b4d <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804ca9:	c1 e6 16             	shl    $0x16,%esi
+  804cac:	c1 e7 0c             	shl    $0xc,%edi
+  804caf:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804cb6:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804cb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804cbc:	5b                   	pop    %ebx
+  804cbd:	5e                   	pop    %esi
+  804cbe:	5f                   	pop    %edi
+  804cbf:	5d                   	pop    %ebp
+  804cc0:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804cc1:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804cc7:	c1 ee 0a             	shr    $0xa,%esi
+  804cca:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cd4:	eb 0a                	jmp    804ce0 <va_alloc+0xd8>
+			first = c + 1;
+  804cd6:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804cd8:	83 c2 01             	add    $0x1,%edx
+  804cdb:	83 fa 1d             	cmp    $0x1d,%edx
+  804cde:	74 4f                	je     804d2f <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804ce0:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804ce6:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  804ced:	00 04 
+  804cef:	75 e5                	jne    804cd6 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804cf1:	89 d1                	mov    %edx,%ecx
+  804cf3:	29 c1                	sub    %eax,%ecx
+  804cf5:	39 f1                	cmp    %esi,%ecx
+  804cf7:	75 df                	jne    804cd8 <va_alloc+0xd0>
+  804cf9:	89 c7                	mov    %eax,%edi
+  804cfb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804cfe:	be 00 04 00 00       	mov    $0x400,%esi
+  804d03:	39 f3                	cmp    %esi,%ebx
+  804d05:	0f 46 f3             	cmovbe %ebx,%esi
+  804d08:	6a 01                	push   $0x1
+  804d0a:	89 f1                	mov    %esi,%ecx
+  804d0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d11:	89 f8                	mov    %edi,%eax
+  804d13:	e8 35 fe ff ff       	call   804b4d <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804d18:	83 c7 01             	add    $0x1,%edi
+  804d1b:	83 c4 04             	add    $0x4,%esp
+  804d1e:	29 f3                	sub    %esi,%ebx
+  804d20:	75 dc                	jne    804cfe <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804d22:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804d25:	c1 e0 16             	shl    $0x16,%eax
+  804d28:	05 00 00 00 08       	add    $0x8000000,%eax
+  804d2d:	eb 8a                	jmp    804cb9 <va_alloc+0xb1>
+	return NULL;
+  804d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d34:	eb 83                	jmp    804cb9 <va_alloc+0xb1>
+		return NULL;
+  804d36:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d3b:	e9 79 ff ff ff       	jmp    804cb9 <va_alloc+0xb1>
+
+00804d40 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804d40:	55                   	push   %ebp
+  804d41:	89 e5                	mov    %esp,%ebp
+  804d43:	57                   	push   %edi
+  804d44:	56                   	push   %esi
+  804d45:	53                   	push   %ebx
+  804d46:	83 ec 0c             	sub    $0xc,%esp
+  804d49:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804d4c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804d4f:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804d55:	76 21                	jbe    804d78 <va_free+0x38>
+  804d57:	89 f0                	mov    %esi,%eax
+  804d59:	c1 e0 0c             	shl    $0xc,%eax
+  804d5c:	01 f8                	add    %edi,%eax
+  804d5e:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804d63:	77 13                	ja     804d78 <va_free+0x38>
+	    || PGOFF(va))
+  804d65:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804d6b:	75 0b                	jne    804d78 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804d6d:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804d73:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804d76:	eb 45                	jmp    804dbd <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804d78:	83 ec 0c             	sub    $0xc,%esp
+  804d7b:	56                   	push   %esi
+  804d7c:	57                   	push   %edi
+  804d7d:	68 04 5e 80 00       	push   $0x805e04
+  804d82:	68 8e 00 00 00       	push   $0x8e
+  804d87:	68 24 5e 80 00       	push   $0x805e24
+  804d8c:	e8 ac 01 00 00       	call   804f3d <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804d91:	89 fa                	mov    %edi,%edx
+  804d93:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804d99:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804d9e:	29 d3                	sub    %edx,%ebx
+  804da0:	39 f3                	cmp    %esi,%ebx
+  804da2:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804da5:	89 f8                	mov    %edi,%eax
+  804da7:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804daa:	83 ec 0c             	sub    $0xc,%esp
+  804dad:	6a 00                	push   $0x0
+  804daf:	89 d9                	mov    %ebx,%ecx
+  804db1:	e8 97 fd ff ff       	call   804b4d <va_chunk_mark>
+		i += n;
+  804db6:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804db8:	29 de                	sub    %ebx,%esi
+  804dba:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804dbd:	85 f6                	test   %esi,%esi
+  804dbf:	75 d0                	jne    804d91 <va_free+0x51>
+	}
+}
+  804dc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804dc4:	5b                   	pop    %ebx
+  804dc5:	5e                   	pop    %esi
+  804dc6:	5f                   	pop    %edi
+  804dc7:	5d                   	pop    %ebp
+  804dc8:	c3                   	ret
+
+00804dc9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804dc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dce:	c3                   	ret
+
+00804dcf <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804dcf:	55                   	push   %ebp
+  804dd0:	89 e5                	mov    %esp,%ebp
+  804dd2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804dd5:	68 31 5e 80 00       	push   $0x805e31
+  804dda:	ff 75 0c             	push   0xc(%ebp)
+  804ddd:	e8 00 ba ff ff       	call   8007e2 <strcpy>
+	return 0;
+}
+  804de2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804de7:	c9                   	leave
+  804de8:	c3                   	ret
+
+00804de9 <devcons_write>:
+{
+  804de9:	55                   	push   %ebp
+  804dea:	89 e5                	mov    %esp,%ebp
+  804dec:	57                   	push   %edi
+  804ded:	56                   	push   %esi
+  804dee:	53                   	push   %ebx
+  804def:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804df5:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804dfa:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804e00:	eb 2e                	jmp    804e30 <devcons_write+0x47>
+		m = n - tot;
+  804e02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804e05:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804e07:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804e0c:	39 c3                	cmp    %eax,%ebx
+  804e0e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804e11:	83 ec 04             	sub    $0x4,%esp
+  804e14:	53                   	push   %ebx
+  804e15:	89 f0                	mov    %esi,%eax
+  804e17:	03 45 0c             	add    0xc(%ebp),%eax
+  804e1a:	50                   	push   %eax
+  804e1b:	57                   	push   %edi
+  804e1c:	e8 47 bb ff ff       	call   800968 <memmove>
+		sys_cputs(buf, m);
+  804e21:	83 c4 08             	add    $0x8,%esp
+  804e24:	53                   	push   %ebx
+  804e25:	57                   	push   %edi
+  804e26:	e8 dd bd ff ff       	call   800c08 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804e2b:	01 de                	add    %ebx,%esi
+  804e2d:	83 c4 10             	add    $0x10,%esp
+  804e30:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804e33:	72 cd                	jb     804e02 <devcons_write+0x19>
+}
+  804e35:	89 f0                	mov    %esi,%eax
+  804e37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804e3a:	5b                   	pop    %ebx
+  804e3b:	5e                   	pop    %esi
+  804e3c:	5f                   	pop    %edi
+  804e3d:	5d                   	pop    %ebp
+  804e3e:	c3                   	ret
+
+00804e3f <devcons_read>:
+{
+  804e3f:	55                   	push   %ebp
+  804e40:	89 e5                	mov    %esp,%ebp
+  804e42:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804e45:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e4a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804e4e:	75 07                	jne    804e57 <devcons_read+0x18>
+  804e50:	eb 1f                	jmp    804e71 <devcons_read+0x32>
+		sys_yield();
+  804e52:	e8 5f be ff ff       	call   800cb6 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804e57:	e8 db bd ff ff       	call   800c37 <sys_cgetc>
+  804e5c:	85 c0                	test   %eax,%eax
+  804e5e:	74 f2                	je     804e52 <devcons_read+0x13>
+	if (c < 0)
+  804e60:	78 0f                	js     804e71 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804e62:	83 f8 04             	cmp    $0x4,%eax
+  804e65:	74 0c                	je     804e73 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804e67:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804e6a:	88 02                	mov    %al,(%edx)
+	return 1;
+  804e6c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804e71:	c9                   	leave
+  804e72:	c3                   	ret
+		return 0;
+  804e73:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e78:	eb f7                	jmp    804e71 <devcons_read+0x32>
+
+00804e7a <cputchar>:
+{
+  804e7a:	55                   	push   %ebp
+  804e7b:	89 e5                	mov    %esp,%ebp
+  804e7d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804e80:	8b 45 08             	mov    0x8(%ebp),%eax
+  804e83:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804e86:	6a 01                	push   $0x1
+  804e88:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804e8b:	50                   	push   %eax
+  804e8c:	e8 77 bd ff ff       	call   800c08 <sys_cputs>
+}
+  804e91:	83 c4 10             	add    $0x10,%esp
+  804e94:	c9                   	leave
+  804e95:	c3                   	ret
+
+00804e96 <getchar>:
+{
+  804e96:	55                   	push   %ebp
+  804e97:	89 e5                	mov    %esp,%ebp
+  804e99:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804e9c:	6a 01                	push   $0x1
+  804e9e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804ea1:	50                   	push   %eax
+  804ea2:	6a 00                	push   $0x0
+  804ea4:	e8 d7 ce ff ff       	call   801d80 <read>
+	if (r < 0)
+  804ea9:	83 c4 10             	add    $0x10,%esp
+  804eac:	85 c0                	test   %eax,%eax
+  804eae:	78 06                	js     804eb6 <getchar+0x20>
+	if (r < 1)
+  804eb0:	74 06                	je     804eb8 <getchar+0x22>
+	return c;
+  804eb2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804eb6:	c9                   	leave
+  804eb7:	c3                   	ret
+		return -E_EOF;
+  804eb8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804ebd:	eb f7                	jmp    804eb6 <getchar+0x20>
+
+00804ebf <iscons>:
+{
+  804ebf:	55                   	push   %ebp
+  804ec0:	89 e5                	mov    %esp,%ebp
+  804ec2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804ec5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804ec8:	50                   	push   %eax
+  804ec9:	ff 75 08             	push   0x8(%ebp)
+  804ecc:	e8 50 cc ff ff       	call   801b21 <fd_lookup>
+  804ed1:	83 c4 10             	add    $0x10,%esp
+  804ed4:	85 c0                	test   %eax,%eax
+  804ed6:	78 11                	js     804ee9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804ed8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804edb:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804ee1:	39 10                	cmp    %edx,(%eax)
+  804ee3:	0f 94 c0             	sete   %al
+  804ee6:	0f b6 c0             	movzbl %al,%eax
+}
+  804ee9:	c9                   	leave
+  804eea:	c3                   	ret
+
+00804eeb <opencons>:
+{
+  804eeb:	55                   	push   %ebp
+  804eec:	89 e5                	mov    %esp,%ebp
+  804eee:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804ef1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804ef4:	50                   	push   %eax
+  804ef5:	e8 d3 cb ff ff       	call   801acd <fd_alloc>
+  804efa:	83 c4 10             	add    $0x10,%esp
+  804efd:	85 c0                	test   %eax,%eax
+  804eff:	78 3a                	js     804f3b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804f01:	83 ec 04             	sub    $0x4,%esp
+  804f04:	68 07 04 00 00       	push   $0x407
+  804f09:	ff 75 f4             	push   -0xc(%ebp)
+  804f0c:	6a 00                	push   $0x0
+  804f0e:	e8 c2 bd ff ff       	call   800cd5 <sys_page_alloc>
+  804f13:	83 c4 10             	add    $0x10,%esp
+  804f16:	85 c0                	test   %eax,%eax
+  804f18:	78 21                	js     804f3b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804f1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804f1d:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804f23:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804f25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804f28:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804f2f:	83 ec 0c             	sub    $0xc,%esp
+  804f32:	50                   	push   %eax
+  804f33:	e8 6e cb ff ff       	call   801aa6 <fd2num>
+  804f38:	83 c4 10             	add    $0x10,%esp
+}
+  804f3b:	c9                   	leave
+  804f3c:	c3                   	ret
+
+00804f3d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  804f3d:	55                   	push   %ebp
+  804f3e:	89 e5                	mov    %esp,%ebp
+  804f40:	56                   	push   %esi
+  804f41:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  804f42:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  804f45:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  804f4b:	e8 47 bd ff ff       	call   800c97 <sys_getenvid>
+  804f50:	83 ec 0c             	sub    $0xc,%esp
+  804f53:	ff 75 0c             	push   0xc(%ebp)
+  804f56:	ff 75 08             	push   0x8(%ebp)
+  804f59:	56                   	push   %esi
+  804f5a:	50                   	push   %eax
+  804f5b:	68 40 5e 80 00       	push   $0x805e40
+  804f60:	e8 96 b2 ff ff       	call   8001fb <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  804f65:	83 c4 18             	add    $0x18,%esp
+  804f68:	53                   	push   %ebx
+  804f69:	ff 75 10             	push   0x10(%ebp)
+  804f6c:	e8 39 b2 ff ff       	call   8001aa <vcprintf>
+	cprintf("\n");
+  804f71:	c7 04 24 f9 58 80 00 	movl   $0x8058f9,(%esp)
+  804f78:	e8 7e b2 ff ff       	call   8001fb <cprintf>
+  804f7d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  804f80:	cc                   	int3
+	while (1)
+  804f81:	eb fd                	jmp    804f80 <_panic+0x43>
+
+00804f83 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804f83:	55                   	push   %ebp
+  804f84:	89 e5                	mov    %esp,%ebp
+  804f86:	56                   	push   %esi
+  804f87:	53                   	push   %ebx
+  804f88:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804f8b:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  804f90:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804f93:	85 db                	test   %ebx,%ebx
+  804f95:	78 17                	js     804fae <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804f97:	83 ec 0c             	sub    $0xc,%esp
+  804f9a:	56                   	push   %esi
+  804f9b:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  804fa2:	83 c4 10             	add    $0x10,%esp
+  804fa5:	85 c0                	test   %eax,%eax
+  804fa7:	75 27                	jne    804fd0 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804fa9:	83 eb 01             	sub    $0x1,%ebx
+  804fac:	eb e5                	jmp    804f93 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804fae:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  804fb3:	8b 40 48             	mov    0x48(%eax),%eax
+  804fb6:	83 ec 08             	sub    $0x8,%esp
+  804fb9:	ff 76 28             	push   0x28(%esi)
+  804fbc:	ff 36                	push   (%esi)
+  804fbe:	50                   	push   %eax
+  804fbf:	68 64 5e 80 00       	push   $0x805e64
+  804fc4:	6a 1d                	push   $0x1d
+  804fc6:	68 87 5e 80 00       	push   $0x805e87
+  804fcb:	e8 6d ff ff ff       	call   804f3d <_panic>
+}
+  804fd0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804fd3:	5b                   	pop    %ebx
+  804fd4:	5e                   	pop    %esi
+  804fd5:	5d                   	pop    %ebp
+  804fd6:	c3                   	ret
+
+00804fd7 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804fd7:	55                   	push   %ebp
+  804fd8:	89 e5                	mov    %esp,%ebp
+  804fda:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804fdd:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  804fe4:	74 0a                	je     804ff0 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804fe6:	8b 45 08             	mov    0x8(%ebp),%eax
+  804fe9:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  804fee:	c9                   	leave
+  804fef:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804ff0:	83 ec 04             	sub    $0x4,%esp
+  804ff3:	6a 07                	push   $0x7
+  804ff5:	68 00 f0 bf ee       	push   $0xeebff000
+  804ffa:	6a 00                	push   $0x0
+  804ffc:	e8 d4 bc ff ff       	call   800cd5 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805001:	83 c4 08             	add    $0x8,%esp
+  805004:	68 77 50 80 00       	push   $0x805077
+  805009:	6a 00                	push   $0x0
+  80500b:	e8 2b c0 ff ff       	call   80103b <sys_env_set_pgfault_upcall>
+  805010:	83 c4 10             	add    $0x10,%esp
+  805013:	eb d1                	jmp    804fe6 <set_pgfault_handler+0xf>
+
+00805015 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  805015:	55                   	push   %ebp
+  805016:	89 e5                	mov    %esp,%ebp
+  805018:	83 ec 08             	sub    $0x8,%esp
+  80501b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  80501e:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  805024:	b8 00 00 00 00       	mov    $0x0,%eax
+  805029:	eb 03                	jmp    80502e <add_pgfault_handler+0x19>
+  80502b:	83 c0 01             	add    $0x1,%eax
+  80502e:	39 d0                	cmp    %edx,%eax
+  805030:	74 0b                	je     80503d <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  805032:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  805039:	75 f0                	jne    80502b <add_pgfault_handler+0x16>
+  80503b:	eb 24                	jmp    805061 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  80503d:	83 fa 0a             	cmp    $0xa,%edx
+  805040:	74 21                	je     805063 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  805042:	8d 42 01             	lea    0x1(%edx),%eax
+  805045:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  80504a:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  805051:	83 ec 0c             	sub    $0xc,%esp
+  805054:	68 83 4f 80 00       	push   $0x804f83
+  805059:	e8 79 ff ff ff       	call   804fd7 <set_pgfault_handler>
+  80505e:	83 c4 10             	add    $0x10,%esp
+}
+  805061:	c9                   	leave
+  805062:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  805063:	83 ec 04             	sub    $0x4,%esp
+  805066:	68 95 5e 80 00       	push   $0x805e95
+  80506b:	6a 44                	push   $0x44
+  80506d:	68 87 5e 80 00       	push   $0x805e87
+  805072:	e8 c6 fe ff ff       	call   804f3d <_panic>
+
+00805077 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  805077:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  805078:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  80507d:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80507f:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  805082:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  805086:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  80508a:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  80508d:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  80508f:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  805093:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  805096:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  805097:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  80509a:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  80509b:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80509c:	c3                   	ret
+
+0080509d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80509d:	55                   	push   %ebp
+  80509e:	89 e5                	mov    %esp,%ebp
+  8050a0:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8050a3:	89 c2                	mov    %eax,%edx
+  8050a5:	c1 ea 16             	shr    $0x16,%edx
+  8050a8:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8050af:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8050b4:	f6 c1 01             	test   $0x1,%cl
+  8050b7:	74 1e                	je     8050d7 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  8050b9:	c1 e8 0c             	shr    $0xc,%eax
+  8050bc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8050c3:	a8 01                	test   $0x1,%al
+  8050c5:	74 10                	je     8050d7 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8050c7:	c1 e8 0c             	shr    $0xc,%eax
+  8050ca:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8050cd:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  8050d4:	0f b7 d2             	movzwl %dx,%edx
+}
+  8050d7:	89 d0                	mov    %edx,%eax
+  8050d9:	5d                   	pop    %ebp
+  8050da:	c3                   	ret
+
+008050db <udivmod>:
+  8050db:	55                   	push   %ebp
+  8050dc:	57                   	push   %edi
+  8050dd:	56                   	push   %esi
+  8050de:	53                   	push   %ebx
+  8050df:	83 ec 24             	sub    $0x24,%esp
+  8050e2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8050e6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8050ea:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8050ee:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8050f2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8050f6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8050fa:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8050fe:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  805103:	b8 00 00 00 00       	mov    $0x0,%eax
+  805108:	ba 00 00 00 00       	mov    $0x0,%edx
+  80510d:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  805114:	00 
+  805115:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80511c:	00 
+  80511d:	89 fb                	mov    %edi,%ebx
+  80511f:	eb 08                	jmp    805129 <udivmod+0x4e>
+  805121:	83 e9 01             	sub    $0x1,%ecx
+  805124:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  805127:	74 68                	je     805191 <udivmod+0xb6>
+  805129:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80512d:	01 c0                	add    %eax,%eax
+  80512f:	89 c6                	mov    %eax,%esi
+  805131:	89 d7                	mov    %edx,%edi
+  805133:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805137:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80513b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80513e:	d3 ea                	shr    %cl,%edx
+  805140:	f6 c1 20             	test   $0x20,%cl
+  805143:	74 04                	je     805149 <udivmod+0x6e>
+  805145:	89 d0                	mov    %edx,%eax
+  805147:	31 d2                	xor    %edx,%edx
+  805149:	83 e0 01             	and    $0x1,%eax
+  80514c:	89 04 24             	mov    %eax,(%esp)
+  80514f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805156:	00 
+  805157:	8b 04 24             	mov    (%esp),%eax
+  80515a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80515e:	09 f0                	or     %esi,%eax
+  805160:	09 fa                	or     %edi,%edx
+  805162:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805166:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80516a:	39 f0                	cmp    %esi,%eax
+  80516c:	89 d5                	mov    %edx,%ebp
+  80516e:	19 fd                	sbb    %edi,%ebp
+  805170:	72 af                	jb     805121 <udivmod+0x46>
+  805172:	29 f0                	sub    %esi,%eax
+  805174:	19 fa                	sbb    %edi,%edx
+  805176:	89 cf                	mov    %ecx,%edi
+  805178:	c1 ef 05             	shr    $0x5,%edi
+  80517b:	83 e7 01             	and    $0x1,%edi
+  80517e:	89 fe                	mov    %edi,%esi
+  805180:	83 f6 01             	xor    $0x1,%esi
+  805183:	d3 e6                	shl    %cl,%esi
+  805185:	d3 e7                	shl    %cl,%edi
+  805187:	09 74 24 18          	or     %esi,0x18(%esp)
+  80518b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80518f:	eb 90                	jmp    805121 <udivmod+0x46>
+  805191:	85 db                	test   %ebx,%ebx
+  805193:	74 05                	je     80519a <udivmod+0xbf>
+  805195:	89 03                	mov    %eax,(%ebx)
+  805197:	89 53 04             	mov    %edx,0x4(%ebx)
+  80519a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80519e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8051a2:	83 c4 24             	add    $0x24,%esp
+  8051a5:	5b                   	pop    %ebx
+  8051a6:	5e                   	pop    %esi
+  8051a7:	5f                   	pop    %edi
+  8051a8:	5d                   	pop    %ebp
+  8051a9:	c3                   	ret
+
+008051aa <__udivdi3>:
+  8051aa:	83 ec 08             	sub    $0x8,%esp
+  8051ad:	6a 00                	push   $0x0
+  8051af:	ff 74 24 1c          	push   0x1c(%esp)
+  8051b3:	ff 74 24 1c          	push   0x1c(%esp)
+  8051b7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8051bb:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8051bf:	e8 17 ff ff ff       	call   8050db <udivmod>
+  8051c4:	83 c4 14             	add    $0x14,%esp
+  8051c7:	c3                   	ret
+
+008051c8 <__umoddi3>:
+  8051c8:	83 ec 18             	sub    $0x18,%esp
+  8051cb:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8051cf:	50                   	push   %eax
+  8051d0:	ff 74 24 2c          	push   0x2c(%esp)
+  8051d4:	ff 74 24 2c          	push   0x2c(%esp)
+  8051d8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8051dc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8051e0:	e8 f6 fe ff ff       	call   8050db <udivmod>
+  8051e5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8051e9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8051ed:	83 c4 24             	add    $0x24,%esp
+  8051f0:	c3                   	ret
+
+008051f1 <__divdi3>:
+  8051f1:	55                   	push   %ebp
+  8051f2:	57                   	push   %edi
+  8051f3:	56                   	push   %esi
+  8051f4:	53                   	push   %ebx
+  8051f5:	83 ec 10             	sub    $0x10,%esp
+  8051f8:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8051fc:	8b 54 24 28          	mov    0x28(%esp),%edx
+  805200:	89 c6                	mov    %eax,%esi
+  805202:	89 d7                	mov    %edx,%edi
+  805204:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  805208:	33 7c 24 30          	xor    0x30(%esp),%edi
+  80520c:	89 74 24 04          	mov    %esi,0x4(%esp)
+  805210:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  805214:	89 c5                	mov    %eax,%ebp
+  805216:	f7 dd                	neg    %ebp
+  805218:	89 d6                	mov    %edx,%esi
+  80521a:	83 d6 00             	adc    $0x0,%esi
+  80521d:	f7 de                	neg    %esi
+  80521f:	0f 48 e8             	cmovs  %eax,%ebp
+  805222:	0f 49 d6             	cmovns %esi,%edx
+  805225:	6a 00                	push   $0x0
+  805227:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80522b:	f7 de                	neg    %esi
+  80522d:	8b 44 24 34          	mov    0x34(%esp),%eax
+  805231:	83 d0 00             	adc    $0x0,%eax
+  805234:	f7 d8                	neg    %eax
+  805236:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  80523b:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  805240:	50                   	push   %eax
+  805241:	56                   	push   %esi
+  805242:	89 e8                	mov    %ebp,%eax
+  805244:	e8 92 fe ff ff       	call   8050db <udivmod>
+  805249:	83 c4 10             	add    $0x10,%esp
+  80524c:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  805251:	78 08                	js     80525b <__divdi3+0x6a>
+  805253:	83 c4 0c             	add    $0xc,%esp
+  805256:	5b                   	pop    %ebx
+  805257:	5e                   	pop    %esi
+  805258:	5f                   	pop    %edi
+  805259:	5d                   	pop    %ebp
+  80525a:	c3                   	ret
+  80525b:	f7 d8                	neg    %eax
+  80525d:	83 d2 00             	adc    $0x0,%edx
+  805260:	f7 da                	neg    %edx
+  805262:	eb ef                	jmp    805253 <__divdi3+0x62>
+
+00805264 <__moddi3>:
+  805264:	55                   	push   %ebp
+  805265:	57                   	push   %edi
+  805266:	56                   	push   %esi
+  805267:	53                   	push   %ebx
+  805268:	83 ec 18             	sub    $0x18,%esp
+  80526b:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80526f:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  805273:	89 f1                	mov    %esi,%ecx
+  805275:	f7 d9                	neg    %ecx
+  805277:	89 da                	mov    %ebx,%edx
+  805279:	83 d2 00             	adc    $0x0,%edx
+  80527c:	f7 da                	neg    %edx
+  80527e:	0f 48 ce             	cmovs  %esi,%ecx
+  805281:	0f 48 d3             	cmovs  %ebx,%edx
+  805284:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805288:	50                   	push   %eax
+  805289:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80528d:	f7 de                	neg    %esi
+  80528f:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  805293:	83 d0 00             	adc    $0x0,%eax
+  805296:	f7 d8                	neg    %eax
+  805298:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80529d:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8052a2:	50                   	push   %eax
+  8052a3:	56                   	push   %esi
+  8052a4:	89 c8                	mov    %ecx,%eax
+  8052a6:	e8 30 fe ff ff       	call   8050db <udivmod>
+  8052ab:	83 c4 10             	add    $0x10,%esp
+  8052ae:	85 db                	test   %ebx,%ebx
+  8052b0:	78 10                	js     8052c2 <__moddi3+0x5e>
+  8052b2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8052b6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8052ba:	83 c4 14             	add    $0x14,%esp
+  8052bd:	5b                   	pop    %ebx
+  8052be:	5e                   	pop    %esi
+  8052bf:	5f                   	pop    %edi
+  8052c0:	5d                   	pop    %ebp
+  8052c1:	c3                   	ret
+  8052c2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8052c6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8052ca:	f7 d8                	neg    %eax
+  8052cc:	83 d2 00             	adc    $0x0,%edx
+  8052cf:	f7 da                	neg    %edx
+  8052d1:	eb e7                	jmp    8052ba <__moddi3+0x56>
@@ -0,0 +1,10537 @@
+
+obj/user/primes.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c3 00 00 00       	call   8000f4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	int i, id, p;
+	envid_t envid;
+
+	// fetch a prime from our left neighbor
+top:
+	p = ipc_recv(&envid, 0, 0);
+  80003c:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80003f:	83 ec 04             	sub    $0x4,%esp
+  800042:	6a 00                	push   $0x0
+  800044:	6a 00                	push   $0x0
+  800046:	56                   	push   %esi
+  800047:	e8 99 18 00 00       	call   8018e5 <ipc_recv>
+  80004c:	89 c3                	mov    %eax,%ebx
+	cprintf("CPU %d: %d ", thisenv->env_cpunum, p);
+  80004e:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  800053:	8b 40 5c             	mov    0x5c(%eax),%eax
+  800056:	83 c4 0c             	add    $0xc,%esp
+  800059:	53                   	push   %ebx
+  80005a:	50                   	push   %eax
+  80005b:	68 e0 52 80 00       	push   $0x8052e0
+  800060:	e8 cd 01 00 00       	call   800232 <cprintf>
+
+	// fork a right neighbor to continue the chain
+	if ((id = fork()) < 0)
+  800065:	e8 89 13 00 00       	call   8013f3 <fork>
+  80006a:	89 c7                	mov    %eax,%edi
+  80006c:	83 c4 10             	add    $0x10,%esp
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	78 2e                	js     8000a1 <primeproc+0x6e>
+		panic("fork: %e", id);
+	if (id == 0)
+  800073:	74 ca                	je     80003f <primeproc+0xc>
+		goto top;
+
+	// filter out multiples of our prime
+	while (1) {
+		i = ipc_recv(&envid, 0, 0);
+  800075:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800078:	83 ec 04             	sub    $0x4,%esp
+  80007b:	6a 00                	push   $0x0
+  80007d:	6a 00                	push   $0x0
+  80007f:	56                   	push   %esi
+  800080:	e8 60 18 00 00       	call   8018e5 <ipc_recv>
+  800085:	89 c1                	mov    %eax,%ecx
+		if (i % p)
+  800087:	99                   	cltd
+  800088:	f7 fb                	idiv   %ebx
+  80008a:	83 c4 10             	add    $0x10,%esp
+  80008d:	85 d2                	test   %edx,%edx
+  80008f:	74 e7                	je     800078 <primeproc+0x45>
+			ipc_send(id, i, 0, 0);
+  800091:	6a 00                	push   $0x0
+  800093:	6a 00                	push   $0x0
+  800095:	51                   	push   %ecx
+  800096:	57                   	push   %edi
+  800097:	e8 0d 19 00 00       	call   8019a9 <ipc_send>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	eb d7                	jmp    800078 <primeproc+0x45>
+		panic("fork: %e", id);
+  8000a1:	50                   	push   %eax
+  8000a2:	68 ec 52 80 00       	push   $0x8052ec
+  8000a7:	6a 1a                	push   $0x1a
+  8000a9:	68 f5 52 80 00       	push   $0x8052f5
+  8000ae:	e8 a4 00 00 00       	call   800157 <_panic>
+
+008000b3 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  8000b3:	55                   	push   %ebp
+  8000b4:	89 e5                	mov    %esp,%ebp
+  8000b6:	56                   	push   %esi
+  8000b7:	53                   	push   %ebx
+	int i, id;
+
+	// fork the first prime process in the chain
+	if ((id = fork()) < 0)
+  8000b8:	e8 36 13 00 00       	call   8013f3 <fork>
+  8000bd:	89 c6                	mov    %eax,%esi
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	78 1a                	js     8000dd <umain+0x2a>
+		panic("fork: %e", id);
+	if (id == 0)
+		primeproc();
+
+	// feed all the integers through
+	for (i = 2; ; i++)
+  8000c3:	bb 02 00 00 00       	mov    $0x2,%ebx
+	if (id == 0)
+  8000c8:	74 25                	je     8000ef <umain+0x3c>
+		ipc_send(id, i, 0, 0);
+  8000ca:	6a 00                	push   $0x0
+  8000cc:	6a 00                	push   $0x0
+  8000ce:	53                   	push   %ebx
+  8000cf:	56                   	push   %esi
+  8000d0:	e8 d4 18 00 00       	call   8019a9 <ipc_send>
+	for (i = 2; ; i++)
+  8000d5:	83 c3 01             	add    $0x1,%ebx
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	eb ed                	jmp    8000ca <umain+0x17>
+		panic("fork: %e", id);
+  8000dd:	50                   	push   %eax
+  8000de:	68 ec 52 80 00       	push   $0x8052ec
+  8000e3:	6a 2d                	push   $0x2d
+  8000e5:	68 f5 52 80 00       	push   $0x8052f5
+  8000ea:	e8 68 00 00 00       	call   800157 <_panic>
+		primeproc();
+  8000ef:	e8 3f ff ff ff       	call   800033 <primeproc>
+
+008000f4 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000f4:	55                   	push   %ebp
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	56                   	push   %esi
+  8000f8:	53                   	push   %ebx
+  8000f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8000ff:	e8 ca 0b 00 00       	call   800cce <sys_getenvid>
+  800104:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800109:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80010c:	c1 e0 06             	shl    $0x6,%eax
+  80010f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800114:	a3 18 e9 80 00       	mov    %eax,0x80e918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800119:	85 db                	test   %ebx,%ebx
+  80011b:	7e 07                	jle    800124 <libmain+0x30>
+		binaryname = argv[0];
+  80011d:	8b 06                	mov    (%esi),%eax
+  80011f:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800124:	83 ec 08             	sub    $0x8,%esp
+  800127:	56                   	push   %esi
+  800128:	53                   	push   %ebx
+  800129:	e8 85 ff ff ff       	call   8000b3 <umain>
+
+	// exit gracefully
+	exit();
+  80012e:	e8 0a 00 00 00       	call   80013d <exit>
+}
+  800133:	83 c4 10             	add    $0x10,%esp
+  800136:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800139:	5b                   	pop    %ebx
+  80013a:	5e                   	pop    %esi
+  80013b:	5d                   	pop    %ebp
+  80013c:	c3                   	ret
+
+0080013d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80013d:	55                   	push   %ebp
+  80013e:	89 e5                	mov    %esp,%ebp
+  800140:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800143:	e8 60 1b 00 00       	call   801ca8 <close_all>
+	sys_env_destroy(0);
+  800148:	83 ec 0c             	sub    $0xc,%esp
+  80014b:	6a 00                	push   $0x0
+  80014d:	e8 3b 0b 00 00       	call   800c8d <sys_env_destroy>
+}
+  800152:	83 c4 10             	add    $0x10,%esp
+  800155:	c9                   	leave
+  800156:	c3                   	ret
+
+00800157 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800157:	55                   	push   %ebp
+  800158:	89 e5                	mov    %esp,%ebp
+  80015a:	56                   	push   %esi
+  80015b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80015c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80015f:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  800165:	e8 64 0b 00 00       	call   800cce <sys_getenvid>
+  80016a:	83 ec 0c             	sub    $0xc,%esp
+  80016d:	ff 75 0c             	push   0xc(%ebp)
+  800170:	ff 75 08             	push   0x8(%ebp)
+  800173:	56                   	push   %esi
+  800174:	50                   	push   %eax
+  800175:	68 10 53 80 00       	push   $0x805310
+  80017a:	e8 b3 00 00 00       	call   800232 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80017f:	83 c4 18             	add    $0x18,%esp
+  800182:	53                   	push   %ebx
+  800183:	ff 75 10             	push   0x10(%ebp)
+  800186:	e8 56 00 00 00       	call   8001e1 <vcprintf>
+	cprintf("\n");
+  80018b:	c7 04 24 f9 58 80 00 	movl   $0x8058f9,(%esp)
+  800192:	e8 9b 00 00 00       	call   800232 <cprintf>
+  800197:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80019a:	cc                   	int3
+	while (1)
+  80019b:	eb fd                	jmp    80019a <_panic+0x43>
+
+0080019d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80019d:	55                   	push   %ebp
+  80019e:	89 e5                	mov    %esp,%ebp
+  8001a0:	53                   	push   %ebx
+  8001a1:	83 ec 04             	sub    $0x4,%esp
+  8001a4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001a7:	8b 13                	mov    (%ebx),%edx
+  8001a9:	8d 42 01             	lea    0x1(%edx),%eax
+  8001ac:	89 03                	mov    %eax,(%ebx)
+  8001ae:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001b1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001b5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001ba:	74 09                	je     8001c5 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001bc:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001c3:	c9                   	leave
+  8001c4:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001c5:	83 ec 08             	sub    $0x8,%esp
+  8001c8:	68 ff 00 00 00       	push   $0xff
+  8001cd:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001d0:	50                   	push   %eax
+  8001d1:	e8 69 0a 00 00       	call   800c3f <sys_cputs>
+		b->idx = 0;
+  8001d6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001dc:	83 c4 10             	add    $0x10,%esp
+  8001df:	eb db                	jmp    8001bc <putch+0x1f>
+
+008001e1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001e1:	55                   	push   %ebp
+  8001e2:	89 e5                	mov    %esp,%ebp
+  8001e4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001ea:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001f1:	00 00 00 
+	b.cnt = 0;
+  8001f4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001fb:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001fe:	ff 75 0c             	push   0xc(%ebp)
+  800201:	ff 75 08             	push   0x8(%ebp)
+  800204:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80020a:	50                   	push   %eax
+  80020b:	68 9d 01 80 00       	push   $0x80019d
+  800210:	e8 14 01 00 00       	call   800329 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800215:	83 c4 08             	add    $0x8,%esp
+  800218:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80021e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800224:	50                   	push   %eax
+  800225:	e8 15 0a 00 00       	call   800c3f <sys_cputs>
+
+	return b.cnt;
+}
+  80022a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800230:	c9                   	leave
+  800231:	c3                   	ret
+
+00800232 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800232:	55                   	push   %ebp
+  800233:	89 e5                	mov    %esp,%ebp
+  800235:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800238:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80023b:	50                   	push   %eax
+  80023c:	ff 75 08             	push   0x8(%ebp)
+  80023f:	e8 9d ff ff ff       	call   8001e1 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800244:	c9                   	leave
+  800245:	c3                   	ret
+
+00800246 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800246:	55                   	push   %ebp
+  800247:	89 e5                	mov    %esp,%ebp
+  800249:	57                   	push   %edi
+  80024a:	56                   	push   %esi
+  80024b:	53                   	push   %ebx
+  80024c:	83 ec 1c             	sub    $0x1c,%esp
+  80024f:	89 c7                	mov    %eax,%edi
+  800251:	89 d6                	mov    %edx,%esi
+  800253:	8b 45 08             	mov    0x8(%ebp),%eax
+  800256:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800259:	89 d1                	mov    %edx,%ecx
+  80025b:	89 c2                	mov    %eax,%edx
+  80025d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800260:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800263:	8b 45 10             	mov    0x10(%ebp),%eax
+  800266:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800269:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80026c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800273:	39 c2                	cmp    %eax,%edx
+  800275:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800278:	72 3e                	jb     8002b8 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80027a:	83 ec 0c             	sub    $0xc,%esp
+  80027d:	ff 75 18             	push   0x18(%ebp)
+  800280:	83 eb 01             	sub    $0x1,%ebx
+  800283:	53                   	push   %ebx
+  800284:	50                   	push   %eax
+  800285:	83 ec 08             	sub    $0x8,%esp
+  800288:	ff 75 e4             	push   -0x1c(%ebp)
+  80028b:	ff 75 e0             	push   -0x20(%ebp)
+  80028e:	ff 75 dc             	push   -0x24(%ebp)
+  800291:	ff 75 d8             	push   -0x28(%ebp)
+  800294:	e8 02 4f 00 00       	call   80519b <__udivdi3>
+  800299:	83 c4 18             	add    $0x18,%esp
+  80029c:	52                   	push   %edx
+  80029d:	50                   	push   %eax
+  80029e:	89 f2                	mov    %esi,%edx
+  8002a0:	89 f8                	mov    %edi,%eax
+  8002a2:	e8 9f ff ff ff       	call   800246 <printnum>
+  8002a7:	83 c4 20             	add    $0x20,%esp
+  8002aa:	eb 13                	jmp    8002bf <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002ac:	83 ec 08             	sub    $0x8,%esp
+  8002af:	56                   	push   %esi
+  8002b0:	ff 75 18             	push   0x18(%ebp)
+  8002b3:	ff d7                	call   *%edi
+  8002b5:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002b8:	83 eb 01             	sub    $0x1,%ebx
+  8002bb:	85 db                	test   %ebx,%ebx
+  8002bd:	7f ed                	jg     8002ac <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002bf:	83 ec 08             	sub    $0x8,%esp
+  8002c2:	56                   	push   %esi
+  8002c3:	83 ec 04             	sub    $0x4,%esp
+  8002c6:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c9:	ff 75 e0             	push   -0x20(%ebp)
+  8002cc:	ff 75 dc             	push   -0x24(%ebp)
+  8002cf:	ff 75 d8             	push   -0x28(%ebp)
+  8002d2:	e8 e2 4e 00 00       	call   8051b9 <__umoddi3>
+  8002d7:	83 c4 14             	add    $0x14,%esp
+  8002da:	0f be 80 33 53 80 00 	movsbl 0x805333(%eax),%eax
+  8002e1:	50                   	push   %eax
+  8002e2:	ff d7                	call   *%edi
+}
+  8002e4:	83 c4 10             	add    $0x10,%esp
+  8002e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ea:	5b                   	pop    %ebx
+  8002eb:	5e                   	pop    %esi
+  8002ec:	5f                   	pop    %edi
+  8002ed:	5d                   	pop    %ebp
+  8002ee:	c3                   	ret
+
+008002ef <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002ef:	55                   	push   %ebp
+  8002f0:	89 e5                	mov    %esp,%ebp
+  8002f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002f5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002f9:	8b 10                	mov    (%eax),%edx
+  8002fb:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002fe:	73 0a                	jae    80030a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800300:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800303:	89 08                	mov    %ecx,(%eax)
+  800305:	8b 45 08             	mov    0x8(%ebp),%eax
+  800308:	88 02                	mov    %al,(%edx)
+}
+  80030a:	5d                   	pop    %ebp
+  80030b:	c3                   	ret
+
+0080030c <printfmt>:
+{
+  80030c:	55                   	push   %ebp
+  80030d:	89 e5                	mov    %esp,%ebp
+  80030f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800312:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800315:	50                   	push   %eax
+  800316:	ff 75 10             	push   0x10(%ebp)
+  800319:	ff 75 0c             	push   0xc(%ebp)
+  80031c:	ff 75 08             	push   0x8(%ebp)
+  80031f:	e8 05 00 00 00       	call   800329 <vprintfmt>
+}
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	c9                   	leave
+  800328:	c3                   	ret
+
+00800329 <vprintfmt>:
+{
+  800329:	55                   	push   %ebp
+  80032a:	89 e5                	mov    %esp,%ebp
+  80032c:	57                   	push   %edi
+  80032d:	56                   	push   %esi
+  80032e:	53                   	push   %ebx
+  80032f:	83 ec 2c             	sub    $0x2c,%esp
+  800332:	8b 75 08             	mov    0x8(%ebp),%esi
+  800335:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800338:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80033b:	eb 0a                	jmp    800347 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80033d:	83 ec 08             	sub    $0x8,%esp
+  800340:	53                   	push   %ebx
+  800341:	50                   	push   %eax
+  800342:	ff d6                	call   *%esi
+  800344:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800347:	83 c7 01             	add    $0x1,%edi
+  80034a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80034e:	83 f8 25             	cmp    $0x25,%eax
+  800351:	74 0c                	je     80035f <vprintfmt+0x36>
+			if (ch == '\0')
+  800353:	85 c0                	test   %eax,%eax
+  800355:	75 e6                	jne    80033d <vprintfmt+0x14>
+}
+  800357:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80035a:	5b                   	pop    %ebx
+  80035b:	5e                   	pop    %esi
+  80035c:	5f                   	pop    %edi
+  80035d:	5d                   	pop    %ebp
+  80035e:	c3                   	ret
+		padc = ' ';
+  80035f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800363:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80036a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800371:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800378:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80037d:	8d 47 01             	lea    0x1(%edi),%eax
+  800380:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800383:	0f b6 17             	movzbl (%edi),%edx
+  800386:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800389:	3c 55                	cmp    $0x55,%al
+  80038b:	0f 87 c5 03 00 00    	ja     800756 <vprintfmt+0x42d>
+  800391:	0f b6 c0             	movzbl %al,%eax
+  800394:	ff 24 85 c0 54 80 00 	jmp    *0x8054c0(,%eax,4)
+  80039b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80039e:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003a2:	eb d9                	jmp    80037d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003a7:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003ab:	eb d0                	jmp    80037d <vprintfmt+0x54>
+  8003ad:	0f b6 d2             	movzbl %dl,%edx
+  8003b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003bb:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003be:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003c2:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003c5:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003c8:	83 f9 09             	cmp    $0x9,%ecx
+  8003cb:	77 55                	ja     800422 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003cd:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003d0:	eb e9                	jmp    8003bb <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d5:	8b 00                	mov    (%eax),%eax
+  8003d7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8003e0:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003e6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ea:	79 91                	jns    80037d <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003ec:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003f2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003f9:	eb 82                	jmp    80037d <vprintfmt+0x54>
+			if (width < 0)
+  8003fb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003fe:	85 d2                	test   %edx,%edx
+  800400:	b8 00 00 00 00       	mov    $0x0,%eax
+  800405:	0f 49 c2             	cmovns %edx,%eax
+  800408:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80040b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80040e:	e9 6a ff ff ff       	jmp    80037d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800413:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800416:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80041d:	e9 5b ff ff ff       	jmp    80037d <vprintfmt+0x54>
+  800422:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800425:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800428:	eb bc                	jmp    8003e6 <vprintfmt+0xbd>
+			lflag++;
+  80042a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80042d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800430:	e9 48 ff ff ff       	jmp    80037d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800435:	8b 45 14             	mov    0x14(%ebp),%eax
+  800438:	8d 78 04             	lea    0x4(%eax),%edi
+  80043b:	83 ec 08             	sub    $0x8,%esp
+  80043e:	53                   	push   %ebx
+  80043f:	ff 30                	push   (%eax)
+  800441:	ff d6                	call   *%esi
+			break;
+  800443:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800446:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800449:	e9 63 02 00 00       	jmp    8006b1 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  80044e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800451:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800454:	8b 10                	mov    (%eax),%edx
+  800456:	89 d0                	mov    %edx,%eax
+  800458:	f7 d8                	neg    %eax
+  80045a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80045d:	83 f8 12             	cmp    $0x12,%eax
+  800460:	7f 23                	jg     800485 <vprintfmt+0x15c>
+  800462:	8b 14 85 20 56 80 00 	mov    0x805620(,%eax,4),%edx
+  800469:	85 d2                	test   %edx,%edx
+  80046b:	74 18                	je     800485 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80046d:	52                   	push   %edx
+  80046e:	68 85 58 80 00       	push   $0x805885
+  800473:	53                   	push   %ebx
+  800474:	56                   	push   %esi
+  800475:	e8 92 fe ff ff       	call   80030c <printfmt>
+  80047a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80047d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800480:	e9 2c 02 00 00       	jmp    8006b1 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  800485:	50                   	push   %eax
+  800486:	68 4b 53 80 00       	push   $0x80534b
+  80048b:	53                   	push   %ebx
+  80048c:	56                   	push   %esi
+  80048d:	e8 7a fe ff ff       	call   80030c <printfmt>
+  800492:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800495:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800498:	e9 14 02 00 00       	jmp    8006b1 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80049d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a0:	83 c0 04             	add    $0x4,%eax
+  8004a3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a9:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004ab:	85 c9                	test   %ecx,%ecx
+  8004ad:	b8 44 53 80 00       	mov    $0x805344,%eax
+  8004b2:	0f 45 c1             	cmovne %ecx,%eax
+  8004b5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004b8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004bc:	7e 06                	jle    8004c4 <vprintfmt+0x19b>
+  8004be:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004c2:	75 0b                	jne    8004cf <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c4:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004c7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004ca:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004cd:	eb 5c                	jmp    80052b <vprintfmt+0x202>
+  8004cf:	83 ec 08             	sub    $0x8,%esp
+  8004d2:	ff 75 d0             	push   -0x30(%ebp)
+  8004d5:	ff 75 cc             	push   -0x34(%ebp)
+  8004d8:	e8 19 03 00 00       	call   8007f6 <strnlen>
+  8004dd:	89 c2                	mov    %eax,%edx
+  8004df:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e2:	29 d0                	sub    %edx,%eax
+  8004e4:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004e7:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004eb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ee:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004f1:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004f3:	eb 0e                	jmp    800503 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004f5:	83 ec 08             	sub    $0x8,%esp
+  8004f8:	53                   	push   %ebx
+  8004f9:	57                   	push   %edi
+  8004fa:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004fd:	83 ee 01             	sub    $0x1,%esi
+  800500:	83 c4 10             	add    $0x10,%esp
+  800503:	85 f6                	test   %esi,%esi
+  800505:	7f ee                	jg     8004f5 <vprintfmt+0x1cc>
+  800507:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80050a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050d:	85 c0                	test   %eax,%eax
+  80050f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800514:	0f 49 d0             	cmovns %eax,%edx
+  800517:	29 d0                	sub    %edx,%eax
+  800519:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80051c:	eb a6                	jmp    8004c4 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80051e:	83 ec 08             	sub    $0x8,%esp
+  800521:	53                   	push   %ebx
+  800522:	52                   	push   %edx
+  800523:	ff 55 08             	call   *0x8(%ebp)
+  800526:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800529:	89 f1                	mov    %esi,%ecx
+  80052b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80052e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800532:	0f be d0             	movsbl %al,%edx
+  800535:	85 d2                	test   %edx,%edx
+  800537:	74 28                	je     800561 <vprintfmt+0x238>
+  800539:	85 ff                	test   %edi,%edi
+  80053b:	78 05                	js     800542 <vprintfmt+0x219>
+  80053d:	83 ef 01             	sub    $0x1,%edi
+  800540:	78 30                	js     800572 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800542:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800546:	74 d6                	je     80051e <vprintfmt+0x1f5>
+  800548:	0f be c0             	movsbl %al,%eax
+  80054b:	83 e8 20             	sub    $0x20,%eax
+  80054e:	83 f8 5e             	cmp    $0x5e,%eax
+  800551:	76 cb                	jbe    80051e <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800553:	83 ec 08             	sub    $0x8,%esp
+  800556:	53                   	push   %ebx
+  800557:	6a 3f                	push   $0x3f
+  800559:	ff 55 08             	call   *0x8(%ebp)
+  80055c:	83 c4 10             	add    $0x10,%esp
+  80055f:	eb c8                	jmp    800529 <vprintfmt+0x200>
+  800561:	8b 75 08             	mov    0x8(%ebp),%esi
+  800564:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800567:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80056a:	01 d0                	add    %edx,%eax
+  80056c:	29 c8                	sub    %ecx,%eax
+  80056e:	89 c7                	mov    %eax,%edi
+  800570:	eb 13                	jmp    800585 <vprintfmt+0x25c>
+  800572:	8b 75 08             	mov    0x8(%ebp),%esi
+  800575:	eb ed                	jmp    800564 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800577:	83 ec 08             	sub    $0x8,%esp
+  80057a:	53                   	push   %ebx
+  80057b:	6a 20                	push   $0x20
+  80057d:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80057f:	83 ef 01             	sub    $0x1,%edi
+  800582:	83 c4 10             	add    $0x10,%esp
+  800585:	85 ff                	test   %edi,%edi
+  800587:	7f ee                	jg     800577 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800589:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80058c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80058f:	e9 1d 01 00 00       	jmp    8006b1 <vprintfmt+0x388>
+	if (lflag >= 2)
+  800594:	83 f9 01             	cmp    $0x1,%ecx
+  800597:	7f 1b                	jg     8005b4 <vprintfmt+0x28b>
+	else if (lflag)
+  800599:	85 c9                	test   %ecx,%ecx
+  80059b:	74 63                	je     800600 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  80059d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a0:	8b 00                	mov    (%eax),%eax
+  8005a2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a5:	99                   	cltd
+  8005a6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ac:	8d 40 04             	lea    0x4(%eax),%eax
+  8005af:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b2:	eb 17                	jmp    8005cb <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  8005b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b7:	8b 50 04             	mov    0x4(%eax),%edx
+  8005ba:	8b 00                	mov    (%eax),%eax
+  8005bc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005bf:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c5:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c8:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005cb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ce:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005d1:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005d6:	85 c9                	test   %ecx,%ecx
+  8005d8:	0f 89 b9 00 00 00    	jns    800697 <vprintfmt+0x36e>
+				putch('-', putdat);
+  8005de:	83 ec 08             	sub    $0x8,%esp
+  8005e1:	53                   	push   %ebx
+  8005e2:	6a 2d                	push   $0x2d
+  8005e4:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005e6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005e9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005ec:	f7 da                	neg    %edx
+  8005ee:	83 d1 00             	adc    $0x0,%ecx
+  8005f1:	f7 d9                	neg    %ecx
+  8005f3:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005f6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005fb:	e9 97 00 00 00       	jmp    800697 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800600:	8b 45 14             	mov    0x14(%ebp),%eax
+  800603:	8b 00                	mov    (%eax),%eax
+  800605:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800608:	99                   	cltd
+  800609:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80060c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060f:	8d 40 04             	lea    0x4(%eax),%eax
+  800612:	89 45 14             	mov    %eax,0x14(%ebp)
+  800615:	eb b4                	jmp    8005cb <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  800617:	83 f9 01             	cmp    $0x1,%ecx
+  80061a:	7f 1b                	jg     800637 <vprintfmt+0x30e>
+	else if (lflag)
+  80061c:	85 c9                	test   %ecx,%ecx
+  80061e:	74 2c                	je     80064c <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800620:	8b 45 14             	mov    0x14(%ebp),%eax
+  800623:	8b 10                	mov    (%eax),%edx
+  800625:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062a:	8d 40 04             	lea    0x4(%eax),%eax
+  80062d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800630:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800635:	eb 60                	jmp    800697 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800637:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063a:	8b 10                	mov    (%eax),%edx
+  80063c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80063f:	8d 40 08             	lea    0x8(%eax),%eax
+  800642:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800645:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80064a:	eb 4b                	jmp    800697 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80064c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064f:	8b 10                	mov    (%eax),%edx
+  800651:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800656:	8d 40 04             	lea    0x4(%eax),%eax
+  800659:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80065c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800661:	eb 34                	jmp    800697 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800663:	83 f9 01             	cmp    $0x1,%ecx
+  800666:	7f 15                	jg     80067d <vprintfmt+0x354>
+	else if (lflag)
+  800668:	85 c9                	test   %ecx,%ecx
+  80066a:	74 4d                	je     8006b9 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  80066c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066f:	8b 00                	mov    (%eax),%eax
+  800671:	99                   	cltd
+  800672:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800675:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800678:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80067b:	eb 11                	jmp    80068e <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  80067d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800680:	8b 50 04             	mov    0x4(%eax),%edx
+  800683:	8b 00                	mov    (%eax),%eax
+  800685:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800688:	8d 49 08             	lea    0x8(%ecx),%ecx
+  80068b:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  80068e:	89 d1                	mov    %edx,%ecx
+  800690:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800692:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800697:	83 ec 0c             	sub    $0xc,%esp
+  80069a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80069e:	50                   	push   %eax
+  80069f:	ff 75 e0             	push   -0x20(%ebp)
+  8006a2:	57                   	push   %edi
+  8006a3:	51                   	push   %ecx
+  8006a4:	52                   	push   %edx
+  8006a5:	89 da                	mov    %ebx,%edx
+  8006a7:	89 f0                	mov    %esi,%eax
+  8006a9:	e8 98 fb ff ff       	call   800246 <printnum>
+			break;
+  8006ae:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006b1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006b4:	e9 8e fc ff ff       	jmp    800347 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  8006b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bc:	8b 00                	mov    (%eax),%eax
+  8006be:	99                   	cltd
+  8006bf:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006c2:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8006c5:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8006c8:	eb c4                	jmp    80068e <vprintfmt+0x365>
+			putch('0', putdat);
+  8006ca:	83 ec 08             	sub    $0x8,%esp
+  8006cd:	53                   	push   %ebx
+  8006ce:	6a 30                	push   $0x30
+  8006d0:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006d2:	83 c4 08             	add    $0x8,%esp
+  8006d5:	53                   	push   %ebx
+  8006d6:	6a 78                	push   $0x78
+  8006d8:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dd:	8b 10                	mov    (%eax),%edx
+  8006df:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006e4:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ed:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8006f2:	eb a3                	jmp    800697 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8006f4:	83 f9 01             	cmp    $0x1,%ecx
+  8006f7:	7f 1b                	jg     800714 <vprintfmt+0x3eb>
+	else if (lflag)
+  8006f9:	85 c9                	test   %ecx,%ecx
+  8006fb:	74 2f                	je     80072c <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8006fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800700:	8b 10                	mov    (%eax),%edx
+  800702:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800707:	8d 40 04             	lea    0x4(%eax),%eax
+  80070a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80070d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800712:	eb 83                	jmp    800697 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800714:	8b 45 14             	mov    0x14(%ebp),%eax
+  800717:	8b 10                	mov    (%eax),%edx
+  800719:	8b 48 04             	mov    0x4(%eax),%ecx
+  80071c:	8d 40 08             	lea    0x8(%eax),%eax
+  80071f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800722:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800727:	e9 6b ff ff ff       	jmp    800697 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80072c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072f:	8b 10                	mov    (%eax),%edx
+  800731:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800736:	8d 40 04             	lea    0x4(%eax),%eax
+  800739:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80073c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800741:	e9 51 ff ff ff       	jmp    800697 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800746:	83 ec 08             	sub    $0x8,%esp
+  800749:	53                   	push   %ebx
+  80074a:	6a 25                	push   $0x25
+  80074c:	ff d6                	call   *%esi
+			break;
+  80074e:	83 c4 10             	add    $0x10,%esp
+  800751:	e9 5b ff ff ff       	jmp    8006b1 <vprintfmt+0x388>
+			putch('%', putdat);
+  800756:	83 ec 08             	sub    $0x8,%esp
+  800759:	53                   	push   %ebx
+  80075a:	6a 25                	push   $0x25
+  80075c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80075e:	83 c4 10             	add    $0x10,%esp
+  800761:	89 f8                	mov    %edi,%eax
+  800763:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800767:	74 05                	je     80076e <vprintfmt+0x445>
+  800769:	83 e8 01             	sub    $0x1,%eax
+  80076c:	eb f5                	jmp    800763 <vprintfmt+0x43a>
+  80076e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800771:	e9 3b ff ff ff       	jmp    8006b1 <vprintfmt+0x388>
+
+00800776 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800776:	55                   	push   %ebp
+  800777:	89 e5                	mov    %esp,%ebp
+  800779:	83 ec 18             	sub    $0x18,%esp
+  80077c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80077f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800782:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800785:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800789:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80078c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800793:	85 c0                	test   %eax,%eax
+  800795:	74 26                	je     8007bd <vsnprintf+0x47>
+  800797:	85 d2                	test   %edx,%edx
+  800799:	7e 22                	jle    8007bd <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80079b:	ff 75 14             	push   0x14(%ebp)
+  80079e:	ff 75 10             	push   0x10(%ebp)
+  8007a1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007a4:	50                   	push   %eax
+  8007a5:	68 ef 02 80 00       	push   $0x8002ef
+  8007aa:	e8 7a fb ff ff       	call   800329 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007af:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007b2:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007b8:	83 c4 10             	add    $0x10,%esp
+}
+  8007bb:	c9                   	leave
+  8007bc:	c3                   	ret
+		return -E_INVAL;
+  8007bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007c2:	eb f7                	jmp    8007bb <vsnprintf+0x45>
+
+008007c4 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007c4:	55                   	push   %ebp
+  8007c5:	89 e5                	mov    %esp,%ebp
+  8007c7:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007ca:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007cd:	50                   	push   %eax
+  8007ce:	ff 75 10             	push   0x10(%ebp)
+  8007d1:	ff 75 0c             	push   0xc(%ebp)
+  8007d4:	ff 75 08             	push   0x8(%ebp)
+  8007d7:	e8 9a ff ff ff       	call   800776 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007dc:	c9                   	leave
+  8007dd:	c3                   	ret
+
+008007de <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007de:	55                   	push   %ebp
+  8007df:	89 e5                	mov    %esp,%ebp
+  8007e1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e9:	eb 03                	jmp    8007ee <strlen+0x10>
+		n++;
+  8007eb:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007ee:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007f2:	75 f7                	jne    8007eb <strlen+0xd>
+	return n;
+}
+  8007f4:	5d                   	pop    %ebp
+  8007f5:	c3                   	ret
+
+008007f6 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007f6:	55                   	push   %ebp
+  8007f7:	89 e5                	mov    %esp,%ebp
+  8007f9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800804:	eb 03                	jmp    800809 <strnlen+0x13>
+		n++;
+  800806:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800809:	39 d0                	cmp    %edx,%eax
+  80080b:	74 08                	je     800815 <strnlen+0x1f>
+  80080d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800811:	75 f3                	jne    800806 <strnlen+0x10>
+  800813:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800815:	89 d0                	mov    %edx,%eax
+  800817:	5d                   	pop    %ebp
+  800818:	c3                   	ret
+
+00800819 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800819:	55                   	push   %ebp
+  80081a:	89 e5                	mov    %esp,%ebp
+  80081c:	53                   	push   %ebx
+  80081d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800820:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800823:	b8 00 00 00 00       	mov    $0x0,%eax
+  800828:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80082c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80082f:	83 c0 01             	add    $0x1,%eax
+  800832:	84 d2                	test   %dl,%dl
+  800834:	75 f2                	jne    800828 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800836:	89 c8                	mov    %ecx,%eax
+  800838:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083b:	c9                   	leave
+  80083c:	c3                   	ret
+
+0080083d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80083d:	55                   	push   %ebp
+  80083e:	89 e5                	mov    %esp,%ebp
+  800840:	53                   	push   %ebx
+  800841:	83 ec 10             	sub    $0x10,%esp
+  800844:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800847:	53                   	push   %ebx
+  800848:	e8 91 ff ff ff       	call   8007de <strlen>
+  80084d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800850:	ff 75 0c             	push   0xc(%ebp)
+  800853:	01 d8                	add    %ebx,%eax
+  800855:	50                   	push   %eax
+  800856:	e8 be ff ff ff       	call   800819 <strcpy>
+	return dst;
+}
+  80085b:	89 d8                	mov    %ebx,%eax
+  80085d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800860:	c9                   	leave
+  800861:	c3                   	ret
+
+00800862 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800862:	55                   	push   %ebp
+  800863:	89 e5                	mov    %esp,%ebp
+  800865:	56                   	push   %esi
+  800866:	53                   	push   %ebx
+  800867:	8b 75 08             	mov    0x8(%ebp),%esi
+  80086a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80086d:	89 f3                	mov    %esi,%ebx
+  80086f:	03 5d 10             	add    0x10(%ebp),%ebx
+  800872:	89 f0                	mov    %esi,%eax
+  800874:	eb 0f                	jmp    800885 <strncpy+0x23>
+		*dst++ = *src;
+  800876:	83 c0 01             	add    $0x1,%eax
+  800879:	0f b6 0a             	movzbl (%edx),%ecx
+  80087c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80087f:	80 f9 01             	cmp    $0x1,%cl
+  800882:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800885:	39 d8                	cmp    %ebx,%eax
+  800887:	75 ed                	jne    800876 <strncpy+0x14>
+	}
+	return ret;
+}
+  800889:	89 f0                	mov    %esi,%eax
+  80088b:	5b                   	pop    %ebx
+  80088c:	5e                   	pop    %esi
+  80088d:	5d                   	pop    %ebp
+  80088e:	c3                   	ret
+
+0080088f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80088f:	55                   	push   %ebp
+  800890:	89 e5                	mov    %esp,%ebp
+  800892:	56                   	push   %esi
+  800893:	53                   	push   %ebx
+  800894:	8b 75 08             	mov    0x8(%ebp),%esi
+  800897:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80089a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80089d:	89 f0                	mov    %esi,%eax
+  80089f:	85 d2                	test   %edx,%edx
+  8008a1:	74 21                	je     8008c4 <strlcpy+0x35>
+  8008a3:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008a7:	89 f2                	mov    %esi,%edx
+  8008a9:	eb 09                	jmp    8008b4 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008ab:	83 c1 01             	add    $0x1,%ecx
+  8008ae:	83 c2 01             	add    $0x1,%edx
+  8008b1:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008b4:	39 c2                	cmp    %eax,%edx
+  8008b6:	74 09                	je     8008c1 <strlcpy+0x32>
+  8008b8:	0f b6 19             	movzbl (%ecx),%ebx
+  8008bb:	84 db                	test   %bl,%bl
+  8008bd:	75 ec                	jne    8008ab <strlcpy+0x1c>
+  8008bf:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008c1:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008c4:	29 f0                	sub    %esi,%eax
+}
+  8008c6:	5b                   	pop    %ebx
+  8008c7:	5e                   	pop    %esi
+  8008c8:	5d                   	pop    %ebp
+  8008c9:	c3                   	ret
+
+008008ca <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008ca:	55                   	push   %ebp
+  8008cb:	89 e5                	mov    %esp,%ebp
+  8008cd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008d3:	eb 06                	jmp    8008db <strcmp+0x11>
+		p++, q++;
+  8008d5:	83 c1 01             	add    $0x1,%ecx
+  8008d8:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008db:	0f b6 01             	movzbl (%ecx),%eax
+  8008de:	84 c0                	test   %al,%al
+  8008e0:	74 04                	je     8008e6 <strcmp+0x1c>
+  8008e2:	3a 02                	cmp    (%edx),%al
+  8008e4:	74 ef                	je     8008d5 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008e6:	0f b6 c0             	movzbl %al,%eax
+  8008e9:	0f b6 12             	movzbl (%edx),%edx
+  8008ec:	29 d0                	sub    %edx,%eax
+}
+  8008ee:	5d                   	pop    %ebp
+  8008ef:	c3                   	ret
+
+008008f0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008f0:	55                   	push   %ebp
+  8008f1:	89 e5                	mov    %esp,%ebp
+  8008f3:	53                   	push   %ebx
+  8008f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008fa:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008fd:	eb 09                	jmp    800908 <strncmp+0x18>
+		n--, p++, q++;
+  8008ff:	83 ea 01             	sub    $0x1,%edx
+  800902:	83 c0 01             	add    $0x1,%eax
+  800905:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800908:	85 d2                	test   %edx,%edx
+  80090a:	74 18                	je     800924 <strncmp+0x34>
+  80090c:	0f b6 18             	movzbl (%eax),%ebx
+  80090f:	84 db                	test   %bl,%bl
+  800911:	74 04                	je     800917 <strncmp+0x27>
+  800913:	3a 19                	cmp    (%ecx),%bl
+  800915:	74 e8                	je     8008ff <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800917:	0f b6 00             	movzbl (%eax),%eax
+  80091a:	0f b6 11             	movzbl (%ecx),%edx
+  80091d:	29 d0                	sub    %edx,%eax
+}
+  80091f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800922:	c9                   	leave
+  800923:	c3                   	ret
+		return 0;
+  800924:	b8 00 00 00 00       	mov    $0x0,%eax
+  800929:	eb f4                	jmp    80091f <strncmp+0x2f>
+
+0080092b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80092b:	55                   	push   %ebp
+  80092c:	89 e5                	mov    %esp,%ebp
+  80092e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800931:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800935:	eb 03                	jmp    80093a <strchr+0xf>
+  800937:	83 c0 01             	add    $0x1,%eax
+  80093a:	0f b6 10             	movzbl (%eax),%edx
+  80093d:	84 d2                	test   %dl,%dl
+  80093f:	74 06                	je     800947 <strchr+0x1c>
+		if (*s == c)
+  800941:	38 ca                	cmp    %cl,%dl
+  800943:	75 f2                	jne    800937 <strchr+0xc>
+  800945:	eb 05                	jmp    80094c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800947:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80094c:	5d                   	pop    %ebp
+  80094d:	c3                   	ret
+
+0080094e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80094e:	55                   	push   %ebp
+  80094f:	89 e5                	mov    %esp,%ebp
+  800951:	8b 45 08             	mov    0x8(%ebp),%eax
+  800954:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800958:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80095b:	38 ca                	cmp    %cl,%dl
+  80095d:	74 09                	je     800968 <strfind+0x1a>
+  80095f:	84 d2                	test   %dl,%dl
+  800961:	74 05                	je     800968 <strfind+0x1a>
+	for (; *s; s++)
+  800963:	83 c0 01             	add    $0x1,%eax
+  800966:	eb f0                	jmp    800958 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800968:	5d                   	pop    %ebp
+  800969:	c3                   	ret
+
+0080096a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80096a:	55                   	push   %ebp
+  80096b:	89 e5                	mov    %esp,%ebp
+  80096d:	57                   	push   %edi
+  80096e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800971:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800974:	85 c9                	test   %ecx,%ecx
+  800976:	74 20                	je     800998 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800978:	89 f8                	mov    %edi,%eax
+  80097a:	09 c8                	or     %ecx,%eax
+  80097c:	a8 03                	test   $0x3,%al
+  80097e:	75 12                	jne    800992 <memset+0x28>
+		c &= 0xFF;
+  800980:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800984:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80098a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80098d:	fc                   	cld
+  80098e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800990:	eb 06                	jmp    800998 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800992:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800995:	fc                   	cld
+  800996:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800998:	89 f8                	mov    %edi,%eax
+  80099a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80099d:	c9                   	leave
+  80099e:	c3                   	ret
+
+0080099f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80099f:	55                   	push   %ebp
+  8009a0:	89 e5                	mov    %esp,%ebp
+  8009a2:	57                   	push   %edi
+  8009a3:	56                   	push   %esi
+  8009a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009aa:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009ad:	39 c6                	cmp    %eax,%esi
+  8009af:	73 32                	jae    8009e3 <memmove+0x44>
+  8009b1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009b4:	39 d0                	cmp    %edx,%eax
+  8009b6:	73 2b                	jae    8009e3 <memmove+0x44>
+		s += n;
+		d += n;
+  8009b8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009bb:	89 d6                	mov    %edx,%esi
+  8009bd:	09 fe                	or     %edi,%esi
+  8009bf:	09 ce                	or     %ecx,%esi
+  8009c1:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009c7:	75 0e                	jne    8009d7 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009c9:	83 ef 04             	sub    $0x4,%edi
+  8009cc:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009cf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009d2:	fd                   	std
+  8009d3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009d5:	eb 09                	jmp    8009e0 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009d7:	83 ef 01             	sub    $0x1,%edi
+  8009da:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009dd:	fd                   	std
+  8009de:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009e0:	fc                   	cld
+  8009e1:	eb 1a                	jmp    8009fd <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009e3:	89 f2                	mov    %esi,%edx
+  8009e5:	09 c2                	or     %eax,%edx
+  8009e7:	09 ca                	or     %ecx,%edx
+  8009e9:	f6 c2 03             	test   $0x3,%dl
+  8009ec:	75 0a                	jne    8009f8 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009ee:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009f1:	89 c7                	mov    %eax,%edi
+  8009f3:	fc                   	cld
+  8009f4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009f6:	eb 05                	jmp    8009fd <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009f8:	89 c7                	mov    %eax,%edi
+  8009fa:	fc                   	cld
+  8009fb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009fd:	5e                   	pop    %esi
+  8009fe:	5f                   	pop    %edi
+  8009ff:	5d                   	pop    %ebp
+  800a00:	c3                   	ret
+
+00800a01 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a01:	55                   	push   %ebp
+  800a02:	89 e5                	mov    %esp,%ebp
+  800a04:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a07:	ff 75 10             	push   0x10(%ebp)
+  800a0a:	ff 75 0c             	push   0xc(%ebp)
+  800a0d:	ff 75 08             	push   0x8(%ebp)
+  800a10:	e8 8a ff ff ff       	call   80099f <memmove>
+}
+  800a15:	c9                   	leave
+  800a16:	c3                   	ret
+
+00800a17 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a17:	55                   	push   %ebp
+  800a18:	89 e5                	mov    %esp,%ebp
+  800a1a:	56                   	push   %esi
+  800a1b:	53                   	push   %ebx
+  800a1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a22:	89 c6                	mov    %eax,%esi
+  800a24:	03 75 10             	add    0x10(%ebp),%esi
+  800a27:	eb 06                	jmp    800a2f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a29:	83 c0 01             	add    $0x1,%eax
+  800a2c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a2f:	39 f0                	cmp    %esi,%eax
+  800a31:	74 14                	je     800a47 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a33:	0f b6 08             	movzbl (%eax),%ecx
+  800a36:	0f b6 1a             	movzbl (%edx),%ebx
+  800a39:	38 d9                	cmp    %bl,%cl
+  800a3b:	74 ec                	je     800a29 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a3d:	0f b6 c1             	movzbl %cl,%eax
+  800a40:	0f b6 db             	movzbl %bl,%ebx
+  800a43:	29 d8                	sub    %ebx,%eax
+  800a45:	eb 05                	jmp    800a4c <memcmp+0x35>
+	}
+
+	return 0;
+  800a47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a4c:	5b                   	pop    %ebx
+  800a4d:	5e                   	pop    %esi
+  800a4e:	5d                   	pop    %ebp
+  800a4f:	c3                   	ret
+
+00800a50 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a50:	55                   	push   %ebp
+  800a51:	89 e5                	mov    %esp,%ebp
+  800a53:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a59:	89 c2                	mov    %eax,%edx
+  800a5b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a5e:	eb 03                	jmp    800a63 <memfind+0x13>
+  800a60:	83 c0 01             	add    $0x1,%eax
+  800a63:	39 d0                	cmp    %edx,%eax
+  800a65:	73 04                	jae    800a6b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a67:	38 08                	cmp    %cl,(%eax)
+  800a69:	75 f5                	jne    800a60 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a6b:	5d                   	pop    %ebp
+  800a6c:	c3                   	ret
+
+00800a6d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a6d:	55                   	push   %ebp
+  800a6e:	89 e5                	mov    %esp,%ebp
+  800a70:	57                   	push   %edi
+  800a71:	56                   	push   %esi
+  800a72:	53                   	push   %ebx
+  800a73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a76:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a79:	eb 03                	jmp    800a7e <strtol+0x11>
+		s++;
+  800a7b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a7e:	0f b6 02             	movzbl (%edx),%eax
+  800a81:	3c 20                	cmp    $0x20,%al
+  800a83:	74 f6                	je     800a7b <strtol+0xe>
+  800a85:	3c 09                	cmp    $0x9,%al
+  800a87:	74 f2                	je     800a7b <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a89:	3c 2b                	cmp    $0x2b,%al
+  800a8b:	74 2a                	je     800ab7 <strtol+0x4a>
+	int neg = 0;
+  800a8d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a92:	3c 2d                	cmp    $0x2d,%al
+  800a94:	74 2b                	je     800ac1 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a96:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a9c:	75 0f                	jne    800aad <strtol+0x40>
+  800a9e:	80 3a 30             	cmpb   $0x30,(%edx)
+  800aa1:	74 28                	je     800acb <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800aa3:	85 db                	test   %ebx,%ebx
+  800aa5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800aaa:	0f 44 d8             	cmove  %eax,%ebx
+  800aad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ab2:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ab5:	eb 46                	jmp    800afd <strtol+0x90>
+		s++;
+  800ab7:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800aba:	bf 00 00 00 00       	mov    $0x0,%edi
+  800abf:	eb d5                	jmp    800a96 <strtol+0x29>
+		s++, neg = 1;
+  800ac1:	83 c2 01             	add    $0x1,%edx
+  800ac4:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ac9:	eb cb                	jmp    800a96 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800acb:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800acf:	74 0e                	je     800adf <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ad1:	85 db                	test   %ebx,%ebx
+  800ad3:	75 d8                	jne    800aad <strtol+0x40>
+		s++, base = 8;
+  800ad5:	83 c2 01             	add    $0x1,%edx
+  800ad8:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800add:	eb ce                	jmp    800aad <strtol+0x40>
+		s += 2, base = 16;
+  800adf:	83 c2 02             	add    $0x2,%edx
+  800ae2:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ae7:	eb c4                	jmp    800aad <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ae9:	0f be c0             	movsbl %al,%eax
+  800aec:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800aef:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800af2:	7d 3a                	jge    800b2e <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800af4:	83 c2 01             	add    $0x1,%edx
+  800af7:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800afb:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800afd:	0f b6 02             	movzbl (%edx),%eax
+  800b00:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b03:	89 f3                	mov    %esi,%ebx
+  800b05:	80 fb 09             	cmp    $0x9,%bl
+  800b08:	76 df                	jbe    800ae9 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b0a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b0d:	89 f3                	mov    %esi,%ebx
+  800b0f:	80 fb 19             	cmp    $0x19,%bl
+  800b12:	77 08                	ja     800b1c <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b14:	0f be c0             	movsbl %al,%eax
+  800b17:	83 e8 57             	sub    $0x57,%eax
+  800b1a:	eb d3                	jmp    800aef <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b1c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b1f:	89 f3                	mov    %esi,%ebx
+  800b21:	80 fb 19             	cmp    $0x19,%bl
+  800b24:	77 08                	ja     800b2e <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b26:	0f be c0             	movsbl %al,%eax
+  800b29:	83 e8 37             	sub    $0x37,%eax
+  800b2c:	eb c1                	jmp    800aef <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b2e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b32:	74 05                	je     800b39 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b34:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b37:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b39:	89 c8                	mov    %ecx,%eax
+  800b3b:	f7 d8                	neg    %eax
+  800b3d:	85 ff                	test   %edi,%edi
+  800b3f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b42:	89 c8                	mov    %ecx,%eax
+  800b44:	5b                   	pop    %ebx
+  800b45:	5e                   	pop    %esi
+  800b46:	5f                   	pop    %edi
+  800b47:	5d                   	pop    %ebp
+  800b48:	c3                   	ret
+
+00800b49 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800b49:	55                   	push   %ebp
+  800b4a:	89 e5                	mov    %esp,%ebp
+  800b4c:	57                   	push   %edi
+  800b4d:	56                   	push   %esi
+  800b4e:	53                   	push   %ebx
+  800b4f:	83 ec 0c             	sub    $0xc,%esp
+  800b52:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b55:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b58:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800b5b:	85 ff                	test   %edi,%edi
+  800b5d:	74 16                	je     800b75 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800b5f:	83 ec 04             	sub    $0x4,%esp
+  800b62:	56                   	push   %esi
+  800b63:	6a 00                	push   $0x0
+  800b65:	53                   	push   %ebx
+  800b66:	e8 02 ff ff ff       	call   800a6d <strtol>
+  800b6b:	89 07                	mov    %eax,(%edi)
+  800b6d:	83 c4 10             	add    $0x10,%esp
+  800b70:	eb 03                	jmp    800b75 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800b72:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800b75:	0f b6 03             	movzbl (%ebx),%eax
+  800b78:	3c 20                	cmp    $0x20,%al
+  800b7a:	74 f6                	je     800b72 <strisl+0x29>
+  800b7c:	3c 09                	cmp    $0x9,%al
+  800b7e:	74 f2                	je     800b72 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b80:	3c 2b                	cmp    $0x2b,%al
+  800b82:	74 23                	je     800ba7 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800b84:	3c 2d                	cmp    $0x2d,%al
+  800b86:	0f 94 c0             	sete   %al
+  800b89:	0f b6 c0             	movzbl %al,%eax
+  800b8c:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b8e:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800b94:	75 41                	jne    800bd7 <strisl+0x8e>
+  800b96:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800b99:	74 11                	je     800bac <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b9b:	85 f6                	test   %esi,%esi
+  800b9d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ba2:	0f 44 f0             	cmove  %eax,%esi
+  800ba5:	eb 30                	jmp    800bd7 <strisl+0x8e>
+		s++;
+  800ba7:	83 c3 01             	add    $0x1,%ebx
+  800baa:	eb e2                	jmp    800b8e <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bac:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800bb0:	74 0e                	je     800bc0 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800bb2:	85 f6                	test   %esi,%esi
+  800bb4:	75 21                	jne    800bd7 <strisl+0x8e>
+		s++, base = 8;
+  800bb6:	83 c3 01             	add    $0x1,%ebx
+  800bb9:	be 08 00 00 00       	mov    $0x8,%esi
+  800bbe:	eb 17                	jmp    800bd7 <strisl+0x8e>
+		s += 2, base = 16;
+  800bc0:	83 c3 02             	add    $0x2,%ebx
+  800bc3:	be 10 00 00 00       	mov    $0x10,%esi
+  800bc8:	eb 0d                	jmp    800bd7 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bca:	0f be c0             	movsbl %al,%eax
+  800bcd:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800bd0:	39 f0                	cmp    %esi,%eax
+  800bd2:	7d 38                	jge    800c0c <strisl+0xc3>
+			return 0;
+		s++;
+  800bd4:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800bd7:	0f b6 03             	movzbl (%ebx),%eax
+  800bda:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800bdd:	80 fa 09             	cmp    $0x9,%dl
+  800be0:	76 e8                	jbe    800bca <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800be2:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800be5:	80 fa 19             	cmp    $0x19,%dl
+  800be8:	77 08                	ja     800bf2 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800bea:	0f be c0             	movsbl %al,%eax
+  800bed:	83 e8 57             	sub    $0x57,%eax
+  800bf0:	eb de                	jmp    800bd0 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bf2:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800bf5:	80 fa 19             	cmp    $0x19,%dl
+  800bf8:	77 08                	ja     800c02 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800bfa:	0f be c0             	movsbl %al,%eax
+  800bfd:	83 e8 37             	sub    $0x37,%eax
+  800c00:	eb ce                	jmp    800bd0 <strisl+0x87>
+		else if (!*s)
+  800c02:	84 c0                	test   %al,%al
+  800c04:	0f 94 c0             	sete   %al
+  800c07:	0f b6 c0             	movzbl %al,%eax
+  800c0a:	eb 05                	jmp    800c11 <strisl+0xc8>
+			return 0;
+  800c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800c11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c14:	5b                   	pop    %ebx
+  800c15:	5e                   	pop    %esi
+  800c16:	5f                   	pop    %edi
+  800c17:	5d                   	pop    %ebp
+  800c18:	c3                   	ret
+
+00800c19 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800c19:	55                   	push   %ebp
+  800c1a:	89 e5                	mov    %esp,%ebp
+  800c1c:	83 ec 10             	sub    $0x10,%esp
+  800c1f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c22:	89 c8                	mov    %ecx,%eax
+  800c24:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800c29:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800c2c:	eb 0b                	jmp    800c39 <touch_mem+0x20>
+		c = *(char *)page;
+  800c2e:	0f b6 10             	movzbl (%eax),%edx
+  800c31:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c34:	05 00 10 00 00       	add    $0x1000,%eax
+  800c39:	39 c8                	cmp    %ecx,%eax
+  800c3b:	72 f1                	jb     800c2e <touch_mem+0x15>
+}
+  800c3d:	c9                   	leave
+  800c3e:	c3                   	ret
+
+00800c3f <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c3f:	55                   	push   %ebp
+  800c40:	89 e5                	mov    %esp,%ebp
+  800c42:	57                   	push   %edi
+  800c43:	56                   	push   %esi
+  800c44:	53                   	push   %ebx
+	touch_mem(s, len);
+  800c45:	ff 75 0c             	push   0xc(%ebp)
+  800c48:	ff 75 08             	push   0x8(%ebp)
+  800c4b:	e8 c9 ff ff ff       	call   800c19 <touch_mem>
+	asm volatile("int %1\n"
+  800c50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c55:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5b:	89 c3                	mov    %eax,%ebx
+  800c5d:	89 c7                	mov    %eax,%edi
+  800c5f:	89 c6                	mov    %eax,%esi
+  800c61:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c63:	83 c4 08             	add    $0x8,%esp
+  800c66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c69:	5b                   	pop    %ebx
+  800c6a:	5e                   	pop    %esi
+  800c6b:	5f                   	pop    %edi
+  800c6c:	5d                   	pop    %ebp
+  800c6d:	c3                   	ret
+
+00800c6e <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c6e:	55                   	push   %ebp
+  800c6f:	89 e5                	mov    %esp,%ebp
+  800c71:	57                   	push   %edi
+  800c72:	56                   	push   %esi
+  800c73:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c74:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c79:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c7e:	89 d1                	mov    %edx,%ecx
+  800c80:	89 d3                	mov    %edx,%ebx
+  800c82:	89 d7                	mov    %edx,%edi
+  800c84:	89 d6                	mov    %edx,%esi
+  800c86:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c88:	5b                   	pop    %ebx
+  800c89:	5e                   	pop    %esi
+  800c8a:	5f                   	pop    %edi
+  800c8b:	5d                   	pop    %ebp
+  800c8c:	c3                   	ret
+
+00800c8d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c8d:	55                   	push   %ebp
+  800c8e:	89 e5                	mov    %esp,%ebp
+  800c90:	57                   	push   %edi
+  800c91:	56                   	push   %esi
+  800c92:	53                   	push   %ebx
+  800c93:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ca3:	89 cb                	mov    %ecx,%ebx
+  800ca5:	89 cf                	mov    %ecx,%edi
+  800ca7:	89 ce                	mov    %ecx,%esi
+  800ca9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cab:	85 c0                	test   %eax,%eax
+  800cad:	7f 08                	jg     800cb7 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800caf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb2:	5b                   	pop    %ebx
+  800cb3:	5e                   	pop    %esi
+  800cb4:	5f                   	pop    %edi
+  800cb5:	5d                   	pop    %ebp
+  800cb6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cb7:	83 ec 0c             	sub    $0xc,%esp
+  800cba:	50                   	push   %eax
+  800cbb:	6a 03                	push   $0x3
+  800cbd:	68 8b 56 80 00       	push   $0x80568b
+  800cc2:	6a 23                	push   $0x23
+  800cc4:	68 a8 56 80 00       	push   $0x8056a8
+  800cc9:	e8 89 f4 ff ff       	call   800157 <_panic>
+
+00800cce <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cce:	55                   	push   %ebp
+  800ccf:	89 e5                	mov    %esp,%ebp
+  800cd1:	57                   	push   %edi
+  800cd2:	56                   	push   %esi
+  800cd3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd9:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cde:	89 d1                	mov    %edx,%ecx
+  800ce0:	89 d3                	mov    %edx,%ebx
+  800ce2:	89 d7                	mov    %edx,%edi
+  800ce4:	89 d6                	mov    %edx,%esi
+  800ce6:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ce8:	5b                   	pop    %ebx
+  800ce9:	5e                   	pop    %esi
+  800cea:	5f                   	pop    %edi
+  800ceb:	5d                   	pop    %ebp
+  800cec:	c3                   	ret
+
+00800ced <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ced:	55                   	push   %ebp
+  800cee:	89 e5                	mov    %esp,%ebp
+  800cf0:	57                   	push   %edi
+  800cf1:	56                   	push   %esi
+  800cf2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cf3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cfd:	89 d1                	mov    %edx,%ecx
+  800cff:	89 d3                	mov    %edx,%ebx
+  800d01:	89 d7                	mov    %edx,%edi
+  800d03:	89 d6                	mov    %edx,%esi
+  800d05:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d07:	5b                   	pop    %ebx
+  800d08:	5e                   	pop    %esi
+  800d09:	5f                   	pop    %edi
+  800d0a:	5d                   	pop    %ebp
+  800d0b:	c3                   	ret
+
+00800d0c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d0c:	55                   	push   %ebp
+  800d0d:	89 e5                	mov    %esp,%ebp
+  800d0f:	57                   	push   %edi
+  800d10:	56                   	push   %esi
+  800d11:	53                   	push   %ebx
+  800d12:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d15:	be 00 00 00 00       	mov    $0x0,%esi
+  800d1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d20:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d28:	89 f7                	mov    %esi,%edi
+  800d2a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d2c:	85 c0                	test   %eax,%eax
+  800d2e:	7f 08                	jg     800d38 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d33:	5b                   	pop    %ebx
+  800d34:	5e                   	pop    %esi
+  800d35:	5f                   	pop    %edi
+  800d36:	5d                   	pop    %ebp
+  800d37:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d38:	83 ec 0c             	sub    $0xc,%esp
+  800d3b:	50                   	push   %eax
+  800d3c:	6a 04                	push   $0x4
+  800d3e:	68 8b 56 80 00       	push   $0x80568b
+  800d43:	6a 23                	push   $0x23
+  800d45:	68 a8 56 80 00       	push   $0x8056a8
+  800d4a:	e8 08 f4 ff ff       	call   800157 <_panic>
+
+00800d4f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d4f:	55                   	push   %ebp
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	57                   	push   %edi
+  800d53:	56                   	push   %esi
+  800d54:	53                   	push   %ebx
+  800d55:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d63:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d66:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d69:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d6c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d6e:	85 c0                	test   %eax,%eax
+  800d70:	7f 08                	jg     800d7a <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d75:	5b                   	pop    %ebx
+  800d76:	5e                   	pop    %esi
+  800d77:	5f                   	pop    %edi
+  800d78:	5d                   	pop    %ebp
+  800d79:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d7a:	83 ec 0c             	sub    $0xc,%esp
+  800d7d:	50                   	push   %eax
+  800d7e:	6a 05                	push   $0x5
+  800d80:	68 8b 56 80 00       	push   $0x80568b
+  800d85:	6a 23                	push   $0x23
+  800d87:	68 a8 56 80 00       	push   $0x8056a8
+  800d8c:	e8 c6 f3 ff ff       	call   800157 <_panic>
+
+00800d91 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d91:	55                   	push   %ebp
+  800d92:	89 e5                	mov    %esp,%ebp
+  800d94:	57                   	push   %edi
+  800d95:	56                   	push   %esi
+  800d96:	53                   	push   %ebx
+  800d97:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800daa:	89 df                	mov    %ebx,%edi
+  800dac:	89 de                	mov    %ebx,%esi
+  800dae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800db0:	85 c0                	test   %eax,%eax
+  800db2:	7f 08                	jg     800dbc <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800db4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db7:	5b                   	pop    %ebx
+  800db8:	5e                   	pop    %esi
+  800db9:	5f                   	pop    %edi
+  800dba:	5d                   	pop    %ebp
+  800dbb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dbc:	83 ec 0c             	sub    $0xc,%esp
+  800dbf:	50                   	push   %eax
+  800dc0:	6a 06                	push   $0x6
+  800dc2:	68 8b 56 80 00       	push   $0x80568b
+  800dc7:	6a 23                	push   $0x23
+  800dc9:	68 a8 56 80 00       	push   $0x8056a8
+  800dce:	e8 84 f3 ff ff       	call   800157 <_panic>
+
+00800dd3 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800dd3:	55                   	push   %ebp
+  800dd4:	89 e5                	mov    %esp,%ebp
+  800dd6:	57                   	push   %edi
+  800dd7:	56                   	push   %esi
+  800dd8:	53                   	push   %ebx
+  800dd9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ddc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800de1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de7:	b8 18 00 00 00       	mov    $0x18,%eax
+  800dec:	89 df                	mov    %ebx,%edi
+  800dee:	89 de                	mov    %ebx,%esi
+  800df0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800df2:	85 c0                	test   %eax,%eax
+  800df4:	7f 08                	jg     800dfe <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800df6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df9:	5b                   	pop    %ebx
+  800dfa:	5e                   	pop    %esi
+  800dfb:	5f                   	pop    %edi
+  800dfc:	5d                   	pop    %ebp
+  800dfd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dfe:	83 ec 0c             	sub    $0xc,%esp
+  800e01:	50                   	push   %eax
+  800e02:	6a 18                	push   $0x18
+  800e04:	68 8b 56 80 00       	push   $0x80568b
+  800e09:	6a 23                	push   $0x23
+  800e0b:	68 a8 56 80 00       	push   $0x8056a8
+  800e10:	e8 42 f3 ff ff       	call   800157 <_panic>
+
+00800e15 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800e15:	55                   	push   %ebp
+  800e16:	89 e5                	mov    %esp,%ebp
+  800e18:	57                   	push   %edi
+  800e19:	56                   	push   %esi
+  800e1a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e1b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e26:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e2e:	89 f7                	mov    %esi,%edi
+  800e30:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800e32:	5b                   	pop    %ebx
+  800e33:	5e                   	pop    %esi
+  800e34:	5f                   	pop    %edi
+  800e35:	5d                   	pop    %ebp
+  800e36:	c3                   	ret
+
+00800e37 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800e37:	55                   	push   %ebp
+  800e38:	89 e5                	mov    %esp,%ebp
+  800e3a:	57                   	push   %edi
+  800e3b:	56                   	push   %esi
+  800e3c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e43:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e48:	be 00 00 00 00       	mov    $0x0,%esi
+  800e4d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e50:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e53:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e55:	5b                   	pop    %ebx
+  800e56:	5e                   	pop    %esi
+  800e57:	5f                   	pop    %edi
+  800e58:	5d                   	pop    %ebp
+  800e59:	c3                   	ret
+
+00800e5a <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e5a:	55                   	push   %ebp
+  800e5b:	89 e5                	mov    %esp,%ebp
+  800e5d:	57                   	push   %edi
+  800e5e:	56                   	push   %esi
+  800e5f:	53                   	push   %ebx
+  800e60:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800e63:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800e66:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800e6c:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800e6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e75:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e7d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e80:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e82:	85 c0                	test   %eax,%eax
+  800e84:	7f 08                	jg     800e8e <sys_page_map_range+0x34>
+}
+  800e86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e89:	5b                   	pop    %ebx
+  800e8a:	5e                   	pop    %esi
+  800e8b:	5f                   	pop    %edi
+  800e8c:	5d                   	pop    %ebp
+  800e8d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8e:	83 ec 0c             	sub    $0xc,%esp
+  800e91:	50                   	push   %eax
+  800e92:	6a 10                	push   $0x10
+  800e94:	68 8b 56 80 00       	push   $0x80568b
+  800e99:	6a 23                	push   $0x23
+  800e9b:	68 a8 56 80 00       	push   $0x8056a8
+  800ea0:	e8 b2 f2 ff ff       	call   800157 <_panic>
+
+00800ea5 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800ea5:	55                   	push   %ebp
+  800ea6:	89 e5                	mov    %esp,%ebp
+  800ea8:	57                   	push   %edi
+  800ea9:	56                   	push   %esi
+  800eaa:	53                   	push   %ebx
+  800eab:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eae:	be 00 00 00 00       	mov    $0x0,%esi
+  800eb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb9:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ebe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec1:	89 f7                	mov    %esi,%edi
+  800ec3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec5:	85 c0                	test   %eax,%eax
+  800ec7:	7f 08                	jg     800ed1 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ec9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecc:	5b                   	pop    %ebx
+  800ecd:	5e                   	pop    %esi
+  800ece:	5f                   	pop    %edi
+  800ecf:	5d                   	pop    %ebp
+  800ed0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed1:	83 ec 0c             	sub    $0xc,%esp
+  800ed4:	50                   	push   %eax
+  800ed5:	6a 11                	push   $0x11
+  800ed7:	68 8b 56 80 00       	push   $0x80568b
+  800edc:	6a 23                	push   $0x23
+  800ede:	68 a8 56 80 00       	push   $0x8056a8
+  800ee3:	e8 6f f2 ff ff       	call   800157 <_panic>
+
+00800ee8 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800ee8:	55                   	push   %ebp
+  800ee9:	89 e5                	mov    %esp,%ebp
+  800eeb:	57                   	push   %edi
+  800eec:	56                   	push   %esi
+  800eed:	53                   	push   %ebx
+  800eee:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ef1:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efc:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800f01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f04:	89 f7                	mov    %esi,%edi
+  800f06:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f08:	85 c0                	test   %eax,%eax
+  800f0a:	7f 08                	jg     800f14 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0f:	5b                   	pop    %ebx
+  800f10:	5e                   	pop    %esi
+  800f11:	5f                   	pop    %edi
+  800f12:	5d                   	pop    %ebp
+  800f13:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f14:	83 ec 0c             	sub    $0xc,%esp
+  800f17:	50                   	push   %eax
+  800f18:	6a 1b                	push   $0x1b
+  800f1a:	68 8b 56 80 00       	push   $0x80568b
+  800f1f:	6a 23                	push   $0x23
+  800f21:	68 a8 56 80 00       	push   $0x8056a8
+  800f26:	e8 2c f2 ff ff       	call   800157 <_panic>
+
+00800f2b <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	57                   	push   %edi
+  800f2f:	56                   	push   %esi
+  800f30:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f36:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f3b:	89 d1                	mov    %edx,%ecx
+  800f3d:	89 d3                	mov    %edx,%ebx
+  800f3f:	89 d7                	mov    %edx,%edi
+  800f41:	89 d6                	mov    %edx,%esi
+  800f43:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f45:	5b                   	pop    %ebx
+  800f46:	5e                   	pop    %esi
+  800f47:	5f                   	pop    %edi
+  800f48:	5d                   	pop    %ebp
+  800f49:	c3                   	ret
+
+00800f4a <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f4a:	55                   	push   %ebp
+  800f4b:	89 e5                	mov    %esp,%ebp
+  800f4d:	57                   	push   %edi
+  800f4e:	56                   	push   %esi
+  800f4f:	53                   	push   %ebx
+  800f50:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f63:	89 df                	mov    %ebx,%edi
+  800f65:	89 de                	mov    %ebx,%esi
+  800f67:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f69:	85 c0                	test   %eax,%eax
+  800f6b:	7f 08                	jg     800f75 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f70:	5b                   	pop    %ebx
+  800f71:	5e                   	pop    %esi
+  800f72:	5f                   	pop    %edi
+  800f73:	5d                   	pop    %ebp
+  800f74:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f75:	83 ec 0c             	sub    $0xc,%esp
+  800f78:	50                   	push   %eax
+  800f79:	6a 08                	push   $0x8
+  800f7b:	68 8b 56 80 00       	push   $0x80568b
+  800f80:	6a 23                	push   $0x23
+  800f82:	68 a8 56 80 00       	push   $0x8056a8
+  800f87:	e8 cb f1 ff ff       	call   800157 <_panic>
+
+00800f8c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	57                   	push   %edi
+  800f90:	56                   	push   %esi
+  800f91:	53                   	push   %ebx
+  800f92:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800f95:	6a 44                	push   $0x44
+  800f97:	ff 75 0c             	push   0xc(%ebp)
+  800f9a:	e8 7a fc ff ff       	call   800c19 <touch_mem>
+	asm volatile("int %1\n"
+  800f9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa7:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faf:	89 df                	mov    %ebx,%edi
+  800fb1:	89 de                	mov    %ebx,%esi
+  800fb3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb5:	83 c4 08             	add    $0x8,%esp
+  800fb8:	85 c0                	test   %eax,%eax
+  800fba:	7f 08                	jg     800fc4 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbf:	5b                   	pop    %ebx
+  800fc0:	5e                   	pop    %esi
+  800fc1:	5f                   	pop    %edi
+  800fc2:	5d                   	pop    %ebp
+  800fc3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc4:	83 ec 0c             	sub    $0xc,%esp
+  800fc7:	50                   	push   %eax
+  800fc8:	6a 09                	push   $0x9
+  800fca:	68 8b 56 80 00       	push   $0x80568b
+  800fcf:	6a 23                	push   $0x23
+  800fd1:	68 a8 56 80 00       	push   $0x8056a8
+  800fd6:	e8 7c f1 ff ff       	call   800157 <_panic>
+
+00800fdb <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800fdb:	55                   	push   %ebp
+  800fdc:	89 e5                	mov    %esp,%ebp
+  800fde:	57                   	push   %edi
+  800fdf:	56                   	push   %esi
+  800fe0:	53                   	push   %ebx
+  800fe1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fe4:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fef:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800ff4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff7:	89 f7                	mov    %esi,%edi
+  800ff9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ffb:	85 c0                	test   %eax,%eax
+  800ffd:	7f 08                	jg     801007 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800fff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801002:	5b                   	pop    %ebx
+  801003:	5e                   	pop    %esi
+  801004:	5f                   	pop    %edi
+  801005:	5d                   	pop    %ebp
+  801006:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801007:	83 ec 0c             	sub    $0xc,%esp
+  80100a:	50                   	push   %eax
+  80100b:	6a 1a                	push   $0x1a
+  80100d:	68 8b 56 80 00       	push   $0x80568b
+  801012:	6a 23                	push   $0x23
+  801014:	68 a8 56 80 00       	push   $0x8056a8
+  801019:	e8 39 f1 ff ff       	call   800157 <_panic>
+
+0080101e <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  80101e:	55                   	push   %ebp
+  80101f:	89 e5                	mov    %esp,%ebp
+  801021:	57                   	push   %edi
+  801022:	56                   	push   %esi
+  801023:	53                   	push   %ebx
+  801024:	83 ec 0c             	sub    $0xc,%esp
+  801027:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  80102a:	89 d8                	mov    %ebx,%eax
+  80102c:	c1 e0 05             	shl    $0x5,%eax
+  80102f:	50                   	push   %eax
+  801030:	ff 75 0c             	push   0xc(%ebp)
+  801033:	e8 e1 fb ff ff       	call   800c19 <touch_mem>
+	asm volatile("int %1\n"
+  801038:	be 00 00 00 00       	mov    $0x0,%esi
+  80103d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801040:	b8 13 00 00 00       	mov    $0x13,%eax
+  801045:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801048:	89 f7                	mov    %esi,%edi
+  80104a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80104c:	83 c4 08             	add    $0x8,%esp
+  80104f:	85 c0                	test   %eax,%eax
+  801051:	7f 08                	jg     80105b <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  801053:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801056:	5b                   	pop    %ebx
+  801057:	5e                   	pop    %esi
+  801058:	5f                   	pop    %edi
+  801059:	5d                   	pop    %ebp
+  80105a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105b:	83 ec 0c             	sub    $0xc,%esp
+  80105e:	50                   	push   %eax
+  80105f:	6a 13                	push   $0x13
+  801061:	68 8b 56 80 00       	push   $0x80568b
+  801066:	6a 23                	push   $0x23
+  801068:	68 a8 56 80 00       	push   $0x8056a8
+  80106d:	e8 e5 f0 ff ff       	call   800157 <_panic>
+
+00801072 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801072:	55                   	push   %ebp
+  801073:	89 e5                	mov    %esp,%ebp
+  801075:	57                   	push   %edi
+  801076:	56                   	push   %esi
+  801077:	53                   	push   %ebx
+  801078:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80107b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801080:	8b 55 08             	mov    0x8(%ebp),%edx
+  801083:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801086:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80108b:	89 df                	mov    %ebx,%edi
+  80108d:	89 de                	mov    %ebx,%esi
+  80108f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801091:	85 c0                	test   %eax,%eax
+  801093:	7f 08                	jg     80109d <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801095:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801098:	5b                   	pop    %ebx
+  801099:	5e                   	pop    %esi
+  80109a:	5f                   	pop    %edi
+  80109b:	5d                   	pop    %ebp
+  80109c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109d:	83 ec 0c             	sub    $0xc,%esp
+  8010a0:	50                   	push   %eax
+  8010a1:	6a 0a                	push   $0xa
+  8010a3:	68 8b 56 80 00       	push   $0x80568b
+  8010a8:	6a 23                	push   $0x23
+  8010aa:	68 a8 56 80 00       	push   $0x8056a8
+  8010af:	e8 a3 f0 ff ff       	call   800157 <_panic>
+
+008010b4 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010b4:	55                   	push   %ebp
+  8010b5:	89 e5                	mov    %esp,%ebp
+  8010b7:	57                   	push   %edi
+  8010b8:	56                   	push   %esi
+  8010b9:	53                   	push   %ebx
+  8010ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  8010bd:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010c3:	76 1d                	jbe    8010e2 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  8010c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010d0:	be 01 00 00 00       	mov    $0x1,%esi
+  8010d5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010d8:	cd 30                	int    $0x30
+}
+  8010da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010dd:	5b                   	pop    %ebx
+  8010de:	5e                   	pop    %esi
+  8010df:	5f                   	pop    %edi
+  8010e0:	5d                   	pop    %ebp
+  8010e1:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8010e2:	68 00 10 00 00       	push   $0x1000
+  8010e7:	53                   	push   %ebx
+  8010e8:	e8 2c fb ff ff       	call   800c19 <touch_mem>
+  8010ed:	83 c4 08             	add    $0x8,%esp
+  8010f0:	eb d3                	jmp    8010c5 <sys_ipc_send+0x11>
+
+008010f2 <sys_ipc_send_pages>:
+{
+  8010f2:	55                   	push   %ebp
+  8010f3:	89 e5                	mov    %esp,%ebp
+  8010f5:	57                   	push   %edi
+  8010f6:	56                   	push   %esi
+  8010f7:	53                   	push   %ebx
+  8010f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010fb:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8010fe:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801104:	76 18                	jbe    80111e <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  801106:	8b 55 08             	mov    0x8(%ebp),%edx
+  801109:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801111:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801114:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  801116:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801119:	5b                   	pop    %ebx
+  80111a:	5e                   	pop    %esi
+  80111b:	5f                   	pop    %edi
+  80111c:	5d                   	pop    %ebp
+  80111d:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80111e:	89 f0                	mov    %esi,%eax
+  801120:	c1 e0 0c             	shl    $0xc,%eax
+  801123:	50                   	push   %eax
+  801124:	53                   	push   %ebx
+  801125:	e8 ef fa ff ff       	call   800c19 <touch_mem>
+  80112a:	83 c4 08             	add    $0x8,%esp
+  80112d:	eb d7                	jmp    801106 <sys_ipc_send_pages+0x14>
+
+0080112f <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  80112f:	55                   	push   %ebp
+  801130:	89 e5                	mov    %esp,%ebp
+  801132:	57                   	push   %edi
+  801133:	56                   	push   %esi
+  801134:	53                   	push   %ebx
+  801135:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801138:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801140:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801143:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801148:	89 df                	mov    %ebx,%edi
+  80114a:	89 de                	mov    %ebx,%esi
+  80114c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80114e:	85 c0                	test   %eax,%eax
+  801150:	7f 08                	jg     80115a <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801152:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801155:	5b                   	pop    %ebx
+  801156:	5e                   	pop    %esi
+  801157:	5f                   	pop    %edi
+  801158:	5d                   	pop    %ebp
+  801159:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80115a:	83 ec 0c             	sub    $0xc,%esp
+  80115d:	50                   	push   %eax
+  80115e:	6a 0d                	push   $0xd
+  801160:	68 8b 56 80 00       	push   $0x80568b
+  801165:	6a 23                	push   $0x23
+  801167:	68 a8 56 80 00       	push   $0x8056a8
+  80116c:	e8 e6 ef ff ff       	call   800157 <_panic>
+
+00801171 <sys_ipc_recv>:
+{
+  801171:	55                   	push   %ebp
+  801172:	89 e5                	mov    %esp,%ebp
+  801174:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801177:	6a 01                	push   $0x1
+  801179:	ff 75 08             	push   0x8(%ebp)
+  80117c:	e8 ae ff ff ff       	call   80112f <sys_ipc_recv_pages>
+}
+  801181:	c9                   	leave
+  801182:	c3                   	ret
+
+00801183 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801183:	55                   	push   %ebp
+  801184:	89 e5                	mov    %esp,%ebp
+  801186:	57                   	push   %edi
+  801187:	56                   	push   %esi
+  801188:	53                   	push   %ebx
+  801189:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80118c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80118f:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801192:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801198:	77 04                	ja     80119e <sys_ipc_call+0x1b>
+  80119a:	85 f6                	test   %esi,%esi
+  80119c:	75 15                	jne    8011b3 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  80119e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a4:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011a9:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8011ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ae:	5b                   	pop    %ebx
+  8011af:	5e                   	pop    %esi
+  8011b0:	5f                   	pop    %edi
+  8011b1:	5d                   	pop    %ebp
+  8011b2:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8011b3:	89 f8                	mov    %edi,%eax
+  8011b5:	c1 e0 0c             	shl    $0xc,%eax
+  8011b8:	50                   	push   %eax
+  8011b9:	53                   	push   %ebx
+  8011ba:	e8 5a fa ff ff       	call   800c19 <touch_mem>
+  8011bf:	83 c4 08             	add    $0x8,%esp
+  8011c2:	eb da                	jmp    80119e <sys_ipc_call+0x1b>
+
+008011c4 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8011c4:	55                   	push   %ebp
+  8011c5:	89 e5                	mov    %esp,%ebp
+  8011c7:	57                   	push   %edi
+  8011c8:	56                   	push   %esi
+  8011c9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d0:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011d5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011db:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011de:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8011e0:	5b                   	pop    %ebx
+  8011e1:	5e                   	pop    %esi
+  8011e2:	5f                   	pop    %edi
+  8011e3:	5d                   	pop    %ebp
+  8011e4:	c3                   	ret
+
+008011e5 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8011e5:	55                   	push   %ebp
+  8011e6:	89 e5                	mov    %esp,%ebp
+  8011e8:	57                   	push   %edi
+  8011e9:	56                   	push   %esi
+  8011ea:	53                   	push   %ebx
+  8011eb:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8011ee:	6a 04                	push   $0x4
+  8011f0:	ff 75 08             	push   0x8(%ebp)
+  8011f3:	e8 21 fa ff ff       	call   800c19 <touch_mem>
+	asm volatile("int %1\n"
+  8011f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801200:	b8 16 00 00 00       	mov    $0x16,%eax
+  801205:	8b 55 08             	mov    0x8(%ebp),%edx
+  801208:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80120b:	89 f7                	mov    %esi,%edi
+  80120d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80120f:	83 c4 08             	add    $0x8,%esp
+  801212:	85 c0                	test   %eax,%eax
+  801214:	7f 08                	jg     80121e <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  801216:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801219:	5b                   	pop    %ebx
+  80121a:	5e                   	pop    %esi
+  80121b:	5f                   	pop    %edi
+  80121c:	5d                   	pop    %ebp
+  80121d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80121e:	83 ec 0c             	sub    $0xc,%esp
+  801221:	50                   	push   %eax
+  801222:	6a 16                	push   $0x16
+  801224:	68 8b 56 80 00       	push   $0x80568b
+  801229:	6a 23                	push   $0x23
+  80122b:	68 a8 56 80 00       	push   $0x8056a8
+  801230:	e8 22 ef ff ff       	call   800157 <_panic>
+
+00801235 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801235:	55                   	push   %ebp
+  801236:	89 e5                	mov    %esp,%ebp
+  801238:	57                   	push   %edi
+  801239:	56                   	push   %esi
+  80123a:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  80123b:	6a 04                	push   $0x4
+  80123d:	ff 75 08             	push   0x8(%ebp)
+  801240:	e8 d4 f9 ff ff       	call   800c19 <touch_mem>
+	asm volatile("int %1\n"
+  801245:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124d:	b8 17 00 00 00       	mov    $0x17,%eax
+  801252:	8b 55 08             	mov    0x8(%ebp),%edx
+  801255:	89 df                	mov    %ebx,%edi
+  801257:	89 de                	mov    %ebx,%esi
+  801259:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80125b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125e:	5b                   	pop    %ebx
+  80125f:	5e                   	pop    %esi
+  801260:	5f                   	pop    %edi
+  801261:	5d                   	pop    %ebp
+  801262:	c3                   	ret
+
+00801263 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  801263:	55                   	push   %ebp
+  801264:	89 e5                	mov    %esp,%ebp
+  801266:	57                   	push   %edi
+  801267:	56                   	push   %esi
+  801268:	53                   	push   %ebx
+  801269:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80126c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801271:	8b 55 08             	mov    0x8(%ebp),%edx
+  801274:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801279:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80127e:	89 df                	mov    %ebx,%edi
+  801280:	89 de                	mov    %ebx,%esi
+  801282:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801284:	85 c0                	test   %eax,%eax
+  801286:	7f 08                	jg     801290 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801288:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80128b:	5b                   	pop    %ebx
+  80128c:	5e                   	pop    %esi
+  80128d:	5f                   	pop    %edi
+  80128e:	5d                   	pop    %ebp
+  80128f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801290:	83 ec 0c             	sub    $0xc,%esp
+  801293:	50                   	push   %eax
+  801294:	6a 0e                	push   $0xe
+  801296:	68 8b 56 80 00       	push   $0x80568b
+  80129b:	6a 23                	push   $0x23
+  80129d:	68 a8 56 80 00       	push   $0x8056a8
+  8012a2:	e8 b0 ee ff ff       	call   800157 <_panic>
+
+008012a7 <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  8012a7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012ae:	f6 c6 06             	test   $0x6,%dh
+  8012b1:	75 37                	jne    8012ea <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  8012b3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012ba:	f6 c2 02             	test   $0x2,%dl
+  8012bd:	75 19                	jne    8012d8 <dupperm+0x31>
+  8012bf:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012c6:	f6 c6 08             	test   $0x8,%dh
+  8012c9:	75 0d                	jne    8012d8 <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  8012cb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012d2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012d7:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  8012d8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012df:	25 00 06 00 00       	and    $0x600,%eax
+  8012e4:	0d 05 08 00 00       	or     $0x805,%eax
+  8012e9:	c3                   	ret
+		return 0;
+  8012ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012ef:	c3                   	ret
+
+008012f0 <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  8012f0:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  8012f2:	c1 e0 0c             	shl    $0xc,%eax
+  8012f5:	c1 e8 16             	shr    $0x16,%eax
+  8012f8:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8012ff:	f6 c1 01             	test   $0x1,%cl
+  801302:	74 2c                	je     801330 <dupable+0x40>
+  801304:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  80130b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801310:	f6 c1 04             	test   $0x4,%cl
+  801313:	74 20                	je     801335 <dupable+0x45>
+  801315:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80131c:	f6 c1 01             	test   $0x1,%cl
+  80131f:	74 14                	je     801335 <dupable+0x45>
+  801321:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801328:	c1 e8 02             	shr    $0x2,%eax
+  80132b:	83 e0 01             	and    $0x1,%eax
+  80132e:	eb 05                	jmp    801335 <dupable+0x45>
+  801330:	b8 00 00 00 00       	mov    $0x0,%eax
+  801335:	83 e0 01             	and    $0x1,%eax
+}
+  801338:	c3                   	ret
+
+00801339 <pgfault>:
+{
+  801339:	55                   	push   %ebp
+  80133a:	89 e5                	mov    %esp,%ebp
+  80133c:	56                   	push   %esi
+  80133d:	53                   	push   %ebx
+  80133e:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801341:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  801343:	89 ca                	mov    %ecx,%edx
+  801345:	c1 ea 0c             	shr    $0xc,%edx
+  801348:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  80134f:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801353:	0f 84 8e 00 00 00    	je     8013e7 <pgfault+0xae>
+		return 0;
+  801359:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  80135e:	f6 c6 08             	test   $0x8,%dh
+  801361:	0f 84 85 00 00 00    	je     8013ec <pgfault+0xb3>
+	perm |= PTE_W;
+  801367:	81 e2 07 06 00 00    	and    $0x607,%edx
+  80136d:	89 d3                	mov    %edx,%ebx
+  80136f:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801372:	89 ce                	mov    %ecx,%esi
+  801374:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  80137a:	6a 01                	push   $0x1
+  80137c:	53                   	push   %ebx
+  80137d:	68 00 f0 7f 00       	push   $0x7ff000
+  801382:	6a 00                	push   $0x0
+  801384:	e8 bb 29 00 00       	call   803d44 <page_alloc>
+  801389:	83 c4 10             	add    $0x10,%esp
+  80138c:	85 c0                	test   %eax,%eax
+  80138e:	78 33                	js     8013c3 <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  801390:	83 ec 04             	sub    $0x4,%esp
+  801393:	68 00 10 00 00       	push   $0x1000
+  801398:	56                   	push   %esi
+  801399:	68 00 f0 7f 00       	push   $0x7ff000
+  80139e:	e8 fc f5 ff ff       	call   80099f <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  8013a3:	89 1c 24             	mov    %ebx,(%esp)
+  8013a6:	56                   	push   %esi
+  8013a7:	6a 00                	push   $0x0
+  8013a9:	68 00 f0 7f 00       	push   $0x7ff000
+  8013ae:	6a 00                	push   $0x0
+  8013b0:	e8 f0 2f 00 00       	call   8043a5 <page_map>
+  8013b5:	83 c4 20             	add    $0x20,%esp
+  8013b8:	85 c0                	test   %eax,%eax
+  8013ba:	78 19                	js     8013d5 <pgfault+0x9c>
+	return 1;
+  8013bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013c1:	eb 29                	jmp    8013ec <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  8013c3:	50                   	push   %eax
+  8013c4:	68 b8 56 80 00       	push   $0x8056b8
+  8013c9:	6a 2e                	push   $0x2e
+  8013cb:	68 0b 57 80 00       	push   $0x80570b
+  8013d0:	e8 82 ed ff ff       	call   800157 <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  8013d5:	50                   	push   %eax
+  8013d6:	68 e4 56 80 00       	push   $0x8056e4
+  8013db:	6a 32                	push   $0x32
+  8013dd:	68 0b 57 80 00       	push   $0x80570b
+  8013e2:	e8 70 ed ff ff       	call   800157 <_panic>
+		return 0;
+  8013e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013ef:	5b                   	pop    %ebx
+  8013f0:	5e                   	pop    %esi
+  8013f1:	5d                   	pop    %ebp
+  8013f2:	c3                   	ret
+
+008013f3 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8013f3:	55                   	push   %ebp
+  8013f4:	89 e5                	mov    %esp,%ebp
+  8013f6:	57                   	push   %edi
+  8013f7:	56                   	push   %esi
+  8013f8:	53                   	push   %ebx
+  8013f9:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  8013fc:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  801403:	74 5d                	je     801462 <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  801405:	83 ec 0c             	sub    $0xc,%esp
+  801408:	68 39 13 80 00       	push   $0x801339
+  80140d:	e8 f4 3b 00 00       	call   805006 <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  801412:	e8 14 fb ff ff       	call   800f2b <sys_fork>
+  801417:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80141a:	83 c4 10             	add    $0x10,%esp
+  80141d:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  801420:	74 47                	je     801469 <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  801422:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801426:	0f 84 c5 03 00 00    	je     8017f1 <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  80142c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801430:	78 25                	js     801457 <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  801432:	e8 85 22 00 00       	call   8036bc <page_share_paged_out>
+  801437:	85 c0                	test   %eax,%eax
+  801439:	0f 88 d8 03 00 00    	js     801817 <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  80143f:	83 ec 08             	sub    $0x8,%esp
+  801442:	6a 02                	push   $0x2
+  801444:	ff 75 e4             	push   -0x1c(%ebp)
+  801447:	e8 fe fa ff ff       	call   800f4a <sys_env_set_status>
+  80144c:	83 c4 10             	add    $0x10,%esp
+  80144f:	85 c0                	test   %eax,%eax
+  801451:	0f 88 d5 03 00 00    	js     80182c <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  801457:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80145a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80145d:	5b                   	pop    %ebx
+  80145e:	5e                   	pop    %esi
+  80145f:	5f                   	pop    %edi
+  801460:	5d                   	pop    %ebp
+  801461:	c3                   	ret
+		init_map_dir();
+  801462:	e8 5d 25 00 00       	call   8039c4 <init_map_dir>
+  801467:	eb 9c                	jmp    801405 <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801469:	b8 07 00 00 00       	mov    $0x7,%eax
+  80146e:	cd 30                	int    $0x30
+  801470:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  801473:	85 c0                	test   %eax,%eax
+  801475:	78 10                	js     801487 <fork+0x94>
+	if (envid == 0)
+  801477:	0f 84 74 03 00 00    	je     8017f1 <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  80147d:	be 00 00 00 00       	mov    $0x0,%esi
+  801482:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801485:	eb 30                	jmp    8014b7 <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  801487:	50                   	push   %eax
+  801488:	68 16 57 80 00       	push   $0x805716
+  80148d:	68 cd 00 00 00       	push   $0xcd
+  801492:	68 0b 57 80 00       	push   $0x80570b
+  801497:	e8 bb ec ff ff       	call   800157 <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  80149c:	89 f2                	mov    %esi,%edx
+  80149e:	c1 fa 1f             	sar    $0x1f,%edx
+  8014a1:	c1 ea 16             	shr    $0x16,%edx
+  8014a4:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8014a7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014ac:	29 d0                	sub    %edx,%eax
+  8014ae:	ba 00 04 00 00       	mov    $0x400,%edx
+  8014b3:	29 c2                	sub    %eax,%edx
+  8014b5:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  8014b7:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8014ba:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  8014c0:	0f 87 ff 02 00 00    	ja     8017c5 <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  8014c6:	89 f3                	mov    %esi,%ebx
+  8014c8:	c1 e3 0c             	shl    $0xc,%ebx
+  8014cb:	89 d8                	mov    %ebx,%eax
+  8014cd:	c1 e8 16             	shr    $0x16,%eax
+  8014d0:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8014d7:	f6 c2 01             	test   $0x1,%dl
+  8014da:	74 c0                	je     80149c <fork+0xa9>
+  8014dc:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8014e3:	f6 c2 04             	test   $0x4,%dl
+  8014e6:	74 b4                	je     80149c <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  8014e8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014ef:	a8 80                	test   $0x80,%al
+  8014f1:	75 24                	jne    801517 <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  8014f3:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8014fa:	25 81 00 00 00       	and    $0x81,%eax
+  8014ff:	3d 80 00 00 00       	cmp    $0x80,%eax
+  801504:	74 21                	je     801527 <fork+0x134>
+		if (!dupable(pn)) {
+  801506:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801509:	e8 e2 fd ff ff       	call   8012f0 <dupable>
+  80150e:	84 c0                	test   %al,%al
+  801510:	75 1a                	jne    80152c <fork+0x139>
+			++pn;
+  801512:	83 c6 01             	add    $0x1,%esi
+			continue;
+  801515:	eb a0                	jmp    8014b7 <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  801517:	83 ec 08             	sub    $0x8,%esp
+  80151a:	53                   	push   %ebx
+  80151b:	6a 00                	push   $0x0
+  80151d:	e8 b1 f8 ff ff       	call   800dd3 <sys_page_split>
+  801522:	83 c4 10             	add    $0x10,%esp
+  801525:	eb cc                	jmp    8014f3 <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  801527:	0f b6 03             	movzbl (%ebx),%eax
+  80152a:	eb da                	jmp    801506 <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  80152c:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80152f:	89 f8                	mov    %edi,%eax
+  801531:	e8 71 fd ff ff       	call   8012a7 <dupperm>
+  801536:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801539:	85 c0                	test   %eax,%eax
+  80153b:	74 16                	je     801553 <fork+0x160>
+  80153d:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  801542:	29 f8                	sub    %edi,%eax
+  801544:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801547:	bf 01 00 00 00       	mov    $0x1,%edi
+  80154c:	89 c6                	mov    %eax,%esi
+  80154e:	e9 c4 01 00 00       	jmp    801717 <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  801553:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801556:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80155d:	f6 c4 04             	test   $0x4,%ah
+  801560:	0f 85 89 00 00 00    	jne    8015ef <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  801566:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801569:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801570:	f6 c4 02             	test   $0x2,%ah
+  801573:	0f 85 b1 00 00 00    	jne    80162a <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  801579:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80157c:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801583:	a8 02                	test   $0x2,%al
+  801585:	75 10                	jne    801597 <fork+0x1a4>
+  801587:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80158e:	f6 c4 08             	test   $0x8,%ah
+  801591:	0f 84 3e 01 00 00    	je     8016d5 <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801597:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80159a:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8015a1:	25 00 06 00 00       	and    $0x600,%eax
+  8015a6:	0d 05 08 00 00       	or     $0x805,%eax
+  8015ab:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  8015ad:	c1 e1 0c             	shl    $0xc,%ecx
+  8015b0:	89 cb                	mov    %ecx,%ebx
+  8015b2:	83 ec 0c             	sub    $0xc,%esp
+  8015b5:	50                   	push   %eax
+  8015b6:	51                   	push   %ecx
+  8015b7:	ff 75 e4             	push   -0x1c(%ebp)
+  8015ba:	51                   	push   %ecx
+  8015bb:	6a 00                	push   $0x0
+  8015bd:	e8 e3 2d 00 00       	call   8043a5 <page_map>
+  8015c2:	83 c4 20             	add    $0x20,%esp
+  8015c5:	85 c0                	test   %eax,%eax
+  8015c7:	0f 88 e4 00 00 00    	js     8016b1 <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  8015cd:	83 ec 0c             	sub    $0xc,%esp
+  8015d0:	57                   	push   %edi
+  8015d1:	53                   	push   %ebx
+  8015d2:	6a 00                	push   $0x0
+  8015d4:	53                   	push   %ebx
+  8015d5:	6a 00                	push   $0x0
+  8015d7:	e8 c9 2d 00 00       	call   8043a5 <page_map>
+  8015dc:	83 c4 20             	add    $0x20,%esp
+  8015df:	85 c0                	test   %eax,%eax
+  8015e1:	0f 88 dc 00 00 00    	js     8016c3 <fork+0x2d0>
+			++pn;
+  8015e7:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8015ea:	e9 c8 fe ff ff       	jmp    8014b7 <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8015ef:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8015f2:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8015f9:	c1 e1 0c             	shl    $0xc,%ecx
+  8015fc:	83 ec 0c             	sub    $0xc,%esp
+  8015ff:	25 07 0e 00 00       	and    $0xe07,%eax
+  801604:	50                   	push   %eax
+  801605:	51                   	push   %ecx
+  801606:	ff 75 e4             	push   -0x1c(%ebp)
+  801609:	51                   	push   %ecx
+  80160a:	6a 00                	push   $0x0
+  80160c:	e8 94 2d 00 00       	call   8043a5 <page_map>
+  801611:	83 c4 20             	add    $0x20,%esp
+  801614:	85 c0                	test   %eax,%eax
+  801616:	79 cf                	jns    8015e7 <fork+0x1f4>
+			panic("page_map %d", r);
+  801618:	50                   	push   %eax
+  801619:	68 26 57 80 00       	push   $0x805726
+  80161e:	6a 4d                	push   $0x4d
+  801620:	68 0b 57 80 00       	push   $0x80570b
+  801625:	e8 2d eb ff ff       	call   800157 <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  80162a:	83 ec 0c             	sub    $0xc,%esp
+  80162d:	68 00 10 00 00       	push   $0x1000
+  801632:	e8 60 33 00 00       	call   804997 <malloc>
+  801637:	89 c7                	mov    %eax,%edi
+  801639:	83 c4 10             	add    $0x10,%esp
+  80163c:	85 c0                	test   %eax,%eax
+  80163e:	74 4b                	je     80168b <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  801640:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801643:	c1 e3 0c             	shl    $0xc,%ebx
+  801646:	83 ec 04             	sub    $0x4,%esp
+  801649:	68 00 10 00 00       	push   $0x1000
+  80164e:	53                   	push   %ebx
+  80164f:	50                   	push   %eax
+  801650:	e8 ac f3 ff ff       	call   800a01 <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  801655:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801658:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80165f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801664:	89 04 24             	mov    %eax,(%esp)
+  801667:	53                   	push   %ebx
+  801668:	ff 75 e4             	push   -0x1c(%ebp)
+  80166b:	57                   	push   %edi
+  80166c:	6a 00                	push   $0x0
+  80166e:	e8 32 2d 00 00       	call   8043a5 <page_map>
+  801673:	83 c4 20             	add    $0x20,%esp
+  801676:	85 c0                	test   %eax,%eax
+  801678:	78 25                	js     80169f <fork+0x2ac>
+		free(temp);
+  80167a:	83 ec 0c             	sub    $0xc,%esp
+  80167d:	57                   	push   %edi
+  80167e:	e8 12 31 00 00       	call   804795 <free>
+  801683:	83 c4 10             	add    $0x10,%esp
+  801686:	e9 5c ff ff ff       	jmp    8015e7 <fork+0x1f4>
+			panic("malloc failed");
+  80168b:	83 ec 04             	sub    $0x4,%esp
+  80168e:	68 32 57 80 00       	push   $0x805732
+  801693:	6a 56                	push   $0x56
+  801695:	68 0b 57 80 00       	push   $0x80570b
+  80169a:	e8 b8 ea ff ff       	call   800157 <_panic>
+			panic("page_map: %e", r);
+  80169f:	50                   	push   %eax
+  8016a0:	68 40 57 80 00       	push   $0x805740
+  8016a5:	6a 59                	push   $0x59
+  8016a7:	68 0b 57 80 00       	push   $0x80570b
+  8016ac:	e8 a6 ea ff ff       	call   800157 <_panic>
+			panic("page_map %d", r);
+  8016b1:	50                   	push   %eax
+  8016b2:	68 26 57 80 00       	push   $0x805726
+  8016b7:	6a 65                	push   $0x65
+  8016b9:	68 0b 57 80 00       	push   $0x80570b
+  8016be:	e8 94 ea ff ff       	call   800157 <_panic>
+			panic("page_map %d", r);
+  8016c3:	50                   	push   %eax
+  8016c4:	68 26 57 80 00       	push   $0x805726
+  8016c9:	6a 78                	push   $0x78
+  8016cb:	68 0b 57 80 00       	push   $0x80570b
+  8016d0:	e8 82 ea ff ff       	call   800157 <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8016d5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8016d8:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8016df:	c1 e1 0c             	shl    $0xc,%ecx
+  8016e2:	83 ec 0c             	sub    $0xc,%esp
+  8016e5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016ea:	50                   	push   %eax
+  8016eb:	51                   	push   %ecx
+  8016ec:	ff 75 e4             	push   -0x1c(%ebp)
+  8016ef:	51                   	push   %ecx
+  8016f0:	6a 00                	push   $0x0
+  8016f2:	e8 ae 2c 00 00       	call   8043a5 <page_map>
+  8016f7:	83 c4 20             	add    $0x20,%esp
+  8016fa:	85 c0                	test   %eax,%eax
+  8016fc:	0f 89 e5 fe ff ff    	jns    8015e7 <fork+0x1f4>
+			panic("page_map %d", r);
+  801702:	50                   	push   %eax
+  801703:	68 26 57 80 00       	push   $0x805726
+  801708:	6a 7f                	push   $0x7f
+  80170a:	68 0b 57 80 00       	push   $0x80570b
+  80170f:	e8 43 ea ff ff       	call   800157 <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801714:	83 c7 01             	add    $0x1,%edi
+  801717:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80171a:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  80171d:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  801720:	39 f7                	cmp    %esi,%edi
+  801722:	74 1c                	je     801740 <fork+0x34d>
+  801724:	89 d8                	mov    %ebx,%eax
+  801726:	e8 c5 fb ff ff       	call   8012f0 <dupable>
+  80172b:	84 c0                	test   %al,%al
+  80172d:	74 7c                	je     8017ab <fork+0x3b8>
+  80172f:	89 d8                	mov    %ebx,%eax
+  801731:	e8 71 fb ff ff       	call   8012a7 <dupperm>
+  801736:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  801739:	74 d9                	je     801714 <fork+0x321>
+  80173b:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80173e:	eb 06                	jmp    801746 <fork+0x353>
+  801740:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801743:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  801746:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801749:	c1 e0 0c             	shl    $0xc,%eax
+  80174c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80174f:	83 ec 08             	sub    $0x8,%esp
+  801752:	ff 75 dc             	push   -0x24(%ebp)
+  801755:	57                   	push   %edi
+  801756:	50                   	push   %eax
+  801757:	ff 75 e4             	push   -0x1c(%ebp)
+  80175a:	50                   	push   %eax
+  80175b:	6a 00                	push   $0x0
+  80175d:	e8 3a 2e 00 00       	call   80459c <page_map_range>
+  801762:	83 c4 20             	add    $0x20,%esp
+  801765:	85 c0                	test   %eax,%eax
+  801767:	78 47                	js     8017b0 <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  801769:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801770:	0f 84 41 fd ff ff    	je     8014b7 <fork+0xc4>
+  801776:	83 ec 08             	sub    $0x8,%esp
+  801779:	ff 75 dc             	push   -0x24(%ebp)
+  80177c:	57                   	push   %edi
+  80177d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801780:	50                   	push   %eax
+  801781:	6a 00                	push   $0x0
+  801783:	50                   	push   %eax
+  801784:	6a 00                	push   $0x0
+  801786:	e8 11 2e 00 00       	call   80459c <page_map_range>
+  80178b:	83 c4 20             	add    $0x20,%esp
+  80178e:	85 c0                	test   %eax,%eax
+  801790:	0f 89 21 fd ff ff    	jns    8014b7 <fork+0xc4>
+		panic("page_map_range %e", r);
+  801796:	50                   	push   %eax
+  801797:	68 4d 57 80 00       	push   $0x80574d
+  80179c:	68 a2 00 00 00       	push   $0xa2
+  8017a1:	68 0b 57 80 00       	push   $0x80570b
+  8017a6:	e8 ac e9 ff ff       	call   800157 <_panic>
+  8017ab:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8017ae:	eb 96                	jmp    801746 <fork+0x353>
+		panic("page_map_range %e", r);
+  8017b0:	50                   	push   %eax
+  8017b1:	68 4d 57 80 00       	push   $0x80574d
+  8017b6:	68 a0 00 00 00       	push   $0xa0
+  8017bb:	68 0b 57 80 00       	push   $0x80570b
+  8017c0:	e8 92 e9 ff ff       	call   800157 <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  8017c5:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  8017c8:	6a 01                	push   $0x1
+  8017ca:	6a 07                	push   $0x7
+  8017cc:	68 00 f0 bf ee       	push   $0xeebff000
+  8017d1:	53                   	push   %ebx
+  8017d2:	e8 6d 25 00 00       	call   803d44 <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8017d7:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8017dc:	8b 40 74             	mov    0x74(%eax),%eax
+  8017df:	83 c4 08             	add    $0x8,%esp
+  8017e2:	50                   	push   %eax
+  8017e3:	53                   	push   %ebx
+  8017e4:	e8 89 f8 ff ff       	call   801072 <sys_env_set_pgfault_upcall>
+  8017e9:	83 c4 10             	add    $0x10,%esp
+  8017ec:	e9 41 fc ff ff       	jmp    801432 <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8017f1:	e8 d8 f4 ff ff       	call   800cce <sys_getenvid>
+  8017f6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017fb:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8017fe:	c1 e0 06             	shl    $0x6,%eax
+  801801:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801806:	a3 18 e9 80 00       	mov    %eax,0x80e918
+		return 0;
+  80180b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801812:	e9 40 fc ff ff       	jmp    801457 <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  801817:	50                   	push   %eax
+  801818:	68 5f 57 80 00       	push   $0x80575f
+  80181d:	68 27 01 00 00       	push   $0x127
+  801822:	68 0b 57 80 00       	push   $0x80570b
+  801827:	e8 2b e9 ff ff       	call   800157 <_panic>
+		panic("sys_env_set_status: %d", r);
+  80182c:	50                   	push   %eax
+  80182d:	68 78 57 80 00       	push   $0x805778
+  801832:	68 2b 01 00 00       	push   $0x12b
+  801837:	68 0b 57 80 00       	push   $0x80570b
+  80183c:	e8 16 e9 ff ff       	call   800157 <_panic>
+
+00801841 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801841:	55                   	push   %ebp
+  801842:	89 e5                	mov    %esp,%ebp
+  801844:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801847:	68 8f 57 80 00       	push   $0x80578f
+  80184c:	68 35 01 00 00       	push   $0x135
+  801851:	68 0b 57 80 00       	push   $0x80570b
+  801856:	e8 fc e8 ff ff       	call   800157 <_panic>
+
+0080185b <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  80185b:	55                   	push   %ebp
+  80185c:	89 e5                	mov    %esp,%ebp
+  80185e:	57                   	push   %edi
+  80185f:	56                   	push   %esi
+  801860:	53                   	push   %ebx
+  801861:	83 ec 14             	sub    $0x14,%esp
+  801864:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801867:	8b 75 14             	mov    0x14(%ebp),%esi
+  80186a:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  80186d:	ff 75 10             	push   0x10(%ebp)
+  801870:	ff 75 0c             	push   0xc(%ebp)
+  801873:	e8 b7 f8 ff ff       	call   80112f <sys_ipc_recv_pages>
+  801878:	83 c4 10             	add    $0x10,%esp
+  80187b:	85 c0                	test   %eax,%eax
+  80187d:	78 46                	js     8018c5 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80187f:	85 ff                	test   %edi,%edi
+  801881:	74 0d                	je     801890 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  801883:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801888:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80188e:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  801890:	85 f6                	test   %esi,%esi
+  801892:	74 0d                	je     8018a1 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  801894:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801899:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80189f:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8018a1:	85 db                	test   %ebx,%ebx
+  8018a3:	74 0d                	je     8018b2 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  8018a5:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8018aa:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8018b0:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8018b2:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8018b7:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8018bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018c0:	5b                   	pop    %ebx
+  8018c1:	5e                   	pop    %esi
+  8018c2:	5f                   	pop    %edi
+  8018c3:	5d                   	pop    %ebp
+  8018c4:	c3                   	ret
+		if (from_env_store) {
+  8018c5:	85 ff                	test   %edi,%edi
+  8018c7:	74 06                	je     8018cf <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  8018c9:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8018cf:	85 f6                	test   %esi,%esi
+  8018d1:	74 06                	je     8018d9 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  8018d3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8018d9:	85 db                	test   %ebx,%ebx
+  8018db:	74 e0                	je     8018bd <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8018dd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8018e3:	eb d8                	jmp    8018bd <ipc_recv_pages+0x62>
+
+008018e5 <ipc_recv>:
+{
+  8018e5:	55                   	push   %ebp
+  8018e6:	89 e5                	mov    %esp,%ebp
+  8018e8:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8018eb:	6a 00                	push   $0x0
+  8018ed:	ff 75 10             	push   0x10(%ebp)
+  8018f0:	6a 01                	push   $0x1
+  8018f2:	ff 75 0c             	push   0xc(%ebp)
+  8018f5:	ff 75 08             	push   0x8(%ebp)
+  8018f8:	e8 5e ff ff ff       	call   80185b <ipc_recv_pages>
+}
+  8018fd:	c9                   	leave
+  8018fe:	c3                   	ret
+
+008018ff <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8018ff:	55                   	push   %ebp
+  801900:	89 e5                	mov    %esp,%ebp
+  801902:	56                   	push   %esi
+  801903:	53                   	push   %ebx
+  801904:	8b 75 08             	mov    0x8(%ebp),%esi
+  801907:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  80190a:	83 ec 0c             	sub    $0xc,%esp
+  80190d:	ff 75 0c             	push   0xc(%ebp)
+  801910:	e8 4e f9 ff ff       	call   801263 <sys_ipc_try_recv>
+  801915:	83 c4 10             	add    $0x10,%esp
+  801918:	85 c0                	test   %eax,%eax
+  80191a:	78 34                	js     801950 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80191c:	85 f6                	test   %esi,%esi
+  80191e:	74 0d                	je     80192d <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  801920:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801925:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80192b:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  80192d:	85 db                	test   %ebx,%ebx
+  80192f:	74 0d                	je     80193e <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  801931:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801936:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80193c:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80193e:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801943:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  801949:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80194c:	5b                   	pop    %ebx
+  80194d:	5e                   	pop    %esi
+  80194e:	5d                   	pop    %ebp
+  80194f:	c3                   	ret
+		if (from_env_store) {
+  801950:	85 f6                	test   %esi,%esi
+  801952:	74 06                	je     80195a <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  801954:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  80195a:	85 db                	test   %ebx,%ebx
+  80195c:	74 eb                	je     801949 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  80195e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801964:	eb e3                	jmp    801949 <ipc_try_recv+0x4a>
+
+00801966 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  801966:	55                   	push   %ebp
+  801967:	89 e5                	mov    %esp,%ebp
+  801969:	83 ec 14             	sub    $0x14,%esp
+  80196c:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80196f:	85 c0                	test   %eax,%eax
+  801971:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801976:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  801979:	ff 75 18             	push   0x18(%ebp)
+  80197c:	ff 75 14             	push   0x14(%ebp)
+  80197f:	50                   	push   %eax
+  801980:	ff 75 0c             	push   0xc(%ebp)
+  801983:	ff 75 08             	push   0x8(%ebp)
+  801986:	e8 67 f7 ff ff       	call   8010f2 <sys_ipc_send_pages>
+  80198b:	83 c4 20             	add    $0x20,%esp
+  80198e:	85 c0                	test   %eax,%eax
+  801990:	78 02                	js     801994 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  801992:	c9                   	leave
+  801993:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  801994:	50                   	push   %eax
+  801995:	68 a8 57 80 00       	push   $0x8057a8
+  80199a:	68 80 00 00 00       	push   $0x80
+  80199f:	68 d4 57 80 00       	push   $0x8057d4
+  8019a4:	e8 ae e7 ff ff       	call   800157 <_panic>
+
+008019a9 <ipc_send>:
+{
+  8019a9:	55                   	push   %ebp
+  8019aa:	89 e5                	mov    %esp,%ebp
+  8019ac:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  8019af:	ff 75 14             	push   0x14(%ebp)
+  8019b2:	6a 01                	push   $0x1
+  8019b4:	ff 75 10             	push   0x10(%ebp)
+  8019b7:	ff 75 0c             	push   0xc(%ebp)
+  8019ba:	ff 75 08             	push   0x8(%ebp)
+  8019bd:	e8 a4 ff ff ff       	call   801966 <ipc_send_pages>
+}
+  8019c2:	83 c4 20             	add    $0x20,%esp
+  8019c5:	c9                   	leave
+  8019c6:	c3                   	ret
+
+008019c7 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8019c7:	55                   	push   %ebp
+  8019c8:	89 e5                	mov    %esp,%ebp
+  8019ca:	83 ec 14             	sub    $0x14,%esp
+  8019cd:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8019d0:	85 c0                	test   %eax,%eax
+  8019d2:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8019d7:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8019da:	ff 75 18             	push   0x18(%ebp)
+  8019dd:	ff 75 14             	push   0x14(%ebp)
+  8019e0:	50                   	push   %eax
+  8019e1:	ff 75 0c             	push   0xc(%ebp)
+  8019e4:	ff 75 08             	push   0x8(%ebp)
+  8019e7:	e8 97 f7 ff ff       	call   801183 <sys_ipc_call>
+  8019ec:	83 c4 20             	add    $0x20,%esp
+  8019ef:	85 c0                	test   %eax,%eax
+  8019f1:	78 0b                	js     8019fe <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  8019f3:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8019f8:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8019fe:	c9                   	leave
+  8019ff:	c3                   	ret
+
+00801a00 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  801a00:	55                   	push   %ebp
+  801a01:	89 e5                	mov    %esp,%ebp
+  801a03:	57                   	push   %edi
+  801a04:	56                   	push   %esi
+  801a05:	53                   	push   %ebx
+  801a06:	83 ec 18             	sub    $0x18,%esp
+  801a09:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a0c:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  801a0f:	8b 75 20             	mov    0x20(%ebp),%esi
+  801a12:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  801a15:	85 c0                	test   %eax,%eax
+  801a17:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801a1c:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  801a1f:	ff 75 18             	push   0x18(%ebp)
+  801a22:	ff 75 14             	push   0x14(%ebp)
+  801a25:	50                   	push   %eax
+  801a26:	ff 75 0c             	push   0xc(%ebp)
+  801a29:	ff 75 08             	push   0x8(%ebp)
+  801a2c:	e8 93 f7 ff ff       	call   8011c4 <sys_ipc_reply_recv>
+  801a31:	83 c4 20             	add    $0x20,%esp
+  801a34:	85 c0                	test   %eax,%eax
+  801a36:	78 46                	js     801a7e <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  801a38:	85 ff                	test   %edi,%edi
+  801a3a:	74 0d                	je     801a49 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  801a3c:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801a41:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  801a47:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  801a49:	85 f6                	test   %esi,%esi
+  801a4b:	74 0d                	je     801a5a <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  801a4d:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801a52:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801a58:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  801a5a:	85 db                	test   %ebx,%ebx
+  801a5c:	74 0d                	je     801a6b <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  801a5e:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801a63:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801a69:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  801a6b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801a70:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  801a76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a79:	5b                   	pop    %ebx
+  801a7a:	5e                   	pop    %esi
+  801a7b:	5f                   	pop    %edi
+  801a7c:	5d                   	pop    %ebp
+  801a7d:	c3                   	ret
+		if (from_env_store) {
+  801a7e:	85 ff                	test   %edi,%edi
+  801a80:	74 06                	je     801a88 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  801a82:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  801a88:	85 f6                	test   %esi,%esi
+  801a8a:	74 06                	je     801a92 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  801a8c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  801a92:	85 db                	test   %ebx,%ebx
+  801a94:	74 e0                	je     801a76 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  801a96:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801a9c:	eb d8                	jmp    801a76 <ipc_reply_recv+0x76>
+
+00801a9e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801a9e:	55                   	push   %ebp
+  801a9f:	89 e5                	mov    %esp,%ebp
+  801aa1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801aa4:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  801aa9:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  801aac:	c1 e0 06             	shl    $0x6,%eax
+  801aaf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801ab4:	8b 40 50             	mov    0x50(%eax),%eax
+  801ab7:	39 c8                	cmp    %ecx,%eax
+  801ab9:	74 12                	je     801acd <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801abb:	83 c2 01             	add    $0x1,%edx
+  801abe:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801ac4:	75 e3                	jne    801aa9 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801acb:	eb 0e                	jmp    801adb <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801acd:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  801ad0:	c1 e0 06             	shl    $0x6,%eax
+  801ad3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801ad8:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801adb:	5d                   	pop    %ebp
+  801adc:	c3                   	ret
+
+00801add <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801add:	55                   	push   %ebp
+  801ade:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ae0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae3:	05 00 00 00 30       	add    $0x30000000,%eax
+  801ae8:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801aeb:	5d                   	pop    %ebp
+  801aec:	c3                   	ret
+
+00801aed <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801aed:	55                   	push   %ebp
+  801aee:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801af0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801af3:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801af8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801afd:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801b02:	5d                   	pop    %ebp
+  801b03:	c3                   	ret
+
+00801b04 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801b04:	55                   	push   %ebp
+  801b05:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801b07:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801b0c:	a8 01                	test   $0x1,%al
+  801b0e:	74 3c                	je     801b4c <fd_alloc+0x48>
+  801b10:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801b15:	89 c2                	mov    %eax,%edx
+  801b17:	c1 ea 0c             	shr    $0xc,%edx
+  801b1a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b21:	89 c1                	mov    %eax,%ecx
+  801b23:	05 00 10 00 00       	add    $0x1000,%eax
+  801b28:	f6 c2 01             	test   $0x1,%dl
+  801b2b:	74 13                	je     801b40 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801b2d:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801b32:	75 e1                	jne    801b15 <fd_alloc+0x11>
+  801b34:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801b39:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801b3e:	eb 05                	jmp    801b45 <fd_alloc+0x41>
+			return 0;
+  801b40:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801b45:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b48:	89 0a                	mov    %ecx,(%edx)
+}
+  801b4a:	5d                   	pop    %ebp
+  801b4b:	c3                   	ret
+  801b4c:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801b51:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b56:	eb ed                	jmp    801b45 <fd_alloc+0x41>
+
+00801b58 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801b58:	55                   	push   %ebp
+  801b59:	89 e5                	mov    %esp,%ebp
+  801b5b:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801b5e:	83 f8 1f             	cmp    $0x1f,%eax
+  801b61:	77 30                	ja     801b93 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801b63:	c1 e0 0c             	shl    $0xc,%eax
+  801b66:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801b6b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801b71:	f6 c2 01             	test   $0x1,%dl
+  801b74:	74 24                	je     801b9a <fd_lookup+0x42>
+  801b76:	89 c2                	mov    %eax,%edx
+  801b78:	c1 ea 0c             	shr    $0xc,%edx
+  801b7b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b82:	f6 c2 01             	test   $0x1,%dl
+  801b85:	74 1a                	je     801ba1 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801b87:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b8a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b91:	5d                   	pop    %ebp
+  801b92:	c3                   	ret
+		return -E_INVAL;
+  801b93:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b98:	eb f7                	jmp    801b91 <fd_lookup+0x39>
+		return -E_INVAL;
+  801b9a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b9f:	eb f0                	jmp    801b91 <fd_lookup+0x39>
+  801ba1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ba6:	eb e9                	jmp    801b91 <fd_lookup+0x39>
+
+00801ba8 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801ba8:	55                   	push   %ebp
+  801ba9:	89 e5                	mov    %esp,%ebp
+  801bab:	53                   	push   %ebx
+  801bac:	83 ec 04             	sub    $0x4,%esp
+  801baf:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801bb2:	b8 5c 58 80 00       	mov    $0x80585c,%eax
+  801bb7:	8b 18                	mov    (%eax),%ebx
+  801bb9:	85 db                	test   %ebx,%ebx
+  801bbb:	74 0e                	je     801bcb <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801bbd:	83 c0 04             	add    $0x4,%eax
+  801bc0:	39 13                	cmp    %edx,(%ebx)
+  801bc2:	75 f3                	jne    801bb7 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc9:	eb 1f                	jmp    801bea <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801bcb:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801bd0:	8b 40 48             	mov    0x48(%eax),%eax
+  801bd3:	83 ec 04             	sub    $0x4,%esp
+  801bd6:	52                   	push   %edx
+  801bd7:	50                   	push   %eax
+  801bd8:	68 e0 57 80 00       	push   $0x8057e0
+  801bdd:	e8 50 e6 ff ff       	call   800232 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801be2:	83 c4 10             	add    $0x10,%esp
+  801be5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801bea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bed:	89 1a                	mov    %ebx,(%edx)
+}
+  801bef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bf2:	c9                   	leave
+  801bf3:	c3                   	ret
+
+00801bf4 <fd_close>:
+{
+  801bf4:	55                   	push   %ebp
+  801bf5:	89 e5                	mov    %esp,%ebp
+  801bf7:	57                   	push   %edi
+  801bf8:	56                   	push   %esi
+  801bf9:	53                   	push   %ebx
+  801bfa:	83 ec 24             	sub    $0x24,%esp
+  801bfd:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c00:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801c03:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c06:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c07:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801c0d:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801c10:	50                   	push   %eax
+  801c11:	e8 42 ff ff ff       	call   801b58 <fd_lookup>
+  801c16:	89 c3                	mov    %eax,%ebx
+  801c18:	83 c4 10             	add    $0x10,%esp
+  801c1b:	85 c0                	test   %eax,%eax
+  801c1d:	78 05                	js     801c24 <fd_close+0x30>
+	    || fd != fd2)
+  801c1f:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801c22:	74 16                	je     801c3a <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801c24:	89 f8                	mov    %edi,%eax
+  801c26:	84 c0                	test   %al,%al
+  801c28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2d:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801c30:	89 d8                	mov    %ebx,%eax
+  801c32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c35:	5b                   	pop    %ebx
+  801c36:	5e                   	pop    %esi
+  801c37:	5f                   	pop    %edi
+  801c38:	5d                   	pop    %ebp
+  801c39:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c3a:	83 ec 08             	sub    $0x8,%esp
+  801c3d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801c40:	50                   	push   %eax
+  801c41:	ff 36                	push   (%esi)
+  801c43:	e8 60 ff ff ff       	call   801ba8 <dev_lookup>
+  801c48:	89 c3                	mov    %eax,%ebx
+  801c4a:	83 c4 10             	add    $0x10,%esp
+  801c4d:	85 c0                	test   %eax,%eax
+  801c4f:	78 1a                	js     801c6b <fd_close+0x77>
+		if (dev->dev_close)
+  801c51:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c54:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801c57:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801c5c:	85 c0                	test   %eax,%eax
+  801c5e:	74 0b                	je     801c6b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801c60:	83 ec 0c             	sub    $0xc,%esp
+  801c63:	56                   	push   %esi
+  801c64:	ff d0                	call   *%eax
+  801c66:	89 c3                	mov    %eax,%ebx
+  801c68:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801c6b:	83 ec 08             	sub    $0x8,%esp
+  801c6e:	56                   	push   %esi
+  801c6f:	6a 00                	push   $0x0
+  801c71:	e8 1b f1 ff ff       	call   800d91 <sys_page_unmap>
+	return r;
+  801c76:	83 c4 10             	add    $0x10,%esp
+  801c79:	eb b5                	jmp    801c30 <fd_close+0x3c>
+
+00801c7b <close>:
+
+int
+close(int fdnum)
+{
+  801c7b:	55                   	push   %ebp
+  801c7c:	89 e5                	mov    %esp,%ebp
+  801c7e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c81:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c84:	50                   	push   %eax
+  801c85:	ff 75 08             	push   0x8(%ebp)
+  801c88:	e8 cb fe ff ff       	call   801b58 <fd_lookup>
+  801c8d:	83 c4 10             	add    $0x10,%esp
+  801c90:	85 c0                	test   %eax,%eax
+  801c92:	79 02                	jns    801c96 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801c94:	c9                   	leave
+  801c95:	c3                   	ret
+		return fd_close(fd, 1);
+  801c96:	83 ec 08             	sub    $0x8,%esp
+  801c99:	6a 01                	push   $0x1
+  801c9b:	ff 75 f4             	push   -0xc(%ebp)
+  801c9e:	e8 51 ff ff ff       	call   801bf4 <fd_close>
+  801ca3:	83 c4 10             	add    $0x10,%esp
+  801ca6:	eb ec                	jmp    801c94 <close+0x19>
+
+00801ca8 <close_all>:
+
+void
+close_all(void)
+{
+  801ca8:	55                   	push   %ebp
+  801ca9:	89 e5                	mov    %esp,%ebp
+  801cab:	53                   	push   %ebx
+  801cac:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801caf:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801cb4:	83 ec 0c             	sub    $0xc,%esp
+  801cb7:	53                   	push   %ebx
+  801cb8:	e8 be ff ff ff       	call   801c7b <close>
+	for (i = 0; i < MAXFD; i++)
+  801cbd:	83 c3 01             	add    $0x1,%ebx
+  801cc0:	83 c4 10             	add    $0x10,%esp
+  801cc3:	83 fb 20             	cmp    $0x20,%ebx
+  801cc6:	75 ec                	jne    801cb4 <close_all+0xc>
+}
+  801cc8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ccb:	c9                   	leave
+  801ccc:	c3                   	ret
+
+00801ccd <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801ccd:	55                   	push   %ebp
+  801cce:	89 e5                	mov    %esp,%ebp
+  801cd0:	57                   	push   %edi
+  801cd1:	56                   	push   %esi
+  801cd2:	53                   	push   %ebx
+  801cd3:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801cd6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801cd9:	50                   	push   %eax
+  801cda:	ff 75 08             	push   0x8(%ebp)
+  801cdd:	e8 76 fe ff ff       	call   801b58 <fd_lookup>
+  801ce2:	89 c3                	mov    %eax,%ebx
+  801ce4:	83 c4 10             	add    $0x10,%esp
+  801ce7:	85 c0                	test   %eax,%eax
+  801ce9:	78 7f                	js     801d6a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801ceb:	83 ec 0c             	sub    $0xc,%esp
+  801cee:	ff 75 0c             	push   0xc(%ebp)
+  801cf1:	e8 85 ff ff ff       	call   801c7b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801cf6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801cf9:	c1 e6 0c             	shl    $0xc,%esi
+  801cfc:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801d02:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801d05:	89 3c 24             	mov    %edi,(%esp)
+  801d08:	e8 e0 fd ff ff       	call   801aed <fd2data>
+  801d0d:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801d0f:	89 34 24             	mov    %esi,(%esp)
+  801d12:	e8 d6 fd ff ff       	call   801aed <fd2data>
+  801d17:	83 c4 10             	add    $0x10,%esp
+  801d1a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801d1d:	89 d8                	mov    %ebx,%eax
+  801d1f:	c1 e8 16             	shr    $0x16,%eax
+  801d22:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d29:	a8 01                	test   $0x1,%al
+  801d2b:	74 11                	je     801d3e <dup+0x71>
+  801d2d:	89 d8                	mov    %ebx,%eax
+  801d2f:	c1 e8 0c             	shr    $0xc,%eax
+  801d32:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d39:	f6 c2 01             	test   $0x1,%dl
+  801d3c:	75 36                	jne    801d74 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801d3e:	89 f8                	mov    %edi,%eax
+  801d40:	c1 e8 0c             	shr    $0xc,%eax
+  801d43:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d4a:	83 ec 0c             	sub    $0xc,%esp
+  801d4d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d52:	50                   	push   %eax
+  801d53:	56                   	push   %esi
+  801d54:	6a 00                	push   $0x0
+  801d56:	57                   	push   %edi
+  801d57:	6a 00                	push   $0x0
+  801d59:	e8 f1 ef ff ff       	call   800d4f <sys_page_map>
+  801d5e:	89 c3                	mov    %eax,%ebx
+  801d60:	83 c4 20             	add    $0x20,%esp
+  801d63:	85 c0                	test   %eax,%eax
+  801d65:	78 33                	js     801d9a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801d67:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801d6a:	89 d8                	mov    %ebx,%eax
+  801d6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d6f:	5b                   	pop    %ebx
+  801d70:	5e                   	pop    %esi
+  801d71:	5f                   	pop    %edi
+  801d72:	5d                   	pop    %ebp
+  801d73:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801d74:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d7b:	83 ec 0c             	sub    $0xc,%esp
+  801d7e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d83:	50                   	push   %eax
+  801d84:	ff 75 d4             	push   -0x2c(%ebp)
+  801d87:	6a 00                	push   $0x0
+  801d89:	53                   	push   %ebx
+  801d8a:	6a 00                	push   $0x0
+  801d8c:	e8 be ef ff ff       	call   800d4f <sys_page_map>
+  801d91:	89 c3                	mov    %eax,%ebx
+  801d93:	83 c4 20             	add    $0x20,%esp
+  801d96:	85 c0                	test   %eax,%eax
+  801d98:	79 a4                	jns    801d3e <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801d9a:	83 ec 08             	sub    $0x8,%esp
+  801d9d:	56                   	push   %esi
+  801d9e:	6a 00                	push   $0x0
+  801da0:	e8 ec ef ff ff       	call   800d91 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801da5:	83 c4 08             	add    $0x8,%esp
+  801da8:	ff 75 d4             	push   -0x2c(%ebp)
+  801dab:	6a 00                	push   $0x0
+  801dad:	e8 df ef ff ff       	call   800d91 <sys_page_unmap>
+	return r;
+  801db2:	83 c4 10             	add    $0x10,%esp
+  801db5:	eb b3                	jmp    801d6a <dup+0x9d>
+
+00801db7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801db7:	55                   	push   %ebp
+  801db8:	89 e5                	mov    %esp,%ebp
+  801dba:	56                   	push   %esi
+  801dbb:	53                   	push   %ebx
+  801dbc:	83 ec 18             	sub    $0x18,%esp
+  801dbf:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dc2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dc5:	50                   	push   %eax
+  801dc6:	56                   	push   %esi
+  801dc7:	e8 8c fd ff ff       	call   801b58 <fd_lookup>
+  801dcc:	83 c4 10             	add    $0x10,%esp
+  801dcf:	85 c0                	test   %eax,%eax
+  801dd1:	78 3c                	js     801e0f <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dd3:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801dd6:	83 ec 08             	sub    $0x8,%esp
+  801dd9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ddc:	50                   	push   %eax
+  801ddd:	ff 33                	push   (%ebx)
+  801ddf:	e8 c4 fd ff ff       	call   801ba8 <dev_lookup>
+  801de4:	83 c4 10             	add    $0x10,%esp
+  801de7:	85 c0                	test   %eax,%eax
+  801de9:	78 24                	js     801e0f <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801deb:	8b 43 08             	mov    0x8(%ebx),%eax
+  801dee:	83 e0 03             	and    $0x3,%eax
+  801df1:	83 f8 01             	cmp    $0x1,%eax
+  801df4:	74 20                	je     801e16 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801df6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801df9:	8b 40 08             	mov    0x8(%eax),%eax
+  801dfc:	85 c0                	test   %eax,%eax
+  801dfe:	74 37                	je     801e37 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801e00:	83 ec 04             	sub    $0x4,%esp
+  801e03:	ff 75 10             	push   0x10(%ebp)
+  801e06:	ff 75 0c             	push   0xc(%ebp)
+  801e09:	53                   	push   %ebx
+  801e0a:	ff d0                	call   *%eax
+  801e0c:	83 c4 10             	add    $0x10,%esp
+}
+  801e0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e12:	5b                   	pop    %ebx
+  801e13:	5e                   	pop    %esi
+  801e14:	5d                   	pop    %ebp
+  801e15:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e16:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801e1b:	8b 40 48             	mov    0x48(%eax),%eax
+  801e1e:	83 ec 04             	sub    $0x4,%esp
+  801e21:	56                   	push   %esi
+  801e22:	50                   	push   %eax
+  801e23:	68 21 58 80 00       	push   $0x805821
+  801e28:	e8 05 e4 ff ff       	call   800232 <cprintf>
+		return -E_INVAL;
+  801e2d:	83 c4 10             	add    $0x10,%esp
+  801e30:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e35:	eb d8                	jmp    801e0f <read+0x58>
+		return -E_NOT_SUPP;
+  801e37:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e3c:	eb d1                	jmp    801e0f <read+0x58>
+
+00801e3e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801e3e:	55                   	push   %ebp
+  801e3f:	89 e5                	mov    %esp,%ebp
+  801e41:	57                   	push   %edi
+  801e42:	56                   	push   %esi
+  801e43:	53                   	push   %ebx
+  801e44:	83 ec 0c             	sub    $0xc,%esp
+  801e47:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e4a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801e4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e52:	eb 02                	jmp    801e56 <readn+0x18>
+  801e54:	01 c3                	add    %eax,%ebx
+  801e56:	39 f3                	cmp    %esi,%ebx
+  801e58:	73 21                	jae    801e7b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801e5a:	83 ec 04             	sub    $0x4,%esp
+  801e5d:	89 f0                	mov    %esi,%eax
+  801e5f:	29 d8                	sub    %ebx,%eax
+  801e61:	50                   	push   %eax
+  801e62:	89 d8                	mov    %ebx,%eax
+  801e64:	03 45 0c             	add    0xc(%ebp),%eax
+  801e67:	50                   	push   %eax
+  801e68:	57                   	push   %edi
+  801e69:	e8 49 ff ff ff       	call   801db7 <read>
+		if (m < 0)
+  801e6e:	83 c4 10             	add    $0x10,%esp
+  801e71:	85 c0                	test   %eax,%eax
+  801e73:	78 04                	js     801e79 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801e75:	75 dd                	jne    801e54 <readn+0x16>
+  801e77:	eb 02                	jmp    801e7b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801e79:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801e7b:	89 d8                	mov    %ebx,%eax
+  801e7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e80:	5b                   	pop    %ebx
+  801e81:	5e                   	pop    %esi
+  801e82:	5f                   	pop    %edi
+  801e83:	5d                   	pop    %ebp
+  801e84:	c3                   	ret
+
+00801e85 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801e85:	55                   	push   %ebp
+  801e86:	89 e5                	mov    %esp,%ebp
+  801e88:	56                   	push   %esi
+  801e89:	53                   	push   %ebx
+  801e8a:	83 ec 18             	sub    $0x18,%esp
+  801e8d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e90:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e93:	50                   	push   %eax
+  801e94:	53                   	push   %ebx
+  801e95:	e8 be fc ff ff       	call   801b58 <fd_lookup>
+  801e9a:	83 c4 10             	add    $0x10,%esp
+  801e9d:	85 c0                	test   %eax,%eax
+  801e9f:	78 37                	js     801ed8 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ea1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ea4:	83 ec 08             	sub    $0x8,%esp
+  801ea7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eaa:	50                   	push   %eax
+  801eab:	ff 36                	push   (%esi)
+  801ead:	e8 f6 fc ff ff       	call   801ba8 <dev_lookup>
+  801eb2:	83 c4 10             	add    $0x10,%esp
+  801eb5:	85 c0                	test   %eax,%eax
+  801eb7:	78 1f                	js     801ed8 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801eb9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ebd:	74 20                	je     801edf <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801ebf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ec2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ec5:	85 c0                	test   %eax,%eax
+  801ec7:	74 37                	je     801f00 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801ec9:	83 ec 04             	sub    $0x4,%esp
+  801ecc:	ff 75 10             	push   0x10(%ebp)
+  801ecf:	ff 75 0c             	push   0xc(%ebp)
+  801ed2:	56                   	push   %esi
+  801ed3:	ff d0                	call   *%eax
+  801ed5:	83 c4 10             	add    $0x10,%esp
+}
+  801ed8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801edb:	5b                   	pop    %ebx
+  801edc:	5e                   	pop    %esi
+  801edd:	5d                   	pop    %ebp
+  801ede:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801edf:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801ee4:	8b 40 48             	mov    0x48(%eax),%eax
+  801ee7:	83 ec 04             	sub    $0x4,%esp
+  801eea:	53                   	push   %ebx
+  801eeb:	50                   	push   %eax
+  801eec:	68 3d 58 80 00       	push   $0x80583d
+  801ef1:	e8 3c e3 ff ff       	call   800232 <cprintf>
+		return -E_INVAL;
+  801ef6:	83 c4 10             	add    $0x10,%esp
+  801ef9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801efe:	eb d8                	jmp    801ed8 <write+0x53>
+		return -E_NOT_SUPP;
+  801f00:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f05:	eb d1                	jmp    801ed8 <write+0x53>
+
+00801f07 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801f07:	55                   	push   %ebp
+  801f08:	89 e5                	mov    %esp,%ebp
+  801f0a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f0d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f10:	50                   	push   %eax
+  801f11:	ff 75 08             	push   0x8(%ebp)
+  801f14:	e8 3f fc ff ff       	call   801b58 <fd_lookup>
+  801f19:	83 c4 10             	add    $0x10,%esp
+  801f1c:	85 c0                	test   %eax,%eax
+  801f1e:	78 0e                	js     801f2e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801f20:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f26:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801f29:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f2e:	c9                   	leave
+  801f2f:	c3                   	ret
+
+00801f30 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801f30:	55                   	push   %ebp
+  801f31:	89 e5                	mov    %esp,%ebp
+  801f33:	56                   	push   %esi
+  801f34:	53                   	push   %ebx
+  801f35:	83 ec 18             	sub    $0x18,%esp
+  801f38:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f3b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f3e:	50                   	push   %eax
+  801f3f:	53                   	push   %ebx
+  801f40:	e8 13 fc ff ff       	call   801b58 <fd_lookup>
+  801f45:	83 c4 10             	add    $0x10,%esp
+  801f48:	85 c0                	test   %eax,%eax
+  801f4a:	78 34                	js     801f80 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f4c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f4f:	83 ec 08             	sub    $0x8,%esp
+  801f52:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f55:	50                   	push   %eax
+  801f56:	ff 36                	push   (%esi)
+  801f58:	e8 4b fc ff ff       	call   801ba8 <dev_lookup>
+  801f5d:	83 c4 10             	add    $0x10,%esp
+  801f60:	85 c0                	test   %eax,%eax
+  801f62:	78 1c                	js     801f80 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f64:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f68:	74 1d                	je     801f87 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801f6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f6d:	8b 40 18             	mov    0x18(%eax),%eax
+  801f70:	85 c0                	test   %eax,%eax
+  801f72:	74 34                	je     801fa8 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801f74:	83 ec 08             	sub    $0x8,%esp
+  801f77:	ff 75 0c             	push   0xc(%ebp)
+  801f7a:	56                   	push   %esi
+  801f7b:	ff d0                	call   *%eax
+  801f7d:	83 c4 10             	add    $0x10,%esp
+}
+  801f80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f83:	5b                   	pop    %ebx
+  801f84:	5e                   	pop    %esi
+  801f85:	5d                   	pop    %ebp
+  801f86:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801f87:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801f8c:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f8f:	83 ec 04             	sub    $0x4,%esp
+  801f92:	53                   	push   %ebx
+  801f93:	50                   	push   %eax
+  801f94:	68 00 58 80 00       	push   $0x805800
+  801f99:	e8 94 e2 ff ff       	call   800232 <cprintf>
+		return -E_INVAL;
+  801f9e:	83 c4 10             	add    $0x10,%esp
+  801fa1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fa6:	eb d8                	jmp    801f80 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801fa8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fad:	eb d1                	jmp    801f80 <ftruncate+0x50>
+
+00801faf <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801faf:	55                   	push   %ebp
+  801fb0:	89 e5                	mov    %esp,%ebp
+  801fb2:	56                   	push   %esi
+  801fb3:	53                   	push   %ebx
+  801fb4:	83 ec 18             	sub    $0x18,%esp
+  801fb7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801fba:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fbd:	50                   	push   %eax
+  801fbe:	ff 75 08             	push   0x8(%ebp)
+  801fc1:	e8 92 fb ff ff       	call   801b58 <fd_lookup>
+  801fc6:	83 c4 10             	add    $0x10,%esp
+  801fc9:	85 c0                	test   %eax,%eax
+  801fcb:	78 49                	js     802016 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801fcd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fd0:	83 ec 08             	sub    $0x8,%esp
+  801fd3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fd6:	50                   	push   %eax
+  801fd7:	ff 36                	push   (%esi)
+  801fd9:	e8 ca fb ff ff       	call   801ba8 <dev_lookup>
+  801fde:	83 c4 10             	add    $0x10,%esp
+  801fe1:	85 c0                	test   %eax,%eax
+  801fe3:	78 31                	js     802016 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801fe5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fe8:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801fec:	74 2f                	je     80201d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801fee:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801ff1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801ff8:	00 00 00 
+	stat->st_isdir = 0;
+  801ffb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802002:	00 00 00 
+	stat->st_dev = dev;
+  802005:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80200b:	83 ec 08             	sub    $0x8,%esp
+  80200e:	53                   	push   %ebx
+  80200f:	56                   	push   %esi
+  802010:	ff 50 14             	call   *0x14(%eax)
+  802013:	83 c4 10             	add    $0x10,%esp
+}
+  802016:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802019:	5b                   	pop    %ebx
+  80201a:	5e                   	pop    %esi
+  80201b:	5d                   	pop    %ebp
+  80201c:	c3                   	ret
+		return -E_NOT_SUPP;
+  80201d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802022:	eb f2                	jmp    802016 <fstat+0x67>
+
+00802024 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802024:	55                   	push   %ebp
+  802025:	89 e5                	mov    %esp,%ebp
+  802027:	56                   	push   %esi
+  802028:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802029:	83 ec 08             	sub    $0x8,%esp
+  80202c:	6a 00                	push   $0x0
+  80202e:	ff 75 08             	push   0x8(%ebp)
+  802031:	e8 bc 02 00 00       	call   8022f2 <open>
+  802036:	89 c3                	mov    %eax,%ebx
+  802038:	83 c4 10             	add    $0x10,%esp
+  80203b:	85 c0                	test   %eax,%eax
+  80203d:	78 1b                	js     80205a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80203f:	83 ec 08             	sub    $0x8,%esp
+  802042:	ff 75 0c             	push   0xc(%ebp)
+  802045:	50                   	push   %eax
+  802046:	e8 64 ff ff ff       	call   801faf <fstat>
+  80204b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80204d:	89 1c 24             	mov    %ebx,(%esp)
+  802050:	e8 26 fc ff ff       	call   801c7b <close>
+	return r;
+  802055:	83 c4 10             	add    $0x10,%esp
+  802058:	89 f3                	mov    %esi,%ebx
+}
+  80205a:	89 d8                	mov    %ebx,%eax
+  80205c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80205f:	5b                   	pop    %ebx
+  802060:	5e                   	pop    %esi
+  802061:	5d                   	pop    %ebp
+  802062:	c3                   	ret
+
+00802063 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  802063:	55                   	push   %ebp
+  802064:	89 e5                	mov    %esp,%ebp
+  802066:	57                   	push   %edi
+  802067:	56                   	push   %esi
+  802068:	53                   	push   %ebx
+  802069:	83 ec 0c             	sub    $0xc,%esp
+  80206c:	89 c7                	mov    %eax,%edi
+  80206e:	89 d3                	mov    %edx,%ebx
+  802070:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802072:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  802079:	74 2d                	je     8020a8 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80207b:	6a 07                	push   $0x7
+  80207d:	68 00 f0 80 00       	push   $0x80f000
+  802082:	57                   	push   %edi
+  802083:	ff 35 00 70 80 00    	push   0x807000
+  802089:	e8 1b f9 ff ff       	call   8019a9 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  80208e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802095:	6a 00                	push   $0x0
+  802097:	56                   	push   %esi
+  802098:	53                   	push   %ebx
+  802099:	6a 00                	push   $0x0
+  80209b:	e8 bb f7 ff ff       	call   80185b <ipc_recv_pages>
+}
+  8020a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020a3:	5b                   	pop    %ebx
+  8020a4:	5e                   	pop    %esi
+  8020a5:	5f                   	pop    %edi
+  8020a6:	5d                   	pop    %ebp
+  8020a7:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020a8:	83 ec 0c             	sub    $0xc,%esp
+  8020ab:	6a 01                	push   $0x1
+  8020ad:	e8 ec f9 ff ff       	call   801a9e <ipc_find_env>
+  8020b2:	a3 00 70 80 00       	mov    %eax,0x807000
+  8020b7:	83 c4 10             	add    $0x10,%esp
+  8020ba:	eb bf                	jmp    80207b <fsipc_pages+0x18>
+
+008020bc <fsipc>:
+{
+  8020bc:	55                   	push   %ebp
+  8020bd:	89 e5                	mov    %esp,%ebp
+  8020bf:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  8020c2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020c7:	e8 97 ff ff ff       	call   802063 <fsipc_pages>
+}
+  8020cc:	c9                   	leave
+  8020cd:	c3                   	ret
+
+008020ce <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8020ce:	55                   	push   %ebp
+  8020cf:	89 e5                	mov    %esp,%ebp
+  8020d1:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8020d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020d7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020da:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  8020df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020e2:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8020e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ec:	b8 02 00 00 00       	mov    $0x2,%eax
+  8020f1:	e8 c6 ff ff ff       	call   8020bc <fsipc>
+}
+  8020f6:	c9                   	leave
+  8020f7:	c3                   	ret
+
+008020f8 <devfile_flush>:
+{
+  8020f8:	55                   	push   %ebp
+  8020f9:	89 e5                	mov    %esp,%ebp
+  8020fb:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8020fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802101:	8b 40 0c             	mov    0xc(%eax),%eax
+  802104:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802109:	ba 00 00 00 00       	mov    $0x0,%edx
+  80210e:	b8 06 00 00 00       	mov    $0x6,%eax
+  802113:	e8 a4 ff ff ff       	call   8020bc <fsipc>
+}
+  802118:	c9                   	leave
+  802119:	c3                   	ret
+
+0080211a <devfile_stat>:
+{
+  80211a:	55                   	push   %ebp
+  80211b:	89 e5                	mov    %esp,%ebp
+  80211d:	53                   	push   %ebx
+  80211e:	83 ec 04             	sub    $0x4,%esp
+  802121:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802124:	8b 45 08             	mov    0x8(%ebp),%eax
+  802127:	8b 40 0c             	mov    0xc(%eax),%eax
+  80212a:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80212f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802134:	b8 05 00 00 00       	mov    $0x5,%eax
+  802139:	e8 7e ff ff ff       	call   8020bc <fsipc>
+  80213e:	85 c0                	test   %eax,%eax
+  802140:	78 2c                	js     80216e <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802142:	83 ec 08             	sub    $0x8,%esp
+  802145:	68 00 f0 80 00       	push   $0x80f000
+  80214a:	53                   	push   %ebx
+  80214b:	e8 c9 e6 ff ff       	call   800819 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802150:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  802155:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80215b:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  802160:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802166:	83 c4 10             	add    $0x10,%esp
+  802169:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80216e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802171:	c9                   	leave
+  802172:	c3                   	ret
+
+00802173 <devfile_write>:
+{
+  802173:	55                   	push   %ebp
+  802174:	89 e5                	mov    %esp,%ebp
+  802176:	83 ec 0c             	sub    $0xc,%esp
+  802179:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80217c:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802181:	39 d0                	cmp    %edx,%eax
+  802183:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802186:	8b 55 08             	mov    0x8(%ebp),%edx
+  802189:	8b 52 0c             	mov    0xc(%edx),%edx
+  80218c:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  802192:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  802197:	50                   	push   %eax
+  802198:	ff 75 0c             	push   0xc(%ebp)
+  80219b:	68 08 f0 80 00       	push   $0x80f008
+  8021a0:	e8 fa e7 ff ff       	call   80099f <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8021a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021aa:	b8 04 00 00 00       	mov    $0x4,%eax
+  8021af:	e8 08 ff ff ff       	call   8020bc <fsipc>
+}
+  8021b4:	c9                   	leave
+  8021b5:	c3                   	ret
+
+008021b6 <devfile_read>:
+{
+  8021b6:	55                   	push   %ebp
+  8021b7:	89 e5                	mov    %esp,%ebp
+  8021b9:	57                   	push   %edi
+  8021ba:	56                   	push   %esi
+  8021bb:	53                   	push   %ebx
+  8021bc:	83 ec 1c             	sub    $0x1c,%esp
+  8021bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8021c2:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8021c5:	89 fe                	mov    %edi,%esi
+  8021c7:	c1 ee 0c             	shr    $0xc,%esi
+  8021ca:	b8 20 00 00 00       	mov    $0x20,%eax
+  8021cf:	39 c6                	cmp    %eax,%esi
+  8021d1:	0f 47 f0             	cmova  %eax,%esi
+  8021d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021dc:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8021df:	eb 14                	jmp    8021f5 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8021e1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  8021e8:	05 00 10 00 00       	add    $0x1000,%eax
+  8021ed:	f6 c6 06             	test   $0x6,%dh
+  8021f0:	75 42                	jne    802234 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8021f2:	83 c1 01             	add    $0x1,%ecx
+  8021f5:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8021f8:	39 f1                	cmp    %esi,%ecx
+  8021fa:	0f 84 95 00 00 00    	je     802295 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  802200:	89 c2                	mov    %eax,%edx
+  802202:	c1 ea 16             	shr    $0x16,%edx
+  802205:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  80220c:	f6 c2 01             	test   $0x1,%dl
+  80220f:	74 23                	je     802234 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  802211:	89 c2                	mov    %eax,%edx
+  802213:	c1 ea 0c             	shr    $0xc,%edx
+  802216:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  80221d:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  802223:	74 0f                	je     802234 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  802225:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  80222c:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  802232:	75 ad                	jne    8021e1 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  802234:	85 c9                	test   %ecx,%ecx
+  802236:	74 11                	je     802249 <devfile_read+0x93>
+  802238:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80223f:	75 08                	jne    802249 <devfile_read+0x93>
+  802241:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  802247:	74 50                	je     802299 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802249:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80224c:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  802251:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802257:	ba 00 00 00 00       	mov    $0x0,%edx
+  80225c:	b8 03 00 00 00       	mov    $0x3,%eax
+  802261:	e8 56 fe ff ff       	call   8020bc <fsipc>
+  802266:	89 c6                	mov    %eax,%esi
+  802268:	85 c0                	test   %eax,%eax
+  80226a:	78 1f                	js     80228b <devfile_read+0xd5>
+	assert(r <= n);
+  80226c:	39 c7                	cmp    %eax,%edi
+  80226e:	72 50                	jb     8022c0 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  802270:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802275:	7f 62                	jg     8022d9 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  802277:	83 ec 04             	sub    $0x4,%esp
+  80227a:	50                   	push   %eax
+  80227b:	68 00 f0 80 00       	push   $0x80f000
+  802280:	ff 75 0c             	push   0xc(%ebp)
+  802283:	e8 17 e7 ff ff       	call   80099f <memmove>
+	return r;
+  802288:	83 c4 10             	add    $0x10,%esp
+}
+  80228b:	89 f0                	mov    %esi,%eax
+  80228d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802290:	5b                   	pop    %ebx
+  802291:	5e                   	pop    %esi
+  802292:	5f                   	pop    %edi
+  802293:	5d                   	pop    %ebp
+  802294:	c3                   	ret
+  802295:	89 f1                	mov    %esi,%ecx
+  802297:	eb 9b                	jmp    802234 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  802299:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80229c:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  8022a1:	89 c8                	mov    %ecx,%eax
+  8022a3:	c1 e0 0c             	shl    $0xc,%eax
+  8022a6:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  8022ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022ae:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8022b3:	e8 ab fd ff ff       	call   802063 <fsipc_pages>
+  8022b8:	89 c6                	mov    %eax,%esi
+  8022ba:	85 c0                	test   %eax,%eax
+  8022bc:	78 8b                	js     802249 <devfile_read+0x93>
+  8022be:	eb cb                	jmp    80228b <devfile_read+0xd5>
+	assert(r <= n);
+  8022c0:	68 6c 58 80 00       	push   $0x80586c
+  8022c5:	68 73 58 80 00       	push   $0x805873
+  8022ca:	68 a0 00 00 00       	push   $0xa0
+  8022cf:	68 88 58 80 00       	push   $0x805888
+  8022d4:	e8 7e de ff ff       	call   800157 <_panic>
+	assert(r <= PGSIZE);
+  8022d9:	68 93 58 80 00       	push   $0x805893
+  8022de:	68 73 58 80 00       	push   $0x805873
+  8022e3:	68 a1 00 00 00       	push   $0xa1
+  8022e8:	68 88 58 80 00       	push   $0x805888
+  8022ed:	e8 65 de ff ff       	call   800157 <_panic>
+
+008022f2 <open>:
+{
+  8022f2:	55                   	push   %ebp
+  8022f3:	89 e5                	mov    %esp,%ebp
+  8022f5:	56                   	push   %esi
+  8022f6:	53                   	push   %ebx
+  8022f7:	83 ec 1c             	sub    $0x1c,%esp
+  8022fa:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8022fd:	56                   	push   %esi
+  8022fe:	e8 db e4 ff ff       	call   8007de <strlen>
+  802303:	83 c4 10             	add    $0x10,%esp
+  802306:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80230b:	7f 6c                	jg     802379 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  80230d:	83 ec 0c             	sub    $0xc,%esp
+  802310:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802313:	50                   	push   %eax
+  802314:	e8 eb f7 ff ff       	call   801b04 <fd_alloc>
+  802319:	89 c3                	mov    %eax,%ebx
+  80231b:	83 c4 10             	add    $0x10,%esp
+  80231e:	85 c0                	test   %eax,%eax
+  802320:	78 3c                	js     80235e <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802322:	83 ec 08             	sub    $0x8,%esp
+  802325:	56                   	push   %esi
+  802326:	68 00 f0 80 00       	push   $0x80f000
+  80232b:	e8 e9 e4 ff ff       	call   800819 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802330:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802333:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802338:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80233b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802340:	e8 77 fd ff ff       	call   8020bc <fsipc>
+  802345:	89 c3                	mov    %eax,%ebx
+  802347:	83 c4 10             	add    $0x10,%esp
+  80234a:	85 c0                	test   %eax,%eax
+  80234c:	78 19                	js     802367 <open+0x75>
+	return fd2num(fd);
+  80234e:	83 ec 0c             	sub    $0xc,%esp
+  802351:	ff 75 f4             	push   -0xc(%ebp)
+  802354:	e8 84 f7 ff ff       	call   801add <fd2num>
+  802359:	89 c3                	mov    %eax,%ebx
+  80235b:	83 c4 10             	add    $0x10,%esp
+}
+  80235e:	89 d8                	mov    %ebx,%eax
+  802360:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802363:	5b                   	pop    %ebx
+  802364:	5e                   	pop    %esi
+  802365:	5d                   	pop    %ebp
+  802366:	c3                   	ret
+		fd_close(fd, 0);
+  802367:	83 ec 08             	sub    $0x8,%esp
+  80236a:	6a 00                	push   $0x0
+  80236c:	ff 75 f4             	push   -0xc(%ebp)
+  80236f:	e8 80 f8 ff ff       	call   801bf4 <fd_close>
+		return r;
+  802374:	83 c4 10             	add    $0x10,%esp
+  802377:	eb e5                	jmp    80235e <open+0x6c>
+		return -E_BAD_PATH;
+  802379:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80237e:	eb de                	jmp    80235e <open+0x6c>
+
+00802380 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802380:	55                   	push   %ebp
+  802381:	89 e5                	mov    %esp,%ebp
+  802383:	53                   	push   %ebx
+  802384:	83 ec 10             	sub    $0x10,%esp
+  802387:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80238a:	53                   	push   %ebx
+  80238b:	e8 4e e4 ff ff       	call   8007de <strlen>
+  802390:	83 c4 10             	add    $0x10,%esp
+  802393:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802398:	7f 25                	jg     8023bf <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80239a:	83 ec 08             	sub    $0x8,%esp
+  80239d:	53                   	push   %ebx
+  80239e:	68 00 f0 80 00       	push   $0x80f000
+  8023a3:	e8 71 e4 ff ff       	call   800819 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8023a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ad:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023b2:	e8 05 fd ff ff       	call   8020bc <fsipc>
+  8023b7:	83 c4 10             	add    $0x10,%esp
+}
+  8023ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023bd:	c9                   	leave
+  8023be:	c3                   	ret
+		return -E_BAD_PATH;
+  8023bf:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8023c4:	eb f4                	jmp    8023ba <remove+0x3a>
+
+008023c6 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8023c6:	55                   	push   %ebp
+  8023c7:	89 e5                	mov    %esp,%ebp
+  8023c9:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8023cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023d1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8023d6:	e8 e1 fc ff ff       	call   8020bc <fsipc>
+}
+  8023db:	c9                   	leave
+  8023dc:	c3                   	ret
+
+008023dd <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  8023dd:	55                   	push   %ebp
+  8023de:	89 e5                	mov    %esp,%ebp
+  8023e0:	53                   	push   %ebx
+  8023e1:	83 ec 04             	sub    $0x4,%esp
+  8023e4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  8023e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8023f1:	e8 c6 fc ff ff       	call   8020bc <fsipc>
+  8023f6:	85 c0                	test   %eax,%eax
+  8023f8:	78 3c                	js     802436 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  8023fa:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  8023ff:	89 03                	mov    %eax,(%ebx)
+  802401:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  802406:	89 43 04             	mov    %eax,0x4(%ebx)
+  802409:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  80240e:	89 43 08             	mov    %eax,0x8(%ebx)
+  802411:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  802416:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802419:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  80241e:	89 43 10             	mov    %eax,0x10(%ebx)
+  802421:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  802426:	89 43 14             	mov    %eax,0x14(%ebx)
+  802429:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  80242e:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  802431:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802436:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802439:	c9                   	leave
+  80243a:	c3                   	ret
+
+0080243b <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  80243b:	55                   	push   %ebp
+  80243c:	89 e5                	mov    %esp,%ebp
+  80243e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  802441:	8b 45 08             	mov    0x8(%ebp),%eax
+  802444:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  802449:	ba 00 00 00 00       	mov    $0x0,%edx
+  80244e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802453:	e8 64 fc ff ff       	call   8020bc <fsipc>
+}
+  802458:	c9                   	leave
+  802459:	c3                   	ret
+
+0080245a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80245a:	55                   	push   %ebp
+  80245b:	89 e5                	mov    %esp,%ebp
+  80245d:	56                   	push   %esi
+  80245e:	53                   	push   %ebx
+  80245f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802462:	83 ec 0c             	sub    $0xc,%esp
+  802465:	ff 75 08             	push   0x8(%ebp)
+  802468:	e8 80 f6 ff ff       	call   801aed <fd2data>
+  80246d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80246f:	83 c4 08             	add    $0x8,%esp
+  802472:	68 9f 58 80 00       	push   $0x80589f
+  802477:	53                   	push   %ebx
+  802478:	e8 9c e3 ff ff       	call   800819 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80247d:	8b 46 04             	mov    0x4(%esi),%eax
+  802480:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  802486:	2b 0e                	sub    (%esi),%ecx
+  802488:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80248d:	89 c8                	mov    %ecx,%eax
+  80248f:	f7 e2                	mul    %edx
+  802491:	c1 ea 0c             	shr    $0xc,%edx
+  802494:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80249a:	29 d1                	sub    %edx,%ecx
+  80249c:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8024a2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024a9:	00 00 00 
+	stat->st_dev = &devpipe;
+  8024ac:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  8024b3:	60 80 00 
+	return 0;
+}
+  8024b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024be:	5b                   	pop    %ebx
+  8024bf:	5e                   	pop    %esi
+  8024c0:	5d                   	pop    %ebp
+  8024c1:	c3                   	ret
+
+008024c2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8024c2:	55                   	push   %ebp
+  8024c3:	89 e5                	mov    %esp,%ebp
+  8024c5:	53                   	push   %ebx
+  8024c6:	83 ec 0c             	sub    $0xc,%esp
+  8024c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8024cc:	53                   	push   %ebx
+  8024cd:	6a 00                	push   $0x0
+  8024cf:	e8 bd e8 ff ff       	call   800d91 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8024d4:	89 1c 24             	mov    %ebx,(%esp)
+  8024d7:	e8 11 f6 ff ff       	call   801aed <fd2data>
+  8024dc:	83 c4 08             	add    $0x8,%esp
+  8024df:	50                   	push   %eax
+  8024e0:	6a 00                	push   $0x0
+  8024e2:	e8 aa e8 ff ff       	call   800d91 <sys_page_unmap>
+}
+  8024e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024ea:	c9                   	leave
+  8024eb:	c3                   	ret
+
+008024ec <_pipeisclosed>:
+{
+  8024ec:	55                   	push   %ebp
+  8024ed:	89 e5                	mov    %esp,%ebp
+  8024ef:	57                   	push   %edi
+  8024f0:	56                   	push   %esi
+  8024f1:	53                   	push   %ebx
+  8024f2:	83 ec 1c             	sub    $0x1c,%esp
+  8024f5:	89 c7                	mov    %eax,%edi
+  8024f7:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8024f9:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8024fe:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802501:	83 ec 0c             	sub    $0xc,%esp
+  802504:	57                   	push   %edi
+  802505:	e8 84 2b 00 00       	call   80508e <pageref>
+  80250a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80250d:	89 34 24             	mov    %esi,(%esp)
+  802510:	e8 79 2b 00 00       	call   80508e <pageref>
+		nn = thisenv->env_runs;
+  802515:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  80251b:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80251e:	83 c4 10             	add    $0x10,%esp
+  802521:	39 cb                	cmp    %ecx,%ebx
+  802523:	74 1b                	je     802540 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802525:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802528:	75 cf                	jne    8024f9 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80252a:	8b 42 58             	mov    0x58(%edx),%eax
+  80252d:	6a 01                	push   $0x1
+  80252f:	50                   	push   %eax
+  802530:	53                   	push   %ebx
+  802531:	68 a6 58 80 00       	push   $0x8058a6
+  802536:	e8 f7 dc ff ff       	call   800232 <cprintf>
+  80253b:	83 c4 10             	add    $0x10,%esp
+  80253e:	eb b9                	jmp    8024f9 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802540:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802543:	0f 94 c0             	sete   %al
+  802546:	0f b6 c0             	movzbl %al,%eax
+}
+  802549:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80254c:	5b                   	pop    %ebx
+  80254d:	5e                   	pop    %esi
+  80254e:	5f                   	pop    %edi
+  80254f:	5d                   	pop    %ebp
+  802550:	c3                   	ret
+
+00802551 <devpipe_read>:
+{
+  802551:	55                   	push   %ebp
+  802552:	89 e5                	mov    %esp,%ebp
+  802554:	57                   	push   %edi
+  802555:	56                   	push   %esi
+  802556:	53                   	push   %ebx
+  802557:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80255a:	ff 75 08             	push   0x8(%ebp)
+  80255d:	e8 8b f5 ff ff       	call   801aed <fd2data>
+  802562:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  802564:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  802567:	8d 40 04             	lea    0x4(%eax),%eax
+  80256a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80256d:	8b 7b 04             	mov    0x4(%ebx),%edi
+  802570:	8b 0b                	mov    (%ebx),%ecx
+  802572:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  802578:	29 ce                	sub    %ecx,%esi
+  80257a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80257f:	f7 e6                	mul    %esi
+  802581:	c1 ea 0c             	shr    $0xc,%edx
+  802584:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  80258a:	29 c6                	sub    %eax,%esi
+  80258c:	89 f2                	mov    %esi,%edx
+  80258e:	75 43                	jne    8025d3 <devpipe_read+0x82>
+		ref = pageref(p);
+  802590:	83 ec 0c             	sub    $0xc,%esp
+  802593:	53                   	push   %ebx
+  802594:	e8 f5 2a 00 00       	call   80508e <pageref>
+  802599:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  80259b:	89 da                	mov    %ebx,%edx
+  80259d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a0:	e8 47 ff ff ff       	call   8024ec <_pipeisclosed>
+  8025a5:	83 c4 10             	add    $0x10,%esp
+  8025a8:	85 c0                	test   %eax,%eax
+  8025aa:	0f 85 c1 00 00 00    	jne    802671 <devpipe_read+0x120>
+	*sleeping = 1;
+  8025b0:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  8025b7:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8025bc:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  8025bf:	75 ac                	jne    80256d <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  8025c1:	83 ec 04             	sub    $0x4,%esp
+  8025c4:	56                   	push   %esi
+  8025c5:	57                   	push   %edi
+  8025c6:	ff 75 e4             	push   -0x1c(%ebp)
+  8025c9:	e8 17 ec ff ff       	call   8011e5 <sys_futex_wait>
+  8025ce:	83 c4 10             	add    $0x10,%esp
+  8025d1:	eb 9a                	jmp    80256d <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  8025d3:	39 75 10             	cmp    %esi,0x10(%ebp)
+  8025d6:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  8025da:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8025dc:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8025e1:	f7 e1                	mul    %ecx
+  8025e3:	c1 ea 0b             	shr    $0xb,%edx
+  8025e6:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8025ec:	29 c1                	sub    %eax,%ecx
+  8025ee:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  8025f0:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8025f5:	29 cf                	sub    %ecx,%edi
+  8025f7:	39 f7                	cmp    %esi,%edi
+  8025f9:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  8025fc:	8d 43 10             	lea    0x10(%ebx),%eax
+  8025ff:	83 ec 04             	sub    $0x4,%esp
+  802602:	57                   	push   %edi
+  802603:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802606:	01 c2                	add    %eax,%edx
+  802608:	52                   	push   %edx
+  802609:	ff 75 0c             	push   0xc(%ebp)
+  80260c:	e8 8e e3 ff ff       	call   80099f <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  802611:	83 c4 0c             	add    $0xc,%esp
+  802614:	89 f1                	mov    %esi,%ecx
+  802616:	29 f9                	sub    %edi,%ecx
+  802618:	51                   	push   %ecx
+  802619:	ff 75 e4             	push   -0x1c(%ebp)
+  80261c:	89 f8                	mov    %edi,%eax
+  80261e:	03 45 0c             	add    0xc(%ebp),%eax
+  802621:	50                   	push   %eax
+  802622:	e8 78 e3 ff ff       	call   80099f <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  802627:	89 f1                	mov    %esi,%ecx
+  802629:	03 0b                	add    (%ebx),%ecx
+  80262b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802630:	f7 e1                	mul    %ecx
+  802632:	c1 ea 0c             	shr    $0xc,%edx
+  802635:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80263b:	29 d1                	sub    %edx,%ecx
+  80263d:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  80263f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802644:	83 c4 10             	add    $0x10,%esp
+  802647:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  80264b:	75 0a                	jne    802657 <devpipe_read+0x106>
+	return n;
+  80264d:	89 f0                	mov    %esi,%eax
+}
+  80264f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802652:	5b                   	pop    %ebx
+  802653:	5e                   	pop    %esi
+  802654:	5f                   	pop    %edi
+  802655:	5d                   	pop    %ebp
+  802656:	c3                   	ret
+		*sleeping = 0;
+  802657:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  80265e:	83 ec 08             	sub    $0x8,%esp
+  802661:	68 00 04 00 00       	push   $0x400
+  802666:	53                   	push   %ebx
+  802667:	e8 c9 eb ff ff       	call   801235 <sys_futex_wake>
+  80266c:	83 c4 10             	add    $0x10,%esp
+  80266f:	eb dc                	jmp    80264d <devpipe_read+0xfc>
+			return 0;
+  802671:	b8 00 00 00 00       	mov    $0x0,%eax
+  802676:	eb d7                	jmp    80264f <devpipe_read+0xfe>
+
+00802678 <devpipe_write>:
+{
+  802678:	55                   	push   %ebp
+  802679:	89 e5                	mov    %esp,%ebp
+  80267b:	57                   	push   %edi
+  80267c:	56                   	push   %esi
+  80267d:	53                   	push   %ebx
+  80267e:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802681:	ff 75 08             	push   0x8(%ebp)
+  802684:	e8 64 f4 ff ff       	call   801aed <fd2data>
+  802689:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  80268b:	83 c4 10             	add    $0x10,%esp
+  80268e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802695:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802698:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80269b:	0f 83 23 01 00 00    	jae    8027c4 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8026a1:	8b 77 04             	mov    0x4(%edi),%esi
+  8026a4:	8b 1f                	mov    (%edi),%ebx
+  8026a6:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  8026ac:	29 d9                	sub    %ebx,%ecx
+  8026ae:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8026b3:	f7 e1                	mul    %ecx
+  8026b5:	c1 ea 0c             	shr    $0xc,%edx
+  8026b8:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8026be:	29 c1                	sub    %eax,%ecx
+  8026c0:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8026c2:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8026c8:	75 40                	jne    80270a <devpipe_write+0x92>
+			ref = pageref(p);
+  8026ca:	83 ec 0c             	sub    $0xc,%esp
+  8026cd:	57                   	push   %edi
+  8026ce:	e8 bb 29 00 00       	call   80508e <pageref>
+  8026d3:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  8026d5:	89 fa                	mov    %edi,%edx
+  8026d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026da:	e8 0d fe ff ff       	call   8024ec <_pipeisclosed>
+  8026df:	83 c4 10             	add    $0x10,%esp
+  8026e2:	85 c0                	test   %eax,%eax
+  8026e4:	0f 85 d5 00 00 00    	jne    8027bf <devpipe_write+0x147>
+	*sleeping = 1;
+  8026ea:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  8026f1:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8026f6:	39 1f                	cmp    %ebx,(%edi)
+  8026f8:	75 a7                	jne    8026a1 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  8026fa:	83 ec 04             	sub    $0x4,%esp
+  8026fd:	56                   	push   %esi
+  8026fe:	53                   	push   %ebx
+  8026ff:	57                   	push   %edi
+  802700:	e8 e0 ea ff ff       	call   8011e5 <sys_futex_wait>
+  802705:	83 c4 10             	add    $0x10,%esp
+  802708:	eb 97                	jmp    8026a1 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80270a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80270d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802710:	29 c1                	sub    %eax,%ecx
+  802712:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802717:	89 d8                	mov    %ebx,%eax
+  802719:	29 d0                	sub    %edx,%eax
+  80271b:	39 c1                	cmp    %eax,%ecx
+  80271d:	0f 46 c1             	cmovbe %ecx,%eax
+  802720:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  802722:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802727:	f7 e6                	mul    %esi
+  802729:	c1 ea 0b             	shr    $0xb,%edx
+  80272c:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802732:	29 c6                	sub    %eax,%esi
+  802734:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802736:	29 f3                	sub    %esi,%ebx
+  802738:	39 cb                	cmp    %ecx,%ebx
+  80273a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80273d:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  802740:	8d 77 10             	lea    0x10(%edi),%esi
+  802743:	83 ec 04             	sub    $0x4,%esp
+  802746:	53                   	push   %ebx
+  802747:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80274a:	03 45 0c             	add    0xc(%ebp),%eax
+  80274d:	50                   	push   %eax
+  80274e:	01 f2                	add    %esi,%edx
+  802750:	52                   	push   %edx
+  802751:	e8 49 e2 ff ff       	call   80099f <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802756:	83 c4 0c             	add    $0xc,%esp
+  802759:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80275c:	29 d8                	sub    %ebx,%eax
+  80275e:	50                   	push   %eax
+  80275f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802762:	01 d3                	add    %edx,%ebx
+  802764:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802767:	53                   	push   %ebx
+  802768:	56                   	push   %esi
+  802769:	e8 31 e2 ff ff       	call   80099f <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  80276e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802771:	03 4f 04             	add    0x4(%edi),%ecx
+  802774:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802779:	f7 e1                	mul    %ecx
+  80277b:	c1 ea 0c             	shr    $0xc,%edx
+  80277e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802784:	29 d1                	sub    %edx,%ecx
+  802786:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  802789:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80278e:	83 c4 10             	add    $0x10,%esp
+  802791:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802795:	75 0b                	jne    8027a2 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802797:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  80279a:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80279d:	e9 f3 fe ff ff       	jmp    802695 <devpipe_write+0x1d>
+		*sleeping = 0;
+  8027a2:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8027a9:	83 ec 08             	sub    $0x8,%esp
+  8027ac:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  8027b1:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  8027b4:	50                   	push   %eax
+  8027b5:	e8 7b ea ff ff       	call   801235 <sys_futex_wake>
+  8027ba:	83 c4 10             	add    $0x10,%esp
+  8027bd:	eb d8                	jmp    802797 <devpipe_write+0x11f>
+				return 0;
+  8027bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027c7:	5b                   	pop    %ebx
+  8027c8:	5e                   	pop    %esi
+  8027c9:	5f                   	pop    %edi
+  8027ca:	5d                   	pop    %ebp
+  8027cb:	c3                   	ret
+
+008027cc <pipe>:
+{
+  8027cc:	55                   	push   %ebp
+  8027cd:	89 e5                	mov    %esp,%ebp
+  8027cf:	56                   	push   %esi
+  8027d0:	53                   	push   %ebx
+  8027d1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8027d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027d7:	50                   	push   %eax
+  8027d8:	e8 27 f3 ff ff       	call   801b04 <fd_alloc>
+  8027dd:	89 c3                	mov    %eax,%ebx
+  8027df:	83 c4 10             	add    $0x10,%esp
+  8027e2:	85 c0                	test   %eax,%eax
+  8027e4:	0f 88 23 01 00 00    	js     80290d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027ea:	83 ec 04             	sub    $0x4,%esp
+  8027ed:	68 07 04 00 00       	push   $0x407
+  8027f2:	ff 75 f4             	push   -0xc(%ebp)
+  8027f5:	6a 00                	push   $0x0
+  8027f7:	e8 10 e5 ff ff       	call   800d0c <sys_page_alloc>
+  8027fc:	89 c3                	mov    %eax,%ebx
+  8027fe:	83 c4 10             	add    $0x10,%esp
+  802801:	85 c0                	test   %eax,%eax
+  802803:	0f 88 04 01 00 00    	js     80290d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802809:	83 ec 0c             	sub    $0xc,%esp
+  80280c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80280f:	50                   	push   %eax
+  802810:	e8 ef f2 ff ff       	call   801b04 <fd_alloc>
+  802815:	89 c3                	mov    %eax,%ebx
+  802817:	83 c4 10             	add    $0x10,%esp
+  80281a:	85 c0                	test   %eax,%eax
+  80281c:	0f 88 db 00 00 00    	js     8028fd <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802822:	83 ec 04             	sub    $0x4,%esp
+  802825:	68 07 04 00 00       	push   $0x407
+  80282a:	ff 75 f0             	push   -0x10(%ebp)
+  80282d:	6a 00                	push   $0x0
+  80282f:	e8 d8 e4 ff ff       	call   800d0c <sys_page_alloc>
+  802834:	89 c3                	mov    %eax,%ebx
+  802836:	83 c4 10             	add    $0x10,%esp
+  802839:	85 c0                	test   %eax,%eax
+  80283b:	0f 88 bc 00 00 00    	js     8028fd <pipe+0x131>
+	va = fd2data(fd0);
+  802841:	83 ec 0c             	sub    $0xc,%esp
+  802844:	ff 75 f4             	push   -0xc(%ebp)
+  802847:	e8 a1 f2 ff ff       	call   801aed <fd2data>
+  80284c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80284e:	83 c4 0c             	add    $0xc,%esp
+  802851:	68 07 04 00 00       	push   $0x407
+  802856:	50                   	push   %eax
+  802857:	6a 00                	push   $0x0
+  802859:	e8 ae e4 ff ff       	call   800d0c <sys_page_alloc>
+  80285e:	89 c3                	mov    %eax,%ebx
+  802860:	83 c4 10             	add    $0x10,%esp
+  802863:	85 c0                	test   %eax,%eax
+  802865:	0f 88 82 00 00 00    	js     8028ed <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80286b:	83 ec 0c             	sub    $0xc,%esp
+  80286e:	ff 75 f0             	push   -0x10(%ebp)
+  802871:	e8 77 f2 ff ff       	call   801aed <fd2data>
+  802876:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80287d:	50                   	push   %eax
+  80287e:	6a 00                	push   $0x0
+  802880:	56                   	push   %esi
+  802881:	6a 00                	push   $0x0
+  802883:	e8 c7 e4 ff ff       	call   800d4f <sys_page_map>
+  802888:	89 c3                	mov    %eax,%ebx
+  80288a:	83 c4 20             	add    $0x20,%esp
+  80288d:	85 c0                	test   %eax,%eax
+  80288f:	78 4e                	js     8028df <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802891:	a1 20 60 80 00       	mov    0x806020,%eax
+  802896:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802899:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80289b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80289e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8028a5:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8028a8:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8028aa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8028ad:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8028b4:	83 ec 0c             	sub    $0xc,%esp
+  8028b7:	ff 75 f4             	push   -0xc(%ebp)
+  8028ba:	e8 1e f2 ff ff       	call   801add <fd2num>
+  8028bf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028c2:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8028c4:	83 c4 04             	add    $0x4,%esp
+  8028c7:	ff 75 f0             	push   -0x10(%ebp)
+  8028ca:	e8 0e f2 ff ff       	call   801add <fd2num>
+  8028cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028d2:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8028d5:	83 c4 10             	add    $0x10,%esp
+  8028d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028dd:	eb 2e                	jmp    80290d <pipe+0x141>
+	sys_page_unmap(0, va);
+  8028df:	83 ec 08             	sub    $0x8,%esp
+  8028e2:	56                   	push   %esi
+  8028e3:	6a 00                	push   $0x0
+  8028e5:	e8 a7 e4 ff ff       	call   800d91 <sys_page_unmap>
+  8028ea:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8028ed:	83 ec 08             	sub    $0x8,%esp
+  8028f0:	ff 75 f0             	push   -0x10(%ebp)
+  8028f3:	6a 00                	push   $0x0
+  8028f5:	e8 97 e4 ff ff       	call   800d91 <sys_page_unmap>
+  8028fa:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8028fd:	83 ec 08             	sub    $0x8,%esp
+  802900:	ff 75 f4             	push   -0xc(%ebp)
+  802903:	6a 00                	push   $0x0
+  802905:	e8 87 e4 ff ff       	call   800d91 <sys_page_unmap>
+  80290a:	83 c4 10             	add    $0x10,%esp
+}
+  80290d:	89 d8                	mov    %ebx,%eax
+  80290f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802912:	5b                   	pop    %ebx
+  802913:	5e                   	pop    %esi
+  802914:	5d                   	pop    %ebp
+  802915:	c3                   	ret
+
+00802916 <pipeisclosed>:
+{
+  802916:	55                   	push   %ebp
+  802917:	89 e5                	mov    %esp,%ebp
+  802919:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80291c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80291f:	50                   	push   %eax
+  802920:	ff 75 08             	push   0x8(%ebp)
+  802923:	e8 30 f2 ff ff       	call   801b58 <fd_lookup>
+  802928:	83 c4 10             	add    $0x10,%esp
+  80292b:	85 c0                	test   %eax,%eax
+  80292d:	78 18                	js     802947 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80292f:	83 ec 0c             	sub    $0xc,%esp
+  802932:	ff 75 f4             	push   -0xc(%ebp)
+  802935:	e8 b3 f1 ff ff       	call   801aed <fd2data>
+  80293a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80293c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80293f:	e8 a8 fb ff ff       	call   8024ec <_pipeisclosed>
+  802944:	83 c4 10             	add    $0x10,%esp
+}
+  802947:	c9                   	leave
+  802948:	c3                   	ret
+
+00802949 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802949:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  80294b:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  802951:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802957:	81 c2 34 01 00 00    	add    $0x134,%edx
+  80295d:	39 d0                	cmp    %edx,%eax
+  80295f:	74 2e                	je     80298f <segment_lookup+0x46>
+{
+  802961:	55                   	push   %ebp
+  802962:	89 e5                	mov    %esp,%ebp
+  802964:	57                   	push   %edi
+  802965:	56                   	push   %esi
+  802966:	53                   	push   %ebx
+  802967:	eb 07                	jmp    802970 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802969:	83 c0 20             	add    $0x20,%eax
+  80296c:	39 d0                	cmp    %edx,%eax
+  80296e:	74 15                	je     802985 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802970:	8b 18                	mov    (%eax),%ebx
+  802972:	39 d9                	cmp    %ebx,%ecx
+  802974:	72 f3                	jb     802969 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  802976:	8b 38                	mov    (%eax),%edi
+  802978:	8b 58 04             	mov    0x4(%eax),%ebx
+  80297b:	89 ce                	mov    %ecx,%esi
+  80297d:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  80297f:	39 de                	cmp    %ebx,%esi
+  802981:	73 e6                	jae    802969 <segment_lookup+0x20>
+  802983:	eb 05                	jmp    80298a <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  802985:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80298a:	5b                   	pop    %ebx
+  80298b:	5e                   	pop    %esi
+  80298c:	5f                   	pop    %edi
+  80298d:	5d                   	pop    %ebp
+  80298e:	c3                   	ret
+	return NULL;
+  80298f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802994:	c3                   	ret
+
+00802995 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802995:	55                   	push   %ebp
+  802996:	89 e5                	mov    %esp,%ebp
+  802998:	53                   	push   %ebx
+  802999:	83 ec 04             	sub    $0x4,%esp
+  80299c:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80299e:	c1 e8 16             	shr    $0x16,%eax
+  8029a1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8029a8:	25 81 00 00 00       	and    $0x81,%eax
+  8029ad:	83 f8 01             	cmp    $0x1,%eax
+  8029b0:	75 6b                	jne    802a1d <page_is_clean+0x88>
+  8029b2:	89 da                	mov    %ebx,%edx
+  8029b4:	c1 ea 0c             	shr    $0xc,%edx
+  8029b7:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  8029be:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8029c3:	f6 c1 01             	test   $0x1,%cl
+  8029c6:	74 5a                	je     802a22 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  8029c8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8029cf:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  8029d5:	75 4b                	jne    802a22 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  8029d7:	89 d8                	mov    %ebx,%eax
+  8029d9:	e8 6b ff ff ff       	call   802949 <segment_lookup>
+  8029de:	89 c2                	mov    %eax,%edx
+		return 1;
+  8029e0:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  8029e5:	85 d2                	test   %edx,%edx
+  8029e7:	75 39                	jne    802a22 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  8029e9:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  8029ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f4:	eb 03                	jmp    8029f9 <page_is_clean+0x64>
+  8029f6:	83 c0 01             	add    $0x1,%eax
+  8029f9:	39 c2                	cmp    %eax,%edx
+  8029fb:	7e 19                	jle    802a16 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  8029fd:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  802a04:	72 f0                	jb     8029f6 <page_is_clean+0x61>
+  802a06:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  802a0d:	73 e7                	jae    8029f6 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  802a0f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a14:	eb 0c                	jmp    802a22 <page_is_clean+0x8d>
+	return 0;
+  802a16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a1b:	eb 05                	jmp    802a22 <page_is_clean+0x8d>
+		return 0;
+  802a1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a25:	c9                   	leave
+  802a26:	c3                   	ret
+
+00802a27 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  802a27:	55                   	push   %ebp
+  802a28:	89 e5                	mov    %esp,%ebp
+  802a2a:	57                   	push   %edi
+  802a2b:	56                   	push   %esi
+  802a2c:	53                   	push   %ebx
+  802a2d:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802a30:	be 00 00 00 00       	mov    $0x0,%esi
+  802a35:	eb 19                	jmp    802a50 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802a37:	f7 d3                	not    %ebx
+  802a39:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802a3f:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802a41:	83 c6 01             	add    $0x1,%esi
+  802a44:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802a4a:	0f 87 97 00 00 00    	ja     802ae7 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802a50:	89 f3                	mov    %esi,%ebx
+  802a52:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  802a58:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802a5e:	89 d8                	mov    %ebx,%eax
+  802a60:	c1 e8 0a             	shr    $0xa,%eax
+  802a63:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802a6a:	25 81 00 00 00       	and    $0x81,%eax
+  802a6f:	83 f8 01             	cmp    $0x1,%eax
+  802a72:	75 c3                	jne    802a37 <linear_walk+0x10>
+  802a74:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802a7a:	77 bb                	ja     802a37 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802a7c:	89 df                	mov    %ebx,%edi
+  802a7e:	c1 e7 0c             	shl    $0xc,%edi
+  802a81:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802a84:	89 f8                	mov    %edi,%eax
+  802a86:	e8 0a ff ff ff       	call   802995 <page_is_clean>
+  802a8b:	84 c0                	test   %al,%al
+  802a8d:	75 64                	jne    802af3 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a8f:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802a95:	77 aa                	ja     802a41 <linear_walk+0x1a>
+  802a97:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  802a9d:	72 a2                	jb     802a41 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802a9f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802aa6:	a8 01                	test   $0x1,%al
+  802aa8:	74 97                	je     802a41 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802aaa:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802ab1:	f6 c4 04             	test   $0x4,%ah
+  802ab4:	75 8b                	jne    802a41 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802ab6:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802abd:	f6 c4 02             	test   $0x2,%ah
+  802ac0:	0f 85 7b ff ff ff    	jne    802a41 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802ac6:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802acd:	c1 e8 0c             	shr    $0xc,%eax
+  802ad0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802ad3:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802ad8:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802adc:	66 83 f8 01          	cmp    $0x1,%ax
+  802ae0:	76 11                	jbe    802af3 <linear_walk+0xcc>
+  802ae2:	e9 5a ff ff ff       	jmp    802a41 <linear_walk+0x1a>
+  802ae7:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  802aec:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802af3:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  802af9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802afc:	83 c4 1c             	add    $0x1c,%esp
+  802aff:	5b                   	pop    %ebx
+  802b00:	5e                   	pop    %esi
+  802b01:	5f                   	pop    %edi
+  802b02:	5d                   	pop    %ebp
+  802b03:	c3                   	ret
+
+00802b04 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802b04:	55                   	push   %ebp
+  802b05:	89 e5                	mov    %esp,%ebp
+  802b07:	56                   	push   %esi
+  802b08:	53                   	push   %ebx
+  802b09:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  802b0b:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802b10:	83 e0 7f             	and    $0x7f,%eax
+  802b13:	c1 e0 04             	shl    $0x4,%eax
+  802b16:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  802b1c:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802b22:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802b28:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  802b2e:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802b33:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  802b36:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802b3b:	83 c0 01             	add    $0x1,%eax
+  802b3e:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  802b43:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802b46:	5b                   	pop    %ebx
+  802b47:	5e                   	pop    %esi
+  802b48:	5d                   	pop    %ebp
+  802b49:	c3                   	ret
+
+00802b4a <page_ring_enter>:
+{
+  802b4a:	55                   	push   %ebp
+  802b4b:	89 e5                	mov    %esp,%ebp
+  802b4d:	57                   	push   %edi
+  802b4e:	56                   	push   %esi
+  802b4f:	53                   	push   %ebx
+  802b50:	83 ec 18             	sub    $0x18,%esp
+  802b53:	89 c6                	mov    %eax,%esi
+  802b55:	89 d7                	mov    %edx,%edi
+  802b57:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802b59:	6a 00                	push   $0x0
+  802b5b:	6a 00                	push   $0x0
+  802b5d:	6a 00                	push   $0x0
+  802b5f:	6a 07                	push   $0x7
+  802b61:	ff 35 40 b0 80 00    	push   0x80b040
+  802b67:	e8 5b ee ff ff       	call   8019c7 <ipc_call>
+  802b6c:	83 c4 20             	add    $0x20,%esp
+  802b6f:	85 c0                	test   %eax,%eax
+  802b71:	79 22                	jns    802b95 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802b73:	50                   	push   %eax
+  802b74:	68 be 58 80 00       	push   $0x8058be
+  802b79:	68 13 02 00 00       	push   $0x213
+  802b7e:	68 d2 58 80 00       	push   $0x8058d2
+  802b83:	e8 cf d5 ff ff       	call   800157 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802b88:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802b8d:	83 c0 01             	add    $0x1,%eax
+  802b90:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802b95:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802b9b:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802ba0:	39 c2                	cmp    %eax,%edx
+  802ba2:	74 24                	je     802bc8 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802ba4:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802ba9:	83 e0 7f             	and    $0x7f,%eax
+  802bac:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802bb3:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802bba:	29 f0                	sub    %esi,%eax
+  802bbc:	39 d8                	cmp    %ebx,%eax
+  802bbe:	73 c8                	jae    802b88 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802bc0:	8b 52 04             	mov    0x4(%edx),%edx
+  802bc3:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802bc6:	eb c0                	jmp    802b88 <page_ring_enter+0x3e>
+}
+  802bc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bcb:	5b                   	pop    %ebx
+  802bcc:	5e                   	pop    %esi
+  802bcd:	5f                   	pop    %edi
+  802bce:	5d                   	pop    %ebp
+  802bcf:	c3                   	ret
+
+00802bd0 <page_ring_reserve>:
+{
+  802bd0:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802bd2:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802bd7:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802bdd:	29 d0                	sub    %edx,%eax
+  802bdf:	ba 80 00 00 00       	mov    $0x80,%edx
+  802be4:	29 ca                	sub    %ecx,%edx
+  802be6:	39 c2                	cmp    %eax,%edx
+  802be8:	72 01                	jb     802beb <page_ring_reserve+0x1b>
+  802bea:	c3                   	ret
+{
+  802beb:	55                   	push   %ebp
+  802bec:	89 e5                	mov    %esp,%ebp
+  802bee:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802bf1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c00:	e8 45 ff ff ff       	call   802b4a <page_ring_enter>
+}
+  802c05:	c9                   	leave
+  802c06:	c3                   	ret
+
+00802c07 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802c07:	55                   	push   %ebp
+  802c08:	89 e5                	mov    %esp,%ebp
+  802c0a:	53                   	push   %ebx
+  802c0b:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802c0e:	6a 07                	push   $0x7
+  802c10:	6a 01                	push   $0x1
+  802c12:	89 c3                	mov    %eax,%ebx
+  802c14:	c1 e3 0c             	shl    $0xc,%ebx
+  802c17:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  802c1d:	52                   	push   %edx
+  802c1e:	6a 04                	push   $0x4
+  802c20:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  802c27:	e8 9b ed ff ff       	call   8019c7 <ipc_call>
+	sharereqs[i].nslots = 0;
+  802c2c:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  802c33:	00 00 00 
+	return r;
+}
+  802c36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c39:	c9                   	leave
+  802c3a:	c3                   	ret
+
+00802c3b <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802c3b:	55                   	push   %ebp
+  802c3c:	89 e5                	mov    %esp,%ebp
+  802c3e:	56                   	push   %esi
+  802c3f:	53                   	push   %ebx
+  802c40:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802c42:	c1 e8 10             	shr    $0x10,%eax
+  802c45:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802c48:	89 c2                	mov    %eax,%edx
+  802c4a:	c1 e2 0c             	shl    $0xc,%edx
+  802c4d:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  802c53:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802c56:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  802c5c:	89 c2                	mov    %eax,%edx
+  802c5e:	c1 e2 0a             	shl    $0xa,%edx
+  802c61:	01 f2                	add    %esi,%edx
+  802c63:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802c6a:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802c70:	74 09                	je     802c7b <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802c72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c77:	5b                   	pop    %ebx
+  802c78:	5e                   	pop    %esi
+  802c79:	5d                   	pop    %ebp
+  802c7a:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802c7b:	e8 87 ff ff ff       	call   802c07 <page_share_send>
+  802c80:	eb f5                	jmp    802c77 <page_share_slot+0x3c>
+
+00802c82 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802c82:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802c87:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802c8a:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802c8f:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  802c95:	74 09                	je     802ca0 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802c97:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802c9c:	85 c0                	test   %eax,%eax
+  802c9e:	75 01                	jne    802ca1 <page_ring_ready+0x1f>
+}
+  802ca0:	c3                   	ret
+{
+  802ca1:	55                   	push   %ebp
+  802ca2:	89 e5                	mov    %esp,%ebp
+  802ca4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802ca7:	68 07 06 00 00       	push   $0x607
+  802cac:	6a 08                	push   $0x8
+  802cae:	68 00 30 ad de       	push   $0xdead3000
+  802cb3:	6a 00                	push   $0x0
+  802cb5:	e8 7d e1 ff ff       	call   800e37 <sys_page_alloc_range>
+  802cba:	83 c4 10             	add    $0x10,%esp
+  802cbd:	83 f8 08             	cmp    $0x8,%eax
+  802cc0:	74 1b                	je     802cdd <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802cc2:	83 ec 04             	sub    $0x4,%esp
+  802cc5:	6a 08                	push   $0x8
+  802cc7:	68 00 30 ad de       	push   $0xdead3000
+  802ccc:	6a 00                	push   $0x0
+  802cce:	e8 d2 e1 ff ff       	call   800ea5 <sys_page_unmap_range>
+		return 0;
+  802cd3:	83 c4 10             	add    $0x10,%esp
+  802cd6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cdb:	c9                   	leave
+  802cdc:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802cdd:	83 ec 0c             	sub    $0xc,%esp
+  802ce0:	68 07 04 00 00       	push   $0x407
+  802ce5:	6a 08                	push   $0x8
+  802ce7:	68 00 30 ad de       	push   $0xdead3000
+  802cec:	6a 06                	push   $0x6
+  802cee:	ff 35 40 b0 80 00    	push   0x80b040
+  802cf4:	e8 ce ec ff ff       	call   8019c7 <ipc_call>
+  802cf9:	83 c4 20             	add    $0x20,%esp
+  802cfc:	85 c0                	test   %eax,%eax
+  802cfe:	78 14                	js     802d14 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802d00:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802d05:	8b 40 48             	mov    0x48(%eax),%eax
+  802d08:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  802d0d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d12:	eb c7                	jmp    802cdb <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802d14:	83 ec 04             	sub    $0x4,%esp
+  802d17:	6a 08                	push   $0x8
+  802d19:	68 00 30 ad de       	push   $0xdead3000
+  802d1e:	6a 00                	push   $0x0
+  802d20:	e8 80 e1 ff ff       	call   800ea5 <sys_page_unmap_range>
+		return 0;
+  802d25:	83 c4 10             	add    $0x10,%esp
+  802d28:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2d:	eb ac                	jmp    802cdb <page_ring_ready+0x59>
+
+00802d2f <page_remove_slot>:
+{
+  802d2f:	55                   	push   %ebp
+  802d30:	89 e5                	mov    %esp,%ebp
+  802d32:	56                   	push   %esi
+  802d33:	53                   	push   %ebx
+  802d34:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802d36:	89 c6                	mov    %eax,%esi
+  802d38:	c1 ee 10             	shr    $0x10,%esi
+  802d3b:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802d3e:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  802d45:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  802d4b:	74 2a                	je     802d77 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802d4d:	83 ec 0c             	sub    $0xc,%esp
+  802d50:	6a 00                	push   $0x0
+  802d52:	6a 00                	push   $0x0
+  802d54:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802d56:	c1 e3 04             	shl    $0x4,%ebx
+  802d59:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802d5c:	53                   	push   %ebx
+  802d5d:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  802d64:	e8 5e ec ff ff       	call   8019c7 <ipc_call>
+  802d69:	83 c4 20             	add    $0x20,%esp
+  802d6c:	85 c0                	test   %eax,%eax
+  802d6e:	78 2d                	js     802d9d <page_remove_slot+0x6e>
+}
+  802d70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d73:	5b                   	pop    %ebx
+  802d74:	5e                   	pop    %esi
+  802d75:	5d                   	pop    %ebp
+  802d76:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802d77:	e8 06 ff ff ff       	call   802c82 <page_ring_ready>
+  802d7c:	85 c0                	test   %eax,%eax
+  802d7e:	74 cd                	je     802d4d <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802d80:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d85:	e8 46 fe ff ff       	call   802bd0 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802d8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d8f:	89 da                	mov    %ebx,%edx
+  802d91:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d96:	e8 69 fd ff ff       	call   802b04 <page_ring_post>
+		return;
+  802d9b:	eb d3                	jmp    802d70 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802d9d:	50                   	push   %eax
+  802d9e:	68 2c 59 80 00       	push   $0x80592c
+  802da3:	68 ac 03 00 00       	push   $0x3ac
+  802da8:	68 d2 58 80 00       	push   $0x8058d2
+  802dad:	e8 a5 d3 ff ff       	call   800157 <_panic>
+
+00802db2 <find_paging_env>:
+	if(pagingenv)
+  802db2:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802db7:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802db9:	85 c0                	test   %eax,%eax
+  802dbb:	74 05                	je     802dc2 <find_paging_env+0x10>
+  802dbd:	eb 56                	jmp    802e15 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802dbf:	83 c0 01             	add    $0x1,%eax
+  802dc2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802dc7:	7f 47                	jg     802e10 <find_paging_env+0x5e>
+  802dc9:	83 f9 01             	cmp    $0x1,%ecx
+  802dcc:	7f 42                	jg     802e10 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802dce:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802dd1:	c1 e2 06             	shl    $0x6,%edx
+  802dd4:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802dda:	8b 52 50             	mov    0x50(%edx),%edx
+  802ddd:	83 fa 02             	cmp    $0x2,%edx
+  802de0:	75 dd                	jne    802dbf <find_paging_env+0xd>
+  802de2:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802de5:	c1 e2 06             	shl    $0x6,%edx
+  802de8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802dee:	8b 52 54             	mov    0x54(%edx),%edx
+  802df1:	85 d2                	test   %edx,%edx
+  802df3:	74 ca                	je     802dbf <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802df5:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802df8:	c1 e2 06             	shl    $0x6,%edx
+  802dfb:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802e01:	8b 52 48             	mov    0x48(%edx),%edx
+  802e04:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  802e0b:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802e0e:	eb af                	jmp    802dbf <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802e10:	83 f9 02             	cmp    $0x2,%ecx
+  802e13:	74 01                	je     802e16 <find_paging_env+0x64>
+}
+  802e15:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802e16:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802e1b:	8b 40 48             	mov    0x48(%eax),%eax
+  802e1e:	83 e0 01             	and    $0x1,%eax
+  802e21:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  802e28:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  802e2d:	eb e6                	jmp    802e15 <find_paging_env+0x63>
+
+00802e2f <page_add_backed>:
+{
+  802e2f:	55                   	push   %ebp
+  802e30:	89 e5                	mov    %esp,%ebp
+  802e32:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802e35:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  802e3a:	83 f8 04             	cmp    $0x4,%eax
+  802e3d:	74 35                	je     802e74 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802e3f:	89 d1                	mov    %edx,%ecx
+  802e41:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802e47:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802e4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e51:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802e58:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802e5e:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  802e65:	83 c0 01             	add    $0x1,%eax
+  802e68:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  802e6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e72:	5d                   	pop    %ebp
+  802e73:	c3                   	ret
+		return -E_NO_MEM;
+  802e74:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802e79:	eb f7                	jmp    802e72 <page_add_backed+0x43>
+
+00802e7b <percentage_of_pgdir_to_walk>:
+{
+  802e7b:	55                   	push   %ebp
+  802e7c:	89 e5                	mov    %esp,%ebp
+  802e7e:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802e81:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802e85:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802e88:	db 45 fc             	fildl  -0x4(%ebp)
+  802e8b:	d8 35 b8 5d 80 00    	fdivs  0x805db8
+	return ret*ret;
+  802e91:	d8 c8                	fmul   %st(0),%st
+}
+  802e93:	c9                   	leave
+  802e94:	c3                   	ret
+
+00802e95 <nfu_with_aging_page_choice_func>:
+{
+  802e95:	55                   	push   %ebp
+  802e96:	89 e5                	mov    %esp,%ebp
+  802e98:	57                   	push   %edi
+  802e99:	56                   	push   %esi
+  802e9a:	53                   	push   %ebx
+  802e9b:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802e9e:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  802ea4:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802ea6:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802eab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802eb0:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802eb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ebc:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802ebf:	eb 18                	jmp    802ed9 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802ec1:	f7 d0                	not    %eax
+  802ec3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802ec8:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802eca:	83 c2 01             	add    $0x1,%edx
+  802ecd:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802ed3:	0f 87 13 01 00 00    	ja     802fec <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802ed9:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802edd:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802ee0:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802ee5:	89 c1                	mov    %eax,%ecx
+  802ee7:	c1 e9 0a             	shr    $0xa,%ecx
+  802eea:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802ef1:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802ef7:	83 f9 01             	cmp    $0x1,%ecx
+  802efa:	75 c5                	jne    802ec1 <nfu_with_aging_page_choice_func+0x2c>
+  802efc:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802f01:	77 be                	ja     802ec1 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802f03:	89 c1                	mov    %eax,%ecx
+  802f05:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f08:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802f0e:	0f 82 a5 00 00 00    	jb     802fb9 <nfu_with_aging_page_choice_func+0x124>
+  802f14:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802f1a:	0f 87 99 00 00 00    	ja     802fb9 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802f20:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f27:	f6 c1 01             	test   $0x1,%cl
+  802f2a:	0f 84 89 00 00 00    	je     802fb9 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802f30:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802f37:	f6 c5 04             	test   $0x4,%ch
+  802f3a:	75 7d                	jne    802fb9 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802f3c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802f43:	f6 c5 02             	test   $0x2,%ch
+  802f46:	75 71                	jne    802fb9 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802f48:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802f4f:	c1 e9 0c             	shr    $0xc,%ecx
+  802f52:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802f55:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802f5b:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802f5f:	66 83 f9 01          	cmp    $0x1,%cx
+  802f63:	77 54                	ja     802fb9 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802f65:	89 f9                	mov    %edi,%ecx
+  802f67:	80 f9 ff             	cmp    $0xff,%cl
+  802f6a:	74 21                	je     802f8d <nfu_with_aging_page_choice_func+0xf8>
+  802f6c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802f73:	c1 e9 0c             	shr    $0xc,%ecx
+  802f76:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802f79:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802f7f:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802f83:	89 fb                	mov    %edi,%ebx
+  802f85:	38 d9                	cmp    %bl,%cl
+  802f87:	73 30                	jae    802fb9 <nfu_with_aging_page_choice_func+0x124>
+  802f89:	dd d8                	fstp   %st(0)
+  802f8b:	eb 02                	jmp    802f8f <nfu_with_aging_page_choice_func+0xfa>
+  802f8d:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802f8f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802f96:	c1 e9 0c             	shr    $0xc,%ecx
+  802f99:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802f9c:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802fa3:	89 fb                	mov    %edi,%ebx
+  802fa5:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802fa8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802fab:	db 45 e0             	fildl  -0x20(%ebp)
+  802fae:	d8 35 b8 5d 80 00    	fdivs  0x805db8
+	return ret*ret;
+  802fb4:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802fb6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802fb9:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802fbc:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802fbf:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802fc6:	df 6d e0             	fildll -0x20(%ebp)
+  802fc9:	d9 c1                	fld    %st(1)
+  802fcb:	d8 0d bc 5d 80 00    	fmuls  0x805dbc
+  802fd1:	d9 c9                	fxch   %st(1)
+  802fd3:	df f1                	fcomip %st(1),%st
+  802fd5:	dd d8                	fstp   %st(0)
+  802fd7:	0f 82 ed fe ff ff    	jb     802eca <nfu_with_aging_page_choice_func+0x35>
+  802fdd:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802fdf:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  802fe4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802fe7:	c1 e0 0c             	shl    $0xc,%eax
+  802fea:	eb 0e                	jmp    802ffa <nfu_with_aging_page_choice_func+0x165>
+  802fec:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802fee:	89 f8                	mov    %edi,%eax
+  802ff0:	3c ff                	cmp    $0xff,%al
+  802ff2:	74 0e                	je     803002 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802ff4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802ff7:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802ffa:	83 c4 14             	add    $0x14,%esp
+  802ffd:	5b                   	pop    %ebx
+  802ffe:	5e                   	pop    %esi
+  802fff:	5f                   	pop    %edi
+  803000:	5d                   	pop    %ebp
+  803001:	c3                   	ret
+	pgnum = 0;
+  803002:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  803009:	00 00 00 
+	return (void*)UTOP;
+  80300c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803011:	eb e7                	jmp    802ffa <nfu_with_aging_page_choice_func+0x165>
+
+00803013 <myRand>:
+    state = state * 1664525 + 1013904223;
+  803013:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  80301a:	66 19 00 
+  80301d:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  803022:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  803027:	c1 e8 18             	shr    $0x18,%eax
+}
+  80302a:	c3                   	ret
+
+0080302b <random_page_choice_func>:
+{
+  80302b:	55                   	push   %ebp
+  80302c:	89 e5                	mov    %esp,%ebp
+  80302e:	57                   	push   %edi
+  80302f:	56                   	push   %esi
+  803030:	53                   	push   %ebx
+  803031:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803034:	be 00 00 00 00       	mov    $0x0,%esi
+  803039:	eb 19                	jmp    803054 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80303b:	f7 d3                	not    %ebx
+  80303d:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  803043:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803045:	83 c6 01             	add    $0x1,%esi
+  803048:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  80304e:	0f 87 a0 00 00 00    	ja     8030f4 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803054:	89 f3                	mov    %esi,%ebx
+  803056:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  80305c:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803062:	89 d8                	mov    %ebx,%eax
+  803064:	c1 e8 0a             	shr    $0xa,%eax
+  803067:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80306e:	25 81 00 00 00       	and    $0x81,%eax
+  803073:	83 f8 01             	cmp    $0x1,%eax
+  803076:	75 c3                	jne    80303b <random_page_choice_func+0x10>
+  803078:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80307e:	77 bb                	ja     80303b <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  803080:	89 df                	mov    %ebx,%edi
+  803082:	c1 e7 0c             	shl    $0xc,%edi
+  803085:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  803088:	89 f8                	mov    %edi,%eax
+  80308a:	e8 06 f9 ff ff       	call   802995 <page_is_clean>
+  80308f:	84 c0                	test   %al,%al
+  803091:	0f 85 82 00 00 00    	jne    803119 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803097:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  80309d:	72 a6                	jb     803045 <random_page_choice_func+0x1a>
+  80309f:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  8030a5:	77 9e                	ja     803045 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8030a7:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8030ae:	a8 01                	test   $0x1,%al
+  8030b0:	74 93                	je     803045 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8030b2:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8030b9:	f6 c4 04             	test   $0x4,%ah
+  8030bc:	75 87                	jne    803045 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8030be:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8030c5:	f6 c4 02             	test   $0x2,%ah
+  8030c8:	0f 85 77 ff ff ff    	jne    803045 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8030ce:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8030d5:	c1 e8 0c             	shr    $0xc,%eax
+  8030d8:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8030db:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8030e0:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8030e4:	66 83 f8 01          	cmp    $0x1,%ax
+  8030e8:	0f 87 57 ff ff ff    	ja     803045 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  8030ee:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8030f4:	e8 1a ff ff ff       	call   803013 <myRand>
+  8030f9:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  8030ff:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  803104:	29 fe                	sub    %edi,%esi
+  803106:	0f be c0             	movsbl %al,%eax
+  803109:	ba 00 00 00 00       	mov    $0x0,%edx
+  80310e:	f7 f6                	div    %esi
+  803110:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  803112:	bb 15 00 00 00       	mov    $0x15,%ebx
+  803117:	eb 1c                	jmp    803135 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  803119:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  80311f:	e9 8f 00 00 00       	jmp    8031b3 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  803124:	e8 ea fe ff ff       	call   803013 <myRand>
+  803129:	0f be c0             	movsbl %al,%eax
+  80312c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803131:	f7 f6                	div    %esi
+  803133:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  803135:	83 eb 01             	sub    $0x1,%ebx
+  803138:	0f 84 c2 00 00 00    	je     803200 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  80313e:	89 d0                	mov    %edx,%eax
+  803140:	c1 e8 0a             	shr    $0xa,%eax
+  803143:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80314a:	25 81 00 00 00       	and    $0x81,%eax
+  80314f:	83 f8 01             	cmp    $0x1,%eax
+  803152:	75 d0                	jne    803124 <random_page_choice_func+0xf9>
+  803154:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  80315a:	77 c8                	ja     803124 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  80315c:	89 d0                	mov    %edx,%eax
+  80315e:	c1 e0 0c             	shl    $0xc,%eax
+  803161:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  803166:	72 56                	jb     8031be <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  803168:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  80316d:	77 65                	ja     8031d4 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  80316f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  803176:	f6 c1 01             	test   $0x1,%cl
+  803179:	74 59                	je     8031d4 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  80317b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  803182:	f6 c5 04             	test   $0x4,%ch
+  803185:	75 4d                	jne    8031d4 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  803187:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  80318e:	f6 c5 02             	test   $0x2,%ch
+  803191:	75 41                	jne    8031d4 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  803193:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80319a:	c1 ea 0c             	shr    $0xc,%edx
+  80319d:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  8031a0:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  8031a6:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  8031aa:	66 83 fa 01          	cmp    $0x1,%dx
+  8031ae:	77 3a                	ja     8031ea <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  8031b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  8031b3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8031b6:	83 c4 1c             	add    $0x1c,%esp
+  8031b9:	5b                   	pop    %ebx
+  8031ba:	5e                   	pop    %esi
+  8031bb:	5f                   	pop    %edi
+  8031bc:	5d                   	pop    %ebp
+  8031bd:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8031be:	e8 50 fe ff ff       	call   803013 <myRand>
+  8031c3:	0f be c0             	movsbl %al,%eax
+  8031c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031cb:	f7 f6                	div    %esi
+  8031cd:	01 fa                	add    %edi,%edx
+			continue;
+  8031cf:	e9 61 ff ff ff       	jmp    803135 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  8031d4:	e8 3a fe ff ff       	call   803013 <myRand>
+  8031d9:	0f be c0             	movsbl %al,%eax
+  8031dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031e1:	f7 f6                	div    %esi
+  8031e3:	01 fa                	add    %edi,%edx
+			continue;
+  8031e5:	e9 4b ff ff ff       	jmp    803135 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  8031ea:	e8 24 fe ff ff       	call   803013 <myRand>
+  8031ef:	0f be c0             	movsbl %al,%eax
+  8031f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031f7:	f7 f6                	div    %esi
+  8031f9:	01 fa                	add    %edi,%edx
+			continue;
+  8031fb:	e9 35 ff ff ff       	jmp    803135 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  803200:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  803207:	00 00 00 
+	return (void*)UTOP;
+  80320a:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  803211:	eb a0                	jmp    8031b3 <random_page_choice_func+0x188>
+
+00803213 <nfu>:
+{
+  803213:	55                   	push   %ebp
+  803214:	89 e5                	mov    %esp,%ebp
+  803216:	57                   	push   %edi
+  803217:	56                   	push   %esi
+  803218:	53                   	push   %ebx
+  803219:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80321c:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  803222:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  803224:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803229:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80322e:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803235:	ba 00 00 00 00       	mov    $0x0,%edx
+  80323a:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  80323d:	eb 18                	jmp    803257 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80323f:	f7 d0                	not    %eax
+  803241:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803246:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803248:	83 c2 01             	add    $0x1,%edx
+  80324b:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803251:	0f 87 13 01 00 00    	ja     80336a <nfu+0x157>
+		++num_searched_ptes;
+  803257:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80325b:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  80325e:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803263:	89 c1                	mov    %eax,%ecx
+  803265:	c1 e9 0a             	shr    $0xa,%ecx
+  803268:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80326f:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803275:	83 f9 01             	cmp    $0x1,%ecx
+  803278:	75 c5                	jne    80323f <nfu+0x2c>
+  80327a:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  80327f:	77 be                	ja     80323f <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803281:	89 c1                	mov    %eax,%ecx
+  803283:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803286:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  80328c:	0f 82 a5 00 00 00    	jb     803337 <nfu+0x124>
+  803292:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803298:	0f 87 99 00 00 00    	ja     803337 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80329e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8032a5:	f6 c1 01             	test   $0x1,%cl
+  8032a8:	0f 84 89 00 00 00    	je     803337 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8032ae:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8032b5:	f6 c5 04             	test   $0x4,%ch
+  8032b8:	75 7d                	jne    803337 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8032ba:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8032c1:	f6 c5 02             	test   $0x2,%ch
+  8032c4:	75 71                	jne    803337 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8032c6:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032cd:	c1 e9 0c             	shr    $0xc,%ecx
+  8032d0:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032d3:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032d9:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8032dd:	66 83 f9 01          	cmp    $0x1,%cx
+  8032e1:	77 54                	ja     803337 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  8032e3:	89 f9                	mov    %edi,%ecx
+  8032e5:	80 f9 ff             	cmp    $0xff,%cl
+  8032e8:	74 21                	je     80330b <nfu+0xf8>
+  8032ea:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032f1:	c1 e9 0c             	shr    $0xc,%ecx
+  8032f4:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032f7:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032fd:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  803301:	89 fb                	mov    %edi,%ebx
+  803303:	38 d9                	cmp    %bl,%cl
+  803305:	73 30                	jae    803337 <nfu+0x124>
+  803307:	dd d8                	fstp   %st(0)
+  803309:	eb 02                	jmp    80330d <nfu+0xfa>
+  80330b:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  80330d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803314:	c1 e9 0c             	shr    $0xc,%ecx
+  803317:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80331a:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  803321:	89 fb                	mov    %edi,%ebx
+  803323:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  803326:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803329:	db 45 e0             	fildl  -0x20(%ebp)
+  80332c:	d8 35 b8 5d 80 00    	fdivs  0x805db8
+	return ret*ret;
+  803332:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803334:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803337:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80333a:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80333d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803344:	df 6d e0             	fildll -0x20(%ebp)
+  803347:	d9 c1                	fld    %st(1)
+  803349:	d8 0d bc 5d 80 00    	fmuls  0x805dbc
+  80334f:	d9 c9                	fxch   %st(1)
+  803351:	df f1                	fcomip %st(1),%st
+  803353:	dd d8                	fstp   %st(0)
+  803355:	0f 82 ed fe ff ff    	jb     803248 <nfu+0x35>
+  80335b:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  80335d:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  803362:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803365:	c1 e0 0c             	shl    $0xc,%eax
+  803368:	eb 0e                	jmp    803378 <nfu+0x165>
+  80336a:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  80336c:	89 f8                	mov    %edi,%eax
+  80336e:	3c ff                	cmp    $0xff,%al
+  803370:	74 0e                	je     803380 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  803372:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803375:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803378:	83 c4 14             	add    $0x14,%esp
+  80337b:	5b                   	pop    %ebx
+  80337c:	5e                   	pop    %esi
+  80337d:	5f                   	pop    %edi
+  80337e:	5d                   	pop    %ebp
+  80337f:	c3                   	ret
+	pgnum = 0;
+  803380:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  803387:	00 00 00 
+	return (void*)UTOP;
+  80338a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80338f:	eb e7                	jmp    803378 <nfu+0x165>
+
+00803391 <lru>:
+{
+  803391:	55                   	push   %ebp
+  803392:	89 e5                	mov    %esp,%ebp
+  803394:	57                   	push   %edi
+  803395:	56                   	push   %esi
+  803396:	53                   	push   %ebx
+  803397:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80339a:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  8033a0:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  8033a7:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8033ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8033b3:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8033ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033bf:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  8033c2:	eb 18                	jmp    8033dc <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8033c4:	f7 d0                	not    %eax
+  8033c6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8033cb:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8033cd:	83 c2 01             	add    $0x1,%edx
+  8033d0:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  8033d6:	0f 87 fa 00 00 00    	ja     8034d6 <lru+0x145>
+		++num_searched_ptes;
+  8033dc:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8033df:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8033e2:	01 d0                	add    %edx,%eax
+  8033e4:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8033e9:	89 c1                	mov    %eax,%ecx
+  8033eb:	c1 e9 0a             	shr    $0xa,%ecx
+  8033ee:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8033f5:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8033fb:	83 f9 01             	cmp    $0x1,%ecx
+  8033fe:	75 c4                	jne    8033c4 <lru+0x33>
+  803400:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803405:	77 bd                	ja     8033c4 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803407:	89 c1                	mov    %eax,%ecx
+  803409:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80340c:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803412:	0f 87 92 00 00 00    	ja     8034aa <lru+0x119>
+  803418:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  80341e:	0f 82 86 00 00 00    	jb     8034aa <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803424:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80342b:	f6 c1 01             	test   $0x1,%cl
+  80342e:	74 7a                	je     8034aa <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803430:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803437:	f6 c5 04             	test   $0x4,%ch
+  80343a:	75 6e                	jne    8034aa <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80343c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803443:	f6 c5 02             	test   $0x2,%ch
+  803446:	75 62                	jne    8034aa <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803448:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80344f:	c1 e9 0c             	shr    $0xc,%ecx
+  803452:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803455:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80345b:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  80345f:	66 83 f9 01          	cmp    $0x1,%cx
+  803463:	77 45                	ja     8034aa <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  803465:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80346c:	c1 e9 0c             	shr    $0xc,%ecx
+  80346f:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803472:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803478:	8b 59 14             	mov    0x14(%ecx),%ebx
+  80347b:	8b 49 10             	mov    0x10(%ecx),%ecx
+  80347e:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  803481:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803484:	19 df                	sbb    %ebx,%edi
+  803486:	7c 22                	jl     8034aa <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  803488:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80348f:	c1 e9 0c             	shr    $0xc,%ecx
+  803492:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803495:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80349b:	8b 59 14             	mov    0x14(%ecx),%ebx
+  80349e:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8034a1:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8034a4:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8034a7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8034aa:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8034ad:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8034b4:	df 6d e0             	fildll -0x20(%ebp)
+  8034b7:	d9 05 bc 5d 80 00    	flds   0x805dbc
+  8034bd:	d9 c9                	fxch   %st(1)
+  8034bf:	df f1                	fcomip %st(1),%st
+  8034c1:	dd d8                	fstp   %st(0)
+  8034c3:	0f 82 04 ff ff ff    	jb     8033cd <lru+0x3c>
+			pgnum = pgnum_actual;
+  8034c9:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  8034ce:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8034d1:	c1 e0 0c             	shl    $0xc,%eax
+  8034d4:	eb 06                	jmp    8034dc <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  8034d6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8034d9:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8034dc:	83 c4 1c             	add    $0x1c,%esp
+  8034df:	5b                   	pop    %ebx
+  8034e0:	5e                   	pop    %esi
+  8034e1:	5f                   	pop    %edi
+  8034e2:	5d                   	pop    %ebp
+  8034e3:	c3                   	ret
+
+008034e4 <set_page_choice_func>:
+{
+  8034e4:	55                   	push   %ebp
+  8034e5:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  8034e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034ea:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  8034ef:	5d                   	pop    %ebp
+  8034f0:	c3                   	ret
+
+008034f1 <get_page_choice>:
+{
+  8034f1:	55                   	push   %ebp
+  8034f2:	89 e5                	mov    %esp,%ebp
+  8034f4:	57                   	push   %edi
+  8034f5:	56                   	push   %esi
+  8034f6:	53                   	push   %ebx
+  8034f7:	83 ec 24             	sub    $0x24,%esp
+  8034fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034fd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  803500:	57                   	push   %edi
+  803501:	56                   	push   %esi
+  803502:	ff 15 3c 60 80 00    	call   *0x80603c
+  803508:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80350a:	83 c4 10             	add    $0x10,%esp
+  80350d:	eb 25                	jmp    803534 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  80350f:	83 ec 08             	sub    $0x8,%esp
+  803512:	c1 e0 16             	shl    $0x16,%eax
+  803515:	50                   	push   %eax
+  803516:	6a 00                	push   $0x0
+  803518:	e8 b6 d8 ff ff       	call   800dd3 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80351d:	83 c4 10             	add    $0x10,%esp
+  803520:	85 c0                	test   %eax,%eax
+  803522:	75 43                	jne    803567 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  803524:	83 ec 08             	sub    $0x8,%esp
+  803527:	57                   	push   %edi
+  803528:	56                   	push   %esi
+  803529:	ff 15 3c 60 80 00    	call   *0x80603c
+  80352f:	89 c3                	mov    %eax,%ebx
+  803531:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803534:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  803537:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80353d:	0f 86 ae 00 00 00    	jbe    8035f1 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803543:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  803548:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80354f:	81 e2 81 00 00 00    	and    $0x81,%edx
+  803555:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  80355b:	74 b2                	je     80350f <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80355d:	83 c0 01             	add    $0x1,%eax
+  803560:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  803565:	75 e1                	jne    803548 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803567:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80356a:	05 00 10 40 11       	add    $0x11401000,%eax
+  80356f:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803574:	76 1f                	jbe    803595 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  803576:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  80357b:	89 d8                	mov    %ebx,%eax
+  80357d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803580:	5b                   	pop    %ebx
+  803581:	5e                   	pop    %esi
+  803582:	5f                   	pop    %edi
+  803583:	5d                   	pop    %ebp
+  803584:	c3                   	ret
+		sys_page_split(0, pg_out);
+  803585:	83 ec 08             	sub    $0x8,%esp
+  803588:	53                   	push   %ebx
+  803589:	6a 00                	push   $0x0
+  80358b:	e8 43 d8 ff ff       	call   800dd3 <sys_page_split>
+  803590:	83 c4 10             	add    $0x10,%esp
+  803593:	eb 6c                	jmp    803601 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  803595:	83 ec 04             	sub    $0x4,%esp
+  803598:	68 64 59 80 00       	push   $0x805964
+  80359d:	68 cc 01 00 00       	push   $0x1cc
+  8035a2:	68 d2 58 80 00       	push   $0x8058d2
+  8035a7:	e8 ab cb ff ff       	call   800157 <_panic>
+		panic("We tried to page out code pages\n");
+  8035ac:	83 ec 04             	sub    $0x4,%esp
+  8035af:	68 94 59 80 00       	push   $0x805994
+  8035b4:	68 d6 01 00 00       	push   $0x1d6
+  8035b9:	68 d2 58 80 00       	push   $0x8058d2
+  8035be:	e8 94 cb ff ff       	call   800157 <_panic>
+		panic("Invalid mapping for the va\n");
+  8035c3:	83 ec 04             	sub    $0x4,%esp
+  8035c6:	68 df 58 80 00       	push   $0x8058df
+  8035cb:	68 da 01 00 00       	push   $0x1da
+  8035d0:	68 d2 58 80 00       	push   $0x8058d2
+  8035d5:	e8 7d cb ff ff       	call   800157 <_panic>
+		panic("We tried to page out a shared page\n");
+  8035da:	83 ec 04             	sub    $0x4,%esp
+  8035dd:	68 b8 59 80 00       	push   $0x8059b8
+  8035e2:	68 e0 01 00 00       	push   $0x1e0
+  8035e7:	68 d2 58 80 00       	push   $0x8058d2
+  8035ec:	e8 66 cb ff ff       	call   800157 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  8035f1:	89 de                	mov    %ebx,%esi
+  8035f3:	c1 ee 16             	shr    $0x16,%esi
+  8035f6:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8035fd:	a8 80                	test   $0x80,%al
+  8035ff:	75 84                	jne    803585 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803601:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803604:	05 00 10 40 11       	add    $0x11401000,%eax
+  803609:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80360e:	76 85                	jbe    803595 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  803610:	89 d8                	mov    %ebx,%eax
+  803612:	e8 7e f3 ff ff       	call   802995 <page_is_clean>
+  803617:	84 c0                	test   %al,%al
+  803619:	0f 85 5c ff ff ff    	jne    80357b <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  80361f:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  803626:	76 84                	jbe    8035ac <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  803628:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80362f:	a8 01                	test   $0x1,%al
+  803631:	74 90                	je     8035c3 <get_page_choice+0xd2>
+  803633:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803636:	c1 e8 0c             	shr    $0xc,%eax
+  803639:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803640:	f6 c2 01             	test   $0x1,%dl
+  803643:	0f 84 7a ff ff ff    	je     8035c3 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803649:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  803650:	f6 c2 01             	test   $0x1,%dl
+  803653:	74 85                	je     8035da <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803655:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  80365c:	f6 c2 01             	test   $0x1,%dl
+  80365f:	0f 84 75 ff ff ff    	je     8035da <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  803665:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  80366c:	f6 c6 04             	test   $0x4,%dh
+  80366f:	0f 85 65 ff ff ff    	jne    8035da <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  803675:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  80367c:	f6 c6 02             	test   $0x2,%dh
+  80367f:	0f 85 55 ff ff ff    	jne    8035da <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  803685:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80368c:	c1 e8 0c             	shr    $0xc,%eax
+  80368f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803692:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803697:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80369b:	66 83 f8 01          	cmp    $0x1,%ax
+  80369f:	0f 86 d6 fe ff ff    	jbe    80357b <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  8036a5:	83 ec 04             	sub    $0x4,%esp
+  8036a8:	68 dc 59 80 00       	push   $0x8059dc
+  8036ad:	68 e2 01 00 00       	push   $0x1e2
+  8036b2:	68 d2 58 80 00       	push   $0x8058d2
+  8036b7:	e8 9b ca ff ff       	call   800157 <_panic>
+
+008036bc <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  8036bc:	55                   	push   %ebp
+  8036bd:	89 e5                	mov    %esp,%ebp
+  8036bf:	57                   	push   %edi
+  8036c0:	56                   	push   %esi
+  8036c1:	53                   	push   %ebx
+  8036c2:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  8036c5:	e8 e8 f6 ff ff       	call   802db2 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  8036ca:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  8036cf:	85 c0                	test   %eax,%eax
+  8036d1:	74 41                	je     803714 <page_share_paged_out+0x58>
+  8036d3:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  8036da:	0f 84 fd 00 00 00    	je     8037dd <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  8036e0:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  8036e7:	00 00 00 
+  8036ea:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  8036f1:	00 00 00 
+  8036f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036f9:	eb 2c                	jmp    803727 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8036fb:	83 c3 04             	add    $0x4,%ebx
+  8036fe:	39 f3                	cmp    %esi,%ebx
+  803700:	74 1a                	je     80371c <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  803702:	8b 03                	mov    (%ebx),%eax
+  803704:	a8 01                	test   $0x1,%al
+  803706:	74 f3                	je     8036fb <page_share_paged_out+0x3f>
+  803708:	c1 e8 0c             	shr    $0xc,%eax
+  80370b:	e8 2b f5 ff ff       	call   802c3b <page_share_slot>
+  803710:	85 c0                	test   %eax,%eax
+  803712:	79 e7                	jns    8036fb <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  803714:	83 c4 0c             	add    $0xc,%esp
+  803717:	5b                   	pop    %ebx
+  803718:	5e                   	pop    %esi
+  803719:	5f                   	pop    %edi
+  80371a:	5d                   	pop    %ebp
+  80371b:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  80371c:	83 c7 04             	add    $0x4,%edi
+  80371f:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  803725:	74 1b                	je     803742 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  803727:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  80372c:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  80372f:	f6 c3 01             	test   $0x1,%bl
+  803732:	74 e8                	je     80371c <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  803734:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  80373a:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  803740:	eb bc                	jmp    8036fe <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803742:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803747:	eb 11                	jmp    80375a <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  803749:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80374f:	83 c3 01             	add    $0x1,%ebx
+  803752:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803758:	77 41                	ja     80379b <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  80375a:	89 d8                	mov    %ebx,%eax
+  80375c:	c1 e8 0a             	shr    $0xa,%eax
+  80375f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803766:	25 81 00 00 00       	and    $0x81,%eax
+  80376b:	83 f8 01             	cmp    $0x1,%eax
+  80376e:	75 d9                	jne    803749 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803770:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803777:	25 81 00 00 00       	and    $0x81,%eax
+  80377c:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803781:	75 cc                	jne    80374f <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803783:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80378a:	c1 e8 0c             	shr    $0xc,%eax
+  80378d:	e8 a9 f4 ff ff       	call   802c3b <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803792:	85 c0                	test   %eax,%eax
+  803794:	79 b9                	jns    80374f <page_share_paged_out+0x93>
+  803796:	e9 79 ff ff ff       	jmp    803714 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80379b:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8037a2:	75 13                	jne    8037b7 <page_share_paged_out+0xfb>
+  8037a4:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8037ab:	75 1d                	jne    8037ca <page_share_paged_out+0x10e>
+	return 0;
+  8037ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b2:	e9 5d ff ff ff       	jmp    803714 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8037b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037bc:	e8 46 f4 ff ff       	call   802c07 <page_share_send>
+  8037c1:	85 c0                	test   %eax,%eax
+  8037c3:	79 df                	jns    8037a4 <page_share_paged_out+0xe8>
+  8037c5:	e9 4a ff ff ff       	jmp    803714 <page_share_paged_out+0x58>
+  8037ca:	b8 01 00 00 00       	mov    $0x1,%eax
+  8037cf:	e8 33 f4 ff ff       	call   802c07 <page_share_send>
+  8037d4:	85 c0                	test   %eax,%eax
+  8037d6:	79 d5                	jns    8037ad <page_share_paged_out+0xf1>
+  8037d8:	e9 37 ff ff ff       	jmp    803714 <page_share_paged_out+0x58>
+		return 0;
+  8037dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e2:	e9 2d ff ff ff       	jmp    803714 <page_share_paged_out+0x58>
+
+008037e7 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  8037e7:	55                   	push   %ebp
+  8037e8:	89 e5                	mov    %esp,%ebp
+  8037ea:	56                   	push   %esi
+  8037eb:	53                   	push   %ebx
+  8037ec:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  8037ef:	e8 be f5 ff ff       	call   802db2 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  8037f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  8037f9:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803800:	0f 84 82 00 00 00    	je     803888 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  803806:	83 ec 0c             	sub    $0xc,%esp
+  803809:	68 00 10 00 00       	push   $0x1000
+  80380e:	e8 84 11 00 00       	call   804997 <malloc>
+  803813:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  803815:	83 c4 0c             	add    $0xc,%esp
+  803818:	6a 14                	push   $0x14
+  80381a:	6a 00                	push   $0x0
+  80381c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80381f:	50                   	push   %eax
+  803820:	e8 45 d1 ff ff       	call   80096a <memset>
+  803825:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  803828:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  80382d:	83 ec 0c             	sub    $0xc,%esp
+  803830:	6a 07                	push   $0x7
+  803832:	6a 01                	push   $0x1
+  803834:	53                   	push   %ebx
+  803835:	6a 03                	push   $0x3
+  803837:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  80383e:	e8 84 e1 ff ff       	call   8019c7 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  803843:	8b 03                	mov    (%ebx),%eax
+  803845:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803848:	8b 43 04             	mov    0x4(%ebx),%eax
+  80384b:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  80384e:	8b 43 08             	mov    0x8(%ebx),%eax
+  803851:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  803854:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803857:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  80385a:	8b 43 10             	mov    0x10(%ebx),%eax
+  80385d:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803860:	83 c6 01             	add    $0x1,%esi
+  803863:	83 c4 20             	add    $0x20,%esp
+  803866:	83 fe 02             	cmp    $0x2,%esi
+  803869:	75 c2                	jne    80382d <get_paging_stats+0x46>
+	}
+	*stats = total;
+  80386b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80386e:	89 03                	mov    %eax,(%ebx)
+  803870:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803873:	89 43 04             	mov    %eax,0x4(%ebx)
+  803876:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803879:	89 43 08             	mov    %eax,0x8(%ebx)
+  80387c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80387f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803882:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803885:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  803888:	89 d8                	mov    %ebx,%eax
+  80388a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80388d:	5b                   	pop    %ebx
+  80388e:	5e                   	pop    %esi
+  80388f:	5d                   	pop    %ebp
+  803890:	c3                   	ret
+
+00803891 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803891:	55                   	push   %ebp
+  803892:	89 e5                	mov    %esp,%ebp
+  803894:	53                   	push   %ebx
+  803895:	83 ec 10             	sub    $0x10,%esp
+  803898:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  80389b:	68 f9 58 80 00       	push   $0x8058f9
+  8038a0:	e8 8d c9 ff ff       	call   800232 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  8038a5:	83 c4 08             	add    $0x8,%esp
+  8038a8:	ff 33                	push   (%ebx)
+  8038aa:	68 10 5a 80 00       	push   $0x805a10
+  8038af:	e8 7e c9 ff ff       	call   800232 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  8038b4:	83 c4 08             	add    $0x8,%esp
+  8038b7:	ff 73 04             	push   0x4(%ebx)
+  8038ba:	68 fb 58 80 00       	push   $0x8058fb
+  8038bf:	e8 6e c9 ff ff       	call   800232 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  8038c4:	83 c4 08             	add    $0x8,%esp
+  8038c7:	ff 73 08             	push   0x8(%ebx)
+  8038ca:	68 30 5a 80 00       	push   $0x805a30
+  8038cf:	e8 5e c9 ff ff       	call   800232 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  8038d4:	83 c4 08             	add    $0x8,%esp
+  8038d7:	ff 73 0c             	push   0xc(%ebx)
+  8038da:	68 54 5a 80 00       	push   $0x805a54
+  8038df:	e8 4e c9 ff ff       	call   800232 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  8038e4:	83 c4 08             	add    $0x8,%esp
+  8038e7:	ff 73 10             	push   0x10(%ebx)
+  8038ea:	68 78 5a 80 00       	push   $0x805a78
+  8038ef:	e8 3e c9 ff ff       	call   800232 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  8038f4:	83 c4 08             	add    $0x8,%esp
+  8038f7:	ff 35 08 b0 80 00    	push   0x80b008
+  8038fd:	68 b4 5a 80 00       	push   $0x805ab4
+  803902:	e8 2b c9 ff ff       	call   800232 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  803907:	83 c4 08             	add    $0x8,%esp
+  80390a:	ff 35 04 b0 80 00    	push   0x80b004
+  803910:	68 e8 5a 80 00       	push   $0x805ae8
+  803915:	e8 18 c9 ff ff       	call   800232 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  80391a:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80391f:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  803922:	8b 50 68             	mov    0x68(%eax),%edx
+  803925:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  803928:	51                   	push   %ecx
+  803929:	52                   	push   %edx
+  80392a:	50                   	push   %eax
+  80392b:	68 28 5b 80 00       	push   $0x805b28
+  803930:	e8 fd c8 ff ff       	call   800232 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  803935:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80393a:	8b 40 70             	mov    0x70(%eax),%eax
+  80393d:	83 c4 18             	add    $0x18,%esp
+  803940:	50                   	push   %eax
+  803941:	68 5c 5b 80 00       	push   $0x805b5c
+  803946:	e8 e7 c8 ff ff       	call   800232 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  80394b:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  803951:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803957:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  80395c:	51                   	push   %ecx
+  80395d:	52                   	push   %edx
+  80395e:	50                   	push   %eax
+  80395f:	68 8c 5b 80 00       	push   $0x805b8c
+  803964:	e8 c9 c8 ff ff       	call   800232 <cprintf>
+	cprintf("\n");
+  803969:	83 c4 14             	add    $0x14,%esp
+  80396c:	68 f9 58 80 00       	push   $0x8058f9
+  803971:	e8 bc c8 ff ff       	call   800232 <cprintf>
+}
+  803976:	83 c4 10             	add    $0x10,%esp
+  803979:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80397c:	c9                   	leave
+  80397d:	c3                   	ret
+
+0080397e <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  80397e:	55                   	push   %ebp
+  80397f:	89 e5                	mov    %esp,%ebp
+  803981:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  803984:	e8 5e fe ff ff       	call   8037e7 <get_paging_stats>
+  803989:	83 ec 0c             	sub    $0xc,%esp
+  80398c:	50                   	push   %eax
+  80398d:	e8 ff fe ff ff       	call   803891 <print_paging_stats>
+}
+  803992:	83 c4 10             	add    $0x10,%esp
+  803995:	c9                   	leave
+  803996:	c3                   	ret
+
+00803997 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803997:	55                   	push   %ebp
+  803998:	89 e5                	mov    %esp,%ebp
+  80399a:	53                   	push   %ebx
+  80399b:	83 ec 04             	sub    $0x4,%esp
+  80399e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  8039a1:	eb 13                	jmp    8039b6 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  8039a3:	83 ec 04             	sub    $0x4,%esp
+  8039a6:	6a ff                	push   $0xffffffff
+  8039a8:	53                   	push   %ebx
+  8039a9:	68 00 f0 ff ee       	push   $0xeefff000
+  8039ae:	e8 32 d8 ff ff       	call   8011e5 <sys_futex_wait>
+  8039b3:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  8039b6:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  8039bb:	39 d8                	cmp    %ebx,%eax
+  8039bd:	74 e4                	je     8039a3 <mem_pressure_wait+0xc>
+	return now;
+}
+  8039bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039c2:	c9                   	leave
+  8039c3:	c3                   	ret
+
+008039c4 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  8039c4:	55                   	push   %ebp
+  8039c5:	89 e5                	mov    %esp,%ebp
+  8039c7:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  8039ca:	68 36 46 80 00       	push   $0x804636
+  8039cf:	e8 32 16 00 00       	call   805006 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  8039d4:	c7 05 14 e9 80 00 00 	movl   $0xdeadb000,0x80e914
+  8039db:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  8039de:	83 c4 0c             	add    $0xc,%esp
+  8039e1:	68 07 02 00 00       	push   $0x207
+  8039e6:	68 00 b0 ad de       	push   $0xdeadb000
+  8039eb:	6a 00                	push   $0x0
+  8039ed:	e8 1a d3 ff ff       	call   800d0c <sys_page_alloc>
+  8039f2:	83 c4 10             	add    $0x10,%esp
+  8039f5:	85 c0                	test   %eax,%eax
+  8039f7:	78 0c                	js     803a05 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  8039f9:	e8 b4 f3 ff ff       	call   802db2 <find_paging_env>
+	page_ring_ready();
+  8039fe:	e8 7f f2 ff ff       	call   802c82 <page_ring_ready>
+}
+  803a03:	c9                   	leave
+  803a04:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  803a05:	50                   	push   %eax
+  803a06:	68 19 59 80 00       	push   $0x805919
+  803a0b:	68 13 05 00 00       	push   $0x513
+  803a10:	68 d2 58 80 00       	push   $0x8058d2
+  803a15:	e8 3d c7 ff ff       	call   800157 <_panic>
+
+00803a1a <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  803a1a:	55                   	push   %ebp
+  803a1b:	89 e5                	mov    %esp,%ebp
+  803a1d:	57                   	push   %edi
+  803a1e:	56                   	push   %esi
+  803a1f:	53                   	push   %ebx
+  803a20:	83 ec 0c             	sub    $0xc,%esp
+  803a23:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  803a26:	89 fa                	mov    %edi,%edx
+  803a28:	c1 ea 16             	shr    $0x16,%edx
+  803a2b:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803a30:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  803a33:	f6 06 01             	testb  $0x1,(%esi)
+  803a36:	75 3e                	jne    803a76 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803a38:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  803a3d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803a41:	74 47                	je     803a8a <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  803a43:	83 ec 0c             	sub    $0xc,%esp
+  803a46:	6a 01                	push   $0x1
+  803a48:	e8 f2 11 00 00       	call   804c3f <va_alloc>
+  803a4d:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  803a4f:	83 c4 10             	add    $0x10,%esp
+  803a52:	85 c0                	test   %eax,%eax
+  803a54:	74 34                	je     803a8a <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803a56:	6a 00                	push   $0x0
+  803a58:	68 07 02 00 00       	push   $0x207
+  803a5d:	50                   	push   %eax
+  803a5e:	6a 00                	push   $0x0
+  803a60:	e8 df 02 00 00       	call   803d44 <page_alloc>
+  803a65:	83 c4 10             	add    $0x10,%esp
+  803a68:	85 c0                	test   %eax,%eax
+  803a6a:	78 28                	js     803a94 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  803a6c:	f6 06 01             	testb  $0x1,(%esi)
+  803a6f:	75 38                	jne    803aa9 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803a71:	83 cb 01             	or     $0x1,%ebx
+  803a74:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803a76:	89 f8                	mov    %edi,%eax
+  803a78:	c1 e8 0a             	shr    $0xa,%eax
+  803a7b:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803a80:	8b 1e                	mov    (%esi),%ebx
+  803a82:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803a88:	01 c3                	add    %eax,%ebx
+}
+  803a8a:	89 d8                	mov    %ebx,%eax
+  803a8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a8f:	5b                   	pop    %ebx
+  803a90:	5e                   	pop    %esi
+  803a91:	5f                   	pop    %edi
+  803a92:	5d                   	pop    %ebp
+  803a93:	c3                   	ret
+			va_free(page, 1);
+  803a94:	83 ec 08             	sub    $0x8,%esp
+  803a97:	6a 01                	push   $0x1
+  803a99:	53                   	push   %ebx
+  803a9a:	e8 d8 12 00 00       	call   804d77 <va_free>
+			return NULL;
+  803a9f:	83 c4 10             	add    $0x10,%esp
+  803aa2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803aa7:	eb e1                	jmp    803a8a <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  803aa9:	83 ec 08             	sub    $0x8,%esp
+  803aac:	53                   	push   %ebx
+  803aad:	6a 00                	push   $0x0
+  803aaf:	e8 dd d2 ff ff       	call   800d91 <sys_page_unmap>
+			va_free(page, 1);
+  803ab4:	83 c4 08             	add    $0x8,%esp
+  803ab7:	6a 01                	push   $0x1
+  803ab9:	53                   	push   %ebx
+  803aba:	e8 b8 12 00 00       	call   804d77 <va_free>
+  803abf:	83 c4 10             	add    $0x10,%esp
+  803ac2:	eb b2                	jmp    803a76 <umapdir_walk+0x5c>
+
+00803ac4 <page_out>:
+{
+  803ac4:	55                   	push   %ebp
+  803ac5:	89 e5                	mov    %esp,%ebp
+  803ac7:	57                   	push   %edi
+  803ac8:	56                   	push   %esi
+  803ac9:	53                   	push   %ebx
+  803aca:	83 ec 5c             	sub    $0x5c,%esp
+  803acd:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803ad0:	e8 dd f2 ff ff       	call   802db2 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803ad5:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803ada:	85 c0                	test   %eax,%eax
+  803adc:	74 1e                	je     803afc <page_out+0x38>
+  803ade:	83 ec 0c             	sub    $0xc,%esp
+  803ae1:	6a 00                	push   $0x0
+  803ae3:	6a 00                	push   $0x0
+  803ae5:	6a 00                	push   $0x0
+  803ae7:	6a 08                	push   $0x8
+  803ae9:	50                   	push   %eax
+  803aea:	e8 d8 de ff ff       	call   8019c7 <ipc_call>
+  803aef:	89 c3                	mov    %eax,%ebx
+  803af1:	83 c4 20             	add    $0x20,%esp
+  803af4:	85 c0                	test   %eax,%eax
+  803af6:	0f 84 ac 00 00 00    	je     803ba8 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  803afc:	83 ec 08             	sub    $0x8,%esp
+  803aff:	ff 75 0c             	push   0xc(%ebp)
+  803b02:	57                   	push   %edi
+  803b03:	e8 e9 f9 ff ff       	call   8034f1 <get_page_choice>
+  803b08:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  803b0a:	83 c4 10             	add    $0x10,%esp
+  803b0d:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803b12:	0f 84 18 02 00 00    	je     803d30 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803b18:	e8 78 ee ff ff       	call   802995 <page_is_clean>
+  803b1d:	84 c0                	test   %al,%al
+  803b1f:	0f 85 8c 00 00 00    	jne    803bb1 <page_out+0xed>
+	if (pagingenv == 0)
+  803b25:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803b2c:	0f 84 08 02 00 00    	je     803d3a <page_out+0x276>
+	if (page_ring_ready())
+  803b32:	e8 4b f1 ff ff       	call   802c82 <page_ring_ready>
+  803b37:	89 c3                	mov    %eax,%ebx
+  803b39:	85 c0                	test   %eax,%eax
+  803b3b:	0f 85 89 00 00 00    	jne    803bca <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  803b41:	83 ec 0c             	sub    $0xc,%esp
+  803b44:	6a 05                	push   $0x5
+  803b46:	6a 01                	push   $0x1
+  803b48:	56                   	push   %esi
+  803b49:	6a 01                	push   $0x1
+  803b4b:	ff 35 40 b0 80 00    	push   0x80b040
+  803b51:	e8 71 de ff ff       	call   8019c7 <ipc_call>
+  803b56:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803b58:	83 c4 20             	add    $0x20,%esp
+  803b5b:	85 c0                	test   %eax,%eax
+  803b5d:	0f 88 b8 01 00 00    	js     803d1b <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803b63:	89 f0                	mov    %esi,%eax
+  803b65:	c1 e8 0c             	shr    $0xc,%eax
+  803b68:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b6f:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803b72:	83 ec 08             	sub    $0x8,%esp
+  803b75:	56                   	push   %esi
+  803b76:	6a 00                	push   $0x0
+  803b78:	e8 14 d2 ff ff       	call   800d91 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803b7d:	83 c4 08             	add    $0x8,%esp
+  803b80:	6a 01                	push   $0x1
+  803b82:	56                   	push   %esi
+  803b83:	e8 92 fe ff ff       	call   803a1a <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803b88:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803b8b:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803b91:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803b94:	09 fe                	or     %edi,%esi
+  803b96:	83 ce 01             	or     $0x1,%esi
+  803b99:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803b9b:	83 c4 10             	add    $0x10,%esp
+}
+  803b9e:	89 d8                	mov    %ebx,%eax
+  803ba0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ba3:	5b                   	pop    %ebx
+  803ba4:	5e                   	pop    %esi
+  803ba5:	5f                   	pop    %edi
+  803ba6:	5d                   	pop    %ebp
+  803ba7:	c3                   	ret
+		num_page_reclaims++;
+  803ba8:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  803baf:	eb ed                	jmp    803b9e <page_out+0xda>
+		num_page_drops++;
+  803bb1:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  803bb8:	83 ec 08             	sub    $0x8,%esp
+  803bbb:	56                   	push   %esi
+  803bbc:	6a 00                	push   $0x0
+  803bbe:	e8 ce d1 ff ff       	call   800d91 <sys_page_unmap>
+  803bc3:	89 c3                	mov    %eax,%ebx
+  803bc5:	83 c4 10             	add    $0x10,%esp
+  803bc8:	eb d4                	jmp    803b9e <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803bca:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803bcc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803bd1:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803bd6:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803bd9:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803bdb:	83 c0 08             	add    $0x8,%eax
+  803bde:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803be1:	b8 07 00 00 00       	mov    $0x7,%eax
+  803be6:	e8 e5 ef ff ff       	call   802bd0 <page_ring_reserve>
+	first = ring->sq_tail;
+  803beb:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803bf0:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803bf3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803bf8:	83 ec 04             	sub    $0x4,%esp
+  803bfb:	68 00 10 00 00       	push   $0x1000
+  803c00:	56                   	push   %esi
+  803c01:	89 d8                	mov    %ebx,%eax
+  803c03:	c1 e0 0c             	shl    $0xc,%eax
+  803c06:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803c0b:	50                   	push   %eax
+  803c0c:	e8 f0 cd ff ff       	call   800a01 <memcpy>
+		vas[n] = va;
+  803c11:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803c15:	89 d9                	mov    %ebx,%ecx
+  803c17:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c1c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803c21:	e8 de ee ff ff       	call   802b04 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803c26:	8d 43 01             	lea    0x1(%ebx),%eax
+  803c29:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803c2c:	83 c4 10             	add    $0x10,%esp
+  803c2f:	83 fb 06             	cmp    $0x6,%ebx
+  803c32:	74 62                	je     803c96 <page_out+0x1d2>
+  803c34:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803c37:	eb 15                	jmp    803c4e <page_out+0x18a>
+			num_page_drops++;
+  803c39:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  803c40:	83 ec 08             	sub    $0x8,%esp
+  803c43:	56                   	push   %esi
+  803c44:	6a 00                	push   $0x0
+  803c46:	e8 46 d1 ff ff       	call   800d91 <sys_page_unmap>
+  803c4b:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803c4e:	83 ec 08             	sub    $0x8,%esp
+  803c51:	53                   	push   %ebx
+  803c52:	57                   	push   %edi
+  803c53:	e8 99 f8 ff ff       	call   8034f1 <get_page_choice>
+  803c58:	89 c6                	mov    %eax,%esi
+  803c5a:	83 c4 10             	add    $0x10,%esp
+  803c5d:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803c62:	74 32                	je     803c96 <page_out+0x1d2>
+  803c64:	e8 2c ed ff ff       	call   802995 <page_is_clean>
+  803c69:	84 c0                	test   %al,%al
+  803c6b:	75 cc                	jne    803c39 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803c6d:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803c70:	39 c6                	cmp    %eax,%esi
+  803c72:	72 07                	jb     803c7b <page_out+0x1b7>
+  803c74:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803c77:	39 c6                	cmp    %eax,%esi
+  803c79:	72 1b                	jb     803c96 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803c7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c80:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803c83:	eb 03                	jmp    803c88 <page_out+0x1c4>
+  803c85:	83 c3 01             	add    $0x1,%ebx
+  803c88:	39 da                	cmp    %ebx,%edx
+  803c8a:	0f 84 68 ff ff ff    	je     803bf8 <page_out+0x134>
+  803c90:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803c94:	75 ef                	jne    803c85 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803c96:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803c99:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803c9c:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803c9f:	e8 a6 ee ff ff       	call   802b4a <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803ca4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ca9:	eb 42                	jmp    803ced <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803cab:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803caf:	89 f8                	mov    %edi,%eax
+  803cb1:	c1 e8 0c             	shr    $0xc,%eax
+  803cb4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803cbb:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803cbe:	83 ec 08             	sub    $0x8,%esp
+  803cc1:	57                   	push   %edi
+  803cc2:	6a 00                	push   $0x0
+  803cc4:	e8 c8 d0 ff ff       	call   800d91 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803cc9:	83 c4 08             	add    $0x8,%esp
+  803ccc:	6a 01                	push   $0x1
+  803cce:	57                   	push   %edi
+  803ccf:	e8 46 fd ff ff       	call   803a1a <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803cd4:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803cd7:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803cdd:	c1 e6 0c             	shl    $0xc,%esi
+  803ce0:	09 d6                	or     %edx,%esi
+  803ce2:	83 ce 01             	or     $0x1,%esi
+  803ce5:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803ce7:	83 c3 01             	add    $0x1,%ebx
+  803cea:	83 c4 10             	add    $0x10,%esp
+  803ced:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803cf0:	39 c3                	cmp    %eax,%ebx
+  803cf2:	74 1d                	je     803d11 <page_out+0x24d>
+		if (res[i] < 0)
+  803cf4:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803cf8:	85 f6                	test   %esi,%esi
+  803cfa:	79 af                	jns    803cab <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803cfc:	56                   	push   %esi
+  803cfd:	68 bc 5b 80 00       	push   $0x805bbc
+  803d02:	68 d1 02 00 00       	push   $0x2d1
+  803d07:	68 d2 58 80 00       	push   $0x8058d2
+  803d0c:	e8 46 c4 ff ff       	call   800157 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803d11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d16:	e9 83 fe ff ff       	jmp    803b9e <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803d1b:	50                   	push   %eax
+  803d1c:	68 bc 5b 80 00       	push   $0x805bbc
+  803d21:	68 0a 03 00 00       	push   $0x30a
+  803d26:	68 d2 58 80 00       	push   $0x8058d2
+  803d2b:	e8 27 c4 ff ff       	call   800157 <_panic>
+		return -E_NO_MEM;
+  803d30:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803d35:	e9 64 fe ff ff       	jmp    803b9e <page_out+0xda>
+		return -E_PAGING;
+  803d3a:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803d3f:	e9 5a fe ff ff       	jmp    803b9e <page_out+0xda>
+
+00803d44 <page_alloc>:
+{
+  803d44:	55                   	push   %ebp
+  803d45:	89 e5                	mov    %esp,%ebp
+  803d47:	57                   	push   %edi
+  803d48:	56                   	push   %esi
+  803d49:	53                   	push   %ebx
+  803d4a:	83 ec 0c             	sub    $0xc,%esp
+  803d4d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803d50:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803d53:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803d5a:	74 34                	je     803d90 <page_alloc+0x4c>
+	if (check_mte)
+  803d5c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803d60:	75 35                	jne    803d97 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803d62:	83 ec 04             	sub    $0x4,%esp
+  803d65:	ff 75 10             	push   0x10(%ebp)
+  803d68:	56                   	push   %esi
+  803d69:	57                   	push   %edi
+  803d6a:	e8 9d cf ff ff       	call   800d0c <sys_page_alloc>
+  803d6f:	89 c3                	mov    %eax,%ebx
+  803d71:	83 c4 10             	add    $0x10,%esp
+  803d74:	85 c0                	test   %eax,%eax
+  803d76:	79 52                	jns    803dca <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803d78:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803d7b:	75 52                	jne    803dcf <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803d7d:	83 ec 08             	sub    $0x8,%esp
+  803d80:	56                   	push   %esi
+  803d81:	57                   	push   %edi
+  803d82:	e8 3d fd ff ff       	call   803ac4 <page_out>
+  803d87:	83 c4 10             	add    $0x10,%esp
+  803d8a:	85 c0                	test   %eax,%eax
+  803d8c:	79 d4                	jns    803d62 <page_alloc+0x1e>
+  803d8e:	eb 3f                	jmp    803dcf <page_alloc+0x8b>
+		init_map_dir();
+  803d90:	e8 2f fc ff ff       	call   8039c4 <init_map_dir>
+  803d95:	eb c5                	jmp    803d5c <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803d97:	83 ec 08             	sub    $0x8,%esp
+  803d9a:	6a 00                	push   $0x0
+  803d9c:	56                   	push   %esi
+  803d9d:	e8 78 fc ff ff       	call   803a1a <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803da2:	83 c4 10             	add    $0x10,%esp
+  803da5:	85 c0                	test   %eax,%eax
+  803da7:	74 b9                	je     803d62 <page_alloc+0x1e>
+  803da9:	8b 10                	mov    (%eax),%edx
+  803dab:	f6 c2 01             	test   $0x1,%dl
+  803dae:	74 b2                	je     803d62 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803db0:	83 ec 08             	sub    $0x8,%esp
+  803db3:	56                   	push   %esi
+  803db4:	52                   	push   %edx
+  803db5:	50                   	push   %eax
+  803db6:	68 e0 5b 80 00       	push   $0x805be0
+  803dbb:	68 34 03 00 00       	push   $0x334
+  803dc0:	68 d2 58 80 00       	push   $0x8058d2
+  803dc5:	e8 8d c3 ff ff       	call   800157 <_panic>
+	return 0;
+  803dca:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803dcf:	89 d8                	mov    %ebx,%eax
+  803dd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dd4:	5b                   	pop    %ebx
+  803dd5:	5e                   	pop    %esi
+  803dd6:	5f                   	pop    %edi
+  803dd7:	5d                   	pop    %ebp
+  803dd8:	c3                   	ret
+
+00803dd9 <page_adopt>:
+{
+  803dd9:	55                   	push   %ebp
+  803dda:	89 e5                	mov    %esp,%ebp
+  803ddc:	56                   	push   %esi
+  803ddd:	53                   	push   %ebx
+  803dde:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803de0:	c1 e8 16             	shr    $0x16,%eax
+  803de3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803dea:	25 81 00 00 00       	and    $0x81,%eax
+  803def:	83 f8 01             	cmp    $0x1,%eax
+  803df2:	75 53                	jne    803e47 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803df4:	89 d8                	mov    %ebx,%eax
+  803df6:	c1 e8 0c             	shr    $0xc,%eax
+  803df9:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803e00:	89 f2                	mov    %esi,%edx
+  803e02:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803e08:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803e0d:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803e13:	75 37                	jne    803e4c <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803e15:	83 ec 08             	sub    $0x8,%esp
+  803e18:	6a 01                	push   $0x1
+  803e1a:	53                   	push   %ebx
+  803e1b:	e8 fa fb ff ff       	call   803a1a <umapdir_walk>
+  803e20:	83 c4 10             	add    $0x10,%esp
+  803e23:	85 c0                	test   %eax,%eax
+  803e25:	74 2c                	je     803e53 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803e27:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803e2d:	83 ce 01             	or     $0x1,%esi
+  803e30:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803e32:	83 ec 08             	sub    $0x8,%esp
+  803e35:	53                   	push   %ebx
+  803e36:	6a 00                	push   $0x0
+  803e38:	e8 54 cf ff ff       	call   800d91 <sys_page_unmap>
+	return 1;
+  803e3d:	83 c4 10             	add    $0x10,%esp
+  803e40:	b8 01 00 00 00       	mov    $0x1,%eax
+  803e45:	eb 05                	jmp    803e4c <page_adopt+0x73>
+		return 0;
+  803e47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e4c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e4f:	5b                   	pop    %ebx
+  803e50:	5e                   	pop    %esi
+  803e51:	5d                   	pop    %ebp
+  803e52:	c3                   	ret
+		return -E_NO_MEM;
+  803e53:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803e58:	eb f2                	jmp    803e4c <page_adopt+0x73>
+
+00803e5a <page_forget>:
+{
+  803e5a:	55                   	push   %ebp
+  803e5b:	89 e5                	mov    %esp,%ebp
+  803e5d:	53                   	push   %ebx
+  803e5e:	83 ec 04             	sub    $0x4,%esp
+  803e61:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803e63:	e8 4a ef ff ff       	call   802db2 <find_paging_env>
+	if (pagingenv == 0)
+  803e68:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803e6f:	74 39                	je     803eaa <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803e71:	89 d8                	mov    %ebx,%eax
+  803e73:	c1 e8 16             	shr    $0x16,%eax
+  803e76:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803e7d:	25 81 00 00 00       	and    $0x81,%eax
+  803e82:	83 f8 01             	cmp    $0x1,%eax
+  803e85:	74 28                	je     803eaf <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803e87:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803e8e:	74 1a                	je     803eaa <page_forget+0x50>
+  803e90:	83 ec 08             	sub    $0x8,%esp
+  803e93:	6a 00                	push   $0x0
+  803e95:	53                   	push   %ebx
+  803e96:	e8 7f fb ff ff       	call   803a1a <umapdir_walk>
+  803e9b:	89 c3                	mov    %eax,%ebx
+  803e9d:	83 c4 10             	add    $0x10,%esp
+  803ea0:	85 c0                	test   %eax,%eax
+  803ea2:	74 06                	je     803eaa <page_forget+0x50>
+  803ea4:	8b 00                	mov    (%eax),%eax
+  803ea6:	a8 01                	test   $0x1,%al
+  803ea8:	75 2b                	jne    803ed5 <page_forget+0x7b>
+}
+  803eaa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ead:	c9                   	leave
+  803eae:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803eaf:	89 d8                	mov    %ebx,%eax
+  803eb1:	c1 e8 0c             	shr    $0xc,%eax
+  803eb4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803ebb:	89 c2                	mov    %eax,%edx
+  803ebd:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803ec3:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803ec9:	75 bc                	jne    803e87 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803ecb:	c1 e8 0c             	shr    $0xc,%eax
+  803ece:	e8 5c ee ff ff       	call   802d2f <page_remove_slot>
+		return;
+  803ed3:	eb d5                	jmp    803eaa <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803ed5:	c1 e8 0c             	shr    $0xc,%eax
+  803ed8:	e8 52 ee ff ff       	call   802d2f <page_remove_slot>
+	*mte = 0;
+  803edd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803ee3:	eb c5                	jmp    803eaa <page_forget+0x50>
+
+00803ee5 <page_unmap>:
+{
+  803ee5:	55                   	push   %ebp
+  803ee6:	89 e5                	mov    %esp,%ebp
+  803ee8:	57                   	push   %edi
+  803ee9:	56                   	push   %esi
+  803eea:	53                   	push   %ebx
+  803eeb:	83 ec 0c             	sub    $0xc,%esp
+  803eee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803ef1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803ef4:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803ef9:	8b 40 48             	mov    0x48(%eax),%eax
+  803efc:	85 db                	test   %ebx,%ebx
+  803efe:	0f 8e b4 00 00 00    	jle    803fb8 <page_unmap+0xd3>
+  803f04:	39 d8                	cmp    %ebx,%eax
+  803f06:	0f 84 ac 00 00 00    	je     803fb8 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803f0c:	83 ec 08             	sub    $0x8,%esp
+  803f0f:	57                   	push   %edi
+  803f10:	53                   	push   %ebx
+  803f11:	e8 7b ce ff ff       	call   800d91 <sys_page_unmap>
+  803f16:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803f18:	e8 95 ee ff ff       	call   802db2 <find_paging_env>
+	if (pagingenv == 0)
+  803f1d:	83 c4 10             	add    $0x10,%esp
+  803f20:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803f27:	0f 84 a1 00 00 00    	je     803fce <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803f2d:	83 ec 0c             	sub    $0xc,%esp
+  803f30:	6a 05                	push   $0x5
+  803f32:	68 00 00 40 00       	push   $0x400000
+  803f37:	6a 00                	push   $0x0
+  803f39:	68 00 b0 ad de       	push   $0xdeadb000
+  803f3e:	53                   	push   %ebx
+  803f3f:	e8 0b ce ff ff       	call   800d4f <sys_page_map>
+  803f44:	83 c4 20             	add    $0x20,%esp
+  803f47:	85 c0                	test   %eax,%eax
+  803f49:	0f 88 89 00 00 00    	js     803fd8 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803f4f:	89 f8                	mov    %edi,%eax
+  803f51:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803f54:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803f5b:	a8 01                	test   $0x1,%al
+  803f5d:	74 6f                	je     803fce <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803f5f:	83 ec 0c             	sub    $0xc,%esp
+  803f62:	6a 05                	push   $0x5
+  803f64:	68 00 00 40 00       	push   $0x400000
+  803f69:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803f6b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803f70:	50                   	push   %eax
+  803f71:	53                   	push   %ebx
+  803f72:	e8 d8 cd ff ff       	call   800d4f <sys_page_map>
+  803f77:	83 c4 20             	add    $0x20,%esp
+  803f7a:	85 c0                	test   %eax,%eax
+  803f7c:	78 6f                	js     803fed <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803f7e:	c1 ef 0c             	shr    $0xc,%edi
+  803f81:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803f87:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803f8e:	01 
+  803f8f:	74 3d                	je     803fce <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803f91:	83 ec 08             	sub    $0x8,%esp
+  803f94:	68 00 00 40 00       	push   $0x400000
+  803f99:	6a 00                	push   $0x0
+  803f9b:	e8 f1 cd ff ff       	call   800d91 <sys_page_unmap>
+  803fa0:	83 c4 10             	add    $0x10,%esp
+  803fa3:	85 c0                	test   %eax,%eax
+  803fa5:	78 5b                	js     804002 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803fa7:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803fae:	c1 e8 0c             	shr    $0xc,%eax
+  803fb1:	e8 79 ed ff ff       	call   802d2f <page_remove_slot>
+	return r;
+  803fb6:	eb 16                	jmp    803fce <page_unmap+0xe9>
+		page_forget(va);
+  803fb8:	89 f8                	mov    %edi,%eax
+  803fba:	e8 9b fe ff ff       	call   803e5a <page_forget>
+		return sys_page_unmap(envid, va);
+  803fbf:	83 ec 08             	sub    $0x8,%esp
+  803fc2:	57                   	push   %edi
+  803fc3:	53                   	push   %ebx
+  803fc4:	e8 c8 cd ff ff       	call   800d91 <sys_page_unmap>
+  803fc9:	89 c6                	mov    %eax,%esi
+  803fcb:	83 c4 10             	add    $0x10,%esp
+}
+  803fce:	89 f0                	mov    %esi,%eax
+  803fd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fd3:	5b                   	pop    %ebx
+  803fd4:	5e                   	pop    %esi
+  803fd5:	5f                   	pop    %edi
+  803fd6:	5d                   	pop    %ebp
+  803fd7:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803fd8:	50                   	push   %eax
+  803fd9:	68 1c 5c 80 00       	push   $0x805c1c
+  803fde:	68 e4 03 00 00       	push   $0x3e4
+  803fe3:	68 d2 58 80 00       	push   $0x8058d2
+  803fe8:	e8 6a c1 ff ff       	call   800157 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803fed:	50                   	push   %eax
+  803fee:	68 48 5c 80 00       	push   $0x805c48
+  803ff3:	68 ea 03 00 00       	push   $0x3ea
+  803ff8:	68 d2 58 80 00       	push   $0x8058d2
+  803ffd:	e8 55 c1 ff ff       	call   800157 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  804002:	50                   	push   %eax
+  804003:	68 74 5c 80 00       	push   $0x805c74
+  804008:	68 ef 03 00 00       	push   $0x3ef
+  80400d:	68 d2 58 80 00       	push   $0x8058d2
+  804012:	e8 40 c1 ff ff       	call   800157 <_panic>
+
+00804017 <page_unmap_range>:
+{
+  804017:	55                   	push   %ebp
+  804018:	89 e5                	mov    %esp,%ebp
+  80401a:	57                   	push   %edi
+  80401b:	56                   	push   %esi
+  80401c:	53                   	push   %ebx
+  80401d:	83 ec 0c             	sub    $0xc,%esp
+  804020:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  804023:	e8 8a ed ff ff       	call   802db2 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  804028:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80402d:	8b 40 48             	mov    0x48(%eax),%eax
+  804030:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804034:	7e 38                	jle    80406e <page_unmap_range+0x57>
+  804036:	3b 45 08             	cmp    0x8(%ebp),%eax
+  804039:	74 33                	je     80406e <page_unmap_range+0x57>
+  80403b:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  804042:	74 2a                	je     80406e <page_unmap_range+0x57>
+  804044:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  804047:	be 00 00 00 00       	mov    $0x0,%esi
+  80404c:	39 fe                	cmp    %edi,%esi
+  80404e:	74 56                	je     8040a6 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  804050:	83 ec 08             	sub    $0x8,%esp
+  804053:	53                   	push   %ebx
+  804054:	ff 75 08             	push   0x8(%ebp)
+  804057:	e8 89 fe ff ff       	call   803ee5 <page_unmap>
+  80405c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  804062:	83 c4 10             	add    $0x10,%esp
+  804065:	85 c0                	test   %eax,%eax
+  804067:	78 35                	js     80409e <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  804069:	83 c6 01             	add    $0x1,%esi
+  80406c:	eb de                	jmp    80404c <page_unmap_range+0x35>
+  80406e:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  804071:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804076:	eb 10                	jmp    804088 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  804078:	89 f0                	mov    %esi,%eax
+  80407a:	e8 db fd ff ff       	call   803e5a <page_forget>
+		for (i = 0; i < npages; i++)
+  80407f:	83 c3 01             	add    $0x1,%ebx
+  804082:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  804088:	39 fb                	cmp    %edi,%ebx
+  80408a:	75 ec                	jne    804078 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  80408c:	83 ec 04             	sub    $0x4,%esp
+  80408f:	57                   	push   %edi
+  804090:	ff 75 0c             	push   0xc(%ebp)
+  804093:	ff 75 08             	push   0x8(%ebp)
+  804096:	e8 0a ce ff ff       	call   800ea5 <sys_page_unmap_range>
+  80409b:	83 c4 10             	add    $0x10,%esp
+}
+  80409e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040a1:	5b                   	pop    %ebx
+  8040a2:	5e                   	pop    %esi
+  8040a3:	5f                   	pop    %edi
+  8040a4:	5d                   	pop    %ebp
+  8040a5:	c3                   	ret
+	return 0;
+  8040a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040ab:	eb f1                	jmp    80409e <page_unmap_range+0x87>
+
+008040ad <page_alloc_range>:
+{
+  8040ad:	55                   	push   %ebp
+  8040ae:	89 e5                	mov    %esp,%ebp
+  8040b0:	57                   	push   %edi
+  8040b1:	56                   	push   %esi
+  8040b2:	53                   	push   %ebx
+  8040b3:	83 ec 1c             	sub    $0x1c,%esp
+  8040b6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8040b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  8040bc:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  8040c3:	74 14                	je     8040d9 <page_alloc_range+0x2c>
+	if (check_mte)
+  8040c5:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8040c9:	74 66                	je     804131 <page_alloc_range+0x84>
+  8040cb:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  8040cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040d2:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  8040d5:	89 c7                	mov    %eax,%edi
+  8040d7:	eb 10                	jmp    8040e9 <page_alloc_range+0x3c>
+		init_map_dir();
+  8040d9:	e8 e6 f8 ff ff       	call   8039c4 <init_map_dir>
+  8040de:	eb e5                	jmp    8040c5 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  8040e0:	83 c7 01             	add    $0x1,%edi
+  8040e3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8040e9:	39 df                	cmp    %ebx,%edi
+  8040eb:	74 38                	je     804125 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  8040ed:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8040f0:	83 ec 08             	sub    $0x8,%esp
+  8040f3:	6a 00                	push   $0x0
+  8040f5:	56                   	push   %esi
+  8040f6:	e8 1f f9 ff ff       	call   803a1a <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  8040fb:	83 c4 10             	add    $0x10,%esp
+  8040fe:	85 c0                	test   %eax,%eax
+  804100:	74 de                	je     8040e0 <page_alloc_range+0x33>
+  804102:	8b 10                	mov    (%eax),%edx
+  804104:	f6 c2 01             	test   $0x1,%dl
+  804107:	74 d7                	je     8040e0 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  804109:	83 ec 08             	sub    $0x8,%esp
+  80410c:	ff 75 e4             	push   -0x1c(%ebp)
+  80410f:	52                   	push   %edx
+  804110:	50                   	push   %eax
+  804111:	68 e0 5b 80 00       	push   $0x805be0
+  804116:	68 0b 04 00 00       	push   $0x40b
+  80411b:	68 d2 58 80 00       	push   $0x8058d2
+  804120:	e8 32 c0 ff ff       	call   800157 <_panic>
+  804125:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804128:	eb 07                	jmp    804131 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  80412a:	c1 e0 0c             	shl    $0xc,%eax
+  80412d:	01 c7                	add    %eax,%edi
+			npages -= r;
+  80412f:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  804131:	85 db                	test   %ebx,%ebx
+  804133:	74 30                	je     804165 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  804135:	ff 75 14             	push   0x14(%ebp)
+  804138:	53                   	push   %ebx
+  804139:	57                   	push   %edi
+  80413a:	ff 75 08             	push   0x8(%ebp)
+  80413d:	e8 f5 cc ff ff       	call   800e37 <sys_page_alloc_range>
+  804142:	89 c6                	mov    %eax,%esi
+  804144:	83 c4 10             	add    $0x10,%esp
+  804147:	85 c0                	test   %eax,%eax
+  804149:	7f df                	jg     80412a <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  80414b:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  80414e:	75 1a                	jne    80416a <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  804150:	83 ec 08             	sub    $0x8,%esp
+  804153:	57                   	push   %edi
+  804154:	ff 75 08             	push   0x8(%ebp)
+  804157:	e8 68 f9 ff ff       	call   803ac4 <page_out>
+  80415c:	83 c4 10             	add    $0x10,%esp
+  80415f:	85 c0                	test   %eax,%eax
+  804161:	79 ce                	jns    804131 <page_alloc_range+0x84>
+  804163:	eb 05                	jmp    80416a <page_alloc_range+0xbd>
+	return 0;
+  804165:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  80416a:	89 f0                	mov    %esi,%eax
+  80416c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80416f:	5b                   	pop    %ebx
+  804170:	5e                   	pop    %esi
+  804171:	5f                   	pop    %edi
+  804172:	5d                   	pop    %ebp
+  804173:	c3                   	ret
+
+00804174 <page_in>:
+{
+  804174:	55                   	push   %ebp
+  804175:	89 e5                	mov    %esp,%ebp
+  804177:	57                   	push   %edi
+  804178:	56                   	push   %esi
+  804179:	53                   	push   %ebx
+  80417a:	83 ec 3c             	sub    $0x3c,%esp
+  80417d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  804180:	e8 2d ec ff ff       	call   802db2 <find_paging_env>
+	if (pagingenv == 0)
+  804185:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  80418c:	0f 84 09 02 00 00    	je     80439b <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  804192:	83 ec 08             	sub    $0x8,%esp
+  804195:	6a 00                	push   $0x0
+  804197:	56                   	push   %esi
+  804198:	e8 7d f8 ff ff       	call   803a1a <umapdir_walk>
+  80419d:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80419f:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8041a5:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  8041a8:	83 c4 10             	add    $0x10,%esp
+  8041ab:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8041af:	74 0d                	je     8041be <page_in+0x4a>
+  8041b1:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8041b6:	8b 40 48             	mov    0x48(%eax),%eax
+  8041b9:	3b 45 08             	cmp    0x8(%ebp),%eax
+  8041bc:	75 06                	jne    8041c4 <page_in+0x50>
+  8041be:	8b 03                	mov    (%ebx),%eax
+  8041c0:	a8 02                	test   $0x2,%al
+  8041c2:	75 63                	jne    804227 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  8041c4:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  8041c6:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  8041c8:	89 f0                	mov    %esi,%eax
+  8041ca:	25 06 0e 00 00       	and    $0xe06,%eax
+  8041cf:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  8041d2:	50                   	push   %eax
+  8041d3:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  8041d6:	57                   	push   %edi
+  8041d7:	ff 75 08             	push   0x8(%ebp)
+  8041da:	e8 65 fb ff ff       	call   803d44 <page_alloc>
+  8041df:	83 c4 10             	add    $0x10,%esp
+  8041e2:	85 c0                	test   %eax,%eax
+  8041e4:	78 39                	js     80421f <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  8041e6:	89 f0                	mov    %esi,%eax
+  8041e8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8041eb:	83 ec 0c             	sub    $0xc,%esp
+  8041ee:	6a 07                	push   $0x7
+  8041f0:	6a 01                	push   $0x1
+  8041f2:	57                   	push   %edi
+  8041f3:	c1 e0 04             	shl    $0x4,%eax
+  8041f6:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8041f7:	c1 ee 1c             	shr    $0x1c,%esi
+  8041fa:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8041fd:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  804204:	e8 be d7 ff ff       	call   8019c7 <ipc_call>
+  804209:	83 c4 20             	add    $0x20,%esp
+  80420c:	85 c0                	test   %eax,%eax
+  80420e:	0f 88 72 01 00 00    	js     804386 <page_in+0x212>
+	*mte = 0;
+  804214:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  80421a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80421f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804222:	5b                   	pop    %ebx
+  804223:	5e                   	pop    %esi
+  804224:	5f                   	pop    %edi
+  804225:	5d                   	pop    %ebp
+  804226:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804227:	25 06 0e 00 00       	and    $0xe06,%eax
+  80422c:	83 c8 01             	or     $0x1,%eax
+  80422f:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  804232:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804235:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  804238:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  80423e:	be 01 00 00 00       	mov    $0x1,%esi
+  804243:	eb 46                	jmp    80428b <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  804245:	83 ec 08             	sub    $0x8,%esp
+  804248:	6a 00                	push   $0x0
+  80424a:	51                   	push   %ecx
+  80424b:	e8 ca f7 ff ff       	call   803a1a <umapdir_walk>
+  804250:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  804254:	83 c4 10             	add    $0x10,%esp
+  804257:	85 c0                	test   %eax,%eax
+  804259:	74 66                	je     8042c1 <page_in+0x14d>
+  80425b:	8b 00                	mov    (%eax),%eax
+  80425d:	a8 01                	test   $0x1,%al
+  80425f:	74 60                	je     8042c1 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  804261:	89 c2                	mov    %eax,%edx
+  804263:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  804269:	83 ca 01             	or     $0x1,%edx
+  80426c:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  80426f:	75 50                	jne    8042c1 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  804271:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804277:	c1 e8 1c             	shr    $0x1c,%eax
+  80427a:	8b 13                	mov    (%ebx),%edx
+  80427c:	c1 ea 1c             	shr    $0x1c,%edx
+  80427f:	39 d0                	cmp    %edx,%eax
+  804281:	75 3e                	jne    8042c1 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804283:	83 c6 01             	add    $0x1,%esi
+  804286:	83 fe 08             	cmp    $0x8,%esi
+  804289:	74 3f                	je     8042ca <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  80428b:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  80428d:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  804293:	77 2c                	ja     8042c1 <page_in+0x14d>
+  804295:	89 f8                	mov    %edi,%eax
+  804297:	c1 e8 16             	shr    $0x16,%eax
+  80429a:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8042a1:	f6 c2 01             	test   $0x1,%dl
+  8042a4:	74 9f                	je     804245 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  8042a6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8042ad:	a8 80                	test   $0x80,%al
+  8042af:	75 10                	jne    8042c1 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  8042b1:	89 f8                	mov    %edi,%eax
+  8042b3:	c1 e8 0c             	shr    $0xc,%eax
+  8042b6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8042bd:	a8 01                	test   $0x1,%al
+  8042bf:	74 84                	je     804245 <page_in+0xd1>
+	if (n == 1)
+  8042c1:	83 fe 01             	cmp    $0x1,%esi
+  8042c4:	0f 84 fa fe ff ff    	je     8041c4 <page_in+0x50>
+	req.nslots = n;
+  8042ca:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  8042d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042d5:	eb 13                	jmp    8042ea <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  8042d7:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  8042db:	8b 12                	mov    (%edx),%edx
+  8042dd:	c1 ea 0c             	shr    $0xc,%edx
+  8042e0:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  8042e7:	83 c0 01             	add    $0x1,%eax
+  8042ea:	39 c6                	cmp    %eax,%esi
+  8042ec:	75 e9                	jne    8042d7 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  8042ee:	83 ec 0c             	sub    $0xc,%esp
+  8042f1:	6a 00                	push   $0x0
+  8042f3:	ff 75 c0             	push   -0x40(%ebp)
+  8042f6:	56                   	push   %esi
+  8042f7:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  8042fa:	57                   	push   %edi
+  8042fb:	6a 00                	push   $0x0
+  8042fd:	e8 ab fd ff ff       	call   8040ad <page_alloc_range>
+  804302:	83 c4 20             	add    $0x20,%esp
+  804305:	85 c0                	test   %eax,%eax
+  804307:	78 6e                	js     804377 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  804309:	83 ec 04             	sub    $0x4,%esp
+  80430c:	6a 24                	push   $0x24
+  80430e:	68 00 80 80 00       	push   $0x808000
+  804313:	57                   	push   %edi
+  804314:	e8 86 c6 ff ff       	call   80099f <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804319:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  804320:	56                   	push   %esi
+  804321:	57                   	push   %edi
+  804322:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  804324:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  80432b:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  80432e:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  804335:	e8 8d d6 ff ff       	call   8019c7 <ipc_call>
+  80433a:	83 c4 20             	add    $0x20,%esp
+  80433d:	85 c0                	test   %eax,%eax
+  80433f:	78 08                	js     804349 <page_in+0x1d5>
+  804341:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  804344:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  804347:	eb 20                	jmp    804369 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  804349:	50                   	push   %eax
+  80434a:	68 a0 5c 80 00       	push   $0x805ca0
+  80434f:	68 59 02 00 00       	push   $0x259
+  804354:	68 d2 58 80 00       	push   $0x8058d2
+  804359:	e8 f9 bd ff ff       	call   800157 <_panic>
+		*mtes[i] = 0;
+  80435e:	8b 10                	mov    (%eax),%edx
+  804360:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  804366:	83 c0 04             	add    $0x4,%eax
+  804369:	39 c8                	cmp    %ecx,%eax
+  80436b:	75 f1                	jne    80435e <page_in+0x1ea>
+	return n;
+  80436d:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  80436f:	85 f6                	test   %esi,%esi
+  804371:	0f 84 4d fe ff ff    	je     8041c4 <page_in+0x50>
+		return r < 0 ? r : 0;
+  804377:	85 c0                	test   %eax,%eax
+  804379:	ba 00 00 00 00       	mov    $0x0,%edx
+  80437e:	0f 4f c2             	cmovg  %edx,%eax
+  804381:	e9 99 fe ff ff       	jmp    80421f <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  804386:	50                   	push   %eax
+  804387:	68 d8 5c 80 00       	push   $0x805cd8
+  80438c:	68 9a 02 00 00       	push   $0x29a
+  804391:	68 d2 58 80 00       	push   $0x8058d2
+  804396:	e8 bc bd ff ff       	call   800157 <_panic>
+		return -E_PAGING;
+  80439b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8043a0:	e9 7a fe ff ff       	jmp    80421f <page_in+0xab>
+
+008043a5 <page_map>:
+{
+  8043a5:	55                   	push   %ebp
+  8043a6:	89 e5                	mov    %esp,%ebp
+  8043a8:	57                   	push   %edi
+  8043a9:	56                   	push   %esi
+  8043aa:	53                   	push   %ebx
+  8043ab:	83 ec 1c             	sub    $0x1c,%esp
+  8043ae:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8043b1:	83 ec 0c             	sub    $0xc,%esp
+  8043b4:	ff 75 18             	push   0x18(%ebp)
+  8043b7:	ff 75 14             	push   0x14(%ebp)
+  8043ba:	ff 75 10             	push   0x10(%ebp)
+  8043bd:	ff 75 0c             	push   0xc(%ebp)
+  8043c0:	56                   	push   %esi
+  8043c1:	e8 89 c9 ff ff       	call   800d4f <sys_page_map>
+  8043c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8043c9:	83 c4 20             	add    $0x20,%esp
+  8043cc:	85 c0                	test   %eax,%eax
+  8043ce:	0f 89 a9 01 00 00    	jns    80457d <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  8043d4:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  8043d8:	74 5f                	je     804439 <page_map+0x94>
+		if (r != -E_INVAL)
+  8043da:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  8043de:	0f 85 a0 01 00 00    	jne    804584 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8043e4:	85 f6                	test   %esi,%esi
+  8043e6:	74 70                	je     804458 <page_map+0xb3>
+  8043e8:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8043ed:	8b 40 48             	mov    0x48(%eax),%eax
+  8043f0:	39 f0                	cmp    %esi,%eax
+  8043f2:	74 64                	je     804458 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8043f4:	83 ec 0c             	sub    $0xc,%esp
+  8043f7:	6a 05                	push   $0x5
+  8043f9:	68 00 00 40 00       	push   $0x400000
+  8043fe:	6a 00                	push   $0x0
+  804400:	68 00 b0 ad de       	push   $0xdeadb000
+  804405:	56                   	push   %esi
+  804406:	e8 44 c9 ff ff       	call   800d4f <sys_page_map>
+  80440b:	89 c3                	mov    %eax,%ebx
+  80440d:	83 c4 20             	add    $0x20,%esp
+  804410:	85 c0                	test   %eax,%eax
+  804412:	79 6a                	jns    80447e <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  804414:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804417:	75 50                	jne    804469 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  804419:	83 ec 08             	sub    $0x8,%esp
+  80441c:	68 00 00 40 00       	push   $0x400000
+  804421:	6a fc                	push   $0xfffffffc
+  804423:	e8 9c f6 ff ff       	call   803ac4 <page_out>
+  804428:	83 c4 10             	add    $0x10,%esp
+  80442b:	85 c0                	test   %eax,%eax
+  80442d:	79 c5                	jns    8043f4 <page_map+0x4f>
+}
+  80442f:	89 d8                	mov    %ebx,%eax
+  804431:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804434:	5b                   	pop    %ebx
+  804435:	5e                   	pop    %esi
+  804436:	5f                   	pop    %edi
+  804437:	5d                   	pop    %ebp
+  804438:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  804439:	83 ec 08             	sub    $0x8,%esp
+  80443c:	68 00 00 40 00       	push   $0x400000
+  804441:	6a 00                	push   $0x0
+  804443:	e8 7c f6 ff ff       	call   803ac4 <page_out>
+  804448:	83 c4 10             	add    $0x10,%esp
+  80444b:	85 c0                	test   %eax,%eax
+  80444d:	0f 89 5e ff ff ff    	jns    8043b1 <page_map+0xc>
+				return r;
+  804453:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804456:	eb d7                	jmp    80442f <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804458:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80445b:	e8 79 f9 ff ff       	call   803dd9 <page_adopt>
+  804460:	85 c0                	test   %eax,%eax
+  804462:	79 90                	jns    8043f4 <page_map+0x4f>
+			return r;
+  804464:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804467:	eb c6                	jmp    80442f <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  804469:	53                   	push   %ebx
+  80446a:	68 0c 5d 80 00       	push   $0x805d0c
+  80446f:	68 77 03 00 00       	push   $0x377
+  804474:	68 d2 58 80 00       	push   $0x8058d2
+  804479:	e8 d9 bc ff ff       	call   800157 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  80447e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804481:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  804484:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  80448b:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  804491:	0f 84 f5 00 00 00    	je     80458c <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  804497:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80449d:	83 ec 0c             	sub    $0xc,%esp
+  8044a0:	6a 05                	push   $0x5
+  8044a2:	68 00 00 40 00       	push   $0x400000
+  8044a7:	6a 00                	push   $0x0
+  8044a9:	57                   	push   %edi
+  8044aa:	56                   	push   %esi
+  8044ab:	e8 9f c8 ff ff       	call   800d4f <sys_page_map>
+  8044b0:	89 c3                	mov    %eax,%ebx
+  8044b2:	83 c4 20             	add    $0x20,%esp
+  8044b5:	85 c0                	test   %eax,%eax
+  8044b7:	79 35                	jns    8044ee <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  8044b9:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8044bc:	75 1b                	jne    8044d9 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8044be:	83 ec 08             	sub    $0x8,%esp
+  8044c1:	68 00 00 40 00       	push   $0x400000
+  8044c6:	6a 00                	push   $0x0
+  8044c8:	e8 f7 f5 ff ff       	call   803ac4 <page_out>
+  8044cd:	83 c4 10             	add    $0x10,%esp
+  8044d0:	85 c0                	test   %eax,%eax
+  8044d2:	79 c9                	jns    80449d <page_map+0xf8>
+  8044d4:	e9 56 ff ff ff       	jmp    80442f <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  8044d9:	53                   	push   %ebx
+  8044da:	68 34 5d 80 00       	push   $0x805d34
+  8044df:	68 83 03 00 00       	push   $0x383
+  8044e4:	68 d2 58 80 00       	push   $0x8058d2
+  8044e9:	e8 69 bc ff ff       	call   800157 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  8044ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8044f1:	c1 e8 0c             	shr    $0xc,%eax
+  8044f4:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8044f9:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  804500:	01 
+  804501:	0f 84 8d 00 00 00    	je     804594 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  804507:	83 ec 08             	sub    $0x8,%esp
+  80450a:	68 00 00 40 00       	push   $0x400000
+  80450f:	6a 00                	push   $0x0
+  804511:	e8 7b c8 ff ff       	call   800d91 <sys_page_unmap>
+  804516:	83 c4 10             	add    $0x10,%esp
+  804519:	85 c0                	test   %eax,%eax
+  80451b:	78 36                	js     804553 <page_map+0x1ae>
+  80451d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  804520:	83 ec 08             	sub    $0x8,%esp
+  804523:	57                   	push   %edi
+  804524:	56                   	push   %esi
+  804525:	e8 4a fc ff ff       	call   804174 <page_in>
+  80452a:	89 c3                	mov    %eax,%ebx
+  80452c:	83 c4 10             	add    $0x10,%esp
+  80452f:	85 c0                	test   %eax,%eax
+  804531:	0f 89 7a fe ff ff    	jns    8043b1 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  804537:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80453a:	75 2c                	jne    804568 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  80453c:	83 ec 08             	sub    $0x8,%esp
+  80453f:	57                   	push   %edi
+  804540:	6a 00                	push   $0x0
+  804542:	e8 7d f5 ff ff       	call   803ac4 <page_out>
+  804547:	83 c4 10             	add    $0x10,%esp
+  80454a:	85 c0                	test   %eax,%eax
+  80454c:	79 d2                	jns    804520 <page_map+0x17b>
+  80454e:	e9 dc fe ff ff       	jmp    80442f <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  804553:	50                   	push   %eax
+  804554:	68 60 5d 80 00       	push   $0x805d60
+  804559:	68 8b 03 00 00       	push   $0x38b
+  80455e:	68 d2 58 80 00       	push   $0x8058d2
+  804563:	e8 ef bb ff ff       	call   800157 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  804568:	53                   	push   %ebx
+  804569:	68 88 5d 80 00       	push   $0x805d88
+  80456e:	68 91 03 00 00       	push   $0x391
+  804573:	68 d2 58 80 00       	push   $0x8058d2
+  804578:	e8 da bb ff ff       	call   800157 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  80457d:	89 c3                	mov    %eax,%ebx
+  80457f:	e9 ab fe ff ff       	jmp    80442f <page_map+0x8a>
+  804584:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804587:	e9 a3 fe ff ff       	jmp    80442f <page_map+0x8a>
+			return r; // Pass through the error
+  80458c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80458f:	e9 9b fe ff ff       	jmp    80442f <page_map+0x8a>
+			return r; // Pass through the error
+  804594:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804597:	e9 93 fe ff ff       	jmp    80442f <page_map+0x8a>
+
+0080459c <page_map_range>:
+{
+  80459c:	55                   	push   %ebp
+  80459d:	89 e5                	mov    %esp,%ebp
+  80459f:	57                   	push   %edi
+  8045a0:	56                   	push   %esi
+  8045a1:	53                   	push   %ebx
+  8045a2:	83 ec 0c             	sub    $0xc,%esp
+  8045a5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8045a8:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  8045ab:	83 ec 08             	sub    $0x8,%esp
+  8045ae:	ff 75 1c             	push   0x1c(%ebp)
+  8045b1:	ff 75 18             	push   0x18(%ebp)
+  8045b4:	56                   	push   %esi
+  8045b5:	ff 75 10             	push   0x10(%ebp)
+  8045b8:	57                   	push   %edi
+  8045b9:	ff 75 08             	push   0x8(%ebp)
+  8045bc:	e8 99 c8 ff ff       	call   800e5a <sys_page_map_range>
+  8045c1:	89 c3                	mov    %eax,%ebx
+  8045c3:	83 c4 20             	add    $0x20,%esp
+  8045c6:	85 c0                	test   %eax,%eax
+  8045c8:	79 1b                	jns    8045e5 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  8045ca:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8045cd:	75 20                	jne    8045ef <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8045cf:	83 ec 08             	sub    $0x8,%esp
+  8045d2:	68 00 00 40 00       	push   $0x400000
+  8045d7:	6a 00                	push   $0x0
+  8045d9:	e8 e6 f4 ff ff       	call   803ac4 <page_out>
+  8045de:	83 c4 10             	add    $0x10,%esp
+  8045e1:	85 c0                	test   %eax,%eax
+  8045e3:	79 c6                	jns    8045ab <page_map_range+0xf>
+}
+  8045e5:	89 d8                	mov    %ebx,%eax
+  8045e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045ea:	5b                   	pop    %ebx
+  8045eb:	5e                   	pop    %esi
+  8045ec:	5f                   	pop    %edi
+  8045ed:	5d                   	pop    %ebp
+  8045ee:	c3                   	ret
+		if (r != -E_INVAL)
+  8045ef:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  8045f2:	75 f1                	jne    8045e5 <page_map_range+0x49>
+  8045f4:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  8045f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8045fb:	eb 03                	jmp    804600 <page_map_range+0x64>
+  8045fd:	83 c6 01             	add    $0x1,%esi
+  804600:	3b 75 18             	cmp    0x18(%ebp),%esi
+  804603:	74 2a                	je     80462f <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  804605:	83 ec 0c             	sub    $0xc,%esp
+  804608:	ff 75 1c             	push   0x1c(%ebp)
+  80460b:	53                   	push   %ebx
+  80460c:	ff 75 10             	push   0x10(%ebp)
+  80460f:	57                   	push   %edi
+  804610:	ff 75 08             	push   0x8(%ebp)
+  804613:	e8 8d fd ff ff       	call   8043a5 <page_map>
+  804618:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80461e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  804624:	83 c4 20             	add    $0x20,%esp
+  804627:	85 c0                	test   %eax,%eax
+  804629:	79 d2                	jns    8045fd <page_map_range+0x61>
+  80462b:	89 c3                	mov    %eax,%ebx
+  80462d:	eb b6                	jmp    8045e5 <page_map_range+0x49>
+		return 0;
+  80462f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804634:	eb af                	jmp    8045e5 <page_map_range+0x49>
+
+00804636 <paging_pgfault_handler>:
+{
+  804636:	55                   	push   %ebp
+  804637:	89 e5                	mov    %esp,%ebp
+  804639:	56                   	push   %esi
+  80463a:	53                   	push   %ebx
+  80463b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  80463e:	e8 6f e7 ff ff       	call   802db2 <find_paging_env>
+	if (pagingenv == 0)
+  804643:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  804648:	85 c0                	test   %eax,%eax
+  80464a:	74 3c                	je     804688 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  80464c:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  80464e:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804652:	75 12                	jne    804666 <paging_pgfault_handler+0x30>
+  804654:	89 f0                	mov    %esi,%eax
+  804656:	e8 7e f7 ff ff       	call   803dd9 <page_adopt>
+  80465b:	89 c2                	mov    %eax,%edx
+		return 0;
+  80465d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804662:	85 d2                	test   %edx,%edx
+  804664:	78 22                	js     804688 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  804666:	83 ec 08             	sub    $0x8,%esp
+  804669:	6a 00                	push   $0x0
+  80466b:	56                   	push   %esi
+  80466c:	e8 a9 f3 ff ff       	call   803a1a <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  804671:	83 c4 10             	add    $0x10,%esp
+  804674:	85 c0                	test   %eax,%eax
+  804676:	74 05                	je     80467d <paging_pgfault_handler+0x47>
+  804678:	f6 00 01             	testb  $0x1,(%eax)
+  80467b:	75 12                	jne    80468f <paging_pgfault_handler+0x59>
+	return 0;
+  80467d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804682:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804686:	74 23                	je     8046ab <paging_pgfault_handler+0x75>
+}
+  804688:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80468b:	5b                   	pop    %ebx
+  80468c:	5e                   	pop    %esi
+  80468d:	5d                   	pop    %ebp
+  80468e:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  80468f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804694:	8b 40 48             	mov    0x48(%eax),%eax
+  804697:	83 ec 08             	sub    $0x8,%esp
+  80469a:	56                   	push   %esi
+  80469b:	50                   	push   %eax
+  80469c:	e8 d3 fa ff ff       	call   804174 <page_in>
+  8046a1:	f7 d0                	not    %eax
+  8046a3:	c1 e8 1f             	shr    $0x1f,%eax
+  8046a6:	83 c4 10             	add    $0x10,%esp
+  8046a9:	eb dd                	jmp    804688 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8046ab:	89 f0                	mov    %esi,%eax
+  8046ad:	e8 97 e2 ff ff       	call   802949 <segment_lookup>
+  8046b2:	89 c2                	mov    %eax,%edx
+	return 0;
+  8046b4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8046b9:	85 d2                	test   %edx,%edx
+  8046bb:	74 cb                	je     804688 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  8046bd:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8046c2:	8b 40 48             	mov    0x48(%eax),%eax
+  8046c5:	83 ec 08             	sub    $0x8,%esp
+  8046c8:	56                   	push   %esi
+  8046c9:	50                   	push   %eax
+  8046ca:	e8 f5 f3 ff ff       	call   803ac4 <page_out>
+  8046cf:	f7 d0                	not    %eax
+  8046d1:	c1 e8 1f             	shr    $0x1f,%eax
+  8046d4:	83 c4 10             	add    $0x10,%esp
+  8046d7:	eb af                	jmp    804688 <paging_pgfault_handler+0x52>
+
+008046d9 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  8046d9:	55                   	push   %ebp
+  8046da:	89 e5                	mov    %esp,%ebp
+  8046dc:	57                   	push   %edi
+  8046dd:	56                   	push   %esi
+  8046de:	53                   	push   %ebx
+  8046df:	83 ec 2c             	sub    $0x2c,%esp
+  8046e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8046e5:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  8046ea:	89 c1                	mov    %eax,%ecx
+  8046ec:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  8046ef:	c1 e8 11             	shr    $0x11,%eax
+  8046f2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8046f5:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  8046fc:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  8046ff:	b8 01 00 00 00       	mov    $0x1,%eax
+  804704:	d3 e0                	shl    %cl,%eax
+  804706:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  804709:	85 c7                	test   %eax,%edi
+  80470b:	74 12                	je     80471f <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  80470d:	bb 01 00 00 00       	mov    $0x1,%ebx
+  804712:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  804715:	bf 01 00 00 00       	mov    $0x1,%edi
+  80471a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80471d:	eb 17                	jmp    804736 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  80471f:	ff 75 e0             	push   -0x20(%ebp)
+  804722:	68 c0 5d 80 00       	push   $0x805dc0
+  804727:	6a 48                	push   $0x48
+  804729:	68 da 5d 80 00       	push   $0x805dda
+  80472e:	e8 24 ba ff ff       	call   800157 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804733:	83 c3 01             	add    $0x1,%ebx
+  804736:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804739:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  80473c:	89 c8                	mov    %ecx,%eax
+  80473e:	c1 e8 05             	shr    $0x5,%eax
+  804741:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  804748:	89 fe                	mov    %edi,%esi
+  80474a:	d3 e6                	shl    %cl,%esi
+  80474c:	89 f1                	mov    %esi,%ecx
+  80474e:	85 d6                	test   %edx,%esi
+  804750:	74 e1                	je     804733 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  804752:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  804755:	f7 d6                	not    %esi
+  804757:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80475a:	21 fe                	and    %edi,%esi
+  80475c:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80475f:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  804766:	f7 d1                	not    %ecx
+  804768:	21 d1                	and    %edx,%ecx
+  80476a:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804771:	83 ec 04             	sub    $0x4,%esp
+  804774:	53                   	push   %ebx
+  804775:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804778:	57                   	push   %edi
+  804779:	6a 00                	push   $0x0
+  80477b:	e8 97 f8 ff ff       	call   804017 <page_unmap_range>
+	va_free(va, n);
+  804780:	83 c4 08             	add    $0x8,%esp
+  804783:	53                   	push   %ebx
+  804784:	57                   	push   %edi
+  804785:	e8 ed 05 00 00       	call   804d77 <va_free>
+}
+  80478a:	83 c4 10             	add    $0x10,%esp
+  80478d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804790:	5b                   	pop    %ebx
+  804791:	5e                   	pop    %esi
+  804792:	5f                   	pop    %edi
+  804793:	5d                   	pop    %ebp
+  804794:	c3                   	ret
+
+00804795 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  804795:	55                   	push   %ebp
+  804796:	89 e5                	mov    %esp,%ebp
+  804798:	57                   	push   %edi
+  804799:	56                   	push   %esi
+  80479a:	53                   	push   %ebx
+  80479b:	83 ec 1c             	sub    $0x1c,%esp
+  80479e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  8047a1:	85 db                	test   %ebx,%ebx
+  8047a3:	74 34                	je     8047d9 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  8047a5:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8047ab:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  8047b0:	77 2f                	ja     8047e1 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  8047b2:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8047b8:	75 51                	jne    80480b <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  8047ba:	89 c1                	mov    %eax,%ecx
+  8047bc:	c1 e9 0c             	shr    $0xc,%ecx
+  8047bf:	ba 01 00 00 00       	mov    $0x1,%edx
+  8047c4:	d3 e2                	shl    %cl,%edx
+  8047c6:	c1 e8 11             	shr    $0x11,%eax
+  8047c9:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  8047d0:	75 24                	jne    8047f6 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  8047d2:	89 d8                	mov    %ebx,%eax
+  8047d4:	e8 00 ff ff ff       	call   8046d9 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  8047d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8047dc:	5b                   	pop    %ebx
+  8047dd:	5e                   	pop    %esi
+  8047de:	5f                   	pop    %edi
+  8047df:	5d                   	pop    %ebp
+  8047e0:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  8047e1:	53                   	push   %ebx
+  8047e2:	68 e7 5d 80 00       	push   $0x805de7
+  8047e7:	68 a2 00 00 00       	push   $0xa2
+  8047ec:	68 da 5d 80 00       	push   $0x805dda
+  8047f1:	e8 61 b9 ff ff       	call   800157 <_panic>
+			panic("free: %p is not allocated", va);
+  8047f6:	53                   	push   %ebx
+  8047f7:	68 c0 5d 80 00       	push   $0x805dc0
+  8047fc:	68 a5 00 00 00       	push   $0xa5
+  804801:	68 da 5d 80 00       	push   $0x805dda
+  804806:	e8 4c b9 ff ff       	call   800157 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  80480b:	89 de                	mov    %ebx,%esi
+  80480d:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  804813:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  804819:	89 c8                	mov    %ecx,%eax
+  80481b:	c1 e8 11             	shr    $0x11,%eax
+  80481e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804821:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  804828:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  80482b:	c1 e9 0c             	shr    $0xc,%ecx
+  80482e:	b8 01 00 00 00       	mov    $0x1,%eax
+  804833:	d3 e0                	shl    %cl,%eax
+  804835:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804838:	85 c7                	test   %eax,%edi
+  80483a:	74 1b                	je     804857 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  80483c:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804840:	89 d8                	mov    %ebx,%eax
+  804842:	29 f0                	sub    %esi,%eax
+  804844:	83 e8 10             	sub    $0x10,%eax
+  804847:	99                   	cltd
+  804848:	f7 ff                	idiv   %edi
+  80484a:	89 d1                	mov    %edx,%ecx
+  80484c:	85 d2                	test   %edx,%edx
+  80484e:	75 07                	jne    804857 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804850:	ba 10 00 00 00       	mov    $0x10,%edx
+  804855:	eb 18                	jmp    80486f <free+0xda>
+		panic("free: %p is not allocated", va);
+  804857:	53                   	push   %ebx
+  804858:	68 c0 5d 80 00       	push   $0x805dc0
+  80485d:	68 ad 00 00 00       	push   $0xad
+  804862:	68 da 5d 80 00       	push   $0x805dda
+  804867:	e8 eb b8 ff ff       	call   800157 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80486c:	83 c1 01             	add    $0x1,%ecx
+  80486f:	89 d0                	mov    %edx,%eax
+  804871:	d3 e0                	shl    %cl,%eax
+  804873:	39 c7                	cmp    %eax,%edi
+  804875:	7f f5                	jg     80486c <free+0xd7>
+	*(void **) va = s->free;
+  804877:	8b 46 08             	mov    0x8(%esi),%eax
+  80487a:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  80487c:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  80487f:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  804883:	8d 58 01             	lea    0x1(%eax),%ebx
+  804886:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  80488a:	66 85 c0             	test   %ax,%ax
+  80488d:	74 52                	je     8048e1 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  80488f:	0f b7 db             	movzwl %bx,%ebx
+  804892:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804896:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80489b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048a0:	f7 ff                	idiv   %edi
+  8048a2:	39 c3                	cmp    %eax,%ebx
+  8048a4:	0f 85 2f ff ff ff    	jne    8047d9 <free+0x44>
+  8048aa:	8b 46 04             	mov    0x4(%esi),%eax
+  8048ad:	85 c0                	test   %eax,%eax
+  8048af:	74 53                	je     804904 <free+0x16f>
+		s->prev->next = s->next;
+  8048b1:	8b 16                	mov    (%esi),%edx
+  8048b3:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8048b5:	8b 06                	mov    (%esi),%eax
+  8048b7:	85 c0                	test   %eax,%eax
+  8048b9:	74 06                	je     8048c1 <free+0x12c>
+		s->next->prev = s->prev;
+  8048bb:	8b 56 04             	mov    0x4(%esi),%edx
+  8048be:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8048c1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8048c4:	f7 d0                	not    %eax
+  8048c6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8048c9:	21 d0                	and    %edx,%eax
+  8048cb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8048ce:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  8048d5:	89 f0                	mov    %esi,%eax
+  8048d7:	e8 fd fd ff ff       	call   8046d9 <heap_free_pages>
+  8048dc:	e9 f8 fe ff ff       	jmp    8047d9 <free+0x44>
+	s->prev = NULL;
+  8048e1:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  8048e8:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  8048ef:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  8048f1:	85 c0                	test   %eax,%eax
+  8048f3:	74 03                	je     8048f8 <free+0x163>
+		slabs[c]->prev = s;
+  8048f5:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  8048f8:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  8048ff:	e9 d5 fe ff ff       	jmp    8047d9 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804904:	8b 06                	mov    (%esi),%eax
+  804906:	85 c0                	test   %eax,%eax
+  804908:	0f 84 cb fe ff ff    	je     8047d9 <free+0x44>
+		slabs[c] = s->next;
+  80490e:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  804915:	8b 06                	mov    (%esi),%eax
+  804917:	eb a2                	jmp    8048bb <free+0x126>
+
+00804919 <heap_alloc_pages>:
+{
+  804919:	55                   	push   %ebp
+  80491a:	89 e5                	mov    %esp,%ebp
+  80491c:	57                   	push   %edi
+  80491d:	56                   	push   %esi
+  80491e:	53                   	push   %ebx
+  80491f:	83 ec 18             	sub    $0x18,%esp
+  804922:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  804924:	50                   	push   %eax
+  804925:	e8 15 03 00 00       	call   804c3f <va_alloc>
+  80492a:	89 c3                	mov    %eax,%ebx
+  80492c:	83 c4 10             	add    $0x10,%esp
+  80492f:	85 c0                	test   %eax,%eax
+  804931:	74 47                	je     80497a <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804933:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804939:	89 c1                	mov    %eax,%ecx
+  80493b:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  80493e:	c1 e8 11             	shr    $0x11,%eax
+  804941:	ba 01 00 00 00       	mov    $0x1,%edx
+  804946:	89 d7                	mov    %edx,%edi
+  804948:	d3 e7                	shl    %cl,%edi
+  80494a:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  804951:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  804955:	89 c8                	mov    %ecx,%eax
+  804957:	c1 e8 05             	shr    $0x5,%eax
+  80495a:	d3 e2                	shl    %cl,%edx
+  80495c:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  804963:	83 ec 0c             	sub    $0xc,%esp
+  804966:	6a 00                	push   $0x0
+  804968:	6a 07                	push   $0x7
+  80496a:	56                   	push   %esi
+  80496b:	53                   	push   %ebx
+  80496c:	6a 00                	push   $0x0
+  80496e:	e8 3a f7 ff ff       	call   8040ad <page_alloc_range>
+  804973:	83 c4 20             	add    $0x20,%esp
+  804976:	85 c0                	test   %eax,%eax
+  804978:	78 0a                	js     804984 <heap_alloc_pages+0x6b>
+}
+  80497a:	89 d8                	mov    %ebx,%eax
+  80497c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80497f:	5b                   	pop    %ebx
+  804980:	5e                   	pop    %esi
+  804981:	5f                   	pop    %edi
+  804982:	5d                   	pop    %ebp
+  804983:	c3                   	ret
+		free(va);
+  804984:	83 ec 0c             	sub    $0xc,%esp
+  804987:	53                   	push   %ebx
+  804988:	e8 08 fe ff ff       	call   804795 <free>
+		return NULL;
+  80498d:	83 c4 10             	add    $0x10,%esp
+  804990:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804995:	eb e3                	jmp    80497a <heap_alloc_pages+0x61>
+
+00804997 <malloc>:
+{
+  804997:	55                   	push   %ebp
+  804998:	89 e5                	mov    %esp,%ebp
+  80499a:	57                   	push   %edi
+  80499b:	56                   	push   %esi
+  80499c:	53                   	push   %ebx
+  80499d:	83 ec 1c             	sub    $0x1c,%esp
+  8049a0:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  8049a3:	8d 50 ff             	lea    -0x1(%eax),%edx
+  8049a6:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  8049ac:	0f 87 21 01 00 00    	ja     804ad3 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8049b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8049b7:	ba 10 00 00 00       	mov    $0x10,%edx
+  8049bc:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  8049be:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8049c3:	76 15                	jbe    8049da <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  8049c5:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8049ca:	c1 e8 0c             	shr    $0xc,%eax
+  8049cd:	e8 47 ff ff ff       	call   804919 <heap_alloc_pages>
+  8049d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8049d5:	eb 37                	jmp    804a0e <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8049d7:	83 c1 01             	add    $0x1,%ecx
+  8049da:	89 d6                	mov    %edx,%esi
+  8049dc:	d3 e6                	shl    %cl,%esi
+  8049de:	39 c6                	cmp    %eax,%esi
+  8049e0:	72 f5                	jb     8049d7 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  8049e2:	89 cb                	mov    %ecx,%ebx
+  8049e4:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  8049eb:	85 ff                	test   %edi,%edi
+  8049ed:	74 2a                	je     804a19 <malloc+0x82>
+	v = s->free;
+  8049ef:	8b 47 08             	mov    0x8(%edi),%eax
+  8049f2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  8049f5:	8b 00                	mov    (%eax),%eax
+  8049f7:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  8049fa:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  8049fe:	83 e8 01             	sub    $0x1,%eax
+  804a01:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  804a05:	66 85 c0             	test   %ax,%ax
+  804a08:	0f 84 9a 00 00 00    	je     804aa8 <malloc+0x111>
+}
+  804a0e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804a11:	83 c4 1c             	add    $0x1c,%esp
+  804a14:	5b                   	pop    %ebx
+  804a15:	5e                   	pop    %esi
+  804a16:	5f                   	pop    %edi
+  804a17:	5d                   	pop    %ebp
+  804a18:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  804a19:	b8 01 00 00 00       	mov    $0x1,%eax
+  804a1e:	e8 f6 fe ff ff       	call   804919 <heap_alloc_pages>
+  804a23:	89 c1                	mov    %eax,%ecx
+  804a25:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804a28:	85 c0                	test   %eax,%eax
+  804a2a:	74 e2                	je     804a0e <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804a2c:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  804a32:	89 c8                	mov    %ecx,%eax
+  804a34:	c1 e8 11             	shr    $0x11,%eax
+  804a37:	c1 e9 0c             	shr    $0xc,%ecx
+  804a3a:	ba 01 00 00 00       	mov    $0x1,%edx
+  804a3f:	d3 e2                	shl    %cl,%edx
+  804a41:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804a48:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804a4b:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  804a4f:	0f b7 f6             	movzwl %si,%esi
+  804a52:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804a57:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a5c:	f7 fe                	idiv   %esi
+  804a5e:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804a62:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  804a65:	85 c0                	test   %eax,%eax
+  804a67:	74 14                	je     804a7d <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  804a69:	83 e8 01             	sub    $0x1,%eax
+  804a6c:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804a70:	0f af d0             	imul   %eax,%edx
+  804a73:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804a77:	89 3a                	mov    %edi,(%edx)
+  804a79:	89 d7                	mov    %edx,%edi
+  804a7b:	eb e5                	jmp    804a62 <malloc+0xcb>
+	s->prev = NULL;
+  804a7d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804a80:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804a87:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  804a8e:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804a90:	85 c0                	test   %eax,%eax
+  804a92:	74 03                	je     804a97 <malloc+0x100>
+		slabs[c]->prev = s;
+  804a94:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804a97:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804a9a:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  804aa1:	89 c7                	mov    %eax,%edi
+  804aa3:	e9 47 ff ff ff       	jmp    8049ef <malloc+0x58>
+	if (s->prev)
+  804aa8:	8b 47 04             	mov    0x4(%edi),%eax
+  804aab:	85 c0                	test   %eax,%eax
+  804aad:	74 19                	je     804ac8 <malloc+0x131>
+		s->prev->next = s->next;
+  804aaf:	8b 17                	mov    (%edi),%edx
+  804ab1:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804ab3:	8b 07                	mov    (%edi),%eax
+  804ab5:	85 c0                	test   %eax,%eax
+  804ab7:	0f 84 51 ff ff ff    	je     804a0e <malloc+0x77>
+		s->next->prev = s->prev;
+  804abd:	8b 57 04             	mov    0x4(%edi),%edx
+  804ac0:	89 50 04             	mov    %edx,0x4(%eax)
+  804ac3:	e9 46 ff ff ff       	jmp    804a0e <malloc+0x77>
+		slabs[c] = s->next;
+  804ac8:	8b 07                	mov    (%edi),%eax
+  804aca:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  804ad1:	eb e0                	jmp    804ab3 <malloc+0x11c>
+		return NULL;
+  804ad3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804ada:	e9 2f ff ff ff       	jmp    804a0e <malloc+0x77>
+
+00804adf <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804adf:	55                   	push   %ebp
+  804ae0:	89 e5                	mov    %esp,%ebp
+  804ae2:	57                   	push   %edi
+  804ae3:	56                   	push   %esi
+  804ae4:	53                   	push   %ebx
+  804ae5:	83 ec 0c             	sub    $0xc,%esp
+  804ae8:	89 c6                	mov    %eax,%esi
+  804aea:	89 d7                	mov    %edx,%edi
+  804aec:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804aef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804af4:	ba 00 00 00 00       	mov    $0x0,%edx
+  804af9:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  804afe:	83 ef 01             	sub    $0x1,%edi
+  804b01:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804b04:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  804b07:	eb 34                	jmp    804b3d <va_chunk_scan+0x5e>
+			i += 31;
+  804b09:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  804b0c:	89 ca                	mov    %ecx,%edx
+			continue;
+  804b0e:	eb 23                	jmp    804b33 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804b10:	89 c7                	mov    %eax,%edi
+  804b12:	c1 ef 05             	shr    $0x5,%edi
+  804b15:	be 01 00 00 00       	mov    $0x1,%esi
+  804b1a:	d3 e6                	shl    %cl,%esi
+  804b1c:	89 f1                	mov    %esi,%ecx
+  804b1e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804b21:	23 0c be             	and    (%esi,%edi,4),%ecx
+  804b24:	75 41                	jne    804b67 <va_chunk_scan+0x88>
+			len++;
+  804b26:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804b29:	39 d3                	cmp    %edx,%ebx
+  804b2b:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  804b2e:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  804b31:	72 2d                	jb     804b60 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804b33:	83 c0 01             	add    $0x1,%eax
+  804b36:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804b3b:	77 31                	ja     804b6e <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  804b3d:	89 c1                	mov    %eax,%ecx
+  804b3f:	83 e1 1f             	and    $0x1f,%ecx
+  804b42:	75 cc                	jne    804b10 <va_chunk_scan+0x31>
+  804b44:	89 c7                	mov    %eax,%edi
+  804b46:	c1 ef 05             	shr    $0x5,%edi
+  804b49:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804b4c:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804b4f:	83 ff ff             	cmp    $0xffffffff,%edi
+  804b52:	74 b5                	je     804b09 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  804b54:	85 ff                	test   %edi,%edi
+  804b56:	75 b8                	jne    804b10 <va_chunk_scan+0x31>
+			i += 31;
+  804b58:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804b5b:	83 c2 20             	add    $0x20,%edx
+  804b5e:	eb c9                	jmp    804b29 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804b60:	83 c0 01             	add    $0x1,%eax
+  804b63:	29 d0                	sub    %edx,%eax
+  804b65:	eb 15                	jmp    804b7c <va_chunk_scan+0x9d>
+			len = 0;
+  804b67:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b6c:	eb c5                	jmp    804b33 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804b6e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804b73:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804b76:	85 d2                	test   %edx,%edx
+  804b78:	74 02                	je     804b7c <va_chunk_scan+0x9d>
+		*run_store = best;
+  804b7a:	89 1a                	mov    %ebx,(%edx)
+}
+  804b7c:	83 c4 0c             	add    $0xc,%esp
+  804b7f:	5b                   	pop    %ebx
+  804b80:	5e                   	pop    %esi
+  804b81:	5f                   	pop    %edi
+  804b82:	5d                   	pop    %ebp
+  804b83:	c3                   	ret
+
+00804b84 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804b84:	55                   	push   %ebp
+  804b85:	89 e5                	mov    %esp,%ebp
+  804b87:	57                   	push   %edi
+  804b88:	56                   	push   %esi
+  804b89:	53                   	push   %ebx
+  804b8a:	83 ec 14             	sub    $0x14,%esp
+  804b8d:	89 c3                	mov    %eax,%ebx
+  804b8f:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804b91:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804b97:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  804b9d:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804ba0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804ba3:	89 d6                	mov    %edx,%esi
+  804ba5:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  804bab:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804bad:	eb 34                	jmp    804be3 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804baf:	89 c8                	mov    %ecx,%eax
+  804bb1:	c1 e8 05             	shr    $0x5,%eax
+  804bb4:	89 da                	mov    %ebx,%edx
+  804bb6:	c1 e2 05             	shl    $0x5,%edx
+  804bb9:	01 da                	add    %ebx,%edx
+  804bbb:	01 c2                	add    %eax,%edx
+  804bbd:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804bc2:	d3 c0                	rol    %cl,%eax
+  804bc4:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804bcb:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804bd2:	b8 01 00 00 00       	mov    $0x1,%eax
+  804bd7:	01 d0                	add    %edx,%eax
+  804bd9:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804be0:	83 c1 01             	add    $0x1,%ecx
+  804be3:	39 f9                	cmp    %edi,%ecx
+  804be5:	74 30                	je     804c17 <va_chunk_mark+0x93>
+		if (alloc)
+  804be7:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804beb:	74 c2                	je     804baf <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804bed:	89 c8                	mov    %ecx,%eax
+  804bef:	c1 e8 05             	shr    $0x5,%eax
+  804bf2:	89 da                	mov    %ebx,%edx
+  804bf4:	c1 e2 05             	shl    $0x5,%edx
+  804bf7:	01 da                	add    %ebx,%edx
+  804bf9:	01 c2                	add    %eax,%edx
+  804bfb:	b8 01 00 00 00       	mov    $0x1,%eax
+  804c00:	d3 e0                	shl    %cl,%eax
+  804c02:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804c09:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804c10:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804c15:	eb c0                	jmp    804bd7 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804c17:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804c1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c1f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804c22:	e8 b8 fe ff ff       	call   804adf <va_chunk_scan>
+	ch->run = run;
+  804c27:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804c2d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804c30:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  804c37:	83 c4 14             	add    $0x14,%esp
+  804c3a:	5b                   	pop    %ebx
+  804c3b:	5e                   	pop    %esi
+  804c3c:	5f                   	pop    %edi
+  804c3d:	5d                   	pop    %ebp
+  804c3e:	c3                   	ret
+
+00804c3f <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804c3f:	55                   	push   %ebp
+  804c40:	89 e5                	mov    %esp,%ebp
+  804c42:	57                   	push   %edi
+  804c43:	56                   	push   %esi
+  804c44:	53                   	push   %ebx
+  804c45:	83 ec 04             	sub    $0x4,%esp
+  804c48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804c4b:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  804c50:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  804c55:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  804c5c:	74 4f                	je     804cad <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804c5e:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804c61:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804c66:	0f 87 01 01 00 00    	ja     804d6d <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804c6c:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804c72:	0f 87 80 00 00 00    	ja     804cf8 <va_alloc+0xb9>
+  804c78:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804c7d:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804c82:	0f b7 10             	movzwl (%eax),%edx
+  804c85:	05 84 00 00 00       	add    $0x84,%eax
+  804c8a:	39 da                	cmp    %ebx,%edx
+  804c8c:	73 2c                	jae    804cba <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804c8e:	83 c6 01             	add    $0x1,%esi
+  804c91:	83 fe 1c             	cmp    $0x1c,%esi
+  804c94:	75 ec                	jne    804c82 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804c96:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c9b:	eb 53                	jmp    804cf0 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804c9d:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804ca3:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804ca8:	05 84 00 00 00       	add    $0x84,%eax
+  804cad:	39 d0                	cmp    %edx,%eax
+  804caf:	75 ec                	jne    804c9d <va_alloc+0x5e>
+	va_inited = 1;
+  804cb1:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  804cb8:	eb a4                	jmp    804c5e <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804cba:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804cc0:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  804cc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804cca:	89 da                	mov    %ebx,%edx
+  804ccc:	e8 0e fe ff ff       	call   804adf <va_chunk_scan>
+  804cd1:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804cd3:	6a 01                	push   $0x1
+  804cd5:	89 d9                	mov    %ebx,%ecx
+  804cd7:	89 c2                	mov    %eax,%edx
+  804cd9:	89 f0                	mov    %esi,%eax
+  804cdb:	e8 a4 fe ff ff       	call   804b84 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804ce0:	c1 e6 16             	shl    $0x16,%esi
+  804ce3:	c1 e7 0c             	shl    $0xc,%edi
+  804ce6:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804ced:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804cf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804cf3:	5b                   	pop    %ebx
+  804cf4:	5e                   	pop    %esi
+  804cf5:	5f                   	pop    %edi
+  804cf6:	5d                   	pop    %ebp
+  804cf7:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804cf8:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804cfe:	c1 ee 0a             	shr    $0xa,%esi
+  804d01:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804d06:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d0b:	eb 0a                	jmp    804d17 <va_alloc+0xd8>
+			first = c + 1;
+  804d0d:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804d0f:	83 c2 01             	add    $0x1,%edx
+  804d12:	83 fa 1d             	cmp    $0x1d,%edx
+  804d15:	74 4f                	je     804d66 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804d17:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804d1d:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  804d24:	00 04 
+  804d26:	75 e5                	jne    804d0d <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804d28:	89 d1                	mov    %edx,%ecx
+  804d2a:	29 c1                	sub    %eax,%ecx
+  804d2c:	39 f1                	cmp    %esi,%ecx
+  804d2e:	75 df                	jne    804d0f <va_alloc+0xd0>
+  804d30:	89 c7                	mov    %eax,%edi
+  804d32:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804d35:	be 00 04 00 00       	mov    $0x400,%esi
+  804d3a:	39 f3                	cmp    %esi,%ebx
+  804d3c:	0f 46 f3             	cmovbe %ebx,%esi
+  804d3f:	6a 01                	push   $0x1
+  804d41:	89 f1                	mov    %esi,%ecx
+  804d43:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d48:	89 f8                	mov    %edi,%eax
+  804d4a:	e8 35 fe ff ff       	call   804b84 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804d4f:	83 c7 01             	add    $0x1,%edi
+  804d52:	83 c4 04             	add    $0x4,%esp
+  804d55:	29 f3                	sub    %esi,%ebx
+  804d57:	75 dc                	jne    804d35 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804d59:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804d5c:	c1 e0 16             	shl    $0x16,%eax
+  804d5f:	05 00 00 00 08       	add    $0x8000000,%eax
+  804d64:	eb 8a                	jmp    804cf0 <va_alloc+0xb1>
+	return NULL;
+  804d66:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d6b:	eb 83                	jmp    804cf0 <va_alloc+0xb1>
+		return NULL;
+  804d6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d72:	e9 79 ff ff ff       	jmp    804cf0 <va_alloc+0xb1>
+
+00804d77 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804d77:	55                   	push   %ebp
+  804d78:	89 e5                	mov    %esp,%ebp
+  804d7a:	57                   	push   %edi
+  804d7b:	56                   	push   %esi
+  804d7c:	53                   	push   %ebx
+  804d7d:	83 ec 0c             	sub    $0xc,%esp
+  804d80:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804d83:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804d86:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804d8c:	76 21                	jbe    804daf <va_free+0x38>
+  804d8e:	89 f0                	mov    %esi,%eax
+  804d90:	c1 e0 0c             	shl    $0xc,%eax
+  804d93:	01 f8                	add    %edi,%eax
+  804d95:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804d9a:	77 13                	ja     804daf <va_free+0x38>
+	    || PGOFF(va))
+  804d9c:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804da2:	75 0b                	jne    804daf <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804da4:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804daa:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804dad:	eb 45                	jmp    804df4 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804daf:	83 ec 0c             	sub    $0xc,%esp
+  804db2:	56                   	push   %esi
+  804db3:	57                   	push   %edi
+  804db4:	68 04 5e 80 00       	push   $0x805e04
+  804db9:	68 8e 00 00 00       	push   $0x8e
+  804dbe:	68 24 5e 80 00       	push   $0x805e24
+  804dc3:	e8 8f b3 ff ff       	call   800157 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804dc8:	89 fa                	mov    %edi,%edx
+  804dca:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804dd0:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804dd5:	29 d3                	sub    %edx,%ebx
+  804dd7:	39 f3                	cmp    %esi,%ebx
+  804dd9:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804ddc:	89 f8                	mov    %edi,%eax
+  804dde:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804de1:	83 ec 0c             	sub    $0xc,%esp
+  804de4:	6a 00                	push   $0x0
+  804de6:	89 d9                	mov    %ebx,%ecx
+  804de8:	e8 97 fd ff ff       	call   804b84 <va_chunk_mark>
+		i += n;
+  804ded:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804def:	29 de                	sub    %ebx,%esi
+  804df1:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804df4:	85 f6                	test   %esi,%esi
+  804df6:	75 d0                	jne    804dc8 <va_free+0x51>
+	}
+}
+  804df8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804dfb:	5b                   	pop    %ebx
+  804dfc:	5e                   	pop    %esi
+  804dfd:	5f                   	pop    %edi
+  804dfe:	5d                   	pop    %ebp
+  804dff:	c3                   	ret
+
+00804e00 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804e00:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e05:	c3                   	ret
+
+00804e06 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804e06:	55                   	push   %ebp
+  804e07:	89 e5                	mov    %esp,%ebp
+  804e09:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804e0c:	68 31 5e 80 00       	push   $0x805e31
+  804e11:	ff 75 0c             	push   0xc(%ebp)
+  804e14:	e8 00 ba ff ff       	call   800819 <strcpy>
+	return 0;
+}
+  804e19:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e1e:	c9                   	leave
+  804e1f:	c3                   	ret
+
+00804e20 <devcons_write>:
+{
+  804e20:	55                   	push   %ebp
+  804e21:	89 e5                	mov    %esp,%ebp
+  804e23:	57                   	push   %edi
+  804e24:	56                   	push   %esi
+  804e25:	53                   	push   %ebx
+  804e26:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804e2c:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804e31:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804e37:	eb 2e                	jmp    804e67 <devcons_write+0x47>
+		m = n - tot;
+  804e39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804e3c:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804e3e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804e43:	39 c3                	cmp    %eax,%ebx
+  804e45:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804e48:	83 ec 04             	sub    $0x4,%esp
+  804e4b:	53                   	push   %ebx
+  804e4c:	89 f0                	mov    %esi,%eax
+  804e4e:	03 45 0c             	add    0xc(%ebp),%eax
+  804e51:	50                   	push   %eax
+  804e52:	57                   	push   %edi
+  804e53:	e8 47 bb ff ff       	call   80099f <memmove>
+		sys_cputs(buf, m);
+  804e58:	83 c4 08             	add    $0x8,%esp
+  804e5b:	53                   	push   %ebx
+  804e5c:	57                   	push   %edi
+  804e5d:	e8 dd bd ff ff       	call   800c3f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804e62:	01 de                	add    %ebx,%esi
+  804e64:	83 c4 10             	add    $0x10,%esp
+  804e67:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804e6a:	72 cd                	jb     804e39 <devcons_write+0x19>
+}
+  804e6c:	89 f0                	mov    %esi,%eax
+  804e6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804e71:	5b                   	pop    %ebx
+  804e72:	5e                   	pop    %esi
+  804e73:	5f                   	pop    %edi
+  804e74:	5d                   	pop    %ebp
+  804e75:	c3                   	ret
+
+00804e76 <devcons_read>:
+{
+  804e76:	55                   	push   %ebp
+  804e77:	89 e5                	mov    %esp,%ebp
+  804e79:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804e7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e81:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804e85:	75 07                	jne    804e8e <devcons_read+0x18>
+  804e87:	eb 1f                	jmp    804ea8 <devcons_read+0x32>
+		sys_yield();
+  804e89:	e8 5f be ff ff       	call   800ced <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804e8e:	e8 db bd ff ff       	call   800c6e <sys_cgetc>
+  804e93:	85 c0                	test   %eax,%eax
+  804e95:	74 f2                	je     804e89 <devcons_read+0x13>
+	if (c < 0)
+  804e97:	78 0f                	js     804ea8 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804e99:	83 f8 04             	cmp    $0x4,%eax
+  804e9c:	74 0c                	je     804eaa <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804e9e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804ea1:	88 02                	mov    %al,(%edx)
+	return 1;
+  804ea3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804ea8:	c9                   	leave
+  804ea9:	c3                   	ret
+		return 0;
+  804eaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  804eaf:	eb f7                	jmp    804ea8 <devcons_read+0x32>
+
+00804eb1 <cputchar>:
+{
+  804eb1:	55                   	push   %ebp
+  804eb2:	89 e5                	mov    %esp,%ebp
+  804eb4:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804eb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  804eba:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804ebd:	6a 01                	push   $0x1
+  804ebf:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804ec2:	50                   	push   %eax
+  804ec3:	e8 77 bd ff ff       	call   800c3f <sys_cputs>
+}
+  804ec8:	83 c4 10             	add    $0x10,%esp
+  804ecb:	c9                   	leave
+  804ecc:	c3                   	ret
+
+00804ecd <getchar>:
+{
+  804ecd:	55                   	push   %ebp
+  804ece:	89 e5                	mov    %esp,%ebp
+  804ed0:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804ed3:	6a 01                	push   $0x1
+  804ed5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804ed8:	50                   	push   %eax
+  804ed9:	6a 00                	push   $0x0
+  804edb:	e8 d7 ce ff ff       	call   801db7 <read>
+	if (r < 0)
+  804ee0:	83 c4 10             	add    $0x10,%esp
+  804ee3:	85 c0                	test   %eax,%eax
+  804ee5:	78 06                	js     804eed <getchar+0x20>
+	if (r < 1)
+  804ee7:	74 06                	je     804eef <getchar+0x22>
+	return c;
+  804ee9:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804eed:	c9                   	leave
+  804eee:	c3                   	ret
+		return -E_EOF;
+  804eef:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804ef4:	eb f7                	jmp    804eed <getchar+0x20>
+
+00804ef6 <iscons>:
+{
+  804ef6:	55                   	push   %ebp
+  804ef7:	89 e5                	mov    %esp,%ebp
+  804ef9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804efc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804eff:	50                   	push   %eax
+  804f00:	ff 75 08             	push   0x8(%ebp)
+  804f03:	e8 50 cc ff ff       	call   801b58 <fd_lookup>
+  804f08:	83 c4 10             	add    $0x10,%esp
+  804f0b:	85 c0                	test   %eax,%eax
+  804f0d:	78 11                	js     804f20 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804f0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804f12:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804f18:	39 10                	cmp    %edx,(%eax)
+  804f1a:	0f 94 c0             	sete   %al
+  804f1d:	0f b6 c0             	movzbl %al,%eax
+}
+  804f20:	c9                   	leave
+  804f21:	c3                   	ret
+
+00804f22 <opencons>:
+{
+  804f22:	55                   	push   %ebp
+  804f23:	89 e5                	mov    %esp,%ebp
+  804f25:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804f28:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804f2b:	50                   	push   %eax
+  804f2c:	e8 d3 cb ff ff       	call   801b04 <fd_alloc>
+  804f31:	83 c4 10             	add    $0x10,%esp
+  804f34:	85 c0                	test   %eax,%eax
+  804f36:	78 3a                	js     804f72 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804f38:	83 ec 04             	sub    $0x4,%esp
+  804f3b:	68 07 04 00 00       	push   $0x407
+  804f40:	ff 75 f4             	push   -0xc(%ebp)
+  804f43:	6a 00                	push   $0x0
+  804f45:	e8 c2 bd ff ff       	call   800d0c <sys_page_alloc>
+  804f4a:	83 c4 10             	add    $0x10,%esp
+  804f4d:	85 c0                	test   %eax,%eax
+  804f4f:	78 21                	js     804f72 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804f51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804f54:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804f5a:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804f5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804f5f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804f66:	83 ec 0c             	sub    $0xc,%esp
+  804f69:	50                   	push   %eax
+  804f6a:	e8 6e cb ff ff       	call   801add <fd2num>
+  804f6f:	83 c4 10             	add    $0x10,%esp
+}
+  804f72:	c9                   	leave
+  804f73:	c3                   	ret
+
+00804f74 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804f74:	55                   	push   %ebp
+  804f75:	89 e5                	mov    %esp,%ebp
+  804f77:	56                   	push   %esi
+  804f78:	53                   	push   %ebx
+  804f79:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804f7c:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  804f81:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804f84:	85 db                	test   %ebx,%ebx
+  804f86:	78 17                	js     804f9f <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804f88:	83 ec 0c             	sub    $0xc,%esp
+  804f8b:	56                   	push   %esi
+  804f8c:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  804f93:	83 c4 10             	add    $0x10,%esp
+  804f96:	85 c0                	test   %eax,%eax
+  804f98:	75 27                	jne    804fc1 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804f9a:	83 eb 01             	sub    $0x1,%ebx
+  804f9d:	eb e5                	jmp    804f84 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804f9f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804fa4:	8b 40 48             	mov    0x48(%eax),%eax
+  804fa7:	83 ec 08             	sub    $0x8,%esp
+  804faa:	ff 76 28             	push   0x28(%esi)
+  804fad:	ff 36                	push   (%esi)
+  804faf:	50                   	push   %eax
+  804fb0:	68 40 5e 80 00       	push   $0x805e40
+  804fb5:	6a 1d                	push   $0x1d
+  804fb7:	68 63 5e 80 00       	push   $0x805e63
+  804fbc:	e8 96 b1 ff ff       	call   800157 <_panic>
+}
+  804fc1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804fc4:	5b                   	pop    %ebx
+  804fc5:	5e                   	pop    %esi
+  804fc6:	5d                   	pop    %ebp
+  804fc7:	c3                   	ret
+
+00804fc8 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804fc8:	55                   	push   %ebp
+  804fc9:	89 e5                	mov    %esp,%ebp
+  804fcb:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804fce:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  804fd5:	74 0a                	je     804fe1 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804fd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  804fda:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  804fdf:	c9                   	leave
+  804fe0:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804fe1:	83 ec 04             	sub    $0x4,%esp
+  804fe4:	6a 07                	push   $0x7
+  804fe6:	68 00 f0 bf ee       	push   $0xeebff000
+  804feb:	6a 00                	push   $0x0
+  804fed:	e8 1a bd ff ff       	call   800d0c <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804ff2:	83 c4 08             	add    $0x8,%esp
+  804ff5:	68 68 50 80 00       	push   $0x805068
+  804ffa:	6a 00                	push   $0x0
+  804ffc:	e8 71 c0 ff ff       	call   801072 <sys_env_set_pgfault_upcall>
+  805001:	83 c4 10             	add    $0x10,%esp
+  805004:	eb d1                	jmp    804fd7 <set_pgfault_handler+0xf>
+
+00805006 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  805006:	55                   	push   %ebp
+  805007:	89 e5                	mov    %esp,%ebp
+  805009:	83 ec 08             	sub    $0x8,%esp
+  80500c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  80500f:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  805015:	b8 00 00 00 00       	mov    $0x0,%eax
+  80501a:	eb 03                	jmp    80501f <add_pgfault_handler+0x19>
+  80501c:	83 c0 01             	add    $0x1,%eax
+  80501f:	39 d0                	cmp    %edx,%eax
+  805021:	74 0b                	je     80502e <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  805023:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  80502a:	75 f0                	jne    80501c <add_pgfault_handler+0x16>
+  80502c:	eb 24                	jmp    805052 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  80502e:	83 fa 0a             	cmp    $0xa,%edx
+  805031:	74 21                	je     805054 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  805033:	8d 42 01             	lea    0x1(%edx),%eax
+  805036:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  80503b:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  805042:	83 ec 0c             	sub    $0xc,%esp
+  805045:	68 74 4f 80 00       	push   $0x804f74
+  80504a:	e8 79 ff ff ff       	call   804fc8 <set_pgfault_handler>
+  80504f:	83 c4 10             	add    $0x10,%esp
+}
+  805052:	c9                   	leave
+  805053:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  805054:	83 ec 04             	sub    $0x4,%esp
+  805057:	68 71 5e 80 00       	push   $0x805e71
+  80505c:	6a 44                	push   $0x44
+  80505e:	68 63 5e 80 00       	push   $0x805e63
+  805063:	e8 ef b0 ff ff       	call   800157 <_panic>
+
+00805068 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  805068:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  805069:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  80506e:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  805070:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  805073:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  805077:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  80507b:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  80507e:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  805080:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  805084:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  805087:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  805088:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  80508b:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  80508c:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80508d:	c3                   	ret
+
+0080508e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80508e:	55                   	push   %ebp
+  80508f:	89 e5                	mov    %esp,%ebp
+  805091:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805094:	89 c2                	mov    %eax,%edx
+  805096:	c1 ea 16             	shr    $0x16,%edx
+  805099:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8050a0:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8050a5:	f6 c1 01             	test   $0x1,%cl
+  8050a8:	74 1e                	je     8050c8 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  8050aa:	c1 e8 0c             	shr    $0xc,%eax
+  8050ad:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8050b4:	a8 01                	test   $0x1,%al
+  8050b6:	74 10                	je     8050c8 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8050b8:	c1 e8 0c             	shr    $0xc,%eax
+  8050bb:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8050be:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  8050c5:	0f b7 d2             	movzwl %dx,%edx
+}
+  8050c8:	89 d0                	mov    %edx,%eax
+  8050ca:	5d                   	pop    %ebp
+  8050cb:	c3                   	ret
+
+008050cc <udivmod>:
+  8050cc:	55                   	push   %ebp
+  8050cd:	57                   	push   %edi
+  8050ce:	56                   	push   %esi
+  8050cf:	53                   	push   %ebx
+  8050d0:	83 ec 24             	sub    $0x24,%esp
+  8050d3:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8050d7:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8050db:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8050df:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8050e3:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8050e7:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8050eb:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8050ef:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8050f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050fe:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  805105:	00 
+  805106:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80510d:	00 
+  80510e:	89 fb                	mov    %edi,%ebx
+  805110:	eb 08                	jmp    80511a <udivmod+0x4e>
+  805112:	83 e9 01             	sub    $0x1,%ecx
+  805115:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  805118:	74 68                	je     805182 <udivmod+0xb6>
+  80511a:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80511e:	01 c0                	add    %eax,%eax
+  805120:	89 c6                	mov    %eax,%esi
+  805122:	89 d7                	mov    %edx,%edi
+  805124:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805128:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80512c:	0f ad d0             	shrd   %cl,%edx,%eax
+  80512f:	d3 ea                	shr    %cl,%edx
+  805131:	f6 c1 20             	test   $0x20,%cl
+  805134:	74 04                	je     80513a <udivmod+0x6e>
+  805136:	89 d0                	mov    %edx,%eax
+  805138:	31 d2                	xor    %edx,%edx
+  80513a:	83 e0 01             	and    $0x1,%eax
+  80513d:	89 04 24             	mov    %eax,(%esp)
+  805140:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805147:	00 
+  805148:	8b 04 24             	mov    (%esp),%eax
+  80514b:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80514f:	09 f0                	or     %esi,%eax
+  805151:	09 fa                	or     %edi,%edx
+  805153:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805157:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80515b:	39 f0                	cmp    %esi,%eax
+  80515d:	89 d5                	mov    %edx,%ebp
+  80515f:	19 fd                	sbb    %edi,%ebp
+  805161:	72 af                	jb     805112 <udivmod+0x46>
+  805163:	29 f0                	sub    %esi,%eax
+  805165:	19 fa                	sbb    %edi,%edx
+  805167:	89 cf                	mov    %ecx,%edi
+  805169:	c1 ef 05             	shr    $0x5,%edi
+  80516c:	83 e7 01             	and    $0x1,%edi
+  80516f:	89 fe                	mov    %edi,%esi
+  805171:	83 f6 01             	xor    $0x1,%esi
+  805174:	d3 e6                	shl    %cl,%esi
+  805176:	d3 e7                	shl    %cl,%edi
+  805178:	09 74 24 18          	or     %esi,0x18(%esp)
+  80517c:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  805180:	eb 90                	jmp    805112 <udivmod+0x46>
+  805182:	85 db                	test   %ebx,%ebx
+  805184:	74 05                	je     80518b <udivmod+0xbf>
+  805186:	89 03                	mov    %eax,(%ebx)
+  805188:	89 53 04             	mov    %edx,0x4(%ebx)
+  80518b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80518f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805193:	83 c4 24             	add    $0x24,%esp
+  805196:	5b                   	pop    %ebx
+  805197:	5e                   	pop    %esi
+  805198:	5f                   	pop    %edi
+  805199:	5d                   	pop    %ebp
+  80519a:	c3                   	ret
+
+0080519b <__udivdi3>:
+  80519b:	83 ec 08             	sub    $0x8,%esp
+  80519e:	6a 00                	push   $0x0
+  8051a0:	ff 74 24 1c          	push   0x1c(%esp)
+  8051a4:	ff 74 24 1c          	push   0x1c(%esp)
+  8051a8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8051ac:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8051b0:	e8 17 ff ff ff       	call   8050cc <udivmod>
+  8051b5:	83 c4 14             	add    $0x14,%esp
+  8051b8:	c3                   	ret
+
+008051b9 <__umoddi3>:
+  8051b9:	83 ec 18             	sub    $0x18,%esp
+  8051bc:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8051c0:	50                   	push   %eax
+  8051c1:	ff 74 24 2c          	push   0x2c(%esp)
+  8051c5:	ff 74 24 2c          	push   0x2c(%esp)
+  8051c9:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8051cd:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8051d1:	e8 f6 fe ff ff       	call   8050cc <udivmod>
+  8051d6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8051da:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8051de:	83 c4 24             	add    $0x24,%esp
+  8051e1:	c3                   	ret
+
+008051e2 <__divdi3>:
+  8051e2:	55                   	push   %ebp
+  8051e3:	57                   	push   %edi
+  8051e4:	56                   	push   %esi
+  8051e5:	53                   	push   %ebx
+  8051e6:	83 ec 10             	sub    $0x10,%esp
+  8051e9:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8051ed:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8051f1:	89 c6                	mov    %eax,%esi
+  8051f3:	89 d7                	mov    %edx,%edi
+  8051f5:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8051f9:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8051fd:	89 74 24 04          	mov    %esi,0x4(%esp)
+  805201:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  805205:	89 c5                	mov    %eax,%ebp
+  805207:	f7 dd                	neg    %ebp
+  805209:	89 d6                	mov    %edx,%esi
+  80520b:	83 d6 00             	adc    $0x0,%esi
+  80520e:	f7 de                	neg    %esi
+  805210:	0f 48 e8             	cmovs  %eax,%ebp
+  805213:	0f 49 d6             	cmovns %esi,%edx
+  805216:	6a 00                	push   $0x0
+  805218:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80521c:	f7 de                	neg    %esi
+  80521e:	8b 44 24 34          	mov    0x34(%esp),%eax
+  805222:	83 d0 00             	adc    $0x0,%eax
+  805225:	f7 d8                	neg    %eax
+  805227:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  80522c:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  805231:	50                   	push   %eax
+  805232:	56                   	push   %esi
+  805233:	89 e8                	mov    %ebp,%eax
+  805235:	e8 92 fe ff ff       	call   8050cc <udivmod>
+  80523a:	83 c4 10             	add    $0x10,%esp
+  80523d:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  805242:	78 08                	js     80524c <__divdi3+0x6a>
+  805244:	83 c4 0c             	add    $0xc,%esp
+  805247:	5b                   	pop    %ebx
+  805248:	5e                   	pop    %esi
+  805249:	5f                   	pop    %edi
+  80524a:	5d                   	pop    %ebp
+  80524b:	c3                   	ret
+  80524c:	f7 d8                	neg    %eax
+  80524e:	83 d2 00             	adc    $0x0,%edx
+  805251:	f7 da                	neg    %edx
+  805253:	eb ef                	jmp    805244 <__divdi3+0x62>
+
+00805255 <__moddi3>:
+  805255:	55                   	push   %ebp
+  805256:	57                   	push   %edi
+  805257:	56                   	push   %esi
+  805258:	53                   	push   %ebx
+  805259:	83 ec 18             	sub    $0x18,%esp
+  80525c:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  805260:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  805264:	89 f1                	mov    %esi,%ecx
+  805266:	f7 d9                	neg    %ecx
+  805268:	89 da                	mov    %ebx,%edx
+  80526a:	83 d2 00             	adc    $0x0,%edx
+  80526d:	f7 da                	neg    %edx
+  80526f:	0f 48 ce             	cmovs  %esi,%ecx
+  805272:	0f 48 d3             	cmovs  %ebx,%edx
+  805275:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805279:	50                   	push   %eax
+  80527a:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80527e:	f7 de                	neg    %esi
+  805280:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  805284:	83 d0 00             	adc    $0x0,%eax
+  805287:	f7 d8                	neg    %eax
+  805289:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80528e:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  805293:	50                   	push   %eax
+  805294:	56                   	push   %esi
+  805295:	89 c8                	mov    %ecx,%eax
+  805297:	e8 30 fe ff ff       	call   8050cc <udivmod>
+  80529c:	83 c4 10             	add    $0x10,%esp
+  80529f:	85 db                	test   %ebx,%ebx
+  8052a1:	78 10                	js     8052b3 <__moddi3+0x5e>
+  8052a3:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8052a7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8052ab:	83 c4 14             	add    $0x14,%esp
+  8052ae:	5b                   	pop    %ebx
+  8052af:	5e                   	pop    %esi
+  8052b0:	5f                   	pop    %edi
+  8052b1:	5d                   	pop    %ebp
+  8052b2:	c3                   	ret
+  8052b3:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8052b7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8052bb:	f7 d8                	neg    %eax
+  8052bd:	83 d2 00             	adc    $0x0,%edx
+  8052c0:	f7 da                	neg    %edx
+  8052c2:	eb e7                	jmp    8052ab <__moddi3+0x56>
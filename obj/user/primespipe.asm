@@ -0,0 +1,10664 @@
+
+obj/user/primespipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 06 02 00 00       	call   800237 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(int fd)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int i, id, p, pfd[2], wfd, r;
+
+	// fetch a prime from our left neighbor
+top:
+	if ((r = readn(fd, &p, 4)) != 4)
+  80003f:	8d 75 e0             	lea    -0x20(%ebp),%esi
+		panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
+
+	cprintf("%d\n", p);
+
+	// fork a right neighbor to continue the chain
+	if ((i=pipe(pfd)) < 0)
+  800042:	8d 7d d8             	lea    -0x28(%ebp),%edi
+	if ((r = readn(fd, &p, 4)) != 4)
+  800045:	83 ec 04             	sub    $0x4,%esp
+  800048:	6a 04                	push   $0x4
+  80004a:	56                   	push   %esi
+  80004b:	53                   	push   %ebx
+  80004c:	e8 ae 1c 00 00       	call   801cff <readn>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	83 f8 04             	cmp    $0x4,%eax
+  800057:	75 49                	jne    8000a2 <primeproc+0x6f>
+	cprintf("%d\n", p);
+  800059:	83 ec 08             	sub    $0x8,%esp
+  80005c:	ff 75 e0             	push   -0x20(%ebp)
+  80005f:	68 98 5a 80 00       	push   $0x805a98
+  800064:	e8 0c 03 00 00       	call   800375 <cprintf>
+	if ((i=pipe(pfd)) < 0)
+  800069:	89 3c 24             	mov    %edi,(%esp)
+  80006c:	e8 1c 26 00 00       	call   80268d <pipe>
+  800071:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	85 c0                	test   %eax,%eax
+  800079:	78 47                	js     8000c2 <primeproc+0x8f>
+		panic("pipe: %e", i);
+	if ((id = fork()) < 0)
+  80007b:	e8 b6 14 00 00       	call   801536 <fork>
+  800080:	85 c0                	test   %eax,%eax
+  800082:	78 50                	js     8000d4 <primeproc+0xa1>
+		panic("fork: %e", id);
+	if (id == 0) {
+  800084:	75 60                	jne    8000e6 <primeproc+0xb3>
+		close(fd);
+  800086:	83 ec 0c             	sub    $0xc,%esp
+  800089:	53                   	push   %ebx
+  80008a:	e8 ad 1a 00 00       	call   801b3c <close>
+		close(pfd[1]);
+  80008f:	83 c4 04             	add    $0x4,%esp
+  800092:	ff 75 dc             	push   -0x24(%ebp)
+  800095:	e8 a2 1a 00 00       	call   801b3c <close>
+		fd = pfd[0];
+  80009a:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+		goto top;
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	eb a3                	jmp    800045 <primeproc+0x12>
+		panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
+  8000a2:	83 ec 0c             	sub    $0xc,%esp
+  8000a5:	85 c0                	test   %eax,%eax
+  8000a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ac:	0f 4e d0             	cmovle %eax,%edx
+  8000af:	52                   	push   %edx
+  8000b0:	50                   	push   %eax
+  8000b1:	68 20 54 80 00       	push   $0x805420
+  8000b6:	6a 15                	push   $0x15
+  8000b8:	68 4f 54 80 00       	push   $0x80544f
+  8000bd:	e8 d8 01 00 00       	call   80029a <_panic>
+		panic("pipe: %e", i);
+  8000c2:	50                   	push   %eax
+  8000c3:	68 61 54 80 00       	push   $0x805461
+  8000c8:	6a 1b                	push   $0x1b
+  8000ca:	68 4f 54 80 00       	push   $0x80544f
+  8000cf:	e8 c6 01 00 00       	call   80029a <_panic>
+		panic("fork: %e", id);
+  8000d4:	50                   	push   %eax
+  8000d5:	68 6a 54 80 00       	push   $0x80546a
+  8000da:	6a 1d                	push   $0x1d
+  8000dc:	68 4f 54 80 00       	push   $0x80544f
+  8000e1:	e8 b4 01 00 00       	call   80029a <_panic>
+	}
+
+	close(pfd[0]);
+  8000e6:	83 ec 0c             	sub    $0xc,%esp
+  8000e9:	ff 75 d8             	push   -0x28(%ebp)
+  8000ec:	e8 4b 1a 00 00       	call   801b3c <close>
+	wfd = pfd[1];
+  8000f1:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8000f4:	83 c4 10             	add    $0x10,%esp
+
+	// filter out multiples of our prime
+	for (;;) {
+		if ((r=readn(fd, &i, 4)) != 4)
+  8000f7:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8000fa:	83 ec 04             	sub    $0x4,%esp
+  8000fd:	6a 04                	push   $0x4
+  8000ff:	56                   	push   %esi
+  800100:	53                   	push   %ebx
+  800101:	e8 f9 1b 00 00       	call   801cff <readn>
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	83 f8 04             	cmp    $0x4,%eax
+  80010c:	75 45                	jne    800153 <primeproc+0x120>
+			panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+		if (i%p)
+  80010e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800111:	99                   	cltd
+  800112:	f7 7d e0             	idivl  -0x20(%ebp)
+  800115:	85 d2                	test   %edx,%edx
+  800117:	74 e1                	je     8000fa <primeproc+0xc7>
+			if ((r=write(wfd, &i, 4)) != 4)
+  800119:	83 ec 04             	sub    $0x4,%esp
+  80011c:	6a 04                	push   $0x4
+  80011e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800121:	50                   	push   %eax
+  800122:	57                   	push   %edi
+  800123:	e8 1e 1c 00 00       	call   801d46 <write>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	83 f8 04             	cmp    $0x4,%eax
+  80012e:	74 ca                	je     8000fa <primeproc+0xc7>
+				panic("primeproc %d write: %d %e", p, r, r >= 0 ? 0 : r);
+  800130:	83 ec 08             	sub    $0x8,%esp
+  800133:	85 c0                	test   %eax,%eax
+  800135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013a:	0f 4e d0             	cmovle %eax,%edx
+  80013d:	52                   	push   %edx
+  80013e:	50                   	push   %eax
+  80013f:	ff 75 e0             	push   -0x20(%ebp)
+  800142:	68 8f 54 80 00       	push   $0x80548f
+  800147:	6a 2e                	push   $0x2e
+  800149:	68 4f 54 80 00       	push   $0x80544f
+  80014e:	e8 47 01 00 00       	call   80029a <_panic>
+			panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+  800153:	83 ec 04             	sub    $0x4,%esp
+  800156:	85 c0                	test   %eax,%eax
+  800158:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015d:	0f 4e d0             	cmovle %eax,%edx
+  800160:	52                   	push   %edx
+  800161:	50                   	push   %eax
+  800162:	53                   	push   %ebx
+  800163:	ff 75 e0             	push   -0x20(%ebp)
+  800166:	68 73 54 80 00       	push   $0x805473
+  80016b:	6a 2b                	push   $0x2b
+  80016d:	68 4f 54 80 00       	push   $0x80544f
+  800172:	e8 23 01 00 00       	call   80029a <_panic>
+
+00800177 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800177:	55                   	push   %ebp
+  800178:	89 e5                	mov    %esp,%ebp
+  80017a:	53                   	push   %ebx
+  80017b:	83 ec 20             	sub    $0x20,%esp
+	int i, id, p[2], r;
+
+	binaryname = "primespipe";
+  80017e:	c7 05 00 70 80 00 a9 	movl   $0x8054a9,0x807000
+  800185:	54 80 00 
+
+	if ((i=pipe(p)) < 0)
+  800188:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80018b:	50                   	push   %eax
+  80018c:	e8 fc 24 00 00       	call   80268d <pipe>
+  800191:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800194:	83 c4 10             	add    $0x10,%esp
+  800197:	85 c0                	test   %eax,%eax
+  800199:	78 21                	js     8001bc <umain+0x45>
+		panic("pipe: %e", i);
+
+	// fork the first prime process in the chain
+	if ((id=fork()) < 0)
+  80019b:	e8 96 13 00 00       	call   801536 <fork>
+  8001a0:	85 c0                	test   %eax,%eax
+  8001a2:	78 2a                	js     8001ce <umain+0x57>
+		panic("fork: %e", id);
+
+	if (id == 0) {
+  8001a4:	75 3a                	jne    8001e0 <umain+0x69>
+		close(p[1]);
+  8001a6:	83 ec 0c             	sub    $0xc,%esp
+  8001a9:	ff 75 f0             	push   -0x10(%ebp)
+  8001ac:	e8 8b 19 00 00       	call   801b3c <close>
+		primeproc(p[0]);
+  8001b1:	83 c4 04             	add    $0x4,%esp
+  8001b4:	ff 75 ec             	push   -0x14(%ebp)
+  8001b7:	e8 77 fe ff ff       	call   800033 <primeproc>
+		panic("pipe: %e", i);
+  8001bc:	50                   	push   %eax
+  8001bd:	68 61 54 80 00       	push   $0x805461
+  8001c2:	6a 3a                	push   $0x3a
+  8001c4:	68 4f 54 80 00       	push   $0x80544f
+  8001c9:	e8 cc 00 00 00       	call   80029a <_panic>
+		panic("fork: %e", id);
+  8001ce:	50                   	push   %eax
+  8001cf:	68 6a 54 80 00       	push   $0x80546a
+  8001d4:	6a 3e                	push   $0x3e
+  8001d6:	68 4f 54 80 00       	push   $0x80544f
+  8001db:	e8 ba 00 00 00       	call   80029a <_panic>
+	}
+
+	close(p[0]);
+  8001e0:	83 ec 0c             	sub    $0xc,%esp
+  8001e3:	ff 75 ec             	push   -0x14(%ebp)
+  8001e6:	e8 51 19 00 00       	call   801b3c <close>
+  8001eb:	83 c4 10             	add    $0x10,%esp
+  8001ee:	b8 02 00 00 00       	mov    $0x2,%eax
+
+	// feed all the integers through
+	for (i=2;; i++)
+		if ((r=write(p[1], &i, 4)) != 4)
+  8001f3:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  8001f6:	eb 06                	jmp    8001fe <umain+0x87>
+	for (i=2;; i++)
+  8001f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8001fb:	83 c0 01             	add    $0x1,%eax
+  8001fe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+		if ((r=write(p[1], &i, 4)) != 4)
+  800201:	83 ec 04             	sub    $0x4,%esp
+  800204:	6a 04                	push   $0x4
+  800206:	53                   	push   %ebx
+  800207:	ff 75 f0             	push   -0x10(%ebp)
+  80020a:	e8 37 1b 00 00       	call   801d46 <write>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	83 f8 04             	cmp    $0x4,%eax
+  800215:	74 e1                	je     8001f8 <umain+0x81>
+			panic("generator write: %d, %e", r, r >= 0 ? 0 : r);
+  800217:	83 ec 0c             	sub    $0xc,%esp
+  80021a:	85 c0                	test   %eax,%eax
+  80021c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800221:	0f 4e d0             	cmovle %eax,%edx
+  800224:	52                   	push   %edx
+  800225:	50                   	push   %eax
+  800226:	68 b4 54 80 00       	push   $0x8054b4
+  80022b:	6a 4a                	push   $0x4a
+  80022d:	68 4f 54 80 00       	push   $0x80544f
+  800232:	e8 63 00 00 00       	call   80029a <_panic>
+
+00800237 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	56                   	push   %esi
+  80023b:	53                   	push   %ebx
+  80023c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80023f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800242:	e8 ca 0b 00 00       	call   800e11 <sys_getenvid>
+  800247:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80024c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80024f:	c1 e0 06             	shl    $0x6,%eax
+  800252:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800257:	a3 18 f9 80 00       	mov    %eax,0x80f918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80025c:	85 db                	test   %ebx,%ebx
+  80025e:	7e 07                	jle    800267 <libmain+0x30>
+		binaryname = argv[0];
+  800260:	8b 06                	mov    (%esi),%eax
+  800262:	a3 00 70 80 00       	mov    %eax,0x807000
+
+	// call user main routine
+	umain(argc, argv);
+  800267:	83 ec 08             	sub    $0x8,%esp
+  80026a:	56                   	push   %esi
+  80026b:	53                   	push   %ebx
+  80026c:	e8 06 ff ff ff       	call   800177 <umain>
+
+	// exit gracefully
+	exit();
+  800271:	e8 0a 00 00 00       	call   800280 <exit>
+}
+  800276:	83 c4 10             	add    $0x10,%esp
+  800279:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80027c:	5b                   	pop    %ebx
+  80027d:	5e                   	pop    %esi
+  80027e:	5d                   	pop    %ebp
+  80027f:	c3                   	ret
+
+00800280 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800280:	55                   	push   %ebp
+  800281:	89 e5                	mov    %esp,%ebp
+  800283:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800286:	e8 de 18 00 00       	call   801b69 <close_all>
+	sys_env_destroy(0);
+  80028b:	83 ec 0c             	sub    $0xc,%esp
+  80028e:	6a 00                	push   $0x0
+  800290:	e8 3b 0b 00 00       	call   800dd0 <sys_env_destroy>
+}
+  800295:	83 c4 10             	add    $0x10,%esp
+  800298:	c9                   	leave
+  800299:	c3                   	ret
+
+0080029a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80029a:	55                   	push   %ebp
+  80029b:	89 e5                	mov    %esp,%ebp
+  80029d:	56                   	push   %esi
+  80029e:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80029f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002a2:	8b 35 00 70 80 00    	mov    0x807000,%esi
+  8002a8:	e8 64 0b 00 00       	call   800e11 <sys_getenvid>
+  8002ad:	83 ec 0c             	sub    $0xc,%esp
+  8002b0:	ff 75 0c             	push   0xc(%ebp)
+  8002b3:	ff 75 08             	push   0x8(%ebp)
+  8002b6:	56                   	push   %esi
+  8002b7:	50                   	push   %eax
+  8002b8:	68 d8 54 80 00       	push   $0x8054d8
+  8002bd:	e8 b3 00 00 00       	call   800375 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002c2:	83 c4 18             	add    $0x18,%esp
+  8002c5:	53                   	push   %ebx
+  8002c6:	ff 75 10             	push   0x10(%ebp)
+  8002c9:	e8 56 00 00 00       	call   800324 <vcprintf>
+	cprintf("\n");
+  8002ce:	c7 04 24 7c 5a 80 00 	movl   $0x805a7c,(%esp)
+  8002d5:	e8 9b 00 00 00       	call   800375 <cprintf>
+  8002da:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002dd:	cc                   	int3
+	while (1)
+  8002de:	eb fd                	jmp    8002dd <_panic+0x43>
+
+008002e0 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002e0:	55                   	push   %ebp
+  8002e1:	89 e5                	mov    %esp,%ebp
+  8002e3:	53                   	push   %ebx
+  8002e4:	83 ec 04             	sub    $0x4,%esp
+  8002e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002ea:	8b 13                	mov    (%ebx),%edx
+  8002ec:	8d 42 01             	lea    0x1(%edx),%eax
+  8002ef:	89 03                	mov    %eax,(%ebx)
+  8002f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002f4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002f8:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002fd:	74 09                	je     800308 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002ff:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800303:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800306:	c9                   	leave
+  800307:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800308:	83 ec 08             	sub    $0x8,%esp
+  80030b:	68 ff 00 00 00       	push   $0xff
+  800310:	8d 43 08             	lea    0x8(%ebx),%eax
+  800313:	50                   	push   %eax
+  800314:	e8 69 0a 00 00       	call   800d82 <sys_cputs>
+		b->idx = 0;
+  800319:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80031f:	83 c4 10             	add    $0x10,%esp
+  800322:	eb db                	jmp    8002ff <putch+0x1f>
+
+00800324 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800324:	55                   	push   %ebp
+  800325:	89 e5                	mov    %esp,%ebp
+  800327:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80032d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800334:	00 00 00 
+	b.cnt = 0;
+  800337:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80033e:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800341:	ff 75 0c             	push   0xc(%ebp)
+  800344:	ff 75 08             	push   0x8(%ebp)
+  800347:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80034d:	50                   	push   %eax
+  80034e:	68 e0 02 80 00       	push   $0x8002e0
+  800353:	e8 14 01 00 00       	call   80046c <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800358:	83 c4 08             	add    $0x8,%esp
+  80035b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800361:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800367:	50                   	push   %eax
+  800368:	e8 15 0a 00 00       	call   800d82 <sys_cputs>
+
+	return b.cnt;
+}
+  80036d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800373:	c9                   	leave
+  800374:	c3                   	ret
+
+00800375 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800375:	55                   	push   %ebp
+  800376:	89 e5                	mov    %esp,%ebp
+  800378:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80037b:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80037e:	50                   	push   %eax
+  80037f:	ff 75 08             	push   0x8(%ebp)
+  800382:	e8 9d ff ff ff       	call   800324 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800387:	c9                   	leave
+  800388:	c3                   	ret
+
+00800389 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800389:	55                   	push   %ebp
+  80038a:	89 e5                	mov    %esp,%ebp
+  80038c:	57                   	push   %edi
+  80038d:	56                   	push   %esi
+  80038e:	53                   	push   %ebx
+  80038f:	83 ec 1c             	sub    $0x1c,%esp
+  800392:	89 c7                	mov    %eax,%edi
+  800394:	89 d6                	mov    %edx,%esi
+  800396:	8b 45 08             	mov    0x8(%ebp),%eax
+  800399:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80039c:	89 d1                	mov    %edx,%ecx
+  80039e:	89 c2                	mov    %eax,%edx
+  8003a0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003a3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003a6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003a9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003af:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003b6:	39 c2                	cmp    %eax,%edx
+  8003b8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003bb:	72 3e                	jb     8003fb <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003bd:	83 ec 0c             	sub    $0xc,%esp
+  8003c0:	ff 75 18             	push   0x18(%ebp)
+  8003c3:	83 eb 01             	sub    $0x1,%ebx
+  8003c6:	53                   	push   %ebx
+  8003c7:	50                   	push   %eax
+  8003c8:	83 ec 08             	sub    $0x8,%esp
+  8003cb:	ff 75 e4             	push   -0x1c(%ebp)
+  8003ce:	ff 75 e0             	push   -0x20(%ebp)
+  8003d1:	ff 75 dc             	push   -0x24(%ebp)
+  8003d4:	ff 75 d8             	push   -0x28(%ebp)
+  8003d7:	e8 02 4f 00 00       	call   8052de <__udivdi3>
+  8003dc:	83 c4 18             	add    $0x18,%esp
+  8003df:	52                   	push   %edx
+  8003e0:	50                   	push   %eax
+  8003e1:	89 f2                	mov    %esi,%edx
+  8003e3:	89 f8                	mov    %edi,%eax
+  8003e5:	e8 9f ff ff ff       	call   800389 <printnum>
+  8003ea:	83 c4 20             	add    $0x20,%esp
+  8003ed:	eb 13                	jmp    800402 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003ef:	83 ec 08             	sub    $0x8,%esp
+  8003f2:	56                   	push   %esi
+  8003f3:	ff 75 18             	push   0x18(%ebp)
+  8003f6:	ff d7                	call   *%edi
+  8003f8:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003fb:	83 eb 01             	sub    $0x1,%ebx
+  8003fe:	85 db                	test   %ebx,%ebx
+  800400:	7f ed                	jg     8003ef <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800402:	83 ec 08             	sub    $0x8,%esp
+  800405:	56                   	push   %esi
+  800406:	83 ec 04             	sub    $0x4,%esp
+  800409:	ff 75 e4             	push   -0x1c(%ebp)
+  80040c:	ff 75 e0             	push   -0x20(%ebp)
+  80040f:	ff 75 dc             	push   -0x24(%ebp)
+  800412:	ff 75 d8             	push   -0x28(%ebp)
+  800415:	e8 e2 4e 00 00       	call   8052fc <__umoddi3>
+  80041a:	83 c4 14             	add    $0x14,%esp
+  80041d:	0f be 80 fb 54 80 00 	movsbl 0x8054fb(%eax),%eax
+  800424:	50                   	push   %eax
+  800425:	ff d7                	call   *%edi
+}
+  800427:	83 c4 10             	add    $0x10,%esp
+  80042a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80042d:	5b                   	pop    %ebx
+  80042e:	5e                   	pop    %esi
+  80042f:	5f                   	pop    %edi
+  800430:	5d                   	pop    %ebp
+  800431:	c3                   	ret
+
+00800432 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800432:	55                   	push   %ebp
+  800433:	89 e5                	mov    %esp,%ebp
+  800435:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800438:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80043c:	8b 10                	mov    (%eax),%edx
+  80043e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800441:	73 0a                	jae    80044d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800443:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800446:	89 08                	mov    %ecx,(%eax)
+  800448:	8b 45 08             	mov    0x8(%ebp),%eax
+  80044b:	88 02                	mov    %al,(%edx)
+}
+  80044d:	5d                   	pop    %ebp
+  80044e:	c3                   	ret
+
+0080044f <printfmt>:
+{
+  80044f:	55                   	push   %ebp
+  800450:	89 e5                	mov    %esp,%ebp
+  800452:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800455:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800458:	50                   	push   %eax
+  800459:	ff 75 10             	push   0x10(%ebp)
+  80045c:	ff 75 0c             	push   0xc(%ebp)
+  80045f:	ff 75 08             	push   0x8(%ebp)
+  800462:	e8 05 00 00 00       	call   80046c <vprintfmt>
+}
+  800467:	83 c4 10             	add    $0x10,%esp
+  80046a:	c9                   	leave
+  80046b:	c3                   	ret
+
+0080046c <vprintfmt>:
+{
+  80046c:	55                   	push   %ebp
+  80046d:	89 e5                	mov    %esp,%ebp
+  80046f:	57                   	push   %edi
+  800470:	56                   	push   %esi
+  800471:	53                   	push   %ebx
+  800472:	83 ec 2c             	sub    $0x2c,%esp
+  800475:	8b 75 08             	mov    0x8(%ebp),%esi
+  800478:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80047b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80047e:	eb 0a                	jmp    80048a <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800480:	83 ec 08             	sub    $0x8,%esp
+  800483:	53                   	push   %ebx
+  800484:	50                   	push   %eax
+  800485:	ff d6                	call   *%esi
+  800487:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80048a:	83 c7 01             	add    $0x1,%edi
+  80048d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800491:	83 f8 25             	cmp    $0x25,%eax
+  800494:	74 0c                	je     8004a2 <vprintfmt+0x36>
+			if (ch == '\0')
+  800496:	85 c0                	test   %eax,%eax
+  800498:	75 e6                	jne    800480 <vprintfmt+0x14>
+}
+  80049a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80049d:	5b                   	pop    %ebx
+  80049e:	5e                   	pop    %esi
+  80049f:	5f                   	pop    %edi
+  8004a0:	5d                   	pop    %ebp
+  8004a1:	c3                   	ret
+		padc = ' ';
+  8004a2:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8004a6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004ad:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004b4:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004c0:	8d 47 01             	lea    0x1(%edi),%eax
+  8004c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004c6:	0f b6 17             	movzbl (%edi),%edx
+  8004c9:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004cc:	3c 55                	cmp    $0x55,%al
+  8004ce:	0f 87 c5 03 00 00    	ja     800899 <vprintfmt+0x42d>
+  8004d4:	0f b6 c0             	movzbl %al,%eax
+  8004d7:	ff 24 85 80 56 80 00 	jmp    *0x805680(,%eax,4)
+  8004de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8004e1:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8004e5:	eb d9                	jmp    8004c0 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004ea:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004ee:	eb d0                	jmp    8004c0 <vprintfmt+0x54>
+  8004f0:	0f b6 d2             	movzbl %dl,%edx
+  8004f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004fe:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800501:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800505:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800508:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80050b:	83 f9 09             	cmp    $0x9,%ecx
+  80050e:	77 55                	ja     800565 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800510:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800513:	eb e9                	jmp    8004fe <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800515:	8b 45 14             	mov    0x14(%ebp),%eax
+  800518:	8b 00                	mov    (%eax),%eax
+  80051a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80051d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800520:	8d 40 04             	lea    0x4(%eax),%eax
+  800523:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800526:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800529:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80052d:	79 91                	jns    8004c0 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80052f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800532:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800535:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80053c:	eb 82                	jmp    8004c0 <vprintfmt+0x54>
+			if (width < 0)
+  80053e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800541:	85 d2                	test   %edx,%edx
+  800543:	b8 00 00 00 00       	mov    $0x0,%eax
+  800548:	0f 49 c2             	cmovns %edx,%eax
+  80054b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80054e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800551:	e9 6a ff ff ff       	jmp    8004c0 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800556:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800559:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800560:	e9 5b ff ff ff       	jmp    8004c0 <vprintfmt+0x54>
+  800565:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800568:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80056b:	eb bc                	jmp    800529 <vprintfmt+0xbd>
+			lflag++;
+  80056d:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800570:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800573:	e9 48 ff ff ff       	jmp    8004c0 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800578:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057b:	8d 78 04             	lea    0x4(%eax),%edi
+  80057e:	83 ec 08             	sub    $0x8,%esp
+  800581:	53                   	push   %ebx
+  800582:	ff 30                	push   (%eax)
+  800584:	ff d6                	call   *%esi
+			break;
+  800586:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800589:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80058c:	e9 63 02 00 00       	jmp    8007f4 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800591:	8b 45 14             	mov    0x14(%ebp),%eax
+  800594:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800597:	8b 10                	mov    (%eax),%edx
+  800599:	89 d0                	mov    %edx,%eax
+  80059b:	f7 d8                	neg    %eax
+  80059d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005a0:	83 f8 12             	cmp    $0x12,%eax
+  8005a3:	7f 23                	jg     8005c8 <vprintfmt+0x15c>
+  8005a5:	8b 14 85 e0 57 80 00 	mov    0x8057e0(,%eax,4),%edx
+  8005ac:	85 d2                	test   %edx,%edx
+  8005ae:	74 18                	je     8005c8 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8005b0:	52                   	push   %edx
+  8005b1:	68 0d 5a 80 00       	push   $0x805a0d
+  8005b6:	53                   	push   %ebx
+  8005b7:	56                   	push   %esi
+  8005b8:	e8 92 fe ff ff       	call   80044f <printfmt>
+  8005bd:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005c0:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005c3:	e9 2c 02 00 00       	jmp    8007f4 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  8005c8:	50                   	push   %eax
+  8005c9:	68 13 55 80 00       	push   $0x805513
+  8005ce:	53                   	push   %ebx
+  8005cf:	56                   	push   %esi
+  8005d0:	e8 7a fe ff ff       	call   80044f <printfmt>
+  8005d5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005d8:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005db:	e9 14 02 00 00       	jmp    8007f4 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e3:	83 c0 04             	add    $0x4,%eax
+  8005e6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ec:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005ee:	85 c9                	test   %ecx,%ecx
+  8005f0:	b8 0c 55 80 00       	mov    $0x80550c,%eax
+  8005f5:	0f 45 c1             	cmovne %ecx,%eax
+  8005f8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005fb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005ff:	7e 06                	jle    800607 <vprintfmt+0x19b>
+  800601:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800605:	75 0b                	jne    800612 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800607:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80060a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80060d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800610:	eb 5c                	jmp    80066e <vprintfmt+0x202>
+  800612:	83 ec 08             	sub    $0x8,%esp
+  800615:	ff 75 d0             	push   -0x30(%ebp)
+  800618:	ff 75 cc             	push   -0x34(%ebp)
+  80061b:	e8 19 03 00 00       	call   800939 <strnlen>
+  800620:	89 c2                	mov    %eax,%edx
+  800622:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800625:	29 d0                	sub    %edx,%eax
+  800627:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80062a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80062e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800631:	89 75 08             	mov    %esi,0x8(%ebp)
+  800634:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800636:	eb 0e                	jmp    800646 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800638:	83 ec 08             	sub    $0x8,%esp
+  80063b:	53                   	push   %ebx
+  80063c:	57                   	push   %edi
+  80063d:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800640:	83 ee 01             	sub    $0x1,%esi
+  800643:	83 c4 10             	add    $0x10,%esp
+  800646:	85 f6                	test   %esi,%esi
+  800648:	7f ee                	jg     800638 <vprintfmt+0x1cc>
+  80064a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80064d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800650:	85 c0                	test   %eax,%eax
+  800652:	ba 00 00 00 00       	mov    $0x0,%edx
+  800657:	0f 49 d0             	cmovns %eax,%edx
+  80065a:	29 d0                	sub    %edx,%eax
+  80065c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80065f:	eb a6                	jmp    800607 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800661:	83 ec 08             	sub    $0x8,%esp
+  800664:	53                   	push   %ebx
+  800665:	52                   	push   %edx
+  800666:	ff 55 08             	call   *0x8(%ebp)
+  800669:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80066c:	89 f1                	mov    %esi,%ecx
+  80066e:	8d 71 01             	lea    0x1(%ecx),%esi
+  800671:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800675:	0f be d0             	movsbl %al,%edx
+  800678:	85 d2                	test   %edx,%edx
+  80067a:	74 28                	je     8006a4 <vprintfmt+0x238>
+  80067c:	85 ff                	test   %edi,%edi
+  80067e:	78 05                	js     800685 <vprintfmt+0x219>
+  800680:	83 ef 01             	sub    $0x1,%edi
+  800683:	78 30                	js     8006b5 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800685:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800689:	74 d6                	je     800661 <vprintfmt+0x1f5>
+  80068b:	0f be c0             	movsbl %al,%eax
+  80068e:	83 e8 20             	sub    $0x20,%eax
+  800691:	83 f8 5e             	cmp    $0x5e,%eax
+  800694:	76 cb                	jbe    800661 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800696:	83 ec 08             	sub    $0x8,%esp
+  800699:	53                   	push   %ebx
+  80069a:	6a 3f                	push   $0x3f
+  80069c:	ff 55 08             	call   *0x8(%ebp)
+  80069f:	83 c4 10             	add    $0x10,%esp
+  8006a2:	eb c8                	jmp    80066c <vprintfmt+0x200>
+  8006a4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006a7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006aa:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006ad:	01 d0                	add    %edx,%eax
+  8006af:	29 c8                	sub    %ecx,%eax
+  8006b1:	89 c7                	mov    %eax,%edi
+  8006b3:	eb 13                	jmp    8006c8 <vprintfmt+0x25c>
+  8006b5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006b8:	eb ed                	jmp    8006a7 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8006ba:	83 ec 08             	sub    $0x8,%esp
+  8006bd:	53                   	push   %ebx
+  8006be:	6a 20                	push   $0x20
+  8006c0:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8006c2:	83 ef 01             	sub    $0x1,%edi
+  8006c5:	83 c4 10             	add    $0x10,%esp
+  8006c8:	85 ff                	test   %edi,%edi
+  8006ca:	7f ee                	jg     8006ba <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006cc:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d2:	e9 1d 01 00 00       	jmp    8007f4 <vprintfmt+0x388>
+	if (lflag >= 2)
+  8006d7:	83 f9 01             	cmp    $0x1,%ecx
+  8006da:	7f 1b                	jg     8006f7 <vprintfmt+0x28b>
+	else if (lflag)
+  8006dc:	85 c9                	test   %ecx,%ecx
+  8006de:	74 63                	je     800743 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  8006e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e3:	8b 00                	mov    (%eax),%eax
+  8006e5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e8:	99                   	cltd
+  8006e9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f5:	eb 17                	jmp    80070e <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  8006f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fa:	8b 50 04             	mov    0x4(%eax),%edx
+  8006fd:	8b 00                	mov    (%eax),%eax
+  8006ff:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800702:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800705:	8b 45 14             	mov    0x14(%ebp),%eax
+  800708:	8d 40 08             	lea    0x8(%eax),%eax
+  80070b:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80070e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800711:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800714:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800719:	85 c9                	test   %ecx,%ecx
+  80071b:	0f 89 b9 00 00 00    	jns    8007da <vprintfmt+0x36e>
+				putch('-', putdat);
+  800721:	83 ec 08             	sub    $0x8,%esp
+  800724:	53                   	push   %ebx
+  800725:	6a 2d                	push   $0x2d
+  800727:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800729:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80072c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80072f:	f7 da                	neg    %edx
+  800731:	83 d1 00             	adc    $0x0,%ecx
+  800734:	f7 d9                	neg    %ecx
+  800736:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800739:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80073e:	e9 97 00 00 00       	jmp    8007da <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800743:	8b 45 14             	mov    0x14(%ebp),%eax
+  800746:	8b 00                	mov    (%eax),%eax
+  800748:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80074b:	99                   	cltd
+  80074c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80074f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800752:	8d 40 04             	lea    0x4(%eax),%eax
+  800755:	89 45 14             	mov    %eax,0x14(%ebp)
+  800758:	eb b4                	jmp    80070e <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  80075a:	83 f9 01             	cmp    $0x1,%ecx
+  80075d:	7f 1b                	jg     80077a <vprintfmt+0x30e>
+	else if (lflag)
+  80075f:	85 c9                	test   %ecx,%ecx
+  800761:	74 2c                	je     80078f <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800763:	8b 45 14             	mov    0x14(%ebp),%eax
+  800766:	8b 10                	mov    (%eax),%edx
+  800768:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076d:	8d 40 04             	lea    0x4(%eax),%eax
+  800770:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800773:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800778:	eb 60                	jmp    8007da <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80077a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077d:	8b 10                	mov    (%eax),%edx
+  80077f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800782:	8d 40 08             	lea    0x8(%eax),%eax
+  800785:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800788:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80078d:	eb 4b                	jmp    8007da <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80078f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800792:	8b 10                	mov    (%eax),%edx
+  800794:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800799:	8d 40 04             	lea    0x4(%eax),%eax
+  80079c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80079f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8007a4:	eb 34                	jmp    8007da <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8007a6:	83 f9 01             	cmp    $0x1,%ecx
+  8007a9:	7f 15                	jg     8007c0 <vprintfmt+0x354>
+	else if (lflag)
+  8007ab:	85 c9                	test   %ecx,%ecx
+  8007ad:	74 4d                	je     8007fc <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8007af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b2:	8b 00                	mov    (%eax),%eax
+  8007b4:	99                   	cltd
+  8007b5:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8007b8:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8007bb:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8007be:	eb 11                	jmp    8007d1 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  8007c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c3:	8b 50 04             	mov    0x4(%eax),%edx
+  8007c6:	8b 00                	mov    (%eax),%eax
+  8007c8:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8007cb:	8d 49 08             	lea    0x8(%ecx),%ecx
+  8007ce:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  8007d1:	89 d1                	mov    %edx,%ecx
+  8007d3:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  8007d5:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007da:	83 ec 0c             	sub    $0xc,%esp
+  8007dd:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007e1:	50                   	push   %eax
+  8007e2:	ff 75 e0             	push   -0x20(%ebp)
+  8007e5:	57                   	push   %edi
+  8007e6:	51                   	push   %ecx
+  8007e7:	52                   	push   %edx
+  8007e8:	89 da                	mov    %ebx,%edx
+  8007ea:	89 f0                	mov    %esi,%eax
+  8007ec:	e8 98 fb ff ff       	call   800389 <printnum>
+			break;
+  8007f1:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007f4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007f7:	e9 8e fc ff ff       	jmp    80048a <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  8007fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ff:	8b 00                	mov    (%eax),%eax
+  800801:	99                   	cltd
+  800802:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800805:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800808:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80080b:	eb c4                	jmp    8007d1 <vprintfmt+0x365>
+			putch('0', putdat);
+  80080d:	83 ec 08             	sub    $0x8,%esp
+  800810:	53                   	push   %ebx
+  800811:	6a 30                	push   $0x30
+  800813:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800815:	83 c4 08             	add    $0x8,%esp
+  800818:	53                   	push   %ebx
+  800819:	6a 78                	push   $0x78
+  80081b:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80081d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800820:	8b 10                	mov    (%eax),%edx
+  800822:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800827:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80082a:	8d 40 04             	lea    0x4(%eax),%eax
+  80082d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800830:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800835:	eb a3                	jmp    8007da <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800837:	83 f9 01             	cmp    $0x1,%ecx
+  80083a:	7f 1b                	jg     800857 <vprintfmt+0x3eb>
+	else if (lflag)
+  80083c:	85 c9                	test   %ecx,%ecx
+  80083e:	74 2f                	je     80086f <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800840:	8b 45 14             	mov    0x14(%ebp),%eax
+  800843:	8b 10                	mov    (%eax),%edx
+  800845:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80084a:	8d 40 04             	lea    0x4(%eax),%eax
+  80084d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800850:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800855:	eb 83                	jmp    8007da <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800857:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085a:	8b 10                	mov    (%eax),%edx
+  80085c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80085f:	8d 40 08             	lea    0x8(%eax),%eax
+  800862:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800865:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80086a:	e9 6b ff ff ff       	jmp    8007da <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80086f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800872:	8b 10                	mov    (%eax),%edx
+  800874:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800879:	8d 40 04             	lea    0x4(%eax),%eax
+  80087c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80087f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800884:	e9 51 ff ff ff       	jmp    8007da <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800889:	83 ec 08             	sub    $0x8,%esp
+  80088c:	53                   	push   %ebx
+  80088d:	6a 25                	push   $0x25
+  80088f:	ff d6                	call   *%esi
+			break;
+  800891:	83 c4 10             	add    $0x10,%esp
+  800894:	e9 5b ff ff ff       	jmp    8007f4 <vprintfmt+0x388>
+			putch('%', putdat);
+  800899:	83 ec 08             	sub    $0x8,%esp
+  80089c:	53                   	push   %ebx
+  80089d:	6a 25                	push   $0x25
+  80089f:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008a1:	83 c4 10             	add    $0x10,%esp
+  8008a4:	89 f8                	mov    %edi,%eax
+  8008a6:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008aa:	74 05                	je     8008b1 <vprintfmt+0x445>
+  8008ac:	83 e8 01             	sub    $0x1,%eax
+  8008af:	eb f5                	jmp    8008a6 <vprintfmt+0x43a>
+  8008b1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008b4:	e9 3b ff ff ff       	jmp    8007f4 <vprintfmt+0x388>
+
+008008b9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008b9:	55                   	push   %ebp
+  8008ba:	89 e5                	mov    %esp,%ebp
+  8008bc:	83 ec 18             	sub    $0x18,%esp
+  8008bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008c5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008c8:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008cc:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008cf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008d6:	85 c0                	test   %eax,%eax
+  8008d8:	74 26                	je     800900 <vsnprintf+0x47>
+  8008da:	85 d2                	test   %edx,%edx
+  8008dc:	7e 22                	jle    800900 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008de:	ff 75 14             	push   0x14(%ebp)
+  8008e1:	ff 75 10             	push   0x10(%ebp)
+  8008e4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008e7:	50                   	push   %eax
+  8008e8:	68 32 04 80 00       	push   $0x800432
+  8008ed:	e8 7a fb ff ff       	call   80046c <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008f2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008f5:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008fb:	83 c4 10             	add    $0x10,%esp
+}
+  8008fe:	c9                   	leave
+  8008ff:	c3                   	ret
+		return -E_INVAL;
+  800900:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800905:	eb f7                	jmp    8008fe <vsnprintf+0x45>
+
+00800907 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800907:	55                   	push   %ebp
+  800908:	89 e5                	mov    %esp,%ebp
+  80090a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80090d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800910:	50                   	push   %eax
+  800911:	ff 75 10             	push   0x10(%ebp)
+  800914:	ff 75 0c             	push   0xc(%ebp)
+  800917:	ff 75 08             	push   0x8(%ebp)
+  80091a:	e8 9a ff ff ff       	call   8008b9 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80091f:	c9                   	leave
+  800920:	c3                   	ret
+
+00800921 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800921:	55                   	push   %ebp
+  800922:	89 e5                	mov    %esp,%ebp
+  800924:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092c:	eb 03                	jmp    800931 <strlen+0x10>
+		n++;
+  80092e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800931:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800935:	75 f7                	jne    80092e <strlen+0xd>
+	return n;
+}
+  800937:	5d                   	pop    %ebp
+  800938:	c3                   	ret
+
+00800939 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800939:	55                   	push   %ebp
+  80093a:	89 e5                	mov    %esp,%ebp
+  80093c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80093f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800942:	b8 00 00 00 00       	mov    $0x0,%eax
+  800947:	eb 03                	jmp    80094c <strnlen+0x13>
+		n++;
+  800949:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80094c:	39 d0                	cmp    %edx,%eax
+  80094e:	74 08                	je     800958 <strnlen+0x1f>
+  800950:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800954:	75 f3                	jne    800949 <strnlen+0x10>
+  800956:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800958:	89 d0                	mov    %edx,%eax
+  80095a:	5d                   	pop    %ebp
+  80095b:	c3                   	ret
+
+0080095c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80095c:	55                   	push   %ebp
+  80095d:	89 e5                	mov    %esp,%ebp
+  80095f:	53                   	push   %ebx
+  800960:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800963:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800966:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80096f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800972:	83 c0 01             	add    $0x1,%eax
+  800975:	84 d2                	test   %dl,%dl
+  800977:	75 f2                	jne    80096b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800979:	89 c8                	mov    %ecx,%eax
+  80097b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80097e:	c9                   	leave
+  80097f:	c3                   	ret
+
+00800980 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800980:	55                   	push   %ebp
+  800981:	89 e5                	mov    %esp,%ebp
+  800983:	53                   	push   %ebx
+  800984:	83 ec 10             	sub    $0x10,%esp
+  800987:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80098a:	53                   	push   %ebx
+  80098b:	e8 91 ff ff ff       	call   800921 <strlen>
+  800990:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800993:	ff 75 0c             	push   0xc(%ebp)
+  800996:	01 d8                	add    %ebx,%eax
+  800998:	50                   	push   %eax
+  800999:	e8 be ff ff ff       	call   80095c <strcpy>
+	return dst;
+}
+  80099e:	89 d8                	mov    %ebx,%eax
+  8009a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009a3:	c9                   	leave
+  8009a4:	c3                   	ret
+
+008009a5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009a5:	55                   	push   %ebp
+  8009a6:	89 e5                	mov    %esp,%ebp
+  8009a8:	56                   	push   %esi
+  8009a9:	53                   	push   %ebx
+  8009aa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009b0:	89 f3                	mov    %esi,%ebx
+  8009b2:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009b5:	89 f0                	mov    %esi,%eax
+  8009b7:	eb 0f                	jmp    8009c8 <strncpy+0x23>
+		*dst++ = *src;
+  8009b9:	83 c0 01             	add    $0x1,%eax
+  8009bc:	0f b6 0a             	movzbl (%edx),%ecx
+  8009bf:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009c2:	80 f9 01             	cmp    $0x1,%cl
+  8009c5:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009c8:	39 d8                	cmp    %ebx,%eax
+  8009ca:	75 ed                	jne    8009b9 <strncpy+0x14>
+	}
+	return ret;
+}
+  8009cc:	89 f0                	mov    %esi,%eax
+  8009ce:	5b                   	pop    %ebx
+  8009cf:	5e                   	pop    %esi
+  8009d0:	5d                   	pop    %ebp
+  8009d1:	c3                   	ret
+
+008009d2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009d2:	55                   	push   %ebp
+  8009d3:	89 e5                	mov    %esp,%ebp
+  8009d5:	56                   	push   %esi
+  8009d6:	53                   	push   %ebx
+  8009d7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009dd:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009e0:	89 f0                	mov    %esi,%eax
+  8009e2:	85 d2                	test   %edx,%edx
+  8009e4:	74 21                	je     800a07 <strlcpy+0x35>
+  8009e6:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009ea:	89 f2                	mov    %esi,%edx
+  8009ec:	eb 09                	jmp    8009f7 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009ee:	83 c1 01             	add    $0x1,%ecx
+  8009f1:	83 c2 01             	add    $0x1,%edx
+  8009f4:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009f7:	39 c2                	cmp    %eax,%edx
+  8009f9:	74 09                	je     800a04 <strlcpy+0x32>
+  8009fb:	0f b6 19             	movzbl (%ecx),%ebx
+  8009fe:	84 db                	test   %bl,%bl
+  800a00:	75 ec                	jne    8009ee <strlcpy+0x1c>
+  800a02:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a04:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a07:	29 f0                	sub    %esi,%eax
+}
+  800a09:	5b                   	pop    %ebx
+  800a0a:	5e                   	pop    %esi
+  800a0b:	5d                   	pop    %ebp
+  800a0c:	c3                   	ret
+
+00800a0d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a0d:	55                   	push   %ebp
+  800a0e:	89 e5                	mov    %esp,%ebp
+  800a10:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a13:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a16:	eb 06                	jmp    800a1e <strcmp+0x11>
+		p++, q++;
+  800a18:	83 c1 01             	add    $0x1,%ecx
+  800a1b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a1e:	0f b6 01             	movzbl (%ecx),%eax
+  800a21:	84 c0                	test   %al,%al
+  800a23:	74 04                	je     800a29 <strcmp+0x1c>
+  800a25:	3a 02                	cmp    (%edx),%al
+  800a27:	74 ef                	je     800a18 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a29:	0f b6 c0             	movzbl %al,%eax
+  800a2c:	0f b6 12             	movzbl (%edx),%edx
+  800a2f:	29 d0                	sub    %edx,%eax
+}
+  800a31:	5d                   	pop    %ebp
+  800a32:	c3                   	ret
+
+00800a33 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a33:	55                   	push   %ebp
+  800a34:	89 e5                	mov    %esp,%ebp
+  800a36:	53                   	push   %ebx
+  800a37:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a3d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a40:	eb 09                	jmp    800a4b <strncmp+0x18>
+		n--, p++, q++;
+  800a42:	83 ea 01             	sub    $0x1,%edx
+  800a45:	83 c0 01             	add    $0x1,%eax
+  800a48:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a4b:	85 d2                	test   %edx,%edx
+  800a4d:	74 18                	je     800a67 <strncmp+0x34>
+  800a4f:	0f b6 18             	movzbl (%eax),%ebx
+  800a52:	84 db                	test   %bl,%bl
+  800a54:	74 04                	je     800a5a <strncmp+0x27>
+  800a56:	3a 19                	cmp    (%ecx),%bl
+  800a58:	74 e8                	je     800a42 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a5a:	0f b6 00             	movzbl (%eax),%eax
+  800a5d:	0f b6 11             	movzbl (%ecx),%edx
+  800a60:	29 d0                	sub    %edx,%eax
+}
+  800a62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a65:	c9                   	leave
+  800a66:	c3                   	ret
+		return 0;
+  800a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6c:	eb f4                	jmp    800a62 <strncmp+0x2f>
+
+00800a6e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a6e:	55                   	push   %ebp
+  800a6f:	89 e5                	mov    %esp,%ebp
+  800a71:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a74:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a78:	eb 03                	jmp    800a7d <strchr+0xf>
+  800a7a:	83 c0 01             	add    $0x1,%eax
+  800a7d:	0f b6 10             	movzbl (%eax),%edx
+  800a80:	84 d2                	test   %dl,%dl
+  800a82:	74 06                	je     800a8a <strchr+0x1c>
+		if (*s == c)
+  800a84:	38 ca                	cmp    %cl,%dl
+  800a86:	75 f2                	jne    800a7a <strchr+0xc>
+  800a88:	eb 05                	jmp    800a8f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a8f:	5d                   	pop    %ebp
+  800a90:	c3                   	ret
+
+00800a91 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a91:	55                   	push   %ebp
+  800a92:	89 e5                	mov    %esp,%ebp
+  800a94:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a97:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a9b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a9e:	38 ca                	cmp    %cl,%dl
+  800aa0:	74 09                	je     800aab <strfind+0x1a>
+  800aa2:	84 d2                	test   %dl,%dl
+  800aa4:	74 05                	je     800aab <strfind+0x1a>
+	for (; *s; s++)
+  800aa6:	83 c0 01             	add    $0x1,%eax
+  800aa9:	eb f0                	jmp    800a9b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800aab:	5d                   	pop    %ebp
+  800aac:	c3                   	ret
+
+00800aad <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800aad:	55                   	push   %ebp
+  800aae:	89 e5                	mov    %esp,%ebp
+  800ab0:	57                   	push   %edi
+  800ab1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ab4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ab7:	85 c9                	test   %ecx,%ecx
+  800ab9:	74 20                	je     800adb <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800abb:	89 f8                	mov    %edi,%eax
+  800abd:	09 c8                	or     %ecx,%eax
+  800abf:	a8 03                	test   $0x3,%al
+  800ac1:	75 12                	jne    800ad5 <memset+0x28>
+		c &= 0xFF;
+  800ac3:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ac7:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800acd:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ad0:	fc                   	cld
+  800ad1:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ad3:	eb 06                	jmp    800adb <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ad5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ad8:	fc                   	cld
+  800ad9:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800adb:	89 f8                	mov    %edi,%eax
+  800add:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ae0:	c9                   	leave
+  800ae1:	c3                   	ret
+
+00800ae2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ae2:	55                   	push   %ebp
+  800ae3:	89 e5                	mov    %esp,%ebp
+  800ae5:	57                   	push   %edi
+  800ae6:	56                   	push   %esi
+  800ae7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aea:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aed:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800af0:	39 c6                	cmp    %eax,%esi
+  800af2:	73 32                	jae    800b26 <memmove+0x44>
+  800af4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800af7:	39 d0                	cmp    %edx,%eax
+  800af9:	73 2b                	jae    800b26 <memmove+0x44>
+		s += n;
+		d += n;
+  800afb:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800afe:	89 d6                	mov    %edx,%esi
+  800b00:	09 fe                	or     %edi,%esi
+  800b02:	09 ce                	or     %ecx,%esi
+  800b04:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b0a:	75 0e                	jne    800b1a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b0c:	83 ef 04             	sub    $0x4,%edi
+  800b0f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b12:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b15:	fd                   	std
+  800b16:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b18:	eb 09                	jmp    800b23 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b1a:	83 ef 01             	sub    $0x1,%edi
+  800b1d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b20:	fd                   	std
+  800b21:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b23:	fc                   	cld
+  800b24:	eb 1a                	jmp    800b40 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b26:	89 f2                	mov    %esi,%edx
+  800b28:	09 c2                	or     %eax,%edx
+  800b2a:	09 ca                	or     %ecx,%edx
+  800b2c:	f6 c2 03             	test   $0x3,%dl
+  800b2f:	75 0a                	jne    800b3b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b31:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b34:	89 c7                	mov    %eax,%edi
+  800b36:	fc                   	cld
+  800b37:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b39:	eb 05                	jmp    800b40 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b3b:	89 c7                	mov    %eax,%edi
+  800b3d:	fc                   	cld
+  800b3e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b40:	5e                   	pop    %esi
+  800b41:	5f                   	pop    %edi
+  800b42:	5d                   	pop    %ebp
+  800b43:	c3                   	ret
+
+00800b44 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b44:	55                   	push   %ebp
+  800b45:	89 e5                	mov    %esp,%ebp
+  800b47:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b4a:	ff 75 10             	push   0x10(%ebp)
+  800b4d:	ff 75 0c             	push   0xc(%ebp)
+  800b50:	ff 75 08             	push   0x8(%ebp)
+  800b53:	e8 8a ff ff ff       	call   800ae2 <memmove>
+}
+  800b58:	c9                   	leave
+  800b59:	c3                   	ret
+
+00800b5a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b5a:	55                   	push   %ebp
+  800b5b:	89 e5                	mov    %esp,%ebp
+  800b5d:	56                   	push   %esi
+  800b5e:	53                   	push   %ebx
+  800b5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b62:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b65:	89 c6                	mov    %eax,%esi
+  800b67:	03 75 10             	add    0x10(%ebp),%esi
+  800b6a:	eb 06                	jmp    800b72 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b6c:	83 c0 01             	add    $0x1,%eax
+  800b6f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b72:	39 f0                	cmp    %esi,%eax
+  800b74:	74 14                	je     800b8a <memcmp+0x30>
+		if (*s1 != *s2)
+  800b76:	0f b6 08             	movzbl (%eax),%ecx
+  800b79:	0f b6 1a             	movzbl (%edx),%ebx
+  800b7c:	38 d9                	cmp    %bl,%cl
+  800b7e:	74 ec                	je     800b6c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b80:	0f b6 c1             	movzbl %cl,%eax
+  800b83:	0f b6 db             	movzbl %bl,%ebx
+  800b86:	29 d8                	sub    %ebx,%eax
+  800b88:	eb 05                	jmp    800b8f <memcmp+0x35>
+	}
+
+	return 0;
+  800b8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b8f:	5b                   	pop    %ebx
+  800b90:	5e                   	pop    %esi
+  800b91:	5d                   	pop    %ebp
+  800b92:	c3                   	ret
+
+00800b93 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b93:	55                   	push   %ebp
+  800b94:	89 e5                	mov    %esp,%ebp
+  800b96:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b9c:	89 c2                	mov    %eax,%edx
+  800b9e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ba1:	eb 03                	jmp    800ba6 <memfind+0x13>
+  800ba3:	83 c0 01             	add    $0x1,%eax
+  800ba6:	39 d0                	cmp    %edx,%eax
+  800ba8:	73 04                	jae    800bae <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800baa:	38 08                	cmp    %cl,(%eax)
+  800bac:	75 f5                	jne    800ba3 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800bae:	5d                   	pop    %ebp
+  800baf:	c3                   	ret
+
+00800bb0 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bb0:	55                   	push   %ebp
+  800bb1:	89 e5                	mov    %esp,%ebp
+  800bb3:	57                   	push   %edi
+  800bb4:	56                   	push   %esi
+  800bb5:	53                   	push   %ebx
+  800bb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bbc:	eb 03                	jmp    800bc1 <strtol+0x11>
+		s++;
+  800bbe:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800bc1:	0f b6 02             	movzbl (%edx),%eax
+  800bc4:	3c 20                	cmp    $0x20,%al
+  800bc6:	74 f6                	je     800bbe <strtol+0xe>
+  800bc8:	3c 09                	cmp    $0x9,%al
+  800bca:	74 f2                	je     800bbe <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bcc:	3c 2b                	cmp    $0x2b,%al
+  800bce:	74 2a                	je     800bfa <strtol+0x4a>
+	int neg = 0;
+  800bd0:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800bd5:	3c 2d                	cmp    $0x2d,%al
+  800bd7:	74 2b                	je     800c04 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bd9:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bdf:	75 0f                	jne    800bf0 <strtol+0x40>
+  800be1:	80 3a 30             	cmpb   $0x30,(%edx)
+  800be4:	74 28                	je     800c0e <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800be6:	85 db                	test   %ebx,%ebx
+  800be8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bed:	0f 44 d8             	cmove  %eax,%ebx
+  800bf0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf5:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bf8:	eb 46                	jmp    800c40 <strtol+0x90>
+		s++;
+  800bfa:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bfd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c02:	eb d5                	jmp    800bd9 <strtol+0x29>
+		s++, neg = 1;
+  800c04:	83 c2 01             	add    $0x1,%edx
+  800c07:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c0c:	eb cb                	jmp    800bd9 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c0e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c12:	74 0e                	je     800c22 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800c14:	85 db                	test   %ebx,%ebx
+  800c16:	75 d8                	jne    800bf0 <strtol+0x40>
+		s++, base = 8;
+  800c18:	83 c2 01             	add    $0x1,%edx
+  800c1b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c20:	eb ce                	jmp    800bf0 <strtol+0x40>
+		s += 2, base = 16;
+  800c22:	83 c2 02             	add    $0x2,%edx
+  800c25:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c2a:	eb c4                	jmp    800bf0 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c2c:	0f be c0             	movsbl %al,%eax
+  800c2f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c32:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c35:	7d 3a                	jge    800c71 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c37:	83 c2 01             	add    $0x1,%edx
+  800c3a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c3e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c40:	0f b6 02             	movzbl (%edx),%eax
+  800c43:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c46:	89 f3                	mov    %esi,%ebx
+  800c48:	80 fb 09             	cmp    $0x9,%bl
+  800c4b:	76 df                	jbe    800c2c <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c4d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c50:	89 f3                	mov    %esi,%ebx
+  800c52:	80 fb 19             	cmp    $0x19,%bl
+  800c55:	77 08                	ja     800c5f <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c57:	0f be c0             	movsbl %al,%eax
+  800c5a:	83 e8 57             	sub    $0x57,%eax
+  800c5d:	eb d3                	jmp    800c32 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c5f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c62:	89 f3                	mov    %esi,%ebx
+  800c64:	80 fb 19             	cmp    $0x19,%bl
+  800c67:	77 08                	ja     800c71 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c69:	0f be c0             	movsbl %al,%eax
+  800c6c:	83 e8 37             	sub    $0x37,%eax
+  800c6f:	eb c1                	jmp    800c32 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c71:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c75:	74 05                	je     800c7c <strtol+0xcc>
+		*endptr = (char *) s;
+  800c77:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c7a:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c7c:	89 c8                	mov    %ecx,%eax
+  800c7e:	f7 d8                	neg    %eax
+  800c80:	85 ff                	test   %edi,%edi
+  800c82:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c85:	89 c8                	mov    %ecx,%eax
+  800c87:	5b                   	pop    %ebx
+  800c88:	5e                   	pop    %esi
+  800c89:	5f                   	pop    %edi
+  800c8a:	5d                   	pop    %ebp
+  800c8b:	c3                   	ret
+
+00800c8c <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800c8c:	55                   	push   %ebp
+  800c8d:	89 e5                	mov    %esp,%ebp
+  800c8f:	57                   	push   %edi
+  800c90:	56                   	push   %esi
+  800c91:	53                   	push   %ebx
+  800c92:	83 ec 0c             	sub    $0xc,%esp
+  800c95:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800c98:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c9b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800c9e:	85 ff                	test   %edi,%edi
+  800ca0:	74 16                	je     800cb8 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800ca2:	83 ec 04             	sub    $0x4,%esp
+  800ca5:	56                   	push   %esi
+  800ca6:	6a 00                	push   $0x0
+  800ca8:	53                   	push   %ebx
+  800ca9:	e8 02 ff ff ff       	call   800bb0 <strtol>
+  800cae:	89 07                	mov    %eax,(%edi)
+  800cb0:	83 c4 10             	add    $0x10,%esp
+  800cb3:	eb 03                	jmp    800cb8 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800cb5:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800cb8:	0f b6 03             	movzbl (%ebx),%eax
+  800cbb:	3c 20                	cmp    $0x20,%al
+  800cbd:	74 f6                	je     800cb5 <strisl+0x29>
+  800cbf:	3c 09                	cmp    $0x9,%al
+  800cc1:	74 f2                	je     800cb5 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cc3:	3c 2b                	cmp    $0x2b,%al
+  800cc5:	74 23                	je     800cea <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800cc7:	3c 2d                	cmp    $0x2d,%al
+  800cc9:	0f 94 c0             	sete   %al
+  800ccc:	0f b6 c0             	movzbl %al,%eax
+  800ccf:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cd1:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800cd7:	75 41                	jne    800d1a <strisl+0x8e>
+  800cd9:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800cdc:	74 11                	je     800cef <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800cde:	85 f6                	test   %esi,%esi
+  800ce0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ce5:	0f 44 f0             	cmove  %eax,%esi
+  800ce8:	eb 30                	jmp    800d1a <strisl+0x8e>
+		s++;
+  800cea:	83 c3 01             	add    $0x1,%ebx
+  800ced:	eb e2                	jmp    800cd1 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cef:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800cf3:	74 0e                	je     800d03 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800cf5:	85 f6                	test   %esi,%esi
+  800cf7:	75 21                	jne    800d1a <strisl+0x8e>
+		s++, base = 8;
+  800cf9:	83 c3 01             	add    $0x1,%ebx
+  800cfc:	be 08 00 00 00       	mov    $0x8,%esi
+  800d01:	eb 17                	jmp    800d1a <strisl+0x8e>
+		s += 2, base = 16;
+  800d03:	83 c3 02             	add    $0x2,%ebx
+  800d06:	be 10 00 00 00       	mov    $0x10,%esi
+  800d0b:	eb 0d                	jmp    800d1a <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d0d:	0f be c0             	movsbl %al,%eax
+  800d10:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800d13:	39 f0                	cmp    %esi,%eax
+  800d15:	7d 38                	jge    800d4f <strisl+0xc3>
+			return 0;
+		s++;
+  800d17:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800d1a:	0f b6 03             	movzbl (%ebx),%eax
+  800d1d:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800d20:	80 fa 09             	cmp    $0x9,%dl
+  800d23:	76 e8                	jbe    800d0d <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800d25:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800d28:	80 fa 19             	cmp    $0x19,%dl
+  800d2b:	77 08                	ja     800d35 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800d2d:	0f be c0             	movsbl %al,%eax
+  800d30:	83 e8 57             	sub    $0x57,%eax
+  800d33:	eb de                	jmp    800d13 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d35:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800d38:	80 fa 19             	cmp    $0x19,%dl
+  800d3b:	77 08                	ja     800d45 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800d3d:	0f be c0             	movsbl %al,%eax
+  800d40:	83 e8 37             	sub    $0x37,%eax
+  800d43:	eb ce                	jmp    800d13 <strisl+0x87>
+		else if (!*s)
+  800d45:	84 c0                	test   %al,%al
+  800d47:	0f 94 c0             	sete   %al
+  800d4a:	0f b6 c0             	movzbl %al,%eax
+  800d4d:	eb 05                	jmp    800d54 <strisl+0xc8>
+			return 0;
+  800d4f:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800d54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d57:	5b                   	pop    %ebx
+  800d58:	5e                   	pop    %esi
+  800d59:	5f                   	pop    %edi
+  800d5a:	5d                   	pop    %ebp
+  800d5b:	c3                   	ret
+
+00800d5c <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800d5c:	55                   	push   %ebp
+  800d5d:	89 e5                	mov    %esp,%ebp
+  800d5f:	83 ec 10             	sub    $0x10,%esp
+  800d62:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800d65:	89 c8                	mov    %ecx,%eax
+  800d67:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800d6c:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800d6f:	eb 0b                	jmp    800d7c <touch_mem+0x20>
+		c = *(char *)page;
+  800d71:	0f b6 10             	movzbl (%eax),%edx
+  800d74:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800d77:	05 00 10 00 00       	add    $0x1000,%eax
+  800d7c:	39 c8                	cmp    %ecx,%eax
+  800d7e:	72 f1                	jb     800d71 <touch_mem+0x15>
+}
+  800d80:	c9                   	leave
+  800d81:	c3                   	ret
+
+00800d82 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d82:	55                   	push   %ebp
+  800d83:	89 e5                	mov    %esp,%ebp
+  800d85:	57                   	push   %edi
+  800d86:	56                   	push   %esi
+  800d87:	53                   	push   %ebx
+	touch_mem(s, len);
+  800d88:	ff 75 0c             	push   0xc(%ebp)
+  800d8b:	ff 75 08             	push   0x8(%ebp)
+  800d8e:	e8 c9 ff ff ff       	call   800d5c <touch_mem>
+	asm volatile("int %1\n"
+  800d93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9e:	89 c3                	mov    %eax,%ebx
+  800da0:	89 c7                	mov    %eax,%edi
+  800da2:	89 c6                	mov    %eax,%esi
+  800da4:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800da6:	83 c4 08             	add    $0x8,%esp
+  800da9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dac:	5b                   	pop    %ebx
+  800dad:	5e                   	pop    %esi
+  800dae:	5f                   	pop    %edi
+  800daf:	5d                   	pop    %ebp
+  800db0:	c3                   	ret
+
+00800db1 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800db1:	55                   	push   %ebp
+  800db2:	89 e5                	mov    %esp,%ebp
+  800db4:	57                   	push   %edi
+  800db5:	56                   	push   %esi
+  800db6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800db7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbc:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dc1:	89 d1                	mov    %edx,%ecx
+  800dc3:	89 d3                	mov    %edx,%ebx
+  800dc5:	89 d7                	mov    %edx,%edi
+  800dc7:	89 d6                	mov    %edx,%esi
+  800dc9:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dcb:	5b                   	pop    %ebx
+  800dcc:	5e                   	pop    %esi
+  800dcd:	5f                   	pop    %edi
+  800dce:	5d                   	pop    %ebp
+  800dcf:	c3                   	ret
+
+00800dd0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800dd0:	55                   	push   %ebp
+  800dd1:	89 e5                	mov    %esp,%ebp
+  800dd3:	57                   	push   %edi
+  800dd4:	56                   	push   %esi
+  800dd5:	53                   	push   %ebx
+  800dd6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de1:	b8 03 00 00 00       	mov    $0x3,%eax
+  800de6:	89 cb                	mov    %ecx,%ebx
+  800de8:	89 cf                	mov    %ecx,%edi
+  800dea:	89 ce                	mov    %ecx,%esi
+  800dec:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dee:	85 c0                	test   %eax,%eax
+  800df0:	7f 08                	jg     800dfa <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800df2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df5:	5b                   	pop    %ebx
+  800df6:	5e                   	pop    %esi
+  800df7:	5f                   	pop    %edi
+  800df8:	5d                   	pop    %ebp
+  800df9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dfa:	83 ec 0c             	sub    $0xc,%esp
+  800dfd:	50                   	push   %eax
+  800dfe:	6a 03                	push   $0x3
+  800e00:	68 4b 58 80 00       	push   $0x80584b
+  800e05:	6a 23                	push   $0x23
+  800e07:	68 68 58 80 00       	push   $0x805868
+  800e0c:	e8 89 f4 ff ff       	call   80029a <_panic>
+
+00800e11 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	57                   	push   %edi
+  800e15:	56                   	push   %esi
+  800e16:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e21:	89 d1                	mov    %edx,%ecx
+  800e23:	89 d3                	mov    %edx,%ebx
+  800e25:	89 d7                	mov    %edx,%edi
+  800e27:	89 d6                	mov    %edx,%esi
+  800e29:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e2b:	5b                   	pop    %ebx
+  800e2c:	5e                   	pop    %esi
+  800e2d:	5f                   	pop    %edi
+  800e2e:	5d                   	pop    %ebp
+  800e2f:	c3                   	ret
+
+00800e30 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e30:	55                   	push   %ebp
+  800e31:	89 e5                	mov    %esp,%ebp
+  800e33:	57                   	push   %edi
+  800e34:	56                   	push   %esi
+  800e35:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e36:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e40:	89 d1                	mov    %edx,%ecx
+  800e42:	89 d3                	mov    %edx,%ebx
+  800e44:	89 d7                	mov    %edx,%edi
+  800e46:	89 d6                	mov    %edx,%esi
+  800e48:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e4a:	5b                   	pop    %ebx
+  800e4b:	5e                   	pop    %esi
+  800e4c:	5f                   	pop    %edi
+  800e4d:	5d                   	pop    %ebp
+  800e4e:	c3                   	ret
+
+00800e4f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e4f:	55                   	push   %ebp
+  800e50:	89 e5                	mov    %esp,%ebp
+  800e52:	57                   	push   %edi
+  800e53:	56                   	push   %esi
+  800e54:	53                   	push   %ebx
+  800e55:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e58:	be 00 00 00 00       	mov    $0x0,%esi
+  800e5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e63:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e6b:	89 f7                	mov    %esi,%edi
+  800e6d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e6f:	85 c0                	test   %eax,%eax
+  800e71:	7f 08                	jg     800e7b <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e76:	5b                   	pop    %ebx
+  800e77:	5e                   	pop    %esi
+  800e78:	5f                   	pop    %edi
+  800e79:	5d                   	pop    %ebp
+  800e7a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e7b:	83 ec 0c             	sub    $0xc,%esp
+  800e7e:	50                   	push   %eax
+  800e7f:	6a 04                	push   $0x4
+  800e81:	68 4b 58 80 00       	push   $0x80584b
+  800e86:	6a 23                	push   $0x23
+  800e88:	68 68 58 80 00       	push   $0x805868
+  800e8d:	e8 08 f4 ff ff       	call   80029a <_panic>
+
+00800e92 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e92:	55                   	push   %ebp
+  800e93:	89 e5                	mov    %esp,%ebp
+  800e95:	57                   	push   %edi
+  800e96:	56                   	push   %esi
+  800e97:	53                   	push   %ebx
+  800e98:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea1:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ea6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eac:	8b 75 18             	mov    0x18(%ebp),%esi
+  800eaf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb1:	85 c0                	test   %eax,%eax
+  800eb3:	7f 08                	jg     800ebd <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800eb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb8:	5b                   	pop    %ebx
+  800eb9:	5e                   	pop    %esi
+  800eba:	5f                   	pop    %edi
+  800ebb:	5d                   	pop    %ebp
+  800ebc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ebd:	83 ec 0c             	sub    $0xc,%esp
+  800ec0:	50                   	push   %eax
+  800ec1:	6a 05                	push   $0x5
+  800ec3:	68 4b 58 80 00       	push   $0x80584b
+  800ec8:	6a 23                	push   $0x23
+  800eca:	68 68 58 80 00       	push   $0x805868
+  800ecf:	e8 c6 f3 ff ff       	call   80029a <_panic>
+
+00800ed4 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ed4:	55                   	push   %ebp
+  800ed5:	89 e5                	mov    %esp,%ebp
+  800ed7:	57                   	push   %edi
+  800ed8:	56                   	push   %esi
+  800ed9:	53                   	push   %ebx
+  800eda:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800edd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee8:	b8 06 00 00 00       	mov    $0x6,%eax
+  800eed:	89 df                	mov    %ebx,%edi
+  800eef:	89 de                	mov    %ebx,%esi
+  800ef1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef3:	85 c0                	test   %eax,%eax
+  800ef5:	7f 08                	jg     800eff <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ef7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800efa:	5b                   	pop    %ebx
+  800efb:	5e                   	pop    %esi
+  800efc:	5f                   	pop    %edi
+  800efd:	5d                   	pop    %ebp
+  800efe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eff:	83 ec 0c             	sub    $0xc,%esp
+  800f02:	50                   	push   %eax
+  800f03:	6a 06                	push   $0x6
+  800f05:	68 4b 58 80 00       	push   $0x80584b
+  800f0a:	6a 23                	push   $0x23
+  800f0c:	68 68 58 80 00       	push   $0x805868
+  800f11:	e8 84 f3 ff ff       	call   80029a <_panic>
+
+00800f16 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800f16:	55                   	push   %ebp
+  800f17:	89 e5                	mov    %esp,%ebp
+  800f19:	57                   	push   %edi
+  800f1a:	56                   	push   %esi
+  800f1b:	53                   	push   %ebx
+  800f1c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f1f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f24:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2a:	b8 18 00 00 00       	mov    $0x18,%eax
+  800f2f:	89 df                	mov    %ebx,%edi
+  800f31:	89 de                	mov    %ebx,%esi
+  800f33:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f35:	85 c0                	test   %eax,%eax
+  800f37:	7f 08                	jg     800f41 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3c:	5b                   	pop    %ebx
+  800f3d:	5e                   	pop    %esi
+  800f3e:	5f                   	pop    %edi
+  800f3f:	5d                   	pop    %ebp
+  800f40:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f41:	83 ec 0c             	sub    $0xc,%esp
+  800f44:	50                   	push   %eax
+  800f45:	6a 18                	push   $0x18
+  800f47:	68 4b 58 80 00       	push   $0x80584b
+  800f4c:	6a 23                	push   $0x23
+  800f4e:	68 68 58 80 00       	push   $0x805868
+  800f53:	e8 42 f3 ff ff       	call   80029a <_panic>
+
+00800f58 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800f58:	55                   	push   %ebp
+  800f59:	89 e5                	mov    %esp,%ebp
+  800f5b:	57                   	push   %edi
+  800f5c:	56                   	push   %esi
+  800f5d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f5e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f63:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f69:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f6e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f71:	89 f7                	mov    %esi,%edi
+  800f73:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800f75:	5b                   	pop    %ebx
+  800f76:	5e                   	pop    %esi
+  800f77:	5f                   	pop    %edi
+  800f78:	5d                   	pop    %ebp
+  800f79:	c3                   	ret
+
+00800f7a <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800f7a:	55                   	push   %ebp
+  800f7b:	89 e5                	mov    %esp,%ebp
+  800f7d:	57                   	push   %edi
+  800f7e:	56                   	push   %esi
+  800f7f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f86:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f8b:	be 00 00 00 00       	mov    $0x0,%esi
+  800f90:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f93:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f96:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800f98:	5b                   	pop    %ebx
+  800f99:	5e                   	pop    %esi
+  800f9a:	5f                   	pop    %edi
+  800f9b:	5d                   	pop    %ebp
+  800f9c:	c3                   	ret
+
+00800f9d <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800f9d:	55                   	push   %ebp
+  800f9e:	89 e5                	mov    %esp,%ebp
+  800fa0:	57                   	push   %edi
+  800fa1:	56                   	push   %esi
+  800fa2:	53                   	push   %ebx
+  800fa3:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800fa6:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800fa9:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800faf:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800fb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb8:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fbd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fc3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc5:	85 c0                	test   %eax,%eax
+  800fc7:	7f 08                	jg     800fd1 <sys_page_map_range+0x34>
+}
+  800fc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fcc:	5b                   	pop    %ebx
+  800fcd:	5e                   	pop    %esi
+  800fce:	5f                   	pop    %edi
+  800fcf:	5d                   	pop    %ebp
+  800fd0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd1:	83 ec 0c             	sub    $0xc,%esp
+  800fd4:	50                   	push   %eax
+  800fd5:	6a 10                	push   $0x10
+  800fd7:	68 4b 58 80 00       	push   $0x80584b
+  800fdc:	6a 23                	push   $0x23
+  800fde:	68 68 58 80 00       	push   $0x805868
+  800fe3:	e8 b2 f2 ff ff       	call   80029a <_panic>
+
+00800fe8 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800fe8:	55                   	push   %ebp
+  800fe9:	89 e5                	mov    %esp,%ebp
+  800feb:	57                   	push   %edi
+  800fec:	56                   	push   %esi
+  800fed:	53                   	push   %ebx
+  800fee:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ff1:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffc:	b8 11 00 00 00       	mov    $0x11,%eax
+  801001:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801004:	89 f7                	mov    %esi,%edi
+  801006:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801008:	85 c0                	test   %eax,%eax
+  80100a:	7f 08                	jg     801014 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  80100c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100f:	5b                   	pop    %ebx
+  801010:	5e                   	pop    %esi
+  801011:	5f                   	pop    %edi
+  801012:	5d                   	pop    %ebp
+  801013:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801014:	83 ec 0c             	sub    $0xc,%esp
+  801017:	50                   	push   %eax
+  801018:	6a 11                	push   $0x11
+  80101a:	68 4b 58 80 00       	push   $0x80584b
+  80101f:	6a 23                	push   $0x23
+  801021:	68 68 58 80 00       	push   $0x805868
+  801026:	e8 6f f2 ff ff       	call   80029a <_panic>
+
+0080102b <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  80102b:	55                   	push   %ebp
+  80102c:	89 e5                	mov    %esp,%ebp
+  80102e:	57                   	push   %edi
+  80102f:	56                   	push   %esi
+  801030:	53                   	push   %ebx
+  801031:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801034:	be 00 00 00 00       	mov    $0x0,%esi
+  801039:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801044:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801047:	89 f7                	mov    %esi,%edi
+  801049:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80104b:	85 c0                	test   %eax,%eax
+  80104d:	7f 08                	jg     801057 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  80104f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801052:	5b                   	pop    %ebx
+  801053:	5e                   	pop    %esi
+  801054:	5f                   	pop    %edi
+  801055:	5d                   	pop    %ebp
+  801056:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801057:	83 ec 0c             	sub    $0xc,%esp
+  80105a:	50                   	push   %eax
+  80105b:	6a 1b                	push   $0x1b
+  80105d:	68 4b 58 80 00       	push   $0x80584b
+  801062:	6a 23                	push   $0x23
+  801064:	68 68 58 80 00       	push   $0x805868
+  801069:	e8 2c f2 ff ff       	call   80029a <_panic>
+
+0080106e <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  80106e:	55                   	push   %ebp
+  80106f:	89 e5                	mov    %esp,%ebp
+  801071:	57                   	push   %edi
+  801072:	56                   	push   %esi
+  801073:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801074:	ba 00 00 00 00       	mov    $0x0,%edx
+  801079:	b8 12 00 00 00       	mov    $0x12,%eax
+  80107e:	89 d1                	mov    %edx,%ecx
+  801080:	89 d3                	mov    %edx,%ebx
+  801082:	89 d7                	mov    %edx,%edi
+  801084:	89 d6                	mov    %edx,%esi
+  801086:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801088:	5b                   	pop    %ebx
+  801089:	5e                   	pop    %esi
+  80108a:	5f                   	pop    %edi
+  80108b:	5d                   	pop    %ebp
+  80108c:	c3                   	ret
+
+0080108d <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80108d:	55                   	push   %ebp
+  80108e:	89 e5                	mov    %esp,%ebp
+  801090:	57                   	push   %edi
+  801091:	56                   	push   %esi
+  801092:	53                   	push   %ebx
+  801093:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801096:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010a6:	89 df                	mov    %ebx,%edi
+  8010a8:	89 de                	mov    %ebx,%esi
+  8010aa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ac:	85 c0                	test   %eax,%eax
+  8010ae:	7f 08                	jg     8010b8 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8010b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b3:	5b                   	pop    %ebx
+  8010b4:	5e                   	pop    %esi
+  8010b5:	5f                   	pop    %edi
+  8010b6:	5d                   	pop    %ebp
+  8010b7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010b8:	83 ec 0c             	sub    $0xc,%esp
+  8010bb:	50                   	push   %eax
+  8010bc:	6a 08                	push   $0x8
+  8010be:	68 4b 58 80 00       	push   $0x80584b
+  8010c3:	6a 23                	push   $0x23
+  8010c5:	68 68 58 80 00       	push   $0x805868
+  8010ca:	e8 cb f1 ff ff       	call   80029a <_panic>
+
+008010cf <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010cf:	55                   	push   %ebp
+  8010d0:	89 e5                	mov    %esp,%ebp
+  8010d2:	57                   	push   %edi
+  8010d3:	56                   	push   %esi
+  8010d4:	53                   	push   %ebx
+  8010d5:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  8010d8:	6a 44                	push   $0x44
+  8010da:	ff 75 0c             	push   0xc(%ebp)
+  8010dd:	e8 7a fc ff ff       	call   800d5c <touch_mem>
+	asm volatile("int %1\n"
+  8010e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ea:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f2:	89 df                	mov    %ebx,%edi
+  8010f4:	89 de                	mov    %ebx,%esi
+  8010f6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010f8:	83 c4 08             	add    $0x8,%esp
+  8010fb:	85 c0                	test   %eax,%eax
+  8010fd:	7f 08                	jg     801107 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801102:	5b                   	pop    %ebx
+  801103:	5e                   	pop    %esi
+  801104:	5f                   	pop    %edi
+  801105:	5d                   	pop    %ebp
+  801106:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801107:	83 ec 0c             	sub    $0xc,%esp
+  80110a:	50                   	push   %eax
+  80110b:	6a 09                	push   $0x9
+  80110d:	68 4b 58 80 00       	push   $0x80584b
+  801112:	6a 23                	push   $0x23
+  801114:	68 68 58 80 00       	push   $0x805868
+  801119:	e8 7c f1 ff ff       	call   80029a <_panic>
+
+0080111e <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  80111e:	55                   	push   %ebp
+  80111f:	89 e5                	mov    %esp,%ebp
+  801121:	57                   	push   %edi
+  801122:	56                   	push   %esi
+  801123:	53                   	push   %ebx
+  801124:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801127:	be 00 00 00 00       	mov    $0x0,%esi
+  80112c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801132:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801137:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80113a:	89 f7                	mov    %esi,%edi
+  80113c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80113e:	85 c0                	test   %eax,%eax
+  801140:	7f 08                	jg     80114a <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  801142:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801145:	5b                   	pop    %ebx
+  801146:	5e                   	pop    %esi
+  801147:	5f                   	pop    %edi
+  801148:	5d                   	pop    %ebp
+  801149:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80114a:	83 ec 0c             	sub    $0xc,%esp
+  80114d:	50                   	push   %eax
+  80114e:	6a 1a                	push   $0x1a
+  801150:	68 4b 58 80 00       	push   $0x80584b
+  801155:	6a 23                	push   $0x23
+  801157:	68 68 58 80 00       	push   $0x805868
+  80115c:	e8 39 f1 ff ff       	call   80029a <_panic>
+
+00801161 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  801161:	55                   	push   %ebp
+  801162:	89 e5                	mov    %esp,%ebp
+  801164:	57                   	push   %edi
+  801165:	56                   	push   %esi
+  801166:	53                   	push   %ebx
+  801167:	83 ec 0c             	sub    $0xc,%esp
+  80116a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  80116d:	89 d8                	mov    %ebx,%eax
+  80116f:	c1 e0 05             	shl    $0x5,%eax
+  801172:	50                   	push   %eax
+  801173:	ff 75 0c             	push   0xc(%ebp)
+  801176:	e8 e1 fb ff ff       	call   800d5c <touch_mem>
+	asm volatile("int %1\n"
+  80117b:	be 00 00 00 00       	mov    $0x0,%esi
+  801180:	8b 55 08             	mov    0x8(%ebp),%edx
+  801183:	b8 13 00 00 00       	mov    $0x13,%eax
+  801188:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118b:	89 f7                	mov    %esi,%edi
+  80118d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80118f:	83 c4 08             	add    $0x8,%esp
+  801192:	85 c0                	test   %eax,%eax
+  801194:	7f 08                	jg     80119e <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  801196:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801199:	5b                   	pop    %ebx
+  80119a:	5e                   	pop    %esi
+  80119b:	5f                   	pop    %edi
+  80119c:	5d                   	pop    %ebp
+  80119d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80119e:	83 ec 0c             	sub    $0xc,%esp
+  8011a1:	50                   	push   %eax
+  8011a2:	6a 13                	push   $0x13
+  8011a4:	68 4b 58 80 00       	push   $0x80584b
+  8011a9:	6a 23                	push   $0x23
+  8011ab:	68 68 58 80 00       	push   $0x805868
+  8011b0:	e8 e5 f0 ff ff       	call   80029a <_panic>
+
+008011b5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8011b5:	55                   	push   %ebp
+  8011b6:	89 e5                	mov    %esp,%ebp
+  8011b8:	57                   	push   %edi
+  8011b9:	56                   	push   %esi
+  8011ba:	53                   	push   %ebx
+  8011bb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011ce:	89 df                	mov    %ebx,%edi
+  8011d0:	89 de                	mov    %ebx,%esi
+  8011d2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011d4:	85 c0                	test   %eax,%eax
+  8011d6:	7f 08                	jg     8011e0 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8011d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011db:	5b                   	pop    %ebx
+  8011dc:	5e                   	pop    %esi
+  8011dd:	5f                   	pop    %edi
+  8011de:	5d                   	pop    %ebp
+  8011df:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e0:	83 ec 0c             	sub    $0xc,%esp
+  8011e3:	50                   	push   %eax
+  8011e4:	6a 0a                	push   $0xa
+  8011e6:	68 4b 58 80 00       	push   $0x80584b
+  8011eb:	6a 23                	push   $0x23
+  8011ed:	68 68 58 80 00       	push   $0x805868
+  8011f2:	e8 a3 f0 ff ff       	call   80029a <_panic>
+
+008011f7 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011f7:	55                   	push   %ebp
+  8011f8:	89 e5                	mov    %esp,%ebp
+  8011fa:	57                   	push   %edi
+  8011fb:	56                   	push   %esi
+  8011fc:	53                   	push   %ebx
+  8011fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801200:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801206:	76 1d                	jbe    801225 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  801208:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801213:	be 01 00 00 00       	mov    $0x1,%esi
+  801218:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80121b:	cd 30                	int    $0x30
+}
+  80121d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801220:	5b                   	pop    %ebx
+  801221:	5e                   	pop    %esi
+  801222:	5f                   	pop    %edi
+  801223:	5d                   	pop    %ebp
+  801224:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801225:	68 00 10 00 00       	push   $0x1000
+  80122a:	53                   	push   %ebx
+  80122b:	e8 2c fb ff ff       	call   800d5c <touch_mem>
+  801230:	83 c4 08             	add    $0x8,%esp
+  801233:	eb d3                	jmp    801208 <sys_ipc_send+0x11>
+
+00801235 <sys_ipc_send_pages>:
+{
+  801235:	55                   	push   %ebp
+  801236:	89 e5                	mov    %esp,%ebp
+  801238:	57                   	push   %edi
+  801239:	56                   	push   %esi
+  80123a:	53                   	push   %ebx
+  80123b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80123e:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801241:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801247:	76 18                	jbe    801261 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  801249:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801254:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801257:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  801259:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125c:	5b                   	pop    %ebx
+  80125d:	5e                   	pop    %esi
+  80125e:	5f                   	pop    %edi
+  80125f:	5d                   	pop    %ebp
+  801260:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801261:	89 f0                	mov    %esi,%eax
+  801263:	c1 e0 0c             	shl    $0xc,%eax
+  801266:	50                   	push   %eax
+  801267:	53                   	push   %ebx
+  801268:	e8 ef fa ff ff       	call   800d5c <touch_mem>
+  80126d:	83 c4 08             	add    $0x8,%esp
+  801270:	eb d7                	jmp    801249 <sys_ipc_send_pages+0x14>
+
+00801272 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801272:	55                   	push   %ebp
+  801273:	89 e5                	mov    %esp,%ebp
+  801275:	57                   	push   %edi
+  801276:	56                   	push   %esi
+  801277:	53                   	push   %ebx
+  801278:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80127b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801280:	8b 55 08             	mov    0x8(%ebp),%edx
+  801283:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801286:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80128b:	89 df                	mov    %ebx,%edi
+  80128d:	89 de                	mov    %ebx,%esi
+  80128f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801291:	85 c0                	test   %eax,%eax
+  801293:	7f 08                	jg     80129d <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801295:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801298:	5b                   	pop    %ebx
+  801299:	5e                   	pop    %esi
+  80129a:	5f                   	pop    %edi
+  80129b:	5d                   	pop    %ebp
+  80129c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80129d:	83 ec 0c             	sub    $0xc,%esp
+  8012a0:	50                   	push   %eax
+  8012a1:	6a 0d                	push   $0xd
+  8012a3:	68 4b 58 80 00       	push   $0x80584b
+  8012a8:	6a 23                	push   $0x23
+  8012aa:	68 68 58 80 00       	push   $0x805868
+  8012af:	e8 e6 ef ff ff       	call   80029a <_panic>
+
+008012b4 <sys_ipc_recv>:
+{
+  8012b4:	55                   	push   %ebp
+  8012b5:	89 e5                	mov    %esp,%ebp
+  8012b7:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8012ba:	6a 01                	push   $0x1
+  8012bc:	ff 75 08             	push   0x8(%ebp)
+  8012bf:	e8 ae ff ff ff       	call   801272 <sys_ipc_recv_pages>
+}
+  8012c4:	c9                   	leave
+  8012c5:	c3                   	ret
+
+008012c6 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8012c6:	55                   	push   %ebp
+  8012c7:	89 e5                	mov    %esp,%ebp
+  8012c9:	57                   	push   %edi
+  8012ca:	56                   	push   %esi
+  8012cb:	53                   	push   %ebx
+  8012cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012cf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012d2:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  8012d5:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8012db:	77 04                	ja     8012e1 <sys_ipc_call+0x1b>
+  8012dd:	85 f6                	test   %esi,%esi
+  8012df:	75 15                	jne    8012f6 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8012e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e7:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012ec:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8012ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f1:	5b                   	pop    %ebx
+  8012f2:	5e                   	pop    %esi
+  8012f3:	5f                   	pop    %edi
+  8012f4:	5d                   	pop    %ebp
+  8012f5:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8012f6:	89 f8                	mov    %edi,%eax
+  8012f8:	c1 e0 0c             	shl    $0xc,%eax
+  8012fb:	50                   	push   %eax
+  8012fc:	53                   	push   %ebx
+  8012fd:	e8 5a fa ff ff       	call   800d5c <touch_mem>
+  801302:	83 c4 08             	add    $0x8,%esp
+  801305:	eb da                	jmp    8012e1 <sys_ipc_call+0x1b>
+
+00801307 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801307:	55                   	push   %ebp
+  801308:	89 e5                	mov    %esp,%ebp
+  80130a:	57                   	push   %edi
+  80130b:	56                   	push   %esi
+  80130c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80130d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801310:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801313:	b8 15 00 00 00       	mov    $0x15,%eax
+  801318:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80131b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80131e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801321:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801323:	5b                   	pop    %ebx
+  801324:	5e                   	pop    %esi
+  801325:	5f                   	pop    %edi
+  801326:	5d                   	pop    %ebp
+  801327:	c3                   	ret
+
+00801328 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  801328:	55                   	push   %ebp
+  801329:	89 e5                	mov    %esp,%ebp
+  80132b:	57                   	push   %edi
+  80132c:	56                   	push   %esi
+  80132d:	53                   	push   %ebx
+  80132e:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801331:	6a 04                	push   $0x4
+  801333:	ff 75 08             	push   0x8(%ebp)
+  801336:	e8 21 fa ff ff       	call   800d5c <touch_mem>
+	asm volatile("int %1\n"
+  80133b:	be 00 00 00 00       	mov    $0x0,%esi
+  801340:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801343:	b8 16 00 00 00       	mov    $0x16,%eax
+  801348:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80134e:	89 f7                	mov    %esi,%edi
+  801350:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801352:	83 c4 08             	add    $0x8,%esp
+  801355:	85 c0                	test   %eax,%eax
+  801357:	7f 08                	jg     801361 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  801359:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80135c:	5b                   	pop    %ebx
+  80135d:	5e                   	pop    %esi
+  80135e:	5f                   	pop    %edi
+  80135f:	5d                   	pop    %ebp
+  801360:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801361:	83 ec 0c             	sub    $0xc,%esp
+  801364:	50                   	push   %eax
+  801365:	6a 16                	push   $0x16
+  801367:	68 4b 58 80 00       	push   $0x80584b
+  80136c:	6a 23                	push   $0x23
+  80136e:	68 68 58 80 00       	push   $0x805868
+  801373:	e8 22 ef ff ff       	call   80029a <_panic>
+
+00801378 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801378:	55                   	push   %ebp
+  801379:	89 e5                	mov    %esp,%ebp
+  80137b:	57                   	push   %edi
+  80137c:	56                   	push   %esi
+  80137d:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  80137e:	6a 04                	push   $0x4
+  801380:	ff 75 08             	push   0x8(%ebp)
+  801383:	e8 d4 f9 ff ff       	call   800d5c <touch_mem>
+	asm volatile("int %1\n"
+  801388:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801390:	b8 17 00 00 00       	mov    $0x17,%eax
+  801395:	8b 55 08             	mov    0x8(%ebp),%edx
+  801398:	89 df                	mov    %ebx,%edi
+  80139a:	89 de                	mov    %ebx,%esi
+  80139c:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80139e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a1:	5b                   	pop    %ebx
+  8013a2:	5e                   	pop    %esi
+  8013a3:	5f                   	pop    %edi
+  8013a4:	5d                   	pop    %ebp
+  8013a5:	c3                   	ret
+
+008013a6 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8013a6:	55                   	push   %ebp
+  8013a7:	89 e5                	mov    %esp,%ebp
+  8013a9:	57                   	push   %edi
+  8013aa:	56                   	push   %esi
+  8013ab:	53                   	push   %ebx
+  8013ac:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013bc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013c1:	89 df                	mov    %ebx,%edi
+  8013c3:	89 de                	mov    %ebx,%esi
+  8013c5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013c7:	85 c0                	test   %eax,%eax
+  8013c9:	7f 08                	jg     8013d3 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  8013cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ce:	5b                   	pop    %ebx
+  8013cf:	5e                   	pop    %esi
+  8013d0:	5f                   	pop    %edi
+  8013d1:	5d                   	pop    %ebp
+  8013d2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013d3:	83 ec 0c             	sub    $0xc,%esp
+  8013d6:	50                   	push   %eax
+  8013d7:	6a 0e                	push   $0xe
+  8013d9:	68 4b 58 80 00       	push   $0x80584b
+  8013de:	6a 23                	push   $0x23
+  8013e0:	68 68 58 80 00       	push   $0x805868
+  8013e5:	e8 b0 ee ff ff       	call   80029a <_panic>
+
+008013ea <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  8013ea:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013f1:	f6 c6 06             	test   $0x6,%dh
+  8013f4:	75 37                	jne    80142d <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  8013f6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013fd:	f6 c2 02             	test   $0x2,%dl
+  801400:	75 19                	jne    80141b <dupperm+0x31>
+  801402:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801409:	f6 c6 08             	test   $0x8,%dh
+  80140c:	75 0d                	jne    80141b <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  80140e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801415:	25 07 0e 00 00       	and    $0xe07,%eax
+  80141a:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  80141b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801422:	25 00 06 00 00       	and    $0x600,%eax
+  801427:	0d 05 08 00 00       	or     $0x805,%eax
+  80142c:	c3                   	ret
+		return 0;
+  80142d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801432:	c3                   	ret
+
+00801433 <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  801433:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  801435:	c1 e0 0c             	shl    $0xc,%eax
+  801438:	c1 e8 16             	shr    $0x16,%eax
+  80143b:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801442:	f6 c1 01             	test   $0x1,%cl
+  801445:	74 2c                	je     801473 <dupable+0x40>
+  801447:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  80144e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801453:	f6 c1 04             	test   $0x4,%cl
+  801456:	74 20                	je     801478 <dupable+0x45>
+  801458:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80145f:	f6 c1 01             	test   $0x1,%cl
+  801462:	74 14                	je     801478 <dupable+0x45>
+  801464:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  80146b:	c1 e8 02             	shr    $0x2,%eax
+  80146e:	83 e0 01             	and    $0x1,%eax
+  801471:	eb 05                	jmp    801478 <dupable+0x45>
+  801473:	b8 00 00 00 00       	mov    $0x0,%eax
+  801478:	83 e0 01             	and    $0x1,%eax
+}
+  80147b:	c3                   	ret
+
+0080147c <pgfault>:
+{
+  80147c:	55                   	push   %ebp
+  80147d:	89 e5                	mov    %esp,%ebp
+  80147f:	56                   	push   %esi
+  801480:	53                   	push   %ebx
+  801481:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801484:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  801486:	89 ca                	mov    %ecx,%edx
+  801488:	c1 ea 0c             	shr    $0xc,%edx
+  80148b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801492:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801496:	0f 84 8e 00 00 00    	je     80152a <pgfault+0xae>
+		return 0;
+  80149c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  8014a1:	f6 c6 08             	test   $0x8,%dh
+  8014a4:	0f 84 85 00 00 00    	je     80152f <pgfault+0xb3>
+	perm |= PTE_W;
+  8014aa:	81 e2 07 06 00 00    	and    $0x607,%edx
+  8014b0:	89 d3                	mov    %edx,%ebx
+  8014b2:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8014b5:	89 ce                	mov    %ecx,%esi
+  8014b7:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  8014bd:	6a 01                	push   $0x1
+  8014bf:	53                   	push   %ebx
+  8014c0:	68 00 f0 7f 00       	push   $0x7ff000
+  8014c5:	6a 00                	push   $0x0
+  8014c7:	e8 39 27 00 00       	call   803c05 <page_alloc>
+  8014cc:	83 c4 10             	add    $0x10,%esp
+  8014cf:	85 c0                	test   %eax,%eax
+  8014d1:	78 33                	js     801506 <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  8014d3:	83 ec 04             	sub    $0x4,%esp
+  8014d6:	68 00 10 00 00       	push   $0x1000
+  8014db:	56                   	push   %esi
+  8014dc:	68 00 f0 7f 00       	push   $0x7ff000
+  8014e1:	e8 fc f5 ff ff       	call   800ae2 <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  8014e6:	89 1c 24             	mov    %ebx,(%esp)
+  8014e9:	56                   	push   %esi
+  8014ea:	6a 00                	push   $0x0
+  8014ec:	68 00 f0 7f 00       	push   $0x7ff000
+  8014f1:	6a 00                	push   $0x0
+  8014f3:	e8 6e 2d 00 00       	call   804266 <page_map>
+  8014f8:	83 c4 20             	add    $0x20,%esp
+  8014fb:	85 c0                	test   %eax,%eax
+  8014fd:	78 19                	js     801518 <pgfault+0x9c>
+	return 1;
+  8014ff:	b8 01 00 00 00       	mov    $0x1,%eax
+  801504:	eb 29                	jmp    80152f <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  801506:	50                   	push   %eax
+  801507:	68 78 58 80 00       	push   $0x805878
+  80150c:	6a 2e                	push   $0x2e
+  80150e:	68 cb 58 80 00       	push   $0x8058cb
+  801513:	e8 82 ed ff ff       	call   80029a <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  801518:	50                   	push   %eax
+  801519:	68 a4 58 80 00       	push   $0x8058a4
+  80151e:	6a 32                	push   $0x32
+  801520:	68 cb 58 80 00       	push   $0x8058cb
+  801525:	e8 70 ed ff ff       	call   80029a <_panic>
+		return 0;
+  80152a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80152f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801532:	5b                   	pop    %ebx
+  801533:	5e                   	pop    %esi
+  801534:	5d                   	pop    %ebp
+  801535:	c3                   	ret
+
+00801536 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  801536:	55                   	push   %ebp
+  801537:	89 e5                	mov    %esp,%ebp
+  801539:	57                   	push   %edi
+  80153a:	56                   	push   %esi
+  80153b:	53                   	push   %ebx
+  80153c:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  80153f:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  801546:	74 5d                	je     8015a5 <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  801548:	83 ec 0c             	sub    $0xc,%esp
+  80154b:	68 7c 14 80 00       	push   $0x80147c
+  801550:	e8 72 39 00 00       	call   804ec7 <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  801555:	e8 14 fb ff ff       	call   80106e <sys_fork>
+  80155a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80155d:	83 c4 10             	add    $0x10,%esp
+  801560:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  801563:	74 47                	je     8015ac <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  801565:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801569:	0f 84 c5 03 00 00    	je     801934 <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  80156f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801573:	78 25                	js     80159a <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  801575:	e8 03 20 00 00       	call   80357d <page_share_paged_out>
+  80157a:	85 c0                	test   %eax,%eax
+  80157c:	0f 88 d8 03 00 00    	js     80195a <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801582:	83 ec 08             	sub    $0x8,%esp
+  801585:	6a 02                	push   $0x2
+  801587:	ff 75 e4             	push   -0x1c(%ebp)
+  80158a:	e8 fe fa ff ff       	call   80108d <sys_env_set_status>
+  80158f:	83 c4 10             	add    $0x10,%esp
+  801592:	85 c0                	test   %eax,%eax
+  801594:	0f 88 d5 03 00 00    	js     80196f <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  80159a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80159d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a0:	5b                   	pop    %ebx
+  8015a1:	5e                   	pop    %esi
+  8015a2:	5f                   	pop    %edi
+  8015a3:	5d                   	pop    %ebp
+  8015a4:	c3                   	ret
+		init_map_dir();
+  8015a5:	e8 db 22 00 00       	call   803885 <init_map_dir>
+  8015aa:	eb 9c                	jmp    801548 <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8015ac:	b8 07 00 00 00       	mov    $0x7,%eax
+  8015b1:	cd 30                	int    $0x30
+  8015b3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  8015b6:	85 c0                	test   %eax,%eax
+  8015b8:	78 10                	js     8015ca <fork+0x94>
+	if (envid == 0)
+  8015ba:	0f 84 74 03 00 00    	je     801934 <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  8015c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8015c8:	eb 30                	jmp    8015fa <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  8015ca:	50                   	push   %eax
+  8015cb:	68 d6 58 80 00       	push   $0x8058d6
+  8015d0:	68 cd 00 00 00       	push   $0xcd
+  8015d5:	68 cb 58 80 00       	push   $0x8058cb
+  8015da:	e8 bb ec ff ff       	call   80029a <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  8015df:	89 f2                	mov    %esi,%edx
+  8015e1:	c1 fa 1f             	sar    $0x1f,%edx
+  8015e4:	c1 ea 16             	shr    $0x16,%edx
+  8015e7:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8015ea:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8015ef:	29 d0                	sub    %edx,%eax
+  8015f1:	ba 00 04 00 00       	mov    $0x400,%edx
+  8015f6:	29 c2                	sub    %eax,%edx
+  8015f8:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  8015fa:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8015fd:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801603:	0f 87 ff 02 00 00    	ja     801908 <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  801609:	89 f3                	mov    %esi,%ebx
+  80160b:	c1 e3 0c             	shl    $0xc,%ebx
+  80160e:	89 d8                	mov    %ebx,%eax
+  801610:	c1 e8 16             	shr    $0x16,%eax
+  801613:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80161a:	f6 c2 01             	test   $0x1,%dl
+  80161d:	74 c0                	je     8015df <fork+0xa9>
+  80161f:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801626:	f6 c2 04             	test   $0x4,%dl
+  801629:	74 b4                	je     8015df <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  80162b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801632:	a8 80                	test   $0x80,%al
+  801634:	75 24                	jne    80165a <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  801636:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  80163d:	25 81 00 00 00       	and    $0x81,%eax
+  801642:	3d 80 00 00 00       	cmp    $0x80,%eax
+  801647:	74 21                	je     80166a <fork+0x134>
+		if (!dupable(pn)) {
+  801649:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80164c:	e8 e2 fd ff ff       	call   801433 <dupable>
+  801651:	84 c0                	test   %al,%al
+  801653:	75 1a                	jne    80166f <fork+0x139>
+			++pn;
+  801655:	83 c6 01             	add    $0x1,%esi
+			continue;
+  801658:	eb a0                	jmp    8015fa <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  80165a:	83 ec 08             	sub    $0x8,%esp
+  80165d:	53                   	push   %ebx
+  80165e:	6a 00                	push   $0x0
+  801660:	e8 b1 f8 ff ff       	call   800f16 <sys_page_split>
+  801665:	83 c4 10             	add    $0x10,%esp
+  801668:	eb cc                	jmp    801636 <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  80166a:	0f b6 03             	movzbl (%ebx),%eax
+  80166d:	eb da                	jmp    801649 <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  80166f:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801672:	89 f8                	mov    %edi,%eax
+  801674:	e8 71 fd ff ff       	call   8013ea <dupperm>
+  801679:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80167c:	85 c0                	test   %eax,%eax
+  80167e:	74 16                	je     801696 <fork+0x160>
+  801680:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  801685:	29 f8                	sub    %edi,%eax
+  801687:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  80168a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80168f:	89 c6                	mov    %eax,%esi
+  801691:	e9 c4 01 00 00       	jmp    80185a <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  801696:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801699:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016a0:	f6 c4 04             	test   $0x4,%ah
+  8016a3:	0f 85 89 00 00 00    	jne    801732 <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  8016a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016ac:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016b3:	f6 c4 02             	test   $0x2,%ah
+  8016b6:	0f 85 b1 00 00 00    	jne    80176d <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  8016bc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8016bf:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8016c6:	a8 02                	test   $0x2,%al
+  8016c8:	75 10                	jne    8016da <fork+0x1a4>
+  8016ca:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8016d1:	f6 c4 08             	test   $0x8,%ah
+  8016d4:	0f 84 3e 01 00 00    	je     801818 <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  8016da:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8016dd:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8016e4:	25 00 06 00 00       	and    $0x600,%eax
+  8016e9:	0d 05 08 00 00       	or     $0x805,%eax
+  8016ee:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  8016f0:	c1 e1 0c             	shl    $0xc,%ecx
+  8016f3:	89 cb                	mov    %ecx,%ebx
+  8016f5:	83 ec 0c             	sub    $0xc,%esp
+  8016f8:	50                   	push   %eax
+  8016f9:	51                   	push   %ecx
+  8016fa:	ff 75 e4             	push   -0x1c(%ebp)
+  8016fd:	51                   	push   %ecx
+  8016fe:	6a 00                	push   $0x0
+  801700:	e8 61 2b 00 00       	call   804266 <page_map>
+  801705:	83 c4 20             	add    $0x20,%esp
+  801708:	85 c0                	test   %eax,%eax
+  80170a:	0f 88 e4 00 00 00    	js     8017f4 <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  801710:	83 ec 0c             	sub    $0xc,%esp
+  801713:	57                   	push   %edi
+  801714:	53                   	push   %ebx
+  801715:	6a 00                	push   $0x0
+  801717:	53                   	push   %ebx
+  801718:	6a 00                	push   $0x0
+  80171a:	e8 47 2b 00 00       	call   804266 <page_map>
+  80171f:	83 c4 20             	add    $0x20,%esp
+  801722:	85 c0                	test   %eax,%eax
+  801724:	0f 88 dc 00 00 00    	js     801806 <fork+0x2d0>
+			++pn;
+  80172a:	83 c6 01             	add    $0x1,%esi
+			continue;
+  80172d:	e9 c8 fe ff ff       	jmp    8015fa <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  801732:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801735:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80173c:	c1 e1 0c             	shl    $0xc,%ecx
+  80173f:	83 ec 0c             	sub    $0xc,%esp
+  801742:	25 07 0e 00 00       	and    $0xe07,%eax
+  801747:	50                   	push   %eax
+  801748:	51                   	push   %ecx
+  801749:	ff 75 e4             	push   -0x1c(%ebp)
+  80174c:	51                   	push   %ecx
+  80174d:	6a 00                	push   $0x0
+  80174f:	e8 12 2b 00 00       	call   804266 <page_map>
+  801754:	83 c4 20             	add    $0x20,%esp
+  801757:	85 c0                	test   %eax,%eax
+  801759:	79 cf                	jns    80172a <fork+0x1f4>
+			panic("page_map %d", r);
+  80175b:	50                   	push   %eax
+  80175c:	68 e6 58 80 00       	push   $0x8058e6
+  801761:	6a 4d                	push   $0x4d
+  801763:	68 cb 58 80 00       	push   $0x8058cb
+  801768:	e8 2d eb ff ff       	call   80029a <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  80176d:	83 ec 0c             	sub    $0xc,%esp
+  801770:	68 00 10 00 00       	push   $0x1000
+  801775:	e8 de 30 00 00       	call   804858 <malloc>
+  80177a:	89 c7                	mov    %eax,%edi
+  80177c:	83 c4 10             	add    $0x10,%esp
+  80177f:	85 c0                	test   %eax,%eax
+  801781:	74 4b                	je     8017ce <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  801783:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801786:	c1 e3 0c             	shl    $0xc,%ebx
+  801789:	83 ec 04             	sub    $0x4,%esp
+  80178c:	68 00 10 00 00       	push   $0x1000
+  801791:	53                   	push   %ebx
+  801792:	50                   	push   %eax
+  801793:	e8 ac f3 ff ff       	call   800b44 <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  801798:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80179b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017a2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017a7:	89 04 24             	mov    %eax,(%esp)
+  8017aa:	53                   	push   %ebx
+  8017ab:	ff 75 e4             	push   -0x1c(%ebp)
+  8017ae:	57                   	push   %edi
+  8017af:	6a 00                	push   $0x0
+  8017b1:	e8 b0 2a 00 00       	call   804266 <page_map>
+  8017b6:	83 c4 20             	add    $0x20,%esp
+  8017b9:	85 c0                	test   %eax,%eax
+  8017bb:	78 25                	js     8017e2 <fork+0x2ac>
+		free(temp);
+  8017bd:	83 ec 0c             	sub    $0xc,%esp
+  8017c0:	57                   	push   %edi
+  8017c1:	e8 90 2e 00 00       	call   804656 <free>
+  8017c6:	83 c4 10             	add    $0x10,%esp
+  8017c9:	e9 5c ff ff ff       	jmp    80172a <fork+0x1f4>
+			panic("malloc failed");
+  8017ce:	83 ec 04             	sub    $0x4,%esp
+  8017d1:	68 f2 58 80 00       	push   $0x8058f2
+  8017d6:	6a 56                	push   $0x56
+  8017d8:	68 cb 58 80 00       	push   $0x8058cb
+  8017dd:	e8 b8 ea ff ff       	call   80029a <_panic>
+			panic("page_map: %e", r);
+  8017e2:	50                   	push   %eax
+  8017e3:	68 00 59 80 00       	push   $0x805900
+  8017e8:	6a 59                	push   $0x59
+  8017ea:	68 cb 58 80 00       	push   $0x8058cb
+  8017ef:	e8 a6 ea ff ff       	call   80029a <_panic>
+			panic("page_map %d", r);
+  8017f4:	50                   	push   %eax
+  8017f5:	68 e6 58 80 00       	push   $0x8058e6
+  8017fa:	6a 65                	push   $0x65
+  8017fc:	68 cb 58 80 00       	push   $0x8058cb
+  801801:	e8 94 ea ff ff       	call   80029a <_panic>
+			panic("page_map %d", r);
+  801806:	50                   	push   %eax
+  801807:	68 e6 58 80 00       	push   $0x8058e6
+  80180c:	6a 78                	push   $0x78
+  80180e:	68 cb 58 80 00       	push   $0x8058cb
+  801813:	e8 82 ea ff ff       	call   80029a <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  801818:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80181b:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801822:	c1 e1 0c             	shl    $0xc,%ecx
+  801825:	83 ec 0c             	sub    $0xc,%esp
+  801828:	25 07 0e 00 00       	and    $0xe07,%eax
+  80182d:	50                   	push   %eax
+  80182e:	51                   	push   %ecx
+  80182f:	ff 75 e4             	push   -0x1c(%ebp)
+  801832:	51                   	push   %ecx
+  801833:	6a 00                	push   $0x0
+  801835:	e8 2c 2a 00 00       	call   804266 <page_map>
+  80183a:	83 c4 20             	add    $0x20,%esp
+  80183d:	85 c0                	test   %eax,%eax
+  80183f:	0f 89 e5 fe ff ff    	jns    80172a <fork+0x1f4>
+			panic("page_map %d", r);
+  801845:	50                   	push   %eax
+  801846:	68 e6 58 80 00       	push   $0x8058e6
+  80184b:	6a 7f                	push   $0x7f
+  80184d:	68 cb 58 80 00       	push   $0x8058cb
+  801852:	e8 43 ea ff ff       	call   80029a <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801857:	83 c7 01             	add    $0x1,%edi
+  80185a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80185d:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  801860:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  801863:	39 f7                	cmp    %esi,%edi
+  801865:	74 1c                	je     801883 <fork+0x34d>
+  801867:	89 d8                	mov    %ebx,%eax
+  801869:	e8 c5 fb ff ff       	call   801433 <dupable>
+  80186e:	84 c0                	test   %al,%al
+  801870:	74 7c                	je     8018ee <fork+0x3b8>
+  801872:	89 d8                	mov    %ebx,%eax
+  801874:	e8 71 fb ff ff       	call   8013ea <dupperm>
+  801879:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  80187c:	74 d9                	je     801857 <fork+0x321>
+  80187e:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801881:	eb 06                	jmp    801889 <fork+0x353>
+  801883:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801886:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  801889:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80188c:	c1 e0 0c             	shl    $0xc,%eax
+  80188f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801892:	83 ec 08             	sub    $0x8,%esp
+  801895:	ff 75 dc             	push   -0x24(%ebp)
+  801898:	57                   	push   %edi
+  801899:	50                   	push   %eax
+  80189a:	ff 75 e4             	push   -0x1c(%ebp)
+  80189d:	50                   	push   %eax
+  80189e:	6a 00                	push   $0x0
+  8018a0:	e8 b8 2b 00 00       	call   80445d <page_map_range>
+  8018a5:	83 c4 20             	add    $0x20,%esp
+  8018a8:	85 c0                	test   %eax,%eax
+  8018aa:	78 47                	js     8018f3 <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  8018ac:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  8018b3:	0f 84 41 fd ff ff    	je     8015fa <fork+0xc4>
+  8018b9:	83 ec 08             	sub    $0x8,%esp
+  8018bc:	ff 75 dc             	push   -0x24(%ebp)
+  8018bf:	57                   	push   %edi
+  8018c0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018c3:	50                   	push   %eax
+  8018c4:	6a 00                	push   $0x0
+  8018c6:	50                   	push   %eax
+  8018c7:	6a 00                	push   $0x0
+  8018c9:	e8 8f 2b 00 00       	call   80445d <page_map_range>
+  8018ce:	83 c4 20             	add    $0x20,%esp
+  8018d1:	85 c0                	test   %eax,%eax
+  8018d3:	0f 89 21 fd ff ff    	jns    8015fa <fork+0xc4>
+		panic("page_map_range %e", r);
+  8018d9:	50                   	push   %eax
+  8018da:	68 0d 59 80 00       	push   $0x80590d
+  8018df:	68 a2 00 00 00       	push   $0xa2
+  8018e4:	68 cb 58 80 00       	push   $0x8058cb
+  8018e9:	e8 ac e9 ff ff       	call   80029a <_panic>
+  8018ee:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8018f1:	eb 96                	jmp    801889 <fork+0x353>
+		panic("page_map_range %e", r);
+  8018f3:	50                   	push   %eax
+  8018f4:	68 0d 59 80 00       	push   $0x80590d
+  8018f9:	68 a0 00 00 00       	push   $0xa0
+  8018fe:	68 cb 58 80 00       	push   $0x8058cb
+  801903:	e8 92 e9 ff ff       	call   80029a <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  801908:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  80190b:	6a 01                	push   $0x1
+  80190d:	6a 07                	push   $0x7
+  80190f:	68 00 f0 bf ee       	push   $0xeebff000
+  801914:	53                   	push   %ebx
+  801915:	e8 eb 22 00 00       	call   803c05 <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  80191a:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80191f:	8b 40 74             	mov    0x74(%eax),%eax
+  801922:	83 c4 08             	add    $0x8,%esp
+  801925:	50                   	push   %eax
+  801926:	53                   	push   %ebx
+  801927:	e8 89 f8 ff ff       	call   8011b5 <sys_env_set_pgfault_upcall>
+  80192c:	83 c4 10             	add    $0x10,%esp
+  80192f:	e9 41 fc ff ff       	jmp    801575 <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801934:	e8 d8 f4 ff ff       	call   800e11 <sys_getenvid>
+  801939:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80193e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801941:	c1 e0 06             	shl    $0x6,%eax
+  801944:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801949:	a3 18 f9 80 00       	mov    %eax,0x80f918
+		return 0;
+  80194e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801955:	e9 40 fc ff ff       	jmp    80159a <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  80195a:	50                   	push   %eax
+  80195b:	68 1f 59 80 00       	push   $0x80591f
+  801960:	68 27 01 00 00       	push   $0x127
+  801965:	68 cb 58 80 00       	push   $0x8058cb
+  80196a:	e8 2b e9 ff ff       	call   80029a <_panic>
+		panic("sys_env_set_status: %d", r);
+  80196f:	50                   	push   %eax
+  801970:	68 38 59 80 00       	push   $0x805938
+  801975:	68 2b 01 00 00       	push   $0x12b
+  80197a:	68 cb 58 80 00       	push   $0x8058cb
+  80197f:	e8 16 e9 ff ff       	call   80029a <_panic>
+
+00801984 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801984:	55                   	push   %ebp
+  801985:	89 e5                	mov    %esp,%ebp
+  801987:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80198a:	68 4f 59 80 00       	push   $0x80594f
+  80198f:	68 35 01 00 00       	push   $0x135
+  801994:	68 cb 58 80 00       	push   $0x8058cb
+  801999:	e8 fc e8 ff ff       	call   80029a <_panic>
+
+0080199e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80199e:	55                   	push   %ebp
+  80199f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a4:	05 00 00 00 30       	add    $0x30000000,%eax
+  8019a9:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8019ac:	5d                   	pop    %ebp
+  8019ad:	c3                   	ret
+
+008019ae <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8019ae:	55                   	push   %ebp
+  8019af:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b4:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8019b9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8019be:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8019c3:	5d                   	pop    %ebp
+  8019c4:	c3                   	ret
+
+008019c5 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8019c5:	55                   	push   %ebp
+  8019c6:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8019c8:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8019cd:	a8 01                	test   $0x1,%al
+  8019cf:	74 3c                	je     801a0d <fd_alloc+0x48>
+  8019d1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8019d6:	89 c2                	mov    %eax,%edx
+  8019d8:	c1 ea 0c             	shr    $0xc,%edx
+  8019db:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019e2:	89 c1                	mov    %eax,%ecx
+  8019e4:	05 00 10 00 00       	add    $0x1000,%eax
+  8019e9:	f6 c2 01             	test   $0x1,%dl
+  8019ec:	74 13                	je     801a01 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8019ee:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8019f3:	75 e1                	jne    8019d6 <fd_alloc+0x11>
+  8019f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8019fa:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8019ff:	eb 05                	jmp    801a06 <fd_alloc+0x41>
+			return 0;
+  801a01:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801a06:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a09:	89 0a                	mov    %ecx,(%edx)
+}
+  801a0b:	5d                   	pop    %ebp
+  801a0c:	c3                   	ret
+  801a0d:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801a12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a17:	eb ed                	jmp    801a06 <fd_alloc+0x41>
+
+00801a19 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801a19:	55                   	push   %ebp
+  801a1a:	89 e5                	mov    %esp,%ebp
+  801a1c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801a1f:	83 f8 1f             	cmp    $0x1f,%eax
+  801a22:	77 30                	ja     801a54 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801a24:	c1 e0 0c             	shl    $0xc,%eax
+  801a27:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801a2c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801a32:	f6 c2 01             	test   $0x1,%dl
+  801a35:	74 24                	je     801a5b <fd_lookup+0x42>
+  801a37:	89 c2                	mov    %eax,%edx
+  801a39:	c1 ea 0c             	shr    $0xc,%edx
+  801a3c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a43:	f6 c2 01             	test   $0x1,%dl
+  801a46:	74 1a                	je     801a62 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801a48:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a4b:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a52:	5d                   	pop    %ebp
+  801a53:	c3                   	ret
+		return -E_INVAL;
+  801a54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a59:	eb f7                	jmp    801a52 <fd_lookup+0x39>
+		return -E_INVAL;
+  801a5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a60:	eb f0                	jmp    801a52 <fd_lookup+0x39>
+  801a62:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a67:	eb e9                	jmp    801a52 <fd_lookup+0x39>
+
+00801a69 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801a69:	55                   	push   %ebp
+  801a6a:	89 e5                	mov    %esp,%ebp
+  801a6c:	53                   	push   %ebx
+  801a6d:	83 ec 04             	sub    $0x4,%esp
+  801a70:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801a73:	b8 e4 59 80 00       	mov    $0x8059e4,%eax
+  801a78:	8b 18                	mov    (%eax),%ebx
+  801a7a:	85 db                	test   %ebx,%ebx
+  801a7c:	74 0e                	je     801a8c <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801a7e:	83 c0 04             	add    $0x4,%eax
+  801a81:	39 13                	cmp    %edx,(%ebx)
+  801a83:	75 f3                	jne    801a78 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801a85:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a8a:	eb 1f                	jmp    801aab <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a8c:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801a91:	8b 40 48             	mov    0x48(%eax),%eax
+  801a94:	83 ec 04             	sub    $0x4,%esp
+  801a97:	52                   	push   %edx
+  801a98:	50                   	push   %eax
+  801a99:	68 68 59 80 00       	push   $0x805968
+  801a9e:	e8 d2 e8 ff ff       	call   800375 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801aa3:	83 c4 10             	add    $0x10,%esp
+  801aa6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801aab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801aae:	89 1a                	mov    %ebx,(%edx)
+}
+  801ab0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ab3:	c9                   	leave
+  801ab4:	c3                   	ret
+
+00801ab5 <fd_close>:
+{
+  801ab5:	55                   	push   %ebp
+  801ab6:	89 e5                	mov    %esp,%ebp
+  801ab8:	57                   	push   %edi
+  801ab9:	56                   	push   %esi
+  801aba:	53                   	push   %ebx
+  801abb:	83 ec 24             	sub    $0x24,%esp
+  801abe:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ac1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ac4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ac7:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ac8:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801ace:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ad1:	50                   	push   %eax
+  801ad2:	e8 42 ff ff ff       	call   801a19 <fd_lookup>
+  801ad7:	89 c3                	mov    %eax,%ebx
+  801ad9:	83 c4 10             	add    $0x10,%esp
+  801adc:	85 c0                	test   %eax,%eax
+  801ade:	78 05                	js     801ae5 <fd_close+0x30>
+	    || fd != fd2)
+  801ae0:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ae3:	74 16                	je     801afb <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801ae5:	89 f8                	mov    %edi,%eax
+  801ae7:	84 c0                	test   %al,%al
+  801ae9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aee:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801af1:	89 d8                	mov    %ebx,%eax
+  801af3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801af6:	5b                   	pop    %ebx
+  801af7:	5e                   	pop    %esi
+  801af8:	5f                   	pop    %edi
+  801af9:	5d                   	pop    %ebp
+  801afa:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801afb:	83 ec 08             	sub    $0x8,%esp
+  801afe:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b01:	50                   	push   %eax
+  801b02:	ff 36                	push   (%esi)
+  801b04:	e8 60 ff ff ff       	call   801a69 <dev_lookup>
+  801b09:	89 c3                	mov    %eax,%ebx
+  801b0b:	83 c4 10             	add    $0x10,%esp
+  801b0e:	85 c0                	test   %eax,%eax
+  801b10:	78 1a                	js     801b2c <fd_close+0x77>
+		if (dev->dev_close)
+  801b12:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b15:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801b18:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	74 0b                	je     801b2c <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801b21:	83 ec 0c             	sub    $0xc,%esp
+  801b24:	56                   	push   %esi
+  801b25:	ff d0                	call   *%eax
+  801b27:	89 c3                	mov    %eax,%ebx
+  801b29:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801b2c:	83 ec 08             	sub    $0x8,%esp
+  801b2f:	56                   	push   %esi
+  801b30:	6a 00                	push   $0x0
+  801b32:	e8 9d f3 ff ff       	call   800ed4 <sys_page_unmap>
+	return r;
+  801b37:	83 c4 10             	add    $0x10,%esp
+  801b3a:	eb b5                	jmp    801af1 <fd_close+0x3c>
+
+00801b3c <close>:
+
+int
+close(int fdnum)
+{
+  801b3c:	55                   	push   %ebp
+  801b3d:	89 e5                	mov    %esp,%ebp
+  801b3f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b42:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b45:	50                   	push   %eax
+  801b46:	ff 75 08             	push   0x8(%ebp)
+  801b49:	e8 cb fe ff ff       	call   801a19 <fd_lookup>
+  801b4e:	83 c4 10             	add    $0x10,%esp
+  801b51:	85 c0                	test   %eax,%eax
+  801b53:	79 02                	jns    801b57 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801b55:	c9                   	leave
+  801b56:	c3                   	ret
+		return fd_close(fd, 1);
+  801b57:	83 ec 08             	sub    $0x8,%esp
+  801b5a:	6a 01                	push   $0x1
+  801b5c:	ff 75 f4             	push   -0xc(%ebp)
+  801b5f:	e8 51 ff ff ff       	call   801ab5 <fd_close>
+  801b64:	83 c4 10             	add    $0x10,%esp
+  801b67:	eb ec                	jmp    801b55 <close+0x19>
+
+00801b69 <close_all>:
+
+void
+close_all(void)
+{
+  801b69:	55                   	push   %ebp
+  801b6a:	89 e5                	mov    %esp,%ebp
+  801b6c:	53                   	push   %ebx
+  801b6d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801b70:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801b75:	83 ec 0c             	sub    $0xc,%esp
+  801b78:	53                   	push   %ebx
+  801b79:	e8 be ff ff ff       	call   801b3c <close>
+	for (i = 0; i < MAXFD; i++)
+  801b7e:	83 c3 01             	add    $0x1,%ebx
+  801b81:	83 c4 10             	add    $0x10,%esp
+  801b84:	83 fb 20             	cmp    $0x20,%ebx
+  801b87:	75 ec                	jne    801b75 <close_all+0xc>
+}
+  801b89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b8c:	c9                   	leave
+  801b8d:	c3                   	ret
+
+00801b8e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801b8e:	55                   	push   %ebp
+  801b8f:	89 e5                	mov    %esp,%ebp
+  801b91:	57                   	push   %edi
+  801b92:	56                   	push   %esi
+  801b93:	53                   	push   %ebx
+  801b94:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801b97:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b9a:	50                   	push   %eax
+  801b9b:	ff 75 08             	push   0x8(%ebp)
+  801b9e:	e8 76 fe ff ff       	call   801a19 <fd_lookup>
+  801ba3:	89 c3                	mov    %eax,%ebx
+  801ba5:	83 c4 10             	add    $0x10,%esp
+  801ba8:	85 c0                	test   %eax,%eax
+  801baa:	78 7f                	js     801c2b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801bac:	83 ec 0c             	sub    $0xc,%esp
+  801baf:	ff 75 0c             	push   0xc(%ebp)
+  801bb2:	e8 85 ff ff ff       	call   801b3c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801bb7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801bba:	c1 e6 0c             	shl    $0xc,%esi
+  801bbd:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801bc3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801bc6:	89 3c 24             	mov    %edi,(%esp)
+  801bc9:	e8 e0 fd ff ff       	call   8019ae <fd2data>
+  801bce:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801bd0:	89 34 24             	mov    %esi,(%esp)
+  801bd3:	e8 d6 fd ff ff       	call   8019ae <fd2data>
+  801bd8:	83 c4 10             	add    $0x10,%esp
+  801bdb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801bde:	89 d8                	mov    %ebx,%eax
+  801be0:	c1 e8 16             	shr    $0x16,%eax
+  801be3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801bea:	a8 01                	test   $0x1,%al
+  801bec:	74 11                	je     801bff <dup+0x71>
+  801bee:	89 d8                	mov    %ebx,%eax
+  801bf0:	c1 e8 0c             	shr    $0xc,%eax
+  801bf3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801bfa:	f6 c2 01             	test   $0x1,%dl
+  801bfd:	75 36                	jne    801c35 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801bff:	89 f8                	mov    %edi,%eax
+  801c01:	c1 e8 0c             	shr    $0xc,%eax
+  801c04:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c0b:	83 ec 0c             	sub    $0xc,%esp
+  801c0e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c13:	50                   	push   %eax
+  801c14:	56                   	push   %esi
+  801c15:	6a 00                	push   $0x0
+  801c17:	57                   	push   %edi
+  801c18:	6a 00                	push   $0x0
+  801c1a:	e8 73 f2 ff ff       	call   800e92 <sys_page_map>
+  801c1f:	89 c3                	mov    %eax,%ebx
+  801c21:	83 c4 20             	add    $0x20,%esp
+  801c24:	85 c0                	test   %eax,%eax
+  801c26:	78 33                	js     801c5b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801c28:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801c2b:	89 d8                	mov    %ebx,%eax
+  801c2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c30:	5b                   	pop    %ebx
+  801c31:	5e                   	pop    %esi
+  801c32:	5f                   	pop    %edi
+  801c33:	5d                   	pop    %ebp
+  801c34:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801c35:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c3c:	83 ec 0c             	sub    $0xc,%esp
+  801c3f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c44:	50                   	push   %eax
+  801c45:	ff 75 d4             	push   -0x2c(%ebp)
+  801c48:	6a 00                	push   $0x0
+  801c4a:	53                   	push   %ebx
+  801c4b:	6a 00                	push   $0x0
+  801c4d:	e8 40 f2 ff ff       	call   800e92 <sys_page_map>
+  801c52:	89 c3                	mov    %eax,%ebx
+  801c54:	83 c4 20             	add    $0x20,%esp
+  801c57:	85 c0                	test   %eax,%eax
+  801c59:	79 a4                	jns    801bff <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801c5b:	83 ec 08             	sub    $0x8,%esp
+  801c5e:	56                   	push   %esi
+  801c5f:	6a 00                	push   $0x0
+  801c61:	e8 6e f2 ff ff       	call   800ed4 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801c66:	83 c4 08             	add    $0x8,%esp
+  801c69:	ff 75 d4             	push   -0x2c(%ebp)
+  801c6c:	6a 00                	push   $0x0
+  801c6e:	e8 61 f2 ff ff       	call   800ed4 <sys_page_unmap>
+	return r;
+  801c73:	83 c4 10             	add    $0x10,%esp
+  801c76:	eb b3                	jmp    801c2b <dup+0x9d>
+
+00801c78 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801c78:	55                   	push   %ebp
+  801c79:	89 e5                	mov    %esp,%ebp
+  801c7b:	56                   	push   %esi
+  801c7c:	53                   	push   %ebx
+  801c7d:	83 ec 18             	sub    $0x18,%esp
+  801c80:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c83:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c86:	50                   	push   %eax
+  801c87:	56                   	push   %esi
+  801c88:	e8 8c fd ff ff       	call   801a19 <fd_lookup>
+  801c8d:	83 c4 10             	add    $0x10,%esp
+  801c90:	85 c0                	test   %eax,%eax
+  801c92:	78 3c                	js     801cd0 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c94:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801c97:	83 ec 08             	sub    $0x8,%esp
+  801c9a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c9d:	50                   	push   %eax
+  801c9e:	ff 33                	push   (%ebx)
+  801ca0:	e8 c4 fd ff ff       	call   801a69 <dev_lookup>
+  801ca5:	83 c4 10             	add    $0x10,%esp
+  801ca8:	85 c0                	test   %eax,%eax
+  801caa:	78 24                	js     801cd0 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cac:	8b 43 08             	mov    0x8(%ebx),%eax
+  801caf:	83 e0 03             	and    $0x3,%eax
+  801cb2:	83 f8 01             	cmp    $0x1,%eax
+  801cb5:	74 20                	je     801cd7 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801cb7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cba:	8b 40 08             	mov    0x8(%eax),%eax
+  801cbd:	85 c0                	test   %eax,%eax
+  801cbf:	74 37                	je     801cf8 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801cc1:	83 ec 04             	sub    $0x4,%esp
+  801cc4:	ff 75 10             	push   0x10(%ebp)
+  801cc7:	ff 75 0c             	push   0xc(%ebp)
+  801cca:	53                   	push   %ebx
+  801ccb:	ff d0                	call   *%eax
+  801ccd:	83 c4 10             	add    $0x10,%esp
+}
+  801cd0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cd3:	5b                   	pop    %ebx
+  801cd4:	5e                   	pop    %esi
+  801cd5:	5d                   	pop    %ebp
+  801cd6:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cd7:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801cdc:	8b 40 48             	mov    0x48(%eax),%eax
+  801cdf:	83 ec 04             	sub    $0x4,%esp
+  801ce2:	56                   	push   %esi
+  801ce3:	50                   	push   %eax
+  801ce4:	68 a9 59 80 00       	push   $0x8059a9
+  801ce9:	e8 87 e6 ff ff       	call   800375 <cprintf>
+		return -E_INVAL;
+  801cee:	83 c4 10             	add    $0x10,%esp
+  801cf1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cf6:	eb d8                	jmp    801cd0 <read+0x58>
+		return -E_NOT_SUPP;
+  801cf8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cfd:	eb d1                	jmp    801cd0 <read+0x58>
+
+00801cff <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801cff:	55                   	push   %ebp
+  801d00:	89 e5                	mov    %esp,%ebp
+  801d02:	57                   	push   %edi
+  801d03:	56                   	push   %esi
+  801d04:	53                   	push   %ebx
+  801d05:	83 ec 0c             	sub    $0xc,%esp
+  801d08:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d0b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801d0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d13:	eb 02                	jmp    801d17 <readn+0x18>
+  801d15:	01 c3                	add    %eax,%ebx
+  801d17:	39 f3                	cmp    %esi,%ebx
+  801d19:	73 21                	jae    801d3c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d1b:	83 ec 04             	sub    $0x4,%esp
+  801d1e:	89 f0                	mov    %esi,%eax
+  801d20:	29 d8                	sub    %ebx,%eax
+  801d22:	50                   	push   %eax
+  801d23:	89 d8                	mov    %ebx,%eax
+  801d25:	03 45 0c             	add    0xc(%ebp),%eax
+  801d28:	50                   	push   %eax
+  801d29:	57                   	push   %edi
+  801d2a:	e8 49 ff ff ff       	call   801c78 <read>
+		if (m < 0)
+  801d2f:	83 c4 10             	add    $0x10,%esp
+  801d32:	85 c0                	test   %eax,%eax
+  801d34:	78 04                	js     801d3a <readn+0x3b>
+			return m;
+		if (m == 0)
+  801d36:	75 dd                	jne    801d15 <readn+0x16>
+  801d38:	eb 02                	jmp    801d3c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d3a:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801d3c:	89 d8                	mov    %ebx,%eax
+  801d3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d41:	5b                   	pop    %ebx
+  801d42:	5e                   	pop    %esi
+  801d43:	5f                   	pop    %edi
+  801d44:	5d                   	pop    %ebp
+  801d45:	c3                   	ret
+
+00801d46 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801d46:	55                   	push   %ebp
+  801d47:	89 e5                	mov    %esp,%ebp
+  801d49:	56                   	push   %esi
+  801d4a:	53                   	push   %ebx
+  801d4b:	83 ec 18             	sub    $0x18,%esp
+  801d4e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d51:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d54:	50                   	push   %eax
+  801d55:	53                   	push   %ebx
+  801d56:	e8 be fc ff ff       	call   801a19 <fd_lookup>
+  801d5b:	83 c4 10             	add    $0x10,%esp
+  801d5e:	85 c0                	test   %eax,%eax
+  801d60:	78 37                	js     801d99 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d62:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d65:	83 ec 08             	sub    $0x8,%esp
+  801d68:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d6b:	50                   	push   %eax
+  801d6c:	ff 36                	push   (%esi)
+  801d6e:	e8 f6 fc ff ff       	call   801a69 <dev_lookup>
+  801d73:	83 c4 10             	add    $0x10,%esp
+  801d76:	85 c0                	test   %eax,%eax
+  801d78:	78 1f                	js     801d99 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d7a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d7e:	74 20                	je     801da0 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801d80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d83:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d86:	85 c0                	test   %eax,%eax
+  801d88:	74 37                	je     801dc1 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801d8a:	83 ec 04             	sub    $0x4,%esp
+  801d8d:	ff 75 10             	push   0x10(%ebp)
+  801d90:	ff 75 0c             	push   0xc(%ebp)
+  801d93:	56                   	push   %esi
+  801d94:	ff d0                	call   *%eax
+  801d96:	83 c4 10             	add    $0x10,%esp
+}
+  801d99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d9c:	5b                   	pop    %ebx
+  801d9d:	5e                   	pop    %esi
+  801d9e:	5d                   	pop    %ebp
+  801d9f:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801da0:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801da5:	8b 40 48             	mov    0x48(%eax),%eax
+  801da8:	83 ec 04             	sub    $0x4,%esp
+  801dab:	53                   	push   %ebx
+  801dac:	50                   	push   %eax
+  801dad:	68 c5 59 80 00       	push   $0x8059c5
+  801db2:	e8 be e5 ff ff       	call   800375 <cprintf>
+		return -E_INVAL;
+  801db7:	83 c4 10             	add    $0x10,%esp
+  801dba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dbf:	eb d8                	jmp    801d99 <write+0x53>
+		return -E_NOT_SUPP;
+  801dc1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dc6:	eb d1                	jmp    801d99 <write+0x53>
+
+00801dc8 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801dc8:	55                   	push   %ebp
+  801dc9:	89 e5                	mov    %esp,%ebp
+  801dcb:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801dce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dd1:	50                   	push   %eax
+  801dd2:	ff 75 08             	push   0x8(%ebp)
+  801dd5:	e8 3f fc ff ff       	call   801a19 <fd_lookup>
+  801dda:	83 c4 10             	add    $0x10,%esp
+  801ddd:	85 c0                	test   %eax,%eax
+  801ddf:	78 0e                	js     801def <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801de1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801de4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801de7:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801dea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801def:	c9                   	leave
+  801df0:	c3                   	ret
+
+00801df1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801df1:	55                   	push   %ebp
+  801df2:	89 e5                	mov    %esp,%ebp
+  801df4:	56                   	push   %esi
+  801df5:	53                   	push   %ebx
+  801df6:	83 ec 18             	sub    $0x18,%esp
+  801df9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dfc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dff:	50                   	push   %eax
+  801e00:	53                   	push   %ebx
+  801e01:	e8 13 fc ff ff       	call   801a19 <fd_lookup>
+  801e06:	83 c4 10             	add    $0x10,%esp
+  801e09:	85 c0                	test   %eax,%eax
+  801e0b:	78 34                	js     801e41 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e0d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e10:	83 ec 08             	sub    $0x8,%esp
+  801e13:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e16:	50                   	push   %eax
+  801e17:	ff 36                	push   (%esi)
+  801e19:	e8 4b fc ff ff       	call   801a69 <dev_lookup>
+  801e1e:	83 c4 10             	add    $0x10,%esp
+  801e21:	85 c0                	test   %eax,%eax
+  801e23:	78 1c                	js     801e41 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e25:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e29:	74 1d                	je     801e48 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801e2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e2e:	8b 40 18             	mov    0x18(%eax),%eax
+  801e31:	85 c0                	test   %eax,%eax
+  801e33:	74 34                	je     801e69 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801e35:	83 ec 08             	sub    $0x8,%esp
+  801e38:	ff 75 0c             	push   0xc(%ebp)
+  801e3b:	56                   	push   %esi
+  801e3c:	ff d0                	call   *%eax
+  801e3e:	83 c4 10             	add    $0x10,%esp
+}
+  801e41:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e44:	5b                   	pop    %ebx
+  801e45:	5e                   	pop    %esi
+  801e46:	5d                   	pop    %ebp
+  801e47:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801e48:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801e4d:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e50:	83 ec 04             	sub    $0x4,%esp
+  801e53:	53                   	push   %ebx
+  801e54:	50                   	push   %eax
+  801e55:	68 88 59 80 00       	push   $0x805988
+  801e5a:	e8 16 e5 ff ff       	call   800375 <cprintf>
+		return -E_INVAL;
+  801e5f:	83 c4 10             	add    $0x10,%esp
+  801e62:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e67:	eb d8                	jmp    801e41 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801e69:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e6e:	eb d1                	jmp    801e41 <ftruncate+0x50>
+
+00801e70 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801e70:	55                   	push   %ebp
+  801e71:	89 e5                	mov    %esp,%ebp
+  801e73:	56                   	push   %esi
+  801e74:	53                   	push   %ebx
+  801e75:	83 ec 18             	sub    $0x18,%esp
+  801e78:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e7b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e7e:	50                   	push   %eax
+  801e7f:	ff 75 08             	push   0x8(%ebp)
+  801e82:	e8 92 fb ff ff       	call   801a19 <fd_lookup>
+  801e87:	83 c4 10             	add    $0x10,%esp
+  801e8a:	85 c0                	test   %eax,%eax
+  801e8c:	78 49                	js     801ed7 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e8e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e91:	83 ec 08             	sub    $0x8,%esp
+  801e94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e97:	50                   	push   %eax
+  801e98:	ff 36                	push   (%esi)
+  801e9a:	e8 ca fb ff ff       	call   801a69 <dev_lookup>
+  801e9f:	83 c4 10             	add    $0x10,%esp
+  801ea2:	85 c0                	test   %eax,%eax
+  801ea4:	78 31                	js     801ed7 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801ea6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ea9:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801ead:	74 2f                	je     801ede <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801eaf:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801eb2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801eb9:	00 00 00 
+	stat->st_isdir = 0;
+  801ebc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ec3:	00 00 00 
+	stat->st_dev = dev;
+  801ec6:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801ecc:	83 ec 08             	sub    $0x8,%esp
+  801ecf:	53                   	push   %ebx
+  801ed0:	56                   	push   %esi
+  801ed1:	ff 50 14             	call   *0x14(%eax)
+  801ed4:	83 c4 10             	add    $0x10,%esp
+}
+  801ed7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eda:	5b                   	pop    %ebx
+  801edb:	5e                   	pop    %esi
+  801edc:	5d                   	pop    %ebp
+  801edd:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ede:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ee3:	eb f2                	jmp    801ed7 <fstat+0x67>
+
+00801ee5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801ee5:	55                   	push   %ebp
+  801ee6:	89 e5                	mov    %esp,%ebp
+  801ee8:	56                   	push   %esi
+  801ee9:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801eea:	83 ec 08             	sub    $0x8,%esp
+  801eed:	6a 00                	push   $0x0
+  801eef:	ff 75 08             	push   0x8(%ebp)
+  801ef2:	e8 bc 02 00 00       	call   8021b3 <open>
+  801ef7:	89 c3                	mov    %eax,%ebx
+  801ef9:	83 c4 10             	add    $0x10,%esp
+  801efc:	85 c0                	test   %eax,%eax
+  801efe:	78 1b                	js     801f1b <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801f00:	83 ec 08             	sub    $0x8,%esp
+  801f03:	ff 75 0c             	push   0xc(%ebp)
+  801f06:	50                   	push   %eax
+  801f07:	e8 64 ff ff ff       	call   801e70 <fstat>
+  801f0c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801f0e:	89 1c 24             	mov    %ebx,(%esp)
+  801f11:	e8 26 fc ff ff       	call   801b3c <close>
+	return r;
+  801f16:	83 c4 10             	add    $0x10,%esp
+  801f19:	89 f3                	mov    %esi,%ebx
+}
+  801f1b:	89 d8                	mov    %ebx,%eax
+  801f1d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f20:	5b                   	pop    %ebx
+  801f21:	5e                   	pop    %esi
+  801f22:	5d                   	pop    %ebp
+  801f23:	c3                   	ret
+
+00801f24 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801f24:	55                   	push   %ebp
+  801f25:	89 e5                	mov    %esp,%ebp
+  801f27:	57                   	push   %edi
+  801f28:	56                   	push   %esi
+  801f29:	53                   	push   %ebx
+  801f2a:	83 ec 0c             	sub    $0xc,%esp
+  801f2d:	89 c7                	mov    %eax,%edi
+  801f2f:	89 d3                	mov    %edx,%ebx
+  801f31:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801f33:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  801f3a:	74 2d                	je     801f69 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801f3c:	6a 07                	push   $0x7
+  801f3e:	68 00 00 81 00       	push   $0x810000
+  801f43:	57                   	push   %edi
+  801f44:	ff 35 00 80 80 00    	push   0x808000
+  801f4a:	e8 4e 31 00 00       	call   80509d <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801f4f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801f56:	6a 00                	push   $0x0
+  801f58:	56                   	push   %esi
+  801f59:	53                   	push   %ebx
+  801f5a:	6a 00                	push   $0x0
+  801f5c:	e8 ee 2f 00 00       	call   804f4f <ipc_recv_pages>
+}
+  801f61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f64:	5b                   	pop    %ebx
+  801f65:	5e                   	pop    %esi
+  801f66:	5f                   	pop    %edi
+  801f67:	5d                   	pop    %ebp
+  801f68:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f69:	83 ec 0c             	sub    $0xc,%esp
+  801f6c:	6a 01                	push   $0x1
+  801f6e:	e8 1f 32 00 00       	call   805192 <ipc_find_env>
+  801f73:	a3 00 80 80 00       	mov    %eax,0x808000
+  801f78:	83 c4 10             	add    $0x10,%esp
+  801f7b:	eb bf                	jmp    801f3c <fsipc_pages+0x18>
+
+00801f7d <fsipc>:
+{
+  801f7d:	55                   	push   %ebp
+  801f7e:	89 e5                	mov    %esp,%ebp
+  801f80:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801f83:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f88:	e8 97 ff ff ff       	call   801f24 <fsipc_pages>
+}
+  801f8d:	c9                   	leave
+  801f8e:	c3                   	ret
+
+00801f8f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801f8f:	55                   	push   %ebp
+  801f90:	89 e5                	mov    %esp,%ebp
+  801f92:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f95:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f98:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f9b:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.set_size.req_size = newsize;
+  801fa0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fa3:	a3 04 00 81 00       	mov    %eax,0x810004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801fa8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fad:	b8 02 00 00 00       	mov    $0x2,%eax
+  801fb2:	e8 c6 ff ff ff       	call   801f7d <fsipc>
+}
+  801fb7:	c9                   	leave
+  801fb8:	c3                   	ret
+
+00801fb9 <devfile_flush>:
+{
+  801fb9:	55                   	push   %ebp
+  801fba:	89 e5                	mov    %esp,%ebp
+  801fbc:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801fbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fc2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fc5:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801fca:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fcf:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fd4:	e8 a4 ff ff ff       	call   801f7d <fsipc>
+}
+  801fd9:	c9                   	leave
+  801fda:	c3                   	ret
+
+00801fdb <devfile_stat>:
+{
+  801fdb:	55                   	push   %ebp
+  801fdc:	89 e5                	mov    %esp,%ebp
+  801fde:	53                   	push   %ebx
+  801fdf:	83 ec 04             	sub    $0x4,%esp
+  801fe2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801fe5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801feb:	a3 00 00 81 00       	mov    %eax,0x810000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801ff0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff5:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ffa:	e8 7e ff ff ff       	call   801f7d <fsipc>
+  801fff:	85 c0                	test   %eax,%eax
+  802001:	78 2c                	js     80202f <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802003:	83 ec 08             	sub    $0x8,%esp
+  802006:	68 00 00 81 00       	push   $0x810000
+  80200b:	53                   	push   %ebx
+  80200c:	e8 4b e9 ff ff       	call   80095c <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802011:	a1 80 00 81 00       	mov    0x810080,%eax
+  802016:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80201c:	a1 84 00 81 00       	mov    0x810084,%eax
+  802021:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802027:	83 c4 10             	add    $0x10,%esp
+  80202a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80202f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802032:	c9                   	leave
+  802033:	c3                   	ret
+
+00802034 <devfile_write>:
+{
+  802034:	55                   	push   %ebp
+  802035:	89 e5                	mov    %esp,%ebp
+  802037:	83 ec 0c             	sub    $0xc,%esp
+  80203a:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80203d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802042:	39 d0                	cmp    %edx,%eax
+  802044:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802047:	8b 55 08             	mov    0x8(%ebp),%edx
+  80204a:	8b 52 0c             	mov    0xc(%edx),%edx
+  80204d:	89 15 00 00 81 00    	mov    %edx,0x810000
+	fsipcbuf.write.req_n = n;
+  802053:	a3 04 00 81 00       	mov    %eax,0x810004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  802058:	50                   	push   %eax
+  802059:	ff 75 0c             	push   0xc(%ebp)
+  80205c:	68 08 00 81 00       	push   $0x810008
+  802061:	e8 7c ea ff ff       	call   800ae2 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  802066:	ba 00 00 00 00       	mov    $0x0,%edx
+  80206b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802070:	e8 08 ff ff ff       	call   801f7d <fsipc>
+}
+  802075:	c9                   	leave
+  802076:	c3                   	ret
+
+00802077 <devfile_read>:
+{
+  802077:	55                   	push   %ebp
+  802078:	89 e5                	mov    %esp,%ebp
+  80207a:	57                   	push   %edi
+  80207b:	56                   	push   %esi
+  80207c:	53                   	push   %ebx
+  80207d:	83 ec 1c             	sub    $0x1c,%esp
+  802080:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802083:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802086:	89 fe                	mov    %edi,%esi
+  802088:	c1 ee 0c             	shr    $0xc,%esi
+  80208b:	b8 20 00 00 00       	mov    $0x20,%eax
+  802090:	39 c6                	cmp    %eax,%esi
+  802092:	0f 47 f0             	cmova  %eax,%esi
+  802095:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802098:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80209d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8020a0:	eb 14                	jmp    8020b6 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8020a2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  8020a9:	05 00 10 00 00       	add    $0x1000,%eax
+  8020ae:	f6 c6 06             	test   $0x6,%dh
+  8020b1:	75 42                	jne    8020f5 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8020b3:	83 c1 01             	add    $0x1,%ecx
+  8020b6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8020b9:	39 f1                	cmp    %esi,%ecx
+  8020bb:	0f 84 95 00 00 00    	je     802156 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8020c1:	89 c2                	mov    %eax,%edx
+  8020c3:	c1 ea 16             	shr    $0x16,%edx
+  8020c6:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8020cd:	f6 c2 01             	test   $0x1,%dl
+  8020d0:	74 23                	je     8020f5 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8020d2:	89 c2                	mov    %eax,%edx
+  8020d4:	c1 ea 0c             	shr    $0xc,%edx
+  8020d7:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8020de:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  8020e4:	74 0f                	je     8020f5 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  8020e6:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8020ed:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  8020f3:	75 ad                	jne    8020a2 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  8020f5:	85 c9                	test   %ecx,%ecx
+  8020f7:	74 11                	je     80210a <devfile_read+0x93>
+  8020f9:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802100:	75 08                	jne    80210a <devfile_read+0x93>
+  802102:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  802108:	74 50                	je     80215a <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80210a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80210d:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.read.req_n = n;
+  802112:	89 3d 04 00 81 00    	mov    %edi,0x810004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802118:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802122:	e8 56 fe ff ff       	call   801f7d <fsipc>
+  802127:	89 c6                	mov    %eax,%esi
+  802129:	85 c0                	test   %eax,%eax
+  80212b:	78 1f                	js     80214c <devfile_read+0xd5>
+	assert(r <= n);
+  80212d:	39 c7                	cmp    %eax,%edi
+  80212f:	72 50                	jb     802181 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  802131:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802136:	7f 62                	jg     80219a <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  802138:	83 ec 04             	sub    $0x4,%esp
+  80213b:	50                   	push   %eax
+  80213c:	68 00 00 81 00       	push   $0x810000
+  802141:	ff 75 0c             	push   0xc(%ebp)
+  802144:	e8 99 e9 ff ff       	call   800ae2 <memmove>
+	return r;
+  802149:	83 c4 10             	add    $0x10,%esp
+}
+  80214c:	89 f0                	mov    %esi,%eax
+  80214e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802151:	5b                   	pop    %ebx
+  802152:	5e                   	pop    %esi
+  802153:	5f                   	pop    %edi
+  802154:	5d                   	pop    %ebp
+  802155:	c3                   	ret
+  802156:	89 f1                	mov    %esi,%ecx
+  802158:	eb 9b                	jmp    8020f5 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  80215a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80215d:	a3 00 00 81 00       	mov    %eax,0x810000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  802162:	89 c8                	mov    %ecx,%eax
+  802164:	c1 e0 0c             	shl    $0xc,%eax
+  802167:	a3 04 00 81 00       	mov    %eax,0x810004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  80216c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80216f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802174:	e8 ab fd ff ff       	call   801f24 <fsipc_pages>
+  802179:	89 c6                	mov    %eax,%esi
+  80217b:	85 c0                	test   %eax,%eax
+  80217d:	78 8b                	js     80210a <devfile_read+0x93>
+  80217f:	eb cb                	jmp    80214c <devfile_read+0xd5>
+	assert(r <= n);
+  802181:	68 f4 59 80 00       	push   $0x8059f4
+  802186:	68 fb 59 80 00       	push   $0x8059fb
+  80218b:	68 a0 00 00 00       	push   $0xa0
+  802190:	68 10 5a 80 00       	push   $0x805a10
+  802195:	e8 00 e1 ff ff       	call   80029a <_panic>
+	assert(r <= PGSIZE);
+  80219a:	68 1b 5a 80 00       	push   $0x805a1b
+  80219f:	68 fb 59 80 00       	push   $0x8059fb
+  8021a4:	68 a1 00 00 00       	push   $0xa1
+  8021a9:	68 10 5a 80 00       	push   $0x805a10
+  8021ae:	e8 e7 e0 ff ff       	call   80029a <_panic>
+
+008021b3 <open>:
+{
+  8021b3:	55                   	push   %ebp
+  8021b4:	89 e5                	mov    %esp,%ebp
+  8021b6:	56                   	push   %esi
+  8021b7:	53                   	push   %ebx
+  8021b8:	83 ec 1c             	sub    $0x1c,%esp
+  8021bb:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8021be:	56                   	push   %esi
+  8021bf:	e8 5d e7 ff ff       	call   800921 <strlen>
+  8021c4:	83 c4 10             	add    $0x10,%esp
+  8021c7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021cc:	7f 6c                	jg     80223a <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8021ce:	83 ec 0c             	sub    $0xc,%esp
+  8021d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021d4:	50                   	push   %eax
+  8021d5:	e8 eb f7 ff ff       	call   8019c5 <fd_alloc>
+  8021da:	89 c3                	mov    %eax,%ebx
+  8021dc:	83 c4 10             	add    $0x10,%esp
+  8021df:	85 c0                	test   %eax,%eax
+  8021e1:	78 3c                	js     80221f <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8021e3:	83 ec 08             	sub    $0x8,%esp
+  8021e6:	56                   	push   %esi
+  8021e7:	68 00 00 81 00       	push   $0x810000
+  8021ec:	e8 6b e7 ff ff       	call   80095c <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8021f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021f4:	a3 00 04 81 00       	mov    %eax,0x810400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021f9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021fc:	b8 01 00 00 00       	mov    $0x1,%eax
+  802201:	e8 77 fd ff ff       	call   801f7d <fsipc>
+  802206:	89 c3                	mov    %eax,%ebx
+  802208:	83 c4 10             	add    $0x10,%esp
+  80220b:	85 c0                	test   %eax,%eax
+  80220d:	78 19                	js     802228 <open+0x75>
+	return fd2num(fd);
+  80220f:	83 ec 0c             	sub    $0xc,%esp
+  802212:	ff 75 f4             	push   -0xc(%ebp)
+  802215:	e8 84 f7 ff ff       	call   80199e <fd2num>
+  80221a:	89 c3                	mov    %eax,%ebx
+  80221c:	83 c4 10             	add    $0x10,%esp
+}
+  80221f:	89 d8                	mov    %ebx,%eax
+  802221:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802224:	5b                   	pop    %ebx
+  802225:	5e                   	pop    %esi
+  802226:	5d                   	pop    %ebp
+  802227:	c3                   	ret
+		fd_close(fd, 0);
+  802228:	83 ec 08             	sub    $0x8,%esp
+  80222b:	6a 00                	push   $0x0
+  80222d:	ff 75 f4             	push   -0xc(%ebp)
+  802230:	e8 80 f8 ff ff       	call   801ab5 <fd_close>
+		return r;
+  802235:	83 c4 10             	add    $0x10,%esp
+  802238:	eb e5                	jmp    80221f <open+0x6c>
+		return -E_BAD_PATH;
+  80223a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80223f:	eb de                	jmp    80221f <open+0x6c>
+
+00802241 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802241:	55                   	push   %ebp
+  802242:	89 e5                	mov    %esp,%ebp
+  802244:	53                   	push   %ebx
+  802245:	83 ec 10             	sub    $0x10,%esp
+  802248:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80224b:	53                   	push   %ebx
+  80224c:	e8 d0 e6 ff ff       	call   800921 <strlen>
+  802251:	83 c4 10             	add    $0x10,%esp
+  802254:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802259:	7f 25                	jg     802280 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80225b:	83 ec 08             	sub    $0x8,%esp
+  80225e:	53                   	push   %ebx
+  80225f:	68 00 00 81 00       	push   $0x810000
+  802264:	e8 f3 e6 ff ff       	call   80095c <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802269:	ba 00 00 00 00       	mov    $0x0,%edx
+  80226e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802273:	e8 05 fd ff ff       	call   801f7d <fsipc>
+  802278:	83 c4 10             	add    $0x10,%esp
+}
+  80227b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80227e:	c9                   	leave
+  80227f:	c3                   	ret
+		return -E_BAD_PATH;
+  802280:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802285:	eb f4                	jmp    80227b <remove+0x3a>
+
+00802287 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802287:	55                   	push   %ebp
+  802288:	89 e5                	mov    %esp,%ebp
+  80228a:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80228d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802292:	b8 08 00 00 00       	mov    $0x8,%eax
+  802297:	e8 e1 fc ff ff       	call   801f7d <fsipc>
+}
+  80229c:	c9                   	leave
+  80229d:	c3                   	ret
+
+0080229e <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  80229e:	55                   	push   %ebp
+  80229f:	89 e5                	mov    %esp,%ebp
+  8022a1:	53                   	push   %ebx
+  8022a2:	83 ec 04             	sub    $0x4,%esp
+  8022a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  8022a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ad:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8022b2:	e8 c6 fc ff ff       	call   801f7d <fsipc>
+  8022b7:	85 c0                	test   %eax,%eax
+  8022b9:	78 3c                	js     8022f7 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  8022bb:	a1 00 00 81 00       	mov    0x810000,%eax
+  8022c0:	89 03                	mov    %eax,(%ebx)
+  8022c2:	a1 04 00 81 00       	mov    0x810004,%eax
+  8022c7:	89 43 04             	mov    %eax,0x4(%ebx)
+  8022ca:	a1 08 00 81 00       	mov    0x810008,%eax
+  8022cf:	89 43 08             	mov    %eax,0x8(%ebx)
+  8022d2:	a1 0c 00 81 00       	mov    0x81000c,%eax
+  8022d7:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8022da:	a1 10 00 81 00       	mov    0x810010,%eax
+  8022df:	89 43 10             	mov    %eax,0x10(%ebx)
+  8022e2:	a1 14 00 81 00       	mov    0x810014,%eax
+  8022e7:	89 43 14             	mov    %eax,0x14(%ebx)
+  8022ea:	a1 18 00 81 00       	mov    0x810018,%eax
+  8022ef:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  8022f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022fa:	c9                   	leave
+  8022fb:	c3                   	ret
+
+008022fc <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  8022fc:	55                   	push   %ebp
+  8022fd:	89 e5                	mov    %esp,%ebp
+  8022ff:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  802302:	8b 45 08             	mov    0x8(%ebp),%eax
+  802305:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_BCSET, NULL);
+  80230a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80230f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802314:	e8 64 fc ff ff       	call   801f7d <fsipc>
+}
+  802319:	c9                   	leave
+  80231a:	c3                   	ret
+
+0080231b <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80231b:	55                   	push   %ebp
+  80231c:	89 e5                	mov    %esp,%ebp
+  80231e:	56                   	push   %esi
+  80231f:	53                   	push   %ebx
+  802320:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802323:	83 ec 0c             	sub    $0xc,%esp
+  802326:	ff 75 08             	push   0x8(%ebp)
+  802329:	e8 80 f6 ff ff       	call   8019ae <fd2data>
+  80232e:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802330:	83 c4 08             	add    $0x8,%esp
+  802333:	68 27 5a 80 00       	push   $0x805a27
+  802338:	53                   	push   %ebx
+  802339:	e8 1e e6 ff ff       	call   80095c <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80233e:	8b 46 04             	mov    0x4(%esi),%eax
+  802341:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  802347:	2b 0e                	sub    (%esi),%ecx
+  802349:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80234e:	89 c8                	mov    %ecx,%eax
+  802350:	f7 e2                	mul    %edx
+  802352:	c1 ea 0c             	shr    $0xc,%edx
+  802355:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80235b:	29 d1                	sub    %edx,%ecx
+  80235d:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  802363:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80236a:	00 00 00 
+	stat->st_dev = &devpipe;
+  80236d:	c7 83 88 00 00 00 20 	movl   $0x807020,0x88(%ebx)
+  802374:	70 80 00 
+	return 0;
+}
+  802377:	b8 00 00 00 00       	mov    $0x0,%eax
+  80237c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80237f:	5b                   	pop    %ebx
+  802380:	5e                   	pop    %esi
+  802381:	5d                   	pop    %ebp
+  802382:	c3                   	ret
+
+00802383 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802383:	55                   	push   %ebp
+  802384:	89 e5                	mov    %esp,%ebp
+  802386:	53                   	push   %ebx
+  802387:	83 ec 0c             	sub    $0xc,%esp
+  80238a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80238d:	53                   	push   %ebx
+  80238e:	6a 00                	push   $0x0
+  802390:	e8 3f eb ff ff       	call   800ed4 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802395:	89 1c 24             	mov    %ebx,(%esp)
+  802398:	e8 11 f6 ff ff       	call   8019ae <fd2data>
+  80239d:	83 c4 08             	add    $0x8,%esp
+  8023a0:	50                   	push   %eax
+  8023a1:	6a 00                	push   $0x0
+  8023a3:	e8 2c eb ff ff       	call   800ed4 <sys_page_unmap>
+}
+  8023a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023ab:	c9                   	leave
+  8023ac:	c3                   	ret
+
+008023ad <_pipeisclosed>:
+{
+  8023ad:	55                   	push   %ebp
+  8023ae:	89 e5                	mov    %esp,%ebp
+  8023b0:	57                   	push   %edi
+  8023b1:	56                   	push   %esi
+  8023b2:	53                   	push   %ebx
+  8023b3:	83 ec 1c             	sub    $0x1c,%esp
+  8023b6:	89 c7                	mov    %eax,%edi
+  8023b8:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8023ba:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8023bf:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8023c2:	83 ec 0c             	sub    $0xc,%esp
+  8023c5:	57                   	push   %edi
+  8023c6:	e8 06 2e 00 00       	call   8051d1 <pageref>
+  8023cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8023ce:	89 34 24             	mov    %esi,(%esp)
+  8023d1:	e8 fb 2d 00 00       	call   8051d1 <pageref>
+		nn = thisenv->env_runs;
+  8023d6:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  8023dc:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8023df:	83 c4 10             	add    $0x10,%esp
+  8023e2:	39 cb                	cmp    %ecx,%ebx
+  8023e4:	74 1b                	je     802401 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8023e6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8023e9:	75 cf                	jne    8023ba <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8023eb:	8b 42 58             	mov    0x58(%edx),%eax
+  8023ee:	6a 01                	push   $0x1
+  8023f0:	50                   	push   %eax
+  8023f1:	53                   	push   %ebx
+  8023f2:	68 2e 5a 80 00       	push   $0x805a2e
+  8023f7:	e8 79 df ff ff       	call   800375 <cprintf>
+  8023fc:	83 c4 10             	add    $0x10,%esp
+  8023ff:	eb b9                	jmp    8023ba <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802401:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802404:	0f 94 c0             	sete   %al
+  802407:	0f b6 c0             	movzbl %al,%eax
+}
+  80240a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80240d:	5b                   	pop    %ebx
+  80240e:	5e                   	pop    %esi
+  80240f:	5f                   	pop    %edi
+  802410:	5d                   	pop    %ebp
+  802411:	c3                   	ret
+
+00802412 <devpipe_read>:
+{
+  802412:	55                   	push   %ebp
+  802413:	89 e5                	mov    %esp,%ebp
+  802415:	57                   	push   %edi
+  802416:	56                   	push   %esi
+  802417:	53                   	push   %ebx
+  802418:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80241b:	ff 75 08             	push   0x8(%ebp)
+  80241e:	e8 8b f5 ff ff       	call   8019ae <fd2data>
+  802423:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  802425:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  802428:	8d 40 04             	lea    0x4(%eax),%eax
+  80242b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80242e:	8b 7b 04             	mov    0x4(%ebx),%edi
+  802431:	8b 0b                	mov    (%ebx),%ecx
+  802433:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  802439:	29 ce                	sub    %ecx,%esi
+  80243b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802440:	f7 e6                	mul    %esi
+  802442:	c1 ea 0c             	shr    $0xc,%edx
+  802445:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  80244b:	29 c6                	sub    %eax,%esi
+  80244d:	89 f2                	mov    %esi,%edx
+  80244f:	75 43                	jne    802494 <devpipe_read+0x82>
+		ref = pageref(p);
+  802451:	83 ec 0c             	sub    $0xc,%esp
+  802454:	53                   	push   %ebx
+  802455:	e8 77 2d 00 00       	call   8051d1 <pageref>
+  80245a:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  80245c:	89 da                	mov    %ebx,%edx
+  80245e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802461:	e8 47 ff ff ff       	call   8023ad <_pipeisclosed>
+  802466:	83 c4 10             	add    $0x10,%esp
+  802469:	85 c0                	test   %eax,%eax
+  80246b:	0f 85 c1 00 00 00    	jne    802532 <devpipe_read+0x120>
+	*sleeping = 1;
+  802471:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  802478:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80247d:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  802480:	75 ac                	jne    80242e <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  802482:	83 ec 04             	sub    $0x4,%esp
+  802485:	56                   	push   %esi
+  802486:	57                   	push   %edi
+  802487:	ff 75 e4             	push   -0x1c(%ebp)
+  80248a:	e8 99 ee ff ff       	call   801328 <sys_futex_wait>
+  80248f:	83 c4 10             	add    $0x10,%esp
+  802492:	eb 9a                	jmp    80242e <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  802494:	39 75 10             	cmp    %esi,0x10(%ebp)
+  802497:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  80249b:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80249d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8024a2:	f7 e1                	mul    %ecx
+  8024a4:	c1 ea 0b             	shr    $0xb,%edx
+  8024a7:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8024ad:	29 c1                	sub    %eax,%ecx
+  8024af:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  8024b1:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8024b6:	29 cf                	sub    %ecx,%edi
+  8024b8:	39 f7                	cmp    %esi,%edi
+  8024ba:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  8024bd:	8d 43 10             	lea    0x10(%ebx),%eax
+  8024c0:	83 ec 04             	sub    $0x4,%esp
+  8024c3:	57                   	push   %edi
+  8024c4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024c7:	01 c2                	add    %eax,%edx
+  8024c9:	52                   	push   %edx
+  8024ca:	ff 75 0c             	push   0xc(%ebp)
+  8024cd:	e8 10 e6 ff ff       	call   800ae2 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  8024d2:	83 c4 0c             	add    $0xc,%esp
+  8024d5:	89 f1                	mov    %esi,%ecx
+  8024d7:	29 f9                	sub    %edi,%ecx
+  8024d9:	51                   	push   %ecx
+  8024da:	ff 75 e4             	push   -0x1c(%ebp)
+  8024dd:	89 f8                	mov    %edi,%eax
+  8024df:	03 45 0c             	add    0xc(%ebp),%eax
+  8024e2:	50                   	push   %eax
+  8024e3:	e8 fa e5 ff ff       	call   800ae2 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  8024e8:	89 f1                	mov    %esi,%ecx
+  8024ea:	03 0b                	add    (%ebx),%ecx
+  8024ec:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8024f1:	f7 e1                	mul    %ecx
+  8024f3:	c1 ea 0c             	shr    $0xc,%edx
+  8024f6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8024fc:	29 d1                	sub    %edx,%ecx
+  8024fe:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  802500:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802505:	83 c4 10             	add    $0x10,%esp
+  802508:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  80250c:	75 0a                	jne    802518 <devpipe_read+0x106>
+	return n;
+  80250e:	89 f0                	mov    %esi,%eax
+}
+  802510:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802513:	5b                   	pop    %ebx
+  802514:	5e                   	pop    %esi
+  802515:	5f                   	pop    %edi
+  802516:	5d                   	pop    %ebp
+  802517:	c3                   	ret
+		*sleeping = 0;
+  802518:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  80251f:	83 ec 08             	sub    $0x8,%esp
+  802522:	68 00 04 00 00       	push   $0x400
+  802527:	53                   	push   %ebx
+  802528:	e8 4b ee ff ff       	call   801378 <sys_futex_wake>
+  80252d:	83 c4 10             	add    $0x10,%esp
+  802530:	eb dc                	jmp    80250e <devpipe_read+0xfc>
+			return 0;
+  802532:	b8 00 00 00 00       	mov    $0x0,%eax
+  802537:	eb d7                	jmp    802510 <devpipe_read+0xfe>
+
+00802539 <devpipe_write>:
+{
+  802539:	55                   	push   %ebp
+  80253a:	89 e5                	mov    %esp,%ebp
+  80253c:	57                   	push   %edi
+  80253d:	56                   	push   %esi
+  80253e:	53                   	push   %ebx
+  80253f:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802542:	ff 75 08             	push   0x8(%ebp)
+  802545:	e8 64 f4 ff ff       	call   8019ae <fd2data>
+  80254a:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  80254c:	83 c4 10             	add    $0x10,%esp
+  80254f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802556:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802559:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80255c:	0f 83 23 01 00 00    	jae    802685 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802562:	8b 77 04             	mov    0x4(%edi),%esi
+  802565:	8b 1f                	mov    (%edi),%ebx
+  802567:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  80256d:	29 d9                	sub    %ebx,%ecx
+  80256f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802574:	f7 e1                	mul    %ecx
+  802576:	c1 ea 0c             	shr    $0xc,%edx
+  802579:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80257f:	29 c1                	sub    %eax,%ecx
+  802581:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802583:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802589:	75 40                	jne    8025cb <devpipe_write+0x92>
+			ref = pageref(p);
+  80258b:	83 ec 0c             	sub    $0xc,%esp
+  80258e:	57                   	push   %edi
+  80258f:	e8 3d 2c 00 00       	call   8051d1 <pageref>
+  802594:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  802596:	89 fa                	mov    %edi,%edx
+  802598:	8b 45 08             	mov    0x8(%ebp),%eax
+  80259b:	e8 0d fe ff ff       	call   8023ad <_pipeisclosed>
+  8025a0:	83 c4 10             	add    $0x10,%esp
+  8025a3:	85 c0                	test   %eax,%eax
+  8025a5:	0f 85 d5 00 00 00    	jne    802680 <devpipe_write+0x147>
+	*sleeping = 1;
+  8025ab:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  8025b2:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8025b7:	39 1f                	cmp    %ebx,(%edi)
+  8025b9:	75 a7                	jne    802562 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  8025bb:	83 ec 04             	sub    $0x4,%esp
+  8025be:	56                   	push   %esi
+  8025bf:	53                   	push   %ebx
+  8025c0:	57                   	push   %edi
+  8025c1:	e8 62 ed ff ff       	call   801328 <sys_futex_wait>
+  8025c6:	83 c4 10             	add    $0x10,%esp
+  8025c9:	eb 97                	jmp    802562 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8025cb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8025ce:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025d1:	29 c1                	sub    %eax,%ecx
+  8025d3:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8025d8:	89 d8                	mov    %ebx,%eax
+  8025da:	29 d0                	sub    %edx,%eax
+  8025dc:	39 c1                	cmp    %eax,%ecx
+  8025de:	0f 46 c1             	cmovbe %ecx,%eax
+  8025e1:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  8025e3:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8025e8:	f7 e6                	mul    %esi
+  8025ea:	c1 ea 0b             	shr    $0xb,%edx
+  8025ed:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8025f3:	29 c6                	sub    %eax,%esi
+  8025f5:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8025f7:	29 f3                	sub    %esi,%ebx
+  8025f9:	39 cb                	cmp    %ecx,%ebx
+  8025fb:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8025fe:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  802601:	8d 77 10             	lea    0x10(%edi),%esi
+  802604:	83 ec 04             	sub    $0x4,%esp
+  802607:	53                   	push   %ebx
+  802608:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80260b:	03 45 0c             	add    0xc(%ebp),%eax
+  80260e:	50                   	push   %eax
+  80260f:	01 f2                	add    %esi,%edx
+  802611:	52                   	push   %edx
+  802612:	e8 cb e4 ff ff       	call   800ae2 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802617:	83 c4 0c             	add    $0xc,%esp
+  80261a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80261d:	29 d8                	sub    %ebx,%eax
+  80261f:	50                   	push   %eax
+  802620:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802623:	01 d3                	add    %edx,%ebx
+  802625:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802628:	53                   	push   %ebx
+  802629:	56                   	push   %esi
+  80262a:	e8 b3 e4 ff ff       	call   800ae2 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  80262f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802632:	03 4f 04             	add    0x4(%edi),%ecx
+  802635:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80263a:	f7 e1                	mul    %ecx
+  80263c:	c1 ea 0c             	shr    $0xc,%edx
+  80263f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802645:	29 d1                	sub    %edx,%ecx
+  802647:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  80264a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80264f:	83 c4 10             	add    $0x10,%esp
+  802652:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802656:	75 0b                	jne    802663 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802658:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  80265b:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80265e:	e9 f3 fe ff ff       	jmp    802556 <devpipe_write+0x1d>
+		*sleeping = 0;
+  802663:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  80266a:	83 ec 08             	sub    $0x8,%esp
+  80266d:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802672:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802675:	50                   	push   %eax
+  802676:	e8 fd ec ff ff       	call   801378 <sys_futex_wake>
+  80267b:	83 c4 10             	add    $0x10,%esp
+  80267e:	eb d8                	jmp    802658 <devpipe_write+0x11f>
+				return 0;
+  802680:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802685:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802688:	5b                   	pop    %ebx
+  802689:	5e                   	pop    %esi
+  80268a:	5f                   	pop    %edi
+  80268b:	5d                   	pop    %ebp
+  80268c:	c3                   	ret
+
+0080268d <pipe>:
+{
+  80268d:	55                   	push   %ebp
+  80268e:	89 e5                	mov    %esp,%ebp
+  802690:	56                   	push   %esi
+  802691:	53                   	push   %ebx
+  802692:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802695:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802698:	50                   	push   %eax
+  802699:	e8 27 f3 ff ff       	call   8019c5 <fd_alloc>
+  80269e:	89 c3                	mov    %eax,%ebx
+  8026a0:	83 c4 10             	add    $0x10,%esp
+  8026a3:	85 c0                	test   %eax,%eax
+  8026a5:	0f 88 23 01 00 00    	js     8027ce <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026ab:	83 ec 04             	sub    $0x4,%esp
+  8026ae:	68 07 04 00 00       	push   $0x407
+  8026b3:	ff 75 f4             	push   -0xc(%ebp)
+  8026b6:	6a 00                	push   $0x0
+  8026b8:	e8 92 e7 ff ff       	call   800e4f <sys_page_alloc>
+  8026bd:	89 c3                	mov    %eax,%ebx
+  8026bf:	83 c4 10             	add    $0x10,%esp
+  8026c2:	85 c0                	test   %eax,%eax
+  8026c4:	0f 88 04 01 00 00    	js     8027ce <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026ca:	83 ec 0c             	sub    $0xc,%esp
+  8026cd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026d0:	50                   	push   %eax
+  8026d1:	e8 ef f2 ff ff       	call   8019c5 <fd_alloc>
+  8026d6:	89 c3                	mov    %eax,%ebx
+  8026d8:	83 c4 10             	add    $0x10,%esp
+  8026db:	85 c0                	test   %eax,%eax
+  8026dd:	0f 88 db 00 00 00    	js     8027be <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026e3:	83 ec 04             	sub    $0x4,%esp
+  8026e6:	68 07 04 00 00       	push   $0x407
+  8026eb:	ff 75 f0             	push   -0x10(%ebp)
+  8026ee:	6a 00                	push   $0x0
+  8026f0:	e8 5a e7 ff ff       	call   800e4f <sys_page_alloc>
+  8026f5:	89 c3                	mov    %eax,%ebx
+  8026f7:	83 c4 10             	add    $0x10,%esp
+  8026fa:	85 c0                	test   %eax,%eax
+  8026fc:	0f 88 bc 00 00 00    	js     8027be <pipe+0x131>
+	va = fd2data(fd0);
+  802702:	83 ec 0c             	sub    $0xc,%esp
+  802705:	ff 75 f4             	push   -0xc(%ebp)
+  802708:	e8 a1 f2 ff ff       	call   8019ae <fd2data>
+  80270d:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80270f:	83 c4 0c             	add    $0xc,%esp
+  802712:	68 07 04 00 00       	push   $0x407
+  802717:	50                   	push   %eax
+  802718:	6a 00                	push   $0x0
+  80271a:	e8 30 e7 ff ff       	call   800e4f <sys_page_alloc>
+  80271f:	89 c3                	mov    %eax,%ebx
+  802721:	83 c4 10             	add    $0x10,%esp
+  802724:	85 c0                	test   %eax,%eax
+  802726:	0f 88 82 00 00 00    	js     8027ae <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80272c:	83 ec 0c             	sub    $0xc,%esp
+  80272f:	ff 75 f0             	push   -0x10(%ebp)
+  802732:	e8 77 f2 ff ff       	call   8019ae <fd2data>
+  802737:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80273e:	50                   	push   %eax
+  80273f:	6a 00                	push   $0x0
+  802741:	56                   	push   %esi
+  802742:	6a 00                	push   $0x0
+  802744:	e8 49 e7 ff ff       	call   800e92 <sys_page_map>
+  802749:	89 c3                	mov    %eax,%ebx
+  80274b:	83 c4 20             	add    $0x20,%esp
+  80274e:	85 c0                	test   %eax,%eax
+  802750:	78 4e                	js     8027a0 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802752:	a1 20 70 80 00       	mov    0x807020,%eax
+  802757:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80275a:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80275c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80275f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802766:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802769:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80276b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80276e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802775:	83 ec 0c             	sub    $0xc,%esp
+  802778:	ff 75 f4             	push   -0xc(%ebp)
+  80277b:	e8 1e f2 ff ff       	call   80199e <fd2num>
+  802780:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802783:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802785:	83 c4 04             	add    $0x4,%esp
+  802788:	ff 75 f0             	push   -0x10(%ebp)
+  80278b:	e8 0e f2 ff ff       	call   80199e <fd2num>
+  802790:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802793:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802796:	83 c4 10             	add    $0x10,%esp
+  802799:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80279e:	eb 2e                	jmp    8027ce <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027a0:	83 ec 08             	sub    $0x8,%esp
+  8027a3:	56                   	push   %esi
+  8027a4:	6a 00                	push   $0x0
+  8027a6:	e8 29 e7 ff ff       	call   800ed4 <sys_page_unmap>
+  8027ab:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027ae:	83 ec 08             	sub    $0x8,%esp
+  8027b1:	ff 75 f0             	push   -0x10(%ebp)
+  8027b4:	6a 00                	push   $0x0
+  8027b6:	e8 19 e7 ff ff       	call   800ed4 <sys_page_unmap>
+  8027bb:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027be:	83 ec 08             	sub    $0x8,%esp
+  8027c1:	ff 75 f4             	push   -0xc(%ebp)
+  8027c4:	6a 00                	push   $0x0
+  8027c6:	e8 09 e7 ff ff       	call   800ed4 <sys_page_unmap>
+  8027cb:	83 c4 10             	add    $0x10,%esp
+}
+  8027ce:	89 d8                	mov    %ebx,%eax
+  8027d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027d3:	5b                   	pop    %ebx
+  8027d4:	5e                   	pop    %esi
+  8027d5:	5d                   	pop    %ebp
+  8027d6:	c3                   	ret
+
+008027d7 <pipeisclosed>:
+{
+  8027d7:	55                   	push   %ebp
+  8027d8:	89 e5                	mov    %esp,%ebp
+  8027da:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027e0:	50                   	push   %eax
+  8027e1:	ff 75 08             	push   0x8(%ebp)
+  8027e4:	e8 30 f2 ff ff       	call   801a19 <fd_lookup>
+  8027e9:	83 c4 10             	add    $0x10,%esp
+  8027ec:	85 c0                	test   %eax,%eax
+  8027ee:	78 18                	js     802808 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8027f0:	83 ec 0c             	sub    $0xc,%esp
+  8027f3:	ff 75 f4             	push   -0xc(%ebp)
+  8027f6:	e8 b3 f1 ff ff       	call   8019ae <fd2data>
+  8027fb:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8027fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802800:	e8 a8 fb ff ff       	call   8023ad <_pipeisclosed>
+  802805:	83 c4 10             	add    $0x10,%esp
+}
+  802808:	c9                   	leave
+  802809:	c3                   	ret
+
+0080280a <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  80280a:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  80280c:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  802812:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802818:	81 c2 34 01 00 00    	add    $0x134,%edx
+  80281e:	39 d0                	cmp    %edx,%eax
+  802820:	74 2e                	je     802850 <segment_lookup+0x46>
+{
+  802822:	55                   	push   %ebp
+  802823:	89 e5                	mov    %esp,%ebp
+  802825:	57                   	push   %edi
+  802826:	56                   	push   %esi
+  802827:	53                   	push   %ebx
+  802828:	eb 07                	jmp    802831 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  80282a:	83 c0 20             	add    $0x20,%eax
+  80282d:	39 d0                	cmp    %edx,%eax
+  80282f:	74 15                	je     802846 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802831:	8b 18                	mov    (%eax),%ebx
+  802833:	39 d9                	cmp    %ebx,%ecx
+  802835:	72 f3                	jb     80282a <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  802837:	8b 38                	mov    (%eax),%edi
+  802839:	8b 58 04             	mov    0x4(%eax),%ebx
+  80283c:	89 ce                	mov    %ecx,%esi
+  80283e:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  802840:	39 de                	cmp    %ebx,%esi
+  802842:	73 e6                	jae    80282a <segment_lookup+0x20>
+  802844:	eb 05                	jmp    80284b <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  802846:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80284b:	5b                   	pop    %ebx
+  80284c:	5e                   	pop    %esi
+  80284d:	5f                   	pop    %edi
+  80284e:	5d                   	pop    %ebp
+  80284f:	c3                   	ret
+	return NULL;
+  802850:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802855:	c3                   	ret
+
+00802856 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802856:	55                   	push   %ebp
+  802857:	89 e5                	mov    %esp,%ebp
+  802859:	53                   	push   %ebx
+  80285a:	83 ec 04             	sub    $0x4,%esp
+  80285d:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80285f:	c1 e8 16             	shr    $0x16,%eax
+  802862:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802869:	25 81 00 00 00       	and    $0x81,%eax
+  80286e:	83 f8 01             	cmp    $0x1,%eax
+  802871:	75 6b                	jne    8028de <page_is_clean+0x88>
+  802873:	89 da                	mov    %ebx,%edx
+  802875:	c1 ea 0c             	shr    $0xc,%edx
+  802878:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  80287f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802884:	f6 c1 01             	test   $0x1,%cl
+  802887:	74 5a                	je     8028e3 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802889:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802890:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802896:	75 4b                	jne    8028e3 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  802898:	89 d8                	mov    %ebx,%eax
+  80289a:	e8 6b ff ff ff       	call   80280a <segment_lookup>
+  80289f:	89 c2                	mov    %eax,%edx
+		return 1;
+  8028a1:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  8028a6:	85 d2                	test   %edx,%edx
+  8028a8:	75 39                	jne    8028e3 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  8028aa:	8b 15 0c c0 80 00    	mov    0x80c00c,%edx
+  8028b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b5:	eb 03                	jmp    8028ba <page_is_clean+0x64>
+  8028b7:	83 c0 01             	add    $0x1,%eax
+  8028ba:	39 c2                	cmp    %eax,%edx
+  8028bc:	7e 19                	jle    8028d7 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  8028be:	3b 1c c5 20 c0 80 00 	cmp    0x80c020(,%eax,8),%ebx
+  8028c5:	72 f0                	jb     8028b7 <page_is_clean+0x61>
+  8028c7:	3b 1c c5 24 c0 80 00 	cmp    0x80c024(,%eax,8),%ebx
+  8028ce:	73 e7                	jae    8028b7 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  8028d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028d5:	eb 0c                	jmp    8028e3 <page_is_clean+0x8d>
+	return 0;
+  8028d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028dc:	eb 05                	jmp    8028e3 <page_is_clean+0x8d>
+		return 0;
+  8028de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028e6:	c9                   	leave
+  8028e7:	c3                   	ret
+
+008028e8 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  8028e8:	55                   	push   %ebp
+  8028e9:	89 e5                	mov    %esp,%ebp
+  8028eb:	57                   	push   %edi
+  8028ec:	56                   	push   %esi
+  8028ed:	53                   	push   %ebx
+  8028ee:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8028f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8028f6:	eb 19                	jmp    802911 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8028f8:	f7 d3                	not    %ebx
+  8028fa:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802900:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802902:	83 c6 01             	add    $0x1,%esi
+  802905:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  80290b:	0f 87 97 00 00 00    	ja     8029a8 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802911:	89 f3                	mov    %esi,%ebx
+  802913:	03 1d 34 90 80 00    	add    0x809034,%ebx
+  802919:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80291f:	89 d8                	mov    %ebx,%eax
+  802921:	c1 e8 0a             	shr    $0xa,%eax
+  802924:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80292b:	25 81 00 00 00       	and    $0x81,%eax
+  802930:	83 f8 01             	cmp    $0x1,%eax
+  802933:	75 c3                	jne    8028f8 <linear_walk+0x10>
+  802935:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80293b:	77 bb                	ja     8028f8 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  80293d:	89 df                	mov    %ebx,%edi
+  80293f:	c1 e7 0c             	shl    $0xc,%edi
+  802942:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802945:	89 f8                	mov    %edi,%eax
+  802947:	e8 0a ff ff ff       	call   802856 <page_is_clean>
+  80294c:	84 c0                	test   %al,%al
+  80294e:	75 64                	jne    8029b4 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802950:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802956:	77 aa                	ja     802902 <linear_walk+0x1a>
+  802958:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  80295e:	72 a2                	jb     802902 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802960:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802967:	a8 01                	test   $0x1,%al
+  802969:	74 97                	je     802902 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80296b:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802972:	f6 c4 04             	test   $0x4,%ah
+  802975:	75 8b                	jne    802902 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802977:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80297e:	f6 c4 02             	test   $0x2,%ah
+  802981:	0f 85 7b ff ff ff    	jne    802902 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802987:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80298e:	c1 e8 0c             	shr    $0xc,%eax
+  802991:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802994:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802999:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80299d:	66 83 f8 01          	cmp    $0x1,%ax
+  8029a1:	76 11                	jbe    8029b4 <linear_walk+0xcc>
+  8029a3:	e9 5a ff ff ff       	jmp    802902 <linear_walk+0x1a>
+  8029a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  8029ad:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  8029b4:	89 1d 34 90 80 00    	mov    %ebx,0x809034
+}
+  8029ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029bd:	83 c4 1c             	add    $0x1c,%esp
+  8029c0:	5b                   	pop    %ebx
+  8029c1:	5e                   	pop    %esi
+  8029c2:	5f                   	pop    %edi
+  8029c3:	5d                   	pop    %ebp
+  8029c4:	c3                   	ret
+
+008029c5 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  8029c5:	55                   	push   %ebp
+  8029c6:	89 e5                	mov    %esp,%ebp
+  8029c8:	56                   	push   %esi
+  8029c9:	53                   	push   %ebx
+  8029ca:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  8029cc:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8029d1:	83 e0 7f             	and    $0x7f,%eax
+  8029d4:	c1 e0 04             	shl    $0x4,%eax
+  8029d7:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  8029dd:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  8029e3:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  8029e9:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  8029ef:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8029f4:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  8029f7:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8029fc:	83 c0 01             	add    $0x1,%eax
+  8029ff:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  802a04:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802a07:	5b                   	pop    %ebx
+  802a08:	5e                   	pop    %esi
+  802a09:	5d                   	pop    %ebp
+  802a0a:	c3                   	ret
+
+00802a0b <page_ring_enter>:
+{
+  802a0b:	55                   	push   %ebp
+  802a0c:	89 e5                	mov    %esp,%ebp
+  802a0e:	57                   	push   %edi
+  802a0f:	56                   	push   %esi
+  802a10:	53                   	push   %ebx
+  802a11:	83 ec 18             	sub    $0x18,%esp
+  802a14:	89 c6                	mov    %eax,%esi
+  802a16:	89 d7                	mov    %edx,%edi
+  802a18:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802a1a:	6a 00                	push   $0x0
+  802a1c:	6a 00                	push   $0x0
+  802a1e:	6a 00                	push   $0x0
+  802a20:	6a 07                	push   $0x7
+  802a22:	ff 35 40 c0 80 00    	push   0x80c040
+  802a28:	e8 8e 26 00 00       	call   8050bb <ipc_call>
+  802a2d:	83 c4 20             	add    $0x20,%esp
+  802a30:	85 c0                	test   %eax,%eax
+  802a32:	79 22                	jns    802a56 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802a34:	50                   	push   %eax
+  802a35:	68 41 5a 80 00       	push   $0x805a41
+  802a3a:	68 13 02 00 00       	push   $0x213
+  802a3f:	68 55 5a 80 00       	push   $0x805a55
+  802a44:	e8 51 d8 ff ff       	call   80029a <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802a49:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802a4e:	83 c0 01             	add    $0x1,%eax
+  802a51:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802a56:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802a5c:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802a61:	39 c2                	cmp    %eax,%edx
+  802a63:	74 24                	je     802a89 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802a65:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802a6a:	83 e0 7f             	and    $0x7f,%eax
+  802a6d:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802a74:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802a7b:	29 f0                	sub    %esi,%eax
+  802a7d:	39 d8                	cmp    %ebx,%eax
+  802a7f:	73 c8                	jae    802a49 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802a81:	8b 52 04             	mov    0x4(%edx),%edx
+  802a84:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802a87:	eb c0                	jmp    802a49 <page_ring_enter+0x3e>
+}
+  802a89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a8c:	5b                   	pop    %ebx
+  802a8d:	5e                   	pop    %esi
+  802a8e:	5f                   	pop    %edi
+  802a8f:	5d                   	pop    %ebp
+  802a90:	c3                   	ret
+
+00802a91 <page_ring_reserve>:
+{
+  802a91:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802a93:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802a98:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802a9e:	29 d0                	sub    %edx,%eax
+  802aa0:	ba 80 00 00 00       	mov    $0x80,%edx
+  802aa5:	29 ca                	sub    %ecx,%edx
+  802aa7:	39 c2                	cmp    %eax,%edx
+  802aa9:	72 01                	jb     802aac <page_ring_reserve+0x1b>
+  802aab:	c3                   	ret
+{
+  802aac:	55                   	push   %ebp
+  802aad:	89 e5                	mov    %esp,%ebp
+  802aaf:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802ab2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ab7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802abc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac1:	e8 45 ff ff ff       	call   802a0b <page_ring_enter>
+}
+  802ac6:	c9                   	leave
+  802ac7:	c3                   	ret
+
+00802ac8 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802ac8:	55                   	push   %ebp
+  802ac9:	89 e5                	mov    %esp,%ebp
+  802acb:	53                   	push   %ebx
+  802acc:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802acf:	6a 07                	push   $0x7
+  802ad1:	6a 01                	push   $0x1
+  802ad3:	89 c3                	mov    %eax,%ebx
+  802ad5:	c1 e3 0c             	shl    $0xc,%ebx
+  802ad8:	8d 93 00 a0 80 00    	lea    0x80a000(%ebx),%edx
+  802ade:	52                   	push   %edx
+  802adf:	6a 04                	push   $0x4
+  802ae1:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  802ae8:	e8 ce 25 00 00       	call   8050bb <ipc_call>
+	sharereqs[i].nslots = 0;
+  802aed:	c7 83 00 a0 80 00 00 	movl   $0x0,0x80a000(%ebx)
+  802af4:	00 00 00 
+	return r;
+}
+  802af7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802afa:	c9                   	leave
+  802afb:	c3                   	ret
+
+00802afc <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802afc:	55                   	push   %ebp
+  802afd:	89 e5                	mov    %esp,%ebp
+  802aff:	56                   	push   %esi
+  802b00:	53                   	push   %ebx
+  802b01:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802b03:	c1 e8 10             	shr    $0x10,%eax
+  802b06:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802b09:	89 c2                	mov    %eax,%edx
+  802b0b:	c1 e2 0c             	shl    $0xc,%edx
+  802b0e:	8b b2 00 a0 80 00    	mov    0x80a000(%edx),%esi
+  802b14:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802b17:	89 9a 00 a0 80 00    	mov    %ebx,0x80a000(%edx)
+  802b1d:	89 c2                	mov    %eax,%edx
+  802b1f:	c1 e2 0a             	shl    $0xa,%edx
+  802b22:	01 f2                	add    %esi,%edx
+  802b24:	89 0c 95 04 a0 80 00 	mov    %ecx,0x80a004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802b2b:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802b31:	74 09                	je     802b3c <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802b33:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b38:	5b                   	pop    %ebx
+  802b39:	5e                   	pop    %esi
+  802b3a:	5d                   	pop    %ebp
+  802b3b:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802b3c:	e8 87 ff ff ff       	call   802ac8 <page_share_send>
+  802b41:	eb f5                	jmp    802b38 <page_share_slot+0x3c>
+
+00802b43 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802b43:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802b48:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802b4b:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802b50:	3b 15 00 c0 80 00    	cmp    0x80c000,%edx
+  802b56:	74 09                	je     802b61 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802b58:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  802b5d:	85 c0                	test   %eax,%eax
+  802b5f:	75 01                	jne    802b62 <page_ring_ready+0x1f>
+}
+  802b61:	c3                   	ret
+{
+  802b62:	55                   	push   %ebp
+  802b63:	89 e5                	mov    %esp,%ebp
+  802b65:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802b68:	68 07 06 00 00       	push   $0x607
+  802b6d:	6a 08                	push   $0x8
+  802b6f:	68 00 30 ad de       	push   $0xdead3000
+  802b74:	6a 00                	push   $0x0
+  802b76:	e8 ff e3 ff ff       	call   800f7a <sys_page_alloc_range>
+  802b7b:	83 c4 10             	add    $0x10,%esp
+  802b7e:	83 f8 08             	cmp    $0x8,%eax
+  802b81:	74 1b                	je     802b9e <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802b83:	83 ec 04             	sub    $0x4,%esp
+  802b86:	6a 08                	push   $0x8
+  802b88:	68 00 30 ad de       	push   $0xdead3000
+  802b8d:	6a 00                	push   $0x0
+  802b8f:	e8 54 e4 ff ff       	call   800fe8 <sys_page_unmap_range>
+		return 0;
+  802b94:	83 c4 10             	add    $0x10,%esp
+  802b97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b9c:	c9                   	leave
+  802b9d:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802b9e:	83 ec 0c             	sub    $0xc,%esp
+  802ba1:	68 07 04 00 00       	push   $0x407
+  802ba6:	6a 08                	push   $0x8
+  802ba8:	68 00 30 ad de       	push   $0xdead3000
+  802bad:	6a 06                	push   $0x6
+  802baf:	ff 35 40 c0 80 00    	push   0x80c040
+  802bb5:	e8 01 25 00 00       	call   8050bb <ipc_call>
+  802bba:	83 c4 20             	add    $0x20,%esp
+  802bbd:	85 c0                	test   %eax,%eax
+  802bbf:	78 14                	js     802bd5 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802bc1:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802bc6:	8b 40 48             	mov    0x48(%eax),%eax
+  802bc9:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	return 1;
+  802bce:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bd3:	eb c7                	jmp    802b9c <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802bd5:	83 ec 04             	sub    $0x4,%esp
+  802bd8:	6a 08                	push   $0x8
+  802bda:	68 00 30 ad de       	push   $0xdead3000
+  802bdf:	6a 00                	push   $0x0
+  802be1:	e8 02 e4 ff ff       	call   800fe8 <sys_page_unmap_range>
+		return 0;
+  802be6:	83 c4 10             	add    $0x10,%esp
+  802be9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bee:	eb ac                	jmp    802b9c <page_ring_ready+0x59>
+
+00802bf0 <page_remove_slot>:
+{
+  802bf0:	55                   	push   %ebp
+  802bf1:	89 e5                	mov    %esp,%ebp
+  802bf3:	56                   	push   %esi
+  802bf4:	53                   	push   %ebx
+  802bf5:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802bf7:	89 c6                	mov    %eax,%esi
+  802bf9:	c1 ee 10             	shr    $0x10,%esi
+  802bfc:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802bff:	8b 04 b5 44 c0 80 00 	mov    0x80c044(,%esi,4),%eax
+  802c06:	39 05 40 c0 80 00    	cmp    %eax,0x80c040
+  802c0c:	74 2a                	je     802c38 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802c0e:	83 ec 0c             	sub    $0xc,%esp
+  802c11:	6a 00                	push   $0x0
+  802c13:	6a 00                	push   $0x0
+  802c15:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802c17:	c1 e3 04             	shl    $0x4,%ebx
+  802c1a:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802c1d:	53                   	push   %ebx
+  802c1e:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  802c25:	e8 91 24 00 00       	call   8050bb <ipc_call>
+  802c2a:	83 c4 20             	add    $0x20,%esp
+  802c2d:	85 c0                	test   %eax,%eax
+  802c2f:	78 2d                	js     802c5e <page_remove_slot+0x6e>
+}
+  802c31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c34:	5b                   	pop    %ebx
+  802c35:	5e                   	pop    %esi
+  802c36:	5d                   	pop    %ebp
+  802c37:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802c38:	e8 06 ff ff ff       	call   802b43 <page_ring_ready>
+  802c3d:	85 c0                	test   %eax,%eax
+  802c3f:	74 cd                	je     802c0e <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802c41:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c46:	e8 46 fe ff ff       	call   802a91 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802c4b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c50:	89 da                	mov    %ebx,%edx
+  802c52:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c57:	e8 69 fd ff ff       	call   8029c5 <page_ring_post>
+		return;
+  802c5c:	eb d3                	jmp    802c31 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802c5e:	50                   	push   %eax
+  802c5f:	68 b0 5a 80 00       	push   $0x805ab0
+  802c64:	68 ac 03 00 00       	push   $0x3ac
+  802c69:	68 55 5a 80 00       	push   $0x805a55
+  802c6e:	e8 27 d6 ff ff       	call   80029a <_panic>
+
+00802c73 <find_paging_env>:
+	if(pagingenv)
+  802c73:	a1 40 c0 80 00       	mov    0x80c040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802c78:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802c7a:	85 c0                	test   %eax,%eax
+  802c7c:	74 05                	je     802c83 <find_paging_env+0x10>
+  802c7e:	eb 56                	jmp    802cd6 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802c80:	83 c0 01             	add    $0x1,%eax
+  802c83:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802c88:	7f 47                	jg     802cd1 <find_paging_env+0x5e>
+  802c8a:	83 f9 01             	cmp    $0x1,%ecx
+  802c8d:	7f 42                	jg     802cd1 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802c8f:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802c92:	c1 e2 06             	shl    $0x6,%edx
+  802c95:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802c9b:	8b 52 50             	mov    0x50(%edx),%edx
+  802c9e:	83 fa 02             	cmp    $0x2,%edx
+  802ca1:	75 dd                	jne    802c80 <find_paging_env+0xd>
+  802ca3:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802ca6:	c1 e2 06             	shl    $0x6,%edx
+  802ca9:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802caf:	8b 52 54             	mov    0x54(%edx),%edx
+  802cb2:	85 d2                	test   %edx,%edx
+  802cb4:	74 ca                	je     802c80 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802cb6:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802cb9:	c1 e2 06             	shl    $0x6,%edx
+  802cbc:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802cc2:	8b 52 48             	mov    0x48(%edx),%edx
+  802cc5:	89 14 8d 44 c0 80 00 	mov    %edx,0x80c044(,%ecx,4)
+  802ccc:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802ccf:	eb af                	jmp    802c80 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802cd1:	83 f9 02             	cmp    $0x2,%ecx
+  802cd4:	74 01                	je     802cd7 <find_paging_env+0x64>
+}
+  802cd6:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802cd7:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802cdc:	8b 40 48             	mov    0x48(%eax),%eax
+  802cdf:	83 e0 01             	and    $0x1,%eax
+  802ce2:	8b 04 85 44 c0 80 00 	mov    0x80c044(,%eax,4),%eax
+  802ce9:	a3 40 c0 80 00       	mov    %eax,0x80c040
+  802cee:	eb e6                	jmp    802cd6 <find_paging_env+0x63>
+
+00802cf0 <page_add_backed>:
+{
+  802cf0:	55                   	push   %ebp
+  802cf1:	89 e5                	mov    %esp,%ebp
+  802cf3:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802cf6:	a1 0c c0 80 00       	mov    0x80c00c,%eax
+  802cfb:	83 f8 04             	cmp    $0x4,%eax
+  802cfe:	74 35                	je     802d35 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802d00:	89 d1                	mov    %edx,%ecx
+  802d02:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802d08:	89 0c c5 20 c0 80 00 	mov    %ecx,0x80c020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802d0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d12:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802d19:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802d1f:	89 14 c5 24 c0 80 00 	mov    %edx,0x80c024(,%eax,8)
+	num_backed_ranges++;
+  802d26:	83 c0 01             	add    $0x1,%eax
+  802d29:	a3 0c c0 80 00       	mov    %eax,0x80c00c
+	return 0;
+  802d2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d33:	5d                   	pop    %ebp
+  802d34:	c3                   	ret
+		return -E_NO_MEM;
+  802d35:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802d3a:	eb f7                	jmp    802d33 <page_add_backed+0x43>
+
+00802d3c <percentage_of_pgdir_to_walk>:
+{
+  802d3c:	55                   	push   %ebp
+  802d3d:	89 e5                	mov    %esp,%ebp
+  802d3f:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802d42:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802d46:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802d49:	db 45 fc             	fildl  -0x4(%ebp)
+  802d4c:	d8 35 3c 5f 80 00    	fdivs  0x805f3c
+	return ret*ret;
+  802d52:	d8 c8                	fmul   %st(0),%st
+}
+  802d54:	c9                   	leave
+  802d55:	c3                   	ret
+
+00802d56 <nfu_with_aging_page_choice_func>:
+{
+  802d56:	55                   	push   %ebp
+  802d57:	89 e5                	mov    %esp,%ebp
+  802d59:	57                   	push   %edi
+  802d5a:	56                   	push   %esi
+  802d5b:	53                   	push   %ebx
+  802d5c:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d5f:	8b 35 30 90 80 00    	mov    0x809030,%esi
+	float pct_to_walk = 1.0f;
+  802d65:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802d67:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802d6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d71:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802d78:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d7d:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802d80:	eb 18                	jmp    802d9a <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802d82:	f7 d0                	not    %eax
+  802d84:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802d89:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802d8b:	83 c2 01             	add    $0x1,%edx
+  802d8e:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802d94:	0f 87 13 01 00 00    	ja     802ead <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802d9a:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d9e:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802da1:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802da6:	89 c1                	mov    %eax,%ecx
+  802da8:	c1 e9 0a             	shr    $0xa,%ecx
+  802dab:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802db2:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802db8:	83 f9 01             	cmp    $0x1,%ecx
+  802dbb:	75 c5                	jne    802d82 <nfu_with_aging_page_choice_func+0x2c>
+  802dbd:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802dc2:	77 be                	ja     802d82 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802dc4:	89 c1                	mov    %eax,%ecx
+  802dc6:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802dc9:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  802dcf:	0f 82 a5 00 00 00    	jb     802e7a <nfu_with_aging_page_choice_func+0x124>
+  802dd5:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802ddb:	0f 87 99 00 00 00    	ja     802e7a <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802de1:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802de8:	f6 c1 01             	test   $0x1,%cl
+  802deb:	0f 84 89 00 00 00    	je     802e7a <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802df1:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802df8:	f6 c5 04             	test   $0x4,%ch
+  802dfb:	75 7d                	jne    802e7a <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802dfd:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802e04:	f6 c5 02             	test   $0x2,%ch
+  802e07:	75 71                	jne    802e7a <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802e09:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802e10:	c1 e9 0c             	shr    $0xc,%ecx
+  802e13:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802e16:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802e1c:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802e20:	66 83 f9 01          	cmp    $0x1,%cx
+  802e24:	77 54                	ja     802e7a <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802e26:	89 f9                	mov    %edi,%ecx
+  802e28:	80 f9 ff             	cmp    $0xff,%cl
+  802e2b:	74 21                	je     802e4e <nfu_with_aging_page_choice_func+0xf8>
+  802e2d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802e34:	c1 e9 0c             	shr    $0xc,%ecx
+  802e37:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802e3a:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802e40:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802e44:	89 fb                	mov    %edi,%ebx
+  802e46:	38 d9                	cmp    %bl,%cl
+  802e48:	73 30                	jae    802e7a <nfu_with_aging_page_choice_func+0x124>
+  802e4a:	dd d8                	fstp   %st(0)
+  802e4c:	eb 02                	jmp    802e50 <nfu_with_aging_page_choice_func+0xfa>
+  802e4e:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802e50:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802e57:	c1 e9 0c             	shr    $0xc,%ecx
+  802e5a:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802e5d:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802e64:	89 fb                	mov    %edi,%ebx
+  802e66:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802e69:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802e6c:	db 45 e0             	fildl  -0x20(%ebp)
+  802e6f:	d8 35 3c 5f 80 00    	fdivs  0x805f3c
+	return ret*ret;
+  802e75:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802e77:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802e7a:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802e7d:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802e80:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802e87:	df 6d e0             	fildll -0x20(%ebp)
+  802e8a:	d9 c1                	fld    %st(1)
+  802e8c:	d8 0d 40 5f 80 00    	fmuls  0x805f40
+  802e92:	d9 c9                	fxch   %st(1)
+  802e94:	df f1                	fcomip %st(1),%st
+  802e96:	dd d8                	fstp   %st(0)
+  802e98:	0f 82 ed fe ff ff    	jb     802d8b <nfu_with_aging_page_choice_func+0x35>
+  802e9e:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802ea0:	a3 30 90 80 00       	mov    %eax,0x809030
+			return (void*)(pgnum_opt*PGSIZE);
+  802ea5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802ea8:	c1 e0 0c             	shl    $0xc,%eax
+  802eab:	eb 0e                	jmp    802ebb <nfu_with_aging_page_choice_func+0x165>
+  802ead:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802eaf:	89 f8                	mov    %edi,%eax
+  802eb1:	3c ff                	cmp    $0xff,%al
+  802eb3:	74 0e                	je     802ec3 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802eb5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802eb8:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802ebb:	83 c4 14             	add    $0x14,%esp
+  802ebe:	5b                   	pop    %ebx
+  802ebf:	5e                   	pop    %esi
+  802ec0:	5f                   	pop    %edi
+  802ec1:	5d                   	pop    %ebp
+  802ec2:	c3                   	ret
+	pgnum = 0;
+  802ec3:	c7 05 30 90 80 00 00 	movl   $0x0,0x809030
+  802eca:	00 00 00 
+	return (void*)UTOP;
+  802ecd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802ed2:	eb e7                	jmp    802ebb <nfu_with_aging_page_choice_func+0x165>
+
+00802ed4 <myRand>:
+    state = state * 1664525 + 1013904223;
+  802ed4:	69 05 40 70 80 00 0d 	imul   $0x19660d,0x807040,%eax
+  802edb:	66 19 00 
+  802ede:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802ee3:	a3 40 70 80 00       	mov    %eax,0x807040
+    return state >> 24;
+  802ee8:	c1 e8 18             	shr    $0x18,%eax
+}
+  802eeb:	c3                   	ret
+
+00802eec <random_page_choice_func>:
+{
+  802eec:	55                   	push   %ebp
+  802eed:	89 e5                	mov    %esp,%ebp
+  802eef:	57                   	push   %edi
+  802ef0:	56                   	push   %esi
+  802ef1:	53                   	push   %ebx
+  802ef2:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802ef5:	be 00 00 00 00       	mov    $0x0,%esi
+  802efa:	eb 19                	jmp    802f15 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802efc:	f7 d3                	not    %ebx
+  802efe:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802f04:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802f06:	83 c6 01             	add    $0x1,%esi
+  802f09:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802f0f:	0f 87 a0 00 00 00    	ja     802fb5 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802f15:	89 f3                	mov    %esi,%ebx
+  802f17:	03 1d 2c 90 80 00    	add    0x80902c,%ebx
+  802f1d:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802f23:	89 d8                	mov    %ebx,%eax
+  802f25:	c1 e8 0a             	shr    $0xa,%eax
+  802f28:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802f2f:	25 81 00 00 00       	and    $0x81,%eax
+  802f34:	83 f8 01             	cmp    $0x1,%eax
+  802f37:	75 c3                	jne    802efc <random_page_choice_func+0x10>
+  802f39:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802f3f:	77 bb                	ja     802efc <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802f41:	89 df                	mov    %ebx,%edi
+  802f43:	c1 e7 0c             	shl    $0xc,%edi
+  802f46:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802f49:	89 f8                	mov    %edi,%eax
+  802f4b:	e8 06 f9 ff ff       	call   802856 <page_is_clean>
+  802f50:	84 c0                	test   %al,%al
+  802f52:	0f 85 82 00 00 00    	jne    802fda <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f58:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  802f5e:	72 a6                	jb     802f06 <random_page_choice_func+0x1a>
+  802f60:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802f66:	77 9e                	ja     802f06 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802f68:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f6f:	a8 01                	test   $0x1,%al
+  802f71:	74 93                	je     802f06 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802f73:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802f7a:	f6 c4 04             	test   $0x4,%ah
+  802f7d:	75 87                	jne    802f06 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802f7f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802f86:	f6 c4 02             	test   $0x2,%ah
+  802f89:	0f 85 77 ff ff ff    	jne    802f06 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802f8f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802f96:	c1 e8 0c             	shr    $0xc,%eax
+  802f99:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802f9c:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802fa1:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802fa5:	66 83 f8 01          	cmp    $0x1,%ax
+  802fa9:	0f 87 57 ff ff ff    	ja     802f06 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  802faf:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802fb5:	e8 1a ff ff ff       	call   802ed4 <myRand>
+  802fba:	8b 3d 2c 90 80 00    	mov    0x80902c,%edi
+  802fc0:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  802fc5:	29 fe                	sub    %edi,%esi
+  802fc7:	0f be c0             	movsbl %al,%eax
+  802fca:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fcf:	f7 f6                	div    %esi
+  802fd1:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802fd3:	bb 15 00 00 00       	mov    $0x15,%ebx
+  802fd8:	eb 1c                	jmp    802ff6 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  802fda:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+			return (void*)(pgnum*PGSIZE);
+  802fe0:	e9 8f 00 00 00       	jmp    803074 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802fe5:	e8 ea fe ff ff       	call   802ed4 <myRand>
+  802fea:	0f be c0             	movsbl %al,%eax
+  802fed:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ff2:	f7 f6                	div    %esi
+  802ff4:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802ff6:	83 eb 01             	sub    $0x1,%ebx
+  802ff9:	0f 84 c2 00 00 00    	je     8030c1 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  802fff:	89 d0                	mov    %edx,%eax
+  803001:	c1 e8 0a             	shr    $0xa,%eax
+  803004:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80300b:	25 81 00 00 00       	and    $0x81,%eax
+  803010:	83 f8 01             	cmp    $0x1,%eax
+  803013:	75 d0                	jne    802fe5 <random_page_choice_func+0xf9>
+  803015:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  80301b:	77 c8                	ja     802fe5 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  80301d:	89 d0                	mov    %edx,%eax
+  80301f:	c1 e0 0c             	shl    $0xc,%eax
+  803022:	3d 2c 10 81 00       	cmp    $0x81102c,%eax
+  803027:	72 56                	jb     80307f <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  803029:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  80302e:	77 65                	ja     803095 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  803030:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  803037:	f6 c1 01             	test   $0x1,%cl
+  80303a:	74 59                	je     803095 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  80303c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  803043:	f6 c5 04             	test   $0x4,%ch
+  803046:	75 4d                	jne    803095 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  803048:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  80304f:	f6 c5 02             	test   $0x2,%ch
+  803052:	75 41                	jne    803095 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  803054:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80305b:	c1 ea 0c             	shr    $0xc,%edx
+  80305e:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  803061:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  803067:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  80306b:	66 83 fa 01          	cmp    $0x1,%dx
+  80306f:	77 3a                	ja     8030ab <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  803071:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  803074:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803077:	83 c4 1c             	add    $0x1c,%esp
+  80307a:	5b                   	pop    %ebx
+  80307b:	5e                   	pop    %esi
+  80307c:	5f                   	pop    %edi
+  80307d:	5d                   	pop    %ebp
+  80307e:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  80307f:	e8 50 fe ff ff       	call   802ed4 <myRand>
+  803084:	0f be c0             	movsbl %al,%eax
+  803087:	ba 00 00 00 00       	mov    $0x0,%edx
+  80308c:	f7 f6                	div    %esi
+  80308e:	01 fa                	add    %edi,%edx
+			continue;
+  803090:	e9 61 ff ff ff       	jmp    802ff6 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  803095:	e8 3a fe ff ff       	call   802ed4 <myRand>
+  80309a:	0f be c0             	movsbl %al,%eax
+  80309d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030a2:	f7 f6                	div    %esi
+  8030a4:	01 fa                	add    %edi,%edx
+			continue;
+  8030a6:	e9 4b ff ff ff       	jmp    802ff6 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  8030ab:	e8 24 fe ff ff       	call   802ed4 <myRand>
+  8030b0:	0f be c0             	movsbl %al,%eax
+  8030b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030b8:	f7 f6                	div    %esi
+  8030ba:	01 fa                	add    %edi,%edx
+			continue;
+  8030bc:	e9 35 ff ff ff       	jmp    802ff6 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  8030c1:	c7 05 2c 90 80 00 00 	movl   $0x0,0x80902c
+  8030c8:	00 00 00 
+	return (void*)UTOP;
+  8030cb:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  8030d2:	eb a0                	jmp    803074 <random_page_choice_func+0x188>
+
+008030d4 <nfu>:
+{
+  8030d4:	55                   	push   %ebp
+  8030d5:	89 e5                	mov    %esp,%ebp
+  8030d7:	57                   	push   %edi
+  8030d8:	56                   	push   %esi
+  8030d9:	53                   	push   %ebx
+  8030da:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8030dd:	8b 35 28 90 80 00    	mov    0x809028,%esi
+	float pct_to_walk = 1.0f;
+  8030e3:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  8030e5:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8030ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030ef:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8030f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030fb:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  8030fe:	eb 18                	jmp    803118 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803100:	f7 d0                	not    %eax
+  803102:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803107:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803109:	83 c2 01             	add    $0x1,%edx
+  80310c:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803112:	0f 87 13 01 00 00    	ja     80322b <nfu+0x157>
+		++num_searched_ptes;
+  803118:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80311c:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  80311f:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803124:	89 c1                	mov    %eax,%ecx
+  803126:	c1 e9 0a             	shr    $0xa,%ecx
+  803129:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  803130:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803136:	83 f9 01             	cmp    $0x1,%ecx
+  803139:	75 c5                	jne    803100 <nfu+0x2c>
+  80313b:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803140:	77 be                	ja     803100 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803142:	89 c1                	mov    %eax,%ecx
+  803144:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803147:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  80314d:	0f 82 a5 00 00 00    	jb     8031f8 <nfu+0x124>
+  803153:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803159:	0f 87 99 00 00 00    	ja     8031f8 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80315f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803166:	f6 c1 01             	test   $0x1,%cl
+  803169:	0f 84 89 00 00 00    	je     8031f8 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80316f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803176:	f6 c5 04             	test   $0x4,%ch
+  803179:	75 7d                	jne    8031f8 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80317b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803182:	f6 c5 02             	test   $0x2,%ch
+  803185:	75 71                	jne    8031f8 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803187:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80318e:	c1 e9 0c             	shr    $0xc,%ecx
+  803191:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803194:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80319a:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  80319e:	66 83 f9 01          	cmp    $0x1,%cx
+  8031a2:	77 54                	ja     8031f8 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  8031a4:	89 f9                	mov    %edi,%ecx
+  8031a6:	80 f9 ff             	cmp    $0xff,%cl
+  8031a9:	74 21                	je     8031cc <nfu+0xf8>
+  8031ab:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8031b2:	c1 e9 0c             	shr    $0xc,%ecx
+  8031b5:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8031b8:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8031be:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  8031c2:	89 fb                	mov    %edi,%ebx
+  8031c4:	38 d9                	cmp    %bl,%cl
+  8031c6:	73 30                	jae    8031f8 <nfu+0x124>
+  8031c8:	dd d8                	fstp   %st(0)
+  8031ca:	eb 02                	jmp    8031ce <nfu+0xfa>
+  8031cc:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  8031ce:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8031d5:	c1 e9 0c             	shr    $0xc,%ecx
+  8031d8:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8031db:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  8031e2:	89 fb                	mov    %edi,%ebx
+  8031e4:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  8031e7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8031ea:	db 45 e0             	fildl  -0x20(%ebp)
+  8031ed:	d8 35 3c 5f 80 00    	fdivs  0x805f3c
+	return ret*ret;
+  8031f3:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8031f5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8031f8:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8031fb:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8031fe:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803205:	df 6d e0             	fildll -0x20(%ebp)
+  803208:	d9 c1                	fld    %st(1)
+  80320a:	d8 0d 40 5f 80 00    	fmuls  0x805f40
+  803210:	d9 c9                	fxch   %st(1)
+  803212:	df f1                	fcomip %st(1),%st
+  803214:	dd d8                	fstp   %st(0)
+  803216:	0f 82 ed fe ff ff    	jb     803109 <nfu+0x35>
+  80321c:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  80321e:	a3 28 90 80 00       	mov    %eax,0x809028
+			return (void*)(pgnum_opt*PGSIZE);
+  803223:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803226:	c1 e0 0c             	shl    $0xc,%eax
+  803229:	eb 0e                	jmp    803239 <nfu+0x165>
+  80322b:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  80322d:	89 f8                	mov    %edi,%eax
+  80322f:	3c ff                	cmp    $0xff,%al
+  803231:	74 0e                	je     803241 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  803233:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803236:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803239:	83 c4 14             	add    $0x14,%esp
+  80323c:	5b                   	pop    %ebx
+  80323d:	5e                   	pop    %esi
+  80323e:	5f                   	pop    %edi
+  80323f:	5d                   	pop    %ebp
+  803240:	c3                   	ret
+	pgnum = 0;
+  803241:	c7 05 28 90 80 00 00 	movl   $0x0,0x809028
+  803248:	00 00 00 
+	return (void*)UTOP;
+  80324b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803250:	eb e7                	jmp    803239 <nfu+0x165>
+
+00803252 <lru>:
+{
+  803252:	55                   	push   %ebp
+  803253:	89 e5                	mov    %esp,%ebp
+  803255:	57                   	push   %edi
+  803256:	56                   	push   %esi
+  803257:	53                   	push   %ebx
+  803258:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80325b:	8b 3d 24 90 80 00    	mov    0x809024,%edi
+	long long time_min = 9223372036854775807;
+  803261:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  803268:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80326f:	be 00 00 00 00       	mov    $0x0,%esi
+  803274:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80327b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803280:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  803283:	eb 18                	jmp    80329d <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803285:	f7 d0                	not    %eax
+  803287:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80328c:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80328e:	83 c2 01             	add    $0x1,%edx
+  803291:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803297:	0f 87 fa 00 00 00    	ja     803397 <lru+0x145>
+		++num_searched_ptes;
+  80329d:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8032a0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8032a3:	01 d0                	add    %edx,%eax
+  8032a5:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8032aa:	89 c1                	mov    %eax,%ecx
+  8032ac:	c1 e9 0a             	shr    $0xa,%ecx
+  8032af:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8032b6:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8032bc:	83 f9 01             	cmp    $0x1,%ecx
+  8032bf:	75 c4                	jne    803285 <lru+0x33>
+  8032c1:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8032c6:	77 bd                	ja     803285 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8032c8:	89 c1                	mov    %eax,%ecx
+  8032ca:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8032cd:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8032d3:	0f 87 92 00 00 00    	ja     80336b <lru+0x119>
+  8032d9:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  8032df:	0f 82 86 00 00 00    	jb     80336b <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8032e5:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8032ec:	f6 c1 01             	test   $0x1,%cl
+  8032ef:	74 7a                	je     80336b <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8032f1:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8032f8:	f6 c5 04             	test   $0x4,%ch
+  8032fb:	75 6e                	jne    80336b <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8032fd:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803304:	f6 c5 02             	test   $0x2,%ch
+  803307:	75 62                	jne    80336b <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803309:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803310:	c1 e9 0c             	shr    $0xc,%ecx
+  803313:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803316:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80331c:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803320:	66 83 f9 01          	cmp    $0x1,%cx
+  803324:	77 45                	ja     80336b <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  803326:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80332d:	c1 e9 0c             	shr    $0xc,%ecx
+  803330:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803333:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803339:	8b 59 14             	mov    0x14(%ecx),%ebx
+  80333c:	8b 49 10             	mov    0x10(%ecx),%ecx
+  80333f:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  803342:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803345:	19 df                	sbb    %ebx,%edi
+  803347:	7c 22                	jl     80336b <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  803349:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803350:	c1 e9 0c             	shr    $0xc,%ecx
+  803353:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803356:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80335c:	8b 59 14             	mov    0x14(%ecx),%ebx
+  80335f:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803362:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  803365:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803368:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  80336b:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  80336e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803375:	df 6d e0             	fildll -0x20(%ebp)
+  803378:	d9 05 40 5f 80 00    	flds   0x805f40
+  80337e:	d9 c9                	fxch   %st(1)
+  803380:	df f1                	fcomip %st(1),%st
+  803382:	dd d8                	fstp   %st(0)
+  803384:	0f 82 04 ff ff ff    	jb     80328e <lru+0x3c>
+			pgnum = pgnum_actual;
+  80338a:	a3 24 90 80 00       	mov    %eax,0x809024
+			return (void*)(pgnum_opt*PGSIZE);
+  80338f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803392:	c1 e0 0c             	shl    $0xc,%eax
+  803395:	eb 06                	jmp    80339d <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  803397:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80339a:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80339d:	83 c4 1c             	add    $0x1c,%esp
+  8033a0:	5b                   	pop    %ebx
+  8033a1:	5e                   	pop    %esi
+  8033a2:	5f                   	pop    %edi
+  8033a3:	5d                   	pop    %ebp
+  8033a4:	c3                   	ret
+
+008033a5 <set_page_choice_func>:
+{
+  8033a5:	55                   	push   %ebp
+  8033a6:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  8033a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033ab:	a3 3c 70 80 00       	mov    %eax,0x80703c
+}
+  8033b0:	5d                   	pop    %ebp
+  8033b1:	c3                   	ret
+
+008033b2 <get_page_choice>:
+{
+  8033b2:	55                   	push   %ebp
+  8033b3:	89 e5                	mov    %esp,%ebp
+  8033b5:	57                   	push   %edi
+  8033b6:	56                   	push   %esi
+  8033b7:	53                   	push   %ebx
+  8033b8:	83 ec 24             	sub    $0x24,%esp
+  8033bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8033be:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  8033c1:	57                   	push   %edi
+  8033c2:	56                   	push   %esi
+  8033c3:	ff 15 3c 70 80 00    	call   *0x80703c
+  8033c9:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8033cb:	83 c4 10             	add    $0x10,%esp
+  8033ce:	eb 25                	jmp    8033f5 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  8033d0:	83 ec 08             	sub    $0x8,%esp
+  8033d3:	c1 e0 16             	shl    $0x16,%eax
+  8033d6:	50                   	push   %eax
+  8033d7:	6a 00                	push   $0x0
+  8033d9:	e8 38 db ff ff       	call   800f16 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8033de:	83 c4 10             	add    $0x10,%esp
+  8033e1:	85 c0                	test   %eax,%eax
+  8033e3:	75 43                	jne    803428 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  8033e5:	83 ec 08             	sub    $0x8,%esp
+  8033e8:	57                   	push   %edi
+  8033e9:	56                   	push   %esi
+  8033ea:	ff 15 3c 70 80 00    	call   *0x80703c
+  8033f0:	89 c3                	mov    %eax,%ebx
+  8033f2:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8033f5:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8033f8:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8033fe:	0f 86 ae 00 00 00    	jbe    8034b2 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803404:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  803409:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803410:	81 e2 81 00 00 00    	and    $0x81,%edx
+  803416:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  80341c:	74 b2                	je     8033d0 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80341e:	83 c0 01             	add    $0x1,%eax
+  803421:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  803426:	75 e1                	jne    803409 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803428:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80342b:	05 00 10 40 11       	add    $0x11401000,%eax
+  803430:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803435:	76 1f                	jbe    803456 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  803437:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  80343c:	89 d8                	mov    %ebx,%eax
+  80343e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803441:	5b                   	pop    %ebx
+  803442:	5e                   	pop    %esi
+  803443:	5f                   	pop    %edi
+  803444:	5d                   	pop    %ebp
+  803445:	c3                   	ret
+		sys_page_split(0, pg_out);
+  803446:	83 ec 08             	sub    $0x8,%esp
+  803449:	53                   	push   %ebx
+  80344a:	6a 00                	push   $0x0
+  80344c:	e8 c5 da ff ff       	call   800f16 <sys_page_split>
+  803451:	83 c4 10             	add    $0x10,%esp
+  803454:	eb 6c                	jmp    8034c2 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  803456:	83 ec 04             	sub    $0x4,%esp
+  803459:	68 e8 5a 80 00       	push   $0x805ae8
+  80345e:	68 cc 01 00 00       	push   $0x1cc
+  803463:	68 55 5a 80 00       	push   $0x805a55
+  803468:	e8 2d ce ff ff       	call   80029a <_panic>
+		panic("We tried to page out code pages\n");
+  80346d:	83 ec 04             	sub    $0x4,%esp
+  803470:	68 18 5b 80 00       	push   $0x805b18
+  803475:	68 d6 01 00 00       	push   $0x1d6
+  80347a:	68 55 5a 80 00       	push   $0x805a55
+  80347f:	e8 16 ce ff ff       	call   80029a <_panic>
+		panic("Invalid mapping for the va\n");
+  803484:	83 ec 04             	sub    $0x4,%esp
+  803487:	68 62 5a 80 00       	push   $0x805a62
+  80348c:	68 da 01 00 00       	push   $0x1da
+  803491:	68 55 5a 80 00       	push   $0x805a55
+  803496:	e8 ff cd ff ff       	call   80029a <_panic>
+		panic("We tried to page out a shared page\n");
+  80349b:	83 ec 04             	sub    $0x4,%esp
+  80349e:	68 3c 5b 80 00       	push   $0x805b3c
+  8034a3:	68 e0 01 00 00       	push   $0x1e0
+  8034a8:	68 55 5a 80 00       	push   $0x805a55
+  8034ad:	e8 e8 cd ff ff       	call   80029a <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  8034b2:	89 de                	mov    %ebx,%esi
+  8034b4:	c1 ee 16             	shr    $0x16,%esi
+  8034b7:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8034be:	a8 80                	test   $0x80,%al
+  8034c0:	75 84                	jne    803446 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  8034c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8034c5:	05 00 10 40 11       	add    $0x11401000,%eax
+  8034ca:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8034cf:	76 85                	jbe    803456 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  8034d1:	89 d8                	mov    %ebx,%eax
+  8034d3:	e8 7e f3 ff ff       	call   802856 <page_is_clean>
+  8034d8:	84 c0                	test   %al,%al
+  8034da:	0f 85 5c ff ff ff    	jne    80343c <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  8034e0:	81 7d e4 2c 10 81 00 	cmpl   $0x81102c,-0x1c(%ebp)
+  8034e7:	76 84                	jbe    80346d <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  8034e9:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8034f0:	a8 01                	test   $0x1,%al
+  8034f2:	74 90                	je     803484 <get_page_choice+0xd2>
+  8034f4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8034f7:	c1 e8 0c             	shr    $0xc,%eax
+  8034fa:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803501:	f6 c2 01             	test   $0x1,%dl
+  803504:	0f 84 7a ff ff ff    	je     803484 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  80350a:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  803511:	f6 c2 01             	test   $0x1,%dl
+  803514:	74 85                	je     80349b <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803516:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  80351d:	f6 c2 01             	test   $0x1,%dl
+  803520:	0f 84 75 ff ff ff    	je     80349b <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  803526:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  80352d:	f6 c6 04             	test   $0x4,%dh
+  803530:	0f 85 65 ff ff ff    	jne    80349b <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  803536:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  80353d:	f6 c6 02             	test   $0x2,%dh
+  803540:	0f 85 55 ff ff ff    	jne    80349b <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  803546:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80354d:	c1 e8 0c             	shr    $0xc,%eax
+  803550:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803553:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803558:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80355c:	66 83 f8 01          	cmp    $0x1,%ax
+  803560:	0f 86 d6 fe ff ff    	jbe    80343c <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  803566:	83 ec 04             	sub    $0x4,%esp
+  803569:	68 60 5b 80 00       	push   $0x805b60
+  80356e:	68 e2 01 00 00       	push   $0x1e2
+  803573:	68 55 5a 80 00       	push   $0x805a55
+  803578:	e8 1d cd ff ff       	call   80029a <_panic>
+
+0080357d <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  80357d:	55                   	push   %ebp
+  80357e:	89 e5                	mov    %esp,%ebp
+  803580:	57                   	push   %edi
+  803581:	56                   	push   %esi
+  803582:	53                   	push   %ebx
+  803583:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  803586:	e8 e8 f6 ff ff       	call   802c73 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  80358b:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  803590:	85 c0                	test   %eax,%eax
+  803592:	74 41                	je     8035d5 <page_share_paged_out+0x58>
+  803594:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  80359b:	0f 84 fd 00 00 00    	je     80369e <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  8035a1:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  8035a8:	00 00 00 
+  8035ab:	c7 05 00 b0 80 00 00 	movl   $0x0,0x80b000
+  8035b2:	00 00 00 
+  8035b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035ba:	eb 2c                	jmp    8035e8 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8035bc:	83 c3 04             	add    $0x4,%ebx
+  8035bf:	39 f3                	cmp    %esi,%ebx
+  8035c1:	74 1a                	je     8035dd <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  8035c3:	8b 03                	mov    (%ebx),%eax
+  8035c5:	a8 01                	test   $0x1,%al
+  8035c7:	74 f3                	je     8035bc <page_share_paged_out+0x3f>
+  8035c9:	c1 e8 0c             	shr    $0xc,%eax
+  8035cc:	e8 2b f5 ff ff       	call   802afc <page_share_slot>
+  8035d1:	85 c0                	test   %eax,%eax
+  8035d3:	79 e7                	jns    8035bc <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  8035d5:	83 c4 0c             	add    $0xc,%esp
+  8035d8:	5b                   	pop    %ebx
+  8035d9:	5e                   	pop    %esi
+  8035da:	5f                   	pop    %edi
+  8035db:	5d                   	pop    %ebp
+  8035dc:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  8035dd:	83 c7 04             	add    $0x4,%edi
+  8035e0:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  8035e6:	74 1b                	je     803603 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  8035e8:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  8035ed:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  8035f0:	f6 c3 01             	test   $0x1,%bl
+  8035f3:	74 e8                	je     8035dd <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  8035f5:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8035fb:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  803601:	eb bc                	jmp    8035bf <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803603:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803608:	eb 11                	jmp    80361b <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  80360a:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803610:	83 c3 01             	add    $0x1,%ebx
+  803613:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803619:	77 41                	ja     80365c <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  80361b:	89 d8                	mov    %ebx,%eax
+  80361d:	c1 e8 0a             	shr    $0xa,%eax
+  803620:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803627:	25 81 00 00 00       	and    $0x81,%eax
+  80362c:	83 f8 01             	cmp    $0x1,%eax
+  80362f:	75 d9                	jne    80360a <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803631:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803638:	25 81 00 00 00       	and    $0x81,%eax
+  80363d:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803642:	75 cc                	jne    803610 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803644:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80364b:	c1 e8 0c             	shr    $0xc,%eax
+  80364e:	e8 a9 f4 ff ff       	call   802afc <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803653:	85 c0                	test   %eax,%eax
+  803655:	79 b9                	jns    803610 <page_share_paged_out+0x93>
+  803657:	e9 79 ff ff ff       	jmp    8035d5 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80365c:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  803663:	75 13                	jne    803678 <page_share_paged_out+0xfb>
+  803665:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  80366c:	75 1d                	jne    80368b <page_share_paged_out+0x10e>
+	return 0;
+  80366e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803673:	e9 5d ff ff ff       	jmp    8035d5 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367d:	e8 46 f4 ff ff       	call   802ac8 <page_share_send>
+  803682:	85 c0                	test   %eax,%eax
+  803684:	79 df                	jns    803665 <page_share_paged_out+0xe8>
+  803686:	e9 4a ff ff ff       	jmp    8035d5 <page_share_paged_out+0x58>
+  80368b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803690:	e8 33 f4 ff ff       	call   802ac8 <page_share_send>
+  803695:	85 c0                	test   %eax,%eax
+  803697:	79 d5                	jns    80366e <page_share_paged_out+0xf1>
+  803699:	e9 37 ff ff ff       	jmp    8035d5 <page_share_paged_out+0x58>
+		return 0;
+  80369e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a3:	e9 2d ff ff ff       	jmp    8035d5 <page_share_paged_out+0x58>
+
+008036a8 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  8036a8:	55                   	push   %ebp
+  8036a9:	89 e5                	mov    %esp,%ebp
+  8036ab:	56                   	push   %esi
+  8036ac:	53                   	push   %ebx
+  8036ad:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  8036b0:	e8 be f5 ff ff       	call   802c73 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  8036b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  8036ba:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  8036c1:	0f 84 82 00 00 00    	je     803749 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  8036c7:	83 ec 0c             	sub    $0xc,%esp
+  8036ca:	68 00 10 00 00       	push   $0x1000
+  8036cf:	e8 84 11 00 00       	call   804858 <malloc>
+  8036d4:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  8036d6:	83 c4 0c             	add    $0xc,%esp
+  8036d9:	6a 14                	push   $0x14
+  8036db:	6a 00                	push   $0x0
+  8036dd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8036e0:	50                   	push   %eax
+  8036e1:	e8 c7 d3 ff ff       	call   800aad <memset>
+  8036e6:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  8036e9:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  8036ee:	83 ec 0c             	sub    $0xc,%esp
+  8036f1:	6a 07                	push   $0x7
+  8036f3:	6a 01                	push   $0x1
+  8036f5:	53                   	push   %ebx
+  8036f6:	6a 03                	push   $0x3
+  8036f8:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  8036ff:	e8 b7 19 00 00       	call   8050bb <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  803704:	8b 03                	mov    (%ebx),%eax
+  803706:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803709:	8b 43 04             	mov    0x4(%ebx),%eax
+  80370c:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  80370f:	8b 43 08             	mov    0x8(%ebx),%eax
+  803712:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  803715:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803718:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  80371b:	8b 43 10             	mov    0x10(%ebx),%eax
+  80371e:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803721:	83 c6 01             	add    $0x1,%esi
+  803724:	83 c4 20             	add    $0x20,%esp
+  803727:	83 fe 02             	cmp    $0x2,%esi
+  80372a:	75 c2                	jne    8036ee <get_paging_stats+0x46>
+	}
+	*stats = total;
+  80372c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80372f:	89 03                	mov    %eax,(%ebx)
+  803731:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803734:	89 43 04             	mov    %eax,0x4(%ebx)
+  803737:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80373a:	89 43 08             	mov    %eax,0x8(%ebx)
+  80373d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803740:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803743:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803746:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  803749:	89 d8                	mov    %ebx,%eax
+  80374b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80374e:	5b                   	pop    %ebx
+  80374f:	5e                   	pop    %esi
+  803750:	5d                   	pop    %ebp
+  803751:	c3                   	ret
+
+00803752 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803752:	55                   	push   %ebp
+  803753:	89 e5                	mov    %esp,%ebp
+  803755:	53                   	push   %ebx
+  803756:	83 ec 10             	sub    $0x10,%esp
+  803759:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  80375c:	68 7c 5a 80 00       	push   $0x805a7c
+  803761:	e8 0f cc ff ff       	call   800375 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  803766:	83 c4 08             	add    $0x8,%esp
+  803769:	ff 33                	push   (%ebx)
+  80376b:	68 94 5b 80 00       	push   $0x805b94
+  803770:	e8 00 cc ff ff       	call   800375 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  803775:	83 c4 08             	add    $0x8,%esp
+  803778:	ff 73 04             	push   0x4(%ebx)
+  80377b:	68 7e 5a 80 00       	push   $0x805a7e
+  803780:	e8 f0 cb ff ff       	call   800375 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  803785:	83 c4 08             	add    $0x8,%esp
+  803788:	ff 73 08             	push   0x8(%ebx)
+  80378b:	68 b4 5b 80 00       	push   $0x805bb4
+  803790:	e8 e0 cb ff ff       	call   800375 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  803795:	83 c4 08             	add    $0x8,%esp
+  803798:	ff 73 0c             	push   0xc(%ebx)
+  80379b:	68 d8 5b 80 00       	push   $0x805bd8
+  8037a0:	e8 d0 cb ff ff       	call   800375 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  8037a5:	83 c4 08             	add    $0x8,%esp
+  8037a8:	ff 73 10             	push   0x10(%ebx)
+  8037ab:	68 fc 5b 80 00       	push   $0x805bfc
+  8037b0:	e8 c0 cb ff ff       	call   800375 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  8037b5:	83 c4 08             	add    $0x8,%esp
+  8037b8:	ff 35 08 c0 80 00    	push   0x80c008
+  8037be:	68 38 5c 80 00       	push   $0x805c38
+  8037c3:	e8 ad cb ff ff       	call   800375 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  8037c8:	83 c4 08             	add    $0x8,%esp
+  8037cb:	ff 35 04 c0 80 00    	push   0x80c004
+  8037d1:	68 6c 5c 80 00       	push   $0x805c6c
+  8037d6:	e8 9a cb ff ff       	call   800375 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  8037db:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8037e0:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  8037e3:	8b 50 68             	mov    0x68(%eax),%edx
+  8037e6:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  8037e9:	51                   	push   %ecx
+  8037ea:	52                   	push   %edx
+  8037eb:	50                   	push   %eax
+  8037ec:	68 ac 5c 80 00       	push   $0x805cac
+  8037f1:	e8 7f cb ff ff       	call   800375 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  8037f6:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8037fb:	8b 40 70             	mov    0x70(%eax),%eax
+  8037fe:	83 c4 18             	add    $0x18,%esp
+  803801:	50                   	push   %eax
+  803802:	68 e0 5c 80 00       	push   $0x805ce0
+  803807:	e8 69 cb ff ff       	call   800375 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  80380c:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  803812:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803818:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  80381d:	51                   	push   %ecx
+  80381e:	52                   	push   %edx
+  80381f:	50                   	push   %eax
+  803820:	68 10 5d 80 00       	push   $0x805d10
+  803825:	e8 4b cb ff ff       	call   800375 <cprintf>
+	cprintf("\n");
+  80382a:	83 c4 14             	add    $0x14,%esp
+  80382d:	68 7c 5a 80 00       	push   $0x805a7c
+  803832:	e8 3e cb ff ff       	call   800375 <cprintf>
+}
+  803837:	83 c4 10             	add    $0x10,%esp
+  80383a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80383d:	c9                   	leave
+  80383e:	c3                   	ret
+
+0080383f <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  80383f:	55                   	push   %ebp
+  803840:	89 e5                	mov    %esp,%ebp
+  803842:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  803845:	e8 5e fe ff ff       	call   8036a8 <get_paging_stats>
+  80384a:	83 ec 0c             	sub    $0xc,%esp
+  80384d:	50                   	push   %eax
+  80384e:	e8 ff fe ff ff       	call   803752 <print_paging_stats>
+}
+  803853:	83 c4 10             	add    $0x10,%esp
+  803856:	c9                   	leave
+  803857:	c3                   	ret
+
+00803858 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803858:	55                   	push   %ebp
+  803859:	89 e5                	mov    %esp,%ebp
+  80385b:	53                   	push   %ebx
+  80385c:	83 ec 04             	sub    $0x4,%esp
+  80385f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803862:	eb 13                	jmp    803877 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803864:	83 ec 04             	sub    $0x4,%esp
+  803867:	6a ff                	push   $0xffffffff
+  803869:	53                   	push   %ebx
+  80386a:	68 00 f0 ff ee       	push   $0xeefff000
+  80386f:	e8 b4 da ff ff       	call   801328 <sys_futex_wait>
+  803874:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803877:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  80387c:	39 d8                	cmp    %ebx,%eax
+  80387e:	74 e4                	je     803864 <mem_pressure_wait+0xc>
+	return now;
+}
+  803880:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803883:	c9                   	leave
+  803884:	c3                   	ret
+
+00803885 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803885:	55                   	push   %ebp
+  803886:	89 e5                	mov    %esp,%ebp
+  803888:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  80388b:	68 f7 44 80 00       	push   $0x8044f7
+  803890:	e8 32 16 00 00       	call   804ec7 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803895:	c7 05 14 f9 80 00 00 	movl   $0xdeadb000,0x80f914
+  80389c:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  80389f:	83 c4 0c             	add    $0xc,%esp
+  8038a2:	68 07 02 00 00       	push   $0x207
+  8038a7:	68 00 b0 ad de       	push   $0xdeadb000
+  8038ac:	6a 00                	push   $0x0
+  8038ae:	e8 9c d5 ff ff       	call   800e4f <sys_page_alloc>
+  8038b3:	83 c4 10             	add    $0x10,%esp
+  8038b6:	85 c0                	test   %eax,%eax
+  8038b8:	78 0c                	js     8038c6 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  8038ba:	e8 b4 f3 ff ff       	call   802c73 <find_paging_env>
+	page_ring_ready();
+  8038bf:	e8 7f f2 ff ff       	call   802b43 <page_ring_ready>
+}
+  8038c4:	c9                   	leave
+  8038c5:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  8038c6:	50                   	push   %eax
+  8038c7:	68 9c 5a 80 00       	push   $0x805a9c
+  8038cc:	68 13 05 00 00       	push   $0x513
+  8038d1:	68 55 5a 80 00       	push   $0x805a55
+  8038d6:	e8 bf c9 ff ff       	call   80029a <_panic>
+
+008038db <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  8038db:	55                   	push   %ebp
+  8038dc:	89 e5                	mov    %esp,%ebp
+  8038de:	57                   	push   %edi
+  8038df:	56                   	push   %esi
+  8038e0:	53                   	push   %ebx
+  8038e1:	83 ec 0c             	sub    $0xc,%esp
+  8038e4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  8038e7:	89 fa                	mov    %edi,%edx
+  8038e9:	c1 ea 16             	shr    $0x16,%edx
+  8038ec:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  8038f1:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  8038f4:	f6 06 01             	testb  $0x1,(%esi)
+  8038f7:	75 3e                	jne    803937 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  8038f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  8038fe:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803902:	74 47                	je     80394b <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  803904:	83 ec 0c             	sub    $0xc,%esp
+  803907:	6a 01                	push   $0x1
+  803909:	e8 f2 11 00 00       	call   804b00 <va_alloc>
+  80390e:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  803910:	83 c4 10             	add    $0x10,%esp
+  803913:	85 c0                	test   %eax,%eax
+  803915:	74 34                	je     80394b <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803917:	6a 00                	push   $0x0
+  803919:	68 07 02 00 00       	push   $0x207
+  80391e:	50                   	push   %eax
+  80391f:	6a 00                	push   $0x0
+  803921:	e8 df 02 00 00       	call   803c05 <page_alloc>
+  803926:	83 c4 10             	add    $0x10,%esp
+  803929:	85 c0                	test   %eax,%eax
+  80392b:	78 28                	js     803955 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  80392d:	f6 06 01             	testb  $0x1,(%esi)
+  803930:	75 38                	jne    80396a <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803932:	83 cb 01             	or     $0x1,%ebx
+  803935:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803937:	89 f8                	mov    %edi,%eax
+  803939:	c1 e8 0a             	shr    $0xa,%eax
+  80393c:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803941:	8b 1e                	mov    (%esi),%ebx
+  803943:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803949:	01 c3                	add    %eax,%ebx
+}
+  80394b:	89 d8                	mov    %ebx,%eax
+  80394d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803950:	5b                   	pop    %ebx
+  803951:	5e                   	pop    %esi
+  803952:	5f                   	pop    %edi
+  803953:	5d                   	pop    %ebp
+  803954:	c3                   	ret
+			va_free(page, 1);
+  803955:	83 ec 08             	sub    $0x8,%esp
+  803958:	6a 01                	push   $0x1
+  80395a:	53                   	push   %ebx
+  80395b:	e8 d8 12 00 00       	call   804c38 <va_free>
+			return NULL;
+  803960:	83 c4 10             	add    $0x10,%esp
+  803963:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803968:	eb e1                	jmp    80394b <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  80396a:	83 ec 08             	sub    $0x8,%esp
+  80396d:	53                   	push   %ebx
+  80396e:	6a 00                	push   $0x0
+  803970:	e8 5f d5 ff ff       	call   800ed4 <sys_page_unmap>
+			va_free(page, 1);
+  803975:	83 c4 08             	add    $0x8,%esp
+  803978:	6a 01                	push   $0x1
+  80397a:	53                   	push   %ebx
+  80397b:	e8 b8 12 00 00       	call   804c38 <va_free>
+  803980:	83 c4 10             	add    $0x10,%esp
+  803983:	eb b2                	jmp    803937 <umapdir_walk+0x5c>
+
+00803985 <page_out>:
+{
+  803985:	55                   	push   %ebp
+  803986:	89 e5                	mov    %esp,%ebp
+  803988:	57                   	push   %edi
+  803989:	56                   	push   %esi
+  80398a:	53                   	push   %ebx
+  80398b:	83 ec 5c             	sub    $0x5c,%esp
+  80398e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803991:	e8 dd f2 ff ff       	call   802c73 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803996:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  80399b:	85 c0                	test   %eax,%eax
+  80399d:	74 1e                	je     8039bd <page_out+0x38>
+  80399f:	83 ec 0c             	sub    $0xc,%esp
+  8039a2:	6a 00                	push   $0x0
+  8039a4:	6a 00                	push   $0x0
+  8039a6:	6a 00                	push   $0x0
+  8039a8:	6a 08                	push   $0x8
+  8039aa:	50                   	push   %eax
+  8039ab:	e8 0b 17 00 00       	call   8050bb <ipc_call>
+  8039b0:	89 c3                	mov    %eax,%ebx
+  8039b2:	83 c4 20             	add    $0x20,%esp
+  8039b5:	85 c0                	test   %eax,%eax
+  8039b7:	0f 84 ac 00 00 00    	je     803a69 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  8039bd:	83 ec 08             	sub    $0x8,%esp
+  8039c0:	ff 75 0c             	push   0xc(%ebp)
+  8039c3:	57                   	push   %edi
+  8039c4:	e8 e9 f9 ff ff       	call   8033b2 <get_page_choice>
+  8039c9:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  8039cb:	83 c4 10             	add    $0x10,%esp
+  8039ce:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8039d3:	0f 84 18 02 00 00    	je     803bf1 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  8039d9:	e8 78 ee ff ff       	call   802856 <page_is_clean>
+  8039de:	84 c0                	test   %al,%al
+  8039e0:	0f 85 8c 00 00 00    	jne    803a72 <page_out+0xed>
+	if (pagingenv == 0)
+  8039e6:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  8039ed:	0f 84 08 02 00 00    	je     803bfb <page_out+0x276>
+	if (page_ring_ready())
+  8039f3:	e8 4b f1 ff ff       	call   802b43 <page_ring_ready>
+  8039f8:	89 c3                	mov    %eax,%ebx
+  8039fa:	85 c0                	test   %eax,%eax
+  8039fc:	0f 85 89 00 00 00    	jne    803a8b <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  803a02:	83 ec 0c             	sub    $0xc,%esp
+  803a05:	6a 05                	push   $0x5
+  803a07:	6a 01                	push   $0x1
+  803a09:	56                   	push   %esi
+  803a0a:	6a 01                	push   $0x1
+  803a0c:	ff 35 40 c0 80 00    	push   0x80c040
+  803a12:	e8 a4 16 00 00       	call   8050bb <ipc_call>
+  803a17:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803a19:	83 c4 20             	add    $0x20,%esp
+  803a1c:	85 c0                	test   %eax,%eax
+  803a1e:	0f 88 b8 01 00 00    	js     803bdc <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803a24:	89 f0                	mov    %esi,%eax
+  803a26:	c1 e8 0c             	shr    $0xc,%eax
+  803a29:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803a30:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803a33:	83 ec 08             	sub    $0x8,%esp
+  803a36:	56                   	push   %esi
+  803a37:	6a 00                	push   $0x0
+  803a39:	e8 96 d4 ff ff       	call   800ed4 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803a3e:	83 c4 08             	add    $0x8,%esp
+  803a41:	6a 01                	push   $0x1
+  803a43:	56                   	push   %esi
+  803a44:	e8 92 fe ff ff       	call   8038db <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803a49:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803a4c:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803a52:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803a55:	09 fe                	or     %edi,%esi
+  803a57:	83 ce 01             	or     $0x1,%esi
+  803a5a:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803a5c:	83 c4 10             	add    $0x10,%esp
+}
+  803a5f:	89 d8                	mov    %ebx,%eax
+  803a61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a64:	5b                   	pop    %ebx
+  803a65:	5e                   	pop    %esi
+  803a66:	5f                   	pop    %edi
+  803a67:	5d                   	pop    %ebp
+  803a68:	c3                   	ret
+		num_page_reclaims++;
+  803a69:	83 05 04 c0 80 00 01 	addl   $0x1,0x80c004
+		return 0;
+  803a70:	eb ed                	jmp    803a5f <page_out+0xda>
+		num_page_drops++;
+  803a72:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+		return sys_page_unmap(0, map_out_addr);
+  803a79:	83 ec 08             	sub    $0x8,%esp
+  803a7c:	56                   	push   %esi
+  803a7d:	6a 00                	push   $0x0
+  803a7f:	e8 50 d4 ff ff       	call   800ed4 <sys_page_unmap>
+  803a84:	89 c3                	mov    %eax,%ebx
+  803a86:	83 c4 10             	add    $0x10,%esp
+  803a89:	eb d4                	jmp    803a5f <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803a8b:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803a8d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803a92:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803a97:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803a9a:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803a9c:	83 c0 08             	add    $0x8,%eax
+  803a9f:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803aa2:	b8 07 00 00 00       	mov    $0x7,%eax
+  803aa7:	e8 e5 ef ff ff       	call   802a91 <page_ring_reserve>
+	first = ring->sq_tail;
+  803aac:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803ab1:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803ab4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803ab9:	83 ec 04             	sub    $0x4,%esp
+  803abc:	68 00 10 00 00       	push   $0x1000
+  803ac1:	56                   	push   %esi
+  803ac2:	89 d8                	mov    %ebx,%eax
+  803ac4:	c1 e0 0c             	shl    $0xc,%eax
+  803ac7:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803acc:	50                   	push   %eax
+  803acd:	e8 72 d0 ff ff       	call   800b44 <memcpy>
+		vas[n] = va;
+  803ad2:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803ad6:	89 d9                	mov    %ebx,%ecx
+  803ad8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803add:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ae2:	e8 de ee ff ff       	call   8029c5 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803ae7:	8d 43 01             	lea    0x1(%ebx),%eax
+  803aea:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803aed:	83 c4 10             	add    $0x10,%esp
+  803af0:	83 fb 06             	cmp    $0x6,%ebx
+  803af3:	74 62                	je     803b57 <page_out+0x1d2>
+  803af5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803af8:	eb 15                	jmp    803b0f <page_out+0x18a>
+			num_page_drops++;
+  803afa:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+			sys_page_unmap(0, va);
+  803b01:	83 ec 08             	sub    $0x8,%esp
+  803b04:	56                   	push   %esi
+  803b05:	6a 00                	push   $0x0
+  803b07:	e8 c8 d3 ff ff       	call   800ed4 <sys_page_unmap>
+  803b0c:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803b0f:	83 ec 08             	sub    $0x8,%esp
+  803b12:	53                   	push   %ebx
+  803b13:	57                   	push   %edi
+  803b14:	e8 99 f8 ff ff       	call   8033b2 <get_page_choice>
+  803b19:	89 c6                	mov    %eax,%esi
+  803b1b:	83 c4 10             	add    $0x10,%esp
+  803b1e:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803b23:	74 32                	je     803b57 <page_out+0x1d2>
+  803b25:	e8 2c ed ff ff       	call   802856 <page_is_clean>
+  803b2a:	84 c0                	test   %al,%al
+  803b2c:	75 cc                	jne    803afa <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803b2e:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803b31:	39 c6                	cmp    %eax,%esi
+  803b33:	72 07                	jb     803b3c <page_out+0x1b7>
+  803b35:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803b38:	39 c6                	cmp    %eax,%esi
+  803b3a:	72 1b                	jb     803b57 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803b3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b41:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803b44:	eb 03                	jmp    803b49 <page_out+0x1c4>
+  803b46:	83 c3 01             	add    $0x1,%ebx
+  803b49:	39 da                	cmp    %ebx,%edx
+  803b4b:	0f 84 68 ff ff ff    	je     803ab9 <page_out+0x134>
+  803b51:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803b55:	75 ef                	jne    803b46 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803b57:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803b5a:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803b5d:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803b60:	e8 a6 ee ff ff       	call   802a0b <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803b65:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b6a:	eb 42                	jmp    803bae <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803b6c:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803b70:	89 f8                	mov    %edi,%eax
+  803b72:	c1 e8 0c             	shr    $0xc,%eax
+  803b75:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b7c:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803b7f:	83 ec 08             	sub    $0x8,%esp
+  803b82:	57                   	push   %edi
+  803b83:	6a 00                	push   $0x0
+  803b85:	e8 4a d3 ff ff       	call   800ed4 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803b8a:	83 c4 08             	add    $0x8,%esp
+  803b8d:	6a 01                	push   $0x1
+  803b8f:	57                   	push   %edi
+  803b90:	e8 46 fd ff ff       	call   8038db <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803b95:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803b98:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803b9e:	c1 e6 0c             	shl    $0xc,%esi
+  803ba1:	09 d6                	or     %edx,%esi
+  803ba3:	83 ce 01             	or     $0x1,%esi
+  803ba6:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803ba8:	83 c3 01             	add    $0x1,%ebx
+  803bab:	83 c4 10             	add    $0x10,%esp
+  803bae:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803bb1:	39 c3                	cmp    %eax,%ebx
+  803bb3:	74 1d                	je     803bd2 <page_out+0x24d>
+		if (res[i] < 0)
+  803bb5:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803bb9:	85 f6                	test   %esi,%esi
+  803bbb:	79 af                	jns    803b6c <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803bbd:	56                   	push   %esi
+  803bbe:	68 40 5d 80 00       	push   $0x805d40
+  803bc3:	68 d1 02 00 00       	push   $0x2d1
+  803bc8:	68 55 5a 80 00       	push   $0x805a55
+  803bcd:	e8 c8 c6 ff ff       	call   80029a <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803bd2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803bd7:	e9 83 fe ff ff       	jmp    803a5f <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803bdc:	50                   	push   %eax
+  803bdd:	68 40 5d 80 00       	push   $0x805d40
+  803be2:	68 0a 03 00 00       	push   $0x30a
+  803be7:	68 55 5a 80 00       	push   $0x805a55
+  803bec:	e8 a9 c6 ff ff       	call   80029a <_panic>
+		return -E_NO_MEM;
+  803bf1:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803bf6:	e9 64 fe ff ff       	jmp    803a5f <page_out+0xda>
+		return -E_PAGING;
+  803bfb:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803c00:	e9 5a fe ff ff       	jmp    803a5f <page_out+0xda>
+
+00803c05 <page_alloc>:
+{
+  803c05:	55                   	push   %ebp
+  803c06:	89 e5                	mov    %esp,%ebp
+  803c08:	57                   	push   %edi
+  803c09:	56                   	push   %esi
+  803c0a:	53                   	push   %ebx
+  803c0b:	83 ec 0c             	sub    $0xc,%esp
+  803c0e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803c11:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803c14:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803c1b:	74 34                	je     803c51 <page_alloc+0x4c>
+	if (check_mte)
+  803c1d:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803c21:	75 35                	jne    803c58 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803c23:	83 ec 04             	sub    $0x4,%esp
+  803c26:	ff 75 10             	push   0x10(%ebp)
+  803c29:	56                   	push   %esi
+  803c2a:	57                   	push   %edi
+  803c2b:	e8 1f d2 ff ff       	call   800e4f <sys_page_alloc>
+  803c30:	89 c3                	mov    %eax,%ebx
+  803c32:	83 c4 10             	add    $0x10,%esp
+  803c35:	85 c0                	test   %eax,%eax
+  803c37:	79 52                	jns    803c8b <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803c39:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803c3c:	75 52                	jne    803c90 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803c3e:	83 ec 08             	sub    $0x8,%esp
+  803c41:	56                   	push   %esi
+  803c42:	57                   	push   %edi
+  803c43:	e8 3d fd ff ff       	call   803985 <page_out>
+  803c48:	83 c4 10             	add    $0x10,%esp
+  803c4b:	85 c0                	test   %eax,%eax
+  803c4d:	79 d4                	jns    803c23 <page_alloc+0x1e>
+  803c4f:	eb 3f                	jmp    803c90 <page_alloc+0x8b>
+		init_map_dir();
+  803c51:	e8 2f fc ff ff       	call   803885 <init_map_dir>
+  803c56:	eb c5                	jmp    803c1d <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803c58:	83 ec 08             	sub    $0x8,%esp
+  803c5b:	6a 00                	push   $0x0
+  803c5d:	56                   	push   %esi
+  803c5e:	e8 78 fc ff ff       	call   8038db <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803c63:	83 c4 10             	add    $0x10,%esp
+  803c66:	85 c0                	test   %eax,%eax
+  803c68:	74 b9                	je     803c23 <page_alloc+0x1e>
+  803c6a:	8b 10                	mov    (%eax),%edx
+  803c6c:	f6 c2 01             	test   $0x1,%dl
+  803c6f:	74 b2                	je     803c23 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803c71:	83 ec 08             	sub    $0x8,%esp
+  803c74:	56                   	push   %esi
+  803c75:	52                   	push   %edx
+  803c76:	50                   	push   %eax
+  803c77:	68 64 5d 80 00       	push   $0x805d64
+  803c7c:	68 34 03 00 00       	push   $0x334
+  803c81:	68 55 5a 80 00       	push   $0x805a55
+  803c86:	e8 0f c6 ff ff       	call   80029a <_panic>
+	return 0;
+  803c8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c90:	89 d8                	mov    %ebx,%eax
+  803c92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c95:	5b                   	pop    %ebx
+  803c96:	5e                   	pop    %esi
+  803c97:	5f                   	pop    %edi
+  803c98:	5d                   	pop    %ebp
+  803c99:	c3                   	ret
+
+00803c9a <page_adopt>:
+{
+  803c9a:	55                   	push   %ebp
+  803c9b:	89 e5                	mov    %esp,%ebp
+  803c9d:	56                   	push   %esi
+  803c9e:	53                   	push   %ebx
+  803c9f:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803ca1:	c1 e8 16             	shr    $0x16,%eax
+  803ca4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803cab:	25 81 00 00 00       	and    $0x81,%eax
+  803cb0:	83 f8 01             	cmp    $0x1,%eax
+  803cb3:	75 53                	jne    803d08 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803cb5:	89 d8                	mov    %ebx,%eax
+  803cb7:	c1 e8 0c             	shr    $0xc,%eax
+  803cba:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803cc1:	89 f2                	mov    %esi,%edx
+  803cc3:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803cc9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803cce:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803cd4:	75 37                	jne    803d0d <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803cd6:	83 ec 08             	sub    $0x8,%esp
+  803cd9:	6a 01                	push   $0x1
+  803cdb:	53                   	push   %ebx
+  803cdc:	e8 fa fb ff ff       	call   8038db <umapdir_walk>
+  803ce1:	83 c4 10             	add    $0x10,%esp
+  803ce4:	85 c0                	test   %eax,%eax
+  803ce6:	74 2c                	je     803d14 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803ce8:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803cee:	83 ce 01             	or     $0x1,%esi
+  803cf1:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803cf3:	83 ec 08             	sub    $0x8,%esp
+  803cf6:	53                   	push   %ebx
+  803cf7:	6a 00                	push   $0x0
+  803cf9:	e8 d6 d1 ff ff       	call   800ed4 <sys_page_unmap>
+	return 1;
+  803cfe:	83 c4 10             	add    $0x10,%esp
+  803d01:	b8 01 00 00 00       	mov    $0x1,%eax
+  803d06:	eb 05                	jmp    803d0d <page_adopt+0x73>
+		return 0;
+  803d08:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d10:	5b                   	pop    %ebx
+  803d11:	5e                   	pop    %esi
+  803d12:	5d                   	pop    %ebp
+  803d13:	c3                   	ret
+		return -E_NO_MEM;
+  803d14:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803d19:	eb f2                	jmp    803d0d <page_adopt+0x73>
+
+00803d1b <page_forget>:
+{
+  803d1b:	55                   	push   %ebp
+  803d1c:	89 e5                	mov    %esp,%ebp
+  803d1e:	53                   	push   %ebx
+  803d1f:	83 ec 04             	sub    $0x4,%esp
+  803d22:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803d24:	e8 4a ef ff ff       	call   802c73 <find_paging_env>
+	if (pagingenv == 0)
+  803d29:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803d30:	74 39                	je     803d6b <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803d32:	89 d8                	mov    %ebx,%eax
+  803d34:	c1 e8 16             	shr    $0x16,%eax
+  803d37:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803d3e:	25 81 00 00 00       	and    $0x81,%eax
+  803d43:	83 f8 01             	cmp    $0x1,%eax
+  803d46:	74 28                	je     803d70 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803d48:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803d4f:	74 1a                	je     803d6b <page_forget+0x50>
+  803d51:	83 ec 08             	sub    $0x8,%esp
+  803d54:	6a 00                	push   $0x0
+  803d56:	53                   	push   %ebx
+  803d57:	e8 7f fb ff ff       	call   8038db <umapdir_walk>
+  803d5c:	89 c3                	mov    %eax,%ebx
+  803d5e:	83 c4 10             	add    $0x10,%esp
+  803d61:	85 c0                	test   %eax,%eax
+  803d63:	74 06                	je     803d6b <page_forget+0x50>
+  803d65:	8b 00                	mov    (%eax),%eax
+  803d67:	a8 01                	test   $0x1,%al
+  803d69:	75 2b                	jne    803d96 <page_forget+0x7b>
+}
+  803d6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d6e:	c9                   	leave
+  803d6f:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803d70:	89 d8                	mov    %ebx,%eax
+  803d72:	c1 e8 0c             	shr    $0xc,%eax
+  803d75:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803d7c:	89 c2                	mov    %eax,%edx
+  803d7e:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803d84:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803d8a:	75 bc                	jne    803d48 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803d8c:	c1 e8 0c             	shr    $0xc,%eax
+  803d8f:	e8 5c ee ff ff       	call   802bf0 <page_remove_slot>
+		return;
+  803d94:	eb d5                	jmp    803d6b <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803d96:	c1 e8 0c             	shr    $0xc,%eax
+  803d99:	e8 52 ee ff ff       	call   802bf0 <page_remove_slot>
+	*mte = 0;
+  803d9e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803da4:	eb c5                	jmp    803d6b <page_forget+0x50>
+
+00803da6 <page_unmap>:
+{
+  803da6:	55                   	push   %ebp
+  803da7:	89 e5                	mov    %esp,%ebp
+  803da9:	57                   	push   %edi
+  803daa:	56                   	push   %esi
+  803dab:	53                   	push   %ebx
+  803dac:	83 ec 0c             	sub    $0xc,%esp
+  803daf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803db2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803db5:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803dba:	8b 40 48             	mov    0x48(%eax),%eax
+  803dbd:	85 db                	test   %ebx,%ebx
+  803dbf:	0f 8e b4 00 00 00    	jle    803e79 <page_unmap+0xd3>
+  803dc5:	39 d8                	cmp    %ebx,%eax
+  803dc7:	0f 84 ac 00 00 00    	je     803e79 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803dcd:	83 ec 08             	sub    $0x8,%esp
+  803dd0:	57                   	push   %edi
+  803dd1:	53                   	push   %ebx
+  803dd2:	e8 fd d0 ff ff       	call   800ed4 <sys_page_unmap>
+  803dd7:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803dd9:	e8 95 ee ff ff       	call   802c73 <find_paging_env>
+	if (pagingenv == 0)
+  803dde:	83 c4 10             	add    $0x10,%esp
+  803de1:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803de8:	0f 84 a1 00 00 00    	je     803e8f <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803dee:	83 ec 0c             	sub    $0xc,%esp
+  803df1:	6a 05                	push   $0x5
+  803df3:	68 00 00 40 00       	push   $0x400000
+  803df8:	6a 00                	push   $0x0
+  803dfa:	68 00 b0 ad de       	push   $0xdeadb000
+  803dff:	53                   	push   %ebx
+  803e00:	e8 8d d0 ff ff       	call   800e92 <sys_page_map>
+  803e05:	83 c4 20             	add    $0x20,%esp
+  803e08:	85 c0                	test   %eax,%eax
+  803e0a:	0f 88 89 00 00 00    	js     803e99 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803e10:	89 f8                	mov    %edi,%eax
+  803e12:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803e15:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803e1c:	a8 01                	test   $0x1,%al
+  803e1e:	74 6f                	je     803e8f <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803e20:	83 ec 0c             	sub    $0xc,%esp
+  803e23:	6a 05                	push   $0x5
+  803e25:	68 00 00 40 00       	push   $0x400000
+  803e2a:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803e2c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803e31:	50                   	push   %eax
+  803e32:	53                   	push   %ebx
+  803e33:	e8 5a d0 ff ff       	call   800e92 <sys_page_map>
+  803e38:	83 c4 20             	add    $0x20,%esp
+  803e3b:	85 c0                	test   %eax,%eax
+  803e3d:	78 6f                	js     803eae <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803e3f:	c1 ef 0c             	shr    $0xc,%edi
+  803e42:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803e48:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803e4f:	01 
+  803e50:	74 3d                	je     803e8f <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803e52:	83 ec 08             	sub    $0x8,%esp
+  803e55:	68 00 00 40 00       	push   $0x400000
+  803e5a:	6a 00                	push   $0x0
+  803e5c:	e8 73 d0 ff ff       	call   800ed4 <sys_page_unmap>
+  803e61:	83 c4 10             	add    $0x10,%esp
+  803e64:	85 c0                	test   %eax,%eax
+  803e66:	78 5b                	js     803ec3 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803e68:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803e6f:	c1 e8 0c             	shr    $0xc,%eax
+  803e72:	e8 79 ed ff ff       	call   802bf0 <page_remove_slot>
+	return r;
+  803e77:	eb 16                	jmp    803e8f <page_unmap+0xe9>
+		page_forget(va);
+  803e79:	89 f8                	mov    %edi,%eax
+  803e7b:	e8 9b fe ff ff       	call   803d1b <page_forget>
+		return sys_page_unmap(envid, va);
+  803e80:	83 ec 08             	sub    $0x8,%esp
+  803e83:	57                   	push   %edi
+  803e84:	53                   	push   %ebx
+  803e85:	e8 4a d0 ff ff       	call   800ed4 <sys_page_unmap>
+  803e8a:	89 c6                	mov    %eax,%esi
+  803e8c:	83 c4 10             	add    $0x10,%esp
+}
+  803e8f:	89 f0                	mov    %esi,%eax
+  803e91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e94:	5b                   	pop    %ebx
+  803e95:	5e                   	pop    %esi
+  803e96:	5f                   	pop    %edi
+  803e97:	5d                   	pop    %ebp
+  803e98:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803e99:	50                   	push   %eax
+  803e9a:	68 a0 5d 80 00       	push   $0x805da0
+  803e9f:	68 e4 03 00 00       	push   $0x3e4
+  803ea4:	68 55 5a 80 00       	push   $0x805a55
+  803ea9:	e8 ec c3 ff ff       	call   80029a <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803eae:	50                   	push   %eax
+  803eaf:	68 cc 5d 80 00       	push   $0x805dcc
+  803eb4:	68 ea 03 00 00       	push   $0x3ea
+  803eb9:	68 55 5a 80 00       	push   $0x805a55
+  803ebe:	e8 d7 c3 ff ff       	call   80029a <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803ec3:	50                   	push   %eax
+  803ec4:	68 f8 5d 80 00       	push   $0x805df8
+  803ec9:	68 ef 03 00 00       	push   $0x3ef
+  803ece:	68 55 5a 80 00       	push   $0x805a55
+  803ed3:	e8 c2 c3 ff ff       	call   80029a <_panic>
+
+00803ed8 <page_unmap_range>:
+{
+  803ed8:	55                   	push   %ebp
+  803ed9:	89 e5                	mov    %esp,%ebp
+  803edb:	57                   	push   %edi
+  803edc:	56                   	push   %esi
+  803edd:	53                   	push   %ebx
+  803ede:	83 ec 0c             	sub    $0xc,%esp
+  803ee1:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803ee4:	e8 8a ed ff ff       	call   802c73 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803ee9:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803eee:	8b 40 48             	mov    0x48(%eax),%eax
+  803ef1:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803ef5:	7e 38                	jle    803f2f <page_unmap_range+0x57>
+  803ef7:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803efa:	74 33                	je     803f2f <page_unmap_range+0x57>
+  803efc:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803f03:	74 2a                	je     803f2f <page_unmap_range+0x57>
+  803f05:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  803f08:	be 00 00 00 00       	mov    $0x0,%esi
+  803f0d:	39 fe                	cmp    %edi,%esi
+  803f0f:	74 56                	je     803f67 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  803f11:	83 ec 08             	sub    $0x8,%esp
+  803f14:	53                   	push   %ebx
+  803f15:	ff 75 08             	push   0x8(%ebp)
+  803f18:	e8 89 fe ff ff       	call   803da6 <page_unmap>
+  803f1d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803f23:	83 c4 10             	add    $0x10,%esp
+  803f26:	85 c0                	test   %eax,%eax
+  803f28:	78 35                	js     803f5f <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  803f2a:	83 c6 01             	add    $0x1,%esi
+  803f2d:	eb de                	jmp    803f0d <page_unmap_range+0x35>
+  803f2f:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803f32:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f37:	eb 10                	jmp    803f49 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803f39:	89 f0                	mov    %esi,%eax
+  803f3b:	e8 db fd ff ff       	call   803d1b <page_forget>
+		for (i = 0; i < npages; i++)
+  803f40:	83 c3 01             	add    $0x1,%ebx
+  803f43:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803f49:	39 fb                	cmp    %edi,%ebx
+  803f4b:	75 ec                	jne    803f39 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  803f4d:	83 ec 04             	sub    $0x4,%esp
+  803f50:	57                   	push   %edi
+  803f51:	ff 75 0c             	push   0xc(%ebp)
+  803f54:	ff 75 08             	push   0x8(%ebp)
+  803f57:	e8 8c d0 ff ff       	call   800fe8 <sys_page_unmap_range>
+  803f5c:	83 c4 10             	add    $0x10,%esp
+}
+  803f5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f62:	5b                   	pop    %ebx
+  803f63:	5e                   	pop    %esi
+  803f64:	5f                   	pop    %edi
+  803f65:	5d                   	pop    %ebp
+  803f66:	c3                   	ret
+	return 0;
+  803f67:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f6c:	eb f1                	jmp    803f5f <page_unmap_range+0x87>
+
+00803f6e <page_alloc_range>:
+{
+  803f6e:	55                   	push   %ebp
+  803f6f:	89 e5                	mov    %esp,%ebp
+  803f71:	57                   	push   %edi
+  803f72:	56                   	push   %esi
+  803f73:	53                   	push   %ebx
+  803f74:	83 ec 1c             	sub    $0x1c,%esp
+  803f77:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803f7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  803f7d:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803f84:	74 14                	je     803f9a <page_alloc_range+0x2c>
+	if (check_mte)
+  803f86:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803f8a:	74 66                	je     803ff2 <page_alloc_range+0x84>
+  803f8c:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  803f8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f93:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803f96:	89 c7                	mov    %eax,%edi
+  803f98:	eb 10                	jmp    803faa <page_alloc_range+0x3c>
+		init_map_dir();
+  803f9a:	e8 e6 f8 ff ff       	call   803885 <init_map_dir>
+  803f9f:	eb e5                	jmp    803f86 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803fa1:	83 c7 01             	add    $0x1,%edi
+  803fa4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803faa:	39 df                	cmp    %ebx,%edi
+  803fac:	74 38                	je     803fe6 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  803fae:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803fb1:	83 ec 08             	sub    $0x8,%esp
+  803fb4:	6a 00                	push   $0x0
+  803fb6:	56                   	push   %esi
+  803fb7:	e8 1f f9 ff ff       	call   8038db <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  803fbc:	83 c4 10             	add    $0x10,%esp
+  803fbf:	85 c0                	test   %eax,%eax
+  803fc1:	74 de                	je     803fa1 <page_alloc_range+0x33>
+  803fc3:	8b 10                	mov    (%eax),%edx
+  803fc5:	f6 c2 01             	test   $0x1,%dl
+  803fc8:	74 d7                	je     803fa1 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  803fca:	83 ec 08             	sub    $0x8,%esp
+  803fcd:	ff 75 e4             	push   -0x1c(%ebp)
+  803fd0:	52                   	push   %edx
+  803fd1:	50                   	push   %eax
+  803fd2:	68 64 5d 80 00       	push   $0x805d64
+  803fd7:	68 0b 04 00 00       	push   $0x40b
+  803fdc:	68 55 5a 80 00       	push   $0x805a55
+  803fe1:	e8 b4 c2 ff ff       	call   80029a <_panic>
+  803fe6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803fe9:	eb 07                	jmp    803ff2 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  803feb:	c1 e0 0c             	shl    $0xc,%eax
+  803fee:	01 c7                	add    %eax,%edi
+			npages -= r;
+  803ff0:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  803ff2:	85 db                	test   %ebx,%ebx
+  803ff4:	74 30                	je     804026 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  803ff6:	ff 75 14             	push   0x14(%ebp)
+  803ff9:	53                   	push   %ebx
+  803ffa:	57                   	push   %edi
+  803ffb:	ff 75 08             	push   0x8(%ebp)
+  803ffe:	e8 77 cf ff ff       	call   800f7a <sys_page_alloc_range>
+  804003:	89 c6                	mov    %eax,%esi
+  804005:	83 c4 10             	add    $0x10,%esp
+  804008:	85 c0                	test   %eax,%eax
+  80400a:	7f df                	jg     803feb <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  80400c:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  80400f:	75 1a                	jne    80402b <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  804011:	83 ec 08             	sub    $0x8,%esp
+  804014:	57                   	push   %edi
+  804015:	ff 75 08             	push   0x8(%ebp)
+  804018:	e8 68 f9 ff ff       	call   803985 <page_out>
+  80401d:	83 c4 10             	add    $0x10,%esp
+  804020:	85 c0                	test   %eax,%eax
+  804022:	79 ce                	jns    803ff2 <page_alloc_range+0x84>
+  804024:	eb 05                	jmp    80402b <page_alloc_range+0xbd>
+	return 0;
+  804026:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  80402b:	89 f0                	mov    %esi,%eax
+  80402d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804030:	5b                   	pop    %ebx
+  804031:	5e                   	pop    %esi
+  804032:	5f                   	pop    %edi
+  804033:	5d                   	pop    %ebp
+  804034:	c3                   	ret
+
+00804035 <page_in>:
+{
+  804035:	55                   	push   %ebp
+  804036:	89 e5                	mov    %esp,%ebp
+  804038:	57                   	push   %edi
+  804039:	56                   	push   %esi
+  80403a:	53                   	push   %ebx
+  80403b:	83 ec 3c             	sub    $0x3c,%esp
+  80403e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  804041:	e8 2d ec ff ff       	call   802c73 <find_paging_env>
+	if (pagingenv == 0)
+  804046:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  80404d:	0f 84 09 02 00 00    	je     80425c <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  804053:	83 ec 08             	sub    $0x8,%esp
+  804056:	6a 00                	push   $0x0
+  804058:	56                   	push   %esi
+  804059:	e8 7d f8 ff ff       	call   8038db <umapdir_walk>
+  80405e:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  804060:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  804066:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  804069:	83 c4 10             	add    $0x10,%esp
+  80406c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804070:	74 0d                	je     80407f <page_in+0x4a>
+  804072:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804077:	8b 40 48             	mov    0x48(%eax),%eax
+  80407a:	3b 45 08             	cmp    0x8(%ebp),%eax
+  80407d:	75 06                	jne    804085 <page_in+0x50>
+  80407f:	8b 03                	mov    (%ebx),%eax
+  804081:	a8 02                	test   $0x2,%al
+  804083:	75 63                	jne    8040e8 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  804085:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  804087:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804089:	89 f0                	mov    %esi,%eax
+  80408b:	25 06 0e 00 00       	and    $0xe06,%eax
+  804090:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  804093:	50                   	push   %eax
+  804094:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804097:	57                   	push   %edi
+  804098:	ff 75 08             	push   0x8(%ebp)
+  80409b:	e8 65 fb ff ff       	call   803c05 <page_alloc>
+  8040a0:	83 c4 10             	add    $0x10,%esp
+  8040a3:	85 c0                	test   %eax,%eax
+  8040a5:	78 39                	js     8040e0 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  8040a7:	89 f0                	mov    %esi,%eax
+  8040a9:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8040ac:	83 ec 0c             	sub    $0xc,%esp
+  8040af:	6a 07                	push   $0x7
+  8040b1:	6a 01                	push   $0x1
+  8040b3:	57                   	push   %edi
+  8040b4:	c1 e0 04             	shl    $0x4,%eax
+  8040b7:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8040b8:	c1 ee 1c             	shr    $0x1c,%esi
+  8040bb:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8040be:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  8040c5:	e8 f1 0f 00 00       	call   8050bb <ipc_call>
+  8040ca:	83 c4 20             	add    $0x20,%esp
+  8040cd:	85 c0                	test   %eax,%eax
+  8040cf:	0f 88 72 01 00 00    	js     804247 <page_in+0x212>
+	*mte = 0;
+  8040d5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  8040db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040e3:	5b                   	pop    %ebx
+  8040e4:	5e                   	pop    %esi
+  8040e5:	5f                   	pop    %edi
+  8040e6:	5d                   	pop    %ebp
+  8040e7:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  8040e8:	25 06 0e 00 00       	and    $0xe06,%eax
+  8040ed:	83 c8 01             	or     $0x1,%eax
+  8040f0:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  8040f3:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  8040f6:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8040f9:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  8040ff:	be 01 00 00 00       	mov    $0x1,%esi
+  804104:	eb 46                	jmp    80414c <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  804106:	83 ec 08             	sub    $0x8,%esp
+  804109:	6a 00                	push   $0x0
+  80410b:	51                   	push   %ecx
+  80410c:	e8 ca f7 ff ff       	call   8038db <umapdir_walk>
+  804111:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  804115:	83 c4 10             	add    $0x10,%esp
+  804118:	85 c0                	test   %eax,%eax
+  80411a:	74 66                	je     804182 <page_in+0x14d>
+  80411c:	8b 00                	mov    (%eax),%eax
+  80411e:	a8 01                	test   $0x1,%al
+  804120:	74 60                	je     804182 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  804122:	89 c2                	mov    %eax,%edx
+  804124:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  80412a:	83 ca 01             	or     $0x1,%edx
+  80412d:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  804130:	75 50                	jne    804182 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  804132:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804138:	c1 e8 1c             	shr    $0x1c,%eax
+  80413b:	8b 13                	mov    (%ebx),%edx
+  80413d:	c1 ea 1c             	shr    $0x1c,%edx
+  804140:	39 d0                	cmp    %edx,%eax
+  804142:	75 3e                	jne    804182 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804144:	83 c6 01             	add    $0x1,%esi
+  804147:	83 fe 08             	cmp    $0x8,%esi
+  80414a:	74 3f                	je     80418b <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  80414c:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  80414e:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  804154:	77 2c                	ja     804182 <page_in+0x14d>
+  804156:	89 f8                	mov    %edi,%eax
+  804158:	c1 e8 16             	shr    $0x16,%eax
+  80415b:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  804162:	f6 c2 01             	test   $0x1,%dl
+  804165:	74 9f                	je     804106 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804167:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  80416e:	a8 80                	test   $0x80,%al
+  804170:	75 10                	jne    804182 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804172:	89 f8                	mov    %edi,%eax
+  804174:	c1 e8 0c             	shr    $0xc,%eax
+  804177:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80417e:	a8 01                	test   $0x1,%al
+  804180:	74 84                	je     804106 <page_in+0xd1>
+	if (n == 1)
+  804182:	83 fe 01             	cmp    $0x1,%esi
+  804185:	0f 84 fa fe ff ff    	je     804085 <page_in+0x50>
+	req.nslots = n;
+  80418b:	89 35 00 90 80 00    	mov    %esi,0x809000
+	for (i = 0; i < n; i++)
+  804191:	b8 00 00 00 00       	mov    $0x0,%eax
+  804196:	eb 13                	jmp    8041ab <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  804198:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  80419c:	8b 12                	mov    (%edx),%edx
+  80419e:	c1 ea 0c             	shr    $0xc,%edx
+  8041a1:	89 14 85 04 90 80 00 	mov    %edx,0x809004(,%eax,4)
+	for (i = 0; i < n; i++)
+  8041a8:	83 c0 01             	add    $0x1,%eax
+  8041ab:	39 c6                	cmp    %eax,%esi
+  8041ad:	75 e9                	jne    804198 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  8041af:	83 ec 0c             	sub    $0xc,%esp
+  8041b2:	6a 00                	push   $0x0
+  8041b4:	ff 75 c0             	push   -0x40(%ebp)
+  8041b7:	56                   	push   %esi
+  8041b8:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  8041bb:	57                   	push   %edi
+  8041bc:	6a 00                	push   $0x0
+  8041be:	e8 ab fd ff ff       	call   803f6e <page_alloc_range>
+  8041c3:	83 c4 20             	add    $0x20,%esp
+  8041c6:	85 c0                	test   %eax,%eax
+  8041c8:	78 6e                	js     804238 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  8041ca:	83 ec 04             	sub    $0x4,%esp
+  8041cd:	6a 24                	push   $0x24
+  8041cf:	68 00 90 80 00       	push   $0x809000
+  8041d4:	57                   	push   %edi
+  8041d5:	e8 08 c9 ff ff       	call   800ae2 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  8041da:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8041e1:	56                   	push   %esi
+  8041e2:	57                   	push   %edi
+  8041e3:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8041e5:	0f b7 05 06 90 80 00 	movzwl 0x809006,%eax
+  8041ec:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  8041ef:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  8041f6:	e8 c0 0e 00 00       	call   8050bb <ipc_call>
+  8041fb:	83 c4 20             	add    $0x20,%esp
+  8041fe:	85 c0                	test   %eax,%eax
+  804200:	78 08                	js     80420a <page_in+0x1d5>
+  804202:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  804205:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  804208:	eb 20                	jmp    80422a <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  80420a:	50                   	push   %eax
+  80420b:	68 24 5e 80 00       	push   $0x805e24
+  804210:	68 59 02 00 00       	push   $0x259
+  804215:	68 55 5a 80 00       	push   $0x805a55
+  80421a:	e8 7b c0 ff ff       	call   80029a <_panic>
+		*mtes[i] = 0;
+  80421f:	8b 10                	mov    (%eax),%edx
+  804221:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  804227:	83 c0 04             	add    $0x4,%eax
+  80422a:	39 c8                	cmp    %ecx,%eax
+  80422c:	75 f1                	jne    80421f <page_in+0x1ea>
+	return n;
+  80422e:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  804230:	85 f6                	test   %esi,%esi
+  804232:	0f 84 4d fe ff ff    	je     804085 <page_in+0x50>
+		return r < 0 ? r : 0;
+  804238:	85 c0                	test   %eax,%eax
+  80423a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80423f:	0f 4f c2             	cmovg  %edx,%eax
+  804242:	e9 99 fe ff ff       	jmp    8040e0 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  804247:	50                   	push   %eax
+  804248:	68 5c 5e 80 00       	push   $0x805e5c
+  80424d:	68 9a 02 00 00       	push   $0x29a
+  804252:	68 55 5a 80 00       	push   $0x805a55
+  804257:	e8 3e c0 ff ff       	call   80029a <_panic>
+		return -E_PAGING;
+  80425c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804261:	e9 7a fe ff ff       	jmp    8040e0 <page_in+0xab>
+
+00804266 <page_map>:
+{
+  804266:	55                   	push   %ebp
+  804267:	89 e5                	mov    %esp,%ebp
+  804269:	57                   	push   %edi
+  80426a:	56                   	push   %esi
+  80426b:	53                   	push   %ebx
+  80426c:	83 ec 1c             	sub    $0x1c,%esp
+  80426f:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  804272:	83 ec 0c             	sub    $0xc,%esp
+  804275:	ff 75 18             	push   0x18(%ebp)
+  804278:	ff 75 14             	push   0x14(%ebp)
+  80427b:	ff 75 10             	push   0x10(%ebp)
+  80427e:	ff 75 0c             	push   0xc(%ebp)
+  804281:	56                   	push   %esi
+  804282:	e8 0b cc ff ff       	call   800e92 <sys_page_map>
+  804287:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80428a:	83 c4 20             	add    $0x20,%esp
+  80428d:	85 c0                	test   %eax,%eax
+  80428f:	0f 89 a9 01 00 00    	jns    80443e <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  804295:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  804299:	74 5f                	je     8042fa <page_map+0x94>
+		if (r != -E_INVAL)
+  80429b:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  80429f:	0f 85 a0 01 00 00    	jne    804445 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8042a5:	85 f6                	test   %esi,%esi
+  8042a7:	74 70                	je     804319 <page_map+0xb3>
+  8042a9:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8042ae:	8b 40 48             	mov    0x48(%eax),%eax
+  8042b1:	39 f0                	cmp    %esi,%eax
+  8042b3:	74 64                	je     804319 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8042b5:	83 ec 0c             	sub    $0xc,%esp
+  8042b8:	6a 05                	push   $0x5
+  8042ba:	68 00 00 40 00       	push   $0x400000
+  8042bf:	6a 00                	push   $0x0
+  8042c1:	68 00 b0 ad de       	push   $0xdeadb000
+  8042c6:	56                   	push   %esi
+  8042c7:	e8 c6 cb ff ff       	call   800e92 <sys_page_map>
+  8042cc:	89 c3                	mov    %eax,%ebx
+  8042ce:	83 c4 20             	add    $0x20,%esp
+  8042d1:	85 c0                	test   %eax,%eax
+  8042d3:	79 6a                	jns    80433f <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  8042d5:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8042d8:	75 50                	jne    80432a <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  8042da:	83 ec 08             	sub    $0x8,%esp
+  8042dd:	68 00 00 40 00       	push   $0x400000
+  8042e2:	6a fc                	push   $0xfffffffc
+  8042e4:	e8 9c f6 ff ff       	call   803985 <page_out>
+  8042e9:	83 c4 10             	add    $0x10,%esp
+  8042ec:	85 c0                	test   %eax,%eax
+  8042ee:	79 c5                	jns    8042b5 <page_map+0x4f>
+}
+  8042f0:	89 d8                	mov    %ebx,%eax
+  8042f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042f5:	5b                   	pop    %ebx
+  8042f6:	5e                   	pop    %esi
+  8042f7:	5f                   	pop    %edi
+  8042f8:	5d                   	pop    %ebp
+  8042f9:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  8042fa:	83 ec 08             	sub    $0x8,%esp
+  8042fd:	68 00 00 40 00       	push   $0x400000
+  804302:	6a 00                	push   $0x0
+  804304:	e8 7c f6 ff ff       	call   803985 <page_out>
+  804309:	83 c4 10             	add    $0x10,%esp
+  80430c:	85 c0                	test   %eax,%eax
+  80430e:	0f 89 5e ff ff ff    	jns    804272 <page_map+0xc>
+				return r;
+  804314:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804317:	eb d7                	jmp    8042f0 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804319:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80431c:	e8 79 f9 ff ff       	call   803c9a <page_adopt>
+  804321:	85 c0                	test   %eax,%eax
+  804323:	79 90                	jns    8042b5 <page_map+0x4f>
+			return r;
+  804325:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804328:	eb c6                	jmp    8042f0 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  80432a:	53                   	push   %ebx
+  80432b:	68 90 5e 80 00       	push   $0x805e90
+  804330:	68 77 03 00 00       	push   $0x377
+  804335:	68 55 5a 80 00       	push   $0x805a55
+  80433a:	e8 5b bf ff ff       	call   80029a <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  80433f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804342:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  804345:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  80434c:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  804352:	0f 84 f5 00 00 00    	je     80444d <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  804358:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80435e:	83 ec 0c             	sub    $0xc,%esp
+  804361:	6a 05                	push   $0x5
+  804363:	68 00 00 40 00       	push   $0x400000
+  804368:	6a 00                	push   $0x0
+  80436a:	57                   	push   %edi
+  80436b:	56                   	push   %esi
+  80436c:	e8 21 cb ff ff       	call   800e92 <sys_page_map>
+  804371:	89 c3                	mov    %eax,%ebx
+  804373:	83 c4 20             	add    $0x20,%esp
+  804376:	85 c0                	test   %eax,%eax
+  804378:	79 35                	jns    8043af <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  80437a:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80437d:	75 1b                	jne    80439a <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  80437f:	83 ec 08             	sub    $0x8,%esp
+  804382:	68 00 00 40 00       	push   $0x400000
+  804387:	6a 00                	push   $0x0
+  804389:	e8 f7 f5 ff ff       	call   803985 <page_out>
+  80438e:	83 c4 10             	add    $0x10,%esp
+  804391:	85 c0                	test   %eax,%eax
+  804393:	79 c9                	jns    80435e <page_map+0xf8>
+  804395:	e9 56 ff ff ff       	jmp    8042f0 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  80439a:	53                   	push   %ebx
+  80439b:	68 b8 5e 80 00       	push   $0x805eb8
+  8043a0:	68 83 03 00 00       	push   $0x383
+  8043a5:	68 55 5a 80 00       	push   $0x805a55
+  8043aa:	e8 eb be ff ff       	call   80029a <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  8043af:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8043b2:	c1 e8 0c             	shr    $0xc,%eax
+  8043b5:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8043ba:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  8043c1:	01 
+  8043c2:	0f 84 8d 00 00 00    	je     804455 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  8043c8:	83 ec 08             	sub    $0x8,%esp
+  8043cb:	68 00 00 40 00       	push   $0x400000
+  8043d0:	6a 00                	push   $0x0
+  8043d2:	e8 fd ca ff ff       	call   800ed4 <sys_page_unmap>
+  8043d7:	83 c4 10             	add    $0x10,%esp
+  8043da:	85 c0                	test   %eax,%eax
+  8043dc:	78 36                	js     804414 <page_map+0x1ae>
+  8043de:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  8043e1:	83 ec 08             	sub    $0x8,%esp
+  8043e4:	57                   	push   %edi
+  8043e5:	56                   	push   %esi
+  8043e6:	e8 4a fc ff ff       	call   804035 <page_in>
+  8043eb:	89 c3                	mov    %eax,%ebx
+  8043ed:	83 c4 10             	add    $0x10,%esp
+  8043f0:	85 c0                	test   %eax,%eax
+  8043f2:	0f 89 7a fe ff ff    	jns    804272 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  8043f8:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8043fb:	75 2c                	jne    804429 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  8043fd:	83 ec 08             	sub    $0x8,%esp
+  804400:	57                   	push   %edi
+  804401:	6a 00                	push   $0x0
+  804403:	e8 7d f5 ff ff       	call   803985 <page_out>
+  804408:	83 c4 10             	add    $0x10,%esp
+  80440b:	85 c0                	test   %eax,%eax
+  80440d:	79 d2                	jns    8043e1 <page_map+0x17b>
+  80440f:	e9 dc fe ff ff       	jmp    8042f0 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  804414:	50                   	push   %eax
+  804415:	68 e4 5e 80 00       	push   $0x805ee4
+  80441a:	68 8b 03 00 00       	push   $0x38b
+  80441f:	68 55 5a 80 00       	push   $0x805a55
+  804424:	e8 71 be ff ff       	call   80029a <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  804429:	53                   	push   %ebx
+  80442a:	68 0c 5f 80 00       	push   $0x805f0c
+  80442f:	68 91 03 00 00       	push   $0x391
+  804434:	68 55 5a 80 00       	push   $0x805a55
+  804439:	e8 5c be ff ff       	call   80029a <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  80443e:	89 c3                	mov    %eax,%ebx
+  804440:	e9 ab fe ff ff       	jmp    8042f0 <page_map+0x8a>
+  804445:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804448:	e9 a3 fe ff ff       	jmp    8042f0 <page_map+0x8a>
+			return r; // Pass through the error
+  80444d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804450:	e9 9b fe ff ff       	jmp    8042f0 <page_map+0x8a>
+			return r; // Pass through the error
+  804455:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804458:	e9 93 fe ff ff       	jmp    8042f0 <page_map+0x8a>
+
+0080445d <page_map_range>:
+{
+  80445d:	55                   	push   %ebp
+  80445e:	89 e5                	mov    %esp,%ebp
+  804460:	57                   	push   %edi
+  804461:	56                   	push   %esi
+  804462:	53                   	push   %ebx
+  804463:	83 ec 0c             	sub    $0xc,%esp
+  804466:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804469:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  80446c:	83 ec 08             	sub    $0x8,%esp
+  80446f:	ff 75 1c             	push   0x1c(%ebp)
+  804472:	ff 75 18             	push   0x18(%ebp)
+  804475:	56                   	push   %esi
+  804476:	ff 75 10             	push   0x10(%ebp)
+  804479:	57                   	push   %edi
+  80447a:	ff 75 08             	push   0x8(%ebp)
+  80447d:	e8 1b cb ff ff       	call   800f9d <sys_page_map_range>
+  804482:	89 c3                	mov    %eax,%ebx
+  804484:	83 c4 20             	add    $0x20,%esp
+  804487:	85 c0                	test   %eax,%eax
+  804489:	79 1b                	jns    8044a6 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  80448b:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80448e:	75 20                	jne    8044b0 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  804490:	83 ec 08             	sub    $0x8,%esp
+  804493:	68 00 00 40 00       	push   $0x400000
+  804498:	6a 00                	push   $0x0
+  80449a:	e8 e6 f4 ff ff       	call   803985 <page_out>
+  80449f:	83 c4 10             	add    $0x10,%esp
+  8044a2:	85 c0                	test   %eax,%eax
+  8044a4:	79 c6                	jns    80446c <page_map_range+0xf>
+}
+  8044a6:	89 d8                	mov    %ebx,%eax
+  8044a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044ab:	5b                   	pop    %ebx
+  8044ac:	5e                   	pop    %esi
+  8044ad:	5f                   	pop    %edi
+  8044ae:	5d                   	pop    %ebp
+  8044af:	c3                   	ret
+		if (r != -E_INVAL)
+  8044b0:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  8044b3:	75 f1                	jne    8044a6 <page_map_range+0x49>
+  8044b5:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  8044b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8044bc:	eb 03                	jmp    8044c1 <page_map_range+0x64>
+  8044be:	83 c6 01             	add    $0x1,%esi
+  8044c1:	3b 75 18             	cmp    0x18(%ebp),%esi
+  8044c4:	74 2a                	je     8044f0 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  8044c6:	83 ec 0c             	sub    $0xc,%esp
+  8044c9:	ff 75 1c             	push   0x1c(%ebp)
+  8044cc:	53                   	push   %ebx
+  8044cd:	ff 75 10             	push   0x10(%ebp)
+  8044d0:	57                   	push   %edi
+  8044d1:	ff 75 08             	push   0x8(%ebp)
+  8044d4:	e8 8d fd ff ff       	call   804266 <page_map>
+  8044d9:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8044df:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8044e5:	83 c4 20             	add    $0x20,%esp
+  8044e8:	85 c0                	test   %eax,%eax
+  8044ea:	79 d2                	jns    8044be <page_map_range+0x61>
+  8044ec:	89 c3                	mov    %eax,%ebx
+  8044ee:	eb b6                	jmp    8044a6 <page_map_range+0x49>
+		return 0;
+  8044f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8044f5:	eb af                	jmp    8044a6 <page_map_range+0x49>
+
+008044f7 <paging_pgfault_handler>:
+{
+  8044f7:	55                   	push   %ebp
+  8044f8:	89 e5                	mov    %esp,%ebp
+  8044fa:	56                   	push   %esi
+  8044fb:	53                   	push   %ebx
+  8044fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  8044ff:	e8 6f e7 ff ff       	call   802c73 <find_paging_env>
+	if (pagingenv == 0)
+  804504:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  804509:	85 c0                	test   %eax,%eax
+  80450b:	74 3c                	je     804549 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  80450d:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  80450f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804513:	75 12                	jne    804527 <paging_pgfault_handler+0x30>
+  804515:	89 f0                	mov    %esi,%eax
+  804517:	e8 7e f7 ff ff       	call   803c9a <page_adopt>
+  80451c:	89 c2                	mov    %eax,%edx
+		return 0;
+  80451e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804523:	85 d2                	test   %edx,%edx
+  804525:	78 22                	js     804549 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  804527:	83 ec 08             	sub    $0x8,%esp
+  80452a:	6a 00                	push   $0x0
+  80452c:	56                   	push   %esi
+  80452d:	e8 a9 f3 ff ff       	call   8038db <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  804532:	83 c4 10             	add    $0x10,%esp
+  804535:	85 c0                	test   %eax,%eax
+  804537:	74 05                	je     80453e <paging_pgfault_handler+0x47>
+  804539:	f6 00 01             	testb  $0x1,(%eax)
+  80453c:	75 12                	jne    804550 <paging_pgfault_handler+0x59>
+	return 0;
+  80453e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804543:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804547:	74 23                	je     80456c <paging_pgfault_handler+0x75>
+}
+  804549:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80454c:	5b                   	pop    %ebx
+  80454d:	5e                   	pop    %esi
+  80454e:	5d                   	pop    %ebp
+  80454f:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  804550:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804555:	8b 40 48             	mov    0x48(%eax),%eax
+  804558:	83 ec 08             	sub    $0x8,%esp
+  80455b:	56                   	push   %esi
+  80455c:	50                   	push   %eax
+  80455d:	e8 d3 fa ff ff       	call   804035 <page_in>
+  804562:	f7 d0                	not    %eax
+  804564:	c1 e8 1f             	shr    $0x1f,%eax
+  804567:	83 c4 10             	add    $0x10,%esp
+  80456a:	eb dd                	jmp    804549 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  80456c:	89 f0                	mov    %esi,%eax
+  80456e:	e8 97 e2 ff ff       	call   80280a <segment_lookup>
+  804573:	89 c2                	mov    %eax,%edx
+	return 0;
+  804575:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  80457a:	85 d2                	test   %edx,%edx
+  80457c:	74 cb                	je     804549 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  80457e:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804583:	8b 40 48             	mov    0x48(%eax),%eax
+  804586:	83 ec 08             	sub    $0x8,%esp
+  804589:	56                   	push   %esi
+  80458a:	50                   	push   %eax
+  80458b:	e8 f5 f3 ff ff       	call   803985 <page_out>
+  804590:	f7 d0                	not    %eax
+  804592:	c1 e8 1f             	shr    $0x1f,%eax
+  804595:	83 c4 10             	add    $0x10,%esp
+  804598:	eb af                	jmp    804549 <paging_pgfault_handler+0x52>
+
+0080459a <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  80459a:	55                   	push   %ebp
+  80459b:	89 e5                	mov    %esp,%ebp
+  80459d:	57                   	push   %edi
+  80459e:	56                   	push   %esi
+  80459f:	53                   	push   %ebx
+  8045a0:	83 ec 2c             	sub    $0x2c,%esp
+  8045a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8045a6:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  8045ab:	89 c1                	mov    %eax,%ecx
+  8045ad:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  8045b0:	c1 e8 11             	shr    $0x11,%eax
+  8045b3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8045b6:	8b 3c 85 80 dc 80 00 	mov    0x80dc80(,%eax,4),%edi
+  8045bd:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  8045c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8045c5:	d3 e0                	shl    %cl,%eax
+  8045c7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8045ca:	85 c7                	test   %eax,%edi
+  8045cc:	74 12                	je     8045e0 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  8045ce:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8045d3:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  8045d6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8045db:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8045de:	eb 17                	jmp    8045f7 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  8045e0:	ff 75 e0             	push   -0x20(%ebp)
+  8045e3:	68 44 5f 80 00       	push   $0x805f44
+  8045e8:	6a 48                	push   $0x48
+  8045ea:	68 5e 5f 80 00       	push   $0x805f5e
+  8045ef:	e8 a6 bc ff ff       	call   80029a <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  8045f4:	83 c3 01             	add    $0x1,%ebx
+  8045f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8045fa:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  8045fd:	89 c8                	mov    %ecx,%eax
+  8045ff:	c1 e8 05             	shr    $0x5,%eax
+  804602:	8b 14 85 80 ce 80 00 	mov    0x80ce80(,%eax,4),%edx
+  804609:	89 fe                	mov    %edi,%esi
+  80460b:	d3 e6                	shl    %cl,%esi
+  80460d:	89 f1                	mov    %esi,%ecx
+  80460f:	85 d6                	test   %edx,%esi
+  804611:	74 e1                	je     8045f4 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  804613:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  804616:	f7 d6                	not    %esi
+  804618:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80461b:	21 fe                	and    %edi,%esi
+  80461d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804620:	89 34 bd 80 dc 80 00 	mov    %esi,0x80dc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  804627:	f7 d1                	not    %ecx
+  804629:	21 d1                	and    %edx,%ecx
+  80462b:	89 0c 85 80 ce 80 00 	mov    %ecx,0x80ce80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804632:	83 ec 04             	sub    $0x4,%esp
+  804635:	53                   	push   %ebx
+  804636:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804639:	57                   	push   %edi
+  80463a:	6a 00                	push   $0x0
+  80463c:	e8 97 f8 ff ff       	call   803ed8 <page_unmap_range>
+	va_free(va, n);
+  804641:	83 c4 08             	add    $0x8,%esp
+  804644:	53                   	push   %ebx
+  804645:	57                   	push   %edi
+  804646:	e8 ed 05 00 00       	call   804c38 <va_free>
+}
+  80464b:	83 c4 10             	add    $0x10,%esp
+  80464e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804651:	5b                   	pop    %ebx
+  804652:	5e                   	pop    %esi
+  804653:	5f                   	pop    %edi
+  804654:	5d                   	pop    %ebp
+  804655:	c3                   	ret
+
+00804656 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  804656:	55                   	push   %ebp
+  804657:	89 e5                	mov    %esp,%ebp
+  804659:	57                   	push   %edi
+  80465a:	56                   	push   %esi
+  80465b:	53                   	push   %ebx
+  80465c:	83 ec 1c             	sub    $0x1c,%esp
+  80465f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804662:	85 db                	test   %ebx,%ebx
+  804664:	74 34                	je     80469a <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  804666:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80466c:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  804671:	77 2f                	ja     8046a2 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  804673:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  804679:	75 51                	jne    8046cc <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  80467b:	89 c1                	mov    %eax,%ecx
+  80467d:	c1 e9 0c             	shr    $0xc,%ecx
+  804680:	ba 01 00 00 00       	mov    $0x1,%edx
+  804685:	d3 e2                	shl    %cl,%edx
+  804687:	c1 e8 11             	shr    $0x11,%eax
+  80468a:	23 14 85 80 c0 80 00 	and    0x80c080(,%eax,4),%edx
+  804691:	75 24                	jne    8046b7 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  804693:	89 d8                	mov    %ebx,%eax
+  804695:	e8 00 ff ff ff       	call   80459a <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  80469a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80469d:	5b                   	pop    %ebx
+  80469e:	5e                   	pop    %esi
+  80469f:	5f                   	pop    %edi
+  8046a0:	5d                   	pop    %ebp
+  8046a1:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  8046a2:	53                   	push   %ebx
+  8046a3:	68 6b 5f 80 00       	push   $0x805f6b
+  8046a8:	68 a2 00 00 00       	push   $0xa2
+  8046ad:	68 5e 5f 80 00       	push   $0x805f5e
+  8046b2:	e8 e3 bb ff ff       	call   80029a <_panic>
+			panic("free: %p is not allocated", va);
+  8046b7:	53                   	push   %ebx
+  8046b8:	68 44 5f 80 00       	push   $0x805f44
+  8046bd:	68 a5 00 00 00       	push   $0xa5
+  8046c2:	68 5e 5f 80 00       	push   $0x805f5e
+  8046c7:	e8 ce bb ff ff       	call   80029a <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  8046cc:	89 de                	mov    %ebx,%esi
+  8046ce:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  8046d4:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  8046da:	89 c8                	mov    %ecx,%eax
+  8046dc:	c1 e8 11             	shr    $0x11,%eax
+  8046df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8046e2:	8b 3c 85 80 c0 80 00 	mov    0x80c080(,%eax,4),%edi
+  8046e9:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8046ec:	c1 e9 0c             	shr    $0xc,%ecx
+  8046ef:	b8 01 00 00 00       	mov    $0x1,%eax
+  8046f4:	d3 e0                	shl    %cl,%eax
+  8046f6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8046f9:	85 c7                	test   %eax,%edi
+  8046fb:	74 1b                	je     804718 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  8046fd:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804701:	89 d8                	mov    %ebx,%eax
+  804703:	29 f0                	sub    %esi,%eax
+  804705:	83 e8 10             	sub    $0x10,%eax
+  804708:	99                   	cltd
+  804709:	f7 ff                	idiv   %edi
+  80470b:	89 d1                	mov    %edx,%ecx
+  80470d:	85 d2                	test   %edx,%edx
+  80470f:	75 07                	jne    804718 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804711:	ba 10 00 00 00       	mov    $0x10,%edx
+  804716:	eb 18                	jmp    804730 <free+0xda>
+		panic("free: %p is not allocated", va);
+  804718:	53                   	push   %ebx
+  804719:	68 44 5f 80 00       	push   $0x805f44
+  80471e:	68 ad 00 00 00       	push   $0xad
+  804723:	68 5e 5f 80 00       	push   $0x805f5e
+  804728:	e8 6d bb ff ff       	call   80029a <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80472d:	83 c1 01             	add    $0x1,%ecx
+  804730:	89 d0                	mov    %edx,%eax
+  804732:	d3 e0                	shl    %cl,%eax
+  804734:	39 c7                	cmp    %eax,%edi
+  804736:	7f f5                	jg     80472d <free+0xd7>
+	*(void **) va = s->free;
+  804738:	8b 46 08             	mov    0x8(%esi),%eax
+  80473b:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  80473d:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  804740:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  804744:	8d 58 01             	lea    0x1(%eax),%ebx
+  804747:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  80474b:	66 85 c0             	test   %ax,%ax
+  80474e:	74 52                	je     8047a2 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804750:	0f b7 db             	movzwl %bx,%ebx
+  804753:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804757:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80475c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804761:	f7 ff                	idiv   %edi
+  804763:	39 c3                	cmp    %eax,%ebx
+  804765:	0f 85 2f ff ff ff    	jne    80469a <free+0x44>
+  80476b:	8b 46 04             	mov    0x4(%esi),%eax
+  80476e:	85 c0                	test   %eax,%eax
+  804770:	74 53                	je     8047c5 <free+0x16f>
+		s->prev->next = s->next;
+  804772:	8b 16                	mov    (%esi),%edx
+  804774:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804776:	8b 06                	mov    (%esi),%eax
+  804778:	85 c0                	test   %eax,%eax
+  80477a:	74 06                	je     804782 <free+0x12c>
+		s->next->prev = s->prev;
+  80477c:	8b 56 04             	mov    0x4(%esi),%edx
+  80477f:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804782:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804785:	f7 d0                	not    %eax
+  804787:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80478a:	21 d0                	and    %edx,%eax
+  80478c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80478f:	89 04 95 80 c0 80 00 	mov    %eax,0x80c080(,%edx,4)
+		heap_free_pages(s);
+  804796:	89 f0                	mov    %esi,%eax
+  804798:	e8 fd fd ff ff       	call   80459a <heap_free_pages>
+  80479d:	e9 f8 fe ff ff       	jmp    80469a <free+0x44>
+	s->prev = NULL;
+  8047a2:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  8047a9:	8b 04 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%eax
+  8047b0:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  8047b2:	85 c0                	test   %eax,%eax
+  8047b4:	74 03                	je     8047b9 <free+0x163>
+		slabs[c]->prev = s;
+  8047b6:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  8047b9:	89 34 8d 60 c0 80 00 	mov    %esi,0x80c060(,%ecx,4)
+}
+  8047c0:	e9 d5 fe ff ff       	jmp    80469a <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8047c5:	8b 06                	mov    (%esi),%eax
+  8047c7:	85 c0                	test   %eax,%eax
+  8047c9:	0f 84 cb fe ff ff    	je     80469a <free+0x44>
+		slabs[c] = s->next;
+  8047cf:	89 04 8d 60 c0 80 00 	mov    %eax,0x80c060(,%ecx,4)
+	if (s->next)
+  8047d6:	8b 06                	mov    (%esi),%eax
+  8047d8:	eb a2                	jmp    80477c <free+0x126>
+
+008047da <heap_alloc_pages>:
+{
+  8047da:	55                   	push   %ebp
+  8047db:	89 e5                	mov    %esp,%ebp
+  8047dd:	57                   	push   %edi
+  8047de:	56                   	push   %esi
+  8047df:	53                   	push   %ebx
+  8047e0:	83 ec 18             	sub    $0x18,%esp
+  8047e3:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  8047e5:	50                   	push   %eax
+  8047e6:	e8 15 03 00 00       	call   804b00 <va_alloc>
+  8047eb:	89 c3                	mov    %eax,%ebx
+  8047ed:	83 c4 10             	add    $0x10,%esp
+  8047f0:	85 c0                	test   %eax,%eax
+  8047f2:	74 47                	je     80483b <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8047f4:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  8047fa:	89 c1                	mov    %eax,%ecx
+  8047fc:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  8047ff:	c1 e8 11             	shr    $0x11,%eax
+  804802:	ba 01 00 00 00       	mov    $0x1,%edx
+  804807:	89 d7                	mov    %edx,%edi
+  804809:	d3 e7                	shl    %cl,%edi
+  80480b:	09 3c 85 80 dc 80 00 	or     %edi,0x80dc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  804812:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  804816:	89 c8                	mov    %ecx,%eax
+  804818:	c1 e8 05             	shr    $0x5,%eax
+  80481b:	d3 e2                	shl    %cl,%edx
+  80481d:	09 14 85 80 ce 80 00 	or     %edx,0x80ce80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  804824:	83 ec 0c             	sub    $0xc,%esp
+  804827:	6a 00                	push   $0x0
+  804829:	6a 07                	push   $0x7
+  80482b:	56                   	push   %esi
+  80482c:	53                   	push   %ebx
+  80482d:	6a 00                	push   $0x0
+  80482f:	e8 3a f7 ff ff       	call   803f6e <page_alloc_range>
+  804834:	83 c4 20             	add    $0x20,%esp
+  804837:	85 c0                	test   %eax,%eax
+  804839:	78 0a                	js     804845 <heap_alloc_pages+0x6b>
+}
+  80483b:	89 d8                	mov    %ebx,%eax
+  80483d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804840:	5b                   	pop    %ebx
+  804841:	5e                   	pop    %esi
+  804842:	5f                   	pop    %edi
+  804843:	5d                   	pop    %ebp
+  804844:	c3                   	ret
+		free(va);
+  804845:	83 ec 0c             	sub    $0xc,%esp
+  804848:	53                   	push   %ebx
+  804849:	e8 08 fe ff ff       	call   804656 <free>
+		return NULL;
+  80484e:	83 c4 10             	add    $0x10,%esp
+  804851:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804856:	eb e3                	jmp    80483b <heap_alloc_pages+0x61>
+
+00804858 <malloc>:
+{
+  804858:	55                   	push   %ebp
+  804859:	89 e5                	mov    %esp,%ebp
+  80485b:	57                   	push   %edi
+  80485c:	56                   	push   %esi
+  80485d:	53                   	push   %ebx
+  80485e:	83 ec 1c             	sub    $0x1c,%esp
+  804861:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804864:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804867:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  80486d:	0f 87 21 01 00 00    	ja     804994 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804873:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804878:	ba 10 00 00 00       	mov    $0x10,%edx
+  80487d:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  80487f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804884:	76 15                	jbe    80489b <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804886:	05 ff 0f 00 00       	add    $0xfff,%eax
+  80488b:	c1 e8 0c             	shr    $0xc,%eax
+  80488e:	e8 47 ff ff ff       	call   8047da <heap_alloc_pages>
+  804893:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804896:	eb 37                	jmp    8048cf <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804898:	83 c1 01             	add    $0x1,%ecx
+  80489b:	89 d6                	mov    %edx,%esi
+  80489d:	d3 e6                	shl    %cl,%esi
+  80489f:	39 c6                	cmp    %eax,%esi
+  8048a1:	72 f5                	jb     804898 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  8048a3:	89 cb                	mov    %ecx,%ebx
+  8048a5:	8b 3c 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%edi
+  8048ac:	85 ff                	test   %edi,%edi
+  8048ae:	74 2a                	je     8048da <malloc+0x82>
+	v = s->free;
+  8048b0:	8b 47 08             	mov    0x8(%edi),%eax
+  8048b3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  8048b6:	8b 00                	mov    (%eax),%eax
+  8048b8:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  8048bb:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  8048bf:	83 e8 01             	sub    $0x1,%eax
+  8048c2:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  8048c6:	66 85 c0             	test   %ax,%ax
+  8048c9:	0f 84 9a 00 00 00    	je     804969 <malloc+0x111>
+}
+  8048cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8048d2:	83 c4 1c             	add    $0x1c,%esp
+  8048d5:	5b                   	pop    %ebx
+  8048d6:	5e                   	pop    %esi
+  8048d7:	5f                   	pop    %edi
+  8048d8:	5d                   	pop    %ebp
+  8048d9:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  8048da:	b8 01 00 00 00       	mov    $0x1,%eax
+  8048df:	e8 f6 fe ff ff       	call   8047da <heap_alloc_pages>
+  8048e4:	89 c1                	mov    %eax,%ecx
+  8048e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8048e9:	85 c0                	test   %eax,%eax
+  8048eb:	74 e2                	je     8048cf <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8048ed:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  8048f3:	89 c8                	mov    %ecx,%eax
+  8048f5:	c1 e8 11             	shr    $0x11,%eax
+  8048f8:	c1 e9 0c             	shr    $0xc,%ecx
+  8048fb:	ba 01 00 00 00       	mov    $0x1,%edx
+  804900:	d3 e2                	shl    %cl,%edx
+  804902:	09 14 85 80 c0 80 00 	or     %edx,0x80c080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804909:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80490c:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  804910:	0f b7 f6             	movzwl %si,%esi
+  804913:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804918:	ba 00 00 00 00       	mov    $0x0,%edx
+  80491d:	f7 fe                	idiv   %esi
+  80491f:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804923:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  804926:	85 c0                	test   %eax,%eax
+  804928:	74 14                	je     80493e <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  80492a:	83 e8 01             	sub    $0x1,%eax
+  80492d:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804931:	0f af d0             	imul   %eax,%edx
+  804934:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804938:	89 3a                	mov    %edi,(%edx)
+  80493a:	89 d7                	mov    %edx,%edi
+  80493c:	eb e5                	jmp    804923 <malloc+0xcb>
+	s->prev = NULL;
+  80493e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804941:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804948:	8b 04 9d 60 c0 80 00 	mov    0x80c060(,%ebx,4),%eax
+  80494f:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804951:	85 c0                	test   %eax,%eax
+  804953:	74 03                	je     804958 <malloc+0x100>
+		slabs[c]->prev = s;
+  804955:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804958:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80495b:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+	return s;
+  804962:	89 c7                	mov    %eax,%edi
+  804964:	e9 47 ff ff ff       	jmp    8048b0 <malloc+0x58>
+	if (s->prev)
+  804969:	8b 47 04             	mov    0x4(%edi),%eax
+  80496c:	85 c0                	test   %eax,%eax
+  80496e:	74 19                	je     804989 <malloc+0x131>
+		s->prev->next = s->next;
+  804970:	8b 17                	mov    (%edi),%edx
+  804972:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804974:	8b 07                	mov    (%edi),%eax
+  804976:	85 c0                	test   %eax,%eax
+  804978:	0f 84 51 ff ff ff    	je     8048cf <malloc+0x77>
+		s->next->prev = s->prev;
+  80497e:	8b 57 04             	mov    0x4(%edi),%edx
+  804981:	89 50 04             	mov    %edx,0x4(%eax)
+  804984:	e9 46 ff ff ff       	jmp    8048cf <malloc+0x77>
+		slabs[c] = s->next;
+  804989:	8b 07                	mov    (%edi),%eax
+  80498b:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+  804992:	eb e0                	jmp    804974 <malloc+0x11c>
+		return NULL;
+  804994:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80499b:	e9 2f ff ff ff       	jmp    8048cf <malloc+0x77>
+
+008049a0 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  8049a0:	55                   	push   %ebp
+  8049a1:	89 e5                	mov    %esp,%ebp
+  8049a3:	57                   	push   %edi
+  8049a4:	56                   	push   %esi
+  8049a5:	53                   	push   %ebx
+  8049a6:	83 ec 0c             	sub    $0xc,%esp
+  8049a9:	89 c6                	mov    %eax,%esi
+  8049ab:	89 d7                	mov    %edx,%edi
+  8049ad:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8049b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8049b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049ba:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  8049bf:	83 ef 01             	sub    $0x1,%edi
+  8049c2:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8049c5:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8049c8:	eb 34                	jmp    8049fe <va_chunk_scan+0x5e>
+			i += 31;
+  8049ca:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  8049cd:	89 ca                	mov    %ecx,%edx
+			continue;
+  8049cf:	eb 23                	jmp    8049f4 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8049d1:	89 c7                	mov    %eax,%edi
+  8049d3:	c1 ef 05             	shr    $0x5,%edi
+  8049d6:	be 01 00 00 00       	mov    $0x1,%esi
+  8049db:	d3 e6                	shl    %cl,%esi
+  8049dd:	89 f1                	mov    %esi,%ecx
+  8049df:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8049e2:	23 0c be             	and    (%esi,%edi,4),%ecx
+  8049e5:	75 41                	jne    804a28 <va_chunk_scan+0x88>
+			len++;
+  8049e7:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  8049ea:	39 d3                	cmp    %edx,%ebx
+  8049ec:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  8049ef:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  8049f2:	72 2d                	jb     804a21 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8049f4:	83 c0 01             	add    $0x1,%eax
+  8049f7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8049fc:	77 31                	ja     804a2f <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  8049fe:	89 c1                	mov    %eax,%ecx
+  804a00:	83 e1 1f             	and    $0x1f,%ecx
+  804a03:	75 cc                	jne    8049d1 <va_chunk_scan+0x31>
+  804a05:	89 c7                	mov    %eax,%edi
+  804a07:	c1 ef 05             	shr    $0x5,%edi
+  804a0a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804a0d:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804a10:	83 ff ff             	cmp    $0xffffffff,%edi
+  804a13:	74 b5                	je     8049ca <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  804a15:	85 ff                	test   %edi,%edi
+  804a17:	75 b8                	jne    8049d1 <va_chunk_scan+0x31>
+			i += 31;
+  804a19:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804a1c:	83 c2 20             	add    $0x20,%edx
+  804a1f:	eb c9                	jmp    8049ea <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804a21:	83 c0 01             	add    $0x1,%eax
+  804a24:	29 d0                	sub    %edx,%eax
+  804a26:	eb 15                	jmp    804a3d <va_chunk_scan+0x9d>
+			len = 0;
+  804a28:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a2d:	eb c5                	jmp    8049f4 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804a2f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804a34:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804a37:	85 d2                	test   %edx,%edx
+  804a39:	74 02                	je     804a3d <va_chunk_scan+0x9d>
+		*run_store = best;
+  804a3b:	89 1a                	mov    %ebx,(%edx)
+}
+  804a3d:	83 c4 0c             	add    $0xc,%esp
+  804a40:	5b                   	pop    %ebx
+  804a41:	5e                   	pop    %esi
+  804a42:	5f                   	pop    %edi
+  804a43:	5d                   	pop    %ebp
+  804a44:	c3                   	ret
+
+00804a45 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804a45:	55                   	push   %ebp
+  804a46:	89 e5                	mov    %esp,%ebp
+  804a48:	57                   	push   %edi
+  804a49:	56                   	push   %esi
+  804a4a:	53                   	push   %ebx
+  804a4b:	83 ec 14             	sub    $0x14,%esp
+  804a4e:	89 c3                	mov    %eax,%ebx
+  804a50:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804a52:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804a58:	8d ba a0 ea 80 00    	lea    0x80eaa0(%edx),%edi
+  804a5e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804a61:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804a64:	89 d6                	mov    %edx,%esi
+  804a66:	81 c6 a0 ea 80 00    	add    $0x80eaa0,%esi
+  804a6c:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804a6e:	eb 34                	jmp    804aa4 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804a70:	89 c8                	mov    %ecx,%eax
+  804a72:	c1 e8 05             	shr    $0x5,%eax
+  804a75:	89 da                	mov    %ebx,%edx
+  804a77:	c1 e2 05             	shl    $0x5,%edx
+  804a7a:	01 da                	add    %ebx,%edx
+  804a7c:	01 c2                	add    %eax,%edx
+  804a7e:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804a83:	d3 c0                	rol    %cl,%eax
+  804a85:	21 04 95 a0 ea 80 00 	and    %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804a8c:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804a93:	b8 01 00 00 00       	mov    $0x1,%eax
+  804a98:	01 d0                	add    %edx,%eax
+  804a9a:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804aa1:	83 c1 01             	add    $0x1,%ecx
+  804aa4:	39 f9                	cmp    %edi,%ecx
+  804aa6:	74 30                	je     804ad8 <va_chunk_mark+0x93>
+		if (alloc)
+  804aa8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804aac:	74 c2                	je     804a70 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804aae:	89 c8                	mov    %ecx,%eax
+  804ab0:	c1 e8 05             	shr    $0x5,%eax
+  804ab3:	89 da                	mov    %ebx,%edx
+  804ab5:	c1 e2 05             	shl    $0x5,%edx
+  804ab8:	01 da                	add    %ebx,%edx
+  804aba:	01 c2                	add    %eax,%edx
+  804abc:	b8 01 00 00 00       	mov    $0x1,%eax
+  804ac1:	d3 e0                	shl    %cl,%eax
+  804ac3:	09 04 95 a0 ea 80 00 	or     %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804aca:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804ad1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804ad6:	eb c0                	jmp    804a98 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804ad8:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804adb:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ae0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804ae3:	e8 b8 fe ff ff       	call   8049a0 <va_chunk_scan>
+	ch->run = run;
+  804ae8:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804aee:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804af1:	66 89 83 22 eb 80 00 	mov    %ax,0x80eb22(%ebx)
+}
+  804af8:	83 c4 14             	add    $0x14,%esp
+  804afb:	5b                   	pop    %ebx
+  804afc:	5e                   	pop    %esi
+  804afd:	5f                   	pop    %edi
+  804afe:	5d                   	pop    %ebp
+  804aff:	c3                   	ret
+
+00804b00 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804b00:	55                   	push   %ebp
+  804b01:	89 e5                	mov    %esp,%ebp
+  804b03:	57                   	push   %edi
+  804b04:	56                   	push   %esi
+  804b05:	53                   	push   %ebx
+  804b06:	83 ec 04             	sub    $0x4,%esp
+  804b09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804b0c:	b8 20 eb 80 00       	mov    $0x80eb20,%eax
+  804b11:	ba 90 f9 80 00       	mov    $0x80f990,%edx
+  804b16:	80 3d 80 ea 80 00 00 	cmpb   $0x0,0x80ea80
+  804b1d:	74 4f                	je     804b6e <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804b1f:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804b22:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804b27:	0f 87 01 01 00 00    	ja     804c2e <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804b2d:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804b33:	0f 87 80 00 00 00    	ja     804bb9 <va_alloc+0xb9>
+  804b39:	b8 22 eb 80 00       	mov    $0x80eb22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804b3e:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804b43:	0f b7 10             	movzwl (%eax),%edx
+  804b46:	05 84 00 00 00       	add    $0x84,%eax
+  804b4b:	39 da                	cmp    %ebx,%edx
+  804b4d:	73 2c                	jae    804b7b <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804b4f:	83 c6 01             	add    $0x1,%esi
+  804b52:	83 fe 1c             	cmp    $0x1c,%esi
+  804b55:	75 ec                	jne    804b43 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804b57:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b5c:	eb 53                	jmp    804bb1 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804b5e:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804b64:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804b69:	05 84 00 00 00       	add    $0x84,%eax
+  804b6e:	39 d0                	cmp    %edx,%eax
+  804b70:	75 ec                	jne    804b5e <va_alloc+0x5e>
+	va_inited = 1;
+  804b72:	c6 05 80 ea 80 00 01 	movb   $0x1,0x80ea80
+}
+  804b79:	eb a4                	jmp    804b1f <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804b7b:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804b81:	05 a0 ea 80 00       	add    $0x80eaa0,%eax
+  804b86:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804b8b:	89 da                	mov    %ebx,%edx
+  804b8d:	e8 0e fe ff ff       	call   8049a0 <va_chunk_scan>
+  804b92:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804b94:	6a 01                	push   $0x1
+  804b96:	89 d9                	mov    %ebx,%ecx
+  804b98:	89 c2                	mov    %eax,%edx
+  804b9a:	89 f0                	mov    %esi,%eax
+  804b9c:	e8 a4 fe ff ff       	call   804a45 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804ba1:	c1 e6 16             	shl    $0x16,%esi
+  804ba4:	c1 e7 0c             	shl    $0xc,%edi
+  804ba7:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804bae:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804bb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804bb4:	5b                   	pop    %ebx
+  804bb5:	5e                   	pop    %esi
+  804bb6:	5f                   	pop    %edi
+  804bb7:	5d                   	pop    %ebp
+  804bb8:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804bb9:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804bbf:	c1 ee 0a             	shr    $0xa,%esi
+  804bc2:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bcc:	eb 0a                	jmp    804bd8 <va_alloc+0xd8>
+			first = c + 1;
+  804bce:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804bd0:	83 c2 01             	add    $0x1,%edx
+  804bd3:	83 fa 1d             	cmp    $0x1d,%edx
+  804bd6:	74 4f                	je     804c27 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804bd8:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804bde:	66 81 b9 9c ea 80 00 	cmpw   $0x400,0x80ea9c(%ecx)
+  804be5:	00 04 
+  804be7:	75 e5                	jne    804bce <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804be9:	89 d1                	mov    %edx,%ecx
+  804beb:	29 c1                	sub    %eax,%ecx
+  804bed:	39 f1                	cmp    %esi,%ecx
+  804bef:	75 df                	jne    804bd0 <va_alloc+0xd0>
+  804bf1:	89 c7                	mov    %eax,%edi
+  804bf3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804bf6:	be 00 04 00 00       	mov    $0x400,%esi
+  804bfb:	39 f3                	cmp    %esi,%ebx
+  804bfd:	0f 46 f3             	cmovbe %ebx,%esi
+  804c00:	6a 01                	push   $0x1
+  804c02:	89 f1                	mov    %esi,%ecx
+  804c04:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c09:	89 f8                	mov    %edi,%eax
+  804c0b:	e8 35 fe ff ff       	call   804a45 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804c10:	83 c7 01             	add    $0x1,%edi
+  804c13:	83 c4 04             	add    $0x4,%esp
+  804c16:	29 f3                	sub    %esi,%ebx
+  804c18:	75 dc                	jne    804bf6 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804c1a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804c1d:	c1 e0 16             	shl    $0x16,%eax
+  804c20:	05 00 00 00 08       	add    $0x8000000,%eax
+  804c25:	eb 8a                	jmp    804bb1 <va_alloc+0xb1>
+	return NULL;
+  804c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c2c:	eb 83                	jmp    804bb1 <va_alloc+0xb1>
+		return NULL;
+  804c2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c33:	e9 79 ff ff ff       	jmp    804bb1 <va_alloc+0xb1>
+
+00804c38 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804c38:	55                   	push   %ebp
+  804c39:	89 e5                	mov    %esp,%ebp
+  804c3b:	57                   	push   %edi
+  804c3c:	56                   	push   %esi
+  804c3d:	53                   	push   %ebx
+  804c3e:	83 ec 0c             	sub    $0xc,%esp
+  804c41:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804c44:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804c47:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804c4d:	76 21                	jbe    804c70 <va_free+0x38>
+  804c4f:	89 f0                	mov    %esi,%eax
+  804c51:	c1 e0 0c             	shl    $0xc,%eax
+  804c54:	01 f8                	add    %edi,%eax
+  804c56:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804c5b:	77 13                	ja     804c70 <va_free+0x38>
+	    || PGOFF(va))
+  804c5d:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804c63:	75 0b                	jne    804c70 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804c65:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804c6b:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804c6e:	eb 45                	jmp    804cb5 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804c70:	83 ec 0c             	sub    $0xc,%esp
+  804c73:	56                   	push   %esi
+  804c74:	57                   	push   %edi
+  804c75:	68 88 5f 80 00       	push   $0x805f88
+  804c7a:	68 8e 00 00 00       	push   $0x8e
+  804c7f:	68 a8 5f 80 00       	push   $0x805fa8
+  804c84:	e8 11 b6 ff ff       	call   80029a <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804c89:	89 fa                	mov    %edi,%edx
+  804c8b:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804c91:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804c96:	29 d3                	sub    %edx,%ebx
+  804c98:	39 f3                	cmp    %esi,%ebx
+  804c9a:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804c9d:	89 f8                	mov    %edi,%eax
+  804c9f:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804ca2:	83 ec 0c             	sub    $0xc,%esp
+  804ca5:	6a 00                	push   $0x0
+  804ca7:	89 d9                	mov    %ebx,%ecx
+  804ca9:	e8 97 fd ff ff       	call   804a45 <va_chunk_mark>
+		i += n;
+  804cae:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804cb0:	29 de                	sub    %ebx,%esi
+  804cb2:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804cb5:	85 f6                	test   %esi,%esi
+  804cb7:	75 d0                	jne    804c89 <va_free+0x51>
+	}
+}
+  804cb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804cbc:	5b                   	pop    %ebx
+  804cbd:	5e                   	pop    %esi
+  804cbe:	5f                   	pop    %edi
+  804cbf:	5d                   	pop    %ebp
+  804cc0:	c3                   	ret
+
+00804cc1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804cc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cc6:	c3                   	ret
+
+00804cc7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804cc7:	55                   	push   %ebp
+  804cc8:	89 e5                	mov    %esp,%ebp
+  804cca:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804ccd:	68 b5 5f 80 00       	push   $0x805fb5
+  804cd2:	ff 75 0c             	push   0xc(%ebp)
+  804cd5:	e8 82 bc ff ff       	call   80095c <strcpy>
+	return 0;
+}
+  804cda:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cdf:	c9                   	leave
+  804ce0:	c3                   	ret
+
+00804ce1 <devcons_write>:
+{
+  804ce1:	55                   	push   %ebp
+  804ce2:	89 e5                	mov    %esp,%ebp
+  804ce4:	57                   	push   %edi
+  804ce5:	56                   	push   %esi
+  804ce6:	53                   	push   %ebx
+  804ce7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804ced:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804cf2:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804cf8:	eb 2e                	jmp    804d28 <devcons_write+0x47>
+		m = n - tot;
+  804cfa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804cfd:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804cff:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804d04:	39 c3                	cmp    %eax,%ebx
+  804d06:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804d09:	83 ec 04             	sub    $0x4,%esp
+  804d0c:	53                   	push   %ebx
+  804d0d:	89 f0                	mov    %esi,%eax
+  804d0f:	03 45 0c             	add    0xc(%ebp),%eax
+  804d12:	50                   	push   %eax
+  804d13:	57                   	push   %edi
+  804d14:	e8 c9 bd ff ff       	call   800ae2 <memmove>
+		sys_cputs(buf, m);
+  804d19:	83 c4 08             	add    $0x8,%esp
+  804d1c:	53                   	push   %ebx
+  804d1d:	57                   	push   %edi
+  804d1e:	e8 5f c0 ff ff       	call   800d82 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804d23:	01 de                	add    %ebx,%esi
+  804d25:	83 c4 10             	add    $0x10,%esp
+  804d28:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804d2b:	72 cd                	jb     804cfa <devcons_write+0x19>
+}
+  804d2d:	89 f0                	mov    %esi,%eax
+  804d2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804d32:	5b                   	pop    %ebx
+  804d33:	5e                   	pop    %esi
+  804d34:	5f                   	pop    %edi
+  804d35:	5d                   	pop    %ebp
+  804d36:	c3                   	ret
+
+00804d37 <devcons_read>:
+{
+  804d37:	55                   	push   %ebp
+  804d38:	89 e5                	mov    %esp,%ebp
+  804d3a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d42:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804d46:	75 07                	jne    804d4f <devcons_read+0x18>
+  804d48:	eb 1f                	jmp    804d69 <devcons_read+0x32>
+		sys_yield();
+  804d4a:	e8 e1 c0 ff ff       	call   800e30 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804d4f:	e8 5d c0 ff ff       	call   800db1 <sys_cgetc>
+  804d54:	85 c0                	test   %eax,%eax
+  804d56:	74 f2                	je     804d4a <devcons_read+0x13>
+	if (c < 0)
+  804d58:	78 0f                	js     804d69 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804d5a:	83 f8 04             	cmp    $0x4,%eax
+  804d5d:	74 0c                	je     804d6b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804d5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804d62:	88 02                	mov    %al,(%edx)
+	return 1;
+  804d64:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804d69:	c9                   	leave
+  804d6a:	c3                   	ret
+		return 0;
+  804d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d70:	eb f7                	jmp    804d69 <devcons_read+0x32>
+
+00804d72 <cputchar>:
+{
+  804d72:	55                   	push   %ebp
+  804d73:	89 e5                	mov    %esp,%ebp
+  804d75:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804d78:	8b 45 08             	mov    0x8(%ebp),%eax
+  804d7b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804d7e:	6a 01                	push   $0x1
+  804d80:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804d83:	50                   	push   %eax
+  804d84:	e8 f9 bf ff ff       	call   800d82 <sys_cputs>
+}
+  804d89:	83 c4 10             	add    $0x10,%esp
+  804d8c:	c9                   	leave
+  804d8d:	c3                   	ret
+
+00804d8e <getchar>:
+{
+  804d8e:	55                   	push   %ebp
+  804d8f:	89 e5                	mov    %esp,%ebp
+  804d91:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804d94:	6a 01                	push   $0x1
+  804d96:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804d99:	50                   	push   %eax
+  804d9a:	6a 00                	push   $0x0
+  804d9c:	e8 d7 ce ff ff       	call   801c78 <read>
+	if (r < 0)
+  804da1:	83 c4 10             	add    $0x10,%esp
+  804da4:	85 c0                	test   %eax,%eax
+  804da6:	78 06                	js     804dae <getchar+0x20>
+	if (r < 1)
+  804da8:	74 06                	je     804db0 <getchar+0x22>
+	return c;
+  804daa:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804dae:	c9                   	leave
+  804daf:	c3                   	ret
+		return -E_EOF;
+  804db0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804db5:	eb f7                	jmp    804dae <getchar+0x20>
+
+00804db7 <iscons>:
+{
+  804db7:	55                   	push   %ebp
+  804db8:	89 e5                	mov    %esp,%ebp
+  804dba:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804dbd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804dc0:	50                   	push   %eax
+  804dc1:	ff 75 08             	push   0x8(%ebp)
+  804dc4:	e8 50 cc ff ff       	call   801a19 <fd_lookup>
+  804dc9:	83 c4 10             	add    $0x10,%esp
+  804dcc:	85 c0                	test   %eax,%eax
+  804dce:	78 11                	js     804de1 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804dd0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804dd3:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  804dd9:	39 10                	cmp    %edx,(%eax)
+  804ddb:	0f 94 c0             	sete   %al
+  804dde:	0f b6 c0             	movzbl %al,%eax
+}
+  804de1:	c9                   	leave
+  804de2:	c3                   	ret
+
+00804de3 <opencons>:
+{
+  804de3:	55                   	push   %ebp
+  804de4:	89 e5                	mov    %esp,%ebp
+  804de6:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804de9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804dec:	50                   	push   %eax
+  804ded:	e8 d3 cb ff ff       	call   8019c5 <fd_alloc>
+  804df2:	83 c4 10             	add    $0x10,%esp
+  804df5:	85 c0                	test   %eax,%eax
+  804df7:	78 3a                	js     804e33 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804df9:	83 ec 04             	sub    $0x4,%esp
+  804dfc:	68 07 04 00 00       	push   $0x407
+  804e01:	ff 75 f4             	push   -0xc(%ebp)
+  804e04:	6a 00                	push   $0x0
+  804e06:	e8 44 c0 ff ff       	call   800e4f <sys_page_alloc>
+  804e0b:	83 c4 10             	add    $0x10,%esp
+  804e0e:	85 c0                	test   %eax,%eax
+  804e10:	78 21                	js     804e33 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804e12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804e15:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  804e1b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804e1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804e20:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804e27:	83 ec 0c             	sub    $0xc,%esp
+  804e2a:	50                   	push   %eax
+  804e2b:	e8 6e cb ff ff       	call   80199e <fd2num>
+  804e30:	83 c4 10             	add    $0x10,%esp
+}
+  804e33:	c9                   	leave
+  804e34:	c3                   	ret
+
+00804e35 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804e35:	55                   	push   %ebp
+  804e36:	89 e5                	mov    %esp,%ebp
+  804e38:	56                   	push   %esi
+  804e39:	53                   	push   %ebx
+  804e3a:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804e3d:	a1 10 f9 80 00       	mov    0x80f910,%eax
+  804e42:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804e45:	85 db                	test   %ebx,%ebx
+  804e47:	78 17                	js     804e60 <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804e49:	83 ec 0c             	sub    $0xc,%esp
+  804e4c:	56                   	push   %esi
+  804e4d:	ff 14 9d 00 10 81 00 	call   *0x811000(,%ebx,4)
+  804e54:	83 c4 10             	add    $0x10,%esp
+  804e57:	85 c0                	test   %eax,%eax
+  804e59:	75 27                	jne    804e82 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804e5b:	83 eb 01             	sub    $0x1,%ebx
+  804e5e:	eb e5                	jmp    804e45 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804e60:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804e65:	8b 40 48             	mov    0x48(%eax),%eax
+  804e68:	83 ec 08             	sub    $0x8,%esp
+  804e6b:	ff 76 28             	push   0x28(%esi)
+  804e6e:	ff 36                	push   (%esi)
+  804e70:	50                   	push   %eax
+  804e71:	68 c4 5f 80 00       	push   $0x805fc4
+  804e76:	6a 1d                	push   $0x1d
+  804e78:	68 e7 5f 80 00       	push   $0x805fe7
+  804e7d:	e8 18 b4 ff ff       	call   80029a <_panic>
+}
+  804e82:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804e85:	5b                   	pop    %ebx
+  804e86:	5e                   	pop    %esi
+  804e87:	5d                   	pop    %ebp
+  804e88:	c3                   	ret
+
+00804e89 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804e89:	55                   	push   %ebp
+  804e8a:	89 e5                	mov    %esp,%ebp
+  804e8c:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804e8f:	83 3d 28 10 81 00 00 	cmpl   $0x0,0x811028
+  804e96:	74 0a                	je     804ea2 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804e98:	8b 45 08             	mov    0x8(%ebp),%eax
+  804e9b:	a3 28 10 81 00       	mov    %eax,0x811028
+}
+  804ea0:	c9                   	leave
+  804ea1:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804ea2:	83 ec 04             	sub    $0x4,%esp
+  804ea5:	6a 07                	push   $0x7
+  804ea7:	68 00 f0 bf ee       	push   $0xeebff000
+  804eac:	6a 00                	push   $0x0
+  804eae:	e8 9c bf ff ff       	call   800e4f <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804eb3:	83 c4 08             	add    $0x8,%esp
+  804eb6:	68 29 4f 80 00       	push   $0x804f29
+  804ebb:	6a 00                	push   $0x0
+  804ebd:	e8 f3 c2 ff ff       	call   8011b5 <sys_env_set_pgfault_upcall>
+  804ec2:	83 c4 10             	add    $0x10,%esp
+  804ec5:	eb d1                	jmp    804e98 <set_pgfault_handler+0xf>
+
+00804ec7 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804ec7:	55                   	push   %ebp
+  804ec8:	89 e5                	mov    %esp,%ebp
+  804eca:	83 ec 08             	sub    $0x8,%esp
+  804ecd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  804ed0:	8b 15 10 f9 80 00    	mov    0x80f910,%edx
+  804ed6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804edb:	eb 03                	jmp    804ee0 <add_pgfault_handler+0x19>
+  804edd:	83 c0 01             	add    $0x1,%eax
+  804ee0:	39 d0                	cmp    %edx,%eax
+  804ee2:	74 0b                	je     804eef <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804ee4:	39 0c 85 00 10 81 00 	cmp    %ecx,0x811000(,%eax,4)
+  804eeb:	75 f0                	jne    804edd <add_pgfault_handler+0x16>
+  804eed:	eb 24                	jmp    804f13 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  804eef:	83 fa 0a             	cmp    $0xa,%edx
+  804ef2:	74 21                	je     804f15 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  804ef4:	8d 42 01             	lea    0x1(%edx),%eax
+  804ef7:	a3 10 f9 80 00       	mov    %eax,0x80f910
+  804efc:	89 0c 95 00 10 81 00 	mov    %ecx,0x811000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  804f03:	83 ec 0c             	sub    $0xc,%esp
+  804f06:	68 35 4e 80 00       	push   $0x804e35
+  804f0b:	e8 79 ff ff ff       	call   804e89 <set_pgfault_handler>
+  804f10:	83 c4 10             	add    $0x10,%esp
+}
+  804f13:	c9                   	leave
+  804f14:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  804f15:	83 ec 04             	sub    $0x4,%esp
+  804f18:	68 f5 5f 80 00       	push   $0x805ff5
+  804f1d:	6a 44                	push   $0x44
+  804f1f:	68 e7 5f 80 00       	push   $0x805fe7
+  804f24:	e8 71 b3 ff ff       	call   80029a <_panic>
+
+00804f29 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804f29:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804f2a:	a1 28 10 81 00       	mov    0x811028,%eax
+	call *%eax
+  804f2f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804f31:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  804f34:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  804f38:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  804f3c:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  804f3f:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  804f41:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  804f45:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  804f48:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  804f49:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  804f4c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  804f4d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  804f4e:	c3                   	ret
+
+00804f4f <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  804f4f:	55                   	push   %ebp
+  804f50:	89 e5                	mov    %esp,%ebp
+  804f52:	57                   	push   %edi
+  804f53:	56                   	push   %esi
+  804f54:	53                   	push   %ebx
+  804f55:	83 ec 14             	sub    $0x14,%esp
+  804f58:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804f5b:	8b 75 14             	mov    0x14(%ebp),%esi
+  804f5e:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804f61:	ff 75 10             	push   0x10(%ebp)
+  804f64:	ff 75 0c             	push   0xc(%ebp)
+  804f67:	e8 06 c3 ff ff       	call   801272 <sys_ipc_recv_pages>
+  804f6c:	83 c4 10             	add    $0x10,%esp
+  804f6f:	85 c0                	test   %eax,%eax
+  804f71:	78 46                	js     804fb9 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804f73:	85 ff                	test   %edi,%edi
+  804f75:	74 0d                	je     804f84 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804f77:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804f7c:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804f82:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804f84:	85 f6                	test   %esi,%esi
+  804f86:	74 0d                	je     804f95 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804f88:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804f8d:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804f93:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804f95:	85 db                	test   %ebx,%ebx
+  804f97:	74 0d                	je     804fa6 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804f99:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804f9e:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804fa4:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804fa6:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804fab:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804fb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804fb4:	5b                   	pop    %ebx
+  804fb5:	5e                   	pop    %esi
+  804fb6:	5f                   	pop    %edi
+  804fb7:	5d                   	pop    %ebp
+  804fb8:	c3                   	ret
+		if (from_env_store) {
+  804fb9:	85 ff                	test   %edi,%edi
+  804fbb:	74 06                	je     804fc3 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  804fbd:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804fc3:	85 f6                	test   %esi,%esi
+  804fc5:	74 06                	je     804fcd <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804fc7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804fcd:	85 db                	test   %ebx,%ebx
+  804fcf:	74 e0                	je     804fb1 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  804fd1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804fd7:	eb d8                	jmp    804fb1 <ipc_recv_pages+0x62>
+
+00804fd9 <ipc_recv>:
+{
+  804fd9:	55                   	push   %ebp
+  804fda:	89 e5                	mov    %esp,%ebp
+  804fdc:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  804fdf:	6a 00                	push   $0x0
+  804fe1:	ff 75 10             	push   0x10(%ebp)
+  804fe4:	6a 01                	push   $0x1
+  804fe6:	ff 75 0c             	push   0xc(%ebp)
+  804fe9:	ff 75 08             	push   0x8(%ebp)
+  804fec:	e8 5e ff ff ff       	call   804f4f <ipc_recv_pages>
+}
+  804ff1:	c9                   	leave
+  804ff2:	c3                   	ret
+
+00804ff3 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804ff3:	55                   	push   %ebp
+  804ff4:	89 e5                	mov    %esp,%ebp
+  804ff6:	56                   	push   %esi
+  804ff7:	53                   	push   %ebx
+  804ff8:	8b 75 08             	mov    0x8(%ebp),%esi
+  804ffb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  804ffe:	83 ec 0c             	sub    $0xc,%esp
+  805001:	ff 75 0c             	push   0xc(%ebp)
+  805004:	e8 9d c3 ff ff       	call   8013a6 <sys_ipc_try_recv>
+  805009:	83 c4 10             	add    $0x10,%esp
+  80500c:	85 c0                	test   %eax,%eax
+  80500e:	78 34                	js     805044 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  805010:	85 f6                	test   %esi,%esi
+  805012:	74 0d                	je     805021 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  805014:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805019:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80501f:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  805021:	85 db                	test   %ebx,%ebx
+  805023:	74 0d                	je     805032 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  805025:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80502a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  805030:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  805032:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805037:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80503d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805040:	5b                   	pop    %ebx
+  805041:	5e                   	pop    %esi
+  805042:	5d                   	pop    %ebp
+  805043:	c3                   	ret
+		if (from_env_store) {
+  805044:	85 f6                	test   %esi,%esi
+  805046:	74 06                	je     80504e <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  805048:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  80504e:	85 db                	test   %ebx,%ebx
+  805050:	74 eb                	je     80503d <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  805052:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  805058:	eb e3                	jmp    80503d <ipc_try_recv+0x4a>
+
+0080505a <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80505a:	55                   	push   %ebp
+  80505b:	89 e5                	mov    %esp,%ebp
+  80505d:	83 ec 14             	sub    $0x14,%esp
+  805060:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805063:	85 c0                	test   %eax,%eax
+  805065:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80506a:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80506d:	ff 75 18             	push   0x18(%ebp)
+  805070:	ff 75 14             	push   0x14(%ebp)
+  805073:	50                   	push   %eax
+  805074:	ff 75 0c             	push   0xc(%ebp)
+  805077:	ff 75 08             	push   0x8(%ebp)
+  80507a:	e8 b6 c1 ff ff       	call   801235 <sys_ipc_send_pages>
+  80507f:	83 c4 20             	add    $0x20,%esp
+  805082:	85 c0                	test   %eax,%eax
+  805084:	78 02                	js     805088 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  805086:	c9                   	leave
+  805087:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  805088:	50                   	push   %eax
+  805089:	68 10 60 80 00       	push   $0x806010
+  80508e:	68 80 00 00 00       	push   $0x80
+  805093:	68 3c 60 80 00       	push   $0x80603c
+  805098:	e8 fd b1 ff ff       	call   80029a <_panic>
+
+0080509d <ipc_send>:
+{
+  80509d:	55                   	push   %ebp
+  80509e:	89 e5                	mov    %esp,%ebp
+  8050a0:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  8050a3:	ff 75 14             	push   0x14(%ebp)
+  8050a6:	6a 01                	push   $0x1
+  8050a8:	ff 75 10             	push   0x10(%ebp)
+  8050ab:	ff 75 0c             	push   0xc(%ebp)
+  8050ae:	ff 75 08             	push   0x8(%ebp)
+  8050b1:	e8 a4 ff ff ff       	call   80505a <ipc_send_pages>
+}
+  8050b6:	83 c4 20             	add    $0x20,%esp
+  8050b9:	c9                   	leave
+  8050ba:	c3                   	ret
+
+008050bb <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8050bb:	55                   	push   %ebp
+  8050bc:	89 e5                	mov    %esp,%ebp
+  8050be:	83 ec 14             	sub    $0x14,%esp
+  8050c1:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8050c4:	85 c0                	test   %eax,%eax
+  8050c6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8050cb:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8050ce:	ff 75 18             	push   0x18(%ebp)
+  8050d1:	ff 75 14             	push   0x14(%ebp)
+  8050d4:	50                   	push   %eax
+  8050d5:	ff 75 0c             	push   0xc(%ebp)
+  8050d8:	ff 75 08             	push   0x8(%ebp)
+  8050db:	e8 e6 c1 ff ff       	call   8012c6 <sys_ipc_call>
+  8050e0:	83 c4 20             	add    $0x20,%esp
+  8050e3:	85 c0                	test   %eax,%eax
+  8050e5:	78 0b                	js     8050f2 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  8050e7:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050ec:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8050f2:	c9                   	leave
+  8050f3:	c3                   	ret
+
+008050f4 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  8050f4:	55                   	push   %ebp
+  8050f5:	89 e5                	mov    %esp,%ebp
+  8050f7:	57                   	push   %edi
+  8050f8:	56                   	push   %esi
+  8050f9:	53                   	push   %ebx
+  8050fa:	83 ec 18             	sub    $0x18,%esp
+  8050fd:	8b 45 10             	mov    0x10(%ebp),%eax
+  805100:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  805103:	8b 75 20             	mov    0x20(%ebp),%esi
+  805106:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805109:	85 c0                	test   %eax,%eax
+  80510b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805110:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  805113:	ff 75 18             	push   0x18(%ebp)
+  805116:	ff 75 14             	push   0x14(%ebp)
+  805119:	50                   	push   %eax
+  80511a:	ff 75 0c             	push   0xc(%ebp)
+  80511d:	ff 75 08             	push   0x8(%ebp)
+  805120:	e8 e2 c1 ff ff       	call   801307 <sys_ipc_reply_recv>
+  805125:	83 c4 20             	add    $0x20,%esp
+  805128:	85 c0                	test   %eax,%eax
+  80512a:	78 46                	js     805172 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80512c:	85 ff                	test   %edi,%edi
+  80512e:	74 0d                	je     80513d <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  805130:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805135:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80513b:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80513d:	85 f6                	test   %esi,%esi
+  80513f:	74 0d                	je     80514e <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  805141:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805146:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80514c:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80514e:	85 db                	test   %ebx,%ebx
+  805150:	74 0d                	je     80515f <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  805152:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805157:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80515d:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80515f:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805164:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80516a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80516d:	5b                   	pop    %ebx
+  80516e:	5e                   	pop    %esi
+  80516f:	5f                   	pop    %edi
+  805170:	5d                   	pop    %ebp
+  805171:	c3                   	ret
+		if (from_env_store) {
+  805172:	85 ff                	test   %edi,%edi
+  805174:	74 06                	je     80517c <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  805176:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80517c:	85 f6                	test   %esi,%esi
+  80517e:	74 06                	je     805186 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  805180:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  805186:	85 db                	test   %ebx,%ebx
+  805188:	74 e0                	je     80516a <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  80518a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  805190:	eb d8                	jmp    80516a <ipc_reply_recv+0x76>
+
+00805192 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805192:	55                   	push   %ebp
+  805193:	89 e5                	mov    %esp,%ebp
+  805195:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  805198:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80519d:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8051a0:	c1 e0 06             	shl    $0x6,%eax
+  8051a3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8051a8:	8b 40 50             	mov    0x50(%eax),%eax
+  8051ab:	39 c8                	cmp    %ecx,%eax
+  8051ad:	74 12                	je     8051c1 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8051af:	83 c2 01             	add    $0x1,%edx
+  8051b2:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8051b8:	75 e3                	jne    80519d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8051ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051bf:	eb 0e                	jmp    8051cf <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8051c1:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8051c4:	c1 e0 06             	shl    $0x6,%eax
+  8051c7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8051cc:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8051cf:	5d                   	pop    %ebp
+  8051d0:	c3                   	ret
+
+008051d1 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8051d1:	55                   	push   %ebp
+  8051d2:	89 e5                	mov    %esp,%ebp
+  8051d4:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8051d7:	89 c2                	mov    %eax,%edx
+  8051d9:	c1 ea 16             	shr    $0x16,%edx
+  8051dc:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8051e3:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8051e8:	f6 c1 01             	test   $0x1,%cl
+  8051eb:	74 1e                	je     80520b <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  8051ed:	c1 e8 0c             	shr    $0xc,%eax
+  8051f0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8051f7:	a8 01                	test   $0x1,%al
+  8051f9:	74 10                	je     80520b <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8051fb:	c1 e8 0c             	shr    $0xc,%eax
+  8051fe:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  805201:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  805208:	0f b7 d2             	movzwl %dx,%edx
+}
+  80520b:	89 d0                	mov    %edx,%eax
+  80520d:	5d                   	pop    %ebp
+  80520e:	c3                   	ret
+
+0080520f <udivmod>:
+  80520f:	55                   	push   %ebp
+  805210:	57                   	push   %edi
+  805211:	56                   	push   %esi
+  805212:	53                   	push   %ebx
+  805213:	83 ec 24             	sub    $0x24,%esp
+  805216:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80521a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80521e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  805222:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  805226:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80522a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80522e:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  805232:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  805237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80523c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805241:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  805248:	00 
+  805249:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  805250:	00 
+  805251:	89 fb                	mov    %edi,%ebx
+  805253:	eb 08                	jmp    80525d <udivmod+0x4e>
+  805255:	83 e9 01             	sub    $0x1,%ecx
+  805258:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80525b:	74 68                	je     8052c5 <udivmod+0xb6>
+  80525d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  805261:	01 c0                	add    %eax,%eax
+  805263:	89 c6                	mov    %eax,%esi
+  805265:	89 d7                	mov    %edx,%edi
+  805267:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80526b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80526f:	0f ad d0             	shrd   %cl,%edx,%eax
+  805272:	d3 ea                	shr    %cl,%edx
+  805274:	f6 c1 20             	test   $0x20,%cl
+  805277:	74 04                	je     80527d <udivmod+0x6e>
+  805279:	89 d0                	mov    %edx,%eax
+  80527b:	31 d2                	xor    %edx,%edx
+  80527d:	83 e0 01             	and    $0x1,%eax
+  805280:	89 04 24             	mov    %eax,(%esp)
+  805283:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80528a:	00 
+  80528b:	8b 04 24             	mov    (%esp),%eax
+  80528e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  805292:	09 f0                	or     %esi,%eax
+  805294:	09 fa                	or     %edi,%edx
+  805296:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80529a:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80529e:	39 f0                	cmp    %esi,%eax
+  8052a0:	89 d5                	mov    %edx,%ebp
+  8052a2:	19 fd                	sbb    %edi,%ebp
+  8052a4:	72 af                	jb     805255 <udivmod+0x46>
+  8052a6:	29 f0                	sub    %esi,%eax
+  8052a8:	19 fa                	sbb    %edi,%edx
+  8052aa:	89 cf                	mov    %ecx,%edi
+  8052ac:	c1 ef 05             	shr    $0x5,%edi
+  8052af:	83 e7 01             	and    $0x1,%edi
+  8052b2:	89 fe                	mov    %edi,%esi
+  8052b4:	83 f6 01             	xor    $0x1,%esi
+  8052b7:	d3 e6                	shl    %cl,%esi
+  8052b9:	d3 e7                	shl    %cl,%edi
+  8052bb:	09 74 24 18          	or     %esi,0x18(%esp)
+  8052bf:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8052c3:	eb 90                	jmp    805255 <udivmod+0x46>
+  8052c5:	85 db                	test   %ebx,%ebx
+  8052c7:	74 05                	je     8052ce <udivmod+0xbf>
+  8052c9:	89 03                	mov    %eax,(%ebx)
+  8052cb:	89 53 04             	mov    %edx,0x4(%ebx)
+  8052ce:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8052d2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8052d6:	83 c4 24             	add    $0x24,%esp
+  8052d9:	5b                   	pop    %ebx
+  8052da:	5e                   	pop    %esi
+  8052db:	5f                   	pop    %edi
+  8052dc:	5d                   	pop    %ebp
+  8052dd:	c3                   	ret
+
+008052de <__udivdi3>:
+  8052de:	83 ec 08             	sub    $0x8,%esp
+  8052e1:	6a 00                	push   $0x0
+  8052e3:	ff 74 24 1c          	push   0x1c(%esp)
+  8052e7:	ff 74 24 1c          	push   0x1c(%esp)
+  8052eb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8052ef:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8052f3:	e8 17 ff ff ff       	call   80520f <udivmod>
+  8052f8:	83 c4 14             	add    $0x14,%esp
+  8052fb:	c3                   	ret
+
+008052fc <__umoddi3>:
+  8052fc:	83 ec 18             	sub    $0x18,%esp
+  8052ff:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805303:	50                   	push   %eax
+  805304:	ff 74 24 2c          	push   0x2c(%esp)
+  805308:	ff 74 24 2c          	push   0x2c(%esp)
+  80530c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  805310:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  805314:	e8 f6 fe ff ff       	call   80520f <udivmod>
+  805319:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80531d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805321:	83 c4 24             	add    $0x24,%esp
+  805324:	c3                   	ret
+
+00805325 <__divdi3>:
+  805325:	55                   	push   %ebp
+  805326:	57                   	push   %edi
+  805327:	56                   	push   %esi
+  805328:	53                   	push   %ebx
+  805329:	83 ec 10             	sub    $0x10,%esp
+  80532c:	8b 44 24 24          	mov    0x24(%esp),%eax
+  805330:	8b 54 24 28          	mov    0x28(%esp),%edx
+  805334:	89 c6                	mov    %eax,%esi
+  805336:	89 d7                	mov    %edx,%edi
+  805338:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  80533c:	33 7c 24 30          	xor    0x30(%esp),%edi
+  805340:	89 74 24 04          	mov    %esi,0x4(%esp)
+  805344:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  805348:	89 c5                	mov    %eax,%ebp
+  80534a:	f7 dd                	neg    %ebp
+  80534c:	89 d6                	mov    %edx,%esi
+  80534e:	83 d6 00             	adc    $0x0,%esi
+  805351:	f7 de                	neg    %esi
+  805353:	0f 48 e8             	cmovs  %eax,%ebp
+  805356:	0f 49 d6             	cmovns %esi,%edx
+  805359:	6a 00                	push   $0x0
+  80535b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80535f:	f7 de                	neg    %esi
+  805361:	8b 44 24 34          	mov    0x34(%esp),%eax
+  805365:	83 d0 00             	adc    $0x0,%eax
+  805368:	f7 d8                	neg    %eax
+  80536a:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  80536f:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  805374:	50                   	push   %eax
+  805375:	56                   	push   %esi
+  805376:	89 e8                	mov    %ebp,%eax
+  805378:	e8 92 fe ff ff       	call   80520f <udivmod>
+  80537d:	83 c4 10             	add    $0x10,%esp
+  805380:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  805385:	78 08                	js     80538f <__divdi3+0x6a>
+  805387:	83 c4 0c             	add    $0xc,%esp
+  80538a:	5b                   	pop    %ebx
+  80538b:	5e                   	pop    %esi
+  80538c:	5f                   	pop    %edi
+  80538d:	5d                   	pop    %ebp
+  80538e:	c3                   	ret
+  80538f:	f7 d8                	neg    %eax
+  805391:	83 d2 00             	adc    $0x0,%edx
+  805394:	f7 da                	neg    %edx
+  805396:	eb ef                	jmp    805387 <__divdi3+0x62>
+
+00805398 <__moddi3>:
+  805398:	55                   	push   %ebp
+  805399:	57                   	push   %edi
+  80539a:	56                   	push   %esi
+  80539b:	53                   	push   %ebx
+  80539c:	83 ec 18             	sub    $0x18,%esp
+  80539f:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8053a3:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8053a7:	89 f1                	mov    %esi,%ecx
+  8053a9:	f7 d9                	neg    %ecx
+  8053ab:	89 da                	mov    %ebx,%edx
+  8053ad:	83 d2 00             	adc    $0x0,%edx
+  8053b0:	f7 da                	neg    %edx
+  8053b2:	0f 48 ce             	cmovs  %esi,%ecx
+  8053b5:	0f 48 d3             	cmovs  %ebx,%edx
+  8053b8:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8053bc:	50                   	push   %eax
+  8053bd:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8053c1:	f7 de                	neg    %esi
+  8053c3:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8053c7:	83 d0 00             	adc    $0x0,%eax
+  8053ca:	f7 d8                	neg    %eax
+  8053cc:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8053d1:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8053d6:	50                   	push   %eax
+  8053d7:	56                   	push   %esi
+  8053d8:	89 c8                	mov    %ecx,%eax
+  8053da:	e8 30 fe ff ff       	call   80520f <udivmod>
+  8053df:	83 c4 10             	add    $0x10,%esp
+  8053e2:	85 db                	test   %ebx,%ebx
+  8053e4:	78 10                	js     8053f6 <__moddi3+0x5e>
+  8053e6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8053ea:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8053ee:	83 c4 14             	add    $0x14,%esp
+  8053f1:	5b                   	pop    %ebx
+  8053f2:	5e                   	pop    %esi
+  8053f3:	5f                   	pop    %edi
+  8053f4:	5d                   	pop    %ebp
+  8053f5:	c3                   	ret
+  8053f6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8053fa:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8053fe:	f7 d8                	neg    %eax
+  805400:	83 d2 00             	adc    $0x0,%edx
+  805403:	f7 da                	neg    %edx
+  805405:	eb e7                	jmp    8053ee <__moddi3+0x56>
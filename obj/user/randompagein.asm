@@ -0,0 +1,9944 @@
+
+obj/user/randompagein.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 e3 00 00 00       	call   800114 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <get_random>:
+uint32_t m_w = 1234;    /* must not be zero */
+uint32_t m_z = 5678;    /* must not be zero */
+ 
+uint32_t get_random()
+{
+	m_z = 36969 * (m_z & 65535) + (m_z >> 16);
+  800033:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  800039:	0f b7 c2             	movzwl %dx,%eax
+  80003c:	69 c0 69 90 00 00    	imul   $0x9069,%eax,%eax
+  800042:	c1 ea 10             	shr    $0x10,%edx
+  800045:	01 d0                	add    %edx,%eax
+  800047:	a3 00 60 80 00       	mov    %eax,0x806000
+	m_w = 18000 * (m_w & 65535) + (m_w >> 16);
+  80004c:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  800052:	0f b7 d1             	movzwl %cx,%edx
+  800055:	69 d2 50 46 00 00    	imul   $0x4650,%edx,%edx
+  80005b:	c1 e9 10             	shr    $0x10,%ecx
+  80005e:	01 ca                	add    %ecx,%edx
+  800060:	89 15 04 60 80 00    	mov    %edx,0x806004
+	return (m_z << 16) + m_w;  /* 32-bit result */
+  800066:	c1 e0 10             	shl    $0x10,%eax
+  800069:	01 d0                	add    %edx,%eax
+}
+  80006b:	c3                   	ret
+
+0080006c <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80006c:	55                   	push   %ebp
+  80006d:	89 e5                	mov    %esp,%ebp
+  80006f:	53                   	push   %ebx
+  800070:	83 ec 04             	sub    $0x4,%esp
+	int r;
+	uintptr_t va;
+
+	for(va = BASE; va < BASE+SIZE; va+=PGSIZE){
+  800073:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+		//cprintf("+%x\n", va);
+		if((r = page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W, 1)) < 0)
+  800078:	6a 01                	push   $0x1
+  80007a:	6a 07                	push   $0x7
+  80007c:	53                   	push   %ebx
+  80007d:	6a 00                	push   $0x0
+  80007f:	e8 aa 34 00 00       	call   80352e <page_alloc>
+  800084:	83 c4 10             	add    $0x10,%esp
+  800087:	85 c0                	test   %eax,%eax
+  800089:	78 48                	js     8000d3 <umain+0x67>
+			panic("sys_page_alloc on %p: %e", va, r);
+
+		// Store the address in the page
+		*(uintptr_t*)va = (uintptr_t)va;
+  80008b:	89 1b                	mov    %ebx,(%ebx)
+	for(va = BASE; va < BASE+SIZE; va+=PGSIZE){
+  80008d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800093:	81 fb 00 00 00 18    	cmp    $0x18000000,%ebx
+  800099:	75 dd                	jne    800078 <umain+0xc>
+  80009b:	bb 11 27 00 00       	mov    $0x2711,%ebx
+	}
+
+	int i;
+	for(i = 0; i < 10000; i++)
+  8000a0:	83 eb 01             	sub    $0x1,%ebx
+  8000a3:	74 44                	je     8000e9 <umain+0x7d>
+	{
+		va = BASE + (get_random() % SIZE);
+  8000a5:	e8 89 ff ff ff       	call   800033 <get_random>
+  8000aa:	25 ff ff ff 07       	and    $0x7ffffff,%eax
+  8000af:	05 00 00 00 10       	add    $0x10000000,%eax
+		va = ROUNDDOWN(va, PGSIZE);
+  8000b4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		//cprintf("-%x\n", va);
+		assert(va == *(uintptr_t*)va);
+  8000b9:	39 00                	cmp    %eax,(%eax)
+  8000bb:	74 e3                	je     8000a0 <umain+0x34>
+  8000bd:	68 66 4d 80 00       	push   $0x804d66
+  8000c2:	68 7c 4d 80 00       	push   $0x804d7c
+  8000c7:	6a 2b                	push   $0x2b
+  8000c9:	68 ac 4d 80 00       	push   $0x804dac
+  8000ce:	e8 a4 00 00 00       	call   800177 <_panic>
+			panic("sys_page_alloc on %p: %e", va, r);
+  8000d3:	83 ec 0c             	sub    $0xc,%esp
+  8000d6:	50                   	push   %eax
+  8000d7:	53                   	push   %ebx
+  8000d8:	68 4d 4d 80 00       	push   $0x804d4d
+  8000dd:	6a 1f                	push   $0x1f
+  8000df:	68 ac 4d 80 00       	push   $0x804dac
+  8000e4:	e8 8e 00 00 00       	call   800177 <_panic>
+	}
+		     
+
+	cprintf("%s: Passed all checks!\n", argc > 0 ? argv[0] : "randompagein");
+  8000e9:	b8 40 4d 80 00       	mov    $0x804d40,%eax
+  8000ee:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8000f2:	7e 05                	jle    8000f9 <umain+0x8d>
+  8000f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8000f7:	8b 00                	mov    (%eax),%eax
+  8000f9:	83 ec 08             	sub    $0x8,%esp
+  8000fc:	50                   	push   %eax
+  8000fd:	68 91 4d 80 00       	push   $0x804d91
+  800102:	e8 4b 01 00 00       	call   800252 <cprintf>
+	get_and_print_paging_stats();
+  800107:	e8 5c 30 00 00       	call   803168 <get_and_print_paging_stats>
+}
+  80010c:	83 c4 10             	add    $0x10,%esp
+  80010f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800112:	c9                   	leave
+  800113:	c3                   	ret
+
+00800114 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800114:	55                   	push   %ebp
+  800115:	89 e5                	mov    %esp,%ebp
+  800117:	56                   	push   %esi
+  800118:	53                   	push   %ebx
+  800119:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80011c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  80011f:	e8 ca 0b 00 00       	call   800cee <sys_getenvid>
+  800124:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800129:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80012c:	c1 e0 06             	shl    $0x6,%eax
+  80012f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800134:	a3 18 e9 80 00       	mov    %eax,0x80e918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800139:	85 db                	test   %ebx,%ebx
+  80013b:	7e 07                	jle    800144 <libmain+0x30>
+		binaryname = argv[0];
+  80013d:	8b 06                	mov    (%esi),%eax
+  80013f:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	// call user main routine
+	umain(argc, argv);
+  800144:	83 ec 08             	sub    $0x8,%esp
+  800147:	56                   	push   %esi
+  800148:	53                   	push   %ebx
+  800149:	e8 1e ff ff ff       	call   80006c <umain>
+
+	// exit gracefully
+	exit();
+  80014e:	e8 0a 00 00 00       	call   80015d <exit>
+}
+  800153:	83 c4 10             	add    $0x10,%esp
+  800156:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800159:	5b                   	pop    %ebx
+  80015a:	5e                   	pop    %esi
+  80015b:	5d                   	pop    %ebp
+  80015c:	c3                   	ret
+
+0080015d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80015d:	55                   	push   %ebp
+  80015e:	89 e5                	mov    %esp,%ebp
+  800160:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800163:	e8 2a 13 00 00       	call   801492 <close_all>
+	sys_env_destroy(0);
+  800168:	83 ec 0c             	sub    $0xc,%esp
+  80016b:	6a 00                	push   $0x0
+  80016d:	e8 3b 0b 00 00       	call   800cad <sys_env_destroy>
+}
+  800172:	83 c4 10             	add    $0x10,%esp
+  800175:	c9                   	leave
+  800176:	c3                   	ret
+
+00800177 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800177:	55                   	push   %ebp
+  800178:	89 e5                	mov    %esp,%ebp
+  80017a:	56                   	push   %esi
+  80017b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80017c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80017f:	8b 35 08 60 80 00    	mov    0x806008,%esi
+  800185:	e8 64 0b 00 00       	call   800cee <sys_getenvid>
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  80018d:	ff 75 0c             	push   0xc(%ebp)
+  800190:	ff 75 08             	push   0x8(%ebp)
+  800193:	56                   	push   %esi
+  800194:	50                   	push   %eax
+  800195:	68 d8 4d 80 00       	push   $0x804dd8
+  80019a:	e8 b3 00 00 00       	call   800252 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80019f:	83 c4 18             	add    $0x18,%esp
+  8001a2:	53                   	push   %ebx
+  8001a3:	ff 75 10             	push   0x10(%ebp)
+  8001a6:	e8 56 00 00 00       	call   800201 <vcprintf>
+	cprintf("\n");
+  8001ab:	c7 04 24 a7 4d 80 00 	movl   $0x804da7,(%esp)
+  8001b2:	e8 9b 00 00 00       	call   800252 <cprintf>
+  8001b7:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001ba:	cc                   	int3
+	while (1)
+  8001bb:	eb fd                	jmp    8001ba <_panic+0x43>
+
+008001bd <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001bd:	55                   	push   %ebp
+  8001be:	89 e5                	mov    %esp,%ebp
+  8001c0:	53                   	push   %ebx
+  8001c1:	83 ec 04             	sub    $0x4,%esp
+  8001c4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001c7:	8b 13                	mov    (%ebx),%edx
+  8001c9:	8d 42 01             	lea    0x1(%edx),%eax
+  8001cc:	89 03                	mov    %eax,(%ebx)
+  8001ce:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001d1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001d5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001da:	74 09                	je     8001e5 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001dc:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001e3:	c9                   	leave
+  8001e4:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001e5:	83 ec 08             	sub    $0x8,%esp
+  8001e8:	68 ff 00 00 00       	push   $0xff
+  8001ed:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001f0:	50                   	push   %eax
+  8001f1:	e8 69 0a 00 00       	call   800c5f <sys_cputs>
+		b->idx = 0;
+  8001f6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001fc:	83 c4 10             	add    $0x10,%esp
+  8001ff:	eb db                	jmp    8001dc <putch+0x1f>
+
+00800201 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800201:	55                   	push   %ebp
+  800202:	89 e5                	mov    %esp,%ebp
+  800204:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80020a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800211:	00 00 00 
+	b.cnt = 0;
+  800214:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80021b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80021e:	ff 75 0c             	push   0xc(%ebp)
+  800221:	ff 75 08             	push   0x8(%ebp)
+  800224:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80022a:	50                   	push   %eax
+  80022b:	68 bd 01 80 00       	push   $0x8001bd
+  800230:	e8 14 01 00 00       	call   800349 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800235:	83 c4 08             	add    $0x8,%esp
+  800238:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80023e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800244:	50                   	push   %eax
+  800245:	e8 15 0a 00 00       	call   800c5f <sys_cputs>
+
+	return b.cnt;
+}
+  80024a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800250:	c9                   	leave
+  800251:	c3                   	ret
+
+00800252 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800252:	55                   	push   %ebp
+  800253:	89 e5                	mov    %esp,%ebp
+  800255:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800258:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80025b:	50                   	push   %eax
+  80025c:	ff 75 08             	push   0x8(%ebp)
+  80025f:	e8 9d ff ff ff       	call   800201 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800264:	c9                   	leave
+  800265:	c3                   	ret
+
+00800266 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800266:	55                   	push   %ebp
+  800267:	89 e5                	mov    %esp,%ebp
+  800269:	57                   	push   %edi
+  80026a:	56                   	push   %esi
+  80026b:	53                   	push   %ebx
+  80026c:	83 ec 1c             	sub    $0x1c,%esp
+  80026f:	89 c7                	mov    %eax,%edi
+  800271:	89 d6                	mov    %edx,%esi
+  800273:	8b 45 08             	mov    0x8(%ebp),%eax
+  800276:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800279:	89 d1                	mov    %edx,%ecx
+  80027b:	89 c2                	mov    %eax,%edx
+  80027d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800280:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800283:	8b 45 10             	mov    0x10(%ebp),%eax
+  800286:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800289:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80028c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800293:	39 c2                	cmp    %eax,%edx
+  800295:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800298:	72 3e                	jb     8002d8 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80029a:	83 ec 0c             	sub    $0xc,%esp
+  80029d:	ff 75 18             	push   0x18(%ebp)
+  8002a0:	83 eb 01             	sub    $0x1,%ebx
+  8002a3:	53                   	push   %ebx
+  8002a4:	50                   	push   %eax
+  8002a5:	83 ec 08             	sub    $0x8,%esp
+  8002a8:	ff 75 e4             	push   -0x1c(%ebp)
+  8002ab:	ff 75 e0             	push   -0x20(%ebp)
+  8002ae:	ff 75 dc             	push   -0x24(%ebp)
+  8002b1:	ff 75 d8             	push   -0x28(%ebp)
+  8002b4:	e8 4e 49 00 00       	call   804c07 <__udivdi3>
+  8002b9:	83 c4 18             	add    $0x18,%esp
+  8002bc:	52                   	push   %edx
+  8002bd:	50                   	push   %eax
+  8002be:	89 f2                	mov    %esi,%edx
+  8002c0:	89 f8                	mov    %edi,%eax
+  8002c2:	e8 9f ff ff ff       	call   800266 <printnum>
+  8002c7:	83 c4 20             	add    $0x20,%esp
+  8002ca:	eb 13                	jmp    8002df <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002cc:	83 ec 08             	sub    $0x8,%esp
+  8002cf:	56                   	push   %esi
+  8002d0:	ff 75 18             	push   0x18(%ebp)
+  8002d3:	ff d7                	call   *%edi
+  8002d5:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002d8:	83 eb 01             	sub    $0x1,%ebx
+  8002db:	85 db                	test   %ebx,%ebx
+  8002dd:	7f ed                	jg     8002cc <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002df:	83 ec 08             	sub    $0x8,%esp
+  8002e2:	56                   	push   %esi
+  8002e3:	83 ec 04             	sub    $0x4,%esp
+  8002e6:	ff 75 e4             	push   -0x1c(%ebp)
+  8002e9:	ff 75 e0             	push   -0x20(%ebp)
+  8002ec:	ff 75 dc             	push   -0x24(%ebp)
+  8002ef:	ff 75 d8             	push   -0x28(%ebp)
+  8002f2:	e8 2e 49 00 00       	call   804c25 <__umoddi3>
+  8002f7:	83 c4 14             	add    $0x14,%esp
+  8002fa:	0f be 80 fb 4d 80 00 	movsbl 0x804dfb(%eax),%eax
+  800301:	50                   	push   %eax
+  800302:	ff d7                	call   *%edi
+}
+  800304:	83 c4 10             	add    $0x10,%esp
+  800307:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030a:	5b                   	pop    %ebx
+  80030b:	5e                   	pop    %esi
+  80030c:	5f                   	pop    %edi
+  80030d:	5d                   	pop    %ebp
+  80030e:	c3                   	ret
+
+0080030f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80030f:	55                   	push   %ebp
+  800310:	89 e5                	mov    %esp,%ebp
+  800312:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800315:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800319:	8b 10                	mov    (%eax),%edx
+  80031b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80031e:	73 0a                	jae    80032a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800320:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800323:	89 08                	mov    %ecx,(%eax)
+  800325:	8b 45 08             	mov    0x8(%ebp),%eax
+  800328:	88 02                	mov    %al,(%edx)
+}
+  80032a:	5d                   	pop    %ebp
+  80032b:	c3                   	ret
+
+0080032c <printfmt>:
+{
+  80032c:	55                   	push   %ebp
+  80032d:	89 e5                	mov    %esp,%ebp
+  80032f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800332:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800335:	50                   	push   %eax
+  800336:	ff 75 10             	push   0x10(%ebp)
+  800339:	ff 75 0c             	push   0xc(%ebp)
+  80033c:	ff 75 08             	push   0x8(%ebp)
+  80033f:	e8 05 00 00 00       	call   800349 <vprintfmt>
+}
+  800344:	83 c4 10             	add    $0x10,%esp
+  800347:	c9                   	leave
+  800348:	c3                   	ret
+
+00800349 <vprintfmt>:
+{
+  800349:	55                   	push   %ebp
+  80034a:	89 e5                	mov    %esp,%ebp
+  80034c:	57                   	push   %edi
+  80034d:	56                   	push   %esi
+  80034e:	53                   	push   %ebx
+  80034f:	83 ec 2c             	sub    $0x2c,%esp
+  800352:	8b 75 08             	mov    0x8(%ebp),%esi
+  800355:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800358:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80035b:	eb 0a                	jmp    800367 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80035d:	83 ec 08             	sub    $0x8,%esp
+  800360:	53                   	push   %ebx
+  800361:	50                   	push   %eax
+  800362:	ff d6                	call   *%esi
+  800364:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800367:	83 c7 01             	add    $0x1,%edi
+  80036a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80036e:	83 f8 25             	cmp    $0x25,%eax
+  800371:	74 0c                	je     80037f <vprintfmt+0x36>
+			if (ch == '\0')
+  800373:	85 c0                	test   %eax,%eax
+  800375:	75 e6                	jne    80035d <vprintfmt+0x14>
+}
+  800377:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80037a:	5b                   	pop    %ebx
+  80037b:	5e                   	pop    %esi
+  80037c:	5f                   	pop    %edi
+  80037d:	5d                   	pop    %ebp
+  80037e:	c3                   	ret
+		padc = ' ';
+  80037f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800383:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80038a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800391:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800398:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80039d:	8d 47 01             	lea    0x1(%edi),%eax
+  8003a0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003a3:	0f b6 17             	movzbl (%edi),%edx
+  8003a6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003a9:	3c 55                	cmp    $0x55,%al
+  8003ab:	0f 87 c5 03 00 00    	ja     800776 <vprintfmt+0x42d>
+  8003b1:	0f b6 c0             	movzbl %al,%eax
+  8003b4:	ff 24 85 80 4f 80 00 	jmp    *0x804f80(,%eax,4)
+  8003bb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003be:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003c2:	eb d9                	jmp    80039d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003c4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003c7:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003cb:	eb d0                	jmp    80039d <vprintfmt+0x54>
+  8003cd:	0f b6 d2             	movzbl %dl,%edx
+  8003d0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003db:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003de:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003e2:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003e5:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003e8:	83 f9 09             	cmp    $0x9,%ecx
+  8003eb:	77 55                	ja     800442 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003ed:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003f0:	eb e9                	jmp    8003db <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f5:	8b 00                	mov    (%eax),%eax
+  8003f7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fd:	8d 40 04             	lea    0x4(%eax),%eax
+  800400:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800403:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800406:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80040a:	79 91                	jns    80039d <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80040c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80040f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800412:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800419:	eb 82                	jmp    80039d <vprintfmt+0x54>
+			if (width < 0)
+  80041b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80041e:	85 d2                	test   %edx,%edx
+  800420:	b8 00 00 00 00       	mov    $0x0,%eax
+  800425:	0f 49 c2             	cmovns %edx,%eax
+  800428:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80042b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80042e:	e9 6a ff ff ff       	jmp    80039d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800433:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800436:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80043d:	e9 5b ff ff ff       	jmp    80039d <vprintfmt+0x54>
+  800442:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800445:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800448:	eb bc                	jmp    800406 <vprintfmt+0xbd>
+			lflag++;
+  80044a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80044d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800450:	e9 48 ff ff ff       	jmp    80039d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800455:	8b 45 14             	mov    0x14(%ebp),%eax
+  800458:	8d 78 04             	lea    0x4(%eax),%edi
+  80045b:	83 ec 08             	sub    $0x8,%esp
+  80045e:	53                   	push   %ebx
+  80045f:	ff 30                	push   (%eax)
+  800461:	ff d6                	call   *%esi
+			break;
+  800463:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800466:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800469:	e9 63 02 00 00       	jmp    8006d1 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  80046e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800471:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800474:	8b 10                	mov    (%eax),%edx
+  800476:	89 d0                	mov    %edx,%eax
+  800478:	f7 d8                	neg    %eax
+  80047a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80047d:	83 f8 12             	cmp    $0x12,%eax
+  800480:	7f 23                	jg     8004a5 <vprintfmt+0x15c>
+  800482:	8b 14 85 e0 50 80 00 	mov    0x8050e0(,%eax,4),%edx
+  800489:	85 d2                	test   %edx,%edx
+  80048b:	74 18                	je     8004a5 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80048d:	52                   	push   %edx
+  80048e:	68 8e 4d 80 00       	push   $0x804d8e
+  800493:	53                   	push   %ebx
+  800494:	56                   	push   %esi
+  800495:	e8 92 fe ff ff       	call   80032c <printfmt>
+  80049a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80049d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004a0:	e9 2c 02 00 00       	jmp    8006d1 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  8004a5:	50                   	push   %eax
+  8004a6:	68 13 4e 80 00       	push   $0x804e13
+  8004ab:	53                   	push   %ebx
+  8004ac:	56                   	push   %esi
+  8004ad:	e8 7a fe ff ff       	call   80032c <printfmt>
+  8004b2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004b5:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004b8:	e9 14 02 00 00       	jmp    8006d1 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c0:	83 c0 04             	add    $0x4,%eax
+  8004c3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c9:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004cb:	85 c9                	test   %ecx,%ecx
+  8004cd:	b8 0c 4e 80 00       	mov    $0x804e0c,%eax
+  8004d2:	0f 45 c1             	cmovne %ecx,%eax
+  8004d5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004d8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004dc:	7e 06                	jle    8004e4 <vprintfmt+0x19b>
+  8004de:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004e2:	75 0b                	jne    8004ef <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004e4:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004e7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004ea:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004ed:	eb 5c                	jmp    80054b <vprintfmt+0x202>
+  8004ef:	83 ec 08             	sub    $0x8,%esp
+  8004f2:	ff 75 d0             	push   -0x30(%ebp)
+  8004f5:	ff 75 cc             	push   -0x34(%ebp)
+  8004f8:	e8 19 03 00 00       	call   800816 <strnlen>
+  8004fd:	89 c2                	mov    %eax,%edx
+  8004ff:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800502:	29 d0                	sub    %edx,%eax
+  800504:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800507:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80050b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80050e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800511:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800513:	eb 0e                	jmp    800523 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800515:	83 ec 08             	sub    $0x8,%esp
+  800518:	53                   	push   %ebx
+  800519:	57                   	push   %edi
+  80051a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80051d:	83 ee 01             	sub    $0x1,%esi
+  800520:	83 c4 10             	add    $0x10,%esp
+  800523:	85 f6                	test   %esi,%esi
+  800525:	7f ee                	jg     800515 <vprintfmt+0x1cc>
+  800527:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80052a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80052d:	85 c0                	test   %eax,%eax
+  80052f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800534:	0f 49 d0             	cmovns %eax,%edx
+  800537:	29 d0                	sub    %edx,%eax
+  800539:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80053c:	eb a6                	jmp    8004e4 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80053e:	83 ec 08             	sub    $0x8,%esp
+  800541:	53                   	push   %ebx
+  800542:	52                   	push   %edx
+  800543:	ff 55 08             	call   *0x8(%ebp)
+  800546:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800549:	89 f1                	mov    %esi,%ecx
+  80054b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80054e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800552:	0f be d0             	movsbl %al,%edx
+  800555:	85 d2                	test   %edx,%edx
+  800557:	74 28                	je     800581 <vprintfmt+0x238>
+  800559:	85 ff                	test   %edi,%edi
+  80055b:	78 05                	js     800562 <vprintfmt+0x219>
+  80055d:	83 ef 01             	sub    $0x1,%edi
+  800560:	78 30                	js     800592 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800562:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800566:	74 d6                	je     80053e <vprintfmt+0x1f5>
+  800568:	0f be c0             	movsbl %al,%eax
+  80056b:	83 e8 20             	sub    $0x20,%eax
+  80056e:	83 f8 5e             	cmp    $0x5e,%eax
+  800571:	76 cb                	jbe    80053e <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800573:	83 ec 08             	sub    $0x8,%esp
+  800576:	53                   	push   %ebx
+  800577:	6a 3f                	push   $0x3f
+  800579:	ff 55 08             	call   *0x8(%ebp)
+  80057c:	83 c4 10             	add    $0x10,%esp
+  80057f:	eb c8                	jmp    800549 <vprintfmt+0x200>
+  800581:	8b 75 08             	mov    0x8(%ebp),%esi
+  800584:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800587:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80058a:	01 d0                	add    %edx,%eax
+  80058c:	29 c8                	sub    %ecx,%eax
+  80058e:	89 c7                	mov    %eax,%edi
+  800590:	eb 13                	jmp    8005a5 <vprintfmt+0x25c>
+  800592:	8b 75 08             	mov    0x8(%ebp),%esi
+  800595:	eb ed                	jmp    800584 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800597:	83 ec 08             	sub    $0x8,%esp
+  80059a:	53                   	push   %ebx
+  80059b:	6a 20                	push   $0x20
+  80059d:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80059f:	83 ef 01             	sub    $0x1,%edi
+  8005a2:	83 c4 10             	add    $0x10,%esp
+  8005a5:	85 ff                	test   %edi,%edi
+  8005a7:	7f ee                	jg     800597 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005a9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005ac:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005af:	e9 1d 01 00 00       	jmp    8006d1 <vprintfmt+0x388>
+	if (lflag >= 2)
+  8005b4:	83 f9 01             	cmp    $0x1,%ecx
+  8005b7:	7f 1b                	jg     8005d4 <vprintfmt+0x28b>
+	else if (lflag)
+  8005b9:	85 c9                	test   %ecx,%ecx
+  8005bb:	74 63                	je     800620 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  8005bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c0:	8b 00                	mov    (%eax),%eax
+  8005c2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c5:	99                   	cltd
+  8005c6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8005cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d2:	eb 17                	jmp    8005eb <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  8005d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d7:	8b 50 04             	mov    0x4(%eax),%edx
+  8005da:	8b 00                	mov    (%eax),%eax
+  8005dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005df:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e5:	8d 40 08             	lea    0x8(%eax),%eax
+  8005e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005eb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ee:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005f1:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005f6:	85 c9                	test   %ecx,%ecx
+  8005f8:	0f 89 b9 00 00 00    	jns    8006b7 <vprintfmt+0x36e>
+				putch('-', putdat);
+  8005fe:	83 ec 08             	sub    $0x8,%esp
+  800601:	53                   	push   %ebx
+  800602:	6a 2d                	push   $0x2d
+  800604:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800606:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800609:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80060c:	f7 da                	neg    %edx
+  80060e:	83 d1 00             	adc    $0x0,%ecx
+  800611:	f7 d9                	neg    %ecx
+  800613:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800616:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80061b:	e9 97 00 00 00       	jmp    8006b7 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800620:	8b 45 14             	mov    0x14(%ebp),%eax
+  800623:	8b 00                	mov    (%eax),%eax
+  800625:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800628:	99                   	cltd
+  800629:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80062c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062f:	8d 40 04             	lea    0x4(%eax),%eax
+  800632:	89 45 14             	mov    %eax,0x14(%ebp)
+  800635:	eb b4                	jmp    8005eb <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  800637:	83 f9 01             	cmp    $0x1,%ecx
+  80063a:	7f 1b                	jg     800657 <vprintfmt+0x30e>
+	else if (lflag)
+  80063c:	85 c9                	test   %ecx,%ecx
+  80063e:	74 2c                	je     80066c <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800640:	8b 45 14             	mov    0x14(%ebp),%eax
+  800643:	8b 10                	mov    (%eax),%edx
+  800645:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064a:	8d 40 04             	lea    0x4(%eax),%eax
+  80064d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800650:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800655:	eb 60                	jmp    8006b7 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800657:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065a:	8b 10                	mov    (%eax),%edx
+  80065c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80065f:	8d 40 08             	lea    0x8(%eax),%eax
+  800662:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800665:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80066a:	eb 4b                	jmp    8006b7 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80066c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066f:	8b 10                	mov    (%eax),%edx
+  800671:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800676:	8d 40 04             	lea    0x4(%eax),%eax
+  800679:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80067c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800681:	eb 34                	jmp    8006b7 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800683:	83 f9 01             	cmp    $0x1,%ecx
+  800686:	7f 15                	jg     80069d <vprintfmt+0x354>
+	else if (lflag)
+  800688:	85 c9                	test   %ecx,%ecx
+  80068a:	74 4d                	je     8006d9 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  80068c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068f:	8b 00                	mov    (%eax),%eax
+  800691:	99                   	cltd
+  800692:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800695:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800698:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80069b:	eb 11                	jmp    8006ae <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  80069d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a0:	8b 50 04             	mov    0x4(%eax),%edx
+  8006a3:	8b 00                	mov    (%eax),%eax
+  8006a5:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006a8:	8d 49 08             	lea    0x8(%ecx),%ecx
+  8006ab:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  8006ae:	89 d1                	mov    %edx,%ecx
+  8006b0:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  8006b2:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006b7:	83 ec 0c             	sub    $0xc,%esp
+  8006ba:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006be:	50                   	push   %eax
+  8006bf:	ff 75 e0             	push   -0x20(%ebp)
+  8006c2:	57                   	push   %edi
+  8006c3:	51                   	push   %ecx
+  8006c4:	52                   	push   %edx
+  8006c5:	89 da                	mov    %ebx,%edx
+  8006c7:	89 f0                	mov    %esi,%eax
+  8006c9:	e8 98 fb ff ff       	call   800266 <printnum>
+			break;
+  8006ce:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006d1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006d4:	e9 8e fc ff ff       	jmp    800367 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  8006d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dc:	8b 00                	mov    (%eax),%eax
+  8006de:	99                   	cltd
+  8006df:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006e2:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8006e5:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8006e8:	eb c4                	jmp    8006ae <vprintfmt+0x365>
+			putch('0', putdat);
+  8006ea:	83 ec 08             	sub    $0x8,%esp
+  8006ed:	53                   	push   %ebx
+  8006ee:	6a 30                	push   $0x30
+  8006f0:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006f2:	83 c4 08             	add    $0x8,%esp
+  8006f5:	53                   	push   %ebx
+  8006f6:	6a 78                	push   $0x78
+  8006f8:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fd:	8b 10                	mov    (%eax),%edx
+  8006ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800704:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800707:	8d 40 04             	lea    0x4(%eax),%eax
+  80070a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80070d:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800712:	eb a3                	jmp    8006b7 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800714:	83 f9 01             	cmp    $0x1,%ecx
+  800717:	7f 1b                	jg     800734 <vprintfmt+0x3eb>
+	else if (lflag)
+  800719:	85 c9                	test   %ecx,%ecx
+  80071b:	74 2f                	je     80074c <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  80071d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800720:	8b 10                	mov    (%eax),%edx
+  800722:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800727:	8d 40 04             	lea    0x4(%eax),%eax
+  80072a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80072d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800732:	eb 83                	jmp    8006b7 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800734:	8b 45 14             	mov    0x14(%ebp),%eax
+  800737:	8b 10                	mov    (%eax),%edx
+  800739:	8b 48 04             	mov    0x4(%eax),%ecx
+  80073c:	8d 40 08             	lea    0x8(%eax),%eax
+  80073f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800742:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800747:	e9 6b ff ff ff       	jmp    8006b7 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80074c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074f:	8b 10                	mov    (%eax),%edx
+  800751:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800756:	8d 40 04             	lea    0x4(%eax),%eax
+  800759:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80075c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800761:	e9 51 ff ff ff       	jmp    8006b7 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800766:	83 ec 08             	sub    $0x8,%esp
+  800769:	53                   	push   %ebx
+  80076a:	6a 25                	push   $0x25
+  80076c:	ff d6                	call   *%esi
+			break;
+  80076e:	83 c4 10             	add    $0x10,%esp
+  800771:	e9 5b ff ff ff       	jmp    8006d1 <vprintfmt+0x388>
+			putch('%', putdat);
+  800776:	83 ec 08             	sub    $0x8,%esp
+  800779:	53                   	push   %ebx
+  80077a:	6a 25                	push   $0x25
+  80077c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80077e:	83 c4 10             	add    $0x10,%esp
+  800781:	89 f8                	mov    %edi,%eax
+  800783:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800787:	74 05                	je     80078e <vprintfmt+0x445>
+  800789:	83 e8 01             	sub    $0x1,%eax
+  80078c:	eb f5                	jmp    800783 <vprintfmt+0x43a>
+  80078e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800791:	e9 3b ff ff ff       	jmp    8006d1 <vprintfmt+0x388>
+
+00800796 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800796:	55                   	push   %ebp
+  800797:	89 e5                	mov    %esp,%ebp
+  800799:	83 ec 18             	sub    $0x18,%esp
+  80079c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80079f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007a2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007a5:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007a9:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007b3:	85 c0                	test   %eax,%eax
+  8007b5:	74 26                	je     8007dd <vsnprintf+0x47>
+  8007b7:	85 d2                	test   %edx,%edx
+  8007b9:	7e 22                	jle    8007dd <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007bb:	ff 75 14             	push   0x14(%ebp)
+  8007be:	ff 75 10             	push   0x10(%ebp)
+  8007c1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007c4:	50                   	push   %eax
+  8007c5:	68 0f 03 80 00       	push   $0x80030f
+  8007ca:	e8 7a fb ff ff       	call   800349 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007cf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007d2:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007d8:	83 c4 10             	add    $0x10,%esp
+}
+  8007db:	c9                   	leave
+  8007dc:	c3                   	ret
+		return -E_INVAL;
+  8007dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007e2:	eb f7                	jmp    8007db <vsnprintf+0x45>
+
+008007e4 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007e4:	55                   	push   %ebp
+  8007e5:	89 e5                	mov    %esp,%ebp
+  8007e7:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007ea:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007ed:	50                   	push   %eax
+  8007ee:	ff 75 10             	push   0x10(%ebp)
+  8007f1:	ff 75 0c             	push   0xc(%ebp)
+  8007f4:	ff 75 08             	push   0x8(%ebp)
+  8007f7:	e8 9a ff ff ff       	call   800796 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007fc:	c9                   	leave
+  8007fd:	c3                   	ret
+
+008007fe <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007fe:	55                   	push   %ebp
+  8007ff:	89 e5                	mov    %esp,%ebp
+  800801:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800804:	b8 00 00 00 00       	mov    $0x0,%eax
+  800809:	eb 03                	jmp    80080e <strlen+0x10>
+		n++;
+  80080b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80080e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800812:	75 f7                	jne    80080b <strlen+0xd>
+	return n;
+}
+  800814:	5d                   	pop    %ebp
+  800815:	c3                   	ret
+
+00800816 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800816:	55                   	push   %ebp
+  800817:	89 e5                	mov    %esp,%ebp
+  800819:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80081c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80081f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800824:	eb 03                	jmp    800829 <strnlen+0x13>
+		n++;
+  800826:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800829:	39 d0                	cmp    %edx,%eax
+  80082b:	74 08                	je     800835 <strnlen+0x1f>
+  80082d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800831:	75 f3                	jne    800826 <strnlen+0x10>
+  800833:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800835:	89 d0                	mov    %edx,%eax
+  800837:	5d                   	pop    %ebp
+  800838:	c3                   	ret
+
+00800839 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800839:	55                   	push   %ebp
+  80083a:	89 e5                	mov    %esp,%ebp
+  80083c:	53                   	push   %ebx
+  80083d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800840:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800843:	b8 00 00 00 00       	mov    $0x0,%eax
+  800848:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80084c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80084f:	83 c0 01             	add    $0x1,%eax
+  800852:	84 d2                	test   %dl,%dl
+  800854:	75 f2                	jne    800848 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800856:	89 c8                	mov    %ecx,%eax
+  800858:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80085b:	c9                   	leave
+  80085c:	c3                   	ret
+
+0080085d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80085d:	55                   	push   %ebp
+  80085e:	89 e5                	mov    %esp,%ebp
+  800860:	53                   	push   %ebx
+  800861:	83 ec 10             	sub    $0x10,%esp
+  800864:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800867:	53                   	push   %ebx
+  800868:	e8 91 ff ff ff       	call   8007fe <strlen>
+  80086d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800870:	ff 75 0c             	push   0xc(%ebp)
+  800873:	01 d8                	add    %ebx,%eax
+  800875:	50                   	push   %eax
+  800876:	e8 be ff ff ff       	call   800839 <strcpy>
+	return dst;
+}
+  80087b:	89 d8                	mov    %ebx,%eax
+  80087d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800880:	c9                   	leave
+  800881:	c3                   	ret
+
+00800882 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800882:	55                   	push   %ebp
+  800883:	89 e5                	mov    %esp,%ebp
+  800885:	56                   	push   %esi
+  800886:	53                   	push   %ebx
+  800887:	8b 75 08             	mov    0x8(%ebp),%esi
+  80088a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80088d:	89 f3                	mov    %esi,%ebx
+  80088f:	03 5d 10             	add    0x10(%ebp),%ebx
+  800892:	89 f0                	mov    %esi,%eax
+  800894:	eb 0f                	jmp    8008a5 <strncpy+0x23>
+		*dst++ = *src;
+  800896:	83 c0 01             	add    $0x1,%eax
+  800899:	0f b6 0a             	movzbl (%edx),%ecx
+  80089c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80089f:	80 f9 01             	cmp    $0x1,%cl
+  8008a2:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008a5:	39 d8                	cmp    %ebx,%eax
+  8008a7:	75 ed                	jne    800896 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008a9:	89 f0                	mov    %esi,%eax
+  8008ab:	5b                   	pop    %ebx
+  8008ac:	5e                   	pop    %esi
+  8008ad:	5d                   	pop    %ebp
+  8008ae:	c3                   	ret
+
+008008af <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008af:	55                   	push   %ebp
+  8008b0:	89 e5                	mov    %esp,%ebp
+  8008b2:	56                   	push   %esi
+  8008b3:	53                   	push   %ebx
+  8008b4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008ba:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008bd:	89 f0                	mov    %esi,%eax
+  8008bf:	85 d2                	test   %edx,%edx
+  8008c1:	74 21                	je     8008e4 <strlcpy+0x35>
+  8008c3:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008c7:	89 f2                	mov    %esi,%edx
+  8008c9:	eb 09                	jmp    8008d4 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008cb:	83 c1 01             	add    $0x1,%ecx
+  8008ce:	83 c2 01             	add    $0x1,%edx
+  8008d1:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008d4:	39 c2                	cmp    %eax,%edx
+  8008d6:	74 09                	je     8008e1 <strlcpy+0x32>
+  8008d8:	0f b6 19             	movzbl (%ecx),%ebx
+  8008db:	84 db                	test   %bl,%bl
+  8008dd:	75 ec                	jne    8008cb <strlcpy+0x1c>
+  8008df:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008e1:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008e4:	29 f0                	sub    %esi,%eax
+}
+  8008e6:	5b                   	pop    %ebx
+  8008e7:	5e                   	pop    %esi
+  8008e8:	5d                   	pop    %ebp
+  8008e9:	c3                   	ret
+
+008008ea <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008ea:	55                   	push   %ebp
+  8008eb:	89 e5                	mov    %esp,%ebp
+  8008ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008f3:	eb 06                	jmp    8008fb <strcmp+0x11>
+		p++, q++;
+  8008f5:	83 c1 01             	add    $0x1,%ecx
+  8008f8:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008fb:	0f b6 01             	movzbl (%ecx),%eax
+  8008fe:	84 c0                	test   %al,%al
+  800900:	74 04                	je     800906 <strcmp+0x1c>
+  800902:	3a 02                	cmp    (%edx),%al
+  800904:	74 ef                	je     8008f5 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800906:	0f b6 c0             	movzbl %al,%eax
+  800909:	0f b6 12             	movzbl (%edx),%edx
+  80090c:	29 d0                	sub    %edx,%eax
+}
+  80090e:	5d                   	pop    %ebp
+  80090f:	c3                   	ret
+
+00800910 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800910:	55                   	push   %ebp
+  800911:	89 e5                	mov    %esp,%ebp
+  800913:	53                   	push   %ebx
+  800914:	8b 45 08             	mov    0x8(%ebp),%eax
+  800917:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80091a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80091d:	eb 09                	jmp    800928 <strncmp+0x18>
+		n--, p++, q++;
+  80091f:	83 ea 01             	sub    $0x1,%edx
+  800922:	83 c0 01             	add    $0x1,%eax
+  800925:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800928:	85 d2                	test   %edx,%edx
+  80092a:	74 18                	je     800944 <strncmp+0x34>
+  80092c:	0f b6 18             	movzbl (%eax),%ebx
+  80092f:	84 db                	test   %bl,%bl
+  800931:	74 04                	je     800937 <strncmp+0x27>
+  800933:	3a 19                	cmp    (%ecx),%bl
+  800935:	74 e8                	je     80091f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800937:	0f b6 00             	movzbl (%eax),%eax
+  80093a:	0f b6 11             	movzbl (%ecx),%edx
+  80093d:	29 d0                	sub    %edx,%eax
+}
+  80093f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800942:	c9                   	leave
+  800943:	c3                   	ret
+		return 0;
+  800944:	b8 00 00 00 00       	mov    $0x0,%eax
+  800949:	eb f4                	jmp    80093f <strncmp+0x2f>
+
+0080094b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80094b:	55                   	push   %ebp
+  80094c:	89 e5                	mov    %esp,%ebp
+  80094e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800951:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800955:	eb 03                	jmp    80095a <strchr+0xf>
+  800957:	83 c0 01             	add    $0x1,%eax
+  80095a:	0f b6 10             	movzbl (%eax),%edx
+  80095d:	84 d2                	test   %dl,%dl
+  80095f:	74 06                	je     800967 <strchr+0x1c>
+		if (*s == c)
+  800961:	38 ca                	cmp    %cl,%dl
+  800963:	75 f2                	jne    800957 <strchr+0xc>
+  800965:	eb 05                	jmp    80096c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800967:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80096c:	5d                   	pop    %ebp
+  80096d:	c3                   	ret
+
+0080096e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80096e:	55                   	push   %ebp
+  80096f:	89 e5                	mov    %esp,%ebp
+  800971:	8b 45 08             	mov    0x8(%ebp),%eax
+  800974:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800978:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80097b:	38 ca                	cmp    %cl,%dl
+  80097d:	74 09                	je     800988 <strfind+0x1a>
+  80097f:	84 d2                	test   %dl,%dl
+  800981:	74 05                	je     800988 <strfind+0x1a>
+	for (; *s; s++)
+  800983:	83 c0 01             	add    $0x1,%eax
+  800986:	eb f0                	jmp    800978 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800988:	5d                   	pop    %ebp
+  800989:	c3                   	ret
+
+0080098a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80098a:	55                   	push   %ebp
+  80098b:	89 e5                	mov    %esp,%ebp
+  80098d:	57                   	push   %edi
+  80098e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800991:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800994:	85 c9                	test   %ecx,%ecx
+  800996:	74 20                	je     8009b8 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800998:	89 f8                	mov    %edi,%eax
+  80099a:	09 c8                	or     %ecx,%eax
+  80099c:	a8 03                	test   $0x3,%al
+  80099e:	75 12                	jne    8009b2 <memset+0x28>
+		c &= 0xFF;
+  8009a0:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009a4:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009aa:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009ad:	fc                   	cld
+  8009ae:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009b0:	eb 06                	jmp    8009b8 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009b5:	fc                   	cld
+  8009b6:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009b8:	89 f8                	mov    %edi,%eax
+  8009ba:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009bd:	c9                   	leave
+  8009be:	c3                   	ret
+
+008009bf <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009bf:	55                   	push   %ebp
+  8009c0:	89 e5                	mov    %esp,%ebp
+  8009c2:	57                   	push   %edi
+  8009c3:	56                   	push   %esi
+  8009c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009ca:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009cd:	39 c6                	cmp    %eax,%esi
+  8009cf:	73 32                	jae    800a03 <memmove+0x44>
+  8009d1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009d4:	39 d0                	cmp    %edx,%eax
+  8009d6:	73 2b                	jae    800a03 <memmove+0x44>
+		s += n;
+		d += n;
+  8009d8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009db:	89 d6                	mov    %edx,%esi
+  8009dd:	09 fe                	or     %edi,%esi
+  8009df:	09 ce                	or     %ecx,%esi
+  8009e1:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009e7:	75 0e                	jne    8009f7 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009e9:	83 ef 04             	sub    $0x4,%edi
+  8009ec:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009ef:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009f2:	fd                   	std
+  8009f3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009f5:	eb 09                	jmp    800a00 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009f7:	83 ef 01             	sub    $0x1,%edi
+  8009fa:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009fd:	fd                   	std
+  8009fe:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a00:	fc                   	cld
+  800a01:	eb 1a                	jmp    800a1d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a03:	89 f2                	mov    %esi,%edx
+  800a05:	09 c2                	or     %eax,%edx
+  800a07:	09 ca                	or     %ecx,%edx
+  800a09:	f6 c2 03             	test   $0x3,%dl
+  800a0c:	75 0a                	jne    800a18 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a0e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a11:	89 c7                	mov    %eax,%edi
+  800a13:	fc                   	cld
+  800a14:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a16:	eb 05                	jmp    800a1d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a18:	89 c7                	mov    %eax,%edi
+  800a1a:	fc                   	cld
+  800a1b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a1d:	5e                   	pop    %esi
+  800a1e:	5f                   	pop    %edi
+  800a1f:	5d                   	pop    %ebp
+  800a20:	c3                   	ret
+
+00800a21 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a21:	55                   	push   %ebp
+  800a22:	89 e5                	mov    %esp,%ebp
+  800a24:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a27:	ff 75 10             	push   0x10(%ebp)
+  800a2a:	ff 75 0c             	push   0xc(%ebp)
+  800a2d:	ff 75 08             	push   0x8(%ebp)
+  800a30:	e8 8a ff ff ff       	call   8009bf <memmove>
+}
+  800a35:	c9                   	leave
+  800a36:	c3                   	ret
+
+00800a37 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a37:	55                   	push   %ebp
+  800a38:	89 e5                	mov    %esp,%ebp
+  800a3a:	56                   	push   %esi
+  800a3b:	53                   	push   %ebx
+  800a3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a42:	89 c6                	mov    %eax,%esi
+  800a44:	03 75 10             	add    0x10(%ebp),%esi
+  800a47:	eb 06                	jmp    800a4f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a49:	83 c0 01             	add    $0x1,%eax
+  800a4c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a4f:	39 f0                	cmp    %esi,%eax
+  800a51:	74 14                	je     800a67 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a53:	0f b6 08             	movzbl (%eax),%ecx
+  800a56:	0f b6 1a             	movzbl (%edx),%ebx
+  800a59:	38 d9                	cmp    %bl,%cl
+  800a5b:	74 ec                	je     800a49 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a5d:	0f b6 c1             	movzbl %cl,%eax
+  800a60:	0f b6 db             	movzbl %bl,%ebx
+  800a63:	29 d8                	sub    %ebx,%eax
+  800a65:	eb 05                	jmp    800a6c <memcmp+0x35>
+	}
+
+	return 0;
+  800a67:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a6c:	5b                   	pop    %ebx
+  800a6d:	5e                   	pop    %esi
+  800a6e:	5d                   	pop    %ebp
+  800a6f:	c3                   	ret
+
+00800a70 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a70:	55                   	push   %ebp
+  800a71:	89 e5                	mov    %esp,%ebp
+  800a73:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a79:	89 c2                	mov    %eax,%edx
+  800a7b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a7e:	eb 03                	jmp    800a83 <memfind+0x13>
+  800a80:	83 c0 01             	add    $0x1,%eax
+  800a83:	39 d0                	cmp    %edx,%eax
+  800a85:	73 04                	jae    800a8b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a87:	38 08                	cmp    %cl,(%eax)
+  800a89:	75 f5                	jne    800a80 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a8b:	5d                   	pop    %ebp
+  800a8c:	c3                   	ret
+
+00800a8d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a8d:	55                   	push   %ebp
+  800a8e:	89 e5                	mov    %esp,%ebp
+  800a90:	57                   	push   %edi
+  800a91:	56                   	push   %esi
+  800a92:	53                   	push   %ebx
+  800a93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a96:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a99:	eb 03                	jmp    800a9e <strtol+0x11>
+		s++;
+  800a9b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a9e:	0f b6 02             	movzbl (%edx),%eax
+  800aa1:	3c 20                	cmp    $0x20,%al
+  800aa3:	74 f6                	je     800a9b <strtol+0xe>
+  800aa5:	3c 09                	cmp    $0x9,%al
+  800aa7:	74 f2                	je     800a9b <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800aa9:	3c 2b                	cmp    $0x2b,%al
+  800aab:	74 2a                	je     800ad7 <strtol+0x4a>
+	int neg = 0;
+  800aad:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ab2:	3c 2d                	cmp    $0x2d,%al
+  800ab4:	74 2b                	je     800ae1 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ab6:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800abc:	75 0f                	jne    800acd <strtol+0x40>
+  800abe:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ac1:	74 28                	je     800aeb <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ac3:	85 db                	test   %ebx,%ebx
+  800ac5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800aca:	0f 44 d8             	cmove  %eax,%ebx
+  800acd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ad2:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ad5:	eb 46                	jmp    800b1d <strtol+0x90>
+		s++;
+  800ad7:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ada:	bf 00 00 00 00       	mov    $0x0,%edi
+  800adf:	eb d5                	jmp    800ab6 <strtol+0x29>
+		s++, neg = 1;
+  800ae1:	83 c2 01             	add    $0x1,%edx
+  800ae4:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ae9:	eb cb                	jmp    800ab6 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aeb:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800aef:	74 0e                	je     800aff <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800af1:	85 db                	test   %ebx,%ebx
+  800af3:	75 d8                	jne    800acd <strtol+0x40>
+		s++, base = 8;
+  800af5:	83 c2 01             	add    $0x1,%edx
+  800af8:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800afd:	eb ce                	jmp    800acd <strtol+0x40>
+		s += 2, base = 16;
+  800aff:	83 c2 02             	add    $0x2,%edx
+  800b02:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b07:	eb c4                	jmp    800acd <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b09:	0f be c0             	movsbl %al,%eax
+  800b0c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b0f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b12:	7d 3a                	jge    800b4e <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b14:	83 c2 01             	add    $0x1,%edx
+  800b17:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b1b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b1d:	0f b6 02             	movzbl (%edx),%eax
+  800b20:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b23:	89 f3                	mov    %esi,%ebx
+  800b25:	80 fb 09             	cmp    $0x9,%bl
+  800b28:	76 df                	jbe    800b09 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b2a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b2d:	89 f3                	mov    %esi,%ebx
+  800b2f:	80 fb 19             	cmp    $0x19,%bl
+  800b32:	77 08                	ja     800b3c <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b34:	0f be c0             	movsbl %al,%eax
+  800b37:	83 e8 57             	sub    $0x57,%eax
+  800b3a:	eb d3                	jmp    800b0f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b3c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b3f:	89 f3                	mov    %esi,%ebx
+  800b41:	80 fb 19             	cmp    $0x19,%bl
+  800b44:	77 08                	ja     800b4e <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b46:	0f be c0             	movsbl %al,%eax
+  800b49:	83 e8 37             	sub    $0x37,%eax
+  800b4c:	eb c1                	jmp    800b0f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b4e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b52:	74 05                	je     800b59 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b54:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b57:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b59:	89 c8                	mov    %ecx,%eax
+  800b5b:	f7 d8                	neg    %eax
+  800b5d:	85 ff                	test   %edi,%edi
+  800b5f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b62:	89 c8                	mov    %ecx,%eax
+  800b64:	5b                   	pop    %ebx
+  800b65:	5e                   	pop    %esi
+  800b66:	5f                   	pop    %edi
+  800b67:	5d                   	pop    %ebp
+  800b68:	c3                   	ret
+
+00800b69 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800b69:	55                   	push   %ebp
+  800b6a:	89 e5                	mov    %esp,%ebp
+  800b6c:	57                   	push   %edi
+  800b6d:	56                   	push   %esi
+  800b6e:	53                   	push   %ebx
+  800b6f:	83 ec 0c             	sub    $0xc,%esp
+  800b72:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b75:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b78:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800b7b:	85 ff                	test   %edi,%edi
+  800b7d:	74 16                	je     800b95 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800b7f:	83 ec 04             	sub    $0x4,%esp
+  800b82:	56                   	push   %esi
+  800b83:	6a 00                	push   $0x0
+  800b85:	53                   	push   %ebx
+  800b86:	e8 02 ff ff ff       	call   800a8d <strtol>
+  800b8b:	89 07                	mov    %eax,(%edi)
+  800b8d:	83 c4 10             	add    $0x10,%esp
+  800b90:	eb 03                	jmp    800b95 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800b92:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800b95:	0f b6 03             	movzbl (%ebx),%eax
+  800b98:	3c 20                	cmp    $0x20,%al
+  800b9a:	74 f6                	je     800b92 <strisl+0x29>
+  800b9c:	3c 09                	cmp    $0x9,%al
+  800b9e:	74 f2                	je     800b92 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ba0:	3c 2b                	cmp    $0x2b,%al
+  800ba2:	74 23                	je     800bc7 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800ba4:	3c 2d                	cmp    $0x2d,%al
+  800ba6:	0f 94 c0             	sete   %al
+  800ba9:	0f b6 c0             	movzbl %al,%eax
+  800bac:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bae:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800bb4:	75 41                	jne    800bf7 <strisl+0x8e>
+  800bb6:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800bb9:	74 11                	je     800bcc <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bbb:	85 f6                	test   %esi,%esi
+  800bbd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bc2:	0f 44 f0             	cmove  %eax,%esi
+  800bc5:	eb 30                	jmp    800bf7 <strisl+0x8e>
+		s++;
+  800bc7:	83 c3 01             	add    $0x1,%ebx
+  800bca:	eb e2                	jmp    800bae <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bcc:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800bd0:	74 0e                	je     800be0 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800bd2:	85 f6                	test   %esi,%esi
+  800bd4:	75 21                	jne    800bf7 <strisl+0x8e>
+		s++, base = 8;
+  800bd6:	83 c3 01             	add    $0x1,%ebx
+  800bd9:	be 08 00 00 00       	mov    $0x8,%esi
+  800bde:	eb 17                	jmp    800bf7 <strisl+0x8e>
+		s += 2, base = 16;
+  800be0:	83 c3 02             	add    $0x2,%ebx
+  800be3:	be 10 00 00 00       	mov    $0x10,%esi
+  800be8:	eb 0d                	jmp    800bf7 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bea:	0f be c0             	movsbl %al,%eax
+  800bed:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800bf0:	39 f0                	cmp    %esi,%eax
+  800bf2:	7d 38                	jge    800c2c <strisl+0xc3>
+			return 0;
+		s++;
+  800bf4:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800bf7:	0f b6 03             	movzbl (%ebx),%eax
+  800bfa:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800bfd:	80 fa 09             	cmp    $0x9,%dl
+  800c00:	76 e8                	jbe    800bea <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800c02:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800c05:	80 fa 19             	cmp    $0x19,%dl
+  800c08:	77 08                	ja     800c12 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800c0a:	0f be c0             	movsbl %al,%eax
+  800c0d:	83 e8 57             	sub    $0x57,%eax
+  800c10:	eb de                	jmp    800bf0 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c12:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800c15:	80 fa 19             	cmp    $0x19,%dl
+  800c18:	77 08                	ja     800c22 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800c1a:	0f be c0             	movsbl %al,%eax
+  800c1d:	83 e8 37             	sub    $0x37,%eax
+  800c20:	eb ce                	jmp    800bf0 <strisl+0x87>
+		else if (!*s)
+  800c22:	84 c0                	test   %al,%al
+  800c24:	0f 94 c0             	sete   %al
+  800c27:	0f b6 c0             	movzbl %al,%eax
+  800c2a:	eb 05                	jmp    800c31 <strisl+0xc8>
+			return 0;
+  800c2c:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800c31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c34:	5b                   	pop    %ebx
+  800c35:	5e                   	pop    %esi
+  800c36:	5f                   	pop    %edi
+  800c37:	5d                   	pop    %ebp
+  800c38:	c3                   	ret
+
+00800c39 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800c39:	55                   	push   %ebp
+  800c3a:	89 e5                	mov    %esp,%ebp
+  800c3c:	83 ec 10             	sub    $0x10,%esp
+  800c3f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c42:	89 c8                	mov    %ecx,%eax
+  800c44:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800c49:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800c4c:	eb 0b                	jmp    800c59 <touch_mem+0x20>
+		c = *(char *)page;
+  800c4e:	0f b6 10             	movzbl (%eax),%edx
+  800c51:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c54:	05 00 10 00 00       	add    $0x1000,%eax
+  800c59:	39 c8                	cmp    %ecx,%eax
+  800c5b:	72 f1                	jb     800c4e <touch_mem+0x15>
+}
+  800c5d:	c9                   	leave
+  800c5e:	c3                   	ret
+
+00800c5f <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c5f:	55                   	push   %ebp
+  800c60:	89 e5                	mov    %esp,%ebp
+  800c62:	57                   	push   %edi
+  800c63:	56                   	push   %esi
+  800c64:	53                   	push   %ebx
+	touch_mem(s, len);
+  800c65:	ff 75 0c             	push   0xc(%ebp)
+  800c68:	ff 75 08             	push   0x8(%ebp)
+  800c6b:	e8 c9 ff ff ff       	call   800c39 <touch_mem>
+	asm volatile("int %1\n"
+  800c70:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7b:	89 c3                	mov    %eax,%ebx
+  800c7d:	89 c7                	mov    %eax,%edi
+  800c7f:	89 c6                	mov    %eax,%esi
+  800c81:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c83:	83 c4 08             	add    $0x8,%esp
+  800c86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c89:	5b                   	pop    %ebx
+  800c8a:	5e                   	pop    %esi
+  800c8b:	5f                   	pop    %edi
+  800c8c:	5d                   	pop    %ebp
+  800c8d:	c3                   	ret
+
+00800c8e <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c8e:	55                   	push   %ebp
+  800c8f:	89 e5                	mov    %esp,%ebp
+  800c91:	57                   	push   %edi
+  800c92:	56                   	push   %esi
+  800c93:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c99:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c9e:	89 d1                	mov    %edx,%ecx
+  800ca0:	89 d3                	mov    %edx,%ebx
+  800ca2:	89 d7                	mov    %edx,%edi
+  800ca4:	89 d6                	mov    %edx,%esi
+  800ca6:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ca8:	5b                   	pop    %ebx
+  800ca9:	5e                   	pop    %esi
+  800caa:	5f                   	pop    %edi
+  800cab:	5d                   	pop    %ebp
+  800cac:	c3                   	ret
+
+00800cad <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800cad:	55                   	push   %ebp
+  800cae:	89 e5                	mov    %esp,%ebp
+  800cb0:	57                   	push   %edi
+  800cb1:	56                   	push   %esi
+  800cb2:	53                   	push   %ebx
+  800cb3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbe:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cc3:	89 cb                	mov    %ecx,%ebx
+  800cc5:	89 cf                	mov    %ecx,%edi
+  800cc7:	89 ce                	mov    %ecx,%esi
+  800cc9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ccb:	85 c0                	test   %eax,%eax
+  800ccd:	7f 08                	jg     800cd7 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ccf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd2:	5b                   	pop    %ebx
+  800cd3:	5e                   	pop    %esi
+  800cd4:	5f                   	pop    %edi
+  800cd5:	5d                   	pop    %ebp
+  800cd6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cd7:	83 ec 0c             	sub    $0xc,%esp
+  800cda:	50                   	push   %eax
+  800cdb:	6a 03                	push   $0x3
+  800cdd:	68 4b 51 80 00       	push   $0x80514b
+  800ce2:	6a 23                	push   $0x23
+  800ce4:	68 68 51 80 00       	push   $0x805168
+  800ce9:	e8 89 f4 ff ff       	call   800177 <_panic>
+
+00800cee <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cee:	55                   	push   %ebp
+  800cef:	89 e5                	mov    %esp,%ebp
+  800cf1:	57                   	push   %edi
+  800cf2:	56                   	push   %esi
+  800cf3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cf4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf9:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cfe:	89 d1                	mov    %edx,%ecx
+  800d00:	89 d3                	mov    %edx,%ebx
+  800d02:	89 d7                	mov    %edx,%edi
+  800d04:	89 d6                	mov    %edx,%esi
+  800d06:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d08:	5b                   	pop    %ebx
+  800d09:	5e                   	pop    %esi
+  800d0a:	5f                   	pop    %edi
+  800d0b:	5d                   	pop    %ebp
+  800d0c:	c3                   	ret
+
+00800d0d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	57                   	push   %edi
+  800d11:	56                   	push   %esi
+  800d12:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d13:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d18:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d1d:	89 d1                	mov    %edx,%ecx
+  800d1f:	89 d3                	mov    %edx,%ebx
+  800d21:	89 d7                	mov    %edx,%edi
+  800d23:	89 d6                	mov    %edx,%esi
+  800d25:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d27:	5b                   	pop    %ebx
+  800d28:	5e                   	pop    %esi
+  800d29:	5f                   	pop    %edi
+  800d2a:	5d                   	pop    %ebp
+  800d2b:	c3                   	ret
+
+00800d2c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d2c:	55                   	push   %ebp
+  800d2d:	89 e5                	mov    %esp,%ebp
+  800d2f:	57                   	push   %edi
+  800d30:	56                   	push   %esi
+  800d31:	53                   	push   %ebx
+  800d32:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d35:	be 00 00 00 00       	mov    $0x0,%esi
+  800d3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d40:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d48:	89 f7                	mov    %esi,%edi
+  800d4a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d4c:	85 c0                	test   %eax,%eax
+  800d4e:	7f 08                	jg     800d58 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d53:	5b                   	pop    %ebx
+  800d54:	5e                   	pop    %esi
+  800d55:	5f                   	pop    %edi
+  800d56:	5d                   	pop    %ebp
+  800d57:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d58:	83 ec 0c             	sub    $0xc,%esp
+  800d5b:	50                   	push   %eax
+  800d5c:	6a 04                	push   $0x4
+  800d5e:	68 4b 51 80 00       	push   $0x80514b
+  800d63:	6a 23                	push   $0x23
+  800d65:	68 68 51 80 00       	push   $0x805168
+  800d6a:	e8 08 f4 ff ff       	call   800177 <_panic>
+
+00800d6f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	57                   	push   %edi
+  800d73:	56                   	push   %esi
+  800d74:	53                   	push   %ebx
+  800d75:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d83:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d86:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d89:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d8c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d8e:	85 c0                	test   %eax,%eax
+  800d90:	7f 08                	jg     800d9a <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d95:	5b                   	pop    %ebx
+  800d96:	5e                   	pop    %esi
+  800d97:	5f                   	pop    %edi
+  800d98:	5d                   	pop    %ebp
+  800d99:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d9a:	83 ec 0c             	sub    $0xc,%esp
+  800d9d:	50                   	push   %eax
+  800d9e:	6a 05                	push   $0x5
+  800da0:	68 4b 51 80 00       	push   $0x80514b
+  800da5:	6a 23                	push   $0x23
+  800da7:	68 68 51 80 00       	push   $0x805168
+  800dac:	e8 c6 f3 ff ff       	call   800177 <_panic>
+
+00800db1 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800db1:	55                   	push   %ebp
+  800db2:	89 e5                	mov    %esp,%ebp
+  800db4:	57                   	push   %edi
+  800db5:	56                   	push   %esi
+  800db6:	53                   	push   %ebx
+  800db7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dca:	89 df                	mov    %ebx,%edi
+  800dcc:	89 de                	mov    %ebx,%esi
+  800dce:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dd0:	85 c0                	test   %eax,%eax
+  800dd2:	7f 08                	jg     800ddc <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800dd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd7:	5b                   	pop    %ebx
+  800dd8:	5e                   	pop    %esi
+  800dd9:	5f                   	pop    %edi
+  800dda:	5d                   	pop    %ebp
+  800ddb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ddc:	83 ec 0c             	sub    $0xc,%esp
+  800ddf:	50                   	push   %eax
+  800de0:	6a 06                	push   $0x6
+  800de2:	68 4b 51 80 00       	push   $0x80514b
+  800de7:	6a 23                	push   $0x23
+  800de9:	68 68 51 80 00       	push   $0x805168
+  800dee:	e8 84 f3 ff ff       	call   800177 <_panic>
+
+00800df3 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800df3:	55                   	push   %ebp
+  800df4:	89 e5                	mov    %esp,%ebp
+  800df6:	57                   	push   %edi
+  800df7:	56                   	push   %esi
+  800df8:	53                   	push   %ebx
+  800df9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dfc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e07:	b8 18 00 00 00       	mov    $0x18,%eax
+  800e0c:	89 df                	mov    %ebx,%edi
+  800e0e:	89 de                	mov    %ebx,%esi
+  800e10:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e12:	85 c0                	test   %eax,%eax
+  800e14:	7f 08                	jg     800e1e <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e19:	5b                   	pop    %ebx
+  800e1a:	5e                   	pop    %esi
+  800e1b:	5f                   	pop    %edi
+  800e1c:	5d                   	pop    %ebp
+  800e1d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e1e:	83 ec 0c             	sub    $0xc,%esp
+  800e21:	50                   	push   %eax
+  800e22:	6a 18                	push   $0x18
+  800e24:	68 4b 51 80 00       	push   $0x80514b
+  800e29:	6a 23                	push   $0x23
+  800e2b:	68 68 51 80 00       	push   $0x805168
+  800e30:	e8 42 f3 ff ff       	call   800177 <_panic>
+
+00800e35 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800e35:	55                   	push   %ebp
+  800e36:	89 e5                	mov    %esp,%ebp
+  800e38:	57                   	push   %edi
+  800e39:	56                   	push   %esi
+  800e3a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e3b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e46:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e4b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e4e:	89 f7                	mov    %esi,%edi
+  800e50:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800e52:	5b                   	pop    %ebx
+  800e53:	5e                   	pop    %esi
+  800e54:	5f                   	pop    %edi
+  800e55:	5d                   	pop    %ebp
+  800e56:	c3                   	ret
+
+00800e57 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800e57:	55                   	push   %ebp
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	57                   	push   %edi
+  800e5b:	56                   	push   %esi
+  800e5c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e63:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e68:	be 00 00 00 00       	mov    $0x0,%esi
+  800e6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e70:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e73:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e75:	5b                   	pop    %ebx
+  800e76:	5e                   	pop    %esi
+  800e77:	5f                   	pop    %edi
+  800e78:	5d                   	pop    %ebp
+  800e79:	c3                   	ret
+
+00800e7a <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e7a:	55                   	push   %ebp
+  800e7b:	89 e5                	mov    %esp,%ebp
+  800e7d:	57                   	push   %edi
+  800e7e:	56                   	push   %esi
+  800e7f:	53                   	push   %ebx
+  800e80:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800e83:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800e86:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800e8c:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800e8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e95:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e9d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ea0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea2:	85 c0                	test   %eax,%eax
+  800ea4:	7f 08                	jg     800eae <sys_page_map_range+0x34>
+}
+  800ea6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea9:	5b                   	pop    %ebx
+  800eaa:	5e                   	pop    %esi
+  800eab:	5f                   	pop    %edi
+  800eac:	5d                   	pop    %ebp
+  800ead:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eae:	83 ec 0c             	sub    $0xc,%esp
+  800eb1:	50                   	push   %eax
+  800eb2:	6a 10                	push   $0x10
+  800eb4:	68 4b 51 80 00       	push   $0x80514b
+  800eb9:	6a 23                	push   $0x23
+  800ebb:	68 68 51 80 00       	push   $0x805168
+  800ec0:	e8 b2 f2 ff ff       	call   800177 <_panic>
+
+00800ec5 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800ec5:	55                   	push   %ebp
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	57                   	push   %edi
+  800ec9:	56                   	push   %esi
+  800eca:	53                   	push   %ebx
+  800ecb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ece:	be 00 00 00 00       	mov    $0x0,%esi
+  800ed3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed9:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ede:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ee1:	89 f7                	mov    %esi,%edi
+  800ee3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee5:	85 c0                	test   %eax,%eax
+  800ee7:	7f 08                	jg     800ef1 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ee9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eec:	5b                   	pop    %ebx
+  800eed:	5e                   	pop    %esi
+  800eee:	5f                   	pop    %edi
+  800eef:	5d                   	pop    %ebp
+  800ef0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef1:	83 ec 0c             	sub    $0xc,%esp
+  800ef4:	50                   	push   %eax
+  800ef5:	6a 11                	push   $0x11
+  800ef7:	68 4b 51 80 00       	push   $0x80514b
+  800efc:	6a 23                	push   $0x23
+  800efe:	68 68 51 80 00       	push   $0x805168
+  800f03:	e8 6f f2 ff ff       	call   800177 <_panic>
+
+00800f08 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800f08:	55                   	push   %ebp
+  800f09:	89 e5                	mov    %esp,%ebp
+  800f0b:	57                   	push   %edi
+  800f0c:	56                   	push   %esi
+  800f0d:	53                   	push   %ebx
+  800f0e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f11:	be 00 00 00 00       	mov    $0x0,%esi
+  800f16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800f21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f24:	89 f7                	mov    %esi,%edi
+  800f26:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f28:	85 c0                	test   %eax,%eax
+  800f2a:	7f 08                	jg     800f34 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f2f:	5b                   	pop    %ebx
+  800f30:	5e                   	pop    %esi
+  800f31:	5f                   	pop    %edi
+  800f32:	5d                   	pop    %ebp
+  800f33:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f34:	83 ec 0c             	sub    $0xc,%esp
+  800f37:	50                   	push   %eax
+  800f38:	6a 1b                	push   $0x1b
+  800f3a:	68 4b 51 80 00       	push   $0x80514b
+  800f3f:	6a 23                	push   $0x23
+  800f41:	68 68 51 80 00       	push   $0x805168
+  800f46:	e8 2c f2 ff ff       	call   800177 <_panic>
+
+00800f4b <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800f4b:	55                   	push   %ebp
+  800f4c:	89 e5                	mov    %esp,%ebp
+  800f4e:	57                   	push   %edi
+  800f4f:	56                   	push   %esi
+  800f50:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f51:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f56:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f5b:	89 d1                	mov    %edx,%ecx
+  800f5d:	89 d3                	mov    %edx,%ebx
+  800f5f:	89 d7                	mov    %edx,%edi
+  800f61:	89 d6                	mov    %edx,%esi
+  800f63:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f65:	5b                   	pop    %ebx
+  800f66:	5e                   	pop    %esi
+  800f67:	5f                   	pop    %edi
+  800f68:	5d                   	pop    %ebp
+  800f69:	c3                   	ret
+
+00800f6a <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f6a:	55                   	push   %ebp
+  800f6b:	89 e5                	mov    %esp,%ebp
+  800f6d:	57                   	push   %edi
+  800f6e:	56                   	push   %esi
+  800f6f:	53                   	push   %ebx
+  800f70:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f83:	89 df                	mov    %ebx,%edi
+  800f85:	89 de                	mov    %ebx,%esi
+  800f87:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f89:	85 c0                	test   %eax,%eax
+  800f8b:	7f 08                	jg     800f95 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f90:	5b                   	pop    %ebx
+  800f91:	5e                   	pop    %esi
+  800f92:	5f                   	pop    %edi
+  800f93:	5d                   	pop    %ebp
+  800f94:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f95:	83 ec 0c             	sub    $0xc,%esp
+  800f98:	50                   	push   %eax
+  800f99:	6a 08                	push   $0x8
+  800f9b:	68 4b 51 80 00       	push   $0x80514b
+  800fa0:	6a 23                	push   $0x23
+  800fa2:	68 68 51 80 00       	push   $0x805168
+  800fa7:	e8 cb f1 ff ff       	call   800177 <_panic>
+
+00800fac <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fac:	55                   	push   %ebp
+  800fad:	89 e5                	mov    %esp,%ebp
+  800faf:	57                   	push   %edi
+  800fb0:	56                   	push   %esi
+  800fb1:	53                   	push   %ebx
+  800fb2:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800fb5:	6a 44                	push   $0x44
+  800fb7:	ff 75 0c             	push   0xc(%ebp)
+  800fba:	e8 7a fc ff ff       	call   800c39 <touch_mem>
+	asm volatile("int %1\n"
+  800fbf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc7:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fcc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcf:	89 df                	mov    %ebx,%edi
+  800fd1:	89 de                	mov    %ebx,%esi
+  800fd3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd5:	83 c4 08             	add    $0x8,%esp
+  800fd8:	85 c0                	test   %eax,%eax
+  800fda:	7f 08                	jg     800fe4 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdf:	5b                   	pop    %ebx
+  800fe0:	5e                   	pop    %esi
+  800fe1:	5f                   	pop    %edi
+  800fe2:	5d                   	pop    %ebp
+  800fe3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe4:	83 ec 0c             	sub    $0xc,%esp
+  800fe7:	50                   	push   %eax
+  800fe8:	6a 09                	push   $0x9
+  800fea:	68 4b 51 80 00       	push   $0x80514b
+  800fef:	6a 23                	push   $0x23
+  800ff1:	68 68 51 80 00       	push   $0x805168
+  800ff6:	e8 7c f1 ff ff       	call   800177 <_panic>
+
+00800ffb <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800ffb:	55                   	push   %ebp
+  800ffc:	89 e5                	mov    %esp,%ebp
+  800ffe:	57                   	push   %edi
+  800fff:	56                   	push   %esi
+  801000:	53                   	push   %ebx
+  801001:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801004:	be 00 00 00 00       	mov    $0x0,%esi
+  801009:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801014:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801017:	89 f7                	mov    %esi,%edi
+  801019:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80101b:	85 c0                	test   %eax,%eax
+  80101d:	7f 08                	jg     801027 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  80101f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801022:	5b                   	pop    %ebx
+  801023:	5e                   	pop    %esi
+  801024:	5f                   	pop    %edi
+  801025:	5d                   	pop    %ebp
+  801026:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801027:	83 ec 0c             	sub    $0xc,%esp
+  80102a:	50                   	push   %eax
+  80102b:	6a 1a                	push   $0x1a
+  80102d:	68 4b 51 80 00       	push   $0x80514b
+  801032:	6a 23                	push   $0x23
+  801034:	68 68 51 80 00       	push   $0x805168
+  801039:	e8 39 f1 ff ff       	call   800177 <_panic>
+
+0080103e <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  80103e:	55                   	push   %ebp
+  80103f:	89 e5                	mov    %esp,%ebp
+  801041:	57                   	push   %edi
+  801042:	56                   	push   %esi
+  801043:	53                   	push   %ebx
+  801044:	83 ec 0c             	sub    $0xc,%esp
+  801047:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  80104a:	89 d8                	mov    %ebx,%eax
+  80104c:	c1 e0 05             	shl    $0x5,%eax
+  80104f:	50                   	push   %eax
+  801050:	ff 75 0c             	push   0xc(%ebp)
+  801053:	e8 e1 fb ff ff       	call   800c39 <touch_mem>
+	asm volatile("int %1\n"
+  801058:	be 00 00 00 00       	mov    $0x0,%esi
+  80105d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801060:	b8 13 00 00 00       	mov    $0x13,%eax
+  801065:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801068:	89 f7                	mov    %esi,%edi
+  80106a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80106c:	83 c4 08             	add    $0x8,%esp
+  80106f:	85 c0                	test   %eax,%eax
+  801071:	7f 08                	jg     80107b <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  801073:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801076:	5b                   	pop    %ebx
+  801077:	5e                   	pop    %esi
+  801078:	5f                   	pop    %edi
+  801079:	5d                   	pop    %ebp
+  80107a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107b:	83 ec 0c             	sub    $0xc,%esp
+  80107e:	50                   	push   %eax
+  80107f:	6a 13                	push   $0x13
+  801081:	68 4b 51 80 00       	push   $0x80514b
+  801086:	6a 23                	push   $0x23
+  801088:	68 68 51 80 00       	push   $0x805168
+  80108d:	e8 e5 f0 ff ff       	call   800177 <_panic>
+
+00801092 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801092:	55                   	push   %ebp
+  801093:	89 e5                	mov    %esp,%ebp
+  801095:	57                   	push   %edi
+  801096:	56                   	push   %esi
+  801097:	53                   	push   %ebx
+  801098:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80109b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010ab:	89 df                	mov    %ebx,%edi
+  8010ad:	89 de                	mov    %ebx,%esi
+  8010af:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010b1:	85 c0                	test   %eax,%eax
+  8010b3:	7f 08                	jg     8010bd <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b8:	5b                   	pop    %ebx
+  8010b9:	5e                   	pop    %esi
+  8010ba:	5f                   	pop    %edi
+  8010bb:	5d                   	pop    %ebp
+  8010bc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010bd:	83 ec 0c             	sub    $0xc,%esp
+  8010c0:	50                   	push   %eax
+  8010c1:	6a 0a                	push   $0xa
+  8010c3:	68 4b 51 80 00       	push   $0x80514b
+  8010c8:	6a 23                	push   $0x23
+  8010ca:	68 68 51 80 00       	push   $0x805168
+  8010cf:	e8 a3 f0 ff ff       	call   800177 <_panic>
+
+008010d4 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010d4:	55                   	push   %ebp
+  8010d5:	89 e5                	mov    %esp,%ebp
+  8010d7:	57                   	push   %edi
+  8010d8:	56                   	push   %esi
+  8010d9:	53                   	push   %ebx
+  8010da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  8010dd:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010e3:	76 1d                	jbe    801102 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  8010e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010f0:	be 01 00 00 00       	mov    $0x1,%esi
+  8010f5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010f8:	cd 30                	int    $0x30
+}
+  8010fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010fd:	5b                   	pop    %ebx
+  8010fe:	5e                   	pop    %esi
+  8010ff:	5f                   	pop    %edi
+  801100:	5d                   	pop    %ebp
+  801101:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801102:	68 00 10 00 00       	push   $0x1000
+  801107:	53                   	push   %ebx
+  801108:	e8 2c fb ff ff       	call   800c39 <touch_mem>
+  80110d:	83 c4 08             	add    $0x8,%esp
+  801110:	eb d3                	jmp    8010e5 <sys_ipc_send+0x11>
+
+00801112 <sys_ipc_send_pages>:
+{
+  801112:	55                   	push   %ebp
+  801113:	89 e5                	mov    %esp,%ebp
+  801115:	57                   	push   %edi
+  801116:	56                   	push   %esi
+  801117:	53                   	push   %ebx
+  801118:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80111b:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  80111e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801124:	76 18                	jbe    80113e <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  801126:	8b 55 08             	mov    0x8(%ebp),%edx
+  801129:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801131:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801134:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  801136:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801139:	5b                   	pop    %ebx
+  80113a:	5e                   	pop    %esi
+  80113b:	5f                   	pop    %edi
+  80113c:	5d                   	pop    %ebp
+  80113d:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80113e:	89 f0                	mov    %esi,%eax
+  801140:	c1 e0 0c             	shl    $0xc,%eax
+  801143:	50                   	push   %eax
+  801144:	53                   	push   %ebx
+  801145:	e8 ef fa ff ff       	call   800c39 <touch_mem>
+  80114a:	83 c4 08             	add    $0x8,%esp
+  80114d:	eb d7                	jmp    801126 <sys_ipc_send_pages+0x14>
+
+0080114f <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  80114f:	55                   	push   %ebp
+  801150:	89 e5                	mov    %esp,%ebp
+  801152:	57                   	push   %edi
+  801153:	56                   	push   %esi
+  801154:	53                   	push   %ebx
+  801155:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801158:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801160:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801163:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801168:	89 df                	mov    %ebx,%edi
+  80116a:	89 de                	mov    %ebx,%esi
+  80116c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80116e:	85 c0                	test   %eax,%eax
+  801170:	7f 08                	jg     80117a <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801172:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801175:	5b                   	pop    %ebx
+  801176:	5e                   	pop    %esi
+  801177:	5f                   	pop    %edi
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80117a:	83 ec 0c             	sub    $0xc,%esp
+  80117d:	50                   	push   %eax
+  80117e:	6a 0d                	push   $0xd
+  801180:	68 4b 51 80 00       	push   $0x80514b
+  801185:	6a 23                	push   $0x23
+  801187:	68 68 51 80 00       	push   $0x805168
+  80118c:	e8 e6 ef ff ff       	call   800177 <_panic>
+
+00801191 <sys_ipc_recv>:
+{
+  801191:	55                   	push   %ebp
+  801192:	89 e5                	mov    %esp,%ebp
+  801194:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801197:	6a 01                	push   $0x1
+  801199:	ff 75 08             	push   0x8(%ebp)
+  80119c:	e8 ae ff ff ff       	call   80114f <sys_ipc_recv_pages>
+}
+  8011a1:	c9                   	leave
+  8011a2:	c3                   	ret
+
+008011a3 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8011a3:	55                   	push   %ebp
+  8011a4:	89 e5                	mov    %esp,%ebp
+  8011a6:	57                   	push   %edi
+  8011a7:	56                   	push   %esi
+  8011a8:	53                   	push   %ebx
+  8011a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ac:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011af:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  8011b2:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011b8:	77 04                	ja     8011be <sys_ipc_call+0x1b>
+  8011ba:	85 f6                	test   %esi,%esi
+  8011bc:	75 15                	jne    8011d3 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8011be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c4:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011c9:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8011cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ce:	5b                   	pop    %ebx
+  8011cf:	5e                   	pop    %esi
+  8011d0:	5f                   	pop    %edi
+  8011d1:	5d                   	pop    %ebp
+  8011d2:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8011d3:	89 f8                	mov    %edi,%eax
+  8011d5:	c1 e0 0c             	shl    $0xc,%eax
+  8011d8:	50                   	push   %eax
+  8011d9:	53                   	push   %ebx
+  8011da:	e8 5a fa ff ff       	call   800c39 <touch_mem>
+  8011df:	83 c4 08             	add    $0x8,%esp
+  8011e2:	eb da                	jmp    8011be <sys_ipc_call+0x1b>
+
+008011e4 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8011e4:	55                   	push   %ebp
+  8011e5:	89 e5                	mov    %esp,%ebp
+  8011e7:	57                   	push   %edi
+  8011e8:	56                   	push   %esi
+  8011e9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f0:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011f8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011fb:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011fe:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801200:	5b                   	pop    %ebx
+  801201:	5e                   	pop    %esi
+  801202:	5f                   	pop    %edi
+  801203:	5d                   	pop    %ebp
+  801204:	c3                   	ret
+
+00801205 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  801205:	55                   	push   %ebp
+  801206:	89 e5                	mov    %esp,%ebp
+  801208:	57                   	push   %edi
+  801209:	56                   	push   %esi
+  80120a:	53                   	push   %ebx
+  80120b:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  80120e:	6a 04                	push   $0x4
+  801210:	ff 75 08             	push   0x8(%ebp)
+  801213:	e8 21 fa ff ff       	call   800c39 <touch_mem>
+	asm volatile("int %1\n"
+  801218:	be 00 00 00 00       	mov    $0x0,%esi
+  80121d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801220:	b8 16 00 00 00       	mov    $0x16,%eax
+  801225:	8b 55 08             	mov    0x8(%ebp),%edx
+  801228:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80122b:	89 f7                	mov    %esi,%edi
+  80122d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80122f:	83 c4 08             	add    $0x8,%esp
+  801232:	85 c0                	test   %eax,%eax
+  801234:	7f 08                	jg     80123e <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  801236:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801239:	5b                   	pop    %ebx
+  80123a:	5e                   	pop    %esi
+  80123b:	5f                   	pop    %edi
+  80123c:	5d                   	pop    %ebp
+  80123d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80123e:	83 ec 0c             	sub    $0xc,%esp
+  801241:	50                   	push   %eax
+  801242:	6a 16                	push   $0x16
+  801244:	68 4b 51 80 00       	push   $0x80514b
+  801249:	6a 23                	push   $0x23
+  80124b:	68 68 51 80 00       	push   $0x805168
+  801250:	e8 22 ef ff ff       	call   800177 <_panic>
+
+00801255 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801255:	55                   	push   %ebp
+  801256:	89 e5                	mov    %esp,%ebp
+  801258:	57                   	push   %edi
+  801259:	56                   	push   %esi
+  80125a:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  80125b:	6a 04                	push   $0x4
+  80125d:	ff 75 08             	push   0x8(%ebp)
+  801260:	e8 d4 f9 ff ff       	call   800c39 <touch_mem>
+	asm volatile("int %1\n"
+  801265:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126d:	b8 17 00 00 00       	mov    $0x17,%eax
+  801272:	8b 55 08             	mov    0x8(%ebp),%edx
+  801275:	89 df                	mov    %ebx,%edi
+  801277:	89 de                	mov    %ebx,%esi
+  801279:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80127b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80127e:	5b                   	pop    %ebx
+  80127f:	5e                   	pop    %esi
+  801280:	5f                   	pop    %edi
+  801281:	5d                   	pop    %ebp
+  801282:	c3                   	ret
+
+00801283 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  801283:	55                   	push   %ebp
+  801284:	89 e5                	mov    %esp,%ebp
+  801286:	57                   	push   %edi
+  801287:	56                   	push   %esi
+  801288:	53                   	push   %ebx
+  801289:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80128c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801291:	8b 55 08             	mov    0x8(%ebp),%edx
+  801294:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801299:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80129e:	89 df                	mov    %ebx,%edi
+  8012a0:	89 de                	mov    %ebx,%esi
+  8012a2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012a4:	85 c0                	test   %eax,%eax
+  8012a6:	7f 08                	jg     8012b0 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  8012a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ab:	5b                   	pop    %ebx
+  8012ac:	5e                   	pop    %esi
+  8012ad:	5f                   	pop    %edi
+  8012ae:	5d                   	pop    %ebp
+  8012af:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012b0:	83 ec 0c             	sub    $0xc,%esp
+  8012b3:	50                   	push   %eax
+  8012b4:	6a 0e                	push   $0xe
+  8012b6:	68 4b 51 80 00       	push   $0x80514b
+  8012bb:	6a 23                	push   $0x23
+  8012bd:	68 68 51 80 00       	push   $0x805168
+  8012c2:	e8 b0 ee ff ff       	call   800177 <_panic>
+
+008012c7 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8012c7:	55                   	push   %ebp
+  8012c8:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012cd:	05 00 00 00 30       	add    $0x30000000,%eax
+  8012d2:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012d5:	5d                   	pop    %ebp
+  8012d6:	c3                   	ret
+
+008012d7 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012d7:	55                   	push   %ebp
+  8012d8:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012dd:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8012e2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8012e7:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8012ec:	5d                   	pop    %ebp
+  8012ed:	c3                   	ret
+
+008012ee <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8012ee:	55                   	push   %ebp
+  8012ef:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8012f1:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8012f6:	a8 01                	test   $0x1,%al
+  8012f8:	74 3c                	je     801336 <fd_alloc+0x48>
+  8012fa:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8012ff:	89 c2                	mov    %eax,%edx
+  801301:	c1 ea 0c             	shr    $0xc,%edx
+  801304:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80130b:	89 c1                	mov    %eax,%ecx
+  80130d:	05 00 10 00 00       	add    $0x1000,%eax
+  801312:	f6 c2 01             	test   $0x1,%dl
+  801315:	74 13                	je     80132a <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801317:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80131c:	75 e1                	jne    8012ff <fd_alloc+0x11>
+  80131e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801323:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801328:	eb 05                	jmp    80132f <fd_alloc+0x41>
+			return 0;
+  80132a:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  80132f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801332:	89 0a                	mov    %ecx,(%edx)
+}
+  801334:	5d                   	pop    %ebp
+  801335:	c3                   	ret
+  801336:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  80133b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801340:	eb ed                	jmp    80132f <fd_alloc+0x41>
+
+00801342 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801342:	55                   	push   %ebp
+  801343:	89 e5                	mov    %esp,%ebp
+  801345:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801348:	83 f8 1f             	cmp    $0x1f,%eax
+  80134b:	77 30                	ja     80137d <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80134d:	c1 e0 0c             	shl    $0xc,%eax
+  801350:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801355:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80135b:	f6 c2 01             	test   $0x1,%dl
+  80135e:	74 24                	je     801384 <fd_lookup+0x42>
+  801360:	89 c2                	mov    %eax,%edx
+  801362:	c1 ea 0c             	shr    $0xc,%edx
+  801365:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80136c:	f6 c2 01             	test   $0x1,%dl
+  80136f:	74 1a                	je     80138b <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801371:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801374:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801376:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80137b:	5d                   	pop    %ebp
+  80137c:	c3                   	ret
+		return -E_INVAL;
+  80137d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801382:	eb f7                	jmp    80137b <fd_lookup+0x39>
+		return -E_INVAL;
+  801384:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801389:	eb f0                	jmp    80137b <fd_lookup+0x39>
+  80138b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801390:	eb e9                	jmp    80137b <fd_lookup+0x39>
+
+00801392 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801392:	55                   	push   %ebp
+  801393:	89 e5                	mov    %esp,%ebp
+  801395:	53                   	push   %ebx
+  801396:	83 ec 04             	sub    $0x4,%esp
+  801399:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80139c:	b8 f4 51 80 00       	mov    $0x8051f4,%eax
+  8013a1:	8b 18                	mov    (%eax),%ebx
+  8013a3:	85 db                	test   %ebx,%ebx
+  8013a5:	74 0e                	je     8013b5 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  8013a7:	83 c0 04             	add    $0x4,%eax
+  8013aa:	39 13                	cmp    %edx,(%ebx)
+  8013ac:	75 f3                	jne    8013a1 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  8013ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b3:	eb 1f                	jmp    8013d4 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013b5:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8013ba:	8b 40 48             	mov    0x48(%eax),%eax
+  8013bd:	83 ec 04             	sub    $0x4,%esp
+  8013c0:	52                   	push   %edx
+  8013c1:	50                   	push   %eax
+  8013c2:	68 78 51 80 00       	push   $0x805178
+  8013c7:	e8 86 ee ff ff       	call   800252 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8013cc:	83 c4 10             	add    $0x10,%esp
+  8013cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8013d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013d7:	89 1a                	mov    %ebx,(%edx)
+}
+  8013d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013dc:	c9                   	leave
+  8013dd:	c3                   	ret
+
+008013de <fd_close>:
+{
+  8013de:	55                   	push   %ebp
+  8013df:	89 e5                	mov    %esp,%ebp
+  8013e1:	57                   	push   %edi
+  8013e2:	56                   	push   %esi
+  8013e3:	53                   	push   %ebx
+  8013e4:	83 ec 24             	sub    $0x24,%esp
+  8013e7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013ea:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013ed:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013f0:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013f1:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8013f7:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013fa:	50                   	push   %eax
+  8013fb:	e8 42 ff ff ff       	call   801342 <fd_lookup>
+  801400:	89 c3                	mov    %eax,%ebx
+  801402:	83 c4 10             	add    $0x10,%esp
+  801405:	85 c0                	test   %eax,%eax
+  801407:	78 05                	js     80140e <fd_close+0x30>
+	    || fd != fd2)
+  801409:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80140c:	74 16                	je     801424 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80140e:	89 f8                	mov    %edi,%eax
+  801410:	84 c0                	test   %al,%al
+  801412:	b8 00 00 00 00       	mov    $0x0,%eax
+  801417:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80141a:	89 d8                	mov    %ebx,%eax
+  80141c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141f:	5b                   	pop    %ebx
+  801420:	5e                   	pop    %esi
+  801421:	5f                   	pop    %edi
+  801422:	5d                   	pop    %ebp
+  801423:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801424:	83 ec 08             	sub    $0x8,%esp
+  801427:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80142a:	50                   	push   %eax
+  80142b:	ff 36                	push   (%esi)
+  80142d:	e8 60 ff ff ff       	call   801392 <dev_lookup>
+  801432:	89 c3                	mov    %eax,%ebx
+  801434:	83 c4 10             	add    $0x10,%esp
+  801437:	85 c0                	test   %eax,%eax
+  801439:	78 1a                	js     801455 <fd_close+0x77>
+		if (dev->dev_close)
+  80143b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80143e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801441:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801446:	85 c0                	test   %eax,%eax
+  801448:	74 0b                	je     801455 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80144a:	83 ec 0c             	sub    $0xc,%esp
+  80144d:	56                   	push   %esi
+  80144e:	ff d0                	call   *%eax
+  801450:	89 c3                	mov    %eax,%ebx
+  801452:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801455:	83 ec 08             	sub    $0x8,%esp
+  801458:	56                   	push   %esi
+  801459:	6a 00                	push   $0x0
+  80145b:	e8 51 f9 ff ff       	call   800db1 <sys_page_unmap>
+	return r;
+  801460:	83 c4 10             	add    $0x10,%esp
+  801463:	eb b5                	jmp    80141a <fd_close+0x3c>
+
+00801465 <close>:
+
+int
+close(int fdnum)
+{
+  801465:	55                   	push   %ebp
+  801466:	89 e5                	mov    %esp,%ebp
+  801468:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80146b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80146e:	50                   	push   %eax
+  80146f:	ff 75 08             	push   0x8(%ebp)
+  801472:	e8 cb fe ff ff       	call   801342 <fd_lookup>
+  801477:	83 c4 10             	add    $0x10,%esp
+  80147a:	85 c0                	test   %eax,%eax
+  80147c:	79 02                	jns    801480 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80147e:	c9                   	leave
+  80147f:	c3                   	ret
+		return fd_close(fd, 1);
+  801480:	83 ec 08             	sub    $0x8,%esp
+  801483:	6a 01                	push   $0x1
+  801485:	ff 75 f4             	push   -0xc(%ebp)
+  801488:	e8 51 ff ff ff       	call   8013de <fd_close>
+  80148d:	83 c4 10             	add    $0x10,%esp
+  801490:	eb ec                	jmp    80147e <close+0x19>
+
+00801492 <close_all>:
+
+void
+close_all(void)
+{
+  801492:	55                   	push   %ebp
+  801493:	89 e5                	mov    %esp,%ebp
+  801495:	53                   	push   %ebx
+  801496:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801499:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80149e:	83 ec 0c             	sub    $0xc,%esp
+  8014a1:	53                   	push   %ebx
+  8014a2:	e8 be ff ff ff       	call   801465 <close>
+	for (i = 0; i < MAXFD; i++)
+  8014a7:	83 c3 01             	add    $0x1,%ebx
+  8014aa:	83 c4 10             	add    $0x10,%esp
+  8014ad:	83 fb 20             	cmp    $0x20,%ebx
+  8014b0:	75 ec                	jne    80149e <close_all+0xc>
+}
+  8014b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014b5:	c9                   	leave
+  8014b6:	c3                   	ret
+
+008014b7 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014b7:	55                   	push   %ebp
+  8014b8:	89 e5                	mov    %esp,%ebp
+  8014ba:	57                   	push   %edi
+  8014bb:	56                   	push   %esi
+  8014bc:	53                   	push   %ebx
+  8014bd:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8014c0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014c3:	50                   	push   %eax
+  8014c4:	ff 75 08             	push   0x8(%ebp)
+  8014c7:	e8 76 fe ff ff       	call   801342 <fd_lookup>
+  8014cc:	89 c3                	mov    %eax,%ebx
+  8014ce:	83 c4 10             	add    $0x10,%esp
+  8014d1:	85 c0                	test   %eax,%eax
+  8014d3:	78 7f                	js     801554 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8014d5:	83 ec 0c             	sub    $0xc,%esp
+  8014d8:	ff 75 0c             	push   0xc(%ebp)
+  8014db:	e8 85 ff ff ff       	call   801465 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8014e0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014e3:	c1 e6 0c             	shl    $0xc,%esi
+  8014e6:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8014ec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014ef:	89 3c 24             	mov    %edi,(%esp)
+  8014f2:	e8 e0 fd ff ff       	call   8012d7 <fd2data>
+  8014f7:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8014f9:	89 34 24             	mov    %esi,(%esp)
+  8014fc:	e8 d6 fd ff ff       	call   8012d7 <fd2data>
+  801501:	83 c4 10             	add    $0x10,%esp
+  801504:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801507:	89 d8                	mov    %ebx,%eax
+  801509:	c1 e8 16             	shr    $0x16,%eax
+  80150c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801513:	a8 01                	test   $0x1,%al
+  801515:	74 11                	je     801528 <dup+0x71>
+  801517:	89 d8                	mov    %ebx,%eax
+  801519:	c1 e8 0c             	shr    $0xc,%eax
+  80151c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801523:	f6 c2 01             	test   $0x1,%dl
+  801526:	75 36                	jne    80155e <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801528:	89 f8                	mov    %edi,%eax
+  80152a:	c1 e8 0c             	shr    $0xc,%eax
+  80152d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801534:	83 ec 0c             	sub    $0xc,%esp
+  801537:	25 07 0e 00 00       	and    $0xe07,%eax
+  80153c:	50                   	push   %eax
+  80153d:	56                   	push   %esi
+  80153e:	6a 00                	push   $0x0
+  801540:	57                   	push   %edi
+  801541:	6a 00                	push   $0x0
+  801543:	e8 27 f8 ff ff       	call   800d6f <sys_page_map>
+  801548:	89 c3                	mov    %eax,%ebx
+  80154a:	83 c4 20             	add    $0x20,%esp
+  80154d:	85 c0                	test   %eax,%eax
+  80154f:	78 33                	js     801584 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801551:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801554:	89 d8                	mov    %ebx,%eax
+  801556:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801559:	5b                   	pop    %ebx
+  80155a:	5e                   	pop    %esi
+  80155b:	5f                   	pop    %edi
+  80155c:	5d                   	pop    %ebp
+  80155d:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80155e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801565:	83 ec 0c             	sub    $0xc,%esp
+  801568:	25 07 0e 00 00       	and    $0xe07,%eax
+  80156d:	50                   	push   %eax
+  80156e:	ff 75 d4             	push   -0x2c(%ebp)
+  801571:	6a 00                	push   $0x0
+  801573:	53                   	push   %ebx
+  801574:	6a 00                	push   $0x0
+  801576:	e8 f4 f7 ff ff       	call   800d6f <sys_page_map>
+  80157b:	89 c3                	mov    %eax,%ebx
+  80157d:	83 c4 20             	add    $0x20,%esp
+  801580:	85 c0                	test   %eax,%eax
+  801582:	79 a4                	jns    801528 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801584:	83 ec 08             	sub    $0x8,%esp
+  801587:	56                   	push   %esi
+  801588:	6a 00                	push   $0x0
+  80158a:	e8 22 f8 ff ff       	call   800db1 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80158f:	83 c4 08             	add    $0x8,%esp
+  801592:	ff 75 d4             	push   -0x2c(%ebp)
+  801595:	6a 00                	push   $0x0
+  801597:	e8 15 f8 ff ff       	call   800db1 <sys_page_unmap>
+	return r;
+  80159c:	83 c4 10             	add    $0x10,%esp
+  80159f:	eb b3                	jmp    801554 <dup+0x9d>
+
+008015a1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015a1:	55                   	push   %ebp
+  8015a2:	89 e5                	mov    %esp,%ebp
+  8015a4:	56                   	push   %esi
+  8015a5:	53                   	push   %ebx
+  8015a6:	83 ec 18             	sub    $0x18,%esp
+  8015a9:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015ac:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015af:	50                   	push   %eax
+  8015b0:	56                   	push   %esi
+  8015b1:	e8 8c fd ff ff       	call   801342 <fd_lookup>
+  8015b6:	83 c4 10             	add    $0x10,%esp
+  8015b9:	85 c0                	test   %eax,%eax
+  8015bb:	78 3c                	js     8015f9 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015bd:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8015c0:	83 ec 08             	sub    $0x8,%esp
+  8015c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015c6:	50                   	push   %eax
+  8015c7:	ff 33                	push   (%ebx)
+  8015c9:	e8 c4 fd ff ff       	call   801392 <dev_lookup>
+  8015ce:	83 c4 10             	add    $0x10,%esp
+  8015d1:	85 c0                	test   %eax,%eax
+  8015d3:	78 24                	js     8015f9 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8015d5:	8b 43 08             	mov    0x8(%ebx),%eax
+  8015d8:	83 e0 03             	and    $0x3,%eax
+  8015db:	83 f8 01             	cmp    $0x1,%eax
+  8015de:	74 20                	je     801600 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8015e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015e3:	8b 40 08             	mov    0x8(%eax),%eax
+  8015e6:	85 c0                	test   %eax,%eax
+  8015e8:	74 37                	je     801621 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8015ea:	83 ec 04             	sub    $0x4,%esp
+  8015ed:	ff 75 10             	push   0x10(%ebp)
+  8015f0:	ff 75 0c             	push   0xc(%ebp)
+  8015f3:	53                   	push   %ebx
+  8015f4:	ff d0                	call   *%eax
+  8015f6:	83 c4 10             	add    $0x10,%esp
+}
+  8015f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015fc:	5b                   	pop    %ebx
+  8015fd:	5e                   	pop    %esi
+  8015fe:	5d                   	pop    %ebp
+  8015ff:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801600:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801605:	8b 40 48             	mov    0x48(%eax),%eax
+  801608:	83 ec 04             	sub    $0x4,%esp
+  80160b:	56                   	push   %esi
+  80160c:	50                   	push   %eax
+  80160d:	68 b9 51 80 00       	push   $0x8051b9
+  801612:	e8 3b ec ff ff       	call   800252 <cprintf>
+		return -E_INVAL;
+  801617:	83 c4 10             	add    $0x10,%esp
+  80161a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80161f:	eb d8                	jmp    8015f9 <read+0x58>
+		return -E_NOT_SUPP;
+  801621:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801626:	eb d1                	jmp    8015f9 <read+0x58>
+
+00801628 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801628:	55                   	push   %ebp
+  801629:	89 e5                	mov    %esp,%ebp
+  80162b:	57                   	push   %edi
+  80162c:	56                   	push   %esi
+  80162d:	53                   	push   %ebx
+  80162e:	83 ec 0c             	sub    $0xc,%esp
+  801631:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801634:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801637:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163c:	eb 02                	jmp    801640 <readn+0x18>
+  80163e:	01 c3                	add    %eax,%ebx
+  801640:	39 f3                	cmp    %esi,%ebx
+  801642:	73 21                	jae    801665 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801644:	83 ec 04             	sub    $0x4,%esp
+  801647:	89 f0                	mov    %esi,%eax
+  801649:	29 d8                	sub    %ebx,%eax
+  80164b:	50                   	push   %eax
+  80164c:	89 d8                	mov    %ebx,%eax
+  80164e:	03 45 0c             	add    0xc(%ebp),%eax
+  801651:	50                   	push   %eax
+  801652:	57                   	push   %edi
+  801653:	e8 49 ff ff ff       	call   8015a1 <read>
+		if (m < 0)
+  801658:	83 c4 10             	add    $0x10,%esp
+  80165b:	85 c0                	test   %eax,%eax
+  80165d:	78 04                	js     801663 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80165f:	75 dd                	jne    80163e <readn+0x16>
+  801661:	eb 02                	jmp    801665 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801663:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801665:	89 d8                	mov    %ebx,%eax
+  801667:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80166a:	5b                   	pop    %ebx
+  80166b:	5e                   	pop    %esi
+  80166c:	5f                   	pop    %edi
+  80166d:	5d                   	pop    %ebp
+  80166e:	c3                   	ret
+
+0080166f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80166f:	55                   	push   %ebp
+  801670:	89 e5                	mov    %esp,%ebp
+  801672:	56                   	push   %esi
+  801673:	53                   	push   %ebx
+  801674:	83 ec 18             	sub    $0x18,%esp
+  801677:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80167a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80167d:	50                   	push   %eax
+  80167e:	53                   	push   %ebx
+  80167f:	e8 be fc ff ff       	call   801342 <fd_lookup>
+  801684:	83 c4 10             	add    $0x10,%esp
+  801687:	85 c0                	test   %eax,%eax
+  801689:	78 37                	js     8016c2 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80168b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80168e:	83 ec 08             	sub    $0x8,%esp
+  801691:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801694:	50                   	push   %eax
+  801695:	ff 36                	push   (%esi)
+  801697:	e8 f6 fc ff ff       	call   801392 <dev_lookup>
+  80169c:	83 c4 10             	add    $0x10,%esp
+  80169f:	85 c0                	test   %eax,%eax
+  8016a1:	78 1f                	js     8016c2 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016a3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016a7:	74 20                	je     8016c9 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8016a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ac:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016af:	85 c0                	test   %eax,%eax
+  8016b1:	74 37                	je     8016ea <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8016b3:	83 ec 04             	sub    $0x4,%esp
+  8016b6:	ff 75 10             	push   0x10(%ebp)
+  8016b9:	ff 75 0c             	push   0xc(%ebp)
+  8016bc:	56                   	push   %esi
+  8016bd:	ff d0                	call   *%eax
+  8016bf:	83 c4 10             	add    $0x10,%esp
+}
+  8016c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016c5:	5b                   	pop    %ebx
+  8016c6:	5e                   	pop    %esi
+  8016c7:	5d                   	pop    %ebp
+  8016c8:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016c9:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8016ce:	8b 40 48             	mov    0x48(%eax),%eax
+  8016d1:	83 ec 04             	sub    $0x4,%esp
+  8016d4:	53                   	push   %ebx
+  8016d5:	50                   	push   %eax
+  8016d6:	68 d5 51 80 00       	push   $0x8051d5
+  8016db:	e8 72 eb ff ff       	call   800252 <cprintf>
+		return -E_INVAL;
+  8016e0:	83 c4 10             	add    $0x10,%esp
+  8016e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e8:	eb d8                	jmp    8016c2 <write+0x53>
+		return -E_NOT_SUPP;
+  8016ea:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016ef:	eb d1                	jmp    8016c2 <write+0x53>
+
+008016f1 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016f1:	55                   	push   %ebp
+  8016f2:	89 e5                	mov    %esp,%ebp
+  8016f4:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016fa:	50                   	push   %eax
+  8016fb:	ff 75 08             	push   0x8(%ebp)
+  8016fe:	e8 3f fc ff ff       	call   801342 <fd_lookup>
+  801703:	83 c4 10             	add    $0x10,%esp
+  801706:	85 c0                	test   %eax,%eax
+  801708:	78 0e                	js     801718 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80170a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80170d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801710:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801713:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801718:	c9                   	leave
+  801719:	c3                   	ret
+
+0080171a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80171a:	55                   	push   %ebp
+  80171b:	89 e5                	mov    %esp,%ebp
+  80171d:	56                   	push   %esi
+  80171e:	53                   	push   %ebx
+  80171f:	83 ec 18             	sub    $0x18,%esp
+  801722:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801725:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801728:	50                   	push   %eax
+  801729:	53                   	push   %ebx
+  80172a:	e8 13 fc ff ff       	call   801342 <fd_lookup>
+  80172f:	83 c4 10             	add    $0x10,%esp
+  801732:	85 c0                	test   %eax,%eax
+  801734:	78 34                	js     80176a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801736:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801739:	83 ec 08             	sub    $0x8,%esp
+  80173c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80173f:	50                   	push   %eax
+  801740:	ff 36                	push   (%esi)
+  801742:	e8 4b fc ff ff       	call   801392 <dev_lookup>
+  801747:	83 c4 10             	add    $0x10,%esp
+  80174a:	85 c0                	test   %eax,%eax
+  80174c:	78 1c                	js     80176a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80174e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801752:	74 1d                	je     801771 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801754:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801757:	8b 40 18             	mov    0x18(%eax),%eax
+  80175a:	85 c0                	test   %eax,%eax
+  80175c:	74 34                	je     801792 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80175e:	83 ec 08             	sub    $0x8,%esp
+  801761:	ff 75 0c             	push   0xc(%ebp)
+  801764:	56                   	push   %esi
+  801765:	ff d0                	call   *%eax
+  801767:	83 c4 10             	add    $0x10,%esp
+}
+  80176a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80176d:	5b                   	pop    %ebx
+  80176e:	5e                   	pop    %esi
+  80176f:	5d                   	pop    %ebp
+  801770:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801771:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801776:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801779:	83 ec 04             	sub    $0x4,%esp
+  80177c:	53                   	push   %ebx
+  80177d:	50                   	push   %eax
+  80177e:	68 98 51 80 00       	push   $0x805198
+  801783:	e8 ca ea ff ff       	call   800252 <cprintf>
+		return -E_INVAL;
+  801788:	83 c4 10             	add    $0x10,%esp
+  80178b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801790:	eb d8                	jmp    80176a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801792:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801797:	eb d1                	jmp    80176a <ftruncate+0x50>
+
+00801799 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801799:	55                   	push   %ebp
+  80179a:	89 e5                	mov    %esp,%ebp
+  80179c:	56                   	push   %esi
+  80179d:	53                   	push   %ebx
+  80179e:	83 ec 18             	sub    $0x18,%esp
+  8017a1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017a4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017a7:	50                   	push   %eax
+  8017a8:	ff 75 08             	push   0x8(%ebp)
+  8017ab:	e8 92 fb ff ff       	call   801342 <fd_lookup>
+  8017b0:	83 c4 10             	add    $0x10,%esp
+  8017b3:	85 c0                	test   %eax,%eax
+  8017b5:	78 49                	js     801800 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017b7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017ba:	83 ec 08             	sub    $0x8,%esp
+  8017bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017c0:	50                   	push   %eax
+  8017c1:	ff 36                	push   (%esi)
+  8017c3:	e8 ca fb ff ff       	call   801392 <dev_lookup>
+  8017c8:	83 c4 10             	add    $0x10,%esp
+  8017cb:	85 c0                	test   %eax,%eax
+  8017cd:	78 31                	js     801800 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8017cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017d2:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8017d6:	74 2f                	je     801807 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8017d8:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8017db:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8017e2:	00 00 00 
+	stat->st_isdir = 0;
+  8017e5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8017ec:	00 00 00 
+	stat->st_dev = dev;
+  8017ef:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8017f5:	83 ec 08             	sub    $0x8,%esp
+  8017f8:	53                   	push   %ebx
+  8017f9:	56                   	push   %esi
+  8017fa:	ff 50 14             	call   *0x14(%eax)
+  8017fd:	83 c4 10             	add    $0x10,%esp
+}
+  801800:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801803:	5b                   	pop    %ebx
+  801804:	5e                   	pop    %esi
+  801805:	5d                   	pop    %ebp
+  801806:	c3                   	ret
+		return -E_NOT_SUPP;
+  801807:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80180c:	eb f2                	jmp    801800 <fstat+0x67>
+
+0080180e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80180e:	55                   	push   %ebp
+  80180f:	89 e5                	mov    %esp,%ebp
+  801811:	56                   	push   %esi
+  801812:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801813:	83 ec 08             	sub    $0x8,%esp
+  801816:	6a 00                	push   $0x0
+  801818:	ff 75 08             	push   0x8(%ebp)
+  80181b:	e8 bc 02 00 00       	call   801adc <open>
+  801820:	89 c3                	mov    %eax,%ebx
+  801822:	83 c4 10             	add    $0x10,%esp
+  801825:	85 c0                	test   %eax,%eax
+  801827:	78 1b                	js     801844 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801829:	83 ec 08             	sub    $0x8,%esp
+  80182c:	ff 75 0c             	push   0xc(%ebp)
+  80182f:	50                   	push   %eax
+  801830:	e8 64 ff ff ff       	call   801799 <fstat>
+  801835:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801837:	89 1c 24             	mov    %ebx,(%esp)
+  80183a:	e8 26 fc ff ff       	call   801465 <close>
+	return r;
+  80183f:	83 c4 10             	add    $0x10,%esp
+  801842:	89 f3                	mov    %esi,%ebx
+}
+  801844:	89 d8                	mov    %ebx,%eax
+  801846:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801849:	5b                   	pop    %ebx
+  80184a:	5e                   	pop    %esi
+  80184b:	5d                   	pop    %ebp
+  80184c:	c3                   	ret
+
+0080184d <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  80184d:	55                   	push   %ebp
+  80184e:	89 e5                	mov    %esp,%ebp
+  801850:	57                   	push   %edi
+  801851:	56                   	push   %esi
+  801852:	53                   	push   %ebx
+  801853:	83 ec 0c             	sub    $0xc,%esp
+  801856:	89 c7                	mov    %eax,%edi
+  801858:	89 d3                	mov    %edx,%ebx
+  80185a:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80185c:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801863:	74 2d                	je     801892 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801865:	6a 07                	push   $0x7
+  801867:	68 00 f0 80 00       	push   $0x80f000
+  80186c:	57                   	push   %edi
+  80186d:	ff 35 00 70 80 00    	push   0x807000
+  801873:	e8 4e 31 00 00       	call   8049c6 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801878:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80187f:	6a 00                	push   $0x0
+  801881:	56                   	push   %esi
+  801882:	53                   	push   %ebx
+  801883:	6a 00                	push   $0x0
+  801885:	e8 ee 2f 00 00       	call   804878 <ipc_recv_pages>
+}
+  80188a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80188d:	5b                   	pop    %ebx
+  80188e:	5e                   	pop    %esi
+  80188f:	5f                   	pop    %edi
+  801890:	5d                   	pop    %ebp
+  801891:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801892:	83 ec 0c             	sub    $0xc,%esp
+  801895:	6a 01                	push   $0x1
+  801897:	e8 1f 32 00 00       	call   804abb <ipc_find_env>
+  80189c:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018a1:	83 c4 10             	add    $0x10,%esp
+  8018a4:	eb bf                	jmp    801865 <fsipc_pages+0x18>
+
+008018a6 <fsipc>:
+{
+  8018a6:	55                   	push   %ebp
+  8018a7:	89 e5                	mov    %esp,%ebp
+  8018a9:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  8018ac:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018b1:	e8 97 ff ff ff       	call   80184d <fsipc_pages>
+}
+  8018b6:	c9                   	leave
+  8018b7:	c3                   	ret
+
+008018b8 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018b8:	55                   	push   %ebp
+  8018b9:	89 e5                	mov    %esp,%ebp
+  8018bb:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018c4:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  8018c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018cc:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8018d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018db:	e8 c6 ff ff ff       	call   8018a6 <fsipc>
+}
+  8018e0:	c9                   	leave
+  8018e1:	c3                   	ret
+
+008018e2 <devfile_flush>:
+{
+  8018e2:	55                   	push   %ebp
+  8018e3:	89 e5                	mov    %esp,%ebp
+  8018e5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8018e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018eb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018ee:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8018f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018fd:	e8 a4 ff ff ff       	call   8018a6 <fsipc>
+}
+  801902:	c9                   	leave
+  801903:	c3                   	ret
+
+00801904 <devfile_stat>:
+{
+  801904:	55                   	push   %ebp
+  801905:	89 e5                	mov    %esp,%ebp
+  801907:	53                   	push   %ebx
+  801908:	83 ec 04             	sub    $0x4,%esp
+  80190b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80190e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801911:	8b 40 0c             	mov    0xc(%eax),%eax
+  801914:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801919:	ba 00 00 00 00       	mov    $0x0,%edx
+  80191e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801923:	e8 7e ff ff ff       	call   8018a6 <fsipc>
+  801928:	85 c0                	test   %eax,%eax
+  80192a:	78 2c                	js     801958 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80192c:	83 ec 08             	sub    $0x8,%esp
+  80192f:	68 00 f0 80 00       	push   $0x80f000
+  801934:	53                   	push   %ebx
+  801935:	e8 ff ee ff ff       	call   800839 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80193a:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  80193f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801945:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  80194a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801950:	83 c4 10             	add    $0x10,%esp
+  801953:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801958:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80195b:	c9                   	leave
+  80195c:	c3                   	ret
+
+0080195d <devfile_write>:
+{
+  80195d:	55                   	push   %ebp
+  80195e:	89 e5                	mov    %esp,%ebp
+  801960:	83 ec 0c             	sub    $0xc,%esp
+  801963:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801966:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80196b:	39 d0                	cmp    %edx,%eax
+  80196d:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801970:	8b 55 08             	mov    0x8(%ebp),%edx
+  801973:	8b 52 0c             	mov    0xc(%edx),%edx
+  801976:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  80197c:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801981:	50                   	push   %eax
+  801982:	ff 75 0c             	push   0xc(%ebp)
+  801985:	68 08 f0 80 00       	push   $0x80f008
+  80198a:	e8 30 f0 ff ff       	call   8009bf <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  80198f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801994:	b8 04 00 00 00       	mov    $0x4,%eax
+  801999:	e8 08 ff ff ff       	call   8018a6 <fsipc>
+}
+  80199e:	c9                   	leave
+  80199f:	c3                   	ret
+
+008019a0 <devfile_read>:
+{
+  8019a0:	55                   	push   %ebp
+  8019a1:	89 e5                	mov    %esp,%ebp
+  8019a3:	57                   	push   %edi
+  8019a4:	56                   	push   %esi
+  8019a5:	53                   	push   %ebx
+  8019a6:	83 ec 1c             	sub    $0x1c,%esp
+  8019a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019ac:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8019af:	89 fe                	mov    %edi,%esi
+  8019b1:	c1 ee 0c             	shr    $0xc,%esi
+  8019b4:	b8 20 00 00 00       	mov    $0x20,%eax
+  8019b9:	39 c6                	cmp    %eax,%esi
+  8019bb:	0f 47 f0             	cmova  %eax,%esi
+  8019be:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019c6:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8019c9:	eb 14                	jmp    8019df <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8019cb:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  8019d2:	05 00 10 00 00       	add    $0x1000,%eax
+  8019d7:	f6 c6 06             	test   $0x6,%dh
+  8019da:	75 42                	jne    801a1e <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8019dc:	83 c1 01             	add    $0x1,%ecx
+  8019df:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8019e2:	39 f1                	cmp    %esi,%ecx
+  8019e4:	0f 84 95 00 00 00    	je     801a7f <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8019ea:	89 c2                	mov    %eax,%edx
+  8019ec:	c1 ea 16             	shr    $0x16,%edx
+  8019ef:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8019f6:	f6 c2 01             	test   $0x1,%dl
+  8019f9:	74 23                	je     801a1e <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8019fb:	89 c2                	mov    %eax,%edx
+  8019fd:	c1 ea 0c             	shr    $0xc,%edx
+  801a00:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801a07:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801a0d:	74 0f                	je     801a1e <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801a0f:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801a16:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801a1c:	75 ad                	jne    8019cb <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801a1e:	85 c9                	test   %ecx,%ecx
+  801a20:	74 11                	je     801a33 <devfile_read+0x93>
+  801a22:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801a29:	75 08                	jne    801a33 <devfile_read+0x93>
+  801a2b:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801a31:	74 50                	je     801a83 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a33:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a36:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  801a3b:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a41:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a46:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a4b:	e8 56 fe ff ff       	call   8018a6 <fsipc>
+  801a50:	89 c6                	mov    %eax,%esi
+  801a52:	85 c0                	test   %eax,%eax
+  801a54:	78 1f                	js     801a75 <devfile_read+0xd5>
+	assert(r <= n);
+  801a56:	39 c7                	cmp    %eax,%edi
+  801a58:	72 50                	jb     801aaa <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801a5a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a5f:	7f 62                	jg     801ac3 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801a61:	83 ec 04             	sub    $0x4,%esp
+  801a64:	50                   	push   %eax
+  801a65:	68 00 f0 80 00       	push   $0x80f000
+  801a6a:	ff 75 0c             	push   0xc(%ebp)
+  801a6d:	e8 4d ef ff ff       	call   8009bf <memmove>
+	return r;
+  801a72:	83 c4 10             	add    $0x10,%esp
+}
+  801a75:	89 f0                	mov    %esi,%eax
+  801a77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a7a:	5b                   	pop    %ebx
+  801a7b:	5e                   	pop    %esi
+  801a7c:	5f                   	pop    %edi
+  801a7d:	5d                   	pop    %ebp
+  801a7e:	c3                   	ret
+  801a7f:	89 f1                	mov    %esi,%ecx
+  801a81:	eb 9b                	jmp    801a1e <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801a83:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a86:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801a8b:	89 c8                	mov    %ecx,%eax
+  801a8d:	c1 e0 0c             	shl    $0xc,%eax
+  801a90:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801a95:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a98:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801a9d:	e8 ab fd ff ff       	call   80184d <fsipc_pages>
+  801aa2:	89 c6                	mov    %eax,%esi
+  801aa4:	85 c0                	test   %eax,%eax
+  801aa6:	78 8b                	js     801a33 <devfile_read+0x93>
+  801aa8:	eb cb                	jmp    801a75 <devfile_read+0xd5>
+	assert(r <= n);
+  801aaa:	68 04 52 80 00       	push   $0x805204
+  801aaf:	68 7c 4d 80 00       	push   $0x804d7c
+  801ab4:	68 a0 00 00 00       	push   $0xa0
+  801ab9:	68 0b 52 80 00       	push   $0x80520b
+  801abe:	e8 b4 e6 ff ff       	call   800177 <_panic>
+	assert(r <= PGSIZE);
+  801ac3:	68 16 52 80 00       	push   $0x805216
+  801ac8:	68 7c 4d 80 00       	push   $0x804d7c
+  801acd:	68 a1 00 00 00       	push   $0xa1
+  801ad2:	68 0b 52 80 00       	push   $0x80520b
+  801ad7:	e8 9b e6 ff ff       	call   800177 <_panic>
+
+00801adc <open>:
+{
+  801adc:	55                   	push   %ebp
+  801add:	89 e5                	mov    %esp,%ebp
+  801adf:	56                   	push   %esi
+  801ae0:	53                   	push   %ebx
+  801ae1:	83 ec 1c             	sub    $0x1c,%esp
+  801ae4:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801ae7:	56                   	push   %esi
+  801ae8:	e8 11 ed ff ff       	call   8007fe <strlen>
+  801aed:	83 c4 10             	add    $0x10,%esp
+  801af0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801af5:	7f 6c                	jg     801b63 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801af7:	83 ec 0c             	sub    $0xc,%esp
+  801afa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801afd:	50                   	push   %eax
+  801afe:	e8 eb f7 ff ff       	call   8012ee <fd_alloc>
+  801b03:	89 c3                	mov    %eax,%ebx
+  801b05:	83 c4 10             	add    $0x10,%esp
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	78 3c                	js     801b48 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801b0c:	83 ec 08             	sub    $0x8,%esp
+  801b0f:	56                   	push   %esi
+  801b10:	68 00 f0 80 00       	push   $0x80f000
+  801b15:	e8 1f ed ff ff       	call   800839 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b1d:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b22:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b25:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b2a:	e8 77 fd ff ff       	call   8018a6 <fsipc>
+  801b2f:	89 c3                	mov    %eax,%ebx
+  801b31:	83 c4 10             	add    $0x10,%esp
+  801b34:	85 c0                	test   %eax,%eax
+  801b36:	78 19                	js     801b51 <open+0x75>
+	return fd2num(fd);
+  801b38:	83 ec 0c             	sub    $0xc,%esp
+  801b3b:	ff 75 f4             	push   -0xc(%ebp)
+  801b3e:	e8 84 f7 ff ff       	call   8012c7 <fd2num>
+  801b43:	89 c3                	mov    %eax,%ebx
+  801b45:	83 c4 10             	add    $0x10,%esp
+}
+  801b48:	89 d8                	mov    %ebx,%eax
+  801b4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b4d:	5b                   	pop    %ebx
+  801b4e:	5e                   	pop    %esi
+  801b4f:	5d                   	pop    %ebp
+  801b50:	c3                   	ret
+		fd_close(fd, 0);
+  801b51:	83 ec 08             	sub    $0x8,%esp
+  801b54:	6a 00                	push   $0x0
+  801b56:	ff 75 f4             	push   -0xc(%ebp)
+  801b59:	e8 80 f8 ff ff       	call   8013de <fd_close>
+		return r;
+  801b5e:	83 c4 10             	add    $0x10,%esp
+  801b61:	eb e5                	jmp    801b48 <open+0x6c>
+		return -E_BAD_PATH;
+  801b63:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b68:	eb de                	jmp    801b48 <open+0x6c>
+
+00801b6a <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801b6a:	55                   	push   %ebp
+  801b6b:	89 e5                	mov    %esp,%ebp
+  801b6d:	53                   	push   %ebx
+  801b6e:	83 ec 10             	sub    $0x10,%esp
+  801b71:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801b74:	53                   	push   %ebx
+  801b75:	e8 84 ec ff ff       	call   8007fe <strlen>
+  801b7a:	83 c4 10             	add    $0x10,%esp
+  801b7d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b82:	7f 25                	jg     801ba9 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b84:	83 ec 08             	sub    $0x8,%esp
+  801b87:	53                   	push   %ebx
+  801b88:	68 00 f0 80 00       	push   $0x80f000
+  801b8d:	e8 a7 ec ff ff       	call   800839 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b92:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b97:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b9c:	e8 05 fd ff ff       	call   8018a6 <fsipc>
+  801ba1:	83 c4 10             	add    $0x10,%esp
+}
+  801ba4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ba7:	c9                   	leave
+  801ba8:	c3                   	ret
+		return -E_BAD_PATH;
+  801ba9:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801bae:	eb f4                	jmp    801ba4 <remove+0x3a>
+
+00801bb0 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801bb0:	55                   	push   %ebp
+  801bb1:	89 e5                	mov    %esp,%ebp
+  801bb3:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801bb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bbb:	b8 08 00 00 00       	mov    $0x8,%eax
+  801bc0:	e8 e1 fc ff ff       	call   8018a6 <fsipc>
+}
+  801bc5:	c9                   	leave
+  801bc6:	c3                   	ret
+
+00801bc7 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801bc7:	55                   	push   %ebp
+  801bc8:	89 e5                	mov    %esp,%ebp
+  801bca:	53                   	push   %ebx
+  801bcb:	83 ec 04             	sub    $0x4,%esp
+  801bce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801bd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801bdb:	e8 c6 fc ff ff       	call   8018a6 <fsipc>
+  801be0:	85 c0                	test   %eax,%eax
+  801be2:	78 3c                	js     801c20 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801be4:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  801be9:	89 03                	mov    %eax,(%ebx)
+  801beb:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  801bf0:	89 43 04             	mov    %eax,0x4(%ebx)
+  801bf3:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  801bf8:	89 43 08             	mov    %eax,0x8(%ebx)
+  801bfb:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  801c00:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801c03:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  801c08:	89 43 10             	mov    %eax,0x10(%ebx)
+  801c0b:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  801c10:	89 43 14             	mov    %eax,0x14(%ebx)
+  801c13:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  801c18:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c23:	c9                   	leave
+  801c24:	c3                   	ret
+
+00801c25 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801c25:	55                   	push   %ebp
+  801c26:	89 e5                	mov    %esp,%ebp
+  801c28:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801c2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c2e:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  801c33:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c38:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c3d:	e8 64 fc ff ff       	call   8018a6 <fsipc>
+}
+  801c42:	c9                   	leave
+  801c43:	c3                   	ret
+
+00801c44 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c44:	55                   	push   %ebp
+  801c45:	89 e5                	mov    %esp,%ebp
+  801c47:	56                   	push   %esi
+  801c48:	53                   	push   %ebx
+  801c49:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801c4c:	83 ec 0c             	sub    $0xc,%esp
+  801c4f:	ff 75 08             	push   0x8(%ebp)
+  801c52:	e8 80 f6 ff ff       	call   8012d7 <fd2data>
+  801c57:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801c59:	83 c4 08             	add    $0x8,%esp
+  801c5c:	68 22 52 80 00       	push   $0x805222
+  801c61:	53                   	push   %ebx
+  801c62:	e8 d2 eb ff ff       	call   800839 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801c67:	8b 46 04             	mov    0x4(%esi),%eax
+  801c6a:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801c70:	2b 0e                	sub    (%esi),%ecx
+  801c72:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801c77:	89 c8                	mov    %ecx,%eax
+  801c79:	f7 e2                	mul    %edx
+  801c7b:	c1 ea 0c             	shr    $0xc,%edx
+  801c7e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801c84:	29 d1                	sub    %edx,%ecx
+  801c86:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801c8c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c93:	00 00 00 
+	stat->st_dev = &devpipe;
+  801c96:	c7 83 88 00 00 00 28 	movl   $0x806028,0x88(%ebx)
+  801c9d:	60 80 00 
+	return 0;
+}
+  801ca0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ca8:	5b                   	pop    %ebx
+  801ca9:	5e                   	pop    %esi
+  801caa:	5d                   	pop    %ebp
+  801cab:	c3                   	ret
+
+00801cac <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801cac:	55                   	push   %ebp
+  801cad:	89 e5                	mov    %esp,%ebp
+  801caf:	53                   	push   %ebx
+  801cb0:	83 ec 0c             	sub    $0xc,%esp
+  801cb3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801cb6:	53                   	push   %ebx
+  801cb7:	6a 00                	push   $0x0
+  801cb9:	e8 f3 f0 ff ff       	call   800db1 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801cbe:	89 1c 24             	mov    %ebx,(%esp)
+  801cc1:	e8 11 f6 ff ff       	call   8012d7 <fd2data>
+  801cc6:	83 c4 08             	add    $0x8,%esp
+  801cc9:	50                   	push   %eax
+  801cca:	6a 00                	push   $0x0
+  801ccc:	e8 e0 f0 ff ff       	call   800db1 <sys_page_unmap>
+}
+  801cd1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cd4:	c9                   	leave
+  801cd5:	c3                   	ret
+
+00801cd6 <_pipeisclosed>:
+{
+  801cd6:	55                   	push   %ebp
+  801cd7:	89 e5                	mov    %esp,%ebp
+  801cd9:	57                   	push   %edi
+  801cda:	56                   	push   %esi
+  801cdb:	53                   	push   %ebx
+  801cdc:	83 ec 1c             	sub    $0x1c,%esp
+  801cdf:	89 c7                	mov    %eax,%edi
+  801ce1:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801ce3:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801ce8:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801ceb:	83 ec 0c             	sub    $0xc,%esp
+  801cee:	57                   	push   %edi
+  801cef:	e8 06 2e 00 00       	call   804afa <pageref>
+  801cf4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801cf7:	89 34 24             	mov    %esi,(%esp)
+  801cfa:	e8 fb 2d 00 00       	call   804afa <pageref>
+		nn = thisenv->env_runs;
+  801cff:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  801d05:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801d08:	83 c4 10             	add    $0x10,%esp
+  801d0b:	39 cb                	cmp    %ecx,%ebx
+  801d0d:	74 1b                	je     801d2a <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801d0f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801d12:	75 cf                	jne    801ce3 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801d14:	8b 42 58             	mov    0x58(%edx),%eax
+  801d17:	6a 01                	push   $0x1
+  801d19:	50                   	push   %eax
+  801d1a:	53                   	push   %ebx
+  801d1b:	68 29 52 80 00       	push   $0x805229
+  801d20:	e8 2d e5 ff ff       	call   800252 <cprintf>
+  801d25:	83 c4 10             	add    $0x10,%esp
+  801d28:	eb b9                	jmp    801ce3 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801d2a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801d2d:	0f 94 c0             	sete   %al
+  801d30:	0f b6 c0             	movzbl %al,%eax
+}
+  801d33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d36:	5b                   	pop    %ebx
+  801d37:	5e                   	pop    %esi
+  801d38:	5f                   	pop    %edi
+  801d39:	5d                   	pop    %ebp
+  801d3a:	c3                   	ret
+
+00801d3b <devpipe_read>:
+{
+  801d3b:	55                   	push   %ebp
+  801d3c:	89 e5                	mov    %esp,%ebp
+  801d3e:	57                   	push   %edi
+  801d3f:	56                   	push   %esi
+  801d40:	53                   	push   %ebx
+  801d41:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801d44:	ff 75 08             	push   0x8(%ebp)
+  801d47:	e8 8b f5 ff ff       	call   8012d7 <fd2data>
+  801d4c:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801d4e:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801d51:	8d 40 04             	lea    0x4(%eax),%eax
+  801d54:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801d57:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801d5a:	8b 0b                	mov    (%ebx),%ecx
+  801d5c:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801d62:	29 ce                	sub    %ecx,%esi
+  801d64:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801d69:	f7 e6                	mul    %esi
+  801d6b:	c1 ea 0c             	shr    $0xc,%edx
+  801d6e:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801d74:	29 c6                	sub    %eax,%esi
+  801d76:	89 f2                	mov    %esi,%edx
+  801d78:	75 43                	jne    801dbd <devpipe_read+0x82>
+		ref = pageref(p);
+  801d7a:	83 ec 0c             	sub    $0xc,%esp
+  801d7d:	53                   	push   %ebx
+  801d7e:	e8 77 2d 00 00       	call   804afa <pageref>
+  801d83:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801d85:	89 da                	mov    %ebx,%edx
+  801d87:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d8a:	e8 47 ff ff ff       	call   801cd6 <_pipeisclosed>
+  801d8f:	83 c4 10             	add    $0x10,%esp
+  801d92:	85 c0                	test   %eax,%eax
+  801d94:	0f 85 c1 00 00 00    	jne    801e5b <devpipe_read+0x120>
+	*sleeping = 1;
+  801d9a:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801da1:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801da6:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801da9:	75 ac                	jne    801d57 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801dab:	83 ec 04             	sub    $0x4,%esp
+  801dae:	56                   	push   %esi
+  801daf:	57                   	push   %edi
+  801db0:	ff 75 e4             	push   -0x1c(%ebp)
+  801db3:	e8 4d f4 ff ff       	call   801205 <sys_futex_wait>
+  801db8:	83 c4 10             	add    $0x10,%esp
+  801dbb:	eb 9a                	jmp    801d57 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801dbd:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801dc0:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801dc4:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801dc6:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801dcb:	f7 e1                	mul    %ecx
+  801dcd:	c1 ea 0b             	shr    $0xb,%edx
+  801dd0:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801dd6:	29 c1                	sub    %eax,%ecx
+  801dd8:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801dda:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801ddf:	29 cf                	sub    %ecx,%edi
+  801de1:	39 f7                	cmp    %esi,%edi
+  801de3:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801de6:	8d 43 10             	lea    0x10(%ebx),%eax
+  801de9:	83 ec 04             	sub    $0x4,%esp
+  801dec:	57                   	push   %edi
+  801ded:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801df0:	01 c2                	add    %eax,%edx
+  801df2:	52                   	push   %edx
+  801df3:	ff 75 0c             	push   0xc(%ebp)
+  801df6:	e8 c4 eb ff ff       	call   8009bf <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801dfb:	83 c4 0c             	add    $0xc,%esp
+  801dfe:	89 f1                	mov    %esi,%ecx
+  801e00:	29 f9                	sub    %edi,%ecx
+  801e02:	51                   	push   %ecx
+  801e03:	ff 75 e4             	push   -0x1c(%ebp)
+  801e06:	89 f8                	mov    %edi,%eax
+  801e08:	03 45 0c             	add    0xc(%ebp),%eax
+  801e0b:	50                   	push   %eax
+  801e0c:	e8 ae eb ff ff       	call   8009bf <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801e11:	89 f1                	mov    %esi,%ecx
+  801e13:	03 0b                	add    (%ebx),%ecx
+  801e15:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e1a:	f7 e1                	mul    %ecx
+  801e1c:	c1 ea 0c             	shr    $0xc,%edx
+  801e1f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801e25:	29 d1                	sub    %edx,%ecx
+  801e27:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801e29:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801e2e:	83 c4 10             	add    $0x10,%esp
+  801e31:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801e35:	75 0a                	jne    801e41 <devpipe_read+0x106>
+	return n;
+  801e37:	89 f0                	mov    %esi,%eax
+}
+  801e39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e3c:	5b                   	pop    %ebx
+  801e3d:	5e                   	pop    %esi
+  801e3e:	5f                   	pop    %edi
+  801e3f:	5d                   	pop    %ebp
+  801e40:	c3                   	ret
+		*sleeping = 0;
+  801e41:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801e48:	83 ec 08             	sub    $0x8,%esp
+  801e4b:	68 00 04 00 00       	push   $0x400
+  801e50:	53                   	push   %ebx
+  801e51:	e8 ff f3 ff ff       	call   801255 <sys_futex_wake>
+  801e56:	83 c4 10             	add    $0x10,%esp
+  801e59:	eb dc                	jmp    801e37 <devpipe_read+0xfc>
+			return 0;
+  801e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e60:	eb d7                	jmp    801e39 <devpipe_read+0xfe>
+
+00801e62 <devpipe_write>:
+{
+  801e62:	55                   	push   %ebp
+  801e63:	89 e5                	mov    %esp,%ebp
+  801e65:	57                   	push   %edi
+  801e66:	56                   	push   %esi
+  801e67:	53                   	push   %ebx
+  801e68:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801e6b:	ff 75 08             	push   0x8(%ebp)
+  801e6e:	e8 64 f4 ff ff       	call   8012d7 <fd2data>
+  801e73:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801e75:	83 c4 10             	add    $0x10,%esp
+  801e78:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801e7f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e82:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801e85:	0f 83 23 01 00 00    	jae    801fae <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801e8b:	8b 77 04             	mov    0x4(%edi),%esi
+  801e8e:	8b 1f                	mov    (%edi),%ebx
+  801e90:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801e96:	29 d9                	sub    %ebx,%ecx
+  801e98:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e9d:	f7 e1                	mul    %ecx
+  801e9f:	c1 ea 0c             	shr    $0xc,%edx
+  801ea2:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801ea8:	29 c1                	sub    %eax,%ecx
+  801eaa:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801eac:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801eb2:	75 40                	jne    801ef4 <devpipe_write+0x92>
+			ref = pageref(p);
+  801eb4:	83 ec 0c             	sub    $0xc,%esp
+  801eb7:	57                   	push   %edi
+  801eb8:	e8 3d 2c 00 00       	call   804afa <pageref>
+  801ebd:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801ebf:	89 fa                	mov    %edi,%edx
+  801ec1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec4:	e8 0d fe ff ff       	call   801cd6 <_pipeisclosed>
+  801ec9:	83 c4 10             	add    $0x10,%esp
+  801ecc:	85 c0                	test   %eax,%eax
+  801ece:	0f 85 d5 00 00 00    	jne    801fa9 <devpipe_write+0x147>
+	*sleeping = 1;
+  801ed4:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801edb:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801ee0:	39 1f                	cmp    %ebx,(%edi)
+  801ee2:	75 a7                	jne    801e8b <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801ee4:	83 ec 04             	sub    $0x4,%esp
+  801ee7:	56                   	push   %esi
+  801ee8:	53                   	push   %ebx
+  801ee9:	57                   	push   %edi
+  801eea:	e8 16 f3 ff ff       	call   801205 <sys_futex_wait>
+  801eef:	83 c4 10             	add    $0x10,%esp
+  801ef2:	eb 97                	jmp    801e8b <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801ef4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801ef7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801efa:	29 c1                	sub    %eax,%ecx
+  801efc:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801f01:	89 d8                	mov    %ebx,%eax
+  801f03:	29 d0                	sub    %edx,%eax
+  801f05:	39 c1                	cmp    %eax,%ecx
+  801f07:	0f 46 c1             	cmovbe %ecx,%eax
+  801f0a:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801f0c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f11:	f7 e6                	mul    %esi
+  801f13:	c1 ea 0b             	shr    $0xb,%edx
+  801f16:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801f1c:	29 c6                	sub    %eax,%esi
+  801f1e:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801f20:	29 f3                	sub    %esi,%ebx
+  801f22:	39 cb                	cmp    %ecx,%ebx
+  801f24:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801f27:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801f2a:	8d 77 10             	lea    0x10(%edi),%esi
+  801f2d:	83 ec 04             	sub    $0x4,%esp
+  801f30:	53                   	push   %ebx
+  801f31:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f34:	03 45 0c             	add    0xc(%ebp),%eax
+  801f37:	50                   	push   %eax
+  801f38:	01 f2                	add    %esi,%edx
+  801f3a:	52                   	push   %edx
+  801f3b:	e8 7f ea ff ff       	call   8009bf <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  801f40:	83 c4 0c             	add    $0xc,%esp
+  801f43:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f46:	29 d8                	sub    %ebx,%eax
+  801f48:	50                   	push   %eax
+  801f49:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f4c:	01 d3                	add    %edx,%ebx
+  801f4e:	03 5d 0c             	add    0xc(%ebp),%ebx
+  801f51:	53                   	push   %ebx
+  801f52:	56                   	push   %esi
+  801f53:	e8 67 ea ff ff       	call   8009bf <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  801f58:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801f5b:	03 4f 04             	add    0x4(%edi),%ecx
+  801f5e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f63:	f7 e1                	mul    %ecx
+  801f65:	c1 ea 0c             	shr    $0xc,%edx
+  801f68:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801f6e:	29 d1                	sub    %edx,%ecx
+  801f70:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  801f73:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801f78:	83 c4 10             	add    $0x10,%esp
+  801f7b:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  801f7f:	75 0b                	jne    801f8c <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  801f81:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  801f84:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801f87:	e9 f3 fe ff ff       	jmp    801e7f <devpipe_write+0x1d>
+		*sleeping = 0;
+  801f8c:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  801f93:	83 ec 08             	sub    $0x8,%esp
+  801f96:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  801f9b:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  801f9e:	50                   	push   %eax
+  801f9f:	e8 b1 f2 ff ff       	call   801255 <sys_futex_wake>
+  801fa4:	83 c4 10             	add    $0x10,%esp
+  801fa7:	eb d8                	jmp    801f81 <devpipe_write+0x11f>
+				return 0;
+  801fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fb1:	5b                   	pop    %ebx
+  801fb2:	5e                   	pop    %esi
+  801fb3:	5f                   	pop    %edi
+  801fb4:	5d                   	pop    %ebp
+  801fb5:	c3                   	ret
+
+00801fb6 <pipe>:
+{
+  801fb6:	55                   	push   %ebp
+  801fb7:	89 e5                	mov    %esp,%ebp
+  801fb9:	56                   	push   %esi
+  801fba:	53                   	push   %ebx
+  801fbb:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801fbe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fc1:	50                   	push   %eax
+  801fc2:	e8 27 f3 ff ff       	call   8012ee <fd_alloc>
+  801fc7:	89 c3                	mov    %eax,%ebx
+  801fc9:	83 c4 10             	add    $0x10,%esp
+  801fcc:	85 c0                	test   %eax,%eax
+  801fce:	0f 88 23 01 00 00    	js     8020f7 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801fd4:	83 ec 04             	sub    $0x4,%esp
+  801fd7:	68 07 04 00 00       	push   $0x407
+  801fdc:	ff 75 f4             	push   -0xc(%ebp)
+  801fdf:	6a 00                	push   $0x0
+  801fe1:	e8 46 ed ff ff       	call   800d2c <sys_page_alloc>
+  801fe6:	89 c3                	mov    %eax,%ebx
+  801fe8:	83 c4 10             	add    $0x10,%esp
+  801feb:	85 c0                	test   %eax,%eax
+  801fed:	0f 88 04 01 00 00    	js     8020f7 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801ff3:	83 ec 0c             	sub    $0xc,%esp
+  801ff6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ff9:	50                   	push   %eax
+  801ffa:	e8 ef f2 ff ff       	call   8012ee <fd_alloc>
+  801fff:	89 c3                	mov    %eax,%ebx
+  802001:	83 c4 10             	add    $0x10,%esp
+  802004:	85 c0                	test   %eax,%eax
+  802006:	0f 88 db 00 00 00    	js     8020e7 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80200c:	83 ec 04             	sub    $0x4,%esp
+  80200f:	68 07 04 00 00       	push   $0x407
+  802014:	ff 75 f0             	push   -0x10(%ebp)
+  802017:	6a 00                	push   $0x0
+  802019:	e8 0e ed ff ff       	call   800d2c <sys_page_alloc>
+  80201e:	89 c3                	mov    %eax,%ebx
+  802020:	83 c4 10             	add    $0x10,%esp
+  802023:	85 c0                	test   %eax,%eax
+  802025:	0f 88 bc 00 00 00    	js     8020e7 <pipe+0x131>
+	va = fd2data(fd0);
+  80202b:	83 ec 0c             	sub    $0xc,%esp
+  80202e:	ff 75 f4             	push   -0xc(%ebp)
+  802031:	e8 a1 f2 ff ff       	call   8012d7 <fd2data>
+  802036:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802038:	83 c4 0c             	add    $0xc,%esp
+  80203b:	68 07 04 00 00       	push   $0x407
+  802040:	50                   	push   %eax
+  802041:	6a 00                	push   $0x0
+  802043:	e8 e4 ec ff ff       	call   800d2c <sys_page_alloc>
+  802048:	89 c3                	mov    %eax,%ebx
+  80204a:	83 c4 10             	add    $0x10,%esp
+  80204d:	85 c0                	test   %eax,%eax
+  80204f:	0f 88 82 00 00 00    	js     8020d7 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802055:	83 ec 0c             	sub    $0xc,%esp
+  802058:	ff 75 f0             	push   -0x10(%ebp)
+  80205b:	e8 77 f2 ff ff       	call   8012d7 <fd2data>
+  802060:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802067:	50                   	push   %eax
+  802068:	6a 00                	push   $0x0
+  80206a:	56                   	push   %esi
+  80206b:	6a 00                	push   $0x0
+  80206d:	e8 fd ec ff ff       	call   800d6f <sys_page_map>
+  802072:	89 c3                	mov    %eax,%ebx
+  802074:	83 c4 20             	add    $0x20,%esp
+  802077:	85 c0                	test   %eax,%eax
+  802079:	78 4e                	js     8020c9 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80207b:	a1 28 60 80 00       	mov    0x806028,%eax
+  802080:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802083:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802085:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802088:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80208f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802092:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802094:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802097:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80209e:	83 ec 0c             	sub    $0xc,%esp
+  8020a1:	ff 75 f4             	push   -0xc(%ebp)
+  8020a4:	e8 1e f2 ff ff       	call   8012c7 <fd2num>
+  8020a9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8020ac:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8020ae:	83 c4 04             	add    $0x4,%esp
+  8020b1:	ff 75 f0             	push   -0x10(%ebp)
+  8020b4:	e8 0e f2 ff ff       	call   8012c7 <fd2num>
+  8020b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8020bc:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8020bf:	83 c4 10             	add    $0x10,%esp
+  8020c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020c7:	eb 2e                	jmp    8020f7 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8020c9:	83 ec 08             	sub    $0x8,%esp
+  8020cc:	56                   	push   %esi
+  8020cd:	6a 00                	push   $0x0
+  8020cf:	e8 dd ec ff ff       	call   800db1 <sys_page_unmap>
+  8020d4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8020d7:	83 ec 08             	sub    $0x8,%esp
+  8020da:	ff 75 f0             	push   -0x10(%ebp)
+  8020dd:	6a 00                	push   $0x0
+  8020df:	e8 cd ec ff ff       	call   800db1 <sys_page_unmap>
+  8020e4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8020e7:	83 ec 08             	sub    $0x8,%esp
+  8020ea:	ff 75 f4             	push   -0xc(%ebp)
+  8020ed:	6a 00                	push   $0x0
+  8020ef:	e8 bd ec ff ff       	call   800db1 <sys_page_unmap>
+  8020f4:	83 c4 10             	add    $0x10,%esp
+}
+  8020f7:	89 d8                	mov    %ebx,%eax
+  8020f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020fc:	5b                   	pop    %ebx
+  8020fd:	5e                   	pop    %esi
+  8020fe:	5d                   	pop    %ebp
+  8020ff:	c3                   	ret
+
+00802100 <pipeisclosed>:
+{
+  802100:	55                   	push   %ebp
+  802101:	89 e5                	mov    %esp,%ebp
+  802103:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802106:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802109:	50                   	push   %eax
+  80210a:	ff 75 08             	push   0x8(%ebp)
+  80210d:	e8 30 f2 ff ff       	call   801342 <fd_lookup>
+  802112:	83 c4 10             	add    $0x10,%esp
+  802115:	85 c0                	test   %eax,%eax
+  802117:	78 18                	js     802131 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802119:	83 ec 0c             	sub    $0xc,%esp
+  80211c:	ff 75 f4             	push   -0xc(%ebp)
+  80211f:	e8 b3 f1 ff ff       	call   8012d7 <fd2data>
+  802124:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802126:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802129:	e8 a8 fb ff ff       	call   801cd6 <_pipeisclosed>
+  80212e:	83 c4 10             	add    $0x10,%esp
+}
+  802131:	c9                   	leave
+  802132:	c3                   	ret
+
+00802133 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802133:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802135:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  80213b:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802141:	81 c2 34 01 00 00    	add    $0x134,%edx
+  802147:	39 d0                	cmp    %edx,%eax
+  802149:	74 2e                	je     802179 <segment_lookup+0x46>
+{
+  80214b:	55                   	push   %ebp
+  80214c:	89 e5                	mov    %esp,%ebp
+  80214e:	57                   	push   %edi
+  80214f:	56                   	push   %esi
+  802150:	53                   	push   %ebx
+  802151:	eb 07                	jmp    80215a <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802153:	83 c0 20             	add    $0x20,%eax
+  802156:	39 d0                	cmp    %edx,%eax
+  802158:	74 15                	je     80216f <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  80215a:	8b 18                	mov    (%eax),%ebx
+  80215c:	39 d9                	cmp    %ebx,%ecx
+  80215e:	72 f3                	jb     802153 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  802160:	8b 38                	mov    (%eax),%edi
+  802162:	8b 58 04             	mov    0x4(%eax),%ebx
+  802165:	89 ce                	mov    %ecx,%esi
+  802167:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  802169:	39 de                	cmp    %ebx,%esi
+  80216b:	73 e6                	jae    802153 <segment_lookup+0x20>
+  80216d:	eb 05                	jmp    802174 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  80216f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802174:	5b                   	pop    %ebx
+  802175:	5e                   	pop    %esi
+  802176:	5f                   	pop    %edi
+  802177:	5d                   	pop    %ebp
+  802178:	c3                   	ret
+	return NULL;
+  802179:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80217e:	c3                   	ret
+
+0080217f <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  80217f:	55                   	push   %ebp
+  802180:	89 e5                	mov    %esp,%ebp
+  802182:	53                   	push   %ebx
+  802183:	83 ec 04             	sub    $0x4,%esp
+  802186:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802188:	c1 e8 16             	shr    $0x16,%eax
+  80218b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802192:	25 81 00 00 00       	and    $0x81,%eax
+  802197:	83 f8 01             	cmp    $0x1,%eax
+  80219a:	75 6b                	jne    802207 <page_is_clean+0x88>
+  80219c:	89 da                	mov    %ebx,%edx
+  80219e:	c1 ea 0c             	shr    $0xc,%edx
+  8021a1:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  8021a8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8021ad:	f6 c1 01             	test   $0x1,%cl
+  8021b0:	74 5a                	je     80220c <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  8021b2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8021b9:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  8021bf:	75 4b                	jne    80220c <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  8021c1:	89 d8                	mov    %ebx,%eax
+  8021c3:	e8 6b ff ff ff       	call   802133 <segment_lookup>
+  8021c8:	89 c2                	mov    %eax,%edx
+		return 1;
+  8021ca:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  8021cf:	85 d2                	test   %edx,%edx
+  8021d1:	75 39                	jne    80220c <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  8021d3:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  8021d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021de:	eb 03                	jmp    8021e3 <page_is_clean+0x64>
+  8021e0:	83 c0 01             	add    $0x1,%eax
+  8021e3:	39 c2                	cmp    %eax,%edx
+  8021e5:	7e 19                	jle    802200 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  8021e7:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  8021ee:	72 f0                	jb     8021e0 <page_is_clean+0x61>
+  8021f0:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  8021f7:	73 e7                	jae    8021e0 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  8021f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021fe:	eb 0c                	jmp    80220c <page_is_clean+0x8d>
+	return 0;
+  802200:	b8 00 00 00 00       	mov    $0x0,%eax
+  802205:	eb 05                	jmp    80220c <page_is_clean+0x8d>
+		return 0;
+  802207:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80220c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80220f:	c9                   	leave
+  802210:	c3                   	ret
+
+00802211 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  802211:	55                   	push   %ebp
+  802212:	89 e5                	mov    %esp,%ebp
+  802214:	57                   	push   %edi
+  802215:	56                   	push   %esi
+  802216:	53                   	push   %ebx
+  802217:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80221a:	be 00 00 00 00       	mov    $0x0,%esi
+  80221f:	eb 19                	jmp    80223a <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802221:	f7 d3                	not    %ebx
+  802223:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802229:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80222b:	83 c6 01             	add    $0x1,%esi
+  80222e:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802234:	0f 87 97 00 00 00    	ja     8022d1 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80223a:	89 f3                	mov    %esi,%ebx
+  80223c:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  802242:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802248:	89 d8                	mov    %ebx,%eax
+  80224a:	c1 e8 0a             	shr    $0xa,%eax
+  80224d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802254:	25 81 00 00 00       	and    $0x81,%eax
+  802259:	83 f8 01             	cmp    $0x1,%eax
+  80225c:	75 c3                	jne    802221 <linear_walk+0x10>
+  80225e:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802264:	77 bb                	ja     802221 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802266:	89 df                	mov    %ebx,%edi
+  802268:	c1 e7 0c             	shl    $0xc,%edi
+  80226b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80226e:	89 f8                	mov    %edi,%eax
+  802270:	e8 0a ff ff ff       	call   80217f <page_is_clean>
+  802275:	84 c0                	test   %al,%al
+  802277:	75 64                	jne    8022dd <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802279:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  80227f:	77 aa                	ja     80222b <linear_walk+0x1a>
+  802281:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  802287:	72 a2                	jb     80222b <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802289:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802290:	a8 01                	test   $0x1,%al
+  802292:	74 97                	je     80222b <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802294:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80229b:	f6 c4 04             	test   $0x4,%ah
+  80229e:	75 8b                	jne    80222b <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8022a0:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8022a7:	f6 c4 02             	test   $0x2,%ah
+  8022aa:	0f 85 7b ff ff ff    	jne    80222b <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8022b0:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8022b7:	c1 e8 0c             	shr    $0xc,%eax
+  8022ba:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8022bd:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8022c2:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8022c6:	66 83 f8 01          	cmp    $0x1,%ax
+  8022ca:	76 11                	jbe    8022dd <linear_walk+0xcc>
+  8022cc:	e9 5a ff ff ff       	jmp    80222b <linear_walk+0x1a>
+  8022d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  8022d6:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  8022dd:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  8022e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022e6:	83 c4 1c             	add    $0x1c,%esp
+  8022e9:	5b                   	pop    %ebx
+  8022ea:	5e                   	pop    %esi
+  8022eb:	5f                   	pop    %edi
+  8022ec:	5d                   	pop    %ebp
+  8022ed:	c3                   	ret
+
+008022ee <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  8022ee:	55                   	push   %ebp
+  8022ef:	89 e5                	mov    %esp,%ebp
+  8022f1:	56                   	push   %esi
+  8022f2:	53                   	push   %ebx
+  8022f3:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  8022f5:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8022fa:	83 e0 7f             	and    $0x7f,%eax
+  8022fd:	c1 e0 04             	shl    $0x4,%eax
+  802300:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  802306:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  80230c:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802312:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  802318:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80231d:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  802320:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802325:	83 c0 01             	add    $0x1,%eax
+  802328:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  80232d:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802330:	5b                   	pop    %ebx
+  802331:	5e                   	pop    %esi
+  802332:	5d                   	pop    %ebp
+  802333:	c3                   	ret
+
+00802334 <page_ring_enter>:
+{
+  802334:	55                   	push   %ebp
+  802335:	89 e5                	mov    %esp,%ebp
+  802337:	57                   	push   %edi
+  802338:	56                   	push   %esi
+  802339:	53                   	push   %ebx
+  80233a:	83 ec 18             	sub    $0x18,%esp
+  80233d:	89 c6                	mov    %eax,%esi
+  80233f:	89 d7                	mov    %edx,%edi
+  802341:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802343:	6a 00                	push   $0x0
+  802345:	6a 00                	push   $0x0
+  802347:	6a 00                	push   $0x0
+  802349:	6a 07                	push   $0x7
+  80234b:	ff 35 40 b0 80 00    	push   0x80b040
+  802351:	e8 8e 26 00 00       	call   8049e4 <ipc_call>
+  802356:	83 c4 20             	add    $0x20,%esp
+  802359:	85 c0                	test   %eax,%eax
+  80235b:	79 22                	jns    80237f <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  80235d:	50                   	push   %eax
+  80235e:	68 41 52 80 00       	push   $0x805241
+  802363:	68 13 02 00 00       	push   $0x213
+  802368:	68 55 52 80 00       	push   $0x805255
+  80236d:	e8 05 de ff ff       	call   800177 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802372:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802377:	83 c0 01             	add    $0x1,%eax
+  80237a:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  80237f:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802385:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  80238a:	39 c2                	cmp    %eax,%edx
+  80238c:	74 24                	je     8023b2 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  80238e:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802393:	83 e0 7f             	and    $0x7f,%eax
+  802396:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  80239d:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  8023a4:	29 f0                	sub    %esi,%eax
+  8023a6:	39 d8                	cmp    %ebx,%eax
+  8023a8:	73 c8                	jae    802372 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  8023aa:	8b 52 04             	mov    0x4(%edx),%edx
+  8023ad:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  8023b0:	eb c0                	jmp    802372 <page_ring_enter+0x3e>
+}
+  8023b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023b5:	5b                   	pop    %ebx
+  8023b6:	5e                   	pop    %esi
+  8023b7:	5f                   	pop    %edi
+  8023b8:	5d                   	pop    %ebp
+  8023b9:	c3                   	ret
+
+008023ba <page_ring_reserve>:
+{
+  8023ba:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  8023bc:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023c1:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  8023c7:	29 d0                	sub    %edx,%eax
+  8023c9:	ba 80 00 00 00       	mov    $0x80,%edx
+  8023ce:	29 ca                	sub    %ecx,%edx
+  8023d0:	39 c2                	cmp    %eax,%edx
+  8023d2:	72 01                	jb     8023d5 <page_ring_reserve+0x1b>
+  8023d4:	c3                   	ret
+{
+  8023d5:	55                   	push   %ebp
+  8023d6:	89 e5                	mov    %esp,%ebp
+  8023d8:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  8023db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ea:	e8 45 ff ff ff       	call   802334 <page_ring_enter>
+}
+  8023ef:	c9                   	leave
+  8023f0:	c3                   	ret
+
+008023f1 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  8023f1:	55                   	push   %ebp
+  8023f2:	89 e5                	mov    %esp,%ebp
+  8023f4:	53                   	push   %ebx
+  8023f5:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  8023f8:	6a 07                	push   $0x7
+  8023fa:	6a 01                	push   $0x1
+  8023fc:	89 c3                	mov    %eax,%ebx
+  8023fe:	c1 e3 0c             	shl    $0xc,%ebx
+  802401:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  802407:	52                   	push   %edx
+  802408:	6a 04                	push   $0x4
+  80240a:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  802411:	e8 ce 25 00 00       	call   8049e4 <ipc_call>
+	sharereqs[i].nslots = 0;
+  802416:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  80241d:	00 00 00 
+	return r;
+}
+  802420:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802423:	c9                   	leave
+  802424:	c3                   	ret
+
+00802425 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802425:	55                   	push   %ebp
+  802426:	89 e5                	mov    %esp,%ebp
+  802428:	56                   	push   %esi
+  802429:	53                   	push   %ebx
+  80242a:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  80242c:	c1 e8 10             	shr    $0x10,%eax
+  80242f:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802432:	89 c2                	mov    %eax,%edx
+  802434:	c1 e2 0c             	shl    $0xc,%edx
+  802437:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  80243d:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802440:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  802446:	89 c2                	mov    %eax,%edx
+  802448:	c1 e2 0a             	shl    $0xa,%edx
+  80244b:	01 f2                	add    %esi,%edx
+  80244d:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802454:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  80245a:	74 09                	je     802465 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  80245c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802461:	5b                   	pop    %ebx
+  802462:	5e                   	pop    %esi
+  802463:	5d                   	pop    %ebp
+  802464:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802465:	e8 87 ff ff ff       	call   8023f1 <page_share_send>
+  80246a:	eb f5                	jmp    802461 <page_share_slot+0x3c>
+
+0080246c <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  80246c:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802471:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802474:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802479:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  80247f:	74 09                	je     80248a <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802481:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802486:	85 c0                	test   %eax,%eax
+  802488:	75 01                	jne    80248b <page_ring_ready+0x1f>
+}
+  80248a:	c3                   	ret
+{
+  80248b:	55                   	push   %ebp
+  80248c:	89 e5                	mov    %esp,%ebp
+  80248e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802491:	68 07 06 00 00       	push   $0x607
+  802496:	6a 08                	push   $0x8
+  802498:	68 00 30 ad de       	push   $0xdead3000
+  80249d:	6a 00                	push   $0x0
+  80249f:	e8 b3 e9 ff ff       	call   800e57 <sys_page_alloc_range>
+  8024a4:	83 c4 10             	add    $0x10,%esp
+  8024a7:	83 f8 08             	cmp    $0x8,%eax
+  8024aa:	74 1b                	je     8024c7 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  8024ac:	83 ec 04             	sub    $0x4,%esp
+  8024af:	6a 08                	push   $0x8
+  8024b1:	68 00 30 ad de       	push   $0xdead3000
+  8024b6:	6a 00                	push   $0x0
+  8024b8:	e8 08 ea ff ff       	call   800ec5 <sys_page_unmap_range>
+		return 0;
+  8024bd:	83 c4 10             	add    $0x10,%esp
+  8024c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024c5:	c9                   	leave
+  8024c6:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  8024c7:	83 ec 0c             	sub    $0xc,%esp
+  8024ca:	68 07 04 00 00       	push   $0x407
+  8024cf:	6a 08                	push   $0x8
+  8024d1:	68 00 30 ad de       	push   $0xdead3000
+  8024d6:	6a 06                	push   $0x6
+  8024d8:	ff 35 40 b0 80 00    	push   0x80b040
+  8024de:	e8 01 25 00 00       	call   8049e4 <ipc_call>
+  8024e3:	83 c4 20             	add    $0x20,%esp
+  8024e6:	85 c0                	test   %eax,%eax
+  8024e8:	78 14                	js     8024fe <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  8024ea:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8024ef:	8b 40 48             	mov    0x48(%eax),%eax
+  8024f2:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  8024f7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024fc:	eb c7                	jmp    8024c5 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  8024fe:	83 ec 04             	sub    $0x4,%esp
+  802501:	6a 08                	push   $0x8
+  802503:	68 00 30 ad de       	push   $0xdead3000
+  802508:	6a 00                	push   $0x0
+  80250a:	e8 b6 e9 ff ff       	call   800ec5 <sys_page_unmap_range>
+		return 0;
+  80250f:	83 c4 10             	add    $0x10,%esp
+  802512:	b8 00 00 00 00       	mov    $0x0,%eax
+  802517:	eb ac                	jmp    8024c5 <page_ring_ready+0x59>
+
+00802519 <page_remove_slot>:
+{
+  802519:	55                   	push   %ebp
+  80251a:	89 e5                	mov    %esp,%ebp
+  80251c:	56                   	push   %esi
+  80251d:	53                   	push   %ebx
+  80251e:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802520:	89 c6                	mov    %eax,%esi
+  802522:	c1 ee 10             	shr    $0x10,%esi
+  802525:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802528:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  80252f:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  802535:	74 2a                	je     802561 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802537:	83 ec 0c             	sub    $0xc,%esp
+  80253a:	6a 00                	push   $0x0
+  80253c:	6a 00                	push   $0x0
+  80253e:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802540:	c1 e3 04             	shl    $0x4,%ebx
+  802543:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802546:	53                   	push   %ebx
+  802547:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  80254e:	e8 91 24 00 00       	call   8049e4 <ipc_call>
+  802553:	83 c4 20             	add    $0x20,%esp
+  802556:	85 c0                	test   %eax,%eax
+  802558:	78 2d                	js     802587 <page_remove_slot+0x6e>
+}
+  80255a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80255d:	5b                   	pop    %ebx
+  80255e:	5e                   	pop    %esi
+  80255f:	5d                   	pop    %ebp
+  802560:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802561:	e8 06 ff ff ff       	call   80246c <page_ring_ready>
+  802566:	85 c0                	test   %eax,%eax
+  802568:	74 cd                	je     802537 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  80256a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80256f:	e8 46 fe ff ff       	call   8023ba <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802574:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802579:	89 da                	mov    %ebx,%edx
+  80257b:	b8 02 00 00 00       	mov    $0x2,%eax
+  802580:	e8 69 fd ff ff       	call   8022ee <page_ring_post>
+		return;
+  802585:	eb d3                	jmp    80255a <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802587:	50                   	push   %eax
+  802588:	68 b0 52 80 00       	push   $0x8052b0
+  80258d:	68 ac 03 00 00       	push   $0x3ac
+  802592:	68 55 52 80 00       	push   $0x805255
+  802597:	e8 db db ff ff       	call   800177 <_panic>
+
+0080259c <find_paging_env>:
+	if(pagingenv)
+  80259c:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  8025a1:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  8025a3:	85 c0                	test   %eax,%eax
+  8025a5:	74 05                	je     8025ac <find_paging_env+0x10>
+  8025a7:	eb 56                	jmp    8025ff <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  8025a9:	83 c0 01             	add    $0x1,%eax
+  8025ac:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025b1:	7f 47                	jg     8025fa <find_paging_env+0x5e>
+  8025b3:	83 f9 01             	cmp    $0x1,%ecx
+  8025b6:	7f 42                	jg     8025fa <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  8025b8:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  8025bb:	c1 e2 06             	shl    $0x6,%edx
+  8025be:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8025c4:	8b 52 50             	mov    0x50(%edx),%edx
+  8025c7:	83 fa 02             	cmp    $0x2,%edx
+  8025ca:	75 dd                	jne    8025a9 <find_paging_env+0xd>
+  8025cc:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  8025cf:	c1 e2 06             	shl    $0x6,%edx
+  8025d2:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8025d8:	8b 52 54             	mov    0x54(%edx),%edx
+  8025db:	85 d2                	test   %edx,%edx
+  8025dd:	74 ca                	je     8025a9 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  8025df:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  8025e2:	c1 e2 06             	shl    $0x6,%edx
+  8025e5:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8025eb:	8b 52 48             	mov    0x48(%edx),%edx
+  8025ee:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  8025f5:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8025f8:	eb af                	jmp    8025a9 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  8025fa:	83 f9 02             	cmp    $0x2,%ecx
+  8025fd:	74 01                	je     802600 <find_paging_env+0x64>
+}
+  8025ff:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802600:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802605:	8b 40 48             	mov    0x48(%eax),%eax
+  802608:	83 e0 01             	and    $0x1,%eax
+  80260b:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  802612:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  802617:	eb e6                	jmp    8025ff <find_paging_env+0x63>
+
+00802619 <page_add_backed>:
+{
+  802619:	55                   	push   %ebp
+  80261a:	89 e5                	mov    %esp,%ebp
+  80261c:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  80261f:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  802624:	83 f8 04             	cmp    $0x4,%eax
+  802627:	74 35                	je     80265e <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802629:	89 d1                	mov    %edx,%ecx
+  80262b:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802631:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802638:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80263b:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802642:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802648:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  80264f:	83 c0 01             	add    $0x1,%eax
+  802652:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  802657:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80265c:	5d                   	pop    %ebp
+  80265d:	c3                   	ret
+		return -E_NO_MEM;
+  80265e:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802663:	eb f7                	jmp    80265c <page_add_backed+0x43>
+
+00802665 <percentage_of_pgdir_to_walk>:
+{
+  802665:	55                   	push   %ebp
+  802666:	89 e5                	mov    %esp,%ebp
+  802668:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  80266b:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  80266f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802672:	db 45 fc             	fildl  -0x4(%ebp)
+  802675:	d8 35 3c 57 80 00    	fdivs  0x80573c
+	return ret*ret;
+  80267b:	d8 c8                	fmul   %st(0),%st
+}
+  80267d:	c9                   	leave
+  80267e:	c3                   	ret
+
+0080267f <nfu_with_aging_page_choice_func>:
+{
+  80267f:	55                   	push   %ebp
+  802680:	89 e5                	mov    %esp,%ebp
+  802682:	57                   	push   %edi
+  802683:	56                   	push   %esi
+  802684:	53                   	push   %ebx
+  802685:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802688:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  80268e:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802690:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802695:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80269a:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8026a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a6:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  8026a9:	eb 18                	jmp    8026c3 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8026ab:	f7 d0                	not    %eax
+  8026ad:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8026b2:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8026b4:	83 c2 01             	add    $0x1,%edx
+  8026b7:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  8026bd:	0f 87 13 01 00 00    	ja     8027d6 <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  8026c3:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8026c7:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8026ca:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8026cf:	89 c1                	mov    %eax,%ecx
+  8026d1:	c1 e9 0a             	shr    $0xa,%ecx
+  8026d4:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8026db:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8026e1:	83 f9 01             	cmp    $0x1,%ecx
+  8026e4:	75 c5                	jne    8026ab <nfu_with_aging_page_choice_func+0x2c>
+  8026e6:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8026eb:	77 be                	ja     8026ab <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8026ed:	89 c1                	mov    %eax,%ecx
+  8026ef:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8026f2:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  8026f8:	0f 82 a5 00 00 00    	jb     8027a3 <nfu_with_aging_page_choice_func+0x124>
+  8026fe:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802704:	0f 87 99 00 00 00    	ja     8027a3 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80270a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802711:	f6 c1 01             	test   $0x1,%cl
+  802714:	0f 84 89 00 00 00    	je     8027a3 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80271a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802721:	f6 c5 04             	test   $0x4,%ch
+  802724:	75 7d                	jne    8027a3 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802726:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80272d:	f6 c5 02             	test   $0x2,%ch
+  802730:	75 71                	jne    8027a3 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802732:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802739:	c1 e9 0c             	shr    $0xc,%ecx
+  80273c:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80273f:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802745:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802749:	66 83 f9 01          	cmp    $0x1,%cx
+  80274d:	77 54                	ja     8027a3 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  80274f:	89 f9                	mov    %edi,%ecx
+  802751:	80 f9 ff             	cmp    $0xff,%cl
+  802754:	74 21                	je     802777 <nfu_with_aging_page_choice_func+0xf8>
+  802756:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80275d:	c1 e9 0c             	shr    $0xc,%ecx
+  802760:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802763:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802769:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  80276d:	89 fb                	mov    %edi,%ebx
+  80276f:	38 d9                	cmp    %bl,%cl
+  802771:	73 30                	jae    8027a3 <nfu_with_aging_page_choice_func+0x124>
+  802773:	dd d8                	fstp   %st(0)
+  802775:	eb 02                	jmp    802779 <nfu_with_aging_page_choice_func+0xfa>
+  802777:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802779:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802780:	c1 e9 0c             	shr    $0xc,%ecx
+  802783:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802786:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  80278d:	89 fb                	mov    %edi,%ebx
+  80278f:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802792:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802795:	db 45 e0             	fildl  -0x20(%ebp)
+  802798:	d8 35 3c 57 80 00    	fdivs  0x80573c
+	return ret*ret;
+  80279e:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8027a0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8027a3:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8027a6:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8027a9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8027b0:	df 6d e0             	fildll -0x20(%ebp)
+  8027b3:	d9 c1                	fld    %st(1)
+  8027b5:	d8 0d 40 57 80 00    	fmuls  0x805740
+  8027bb:	d9 c9                	fxch   %st(1)
+  8027bd:	df f1                	fcomip %st(1),%st
+  8027bf:	dd d8                	fstp   %st(0)
+  8027c1:	0f 82 ed fe ff ff    	jb     8026b4 <nfu_with_aging_page_choice_func+0x35>
+  8027c7:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  8027c9:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  8027ce:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8027d1:	c1 e0 0c             	shl    $0xc,%eax
+  8027d4:	eb 0e                	jmp    8027e4 <nfu_with_aging_page_choice_func+0x165>
+  8027d6:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  8027d8:	89 f8                	mov    %edi,%eax
+  8027da:	3c ff                	cmp    $0xff,%al
+  8027dc:	74 0e                	je     8027ec <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  8027de:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8027e1:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8027e4:	83 c4 14             	add    $0x14,%esp
+  8027e7:	5b                   	pop    %ebx
+  8027e8:	5e                   	pop    %esi
+  8027e9:	5f                   	pop    %edi
+  8027ea:	5d                   	pop    %ebp
+  8027eb:	c3                   	ret
+	pgnum = 0;
+  8027ec:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  8027f3:	00 00 00 
+	return (void*)UTOP;
+  8027f6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8027fb:	eb e7                	jmp    8027e4 <nfu_with_aging_page_choice_func+0x165>
+
+008027fd <myRand>:
+    state = state * 1664525 + 1013904223;
+  8027fd:	69 05 48 60 80 00 0d 	imul   $0x19660d,0x806048,%eax
+  802804:	66 19 00 
+  802807:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  80280c:	a3 48 60 80 00       	mov    %eax,0x806048
+    return state >> 24;
+  802811:	c1 e8 18             	shr    $0x18,%eax
+}
+  802814:	c3                   	ret
+
+00802815 <random_page_choice_func>:
+{
+  802815:	55                   	push   %ebp
+  802816:	89 e5                	mov    %esp,%ebp
+  802818:	57                   	push   %edi
+  802819:	56                   	push   %esi
+  80281a:	53                   	push   %ebx
+  80281b:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80281e:	be 00 00 00 00       	mov    $0x0,%esi
+  802823:	eb 19                	jmp    80283e <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802825:	f7 d3                	not    %ebx
+  802827:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80282d:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80282f:	83 c6 01             	add    $0x1,%esi
+  802832:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802838:	0f 87 a0 00 00 00    	ja     8028de <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80283e:	89 f3                	mov    %esi,%ebx
+  802840:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  802846:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80284c:	89 d8                	mov    %ebx,%eax
+  80284e:	c1 e8 0a             	shr    $0xa,%eax
+  802851:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802858:	25 81 00 00 00       	and    $0x81,%eax
+  80285d:	83 f8 01             	cmp    $0x1,%eax
+  802860:	75 c3                	jne    802825 <random_page_choice_func+0x10>
+  802862:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802868:	77 bb                	ja     802825 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  80286a:	89 df                	mov    %ebx,%edi
+  80286c:	c1 e7 0c             	shl    $0xc,%edi
+  80286f:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802872:	89 f8                	mov    %edi,%eax
+  802874:	e8 06 f9 ff ff       	call   80217f <page_is_clean>
+  802879:	84 c0                	test   %al,%al
+  80287b:	0f 85 82 00 00 00    	jne    802903 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802881:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  802887:	72 a6                	jb     80282f <random_page_choice_func+0x1a>
+  802889:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  80288f:	77 9e                	ja     80282f <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802891:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802898:	a8 01                	test   $0x1,%al
+  80289a:	74 93                	je     80282f <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80289c:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8028a3:	f6 c4 04             	test   $0x4,%ah
+  8028a6:	75 87                	jne    80282f <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8028a8:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8028af:	f6 c4 02             	test   $0x2,%ah
+  8028b2:	0f 85 77 ff ff ff    	jne    80282f <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8028b8:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8028bf:	c1 e8 0c             	shr    $0xc,%eax
+  8028c2:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8028c5:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8028ca:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8028ce:	66 83 f8 01          	cmp    $0x1,%ax
+  8028d2:	0f 87 57 ff ff ff    	ja     80282f <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  8028d8:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8028de:	e8 1a ff ff ff       	call   8027fd <myRand>
+  8028e3:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  8028e9:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  8028ee:	29 fe                	sub    %edi,%esi
+  8028f0:	0f be c0             	movsbl %al,%eax
+  8028f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028f8:	f7 f6                	div    %esi
+  8028fa:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8028fc:	bb 15 00 00 00       	mov    $0x15,%ebx
+  802901:	eb 1c                	jmp    80291f <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  802903:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  802909:	e9 8f 00 00 00       	jmp    80299d <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  80290e:	e8 ea fe ff ff       	call   8027fd <myRand>
+  802913:	0f be c0             	movsbl %al,%eax
+  802916:	ba 00 00 00 00       	mov    $0x0,%edx
+  80291b:	f7 f6                	div    %esi
+  80291d:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  80291f:	83 eb 01             	sub    $0x1,%ebx
+  802922:	0f 84 c2 00 00 00    	je     8029ea <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  802928:	89 d0                	mov    %edx,%eax
+  80292a:	c1 e8 0a             	shr    $0xa,%eax
+  80292d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802934:	25 81 00 00 00       	and    $0x81,%eax
+  802939:	83 f8 01             	cmp    $0x1,%eax
+  80293c:	75 d0                	jne    80290e <random_page_choice_func+0xf9>
+  80293e:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  802944:	77 c8                	ja     80290e <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  802946:	89 d0                	mov    %edx,%eax
+  802948:	c1 e0 0c             	shl    $0xc,%eax
+  80294b:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  802950:	72 56                	jb     8029a8 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802952:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  802957:	77 65                	ja     8029be <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802959:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802960:	f6 c1 01             	test   $0x1,%cl
+  802963:	74 59                	je     8029be <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802965:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  80296c:	f6 c5 04             	test   $0x4,%ch
+  80296f:	75 4d                	jne    8029be <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  802971:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802978:	f6 c5 02             	test   $0x2,%ch
+  80297b:	75 41                	jne    8029be <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  80297d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802984:	c1 ea 0c             	shr    $0xc,%edx
+  802987:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  80298a:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  802990:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  802994:	66 83 fa 01          	cmp    $0x1,%dx
+  802998:	77 3a                	ja     8029d4 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  80299a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  80299d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029a0:	83 c4 1c             	add    $0x1c,%esp
+  8029a3:	5b                   	pop    %ebx
+  8029a4:	5e                   	pop    %esi
+  8029a5:	5f                   	pop    %edi
+  8029a6:	5d                   	pop    %ebp
+  8029a7:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8029a8:	e8 50 fe ff ff       	call   8027fd <myRand>
+  8029ad:	0f be c0             	movsbl %al,%eax
+  8029b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b5:	f7 f6                	div    %esi
+  8029b7:	01 fa                	add    %edi,%edx
+			continue;
+  8029b9:	e9 61 ff ff ff       	jmp    80291f <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  8029be:	e8 3a fe ff ff       	call   8027fd <myRand>
+  8029c3:	0f be c0             	movsbl %al,%eax
+  8029c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029cb:	f7 f6                	div    %esi
+  8029cd:	01 fa                	add    %edi,%edx
+			continue;
+  8029cf:	e9 4b ff ff ff       	jmp    80291f <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  8029d4:	e8 24 fe ff ff       	call   8027fd <myRand>
+  8029d9:	0f be c0             	movsbl %al,%eax
+  8029dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029e1:	f7 f6                	div    %esi
+  8029e3:	01 fa                	add    %edi,%edx
+			continue;
+  8029e5:	e9 35 ff ff ff       	jmp    80291f <random_page_choice_func+0x10a>
+	pgnum = 0;
+  8029ea:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  8029f1:	00 00 00 
+	return (void*)UTOP;
+  8029f4:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  8029fb:	eb a0                	jmp    80299d <random_page_choice_func+0x188>
+
+008029fd <nfu>:
+{
+  8029fd:	55                   	push   %ebp
+  8029fe:	89 e5                	mov    %esp,%ebp
+  802a00:	57                   	push   %edi
+  802a01:	56                   	push   %esi
+  802a02:	53                   	push   %ebx
+  802a03:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802a06:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  802a0c:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802a0e:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802a13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a18:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802a1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a24:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802a27:	eb 18                	jmp    802a41 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802a29:	f7 d0                	not    %eax
+  802a2b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802a30:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802a32:	83 c2 01             	add    $0x1,%edx
+  802a35:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802a3b:	0f 87 13 01 00 00    	ja     802b54 <nfu+0x157>
+		++num_searched_ptes;
+  802a41:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802a45:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802a48:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802a4d:	89 c1                	mov    %eax,%ecx
+  802a4f:	c1 e9 0a             	shr    $0xa,%ecx
+  802a52:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802a59:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802a5f:	83 f9 01             	cmp    $0x1,%ecx
+  802a62:	75 c5                	jne    802a29 <nfu+0x2c>
+  802a64:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802a69:	77 be                	ja     802a29 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802a6b:	89 c1                	mov    %eax,%ecx
+  802a6d:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a70:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802a76:	0f 82 a5 00 00 00    	jb     802b21 <nfu+0x124>
+  802a7c:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802a82:	0f 87 99 00 00 00    	ja     802b21 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802a88:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a8f:	f6 c1 01             	test   $0x1,%cl
+  802a92:	0f 84 89 00 00 00    	je     802b21 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802a98:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802a9f:	f6 c5 04             	test   $0x4,%ch
+  802aa2:	75 7d                	jne    802b21 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802aa4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802aab:	f6 c5 02             	test   $0x2,%ch
+  802aae:	75 71                	jne    802b21 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802ab0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802ab7:	c1 e9 0c             	shr    $0xc,%ecx
+  802aba:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802abd:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802ac3:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802ac7:	66 83 f9 01          	cmp    $0x1,%cx
+  802acb:	77 54                	ja     802b21 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  802acd:	89 f9                	mov    %edi,%ecx
+  802acf:	80 f9 ff             	cmp    $0xff,%cl
+  802ad2:	74 21                	je     802af5 <nfu+0xf8>
+  802ad4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802adb:	c1 e9 0c             	shr    $0xc,%ecx
+  802ade:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802ae1:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802ae7:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  802aeb:	89 fb                	mov    %edi,%ebx
+  802aed:	38 d9                	cmp    %bl,%cl
+  802aef:	73 30                	jae    802b21 <nfu+0x124>
+  802af1:	dd d8                	fstp   %st(0)
+  802af3:	eb 02                	jmp    802af7 <nfu+0xfa>
+  802af5:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  802af7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802afe:	c1 e9 0c             	shr    $0xc,%ecx
+  802b01:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b04:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802b0b:	89 fb                	mov    %edi,%ebx
+  802b0d:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802b10:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802b13:	db 45 e0             	fildl  -0x20(%ebp)
+  802b16:	d8 35 3c 57 80 00    	fdivs  0x80573c
+	return ret*ret;
+  802b1c:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802b1e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802b21:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802b24:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802b27:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802b2e:	df 6d e0             	fildll -0x20(%ebp)
+  802b31:	d9 c1                	fld    %st(1)
+  802b33:	d8 0d 40 57 80 00    	fmuls  0x805740
+  802b39:	d9 c9                	fxch   %st(1)
+  802b3b:	df f1                	fcomip %st(1),%st
+  802b3d:	dd d8                	fstp   %st(0)
+  802b3f:	0f 82 ed fe ff ff    	jb     802a32 <nfu+0x35>
+  802b45:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802b47:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  802b4c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802b4f:	c1 e0 0c             	shl    $0xc,%eax
+  802b52:	eb 0e                	jmp    802b62 <nfu+0x165>
+  802b54:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802b56:	89 f8                	mov    %edi,%eax
+  802b58:	3c ff                	cmp    $0xff,%al
+  802b5a:	74 0e                	je     802b6a <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802b5c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802b5f:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802b62:	83 c4 14             	add    $0x14,%esp
+  802b65:	5b                   	pop    %ebx
+  802b66:	5e                   	pop    %esi
+  802b67:	5f                   	pop    %edi
+  802b68:	5d                   	pop    %ebp
+  802b69:	c3                   	ret
+	pgnum = 0;
+  802b6a:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  802b71:	00 00 00 
+	return (void*)UTOP;
+  802b74:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b79:	eb e7                	jmp    802b62 <nfu+0x165>
+
+00802b7b <lru>:
+{
+  802b7b:	55                   	push   %ebp
+  802b7c:	89 e5                	mov    %esp,%ebp
+  802b7e:	57                   	push   %edi
+  802b7f:	56                   	push   %esi
+  802b80:	53                   	push   %ebx
+  802b81:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802b84:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  802b8a:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  802b91:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802b98:	be 00 00 00 00       	mov    $0x0,%esi
+  802b9d:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802ba4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ba9:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  802bac:	eb 18                	jmp    802bc6 <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802bae:	f7 d0                	not    %eax
+  802bb0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802bb5:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802bb7:	83 c2 01             	add    $0x1,%edx
+  802bba:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802bc0:	0f 87 fa 00 00 00    	ja     802cc0 <lru+0x145>
+		++num_searched_ptes;
+  802bc6:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802bc9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802bcc:	01 d0                	add    %edx,%eax
+  802bce:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802bd3:	89 c1                	mov    %eax,%ecx
+  802bd5:	c1 e9 0a             	shr    $0xa,%ecx
+  802bd8:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802bdf:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802be5:	83 f9 01             	cmp    $0x1,%ecx
+  802be8:	75 c4                	jne    802bae <lru+0x33>
+  802bea:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802bef:	77 bd                	ja     802bae <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802bf1:	89 c1                	mov    %eax,%ecx
+  802bf3:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802bf6:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802bfc:	0f 87 92 00 00 00    	ja     802c94 <lru+0x119>
+  802c02:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802c08:	0f 82 86 00 00 00    	jb     802c94 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802c0e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802c15:	f6 c1 01             	test   $0x1,%cl
+  802c18:	74 7a                	je     802c94 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802c1a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802c21:	f6 c5 04             	test   $0x4,%ch
+  802c24:	75 6e                	jne    802c94 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802c26:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802c2d:	f6 c5 02             	test   $0x2,%ch
+  802c30:	75 62                	jne    802c94 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802c32:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802c39:	c1 e9 0c             	shr    $0xc,%ecx
+  802c3c:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802c3f:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802c45:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802c49:	66 83 f9 01          	cmp    $0x1,%cx
+  802c4d:	77 45                	ja     802c94 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  802c4f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802c56:	c1 e9 0c             	shr    $0xc,%ecx
+  802c59:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802c5c:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802c62:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802c65:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802c68:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  802c6b:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802c6e:	19 df                	sbb    %ebx,%edi
+  802c70:	7c 22                	jl     802c94 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  802c72:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802c79:	c1 e9 0c             	shr    $0xc,%ecx
+  802c7c:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802c7f:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802c85:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802c88:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802c8b:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802c8e:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c91:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802c94:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  802c97:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802c9e:	df 6d e0             	fildll -0x20(%ebp)
+  802ca1:	d9 05 40 57 80 00    	flds   0x805740
+  802ca7:	d9 c9                	fxch   %st(1)
+  802ca9:	df f1                	fcomip %st(1),%st
+  802cab:	dd d8                	fstp   %st(0)
+  802cad:	0f 82 04 ff ff ff    	jb     802bb7 <lru+0x3c>
+			pgnum = pgnum_actual;
+  802cb3:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  802cb8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802cbb:	c1 e0 0c             	shl    $0xc,%eax
+  802cbe:	eb 06                	jmp    802cc6 <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  802cc0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802cc3:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802cc6:	83 c4 1c             	add    $0x1c,%esp
+  802cc9:	5b                   	pop    %ebx
+  802cca:	5e                   	pop    %esi
+  802ccb:	5f                   	pop    %edi
+  802ccc:	5d                   	pop    %ebp
+  802ccd:	c3                   	ret
+
+00802cce <set_page_choice_func>:
+{
+  802cce:	55                   	push   %ebp
+  802ccf:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  802cd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd4:	a3 44 60 80 00       	mov    %eax,0x806044
+}
+  802cd9:	5d                   	pop    %ebp
+  802cda:	c3                   	ret
+
+00802cdb <get_page_choice>:
+{
+  802cdb:	55                   	push   %ebp
+  802cdc:	89 e5                	mov    %esp,%ebp
+  802cde:	57                   	push   %edi
+  802cdf:	56                   	push   %esi
+  802ce0:	53                   	push   %ebx
+  802ce1:	83 ec 24             	sub    $0x24,%esp
+  802ce4:	8b 75 08             	mov    0x8(%ebp),%esi
+  802ce7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  802cea:	57                   	push   %edi
+  802ceb:	56                   	push   %esi
+  802cec:	ff 15 44 60 80 00    	call   *0x806044
+  802cf2:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802cf4:	83 c4 10             	add    $0x10,%esp
+  802cf7:	eb 25                	jmp    802d1e <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  802cf9:	83 ec 08             	sub    $0x8,%esp
+  802cfc:	c1 e0 16             	shl    $0x16,%eax
+  802cff:	50                   	push   %eax
+  802d00:	6a 00                	push   $0x0
+  802d02:	e8 ec e0 ff ff       	call   800df3 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802d07:	83 c4 10             	add    $0x10,%esp
+  802d0a:	85 c0                	test   %eax,%eax
+  802d0c:	75 43                	jne    802d51 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  802d0e:	83 ec 08             	sub    $0x8,%esp
+  802d11:	57                   	push   %edi
+  802d12:	56                   	push   %esi
+  802d13:	ff 15 44 60 80 00    	call   *0x806044
+  802d19:	89 c3                	mov    %eax,%ebx
+  802d1b:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802d1e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802d21:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  802d27:	0f 86 ae 00 00 00    	jbe    802ddb <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  802d32:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802d39:	81 e2 81 00 00 00    	and    $0x81,%edx
+  802d3f:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  802d45:	74 b2                	je     802cf9 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802d47:	83 c0 01             	add    $0x1,%eax
+  802d4a:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  802d4f:	75 e1                	jne    802d32 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802d51:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d54:	05 00 10 40 11       	add    $0x11401000,%eax
+  802d59:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802d5e:	76 1f                	jbe    802d7f <get_page_choice+0xa4>
+		return (void *) UTOP;
+  802d60:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  802d65:	89 d8                	mov    %ebx,%eax
+  802d67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d6a:	5b                   	pop    %ebx
+  802d6b:	5e                   	pop    %esi
+  802d6c:	5f                   	pop    %edi
+  802d6d:	5d                   	pop    %ebp
+  802d6e:	c3                   	ret
+		sys_page_split(0, pg_out);
+  802d6f:	83 ec 08             	sub    $0x8,%esp
+  802d72:	53                   	push   %ebx
+  802d73:	6a 00                	push   $0x0
+  802d75:	e8 79 e0 ff ff       	call   800df3 <sys_page_split>
+  802d7a:	83 c4 10             	add    $0x10,%esp
+  802d7d:	eb 6c                	jmp    802deb <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  802d7f:	83 ec 04             	sub    $0x4,%esp
+  802d82:	68 e8 52 80 00       	push   $0x8052e8
+  802d87:	68 cc 01 00 00       	push   $0x1cc
+  802d8c:	68 55 52 80 00       	push   $0x805255
+  802d91:	e8 e1 d3 ff ff       	call   800177 <_panic>
+		panic("We tried to page out code pages\n");
+  802d96:	83 ec 04             	sub    $0x4,%esp
+  802d99:	68 18 53 80 00       	push   $0x805318
+  802d9e:	68 d6 01 00 00       	push   $0x1d6
+  802da3:	68 55 52 80 00       	push   $0x805255
+  802da8:	e8 ca d3 ff ff       	call   800177 <_panic>
+		panic("Invalid mapping for the va\n");
+  802dad:	83 ec 04             	sub    $0x4,%esp
+  802db0:	68 62 52 80 00       	push   $0x805262
+  802db5:	68 da 01 00 00       	push   $0x1da
+  802dba:	68 55 52 80 00       	push   $0x805255
+  802dbf:	e8 b3 d3 ff ff       	call   800177 <_panic>
+		panic("We tried to page out a shared page\n");
+  802dc4:	83 ec 04             	sub    $0x4,%esp
+  802dc7:	68 3c 53 80 00       	push   $0x80533c
+  802dcc:	68 e0 01 00 00       	push   $0x1e0
+  802dd1:	68 55 52 80 00       	push   $0x805255
+  802dd6:	e8 9c d3 ff ff       	call   800177 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  802ddb:	89 de                	mov    %ebx,%esi
+  802ddd:	c1 ee 16             	shr    $0x16,%esi
+  802de0:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802de7:	a8 80                	test   $0x80,%al
+  802de9:	75 84                	jne    802d6f <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802deb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802dee:	05 00 10 40 11       	add    $0x11401000,%eax
+  802df3:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802df8:	76 85                	jbe    802d7f <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  802dfa:	89 d8                	mov    %ebx,%eax
+  802dfc:	e8 7e f3 ff ff       	call   80217f <page_is_clean>
+  802e01:	84 c0                	test   %al,%al
+  802e03:	0f 85 5c ff ff ff    	jne    802d65 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  802e09:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  802e10:	76 84                	jbe    802d96 <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  802e12:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802e19:	a8 01                	test   $0x1,%al
+  802e1b:	74 90                	je     802dad <get_page_choice+0xd2>
+  802e1d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e20:	c1 e8 0c             	shr    $0xc,%eax
+  802e23:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802e2a:	f6 c2 01             	test   $0x1,%dl
+  802e2d:	0f 84 7a ff ff ff    	je     802dad <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802e33:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  802e3a:	f6 c2 01             	test   $0x1,%dl
+  802e3d:	74 85                	je     802dc4 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802e3f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802e46:	f6 c2 01             	test   $0x1,%dl
+  802e49:	0f 84 75 ff ff ff    	je     802dc4 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802e4f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802e56:	f6 c6 04             	test   $0x4,%dh
+  802e59:	0f 85 65 ff ff ff    	jne    802dc4 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  802e5f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802e66:	f6 c6 02             	test   $0x2,%dh
+  802e69:	0f 85 55 ff ff ff    	jne    802dc4 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  802e6f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802e76:	c1 e8 0c             	shr    $0xc,%eax
+  802e79:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802e7c:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802e81:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802e85:	66 83 f8 01          	cmp    $0x1,%ax
+  802e89:	0f 86 d6 fe ff ff    	jbe    802d65 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  802e8f:	83 ec 04             	sub    $0x4,%esp
+  802e92:	68 60 53 80 00       	push   $0x805360
+  802e97:	68 e2 01 00 00       	push   $0x1e2
+  802e9c:	68 55 52 80 00       	push   $0x805255
+  802ea1:	e8 d1 d2 ff ff       	call   800177 <_panic>
+
+00802ea6 <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  802ea6:	55                   	push   %ebp
+  802ea7:	89 e5                	mov    %esp,%ebp
+  802ea9:	57                   	push   %edi
+  802eaa:	56                   	push   %esi
+  802eab:	53                   	push   %ebx
+  802eac:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  802eaf:	e8 e8 f6 ff ff       	call   80259c <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  802eb4:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802eb9:	85 c0                	test   %eax,%eax
+  802ebb:	74 41                	je     802efe <page_share_paged_out+0x58>
+  802ebd:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  802ec4:	0f 84 fd 00 00 00    	je     802fc7 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  802eca:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802ed1:	00 00 00 
+  802ed4:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  802edb:	00 00 00 
+  802ede:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ee3:	eb 2c                	jmp    802f11 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802ee5:	83 c3 04             	add    $0x4,%ebx
+  802ee8:	39 f3                	cmp    %esi,%ebx
+  802eea:	74 1a                	je     802f06 <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  802eec:	8b 03                	mov    (%ebx),%eax
+  802eee:	a8 01                	test   $0x1,%al
+  802ef0:	74 f3                	je     802ee5 <page_share_paged_out+0x3f>
+  802ef2:	c1 e8 0c             	shr    $0xc,%eax
+  802ef5:	e8 2b f5 ff ff       	call   802425 <page_share_slot>
+  802efa:	85 c0                	test   %eax,%eax
+  802efc:	79 e7                	jns    802ee5 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  802efe:	83 c4 0c             	add    $0xc,%esp
+  802f01:	5b                   	pop    %ebx
+  802f02:	5e                   	pop    %esi
+  802f03:	5f                   	pop    %edi
+  802f04:	5d                   	pop    %ebp
+  802f05:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  802f06:	83 c7 04             	add    $0x4,%edi
+  802f09:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  802f0f:	74 1b                	je     802f2c <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  802f11:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  802f16:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  802f19:	f6 c3 01             	test   $0x1,%bl
+  802f1c:	74 e8                	je     802f06 <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  802f1e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802f24:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  802f2a:	eb bc                	jmp    802ee8 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802f2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f31:	eb 11                	jmp    802f44 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  802f33:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802f39:	83 c3 01             	add    $0x1,%ebx
+  802f3c:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802f42:	77 41                	ja     802f85 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  802f44:	89 d8                	mov    %ebx,%eax
+  802f46:	c1 e8 0a             	shr    $0xa,%eax
+  802f49:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802f50:	25 81 00 00 00       	and    $0x81,%eax
+  802f55:	83 f8 01             	cmp    $0x1,%eax
+  802f58:	75 d9                	jne    802f33 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  802f5a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802f61:	25 81 00 00 00       	and    $0x81,%eax
+  802f66:	3d 80 00 00 00       	cmp    $0x80,%eax
+  802f6b:	75 cc                	jne    802f39 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  802f6d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802f74:	c1 e8 0c             	shr    $0xc,%eax
+  802f77:	e8 a9 f4 ff ff       	call   802425 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  802f7c:	85 c0                	test   %eax,%eax
+  802f7e:	79 b9                	jns    802f39 <page_share_paged_out+0x93>
+  802f80:	e9 79 ff ff ff       	jmp    802efe <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  802f85:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802f8c:	75 13                	jne    802fa1 <page_share_paged_out+0xfb>
+  802f8e:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802f95:	75 1d                	jne    802fb4 <page_share_paged_out+0x10e>
+	return 0;
+  802f97:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f9c:	e9 5d ff ff ff       	jmp    802efe <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  802fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa6:	e8 46 f4 ff ff       	call   8023f1 <page_share_send>
+  802fab:	85 c0                	test   %eax,%eax
+  802fad:	79 df                	jns    802f8e <page_share_paged_out+0xe8>
+  802faf:	e9 4a ff ff ff       	jmp    802efe <page_share_paged_out+0x58>
+  802fb4:	b8 01 00 00 00       	mov    $0x1,%eax
+  802fb9:	e8 33 f4 ff ff       	call   8023f1 <page_share_send>
+  802fbe:	85 c0                	test   %eax,%eax
+  802fc0:	79 d5                	jns    802f97 <page_share_paged_out+0xf1>
+  802fc2:	e9 37 ff ff ff       	jmp    802efe <page_share_paged_out+0x58>
+		return 0;
+  802fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fcc:	e9 2d ff ff ff       	jmp    802efe <page_share_paged_out+0x58>
+
+00802fd1 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  802fd1:	55                   	push   %ebp
+  802fd2:	89 e5                	mov    %esp,%ebp
+  802fd4:	56                   	push   %esi
+  802fd5:	53                   	push   %ebx
+  802fd6:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  802fd9:	e8 be f5 ff ff       	call   80259c <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  802fde:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  802fe3:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  802fea:	0f 84 82 00 00 00    	je     803072 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  802ff0:	83 ec 0c             	sub    $0xc,%esp
+  802ff3:	68 00 10 00 00       	push   $0x1000
+  802ff8:	e8 84 11 00 00       	call   804181 <malloc>
+  802ffd:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  802fff:	83 c4 0c             	add    $0xc,%esp
+  803002:	6a 14                	push   $0x14
+  803004:	6a 00                	push   $0x0
+  803006:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803009:	50                   	push   %eax
+  80300a:	e8 7b d9 ff ff       	call   80098a <memset>
+  80300f:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  803012:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  803017:	83 ec 0c             	sub    $0xc,%esp
+  80301a:	6a 07                	push   $0x7
+  80301c:	6a 01                	push   $0x1
+  80301e:	53                   	push   %ebx
+  80301f:	6a 03                	push   $0x3
+  803021:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803028:	e8 b7 19 00 00       	call   8049e4 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  80302d:	8b 03                	mov    (%ebx),%eax
+  80302f:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803032:	8b 43 04             	mov    0x4(%ebx),%eax
+  803035:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  803038:	8b 43 08             	mov    0x8(%ebx),%eax
+  80303b:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  80303e:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803041:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  803044:	8b 43 10             	mov    0x10(%ebx),%eax
+  803047:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  80304a:	83 c6 01             	add    $0x1,%esi
+  80304d:	83 c4 20             	add    $0x20,%esp
+  803050:	83 fe 02             	cmp    $0x2,%esi
+  803053:	75 c2                	jne    803017 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  803055:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803058:	89 03                	mov    %eax,(%ebx)
+  80305a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80305d:	89 43 04             	mov    %eax,0x4(%ebx)
+  803060:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803063:	89 43 08             	mov    %eax,0x8(%ebx)
+  803066:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803069:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80306c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80306f:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  803072:	89 d8                	mov    %ebx,%eax
+  803074:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803077:	5b                   	pop    %ebx
+  803078:	5e                   	pop    %esi
+  803079:	5d                   	pop    %ebp
+  80307a:	c3                   	ret
+
+0080307b <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  80307b:	55                   	push   %ebp
+  80307c:	89 e5                	mov    %esp,%ebp
+  80307e:	53                   	push   %ebx
+  80307f:	83 ec 10             	sub    $0x10,%esp
+  803082:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  803085:	68 a7 4d 80 00       	push   $0x804da7
+  80308a:	e8 c3 d1 ff ff       	call   800252 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  80308f:	83 c4 08             	add    $0x8,%esp
+  803092:	ff 33                	push   (%ebx)
+  803094:	68 94 53 80 00       	push   $0x805394
+  803099:	e8 b4 d1 ff ff       	call   800252 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  80309e:	83 c4 08             	add    $0x8,%esp
+  8030a1:	ff 73 04             	push   0x4(%ebx)
+  8030a4:	68 7e 52 80 00       	push   $0x80527e
+  8030a9:	e8 a4 d1 ff ff       	call   800252 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  8030ae:	83 c4 08             	add    $0x8,%esp
+  8030b1:	ff 73 08             	push   0x8(%ebx)
+  8030b4:	68 b4 53 80 00       	push   $0x8053b4
+  8030b9:	e8 94 d1 ff ff       	call   800252 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  8030be:	83 c4 08             	add    $0x8,%esp
+  8030c1:	ff 73 0c             	push   0xc(%ebx)
+  8030c4:	68 d8 53 80 00       	push   $0x8053d8
+  8030c9:	e8 84 d1 ff ff       	call   800252 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  8030ce:	83 c4 08             	add    $0x8,%esp
+  8030d1:	ff 73 10             	push   0x10(%ebx)
+  8030d4:	68 fc 53 80 00       	push   $0x8053fc
+  8030d9:	e8 74 d1 ff ff       	call   800252 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  8030de:	83 c4 08             	add    $0x8,%esp
+  8030e1:	ff 35 08 b0 80 00    	push   0x80b008
+  8030e7:	68 38 54 80 00       	push   $0x805438
+  8030ec:	e8 61 d1 ff ff       	call   800252 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  8030f1:	83 c4 08             	add    $0x8,%esp
+  8030f4:	ff 35 04 b0 80 00    	push   0x80b004
+  8030fa:	68 6c 54 80 00       	push   $0x80546c
+  8030ff:	e8 4e d1 ff ff       	call   800252 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  803104:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803109:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  80310c:	8b 50 68             	mov    0x68(%eax),%edx
+  80310f:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  803112:	51                   	push   %ecx
+  803113:	52                   	push   %edx
+  803114:	50                   	push   %eax
+  803115:	68 ac 54 80 00       	push   $0x8054ac
+  80311a:	e8 33 d1 ff ff       	call   800252 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  80311f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803124:	8b 40 70             	mov    0x70(%eax),%eax
+  803127:	83 c4 18             	add    $0x18,%esp
+  80312a:	50                   	push   %eax
+  80312b:	68 e0 54 80 00       	push   $0x8054e0
+  803130:	e8 1d d1 ff ff       	call   800252 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  803135:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  80313b:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803141:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  803146:	51                   	push   %ecx
+  803147:	52                   	push   %edx
+  803148:	50                   	push   %eax
+  803149:	68 10 55 80 00       	push   $0x805510
+  80314e:	e8 ff d0 ff ff       	call   800252 <cprintf>
+	cprintf("\n");
+  803153:	83 c4 14             	add    $0x14,%esp
+  803156:	68 a7 4d 80 00       	push   $0x804da7
+  80315b:	e8 f2 d0 ff ff       	call   800252 <cprintf>
+}
+  803160:	83 c4 10             	add    $0x10,%esp
+  803163:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803166:	c9                   	leave
+  803167:	c3                   	ret
+
+00803168 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  803168:	55                   	push   %ebp
+  803169:	89 e5                	mov    %esp,%ebp
+  80316b:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  80316e:	e8 5e fe ff ff       	call   802fd1 <get_paging_stats>
+  803173:	83 ec 0c             	sub    $0xc,%esp
+  803176:	50                   	push   %eax
+  803177:	e8 ff fe ff ff       	call   80307b <print_paging_stats>
+}
+  80317c:	83 c4 10             	add    $0x10,%esp
+  80317f:	c9                   	leave
+  803180:	c3                   	ret
+
+00803181 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803181:	55                   	push   %ebp
+  803182:	89 e5                	mov    %esp,%ebp
+  803184:	53                   	push   %ebx
+  803185:	83 ec 04             	sub    $0x4,%esp
+  803188:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  80318b:	eb 13                	jmp    8031a0 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  80318d:	83 ec 04             	sub    $0x4,%esp
+  803190:	6a ff                	push   $0xffffffff
+  803192:	53                   	push   %ebx
+  803193:	68 00 f0 ff ee       	push   $0xeefff000
+  803198:	e8 68 e0 ff ff       	call   801205 <sys_futex_wait>
+  80319d:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  8031a0:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  8031a5:	39 d8                	cmp    %ebx,%eax
+  8031a7:	74 e4                	je     80318d <mem_pressure_wait+0xc>
+	return now;
+}
+  8031a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031ac:	c9                   	leave
+  8031ad:	c3                   	ret
+
+008031ae <init_map_dir>:
+
+void
+init_map_dir()
+{
+  8031ae:	55                   	push   %ebp
+  8031af:	89 e5                	mov    %esp,%ebp
+  8031b1:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  8031b4:	68 20 3e 80 00       	push   $0x803e20
+  8031b9:	e8 32 16 00 00       	call   8047f0 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  8031be:	c7 05 14 e9 80 00 00 	movl   $0xdeadb000,0x80e914
+  8031c5:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  8031c8:	83 c4 0c             	add    $0xc,%esp
+  8031cb:	68 07 02 00 00       	push   $0x207
+  8031d0:	68 00 b0 ad de       	push   $0xdeadb000
+  8031d5:	6a 00                	push   $0x0
+  8031d7:	e8 50 db ff ff       	call   800d2c <sys_page_alloc>
+  8031dc:	83 c4 10             	add    $0x10,%esp
+  8031df:	85 c0                	test   %eax,%eax
+  8031e1:	78 0c                	js     8031ef <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  8031e3:	e8 b4 f3 ff ff       	call   80259c <find_paging_env>
+	page_ring_ready();
+  8031e8:	e8 7f f2 ff ff       	call   80246c <page_ring_ready>
+}
+  8031ed:	c9                   	leave
+  8031ee:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  8031ef:	50                   	push   %eax
+  8031f0:	68 9c 52 80 00       	push   $0x80529c
+  8031f5:	68 13 05 00 00       	push   $0x513
+  8031fa:	68 55 52 80 00       	push   $0x805255
+  8031ff:	e8 73 cf ff ff       	call   800177 <_panic>
+
+00803204 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  803204:	55                   	push   %ebp
+  803205:	89 e5                	mov    %esp,%ebp
+  803207:	57                   	push   %edi
+  803208:	56                   	push   %esi
+  803209:	53                   	push   %ebx
+  80320a:	83 ec 0c             	sub    $0xc,%esp
+  80320d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  803210:	89 fa                	mov    %edi,%edx
+  803212:	c1 ea 16             	shr    $0x16,%edx
+  803215:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  80321a:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  80321d:	f6 06 01             	testb  $0x1,(%esi)
+  803220:	75 3e                	jne    803260 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803222:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  803227:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80322b:	74 47                	je     803274 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  80322d:	83 ec 0c             	sub    $0xc,%esp
+  803230:	6a 01                	push   $0x1
+  803232:	e8 f2 11 00 00       	call   804429 <va_alloc>
+  803237:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  803239:	83 c4 10             	add    $0x10,%esp
+  80323c:	85 c0                	test   %eax,%eax
+  80323e:	74 34                	je     803274 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803240:	6a 00                	push   $0x0
+  803242:	68 07 02 00 00       	push   $0x207
+  803247:	50                   	push   %eax
+  803248:	6a 00                	push   $0x0
+  80324a:	e8 df 02 00 00       	call   80352e <page_alloc>
+  80324f:	83 c4 10             	add    $0x10,%esp
+  803252:	85 c0                	test   %eax,%eax
+  803254:	78 28                	js     80327e <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  803256:	f6 06 01             	testb  $0x1,(%esi)
+  803259:	75 38                	jne    803293 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  80325b:	83 cb 01             	or     $0x1,%ebx
+  80325e:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803260:	89 f8                	mov    %edi,%eax
+  803262:	c1 e8 0a             	shr    $0xa,%eax
+  803265:	25 fc 0f 00 00       	and    $0xffc,%eax
+  80326a:	8b 1e                	mov    (%esi),%ebx
+  80326c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803272:	01 c3                	add    %eax,%ebx
+}
+  803274:	89 d8                	mov    %ebx,%eax
+  803276:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803279:	5b                   	pop    %ebx
+  80327a:	5e                   	pop    %esi
+  80327b:	5f                   	pop    %edi
+  80327c:	5d                   	pop    %ebp
+  80327d:	c3                   	ret
+			va_free(page, 1);
+  80327e:	83 ec 08             	sub    $0x8,%esp
+  803281:	6a 01                	push   $0x1
+  803283:	53                   	push   %ebx
+  803284:	e8 d8 12 00 00       	call   804561 <va_free>
+			return NULL;
+  803289:	83 c4 10             	add    $0x10,%esp
+  80328c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803291:	eb e1                	jmp    803274 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  803293:	83 ec 08             	sub    $0x8,%esp
+  803296:	53                   	push   %ebx
+  803297:	6a 00                	push   $0x0
+  803299:	e8 13 db ff ff       	call   800db1 <sys_page_unmap>
+			va_free(page, 1);
+  80329e:	83 c4 08             	add    $0x8,%esp
+  8032a1:	6a 01                	push   $0x1
+  8032a3:	53                   	push   %ebx
+  8032a4:	e8 b8 12 00 00       	call   804561 <va_free>
+  8032a9:	83 c4 10             	add    $0x10,%esp
+  8032ac:	eb b2                	jmp    803260 <umapdir_walk+0x5c>
+
+008032ae <page_out>:
+{
+  8032ae:	55                   	push   %ebp
+  8032af:	89 e5                	mov    %esp,%ebp
+  8032b1:	57                   	push   %edi
+  8032b2:	56                   	push   %esi
+  8032b3:	53                   	push   %ebx
+  8032b4:	83 ec 5c             	sub    $0x5c,%esp
+  8032b7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  8032ba:	e8 dd f2 ff ff       	call   80259c <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  8032bf:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  8032c4:	85 c0                	test   %eax,%eax
+  8032c6:	74 1e                	je     8032e6 <page_out+0x38>
+  8032c8:	83 ec 0c             	sub    $0xc,%esp
+  8032cb:	6a 00                	push   $0x0
+  8032cd:	6a 00                	push   $0x0
+  8032cf:	6a 00                	push   $0x0
+  8032d1:	6a 08                	push   $0x8
+  8032d3:	50                   	push   %eax
+  8032d4:	e8 0b 17 00 00       	call   8049e4 <ipc_call>
+  8032d9:	89 c3                	mov    %eax,%ebx
+  8032db:	83 c4 20             	add    $0x20,%esp
+  8032de:	85 c0                	test   %eax,%eax
+  8032e0:	0f 84 ac 00 00 00    	je     803392 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  8032e6:	83 ec 08             	sub    $0x8,%esp
+  8032e9:	ff 75 0c             	push   0xc(%ebp)
+  8032ec:	57                   	push   %edi
+  8032ed:	e8 e9 f9 ff ff       	call   802cdb <get_page_choice>
+  8032f2:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  8032f4:	83 c4 10             	add    $0x10,%esp
+  8032f7:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8032fc:	0f 84 18 02 00 00    	je     80351a <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803302:	e8 78 ee ff ff       	call   80217f <page_is_clean>
+  803307:	84 c0                	test   %al,%al
+  803309:	0f 85 8c 00 00 00    	jne    80339b <page_out+0xed>
+	if (pagingenv == 0)
+  80330f:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803316:	0f 84 08 02 00 00    	je     803524 <page_out+0x276>
+	if (page_ring_ready())
+  80331c:	e8 4b f1 ff ff       	call   80246c <page_ring_ready>
+  803321:	89 c3                	mov    %eax,%ebx
+  803323:	85 c0                	test   %eax,%eax
+  803325:	0f 85 89 00 00 00    	jne    8033b4 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  80332b:	83 ec 0c             	sub    $0xc,%esp
+  80332e:	6a 05                	push   $0x5
+  803330:	6a 01                	push   $0x1
+  803332:	56                   	push   %esi
+  803333:	6a 01                	push   $0x1
+  803335:	ff 35 40 b0 80 00    	push   0x80b040
+  80333b:	e8 a4 16 00 00       	call   8049e4 <ipc_call>
+  803340:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803342:	83 c4 20             	add    $0x20,%esp
+  803345:	85 c0                	test   %eax,%eax
+  803347:	0f 88 b8 01 00 00    	js     803505 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  80334d:	89 f0                	mov    %esi,%eax
+  80334f:	c1 e8 0c             	shr    $0xc,%eax
+  803352:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803359:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  80335c:	83 ec 08             	sub    $0x8,%esp
+  80335f:	56                   	push   %esi
+  803360:	6a 00                	push   $0x0
+  803362:	e8 4a da ff ff       	call   800db1 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803367:	83 c4 08             	add    $0x8,%esp
+  80336a:	6a 01                	push   $0x1
+  80336c:	56                   	push   %esi
+  80336d:	e8 92 fe ff ff       	call   803204 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803372:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803375:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  80337b:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  80337e:	09 fe                	or     %edi,%esi
+  803380:	83 ce 01             	or     $0x1,%esi
+  803383:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803385:	83 c4 10             	add    $0x10,%esp
+}
+  803388:	89 d8                	mov    %ebx,%eax
+  80338a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80338d:	5b                   	pop    %ebx
+  80338e:	5e                   	pop    %esi
+  80338f:	5f                   	pop    %edi
+  803390:	5d                   	pop    %ebp
+  803391:	c3                   	ret
+		num_page_reclaims++;
+  803392:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  803399:	eb ed                	jmp    803388 <page_out+0xda>
+		num_page_drops++;
+  80339b:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  8033a2:	83 ec 08             	sub    $0x8,%esp
+  8033a5:	56                   	push   %esi
+  8033a6:	6a 00                	push   $0x0
+  8033a8:	e8 04 da ff ff       	call   800db1 <sys_page_unmap>
+  8033ad:	89 c3                	mov    %eax,%ebx
+  8033af:	83 c4 10             	add    $0x10,%esp
+  8033b2:	eb d4                	jmp    803388 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8033b4:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  8033b6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8033bb:	2d 00 10 00 00       	sub    $0x1000,%eax
+  8033c0:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  8033c3:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  8033c5:	83 c0 08             	add    $0x8,%eax
+  8033c8:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  8033cb:	b8 07 00 00 00       	mov    $0x7,%eax
+  8033d0:	e8 e5 ef ff ff       	call   8023ba <page_ring_reserve>
+	first = ring->sq_tail;
+  8033d5:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8033da:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  8033dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  8033e2:	83 ec 04             	sub    $0x4,%esp
+  8033e5:	68 00 10 00 00       	push   $0x1000
+  8033ea:	56                   	push   %esi
+  8033eb:	89 d8                	mov    %ebx,%eax
+  8033ed:	c1 e0 0c             	shl    $0xc,%eax
+  8033f0:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  8033f5:	50                   	push   %eax
+  8033f6:	e8 26 d6 ff ff       	call   800a21 <memcpy>
+		vas[n] = va;
+  8033fb:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  8033ff:	89 d9                	mov    %ebx,%ecx
+  803401:	ba 00 00 00 00       	mov    $0x0,%edx
+  803406:	b8 01 00 00 00       	mov    $0x1,%eax
+  80340b:	e8 de ee ff ff       	call   8022ee <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803410:	8d 43 01             	lea    0x1(%ebx),%eax
+  803413:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803416:	83 c4 10             	add    $0x10,%esp
+  803419:	83 fb 06             	cmp    $0x6,%ebx
+  80341c:	74 62                	je     803480 <page_out+0x1d2>
+  80341e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803421:	eb 15                	jmp    803438 <page_out+0x18a>
+			num_page_drops++;
+  803423:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  80342a:	83 ec 08             	sub    $0x8,%esp
+  80342d:	56                   	push   %esi
+  80342e:	6a 00                	push   $0x0
+  803430:	e8 7c d9 ff ff       	call   800db1 <sys_page_unmap>
+  803435:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803438:	83 ec 08             	sub    $0x8,%esp
+  80343b:	53                   	push   %ebx
+  80343c:	57                   	push   %edi
+  80343d:	e8 99 f8 ff ff       	call   802cdb <get_page_choice>
+  803442:	89 c6                	mov    %eax,%esi
+  803444:	83 c4 10             	add    $0x10,%esp
+  803447:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  80344c:	74 32                	je     803480 <page_out+0x1d2>
+  80344e:	e8 2c ed ff ff       	call   80217f <page_is_clean>
+  803453:	84 c0                	test   %al,%al
+  803455:	75 cc                	jne    803423 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803457:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  80345a:	39 c6                	cmp    %eax,%esi
+  80345c:	72 07                	jb     803465 <page_out+0x1b7>
+  80345e:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803461:	39 c6                	cmp    %eax,%esi
+  803463:	72 1b                	jb     803480 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803465:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80346a:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  80346d:	eb 03                	jmp    803472 <page_out+0x1c4>
+  80346f:	83 c3 01             	add    $0x1,%ebx
+  803472:	39 da                	cmp    %ebx,%edx
+  803474:	0f 84 68 ff ff ff    	je     8033e2 <page_out+0x134>
+  80347a:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  80347e:	75 ef                	jne    80346f <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803480:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803483:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803486:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803489:	e8 a6 ee ff ff       	call   802334 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  80348e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803493:	eb 42                	jmp    8034d7 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803495:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803499:	89 f8                	mov    %edi,%eax
+  80349b:	c1 e8 0c             	shr    $0xc,%eax
+  80349e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8034a5:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  8034a8:	83 ec 08             	sub    $0x8,%esp
+  8034ab:	57                   	push   %edi
+  8034ac:	6a 00                	push   $0x0
+  8034ae:	e8 fe d8 ff ff       	call   800db1 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  8034b3:	83 c4 08             	add    $0x8,%esp
+  8034b6:	6a 01                	push   $0x1
+  8034b8:	57                   	push   %edi
+  8034b9:	e8 46 fd ff ff       	call   803204 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  8034be:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  8034c1:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  8034c7:	c1 e6 0c             	shl    $0xc,%esi
+  8034ca:	09 d6                	or     %edx,%esi
+  8034cc:	83 ce 01             	or     $0x1,%esi
+  8034cf:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  8034d1:	83 c3 01             	add    $0x1,%ebx
+  8034d4:	83 c4 10             	add    $0x10,%esp
+  8034d7:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  8034da:	39 c3                	cmp    %eax,%ebx
+  8034dc:	74 1d                	je     8034fb <page_out+0x24d>
+		if (res[i] < 0)
+  8034de:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  8034e2:	85 f6                	test   %esi,%esi
+  8034e4:	79 af                	jns    803495 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  8034e6:	56                   	push   %esi
+  8034e7:	68 40 55 80 00       	push   $0x805540
+  8034ec:	68 d1 02 00 00       	push   $0x2d1
+  8034f1:	68 55 52 80 00       	push   $0x805255
+  8034f6:	e8 7c cc ff ff       	call   800177 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  8034fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803500:	e9 83 fe ff ff       	jmp    803388 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803505:	50                   	push   %eax
+  803506:	68 40 55 80 00       	push   $0x805540
+  80350b:	68 0a 03 00 00       	push   $0x30a
+  803510:	68 55 52 80 00       	push   $0x805255
+  803515:	e8 5d cc ff ff       	call   800177 <_panic>
+		return -E_NO_MEM;
+  80351a:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  80351f:	e9 64 fe ff ff       	jmp    803388 <page_out+0xda>
+		return -E_PAGING;
+  803524:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803529:	e9 5a fe ff ff       	jmp    803388 <page_out+0xda>
+
+0080352e <page_alloc>:
+{
+  80352e:	55                   	push   %ebp
+  80352f:	89 e5                	mov    %esp,%ebp
+  803531:	57                   	push   %edi
+  803532:	56                   	push   %esi
+  803533:	53                   	push   %ebx
+  803534:	83 ec 0c             	sub    $0xc,%esp
+  803537:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80353a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  80353d:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803544:	74 34                	je     80357a <page_alloc+0x4c>
+	if (check_mte)
+  803546:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  80354a:	75 35                	jne    803581 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  80354c:	83 ec 04             	sub    $0x4,%esp
+  80354f:	ff 75 10             	push   0x10(%ebp)
+  803552:	56                   	push   %esi
+  803553:	57                   	push   %edi
+  803554:	e8 d3 d7 ff ff       	call   800d2c <sys_page_alloc>
+  803559:	89 c3                	mov    %eax,%ebx
+  80355b:	83 c4 10             	add    $0x10,%esp
+  80355e:	85 c0                	test   %eax,%eax
+  803560:	79 52                	jns    8035b4 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803562:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803565:	75 52                	jne    8035b9 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803567:	83 ec 08             	sub    $0x8,%esp
+  80356a:	56                   	push   %esi
+  80356b:	57                   	push   %edi
+  80356c:	e8 3d fd ff ff       	call   8032ae <page_out>
+  803571:	83 c4 10             	add    $0x10,%esp
+  803574:	85 c0                	test   %eax,%eax
+  803576:	79 d4                	jns    80354c <page_alloc+0x1e>
+  803578:	eb 3f                	jmp    8035b9 <page_alloc+0x8b>
+		init_map_dir();
+  80357a:	e8 2f fc ff ff       	call   8031ae <init_map_dir>
+  80357f:	eb c5                	jmp    803546 <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803581:	83 ec 08             	sub    $0x8,%esp
+  803584:	6a 00                	push   $0x0
+  803586:	56                   	push   %esi
+  803587:	e8 78 fc ff ff       	call   803204 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  80358c:	83 c4 10             	add    $0x10,%esp
+  80358f:	85 c0                	test   %eax,%eax
+  803591:	74 b9                	je     80354c <page_alloc+0x1e>
+  803593:	8b 10                	mov    (%eax),%edx
+  803595:	f6 c2 01             	test   $0x1,%dl
+  803598:	74 b2                	je     80354c <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  80359a:	83 ec 08             	sub    $0x8,%esp
+  80359d:	56                   	push   %esi
+  80359e:	52                   	push   %edx
+  80359f:	50                   	push   %eax
+  8035a0:	68 64 55 80 00       	push   $0x805564
+  8035a5:	68 34 03 00 00       	push   $0x334
+  8035aa:	68 55 52 80 00       	push   $0x805255
+  8035af:	e8 c3 cb ff ff       	call   800177 <_panic>
+	return 0;
+  8035b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8035b9:	89 d8                	mov    %ebx,%eax
+  8035bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035be:	5b                   	pop    %ebx
+  8035bf:	5e                   	pop    %esi
+  8035c0:	5f                   	pop    %edi
+  8035c1:	5d                   	pop    %ebp
+  8035c2:	c3                   	ret
+
+008035c3 <page_adopt>:
+{
+  8035c3:	55                   	push   %ebp
+  8035c4:	89 e5                	mov    %esp,%ebp
+  8035c6:	56                   	push   %esi
+  8035c7:	53                   	push   %ebx
+  8035c8:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  8035ca:	c1 e8 16             	shr    $0x16,%eax
+  8035cd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8035d4:	25 81 00 00 00       	and    $0x81,%eax
+  8035d9:	83 f8 01             	cmp    $0x1,%eax
+  8035dc:	75 53                	jne    803631 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  8035de:	89 d8                	mov    %ebx,%eax
+  8035e0:	c1 e8 0c             	shr    $0xc,%eax
+  8035e3:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  8035ea:	89 f2                	mov    %esi,%edx
+  8035ec:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  8035f2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  8035f7:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  8035fd:	75 37                	jne    803636 <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  8035ff:	83 ec 08             	sub    $0x8,%esp
+  803602:	6a 01                	push   $0x1
+  803604:	53                   	push   %ebx
+  803605:	e8 fa fb ff ff       	call   803204 <umapdir_walk>
+  80360a:	83 c4 10             	add    $0x10,%esp
+  80360d:	85 c0                	test   %eax,%eax
+  80360f:	74 2c                	je     80363d <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803611:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803617:	83 ce 01             	or     $0x1,%esi
+  80361a:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  80361c:	83 ec 08             	sub    $0x8,%esp
+  80361f:	53                   	push   %ebx
+  803620:	6a 00                	push   $0x0
+  803622:	e8 8a d7 ff ff       	call   800db1 <sys_page_unmap>
+	return 1;
+  803627:	83 c4 10             	add    $0x10,%esp
+  80362a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80362f:	eb 05                	jmp    803636 <page_adopt+0x73>
+		return 0;
+  803631:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803636:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803639:	5b                   	pop    %ebx
+  80363a:	5e                   	pop    %esi
+  80363b:	5d                   	pop    %ebp
+  80363c:	c3                   	ret
+		return -E_NO_MEM;
+  80363d:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803642:	eb f2                	jmp    803636 <page_adopt+0x73>
+
+00803644 <page_forget>:
+{
+  803644:	55                   	push   %ebp
+  803645:	89 e5                	mov    %esp,%ebp
+  803647:	53                   	push   %ebx
+  803648:	83 ec 04             	sub    $0x4,%esp
+  80364b:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  80364d:	e8 4a ef ff ff       	call   80259c <find_paging_env>
+	if (pagingenv == 0)
+  803652:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803659:	74 39                	je     803694 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  80365b:	89 d8                	mov    %ebx,%eax
+  80365d:	c1 e8 16             	shr    $0x16,%eax
+  803660:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803667:	25 81 00 00 00       	and    $0x81,%eax
+  80366c:	83 f8 01             	cmp    $0x1,%eax
+  80366f:	74 28                	je     803699 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803671:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803678:	74 1a                	je     803694 <page_forget+0x50>
+  80367a:	83 ec 08             	sub    $0x8,%esp
+  80367d:	6a 00                	push   $0x0
+  80367f:	53                   	push   %ebx
+  803680:	e8 7f fb ff ff       	call   803204 <umapdir_walk>
+  803685:	89 c3                	mov    %eax,%ebx
+  803687:	83 c4 10             	add    $0x10,%esp
+  80368a:	85 c0                	test   %eax,%eax
+  80368c:	74 06                	je     803694 <page_forget+0x50>
+  80368e:	8b 00                	mov    (%eax),%eax
+  803690:	a8 01                	test   $0x1,%al
+  803692:	75 2b                	jne    8036bf <page_forget+0x7b>
+}
+  803694:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803697:	c9                   	leave
+  803698:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803699:	89 d8                	mov    %ebx,%eax
+  80369b:	c1 e8 0c             	shr    $0xc,%eax
+  80369e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8036a5:	89 c2                	mov    %eax,%edx
+  8036a7:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  8036ad:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  8036b3:	75 bc                	jne    803671 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  8036b5:	c1 e8 0c             	shr    $0xc,%eax
+  8036b8:	e8 5c ee ff ff       	call   802519 <page_remove_slot>
+		return;
+  8036bd:	eb d5                	jmp    803694 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  8036bf:	c1 e8 0c             	shr    $0xc,%eax
+  8036c2:	e8 52 ee ff ff       	call   802519 <page_remove_slot>
+	*mte = 0;
+  8036c7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8036cd:	eb c5                	jmp    803694 <page_forget+0x50>
+
+008036cf <page_unmap>:
+{
+  8036cf:	55                   	push   %ebp
+  8036d0:	89 e5                	mov    %esp,%ebp
+  8036d2:	57                   	push   %edi
+  8036d3:	56                   	push   %esi
+  8036d4:	53                   	push   %ebx
+  8036d5:	83 ec 0c             	sub    $0xc,%esp
+  8036d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8036db:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  8036de:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8036e3:	8b 40 48             	mov    0x48(%eax),%eax
+  8036e6:	85 db                	test   %ebx,%ebx
+  8036e8:	0f 8e b4 00 00 00    	jle    8037a2 <page_unmap+0xd3>
+  8036ee:	39 d8                	cmp    %ebx,%eax
+  8036f0:	0f 84 ac 00 00 00    	je     8037a2 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  8036f6:	83 ec 08             	sub    $0x8,%esp
+  8036f9:	57                   	push   %edi
+  8036fa:	53                   	push   %ebx
+  8036fb:	e8 b1 d6 ff ff       	call   800db1 <sys_page_unmap>
+  803700:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803702:	e8 95 ee ff ff       	call   80259c <find_paging_env>
+	if (pagingenv == 0)
+  803707:	83 c4 10             	add    $0x10,%esp
+  80370a:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803711:	0f 84 a1 00 00 00    	je     8037b8 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803717:	83 ec 0c             	sub    $0xc,%esp
+  80371a:	6a 05                	push   $0x5
+  80371c:	68 00 00 40 00       	push   $0x400000
+  803721:	6a 00                	push   $0x0
+  803723:	68 00 b0 ad de       	push   $0xdeadb000
+  803728:	53                   	push   %ebx
+  803729:	e8 41 d6 ff ff       	call   800d6f <sys_page_map>
+  80372e:	83 c4 20             	add    $0x20,%esp
+  803731:	85 c0                	test   %eax,%eax
+  803733:	0f 88 89 00 00 00    	js     8037c2 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803739:	89 f8                	mov    %edi,%eax
+  80373b:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  80373e:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803745:	a8 01                	test   $0x1,%al
+  803747:	74 6f                	je     8037b8 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803749:	83 ec 0c             	sub    $0xc,%esp
+  80374c:	6a 05                	push   $0x5
+  80374e:	68 00 00 40 00       	push   $0x400000
+  803753:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803755:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80375a:	50                   	push   %eax
+  80375b:	53                   	push   %ebx
+  80375c:	e8 0e d6 ff ff       	call   800d6f <sys_page_map>
+  803761:	83 c4 20             	add    $0x20,%esp
+  803764:	85 c0                	test   %eax,%eax
+  803766:	78 6f                	js     8037d7 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803768:	c1 ef 0c             	shr    $0xc,%edi
+  80376b:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803771:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803778:	01 
+  803779:	74 3d                	je     8037b8 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  80377b:	83 ec 08             	sub    $0x8,%esp
+  80377e:	68 00 00 40 00       	push   $0x400000
+  803783:	6a 00                	push   $0x0
+  803785:	e8 27 d6 ff ff       	call   800db1 <sys_page_unmap>
+  80378a:	83 c4 10             	add    $0x10,%esp
+  80378d:	85 c0                	test   %eax,%eax
+  80378f:	78 5b                	js     8037ec <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803791:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803798:	c1 e8 0c             	shr    $0xc,%eax
+  80379b:	e8 79 ed ff ff       	call   802519 <page_remove_slot>
+	return r;
+  8037a0:	eb 16                	jmp    8037b8 <page_unmap+0xe9>
+		page_forget(va);
+  8037a2:	89 f8                	mov    %edi,%eax
+  8037a4:	e8 9b fe ff ff       	call   803644 <page_forget>
+		return sys_page_unmap(envid, va);
+  8037a9:	83 ec 08             	sub    $0x8,%esp
+  8037ac:	57                   	push   %edi
+  8037ad:	53                   	push   %ebx
+  8037ae:	e8 fe d5 ff ff       	call   800db1 <sys_page_unmap>
+  8037b3:	89 c6                	mov    %eax,%esi
+  8037b5:	83 c4 10             	add    $0x10,%esp
+}
+  8037b8:	89 f0                	mov    %esi,%eax
+  8037ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037bd:	5b                   	pop    %ebx
+  8037be:	5e                   	pop    %esi
+  8037bf:	5f                   	pop    %edi
+  8037c0:	5d                   	pop    %ebp
+  8037c1:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  8037c2:	50                   	push   %eax
+  8037c3:	68 a0 55 80 00       	push   $0x8055a0
+  8037c8:	68 e4 03 00 00       	push   $0x3e4
+  8037cd:	68 55 52 80 00       	push   $0x805255
+  8037d2:	e8 a0 c9 ff ff       	call   800177 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  8037d7:	50                   	push   %eax
+  8037d8:	68 cc 55 80 00       	push   $0x8055cc
+  8037dd:	68 ea 03 00 00       	push   $0x3ea
+  8037e2:	68 55 52 80 00       	push   $0x805255
+  8037e7:	e8 8b c9 ff ff       	call   800177 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  8037ec:	50                   	push   %eax
+  8037ed:	68 f8 55 80 00       	push   $0x8055f8
+  8037f2:	68 ef 03 00 00       	push   $0x3ef
+  8037f7:	68 55 52 80 00       	push   $0x805255
+  8037fc:	e8 76 c9 ff ff       	call   800177 <_panic>
+
+00803801 <page_unmap_range>:
+{
+  803801:	55                   	push   %ebp
+  803802:	89 e5                	mov    %esp,%ebp
+  803804:	57                   	push   %edi
+  803805:	56                   	push   %esi
+  803806:	53                   	push   %ebx
+  803807:	83 ec 0c             	sub    $0xc,%esp
+  80380a:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  80380d:	e8 8a ed ff ff       	call   80259c <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803812:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803817:	8b 40 48             	mov    0x48(%eax),%eax
+  80381a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80381e:	7e 38                	jle    803858 <page_unmap_range+0x57>
+  803820:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803823:	74 33                	je     803858 <page_unmap_range+0x57>
+  803825:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  80382c:	74 2a                	je     803858 <page_unmap_range+0x57>
+  80382e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  803831:	be 00 00 00 00       	mov    $0x0,%esi
+  803836:	39 fe                	cmp    %edi,%esi
+  803838:	74 56                	je     803890 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  80383a:	83 ec 08             	sub    $0x8,%esp
+  80383d:	53                   	push   %ebx
+  80383e:	ff 75 08             	push   0x8(%ebp)
+  803841:	e8 89 fe ff ff       	call   8036cf <page_unmap>
+  803846:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80384c:	83 c4 10             	add    $0x10,%esp
+  80384f:	85 c0                	test   %eax,%eax
+  803851:	78 35                	js     803888 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  803853:	83 c6 01             	add    $0x1,%esi
+  803856:	eb de                	jmp    803836 <page_unmap_range+0x35>
+  803858:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  80385b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803860:	eb 10                	jmp    803872 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803862:	89 f0                	mov    %esi,%eax
+  803864:	e8 db fd ff ff       	call   803644 <page_forget>
+		for (i = 0; i < npages; i++)
+  803869:	83 c3 01             	add    $0x1,%ebx
+  80386c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803872:	39 fb                	cmp    %edi,%ebx
+  803874:	75 ec                	jne    803862 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  803876:	83 ec 04             	sub    $0x4,%esp
+  803879:	57                   	push   %edi
+  80387a:	ff 75 0c             	push   0xc(%ebp)
+  80387d:	ff 75 08             	push   0x8(%ebp)
+  803880:	e8 40 d6 ff ff       	call   800ec5 <sys_page_unmap_range>
+  803885:	83 c4 10             	add    $0x10,%esp
+}
+  803888:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80388b:	5b                   	pop    %ebx
+  80388c:	5e                   	pop    %esi
+  80388d:	5f                   	pop    %edi
+  80388e:	5d                   	pop    %ebp
+  80388f:	c3                   	ret
+	return 0;
+  803890:	b8 00 00 00 00       	mov    $0x0,%eax
+  803895:	eb f1                	jmp    803888 <page_unmap_range+0x87>
+
+00803897 <page_alloc_range>:
+{
+  803897:	55                   	push   %ebp
+  803898:	89 e5                	mov    %esp,%ebp
+  80389a:	57                   	push   %edi
+  80389b:	56                   	push   %esi
+  80389c:	53                   	push   %ebx
+  80389d:	83 ec 1c             	sub    $0x1c,%esp
+  8038a0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8038a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  8038a6:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  8038ad:	74 14                	je     8038c3 <page_alloc_range+0x2c>
+	if (check_mte)
+  8038af:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8038b3:	74 66                	je     80391b <page_alloc_range+0x84>
+  8038b5:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  8038b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038bc:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  8038bf:	89 c7                	mov    %eax,%edi
+  8038c1:	eb 10                	jmp    8038d3 <page_alloc_range+0x3c>
+		init_map_dir();
+  8038c3:	e8 e6 f8 ff ff       	call   8031ae <init_map_dir>
+  8038c8:	eb e5                	jmp    8038af <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  8038ca:	83 c7 01             	add    $0x1,%edi
+  8038cd:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8038d3:	39 df                	cmp    %ebx,%edi
+  8038d5:	74 38                	je     80390f <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  8038d7:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8038da:	83 ec 08             	sub    $0x8,%esp
+  8038dd:	6a 00                	push   $0x0
+  8038df:	56                   	push   %esi
+  8038e0:	e8 1f f9 ff ff       	call   803204 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  8038e5:	83 c4 10             	add    $0x10,%esp
+  8038e8:	85 c0                	test   %eax,%eax
+  8038ea:	74 de                	je     8038ca <page_alloc_range+0x33>
+  8038ec:	8b 10                	mov    (%eax),%edx
+  8038ee:	f6 c2 01             	test   $0x1,%dl
+  8038f1:	74 d7                	je     8038ca <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  8038f3:	83 ec 08             	sub    $0x8,%esp
+  8038f6:	ff 75 e4             	push   -0x1c(%ebp)
+  8038f9:	52                   	push   %edx
+  8038fa:	50                   	push   %eax
+  8038fb:	68 64 55 80 00       	push   $0x805564
+  803900:	68 0b 04 00 00       	push   $0x40b
+  803905:	68 55 52 80 00       	push   $0x805255
+  80390a:	e8 68 c8 ff ff       	call   800177 <_panic>
+  80390f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803912:	eb 07                	jmp    80391b <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  803914:	c1 e0 0c             	shl    $0xc,%eax
+  803917:	01 c7                	add    %eax,%edi
+			npages -= r;
+  803919:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  80391b:	85 db                	test   %ebx,%ebx
+  80391d:	74 30                	je     80394f <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  80391f:	ff 75 14             	push   0x14(%ebp)
+  803922:	53                   	push   %ebx
+  803923:	57                   	push   %edi
+  803924:	ff 75 08             	push   0x8(%ebp)
+  803927:	e8 2b d5 ff ff       	call   800e57 <sys_page_alloc_range>
+  80392c:	89 c6                	mov    %eax,%esi
+  80392e:	83 c4 10             	add    $0x10,%esp
+  803931:	85 c0                	test   %eax,%eax
+  803933:	7f df                	jg     803914 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  803935:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  803938:	75 1a                	jne    803954 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  80393a:	83 ec 08             	sub    $0x8,%esp
+  80393d:	57                   	push   %edi
+  80393e:	ff 75 08             	push   0x8(%ebp)
+  803941:	e8 68 f9 ff ff       	call   8032ae <page_out>
+  803946:	83 c4 10             	add    $0x10,%esp
+  803949:	85 c0                	test   %eax,%eax
+  80394b:	79 ce                	jns    80391b <page_alloc_range+0x84>
+  80394d:	eb 05                	jmp    803954 <page_alloc_range+0xbd>
+	return 0;
+  80394f:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803954:	89 f0                	mov    %esi,%eax
+  803956:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803959:	5b                   	pop    %ebx
+  80395a:	5e                   	pop    %esi
+  80395b:	5f                   	pop    %edi
+  80395c:	5d                   	pop    %ebp
+  80395d:	c3                   	ret
+
+0080395e <page_in>:
+{
+  80395e:	55                   	push   %ebp
+  80395f:	89 e5                	mov    %esp,%ebp
+  803961:	57                   	push   %edi
+  803962:	56                   	push   %esi
+  803963:	53                   	push   %ebx
+  803964:	83 ec 3c             	sub    $0x3c,%esp
+  803967:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  80396a:	e8 2d ec ff ff       	call   80259c <find_paging_env>
+	if (pagingenv == 0)
+  80396f:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803976:	0f 84 09 02 00 00    	je     803b85 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  80397c:	83 ec 08             	sub    $0x8,%esp
+  80397f:	6a 00                	push   $0x0
+  803981:	56                   	push   %esi
+  803982:	e8 7d f8 ff ff       	call   803204 <umapdir_walk>
+  803987:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803989:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80398f:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  803992:	83 c4 10             	add    $0x10,%esp
+  803995:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803999:	74 0d                	je     8039a8 <page_in+0x4a>
+  80399b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8039a0:	8b 40 48             	mov    0x48(%eax),%eax
+  8039a3:	3b 45 08             	cmp    0x8(%ebp),%eax
+  8039a6:	75 06                	jne    8039ae <page_in+0x50>
+  8039a8:	8b 03                	mov    (%ebx),%eax
+  8039aa:	a8 02                	test   $0x2,%al
+  8039ac:	75 63                	jne    803a11 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  8039ae:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  8039b0:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  8039b2:	89 f0                	mov    %esi,%eax
+  8039b4:	25 06 0e 00 00       	and    $0xe06,%eax
+  8039b9:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  8039bc:	50                   	push   %eax
+  8039bd:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  8039c0:	57                   	push   %edi
+  8039c1:	ff 75 08             	push   0x8(%ebp)
+  8039c4:	e8 65 fb ff ff       	call   80352e <page_alloc>
+  8039c9:	83 c4 10             	add    $0x10,%esp
+  8039cc:	85 c0                	test   %eax,%eax
+  8039ce:	78 39                	js     803a09 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  8039d0:	89 f0                	mov    %esi,%eax
+  8039d2:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8039d5:	83 ec 0c             	sub    $0xc,%esp
+  8039d8:	6a 07                	push   $0x7
+  8039da:	6a 01                	push   $0x1
+  8039dc:	57                   	push   %edi
+  8039dd:	c1 e0 04             	shl    $0x4,%eax
+  8039e0:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8039e1:	c1 ee 1c             	shr    $0x1c,%esi
+  8039e4:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8039e7:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8039ee:	e8 f1 0f 00 00       	call   8049e4 <ipc_call>
+  8039f3:	83 c4 20             	add    $0x20,%esp
+  8039f6:	85 c0                	test   %eax,%eax
+  8039f8:	0f 88 72 01 00 00    	js     803b70 <page_in+0x212>
+	*mte = 0;
+  8039fe:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  803a04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a0c:	5b                   	pop    %ebx
+  803a0d:	5e                   	pop    %esi
+  803a0e:	5f                   	pop    %edi
+  803a0f:	5d                   	pop    %ebp
+  803a10:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803a11:	25 06 0e 00 00       	and    $0xe06,%eax
+  803a16:	83 c8 01             	or     $0x1,%eax
+  803a19:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  803a1c:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803a1f:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  803a22:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  803a28:	be 01 00 00 00       	mov    $0x1,%esi
+  803a2d:	eb 46                	jmp    803a75 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  803a2f:	83 ec 08             	sub    $0x8,%esp
+  803a32:	6a 00                	push   $0x0
+  803a34:	51                   	push   %ecx
+  803a35:	e8 ca f7 ff ff       	call   803204 <umapdir_walk>
+  803a3a:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  803a3e:	83 c4 10             	add    $0x10,%esp
+  803a41:	85 c0                	test   %eax,%eax
+  803a43:	74 66                	je     803aab <page_in+0x14d>
+  803a45:	8b 00                	mov    (%eax),%eax
+  803a47:	a8 01                	test   $0x1,%al
+  803a49:	74 60                	je     803aab <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  803a4b:	89 c2                	mov    %eax,%edx
+  803a4d:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  803a53:	83 ca 01             	or     $0x1,%edx
+  803a56:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  803a59:	75 50                	jne    803aab <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  803a5b:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803a61:	c1 e8 1c             	shr    $0x1c,%eax
+  803a64:	8b 13                	mov    (%ebx),%edx
+  803a66:	c1 ea 1c             	shr    $0x1c,%edx
+  803a69:	39 d0                	cmp    %edx,%eax
+  803a6b:	75 3e                	jne    803aab <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803a6d:	83 c6 01             	add    $0x1,%esi
+  803a70:	83 fe 08             	cmp    $0x8,%esi
+  803a73:	74 3f                	je     803ab4 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  803a75:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803a77:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  803a7d:	77 2c                	ja     803aab <page_in+0x14d>
+  803a7f:	89 f8                	mov    %edi,%eax
+  803a81:	c1 e8 16             	shr    $0x16,%eax
+  803a84:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803a8b:	f6 c2 01             	test   $0x1,%dl
+  803a8e:	74 9f                	je     803a2f <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803a90:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803a97:	a8 80                	test   $0x80,%al
+  803a99:	75 10                	jne    803aab <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803a9b:	89 f8                	mov    %edi,%eax
+  803a9d:	c1 e8 0c             	shr    $0xc,%eax
+  803aa0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803aa7:	a8 01                	test   $0x1,%al
+  803aa9:	74 84                	je     803a2f <page_in+0xd1>
+	if (n == 1)
+  803aab:	83 fe 01             	cmp    $0x1,%esi
+  803aae:	0f 84 fa fe ff ff    	je     8039ae <page_in+0x50>
+	req.nslots = n;
+  803ab4:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  803aba:	b8 00 00 00 00       	mov    $0x0,%eax
+  803abf:	eb 13                	jmp    803ad4 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  803ac1:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  803ac5:	8b 12                	mov    (%edx),%edx
+  803ac7:	c1 ea 0c             	shr    $0xc,%edx
+  803aca:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  803ad1:	83 c0 01             	add    $0x1,%eax
+  803ad4:	39 c6                	cmp    %eax,%esi
+  803ad6:	75 e9                	jne    803ac1 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  803ad8:	83 ec 0c             	sub    $0xc,%esp
+  803adb:	6a 00                	push   $0x0
+  803add:	ff 75 c0             	push   -0x40(%ebp)
+  803ae0:	56                   	push   %esi
+  803ae1:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803ae4:	57                   	push   %edi
+  803ae5:	6a 00                	push   $0x0
+  803ae7:	e8 ab fd ff ff       	call   803897 <page_alloc_range>
+  803aec:	83 c4 20             	add    $0x20,%esp
+  803aef:	85 c0                	test   %eax,%eax
+  803af1:	78 6e                	js     803b61 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  803af3:	83 ec 04             	sub    $0x4,%esp
+  803af6:	6a 24                	push   $0x24
+  803af8:	68 00 80 80 00       	push   $0x808000
+  803afd:	57                   	push   %edi
+  803afe:	e8 bc ce ff ff       	call   8009bf <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803b03:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803b0a:	56                   	push   %esi
+  803b0b:	57                   	push   %edi
+  803b0c:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803b0e:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  803b15:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803b18:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  803b1f:	e8 c0 0e 00 00       	call   8049e4 <ipc_call>
+  803b24:	83 c4 20             	add    $0x20,%esp
+  803b27:	85 c0                	test   %eax,%eax
+  803b29:	78 08                	js     803b33 <page_in+0x1d5>
+  803b2b:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  803b2e:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  803b31:	eb 20                	jmp    803b53 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  803b33:	50                   	push   %eax
+  803b34:	68 24 56 80 00       	push   $0x805624
+  803b39:	68 59 02 00 00       	push   $0x259
+  803b3e:	68 55 52 80 00       	push   $0x805255
+  803b43:	e8 2f c6 ff ff       	call   800177 <_panic>
+		*mtes[i] = 0;
+  803b48:	8b 10                	mov    (%eax),%edx
+  803b4a:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  803b50:	83 c0 04             	add    $0x4,%eax
+  803b53:	39 c8                	cmp    %ecx,%eax
+  803b55:	75 f1                	jne    803b48 <page_in+0x1ea>
+	return n;
+  803b57:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  803b59:	85 f6                	test   %esi,%esi
+  803b5b:	0f 84 4d fe ff ff    	je     8039ae <page_in+0x50>
+		return r < 0 ? r : 0;
+  803b61:	85 c0                	test   %eax,%eax
+  803b63:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b68:	0f 4f c2             	cmovg  %edx,%eax
+  803b6b:	e9 99 fe ff ff       	jmp    803a09 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  803b70:	50                   	push   %eax
+  803b71:	68 5c 56 80 00       	push   $0x80565c
+  803b76:	68 9a 02 00 00       	push   $0x29a
+  803b7b:	68 55 52 80 00       	push   $0x805255
+  803b80:	e8 f2 c5 ff ff       	call   800177 <_panic>
+		return -E_PAGING;
+  803b85:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803b8a:	e9 7a fe ff ff       	jmp    803a09 <page_in+0xab>
+
+00803b8f <page_map>:
+{
+  803b8f:	55                   	push   %ebp
+  803b90:	89 e5                	mov    %esp,%ebp
+  803b92:	57                   	push   %edi
+  803b93:	56                   	push   %esi
+  803b94:	53                   	push   %ebx
+  803b95:	83 ec 1c             	sub    $0x1c,%esp
+  803b98:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803b9b:	83 ec 0c             	sub    $0xc,%esp
+  803b9e:	ff 75 18             	push   0x18(%ebp)
+  803ba1:	ff 75 14             	push   0x14(%ebp)
+  803ba4:	ff 75 10             	push   0x10(%ebp)
+  803ba7:	ff 75 0c             	push   0xc(%ebp)
+  803baa:	56                   	push   %esi
+  803bab:	e8 bf d1 ff ff       	call   800d6f <sys_page_map>
+  803bb0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803bb3:	83 c4 20             	add    $0x20,%esp
+  803bb6:	85 c0                	test   %eax,%eax
+  803bb8:	0f 89 a9 01 00 00    	jns    803d67 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  803bbe:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  803bc2:	74 5f                	je     803c23 <page_map+0x94>
+		if (r != -E_INVAL)
+  803bc4:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  803bc8:	0f 85 a0 01 00 00    	jne    803d6e <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803bce:	85 f6                	test   %esi,%esi
+  803bd0:	74 70                	je     803c42 <page_map+0xb3>
+  803bd2:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803bd7:	8b 40 48             	mov    0x48(%eax),%eax
+  803bda:	39 f0                	cmp    %esi,%eax
+  803bdc:	74 64                	je     803c42 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803bde:	83 ec 0c             	sub    $0xc,%esp
+  803be1:	6a 05                	push   $0x5
+  803be3:	68 00 00 40 00       	push   $0x400000
+  803be8:	6a 00                	push   $0x0
+  803bea:	68 00 b0 ad de       	push   $0xdeadb000
+  803bef:	56                   	push   %esi
+  803bf0:	e8 7a d1 ff ff       	call   800d6f <sys_page_map>
+  803bf5:	89 c3                	mov    %eax,%ebx
+  803bf7:	83 c4 20             	add    $0x20,%esp
+  803bfa:	85 c0                	test   %eax,%eax
+  803bfc:	79 6a                	jns    803c68 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  803bfe:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803c01:	75 50                	jne    803c53 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  803c03:	83 ec 08             	sub    $0x8,%esp
+  803c06:	68 00 00 40 00       	push   $0x400000
+  803c0b:	6a fc                	push   $0xfffffffc
+  803c0d:	e8 9c f6 ff ff       	call   8032ae <page_out>
+  803c12:	83 c4 10             	add    $0x10,%esp
+  803c15:	85 c0                	test   %eax,%eax
+  803c17:	79 c5                	jns    803bde <page_map+0x4f>
+}
+  803c19:	89 d8                	mov    %ebx,%eax
+  803c1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c1e:	5b                   	pop    %ebx
+  803c1f:	5e                   	pop    %esi
+  803c20:	5f                   	pop    %edi
+  803c21:	5d                   	pop    %ebp
+  803c22:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  803c23:	83 ec 08             	sub    $0x8,%esp
+  803c26:	68 00 00 40 00       	push   $0x400000
+  803c2b:	6a 00                	push   $0x0
+  803c2d:	e8 7c f6 ff ff       	call   8032ae <page_out>
+  803c32:	83 c4 10             	add    $0x10,%esp
+  803c35:	85 c0                	test   %eax,%eax
+  803c37:	0f 89 5e ff ff ff    	jns    803b9b <page_map+0xc>
+				return r;
+  803c3d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803c40:	eb d7                	jmp    803c19 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803c42:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803c45:	e8 79 f9 ff ff       	call   8035c3 <page_adopt>
+  803c4a:	85 c0                	test   %eax,%eax
+  803c4c:	79 90                	jns    803bde <page_map+0x4f>
+			return r;
+  803c4e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803c51:	eb c6                	jmp    803c19 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  803c53:	53                   	push   %ebx
+  803c54:	68 90 56 80 00       	push   $0x805690
+  803c59:	68 77 03 00 00       	push   $0x377
+  803c5e:	68 55 52 80 00       	push   $0x805255
+  803c63:	e8 0f c5 ff ff       	call   800177 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  803c68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803c6b:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803c6e:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  803c75:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  803c7b:	0f 84 f5 00 00 00    	je     803d76 <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803c81:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803c87:	83 ec 0c             	sub    $0xc,%esp
+  803c8a:	6a 05                	push   $0x5
+  803c8c:	68 00 00 40 00       	push   $0x400000
+  803c91:	6a 00                	push   $0x0
+  803c93:	57                   	push   %edi
+  803c94:	56                   	push   %esi
+  803c95:	e8 d5 d0 ff ff       	call   800d6f <sys_page_map>
+  803c9a:	89 c3                	mov    %eax,%ebx
+  803c9c:	83 c4 20             	add    $0x20,%esp
+  803c9f:	85 c0                	test   %eax,%eax
+  803ca1:	79 35                	jns    803cd8 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  803ca3:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803ca6:	75 1b                	jne    803cc3 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803ca8:	83 ec 08             	sub    $0x8,%esp
+  803cab:	68 00 00 40 00       	push   $0x400000
+  803cb0:	6a 00                	push   $0x0
+  803cb2:	e8 f7 f5 ff ff       	call   8032ae <page_out>
+  803cb7:	83 c4 10             	add    $0x10,%esp
+  803cba:	85 c0                	test   %eax,%eax
+  803cbc:	79 c9                	jns    803c87 <page_map+0xf8>
+  803cbe:	e9 56 ff ff ff       	jmp    803c19 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  803cc3:	53                   	push   %ebx
+  803cc4:	68 b8 56 80 00       	push   $0x8056b8
+  803cc9:	68 83 03 00 00       	push   $0x383
+  803cce:	68 55 52 80 00       	push   $0x805255
+  803cd3:	e8 9f c4 ff ff       	call   800177 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  803cd8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803cdb:	c1 e8 0c             	shr    $0xc,%eax
+  803cde:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803ce3:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  803cea:	01 
+  803ceb:	0f 84 8d 00 00 00    	je     803d7e <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803cf1:	83 ec 08             	sub    $0x8,%esp
+  803cf4:	68 00 00 40 00       	push   $0x400000
+  803cf9:	6a 00                	push   $0x0
+  803cfb:	e8 b1 d0 ff ff       	call   800db1 <sys_page_unmap>
+  803d00:	83 c4 10             	add    $0x10,%esp
+  803d03:	85 c0                	test   %eax,%eax
+  803d05:	78 36                	js     803d3d <page_map+0x1ae>
+  803d07:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  803d0a:	83 ec 08             	sub    $0x8,%esp
+  803d0d:	57                   	push   %edi
+  803d0e:	56                   	push   %esi
+  803d0f:	e8 4a fc ff ff       	call   80395e <page_in>
+  803d14:	89 c3                	mov    %eax,%ebx
+  803d16:	83 c4 10             	add    $0x10,%esp
+  803d19:	85 c0                	test   %eax,%eax
+  803d1b:	0f 89 7a fe ff ff    	jns    803b9b <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  803d21:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803d24:	75 2c                	jne    803d52 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  803d26:	83 ec 08             	sub    $0x8,%esp
+  803d29:	57                   	push   %edi
+  803d2a:	6a 00                	push   $0x0
+  803d2c:	e8 7d f5 ff ff       	call   8032ae <page_out>
+  803d31:	83 c4 10             	add    $0x10,%esp
+  803d34:	85 c0                	test   %eax,%eax
+  803d36:	79 d2                	jns    803d0a <page_map+0x17b>
+  803d38:	e9 dc fe ff ff       	jmp    803c19 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  803d3d:	50                   	push   %eax
+  803d3e:	68 e4 56 80 00       	push   $0x8056e4
+  803d43:	68 8b 03 00 00       	push   $0x38b
+  803d48:	68 55 52 80 00       	push   $0x805255
+  803d4d:	e8 25 c4 ff ff       	call   800177 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  803d52:	53                   	push   %ebx
+  803d53:	68 0c 57 80 00       	push   $0x80570c
+  803d58:	68 91 03 00 00       	push   $0x391
+  803d5d:	68 55 52 80 00       	push   $0x805255
+  803d62:	e8 10 c4 ff ff       	call   800177 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803d67:	89 c3                	mov    %eax,%ebx
+  803d69:	e9 ab fe ff ff       	jmp    803c19 <page_map+0x8a>
+  803d6e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803d71:	e9 a3 fe ff ff       	jmp    803c19 <page_map+0x8a>
+			return r; // Pass through the error
+  803d76:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803d79:	e9 9b fe ff ff       	jmp    803c19 <page_map+0x8a>
+			return r; // Pass through the error
+  803d7e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803d81:	e9 93 fe ff ff       	jmp    803c19 <page_map+0x8a>
+
+00803d86 <page_map_range>:
+{
+  803d86:	55                   	push   %ebp
+  803d87:	89 e5                	mov    %esp,%ebp
+  803d89:	57                   	push   %edi
+  803d8a:	56                   	push   %esi
+  803d8b:	53                   	push   %ebx
+  803d8c:	83 ec 0c             	sub    $0xc,%esp
+  803d8f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803d92:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  803d95:	83 ec 08             	sub    $0x8,%esp
+  803d98:	ff 75 1c             	push   0x1c(%ebp)
+  803d9b:	ff 75 18             	push   0x18(%ebp)
+  803d9e:	56                   	push   %esi
+  803d9f:	ff 75 10             	push   0x10(%ebp)
+  803da2:	57                   	push   %edi
+  803da3:	ff 75 08             	push   0x8(%ebp)
+  803da6:	e8 cf d0 ff ff       	call   800e7a <sys_page_map_range>
+  803dab:	89 c3                	mov    %eax,%ebx
+  803dad:	83 c4 20             	add    $0x20,%esp
+  803db0:	85 c0                	test   %eax,%eax
+  803db2:	79 1b                	jns    803dcf <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  803db4:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803db7:	75 20                	jne    803dd9 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803db9:	83 ec 08             	sub    $0x8,%esp
+  803dbc:	68 00 00 40 00       	push   $0x400000
+  803dc1:	6a 00                	push   $0x0
+  803dc3:	e8 e6 f4 ff ff       	call   8032ae <page_out>
+  803dc8:	83 c4 10             	add    $0x10,%esp
+  803dcb:	85 c0                	test   %eax,%eax
+  803dcd:	79 c6                	jns    803d95 <page_map_range+0xf>
+}
+  803dcf:	89 d8                	mov    %ebx,%eax
+  803dd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dd4:	5b                   	pop    %ebx
+  803dd5:	5e                   	pop    %esi
+  803dd6:	5f                   	pop    %edi
+  803dd7:	5d                   	pop    %ebp
+  803dd8:	c3                   	ret
+		if (r != -E_INVAL)
+  803dd9:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  803ddc:	75 f1                	jne    803dcf <page_map_range+0x49>
+  803dde:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  803de0:	be 00 00 00 00       	mov    $0x0,%esi
+  803de5:	eb 03                	jmp    803dea <page_map_range+0x64>
+  803de7:	83 c6 01             	add    $0x1,%esi
+  803dea:	3b 75 18             	cmp    0x18(%ebp),%esi
+  803ded:	74 2a                	je     803e19 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  803def:	83 ec 0c             	sub    $0xc,%esp
+  803df2:	ff 75 1c             	push   0x1c(%ebp)
+  803df5:	53                   	push   %ebx
+  803df6:	ff 75 10             	push   0x10(%ebp)
+  803df9:	57                   	push   %edi
+  803dfa:	ff 75 08             	push   0x8(%ebp)
+  803dfd:	e8 8d fd ff ff       	call   803b8f <page_map>
+  803e02:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803e08:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803e0e:	83 c4 20             	add    $0x20,%esp
+  803e11:	85 c0                	test   %eax,%eax
+  803e13:	79 d2                	jns    803de7 <page_map_range+0x61>
+  803e15:	89 c3                	mov    %eax,%ebx
+  803e17:	eb b6                	jmp    803dcf <page_map_range+0x49>
+		return 0;
+  803e19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e1e:	eb af                	jmp    803dcf <page_map_range+0x49>
+
+00803e20 <paging_pgfault_handler>:
+{
+  803e20:	55                   	push   %ebp
+  803e21:	89 e5                	mov    %esp,%ebp
+  803e23:	56                   	push   %esi
+  803e24:	53                   	push   %ebx
+  803e25:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  803e28:	e8 6f e7 ff ff       	call   80259c <find_paging_env>
+	if (pagingenv == 0)
+  803e2d:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803e32:	85 c0                	test   %eax,%eax
+  803e34:	74 3c                	je     803e72 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  803e36:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803e38:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803e3c:	75 12                	jne    803e50 <paging_pgfault_handler+0x30>
+  803e3e:	89 f0                	mov    %esi,%eax
+  803e40:	e8 7e f7 ff ff       	call   8035c3 <page_adopt>
+  803e45:	89 c2                	mov    %eax,%edx
+		return 0;
+  803e47:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803e4c:	85 d2                	test   %edx,%edx
+  803e4e:	78 22                	js     803e72 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  803e50:	83 ec 08             	sub    $0x8,%esp
+  803e53:	6a 00                	push   $0x0
+  803e55:	56                   	push   %esi
+  803e56:	e8 a9 f3 ff ff       	call   803204 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  803e5b:	83 c4 10             	add    $0x10,%esp
+  803e5e:	85 c0                	test   %eax,%eax
+  803e60:	74 05                	je     803e67 <paging_pgfault_handler+0x47>
+  803e62:	f6 00 01             	testb  $0x1,(%eax)
+  803e65:	75 12                	jne    803e79 <paging_pgfault_handler+0x59>
+	return 0;
+  803e67:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803e6c:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803e70:	74 23                	je     803e95 <paging_pgfault_handler+0x75>
+}
+  803e72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e75:	5b                   	pop    %ebx
+  803e76:	5e                   	pop    %esi
+  803e77:	5d                   	pop    %ebp
+  803e78:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  803e79:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803e7e:	8b 40 48             	mov    0x48(%eax),%eax
+  803e81:	83 ec 08             	sub    $0x8,%esp
+  803e84:	56                   	push   %esi
+  803e85:	50                   	push   %eax
+  803e86:	e8 d3 fa ff ff       	call   80395e <page_in>
+  803e8b:	f7 d0                	not    %eax
+  803e8d:	c1 e8 1f             	shr    $0x1f,%eax
+  803e90:	83 c4 10             	add    $0x10,%esp
+  803e93:	eb dd                	jmp    803e72 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803e95:	89 f0                	mov    %esi,%eax
+  803e97:	e8 97 e2 ff ff       	call   802133 <segment_lookup>
+  803e9c:	89 c2                	mov    %eax,%edx
+	return 0;
+  803e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803ea3:	85 d2                	test   %edx,%edx
+  803ea5:	74 cb                	je     803e72 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  803ea7:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803eac:	8b 40 48             	mov    0x48(%eax),%eax
+  803eaf:	83 ec 08             	sub    $0x8,%esp
+  803eb2:	56                   	push   %esi
+  803eb3:	50                   	push   %eax
+  803eb4:	e8 f5 f3 ff ff       	call   8032ae <page_out>
+  803eb9:	f7 d0                	not    %eax
+  803ebb:	c1 e8 1f             	shr    $0x1f,%eax
+  803ebe:	83 c4 10             	add    $0x10,%esp
+  803ec1:	eb af                	jmp    803e72 <paging_pgfault_handler+0x52>
+
+00803ec3 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  803ec3:	55                   	push   %ebp
+  803ec4:	89 e5                	mov    %esp,%ebp
+  803ec6:	57                   	push   %edi
+  803ec7:	56                   	push   %esi
+  803ec8:	53                   	push   %ebx
+  803ec9:	83 ec 2c             	sub    $0x2c,%esp
+  803ecc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  803ecf:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  803ed4:	89 c1                	mov    %eax,%ecx
+  803ed6:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  803ed9:	c1 e8 11             	shr    $0x11,%eax
+  803edc:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803edf:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  803ee6:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  803ee9:	b8 01 00 00 00       	mov    $0x1,%eax
+  803eee:	d3 e0                	shl    %cl,%eax
+  803ef0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803ef3:	85 c7                	test   %eax,%edi
+  803ef5:	74 12                	je     803f09 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803ef7:	bb 01 00 00 00       	mov    $0x1,%ebx
+  803efc:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  803eff:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f04:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803f07:	eb 17                	jmp    803f20 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  803f09:	ff 75 e0             	push   -0x20(%ebp)
+  803f0c:	68 44 57 80 00       	push   $0x805744
+  803f11:	6a 48                	push   $0x48
+  803f13:	68 5e 57 80 00       	push   $0x80575e
+  803f18:	e8 5a c2 ff ff       	call   800177 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803f1d:	83 c3 01             	add    $0x1,%ebx
+  803f20:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803f23:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  803f26:	89 c8                	mov    %ecx,%eax
+  803f28:	c1 e8 05             	shr    $0x5,%eax
+  803f2b:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  803f32:	89 fe                	mov    %edi,%esi
+  803f34:	d3 e6                	shl    %cl,%esi
+  803f36:	89 f1                	mov    %esi,%ecx
+  803f38:	85 d6                	test   %edx,%esi
+  803f3a:	74 e1                	je     803f1d <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  803f3c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  803f3f:	f7 d6                	not    %esi
+  803f41:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  803f44:	21 fe                	and    %edi,%esi
+  803f46:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803f49:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  803f50:	f7 d1                	not    %ecx
+  803f52:	21 d1                	and    %edx,%ecx
+  803f54:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  803f5b:	83 ec 04             	sub    $0x4,%esp
+  803f5e:	53                   	push   %ebx
+  803f5f:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803f62:	57                   	push   %edi
+  803f63:	6a 00                	push   $0x0
+  803f65:	e8 97 f8 ff ff       	call   803801 <page_unmap_range>
+	va_free(va, n);
+  803f6a:	83 c4 08             	add    $0x8,%esp
+  803f6d:	53                   	push   %ebx
+  803f6e:	57                   	push   %edi
+  803f6f:	e8 ed 05 00 00       	call   804561 <va_free>
+}
+  803f74:	83 c4 10             	add    $0x10,%esp
+  803f77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f7a:	5b                   	pop    %ebx
+  803f7b:	5e                   	pop    %esi
+  803f7c:	5f                   	pop    %edi
+  803f7d:	5d                   	pop    %ebp
+  803f7e:	c3                   	ret
+
+00803f7f <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  803f7f:	55                   	push   %ebp
+  803f80:	89 e5                	mov    %esp,%ebp
+  803f82:	57                   	push   %edi
+  803f83:	56                   	push   %esi
+  803f84:	53                   	push   %ebx
+  803f85:	83 ec 1c             	sub    $0x1c,%esp
+  803f88:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  803f8b:	85 db                	test   %ebx,%ebx
+  803f8d:	74 34                	je     803fc3 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  803f8f:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803f95:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  803f9a:	77 2f                	ja     803fcb <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  803f9c:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  803fa2:	75 51                	jne    803ff5 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  803fa4:	89 c1                	mov    %eax,%ecx
+  803fa6:	c1 e9 0c             	shr    $0xc,%ecx
+  803fa9:	ba 01 00 00 00       	mov    $0x1,%edx
+  803fae:	d3 e2                	shl    %cl,%edx
+  803fb0:	c1 e8 11             	shr    $0x11,%eax
+  803fb3:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  803fba:	75 24                	jne    803fe0 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  803fbc:	89 d8                	mov    %ebx,%eax
+  803fbe:	e8 00 ff ff ff       	call   803ec3 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  803fc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fc6:	5b                   	pop    %ebx
+  803fc7:	5e                   	pop    %esi
+  803fc8:	5f                   	pop    %edi
+  803fc9:	5d                   	pop    %ebp
+  803fca:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  803fcb:	53                   	push   %ebx
+  803fcc:	68 6b 57 80 00       	push   $0x80576b
+  803fd1:	68 a2 00 00 00       	push   $0xa2
+  803fd6:	68 5e 57 80 00       	push   $0x80575e
+  803fdb:	e8 97 c1 ff ff       	call   800177 <_panic>
+			panic("free: %p is not allocated", va);
+  803fe0:	53                   	push   %ebx
+  803fe1:	68 44 57 80 00       	push   $0x805744
+  803fe6:	68 a5 00 00 00       	push   $0xa5
+  803feb:	68 5e 57 80 00       	push   $0x80575e
+  803ff0:	e8 82 c1 ff ff       	call   800177 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  803ff5:	89 de                	mov    %ebx,%esi
+  803ff7:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  803ffd:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  804003:	89 c8                	mov    %ecx,%eax
+  804005:	c1 e8 11             	shr    $0x11,%eax
+  804008:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80400b:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  804012:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  804015:	c1 e9 0c             	shr    $0xc,%ecx
+  804018:	b8 01 00 00 00       	mov    $0x1,%eax
+  80401d:	d3 e0                	shl    %cl,%eax
+  80401f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804022:	85 c7                	test   %eax,%edi
+  804024:	74 1b                	je     804041 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  804026:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  80402a:	89 d8                	mov    %ebx,%eax
+  80402c:	29 f0                	sub    %esi,%eax
+  80402e:	83 e8 10             	sub    $0x10,%eax
+  804031:	99                   	cltd
+  804032:	f7 ff                	idiv   %edi
+  804034:	89 d1                	mov    %edx,%ecx
+  804036:	85 d2                	test   %edx,%edx
+  804038:	75 07                	jne    804041 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80403a:	ba 10 00 00 00       	mov    $0x10,%edx
+  80403f:	eb 18                	jmp    804059 <free+0xda>
+		panic("free: %p is not allocated", va);
+  804041:	53                   	push   %ebx
+  804042:	68 44 57 80 00       	push   $0x805744
+  804047:	68 ad 00 00 00       	push   $0xad
+  80404c:	68 5e 57 80 00       	push   $0x80575e
+  804051:	e8 21 c1 ff ff       	call   800177 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804056:	83 c1 01             	add    $0x1,%ecx
+  804059:	89 d0                	mov    %edx,%eax
+  80405b:	d3 e0                	shl    %cl,%eax
+  80405d:	39 c7                	cmp    %eax,%edi
+  80405f:	7f f5                	jg     804056 <free+0xd7>
+	*(void **) va = s->free;
+  804061:	8b 46 08             	mov    0x8(%esi),%eax
+  804064:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  804066:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  804069:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  80406d:	8d 58 01             	lea    0x1(%eax),%ebx
+  804070:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  804074:	66 85 c0             	test   %ax,%ax
+  804077:	74 52                	je     8040cb <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804079:	0f b7 db             	movzwl %bx,%ebx
+  80407c:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804080:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804085:	ba 00 00 00 00       	mov    $0x0,%edx
+  80408a:	f7 ff                	idiv   %edi
+  80408c:	39 c3                	cmp    %eax,%ebx
+  80408e:	0f 85 2f ff ff ff    	jne    803fc3 <free+0x44>
+  804094:	8b 46 04             	mov    0x4(%esi),%eax
+  804097:	85 c0                	test   %eax,%eax
+  804099:	74 53                	je     8040ee <free+0x16f>
+		s->prev->next = s->next;
+  80409b:	8b 16                	mov    (%esi),%edx
+  80409d:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  80409f:	8b 06                	mov    (%esi),%eax
+  8040a1:	85 c0                	test   %eax,%eax
+  8040a3:	74 06                	je     8040ab <free+0x12c>
+		s->next->prev = s->prev;
+  8040a5:	8b 56 04             	mov    0x4(%esi),%edx
+  8040a8:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8040ab:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8040ae:	f7 d0                	not    %eax
+  8040b0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8040b3:	21 d0                	and    %edx,%eax
+  8040b5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8040b8:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  8040bf:	89 f0                	mov    %esi,%eax
+  8040c1:	e8 fd fd ff ff       	call   803ec3 <heap_free_pages>
+  8040c6:	e9 f8 fe ff ff       	jmp    803fc3 <free+0x44>
+	s->prev = NULL;
+  8040cb:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  8040d2:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  8040d9:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  8040db:	85 c0                	test   %eax,%eax
+  8040dd:	74 03                	je     8040e2 <free+0x163>
+		slabs[c]->prev = s;
+  8040df:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  8040e2:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  8040e9:	e9 d5 fe ff ff       	jmp    803fc3 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8040ee:	8b 06                	mov    (%esi),%eax
+  8040f0:	85 c0                	test   %eax,%eax
+  8040f2:	0f 84 cb fe ff ff    	je     803fc3 <free+0x44>
+		slabs[c] = s->next;
+  8040f8:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  8040ff:	8b 06                	mov    (%esi),%eax
+  804101:	eb a2                	jmp    8040a5 <free+0x126>
+
+00804103 <heap_alloc_pages>:
+{
+  804103:	55                   	push   %ebp
+  804104:	89 e5                	mov    %esp,%ebp
+  804106:	57                   	push   %edi
+  804107:	56                   	push   %esi
+  804108:	53                   	push   %ebx
+  804109:	83 ec 18             	sub    $0x18,%esp
+  80410c:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  80410e:	50                   	push   %eax
+  80410f:	e8 15 03 00 00       	call   804429 <va_alloc>
+  804114:	89 c3                	mov    %eax,%ebx
+  804116:	83 c4 10             	add    $0x10,%esp
+  804119:	85 c0                	test   %eax,%eax
+  80411b:	74 47                	je     804164 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  80411d:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804123:	89 c1                	mov    %eax,%ecx
+  804125:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  804128:	c1 e8 11             	shr    $0x11,%eax
+  80412b:	ba 01 00 00 00       	mov    $0x1,%edx
+  804130:	89 d7                	mov    %edx,%edi
+  804132:	d3 e7                	shl    %cl,%edi
+  804134:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  80413b:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  80413f:	89 c8                	mov    %ecx,%eax
+  804141:	c1 e8 05             	shr    $0x5,%eax
+  804144:	d3 e2                	shl    %cl,%edx
+  804146:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  80414d:	83 ec 0c             	sub    $0xc,%esp
+  804150:	6a 00                	push   $0x0
+  804152:	6a 07                	push   $0x7
+  804154:	56                   	push   %esi
+  804155:	53                   	push   %ebx
+  804156:	6a 00                	push   $0x0
+  804158:	e8 3a f7 ff ff       	call   803897 <page_alloc_range>
+  80415d:	83 c4 20             	add    $0x20,%esp
+  804160:	85 c0                	test   %eax,%eax
+  804162:	78 0a                	js     80416e <heap_alloc_pages+0x6b>
+}
+  804164:	89 d8                	mov    %ebx,%eax
+  804166:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804169:	5b                   	pop    %ebx
+  80416a:	5e                   	pop    %esi
+  80416b:	5f                   	pop    %edi
+  80416c:	5d                   	pop    %ebp
+  80416d:	c3                   	ret
+		free(va);
+  80416e:	83 ec 0c             	sub    $0xc,%esp
+  804171:	53                   	push   %ebx
+  804172:	e8 08 fe ff ff       	call   803f7f <free>
+		return NULL;
+  804177:	83 c4 10             	add    $0x10,%esp
+  80417a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80417f:	eb e3                	jmp    804164 <heap_alloc_pages+0x61>
+
+00804181 <malloc>:
+{
+  804181:	55                   	push   %ebp
+  804182:	89 e5                	mov    %esp,%ebp
+  804184:	57                   	push   %edi
+  804185:	56                   	push   %esi
+  804186:	53                   	push   %ebx
+  804187:	83 ec 1c             	sub    $0x1c,%esp
+  80418a:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  80418d:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804190:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  804196:	0f 87 21 01 00 00    	ja     8042bd <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  80419c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8041a1:	ba 10 00 00 00       	mov    $0x10,%edx
+  8041a6:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  8041a8:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8041ad:	76 15                	jbe    8041c4 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  8041af:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8041b4:	c1 e8 0c             	shr    $0xc,%eax
+  8041b7:	e8 47 ff ff ff       	call   804103 <heap_alloc_pages>
+  8041bc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8041bf:	eb 37                	jmp    8041f8 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8041c1:	83 c1 01             	add    $0x1,%ecx
+  8041c4:	89 d6                	mov    %edx,%esi
+  8041c6:	d3 e6                	shl    %cl,%esi
+  8041c8:	39 c6                	cmp    %eax,%esi
+  8041ca:	72 f5                	jb     8041c1 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  8041cc:	89 cb                	mov    %ecx,%ebx
+  8041ce:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  8041d5:	85 ff                	test   %edi,%edi
+  8041d7:	74 2a                	je     804203 <malloc+0x82>
+	v = s->free;
+  8041d9:	8b 47 08             	mov    0x8(%edi),%eax
+  8041dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  8041df:	8b 00                	mov    (%eax),%eax
+  8041e1:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  8041e4:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  8041e8:	83 e8 01             	sub    $0x1,%eax
+  8041eb:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  8041ef:	66 85 c0             	test   %ax,%ax
+  8041f2:	0f 84 9a 00 00 00    	je     804292 <malloc+0x111>
+}
+  8041f8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8041fb:	83 c4 1c             	add    $0x1c,%esp
+  8041fe:	5b                   	pop    %ebx
+  8041ff:	5e                   	pop    %esi
+  804200:	5f                   	pop    %edi
+  804201:	5d                   	pop    %ebp
+  804202:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  804203:	b8 01 00 00 00       	mov    $0x1,%eax
+  804208:	e8 f6 fe ff ff       	call   804103 <heap_alloc_pages>
+  80420d:	89 c1                	mov    %eax,%ecx
+  80420f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804212:	85 c0                	test   %eax,%eax
+  804214:	74 e2                	je     8041f8 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804216:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  80421c:	89 c8                	mov    %ecx,%eax
+  80421e:	c1 e8 11             	shr    $0x11,%eax
+  804221:	c1 e9 0c             	shr    $0xc,%ecx
+  804224:	ba 01 00 00 00       	mov    $0x1,%edx
+  804229:	d3 e2                	shl    %cl,%edx
+  80422b:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804232:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804235:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  804239:	0f b7 f6             	movzwl %si,%esi
+  80423c:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804241:	ba 00 00 00 00       	mov    $0x0,%edx
+  804246:	f7 fe                	idiv   %esi
+  804248:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  80424c:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  80424f:	85 c0                	test   %eax,%eax
+  804251:	74 14                	je     804267 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  804253:	83 e8 01             	sub    $0x1,%eax
+  804256:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  80425a:	0f af d0             	imul   %eax,%edx
+  80425d:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804261:	89 3a                	mov    %edi,(%edx)
+  804263:	89 d7                	mov    %edx,%edi
+  804265:	eb e5                	jmp    80424c <malloc+0xcb>
+	s->prev = NULL;
+  804267:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80426a:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804271:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  804278:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  80427a:	85 c0                	test   %eax,%eax
+  80427c:	74 03                	je     804281 <malloc+0x100>
+		slabs[c]->prev = s;
+  80427e:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804281:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804284:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  80428b:	89 c7                	mov    %eax,%edi
+  80428d:	e9 47 ff ff ff       	jmp    8041d9 <malloc+0x58>
+	if (s->prev)
+  804292:	8b 47 04             	mov    0x4(%edi),%eax
+  804295:	85 c0                	test   %eax,%eax
+  804297:	74 19                	je     8042b2 <malloc+0x131>
+		s->prev->next = s->next;
+  804299:	8b 17                	mov    (%edi),%edx
+  80429b:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  80429d:	8b 07                	mov    (%edi),%eax
+  80429f:	85 c0                	test   %eax,%eax
+  8042a1:	0f 84 51 ff ff ff    	je     8041f8 <malloc+0x77>
+		s->next->prev = s->prev;
+  8042a7:	8b 57 04             	mov    0x4(%edi),%edx
+  8042aa:	89 50 04             	mov    %edx,0x4(%eax)
+  8042ad:	e9 46 ff ff ff       	jmp    8041f8 <malloc+0x77>
+		slabs[c] = s->next;
+  8042b2:	8b 07                	mov    (%edi),%eax
+  8042b4:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  8042bb:	eb e0                	jmp    80429d <malloc+0x11c>
+		return NULL;
+  8042bd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8042c4:	e9 2f ff ff ff       	jmp    8041f8 <malloc+0x77>
+
+008042c9 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  8042c9:	55                   	push   %ebp
+  8042ca:	89 e5                	mov    %esp,%ebp
+  8042cc:	57                   	push   %edi
+  8042cd:	56                   	push   %esi
+  8042ce:	53                   	push   %ebx
+  8042cf:	83 ec 0c             	sub    $0xc,%esp
+  8042d2:	89 c6                	mov    %eax,%esi
+  8042d4:	89 d7                	mov    %edx,%edi
+  8042d6:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8042d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8042de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042e3:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  8042e8:	83 ef 01             	sub    $0x1,%edi
+  8042eb:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8042ee:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8042f1:	eb 34                	jmp    804327 <va_chunk_scan+0x5e>
+			i += 31;
+  8042f3:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  8042f6:	89 ca                	mov    %ecx,%edx
+			continue;
+  8042f8:	eb 23                	jmp    80431d <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8042fa:	89 c7                	mov    %eax,%edi
+  8042fc:	c1 ef 05             	shr    $0x5,%edi
+  8042ff:	be 01 00 00 00       	mov    $0x1,%esi
+  804304:	d3 e6                	shl    %cl,%esi
+  804306:	89 f1                	mov    %esi,%ecx
+  804308:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80430b:	23 0c be             	and    (%esi,%edi,4),%ecx
+  80430e:	75 41                	jne    804351 <va_chunk_scan+0x88>
+			len++;
+  804310:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804313:	39 d3                	cmp    %edx,%ebx
+  804315:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  804318:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  80431b:	72 2d                	jb     80434a <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  80431d:	83 c0 01             	add    $0x1,%eax
+  804320:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804325:	77 31                	ja     804358 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  804327:	89 c1                	mov    %eax,%ecx
+  804329:	83 e1 1f             	and    $0x1f,%ecx
+  80432c:	75 cc                	jne    8042fa <va_chunk_scan+0x31>
+  80432e:	89 c7                	mov    %eax,%edi
+  804330:	c1 ef 05             	shr    $0x5,%edi
+  804333:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804336:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804339:	83 ff ff             	cmp    $0xffffffff,%edi
+  80433c:	74 b5                	je     8042f3 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  80433e:	85 ff                	test   %edi,%edi
+  804340:	75 b8                	jne    8042fa <va_chunk_scan+0x31>
+			i += 31;
+  804342:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804345:	83 c2 20             	add    $0x20,%edx
+  804348:	eb c9                	jmp    804313 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  80434a:	83 c0 01             	add    $0x1,%eax
+  80434d:	29 d0                	sub    %edx,%eax
+  80434f:	eb 15                	jmp    804366 <va_chunk_scan+0x9d>
+			len = 0;
+  804351:	ba 00 00 00 00       	mov    $0x0,%edx
+  804356:	eb c5                	jmp    80431d <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804358:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  80435d:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804360:	85 d2                	test   %edx,%edx
+  804362:	74 02                	je     804366 <va_chunk_scan+0x9d>
+		*run_store = best;
+  804364:	89 1a                	mov    %ebx,(%edx)
+}
+  804366:	83 c4 0c             	add    $0xc,%esp
+  804369:	5b                   	pop    %ebx
+  80436a:	5e                   	pop    %esi
+  80436b:	5f                   	pop    %edi
+  80436c:	5d                   	pop    %ebp
+  80436d:	c3                   	ret
+
+0080436e <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  80436e:	55                   	push   %ebp
+  80436f:	89 e5                	mov    %esp,%ebp
+  804371:	57                   	push   %edi
+  804372:	56                   	push   %esi
+  804373:	53                   	push   %ebx
+  804374:	83 ec 14             	sub    $0x14,%esp
+  804377:	89 c3                	mov    %eax,%ebx
+  804379:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  80437b:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804381:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  804387:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  80438a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  80438d:	89 d6                	mov    %edx,%esi
+  80438f:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  804395:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804397:	eb 34                	jmp    8043cd <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804399:	89 c8                	mov    %ecx,%eax
+  80439b:	c1 e8 05             	shr    $0x5,%eax
+  80439e:	89 da                	mov    %ebx,%edx
+  8043a0:	c1 e2 05             	shl    $0x5,%edx
+  8043a3:	01 da                	add    %ebx,%edx
+  8043a5:	01 c2                	add    %eax,%edx
+  8043a7:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8043ac:	d3 c0                	rol    %cl,%eax
+  8043ae:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  8043b5:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  8043bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8043c1:	01 d0                	add    %edx,%eax
+  8043c3:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  8043ca:	83 c1 01             	add    $0x1,%ecx
+  8043cd:	39 f9                	cmp    %edi,%ecx
+  8043cf:	74 30                	je     804401 <va_chunk_mark+0x93>
+		if (alloc)
+  8043d1:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8043d5:	74 c2                	je     804399 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  8043d7:	89 c8                	mov    %ecx,%eax
+  8043d9:	c1 e8 05             	shr    $0x5,%eax
+  8043dc:	89 da                	mov    %ebx,%edx
+  8043de:	c1 e2 05             	shl    $0x5,%edx
+  8043e1:	01 da                	add    %ebx,%edx
+  8043e3:	01 c2                	add    %eax,%edx
+  8043e5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8043ea:	d3 e0                	shl    %cl,%eax
+  8043ec:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  8043f3:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  8043fa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8043ff:	eb c0                	jmp    8043c1 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804401:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804404:	ba 00 00 00 00       	mov    $0x0,%edx
+  804409:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80440c:	e8 b8 fe ff ff       	call   8042c9 <va_chunk_scan>
+	ch->run = run;
+  804411:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804417:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80441a:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  804421:	83 c4 14             	add    $0x14,%esp
+  804424:	5b                   	pop    %ebx
+  804425:	5e                   	pop    %esi
+  804426:	5f                   	pop    %edi
+  804427:	5d                   	pop    %ebp
+  804428:	c3                   	ret
+
+00804429 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804429:	55                   	push   %ebp
+  80442a:	89 e5                	mov    %esp,%ebp
+  80442c:	57                   	push   %edi
+  80442d:	56                   	push   %esi
+  80442e:	53                   	push   %ebx
+  80442f:	83 ec 04             	sub    $0x4,%esp
+  804432:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804435:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  80443a:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  80443f:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  804446:	74 4f                	je     804497 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804448:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  80444b:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804450:	0f 87 01 01 00 00    	ja     804557 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804456:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  80445c:	0f 87 80 00 00 00    	ja     8044e2 <va_alloc+0xb9>
+  804462:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804467:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  80446c:	0f b7 10             	movzwl (%eax),%edx
+  80446f:	05 84 00 00 00       	add    $0x84,%eax
+  804474:	39 da                	cmp    %ebx,%edx
+  804476:	73 2c                	jae    8044a4 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804478:	83 c6 01             	add    $0x1,%esi
+  80447b:	83 fe 1c             	cmp    $0x1c,%esi
+  80447e:	75 ec                	jne    80446c <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804480:	b8 00 00 00 00       	mov    $0x0,%eax
+  804485:	eb 53                	jmp    8044da <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804487:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  80448d:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804492:	05 84 00 00 00       	add    $0x84,%eax
+  804497:	39 d0                	cmp    %edx,%eax
+  804499:	75 ec                	jne    804487 <va_alloc+0x5e>
+	va_inited = 1;
+  80449b:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  8044a2:	eb a4                	jmp    804448 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  8044a4:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  8044aa:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  8044af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8044b4:	89 da                	mov    %ebx,%edx
+  8044b6:	e8 0e fe ff ff       	call   8042c9 <va_chunk_scan>
+  8044bb:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  8044bd:	6a 01                	push   $0x1
+  8044bf:	89 d9                	mov    %ebx,%ecx
+  8044c1:	89 c2                	mov    %eax,%edx
+  8044c3:	89 f0                	mov    %esi,%eax
+  8044c5:	e8 a4 fe ff ff       	call   80436e <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  8044ca:	c1 e6 16             	shl    $0x16,%esi
+  8044cd:	c1 e7 0c             	shl    $0xc,%edi
+  8044d0:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  8044d7:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  8044da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044dd:	5b                   	pop    %ebx
+  8044de:	5e                   	pop    %esi
+  8044df:	5f                   	pop    %edi
+  8044e0:	5d                   	pop    %ebp
+  8044e1:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  8044e2:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  8044e8:	c1 ee 0a             	shr    $0xa,%esi
+  8044eb:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  8044f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044f5:	eb 0a                	jmp    804501 <va_alloc+0xd8>
+			first = c + 1;
+  8044f7:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  8044f9:	83 c2 01             	add    $0x1,%edx
+  8044fc:	83 fa 1d             	cmp    $0x1d,%edx
+  8044ff:	74 4f                	je     804550 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804501:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804507:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  80450e:	00 04 
+  804510:	75 e5                	jne    8044f7 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804512:	89 d1                	mov    %edx,%ecx
+  804514:	29 c1                	sub    %eax,%ecx
+  804516:	39 f1                	cmp    %esi,%ecx
+  804518:	75 df                	jne    8044f9 <va_alloc+0xd0>
+  80451a:	89 c7                	mov    %eax,%edi
+  80451c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  80451f:	be 00 04 00 00       	mov    $0x400,%esi
+  804524:	39 f3                	cmp    %esi,%ebx
+  804526:	0f 46 f3             	cmovbe %ebx,%esi
+  804529:	6a 01                	push   $0x1
+  80452b:	89 f1                	mov    %esi,%ecx
+  80452d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804532:	89 f8                	mov    %edi,%eax
+  804534:	e8 35 fe ff ff       	call   80436e <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804539:	83 c7 01             	add    $0x1,%edi
+  80453c:	83 c4 04             	add    $0x4,%esp
+  80453f:	29 f3                	sub    %esi,%ebx
+  804541:	75 dc                	jne    80451f <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804543:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804546:	c1 e0 16             	shl    $0x16,%eax
+  804549:	05 00 00 00 08       	add    $0x8000000,%eax
+  80454e:	eb 8a                	jmp    8044da <va_alloc+0xb1>
+	return NULL;
+  804550:	b8 00 00 00 00       	mov    $0x0,%eax
+  804555:	eb 83                	jmp    8044da <va_alloc+0xb1>
+		return NULL;
+  804557:	b8 00 00 00 00       	mov    $0x0,%eax
+  80455c:	e9 79 ff ff ff       	jmp    8044da <va_alloc+0xb1>
+
+00804561 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804561:	55                   	push   %ebp
+  804562:	89 e5                	mov    %esp,%ebp
+  804564:	57                   	push   %edi
+  804565:	56                   	push   %esi
+  804566:	53                   	push   %ebx
+  804567:	83 ec 0c             	sub    $0xc,%esp
+  80456a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80456d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804570:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804576:	76 21                	jbe    804599 <va_free+0x38>
+  804578:	89 f0                	mov    %esi,%eax
+  80457a:	c1 e0 0c             	shl    $0xc,%eax
+  80457d:	01 f8                	add    %edi,%eax
+  80457f:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804584:	77 13                	ja     804599 <va_free+0x38>
+	    || PGOFF(va))
+  804586:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80458c:	75 0b                	jne    804599 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  80458e:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804594:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804597:	eb 45                	jmp    8045de <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804599:	83 ec 0c             	sub    $0xc,%esp
+  80459c:	56                   	push   %esi
+  80459d:	57                   	push   %edi
+  80459e:	68 88 57 80 00       	push   $0x805788
+  8045a3:	68 8e 00 00 00       	push   $0x8e
+  8045a8:	68 a8 57 80 00       	push   $0x8057a8
+  8045ad:	e8 c5 bb ff ff       	call   800177 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  8045b2:	89 fa                	mov    %edi,%edx
+  8045b4:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8045ba:	bb 00 04 00 00       	mov    $0x400,%ebx
+  8045bf:	29 d3                	sub    %edx,%ebx
+  8045c1:	39 f3                	cmp    %esi,%ebx
+  8045c3:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  8045c6:	89 f8                	mov    %edi,%eax
+  8045c8:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  8045cb:	83 ec 0c             	sub    $0xc,%esp
+  8045ce:	6a 00                	push   $0x0
+  8045d0:	89 d9                	mov    %ebx,%ecx
+  8045d2:	e8 97 fd ff ff       	call   80436e <va_chunk_mark>
+		i += n;
+  8045d7:	01 df                	add    %ebx,%edi
+		npages -= n;
+  8045d9:	29 de                	sub    %ebx,%esi
+  8045db:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  8045de:	85 f6                	test   %esi,%esi
+  8045e0:	75 d0                	jne    8045b2 <va_free+0x51>
+	}
+}
+  8045e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045e5:	5b                   	pop    %ebx
+  8045e6:	5e                   	pop    %esi
+  8045e7:	5f                   	pop    %edi
+  8045e8:	5d                   	pop    %ebp
+  8045e9:	c3                   	ret
+
+008045ea <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8045ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045ef:	c3                   	ret
+
+008045f0 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8045f0:	55                   	push   %ebp
+  8045f1:	89 e5                	mov    %esp,%ebp
+  8045f3:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8045f6:	68 b5 57 80 00       	push   $0x8057b5
+  8045fb:	ff 75 0c             	push   0xc(%ebp)
+  8045fe:	e8 36 c2 ff ff       	call   800839 <strcpy>
+	return 0;
+}
+  804603:	b8 00 00 00 00       	mov    $0x0,%eax
+  804608:	c9                   	leave
+  804609:	c3                   	ret
+
+0080460a <devcons_write>:
+{
+  80460a:	55                   	push   %ebp
+  80460b:	89 e5                	mov    %esp,%ebp
+  80460d:	57                   	push   %edi
+  80460e:	56                   	push   %esi
+  80460f:	53                   	push   %ebx
+  804610:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804616:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80461b:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804621:	eb 2e                	jmp    804651 <devcons_write+0x47>
+		m = n - tot;
+  804623:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804626:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804628:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80462d:	39 c3                	cmp    %eax,%ebx
+  80462f:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804632:	83 ec 04             	sub    $0x4,%esp
+  804635:	53                   	push   %ebx
+  804636:	89 f0                	mov    %esi,%eax
+  804638:	03 45 0c             	add    0xc(%ebp),%eax
+  80463b:	50                   	push   %eax
+  80463c:	57                   	push   %edi
+  80463d:	e8 7d c3 ff ff       	call   8009bf <memmove>
+		sys_cputs(buf, m);
+  804642:	83 c4 08             	add    $0x8,%esp
+  804645:	53                   	push   %ebx
+  804646:	57                   	push   %edi
+  804647:	e8 13 c6 ff ff       	call   800c5f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80464c:	01 de                	add    %ebx,%esi
+  80464e:	83 c4 10             	add    $0x10,%esp
+  804651:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804654:	72 cd                	jb     804623 <devcons_write+0x19>
+}
+  804656:	89 f0                	mov    %esi,%eax
+  804658:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80465b:	5b                   	pop    %ebx
+  80465c:	5e                   	pop    %esi
+  80465d:	5f                   	pop    %edi
+  80465e:	5d                   	pop    %ebp
+  80465f:	c3                   	ret
+
+00804660 <devcons_read>:
+{
+  804660:	55                   	push   %ebp
+  804661:	89 e5                	mov    %esp,%ebp
+  804663:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804666:	b8 00 00 00 00       	mov    $0x0,%eax
+  80466b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80466f:	75 07                	jne    804678 <devcons_read+0x18>
+  804671:	eb 1f                	jmp    804692 <devcons_read+0x32>
+		sys_yield();
+  804673:	e8 95 c6 ff ff       	call   800d0d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804678:	e8 11 c6 ff ff       	call   800c8e <sys_cgetc>
+  80467d:	85 c0                	test   %eax,%eax
+  80467f:	74 f2                	je     804673 <devcons_read+0x13>
+	if (c < 0)
+  804681:	78 0f                	js     804692 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804683:	83 f8 04             	cmp    $0x4,%eax
+  804686:	74 0c                	je     804694 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804688:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80468b:	88 02                	mov    %al,(%edx)
+	return 1;
+  80468d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804692:	c9                   	leave
+  804693:	c3                   	ret
+		return 0;
+  804694:	b8 00 00 00 00       	mov    $0x0,%eax
+  804699:	eb f7                	jmp    804692 <devcons_read+0x32>
+
+0080469b <cputchar>:
+{
+  80469b:	55                   	push   %ebp
+  80469c:	89 e5                	mov    %esp,%ebp
+  80469e:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8046a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8046a4:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8046a7:	6a 01                	push   $0x1
+  8046a9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8046ac:	50                   	push   %eax
+  8046ad:	e8 ad c5 ff ff       	call   800c5f <sys_cputs>
+}
+  8046b2:	83 c4 10             	add    $0x10,%esp
+  8046b5:	c9                   	leave
+  8046b6:	c3                   	ret
+
+008046b7 <getchar>:
+{
+  8046b7:	55                   	push   %ebp
+  8046b8:	89 e5                	mov    %esp,%ebp
+  8046ba:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8046bd:	6a 01                	push   $0x1
+  8046bf:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8046c2:	50                   	push   %eax
+  8046c3:	6a 00                	push   $0x0
+  8046c5:	e8 d7 ce ff ff       	call   8015a1 <read>
+	if (r < 0)
+  8046ca:	83 c4 10             	add    $0x10,%esp
+  8046cd:	85 c0                	test   %eax,%eax
+  8046cf:	78 06                	js     8046d7 <getchar+0x20>
+	if (r < 1)
+  8046d1:	74 06                	je     8046d9 <getchar+0x22>
+	return c;
+  8046d3:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8046d7:	c9                   	leave
+  8046d8:	c3                   	ret
+		return -E_EOF;
+  8046d9:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8046de:	eb f7                	jmp    8046d7 <getchar+0x20>
+
+008046e0 <iscons>:
+{
+  8046e0:	55                   	push   %ebp
+  8046e1:	89 e5                	mov    %esp,%ebp
+  8046e3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8046e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8046e9:	50                   	push   %eax
+  8046ea:	ff 75 08             	push   0x8(%ebp)
+  8046ed:	e8 50 cc ff ff       	call   801342 <fd_lookup>
+  8046f2:	83 c4 10             	add    $0x10,%esp
+  8046f5:	85 c0                	test   %eax,%eax
+  8046f7:	78 11                	js     80470a <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8046f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8046fc:	8b 15 4c 60 80 00    	mov    0x80604c,%edx
+  804702:	39 10                	cmp    %edx,(%eax)
+  804704:	0f 94 c0             	sete   %al
+  804707:	0f b6 c0             	movzbl %al,%eax
+}
+  80470a:	c9                   	leave
+  80470b:	c3                   	ret
+
+0080470c <opencons>:
+{
+  80470c:	55                   	push   %ebp
+  80470d:	89 e5                	mov    %esp,%ebp
+  80470f:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804712:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804715:	50                   	push   %eax
+  804716:	e8 d3 cb ff ff       	call   8012ee <fd_alloc>
+  80471b:	83 c4 10             	add    $0x10,%esp
+  80471e:	85 c0                	test   %eax,%eax
+  804720:	78 3a                	js     80475c <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804722:	83 ec 04             	sub    $0x4,%esp
+  804725:	68 07 04 00 00       	push   $0x407
+  80472a:	ff 75 f4             	push   -0xc(%ebp)
+  80472d:	6a 00                	push   $0x0
+  80472f:	e8 f8 c5 ff ff       	call   800d2c <sys_page_alloc>
+  804734:	83 c4 10             	add    $0x10,%esp
+  804737:	85 c0                	test   %eax,%eax
+  804739:	78 21                	js     80475c <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80473b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80473e:	8b 15 4c 60 80 00    	mov    0x80604c,%edx
+  804744:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804746:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804749:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804750:	83 ec 0c             	sub    $0xc,%esp
+  804753:	50                   	push   %eax
+  804754:	e8 6e cb ff ff       	call   8012c7 <fd2num>
+  804759:	83 c4 10             	add    $0x10,%esp
+}
+  80475c:	c9                   	leave
+  80475d:	c3                   	ret
+
+0080475e <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  80475e:	55                   	push   %ebp
+  80475f:	89 e5                	mov    %esp,%ebp
+  804761:	56                   	push   %esi
+  804762:	53                   	push   %ebx
+  804763:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804766:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  80476b:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  80476e:	85 db                	test   %ebx,%ebx
+  804770:	78 17                	js     804789 <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804772:	83 ec 0c             	sub    $0xc,%esp
+  804775:	56                   	push   %esi
+  804776:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  80477d:	83 c4 10             	add    $0x10,%esp
+  804780:	85 c0                	test   %eax,%eax
+  804782:	75 27                	jne    8047ab <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804784:	83 eb 01             	sub    $0x1,%ebx
+  804787:	eb e5                	jmp    80476e <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804789:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80478e:	8b 40 48             	mov    0x48(%eax),%eax
+  804791:	83 ec 08             	sub    $0x8,%esp
+  804794:	ff 76 28             	push   0x28(%esi)
+  804797:	ff 36                	push   (%esi)
+  804799:	50                   	push   %eax
+  80479a:	68 c4 57 80 00       	push   $0x8057c4
+  80479f:	6a 1d                	push   $0x1d
+  8047a1:	68 e7 57 80 00       	push   $0x8057e7
+  8047a6:	e8 cc b9 ff ff       	call   800177 <_panic>
+}
+  8047ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8047ae:	5b                   	pop    %ebx
+  8047af:	5e                   	pop    %esi
+  8047b0:	5d                   	pop    %ebp
+  8047b1:	c3                   	ret
+
+008047b2 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8047b2:	55                   	push   %ebp
+  8047b3:	89 e5                	mov    %esp,%ebp
+  8047b5:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  8047b8:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  8047bf:	74 0a                	je     8047cb <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8047c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8047c4:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  8047c9:	c9                   	leave
+  8047ca:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  8047cb:	83 ec 04             	sub    $0x4,%esp
+  8047ce:	6a 07                	push   $0x7
+  8047d0:	68 00 f0 bf ee       	push   $0xeebff000
+  8047d5:	6a 00                	push   $0x0
+  8047d7:	e8 50 c5 ff ff       	call   800d2c <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8047dc:	83 c4 08             	add    $0x8,%esp
+  8047df:	68 52 48 80 00       	push   $0x804852
+  8047e4:	6a 00                	push   $0x0
+  8047e6:	e8 a7 c8 ff ff       	call   801092 <sys_env_set_pgfault_upcall>
+  8047eb:	83 c4 10             	add    $0x10,%esp
+  8047ee:	eb d1                	jmp    8047c1 <set_pgfault_handler+0xf>
+
+008047f0 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  8047f0:	55                   	push   %ebp
+  8047f1:	89 e5                	mov    %esp,%ebp
+  8047f3:	83 ec 08             	sub    $0x8,%esp
+  8047f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  8047f9:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  8047ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804804:	eb 03                	jmp    804809 <add_pgfault_handler+0x19>
+  804806:	83 c0 01             	add    $0x1,%eax
+  804809:	39 d0                	cmp    %edx,%eax
+  80480b:	74 0b                	je     804818 <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  80480d:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  804814:	75 f0                	jne    804806 <add_pgfault_handler+0x16>
+  804816:	eb 24                	jmp    80483c <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  804818:	83 fa 0a             	cmp    $0xa,%edx
+  80481b:	74 21                	je     80483e <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  80481d:	8d 42 01             	lea    0x1(%edx),%eax
+  804820:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  804825:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  80482c:	83 ec 0c             	sub    $0xc,%esp
+  80482f:	68 5e 47 80 00       	push   $0x80475e
+  804834:	e8 79 ff ff ff       	call   8047b2 <set_pgfault_handler>
+  804839:	83 c4 10             	add    $0x10,%esp
+}
+  80483c:	c9                   	leave
+  80483d:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  80483e:	83 ec 04             	sub    $0x4,%esp
+  804841:	68 f5 57 80 00       	push   $0x8057f5
+  804846:	6a 44                	push   $0x44
+  804848:	68 e7 57 80 00       	push   $0x8057e7
+  80484d:	e8 25 b9 ff ff       	call   800177 <_panic>
+
+00804852 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804852:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804853:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  804858:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80485a:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  80485d:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  804861:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  804865:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  804868:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  80486a:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  80486e:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  804871:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  804872:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  804875:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  804876:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  804877:	c3                   	ret
+
+00804878 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  804878:	55                   	push   %ebp
+  804879:	89 e5                	mov    %esp,%ebp
+  80487b:	57                   	push   %edi
+  80487c:	56                   	push   %esi
+  80487d:	53                   	push   %ebx
+  80487e:	83 ec 14             	sub    $0x14,%esp
+  804881:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804884:	8b 75 14             	mov    0x14(%ebp),%esi
+  804887:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  80488a:	ff 75 10             	push   0x10(%ebp)
+  80488d:	ff 75 0c             	push   0xc(%ebp)
+  804890:	e8 ba c8 ff ff       	call   80114f <sys_ipc_recv_pages>
+  804895:	83 c4 10             	add    $0x10,%esp
+  804898:	85 c0                	test   %eax,%eax
+  80489a:	78 46                	js     8048e2 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80489c:	85 ff                	test   %edi,%edi
+  80489e:	74 0d                	je     8048ad <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  8048a0:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8048a5:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8048ab:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8048ad:	85 f6                	test   %esi,%esi
+  8048af:	74 0d                	je     8048be <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  8048b1:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8048b6:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8048bc:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8048be:	85 db                	test   %ebx,%ebx
+  8048c0:	74 0d                	je     8048cf <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  8048c2:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8048c7:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8048cd:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8048cf:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8048d4:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8048da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8048dd:	5b                   	pop    %ebx
+  8048de:	5e                   	pop    %esi
+  8048df:	5f                   	pop    %edi
+  8048e0:	5d                   	pop    %ebp
+  8048e1:	c3                   	ret
+		if (from_env_store) {
+  8048e2:	85 ff                	test   %edi,%edi
+  8048e4:	74 06                	je     8048ec <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  8048e6:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8048ec:	85 f6                	test   %esi,%esi
+  8048ee:	74 06                	je     8048f6 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  8048f0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8048f6:	85 db                	test   %ebx,%ebx
+  8048f8:	74 e0                	je     8048da <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8048fa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804900:	eb d8                	jmp    8048da <ipc_recv_pages+0x62>
+
+00804902 <ipc_recv>:
+{
+  804902:	55                   	push   %ebp
+  804903:	89 e5                	mov    %esp,%ebp
+  804905:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  804908:	6a 00                	push   $0x0
+  80490a:	ff 75 10             	push   0x10(%ebp)
+  80490d:	6a 01                	push   $0x1
+  80490f:	ff 75 0c             	push   0xc(%ebp)
+  804912:	ff 75 08             	push   0x8(%ebp)
+  804915:	e8 5e ff ff ff       	call   804878 <ipc_recv_pages>
+}
+  80491a:	c9                   	leave
+  80491b:	c3                   	ret
+
+0080491c <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80491c:	55                   	push   %ebp
+  80491d:	89 e5                	mov    %esp,%ebp
+  80491f:	56                   	push   %esi
+  804920:	53                   	push   %ebx
+  804921:	8b 75 08             	mov    0x8(%ebp),%esi
+  804924:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  804927:	83 ec 0c             	sub    $0xc,%esp
+  80492a:	ff 75 0c             	push   0xc(%ebp)
+  80492d:	e8 51 c9 ff ff       	call   801283 <sys_ipc_try_recv>
+  804932:	83 c4 10             	add    $0x10,%esp
+  804935:	85 c0                	test   %eax,%eax
+  804937:	78 34                	js     80496d <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804939:	85 f6                	test   %esi,%esi
+  80493b:	74 0d                	je     80494a <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  80493d:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804942:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804948:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  80494a:	85 db                	test   %ebx,%ebx
+  80494c:	74 0d                	je     80495b <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  80494e:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804953:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804959:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80495b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804960:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804966:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804969:	5b                   	pop    %ebx
+  80496a:	5e                   	pop    %esi
+  80496b:	5d                   	pop    %ebp
+  80496c:	c3                   	ret
+		if (from_env_store) {
+  80496d:	85 f6                	test   %esi,%esi
+  80496f:	74 06                	je     804977 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  804971:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  804977:	85 db                	test   %ebx,%ebx
+  804979:	74 eb                	je     804966 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  80497b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804981:	eb e3                	jmp    804966 <ipc_try_recv+0x4a>
+
+00804983 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804983:	55                   	push   %ebp
+  804984:	89 e5                	mov    %esp,%ebp
+  804986:	83 ec 14             	sub    $0x14,%esp
+  804989:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80498c:	85 c0                	test   %eax,%eax
+  80498e:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804993:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804996:	ff 75 18             	push   0x18(%ebp)
+  804999:	ff 75 14             	push   0x14(%ebp)
+  80499c:	50                   	push   %eax
+  80499d:	ff 75 0c             	push   0xc(%ebp)
+  8049a0:	ff 75 08             	push   0x8(%ebp)
+  8049a3:	e8 6a c7 ff ff       	call   801112 <sys_ipc_send_pages>
+  8049a8:	83 c4 20             	add    $0x20,%esp
+  8049ab:	85 c0                	test   %eax,%eax
+  8049ad:	78 02                	js     8049b1 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  8049af:	c9                   	leave
+  8049b0:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  8049b1:	50                   	push   %eax
+  8049b2:	68 10 58 80 00       	push   $0x805810
+  8049b7:	68 80 00 00 00       	push   $0x80
+  8049bc:	68 3c 58 80 00       	push   $0x80583c
+  8049c1:	e8 b1 b7 ff ff       	call   800177 <_panic>
+
+008049c6 <ipc_send>:
+{
+  8049c6:	55                   	push   %ebp
+  8049c7:	89 e5                	mov    %esp,%ebp
+  8049c9:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  8049cc:	ff 75 14             	push   0x14(%ebp)
+  8049cf:	6a 01                	push   $0x1
+  8049d1:	ff 75 10             	push   0x10(%ebp)
+  8049d4:	ff 75 0c             	push   0xc(%ebp)
+  8049d7:	ff 75 08             	push   0x8(%ebp)
+  8049da:	e8 a4 ff ff ff       	call   804983 <ipc_send_pages>
+}
+  8049df:	83 c4 20             	add    $0x20,%esp
+  8049e2:	c9                   	leave
+  8049e3:	c3                   	ret
+
+008049e4 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8049e4:	55                   	push   %ebp
+  8049e5:	89 e5                	mov    %esp,%ebp
+  8049e7:	83 ec 14             	sub    $0x14,%esp
+  8049ea:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8049ed:	85 c0                	test   %eax,%eax
+  8049ef:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8049f4:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8049f7:	ff 75 18             	push   0x18(%ebp)
+  8049fa:	ff 75 14             	push   0x14(%ebp)
+  8049fd:	50                   	push   %eax
+  8049fe:	ff 75 0c             	push   0xc(%ebp)
+  804a01:	ff 75 08             	push   0x8(%ebp)
+  804a04:	e8 9a c7 ff ff       	call   8011a3 <sys_ipc_call>
+  804a09:	83 c4 20             	add    $0x20,%esp
+  804a0c:	85 c0                	test   %eax,%eax
+  804a0e:	78 0b                	js     804a1b <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  804a10:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804a15:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804a1b:	c9                   	leave
+  804a1c:	c3                   	ret
+
+00804a1d <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  804a1d:	55                   	push   %ebp
+  804a1e:	89 e5                	mov    %esp,%ebp
+  804a20:	57                   	push   %edi
+  804a21:	56                   	push   %esi
+  804a22:	53                   	push   %ebx
+  804a23:	83 ec 18             	sub    $0x18,%esp
+  804a26:	8b 45 10             	mov    0x10(%ebp),%eax
+  804a29:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  804a2c:	8b 75 20             	mov    0x20(%ebp),%esi
+  804a2f:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804a32:	85 c0                	test   %eax,%eax
+  804a34:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804a39:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804a3c:	ff 75 18             	push   0x18(%ebp)
+  804a3f:	ff 75 14             	push   0x14(%ebp)
+  804a42:	50                   	push   %eax
+  804a43:	ff 75 0c             	push   0xc(%ebp)
+  804a46:	ff 75 08             	push   0x8(%ebp)
+  804a49:	e8 96 c7 ff ff       	call   8011e4 <sys_ipc_reply_recv>
+  804a4e:	83 c4 20             	add    $0x20,%esp
+  804a51:	85 c0                	test   %eax,%eax
+  804a53:	78 46                	js     804a9b <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804a55:	85 ff                	test   %edi,%edi
+  804a57:	74 0d                	je     804a66 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  804a59:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804a5e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804a64:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804a66:	85 f6                	test   %esi,%esi
+  804a68:	74 0d                	je     804a77 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  804a6a:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804a6f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804a75:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804a77:	85 db                	test   %ebx,%ebx
+  804a79:	74 0d                	je     804a88 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  804a7b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804a80:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804a86:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804a88:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804a8d:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804a93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a96:	5b                   	pop    %ebx
+  804a97:	5e                   	pop    %esi
+  804a98:	5f                   	pop    %edi
+  804a99:	5d                   	pop    %ebp
+  804a9a:	c3                   	ret
+		if (from_env_store) {
+  804a9b:	85 ff                	test   %edi,%edi
+  804a9d:	74 06                	je     804aa5 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  804a9f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804aa5:	85 f6                	test   %esi,%esi
+  804aa7:	74 06                	je     804aaf <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  804aa9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804aaf:	85 db                	test   %ebx,%ebx
+  804ab1:	74 e0                	je     804a93 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  804ab3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804ab9:	eb d8                	jmp    804a93 <ipc_reply_recv+0x76>
+
+00804abb <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804abb:	55                   	push   %ebp
+  804abc:	89 e5                	mov    %esp,%ebp
+  804abe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804ac1:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804ac6:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804ac9:	c1 e0 06             	shl    $0x6,%eax
+  804acc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804ad1:	8b 40 50             	mov    0x50(%eax),%eax
+  804ad4:	39 c8                	cmp    %ecx,%eax
+  804ad6:	74 12                	je     804aea <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804ad8:	83 c2 01             	add    $0x1,%edx
+  804adb:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804ae1:	75 e3                	jne    804ac6 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ae8:	eb 0e                	jmp    804af8 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804aea:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804aed:	c1 e0 06             	shl    $0x6,%eax
+  804af0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804af5:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804af8:	5d                   	pop    %ebp
+  804af9:	c3                   	ret
+
+00804afa <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804afa:	55                   	push   %ebp
+  804afb:	89 e5                	mov    %esp,%ebp
+  804afd:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804b00:	89 c2                	mov    %eax,%edx
+  804b02:	c1 ea 16             	shr    $0x16,%edx
+  804b05:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804b0c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804b11:	f6 c1 01             	test   $0x1,%cl
+  804b14:	74 1e                	je     804b34 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  804b16:	c1 e8 0c             	shr    $0xc,%eax
+  804b19:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804b20:	a8 01                	test   $0x1,%al
+  804b22:	74 10                	je     804b34 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804b24:	c1 e8 0c             	shr    $0xc,%eax
+  804b27:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  804b2a:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  804b31:	0f b7 d2             	movzwl %dx,%edx
+}
+  804b34:	89 d0                	mov    %edx,%eax
+  804b36:	5d                   	pop    %ebp
+  804b37:	c3                   	ret
+
+00804b38 <udivmod>:
+  804b38:	55                   	push   %ebp
+  804b39:	57                   	push   %edi
+  804b3a:	56                   	push   %esi
+  804b3b:	53                   	push   %ebx
+  804b3c:	83 ec 24             	sub    $0x24,%esp
+  804b3f:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804b43:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804b47:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804b4b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804b4f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804b53:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804b57:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  804b5b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b65:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b6a:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804b71:	00 
+  804b72:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804b79:	00 
+  804b7a:	89 fb                	mov    %edi,%ebx
+  804b7c:	eb 08                	jmp    804b86 <udivmod+0x4e>
+  804b7e:	83 e9 01             	sub    $0x1,%ecx
+  804b81:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804b84:	74 68                	je     804bee <udivmod+0xb6>
+  804b86:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804b8a:	01 c0                	add    %eax,%eax
+  804b8c:	89 c6                	mov    %eax,%esi
+  804b8e:	89 d7                	mov    %edx,%edi
+  804b90:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804b94:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804b98:	0f ad d0             	shrd   %cl,%edx,%eax
+  804b9b:	d3 ea                	shr    %cl,%edx
+  804b9d:	f6 c1 20             	test   $0x20,%cl
+  804ba0:	74 04                	je     804ba6 <udivmod+0x6e>
+  804ba2:	89 d0                	mov    %edx,%eax
+  804ba4:	31 d2                	xor    %edx,%edx
+  804ba6:	83 e0 01             	and    $0x1,%eax
+  804ba9:	89 04 24             	mov    %eax,(%esp)
+  804bac:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804bb3:	00 
+  804bb4:	8b 04 24             	mov    (%esp),%eax
+  804bb7:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804bbb:	09 f0                	or     %esi,%eax
+  804bbd:	09 fa                	or     %edi,%edx
+  804bbf:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804bc3:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804bc7:	39 f0                	cmp    %esi,%eax
+  804bc9:	89 d5                	mov    %edx,%ebp
+  804bcb:	19 fd                	sbb    %edi,%ebp
+  804bcd:	72 af                	jb     804b7e <udivmod+0x46>
+  804bcf:	29 f0                	sub    %esi,%eax
+  804bd1:	19 fa                	sbb    %edi,%edx
+  804bd3:	89 cf                	mov    %ecx,%edi
+  804bd5:	c1 ef 05             	shr    $0x5,%edi
+  804bd8:	83 e7 01             	and    $0x1,%edi
+  804bdb:	89 fe                	mov    %edi,%esi
+  804bdd:	83 f6 01             	xor    $0x1,%esi
+  804be0:	d3 e6                	shl    %cl,%esi
+  804be2:	d3 e7                	shl    %cl,%edi
+  804be4:	09 74 24 18          	or     %esi,0x18(%esp)
+  804be8:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804bec:	eb 90                	jmp    804b7e <udivmod+0x46>
+  804bee:	85 db                	test   %ebx,%ebx
+  804bf0:	74 05                	je     804bf7 <udivmod+0xbf>
+  804bf2:	89 03                	mov    %eax,(%ebx)
+  804bf4:	89 53 04             	mov    %edx,0x4(%ebx)
+  804bf7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804bfb:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804bff:	83 c4 24             	add    $0x24,%esp
+  804c02:	5b                   	pop    %ebx
+  804c03:	5e                   	pop    %esi
+  804c04:	5f                   	pop    %edi
+  804c05:	5d                   	pop    %ebp
+  804c06:	c3                   	ret
+
+00804c07 <__udivdi3>:
+  804c07:	83 ec 08             	sub    $0x8,%esp
+  804c0a:	6a 00                	push   $0x0
+  804c0c:	ff 74 24 1c          	push   0x1c(%esp)
+  804c10:	ff 74 24 1c          	push   0x1c(%esp)
+  804c14:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804c18:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804c1c:	e8 17 ff ff ff       	call   804b38 <udivmod>
+  804c21:	83 c4 14             	add    $0x14,%esp
+  804c24:	c3                   	ret
+
+00804c25 <__umoddi3>:
+  804c25:	83 ec 18             	sub    $0x18,%esp
+  804c28:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804c2c:	50                   	push   %eax
+  804c2d:	ff 74 24 2c          	push   0x2c(%esp)
+  804c31:	ff 74 24 2c          	push   0x2c(%esp)
+  804c35:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804c39:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804c3d:	e8 f6 fe ff ff       	call   804b38 <udivmod>
+  804c42:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804c46:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804c4a:	83 c4 24             	add    $0x24,%esp
+  804c4d:	c3                   	ret
+
+00804c4e <__divdi3>:
+  804c4e:	55                   	push   %ebp
+  804c4f:	57                   	push   %edi
+  804c50:	56                   	push   %esi
+  804c51:	53                   	push   %ebx
+  804c52:	83 ec 10             	sub    $0x10,%esp
+  804c55:	8b 44 24 24          	mov    0x24(%esp),%eax
+  804c59:	8b 54 24 28          	mov    0x28(%esp),%edx
+  804c5d:	89 c6                	mov    %eax,%esi
+  804c5f:	89 d7                	mov    %edx,%edi
+  804c61:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  804c65:	33 7c 24 30          	xor    0x30(%esp),%edi
+  804c69:	89 74 24 04          	mov    %esi,0x4(%esp)
+  804c6d:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  804c71:	89 c5                	mov    %eax,%ebp
+  804c73:	f7 dd                	neg    %ebp
+  804c75:	89 d6                	mov    %edx,%esi
+  804c77:	83 d6 00             	adc    $0x0,%esi
+  804c7a:	f7 de                	neg    %esi
+  804c7c:	0f 48 e8             	cmovs  %eax,%ebp
+  804c7f:	0f 49 d6             	cmovns %esi,%edx
+  804c82:	6a 00                	push   $0x0
+  804c84:	8b 74 24 30          	mov    0x30(%esp),%esi
+  804c88:	f7 de                	neg    %esi
+  804c8a:	8b 44 24 34          	mov    0x34(%esp),%eax
+  804c8e:	83 d0 00             	adc    $0x0,%eax
+  804c91:	f7 d8                	neg    %eax
+  804c93:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  804c98:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  804c9d:	50                   	push   %eax
+  804c9e:	56                   	push   %esi
+  804c9f:	89 e8                	mov    %ebp,%eax
+  804ca1:	e8 92 fe ff ff       	call   804b38 <udivmod>
+  804ca6:	83 c4 10             	add    $0x10,%esp
+  804ca9:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  804cae:	78 08                	js     804cb8 <__divdi3+0x6a>
+  804cb0:	83 c4 0c             	add    $0xc,%esp
+  804cb3:	5b                   	pop    %ebx
+  804cb4:	5e                   	pop    %esi
+  804cb5:	5f                   	pop    %edi
+  804cb6:	5d                   	pop    %ebp
+  804cb7:	c3                   	ret
+  804cb8:	f7 d8                	neg    %eax
+  804cba:	83 d2 00             	adc    $0x0,%edx
+  804cbd:	f7 da                	neg    %edx
+  804cbf:	eb ef                	jmp    804cb0 <__divdi3+0x62>
+
+00804cc1 <__moddi3>:
+  804cc1:	55                   	push   %ebp
+  804cc2:	57                   	push   %edi
+  804cc3:	56                   	push   %esi
+  804cc4:	53                   	push   %ebx
+  804cc5:	83 ec 18             	sub    $0x18,%esp
+  804cc8:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  804ccc:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  804cd0:	89 f1                	mov    %esi,%ecx
+  804cd2:	f7 d9                	neg    %ecx
+  804cd4:	89 da                	mov    %ebx,%edx
+  804cd6:	83 d2 00             	adc    $0x0,%edx
+  804cd9:	f7 da                	neg    %edx
+  804cdb:	0f 48 ce             	cmovs  %esi,%ecx
+  804cde:	0f 48 d3             	cmovs  %ebx,%edx
+  804ce1:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804ce5:	50                   	push   %eax
+  804ce6:	8b 74 24 38          	mov    0x38(%esp),%esi
+  804cea:	f7 de                	neg    %esi
+  804cec:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  804cf0:	83 d0 00             	adc    $0x0,%eax
+  804cf3:	f7 d8                	neg    %eax
+  804cf5:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  804cfa:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  804cff:	50                   	push   %eax
+  804d00:	56                   	push   %esi
+  804d01:	89 c8                	mov    %ecx,%eax
+  804d03:	e8 30 fe ff ff       	call   804b38 <udivmod>
+  804d08:	83 c4 10             	add    $0x10,%esp
+  804d0b:	85 db                	test   %ebx,%ebx
+  804d0d:	78 10                	js     804d1f <__moddi3+0x5e>
+  804d0f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804d13:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804d17:	83 c4 14             	add    $0x14,%esp
+  804d1a:	5b                   	pop    %ebx
+  804d1b:	5e                   	pop    %esi
+  804d1c:	5f                   	pop    %edi
+  804d1d:	5d                   	pop    %ebp
+  804d1e:	c3                   	ret
+  804d1f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804d23:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804d27:	f7 d8                	neg    %eax
+  804d29:	83 d2 00             	adc    $0x0,%edx
+  804d2c:	f7 da                	neg    %edx
+  804d2e:	eb e7                	jmp    804d17 <__moddi3+0x56>
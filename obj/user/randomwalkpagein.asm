@@ -0,0 +1,10009 @@
+
+obj/user/randomwalkpagein.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 99 01 00 00       	call   8001ca <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <get_random>:
+uint32_t m_w = 1234;    /* must not be zero */
+uint32_t m_z = 5678;    /* must not be zero */
+ 
+uint32_t get_random()
+{
+	m_z = 36969 * (m_z & 65535) + (m_z >> 16);
+  800033:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  800039:	0f b7 c2             	movzwl %dx,%eax
+  80003c:	69 c0 69 90 00 00    	imul   $0x9069,%eax,%eax
+  800042:	c1 ea 10             	shr    $0x10,%edx
+  800045:	01 d0                	add    %edx,%eax
+  800047:	a3 00 60 80 00       	mov    %eax,0x806000
+	m_w = 18000 * (m_w & 65535) + (m_w >> 16);
+  80004c:	8b 0d 04 60 80 00    	mov    0x806004,%ecx
+  800052:	0f b7 d1             	movzwl %cx,%edx
+  800055:	69 d2 50 46 00 00    	imul   $0x4650,%edx,%edx
+  80005b:	c1 e9 10             	shr    $0x10,%ecx
+  80005e:	01 ca                	add    %ecx,%edx
+  800060:	89 15 04 60 80 00    	mov    %edx,0x806004
+	return (m_z << 16) + m_w;  /* 32-bit result */
+  800066:	c1 e0 10             	shl    $0x10,%eax
+  800069:	01 d0                	add    %edx,%eax
+}
+  80006b:	c3                   	ret
+
+0080006c <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80006c:	55                   	push   %ebp
+  80006d:	89 e5                	mov    %esp,%ebp
+  80006f:	57                   	push   %edi
+  800070:	56                   	push   %esi
+  800071:	53                   	push   %ebx
+  800072:	83 ec 2c             	sub    $0x2c,%esp
+	int r;
+	uintptr_t va;
+	uintptr_t randva[NRANDS];
+
+	for(va = BASE; va < BASE+SIZE; va+=PGSIZE){
+  800075:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+		//cprintf("+%x\n", va);
+		if((r = page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W, 1)) < 0)
+  80007a:	6a 01                	push   $0x1
+  80007c:	6a 07                	push   $0x7
+  80007e:	53                   	push   %ebx
+  80007f:	6a 00                	push   $0x0
+  800081:	e8 5e 35 00 00       	call   8035e4 <page_alloc>
+  800086:	83 c4 10             	add    $0x10,%esp
+  800089:	85 c0                	test   %eax,%eax
+  80008b:	78 2f                	js     8000bc <umain+0x50>
+			panic("sys_page_alloc on %p: %e", va, r);
+
+		// Store the address in the page
+		*(uintptr_t*)va = (uintptr_t)va;
+  80008d:	89 1b                	mov    %ebx,(%ebx)
+	for(va = BASE; va < BASE+SIZE; va+=PGSIZE){
+  80008f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800095:	81 fb 00 00 00 15    	cmp    $0x15000000,%ebx
+  80009b:	75 dd                	jne    80007a <umain+0xe>
+	}
+
+	memset(randva, 0, sizeof(uintptr_t)*NRANDS);
+  80009d:	83 ec 04             	sub    $0x4,%esp
+  8000a0:	6a 14                	push   $0x14
+  8000a2:	6a 00                	push   $0x0
+  8000a4:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  8000a7:	50                   	push   %eax
+  8000a8:	e8 93 09 00 00       	call   800a40 <memset>
+  8000ad:	83 c4 10             	add    $0x10,%esp
+	int i;
+	for(i = 0; i < 10000; i++)
+  8000b0:	be 00 00 00 00       	mov    $0x0,%esi
+	{
+		randva[i%NRANDS] += (get_random()%21 - 10)*PGSIZE;
+  8000b5:	bf 67 66 66 66       	mov    $0x66666667,%edi
+  8000ba:	eb 45                	jmp    800101 <umain+0x95>
+			panic("sys_page_alloc on %p: %e", va, r);
+  8000bc:	83 ec 0c             	sub    $0xc,%esp
+  8000bf:	50                   	push   %eax
+  8000c0:	53                   	push   %ebx
+  8000c1:	68 11 4e 80 00       	push   $0x804e11
+  8000c6:	6a 21                	push   $0x21
+  8000c8:	68 5c 4e 80 00       	push   $0x804e5c
+  8000cd:	e8 5b 01 00 00       	call   80022d <_panic>
+		if(randva[i%NRANDS] < BASE || randva[i%NRANDS] >= BASE+SIZE)
+			randva[i%NRANDS] = ROUNDDOWN(BASE + (get_random() % SIZE), PGSIZE);
+		cprintf("-%x\n", randva[i%NRANDS]);
+  8000d2:	83 ec 08             	sub    $0x8,%esp
+  8000d5:	ff 74 9d d4          	push   -0x2c(%ebp,%ebx,4)
+  8000d9:	68 2a 4e 80 00       	push   $0x804e2a
+  8000de:	e8 25 02 00 00       	call   800308 <cprintf>
+		assert(randva[i%NRANDS] == *(uintptr_t*)randva[i%NRANDS]);
+  8000e3:	8b 44 9d d4          	mov    -0x2c(%ebp,%ebx,4),%eax
+  8000e7:	83 c4 10             	add    $0x10,%esp
+  8000ea:	3b 00                	cmp    (%eax),%eax
+  8000ec:	0f 85 94 00 00 00    	jne    800186 <umain+0x11a>
+	for(i = 0; i < 10000; i++)
+  8000f2:	83 c6 01             	add    $0x1,%esi
+  8000f5:	81 fe 10 27 00 00    	cmp    $0x2710,%esi
+  8000fb:	0f 84 9b 00 00 00    	je     80019c <umain+0x130>
+		randva[i%NRANDS] += (get_random()%21 - 10)*PGSIZE;
+  800101:	e8 2d ff ff ff       	call   800033 <get_random>
+  800106:	89 c1                	mov    %eax,%ecx
+  800108:	89 f0                	mov    %esi,%eax
+  80010a:	f7 ef                	imul   %edi
+  80010c:	d1 fa                	sar    %edx
+  80010e:	89 f0                	mov    %esi,%eax
+  800110:	c1 f8 1f             	sar    $0x1f,%eax
+  800113:	89 d3                	mov    %edx,%ebx
+  800115:	29 c3                	sub    %eax,%ebx
+  800117:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80011a:	89 f3                	mov    %esi,%ebx
+  80011c:	29 c3                	sub    %eax,%ebx
+  80011e:	b8 87 61 18 86       	mov    $0x86186187,%eax
+  800123:	f7 e1                	mul    %ecx
+  800125:	89 c8                	mov    %ecx,%eax
+  800127:	29 d0                	sub    %edx,%eax
+  800129:	d1 e8                	shr    %eax
+  80012b:	01 c2                	add    %eax,%edx
+  80012d:	c1 ea 04             	shr    $0x4,%edx
+  800130:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  800133:	8d 04 82             	lea    (%edx,%eax,4),%eax
+  800136:	29 c1                	sub    %eax,%ecx
+  800138:	83 e9 0a             	sub    $0xa,%ecx
+  80013b:	c1 e1 0c             	shl    $0xc,%ecx
+  80013e:	03 4c 9d d4          	add    -0x2c(%ebp,%ebx,4),%ecx
+  800142:	89 4c 9d d4          	mov    %ecx,-0x2c(%ebp,%ebx,4)
+		if(randva[i%NRANDS] < BASE || randva[i%NRANDS] >= BASE+SIZE)
+  800146:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+  80014c:	81 f9 ff ff ff 04    	cmp    $0x4ffffff,%ecx
+  800152:	0f 86 7a ff ff ff    	jbe    8000d2 <umain+0x66>
+			randva[i%NRANDS] = ROUNDDOWN(BASE + (get_random() % SIZE), PGSIZE);
+  800158:	e8 d6 fe ff ff       	call   800033 <get_random>
+  80015d:	89 c1                	mov    %eax,%ecx
+  80015f:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+  800164:	f7 e2                	mul    %edx
+  800166:	c1 ea 1a             	shr    $0x1a,%edx
+  800169:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80016c:	c1 e0 18             	shl    $0x18,%eax
+  80016f:	29 c1                	sub    %eax,%ecx
+  800171:	81 c1 00 00 00 10    	add    $0x10000000,%ecx
+  800177:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  80017d:	89 4c 9d d4          	mov    %ecx,-0x2c(%ebp,%ebx,4)
+  800181:	e9 4c ff ff ff       	jmp    8000d2 <umain+0x66>
+		assert(randva[i%NRANDS] == *(uintptr_t*)randva[i%NRANDS]);
+  800186:	68 84 4e 80 00       	push   $0x804e84
+  80018b:	68 2f 4e 80 00       	push   $0x804e2f
+  800190:	6a 2f                	push   $0x2f
+  800192:	68 5c 4e 80 00       	push   $0x804e5c
+  800197:	e8 91 00 00 00       	call   80022d <_panic>
+	}
+
+	cprintf("%s: Passed all checks!\n", argc > 0 ? argv[0] : "randomwalkpagein");
+  80019c:	b8 00 4e 80 00       	mov    $0x804e00,%eax
+  8001a1:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8001a5:	7e 05                	jle    8001ac <umain+0x140>
+  8001a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8001aa:	8b 00                	mov    (%eax),%eax
+  8001ac:	83 ec 08             	sub    $0x8,%esp
+  8001af:	50                   	push   %eax
+  8001b0:	68 44 4e 80 00       	push   $0x804e44
+  8001b5:	e8 4e 01 00 00       	call   800308 <cprintf>
+	get_and_print_paging_stats();
+  8001ba:	e8 5f 30 00 00       	call   80321e <get_and_print_paging_stats>
+}
+  8001bf:	83 c4 10             	add    $0x10,%esp
+  8001c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c5:	5b                   	pop    %ebx
+  8001c6:	5e                   	pop    %esi
+  8001c7:	5f                   	pop    %edi
+  8001c8:	5d                   	pop    %ebp
+  8001c9:	c3                   	ret
+
+008001ca <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ca:	55                   	push   %ebp
+  8001cb:	89 e5                	mov    %esp,%ebp
+  8001cd:	56                   	push   %esi
+  8001ce:	53                   	push   %ebx
+  8001cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8001d5:	e8 ca 0b 00 00       	call   800da4 <sys_getenvid>
+  8001da:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001df:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8001e2:	c1 e0 06             	shl    $0x6,%eax
+  8001e5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001ea:	a3 18 e9 80 00       	mov    %eax,0x80e918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001ef:	85 db                	test   %ebx,%ebx
+  8001f1:	7e 07                	jle    8001fa <libmain+0x30>
+		binaryname = argv[0];
+  8001f3:	8b 06                	mov    (%esi),%eax
+  8001f5:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	// call user main routine
+	umain(argc, argv);
+  8001fa:	83 ec 08             	sub    $0x8,%esp
+  8001fd:	56                   	push   %esi
+  8001fe:	53                   	push   %ebx
+  8001ff:	e8 68 fe ff ff       	call   80006c <umain>
+
+	// exit gracefully
+	exit();
+  800204:	e8 0a 00 00 00       	call   800213 <exit>
+}
+  800209:	83 c4 10             	add    $0x10,%esp
+  80020c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80020f:	5b                   	pop    %ebx
+  800210:	5e                   	pop    %esi
+  800211:	5d                   	pop    %ebp
+  800212:	c3                   	ret
+
+00800213 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800213:	55                   	push   %ebp
+  800214:	89 e5                	mov    %esp,%ebp
+  800216:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800219:	e8 2a 13 00 00       	call   801548 <close_all>
+	sys_env_destroy(0);
+  80021e:	83 ec 0c             	sub    $0xc,%esp
+  800221:	6a 00                	push   $0x0
+  800223:	e8 3b 0b 00 00       	call   800d63 <sys_env_destroy>
+}
+  800228:	83 c4 10             	add    $0x10,%esp
+  80022b:	c9                   	leave
+  80022c:	c3                   	ret
+
+0080022d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80022d:	55                   	push   %ebp
+  80022e:	89 e5                	mov    %esp,%ebp
+  800230:	56                   	push   %esi
+  800231:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800232:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800235:	8b 35 08 60 80 00    	mov    0x806008,%esi
+  80023b:	e8 64 0b 00 00       	call   800da4 <sys_getenvid>
+  800240:	83 ec 0c             	sub    $0xc,%esp
+  800243:	ff 75 0c             	push   0xc(%ebp)
+  800246:	ff 75 08             	push   0x8(%ebp)
+  800249:	56                   	push   %esi
+  80024a:	50                   	push   %eax
+  80024b:	68 c0 4e 80 00       	push   $0x804ec0
+  800250:	e8 b3 00 00 00       	call   800308 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800255:	83 c4 18             	add    $0x18,%esp
+  800258:	53                   	push   %ebx
+  800259:	ff 75 10             	push   0x10(%ebp)
+  80025c:	e8 56 00 00 00       	call   8002b7 <vcprintf>
+	cprintf("\n");
+  800261:	c7 04 24 5a 4e 80 00 	movl   $0x804e5a,(%esp)
+  800268:	e8 9b 00 00 00       	call   800308 <cprintf>
+  80026d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800270:	cc                   	int3
+	while (1)
+  800271:	eb fd                	jmp    800270 <_panic+0x43>
+
+00800273 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800273:	55                   	push   %ebp
+  800274:	89 e5                	mov    %esp,%ebp
+  800276:	53                   	push   %ebx
+  800277:	83 ec 04             	sub    $0x4,%esp
+  80027a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80027d:	8b 13                	mov    (%ebx),%edx
+  80027f:	8d 42 01             	lea    0x1(%edx),%eax
+  800282:	89 03                	mov    %eax,(%ebx)
+  800284:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800287:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80028b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800290:	74 09                	je     80029b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800292:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800296:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800299:	c9                   	leave
+  80029a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80029b:	83 ec 08             	sub    $0x8,%esp
+  80029e:	68 ff 00 00 00       	push   $0xff
+  8002a3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002a6:	50                   	push   %eax
+  8002a7:	e8 69 0a 00 00       	call   800d15 <sys_cputs>
+		b->idx = 0;
+  8002ac:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002b2:	83 c4 10             	add    $0x10,%esp
+  8002b5:	eb db                	jmp    800292 <putch+0x1f>
+
+008002b7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002b7:	55                   	push   %ebp
+  8002b8:	89 e5                	mov    %esp,%ebp
+  8002ba:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002c0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002c7:	00 00 00 
+	b.cnt = 0;
+  8002ca:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002d1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002d4:	ff 75 0c             	push   0xc(%ebp)
+  8002d7:	ff 75 08             	push   0x8(%ebp)
+  8002da:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002e0:	50                   	push   %eax
+  8002e1:	68 73 02 80 00       	push   $0x800273
+  8002e6:	e8 14 01 00 00       	call   8003ff <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002eb:	83 c4 08             	add    $0x8,%esp
+  8002ee:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002f4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002fa:	50                   	push   %eax
+  8002fb:	e8 15 0a 00 00       	call   800d15 <sys_cputs>
+
+	return b.cnt;
+}
+  800300:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800306:	c9                   	leave
+  800307:	c3                   	ret
+
+00800308 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800308:	55                   	push   %ebp
+  800309:	89 e5                	mov    %esp,%ebp
+  80030b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80030e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800311:	50                   	push   %eax
+  800312:	ff 75 08             	push   0x8(%ebp)
+  800315:	e8 9d ff ff ff       	call   8002b7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80031a:	c9                   	leave
+  80031b:	c3                   	ret
+
+0080031c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80031c:	55                   	push   %ebp
+  80031d:	89 e5                	mov    %esp,%ebp
+  80031f:	57                   	push   %edi
+  800320:	56                   	push   %esi
+  800321:	53                   	push   %ebx
+  800322:	83 ec 1c             	sub    $0x1c,%esp
+  800325:	89 c7                	mov    %eax,%edi
+  800327:	89 d6                	mov    %edx,%esi
+  800329:	8b 45 08             	mov    0x8(%ebp),%eax
+  80032c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80032f:	89 d1                	mov    %edx,%ecx
+  800331:	89 c2                	mov    %eax,%edx
+  800333:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800336:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800339:	8b 45 10             	mov    0x10(%ebp),%eax
+  80033c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80033f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800342:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800349:	39 c2                	cmp    %eax,%edx
+  80034b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80034e:	72 3e                	jb     80038e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800350:	83 ec 0c             	sub    $0xc,%esp
+  800353:	ff 75 18             	push   0x18(%ebp)
+  800356:	83 eb 01             	sub    $0x1,%ebx
+  800359:	53                   	push   %ebx
+  80035a:	50                   	push   %eax
+  80035b:	83 ec 08             	sub    $0x8,%esp
+  80035e:	ff 75 e4             	push   -0x1c(%ebp)
+  800361:	ff 75 e0             	push   -0x20(%ebp)
+  800364:	ff 75 dc             	push   -0x24(%ebp)
+  800367:	ff 75 d8             	push   -0x28(%ebp)
+  80036a:	e8 4e 49 00 00       	call   804cbd <__udivdi3>
+  80036f:	83 c4 18             	add    $0x18,%esp
+  800372:	52                   	push   %edx
+  800373:	50                   	push   %eax
+  800374:	89 f2                	mov    %esi,%edx
+  800376:	89 f8                	mov    %edi,%eax
+  800378:	e8 9f ff ff ff       	call   80031c <printnum>
+  80037d:	83 c4 20             	add    $0x20,%esp
+  800380:	eb 13                	jmp    800395 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800382:	83 ec 08             	sub    $0x8,%esp
+  800385:	56                   	push   %esi
+  800386:	ff 75 18             	push   0x18(%ebp)
+  800389:	ff d7                	call   *%edi
+  80038b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80038e:	83 eb 01             	sub    $0x1,%ebx
+  800391:	85 db                	test   %ebx,%ebx
+  800393:	7f ed                	jg     800382 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800395:	83 ec 08             	sub    $0x8,%esp
+  800398:	56                   	push   %esi
+  800399:	83 ec 04             	sub    $0x4,%esp
+  80039c:	ff 75 e4             	push   -0x1c(%ebp)
+  80039f:	ff 75 e0             	push   -0x20(%ebp)
+  8003a2:	ff 75 dc             	push   -0x24(%ebp)
+  8003a5:	ff 75 d8             	push   -0x28(%ebp)
+  8003a8:	e8 2e 49 00 00       	call   804cdb <__umoddi3>
+  8003ad:	83 c4 14             	add    $0x14,%esp
+  8003b0:	0f be 80 e3 4e 80 00 	movsbl 0x804ee3(%eax),%eax
+  8003b7:	50                   	push   %eax
+  8003b8:	ff d7                	call   *%edi
+}
+  8003ba:	83 c4 10             	add    $0x10,%esp
+  8003bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c0:	5b                   	pop    %ebx
+  8003c1:	5e                   	pop    %esi
+  8003c2:	5f                   	pop    %edi
+  8003c3:	5d                   	pop    %ebp
+  8003c4:	c3                   	ret
+
+008003c5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003c5:	55                   	push   %ebp
+  8003c6:	89 e5                	mov    %esp,%ebp
+  8003c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003cb:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003cf:	8b 10                	mov    (%eax),%edx
+  8003d1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003d4:	73 0a                	jae    8003e0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003d6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003d9:	89 08                	mov    %ecx,(%eax)
+  8003db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003de:	88 02                	mov    %al,(%edx)
+}
+  8003e0:	5d                   	pop    %ebp
+  8003e1:	c3                   	ret
+
+008003e2 <printfmt>:
+{
+  8003e2:	55                   	push   %ebp
+  8003e3:	89 e5                	mov    %esp,%ebp
+  8003e5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003e8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003eb:	50                   	push   %eax
+  8003ec:	ff 75 10             	push   0x10(%ebp)
+  8003ef:	ff 75 0c             	push   0xc(%ebp)
+  8003f2:	ff 75 08             	push   0x8(%ebp)
+  8003f5:	e8 05 00 00 00       	call   8003ff <vprintfmt>
+}
+  8003fa:	83 c4 10             	add    $0x10,%esp
+  8003fd:	c9                   	leave
+  8003fe:	c3                   	ret
+
+008003ff <vprintfmt>:
+{
+  8003ff:	55                   	push   %ebp
+  800400:	89 e5                	mov    %esp,%ebp
+  800402:	57                   	push   %edi
+  800403:	56                   	push   %esi
+  800404:	53                   	push   %ebx
+  800405:	83 ec 2c             	sub    $0x2c,%esp
+  800408:	8b 75 08             	mov    0x8(%ebp),%esi
+  80040b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80040e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800411:	eb 0a                	jmp    80041d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800413:	83 ec 08             	sub    $0x8,%esp
+  800416:	53                   	push   %ebx
+  800417:	50                   	push   %eax
+  800418:	ff d6                	call   *%esi
+  80041a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80041d:	83 c7 01             	add    $0x1,%edi
+  800420:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800424:	83 f8 25             	cmp    $0x25,%eax
+  800427:	74 0c                	je     800435 <vprintfmt+0x36>
+			if (ch == '\0')
+  800429:	85 c0                	test   %eax,%eax
+  80042b:	75 e6                	jne    800413 <vprintfmt+0x14>
+}
+  80042d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800430:	5b                   	pop    %ebx
+  800431:	5e                   	pop    %esi
+  800432:	5f                   	pop    %edi
+  800433:	5d                   	pop    %ebp
+  800434:	c3                   	ret
+		padc = ' ';
+  800435:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800439:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800440:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800447:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80044e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800453:	8d 47 01             	lea    0x1(%edi),%eax
+  800456:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800459:	0f b6 17             	movzbl (%edi),%edx
+  80045c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80045f:	3c 55                	cmp    $0x55,%al
+  800461:	0f 87 c5 03 00 00    	ja     80082c <vprintfmt+0x42d>
+  800467:	0f b6 c0             	movzbl %al,%eax
+  80046a:	ff 24 85 60 50 80 00 	jmp    *0x805060(,%eax,4)
+  800471:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800474:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800478:	eb d9                	jmp    800453 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80047d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800481:	eb d0                	jmp    800453 <vprintfmt+0x54>
+  800483:	0f b6 d2             	movzbl %dl,%edx
+  800486:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800489:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800491:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800494:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800498:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80049b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80049e:	83 f9 09             	cmp    $0x9,%ecx
+  8004a1:	77 55                	ja     8004f8 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004a3:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004a6:	eb e9                	jmp    800491 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ab:	8b 00                	mov    (%eax),%eax
+  8004ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8004b6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004bc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c0:	79 91                	jns    800453 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004c2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004cf:	eb 82                	jmp    800453 <vprintfmt+0x54>
+			if (width < 0)
+  8004d1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d4:	85 d2                	test   %edx,%edx
+  8004d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004db:	0f 49 c2             	cmovns %edx,%eax
+  8004de:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004e4:	e9 6a ff ff ff       	jmp    800453 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004ec:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004f3:	e9 5b ff ff ff       	jmp    800453 <vprintfmt+0x54>
+  8004f8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004fe:	eb bc                	jmp    8004bc <vprintfmt+0xbd>
+			lflag++;
+  800500:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800503:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800506:	e9 48 ff ff ff       	jmp    800453 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80050b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050e:	8d 78 04             	lea    0x4(%eax),%edi
+  800511:	83 ec 08             	sub    $0x8,%esp
+  800514:	53                   	push   %ebx
+  800515:	ff 30                	push   (%eax)
+  800517:	ff d6                	call   *%esi
+			break;
+  800519:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80051c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80051f:	e9 63 02 00 00       	jmp    800787 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800524:	8b 45 14             	mov    0x14(%ebp),%eax
+  800527:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80052a:	8b 10                	mov    (%eax),%edx
+  80052c:	89 d0                	mov    %edx,%eax
+  80052e:	f7 d8                	neg    %eax
+  800530:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800533:	83 f8 12             	cmp    $0x12,%eax
+  800536:	7f 23                	jg     80055b <vprintfmt+0x15c>
+  800538:	8b 14 85 c0 51 80 00 	mov    0x8051c0(,%eax,4),%edx
+  80053f:	85 d2                	test   %edx,%edx
+  800541:	74 18                	je     80055b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800543:	52                   	push   %edx
+  800544:	68 41 4e 80 00       	push   $0x804e41
+  800549:	53                   	push   %ebx
+  80054a:	56                   	push   %esi
+  80054b:	e8 92 fe ff ff       	call   8003e2 <printfmt>
+  800550:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800553:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800556:	e9 2c 02 00 00       	jmp    800787 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80055b:	50                   	push   %eax
+  80055c:	68 fb 4e 80 00       	push   $0x804efb
+  800561:	53                   	push   %ebx
+  800562:	56                   	push   %esi
+  800563:	e8 7a fe ff ff       	call   8003e2 <printfmt>
+  800568:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80056b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80056e:	e9 14 02 00 00       	jmp    800787 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800573:	8b 45 14             	mov    0x14(%ebp),%eax
+  800576:	83 c0 04             	add    $0x4,%eax
+  800579:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80057c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800581:	85 c9                	test   %ecx,%ecx
+  800583:	b8 f4 4e 80 00       	mov    $0x804ef4,%eax
+  800588:	0f 45 c1             	cmovne %ecx,%eax
+  80058b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80058e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800592:	7e 06                	jle    80059a <vprintfmt+0x19b>
+  800594:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800598:	75 0b                	jne    8005a5 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80059d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005a0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005a3:	eb 5c                	jmp    800601 <vprintfmt+0x202>
+  8005a5:	83 ec 08             	sub    $0x8,%esp
+  8005a8:	ff 75 d0             	push   -0x30(%ebp)
+  8005ab:	ff 75 cc             	push   -0x34(%ebp)
+  8005ae:	e8 19 03 00 00       	call   8008cc <strnlen>
+  8005b3:	89 c2                	mov    %eax,%edx
+  8005b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005b8:	29 d0                	sub    %edx,%eax
+  8005ba:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005bd:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005c7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c9:	eb 0e                	jmp    8005d9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005cb:	83 ec 08             	sub    $0x8,%esp
+  8005ce:	53                   	push   %ebx
+  8005cf:	57                   	push   %edi
+  8005d0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d3:	83 ee 01             	sub    $0x1,%esi
+  8005d6:	83 c4 10             	add    $0x10,%esp
+  8005d9:	85 f6                	test   %esi,%esi
+  8005db:	7f ee                	jg     8005cb <vprintfmt+0x1cc>
+  8005dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e3:	85 c0                	test   %eax,%eax
+  8005e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ea:	0f 49 d0             	cmovns %eax,%edx
+  8005ed:	29 d0                	sub    %edx,%eax
+  8005ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f2:	eb a6                	jmp    80059a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005f4:	83 ec 08             	sub    $0x8,%esp
+  8005f7:	53                   	push   %ebx
+  8005f8:	52                   	push   %edx
+  8005f9:	ff 55 08             	call   *0x8(%ebp)
+  8005fc:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005ff:	89 f1                	mov    %esi,%ecx
+  800601:	8d 71 01             	lea    0x1(%ecx),%esi
+  800604:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800608:	0f be d0             	movsbl %al,%edx
+  80060b:	85 d2                	test   %edx,%edx
+  80060d:	74 28                	je     800637 <vprintfmt+0x238>
+  80060f:	85 ff                	test   %edi,%edi
+  800611:	78 05                	js     800618 <vprintfmt+0x219>
+  800613:	83 ef 01             	sub    $0x1,%edi
+  800616:	78 30                	js     800648 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800618:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80061c:	74 d6                	je     8005f4 <vprintfmt+0x1f5>
+  80061e:	0f be c0             	movsbl %al,%eax
+  800621:	83 e8 20             	sub    $0x20,%eax
+  800624:	83 f8 5e             	cmp    $0x5e,%eax
+  800627:	76 cb                	jbe    8005f4 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800629:	83 ec 08             	sub    $0x8,%esp
+  80062c:	53                   	push   %ebx
+  80062d:	6a 3f                	push   $0x3f
+  80062f:	ff 55 08             	call   *0x8(%ebp)
+  800632:	83 c4 10             	add    $0x10,%esp
+  800635:	eb c8                	jmp    8005ff <vprintfmt+0x200>
+  800637:	8b 75 08             	mov    0x8(%ebp),%esi
+  80063a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80063d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800640:	01 d0                	add    %edx,%eax
+  800642:	29 c8                	sub    %ecx,%eax
+  800644:	89 c7                	mov    %eax,%edi
+  800646:	eb 13                	jmp    80065b <vprintfmt+0x25c>
+  800648:	8b 75 08             	mov    0x8(%ebp),%esi
+  80064b:	eb ed                	jmp    80063a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80064d:	83 ec 08             	sub    $0x8,%esp
+  800650:	53                   	push   %ebx
+  800651:	6a 20                	push   $0x20
+  800653:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800655:	83 ef 01             	sub    $0x1,%edi
+  800658:	83 c4 10             	add    $0x10,%esp
+  80065b:	85 ff                	test   %edi,%edi
+  80065d:	7f ee                	jg     80064d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80065f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800662:	89 45 14             	mov    %eax,0x14(%ebp)
+  800665:	e9 1d 01 00 00       	jmp    800787 <vprintfmt+0x388>
+	if (lflag >= 2)
+  80066a:	83 f9 01             	cmp    $0x1,%ecx
+  80066d:	7f 1b                	jg     80068a <vprintfmt+0x28b>
+	else if (lflag)
+  80066f:	85 c9                	test   %ecx,%ecx
+  800671:	74 63                	je     8006d6 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800673:	8b 45 14             	mov    0x14(%ebp),%eax
+  800676:	8b 00                	mov    (%eax),%eax
+  800678:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80067b:	99                   	cltd
+  80067c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80067f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800682:	8d 40 04             	lea    0x4(%eax),%eax
+  800685:	89 45 14             	mov    %eax,0x14(%ebp)
+  800688:	eb 17                	jmp    8006a1 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80068a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068d:	8b 50 04             	mov    0x4(%eax),%edx
+  800690:	8b 00                	mov    (%eax),%eax
+  800692:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800695:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8d 40 08             	lea    0x8(%eax),%eax
+  80069e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006a1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006a4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006a7:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006ac:	85 c9                	test   %ecx,%ecx
+  8006ae:	0f 89 b9 00 00 00    	jns    80076d <vprintfmt+0x36e>
+				putch('-', putdat);
+  8006b4:	83 ec 08             	sub    $0x8,%esp
+  8006b7:	53                   	push   %ebx
+  8006b8:	6a 2d                	push   $0x2d
+  8006ba:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006bc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006bf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006c2:	f7 da                	neg    %edx
+  8006c4:	83 d1 00             	adc    $0x0,%ecx
+  8006c7:	f7 d9                	neg    %ecx
+  8006c9:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006cc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006d1:	e9 97 00 00 00       	jmp    80076d <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8006d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d9:	8b 00                	mov    (%eax),%eax
+  8006db:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006de:	99                   	cltd
+  8006df:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006eb:	eb b4                	jmp    8006a1 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8006ed:	83 f9 01             	cmp    $0x1,%ecx
+  8006f0:	7f 1b                	jg     80070d <vprintfmt+0x30e>
+	else if (lflag)
+  8006f2:	85 c9                	test   %ecx,%ecx
+  8006f4:	74 2c                	je     800722 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8006f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f9:	8b 10                	mov    (%eax),%edx
+  8006fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800700:	8d 40 04             	lea    0x4(%eax),%eax
+  800703:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800706:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80070b:	eb 60                	jmp    80076d <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80070d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800710:	8b 10                	mov    (%eax),%edx
+  800712:	8b 48 04             	mov    0x4(%eax),%ecx
+  800715:	8d 40 08             	lea    0x8(%eax),%eax
+  800718:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80071b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800720:	eb 4b                	jmp    80076d <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800722:	8b 45 14             	mov    0x14(%ebp),%eax
+  800725:	8b 10                	mov    (%eax),%edx
+  800727:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80072c:	8d 40 04             	lea    0x4(%eax),%eax
+  80072f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800732:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800737:	eb 34                	jmp    80076d <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800739:	83 f9 01             	cmp    $0x1,%ecx
+  80073c:	7f 15                	jg     800753 <vprintfmt+0x354>
+	else if (lflag)
+  80073e:	85 c9                	test   %ecx,%ecx
+  800740:	74 4d                	je     80078f <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800742:	8b 45 14             	mov    0x14(%ebp),%eax
+  800745:	8b 00                	mov    (%eax),%eax
+  800747:	99                   	cltd
+  800748:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80074b:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80074e:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800751:	eb 11                	jmp    800764 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800753:	8b 45 14             	mov    0x14(%ebp),%eax
+  800756:	8b 50 04             	mov    0x4(%eax),%edx
+  800759:	8b 00                	mov    (%eax),%eax
+  80075b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80075e:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800761:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800764:	89 d1                	mov    %edx,%ecx
+  800766:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800768:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80076d:	83 ec 0c             	sub    $0xc,%esp
+  800770:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800774:	50                   	push   %eax
+  800775:	ff 75 e0             	push   -0x20(%ebp)
+  800778:	57                   	push   %edi
+  800779:	51                   	push   %ecx
+  80077a:	52                   	push   %edx
+  80077b:	89 da                	mov    %ebx,%edx
+  80077d:	89 f0                	mov    %esi,%eax
+  80077f:	e8 98 fb ff ff       	call   80031c <printnum>
+			break;
+  800784:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800787:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80078a:	e9 8e fc ff ff       	jmp    80041d <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  80078f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800792:	8b 00                	mov    (%eax),%eax
+  800794:	99                   	cltd
+  800795:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800798:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80079b:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80079e:	eb c4                	jmp    800764 <vprintfmt+0x365>
+			putch('0', putdat);
+  8007a0:	83 ec 08             	sub    $0x8,%esp
+  8007a3:	53                   	push   %ebx
+  8007a4:	6a 30                	push   $0x30
+  8007a6:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007a8:	83 c4 08             	add    $0x8,%esp
+  8007ab:	53                   	push   %ebx
+  8007ac:	6a 78                	push   $0x78
+  8007ae:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b3:	8b 10                	mov    (%eax),%edx
+  8007b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007ba:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c3:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8007c8:	eb a3                	jmp    80076d <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8007ca:	83 f9 01             	cmp    $0x1,%ecx
+  8007cd:	7f 1b                	jg     8007ea <vprintfmt+0x3eb>
+	else if (lflag)
+  8007cf:	85 c9                	test   %ecx,%ecx
+  8007d1:	74 2f                	je     800802 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8007d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d6:	8b 10                	mov    (%eax),%edx
+  8007d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007e3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007e8:	eb 83                	jmp    80076d <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8007ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ed:	8b 10                	mov    (%eax),%edx
+  8007ef:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007f2:	8d 40 08             	lea    0x8(%eax),%eax
+  8007f5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007fd:	e9 6b ff ff ff       	jmp    80076d <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800802:	8b 45 14             	mov    0x14(%ebp),%eax
+  800805:	8b 10                	mov    (%eax),%edx
+  800807:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80080c:	8d 40 04             	lea    0x4(%eax),%eax
+  80080f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800812:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800817:	e9 51 ff ff ff       	jmp    80076d <vprintfmt+0x36e>
+			putch(ch, putdat);
+  80081c:	83 ec 08             	sub    $0x8,%esp
+  80081f:	53                   	push   %ebx
+  800820:	6a 25                	push   $0x25
+  800822:	ff d6                	call   *%esi
+			break;
+  800824:	83 c4 10             	add    $0x10,%esp
+  800827:	e9 5b ff ff ff       	jmp    800787 <vprintfmt+0x388>
+			putch('%', putdat);
+  80082c:	83 ec 08             	sub    $0x8,%esp
+  80082f:	53                   	push   %ebx
+  800830:	6a 25                	push   $0x25
+  800832:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800834:	83 c4 10             	add    $0x10,%esp
+  800837:	89 f8                	mov    %edi,%eax
+  800839:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80083d:	74 05                	je     800844 <vprintfmt+0x445>
+  80083f:	83 e8 01             	sub    $0x1,%eax
+  800842:	eb f5                	jmp    800839 <vprintfmt+0x43a>
+  800844:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800847:	e9 3b ff ff ff       	jmp    800787 <vprintfmt+0x388>
+
+0080084c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80084c:	55                   	push   %ebp
+  80084d:	89 e5                	mov    %esp,%ebp
+  80084f:	83 ec 18             	sub    $0x18,%esp
+  800852:	8b 45 08             	mov    0x8(%ebp),%eax
+  800855:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800858:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80085b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80085f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800862:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800869:	85 c0                	test   %eax,%eax
+  80086b:	74 26                	je     800893 <vsnprintf+0x47>
+  80086d:	85 d2                	test   %edx,%edx
+  80086f:	7e 22                	jle    800893 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800871:	ff 75 14             	push   0x14(%ebp)
+  800874:	ff 75 10             	push   0x10(%ebp)
+  800877:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80087a:	50                   	push   %eax
+  80087b:	68 c5 03 80 00       	push   $0x8003c5
+  800880:	e8 7a fb ff ff       	call   8003ff <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800885:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800888:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80088b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80088e:	83 c4 10             	add    $0x10,%esp
+}
+  800891:	c9                   	leave
+  800892:	c3                   	ret
+		return -E_INVAL;
+  800893:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800898:	eb f7                	jmp    800891 <vsnprintf+0x45>
+
+0080089a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80089a:	55                   	push   %ebp
+  80089b:	89 e5                	mov    %esp,%ebp
+  80089d:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008a0:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008a3:	50                   	push   %eax
+  8008a4:	ff 75 10             	push   0x10(%ebp)
+  8008a7:	ff 75 0c             	push   0xc(%ebp)
+  8008aa:	ff 75 08             	push   0x8(%ebp)
+  8008ad:	e8 9a ff ff ff       	call   80084c <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008b2:	c9                   	leave
+  8008b3:	c3                   	ret
+
+008008b4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008b4:	55                   	push   %ebp
+  8008b5:	89 e5                	mov    %esp,%ebp
+  8008b7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008bf:	eb 03                	jmp    8008c4 <strlen+0x10>
+		n++;
+  8008c1:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008c4:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008c8:	75 f7                	jne    8008c1 <strlen+0xd>
+	return n;
+}
+  8008ca:	5d                   	pop    %ebp
+  8008cb:	c3                   	ret
+
+008008cc <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008cc:	55                   	push   %ebp
+  8008cd:	89 e5                	mov    %esp,%ebp
+  8008cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008da:	eb 03                	jmp    8008df <strnlen+0x13>
+		n++;
+  8008dc:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008df:	39 d0                	cmp    %edx,%eax
+  8008e1:	74 08                	je     8008eb <strnlen+0x1f>
+  8008e3:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008e7:	75 f3                	jne    8008dc <strnlen+0x10>
+  8008e9:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008eb:	89 d0                	mov    %edx,%eax
+  8008ed:	5d                   	pop    %ebp
+  8008ee:	c3                   	ret
+
+008008ef <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008ef:	55                   	push   %ebp
+  8008f0:	89 e5                	mov    %esp,%ebp
+  8008f2:	53                   	push   %ebx
+  8008f3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fe:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800902:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800905:	83 c0 01             	add    $0x1,%eax
+  800908:	84 d2                	test   %dl,%dl
+  80090a:	75 f2                	jne    8008fe <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80090c:	89 c8                	mov    %ecx,%eax
+  80090e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800911:	c9                   	leave
+  800912:	c3                   	ret
+
+00800913 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800913:	55                   	push   %ebp
+  800914:	89 e5                	mov    %esp,%ebp
+  800916:	53                   	push   %ebx
+  800917:	83 ec 10             	sub    $0x10,%esp
+  80091a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80091d:	53                   	push   %ebx
+  80091e:	e8 91 ff ff ff       	call   8008b4 <strlen>
+  800923:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800926:	ff 75 0c             	push   0xc(%ebp)
+  800929:	01 d8                	add    %ebx,%eax
+  80092b:	50                   	push   %eax
+  80092c:	e8 be ff ff ff       	call   8008ef <strcpy>
+	return dst;
+}
+  800931:	89 d8                	mov    %ebx,%eax
+  800933:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800936:	c9                   	leave
+  800937:	c3                   	ret
+
+00800938 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800938:	55                   	push   %ebp
+  800939:	89 e5                	mov    %esp,%ebp
+  80093b:	56                   	push   %esi
+  80093c:	53                   	push   %ebx
+  80093d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800940:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800943:	89 f3                	mov    %esi,%ebx
+  800945:	03 5d 10             	add    0x10(%ebp),%ebx
+  800948:	89 f0                	mov    %esi,%eax
+  80094a:	eb 0f                	jmp    80095b <strncpy+0x23>
+		*dst++ = *src;
+  80094c:	83 c0 01             	add    $0x1,%eax
+  80094f:	0f b6 0a             	movzbl (%edx),%ecx
+  800952:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800955:	80 f9 01             	cmp    $0x1,%cl
+  800958:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80095b:	39 d8                	cmp    %ebx,%eax
+  80095d:	75 ed                	jne    80094c <strncpy+0x14>
+	}
+	return ret;
+}
+  80095f:	89 f0                	mov    %esi,%eax
+  800961:	5b                   	pop    %ebx
+  800962:	5e                   	pop    %esi
+  800963:	5d                   	pop    %ebp
+  800964:	c3                   	ret
+
+00800965 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800965:	55                   	push   %ebp
+  800966:	89 e5                	mov    %esp,%ebp
+  800968:	56                   	push   %esi
+  800969:	53                   	push   %ebx
+  80096a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80096d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800970:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800973:	89 f0                	mov    %esi,%eax
+  800975:	85 d2                	test   %edx,%edx
+  800977:	74 21                	je     80099a <strlcpy+0x35>
+  800979:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80097d:	89 f2                	mov    %esi,%edx
+  80097f:	eb 09                	jmp    80098a <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800981:	83 c1 01             	add    $0x1,%ecx
+  800984:	83 c2 01             	add    $0x1,%edx
+  800987:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80098a:	39 c2                	cmp    %eax,%edx
+  80098c:	74 09                	je     800997 <strlcpy+0x32>
+  80098e:	0f b6 19             	movzbl (%ecx),%ebx
+  800991:	84 db                	test   %bl,%bl
+  800993:	75 ec                	jne    800981 <strlcpy+0x1c>
+  800995:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800997:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80099a:	29 f0                	sub    %esi,%eax
+}
+  80099c:	5b                   	pop    %ebx
+  80099d:	5e                   	pop    %esi
+  80099e:	5d                   	pop    %ebp
+  80099f:	c3                   	ret
+
+008009a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009a0:	55                   	push   %ebp
+  8009a1:	89 e5                	mov    %esp,%ebp
+  8009a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009a9:	eb 06                	jmp    8009b1 <strcmp+0x11>
+		p++, q++;
+  8009ab:	83 c1 01             	add    $0x1,%ecx
+  8009ae:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009b1:	0f b6 01             	movzbl (%ecx),%eax
+  8009b4:	84 c0                	test   %al,%al
+  8009b6:	74 04                	je     8009bc <strcmp+0x1c>
+  8009b8:	3a 02                	cmp    (%edx),%al
+  8009ba:	74 ef                	je     8009ab <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009bc:	0f b6 c0             	movzbl %al,%eax
+  8009bf:	0f b6 12             	movzbl (%edx),%edx
+  8009c2:	29 d0                	sub    %edx,%eax
+}
+  8009c4:	5d                   	pop    %ebp
+  8009c5:	c3                   	ret
+
+008009c6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009c6:	55                   	push   %ebp
+  8009c7:	89 e5                	mov    %esp,%ebp
+  8009c9:	53                   	push   %ebx
+  8009ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009d0:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009d3:	eb 09                	jmp    8009de <strncmp+0x18>
+		n--, p++, q++;
+  8009d5:	83 ea 01             	sub    $0x1,%edx
+  8009d8:	83 c0 01             	add    $0x1,%eax
+  8009db:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009de:	85 d2                	test   %edx,%edx
+  8009e0:	74 18                	je     8009fa <strncmp+0x34>
+  8009e2:	0f b6 18             	movzbl (%eax),%ebx
+  8009e5:	84 db                	test   %bl,%bl
+  8009e7:	74 04                	je     8009ed <strncmp+0x27>
+  8009e9:	3a 19                	cmp    (%ecx),%bl
+  8009eb:	74 e8                	je     8009d5 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009ed:	0f b6 00             	movzbl (%eax),%eax
+  8009f0:	0f b6 11             	movzbl (%ecx),%edx
+  8009f3:	29 d0                	sub    %edx,%eax
+}
+  8009f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009f8:	c9                   	leave
+  8009f9:	c3                   	ret
+		return 0;
+  8009fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ff:	eb f4                	jmp    8009f5 <strncmp+0x2f>
+
+00800a01 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a01:	55                   	push   %ebp
+  800a02:	89 e5                	mov    %esp,%ebp
+  800a04:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a07:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a0b:	eb 03                	jmp    800a10 <strchr+0xf>
+  800a0d:	83 c0 01             	add    $0x1,%eax
+  800a10:	0f b6 10             	movzbl (%eax),%edx
+  800a13:	84 d2                	test   %dl,%dl
+  800a15:	74 06                	je     800a1d <strchr+0x1c>
+		if (*s == c)
+  800a17:	38 ca                	cmp    %cl,%dl
+  800a19:	75 f2                	jne    800a0d <strchr+0xc>
+  800a1b:	eb 05                	jmp    800a22 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a22:	5d                   	pop    %ebp
+  800a23:	c3                   	ret
+
+00800a24 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a24:	55                   	push   %ebp
+  800a25:	89 e5                	mov    %esp,%ebp
+  800a27:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a2e:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a31:	38 ca                	cmp    %cl,%dl
+  800a33:	74 09                	je     800a3e <strfind+0x1a>
+  800a35:	84 d2                	test   %dl,%dl
+  800a37:	74 05                	je     800a3e <strfind+0x1a>
+	for (; *s; s++)
+  800a39:	83 c0 01             	add    $0x1,%eax
+  800a3c:	eb f0                	jmp    800a2e <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a3e:	5d                   	pop    %ebp
+  800a3f:	c3                   	ret
+
+00800a40 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a40:	55                   	push   %ebp
+  800a41:	89 e5                	mov    %esp,%ebp
+  800a43:	57                   	push   %edi
+  800a44:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a47:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a4a:	85 c9                	test   %ecx,%ecx
+  800a4c:	74 20                	je     800a6e <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a4e:	89 f8                	mov    %edi,%eax
+  800a50:	09 c8                	or     %ecx,%eax
+  800a52:	a8 03                	test   $0x3,%al
+  800a54:	75 12                	jne    800a68 <memset+0x28>
+		c &= 0xFF;
+  800a56:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a5a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a60:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a63:	fc                   	cld
+  800a64:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a66:	eb 06                	jmp    800a6e <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a6b:	fc                   	cld
+  800a6c:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a6e:	89 f8                	mov    %edi,%eax
+  800a70:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a73:	c9                   	leave
+  800a74:	c3                   	ret
+
+00800a75 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a75:	55                   	push   %ebp
+  800a76:	89 e5                	mov    %esp,%ebp
+  800a78:	57                   	push   %edi
+  800a79:	56                   	push   %esi
+  800a7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a7d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a80:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a83:	39 c6                	cmp    %eax,%esi
+  800a85:	73 32                	jae    800ab9 <memmove+0x44>
+  800a87:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a8a:	39 d0                	cmp    %edx,%eax
+  800a8c:	73 2b                	jae    800ab9 <memmove+0x44>
+		s += n;
+		d += n;
+  800a8e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a91:	89 d6                	mov    %edx,%esi
+  800a93:	09 fe                	or     %edi,%esi
+  800a95:	09 ce                	or     %ecx,%esi
+  800a97:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a9d:	75 0e                	jne    800aad <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a9f:	83 ef 04             	sub    $0x4,%edi
+  800aa2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aa5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800aa8:	fd                   	std
+  800aa9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aab:	eb 09                	jmp    800ab6 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800aad:	83 ef 01             	sub    $0x1,%edi
+  800ab0:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ab3:	fd                   	std
+  800ab4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ab6:	fc                   	cld
+  800ab7:	eb 1a                	jmp    800ad3 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ab9:	89 f2                	mov    %esi,%edx
+  800abb:	09 c2                	or     %eax,%edx
+  800abd:	09 ca                	or     %ecx,%edx
+  800abf:	f6 c2 03             	test   $0x3,%dl
+  800ac2:	75 0a                	jne    800ace <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ac4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ac7:	89 c7                	mov    %eax,%edi
+  800ac9:	fc                   	cld
+  800aca:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800acc:	eb 05                	jmp    800ad3 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ace:	89 c7                	mov    %eax,%edi
+  800ad0:	fc                   	cld
+  800ad1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ad3:	5e                   	pop    %esi
+  800ad4:	5f                   	pop    %edi
+  800ad5:	5d                   	pop    %ebp
+  800ad6:	c3                   	ret
+
+00800ad7 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800add:	ff 75 10             	push   0x10(%ebp)
+  800ae0:	ff 75 0c             	push   0xc(%ebp)
+  800ae3:	ff 75 08             	push   0x8(%ebp)
+  800ae6:	e8 8a ff ff ff       	call   800a75 <memmove>
+}
+  800aeb:	c9                   	leave
+  800aec:	c3                   	ret
+
+00800aed <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800aed:	55                   	push   %ebp
+  800aee:	89 e5                	mov    %esp,%ebp
+  800af0:	56                   	push   %esi
+  800af1:	53                   	push   %ebx
+  800af2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800af8:	89 c6                	mov    %eax,%esi
+  800afa:	03 75 10             	add    0x10(%ebp),%esi
+  800afd:	eb 06                	jmp    800b05 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800aff:	83 c0 01             	add    $0x1,%eax
+  800b02:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b05:	39 f0                	cmp    %esi,%eax
+  800b07:	74 14                	je     800b1d <memcmp+0x30>
+		if (*s1 != *s2)
+  800b09:	0f b6 08             	movzbl (%eax),%ecx
+  800b0c:	0f b6 1a             	movzbl (%edx),%ebx
+  800b0f:	38 d9                	cmp    %bl,%cl
+  800b11:	74 ec                	je     800aff <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b13:	0f b6 c1             	movzbl %cl,%eax
+  800b16:	0f b6 db             	movzbl %bl,%ebx
+  800b19:	29 d8                	sub    %ebx,%eax
+  800b1b:	eb 05                	jmp    800b22 <memcmp+0x35>
+	}
+
+	return 0;
+  800b1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b22:	5b                   	pop    %ebx
+  800b23:	5e                   	pop    %esi
+  800b24:	5d                   	pop    %ebp
+  800b25:	c3                   	ret
+
+00800b26 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b26:	55                   	push   %ebp
+  800b27:	89 e5                	mov    %esp,%ebp
+  800b29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b2f:	89 c2                	mov    %eax,%edx
+  800b31:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b34:	eb 03                	jmp    800b39 <memfind+0x13>
+  800b36:	83 c0 01             	add    $0x1,%eax
+  800b39:	39 d0                	cmp    %edx,%eax
+  800b3b:	73 04                	jae    800b41 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b3d:	38 08                	cmp    %cl,(%eax)
+  800b3f:	75 f5                	jne    800b36 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b41:	5d                   	pop    %ebp
+  800b42:	c3                   	ret
+
+00800b43 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b43:	55                   	push   %ebp
+  800b44:	89 e5                	mov    %esp,%ebp
+  800b46:	57                   	push   %edi
+  800b47:	56                   	push   %esi
+  800b48:	53                   	push   %ebx
+  800b49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b4f:	eb 03                	jmp    800b54 <strtol+0x11>
+		s++;
+  800b51:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b54:	0f b6 02             	movzbl (%edx),%eax
+  800b57:	3c 20                	cmp    $0x20,%al
+  800b59:	74 f6                	je     800b51 <strtol+0xe>
+  800b5b:	3c 09                	cmp    $0x9,%al
+  800b5d:	74 f2                	je     800b51 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b5f:	3c 2b                	cmp    $0x2b,%al
+  800b61:	74 2a                	je     800b8d <strtol+0x4a>
+	int neg = 0;
+  800b63:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b68:	3c 2d                	cmp    $0x2d,%al
+  800b6a:	74 2b                	je     800b97 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b6c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b72:	75 0f                	jne    800b83 <strtol+0x40>
+  800b74:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b77:	74 28                	je     800ba1 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b79:	85 db                	test   %ebx,%ebx
+  800b7b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b80:	0f 44 d8             	cmove  %eax,%ebx
+  800b83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b88:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b8b:	eb 46                	jmp    800bd3 <strtol+0x90>
+		s++;
+  800b8d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b90:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b95:	eb d5                	jmp    800b6c <strtol+0x29>
+		s++, neg = 1;
+  800b97:	83 c2 01             	add    $0x1,%edx
+  800b9a:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b9f:	eb cb                	jmp    800b6c <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ba1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ba5:	74 0e                	je     800bb5 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ba7:	85 db                	test   %ebx,%ebx
+  800ba9:	75 d8                	jne    800b83 <strtol+0x40>
+		s++, base = 8;
+  800bab:	83 c2 01             	add    $0x1,%edx
+  800bae:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bb3:	eb ce                	jmp    800b83 <strtol+0x40>
+		s += 2, base = 16;
+  800bb5:	83 c2 02             	add    $0x2,%edx
+  800bb8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bbd:	eb c4                	jmp    800b83 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bbf:	0f be c0             	movsbl %al,%eax
+  800bc2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bc5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bc8:	7d 3a                	jge    800c04 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bca:	83 c2 01             	add    $0x1,%edx
+  800bcd:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bd1:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bd3:	0f b6 02             	movzbl (%edx),%eax
+  800bd6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bd9:	89 f3                	mov    %esi,%ebx
+  800bdb:	80 fb 09             	cmp    $0x9,%bl
+  800bde:	76 df                	jbe    800bbf <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800be0:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800be3:	89 f3                	mov    %esi,%ebx
+  800be5:	80 fb 19             	cmp    $0x19,%bl
+  800be8:	77 08                	ja     800bf2 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bea:	0f be c0             	movsbl %al,%eax
+  800bed:	83 e8 57             	sub    $0x57,%eax
+  800bf0:	eb d3                	jmp    800bc5 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bf2:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bf5:	89 f3                	mov    %esi,%ebx
+  800bf7:	80 fb 19             	cmp    $0x19,%bl
+  800bfa:	77 08                	ja     800c04 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bfc:	0f be c0             	movsbl %al,%eax
+  800bff:	83 e8 37             	sub    $0x37,%eax
+  800c02:	eb c1                	jmp    800bc5 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c04:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c08:	74 05                	je     800c0f <strtol+0xcc>
+		*endptr = (char *) s;
+  800c0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c0d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c0f:	89 c8                	mov    %ecx,%eax
+  800c11:	f7 d8                	neg    %eax
+  800c13:	85 ff                	test   %edi,%edi
+  800c15:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c18:	89 c8                	mov    %ecx,%eax
+  800c1a:	5b                   	pop    %ebx
+  800c1b:	5e                   	pop    %esi
+  800c1c:	5f                   	pop    %edi
+  800c1d:	5d                   	pop    %ebp
+  800c1e:	c3                   	ret
+
+00800c1f <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800c1f:	55                   	push   %ebp
+  800c20:	89 e5                	mov    %esp,%ebp
+  800c22:	57                   	push   %edi
+  800c23:	56                   	push   %esi
+  800c24:	53                   	push   %ebx
+  800c25:	83 ec 0c             	sub    $0xc,%esp
+  800c28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800c2b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c2e:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800c31:	85 ff                	test   %edi,%edi
+  800c33:	74 16                	je     800c4b <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800c35:	83 ec 04             	sub    $0x4,%esp
+  800c38:	56                   	push   %esi
+  800c39:	6a 00                	push   $0x0
+  800c3b:	53                   	push   %ebx
+  800c3c:	e8 02 ff ff ff       	call   800b43 <strtol>
+  800c41:	89 07                	mov    %eax,(%edi)
+  800c43:	83 c4 10             	add    $0x10,%esp
+  800c46:	eb 03                	jmp    800c4b <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800c48:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800c4b:	0f b6 03             	movzbl (%ebx),%eax
+  800c4e:	3c 20                	cmp    $0x20,%al
+  800c50:	74 f6                	je     800c48 <strisl+0x29>
+  800c52:	3c 09                	cmp    $0x9,%al
+  800c54:	74 f2                	je     800c48 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c56:	3c 2b                	cmp    $0x2b,%al
+  800c58:	74 23                	je     800c7d <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800c5a:	3c 2d                	cmp    $0x2d,%al
+  800c5c:	0f 94 c0             	sete   %al
+  800c5f:	0f b6 c0             	movzbl %al,%eax
+  800c62:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c64:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800c6a:	75 41                	jne    800cad <strisl+0x8e>
+  800c6c:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800c6f:	74 11                	je     800c82 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c71:	85 f6                	test   %esi,%esi
+  800c73:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c78:	0f 44 f0             	cmove  %eax,%esi
+  800c7b:	eb 30                	jmp    800cad <strisl+0x8e>
+		s++;
+  800c7d:	83 c3 01             	add    $0x1,%ebx
+  800c80:	eb e2                	jmp    800c64 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c82:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800c86:	74 0e                	je     800c96 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800c88:	85 f6                	test   %esi,%esi
+  800c8a:	75 21                	jne    800cad <strisl+0x8e>
+		s++, base = 8;
+  800c8c:	83 c3 01             	add    $0x1,%ebx
+  800c8f:	be 08 00 00 00       	mov    $0x8,%esi
+  800c94:	eb 17                	jmp    800cad <strisl+0x8e>
+		s += 2, base = 16;
+  800c96:	83 c3 02             	add    $0x2,%ebx
+  800c99:	be 10 00 00 00       	mov    $0x10,%esi
+  800c9e:	eb 0d                	jmp    800cad <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ca0:	0f be c0             	movsbl %al,%eax
+  800ca3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800ca6:	39 f0                	cmp    %esi,%eax
+  800ca8:	7d 38                	jge    800ce2 <strisl+0xc3>
+			return 0;
+		s++;
+  800caa:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800cad:	0f b6 03             	movzbl (%ebx),%eax
+  800cb0:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800cb3:	80 fa 09             	cmp    $0x9,%dl
+  800cb6:	76 e8                	jbe    800ca0 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800cb8:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800cbb:	80 fa 19             	cmp    $0x19,%dl
+  800cbe:	77 08                	ja     800cc8 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800cc0:	0f be c0             	movsbl %al,%eax
+  800cc3:	83 e8 57             	sub    $0x57,%eax
+  800cc6:	eb de                	jmp    800ca6 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cc8:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800ccb:	80 fa 19             	cmp    $0x19,%dl
+  800cce:	77 08                	ja     800cd8 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800cd0:	0f be c0             	movsbl %al,%eax
+  800cd3:	83 e8 37             	sub    $0x37,%eax
+  800cd6:	eb ce                	jmp    800ca6 <strisl+0x87>
+		else if (!*s)
+  800cd8:	84 c0                	test   %al,%al
+  800cda:	0f 94 c0             	sete   %al
+  800cdd:	0f b6 c0             	movzbl %al,%eax
+  800ce0:	eb 05                	jmp    800ce7 <strisl+0xc8>
+			return 0;
+  800ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800ce7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cea:	5b                   	pop    %ebx
+  800ceb:	5e                   	pop    %esi
+  800cec:	5f                   	pop    %edi
+  800ced:	5d                   	pop    %ebp
+  800cee:	c3                   	ret
+
+00800cef <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800cef:	55                   	push   %ebp
+  800cf0:	89 e5                	mov    %esp,%ebp
+  800cf2:	83 ec 10             	sub    $0x10,%esp
+  800cf5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800cf8:	89 c8                	mov    %ecx,%eax
+  800cfa:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800cff:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800d02:	eb 0b                	jmp    800d0f <touch_mem+0x20>
+		c = *(char *)page;
+  800d04:	0f b6 10             	movzbl (%eax),%edx
+  800d07:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800d0a:	05 00 10 00 00       	add    $0x1000,%eax
+  800d0f:	39 c8                	cmp    %ecx,%eax
+  800d11:	72 f1                	jb     800d04 <touch_mem+0x15>
+}
+  800d13:	c9                   	leave
+  800d14:	c3                   	ret
+
+00800d15 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d15:	55                   	push   %ebp
+  800d16:	89 e5                	mov    %esp,%ebp
+  800d18:	57                   	push   %edi
+  800d19:	56                   	push   %esi
+  800d1a:	53                   	push   %ebx
+	touch_mem(s, len);
+  800d1b:	ff 75 0c             	push   0xc(%ebp)
+  800d1e:	ff 75 08             	push   0x8(%ebp)
+  800d21:	e8 c9 ff ff ff       	call   800cef <touch_mem>
+	asm volatile("int %1\n"
+  800d26:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d31:	89 c3                	mov    %eax,%ebx
+  800d33:	89 c7                	mov    %eax,%edi
+  800d35:	89 c6                	mov    %eax,%esi
+  800d37:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d39:	83 c4 08             	add    $0x8,%esp
+  800d3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3f:	5b                   	pop    %ebx
+  800d40:	5e                   	pop    %esi
+  800d41:	5f                   	pop    %edi
+  800d42:	5d                   	pop    %ebp
+  800d43:	c3                   	ret
+
+00800d44 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d44:	55                   	push   %ebp
+  800d45:	89 e5                	mov    %esp,%ebp
+  800d47:	57                   	push   %edi
+  800d48:	56                   	push   %esi
+  800d49:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d54:	89 d1                	mov    %edx,%ecx
+  800d56:	89 d3                	mov    %edx,%ebx
+  800d58:	89 d7                	mov    %edx,%edi
+  800d5a:	89 d6                	mov    %edx,%esi
+  800d5c:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d5e:	5b                   	pop    %ebx
+  800d5f:	5e                   	pop    %esi
+  800d60:	5f                   	pop    %edi
+  800d61:	5d                   	pop    %ebp
+  800d62:	c3                   	ret
+
+00800d63 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d63:	55                   	push   %ebp
+  800d64:	89 e5                	mov    %esp,%ebp
+  800d66:	57                   	push   %edi
+  800d67:	56                   	push   %esi
+  800d68:	53                   	push   %ebx
+  800d69:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d74:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d79:	89 cb                	mov    %ecx,%ebx
+  800d7b:	89 cf                	mov    %ecx,%edi
+  800d7d:	89 ce                	mov    %ecx,%esi
+  800d7f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d81:	85 c0                	test   %eax,%eax
+  800d83:	7f 08                	jg     800d8d <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d88:	5b                   	pop    %ebx
+  800d89:	5e                   	pop    %esi
+  800d8a:	5f                   	pop    %edi
+  800d8b:	5d                   	pop    %ebp
+  800d8c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d8d:	83 ec 0c             	sub    $0xc,%esp
+  800d90:	50                   	push   %eax
+  800d91:	6a 03                	push   $0x3
+  800d93:	68 2b 52 80 00       	push   $0x80522b
+  800d98:	6a 23                	push   $0x23
+  800d9a:	68 48 52 80 00       	push   $0x805248
+  800d9f:	e8 89 f4 ff ff       	call   80022d <_panic>
+
+00800da4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800da4:	55                   	push   %ebp
+  800da5:	89 e5                	mov    %esp,%ebp
+  800da7:	57                   	push   %edi
+  800da8:	56                   	push   %esi
+  800da9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800daa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800daf:	b8 02 00 00 00       	mov    $0x2,%eax
+  800db4:	89 d1                	mov    %edx,%ecx
+  800db6:	89 d3                	mov    %edx,%ebx
+  800db8:	89 d7                	mov    %edx,%edi
+  800dba:	89 d6                	mov    %edx,%esi
+  800dbc:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dbe:	5b                   	pop    %ebx
+  800dbf:	5e                   	pop    %esi
+  800dc0:	5f                   	pop    %edi
+  800dc1:	5d                   	pop    %ebp
+  800dc2:	c3                   	ret
+
+00800dc3 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dc3:	55                   	push   %ebp
+  800dc4:	89 e5                	mov    %esp,%ebp
+  800dc6:	57                   	push   %edi
+  800dc7:	56                   	push   %esi
+  800dc8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dce:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dd3:	89 d1                	mov    %edx,%ecx
+  800dd5:	89 d3                	mov    %edx,%ebx
+  800dd7:	89 d7                	mov    %edx,%edi
+  800dd9:	89 d6                	mov    %edx,%esi
+  800ddb:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ddd:	5b                   	pop    %ebx
+  800dde:	5e                   	pop    %esi
+  800ddf:	5f                   	pop    %edi
+  800de0:	5d                   	pop    %ebp
+  800de1:	c3                   	ret
+
+00800de2 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800de2:	55                   	push   %ebp
+  800de3:	89 e5                	mov    %esp,%ebp
+  800de5:	57                   	push   %edi
+  800de6:	56                   	push   %esi
+  800de7:	53                   	push   %ebx
+  800de8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800deb:	be 00 00 00 00       	mov    $0x0,%esi
+  800df0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df6:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dfb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dfe:	89 f7                	mov    %esi,%edi
+  800e00:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e02:	85 c0                	test   %eax,%eax
+  800e04:	7f 08                	jg     800e0e <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e09:	5b                   	pop    %ebx
+  800e0a:	5e                   	pop    %esi
+  800e0b:	5f                   	pop    %edi
+  800e0c:	5d                   	pop    %ebp
+  800e0d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e0e:	83 ec 0c             	sub    $0xc,%esp
+  800e11:	50                   	push   %eax
+  800e12:	6a 04                	push   $0x4
+  800e14:	68 2b 52 80 00       	push   $0x80522b
+  800e19:	6a 23                	push   $0x23
+  800e1b:	68 48 52 80 00       	push   $0x805248
+  800e20:	e8 08 f4 ff ff       	call   80022d <_panic>
+
+00800e25 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e25:	55                   	push   %ebp
+  800e26:	89 e5                	mov    %esp,%ebp
+  800e28:	57                   	push   %edi
+  800e29:	56                   	push   %esi
+  800e2a:	53                   	push   %ebx
+  800e2b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e34:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e3c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e3f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e42:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e44:	85 c0                	test   %eax,%eax
+  800e46:	7f 08                	jg     800e50 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4b:	5b                   	pop    %ebx
+  800e4c:	5e                   	pop    %esi
+  800e4d:	5f                   	pop    %edi
+  800e4e:	5d                   	pop    %ebp
+  800e4f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e50:	83 ec 0c             	sub    $0xc,%esp
+  800e53:	50                   	push   %eax
+  800e54:	6a 05                	push   $0x5
+  800e56:	68 2b 52 80 00       	push   $0x80522b
+  800e5b:	6a 23                	push   $0x23
+  800e5d:	68 48 52 80 00       	push   $0x805248
+  800e62:	e8 c6 f3 ff ff       	call   80022d <_panic>
+
+00800e67 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e67:	55                   	push   %ebp
+  800e68:	89 e5                	mov    %esp,%ebp
+  800e6a:	57                   	push   %edi
+  800e6b:	56                   	push   %esi
+  800e6c:	53                   	push   %ebx
+  800e6d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e80:	89 df                	mov    %ebx,%edi
+  800e82:	89 de                	mov    %ebx,%esi
+  800e84:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e86:	85 c0                	test   %eax,%eax
+  800e88:	7f 08                	jg     800e92 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8d:	5b                   	pop    %ebx
+  800e8e:	5e                   	pop    %esi
+  800e8f:	5f                   	pop    %edi
+  800e90:	5d                   	pop    %ebp
+  800e91:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e92:	83 ec 0c             	sub    $0xc,%esp
+  800e95:	50                   	push   %eax
+  800e96:	6a 06                	push   $0x6
+  800e98:	68 2b 52 80 00       	push   $0x80522b
+  800e9d:	6a 23                	push   $0x23
+  800e9f:	68 48 52 80 00       	push   $0x805248
+  800ea4:	e8 84 f3 ff ff       	call   80022d <_panic>
+
+00800ea9 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800ea9:	55                   	push   %ebp
+  800eaa:	89 e5                	mov    %esp,%ebp
+  800eac:	57                   	push   %edi
+  800ead:	56                   	push   %esi
+  800eae:	53                   	push   %ebx
+  800eaf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebd:	b8 18 00 00 00       	mov    $0x18,%eax
+  800ec2:	89 df                	mov    %ebx,%edi
+  800ec4:	89 de                	mov    %ebx,%esi
+  800ec6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec8:	85 c0                	test   %eax,%eax
+  800eca:	7f 08                	jg     800ed4 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ecc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecf:	5b                   	pop    %ebx
+  800ed0:	5e                   	pop    %esi
+  800ed1:	5f                   	pop    %edi
+  800ed2:	5d                   	pop    %ebp
+  800ed3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed4:	83 ec 0c             	sub    $0xc,%esp
+  800ed7:	50                   	push   %eax
+  800ed8:	6a 18                	push   $0x18
+  800eda:	68 2b 52 80 00       	push   $0x80522b
+  800edf:	6a 23                	push   $0x23
+  800ee1:	68 48 52 80 00       	push   $0x805248
+  800ee6:	e8 42 f3 ff ff       	call   80022d <_panic>
+
+00800eeb <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800eeb:	55                   	push   %ebp
+  800eec:	89 e5                	mov    %esp,%ebp
+  800eee:	57                   	push   %edi
+  800eef:	56                   	push   %esi
+  800ef0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ef1:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efc:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f04:	89 f7                	mov    %esi,%edi
+  800f06:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800f08:	5b                   	pop    %ebx
+  800f09:	5e                   	pop    %esi
+  800f0a:	5f                   	pop    %edi
+  800f0b:	5d                   	pop    %ebp
+  800f0c:	c3                   	ret
+
+00800f0d <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800f0d:	55                   	push   %ebp
+  800f0e:	89 e5                	mov    %esp,%ebp
+  800f10:	57                   	push   %edi
+  800f11:	56                   	push   %esi
+  800f12:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f19:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f1e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f26:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f29:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800f2b:	5b                   	pop    %ebx
+  800f2c:	5e                   	pop    %esi
+  800f2d:	5f                   	pop    %edi
+  800f2e:	5d                   	pop    %ebp
+  800f2f:	c3                   	ret
+
+00800f30 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800f30:	55                   	push   %ebp
+  800f31:	89 e5                	mov    %esp,%ebp
+  800f33:	57                   	push   %edi
+  800f34:	56                   	push   %esi
+  800f35:	53                   	push   %ebx
+  800f36:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800f39:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800f3c:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800f42:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800f45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f53:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f56:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f58:	85 c0                	test   %eax,%eax
+  800f5a:	7f 08                	jg     800f64 <sys_page_map_range+0x34>
+}
+  800f5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5f:	5b                   	pop    %ebx
+  800f60:	5e                   	pop    %esi
+  800f61:	5f                   	pop    %edi
+  800f62:	5d                   	pop    %ebp
+  800f63:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f64:	83 ec 0c             	sub    $0xc,%esp
+  800f67:	50                   	push   %eax
+  800f68:	6a 10                	push   $0x10
+  800f6a:	68 2b 52 80 00       	push   $0x80522b
+  800f6f:	6a 23                	push   $0x23
+  800f71:	68 48 52 80 00       	push   $0x805248
+  800f76:	e8 b2 f2 ff ff       	call   80022d <_panic>
+
+00800f7b <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f7b:	55                   	push   %ebp
+  800f7c:	89 e5                	mov    %esp,%ebp
+  800f7e:	57                   	push   %edi
+  800f7f:	56                   	push   %esi
+  800f80:	53                   	push   %ebx
+  800f81:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f84:	be 00 00 00 00       	mov    $0x0,%esi
+  800f89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8f:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f97:	89 f7                	mov    %esi,%edi
+  800f99:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f9b:	85 c0                	test   %eax,%eax
+  800f9d:	7f 08                	jg     800fa7 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa2:	5b                   	pop    %ebx
+  800fa3:	5e                   	pop    %esi
+  800fa4:	5f                   	pop    %edi
+  800fa5:	5d                   	pop    %ebp
+  800fa6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa7:	83 ec 0c             	sub    $0xc,%esp
+  800faa:	50                   	push   %eax
+  800fab:	6a 11                	push   $0x11
+  800fad:	68 2b 52 80 00       	push   $0x80522b
+  800fb2:	6a 23                	push   $0x23
+  800fb4:	68 48 52 80 00       	push   $0x805248
+  800fb9:	e8 6f f2 ff ff       	call   80022d <_panic>
+
+00800fbe <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800fbe:	55                   	push   %ebp
+  800fbf:	89 e5                	mov    %esp,%ebp
+  800fc1:	57                   	push   %edi
+  800fc2:	56                   	push   %esi
+  800fc3:	53                   	push   %ebx
+  800fc4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fc7:	be 00 00 00 00       	mov    $0x0,%esi
+  800fcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800fd7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fda:	89 f7                	mov    %esi,%edi
+  800fdc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fde:	85 c0                	test   %eax,%eax
+  800fe0:	7f 08                	jg     800fea <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800fe2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe5:	5b                   	pop    %ebx
+  800fe6:	5e                   	pop    %esi
+  800fe7:	5f                   	pop    %edi
+  800fe8:	5d                   	pop    %ebp
+  800fe9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fea:	83 ec 0c             	sub    $0xc,%esp
+  800fed:	50                   	push   %eax
+  800fee:	6a 1b                	push   $0x1b
+  800ff0:	68 2b 52 80 00       	push   $0x80522b
+  800ff5:	6a 23                	push   $0x23
+  800ff7:	68 48 52 80 00       	push   $0x805248
+  800ffc:	e8 2c f2 ff ff       	call   80022d <_panic>
+
+00801001 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  801001:	55                   	push   %ebp
+  801002:	89 e5                	mov    %esp,%ebp
+  801004:	57                   	push   %edi
+  801005:	56                   	push   %esi
+  801006:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801007:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801011:	89 d1                	mov    %edx,%ecx
+  801013:	89 d3                	mov    %edx,%ebx
+  801015:	89 d7                	mov    %edx,%edi
+  801017:	89 d6                	mov    %edx,%esi
+  801019:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80101b:	5b                   	pop    %ebx
+  80101c:	5e                   	pop    %esi
+  80101d:	5f                   	pop    %edi
+  80101e:	5d                   	pop    %ebp
+  80101f:	c3                   	ret
+
+00801020 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801020:	55                   	push   %ebp
+  801021:	89 e5                	mov    %esp,%ebp
+  801023:	57                   	push   %edi
+  801024:	56                   	push   %esi
+  801025:	53                   	push   %ebx
+  801026:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801029:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801031:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801034:	b8 08 00 00 00       	mov    $0x8,%eax
+  801039:	89 df                	mov    %ebx,%edi
+  80103b:	89 de                	mov    %ebx,%esi
+  80103d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80103f:	85 c0                	test   %eax,%eax
+  801041:	7f 08                	jg     80104b <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801043:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801046:	5b                   	pop    %ebx
+  801047:	5e                   	pop    %esi
+  801048:	5f                   	pop    %edi
+  801049:	5d                   	pop    %ebp
+  80104a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80104b:	83 ec 0c             	sub    $0xc,%esp
+  80104e:	50                   	push   %eax
+  80104f:	6a 08                	push   $0x8
+  801051:	68 2b 52 80 00       	push   $0x80522b
+  801056:	6a 23                	push   $0x23
+  801058:	68 48 52 80 00       	push   $0x805248
+  80105d:	e8 cb f1 ff ff       	call   80022d <_panic>
+
+00801062 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801062:	55                   	push   %ebp
+  801063:	89 e5                	mov    %esp,%ebp
+  801065:	57                   	push   %edi
+  801066:	56                   	push   %esi
+  801067:	53                   	push   %ebx
+  801068:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  80106b:	6a 44                	push   $0x44
+  80106d:	ff 75 0c             	push   0xc(%ebp)
+  801070:	e8 7a fc ff ff       	call   800cef <touch_mem>
+	asm volatile("int %1\n"
+  801075:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801082:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801085:	89 df                	mov    %ebx,%edi
+  801087:	89 de                	mov    %ebx,%esi
+  801089:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80108b:	83 c4 08             	add    $0x8,%esp
+  80108e:	85 c0                	test   %eax,%eax
+  801090:	7f 08                	jg     80109a <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801092:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801095:	5b                   	pop    %ebx
+  801096:	5e                   	pop    %esi
+  801097:	5f                   	pop    %edi
+  801098:	5d                   	pop    %ebp
+  801099:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109a:	83 ec 0c             	sub    $0xc,%esp
+  80109d:	50                   	push   %eax
+  80109e:	6a 09                	push   $0x9
+  8010a0:	68 2b 52 80 00       	push   $0x80522b
+  8010a5:	6a 23                	push   $0x23
+  8010a7:	68 48 52 80 00       	push   $0x805248
+  8010ac:	e8 7c f1 ff ff       	call   80022d <_panic>
+
+008010b1 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  8010b1:	55                   	push   %ebp
+  8010b2:	89 e5                	mov    %esp,%ebp
+  8010b4:	57                   	push   %edi
+  8010b5:	56                   	push   %esi
+  8010b6:	53                   	push   %ebx
+  8010b7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8010bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8010ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010cd:	89 f7                	mov    %esi,%edi
+  8010cf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010d1:	85 c0                	test   %eax,%eax
+  8010d3:	7f 08                	jg     8010dd <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  8010d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d8:	5b                   	pop    %ebx
+  8010d9:	5e                   	pop    %esi
+  8010da:	5f                   	pop    %edi
+  8010db:	5d                   	pop    %ebp
+  8010dc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010dd:	83 ec 0c             	sub    $0xc,%esp
+  8010e0:	50                   	push   %eax
+  8010e1:	6a 1a                	push   $0x1a
+  8010e3:	68 2b 52 80 00       	push   $0x80522b
+  8010e8:	6a 23                	push   $0x23
+  8010ea:	68 48 52 80 00       	push   $0x805248
+  8010ef:	e8 39 f1 ff ff       	call   80022d <_panic>
+
+008010f4 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8010f4:	55                   	push   %ebp
+  8010f5:	89 e5                	mov    %esp,%ebp
+  8010f7:	57                   	push   %edi
+  8010f8:	56                   	push   %esi
+  8010f9:	53                   	push   %ebx
+  8010fa:	83 ec 0c             	sub    $0xc,%esp
+  8010fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801100:	89 d8                	mov    %ebx,%eax
+  801102:	c1 e0 05             	shl    $0x5,%eax
+  801105:	50                   	push   %eax
+  801106:	ff 75 0c             	push   0xc(%ebp)
+  801109:	e8 e1 fb ff ff       	call   800cef <touch_mem>
+	asm volatile("int %1\n"
+  80110e:	be 00 00 00 00       	mov    $0x0,%esi
+  801113:	8b 55 08             	mov    0x8(%ebp),%edx
+  801116:	b8 13 00 00 00       	mov    $0x13,%eax
+  80111b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111e:	89 f7                	mov    %esi,%edi
+  801120:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801122:	83 c4 08             	add    $0x8,%esp
+  801125:	85 c0                	test   %eax,%eax
+  801127:	7f 08                	jg     801131 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  801129:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112c:	5b                   	pop    %ebx
+  80112d:	5e                   	pop    %esi
+  80112e:	5f                   	pop    %edi
+  80112f:	5d                   	pop    %ebp
+  801130:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801131:	83 ec 0c             	sub    $0xc,%esp
+  801134:	50                   	push   %eax
+  801135:	6a 13                	push   $0x13
+  801137:	68 2b 52 80 00       	push   $0x80522b
+  80113c:	6a 23                	push   $0x23
+  80113e:	68 48 52 80 00       	push   $0x805248
+  801143:	e8 e5 f0 ff ff       	call   80022d <_panic>
+
+00801148 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	57                   	push   %edi
+  80114c:	56                   	push   %esi
+  80114d:	53                   	push   %ebx
+  80114e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801151:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801156:	8b 55 08             	mov    0x8(%ebp),%edx
+  801159:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801161:	89 df                	mov    %ebx,%edi
+  801163:	89 de                	mov    %ebx,%esi
+  801165:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801167:	85 c0                	test   %eax,%eax
+  801169:	7f 08                	jg     801173 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80116b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80116e:	5b                   	pop    %ebx
+  80116f:	5e                   	pop    %esi
+  801170:	5f                   	pop    %edi
+  801171:	5d                   	pop    %ebp
+  801172:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801173:	83 ec 0c             	sub    $0xc,%esp
+  801176:	50                   	push   %eax
+  801177:	6a 0a                	push   $0xa
+  801179:	68 2b 52 80 00       	push   $0x80522b
+  80117e:	6a 23                	push   $0x23
+  801180:	68 48 52 80 00       	push   $0x805248
+  801185:	e8 a3 f0 ff ff       	call   80022d <_panic>
+
+0080118a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80118a:	55                   	push   %ebp
+  80118b:	89 e5                	mov    %esp,%ebp
+  80118d:	57                   	push   %edi
+  80118e:	56                   	push   %esi
+  80118f:	53                   	push   %ebx
+  801190:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801193:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801199:	76 1d                	jbe    8011b8 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80119b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011a6:	be 01 00 00 00       	mov    $0x1,%esi
+  8011ab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011ae:	cd 30                	int    $0x30
+}
+  8011b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b3:	5b                   	pop    %ebx
+  8011b4:	5e                   	pop    %esi
+  8011b5:	5f                   	pop    %edi
+  8011b6:	5d                   	pop    %ebp
+  8011b7:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011b8:	68 00 10 00 00       	push   $0x1000
+  8011bd:	53                   	push   %ebx
+  8011be:	e8 2c fb ff ff       	call   800cef <touch_mem>
+  8011c3:	83 c4 08             	add    $0x8,%esp
+  8011c6:	eb d3                	jmp    80119b <sys_ipc_send+0x11>
+
+008011c8 <sys_ipc_send_pages>:
+{
+  8011c8:	55                   	push   %ebp
+  8011c9:	89 e5                	mov    %esp,%ebp
+  8011cb:	57                   	push   %edi
+  8011cc:	56                   	push   %esi
+  8011cd:	53                   	push   %ebx
+  8011ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d1:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8011d4:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011da:	76 18                	jbe    8011f4 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8011dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011e7:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8011ea:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8011ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ef:	5b                   	pop    %ebx
+  8011f0:	5e                   	pop    %esi
+  8011f1:	5f                   	pop    %edi
+  8011f2:	5d                   	pop    %ebp
+  8011f3:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011f4:	89 f0                	mov    %esi,%eax
+  8011f6:	c1 e0 0c             	shl    $0xc,%eax
+  8011f9:	50                   	push   %eax
+  8011fa:	53                   	push   %ebx
+  8011fb:	e8 ef fa ff ff       	call   800cef <touch_mem>
+  801200:	83 c4 08             	add    $0x8,%esp
+  801203:	eb d7                	jmp    8011dc <sys_ipc_send_pages+0x14>
+
+00801205 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801205:	55                   	push   %ebp
+  801206:	89 e5                	mov    %esp,%ebp
+  801208:	57                   	push   %edi
+  801209:	56                   	push   %esi
+  80120a:	53                   	push   %ebx
+  80120b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80120e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801213:	8b 55 08             	mov    0x8(%ebp),%edx
+  801216:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801219:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80121e:	89 df                	mov    %ebx,%edi
+  801220:	89 de                	mov    %ebx,%esi
+  801222:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801224:	85 c0                	test   %eax,%eax
+  801226:	7f 08                	jg     801230 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801228:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80122b:	5b                   	pop    %ebx
+  80122c:	5e                   	pop    %esi
+  80122d:	5f                   	pop    %edi
+  80122e:	5d                   	pop    %ebp
+  80122f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801230:	83 ec 0c             	sub    $0xc,%esp
+  801233:	50                   	push   %eax
+  801234:	6a 0d                	push   $0xd
+  801236:	68 2b 52 80 00       	push   $0x80522b
+  80123b:	6a 23                	push   $0x23
+  80123d:	68 48 52 80 00       	push   $0x805248
+  801242:	e8 e6 ef ff ff       	call   80022d <_panic>
+
+00801247 <sys_ipc_recv>:
+{
+  801247:	55                   	push   %ebp
+  801248:	89 e5                	mov    %esp,%ebp
+  80124a:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80124d:	6a 01                	push   $0x1
+  80124f:	ff 75 08             	push   0x8(%ebp)
+  801252:	e8 ae ff ff ff       	call   801205 <sys_ipc_recv_pages>
+}
+  801257:	c9                   	leave
+  801258:	c3                   	ret
+
+00801259 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801259:	55                   	push   %ebp
+  80125a:	89 e5                	mov    %esp,%ebp
+  80125c:	57                   	push   %edi
+  80125d:	56                   	push   %esi
+  80125e:	53                   	push   %ebx
+  80125f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801262:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801265:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801268:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80126e:	77 04                	ja     801274 <sys_ipc_call+0x1b>
+  801270:	85 f6                	test   %esi,%esi
+  801272:	75 15                	jne    801289 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801274:	8b 55 08             	mov    0x8(%ebp),%edx
+  801277:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80127f:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801281:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801284:	5b                   	pop    %ebx
+  801285:	5e                   	pop    %esi
+  801286:	5f                   	pop    %edi
+  801287:	5d                   	pop    %ebp
+  801288:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  801289:	89 f8                	mov    %edi,%eax
+  80128b:	c1 e0 0c             	shl    $0xc,%eax
+  80128e:	50                   	push   %eax
+  80128f:	53                   	push   %ebx
+  801290:	e8 5a fa ff ff       	call   800cef <touch_mem>
+  801295:	83 c4 08             	add    $0x8,%esp
+  801298:	eb da                	jmp    801274 <sys_ipc_call+0x1b>
+
+0080129a <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80129a:	55                   	push   %ebp
+  80129b:	89 e5                	mov    %esp,%ebp
+  80129d:	57                   	push   %edi
+  80129e:	56                   	push   %esi
+  80129f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a6:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012ae:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012b1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012b4:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8012b6:	5b                   	pop    %ebx
+  8012b7:	5e                   	pop    %esi
+  8012b8:	5f                   	pop    %edi
+  8012b9:	5d                   	pop    %ebp
+  8012ba:	c3                   	ret
+
+008012bb <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8012bb:	55                   	push   %ebp
+  8012bc:	89 e5                	mov    %esp,%ebp
+  8012be:	57                   	push   %edi
+  8012bf:	56                   	push   %esi
+  8012c0:	53                   	push   %ebx
+  8012c1:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8012c4:	6a 04                	push   $0x4
+  8012c6:	ff 75 08             	push   0x8(%ebp)
+  8012c9:	e8 21 fa ff ff       	call   800cef <touch_mem>
+	asm volatile("int %1\n"
+  8012ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d6:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012e1:	89 f7                	mov    %esi,%edi
+  8012e3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012e5:	83 c4 08             	add    $0x8,%esp
+  8012e8:	85 c0                	test   %eax,%eax
+  8012ea:	7f 08                	jg     8012f4 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8012ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ef:	5b                   	pop    %ebx
+  8012f0:	5e                   	pop    %esi
+  8012f1:	5f                   	pop    %edi
+  8012f2:	5d                   	pop    %ebp
+  8012f3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012f4:	83 ec 0c             	sub    $0xc,%esp
+  8012f7:	50                   	push   %eax
+  8012f8:	6a 16                	push   $0x16
+  8012fa:	68 2b 52 80 00       	push   $0x80522b
+  8012ff:	6a 23                	push   $0x23
+  801301:	68 48 52 80 00       	push   $0x805248
+  801306:	e8 22 ef ff ff       	call   80022d <_panic>
+
+0080130b <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80130b:	55                   	push   %ebp
+  80130c:	89 e5                	mov    %esp,%ebp
+  80130e:	57                   	push   %edi
+  80130f:	56                   	push   %esi
+  801310:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801311:	6a 04                	push   $0x4
+  801313:	ff 75 08             	push   0x8(%ebp)
+  801316:	e8 d4 f9 ff ff       	call   800cef <touch_mem>
+	asm volatile("int %1\n"
+  80131b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801320:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801323:	b8 17 00 00 00       	mov    $0x17,%eax
+  801328:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132b:	89 df                	mov    %ebx,%edi
+  80132d:	89 de                	mov    %ebx,%esi
+  80132f:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801331:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801334:	5b                   	pop    %ebx
+  801335:	5e                   	pop    %esi
+  801336:	5f                   	pop    %edi
+  801337:	5d                   	pop    %ebp
+  801338:	c3                   	ret
+
+00801339 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  801339:	55                   	push   %ebp
+  80133a:	89 e5                	mov    %esp,%ebp
+  80133c:	57                   	push   %edi
+  80133d:	56                   	push   %esi
+  80133e:	53                   	push   %ebx
+  80133f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801342:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801347:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80134f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801354:	89 df                	mov    %ebx,%edi
+  801356:	89 de                	mov    %ebx,%esi
+  801358:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80135a:	85 c0                	test   %eax,%eax
+  80135c:	7f 08                	jg     801366 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80135e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801361:	5b                   	pop    %ebx
+  801362:	5e                   	pop    %esi
+  801363:	5f                   	pop    %edi
+  801364:	5d                   	pop    %ebp
+  801365:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801366:	83 ec 0c             	sub    $0xc,%esp
+  801369:	50                   	push   %eax
+  80136a:	6a 0e                	push   $0xe
+  80136c:	68 2b 52 80 00       	push   $0x80522b
+  801371:	6a 23                	push   $0x23
+  801373:	68 48 52 80 00       	push   $0x805248
+  801378:	e8 b0 ee ff ff       	call   80022d <_panic>
+
+0080137d <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80137d:	55                   	push   %ebp
+  80137e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801380:	8b 45 08             	mov    0x8(%ebp),%eax
+  801383:	05 00 00 00 30       	add    $0x30000000,%eax
+  801388:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80138b:	5d                   	pop    %ebp
+  80138c:	c3                   	ret
+
+0080138d <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80138d:	55                   	push   %ebp
+  80138e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801390:	8b 45 08             	mov    0x8(%ebp),%eax
+  801393:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801398:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80139d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013a2:	5d                   	pop    %ebp
+  8013a3:	c3                   	ret
+
+008013a4 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013a4:	55                   	push   %ebp
+  8013a5:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8013a7:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8013ac:	a8 01                	test   $0x1,%al
+  8013ae:	74 3c                	je     8013ec <fd_alloc+0x48>
+  8013b0:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013b5:	89 c2                	mov    %eax,%edx
+  8013b7:	c1 ea 0c             	shr    $0xc,%edx
+  8013ba:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013c1:	89 c1                	mov    %eax,%ecx
+  8013c3:	05 00 10 00 00       	add    $0x1000,%eax
+  8013c8:	f6 c2 01             	test   $0x1,%dl
+  8013cb:	74 13                	je     8013e0 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8013cd:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8013d2:	75 e1                	jne    8013b5 <fd_alloc+0x11>
+  8013d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8013d9:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8013de:	eb 05                	jmp    8013e5 <fd_alloc+0x41>
+			return 0;
+  8013e0:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8013e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e8:	89 0a                	mov    %ecx,(%edx)
+}
+  8013ea:	5d                   	pop    %ebp
+  8013eb:	c3                   	ret
+  8013ec:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8013f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f6:	eb ed                	jmp    8013e5 <fd_alloc+0x41>
+
+008013f8 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013f8:	55                   	push   %ebp
+  8013f9:	89 e5                	mov    %esp,%ebp
+  8013fb:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8013fe:	83 f8 1f             	cmp    $0x1f,%eax
+  801401:	77 30                	ja     801433 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801403:	c1 e0 0c             	shl    $0xc,%eax
+  801406:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80140b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801411:	f6 c2 01             	test   $0x1,%dl
+  801414:	74 24                	je     80143a <fd_lookup+0x42>
+  801416:	89 c2                	mov    %eax,%edx
+  801418:	c1 ea 0c             	shr    $0xc,%edx
+  80141b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801422:	f6 c2 01             	test   $0x1,%dl
+  801425:	74 1a                	je     801441 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801427:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80142a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80142c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801431:	5d                   	pop    %ebp
+  801432:	c3                   	ret
+		return -E_INVAL;
+  801433:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801438:	eb f7                	jmp    801431 <fd_lookup+0x39>
+		return -E_INVAL;
+  80143a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80143f:	eb f0                	jmp    801431 <fd_lookup+0x39>
+  801441:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801446:	eb e9                	jmp    801431 <fd_lookup+0x39>
+
+00801448 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801448:	55                   	push   %ebp
+  801449:	89 e5                	mov    %esp,%ebp
+  80144b:	53                   	push   %ebx
+  80144c:	83 ec 04             	sub    $0x4,%esp
+  80144f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801452:	b8 d4 52 80 00       	mov    $0x8052d4,%eax
+  801457:	8b 18                	mov    (%eax),%ebx
+  801459:	85 db                	test   %ebx,%ebx
+  80145b:	74 0e                	je     80146b <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  80145d:	83 c0 04             	add    $0x4,%eax
+  801460:	39 13                	cmp    %edx,(%ebx)
+  801462:	75 f3                	jne    801457 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801464:	b8 00 00 00 00       	mov    $0x0,%eax
+  801469:	eb 1f                	jmp    80148a <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80146b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801470:	8b 40 48             	mov    0x48(%eax),%eax
+  801473:	83 ec 04             	sub    $0x4,%esp
+  801476:	52                   	push   %edx
+  801477:	50                   	push   %eax
+  801478:	68 58 52 80 00       	push   $0x805258
+  80147d:	e8 86 ee ff ff       	call   800308 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801482:	83 c4 10             	add    $0x10,%esp
+  801485:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80148a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80148d:	89 1a                	mov    %ebx,(%edx)
+}
+  80148f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801492:	c9                   	leave
+  801493:	c3                   	ret
+
+00801494 <fd_close>:
+{
+  801494:	55                   	push   %ebp
+  801495:	89 e5                	mov    %esp,%ebp
+  801497:	57                   	push   %edi
+  801498:	56                   	push   %esi
+  801499:	53                   	push   %ebx
+  80149a:	83 ec 24             	sub    $0x24,%esp
+  80149d:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014a0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014a3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014a6:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014a7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014ad:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014b0:	50                   	push   %eax
+  8014b1:	e8 42 ff ff ff       	call   8013f8 <fd_lookup>
+  8014b6:	89 c3                	mov    %eax,%ebx
+  8014b8:	83 c4 10             	add    $0x10,%esp
+  8014bb:	85 c0                	test   %eax,%eax
+  8014bd:	78 05                	js     8014c4 <fd_close+0x30>
+	    || fd != fd2)
+  8014bf:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8014c2:	74 16                	je     8014da <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8014c4:	89 f8                	mov    %edi,%eax
+  8014c6:	84 c0                	test   %al,%al
+  8014c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014cd:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014d0:	89 d8                	mov    %ebx,%eax
+  8014d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d5:	5b                   	pop    %ebx
+  8014d6:	5e                   	pop    %esi
+  8014d7:	5f                   	pop    %edi
+  8014d8:	5d                   	pop    %ebp
+  8014d9:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014da:	83 ec 08             	sub    $0x8,%esp
+  8014dd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014e0:	50                   	push   %eax
+  8014e1:	ff 36                	push   (%esi)
+  8014e3:	e8 60 ff ff ff       	call   801448 <dev_lookup>
+  8014e8:	89 c3                	mov    %eax,%ebx
+  8014ea:	83 c4 10             	add    $0x10,%esp
+  8014ed:	85 c0                	test   %eax,%eax
+  8014ef:	78 1a                	js     80150b <fd_close+0x77>
+		if (dev->dev_close)
+  8014f1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014f4:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8014f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8014fc:	85 c0                	test   %eax,%eax
+  8014fe:	74 0b                	je     80150b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801500:	83 ec 0c             	sub    $0xc,%esp
+  801503:	56                   	push   %esi
+  801504:	ff d0                	call   *%eax
+  801506:	89 c3                	mov    %eax,%ebx
+  801508:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80150b:	83 ec 08             	sub    $0x8,%esp
+  80150e:	56                   	push   %esi
+  80150f:	6a 00                	push   $0x0
+  801511:	e8 51 f9 ff ff       	call   800e67 <sys_page_unmap>
+	return r;
+  801516:	83 c4 10             	add    $0x10,%esp
+  801519:	eb b5                	jmp    8014d0 <fd_close+0x3c>
+
+0080151b <close>:
+
+int
+close(int fdnum)
+{
+  80151b:	55                   	push   %ebp
+  80151c:	89 e5                	mov    %esp,%ebp
+  80151e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801521:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801524:	50                   	push   %eax
+  801525:	ff 75 08             	push   0x8(%ebp)
+  801528:	e8 cb fe ff ff       	call   8013f8 <fd_lookup>
+  80152d:	83 c4 10             	add    $0x10,%esp
+  801530:	85 c0                	test   %eax,%eax
+  801532:	79 02                	jns    801536 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801534:	c9                   	leave
+  801535:	c3                   	ret
+		return fd_close(fd, 1);
+  801536:	83 ec 08             	sub    $0x8,%esp
+  801539:	6a 01                	push   $0x1
+  80153b:	ff 75 f4             	push   -0xc(%ebp)
+  80153e:	e8 51 ff ff ff       	call   801494 <fd_close>
+  801543:	83 c4 10             	add    $0x10,%esp
+  801546:	eb ec                	jmp    801534 <close+0x19>
+
+00801548 <close_all>:
+
+void
+close_all(void)
+{
+  801548:	55                   	push   %ebp
+  801549:	89 e5                	mov    %esp,%ebp
+  80154b:	53                   	push   %ebx
+  80154c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80154f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801554:	83 ec 0c             	sub    $0xc,%esp
+  801557:	53                   	push   %ebx
+  801558:	e8 be ff ff ff       	call   80151b <close>
+	for (i = 0; i < MAXFD; i++)
+  80155d:	83 c3 01             	add    $0x1,%ebx
+  801560:	83 c4 10             	add    $0x10,%esp
+  801563:	83 fb 20             	cmp    $0x20,%ebx
+  801566:	75 ec                	jne    801554 <close_all+0xc>
+}
+  801568:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80156b:	c9                   	leave
+  80156c:	c3                   	ret
+
+0080156d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80156d:	55                   	push   %ebp
+  80156e:	89 e5                	mov    %esp,%ebp
+  801570:	57                   	push   %edi
+  801571:	56                   	push   %esi
+  801572:	53                   	push   %ebx
+  801573:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801576:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801579:	50                   	push   %eax
+  80157a:	ff 75 08             	push   0x8(%ebp)
+  80157d:	e8 76 fe ff ff       	call   8013f8 <fd_lookup>
+  801582:	89 c3                	mov    %eax,%ebx
+  801584:	83 c4 10             	add    $0x10,%esp
+  801587:	85 c0                	test   %eax,%eax
+  801589:	78 7f                	js     80160a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80158b:	83 ec 0c             	sub    $0xc,%esp
+  80158e:	ff 75 0c             	push   0xc(%ebp)
+  801591:	e8 85 ff ff ff       	call   80151b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801596:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801599:	c1 e6 0c             	shl    $0xc,%esi
+  80159c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8015a2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015a5:	89 3c 24             	mov    %edi,(%esp)
+  8015a8:	e8 e0 fd ff ff       	call   80138d <fd2data>
+  8015ad:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8015af:	89 34 24             	mov    %esi,(%esp)
+  8015b2:	e8 d6 fd ff ff       	call   80138d <fd2data>
+  8015b7:	83 c4 10             	add    $0x10,%esp
+  8015ba:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8015bd:	89 d8                	mov    %ebx,%eax
+  8015bf:	c1 e8 16             	shr    $0x16,%eax
+  8015c2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015c9:	a8 01                	test   $0x1,%al
+  8015cb:	74 11                	je     8015de <dup+0x71>
+  8015cd:	89 d8                	mov    %ebx,%eax
+  8015cf:	c1 e8 0c             	shr    $0xc,%eax
+  8015d2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015d9:	f6 c2 01             	test   $0x1,%dl
+  8015dc:	75 36                	jne    801614 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015de:	89 f8                	mov    %edi,%eax
+  8015e0:	c1 e8 0c             	shr    $0xc,%eax
+  8015e3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015ea:	83 ec 0c             	sub    $0xc,%esp
+  8015ed:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015f2:	50                   	push   %eax
+  8015f3:	56                   	push   %esi
+  8015f4:	6a 00                	push   $0x0
+  8015f6:	57                   	push   %edi
+  8015f7:	6a 00                	push   $0x0
+  8015f9:	e8 27 f8 ff ff       	call   800e25 <sys_page_map>
+  8015fe:	89 c3                	mov    %eax,%ebx
+  801600:	83 c4 20             	add    $0x20,%esp
+  801603:	85 c0                	test   %eax,%eax
+  801605:	78 33                	js     80163a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801607:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80160a:	89 d8                	mov    %ebx,%eax
+  80160c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160f:	5b                   	pop    %ebx
+  801610:	5e                   	pop    %esi
+  801611:	5f                   	pop    %edi
+  801612:	5d                   	pop    %ebp
+  801613:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801614:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80161b:	83 ec 0c             	sub    $0xc,%esp
+  80161e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801623:	50                   	push   %eax
+  801624:	ff 75 d4             	push   -0x2c(%ebp)
+  801627:	6a 00                	push   $0x0
+  801629:	53                   	push   %ebx
+  80162a:	6a 00                	push   $0x0
+  80162c:	e8 f4 f7 ff ff       	call   800e25 <sys_page_map>
+  801631:	89 c3                	mov    %eax,%ebx
+  801633:	83 c4 20             	add    $0x20,%esp
+  801636:	85 c0                	test   %eax,%eax
+  801638:	79 a4                	jns    8015de <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80163a:	83 ec 08             	sub    $0x8,%esp
+  80163d:	56                   	push   %esi
+  80163e:	6a 00                	push   $0x0
+  801640:	e8 22 f8 ff ff       	call   800e67 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801645:	83 c4 08             	add    $0x8,%esp
+  801648:	ff 75 d4             	push   -0x2c(%ebp)
+  80164b:	6a 00                	push   $0x0
+  80164d:	e8 15 f8 ff ff       	call   800e67 <sys_page_unmap>
+	return r;
+  801652:	83 c4 10             	add    $0x10,%esp
+  801655:	eb b3                	jmp    80160a <dup+0x9d>
+
+00801657 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801657:	55                   	push   %ebp
+  801658:	89 e5                	mov    %esp,%ebp
+  80165a:	56                   	push   %esi
+  80165b:	53                   	push   %ebx
+  80165c:	83 ec 18             	sub    $0x18,%esp
+  80165f:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801662:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801665:	50                   	push   %eax
+  801666:	56                   	push   %esi
+  801667:	e8 8c fd ff ff       	call   8013f8 <fd_lookup>
+  80166c:	83 c4 10             	add    $0x10,%esp
+  80166f:	85 c0                	test   %eax,%eax
+  801671:	78 3c                	js     8016af <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801673:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801676:	83 ec 08             	sub    $0x8,%esp
+  801679:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80167c:	50                   	push   %eax
+  80167d:	ff 33                	push   (%ebx)
+  80167f:	e8 c4 fd ff ff       	call   801448 <dev_lookup>
+  801684:	83 c4 10             	add    $0x10,%esp
+  801687:	85 c0                	test   %eax,%eax
+  801689:	78 24                	js     8016af <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80168b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80168e:	83 e0 03             	and    $0x3,%eax
+  801691:	83 f8 01             	cmp    $0x1,%eax
+  801694:	74 20                	je     8016b6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801696:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801699:	8b 40 08             	mov    0x8(%eax),%eax
+  80169c:	85 c0                	test   %eax,%eax
+  80169e:	74 37                	je     8016d7 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8016a0:	83 ec 04             	sub    $0x4,%esp
+  8016a3:	ff 75 10             	push   0x10(%ebp)
+  8016a6:	ff 75 0c             	push   0xc(%ebp)
+  8016a9:	53                   	push   %ebx
+  8016aa:	ff d0                	call   *%eax
+  8016ac:	83 c4 10             	add    $0x10,%esp
+}
+  8016af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016b2:	5b                   	pop    %ebx
+  8016b3:	5e                   	pop    %esi
+  8016b4:	5d                   	pop    %ebp
+  8016b5:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016b6:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8016bb:	8b 40 48             	mov    0x48(%eax),%eax
+  8016be:	83 ec 04             	sub    $0x4,%esp
+  8016c1:	56                   	push   %esi
+  8016c2:	50                   	push   %eax
+  8016c3:	68 99 52 80 00       	push   $0x805299
+  8016c8:	e8 3b ec ff ff       	call   800308 <cprintf>
+		return -E_INVAL;
+  8016cd:	83 c4 10             	add    $0x10,%esp
+  8016d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016d5:	eb d8                	jmp    8016af <read+0x58>
+		return -E_NOT_SUPP;
+  8016d7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016dc:	eb d1                	jmp    8016af <read+0x58>
+
+008016de <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016de:	55                   	push   %ebp
+  8016df:	89 e5                	mov    %esp,%ebp
+  8016e1:	57                   	push   %edi
+  8016e2:	56                   	push   %esi
+  8016e3:	53                   	push   %ebx
+  8016e4:	83 ec 0c             	sub    $0xc,%esp
+  8016e7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016ea:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f2:	eb 02                	jmp    8016f6 <readn+0x18>
+  8016f4:	01 c3                	add    %eax,%ebx
+  8016f6:	39 f3                	cmp    %esi,%ebx
+  8016f8:	73 21                	jae    80171b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016fa:	83 ec 04             	sub    $0x4,%esp
+  8016fd:	89 f0                	mov    %esi,%eax
+  8016ff:	29 d8                	sub    %ebx,%eax
+  801701:	50                   	push   %eax
+  801702:	89 d8                	mov    %ebx,%eax
+  801704:	03 45 0c             	add    0xc(%ebp),%eax
+  801707:	50                   	push   %eax
+  801708:	57                   	push   %edi
+  801709:	e8 49 ff ff ff       	call   801657 <read>
+		if (m < 0)
+  80170e:	83 c4 10             	add    $0x10,%esp
+  801711:	85 c0                	test   %eax,%eax
+  801713:	78 04                	js     801719 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801715:	75 dd                	jne    8016f4 <readn+0x16>
+  801717:	eb 02                	jmp    80171b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801719:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80171b:	89 d8                	mov    %ebx,%eax
+  80171d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801720:	5b                   	pop    %ebx
+  801721:	5e                   	pop    %esi
+  801722:	5f                   	pop    %edi
+  801723:	5d                   	pop    %ebp
+  801724:	c3                   	ret
+
+00801725 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801725:	55                   	push   %ebp
+  801726:	89 e5                	mov    %esp,%ebp
+  801728:	56                   	push   %esi
+  801729:	53                   	push   %ebx
+  80172a:	83 ec 18             	sub    $0x18,%esp
+  80172d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801730:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801733:	50                   	push   %eax
+  801734:	53                   	push   %ebx
+  801735:	e8 be fc ff ff       	call   8013f8 <fd_lookup>
+  80173a:	83 c4 10             	add    $0x10,%esp
+  80173d:	85 c0                	test   %eax,%eax
+  80173f:	78 37                	js     801778 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801741:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801744:	83 ec 08             	sub    $0x8,%esp
+  801747:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80174a:	50                   	push   %eax
+  80174b:	ff 36                	push   (%esi)
+  80174d:	e8 f6 fc ff ff       	call   801448 <dev_lookup>
+  801752:	83 c4 10             	add    $0x10,%esp
+  801755:	85 c0                	test   %eax,%eax
+  801757:	78 1f                	js     801778 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801759:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80175d:	74 20                	je     80177f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80175f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801762:	8b 40 0c             	mov    0xc(%eax),%eax
+  801765:	85 c0                	test   %eax,%eax
+  801767:	74 37                	je     8017a0 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801769:	83 ec 04             	sub    $0x4,%esp
+  80176c:	ff 75 10             	push   0x10(%ebp)
+  80176f:	ff 75 0c             	push   0xc(%ebp)
+  801772:	56                   	push   %esi
+  801773:	ff d0                	call   *%eax
+  801775:	83 c4 10             	add    $0x10,%esp
+}
+  801778:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80177b:	5b                   	pop    %ebx
+  80177c:	5e                   	pop    %esi
+  80177d:	5d                   	pop    %ebp
+  80177e:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80177f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801784:	8b 40 48             	mov    0x48(%eax),%eax
+  801787:	83 ec 04             	sub    $0x4,%esp
+  80178a:	53                   	push   %ebx
+  80178b:	50                   	push   %eax
+  80178c:	68 b5 52 80 00       	push   $0x8052b5
+  801791:	e8 72 eb ff ff       	call   800308 <cprintf>
+		return -E_INVAL;
+  801796:	83 c4 10             	add    $0x10,%esp
+  801799:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80179e:	eb d8                	jmp    801778 <write+0x53>
+		return -E_NOT_SUPP;
+  8017a0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017a5:	eb d1                	jmp    801778 <write+0x53>
+
+008017a7 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017a7:	55                   	push   %ebp
+  8017a8:	89 e5                	mov    %esp,%ebp
+  8017aa:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b0:	50                   	push   %eax
+  8017b1:	ff 75 08             	push   0x8(%ebp)
+  8017b4:	e8 3f fc ff ff       	call   8013f8 <fd_lookup>
+  8017b9:	83 c4 10             	add    $0x10,%esp
+  8017bc:	85 c0                	test   %eax,%eax
+  8017be:	78 0e                	js     8017ce <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8017c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017c6:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8017c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017ce:	c9                   	leave
+  8017cf:	c3                   	ret
+
+008017d0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017d0:	55                   	push   %ebp
+  8017d1:	89 e5                	mov    %esp,%ebp
+  8017d3:	56                   	push   %esi
+  8017d4:	53                   	push   %ebx
+  8017d5:	83 ec 18             	sub    $0x18,%esp
+  8017d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017db:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017de:	50                   	push   %eax
+  8017df:	53                   	push   %ebx
+  8017e0:	e8 13 fc ff ff       	call   8013f8 <fd_lookup>
+  8017e5:	83 c4 10             	add    $0x10,%esp
+  8017e8:	85 c0                	test   %eax,%eax
+  8017ea:	78 34                	js     801820 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017ec:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017ef:	83 ec 08             	sub    $0x8,%esp
+  8017f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017f5:	50                   	push   %eax
+  8017f6:	ff 36                	push   (%esi)
+  8017f8:	e8 4b fc ff ff       	call   801448 <dev_lookup>
+  8017fd:	83 c4 10             	add    $0x10,%esp
+  801800:	85 c0                	test   %eax,%eax
+  801802:	78 1c                	js     801820 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801804:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801808:	74 1d                	je     801827 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80180a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80180d:	8b 40 18             	mov    0x18(%eax),%eax
+  801810:	85 c0                	test   %eax,%eax
+  801812:	74 34                	je     801848 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801814:	83 ec 08             	sub    $0x8,%esp
+  801817:	ff 75 0c             	push   0xc(%ebp)
+  80181a:	56                   	push   %esi
+  80181b:	ff d0                	call   *%eax
+  80181d:	83 c4 10             	add    $0x10,%esp
+}
+  801820:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801823:	5b                   	pop    %ebx
+  801824:	5e                   	pop    %esi
+  801825:	5d                   	pop    %ebp
+  801826:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801827:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80182c:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80182f:	83 ec 04             	sub    $0x4,%esp
+  801832:	53                   	push   %ebx
+  801833:	50                   	push   %eax
+  801834:	68 78 52 80 00       	push   $0x805278
+  801839:	e8 ca ea ff ff       	call   800308 <cprintf>
+		return -E_INVAL;
+  80183e:	83 c4 10             	add    $0x10,%esp
+  801841:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801846:	eb d8                	jmp    801820 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801848:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80184d:	eb d1                	jmp    801820 <ftruncate+0x50>
+
+0080184f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80184f:	55                   	push   %ebp
+  801850:	89 e5                	mov    %esp,%ebp
+  801852:	56                   	push   %esi
+  801853:	53                   	push   %ebx
+  801854:	83 ec 18             	sub    $0x18,%esp
+  801857:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80185a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80185d:	50                   	push   %eax
+  80185e:	ff 75 08             	push   0x8(%ebp)
+  801861:	e8 92 fb ff ff       	call   8013f8 <fd_lookup>
+  801866:	83 c4 10             	add    $0x10,%esp
+  801869:	85 c0                	test   %eax,%eax
+  80186b:	78 49                	js     8018b6 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80186d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801870:	83 ec 08             	sub    $0x8,%esp
+  801873:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801876:	50                   	push   %eax
+  801877:	ff 36                	push   (%esi)
+  801879:	e8 ca fb ff ff       	call   801448 <dev_lookup>
+  80187e:	83 c4 10             	add    $0x10,%esp
+  801881:	85 c0                	test   %eax,%eax
+  801883:	78 31                	js     8018b6 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801885:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801888:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80188c:	74 2f                	je     8018bd <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80188e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801891:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801898:	00 00 00 
+	stat->st_isdir = 0;
+  80189b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018a2:	00 00 00 
+	stat->st_dev = dev;
+  8018a5:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8018ab:	83 ec 08             	sub    $0x8,%esp
+  8018ae:	53                   	push   %ebx
+  8018af:	56                   	push   %esi
+  8018b0:	ff 50 14             	call   *0x14(%eax)
+  8018b3:	83 c4 10             	add    $0x10,%esp
+}
+  8018b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b9:	5b                   	pop    %ebx
+  8018ba:	5e                   	pop    %esi
+  8018bb:	5d                   	pop    %ebp
+  8018bc:	c3                   	ret
+		return -E_NOT_SUPP;
+  8018bd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018c2:	eb f2                	jmp    8018b6 <fstat+0x67>
+
+008018c4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018c4:	55                   	push   %ebp
+  8018c5:	89 e5                	mov    %esp,%ebp
+  8018c7:	56                   	push   %esi
+  8018c8:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8018c9:	83 ec 08             	sub    $0x8,%esp
+  8018cc:	6a 00                	push   $0x0
+  8018ce:	ff 75 08             	push   0x8(%ebp)
+  8018d1:	e8 bc 02 00 00       	call   801b92 <open>
+  8018d6:	89 c3                	mov    %eax,%ebx
+  8018d8:	83 c4 10             	add    $0x10,%esp
+  8018db:	85 c0                	test   %eax,%eax
+  8018dd:	78 1b                	js     8018fa <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8018df:	83 ec 08             	sub    $0x8,%esp
+  8018e2:	ff 75 0c             	push   0xc(%ebp)
+  8018e5:	50                   	push   %eax
+  8018e6:	e8 64 ff ff ff       	call   80184f <fstat>
+  8018eb:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8018ed:	89 1c 24             	mov    %ebx,(%esp)
+  8018f0:	e8 26 fc ff ff       	call   80151b <close>
+	return r;
+  8018f5:	83 c4 10             	add    $0x10,%esp
+  8018f8:	89 f3                	mov    %esi,%ebx
+}
+  8018fa:	89 d8                	mov    %ebx,%eax
+  8018fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018ff:	5b                   	pop    %ebx
+  801900:	5e                   	pop    %esi
+  801901:	5d                   	pop    %ebp
+  801902:	c3                   	ret
+
+00801903 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801903:	55                   	push   %ebp
+  801904:	89 e5                	mov    %esp,%ebp
+  801906:	57                   	push   %edi
+  801907:	56                   	push   %esi
+  801908:	53                   	push   %ebx
+  801909:	83 ec 0c             	sub    $0xc,%esp
+  80190c:	89 c7                	mov    %eax,%edi
+  80190e:	89 d3                	mov    %edx,%ebx
+  801910:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801912:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801919:	74 2d                	je     801948 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80191b:	6a 07                	push   $0x7
+  80191d:	68 00 f0 80 00       	push   $0x80f000
+  801922:	57                   	push   %edi
+  801923:	ff 35 00 70 80 00    	push   0x807000
+  801929:	e8 4e 31 00 00       	call   804a7c <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  80192e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801935:	6a 00                	push   $0x0
+  801937:	56                   	push   %esi
+  801938:	53                   	push   %ebx
+  801939:	6a 00                	push   $0x0
+  80193b:	e8 ee 2f 00 00       	call   80492e <ipc_recv_pages>
+}
+  801940:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801943:	5b                   	pop    %ebx
+  801944:	5e                   	pop    %esi
+  801945:	5f                   	pop    %edi
+  801946:	5d                   	pop    %ebp
+  801947:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801948:	83 ec 0c             	sub    $0xc,%esp
+  80194b:	6a 01                	push   $0x1
+  80194d:	e8 1f 32 00 00       	call   804b71 <ipc_find_env>
+  801952:	a3 00 70 80 00       	mov    %eax,0x807000
+  801957:	83 c4 10             	add    $0x10,%esp
+  80195a:	eb bf                	jmp    80191b <fsipc_pages+0x18>
+
+0080195c <fsipc>:
+{
+  80195c:	55                   	push   %ebp
+  80195d:	89 e5                	mov    %esp,%ebp
+  80195f:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801962:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801967:	e8 97 ff ff ff       	call   801903 <fsipc_pages>
+}
+  80196c:	c9                   	leave
+  80196d:	c3                   	ret
+
+0080196e <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80196e:	55                   	push   %ebp
+  80196f:	89 e5                	mov    %esp,%ebp
+  801971:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801974:	8b 45 08             	mov    0x8(%ebp),%eax
+  801977:	8b 40 0c             	mov    0xc(%eax),%eax
+  80197a:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  80197f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801982:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801987:	ba 00 00 00 00       	mov    $0x0,%edx
+  80198c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801991:	e8 c6 ff ff ff       	call   80195c <fsipc>
+}
+  801996:	c9                   	leave
+  801997:	c3                   	ret
+
+00801998 <devfile_flush>:
+{
+  801998:	55                   	push   %ebp
+  801999:	89 e5                	mov    %esp,%ebp
+  80199b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80199e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019a4:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8019a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ae:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019b3:	e8 a4 ff ff ff       	call   80195c <fsipc>
+}
+  8019b8:	c9                   	leave
+  8019b9:	c3                   	ret
+
+008019ba <devfile_stat>:
+{
+  8019ba:	55                   	push   %ebp
+  8019bb:	89 e5                	mov    %esp,%ebp
+  8019bd:	53                   	push   %ebx
+  8019be:	83 ec 04             	sub    $0x4,%esp
+  8019c1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019c7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019ca:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019d4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019d9:	e8 7e ff ff ff       	call   80195c <fsipc>
+  8019de:	85 c0                	test   %eax,%eax
+  8019e0:	78 2c                	js     801a0e <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019e2:	83 ec 08             	sub    $0x8,%esp
+  8019e5:	68 00 f0 80 00       	push   $0x80f000
+  8019ea:	53                   	push   %ebx
+  8019eb:	e8 ff ee ff ff       	call   8008ef <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8019f0:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  8019f5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019fb:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  801a00:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801a06:	83 c4 10             	add    $0x10,%esp
+  801a09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a11:	c9                   	leave
+  801a12:	c3                   	ret
+
+00801a13 <devfile_write>:
+{
+  801a13:	55                   	push   %ebp
+  801a14:	89 e5                	mov    %esp,%ebp
+  801a16:	83 ec 0c             	sub    $0xc,%esp
+  801a19:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801a1c:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a21:	39 d0                	cmp    %edx,%eax
+  801a23:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a26:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a29:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a2c:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  801a32:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801a37:	50                   	push   %eax
+  801a38:	ff 75 0c             	push   0xc(%ebp)
+  801a3b:	68 08 f0 80 00       	push   $0x80f008
+  801a40:	e8 30 f0 ff ff       	call   800a75 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801a45:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a4a:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a4f:	e8 08 ff ff ff       	call   80195c <fsipc>
+}
+  801a54:	c9                   	leave
+  801a55:	c3                   	ret
+
+00801a56 <devfile_read>:
+{
+  801a56:	55                   	push   %ebp
+  801a57:	89 e5                	mov    %esp,%ebp
+  801a59:	57                   	push   %edi
+  801a5a:	56                   	push   %esi
+  801a5b:	53                   	push   %ebx
+  801a5c:	83 ec 1c             	sub    $0x1c,%esp
+  801a5f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a62:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a65:	89 fe                	mov    %edi,%esi
+  801a67:	c1 ee 0c             	shr    $0xc,%esi
+  801a6a:	b8 20 00 00 00       	mov    $0x20,%eax
+  801a6f:	39 c6                	cmp    %eax,%esi
+  801a71:	0f 47 f0             	cmova  %eax,%esi
+  801a74:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a77:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a7c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801a7f:	eb 14                	jmp    801a95 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a81:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801a88:	05 00 10 00 00       	add    $0x1000,%eax
+  801a8d:	f6 c6 06             	test   $0x6,%dh
+  801a90:	75 42                	jne    801ad4 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a92:	83 c1 01             	add    $0x1,%ecx
+  801a95:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801a98:	39 f1                	cmp    %esi,%ecx
+  801a9a:	0f 84 95 00 00 00    	je     801b35 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801aa0:	89 c2                	mov    %eax,%edx
+  801aa2:	c1 ea 16             	shr    $0x16,%edx
+  801aa5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801aac:	f6 c2 01             	test   $0x1,%dl
+  801aaf:	74 23                	je     801ad4 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801ab1:	89 c2                	mov    %eax,%edx
+  801ab3:	c1 ea 0c             	shr    $0xc,%edx
+  801ab6:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801abd:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801ac3:	74 0f                	je     801ad4 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801ac5:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801acc:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801ad2:	75 ad                	jne    801a81 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801ad4:	85 c9                	test   %ecx,%ecx
+  801ad6:	74 11                	je     801ae9 <devfile_read+0x93>
+  801ad8:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801adf:	75 08                	jne    801ae9 <devfile_read+0x93>
+  801ae1:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801ae7:	74 50                	je     801b39 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ae9:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801aec:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  801af1:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801af7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801afc:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b01:	e8 56 fe ff ff       	call   80195c <fsipc>
+  801b06:	89 c6                	mov    %eax,%esi
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	78 1f                	js     801b2b <devfile_read+0xd5>
+	assert(r <= n);
+  801b0c:	39 c7                	cmp    %eax,%edi
+  801b0e:	72 50                	jb     801b60 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801b10:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b15:	7f 62                	jg     801b79 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801b17:	83 ec 04             	sub    $0x4,%esp
+  801b1a:	50                   	push   %eax
+  801b1b:	68 00 f0 80 00       	push   $0x80f000
+  801b20:	ff 75 0c             	push   0xc(%ebp)
+  801b23:	e8 4d ef ff ff       	call   800a75 <memmove>
+	return r;
+  801b28:	83 c4 10             	add    $0x10,%esp
+}
+  801b2b:	89 f0                	mov    %esi,%eax
+  801b2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b30:	5b                   	pop    %ebx
+  801b31:	5e                   	pop    %esi
+  801b32:	5f                   	pop    %edi
+  801b33:	5d                   	pop    %ebp
+  801b34:	c3                   	ret
+  801b35:	89 f1                	mov    %esi,%ecx
+  801b37:	eb 9b                	jmp    801ad4 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801b39:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b3c:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801b41:	89 c8                	mov    %ecx,%eax
+  801b43:	c1 e0 0c             	shl    $0xc,%eax
+  801b46:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801b4b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b4e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801b53:	e8 ab fd ff ff       	call   801903 <fsipc_pages>
+  801b58:	89 c6                	mov    %eax,%esi
+  801b5a:	85 c0                	test   %eax,%eax
+  801b5c:	78 8b                	js     801ae9 <devfile_read+0x93>
+  801b5e:	eb cb                	jmp    801b2b <devfile_read+0xd5>
+	assert(r <= n);
+  801b60:	68 e4 52 80 00       	push   $0x8052e4
+  801b65:	68 2f 4e 80 00       	push   $0x804e2f
+  801b6a:	68 a0 00 00 00       	push   $0xa0
+  801b6f:	68 eb 52 80 00       	push   $0x8052eb
+  801b74:	e8 b4 e6 ff ff       	call   80022d <_panic>
+	assert(r <= PGSIZE);
+  801b79:	68 f6 52 80 00       	push   $0x8052f6
+  801b7e:	68 2f 4e 80 00       	push   $0x804e2f
+  801b83:	68 a1 00 00 00       	push   $0xa1
+  801b88:	68 eb 52 80 00       	push   $0x8052eb
+  801b8d:	e8 9b e6 ff ff       	call   80022d <_panic>
+
+00801b92 <open>:
+{
+  801b92:	55                   	push   %ebp
+  801b93:	89 e5                	mov    %esp,%ebp
+  801b95:	56                   	push   %esi
+  801b96:	53                   	push   %ebx
+  801b97:	83 ec 1c             	sub    $0x1c,%esp
+  801b9a:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801b9d:	56                   	push   %esi
+  801b9e:	e8 11 ed ff ff       	call   8008b4 <strlen>
+  801ba3:	83 c4 10             	add    $0x10,%esp
+  801ba6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bab:	7f 6c                	jg     801c19 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801bad:	83 ec 0c             	sub    $0xc,%esp
+  801bb0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bb3:	50                   	push   %eax
+  801bb4:	e8 eb f7 ff ff       	call   8013a4 <fd_alloc>
+  801bb9:	89 c3                	mov    %eax,%ebx
+  801bbb:	83 c4 10             	add    $0x10,%esp
+  801bbe:	85 c0                	test   %eax,%eax
+  801bc0:	78 3c                	js     801bfe <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801bc2:	83 ec 08             	sub    $0x8,%esp
+  801bc5:	56                   	push   %esi
+  801bc6:	68 00 f0 80 00       	push   $0x80f000
+  801bcb:	e8 1f ed ff ff       	call   8008ef <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801bd0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bd3:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bd8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801bdb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801be0:	e8 77 fd ff ff       	call   80195c <fsipc>
+  801be5:	89 c3                	mov    %eax,%ebx
+  801be7:	83 c4 10             	add    $0x10,%esp
+  801bea:	85 c0                	test   %eax,%eax
+  801bec:	78 19                	js     801c07 <open+0x75>
+	return fd2num(fd);
+  801bee:	83 ec 0c             	sub    $0xc,%esp
+  801bf1:	ff 75 f4             	push   -0xc(%ebp)
+  801bf4:	e8 84 f7 ff ff       	call   80137d <fd2num>
+  801bf9:	89 c3                	mov    %eax,%ebx
+  801bfb:	83 c4 10             	add    $0x10,%esp
+}
+  801bfe:	89 d8                	mov    %ebx,%eax
+  801c00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c03:	5b                   	pop    %ebx
+  801c04:	5e                   	pop    %esi
+  801c05:	5d                   	pop    %ebp
+  801c06:	c3                   	ret
+		fd_close(fd, 0);
+  801c07:	83 ec 08             	sub    $0x8,%esp
+  801c0a:	6a 00                	push   $0x0
+  801c0c:	ff 75 f4             	push   -0xc(%ebp)
+  801c0f:	e8 80 f8 ff ff       	call   801494 <fd_close>
+		return r;
+  801c14:	83 c4 10             	add    $0x10,%esp
+  801c17:	eb e5                	jmp    801bfe <open+0x6c>
+		return -E_BAD_PATH;
+  801c19:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c1e:	eb de                	jmp    801bfe <open+0x6c>
+
+00801c20 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801c20:	55                   	push   %ebp
+  801c21:	89 e5                	mov    %esp,%ebp
+  801c23:	53                   	push   %ebx
+  801c24:	83 ec 10             	sub    $0x10,%esp
+  801c27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801c2a:	53                   	push   %ebx
+  801c2b:	e8 84 ec ff ff       	call   8008b4 <strlen>
+  801c30:	83 c4 10             	add    $0x10,%esp
+  801c33:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c38:	7f 25                	jg     801c5f <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801c3a:	83 ec 08             	sub    $0x8,%esp
+  801c3d:	53                   	push   %ebx
+  801c3e:	68 00 f0 80 00       	push   $0x80f000
+  801c43:	e8 a7 ec ff ff       	call   8008ef <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801c48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c4d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c52:	e8 05 fd ff ff       	call   80195c <fsipc>
+  801c57:	83 c4 10             	add    $0x10,%esp
+}
+  801c5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c5d:	c9                   	leave
+  801c5e:	c3                   	ret
+		return -E_BAD_PATH;
+  801c5f:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801c64:	eb f4                	jmp    801c5a <remove+0x3a>
+
+00801c66 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c66:	55                   	push   %ebp
+  801c67:	89 e5                	mov    %esp,%ebp
+  801c69:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c71:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c76:	e8 e1 fc ff ff       	call   80195c <fsipc>
+}
+  801c7b:	c9                   	leave
+  801c7c:	c3                   	ret
+
+00801c7d <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801c7d:	55                   	push   %ebp
+  801c7e:	89 e5                	mov    %esp,%ebp
+  801c80:	53                   	push   %ebx
+  801c81:	83 ec 04             	sub    $0x4,%esp
+  801c84:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801c87:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c8c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c91:	e8 c6 fc ff ff       	call   80195c <fsipc>
+  801c96:	85 c0                	test   %eax,%eax
+  801c98:	78 3c                	js     801cd6 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801c9a:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  801c9f:	89 03                	mov    %eax,(%ebx)
+  801ca1:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  801ca6:	89 43 04             	mov    %eax,0x4(%ebx)
+  801ca9:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  801cae:	89 43 08             	mov    %eax,0x8(%ebx)
+  801cb1:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  801cb6:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801cb9:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  801cbe:	89 43 10             	mov    %eax,0x10(%ebx)
+  801cc1:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  801cc6:	89 43 14             	mov    %eax,0x14(%ebx)
+  801cc9:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  801cce:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801cd1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cd6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cd9:	c9                   	leave
+  801cda:	c3                   	ret
+
+00801cdb <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801cdb:	55                   	push   %ebp
+  801cdc:	89 e5                	mov    %esp,%ebp
+  801cde:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801ce1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce4:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  801ce9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cee:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801cf3:	e8 64 fc ff ff       	call   80195c <fsipc>
+}
+  801cf8:	c9                   	leave
+  801cf9:	c3                   	ret
+
+00801cfa <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801cfa:	55                   	push   %ebp
+  801cfb:	89 e5                	mov    %esp,%ebp
+  801cfd:	56                   	push   %esi
+  801cfe:	53                   	push   %ebx
+  801cff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801d02:	83 ec 0c             	sub    $0xc,%esp
+  801d05:	ff 75 08             	push   0x8(%ebp)
+  801d08:	e8 80 f6 ff ff       	call   80138d <fd2data>
+  801d0d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801d0f:	83 c4 08             	add    $0x8,%esp
+  801d12:	68 02 53 80 00       	push   $0x805302
+  801d17:	53                   	push   %ebx
+  801d18:	e8 d2 eb ff ff       	call   8008ef <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801d1d:	8b 46 04             	mov    0x4(%esi),%eax
+  801d20:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801d26:	2b 0e                	sub    (%esi),%ecx
+  801d28:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801d2d:	89 c8                	mov    %ecx,%eax
+  801d2f:	f7 e2                	mul    %edx
+  801d31:	c1 ea 0c             	shr    $0xc,%edx
+  801d34:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801d3a:	29 d1                	sub    %edx,%ecx
+  801d3c:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801d42:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d49:	00 00 00 
+	stat->st_dev = &devpipe;
+  801d4c:	c7 83 88 00 00 00 28 	movl   $0x806028,0x88(%ebx)
+  801d53:	60 80 00 
+	return 0;
+}
+  801d56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d5e:	5b                   	pop    %ebx
+  801d5f:	5e                   	pop    %esi
+  801d60:	5d                   	pop    %ebp
+  801d61:	c3                   	ret
+
+00801d62 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801d62:	55                   	push   %ebp
+  801d63:	89 e5                	mov    %esp,%ebp
+  801d65:	53                   	push   %ebx
+  801d66:	83 ec 0c             	sub    $0xc,%esp
+  801d69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801d6c:	53                   	push   %ebx
+  801d6d:	6a 00                	push   $0x0
+  801d6f:	e8 f3 f0 ff ff       	call   800e67 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801d74:	89 1c 24             	mov    %ebx,(%esp)
+  801d77:	e8 11 f6 ff ff       	call   80138d <fd2data>
+  801d7c:	83 c4 08             	add    $0x8,%esp
+  801d7f:	50                   	push   %eax
+  801d80:	6a 00                	push   $0x0
+  801d82:	e8 e0 f0 ff ff       	call   800e67 <sys_page_unmap>
+}
+  801d87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d8a:	c9                   	leave
+  801d8b:	c3                   	ret
+
+00801d8c <_pipeisclosed>:
+{
+  801d8c:	55                   	push   %ebp
+  801d8d:	89 e5                	mov    %esp,%ebp
+  801d8f:	57                   	push   %edi
+  801d90:	56                   	push   %esi
+  801d91:	53                   	push   %ebx
+  801d92:	83 ec 1c             	sub    $0x1c,%esp
+  801d95:	89 c7                	mov    %eax,%edi
+  801d97:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801d99:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801d9e:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801da1:	83 ec 0c             	sub    $0xc,%esp
+  801da4:	57                   	push   %edi
+  801da5:	e8 06 2e 00 00       	call   804bb0 <pageref>
+  801daa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801dad:	89 34 24             	mov    %esi,(%esp)
+  801db0:	e8 fb 2d 00 00       	call   804bb0 <pageref>
+		nn = thisenv->env_runs;
+  801db5:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  801dbb:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801dbe:	83 c4 10             	add    $0x10,%esp
+  801dc1:	39 cb                	cmp    %ecx,%ebx
+  801dc3:	74 1b                	je     801de0 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801dc5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801dc8:	75 cf                	jne    801d99 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801dca:	8b 42 58             	mov    0x58(%edx),%eax
+  801dcd:	6a 01                	push   $0x1
+  801dcf:	50                   	push   %eax
+  801dd0:	53                   	push   %ebx
+  801dd1:	68 09 53 80 00       	push   $0x805309
+  801dd6:	e8 2d e5 ff ff       	call   800308 <cprintf>
+  801ddb:	83 c4 10             	add    $0x10,%esp
+  801dde:	eb b9                	jmp    801d99 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801de0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801de3:	0f 94 c0             	sete   %al
+  801de6:	0f b6 c0             	movzbl %al,%eax
+}
+  801de9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dec:	5b                   	pop    %ebx
+  801ded:	5e                   	pop    %esi
+  801dee:	5f                   	pop    %edi
+  801def:	5d                   	pop    %ebp
+  801df0:	c3                   	ret
+
+00801df1 <devpipe_read>:
+{
+  801df1:	55                   	push   %ebp
+  801df2:	89 e5                	mov    %esp,%ebp
+  801df4:	57                   	push   %edi
+  801df5:	56                   	push   %esi
+  801df6:	53                   	push   %ebx
+  801df7:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801dfa:	ff 75 08             	push   0x8(%ebp)
+  801dfd:	e8 8b f5 ff ff       	call   80138d <fd2data>
+  801e02:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801e04:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801e07:	8d 40 04             	lea    0x4(%eax),%eax
+  801e0a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801e0d:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801e10:	8b 0b                	mov    (%ebx),%ecx
+  801e12:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801e18:	29 ce                	sub    %ecx,%esi
+  801e1a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e1f:	f7 e6                	mul    %esi
+  801e21:	c1 ea 0c             	shr    $0xc,%edx
+  801e24:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801e2a:	29 c6                	sub    %eax,%esi
+  801e2c:	89 f2                	mov    %esi,%edx
+  801e2e:	75 43                	jne    801e73 <devpipe_read+0x82>
+		ref = pageref(p);
+  801e30:	83 ec 0c             	sub    $0xc,%esp
+  801e33:	53                   	push   %ebx
+  801e34:	e8 77 2d 00 00       	call   804bb0 <pageref>
+  801e39:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801e3b:	89 da                	mov    %ebx,%edx
+  801e3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e40:	e8 47 ff ff ff       	call   801d8c <_pipeisclosed>
+  801e45:	83 c4 10             	add    $0x10,%esp
+  801e48:	85 c0                	test   %eax,%eax
+  801e4a:	0f 85 c1 00 00 00    	jne    801f11 <devpipe_read+0x120>
+	*sleeping = 1;
+  801e50:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801e57:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801e5c:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801e5f:	75 ac                	jne    801e0d <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801e61:	83 ec 04             	sub    $0x4,%esp
+  801e64:	56                   	push   %esi
+  801e65:	57                   	push   %edi
+  801e66:	ff 75 e4             	push   -0x1c(%ebp)
+  801e69:	e8 4d f4 ff ff       	call   8012bb <sys_futex_wait>
+  801e6e:	83 c4 10             	add    $0x10,%esp
+  801e71:	eb 9a                	jmp    801e0d <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801e73:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801e76:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801e7a:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801e7c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e81:	f7 e1                	mul    %ecx
+  801e83:	c1 ea 0b             	shr    $0xb,%edx
+  801e86:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801e8c:	29 c1                	sub    %eax,%ecx
+  801e8e:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801e90:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801e95:	29 cf                	sub    %ecx,%edi
+  801e97:	39 f7                	cmp    %esi,%edi
+  801e99:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801e9c:	8d 43 10             	lea    0x10(%ebx),%eax
+  801e9f:	83 ec 04             	sub    $0x4,%esp
+  801ea2:	57                   	push   %edi
+  801ea3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ea6:	01 c2                	add    %eax,%edx
+  801ea8:	52                   	push   %edx
+  801ea9:	ff 75 0c             	push   0xc(%ebp)
+  801eac:	e8 c4 eb ff ff       	call   800a75 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801eb1:	83 c4 0c             	add    $0xc,%esp
+  801eb4:	89 f1                	mov    %esi,%ecx
+  801eb6:	29 f9                	sub    %edi,%ecx
+  801eb8:	51                   	push   %ecx
+  801eb9:	ff 75 e4             	push   -0x1c(%ebp)
+  801ebc:	89 f8                	mov    %edi,%eax
+  801ebe:	03 45 0c             	add    0xc(%ebp),%eax
+  801ec1:	50                   	push   %eax
+  801ec2:	e8 ae eb ff ff       	call   800a75 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801ec7:	89 f1                	mov    %esi,%ecx
+  801ec9:	03 0b                	add    (%ebx),%ecx
+  801ecb:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801ed0:	f7 e1                	mul    %ecx
+  801ed2:	c1 ea 0c             	shr    $0xc,%edx
+  801ed5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801edb:	29 d1                	sub    %edx,%ecx
+  801edd:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801edf:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801ee4:	83 c4 10             	add    $0x10,%esp
+  801ee7:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801eeb:	75 0a                	jne    801ef7 <devpipe_read+0x106>
+	return n;
+  801eed:	89 f0                	mov    %esi,%eax
+}
+  801eef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ef2:	5b                   	pop    %ebx
+  801ef3:	5e                   	pop    %esi
+  801ef4:	5f                   	pop    %edi
+  801ef5:	5d                   	pop    %ebp
+  801ef6:	c3                   	ret
+		*sleeping = 0;
+  801ef7:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801efe:	83 ec 08             	sub    $0x8,%esp
+  801f01:	68 00 04 00 00       	push   $0x400
+  801f06:	53                   	push   %ebx
+  801f07:	e8 ff f3 ff ff       	call   80130b <sys_futex_wake>
+  801f0c:	83 c4 10             	add    $0x10,%esp
+  801f0f:	eb dc                	jmp    801eed <devpipe_read+0xfc>
+			return 0;
+  801f11:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f16:	eb d7                	jmp    801eef <devpipe_read+0xfe>
+
+00801f18 <devpipe_write>:
+{
+  801f18:	55                   	push   %ebp
+  801f19:	89 e5                	mov    %esp,%ebp
+  801f1b:	57                   	push   %edi
+  801f1c:	56                   	push   %esi
+  801f1d:	53                   	push   %ebx
+  801f1e:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801f21:	ff 75 08             	push   0x8(%ebp)
+  801f24:	e8 64 f4 ff ff       	call   80138d <fd2data>
+  801f29:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801f2b:	83 c4 10             	add    $0x10,%esp
+  801f2e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801f35:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f38:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801f3b:	0f 83 23 01 00 00    	jae    802064 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801f41:	8b 77 04             	mov    0x4(%edi),%esi
+  801f44:	8b 1f                	mov    (%edi),%ebx
+  801f46:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801f4c:	29 d9                	sub    %ebx,%ecx
+  801f4e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f53:	f7 e1                	mul    %ecx
+  801f55:	c1 ea 0c             	shr    $0xc,%edx
+  801f58:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801f5e:	29 c1                	sub    %eax,%ecx
+  801f60:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801f62:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801f68:	75 40                	jne    801faa <devpipe_write+0x92>
+			ref = pageref(p);
+  801f6a:	83 ec 0c             	sub    $0xc,%esp
+  801f6d:	57                   	push   %edi
+  801f6e:	e8 3d 2c 00 00       	call   804bb0 <pageref>
+  801f73:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801f75:	89 fa                	mov    %edi,%edx
+  801f77:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f7a:	e8 0d fe ff ff       	call   801d8c <_pipeisclosed>
+  801f7f:	83 c4 10             	add    $0x10,%esp
+  801f82:	85 c0                	test   %eax,%eax
+  801f84:	0f 85 d5 00 00 00    	jne    80205f <devpipe_write+0x147>
+	*sleeping = 1;
+  801f8a:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801f91:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801f96:	39 1f                	cmp    %ebx,(%edi)
+  801f98:	75 a7                	jne    801f41 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801f9a:	83 ec 04             	sub    $0x4,%esp
+  801f9d:	56                   	push   %esi
+  801f9e:	53                   	push   %ebx
+  801f9f:	57                   	push   %edi
+  801fa0:	e8 16 f3 ff ff       	call   8012bb <sys_futex_wait>
+  801fa5:	83 c4 10             	add    $0x10,%esp
+  801fa8:	eb 97                	jmp    801f41 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801faa:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801fad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fb0:	29 c1                	sub    %eax,%ecx
+  801fb2:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801fb7:	89 d8                	mov    %ebx,%eax
+  801fb9:	29 d0                	sub    %edx,%eax
+  801fbb:	39 c1                	cmp    %eax,%ecx
+  801fbd:	0f 46 c1             	cmovbe %ecx,%eax
+  801fc0:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801fc2:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801fc7:	f7 e6                	mul    %esi
+  801fc9:	c1 ea 0b             	shr    $0xb,%edx
+  801fcc:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801fd2:	29 c6                	sub    %eax,%esi
+  801fd4:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801fd6:	29 f3                	sub    %esi,%ebx
+  801fd8:	39 cb                	cmp    %ecx,%ebx
+  801fda:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801fdd:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801fe0:	8d 77 10             	lea    0x10(%edi),%esi
+  801fe3:	83 ec 04             	sub    $0x4,%esp
+  801fe6:	53                   	push   %ebx
+  801fe7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fea:	03 45 0c             	add    0xc(%ebp),%eax
+  801fed:	50                   	push   %eax
+  801fee:	01 f2                	add    %esi,%edx
+  801ff0:	52                   	push   %edx
+  801ff1:	e8 7f ea ff ff       	call   800a75 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  801ff6:	83 c4 0c             	add    $0xc,%esp
+  801ff9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ffc:	29 d8                	sub    %ebx,%eax
+  801ffe:	50                   	push   %eax
+  801fff:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802002:	01 d3                	add    %edx,%ebx
+  802004:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802007:	53                   	push   %ebx
+  802008:	56                   	push   %esi
+  802009:	e8 67 ea ff ff       	call   800a75 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  80200e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802011:	03 4f 04             	add    0x4(%edi),%ecx
+  802014:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802019:	f7 e1                	mul    %ecx
+  80201b:	c1 ea 0c             	shr    $0xc,%edx
+  80201e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802024:	29 d1                	sub    %edx,%ecx
+  802026:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  802029:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80202e:	83 c4 10             	add    $0x10,%esp
+  802031:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802035:	75 0b                	jne    802042 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802037:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  80203a:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80203d:	e9 f3 fe ff ff       	jmp    801f35 <devpipe_write+0x1d>
+		*sleeping = 0;
+  802042:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  802049:	83 ec 08             	sub    $0x8,%esp
+  80204c:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802051:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802054:	50                   	push   %eax
+  802055:	e8 b1 f2 ff ff       	call   80130b <sys_futex_wake>
+  80205a:	83 c4 10             	add    $0x10,%esp
+  80205d:	eb d8                	jmp    802037 <devpipe_write+0x11f>
+				return 0;
+  80205f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802064:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802067:	5b                   	pop    %ebx
+  802068:	5e                   	pop    %esi
+  802069:	5f                   	pop    %edi
+  80206a:	5d                   	pop    %ebp
+  80206b:	c3                   	ret
+
+0080206c <pipe>:
+{
+  80206c:	55                   	push   %ebp
+  80206d:	89 e5                	mov    %esp,%ebp
+  80206f:	56                   	push   %esi
+  802070:	53                   	push   %ebx
+  802071:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802074:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802077:	50                   	push   %eax
+  802078:	e8 27 f3 ff ff       	call   8013a4 <fd_alloc>
+  80207d:	89 c3                	mov    %eax,%ebx
+  80207f:	83 c4 10             	add    $0x10,%esp
+  802082:	85 c0                	test   %eax,%eax
+  802084:	0f 88 23 01 00 00    	js     8021ad <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80208a:	83 ec 04             	sub    $0x4,%esp
+  80208d:	68 07 04 00 00       	push   $0x407
+  802092:	ff 75 f4             	push   -0xc(%ebp)
+  802095:	6a 00                	push   $0x0
+  802097:	e8 46 ed ff ff       	call   800de2 <sys_page_alloc>
+  80209c:	89 c3                	mov    %eax,%ebx
+  80209e:	83 c4 10             	add    $0x10,%esp
+  8020a1:	85 c0                	test   %eax,%eax
+  8020a3:	0f 88 04 01 00 00    	js     8021ad <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8020a9:	83 ec 0c             	sub    $0xc,%esp
+  8020ac:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020af:	50                   	push   %eax
+  8020b0:	e8 ef f2 ff ff       	call   8013a4 <fd_alloc>
+  8020b5:	89 c3                	mov    %eax,%ebx
+  8020b7:	83 c4 10             	add    $0x10,%esp
+  8020ba:	85 c0                	test   %eax,%eax
+  8020bc:	0f 88 db 00 00 00    	js     80219d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020c2:	83 ec 04             	sub    $0x4,%esp
+  8020c5:	68 07 04 00 00       	push   $0x407
+  8020ca:	ff 75 f0             	push   -0x10(%ebp)
+  8020cd:	6a 00                	push   $0x0
+  8020cf:	e8 0e ed ff ff       	call   800de2 <sys_page_alloc>
+  8020d4:	89 c3                	mov    %eax,%ebx
+  8020d6:	83 c4 10             	add    $0x10,%esp
+  8020d9:	85 c0                	test   %eax,%eax
+  8020db:	0f 88 bc 00 00 00    	js     80219d <pipe+0x131>
+	va = fd2data(fd0);
+  8020e1:	83 ec 0c             	sub    $0xc,%esp
+  8020e4:	ff 75 f4             	push   -0xc(%ebp)
+  8020e7:	e8 a1 f2 ff ff       	call   80138d <fd2data>
+  8020ec:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020ee:	83 c4 0c             	add    $0xc,%esp
+  8020f1:	68 07 04 00 00       	push   $0x407
+  8020f6:	50                   	push   %eax
+  8020f7:	6a 00                	push   $0x0
+  8020f9:	e8 e4 ec ff ff       	call   800de2 <sys_page_alloc>
+  8020fe:	89 c3                	mov    %eax,%ebx
+  802100:	83 c4 10             	add    $0x10,%esp
+  802103:	85 c0                	test   %eax,%eax
+  802105:	0f 88 82 00 00 00    	js     80218d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80210b:	83 ec 0c             	sub    $0xc,%esp
+  80210e:	ff 75 f0             	push   -0x10(%ebp)
+  802111:	e8 77 f2 ff ff       	call   80138d <fd2data>
+  802116:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80211d:	50                   	push   %eax
+  80211e:	6a 00                	push   $0x0
+  802120:	56                   	push   %esi
+  802121:	6a 00                	push   $0x0
+  802123:	e8 fd ec ff ff       	call   800e25 <sys_page_map>
+  802128:	89 c3                	mov    %eax,%ebx
+  80212a:	83 c4 20             	add    $0x20,%esp
+  80212d:	85 c0                	test   %eax,%eax
+  80212f:	78 4e                	js     80217f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802131:	a1 28 60 80 00       	mov    0x806028,%eax
+  802136:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802139:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80213b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80213e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802145:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802148:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80214a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80214d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802154:	83 ec 0c             	sub    $0xc,%esp
+  802157:	ff 75 f4             	push   -0xc(%ebp)
+  80215a:	e8 1e f2 ff ff       	call   80137d <fd2num>
+  80215f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802162:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802164:	83 c4 04             	add    $0x4,%esp
+  802167:	ff 75 f0             	push   -0x10(%ebp)
+  80216a:	e8 0e f2 ff ff       	call   80137d <fd2num>
+  80216f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802172:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802175:	83 c4 10             	add    $0x10,%esp
+  802178:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80217d:	eb 2e                	jmp    8021ad <pipe+0x141>
+	sys_page_unmap(0, va);
+  80217f:	83 ec 08             	sub    $0x8,%esp
+  802182:	56                   	push   %esi
+  802183:	6a 00                	push   $0x0
+  802185:	e8 dd ec ff ff       	call   800e67 <sys_page_unmap>
+  80218a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80218d:	83 ec 08             	sub    $0x8,%esp
+  802190:	ff 75 f0             	push   -0x10(%ebp)
+  802193:	6a 00                	push   $0x0
+  802195:	e8 cd ec ff ff       	call   800e67 <sys_page_unmap>
+  80219a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80219d:	83 ec 08             	sub    $0x8,%esp
+  8021a0:	ff 75 f4             	push   -0xc(%ebp)
+  8021a3:	6a 00                	push   $0x0
+  8021a5:	e8 bd ec ff ff       	call   800e67 <sys_page_unmap>
+  8021aa:	83 c4 10             	add    $0x10,%esp
+}
+  8021ad:	89 d8                	mov    %ebx,%eax
+  8021af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b2:	5b                   	pop    %ebx
+  8021b3:	5e                   	pop    %esi
+  8021b4:	5d                   	pop    %ebp
+  8021b5:	c3                   	ret
+
+008021b6 <pipeisclosed>:
+{
+  8021b6:	55                   	push   %ebp
+  8021b7:	89 e5                	mov    %esp,%ebp
+  8021b9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021bf:	50                   	push   %eax
+  8021c0:	ff 75 08             	push   0x8(%ebp)
+  8021c3:	e8 30 f2 ff ff       	call   8013f8 <fd_lookup>
+  8021c8:	83 c4 10             	add    $0x10,%esp
+  8021cb:	85 c0                	test   %eax,%eax
+  8021cd:	78 18                	js     8021e7 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8021cf:	83 ec 0c             	sub    $0xc,%esp
+  8021d2:	ff 75 f4             	push   -0xc(%ebp)
+  8021d5:	e8 b3 f1 ff ff       	call   80138d <fd2data>
+  8021da:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8021dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021df:	e8 a8 fb ff ff       	call   801d8c <_pipeisclosed>
+  8021e4:	83 c4 10             	add    $0x10,%esp
+}
+  8021e7:	c9                   	leave
+  8021e8:	c3                   	ret
+
+008021e9 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  8021e9:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8021eb:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  8021f1:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  8021f7:	81 c2 34 01 00 00    	add    $0x134,%edx
+  8021fd:	39 d0                	cmp    %edx,%eax
+  8021ff:	74 2e                	je     80222f <segment_lookup+0x46>
+{
+  802201:	55                   	push   %ebp
+  802202:	89 e5                	mov    %esp,%ebp
+  802204:	57                   	push   %edi
+  802205:	56                   	push   %esi
+  802206:	53                   	push   %ebx
+  802207:	eb 07                	jmp    802210 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802209:	83 c0 20             	add    $0x20,%eax
+  80220c:	39 d0                	cmp    %edx,%eax
+  80220e:	74 15                	je     802225 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802210:	8b 18                	mov    (%eax),%ebx
+  802212:	39 d9                	cmp    %ebx,%ecx
+  802214:	72 f3                	jb     802209 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  802216:	8b 38                	mov    (%eax),%edi
+  802218:	8b 58 04             	mov    0x4(%eax),%ebx
+  80221b:	89 ce                	mov    %ecx,%esi
+  80221d:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  80221f:	39 de                	cmp    %ebx,%esi
+  802221:	73 e6                	jae    802209 <segment_lookup+0x20>
+  802223:	eb 05                	jmp    80222a <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  802225:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80222a:	5b                   	pop    %ebx
+  80222b:	5e                   	pop    %esi
+  80222c:	5f                   	pop    %edi
+  80222d:	5d                   	pop    %ebp
+  80222e:	c3                   	ret
+	return NULL;
+  80222f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802234:	c3                   	ret
+
+00802235 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802235:	55                   	push   %ebp
+  802236:	89 e5                	mov    %esp,%ebp
+  802238:	53                   	push   %ebx
+  802239:	83 ec 04             	sub    $0x4,%esp
+  80223c:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80223e:	c1 e8 16             	shr    $0x16,%eax
+  802241:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802248:	25 81 00 00 00       	and    $0x81,%eax
+  80224d:	83 f8 01             	cmp    $0x1,%eax
+  802250:	75 6b                	jne    8022bd <page_is_clean+0x88>
+  802252:	89 da                	mov    %ebx,%edx
+  802254:	c1 ea 0c             	shr    $0xc,%edx
+  802257:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  80225e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802263:	f6 c1 01             	test   $0x1,%cl
+  802266:	74 5a                	je     8022c2 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802268:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80226f:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802275:	75 4b                	jne    8022c2 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  802277:	89 d8                	mov    %ebx,%eax
+  802279:	e8 6b ff ff ff       	call   8021e9 <segment_lookup>
+  80227e:	89 c2                	mov    %eax,%edx
+		return 1;
+  802280:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  802285:	85 d2                	test   %edx,%edx
+  802287:	75 39                	jne    8022c2 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  802289:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  80228f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802294:	eb 03                	jmp    802299 <page_is_clean+0x64>
+  802296:	83 c0 01             	add    $0x1,%eax
+  802299:	39 c2                	cmp    %eax,%edx
+  80229b:	7e 19                	jle    8022b6 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  80229d:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  8022a4:	72 f0                	jb     802296 <page_is_clean+0x61>
+  8022a6:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  8022ad:	73 e7                	jae    802296 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  8022af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022b4:	eb 0c                	jmp    8022c2 <page_is_clean+0x8d>
+	return 0;
+  8022b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022bb:	eb 05                	jmp    8022c2 <page_is_clean+0x8d>
+		return 0;
+  8022bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022c5:	c9                   	leave
+  8022c6:	c3                   	ret
+
+008022c7 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  8022c7:	55                   	push   %ebp
+  8022c8:	89 e5                	mov    %esp,%ebp
+  8022ca:	57                   	push   %edi
+  8022cb:	56                   	push   %esi
+  8022cc:	53                   	push   %ebx
+  8022cd:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8022d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8022d5:	eb 19                	jmp    8022f0 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8022d7:	f7 d3                	not    %ebx
+  8022d9:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8022df:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8022e1:	83 c6 01             	add    $0x1,%esi
+  8022e4:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8022ea:	0f 87 97 00 00 00    	ja     802387 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8022f0:	89 f3                	mov    %esi,%ebx
+  8022f2:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  8022f8:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8022fe:	89 d8                	mov    %ebx,%eax
+  802300:	c1 e8 0a             	shr    $0xa,%eax
+  802303:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80230a:	25 81 00 00 00       	and    $0x81,%eax
+  80230f:	83 f8 01             	cmp    $0x1,%eax
+  802312:	75 c3                	jne    8022d7 <linear_walk+0x10>
+  802314:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80231a:	77 bb                	ja     8022d7 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  80231c:	89 df                	mov    %ebx,%edi
+  80231e:	c1 e7 0c             	shl    $0xc,%edi
+  802321:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802324:	89 f8                	mov    %edi,%eax
+  802326:	e8 0a ff ff ff       	call   802235 <page_is_clean>
+  80232b:	84 c0                	test   %al,%al
+  80232d:	75 64                	jne    802393 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80232f:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802335:	77 aa                	ja     8022e1 <linear_walk+0x1a>
+  802337:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  80233d:	72 a2                	jb     8022e1 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80233f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802346:	a8 01                	test   $0x1,%al
+  802348:	74 97                	je     8022e1 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80234a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802351:	f6 c4 04             	test   $0x4,%ah
+  802354:	75 8b                	jne    8022e1 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802356:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80235d:	f6 c4 02             	test   $0x2,%ah
+  802360:	0f 85 7b ff ff ff    	jne    8022e1 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802366:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80236d:	c1 e8 0c             	shr    $0xc,%eax
+  802370:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802373:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802378:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80237c:	66 83 f8 01          	cmp    $0x1,%ax
+  802380:	76 11                	jbe    802393 <linear_walk+0xcc>
+  802382:	e9 5a ff ff ff       	jmp    8022e1 <linear_walk+0x1a>
+  802387:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  80238c:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802393:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  802399:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80239c:	83 c4 1c             	add    $0x1c,%esp
+  80239f:	5b                   	pop    %ebx
+  8023a0:	5e                   	pop    %esi
+  8023a1:	5f                   	pop    %edi
+  8023a2:	5d                   	pop    %ebp
+  8023a3:	c3                   	ret
+
+008023a4 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  8023a4:	55                   	push   %ebp
+  8023a5:	89 e5                	mov    %esp,%ebp
+  8023a7:	56                   	push   %esi
+  8023a8:	53                   	push   %ebx
+  8023a9:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  8023ab:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023b0:	83 e0 7f             	and    $0x7f,%eax
+  8023b3:	c1 e0 04             	shl    $0x4,%eax
+  8023b6:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  8023bc:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  8023c2:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  8023c8:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  8023ce:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023d3:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  8023d6:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023db:	83 c0 01             	add    $0x1,%eax
+  8023de:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  8023e3:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  8023e6:	5b                   	pop    %ebx
+  8023e7:	5e                   	pop    %esi
+  8023e8:	5d                   	pop    %ebp
+  8023e9:	c3                   	ret
+
+008023ea <page_ring_enter>:
+{
+  8023ea:	55                   	push   %ebp
+  8023eb:	89 e5                	mov    %esp,%ebp
+  8023ed:	57                   	push   %edi
+  8023ee:	56                   	push   %esi
+  8023ef:	53                   	push   %ebx
+  8023f0:	83 ec 18             	sub    $0x18,%esp
+  8023f3:	89 c6                	mov    %eax,%esi
+  8023f5:	89 d7                	mov    %edx,%edi
+  8023f7:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  8023f9:	6a 00                	push   $0x0
+  8023fb:	6a 00                	push   $0x0
+  8023fd:	6a 00                	push   $0x0
+  8023ff:	6a 07                	push   $0x7
+  802401:	ff 35 40 b0 80 00    	push   0x80b040
+  802407:	e8 8e 26 00 00       	call   804a9a <ipc_call>
+  80240c:	83 c4 20             	add    $0x20,%esp
+  80240f:	85 c0                	test   %eax,%eax
+  802411:	79 22                	jns    802435 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802413:	50                   	push   %eax
+  802414:	68 21 53 80 00       	push   $0x805321
+  802419:	68 13 02 00 00       	push   $0x213
+  80241e:	68 35 53 80 00       	push   $0x805335
+  802423:	e8 05 de ff ff       	call   80022d <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802428:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  80242d:	83 c0 01             	add    $0x1,%eax
+  802430:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802435:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  80243b:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802440:	39 c2                	cmp    %eax,%edx
+  802442:	74 24                	je     802468 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802444:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802449:	83 e0 7f             	and    $0x7f,%eax
+  80244c:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802453:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  80245a:	29 f0                	sub    %esi,%eax
+  80245c:	39 d8                	cmp    %ebx,%eax
+  80245e:	73 c8                	jae    802428 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802460:	8b 52 04             	mov    0x4(%edx),%edx
+  802463:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802466:	eb c0                	jmp    802428 <page_ring_enter+0x3e>
+}
+  802468:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80246b:	5b                   	pop    %ebx
+  80246c:	5e                   	pop    %esi
+  80246d:	5f                   	pop    %edi
+  80246e:	5d                   	pop    %ebp
+  80246f:	c3                   	ret
+
+00802470 <page_ring_reserve>:
+{
+  802470:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802472:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802477:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  80247d:	29 d0                	sub    %edx,%eax
+  80247f:	ba 80 00 00 00       	mov    $0x80,%edx
+  802484:	29 ca                	sub    %ecx,%edx
+  802486:	39 c2                	cmp    %eax,%edx
+  802488:	72 01                	jb     80248b <page_ring_reserve+0x1b>
+  80248a:	c3                   	ret
+{
+  80248b:	55                   	push   %ebp
+  80248c:	89 e5                	mov    %esp,%ebp
+  80248e:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802491:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802496:	ba 00 00 00 00       	mov    $0x0,%edx
+  80249b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a0:	e8 45 ff ff ff       	call   8023ea <page_ring_enter>
+}
+  8024a5:	c9                   	leave
+  8024a6:	c3                   	ret
+
+008024a7 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  8024a7:	55                   	push   %ebp
+  8024a8:	89 e5                	mov    %esp,%ebp
+  8024aa:	53                   	push   %ebx
+  8024ab:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  8024ae:	6a 07                	push   $0x7
+  8024b0:	6a 01                	push   $0x1
+  8024b2:	89 c3                	mov    %eax,%ebx
+  8024b4:	c1 e3 0c             	shl    $0xc,%ebx
+  8024b7:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  8024bd:	52                   	push   %edx
+  8024be:	6a 04                	push   $0x4
+  8024c0:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  8024c7:	e8 ce 25 00 00       	call   804a9a <ipc_call>
+	sharereqs[i].nslots = 0;
+  8024cc:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  8024d3:	00 00 00 
+	return r;
+}
+  8024d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024d9:	c9                   	leave
+  8024da:	c3                   	ret
+
+008024db <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  8024db:	55                   	push   %ebp
+  8024dc:	89 e5                	mov    %esp,%ebp
+  8024de:	56                   	push   %esi
+  8024df:	53                   	push   %ebx
+  8024e0:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  8024e2:	c1 e8 10             	shr    $0x10,%eax
+  8024e5:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  8024e8:	89 c2                	mov    %eax,%edx
+  8024ea:	c1 e2 0c             	shl    $0xc,%edx
+  8024ed:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  8024f3:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8024f6:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  8024fc:	89 c2                	mov    %eax,%edx
+  8024fe:	c1 e2 0a             	shl    $0xa,%edx
+  802501:	01 f2                	add    %esi,%edx
+  802503:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  80250a:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802510:	74 09                	je     80251b <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802512:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802517:	5b                   	pop    %ebx
+  802518:	5e                   	pop    %esi
+  802519:	5d                   	pop    %ebp
+  80251a:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  80251b:	e8 87 ff ff ff       	call   8024a7 <page_share_send>
+  802520:	eb f5                	jmp    802517 <page_share_slot+0x3c>
+
+00802522 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802522:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802527:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  80252a:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  80252f:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  802535:	74 09                	je     802540 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802537:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80253c:	85 c0                	test   %eax,%eax
+  80253e:	75 01                	jne    802541 <page_ring_ready+0x1f>
+}
+  802540:	c3                   	ret
+{
+  802541:	55                   	push   %ebp
+  802542:	89 e5                	mov    %esp,%ebp
+  802544:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802547:	68 07 06 00 00       	push   $0x607
+  80254c:	6a 08                	push   $0x8
+  80254e:	68 00 30 ad de       	push   $0xdead3000
+  802553:	6a 00                	push   $0x0
+  802555:	e8 b3 e9 ff ff       	call   800f0d <sys_page_alloc_range>
+  80255a:	83 c4 10             	add    $0x10,%esp
+  80255d:	83 f8 08             	cmp    $0x8,%eax
+  802560:	74 1b                	je     80257d <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802562:	83 ec 04             	sub    $0x4,%esp
+  802565:	6a 08                	push   $0x8
+  802567:	68 00 30 ad de       	push   $0xdead3000
+  80256c:	6a 00                	push   $0x0
+  80256e:	e8 08 ea ff ff       	call   800f7b <sys_page_unmap_range>
+		return 0;
+  802573:	83 c4 10             	add    $0x10,%esp
+  802576:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80257b:	c9                   	leave
+  80257c:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  80257d:	83 ec 0c             	sub    $0xc,%esp
+  802580:	68 07 04 00 00       	push   $0x407
+  802585:	6a 08                	push   $0x8
+  802587:	68 00 30 ad de       	push   $0xdead3000
+  80258c:	6a 06                	push   $0x6
+  80258e:	ff 35 40 b0 80 00    	push   0x80b040
+  802594:	e8 01 25 00 00       	call   804a9a <ipc_call>
+  802599:	83 c4 20             	add    $0x20,%esp
+  80259c:	85 c0                	test   %eax,%eax
+  80259e:	78 14                	js     8025b4 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  8025a0:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8025a5:	8b 40 48             	mov    0x48(%eax),%eax
+  8025a8:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  8025ad:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025b2:	eb c7                	jmp    80257b <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  8025b4:	83 ec 04             	sub    $0x4,%esp
+  8025b7:	6a 08                	push   $0x8
+  8025b9:	68 00 30 ad de       	push   $0xdead3000
+  8025be:	6a 00                	push   $0x0
+  8025c0:	e8 b6 e9 ff ff       	call   800f7b <sys_page_unmap_range>
+		return 0;
+  8025c5:	83 c4 10             	add    $0x10,%esp
+  8025c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025cd:	eb ac                	jmp    80257b <page_ring_ready+0x59>
+
+008025cf <page_remove_slot>:
+{
+  8025cf:	55                   	push   %ebp
+  8025d0:	89 e5                	mov    %esp,%ebp
+  8025d2:	56                   	push   %esi
+  8025d3:	53                   	push   %ebx
+  8025d4:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8025d6:	89 c6                	mov    %eax,%esi
+  8025d8:	c1 ee 10             	shr    $0x10,%esi
+  8025db:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8025de:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  8025e5:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  8025eb:	74 2a                	je     802617 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8025ed:	83 ec 0c             	sub    $0xc,%esp
+  8025f0:	6a 00                	push   $0x0
+  8025f2:	6a 00                	push   $0x0
+  8025f4:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  8025f6:	c1 e3 04             	shl    $0x4,%ebx
+  8025f9:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8025fc:	53                   	push   %ebx
+  8025fd:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  802604:	e8 91 24 00 00       	call   804a9a <ipc_call>
+  802609:	83 c4 20             	add    $0x20,%esp
+  80260c:	85 c0                	test   %eax,%eax
+  80260e:	78 2d                	js     80263d <page_remove_slot+0x6e>
+}
+  802610:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802613:	5b                   	pop    %ebx
+  802614:	5e                   	pop    %esi
+  802615:	5d                   	pop    %ebp
+  802616:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802617:	e8 06 ff ff ff       	call   802522 <page_ring_ready>
+  80261c:	85 c0                	test   %eax,%eax
+  80261e:	74 cd                	je     8025ed <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802620:	b8 01 00 00 00       	mov    $0x1,%eax
+  802625:	e8 46 fe ff ff       	call   802470 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  80262a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80262f:	89 da                	mov    %ebx,%edx
+  802631:	b8 02 00 00 00       	mov    $0x2,%eax
+  802636:	e8 69 fd ff ff       	call   8023a4 <page_ring_post>
+		return;
+  80263b:	eb d3                	jmp    802610 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  80263d:	50                   	push   %eax
+  80263e:	68 90 53 80 00       	push   $0x805390
+  802643:	68 ac 03 00 00       	push   $0x3ac
+  802648:	68 35 53 80 00       	push   $0x805335
+  80264d:	e8 db db ff ff       	call   80022d <_panic>
+
+00802652 <find_paging_env>:
+	if(pagingenv)
+  802652:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802657:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802659:	85 c0                	test   %eax,%eax
+  80265b:	74 05                	je     802662 <find_paging_env+0x10>
+  80265d:	eb 56                	jmp    8026b5 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  80265f:	83 c0 01             	add    $0x1,%eax
+  802662:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802667:	7f 47                	jg     8026b0 <find_paging_env+0x5e>
+  802669:	83 f9 01             	cmp    $0x1,%ecx
+  80266c:	7f 42                	jg     8026b0 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  80266e:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802671:	c1 e2 06             	shl    $0x6,%edx
+  802674:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80267a:	8b 52 50             	mov    0x50(%edx),%edx
+  80267d:	83 fa 02             	cmp    $0x2,%edx
+  802680:	75 dd                	jne    80265f <find_paging_env+0xd>
+  802682:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802685:	c1 e2 06             	shl    $0x6,%edx
+  802688:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80268e:	8b 52 54             	mov    0x54(%edx),%edx
+  802691:	85 d2                	test   %edx,%edx
+  802693:	74 ca                	je     80265f <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802695:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802698:	c1 e2 06             	shl    $0x6,%edx
+  80269b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8026a1:	8b 52 48             	mov    0x48(%edx),%edx
+  8026a4:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  8026ab:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8026ae:	eb af                	jmp    80265f <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  8026b0:	83 f9 02             	cmp    $0x2,%ecx
+  8026b3:	74 01                	je     8026b6 <find_paging_env+0x64>
+}
+  8026b5:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  8026b6:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8026bb:	8b 40 48             	mov    0x48(%eax),%eax
+  8026be:	83 e0 01             	and    $0x1,%eax
+  8026c1:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  8026c8:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  8026cd:	eb e6                	jmp    8026b5 <find_paging_env+0x63>
+
+008026cf <page_add_backed>:
+{
+  8026cf:	55                   	push   %ebp
+  8026d0:	89 e5                	mov    %esp,%ebp
+  8026d2:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  8026d5:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  8026da:	83 f8 04             	cmp    $0x4,%eax
+  8026dd:	74 35                	je     802714 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  8026df:	89 d1                	mov    %edx,%ecx
+  8026e1:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  8026e7:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  8026ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026f1:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  8026f8:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8026fe:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  802705:	83 c0 01             	add    $0x1,%eax
+  802708:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  80270d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802712:	5d                   	pop    %ebp
+  802713:	c3                   	ret
+		return -E_NO_MEM;
+  802714:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802719:	eb f7                	jmp    802712 <page_add_backed+0x43>
+
+0080271b <percentage_of_pgdir_to_walk>:
+{
+  80271b:	55                   	push   %ebp
+  80271c:	89 e5                	mov    %esp,%ebp
+  80271e:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802721:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802725:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802728:	db 45 fc             	fildl  -0x4(%ebp)
+  80272b:	d8 35 1c 58 80 00    	fdivs  0x80581c
+	return ret*ret;
+  802731:	d8 c8                	fmul   %st(0),%st
+}
+  802733:	c9                   	leave
+  802734:	c3                   	ret
+
+00802735 <nfu_with_aging_page_choice_func>:
+{
+  802735:	55                   	push   %ebp
+  802736:	89 e5                	mov    %esp,%ebp
+  802738:	57                   	push   %edi
+  802739:	56                   	push   %esi
+  80273a:	53                   	push   %ebx
+  80273b:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80273e:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  802744:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802746:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80274b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802750:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802757:	ba 00 00 00 00       	mov    $0x0,%edx
+  80275c:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  80275f:	eb 18                	jmp    802779 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802761:	f7 d0                	not    %eax
+  802763:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802768:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80276a:	83 c2 01             	add    $0x1,%edx
+  80276d:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802773:	0f 87 13 01 00 00    	ja     80288c <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802779:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80277d:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802780:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802785:	89 c1                	mov    %eax,%ecx
+  802787:	c1 e9 0a             	shr    $0xa,%ecx
+  80278a:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802791:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802797:	83 f9 01             	cmp    $0x1,%ecx
+  80279a:	75 c5                	jne    802761 <nfu_with_aging_page_choice_func+0x2c>
+  80279c:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8027a1:	77 be                	ja     802761 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8027a3:	89 c1                	mov    %eax,%ecx
+  8027a5:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8027a8:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  8027ae:	0f 82 a5 00 00 00    	jb     802859 <nfu_with_aging_page_choice_func+0x124>
+  8027b4:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8027ba:	0f 87 99 00 00 00    	ja     802859 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8027c0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8027c7:	f6 c1 01             	test   $0x1,%cl
+  8027ca:	0f 84 89 00 00 00    	je     802859 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027d0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8027d7:	f6 c5 04             	test   $0x4,%ch
+  8027da:	75 7d                	jne    802859 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8027dc:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027e3:	f6 c5 02             	test   $0x2,%ch
+  8027e6:	75 71                	jne    802859 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8027e8:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8027ef:	c1 e9 0c             	shr    $0xc,%ecx
+  8027f2:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8027f5:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8027fb:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8027ff:	66 83 f9 01          	cmp    $0x1,%cx
+  802803:	77 54                	ja     802859 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802805:	89 f9                	mov    %edi,%ecx
+  802807:	80 f9 ff             	cmp    $0xff,%cl
+  80280a:	74 21                	je     80282d <nfu_with_aging_page_choice_func+0xf8>
+  80280c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802813:	c1 e9 0c             	shr    $0xc,%ecx
+  802816:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802819:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80281f:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802823:	89 fb                	mov    %edi,%ebx
+  802825:	38 d9                	cmp    %bl,%cl
+  802827:	73 30                	jae    802859 <nfu_with_aging_page_choice_func+0x124>
+  802829:	dd d8                	fstp   %st(0)
+  80282b:	eb 02                	jmp    80282f <nfu_with_aging_page_choice_func+0xfa>
+  80282d:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  80282f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802836:	c1 e9 0c             	shr    $0xc,%ecx
+  802839:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80283c:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802843:	89 fb                	mov    %edi,%ebx
+  802845:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802848:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80284b:	db 45 e0             	fildl  -0x20(%ebp)
+  80284e:	d8 35 1c 58 80 00    	fdivs  0x80581c
+	return ret*ret;
+  802854:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802856:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802859:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80285c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80285f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802866:	df 6d e0             	fildll -0x20(%ebp)
+  802869:	d9 c1                	fld    %st(1)
+  80286b:	d8 0d 20 58 80 00    	fmuls  0x805820
+  802871:	d9 c9                	fxch   %st(1)
+  802873:	df f1                	fcomip %st(1),%st
+  802875:	dd d8                	fstp   %st(0)
+  802877:	0f 82 ed fe ff ff    	jb     80276a <nfu_with_aging_page_choice_func+0x35>
+  80287d:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  80287f:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  802884:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802887:	c1 e0 0c             	shl    $0xc,%eax
+  80288a:	eb 0e                	jmp    80289a <nfu_with_aging_page_choice_func+0x165>
+  80288c:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  80288e:	89 f8                	mov    %edi,%eax
+  802890:	3c ff                	cmp    $0xff,%al
+  802892:	74 0e                	je     8028a2 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802894:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802897:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80289a:	83 c4 14             	add    $0x14,%esp
+  80289d:	5b                   	pop    %ebx
+  80289e:	5e                   	pop    %esi
+  80289f:	5f                   	pop    %edi
+  8028a0:	5d                   	pop    %ebp
+  8028a1:	c3                   	ret
+	pgnum = 0;
+  8028a2:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  8028a9:	00 00 00 
+	return (void*)UTOP;
+  8028ac:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8028b1:	eb e7                	jmp    80289a <nfu_with_aging_page_choice_func+0x165>
+
+008028b3 <myRand>:
+    state = state * 1664525 + 1013904223;
+  8028b3:	69 05 48 60 80 00 0d 	imul   $0x19660d,0x806048,%eax
+  8028ba:	66 19 00 
+  8028bd:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  8028c2:	a3 48 60 80 00       	mov    %eax,0x806048
+    return state >> 24;
+  8028c7:	c1 e8 18             	shr    $0x18,%eax
+}
+  8028ca:	c3                   	ret
+
+008028cb <random_page_choice_func>:
+{
+  8028cb:	55                   	push   %ebp
+  8028cc:	89 e5                	mov    %esp,%ebp
+  8028ce:	57                   	push   %edi
+  8028cf:	56                   	push   %esi
+  8028d0:	53                   	push   %ebx
+  8028d1:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8028d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8028d9:	eb 19                	jmp    8028f4 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8028db:	f7 d3                	not    %ebx
+  8028dd:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8028e3:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8028e5:	83 c6 01             	add    $0x1,%esi
+  8028e8:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8028ee:	0f 87 a0 00 00 00    	ja     802994 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8028f4:	89 f3                	mov    %esi,%ebx
+  8028f6:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  8028fc:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802902:	89 d8                	mov    %ebx,%eax
+  802904:	c1 e8 0a             	shr    $0xa,%eax
+  802907:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80290e:	25 81 00 00 00       	and    $0x81,%eax
+  802913:	83 f8 01             	cmp    $0x1,%eax
+  802916:	75 c3                	jne    8028db <random_page_choice_func+0x10>
+  802918:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80291e:	77 bb                	ja     8028db <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802920:	89 df                	mov    %ebx,%edi
+  802922:	c1 e7 0c             	shl    $0xc,%edi
+  802925:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802928:	89 f8                	mov    %edi,%eax
+  80292a:	e8 06 f9 ff ff       	call   802235 <page_is_clean>
+  80292f:	84 c0                	test   %al,%al
+  802931:	0f 85 82 00 00 00    	jne    8029b9 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802937:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  80293d:	72 a6                	jb     8028e5 <random_page_choice_func+0x1a>
+  80293f:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802945:	77 9e                	ja     8028e5 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802947:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80294e:	a8 01                	test   $0x1,%al
+  802950:	74 93                	je     8028e5 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802952:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802959:	f6 c4 04             	test   $0x4,%ah
+  80295c:	75 87                	jne    8028e5 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80295e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802965:	f6 c4 02             	test   $0x2,%ah
+  802968:	0f 85 77 ff ff ff    	jne    8028e5 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80296e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802975:	c1 e8 0c             	shr    $0xc,%eax
+  802978:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80297b:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802980:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802984:	66 83 f8 01          	cmp    $0x1,%ax
+  802988:	0f 87 57 ff ff ff    	ja     8028e5 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  80298e:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802994:	e8 1a ff ff ff       	call   8028b3 <myRand>
+  802999:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  80299f:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  8029a4:	29 fe                	sub    %edi,%esi
+  8029a6:	0f be c0             	movsbl %al,%eax
+  8029a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029ae:	f7 f6                	div    %esi
+  8029b0:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8029b2:	bb 15 00 00 00       	mov    $0x15,%ebx
+  8029b7:	eb 1c                	jmp    8029d5 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  8029b9:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  8029bf:	e9 8f 00 00 00       	jmp    802a53 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8029c4:	e8 ea fe ff ff       	call   8028b3 <myRand>
+  8029c9:	0f be c0             	movsbl %al,%eax
+  8029cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029d1:	f7 f6                	div    %esi
+  8029d3:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8029d5:	83 eb 01             	sub    $0x1,%ebx
+  8029d8:	0f 84 c2 00 00 00    	je     802aa0 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  8029de:	89 d0                	mov    %edx,%eax
+  8029e0:	c1 e8 0a             	shr    $0xa,%eax
+  8029e3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8029ea:	25 81 00 00 00       	and    $0x81,%eax
+  8029ef:	83 f8 01             	cmp    $0x1,%eax
+  8029f2:	75 d0                	jne    8029c4 <random_page_choice_func+0xf9>
+  8029f4:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  8029fa:	77 c8                	ja     8029c4 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  8029fc:	89 d0                	mov    %edx,%eax
+  8029fe:	c1 e0 0c             	shl    $0xc,%eax
+  802a01:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  802a06:	72 56                	jb     802a5e <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a08:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  802a0d:	77 65                	ja     802a74 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802a0f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a16:	f6 c1 01             	test   $0x1,%cl
+  802a19:	74 59                	je     802a74 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802a1b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802a22:	f6 c5 04             	test   $0x4,%ch
+  802a25:	75 4d                	jne    802a74 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  802a27:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802a2e:	f6 c5 02             	test   $0x2,%ch
+  802a31:	75 41                	jne    802a74 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  802a33:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802a3a:	c1 ea 0c             	shr    $0xc,%edx
+  802a3d:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  802a40:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  802a46:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  802a4a:	66 83 fa 01          	cmp    $0x1,%dx
+  802a4e:	77 3a                	ja     802a8a <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  802a50:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  802a53:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a56:	83 c4 1c             	add    $0x1c,%esp
+  802a59:	5b                   	pop    %ebx
+  802a5a:	5e                   	pop    %esi
+  802a5b:	5f                   	pop    %edi
+  802a5c:	5d                   	pop    %ebp
+  802a5d:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802a5e:	e8 50 fe ff ff       	call   8028b3 <myRand>
+  802a63:	0f be c0             	movsbl %al,%eax
+  802a66:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a6b:	f7 f6                	div    %esi
+  802a6d:	01 fa                	add    %edi,%edx
+			continue;
+  802a6f:	e9 61 ff ff ff       	jmp    8029d5 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802a74:	e8 3a fe ff ff       	call   8028b3 <myRand>
+  802a79:	0f be c0             	movsbl %al,%eax
+  802a7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a81:	f7 f6                	div    %esi
+  802a83:	01 fa                	add    %edi,%edx
+			continue;
+  802a85:	e9 4b ff ff ff       	jmp    8029d5 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802a8a:	e8 24 fe ff ff       	call   8028b3 <myRand>
+  802a8f:	0f be c0             	movsbl %al,%eax
+  802a92:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a97:	f7 f6                	div    %esi
+  802a99:	01 fa                	add    %edi,%edx
+			continue;
+  802a9b:	e9 35 ff ff ff       	jmp    8029d5 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  802aa0:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  802aa7:	00 00 00 
+	return (void*)UTOP;
+  802aaa:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  802ab1:	eb a0                	jmp    802a53 <random_page_choice_func+0x188>
+
+00802ab3 <nfu>:
+{
+  802ab3:	55                   	push   %ebp
+  802ab4:	89 e5                	mov    %esp,%ebp
+  802ab6:	57                   	push   %edi
+  802ab7:	56                   	push   %esi
+  802ab8:	53                   	push   %ebx
+  802ab9:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802abc:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  802ac2:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802ac4:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802ac9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ace:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802ad5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ada:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802add:	eb 18                	jmp    802af7 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802adf:	f7 d0                	not    %eax
+  802ae1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802ae6:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802ae8:	83 c2 01             	add    $0x1,%edx
+  802aeb:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802af1:	0f 87 13 01 00 00    	ja     802c0a <nfu+0x157>
+		++num_searched_ptes;
+  802af7:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802afb:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802afe:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802b03:	89 c1                	mov    %eax,%ecx
+  802b05:	c1 e9 0a             	shr    $0xa,%ecx
+  802b08:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802b0f:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802b15:	83 f9 01             	cmp    $0x1,%ecx
+  802b18:	75 c5                	jne    802adf <nfu+0x2c>
+  802b1a:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802b1f:	77 be                	ja     802adf <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802b21:	89 c1                	mov    %eax,%ecx
+  802b23:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b26:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802b2c:	0f 82 a5 00 00 00    	jb     802bd7 <nfu+0x124>
+  802b32:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802b38:	0f 87 99 00 00 00    	ja     802bd7 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b3e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b45:	f6 c1 01             	test   $0x1,%cl
+  802b48:	0f 84 89 00 00 00    	je     802bd7 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802b4e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b55:	f6 c5 04             	test   $0x4,%ch
+  802b58:	75 7d                	jne    802bd7 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802b5a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802b61:	f6 c5 02             	test   $0x2,%ch
+  802b64:	75 71                	jne    802bd7 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802b66:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b6d:	c1 e9 0c             	shr    $0xc,%ecx
+  802b70:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b73:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802b79:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802b7d:	66 83 f9 01          	cmp    $0x1,%cx
+  802b81:	77 54                	ja     802bd7 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  802b83:	89 f9                	mov    %edi,%ecx
+  802b85:	80 f9 ff             	cmp    $0xff,%cl
+  802b88:	74 21                	je     802bab <nfu+0xf8>
+  802b8a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b91:	c1 e9 0c             	shr    $0xc,%ecx
+  802b94:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b97:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802b9d:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  802ba1:	89 fb                	mov    %edi,%ebx
+  802ba3:	38 d9                	cmp    %bl,%cl
+  802ba5:	73 30                	jae    802bd7 <nfu+0x124>
+  802ba7:	dd d8                	fstp   %st(0)
+  802ba9:	eb 02                	jmp    802bad <nfu+0xfa>
+  802bab:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  802bad:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802bb4:	c1 e9 0c             	shr    $0xc,%ecx
+  802bb7:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802bba:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802bc1:	89 fb                	mov    %edi,%ebx
+  802bc3:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802bc6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802bc9:	db 45 e0             	fildl  -0x20(%ebp)
+  802bcc:	d8 35 1c 58 80 00    	fdivs  0x80581c
+	return ret*ret;
+  802bd2:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802bd4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802bd7:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802bda:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802bdd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802be4:	df 6d e0             	fildll -0x20(%ebp)
+  802be7:	d9 c1                	fld    %st(1)
+  802be9:	d8 0d 20 58 80 00    	fmuls  0x805820
+  802bef:	d9 c9                	fxch   %st(1)
+  802bf1:	df f1                	fcomip %st(1),%st
+  802bf3:	dd d8                	fstp   %st(0)
+  802bf5:	0f 82 ed fe ff ff    	jb     802ae8 <nfu+0x35>
+  802bfb:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802bfd:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  802c02:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802c05:	c1 e0 0c             	shl    $0xc,%eax
+  802c08:	eb 0e                	jmp    802c18 <nfu+0x165>
+  802c0a:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802c0c:	89 f8                	mov    %edi,%eax
+  802c0e:	3c ff                	cmp    $0xff,%al
+  802c10:	74 0e                	je     802c20 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802c12:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802c15:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802c18:	83 c4 14             	add    $0x14,%esp
+  802c1b:	5b                   	pop    %ebx
+  802c1c:	5e                   	pop    %esi
+  802c1d:	5f                   	pop    %edi
+  802c1e:	5d                   	pop    %ebp
+  802c1f:	c3                   	ret
+	pgnum = 0;
+  802c20:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  802c27:	00 00 00 
+	return (void*)UTOP;
+  802c2a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802c2f:	eb e7                	jmp    802c18 <nfu+0x165>
+
+00802c31 <lru>:
+{
+  802c31:	55                   	push   %ebp
+  802c32:	89 e5                	mov    %esp,%ebp
+  802c34:	57                   	push   %edi
+  802c35:	56                   	push   %esi
+  802c36:	53                   	push   %ebx
+  802c37:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c3a:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  802c40:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  802c47:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802c4e:	be 00 00 00 00       	mov    $0x0,%esi
+  802c53:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c5f:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  802c62:	eb 18                	jmp    802c7c <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802c64:	f7 d0                	not    %eax
+  802c66:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802c6b:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c6d:	83 c2 01             	add    $0x1,%edx
+  802c70:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802c76:	0f 87 fa 00 00 00    	ja     802d76 <lru+0x145>
+		++num_searched_ptes;
+  802c7c:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c7f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802c82:	01 d0                	add    %edx,%eax
+  802c84:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802c89:	89 c1                	mov    %eax,%ecx
+  802c8b:	c1 e9 0a             	shr    $0xa,%ecx
+  802c8e:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802c95:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802c9b:	83 f9 01             	cmp    $0x1,%ecx
+  802c9e:	75 c4                	jne    802c64 <lru+0x33>
+  802ca0:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802ca5:	77 bd                	ja     802c64 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802ca7:	89 c1                	mov    %eax,%ecx
+  802ca9:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802cac:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802cb2:	0f 87 92 00 00 00    	ja     802d4a <lru+0x119>
+  802cb8:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802cbe:	0f 82 86 00 00 00    	jb     802d4a <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802cc4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802ccb:	f6 c1 01             	test   $0x1,%cl
+  802cce:	74 7a                	je     802d4a <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802cd0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802cd7:	f6 c5 04             	test   $0x4,%ch
+  802cda:	75 6e                	jne    802d4a <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802cdc:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802ce3:	f6 c5 02             	test   $0x2,%ch
+  802ce6:	75 62                	jne    802d4a <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802ce8:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802cef:	c1 e9 0c             	shr    $0xc,%ecx
+  802cf2:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802cf5:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802cfb:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802cff:	66 83 f9 01          	cmp    $0x1,%cx
+  802d03:	77 45                	ja     802d4a <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  802d05:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d0c:	c1 e9 0c             	shr    $0xc,%ecx
+  802d0f:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d12:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d18:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802d1b:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802d1e:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  802d21:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802d24:	19 df                	sbb    %ebx,%edi
+  802d26:	7c 22                	jl     802d4a <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  802d28:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d2f:	c1 e9 0c             	shr    $0xc,%ecx
+  802d32:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d35:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d3b:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802d3e:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802d41:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802d44:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d47:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802d4a:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  802d4d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802d54:	df 6d e0             	fildll -0x20(%ebp)
+  802d57:	d9 05 20 58 80 00    	flds   0x805820
+  802d5d:	d9 c9                	fxch   %st(1)
+  802d5f:	df f1                	fcomip %st(1),%st
+  802d61:	dd d8                	fstp   %st(0)
+  802d63:	0f 82 04 ff ff ff    	jb     802c6d <lru+0x3c>
+			pgnum = pgnum_actual;
+  802d69:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  802d6e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d71:	c1 e0 0c             	shl    $0xc,%eax
+  802d74:	eb 06                	jmp    802d7c <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  802d76:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d79:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802d7c:	83 c4 1c             	add    $0x1c,%esp
+  802d7f:	5b                   	pop    %ebx
+  802d80:	5e                   	pop    %esi
+  802d81:	5f                   	pop    %edi
+  802d82:	5d                   	pop    %ebp
+  802d83:	c3                   	ret
+
+00802d84 <set_page_choice_func>:
+{
+  802d84:	55                   	push   %ebp
+  802d85:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  802d87:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d8a:	a3 44 60 80 00       	mov    %eax,0x806044
+}
+  802d8f:	5d                   	pop    %ebp
+  802d90:	c3                   	ret
+
+00802d91 <get_page_choice>:
+{
+  802d91:	55                   	push   %ebp
+  802d92:	89 e5                	mov    %esp,%ebp
+  802d94:	57                   	push   %edi
+  802d95:	56                   	push   %esi
+  802d96:	53                   	push   %ebx
+  802d97:	83 ec 24             	sub    $0x24,%esp
+  802d9a:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d9d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  802da0:	57                   	push   %edi
+  802da1:	56                   	push   %esi
+  802da2:	ff 15 44 60 80 00    	call   *0x806044
+  802da8:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802daa:	83 c4 10             	add    $0x10,%esp
+  802dad:	eb 25                	jmp    802dd4 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  802daf:	83 ec 08             	sub    $0x8,%esp
+  802db2:	c1 e0 16             	shl    $0x16,%eax
+  802db5:	50                   	push   %eax
+  802db6:	6a 00                	push   $0x0
+  802db8:	e8 ec e0 ff ff       	call   800ea9 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802dbd:	83 c4 10             	add    $0x10,%esp
+  802dc0:	85 c0                	test   %eax,%eax
+  802dc2:	75 43                	jne    802e07 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  802dc4:	83 ec 08             	sub    $0x8,%esp
+  802dc7:	57                   	push   %edi
+  802dc8:	56                   	push   %esi
+  802dc9:	ff 15 44 60 80 00    	call   *0x806044
+  802dcf:	89 c3                	mov    %eax,%ebx
+  802dd1:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802dd4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802dd7:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  802ddd:	0f 86 ae 00 00 00    	jbe    802e91 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802de3:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  802de8:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802def:	81 e2 81 00 00 00    	and    $0x81,%edx
+  802df5:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  802dfb:	74 b2                	je     802daf <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802dfd:	83 c0 01             	add    $0x1,%eax
+  802e00:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  802e05:	75 e1                	jne    802de8 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802e07:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e0a:	05 00 10 40 11       	add    $0x11401000,%eax
+  802e0f:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802e14:	76 1f                	jbe    802e35 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  802e16:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  802e1b:	89 d8                	mov    %ebx,%eax
+  802e1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e20:	5b                   	pop    %ebx
+  802e21:	5e                   	pop    %esi
+  802e22:	5f                   	pop    %edi
+  802e23:	5d                   	pop    %ebp
+  802e24:	c3                   	ret
+		sys_page_split(0, pg_out);
+  802e25:	83 ec 08             	sub    $0x8,%esp
+  802e28:	53                   	push   %ebx
+  802e29:	6a 00                	push   $0x0
+  802e2b:	e8 79 e0 ff ff       	call   800ea9 <sys_page_split>
+  802e30:	83 c4 10             	add    $0x10,%esp
+  802e33:	eb 6c                	jmp    802ea1 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  802e35:	83 ec 04             	sub    $0x4,%esp
+  802e38:	68 c8 53 80 00       	push   $0x8053c8
+  802e3d:	68 cc 01 00 00       	push   $0x1cc
+  802e42:	68 35 53 80 00       	push   $0x805335
+  802e47:	e8 e1 d3 ff ff       	call   80022d <_panic>
+		panic("We tried to page out code pages\n");
+  802e4c:	83 ec 04             	sub    $0x4,%esp
+  802e4f:	68 f8 53 80 00       	push   $0x8053f8
+  802e54:	68 d6 01 00 00       	push   $0x1d6
+  802e59:	68 35 53 80 00       	push   $0x805335
+  802e5e:	e8 ca d3 ff ff       	call   80022d <_panic>
+		panic("Invalid mapping for the va\n");
+  802e63:	83 ec 04             	sub    $0x4,%esp
+  802e66:	68 42 53 80 00       	push   $0x805342
+  802e6b:	68 da 01 00 00       	push   $0x1da
+  802e70:	68 35 53 80 00       	push   $0x805335
+  802e75:	e8 b3 d3 ff ff       	call   80022d <_panic>
+		panic("We tried to page out a shared page\n");
+  802e7a:	83 ec 04             	sub    $0x4,%esp
+  802e7d:	68 1c 54 80 00       	push   $0x80541c
+  802e82:	68 e0 01 00 00       	push   $0x1e0
+  802e87:	68 35 53 80 00       	push   $0x805335
+  802e8c:	e8 9c d3 ff ff       	call   80022d <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  802e91:	89 de                	mov    %ebx,%esi
+  802e93:	c1 ee 16             	shr    $0x16,%esi
+  802e96:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802e9d:	a8 80                	test   $0x80,%al
+  802e9f:	75 84                	jne    802e25 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802ea1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ea4:	05 00 10 40 11       	add    $0x11401000,%eax
+  802ea9:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802eae:	76 85                	jbe    802e35 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  802eb0:	89 d8                	mov    %ebx,%eax
+  802eb2:	e8 7e f3 ff ff       	call   802235 <page_is_clean>
+  802eb7:	84 c0                	test   %al,%al
+  802eb9:	0f 85 5c ff ff ff    	jne    802e1b <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  802ebf:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  802ec6:	76 84                	jbe    802e4c <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  802ec8:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802ecf:	a8 01                	test   $0x1,%al
+  802ed1:	74 90                	je     802e63 <get_page_choice+0xd2>
+  802ed3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ed6:	c1 e8 0c             	shr    $0xc,%eax
+  802ed9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802ee0:	f6 c2 01             	test   $0x1,%dl
+  802ee3:	0f 84 7a ff ff ff    	je     802e63 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802ee9:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  802ef0:	f6 c2 01             	test   $0x1,%dl
+  802ef3:	74 85                	je     802e7a <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802ef5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802efc:	f6 c2 01             	test   $0x1,%dl
+  802eff:	0f 84 75 ff ff ff    	je     802e7a <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802f05:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802f0c:	f6 c6 04             	test   $0x4,%dh
+  802f0f:	0f 85 65 ff ff ff    	jne    802e7a <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  802f15:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802f1c:	f6 c6 02             	test   $0x2,%dh
+  802f1f:	0f 85 55 ff ff ff    	jne    802e7a <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  802f25:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f2c:	c1 e8 0c             	shr    $0xc,%eax
+  802f2f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802f32:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802f37:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802f3b:	66 83 f8 01          	cmp    $0x1,%ax
+  802f3f:	0f 86 d6 fe ff ff    	jbe    802e1b <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  802f45:	83 ec 04             	sub    $0x4,%esp
+  802f48:	68 40 54 80 00       	push   $0x805440
+  802f4d:	68 e2 01 00 00       	push   $0x1e2
+  802f52:	68 35 53 80 00       	push   $0x805335
+  802f57:	e8 d1 d2 ff ff       	call   80022d <_panic>
+
+00802f5c <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  802f5c:	55                   	push   %ebp
+  802f5d:	89 e5                	mov    %esp,%ebp
+  802f5f:	57                   	push   %edi
+  802f60:	56                   	push   %esi
+  802f61:	53                   	push   %ebx
+  802f62:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  802f65:	e8 e8 f6 ff ff       	call   802652 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  802f6a:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802f6f:	85 c0                	test   %eax,%eax
+  802f71:	74 41                	je     802fb4 <page_share_paged_out+0x58>
+  802f73:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  802f7a:	0f 84 fd 00 00 00    	je     80307d <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  802f80:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802f87:	00 00 00 
+  802f8a:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  802f91:	00 00 00 
+  802f94:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f99:	eb 2c                	jmp    802fc7 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802f9b:	83 c3 04             	add    $0x4,%ebx
+  802f9e:	39 f3                	cmp    %esi,%ebx
+  802fa0:	74 1a                	je     802fbc <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  802fa2:	8b 03                	mov    (%ebx),%eax
+  802fa4:	a8 01                	test   $0x1,%al
+  802fa6:	74 f3                	je     802f9b <page_share_paged_out+0x3f>
+  802fa8:	c1 e8 0c             	shr    $0xc,%eax
+  802fab:	e8 2b f5 ff ff       	call   8024db <page_share_slot>
+  802fb0:	85 c0                	test   %eax,%eax
+  802fb2:	79 e7                	jns    802f9b <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  802fb4:	83 c4 0c             	add    $0xc,%esp
+  802fb7:	5b                   	pop    %ebx
+  802fb8:	5e                   	pop    %esi
+  802fb9:	5f                   	pop    %edi
+  802fba:	5d                   	pop    %ebp
+  802fbb:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  802fbc:	83 c7 04             	add    $0x4,%edi
+  802fbf:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  802fc5:	74 1b                	je     802fe2 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  802fc7:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  802fcc:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  802fcf:	f6 c3 01             	test   $0x1,%bl
+  802fd2:	74 e8                	je     802fbc <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  802fd4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802fda:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  802fe0:	eb bc                	jmp    802f9e <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802fe2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fe7:	eb 11                	jmp    802ffa <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  802fe9:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802fef:	83 c3 01             	add    $0x1,%ebx
+  802ff2:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802ff8:	77 41                	ja     80303b <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  802ffa:	89 d8                	mov    %ebx,%eax
+  802ffc:	c1 e8 0a             	shr    $0xa,%eax
+  802fff:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803006:	25 81 00 00 00       	and    $0x81,%eax
+  80300b:	83 f8 01             	cmp    $0x1,%eax
+  80300e:	75 d9                	jne    802fe9 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803010:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803017:	25 81 00 00 00       	and    $0x81,%eax
+  80301c:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803021:	75 cc                	jne    802fef <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803023:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80302a:	c1 e8 0c             	shr    $0xc,%eax
+  80302d:	e8 a9 f4 ff ff       	call   8024db <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803032:	85 c0                	test   %eax,%eax
+  803034:	79 b9                	jns    802fef <page_share_paged_out+0x93>
+  803036:	e9 79 ff ff ff       	jmp    802fb4 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80303b:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803042:	75 13                	jne    803057 <page_share_paged_out+0xfb>
+  803044:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80304b:	75 1d                	jne    80306a <page_share_paged_out+0x10e>
+	return 0;
+  80304d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803052:	e9 5d ff ff ff       	jmp    802fb4 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803057:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305c:	e8 46 f4 ff ff       	call   8024a7 <page_share_send>
+  803061:	85 c0                	test   %eax,%eax
+  803063:	79 df                	jns    803044 <page_share_paged_out+0xe8>
+  803065:	e9 4a ff ff ff       	jmp    802fb4 <page_share_paged_out+0x58>
+  80306a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80306f:	e8 33 f4 ff ff       	call   8024a7 <page_share_send>
+  803074:	85 c0                	test   %eax,%eax
+  803076:	79 d5                	jns    80304d <page_share_paged_out+0xf1>
+  803078:	e9 37 ff ff ff       	jmp    802fb4 <page_share_paged_out+0x58>
+		return 0;
+  80307d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803082:	e9 2d ff ff ff       	jmp    802fb4 <page_share_paged_out+0x58>
+
+00803087 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  803087:	55                   	push   %ebp
+  803088:	89 e5                	mov    %esp,%ebp
+  80308a:	56                   	push   %esi
+  80308b:	53                   	push   %ebx
+  80308c:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  80308f:	e8 be f5 ff ff       	call   802652 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  803094:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  803099:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8030a0:	0f 84 82 00 00 00    	je     803128 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  8030a6:	83 ec 0c             	sub    $0xc,%esp
+  8030a9:	68 00 10 00 00       	push   $0x1000
+  8030ae:	e8 84 11 00 00       	call   804237 <malloc>
+  8030b3:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  8030b5:	83 c4 0c             	add    $0xc,%esp
+  8030b8:	6a 14                	push   $0x14
+  8030ba:	6a 00                	push   $0x0
+  8030bc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8030bf:	50                   	push   %eax
+  8030c0:	e8 7b d9 ff ff       	call   800a40 <memset>
+  8030c5:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  8030c8:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  8030cd:	83 ec 0c             	sub    $0xc,%esp
+  8030d0:	6a 07                	push   $0x7
+  8030d2:	6a 01                	push   $0x1
+  8030d4:	53                   	push   %ebx
+  8030d5:	6a 03                	push   $0x3
+  8030d7:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8030de:	e8 b7 19 00 00       	call   804a9a <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  8030e3:	8b 03                	mov    (%ebx),%eax
+  8030e5:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  8030e8:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030eb:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  8030ee:	8b 43 08             	mov    0x8(%ebx),%eax
+  8030f1:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  8030f4:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8030f7:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  8030fa:	8b 43 10             	mov    0x10(%ebx),%eax
+  8030fd:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803100:	83 c6 01             	add    $0x1,%esi
+  803103:	83 c4 20             	add    $0x20,%esp
+  803106:	83 fe 02             	cmp    $0x2,%esi
+  803109:	75 c2                	jne    8030cd <get_paging_stats+0x46>
+	}
+	*stats = total;
+  80310b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80310e:	89 03                	mov    %eax,(%ebx)
+  803110:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803113:	89 43 04             	mov    %eax,0x4(%ebx)
+  803116:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803119:	89 43 08             	mov    %eax,0x8(%ebx)
+  80311c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80311f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803122:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803125:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  803128:	89 d8                	mov    %ebx,%eax
+  80312a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80312d:	5b                   	pop    %ebx
+  80312e:	5e                   	pop    %esi
+  80312f:	5d                   	pop    %ebp
+  803130:	c3                   	ret
+
+00803131 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803131:	55                   	push   %ebp
+  803132:	89 e5                	mov    %esp,%ebp
+  803134:	53                   	push   %ebx
+  803135:	83 ec 10             	sub    $0x10,%esp
+  803138:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  80313b:	68 5a 4e 80 00       	push   $0x804e5a
+  803140:	e8 c3 d1 ff ff       	call   800308 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  803145:	83 c4 08             	add    $0x8,%esp
+  803148:	ff 33                	push   (%ebx)
+  80314a:	68 74 54 80 00       	push   $0x805474
+  80314f:	e8 b4 d1 ff ff       	call   800308 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  803154:	83 c4 08             	add    $0x8,%esp
+  803157:	ff 73 04             	push   0x4(%ebx)
+  80315a:	68 5e 53 80 00       	push   $0x80535e
+  80315f:	e8 a4 d1 ff ff       	call   800308 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  803164:	83 c4 08             	add    $0x8,%esp
+  803167:	ff 73 08             	push   0x8(%ebx)
+  80316a:	68 94 54 80 00       	push   $0x805494
+  80316f:	e8 94 d1 ff ff       	call   800308 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  803174:	83 c4 08             	add    $0x8,%esp
+  803177:	ff 73 0c             	push   0xc(%ebx)
+  80317a:	68 b8 54 80 00       	push   $0x8054b8
+  80317f:	e8 84 d1 ff ff       	call   800308 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  803184:	83 c4 08             	add    $0x8,%esp
+  803187:	ff 73 10             	push   0x10(%ebx)
+  80318a:	68 dc 54 80 00       	push   $0x8054dc
+  80318f:	e8 74 d1 ff ff       	call   800308 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  803194:	83 c4 08             	add    $0x8,%esp
+  803197:	ff 35 08 b0 80 00    	push   0x80b008
+  80319d:	68 18 55 80 00       	push   $0x805518
+  8031a2:	e8 61 d1 ff ff       	call   800308 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  8031a7:	83 c4 08             	add    $0x8,%esp
+  8031aa:	ff 35 04 b0 80 00    	push   0x80b004
+  8031b0:	68 4c 55 80 00       	push   $0x80554c
+  8031b5:	e8 4e d1 ff ff       	call   800308 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  8031ba:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8031bf:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  8031c2:	8b 50 68             	mov    0x68(%eax),%edx
+  8031c5:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  8031c8:	51                   	push   %ecx
+  8031c9:	52                   	push   %edx
+  8031ca:	50                   	push   %eax
+  8031cb:	68 8c 55 80 00       	push   $0x80558c
+  8031d0:	e8 33 d1 ff ff       	call   800308 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  8031d5:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8031da:	8b 40 70             	mov    0x70(%eax),%eax
+  8031dd:	83 c4 18             	add    $0x18,%esp
+  8031e0:	50                   	push   %eax
+  8031e1:	68 c0 55 80 00       	push   $0x8055c0
+  8031e6:	e8 1d d1 ff ff       	call   800308 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  8031eb:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  8031f1:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  8031f7:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  8031fc:	51                   	push   %ecx
+  8031fd:	52                   	push   %edx
+  8031fe:	50                   	push   %eax
+  8031ff:	68 f0 55 80 00       	push   $0x8055f0
+  803204:	e8 ff d0 ff ff       	call   800308 <cprintf>
+	cprintf("\n");
+  803209:	83 c4 14             	add    $0x14,%esp
+  80320c:	68 5a 4e 80 00       	push   $0x804e5a
+  803211:	e8 f2 d0 ff ff       	call   800308 <cprintf>
+}
+  803216:	83 c4 10             	add    $0x10,%esp
+  803219:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80321c:	c9                   	leave
+  80321d:	c3                   	ret
+
+0080321e <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  80321e:	55                   	push   %ebp
+  80321f:	89 e5                	mov    %esp,%ebp
+  803221:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  803224:	e8 5e fe ff ff       	call   803087 <get_paging_stats>
+  803229:	83 ec 0c             	sub    $0xc,%esp
+  80322c:	50                   	push   %eax
+  80322d:	e8 ff fe ff ff       	call   803131 <print_paging_stats>
+}
+  803232:	83 c4 10             	add    $0x10,%esp
+  803235:	c9                   	leave
+  803236:	c3                   	ret
+
+00803237 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803237:	55                   	push   %ebp
+  803238:	89 e5                	mov    %esp,%ebp
+  80323a:	53                   	push   %ebx
+  80323b:	83 ec 04             	sub    $0x4,%esp
+  80323e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803241:	eb 13                	jmp    803256 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803243:	83 ec 04             	sub    $0x4,%esp
+  803246:	6a ff                	push   $0xffffffff
+  803248:	53                   	push   %ebx
+  803249:	68 00 f0 ff ee       	push   $0xeefff000
+  80324e:	e8 68 e0 ff ff       	call   8012bb <sys_futex_wait>
+  803253:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803256:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  80325b:	39 d8                	cmp    %ebx,%eax
+  80325d:	74 e4                	je     803243 <mem_pressure_wait+0xc>
+	return now;
+}
+  80325f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803262:	c9                   	leave
+  803263:	c3                   	ret
+
+00803264 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803264:	55                   	push   %ebp
+  803265:	89 e5                	mov    %esp,%ebp
+  803267:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  80326a:	68 d6 3e 80 00       	push   $0x803ed6
+  80326f:	e8 32 16 00 00       	call   8048a6 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803274:	c7 05 14 e9 80 00 00 	movl   $0xdeadb000,0x80e914
+  80327b:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  80327e:	83 c4 0c             	add    $0xc,%esp
+  803281:	68 07 02 00 00       	push   $0x207
+  803286:	68 00 b0 ad de       	push   $0xdeadb000
+  80328b:	6a 00                	push   $0x0
+  80328d:	e8 50 db ff ff       	call   800de2 <sys_page_alloc>
+  803292:	83 c4 10             	add    $0x10,%esp
+  803295:	85 c0                	test   %eax,%eax
+  803297:	78 0c                	js     8032a5 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  803299:	e8 b4 f3 ff ff       	call   802652 <find_paging_env>
+	page_ring_ready();
+  80329e:	e8 7f f2 ff ff       	call   802522 <page_ring_ready>
+}
+  8032a3:	c9                   	leave
+  8032a4:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  8032a5:	50                   	push   %eax
+  8032a6:	68 7c 53 80 00       	push   $0x80537c
+  8032ab:	68 13 05 00 00       	push   $0x513
+  8032b0:	68 35 53 80 00       	push   $0x805335
+  8032b5:	e8 73 cf ff ff       	call   80022d <_panic>
+
+008032ba <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  8032ba:	55                   	push   %ebp
+  8032bb:	89 e5                	mov    %esp,%ebp
+  8032bd:	57                   	push   %edi
+  8032be:	56                   	push   %esi
+  8032bf:	53                   	push   %ebx
+  8032c0:	83 ec 0c             	sub    $0xc,%esp
+  8032c3:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  8032c6:	89 fa                	mov    %edi,%edx
+  8032c8:	c1 ea 16             	shr    $0x16,%edx
+  8032cb:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8032d0:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  8032d3:	f6 06 01             	testb  $0x1,(%esi)
+  8032d6:	75 3e                	jne    803316 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  8032d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  8032dd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8032e1:	74 47                	je     80332a <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  8032e3:	83 ec 0c             	sub    $0xc,%esp
+  8032e6:	6a 01                	push   $0x1
+  8032e8:	e8 f2 11 00 00       	call   8044df <va_alloc>
+  8032ed:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  8032ef:	83 c4 10             	add    $0x10,%esp
+  8032f2:	85 c0                	test   %eax,%eax
+  8032f4:	74 34                	je     80332a <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  8032f6:	6a 00                	push   $0x0
+  8032f8:	68 07 02 00 00       	push   $0x207
+  8032fd:	50                   	push   %eax
+  8032fe:	6a 00                	push   $0x0
+  803300:	e8 df 02 00 00       	call   8035e4 <page_alloc>
+  803305:	83 c4 10             	add    $0x10,%esp
+  803308:	85 c0                	test   %eax,%eax
+  80330a:	78 28                	js     803334 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  80330c:	f6 06 01             	testb  $0x1,(%esi)
+  80330f:	75 38                	jne    803349 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803311:	83 cb 01             	or     $0x1,%ebx
+  803314:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803316:	89 f8                	mov    %edi,%eax
+  803318:	c1 e8 0a             	shr    $0xa,%eax
+  80331b:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803320:	8b 1e                	mov    (%esi),%ebx
+  803322:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803328:	01 c3                	add    %eax,%ebx
+}
+  80332a:	89 d8                	mov    %ebx,%eax
+  80332c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80332f:	5b                   	pop    %ebx
+  803330:	5e                   	pop    %esi
+  803331:	5f                   	pop    %edi
+  803332:	5d                   	pop    %ebp
+  803333:	c3                   	ret
+			va_free(page, 1);
+  803334:	83 ec 08             	sub    $0x8,%esp
+  803337:	6a 01                	push   $0x1
+  803339:	53                   	push   %ebx
+  80333a:	e8 d8 12 00 00       	call   804617 <va_free>
+			return NULL;
+  80333f:	83 c4 10             	add    $0x10,%esp
+  803342:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803347:	eb e1                	jmp    80332a <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  803349:	83 ec 08             	sub    $0x8,%esp
+  80334c:	53                   	push   %ebx
+  80334d:	6a 00                	push   $0x0
+  80334f:	e8 13 db ff ff       	call   800e67 <sys_page_unmap>
+			va_free(page, 1);
+  803354:	83 c4 08             	add    $0x8,%esp
+  803357:	6a 01                	push   $0x1
+  803359:	53                   	push   %ebx
+  80335a:	e8 b8 12 00 00       	call   804617 <va_free>
+  80335f:	83 c4 10             	add    $0x10,%esp
+  803362:	eb b2                	jmp    803316 <umapdir_walk+0x5c>
+
+00803364 <page_out>:
+{
+  803364:	55                   	push   %ebp
+  803365:	89 e5                	mov    %esp,%ebp
+  803367:	57                   	push   %edi
+  803368:	56                   	push   %esi
+  803369:	53                   	push   %ebx
+  80336a:	83 ec 5c             	sub    $0x5c,%esp
+  80336d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803370:	e8 dd f2 ff ff       	call   802652 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803375:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80337a:	85 c0                	test   %eax,%eax
+  80337c:	74 1e                	je     80339c <page_out+0x38>
+  80337e:	83 ec 0c             	sub    $0xc,%esp
+  803381:	6a 00                	push   $0x0
+  803383:	6a 00                	push   $0x0
+  803385:	6a 00                	push   $0x0
+  803387:	6a 08                	push   $0x8
+  803389:	50                   	push   %eax
+  80338a:	e8 0b 17 00 00       	call   804a9a <ipc_call>
+  80338f:	89 c3                	mov    %eax,%ebx
+  803391:	83 c4 20             	add    $0x20,%esp
+  803394:	85 c0                	test   %eax,%eax
+  803396:	0f 84 ac 00 00 00    	je     803448 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  80339c:	83 ec 08             	sub    $0x8,%esp
+  80339f:	ff 75 0c             	push   0xc(%ebp)
+  8033a2:	57                   	push   %edi
+  8033a3:	e8 e9 f9 ff ff       	call   802d91 <get_page_choice>
+  8033a8:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  8033aa:	83 c4 10             	add    $0x10,%esp
+  8033ad:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8033b2:	0f 84 18 02 00 00    	je     8035d0 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  8033b8:	e8 78 ee ff ff       	call   802235 <page_is_clean>
+  8033bd:	84 c0                	test   %al,%al
+  8033bf:	0f 85 8c 00 00 00    	jne    803451 <page_out+0xed>
+	if (pagingenv == 0)
+  8033c5:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8033cc:	0f 84 08 02 00 00    	je     8035da <page_out+0x276>
+	if (page_ring_ready())
+  8033d2:	e8 4b f1 ff ff       	call   802522 <page_ring_ready>
+  8033d7:	89 c3                	mov    %eax,%ebx
+  8033d9:	85 c0                	test   %eax,%eax
+  8033db:	0f 85 89 00 00 00    	jne    80346a <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  8033e1:	83 ec 0c             	sub    $0xc,%esp
+  8033e4:	6a 05                	push   $0x5
+  8033e6:	6a 01                	push   $0x1
+  8033e8:	56                   	push   %esi
+  8033e9:	6a 01                	push   $0x1
+  8033eb:	ff 35 40 b0 80 00    	push   0x80b040
+  8033f1:	e8 a4 16 00 00       	call   804a9a <ipc_call>
+  8033f6:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  8033f8:	83 c4 20             	add    $0x20,%esp
+  8033fb:	85 c0                	test   %eax,%eax
+  8033fd:	0f 88 b8 01 00 00    	js     8035bb <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803403:	89 f0                	mov    %esi,%eax
+  803405:	c1 e8 0c             	shr    $0xc,%eax
+  803408:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80340f:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803412:	83 ec 08             	sub    $0x8,%esp
+  803415:	56                   	push   %esi
+  803416:	6a 00                	push   $0x0
+  803418:	e8 4a da ff ff       	call   800e67 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  80341d:	83 c4 08             	add    $0x8,%esp
+  803420:	6a 01                	push   $0x1
+  803422:	56                   	push   %esi
+  803423:	e8 92 fe ff ff       	call   8032ba <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803428:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  80342b:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803431:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803434:	09 fe                	or     %edi,%esi
+  803436:	83 ce 01             	or     $0x1,%esi
+  803439:	89 30                	mov    %esi,(%eax)
+	return 0;
+  80343b:	83 c4 10             	add    $0x10,%esp
+}
+  80343e:	89 d8                	mov    %ebx,%eax
+  803440:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803443:	5b                   	pop    %ebx
+  803444:	5e                   	pop    %esi
+  803445:	5f                   	pop    %edi
+  803446:	5d                   	pop    %ebp
+  803447:	c3                   	ret
+		num_page_reclaims++;
+  803448:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  80344f:	eb ed                	jmp    80343e <page_out+0xda>
+		num_page_drops++;
+  803451:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  803458:	83 ec 08             	sub    $0x8,%esp
+  80345b:	56                   	push   %esi
+  80345c:	6a 00                	push   $0x0
+  80345e:	e8 04 da ff ff       	call   800e67 <sys_page_unmap>
+  803463:	89 c3                	mov    %eax,%ebx
+  803465:	83 c4 10             	add    $0x10,%esp
+  803468:	eb d4                	jmp    80343e <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80346a:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  80346c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803471:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803476:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803479:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  80347b:	83 c0 08             	add    $0x8,%eax
+  80347e:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803481:	b8 07 00 00 00       	mov    $0x7,%eax
+  803486:	e8 e5 ef ff ff       	call   802470 <page_ring_reserve>
+	first = ring->sq_tail;
+  80348b:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803490:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803493:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803498:	83 ec 04             	sub    $0x4,%esp
+  80349b:	68 00 10 00 00       	push   $0x1000
+  8034a0:	56                   	push   %esi
+  8034a1:	89 d8                	mov    %ebx,%eax
+  8034a3:	c1 e0 0c             	shl    $0xc,%eax
+  8034a6:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  8034ab:	50                   	push   %eax
+  8034ac:	e8 26 d6 ff ff       	call   800ad7 <memcpy>
+		vas[n] = va;
+  8034b1:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  8034b5:	89 d9                	mov    %ebx,%ecx
+  8034b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034c1:	e8 de ee ff ff       	call   8023a4 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  8034c6:	8d 43 01             	lea    0x1(%ebx),%eax
+  8034c9:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  8034cc:	83 c4 10             	add    $0x10,%esp
+  8034cf:	83 fb 06             	cmp    $0x6,%ebx
+  8034d2:	74 62                	je     803536 <page_out+0x1d2>
+  8034d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8034d7:	eb 15                	jmp    8034ee <page_out+0x18a>
+			num_page_drops++;
+  8034d9:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  8034e0:	83 ec 08             	sub    $0x8,%esp
+  8034e3:	56                   	push   %esi
+  8034e4:	6a 00                	push   $0x0
+  8034e6:	e8 7c d9 ff ff       	call   800e67 <sys_page_unmap>
+  8034eb:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  8034ee:	83 ec 08             	sub    $0x8,%esp
+  8034f1:	53                   	push   %ebx
+  8034f2:	57                   	push   %edi
+  8034f3:	e8 99 f8 ff ff       	call   802d91 <get_page_choice>
+  8034f8:	89 c6                	mov    %eax,%esi
+  8034fa:	83 c4 10             	add    $0x10,%esp
+  8034fd:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803502:	74 32                	je     803536 <page_out+0x1d2>
+  803504:	e8 2c ed ff ff       	call   802235 <page_is_clean>
+  803509:	84 c0                	test   %al,%al
+  80350b:	75 cc                	jne    8034d9 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  80350d:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803510:	39 c6                	cmp    %eax,%esi
+  803512:	72 07                	jb     80351b <page_out+0x1b7>
+  803514:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803517:	39 c6                	cmp    %eax,%esi
+  803519:	72 1b                	jb     803536 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  80351b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803520:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803523:	eb 03                	jmp    803528 <page_out+0x1c4>
+  803525:	83 c3 01             	add    $0x1,%ebx
+  803528:	39 da                	cmp    %ebx,%edx
+  80352a:	0f 84 68 ff ff ff    	je     803498 <page_out+0x134>
+  803530:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803534:	75 ef                	jne    803525 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803536:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803539:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  80353c:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  80353f:	e8 a6 ee ff ff       	call   8023ea <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803544:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803549:	eb 42                	jmp    80358d <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  80354b:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  80354f:	89 f8                	mov    %edi,%eax
+  803551:	c1 e8 0c             	shr    $0xc,%eax
+  803554:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80355b:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  80355e:	83 ec 08             	sub    $0x8,%esp
+  803561:	57                   	push   %edi
+  803562:	6a 00                	push   $0x0
+  803564:	e8 fe d8 ff ff       	call   800e67 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803569:	83 c4 08             	add    $0x8,%esp
+  80356c:	6a 01                	push   $0x1
+  80356e:	57                   	push   %edi
+  80356f:	e8 46 fd ff ff       	call   8032ba <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803574:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803577:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  80357d:	c1 e6 0c             	shl    $0xc,%esi
+  803580:	09 d6                	or     %edx,%esi
+  803582:	83 ce 01             	or     $0x1,%esi
+  803585:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803587:	83 c3 01             	add    $0x1,%ebx
+  80358a:	83 c4 10             	add    $0x10,%esp
+  80358d:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803590:	39 c3                	cmp    %eax,%ebx
+  803592:	74 1d                	je     8035b1 <page_out+0x24d>
+		if (res[i] < 0)
+  803594:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803598:	85 f6                	test   %esi,%esi
+  80359a:	79 af                	jns    80354b <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  80359c:	56                   	push   %esi
+  80359d:	68 20 56 80 00       	push   $0x805620
+  8035a2:	68 d1 02 00 00       	push   $0x2d1
+  8035a7:	68 35 53 80 00       	push   $0x805335
+  8035ac:	e8 7c cc ff ff       	call   80022d <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  8035b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035b6:	e9 83 fe ff ff       	jmp    80343e <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  8035bb:	50                   	push   %eax
+  8035bc:	68 20 56 80 00       	push   $0x805620
+  8035c1:	68 0a 03 00 00       	push   $0x30a
+  8035c6:	68 35 53 80 00       	push   $0x805335
+  8035cb:	e8 5d cc ff ff       	call   80022d <_panic>
+		return -E_NO_MEM;
+  8035d0:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  8035d5:	e9 64 fe ff ff       	jmp    80343e <page_out+0xda>
+		return -E_PAGING;
+  8035da:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8035df:	e9 5a fe ff ff       	jmp    80343e <page_out+0xda>
+
+008035e4 <page_alloc>:
+{
+  8035e4:	55                   	push   %ebp
+  8035e5:	89 e5                	mov    %esp,%ebp
+  8035e7:	57                   	push   %edi
+  8035e8:	56                   	push   %esi
+  8035e9:	53                   	push   %ebx
+  8035ea:	83 ec 0c             	sub    $0xc,%esp
+  8035ed:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035f0:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  8035f3:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  8035fa:	74 34                	je     803630 <page_alloc+0x4c>
+	if (check_mte)
+  8035fc:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803600:	75 35                	jne    803637 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803602:	83 ec 04             	sub    $0x4,%esp
+  803605:	ff 75 10             	push   0x10(%ebp)
+  803608:	56                   	push   %esi
+  803609:	57                   	push   %edi
+  80360a:	e8 d3 d7 ff ff       	call   800de2 <sys_page_alloc>
+  80360f:	89 c3                	mov    %eax,%ebx
+  803611:	83 c4 10             	add    $0x10,%esp
+  803614:	85 c0                	test   %eax,%eax
+  803616:	79 52                	jns    80366a <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803618:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80361b:	75 52                	jne    80366f <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  80361d:	83 ec 08             	sub    $0x8,%esp
+  803620:	56                   	push   %esi
+  803621:	57                   	push   %edi
+  803622:	e8 3d fd ff ff       	call   803364 <page_out>
+  803627:	83 c4 10             	add    $0x10,%esp
+  80362a:	85 c0                	test   %eax,%eax
+  80362c:	79 d4                	jns    803602 <page_alloc+0x1e>
+  80362e:	eb 3f                	jmp    80366f <page_alloc+0x8b>
+		init_map_dir();
+  803630:	e8 2f fc ff ff       	call   803264 <init_map_dir>
+  803635:	eb c5                	jmp    8035fc <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803637:	83 ec 08             	sub    $0x8,%esp
+  80363a:	6a 00                	push   $0x0
+  80363c:	56                   	push   %esi
+  80363d:	e8 78 fc ff ff       	call   8032ba <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803642:	83 c4 10             	add    $0x10,%esp
+  803645:	85 c0                	test   %eax,%eax
+  803647:	74 b9                	je     803602 <page_alloc+0x1e>
+  803649:	8b 10                	mov    (%eax),%edx
+  80364b:	f6 c2 01             	test   $0x1,%dl
+  80364e:	74 b2                	je     803602 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803650:	83 ec 08             	sub    $0x8,%esp
+  803653:	56                   	push   %esi
+  803654:	52                   	push   %edx
+  803655:	50                   	push   %eax
+  803656:	68 44 56 80 00       	push   $0x805644
+  80365b:	68 34 03 00 00       	push   $0x334
+  803660:	68 35 53 80 00       	push   $0x805335
+  803665:	e8 c3 cb ff ff       	call   80022d <_panic>
+	return 0;
+  80366a:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80366f:	89 d8                	mov    %ebx,%eax
+  803671:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803674:	5b                   	pop    %ebx
+  803675:	5e                   	pop    %esi
+  803676:	5f                   	pop    %edi
+  803677:	5d                   	pop    %ebp
+  803678:	c3                   	ret
+
+00803679 <page_adopt>:
+{
+  803679:	55                   	push   %ebp
+  80367a:	89 e5                	mov    %esp,%ebp
+  80367c:	56                   	push   %esi
+  80367d:	53                   	push   %ebx
+  80367e:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803680:	c1 e8 16             	shr    $0x16,%eax
+  803683:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80368a:	25 81 00 00 00       	and    $0x81,%eax
+  80368f:	83 f8 01             	cmp    $0x1,%eax
+  803692:	75 53                	jne    8036e7 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803694:	89 d8                	mov    %ebx,%eax
+  803696:	c1 e8 0c             	shr    $0xc,%eax
+  803699:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  8036a0:	89 f2                	mov    %esi,%edx
+  8036a2:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  8036a8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  8036ad:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  8036b3:	75 37                	jne    8036ec <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  8036b5:	83 ec 08             	sub    $0x8,%esp
+  8036b8:	6a 01                	push   $0x1
+  8036ba:	53                   	push   %ebx
+  8036bb:	e8 fa fb ff ff       	call   8032ba <umapdir_walk>
+  8036c0:	83 c4 10             	add    $0x10,%esp
+  8036c3:	85 c0                	test   %eax,%eax
+  8036c5:	74 2c                	je     8036f3 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  8036c7:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  8036cd:	83 ce 01             	or     $0x1,%esi
+  8036d0:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  8036d2:	83 ec 08             	sub    $0x8,%esp
+  8036d5:	53                   	push   %ebx
+  8036d6:	6a 00                	push   $0x0
+  8036d8:	e8 8a d7 ff ff       	call   800e67 <sys_page_unmap>
+	return 1;
+  8036dd:	83 c4 10             	add    $0x10,%esp
+  8036e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036e5:	eb 05                	jmp    8036ec <page_adopt+0x73>
+		return 0;
+  8036e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036ef:	5b                   	pop    %ebx
+  8036f0:	5e                   	pop    %esi
+  8036f1:	5d                   	pop    %ebp
+  8036f2:	c3                   	ret
+		return -E_NO_MEM;
+  8036f3:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8036f8:	eb f2                	jmp    8036ec <page_adopt+0x73>
+
+008036fa <page_forget>:
+{
+  8036fa:	55                   	push   %ebp
+  8036fb:	89 e5                	mov    %esp,%ebp
+  8036fd:	53                   	push   %ebx
+  8036fe:	83 ec 04             	sub    $0x4,%esp
+  803701:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803703:	e8 4a ef ff ff       	call   802652 <find_paging_env>
+	if (pagingenv == 0)
+  803708:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  80370f:	74 39                	je     80374a <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803711:	89 d8                	mov    %ebx,%eax
+  803713:	c1 e8 16             	shr    $0x16,%eax
+  803716:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80371d:	25 81 00 00 00       	and    $0x81,%eax
+  803722:	83 f8 01             	cmp    $0x1,%eax
+  803725:	74 28                	je     80374f <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803727:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  80372e:	74 1a                	je     80374a <page_forget+0x50>
+  803730:	83 ec 08             	sub    $0x8,%esp
+  803733:	6a 00                	push   $0x0
+  803735:	53                   	push   %ebx
+  803736:	e8 7f fb ff ff       	call   8032ba <umapdir_walk>
+  80373b:	89 c3                	mov    %eax,%ebx
+  80373d:	83 c4 10             	add    $0x10,%esp
+  803740:	85 c0                	test   %eax,%eax
+  803742:	74 06                	je     80374a <page_forget+0x50>
+  803744:	8b 00                	mov    (%eax),%eax
+  803746:	a8 01                	test   $0x1,%al
+  803748:	75 2b                	jne    803775 <page_forget+0x7b>
+}
+  80374a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80374d:	c9                   	leave
+  80374e:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  80374f:	89 d8                	mov    %ebx,%eax
+  803751:	c1 e8 0c             	shr    $0xc,%eax
+  803754:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80375b:	89 c2                	mov    %eax,%edx
+  80375d:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803763:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803769:	75 bc                	jne    803727 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  80376b:	c1 e8 0c             	shr    $0xc,%eax
+  80376e:	e8 5c ee ff ff       	call   8025cf <page_remove_slot>
+		return;
+  803773:	eb d5                	jmp    80374a <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803775:	c1 e8 0c             	shr    $0xc,%eax
+  803778:	e8 52 ee ff ff       	call   8025cf <page_remove_slot>
+	*mte = 0;
+  80377d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803783:	eb c5                	jmp    80374a <page_forget+0x50>
+
+00803785 <page_unmap>:
+{
+  803785:	55                   	push   %ebp
+  803786:	89 e5                	mov    %esp,%ebp
+  803788:	57                   	push   %edi
+  803789:	56                   	push   %esi
+  80378a:	53                   	push   %ebx
+  80378b:	83 ec 0c             	sub    $0xc,%esp
+  80378e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803791:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803794:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803799:	8b 40 48             	mov    0x48(%eax),%eax
+  80379c:	85 db                	test   %ebx,%ebx
+  80379e:	0f 8e b4 00 00 00    	jle    803858 <page_unmap+0xd3>
+  8037a4:	39 d8                	cmp    %ebx,%eax
+  8037a6:	0f 84 ac 00 00 00    	je     803858 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  8037ac:	83 ec 08             	sub    $0x8,%esp
+  8037af:	57                   	push   %edi
+  8037b0:	53                   	push   %ebx
+  8037b1:	e8 b1 d6 ff ff       	call   800e67 <sys_page_unmap>
+  8037b6:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  8037b8:	e8 95 ee ff ff       	call   802652 <find_paging_env>
+	if (pagingenv == 0)
+  8037bd:	83 c4 10             	add    $0x10,%esp
+  8037c0:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8037c7:	0f 84 a1 00 00 00    	je     80386e <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8037cd:	83 ec 0c             	sub    $0xc,%esp
+  8037d0:	6a 05                	push   $0x5
+  8037d2:	68 00 00 40 00       	push   $0x400000
+  8037d7:	6a 00                	push   $0x0
+  8037d9:	68 00 b0 ad de       	push   $0xdeadb000
+  8037de:	53                   	push   %ebx
+  8037df:	e8 41 d6 ff ff       	call   800e25 <sys_page_map>
+  8037e4:	83 c4 20             	add    $0x20,%esp
+  8037e7:	85 c0                	test   %eax,%eax
+  8037e9:	0f 88 89 00 00 00    	js     803878 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  8037ef:	89 f8                	mov    %edi,%eax
+  8037f1:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8037f4:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  8037fb:	a8 01                	test   $0x1,%al
+  8037fd:	74 6f                	je     80386e <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8037ff:	83 ec 0c             	sub    $0xc,%esp
+  803802:	6a 05                	push   $0x5
+  803804:	68 00 00 40 00       	push   $0x400000
+  803809:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  80380b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803810:	50                   	push   %eax
+  803811:	53                   	push   %ebx
+  803812:	e8 0e d6 ff ff       	call   800e25 <sys_page_map>
+  803817:	83 c4 20             	add    $0x20,%esp
+  80381a:	85 c0                	test   %eax,%eax
+  80381c:	78 6f                	js     80388d <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  80381e:	c1 ef 0c             	shr    $0xc,%edi
+  803821:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803827:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  80382e:	01 
+  80382f:	74 3d                	je     80386e <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803831:	83 ec 08             	sub    $0x8,%esp
+  803834:	68 00 00 40 00       	push   $0x400000
+  803839:	6a 00                	push   $0x0
+  80383b:	e8 27 d6 ff ff       	call   800e67 <sys_page_unmap>
+  803840:	83 c4 10             	add    $0x10,%esp
+  803843:	85 c0                	test   %eax,%eax
+  803845:	78 5b                	js     8038a2 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803847:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  80384e:	c1 e8 0c             	shr    $0xc,%eax
+  803851:	e8 79 ed ff ff       	call   8025cf <page_remove_slot>
+	return r;
+  803856:	eb 16                	jmp    80386e <page_unmap+0xe9>
+		page_forget(va);
+  803858:	89 f8                	mov    %edi,%eax
+  80385a:	e8 9b fe ff ff       	call   8036fa <page_forget>
+		return sys_page_unmap(envid, va);
+  80385f:	83 ec 08             	sub    $0x8,%esp
+  803862:	57                   	push   %edi
+  803863:	53                   	push   %ebx
+  803864:	e8 fe d5 ff ff       	call   800e67 <sys_page_unmap>
+  803869:	89 c6                	mov    %eax,%esi
+  80386b:	83 c4 10             	add    $0x10,%esp
+}
+  80386e:	89 f0                	mov    %esi,%eax
+  803870:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803873:	5b                   	pop    %ebx
+  803874:	5e                   	pop    %esi
+  803875:	5f                   	pop    %edi
+  803876:	5d                   	pop    %ebp
+  803877:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803878:	50                   	push   %eax
+  803879:	68 80 56 80 00       	push   $0x805680
+  80387e:	68 e4 03 00 00       	push   $0x3e4
+  803883:	68 35 53 80 00       	push   $0x805335
+  803888:	e8 a0 c9 ff ff       	call   80022d <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  80388d:	50                   	push   %eax
+  80388e:	68 ac 56 80 00       	push   $0x8056ac
+  803893:	68 ea 03 00 00       	push   $0x3ea
+  803898:	68 35 53 80 00       	push   $0x805335
+  80389d:	e8 8b c9 ff ff       	call   80022d <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  8038a2:	50                   	push   %eax
+  8038a3:	68 d8 56 80 00       	push   $0x8056d8
+  8038a8:	68 ef 03 00 00       	push   $0x3ef
+  8038ad:	68 35 53 80 00       	push   $0x805335
+  8038b2:	e8 76 c9 ff ff       	call   80022d <_panic>
+
+008038b7 <page_unmap_range>:
+{
+  8038b7:	55                   	push   %ebp
+  8038b8:	89 e5                	mov    %esp,%ebp
+  8038ba:	57                   	push   %edi
+  8038bb:	56                   	push   %esi
+  8038bc:	53                   	push   %ebx
+  8038bd:	83 ec 0c             	sub    $0xc,%esp
+  8038c0:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  8038c3:	e8 8a ed ff ff       	call   802652 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  8038c8:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8038cd:	8b 40 48             	mov    0x48(%eax),%eax
+  8038d0:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8038d4:	7e 38                	jle    80390e <page_unmap_range+0x57>
+  8038d6:	3b 45 08             	cmp    0x8(%ebp),%eax
+  8038d9:	74 33                	je     80390e <page_unmap_range+0x57>
+  8038db:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8038e2:	74 2a                	je     80390e <page_unmap_range+0x57>
+  8038e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  8038e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8038ec:	39 fe                	cmp    %edi,%esi
+  8038ee:	74 56                	je     803946 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  8038f0:	83 ec 08             	sub    $0x8,%esp
+  8038f3:	53                   	push   %ebx
+  8038f4:	ff 75 08             	push   0x8(%ebp)
+  8038f7:	e8 89 fe ff ff       	call   803785 <page_unmap>
+  8038fc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803902:	83 c4 10             	add    $0x10,%esp
+  803905:	85 c0                	test   %eax,%eax
+  803907:	78 35                	js     80393e <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  803909:	83 c6 01             	add    $0x1,%esi
+  80390c:	eb de                	jmp    8038ec <page_unmap_range+0x35>
+  80390e:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803911:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803916:	eb 10                	jmp    803928 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803918:	89 f0                	mov    %esi,%eax
+  80391a:	e8 db fd ff ff       	call   8036fa <page_forget>
+		for (i = 0; i < npages; i++)
+  80391f:	83 c3 01             	add    $0x1,%ebx
+  803922:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803928:	39 fb                	cmp    %edi,%ebx
+  80392a:	75 ec                	jne    803918 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  80392c:	83 ec 04             	sub    $0x4,%esp
+  80392f:	57                   	push   %edi
+  803930:	ff 75 0c             	push   0xc(%ebp)
+  803933:	ff 75 08             	push   0x8(%ebp)
+  803936:	e8 40 d6 ff ff       	call   800f7b <sys_page_unmap_range>
+  80393b:	83 c4 10             	add    $0x10,%esp
+}
+  80393e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803941:	5b                   	pop    %ebx
+  803942:	5e                   	pop    %esi
+  803943:	5f                   	pop    %edi
+  803944:	5d                   	pop    %ebp
+  803945:	c3                   	ret
+	return 0;
+  803946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394b:	eb f1                	jmp    80393e <page_unmap_range+0x87>
+
+0080394d <page_alloc_range>:
+{
+  80394d:	55                   	push   %ebp
+  80394e:	89 e5                	mov    %esp,%ebp
+  803950:	57                   	push   %edi
+  803951:	56                   	push   %esi
+  803952:	53                   	push   %ebx
+  803953:	83 ec 1c             	sub    $0x1c,%esp
+  803956:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803959:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  80395c:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803963:	74 14                	je     803979 <page_alloc_range+0x2c>
+	if (check_mte)
+  803965:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803969:	74 66                	je     8039d1 <page_alloc_range+0x84>
+  80396b:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  80396d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803972:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803975:	89 c7                	mov    %eax,%edi
+  803977:	eb 10                	jmp    803989 <page_alloc_range+0x3c>
+		init_map_dir();
+  803979:	e8 e6 f8 ff ff       	call   803264 <init_map_dir>
+  80397e:	eb e5                	jmp    803965 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803980:	83 c7 01             	add    $0x1,%edi
+  803983:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803989:	39 df                	cmp    %ebx,%edi
+  80398b:	74 38                	je     8039c5 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  80398d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803990:	83 ec 08             	sub    $0x8,%esp
+  803993:	6a 00                	push   $0x0
+  803995:	56                   	push   %esi
+  803996:	e8 1f f9 ff ff       	call   8032ba <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  80399b:	83 c4 10             	add    $0x10,%esp
+  80399e:	85 c0                	test   %eax,%eax
+  8039a0:	74 de                	je     803980 <page_alloc_range+0x33>
+  8039a2:	8b 10                	mov    (%eax),%edx
+  8039a4:	f6 c2 01             	test   $0x1,%dl
+  8039a7:	74 d7                	je     803980 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  8039a9:	83 ec 08             	sub    $0x8,%esp
+  8039ac:	ff 75 e4             	push   -0x1c(%ebp)
+  8039af:	52                   	push   %edx
+  8039b0:	50                   	push   %eax
+  8039b1:	68 44 56 80 00       	push   $0x805644
+  8039b6:	68 0b 04 00 00       	push   $0x40b
+  8039bb:	68 35 53 80 00       	push   $0x805335
+  8039c0:	e8 68 c8 ff ff       	call   80022d <_panic>
+  8039c5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8039c8:	eb 07                	jmp    8039d1 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  8039ca:	c1 e0 0c             	shl    $0xc,%eax
+  8039cd:	01 c7                	add    %eax,%edi
+			npages -= r;
+  8039cf:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  8039d1:	85 db                	test   %ebx,%ebx
+  8039d3:	74 30                	je     803a05 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  8039d5:	ff 75 14             	push   0x14(%ebp)
+  8039d8:	53                   	push   %ebx
+  8039d9:	57                   	push   %edi
+  8039da:	ff 75 08             	push   0x8(%ebp)
+  8039dd:	e8 2b d5 ff ff       	call   800f0d <sys_page_alloc_range>
+  8039e2:	89 c6                	mov    %eax,%esi
+  8039e4:	83 c4 10             	add    $0x10,%esp
+  8039e7:	85 c0                	test   %eax,%eax
+  8039e9:	7f df                	jg     8039ca <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  8039eb:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8039ee:	75 1a                	jne    803a0a <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  8039f0:	83 ec 08             	sub    $0x8,%esp
+  8039f3:	57                   	push   %edi
+  8039f4:	ff 75 08             	push   0x8(%ebp)
+  8039f7:	e8 68 f9 ff ff       	call   803364 <page_out>
+  8039fc:	83 c4 10             	add    $0x10,%esp
+  8039ff:	85 c0                	test   %eax,%eax
+  803a01:	79 ce                	jns    8039d1 <page_alloc_range+0x84>
+  803a03:	eb 05                	jmp    803a0a <page_alloc_range+0xbd>
+	return 0;
+  803a05:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803a0a:	89 f0                	mov    %esi,%eax
+  803a0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a0f:	5b                   	pop    %ebx
+  803a10:	5e                   	pop    %esi
+  803a11:	5f                   	pop    %edi
+  803a12:	5d                   	pop    %ebp
+  803a13:	c3                   	ret
+
+00803a14 <page_in>:
+{
+  803a14:	55                   	push   %ebp
+  803a15:	89 e5                	mov    %esp,%ebp
+  803a17:	57                   	push   %edi
+  803a18:	56                   	push   %esi
+  803a19:	53                   	push   %ebx
+  803a1a:	83 ec 3c             	sub    $0x3c,%esp
+  803a1d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  803a20:	e8 2d ec ff ff       	call   802652 <find_paging_env>
+	if (pagingenv == 0)
+  803a25:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803a2c:	0f 84 09 02 00 00    	je     803c3b <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  803a32:	83 ec 08             	sub    $0x8,%esp
+  803a35:	6a 00                	push   $0x0
+  803a37:	56                   	push   %esi
+  803a38:	e8 7d f8 ff ff       	call   8032ba <umapdir_walk>
+  803a3d:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803a3f:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803a45:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  803a48:	83 c4 10             	add    $0x10,%esp
+  803a4b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803a4f:	74 0d                	je     803a5e <page_in+0x4a>
+  803a51:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803a56:	8b 40 48             	mov    0x48(%eax),%eax
+  803a59:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803a5c:	75 06                	jne    803a64 <page_in+0x50>
+  803a5e:	8b 03                	mov    (%ebx),%eax
+  803a60:	a8 02                	test   $0x2,%al
+  803a62:	75 63                	jne    803ac7 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  803a64:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803a66:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803a68:	89 f0                	mov    %esi,%eax
+  803a6a:	25 06 0e 00 00       	and    $0xe06,%eax
+  803a6f:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803a72:	50                   	push   %eax
+  803a73:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803a76:	57                   	push   %edi
+  803a77:	ff 75 08             	push   0x8(%ebp)
+  803a7a:	e8 65 fb ff ff       	call   8035e4 <page_alloc>
+  803a7f:	83 c4 10             	add    $0x10,%esp
+  803a82:	85 c0                	test   %eax,%eax
+  803a84:	78 39                	js     803abf <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  803a86:	89 f0                	mov    %esi,%eax
+  803a88:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803a8b:	83 ec 0c             	sub    $0xc,%esp
+  803a8e:	6a 07                	push   $0x7
+  803a90:	6a 01                	push   $0x1
+  803a92:	57                   	push   %edi
+  803a93:	c1 e0 04             	shl    $0x4,%eax
+  803a96:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803a97:	c1 ee 1c             	shr    $0x1c,%esi
+  803a9a:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803a9d:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803aa4:	e8 f1 0f 00 00       	call   804a9a <ipc_call>
+  803aa9:	83 c4 20             	add    $0x20,%esp
+  803aac:	85 c0                	test   %eax,%eax
+  803aae:	0f 88 72 01 00 00    	js     803c26 <page_in+0x212>
+	*mte = 0;
+  803ab4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  803aba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803abf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ac2:	5b                   	pop    %ebx
+  803ac3:	5e                   	pop    %esi
+  803ac4:	5f                   	pop    %edi
+  803ac5:	5d                   	pop    %ebp
+  803ac6:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803ac7:	25 06 0e 00 00       	and    $0xe06,%eax
+  803acc:	83 c8 01             	or     $0x1,%eax
+  803acf:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  803ad2:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803ad5:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  803ad8:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  803ade:	be 01 00 00 00       	mov    $0x1,%esi
+  803ae3:	eb 46                	jmp    803b2b <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  803ae5:	83 ec 08             	sub    $0x8,%esp
+  803ae8:	6a 00                	push   $0x0
+  803aea:	51                   	push   %ecx
+  803aeb:	e8 ca f7 ff ff       	call   8032ba <umapdir_walk>
+  803af0:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  803af4:	83 c4 10             	add    $0x10,%esp
+  803af7:	85 c0                	test   %eax,%eax
+  803af9:	74 66                	je     803b61 <page_in+0x14d>
+  803afb:	8b 00                	mov    (%eax),%eax
+  803afd:	a8 01                	test   $0x1,%al
+  803aff:	74 60                	je     803b61 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  803b01:	89 c2                	mov    %eax,%edx
+  803b03:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  803b09:	83 ca 01             	or     $0x1,%edx
+  803b0c:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  803b0f:	75 50                	jne    803b61 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  803b11:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803b17:	c1 e8 1c             	shr    $0x1c,%eax
+  803b1a:	8b 13                	mov    (%ebx),%edx
+  803b1c:	c1 ea 1c             	shr    $0x1c,%edx
+  803b1f:	39 d0                	cmp    %edx,%eax
+  803b21:	75 3e                	jne    803b61 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803b23:	83 c6 01             	add    $0x1,%esi
+  803b26:	83 fe 08             	cmp    $0x8,%esi
+  803b29:	74 3f                	je     803b6a <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  803b2b:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803b2d:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  803b33:	77 2c                	ja     803b61 <page_in+0x14d>
+  803b35:	89 f8                	mov    %edi,%eax
+  803b37:	c1 e8 16             	shr    $0x16,%eax
+  803b3a:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803b41:	f6 c2 01             	test   $0x1,%dl
+  803b44:	74 9f                	je     803ae5 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803b46:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803b4d:	a8 80                	test   $0x80,%al
+  803b4f:	75 10                	jne    803b61 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803b51:	89 f8                	mov    %edi,%eax
+  803b53:	c1 e8 0c             	shr    $0xc,%eax
+  803b56:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b5d:	a8 01                	test   $0x1,%al
+  803b5f:	74 84                	je     803ae5 <page_in+0xd1>
+	if (n == 1)
+  803b61:	83 fe 01             	cmp    $0x1,%esi
+  803b64:	0f 84 fa fe ff ff    	je     803a64 <page_in+0x50>
+	req.nslots = n;
+  803b6a:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  803b70:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b75:	eb 13                	jmp    803b8a <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  803b77:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  803b7b:	8b 12                	mov    (%edx),%edx
+  803b7d:	c1 ea 0c             	shr    $0xc,%edx
+  803b80:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  803b87:	83 c0 01             	add    $0x1,%eax
+  803b8a:	39 c6                	cmp    %eax,%esi
+  803b8c:	75 e9                	jne    803b77 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  803b8e:	83 ec 0c             	sub    $0xc,%esp
+  803b91:	6a 00                	push   $0x0
+  803b93:	ff 75 c0             	push   -0x40(%ebp)
+  803b96:	56                   	push   %esi
+  803b97:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803b9a:	57                   	push   %edi
+  803b9b:	6a 00                	push   $0x0
+  803b9d:	e8 ab fd ff ff       	call   80394d <page_alloc_range>
+  803ba2:	83 c4 20             	add    $0x20,%esp
+  803ba5:	85 c0                	test   %eax,%eax
+  803ba7:	78 6e                	js     803c17 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  803ba9:	83 ec 04             	sub    $0x4,%esp
+  803bac:	6a 24                	push   $0x24
+  803bae:	68 00 80 80 00       	push   $0x808000
+  803bb3:	57                   	push   %edi
+  803bb4:	e8 bc ce ff ff       	call   800a75 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803bb9:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803bc0:	56                   	push   %esi
+  803bc1:	57                   	push   %edi
+  803bc2:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803bc4:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  803bcb:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803bce:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  803bd5:	e8 c0 0e 00 00       	call   804a9a <ipc_call>
+  803bda:	83 c4 20             	add    $0x20,%esp
+  803bdd:	85 c0                	test   %eax,%eax
+  803bdf:	78 08                	js     803be9 <page_in+0x1d5>
+  803be1:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  803be4:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  803be7:	eb 20                	jmp    803c09 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  803be9:	50                   	push   %eax
+  803bea:	68 04 57 80 00       	push   $0x805704
+  803bef:	68 59 02 00 00       	push   $0x259
+  803bf4:	68 35 53 80 00       	push   $0x805335
+  803bf9:	e8 2f c6 ff ff       	call   80022d <_panic>
+		*mtes[i] = 0;
+  803bfe:	8b 10                	mov    (%eax),%edx
+  803c00:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  803c06:	83 c0 04             	add    $0x4,%eax
+  803c09:	39 c8                	cmp    %ecx,%eax
+  803c0b:	75 f1                	jne    803bfe <page_in+0x1ea>
+	return n;
+  803c0d:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  803c0f:	85 f6                	test   %esi,%esi
+  803c11:	0f 84 4d fe ff ff    	je     803a64 <page_in+0x50>
+		return r < 0 ? r : 0;
+  803c17:	85 c0                	test   %eax,%eax
+  803c19:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c1e:	0f 4f c2             	cmovg  %edx,%eax
+  803c21:	e9 99 fe ff ff       	jmp    803abf <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  803c26:	50                   	push   %eax
+  803c27:	68 3c 57 80 00       	push   $0x80573c
+  803c2c:	68 9a 02 00 00       	push   $0x29a
+  803c31:	68 35 53 80 00       	push   $0x805335
+  803c36:	e8 f2 c5 ff ff       	call   80022d <_panic>
+		return -E_PAGING;
+  803c3b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803c40:	e9 7a fe ff ff       	jmp    803abf <page_in+0xab>
+
+00803c45 <page_map>:
+{
+  803c45:	55                   	push   %ebp
+  803c46:	89 e5                	mov    %esp,%ebp
+  803c48:	57                   	push   %edi
+  803c49:	56                   	push   %esi
+  803c4a:	53                   	push   %ebx
+  803c4b:	83 ec 1c             	sub    $0x1c,%esp
+  803c4e:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803c51:	83 ec 0c             	sub    $0xc,%esp
+  803c54:	ff 75 18             	push   0x18(%ebp)
+  803c57:	ff 75 14             	push   0x14(%ebp)
+  803c5a:	ff 75 10             	push   0x10(%ebp)
+  803c5d:	ff 75 0c             	push   0xc(%ebp)
+  803c60:	56                   	push   %esi
+  803c61:	e8 bf d1 ff ff       	call   800e25 <sys_page_map>
+  803c66:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803c69:	83 c4 20             	add    $0x20,%esp
+  803c6c:	85 c0                	test   %eax,%eax
+  803c6e:	0f 89 a9 01 00 00    	jns    803e1d <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  803c74:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  803c78:	74 5f                	je     803cd9 <page_map+0x94>
+		if (r != -E_INVAL)
+  803c7a:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  803c7e:	0f 85 a0 01 00 00    	jne    803e24 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803c84:	85 f6                	test   %esi,%esi
+  803c86:	74 70                	je     803cf8 <page_map+0xb3>
+  803c88:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803c8d:	8b 40 48             	mov    0x48(%eax),%eax
+  803c90:	39 f0                	cmp    %esi,%eax
+  803c92:	74 64                	je     803cf8 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803c94:	83 ec 0c             	sub    $0xc,%esp
+  803c97:	6a 05                	push   $0x5
+  803c99:	68 00 00 40 00       	push   $0x400000
+  803c9e:	6a 00                	push   $0x0
+  803ca0:	68 00 b0 ad de       	push   $0xdeadb000
+  803ca5:	56                   	push   %esi
+  803ca6:	e8 7a d1 ff ff       	call   800e25 <sys_page_map>
+  803cab:	89 c3                	mov    %eax,%ebx
+  803cad:	83 c4 20             	add    $0x20,%esp
+  803cb0:	85 c0                	test   %eax,%eax
+  803cb2:	79 6a                	jns    803d1e <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  803cb4:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803cb7:	75 50                	jne    803d09 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  803cb9:	83 ec 08             	sub    $0x8,%esp
+  803cbc:	68 00 00 40 00       	push   $0x400000
+  803cc1:	6a fc                	push   $0xfffffffc
+  803cc3:	e8 9c f6 ff ff       	call   803364 <page_out>
+  803cc8:	83 c4 10             	add    $0x10,%esp
+  803ccb:	85 c0                	test   %eax,%eax
+  803ccd:	79 c5                	jns    803c94 <page_map+0x4f>
+}
+  803ccf:	89 d8                	mov    %ebx,%eax
+  803cd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cd4:	5b                   	pop    %ebx
+  803cd5:	5e                   	pop    %esi
+  803cd6:	5f                   	pop    %edi
+  803cd7:	5d                   	pop    %ebp
+  803cd8:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  803cd9:	83 ec 08             	sub    $0x8,%esp
+  803cdc:	68 00 00 40 00       	push   $0x400000
+  803ce1:	6a 00                	push   $0x0
+  803ce3:	e8 7c f6 ff ff       	call   803364 <page_out>
+  803ce8:	83 c4 10             	add    $0x10,%esp
+  803ceb:	85 c0                	test   %eax,%eax
+  803ced:	0f 89 5e ff ff ff    	jns    803c51 <page_map+0xc>
+				return r;
+  803cf3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803cf6:	eb d7                	jmp    803ccf <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803cf8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803cfb:	e8 79 f9 ff ff       	call   803679 <page_adopt>
+  803d00:	85 c0                	test   %eax,%eax
+  803d02:	79 90                	jns    803c94 <page_map+0x4f>
+			return r;
+  803d04:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803d07:	eb c6                	jmp    803ccf <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  803d09:	53                   	push   %ebx
+  803d0a:	68 70 57 80 00       	push   $0x805770
+  803d0f:	68 77 03 00 00       	push   $0x377
+  803d14:	68 35 53 80 00       	push   $0x805335
+  803d19:	e8 0f c5 ff ff       	call   80022d <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  803d1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d21:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803d24:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  803d2b:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  803d31:	0f 84 f5 00 00 00    	je     803e2c <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803d37:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803d3d:	83 ec 0c             	sub    $0xc,%esp
+  803d40:	6a 05                	push   $0x5
+  803d42:	68 00 00 40 00       	push   $0x400000
+  803d47:	6a 00                	push   $0x0
+  803d49:	57                   	push   %edi
+  803d4a:	56                   	push   %esi
+  803d4b:	e8 d5 d0 ff ff       	call   800e25 <sys_page_map>
+  803d50:	89 c3                	mov    %eax,%ebx
+  803d52:	83 c4 20             	add    $0x20,%esp
+  803d55:	85 c0                	test   %eax,%eax
+  803d57:	79 35                	jns    803d8e <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  803d59:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803d5c:	75 1b                	jne    803d79 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803d5e:	83 ec 08             	sub    $0x8,%esp
+  803d61:	68 00 00 40 00       	push   $0x400000
+  803d66:	6a 00                	push   $0x0
+  803d68:	e8 f7 f5 ff ff       	call   803364 <page_out>
+  803d6d:	83 c4 10             	add    $0x10,%esp
+  803d70:	85 c0                	test   %eax,%eax
+  803d72:	79 c9                	jns    803d3d <page_map+0xf8>
+  803d74:	e9 56 ff ff ff       	jmp    803ccf <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  803d79:	53                   	push   %ebx
+  803d7a:	68 98 57 80 00       	push   $0x805798
+  803d7f:	68 83 03 00 00       	push   $0x383
+  803d84:	68 35 53 80 00       	push   $0x805335
+  803d89:	e8 9f c4 ff ff       	call   80022d <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  803d8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d91:	c1 e8 0c             	shr    $0xc,%eax
+  803d94:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803d99:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  803da0:	01 
+  803da1:	0f 84 8d 00 00 00    	je     803e34 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803da7:	83 ec 08             	sub    $0x8,%esp
+  803daa:	68 00 00 40 00       	push   $0x400000
+  803daf:	6a 00                	push   $0x0
+  803db1:	e8 b1 d0 ff ff       	call   800e67 <sys_page_unmap>
+  803db6:	83 c4 10             	add    $0x10,%esp
+  803db9:	85 c0                	test   %eax,%eax
+  803dbb:	78 36                	js     803df3 <page_map+0x1ae>
+  803dbd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  803dc0:	83 ec 08             	sub    $0x8,%esp
+  803dc3:	57                   	push   %edi
+  803dc4:	56                   	push   %esi
+  803dc5:	e8 4a fc ff ff       	call   803a14 <page_in>
+  803dca:	89 c3                	mov    %eax,%ebx
+  803dcc:	83 c4 10             	add    $0x10,%esp
+  803dcf:	85 c0                	test   %eax,%eax
+  803dd1:	0f 89 7a fe ff ff    	jns    803c51 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  803dd7:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803dda:	75 2c                	jne    803e08 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  803ddc:	83 ec 08             	sub    $0x8,%esp
+  803ddf:	57                   	push   %edi
+  803de0:	6a 00                	push   $0x0
+  803de2:	e8 7d f5 ff ff       	call   803364 <page_out>
+  803de7:	83 c4 10             	add    $0x10,%esp
+  803dea:	85 c0                	test   %eax,%eax
+  803dec:	79 d2                	jns    803dc0 <page_map+0x17b>
+  803dee:	e9 dc fe ff ff       	jmp    803ccf <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  803df3:	50                   	push   %eax
+  803df4:	68 c4 57 80 00       	push   $0x8057c4
+  803df9:	68 8b 03 00 00       	push   $0x38b
+  803dfe:	68 35 53 80 00       	push   $0x805335
+  803e03:	e8 25 c4 ff ff       	call   80022d <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  803e08:	53                   	push   %ebx
+  803e09:	68 ec 57 80 00       	push   $0x8057ec
+  803e0e:	68 91 03 00 00       	push   $0x391
+  803e13:	68 35 53 80 00       	push   $0x805335
+  803e18:	e8 10 c4 ff ff       	call   80022d <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803e1d:	89 c3                	mov    %eax,%ebx
+  803e1f:	e9 ab fe ff ff       	jmp    803ccf <page_map+0x8a>
+  803e24:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e27:	e9 a3 fe ff ff       	jmp    803ccf <page_map+0x8a>
+			return r; // Pass through the error
+  803e2c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e2f:	e9 9b fe ff ff       	jmp    803ccf <page_map+0x8a>
+			return r; // Pass through the error
+  803e34:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e37:	e9 93 fe ff ff       	jmp    803ccf <page_map+0x8a>
+
+00803e3c <page_map_range>:
+{
+  803e3c:	55                   	push   %ebp
+  803e3d:	89 e5                	mov    %esp,%ebp
+  803e3f:	57                   	push   %edi
+  803e40:	56                   	push   %esi
+  803e41:	53                   	push   %ebx
+  803e42:	83 ec 0c             	sub    $0xc,%esp
+  803e45:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803e48:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  803e4b:	83 ec 08             	sub    $0x8,%esp
+  803e4e:	ff 75 1c             	push   0x1c(%ebp)
+  803e51:	ff 75 18             	push   0x18(%ebp)
+  803e54:	56                   	push   %esi
+  803e55:	ff 75 10             	push   0x10(%ebp)
+  803e58:	57                   	push   %edi
+  803e59:	ff 75 08             	push   0x8(%ebp)
+  803e5c:	e8 cf d0 ff ff       	call   800f30 <sys_page_map_range>
+  803e61:	89 c3                	mov    %eax,%ebx
+  803e63:	83 c4 20             	add    $0x20,%esp
+  803e66:	85 c0                	test   %eax,%eax
+  803e68:	79 1b                	jns    803e85 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  803e6a:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803e6d:	75 20                	jne    803e8f <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803e6f:	83 ec 08             	sub    $0x8,%esp
+  803e72:	68 00 00 40 00       	push   $0x400000
+  803e77:	6a 00                	push   $0x0
+  803e79:	e8 e6 f4 ff ff       	call   803364 <page_out>
+  803e7e:	83 c4 10             	add    $0x10,%esp
+  803e81:	85 c0                	test   %eax,%eax
+  803e83:	79 c6                	jns    803e4b <page_map_range+0xf>
+}
+  803e85:	89 d8                	mov    %ebx,%eax
+  803e87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e8a:	5b                   	pop    %ebx
+  803e8b:	5e                   	pop    %esi
+  803e8c:	5f                   	pop    %edi
+  803e8d:	5d                   	pop    %ebp
+  803e8e:	c3                   	ret
+		if (r != -E_INVAL)
+  803e8f:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  803e92:	75 f1                	jne    803e85 <page_map_range+0x49>
+  803e94:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  803e96:	be 00 00 00 00       	mov    $0x0,%esi
+  803e9b:	eb 03                	jmp    803ea0 <page_map_range+0x64>
+  803e9d:	83 c6 01             	add    $0x1,%esi
+  803ea0:	3b 75 18             	cmp    0x18(%ebp),%esi
+  803ea3:	74 2a                	je     803ecf <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  803ea5:	83 ec 0c             	sub    $0xc,%esp
+  803ea8:	ff 75 1c             	push   0x1c(%ebp)
+  803eab:	53                   	push   %ebx
+  803eac:	ff 75 10             	push   0x10(%ebp)
+  803eaf:	57                   	push   %edi
+  803eb0:	ff 75 08             	push   0x8(%ebp)
+  803eb3:	e8 8d fd ff ff       	call   803c45 <page_map>
+  803eb8:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803ebe:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803ec4:	83 c4 20             	add    $0x20,%esp
+  803ec7:	85 c0                	test   %eax,%eax
+  803ec9:	79 d2                	jns    803e9d <page_map_range+0x61>
+  803ecb:	89 c3                	mov    %eax,%ebx
+  803ecd:	eb b6                	jmp    803e85 <page_map_range+0x49>
+		return 0;
+  803ecf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ed4:	eb af                	jmp    803e85 <page_map_range+0x49>
+
+00803ed6 <paging_pgfault_handler>:
+{
+  803ed6:	55                   	push   %ebp
+  803ed7:	89 e5                	mov    %esp,%ebp
+  803ed9:	56                   	push   %esi
+  803eda:	53                   	push   %ebx
+  803edb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  803ede:	e8 6f e7 ff ff       	call   802652 <find_paging_env>
+	if (pagingenv == 0)
+  803ee3:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803ee8:	85 c0                	test   %eax,%eax
+  803eea:	74 3c                	je     803f28 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  803eec:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803eee:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803ef2:	75 12                	jne    803f06 <paging_pgfault_handler+0x30>
+  803ef4:	89 f0                	mov    %esi,%eax
+  803ef6:	e8 7e f7 ff ff       	call   803679 <page_adopt>
+  803efb:	89 c2                	mov    %eax,%edx
+		return 0;
+  803efd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803f02:	85 d2                	test   %edx,%edx
+  803f04:	78 22                	js     803f28 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  803f06:	83 ec 08             	sub    $0x8,%esp
+  803f09:	6a 00                	push   $0x0
+  803f0b:	56                   	push   %esi
+  803f0c:	e8 a9 f3 ff ff       	call   8032ba <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  803f11:	83 c4 10             	add    $0x10,%esp
+  803f14:	85 c0                	test   %eax,%eax
+  803f16:	74 05                	je     803f1d <paging_pgfault_handler+0x47>
+  803f18:	f6 00 01             	testb  $0x1,(%eax)
+  803f1b:	75 12                	jne    803f2f <paging_pgfault_handler+0x59>
+	return 0;
+  803f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f22:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803f26:	74 23                	je     803f4b <paging_pgfault_handler+0x75>
+}
+  803f28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f2b:	5b                   	pop    %ebx
+  803f2c:	5e                   	pop    %esi
+  803f2d:	5d                   	pop    %ebp
+  803f2e:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  803f2f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803f34:	8b 40 48             	mov    0x48(%eax),%eax
+  803f37:	83 ec 08             	sub    $0x8,%esp
+  803f3a:	56                   	push   %esi
+  803f3b:	50                   	push   %eax
+  803f3c:	e8 d3 fa ff ff       	call   803a14 <page_in>
+  803f41:	f7 d0                	not    %eax
+  803f43:	c1 e8 1f             	shr    $0x1f,%eax
+  803f46:	83 c4 10             	add    $0x10,%esp
+  803f49:	eb dd                	jmp    803f28 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f4b:	89 f0                	mov    %esi,%eax
+  803f4d:	e8 97 e2 ff ff       	call   8021e9 <segment_lookup>
+  803f52:	89 c2                	mov    %eax,%edx
+	return 0;
+  803f54:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f59:	85 d2                	test   %edx,%edx
+  803f5b:	74 cb                	je     803f28 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  803f5d:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803f62:	8b 40 48             	mov    0x48(%eax),%eax
+  803f65:	83 ec 08             	sub    $0x8,%esp
+  803f68:	56                   	push   %esi
+  803f69:	50                   	push   %eax
+  803f6a:	e8 f5 f3 ff ff       	call   803364 <page_out>
+  803f6f:	f7 d0                	not    %eax
+  803f71:	c1 e8 1f             	shr    $0x1f,%eax
+  803f74:	83 c4 10             	add    $0x10,%esp
+  803f77:	eb af                	jmp    803f28 <paging_pgfault_handler+0x52>
+
+00803f79 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  803f79:	55                   	push   %ebp
+  803f7a:	89 e5                	mov    %esp,%ebp
+  803f7c:	57                   	push   %edi
+  803f7d:	56                   	push   %esi
+  803f7e:	53                   	push   %ebx
+  803f7f:	83 ec 2c             	sub    $0x2c,%esp
+  803f82:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  803f85:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  803f8a:	89 c1                	mov    %eax,%ecx
+  803f8c:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  803f8f:	c1 e8 11             	shr    $0x11,%eax
+  803f92:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803f95:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  803f9c:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  803f9f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803fa4:	d3 e0                	shl    %cl,%eax
+  803fa6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803fa9:	85 c7                	test   %eax,%edi
+  803fab:	74 12                	je     803fbf <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803fad:	bb 01 00 00 00       	mov    $0x1,%ebx
+  803fb2:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  803fb5:	bf 01 00 00 00       	mov    $0x1,%edi
+  803fba:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803fbd:	eb 17                	jmp    803fd6 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  803fbf:	ff 75 e0             	push   -0x20(%ebp)
+  803fc2:	68 24 58 80 00       	push   $0x805824
+  803fc7:	6a 48                	push   $0x48
+  803fc9:	68 3e 58 80 00       	push   $0x80583e
+  803fce:	e8 5a c2 ff ff       	call   80022d <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803fd3:	83 c3 01             	add    $0x1,%ebx
+  803fd6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803fd9:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  803fdc:	89 c8                	mov    %ecx,%eax
+  803fde:	c1 e8 05             	shr    $0x5,%eax
+  803fe1:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  803fe8:	89 fe                	mov    %edi,%esi
+  803fea:	d3 e6                	shl    %cl,%esi
+  803fec:	89 f1                	mov    %esi,%ecx
+  803fee:	85 d6                	test   %edx,%esi
+  803ff0:	74 e1                	je     803fd3 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  803ff2:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  803ff5:	f7 d6                	not    %esi
+  803ff7:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  803ffa:	21 fe                	and    %edi,%esi
+  803ffc:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803fff:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  804006:	f7 d1                	not    %ecx
+  804008:	21 d1                	and    %edx,%ecx
+  80400a:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804011:	83 ec 04             	sub    $0x4,%esp
+  804014:	53                   	push   %ebx
+  804015:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804018:	57                   	push   %edi
+  804019:	6a 00                	push   $0x0
+  80401b:	e8 97 f8 ff ff       	call   8038b7 <page_unmap_range>
+	va_free(va, n);
+  804020:	83 c4 08             	add    $0x8,%esp
+  804023:	53                   	push   %ebx
+  804024:	57                   	push   %edi
+  804025:	e8 ed 05 00 00       	call   804617 <va_free>
+}
+  80402a:	83 c4 10             	add    $0x10,%esp
+  80402d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804030:	5b                   	pop    %ebx
+  804031:	5e                   	pop    %esi
+  804032:	5f                   	pop    %edi
+  804033:	5d                   	pop    %ebp
+  804034:	c3                   	ret
+
+00804035 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  804035:	55                   	push   %ebp
+  804036:	89 e5                	mov    %esp,%ebp
+  804038:	57                   	push   %edi
+  804039:	56                   	push   %esi
+  80403a:	53                   	push   %ebx
+  80403b:	83 ec 1c             	sub    $0x1c,%esp
+  80403e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804041:	85 db                	test   %ebx,%ebx
+  804043:	74 34                	je     804079 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  804045:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80404b:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  804050:	77 2f                	ja     804081 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  804052:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  804058:	75 51                	jne    8040ab <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  80405a:	89 c1                	mov    %eax,%ecx
+  80405c:	c1 e9 0c             	shr    $0xc,%ecx
+  80405f:	ba 01 00 00 00       	mov    $0x1,%edx
+  804064:	d3 e2                	shl    %cl,%edx
+  804066:	c1 e8 11             	shr    $0x11,%eax
+  804069:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  804070:	75 24                	jne    804096 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  804072:	89 d8                	mov    %ebx,%eax
+  804074:	e8 00 ff ff ff       	call   803f79 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  804079:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80407c:	5b                   	pop    %ebx
+  80407d:	5e                   	pop    %esi
+  80407e:	5f                   	pop    %edi
+  80407f:	5d                   	pop    %ebp
+  804080:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  804081:	53                   	push   %ebx
+  804082:	68 4b 58 80 00       	push   $0x80584b
+  804087:	68 a2 00 00 00       	push   $0xa2
+  80408c:	68 3e 58 80 00       	push   $0x80583e
+  804091:	e8 97 c1 ff ff       	call   80022d <_panic>
+			panic("free: %p is not allocated", va);
+  804096:	53                   	push   %ebx
+  804097:	68 24 58 80 00       	push   $0x805824
+  80409c:	68 a5 00 00 00       	push   $0xa5
+  8040a1:	68 3e 58 80 00       	push   $0x80583e
+  8040a6:	e8 82 c1 ff ff       	call   80022d <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  8040ab:	89 de                	mov    %ebx,%esi
+  8040ad:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  8040b3:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  8040b9:	89 c8                	mov    %ecx,%eax
+  8040bb:	c1 e8 11             	shr    $0x11,%eax
+  8040be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8040c1:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  8040c8:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8040cb:	c1 e9 0c             	shr    $0xc,%ecx
+  8040ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8040d3:	d3 e0                	shl    %cl,%eax
+  8040d5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8040d8:	85 c7                	test   %eax,%edi
+  8040da:	74 1b                	je     8040f7 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  8040dc:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8040e0:	89 d8                	mov    %ebx,%eax
+  8040e2:	29 f0                	sub    %esi,%eax
+  8040e4:	83 e8 10             	sub    $0x10,%eax
+  8040e7:	99                   	cltd
+  8040e8:	f7 ff                	idiv   %edi
+  8040ea:	89 d1                	mov    %edx,%ecx
+  8040ec:	85 d2                	test   %edx,%edx
+  8040ee:	75 07                	jne    8040f7 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8040f0:	ba 10 00 00 00       	mov    $0x10,%edx
+  8040f5:	eb 18                	jmp    80410f <free+0xda>
+		panic("free: %p is not allocated", va);
+  8040f7:	53                   	push   %ebx
+  8040f8:	68 24 58 80 00       	push   $0x805824
+  8040fd:	68 ad 00 00 00       	push   $0xad
+  804102:	68 3e 58 80 00       	push   $0x80583e
+  804107:	e8 21 c1 ff ff       	call   80022d <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80410c:	83 c1 01             	add    $0x1,%ecx
+  80410f:	89 d0                	mov    %edx,%eax
+  804111:	d3 e0                	shl    %cl,%eax
+  804113:	39 c7                	cmp    %eax,%edi
+  804115:	7f f5                	jg     80410c <free+0xd7>
+	*(void **) va = s->free;
+  804117:	8b 46 08             	mov    0x8(%esi),%eax
+  80411a:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  80411c:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  80411f:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  804123:	8d 58 01             	lea    0x1(%eax),%ebx
+  804126:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  80412a:	66 85 c0             	test   %ax,%ax
+  80412d:	74 52                	je     804181 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  80412f:	0f b7 db             	movzwl %bx,%ebx
+  804132:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804136:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80413b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804140:	f7 ff                	idiv   %edi
+  804142:	39 c3                	cmp    %eax,%ebx
+  804144:	0f 85 2f ff ff ff    	jne    804079 <free+0x44>
+  80414a:	8b 46 04             	mov    0x4(%esi),%eax
+  80414d:	85 c0                	test   %eax,%eax
+  80414f:	74 53                	je     8041a4 <free+0x16f>
+		s->prev->next = s->next;
+  804151:	8b 16                	mov    (%esi),%edx
+  804153:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804155:	8b 06                	mov    (%esi),%eax
+  804157:	85 c0                	test   %eax,%eax
+  804159:	74 06                	je     804161 <free+0x12c>
+		s->next->prev = s->prev;
+  80415b:	8b 56 04             	mov    0x4(%esi),%edx
+  80415e:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804161:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804164:	f7 d0                	not    %eax
+  804166:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804169:	21 d0                	and    %edx,%eax
+  80416b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80416e:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  804175:	89 f0                	mov    %esi,%eax
+  804177:	e8 fd fd ff ff       	call   803f79 <heap_free_pages>
+  80417c:	e9 f8 fe ff ff       	jmp    804079 <free+0x44>
+	s->prev = NULL;
+  804181:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  804188:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  80418f:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  804191:	85 c0                	test   %eax,%eax
+  804193:	74 03                	je     804198 <free+0x163>
+		slabs[c]->prev = s;
+  804195:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  804198:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  80419f:	e9 d5 fe ff ff       	jmp    804079 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8041a4:	8b 06                	mov    (%esi),%eax
+  8041a6:	85 c0                	test   %eax,%eax
+  8041a8:	0f 84 cb fe ff ff    	je     804079 <free+0x44>
+		slabs[c] = s->next;
+  8041ae:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  8041b5:	8b 06                	mov    (%esi),%eax
+  8041b7:	eb a2                	jmp    80415b <free+0x126>
+
+008041b9 <heap_alloc_pages>:
+{
+  8041b9:	55                   	push   %ebp
+  8041ba:	89 e5                	mov    %esp,%ebp
+  8041bc:	57                   	push   %edi
+  8041bd:	56                   	push   %esi
+  8041be:	53                   	push   %ebx
+  8041bf:	83 ec 18             	sub    $0x18,%esp
+  8041c2:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  8041c4:	50                   	push   %eax
+  8041c5:	e8 15 03 00 00       	call   8044df <va_alloc>
+  8041ca:	89 c3                	mov    %eax,%ebx
+  8041cc:	83 c4 10             	add    $0x10,%esp
+  8041cf:	85 c0                	test   %eax,%eax
+  8041d1:	74 47                	je     80421a <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8041d3:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  8041d9:	89 c1                	mov    %eax,%ecx
+  8041db:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  8041de:	c1 e8 11             	shr    $0x11,%eax
+  8041e1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8041e6:	89 d7                	mov    %edx,%edi
+  8041e8:	d3 e7                	shl    %cl,%edi
+  8041ea:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  8041f1:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  8041f5:	89 c8                	mov    %ecx,%eax
+  8041f7:	c1 e8 05             	shr    $0x5,%eax
+  8041fa:	d3 e2                	shl    %cl,%edx
+  8041fc:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  804203:	83 ec 0c             	sub    $0xc,%esp
+  804206:	6a 00                	push   $0x0
+  804208:	6a 07                	push   $0x7
+  80420a:	56                   	push   %esi
+  80420b:	53                   	push   %ebx
+  80420c:	6a 00                	push   $0x0
+  80420e:	e8 3a f7 ff ff       	call   80394d <page_alloc_range>
+  804213:	83 c4 20             	add    $0x20,%esp
+  804216:	85 c0                	test   %eax,%eax
+  804218:	78 0a                	js     804224 <heap_alloc_pages+0x6b>
+}
+  80421a:	89 d8                	mov    %ebx,%eax
+  80421c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80421f:	5b                   	pop    %ebx
+  804220:	5e                   	pop    %esi
+  804221:	5f                   	pop    %edi
+  804222:	5d                   	pop    %ebp
+  804223:	c3                   	ret
+		free(va);
+  804224:	83 ec 0c             	sub    $0xc,%esp
+  804227:	53                   	push   %ebx
+  804228:	e8 08 fe ff ff       	call   804035 <free>
+		return NULL;
+  80422d:	83 c4 10             	add    $0x10,%esp
+  804230:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804235:	eb e3                	jmp    80421a <heap_alloc_pages+0x61>
+
+00804237 <malloc>:
+{
+  804237:	55                   	push   %ebp
+  804238:	89 e5                	mov    %esp,%ebp
+  80423a:	57                   	push   %edi
+  80423b:	56                   	push   %esi
+  80423c:	53                   	push   %ebx
+  80423d:	83 ec 1c             	sub    $0x1c,%esp
+  804240:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804243:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804246:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  80424c:	0f 87 21 01 00 00    	ja     804373 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804252:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804257:	ba 10 00 00 00       	mov    $0x10,%edx
+  80425c:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  80425e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804263:	76 15                	jbe    80427a <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804265:	05 ff 0f 00 00       	add    $0xfff,%eax
+  80426a:	c1 e8 0c             	shr    $0xc,%eax
+  80426d:	e8 47 ff ff ff       	call   8041b9 <heap_alloc_pages>
+  804272:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804275:	eb 37                	jmp    8042ae <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804277:	83 c1 01             	add    $0x1,%ecx
+  80427a:	89 d6                	mov    %edx,%esi
+  80427c:	d3 e6                	shl    %cl,%esi
+  80427e:	39 c6                	cmp    %eax,%esi
+  804280:	72 f5                	jb     804277 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804282:	89 cb                	mov    %ecx,%ebx
+  804284:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  80428b:	85 ff                	test   %edi,%edi
+  80428d:	74 2a                	je     8042b9 <malloc+0x82>
+	v = s->free;
+  80428f:	8b 47 08             	mov    0x8(%edi),%eax
+  804292:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  804295:	8b 00                	mov    (%eax),%eax
+  804297:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  80429a:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  80429e:	83 e8 01             	sub    $0x1,%eax
+  8042a1:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  8042a5:	66 85 c0             	test   %ax,%ax
+  8042a8:	0f 84 9a 00 00 00    	je     804348 <malloc+0x111>
+}
+  8042ae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8042b1:	83 c4 1c             	add    $0x1c,%esp
+  8042b4:	5b                   	pop    %ebx
+  8042b5:	5e                   	pop    %esi
+  8042b6:	5f                   	pop    %edi
+  8042b7:	5d                   	pop    %ebp
+  8042b8:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  8042b9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8042be:	e8 f6 fe ff ff       	call   8041b9 <heap_alloc_pages>
+  8042c3:	89 c1                	mov    %eax,%ecx
+  8042c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8042c8:	85 c0                	test   %eax,%eax
+  8042ca:	74 e2                	je     8042ae <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8042cc:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  8042d2:	89 c8                	mov    %ecx,%eax
+  8042d4:	c1 e8 11             	shr    $0x11,%eax
+  8042d7:	c1 e9 0c             	shr    $0xc,%ecx
+  8042da:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042df:	d3 e2                	shl    %cl,%edx
+  8042e1:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  8042e8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8042eb:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  8042ef:	0f b7 f6             	movzwl %si,%esi
+  8042f2:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8042f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042fc:	f7 fe                	idiv   %esi
+  8042fe:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804302:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  804305:	85 c0                	test   %eax,%eax
+  804307:	74 14                	je     80431d <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  804309:	83 e8 01             	sub    $0x1,%eax
+  80430c:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804310:	0f af d0             	imul   %eax,%edx
+  804313:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804317:	89 3a                	mov    %edi,(%edx)
+  804319:	89 d7                	mov    %edx,%edi
+  80431b:	eb e5                	jmp    804302 <malloc+0xcb>
+	s->prev = NULL;
+  80431d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804320:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804327:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  80432e:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804330:	85 c0                	test   %eax,%eax
+  804332:	74 03                	je     804337 <malloc+0x100>
+		slabs[c]->prev = s;
+  804334:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804337:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80433a:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  804341:	89 c7                	mov    %eax,%edi
+  804343:	e9 47 ff ff ff       	jmp    80428f <malloc+0x58>
+	if (s->prev)
+  804348:	8b 47 04             	mov    0x4(%edi),%eax
+  80434b:	85 c0                	test   %eax,%eax
+  80434d:	74 19                	je     804368 <malloc+0x131>
+		s->prev->next = s->next;
+  80434f:	8b 17                	mov    (%edi),%edx
+  804351:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804353:	8b 07                	mov    (%edi),%eax
+  804355:	85 c0                	test   %eax,%eax
+  804357:	0f 84 51 ff ff ff    	je     8042ae <malloc+0x77>
+		s->next->prev = s->prev;
+  80435d:	8b 57 04             	mov    0x4(%edi),%edx
+  804360:	89 50 04             	mov    %edx,0x4(%eax)
+  804363:	e9 46 ff ff ff       	jmp    8042ae <malloc+0x77>
+		slabs[c] = s->next;
+  804368:	8b 07                	mov    (%edi),%eax
+  80436a:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  804371:	eb e0                	jmp    804353 <malloc+0x11c>
+		return NULL;
+  804373:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80437a:	e9 2f ff ff ff       	jmp    8042ae <malloc+0x77>
+
+0080437f <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  80437f:	55                   	push   %ebp
+  804380:	89 e5                	mov    %esp,%ebp
+  804382:	57                   	push   %edi
+  804383:	56                   	push   %esi
+  804384:	53                   	push   %ebx
+  804385:	83 ec 0c             	sub    $0xc,%esp
+  804388:	89 c6                	mov    %eax,%esi
+  80438a:	89 d7                	mov    %edx,%edi
+  80438c:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  80438f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804394:	ba 00 00 00 00       	mov    $0x0,%edx
+  804399:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  80439e:	83 ef 01             	sub    $0x1,%edi
+  8043a1:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8043a4:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8043a7:	eb 34                	jmp    8043dd <va_chunk_scan+0x5e>
+			i += 31;
+  8043a9:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  8043ac:	89 ca                	mov    %ecx,%edx
+			continue;
+  8043ae:	eb 23                	jmp    8043d3 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8043b0:	89 c7                	mov    %eax,%edi
+  8043b2:	c1 ef 05             	shr    $0x5,%edi
+  8043b5:	be 01 00 00 00       	mov    $0x1,%esi
+  8043ba:	d3 e6                	shl    %cl,%esi
+  8043bc:	89 f1                	mov    %esi,%ecx
+  8043be:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8043c1:	23 0c be             	and    (%esi,%edi,4),%ecx
+  8043c4:	75 41                	jne    804407 <va_chunk_scan+0x88>
+			len++;
+  8043c6:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  8043c9:	39 d3                	cmp    %edx,%ebx
+  8043cb:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  8043ce:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  8043d1:	72 2d                	jb     804400 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8043d3:	83 c0 01             	add    $0x1,%eax
+  8043d6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8043db:	77 31                	ja     80440e <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  8043dd:	89 c1                	mov    %eax,%ecx
+  8043df:	83 e1 1f             	and    $0x1f,%ecx
+  8043e2:	75 cc                	jne    8043b0 <va_chunk_scan+0x31>
+  8043e4:	89 c7                	mov    %eax,%edi
+  8043e6:	c1 ef 05             	shr    $0x5,%edi
+  8043e9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8043ec:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  8043ef:	83 ff ff             	cmp    $0xffffffff,%edi
+  8043f2:	74 b5                	je     8043a9 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  8043f4:	85 ff                	test   %edi,%edi
+  8043f6:	75 b8                	jne    8043b0 <va_chunk_scan+0x31>
+			i += 31;
+  8043f8:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  8043fb:	83 c2 20             	add    $0x20,%edx
+  8043fe:	eb c9                	jmp    8043c9 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804400:	83 c0 01             	add    $0x1,%eax
+  804403:	29 d0                	sub    %edx,%eax
+  804405:	eb 15                	jmp    80441c <va_chunk_scan+0x9d>
+			len = 0;
+  804407:	ba 00 00 00 00       	mov    $0x0,%edx
+  80440c:	eb c5                	jmp    8043d3 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  80440e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804413:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804416:	85 d2                	test   %edx,%edx
+  804418:	74 02                	je     80441c <va_chunk_scan+0x9d>
+		*run_store = best;
+  80441a:	89 1a                	mov    %ebx,(%edx)
+}
+  80441c:	83 c4 0c             	add    $0xc,%esp
+  80441f:	5b                   	pop    %ebx
+  804420:	5e                   	pop    %esi
+  804421:	5f                   	pop    %edi
+  804422:	5d                   	pop    %ebp
+  804423:	c3                   	ret
+
+00804424 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804424:	55                   	push   %ebp
+  804425:	89 e5                	mov    %esp,%ebp
+  804427:	57                   	push   %edi
+  804428:	56                   	push   %esi
+  804429:	53                   	push   %ebx
+  80442a:	83 ec 14             	sub    $0x14,%esp
+  80442d:	89 c3                	mov    %eax,%ebx
+  80442f:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804431:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804437:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  80443d:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804440:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804443:	89 d6                	mov    %edx,%esi
+  804445:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  80444b:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  80444d:	eb 34                	jmp    804483 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  80444f:	89 c8                	mov    %ecx,%eax
+  804451:	c1 e8 05             	shr    $0x5,%eax
+  804454:	89 da                	mov    %ebx,%edx
+  804456:	c1 e2 05             	shl    $0x5,%edx
+  804459:	01 da                	add    %ebx,%edx
+  80445b:	01 c2                	add    %eax,%edx
+  80445d:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804462:	d3 c0                	rol    %cl,%eax
+  804464:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  80446b:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804472:	b8 01 00 00 00       	mov    $0x1,%eax
+  804477:	01 d0                	add    %edx,%eax
+  804479:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804480:	83 c1 01             	add    $0x1,%ecx
+  804483:	39 f9                	cmp    %edi,%ecx
+  804485:	74 30                	je     8044b7 <va_chunk_mark+0x93>
+		if (alloc)
+  804487:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80448b:	74 c2                	je     80444f <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  80448d:	89 c8                	mov    %ecx,%eax
+  80448f:	c1 e8 05             	shr    $0x5,%eax
+  804492:	89 da                	mov    %ebx,%edx
+  804494:	c1 e2 05             	shl    $0x5,%edx
+  804497:	01 da                	add    %ebx,%edx
+  804499:	01 c2                	add    %eax,%edx
+  80449b:	b8 01 00 00 00       	mov    $0x1,%eax
+  8044a0:	d3 e0                	shl    %cl,%eax
+  8044a2:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  8044a9:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  8044b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8044b5:	eb c0                	jmp    804477 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  8044b7:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  8044ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044bf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8044c2:	e8 b8 fe ff ff       	call   80437f <va_chunk_scan>
+	ch->run = run;
+  8044c7:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  8044cd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8044d0:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  8044d7:	83 c4 14             	add    $0x14,%esp
+  8044da:	5b                   	pop    %ebx
+  8044db:	5e                   	pop    %esi
+  8044dc:	5f                   	pop    %edi
+  8044dd:	5d                   	pop    %ebp
+  8044de:	c3                   	ret
+
+008044df <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  8044df:	55                   	push   %ebp
+  8044e0:	89 e5                	mov    %esp,%ebp
+  8044e2:	57                   	push   %edi
+  8044e3:	56                   	push   %esi
+  8044e4:	53                   	push   %ebx
+  8044e5:	83 ec 04             	sub    $0x4,%esp
+  8044e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  8044eb:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  8044f0:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  8044f5:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  8044fc:	74 4f                	je     80454d <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  8044fe:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804501:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804506:	0f 87 01 01 00 00    	ja     80460d <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  80450c:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804512:	0f 87 80 00 00 00    	ja     804598 <va_alloc+0xb9>
+  804518:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  80451d:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804522:	0f b7 10             	movzwl (%eax),%edx
+  804525:	05 84 00 00 00       	add    $0x84,%eax
+  80452a:	39 da                	cmp    %ebx,%edx
+  80452c:	73 2c                	jae    80455a <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  80452e:	83 c6 01             	add    $0x1,%esi
+  804531:	83 fe 1c             	cmp    $0x1c,%esi
+  804534:	75 ec                	jne    804522 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804536:	b8 00 00 00 00       	mov    $0x0,%eax
+  80453b:	eb 53                	jmp    804590 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  80453d:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804543:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804548:	05 84 00 00 00       	add    $0x84,%eax
+  80454d:	39 d0                	cmp    %edx,%eax
+  80454f:	75 ec                	jne    80453d <va_alloc+0x5e>
+	va_inited = 1;
+  804551:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  804558:	eb a4                	jmp    8044fe <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  80455a:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804560:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  804565:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80456a:	89 da                	mov    %ebx,%edx
+  80456c:	e8 0e fe ff ff       	call   80437f <va_chunk_scan>
+  804571:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804573:	6a 01                	push   $0x1
+  804575:	89 d9                	mov    %ebx,%ecx
+  804577:	89 c2                	mov    %eax,%edx
+  804579:	89 f0                	mov    %esi,%eax
+  80457b:	e8 a4 fe ff ff       	call   804424 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804580:	c1 e6 16             	shl    $0x16,%esi
+  804583:	c1 e7 0c             	shl    $0xc,%edi
+  804586:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  80458d:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804590:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804593:	5b                   	pop    %ebx
+  804594:	5e                   	pop    %esi
+  804595:	5f                   	pop    %edi
+  804596:	5d                   	pop    %ebp
+  804597:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804598:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  80459e:	c1 ee 0a             	shr    $0xa,%esi
+  8045a1:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  8045a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045ab:	eb 0a                	jmp    8045b7 <va_alloc+0xd8>
+			first = c + 1;
+  8045ad:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  8045af:	83 c2 01             	add    $0x1,%edx
+  8045b2:	83 fa 1d             	cmp    $0x1d,%edx
+  8045b5:	74 4f                	je     804606 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  8045b7:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  8045bd:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  8045c4:	00 04 
+  8045c6:	75 e5                	jne    8045ad <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  8045c8:	89 d1                	mov    %edx,%ecx
+  8045ca:	29 c1                	sub    %eax,%ecx
+  8045cc:	39 f1                	cmp    %esi,%ecx
+  8045ce:	75 df                	jne    8045af <va_alloc+0xd0>
+  8045d0:	89 c7                	mov    %eax,%edi
+  8045d2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  8045d5:	be 00 04 00 00       	mov    $0x400,%esi
+  8045da:	39 f3                	cmp    %esi,%ebx
+  8045dc:	0f 46 f3             	cmovbe %ebx,%esi
+  8045df:	6a 01                	push   $0x1
+  8045e1:	89 f1                	mov    %esi,%ecx
+  8045e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045e8:	89 f8                	mov    %edi,%eax
+  8045ea:	e8 35 fe ff ff       	call   804424 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  8045ef:	83 c7 01             	add    $0x1,%edi
+  8045f2:	83 c4 04             	add    $0x4,%esp
+  8045f5:	29 f3                	sub    %esi,%ebx
+  8045f7:	75 dc                	jne    8045d5 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  8045f9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8045fc:	c1 e0 16             	shl    $0x16,%eax
+  8045ff:	05 00 00 00 08       	add    $0x8000000,%eax
+  804604:	eb 8a                	jmp    804590 <va_alloc+0xb1>
+	return NULL;
+  804606:	b8 00 00 00 00       	mov    $0x0,%eax
+  80460b:	eb 83                	jmp    804590 <va_alloc+0xb1>
+		return NULL;
+  80460d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804612:	e9 79 ff ff ff       	jmp    804590 <va_alloc+0xb1>
+
+00804617 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804617:	55                   	push   %ebp
+  804618:	89 e5                	mov    %esp,%ebp
+  80461a:	57                   	push   %edi
+  80461b:	56                   	push   %esi
+  80461c:	53                   	push   %ebx
+  80461d:	83 ec 0c             	sub    $0xc,%esp
+  804620:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804623:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804626:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  80462c:	76 21                	jbe    80464f <va_free+0x38>
+  80462e:	89 f0                	mov    %esi,%eax
+  804630:	c1 e0 0c             	shl    $0xc,%eax
+  804633:	01 f8                	add    %edi,%eax
+  804635:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  80463a:	77 13                	ja     80464f <va_free+0x38>
+	    || PGOFF(va))
+  80463c:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804642:	75 0b                	jne    80464f <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804644:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  80464a:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  80464d:	eb 45                	jmp    804694 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  80464f:	83 ec 0c             	sub    $0xc,%esp
+  804652:	56                   	push   %esi
+  804653:	57                   	push   %edi
+  804654:	68 68 58 80 00       	push   $0x805868
+  804659:	68 8e 00 00 00       	push   $0x8e
+  80465e:	68 88 58 80 00       	push   $0x805888
+  804663:	e8 c5 bb ff ff       	call   80022d <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804668:	89 fa                	mov    %edi,%edx
+  80466a:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804670:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804675:	29 d3                	sub    %edx,%ebx
+  804677:	39 f3                	cmp    %esi,%ebx
+  804679:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  80467c:	89 f8                	mov    %edi,%eax
+  80467e:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804681:	83 ec 0c             	sub    $0xc,%esp
+  804684:	6a 00                	push   $0x0
+  804686:	89 d9                	mov    %ebx,%ecx
+  804688:	e8 97 fd ff ff       	call   804424 <va_chunk_mark>
+		i += n;
+  80468d:	01 df                	add    %ebx,%edi
+		npages -= n;
+  80468f:	29 de                	sub    %ebx,%esi
+  804691:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804694:	85 f6                	test   %esi,%esi
+  804696:	75 d0                	jne    804668 <va_free+0x51>
+	}
+}
+  804698:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80469b:	5b                   	pop    %ebx
+  80469c:	5e                   	pop    %esi
+  80469d:	5f                   	pop    %edi
+  80469e:	5d                   	pop    %ebp
+  80469f:	c3                   	ret
+
+008046a0 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8046a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046a5:	c3                   	ret
+
+008046a6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8046a6:	55                   	push   %ebp
+  8046a7:	89 e5                	mov    %esp,%ebp
+  8046a9:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8046ac:	68 95 58 80 00       	push   $0x805895
+  8046b1:	ff 75 0c             	push   0xc(%ebp)
+  8046b4:	e8 36 c2 ff ff       	call   8008ef <strcpy>
+	return 0;
+}
+  8046b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046be:	c9                   	leave
+  8046bf:	c3                   	ret
+
+008046c0 <devcons_write>:
+{
+  8046c0:	55                   	push   %ebp
+  8046c1:	89 e5                	mov    %esp,%ebp
+  8046c3:	57                   	push   %edi
+  8046c4:	56                   	push   %esi
+  8046c5:	53                   	push   %ebx
+  8046c6:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8046cc:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8046d1:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8046d7:	eb 2e                	jmp    804707 <devcons_write+0x47>
+		m = n - tot;
+  8046d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8046dc:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8046de:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8046e3:	39 c3                	cmp    %eax,%ebx
+  8046e5:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8046e8:	83 ec 04             	sub    $0x4,%esp
+  8046eb:	53                   	push   %ebx
+  8046ec:	89 f0                	mov    %esi,%eax
+  8046ee:	03 45 0c             	add    0xc(%ebp),%eax
+  8046f1:	50                   	push   %eax
+  8046f2:	57                   	push   %edi
+  8046f3:	e8 7d c3 ff ff       	call   800a75 <memmove>
+		sys_cputs(buf, m);
+  8046f8:	83 c4 08             	add    $0x8,%esp
+  8046fb:	53                   	push   %ebx
+  8046fc:	57                   	push   %edi
+  8046fd:	e8 13 c6 ff ff       	call   800d15 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804702:	01 de                	add    %ebx,%esi
+  804704:	83 c4 10             	add    $0x10,%esp
+  804707:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80470a:	72 cd                	jb     8046d9 <devcons_write+0x19>
+}
+  80470c:	89 f0                	mov    %esi,%eax
+  80470e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804711:	5b                   	pop    %ebx
+  804712:	5e                   	pop    %esi
+  804713:	5f                   	pop    %edi
+  804714:	5d                   	pop    %ebp
+  804715:	c3                   	ret
+
+00804716 <devcons_read>:
+{
+  804716:	55                   	push   %ebp
+  804717:	89 e5                	mov    %esp,%ebp
+  804719:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80471c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804721:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804725:	75 07                	jne    80472e <devcons_read+0x18>
+  804727:	eb 1f                	jmp    804748 <devcons_read+0x32>
+		sys_yield();
+  804729:	e8 95 c6 ff ff       	call   800dc3 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80472e:	e8 11 c6 ff ff       	call   800d44 <sys_cgetc>
+  804733:	85 c0                	test   %eax,%eax
+  804735:	74 f2                	je     804729 <devcons_read+0x13>
+	if (c < 0)
+  804737:	78 0f                	js     804748 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804739:	83 f8 04             	cmp    $0x4,%eax
+  80473c:	74 0c                	je     80474a <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80473e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804741:	88 02                	mov    %al,(%edx)
+	return 1;
+  804743:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804748:	c9                   	leave
+  804749:	c3                   	ret
+		return 0;
+  80474a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80474f:	eb f7                	jmp    804748 <devcons_read+0x32>
+
+00804751 <cputchar>:
+{
+  804751:	55                   	push   %ebp
+  804752:	89 e5                	mov    %esp,%ebp
+  804754:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804757:	8b 45 08             	mov    0x8(%ebp),%eax
+  80475a:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80475d:	6a 01                	push   $0x1
+  80475f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804762:	50                   	push   %eax
+  804763:	e8 ad c5 ff ff       	call   800d15 <sys_cputs>
+}
+  804768:	83 c4 10             	add    $0x10,%esp
+  80476b:	c9                   	leave
+  80476c:	c3                   	ret
+
+0080476d <getchar>:
+{
+  80476d:	55                   	push   %ebp
+  80476e:	89 e5                	mov    %esp,%ebp
+  804770:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804773:	6a 01                	push   $0x1
+  804775:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804778:	50                   	push   %eax
+  804779:	6a 00                	push   $0x0
+  80477b:	e8 d7 ce ff ff       	call   801657 <read>
+	if (r < 0)
+  804780:	83 c4 10             	add    $0x10,%esp
+  804783:	85 c0                	test   %eax,%eax
+  804785:	78 06                	js     80478d <getchar+0x20>
+	if (r < 1)
+  804787:	74 06                	je     80478f <getchar+0x22>
+	return c;
+  804789:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80478d:	c9                   	leave
+  80478e:	c3                   	ret
+		return -E_EOF;
+  80478f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804794:	eb f7                	jmp    80478d <getchar+0x20>
+
+00804796 <iscons>:
+{
+  804796:	55                   	push   %ebp
+  804797:	89 e5                	mov    %esp,%ebp
+  804799:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80479c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80479f:	50                   	push   %eax
+  8047a0:	ff 75 08             	push   0x8(%ebp)
+  8047a3:	e8 50 cc ff ff       	call   8013f8 <fd_lookup>
+  8047a8:	83 c4 10             	add    $0x10,%esp
+  8047ab:	85 c0                	test   %eax,%eax
+  8047ad:	78 11                	js     8047c0 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8047af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047b2:	8b 15 4c 60 80 00    	mov    0x80604c,%edx
+  8047b8:	39 10                	cmp    %edx,(%eax)
+  8047ba:	0f 94 c0             	sete   %al
+  8047bd:	0f b6 c0             	movzbl %al,%eax
+}
+  8047c0:	c9                   	leave
+  8047c1:	c3                   	ret
+
+008047c2 <opencons>:
+{
+  8047c2:	55                   	push   %ebp
+  8047c3:	89 e5                	mov    %esp,%ebp
+  8047c5:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8047c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8047cb:	50                   	push   %eax
+  8047cc:	e8 d3 cb ff ff       	call   8013a4 <fd_alloc>
+  8047d1:	83 c4 10             	add    $0x10,%esp
+  8047d4:	85 c0                	test   %eax,%eax
+  8047d6:	78 3a                	js     804812 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8047d8:	83 ec 04             	sub    $0x4,%esp
+  8047db:	68 07 04 00 00       	push   $0x407
+  8047e0:	ff 75 f4             	push   -0xc(%ebp)
+  8047e3:	6a 00                	push   $0x0
+  8047e5:	e8 f8 c5 ff ff       	call   800de2 <sys_page_alloc>
+  8047ea:	83 c4 10             	add    $0x10,%esp
+  8047ed:	85 c0                	test   %eax,%eax
+  8047ef:	78 21                	js     804812 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8047f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047f4:	8b 15 4c 60 80 00    	mov    0x80604c,%edx
+  8047fa:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8047fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047ff:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804806:	83 ec 0c             	sub    $0xc,%esp
+  804809:	50                   	push   %eax
+  80480a:	e8 6e cb ff ff       	call   80137d <fd2num>
+  80480f:	83 c4 10             	add    $0x10,%esp
+}
+  804812:	c9                   	leave
+  804813:	c3                   	ret
+
+00804814 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804814:	55                   	push   %ebp
+  804815:	89 e5                	mov    %esp,%ebp
+  804817:	56                   	push   %esi
+  804818:	53                   	push   %ebx
+  804819:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  80481c:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  804821:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804824:	85 db                	test   %ebx,%ebx
+  804826:	78 17                	js     80483f <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804828:	83 ec 0c             	sub    $0xc,%esp
+  80482b:	56                   	push   %esi
+  80482c:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  804833:	83 c4 10             	add    $0x10,%esp
+  804836:	85 c0                	test   %eax,%eax
+  804838:	75 27                	jne    804861 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  80483a:	83 eb 01             	sub    $0x1,%ebx
+  80483d:	eb e5                	jmp    804824 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  80483f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804844:	8b 40 48             	mov    0x48(%eax),%eax
+  804847:	83 ec 08             	sub    $0x8,%esp
+  80484a:	ff 76 28             	push   0x28(%esi)
+  80484d:	ff 36                	push   (%esi)
+  80484f:	50                   	push   %eax
+  804850:	68 a4 58 80 00       	push   $0x8058a4
+  804855:	6a 1d                	push   $0x1d
+  804857:	68 c7 58 80 00       	push   $0x8058c7
+  80485c:	e8 cc b9 ff ff       	call   80022d <_panic>
+}
+  804861:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804864:	5b                   	pop    %ebx
+  804865:	5e                   	pop    %esi
+  804866:	5d                   	pop    %ebp
+  804867:	c3                   	ret
+
+00804868 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804868:	55                   	push   %ebp
+  804869:	89 e5                	mov    %esp,%ebp
+  80486b:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  80486e:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  804875:	74 0a                	je     804881 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804877:	8b 45 08             	mov    0x8(%ebp),%eax
+  80487a:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  80487f:	c9                   	leave
+  804880:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804881:	83 ec 04             	sub    $0x4,%esp
+  804884:	6a 07                	push   $0x7
+  804886:	68 00 f0 bf ee       	push   $0xeebff000
+  80488b:	6a 00                	push   $0x0
+  80488d:	e8 50 c5 ff ff       	call   800de2 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804892:	83 c4 08             	add    $0x8,%esp
+  804895:	68 08 49 80 00       	push   $0x804908
+  80489a:	6a 00                	push   $0x0
+  80489c:	e8 a7 c8 ff ff       	call   801148 <sys_env_set_pgfault_upcall>
+  8048a1:	83 c4 10             	add    $0x10,%esp
+  8048a4:	eb d1                	jmp    804877 <set_pgfault_handler+0xf>
+
+008048a6 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  8048a6:	55                   	push   %ebp
+  8048a7:	89 e5                	mov    %esp,%ebp
+  8048a9:	83 ec 08             	sub    $0x8,%esp
+  8048ac:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  8048af:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  8048b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048ba:	eb 03                	jmp    8048bf <add_pgfault_handler+0x19>
+  8048bc:	83 c0 01             	add    $0x1,%eax
+  8048bf:	39 d0                	cmp    %edx,%eax
+  8048c1:	74 0b                	je     8048ce <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  8048c3:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  8048ca:	75 f0                	jne    8048bc <add_pgfault_handler+0x16>
+  8048cc:	eb 24                	jmp    8048f2 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  8048ce:	83 fa 0a             	cmp    $0xa,%edx
+  8048d1:	74 21                	je     8048f4 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  8048d3:	8d 42 01             	lea    0x1(%edx),%eax
+  8048d6:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  8048db:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  8048e2:	83 ec 0c             	sub    $0xc,%esp
+  8048e5:	68 14 48 80 00       	push   $0x804814
+  8048ea:	e8 79 ff ff ff       	call   804868 <set_pgfault_handler>
+  8048ef:	83 c4 10             	add    $0x10,%esp
+}
+  8048f2:	c9                   	leave
+  8048f3:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  8048f4:	83 ec 04             	sub    $0x4,%esp
+  8048f7:	68 d5 58 80 00       	push   $0x8058d5
+  8048fc:	6a 44                	push   $0x44
+  8048fe:	68 c7 58 80 00       	push   $0x8058c7
+  804903:	e8 25 b9 ff ff       	call   80022d <_panic>
+
+00804908 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804908:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804909:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  80490e:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804910:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  804913:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  804917:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  80491b:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  80491e:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  804920:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  804924:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  804927:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  804928:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  80492b:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  80492c:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80492d:	c3                   	ret
+
+0080492e <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  80492e:	55                   	push   %ebp
+  80492f:	89 e5                	mov    %esp,%ebp
+  804931:	57                   	push   %edi
+  804932:	56                   	push   %esi
+  804933:	53                   	push   %ebx
+  804934:	83 ec 14             	sub    $0x14,%esp
+  804937:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80493a:	8b 75 14             	mov    0x14(%ebp),%esi
+  80493d:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804940:	ff 75 10             	push   0x10(%ebp)
+  804943:	ff 75 0c             	push   0xc(%ebp)
+  804946:	e8 ba c8 ff ff       	call   801205 <sys_ipc_recv_pages>
+  80494b:	83 c4 10             	add    $0x10,%esp
+  80494e:	85 c0                	test   %eax,%eax
+  804950:	78 46                	js     804998 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804952:	85 ff                	test   %edi,%edi
+  804954:	74 0d                	je     804963 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804956:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80495b:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804961:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804963:	85 f6                	test   %esi,%esi
+  804965:	74 0d                	je     804974 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804967:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80496c:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804972:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804974:	85 db                	test   %ebx,%ebx
+  804976:	74 0d                	je     804985 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804978:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80497d:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804983:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804985:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80498a:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804990:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804993:	5b                   	pop    %ebx
+  804994:	5e                   	pop    %esi
+  804995:	5f                   	pop    %edi
+  804996:	5d                   	pop    %ebp
+  804997:	c3                   	ret
+		if (from_env_store) {
+  804998:	85 ff                	test   %edi,%edi
+  80499a:	74 06                	je     8049a2 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80499c:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8049a2:	85 f6                	test   %esi,%esi
+  8049a4:	74 06                	je     8049ac <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  8049a6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8049ac:	85 db                	test   %ebx,%ebx
+  8049ae:	74 e0                	je     804990 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8049b0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8049b6:	eb d8                	jmp    804990 <ipc_recv_pages+0x62>
+
+008049b8 <ipc_recv>:
+{
+  8049b8:	55                   	push   %ebp
+  8049b9:	89 e5                	mov    %esp,%ebp
+  8049bb:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8049be:	6a 00                	push   $0x0
+  8049c0:	ff 75 10             	push   0x10(%ebp)
+  8049c3:	6a 01                	push   $0x1
+  8049c5:	ff 75 0c             	push   0xc(%ebp)
+  8049c8:	ff 75 08             	push   0x8(%ebp)
+  8049cb:	e8 5e ff ff ff       	call   80492e <ipc_recv_pages>
+}
+  8049d0:	c9                   	leave
+  8049d1:	c3                   	ret
+
+008049d2 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8049d2:	55                   	push   %ebp
+  8049d3:	89 e5                	mov    %esp,%ebp
+  8049d5:	56                   	push   %esi
+  8049d6:	53                   	push   %ebx
+  8049d7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8049da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8049dd:	83 ec 0c             	sub    $0xc,%esp
+  8049e0:	ff 75 0c             	push   0xc(%ebp)
+  8049e3:	e8 51 c9 ff ff       	call   801339 <sys_ipc_try_recv>
+  8049e8:	83 c4 10             	add    $0x10,%esp
+  8049eb:	85 c0                	test   %eax,%eax
+  8049ed:	78 34                	js     804a23 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8049ef:	85 f6                	test   %esi,%esi
+  8049f1:	74 0d                	je     804a00 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8049f3:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049f8:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8049fe:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  804a00:	85 db                	test   %ebx,%ebx
+  804a02:	74 0d                	je     804a11 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  804a04:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804a09:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804a0f:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804a11:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804a16:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804a1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804a1f:	5b                   	pop    %ebx
+  804a20:	5e                   	pop    %esi
+  804a21:	5d                   	pop    %ebp
+  804a22:	c3                   	ret
+		if (from_env_store) {
+  804a23:	85 f6                	test   %esi,%esi
+  804a25:	74 06                	je     804a2d <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  804a27:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  804a2d:	85 db                	test   %ebx,%ebx
+  804a2f:	74 eb                	je     804a1c <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  804a31:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804a37:	eb e3                	jmp    804a1c <ipc_try_recv+0x4a>
+
+00804a39 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804a39:	55                   	push   %ebp
+  804a3a:	89 e5                	mov    %esp,%ebp
+  804a3c:	83 ec 14             	sub    $0x14,%esp
+  804a3f:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804a42:	85 c0                	test   %eax,%eax
+  804a44:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804a49:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804a4c:	ff 75 18             	push   0x18(%ebp)
+  804a4f:	ff 75 14             	push   0x14(%ebp)
+  804a52:	50                   	push   %eax
+  804a53:	ff 75 0c             	push   0xc(%ebp)
+  804a56:	ff 75 08             	push   0x8(%ebp)
+  804a59:	e8 6a c7 ff ff       	call   8011c8 <sys_ipc_send_pages>
+  804a5e:	83 c4 20             	add    $0x20,%esp
+  804a61:	85 c0                	test   %eax,%eax
+  804a63:	78 02                	js     804a67 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804a65:	c9                   	leave
+  804a66:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804a67:	50                   	push   %eax
+  804a68:	68 f0 58 80 00       	push   $0x8058f0
+  804a6d:	68 80 00 00 00       	push   $0x80
+  804a72:	68 1c 59 80 00       	push   $0x80591c
+  804a77:	e8 b1 b7 ff ff       	call   80022d <_panic>
+
+00804a7c <ipc_send>:
+{
+  804a7c:	55                   	push   %ebp
+  804a7d:	89 e5                	mov    %esp,%ebp
+  804a7f:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  804a82:	ff 75 14             	push   0x14(%ebp)
+  804a85:	6a 01                	push   $0x1
+  804a87:	ff 75 10             	push   0x10(%ebp)
+  804a8a:	ff 75 0c             	push   0xc(%ebp)
+  804a8d:	ff 75 08             	push   0x8(%ebp)
+  804a90:	e8 a4 ff ff ff       	call   804a39 <ipc_send_pages>
+}
+  804a95:	83 c4 20             	add    $0x20,%esp
+  804a98:	c9                   	leave
+  804a99:	c3                   	ret
+
+00804a9a <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804a9a:	55                   	push   %ebp
+  804a9b:	89 e5                	mov    %esp,%ebp
+  804a9d:	83 ec 14             	sub    $0x14,%esp
+  804aa0:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804aa3:	85 c0                	test   %eax,%eax
+  804aa5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804aaa:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804aad:	ff 75 18             	push   0x18(%ebp)
+  804ab0:	ff 75 14             	push   0x14(%ebp)
+  804ab3:	50                   	push   %eax
+  804ab4:	ff 75 0c             	push   0xc(%ebp)
+  804ab7:	ff 75 08             	push   0x8(%ebp)
+  804aba:	e8 9a c7 ff ff       	call   801259 <sys_ipc_call>
+  804abf:	83 c4 20             	add    $0x20,%esp
+  804ac2:	85 c0                	test   %eax,%eax
+  804ac4:	78 0b                	js     804ad1 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  804ac6:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804acb:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804ad1:	c9                   	leave
+  804ad2:	c3                   	ret
+
+00804ad3 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  804ad3:	55                   	push   %ebp
+  804ad4:	89 e5                	mov    %esp,%ebp
+  804ad6:	57                   	push   %edi
+  804ad7:	56                   	push   %esi
+  804ad8:	53                   	push   %ebx
+  804ad9:	83 ec 18             	sub    $0x18,%esp
+  804adc:	8b 45 10             	mov    0x10(%ebp),%eax
+  804adf:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  804ae2:	8b 75 20             	mov    0x20(%ebp),%esi
+  804ae5:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804ae8:	85 c0                	test   %eax,%eax
+  804aea:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804aef:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804af2:	ff 75 18             	push   0x18(%ebp)
+  804af5:	ff 75 14             	push   0x14(%ebp)
+  804af8:	50                   	push   %eax
+  804af9:	ff 75 0c             	push   0xc(%ebp)
+  804afc:	ff 75 08             	push   0x8(%ebp)
+  804aff:	e8 96 c7 ff ff       	call   80129a <sys_ipc_reply_recv>
+  804b04:	83 c4 20             	add    $0x20,%esp
+  804b07:	85 c0                	test   %eax,%eax
+  804b09:	78 46                	js     804b51 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804b0b:	85 ff                	test   %edi,%edi
+  804b0d:	74 0d                	je     804b1c <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  804b0f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b14:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804b1a:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804b1c:	85 f6                	test   %esi,%esi
+  804b1e:	74 0d                	je     804b2d <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  804b20:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b25:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804b2b:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804b2d:	85 db                	test   %ebx,%ebx
+  804b2f:	74 0d                	je     804b3e <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  804b31:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b36:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804b3c:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804b3e:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b43:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804b49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b4c:	5b                   	pop    %ebx
+  804b4d:	5e                   	pop    %esi
+  804b4e:	5f                   	pop    %edi
+  804b4f:	5d                   	pop    %ebp
+  804b50:	c3                   	ret
+		if (from_env_store) {
+  804b51:	85 ff                	test   %edi,%edi
+  804b53:	74 06                	je     804b5b <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  804b55:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804b5b:	85 f6                	test   %esi,%esi
+  804b5d:	74 06                	je     804b65 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  804b5f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804b65:	85 db                	test   %ebx,%ebx
+  804b67:	74 e0                	je     804b49 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  804b69:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804b6f:	eb d8                	jmp    804b49 <ipc_reply_recv+0x76>
+
+00804b71 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804b71:	55                   	push   %ebp
+  804b72:	89 e5                	mov    %esp,%ebp
+  804b74:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804b77:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804b7c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804b7f:	c1 e0 06             	shl    $0x6,%eax
+  804b82:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804b87:	8b 40 50             	mov    0x50(%eax),%eax
+  804b8a:	39 c8                	cmp    %ecx,%eax
+  804b8c:	74 12                	je     804ba0 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804b8e:	83 c2 01             	add    $0x1,%edx
+  804b91:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804b97:	75 e3                	jne    804b7c <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804b99:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b9e:	eb 0e                	jmp    804bae <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804ba0:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804ba3:	c1 e0 06             	shl    $0x6,%eax
+  804ba6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804bab:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804bae:	5d                   	pop    %ebp
+  804baf:	c3                   	ret
+
+00804bb0 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804bb0:	55                   	push   %ebp
+  804bb1:	89 e5                	mov    %esp,%ebp
+  804bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804bb6:	89 c2                	mov    %eax,%edx
+  804bb8:	c1 ea 16             	shr    $0x16,%edx
+  804bbb:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804bc2:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804bc7:	f6 c1 01             	test   $0x1,%cl
+  804bca:	74 1e                	je     804bea <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  804bcc:	c1 e8 0c             	shr    $0xc,%eax
+  804bcf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804bd6:	a8 01                	test   $0x1,%al
+  804bd8:	74 10                	je     804bea <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804bda:	c1 e8 0c             	shr    $0xc,%eax
+  804bdd:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  804be0:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  804be7:	0f b7 d2             	movzwl %dx,%edx
+}
+  804bea:	89 d0                	mov    %edx,%eax
+  804bec:	5d                   	pop    %ebp
+  804bed:	c3                   	ret
+
+00804bee <udivmod>:
+  804bee:	55                   	push   %ebp
+  804bef:	57                   	push   %edi
+  804bf0:	56                   	push   %esi
+  804bf1:	53                   	push   %ebx
+  804bf2:	83 ec 24             	sub    $0x24,%esp
+  804bf5:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804bf9:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804bfd:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804c01:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804c05:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804c09:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804c0d:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  804c11:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804c16:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c20:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804c27:	00 
+  804c28:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804c2f:	00 
+  804c30:	89 fb                	mov    %edi,%ebx
+  804c32:	eb 08                	jmp    804c3c <udivmod+0x4e>
+  804c34:	83 e9 01             	sub    $0x1,%ecx
+  804c37:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804c3a:	74 68                	je     804ca4 <udivmod+0xb6>
+  804c3c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804c40:	01 c0                	add    %eax,%eax
+  804c42:	89 c6                	mov    %eax,%esi
+  804c44:	89 d7                	mov    %edx,%edi
+  804c46:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804c4a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804c4e:	0f ad d0             	shrd   %cl,%edx,%eax
+  804c51:	d3 ea                	shr    %cl,%edx
+  804c53:	f6 c1 20             	test   $0x20,%cl
+  804c56:	74 04                	je     804c5c <udivmod+0x6e>
+  804c58:	89 d0                	mov    %edx,%eax
+  804c5a:	31 d2                	xor    %edx,%edx
+  804c5c:	83 e0 01             	and    $0x1,%eax
+  804c5f:	89 04 24             	mov    %eax,(%esp)
+  804c62:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804c69:	00 
+  804c6a:	8b 04 24             	mov    (%esp),%eax
+  804c6d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804c71:	09 f0                	or     %esi,%eax
+  804c73:	09 fa                	or     %edi,%edx
+  804c75:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804c79:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804c7d:	39 f0                	cmp    %esi,%eax
+  804c7f:	89 d5                	mov    %edx,%ebp
+  804c81:	19 fd                	sbb    %edi,%ebp
+  804c83:	72 af                	jb     804c34 <udivmod+0x46>
+  804c85:	29 f0                	sub    %esi,%eax
+  804c87:	19 fa                	sbb    %edi,%edx
+  804c89:	89 cf                	mov    %ecx,%edi
+  804c8b:	c1 ef 05             	shr    $0x5,%edi
+  804c8e:	83 e7 01             	and    $0x1,%edi
+  804c91:	89 fe                	mov    %edi,%esi
+  804c93:	83 f6 01             	xor    $0x1,%esi
+  804c96:	d3 e6                	shl    %cl,%esi
+  804c98:	d3 e7                	shl    %cl,%edi
+  804c9a:	09 74 24 18          	or     %esi,0x18(%esp)
+  804c9e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804ca2:	eb 90                	jmp    804c34 <udivmod+0x46>
+  804ca4:	85 db                	test   %ebx,%ebx
+  804ca6:	74 05                	je     804cad <udivmod+0xbf>
+  804ca8:	89 03                	mov    %eax,(%ebx)
+  804caa:	89 53 04             	mov    %edx,0x4(%ebx)
+  804cad:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804cb1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804cb5:	83 c4 24             	add    $0x24,%esp
+  804cb8:	5b                   	pop    %ebx
+  804cb9:	5e                   	pop    %esi
+  804cba:	5f                   	pop    %edi
+  804cbb:	5d                   	pop    %ebp
+  804cbc:	c3                   	ret
+
+00804cbd <__udivdi3>:
+  804cbd:	83 ec 08             	sub    $0x8,%esp
+  804cc0:	6a 00                	push   $0x0
+  804cc2:	ff 74 24 1c          	push   0x1c(%esp)
+  804cc6:	ff 74 24 1c          	push   0x1c(%esp)
+  804cca:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804cce:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804cd2:	e8 17 ff ff ff       	call   804bee <udivmod>
+  804cd7:	83 c4 14             	add    $0x14,%esp
+  804cda:	c3                   	ret
+
+00804cdb <__umoddi3>:
+  804cdb:	83 ec 18             	sub    $0x18,%esp
+  804cde:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804ce2:	50                   	push   %eax
+  804ce3:	ff 74 24 2c          	push   0x2c(%esp)
+  804ce7:	ff 74 24 2c          	push   0x2c(%esp)
+  804ceb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804cef:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804cf3:	e8 f6 fe ff ff       	call   804bee <udivmod>
+  804cf8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804cfc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804d00:	83 c4 24             	add    $0x24,%esp
+  804d03:	c3                   	ret
+
+00804d04 <__divdi3>:
+  804d04:	55                   	push   %ebp
+  804d05:	57                   	push   %edi
+  804d06:	56                   	push   %esi
+  804d07:	53                   	push   %ebx
+  804d08:	83 ec 10             	sub    $0x10,%esp
+  804d0b:	8b 44 24 24          	mov    0x24(%esp),%eax
+  804d0f:	8b 54 24 28          	mov    0x28(%esp),%edx
+  804d13:	89 c6                	mov    %eax,%esi
+  804d15:	89 d7                	mov    %edx,%edi
+  804d17:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  804d1b:	33 7c 24 30          	xor    0x30(%esp),%edi
+  804d1f:	89 74 24 04          	mov    %esi,0x4(%esp)
+  804d23:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  804d27:	89 c5                	mov    %eax,%ebp
+  804d29:	f7 dd                	neg    %ebp
+  804d2b:	89 d6                	mov    %edx,%esi
+  804d2d:	83 d6 00             	adc    $0x0,%esi
+  804d30:	f7 de                	neg    %esi
+  804d32:	0f 48 e8             	cmovs  %eax,%ebp
+  804d35:	0f 49 d6             	cmovns %esi,%edx
+  804d38:	6a 00                	push   $0x0
+  804d3a:	8b 74 24 30          	mov    0x30(%esp),%esi
+  804d3e:	f7 de                	neg    %esi
+  804d40:	8b 44 24 34          	mov    0x34(%esp),%eax
+  804d44:	83 d0 00             	adc    $0x0,%eax
+  804d47:	f7 d8                	neg    %eax
+  804d49:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  804d4e:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  804d53:	50                   	push   %eax
+  804d54:	56                   	push   %esi
+  804d55:	89 e8                	mov    %ebp,%eax
+  804d57:	e8 92 fe ff ff       	call   804bee <udivmod>
+  804d5c:	83 c4 10             	add    $0x10,%esp
+  804d5f:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  804d64:	78 08                	js     804d6e <__divdi3+0x6a>
+  804d66:	83 c4 0c             	add    $0xc,%esp
+  804d69:	5b                   	pop    %ebx
+  804d6a:	5e                   	pop    %esi
+  804d6b:	5f                   	pop    %edi
+  804d6c:	5d                   	pop    %ebp
+  804d6d:	c3                   	ret
+  804d6e:	f7 d8                	neg    %eax
+  804d70:	83 d2 00             	adc    $0x0,%edx
+  804d73:	f7 da                	neg    %edx
+  804d75:	eb ef                	jmp    804d66 <__divdi3+0x62>
+
+00804d77 <__moddi3>:
+  804d77:	55                   	push   %ebp
+  804d78:	57                   	push   %edi
+  804d79:	56                   	push   %esi
+  804d7a:	53                   	push   %ebx
+  804d7b:	83 ec 18             	sub    $0x18,%esp
+  804d7e:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  804d82:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  804d86:	89 f1                	mov    %esi,%ecx
+  804d88:	f7 d9                	neg    %ecx
+  804d8a:	89 da                	mov    %ebx,%edx
+  804d8c:	83 d2 00             	adc    $0x0,%edx
+  804d8f:	f7 da                	neg    %edx
+  804d91:	0f 48 ce             	cmovs  %esi,%ecx
+  804d94:	0f 48 d3             	cmovs  %ebx,%edx
+  804d97:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804d9b:	50                   	push   %eax
+  804d9c:	8b 74 24 38          	mov    0x38(%esp),%esi
+  804da0:	f7 de                	neg    %esi
+  804da2:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  804da6:	83 d0 00             	adc    $0x0,%eax
+  804da9:	f7 d8                	neg    %eax
+  804dab:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  804db0:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  804db5:	50                   	push   %eax
+  804db6:	56                   	push   %esi
+  804db7:	89 c8                	mov    %ecx,%eax
+  804db9:	e8 30 fe ff ff       	call   804bee <udivmod>
+  804dbe:	83 c4 10             	add    $0x10,%esp
+  804dc1:	85 db                	test   %ebx,%ebx
+  804dc3:	78 10                	js     804dd5 <__moddi3+0x5e>
+  804dc5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804dc9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804dcd:	83 c4 14             	add    $0x14,%esp
+  804dd0:	5b                   	pop    %ebx
+  804dd1:	5e                   	pop    %esi
+  804dd2:	5f                   	pop    %edi
+  804dd3:	5d                   	pop    %ebp
+  804dd4:	c3                   	ret
+  804dd5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804dd9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804ddd:	f7 d8                	neg    %eax
+  804ddf:	83 d2 00             	adc    $0x0,%edx
+  804de2:	f7 da                	neg    %edx
+  804de4:	eb e7                	jmp    804dcd <__moddi3+0x56>
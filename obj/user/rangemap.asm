@@ -0,0 +1,10238 @@
+
+obj/user/rangemap.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 aa 04 00 00       	call   8004db <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define SIZE   0x8000000
+#define BASE   0x40000000
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+	int r, perm = PTE_P|PTE_U|PTE_W;
+	uintptr_t va;
+
+	// Empty ranges and ranges reaching UTOP are refused
+	assert(sys_page_alloc_range(0, (void*) RANGE, 0, perm) == -E_INVAL);
+  800039:	6a 07                	push   $0x7
+  80003b:	6a 00                	push   $0x0
+  80003d:	68 00 00 3f 10       	push   $0x103f0000
+  800042:	6a 00                	push   $0x0
+  800044:	e8 d5 11 00 00       	call   80121e <sys_page_alloc_range>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80004f:	0f 85 da 00 00 00    	jne    80012f <umain+0xfc>
+	assert(sys_page_alloc_range(0, (void*) (UTOP - PGSIZE), 2, perm) == -E_INVAL);
+  800055:	6a 07                	push   $0x7
+  800057:	6a 02                	push   $0x2
+  800059:	68 00 f0 bf ee       	push   $0xeebff000
+  80005e:	6a 00                	push   $0x0
+  800060:	e8 b9 11 00 00       	call   80121e <sys_page_alloc_range>
+  800065:	83 c4 10             	add    $0x10,%esp
+  800068:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80006b:	0f 85 d4 00 00 00    	jne    800145 <umain+0x112>
+	assert(sys_page_unmap_range(0, (void*) (RANGE + 1), 1) == -E_INVAL);
+  800071:	83 ec 04             	sub    $0x4,%esp
+  800074:	6a 01                	push   $0x1
+  800076:	68 01 00 3f 10       	push   $0x103f0001
+  80007b:	6a 00                	push   $0x0
+  80007d:	e8 0a 12 00 00       	call   80128c <sys_page_unmap_range>
+  800082:	83 c4 10             	add    $0x10,%esp
+  800085:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800088:	0f 85 cd 00 00 00    	jne    80015b <umain+0x128>
+
+	if ((r = page_alloc_range(0, (void*) RANGE, NPAGES, perm, 1)) < 0)
+  80008e:	83 ec 0c             	sub    $0xc,%esp
+  800091:	6a 01                	push   $0x1
+  800093:	6a 07                	push   $0x7
+  800095:	68 20 04 00 00       	push   $0x420
+  80009a:	68 00 00 3f 10       	push   $0x103f0000
+  80009f:	6a 00                	push   $0x0
+  8000a1:	e8 b8 3b 00 00       	call   803c5e <page_alloc_range>
+  8000a6:	83 c4 20             	add    $0x20,%esp
+  8000a9:	85 c0                	test   %eax,%eax
+  8000ab:	0f 88 c0 00 00 00    	js     800171 <umain+0x13e>
+		panic("page_alloc_range: %e", r);
+	for (va = RANGE; va < RANGE + NPAGES*PGSIZE; va += PGSIZE) {
+  8000b1:	b8 00 00 3f 10       	mov    $0x103f0000,%eax
+		assert(uvpt[PGNUM(va)] & PTE_P);
+  8000b6:	89 c2                	mov    %eax,%edx
+  8000b8:	c1 ea 0c             	shr    $0xc,%edx
+  8000bb:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8000c2:	f6 c2 01             	test   $0x1,%dl
+  8000c5:	0f 84 b8 00 00 00    	je     800183 <umain+0x150>
+		assert(*(uintptr_t*)va == 0);
+  8000cb:	83 38 00             	cmpl   $0x0,(%eax)
+  8000ce:	0f 85 c5 00 00 00    	jne    800199 <umain+0x166>
+		*(uintptr_t*)va = va;
+  8000d4:	89 00                	mov    %eax,(%eax)
+	for (va = RANGE; va < RANGE + NPAGES*PGSIZE; va += PGSIZE) {
+  8000d6:	05 00 10 00 00       	add    $0x1000,%eax
+  8000db:	3d 00 00 81 10       	cmp    $0x10810000,%eax
+  8000e0:	75 d4                	jne    8000b6 <umain+0x83>
+	}
+
+	// A source range with a hole in it maps nothing
+	if ((r = sys_page_unmap(0, (void*) (RANGE + (NPAGES-1)*PGSIZE))) < 0)
+  8000e2:	83 ec 08             	sub    $0x8,%esp
+  8000e5:	68 00 f0 80 10       	push   $0x1080f000
+  8000ea:	6a 00                	push   $0x0
+  8000ec:	e8 87 10 00 00       	call   801178 <sys_page_unmap>
+  8000f1:	83 c4 10             	add    $0x10,%esp
+  8000f4:	85 c0                	test   %eax,%eax
+  8000f6:	0f 88 b3 00 00 00    	js     8001af <umain+0x17c>
+		panic("sys_page_unmap: %e", r);
+	assert(sys_page_map_range(0, (void*) RANGE, 0, (void*) ALIAS, NPAGES, perm) == -E_INVAL);
+  8000fc:	83 ec 08             	sub    $0x8,%esp
+  8000ff:	6a 07                	push   $0x7
+  800101:	68 20 04 00 00       	push   $0x420
+  800106:	68 00 50 00 30       	push   $0x30005000
+  80010b:	6a 00                	push   $0x0
+  80010d:	68 00 00 3f 10       	push   $0x103f0000
+  800112:	6a 00                	push   $0x0
+  800114:	e8 28 11 00 00       	call   801241 <sys_page_map_range>
+  800119:	83 c4 20             	add    $0x20,%esp
+  80011c:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80011f:	0f 85 9c 00 00 00    	jne    8001c1 <umain+0x18e>
+	for (va = ALIAS; va < ALIAS + NPAGES*PGSIZE; va += PGSIZE)
+  800125:	b8 00 50 00 30       	mov    $0x30005000,%eax
+  80012a:	e9 b4 00 00 00       	jmp    8001e3 <umain+0x1b0>
+	assert(sys_page_alloc_range(0, (void*) RANGE, 0, perm) == -E_INVAL);
+  80012f:	68 0c 52 80 00       	push   $0x80520c
+  800134:	68 09 51 80 00       	push   $0x805109
+  800139:	6a 16                	push   $0x16
+  80013b:	68 1e 51 80 00       	push   $0x80511e
+  800140:	e8 f9 03 00 00       	call   80053e <_panic>
+	assert(sys_page_alloc_range(0, (void*) (UTOP - PGSIZE), 2, perm) == -E_INVAL);
+  800145:	68 48 52 80 00       	push   $0x805248
+  80014a:	68 09 51 80 00       	push   $0x805109
+  80014f:	6a 17                	push   $0x17
+  800151:	68 1e 51 80 00       	push   $0x80511e
+  800156:	e8 e3 03 00 00       	call   80053e <_panic>
+	assert(sys_page_unmap_range(0, (void*) (RANGE + 1), 1) == -E_INVAL);
+  80015b:	68 90 52 80 00       	push   $0x805290
+  800160:	68 09 51 80 00       	push   $0x805109
+  800165:	6a 18                	push   $0x18
+  800167:	68 1e 51 80 00       	push   $0x80511e
+  80016c:	e8 cd 03 00 00       	call   80053e <_panic>
+		panic("page_alloc_range: %e", r);
+  800171:	50                   	push   %eax
+  800172:	68 3b 51 80 00       	push   $0x80513b
+  800177:	6a 1b                	push   $0x1b
+  800179:	68 1e 51 80 00       	push   $0x80511e
+  80017e:	e8 bb 03 00 00       	call   80053e <_panic>
+		assert(uvpt[PGNUM(va)] & PTE_P);
+  800183:	68 50 51 80 00       	push   $0x805150
+  800188:	68 09 51 80 00       	push   $0x805109
+  80018d:	6a 1d                	push   $0x1d
+  80018f:	68 1e 51 80 00       	push   $0x80511e
+  800194:	e8 a5 03 00 00       	call   80053e <_panic>
+		assert(*(uintptr_t*)va == 0);
+  800199:	68 68 51 80 00       	push   $0x805168
+  80019e:	68 09 51 80 00       	push   $0x805109
+  8001a3:	6a 1e                	push   $0x1e
+  8001a5:	68 1e 51 80 00       	push   $0x80511e
+  8001aa:	e8 8f 03 00 00       	call   80053e <_panic>
+		panic("sys_page_unmap: %e", r);
+  8001af:	50                   	push   %eax
+  8001b0:	68 7d 51 80 00       	push   $0x80517d
+  8001b5:	6a 24                	push   $0x24
+  8001b7:	68 1e 51 80 00       	push   $0x80511e
+  8001bc:	e8 7d 03 00 00       	call   80053e <_panic>
+	assert(sys_page_map_range(0, (void*) RANGE, 0, (void*) ALIAS, NPAGES, perm) == -E_INVAL);
+  8001c1:	68 cc 52 80 00       	push   $0x8052cc
+  8001c6:	68 09 51 80 00       	push   $0x805109
+  8001cb:	6a 25                	push   $0x25
+  8001cd:	68 1e 51 80 00       	push   $0x80511e
+  8001d2:	e8 67 03 00 00       	call   80053e <_panic>
+	for (va = ALIAS; va < ALIAS + NPAGES*PGSIZE; va += PGSIZE)
+  8001d7:	05 00 10 00 00       	add    $0x1000,%eax
+  8001dc:	3d 00 50 42 30       	cmp    $0x30425000,%eax
+  8001e1:	74 38                	je     80021b <umain+0x1e8>
+		assert(!(uvpd[PDX(va)] & PTE_P) || !(uvpt[PGNUM(va)] & PTE_P));
+  8001e3:	89 c2                	mov    %eax,%edx
+  8001e5:	c1 ea 16             	shr    $0x16,%edx
+  8001e8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8001ef:	f6 c2 01             	test   $0x1,%dl
+  8001f2:	74 e3                	je     8001d7 <umain+0x1a4>
+  8001f4:	89 c2                	mov    %eax,%edx
+  8001f6:	c1 ea 0c             	shr    $0xc,%edx
+  8001f9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800200:	f6 c2 01             	test   $0x1,%dl
+  800203:	74 d2                	je     8001d7 <umain+0x1a4>
+  800205:	68 20 53 80 00       	push   $0x805320
+  80020a:	68 09 51 80 00       	push   $0x805109
+  80020f:	6a 27                	push   $0x27
+  800211:	68 1e 51 80 00       	push   $0x80511e
+  800216:	e8 23 03 00 00       	call   80053e <_panic>
+
+	// Both mappings see the same pages
+	if ((r = sys_page_map_range(0, (void*) RANGE, 0, (void*) ALIAS, NPAGES-1, perm)) < 0)
+  80021b:	83 ec 08             	sub    $0x8,%esp
+  80021e:	6a 07                	push   $0x7
+  800220:	68 1f 04 00 00       	push   $0x41f
+  800225:	68 00 50 00 30       	push   $0x30005000
+  80022a:	6a 00                	push   $0x0
+  80022c:	68 00 00 3f 10       	push   $0x103f0000
+  800231:	6a 00                	push   $0x0
+  800233:	e8 09 10 00 00       	call   801241 <sys_page_map_range>
+  800238:	83 c4 20             	add    $0x20,%esp
+  80023b:	85 c0                	test   %eax,%eax
+  80023d:	0f 88 a4 01 00 00    	js     8003e7 <umain+0x3b4>
+  800243:	ba 00 00 3f 10       	mov    $0x103f0000,%edx
+  800248:	b8 00 50 00 30       	mov    $0x30005000,%eax
+		panic("sys_page_map_range: %e", r);
+	for (va = 0; va < (NPAGES-1)*PGSIZE; va += PGSIZE) {
+		assert(*(uintptr_t*)(ALIAS + va) == RANGE + va);
+  80024d:	39 10                	cmp    %edx,(%eax)
+  80024f:	0f 85 a4 01 00 00    	jne    8003f9 <umain+0x3c6>
+		*(uintptr_t*)(ALIAS + va) = ALIAS + va;
+  800255:	89 00                	mov    %eax,(%eax)
+		assert(*(uintptr_t*)(RANGE + va) == ALIAS + va);
+  800257:	8b 0a                	mov    (%edx),%ecx
+  800259:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  80025f:	39 c1                	cmp    %eax,%ecx
+  800261:	0f 85 a8 01 00 00    	jne    80040f <umain+0x3dc>
+	for (va = 0; va < (NPAGES-1)*PGSIZE; va += PGSIZE) {
+  800267:	05 00 10 00 00       	add    $0x1000,%eax
+  80026c:	3d 00 40 42 30       	cmp    $0x30424000,%eax
+  800271:	75 da                	jne    80024d <umain+0x21a>
+	}
+
+	// Make the range read-only in place: it stays dirty, and can't be
+	// mapped writable any more
+	if ((r = sys_page_map_range(0, (void*) RANGE, 0, (void*) RANGE, NPAGES-1, PTE_P|PTE_U)) < 0)
+  800273:	83 ec 08             	sub    $0x8,%esp
+  800276:	6a 05                	push   $0x5
+  800278:	68 1f 04 00 00       	push   $0x41f
+  80027d:	68 00 00 3f 10       	push   $0x103f0000
+  800282:	6a 00                	push   $0x0
+  800284:	68 00 00 3f 10       	push   $0x103f0000
+  800289:	6a 00                	push   $0x0
+  80028b:	e8 b1 0f 00 00       	call   801241 <sys_page_map_range>
+  800290:	83 c4 20             	add    $0x20,%esp
+  800293:	85 c0                	test   %eax,%eax
+  800295:	0f 88 8a 01 00 00    	js     800425 <umain+0x3f2>
+		panic("sys_page_map_range: %e", r);
+	for (va = RANGE; va < RANGE + (NPAGES-1)*PGSIZE; va += PGSIZE)
+  80029b:	b8 00 00 3f 10       	mov    $0x103f0000,%eax
+		assert((uvpt[PGNUM(va)] & (PTE_P|PTE_W|PTE_D)) == (PTE_P|PTE_D));
+  8002a0:	89 c2                	mov    %eax,%edx
+  8002a2:	c1 ea 0c             	shr    $0xc,%edx
+  8002a5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8002ac:	83 e2 43             	and    $0x43,%edx
+  8002af:	83 fa 41             	cmp    $0x41,%edx
+  8002b2:	0f 85 7f 01 00 00    	jne    800437 <umain+0x404>
+	for (va = RANGE; va < RANGE + (NPAGES-1)*PGSIZE; va += PGSIZE)
+  8002b8:	05 00 10 00 00       	add    $0x1000,%eax
+  8002bd:	3d 00 f0 80 10       	cmp    $0x1080f000,%eax
+  8002c2:	75 dc                	jne    8002a0 <umain+0x26d>
+	assert(sys_page_map_range(0, (void*) RANGE, 0, (void*) ALIAS, NPAGES-1, perm) == -E_INVAL);
+  8002c4:	83 ec 08             	sub    $0x8,%esp
+  8002c7:	6a 07                	push   $0x7
+  8002c9:	68 1f 04 00 00       	push   $0x41f
+  8002ce:	68 00 50 00 30       	push   $0x30005000
+  8002d3:	6a 00                	push   $0x0
+  8002d5:	68 00 00 3f 10       	push   $0x103f0000
+  8002da:	6a 00                	push   $0x0
+  8002dc:	e8 60 0f 00 00       	call   801241 <sys_page_map_range>
+  8002e1:	83 c4 20             	add    $0x20,%esp
+  8002e4:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8002e7:	0f 85 60 01 00 00    	jne    80044d <umain+0x41a>
+
+	// Unmapping skips what isn't mapped, including whole page tables
+	if ((r = sys_page_unmap_range(0, (void*) ALIAS, NPAGES + 2*NPTENTRIES)) < 0)
+  8002ed:	83 ec 04             	sub    $0x4,%esp
+  8002f0:	68 20 0c 00 00       	push   $0xc20
+  8002f5:	68 00 50 00 30       	push   $0x30005000
+  8002fa:	6a 00                	push   $0x0
+  8002fc:	e8 8b 0f 00 00       	call   80128c <sys_page_unmap_range>
+  800301:	83 c4 10             	add    $0x10,%esp
+  800304:	85 c0                	test   %eax,%eax
+  800306:	0f 88 57 01 00 00    	js     800463 <umain+0x430>
+		panic("sys_page_unmap_range: %e", r);
+	for (va = ALIAS; va < ALIAS + NPAGES*PGSIZE; va += PGSIZE)
+  80030c:	b8 00 50 00 30       	mov    $0x30005000,%eax
+		assert(!(uvpt[PGNUM(va)] & PTE_P));
+  800311:	89 c2                	mov    %eax,%edx
+  800313:	c1 ea 0c             	shr    $0xc,%edx
+  800316:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80031d:	f6 c2 01             	test   $0x1,%dl
+  800320:	0f 85 4f 01 00 00    	jne    800475 <umain+0x442>
+	for (va = ALIAS; va < ALIAS + NPAGES*PGSIZE; va += PGSIZE)
+  800326:	05 00 10 00 00       	add    $0x1000,%eax
+  80032b:	3d 00 50 42 30       	cmp    $0x30425000,%eax
+  800330:	75 df                	jne    800311 <umain+0x2de>
+	for (va = RANGE; va < RANGE + (NPAGES-1)*PGSIZE; va += PGSIZE)
+  800332:	b8 00 00 3f 10       	mov    $0x103f0000,%eax
+		assert(*(uintptr_t*)va == va - RANGE + ALIAS);
+  800337:	8d 90 00 50 c1 1f    	lea    0x1fc15000(%eax),%edx
+  80033d:	39 10                	cmp    %edx,(%eax)
+  80033f:	0f 85 46 01 00 00    	jne    80048b <umain+0x458>
+	for (va = RANGE; va < RANGE + (NPAGES-1)*PGSIZE; va += PGSIZE)
+  800345:	05 00 10 00 00       	add    $0x1000,%eax
+  80034a:	3d 00 f0 80 10       	cmp    $0x1080f000,%eax
+  80034f:	75 e6                	jne    800337 <umain+0x304>
+	if ((r = sys_page_unmap_range(0, (void*) RANGE, NPAGES)) < 0)
+  800351:	83 ec 04             	sub    $0x4,%esp
+  800354:	68 20 04 00 00       	push   $0x420
+  800359:	68 00 00 3f 10       	push   $0x103f0000
+  80035e:	6a 00                	push   $0x0
+  800360:	e8 27 0f 00 00       	call   80128c <sys_page_unmap_range>
+  800365:	83 c4 10             	add    $0x10,%esp
+  800368:	85 c0                	test   %eax,%eax
+  80036a:	0f 88 31 01 00 00    	js     8004a1 <umain+0x46e>
+		panic("sys_page_unmap_range: %e", r);
+
+	// Now run out of memory
+	if ((r = page_alloc_range(0, (void*) BASE, SIZE/PGSIZE, perm, 1)) < 0)
+  800370:	83 ec 0c             	sub    $0xc,%esp
+  800373:	6a 01                	push   $0x1
+  800375:	6a 07                	push   $0x7
+  800377:	68 00 80 00 00       	push   $0x8000
+  80037c:	68 00 00 00 40       	push   $0x40000000
+  800381:	6a 00                	push   $0x0
+  800383:	e8 d6 38 00 00       	call   803c5e <page_alloc_range>
+  800388:	83 c4 20             	add    $0x20,%esp
+  80038b:	85 c0                	test   %eax,%eax
+  80038d:	0f 88 20 01 00 00    	js     8004b3 <umain+0x480>
+		panic("page_alloc_range: %e", r);
+	for (va = BASE; va < BASE+SIZE; va += PGSIZE)
+  800393:	b8 00 00 00 40       	mov    $0x40000000,%eax
+		*(uintptr_t*)va = va;
+  800398:	89 00                	mov    %eax,(%eax)
+	for (va = BASE; va < BASE+SIZE; va += PGSIZE)
+  80039a:	05 00 10 00 00       	add    $0x1000,%eax
+  80039f:	3d 00 00 00 48       	cmp    $0x48000000,%eax
+  8003a4:	75 f2                	jne    800398 <umain+0x365>
+	for (va = BASE; va < BASE+(SIZE/2); va += PGSIZE)
+  8003a6:	b8 00 00 00 40       	mov    $0x40000000,%eax
+		assert(*(uintptr_t*)va == va);
+  8003ab:	39 00                	cmp    %eax,(%eax)
+  8003ad:	0f 85 12 01 00 00    	jne    8004c5 <umain+0x492>
+	for (va = BASE; va < BASE+(SIZE/2); va += PGSIZE)
+  8003b3:	05 00 10 00 00       	add    $0x1000,%eax
+  8003b8:	3d 00 00 00 44       	cmp    $0x44000000,%eax
+  8003bd:	75 ec                	jne    8003ab <umain+0x378>
+
+	cprintf("%s: Passed all checks!\n", argc > 0 ? argv[0] : "rangemap");
+  8003bf:	b8 00 51 80 00       	mov    $0x805100,%eax
+  8003c4:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8003c8:	7e 05                	jle    8003cf <umain+0x39c>
+  8003ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8003cd:	8b 00                	mov    (%eax),%eax
+  8003cf:	83 ec 08             	sub    $0x8,%esp
+  8003d2:	50                   	push   %eax
+  8003d3:	68 f1 51 80 00       	push   $0x8051f1
+  8003d8:	e8 3c 02 00 00       	call   800619 <cprintf>
+	get_and_print_paging_stats();
+  8003dd:	e8 4d 31 00 00       	call   80352f <get_and_print_paging_stats>
+}
+  8003e2:	83 c4 10             	add    $0x10,%esp
+  8003e5:	c9                   	leave
+  8003e6:	c3                   	ret
+		panic("sys_page_map_range: %e", r);
+  8003e7:	50                   	push   %eax
+  8003e8:	68 90 51 80 00       	push   $0x805190
+  8003ed:	6a 2b                	push   $0x2b
+  8003ef:	68 1e 51 80 00       	push   $0x80511e
+  8003f4:	e8 45 01 00 00       	call   80053e <_panic>
+		assert(*(uintptr_t*)(ALIAS + va) == RANGE + va);
+  8003f9:	68 58 53 80 00       	push   $0x805358
+  8003fe:	68 09 51 80 00       	push   $0x805109
+  800403:	6a 2d                	push   $0x2d
+  800405:	68 1e 51 80 00       	push   $0x80511e
+  80040a:	e8 2f 01 00 00       	call   80053e <_panic>
+		assert(*(uintptr_t*)(RANGE + va) == ALIAS + va);
+  80040f:	68 80 53 80 00       	push   $0x805380
+  800414:	68 09 51 80 00       	push   $0x805109
+  800419:	6a 2f                	push   $0x2f
+  80041b:	68 1e 51 80 00       	push   $0x80511e
+  800420:	e8 19 01 00 00       	call   80053e <_panic>
+		panic("sys_page_map_range: %e", r);
+  800425:	50                   	push   %eax
+  800426:	68 90 51 80 00       	push   $0x805190
+  80042b:	6a 35                	push   $0x35
+  80042d:	68 1e 51 80 00       	push   $0x80511e
+  800432:	e8 07 01 00 00       	call   80053e <_panic>
+		assert((uvpt[PGNUM(va)] & (PTE_P|PTE_W|PTE_D)) == (PTE_P|PTE_D));
+  800437:	68 a8 53 80 00       	push   $0x8053a8
+  80043c:	68 09 51 80 00       	push   $0x805109
+  800441:	6a 37                	push   $0x37
+  800443:	68 1e 51 80 00       	push   $0x80511e
+  800448:	e8 f1 00 00 00       	call   80053e <_panic>
+	assert(sys_page_map_range(0, (void*) RANGE, 0, (void*) ALIAS, NPAGES-1, perm) == -E_INVAL);
+  80044d:	68 e4 53 80 00       	push   $0x8053e4
+  800452:	68 09 51 80 00       	push   $0x805109
+  800457:	6a 38                	push   $0x38
+  800459:	68 1e 51 80 00       	push   $0x80511e
+  80045e:	e8 db 00 00 00       	call   80053e <_panic>
+		panic("sys_page_unmap_range: %e", r);
+  800463:	50                   	push   %eax
+  800464:	68 a7 51 80 00       	push   $0x8051a7
+  800469:	6a 3c                	push   $0x3c
+  80046b:	68 1e 51 80 00       	push   $0x80511e
+  800470:	e8 c9 00 00 00       	call   80053e <_panic>
+		assert(!(uvpt[PGNUM(va)] & PTE_P));
+  800475:	68 c0 51 80 00       	push   $0x8051c0
+  80047a:	68 09 51 80 00       	push   $0x805109
+  80047f:	6a 3e                	push   $0x3e
+  800481:	68 1e 51 80 00       	push   $0x80511e
+  800486:	e8 b3 00 00 00       	call   80053e <_panic>
+		assert(*(uintptr_t*)va == va - RANGE + ALIAS);
+  80048b:	68 38 54 80 00       	push   $0x805438
+  800490:	68 09 51 80 00       	push   $0x805109
+  800495:	6a 40                	push   $0x40
+  800497:	68 1e 51 80 00       	push   $0x80511e
+  80049c:	e8 9d 00 00 00       	call   80053e <_panic>
+		panic("sys_page_unmap_range: %e", r);
+  8004a1:	50                   	push   %eax
+  8004a2:	68 a7 51 80 00       	push   $0x8051a7
+  8004a7:	6a 42                	push   $0x42
+  8004a9:	68 1e 51 80 00       	push   $0x80511e
+  8004ae:	e8 8b 00 00 00       	call   80053e <_panic>
+		panic("page_alloc_range: %e", r);
+  8004b3:	50                   	push   %eax
+  8004b4:	68 3b 51 80 00       	push   $0x80513b
+  8004b9:	6a 46                	push   $0x46
+  8004bb:	68 1e 51 80 00       	push   $0x80511e
+  8004c0:	e8 79 00 00 00       	call   80053e <_panic>
+		assert(*(uintptr_t*)va == va);
+  8004c5:	68 db 51 80 00       	push   $0x8051db
+  8004ca:	68 09 51 80 00       	push   $0x805109
+  8004cf:	6a 4a                	push   $0x4a
+  8004d1:	68 1e 51 80 00       	push   $0x80511e
+  8004d6:	e8 63 00 00 00       	call   80053e <_panic>
+
+008004db <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8004db:	55                   	push   %ebp
+  8004dc:	89 e5                	mov    %esp,%ebp
+  8004de:	56                   	push   %esi
+  8004df:	53                   	push   %ebx
+  8004e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8004e6:	e8 ca 0b 00 00       	call   8010b5 <sys_getenvid>
+  8004eb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004f0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004f3:	c1 e0 06             	shl    $0x6,%eax
+  8004f6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8004fb:	a3 18 e9 80 00       	mov    %eax,0x80e918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800500:	85 db                	test   %ebx,%ebx
+  800502:	7e 07                	jle    80050b <libmain+0x30>
+		binaryname = argv[0];
+  800504:	8b 06                	mov    (%esi),%eax
+  800506:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  80050b:	83 ec 08             	sub    $0x8,%esp
+  80050e:	56                   	push   %esi
+  80050f:	53                   	push   %ebx
+  800510:	e8 1e fb ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800515:	e8 0a 00 00 00       	call   800524 <exit>
+}
+  80051a:	83 c4 10             	add    $0x10,%esp
+  80051d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800520:	5b                   	pop    %ebx
+  800521:	5e                   	pop    %esi
+  800522:	5d                   	pop    %ebp
+  800523:	c3                   	ret
+
+00800524 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800524:	55                   	push   %ebp
+  800525:	89 e5                	mov    %esp,%ebp
+  800527:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80052a:	e8 2a 13 00 00       	call   801859 <close_all>
+	sys_env_destroy(0);
+  80052f:	83 ec 0c             	sub    $0xc,%esp
+  800532:	6a 00                	push   $0x0
+  800534:	e8 3b 0b 00 00       	call   801074 <sys_env_destroy>
+}
+  800539:	83 c4 10             	add    $0x10,%esp
+  80053c:	c9                   	leave
+  80053d:	c3                   	ret
+
+0080053e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80053e:	55                   	push   %ebp
+  80053f:	89 e5                	mov    %esp,%ebp
+  800541:	56                   	push   %esi
+  800542:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800543:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800546:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80054c:	e8 64 0b 00 00       	call   8010b5 <sys_getenvid>
+  800551:	83 ec 0c             	sub    $0xc,%esp
+  800554:	ff 75 0c             	push   0xc(%ebp)
+  800557:	ff 75 08             	push   0x8(%ebp)
+  80055a:	56                   	push   %esi
+  80055b:	50                   	push   %eax
+  80055c:	68 68 54 80 00       	push   $0x805468
+  800561:	e8 b3 00 00 00       	call   800619 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800566:	83 c4 18             	add    $0x18,%esp
+  800569:	53                   	push   %ebx
+  80056a:	ff 75 10             	push   0x10(%ebp)
+  80056d:	e8 56 00 00 00       	call   8005c8 <vcprintf>
+	cprintf("\n");
+  800572:	c7 04 24 07 52 80 00 	movl   $0x805207,(%esp)
+  800579:	e8 9b 00 00 00       	call   800619 <cprintf>
+  80057e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800581:	cc                   	int3
+	while (1)
+  800582:	eb fd                	jmp    800581 <_panic+0x43>
+
+00800584 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800584:	55                   	push   %ebp
+  800585:	89 e5                	mov    %esp,%ebp
+  800587:	53                   	push   %ebx
+  800588:	83 ec 04             	sub    $0x4,%esp
+  80058b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80058e:	8b 13                	mov    (%ebx),%edx
+  800590:	8d 42 01             	lea    0x1(%edx),%eax
+  800593:	89 03                	mov    %eax,(%ebx)
+  800595:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800598:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80059c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8005a1:	74 09                	je     8005ac <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8005a3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8005a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8005aa:	c9                   	leave
+  8005ab:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8005ac:	83 ec 08             	sub    $0x8,%esp
+  8005af:	68 ff 00 00 00       	push   $0xff
+  8005b4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8005b7:	50                   	push   %eax
+  8005b8:	e8 69 0a 00 00       	call   801026 <sys_cputs>
+		b->idx = 0;
+  8005bd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8005c3:	83 c4 10             	add    $0x10,%esp
+  8005c6:	eb db                	jmp    8005a3 <putch+0x1f>
+
+008005c8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8005c8:	55                   	push   %ebp
+  8005c9:	89 e5                	mov    %esp,%ebp
+  8005cb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8005d1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005d8:	00 00 00 
+	b.cnt = 0;
+  8005db:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8005e2:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8005e5:	ff 75 0c             	push   0xc(%ebp)
+  8005e8:	ff 75 08             	push   0x8(%ebp)
+  8005eb:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005f1:	50                   	push   %eax
+  8005f2:	68 84 05 80 00       	push   $0x800584
+  8005f7:	e8 14 01 00 00       	call   800710 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005fc:	83 c4 08             	add    $0x8,%esp
+  8005ff:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800605:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80060b:	50                   	push   %eax
+  80060c:	e8 15 0a 00 00       	call   801026 <sys_cputs>
+
+	return b.cnt;
+}
+  800611:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800617:	c9                   	leave
+  800618:	c3                   	ret
+
+00800619 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800619:	55                   	push   %ebp
+  80061a:	89 e5                	mov    %esp,%ebp
+  80061c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80061f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800622:	50                   	push   %eax
+  800623:	ff 75 08             	push   0x8(%ebp)
+  800626:	e8 9d ff ff ff       	call   8005c8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80062b:	c9                   	leave
+  80062c:	c3                   	ret
+
+0080062d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80062d:	55                   	push   %ebp
+  80062e:	89 e5                	mov    %esp,%ebp
+  800630:	57                   	push   %edi
+  800631:	56                   	push   %esi
+  800632:	53                   	push   %ebx
+  800633:	83 ec 1c             	sub    $0x1c,%esp
+  800636:	89 c7                	mov    %eax,%edi
+  800638:	89 d6                	mov    %edx,%esi
+  80063a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80063d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800640:	89 d1                	mov    %edx,%ecx
+  800642:	89 c2                	mov    %eax,%edx
+  800644:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800647:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80064a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80064d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800650:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800653:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80065a:	39 c2                	cmp    %eax,%edx
+  80065c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80065f:	72 3e                	jb     80069f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800661:	83 ec 0c             	sub    $0xc,%esp
+  800664:	ff 75 18             	push   0x18(%ebp)
+  800667:	83 eb 01             	sub    $0x1,%ebx
+  80066a:	53                   	push   %ebx
+  80066b:	50                   	push   %eax
+  80066c:	83 ec 08             	sub    $0x8,%esp
+  80066f:	ff 75 e4             	push   -0x1c(%ebp)
+  800672:	ff 75 e0             	push   -0x20(%ebp)
+  800675:	ff 75 dc             	push   -0x24(%ebp)
+  800678:	ff 75 d8             	push   -0x28(%ebp)
+  80067b:	e8 4e 49 00 00       	call   804fce <__udivdi3>
+  800680:	83 c4 18             	add    $0x18,%esp
+  800683:	52                   	push   %edx
+  800684:	50                   	push   %eax
+  800685:	89 f2                	mov    %esi,%edx
+  800687:	89 f8                	mov    %edi,%eax
+  800689:	e8 9f ff ff ff       	call   80062d <printnum>
+  80068e:	83 c4 20             	add    $0x20,%esp
+  800691:	eb 13                	jmp    8006a6 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800693:	83 ec 08             	sub    $0x8,%esp
+  800696:	56                   	push   %esi
+  800697:	ff 75 18             	push   0x18(%ebp)
+  80069a:	ff d7                	call   *%edi
+  80069c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80069f:	83 eb 01             	sub    $0x1,%ebx
+  8006a2:	85 db                	test   %ebx,%ebx
+  8006a4:	7f ed                	jg     800693 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8006a6:	83 ec 08             	sub    $0x8,%esp
+  8006a9:	56                   	push   %esi
+  8006aa:	83 ec 04             	sub    $0x4,%esp
+  8006ad:	ff 75 e4             	push   -0x1c(%ebp)
+  8006b0:	ff 75 e0             	push   -0x20(%ebp)
+  8006b3:	ff 75 dc             	push   -0x24(%ebp)
+  8006b6:	ff 75 d8             	push   -0x28(%ebp)
+  8006b9:	e8 2e 49 00 00       	call   804fec <__umoddi3>
+  8006be:	83 c4 14             	add    $0x14,%esp
+  8006c1:	0f be 80 8b 54 80 00 	movsbl 0x80548b(%eax),%eax
+  8006c8:	50                   	push   %eax
+  8006c9:	ff d7                	call   *%edi
+}
+  8006cb:	83 c4 10             	add    $0x10,%esp
+  8006ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006d1:	5b                   	pop    %ebx
+  8006d2:	5e                   	pop    %esi
+  8006d3:	5f                   	pop    %edi
+  8006d4:	5d                   	pop    %ebp
+  8006d5:	c3                   	ret
+
+008006d6 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8006d6:	55                   	push   %ebp
+  8006d7:	89 e5                	mov    %esp,%ebp
+  8006d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8006dc:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8006e0:	8b 10                	mov    (%eax),%edx
+  8006e2:	3b 50 04             	cmp    0x4(%eax),%edx
+  8006e5:	73 0a                	jae    8006f1 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8006e7:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006ea:	89 08                	mov    %ecx,(%eax)
+  8006ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006ef:	88 02                	mov    %al,(%edx)
+}
+  8006f1:	5d                   	pop    %ebp
+  8006f2:	c3                   	ret
+
+008006f3 <printfmt>:
+{
+  8006f3:	55                   	push   %ebp
+  8006f4:	89 e5                	mov    %esp,%ebp
+  8006f6:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006f9:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006fc:	50                   	push   %eax
+  8006fd:	ff 75 10             	push   0x10(%ebp)
+  800700:	ff 75 0c             	push   0xc(%ebp)
+  800703:	ff 75 08             	push   0x8(%ebp)
+  800706:	e8 05 00 00 00       	call   800710 <vprintfmt>
+}
+  80070b:	83 c4 10             	add    $0x10,%esp
+  80070e:	c9                   	leave
+  80070f:	c3                   	ret
+
+00800710 <vprintfmt>:
+{
+  800710:	55                   	push   %ebp
+  800711:	89 e5                	mov    %esp,%ebp
+  800713:	57                   	push   %edi
+  800714:	56                   	push   %esi
+  800715:	53                   	push   %ebx
+  800716:	83 ec 2c             	sub    $0x2c,%esp
+  800719:	8b 75 08             	mov    0x8(%ebp),%esi
+  80071c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80071f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800722:	eb 0a                	jmp    80072e <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800724:	83 ec 08             	sub    $0x8,%esp
+  800727:	53                   	push   %ebx
+  800728:	50                   	push   %eax
+  800729:	ff d6                	call   *%esi
+  80072b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80072e:	83 c7 01             	add    $0x1,%edi
+  800731:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800735:	83 f8 25             	cmp    $0x25,%eax
+  800738:	74 0c                	je     800746 <vprintfmt+0x36>
+			if (ch == '\0')
+  80073a:	85 c0                	test   %eax,%eax
+  80073c:	75 e6                	jne    800724 <vprintfmt+0x14>
+}
+  80073e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800741:	5b                   	pop    %ebx
+  800742:	5e                   	pop    %esi
+  800743:	5f                   	pop    %edi
+  800744:	5d                   	pop    %ebp
+  800745:	c3                   	ret
+		padc = ' ';
+  800746:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80074a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800751:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800758:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80075f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800764:	8d 47 01             	lea    0x1(%edi),%eax
+  800767:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80076a:	0f b6 17             	movzbl (%edi),%edx
+  80076d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800770:	3c 55                	cmp    $0x55,%al
+  800772:	0f 87 c5 03 00 00    	ja     800b3d <vprintfmt+0x42d>
+  800778:	0f b6 c0             	movzbl %al,%eax
+  80077b:	ff 24 85 20 56 80 00 	jmp    *0x805620(,%eax,4)
+  800782:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800785:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800789:	eb d9                	jmp    800764 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80078b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80078e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800792:	eb d0                	jmp    800764 <vprintfmt+0x54>
+  800794:	0f b6 d2             	movzbl %dl,%edx
+  800797:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80079a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8007a2:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8007a5:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8007a9:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8007ac:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8007af:	83 f9 09             	cmp    $0x9,%ecx
+  8007b2:	77 55                	ja     800809 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8007b4:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8007b7:	eb e9                	jmp    8007a2 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8007b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bc:	8b 00                	mov    (%eax),%eax
+  8007be:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8007cd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8007d1:	79 91                	jns    800764 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8007d3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007d6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007d9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8007e0:	eb 82                	jmp    800764 <vprintfmt+0x54>
+			if (width < 0)
+  8007e2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8007e5:	85 d2                	test   %edx,%edx
+  8007e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ec:	0f 49 c2             	cmovns %edx,%eax
+  8007ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007f2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007f5:	e9 6a ff ff ff       	jmp    800764 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007fa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8007fd:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800804:	e9 5b ff ff ff       	jmp    800764 <vprintfmt+0x54>
+  800809:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80080c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80080f:	eb bc                	jmp    8007cd <vprintfmt+0xbd>
+			lflag++;
+  800811:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800814:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800817:	e9 48 ff ff ff       	jmp    800764 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80081c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081f:	8d 78 04             	lea    0x4(%eax),%edi
+  800822:	83 ec 08             	sub    $0x8,%esp
+  800825:	53                   	push   %ebx
+  800826:	ff 30                	push   (%eax)
+  800828:	ff d6                	call   *%esi
+			break;
+  80082a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80082d:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800830:	e9 63 02 00 00       	jmp    800a98 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800835:	8b 45 14             	mov    0x14(%ebp),%eax
+  800838:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80083b:	8b 10                	mov    (%eax),%edx
+  80083d:	89 d0                	mov    %edx,%eax
+  80083f:	f7 d8                	neg    %eax
+  800841:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800844:	83 f8 12             	cmp    $0x12,%eax
+  800847:	7f 23                	jg     80086c <vprintfmt+0x15c>
+  800849:	8b 14 85 80 57 80 00 	mov    0x805780(,%eax,4),%edx
+  800850:	85 d2                	test   %edx,%edx
+  800852:	74 18                	je     80086c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800854:	52                   	push   %edx
+  800855:	68 1b 51 80 00       	push   $0x80511b
+  80085a:	53                   	push   %ebx
+  80085b:	56                   	push   %esi
+  80085c:	e8 92 fe ff ff       	call   8006f3 <printfmt>
+  800861:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800864:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800867:	e9 2c 02 00 00       	jmp    800a98 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80086c:	50                   	push   %eax
+  80086d:	68 a3 54 80 00       	push   $0x8054a3
+  800872:	53                   	push   %ebx
+  800873:	56                   	push   %esi
+  800874:	e8 7a fe ff ff       	call   8006f3 <printfmt>
+  800879:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80087c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80087f:	e9 14 02 00 00       	jmp    800a98 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800884:	8b 45 14             	mov    0x14(%ebp),%eax
+  800887:	83 c0 04             	add    $0x4,%eax
+  80088a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80088d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800890:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800892:	85 c9                	test   %ecx,%ecx
+  800894:	b8 9c 54 80 00       	mov    $0x80549c,%eax
+  800899:	0f 45 c1             	cmovne %ecx,%eax
+  80089c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80089f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8008a3:	7e 06                	jle    8008ab <vprintfmt+0x19b>
+  8008a5:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8008a9:	75 0b                	jne    8008b6 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008ab:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8008ae:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8008b1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8008b4:	eb 5c                	jmp    800912 <vprintfmt+0x202>
+  8008b6:	83 ec 08             	sub    $0x8,%esp
+  8008b9:	ff 75 d0             	push   -0x30(%ebp)
+  8008bc:	ff 75 cc             	push   -0x34(%ebp)
+  8008bf:	e8 19 03 00 00       	call   800bdd <strnlen>
+  8008c4:	89 c2                	mov    %eax,%edx
+  8008c6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008c9:	29 d0                	sub    %edx,%eax
+  8008cb:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8008ce:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8008d2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008d5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8008d8:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008da:	eb 0e                	jmp    8008ea <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8008dc:	83 ec 08             	sub    $0x8,%esp
+  8008df:	53                   	push   %ebx
+  8008e0:	57                   	push   %edi
+  8008e1:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008e4:	83 ee 01             	sub    $0x1,%esi
+  8008e7:	83 c4 10             	add    $0x10,%esp
+  8008ea:	85 f6                	test   %esi,%esi
+  8008ec:	7f ee                	jg     8008dc <vprintfmt+0x1cc>
+  8008ee:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008f1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008f4:	85 c0                	test   %eax,%eax
+  8008f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008fb:	0f 49 d0             	cmovns %eax,%edx
+  8008fe:	29 d0                	sub    %edx,%eax
+  800900:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800903:	eb a6                	jmp    8008ab <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800905:	83 ec 08             	sub    $0x8,%esp
+  800908:	53                   	push   %ebx
+  800909:	52                   	push   %edx
+  80090a:	ff 55 08             	call   *0x8(%ebp)
+  80090d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800910:	89 f1                	mov    %esi,%ecx
+  800912:	8d 71 01             	lea    0x1(%ecx),%esi
+  800915:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800919:	0f be d0             	movsbl %al,%edx
+  80091c:	85 d2                	test   %edx,%edx
+  80091e:	74 28                	je     800948 <vprintfmt+0x238>
+  800920:	85 ff                	test   %edi,%edi
+  800922:	78 05                	js     800929 <vprintfmt+0x219>
+  800924:	83 ef 01             	sub    $0x1,%edi
+  800927:	78 30                	js     800959 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800929:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80092d:	74 d6                	je     800905 <vprintfmt+0x1f5>
+  80092f:	0f be c0             	movsbl %al,%eax
+  800932:	83 e8 20             	sub    $0x20,%eax
+  800935:	83 f8 5e             	cmp    $0x5e,%eax
+  800938:	76 cb                	jbe    800905 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80093a:	83 ec 08             	sub    $0x8,%esp
+  80093d:	53                   	push   %ebx
+  80093e:	6a 3f                	push   $0x3f
+  800940:	ff 55 08             	call   *0x8(%ebp)
+  800943:	83 c4 10             	add    $0x10,%esp
+  800946:	eb c8                	jmp    800910 <vprintfmt+0x200>
+  800948:	8b 75 08             	mov    0x8(%ebp),%esi
+  80094b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80094e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800951:	01 d0                	add    %edx,%eax
+  800953:	29 c8                	sub    %ecx,%eax
+  800955:	89 c7                	mov    %eax,%edi
+  800957:	eb 13                	jmp    80096c <vprintfmt+0x25c>
+  800959:	8b 75 08             	mov    0x8(%ebp),%esi
+  80095c:	eb ed                	jmp    80094b <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80095e:	83 ec 08             	sub    $0x8,%esp
+  800961:	53                   	push   %ebx
+  800962:	6a 20                	push   $0x20
+  800964:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800966:	83 ef 01             	sub    $0x1,%edi
+  800969:	83 c4 10             	add    $0x10,%esp
+  80096c:	85 ff                	test   %edi,%edi
+  80096e:	7f ee                	jg     80095e <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800970:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800973:	89 45 14             	mov    %eax,0x14(%ebp)
+  800976:	e9 1d 01 00 00       	jmp    800a98 <vprintfmt+0x388>
+	if (lflag >= 2)
+  80097b:	83 f9 01             	cmp    $0x1,%ecx
+  80097e:	7f 1b                	jg     80099b <vprintfmt+0x28b>
+	else if (lflag)
+  800980:	85 c9                	test   %ecx,%ecx
+  800982:	74 63                	je     8009e7 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800984:	8b 45 14             	mov    0x14(%ebp),%eax
+  800987:	8b 00                	mov    (%eax),%eax
+  800989:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80098c:	99                   	cltd
+  80098d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800990:	8b 45 14             	mov    0x14(%ebp),%eax
+  800993:	8d 40 04             	lea    0x4(%eax),%eax
+  800996:	89 45 14             	mov    %eax,0x14(%ebp)
+  800999:	eb 17                	jmp    8009b2 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80099b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099e:	8b 50 04             	mov    0x4(%eax),%edx
+  8009a1:	8b 00                	mov    (%eax),%eax
+  8009a3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009a6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8009a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ac:	8d 40 08             	lea    0x8(%eax),%eax
+  8009af:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8009b2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8009b5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8009b8:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8009bd:	85 c9                	test   %ecx,%ecx
+  8009bf:	0f 89 b9 00 00 00    	jns    800a7e <vprintfmt+0x36e>
+				putch('-', putdat);
+  8009c5:	83 ec 08             	sub    $0x8,%esp
+  8009c8:	53                   	push   %ebx
+  8009c9:	6a 2d                	push   $0x2d
+  8009cb:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8009cd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8009d0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8009d3:	f7 da                	neg    %edx
+  8009d5:	83 d1 00             	adc    $0x0,%ecx
+  8009d8:	f7 d9                	neg    %ecx
+  8009da:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8009dd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8009e2:	e9 97 00 00 00       	jmp    800a7e <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8009e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ea:	8b 00                	mov    (%eax),%eax
+  8009ec:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009ef:	99                   	cltd
+  8009f0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8009f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8009f9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009fc:	eb b4                	jmp    8009b2 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8009fe:	83 f9 01             	cmp    $0x1,%ecx
+  800a01:	7f 1b                	jg     800a1e <vprintfmt+0x30e>
+	else if (lflag)
+  800a03:	85 c9                	test   %ecx,%ecx
+  800a05:	74 2c                	je     800a33 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800a07:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0a:	8b 10                	mov    (%eax),%edx
+  800a0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a11:	8d 40 04             	lea    0x4(%eax),%eax
+  800a14:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a17:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800a1c:	eb 60                	jmp    800a7e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800a1e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a21:	8b 10                	mov    (%eax),%edx
+  800a23:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a26:	8d 40 08             	lea    0x8(%eax),%eax
+  800a29:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a2c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800a31:	eb 4b                	jmp    800a7e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800a33:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a36:	8b 10                	mov    (%eax),%edx
+  800a38:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a3d:	8d 40 04             	lea    0x4(%eax),%eax
+  800a40:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a43:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800a48:	eb 34                	jmp    800a7e <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800a4a:	83 f9 01             	cmp    $0x1,%ecx
+  800a4d:	7f 15                	jg     800a64 <vprintfmt+0x354>
+	else if (lflag)
+  800a4f:	85 c9                	test   %ecx,%ecx
+  800a51:	74 4d                	je     800aa0 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800a53:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a56:	8b 00                	mov    (%eax),%eax
+  800a58:	99                   	cltd
+  800a59:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800a5c:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800a5f:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800a62:	eb 11                	jmp    800a75 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800a64:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a67:	8b 50 04             	mov    0x4(%eax),%edx
+  800a6a:	8b 00                	mov    (%eax),%eax
+  800a6c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800a6f:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800a72:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800a75:	89 d1                	mov    %edx,%ecx
+  800a77:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800a79:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800a7e:	83 ec 0c             	sub    $0xc,%esp
+  800a81:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800a85:	50                   	push   %eax
+  800a86:	ff 75 e0             	push   -0x20(%ebp)
+  800a89:	57                   	push   %edi
+  800a8a:	51                   	push   %ecx
+  800a8b:	52                   	push   %edx
+  800a8c:	89 da                	mov    %ebx,%edx
+  800a8e:	89 f0                	mov    %esi,%eax
+  800a90:	e8 98 fb ff ff       	call   80062d <printnum>
+			break;
+  800a95:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800a98:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a9b:	e9 8e fc ff ff       	jmp    80072e <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800aa0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa3:	8b 00                	mov    (%eax),%eax
+  800aa5:	99                   	cltd
+  800aa6:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800aa9:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800aac:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800aaf:	eb c4                	jmp    800a75 <vprintfmt+0x365>
+			putch('0', putdat);
+  800ab1:	83 ec 08             	sub    $0x8,%esp
+  800ab4:	53                   	push   %ebx
+  800ab5:	6a 30                	push   $0x30
+  800ab7:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800ab9:	83 c4 08             	add    $0x8,%esp
+  800abc:	53                   	push   %ebx
+  800abd:	6a 78                	push   $0x78
+  800abf:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800ac1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ac4:	8b 10                	mov    (%eax),%edx
+  800ac6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800acb:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800ace:	8d 40 04             	lea    0x4(%eax),%eax
+  800ad1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ad4:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800ad9:	eb a3                	jmp    800a7e <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800adb:	83 f9 01             	cmp    $0x1,%ecx
+  800ade:	7f 1b                	jg     800afb <vprintfmt+0x3eb>
+	else if (lflag)
+  800ae0:	85 c9                	test   %ecx,%ecx
+  800ae2:	74 2f                	je     800b13 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800ae4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ae7:	8b 10                	mov    (%eax),%edx
+  800ae9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aee:	8d 40 04             	lea    0x4(%eax),%eax
+  800af1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800af4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800af9:	eb 83                	jmp    800a7e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800afb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800afe:	8b 10                	mov    (%eax),%edx
+  800b00:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b03:	8d 40 08             	lea    0x8(%eax),%eax
+  800b06:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b09:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800b0e:	e9 6b ff ff ff       	jmp    800a7e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800b13:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b16:	8b 10                	mov    (%eax),%edx
+  800b18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b1d:	8d 40 04             	lea    0x4(%eax),%eax
+  800b20:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b23:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800b28:	e9 51 ff ff ff       	jmp    800a7e <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800b2d:	83 ec 08             	sub    $0x8,%esp
+  800b30:	53                   	push   %ebx
+  800b31:	6a 25                	push   $0x25
+  800b33:	ff d6                	call   *%esi
+			break;
+  800b35:	83 c4 10             	add    $0x10,%esp
+  800b38:	e9 5b ff ff ff       	jmp    800a98 <vprintfmt+0x388>
+			putch('%', putdat);
+  800b3d:	83 ec 08             	sub    $0x8,%esp
+  800b40:	53                   	push   %ebx
+  800b41:	6a 25                	push   $0x25
+  800b43:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b45:	83 c4 10             	add    $0x10,%esp
+  800b48:	89 f8                	mov    %edi,%eax
+  800b4a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800b4e:	74 05                	je     800b55 <vprintfmt+0x445>
+  800b50:	83 e8 01             	sub    $0x1,%eax
+  800b53:	eb f5                	jmp    800b4a <vprintfmt+0x43a>
+  800b55:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800b58:	e9 3b ff ff ff       	jmp    800a98 <vprintfmt+0x388>
+
+00800b5d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b5d:	55                   	push   %ebp
+  800b5e:	89 e5                	mov    %esp,%ebp
+  800b60:	83 ec 18             	sub    $0x18,%esp
+  800b63:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b66:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b69:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b6c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b70:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b73:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b7a:	85 c0                	test   %eax,%eax
+  800b7c:	74 26                	je     800ba4 <vsnprintf+0x47>
+  800b7e:	85 d2                	test   %edx,%edx
+  800b80:	7e 22                	jle    800ba4 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b82:	ff 75 14             	push   0x14(%ebp)
+  800b85:	ff 75 10             	push   0x10(%ebp)
+  800b88:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b8b:	50                   	push   %eax
+  800b8c:	68 d6 06 80 00       	push   $0x8006d6
+  800b91:	e8 7a fb ff ff       	call   800710 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b96:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b99:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b9f:	83 c4 10             	add    $0x10,%esp
+}
+  800ba2:	c9                   	leave
+  800ba3:	c3                   	ret
+		return -E_INVAL;
+  800ba4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ba9:	eb f7                	jmp    800ba2 <vsnprintf+0x45>
+
+00800bab <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800bab:	55                   	push   %ebp
+  800bac:	89 e5                	mov    %esp,%ebp
+  800bae:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800bb1:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800bb4:	50                   	push   %eax
+  800bb5:	ff 75 10             	push   0x10(%ebp)
+  800bb8:	ff 75 0c             	push   0xc(%ebp)
+  800bbb:	ff 75 08             	push   0x8(%ebp)
+  800bbe:	e8 9a ff ff ff       	call   800b5d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800bc3:	c9                   	leave
+  800bc4:	c3                   	ret
+
+00800bc5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800bc5:	55                   	push   %ebp
+  800bc6:	89 e5                	mov    %esp,%ebp
+  800bc8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd0:	eb 03                	jmp    800bd5 <strlen+0x10>
+		n++;
+  800bd2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800bd5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800bd9:	75 f7                	jne    800bd2 <strlen+0xd>
+	return n;
+}
+  800bdb:	5d                   	pop    %ebp
+  800bdc:	c3                   	ret
+
+00800bdd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800bdd:	55                   	push   %ebp
+  800bde:	89 e5                	mov    %esp,%ebp
+  800be0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800be3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800be6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800beb:	eb 03                	jmp    800bf0 <strnlen+0x13>
+		n++;
+  800bed:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bf0:	39 d0                	cmp    %edx,%eax
+  800bf2:	74 08                	je     800bfc <strnlen+0x1f>
+  800bf4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800bf8:	75 f3                	jne    800bed <strnlen+0x10>
+  800bfa:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800bfc:	89 d0                	mov    %edx,%eax
+  800bfe:	5d                   	pop    %ebp
+  800bff:	c3                   	ret
+
+00800c00 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c00:	55                   	push   %ebp
+  800c01:	89 e5                	mov    %esp,%ebp
+  800c03:	53                   	push   %ebx
+  800c04:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c07:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800c0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c0f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800c13:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800c16:	83 c0 01             	add    $0x1,%eax
+  800c19:	84 d2                	test   %dl,%dl
+  800c1b:	75 f2                	jne    800c0f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800c1d:	89 c8                	mov    %ecx,%eax
+  800c1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c22:	c9                   	leave
+  800c23:	c3                   	ret
+
+00800c24 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	53                   	push   %ebx
+  800c28:	83 ec 10             	sub    $0x10,%esp
+  800c2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c2e:	53                   	push   %ebx
+  800c2f:	e8 91 ff ff ff       	call   800bc5 <strlen>
+  800c34:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800c37:	ff 75 0c             	push   0xc(%ebp)
+  800c3a:	01 d8                	add    %ebx,%eax
+  800c3c:	50                   	push   %eax
+  800c3d:	e8 be ff ff ff       	call   800c00 <strcpy>
+	return dst;
+}
+  800c42:	89 d8                	mov    %ebx,%eax
+  800c44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c47:	c9                   	leave
+  800c48:	c3                   	ret
+
+00800c49 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c49:	55                   	push   %ebp
+  800c4a:	89 e5                	mov    %esp,%ebp
+  800c4c:	56                   	push   %esi
+  800c4d:	53                   	push   %ebx
+  800c4e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c51:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c54:	89 f3                	mov    %esi,%ebx
+  800c56:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c59:	89 f0                	mov    %esi,%eax
+  800c5b:	eb 0f                	jmp    800c6c <strncpy+0x23>
+		*dst++ = *src;
+  800c5d:	83 c0 01             	add    $0x1,%eax
+  800c60:	0f b6 0a             	movzbl (%edx),%ecx
+  800c63:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c66:	80 f9 01             	cmp    $0x1,%cl
+  800c69:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c6c:	39 d8                	cmp    %ebx,%eax
+  800c6e:	75 ed                	jne    800c5d <strncpy+0x14>
+	}
+	return ret;
+}
+  800c70:	89 f0                	mov    %esi,%eax
+  800c72:	5b                   	pop    %ebx
+  800c73:	5e                   	pop    %esi
+  800c74:	5d                   	pop    %ebp
+  800c75:	c3                   	ret
+
+00800c76 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c76:	55                   	push   %ebp
+  800c77:	89 e5                	mov    %esp,%ebp
+  800c79:	56                   	push   %esi
+  800c7a:	53                   	push   %ebx
+  800c7b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c81:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c84:	89 f0                	mov    %esi,%eax
+  800c86:	85 d2                	test   %edx,%edx
+  800c88:	74 21                	je     800cab <strlcpy+0x35>
+  800c8a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c8e:	89 f2                	mov    %esi,%edx
+  800c90:	eb 09                	jmp    800c9b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c92:	83 c1 01             	add    $0x1,%ecx
+  800c95:	83 c2 01             	add    $0x1,%edx
+  800c98:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c9b:	39 c2                	cmp    %eax,%edx
+  800c9d:	74 09                	je     800ca8 <strlcpy+0x32>
+  800c9f:	0f b6 19             	movzbl (%ecx),%ebx
+  800ca2:	84 db                	test   %bl,%bl
+  800ca4:	75 ec                	jne    800c92 <strlcpy+0x1c>
+  800ca6:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800ca8:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800cab:	29 f0                	sub    %esi,%eax
+}
+  800cad:	5b                   	pop    %ebx
+  800cae:	5e                   	pop    %esi
+  800caf:	5d                   	pop    %ebp
+  800cb0:	c3                   	ret
+
+00800cb1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800cb1:	55                   	push   %ebp
+  800cb2:	89 e5                	mov    %esp,%ebp
+  800cb4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cb7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800cba:	eb 06                	jmp    800cc2 <strcmp+0x11>
+		p++, q++;
+  800cbc:	83 c1 01             	add    $0x1,%ecx
+  800cbf:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800cc2:	0f b6 01             	movzbl (%ecx),%eax
+  800cc5:	84 c0                	test   %al,%al
+  800cc7:	74 04                	je     800ccd <strcmp+0x1c>
+  800cc9:	3a 02                	cmp    (%edx),%al
+  800ccb:	74 ef                	je     800cbc <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ccd:	0f b6 c0             	movzbl %al,%eax
+  800cd0:	0f b6 12             	movzbl (%edx),%edx
+  800cd3:	29 d0                	sub    %edx,%eax
+}
+  800cd5:	5d                   	pop    %ebp
+  800cd6:	c3                   	ret
+
+00800cd7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800cd7:	55                   	push   %ebp
+  800cd8:	89 e5                	mov    %esp,%ebp
+  800cda:	53                   	push   %ebx
+  800cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800ce4:	eb 09                	jmp    800cef <strncmp+0x18>
+		n--, p++, q++;
+  800ce6:	83 ea 01             	sub    $0x1,%edx
+  800ce9:	83 c0 01             	add    $0x1,%eax
+  800cec:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800cef:	85 d2                	test   %edx,%edx
+  800cf1:	74 18                	je     800d0b <strncmp+0x34>
+  800cf3:	0f b6 18             	movzbl (%eax),%ebx
+  800cf6:	84 db                	test   %bl,%bl
+  800cf8:	74 04                	je     800cfe <strncmp+0x27>
+  800cfa:	3a 19                	cmp    (%ecx),%bl
+  800cfc:	74 e8                	je     800ce6 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cfe:	0f b6 00             	movzbl (%eax),%eax
+  800d01:	0f b6 11             	movzbl (%ecx),%edx
+  800d04:	29 d0                	sub    %edx,%eax
+}
+  800d06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d09:	c9                   	leave
+  800d0a:	c3                   	ret
+		return 0;
+  800d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d10:	eb f4                	jmp    800d06 <strncmp+0x2f>
+
+00800d12 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800d12:	55                   	push   %ebp
+  800d13:	89 e5                	mov    %esp,%ebp
+  800d15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d18:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d1c:	eb 03                	jmp    800d21 <strchr+0xf>
+  800d1e:	83 c0 01             	add    $0x1,%eax
+  800d21:	0f b6 10             	movzbl (%eax),%edx
+  800d24:	84 d2                	test   %dl,%dl
+  800d26:	74 06                	je     800d2e <strchr+0x1c>
+		if (*s == c)
+  800d28:	38 ca                	cmp    %cl,%dl
+  800d2a:	75 f2                	jne    800d1e <strchr+0xc>
+  800d2c:	eb 05                	jmp    800d33 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800d2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d33:	5d                   	pop    %ebp
+  800d34:	c3                   	ret
+
+00800d35 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d35:	55                   	push   %ebp
+  800d36:	89 e5                	mov    %esp,%ebp
+  800d38:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d3b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d3f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d42:	38 ca                	cmp    %cl,%dl
+  800d44:	74 09                	je     800d4f <strfind+0x1a>
+  800d46:	84 d2                	test   %dl,%dl
+  800d48:	74 05                	je     800d4f <strfind+0x1a>
+	for (; *s; s++)
+  800d4a:	83 c0 01             	add    $0x1,%eax
+  800d4d:	eb f0                	jmp    800d3f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800d4f:	5d                   	pop    %ebp
+  800d50:	c3                   	ret
+
+00800d51 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d51:	55                   	push   %ebp
+  800d52:	89 e5                	mov    %esp,%ebp
+  800d54:	57                   	push   %edi
+  800d55:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d58:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d5b:	85 c9                	test   %ecx,%ecx
+  800d5d:	74 20                	je     800d7f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d5f:	89 f8                	mov    %edi,%eax
+  800d61:	09 c8                	or     %ecx,%eax
+  800d63:	a8 03                	test   $0x3,%al
+  800d65:	75 12                	jne    800d79 <memset+0x28>
+		c &= 0xFF;
+  800d67:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d6b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d71:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d74:	fc                   	cld
+  800d75:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d77:	eb 06                	jmp    800d7f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d7c:	fc                   	cld
+  800d7d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d7f:	89 f8                	mov    %edi,%eax
+  800d81:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d84:	c9                   	leave
+  800d85:	c3                   	ret
+
+00800d86 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d86:	55                   	push   %ebp
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	57                   	push   %edi
+  800d8a:	56                   	push   %esi
+  800d8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d8e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d91:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d94:	39 c6                	cmp    %eax,%esi
+  800d96:	73 32                	jae    800dca <memmove+0x44>
+  800d98:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d9b:	39 d0                	cmp    %edx,%eax
+  800d9d:	73 2b                	jae    800dca <memmove+0x44>
+		s += n;
+		d += n;
+  800d9f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800da2:	89 d6                	mov    %edx,%esi
+  800da4:	09 fe                	or     %edi,%esi
+  800da6:	09 ce                	or     %ecx,%esi
+  800da8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800dae:	75 0e                	jne    800dbe <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800db0:	83 ef 04             	sub    $0x4,%edi
+  800db3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800db6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800db9:	fd                   	std
+  800dba:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800dbc:	eb 09                	jmp    800dc7 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800dbe:	83 ef 01             	sub    $0x1,%edi
+  800dc1:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800dc4:	fd                   	std
+  800dc5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800dc7:	fc                   	cld
+  800dc8:	eb 1a                	jmp    800de4 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800dca:	89 f2                	mov    %esi,%edx
+  800dcc:	09 c2                	or     %eax,%edx
+  800dce:	09 ca                	or     %ecx,%edx
+  800dd0:	f6 c2 03             	test   $0x3,%dl
+  800dd3:	75 0a                	jne    800ddf <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800dd5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800dd8:	89 c7                	mov    %eax,%edi
+  800dda:	fc                   	cld
+  800ddb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ddd:	eb 05                	jmp    800de4 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ddf:	89 c7                	mov    %eax,%edi
+  800de1:	fc                   	cld
+  800de2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800de4:	5e                   	pop    %esi
+  800de5:	5f                   	pop    %edi
+  800de6:	5d                   	pop    %ebp
+  800de7:	c3                   	ret
+
+00800de8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800de8:	55                   	push   %ebp
+  800de9:	89 e5                	mov    %esp,%ebp
+  800deb:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800dee:	ff 75 10             	push   0x10(%ebp)
+  800df1:	ff 75 0c             	push   0xc(%ebp)
+  800df4:	ff 75 08             	push   0x8(%ebp)
+  800df7:	e8 8a ff ff ff       	call   800d86 <memmove>
+}
+  800dfc:	c9                   	leave
+  800dfd:	c3                   	ret
+
+00800dfe <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	56                   	push   %esi
+  800e02:	53                   	push   %ebx
+  800e03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e06:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e09:	89 c6                	mov    %eax,%esi
+  800e0b:	03 75 10             	add    0x10(%ebp),%esi
+  800e0e:	eb 06                	jmp    800e16 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800e10:	83 c0 01             	add    $0x1,%eax
+  800e13:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800e16:	39 f0                	cmp    %esi,%eax
+  800e18:	74 14                	je     800e2e <memcmp+0x30>
+		if (*s1 != *s2)
+  800e1a:	0f b6 08             	movzbl (%eax),%ecx
+  800e1d:	0f b6 1a             	movzbl (%edx),%ebx
+  800e20:	38 d9                	cmp    %bl,%cl
+  800e22:	74 ec                	je     800e10 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800e24:	0f b6 c1             	movzbl %cl,%eax
+  800e27:	0f b6 db             	movzbl %bl,%ebx
+  800e2a:	29 d8                	sub    %ebx,%eax
+  800e2c:	eb 05                	jmp    800e33 <memcmp+0x35>
+	}
+
+	return 0;
+  800e2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e33:	5b                   	pop    %ebx
+  800e34:	5e                   	pop    %esi
+  800e35:	5d                   	pop    %ebp
+  800e36:	c3                   	ret
+
+00800e37 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e37:	55                   	push   %ebp
+  800e38:	89 e5                	mov    %esp,%ebp
+  800e3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e40:	89 c2                	mov    %eax,%edx
+  800e42:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e45:	eb 03                	jmp    800e4a <memfind+0x13>
+  800e47:	83 c0 01             	add    $0x1,%eax
+  800e4a:	39 d0                	cmp    %edx,%eax
+  800e4c:	73 04                	jae    800e52 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e4e:	38 08                	cmp    %cl,(%eax)
+  800e50:	75 f5                	jne    800e47 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800e52:	5d                   	pop    %ebp
+  800e53:	c3                   	ret
+
+00800e54 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	57                   	push   %edi
+  800e58:	56                   	push   %esi
+  800e59:	53                   	push   %ebx
+  800e5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e60:	eb 03                	jmp    800e65 <strtol+0x11>
+		s++;
+  800e62:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e65:	0f b6 02             	movzbl (%edx),%eax
+  800e68:	3c 20                	cmp    $0x20,%al
+  800e6a:	74 f6                	je     800e62 <strtol+0xe>
+  800e6c:	3c 09                	cmp    $0x9,%al
+  800e6e:	74 f2                	je     800e62 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e70:	3c 2b                	cmp    $0x2b,%al
+  800e72:	74 2a                	je     800e9e <strtol+0x4a>
+	int neg = 0;
+  800e74:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e79:	3c 2d                	cmp    $0x2d,%al
+  800e7b:	74 2b                	je     800ea8 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e7d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e83:	75 0f                	jne    800e94 <strtol+0x40>
+  800e85:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e88:	74 28                	je     800eb2 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e8a:	85 db                	test   %ebx,%ebx
+  800e8c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e91:	0f 44 d8             	cmove  %eax,%ebx
+  800e94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e99:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e9c:	eb 46                	jmp    800ee4 <strtol+0x90>
+		s++;
+  800e9e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ea1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ea6:	eb d5                	jmp    800e7d <strtol+0x29>
+		s++, neg = 1;
+  800ea8:	83 c2 01             	add    $0x1,%edx
+  800eab:	bf 01 00 00 00       	mov    $0x1,%edi
+  800eb0:	eb cb                	jmp    800e7d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800eb2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800eb6:	74 0e                	je     800ec6 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800eb8:	85 db                	test   %ebx,%ebx
+  800eba:	75 d8                	jne    800e94 <strtol+0x40>
+		s++, base = 8;
+  800ebc:	83 c2 01             	add    $0x1,%edx
+  800ebf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ec4:	eb ce                	jmp    800e94 <strtol+0x40>
+		s += 2, base = 16;
+  800ec6:	83 c2 02             	add    $0x2,%edx
+  800ec9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ece:	eb c4                	jmp    800e94 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ed0:	0f be c0             	movsbl %al,%eax
+  800ed3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ed6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ed9:	7d 3a                	jge    800f15 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800edb:	83 c2 01             	add    $0x1,%edx
+  800ede:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ee2:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ee4:	0f b6 02             	movzbl (%edx),%eax
+  800ee7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800eea:	89 f3                	mov    %esi,%ebx
+  800eec:	80 fb 09             	cmp    $0x9,%bl
+  800eef:	76 df                	jbe    800ed0 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ef1:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ef4:	89 f3                	mov    %esi,%ebx
+  800ef6:	80 fb 19             	cmp    $0x19,%bl
+  800ef9:	77 08                	ja     800f03 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800efb:	0f be c0             	movsbl %al,%eax
+  800efe:	83 e8 57             	sub    $0x57,%eax
+  800f01:	eb d3                	jmp    800ed6 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f03:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800f06:	89 f3                	mov    %esi,%ebx
+  800f08:	80 fb 19             	cmp    $0x19,%bl
+  800f0b:	77 08                	ja     800f15 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800f0d:	0f be c0             	movsbl %al,%eax
+  800f10:	83 e8 37             	sub    $0x37,%eax
+  800f13:	eb c1                	jmp    800ed6 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f15:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f19:	74 05                	je     800f20 <strtol+0xcc>
+		*endptr = (char *) s;
+  800f1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f1e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800f20:	89 c8                	mov    %ecx,%eax
+  800f22:	f7 d8                	neg    %eax
+  800f24:	85 ff                	test   %edi,%edi
+  800f26:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800f29:	89 c8                	mov    %ecx,%eax
+  800f2b:	5b                   	pop    %ebx
+  800f2c:	5e                   	pop    %esi
+  800f2d:	5f                   	pop    %edi
+  800f2e:	5d                   	pop    %ebp
+  800f2f:	c3                   	ret
+
+00800f30 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800f30:	55                   	push   %ebp
+  800f31:	89 e5                	mov    %esp,%ebp
+  800f33:	57                   	push   %edi
+  800f34:	56                   	push   %esi
+  800f35:	53                   	push   %ebx
+  800f36:	83 ec 0c             	sub    $0xc,%esp
+  800f39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800f3c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800f3f:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800f42:	85 ff                	test   %edi,%edi
+  800f44:	74 16                	je     800f5c <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800f46:	83 ec 04             	sub    $0x4,%esp
+  800f49:	56                   	push   %esi
+  800f4a:	6a 00                	push   $0x0
+  800f4c:	53                   	push   %ebx
+  800f4d:	e8 02 ff ff ff       	call   800e54 <strtol>
+  800f52:	89 07                	mov    %eax,(%edi)
+  800f54:	83 c4 10             	add    $0x10,%esp
+  800f57:	eb 03                	jmp    800f5c <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800f59:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800f5c:	0f b6 03             	movzbl (%ebx),%eax
+  800f5f:	3c 20                	cmp    $0x20,%al
+  800f61:	74 f6                	je     800f59 <strisl+0x29>
+  800f63:	3c 09                	cmp    $0x9,%al
+  800f65:	74 f2                	je     800f59 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800f67:	3c 2b                	cmp    $0x2b,%al
+  800f69:	74 23                	je     800f8e <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800f6b:	3c 2d                	cmp    $0x2d,%al
+  800f6d:	0f 94 c0             	sete   %al
+  800f70:	0f b6 c0             	movzbl %al,%eax
+  800f73:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f75:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800f7b:	75 41                	jne    800fbe <strisl+0x8e>
+  800f7d:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800f80:	74 11                	je     800f93 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800f82:	85 f6                	test   %esi,%esi
+  800f84:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f89:	0f 44 f0             	cmove  %eax,%esi
+  800f8c:	eb 30                	jmp    800fbe <strisl+0x8e>
+		s++;
+  800f8e:	83 c3 01             	add    $0x1,%ebx
+  800f91:	eb e2                	jmp    800f75 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f93:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800f97:	74 0e                	je     800fa7 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800f99:	85 f6                	test   %esi,%esi
+  800f9b:	75 21                	jne    800fbe <strisl+0x8e>
+		s++, base = 8;
+  800f9d:	83 c3 01             	add    $0x1,%ebx
+  800fa0:	be 08 00 00 00       	mov    $0x8,%esi
+  800fa5:	eb 17                	jmp    800fbe <strisl+0x8e>
+		s += 2, base = 16;
+  800fa7:	83 c3 02             	add    $0x2,%ebx
+  800faa:	be 10 00 00 00       	mov    $0x10,%esi
+  800faf:	eb 0d                	jmp    800fbe <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800fb1:	0f be c0             	movsbl %al,%eax
+  800fb4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800fb7:	39 f0                	cmp    %esi,%eax
+  800fb9:	7d 38                	jge    800ff3 <strisl+0xc3>
+			return 0;
+		s++;
+  800fbb:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800fbe:	0f b6 03             	movzbl (%ebx),%eax
+  800fc1:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800fc4:	80 fa 09             	cmp    $0x9,%dl
+  800fc7:	76 e8                	jbe    800fb1 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800fc9:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800fcc:	80 fa 19             	cmp    $0x19,%dl
+  800fcf:	77 08                	ja     800fd9 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800fd1:	0f be c0             	movsbl %al,%eax
+  800fd4:	83 e8 57             	sub    $0x57,%eax
+  800fd7:	eb de                	jmp    800fb7 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800fd9:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800fdc:	80 fa 19             	cmp    $0x19,%dl
+  800fdf:	77 08                	ja     800fe9 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800fe1:	0f be c0             	movsbl %al,%eax
+  800fe4:	83 e8 37             	sub    $0x37,%eax
+  800fe7:	eb ce                	jmp    800fb7 <strisl+0x87>
+		else if (!*s)
+  800fe9:	84 c0                	test   %al,%al
+  800feb:	0f 94 c0             	sete   %al
+  800fee:	0f b6 c0             	movzbl %al,%eax
+  800ff1:	eb 05                	jmp    800ff8 <strisl+0xc8>
+			return 0;
+  800ff3:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800ff8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ffb:	5b                   	pop    %ebx
+  800ffc:	5e                   	pop    %esi
+  800ffd:	5f                   	pop    %edi
+  800ffe:	5d                   	pop    %ebp
+  800fff:	c3                   	ret
+
+00801000 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	83 ec 10             	sub    $0x10,%esp
+  801006:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  801009:	89 c8                	mov    %ecx,%eax
+  80100b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801010:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801013:	eb 0b                	jmp    801020 <touch_mem+0x20>
+		c = *(char *)page;
+  801015:	0f b6 10             	movzbl (%eax),%edx
+  801018:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  80101b:	05 00 10 00 00       	add    $0x1000,%eax
+  801020:	39 c8                	cmp    %ecx,%eax
+  801022:	72 f1                	jb     801015 <touch_mem+0x15>
+}
+  801024:	c9                   	leave
+  801025:	c3                   	ret
+
+00801026 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801026:	55                   	push   %ebp
+  801027:	89 e5                	mov    %esp,%ebp
+  801029:	57                   	push   %edi
+  80102a:	56                   	push   %esi
+  80102b:	53                   	push   %ebx
+	touch_mem(s, len);
+  80102c:	ff 75 0c             	push   0xc(%ebp)
+  80102f:	ff 75 08             	push   0x8(%ebp)
+  801032:	e8 c9 ff ff ff       	call   801000 <touch_mem>
+	asm volatile("int %1\n"
+  801037:	b8 00 00 00 00       	mov    $0x0,%eax
+  80103c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801042:	89 c3                	mov    %eax,%ebx
+  801044:	89 c7                	mov    %eax,%edi
+  801046:	89 c6                	mov    %eax,%esi
+  801048:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80104a:	83 c4 08             	add    $0x8,%esp
+  80104d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801050:	5b                   	pop    %ebx
+  801051:	5e                   	pop    %esi
+  801052:	5f                   	pop    %edi
+  801053:	5d                   	pop    %ebp
+  801054:	c3                   	ret
+
+00801055 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	57                   	push   %edi
+  801059:	56                   	push   %esi
+  80105a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80105b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801060:	b8 01 00 00 00       	mov    $0x1,%eax
+  801065:	89 d1                	mov    %edx,%ecx
+  801067:	89 d3                	mov    %edx,%ebx
+  801069:	89 d7                	mov    %edx,%edi
+  80106b:	89 d6                	mov    %edx,%esi
+  80106d:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80106f:	5b                   	pop    %ebx
+  801070:	5e                   	pop    %esi
+  801071:	5f                   	pop    %edi
+  801072:	5d                   	pop    %ebp
+  801073:	c3                   	ret
+
+00801074 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801074:	55                   	push   %ebp
+  801075:	89 e5                	mov    %esp,%ebp
+  801077:	57                   	push   %edi
+  801078:	56                   	push   %esi
+  801079:	53                   	push   %ebx
+  80107a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80107d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801082:	8b 55 08             	mov    0x8(%ebp),%edx
+  801085:	b8 03 00 00 00       	mov    $0x3,%eax
+  80108a:	89 cb                	mov    %ecx,%ebx
+  80108c:	89 cf                	mov    %ecx,%edi
+  80108e:	89 ce                	mov    %ecx,%esi
+  801090:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801092:	85 c0                	test   %eax,%eax
+  801094:	7f 08                	jg     80109e <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801096:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801099:	5b                   	pop    %ebx
+  80109a:	5e                   	pop    %esi
+  80109b:	5f                   	pop    %edi
+  80109c:	5d                   	pop    %ebp
+  80109d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109e:	83 ec 0c             	sub    $0xc,%esp
+  8010a1:	50                   	push   %eax
+  8010a2:	6a 03                	push   $0x3
+  8010a4:	68 eb 57 80 00       	push   $0x8057eb
+  8010a9:	6a 23                	push   $0x23
+  8010ab:	68 08 58 80 00       	push   $0x805808
+  8010b0:	e8 89 f4 ff ff       	call   80053e <_panic>
+
+008010b5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8010b5:	55                   	push   %ebp
+  8010b6:	89 e5                	mov    %esp,%ebp
+  8010b8:	57                   	push   %edi
+  8010b9:	56                   	push   %esi
+  8010ba:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010c5:	89 d1                	mov    %edx,%ecx
+  8010c7:	89 d3                	mov    %edx,%ebx
+  8010c9:	89 d7                	mov    %edx,%edi
+  8010cb:	89 d6                	mov    %edx,%esi
+  8010cd:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8010cf:	5b                   	pop    %ebx
+  8010d0:	5e                   	pop    %esi
+  8010d1:	5f                   	pop    %edi
+  8010d2:	5d                   	pop    %ebp
+  8010d3:	c3                   	ret
+
+008010d4 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8010d4:	55                   	push   %ebp
+  8010d5:	89 e5                	mov    %esp,%ebp
+  8010d7:	57                   	push   %edi
+  8010d8:	56                   	push   %esi
+  8010d9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010df:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010e4:	89 d1                	mov    %edx,%ecx
+  8010e6:	89 d3                	mov    %edx,%ebx
+  8010e8:	89 d7                	mov    %edx,%edi
+  8010ea:	89 d6                	mov    %edx,%esi
+  8010ec:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8010ee:	5b                   	pop    %ebx
+  8010ef:	5e                   	pop    %esi
+  8010f0:	5f                   	pop    %edi
+  8010f1:	5d                   	pop    %ebp
+  8010f2:	c3                   	ret
+
+008010f3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8010f3:	55                   	push   %ebp
+  8010f4:	89 e5                	mov    %esp,%ebp
+  8010f6:	57                   	push   %edi
+  8010f7:	56                   	push   %esi
+  8010f8:	53                   	push   %ebx
+  8010f9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801101:	8b 55 08             	mov    0x8(%ebp),%edx
+  801104:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801107:	b8 04 00 00 00       	mov    $0x4,%eax
+  80110c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80110f:	89 f7                	mov    %esi,%edi
+  801111:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801113:	85 c0                	test   %eax,%eax
+  801115:	7f 08                	jg     80111f <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801117:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111a:	5b                   	pop    %ebx
+  80111b:	5e                   	pop    %esi
+  80111c:	5f                   	pop    %edi
+  80111d:	5d                   	pop    %ebp
+  80111e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80111f:	83 ec 0c             	sub    $0xc,%esp
+  801122:	50                   	push   %eax
+  801123:	6a 04                	push   $0x4
+  801125:	68 eb 57 80 00       	push   $0x8057eb
+  80112a:	6a 23                	push   $0x23
+  80112c:	68 08 58 80 00       	push   $0x805808
+  801131:	e8 08 f4 ff ff       	call   80053e <_panic>
+
+00801136 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801136:	55                   	push   %ebp
+  801137:	89 e5                	mov    %esp,%ebp
+  801139:	57                   	push   %edi
+  80113a:	56                   	push   %esi
+  80113b:	53                   	push   %ebx
+  80113c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80113f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801142:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801145:	b8 05 00 00 00       	mov    $0x5,%eax
+  80114a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80114d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801150:	8b 75 18             	mov    0x18(%ebp),%esi
+  801153:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801155:	85 c0                	test   %eax,%eax
+  801157:	7f 08                	jg     801161 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801159:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115c:	5b                   	pop    %ebx
+  80115d:	5e                   	pop    %esi
+  80115e:	5f                   	pop    %edi
+  80115f:	5d                   	pop    %ebp
+  801160:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801161:	83 ec 0c             	sub    $0xc,%esp
+  801164:	50                   	push   %eax
+  801165:	6a 05                	push   $0x5
+  801167:	68 eb 57 80 00       	push   $0x8057eb
+  80116c:	6a 23                	push   $0x23
+  80116e:	68 08 58 80 00       	push   $0x805808
+  801173:	e8 c6 f3 ff ff       	call   80053e <_panic>
+
+00801178 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801178:	55                   	push   %ebp
+  801179:	89 e5                	mov    %esp,%ebp
+  80117b:	57                   	push   %edi
+  80117c:	56                   	push   %esi
+  80117d:	53                   	push   %ebx
+  80117e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801181:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801186:	8b 55 08             	mov    0x8(%ebp),%edx
+  801189:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801191:	89 df                	mov    %ebx,%edi
+  801193:	89 de                	mov    %ebx,%esi
+  801195:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801197:	85 c0                	test   %eax,%eax
+  801199:	7f 08                	jg     8011a3 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80119b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80119e:	5b                   	pop    %ebx
+  80119f:	5e                   	pop    %esi
+  8011a0:	5f                   	pop    %edi
+  8011a1:	5d                   	pop    %ebp
+  8011a2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a3:	83 ec 0c             	sub    $0xc,%esp
+  8011a6:	50                   	push   %eax
+  8011a7:	6a 06                	push   $0x6
+  8011a9:	68 eb 57 80 00       	push   $0x8057eb
+  8011ae:	6a 23                	push   $0x23
+  8011b0:	68 08 58 80 00       	push   $0x805808
+  8011b5:	e8 84 f3 ff ff       	call   80053e <_panic>
+
+008011ba <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  8011ba:	55                   	push   %ebp
+  8011bb:	89 e5                	mov    %esp,%ebp
+  8011bd:	57                   	push   %edi
+  8011be:	56                   	push   %esi
+  8011bf:	53                   	push   %ebx
+  8011c0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ce:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011d3:	89 df                	mov    %ebx,%edi
+  8011d5:	89 de                	mov    %ebx,%esi
+  8011d7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011d9:	85 c0                	test   %eax,%eax
+  8011db:	7f 08                	jg     8011e5 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8011dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e0:	5b                   	pop    %ebx
+  8011e1:	5e                   	pop    %esi
+  8011e2:	5f                   	pop    %edi
+  8011e3:	5d                   	pop    %ebp
+  8011e4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e5:	83 ec 0c             	sub    $0xc,%esp
+  8011e8:	50                   	push   %eax
+  8011e9:	6a 18                	push   $0x18
+  8011eb:	68 eb 57 80 00       	push   $0x8057eb
+  8011f0:	6a 23                	push   $0x23
+  8011f2:	68 08 58 80 00       	push   $0x805808
+  8011f7:	e8 42 f3 ff ff       	call   80053e <_panic>
+
+008011fc <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  8011fc:	55                   	push   %ebp
+  8011fd:	89 e5                	mov    %esp,%ebp
+  8011ff:	57                   	push   %edi
+  801200:	56                   	push   %esi
+  801201:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801202:	be 00 00 00 00       	mov    $0x0,%esi
+  801207:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120d:	b8 19 00 00 00       	mov    $0x19,%eax
+  801212:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801215:	89 f7                	mov    %esi,%edi
+  801217:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  801219:	5b                   	pop    %ebx
+  80121a:	5e                   	pop    %esi
+  80121b:	5f                   	pop    %edi
+  80121c:	5d                   	pop    %ebp
+  80121d:	c3                   	ret
+
+0080121e <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  80121e:	55                   	push   %ebp
+  80121f:	89 e5                	mov    %esp,%ebp
+  801221:	57                   	push   %edi
+  801222:	56                   	push   %esi
+  801223:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801224:	8b 55 08             	mov    0x8(%ebp),%edx
+  801227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80122f:	be 00 00 00 00       	mov    $0x0,%esi
+  801234:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801237:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80123a:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  80123c:	5b                   	pop    %ebx
+  80123d:	5e                   	pop    %esi
+  80123e:	5f                   	pop    %edi
+  80123f:	5d                   	pop    %ebp
+  801240:	c3                   	ret
+
+00801241 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  801241:	55                   	push   %ebp
+  801242:	89 e5                	mov    %esp,%ebp
+  801244:	57                   	push   %edi
+  801245:	56                   	push   %esi
+  801246:	53                   	push   %ebx
+  801247:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  80124a:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  80124d:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801253:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  801256:	8b 55 08             	mov    0x8(%ebp),%edx
+  801259:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801261:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801264:	8b 75 18             	mov    0x18(%ebp),%esi
+  801267:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801269:	85 c0                	test   %eax,%eax
+  80126b:	7f 08                	jg     801275 <sys_page_map_range+0x34>
+}
+  80126d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801270:	5b                   	pop    %ebx
+  801271:	5e                   	pop    %esi
+  801272:	5f                   	pop    %edi
+  801273:	5d                   	pop    %ebp
+  801274:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801275:	83 ec 0c             	sub    $0xc,%esp
+  801278:	50                   	push   %eax
+  801279:	6a 10                	push   $0x10
+  80127b:	68 eb 57 80 00       	push   $0x8057eb
+  801280:	6a 23                	push   $0x23
+  801282:	68 08 58 80 00       	push   $0x805808
+  801287:	e8 b2 f2 ff ff       	call   80053e <_panic>
+
+0080128c <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  80128c:	55                   	push   %ebp
+  80128d:	89 e5                	mov    %esp,%ebp
+  80128f:	57                   	push   %edi
+  801290:	56                   	push   %esi
+  801291:	53                   	push   %ebx
+  801292:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801295:	be 00 00 00 00       	mov    $0x0,%esi
+  80129a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a0:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012a8:	89 f7                	mov    %esi,%edi
+  8012aa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012ac:	85 c0                	test   %eax,%eax
+  8012ae:	7f 08                	jg     8012b8 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8012b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b3:	5b                   	pop    %ebx
+  8012b4:	5e                   	pop    %esi
+  8012b5:	5f                   	pop    %edi
+  8012b6:	5d                   	pop    %ebp
+  8012b7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012b8:	83 ec 0c             	sub    $0xc,%esp
+  8012bb:	50                   	push   %eax
+  8012bc:	6a 11                	push   $0x11
+  8012be:	68 eb 57 80 00       	push   $0x8057eb
+  8012c3:	6a 23                	push   $0x23
+  8012c5:	68 08 58 80 00       	push   $0x805808
+  8012ca:	e8 6f f2 ff ff       	call   80053e <_panic>
+
+008012cf <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  8012cf:	55                   	push   %ebp
+  8012d0:	89 e5                	mov    %esp,%ebp
+  8012d2:	57                   	push   %edi
+  8012d3:	56                   	push   %esi
+  8012d4:	53                   	push   %ebx
+  8012d5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8012e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012eb:	89 f7                	mov    %esi,%edi
+  8012ed:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012ef:	85 c0                	test   %eax,%eax
+  8012f1:	7f 08                	jg     8012fb <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8012f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f6:	5b                   	pop    %ebx
+  8012f7:	5e                   	pop    %esi
+  8012f8:	5f                   	pop    %edi
+  8012f9:	5d                   	pop    %ebp
+  8012fa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012fb:	83 ec 0c             	sub    $0xc,%esp
+  8012fe:	50                   	push   %eax
+  8012ff:	6a 1b                	push   $0x1b
+  801301:	68 eb 57 80 00       	push   $0x8057eb
+  801306:	6a 23                	push   $0x23
+  801308:	68 08 58 80 00       	push   $0x805808
+  80130d:	e8 2c f2 ff ff       	call   80053e <_panic>
+
+00801312 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  801312:	55                   	push   %ebp
+  801313:	89 e5                	mov    %esp,%ebp
+  801315:	57                   	push   %edi
+  801316:	56                   	push   %esi
+  801317:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801318:	ba 00 00 00 00       	mov    $0x0,%edx
+  80131d:	b8 12 00 00 00       	mov    $0x12,%eax
+  801322:	89 d1                	mov    %edx,%ecx
+  801324:	89 d3                	mov    %edx,%ebx
+  801326:	89 d7                	mov    %edx,%edi
+  801328:	89 d6                	mov    %edx,%esi
+  80132a:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80132c:	5b                   	pop    %ebx
+  80132d:	5e                   	pop    %esi
+  80132e:	5f                   	pop    %edi
+  80132f:	5d                   	pop    %ebp
+  801330:	c3                   	ret
+
+00801331 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801331:	55                   	push   %ebp
+  801332:	89 e5                	mov    %esp,%ebp
+  801334:	57                   	push   %edi
+  801335:	56                   	push   %esi
+  801336:	53                   	push   %ebx
+  801337:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80133a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801342:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801345:	b8 08 00 00 00       	mov    $0x8,%eax
+  80134a:	89 df                	mov    %ebx,%edi
+  80134c:	89 de                	mov    %ebx,%esi
+  80134e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801350:	85 c0                	test   %eax,%eax
+  801352:	7f 08                	jg     80135c <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801354:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801357:	5b                   	pop    %ebx
+  801358:	5e                   	pop    %esi
+  801359:	5f                   	pop    %edi
+  80135a:	5d                   	pop    %ebp
+  80135b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80135c:	83 ec 0c             	sub    $0xc,%esp
+  80135f:	50                   	push   %eax
+  801360:	6a 08                	push   $0x8
+  801362:	68 eb 57 80 00       	push   $0x8057eb
+  801367:	6a 23                	push   $0x23
+  801369:	68 08 58 80 00       	push   $0x805808
+  80136e:	e8 cb f1 ff ff       	call   80053e <_panic>
+
+00801373 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801373:	55                   	push   %ebp
+  801374:	89 e5                	mov    %esp,%ebp
+  801376:	57                   	push   %edi
+  801377:	56                   	push   %esi
+  801378:	53                   	push   %ebx
+  801379:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  80137c:	6a 44                	push   $0x44
+  80137e:	ff 75 0c             	push   0xc(%ebp)
+  801381:	e8 7a fc ff ff       	call   801000 <touch_mem>
+	asm volatile("int %1\n"
+  801386:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80138e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801393:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801396:	89 df                	mov    %ebx,%edi
+  801398:	89 de                	mov    %ebx,%esi
+  80139a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80139c:	83 c4 08             	add    $0x8,%esp
+  80139f:	85 c0                	test   %eax,%eax
+  8013a1:	7f 08                	jg     8013ab <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8013a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a6:	5b                   	pop    %ebx
+  8013a7:	5e                   	pop    %esi
+  8013a8:	5f                   	pop    %edi
+  8013a9:	5d                   	pop    %ebp
+  8013aa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013ab:	83 ec 0c             	sub    $0xc,%esp
+  8013ae:	50                   	push   %eax
+  8013af:	6a 09                	push   $0x9
+  8013b1:	68 eb 57 80 00       	push   $0x8057eb
+  8013b6:	6a 23                	push   $0x23
+  8013b8:	68 08 58 80 00       	push   $0x805808
+  8013bd:	e8 7c f1 ff ff       	call   80053e <_panic>
+
+008013c2 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  8013c2:	55                   	push   %ebp
+  8013c3:	89 e5                	mov    %esp,%ebp
+  8013c5:	57                   	push   %edi
+  8013c6:	56                   	push   %esi
+  8013c7:	53                   	push   %ebx
+  8013c8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8013db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013de:	89 f7                	mov    %esi,%edi
+  8013e0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013e2:	85 c0                	test   %eax,%eax
+  8013e4:	7f 08                	jg     8013ee <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  8013e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e9:	5b                   	pop    %ebx
+  8013ea:	5e                   	pop    %esi
+  8013eb:	5f                   	pop    %edi
+  8013ec:	5d                   	pop    %ebp
+  8013ed:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013ee:	83 ec 0c             	sub    $0xc,%esp
+  8013f1:	50                   	push   %eax
+  8013f2:	6a 1a                	push   $0x1a
+  8013f4:	68 eb 57 80 00       	push   $0x8057eb
+  8013f9:	6a 23                	push   $0x23
+  8013fb:	68 08 58 80 00       	push   $0x805808
+  801400:	e8 39 f1 ff ff       	call   80053e <_panic>
+
+00801405 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  801405:	55                   	push   %ebp
+  801406:	89 e5                	mov    %esp,%ebp
+  801408:	57                   	push   %edi
+  801409:	56                   	push   %esi
+  80140a:	53                   	push   %ebx
+  80140b:	83 ec 0c             	sub    $0xc,%esp
+  80140e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801411:	89 d8                	mov    %ebx,%eax
+  801413:	c1 e0 05             	shl    $0x5,%eax
+  801416:	50                   	push   %eax
+  801417:	ff 75 0c             	push   0xc(%ebp)
+  80141a:	e8 e1 fb ff ff       	call   801000 <touch_mem>
+	asm volatile("int %1\n"
+  80141f:	be 00 00 00 00       	mov    $0x0,%esi
+  801424:	8b 55 08             	mov    0x8(%ebp),%edx
+  801427:	b8 13 00 00 00       	mov    $0x13,%eax
+  80142c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142f:	89 f7                	mov    %esi,%edi
+  801431:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801433:	83 c4 08             	add    $0x8,%esp
+  801436:	85 c0                	test   %eax,%eax
+  801438:	7f 08                	jg     801442 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  80143a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80143d:	5b                   	pop    %ebx
+  80143e:	5e                   	pop    %esi
+  80143f:	5f                   	pop    %edi
+  801440:	5d                   	pop    %ebp
+  801441:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801442:	83 ec 0c             	sub    $0xc,%esp
+  801445:	50                   	push   %eax
+  801446:	6a 13                	push   $0x13
+  801448:	68 eb 57 80 00       	push   $0x8057eb
+  80144d:	6a 23                	push   $0x23
+  80144f:	68 08 58 80 00       	push   $0x805808
+  801454:	e8 e5 f0 ff ff       	call   80053e <_panic>
+
+00801459 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801459:	55                   	push   %ebp
+  80145a:	89 e5                	mov    %esp,%ebp
+  80145c:	57                   	push   %edi
+  80145d:	56                   	push   %esi
+  80145e:	53                   	push   %ebx
+  80145f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801462:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801467:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80146d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801472:	89 df                	mov    %ebx,%edi
+  801474:	89 de                	mov    %ebx,%esi
+  801476:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801478:	85 c0                	test   %eax,%eax
+  80147a:	7f 08                	jg     801484 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80147c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80147f:	5b                   	pop    %ebx
+  801480:	5e                   	pop    %esi
+  801481:	5f                   	pop    %edi
+  801482:	5d                   	pop    %ebp
+  801483:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801484:	83 ec 0c             	sub    $0xc,%esp
+  801487:	50                   	push   %eax
+  801488:	6a 0a                	push   $0xa
+  80148a:	68 eb 57 80 00       	push   $0x8057eb
+  80148f:	6a 23                	push   $0x23
+  801491:	68 08 58 80 00       	push   $0x805808
+  801496:	e8 a3 f0 ff ff       	call   80053e <_panic>
+
+0080149b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80149b:	55                   	push   %ebp
+  80149c:	89 e5                	mov    %esp,%ebp
+  80149e:	57                   	push   %edi
+  80149f:	56                   	push   %esi
+  8014a0:	53                   	push   %ebx
+  8014a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  8014a4:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8014aa:	76 1d                	jbe    8014c9 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  8014ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014b7:	be 01 00 00 00       	mov    $0x1,%esi
+  8014bc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014bf:	cd 30                	int    $0x30
+}
+  8014c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c4:	5b                   	pop    %ebx
+  8014c5:	5e                   	pop    %esi
+  8014c6:	5f                   	pop    %edi
+  8014c7:	5d                   	pop    %ebp
+  8014c8:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8014c9:	68 00 10 00 00       	push   $0x1000
+  8014ce:	53                   	push   %ebx
+  8014cf:	e8 2c fb ff ff       	call   801000 <touch_mem>
+  8014d4:	83 c4 08             	add    $0x8,%esp
+  8014d7:	eb d3                	jmp    8014ac <sys_ipc_send+0x11>
+
+008014d9 <sys_ipc_send_pages>:
+{
+  8014d9:	55                   	push   %ebp
+  8014da:	89 e5                	mov    %esp,%ebp
+  8014dc:	57                   	push   %edi
+  8014dd:	56                   	push   %esi
+  8014de:	53                   	push   %ebx
+  8014df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014e2:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8014e5:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8014eb:	76 18                	jbe    801505 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8014ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014f8:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8014fb:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8014fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801500:	5b                   	pop    %ebx
+  801501:	5e                   	pop    %esi
+  801502:	5f                   	pop    %edi
+  801503:	5d                   	pop    %ebp
+  801504:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801505:	89 f0                	mov    %esi,%eax
+  801507:	c1 e0 0c             	shl    $0xc,%eax
+  80150a:	50                   	push   %eax
+  80150b:	53                   	push   %ebx
+  80150c:	e8 ef fa ff ff       	call   801000 <touch_mem>
+  801511:	83 c4 08             	add    $0x8,%esp
+  801514:	eb d7                	jmp    8014ed <sys_ipc_send_pages+0x14>
+
+00801516 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801516:	55                   	push   %ebp
+  801517:	89 e5                	mov    %esp,%ebp
+  801519:	57                   	push   %edi
+  80151a:	56                   	push   %esi
+  80151b:	53                   	push   %ebx
+  80151c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80151f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801524:	8b 55 08             	mov    0x8(%ebp),%edx
+  801527:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80152a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80152f:	89 df                	mov    %ebx,%edi
+  801531:	89 de                	mov    %ebx,%esi
+  801533:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801535:	85 c0                	test   %eax,%eax
+  801537:	7f 08                	jg     801541 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801539:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80153c:	5b                   	pop    %ebx
+  80153d:	5e                   	pop    %esi
+  80153e:	5f                   	pop    %edi
+  80153f:	5d                   	pop    %ebp
+  801540:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801541:	83 ec 0c             	sub    $0xc,%esp
+  801544:	50                   	push   %eax
+  801545:	6a 0d                	push   $0xd
+  801547:	68 eb 57 80 00       	push   $0x8057eb
+  80154c:	6a 23                	push   $0x23
+  80154e:	68 08 58 80 00       	push   $0x805808
+  801553:	e8 e6 ef ff ff       	call   80053e <_panic>
+
+00801558 <sys_ipc_recv>:
+{
+  801558:	55                   	push   %ebp
+  801559:	89 e5                	mov    %esp,%ebp
+  80155b:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80155e:	6a 01                	push   $0x1
+  801560:	ff 75 08             	push   0x8(%ebp)
+  801563:	e8 ae ff ff ff       	call   801516 <sys_ipc_recv_pages>
+}
+  801568:	c9                   	leave
+  801569:	c3                   	ret
+
+0080156a <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80156a:	55                   	push   %ebp
+  80156b:	89 e5                	mov    %esp,%ebp
+  80156d:	57                   	push   %edi
+  80156e:	56                   	push   %esi
+  80156f:	53                   	push   %ebx
+  801570:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801573:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801576:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801579:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80157f:	77 04                	ja     801585 <sys_ipc_call+0x1b>
+  801581:	85 f6                	test   %esi,%esi
+  801583:	75 15                	jne    80159a <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801585:	8b 55 08             	mov    0x8(%ebp),%edx
+  801588:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80158b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801590:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801592:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801595:	5b                   	pop    %ebx
+  801596:	5e                   	pop    %esi
+  801597:	5f                   	pop    %edi
+  801598:	5d                   	pop    %ebp
+  801599:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80159a:	89 f8                	mov    %edi,%eax
+  80159c:	c1 e0 0c             	shl    $0xc,%eax
+  80159f:	50                   	push   %eax
+  8015a0:	53                   	push   %ebx
+  8015a1:	e8 5a fa ff ff       	call   801000 <touch_mem>
+  8015a6:	83 c4 08             	add    $0x8,%esp
+  8015a9:	eb da                	jmp    801585 <sys_ipc_call+0x1b>
+
+008015ab <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8015ab:	55                   	push   %ebp
+  8015ac:	89 e5                	mov    %esp,%ebp
+  8015ae:	57                   	push   %edi
+  8015af:	56                   	push   %esi
+  8015b0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8015bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015bf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015c2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8015c5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8015c7:	5b                   	pop    %ebx
+  8015c8:	5e                   	pop    %esi
+  8015c9:	5f                   	pop    %edi
+  8015ca:	5d                   	pop    %ebp
+  8015cb:	c3                   	ret
+
+008015cc <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8015cc:	55                   	push   %ebp
+  8015cd:	89 e5                	mov    %esp,%ebp
+  8015cf:	57                   	push   %edi
+  8015d0:	56                   	push   %esi
+  8015d1:	53                   	push   %ebx
+  8015d2:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8015d5:	6a 04                	push   $0x4
+  8015d7:	ff 75 08             	push   0x8(%ebp)
+  8015da:	e8 21 fa ff ff       	call   801000 <touch_mem>
+	asm volatile("int %1\n"
+  8015df:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e7:	b8 16 00 00 00       	mov    $0x16,%eax
+  8015ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015f2:	89 f7                	mov    %esi,%edi
+  8015f4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015f6:	83 c4 08             	add    $0x8,%esp
+  8015f9:	85 c0                	test   %eax,%eax
+  8015fb:	7f 08                	jg     801605 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8015fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801600:	5b                   	pop    %ebx
+  801601:	5e                   	pop    %esi
+  801602:	5f                   	pop    %edi
+  801603:	5d                   	pop    %ebp
+  801604:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801605:	83 ec 0c             	sub    $0xc,%esp
+  801608:	50                   	push   %eax
+  801609:	6a 16                	push   $0x16
+  80160b:	68 eb 57 80 00       	push   $0x8057eb
+  801610:	6a 23                	push   $0x23
+  801612:	68 08 58 80 00       	push   $0x805808
+  801617:	e8 22 ef ff ff       	call   80053e <_panic>
+
+0080161c <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80161c:	55                   	push   %ebp
+  80161d:	89 e5                	mov    %esp,%ebp
+  80161f:	57                   	push   %edi
+  801620:	56                   	push   %esi
+  801621:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801622:	6a 04                	push   $0x4
+  801624:	ff 75 08             	push   0x8(%ebp)
+  801627:	e8 d4 f9 ff ff       	call   801000 <touch_mem>
+	asm volatile("int %1\n"
+  80162c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801631:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801634:	b8 17 00 00 00       	mov    $0x17,%eax
+  801639:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163c:	89 df                	mov    %ebx,%edi
+  80163e:	89 de                	mov    %ebx,%esi
+  801640:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801642:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801645:	5b                   	pop    %ebx
+  801646:	5e                   	pop    %esi
+  801647:	5f                   	pop    %edi
+  801648:	5d                   	pop    %ebp
+  801649:	c3                   	ret
+
+0080164a <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80164a:	55                   	push   %ebp
+  80164b:	89 e5                	mov    %esp,%ebp
+  80164d:	57                   	push   %edi
+  80164e:	56                   	push   %esi
+  80164f:	53                   	push   %ebx
+  801650:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801653:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801658:	8b 55 08             	mov    0x8(%ebp),%edx
+  80165b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801660:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801665:	89 df                	mov    %ebx,%edi
+  801667:	89 de                	mov    %ebx,%esi
+  801669:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80166b:	85 c0                	test   %eax,%eax
+  80166d:	7f 08                	jg     801677 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80166f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801672:	5b                   	pop    %ebx
+  801673:	5e                   	pop    %esi
+  801674:	5f                   	pop    %edi
+  801675:	5d                   	pop    %ebp
+  801676:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801677:	83 ec 0c             	sub    $0xc,%esp
+  80167a:	50                   	push   %eax
+  80167b:	6a 0e                	push   $0xe
+  80167d:	68 eb 57 80 00       	push   $0x8057eb
+  801682:	6a 23                	push   $0x23
+  801684:	68 08 58 80 00       	push   $0x805808
+  801689:	e8 b0 ee ff ff       	call   80053e <_panic>
+
+0080168e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80168e:	55                   	push   %ebp
+  80168f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801691:	8b 45 08             	mov    0x8(%ebp),%eax
+  801694:	05 00 00 00 30       	add    $0x30000000,%eax
+  801699:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80169c:	5d                   	pop    %ebp
+  80169d:	c3                   	ret
+
+0080169e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80169e:	55                   	push   %ebp
+  80169f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8016a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016a4:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8016a9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8016ae:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8016b3:	5d                   	pop    %ebp
+  8016b4:	c3                   	ret
+
+008016b5 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8016b5:	55                   	push   %ebp
+  8016b6:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8016b8:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8016bd:	a8 01                	test   $0x1,%al
+  8016bf:	74 3c                	je     8016fd <fd_alloc+0x48>
+  8016c1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8016c6:	89 c2                	mov    %eax,%edx
+  8016c8:	c1 ea 0c             	shr    $0xc,%edx
+  8016cb:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8016d2:	89 c1                	mov    %eax,%ecx
+  8016d4:	05 00 10 00 00       	add    $0x1000,%eax
+  8016d9:	f6 c2 01             	test   $0x1,%dl
+  8016dc:	74 13                	je     8016f1 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8016de:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8016e3:	75 e1                	jne    8016c6 <fd_alloc+0x11>
+  8016e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8016ea:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8016ef:	eb 05                	jmp    8016f6 <fd_alloc+0x41>
+			return 0;
+  8016f1:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8016f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f9:	89 0a                	mov    %ecx,(%edx)
+}
+  8016fb:	5d                   	pop    %ebp
+  8016fc:	c3                   	ret
+  8016fd:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801702:	b8 00 00 00 00       	mov    $0x0,%eax
+  801707:	eb ed                	jmp    8016f6 <fd_alloc+0x41>
+
+00801709 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801709:	55                   	push   %ebp
+  80170a:	89 e5                	mov    %esp,%ebp
+  80170c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80170f:	83 f8 1f             	cmp    $0x1f,%eax
+  801712:	77 30                	ja     801744 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801714:	c1 e0 0c             	shl    $0xc,%eax
+  801717:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80171c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801722:	f6 c2 01             	test   $0x1,%dl
+  801725:	74 24                	je     80174b <fd_lookup+0x42>
+  801727:	89 c2                	mov    %eax,%edx
+  801729:	c1 ea 0c             	shr    $0xc,%edx
+  80172c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801733:	f6 c2 01             	test   $0x1,%dl
+  801736:	74 1a                	je     801752 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801738:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80173b:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80173d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801742:	5d                   	pop    %ebp
+  801743:	c3                   	ret
+		return -E_INVAL;
+  801744:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801749:	eb f7                	jmp    801742 <fd_lookup+0x39>
+		return -E_INVAL;
+  80174b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801750:	eb f0                	jmp    801742 <fd_lookup+0x39>
+  801752:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801757:	eb e9                	jmp    801742 <fd_lookup+0x39>
+
+00801759 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801759:	55                   	push   %ebp
+  80175a:	89 e5                	mov    %esp,%ebp
+  80175c:	53                   	push   %ebx
+  80175d:	83 ec 04             	sub    $0x4,%esp
+  801760:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801763:	b8 94 58 80 00       	mov    $0x805894,%eax
+  801768:	8b 18                	mov    (%eax),%ebx
+  80176a:	85 db                	test   %ebx,%ebx
+  80176c:	74 0e                	je     80177c <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  80176e:	83 c0 04             	add    $0x4,%eax
+  801771:	39 13                	cmp    %edx,(%ebx)
+  801773:	75 f3                	jne    801768 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801775:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177a:	eb 1f                	jmp    80179b <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80177c:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801781:	8b 40 48             	mov    0x48(%eax),%eax
+  801784:	83 ec 04             	sub    $0x4,%esp
+  801787:	52                   	push   %edx
+  801788:	50                   	push   %eax
+  801789:	68 18 58 80 00       	push   $0x805818
+  80178e:	e8 86 ee ff ff       	call   800619 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801793:	83 c4 10             	add    $0x10,%esp
+  801796:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80179b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80179e:	89 1a                	mov    %ebx,(%edx)
+}
+  8017a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017a3:	c9                   	leave
+  8017a4:	c3                   	ret
+
+008017a5 <fd_close>:
+{
+  8017a5:	55                   	push   %ebp
+  8017a6:	89 e5                	mov    %esp,%ebp
+  8017a8:	57                   	push   %edi
+  8017a9:	56                   	push   %esi
+  8017aa:	53                   	push   %ebx
+  8017ab:	83 ec 24             	sub    $0x24,%esp
+  8017ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017b1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8017b4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017b7:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017b8:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8017be:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8017c1:	50                   	push   %eax
+  8017c2:	e8 42 ff ff ff       	call   801709 <fd_lookup>
+  8017c7:	89 c3                	mov    %eax,%ebx
+  8017c9:	83 c4 10             	add    $0x10,%esp
+  8017cc:	85 c0                	test   %eax,%eax
+  8017ce:	78 05                	js     8017d5 <fd_close+0x30>
+	    || fd != fd2)
+  8017d0:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8017d3:	74 16                	je     8017eb <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8017d5:	89 f8                	mov    %edi,%eax
+  8017d7:	84 c0                	test   %al,%al
+  8017d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017de:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8017e1:	89 d8                	mov    %ebx,%eax
+  8017e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017e6:	5b                   	pop    %ebx
+  8017e7:	5e                   	pop    %esi
+  8017e8:	5f                   	pop    %edi
+  8017e9:	5d                   	pop    %ebp
+  8017ea:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017eb:	83 ec 08             	sub    $0x8,%esp
+  8017ee:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8017f1:	50                   	push   %eax
+  8017f2:	ff 36                	push   (%esi)
+  8017f4:	e8 60 ff ff ff       	call   801759 <dev_lookup>
+  8017f9:	89 c3                	mov    %eax,%ebx
+  8017fb:	83 c4 10             	add    $0x10,%esp
+  8017fe:	85 c0                	test   %eax,%eax
+  801800:	78 1a                	js     80181c <fd_close+0x77>
+		if (dev->dev_close)
+  801802:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801805:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801808:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80180d:	85 c0                	test   %eax,%eax
+  80180f:	74 0b                	je     80181c <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801811:	83 ec 0c             	sub    $0xc,%esp
+  801814:	56                   	push   %esi
+  801815:	ff d0                	call   *%eax
+  801817:	89 c3                	mov    %eax,%ebx
+  801819:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80181c:	83 ec 08             	sub    $0x8,%esp
+  80181f:	56                   	push   %esi
+  801820:	6a 00                	push   $0x0
+  801822:	e8 51 f9 ff ff       	call   801178 <sys_page_unmap>
+	return r;
+  801827:	83 c4 10             	add    $0x10,%esp
+  80182a:	eb b5                	jmp    8017e1 <fd_close+0x3c>
+
+0080182c <close>:
+
+int
+close(int fdnum)
+{
+  80182c:	55                   	push   %ebp
+  80182d:	89 e5                	mov    %esp,%ebp
+  80182f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801832:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801835:	50                   	push   %eax
+  801836:	ff 75 08             	push   0x8(%ebp)
+  801839:	e8 cb fe ff ff       	call   801709 <fd_lookup>
+  80183e:	83 c4 10             	add    $0x10,%esp
+  801841:	85 c0                	test   %eax,%eax
+  801843:	79 02                	jns    801847 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801845:	c9                   	leave
+  801846:	c3                   	ret
+		return fd_close(fd, 1);
+  801847:	83 ec 08             	sub    $0x8,%esp
+  80184a:	6a 01                	push   $0x1
+  80184c:	ff 75 f4             	push   -0xc(%ebp)
+  80184f:	e8 51 ff ff ff       	call   8017a5 <fd_close>
+  801854:	83 c4 10             	add    $0x10,%esp
+  801857:	eb ec                	jmp    801845 <close+0x19>
+
+00801859 <close_all>:
+
+void
+close_all(void)
+{
+  801859:	55                   	push   %ebp
+  80185a:	89 e5                	mov    %esp,%ebp
+  80185c:	53                   	push   %ebx
+  80185d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801860:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801865:	83 ec 0c             	sub    $0xc,%esp
+  801868:	53                   	push   %ebx
+  801869:	e8 be ff ff ff       	call   80182c <close>
+	for (i = 0; i < MAXFD; i++)
+  80186e:	83 c3 01             	add    $0x1,%ebx
+  801871:	83 c4 10             	add    $0x10,%esp
+  801874:	83 fb 20             	cmp    $0x20,%ebx
+  801877:	75 ec                	jne    801865 <close_all+0xc>
+}
+  801879:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80187c:	c9                   	leave
+  80187d:	c3                   	ret
+
+0080187e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80187e:	55                   	push   %ebp
+  80187f:	89 e5                	mov    %esp,%ebp
+  801881:	57                   	push   %edi
+  801882:	56                   	push   %esi
+  801883:	53                   	push   %ebx
+  801884:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801887:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80188a:	50                   	push   %eax
+  80188b:	ff 75 08             	push   0x8(%ebp)
+  80188e:	e8 76 fe ff ff       	call   801709 <fd_lookup>
+  801893:	89 c3                	mov    %eax,%ebx
+  801895:	83 c4 10             	add    $0x10,%esp
+  801898:	85 c0                	test   %eax,%eax
+  80189a:	78 7f                	js     80191b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80189c:	83 ec 0c             	sub    $0xc,%esp
+  80189f:	ff 75 0c             	push   0xc(%ebp)
+  8018a2:	e8 85 ff ff ff       	call   80182c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8018a7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8018aa:	c1 e6 0c             	shl    $0xc,%esi
+  8018ad:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8018b3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8018b6:	89 3c 24             	mov    %edi,(%esp)
+  8018b9:	e8 e0 fd ff ff       	call   80169e <fd2data>
+  8018be:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8018c0:	89 34 24             	mov    %esi,(%esp)
+  8018c3:	e8 d6 fd ff ff       	call   80169e <fd2data>
+  8018c8:	83 c4 10             	add    $0x10,%esp
+  8018cb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8018ce:	89 d8                	mov    %ebx,%eax
+  8018d0:	c1 e8 16             	shr    $0x16,%eax
+  8018d3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8018da:	a8 01                	test   $0x1,%al
+  8018dc:	74 11                	je     8018ef <dup+0x71>
+  8018de:	89 d8                	mov    %ebx,%eax
+  8018e0:	c1 e8 0c             	shr    $0xc,%eax
+  8018e3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8018ea:	f6 c2 01             	test   $0x1,%dl
+  8018ed:	75 36                	jne    801925 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8018ef:	89 f8                	mov    %edi,%eax
+  8018f1:	c1 e8 0c             	shr    $0xc,%eax
+  8018f4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018fb:	83 ec 0c             	sub    $0xc,%esp
+  8018fe:	25 07 0e 00 00       	and    $0xe07,%eax
+  801903:	50                   	push   %eax
+  801904:	56                   	push   %esi
+  801905:	6a 00                	push   $0x0
+  801907:	57                   	push   %edi
+  801908:	6a 00                	push   $0x0
+  80190a:	e8 27 f8 ff ff       	call   801136 <sys_page_map>
+  80190f:	89 c3                	mov    %eax,%ebx
+  801911:	83 c4 20             	add    $0x20,%esp
+  801914:	85 c0                	test   %eax,%eax
+  801916:	78 33                	js     80194b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801918:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80191b:	89 d8                	mov    %ebx,%eax
+  80191d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801920:	5b                   	pop    %ebx
+  801921:	5e                   	pop    %esi
+  801922:	5f                   	pop    %edi
+  801923:	5d                   	pop    %ebp
+  801924:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801925:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80192c:	83 ec 0c             	sub    $0xc,%esp
+  80192f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801934:	50                   	push   %eax
+  801935:	ff 75 d4             	push   -0x2c(%ebp)
+  801938:	6a 00                	push   $0x0
+  80193a:	53                   	push   %ebx
+  80193b:	6a 00                	push   $0x0
+  80193d:	e8 f4 f7 ff ff       	call   801136 <sys_page_map>
+  801942:	89 c3                	mov    %eax,%ebx
+  801944:	83 c4 20             	add    $0x20,%esp
+  801947:	85 c0                	test   %eax,%eax
+  801949:	79 a4                	jns    8018ef <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80194b:	83 ec 08             	sub    $0x8,%esp
+  80194e:	56                   	push   %esi
+  80194f:	6a 00                	push   $0x0
+  801951:	e8 22 f8 ff ff       	call   801178 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801956:	83 c4 08             	add    $0x8,%esp
+  801959:	ff 75 d4             	push   -0x2c(%ebp)
+  80195c:	6a 00                	push   $0x0
+  80195e:	e8 15 f8 ff ff       	call   801178 <sys_page_unmap>
+	return r;
+  801963:	83 c4 10             	add    $0x10,%esp
+  801966:	eb b3                	jmp    80191b <dup+0x9d>
+
+00801968 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801968:	55                   	push   %ebp
+  801969:	89 e5                	mov    %esp,%ebp
+  80196b:	56                   	push   %esi
+  80196c:	53                   	push   %ebx
+  80196d:	83 ec 18             	sub    $0x18,%esp
+  801970:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801973:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801976:	50                   	push   %eax
+  801977:	56                   	push   %esi
+  801978:	e8 8c fd ff ff       	call   801709 <fd_lookup>
+  80197d:	83 c4 10             	add    $0x10,%esp
+  801980:	85 c0                	test   %eax,%eax
+  801982:	78 3c                	js     8019c0 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801984:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801987:	83 ec 08             	sub    $0x8,%esp
+  80198a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80198d:	50                   	push   %eax
+  80198e:	ff 33                	push   (%ebx)
+  801990:	e8 c4 fd ff ff       	call   801759 <dev_lookup>
+  801995:	83 c4 10             	add    $0x10,%esp
+  801998:	85 c0                	test   %eax,%eax
+  80199a:	78 24                	js     8019c0 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80199c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80199f:	83 e0 03             	and    $0x3,%eax
+  8019a2:	83 f8 01             	cmp    $0x1,%eax
+  8019a5:	74 20                	je     8019c7 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8019a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019aa:	8b 40 08             	mov    0x8(%eax),%eax
+  8019ad:	85 c0                	test   %eax,%eax
+  8019af:	74 37                	je     8019e8 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8019b1:	83 ec 04             	sub    $0x4,%esp
+  8019b4:	ff 75 10             	push   0x10(%ebp)
+  8019b7:	ff 75 0c             	push   0xc(%ebp)
+  8019ba:	53                   	push   %ebx
+  8019bb:	ff d0                	call   *%eax
+  8019bd:	83 c4 10             	add    $0x10,%esp
+}
+  8019c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019c3:	5b                   	pop    %ebx
+  8019c4:	5e                   	pop    %esi
+  8019c5:	5d                   	pop    %ebp
+  8019c6:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019c7:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8019cc:	8b 40 48             	mov    0x48(%eax),%eax
+  8019cf:	83 ec 04             	sub    $0x4,%esp
+  8019d2:	56                   	push   %esi
+  8019d3:	50                   	push   %eax
+  8019d4:	68 59 58 80 00       	push   $0x805859
+  8019d9:	e8 3b ec ff ff       	call   800619 <cprintf>
+		return -E_INVAL;
+  8019de:	83 c4 10             	add    $0x10,%esp
+  8019e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019e6:	eb d8                	jmp    8019c0 <read+0x58>
+		return -E_NOT_SUPP;
+  8019e8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019ed:	eb d1                	jmp    8019c0 <read+0x58>
+
+008019ef <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8019ef:	55                   	push   %ebp
+  8019f0:	89 e5                	mov    %esp,%ebp
+  8019f2:	57                   	push   %edi
+  8019f3:	56                   	push   %esi
+  8019f4:	53                   	push   %ebx
+  8019f5:	83 ec 0c             	sub    $0xc,%esp
+  8019f8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8019fb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8019fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a03:	eb 02                	jmp    801a07 <readn+0x18>
+  801a05:	01 c3                	add    %eax,%ebx
+  801a07:	39 f3                	cmp    %esi,%ebx
+  801a09:	73 21                	jae    801a2c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801a0b:	83 ec 04             	sub    $0x4,%esp
+  801a0e:	89 f0                	mov    %esi,%eax
+  801a10:	29 d8                	sub    %ebx,%eax
+  801a12:	50                   	push   %eax
+  801a13:	89 d8                	mov    %ebx,%eax
+  801a15:	03 45 0c             	add    0xc(%ebp),%eax
+  801a18:	50                   	push   %eax
+  801a19:	57                   	push   %edi
+  801a1a:	e8 49 ff ff ff       	call   801968 <read>
+		if (m < 0)
+  801a1f:	83 c4 10             	add    $0x10,%esp
+  801a22:	85 c0                	test   %eax,%eax
+  801a24:	78 04                	js     801a2a <readn+0x3b>
+			return m;
+		if (m == 0)
+  801a26:	75 dd                	jne    801a05 <readn+0x16>
+  801a28:	eb 02                	jmp    801a2c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801a2a:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801a2c:	89 d8                	mov    %ebx,%eax
+  801a2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a31:	5b                   	pop    %ebx
+  801a32:	5e                   	pop    %esi
+  801a33:	5f                   	pop    %edi
+  801a34:	5d                   	pop    %ebp
+  801a35:	c3                   	ret
+
+00801a36 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801a36:	55                   	push   %ebp
+  801a37:	89 e5                	mov    %esp,%ebp
+  801a39:	56                   	push   %esi
+  801a3a:	53                   	push   %ebx
+  801a3b:	83 ec 18             	sub    $0x18,%esp
+  801a3e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a41:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a44:	50                   	push   %eax
+  801a45:	53                   	push   %ebx
+  801a46:	e8 be fc ff ff       	call   801709 <fd_lookup>
+  801a4b:	83 c4 10             	add    $0x10,%esp
+  801a4e:	85 c0                	test   %eax,%eax
+  801a50:	78 37                	js     801a89 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a52:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a55:	83 ec 08             	sub    $0x8,%esp
+  801a58:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a5b:	50                   	push   %eax
+  801a5c:	ff 36                	push   (%esi)
+  801a5e:	e8 f6 fc ff ff       	call   801759 <dev_lookup>
+  801a63:	83 c4 10             	add    $0x10,%esp
+  801a66:	85 c0                	test   %eax,%eax
+  801a68:	78 1f                	js     801a89 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a6a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a6e:	74 20                	je     801a90 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801a70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a73:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a76:	85 c0                	test   %eax,%eax
+  801a78:	74 37                	je     801ab1 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801a7a:	83 ec 04             	sub    $0x4,%esp
+  801a7d:	ff 75 10             	push   0x10(%ebp)
+  801a80:	ff 75 0c             	push   0xc(%ebp)
+  801a83:	56                   	push   %esi
+  801a84:	ff d0                	call   *%eax
+  801a86:	83 c4 10             	add    $0x10,%esp
+}
+  801a89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a8c:	5b                   	pop    %ebx
+  801a8d:	5e                   	pop    %esi
+  801a8e:	5d                   	pop    %ebp
+  801a8f:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a90:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801a95:	8b 40 48             	mov    0x48(%eax),%eax
+  801a98:	83 ec 04             	sub    $0x4,%esp
+  801a9b:	53                   	push   %ebx
+  801a9c:	50                   	push   %eax
+  801a9d:	68 75 58 80 00       	push   $0x805875
+  801aa2:	e8 72 eb ff ff       	call   800619 <cprintf>
+		return -E_INVAL;
+  801aa7:	83 c4 10             	add    $0x10,%esp
+  801aaa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aaf:	eb d8                	jmp    801a89 <write+0x53>
+		return -E_NOT_SUPP;
+  801ab1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ab6:	eb d1                	jmp    801a89 <write+0x53>
+
+00801ab8 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801ab8:	55                   	push   %ebp
+  801ab9:	89 e5                	mov    %esp,%ebp
+  801abb:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801abe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ac1:	50                   	push   %eax
+  801ac2:	ff 75 08             	push   0x8(%ebp)
+  801ac5:	e8 3f fc ff ff       	call   801709 <fd_lookup>
+  801aca:	83 c4 10             	add    $0x10,%esp
+  801acd:	85 c0                	test   %eax,%eax
+  801acf:	78 0e                	js     801adf <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801ad1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ad4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ad7:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801ada:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801adf:	c9                   	leave
+  801ae0:	c3                   	ret
+
+00801ae1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801ae1:	55                   	push   %ebp
+  801ae2:	89 e5                	mov    %esp,%ebp
+  801ae4:	56                   	push   %esi
+  801ae5:	53                   	push   %ebx
+  801ae6:	83 ec 18             	sub    $0x18,%esp
+  801ae9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801aec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801aef:	50                   	push   %eax
+  801af0:	53                   	push   %ebx
+  801af1:	e8 13 fc ff ff       	call   801709 <fd_lookup>
+  801af6:	83 c4 10             	add    $0x10,%esp
+  801af9:	85 c0                	test   %eax,%eax
+  801afb:	78 34                	js     801b31 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801afd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b00:	83 ec 08             	sub    $0x8,%esp
+  801b03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b06:	50                   	push   %eax
+  801b07:	ff 36                	push   (%esi)
+  801b09:	e8 4b fc ff ff       	call   801759 <dev_lookup>
+  801b0e:	83 c4 10             	add    $0x10,%esp
+  801b11:	85 c0                	test   %eax,%eax
+  801b13:	78 1c                	js     801b31 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b15:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b19:	74 1d                	je     801b38 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801b1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b1e:	8b 40 18             	mov    0x18(%eax),%eax
+  801b21:	85 c0                	test   %eax,%eax
+  801b23:	74 34                	je     801b59 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801b25:	83 ec 08             	sub    $0x8,%esp
+  801b28:	ff 75 0c             	push   0xc(%ebp)
+  801b2b:	56                   	push   %esi
+  801b2c:	ff d0                	call   *%eax
+  801b2e:	83 c4 10             	add    $0x10,%esp
+}
+  801b31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b34:	5b                   	pop    %ebx
+  801b35:	5e                   	pop    %esi
+  801b36:	5d                   	pop    %ebp
+  801b37:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801b38:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801b3d:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b40:	83 ec 04             	sub    $0x4,%esp
+  801b43:	53                   	push   %ebx
+  801b44:	50                   	push   %eax
+  801b45:	68 38 58 80 00       	push   $0x805838
+  801b4a:	e8 ca ea ff ff       	call   800619 <cprintf>
+		return -E_INVAL;
+  801b4f:	83 c4 10             	add    $0x10,%esp
+  801b52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b57:	eb d8                	jmp    801b31 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801b59:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b5e:	eb d1                	jmp    801b31 <ftruncate+0x50>
+
+00801b60 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801b60:	55                   	push   %ebp
+  801b61:	89 e5                	mov    %esp,%ebp
+  801b63:	56                   	push   %esi
+  801b64:	53                   	push   %ebx
+  801b65:	83 ec 18             	sub    $0x18,%esp
+  801b68:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b6b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b6e:	50                   	push   %eax
+  801b6f:	ff 75 08             	push   0x8(%ebp)
+  801b72:	e8 92 fb ff ff       	call   801709 <fd_lookup>
+  801b77:	83 c4 10             	add    $0x10,%esp
+  801b7a:	85 c0                	test   %eax,%eax
+  801b7c:	78 49                	js     801bc7 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b7e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b81:	83 ec 08             	sub    $0x8,%esp
+  801b84:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b87:	50                   	push   %eax
+  801b88:	ff 36                	push   (%esi)
+  801b8a:	e8 ca fb ff ff       	call   801759 <dev_lookup>
+  801b8f:	83 c4 10             	add    $0x10,%esp
+  801b92:	85 c0                	test   %eax,%eax
+  801b94:	78 31                	js     801bc7 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801b96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b99:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b9d:	74 2f                	je     801bce <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801b9f:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801ba2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801ba9:	00 00 00 
+	stat->st_isdir = 0;
+  801bac:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801bb3:	00 00 00 
+	stat->st_dev = dev;
+  801bb6:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801bbc:	83 ec 08             	sub    $0x8,%esp
+  801bbf:	53                   	push   %ebx
+  801bc0:	56                   	push   %esi
+  801bc1:	ff 50 14             	call   *0x14(%eax)
+  801bc4:	83 c4 10             	add    $0x10,%esp
+}
+  801bc7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bca:	5b                   	pop    %ebx
+  801bcb:	5e                   	pop    %esi
+  801bcc:	5d                   	pop    %ebp
+  801bcd:	c3                   	ret
+		return -E_NOT_SUPP;
+  801bce:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bd3:	eb f2                	jmp    801bc7 <fstat+0x67>
+
+00801bd5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801bd5:	55                   	push   %ebp
+  801bd6:	89 e5                	mov    %esp,%ebp
+  801bd8:	56                   	push   %esi
+  801bd9:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801bda:	83 ec 08             	sub    $0x8,%esp
+  801bdd:	6a 00                	push   $0x0
+  801bdf:	ff 75 08             	push   0x8(%ebp)
+  801be2:	e8 bc 02 00 00       	call   801ea3 <open>
+  801be7:	89 c3                	mov    %eax,%ebx
+  801be9:	83 c4 10             	add    $0x10,%esp
+  801bec:	85 c0                	test   %eax,%eax
+  801bee:	78 1b                	js     801c0b <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801bf0:	83 ec 08             	sub    $0x8,%esp
+  801bf3:	ff 75 0c             	push   0xc(%ebp)
+  801bf6:	50                   	push   %eax
+  801bf7:	e8 64 ff ff ff       	call   801b60 <fstat>
+  801bfc:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801bfe:	89 1c 24             	mov    %ebx,(%esp)
+  801c01:	e8 26 fc ff ff       	call   80182c <close>
+	return r;
+  801c06:	83 c4 10             	add    $0x10,%esp
+  801c09:	89 f3                	mov    %esi,%ebx
+}
+  801c0b:	89 d8                	mov    %ebx,%eax
+  801c0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c10:	5b                   	pop    %ebx
+  801c11:	5e                   	pop    %esi
+  801c12:	5d                   	pop    %ebp
+  801c13:	c3                   	ret
+
+00801c14 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801c14:	55                   	push   %ebp
+  801c15:	89 e5                	mov    %esp,%ebp
+  801c17:	57                   	push   %edi
+  801c18:	56                   	push   %esi
+  801c19:	53                   	push   %ebx
+  801c1a:	83 ec 0c             	sub    $0xc,%esp
+  801c1d:	89 c7                	mov    %eax,%edi
+  801c1f:	89 d3                	mov    %edx,%ebx
+  801c21:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801c23:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801c2a:	74 2d                	je     801c59 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801c2c:	6a 07                	push   $0x7
+  801c2e:	68 00 f0 80 00       	push   $0x80f000
+  801c33:	57                   	push   %edi
+  801c34:	ff 35 00 70 80 00    	push   0x807000
+  801c3a:	e8 4e 31 00 00       	call   804d8d <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801c3f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801c46:	6a 00                	push   $0x0
+  801c48:	56                   	push   %esi
+  801c49:	53                   	push   %ebx
+  801c4a:	6a 00                	push   $0x0
+  801c4c:	e8 ee 2f 00 00       	call   804c3f <ipc_recv_pages>
+}
+  801c51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c54:	5b                   	pop    %ebx
+  801c55:	5e                   	pop    %esi
+  801c56:	5f                   	pop    %edi
+  801c57:	5d                   	pop    %ebp
+  801c58:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c59:	83 ec 0c             	sub    $0xc,%esp
+  801c5c:	6a 01                	push   $0x1
+  801c5e:	e8 1f 32 00 00       	call   804e82 <ipc_find_env>
+  801c63:	a3 00 70 80 00       	mov    %eax,0x807000
+  801c68:	83 c4 10             	add    $0x10,%esp
+  801c6b:	eb bf                	jmp    801c2c <fsipc_pages+0x18>
+
+00801c6d <fsipc>:
+{
+  801c6d:	55                   	push   %ebp
+  801c6e:	89 e5                	mov    %esp,%ebp
+  801c70:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801c73:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c78:	e8 97 ff ff ff       	call   801c14 <fsipc_pages>
+}
+  801c7d:	c9                   	leave
+  801c7e:	c3                   	ret
+
+00801c7f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801c7f:	55                   	push   %ebp
+  801c80:	89 e5                	mov    %esp,%ebp
+  801c82:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801c85:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c88:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c8b:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  801c90:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c93:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801c98:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c9d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ca2:	e8 c6 ff ff ff       	call   801c6d <fsipc>
+}
+  801ca7:	c9                   	leave
+  801ca8:	c3                   	ret
+
+00801ca9 <devfile_flush>:
+{
+  801ca9:	55                   	push   %ebp
+  801caa:	89 e5                	mov    %esp,%ebp
+  801cac:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801caf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cb2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cb5:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801cba:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cbf:	b8 06 00 00 00       	mov    $0x6,%eax
+  801cc4:	e8 a4 ff ff ff       	call   801c6d <fsipc>
+}
+  801cc9:	c9                   	leave
+  801cca:	c3                   	ret
+
+00801ccb <devfile_stat>:
+{
+  801ccb:	55                   	push   %ebp
+  801ccc:	89 e5                	mov    %esp,%ebp
+  801cce:	53                   	push   %ebx
+  801ccf:	83 ec 04             	sub    $0x4,%esp
+  801cd2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801cd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cd8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cdb:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801ce0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce5:	b8 05 00 00 00       	mov    $0x5,%eax
+  801cea:	e8 7e ff ff ff       	call   801c6d <fsipc>
+  801cef:	85 c0                	test   %eax,%eax
+  801cf1:	78 2c                	js     801d1f <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801cf3:	83 ec 08             	sub    $0x8,%esp
+  801cf6:	68 00 f0 80 00       	push   $0x80f000
+  801cfb:	53                   	push   %ebx
+  801cfc:	e8 ff ee ff ff       	call   800c00 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801d01:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  801d06:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801d0c:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  801d11:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801d17:	83 c4 10             	add    $0x10,%esp
+  801d1a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d22:	c9                   	leave
+  801d23:	c3                   	ret
+
+00801d24 <devfile_write>:
+{
+  801d24:	55                   	push   %ebp
+  801d25:	89 e5                	mov    %esp,%ebp
+  801d27:	83 ec 0c             	sub    $0xc,%esp
+  801d2a:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801d2d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801d32:	39 d0                	cmp    %edx,%eax
+  801d34:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d37:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d3a:	8b 52 0c             	mov    0xc(%edx),%edx
+  801d3d:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  801d43:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801d48:	50                   	push   %eax
+  801d49:	ff 75 0c             	push   0xc(%ebp)
+  801d4c:	68 08 f0 80 00       	push   $0x80f008
+  801d51:	e8 30 f0 ff ff       	call   800d86 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801d56:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d5b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d60:	e8 08 ff ff ff       	call   801c6d <fsipc>
+}
+  801d65:	c9                   	leave
+  801d66:	c3                   	ret
+
+00801d67 <devfile_read>:
+{
+  801d67:	55                   	push   %ebp
+  801d68:	89 e5                	mov    %esp,%ebp
+  801d6a:	57                   	push   %edi
+  801d6b:	56                   	push   %esi
+  801d6c:	53                   	push   %ebx
+  801d6d:	83 ec 1c             	sub    $0x1c,%esp
+  801d70:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801d73:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801d76:	89 fe                	mov    %edi,%esi
+  801d78:	c1 ee 0c             	shr    $0xc,%esi
+  801d7b:	b8 20 00 00 00       	mov    $0x20,%eax
+  801d80:	39 c6                	cmp    %eax,%esi
+  801d82:	0f 47 f0             	cmova  %eax,%esi
+  801d85:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d8d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801d90:	eb 14                	jmp    801da6 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801d92:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801d99:	05 00 10 00 00       	add    $0x1000,%eax
+  801d9e:	f6 c6 06             	test   $0x6,%dh
+  801da1:	75 42                	jne    801de5 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801da3:	83 c1 01             	add    $0x1,%ecx
+  801da6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801da9:	39 f1                	cmp    %esi,%ecx
+  801dab:	0f 84 95 00 00 00    	je     801e46 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801db1:	89 c2                	mov    %eax,%edx
+  801db3:	c1 ea 16             	shr    $0x16,%edx
+  801db6:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801dbd:	f6 c2 01             	test   $0x1,%dl
+  801dc0:	74 23                	je     801de5 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801dc2:	89 c2                	mov    %eax,%edx
+  801dc4:	c1 ea 0c             	shr    $0xc,%edx
+  801dc7:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801dce:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801dd4:	74 0f                	je     801de5 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801dd6:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801ddd:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801de3:	75 ad                	jne    801d92 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801de5:	85 c9                	test   %ecx,%ecx
+  801de7:	74 11                	je     801dfa <devfile_read+0x93>
+  801de9:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801df0:	75 08                	jne    801dfa <devfile_read+0x93>
+  801df2:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801df8:	74 50                	je     801e4a <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801dfa:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801dfd:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  801e02:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801e08:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e0d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e12:	e8 56 fe ff ff       	call   801c6d <fsipc>
+  801e17:	89 c6                	mov    %eax,%esi
+  801e19:	85 c0                	test   %eax,%eax
+  801e1b:	78 1f                	js     801e3c <devfile_read+0xd5>
+	assert(r <= n);
+  801e1d:	39 c7                	cmp    %eax,%edi
+  801e1f:	72 50                	jb     801e71 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801e21:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e26:	7f 62                	jg     801e8a <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801e28:	83 ec 04             	sub    $0x4,%esp
+  801e2b:	50                   	push   %eax
+  801e2c:	68 00 f0 80 00       	push   $0x80f000
+  801e31:	ff 75 0c             	push   0xc(%ebp)
+  801e34:	e8 4d ef ff ff       	call   800d86 <memmove>
+	return r;
+  801e39:	83 c4 10             	add    $0x10,%esp
+}
+  801e3c:	89 f0                	mov    %esi,%eax
+  801e3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e41:	5b                   	pop    %ebx
+  801e42:	5e                   	pop    %esi
+  801e43:	5f                   	pop    %edi
+  801e44:	5d                   	pop    %ebp
+  801e45:	c3                   	ret
+  801e46:	89 f1                	mov    %esi,%ecx
+  801e48:	eb 9b                	jmp    801de5 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801e4a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801e4d:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801e52:	89 c8                	mov    %ecx,%eax
+  801e54:	c1 e0 0c             	shl    $0xc,%eax
+  801e57:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801e5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e5f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801e64:	e8 ab fd ff ff       	call   801c14 <fsipc_pages>
+  801e69:	89 c6                	mov    %eax,%esi
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	78 8b                	js     801dfa <devfile_read+0x93>
+  801e6f:	eb cb                	jmp    801e3c <devfile_read+0xd5>
+	assert(r <= n);
+  801e71:	68 a4 58 80 00       	push   $0x8058a4
+  801e76:	68 09 51 80 00       	push   $0x805109
+  801e7b:	68 a0 00 00 00       	push   $0xa0
+  801e80:	68 ab 58 80 00       	push   $0x8058ab
+  801e85:	e8 b4 e6 ff ff       	call   80053e <_panic>
+	assert(r <= PGSIZE);
+  801e8a:	68 b6 58 80 00       	push   $0x8058b6
+  801e8f:	68 09 51 80 00       	push   $0x805109
+  801e94:	68 a1 00 00 00       	push   $0xa1
+  801e99:	68 ab 58 80 00       	push   $0x8058ab
+  801e9e:	e8 9b e6 ff ff       	call   80053e <_panic>
+
+00801ea3 <open>:
+{
+  801ea3:	55                   	push   %ebp
+  801ea4:	89 e5                	mov    %esp,%ebp
+  801ea6:	56                   	push   %esi
+  801ea7:	53                   	push   %ebx
+  801ea8:	83 ec 1c             	sub    $0x1c,%esp
+  801eab:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801eae:	56                   	push   %esi
+  801eaf:	e8 11 ed ff ff       	call   800bc5 <strlen>
+  801eb4:	83 c4 10             	add    $0x10,%esp
+  801eb7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ebc:	7f 6c                	jg     801f2a <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801ebe:	83 ec 0c             	sub    $0xc,%esp
+  801ec1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ec4:	50                   	push   %eax
+  801ec5:	e8 eb f7 ff ff       	call   8016b5 <fd_alloc>
+  801eca:	89 c3                	mov    %eax,%ebx
+  801ecc:	83 c4 10             	add    $0x10,%esp
+  801ecf:	85 c0                	test   %eax,%eax
+  801ed1:	78 3c                	js     801f0f <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801ed3:	83 ec 08             	sub    $0x8,%esp
+  801ed6:	56                   	push   %esi
+  801ed7:	68 00 f0 80 00       	push   $0x80f000
+  801edc:	e8 1f ed ff ff       	call   800c00 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801ee1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ee4:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ee9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801eec:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ef1:	e8 77 fd ff ff       	call   801c6d <fsipc>
+  801ef6:	89 c3                	mov    %eax,%ebx
+  801ef8:	83 c4 10             	add    $0x10,%esp
+  801efb:	85 c0                	test   %eax,%eax
+  801efd:	78 19                	js     801f18 <open+0x75>
+	return fd2num(fd);
+  801eff:	83 ec 0c             	sub    $0xc,%esp
+  801f02:	ff 75 f4             	push   -0xc(%ebp)
+  801f05:	e8 84 f7 ff ff       	call   80168e <fd2num>
+  801f0a:	89 c3                	mov    %eax,%ebx
+  801f0c:	83 c4 10             	add    $0x10,%esp
+}
+  801f0f:	89 d8                	mov    %ebx,%eax
+  801f11:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f14:	5b                   	pop    %ebx
+  801f15:	5e                   	pop    %esi
+  801f16:	5d                   	pop    %ebp
+  801f17:	c3                   	ret
+		fd_close(fd, 0);
+  801f18:	83 ec 08             	sub    $0x8,%esp
+  801f1b:	6a 00                	push   $0x0
+  801f1d:	ff 75 f4             	push   -0xc(%ebp)
+  801f20:	e8 80 f8 ff ff       	call   8017a5 <fd_close>
+		return r;
+  801f25:	83 c4 10             	add    $0x10,%esp
+  801f28:	eb e5                	jmp    801f0f <open+0x6c>
+		return -E_BAD_PATH;
+  801f2a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801f2f:	eb de                	jmp    801f0f <open+0x6c>
+
+00801f31 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801f31:	55                   	push   %ebp
+  801f32:	89 e5                	mov    %esp,%ebp
+  801f34:	53                   	push   %ebx
+  801f35:	83 ec 10             	sub    $0x10,%esp
+  801f38:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801f3b:	53                   	push   %ebx
+  801f3c:	e8 84 ec ff ff       	call   800bc5 <strlen>
+  801f41:	83 c4 10             	add    $0x10,%esp
+  801f44:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f49:	7f 25                	jg     801f70 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801f4b:	83 ec 08             	sub    $0x8,%esp
+  801f4e:	53                   	push   %ebx
+  801f4f:	68 00 f0 80 00       	push   $0x80f000
+  801f54:	e8 a7 ec ff ff       	call   800c00 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801f59:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f5e:	b8 07 00 00 00       	mov    $0x7,%eax
+  801f63:	e8 05 fd ff ff       	call   801c6d <fsipc>
+  801f68:	83 c4 10             	add    $0x10,%esp
+}
+  801f6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f6e:	c9                   	leave
+  801f6f:	c3                   	ret
+		return -E_BAD_PATH;
+  801f70:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801f75:	eb f4                	jmp    801f6b <remove+0x3a>
+
+00801f77 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801f77:	55                   	push   %ebp
+  801f78:	89 e5                	mov    %esp,%ebp
+  801f7a:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801f7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f82:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f87:	e8 e1 fc ff ff       	call   801c6d <fsipc>
+}
+  801f8c:	c9                   	leave
+  801f8d:	c3                   	ret
+
+00801f8e <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801f8e:	55                   	push   %ebp
+  801f8f:	89 e5                	mov    %esp,%ebp
+  801f91:	53                   	push   %ebx
+  801f92:	83 ec 04             	sub    $0x4,%esp
+  801f95:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801f98:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f9d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801fa2:	e8 c6 fc ff ff       	call   801c6d <fsipc>
+  801fa7:	85 c0                	test   %eax,%eax
+  801fa9:	78 3c                	js     801fe7 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801fab:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  801fb0:	89 03                	mov    %eax,(%ebx)
+  801fb2:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  801fb7:	89 43 04             	mov    %eax,0x4(%ebx)
+  801fba:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  801fbf:	89 43 08             	mov    %eax,0x8(%ebx)
+  801fc2:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  801fc7:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801fca:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  801fcf:	89 43 10             	mov    %eax,0x10(%ebx)
+  801fd2:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  801fd7:	89 43 14             	mov    %eax,0x14(%ebx)
+  801fda:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  801fdf:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801fe2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fe7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fea:	c9                   	leave
+  801feb:	c3                   	ret
+
+00801fec <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801fec:	55                   	push   %ebp
+  801fed:	89 e5                	mov    %esp,%ebp
+  801fef:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801ff2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff5:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  801ffa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fff:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802004:	e8 64 fc ff ff       	call   801c6d <fsipc>
+}
+  802009:	c9                   	leave
+  80200a:	c3                   	ret
+
+0080200b <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80200b:	55                   	push   %ebp
+  80200c:	89 e5                	mov    %esp,%ebp
+  80200e:	56                   	push   %esi
+  80200f:	53                   	push   %ebx
+  802010:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802013:	83 ec 0c             	sub    $0xc,%esp
+  802016:	ff 75 08             	push   0x8(%ebp)
+  802019:	e8 80 f6 ff ff       	call   80169e <fd2data>
+  80201e:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802020:	83 c4 08             	add    $0x8,%esp
+  802023:	68 c2 58 80 00       	push   $0x8058c2
+  802028:	53                   	push   %ebx
+  802029:	e8 d2 eb ff ff       	call   800c00 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80202e:	8b 46 04             	mov    0x4(%esi),%eax
+  802031:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  802037:	2b 0e                	sub    (%esi),%ecx
+  802039:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80203e:	89 c8                	mov    %ecx,%eax
+  802040:	f7 e2                	mul    %edx
+  802042:	c1 ea 0c             	shr    $0xc,%edx
+  802045:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80204b:	29 d1                	sub    %edx,%ecx
+  80204d:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  802053:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80205a:	00 00 00 
+	stat->st_dev = &devpipe;
+  80205d:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  802064:	60 80 00 
+	return 0;
+}
+  802067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80206c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80206f:	5b                   	pop    %ebx
+  802070:	5e                   	pop    %esi
+  802071:	5d                   	pop    %ebp
+  802072:	c3                   	ret
+
+00802073 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802073:	55                   	push   %ebp
+  802074:	89 e5                	mov    %esp,%ebp
+  802076:	53                   	push   %ebx
+  802077:	83 ec 0c             	sub    $0xc,%esp
+  80207a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80207d:	53                   	push   %ebx
+  80207e:	6a 00                	push   $0x0
+  802080:	e8 f3 f0 ff ff       	call   801178 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802085:	89 1c 24             	mov    %ebx,(%esp)
+  802088:	e8 11 f6 ff ff       	call   80169e <fd2data>
+  80208d:	83 c4 08             	add    $0x8,%esp
+  802090:	50                   	push   %eax
+  802091:	6a 00                	push   $0x0
+  802093:	e8 e0 f0 ff ff       	call   801178 <sys_page_unmap>
+}
+  802098:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80209b:	c9                   	leave
+  80209c:	c3                   	ret
+
+0080209d <_pipeisclosed>:
+{
+  80209d:	55                   	push   %ebp
+  80209e:	89 e5                	mov    %esp,%ebp
+  8020a0:	57                   	push   %edi
+  8020a1:	56                   	push   %esi
+  8020a2:	53                   	push   %ebx
+  8020a3:	83 ec 1c             	sub    $0x1c,%esp
+  8020a6:	89 c7                	mov    %eax,%edi
+  8020a8:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8020aa:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8020af:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8020b2:	83 ec 0c             	sub    $0xc,%esp
+  8020b5:	57                   	push   %edi
+  8020b6:	e8 06 2e 00 00       	call   804ec1 <pageref>
+  8020bb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8020be:	89 34 24             	mov    %esi,(%esp)
+  8020c1:	e8 fb 2d 00 00       	call   804ec1 <pageref>
+		nn = thisenv->env_runs;
+  8020c6:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  8020cc:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8020cf:	83 c4 10             	add    $0x10,%esp
+  8020d2:	39 cb                	cmp    %ecx,%ebx
+  8020d4:	74 1b                	je     8020f1 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8020d6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020d9:	75 cf                	jne    8020aa <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8020db:	8b 42 58             	mov    0x58(%edx),%eax
+  8020de:	6a 01                	push   $0x1
+  8020e0:	50                   	push   %eax
+  8020e1:	53                   	push   %ebx
+  8020e2:	68 c9 58 80 00       	push   $0x8058c9
+  8020e7:	e8 2d e5 ff ff       	call   800619 <cprintf>
+  8020ec:	83 c4 10             	add    $0x10,%esp
+  8020ef:	eb b9                	jmp    8020aa <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8020f1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020f4:	0f 94 c0             	sete   %al
+  8020f7:	0f b6 c0             	movzbl %al,%eax
+}
+  8020fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020fd:	5b                   	pop    %ebx
+  8020fe:	5e                   	pop    %esi
+  8020ff:	5f                   	pop    %edi
+  802100:	5d                   	pop    %ebp
+  802101:	c3                   	ret
+
+00802102 <devpipe_read>:
+{
+  802102:	55                   	push   %ebp
+  802103:	89 e5                	mov    %esp,%ebp
+  802105:	57                   	push   %edi
+  802106:	56                   	push   %esi
+  802107:	53                   	push   %ebx
+  802108:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80210b:	ff 75 08             	push   0x8(%ebp)
+  80210e:	e8 8b f5 ff ff       	call   80169e <fd2data>
+  802113:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  802115:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  802118:	8d 40 04             	lea    0x4(%eax),%eax
+  80211b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80211e:	8b 7b 04             	mov    0x4(%ebx),%edi
+  802121:	8b 0b                	mov    (%ebx),%ecx
+  802123:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  802129:	29 ce                	sub    %ecx,%esi
+  80212b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802130:	f7 e6                	mul    %esi
+  802132:	c1 ea 0c             	shr    $0xc,%edx
+  802135:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  80213b:	29 c6                	sub    %eax,%esi
+  80213d:	89 f2                	mov    %esi,%edx
+  80213f:	75 43                	jne    802184 <devpipe_read+0x82>
+		ref = pageref(p);
+  802141:	83 ec 0c             	sub    $0xc,%esp
+  802144:	53                   	push   %ebx
+  802145:	e8 77 2d 00 00       	call   804ec1 <pageref>
+  80214a:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  80214c:	89 da                	mov    %ebx,%edx
+  80214e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802151:	e8 47 ff ff ff       	call   80209d <_pipeisclosed>
+  802156:	83 c4 10             	add    $0x10,%esp
+  802159:	85 c0                	test   %eax,%eax
+  80215b:	0f 85 c1 00 00 00    	jne    802222 <devpipe_read+0x120>
+	*sleeping = 1;
+  802161:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  802168:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80216d:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  802170:	75 ac                	jne    80211e <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  802172:	83 ec 04             	sub    $0x4,%esp
+  802175:	56                   	push   %esi
+  802176:	57                   	push   %edi
+  802177:	ff 75 e4             	push   -0x1c(%ebp)
+  80217a:	e8 4d f4 ff ff       	call   8015cc <sys_futex_wait>
+  80217f:	83 c4 10             	add    $0x10,%esp
+  802182:	eb 9a                	jmp    80211e <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  802184:	39 75 10             	cmp    %esi,0x10(%ebp)
+  802187:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  80218b:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80218d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802192:	f7 e1                	mul    %ecx
+  802194:	c1 ea 0b             	shr    $0xb,%edx
+  802197:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80219d:	29 c1                	sub    %eax,%ecx
+  80219f:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  8021a1:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8021a6:	29 cf                	sub    %ecx,%edi
+  8021a8:	39 f7                	cmp    %esi,%edi
+  8021aa:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  8021ad:	8d 43 10             	lea    0x10(%ebx),%eax
+  8021b0:	83 ec 04             	sub    $0x4,%esp
+  8021b3:	57                   	push   %edi
+  8021b4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021b7:	01 c2                	add    %eax,%edx
+  8021b9:	52                   	push   %edx
+  8021ba:	ff 75 0c             	push   0xc(%ebp)
+  8021bd:	e8 c4 eb ff ff       	call   800d86 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  8021c2:	83 c4 0c             	add    $0xc,%esp
+  8021c5:	89 f1                	mov    %esi,%ecx
+  8021c7:	29 f9                	sub    %edi,%ecx
+  8021c9:	51                   	push   %ecx
+  8021ca:	ff 75 e4             	push   -0x1c(%ebp)
+  8021cd:	89 f8                	mov    %edi,%eax
+  8021cf:	03 45 0c             	add    0xc(%ebp),%eax
+  8021d2:	50                   	push   %eax
+  8021d3:	e8 ae eb ff ff       	call   800d86 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  8021d8:	89 f1                	mov    %esi,%ecx
+  8021da:	03 0b                	add    (%ebx),%ecx
+  8021dc:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021e1:	f7 e1                	mul    %ecx
+  8021e3:	c1 ea 0c             	shr    $0xc,%edx
+  8021e6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8021ec:	29 d1                	sub    %edx,%ecx
+  8021ee:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  8021f0:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8021f5:	83 c4 10             	add    $0x10,%esp
+  8021f8:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  8021fc:	75 0a                	jne    802208 <devpipe_read+0x106>
+	return n;
+  8021fe:	89 f0                	mov    %esi,%eax
+}
+  802200:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802203:	5b                   	pop    %ebx
+  802204:	5e                   	pop    %esi
+  802205:	5f                   	pop    %edi
+  802206:	5d                   	pop    %ebp
+  802207:	c3                   	ret
+		*sleeping = 0;
+  802208:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  80220f:	83 ec 08             	sub    $0x8,%esp
+  802212:	68 00 04 00 00       	push   $0x400
+  802217:	53                   	push   %ebx
+  802218:	e8 ff f3 ff ff       	call   80161c <sys_futex_wake>
+  80221d:	83 c4 10             	add    $0x10,%esp
+  802220:	eb dc                	jmp    8021fe <devpipe_read+0xfc>
+			return 0;
+  802222:	b8 00 00 00 00       	mov    $0x0,%eax
+  802227:	eb d7                	jmp    802200 <devpipe_read+0xfe>
+
+00802229 <devpipe_write>:
+{
+  802229:	55                   	push   %ebp
+  80222a:	89 e5                	mov    %esp,%ebp
+  80222c:	57                   	push   %edi
+  80222d:	56                   	push   %esi
+  80222e:	53                   	push   %ebx
+  80222f:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802232:	ff 75 08             	push   0x8(%ebp)
+  802235:	e8 64 f4 ff ff       	call   80169e <fd2data>
+  80223a:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  80223c:	83 c4 10             	add    $0x10,%esp
+  80223f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802246:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802249:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80224c:	0f 83 23 01 00 00    	jae    802375 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802252:	8b 77 04             	mov    0x4(%edi),%esi
+  802255:	8b 1f                	mov    (%edi),%ebx
+  802257:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  80225d:	29 d9                	sub    %ebx,%ecx
+  80225f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802264:	f7 e1                	mul    %ecx
+  802266:	c1 ea 0c             	shr    $0xc,%edx
+  802269:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80226f:	29 c1                	sub    %eax,%ecx
+  802271:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802273:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802279:	75 40                	jne    8022bb <devpipe_write+0x92>
+			ref = pageref(p);
+  80227b:	83 ec 0c             	sub    $0xc,%esp
+  80227e:	57                   	push   %edi
+  80227f:	e8 3d 2c 00 00       	call   804ec1 <pageref>
+  802284:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  802286:	89 fa                	mov    %edi,%edx
+  802288:	8b 45 08             	mov    0x8(%ebp),%eax
+  80228b:	e8 0d fe ff ff       	call   80209d <_pipeisclosed>
+  802290:	83 c4 10             	add    $0x10,%esp
+  802293:	85 c0                	test   %eax,%eax
+  802295:	0f 85 d5 00 00 00    	jne    802370 <devpipe_write+0x147>
+	*sleeping = 1;
+  80229b:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  8022a2:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8022a7:	39 1f                	cmp    %ebx,(%edi)
+  8022a9:	75 a7                	jne    802252 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  8022ab:	83 ec 04             	sub    $0x4,%esp
+  8022ae:	56                   	push   %esi
+  8022af:	53                   	push   %ebx
+  8022b0:	57                   	push   %edi
+  8022b1:	e8 16 f3 ff ff       	call   8015cc <sys_futex_wait>
+  8022b6:	83 c4 10             	add    $0x10,%esp
+  8022b9:	eb 97                	jmp    802252 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8022bb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8022be:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022c1:	29 c1                	sub    %eax,%ecx
+  8022c3:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8022c8:	89 d8                	mov    %ebx,%eax
+  8022ca:	29 d0                	sub    %edx,%eax
+  8022cc:	39 c1                	cmp    %eax,%ecx
+  8022ce:	0f 46 c1             	cmovbe %ecx,%eax
+  8022d1:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  8022d3:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8022d8:	f7 e6                	mul    %esi
+  8022da:	c1 ea 0b             	shr    $0xb,%edx
+  8022dd:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8022e3:	29 c6                	sub    %eax,%esi
+  8022e5:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8022e7:	29 f3                	sub    %esi,%ebx
+  8022e9:	39 cb                	cmp    %ecx,%ebx
+  8022eb:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8022ee:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  8022f1:	8d 77 10             	lea    0x10(%edi),%esi
+  8022f4:	83 ec 04             	sub    $0x4,%esp
+  8022f7:	53                   	push   %ebx
+  8022f8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022fb:	03 45 0c             	add    0xc(%ebp),%eax
+  8022fe:	50                   	push   %eax
+  8022ff:	01 f2                	add    %esi,%edx
+  802301:	52                   	push   %edx
+  802302:	e8 7f ea ff ff       	call   800d86 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802307:	83 c4 0c             	add    $0xc,%esp
+  80230a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80230d:	29 d8                	sub    %ebx,%eax
+  80230f:	50                   	push   %eax
+  802310:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802313:	01 d3                	add    %edx,%ebx
+  802315:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802318:	53                   	push   %ebx
+  802319:	56                   	push   %esi
+  80231a:	e8 67 ea ff ff       	call   800d86 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  80231f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802322:	03 4f 04             	add    0x4(%edi),%ecx
+  802325:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80232a:	f7 e1                	mul    %ecx
+  80232c:	c1 ea 0c             	shr    $0xc,%edx
+  80232f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802335:	29 d1                	sub    %edx,%ecx
+  802337:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  80233a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80233f:	83 c4 10             	add    $0x10,%esp
+  802342:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802346:	75 0b                	jne    802353 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802348:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  80234b:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80234e:	e9 f3 fe ff ff       	jmp    802246 <devpipe_write+0x1d>
+		*sleeping = 0;
+  802353:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  80235a:	83 ec 08             	sub    $0x8,%esp
+  80235d:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802362:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802365:	50                   	push   %eax
+  802366:	e8 b1 f2 ff ff       	call   80161c <sys_futex_wake>
+  80236b:	83 c4 10             	add    $0x10,%esp
+  80236e:	eb d8                	jmp    802348 <devpipe_write+0x11f>
+				return 0;
+  802370:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802375:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802378:	5b                   	pop    %ebx
+  802379:	5e                   	pop    %esi
+  80237a:	5f                   	pop    %edi
+  80237b:	5d                   	pop    %ebp
+  80237c:	c3                   	ret
+
+0080237d <pipe>:
+{
+  80237d:	55                   	push   %ebp
+  80237e:	89 e5                	mov    %esp,%ebp
+  802380:	56                   	push   %esi
+  802381:	53                   	push   %ebx
+  802382:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802385:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802388:	50                   	push   %eax
+  802389:	e8 27 f3 ff ff       	call   8016b5 <fd_alloc>
+  80238e:	89 c3                	mov    %eax,%ebx
+  802390:	83 c4 10             	add    $0x10,%esp
+  802393:	85 c0                	test   %eax,%eax
+  802395:	0f 88 23 01 00 00    	js     8024be <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80239b:	83 ec 04             	sub    $0x4,%esp
+  80239e:	68 07 04 00 00       	push   $0x407
+  8023a3:	ff 75 f4             	push   -0xc(%ebp)
+  8023a6:	6a 00                	push   $0x0
+  8023a8:	e8 46 ed ff ff       	call   8010f3 <sys_page_alloc>
+  8023ad:	89 c3                	mov    %eax,%ebx
+  8023af:	83 c4 10             	add    $0x10,%esp
+  8023b2:	85 c0                	test   %eax,%eax
+  8023b4:	0f 88 04 01 00 00    	js     8024be <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8023ba:	83 ec 0c             	sub    $0xc,%esp
+  8023bd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8023c0:	50                   	push   %eax
+  8023c1:	e8 ef f2 ff ff       	call   8016b5 <fd_alloc>
+  8023c6:	89 c3                	mov    %eax,%ebx
+  8023c8:	83 c4 10             	add    $0x10,%esp
+  8023cb:	85 c0                	test   %eax,%eax
+  8023cd:	0f 88 db 00 00 00    	js     8024ae <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8023d3:	83 ec 04             	sub    $0x4,%esp
+  8023d6:	68 07 04 00 00       	push   $0x407
+  8023db:	ff 75 f0             	push   -0x10(%ebp)
+  8023de:	6a 00                	push   $0x0
+  8023e0:	e8 0e ed ff ff       	call   8010f3 <sys_page_alloc>
+  8023e5:	89 c3                	mov    %eax,%ebx
+  8023e7:	83 c4 10             	add    $0x10,%esp
+  8023ea:	85 c0                	test   %eax,%eax
+  8023ec:	0f 88 bc 00 00 00    	js     8024ae <pipe+0x131>
+	va = fd2data(fd0);
+  8023f2:	83 ec 0c             	sub    $0xc,%esp
+  8023f5:	ff 75 f4             	push   -0xc(%ebp)
+  8023f8:	e8 a1 f2 ff ff       	call   80169e <fd2data>
+  8023fd:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8023ff:	83 c4 0c             	add    $0xc,%esp
+  802402:	68 07 04 00 00       	push   $0x407
+  802407:	50                   	push   %eax
+  802408:	6a 00                	push   $0x0
+  80240a:	e8 e4 ec ff ff       	call   8010f3 <sys_page_alloc>
+  80240f:	89 c3                	mov    %eax,%ebx
+  802411:	83 c4 10             	add    $0x10,%esp
+  802414:	85 c0                	test   %eax,%eax
+  802416:	0f 88 82 00 00 00    	js     80249e <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80241c:	83 ec 0c             	sub    $0xc,%esp
+  80241f:	ff 75 f0             	push   -0x10(%ebp)
+  802422:	e8 77 f2 ff ff       	call   80169e <fd2data>
+  802427:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80242e:	50                   	push   %eax
+  80242f:	6a 00                	push   $0x0
+  802431:	56                   	push   %esi
+  802432:	6a 00                	push   $0x0
+  802434:	e8 fd ec ff ff       	call   801136 <sys_page_map>
+  802439:	89 c3                	mov    %eax,%ebx
+  80243b:	83 c4 20             	add    $0x20,%esp
+  80243e:	85 c0                	test   %eax,%eax
+  802440:	78 4e                	js     802490 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802442:	a1 20 60 80 00       	mov    0x806020,%eax
+  802447:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80244a:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80244c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80244f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802456:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802459:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80245b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80245e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802465:	83 ec 0c             	sub    $0xc,%esp
+  802468:	ff 75 f4             	push   -0xc(%ebp)
+  80246b:	e8 1e f2 ff ff       	call   80168e <fd2num>
+  802470:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802473:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802475:	83 c4 04             	add    $0x4,%esp
+  802478:	ff 75 f0             	push   -0x10(%ebp)
+  80247b:	e8 0e f2 ff ff       	call   80168e <fd2num>
+  802480:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802483:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802486:	83 c4 10             	add    $0x10,%esp
+  802489:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80248e:	eb 2e                	jmp    8024be <pipe+0x141>
+	sys_page_unmap(0, va);
+  802490:	83 ec 08             	sub    $0x8,%esp
+  802493:	56                   	push   %esi
+  802494:	6a 00                	push   $0x0
+  802496:	e8 dd ec ff ff       	call   801178 <sys_page_unmap>
+  80249b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80249e:	83 ec 08             	sub    $0x8,%esp
+  8024a1:	ff 75 f0             	push   -0x10(%ebp)
+  8024a4:	6a 00                	push   $0x0
+  8024a6:	e8 cd ec ff ff       	call   801178 <sys_page_unmap>
+  8024ab:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8024ae:	83 ec 08             	sub    $0x8,%esp
+  8024b1:	ff 75 f4             	push   -0xc(%ebp)
+  8024b4:	6a 00                	push   $0x0
+  8024b6:	e8 bd ec ff ff       	call   801178 <sys_page_unmap>
+  8024bb:	83 c4 10             	add    $0x10,%esp
+}
+  8024be:	89 d8                	mov    %ebx,%eax
+  8024c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024c3:	5b                   	pop    %ebx
+  8024c4:	5e                   	pop    %esi
+  8024c5:	5d                   	pop    %ebp
+  8024c6:	c3                   	ret
+
+008024c7 <pipeisclosed>:
+{
+  8024c7:	55                   	push   %ebp
+  8024c8:	89 e5                	mov    %esp,%ebp
+  8024ca:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024d0:	50                   	push   %eax
+  8024d1:	ff 75 08             	push   0x8(%ebp)
+  8024d4:	e8 30 f2 ff ff       	call   801709 <fd_lookup>
+  8024d9:	83 c4 10             	add    $0x10,%esp
+  8024dc:	85 c0                	test   %eax,%eax
+  8024de:	78 18                	js     8024f8 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8024e0:	83 ec 0c             	sub    $0xc,%esp
+  8024e3:	ff 75 f4             	push   -0xc(%ebp)
+  8024e6:	e8 b3 f1 ff ff       	call   80169e <fd2data>
+  8024eb:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8024ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024f0:	e8 a8 fb ff ff       	call   80209d <_pipeisclosed>
+  8024f5:	83 c4 10             	add    $0x10,%esp
+}
+  8024f8:	c9                   	leave
+  8024f9:	c3                   	ret
+
+008024fa <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  8024fa:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8024fc:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  802502:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802508:	81 c2 34 01 00 00    	add    $0x134,%edx
+  80250e:	39 d0                	cmp    %edx,%eax
+  802510:	74 2e                	je     802540 <segment_lookup+0x46>
+{
+  802512:	55                   	push   %ebp
+  802513:	89 e5                	mov    %esp,%ebp
+  802515:	57                   	push   %edi
+  802516:	56                   	push   %esi
+  802517:	53                   	push   %ebx
+  802518:	eb 07                	jmp    802521 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  80251a:	83 c0 20             	add    $0x20,%eax
+  80251d:	39 d0                	cmp    %edx,%eax
+  80251f:	74 15                	je     802536 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802521:	8b 18                	mov    (%eax),%ebx
+  802523:	39 d9                	cmp    %ebx,%ecx
+  802525:	72 f3                	jb     80251a <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  802527:	8b 38                	mov    (%eax),%edi
+  802529:	8b 58 04             	mov    0x4(%eax),%ebx
+  80252c:	89 ce                	mov    %ecx,%esi
+  80252e:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  802530:	39 de                	cmp    %ebx,%esi
+  802532:	73 e6                	jae    80251a <segment_lookup+0x20>
+  802534:	eb 05                	jmp    80253b <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  802536:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80253b:	5b                   	pop    %ebx
+  80253c:	5e                   	pop    %esi
+  80253d:	5f                   	pop    %edi
+  80253e:	5d                   	pop    %ebp
+  80253f:	c3                   	ret
+	return NULL;
+  802540:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802545:	c3                   	ret
+
+00802546 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802546:	55                   	push   %ebp
+  802547:	89 e5                	mov    %esp,%ebp
+  802549:	53                   	push   %ebx
+  80254a:	83 ec 04             	sub    $0x4,%esp
+  80254d:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80254f:	c1 e8 16             	shr    $0x16,%eax
+  802552:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802559:	25 81 00 00 00       	and    $0x81,%eax
+  80255e:	83 f8 01             	cmp    $0x1,%eax
+  802561:	75 6b                	jne    8025ce <page_is_clean+0x88>
+  802563:	89 da                	mov    %ebx,%edx
+  802565:	c1 ea 0c             	shr    $0xc,%edx
+  802568:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  80256f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802574:	f6 c1 01             	test   $0x1,%cl
+  802577:	74 5a                	je     8025d3 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802579:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802580:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802586:	75 4b                	jne    8025d3 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  802588:	89 d8                	mov    %ebx,%eax
+  80258a:	e8 6b ff ff ff       	call   8024fa <segment_lookup>
+  80258f:	89 c2                	mov    %eax,%edx
+		return 1;
+  802591:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  802596:	85 d2                	test   %edx,%edx
+  802598:	75 39                	jne    8025d3 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  80259a:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  8025a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a5:	eb 03                	jmp    8025aa <page_is_clean+0x64>
+  8025a7:	83 c0 01             	add    $0x1,%eax
+  8025aa:	39 c2                	cmp    %eax,%edx
+  8025ac:	7e 19                	jle    8025c7 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  8025ae:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  8025b5:	72 f0                	jb     8025a7 <page_is_clean+0x61>
+  8025b7:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  8025be:	73 e7                	jae    8025a7 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  8025c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025c5:	eb 0c                	jmp    8025d3 <page_is_clean+0x8d>
+	return 0;
+  8025c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025cc:	eb 05                	jmp    8025d3 <page_is_clean+0x8d>
+		return 0;
+  8025ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025d6:	c9                   	leave
+  8025d7:	c3                   	ret
+
+008025d8 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  8025d8:	55                   	push   %ebp
+  8025d9:	89 e5                	mov    %esp,%ebp
+  8025db:	57                   	push   %edi
+  8025dc:	56                   	push   %esi
+  8025dd:	53                   	push   %ebx
+  8025de:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8025e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8025e6:	eb 19                	jmp    802601 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8025e8:	f7 d3                	not    %ebx
+  8025ea:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8025f0:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8025f2:	83 c6 01             	add    $0x1,%esi
+  8025f5:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8025fb:	0f 87 97 00 00 00    	ja     802698 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802601:	89 f3                	mov    %esi,%ebx
+  802603:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  802609:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80260f:	89 d8                	mov    %ebx,%eax
+  802611:	c1 e8 0a             	shr    $0xa,%eax
+  802614:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80261b:	25 81 00 00 00       	and    $0x81,%eax
+  802620:	83 f8 01             	cmp    $0x1,%eax
+  802623:	75 c3                	jne    8025e8 <linear_walk+0x10>
+  802625:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80262b:	77 bb                	ja     8025e8 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  80262d:	89 df                	mov    %ebx,%edi
+  80262f:	c1 e7 0c             	shl    $0xc,%edi
+  802632:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802635:	89 f8                	mov    %edi,%eax
+  802637:	e8 0a ff ff ff       	call   802546 <page_is_clean>
+  80263c:	84 c0                	test   %al,%al
+  80263e:	75 64                	jne    8026a4 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802640:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802646:	77 aa                	ja     8025f2 <linear_walk+0x1a>
+  802648:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  80264e:	72 a2                	jb     8025f2 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802650:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802657:	a8 01                	test   $0x1,%al
+  802659:	74 97                	je     8025f2 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80265b:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802662:	f6 c4 04             	test   $0x4,%ah
+  802665:	75 8b                	jne    8025f2 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802667:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80266e:	f6 c4 02             	test   $0x2,%ah
+  802671:	0f 85 7b ff ff ff    	jne    8025f2 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802677:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80267e:	c1 e8 0c             	shr    $0xc,%eax
+  802681:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802684:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802689:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80268d:	66 83 f8 01          	cmp    $0x1,%ax
+  802691:	76 11                	jbe    8026a4 <linear_walk+0xcc>
+  802693:	e9 5a ff ff ff       	jmp    8025f2 <linear_walk+0x1a>
+  802698:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  80269d:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  8026a4:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  8026aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026ad:	83 c4 1c             	add    $0x1c,%esp
+  8026b0:	5b                   	pop    %ebx
+  8026b1:	5e                   	pop    %esi
+  8026b2:	5f                   	pop    %edi
+  8026b3:	5d                   	pop    %ebp
+  8026b4:	c3                   	ret
+
+008026b5 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  8026b5:	55                   	push   %ebp
+  8026b6:	89 e5                	mov    %esp,%ebp
+  8026b8:	56                   	push   %esi
+  8026b9:	53                   	push   %ebx
+  8026ba:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  8026bc:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8026c1:	83 e0 7f             	and    $0x7f,%eax
+  8026c4:	c1 e0 04             	shl    $0x4,%eax
+  8026c7:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  8026cd:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  8026d3:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  8026d9:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  8026df:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8026e4:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  8026e7:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8026ec:	83 c0 01             	add    $0x1,%eax
+  8026ef:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  8026f4:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  8026f7:	5b                   	pop    %ebx
+  8026f8:	5e                   	pop    %esi
+  8026f9:	5d                   	pop    %ebp
+  8026fa:	c3                   	ret
+
+008026fb <page_ring_enter>:
+{
+  8026fb:	55                   	push   %ebp
+  8026fc:	89 e5                	mov    %esp,%ebp
+  8026fe:	57                   	push   %edi
+  8026ff:	56                   	push   %esi
+  802700:	53                   	push   %ebx
+  802701:	83 ec 18             	sub    $0x18,%esp
+  802704:	89 c6                	mov    %eax,%esi
+  802706:	89 d7                	mov    %edx,%edi
+  802708:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  80270a:	6a 00                	push   $0x0
+  80270c:	6a 00                	push   $0x0
+  80270e:	6a 00                	push   $0x0
+  802710:	6a 07                	push   $0x7
+  802712:	ff 35 40 b0 80 00    	push   0x80b040
+  802718:	e8 8e 26 00 00       	call   804dab <ipc_call>
+  80271d:	83 c4 20             	add    $0x20,%esp
+  802720:	85 c0                	test   %eax,%eax
+  802722:	79 22                	jns    802746 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802724:	50                   	push   %eax
+  802725:	68 e1 58 80 00       	push   $0x8058e1
+  80272a:	68 13 02 00 00       	push   $0x213
+  80272f:	68 f5 58 80 00       	push   $0x8058f5
+  802734:	e8 05 de ff ff       	call   80053e <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802739:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  80273e:	83 c0 01             	add    $0x1,%eax
+  802741:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802746:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  80274c:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802751:	39 c2                	cmp    %eax,%edx
+  802753:	74 24                	je     802779 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802755:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  80275a:	83 e0 7f             	and    $0x7f,%eax
+  80275d:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802764:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  80276b:	29 f0                	sub    %esi,%eax
+  80276d:	39 d8                	cmp    %ebx,%eax
+  80276f:	73 c8                	jae    802739 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802771:	8b 52 04             	mov    0x4(%edx),%edx
+  802774:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802777:	eb c0                	jmp    802739 <page_ring_enter+0x3e>
+}
+  802779:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80277c:	5b                   	pop    %ebx
+  80277d:	5e                   	pop    %esi
+  80277e:	5f                   	pop    %edi
+  80277f:	5d                   	pop    %ebp
+  802780:	c3                   	ret
+
+00802781 <page_ring_reserve>:
+{
+  802781:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802783:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802788:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  80278e:	29 d0                	sub    %edx,%eax
+  802790:	ba 80 00 00 00       	mov    $0x80,%edx
+  802795:	29 ca                	sub    %ecx,%edx
+  802797:	39 c2                	cmp    %eax,%edx
+  802799:	72 01                	jb     80279c <page_ring_reserve+0x1b>
+  80279b:	c3                   	ret
+{
+  80279c:	55                   	push   %ebp
+  80279d:	89 e5                	mov    %esp,%ebp
+  80279f:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  8027a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b1:	e8 45 ff ff ff       	call   8026fb <page_ring_enter>
+}
+  8027b6:	c9                   	leave
+  8027b7:	c3                   	ret
+
+008027b8 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  8027b8:	55                   	push   %ebp
+  8027b9:	89 e5                	mov    %esp,%ebp
+  8027bb:	53                   	push   %ebx
+  8027bc:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  8027bf:	6a 07                	push   $0x7
+  8027c1:	6a 01                	push   $0x1
+  8027c3:	89 c3                	mov    %eax,%ebx
+  8027c5:	c1 e3 0c             	shl    $0xc,%ebx
+  8027c8:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  8027ce:	52                   	push   %edx
+  8027cf:	6a 04                	push   $0x4
+  8027d1:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  8027d8:	e8 ce 25 00 00       	call   804dab <ipc_call>
+	sharereqs[i].nslots = 0;
+  8027dd:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  8027e4:	00 00 00 
+	return r;
+}
+  8027e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027ea:	c9                   	leave
+  8027eb:	c3                   	ret
+
+008027ec <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  8027ec:	55                   	push   %ebp
+  8027ed:	89 e5                	mov    %esp,%ebp
+  8027ef:	56                   	push   %esi
+  8027f0:	53                   	push   %ebx
+  8027f1:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  8027f3:	c1 e8 10             	shr    $0x10,%eax
+  8027f6:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  8027f9:	89 c2                	mov    %eax,%edx
+  8027fb:	c1 e2 0c             	shl    $0xc,%edx
+  8027fe:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  802804:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802807:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  80280d:	89 c2                	mov    %eax,%edx
+  80280f:	c1 e2 0a             	shl    $0xa,%edx
+  802812:	01 f2                	add    %esi,%edx
+  802814:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  80281b:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802821:	74 09                	je     80282c <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802823:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802828:	5b                   	pop    %ebx
+  802829:	5e                   	pop    %esi
+  80282a:	5d                   	pop    %ebp
+  80282b:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  80282c:	e8 87 ff ff ff       	call   8027b8 <page_share_send>
+  802831:	eb f5                	jmp    802828 <page_share_slot+0x3c>
+
+00802833 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802833:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802838:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  80283b:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802840:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  802846:	74 09                	je     802851 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802848:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80284d:	85 c0                	test   %eax,%eax
+  80284f:	75 01                	jne    802852 <page_ring_ready+0x1f>
+}
+  802851:	c3                   	ret
+{
+  802852:	55                   	push   %ebp
+  802853:	89 e5                	mov    %esp,%ebp
+  802855:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802858:	68 07 06 00 00       	push   $0x607
+  80285d:	6a 08                	push   $0x8
+  80285f:	68 00 30 ad de       	push   $0xdead3000
+  802864:	6a 00                	push   $0x0
+  802866:	e8 b3 e9 ff ff       	call   80121e <sys_page_alloc_range>
+  80286b:	83 c4 10             	add    $0x10,%esp
+  80286e:	83 f8 08             	cmp    $0x8,%eax
+  802871:	74 1b                	je     80288e <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802873:	83 ec 04             	sub    $0x4,%esp
+  802876:	6a 08                	push   $0x8
+  802878:	68 00 30 ad de       	push   $0xdead3000
+  80287d:	6a 00                	push   $0x0
+  80287f:	e8 08 ea ff ff       	call   80128c <sys_page_unmap_range>
+		return 0;
+  802884:	83 c4 10             	add    $0x10,%esp
+  802887:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80288c:	c9                   	leave
+  80288d:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  80288e:	83 ec 0c             	sub    $0xc,%esp
+  802891:	68 07 04 00 00       	push   $0x407
+  802896:	6a 08                	push   $0x8
+  802898:	68 00 30 ad de       	push   $0xdead3000
+  80289d:	6a 06                	push   $0x6
+  80289f:	ff 35 40 b0 80 00    	push   0x80b040
+  8028a5:	e8 01 25 00 00       	call   804dab <ipc_call>
+  8028aa:	83 c4 20             	add    $0x20,%esp
+  8028ad:	85 c0                	test   %eax,%eax
+  8028af:	78 14                	js     8028c5 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  8028b1:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8028b6:	8b 40 48             	mov    0x48(%eax),%eax
+  8028b9:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  8028be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028c3:	eb c7                	jmp    80288c <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  8028c5:	83 ec 04             	sub    $0x4,%esp
+  8028c8:	6a 08                	push   $0x8
+  8028ca:	68 00 30 ad de       	push   $0xdead3000
+  8028cf:	6a 00                	push   $0x0
+  8028d1:	e8 b6 e9 ff ff       	call   80128c <sys_page_unmap_range>
+		return 0;
+  8028d6:	83 c4 10             	add    $0x10,%esp
+  8028d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028de:	eb ac                	jmp    80288c <page_ring_ready+0x59>
+
+008028e0 <page_remove_slot>:
+{
+  8028e0:	55                   	push   %ebp
+  8028e1:	89 e5                	mov    %esp,%ebp
+  8028e3:	56                   	push   %esi
+  8028e4:	53                   	push   %ebx
+  8028e5:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8028e7:	89 c6                	mov    %eax,%esi
+  8028e9:	c1 ee 10             	shr    $0x10,%esi
+  8028ec:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8028ef:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  8028f6:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  8028fc:	74 2a                	je     802928 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8028fe:	83 ec 0c             	sub    $0xc,%esp
+  802901:	6a 00                	push   $0x0
+  802903:	6a 00                	push   $0x0
+  802905:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802907:	c1 e3 04             	shl    $0x4,%ebx
+  80290a:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  80290d:	53                   	push   %ebx
+  80290e:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  802915:	e8 91 24 00 00       	call   804dab <ipc_call>
+  80291a:	83 c4 20             	add    $0x20,%esp
+  80291d:	85 c0                	test   %eax,%eax
+  80291f:	78 2d                	js     80294e <page_remove_slot+0x6e>
+}
+  802921:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802924:	5b                   	pop    %ebx
+  802925:	5e                   	pop    %esi
+  802926:	5d                   	pop    %ebp
+  802927:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802928:	e8 06 ff ff ff       	call   802833 <page_ring_ready>
+  80292d:	85 c0                	test   %eax,%eax
+  80292f:	74 cd                	je     8028fe <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802931:	b8 01 00 00 00       	mov    $0x1,%eax
+  802936:	e8 46 fe ff ff       	call   802781 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  80293b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802940:	89 da                	mov    %ebx,%edx
+  802942:	b8 02 00 00 00       	mov    $0x2,%eax
+  802947:	e8 69 fd ff ff       	call   8026b5 <page_ring_post>
+		return;
+  80294c:	eb d3                	jmp    802921 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  80294e:	50                   	push   %eax
+  80294f:	68 50 59 80 00       	push   $0x805950
+  802954:	68 ac 03 00 00       	push   $0x3ac
+  802959:	68 f5 58 80 00       	push   $0x8058f5
+  80295e:	e8 db db ff ff       	call   80053e <_panic>
+
+00802963 <find_paging_env>:
+	if(pagingenv)
+  802963:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802968:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  80296a:	85 c0                	test   %eax,%eax
+  80296c:	74 05                	je     802973 <find_paging_env+0x10>
+  80296e:	eb 56                	jmp    8029c6 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802970:	83 c0 01             	add    $0x1,%eax
+  802973:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802978:	7f 47                	jg     8029c1 <find_paging_env+0x5e>
+  80297a:	83 f9 01             	cmp    $0x1,%ecx
+  80297d:	7f 42                	jg     8029c1 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  80297f:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802982:	c1 e2 06             	shl    $0x6,%edx
+  802985:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80298b:	8b 52 50             	mov    0x50(%edx),%edx
+  80298e:	83 fa 02             	cmp    $0x2,%edx
+  802991:	75 dd                	jne    802970 <find_paging_env+0xd>
+  802993:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802996:	c1 e2 06             	shl    $0x6,%edx
+  802999:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80299f:	8b 52 54             	mov    0x54(%edx),%edx
+  8029a2:	85 d2                	test   %edx,%edx
+  8029a4:	74 ca                	je     802970 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  8029a6:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  8029a9:	c1 e2 06             	shl    $0x6,%edx
+  8029ac:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8029b2:	8b 52 48             	mov    0x48(%edx),%edx
+  8029b5:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  8029bc:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8029bf:	eb af                	jmp    802970 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  8029c1:	83 f9 02             	cmp    $0x2,%ecx
+  8029c4:	74 01                	je     8029c7 <find_paging_env+0x64>
+}
+  8029c6:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  8029c7:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8029cc:	8b 40 48             	mov    0x48(%eax),%eax
+  8029cf:	83 e0 01             	and    $0x1,%eax
+  8029d2:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  8029d9:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  8029de:	eb e6                	jmp    8029c6 <find_paging_env+0x63>
+
+008029e0 <page_add_backed>:
+{
+  8029e0:	55                   	push   %ebp
+  8029e1:	89 e5                	mov    %esp,%ebp
+  8029e3:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  8029e6:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  8029eb:	83 f8 04             	cmp    $0x4,%eax
+  8029ee:	74 35                	je     802a25 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  8029f0:	89 d1                	mov    %edx,%ecx
+  8029f2:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  8029f8:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  8029ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a02:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802a09:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802a0f:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  802a16:	83 c0 01             	add    $0x1,%eax
+  802a19:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  802a1e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a23:	5d                   	pop    %ebp
+  802a24:	c3                   	ret
+		return -E_NO_MEM;
+  802a25:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802a2a:	eb f7                	jmp    802a23 <page_add_backed+0x43>
+
+00802a2c <percentage_of_pgdir_to_walk>:
+{
+  802a2c:	55                   	push   %ebp
+  802a2d:	89 e5                	mov    %esp,%ebp
+  802a2f:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802a32:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802a36:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802a39:	db 45 fc             	fildl  -0x4(%ebp)
+  802a3c:	d8 35 dc 5d 80 00    	fdivs  0x805ddc
+	return ret*ret;
+  802a42:	d8 c8                	fmul   %st(0),%st
+}
+  802a44:	c9                   	leave
+  802a45:	c3                   	ret
+
+00802a46 <nfu_with_aging_page_choice_func>:
+{
+  802a46:	55                   	push   %ebp
+  802a47:	89 e5                	mov    %esp,%ebp
+  802a49:	57                   	push   %edi
+  802a4a:	56                   	push   %esi
+  802a4b:	53                   	push   %ebx
+  802a4c:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802a4f:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  802a55:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802a57:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802a5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a61:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802a68:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a6d:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802a70:	eb 18                	jmp    802a8a <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802a72:	f7 d0                	not    %eax
+  802a74:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802a79:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802a7b:	83 c2 01             	add    $0x1,%edx
+  802a7e:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802a84:	0f 87 13 01 00 00    	ja     802b9d <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802a8a:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802a8e:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802a91:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802a96:	89 c1                	mov    %eax,%ecx
+  802a98:	c1 e9 0a             	shr    $0xa,%ecx
+  802a9b:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802aa2:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802aa8:	83 f9 01             	cmp    $0x1,%ecx
+  802aab:	75 c5                	jne    802a72 <nfu_with_aging_page_choice_func+0x2c>
+  802aad:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802ab2:	77 be                	ja     802a72 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802ab4:	89 c1                	mov    %eax,%ecx
+  802ab6:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802ab9:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802abf:	0f 82 a5 00 00 00    	jb     802b6a <nfu_with_aging_page_choice_func+0x124>
+  802ac5:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802acb:	0f 87 99 00 00 00    	ja     802b6a <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802ad1:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802ad8:	f6 c1 01             	test   $0x1,%cl
+  802adb:	0f 84 89 00 00 00    	je     802b6a <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802ae1:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802ae8:	f6 c5 04             	test   $0x4,%ch
+  802aeb:	75 7d                	jne    802b6a <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802aed:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802af4:	f6 c5 02             	test   $0x2,%ch
+  802af7:	75 71                	jne    802b6a <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802af9:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b00:	c1 e9 0c             	shr    $0xc,%ecx
+  802b03:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b06:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802b0c:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802b10:	66 83 f9 01          	cmp    $0x1,%cx
+  802b14:	77 54                	ja     802b6a <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802b16:	89 f9                	mov    %edi,%ecx
+  802b18:	80 f9 ff             	cmp    $0xff,%cl
+  802b1b:	74 21                	je     802b3e <nfu_with_aging_page_choice_func+0xf8>
+  802b1d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b24:	c1 e9 0c             	shr    $0xc,%ecx
+  802b27:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b2a:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802b30:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802b34:	89 fb                	mov    %edi,%ebx
+  802b36:	38 d9                	cmp    %bl,%cl
+  802b38:	73 30                	jae    802b6a <nfu_with_aging_page_choice_func+0x124>
+  802b3a:	dd d8                	fstp   %st(0)
+  802b3c:	eb 02                	jmp    802b40 <nfu_with_aging_page_choice_func+0xfa>
+  802b3e:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802b40:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b47:	c1 e9 0c             	shr    $0xc,%ecx
+  802b4a:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b4d:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802b54:	89 fb                	mov    %edi,%ebx
+  802b56:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802b59:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802b5c:	db 45 e0             	fildl  -0x20(%ebp)
+  802b5f:	d8 35 dc 5d 80 00    	fdivs  0x805ddc
+	return ret*ret;
+  802b65:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802b67:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802b6a:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802b6d:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802b70:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802b77:	df 6d e0             	fildll -0x20(%ebp)
+  802b7a:	d9 c1                	fld    %st(1)
+  802b7c:	d8 0d e0 5d 80 00    	fmuls  0x805de0
+  802b82:	d9 c9                	fxch   %st(1)
+  802b84:	df f1                	fcomip %st(1),%st
+  802b86:	dd d8                	fstp   %st(0)
+  802b88:	0f 82 ed fe ff ff    	jb     802a7b <nfu_with_aging_page_choice_func+0x35>
+  802b8e:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802b90:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  802b95:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802b98:	c1 e0 0c             	shl    $0xc,%eax
+  802b9b:	eb 0e                	jmp    802bab <nfu_with_aging_page_choice_func+0x165>
+  802b9d:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802b9f:	89 f8                	mov    %edi,%eax
+  802ba1:	3c ff                	cmp    $0xff,%al
+  802ba3:	74 0e                	je     802bb3 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802ba5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802ba8:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802bab:	83 c4 14             	add    $0x14,%esp
+  802bae:	5b                   	pop    %ebx
+  802baf:	5e                   	pop    %esi
+  802bb0:	5f                   	pop    %edi
+  802bb1:	5d                   	pop    %ebp
+  802bb2:	c3                   	ret
+	pgnum = 0;
+  802bb3:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  802bba:	00 00 00 
+	return (void*)UTOP;
+  802bbd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802bc2:	eb e7                	jmp    802bab <nfu_with_aging_page_choice_func+0x165>
+
+00802bc4 <myRand>:
+    state = state * 1664525 + 1013904223;
+  802bc4:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  802bcb:	66 19 00 
+  802bce:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802bd3:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  802bd8:	c1 e8 18             	shr    $0x18,%eax
+}
+  802bdb:	c3                   	ret
+
+00802bdc <random_page_choice_func>:
+{
+  802bdc:	55                   	push   %ebp
+  802bdd:	89 e5                	mov    %esp,%ebp
+  802bdf:	57                   	push   %edi
+  802be0:	56                   	push   %esi
+  802be1:	53                   	push   %ebx
+  802be2:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802be5:	be 00 00 00 00       	mov    $0x0,%esi
+  802bea:	eb 19                	jmp    802c05 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802bec:	f7 d3                	not    %ebx
+  802bee:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802bf4:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802bf6:	83 c6 01             	add    $0x1,%esi
+  802bf9:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802bff:	0f 87 a0 00 00 00    	ja     802ca5 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c05:	89 f3                	mov    %esi,%ebx
+  802c07:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  802c0d:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802c13:	89 d8                	mov    %ebx,%eax
+  802c15:	c1 e8 0a             	shr    $0xa,%eax
+  802c18:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802c1f:	25 81 00 00 00       	and    $0x81,%eax
+  802c24:	83 f8 01             	cmp    $0x1,%eax
+  802c27:	75 c3                	jne    802bec <random_page_choice_func+0x10>
+  802c29:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802c2f:	77 bb                	ja     802bec <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802c31:	89 df                	mov    %ebx,%edi
+  802c33:	c1 e7 0c             	shl    $0xc,%edi
+  802c36:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802c39:	89 f8                	mov    %edi,%eax
+  802c3b:	e8 06 f9 ff ff       	call   802546 <page_is_clean>
+  802c40:	84 c0                	test   %al,%al
+  802c42:	0f 85 82 00 00 00    	jne    802cca <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802c48:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  802c4e:	72 a6                	jb     802bf6 <random_page_choice_func+0x1a>
+  802c50:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802c56:	77 9e                	ja     802bf6 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802c58:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802c5f:	a8 01                	test   $0x1,%al
+  802c61:	74 93                	je     802bf6 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802c63:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802c6a:	f6 c4 04             	test   $0x4,%ah
+  802c6d:	75 87                	jne    802bf6 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802c6f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802c76:	f6 c4 02             	test   $0x2,%ah
+  802c79:	0f 85 77 ff ff ff    	jne    802bf6 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802c7f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802c86:	c1 e8 0c             	shr    $0xc,%eax
+  802c89:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802c8c:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802c91:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802c95:	66 83 f8 01          	cmp    $0x1,%ax
+  802c99:	0f 87 57 ff ff ff    	ja     802bf6 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  802c9f:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802ca5:	e8 1a ff ff ff       	call   802bc4 <myRand>
+  802caa:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  802cb0:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  802cb5:	29 fe                	sub    %edi,%esi
+  802cb7:	0f be c0             	movsbl %al,%eax
+  802cba:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cbf:	f7 f6                	div    %esi
+  802cc1:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802cc3:	bb 15 00 00 00       	mov    $0x15,%ebx
+  802cc8:	eb 1c                	jmp    802ce6 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  802cca:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  802cd0:	e9 8f 00 00 00       	jmp    802d64 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802cd5:	e8 ea fe ff ff       	call   802bc4 <myRand>
+  802cda:	0f be c0             	movsbl %al,%eax
+  802cdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ce2:	f7 f6                	div    %esi
+  802ce4:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802ce6:	83 eb 01             	sub    $0x1,%ebx
+  802ce9:	0f 84 c2 00 00 00    	je     802db1 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  802cef:	89 d0                	mov    %edx,%eax
+  802cf1:	c1 e8 0a             	shr    $0xa,%eax
+  802cf4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802cfb:	25 81 00 00 00       	and    $0x81,%eax
+  802d00:	83 f8 01             	cmp    $0x1,%eax
+  802d03:	75 d0                	jne    802cd5 <random_page_choice_func+0xf9>
+  802d05:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  802d0b:	77 c8                	ja     802cd5 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  802d0d:	89 d0                	mov    %edx,%eax
+  802d0f:	c1 e0 0c             	shl    $0xc,%eax
+  802d12:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  802d17:	72 56                	jb     802d6f <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802d19:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  802d1e:	77 65                	ja     802d85 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802d20:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802d27:	f6 c1 01             	test   $0x1,%cl
+  802d2a:	74 59                	je     802d85 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802d2c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802d33:	f6 c5 04             	test   $0x4,%ch
+  802d36:	75 4d                	jne    802d85 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  802d38:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802d3f:	f6 c5 02             	test   $0x2,%ch
+  802d42:	75 41                	jne    802d85 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  802d44:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802d4b:	c1 ea 0c             	shr    $0xc,%edx
+  802d4e:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  802d51:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  802d57:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  802d5b:	66 83 fa 01          	cmp    $0x1,%dx
+  802d5f:	77 3a                	ja     802d9b <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  802d61:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  802d64:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d67:	83 c4 1c             	add    $0x1c,%esp
+  802d6a:	5b                   	pop    %ebx
+  802d6b:	5e                   	pop    %esi
+  802d6c:	5f                   	pop    %edi
+  802d6d:	5d                   	pop    %ebp
+  802d6e:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802d6f:	e8 50 fe ff ff       	call   802bc4 <myRand>
+  802d74:	0f be c0             	movsbl %al,%eax
+  802d77:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d7c:	f7 f6                	div    %esi
+  802d7e:	01 fa                	add    %edi,%edx
+			continue;
+  802d80:	e9 61 ff ff ff       	jmp    802ce6 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802d85:	e8 3a fe ff ff       	call   802bc4 <myRand>
+  802d8a:	0f be c0             	movsbl %al,%eax
+  802d8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d92:	f7 f6                	div    %esi
+  802d94:	01 fa                	add    %edi,%edx
+			continue;
+  802d96:	e9 4b ff ff ff       	jmp    802ce6 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802d9b:	e8 24 fe ff ff       	call   802bc4 <myRand>
+  802da0:	0f be c0             	movsbl %al,%eax
+  802da3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802da8:	f7 f6                	div    %esi
+  802daa:	01 fa                	add    %edi,%edx
+			continue;
+  802dac:	e9 35 ff ff ff       	jmp    802ce6 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  802db1:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  802db8:	00 00 00 
+	return (void*)UTOP;
+  802dbb:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  802dc2:	eb a0                	jmp    802d64 <random_page_choice_func+0x188>
+
+00802dc4 <nfu>:
+{
+  802dc4:	55                   	push   %ebp
+  802dc5:	89 e5                	mov    %esp,%ebp
+  802dc7:	57                   	push   %edi
+  802dc8:	56                   	push   %esi
+  802dc9:	53                   	push   %ebx
+  802dca:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802dcd:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  802dd3:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802dd5:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802dda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ddf:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802de6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802deb:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802dee:	eb 18                	jmp    802e08 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802df0:	f7 d0                	not    %eax
+  802df2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802df7:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802df9:	83 c2 01             	add    $0x1,%edx
+  802dfc:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802e02:	0f 87 13 01 00 00    	ja     802f1b <nfu+0x157>
+		++num_searched_ptes;
+  802e08:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802e0c:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802e0f:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802e14:	89 c1                	mov    %eax,%ecx
+  802e16:	c1 e9 0a             	shr    $0xa,%ecx
+  802e19:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802e20:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802e26:	83 f9 01             	cmp    $0x1,%ecx
+  802e29:	75 c5                	jne    802df0 <nfu+0x2c>
+  802e2b:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802e30:	77 be                	ja     802df0 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802e32:	89 c1                	mov    %eax,%ecx
+  802e34:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802e37:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802e3d:	0f 82 a5 00 00 00    	jb     802ee8 <nfu+0x124>
+  802e43:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802e49:	0f 87 99 00 00 00    	ja     802ee8 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802e4f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802e56:	f6 c1 01             	test   $0x1,%cl
+  802e59:	0f 84 89 00 00 00    	je     802ee8 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802e5f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802e66:	f6 c5 04             	test   $0x4,%ch
+  802e69:	75 7d                	jne    802ee8 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802e6b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802e72:	f6 c5 02             	test   $0x2,%ch
+  802e75:	75 71                	jne    802ee8 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802e77:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802e7e:	c1 e9 0c             	shr    $0xc,%ecx
+  802e81:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802e84:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802e8a:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802e8e:	66 83 f9 01          	cmp    $0x1,%cx
+  802e92:	77 54                	ja     802ee8 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  802e94:	89 f9                	mov    %edi,%ecx
+  802e96:	80 f9 ff             	cmp    $0xff,%cl
+  802e99:	74 21                	je     802ebc <nfu+0xf8>
+  802e9b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802ea2:	c1 e9 0c             	shr    $0xc,%ecx
+  802ea5:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802ea8:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802eae:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  802eb2:	89 fb                	mov    %edi,%ebx
+  802eb4:	38 d9                	cmp    %bl,%cl
+  802eb6:	73 30                	jae    802ee8 <nfu+0x124>
+  802eb8:	dd d8                	fstp   %st(0)
+  802eba:	eb 02                	jmp    802ebe <nfu+0xfa>
+  802ebc:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  802ebe:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802ec5:	c1 e9 0c             	shr    $0xc,%ecx
+  802ec8:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802ecb:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802ed2:	89 fb                	mov    %edi,%ebx
+  802ed4:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802ed7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802eda:	db 45 e0             	fildl  -0x20(%ebp)
+  802edd:	d8 35 dc 5d 80 00    	fdivs  0x805ddc
+	return ret*ret;
+  802ee3:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802ee5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802ee8:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802eeb:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802eee:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802ef5:	df 6d e0             	fildll -0x20(%ebp)
+  802ef8:	d9 c1                	fld    %st(1)
+  802efa:	d8 0d e0 5d 80 00    	fmuls  0x805de0
+  802f00:	d9 c9                	fxch   %st(1)
+  802f02:	df f1                	fcomip %st(1),%st
+  802f04:	dd d8                	fstp   %st(0)
+  802f06:	0f 82 ed fe ff ff    	jb     802df9 <nfu+0x35>
+  802f0c:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802f0e:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  802f13:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802f16:	c1 e0 0c             	shl    $0xc,%eax
+  802f19:	eb 0e                	jmp    802f29 <nfu+0x165>
+  802f1b:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802f1d:	89 f8                	mov    %edi,%eax
+  802f1f:	3c ff                	cmp    $0xff,%al
+  802f21:	74 0e                	je     802f31 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802f23:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802f26:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802f29:	83 c4 14             	add    $0x14,%esp
+  802f2c:	5b                   	pop    %ebx
+  802f2d:	5e                   	pop    %esi
+  802f2e:	5f                   	pop    %edi
+  802f2f:	5d                   	pop    %ebp
+  802f30:	c3                   	ret
+	pgnum = 0;
+  802f31:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  802f38:	00 00 00 
+	return (void*)UTOP;
+  802f3b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802f40:	eb e7                	jmp    802f29 <nfu+0x165>
+
+00802f42 <lru>:
+{
+  802f42:	55                   	push   %ebp
+  802f43:	89 e5                	mov    %esp,%ebp
+  802f45:	57                   	push   %edi
+  802f46:	56                   	push   %esi
+  802f47:	53                   	push   %ebx
+  802f48:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802f4b:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  802f51:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  802f58:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802f5f:	be 00 00 00 00       	mov    $0x0,%esi
+  802f64:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802f6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f70:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  802f73:	eb 18                	jmp    802f8d <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802f75:	f7 d0                	not    %eax
+  802f77:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f7c:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802f7e:	83 c2 01             	add    $0x1,%edx
+  802f81:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802f87:	0f 87 fa 00 00 00    	ja     803087 <lru+0x145>
+		++num_searched_ptes;
+  802f8d:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802f90:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802f93:	01 d0                	add    %edx,%eax
+  802f95:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802f9a:	89 c1                	mov    %eax,%ecx
+  802f9c:	c1 e9 0a             	shr    $0xa,%ecx
+  802f9f:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802fa6:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802fac:	83 f9 01             	cmp    $0x1,%ecx
+  802faf:	75 c4                	jne    802f75 <lru+0x33>
+  802fb1:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802fb6:	77 bd                	ja     802f75 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802fb8:	89 c1                	mov    %eax,%ecx
+  802fba:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802fbd:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802fc3:	0f 87 92 00 00 00    	ja     80305b <lru+0x119>
+  802fc9:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802fcf:	0f 82 86 00 00 00    	jb     80305b <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802fd5:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802fdc:	f6 c1 01             	test   $0x1,%cl
+  802fdf:	74 7a                	je     80305b <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802fe1:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802fe8:	f6 c5 04             	test   $0x4,%ch
+  802feb:	75 6e                	jne    80305b <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802fed:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802ff4:	f6 c5 02             	test   $0x2,%ch
+  802ff7:	75 62                	jne    80305b <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802ff9:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803000:	c1 e9 0c             	shr    $0xc,%ecx
+  803003:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803006:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80300c:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803010:	66 83 f9 01          	cmp    $0x1,%cx
+  803014:	77 45                	ja     80305b <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  803016:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80301d:	c1 e9 0c             	shr    $0xc,%ecx
+  803020:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803023:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803029:	8b 59 14             	mov    0x14(%ecx),%ebx
+  80302c:	8b 49 10             	mov    0x10(%ecx),%ecx
+  80302f:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  803032:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803035:	19 df                	sbb    %ebx,%edi
+  803037:	7c 22                	jl     80305b <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  803039:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803040:	c1 e9 0c             	shr    $0xc,%ecx
+  803043:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803046:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80304c:	8b 59 14             	mov    0x14(%ecx),%ebx
+  80304f:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803052:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  803055:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803058:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  80305b:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  80305e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803065:	df 6d e0             	fildll -0x20(%ebp)
+  803068:	d9 05 e0 5d 80 00    	flds   0x805de0
+  80306e:	d9 c9                	fxch   %st(1)
+  803070:	df f1                	fcomip %st(1),%st
+  803072:	dd d8                	fstp   %st(0)
+  803074:	0f 82 04 ff ff ff    	jb     802f7e <lru+0x3c>
+			pgnum = pgnum_actual;
+  80307a:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  80307f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803082:	c1 e0 0c             	shl    $0xc,%eax
+  803085:	eb 06                	jmp    80308d <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  803087:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80308a:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80308d:	83 c4 1c             	add    $0x1c,%esp
+  803090:	5b                   	pop    %ebx
+  803091:	5e                   	pop    %esi
+  803092:	5f                   	pop    %edi
+  803093:	5d                   	pop    %ebp
+  803094:	c3                   	ret
+
+00803095 <set_page_choice_func>:
+{
+  803095:	55                   	push   %ebp
+  803096:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  803098:	8b 45 08             	mov    0x8(%ebp),%eax
+  80309b:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  8030a0:	5d                   	pop    %ebp
+  8030a1:	c3                   	ret
+
+008030a2 <get_page_choice>:
+{
+  8030a2:	55                   	push   %ebp
+  8030a3:	89 e5                	mov    %esp,%ebp
+  8030a5:	57                   	push   %edi
+  8030a6:	56                   	push   %esi
+  8030a7:	53                   	push   %ebx
+  8030a8:	83 ec 24             	sub    $0x24,%esp
+  8030ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  8030ae:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  8030b1:	57                   	push   %edi
+  8030b2:	56                   	push   %esi
+  8030b3:	ff 15 3c 60 80 00    	call   *0x80603c
+  8030b9:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8030bb:	83 c4 10             	add    $0x10,%esp
+  8030be:	eb 25                	jmp    8030e5 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  8030c0:	83 ec 08             	sub    $0x8,%esp
+  8030c3:	c1 e0 16             	shl    $0x16,%eax
+  8030c6:	50                   	push   %eax
+  8030c7:	6a 00                	push   $0x0
+  8030c9:	e8 ec e0 ff ff       	call   8011ba <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8030ce:	83 c4 10             	add    $0x10,%esp
+  8030d1:	85 c0                	test   %eax,%eax
+  8030d3:	75 43                	jne    803118 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  8030d5:	83 ec 08             	sub    $0x8,%esp
+  8030d8:	57                   	push   %edi
+  8030d9:	56                   	push   %esi
+  8030da:	ff 15 3c 60 80 00    	call   *0x80603c
+  8030e0:	89 c3                	mov    %eax,%ebx
+  8030e2:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8030e5:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8030e8:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8030ee:	0f 86 ae 00 00 00    	jbe    8031a2 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  8030f4:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  8030f9:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803100:	81 e2 81 00 00 00    	and    $0x81,%edx
+  803106:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  80310c:	74 b2                	je     8030c0 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80310e:	83 c0 01             	add    $0x1,%eax
+  803111:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  803116:	75 e1                	jne    8030f9 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803118:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80311b:	05 00 10 40 11       	add    $0x11401000,%eax
+  803120:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803125:	76 1f                	jbe    803146 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  803127:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  80312c:	89 d8                	mov    %ebx,%eax
+  80312e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803131:	5b                   	pop    %ebx
+  803132:	5e                   	pop    %esi
+  803133:	5f                   	pop    %edi
+  803134:	5d                   	pop    %ebp
+  803135:	c3                   	ret
+		sys_page_split(0, pg_out);
+  803136:	83 ec 08             	sub    $0x8,%esp
+  803139:	53                   	push   %ebx
+  80313a:	6a 00                	push   $0x0
+  80313c:	e8 79 e0 ff ff       	call   8011ba <sys_page_split>
+  803141:	83 c4 10             	add    $0x10,%esp
+  803144:	eb 6c                	jmp    8031b2 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  803146:	83 ec 04             	sub    $0x4,%esp
+  803149:	68 88 59 80 00       	push   $0x805988
+  80314e:	68 cc 01 00 00       	push   $0x1cc
+  803153:	68 f5 58 80 00       	push   $0x8058f5
+  803158:	e8 e1 d3 ff ff       	call   80053e <_panic>
+		panic("We tried to page out code pages\n");
+  80315d:	83 ec 04             	sub    $0x4,%esp
+  803160:	68 b8 59 80 00       	push   $0x8059b8
+  803165:	68 d6 01 00 00       	push   $0x1d6
+  80316a:	68 f5 58 80 00       	push   $0x8058f5
+  80316f:	e8 ca d3 ff ff       	call   80053e <_panic>
+		panic("Invalid mapping for the va\n");
+  803174:	83 ec 04             	sub    $0x4,%esp
+  803177:	68 02 59 80 00       	push   $0x805902
+  80317c:	68 da 01 00 00       	push   $0x1da
+  803181:	68 f5 58 80 00       	push   $0x8058f5
+  803186:	e8 b3 d3 ff ff       	call   80053e <_panic>
+		panic("We tried to page out a shared page\n");
+  80318b:	83 ec 04             	sub    $0x4,%esp
+  80318e:	68 dc 59 80 00       	push   $0x8059dc
+  803193:	68 e0 01 00 00       	push   $0x1e0
+  803198:	68 f5 58 80 00       	push   $0x8058f5
+  80319d:	e8 9c d3 ff ff       	call   80053e <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  8031a2:	89 de                	mov    %ebx,%esi
+  8031a4:	c1 ee 16             	shr    $0x16,%esi
+  8031a7:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8031ae:	a8 80                	test   $0x80,%al
+  8031b0:	75 84                	jne    803136 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  8031b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8031b5:	05 00 10 40 11       	add    $0x11401000,%eax
+  8031ba:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8031bf:	76 85                	jbe    803146 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  8031c1:	89 d8                	mov    %ebx,%eax
+  8031c3:	e8 7e f3 ff ff       	call   802546 <page_is_clean>
+  8031c8:	84 c0                	test   %al,%al
+  8031ca:	0f 85 5c ff ff ff    	jne    80312c <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  8031d0:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  8031d7:	76 84                	jbe    80315d <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  8031d9:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8031e0:	a8 01                	test   $0x1,%al
+  8031e2:	74 90                	je     803174 <get_page_choice+0xd2>
+  8031e4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8031e7:	c1 e8 0c             	shr    $0xc,%eax
+  8031ea:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8031f1:	f6 c2 01             	test   $0x1,%dl
+  8031f4:	0f 84 7a ff ff ff    	je     803174 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  8031fa:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  803201:	f6 c2 01             	test   $0x1,%dl
+  803204:	74 85                	je     80318b <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803206:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  80320d:	f6 c2 01             	test   $0x1,%dl
+  803210:	0f 84 75 ff ff ff    	je     80318b <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  803216:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  80321d:	f6 c6 04             	test   $0x4,%dh
+  803220:	0f 85 65 ff ff ff    	jne    80318b <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  803226:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  80322d:	f6 c6 02             	test   $0x2,%dh
+  803230:	0f 85 55 ff ff ff    	jne    80318b <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  803236:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80323d:	c1 e8 0c             	shr    $0xc,%eax
+  803240:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803243:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803248:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80324c:	66 83 f8 01          	cmp    $0x1,%ax
+  803250:	0f 86 d6 fe ff ff    	jbe    80312c <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  803256:	83 ec 04             	sub    $0x4,%esp
+  803259:	68 00 5a 80 00       	push   $0x805a00
+  80325e:	68 e2 01 00 00       	push   $0x1e2
+  803263:	68 f5 58 80 00       	push   $0x8058f5
+  803268:	e8 d1 d2 ff ff       	call   80053e <_panic>
+
+0080326d <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  80326d:	55                   	push   %ebp
+  80326e:	89 e5                	mov    %esp,%ebp
+  803270:	57                   	push   %edi
+  803271:	56                   	push   %esi
+  803272:	53                   	push   %ebx
+  803273:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  803276:	e8 e8 f6 ff ff       	call   802963 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  80327b:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803280:	85 c0                	test   %eax,%eax
+  803282:	74 41                	je     8032c5 <page_share_paged_out+0x58>
+  803284:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  80328b:	0f 84 fd 00 00 00    	je     80338e <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  803291:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  803298:	00 00 00 
+  80329b:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  8032a2:	00 00 00 
+  8032a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032aa:	eb 2c                	jmp    8032d8 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8032ac:	83 c3 04             	add    $0x4,%ebx
+  8032af:	39 f3                	cmp    %esi,%ebx
+  8032b1:	74 1a                	je     8032cd <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  8032b3:	8b 03                	mov    (%ebx),%eax
+  8032b5:	a8 01                	test   $0x1,%al
+  8032b7:	74 f3                	je     8032ac <page_share_paged_out+0x3f>
+  8032b9:	c1 e8 0c             	shr    $0xc,%eax
+  8032bc:	e8 2b f5 ff ff       	call   8027ec <page_share_slot>
+  8032c1:	85 c0                	test   %eax,%eax
+  8032c3:	79 e7                	jns    8032ac <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  8032c5:	83 c4 0c             	add    $0xc,%esp
+  8032c8:	5b                   	pop    %ebx
+  8032c9:	5e                   	pop    %esi
+  8032ca:	5f                   	pop    %edi
+  8032cb:	5d                   	pop    %ebp
+  8032cc:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  8032cd:	83 c7 04             	add    $0x4,%edi
+  8032d0:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  8032d6:	74 1b                	je     8032f3 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  8032d8:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8032dd:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  8032e0:	f6 c3 01             	test   $0x1,%bl
+  8032e3:	74 e8                	je     8032cd <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  8032e5:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8032eb:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  8032f1:	eb bc                	jmp    8032af <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8032f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032f8:	eb 11                	jmp    80330b <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  8032fa:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803300:	83 c3 01             	add    $0x1,%ebx
+  803303:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803309:	77 41                	ja     80334c <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  80330b:	89 d8                	mov    %ebx,%eax
+  80330d:	c1 e8 0a             	shr    $0xa,%eax
+  803310:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803317:	25 81 00 00 00       	and    $0x81,%eax
+  80331c:	83 f8 01             	cmp    $0x1,%eax
+  80331f:	75 d9                	jne    8032fa <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803321:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803328:	25 81 00 00 00       	and    $0x81,%eax
+  80332d:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803332:	75 cc                	jne    803300 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803334:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80333b:	c1 e8 0c             	shr    $0xc,%eax
+  80333e:	e8 a9 f4 ff ff       	call   8027ec <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803343:	85 c0                	test   %eax,%eax
+  803345:	79 b9                	jns    803300 <page_share_paged_out+0x93>
+  803347:	e9 79 ff ff ff       	jmp    8032c5 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80334c:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803353:	75 13                	jne    803368 <page_share_paged_out+0xfb>
+  803355:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80335c:	75 1d                	jne    80337b <page_share_paged_out+0x10e>
+	return 0;
+  80335e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803363:	e9 5d ff ff ff       	jmp    8032c5 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803368:	b8 00 00 00 00       	mov    $0x0,%eax
+  80336d:	e8 46 f4 ff ff       	call   8027b8 <page_share_send>
+  803372:	85 c0                	test   %eax,%eax
+  803374:	79 df                	jns    803355 <page_share_paged_out+0xe8>
+  803376:	e9 4a ff ff ff       	jmp    8032c5 <page_share_paged_out+0x58>
+  80337b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803380:	e8 33 f4 ff ff       	call   8027b8 <page_share_send>
+  803385:	85 c0                	test   %eax,%eax
+  803387:	79 d5                	jns    80335e <page_share_paged_out+0xf1>
+  803389:	e9 37 ff ff ff       	jmp    8032c5 <page_share_paged_out+0x58>
+		return 0;
+  80338e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803393:	e9 2d ff ff ff       	jmp    8032c5 <page_share_paged_out+0x58>
+
+00803398 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  803398:	55                   	push   %ebp
+  803399:	89 e5                	mov    %esp,%ebp
+  80339b:	56                   	push   %esi
+  80339c:	53                   	push   %ebx
+  80339d:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  8033a0:	e8 be f5 ff ff       	call   802963 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  8033a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  8033aa:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8033b1:	0f 84 82 00 00 00    	je     803439 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  8033b7:	83 ec 0c             	sub    $0xc,%esp
+  8033ba:	68 00 10 00 00       	push   $0x1000
+  8033bf:	e8 84 11 00 00       	call   804548 <malloc>
+  8033c4:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  8033c6:	83 c4 0c             	add    $0xc,%esp
+  8033c9:	6a 14                	push   $0x14
+  8033cb:	6a 00                	push   $0x0
+  8033cd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8033d0:	50                   	push   %eax
+  8033d1:	e8 7b d9 ff ff       	call   800d51 <memset>
+  8033d6:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  8033d9:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  8033de:	83 ec 0c             	sub    $0xc,%esp
+  8033e1:	6a 07                	push   $0x7
+  8033e3:	6a 01                	push   $0x1
+  8033e5:	53                   	push   %ebx
+  8033e6:	6a 03                	push   $0x3
+  8033e8:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8033ef:	e8 b7 19 00 00       	call   804dab <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  8033f4:	8b 03                	mov    (%ebx),%eax
+  8033f6:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  8033f9:	8b 43 04             	mov    0x4(%ebx),%eax
+  8033fc:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  8033ff:	8b 43 08             	mov    0x8(%ebx),%eax
+  803402:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  803405:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803408:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  80340b:	8b 43 10             	mov    0x10(%ebx),%eax
+  80340e:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803411:	83 c6 01             	add    $0x1,%esi
+  803414:	83 c4 20             	add    $0x20,%esp
+  803417:	83 fe 02             	cmp    $0x2,%esi
+  80341a:	75 c2                	jne    8033de <get_paging_stats+0x46>
+	}
+	*stats = total;
+  80341c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80341f:	89 03                	mov    %eax,(%ebx)
+  803421:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803424:	89 43 04             	mov    %eax,0x4(%ebx)
+  803427:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80342a:	89 43 08             	mov    %eax,0x8(%ebx)
+  80342d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803430:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803433:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803436:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  803439:	89 d8                	mov    %ebx,%eax
+  80343b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80343e:	5b                   	pop    %ebx
+  80343f:	5e                   	pop    %esi
+  803440:	5d                   	pop    %ebp
+  803441:	c3                   	ret
+
+00803442 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803442:	55                   	push   %ebp
+  803443:	89 e5                	mov    %esp,%ebp
+  803445:	53                   	push   %ebx
+  803446:	83 ec 10             	sub    $0x10,%esp
+  803449:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  80344c:	68 07 52 80 00       	push   $0x805207
+  803451:	e8 c3 d1 ff ff       	call   800619 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  803456:	83 c4 08             	add    $0x8,%esp
+  803459:	ff 33                	push   (%ebx)
+  80345b:	68 34 5a 80 00       	push   $0x805a34
+  803460:	e8 b4 d1 ff ff       	call   800619 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  803465:	83 c4 08             	add    $0x8,%esp
+  803468:	ff 73 04             	push   0x4(%ebx)
+  80346b:	68 1e 59 80 00       	push   $0x80591e
+  803470:	e8 a4 d1 ff ff       	call   800619 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  803475:	83 c4 08             	add    $0x8,%esp
+  803478:	ff 73 08             	push   0x8(%ebx)
+  80347b:	68 54 5a 80 00       	push   $0x805a54
+  803480:	e8 94 d1 ff ff       	call   800619 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  803485:	83 c4 08             	add    $0x8,%esp
+  803488:	ff 73 0c             	push   0xc(%ebx)
+  80348b:	68 78 5a 80 00       	push   $0x805a78
+  803490:	e8 84 d1 ff ff       	call   800619 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  803495:	83 c4 08             	add    $0x8,%esp
+  803498:	ff 73 10             	push   0x10(%ebx)
+  80349b:	68 9c 5a 80 00       	push   $0x805a9c
+  8034a0:	e8 74 d1 ff ff       	call   800619 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  8034a5:	83 c4 08             	add    $0x8,%esp
+  8034a8:	ff 35 08 b0 80 00    	push   0x80b008
+  8034ae:	68 d8 5a 80 00       	push   $0x805ad8
+  8034b3:	e8 61 d1 ff ff       	call   800619 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  8034b8:	83 c4 08             	add    $0x8,%esp
+  8034bb:	ff 35 04 b0 80 00    	push   0x80b004
+  8034c1:	68 0c 5b 80 00       	push   $0x805b0c
+  8034c6:	e8 4e d1 ff ff       	call   800619 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  8034cb:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8034d0:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  8034d3:	8b 50 68             	mov    0x68(%eax),%edx
+  8034d6:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  8034d9:	51                   	push   %ecx
+  8034da:	52                   	push   %edx
+  8034db:	50                   	push   %eax
+  8034dc:	68 4c 5b 80 00       	push   $0x805b4c
+  8034e1:	e8 33 d1 ff ff       	call   800619 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  8034e6:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8034eb:	8b 40 70             	mov    0x70(%eax),%eax
+  8034ee:	83 c4 18             	add    $0x18,%esp
+  8034f1:	50                   	push   %eax
+  8034f2:	68 80 5b 80 00       	push   $0x805b80
+  8034f7:	e8 1d d1 ff ff       	call   800619 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  8034fc:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  803502:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803508:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  80350d:	51                   	push   %ecx
+  80350e:	52                   	push   %edx
+  80350f:	50                   	push   %eax
+  803510:	68 b0 5b 80 00       	push   $0x805bb0
+  803515:	e8 ff d0 ff ff       	call   800619 <cprintf>
+	cprintf("\n");
+  80351a:	83 c4 14             	add    $0x14,%esp
+  80351d:	68 07 52 80 00       	push   $0x805207
+  803522:	e8 f2 d0 ff ff       	call   800619 <cprintf>
+}
+  803527:	83 c4 10             	add    $0x10,%esp
+  80352a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80352d:	c9                   	leave
+  80352e:	c3                   	ret
+
+0080352f <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  80352f:	55                   	push   %ebp
+  803530:	89 e5                	mov    %esp,%ebp
+  803532:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  803535:	e8 5e fe ff ff       	call   803398 <get_paging_stats>
+  80353a:	83 ec 0c             	sub    $0xc,%esp
+  80353d:	50                   	push   %eax
+  80353e:	e8 ff fe ff ff       	call   803442 <print_paging_stats>
+}
+  803543:	83 c4 10             	add    $0x10,%esp
+  803546:	c9                   	leave
+  803547:	c3                   	ret
+
+00803548 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803548:	55                   	push   %ebp
+  803549:	89 e5                	mov    %esp,%ebp
+  80354b:	53                   	push   %ebx
+  80354c:	83 ec 04             	sub    $0x4,%esp
+  80354f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803552:	eb 13                	jmp    803567 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803554:	83 ec 04             	sub    $0x4,%esp
+  803557:	6a ff                	push   $0xffffffff
+  803559:	53                   	push   %ebx
+  80355a:	68 00 f0 ff ee       	push   $0xeefff000
+  80355f:	e8 68 e0 ff ff       	call   8015cc <sys_futex_wait>
+  803564:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803567:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  80356c:	39 d8                	cmp    %ebx,%eax
+  80356e:	74 e4                	je     803554 <mem_pressure_wait+0xc>
+	return now;
+}
+  803570:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803573:	c9                   	leave
+  803574:	c3                   	ret
+
+00803575 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803575:	55                   	push   %ebp
+  803576:	89 e5                	mov    %esp,%ebp
+  803578:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  80357b:	68 e7 41 80 00       	push   $0x8041e7
+  803580:	e8 32 16 00 00       	call   804bb7 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803585:	c7 05 14 e9 80 00 00 	movl   $0xdeadb000,0x80e914
+  80358c:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  80358f:	83 c4 0c             	add    $0xc,%esp
+  803592:	68 07 02 00 00       	push   $0x207
+  803597:	68 00 b0 ad de       	push   $0xdeadb000
+  80359c:	6a 00                	push   $0x0
+  80359e:	e8 50 db ff ff       	call   8010f3 <sys_page_alloc>
+  8035a3:	83 c4 10             	add    $0x10,%esp
+  8035a6:	85 c0                	test   %eax,%eax
+  8035a8:	78 0c                	js     8035b6 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  8035aa:	e8 b4 f3 ff ff       	call   802963 <find_paging_env>
+	page_ring_ready();
+  8035af:	e8 7f f2 ff ff       	call   802833 <page_ring_ready>
+}
+  8035b4:	c9                   	leave
+  8035b5:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  8035b6:	50                   	push   %eax
+  8035b7:	68 3c 59 80 00       	push   $0x80593c
+  8035bc:	68 13 05 00 00       	push   $0x513
+  8035c1:	68 f5 58 80 00       	push   $0x8058f5
+  8035c6:	e8 73 cf ff ff       	call   80053e <_panic>
+
+008035cb <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  8035cb:	55                   	push   %ebp
+  8035cc:	89 e5                	mov    %esp,%ebp
+  8035ce:	57                   	push   %edi
+  8035cf:	56                   	push   %esi
+  8035d0:	53                   	push   %ebx
+  8035d1:	83 ec 0c             	sub    $0xc,%esp
+  8035d4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  8035d7:	89 fa                	mov    %edi,%edx
+  8035d9:	c1 ea 16             	shr    $0x16,%edx
+  8035dc:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8035e1:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  8035e4:	f6 06 01             	testb  $0x1,(%esi)
+  8035e7:	75 3e                	jne    803627 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  8035e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  8035ee:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8035f2:	74 47                	je     80363b <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  8035f4:	83 ec 0c             	sub    $0xc,%esp
+  8035f7:	6a 01                	push   $0x1
+  8035f9:	e8 f2 11 00 00       	call   8047f0 <va_alloc>
+  8035fe:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  803600:	83 c4 10             	add    $0x10,%esp
+  803603:	85 c0                	test   %eax,%eax
+  803605:	74 34                	je     80363b <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803607:	6a 00                	push   $0x0
+  803609:	68 07 02 00 00       	push   $0x207
+  80360e:	50                   	push   %eax
+  80360f:	6a 00                	push   $0x0
+  803611:	e8 df 02 00 00       	call   8038f5 <page_alloc>
+  803616:	83 c4 10             	add    $0x10,%esp
+  803619:	85 c0                	test   %eax,%eax
+  80361b:	78 28                	js     803645 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  80361d:	f6 06 01             	testb  $0x1,(%esi)
+  803620:	75 38                	jne    80365a <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803622:	83 cb 01             	or     $0x1,%ebx
+  803625:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803627:	89 f8                	mov    %edi,%eax
+  803629:	c1 e8 0a             	shr    $0xa,%eax
+  80362c:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803631:	8b 1e                	mov    (%esi),%ebx
+  803633:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803639:	01 c3                	add    %eax,%ebx
+}
+  80363b:	89 d8                	mov    %ebx,%eax
+  80363d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803640:	5b                   	pop    %ebx
+  803641:	5e                   	pop    %esi
+  803642:	5f                   	pop    %edi
+  803643:	5d                   	pop    %ebp
+  803644:	c3                   	ret
+			va_free(page, 1);
+  803645:	83 ec 08             	sub    $0x8,%esp
+  803648:	6a 01                	push   $0x1
+  80364a:	53                   	push   %ebx
+  80364b:	e8 d8 12 00 00       	call   804928 <va_free>
+			return NULL;
+  803650:	83 c4 10             	add    $0x10,%esp
+  803653:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803658:	eb e1                	jmp    80363b <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  80365a:	83 ec 08             	sub    $0x8,%esp
+  80365d:	53                   	push   %ebx
+  80365e:	6a 00                	push   $0x0
+  803660:	e8 13 db ff ff       	call   801178 <sys_page_unmap>
+			va_free(page, 1);
+  803665:	83 c4 08             	add    $0x8,%esp
+  803668:	6a 01                	push   $0x1
+  80366a:	53                   	push   %ebx
+  80366b:	e8 b8 12 00 00       	call   804928 <va_free>
+  803670:	83 c4 10             	add    $0x10,%esp
+  803673:	eb b2                	jmp    803627 <umapdir_walk+0x5c>
+
+00803675 <page_out>:
+{
+  803675:	55                   	push   %ebp
+  803676:	89 e5                	mov    %esp,%ebp
+  803678:	57                   	push   %edi
+  803679:	56                   	push   %esi
+  80367a:	53                   	push   %ebx
+  80367b:	83 ec 5c             	sub    $0x5c,%esp
+  80367e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803681:	e8 dd f2 ff ff       	call   802963 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803686:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80368b:	85 c0                	test   %eax,%eax
+  80368d:	74 1e                	je     8036ad <page_out+0x38>
+  80368f:	83 ec 0c             	sub    $0xc,%esp
+  803692:	6a 00                	push   $0x0
+  803694:	6a 00                	push   $0x0
+  803696:	6a 00                	push   $0x0
+  803698:	6a 08                	push   $0x8
+  80369a:	50                   	push   %eax
+  80369b:	e8 0b 17 00 00       	call   804dab <ipc_call>
+  8036a0:	89 c3                	mov    %eax,%ebx
+  8036a2:	83 c4 20             	add    $0x20,%esp
+  8036a5:	85 c0                	test   %eax,%eax
+  8036a7:	0f 84 ac 00 00 00    	je     803759 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  8036ad:	83 ec 08             	sub    $0x8,%esp
+  8036b0:	ff 75 0c             	push   0xc(%ebp)
+  8036b3:	57                   	push   %edi
+  8036b4:	e8 e9 f9 ff ff       	call   8030a2 <get_page_choice>
+  8036b9:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  8036bb:	83 c4 10             	add    $0x10,%esp
+  8036be:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8036c3:	0f 84 18 02 00 00    	je     8038e1 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  8036c9:	e8 78 ee ff ff       	call   802546 <page_is_clean>
+  8036ce:	84 c0                	test   %al,%al
+  8036d0:	0f 85 8c 00 00 00    	jne    803762 <page_out+0xed>
+	if (pagingenv == 0)
+  8036d6:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8036dd:	0f 84 08 02 00 00    	je     8038eb <page_out+0x276>
+	if (page_ring_ready())
+  8036e3:	e8 4b f1 ff ff       	call   802833 <page_ring_ready>
+  8036e8:	89 c3                	mov    %eax,%ebx
+  8036ea:	85 c0                	test   %eax,%eax
+  8036ec:	0f 85 89 00 00 00    	jne    80377b <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  8036f2:	83 ec 0c             	sub    $0xc,%esp
+  8036f5:	6a 05                	push   $0x5
+  8036f7:	6a 01                	push   $0x1
+  8036f9:	56                   	push   %esi
+  8036fa:	6a 01                	push   $0x1
+  8036fc:	ff 35 40 b0 80 00    	push   0x80b040
+  803702:	e8 a4 16 00 00       	call   804dab <ipc_call>
+  803707:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803709:	83 c4 20             	add    $0x20,%esp
+  80370c:	85 c0                	test   %eax,%eax
+  80370e:	0f 88 b8 01 00 00    	js     8038cc <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803714:	89 f0                	mov    %esi,%eax
+  803716:	c1 e8 0c             	shr    $0xc,%eax
+  803719:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803720:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803723:	83 ec 08             	sub    $0x8,%esp
+  803726:	56                   	push   %esi
+  803727:	6a 00                	push   $0x0
+  803729:	e8 4a da ff ff       	call   801178 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  80372e:	83 c4 08             	add    $0x8,%esp
+  803731:	6a 01                	push   $0x1
+  803733:	56                   	push   %esi
+  803734:	e8 92 fe ff ff       	call   8035cb <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803739:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  80373c:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803742:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803745:	09 fe                	or     %edi,%esi
+  803747:	83 ce 01             	or     $0x1,%esi
+  80374a:	89 30                	mov    %esi,(%eax)
+	return 0;
+  80374c:	83 c4 10             	add    $0x10,%esp
+}
+  80374f:	89 d8                	mov    %ebx,%eax
+  803751:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803754:	5b                   	pop    %ebx
+  803755:	5e                   	pop    %esi
+  803756:	5f                   	pop    %edi
+  803757:	5d                   	pop    %ebp
+  803758:	c3                   	ret
+		num_page_reclaims++;
+  803759:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  803760:	eb ed                	jmp    80374f <page_out+0xda>
+		num_page_drops++;
+  803762:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  803769:	83 ec 08             	sub    $0x8,%esp
+  80376c:	56                   	push   %esi
+  80376d:	6a 00                	push   $0x0
+  80376f:	e8 04 da ff ff       	call   801178 <sys_page_unmap>
+  803774:	89 c3                	mov    %eax,%ebx
+  803776:	83 c4 10             	add    $0x10,%esp
+  803779:	eb d4                	jmp    80374f <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80377b:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  80377d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803782:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803787:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  80378a:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  80378c:	83 c0 08             	add    $0x8,%eax
+  80378f:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803792:	b8 07 00 00 00       	mov    $0x7,%eax
+  803797:	e8 e5 ef ff ff       	call   802781 <page_ring_reserve>
+	first = ring->sq_tail;
+  80379c:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8037a1:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  8037a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  8037a9:	83 ec 04             	sub    $0x4,%esp
+  8037ac:	68 00 10 00 00       	push   $0x1000
+  8037b1:	56                   	push   %esi
+  8037b2:	89 d8                	mov    %ebx,%eax
+  8037b4:	c1 e0 0c             	shl    $0xc,%eax
+  8037b7:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  8037bc:	50                   	push   %eax
+  8037bd:	e8 26 d6 ff ff       	call   800de8 <memcpy>
+		vas[n] = va;
+  8037c2:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  8037c6:	89 d9                	mov    %ebx,%ecx
+  8037c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037cd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8037d2:	e8 de ee ff ff       	call   8026b5 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  8037d7:	8d 43 01             	lea    0x1(%ebx),%eax
+  8037da:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  8037dd:	83 c4 10             	add    $0x10,%esp
+  8037e0:	83 fb 06             	cmp    $0x6,%ebx
+  8037e3:	74 62                	je     803847 <page_out+0x1d2>
+  8037e5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8037e8:	eb 15                	jmp    8037ff <page_out+0x18a>
+			num_page_drops++;
+  8037ea:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  8037f1:	83 ec 08             	sub    $0x8,%esp
+  8037f4:	56                   	push   %esi
+  8037f5:	6a 00                	push   $0x0
+  8037f7:	e8 7c d9 ff ff       	call   801178 <sys_page_unmap>
+  8037fc:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  8037ff:	83 ec 08             	sub    $0x8,%esp
+  803802:	53                   	push   %ebx
+  803803:	57                   	push   %edi
+  803804:	e8 99 f8 ff ff       	call   8030a2 <get_page_choice>
+  803809:	89 c6                	mov    %eax,%esi
+  80380b:	83 c4 10             	add    $0x10,%esp
+  80380e:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803813:	74 32                	je     803847 <page_out+0x1d2>
+  803815:	e8 2c ed ff ff       	call   802546 <page_is_clean>
+  80381a:	84 c0                	test   %al,%al
+  80381c:	75 cc                	jne    8037ea <page_out+0x175>
+		if (va == (void *) UTOP ||
+  80381e:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803821:	39 c6                	cmp    %eax,%esi
+  803823:	72 07                	jb     80382c <page_out+0x1b7>
+  803825:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803828:	39 c6                	cmp    %eax,%esi
+  80382a:	72 1b                	jb     803847 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  80382c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803831:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803834:	eb 03                	jmp    803839 <page_out+0x1c4>
+  803836:	83 c3 01             	add    $0x1,%ebx
+  803839:	39 da                	cmp    %ebx,%edx
+  80383b:	0f 84 68 ff ff ff    	je     8037a9 <page_out+0x134>
+  803841:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803845:	75 ef                	jne    803836 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803847:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  80384a:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  80384d:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803850:	e8 a6 ee ff ff       	call   8026fb <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803855:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80385a:	eb 42                	jmp    80389e <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  80385c:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803860:	89 f8                	mov    %edi,%eax
+  803862:	c1 e8 0c             	shr    $0xc,%eax
+  803865:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80386c:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  80386f:	83 ec 08             	sub    $0x8,%esp
+  803872:	57                   	push   %edi
+  803873:	6a 00                	push   $0x0
+  803875:	e8 fe d8 ff ff       	call   801178 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  80387a:	83 c4 08             	add    $0x8,%esp
+  80387d:	6a 01                	push   $0x1
+  80387f:	57                   	push   %edi
+  803880:	e8 46 fd ff ff       	call   8035cb <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803885:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803888:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  80388e:	c1 e6 0c             	shl    $0xc,%esi
+  803891:	09 d6                	or     %edx,%esi
+  803893:	83 ce 01             	or     $0x1,%esi
+  803896:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803898:	83 c3 01             	add    $0x1,%ebx
+  80389b:	83 c4 10             	add    $0x10,%esp
+  80389e:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  8038a1:	39 c3                	cmp    %eax,%ebx
+  8038a3:	74 1d                	je     8038c2 <page_out+0x24d>
+		if (res[i] < 0)
+  8038a5:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  8038a9:	85 f6                	test   %esi,%esi
+  8038ab:	79 af                	jns    80385c <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  8038ad:	56                   	push   %esi
+  8038ae:	68 e0 5b 80 00       	push   $0x805be0
+  8038b3:	68 d1 02 00 00       	push   $0x2d1
+  8038b8:	68 f5 58 80 00       	push   $0x8058f5
+  8038bd:	e8 7c cc ff ff       	call   80053e <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  8038c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038c7:	e9 83 fe ff ff       	jmp    80374f <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  8038cc:	50                   	push   %eax
+  8038cd:	68 e0 5b 80 00       	push   $0x805be0
+  8038d2:	68 0a 03 00 00       	push   $0x30a
+  8038d7:	68 f5 58 80 00       	push   $0x8058f5
+  8038dc:	e8 5d cc ff ff       	call   80053e <_panic>
+		return -E_NO_MEM;
+  8038e1:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  8038e6:	e9 64 fe ff ff       	jmp    80374f <page_out+0xda>
+		return -E_PAGING;
+  8038eb:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8038f0:	e9 5a fe ff ff       	jmp    80374f <page_out+0xda>
+
+008038f5 <page_alloc>:
+{
+  8038f5:	55                   	push   %ebp
+  8038f6:	89 e5                	mov    %esp,%ebp
+  8038f8:	57                   	push   %edi
+  8038f9:	56                   	push   %esi
+  8038fa:	53                   	push   %ebx
+  8038fb:	83 ec 0c             	sub    $0xc,%esp
+  8038fe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803901:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803904:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  80390b:	74 34                	je     803941 <page_alloc+0x4c>
+	if (check_mte)
+  80390d:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803911:	75 35                	jne    803948 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803913:	83 ec 04             	sub    $0x4,%esp
+  803916:	ff 75 10             	push   0x10(%ebp)
+  803919:	56                   	push   %esi
+  80391a:	57                   	push   %edi
+  80391b:	e8 d3 d7 ff ff       	call   8010f3 <sys_page_alloc>
+  803920:	89 c3                	mov    %eax,%ebx
+  803922:	83 c4 10             	add    $0x10,%esp
+  803925:	85 c0                	test   %eax,%eax
+  803927:	79 52                	jns    80397b <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803929:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80392c:	75 52                	jne    803980 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  80392e:	83 ec 08             	sub    $0x8,%esp
+  803931:	56                   	push   %esi
+  803932:	57                   	push   %edi
+  803933:	e8 3d fd ff ff       	call   803675 <page_out>
+  803938:	83 c4 10             	add    $0x10,%esp
+  80393b:	85 c0                	test   %eax,%eax
+  80393d:	79 d4                	jns    803913 <page_alloc+0x1e>
+  80393f:	eb 3f                	jmp    803980 <page_alloc+0x8b>
+		init_map_dir();
+  803941:	e8 2f fc ff ff       	call   803575 <init_map_dir>
+  803946:	eb c5                	jmp    80390d <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803948:	83 ec 08             	sub    $0x8,%esp
+  80394b:	6a 00                	push   $0x0
+  80394d:	56                   	push   %esi
+  80394e:	e8 78 fc ff ff       	call   8035cb <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803953:	83 c4 10             	add    $0x10,%esp
+  803956:	85 c0                	test   %eax,%eax
+  803958:	74 b9                	je     803913 <page_alloc+0x1e>
+  80395a:	8b 10                	mov    (%eax),%edx
+  80395c:	f6 c2 01             	test   $0x1,%dl
+  80395f:	74 b2                	je     803913 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803961:	83 ec 08             	sub    $0x8,%esp
+  803964:	56                   	push   %esi
+  803965:	52                   	push   %edx
+  803966:	50                   	push   %eax
+  803967:	68 04 5c 80 00       	push   $0x805c04
+  80396c:	68 34 03 00 00       	push   $0x334
+  803971:	68 f5 58 80 00       	push   $0x8058f5
+  803976:	e8 c3 cb ff ff       	call   80053e <_panic>
+	return 0;
+  80397b:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803980:	89 d8                	mov    %ebx,%eax
+  803982:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803985:	5b                   	pop    %ebx
+  803986:	5e                   	pop    %esi
+  803987:	5f                   	pop    %edi
+  803988:	5d                   	pop    %ebp
+  803989:	c3                   	ret
+
+0080398a <page_adopt>:
+{
+  80398a:	55                   	push   %ebp
+  80398b:	89 e5                	mov    %esp,%ebp
+  80398d:	56                   	push   %esi
+  80398e:	53                   	push   %ebx
+  80398f:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803991:	c1 e8 16             	shr    $0x16,%eax
+  803994:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80399b:	25 81 00 00 00       	and    $0x81,%eax
+  8039a0:	83 f8 01             	cmp    $0x1,%eax
+  8039a3:	75 53                	jne    8039f8 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  8039a5:	89 d8                	mov    %ebx,%eax
+  8039a7:	c1 e8 0c             	shr    $0xc,%eax
+  8039aa:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  8039b1:	89 f2                	mov    %esi,%edx
+  8039b3:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  8039b9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  8039be:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  8039c4:	75 37                	jne    8039fd <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  8039c6:	83 ec 08             	sub    $0x8,%esp
+  8039c9:	6a 01                	push   $0x1
+  8039cb:	53                   	push   %ebx
+  8039cc:	e8 fa fb ff ff       	call   8035cb <umapdir_walk>
+  8039d1:	83 c4 10             	add    $0x10,%esp
+  8039d4:	85 c0                	test   %eax,%eax
+  8039d6:	74 2c                	je     803a04 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  8039d8:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  8039de:	83 ce 01             	or     $0x1,%esi
+  8039e1:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  8039e3:	83 ec 08             	sub    $0x8,%esp
+  8039e6:	53                   	push   %ebx
+  8039e7:	6a 00                	push   $0x0
+  8039e9:	e8 8a d7 ff ff       	call   801178 <sys_page_unmap>
+	return 1;
+  8039ee:	83 c4 10             	add    $0x10,%esp
+  8039f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8039f6:	eb 05                	jmp    8039fd <page_adopt+0x73>
+		return 0;
+  8039f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a00:	5b                   	pop    %ebx
+  803a01:	5e                   	pop    %esi
+  803a02:	5d                   	pop    %ebp
+  803a03:	c3                   	ret
+		return -E_NO_MEM;
+  803a04:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803a09:	eb f2                	jmp    8039fd <page_adopt+0x73>
+
+00803a0b <page_forget>:
+{
+  803a0b:	55                   	push   %ebp
+  803a0c:	89 e5                	mov    %esp,%ebp
+  803a0e:	53                   	push   %ebx
+  803a0f:	83 ec 04             	sub    $0x4,%esp
+  803a12:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803a14:	e8 4a ef ff ff       	call   802963 <find_paging_env>
+	if (pagingenv == 0)
+  803a19:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803a20:	74 39                	je     803a5b <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803a22:	89 d8                	mov    %ebx,%eax
+  803a24:	c1 e8 16             	shr    $0x16,%eax
+  803a27:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803a2e:	25 81 00 00 00       	and    $0x81,%eax
+  803a33:	83 f8 01             	cmp    $0x1,%eax
+  803a36:	74 28                	je     803a60 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803a38:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803a3f:	74 1a                	je     803a5b <page_forget+0x50>
+  803a41:	83 ec 08             	sub    $0x8,%esp
+  803a44:	6a 00                	push   $0x0
+  803a46:	53                   	push   %ebx
+  803a47:	e8 7f fb ff ff       	call   8035cb <umapdir_walk>
+  803a4c:	89 c3                	mov    %eax,%ebx
+  803a4e:	83 c4 10             	add    $0x10,%esp
+  803a51:	85 c0                	test   %eax,%eax
+  803a53:	74 06                	je     803a5b <page_forget+0x50>
+  803a55:	8b 00                	mov    (%eax),%eax
+  803a57:	a8 01                	test   $0x1,%al
+  803a59:	75 2b                	jne    803a86 <page_forget+0x7b>
+}
+  803a5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a5e:	c9                   	leave
+  803a5f:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803a60:	89 d8                	mov    %ebx,%eax
+  803a62:	c1 e8 0c             	shr    $0xc,%eax
+  803a65:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803a6c:	89 c2                	mov    %eax,%edx
+  803a6e:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803a74:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803a7a:	75 bc                	jne    803a38 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803a7c:	c1 e8 0c             	shr    $0xc,%eax
+  803a7f:	e8 5c ee ff ff       	call   8028e0 <page_remove_slot>
+		return;
+  803a84:	eb d5                	jmp    803a5b <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803a86:	c1 e8 0c             	shr    $0xc,%eax
+  803a89:	e8 52 ee ff ff       	call   8028e0 <page_remove_slot>
+	*mte = 0;
+  803a8e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803a94:	eb c5                	jmp    803a5b <page_forget+0x50>
+
+00803a96 <page_unmap>:
+{
+  803a96:	55                   	push   %ebp
+  803a97:	89 e5                	mov    %esp,%ebp
+  803a99:	57                   	push   %edi
+  803a9a:	56                   	push   %esi
+  803a9b:	53                   	push   %ebx
+  803a9c:	83 ec 0c             	sub    $0xc,%esp
+  803a9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803aa2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803aa5:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803aaa:	8b 40 48             	mov    0x48(%eax),%eax
+  803aad:	85 db                	test   %ebx,%ebx
+  803aaf:	0f 8e b4 00 00 00    	jle    803b69 <page_unmap+0xd3>
+  803ab5:	39 d8                	cmp    %ebx,%eax
+  803ab7:	0f 84 ac 00 00 00    	je     803b69 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803abd:	83 ec 08             	sub    $0x8,%esp
+  803ac0:	57                   	push   %edi
+  803ac1:	53                   	push   %ebx
+  803ac2:	e8 b1 d6 ff ff       	call   801178 <sys_page_unmap>
+  803ac7:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803ac9:	e8 95 ee ff ff       	call   802963 <find_paging_env>
+	if (pagingenv == 0)
+  803ace:	83 c4 10             	add    $0x10,%esp
+  803ad1:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803ad8:	0f 84 a1 00 00 00    	je     803b7f <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803ade:	83 ec 0c             	sub    $0xc,%esp
+  803ae1:	6a 05                	push   $0x5
+  803ae3:	68 00 00 40 00       	push   $0x400000
+  803ae8:	6a 00                	push   $0x0
+  803aea:	68 00 b0 ad de       	push   $0xdeadb000
+  803aef:	53                   	push   %ebx
+  803af0:	e8 41 d6 ff ff       	call   801136 <sys_page_map>
+  803af5:	83 c4 20             	add    $0x20,%esp
+  803af8:	85 c0                	test   %eax,%eax
+  803afa:	0f 88 89 00 00 00    	js     803b89 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803b00:	89 f8                	mov    %edi,%eax
+  803b02:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803b05:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803b0c:	a8 01                	test   $0x1,%al
+  803b0e:	74 6f                	je     803b7f <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803b10:	83 ec 0c             	sub    $0xc,%esp
+  803b13:	6a 05                	push   $0x5
+  803b15:	68 00 00 40 00       	push   $0x400000
+  803b1a:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803b1c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803b21:	50                   	push   %eax
+  803b22:	53                   	push   %ebx
+  803b23:	e8 0e d6 ff ff       	call   801136 <sys_page_map>
+  803b28:	83 c4 20             	add    $0x20,%esp
+  803b2b:	85 c0                	test   %eax,%eax
+  803b2d:	78 6f                	js     803b9e <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803b2f:	c1 ef 0c             	shr    $0xc,%edi
+  803b32:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803b38:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803b3f:	01 
+  803b40:	74 3d                	je     803b7f <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803b42:	83 ec 08             	sub    $0x8,%esp
+  803b45:	68 00 00 40 00       	push   $0x400000
+  803b4a:	6a 00                	push   $0x0
+  803b4c:	e8 27 d6 ff ff       	call   801178 <sys_page_unmap>
+  803b51:	83 c4 10             	add    $0x10,%esp
+  803b54:	85 c0                	test   %eax,%eax
+  803b56:	78 5b                	js     803bb3 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803b58:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803b5f:	c1 e8 0c             	shr    $0xc,%eax
+  803b62:	e8 79 ed ff ff       	call   8028e0 <page_remove_slot>
+	return r;
+  803b67:	eb 16                	jmp    803b7f <page_unmap+0xe9>
+		page_forget(va);
+  803b69:	89 f8                	mov    %edi,%eax
+  803b6b:	e8 9b fe ff ff       	call   803a0b <page_forget>
+		return sys_page_unmap(envid, va);
+  803b70:	83 ec 08             	sub    $0x8,%esp
+  803b73:	57                   	push   %edi
+  803b74:	53                   	push   %ebx
+  803b75:	e8 fe d5 ff ff       	call   801178 <sys_page_unmap>
+  803b7a:	89 c6                	mov    %eax,%esi
+  803b7c:	83 c4 10             	add    $0x10,%esp
+}
+  803b7f:	89 f0                	mov    %esi,%eax
+  803b81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b84:	5b                   	pop    %ebx
+  803b85:	5e                   	pop    %esi
+  803b86:	5f                   	pop    %edi
+  803b87:	5d                   	pop    %ebp
+  803b88:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803b89:	50                   	push   %eax
+  803b8a:	68 40 5c 80 00       	push   $0x805c40
+  803b8f:	68 e4 03 00 00       	push   $0x3e4
+  803b94:	68 f5 58 80 00       	push   $0x8058f5
+  803b99:	e8 a0 c9 ff ff       	call   80053e <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803b9e:	50                   	push   %eax
+  803b9f:	68 6c 5c 80 00       	push   $0x805c6c
+  803ba4:	68 ea 03 00 00       	push   $0x3ea
+  803ba9:	68 f5 58 80 00       	push   $0x8058f5
+  803bae:	e8 8b c9 ff ff       	call   80053e <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803bb3:	50                   	push   %eax
+  803bb4:	68 98 5c 80 00       	push   $0x805c98
+  803bb9:	68 ef 03 00 00       	push   $0x3ef
+  803bbe:	68 f5 58 80 00       	push   $0x8058f5
+  803bc3:	e8 76 c9 ff ff       	call   80053e <_panic>
+
+00803bc8 <page_unmap_range>:
+{
+  803bc8:	55                   	push   %ebp
+  803bc9:	89 e5                	mov    %esp,%ebp
+  803bcb:	57                   	push   %edi
+  803bcc:	56                   	push   %esi
+  803bcd:	53                   	push   %ebx
+  803bce:	83 ec 0c             	sub    $0xc,%esp
+  803bd1:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803bd4:	e8 8a ed ff ff       	call   802963 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803bd9:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803bde:	8b 40 48             	mov    0x48(%eax),%eax
+  803be1:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803be5:	7e 38                	jle    803c1f <page_unmap_range+0x57>
+  803be7:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803bea:	74 33                	je     803c1f <page_unmap_range+0x57>
+  803bec:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803bf3:	74 2a                	je     803c1f <page_unmap_range+0x57>
+  803bf5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  803bf8:	be 00 00 00 00       	mov    $0x0,%esi
+  803bfd:	39 fe                	cmp    %edi,%esi
+  803bff:	74 56                	je     803c57 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  803c01:	83 ec 08             	sub    $0x8,%esp
+  803c04:	53                   	push   %ebx
+  803c05:	ff 75 08             	push   0x8(%ebp)
+  803c08:	e8 89 fe ff ff       	call   803a96 <page_unmap>
+  803c0d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803c13:	83 c4 10             	add    $0x10,%esp
+  803c16:	85 c0                	test   %eax,%eax
+  803c18:	78 35                	js     803c4f <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  803c1a:	83 c6 01             	add    $0x1,%esi
+  803c1d:	eb de                	jmp    803bfd <page_unmap_range+0x35>
+  803c1f:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803c22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c27:	eb 10                	jmp    803c39 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803c29:	89 f0                	mov    %esi,%eax
+  803c2b:	e8 db fd ff ff       	call   803a0b <page_forget>
+		for (i = 0; i < npages; i++)
+  803c30:	83 c3 01             	add    $0x1,%ebx
+  803c33:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803c39:	39 fb                	cmp    %edi,%ebx
+  803c3b:	75 ec                	jne    803c29 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  803c3d:	83 ec 04             	sub    $0x4,%esp
+  803c40:	57                   	push   %edi
+  803c41:	ff 75 0c             	push   0xc(%ebp)
+  803c44:	ff 75 08             	push   0x8(%ebp)
+  803c47:	e8 40 d6 ff ff       	call   80128c <sys_page_unmap_range>
+  803c4c:	83 c4 10             	add    $0x10,%esp
+}
+  803c4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c52:	5b                   	pop    %ebx
+  803c53:	5e                   	pop    %esi
+  803c54:	5f                   	pop    %edi
+  803c55:	5d                   	pop    %ebp
+  803c56:	c3                   	ret
+	return 0;
+  803c57:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c5c:	eb f1                	jmp    803c4f <page_unmap_range+0x87>
+
+00803c5e <page_alloc_range>:
+{
+  803c5e:	55                   	push   %ebp
+  803c5f:	89 e5                	mov    %esp,%ebp
+  803c61:	57                   	push   %edi
+  803c62:	56                   	push   %esi
+  803c63:	53                   	push   %ebx
+  803c64:	83 ec 1c             	sub    $0x1c,%esp
+  803c67:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803c6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  803c6d:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803c74:	74 14                	je     803c8a <page_alloc_range+0x2c>
+	if (check_mte)
+  803c76:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803c7a:	74 66                	je     803ce2 <page_alloc_range+0x84>
+  803c7c:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  803c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c83:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803c86:	89 c7                	mov    %eax,%edi
+  803c88:	eb 10                	jmp    803c9a <page_alloc_range+0x3c>
+		init_map_dir();
+  803c8a:	e8 e6 f8 ff ff       	call   803575 <init_map_dir>
+  803c8f:	eb e5                	jmp    803c76 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803c91:	83 c7 01             	add    $0x1,%edi
+  803c94:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803c9a:	39 df                	cmp    %ebx,%edi
+  803c9c:	74 38                	je     803cd6 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  803c9e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803ca1:	83 ec 08             	sub    $0x8,%esp
+  803ca4:	6a 00                	push   $0x0
+  803ca6:	56                   	push   %esi
+  803ca7:	e8 1f f9 ff ff       	call   8035cb <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  803cac:	83 c4 10             	add    $0x10,%esp
+  803caf:	85 c0                	test   %eax,%eax
+  803cb1:	74 de                	je     803c91 <page_alloc_range+0x33>
+  803cb3:	8b 10                	mov    (%eax),%edx
+  803cb5:	f6 c2 01             	test   $0x1,%dl
+  803cb8:	74 d7                	je     803c91 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  803cba:	83 ec 08             	sub    $0x8,%esp
+  803cbd:	ff 75 e4             	push   -0x1c(%ebp)
+  803cc0:	52                   	push   %edx
+  803cc1:	50                   	push   %eax
+  803cc2:	68 04 5c 80 00       	push   $0x805c04
+  803cc7:	68 0b 04 00 00       	push   $0x40b
+  803ccc:	68 f5 58 80 00       	push   $0x8058f5
+  803cd1:	e8 68 c8 ff ff       	call   80053e <_panic>
+  803cd6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803cd9:	eb 07                	jmp    803ce2 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  803cdb:	c1 e0 0c             	shl    $0xc,%eax
+  803cde:	01 c7                	add    %eax,%edi
+			npages -= r;
+  803ce0:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  803ce2:	85 db                	test   %ebx,%ebx
+  803ce4:	74 30                	je     803d16 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  803ce6:	ff 75 14             	push   0x14(%ebp)
+  803ce9:	53                   	push   %ebx
+  803cea:	57                   	push   %edi
+  803ceb:	ff 75 08             	push   0x8(%ebp)
+  803cee:	e8 2b d5 ff ff       	call   80121e <sys_page_alloc_range>
+  803cf3:	89 c6                	mov    %eax,%esi
+  803cf5:	83 c4 10             	add    $0x10,%esp
+  803cf8:	85 c0                	test   %eax,%eax
+  803cfa:	7f df                	jg     803cdb <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  803cfc:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  803cff:	75 1a                	jne    803d1b <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  803d01:	83 ec 08             	sub    $0x8,%esp
+  803d04:	57                   	push   %edi
+  803d05:	ff 75 08             	push   0x8(%ebp)
+  803d08:	e8 68 f9 ff ff       	call   803675 <page_out>
+  803d0d:	83 c4 10             	add    $0x10,%esp
+  803d10:	85 c0                	test   %eax,%eax
+  803d12:	79 ce                	jns    803ce2 <page_alloc_range+0x84>
+  803d14:	eb 05                	jmp    803d1b <page_alloc_range+0xbd>
+	return 0;
+  803d16:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803d1b:	89 f0                	mov    %esi,%eax
+  803d1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d20:	5b                   	pop    %ebx
+  803d21:	5e                   	pop    %esi
+  803d22:	5f                   	pop    %edi
+  803d23:	5d                   	pop    %ebp
+  803d24:	c3                   	ret
+
+00803d25 <page_in>:
+{
+  803d25:	55                   	push   %ebp
+  803d26:	89 e5                	mov    %esp,%ebp
+  803d28:	57                   	push   %edi
+  803d29:	56                   	push   %esi
+  803d2a:	53                   	push   %ebx
+  803d2b:	83 ec 3c             	sub    $0x3c,%esp
+  803d2e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  803d31:	e8 2d ec ff ff       	call   802963 <find_paging_env>
+	if (pagingenv == 0)
+  803d36:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803d3d:	0f 84 09 02 00 00    	je     803f4c <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  803d43:	83 ec 08             	sub    $0x8,%esp
+  803d46:	6a 00                	push   $0x0
+  803d48:	56                   	push   %esi
+  803d49:	e8 7d f8 ff ff       	call   8035cb <umapdir_walk>
+  803d4e:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803d50:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803d56:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  803d59:	83 c4 10             	add    $0x10,%esp
+  803d5c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803d60:	74 0d                	je     803d6f <page_in+0x4a>
+  803d62:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803d67:	8b 40 48             	mov    0x48(%eax),%eax
+  803d6a:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803d6d:	75 06                	jne    803d75 <page_in+0x50>
+  803d6f:	8b 03                	mov    (%ebx),%eax
+  803d71:	a8 02                	test   $0x2,%al
+  803d73:	75 63                	jne    803dd8 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  803d75:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803d77:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803d79:	89 f0                	mov    %esi,%eax
+  803d7b:	25 06 0e 00 00       	and    $0xe06,%eax
+  803d80:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803d83:	50                   	push   %eax
+  803d84:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803d87:	57                   	push   %edi
+  803d88:	ff 75 08             	push   0x8(%ebp)
+  803d8b:	e8 65 fb ff ff       	call   8038f5 <page_alloc>
+  803d90:	83 c4 10             	add    $0x10,%esp
+  803d93:	85 c0                	test   %eax,%eax
+  803d95:	78 39                	js     803dd0 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  803d97:	89 f0                	mov    %esi,%eax
+  803d99:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803d9c:	83 ec 0c             	sub    $0xc,%esp
+  803d9f:	6a 07                	push   $0x7
+  803da1:	6a 01                	push   $0x1
+  803da3:	57                   	push   %edi
+  803da4:	c1 e0 04             	shl    $0x4,%eax
+  803da7:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803da8:	c1 ee 1c             	shr    $0x1c,%esi
+  803dab:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803dae:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803db5:	e8 f1 0f 00 00       	call   804dab <ipc_call>
+  803dba:	83 c4 20             	add    $0x20,%esp
+  803dbd:	85 c0                	test   %eax,%eax
+  803dbf:	0f 88 72 01 00 00    	js     803f37 <page_in+0x212>
+	*mte = 0;
+  803dc5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  803dcb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dd3:	5b                   	pop    %ebx
+  803dd4:	5e                   	pop    %esi
+  803dd5:	5f                   	pop    %edi
+  803dd6:	5d                   	pop    %ebp
+  803dd7:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803dd8:	25 06 0e 00 00       	and    $0xe06,%eax
+  803ddd:	83 c8 01             	or     $0x1,%eax
+  803de0:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  803de3:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803de6:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  803de9:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  803def:	be 01 00 00 00       	mov    $0x1,%esi
+  803df4:	eb 46                	jmp    803e3c <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  803df6:	83 ec 08             	sub    $0x8,%esp
+  803df9:	6a 00                	push   $0x0
+  803dfb:	51                   	push   %ecx
+  803dfc:	e8 ca f7 ff ff       	call   8035cb <umapdir_walk>
+  803e01:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  803e05:	83 c4 10             	add    $0x10,%esp
+  803e08:	85 c0                	test   %eax,%eax
+  803e0a:	74 66                	je     803e72 <page_in+0x14d>
+  803e0c:	8b 00                	mov    (%eax),%eax
+  803e0e:	a8 01                	test   $0x1,%al
+  803e10:	74 60                	je     803e72 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  803e12:	89 c2                	mov    %eax,%edx
+  803e14:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  803e1a:	83 ca 01             	or     $0x1,%edx
+  803e1d:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  803e20:	75 50                	jne    803e72 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  803e22:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803e28:	c1 e8 1c             	shr    $0x1c,%eax
+  803e2b:	8b 13                	mov    (%ebx),%edx
+  803e2d:	c1 ea 1c             	shr    $0x1c,%edx
+  803e30:	39 d0                	cmp    %edx,%eax
+  803e32:	75 3e                	jne    803e72 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803e34:	83 c6 01             	add    $0x1,%esi
+  803e37:	83 fe 08             	cmp    $0x8,%esi
+  803e3a:	74 3f                	je     803e7b <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  803e3c:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803e3e:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  803e44:	77 2c                	ja     803e72 <page_in+0x14d>
+  803e46:	89 f8                	mov    %edi,%eax
+  803e48:	c1 e8 16             	shr    $0x16,%eax
+  803e4b:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803e52:	f6 c2 01             	test   $0x1,%dl
+  803e55:	74 9f                	je     803df6 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803e57:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803e5e:	a8 80                	test   $0x80,%al
+  803e60:	75 10                	jne    803e72 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803e62:	89 f8                	mov    %edi,%eax
+  803e64:	c1 e8 0c             	shr    $0xc,%eax
+  803e67:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803e6e:	a8 01                	test   $0x1,%al
+  803e70:	74 84                	je     803df6 <page_in+0xd1>
+	if (n == 1)
+  803e72:	83 fe 01             	cmp    $0x1,%esi
+  803e75:	0f 84 fa fe ff ff    	je     803d75 <page_in+0x50>
+	req.nslots = n;
+  803e7b:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  803e81:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e86:	eb 13                	jmp    803e9b <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  803e88:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  803e8c:	8b 12                	mov    (%edx),%edx
+  803e8e:	c1 ea 0c             	shr    $0xc,%edx
+  803e91:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  803e98:	83 c0 01             	add    $0x1,%eax
+  803e9b:	39 c6                	cmp    %eax,%esi
+  803e9d:	75 e9                	jne    803e88 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  803e9f:	83 ec 0c             	sub    $0xc,%esp
+  803ea2:	6a 00                	push   $0x0
+  803ea4:	ff 75 c0             	push   -0x40(%ebp)
+  803ea7:	56                   	push   %esi
+  803ea8:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803eab:	57                   	push   %edi
+  803eac:	6a 00                	push   $0x0
+  803eae:	e8 ab fd ff ff       	call   803c5e <page_alloc_range>
+  803eb3:	83 c4 20             	add    $0x20,%esp
+  803eb6:	85 c0                	test   %eax,%eax
+  803eb8:	78 6e                	js     803f28 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  803eba:	83 ec 04             	sub    $0x4,%esp
+  803ebd:	6a 24                	push   $0x24
+  803ebf:	68 00 80 80 00       	push   $0x808000
+  803ec4:	57                   	push   %edi
+  803ec5:	e8 bc ce ff ff       	call   800d86 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803eca:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803ed1:	56                   	push   %esi
+  803ed2:	57                   	push   %edi
+  803ed3:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803ed5:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  803edc:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803edf:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  803ee6:	e8 c0 0e 00 00       	call   804dab <ipc_call>
+  803eeb:	83 c4 20             	add    $0x20,%esp
+  803eee:	85 c0                	test   %eax,%eax
+  803ef0:	78 08                	js     803efa <page_in+0x1d5>
+  803ef2:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  803ef5:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  803ef8:	eb 20                	jmp    803f1a <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  803efa:	50                   	push   %eax
+  803efb:	68 c4 5c 80 00       	push   $0x805cc4
+  803f00:	68 59 02 00 00       	push   $0x259
+  803f05:	68 f5 58 80 00       	push   $0x8058f5
+  803f0a:	e8 2f c6 ff ff       	call   80053e <_panic>
+		*mtes[i] = 0;
+  803f0f:	8b 10                	mov    (%eax),%edx
+  803f11:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  803f17:	83 c0 04             	add    $0x4,%eax
+  803f1a:	39 c8                	cmp    %ecx,%eax
+  803f1c:	75 f1                	jne    803f0f <page_in+0x1ea>
+	return n;
+  803f1e:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  803f20:	85 f6                	test   %esi,%esi
+  803f22:	0f 84 4d fe ff ff    	je     803d75 <page_in+0x50>
+		return r < 0 ? r : 0;
+  803f28:	85 c0                	test   %eax,%eax
+  803f2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f2f:	0f 4f c2             	cmovg  %edx,%eax
+  803f32:	e9 99 fe ff ff       	jmp    803dd0 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  803f37:	50                   	push   %eax
+  803f38:	68 fc 5c 80 00       	push   $0x805cfc
+  803f3d:	68 9a 02 00 00       	push   $0x29a
+  803f42:	68 f5 58 80 00       	push   $0x8058f5
+  803f47:	e8 f2 c5 ff ff       	call   80053e <_panic>
+		return -E_PAGING;
+  803f4c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803f51:	e9 7a fe ff ff       	jmp    803dd0 <page_in+0xab>
+
+00803f56 <page_map>:
+{
+  803f56:	55                   	push   %ebp
+  803f57:	89 e5                	mov    %esp,%ebp
+  803f59:	57                   	push   %edi
+  803f5a:	56                   	push   %esi
+  803f5b:	53                   	push   %ebx
+  803f5c:	83 ec 1c             	sub    $0x1c,%esp
+  803f5f:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803f62:	83 ec 0c             	sub    $0xc,%esp
+  803f65:	ff 75 18             	push   0x18(%ebp)
+  803f68:	ff 75 14             	push   0x14(%ebp)
+  803f6b:	ff 75 10             	push   0x10(%ebp)
+  803f6e:	ff 75 0c             	push   0xc(%ebp)
+  803f71:	56                   	push   %esi
+  803f72:	e8 bf d1 ff ff       	call   801136 <sys_page_map>
+  803f77:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803f7a:	83 c4 20             	add    $0x20,%esp
+  803f7d:	85 c0                	test   %eax,%eax
+  803f7f:	0f 89 a9 01 00 00    	jns    80412e <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  803f85:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  803f89:	74 5f                	je     803fea <page_map+0x94>
+		if (r != -E_INVAL)
+  803f8b:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  803f8f:	0f 85 a0 01 00 00    	jne    804135 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803f95:	85 f6                	test   %esi,%esi
+  803f97:	74 70                	je     804009 <page_map+0xb3>
+  803f99:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803f9e:	8b 40 48             	mov    0x48(%eax),%eax
+  803fa1:	39 f0                	cmp    %esi,%eax
+  803fa3:	74 64                	je     804009 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803fa5:	83 ec 0c             	sub    $0xc,%esp
+  803fa8:	6a 05                	push   $0x5
+  803faa:	68 00 00 40 00       	push   $0x400000
+  803faf:	6a 00                	push   $0x0
+  803fb1:	68 00 b0 ad de       	push   $0xdeadb000
+  803fb6:	56                   	push   %esi
+  803fb7:	e8 7a d1 ff ff       	call   801136 <sys_page_map>
+  803fbc:	89 c3                	mov    %eax,%ebx
+  803fbe:	83 c4 20             	add    $0x20,%esp
+  803fc1:	85 c0                	test   %eax,%eax
+  803fc3:	79 6a                	jns    80402f <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  803fc5:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803fc8:	75 50                	jne    80401a <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  803fca:	83 ec 08             	sub    $0x8,%esp
+  803fcd:	68 00 00 40 00       	push   $0x400000
+  803fd2:	6a fc                	push   $0xfffffffc
+  803fd4:	e8 9c f6 ff ff       	call   803675 <page_out>
+  803fd9:	83 c4 10             	add    $0x10,%esp
+  803fdc:	85 c0                	test   %eax,%eax
+  803fde:	79 c5                	jns    803fa5 <page_map+0x4f>
+}
+  803fe0:	89 d8                	mov    %ebx,%eax
+  803fe2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fe5:	5b                   	pop    %ebx
+  803fe6:	5e                   	pop    %esi
+  803fe7:	5f                   	pop    %edi
+  803fe8:	5d                   	pop    %ebp
+  803fe9:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  803fea:	83 ec 08             	sub    $0x8,%esp
+  803fed:	68 00 00 40 00       	push   $0x400000
+  803ff2:	6a 00                	push   $0x0
+  803ff4:	e8 7c f6 ff ff       	call   803675 <page_out>
+  803ff9:	83 c4 10             	add    $0x10,%esp
+  803ffc:	85 c0                	test   %eax,%eax
+  803ffe:	0f 89 5e ff ff ff    	jns    803f62 <page_map+0xc>
+				return r;
+  804004:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804007:	eb d7                	jmp    803fe0 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804009:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80400c:	e8 79 f9 ff ff       	call   80398a <page_adopt>
+  804011:	85 c0                	test   %eax,%eax
+  804013:	79 90                	jns    803fa5 <page_map+0x4f>
+			return r;
+  804015:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804018:	eb c6                	jmp    803fe0 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  80401a:	53                   	push   %ebx
+  80401b:	68 30 5d 80 00       	push   $0x805d30
+  804020:	68 77 03 00 00       	push   $0x377
+  804025:	68 f5 58 80 00       	push   $0x8058f5
+  80402a:	e8 0f c5 ff ff       	call   80053e <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  80402f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804032:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  804035:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  80403c:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  804042:	0f 84 f5 00 00 00    	je     80413d <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  804048:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80404e:	83 ec 0c             	sub    $0xc,%esp
+  804051:	6a 05                	push   $0x5
+  804053:	68 00 00 40 00       	push   $0x400000
+  804058:	6a 00                	push   $0x0
+  80405a:	57                   	push   %edi
+  80405b:	56                   	push   %esi
+  80405c:	e8 d5 d0 ff ff       	call   801136 <sys_page_map>
+  804061:	89 c3                	mov    %eax,%ebx
+  804063:	83 c4 20             	add    $0x20,%esp
+  804066:	85 c0                	test   %eax,%eax
+  804068:	79 35                	jns    80409f <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  80406a:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80406d:	75 1b                	jne    80408a <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  80406f:	83 ec 08             	sub    $0x8,%esp
+  804072:	68 00 00 40 00       	push   $0x400000
+  804077:	6a 00                	push   $0x0
+  804079:	e8 f7 f5 ff ff       	call   803675 <page_out>
+  80407e:	83 c4 10             	add    $0x10,%esp
+  804081:	85 c0                	test   %eax,%eax
+  804083:	79 c9                	jns    80404e <page_map+0xf8>
+  804085:	e9 56 ff ff ff       	jmp    803fe0 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  80408a:	53                   	push   %ebx
+  80408b:	68 58 5d 80 00       	push   $0x805d58
+  804090:	68 83 03 00 00       	push   $0x383
+  804095:	68 f5 58 80 00       	push   $0x8058f5
+  80409a:	e8 9f c4 ff ff       	call   80053e <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  80409f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8040a2:	c1 e8 0c             	shr    $0xc,%eax
+  8040a5:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8040aa:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  8040b1:	01 
+  8040b2:	0f 84 8d 00 00 00    	je     804145 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  8040b8:	83 ec 08             	sub    $0x8,%esp
+  8040bb:	68 00 00 40 00       	push   $0x400000
+  8040c0:	6a 00                	push   $0x0
+  8040c2:	e8 b1 d0 ff ff       	call   801178 <sys_page_unmap>
+  8040c7:	83 c4 10             	add    $0x10,%esp
+  8040ca:	85 c0                	test   %eax,%eax
+  8040cc:	78 36                	js     804104 <page_map+0x1ae>
+  8040ce:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  8040d1:	83 ec 08             	sub    $0x8,%esp
+  8040d4:	57                   	push   %edi
+  8040d5:	56                   	push   %esi
+  8040d6:	e8 4a fc ff ff       	call   803d25 <page_in>
+  8040db:	89 c3                	mov    %eax,%ebx
+  8040dd:	83 c4 10             	add    $0x10,%esp
+  8040e0:	85 c0                	test   %eax,%eax
+  8040e2:	0f 89 7a fe ff ff    	jns    803f62 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  8040e8:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8040eb:	75 2c                	jne    804119 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  8040ed:	83 ec 08             	sub    $0x8,%esp
+  8040f0:	57                   	push   %edi
+  8040f1:	6a 00                	push   $0x0
+  8040f3:	e8 7d f5 ff ff       	call   803675 <page_out>
+  8040f8:	83 c4 10             	add    $0x10,%esp
+  8040fb:	85 c0                	test   %eax,%eax
+  8040fd:	79 d2                	jns    8040d1 <page_map+0x17b>
+  8040ff:	e9 dc fe ff ff       	jmp    803fe0 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  804104:	50                   	push   %eax
+  804105:	68 84 5d 80 00       	push   $0x805d84
+  80410a:	68 8b 03 00 00       	push   $0x38b
+  80410f:	68 f5 58 80 00       	push   $0x8058f5
+  804114:	e8 25 c4 ff ff       	call   80053e <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  804119:	53                   	push   %ebx
+  80411a:	68 ac 5d 80 00       	push   $0x805dac
+  80411f:	68 91 03 00 00       	push   $0x391
+  804124:	68 f5 58 80 00       	push   $0x8058f5
+  804129:	e8 10 c4 ff ff       	call   80053e <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  80412e:	89 c3                	mov    %eax,%ebx
+  804130:	e9 ab fe ff ff       	jmp    803fe0 <page_map+0x8a>
+  804135:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804138:	e9 a3 fe ff ff       	jmp    803fe0 <page_map+0x8a>
+			return r; // Pass through the error
+  80413d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804140:	e9 9b fe ff ff       	jmp    803fe0 <page_map+0x8a>
+			return r; // Pass through the error
+  804145:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804148:	e9 93 fe ff ff       	jmp    803fe0 <page_map+0x8a>
+
+0080414d <page_map_range>:
+{
+  80414d:	55                   	push   %ebp
+  80414e:	89 e5                	mov    %esp,%ebp
+  804150:	57                   	push   %edi
+  804151:	56                   	push   %esi
+  804152:	53                   	push   %ebx
+  804153:	83 ec 0c             	sub    $0xc,%esp
+  804156:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804159:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  80415c:	83 ec 08             	sub    $0x8,%esp
+  80415f:	ff 75 1c             	push   0x1c(%ebp)
+  804162:	ff 75 18             	push   0x18(%ebp)
+  804165:	56                   	push   %esi
+  804166:	ff 75 10             	push   0x10(%ebp)
+  804169:	57                   	push   %edi
+  80416a:	ff 75 08             	push   0x8(%ebp)
+  80416d:	e8 cf d0 ff ff       	call   801241 <sys_page_map_range>
+  804172:	89 c3                	mov    %eax,%ebx
+  804174:	83 c4 20             	add    $0x20,%esp
+  804177:	85 c0                	test   %eax,%eax
+  804179:	79 1b                	jns    804196 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  80417b:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80417e:	75 20                	jne    8041a0 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  804180:	83 ec 08             	sub    $0x8,%esp
+  804183:	68 00 00 40 00       	push   $0x400000
+  804188:	6a 00                	push   $0x0
+  80418a:	e8 e6 f4 ff ff       	call   803675 <page_out>
+  80418f:	83 c4 10             	add    $0x10,%esp
+  804192:	85 c0                	test   %eax,%eax
+  804194:	79 c6                	jns    80415c <page_map_range+0xf>
+}
+  804196:	89 d8                	mov    %ebx,%eax
+  804198:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80419b:	5b                   	pop    %ebx
+  80419c:	5e                   	pop    %esi
+  80419d:	5f                   	pop    %edi
+  80419e:	5d                   	pop    %ebp
+  80419f:	c3                   	ret
+		if (r != -E_INVAL)
+  8041a0:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  8041a3:	75 f1                	jne    804196 <page_map_range+0x49>
+  8041a5:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  8041a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8041ac:	eb 03                	jmp    8041b1 <page_map_range+0x64>
+  8041ae:	83 c6 01             	add    $0x1,%esi
+  8041b1:	3b 75 18             	cmp    0x18(%ebp),%esi
+  8041b4:	74 2a                	je     8041e0 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  8041b6:	83 ec 0c             	sub    $0xc,%esp
+  8041b9:	ff 75 1c             	push   0x1c(%ebp)
+  8041bc:	53                   	push   %ebx
+  8041bd:	ff 75 10             	push   0x10(%ebp)
+  8041c0:	57                   	push   %edi
+  8041c1:	ff 75 08             	push   0x8(%ebp)
+  8041c4:	e8 8d fd ff ff       	call   803f56 <page_map>
+  8041c9:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8041cf:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8041d5:	83 c4 20             	add    $0x20,%esp
+  8041d8:	85 c0                	test   %eax,%eax
+  8041da:	79 d2                	jns    8041ae <page_map_range+0x61>
+  8041dc:	89 c3                	mov    %eax,%ebx
+  8041de:	eb b6                	jmp    804196 <page_map_range+0x49>
+		return 0;
+  8041e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8041e5:	eb af                	jmp    804196 <page_map_range+0x49>
+
+008041e7 <paging_pgfault_handler>:
+{
+  8041e7:	55                   	push   %ebp
+  8041e8:	89 e5                	mov    %esp,%ebp
+  8041ea:	56                   	push   %esi
+  8041eb:	53                   	push   %ebx
+  8041ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  8041ef:	e8 6f e7 ff ff       	call   802963 <find_paging_env>
+	if (pagingenv == 0)
+  8041f4:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  8041f9:	85 c0                	test   %eax,%eax
+  8041fb:	74 3c                	je     804239 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  8041fd:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  8041ff:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804203:	75 12                	jne    804217 <paging_pgfault_handler+0x30>
+  804205:	89 f0                	mov    %esi,%eax
+  804207:	e8 7e f7 ff ff       	call   80398a <page_adopt>
+  80420c:	89 c2                	mov    %eax,%edx
+		return 0;
+  80420e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804213:	85 d2                	test   %edx,%edx
+  804215:	78 22                	js     804239 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  804217:	83 ec 08             	sub    $0x8,%esp
+  80421a:	6a 00                	push   $0x0
+  80421c:	56                   	push   %esi
+  80421d:	e8 a9 f3 ff ff       	call   8035cb <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  804222:	83 c4 10             	add    $0x10,%esp
+  804225:	85 c0                	test   %eax,%eax
+  804227:	74 05                	je     80422e <paging_pgfault_handler+0x47>
+  804229:	f6 00 01             	testb  $0x1,(%eax)
+  80422c:	75 12                	jne    804240 <paging_pgfault_handler+0x59>
+	return 0;
+  80422e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804233:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804237:	74 23                	je     80425c <paging_pgfault_handler+0x75>
+}
+  804239:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80423c:	5b                   	pop    %ebx
+  80423d:	5e                   	pop    %esi
+  80423e:	5d                   	pop    %ebp
+  80423f:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  804240:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804245:	8b 40 48             	mov    0x48(%eax),%eax
+  804248:	83 ec 08             	sub    $0x8,%esp
+  80424b:	56                   	push   %esi
+  80424c:	50                   	push   %eax
+  80424d:	e8 d3 fa ff ff       	call   803d25 <page_in>
+  804252:	f7 d0                	not    %eax
+  804254:	c1 e8 1f             	shr    $0x1f,%eax
+  804257:	83 c4 10             	add    $0x10,%esp
+  80425a:	eb dd                	jmp    804239 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  80425c:	89 f0                	mov    %esi,%eax
+  80425e:	e8 97 e2 ff ff       	call   8024fa <segment_lookup>
+  804263:	89 c2                	mov    %eax,%edx
+	return 0;
+  804265:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  80426a:	85 d2                	test   %edx,%edx
+  80426c:	74 cb                	je     804239 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  80426e:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804273:	8b 40 48             	mov    0x48(%eax),%eax
+  804276:	83 ec 08             	sub    $0x8,%esp
+  804279:	56                   	push   %esi
+  80427a:	50                   	push   %eax
+  80427b:	e8 f5 f3 ff ff       	call   803675 <page_out>
+  804280:	f7 d0                	not    %eax
+  804282:	c1 e8 1f             	shr    $0x1f,%eax
+  804285:	83 c4 10             	add    $0x10,%esp
+  804288:	eb af                	jmp    804239 <paging_pgfault_handler+0x52>
+
+0080428a <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  80428a:	55                   	push   %ebp
+  80428b:	89 e5                	mov    %esp,%ebp
+  80428d:	57                   	push   %edi
+  80428e:	56                   	push   %esi
+  80428f:	53                   	push   %ebx
+  804290:	83 ec 2c             	sub    $0x2c,%esp
+  804293:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804296:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  80429b:	89 c1                	mov    %eax,%ecx
+  80429d:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  8042a0:	c1 e8 11             	shr    $0x11,%eax
+  8042a3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8042a6:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  8042ad:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  8042b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8042b5:	d3 e0                	shl    %cl,%eax
+  8042b7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8042ba:	85 c7                	test   %eax,%edi
+  8042bc:	74 12                	je     8042d0 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  8042be:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8042c3:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  8042c6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8042cb:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8042ce:	eb 17                	jmp    8042e7 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  8042d0:	ff 75 e0             	push   -0x20(%ebp)
+  8042d3:	68 e4 5d 80 00       	push   $0x805de4
+  8042d8:	6a 48                	push   $0x48
+  8042da:	68 fe 5d 80 00       	push   $0x805dfe
+  8042df:	e8 5a c2 ff ff       	call   80053e <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  8042e4:	83 c3 01             	add    $0x1,%ebx
+  8042e7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8042ea:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  8042ed:	89 c8                	mov    %ecx,%eax
+  8042ef:	c1 e8 05             	shr    $0x5,%eax
+  8042f2:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  8042f9:	89 fe                	mov    %edi,%esi
+  8042fb:	d3 e6                	shl    %cl,%esi
+  8042fd:	89 f1                	mov    %esi,%ecx
+  8042ff:	85 d6                	test   %edx,%esi
+  804301:	74 e1                	je     8042e4 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  804303:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  804306:	f7 d6                	not    %esi
+  804308:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80430b:	21 fe                	and    %edi,%esi
+  80430d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804310:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  804317:	f7 d1                	not    %ecx
+  804319:	21 d1                	and    %edx,%ecx
+  80431b:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804322:	83 ec 04             	sub    $0x4,%esp
+  804325:	53                   	push   %ebx
+  804326:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804329:	57                   	push   %edi
+  80432a:	6a 00                	push   $0x0
+  80432c:	e8 97 f8 ff ff       	call   803bc8 <page_unmap_range>
+	va_free(va, n);
+  804331:	83 c4 08             	add    $0x8,%esp
+  804334:	53                   	push   %ebx
+  804335:	57                   	push   %edi
+  804336:	e8 ed 05 00 00       	call   804928 <va_free>
+}
+  80433b:	83 c4 10             	add    $0x10,%esp
+  80433e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804341:	5b                   	pop    %ebx
+  804342:	5e                   	pop    %esi
+  804343:	5f                   	pop    %edi
+  804344:	5d                   	pop    %ebp
+  804345:	c3                   	ret
+
+00804346 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  804346:	55                   	push   %ebp
+  804347:	89 e5                	mov    %esp,%ebp
+  804349:	57                   	push   %edi
+  80434a:	56                   	push   %esi
+  80434b:	53                   	push   %ebx
+  80434c:	83 ec 1c             	sub    $0x1c,%esp
+  80434f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804352:	85 db                	test   %ebx,%ebx
+  804354:	74 34                	je     80438a <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  804356:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80435c:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  804361:	77 2f                	ja     804392 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  804363:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  804369:	75 51                	jne    8043bc <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  80436b:	89 c1                	mov    %eax,%ecx
+  80436d:	c1 e9 0c             	shr    $0xc,%ecx
+  804370:	ba 01 00 00 00       	mov    $0x1,%edx
+  804375:	d3 e2                	shl    %cl,%edx
+  804377:	c1 e8 11             	shr    $0x11,%eax
+  80437a:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  804381:	75 24                	jne    8043a7 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  804383:	89 d8                	mov    %ebx,%eax
+  804385:	e8 00 ff ff ff       	call   80428a <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  80438a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80438d:	5b                   	pop    %ebx
+  80438e:	5e                   	pop    %esi
+  80438f:	5f                   	pop    %edi
+  804390:	5d                   	pop    %ebp
+  804391:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  804392:	53                   	push   %ebx
+  804393:	68 0b 5e 80 00       	push   $0x805e0b
+  804398:	68 a2 00 00 00       	push   $0xa2
+  80439d:	68 fe 5d 80 00       	push   $0x805dfe
+  8043a2:	e8 97 c1 ff ff       	call   80053e <_panic>
+			panic("free: %p is not allocated", va);
+  8043a7:	53                   	push   %ebx
+  8043a8:	68 e4 5d 80 00       	push   $0x805de4
+  8043ad:	68 a5 00 00 00       	push   $0xa5
+  8043b2:	68 fe 5d 80 00       	push   $0x805dfe
+  8043b7:	e8 82 c1 ff ff       	call   80053e <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  8043bc:	89 de                	mov    %ebx,%esi
+  8043be:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  8043c4:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  8043ca:	89 c8                	mov    %ecx,%eax
+  8043cc:	c1 e8 11             	shr    $0x11,%eax
+  8043cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8043d2:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  8043d9:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8043dc:	c1 e9 0c             	shr    $0xc,%ecx
+  8043df:	b8 01 00 00 00       	mov    $0x1,%eax
+  8043e4:	d3 e0                	shl    %cl,%eax
+  8043e6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8043e9:	85 c7                	test   %eax,%edi
+  8043eb:	74 1b                	je     804408 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  8043ed:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8043f1:	89 d8                	mov    %ebx,%eax
+  8043f3:	29 f0                	sub    %esi,%eax
+  8043f5:	83 e8 10             	sub    $0x10,%eax
+  8043f8:	99                   	cltd
+  8043f9:	f7 ff                	idiv   %edi
+  8043fb:	89 d1                	mov    %edx,%ecx
+  8043fd:	85 d2                	test   %edx,%edx
+  8043ff:	75 07                	jne    804408 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804401:	ba 10 00 00 00       	mov    $0x10,%edx
+  804406:	eb 18                	jmp    804420 <free+0xda>
+		panic("free: %p is not allocated", va);
+  804408:	53                   	push   %ebx
+  804409:	68 e4 5d 80 00       	push   $0x805de4
+  80440e:	68 ad 00 00 00       	push   $0xad
+  804413:	68 fe 5d 80 00       	push   $0x805dfe
+  804418:	e8 21 c1 ff ff       	call   80053e <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80441d:	83 c1 01             	add    $0x1,%ecx
+  804420:	89 d0                	mov    %edx,%eax
+  804422:	d3 e0                	shl    %cl,%eax
+  804424:	39 c7                	cmp    %eax,%edi
+  804426:	7f f5                	jg     80441d <free+0xd7>
+	*(void **) va = s->free;
+  804428:	8b 46 08             	mov    0x8(%esi),%eax
+  80442b:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  80442d:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  804430:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  804434:	8d 58 01             	lea    0x1(%eax),%ebx
+  804437:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  80443b:	66 85 c0             	test   %ax,%ax
+  80443e:	74 52                	je     804492 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804440:	0f b7 db             	movzwl %bx,%ebx
+  804443:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804447:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80444c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804451:	f7 ff                	idiv   %edi
+  804453:	39 c3                	cmp    %eax,%ebx
+  804455:	0f 85 2f ff ff ff    	jne    80438a <free+0x44>
+  80445b:	8b 46 04             	mov    0x4(%esi),%eax
+  80445e:	85 c0                	test   %eax,%eax
+  804460:	74 53                	je     8044b5 <free+0x16f>
+		s->prev->next = s->next;
+  804462:	8b 16                	mov    (%esi),%edx
+  804464:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804466:	8b 06                	mov    (%esi),%eax
+  804468:	85 c0                	test   %eax,%eax
+  80446a:	74 06                	je     804472 <free+0x12c>
+		s->next->prev = s->prev;
+  80446c:	8b 56 04             	mov    0x4(%esi),%edx
+  80446f:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804472:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804475:	f7 d0                	not    %eax
+  804477:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80447a:	21 d0                	and    %edx,%eax
+  80447c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80447f:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  804486:	89 f0                	mov    %esi,%eax
+  804488:	e8 fd fd ff ff       	call   80428a <heap_free_pages>
+  80448d:	e9 f8 fe ff ff       	jmp    80438a <free+0x44>
+	s->prev = NULL;
+  804492:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  804499:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  8044a0:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  8044a2:	85 c0                	test   %eax,%eax
+  8044a4:	74 03                	je     8044a9 <free+0x163>
+		slabs[c]->prev = s;
+  8044a6:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  8044a9:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  8044b0:	e9 d5 fe ff ff       	jmp    80438a <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8044b5:	8b 06                	mov    (%esi),%eax
+  8044b7:	85 c0                	test   %eax,%eax
+  8044b9:	0f 84 cb fe ff ff    	je     80438a <free+0x44>
+		slabs[c] = s->next;
+  8044bf:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  8044c6:	8b 06                	mov    (%esi),%eax
+  8044c8:	eb a2                	jmp    80446c <free+0x126>
+
+008044ca <heap_alloc_pages>:
+{
+  8044ca:	55                   	push   %ebp
+  8044cb:	89 e5                	mov    %esp,%ebp
+  8044cd:	57                   	push   %edi
+  8044ce:	56                   	push   %esi
+  8044cf:	53                   	push   %ebx
+  8044d0:	83 ec 18             	sub    $0x18,%esp
+  8044d3:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  8044d5:	50                   	push   %eax
+  8044d6:	e8 15 03 00 00       	call   8047f0 <va_alloc>
+  8044db:	89 c3                	mov    %eax,%ebx
+  8044dd:	83 c4 10             	add    $0x10,%esp
+  8044e0:	85 c0                	test   %eax,%eax
+  8044e2:	74 47                	je     80452b <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8044e4:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  8044ea:	89 c1                	mov    %eax,%ecx
+  8044ec:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  8044ef:	c1 e8 11             	shr    $0x11,%eax
+  8044f2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8044f7:	89 d7                	mov    %edx,%edi
+  8044f9:	d3 e7                	shl    %cl,%edi
+  8044fb:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  804502:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  804506:	89 c8                	mov    %ecx,%eax
+  804508:	c1 e8 05             	shr    $0x5,%eax
+  80450b:	d3 e2                	shl    %cl,%edx
+  80450d:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  804514:	83 ec 0c             	sub    $0xc,%esp
+  804517:	6a 00                	push   $0x0
+  804519:	6a 07                	push   $0x7
+  80451b:	56                   	push   %esi
+  80451c:	53                   	push   %ebx
+  80451d:	6a 00                	push   $0x0
+  80451f:	e8 3a f7 ff ff       	call   803c5e <page_alloc_range>
+  804524:	83 c4 20             	add    $0x20,%esp
+  804527:	85 c0                	test   %eax,%eax
+  804529:	78 0a                	js     804535 <heap_alloc_pages+0x6b>
+}
+  80452b:	89 d8                	mov    %ebx,%eax
+  80452d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804530:	5b                   	pop    %ebx
+  804531:	5e                   	pop    %esi
+  804532:	5f                   	pop    %edi
+  804533:	5d                   	pop    %ebp
+  804534:	c3                   	ret
+		free(va);
+  804535:	83 ec 0c             	sub    $0xc,%esp
+  804538:	53                   	push   %ebx
+  804539:	e8 08 fe ff ff       	call   804346 <free>
+		return NULL;
+  80453e:	83 c4 10             	add    $0x10,%esp
+  804541:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804546:	eb e3                	jmp    80452b <heap_alloc_pages+0x61>
+
+00804548 <malloc>:
+{
+  804548:	55                   	push   %ebp
+  804549:	89 e5                	mov    %esp,%ebp
+  80454b:	57                   	push   %edi
+  80454c:	56                   	push   %esi
+  80454d:	53                   	push   %ebx
+  80454e:	83 ec 1c             	sub    $0x1c,%esp
+  804551:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804554:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804557:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  80455d:	0f 87 21 01 00 00    	ja     804684 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804563:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804568:	ba 10 00 00 00       	mov    $0x10,%edx
+  80456d:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  80456f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804574:	76 15                	jbe    80458b <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804576:	05 ff 0f 00 00       	add    $0xfff,%eax
+  80457b:	c1 e8 0c             	shr    $0xc,%eax
+  80457e:	e8 47 ff ff ff       	call   8044ca <heap_alloc_pages>
+  804583:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804586:	eb 37                	jmp    8045bf <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804588:	83 c1 01             	add    $0x1,%ecx
+  80458b:	89 d6                	mov    %edx,%esi
+  80458d:	d3 e6                	shl    %cl,%esi
+  80458f:	39 c6                	cmp    %eax,%esi
+  804591:	72 f5                	jb     804588 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804593:	89 cb                	mov    %ecx,%ebx
+  804595:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  80459c:	85 ff                	test   %edi,%edi
+  80459e:	74 2a                	je     8045ca <malloc+0x82>
+	v = s->free;
+  8045a0:	8b 47 08             	mov    0x8(%edi),%eax
+  8045a3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  8045a6:	8b 00                	mov    (%eax),%eax
+  8045a8:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  8045ab:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  8045af:	83 e8 01             	sub    $0x1,%eax
+  8045b2:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  8045b6:	66 85 c0             	test   %ax,%ax
+  8045b9:	0f 84 9a 00 00 00    	je     804659 <malloc+0x111>
+}
+  8045bf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8045c2:	83 c4 1c             	add    $0x1c,%esp
+  8045c5:	5b                   	pop    %ebx
+  8045c6:	5e                   	pop    %esi
+  8045c7:	5f                   	pop    %edi
+  8045c8:	5d                   	pop    %ebp
+  8045c9:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  8045ca:	b8 01 00 00 00       	mov    $0x1,%eax
+  8045cf:	e8 f6 fe ff ff       	call   8044ca <heap_alloc_pages>
+  8045d4:	89 c1                	mov    %eax,%ecx
+  8045d6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8045d9:	85 c0                	test   %eax,%eax
+  8045db:	74 e2                	je     8045bf <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8045dd:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  8045e3:	89 c8                	mov    %ecx,%eax
+  8045e5:	c1 e8 11             	shr    $0x11,%eax
+  8045e8:	c1 e9 0c             	shr    $0xc,%ecx
+  8045eb:	ba 01 00 00 00       	mov    $0x1,%edx
+  8045f0:	d3 e2                	shl    %cl,%edx
+  8045f2:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  8045f9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8045fc:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  804600:	0f b7 f6             	movzwl %si,%esi
+  804603:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804608:	ba 00 00 00 00       	mov    $0x0,%edx
+  80460d:	f7 fe                	idiv   %esi
+  80460f:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804613:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  804616:	85 c0                	test   %eax,%eax
+  804618:	74 14                	je     80462e <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  80461a:	83 e8 01             	sub    $0x1,%eax
+  80461d:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804621:	0f af d0             	imul   %eax,%edx
+  804624:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804628:	89 3a                	mov    %edi,(%edx)
+  80462a:	89 d7                	mov    %edx,%edi
+  80462c:	eb e5                	jmp    804613 <malloc+0xcb>
+	s->prev = NULL;
+  80462e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804631:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804638:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  80463f:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804641:	85 c0                	test   %eax,%eax
+  804643:	74 03                	je     804648 <malloc+0x100>
+		slabs[c]->prev = s;
+  804645:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804648:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80464b:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  804652:	89 c7                	mov    %eax,%edi
+  804654:	e9 47 ff ff ff       	jmp    8045a0 <malloc+0x58>
+	if (s->prev)
+  804659:	8b 47 04             	mov    0x4(%edi),%eax
+  80465c:	85 c0                	test   %eax,%eax
+  80465e:	74 19                	je     804679 <malloc+0x131>
+		s->prev->next = s->next;
+  804660:	8b 17                	mov    (%edi),%edx
+  804662:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804664:	8b 07                	mov    (%edi),%eax
+  804666:	85 c0                	test   %eax,%eax
+  804668:	0f 84 51 ff ff ff    	je     8045bf <malloc+0x77>
+		s->next->prev = s->prev;
+  80466e:	8b 57 04             	mov    0x4(%edi),%edx
+  804671:	89 50 04             	mov    %edx,0x4(%eax)
+  804674:	e9 46 ff ff ff       	jmp    8045bf <malloc+0x77>
+		slabs[c] = s->next;
+  804679:	8b 07                	mov    (%edi),%eax
+  80467b:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  804682:	eb e0                	jmp    804664 <malloc+0x11c>
+		return NULL;
+  804684:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80468b:	e9 2f ff ff ff       	jmp    8045bf <malloc+0x77>
+
+00804690 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804690:	55                   	push   %ebp
+  804691:	89 e5                	mov    %esp,%ebp
+  804693:	57                   	push   %edi
+  804694:	56                   	push   %esi
+  804695:	53                   	push   %ebx
+  804696:	83 ec 0c             	sub    $0xc,%esp
+  804699:	89 c6                	mov    %eax,%esi
+  80469b:	89 d7                	mov    %edx,%edi
+  80469d:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8046a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8046a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046aa:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  8046af:	83 ef 01             	sub    $0x1,%edi
+  8046b2:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8046b5:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8046b8:	eb 34                	jmp    8046ee <va_chunk_scan+0x5e>
+			i += 31;
+  8046ba:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  8046bd:	89 ca                	mov    %ecx,%edx
+			continue;
+  8046bf:	eb 23                	jmp    8046e4 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8046c1:	89 c7                	mov    %eax,%edi
+  8046c3:	c1 ef 05             	shr    $0x5,%edi
+  8046c6:	be 01 00 00 00       	mov    $0x1,%esi
+  8046cb:	d3 e6                	shl    %cl,%esi
+  8046cd:	89 f1                	mov    %esi,%ecx
+  8046cf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8046d2:	23 0c be             	and    (%esi,%edi,4),%ecx
+  8046d5:	75 41                	jne    804718 <va_chunk_scan+0x88>
+			len++;
+  8046d7:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  8046da:	39 d3                	cmp    %edx,%ebx
+  8046dc:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  8046df:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  8046e2:	72 2d                	jb     804711 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8046e4:	83 c0 01             	add    $0x1,%eax
+  8046e7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8046ec:	77 31                	ja     80471f <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  8046ee:	89 c1                	mov    %eax,%ecx
+  8046f0:	83 e1 1f             	and    $0x1f,%ecx
+  8046f3:	75 cc                	jne    8046c1 <va_chunk_scan+0x31>
+  8046f5:	89 c7                	mov    %eax,%edi
+  8046f7:	c1 ef 05             	shr    $0x5,%edi
+  8046fa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8046fd:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804700:	83 ff ff             	cmp    $0xffffffff,%edi
+  804703:	74 b5                	je     8046ba <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  804705:	85 ff                	test   %edi,%edi
+  804707:	75 b8                	jne    8046c1 <va_chunk_scan+0x31>
+			i += 31;
+  804709:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  80470c:	83 c2 20             	add    $0x20,%edx
+  80470f:	eb c9                	jmp    8046da <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804711:	83 c0 01             	add    $0x1,%eax
+  804714:	29 d0                	sub    %edx,%eax
+  804716:	eb 15                	jmp    80472d <va_chunk_scan+0x9d>
+			len = 0;
+  804718:	ba 00 00 00 00       	mov    $0x0,%edx
+  80471d:	eb c5                	jmp    8046e4 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  80471f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804724:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804727:	85 d2                	test   %edx,%edx
+  804729:	74 02                	je     80472d <va_chunk_scan+0x9d>
+		*run_store = best;
+  80472b:	89 1a                	mov    %ebx,(%edx)
+}
+  80472d:	83 c4 0c             	add    $0xc,%esp
+  804730:	5b                   	pop    %ebx
+  804731:	5e                   	pop    %esi
+  804732:	5f                   	pop    %edi
+  804733:	5d                   	pop    %ebp
+  804734:	c3                   	ret
+
+00804735 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804735:	55                   	push   %ebp
+  804736:	89 e5                	mov    %esp,%ebp
+  804738:	57                   	push   %edi
+  804739:	56                   	push   %esi
+  80473a:	53                   	push   %ebx
+  80473b:	83 ec 14             	sub    $0x14,%esp
+  80473e:	89 c3                	mov    %eax,%ebx
+  804740:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804742:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804748:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  80474e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804751:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804754:	89 d6                	mov    %edx,%esi
+  804756:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  80475c:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  80475e:	eb 34                	jmp    804794 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804760:	89 c8                	mov    %ecx,%eax
+  804762:	c1 e8 05             	shr    $0x5,%eax
+  804765:	89 da                	mov    %ebx,%edx
+  804767:	c1 e2 05             	shl    $0x5,%edx
+  80476a:	01 da                	add    %ebx,%edx
+  80476c:	01 c2                	add    %eax,%edx
+  80476e:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804773:	d3 c0                	rol    %cl,%eax
+  804775:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  80477c:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804783:	b8 01 00 00 00       	mov    $0x1,%eax
+  804788:	01 d0                	add    %edx,%eax
+  80478a:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804791:	83 c1 01             	add    $0x1,%ecx
+  804794:	39 f9                	cmp    %edi,%ecx
+  804796:	74 30                	je     8047c8 <va_chunk_mark+0x93>
+		if (alloc)
+  804798:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80479c:	74 c2                	je     804760 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  80479e:	89 c8                	mov    %ecx,%eax
+  8047a0:	c1 e8 05             	shr    $0x5,%eax
+  8047a3:	89 da                	mov    %ebx,%edx
+  8047a5:	c1 e2 05             	shl    $0x5,%edx
+  8047a8:	01 da                	add    %ebx,%edx
+  8047aa:	01 c2                	add    %eax,%edx
+  8047ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  8047b1:	d3 e0                	shl    %cl,%eax
+  8047b3:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  8047ba:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  8047c1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8047c6:	eb c0                	jmp    804788 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  8047c8:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  8047cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8047d3:	e8 b8 fe ff ff       	call   804690 <va_chunk_scan>
+	ch->run = run;
+  8047d8:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  8047de:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8047e1:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  8047e8:	83 c4 14             	add    $0x14,%esp
+  8047eb:	5b                   	pop    %ebx
+  8047ec:	5e                   	pop    %esi
+  8047ed:	5f                   	pop    %edi
+  8047ee:	5d                   	pop    %ebp
+  8047ef:	c3                   	ret
+
+008047f0 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  8047f0:	55                   	push   %ebp
+  8047f1:	89 e5                	mov    %esp,%ebp
+  8047f3:	57                   	push   %edi
+  8047f4:	56                   	push   %esi
+  8047f5:	53                   	push   %ebx
+  8047f6:	83 ec 04             	sub    $0x4,%esp
+  8047f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  8047fc:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  804801:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  804806:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  80480d:	74 4f                	je     80485e <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  80480f:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804812:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804817:	0f 87 01 01 00 00    	ja     80491e <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  80481d:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804823:	0f 87 80 00 00 00    	ja     8048a9 <va_alloc+0xb9>
+  804829:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  80482e:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804833:	0f b7 10             	movzwl (%eax),%edx
+  804836:	05 84 00 00 00       	add    $0x84,%eax
+  80483b:	39 da                	cmp    %ebx,%edx
+  80483d:	73 2c                	jae    80486b <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  80483f:	83 c6 01             	add    $0x1,%esi
+  804842:	83 fe 1c             	cmp    $0x1c,%esi
+  804845:	75 ec                	jne    804833 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804847:	b8 00 00 00 00       	mov    $0x0,%eax
+  80484c:	eb 53                	jmp    8048a1 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  80484e:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804854:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804859:	05 84 00 00 00       	add    $0x84,%eax
+  80485e:	39 d0                	cmp    %edx,%eax
+  804860:	75 ec                	jne    80484e <va_alloc+0x5e>
+	va_inited = 1;
+  804862:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  804869:	eb a4                	jmp    80480f <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  80486b:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804871:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  804876:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80487b:	89 da                	mov    %ebx,%edx
+  80487d:	e8 0e fe ff ff       	call   804690 <va_chunk_scan>
+  804882:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804884:	6a 01                	push   $0x1
+  804886:	89 d9                	mov    %ebx,%ecx
+  804888:	89 c2                	mov    %eax,%edx
+  80488a:	89 f0                	mov    %esi,%eax
+  80488c:	e8 a4 fe ff ff       	call   804735 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804891:	c1 e6 16             	shl    $0x16,%esi
+  804894:	c1 e7 0c             	shl    $0xc,%edi
+  804897:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  80489e:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  8048a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8048a4:	5b                   	pop    %ebx
+  8048a5:	5e                   	pop    %esi
+  8048a6:	5f                   	pop    %edi
+  8048a7:	5d                   	pop    %ebp
+  8048a8:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  8048a9:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  8048af:	c1 ee 0a             	shr    $0xa,%esi
+  8048b2:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  8048b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048bc:	eb 0a                	jmp    8048c8 <va_alloc+0xd8>
+			first = c + 1;
+  8048be:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  8048c0:	83 c2 01             	add    $0x1,%edx
+  8048c3:	83 fa 1d             	cmp    $0x1d,%edx
+  8048c6:	74 4f                	je     804917 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  8048c8:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  8048ce:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  8048d5:	00 04 
+  8048d7:	75 e5                	jne    8048be <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  8048d9:	89 d1                	mov    %edx,%ecx
+  8048db:	29 c1                	sub    %eax,%ecx
+  8048dd:	39 f1                	cmp    %esi,%ecx
+  8048df:	75 df                	jne    8048c0 <va_alloc+0xd0>
+  8048e1:	89 c7                	mov    %eax,%edi
+  8048e3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  8048e6:	be 00 04 00 00       	mov    $0x400,%esi
+  8048eb:	39 f3                	cmp    %esi,%ebx
+  8048ed:	0f 46 f3             	cmovbe %ebx,%esi
+  8048f0:	6a 01                	push   $0x1
+  8048f2:	89 f1                	mov    %esi,%ecx
+  8048f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048f9:	89 f8                	mov    %edi,%eax
+  8048fb:	e8 35 fe ff ff       	call   804735 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804900:	83 c7 01             	add    $0x1,%edi
+  804903:	83 c4 04             	add    $0x4,%esp
+  804906:	29 f3                	sub    %esi,%ebx
+  804908:	75 dc                	jne    8048e6 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  80490a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80490d:	c1 e0 16             	shl    $0x16,%eax
+  804910:	05 00 00 00 08       	add    $0x8000000,%eax
+  804915:	eb 8a                	jmp    8048a1 <va_alloc+0xb1>
+	return NULL;
+  804917:	b8 00 00 00 00       	mov    $0x0,%eax
+  80491c:	eb 83                	jmp    8048a1 <va_alloc+0xb1>
+		return NULL;
+  80491e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804923:	e9 79 ff ff ff       	jmp    8048a1 <va_alloc+0xb1>
+
+00804928 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804928:	55                   	push   %ebp
+  804929:	89 e5                	mov    %esp,%ebp
+  80492b:	57                   	push   %edi
+  80492c:	56                   	push   %esi
+  80492d:	53                   	push   %ebx
+  80492e:	83 ec 0c             	sub    $0xc,%esp
+  804931:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804934:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804937:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  80493d:	76 21                	jbe    804960 <va_free+0x38>
+  80493f:	89 f0                	mov    %esi,%eax
+  804941:	c1 e0 0c             	shl    $0xc,%eax
+  804944:	01 f8                	add    %edi,%eax
+  804946:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  80494b:	77 13                	ja     804960 <va_free+0x38>
+	    || PGOFF(va))
+  80494d:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804953:	75 0b                	jne    804960 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804955:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  80495b:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  80495e:	eb 45                	jmp    8049a5 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804960:	83 ec 0c             	sub    $0xc,%esp
+  804963:	56                   	push   %esi
+  804964:	57                   	push   %edi
+  804965:	68 28 5e 80 00       	push   $0x805e28
+  80496a:	68 8e 00 00 00       	push   $0x8e
+  80496f:	68 48 5e 80 00       	push   $0x805e48
+  804974:	e8 c5 bb ff ff       	call   80053e <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804979:	89 fa                	mov    %edi,%edx
+  80497b:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804981:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804986:	29 d3                	sub    %edx,%ebx
+  804988:	39 f3                	cmp    %esi,%ebx
+  80498a:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  80498d:	89 f8                	mov    %edi,%eax
+  80498f:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804992:	83 ec 0c             	sub    $0xc,%esp
+  804995:	6a 00                	push   $0x0
+  804997:	89 d9                	mov    %ebx,%ecx
+  804999:	e8 97 fd ff ff       	call   804735 <va_chunk_mark>
+		i += n;
+  80499e:	01 df                	add    %ebx,%edi
+		npages -= n;
+  8049a0:	29 de                	sub    %ebx,%esi
+  8049a2:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  8049a5:	85 f6                	test   %esi,%esi
+  8049a7:	75 d0                	jne    804979 <va_free+0x51>
+	}
+}
+  8049a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8049ac:	5b                   	pop    %ebx
+  8049ad:	5e                   	pop    %esi
+  8049ae:	5f                   	pop    %edi
+  8049af:	5d                   	pop    %ebp
+  8049b0:	c3                   	ret
+
+008049b1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8049b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049b6:	c3                   	ret
+
+008049b7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8049b7:	55                   	push   %ebp
+  8049b8:	89 e5                	mov    %esp,%ebp
+  8049ba:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8049bd:	68 55 5e 80 00       	push   $0x805e55
+  8049c2:	ff 75 0c             	push   0xc(%ebp)
+  8049c5:	e8 36 c2 ff ff       	call   800c00 <strcpy>
+	return 0;
+}
+  8049ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049cf:	c9                   	leave
+  8049d0:	c3                   	ret
+
+008049d1 <devcons_write>:
+{
+  8049d1:	55                   	push   %ebp
+  8049d2:	89 e5                	mov    %esp,%ebp
+  8049d4:	57                   	push   %edi
+  8049d5:	56                   	push   %esi
+  8049d6:	53                   	push   %ebx
+  8049d7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8049dd:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8049e2:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8049e8:	eb 2e                	jmp    804a18 <devcons_write+0x47>
+		m = n - tot;
+  8049ea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8049ed:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8049ef:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8049f4:	39 c3                	cmp    %eax,%ebx
+  8049f6:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8049f9:	83 ec 04             	sub    $0x4,%esp
+  8049fc:	53                   	push   %ebx
+  8049fd:	89 f0                	mov    %esi,%eax
+  8049ff:	03 45 0c             	add    0xc(%ebp),%eax
+  804a02:	50                   	push   %eax
+  804a03:	57                   	push   %edi
+  804a04:	e8 7d c3 ff ff       	call   800d86 <memmove>
+		sys_cputs(buf, m);
+  804a09:	83 c4 08             	add    $0x8,%esp
+  804a0c:	53                   	push   %ebx
+  804a0d:	57                   	push   %edi
+  804a0e:	e8 13 c6 ff ff       	call   801026 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804a13:	01 de                	add    %ebx,%esi
+  804a15:	83 c4 10             	add    $0x10,%esp
+  804a18:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804a1b:	72 cd                	jb     8049ea <devcons_write+0x19>
+}
+  804a1d:	89 f0                	mov    %esi,%eax
+  804a1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a22:	5b                   	pop    %ebx
+  804a23:	5e                   	pop    %esi
+  804a24:	5f                   	pop    %edi
+  804a25:	5d                   	pop    %ebp
+  804a26:	c3                   	ret
+
+00804a27 <devcons_read>:
+{
+  804a27:	55                   	push   %ebp
+  804a28:	89 e5                	mov    %esp,%ebp
+  804a2a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a32:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804a36:	75 07                	jne    804a3f <devcons_read+0x18>
+  804a38:	eb 1f                	jmp    804a59 <devcons_read+0x32>
+		sys_yield();
+  804a3a:	e8 95 c6 ff ff       	call   8010d4 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804a3f:	e8 11 c6 ff ff       	call   801055 <sys_cgetc>
+  804a44:	85 c0                	test   %eax,%eax
+  804a46:	74 f2                	je     804a3a <devcons_read+0x13>
+	if (c < 0)
+  804a48:	78 0f                	js     804a59 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804a4a:	83 f8 04             	cmp    $0x4,%eax
+  804a4d:	74 0c                	je     804a5b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804a4f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804a52:	88 02                	mov    %al,(%edx)
+	return 1;
+  804a54:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804a59:	c9                   	leave
+  804a5a:	c3                   	ret
+		return 0;
+  804a5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a60:	eb f7                	jmp    804a59 <devcons_read+0x32>
+
+00804a62 <cputchar>:
+{
+  804a62:	55                   	push   %ebp
+  804a63:	89 e5                	mov    %esp,%ebp
+  804a65:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804a68:	8b 45 08             	mov    0x8(%ebp),%eax
+  804a6b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804a6e:	6a 01                	push   $0x1
+  804a70:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804a73:	50                   	push   %eax
+  804a74:	e8 ad c5 ff ff       	call   801026 <sys_cputs>
+}
+  804a79:	83 c4 10             	add    $0x10,%esp
+  804a7c:	c9                   	leave
+  804a7d:	c3                   	ret
+
+00804a7e <getchar>:
+{
+  804a7e:	55                   	push   %ebp
+  804a7f:	89 e5                	mov    %esp,%ebp
+  804a81:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804a84:	6a 01                	push   $0x1
+  804a86:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804a89:	50                   	push   %eax
+  804a8a:	6a 00                	push   $0x0
+  804a8c:	e8 d7 ce ff ff       	call   801968 <read>
+	if (r < 0)
+  804a91:	83 c4 10             	add    $0x10,%esp
+  804a94:	85 c0                	test   %eax,%eax
+  804a96:	78 06                	js     804a9e <getchar+0x20>
+	if (r < 1)
+  804a98:	74 06                	je     804aa0 <getchar+0x22>
+	return c;
+  804a9a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804a9e:	c9                   	leave
+  804a9f:	c3                   	ret
+		return -E_EOF;
+  804aa0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804aa5:	eb f7                	jmp    804a9e <getchar+0x20>
+
+00804aa7 <iscons>:
+{
+  804aa7:	55                   	push   %ebp
+  804aa8:	89 e5                	mov    %esp,%ebp
+  804aaa:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804aad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804ab0:	50                   	push   %eax
+  804ab1:	ff 75 08             	push   0x8(%ebp)
+  804ab4:	e8 50 cc ff ff       	call   801709 <fd_lookup>
+  804ab9:	83 c4 10             	add    $0x10,%esp
+  804abc:	85 c0                	test   %eax,%eax
+  804abe:	78 11                	js     804ad1 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804ac0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804ac3:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804ac9:	39 10                	cmp    %edx,(%eax)
+  804acb:	0f 94 c0             	sete   %al
+  804ace:	0f b6 c0             	movzbl %al,%eax
+}
+  804ad1:	c9                   	leave
+  804ad2:	c3                   	ret
+
+00804ad3 <opencons>:
+{
+  804ad3:	55                   	push   %ebp
+  804ad4:	89 e5                	mov    %esp,%ebp
+  804ad6:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804ad9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804adc:	50                   	push   %eax
+  804add:	e8 d3 cb ff ff       	call   8016b5 <fd_alloc>
+  804ae2:	83 c4 10             	add    $0x10,%esp
+  804ae5:	85 c0                	test   %eax,%eax
+  804ae7:	78 3a                	js     804b23 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804ae9:	83 ec 04             	sub    $0x4,%esp
+  804aec:	68 07 04 00 00       	push   $0x407
+  804af1:	ff 75 f4             	push   -0xc(%ebp)
+  804af4:	6a 00                	push   $0x0
+  804af6:	e8 f8 c5 ff ff       	call   8010f3 <sys_page_alloc>
+  804afb:	83 c4 10             	add    $0x10,%esp
+  804afe:	85 c0                	test   %eax,%eax
+  804b00:	78 21                	js     804b23 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804b02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804b05:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804b0b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804b0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804b10:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804b17:	83 ec 0c             	sub    $0xc,%esp
+  804b1a:	50                   	push   %eax
+  804b1b:	e8 6e cb ff ff       	call   80168e <fd2num>
+  804b20:	83 c4 10             	add    $0x10,%esp
+}
+  804b23:	c9                   	leave
+  804b24:	c3                   	ret
+
+00804b25 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804b25:	55                   	push   %ebp
+  804b26:	89 e5                	mov    %esp,%ebp
+  804b28:	56                   	push   %esi
+  804b29:	53                   	push   %ebx
+  804b2a:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804b2d:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  804b32:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804b35:	85 db                	test   %ebx,%ebx
+  804b37:	78 17                	js     804b50 <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804b39:	83 ec 0c             	sub    $0xc,%esp
+  804b3c:	56                   	push   %esi
+  804b3d:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  804b44:	83 c4 10             	add    $0x10,%esp
+  804b47:	85 c0                	test   %eax,%eax
+  804b49:	75 27                	jne    804b72 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804b4b:	83 eb 01             	sub    $0x1,%ebx
+  804b4e:	eb e5                	jmp    804b35 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804b50:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b55:	8b 40 48             	mov    0x48(%eax),%eax
+  804b58:	83 ec 08             	sub    $0x8,%esp
+  804b5b:	ff 76 28             	push   0x28(%esi)
+  804b5e:	ff 36                	push   (%esi)
+  804b60:	50                   	push   %eax
+  804b61:	68 64 5e 80 00       	push   $0x805e64
+  804b66:	6a 1d                	push   $0x1d
+  804b68:	68 87 5e 80 00       	push   $0x805e87
+  804b6d:	e8 cc b9 ff ff       	call   80053e <_panic>
+}
+  804b72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804b75:	5b                   	pop    %ebx
+  804b76:	5e                   	pop    %esi
+  804b77:	5d                   	pop    %ebp
+  804b78:	c3                   	ret
+
+00804b79 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804b79:	55                   	push   %ebp
+  804b7a:	89 e5                	mov    %esp,%ebp
+  804b7c:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804b7f:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  804b86:	74 0a                	je     804b92 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804b88:	8b 45 08             	mov    0x8(%ebp),%eax
+  804b8b:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  804b90:	c9                   	leave
+  804b91:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804b92:	83 ec 04             	sub    $0x4,%esp
+  804b95:	6a 07                	push   $0x7
+  804b97:	68 00 f0 bf ee       	push   $0xeebff000
+  804b9c:	6a 00                	push   $0x0
+  804b9e:	e8 50 c5 ff ff       	call   8010f3 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804ba3:	83 c4 08             	add    $0x8,%esp
+  804ba6:	68 19 4c 80 00       	push   $0x804c19
+  804bab:	6a 00                	push   $0x0
+  804bad:	e8 a7 c8 ff ff       	call   801459 <sys_env_set_pgfault_upcall>
+  804bb2:	83 c4 10             	add    $0x10,%esp
+  804bb5:	eb d1                	jmp    804b88 <set_pgfault_handler+0xf>
+
+00804bb7 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804bb7:	55                   	push   %ebp
+  804bb8:	89 e5                	mov    %esp,%ebp
+  804bba:	83 ec 08             	sub    $0x8,%esp
+  804bbd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  804bc0:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  804bc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bcb:	eb 03                	jmp    804bd0 <add_pgfault_handler+0x19>
+  804bcd:	83 c0 01             	add    $0x1,%eax
+  804bd0:	39 d0                	cmp    %edx,%eax
+  804bd2:	74 0b                	je     804bdf <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804bd4:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  804bdb:	75 f0                	jne    804bcd <add_pgfault_handler+0x16>
+  804bdd:	eb 24                	jmp    804c03 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  804bdf:	83 fa 0a             	cmp    $0xa,%edx
+  804be2:	74 21                	je     804c05 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  804be4:	8d 42 01             	lea    0x1(%edx),%eax
+  804be7:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  804bec:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  804bf3:	83 ec 0c             	sub    $0xc,%esp
+  804bf6:	68 25 4b 80 00       	push   $0x804b25
+  804bfb:	e8 79 ff ff ff       	call   804b79 <set_pgfault_handler>
+  804c00:	83 c4 10             	add    $0x10,%esp
+}
+  804c03:	c9                   	leave
+  804c04:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  804c05:	83 ec 04             	sub    $0x4,%esp
+  804c08:	68 95 5e 80 00       	push   $0x805e95
+  804c0d:	6a 44                	push   $0x44
+  804c0f:	68 87 5e 80 00       	push   $0x805e87
+  804c14:	e8 25 b9 ff ff       	call   80053e <_panic>
+
+00804c19 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804c19:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804c1a:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  804c1f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804c21:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  804c24:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  804c28:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  804c2c:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  804c2f:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  804c31:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  804c35:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  804c38:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  804c39:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  804c3c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  804c3d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  804c3e:	c3                   	ret
+
+00804c3f <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  804c3f:	55                   	push   %ebp
+  804c40:	89 e5                	mov    %esp,%ebp
+  804c42:	57                   	push   %edi
+  804c43:	56                   	push   %esi
+  804c44:	53                   	push   %ebx
+  804c45:	83 ec 14             	sub    $0x14,%esp
+  804c48:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804c4b:	8b 75 14             	mov    0x14(%ebp),%esi
+  804c4e:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804c51:	ff 75 10             	push   0x10(%ebp)
+  804c54:	ff 75 0c             	push   0xc(%ebp)
+  804c57:	e8 ba c8 ff ff       	call   801516 <sys_ipc_recv_pages>
+  804c5c:	83 c4 10             	add    $0x10,%esp
+  804c5f:	85 c0                	test   %eax,%eax
+  804c61:	78 46                	js     804ca9 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804c63:	85 ff                	test   %edi,%edi
+  804c65:	74 0d                	je     804c74 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804c67:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804c6c:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804c72:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804c74:	85 f6                	test   %esi,%esi
+  804c76:	74 0d                	je     804c85 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804c78:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804c7d:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804c83:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804c85:	85 db                	test   %ebx,%ebx
+  804c87:	74 0d                	je     804c96 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804c89:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804c8e:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804c94:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804c96:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804c9b:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804ca1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804ca4:	5b                   	pop    %ebx
+  804ca5:	5e                   	pop    %esi
+  804ca6:	5f                   	pop    %edi
+  804ca7:	5d                   	pop    %ebp
+  804ca8:	c3                   	ret
+		if (from_env_store) {
+  804ca9:	85 ff                	test   %edi,%edi
+  804cab:	74 06                	je     804cb3 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  804cad:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804cb3:	85 f6                	test   %esi,%esi
+  804cb5:	74 06                	je     804cbd <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804cb7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804cbd:	85 db                	test   %ebx,%ebx
+  804cbf:	74 e0                	je     804ca1 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  804cc1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804cc7:	eb d8                	jmp    804ca1 <ipc_recv_pages+0x62>
+
+00804cc9 <ipc_recv>:
+{
+  804cc9:	55                   	push   %ebp
+  804cca:	89 e5                	mov    %esp,%ebp
+  804ccc:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  804ccf:	6a 00                	push   $0x0
+  804cd1:	ff 75 10             	push   0x10(%ebp)
+  804cd4:	6a 01                	push   $0x1
+  804cd6:	ff 75 0c             	push   0xc(%ebp)
+  804cd9:	ff 75 08             	push   0x8(%ebp)
+  804cdc:	e8 5e ff ff ff       	call   804c3f <ipc_recv_pages>
+}
+  804ce1:	c9                   	leave
+  804ce2:	c3                   	ret
+
+00804ce3 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804ce3:	55                   	push   %ebp
+  804ce4:	89 e5                	mov    %esp,%ebp
+  804ce6:	56                   	push   %esi
+  804ce7:	53                   	push   %ebx
+  804ce8:	8b 75 08             	mov    0x8(%ebp),%esi
+  804ceb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  804cee:	83 ec 0c             	sub    $0xc,%esp
+  804cf1:	ff 75 0c             	push   0xc(%ebp)
+  804cf4:	e8 51 c9 ff ff       	call   80164a <sys_ipc_try_recv>
+  804cf9:	83 c4 10             	add    $0x10,%esp
+  804cfc:	85 c0                	test   %eax,%eax
+  804cfe:	78 34                	js     804d34 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804d00:	85 f6                	test   %esi,%esi
+  804d02:	74 0d                	je     804d11 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  804d04:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804d09:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804d0f:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  804d11:	85 db                	test   %ebx,%ebx
+  804d13:	74 0d                	je     804d22 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  804d15:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804d1a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804d20:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804d22:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804d27:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804d2d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804d30:	5b                   	pop    %ebx
+  804d31:	5e                   	pop    %esi
+  804d32:	5d                   	pop    %ebp
+  804d33:	c3                   	ret
+		if (from_env_store) {
+  804d34:	85 f6                	test   %esi,%esi
+  804d36:	74 06                	je     804d3e <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  804d38:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  804d3e:	85 db                	test   %ebx,%ebx
+  804d40:	74 eb                	je     804d2d <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  804d42:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804d48:	eb e3                	jmp    804d2d <ipc_try_recv+0x4a>
+
+00804d4a <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804d4a:	55                   	push   %ebp
+  804d4b:	89 e5                	mov    %esp,%ebp
+  804d4d:	83 ec 14             	sub    $0x14,%esp
+  804d50:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804d53:	85 c0                	test   %eax,%eax
+  804d55:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804d5a:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804d5d:	ff 75 18             	push   0x18(%ebp)
+  804d60:	ff 75 14             	push   0x14(%ebp)
+  804d63:	50                   	push   %eax
+  804d64:	ff 75 0c             	push   0xc(%ebp)
+  804d67:	ff 75 08             	push   0x8(%ebp)
+  804d6a:	e8 6a c7 ff ff       	call   8014d9 <sys_ipc_send_pages>
+  804d6f:	83 c4 20             	add    $0x20,%esp
+  804d72:	85 c0                	test   %eax,%eax
+  804d74:	78 02                	js     804d78 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804d76:	c9                   	leave
+  804d77:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804d78:	50                   	push   %eax
+  804d79:	68 b0 5e 80 00       	push   $0x805eb0
+  804d7e:	68 80 00 00 00       	push   $0x80
+  804d83:	68 dc 5e 80 00       	push   $0x805edc
+  804d88:	e8 b1 b7 ff ff       	call   80053e <_panic>
+
+00804d8d <ipc_send>:
+{
+  804d8d:	55                   	push   %ebp
+  804d8e:	89 e5                	mov    %esp,%ebp
+  804d90:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  804d93:	ff 75 14             	push   0x14(%ebp)
+  804d96:	6a 01                	push   $0x1
+  804d98:	ff 75 10             	push   0x10(%ebp)
+  804d9b:	ff 75 0c             	push   0xc(%ebp)
+  804d9e:	ff 75 08             	push   0x8(%ebp)
+  804da1:	e8 a4 ff ff ff       	call   804d4a <ipc_send_pages>
+}
+  804da6:	83 c4 20             	add    $0x20,%esp
+  804da9:	c9                   	leave
+  804daa:	c3                   	ret
+
+00804dab <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804dab:	55                   	push   %ebp
+  804dac:	89 e5                	mov    %esp,%ebp
+  804dae:	83 ec 14             	sub    $0x14,%esp
+  804db1:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804db4:	85 c0                	test   %eax,%eax
+  804db6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804dbb:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804dbe:	ff 75 18             	push   0x18(%ebp)
+  804dc1:	ff 75 14             	push   0x14(%ebp)
+  804dc4:	50                   	push   %eax
+  804dc5:	ff 75 0c             	push   0xc(%ebp)
+  804dc8:	ff 75 08             	push   0x8(%ebp)
+  804dcb:	e8 9a c7 ff ff       	call   80156a <sys_ipc_call>
+  804dd0:	83 c4 20             	add    $0x20,%esp
+  804dd3:	85 c0                	test   %eax,%eax
+  804dd5:	78 0b                	js     804de2 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  804dd7:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804ddc:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804de2:	c9                   	leave
+  804de3:	c3                   	ret
+
+00804de4 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  804de4:	55                   	push   %ebp
+  804de5:	89 e5                	mov    %esp,%ebp
+  804de7:	57                   	push   %edi
+  804de8:	56                   	push   %esi
+  804de9:	53                   	push   %ebx
+  804dea:	83 ec 18             	sub    $0x18,%esp
+  804ded:	8b 45 10             	mov    0x10(%ebp),%eax
+  804df0:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  804df3:	8b 75 20             	mov    0x20(%ebp),%esi
+  804df6:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804df9:	85 c0                	test   %eax,%eax
+  804dfb:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804e00:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804e03:	ff 75 18             	push   0x18(%ebp)
+  804e06:	ff 75 14             	push   0x14(%ebp)
+  804e09:	50                   	push   %eax
+  804e0a:	ff 75 0c             	push   0xc(%ebp)
+  804e0d:	ff 75 08             	push   0x8(%ebp)
+  804e10:	e8 96 c7 ff ff       	call   8015ab <sys_ipc_reply_recv>
+  804e15:	83 c4 20             	add    $0x20,%esp
+  804e18:	85 c0                	test   %eax,%eax
+  804e1a:	78 46                	js     804e62 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804e1c:	85 ff                	test   %edi,%edi
+  804e1e:	74 0d                	je     804e2d <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  804e20:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804e25:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804e2b:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804e2d:	85 f6                	test   %esi,%esi
+  804e2f:	74 0d                	je     804e3e <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  804e31:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804e36:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804e3c:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804e3e:	85 db                	test   %ebx,%ebx
+  804e40:	74 0d                	je     804e4f <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  804e42:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804e47:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804e4d:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804e4f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804e54:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804e5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804e5d:	5b                   	pop    %ebx
+  804e5e:	5e                   	pop    %esi
+  804e5f:	5f                   	pop    %edi
+  804e60:	5d                   	pop    %ebp
+  804e61:	c3                   	ret
+		if (from_env_store) {
+  804e62:	85 ff                	test   %edi,%edi
+  804e64:	74 06                	je     804e6c <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  804e66:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804e6c:	85 f6                	test   %esi,%esi
+  804e6e:	74 06                	je     804e76 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  804e70:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804e76:	85 db                	test   %ebx,%ebx
+  804e78:	74 e0                	je     804e5a <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  804e7a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804e80:	eb d8                	jmp    804e5a <ipc_reply_recv+0x76>
+
+00804e82 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804e82:	55                   	push   %ebp
+  804e83:	89 e5                	mov    %esp,%ebp
+  804e85:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804e88:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804e8d:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804e90:	c1 e0 06             	shl    $0x6,%eax
+  804e93:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804e98:	8b 40 50             	mov    0x50(%eax),%eax
+  804e9b:	39 c8                	cmp    %ecx,%eax
+  804e9d:	74 12                	je     804eb1 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804e9f:	83 c2 01             	add    $0x1,%edx
+  804ea2:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804ea8:	75 e3                	jne    804e8d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804eaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  804eaf:	eb 0e                	jmp    804ebf <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804eb1:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804eb4:	c1 e0 06             	shl    $0x6,%eax
+  804eb7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804ebc:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804ebf:	5d                   	pop    %ebp
+  804ec0:	c3                   	ret
+
+00804ec1 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804ec1:	55                   	push   %ebp
+  804ec2:	89 e5                	mov    %esp,%ebp
+  804ec4:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804ec7:	89 c2                	mov    %eax,%edx
+  804ec9:	c1 ea 16             	shr    $0x16,%edx
+  804ecc:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804ed3:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804ed8:	f6 c1 01             	test   $0x1,%cl
+  804edb:	74 1e                	je     804efb <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  804edd:	c1 e8 0c             	shr    $0xc,%eax
+  804ee0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804ee7:	a8 01                	test   $0x1,%al
+  804ee9:	74 10                	je     804efb <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804eeb:	c1 e8 0c             	shr    $0xc,%eax
+  804eee:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  804ef1:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  804ef8:	0f b7 d2             	movzwl %dx,%edx
+}
+  804efb:	89 d0                	mov    %edx,%eax
+  804efd:	5d                   	pop    %ebp
+  804efe:	c3                   	ret
+
+00804eff <udivmod>:
+  804eff:	55                   	push   %ebp
+  804f00:	57                   	push   %edi
+  804f01:	56                   	push   %esi
+  804f02:	53                   	push   %ebx
+  804f03:	83 ec 24             	sub    $0x24,%esp
+  804f06:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804f0a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804f0e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804f12:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804f16:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804f1a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804f1e:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  804f22:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804f27:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f31:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804f38:	00 
+  804f39:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804f40:	00 
+  804f41:	89 fb                	mov    %edi,%ebx
+  804f43:	eb 08                	jmp    804f4d <udivmod+0x4e>
+  804f45:	83 e9 01             	sub    $0x1,%ecx
+  804f48:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804f4b:	74 68                	je     804fb5 <udivmod+0xb6>
+  804f4d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804f51:	01 c0                	add    %eax,%eax
+  804f53:	89 c6                	mov    %eax,%esi
+  804f55:	89 d7                	mov    %edx,%edi
+  804f57:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804f5b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804f5f:	0f ad d0             	shrd   %cl,%edx,%eax
+  804f62:	d3 ea                	shr    %cl,%edx
+  804f64:	f6 c1 20             	test   $0x20,%cl
+  804f67:	74 04                	je     804f6d <udivmod+0x6e>
+  804f69:	89 d0                	mov    %edx,%eax
+  804f6b:	31 d2                	xor    %edx,%edx
+  804f6d:	83 e0 01             	and    $0x1,%eax
+  804f70:	89 04 24             	mov    %eax,(%esp)
+  804f73:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804f7a:	00 
+  804f7b:	8b 04 24             	mov    (%esp),%eax
+  804f7e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804f82:	09 f0                	or     %esi,%eax
+  804f84:	09 fa                	or     %edi,%edx
+  804f86:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804f8a:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804f8e:	39 f0                	cmp    %esi,%eax
+  804f90:	89 d5                	mov    %edx,%ebp
+  804f92:	19 fd                	sbb    %edi,%ebp
+  804f94:	72 af                	jb     804f45 <udivmod+0x46>
+  804f96:	29 f0                	sub    %esi,%eax
+  804f98:	19 fa                	sbb    %edi,%edx
+  804f9a:	89 cf                	mov    %ecx,%edi
+  804f9c:	c1 ef 05             	shr    $0x5,%edi
+  804f9f:	83 e7 01             	and    $0x1,%edi
+  804fa2:	89 fe                	mov    %edi,%esi
+  804fa4:	83 f6 01             	xor    $0x1,%esi
+  804fa7:	d3 e6                	shl    %cl,%esi
+  804fa9:	d3 e7                	shl    %cl,%edi
+  804fab:	09 74 24 18          	or     %esi,0x18(%esp)
+  804faf:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804fb3:	eb 90                	jmp    804f45 <udivmod+0x46>
+  804fb5:	85 db                	test   %ebx,%ebx
+  804fb7:	74 05                	je     804fbe <udivmod+0xbf>
+  804fb9:	89 03                	mov    %eax,(%ebx)
+  804fbb:	89 53 04             	mov    %edx,0x4(%ebx)
+  804fbe:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804fc2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804fc6:	83 c4 24             	add    $0x24,%esp
+  804fc9:	5b                   	pop    %ebx
+  804fca:	5e                   	pop    %esi
+  804fcb:	5f                   	pop    %edi
+  804fcc:	5d                   	pop    %ebp
+  804fcd:	c3                   	ret
+
+00804fce <__udivdi3>:
+  804fce:	83 ec 08             	sub    $0x8,%esp
+  804fd1:	6a 00                	push   $0x0
+  804fd3:	ff 74 24 1c          	push   0x1c(%esp)
+  804fd7:	ff 74 24 1c          	push   0x1c(%esp)
+  804fdb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804fdf:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804fe3:	e8 17 ff ff ff       	call   804eff <udivmod>
+  804fe8:	83 c4 14             	add    $0x14,%esp
+  804feb:	c3                   	ret
+
+00804fec <__umoddi3>:
+  804fec:	83 ec 18             	sub    $0x18,%esp
+  804fef:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804ff3:	50                   	push   %eax
+  804ff4:	ff 74 24 2c          	push   0x2c(%esp)
+  804ff8:	ff 74 24 2c          	push   0x2c(%esp)
+  804ffc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  805000:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  805004:	e8 f6 fe ff ff       	call   804eff <udivmod>
+  805009:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80500d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805011:	83 c4 24             	add    $0x24,%esp
+  805014:	c3                   	ret
+
+00805015 <__divdi3>:
+  805015:	55                   	push   %ebp
+  805016:	57                   	push   %edi
+  805017:	56                   	push   %esi
+  805018:	53                   	push   %ebx
+  805019:	83 ec 10             	sub    $0x10,%esp
+  80501c:	8b 44 24 24          	mov    0x24(%esp),%eax
+  805020:	8b 54 24 28          	mov    0x28(%esp),%edx
+  805024:	89 c6                	mov    %eax,%esi
+  805026:	89 d7                	mov    %edx,%edi
+  805028:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  80502c:	33 7c 24 30          	xor    0x30(%esp),%edi
+  805030:	89 74 24 04          	mov    %esi,0x4(%esp)
+  805034:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  805038:	89 c5                	mov    %eax,%ebp
+  80503a:	f7 dd                	neg    %ebp
+  80503c:	89 d6                	mov    %edx,%esi
+  80503e:	83 d6 00             	adc    $0x0,%esi
+  805041:	f7 de                	neg    %esi
+  805043:	0f 48 e8             	cmovs  %eax,%ebp
+  805046:	0f 49 d6             	cmovns %esi,%edx
+  805049:	6a 00                	push   $0x0
+  80504b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80504f:	f7 de                	neg    %esi
+  805051:	8b 44 24 34          	mov    0x34(%esp),%eax
+  805055:	83 d0 00             	adc    $0x0,%eax
+  805058:	f7 d8                	neg    %eax
+  80505a:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  80505f:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  805064:	50                   	push   %eax
+  805065:	56                   	push   %esi
+  805066:	89 e8                	mov    %ebp,%eax
+  805068:	e8 92 fe ff ff       	call   804eff <udivmod>
+  80506d:	83 c4 10             	add    $0x10,%esp
+  805070:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  805075:	78 08                	js     80507f <__divdi3+0x6a>
+  805077:	83 c4 0c             	add    $0xc,%esp
+  80507a:	5b                   	pop    %ebx
+  80507b:	5e                   	pop    %esi
+  80507c:	5f                   	pop    %edi
+  80507d:	5d                   	pop    %ebp
+  80507e:	c3                   	ret
+  80507f:	f7 d8                	neg    %eax
+  805081:	83 d2 00             	adc    $0x0,%edx
+  805084:	f7 da                	neg    %edx
+  805086:	eb ef                	jmp    805077 <__divdi3+0x62>
+
+00805088 <__moddi3>:
+  805088:	55                   	push   %ebp
+  805089:	57                   	push   %edi
+  80508a:	56                   	push   %esi
+  80508b:	53                   	push   %ebx
+  80508c:	83 ec 18             	sub    $0x18,%esp
+  80508f:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  805093:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  805097:	89 f1                	mov    %esi,%ecx
+  805099:	f7 d9                	neg    %ecx
+  80509b:	89 da                	mov    %ebx,%edx
+  80509d:	83 d2 00             	adc    $0x0,%edx
+  8050a0:	f7 da                	neg    %edx
+  8050a2:	0f 48 ce             	cmovs  %esi,%ecx
+  8050a5:	0f 48 d3             	cmovs  %ebx,%edx
+  8050a8:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8050ac:	50                   	push   %eax
+  8050ad:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8050b1:	f7 de                	neg    %esi
+  8050b3:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8050b7:	83 d0 00             	adc    $0x0,%eax
+  8050ba:	f7 d8                	neg    %eax
+  8050bc:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8050c1:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8050c6:	50                   	push   %eax
+  8050c7:	56                   	push   %esi
+  8050c8:	89 c8                	mov    %ecx,%eax
+  8050ca:	e8 30 fe ff ff       	call   804eff <udivmod>
+  8050cf:	83 c4 10             	add    $0x10,%esp
+  8050d2:	85 db                	test   %ebx,%ebx
+  8050d4:	78 10                	js     8050e6 <__moddi3+0x5e>
+  8050d6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8050da:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8050de:	83 c4 14             	add    $0x14,%esp
+  8050e1:	5b                   	pop    %ebx
+  8050e2:	5e                   	pop    %esi
+  8050e3:	5f                   	pop    %edi
+  8050e4:	5d                   	pop    %ebp
+  8050e5:	c3                   	ret
+  8050e6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8050ea:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8050ee:	f7 d8                	neg    %eax
+  8050f0:	83 d2 00             	adc    $0x0,%edx
+  8050f3:	f7 da                	neg    %edx
+  8050f5:	eb e7                	jmp    8050de <__moddi3+0x56>
@@ -0,0 +1,9973 @@
+
+obj/user/reverselinearpagein.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 37 01 00 00       	call   800168 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define SIZE 0x5000000
+#define BASE 0x10000000
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int r;
+	uintptr_t va;
+
+	if((r = page_alloc(0, (void*) 0x0f000000, PTE_P|PTE_U|PTE_W, 1)) < 0)
+  800042:	6a 01                	push   $0x1
+  800044:	6a 07                	push   $0x7
+  800046:	68 00 00 00 0f       	push   $0xf000000
+  80004b:	6a 00                	push   $0x0
+  80004d:	e8 30 35 00 00       	call   803582 <page_alloc>
+  800052:	83 c4 10             	add    $0x10,%esp
+  800055:	85 c0                	test   %eax,%eax
+  800057:	0f 88 af 00 00 00    	js     80010c <umain+0xd9>
+		panic("sys_page_alloc on %p: %e", (void*) 0x0f000000, r);
+	*((char*)0x0f000000) = argc > 0 ? argv[0][0] : 'r';
+  80005d:	b8 72 00 00 00       	mov    $0x72,%eax
+  800062:	85 f6                	test   %esi,%esi
+  800064:	7e 05                	jle    80006b <umain+0x38>
+  800066:	8b 07                	mov    (%edi),%eax
+  800068:	0f b6 00             	movzbl (%eax),%eax
+  80006b:	a2 00 00 00 0f       	mov    %al,0xf000000
+
+	for(va = BASE+SIZE-PGSIZE; va >= BASE; va-=PGSIZE){
+  800070:	bb 00 f0 ff 14       	mov    $0x14fff000,%ebx
+		//cprintf("[rs]+%x\n", va);
+		if((r = page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W, 1)) < 0)
+  800075:	6a 01                	push   $0x1
+  800077:	6a 07                	push   $0x7
+  800079:	53                   	push   %ebx
+  80007a:	6a 00                	push   $0x0
+  80007c:	e8 01 35 00 00       	call   803582 <page_alloc>
+  800081:	83 c4 10             	add    $0x10,%esp
+  800084:	85 c0                	test   %eax,%eax
+  800086:	0f 88 9a 00 00 00    	js     800126 <umain+0xf3>
+			panic("sys_page_alloc on %p: %e", va, r);
+
+		// Store the address in the page
+		*(uintptr_t*)va = (uintptr_t)va;
+  80008c:	89 1b                	mov    %ebx,(%ebx)
+	for(va = BASE+SIZE-PGSIZE; va >= BASE; va-=PGSIZE){
+  80008e:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  800094:	81 fb 00 f0 ff 0f    	cmp    $0xffff000,%ebx
+  80009a:	75 d9                	jne    800075 <umain+0x42>
+	}
+
+	for(va = BASE; va < BASE+SIZE; va+=PGSIZE){
+  80009c:	b8 00 00 00 10       	mov    $0x10000000,%eax
+		//cprintf("[rs]+%x=%x\n", va, *(uintptr_t*)va);
+		assert(*(uintptr_t*)va == (uintptr_t)va);
+  8000a1:	39 00                	cmp    %eax,(%eax)
+  8000a3:	0f 85 93 00 00 00    	jne    80013c <umain+0x109>
+	for(va = BASE; va < BASE+SIZE; va+=PGSIZE){
+  8000a9:	05 00 10 00 00       	add    $0x1000,%eax
+  8000ae:	3d 00 00 00 15       	cmp    $0x15000000,%eax
+  8000b3:	75 ec                	jne    8000a1 <umain+0x6e>
+	}
+	for(va = BASE+SIZE-PGSIZE; va >= BASE; va-=PGSIZE){
+  8000b5:	b8 00 f0 ff 14       	mov    $0x14fff000,%eax
+		//cprintf("[rs]+%x=%x\n", va, *(uintptr_t*)va);
+		assert(*(uintptr_t*)va == (uintptr_t)va);
+  8000ba:	39 00                	cmp    %eax,(%eax)
+  8000bc:	0f 85 90 00 00 00    	jne    800152 <umain+0x11f>
+	for(va = BASE+SIZE-PGSIZE; va >= BASE; va-=PGSIZE){
+  8000c2:	2d 00 10 00 00       	sub    $0x1000,%eax
+  8000c7:	3d 00 f0 ff 0f       	cmp    $0xffff000,%eax
+  8000cc:	75 ec                	jne    8000ba <umain+0x87>
+	}
+
+	sys_cputs((char*)0x0f000000, 1);
+  8000ce:	83 ec 08             	sub    $0x8,%esp
+  8000d1:	6a 01                	push   $0x1
+  8000d3:	68 00 00 00 0f       	push   $0xf000000
+  8000d8:	e8 d6 0b 00 00       	call   800cb3 <sys_cputs>
+
+	struct Pageret_stat *stats = (struct Pageret_stat *)0x0f000000;
+
+	cprintf("%s: Passed all checks!\n", argc > 0 ? &(argv[0][1]) : "everselinearpagein");
+  8000dd:	83 c4 10             	add    $0x10,%esp
+  8000e0:	b8 a0 4d 80 00       	mov    $0x804da0,%eax
+  8000e5:	85 f6                	test   %esi,%esi
+  8000e7:	7e 05                	jle    8000ee <umain+0xbb>
+  8000e9:	8b 07                	mov    (%edi),%eax
+  8000eb:	83 c0 01             	add    $0x1,%eax
+  8000ee:	83 ec 08             	sub    $0x8,%esp
+  8000f1:	50                   	push   %eax
+  8000f2:	68 e1 4d 80 00       	push   $0x804de1
+  8000f7:	e8 aa 01 00 00       	call   8002a6 <cprintf>
+	get_and_print_paging_stats();
+  8000fc:	e8 bb 30 00 00       	call   8031bc <get_and_print_paging_stats>
+}
+  800101:	83 c4 10             	add    $0x10,%esp
+  800104:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800107:	5b                   	pop    %ebx
+  800108:	5e                   	pop    %esi
+  800109:	5f                   	pop    %edi
+  80010a:	5d                   	pop    %ebp
+  80010b:	c3                   	ret
+		panic("sys_page_alloc on %p: %e", (void*) 0x0f000000, r);
+  80010c:	83 ec 0c             	sub    $0xc,%esp
+  80010f:	50                   	push   %eax
+  800110:	68 00 00 00 0f       	push   $0xf000000
+  800115:	68 b3 4d 80 00       	push   $0x804db3
+  80011a:	6a 12                	push   $0x12
+  80011c:	68 fc 4d 80 00       	push   $0x804dfc
+  800121:	e8 a5 00 00 00       	call   8001cb <_panic>
+			panic("sys_page_alloc on %p: %e", va, r);
+  800126:	83 ec 0c             	sub    $0xc,%esp
+  800129:	50                   	push   %eax
+  80012a:	53                   	push   %ebx
+  80012b:	68 b3 4d 80 00       	push   $0x804db3
+  800130:	6a 18                	push   $0x18
+  800132:	68 fc 4d 80 00       	push   $0x804dfc
+  800137:	e8 8f 00 00 00       	call   8001cb <_panic>
+		assert(*(uintptr_t*)va == (uintptr_t)va);
+  80013c:	68 24 4e 80 00       	push   $0x804e24
+  800141:	68 cc 4d 80 00       	push   $0x804dcc
+  800146:	6a 20                	push   $0x20
+  800148:	68 fc 4d 80 00       	push   $0x804dfc
+  80014d:	e8 79 00 00 00       	call   8001cb <_panic>
+		assert(*(uintptr_t*)va == (uintptr_t)va);
+  800152:	68 24 4e 80 00       	push   $0x804e24
+  800157:	68 cc 4d 80 00       	push   $0x804dcc
+  80015c:	6a 24                	push   $0x24
+  80015e:	68 fc 4d 80 00       	push   $0x804dfc
+  800163:	e8 63 00 00 00       	call   8001cb <_panic>
+
+00800168 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800168:	55                   	push   %ebp
+  800169:	89 e5                	mov    %esp,%ebp
+  80016b:	56                   	push   %esi
+  80016c:	53                   	push   %ebx
+  80016d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800170:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800173:	e8 ca 0b 00 00       	call   800d42 <sys_getenvid>
+  800178:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80017d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800180:	c1 e0 06             	shl    $0x6,%eax
+  800183:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800188:	a3 18 e9 80 00       	mov    %eax,0x80e918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80018d:	85 db                	test   %ebx,%ebx
+  80018f:	7e 07                	jle    800198 <libmain+0x30>
+		binaryname = argv[0];
+  800191:	8b 06                	mov    (%esi),%eax
+  800193:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800198:	83 ec 08             	sub    $0x8,%esp
+  80019b:	56                   	push   %esi
+  80019c:	53                   	push   %ebx
+  80019d:	e8 91 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8001a2:	e8 0a 00 00 00       	call   8001b1 <exit>
+}
+  8001a7:	83 c4 10             	add    $0x10,%esp
+  8001aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001ad:	5b                   	pop    %ebx
+  8001ae:	5e                   	pop    %esi
+  8001af:	5d                   	pop    %ebp
+  8001b0:	c3                   	ret
+
+008001b1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001b1:	55                   	push   %ebp
+  8001b2:	89 e5                	mov    %esp,%ebp
+  8001b4:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001b7:	e8 2a 13 00 00       	call   8014e6 <close_all>
+	sys_env_destroy(0);
+  8001bc:	83 ec 0c             	sub    $0xc,%esp
+  8001bf:	6a 00                	push   $0x0
+  8001c1:	e8 3b 0b 00 00       	call   800d01 <sys_env_destroy>
+}
+  8001c6:	83 c4 10             	add    $0x10,%esp
+  8001c9:	c9                   	leave
+  8001ca:	c3                   	ret
+
+008001cb <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001cb:	55                   	push   %ebp
+  8001cc:	89 e5                	mov    %esp,%ebp
+  8001ce:	56                   	push   %esi
+  8001cf:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001d0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001d3:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  8001d9:	e8 64 0b 00 00       	call   800d42 <sys_getenvid>
+  8001de:	83 ec 0c             	sub    $0xc,%esp
+  8001e1:	ff 75 0c             	push   0xc(%ebp)
+  8001e4:	ff 75 08             	push   0x8(%ebp)
+  8001e7:	56                   	push   %esi
+  8001e8:	50                   	push   %eax
+  8001e9:	68 50 4e 80 00       	push   $0x804e50
+  8001ee:	e8 b3 00 00 00       	call   8002a6 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001f3:	83 c4 18             	add    $0x18,%esp
+  8001f6:	53                   	push   %ebx
+  8001f7:	ff 75 10             	push   0x10(%ebp)
+  8001fa:	e8 56 00 00 00       	call   800255 <vcprintf>
+	cprintf("\n");
+  8001ff:	c7 04 24 f7 4d 80 00 	movl   $0x804df7,(%esp)
+  800206:	e8 9b 00 00 00       	call   8002a6 <cprintf>
+  80020b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80020e:	cc                   	int3
+	while (1)
+  80020f:	eb fd                	jmp    80020e <_panic+0x43>
+
+00800211 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800211:	55                   	push   %ebp
+  800212:	89 e5                	mov    %esp,%ebp
+  800214:	53                   	push   %ebx
+  800215:	83 ec 04             	sub    $0x4,%esp
+  800218:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80021b:	8b 13                	mov    (%ebx),%edx
+  80021d:	8d 42 01             	lea    0x1(%edx),%eax
+  800220:	89 03                	mov    %eax,(%ebx)
+  800222:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800225:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800229:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80022e:	74 09                	je     800239 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800230:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800234:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800237:	c9                   	leave
+  800238:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800239:	83 ec 08             	sub    $0x8,%esp
+  80023c:	68 ff 00 00 00       	push   $0xff
+  800241:	8d 43 08             	lea    0x8(%ebx),%eax
+  800244:	50                   	push   %eax
+  800245:	e8 69 0a 00 00       	call   800cb3 <sys_cputs>
+		b->idx = 0;
+  80024a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800250:	83 c4 10             	add    $0x10,%esp
+  800253:	eb db                	jmp    800230 <putch+0x1f>
+
+00800255 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800255:	55                   	push   %ebp
+  800256:	89 e5                	mov    %esp,%ebp
+  800258:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80025e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800265:	00 00 00 
+	b.cnt = 0;
+  800268:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80026f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800272:	ff 75 0c             	push   0xc(%ebp)
+  800275:	ff 75 08             	push   0x8(%ebp)
+  800278:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80027e:	50                   	push   %eax
+  80027f:	68 11 02 80 00       	push   $0x800211
+  800284:	e8 14 01 00 00       	call   80039d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800289:	83 c4 08             	add    $0x8,%esp
+  80028c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800292:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800298:	50                   	push   %eax
+  800299:	e8 15 0a 00 00       	call   800cb3 <sys_cputs>
+
+	return b.cnt;
+}
+  80029e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002a4:	c9                   	leave
+  8002a5:	c3                   	ret
+
+008002a6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002a6:	55                   	push   %ebp
+  8002a7:	89 e5                	mov    %esp,%ebp
+  8002a9:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002ac:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002af:	50                   	push   %eax
+  8002b0:	ff 75 08             	push   0x8(%ebp)
+  8002b3:	e8 9d ff ff ff       	call   800255 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002b8:	c9                   	leave
+  8002b9:	c3                   	ret
+
+008002ba <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002ba:	55                   	push   %ebp
+  8002bb:	89 e5                	mov    %esp,%ebp
+  8002bd:	57                   	push   %edi
+  8002be:	56                   	push   %esi
+  8002bf:	53                   	push   %ebx
+  8002c0:	83 ec 1c             	sub    $0x1c,%esp
+  8002c3:	89 c7                	mov    %eax,%edi
+  8002c5:	89 d6                	mov    %edx,%esi
+  8002c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002cd:	89 d1                	mov    %edx,%ecx
+  8002cf:	89 c2                	mov    %eax,%edx
+  8002d1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002d4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002d7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002da:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002e0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002e7:	39 c2                	cmp    %eax,%edx
+  8002e9:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002ec:	72 3e                	jb     80032c <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002ee:	83 ec 0c             	sub    $0xc,%esp
+  8002f1:	ff 75 18             	push   0x18(%ebp)
+  8002f4:	83 eb 01             	sub    $0x1,%ebx
+  8002f7:	53                   	push   %ebx
+  8002f8:	50                   	push   %eax
+  8002f9:	83 ec 08             	sub    $0x8,%esp
+  8002fc:	ff 75 e4             	push   -0x1c(%ebp)
+  8002ff:	ff 75 e0             	push   -0x20(%ebp)
+  800302:	ff 75 dc             	push   -0x24(%ebp)
+  800305:	ff 75 d8             	push   -0x28(%ebp)
+  800308:	e8 4e 49 00 00       	call   804c5b <__udivdi3>
+  80030d:	83 c4 18             	add    $0x18,%esp
+  800310:	52                   	push   %edx
+  800311:	50                   	push   %eax
+  800312:	89 f2                	mov    %esi,%edx
+  800314:	89 f8                	mov    %edi,%eax
+  800316:	e8 9f ff ff ff       	call   8002ba <printnum>
+  80031b:	83 c4 20             	add    $0x20,%esp
+  80031e:	eb 13                	jmp    800333 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800320:	83 ec 08             	sub    $0x8,%esp
+  800323:	56                   	push   %esi
+  800324:	ff 75 18             	push   0x18(%ebp)
+  800327:	ff d7                	call   *%edi
+  800329:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80032c:	83 eb 01             	sub    $0x1,%ebx
+  80032f:	85 db                	test   %ebx,%ebx
+  800331:	7f ed                	jg     800320 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800333:	83 ec 08             	sub    $0x8,%esp
+  800336:	56                   	push   %esi
+  800337:	83 ec 04             	sub    $0x4,%esp
+  80033a:	ff 75 e4             	push   -0x1c(%ebp)
+  80033d:	ff 75 e0             	push   -0x20(%ebp)
+  800340:	ff 75 dc             	push   -0x24(%ebp)
+  800343:	ff 75 d8             	push   -0x28(%ebp)
+  800346:	e8 2e 49 00 00       	call   804c79 <__umoddi3>
+  80034b:	83 c4 14             	add    $0x14,%esp
+  80034e:	0f be 80 73 4e 80 00 	movsbl 0x804e73(%eax),%eax
+  800355:	50                   	push   %eax
+  800356:	ff d7                	call   *%edi
+}
+  800358:	83 c4 10             	add    $0x10,%esp
+  80035b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80035e:	5b                   	pop    %ebx
+  80035f:	5e                   	pop    %esi
+  800360:	5f                   	pop    %edi
+  800361:	5d                   	pop    %ebp
+  800362:	c3                   	ret
+
+00800363 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800363:	55                   	push   %ebp
+  800364:	89 e5                	mov    %esp,%ebp
+  800366:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800369:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80036d:	8b 10                	mov    (%eax),%edx
+  80036f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800372:	73 0a                	jae    80037e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800374:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800377:	89 08                	mov    %ecx,(%eax)
+  800379:	8b 45 08             	mov    0x8(%ebp),%eax
+  80037c:	88 02                	mov    %al,(%edx)
+}
+  80037e:	5d                   	pop    %ebp
+  80037f:	c3                   	ret
+
+00800380 <printfmt>:
+{
+  800380:	55                   	push   %ebp
+  800381:	89 e5                	mov    %esp,%ebp
+  800383:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800386:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800389:	50                   	push   %eax
+  80038a:	ff 75 10             	push   0x10(%ebp)
+  80038d:	ff 75 0c             	push   0xc(%ebp)
+  800390:	ff 75 08             	push   0x8(%ebp)
+  800393:	e8 05 00 00 00       	call   80039d <vprintfmt>
+}
+  800398:	83 c4 10             	add    $0x10,%esp
+  80039b:	c9                   	leave
+  80039c:	c3                   	ret
+
+0080039d <vprintfmt>:
+{
+  80039d:	55                   	push   %ebp
+  80039e:	89 e5                	mov    %esp,%ebp
+  8003a0:	57                   	push   %edi
+  8003a1:	56                   	push   %esi
+  8003a2:	53                   	push   %ebx
+  8003a3:	83 ec 2c             	sub    $0x2c,%esp
+  8003a6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003ac:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003af:	eb 0a                	jmp    8003bb <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003b1:	83 ec 08             	sub    $0x8,%esp
+  8003b4:	53                   	push   %ebx
+  8003b5:	50                   	push   %eax
+  8003b6:	ff d6                	call   *%esi
+  8003b8:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003bb:	83 c7 01             	add    $0x1,%edi
+  8003be:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003c2:	83 f8 25             	cmp    $0x25,%eax
+  8003c5:	74 0c                	je     8003d3 <vprintfmt+0x36>
+			if (ch == '\0')
+  8003c7:	85 c0                	test   %eax,%eax
+  8003c9:	75 e6                	jne    8003b1 <vprintfmt+0x14>
+}
+  8003cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ce:	5b                   	pop    %ebx
+  8003cf:	5e                   	pop    %esi
+  8003d0:	5f                   	pop    %edi
+  8003d1:	5d                   	pop    %ebp
+  8003d2:	c3                   	ret
+		padc = ' ';
+  8003d3:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003d7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003de:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003e5:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f1:	8d 47 01             	lea    0x1(%edi),%eax
+  8003f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003f7:	0f b6 17             	movzbl (%edi),%edx
+  8003fa:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003fd:	3c 55                	cmp    $0x55,%al
+  8003ff:	0f 87 c5 03 00 00    	ja     8007ca <vprintfmt+0x42d>
+  800405:	0f b6 c0             	movzbl %al,%eax
+  800408:	ff 24 85 00 50 80 00 	jmp    *0x805000(,%eax,4)
+  80040f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800412:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800416:	eb d9                	jmp    8003f1 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800418:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80041b:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80041f:	eb d0                	jmp    8003f1 <vprintfmt+0x54>
+  800421:	0f b6 d2             	movzbl %dl,%edx
+  800424:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80042f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800432:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800436:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800439:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80043c:	83 f9 09             	cmp    $0x9,%ecx
+  80043f:	77 55                	ja     800496 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800441:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800444:	eb e9                	jmp    80042f <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800446:	8b 45 14             	mov    0x14(%ebp),%eax
+  800449:	8b 00                	mov    (%eax),%eax
+  80044b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80044e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800451:	8d 40 04             	lea    0x4(%eax),%eax
+  800454:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800457:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80045a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80045e:	79 91                	jns    8003f1 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800460:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800463:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800466:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80046d:	eb 82                	jmp    8003f1 <vprintfmt+0x54>
+			if (width < 0)
+  80046f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800472:	85 d2                	test   %edx,%edx
+  800474:	b8 00 00 00 00       	mov    $0x0,%eax
+  800479:	0f 49 c2             	cmovns %edx,%eax
+  80047c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80047f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800482:	e9 6a ff ff ff       	jmp    8003f1 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800487:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80048a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800491:	e9 5b ff ff ff       	jmp    8003f1 <vprintfmt+0x54>
+  800496:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800499:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80049c:	eb bc                	jmp    80045a <vprintfmt+0xbd>
+			lflag++;
+  80049e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004a4:	e9 48 ff ff ff       	jmp    8003f1 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ac:	8d 78 04             	lea    0x4(%eax),%edi
+  8004af:	83 ec 08             	sub    $0x8,%esp
+  8004b2:	53                   	push   %ebx
+  8004b3:	ff 30                	push   (%eax)
+  8004b5:	ff d6                	call   *%esi
+			break;
+  8004b7:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004ba:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004bd:	e9 63 02 00 00       	jmp    800725 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8004c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c5:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004c8:	8b 10                	mov    (%eax),%edx
+  8004ca:	89 d0                	mov    %edx,%eax
+  8004cc:	f7 d8                	neg    %eax
+  8004ce:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004d1:	83 f8 12             	cmp    $0x12,%eax
+  8004d4:	7f 23                	jg     8004f9 <vprintfmt+0x15c>
+  8004d6:	8b 14 85 60 51 80 00 	mov    0x805160(,%eax,4),%edx
+  8004dd:	85 d2                	test   %edx,%edx
+  8004df:	74 18                	je     8004f9 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004e1:	52                   	push   %edx
+  8004e2:	68 de 4d 80 00       	push   $0x804dde
+  8004e7:	53                   	push   %ebx
+  8004e8:	56                   	push   %esi
+  8004e9:	e8 92 fe ff ff       	call   800380 <printfmt>
+  8004ee:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004f1:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004f4:	e9 2c 02 00 00       	jmp    800725 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  8004f9:	50                   	push   %eax
+  8004fa:	68 8b 4e 80 00       	push   $0x804e8b
+  8004ff:	53                   	push   %ebx
+  800500:	56                   	push   %esi
+  800501:	e8 7a fe ff ff       	call   800380 <printfmt>
+  800506:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800509:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80050c:	e9 14 02 00 00       	jmp    800725 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800511:	8b 45 14             	mov    0x14(%ebp),%eax
+  800514:	83 c0 04             	add    $0x4,%eax
+  800517:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80051a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051d:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80051f:	85 c9                	test   %ecx,%ecx
+  800521:	b8 84 4e 80 00       	mov    $0x804e84,%eax
+  800526:	0f 45 c1             	cmovne %ecx,%eax
+  800529:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80052c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800530:	7e 06                	jle    800538 <vprintfmt+0x19b>
+  800532:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800536:	75 0b                	jne    800543 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800538:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80053b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80053e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800541:	eb 5c                	jmp    80059f <vprintfmt+0x202>
+  800543:	83 ec 08             	sub    $0x8,%esp
+  800546:	ff 75 d0             	push   -0x30(%ebp)
+  800549:	ff 75 cc             	push   -0x34(%ebp)
+  80054c:	e8 19 03 00 00       	call   80086a <strnlen>
+  800551:	89 c2                	mov    %eax,%edx
+  800553:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800556:	29 d0                	sub    %edx,%eax
+  800558:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80055b:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80055f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800562:	89 75 08             	mov    %esi,0x8(%ebp)
+  800565:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800567:	eb 0e                	jmp    800577 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800569:	83 ec 08             	sub    $0x8,%esp
+  80056c:	53                   	push   %ebx
+  80056d:	57                   	push   %edi
+  80056e:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800571:	83 ee 01             	sub    $0x1,%esi
+  800574:	83 c4 10             	add    $0x10,%esp
+  800577:	85 f6                	test   %esi,%esi
+  800579:	7f ee                	jg     800569 <vprintfmt+0x1cc>
+  80057b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80057e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800581:	85 c0                	test   %eax,%eax
+  800583:	ba 00 00 00 00       	mov    $0x0,%edx
+  800588:	0f 49 d0             	cmovns %eax,%edx
+  80058b:	29 d0                	sub    %edx,%eax
+  80058d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800590:	eb a6                	jmp    800538 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800592:	83 ec 08             	sub    $0x8,%esp
+  800595:	53                   	push   %ebx
+  800596:	52                   	push   %edx
+  800597:	ff 55 08             	call   *0x8(%ebp)
+  80059a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80059d:	89 f1                	mov    %esi,%ecx
+  80059f:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005a2:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005a6:	0f be d0             	movsbl %al,%edx
+  8005a9:	85 d2                	test   %edx,%edx
+  8005ab:	74 28                	je     8005d5 <vprintfmt+0x238>
+  8005ad:	85 ff                	test   %edi,%edi
+  8005af:	78 05                	js     8005b6 <vprintfmt+0x219>
+  8005b1:	83 ef 01             	sub    $0x1,%edi
+  8005b4:	78 30                	js     8005e6 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005b6:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005ba:	74 d6                	je     800592 <vprintfmt+0x1f5>
+  8005bc:	0f be c0             	movsbl %al,%eax
+  8005bf:	83 e8 20             	sub    $0x20,%eax
+  8005c2:	83 f8 5e             	cmp    $0x5e,%eax
+  8005c5:	76 cb                	jbe    800592 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005c7:	83 ec 08             	sub    $0x8,%esp
+  8005ca:	53                   	push   %ebx
+  8005cb:	6a 3f                	push   $0x3f
+  8005cd:	ff 55 08             	call   *0x8(%ebp)
+  8005d0:	83 c4 10             	add    $0x10,%esp
+  8005d3:	eb c8                	jmp    80059d <vprintfmt+0x200>
+  8005d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005d8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005db:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005de:	01 d0                	add    %edx,%eax
+  8005e0:	29 c8                	sub    %ecx,%eax
+  8005e2:	89 c7                	mov    %eax,%edi
+  8005e4:	eb 13                	jmp    8005f9 <vprintfmt+0x25c>
+  8005e6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e9:	eb ed                	jmp    8005d8 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005eb:	83 ec 08             	sub    $0x8,%esp
+  8005ee:	53                   	push   %ebx
+  8005ef:	6a 20                	push   $0x20
+  8005f1:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005f3:	83 ef 01             	sub    $0x1,%edi
+  8005f6:	83 c4 10             	add    $0x10,%esp
+  8005f9:	85 ff                	test   %edi,%edi
+  8005fb:	7f ee                	jg     8005eb <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005fd:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800600:	89 45 14             	mov    %eax,0x14(%ebp)
+  800603:	e9 1d 01 00 00       	jmp    800725 <vprintfmt+0x388>
+	if (lflag >= 2)
+  800608:	83 f9 01             	cmp    $0x1,%ecx
+  80060b:	7f 1b                	jg     800628 <vprintfmt+0x28b>
+	else if (lflag)
+  80060d:	85 c9                	test   %ecx,%ecx
+  80060f:	74 63                	je     800674 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800611:	8b 45 14             	mov    0x14(%ebp),%eax
+  800614:	8b 00                	mov    (%eax),%eax
+  800616:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800619:	99                   	cltd
+  80061a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80061d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800620:	8d 40 04             	lea    0x4(%eax),%eax
+  800623:	89 45 14             	mov    %eax,0x14(%ebp)
+  800626:	eb 17                	jmp    80063f <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  800628:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062b:	8b 50 04             	mov    0x4(%eax),%edx
+  80062e:	8b 00                	mov    (%eax),%eax
+  800630:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800633:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800636:	8b 45 14             	mov    0x14(%ebp),%eax
+  800639:	8d 40 08             	lea    0x8(%eax),%eax
+  80063c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80063f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800642:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800645:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80064a:	85 c9                	test   %ecx,%ecx
+  80064c:	0f 89 b9 00 00 00    	jns    80070b <vprintfmt+0x36e>
+				putch('-', putdat);
+  800652:	83 ec 08             	sub    $0x8,%esp
+  800655:	53                   	push   %ebx
+  800656:	6a 2d                	push   $0x2d
+  800658:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80065a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80065d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800660:	f7 da                	neg    %edx
+  800662:	83 d1 00             	adc    $0x0,%ecx
+  800665:	f7 d9                	neg    %ecx
+  800667:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80066a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80066f:	e9 97 00 00 00       	jmp    80070b <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800674:	8b 45 14             	mov    0x14(%ebp),%eax
+  800677:	8b 00                	mov    (%eax),%eax
+  800679:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80067c:	99                   	cltd
+  80067d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800680:	8b 45 14             	mov    0x14(%ebp),%eax
+  800683:	8d 40 04             	lea    0x4(%eax),%eax
+  800686:	89 45 14             	mov    %eax,0x14(%ebp)
+  800689:	eb b4                	jmp    80063f <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  80068b:	83 f9 01             	cmp    $0x1,%ecx
+  80068e:	7f 1b                	jg     8006ab <vprintfmt+0x30e>
+	else if (lflag)
+  800690:	85 c9                	test   %ecx,%ecx
+  800692:	74 2c                	je     8006c0 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800694:	8b 45 14             	mov    0x14(%ebp),%eax
+  800697:	8b 10                	mov    (%eax),%edx
+  800699:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069e:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006a4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006a9:	eb 60                	jmp    80070b <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8006ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ae:	8b 10                	mov    (%eax),%edx
+  8006b0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b3:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006b9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006be:	eb 4b                	jmp    80070b <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8006c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c3:	8b 10                	mov    (%eax),%edx
+  8006c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006d0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006d5:	eb 34                	jmp    80070b <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8006d7:	83 f9 01             	cmp    $0x1,%ecx
+  8006da:	7f 15                	jg     8006f1 <vprintfmt+0x354>
+	else if (lflag)
+  8006dc:	85 c9                	test   %ecx,%ecx
+  8006de:	74 4d                	je     80072d <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8006e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e3:	8b 00                	mov    (%eax),%eax
+  8006e5:	99                   	cltd
+  8006e6:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006e9:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8006ec:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8006ef:	eb 11                	jmp    800702 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  8006f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f4:	8b 50 04             	mov    0x4(%eax),%edx
+  8006f7:	8b 00                	mov    (%eax),%eax
+  8006f9:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006fc:	8d 49 08             	lea    0x8(%ecx),%ecx
+  8006ff:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800702:	89 d1                	mov    %edx,%ecx
+  800704:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800706:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80070b:	83 ec 0c             	sub    $0xc,%esp
+  80070e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800712:	50                   	push   %eax
+  800713:	ff 75 e0             	push   -0x20(%ebp)
+  800716:	57                   	push   %edi
+  800717:	51                   	push   %ecx
+  800718:	52                   	push   %edx
+  800719:	89 da                	mov    %ebx,%edx
+  80071b:	89 f0                	mov    %esi,%eax
+  80071d:	e8 98 fb ff ff       	call   8002ba <printnum>
+			break;
+  800722:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800725:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800728:	e9 8e fc ff ff       	jmp    8003bb <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  80072d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800730:	8b 00                	mov    (%eax),%eax
+  800732:	99                   	cltd
+  800733:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800736:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800739:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80073c:	eb c4                	jmp    800702 <vprintfmt+0x365>
+			putch('0', putdat);
+  80073e:	83 ec 08             	sub    $0x8,%esp
+  800741:	53                   	push   %ebx
+  800742:	6a 30                	push   $0x30
+  800744:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800746:	83 c4 08             	add    $0x8,%esp
+  800749:	53                   	push   %ebx
+  80074a:	6a 78                	push   $0x78
+  80074c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80074e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800751:	8b 10                	mov    (%eax),%edx
+  800753:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800758:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80075b:	8d 40 04             	lea    0x4(%eax),%eax
+  80075e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800761:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800766:	eb a3                	jmp    80070b <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800768:	83 f9 01             	cmp    $0x1,%ecx
+  80076b:	7f 1b                	jg     800788 <vprintfmt+0x3eb>
+	else if (lflag)
+  80076d:	85 c9                	test   %ecx,%ecx
+  80076f:	74 2f                	je     8007a0 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800771:	8b 45 14             	mov    0x14(%ebp),%eax
+  800774:	8b 10                	mov    (%eax),%edx
+  800776:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077b:	8d 40 04             	lea    0x4(%eax),%eax
+  80077e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800781:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800786:	eb 83                	jmp    80070b <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800788:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078b:	8b 10                	mov    (%eax),%edx
+  80078d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800790:	8d 40 08             	lea    0x8(%eax),%eax
+  800793:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800796:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80079b:	e9 6b ff ff ff       	jmp    80070b <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8007a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a3:	8b 10                	mov    (%eax),%edx
+  8007a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ad:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007b5:	e9 51 ff ff ff       	jmp    80070b <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8007ba:	83 ec 08             	sub    $0x8,%esp
+  8007bd:	53                   	push   %ebx
+  8007be:	6a 25                	push   $0x25
+  8007c0:	ff d6                	call   *%esi
+			break;
+  8007c2:	83 c4 10             	add    $0x10,%esp
+  8007c5:	e9 5b ff ff ff       	jmp    800725 <vprintfmt+0x388>
+			putch('%', putdat);
+  8007ca:	83 ec 08             	sub    $0x8,%esp
+  8007cd:	53                   	push   %ebx
+  8007ce:	6a 25                	push   $0x25
+  8007d0:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007d2:	83 c4 10             	add    $0x10,%esp
+  8007d5:	89 f8                	mov    %edi,%eax
+  8007d7:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007db:	74 05                	je     8007e2 <vprintfmt+0x445>
+  8007dd:	83 e8 01             	sub    $0x1,%eax
+  8007e0:	eb f5                	jmp    8007d7 <vprintfmt+0x43a>
+  8007e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007e5:	e9 3b ff ff ff       	jmp    800725 <vprintfmt+0x388>
+
+008007ea <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007ea:	55                   	push   %ebp
+  8007eb:	89 e5                	mov    %esp,%ebp
+  8007ed:	83 ec 18             	sub    $0x18,%esp
+  8007f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007f6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007f9:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007fd:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800800:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800807:	85 c0                	test   %eax,%eax
+  800809:	74 26                	je     800831 <vsnprintf+0x47>
+  80080b:	85 d2                	test   %edx,%edx
+  80080d:	7e 22                	jle    800831 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80080f:	ff 75 14             	push   0x14(%ebp)
+  800812:	ff 75 10             	push   0x10(%ebp)
+  800815:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800818:	50                   	push   %eax
+  800819:	68 63 03 80 00       	push   $0x800363
+  80081e:	e8 7a fb ff ff       	call   80039d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800823:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800826:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800829:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80082c:	83 c4 10             	add    $0x10,%esp
+}
+  80082f:	c9                   	leave
+  800830:	c3                   	ret
+		return -E_INVAL;
+  800831:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800836:	eb f7                	jmp    80082f <vsnprintf+0x45>
+
+00800838 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800838:	55                   	push   %ebp
+  800839:	89 e5                	mov    %esp,%ebp
+  80083b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80083e:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800841:	50                   	push   %eax
+  800842:	ff 75 10             	push   0x10(%ebp)
+  800845:	ff 75 0c             	push   0xc(%ebp)
+  800848:	ff 75 08             	push   0x8(%ebp)
+  80084b:	e8 9a ff ff ff       	call   8007ea <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800850:	c9                   	leave
+  800851:	c3                   	ret
+
+00800852 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800852:	55                   	push   %ebp
+  800853:	89 e5                	mov    %esp,%ebp
+  800855:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800858:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085d:	eb 03                	jmp    800862 <strlen+0x10>
+		n++;
+  80085f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800862:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800866:	75 f7                	jne    80085f <strlen+0xd>
+	return n;
+}
+  800868:	5d                   	pop    %ebp
+  800869:	c3                   	ret
+
+0080086a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80086a:	55                   	push   %ebp
+  80086b:	89 e5                	mov    %esp,%ebp
+  80086d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800870:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800873:	b8 00 00 00 00       	mov    $0x0,%eax
+  800878:	eb 03                	jmp    80087d <strnlen+0x13>
+		n++;
+  80087a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80087d:	39 d0                	cmp    %edx,%eax
+  80087f:	74 08                	je     800889 <strnlen+0x1f>
+  800881:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800885:	75 f3                	jne    80087a <strnlen+0x10>
+  800887:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800889:	89 d0                	mov    %edx,%eax
+  80088b:	5d                   	pop    %ebp
+  80088c:	c3                   	ret
+
+0080088d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80088d:	55                   	push   %ebp
+  80088e:	89 e5                	mov    %esp,%ebp
+  800890:	53                   	push   %ebx
+  800891:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800894:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800897:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008a0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008a3:	83 c0 01             	add    $0x1,%eax
+  8008a6:	84 d2                	test   %dl,%dl
+  8008a8:	75 f2                	jne    80089c <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008aa:	89 c8                	mov    %ecx,%eax
+  8008ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008af:	c9                   	leave
+  8008b0:	c3                   	ret
+
+008008b1 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008b1:	55                   	push   %ebp
+  8008b2:	89 e5                	mov    %esp,%ebp
+  8008b4:	53                   	push   %ebx
+  8008b5:	83 ec 10             	sub    $0x10,%esp
+  8008b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008bb:	53                   	push   %ebx
+  8008bc:	e8 91 ff ff ff       	call   800852 <strlen>
+  8008c1:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008c4:	ff 75 0c             	push   0xc(%ebp)
+  8008c7:	01 d8                	add    %ebx,%eax
+  8008c9:	50                   	push   %eax
+  8008ca:	e8 be ff ff ff       	call   80088d <strcpy>
+	return dst;
+}
+  8008cf:	89 d8                	mov    %ebx,%eax
+  8008d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008d4:	c9                   	leave
+  8008d5:	c3                   	ret
+
+008008d6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008d6:	55                   	push   %ebp
+  8008d7:	89 e5                	mov    %esp,%ebp
+  8008d9:	56                   	push   %esi
+  8008da:	53                   	push   %ebx
+  8008db:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008de:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008e1:	89 f3                	mov    %esi,%ebx
+  8008e3:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008e6:	89 f0                	mov    %esi,%eax
+  8008e8:	eb 0f                	jmp    8008f9 <strncpy+0x23>
+		*dst++ = *src;
+  8008ea:	83 c0 01             	add    $0x1,%eax
+  8008ed:	0f b6 0a             	movzbl (%edx),%ecx
+  8008f0:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008f3:	80 f9 01             	cmp    $0x1,%cl
+  8008f6:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008f9:	39 d8                	cmp    %ebx,%eax
+  8008fb:	75 ed                	jne    8008ea <strncpy+0x14>
+	}
+	return ret;
+}
+  8008fd:	89 f0                	mov    %esi,%eax
+  8008ff:	5b                   	pop    %ebx
+  800900:	5e                   	pop    %esi
+  800901:	5d                   	pop    %ebp
+  800902:	c3                   	ret
+
+00800903 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800903:	55                   	push   %ebp
+  800904:	89 e5                	mov    %esp,%ebp
+  800906:	56                   	push   %esi
+  800907:	53                   	push   %ebx
+  800908:	8b 75 08             	mov    0x8(%ebp),%esi
+  80090b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80090e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800911:	89 f0                	mov    %esi,%eax
+  800913:	85 d2                	test   %edx,%edx
+  800915:	74 21                	je     800938 <strlcpy+0x35>
+  800917:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80091b:	89 f2                	mov    %esi,%edx
+  80091d:	eb 09                	jmp    800928 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80091f:	83 c1 01             	add    $0x1,%ecx
+  800922:	83 c2 01             	add    $0x1,%edx
+  800925:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800928:	39 c2                	cmp    %eax,%edx
+  80092a:	74 09                	je     800935 <strlcpy+0x32>
+  80092c:	0f b6 19             	movzbl (%ecx),%ebx
+  80092f:	84 db                	test   %bl,%bl
+  800931:	75 ec                	jne    80091f <strlcpy+0x1c>
+  800933:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800935:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800938:	29 f0                	sub    %esi,%eax
+}
+  80093a:	5b                   	pop    %ebx
+  80093b:	5e                   	pop    %esi
+  80093c:	5d                   	pop    %ebp
+  80093d:	c3                   	ret
+
+0080093e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80093e:	55                   	push   %ebp
+  80093f:	89 e5                	mov    %esp,%ebp
+  800941:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800944:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800947:	eb 06                	jmp    80094f <strcmp+0x11>
+		p++, q++;
+  800949:	83 c1 01             	add    $0x1,%ecx
+  80094c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80094f:	0f b6 01             	movzbl (%ecx),%eax
+  800952:	84 c0                	test   %al,%al
+  800954:	74 04                	je     80095a <strcmp+0x1c>
+  800956:	3a 02                	cmp    (%edx),%al
+  800958:	74 ef                	je     800949 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80095a:	0f b6 c0             	movzbl %al,%eax
+  80095d:	0f b6 12             	movzbl (%edx),%edx
+  800960:	29 d0                	sub    %edx,%eax
+}
+  800962:	5d                   	pop    %ebp
+  800963:	c3                   	ret
+
+00800964 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800964:	55                   	push   %ebp
+  800965:	89 e5                	mov    %esp,%ebp
+  800967:	53                   	push   %ebx
+  800968:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80096e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800971:	eb 09                	jmp    80097c <strncmp+0x18>
+		n--, p++, q++;
+  800973:	83 ea 01             	sub    $0x1,%edx
+  800976:	83 c0 01             	add    $0x1,%eax
+  800979:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80097c:	85 d2                	test   %edx,%edx
+  80097e:	74 18                	je     800998 <strncmp+0x34>
+  800980:	0f b6 18             	movzbl (%eax),%ebx
+  800983:	84 db                	test   %bl,%bl
+  800985:	74 04                	je     80098b <strncmp+0x27>
+  800987:	3a 19                	cmp    (%ecx),%bl
+  800989:	74 e8                	je     800973 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80098b:	0f b6 00             	movzbl (%eax),%eax
+  80098e:	0f b6 11             	movzbl (%ecx),%edx
+  800991:	29 d0                	sub    %edx,%eax
+}
+  800993:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800996:	c9                   	leave
+  800997:	c3                   	ret
+		return 0;
+  800998:	b8 00 00 00 00       	mov    $0x0,%eax
+  80099d:	eb f4                	jmp    800993 <strncmp+0x2f>
+
+0080099f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80099f:	55                   	push   %ebp
+  8009a0:	89 e5                	mov    %esp,%ebp
+  8009a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009a9:	eb 03                	jmp    8009ae <strchr+0xf>
+  8009ab:	83 c0 01             	add    $0x1,%eax
+  8009ae:	0f b6 10             	movzbl (%eax),%edx
+  8009b1:	84 d2                	test   %dl,%dl
+  8009b3:	74 06                	je     8009bb <strchr+0x1c>
+		if (*s == c)
+  8009b5:	38 ca                	cmp    %cl,%dl
+  8009b7:	75 f2                	jne    8009ab <strchr+0xc>
+  8009b9:	eb 05                	jmp    8009c0 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009c0:	5d                   	pop    %ebp
+  8009c1:	c3                   	ret
+
+008009c2 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009c2:	55                   	push   %ebp
+  8009c3:	89 e5                	mov    %esp,%ebp
+  8009c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009cc:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009cf:	38 ca                	cmp    %cl,%dl
+  8009d1:	74 09                	je     8009dc <strfind+0x1a>
+  8009d3:	84 d2                	test   %dl,%dl
+  8009d5:	74 05                	je     8009dc <strfind+0x1a>
+	for (; *s; s++)
+  8009d7:	83 c0 01             	add    $0x1,%eax
+  8009da:	eb f0                	jmp    8009cc <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009dc:	5d                   	pop    %ebp
+  8009dd:	c3                   	ret
+
+008009de <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009de:	55                   	push   %ebp
+  8009df:	89 e5                	mov    %esp,%ebp
+  8009e1:	57                   	push   %edi
+  8009e2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009e5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009e8:	85 c9                	test   %ecx,%ecx
+  8009ea:	74 20                	je     800a0c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009ec:	89 f8                	mov    %edi,%eax
+  8009ee:	09 c8                	or     %ecx,%eax
+  8009f0:	a8 03                	test   $0x3,%al
+  8009f2:	75 12                	jne    800a06 <memset+0x28>
+		c &= 0xFF;
+  8009f4:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009f8:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009fe:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a01:	fc                   	cld
+  800a02:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a04:	eb 06                	jmp    800a0c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a06:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a09:	fc                   	cld
+  800a0a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a0c:	89 f8                	mov    %edi,%eax
+  800a0e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a11:	c9                   	leave
+  800a12:	c3                   	ret
+
+00800a13 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a13:	55                   	push   %ebp
+  800a14:	89 e5                	mov    %esp,%ebp
+  800a16:	57                   	push   %edi
+  800a17:	56                   	push   %esi
+  800a18:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a1e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a21:	39 c6                	cmp    %eax,%esi
+  800a23:	73 32                	jae    800a57 <memmove+0x44>
+  800a25:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a28:	39 d0                	cmp    %edx,%eax
+  800a2a:	73 2b                	jae    800a57 <memmove+0x44>
+		s += n;
+		d += n;
+  800a2c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a2f:	89 d6                	mov    %edx,%esi
+  800a31:	09 fe                	or     %edi,%esi
+  800a33:	09 ce                	or     %ecx,%esi
+  800a35:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a3b:	75 0e                	jne    800a4b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a3d:	83 ef 04             	sub    $0x4,%edi
+  800a40:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a43:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a46:	fd                   	std
+  800a47:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a49:	eb 09                	jmp    800a54 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a4b:	83 ef 01             	sub    $0x1,%edi
+  800a4e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a51:	fd                   	std
+  800a52:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a54:	fc                   	cld
+  800a55:	eb 1a                	jmp    800a71 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a57:	89 f2                	mov    %esi,%edx
+  800a59:	09 c2                	or     %eax,%edx
+  800a5b:	09 ca                	or     %ecx,%edx
+  800a5d:	f6 c2 03             	test   $0x3,%dl
+  800a60:	75 0a                	jne    800a6c <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a62:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a65:	89 c7                	mov    %eax,%edi
+  800a67:	fc                   	cld
+  800a68:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a6a:	eb 05                	jmp    800a71 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a6c:	89 c7                	mov    %eax,%edi
+  800a6e:	fc                   	cld
+  800a6f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a71:	5e                   	pop    %esi
+  800a72:	5f                   	pop    %edi
+  800a73:	5d                   	pop    %ebp
+  800a74:	c3                   	ret
+
+00800a75 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a75:	55                   	push   %ebp
+  800a76:	89 e5                	mov    %esp,%ebp
+  800a78:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a7b:	ff 75 10             	push   0x10(%ebp)
+  800a7e:	ff 75 0c             	push   0xc(%ebp)
+  800a81:	ff 75 08             	push   0x8(%ebp)
+  800a84:	e8 8a ff ff ff       	call   800a13 <memmove>
+}
+  800a89:	c9                   	leave
+  800a8a:	c3                   	ret
+
+00800a8b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a8b:	55                   	push   %ebp
+  800a8c:	89 e5                	mov    %esp,%ebp
+  800a8e:	56                   	push   %esi
+  800a8f:	53                   	push   %ebx
+  800a90:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a93:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a96:	89 c6                	mov    %eax,%esi
+  800a98:	03 75 10             	add    0x10(%ebp),%esi
+  800a9b:	eb 06                	jmp    800aa3 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a9d:	83 c0 01             	add    $0x1,%eax
+  800aa0:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800aa3:	39 f0                	cmp    %esi,%eax
+  800aa5:	74 14                	je     800abb <memcmp+0x30>
+		if (*s1 != *s2)
+  800aa7:	0f b6 08             	movzbl (%eax),%ecx
+  800aaa:	0f b6 1a             	movzbl (%edx),%ebx
+  800aad:	38 d9                	cmp    %bl,%cl
+  800aaf:	74 ec                	je     800a9d <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ab1:	0f b6 c1             	movzbl %cl,%eax
+  800ab4:	0f b6 db             	movzbl %bl,%ebx
+  800ab7:	29 d8                	sub    %ebx,%eax
+  800ab9:	eb 05                	jmp    800ac0 <memcmp+0x35>
+	}
+
+	return 0;
+  800abb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ac0:	5b                   	pop    %ebx
+  800ac1:	5e                   	pop    %esi
+  800ac2:	5d                   	pop    %ebp
+  800ac3:	c3                   	ret
+
+00800ac4 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ac4:	55                   	push   %ebp
+  800ac5:	89 e5                	mov    %esp,%ebp
+  800ac7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800acd:	89 c2                	mov    %eax,%edx
+  800acf:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ad2:	eb 03                	jmp    800ad7 <memfind+0x13>
+  800ad4:	83 c0 01             	add    $0x1,%eax
+  800ad7:	39 d0                	cmp    %edx,%eax
+  800ad9:	73 04                	jae    800adf <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800adb:	38 08                	cmp    %cl,(%eax)
+  800add:	75 f5                	jne    800ad4 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800adf:	5d                   	pop    %ebp
+  800ae0:	c3                   	ret
+
+00800ae1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ae1:	55                   	push   %ebp
+  800ae2:	89 e5                	mov    %esp,%ebp
+  800ae4:	57                   	push   %edi
+  800ae5:	56                   	push   %esi
+  800ae6:	53                   	push   %ebx
+  800ae7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800aed:	eb 03                	jmp    800af2 <strtol+0x11>
+		s++;
+  800aef:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800af2:	0f b6 02             	movzbl (%edx),%eax
+  800af5:	3c 20                	cmp    $0x20,%al
+  800af7:	74 f6                	je     800aef <strtol+0xe>
+  800af9:	3c 09                	cmp    $0x9,%al
+  800afb:	74 f2                	je     800aef <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800afd:	3c 2b                	cmp    $0x2b,%al
+  800aff:	74 2a                	je     800b2b <strtol+0x4a>
+	int neg = 0;
+  800b01:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b06:	3c 2d                	cmp    $0x2d,%al
+  800b08:	74 2b                	je     800b35 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b0a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b10:	75 0f                	jne    800b21 <strtol+0x40>
+  800b12:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b15:	74 28                	je     800b3f <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b17:	85 db                	test   %ebx,%ebx
+  800b19:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b1e:	0f 44 d8             	cmove  %eax,%ebx
+  800b21:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b26:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b29:	eb 46                	jmp    800b71 <strtol+0x90>
+		s++;
+  800b2b:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b33:	eb d5                	jmp    800b0a <strtol+0x29>
+		s++, neg = 1;
+  800b35:	83 c2 01             	add    $0x1,%edx
+  800b38:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b3d:	eb cb                	jmp    800b0a <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b3f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b43:	74 0e                	je     800b53 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b45:	85 db                	test   %ebx,%ebx
+  800b47:	75 d8                	jne    800b21 <strtol+0x40>
+		s++, base = 8;
+  800b49:	83 c2 01             	add    $0x1,%edx
+  800b4c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b51:	eb ce                	jmp    800b21 <strtol+0x40>
+		s += 2, base = 16;
+  800b53:	83 c2 02             	add    $0x2,%edx
+  800b56:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b5b:	eb c4                	jmp    800b21 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b5d:	0f be c0             	movsbl %al,%eax
+  800b60:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b63:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b66:	7d 3a                	jge    800ba2 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b68:	83 c2 01             	add    $0x1,%edx
+  800b6b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b6f:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b71:	0f b6 02             	movzbl (%edx),%eax
+  800b74:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b77:	89 f3                	mov    %esi,%ebx
+  800b79:	80 fb 09             	cmp    $0x9,%bl
+  800b7c:	76 df                	jbe    800b5d <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b7e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b81:	89 f3                	mov    %esi,%ebx
+  800b83:	80 fb 19             	cmp    $0x19,%bl
+  800b86:	77 08                	ja     800b90 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b88:	0f be c0             	movsbl %al,%eax
+  800b8b:	83 e8 57             	sub    $0x57,%eax
+  800b8e:	eb d3                	jmp    800b63 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b90:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b93:	89 f3                	mov    %esi,%ebx
+  800b95:	80 fb 19             	cmp    $0x19,%bl
+  800b98:	77 08                	ja     800ba2 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b9a:	0f be c0             	movsbl %al,%eax
+  800b9d:	83 e8 37             	sub    $0x37,%eax
+  800ba0:	eb c1                	jmp    800b63 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ba2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ba6:	74 05                	je     800bad <strtol+0xcc>
+		*endptr = (char *) s;
+  800ba8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bab:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800bad:	89 c8                	mov    %ecx,%eax
+  800baf:	f7 d8                	neg    %eax
+  800bb1:	85 ff                	test   %edi,%edi
+  800bb3:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bb6:	89 c8                	mov    %ecx,%eax
+  800bb8:	5b                   	pop    %ebx
+  800bb9:	5e                   	pop    %esi
+  800bba:	5f                   	pop    %edi
+  800bbb:	5d                   	pop    %ebp
+  800bbc:	c3                   	ret
+
+00800bbd <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800bbd:	55                   	push   %ebp
+  800bbe:	89 e5                	mov    %esp,%ebp
+  800bc0:	57                   	push   %edi
+  800bc1:	56                   	push   %esi
+  800bc2:	53                   	push   %ebx
+  800bc3:	83 ec 0c             	sub    $0xc,%esp
+  800bc6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800bc9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bcc:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800bcf:	85 ff                	test   %edi,%edi
+  800bd1:	74 16                	je     800be9 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800bd3:	83 ec 04             	sub    $0x4,%esp
+  800bd6:	56                   	push   %esi
+  800bd7:	6a 00                	push   $0x0
+  800bd9:	53                   	push   %ebx
+  800bda:	e8 02 ff ff ff       	call   800ae1 <strtol>
+  800bdf:	89 07                	mov    %eax,(%edi)
+  800be1:	83 c4 10             	add    $0x10,%esp
+  800be4:	eb 03                	jmp    800be9 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800be6:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800be9:	0f b6 03             	movzbl (%ebx),%eax
+  800bec:	3c 20                	cmp    $0x20,%al
+  800bee:	74 f6                	je     800be6 <strisl+0x29>
+  800bf0:	3c 09                	cmp    $0x9,%al
+  800bf2:	74 f2                	je     800be6 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bf4:	3c 2b                	cmp    $0x2b,%al
+  800bf6:	74 23                	je     800c1b <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800bf8:	3c 2d                	cmp    $0x2d,%al
+  800bfa:	0f 94 c0             	sete   %al
+  800bfd:	0f b6 c0             	movzbl %al,%eax
+  800c00:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c02:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800c08:	75 41                	jne    800c4b <strisl+0x8e>
+  800c0a:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800c0d:	74 11                	je     800c20 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c0f:	85 f6                	test   %esi,%esi
+  800c11:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c16:	0f 44 f0             	cmove  %eax,%esi
+  800c19:	eb 30                	jmp    800c4b <strisl+0x8e>
+		s++;
+  800c1b:	83 c3 01             	add    $0x1,%ebx
+  800c1e:	eb e2                	jmp    800c02 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c20:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800c24:	74 0e                	je     800c34 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800c26:	85 f6                	test   %esi,%esi
+  800c28:	75 21                	jne    800c4b <strisl+0x8e>
+		s++, base = 8;
+  800c2a:	83 c3 01             	add    $0x1,%ebx
+  800c2d:	be 08 00 00 00       	mov    $0x8,%esi
+  800c32:	eb 17                	jmp    800c4b <strisl+0x8e>
+		s += 2, base = 16;
+  800c34:	83 c3 02             	add    $0x2,%ebx
+  800c37:	be 10 00 00 00       	mov    $0x10,%esi
+  800c3c:	eb 0d                	jmp    800c4b <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c3e:	0f be c0             	movsbl %al,%eax
+  800c41:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800c44:	39 f0                	cmp    %esi,%eax
+  800c46:	7d 38                	jge    800c80 <strisl+0xc3>
+			return 0;
+		s++;
+  800c48:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800c4b:	0f b6 03             	movzbl (%ebx),%eax
+  800c4e:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800c51:	80 fa 09             	cmp    $0x9,%dl
+  800c54:	76 e8                	jbe    800c3e <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800c56:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800c59:	80 fa 19             	cmp    $0x19,%dl
+  800c5c:	77 08                	ja     800c66 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800c5e:	0f be c0             	movsbl %al,%eax
+  800c61:	83 e8 57             	sub    $0x57,%eax
+  800c64:	eb de                	jmp    800c44 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c66:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800c69:	80 fa 19             	cmp    $0x19,%dl
+  800c6c:	77 08                	ja     800c76 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800c6e:	0f be c0             	movsbl %al,%eax
+  800c71:	83 e8 37             	sub    $0x37,%eax
+  800c74:	eb ce                	jmp    800c44 <strisl+0x87>
+		else if (!*s)
+  800c76:	84 c0                	test   %al,%al
+  800c78:	0f 94 c0             	sete   %al
+  800c7b:	0f b6 c0             	movzbl %al,%eax
+  800c7e:	eb 05                	jmp    800c85 <strisl+0xc8>
+			return 0;
+  800c80:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800c85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c88:	5b                   	pop    %ebx
+  800c89:	5e                   	pop    %esi
+  800c8a:	5f                   	pop    %edi
+  800c8b:	5d                   	pop    %ebp
+  800c8c:	c3                   	ret
+
+00800c8d <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800c8d:	55                   	push   %ebp
+  800c8e:	89 e5                	mov    %esp,%ebp
+  800c90:	83 ec 10             	sub    $0x10,%esp
+  800c93:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c96:	89 c8                	mov    %ecx,%eax
+  800c98:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800c9d:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800ca0:	eb 0b                	jmp    800cad <touch_mem+0x20>
+		c = *(char *)page;
+  800ca2:	0f b6 10             	movzbl (%eax),%edx
+  800ca5:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800ca8:	05 00 10 00 00       	add    $0x1000,%eax
+  800cad:	39 c8                	cmp    %ecx,%eax
+  800caf:	72 f1                	jb     800ca2 <touch_mem+0x15>
+}
+  800cb1:	c9                   	leave
+  800cb2:	c3                   	ret
+
+00800cb3 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800cb3:	55                   	push   %ebp
+  800cb4:	89 e5                	mov    %esp,%ebp
+  800cb6:	57                   	push   %edi
+  800cb7:	56                   	push   %esi
+  800cb8:	53                   	push   %ebx
+	touch_mem(s, len);
+  800cb9:	ff 75 0c             	push   0xc(%ebp)
+  800cbc:	ff 75 08             	push   0x8(%ebp)
+  800cbf:	e8 c9 ff ff ff       	call   800c8d <touch_mem>
+	asm volatile("int %1\n"
+  800cc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ccc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ccf:	89 c3                	mov    %eax,%ebx
+  800cd1:	89 c7                	mov    %eax,%edi
+  800cd3:	89 c6                	mov    %eax,%esi
+  800cd5:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cd7:	83 c4 08             	add    $0x8,%esp
+  800cda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdd:	5b                   	pop    %ebx
+  800cde:	5e                   	pop    %esi
+  800cdf:	5f                   	pop    %edi
+  800ce0:	5d                   	pop    %ebp
+  800ce1:	c3                   	ret
+
+00800ce2 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ce2:	55                   	push   %ebp
+  800ce3:	89 e5                	mov    %esp,%ebp
+  800ce5:	57                   	push   %edi
+  800ce6:	56                   	push   %esi
+  800ce7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ce8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ced:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cf2:	89 d1                	mov    %edx,%ecx
+  800cf4:	89 d3                	mov    %edx,%ebx
+  800cf6:	89 d7                	mov    %edx,%edi
+  800cf8:	89 d6                	mov    %edx,%esi
+  800cfa:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cfc:	5b                   	pop    %ebx
+  800cfd:	5e                   	pop    %esi
+  800cfe:	5f                   	pop    %edi
+  800cff:	5d                   	pop    %ebp
+  800d00:	c3                   	ret
+
+00800d01 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d01:	55                   	push   %ebp
+  800d02:	89 e5                	mov    %esp,%ebp
+  800d04:	57                   	push   %edi
+  800d05:	56                   	push   %esi
+  800d06:	53                   	push   %ebx
+  800d07:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d12:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d17:	89 cb                	mov    %ecx,%ebx
+  800d19:	89 cf                	mov    %ecx,%edi
+  800d1b:	89 ce                	mov    %ecx,%esi
+  800d1d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d1f:	85 c0                	test   %eax,%eax
+  800d21:	7f 08                	jg     800d2b <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d26:	5b                   	pop    %ebx
+  800d27:	5e                   	pop    %esi
+  800d28:	5f                   	pop    %edi
+  800d29:	5d                   	pop    %ebp
+  800d2a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d2b:	83 ec 0c             	sub    $0xc,%esp
+  800d2e:	50                   	push   %eax
+  800d2f:	6a 03                	push   $0x3
+  800d31:	68 cb 51 80 00       	push   $0x8051cb
+  800d36:	6a 23                	push   $0x23
+  800d38:	68 e8 51 80 00       	push   $0x8051e8
+  800d3d:	e8 89 f4 ff ff       	call   8001cb <_panic>
+
+00800d42 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d42:	55                   	push   %ebp
+  800d43:	89 e5                	mov    %esp,%ebp
+  800d45:	57                   	push   %edi
+  800d46:	56                   	push   %esi
+  800d47:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d48:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d52:	89 d1                	mov    %edx,%ecx
+  800d54:	89 d3                	mov    %edx,%ebx
+  800d56:	89 d7                	mov    %edx,%edi
+  800d58:	89 d6                	mov    %edx,%esi
+  800d5a:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d5c:	5b                   	pop    %ebx
+  800d5d:	5e                   	pop    %esi
+  800d5e:	5f                   	pop    %edi
+  800d5f:	5d                   	pop    %ebp
+  800d60:	c3                   	ret
+
+00800d61 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d61:	55                   	push   %ebp
+  800d62:	89 e5                	mov    %esp,%ebp
+  800d64:	57                   	push   %edi
+  800d65:	56                   	push   %esi
+  800d66:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d6c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d71:	89 d1                	mov    %edx,%ecx
+  800d73:	89 d3                	mov    %edx,%ebx
+  800d75:	89 d7                	mov    %edx,%edi
+  800d77:	89 d6                	mov    %edx,%esi
+  800d79:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d7b:	5b                   	pop    %ebx
+  800d7c:	5e                   	pop    %esi
+  800d7d:	5f                   	pop    %edi
+  800d7e:	5d                   	pop    %ebp
+  800d7f:	c3                   	ret
+
+00800d80 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d80:	55                   	push   %ebp
+  800d81:	89 e5                	mov    %esp,%ebp
+  800d83:	57                   	push   %edi
+  800d84:	56                   	push   %esi
+  800d85:	53                   	push   %ebx
+  800d86:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d89:	be 00 00 00 00       	mov    $0x0,%esi
+  800d8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d94:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d99:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d9c:	89 f7                	mov    %esi,%edi
+  800d9e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800da0:	85 c0                	test   %eax,%eax
+  800da2:	7f 08                	jg     800dac <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800da4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da7:	5b                   	pop    %ebx
+  800da8:	5e                   	pop    %esi
+  800da9:	5f                   	pop    %edi
+  800daa:	5d                   	pop    %ebp
+  800dab:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dac:	83 ec 0c             	sub    $0xc,%esp
+  800daf:	50                   	push   %eax
+  800db0:	6a 04                	push   $0x4
+  800db2:	68 cb 51 80 00       	push   $0x8051cb
+  800db7:	6a 23                	push   $0x23
+  800db9:	68 e8 51 80 00       	push   $0x8051e8
+  800dbe:	e8 08 f4 ff ff       	call   8001cb <_panic>
+
+00800dc3 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800dc3:	55                   	push   %ebp
+  800dc4:	89 e5                	mov    %esp,%ebp
+  800dc6:	57                   	push   %edi
+  800dc7:	56                   	push   %esi
+  800dc8:	53                   	push   %ebx
+  800dc9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd2:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dd7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dda:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ddd:	8b 75 18             	mov    0x18(%ebp),%esi
+  800de0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de2:	85 c0                	test   %eax,%eax
+  800de4:	7f 08                	jg     800dee <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800de6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de9:	5b                   	pop    %ebx
+  800dea:	5e                   	pop    %esi
+  800deb:	5f                   	pop    %edi
+  800dec:	5d                   	pop    %ebp
+  800ded:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dee:	83 ec 0c             	sub    $0xc,%esp
+  800df1:	50                   	push   %eax
+  800df2:	6a 05                	push   $0x5
+  800df4:	68 cb 51 80 00       	push   $0x8051cb
+  800df9:	6a 23                	push   $0x23
+  800dfb:	68 e8 51 80 00       	push   $0x8051e8
+  800e00:	e8 c6 f3 ff ff       	call   8001cb <_panic>
+
+00800e05 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	57                   	push   %edi
+  800e09:	56                   	push   %esi
+  800e0a:	53                   	push   %ebx
+  800e0b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e19:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e1e:	89 df                	mov    %ebx,%edi
+  800e20:	89 de                	mov    %ebx,%esi
+  800e22:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e24:	85 c0                	test   %eax,%eax
+  800e26:	7f 08                	jg     800e30 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2b:	5b                   	pop    %ebx
+  800e2c:	5e                   	pop    %esi
+  800e2d:	5f                   	pop    %edi
+  800e2e:	5d                   	pop    %ebp
+  800e2f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e30:	83 ec 0c             	sub    $0xc,%esp
+  800e33:	50                   	push   %eax
+  800e34:	6a 06                	push   $0x6
+  800e36:	68 cb 51 80 00       	push   $0x8051cb
+  800e3b:	6a 23                	push   $0x23
+  800e3d:	68 e8 51 80 00       	push   $0x8051e8
+  800e42:	e8 84 f3 ff ff       	call   8001cb <_panic>
+
+00800e47 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800e47:	55                   	push   %ebp
+  800e48:	89 e5                	mov    %esp,%ebp
+  800e4a:	57                   	push   %edi
+  800e4b:	56                   	push   %esi
+  800e4c:	53                   	push   %ebx
+  800e4d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e55:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5b:	b8 18 00 00 00       	mov    $0x18,%eax
+  800e60:	89 df                	mov    %ebx,%edi
+  800e62:	89 de                	mov    %ebx,%esi
+  800e64:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e66:	85 c0                	test   %eax,%eax
+  800e68:	7f 08                	jg     800e72 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6d:	5b                   	pop    %ebx
+  800e6e:	5e                   	pop    %esi
+  800e6f:	5f                   	pop    %edi
+  800e70:	5d                   	pop    %ebp
+  800e71:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e72:	83 ec 0c             	sub    $0xc,%esp
+  800e75:	50                   	push   %eax
+  800e76:	6a 18                	push   $0x18
+  800e78:	68 cb 51 80 00       	push   $0x8051cb
+  800e7d:	6a 23                	push   $0x23
+  800e7f:	68 e8 51 80 00       	push   $0x8051e8
+  800e84:	e8 42 f3 ff ff       	call   8001cb <_panic>
+
+00800e89 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800e89:	55                   	push   %ebp
+  800e8a:	89 e5                	mov    %esp,%ebp
+  800e8c:	57                   	push   %edi
+  800e8d:	56                   	push   %esi
+  800e8e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e8f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9a:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea2:	89 f7                	mov    %esi,%edi
+  800ea4:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800ea6:	5b                   	pop    %ebx
+  800ea7:	5e                   	pop    %esi
+  800ea8:	5f                   	pop    %edi
+  800ea9:	5d                   	pop    %ebp
+  800eaa:	c3                   	ret
+
+00800eab <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800eab:	55                   	push   %ebp
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	57                   	push   %edi
+  800eaf:	56                   	push   %esi
+  800eb0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ebc:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec7:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800ec9:	5b                   	pop    %ebx
+  800eca:	5e                   	pop    %esi
+  800ecb:	5f                   	pop    %edi
+  800ecc:	5d                   	pop    %ebp
+  800ecd:	c3                   	ret
+
+00800ece <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800ece:	55                   	push   %ebp
+  800ecf:	89 e5                	mov    %esp,%ebp
+  800ed1:	57                   	push   %edi
+  800ed2:	56                   	push   %esi
+  800ed3:	53                   	push   %ebx
+  800ed4:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800ed7:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800eda:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800ee0:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800ee3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee9:	b8 10 00 00 00       	mov    $0x10,%eax
+  800eee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ef4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef6:	85 c0                	test   %eax,%eax
+  800ef8:	7f 08                	jg     800f02 <sys_page_map_range+0x34>
+}
+  800efa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800efd:	5b                   	pop    %ebx
+  800efe:	5e                   	pop    %esi
+  800eff:	5f                   	pop    %edi
+  800f00:	5d                   	pop    %ebp
+  800f01:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f02:	83 ec 0c             	sub    $0xc,%esp
+  800f05:	50                   	push   %eax
+  800f06:	6a 10                	push   $0x10
+  800f08:	68 cb 51 80 00       	push   $0x8051cb
+  800f0d:	6a 23                	push   $0x23
+  800f0f:	68 e8 51 80 00       	push   $0x8051e8
+  800f14:	e8 b2 f2 ff ff       	call   8001cb <_panic>
+
+00800f19 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f19:	55                   	push   %ebp
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	57                   	push   %edi
+  800f1d:	56                   	push   %esi
+  800f1e:	53                   	push   %ebx
+  800f1f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f22:	be 00 00 00 00       	mov    $0x0,%esi
+  800f27:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2d:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f35:	89 f7                	mov    %esi,%edi
+  800f37:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f39:	85 c0                	test   %eax,%eax
+  800f3b:	7f 08                	jg     800f45 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f40:	5b                   	pop    %ebx
+  800f41:	5e                   	pop    %esi
+  800f42:	5f                   	pop    %edi
+  800f43:	5d                   	pop    %ebp
+  800f44:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f45:	83 ec 0c             	sub    $0xc,%esp
+  800f48:	50                   	push   %eax
+  800f49:	6a 11                	push   $0x11
+  800f4b:	68 cb 51 80 00       	push   $0x8051cb
+  800f50:	6a 23                	push   $0x23
+  800f52:	68 e8 51 80 00       	push   $0x8051e8
+  800f57:	e8 6f f2 ff ff       	call   8001cb <_panic>
+
+00800f5c <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800f5c:	55                   	push   %ebp
+  800f5d:	89 e5                	mov    %esp,%ebp
+  800f5f:	57                   	push   %edi
+  800f60:	56                   	push   %esi
+  800f61:	53                   	push   %ebx
+  800f62:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f65:	be 00 00 00 00       	mov    $0x0,%esi
+  800f6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f70:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800f75:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f78:	89 f7                	mov    %esi,%edi
+  800f7a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f7c:	85 c0                	test   %eax,%eax
+  800f7e:	7f 08                	jg     800f88 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f83:	5b                   	pop    %ebx
+  800f84:	5e                   	pop    %esi
+  800f85:	5f                   	pop    %edi
+  800f86:	5d                   	pop    %ebp
+  800f87:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f88:	83 ec 0c             	sub    $0xc,%esp
+  800f8b:	50                   	push   %eax
+  800f8c:	6a 1b                	push   $0x1b
+  800f8e:	68 cb 51 80 00       	push   $0x8051cb
+  800f93:	6a 23                	push   $0x23
+  800f95:	68 e8 51 80 00       	push   $0x8051e8
+  800f9a:	e8 2c f2 ff ff       	call   8001cb <_panic>
+
+00800f9f <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800f9f:	55                   	push   %ebp
+  800fa0:	89 e5                	mov    %esp,%ebp
+  800fa2:	57                   	push   %edi
+  800fa3:	56                   	push   %esi
+  800fa4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fa5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800faa:	b8 12 00 00 00       	mov    $0x12,%eax
+  800faf:	89 d1                	mov    %edx,%ecx
+  800fb1:	89 d3                	mov    %edx,%ebx
+  800fb3:	89 d7                	mov    %edx,%edi
+  800fb5:	89 d6                	mov    %edx,%esi
+  800fb7:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800fb9:	5b                   	pop    %ebx
+  800fba:	5e                   	pop    %esi
+  800fbb:	5f                   	pop    %edi
+  800fbc:	5d                   	pop    %ebp
+  800fbd:	c3                   	ret
+
+00800fbe <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800fbe:	55                   	push   %ebp
+  800fbf:	89 e5                	mov    %esp,%ebp
+  800fc1:	57                   	push   %edi
+  800fc2:	56                   	push   %esi
+  800fc3:	53                   	push   %ebx
+  800fc4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd2:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fd7:	89 df                	mov    %ebx,%edi
+  800fd9:	89 de                	mov    %ebx,%esi
+  800fdb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fdd:	85 c0                	test   %eax,%eax
+  800fdf:	7f 08                	jg     800fe9 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800fe1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe4:	5b                   	pop    %ebx
+  800fe5:	5e                   	pop    %esi
+  800fe6:	5f                   	pop    %edi
+  800fe7:	5d                   	pop    %ebp
+  800fe8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe9:	83 ec 0c             	sub    $0xc,%esp
+  800fec:	50                   	push   %eax
+  800fed:	6a 08                	push   $0x8
+  800fef:	68 cb 51 80 00       	push   $0x8051cb
+  800ff4:	6a 23                	push   $0x23
+  800ff6:	68 e8 51 80 00       	push   $0x8051e8
+  800ffb:	e8 cb f1 ff ff       	call   8001cb <_panic>
+
+00801000 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	57                   	push   %edi
+  801004:	56                   	push   %esi
+  801005:	53                   	push   %ebx
+  801006:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  801009:	6a 44                	push   $0x44
+  80100b:	ff 75 0c             	push   0xc(%ebp)
+  80100e:	e8 7a fc ff ff       	call   800c8d <touch_mem>
+	asm volatile("int %1\n"
+  801013:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801018:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801020:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801023:	89 df                	mov    %ebx,%edi
+  801025:	89 de                	mov    %ebx,%esi
+  801027:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801029:	83 c4 08             	add    $0x8,%esp
+  80102c:	85 c0                	test   %eax,%eax
+  80102e:	7f 08                	jg     801038 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801030:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801033:	5b                   	pop    %ebx
+  801034:	5e                   	pop    %esi
+  801035:	5f                   	pop    %edi
+  801036:	5d                   	pop    %ebp
+  801037:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801038:	83 ec 0c             	sub    $0xc,%esp
+  80103b:	50                   	push   %eax
+  80103c:	6a 09                	push   $0x9
+  80103e:	68 cb 51 80 00       	push   $0x8051cb
+  801043:	6a 23                	push   $0x23
+  801045:	68 e8 51 80 00       	push   $0x8051e8
+  80104a:	e8 7c f1 ff ff       	call   8001cb <_panic>
+
+0080104f <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  80104f:	55                   	push   %ebp
+  801050:	89 e5                	mov    %esp,%ebp
+  801052:	57                   	push   %edi
+  801053:	56                   	push   %esi
+  801054:	53                   	push   %ebx
+  801055:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801058:	be 00 00 00 00       	mov    $0x0,%esi
+  80105d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801060:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801063:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801068:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80106b:	89 f7                	mov    %esi,%edi
+  80106d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80106f:	85 c0                	test   %eax,%eax
+  801071:	7f 08                	jg     80107b <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  801073:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801076:	5b                   	pop    %ebx
+  801077:	5e                   	pop    %esi
+  801078:	5f                   	pop    %edi
+  801079:	5d                   	pop    %ebp
+  80107a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107b:	83 ec 0c             	sub    $0xc,%esp
+  80107e:	50                   	push   %eax
+  80107f:	6a 1a                	push   $0x1a
+  801081:	68 cb 51 80 00       	push   $0x8051cb
+  801086:	6a 23                	push   $0x23
+  801088:	68 e8 51 80 00       	push   $0x8051e8
+  80108d:	e8 39 f1 ff ff       	call   8001cb <_panic>
+
+00801092 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  801092:	55                   	push   %ebp
+  801093:	89 e5                	mov    %esp,%ebp
+  801095:	57                   	push   %edi
+  801096:	56                   	push   %esi
+  801097:	53                   	push   %ebx
+  801098:	83 ec 0c             	sub    $0xc,%esp
+  80109b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  80109e:	89 d8                	mov    %ebx,%eax
+  8010a0:	c1 e0 05             	shl    $0x5,%eax
+  8010a3:	50                   	push   %eax
+  8010a4:	ff 75 0c             	push   0xc(%ebp)
+  8010a7:	e8 e1 fb ff ff       	call   800c8d <touch_mem>
+	asm volatile("int %1\n"
+  8010ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bc:	89 f7                	mov    %esi,%edi
+  8010be:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010c0:	83 c4 08             	add    $0x8,%esp
+  8010c3:	85 c0                	test   %eax,%eax
+  8010c5:	7f 08                	jg     8010cf <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8010c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ca:	5b                   	pop    %ebx
+  8010cb:	5e                   	pop    %esi
+  8010cc:	5f                   	pop    %edi
+  8010cd:	5d                   	pop    %ebp
+  8010ce:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010cf:	83 ec 0c             	sub    $0xc,%esp
+  8010d2:	50                   	push   %eax
+  8010d3:	6a 13                	push   $0x13
+  8010d5:	68 cb 51 80 00       	push   $0x8051cb
+  8010da:	6a 23                	push   $0x23
+  8010dc:	68 e8 51 80 00       	push   $0x8051e8
+  8010e1:	e8 e5 f0 ff ff       	call   8001cb <_panic>
+
+008010e6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010e6:	55                   	push   %ebp
+  8010e7:	89 e5                	mov    %esp,%ebp
+  8010e9:	57                   	push   %edi
+  8010ea:	56                   	push   %esi
+  8010eb:	53                   	push   %ebx
+  8010ec:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010ff:	89 df                	mov    %ebx,%edi
+  801101:	89 de                	mov    %ebx,%esi
+  801103:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801105:	85 c0                	test   %eax,%eax
+  801107:	7f 08                	jg     801111 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110c:	5b                   	pop    %ebx
+  80110d:	5e                   	pop    %esi
+  80110e:	5f                   	pop    %edi
+  80110f:	5d                   	pop    %ebp
+  801110:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801111:	83 ec 0c             	sub    $0xc,%esp
+  801114:	50                   	push   %eax
+  801115:	6a 0a                	push   $0xa
+  801117:	68 cb 51 80 00       	push   $0x8051cb
+  80111c:	6a 23                	push   $0x23
+  80111e:	68 e8 51 80 00       	push   $0x8051e8
+  801123:	e8 a3 f0 ff ff       	call   8001cb <_panic>
+
+00801128 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801128:	55                   	push   %ebp
+  801129:	89 e5                	mov    %esp,%ebp
+  80112b:	57                   	push   %edi
+  80112c:	56                   	push   %esi
+  80112d:	53                   	push   %ebx
+  80112e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801131:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801137:	76 1d                	jbe    801156 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  801139:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801144:	be 01 00 00 00       	mov    $0x1,%esi
+  801149:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80114c:	cd 30                	int    $0x30
+}
+  80114e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801151:	5b                   	pop    %ebx
+  801152:	5e                   	pop    %esi
+  801153:	5f                   	pop    %edi
+  801154:	5d                   	pop    %ebp
+  801155:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801156:	68 00 10 00 00       	push   $0x1000
+  80115b:	53                   	push   %ebx
+  80115c:	e8 2c fb ff ff       	call   800c8d <touch_mem>
+  801161:	83 c4 08             	add    $0x8,%esp
+  801164:	eb d3                	jmp    801139 <sys_ipc_send+0x11>
+
+00801166 <sys_ipc_send_pages>:
+{
+  801166:	55                   	push   %ebp
+  801167:	89 e5                	mov    %esp,%ebp
+  801169:	57                   	push   %edi
+  80116a:	56                   	push   %esi
+  80116b:	53                   	push   %ebx
+  80116c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80116f:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801172:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801178:	76 18                	jbe    801192 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80117a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801180:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801185:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801188:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  80118a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80118d:	5b                   	pop    %ebx
+  80118e:	5e                   	pop    %esi
+  80118f:	5f                   	pop    %edi
+  801190:	5d                   	pop    %ebp
+  801191:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801192:	89 f0                	mov    %esi,%eax
+  801194:	c1 e0 0c             	shl    $0xc,%eax
+  801197:	50                   	push   %eax
+  801198:	53                   	push   %ebx
+  801199:	e8 ef fa ff ff       	call   800c8d <touch_mem>
+  80119e:	83 c4 08             	add    $0x8,%esp
+  8011a1:	eb d7                	jmp    80117a <sys_ipc_send_pages+0x14>
+
+008011a3 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8011a3:	55                   	push   %ebp
+  8011a4:	89 e5                	mov    %esp,%ebp
+  8011a6:	57                   	push   %edi
+  8011a7:	56                   	push   %esi
+  8011a8:	53                   	push   %ebx
+  8011a9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011bc:	89 df                	mov    %ebx,%edi
+  8011be:	89 de                	mov    %ebx,%esi
+  8011c0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011c2:	85 c0                	test   %eax,%eax
+  8011c4:	7f 08                	jg     8011ce <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8011c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c9:	5b                   	pop    %ebx
+  8011ca:	5e                   	pop    %esi
+  8011cb:	5f                   	pop    %edi
+  8011cc:	5d                   	pop    %ebp
+  8011cd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ce:	83 ec 0c             	sub    $0xc,%esp
+  8011d1:	50                   	push   %eax
+  8011d2:	6a 0d                	push   $0xd
+  8011d4:	68 cb 51 80 00       	push   $0x8051cb
+  8011d9:	6a 23                	push   $0x23
+  8011db:	68 e8 51 80 00       	push   $0x8051e8
+  8011e0:	e8 e6 ef ff ff       	call   8001cb <_panic>
+
+008011e5 <sys_ipc_recv>:
+{
+  8011e5:	55                   	push   %ebp
+  8011e6:	89 e5                	mov    %esp,%ebp
+  8011e8:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8011eb:	6a 01                	push   $0x1
+  8011ed:	ff 75 08             	push   0x8(%ebp)
+  8011f0:	e8 ae ff ff ff       	call   8011a3 <sys_ipc_recv_pages>
+}
+  8011f5:	c9                   	leave
+  8011f6:	c3                   	ret
+
+008011f7 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8011f7:	55                   	push   %ebp
+  8011f8:	89 e5                	mov    %esp,%ebp
+  8011fa:	57                   	push   %edi
+  8011fb:	56                   	push   %esi
+  8011fc:	53                   	push   %ebx
+  8011fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801200:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801203:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801206:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80120c:	77 04                	ja     801212 <sys_ipc_call+0x1b>
+  80120e:	85 f6                	test   %esi,%esi
+  801210:	75 15                	jne    801227 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801212:	8b 55 08             	mov    0x8(%ebp),%edx
+  801215:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801218:	b8 14 00 00 00       	mov    $0x14,%eax
+  80121d:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80121f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801222:	5b                   	pop    %ebx
+  801223:	5e                   	pop    %esi
+  801224:	5f                   	pop    %edi
+  801225:	5d                   	pop    %ebp
+  801226:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  801227:	89 f8                	mov    %edi,%eax
+  801229:	c1 e0 0c             	shl    $0xc,%eax
+  80122c:	50                   	push   %eax
+  80122d:	53                   	push   %ebx
+  80122e:	e8 5a fa ff ff       	call   800c8d <touch_mem>
+  801233:	83 c4 08             	add    $0x8,%esp
+  801236:	eb da                	jmp    801212 <sys_ipc_call+0x1b>
+
+00801238 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801238:	55                   	push   %ebp
+  801239:	89 e5                	mov    %esp,%ebp
+  80123b:	57                   	push   %edi
+  80123c:	56                   	push   %esi
+  80123d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80123e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801241:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801244:	b8 15 00 00 00       	mov    $0x15,%eax
+  801249:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80124c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80124f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801252:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801254:	5b                   	pop    %ebx
+  801255:	5e                   	pop    %esi
+  801256:	5f                   	pop    %edi
+  801257:	5d                   	pop    %ebp
+  801258:	c3                   	ret
+
+00801259 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  801259:	55                   	push   %ebp
+  80125a:	89 e5                	mov    %esp,%ebp
+  80125c:	57                   	push   %edi
+  80125d:	56                   	push   %esi
+  80125e:	53                   	push   %ebx
+  80125f:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801262:	6a 04                	push   $0x4
+  801264:	ff 75 08             	push   0x8(%ebp)
+  801267:	e8 21 fa ff ff       	call   800c8d <touch_mem>
+	asm volatile("int %1\n"
+  80126c:	be 00 00 00 00       	mov    $0x0,%esi
+  801271:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801274:	b8 16 00 00 00       	mov    $0x16,%eax
+  801279:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80127f:	89 f7                	mov    %esi,%edi
+  801281:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801283:	83 c4 08             	add    $0x8,%esp
+  801286:	85 c0                	test   %eax,%eax
+  801288:	7f 08                	jg     801292 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  80128a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80128d:	5b                   	pop    %ebx
+  80128e:	5e                   	pop    %esi
+  80128f:	5f                   	pop    %edi
+  801290:	5d                   	pop    %ebp
+  801291:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801292:	83 ec 0c             	sub    $0xc,%esp
+  801295:	50                   	push   %eax
+  801296:	6a 16                	push   $0x16
+  801298:	68 cb 51 80 00       	push   $0x8051cb
+  80129d:	6a 23                	push   $0x23
+  80129f:	68 e8 51 80 00       	push   $0x8051e8
+  8012a4:	e8 22 ef ff ff       	call   8001cb <_panic>
+
+008012a9 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8012a9:	55                   	push   %ebp
+  8012aa:	89 e5                	mov    %esp,%ebp
+  8012ac:	57                   	push   %edi
+  8012ad:	56                   	push   %esi
+  8012ae:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8012af:	6a 04                	push   $0x4
+  8012b1:	ff 75 08             	push   0x8(%ebp)
+  8012b4:	e8 d4 f9 ff ff       	call   800c8d <touch_mem>
+	asm volatile("int %1\n"
+  8012b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c1:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c9:	89 df                	mov    %ebx,%edi
+  8012cb:	89 de                	mov    %ebx,%esi
+  8012cd:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8012cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d2:	5b                   	pop    %ebx
+  8012d3:	5e                   	pop    %esi
+  8012d4:	5f                   	pop    %edi
+  8012d5:	5d                   	pop    %ebp
+  8012d6:	c3                   	ret
+
+008012d7 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8012d7:	55                   	push   %ebp
+  8012d8:	89 e5                	mov    %esp,%ebp
+  8012da:	57                   	push   %edi
+  8012db:	56                   	push   %esi
+  8012dc:	53                   	push   %ebx
+  8012dd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012ed:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8012f2:	89 df                	mov    %ebx,%edi
+  8012f4:	89 de                	mov    %ebx,%esi
+  8012f6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012f8:	85 c0                	test   %eax,%eax
+  8012fa:	7f 08                	jg     801304 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  8012fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ff:	5b                   	pop    %ebx
+  801300:	5e                   	pop    %esi
+  801301:	5f                   	pop    %edi
+  801302:	5d                   	pop    %ebp
+  801303:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801304:	83 ec 0c             	sub    $0xc,%esp
+  801307:	50                   	push   %eax
+  801308:	6a 0e                	push   $0xe
+  80130a:	68 cb 51 80 00       	push   $0x8051cb
+  80130f:	6a 23                	push   $0x23
+  801311:	68 e8 51 80 00       	push   $0x8051e8
+  801316:	e8 b0 ee ff ff       	call   8001cb <_panic>
+
+0080131b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80131b:	55                   	push   %ebp
+  80131c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80131e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801321:	05 00 00 00 30       	add    $0x30000000,%eax
+  801326:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801329:	5d                   	pop    %ebp
+  80132a:	c3                   	ret
+
+0080132b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80132b:	55                   	push   %ebp
+  80132c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80132e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801331:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801336:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80133b:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801340:	5d                   	pop    %ebp
+  801341:	c3                   	ret
+
+00801342 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801342:	55                   	push   %ebp
+  801343:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801345:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  80134a:	a8 01                	test   $0x1,%al
+  80134c:	74 3c                	je     80138a <fd_alloc+0x48>
+  80134e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801353:	89 c2                	mov    %eax,%edx
+  801355:	c1 ea 0c             	shr    $0xc,%edx
+  801358:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80135f:	89 c1                	mov    %eax,%ecx
+  801361:	05 00 10 00 00       	add    $0x1000,%eax
+  801366:	f6 c2 01             	test   $0x1,%dl
+  801369:	74 13                	je     80137e <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80136b:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801370:	75 e1                	jne    801353 <fd_alloc+0x11>
+  801372:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801377:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80137c:	eb 05                	jmp    801383 <fd_alloc+0x41>
+			return 0;
+  80137e:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801383:	8b 55 08             	mov    0x8(%ebp),%edx
+  801386:	89 0a                	mov    %ecx,(%edx)
+}
+  801388:	5d                   	pop    %ebp
+  801389:	c3                   	ret
+  80138a:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  80138f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801394:	eb ed                	jmp    801383 <fd_alloc+0x41>
+
+00801396 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801396:	55                   	push   %ebp
+  801397:	89 e5                	mov    %esp,%ebp
+  801399:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80139c:	83 f8 1f             	cmp    $0x1f,%eax
+  80139f:	77 30                	ja     8013d1 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8013a1:	c1 e0 0c             	shl    $0xc,%eax
+  8013a4:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8013a9:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8013af:	f6 c2 01             	test   $0x1,%dl
+  8013b2:	74 24                	je     8013d8 <fd_lookup+0x42>
+  8013b4:	89 c2                	mov    %eax,%edx
+  8013b6:	c1 ea 0c             	shr    $0xc,%edx
+  8013b9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013c0:	f6 c2 01             	test   $0x1,%dl
+  8013c3:	74 1a                	je     8013df <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8013c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013c8:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8013ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013cf:	5d                   	pop    %ebp
+  8013d0:	c3                   	ret
+		return -E_INVAL;
+  8013d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013d6:	eb f7                	jmp    8013cf <fd_lookup+0x39>
+		return -E_INVAL;
+  8013d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013dd:	eb f0                	jmp    8013cf <fd_lookup+0x39>
+  8013df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013e4:	eb e9                	jmp    8013cf <fd_lookup+0x39>
+
+008013e6 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013e6:	55                   	push   %ebp
+  8013e7:	89 e5                	mov    %esp,%ebp
+  8013e9:	53                   	push   %ebx
+  8013ea:	83 ec 04             	sub    $0x4,%esp
+  8013ed:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8013f0:	b8 74 52 80 00       	mov    $0x805274,%eax
+  8013f5:	8b 18                	mov    (%eax),%ebx
+  8013f7:	85 db                	test   %ebx,%ebx
+  8013f9:	74 0e                	je     801409 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  8013fb:	83 c0 04             	add    $0x4,%eax
+  8013fe:	39 13                	cmp    %edx,(%ebx)
+  801400:	75 f3                	jne    8013f5 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801402:	b8 00 00 00 00       	mov    $0x0,%eax
+  801407:	eb 1f                	jmp    801428 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801409:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80140e:	8b 40 48             	mov    0x48(%eax),%eax
+  801411:	83 ec 04             	sub    $0x4,%esp
+  801414:	52                   	push   %edx
+  801415:	50                   	push   %eax
+  801416:	68 f8 51 80 00       	push   $0x8051f8
+  80141b:	e8 86 ee ff ff       	call   8002a6 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801420:	83 c4 10             	add    $0x10,%esp
+  801423:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801428:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80142b:	89 1a                	mov    %ebx,(%edx)
+}
+  80142d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801430:	c9                   	leave
+  801431:	c3                   	ret
+
+00801432 <fd_close>:
+{
+  801432:	55                   	push   %ebp
+  801433:	89 e5                	mov    %esp,%ebp
+  801435:	57                   	push   %edi
+  801436:	56                   	push   %esi
+  801437:	53                   	push   %ebx
+  801438:	83 ec 24             	sub    $0x24,%esp
+  80143b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80143e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801441:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801444:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801445:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80144b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80144e:	50                   	push   %eax
+  80144f:	e8 42 ff ff ff       	call   801396 <fd_lookup>
+  801454:	89 c3                	mov    %eax,%ebx
+  801456:	83 c4 10             	add    $0x10,%esp
+  801459:	85 c0                	test   %eax,%eax
+  80145b:	78 05                	js     801462 <fd_close+0x30>
+	    || fd != fd2)
+  80145d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801460:	74 16                	je     801478 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801462:	89 f8                	mov    %edi,%eax
+  801464:	84 c0                	test   %al,%al
+  801466:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80146e:	89 d8                	mov    %ebx,%eax
+  801470:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801473:	5b                   	pop    %ebx
+  801474:	5e                   	pop    %esi
+  801475:	5f                   	pop    %edi
+  801476:	5d                   	pop    %ebp
+  801477:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801478:	83 ec 08             	sub    $0x8,%esp
+  80147b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80147e:	50                   	push   %eax
+  80147f:	ff 36                	push   (%esi)
+  801481:	e8 60 ff ff ff       	call   8013e6 <dev_lookup>
+  801486:	89 c3                	mov    %eax,%ebx
+  801488:	83 c4 10             	add    $0x10,%esp
+  80148b:	85 c0                	test   %eax,%eax
+  80148d:	78 1a                	js     8014a9 <fd_close+0x77>
+		if (dev->dev_close)
+  80148f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801492:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801495:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80149a:	85 c0                	test   %eax,%eax
+  80149c:	74 0b                	je     8014a9 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80149e:	83 ec 0c             	sub    $0xc,%esp
+  8014a1:	56                   	push   %esi
+  8014a2:	ff d0                	call   *%eax
+  8014a4:	89 c3                	mov    %eax,%ebx
+  8014a6:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8014a9:	83 ec 08             	sub    $0x8,%esp
+  8014ac:	56                   	push   %esi
+  8014ad:	6a 00                	push   $0x0
+  8014af:	e8 51 f9 ff ff       	call   800e05 <sys_page_unmap>
+	return r;
+  8014b4:	83 c4 10             	add    $0x10,%esp
+  8014b7:	eb b5                	jmp    80146e <fd_close+0x3c>
+
+008014b9 <close>:
+
+int
+close(int fdnum)
+{
+  8014b9:	55                   	push   %ebp
+  8014ba:	89 e5                	mov    %esp,%ebp
+  8014bc:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c2:	50                   	push   %eax
+  8014c3:	ff 75 08             	push   0x8(%ebp)
+  8014c6:	e8 cb fe ff ff       	call   801396 <fd_lookup>
+  8014cb:	83 c4 10             	add    $0x10,%esp
+  8014ce:	85 c0                	test   %eax,%eax
+  8014d0:	79 02                	jns    8014d4 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8014d2:	c9                   	leave
+  8014d3:	c3                   	ret
+		return fd_close(fd, 1);
+  8014d4:	83 ec 08             	sub    $0x8,%esp
+  8014d7:	6a 01                	push   $0x1
+  8014d9:	ff 75 f4             	push   -0xc(%ebp)
+  8014dc:	e8 51 ff ff ff       	call   801432 <fd_close>
+  8014e1:	83 c4 10             	add    $0x10,%esp
+  8014e4:	eb ec                	jmp    8014d2 <close+0x19>
+
+008014e6 <close_all>:
+
+void
+close_all(void)
+{
+  8014e6:	55                   	push   %ebp
+  8014e7:	89 e5                	mov    %esp,%ebp
+  8014e9:	53                   	push   %ebx
+  8014ea:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8014ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8014f2:	83 ec 0c             	sub    $0xc,%esp
+  8014f5:	53                   	push   %ebx
+  8014f6:	e8 be ff ff ff       	call   8014b9 <close>
+	for (i = 0; i < MAXFD; i++)
+  8014fb:	83 c3 01             	add    $0x1,%ebx
+  8014fe:	83 c4 10             	add    $0x10,%esp
+  801501:	83 fb 20             	cmp    $0x20,%ebx
+  801504:	75 ec                	jne    8014f2 <close_all+0xc>
+}
+  801506:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801509:	c9                   	leave
+  80150a:	c3                   	ret
+
+0080150b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80150b:	55                   	push   %ebp
+  80150c:	89 e5                	mov    %esp,%ebp
+  80150e:	57                   	push   %edi
+  80150f:	56                   	push   %esi
+  801510:	53                   	push   %ebx
+  801511:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801514:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801517:	50                   	push   %eax
+  801518:	ff 75 08             	push   0x8(%ebp)
+  80151b:	e8 76 fe ff ff       	call   801396 <fd_lookup>
+  801520:	89 c3                	mov    %eax,%ebx
+  801522:	83 c4 10             	add    $0x10,%esp
+  801525:	85 c0                	test   %eax,%eax
+  801527:	78 7f                	js     8015a8 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801529:	83 ec 0c             	sub    $0xc,%esp
+  80152c:	ff 75 0c             	push   0xc(%ebp)
+  80152f:	e8 85 ff ff ff       	call   8014b9 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801534:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801537:	c1 e6 0c             	shl    $0xc,%esi
+  80153a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801540:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801543:	89 3c 24             	mov    %edi,(%esp)
+  801546:	e8 e0 fd ff ff       	call   80132b <fd2data>
+  80154b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80154d:	89 34 24             	mov    %esi,(%esp)
+  801550:	e8 d6 fd ff ff       	call   80132b <fd2data>
+  801555:	83 c4 10             	add    $0x10,%esp
+  801558:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80155b:	89 d8                	mov    %ebx,%eax
+  80155d:	c1 e8 16             	shr    $0x16,%eax
+  801560:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801567:	a8 01                	test   $0x1,%al
+  801569:	74 11                	je     80157c <dup+0x71>
+  80156b:	89 d8                	mov    %ebx,%eax
+  80156d:	c1 e8 0c             	shr    $0xc,%eax
+  801570:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801577:	f6 c2 01             	test   $0x1,%dl
+  80157a:	75 36                	jne    8015b2 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80157c:	89 f8                	mov    %edi,%eax
+  80157e:	c1 e8 0c             	shr    $0xc,%eax
+  801581:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801588:	83 ec 0c             	sub    $0xc,%esp
+  80158b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801590:	50                   	push   %eax
+  801591:	56                   	push   %esi
+  801592:	6a 00                	push   $0x0
+  801594:	57                   	push   %edi
+  801595:	6a 00                	push   $0x0
+  801597:	e8 27 f8 ff ff       	call   800dc3 <sys_page_map>
+  80159c:	89 c3                	mov    %eax,%ebx
+  80159e:	83 c4 20             	add    $0x20,%esp
+  8015a1:	85 c0                	test   %eax,%eax
+  8015a3:	78 33                	js     8015d8 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8015a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8015a8:	89 d8                	mov    %ebx,%eax
+  8015aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ad:	5b                   	pop    %ebx
+  8015ae:	5e                   	pop    %esi
+  8015af:	5f                   	pop    %edi
+  8015b0:	5d                   	pop    %ebp
+  8015b1:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8015b2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015b9:	83 ec 0c             	sub    $0xc,%esp
+  8015bc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015c1:	50                   	push   %eax
+  8015c2:	ff 75 d4             	push   -0x2c(%ebp)
+  8015c5:	6a 00                	push   $0x0
+  8015c7:	53                   	push   %ebx
+  8015c8:	6a 00                	push   $0x0
+  8015ca:	e8 f4 f7 ff ff       	call   800dc3 <sys_page_map>
+  8015cf:	89 c3                	mov    %eax,%ebx
+  8015d1:	83 c4 20             	add    $0x20,%esp
+  8015d4:	85 c0                	test   %eax,%eax
+  8015d6:	79 a4                	jns    80157c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8015d8:	83 ec 08             	sub    $0x8,%esp
+  8015db:	56                   	push   %esi
+  8015dc:	6a 00                	push   $0x0
+  8015de:	e8 22 f8 ff ff       	call   800e05 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8015e3:	83 c4 08             	add    $0x8,%esp
+  8015e6:	ff 75 d4             	push   -0x2c(%ebp)
+  8015e9:	6a 00                	push   $0x0
+  8015eb:	e8 15 f8 ff ff       	call   800e05 <sys_page_unmap>
+	return r;
+  8015f0:	83 c4 10             	add    $0x10,%esp
+  8015f3:	eb b3                	jmp    8015a8 <dup+0x9d>
+
+008015f5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015f5:	55                   	push   %ebp
+  8015f6:	89 e5                	mov    %esp,%ebp
+  8015f8:	56                   	push   %esi
+  8015f9:	53                   	push   %ebx
+  8015fa:	83 ec 18             	sub    $0x18,%esp
+  8015fd:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801600:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801603:	50                   	push   %eax
+  801604:	56                   	push   %esi
+  801605:	e8 8c fd ff ff       	call   801396 <fd_lookup>
+  80160a:	83 c4 10             	add    $0x10,%esp
+  80160d:	85 c0                	test   %eax,%eax
+  80160f:	78 3c                	js     80164d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801611:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801614:	83 ec 08             	sub    $0x8,%esp
+  801617:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80161a:	50                   	push   %eax
+  80161b:	ff 33                	push   (%ebx)
+  80161d:	e8 c4 fd ff ff       	call   8013e6 <dev_lookup>
+  801622:	83 c4 10             	add    $0x10,%esp
+  801625:	85 c0                	test   %eax,%eax
+  801627:	78 24                	js     80164d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801629:	8b 43 08             	mov    0x8(%ebx),%eax
+  80162c:	83 e0 03             	and    $0x3,%eax
+  80162f:	83 f8 01             	cmp    $0x1,%eax
+  801632:	74 20                	je     801654 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801634:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801637:	8b 40 08             	mov    0x8(%eax),%eax
+  80163a:	85 c0                	test   %eax,%eax
+  80163c:	74 37                	je     801675 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80163e:	83 ec 04             	sub    $0x4,%esp
+  801641:	ff 75 10             	push   0x10(%ebp)
+  801644:	ff 75 0c             	push   0xc(%ebp)
+  801647:	53                   	push   %ebx
+  801648:	ff d0                	call   *%eax
+  80164a:	83 c4 10             	add    $0x10,%esp
+}
+  80164d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801650:	5b                   	pop    %ebx
+  801651:	5e                   	pop    %esi
+  801652:	5d                   	pop    %ebp
+  801653:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801654:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801659:	8b 40 48             	mov    0x48(%eax),%eax
+  80165c:	83 ec 04             	sub    $0x4,%esp
+  80165f:	56                   	push   %esi
+  801660:	50                   	push   %eax
+  801661:	68 39 52 80 00       	push   $0x805239
+  801666:	e8 3b ec ff ff       	call   8002a6 <cprintf>
+		return -E_INVAL;
+  80166b:	83 c4 10             	add    $0x10,%esp
+  80166e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801673:	eb d8                	jmp    80164d <read+0x58>
+		return -E_NOT_SUPP;
+  801675:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80167a:	eb d1                	jmp    80164d <read+0x58>
+
+0080167c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80167c:	55                   	push   %ebp
+  80167d:	89 e5                	mov    %esp,%ebp
+  80167f:	57                   	push   %edi
+  801680:	56                   	push   %esi
+  801681:	53                   	push   %ebx
+  801682:	83 ec 0c             	sub    $0xc,%esp
+  801685:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801688:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80168b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801690:	eb 02                	jmp    801694 <readn+0x18>
+  801692:	01 c3                	add    %eax,%ebx
+  801694:	39 f3                	cmp    %esi,%ebx
+  801696:	73 21                	jae    8016b9 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801698:	83 ec 04             	sub    $0x4,%esp
+  80169b:	89 f0                	mov    %esi,%eax
+  80169d:	29 d8                	sub    %ebx,%eax
+  80169f:	50                   	push   %eax
+  8016a0:	89 d8                	mov    %ebx,%eax
+  8016a2:	03 45 0c             	add    0xc(%ebp),%eax
+  8016a5:	50                   	push   %eax
+  8016a6:	57                   	push   %edi
+  8016a7:	e8 49 ff ff ff       	call   8015f5 <read>
+		if (m < 0)
+  8016ac:	83 c4 10             	add    $0x10,%esp
+  8016af:	85 c0                	test   %eax,%eax
+  8016b1:	78 04                	js     8016b7 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8016b3:	75 dd                	jne    801692 <readn+0x16>
+  8016b5:	eb 02                	jmp    8016b9 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016b7:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8016b9:	89 d8                	mov    %ebx,%eax
+  8016bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016be:	5b                   	pop    %ebx
+  8016bf:	5e                   	pop    %esi
+  8016c0:	5f                   	pop    %edi
+  8016c1:	5d                   	pop    %ebp
+  8016c2:	c3                   	ret
+
+008016c3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8016c3:	55                   	push   %ebp
+  8016c4:	89 e5                	mov    %esp,%ebp
+  8016c6:	56                   	push   %esi
+  8016c7:	53                   	push   %ebx
+  8016c8:	83 ec 18             	sub    $0x18,%esp
+  8016cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016ce:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016d1:	50                   	push   %eax
+  8016d2:	53                   	push   %ebx
+  8016d3:	e8 be fc ff ff       	call   801396 <fd_lookup>
+  8016d8:	83 c4 10             	add    $0x10,%esp
+  8016db:	85 c0                	test   %eax,%eax
+  8016dd:	78 37                	js     801716 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016df:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016e2:	83 ec 08             	sub    $0x8,%esp
+  8016e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016e8:	50                   	push   %eax
+  8016e9:	ff 36                	push   (%esi)
+  8016eb:	e8 f6 fc ff ff       	call   8013e6 <dev_lookup>
+  8016f0:	83 c4 10             	add    $0x10,%esp
+  8016f3:	85 c0                	test   %eax,%eax
+  8016f5:	78 1f                	js     801716 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016f7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016fb:	74 20                	je     80171d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8016fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801700:	8b 40 0c             	mov    0xc(%eax),%eax
+  801703:	85 c0                	test   %eax,%eax
+  801705:	74 37                	je     80173e <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801707:	83 ec 04             	sub    $0x4,%esp
+  80170a:	ff 75 10             	push   0x10(%ebp)
+  80170d:	ff 75 0c             	push   0xc(%ebp)
+  801710:	56                   	push   %esi
+  801711:	ff d0                	call   *%eax
+  801713:	83 c4 10             	add    $0x10,%esp
+}
+  801716:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801719:	5b                   	pop    %ebx
+  80171a:	5e                   	pop    %esi
+  80171b:	5d                   	pop    %ebp
+  80171c:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80171d:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801722:	8b 40 48             	mov    0x48(%eax),%eax
+  801725:	83 ec 04             	sub    $0x4,%esp
+  801728:	53                   	push   %ebx
+  801729:	50                   	push   %eax
+  80172a:	68 55 52 80 00       	push   $0x805255
+  80172f:	e8 72 eb ff ff       	call   8002a6 <cprintf>
+		return -E_INVAL;
+  801734:	83 c4 10             	add    $0x10,%esp
+  801737:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80173c:	eb d8                	jmp    801716 <write+0x53>
+		return -E_NOT_SUPP;
+  80173e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801743:	eb d1                	jmp    801716 <write+0x53>
+
+00801745 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801745:	55                   	push   %ebp
+  801746:	89 e5                	mov    %esp,%ebp
+  801748:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80174b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80174e:	50                   	push   %eax
+  80174f:	ff 75 08             	push   0x8(%ebp)
+  801752:	e8 3f fc ff ff       	call   801396 <fd_lookup>
+  801757:	83 c4 10             	add    $0x10,%esp
+  80175a:	85 c0                	test   %eax,%eax
+  80175c:	78 0e                	js     80176c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80175e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801761:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801764:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801767:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80176c:	c9                   	leave
+  80176d:	c3                   	ret
+
+0080176e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80176e:	55                   	push   %ebp
+  80176f:	89 e5                	mov    %esp,%ebp
+  801771:	56                   	push   %esi
+  801772:	53                   	push   %ebx
+  801773:	83 ec 18             	sub    $0x18,%esp
+  801776:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801779:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80177c:	50                   	push   %eax
+  80177d:	53                   	push   %ebx
+  80177e:	e8 13 fc ff ff       	call   801396 <fd_lookup>
+  801783:	83 c4 10             	add    $0x10,%esp
+  801786:	85 c0                	test   %eax,%eax
+  801788:	78 34                	js     8017be <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80178a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80178d:	83 ec 08             	sub    $0x8,%esp
+  801790:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801793:	50                   	push   %eax
+  801794:	ff 36                	push   (%esi)
+  801796:	e8 4b fc ff ff       	call   8013e6 <dev_lookup>
+  80179b:	83 c4 10             	add    $0x10,%esp
+  80179e:	85 c0                	test   %eax,%eax
+  8017a0:	78 1c                	js     8017be <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017a2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017a6:	74 1d                	je     8017c5 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8017a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017ab:	8b 40 18             	mov    0x18(%eax),%eax
+  8017ae:	85 c0                	test   %eax,%eax
+  8017b0:	74 34                	je     8017e6 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8017b2:	83 ec 08             	sub    $0x8,%esp
+  8017b5:	ff 75 0c             	push   0xc(%ebp)
+  8017b8:	56                   	push   %esi
+  8017b9:	ff d0                	call   *%eax
+  8017bb:	83 c4 10             	add    $0x10,%esp
+}
+  8017be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017c1:	5b                   	pop    %ebx
+  8017c2:	5e                   	pop    %esi
+  8017c3:	5d                   	pop    %ebp
+  8017c4:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8017c5:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8017ca:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017cd:	83 ec 04             	sub    $0x4,%esp
+  8017d0:	53                   	push   %ebx
+  8017d1:	50                   	push   %eax
+  8017d2:	68 18 52 80 00       	push   $0x805218
+  8017d7:	e8 ca ea ff ff       	call   8002a6 <cprintf>
+		return -E_INVAL;
+  8017dc:	83 c4 10             	add    $0x10,%esp
+  8017df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017e4:	eb d8                	jmp    8017be <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017e6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017eb:	eb d1                	jmp    8017be <ftruncate+0x50>
+
+008017ed <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017ed:	55                   	push   %ebp
+  8017ee:	89 e5                	mov    %esp,%ebp
+  8017f0:	56                   	push   %esi
+  8017f1:	53                   	push   %ebx
+  8017f2:	83 ec 18             	sub    $0x18,%esp
+  8017f5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017f8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017fb:	50                   	push   %eax
+  8017fc:	ff 75 08             	push   0x8(%ebp)
+  8017ff:	e8 92 fb ff ff       	call   801396 <fd_lookup>
+  801804:	83 c4 10             	add    $0x10,%esp
+  801807:	85 c0                	test   %eax,%eax
+  801809:	78 49                	js     801854 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80180b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80180e:	83 ec 08             	sub    $0x8,%esp
+  801811:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801814:	50                   	push   %eax
+  801815:	ff 36                	push   (%esi)
+  801817:	e8 ca fb ff ff       	call   8013e6 <dev_lookup>
+  80181c:	83 c4 10             	add    $0x10,%esp
+  80181f:	85 c0                	test   %eax,%eax
+  801821:	78 31                	js     801854 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801823:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801826:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80182a:	74 2f                	je     80185b <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80182c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80182f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801836:	00 00 00 
+	stat->st_isdir = 0;
+  801839:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801840:	00 00 00 
+	stat->st_dev = dev;
+  801843:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801849:	83 ec 08             	sub    $0x8,%esp
+  80184c:	53                   	push   %ebx
+  80184d:	56                   	push   %esi
+  80184e:	ff 50 14             	call   *0x14(%eax)
+  801851:	83 c4 10             	add    $0x10,%esp
+}
+  801854:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801857:	5b                   	pop    %ebx
+  801858:	5e                   	pop    %esi
+  801859:	5d                   	pop    %ebp
+  80185a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80185b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801860:	eb f2                	jmp    801854 <fstat+0x67>
+
+00801862 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801862:	55                   	push   %ebp
+  801863:	89 e5                	mov    %esp,%ebp
+  801865:	56                   	push   %esi
+  801866:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801867:	83 ec 08             	sub    $0x8,%esp
+  80186a:	6a 00                	push   $0x0
+  80186c:	ff 75 08             	push   0x8(%ebp)
+  80186f:	e8 bc 02 00 00       	call   801b30 <open>
+  801874:	89 c3                	mov    %eax,%ebx
+  801876:	83 c4 10             	add    $0x10,%esp
+  801879:	85 c0                	test   %eax,%eax
+  80187b:	78 1b                	js     801898 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80187d:	83 ec 08             	sub    $0x8,%esp
+  801880:	ff 75 0c             	push   0xc(%ebp)
+  801883:	50                   	push   %eax
+  801884:	e8 64 ff ff ff       	call   8017ed <fstat>
+  801889:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80188b:	89 1c 24             	mov    %ebx,(%esp)
+  80188e:	e8 26 fc ff ff       	call   8014b9 <close>
+	return r;
+  801893:	83 c4 10             	add    $0x10,%esp
+  801896:	89 f3                	mov    %esi,%ebx
+}
+  801898:	89 d8                	mov    %ebx,%eax
+  80189a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80189d:	5b                   	pop    %ebx
+  80189e:	5e                   	pop    %esi
+  80189f:	5d                   	pop    %ebp
+  8018a0:	c3                   	ret
+
+008018a1 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  8018a1:	55                   	push   %ebp
+  8018a2:	89 e5                	mov    %esp,%ebp
+  8018a4:	57                   	push   %edi
+  8018a5:	56                   	push   %esi
+  8018a6:	53                   	push   %ebx
+  8018a7:	83 ec 0c             	sub    $0xc,%esp
+  8018aa:	89 c7                	mov    %eax,%edi
+  8018ac:	89 d3                	mov    %edx,%ebx
+  8018ae:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8018b0:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8018b7:	74 2d                	je     8018e6 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018b9:	6a 07                	push   $0x7
+  8018bb:	68 00 f0 80 00       	push   $0x80f000
+  8018c0:	57                   	push   %edi
+  8018c1:	ff 35 00 70 80 00    	push   0x807000
+  8018c7:	e8 4e 31 00 00       	call   804a1a <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  8018cc:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8018d3:	6a 00                	push   $0x0
+  8018d5:	56                   	push   %esi
+  8018d6:	53                   	push   %ebx
+  8018d7:	6a 00                	push   $0x0
+  8018d9:	e8 ee 2f 00 00       	call   8048cc <ipc_recv_pages>
+}
+  8018de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e1:	5b                   	pop    %ebx
+  8018e2:	5e                   	pop    %esi
+  8018e3:	5f                   	pop    %edi
+  8018e4:	5d                   	pop    %ebp
+  8018e5:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018e6:	83 ec 0c             	sub    $0xc,%esp
+  8018e9:	6a 01                	push   $0x1
+  8018eb:	e8 1f 32 00 00       	call   804b0f <ipc_find_env>
+  8018f0:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018f5:	83 c4 10             	add    $0x10,%esp
+  8018f8:	eb bf                	jmp    8018b9 <fsipc_pages+0x18>
+
+008018fa <fsipc>:
+{
+  8018fa:	55                   	push   %ebp
+  8018fb:	89 e5                	mov    %esp,%ebp
+  8018fd:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801900:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801905:	e8 97 ff ff ff       	call   8018a1 <fsipc_pages>
+}
+  80190a:	c9                   	leave
+  80190b:	c3                   	ret
+
+0080190c <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80190c:	55                   	push   %ebp
+  80190d:	89 e5                	mov    %esp,%ebp
+  80190f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801912:	8b 45 08             	mov    0x8(%ebp),%eax
+  801915:	8b 40 0c             	mov    0xc(%eax),%eax
+  801918:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  80191d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801920:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801925:	ba 00 00 00 00       	mov    $0x0,%edx
+  80192a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80192f:	e8 c6 ff ff ff       	call   8018fa <fsipc>
+}
+  801934:	c9                   	leave
+  801935:	c3                   	ret
+
+00801936 <devfile_flush>:
+{
+  801936:	55                   	push   %ebp
+  801937:	89 e5                	mov    %esp,%ebp
+  801939:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80193c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80193f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801942:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801947:	ba 00 00 00 00       	mov    $0x0,%edx
+  80194c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801951:	e8 a4 ff ff ff       	call   8018fa <fsipc>
+}
+  801956:	c9                   	leave
+  801957:	c3                   	ret
+
+00801958 <devfile_stat>:
+{
+  801958:	55                   	push   %ebp
+  801959:	89 e5                	mov    %esp,%ebp
+  80195b:	53                   	push   %ebx
+  80195c:	83 ec 04             	sub    $0x4,%esp
+  80195f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801962:	8b 45 08             	mov    0x8(%ebp),%eax
+  801965:	8b 40 0c             	mov    0xc(%eax),%eax
+  801968:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80196d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801972:	b8 05 00 00 00       	mov    $0x5,%eax
+  801977:	e8 7e ff ff ff       	call   8018fa <fsipc>
+  80197c:	85 c0                	test   %eax,%eax
+  80197e:	78 2c                	js     8019ac <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801980:	83 ec 08             	sub    $0x8,%esp
+  801983:	68 00 f0 80 00       	push   $0x80f000
+  801988:	53                   	push   %ebx
+  801989:	e8 ff ee ff ff       	call   80088d <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80198e:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  801993:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801999:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  80199e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8019a4:	83 c4 10             	add    $0x10,%esp
+  8019a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019af:	c9                   	leave
+  8019b0:	c3                   	ret
+
+008019b1 <devfile_write>:
+{
+  8019b1:	55                   	push   %ebp
+  8019b2:	89 e5                	mov    %esp,%ebp
+  8019b4:	83 ec 0c             	sub    $0xc,%esp
+  8019b7:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8019ba:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8019bf:	39 d0                	cmp    %edx,%eax
+  8019c1:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8019c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019c7:	8b 52 0c             	mov    0xc(%edx),%edx
+  8019ca:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  8019d0:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8019d5:	50                   	push   %eax
+  8019d6:	ff 75 0c             	push   0xc(%ebp)
+  8019d9:	68 08 f0 80 00       	push   $0x80f008
+  8019de:	e8 30 f0 ff ff       	call   800a13 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8019e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019ed:	e8 08 ff ff ff       	call   8018fa <fsipc>
+}
+  8019f2:	c9                   	leave
+  8019f3:	c3                   	ret
+
+008019f4 <devfile_read>:
+{
+  8019f4:	55                   	push   %ebp
+  8019f5:	89 e5                	mov    %esp,%ebp
+  8019f7:	57                   	push   %edi
+  8019f8:	56                   	push   %esi
+  8019f9:	53                   	push   %ebx
+  8019fa:	83 ec 1c             	sub    $0x1c,%esp
+  8019fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a00:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a03:	89 fe                	mov    %edi,%esi
+  801a05:	c1 ee 0c             	shr    $0xc,%esi
+  801a08:	b8 20 00 00 00       	mov    $0x20,%eax
+  801a0d:	39 c6                	cmp    %eax,%esi
+  801a0f:	0f 47 f0             	cmova  %eax,%esi
+  801a12:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a1a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801a1d:	eb 14                	jmp    801a33 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a1f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801a26:	05 00 10 00 00       	add    $0x1000,%eax
+  801a2b:	f6 c6 06             	test   $0x6,%dh
+  801a2e:	75 42                	jne    801a72 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a30:	83 c1 01             	add    $0x1,%ecx
+  801a33:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801a36:	39 f1                	cmp    %esi,%ecx
+  801a38:	0f 84 95 00 00 00    	je     801ad3 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801a3e:	89 c2                	mov    %eax,%edx
+  801a40:	c1 ea 16             	shr    $0x16,%edx
+  801a43:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a4a:	f6 c2 01             	test   $0x1,%dl
+  801a4d:	74 23                	je     801a72 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801a4f:	89 c2                	mov    %eax,%edx
+  801a51:	c1 ea 0c             	shr    $0xc,%edx
+  801a54:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801a5b:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801a61:	74 0f                	je     801a72 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801a63:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801a6a:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801a70:	75 ad                	jne    801a1f <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801a72:	85 c9                	test   %ecx,%ecx
+  801a74:	74 11                	je     801a87 <devfile_read+0x93>
+  801a76:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801a7d:	75 08                	jne    801a87 <devfile_read+0x93>
+  801a7f:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801a85:	74 50                	je     801ad7 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a87:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a8a:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  801a8f:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a95:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a9a:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a9f:	e8 56 fe ff ff       	call   8018fa <fsipc>
+  801aa4:	89 c6                	mov    %eax,%esi
+  801aa6:	85 c0                	test   %eax,%eax
+  801aa8:	78 1f                	js     801ac9 <devfile_read+0xd5>
+	assert(r <= n);
+  801aaa:	39 c7                	cmp    %eax,%edi
+  801aac:	72 50                	jb     801afe <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801aae:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ab3:	7f 62                	jg     801b17 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801ab5:	83 ec 04             	sub    $0x4,%esp
+  801ab8:	50                   	push   %eax
+  801ab9:	68 00 f0 80 00       	push   $0x80f000
+  801abe:	ff 75 0c             	push   0xc(%ebp)
+  801ac1:	e8 4d ef ff ff       	call   800a13 <memmove>
+	return r;
+  801ac6:	83 c4 10             	add    $0x10,%esp
+}
+  801ac9:	89 f0                	mov    %esi,%eax
+  801acb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ace:	5b                   	pop    %ebx
+  801acf:	5e                   	pop    %esi
+  801ad0:	5f                   	pop    %edi
+  801ad1:	5d                   	pop    %ebp
+  801ad2:	c3                   	ret
+  801ad3:	89 f1                	mov    %esi,%ecx
+  801ad5:	eb 9b                	jmp    801a72 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801ad7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801ada:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801adf:	89 c8                	mov    %ecx,%eax
+  801ae1:	c1 e0 0c             	shl    $0xc,%eax
+  801ae4:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801ae9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801aec:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801af1:	e8 ab fd ff ff       	call   8018a1 <fsipc_pages>
+  801af6:	89 c6                	mov    %eax,%esi
+  801af8:	85 c0                	test   %eax,%eax
+  801afa:	78 8b                	js     801a87 <devfile_read+0x93>
+  801afc:	eb cb                	jmp    801ac9 <devfile_read+0xd5>
+	assert(r <= n);
+  801afe:	68 84 52 80 00       	push   $0x805284
+  801b03:	68 cc 4d 80 00       	push   $0x804dcc
+  801b08:	68 a0 00 00 00       	push   $0xa0
+  801b0d:	68 8b 52 80 00       	push   $0x80528b
+  801b12:	e8 b4 e6 ff ff       	call   8001cb <_panic>
+	assert(r <= PGSIZE);
+  801b17:	68 96 52 80 00       	push   $0x805296
+  801b1c:	68 cc 4d 80 00       	push   $0x804dcc
+  801b21:	68 a1 00 00 00       	push   $0xa1
+  801b26:	68 8b 52 80 00       	push   $0x80528b
+  801b2b:	e8 9b e6 ff ff       	call   8001cb <_panic>
+
+00801b30 <open>:
+{
+  801b30:	55                   	push   %ebp
+  801b31:	89 e5                	mov    %esp,%ebp
+  801b33:	56                   	push   %esi
+  801b34:	53                   	push   %ebx
+  801b35:	83 ec 1c             	sub    $0x1c,%esp
+  801b38:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801b3b:	56                   	push   %esi
+  801b3c:	e8 11 ed ff ff       	call   800852 <strlen>
+  801b41:	83 c4 10             	add    $0x10,%esp
+  801b44:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b49:	7f 6c                	jg     801bb7 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801b4b:	83 ec 0c             	sub    $0xc,%esp
+  801b4e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b51:	50                   	push   %eax
+  801b52:	e8 eb f7 ff ff       	call   801342 <fd_alloc>
+  801b57:	89 c3                	mov    %eax,%ebx
+  801b59:	83 c4 10             	add    $0x10,%esp
+  801b5c:	85 c0                	test   %eax,%eax
+  801b5e:	78 3c                	js     801b9c <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801b60:	83 ec 08             	sub    $0x8,%esp
+  801b63:	56                   	push   %esi
+  801b64:	68 00 f0 80 00       	push   $0x80f000
+  801b69:	e8 1f ed ff ff       	call   80088d <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b71:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b76:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b79:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b7e:	e8 77 fd ff ff       	call   8018fa <fsipc>
+  801b83:	89 c3                	mov    %eax,%ebx
+  801b85:	83 c4 10             	add    $0x10,%esp
+  801b88:	85 c0                	test   %eax,%eax
+  801b8a:	78 19                	js     801ba5 <open+0x75>
+	return fd2num(fd);
+  801b8c:	83 ec 0c             	sub    $0xc,%esp
+  801b8f:	ff 75 f4             	push   -0xc(%ebp)
+  801b92:	e8 84 f7 ff ff       	call   80131b <fd2num>
+  801b97:	89 c3                	mov    %eax,%ebx
+  801b99:	83 c4 10             	add    $0x10,%esp
+}
+  801b9c:	89 d8                	mov    %ebx,%eax
+  801b9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ba1:	5b                   	pop    %ebx
+  801ba2:	5e                   	pop    %esi
+  801ba3:	5d                   	pop    %ebp
+  801ba4:	c3                   	ret
+		fd_close(fd, 0);
+  801ba5:	83 ec 08             	sub    $0x8,%esp
+  801ba8:	6a 00                	push   $0x0
+  801baa:	ff 75 f4             	push   -0xc(%ebp)
+  801bad:	e8 80 f8 ff ff       	call   801432 <fd_close>
+		return r;
+  801bb2:	83 c4 10             	add    $0x10,%esp
+  801bb5:	eb e5                	jmp    801b9c <open+0x6c>
+		return -E_BAD_PATH;
+  801bb7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801bbc:	eb de                	jmp    801b9c <open+0x6c>
+
+00801bbe <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801bbe:	55                   	push   %ebp
+  801bbf:	89 e5                	mov    %esp,%ebp
+  801bc1:	53                   	push   %ebx
+  801bc2:	83 ec 10             	sub    $0x10,%esp
+  801bc5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801bc8:	53                   	push   %ebx
+  801bc9:	e8 84 ec ff ff       	call   800852 <strlen>
+  801bce:	83 c4 10             	add    $0x10,%esp
+  801bd1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bd6:	7f 25                	jg     801bfd <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801bd8:	83 ec 08             	sub    $0x8,%esp
+  801bdb:	53                   	push   %ebx
+  801bdc:	68 00 f0 80 00       	push   $0x80f000
+  801be1:	e8 a7 ec ff ff       	call   80088d <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801be6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801beb:	b8 07 00 00 00       	mov    $0x7,%eax
+  801bf0:	e8 05 fd ff ff       	call   8018fa <fsipc>
+  801bf5:	83 c4 10             	add    $0x10,%esp
+}
+  801bf8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bfb:	c9                   	leave
+  801bfc:	c3                   	ret
+		return -E_BAD_PATH;
+  801bfd:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801c02:	eb f4                	jmp    801bf8 <remove+0x3a>
+
+00801c04 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c04:	55                   	push   %ebp
+  801c05:	89 e5                	mov    %esp,%ebp
+  801c07:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c14:	e8 e1 fc ff ff       	call   8018fa <fsipc>
+}
+  801c19:	c9                   	leave
+  801c1a:	c3                   	ret
+
+00801c1b <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801c1b:	55                   	push   %ebp
+  801c1c:	89 e5                	mov    %esp,%ebp
+  801c1e:	53                   	push   %ebx
+  801c1f:	83 ec 04             	sub    $0x4,%esp
+  801c22:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801c25:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c2a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c2f:	e8 c6 fc ff ff       	call   8018fa <fsipc>
+  801c34:	85 c0                	test   %eax,%eax
+  801c36:	78 3c                	js     801c74 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801c38:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  801c3d:	89 03                	mov    %eax,(%ebx)
+  801c3f:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  801c44:	89 43 04             	mov    %eax,0x4(%ebx)
+  801c47:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  801c4c:	89 43 08             	mov    %eax,0x8(%ebx)
+  801c4f:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  801c54:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801c57:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  801c5c:	89 43 10             	mov    %eax,0x10(%ebx)
+  801c5f:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  801c64:	89 43 14             	mov    %eax,0x14(%ebx)
+  801c67:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  801c6c:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c77:	c9                   	leave
+  801c78:	c3                   	ret
+
+00801c79 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801c79:	55                   	push   %ebp
+  801c7a:	89 e5                	mov    %esp,%ebp
+  801c7c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801c7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c82:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  801c87:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c8c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c91:	e8 64 fc ff ff       	call   8018fa <fsipc>
+}
+  801c96:	c9                   	leave
+  801c97:	c3                   	ret
+
+00801c98 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c98:	55                   	push   %ebp
+  801c99:	89 e5                	mov    %esp,%ebp
+  801c9b:	56                   	push   %esi
+  801c9c:	53                   	push   %ebx
+  801c9d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801ca0:	83 ec 0c             	sub    $0xc,%esp
+  801ca3:	ff 75 08             	push   0x8(%ebp)
+  801ca6:	e8 80 f6 ff ff       	call   80132b <fd2data>
+  801cab:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801cad:	83 c4 08             	add    $0x8,%esp
+  801cb0:	68 a2 52 80 00       	push   $0x8052a2
+  801cb5:	53                   	push   %ebx
+  801cb6:	e8 d2 eb ff ff       	call   80088d <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801cbb:	8b 46 04             	mov    0x4(%esi),%eax
+  801cbe:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801cc4:	2b 0e                	sub    (%esi),%ecx
+  801cc6:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801ccb:	89 c8                	mov    %ecx,%eax
+  801ccd:	f7 e2                	mul    %edx
+  801ccf:	c1 ea 0c             	shr    $0xc,%edx
+  801cd2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801cd8:	29 d1                	sub    %edx,%ecx
+  801cda:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801ce0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ce7:	00 00 00 
+	stat->st_dev = &devpipe;
+  801cea:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  801cf1:	60 80 00 
+	return 0;
+}
+  801cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cfc:	5b                   	pop    %ebx
+  801cfd:	5e                   	pop    %esi
+  801cfe:	5d                   	pop    %ebp
+  801cff:	c3                   	ret
+
+00801d00 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801d00:	55                   	push   %ebp
+  801d01:	89 e5                	mov    %esp,%ebp
+  801d03:	53                   	push   %ebx
+  801d04:	83 ec 0c             	sub    $0xc,%esp
+  801d07:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801d0a:	53                   	push   %ebx
+  801d0b:	6a 00                	push   $0x0
+  801d0d:	e8 f3 f0 ff ff       	call   800e05 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801d12:	89 1c 24             	mov    %ebx,(%esp)
+  801d15:	e8 11 f6 ff ff       	call   80132b <fd2data>
+  801d1a:	83 c4 08             	add    $0x8,%esp
+  801d1d:	50                   	push   %eax
+  801d1e:	6a 00                	push   $0x0
+  801d20:	e8 e0 f0 ff ff       	call   800e05 <sys_page_unmap>
+}
+  801d25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d28:	c9                   	leave
+  801d29:	c3                   	ret
+
+00801d2a <_pipeisclosed>:
+{
+  801d2a:	55                   	push   %ebp
+  801d2b:	89 e5                	mov    %esp,%ebp
+  801d2d:	57                   	push   %edi
+  801d2e:	56                   	push   %esi
+  801d2f:	53                   	push   %ebx
+  801d30:	83 ec 1c             	sub    $0x1c,%esp
+  801d33:	89 c7                	mov    %eax,%edi
+  801d35:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801d37:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801d3c:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801d3f:	83 ec 0c             	sub    $0xc,%esp
+  801d42:	57                   	push   %edi
+  801d43:	e8 06 2e 00 00       	call   804b4e <pageref>
+  801d48:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d4b:	89 34 24             	mov    %esi,(%esp)
+  801d4e:	e8 fb 2d 00 00       	call   804b4e <pageref>
+		nn = thisenv->env_runs;
+  801d53:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  801d59:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801d5c:	83 c4 10             	add    $0x10,%esp
+  801d5f:	39 cb                	cmp    %ecx,%ebx
+  801d61:	74 1b                	je     801d7e <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801d63:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801d66:	75 cf                	jne    801d37 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801d68:	8b 42 58             	mov    0x58(%edx),%eax
+  801d6b:	6a 01                	push   $0x1
+  801d6d:	50                   	push   %eax
+  801d6e:	53                   	push   %ebx
+  801d6f:	68 a9 52 80 00       	push   $0x8052a9
+  801d74:	e8 2d e5 ff ff       	call   8002a6 <cprintf>
+  801d79:	83 c4 10             	add    $0x10,%esp
+  801d7c:	eb b9                	jmp    801d37 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801d7e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801d81:	0f 94 c0             	sete   %al
+  801d84:	0f b6 c0             	movzbl %al,%eax
+}
+  801d87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d8a:	5b                   	pop    %ebx
+  801d8b:	5e                   	pop    %esi
+  801d8c:	5f                   	pop    %edi
+  801d8d:	5d                   	pop    %ebp
+  801d8e:	c3                   	ret
+
+00801d8f <devpipe_read>:
+{
+  801d8f:	55                   	push   %ebp
+  801d90:	89 e5                	mov    %esp,%ebp
+  801d92:	57                   	push   %edi
+  801d93:	56                   	push   %esi
+  801d94:	53                   	push   %ebx
+  801d95:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801d98:	ff 75 08             	push   0x8(%ebp)
+  801d9b:	e8 8b f5 ff ff       	call   80132b <fd2data>
+  801da0:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801da2:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801da5:	8d 40 04             	lea    0x4(%eax),%eax
+  801da8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801dab:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801dae:	8b 0b                	mov    (%ebx),%ecx
+  801db0:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801db6:	29 ce                	sub    %ecx,%esi
+  801db8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801dbd:	f7 e6                	mul    %esi
+  801dbf:	c1 ea 0c             	shr    $0xc,%edx
+  801dc2:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801dc8:	29 c6                	sub    %eax,%esi
+  801dca:	89 f2                	mov    %esi,%edx
+  801dcc:	75 43                	jne    801e11 <devpipe_read+0x82>
+		ref = pageref(p);
+  801dce:	83 ec 0c             	sub    $0xc,%esp
+  801dd1:	53                   	push   %ebx
+  801dd2:	e8 77 2d 00 00       	call   804b4e <pageref>
+  801dd7:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801dd9:	89 da                	mov    %ebx,%edx
+  801ddb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dde:	e8 47 ff ff ff       	call   801d2a <_pipeisclosed>
+  801de3:	83 c4 10             	add    $0x10,%esp
+  801de6:	85 c0                	test   %eax,%eax
+  801de8:	0f 85 c1 00 00 00    	jne    801eaf <devpipe_read+0x120>
+	*sleeping = 1;
+  801dee:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801df5:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801dfa:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801dfd:	75 ac                	jne    801dab <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801dff:	83 ec 04             	sub    $0x4,%esp
+  801e02:	56                   	push   %esi
+  801e03:	57                   	push   %edi
+  801e04:	ff 75 e4             	push   -0x1c(%ebp)
+  801e07:	e8 4d f4 ff ff       	call   801259 <sys_futex_wait>
+  801e0c:	83 c4 10             	add    $0x10,%esp
+  801e0f:	eb 9a                	jmp    801dab <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801e11:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801e14:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801e18:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801e1a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e1f:	f7 e1                	mul    %ecx
+  801e21:	c1 ea 0b             	shr    $0xb,%edx
+  801e24:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801e2a:	29 c1                	sub    %eax,%ecx
+  801e2c:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801e2e:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801e33:	29 cf                	sub    %ecx,%edi
+  801e35:	39 f7                	cmp    %esi,%edi
+  801e37:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801e3a:	8d 43 10             	lea    0x10(%ebx),%eax
+  801e3d:	83 ec 04             	sub    $0x4,%esp
+  801e40:	57                   	push   %edi
+  801e41:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e44:	01 c2                	add    %eax,%edx
+  801e46:	52                   	push   %edx
+  801e47:	ff 75 0c             	push   0xc(%ebp)
+  801e4a:	e8 c4 eb ff ff       	call   800a13 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801e4f:	83 c4 0c             	add    $0xc,%esp
+  801e52:	89 f1                	mov    %esi,%ecx
+  801e54:	29 f9                	sub    %edi,%ecx
+  801e56:	51                   	push   %ecx
+  801e57:	ff 75 e4             	push   -0x1c(%ebp)
+  801e5a:	89 f8                	mov    %edi,%eax
+  801e5c:	03 45 0c             	add    0xc(%ebp),%eax
+  801e5f:	50                   	push   %eax
+  801e60:	e8 ae eb ff ff       	call   800a13 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801e65:	89 f1                	mov    %esi,%ecx
+  801e67:	03 0b                	add    (%ebx),%ecx
+  801e69:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e6e:	f7 e1                	mul    %ecx
+  801e70:	c1 ea 0c             	shr    $0xc,%edx
+  801e73:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801e79:	29 d1                	sub    %edx,%ecx
+  801e7b:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801e7d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801e82:	83 c4 10             	add    $0x10,%esp
+  801e85:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801e89:	75 0a                	jne    801e95 <devpipe_read+0x106>
+	return n;
+  801e8b:	89 f0                	mov    %esi,%eax
+}
+  801e8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e90:	5b                   	pop    %ebx
+  801e91:	5e                   	pop    %esi
+  801e92:	5f                   	pop    %edi
+  801e93:	5d                   	pop    %ebp
+  801e94:	c3                   	ret
+		*sleeping = 0;
+  801e95:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801e9c:	83 ec 08             	sub    $0x8,%esp
+  801e9f:	68 00 04 00 00       	push   $0x400
+  801ea4:	53                   	push   %ebx
+  801ea5:	e8 ff f3 ff ff       	call   8012a9 <sys_futex_wake>
+  801eaa:	83 c4 10             	add    $0x10,%esp
+  801ead:	eb dc                	jmp    801e8b <devpipe_read+0xfc>
+			return 0;
+  801eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb4:	eb d7                	jmp    801e8d <devpipe_read+0xfe>
+
+00801eb6 <devpipe_write>:
+{
+  801eb6:	55                   	push   %ebp
+  801eb7:	89 e5                	mov    %esp,%ebp
+  801eb9:	57                   	push   %edi
+  801eba:	56                   	push   %esi
+  801ebb:	53                   	push   %ebx
+  801ebc:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801ebf:	ff 75 08             	push   0x8(%ebp)
+  801ec2:	e8 64 f4 ff ff       	call   80132b <fd2data>
+  801ec7:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801ec9:	83 c4 10             	add    $0x10,%esp
+  801ecc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801ed3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ed6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801ed9:	0f 83 23 01 00 00    	jae    802002 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801edf:	8b 77 04             	mov    0x4(%edi),%esi
+  801ee2:	8b 1f                	mov    (%edi),%ebx
+  801ee4:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801eea:	29 d9                	sub    %ebx,%ecx
+  801eec:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801ef1:	f7 e1                	mul    %ecx
+  801ef3:	c1 ea 0c             	shr    $0xc,%edx
+  801ef6:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801efc:	29 c1                	sub    %eax,%ecx
+  801efe:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801f00:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801f06:	75 40                	jne    801f48 <devpipe_write+0x92>
+			ref = pageref(p);
+  801f08:	83 ec 0c             	sub    $0xc,%esp
+  801f0b:	57                   	push   %edi
+  801f0c:	e8 3d 2c 00 00       	call   804b4e <pageref>
+  801f11:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801f13:	89 fa                	mov    %edi,%edx
+  801f15:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f18:	e8 0d fe ff ff       	call   801d2a <_pipeisclosed>
+  801f1d:	83 c4 10             	add    $0x10,%esp
+  801f20:	85 c0                	test   %eax,%eax
+  801f22:	0f 85 d5 00 00 00    	jne    801ffd <devpipe_write+0x147>
+	*sleeping = 1;
+  801f28:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801f2f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801f34:	39 1f                	cmp    %ebx,(%edi)
+  801f36:	75 a7                	jne    801edf <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801f38:	83 ec 04             	sub    $0x4,%esp
+  801f3b:	56                   	push   %esi
+  801f3c:	53                   	push   %ebx
+  801f3d:	57                   	push   %edi
+  801f3e:	e8 16 f3 ff ff       	call   801259 <sys_futex_wait>
+  801f43:	83 c4 10             	add    $0x10,%esp
+  801f46:	eb 97                	jmp    801edf <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801f48:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801f4b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f4e:	29 c1                	sub    %eax,%ecx
+  801f50:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801f55:	89 d8                	mov    %ebx,%eax
+  801f57:	29 d0                	sub    %edx,%eax
+  801f59:	39 c1                	cmp    %eax,%ecx
+  801f5b:	0f 46 c1             	cmovbe %ecx,%eax
+  801f5e:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801f60:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f65:	f7 e6                	mul    %esi
+  801f67:	c1 ea 0b             	shr    $0xb,%edx
+  801f6a:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801f70:	29 c6                	sub    %eax,%esi
+  801f72:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801f74:	29 f3                	sub    %esi,%ebx
+  801f76:	39 cb                	cmp    %ecx,%ebx
+  801f78:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801f7b:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801f7e:	8d 77 10             	lea    0x10(%edi),%esi
+  801f81:	83 ec 04             	sub    $0x4,%esp
+  801f84:	53                   	push   %ebx
+  801f85:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f88:	03 45 0c             	add    0xc(%ebp),%eax
+  801f8b:	50                   	push   %eax
+  801f8c:	01 f2                	add    %esi,%edx
+  801f8e:	52                   	push   %edx
+  801f8f:	e8 7f ea ff ff       	call   800a13 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  801f94:	83 c4 0c             	add    $0xc,%esp
+  801f97:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f9a:	29 d8                	sub    %ebx,%eax
+  801f9c:	50                   	push   %eax
+  801f9d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fa0:	01 d3                	add    %edx,%ebx
+  801fa2:	03 5d 0c             	add    0xc(%ebp),%ebx
+  801fa5:	53                   	push   %ebx
+  801fa6:	56                   	push   %esi
+  801fa7:	e8 67 ea ff ff       	call   800a13 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  801fac:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801faf:	03 4f 04             	add    0x4(%edi),%ecx
+  801fb2:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801fb7:	f7 e1                	mul    %ecx
+  801fb9:	c1 ea 0c             	shr    $0xc,%edx
+  801fbc:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801fc2:	29 d1                	sub    %edx,%ecx
+  801fc4:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  801fc7:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801fcc:	83 c4 10             	add    $0x10,%esp
+  801fcf:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  801fd3:	75 0b                	jne    801fe0 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  801fd5:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  801fd8:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801fdb:	e9 f3 fe ff ff       	jmp    801ed3 <devpipe_write+0x1d>
+		*sleeping = 0;
+  801fe0:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  801fe7:	83 ec 08             	sub    $0x8,%esp
+  801fea:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  801fef:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  801ff2:	50                   	push   %eax
+  801ff3:	e8 b1 f2 ff ff       	call   8012a9 <sys_futex_wake>
+  801ff8:	83 c4 10             	add    $0x10,%esp
+  801ffb:	eb d8                	jmp    801fd5 <devpipe_write+0x11f>
+				return 0;
+  801ffd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802002:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802005:	5b                   	pop    %ebx
+  802006:	5e                   	pop    %esi
+  802007:	5f                   	pop    %edi
+  802008:	5d                   	pop    %ebp
+  802009:	c3                   	ret
+
+0080200a <pipe>:
+{
+  80200a:	55                   	push   %ebp
+  80200b:	89 e5                	mov    %esp,%ebp
+  80200d:	56                   	push   %esi
+  80200e:	53                   	push   %ebx
+  80200f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802012:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802015:	50                   	push   %eax
+  802016:	e8 27 f3 ff ff       	call   801342 <fd_alloc>
+  80201b:	89 c3                	mov    %eax,%ebx
+  80201d:	83 c4 10             	add    $0x10,%esp
+  802020:	85 c0                	test   %eax,%eax
+  802022:	0f 88 23 01 00 00    	js     80214b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802028:	83 ec 04             	sub    $0x4,%esp
+  80202b:	68 07 04 00 00       	push   $0x407
+  802030:	ff 75 f4             	push   -0xc(%ebp)
+  802033:	6a 00                	push   $0x0
+  802035:	e8 46 ed ff ff       	call   800d80 <sys_page_alloc>
+  80203a:	89 c3                	mov    %eax,%ebx
+  80203c:	83 c4 10             	add    $0x10,%esp
+  80203f:	85 c0                	test   %eax,%eax
+  802041:	0f 88 04 01 00 00    	js     80214b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802047:	83 ec 0c             	sub    $0xc,%esp
+  80204a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80204d:	50                   	push   %eax
+  80204e:	e8 ef f2 ff ff       	call   801342 <fd_alloc>
+  802053:	89 c3                	mov    %eax,%ebx
+  802055:	83 c4 10             	add    $0x10,%esp
+  802058:	85 c0                	test   %eax,%eax
+  80205a:	0f 88 db 00 00 00    	js     80213b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802060:	83 ec 04             	sub    $0x4,%esp
+  802063:	68 07 04 00 00       	push   $0x407
+  802068:	ff 75 f0             	push   -0x10(%ebp)
+  80206b:	6a 00                	push   $0x0
+  80206d:	e8 0e ed ff ff       	call   800d80 <sys_page_alloc>
+  802072:	89 c3                	mov    %eax,%ebx
+  802074:	83 c4 10             	add    $0x10,%esp
+  802077:	85 c0                	test   %eax,%eax
+  802079:	0f 88 bc 00 00 00    	js     80213b <pipe+0x131>
+	va = fd2data(fd0);
+  80207f:	83 ec 0c             	sub    $0xc,%esp
+  802082:	ff 75 f4             	push   -0xc(%ebp)
+  802085:	e8 a1 f2 ff ff       	call   80132b <fd2data>
+  80208a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80208c:	83 c4 0c             	add    $0xc,%esp
+  80208f:	68 07 04 00 00       	push   $0x407
+  802094:	50                   	push   %eax
+  802095:	6a 00                	push   $0x0
+  802097:	e8 e4 ec ff ff       	call   800d80 <sys_page_alloc>
+  80209c:	89 c3                	mov    %eax,%ebx
+  80209e:	83 c4 10             	add    $0x10,%esp
+  8020a1:	85 c0                	test   %eax,%eax
+  8020a3:	0f 88 82 00 00 00    	js     80212b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020a9:	83 ec 0c             	sub    $0xc,%esp
+  8020ac:	ff 75 f0             	push   -0x10(%ebp)
+  8020af:	e8 77 f2 ff ff       	call   80132b <fd2data>
+  8020b4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8020bb:	50                   	push   %eax
+  8020bc:	6a 00                	push   $0x0
+  8020be:	56                   	push   %esi
+  8020bf:	6a 00                	push   $0x0
+  8020c1:	e8 fd ec ff ff       	call   800dc3 <sys_page_map>
+  8020c6:	89 c3                	mov    %eax,%ebx
+  8020c8:	83 c4 20             	add    $0x20,%esp
+  8020cb:	85 c0                	test   %eax,%eax
+  8020cd:	78 4e                	js     80211d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8020cf:	a1 20 60 80 00       	mov    0x806020,%eax
+  8020d4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020d7:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8020d9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020dc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8020e3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8020e6:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8020e8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8020eb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8020f2:	83 ec 0c             	sub    $0xc,%esp
+  8020f5:	ff 75 f4             	push   -0xc(%ebp)
+  8020f8:	e8 1e f2 ff ff       	call   80131b <fd2num>
+  8020fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802100:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802102:	83 c4 04             	add    $0x4,%esp
+  802105:	ff 75 f0             	push   -0x10(%ebp)
+  802108:	e8 0e f2 ff ff       	call   80131b <fd2num>
+  80210d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802110:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802113:	83 c4 10             	add    $0x10,%esp
+  802116:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80211b:	eb 2e                	jmp    80214b <pipe+0x141>
+	sys_page_unmap(0, va);
+  80211d:	83 ec 08             	sub    $0x8,%esp
+  802120:	56                   	push   %esi
+  802121:	6a 00                	push   $0x0
+  802123:	e8 dd ec ff ff       	call   800e05 <sys_page_unmap>
+  802128:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80212b:	83 ec 08             	sub    $0x8,%esp
+  80212e:	ff 75 f0             	push   -0x10(%ebp)
+  802131:	6a 00                	push   $0x0
+  802133:	e8 cd ec ff ff       	call   800e05 <sys_page_unmap>
+  802138:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80213b:	83 ec 08             	sub    $0x8,%esp
+  80213e:	ff 75 f4             	push   -0xc(%ebp)
+  802141:	6a 00                	push   $0x0
+  802143:	e8 bd ec ff ff       	call   800e05 <sys_page_unmap>
+  802148:	83 c4 10             	add    $0x10,%esp
+}
+  80214b:	89 d8                	mov    %ebx,%eax
+  80214d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802150:	5b                   	pop    %ebx
+  802151:	5e                   	pop    %esi
+  802152:	5d                   	pop    %ebp
+  802153:	c3                   	ret
+
+00802154 <pipeisclosed>:
+{
+  802154:	55                   	push   %ebp
+  802155:	89 e5                	mov    %esp,%ebp
+  802157:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80215a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80215d:	50                   	push   %eax
+  80215e:	ff 75 08             	push   0x8(%ebp)
+  802161:	e8 30 f2 ff ff       	call   801396 <fd_lookup>
+  802166:	83 c4 10             	add    $0x10,%esp
+  802169:	85 c0                	test   %eax,%eax
+  80216b:	78 18                	js     802185 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80216d:	83 ec 0c             	sub    $0xc,%esp
+  802170:	ff 75 f4             	push   -0xc(%ebp)
+  802173:	e8 b3 f1 ff ff       	call   80132b <fd2data>
+  802178:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80217a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80217d:	e8 a8 fb ff ff       	call   801d2a <_pipeisclosed>
+  802182:	83 c4 10             	add    $0x10,%esp
+}
+  802185:	c9                   	leave
+  802186:	c3                   	ret
+
+00802187 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802187:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802189:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  80218f:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802195:	81 c2 34 01 00 00    	add    $0x134,%edx
+  80219b:	39 d0                	cmp    %edx,%eax
+  80219d:	74 2e                	je     8021cd <segment_lookup+0x46>
+{
+  80219f:	55                   	push   %ebp
+  8021a0:	89 e5                	mov    %esp,%ebp
+  8021a2:	57                   	push   %edi
+  8021a3:	56                   	push   %esi
+  8021a4:	53                   	push   %ebx
+  8021a5:	eb 07                	jmp    8021ae <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8021a7:	83 c0 20             	add    $0x20,%eax
+  8021aa:	39 d0                	cmp    %edx,%eax
+  8021ac:	74 15                	je     8021c3 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  8021ae:	8b 18                	mov    (%eax),%ebx
+  8021b0:	39 d9                	cmp    %ebx,%ecx
+  8021b2:	72 f3                	jb     8021a7 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  8021b4:	8b 38                	mov    (%eax),%edi
+  8021b6:	8b 58 04             	mov    0x4(%eax),%ebx
+  8021b9:	89 ce                	mov    %ecx,%esi
+  8021bb:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  8021bd:	39 de                	cmp    %ebx,%esi
+  8021bf:	73 e6                	jae    8021a7 <segment_lookup+0x20>
+  8021c1:	eb 05                	jmp    8021c8 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  8021c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021c8:	5b                   	pop    %ebx
+  8021c9:	5e                   	pop    %esi
+  8021ca:	5f                   	pop    %edi
+  8021cb:	5d                   	pop    %ebp
+  8021cc:	c3                   	ret
+	return NULL;
+  8021cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021d2:	c3                   	ret
+
+008021d3 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  8021d3:	55                   	push   %ebp
+  8021d4:	89 e5                	mov    %esp,%ebp
+  8021d6:	53                   	push   %ebx
+  8021d7:	83 ec 04             	sub    $0x4,%esp
+  8021da:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8021dc:	c1 e8 16             	shr    $0x16,%eax
+  8021df:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8021e6:	25 81 00 00 00       	and    $0x81,%eax
+  8021eb:	83 f8 01             	cmp    $0x1,%eax
+  8021ee:	75 6b                	jne    80225b <page_is_clean+0x88>
+  8021f0:	89 da                	mov    %ebx,%edx
+  8021f2:	c1 ea 0c             	shr    $0xc,%edx
+  8021f5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  8021fc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802201:	f6 c1 01             	test   $0x1,%cl
+  802204:	74 5a                	je     802260 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802206:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80220d:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802213:	75 4b                	jne    802260 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  802215:	89 d8                	mov    %ebx,%eax
+  802217:	e8 6b ff ff ff       	call   802187 <segment_lookup>
+  80221c:	89 c2                	mov    %eax,%edx
+		return 1;
+  80221e:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  802223:	85 d2                	test   %edx,%edx
+  802225:	75 39                	jne    802260 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  802227:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  80222d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802232:	eb 03                	jmp    802237 <page_is_clean+0x64>
+  802234:	83 c0 01             	add    $0x1,%eax
+  802237:	39 c2                	cmp    %eax,%edx
+  802239:	7e 19                	jle    802254 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  80223b:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  802242:	72 f0                	jb     802234 <page_is_clean+0x61>
+  802244:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  80224b:	73 e7                	jae    802234 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  80224d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802252:	eb 0c                	jmp    802260 <page_is_clean+0x8d>
+	return 0;
+  802254:	b8 00 00 00 00       	mov    $0x0,%eax
+  802259:	eb 05                	jmp    802260 <page_is_clean+0x8d>
+		return 0;
+  80225b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802260:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802263:	c9                   	leave
+  802264:	c3                   	ret
+
+00802265 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  802265:	55                   	push   %ebp
+  802266:	89 e5                	mov    %esp,%ebp
+  802268:	57                   	push   %edi
+  802269:	56                   	push   %esi
+  80226a:	53                   	push   %ebx
+  80226b:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80226e:	be 00 00 00 00       	mov    $0x0,%esi
+  802273:	eb 19                	jmp    80228e <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802275:	f7 d3                	not    %ebx
+  802277:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80227d:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80227f:	83 c6 01             	add    $0x1,%esi
+  802282:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802288:	0f 87 97 00 00 00    	ja     802325 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80228e:	89 f3                	mov    %esi,%ebx
+  802290:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  802296:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80229c:	89 d8                	mov    %ebx,%eax
+  80229e:	c1 e8 0a             	shr    $0xa,%eax
+  8022a1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8022a8:	25 81 00 00 00       	and    $0x81,%eax
+  8022ad:	83 f8 01             	cmp    $0x1,%eax
+  8022b0:	75 c3                	jne    802275 <linear_walk+0x10>
+  8022b2:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8022b8:	77 bb                	ja     802275 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8022ba:	89 df                	mov    %ebx,%edi
+  8022bc:	c1 e7 0c             	shl    $0xc,%edi
+  8022bf:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8022c2:	89 f8                	mov    %edi,%eax
+  8022c4:	e8 0a ff ff ff       	call   8021d3 <page_is_clean>
+  8022c9:	84 c0                	test   %al,%al
+  8022cb:	75 64                	jne    802331 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8022cd:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  8022d3:	77 aa                	ja     80227f <linear_walk+0x1a>
+  8022d5:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  8022db:	72 a2                	jb     80227f <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8022dd:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8022e4:	a8 01                	test   $0x1,%al
+  8022e6:	74 97                	je     80227f <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8022e8:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8022ef:	f6 c4 04             	test   $0x4,%ah
+  8022f2:	75 8b                	jne    80227f <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8022f4:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8022fb:	f6 c4 02             	test   $0x2,%ah
+  8022fe:	0f 85 7b ff ff ff    	jne    80227f <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802304:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80230b:	c1 e8 0c             	shr    $0xc,%eax
+  80230e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802311:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802316:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80231a:	66 83 f8 01          	cmp    $0x1,%ax
+  80231e:	76 11                	jbe    802331 <linear_walk+0xcc>
+  802320:	e9 5a ff ff ff       	jmp    80227f <linear_walk+0x1a>
+  802325:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  80232a:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802331:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  802337:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80233a:	83 c4 1c             	add    $0x1c,%esp
+  80233d:	5b                   	pop    %ebx
+  80233e:	5e                   	pop    %esi
+  80233f:	5f                   	pop    %edi
+  802340:	5d                   	pop    %ebp
+  802341:	c3                   	ret
+
+00802342 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802342:	55                   	push   %ebp
+  802343:	89 e5                	mov    %esp,%ebp
+  802345:	56                   	push   %esi
+  802346:	53                   	push   %ebx
+  802347:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  802349:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80234e:	83 e0 7f             	and    $0x7f,%eax
+  802351:	c1 e0 04             	shl    $0x4,%eax
+  802354:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  80235a:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802360:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802366:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  80236c:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802371:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  802374:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802379:	83 c0 01             	add    $0x1,%eax
+  80237c:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  802381:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802384:	5b                   	pop    %ebx
+  802385:	5e                   	pop    %esi
+  802386:	5d                   	pop    %ebp
+  802387:	c3                   	ret
+
+00802388 <page_ring_enter>:
+{
+  802388:	55                   	push   %ebp
+  802389:	89 e5                	mov    %esp,%ebp
+  80238b:	57                   	push   %edi
+  80238c:	56                   	push   %esi
+  80238d:	53                   	push   %ebx
+  80238e:	83 ec 18             	sub    $0x18,%esp
+  802391:	89 c6                	mov    %eax,%esi
+  802393:	89 d7                	mov    %edx,%edi
+  802395:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802397:	6a 00                	push   $0x0
+  802399:	6a 00                	push   $0x0
+  80239b:	6a 00                	push   $0x0
+  80239d:	6a 07                	push   $0x7
+  80239f:	ff 35 40 b0 80 00    	push   0x80b040
+  8023a5:	e8 8e 26 00 00       	call   804a38 <ipc_call>
+  8023aa:	83 c4 20             	add    $0x20,%esp
+  8023ad:	85 c0                	test   %eax,%eax
+  8023af:	79 22                	jns    8023d3 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  8023b1:	50                   	push   %eax
+  8023b2:	68 c1 52 80 00       	push   $0x8052c1
+  8023b7:	68 13 02 00 00       	push   $0x213
+  8023bc:	68 d5 52 80 00       	push   $0x8052d5
+  8023c1:	e8 05 de ff ff       	call   8001cb <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  8023c6:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8023cb:	83 c0 01             	add    $0x1,%eax
+  8023ce:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  8023d3:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  8023d9:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  8023de:	39 c2                	cmp    %eax,%edx
+  8023e0:	74 24                	je     802406 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  8023e2:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8023e7:	83 e0 7f             	and    $0x7f,%eax
+  8023ea:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  8023f1:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  8023f8:	29 f0                	sub    %esi,%eax
+  8023fa:	39 d8                	cmp    %ebx,%eax
+  8023fc:	73 c8                	jae    8023c6 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  8023fe:	8b 52 04             	mov    0x4(%edx),%edx
+  802401:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802404:	eb c0                	jmp    8023c6 <page_ring_enter+0x3e>
+}
+  802406:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802409:	5b                   	pop    %ebx
+  80240a:	5e                   	pop    %esi
+  80240b:	5f                   	pop    %edi
+  80240c:	5d                   	pop    %ebp
+  80240d:	c3                   	ret
+
+0080240e <page_ring_reserve>:
+{
+  80240e:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802410:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802415:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  80241b:	29 d0                	sub    %edx,%eax
+  80241d:	ba 80 00 00 00       	mov    $0x80,%edx
+  802422:	29 ca                	sub    %ecx,%edx
+  802424:	39 c2                	cmp    %eax,%edx
+  802426:	72 01                	jb     802429 <page_ring_reserve+0x1b>
+  802428:	c3                   	ret
+{
+  802429:	55                   	push   %ebp
+  80242a:	89 e5                	mov    %esp,%ebp
+  80242c:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  80242f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802434:	ba 00 00 00 00       	mov    $0x0,%edx
+  802439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80243e:	e8 45 ff ff ff       	call   802388 <page_ring_enter>
+}
+  802443:	c9                   	leave
+  802444:	c3                   	ret
+
+00802445 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802445:	55                   	push   %ebp
+  802446:	89 e5                	mov    %esp,%ebp
+  802448:	53                   	push   %ebx
+  802449:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  80244c:	6a 07                	push   $0x7
+  80244e:	6a 01                	push   $0x1
+  802450:	89 c3                	mov    %eax,%ebx
+  802452:	c1 e3 0c             	shl    $0xc,%ebx
+  802455:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  80245b:	52                   	push   %edx
+  80245c:	6a 04                	push   $0x4
+  80245e:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  802465:	e8 ce 25 00 00       	call   804a38 <ipc_call>
+	sharereqs[i].nslots = 0;
+  80246a:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  802471:	00 00 00 
+	return r;
+}
+  802474:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802477:	c9                   	leave
+  802478:	c3                   	ret
+
+00802479 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802479:	55                   	push   %ebp
+  80247a:	89 e5                	mov    %esp,%ebp
+  80247c:	56                   	push   %esi
+  80247d:	53                   	push   %ebx
+  80247e:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802480:	c1 e8 10             	shr    $0x10,%eax
+  802483:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802486:	89 c2                	mov    %eax,%edx
+  802488:	c1 e2 0c             	shl    $0xc,%edx
+  80248b:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  802491:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802494:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  80249a:	89 c2                	mov    %eax,%edx
+  80249c:	c1 e2 0a             	shl    $0xa,%edx
+  80249f:	01 f2                	add    %esi,%edx
+  8024a1:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  8024a8:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  8024ae:	74 09                	je     8024b9 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  8024b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024b5:	5b                   	pop    %ebx
+  8024b6:	5e                   	pop    %esi
+  8024b7:	5d                   	pop    %ebp
+  8024b8:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  8024b9:	e8 87 ff ff ff       	call   802445 <page_share_send>
+  8024be:	eb f5                	jmp    8024b5 <page_share_slot+0x3c>
+
+008024c0 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  8024c0:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8024c5:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  8024c8:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  8024cd:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  8024d3:	74 09                	je     8024de <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  8024d5:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  8024da:	85 c0                	test   %eax,%eax
+  8024dc:	75 01                	jne    8024df <page_ring_ready+0x1f>
+}
+  8024de:	c3                   	ret
+{
+  8024df:	55                   	push   %ebp
+  8024e0:	89 e5                	mov    %esp,%ebp
+  8024e2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  8024e5:	68 07 06 00 00       	push   $0x607
+  8024ea:	6a 08                	push   $0x8
+  8024ec:	68 00 30 ad de       	push   $0xdead3000
+  8024f1:	6a 00                	push   $0x0
+  8024f3:	e8 b3 e9 ff ff       	call   800eab <sys_page_alloc_range>
+  8024f8:	83 c4 10             	add    $0x10,%esp
+  8024fb:	83 f8 08             	cmp    $0x8,%eax
+  8024fe:	74 1b                	je     80251b <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802500:	83 ec 04             	sub    $0x4,%esp
+  802503:	6a 08                	push   $0x8
+  802505:	68 00 30 ad de       	push   $0xdead3000
+  80250a:	6a 00                	push   $0x0
+  80250c:	e8 08 ea ff ff       	call   800f19 <sys_page_unmap_range>
+		return 0;
+  802511:	83 c4 10             	add    $0x10,%esp
+  802514:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802519:	c9                   	leave
+  80251a:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  80251b:	83 ec 0c             	sub    $0xc,%esp
+  80251e:	68 07 04 00 00       	push   $0x407
+  802523:	6a 08                	push   $0x8
+  802525:	68 00 30 ad de       	push   $0xdead3000
+  80252a:	6a 06                	push   $0x6
+  80252c:	ff 35 40 b0 80 00    	push   0x80b040
+  802532:	e8 01 25 00 00       	call   804a38 <ipc_call>
+  802537:	83 c4 20             	add    $0x20,%esp
+  80253a:	85 c0                	test   %eax,%eax
+  80253c:	78 14                	js     802552 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  80253e:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802543:	8b 40 48             	mov    0x48(%eax),%eax
+  802546:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  80254b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802550:	eb c7                	jmp    802519 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802552:	83 ec 04             	sub    $0x4,%esp
+  802555:	6a 08                	push   $0x8
+  802557:	68 00 30 ad de       	push   $0xdead3000
+  80255c:	6a 00                	push   $0x0
+  80255e:	e8 b6 e9 ff ff       	call   800f19 <sys_page_unmap_range>
+		return 0;
+  802563:	83 c4 10             	add    $0x10,%esp
+  802566:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256b:	eb ac                	jmp    802519 <page_ring_ready+0x59>
+
+0080256d <page_remove_slot>:
+{
+  80256d:	55                   	push   %ebp
+  80256e:	89 e5                	mov    %esp,%ebp
+  802570:	56                   	push   %esi
+  802571:	53                   	push   %ebx
+  802572:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802574:	89 c6                	mov    %eax,%esi
+  802576:	c1 ee 10             	shr    $0x10,%esi
+  802579:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  80257c:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  802583:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  802589:	74 2a                	je     8025b5 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  80258b:	83 ec 0c             	sub    $0xc,%esp
+  80258e:	6a 00                	push   $0x0
+  802590:	6a 00                	push   $0x0
+  802592:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802594:	c1 e3 04             	shl    $0x4,%ebx
+  802597:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  80259a:	53                   	push   %ebx
+  80259b:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8025a2:	e8 91 24 00 00       	call   804a38 <ipc_call>
+  8025a7:	83 c4 20             	add    $0x20,%esp
+  8025aa:	85 c0                	test   %eax,%eax
+  8025ac:	78 2d                	js     8025db <page_remove_slot+0x6e>
+}
+  8025ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025b1:	5b                   	pop    %ebx
+  8025b2:	5e                   	pop    %esi
+  8025b3:	5d                   	pop    %ebp
+  8025b4:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8025b5:	e8 06 ff ff ff       	call   8024c0 <page_ring_ready>
+  8025ba:	85 c0                	test   %eax,%eax
+  8025bc:	74 cd                	je     80258b <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  8025be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025c3:	e8 46 fe ff ff       	call   80240e <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  8025c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025cd:	89 da                	mov    %ebx,%edx
+  8025cf:	b8 02 00 00 00       	mov    $0x2,%eax
+  8025d4:	e8 69 fd ff ff       	call   802342 <page_ring_post>
+		return;
+  8025d9:	eb d3                	jmp    8025ae <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  8025db:	50                   	push   %eax
+  8025dc:	68 30 53 80 00       	push   $0x805330
+  8025e1:	68 ac 03 00 00       	push   $0x3ac
+  8025e6:	68 d5 52 80 00       	push   $0x8052d5
+  8025eb:	e8 db db ff ff       	call   8001cb <_panic>
+
+008025f0 <find_paging_env>:
+	if(pagingenv)
+  8025f0:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  8025f5:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  8025f7:	85 c0                	test   %eax,%eax
+  8025f9:	74 05                	je     802600 <find_paging_env+0x10>
+  8025fb:	eb 56                	jmp    802653 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  8025fd:	83 c0 01             	add    $0x1,%eax
+  802600:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802605:	7f 47                	jg     80264e <find_paging_env+0x5e>
+  802607:	83 f9 01             	cmp    $0x1,%ecx
+  80260a:	7f 42                	jg     80264e <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  80260c:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  80260f:	c1 e2 06             	shl    $0x6,%edx
+  802612:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802618:	8b 52 50             	mov    0x50(%edx),%edx
+  80261b:	83 fa 02             	cmp    $0x2,%edx
+  80261e:	75 dd                	jne    8025fd <find_paging_env+0xd>
+  802620:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802623:	c1 e2 06             	shl    $0x6,%edx
+  802626:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80262c:	8b 52 54             	mov    0x54(%edx),%edx
+  80262f:	85 d2                	test   %edx,%edx
+  802631:	74 ca                	je     8025fd <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802633:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802636:	c1 e2 06             	shl    $0x6,%edx
+  802639:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80263f:	8b 52 48             	mov    0x48(%edx),%edx
+  802642:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  802649:	8d 49 01             	lea    0x1(%ecx),%ecx
+  80264c:	eb af                	jmp    8025fd <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  80264e:	83 f9 02             	cmp    $0x2,%ecx
+  802651:	74 01                	je     802654 <find_paging_env+0x64>
+}
+  802653:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802654:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802659:	8b 40 48             	mov    0x48(%eax),%eax
+  80265c:	83 e0 01             	and    $0x1,%eax
+  80265f:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  802666:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  80266b:	eb e6                	jmp    802653 <find_paging_env+0x63>
+
+0080266d <page_add_backed>:
+{
+  80266d:	55                   	push   %ebp
+  80266e:	89 e5                	mov    %esp,%ebp
+  802670:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802673:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  802678:	83 f8 04             	cmp    $0x4,%eax
+  80267b:	74 35                	je     8026b2 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  80267d:	89 d1                	mov    %edx,%ecx
+  80267f:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802685:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  80268c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80268f:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802696:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  80269c:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  8026a3:	83 c0 01             	add    $0x1,%eax
+  8026a6:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  8026ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026b0:	5d                   	pop    %ebp
+  8026b1:	c3                   	ret
+		return -E_NO_MEM;
+  8026b2:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8026b7:	eb f7                	jmp    8026b0 <page_add_backed+0x43>
+
+008026b9 <percentage_of_pgdir_to_walk>:
+{
+  8026b9:	55                   	push   %ebp
+  8026ba:	89 e5                	mov    %esp,%ebp
+  8026bc:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  8026bf:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  8026c3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  8026c6:	db 45 fc             	fildl  -0x4(%ebp)
+  8026c9:	d8 35 bc 57 80 00    	fdivs  0x8057bc
+	return ret*ret;
+  8026cf:	d8 c8                	fmul   %st(0),%st
+}
+  8026d1:	c9                   	leave
+  8026d2:	c3                   	ret
+
+008026d3 <nfu_with_aging_page_choice_func>:
+{
+  8026d3:	55                   	push   %ebp
+  8026d4:	89 e5                	mov    %esp,%ebp
+  8026d6:	57                   	push   %edi
+  8026d7:	56                   	push   %esi
+  8026d8:	53                   	push   %ebx
+  8026d9:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8026dc:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  8026e2:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  8026e4:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8026e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026ee:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8026f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026fa:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  8026fd:	eb 18                	jmp    802717 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8026ff:	f7 d0                	not    %eax
+  802701:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802706:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802708:	83 c2 01             	add    $0x1,%edx
+  80270b:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802711:	0f 87 13 01 00 00    	ja     80282a <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802717:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80271b:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  80271e:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802723:	89 c1                	mov    %eax,%ecx
+  802725:	c1 e9 0a             	shr    $0xa,%ecx
+  802728:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80272f:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802735:	83 f9 01             	cmp    $0x1,%ecx
+  802738:	75 c5                	jne    8026ff <nfu_with_aging_page_choice_func+0x2c>
+  80273a:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  80273f:	77 be                	ja     8026ff <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802741:	89 c1                	mov    %eax,%ecx
+  802743:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802746:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  80274c:	0f 82 a5 00 00 00    	jb     8027f7 <nfu_with_aging_page_choice_func+0x124>
+  802752:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802758:	0f 87 99 00 00 00    	ja     8027f7 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80275e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802765:	f6 c1 01             	test   $0x1,%cl
+  802768:	0f 84 89 00 00 00    	je     8027f7 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80276e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802775:	f6 c5 04             	test   $0x4,%ch
+  802778:	75 7d                	jne    8027f7 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80277a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802781:	f6 c5 02             	test   $0x2,%ch
+  802784:	75 71                	jne    8027f7 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802786:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80278d:	c1 e9 0c             	shr    $0xc,%ecx
+  802790:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802793:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802799:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  80279d:	66 83 f9 01          	cmp    $0x1,%cx
+  8027a1:	77 54                	ja     8027f7 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  8027a3:	89 f9                	mov    %edi,%ecx
+  8027a5:	80 f9 ff             	cmp    $0xff,%cl
+  8027a8:	74 21                	je     8027cb <nfu_with_aging_page_choice_func+0xf8>
+  8027aa:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8027b1:	c1 e9 0c             	shr    $0xc,%ecx
+  8027b4:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8027b7:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8027bd:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  8027c1:	89 fb                	mov    %edi,%ebx
+  8027c3:	38 d9                	cmp    %bl,%cl
+  8027c5:	73 30                	jae    8027f7 <nfu_with_aging_page_choice_func+0x124>
+  8027c7:	dd d8                	fstp   %st(0)
+  8027c9:	eb 02                	jmp    8027cd <nfu_with_aging_page_choice_func+0xfa>
+  8027cb:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  8027cd:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8027d4:	c1 e9 0c             	shr    $0xc,%ecx
+  8027d7:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8027da:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  8027e1:	89 fb                	mov    %edi,%ebx
+  8027e3:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  8027e6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8027e9:	db 45 e0             	fildl  -0x20(%ebp)
+  8027ec:	d8 35 bc 57 80 00    	fdivs  0x8057bc
+	return ret*ret;
+  8027f2:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8027f4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8027f7:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8027fa:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8027fd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802804:	df 6d e0             	fildll -0x20(%ebp)
+  802807:	d9 c1                	fld    %st(1)
+  802809:	d8 0d c0 57 80 00    	fmuls  0x8057c0
+  80280f:	d9 c9                	fxch   %st(1)
+  802811:	df f1                	fcomip %st(1),%st
+  802813:	dd d8                	fstp   %st(0)
+  802815:	0f 82 ed fe ff ff    	jb     802708 <nfu_with_aging_page_choice_func+0x35>
+  80281b:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  80281d:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  802822:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802825:	c1 e0 0c             	shl    $0xc,%eax
+  802828:	eb 0e                	jmp    802838 <nfu_with_aging_page_choice_func+0x165>
+  80282a:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  80282c:	89 f8                	mov    %edi,%eax
+  80282e:	3c ff                	cmp    $0xff,%al
+  802830:	74 0e                	je     802840 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802832:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802835:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802838:	83 c4 14             	add    $0x14,%esp
+  80283b:	5b                   	pop    %ebx
+  80283c:	5e                   	pop    %esi
+  80283d:	5f                   	pop    %edi
+  80283e:	5d                   	pop    %ebp
+  80283f:	c3                   	ret
+	pgnum = 0;
+  802840:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  802847:	00 00 00 
+	return (void*)UTOP;
+  80284a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80284f:	eb e7                	jmp    802838 <nfu_with_aging_page_choice_func+0x165>
+
+00802851 <myRand>:
+    state = state * 1664525 + 1013904223;
+  802851:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  802858:	66 19 00 
+  80285b:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802860:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  802865:	c1 e8 18             	shr    $0x18,%eax
+}
+  802868:	c3                   	ret
+
+00802869 <random_page_choice_func>:
+{
+  802869:	55                   	push   %ebp
+  80286a:	89 e5                	mov    %esp,%ebp
+  80286c:	57                   	push   %edi
+  80286d:	56                   	push   %esi
+  80286e:	53                   	push   %ebx
+  80286f:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802872:	be 00 00 00 00       	mov    $0x0,%esi
+  802877:	eb 19                	jmp    802892 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802879:	f7 d3                	not    %ebx
+  80287b:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802881:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802883:	83 c6 01             	add    $0x1,%esi
+  802886:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  80288c:	0f 87 a0 00 00 00    	ja     802932 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802892:	89 f3                	mov    %esi,%ebx
+  802894:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  80289a:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8028a0:	89 d8                	mov    %ebx,%eax
+  8028a2:	c1 e8 0a             	shr    $0xa,%eax
+  8028a5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8028ac:	25 81 00 00 00       	and    $0x81,%eax
+  8028b1:	83 f8 01             	cmp    $0x1,%eax
+  8028b4:	75 c3                	jne    802879 <random_page_choice_func+0x10>
+  8028b6:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8028bc:	77 bb                	ja     802879 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8028be:	89 df                	mov    %ebx,%edi
+  8028c0:	c1 e7 0c             	shl    $0xc,%edi
+  8028c3:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8028c6:	89 f8                	mov    %edi,%eax
+  8028c8:	e8 06 f9 ff ff       	call   8021d3 <page_is_clean>
+  8028cd:	84 c0                	test   %al,%al
+  8028cf:	0f 85 82 00 00 00    	jne    802957 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8028d5:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  8028db:	72 a6                	jb     802883 <random_page_choice_func+0x1a>
+  8028dd:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  8028e3:	77 9e                	ja     802883 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8028e5:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8028ec:	a8 01                	test   $0x1,%al
+  8028ee:	74 93                	je     802883 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8028f0:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8028f7:	f6 c4 04             	test   $0x4,%ah
+  8028fa:	75 87                	jne    802883 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8028fc:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802903:	f6 c4 02             	test   $0x2,%ah
+  802906:	0f 85 77 ff ff ff    	jne    802883 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80290c:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802913:	c1 e8 0c             	shr    $0xc,%eax
+  802916:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802919:	05 00 00 00 ef       	add    $0xef000000,%eax
+  80291e:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802922:	66 83 f8 01          	cmp    $0x1,%ax
+  802926:	0f 87 57 ff ff ff    	ja     802883 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  80292c:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802932:	e8 1a ff ff ff       	call   802851 <myRand>
+  802937:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  80293d:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  802942:	29 fe                	sub    %edi,%esi
+  802944:	0f be c0             	movsbl %al,%eax
+  802947:	ba 00 00 00 00       	mov    $0x0,%edx
+  80294c:	f7 f6                	div    %esi
+  80294e:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802950:	bb 15 00 00 00       	mov    $0x15,%ebx
+  802955:	eb 1c                	jmp    802973 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  802957:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  80295d:	e9 8f 00 00 00       	jmp    8029f1 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802962:	e8 ea fe ff ff       	call   802851 <myRand>
+  802967:	0f be c0             	movsbl %al,%eax
+  80296a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80296f:	f7 f6                	div    %esi
+  802971:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802973:	83 eb 01             	sub    $0x1,%ebx
+  802976:	0f 84 c2 00 00 00    	je     802a3e <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  80297c:	89 d0                	mov    %edx,%eax
+  80297e:	c1 e8 0a             	shr    $0xa,%eax
+  802981:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802988:	25 81 00 00 00       	and    $0x81,%eax
+  80298d:	83 f8 01             	cmp    $0x1,%eax
+  802990:	75 d0                	jne    802962 <random_page_choice_func+0xf9>
+  802992:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  802998:	77 c8                	ja     802962 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  80299a:	89 d0                	mov    %edx,%eax
+  80299c:	c1 e0 0c             	shl    $0xc,%eax
+  80299f:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  8029a4:	72 56                	jb     8029fc <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8029a6:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  8029ab:	77 65                	ja     802a12 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8029ad:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8029b4:	f6 c1 01             	test   $0x1,%cl
+  8029b7:	74 59                	je     802a12 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8029b9:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8029c0:	f6 c5 04             	test   $0x4,%ch
+  8029c3:	75 4d                	jne    802a12 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  8029c5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8029cc:	f6 c5 02             	test   $0x2,%ch
+  8029cf:	75 41                	jne    802a12 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  8029d1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8029d8:	c1 ea 0c             	shr    $0xc,%edx
+  8029db:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  8029de:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  8029e4:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  8029e8:	66 83 fa 01          	cmp    $0x1,%dx
+  8029ec:	77 3a                	ja     802a28 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  8029ee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  8029f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029f4:	83 c4 1c             	add    $0x1c,%esp
+  8029f7:	5b                   	pop    %ebx
+  8029f8:	5e                   	pop    %esi
+  8029f9:	5f                   	pop    %edi
+  8029fa:	5d                   	pop    %ebp
+  8029fb:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8029fc:	e8 50 fe ff ff       	call   802851 <myRand>
+  802a01:	0f be c0             	movsbl %al,%eax
+  802a04:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a09:	f7 f6                	div    %esi
+  802a0b:	01 fa                	add    %edi,%edx
+			continue;
+  802a0d:	e9 61 ff ff ff       	jmp    802973 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802a12:	e8 3a fe ff ff       	call   802851 <myRand>
+  802a17:	0f be c0             	movsbl %al,%eax
+  802a1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a1f:	f7 f6                	div    %esi
+  802a21:	01 fa                	add    %edi,%edx
+			continue;
+  802a23:	e9 4b ff ff ff       	jmp    802973 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802a28:	e8 24 fe ff ff       	call   802851 <myRand>
+  802a2d:	0f be c0             	movsbl %al,%eax
+  802a30:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a35:	f7 f6                	div    %esi
+  802a37:	01 fa                	add    %edi,%edx
+			continue;
+  802a39:	e9 35 ff ff ff       	jmp    802973 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  802a3e:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  802a45:	00 00 00 
+	return (void*)UTOP;
+  802a48:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  802a4f:	eb a0                	jmp    8029f1 <random_page_choice_func+0x188>
+
+00802a51 <nfu>:
+{
+  802a51:	55                   	push   %ebp
+  802a52:	89 e5                	mov    %esp,%ebp
+  802a54:	57                   	push   %edi
+  802a55:	56                   	push   %esi
+  802a56:	53                   	push   %ebx
+  802a57:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802a5a:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  802a60:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802a62:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802a67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a6c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802a73:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a78:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802a7b:	eb 18                	jmp    802a95 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802a7d:	f7 d0                	not    %eax
+  802a7f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802a84:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802a86:	83 c2 01             	add    $0x1,%edx
+  802a89:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802a8f:	0f 87 13 01 00 00    	ja     802ba8 <nfu+0x157>
+		++num_searched_ptes;
+  802a95:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802a99:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802a9c:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802aa1:	89 c1                	mov    %eax,%ecx
+  802aa3:	c1 e9 0a             	shr    $0xa,%ecx
+  802aa6:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802aad:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802ab3:	83 f9 01             	cmp    $0x1,%ecx
+  802ab6:	75 c5                	jne    802a7d <nfu+0x2c>
+  802ab8:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802abd:	77 be                	ja     802a7d <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802abf:	89 c1                	mov    %eax,%ecx
+  802ac1:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802ac4:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802aca:	0f 82 a5 00 00 00    	jb     802b75 <nfu+0x124>
+  802ad0:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802ad6:	0f 87 99 00 00 00    	ja     802b75 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802adc:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802ae3:	f6 c1 01             	test   $0x1,%cl
+  802ae6:	0f 84 89 00 00 00    	je     802b75 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802aec:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802af3:	f6 c5 04             	test   $0x4,%ch
+  802af6:	75 7d                	jne    802b75 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802af8:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802aff:	f6 c5 02             	test   $0x2,%ch
+  802b02:	75 71                	jne    802b75 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802b04:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b0b:	c1 e9 0c             	shr    $0xc,%ecx
+  802b0e:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b11:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802b17:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802b1b:	66 83 f9 01          	cmp    $0x1,%cx
+  802b1f:	77 54                	ja     802b75 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  802b21:	89 f9                	mov    %edi,%ecx
+  802b23:	80 f9 ff             	cmp    $0xff,%cl
+  802b26:	74 21                	je     802b49 <nfu+0xf8>
+  802b28:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b2f:	c1 e9 0c             	shr    $0xc,%ecx
+  802b32:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b35:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802b3b:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  802b3f:	89 fb                	mov    %edi,%ebx
+  802b41:	38 d9                	cmp    %bl,%cl
+  802b43:	73 30                	jae    802b75 <nfu+0x124>
+  802b45:	dd d8                	fstp   %st(0)
+  802b47:	eb 02                	jmp    802b4b <nfu+0xfa>
+  802b49:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  802b4b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b52:	c1 e9 0c             	shr    $0xc,%ecx
+  802b55:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b58:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802b5f:	89 fb                	mov    %edi,%ebx
+  802b61:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802b64:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802b67:	db 45 e0             	fildl  -0x20(%ebp)
+  802b6a:	d8 35 bc 57 80 00    	fdivs  0x8057bc
+	return ret*ret;
+  802b70:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802b72:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802b75:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802b78:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802b7b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802b82:	df 6d e0             	fildll -0x20(%ebp)
+  802b85:	d9 c1                	fld    %st(1)
+  802b87:	d8 0d c0 57 80 00    	fmuls  0x8057c0
+  802b8d:	d9 c9                	fxch   %st(1)
+  802b8f:	df f1                	fcomip %st(1),%st
+  802b91:	dd d8                	fstp   %st(0)
+  802b93:	0f 82 ed fe ff ff    	jb     802a86 <nfu+0x35>
+  802b99:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802b9b:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  802ba0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802ba3:	c1 e0 0c             	shl    $0xc,%eax
+  802ba6:	eb 0e                	jmp    802bb6 <nfu+0x165>
+  802ba8:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802baa:	89 f8                	mov    %edi,%eax
+  802bac:	3c ff                	cmp    $0xff,%al
+  802bae:	74 0e                	je     802bbe <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802bb0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802bb3:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802bb6:	83 c4 14             	add    $0x14,%esp
+  802bb9:	5b                   	pop    %ebx
+  802bba:	5e                   	pop    %esi
+  802bbb:	5f                   	pop    %edi
+  802bbc:	5d                   	pop    %ebp
+  802bbd:	c3                   	ret
+	pgnum = 0;
+  802bbe:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  802bc5:	00 00 00 
+	return (void*)UTOP;
+  802bc8:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802bcd:	eb e7                	jmp    802bb6 <nfu+0x165>
+
+00802bcf <lru>:
+{
+  802bcf:	55                   	push   %ebp
+  802bd0:	89 e5                	mov    %esp,%ebp
+  802bd2:	57                   	push   %edi
+  802bd3:	56                   	push   %esi
+  802bd4:	53                   	push   %ebx
+  802bd5:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802bd8:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  802bde:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  802be5:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802bec:	be 00 00 00 00       	mov    $0x0,%esi
+  802bf1:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802bf8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bfd:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  802c00:	eb 18                	jmp    802c1a <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802c02:	f7 d0                	not    %eax
+  802c04:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802c09:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c0b:	83 c2 01             	add    $0x1,%edx
+  802c0e:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802c14:	0f 87 fa 00 00 00    	ja     802d14 <lru+0x145>
+		++num_searched_ptes;
+  802c1a:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c1d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802c20:	01 d0                	add    %edx,%eax
+  802c22:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802c27:	89 c1                	mov    %eax,%ecx
+  802c29:	c1 e9 0a             	shr    $0xa,%ecx
+  802c2c:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802c33:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802c39:	83 f9 01             	cmp    $0x1,%ecx
+  802c3c:	75 c4                	jne    802c02 <lru+0x33>
+  802c3e:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802c43:	77 bd                	ja     802c02 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802c45:	89 c1                	mov    %eax,%ecx
+  802c47:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802c4a:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802c50:	0f 87 92 00 00 00    	ja     802ce8 <lru+0x119>
+  802c56:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802c5c:	0f 82 86 00 00 00    	jb     802ce8 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802c62:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802c69:	f6 c1 01             	test   $0x1,%cl
+  802c6c:	74 7a                	je     802ce8 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802c6e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802c75:	f6 c5 04             	test   $0x4,%ch
+  802c78:	75 6e                	jne    802ce8 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802c7a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802c81:	f6 c5 02             	test   $0x2,%ch
+  802c84:	75 62                	jne    802ce8 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802c86:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802c8d:	c1 e9 0c             	shr    $0xc,%ecx
+  802c90:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802c93:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802c99:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802c9d:	66 83 f9 01          	cmp    $0x1,%cx
+  802ca1:	77 45                	ja     802ce8 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  802ca3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802caa:	c1 e9 0c             	shr    $0xc,%ecx
+  802cad:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802cb0:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802cb6:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802cb9:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802cbc:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  802cbf:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802cc2:	19 df                	sbb    %ebx,%edi
+  802cc4:	7c 22                	jl     802ce8 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  802cc6:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802ccd:	c1 e9 0c             	shr    $0xc,%ecx
+  802cd0:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802cd3:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802cd9:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802cdc:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802cdf:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802ce2:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802ce5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802ce8:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  802ceb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802cf2:	df 6d e0             	fildll -0x20(%ebp)
+  802cf5:	d9 05 c0 57 80 00    	flds   0x8057c0
+  802cfb:	d9 c9                	fxch   %st(1)
+  802cfd:	df f1                	fcomip %st(1),%st
+  802cff:	dd d8                	fstp   %st(0)
+  802d01:	0f 82 04 ff ff ff    	jb     802c0b <lru+0x3c>
+			pgnum = pgnum_actual;
+  802d07:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  802d0c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d0f:	c1 e0 0c             	shl    $0xc,%eax
+  802d12:	eb 06                	jmp    802d1a <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  802d14:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d17:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802d1a:	83 c4 1c             	add    $0x1c,%esp
+  802d1d:	5b                   	pop    %ebx
+  802d1e:	5e                   	pop    %esi
+  802d1f:	5f                   	pop    %edi
+  802d20:	5d                   	pop    %ebp
+  802d21:	c3                   	ret
+
+00802d22 <set_page_choice_func>:
+{
+  802d22:	55                   	push   %ebp
+  802d23:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  802d25:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d28:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  802d2d:	5d                   	pop    %ebp
+  802d2e:	c3                   	ret
+
+00802d2f <get_page_choice>:
+{
+  802d2f:	55                   	push   %ebp
+  802d30:	89 e5                	mov    %esp,%ebp
+  802d32:	57                   	push   %edi
+  802d33:	56                   	push   %esi
+  802d34:	53                   	push   %ebx
+  802d35:	83 ec 24             	sub    $0x24,%esp
+  802d38:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d3b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  802d3e:	57                   	push   %edi
+  802d3f:	56                   	push   %esi
+  802d40:	ff 15 3c 60 80 00    	call   *0x80603c
+  802d46:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802d48:	83 c4 10             	add    $0x10,%esp
+  802d4b:	eb 25                	jmp    802d72 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  802d4d:	83 ec 08             	sub    $0x8,%esp
+  802d50:	c1 e0 16             	shl    $0x16,%eax
+  802d53:	50                   	push   %eax
+  802d54:	6a 00                	push   $0x0
+  802d56:	e8 ec e0 ff ff       	call   800e47 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802d5b:	83 c4 10             	add    $0x10,%esp
+  802d5e:	85 c0                	test   %eax,%eax
+  802d60:	75 43                	jne    802da5 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  802d62:	83 ec 08             	sub    $0x8,%esp
+  802d65:	57                   	push   %edi
+  802d66:	56                   	push   %esi
+  802d67:	ff 15 3c 60 80 00    	call   *0x80603c
+  802d6d:	89 c3                	mov    %eax,%ebx
+  802d6f:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802d72:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802d75:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  802d7b:	0f 86 ae 00 00 00    	jbe    802e2f <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802d81:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  802d86:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802d8d:	81 e2 81 00 00 00    	and    $0x81,%edx
+  802d93:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  802d99:	74 b2                	je     802d4d <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802d9b:	83 c0 01             	add    $0x1,%eax
+  802d9e:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  802da3:	75 e1                	jne    802d86 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802da5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802da8:	05 00 10 40 11       	add    $0x11401000,%eax
+  802dad:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802db2:	76 1f                	jbe    802dd3 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  802db4:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  802db9:	89 d8                	mov    %ebx,%eax
+  802dbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dbe:	5b                   	pop    %ebx
+  802dbf:	5e                   	pop    %esi
+  802dc0:	5f                   	pop    %edi
+  802dc1:	5d                   	pop    %ebp
+  802dc2:	c3                   	ret
+		sys_page_split(0, pg_out);
+  802dc3:	83 ec 08             	sub    $0x8,%esp
+  802dc6:	53                   	push   %ebx
+  802dc7:	6a 00                	push   $0x0
+  802dc9:	e8 79 e0 ff ff       	call   800e47 <sys_page_split>
+  802dce:	83 c4 10             	add    $0x10,%esp
+  802dd1:	eb 6c                	jmp    802e3f <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  802dd3:	83 ec 04             	sub    $0x4,%esp
+  802dd6:	68 68 53 80 00       	push   $0x805368
+  802ddb:	68 cc 01 00 00       	push   $0x1cc
+  802de0:	68 d5 52 80 00       	push   $0x8052d5
+  802de5:	e8 e1 d3 ff ff       	call   8001cb <_panic>
+		panic("We tried to page out code pages\n");
+  802dea:	83 ec 04             	sub    $0x4,%esp
+  802ded:	68 98 53 80 00       	push   $0x805398
+  802df2:	68 d6 01 00 00       	push   $0x1d6
+  802df7:	68 d5 52 80 00       	push   $0x8052d5
+  802dfc:	e8 ca d3 ff ff       	call   8001cb <_panic>
+		panic("Invalid mapping for the va\n");
+  802e01:	83 ec 04             	sub    $0x4,%esp
+  802e04:	68 e2 52 80 00       	push   $0x8052e2
+  802e09:	68 da 01 00 00       	push   $0x1da
+  802e0e:	68 d5 52 80 00       	push   $0x8052d5
+  802e13:	e8 b3 d3 ff ff       	call   8001cb <_panic>
+		panic("We tried to page out a shared page\n");
+  802e18:	83 ec 04             	sub    $0x4,%esp
+  802e1b:	68 bc 53 80 00       	push   $0x8053bc
+  802e20:	68 e0 01 00 00       	push   $0x1e0
+  802e25:	68 d5 52 80 00       	push   $0x8052d5
+  802e2a:	e8 9c d3 ff ff       	call   8001cb <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  802e2f:	89 de                	mov    %ebx,%esi
+  802e31:	c1 ee 16             	shr    $0x16,%esi
+  802e34:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802e3b:	a8 80                	test   $0x80,%al
+  802e3d:	75 84                	jne    802dc3 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802e3f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e42:	05 00 10 40 11       	add    $0x11401000,%eax
+  802e47:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802e4c:	76 85                	jbe    802dd3 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  802e4e:	89 d8                	mov    %ebx,%eax
+  802e50:	e8 7e f3 ff ff       	call   8021d3 <page_is_clean>
+  802e55:	84 c0                	test   %al,%al
+  802e57:	0f 85 5c ff ff ff    	jne    802db9 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  802e5d:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  802e64:	76 84                	jbe    802dea <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  802e66:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802e6d:	a8 01                	test   $0x1,%al
+  802e6f:	74 90                	je     802e01 <get_page_choice+0xd2>
+  802e71:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e74:	c1 e8 0c             	shr    $0xc,%eax
+  802e77:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802e7e:	f6 c2 01             	test   $0x1,%dl
+  802e81:	0f 84 7a ff ff ff    	je     802e01 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802e87:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  802e8e:	f6 c2 01             	test   $0x1,%dl
+  802e91:	74 85                	je     802e18 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802e93:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802e9a:	f6 c2 01             	test   $0x1,%dl
+  802e9d:	0f 84 75 ff ff ff    	je     802e18 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802ea3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802eaa:	f6 c6 04             	test   $0x4,%dh
+  802ead:	0f 85 65 ff ff ff    	jne    802e18 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  802eb3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802eba:	f6 c6 02             	test   $0x2,%dh
+  802ebd:	0f 85 55 ff ff ff    	jne    802e18 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  802ec3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802eca:	c1 e8 0c             	shr    $0xc,%eax
+  802ecd:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802ed0:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802ed5:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802ed9:	66 83 f8 01          	cmp    $0x1,%ax
+  802edd:	0f 86 d6 fe ff ff    	jbe    802db9 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  802ee3:	83 ec 04             	sub    $0x4,%esp
+  802ee6:	68 e0 53 80 00       	push   $0x8053e0
+  802eeb:	68 e2 01 00 00       	push   $0x1e2
+  802ef0:	68 d5 52 80 00       	push   $0x8052d5
+  802ef5:	e8 d1 d2 ff ff       	call   8001cb <_panic>
+
+00802efa <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  802efa:	55                   	push   %ebp
+  802efb:	89 e5                	mov    %esp,%ebp
+  802efd:	57                   	push   %edi
+  802efe:	56                   	push   %esi
+  802eff:	53                   	push   %ebx
+  802f00:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  802f03:	e8 e8 f6 ff ff       	call   8025f0 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  802f08:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802f0d:	85 c0                	test   %eax,%eax
+  802f0f:	74 41                	je     802f52 <page_share_paged_out+0x58>
+  802f11:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  802f18:	0f 84 fd 00 00 00    	je     80301b <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  802f1e:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802f25:	00 00 00 
+  802f28:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  802f2f:	00 00 00 
+  802f32:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f37:	eb 2c                	jmp    802f65 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802f39:	83 c3 04             	add    $0x4,%ebx
+  802f3c:	39 f3                	cmp    %esi,%ebx
+  802f3e:	74 1a                	je     802f5a <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  802f40:	8b 03                	mov    (%ebx),%eax
+  802f42:	a8 01                	test   $0x1,%al
+  802f44:	74 f3                	je     802f39 <page_share_paged_out+0x3f>
+  802f46:	c1 e8 0c             	shr    $0xc,%eax
+  802f49:	e8 2b f5 ff ff       	call   802479 <page_share_slot>
+  802f4e:	85 c0                	test   %eax,%eax
+  802f50:	79 e7                	jns    802f39 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  802f52:	83 c4 0c             	add    $0xc,%esp
+  802f55:	5b                   	pop    %ebx
+  802f56:	5e                   	pop    %esi
+  802f57:	5f                   	pop    %edi
+  802f58:	5d                   	pop    %ebp
+  802f59:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  802f5a:	83 c7 04             	add    $0x4,%edi
+  802f5d:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  802f63:	74 1b                	je     802f80 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  802f65:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  802f6a:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  802f6d:	f6 c3 01             	test   $0x1,%bl
+  802f70:	74 e8                	je     802f5a <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  802f72:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802f78:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  802f7e:	eb bc                	jmp    802f3c <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802f80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f85:	eb 11                	jmp    802f98 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  802f87:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802f8d:	83 c3 01             	add    $0x1,%ebx
+  802f90:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802f96:	77 41                	ja     802fd9 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  802f98:	89 d8                	mov    %ebx,%eax
+  802f9a:	c1 e8 0a             	shr    $0xa,%eax
+  802f9d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802fa4:	25 81 00 00 00       	and    $0x81,%eax
+  802fa9:	83 f8 01             	cmp    $0x1,%eax
+  802fac:	75 d9                	jne    802f87 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  802fae:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802fb5:	25 81 00 00 00       	and    $0x81,%eax
+  802fba:	3d 80 00 00 00       	cmp    $0x80,%eax
+  802fbf:	75 cc                	jne    802f8d <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  802fc1:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802fc8:	c1 e8 0c             	shr    $0xc,%eax
+  802fcb:	e8 a9 f4 ff ff       	call   802479 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  802fd0:	85 c0                	test   %eax,%eax
+  802fd2:	79 b9                	jns    802f8d <page_share_paged_out+0x93>
+  802fd4:	e9 79 ff ff ff       	jmp    802f52 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  802fd9:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802fe0:	75 13                	jne    802ff5 <page_share_paged_out+0xfb>
+  802fe2:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802fe9:	75 1d                	jne    803008 <page_share_paged_out+0x10e>
+	return 0;
+  802feb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff0:	e9 5d ff ff ff       	jmp    802f52 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  802ff5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ffa:	e8 46 f4 ff ff       	call   802445 <page_share_send>
+  802fff:	85 c0                	test   %eax,%eax
+  803001:	79 df                	jns    802fe2 <page_share_paged_out+0xe8>
+  803003:	e9 4a ff ff ff       	jmp    802f52 <page_share_paged_out+0x58>
+  803008:	b8 01 00 00 00       	mov    $0x1,%eax
+  80300d:	e8 33 f4 ff ff       	call   802445 <page_share_send>
+  803012:	85 c0                	test   %eax,%eax
+  803014:	79 d5                	jns    802feb <page_share_paged_out+0xf1>
+  803016:	e9 37 ff ff ff       	jmp    802f52 <page_share_paged_out+0x58>
+		return 0;
+  80301b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803020:	e9 2d ff ff ff       	jmp    802f52 <page_share_paged_out+0x58>
+
+00803025 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  803025:	55                   	push   %ebp
+  803026:	89 e5                	mov    %esp,%ebp
+  803028:	56                   	push   %esi
+  803029:	53                   	push   %ebx
+  80302a:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  80302d:	e8 be f5 ff ff       	call   8025f0 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  803032:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  803037:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  80303e:	0f 84 82 00 00 00    	je     8030c6 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  803044:	83 ec 0c             	sub    $0xc,%esp
+  803047:	68 00 10 00 00       	push   $0x1000
+  80304c:	e8 84 11 00 00       	call   8041d5 <malloc>
+  803051:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  803053:	83 c4 0c             	add    $0xc,%esp
+  803056:	6a 14                	push   $0x14
+  803058:	6a 00                	push   $0x0
+  80305a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80305d:	50                   	push   %eax
+  80305e:	e8 7b d9 ff ff       	call   8009de <memset>
+  803063:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  803066:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  80306b:	83 ec 0c             	sub    $0xc,%esp
+  80306e:	6a 07                	push   $0x7
+  803070:	6a 01                	push   $0x1
+  803072:	53                   	push   %ebx
+  803073:	6a 03                	push   $0x3
+  803075:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  80307c:	e8 b7 19 00 00       	call   804a38 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  803081:	8b 03                	mov    (%ebx),%eax
+  803083:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803086:	8b 43 04             	mov    0x4(%ebx),%eax
+  803089:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  80308c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80308f:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  803092:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803095:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  803098:	8b 43 10             	mov    0x10(%ebx),%eax
+  80309b:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  80309e:	83 c6 01             	add    $0x1,%esi
+  8030a1:	83 c4 20             	add    $0x20,%esp
+  8030a4:	83 fe 02             	cmp    $0x2,%esi
+  8030a7:	75 c2                	jne    80306b <get_paging_stats+0x46>
+	}
+	*stats = total;
+  8030a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030ac:	89 03                	mov    %eax,(%ebx)
+  8030ae:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8030b1:	89 43 04             	mov    %eax,0x4(%ebx)
+  8030b4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8030b7:	89 43 08             	mov    %eax,0x8(%ebx)
+  8030ba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8030bd:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8030c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030c3:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  8030c6:	89 d8                	mov    %ebx,%eax
+  8030c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030cb:	5b                   	pop    %ebx
+  8030cc:	5e                   	pop    %esi
+  8030cd:	5d                   	pop    %ebp
+  8030ce:	c3                   	ret
+
+008030cf <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  8030cf:	55                   	push   %ebp
+  8030d0:	89 e5                	mov    %esp,%ebp
+  8030d2:	53                   	push   %ebx
+  8030d3:	83 ec 10             	sub    $0x10,%esp
+  8030d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  8030d9:	68 f7 4d 80 00       	push   $0x804df7
+  8030de:	e8 c3 d1 ff ff       	call   8002a6 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  8030e3:	83 c4 08             	add    $0x8,%esp
+  8030e6:	ff 33                	push   (%ebx)
+  8030e8:	68 14 54 80 00       	push   $0x805414
+  8030ed:	e8 b4 d1 ff ff       	call   8002a6 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  8030f2:	83 c4 08             	add    $0x8,%esp
+  8030f5:	ff 73 04             	push   0x4(%ebx)
+  8030f8:	68 fe 52 80 00       	push   $0x8052fe
+  8030fd:	e8 a4 d1 ff ff       	call   8002a6 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  803102:	83 c4 08             	add    $0x8,%esp
+  803105:	ff 73 08             	push   0x8(%ebx)
+  803108:	68 34 54 80 00       	push   $0x805434
+  80310d:	e8 94 d1 ff ff       	call   8002a6 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  803112:	83 c4 08             	add    $0x8,%esp
+  803115:	ff 73 0c             	push   0xc(%ebx)
+  803118:	68 58 54 80 00       	push   $0x805458
+  80311d:	e8 84 d1 ff ff       	call   8002a6 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  803122:	83 c4 08             	add    $0x8,%esp
+  803125:	ff 73 10             	push   0x10(%ebx)
+  803128:	68 7c 54 80 00       	push   $0x80547c
+  80312d:	e8 74 d1 ff ff       	call   8002a6 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  803132:	83 c4 08             	add    $0x8,%esp
+  803135:	ff 35 08 b0 80 00    	push   0x80b008
+  80313b:	68 b8 54 80 00       	push   $0x8054b8
+  803140:	e8 61 d1 ff ff       	call   8002a6 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  803145:	83 c4 08             	add    $0x8,%esp
+  803148:	ff 35 04 b0 80 00    	push   0x80b004
+  80314e:	68 ec 54 80 00       	push   $0x8054ec
+  803153:	e8 4e d1 ff ff       	call   8002a6 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  803158:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80315d:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  803160:	8b 50 68             	mov    0x68(%eax),%edx
+  803163:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  803166:	51                   	push   %ecx
+  803167:	52                   	push   %edx
+  803168:	50                   	push   %eax
+  803169:	68 2c 55 80 00       	push   $0x80552c
+  80316e:	e8 33 d1 ff ff       	call   8002a6 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  803173:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803178:	8b 40 70             	mov    0x70(%eax),%eax
+  80317b:	83 c4 18             	add    $0x18,%esp
+  80317e:	50                   	push   %eax
+  80317f:	68 60 55 80 00       	push   $0x805560
+  803184:	e8 1d d1 ff ff       	call   8002a6 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  803189:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  80318f:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803195:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  80319a:	51                   	push   %ecx
+  80319b:	52                   	push   %edx
+  80319c:	50                   	push   %eax
+  80319d:	68 90 55 80 00       	push   $0x805590
+  8031a2:	e8 ff d0 ff ff       	call   8002a6 <cprintf>
+	cprintf("\n");
+  8031a7:	83 c4 14             	add    $0x14,%esp
+  8031aa:	68 f7 4d 80 00       	push   $0x804df7
+  8031af:	e8 f2 d0 ff ff       	call   8002a6 <cprintf>
+}
+  8031b4:	83 c4 10             	add    $0x10,%esp
+  8031b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031ba:	c9                   	leave
+  8031bb:	c3                   	ret
+
+008031bc <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  8031bc:	55                   	push   %ebp
+  8031bd:	89 e5                	mov    %esp,%ebp
+  8031bf:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  8031c2:	e8 5e fe ff ff       	call   803025 <get_paging_stats>
+  8031c7:	83 ec 0c             	sub    $0xc,%esp
+  8031ca:	50                   	push   %eax
+  8031cb:	e8 ff fe ff ff       	call   8030cf <print_paging_stats>
+}
+  8031d0:	83 c4 10             	add    $0x10,%esp
+  8031d3:	c9                   	leave
+  8031d4:	c3                   	ret
+
+008031d5 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  8031d5:	55                   	push   %ebp
+  8031d6:	89 e5                	mov    %esp,%ebp
+  8031d8:	53                   	push   %ebx
+  8031d9:	83 ec 04             	sub    $0x4,%esp
+  8031dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  8031df:	eb 13                	jmp    8031f4 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  8031e1:	83 ec 04             	sub    $0x4,%esp
+  8031e4:	6a ff                	push   $0xffffffff
+  8031e6:	53                   	push   %ebx
+  8031e7:	68 00 f0 ff ee       	push   $0xeefff000
+  8031ec:	e8 68 e0 ff ff       	call   801259 <sys_futex_wait>
+  8031f1:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  8031f4:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  8031f9:	39 d8                	cmp    %ebx,%eax
+  8031fb:	74 e4                	je     8031e1 <mem_pressure_wait+0xc>
+	return now;
+}
+  8031fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803200:	c9                   	leave
+  803201:	c3                   	ret
+
+00803202 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803202:	55                   	push   %ebp
+  803203:	89 e5                	mov    %esp,%ebp
+  803205:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  803208:	68 74 3e 80 00       	push   $0x803e74
+  80320d:	e8 32 16 00 00       	call   804844 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803212:	c7 05 14 e9 80 00 00 	movl   $0xdeadb000,0x80e914
+  803219:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  80321c:	83 c4 0c             	add    $0xc,%esp
+  80321f:	68 07 02 00 00       	push   $0x207
+  803224:	68 00 b0 ad de       	push   $0xdeadb000
+  803229:	6a 00                	push   $0x0
+  80322b:	e8 50 db ff ff       	call   800d80 <sys_page_alloc>
+  803230:	83 c4 10             	add    $0x10,%esp
+  803233:	85 c0                	test   %eax,%eax
+  803235:	78 0c                	js     803243 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  803237:	e8 b4 f3 ff ff       	call   8025f0 <find_paging_env>
+	page_ring_ready();
+  80323c:	e8 7f f2 ff ff       	call   8024c0 <page_ring_ready>
+}
+  803241:	c9                   	leave
+  803242:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  803243:	50                   	push   %eax
+  803244:	68 1c 53 80 00       	push   $0x80531c
+  803249:	68 13 05 00 00       	push   $0x513
+  80324e:	68 d5 52 80 00       	push   $0x8052d5
+  803253:	e8 73 cf ff ff       	call   8001cb <_panic>
+
+00803258 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  803258:	55                   	push   %ebp
+  803259:	89 e5                	mov    %esp,%ebp
+  80325b:	57                   	push   %edi
+  80325c:	56                   	push   %esi
+  80325d:	53                   	push   %ebx
+  80325e:	83 ec 0c             	sub    $0xc,%esp
+  803261:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  803264:	89 fa                	mov    %edi,%edx
+  803266:	c1 ea 16             	shr    $0x16,%edx
+  803269:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  80326e:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  803271:	f6 06 01             	testb  $0x1,(%esi)
+  803274:	75 3e                	jne    8032b4 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803276:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  80327b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80327f:	74 47                	je     8032c8 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  803281:	83 ec 0c             	sub    $0xc,%esp
+  803284:	6a 01                	push   $0x1
+  803286:	e8 f2 11 00 00       	call   80447d <va_alloc>
+  80328b:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  80328d:	83 c4 10             	add    $0x10,%esp
+  803290:	85 c0                	test   %eax,%eax
+  803292:	74 34                	je     8032c8 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803294:	6a 00                	push   $0x0
+  803296:	68 07 02 00 00       	push   $0x207
+  80329b:	50                   	push   %eax
+  80329c:	6a 00                	push   $0x0
+  80329e:	e8 df 02 00 00       	call   803582 <page_alloc>
+  8032a3:	83 c4 10             	add    $0x10,%esp
+  8032a6:	85 c0                	test   %eax,%eax
+  8032a8:	78 28                	js     8032d2 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  8032aa:	f6 06 01             	testb  $0x1,(%esi)
+  8032ad:	75 38                	jne    8032e7 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  8032af:	83 cb 01             	or     $0x1,%ebx
+  8032b2:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  8032b4:	89 f8                	mov    %edi,%eax
+  8032b6:	c1 e8 0a             	shr    $0xa,%eax
+  8032b9:	25 fc 0f 00 00       	and    $0xffc,%eax
+  8032be:	8b 1e                	mov    (%esi),%ebx
+  8032c0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8032c6:	01 c3                	add    %eax,%ebx
+}
+  8032c8:	89 d8                	mov    %ebx,%eax
+  8032ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032cd:	5b                   	pop    %ebx
+  8032ce:	5e                   	pop    %esi
+  8032cf:	5f                   	pop    %edi
+  8032d0:	5d                   	pop    %ebp
+  8032d1:	c3                   	ret
+			va_free(page, 1);
+  8032d2:	83 ec 08             	sub    $0x8,%esp
+  8032d5:	6a 01                	push   $0x1
+  8032d7:	53                   	push   %ebx
+  8032d8:	e8 d8 12 00 00       	call   8045b5 <va_free>
+			return NULL;
+  8032dd:	83 c4 10             	add    $0x10,%esp
+  8032e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032e5:	eb e1                	jmp    8032c8 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  8032e7:	83 ec 08             	sub    $0x8,%esp
+  8032ea:	53                   	push   %ebx
+  8032eb:	6a 00                	push   $0x0
+  8032ed:	e8 13 db ff ff       	call   800e05 <sys_page_unmap>
+			va_free(page, 1);
+  8032f2:	83 c4 08             	add    $0x8,%esp
+  8032f5:	6a 01                	push   $0x1
+  8032f7:	53                   	push   %ebx
+  8032f8:	e8 b8 12 00 00       	call   8045b5 <va_free>
+  8032fd:	83 c4 10             	add    $0x10,%esp
+  803300:	eb b2                	jmp    8032b4 <umapdir_walk+0x5c>
+
+00803302 <page_out>:
+{
+  803302:	55                   	push   %ebp
+  803303:	89 e5                	mov    %esp,%ebp
+  803305:	57                   	push   %edi
+  803306:	56                   	push   %esi
+  803307:	53                   	push   %ebx
+  803308:	83 ec 5c             	sub    $0x5c,%esp
+  80330b:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  80330e:	e8 dd f2 ff ff       	call   8025f0 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803313:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803318:	85 c0                	test   %eax,%eax
+  80331a:	74 1e                	je     80333a <page_out+0x38>
+  80331c:	83 ec 0c             	sub    $0xc,%esp
+  80331f:	6a 00                	push   $0x0
+  803321:	6a 00                	push   $0x0
+  803323:	6a 00                	push   $0x0
+  803325:	6a 08                	push   $0x8
+  803327:	50                   	push   %eax
+  803328:	e8 0b 17 00 00       	call   804a38 <ipc_call>
+  80332d:	89 c3                	mov    %eax,%ebx
+  80332f:	83 c4 20             	add    $0x20,%esp
+  803332:	85 c0                	test   %eax,%eax
+  803334:	0f 84 ac 00 00 00    	je     8033e6 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  80333a:	83 ec 08             	sub    $0x8,%esp
+  80333d:	ff 75 0c             	push   0xc(%ebp)
+  803340:	57                   	push   %edi
+  803341:	e8 e9 f9 ff ff       	call   802d2f <get_page_choice>
+  803346:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  803348:	83 c4 10             	add    $0x10,%esp
+  80334b:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803350:	0f 84 18 02 00 00    	je     80356e <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803356:	e8 78 ee ff ff       	call   8021d3 <page_is_clean>
+  80335b:	84 c0                	test   %al,%al
+  80335d:	0f 85 8c 00 00 00    	jne    8033ef <page_out+0xed>
+	if (pagingenv == 0)
+  803363:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  80336a:	0f 84 08 02 00 00    	je     803578 <page_out+0x276>
+	if (page_ring_ready())
+  803370:	e8 4b f1 ff ff       	call   8024c0 <page_ring_ready>
+  803375:	89 c3                	mov    %eax,%ebx
+  803377:	85 c0                	test   %eax,%eax
+  803379:	0f 85 89 00 00 00    	jne    803408 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  80337f:	83 ec 0c             	sub    $0xc,%esp
+  803382:	6a 05                	push   $0x5
+  803384:	6a 01                	push   $0x1
+  803386:	56                   	push   %esi
+  803387:	6a 01                	push   $0x1
+  803389:	ff 35 40 b0 80 00    	push   0x80b040
+  80338f:	e8 a4 16 00 00       	call   804a38 <ipc_call>
+  803394:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803396:	83 c4 20             	add    $0x20,%esp
+  803399:	85 c0                	test   %eax,%eax
+  80339b:	0f 88 b8 01 00 00    	js     803559 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  8033a1:	89 f0                	mov    %esi,%eax
+  8033a3:	c1 e8 0c             	shr    $0xc,%eax
+  8033a6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8033ad:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  8033b0:	83 ec 08             	sub    $0x8,%esp
+  8033b3:	56                   	push   %esi
+  8033b4:	6a 00                	push   $0x0
+  8033b6:	e8 4a da ff ff       	call   800e05 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  8033bb:	83 c4 08             	add    $0x8,%esp
+  8033be:	6a 01                	push   $0x1
+  8033c0:	56                   	push   %esi
+  8033c1:	e8 92 fe ff ff       	call   803258 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  8033c6:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  8033c9:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  8033cf:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  8033d2:	09 fe                	or     %edi,%esi
+  8033d4:	83 ce 01             	or     $0x1,%esi
+  8033d7:	89 30                	mov    %esi,(%eax)
+	return 0;
+  8033d9:	83 c4 10             	add    $0x10,%esp
+}
+  8033dc:	89 d8                	mov    %ebx,%eax
+  8033de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033e1:	5b                   	pop    %ebx
+  8033e2:	5e                   	pop    %esi
+  8033e3:	5f                   	pop    %edi
+  8033e4:	5d                   	pop    %ebp
+  8033e5:	c3                   	ret
+		num_page_reclaims++;
+  8033e6:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  8033ed:	eb ed                	jmp    8033dc <page_out+0xda>
+		num_page_drops++;
+  8033ef:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  8033f6:	83 ec 08             	sub    $0x8,%esp
+  8033f9:	56                   	push   %esi
+  8033fa:	6a 00                	push   $0x0
+  8033fc:	e8 04 da ff ff       	call   800e05 <sys_page_unmap>
+  803401:	89 c3                	mov    %eax,%ebx
+  803403:	83 c4 10             	add    $0x10,%esp
+  803406:	eb d4                	jmp    8033dc <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803408:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  80340a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80340f:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803414:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803417:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803419:	83 c0 08             	add    $0x8,%eax
+  80341c:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  80341f:	b8 07 00 00 00       	mov    $0x7,%eax
+  803424:	e8 e5 ef ff ff       	call   80240e <page_ring_reserve>
+	first = ring->sq_tail;
+  803429:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80342e:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803431:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803436:	83 ec 04             	sub    $0x4,%esp
+  803439:	68 00 10 00 00       	push   $0x1000
+  80343e:	56                   	push   %esi
+  80343f:	89 d8                	mov    %ebx,%eax
+  803441:	c1 e0 0c             	shl    $0xc,%eax
+  803444:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803449:	50                   	push   %eax
+  80344a:	e8 26 d6 ff ff       	call   800a75 <memcpy>
+		vas[n] = va;
+  80344f:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803453:	89 d9                	mov    %ebx,%ecx
+  803455:	ba 00 00 00 00       	mov    $0x0,%edx
+  80345a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80345f:	e8 de ee ff ff       	call   802342 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803464:	8d 43 01             	lea    0x1(%ebx),%eax
+  803467:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  80346a:	83 c4 10             	add    $0x10,%esp
+  80346d:	83 fb 06             	cmp    $0x6,%ebx
+  803470:	74 62                	je     8034d4 <page_out+0x1d2>
+  803472:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803475:	eb 15                	jmp    80348c <page_out+0x18a>
+			num_page_drops++;
+  803477:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  80347e:	83 ec 08             	sub    $0x8,%esp
+  803481:	56                   	push   %esi
+  803482:	6a 00                	push   $0x0
+  803484:	e8 7c d9 ff ff       	call   800e05 <sys_page_unmap>
+  803489:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  80348c:	83 ec 08             	sub    $0x8,%esp
+  80348f:	53                   	push   %ebx
+  803490:	57                   	push   %edi
+  803491:	e8 99 f8 ff ff       	call   802d2f <get_page_choice>
+  803496:	89 c6                	mov    %eax,%esi
+  803498:	83 c4 10             	add    $0x10,%esp
+  80349b:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8034a0:	74 32                	je     8034d4 <page_out+0x1d2>
+  8034a2:	e8 2c ed ff ff       	call   8021d3 <page_is_clean>
+  8034a7:	84 c0                	test   %al,%al
+  8034a9:	75 cc                	jne    803477 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  8034ab:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  8034ae:	39 c6                	cmp    %eax,%esi
+  8034b0:	72 07                	jb     8034b9 <page_out+0x1b7>
+  8034b2:	8b 45 98             	mov    -0x68(%ebp),%eax
+  8034b5:	39 c6                	cmp    %eax,%esi
+  8034b7:	72 1b                	jb     8034d4 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  8034b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034be:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  8034c1:	eb 03                	jmp    8034c6 <page_out+0x1c4>
+  8034c3:	83 c3 01             	add    $0x1,%ebx
+  8034c6:	39 da                	cmp    %ebx,%edx
+  8034c8:	0f 84 68 ff ff ff    	je     803436 <page_out+0x134>
+  8034ce:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  8034d2:	75 ef                	jne    8034c3 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  8034d4:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  8034d7:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  8034da:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  8034dd:	e8 a6 ee ff ff       	call   802388 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  8034e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034e7:	eb 42                	jmp    80352b <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  8034e9:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  8034ed:	89 f8                	mov    %edi,%eax
+  8034ef:	c1 e8 0c             	shr    $0xc,%eax
+  8034f2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8034f9:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  8034fc:	83 ec 08             	sub    $0x8,%esp
+  8034ff:	57                   	push   %edi
+  803500:	6a 00                	push   $0x0
+  803502:	e8 fe d8 ff ff       	call   800e05 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803507:	83 c4 08             	add    $0x8,%esp
+  80350a:	6a 01                	push   $0x1
+  80350c:	57                   	push   %edi
+  80350d:	e8 46 fd ff ff       	call   803258 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803512:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803515:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  80351b:	c1 e6 0c             	shl    $0xc,%esi
+  80351e:	09 d6                	or     %edx,%esi
+  803520:	83 ce 01             	or     $0x1,%esi
+  803523:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803525:	83 c3 01             	add    $0x1,%ebx
+  803528:	83 c4 10             	add    $0x10,%esp
+  80352b:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  80352e:	39 c3                	cmp    %eax,%ebx
+  803530:	74 1d                	je     80354f <page_out+0x24d>
+		if (res[i] < 0)
+  803532:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803536:	85 f6                	test   %esi,%esi
+  803538:	79 af                	jns    8034e9 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  80353a:	56                   	push   %esi
+  80353b:	68 c0 55 80 00       	push   $0x8055c0
+  803540:	68 d1 02 00 00       	push   $0x2d1
+  803545:	68 d5 52 80 00       	push   $0x8052d5
+  80354a:	e8 7c cc ff ff       	call   8001cb <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  80354f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803554:	e9 83 fe ff ff       	jmp    8033dc <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803559:	50                   	push   %eax
+  80355a:	68 c0 55 80 00       	push   $0x8055c0
+  80355f:	68 0a 03 00 00       	push   $0x30a
+  803564:	68 d5 52 80 00       	push   $0x8052d5
+  803569:	e8 5d cc ff ff       	call   8001cb <_panic>
+		return -E_NO_MEM;
+  80356e:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803573:	e9 64 fe ff ff       	jmp    8033dc <page_out+0xda>
+		return -E_PAGING;
+  803578:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80357d:	e9 5a fe ff ff       	jmp    8033dc <page_out+0xda>
+
+00803582 <page_alloc>:
+{
+  803582:	55                   	push   %ebp
+  803583:	89 e5                	mov    %esp,%ebp
+  803585:	57                   	push   %edi
+  803586:	56                   	push   %esi
+  803587:	53                   	push   %ebx
+  803588:	83 ec 0c             	sub    $0xc,%esp
+  80358b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80358e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803591:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803598:	74 34                	je     8035ce <page_alloc+0x4c>
+	if (check_mte)
+  80359a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  80359e:	75 35                	jne    8035d5 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  8035a0:	83 ec 04             	sub    $0x4,%esp
+  8035a3:	ff 75 10             	push   0x10(%ebp)
+  8035a6:	56                   	push   %esi
+  8035a7:	57                   	push   %edi
+  8035a8:	e8 d3 d7 ff ff       	call   800d80 <sys_page_alloc>
+  8035ad:	89 c3                	mov    %eax,%ebx
+  8035af:	83 c4 10             	add    $0x10,%esp
+  8035b2:	85 c0                	test   %eax,%eax
+  8035b4:	79 52                	jns    803608 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  8035b6:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8035b9:	75 52                	jne    80360d <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  8035bb:	83 ec 08             	sub    $0x8,%esp
+  8035be:	56                   	push   %esi
+  8035bf:	57                   	push   %edi
+  8035c0:	e8 3d fd ff ff       	call   803302 <page_out>
+  8035c5:	83 c4 10             	add    $0x10,%esp
+  8035c8:	85 c0                	test   %eax,%eax
+  8035ca:	79 d4                	jns    8035a0 <page_alloc+0x1e>
+  8035cc:	eb 3f                	jmp    80360d <page_alloc+0x8b>
+		init_map_dir();
+  8035ce:	e8 2f fc ff ff       	call   803202 <init_map_dir>
+  8035d3:	eb c5                	jmp    80359a <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  8035d5:	83 ec 08             	sub    $0x8,%esp
+  8035d8:	6a 00                	push   $0x0
+  8035da:	56                   	push   %esi
+  8035db:	e8 78 fc ff ff       	call   803258 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  8035e0:	83 c4 10             	add    $0x10,%esp
+  8035e3:	85 c0                	test   %eax,%eax
+  8035e5:	74 b9                	je     8035a0 <page_alloc+0x1e>
+  8035e7:	8b 10                	mov    (%eax),%edx
+  8035e9:	f6 c2 01             	test   $0x1,%dl
+  8035ec:	74 b2                	je     8035a0 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  8035ee:	83 ec 08             	sub    $0x8,%esp
+  8035f1:	56                   	push   %esi
+  8035f2:	52                   	push   %edx
+  8035f3:	50                   	push   %eax
+  8035f4:	68 e4 55 80 00       	push   $0x8055e4
+  8035f9:	68 34 03 00 00       	push   $0x334
+  8035fe:	68 d5 52 80 00       	push   $0x8052d5
+  803603:	e8 c3 cb ff ff       	call   8001cb <_panic>
+	return 0;
+  803608:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80360d:	89 d8                	mov    %ebx,%eax
+  80360f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803612:	5b                   	pop    %ebx
+  803613:	5e                   	pop    %esi
+  803614:	5f                   	pop    %edi
+  803615:	5d                   	pop    %ebp
+  803616:	c3                   	ret
+
+00803617 <page_adopt>:
+{
+  803617:	55                   	push   %ebp
+  803618:	89 e5                	mov    %esp,%ebp
+  80361a:	56                   	push   %esi
+  80361b:	53                   	push   %ebx
+  80361c:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  80361e:	c1 e8 16             	shr    $0x16,%eax
+  803621:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803628:	25 81 00 00 00       	and    $0x81,%eax
+  80362d:	83 f8 01             	cmp    $0x1,%eax
+  803630:	75 53                	jne    803685 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803632:	89 d8                	mov    %ebx,%eax
+  803634:	c1 e8 0c             	shr    $0xc,%eax
+  803637:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  80363e:	89 f2                	mov    %esi,%edx
+  803640:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803646:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  80364b:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803651:	75 37                	jne    80368a <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803653:	83 ec 08             	sub    $0x8,%esp
+  803656:	6a 01                	push   $0x1
+  803658:	53                   	push   %ebx
+  803659:	e8 fa fb ff ff       	call   803258 <umapdir_walk>
+  80365e:	83 c4 10             	add    $0x10,%esp
+  803661:	85 c0                	test   %eax,%eax
+  803663:	74 2c                	je     803691 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803665:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  80366b:	83 ce 01             	or     $0x1,%esi
+  80366e:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803670:	83 ec 08             	sub    $0x8,%esp
+  803673:	53                   	push   %ebx
+  803674:	6a 00                	push   $0x0
+  803676:	e8 8a d7 ff ff       	call   800e05 <sys_page_unmap>
+	return 1;
+  80367b:	83 c4 10             	add    $0x10,%esp
+  80367e:	b8 01 00 00 00       	mov    $0x1,%eax
+  803683:	eb 05                	jmp    80368a <page_adopt+0x73>
+		return 0;
+  803685:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80368a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80368d:	5b                   	pop    %ebx
+  80368e:	5e                   	pop    %esi
+  80368f:	5d                   	pop    %ebp
+  803690:	c3                   	ret
+		return -E_NO_MEM;
+  803691:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803696:	eb f2                	jmp    80368a <page_adopt+0x73>
+
+00803698 <page_forget>:
+{
+  803698:	55                   	push   %ebp
+  803699:	89 e5                	mov    %esp,%ebp
+  80369b:	53                   	push   %ebx
+  80369c:	83 ec 04             	sub    $0x4,%esp
+  80369f:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  8036a1:	e8 4a ef ff ff       	call   8025f0 <find_paging_env>
+	if (pagingenv == 0)
+  8036a6:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8036ad:	74 39                	je     8036e8 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  8036af:	89 d8                	mov    %ebx,%eax
+  8036b1:	c1 e8 16             	shr    $0x16,%eax
+  8036b4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8036bb:	25 81 00 00 00       	and    $0x81,%eax
+  8036c0:	83 f8 01             	cmp    $0x1,%eax
+  8036c3:	74 28                	je     8036ed <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  8036c5:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  8036cc:	74 1a                	je     8036e8 <page_forget+0x50>
+  8036ce:	83 ec 08             	sub    $0x8,%esp
+  8036d1:	6a 00                	push   $0x0
+  8036d3:	53                   	push   %ebx
+  8036d4:	e8 7f fb ff ff       	call   803258 <umapdir_walk>
+  8036d9:	89 c3                	mov    %eax,%ebx
+  8036db:	83 c4 10             	add    $0x10,%esp
+  8036de:	85 c0                	test   %eax,%eax
+  8036e0:	74 06                	je     8036e8 <page_forget+0x50>
+  8036e2:	8b 00                	mov    (%eax),%eax
+  8036e4:	a8 01                	test   $0x1,%al
+  8036e6:	75 2b                	jne    803713 <page_forget+0x7b>
+}
+  8036e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036eb:	c9                   	leave
+  8036ec:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  8036ed:	89 d8                	mov    %ebx,%eax
+  8036ef:	c1 e8 0c             	shr    $0xc,%eax
+  8036f2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8036f9:	89 c2                	mov    %eax,%edx
+  8036fb:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803701:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803707:	75 bc                	jne    8036c5 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803709:	c1 e8 0c             	shr    $0xc,%eax
+  80370c:	e8 5c ee ff ff       	call   80256d <page_remove_slot>
+		return;
+  803711:	eb d5                	jmp    8036e8 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803713:	c1 e8 0c             	shr    $0xc,%eax
+  803716:	e8 52 ee ff ff       	call   80256d <page_remove_slot>
+	*mte = 0;
+  80371b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803721:	eb c5                	jmp    8036e8 <page_forget+0x50>
+
+00803723 <page_unmap>:
+{
+  803723:	55                   	push   %ebp
+  803724:	89 e5                	mov    %esp,%ebp
+  803726:	57                   	push   %edi
+  803727:	56                   	push   %esi
+  803728:	53                   	push   %ebx
+  803729:	83 ec 0c             	sub    $0xc,%esp
+  80372c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80372f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803732:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803737:	8b 40 48             	mov    0x48(%eax),%eax
+  80373a:	85 db                	test   %ebx,%ebx
+  80373c:	0f 8e b4 00 00 00    	jle    8037f6 <page_unmap+0xd3>
+  803742:	39 d8                	cmp    %ebx,%eax
+  803744:	0f 84 ac 00 00 00    	je     8037f6 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  80374a:	83 ec 08             	sub    $0x8,%esp
+  80374d:	57                   	push   %edi
+  80374e:	53                   	push   %ebx
+  80374f:	e8 b1 d6 ff ff       	call   800e05 <sys_page_unmap>
+  803754:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803756:	e8 95 ee ff ff       	call   8025f0 <find_paging_env>
+	if (pagingenv == 0)
+  80375b:	83 c4 10             	add    $0x10,%esp
+  80375e:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803765:	0f 84 a1 00 00 00    	je     80380c <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80376b:	83 ec 0c             	sub    $0xc,%esp
+  80376e:	6a 05                	push   $0x5
+  803770:	68 00 00 40 00       	push   $0x400000
+  803775:	6a 00                	push   $0x0
+  803777:	68 00 b0 ad de       	push   $0xdeadb000
+  80377c:	53                   	push   %ebx
+  80377d:	e8 41 d6 ff ff       	call   800dc3 <sys_page_map>
+  803782:	83 c4 20             	add    $0x20,%esp
+  803785:	85 c0                	test   %eax,%eax
+  803787:	0f 88 89 00 00 00    	js     803816 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  80378d:	89 f8                	mov    %edi,%eax
+  80378f:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803792:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803799:	a8 01                	test   $0x1,%al
+  80379b:	74 6f                	je     80380c <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80379d:	83 ec 0c             	sub    $0xc,%esp
+  8037a0:	6a 05                	push   $0x5
+  8037a2:	68 00 00 40 00       	push   $0x400000
+  8037a7:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8037a9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8037ae:	50                   	push   %eax
+  8037af:	53                   	push   %ebx
+  8037b0:	e8 0e d6 ff ff       	call   800dc3 <sys_page_map>
+  8037b5:	83 c4 20             	add    $0x20,%esp
+  8037b8:	85 c0                	test   %eax,%eax
+  8037ba:	78 6f                	js     80382b <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  8037bc:	c1 ef 0c             	shr    $0xc,%edi
+  8037bf:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8037c5:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  8037cc:	01 
+  8037cd:	74 3d                	je     80380c <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  8037cf:	83 ec 08             	sub    $0x8,%esp
+  8037d2:	68 00 00 40 00       	push   $0x400000
+  8037d7:	6a 00                	push   $0x0
+  8037d9:	e8 27 d6 ff ff       	call   800e05 <sys_page_unmap>
+  8037de:	83 c4 10             	add    $0x10,%esp
+  8037e1:	85 c0                	test   %eax,%eax
+  8037e3:	78 5b                	js     803840 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  8037e5:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  8037ec:	c1 e8 0c             	shr    $0xc,%eax
+  8037ef:	e8 79 ed ff ff       	call   80256d <page_remove_slot>
+	return r;
+  8037f4:	eb 16                	jmp    80380c <page_unmap+0xe9>
+		page_forget(va);
+  8037f6:	89 f8                	mov    %edi,%eax
+  8037f8:	e8 9b fe ff ff       	call   803698 <page_forget>
+		return sys_page_unmap(envid, va);
+  8037fd:	83 ec 08             	sub    $0x8,%esp
+  803800:	57                   	push   %edi
+  803801:	53                   	push   %ebx
+  803802:	e8 fe d5 ff ff       	call   800e05 <sys_page_unmap>
+  803807:	89 c6                	mov    %eax,%esi
+  803809:	83 c4 10             	add    $0x10,%esp
+}
+  80380c:	89 f0                	mov    %esi,%eax
+  80380e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803811:	5b                   	pop    %ebx
+  803812:	5e                   	pop    %esi
+  803813:	5f                   	pop    %edi
+  803814:	5d                   	pop    %ebp
+  803815:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803816:	50                   	push   %eax
+  803817:	68 20 56 80 00       	push   $0x805620
+  80381c:	68 e4 03 00 00       	push   $0x3e4
+  803821:	68 d5 52 80 00       	push   $0x8052d5
+  803826:	e8 a0 c9 ff ff       	call   8001cb <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  80382b:	50                   	push   %eax
+  80382c:	68 4c 56 80 00       	push   $0x80564c
+  803831:	68 ea 03 00 00       	push   $0x3ea
+  803836:	68 d5 52 80 00       	push   $0x8052d5
+  80383b:	e8 8b c9 ff ff       	call   8001cb <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803840:	50                   	push   %eax
+  803841:	68 78 56 80 00       	push   $0x805678
+  803846:	68 ef 03 00 00       	push   $0x3ef
+  80384b:	68 d5 52 80 00       	push   $0x8052d5
+  803850:	e8 76 c9 ff ff       	call   8001cb <_panic>
+
+00803855 <page_unmap_range>:
+{
+  803855:	55                   	push   %ebp
+  803856:	89 e5                	mov    %esp,%ebp
+  803858:	57                   	push   %edi
+  803859:	56                   	push   %esi
+  80385a:	53                   	push   %ebx
+  80385b:	83 ec 0c             	sub    $0xc,%esp
+  80385e:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803861:	e8 8a ed ff ff       	call   8025f0 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803866:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80386b:	8b 40 48             	mov    0x48(%eax),%eax
+  80386e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803872:	7e 38                	jle    8038ac <page_unmap_range+0x57>
+  803874:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803877:	74 33                	je     8038ac <page_unmap_range+0x57>
+  803879:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803880:	74 2a                	je     8038ac <page_unmap_range+0x57>
+  803882:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  803885:	be 00 00 00 00       	mov    $0x0,%esi
+  80388a:	39 fe                	cmp    %edi,%esi
+  80388c:	74 56                	je     8038e4 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  80388e:	83 ec 08             	sub    $0x8,%esp
+  803891:	53                   	push   %ebx
+  803892:	ff 75 08             	push   0x8(%ebp)
+  803895:	e8 89 fe ff ff       	call   803723 <page_unmap>
+  80389a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8038a0:	83 c4 10             	add    $0x10,%esp
+  8038a3:	85 c0                	test   %eax,%eax
+  8038a5:	78 35                	js     8038dc <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  8038a7:	83 c6 01             	add    $0x1,%esi
+  8038aa:	eb de                	jmp    80388a <page_unmap_range+0x35>
+  8038ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  8038af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038b4:	eb 10                	jmp    8038c6 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  8038b6:	89 f0                	mov    %esi,%eax
+  8038b8:	e8 db fd ff ff       	call   803698 <page_forget>
+		for (i = 0; i < npages; i++)
+  8038bd:	83 c3 01             	add    $0x1,%ebx
+  8038c0:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8038c6:	39 fb                	cmp    %edi,%ebx
+  8038c8:	75 ec                	jne    8038b6 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  8038ca:	83 ec 04             	sub    $0x4,%esp
+  8038cd:	57                   	push   %edi
+  8038ce:	ff 75 0c             	push   0xc(%ebp)
+  8038d1:	ff 75 08             	push   0x8(%ebp)
+  8038d4:	e8 40 d6 ff ff       	call   800f19 <sys_page_unmap_range>
+  8038d9:	83 c4 10             	add    $0x10,%esp
+}
+  8038dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038df:	5b                   	pop    %ebx
+  8038e0:	5e                   	pop    %esi
+  8038e1:	5f                   	pop    %edi
+  8038e2:	5d                   	pop    %ebp
+  8038e3:	c3                   	ret
+	return 0;
+  8038e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038e9:	eb f1                	jmp    8038dc <page_unmap_range+0x87>
+
+008038eb <page_alloc_range>:
+{
+  8038eb:	55                   	push   %ebp
+  8038ec:	89 e5                	mov    %esp,%ebp
+  8038ee:	57                   	push   %edi
+  8038ef:	56                   	push   %esi
+  8038f0:	53                   	push   %ebx
+  8038f1:	83 ec 1c             	sub    $0x1c,%esp
+  8038f4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8038f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  8038fa:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803901:	74 14                	je     803917 <page_alloc_range+0x2c>
+	if (check_mte)
+  803903:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803907:	74 66                	je     80396f <page_alloc_range+0x84>
+  803909:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  80390b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803910:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803913:	89 c7                	mov    %eax,%edi
+  803915:	eb 10                	jmp    803927 <page_alloc_range+0x3c>
+		init_map_dir();
+  803917:	e8 e6 f8 ff ff       	call   803202 <init_map_dir>
+  80391c:	eb e5                	jmp    803903 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  80391e:	83 c7 01             	add    $0x1,%edi
+  803921:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803927:	39 df                	cmp    %ebx,%edi
+  803929:	74 38                	je     803963 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  80392b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80392e:	83 ec 08             	sub    $0x8,%esp
+  803931:	6a 00                	push   $0x0
+  803933:	56                   	push   %esi
+  803934:	e8 1f f9 ff ff       	call   803258 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  803939:	83 c4 10             	add    $0x10,%esp
+  80393c:	85 c0                	test   %eax,%eax
+  80393e:	74 de                	je     80391e <page_alloc_range+0x33>
+  803940:	8b 10                	mov    (%eax),%edx
+  803942:	f6 c2 01             	test   $0x1,%dl
+  803945:	74 d7                	je     80391e <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  803947:	83 ec 08             	sub    $0x8,%esp
+  80394a:	ff 75 e4             	push   -0x1c(%ebp)
+  80394d:	52                   	push   %edx
+  80394e:	50                   	push   %eax
+  80394f:	68 e4 55 80 00       	push   $0x8055e4
+  803954:	68 0b 04 00 00       	push   $0x40b
+  803959:	68 d5 52 80 00       	push   $0x8052d5
+  80395e:	e8 68 c8 ff ff       	call   8001cb <_panic>
+  803963:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803966:	eb 07                	jmp    80396f <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  803968:	c1 e0 0c             	shl    $0xc,%eax
+  80396b:	01 c7                	add    %eax,%edi
+			npages -= r;
+  80396d:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  80396f:	85 db                	test   %ebx,%ebx
+  803971:	74 30                	je     8039a3 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  803973:	ff 75 14             	push   0x14(%ebp)
+  803976:	53                   	push   %ebx
+  803977:	57                   	push   %edi
+  803978:	ff 75 08             	push   0x8(%ebp)
+  80397b:	e8 2b d5 ff ff       	call   800eab <sys_page_alloc_range>
+  803980:	89 c6                	mov    %eax,%esi
+  803982:	83 c4 10             	add    $0x10,%esp
+  803985:	85 c0                	test   %eax,%eax
+  803987:	7f df                	jg     803968 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  803989:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  80398c:	75 1a                	jne    8039a8 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  80398e:	83 ec 08             	sub    $0x8,%esp
+  803991:	57                   	push   %edi
+  803992:	ff 75 08             	push   0x8(%ebp)
+  803995:	e8 68 f9 ff ff       	call   803302 <page_out>
+  80399a:	83 c4 10             	add    $0x10,%esp
+  80399d:	85 c0                	test   %eax,%eax
+  80399f:	79 ce                	jns    80396f <page_alloc_range+0x84>
+  8039a1:	eb 05                	jmp    8039a8 <page_alloc_range+0xbd>
+	return 0;
+  8039a3:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8039a8:	89 f0                	mov    %esi,%eax
+  8039aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039ad:	5b                   	pop    %ebx
+  8039ae:	5e                   	pop    %esi
+  8039af:	5f                   	pop    %edi
+  8039b0:	5d                   	pop    %ebp
+  8039b1:	c3                   	ret
+
+008039b2 <page_in>:
+{
+  8039b2:	55                   	push   %ebp
+  8039b3:	89 e5                	mov    %esp,%ebp
+  8039b5:	57                   	push   %edi
+  8039b6:	56                   	push   %esi
+  8039b7:	53                   	push   %ebx
+  8039b8:	83 ec 3c             	sub    $0x3c,%esp
+  8039bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  8039be:	e8 2d ec ff ff       	call   8025f0 <find_paging_env>
+	if (pagingenv == 0)
+  8039c3:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8039ca:	0f 84 09 02 00 00    	je     803bd9 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  8039d0:	83 ec 08             	sub    $0x8,%esp
+  8039d3:	6a 00                	push   $0x0
+  8039d5:	56                   	push   %esi
+  8039d6:	e8 7d f8 ff ff       	call   803258 <umapdir_walk>
+  8039db:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8039dd:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8039e3:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  8039e6:	83 c4 10             	add    $0x10,%esp
+  8039e9:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8039ed:	74 0d                	je     8039fc <page_in+0x4a>
+  8039ef:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8039f4:	8b 40 48             	mov    0x48(%eax),%eax
+  8039f7:	3b 45 08             	cmp    0x8(%ebp),%eax
+  8039fa:	75 06                	jne    803a02 <page_in+0x50>
+  8039fc:	8b 03                	mov    (%ebx),%eax
+  8039fe:	a8 02                	test   $0x2,%al
+  803a00:	75 63                	jne    803a65 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  803a02:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803a04:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803a06:	89 f0                	mov    %esi,%eax
+  803a08:	25 06 0e 00 00       	and    $0xe06,%eax
+  803a0d:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803a10:	50                   	push   %eax
+  803a11:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803a14:	57                   	push   %edi
+  803a15:	ff 75 08             	push   0x8(%ebp)
+  803a18:	e8 65 fb ff ff       	call   803582 <page_alloc>
+  803a1d:	83 c4 10             	add    $0x10,%esp
+  803a20:	85 c0                	test   %eax,%eax
+  803a22:	78 39                	js     803a5d <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  803a24:	89 f0                	mov    %esi,%eax
+  803a26:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803a29:	83 ec 0c             	sub    $0xc,%esp
+  803a2c:	6a 07                	push   $0x7
+  803a2e:	6a 01                	push   $0x1
+  803a30:	57                   	push   %edi
+  803a31:	c1 e0 04             	shl    $0x4,%eax
+  803a34:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803a35:	c1 ee 1c             	shr    $0x1c,%esi
+  803a38:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803a3b:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803a42:	e8 f1 0f 00 00       	call   804a38 <ipc_call>
+  803a47:	83 c4 20             	add    $0x20,%esp
+  803a4a:	85 c0                	test   %eax,%eax
+  803a4c:	0f 88 72 01 00 00    	js     803bc4 <page_in+0x212>
+	*mte = 0;
+  803a52:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  803a58:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a60:	5b                   	pop    %ebx
+  803a61:	5e                   	pop    %esi
+  803a62:	5f                   	pop    %edi
+  803a63:	5d                   	pop    %ebp
+  803a64:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803a65:	25 06 0e 00 00       	and    $0xe06,%eax
+  803a6a:	83 c8 01             	or     $0x1,%eax
+  803a6d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  803a70:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803a73:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  803a76:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  803a7c:	be 01 00 00 00       	mov    $0x1,%esi
+  803a81:	eb 46                	jmp    803ac9 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  803a83:	83 ec 08             	sub    $0x8,%esp
+  803a86:	6a 00                	push   $0x0
+  803a88:	51                   	push   %ecx
+  803a89:	e8 ca f7 ff ff       	call   803258 <umapdir_walk>
+  803a8e:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  803a92:	83 c4 10             	add    $0x10,%esp
+  803a95:	85 c0                	test   %eax,%eax
+  803a97:	74 66                	je     803aff <page_in+0x14d>
+  803a99:	8b 00                	mov    (%eax),%eax
+  803a9b:	a8 01                	test   $0x1,%al
+  803a9d:	74 60                	je     803aff <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  803a9f:	89 c2                	mov    %eax,%edx
+  803aa1:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  803aa7:	83 ca 01             	or     $0x1,%edx
+  803aaa:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  803aad:	75 50                	jne    803aff <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  803aaf:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803ab5:	c1 e8 1c             	shr    $0x1c,%eax
+  803ab8:	8b 13                	mov    (%ebx),%edx
+  803aba:	c1 ea 1c             	shr    $0x1c,%edx
+  803abd:	39 d0                	cmp    %edx,%eax
+  803abf:	75 3e                	jne    803aff <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803ac1:	83 c6 01             	add    $0x1,%esi
+  803ac4:	83 fe 08             	cmp    $0x8,%esi
+  803ac7:	74 3f                	je     803b08 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  803ac9:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803acb:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  803ad1:	77 2c                	ja     803aff <page_in+0x14d>
+  803ad3:	89 f8                	mov    %edi,%eax
+  803ad5:	c1 e8 16             	shr    $0x16,%eax
+  803ad8:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803adf:	f6 c2 01             	test   $0x1,%dl
+  803ae2:	74 9f                	je     803a83 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803ae4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803aeb:	a8 80                	test   $0x80,%al
+  803aed:	75 10                	jne    803aff <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803aef:	89 f8                	mov    %edi,%eax
+  803af1:	c1 e8 0c             	shr    $0xc,%eax
+  803af4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803afb:	a8 01                	test   $0x1,%al
+  803afd:	74 84                	je     803a83 <page_in+0xd1>
+	if (n == 1)
+  803aff:	83 fe 01             	cmp    $0x1,%esi
+  803b02:	0f 84 fa fe ff ff    	je     803a02 <page_in+0x50>
+	req.nslots = n;
+  803b08:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  803b0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b13:	eb 13                	jmp    803b28 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  803b15:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  803b19:	8b 12                	mov    (%edx),%edx
+  803b1b:	c1 ea 0c             	shr    $0xc,%edx
+  803b1e:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  803b25:	83 c0 01             	add    $0x1,%eax
+  803b28:	39 c6                	cmp    %eax,%esi
+  803b2a:	75 e9                	jne    803b15 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  803b2c:	83 ec 0c             	sub    $0xc,%esp
+  803b2f:	6a 00                	push   $0x0
+  803b31:	ff 75 c0             	push   -0x40(%ebp)
+  803b34:	56                   	push   %esi
+  803b35:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803b38:	57                   	push   %edi
+  803b39:	6a 00                	push   $0x0
+  803b3b:	e8 ab fd ff ff       	call   8038eb <page_alloc_range>
+  803b40:	83 c4 20             	add    $0x20,%esp
+  803b43:	85 c0                	test   %eax,%eax
+  803b45:	78 6e                	js     803bb5 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  803b47:	83 ec 04             	sub    $0x4,%esp
+  803b4a:	6a 24                	push   $0x24
+  803b4c:	68 00 80 80 00       	push   $0x808000
+  803b51:	57                   	push   %edi
+  803b52:	e8 bc ce ff ff       	call   800a13 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803b57:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803b5e:	56                   	push   %esi
+  803b5f:	57                   	push   %edi
+  803b60:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803b62:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  803b69:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803b6c:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  803b73:	e8 c0 0e 00 00       	call   804a38 <ipc_call>
+  803b78:	83 c4 20             	add    $0x20,%esp
+  803b7b:	85 c0                	test   %eax,%eax
+  803b7d:	78 08                	js     803b87 <page_in+0x1d5>
+  803b7f:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  803b82:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  803b85:	eb 20                	jmp    803ba7 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  803b87:	50                   	push   %eax
+  803b88:	68 a4 56 80 00       	push   $0x8056a4
+  803b8d:	68 59 02 00 00       	push   $0x259
+  803b92:	68 d5 52 80 00       	push   $0x8052d5
+  803b97:	e8 2f c6 ff ff       	call   8001cb <_panic>
+		*mtes[i] = 0;
+  803b9c:	8b 10                	mov    (%eax),%edx
+  803b9e:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  803ba4:	83 c0 04             	add    $0x4,%eax
+  803ba7:	39 c8                	cmp    %ecx,%eax
+  803ba9:	75 f1                	jne    803b9c <page_in+0x1ea>
+	return n;
+  803bab:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  803bad:	85 f6                	test   %esi,%esi
+  803baf:	0f 84 4d fe ff ff    	je     803a02 <page_in+0x50>
+		return r < 0 ? r : 0;
+  803bb5:	85 c0                	test   %eax,%eax
+  803bb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bbc:	0f 4f c2             	cmovg  %edx,%eax
+  803bbf:	e9 99 fe ff ff       	jmp    803a5d <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  803bc4:	50                   	push   %eax
+  803bc5:	68 dc 56 80 00       	push   $0x8056dc
+  803bca:	68 9a 02 00 00       	push   $0x29a
+  803bcf:	68 d5 52 80 00       	push   $0x8052d5
+  803bd4:	e8 f2 c5 ff ff       	call   8001cb <_panic>
+		return -E_PAGING;
+  803bd9:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803bde:	e9 7a fe ff ff       	jmp    803a5d <page_in+0xab>
+
+00803be3 <page_map>:
+{
+  803be3:	55                   	push   %ebp
+  803be4:	89 e5                	mov    %esp,%ebp
+  803be6:	57                   	push   %edi
+  803be7:	56                   	push   %esi
+  803be8:	53                   	push   %ebx
+  803be9:	83 ec 1c             	sub    $0x1c,%esp
+  803bec:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803bef:	83 ec 0c             	sub    $0xc,%esp
+  803bf2:	ff 75 18             	push   0x18(%ebp)
+  803bf5:	ff 75 14             	push   0x14(%ebp)
+  803bf8:	ff 75 10             	push   0x10(%ebp)
+  803bfb:	ff 75 0c             	push   0xc(%ebp)
+  803bfe:	56                   	push   %esi
+  803bff:	e8 bf d1 ff ff       	call   800dc3 <sys_page_map>
+  803c04:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803c07:	83 c4 20             	add    $0x20,%esp
+  803c0a:	85 c0                	test   %eax,%eax
+  803c0c:	0f 89 a9 01 00 00    	jns    803dbb <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  803c12:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  803c16:	74 5f                	je     803c77 <page_map+0x94>
+		if (r != -E_INVAL)
+  803c18:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  803c1c:	0f 85 a0 01 00 00    	jne    803dc2 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803c22:	85 f6                	test   %esi,%esi
+  803c24:	74 70                	je     803c96 <page_map+0xb3>
+  803c26:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803c2b:	8b 40 48             	mov    0x48(%eax),%eax
+  803c2e:	39 f0                	cmp    %esi,%eax
+  803c30:	74 64                	je     803c96 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803c32:	83 ec 0c             	sub    $0xc,%esp
+  803c35:	6a 05                	push   $0x5
+  803c37:	68 00 00 40 00       	push   $0x400000
+  803c3c:	6a 00                	push   $0x0
+  803c3e:	68 00 b0 ad de       	push   $0xdeadb000
+  803c43:	56                   	push   %esi
+  803c44:	e8 7a d1 ff ff       	call   800dc3 <sys_page_map>
+  803c49:	89 c3                	mov    %eax,%ebx
+  803c4b:	83 c4 20             	add    $0x20,%esp
+  803c4e:	85 c0                	test   %eax,%eax
+  803c50:	79 6a                	jns    803cbc <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  803c52:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803c55:	75 50                	jne    803ca7 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  803c57:	83 ec 08             	sub    $0x8,%esp
+  803c5a:	68 00 00 40 00       	push   $0x400000
+  803c5f:	6a fc                	push   $0xfffffffc
+  803c61:	e8 9c f6 ff ff       	call   803302 <page_out>
+  803c66:	83 c4 10             	add    $0x10,%esp
+  803c69:	85 c0                	test   %eax,%eax
+  803c6b:	79 c5                	jns    803c32 <page_map+0x4f>
+}
+  803c6d:	89 d8                	mov    %ebx,%eax
+  803c6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c72:	5b                   	pop    %ebx
+  803c73:	5e                   	pop    %esi
+  803c74:	5f                   	pop    %edi
+  803c75:	5d                   	pop    %ebp
+  803c76:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  803c77:	83 ec 08             	sub    $0x8,%esp
+  803c7a:	68 00 00 40 00       	push   $0x400000
+  803c7f:	6a 00                	push   $0x0
+  803c81:	e8 7c f6 ff ff       	call   803302 <page_out>
+  803c86:	83 c4 10             	add    $0x10,%esp
+  803c89:	85 c0                	test   %eax,%eax
+  803c8b:	0f 89 5e ff ff ff    	jns    803bef <page_map+0xc>
+				return r;
+  803c91:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803c94:	eb d7                	jmp    803c6d <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803c96:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803c99:	e8 79 f9 ff ff       	call   803617 <page_adopt>
+  803c9e:	85 c0                	test   %eax,%eax
+  803ca0:	79 90                	jns    803c32 <page_map+0x4f>
+			return r;
+  803ca2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803ca5:	eb c6                	jmp    803c6d <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  803ca7:	53                   	push   %ebx
+  803ca8:	68 10 57 80 00       	push   $0x805710
+  803cad:	68 77 03 00 00       	push   $0x377
+  803cb2:	68 d5 52 80 00       	push   $0x8052d5
+  803cb7:	e8 0f c5 ff ff       	call   8001cb <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  803cbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803cbf:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803cc2:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  803cc9:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  803ccf:	0f 84 f5 00 00 00    	je     803dca <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803cd5:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803cdb:	83 ec 0c             	sub    $0xc,%esp
+  803cde:	6a 05                	push   $0x5
+  803ce0:	68 00 00 40 00       	push   $0x400000
+  803ce5:	6a 00                	push   $0x0
+  803ce7:	57                   	push   %edi
+  803ce8:	56                   	push   %esi
+  803ce9:	e8 d5 d0 ff ff       	call   800dc3 <sys_page_map>
+  803cee:	89 c3                	mov    %eax,%ebx
+  803cf0:	83 c4 20             	add    $0x20,%esp
+  803cf3:	85 c0                	test   %eax,%eax
+  803cf5:	79 35                	jns    803d2c <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  803cf7:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803cfa:	75 1b                	jne    803d17 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803cfc:	83 ec 08             	sub    $0x8,%esp
+  803cff:	68 00 00 40 00       	push   $0x400000
+  803d04:	6a 00                	push   $0x0
+  803d06:	e8 f7 f5 ff ff       	call   803302 <page_out>
+  803d0b:	83 c4 10             	add    $0x10,%esp
+  803d0e:	85 c0                	test   %eax,%eax
+  803d10:	79 c9                	jns    803cdb <page_map+0xf8>
+  803d12:	e9 56 ff ff ff       	jmp    803c6d <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  803d17:	53                   	push   %ebx
+  803d18:	68 38 57 80 00       	push   $0x805738
+  803d1d:	68 83 03 00 00       	push   $0x383
+  803d22:	68 d5 52 80 00       	push   $0x8052d5
+  803d27:	e8 9f c4 ff ff       	call   8001cb <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  803d2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d2f:	c1 e8 0c             	shr    $0xc,%eax
+  803d32:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803d37:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  803d3e:	01 
+  803d3f:	0f 84 8d 00 00 00    	je     803dd2 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803d45:	83 ec 08             	sub    $0x8,%esp
+  803d48:	68 00 00 40 00       	push   $0x400000
+  803d4d:	6a 00                	push   $0x0
+  803d4f:	e8 b1 d0 ff ff       	call   800e05 <sys_page_unmap>
+  803d54:	83 c4 10             	add    $0x10,%esp
+  803d57:	85 c0                	test   %eax,%eax
+  803d59:	78 36                	js     803d91 <page_map+0x1ae>
+  803d5b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  803d5e:	83 ec 08             	sub    $0x8,%esp
+  803d61:	57                   	push   %edi
+  803d62:	56                   	push   %esi
+  803d63:	e8 4a fc ff ff       	call   8039b2 <page_in>
+  803d68:	89 c3                	mov    %eax,%ebx
+  803d6a:	83 c4 10             	add    $0x10,%esp
+  803d6d:	85 c0                	test   %eax,%eax
+  803d6f:	0f 89 7a fe ff ff    	jns    803bef <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  803d75:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803d78:	75 2c                	jne    803da6 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  803d7a:	83 ec 08             	sub    $0x8,%esp
+  803d7d:	57                   	push   %edi
+  803d7e:	6a 00                	push   $0x0
+  803d80:	e8 7d f5 ff ff       	call   803302 <page_out>
+  803d85:	83 c4 10             	add    $0x10,%esp
+  803d88:	85 c0                	test   %eax,%eax
+  803d8a:	79 d2                	jns    803d5e <page_map+0x17b>
+  803d8c:	e9 dc fe ff ff       	jmp    803c6d <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  803d91:	50                   	push   %eax
+  803d92:	68 64 57 80 00       	push   $0x805764
+  803d97:	68 8b 03 00 00       	push   $0x38b
+  803d9c:	68 d5 52 80 00       	push   $0x8052d5
+  803da1:	e8 25 c4 ff ff       	call   8001cb <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  803da6:	53                   	push   %ebx
+  803da7:	68 8c 57 80 00       	push   $0x80578c
+  803dac:	68 91 03 00 00       	push   $0x391
+  803db1:	68 d5 52 80 00       	push   $0x8052d5
+  803db6:	e8 10 c4 ff ff       	call   8001cb <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803dbb:	89 c3                	mov    %eax,%ebx
+  803dbd:	e9 ab fe ff ff       	jmp    803c6d <page_map+0x8a>
+  803dc2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803dc5:	e9 a3 fe ff ff       	jmp    803c6d <page_map+0x8a>
+			return r; // Pass through the error
+  803dca:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803dcd:	e9 9b fe ff ff       	jmp    803c6d <page_map+0x8a>
+			return r; // Pass through the error
+  803dd2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803dd5:	e9 93 fe ff ff       	jmp    803c6d <page_map+0x8a>
+
+00803dda <page_map_range>:
+{
+  803dda:	55                   	push   %ebp
+  803ddb:	89 e5                	mov    %esp,%ebp
+  803ddd:	57                   	push   %edi
+  803dde:	56                   	push   %esi
+  803ddf:	53                   	push   %ebx
+  803de0:	83 ec 0c             	sub    $0xc,%esp
+  803de3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803de6:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  803de9:	83 ec 08             	sub    $0x8,%esp
+  803dec:	ff 75 1c             	push   0x1c(%ebp)
+  803def:	ff 75 18             	push   0x18(%ebp)
+  803df2:	56                   	push   %esi
+  803df3:	ff 75 10             	push   0x10(%ebp)
+  803df6:	57                   	push   %edi
+  803df7:	ff 75 08             	push   0x8(%ebp)
+  803dfa:	e8 cf d0 ff ff       	call   800ece <sys_page_map_range>
+  803dff:	89 c3                	mov    %eax,%ebx
+  803e01:	83 c4 20             	add    $0x20,%esp
+  803e04:	85 c0                	test   %eax,%eax
+  803e06:	79 1b                	jns    803e23 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  803e08:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803e0b:	75 20                	jne    803e2d <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803e0d:	83 ec 08             	sub    $0x8,%esp
+  803e10:	68 00 00 40 00       	push   $0x400000
+  803e15:	6a 00                	push   $0x0
+  803e17:	e8 e6 f4 ff ff       	call   803302 <page_out>
+  803e1c:	83 c4 10             	add    $0x10,%esp
+  803e1f:	85 c0                	test   %eax,%eax
+  803e21:	79 c6                	jns    803de9 <page_map_range+0xf>
+}
+  803e23:	89 d8                	mov    %ebx,%eax
+  803e25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e28:	5b                   	pop    %ebx
+  803e29:	5e                   	pop    %esi
+  803e2a:	5f                   	pop    %edi
+  803e2b:	5d                   	pop    %ebp
+  803e2c:	c3                   	ret
+		if (r != -E_INVAL)
+  803e2d:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  803e30:	75 f1                	jne    803e23 <page_map_range+0x49>
+  803e32:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  803e34:	be 00 00 00 00       	mov    $0x0,%esi
+  803e39:	eb 03                	jmp    803e3e <page_map_range+0x64>
+  803e3b:	83 c6 01             	add    $0x1,%esi
+  803e3e:	3b 75 18             	cmp    0x18(%ebp),%esi
+  803e41:	74 2a                	je     803e6d <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  803e43:	83 ec 0c             	sub    $0xc,%esp
+  803e46:	ff 75 1c             	push   0x1c(%ebp)
+  803e49:	53                   	push   %ebx
+  803e4a:	ff 75 10             	push   0x10(%ebp)
+  803e4d:	57                   	push   %edi
+  803e4e:	ff 75 08             	push   0x8(%ebp)
+  803e51:	e8 8d fd ff ff       	call   803be3 <page_map>
+  803e56:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803e5c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803e62:	83 c4 20             	add    $0x20,%esp
+  803e65:	85 c0                	test   %eax,%eax
+  803e67:	79 d2                	jns    803e3b <page_map_range+0x61>
+  803e69:	89 c3                	mov    %eax,%ebx
+  803e6b:	eb b6                	jmp    803e23 <page_map_range+0x49>
+		return 0;
+  803e6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e72:	eb af                	jmp    803e23 <page_map_range+0x49>
+
+00803e74 <paging_pgfault_handler>:
+{
+  803e74:	55                   	push   %ebp
+  803e75:	89 e5                	mov    %esp,%ebp
+  803e77:	56                   	push   %esi
+  803e78:	53                   	push   %ebx
+  803e79:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  803e7c:	e8 6f e7 ff ff       	call   8025f0 <find_paging_env>
+	if (pagingenv == 0)
+  803e81:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803e86:	85 c0                	test   %eax,%eax
+  803e88:	74 3c                	je     803ec6 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  803e8a:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803e8c:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803e90:	75 12                	jne    803ea4 <paging_pgfault_handler+0x30>
+  803e92:	89 f0                	mov    %esi,%eax
+  803e94:	e8 7e f7 ff ff       	call   803617 <page_adopt>
+  803e99:	89 c2                	mov    %eax,%edx
+		return 0;
+  803e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803ea0:	85 d2                	test   %edx,%edx
+  803ea2:	78 22                	js     803ec6 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  803ea4:	83 ec 08             	sub    $0x8,%esp
+  803ea7:	6a 00                	push   $0x0
+  803ea9:	56                   	push   %esi
+  803eaa:	e8 a9 f3 ff ff       	call   803258 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  803eaf:	83 c4 10             	add    $0x10,%esp
+  803eb2:	85 c0                	test   %eax,%eax
+  803eb4:	74 05                	je     803ebb <paging_pgfault_handler+0x47>
+  803eb6:	f6 00 01             	testb  $0x1,(%eax)
+  803eb9:	75 12                	jne    803ecd <paging_pgfault_handler+0x59>
+	return 0;
+  803ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803ec0:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803ec4:	74 23                	je     803ee9 <paging_pgfault_handler+0x75>
+}
+  803ec6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ec9:	5b                   	pop    %ebx
+  803eca:	5e                   	pop    %esi
+  803ecb:	5d                   	pop    %ebp
+  803ecc:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  803ecd:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803ed2:	8b 40 48             	mov    0x48(%eax),%eax
+  803ed5:	83 ec 08             	sub    $0x8,%esp
+  803ed8:	56                   	push   %esi
+  803ed9:	50                   	push   %eax
+  803eda:	e8 d3 fa ff ff       	call   8039b2 <page_in>
+  803edf:	f7 d0                	not    %eax
+  803ee1:	c1 e8 1f             	shr    $0x1f,%eax
+  803ee4:	83 c4 10             	add    $0x10,%esp
+  803ee7:	eb dd                	jmp    803ec6 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803ee9:	89 f0                	mov    %esi,%eax
+  803eeb:	e8 97 e2 ff ff       	call   802187 <segment_lookup>
+  803ef0:	89 c2                	mov    %eax,%edx
+	return 0;
+  803ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803ef7:	85 d2                	test   %edx,%edx
+  803ef9:	74 cb                	je     803ec6 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  803efb:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803f00:	8b 40 48             	mov    0x48(%eax),%eax
+  803f03:	83 ec 08             	sub    $0x8,%esp
+  803f06:	56                   	push   %esi
+  803f07:	50                   	push   %eax
+  803f08:	e8 f5 f3 ff ff       	call   803302 <page_out>
+  803f0d:	f7 d0                	not    %eax
+  803f0f:	c1 e8 1f             	shr    $0x1f,%eax
+  803f12:	83 c4 10             	add    $0x10,%esp
+  803f15:	eb af                	jmp    803ec6 <paging_pgfault_handler+0x52>
+
+00803f17 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  803f17:	55                   	push   %ebp
+  803f18:	89 e5                	mov    %esp,%ebp
+  803f1a:	57                   	push   %edi
+  803f1b:	56                   	push   %esi
+  803f1c:	53                   	push   %ebx
+  803f1d:	83 ec 2c             	sub    $0x2c,%esp
+  803f20:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  803f23:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  803f28:	89 c1                	mov    %eax,%ecx
+  803f2a:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  803f2d:	c1 e8 11             	shr    $0x11,%eax
+  803f30:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803f33:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  803f3a:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  803f3d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f42:	d3 e0                	shl    %cl,%eax
+  803f44:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803f47:	85 c7                	test   %eax,%edi
+  803f49:	74 12                	je     803f5d <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803f4b:	bb 01 00 00 00       	mov    $0x1,%ebx
+  803f50:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  803f53:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f58:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803f5b:	eb 17                	jmp    803f74 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  803f5d:	ff 75 e0             	push   -0x20(%ebp)
+  803f60:	68 c4 57 80 00       	push   $0x8057c4
+  803f65:	6a 48                	push   $0x48
+  803f67:	68 de 57 80 00       	push   $0x8057de
+  803f6c:	e8 5a c2 ff ff       	call   8001cb <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803f71:	83 c3 01             	add    $0x1,%ebx
+  803f74:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803f77:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  803f7a:	89 c8                	mov    %ecx,%eax
+  803f7c:	c1 e8 05             	shr    $0x5,%eax
+  803f7f:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  803f86:	89 fe                	mov    %edi,%esi
+  803f88:	d3 e6                	shl    %cl,%esi
+  803f8a:	89 f1                	mov    %esi,%ecx
+  803f8c:	85 d6                	test   %edx,%esi
+  803f8e:	74 e1                	je     803f71 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  803f90:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  803f93:	f7 d6                	not    %esi
+  803f95:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  803f98:	21 fe                	and    %edi,%esi
+  803f9a:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803f9d:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  803fa4:	f7 d1                	not    %ecx
+  803fa6:	21 d1                	and    %edx,%ecx
+  803fa8:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  803faf:	83 ec 04             	sub    $0x4,%esp
+  803fb2:	53                   	push   %ebx
+  803fb3:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803fb6:	57                   	push   %edi
+  803fb7:	6a 00                	push   $0x0
+  803fb9:	e8 97 f8 ff ff       	call   803855 <page_unmap_range>
+	va_free(va, n);
+  803fbe:	83 c4 08             	add    $0x8,%esp
+  803fc1:	53                   	push   %ebx
+  803fc2:	57                   	push   %edi
+  803fc3:	e8 ed 05 00 00       	call   8045b5 <va_free>
+}
+  803fc8:	83 c4 10             	add    $0x10,%esp
+  803fcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fce:	5b                   	pop    %ebx
+  803fcf:	5e                   	pop    %esi
+  803fd0:	5f                   	pop    %edi
+  803fd1:	5d                   	pop    %ebp
+  803fd2:	c3                   	ret
+
+00803fd3 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  803fd3:	55                   	push   %ebp
+  803fd4:	89 e5                	mov    %esp,%ebp
+  803fd6:	57                   	push   %edi
+  803fd7:	56                   	push   %esi
+  803fd8:	53                   	push   %ebx
+  803fd9:	83 ec 1c             	sub    $0x1c,%esp
+  803fdc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  803fdf:	85 db                	test   %ebx,%ebx
+  803fe1:	74 34                	je     804017 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  803fe3:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  803fe9:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  803fee:	77 2f                	ja     80401f <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  803ff0:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  803ff6:	75 51                	jne    804049 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  803ff8:	89 c1                	mov    %eax,%ecx
+  803ffa:	c1 e9 0c             	shr    $0xc,%ecx
+  803ffd:	ba 01 00 00 00       	mov    $0x1,%edx
+  804002:	d3 e2                	shl    %cl,%edx
+  804004:	c1 e8 11             	shr    $0x11,%eax
+  804007:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  80400e:	75 24                	jne    804034 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  804010:	89 d8                	mov    %ebx,%eax
+  804012:	e8 00 ff ff ff       	call   803f17 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  804017:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80401a:	5b                   	pop    %ebx
+  80401b:	5e                   	pop    %esi
+  80401c:	5f                   	pop    %edi
+  80401d:	5d                   	pop    %ebp
+  80401e:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  80401f:	53                   	push   %ebx
+  804020:	68 eb 57 80 00       	push   $0x8057eb
+  804025:	68 a2 00 00 00       	push   $0xa2
+  80402a:	68 de 57 80 00       	push   $0x8057de
+  80402f:	e8 97 c1 ff ff       	call   8001cb <_panic>
+			panic("free: %p is not allocated", va);
+  804034:	53                   	push   %ebx
+  804035:	68 c4 57 80 00       	push   $0x8057c4
+  80403a:	68 a5 00 00 00       	push   $0xa5
+  80403f:	68 de 57 80 00       	push   $0x8057de
+  804044:	e8 82 c1 ff ff       	call   8001cb <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  804049:	89 de                	mov    %ebx,%esi
+  80404b:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  804051:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  804057:	89 c8                	mov    %ecx,%eax
+  804059:	c1 e8 11             	shr    $0x11,%eax
+  80405c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80405f:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  804066:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  804069:	c1 e9 0c             	shr    $0xc,%ecx
+  80406c:	b8 01 00 00 00       	mov    $0x1,%eax
+  804071:	d3 e0                	shl    %cl,%eax
+  804073:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804076:	85 c7                	test   %eax,%edi
+  804078:	74 1b                	je     804095 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  80407a:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  80407e:	89 d8                	mov    %ebx,%eax
+  804080:	29 f0                	sub    %esi,%eax
+  804082:	83 e8 10             	sub    $0x10,%eax
+  804085:	99                   	cltd
+  804086:	f7 ff                	idiv   %edi
+  804088:	89 d1                	mov    %edx,%ecx
+  80408a:	85 d2                	test   %edx,%edx
+  80408c:	75 07                	jne    804095 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80408e:	ba 10 00 00 00       	mov    $0x10,%edx
+  804093:	eb 18                	jmp    8040ad <free+0xda>
+		panic("free: %p is not allocated", va);
+  804095:	53                   	push   %ebx
+  804096:	68 c4 57 80 00       	push   $0x8057c4
+  80409b:	68 ad 00 00 00       	push   $0xad
+  8040a0:	68 de 57 80 00       	push   $0x8057de
+  8040a5:	e8 21 c1 ff ff       	call   8001cb <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8040aa:	83 c1 01             	add    $0x1,%ecx
+  8040ad:	89 d0                	mov    %edx,%eax
+  8040af:	d3 e0                	shl    %cl,%eax
+  8040b1:	39 c7                	cmp    %eax,%edi
+  8040b3:	7f f5                	jg     8040aa <free+0xd7>
+	*(void **) va = s->free;
+  8040b5:	8b 46 08             	mov    0x8(%esi),%eax
+  8040b8:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  8040ba:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  8040bd:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  8040c1:	8d 58 01             	lea    0x1(%eax),%ebx
+  8040c4:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  8040c8:	66 85 c0             	test   %ax,%ax
+  8040cb:	74 52                	je     80411f <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8040cd:	0f b7 db             	movzwl %bx,%ebx
+  8040d0:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8040d4:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8040d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040de:	f7 ff                	idiv   %edi
+  8040e0:	39 c3                	cmp    %eax,%ebx
+  8040e2:	0f 85 2f ff ff ff    	jne    804017 <free+0x44>
+  8040e8:	8b 46 04             	mov    0x4(%esi),%eax
+  8040eb:	85 c0                	test   %eax,%eax
+  8040ed:	74 53                	je     804142 <free+0x16f>
+		s->prev->next = s->next;
+  8040ef:	8b 16                	mov    (%esi),%edx
+  8040f1:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8040f3:	8b 06                	mov    (%esi),%eax
+  8040f5:	85 c0                	test   %eax,%eax
+  8040f7:	74 06                	je     8040ff <free+0x12c>
+		s->next->prev = s->prev;
+  8040f9:	8b 56 04             	mov    0x4(%esi),%edx
+  8040fc:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8040ff:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804102:	f7 d0                	not    %eax
+  804104:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804107:	21 d0                	and    %edx,%eax
+  804109:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80410c:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  804113:	89 f0                	mov    %esi,%eax
+  804115:	e8 fd fd ff ff       	call   803f17 <heap_free_pages>
+  80411a:	e9 f8 fe ff ff       	jmp    804017 <free+0x44>
+	s->prev = NULL;
+  80411f:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  804126:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  80412d:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  80412f:	85 c0                	test   %eax,%eax
+  804131:	74 03                	je     804136 <free+0x163>
+		slabs[c]->prev = s;
+  804133:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  804136:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  80413d:	e9 d5 fe ff ff       	jmp    804017 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804142:	8b 06                	mov    (%esi),%eax
+  804144:	85 c0                	test   %eax,%eax
+  804146:	0f 84 cb fe ff ff    	je     804017 <free+0x44>
+		slabs[c] = s->next;
+  80414c:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  804153:	8b 06                	mov    (%esi),%eax
+  804155:	eb a2                	jmp    8040f9 <free+0x126>
+
+00804157 <heap_alloc_pages>:
+{
+  804157:	55                   	push   %ebp
+  804158:	89 e5                	mov    %esp,%ebp
+  80415a:	57                   	push   %edi
+  80415b:	56                   	push   %esi
+  80415c:	53                   	push   %ebx
+  80415d:	83 ec 18             	sub    $0x18,%esp
+  804160:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  804162:	50                   	push   %eax
+  804163:	e8 15 03 00 00       	call   80447d <va_alloc>
+  804168:	89 c3                	mov    %eax,%ebx
+  80416a:	83 c4 10             	add    $0x10,%esp
+  80416d:	85 c0                	test   %eax,%eax
+  80416f:	74 47                	je     8041b8 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804171:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804177:	89 c1                	mov    %eax,%ecx
+  804179:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  80417c:	c1 e8 11             	shr    $0x11,%eax
+  80417f:	ba 01 00 00 00       	mov    $0x1,%edx
+  804184:	89 d7                	mov    %edx,%edi
+  804186:	d3 e7                	shl    %cl,%edi
+  804188:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  80418f:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  804193:	89 c8                	mov    %ecx,%eax
+  804195:	c1 e8 05             	shr    $0x5,%eax
+  804198:	d3 e2                	shl    %cl,%edx
+  80419a:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  8041a1:	83 ec 0c             	sub    $0xc,%esp
+  8041a4:	6a 00                	push   $0x0
+  8041a6:	6a 07                	push   $0x7
+  8041a8:	56                   	push   %esi
+  8041a9:	53                   	push   %ebx
+  8041aa:	6a 00                	push   $0x0
+  8041ac:	e8 3a f7 ff ff       	call   8038eb <page_alloc_range>
+  8041b1:	83 c4 20             	add    $0x20,%esp
+  8041b4:	85 c0                	test   %eax,%eax
+  8041b6:	78 0a                	js     8041c2 <heap_alloc_pages+0x6b>
+}
+  8041b8:	89 d8                	mov    %ebx,%eax
+  8041ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041bd:	5b                   	pop    %ebx
+  8041be:	5e                   	pop    %esi
+  8041bf:	5f                   	pop    %edi
+  8041c0:	5d                   	pop    %ebp
+  8041c1:	c3                   	ret
+		free(va);
+  8041c2:	83 ec 0c             	sub    $0xc,%esp
+  8041c5:	53                   	push   %ebx
+  8041c6:	e8 08 fe ff ff       	call   803fd3 <free>
+		return NULL;
+  8041cb:	83 c4 10             	add    $0x10,%esp
+  8041ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8041d3:	eb e3                	jmp    8041b8 <heap_alloc_pages+0x61>
+
+008041d5 <malloc>:
+{
+  8041d5:	55                   	push   %ebp
+  8041d6:	89 e5                	mov    %esp,%ebp
+  8041d8:	57                   	push   %edi
+  8041d9:	56                   	push   %esi
+  8041da:	53                   	push   %ebx
+  8041db:	83 ec 1c             	sub    $0x1c,%esp
+  8041de:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  8041e1:	8d 50 ff             	lea    -0x1(%eax),%edx
+  8041e4:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  8041ea:	0f 87 21 01 00 00    	ja     804311 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8041f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8041f5:	ba 10 00 00 00       	mov    $0x10,%edx
+  8041fa:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  8041fc:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804201:	76 15                	jbe    804218 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804203:	05 ff 0f 00 00       	add    $0xfff,%eax
+  804208:	c1 e8 0c             	shr    $0xc,%eax
+  80420b:	e8 47 ff ff ff       	call   804157 <heap_alloc_pages>
+  804210:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804213:	eb 37                	jmp    80424c <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804215:	83 c1 01             	add    $0x1,%ecx
+  804218:	89 d6                	mov    %edx,%esi
+  80421a:	d3 e6                	shl    %cl,%esi
+  80421c:	39 c6                	cmp    %eax,%esi
+  80421e:	72 f5                	jb     804215 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804220:	89 cb                	mov    %ecx,%ebx
+  804222:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  804229:	85 ff                	test   %edi,%edi
+  80422b:	74 2a                	je     804257 <malloc+0x82>
+	v = s->free;
+  80422d:	8b 47 08             	mov    0x8(%edi),%eax
+  804230:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  804233:	8b 00                	mov    (%eax),%eax
+  804235:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  804238:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  80423c:	83 e8 01             	sub    $0x1,%eax
+  80423f:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  804243:	66 85 c0             	test   %ax,%ax
+  804246:	0f 84 9a 00 00 00    	je     8042e6 <malloc+0x111>
+}
+  80424c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80424f:	83 c4 1c             	add    $0x1c,%esp
+  804252:	5b                   	pop    %ebx
+  804253:	5e                   	pop    %esi
+  804254:	5f                   	pop    %edi
+  804255:	5d                   	pop    %ebp
+  804256:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  804257:	b8 01 00 00 00       	mov    $0x1,%eax
+  80425c:	e8 f6 fe ff ff       	call   804157 <heap_alloc_pages>
+  804261:	89 c1                	mov    %eax,%ecx
+  804263:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804266:	85 c0                	test   %eax,%eax
+  804268:	74 e2                	je     80424c <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  80426a:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  804270:	89 c8                	mov    %ecx,%eax
+  804272:	c1 e8 11             	shr    $0x11,%eax
+  804275:	c1 e9 0c             	shr    $0xc,%ecx
+  804278:	ba 01 00 00 00       	mov    $0x1,%edx
+  80427d:	d3 e2                	shl    %cl,%edx
+  80427f:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804286:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804289:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  80428d:	0f b7 f6             	movzwl %si,%esi
+  804290:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804295:	ba 00 00 00 00       	mov    $0x0,%edx
+  80429a:	f7 fe                	idiv   %esi
+  80429c:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  8042a0:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  8042a3:	85 c0                	test   %eax,%eax
+  8042a5:	74 14                	je     8042bb <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  8042a7:	83 e8 01             	sub    $0x1,%eax
+  8042aa:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  8042ae:	0f af d0             	imul   %eax,%edx
+  8042b1:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  8042b5:	89 3a                	mov    %edi,(%edx)
+  8042b7:	89 d7                	mov    %edx,%edi
+  8042b9:	eb e5                	jmp    8042a0 <malloc+0xcb>
+	s->prev = NULL;
+  8042bb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8042be:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  8042c5:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  8042cc:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  8042ce:	85 c0                	test   %eax,%eax
+  8042d0:	74 03                	je     8042d5 <malloc+0x100>
+		slabs[c]->prev = s;
+  8042d2:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  8042d5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8042d8:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  8042df:	89 c7                	mov    %eax,%edi
+  8042e1:	e9 47 ff ff ff       	jmp    80422d <malloc+0x58>
+	if (s->prev)
+  8042e6:	8b 47 04             	mov    0x4(%edi),%eax
+  8042e9:	85 c0                	test   %eax,%eax
+  8042eb:	74 19                	je     804306 <malloc+0x131>
+		s->prev->next = s->next;
+  8042ed:	8b 17                	mov    (%edi),%edx
+  8042ef:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8042f1:	8b 07                	mov    (%edi),%eax
+  8042f3:	85 c0                	test   %eax,%eax
+  8042f5:	0f 84 51 ff ff ff    	je     80424c <malloc+0x77>
+		s->next->prev = s->prev;
+  8042fb:	8b 57 04             	mov    0x4(%edi),%edx
+  8042fe:	89 50 04             	mov    %edx,0x4(%eax)
+  804301:	e9 46 ff ff ff       	jmp    80424c <malloc+0x77>
+		slabs[c] = s->next;
+  804306:	8b 07                	mov    (%edi),%eax
+  804308:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  80430f:	eb e0                	jmp    8042f1 <malloc+0x11c>
+		return NULL;
+  804311:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804318:	e9 2f ff ff ff       	jmp    80424c <malloc+0x77>
+
+0080431d <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  80431d:	55                   	push   %ebp
+  80431e:	89 e5                	mov    %esp,%ebp
+  804320:	57                   	push   %edi
+  804321:	56                   	push   %esi
+  804322:	53                   	push   %ebx
+  804323:	83 ec 0c             	sub    $0xc,%esp
+  804326:	89 c6                	mov    %eax,%esi
+  804328:	89 d7                	mov    %edx,%edi
+  80432a:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  80432d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804332:	ba 00 00 00 00       	mov    $0x0,%edx
+  804337:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  80433c:	83 ef 01             	sub    $0x1,%edi
+  80433f:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804342:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  804345:	eb 34                	jmp    80437b <va_chunk_scan+0x5e>
+			i += 31;
+  804347:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  80434a:	89 ca                	mov    %ecx,%edx
+			continue;
+  80434c:	eb 23                	jmp    804371 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  80434e:	89 c7                	mov    %eax,%edi
+  804350:	c1 ef 05             	shr    $0x5,%edi
+  804353:	be 01 00 00 00       	mov    $0x1,%esi
+  804358:	d3 e6                	shl    %cl,%esi
+  80435a:	89 f1                	mov    %esi,%ecx
+  80435c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80435f:	23 0c be             	and    (%esi,%edi,4),%ecx
+  804362:	75 41                	jne    8043a5 <va_chunk_scan+0x88>
+			len++;
+  804364:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804367:	39 d3                	cmp    %edx,%ebx
+  804369:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  80436c:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  80436f:	72 2d                	jb     80439e <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804371:	83 c0 01             	add    $0x1,%eax
+  804374:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804379:	77 31                	ja     8043ac <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  80437b:	89 c1                	mov    %eax,%ecx
+  80437d:	83 e1 1f             	and    $0x1f,%ecx
+  804380:	75 cc                	jne    80434e <va_chunk_scan+0x31>
+  804382:	89 c7                	mov    %eax,%edi
+  804384:	c1 ef 05             	shr    $0x5,%edi
+  804387:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80438a:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  80438d:	83 ff ff             	cmp    $0xffffffff,%edi
+  804390:	74 b5                	je     804347 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  804392:	85 ff                	test   %edi,%edi
+  804394:	75 b8                	jne    80434e <va_chunk_scan+0x31>
+			i += 31;
+  804396:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804399:	83 c2 20             	add    $0x20,%edx
+  80439c:	eb c9                	jmp    804367 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  80439e:	83 c0 01             	add    $0x1,%eax
+  8043a1:	29 d0                	sub    %edx,%eax
+  8043a3:	eb 15                	jmp    8043ba <va_chunk_scan+0x9d>
+			len = 0;
+  8043a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043aa:	eb c5                	jmp    804371 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  8043ac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  8043b1:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  8043b4:	85 d2                	test   %edx,%edx
+  8043b6:	74 02                	je     8043ba <va_chunk_scan+0x9d>
+		*run_store = best;
+  8043b8:	89 1a                	mov    %ebx,(%edx)
+}
+  8043ba:	83 c4 0c             	add    $0xc,%esp
+  8043bd:	5b                   	pop    %ebx
+  8043be:	5e                   	pop    %esi
+  8043bf:	5f                   	pop    %edi
+  8043c0:	5d                   	pop    %ebp
+  8043c1:	c3                   	ret
+
+008043c2 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  8043c2:	55                   	push   %ebp
+  8043c3:	89 e5                	mov    %esp,%ebp
+  8043c5:	57                   	push   %edi
+  8043c6:	56                   	push   %esi
+  8043c7:	53                   	push   %ebx
+  8043c8:	83 ec 14             	sub    $0x14,%esp
+  8043cb:	89 c3                	mov    %eax,%ebx
+  8043cd:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  8043cf:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  8043d5:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  8043db:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  8043de:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  8043e1:	89 d6                	mov    %edx,%esi
+  8043e3:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  8043e9:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  8043eb:	eb 34                	jmp    804421 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  8043ed:	89 c8                	mov    %ecx,%eax
+  8043ef:	c1 e8 05             	shr    $0x5,%eax
+  8043f2:	89 da                	mov    %ebx,%edx
+  8043f4:	c1 e2 05             	shl    $0x5,%edx
+  8043f7:	01 da                	add    %ebx,%edx
+  8043f9:	01 c2                	add    %eax,%edx
+  8043fb:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804400:	d3 c0                	rol    %cl,%eax
+  804402:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804409:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804410:	b8 01 00 00 00       	mov    $0x1,%eax
+  804415:	01 d0                	add    %edx,%eax
+  804417:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  80441e:	83 c1 01             	add    $0x1,%ecx
+  804421:	39 f9                	cmp    %edi,%ecx
+  804423:	74 30                	je     804455 <va_chunk_mark+0x93>
+		if (alloc)
+  804425:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804429:	74 c2                	je     8043ed <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  80442b:	89 c8                	mov    %ecx,%eax
+  80442d:	c1 e8 05             	shr    $0x5,%eax
+  804430:	89 da                	mov    %ebx,%edx
+  804432:	c1 e2 05             	shl    $0x5,%edx
+  804435:	01 da                	add    %ebx,%edx
+  804437:	01 c2                	add    %eax,%edx
+  804439:	b8 01 00 00 00       	mov    $0x1,%eax
+  80443e:	d3 e0                	shl    %cl,%eax
+  804440:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804447:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  80444e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804453:	eb c0                	jmp    804415 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804455:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804458:	ba 00 00 00 00       	mov    $0x0,%edx
+  80445d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804460:	e8 b8 fe ff ff       	call   80431d <va_chunk_scan>
+	ch->run = run;
+  804465:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  80446b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80446e:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  804475:	83 c4 14             	add    $0x14,%esp
+  804478:	5b                   	pop    %ebx
+  804479:	5e                   	pop    %esi
+  80447a:	5f                   	pop    %edi
+  80447b:	5d                   	pop    %ebp
+  80447c:	c3                   	ret
+
+0080447d <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  80447d:	55                   	push   %ebp
+  80447e:	89 e5                	mov    %esp,%ebp
+  804480:	57                   	push   %edi
+  804481:	56                   	push   %esi
+  804482:	53                   	push   %ebx
+  804483:	83 ec 04             	sub    $0x4,%esp
+  804486:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804489:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  80448e:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  804493:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  80449a:	74 4f                	je     8044eb <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  80449c:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  80449f:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  8044a4:	0f 87 01 01 00 00    	ja     8045ab <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  8044aa:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  8044b0:	0f 87 80 00 00 00    	ja     804536 <va_alloc+0xb9>
+  8044b6:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  8044bb:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  8044c0:	0f b7 10             	movzwl (%eax),%edx
+  8044c3:	05 84 00 00 00       	add    $0x84,%eax
+  8044c8:	39 da                	cmp    %ebx,%edx
+  8044ca:	73 2c                	jae    8044f8 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  8044cc:	83 c6 01             	add    $0x1,%esi
+  8044cf:	83 fe 1c             	cmp    $0x1c,%esi
+  8044d2:	75 ec                	jne    8044c0 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  8044d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d9:	eb 53                	jmp    80452e <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  8044db:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  8044e1:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  8044e6:	05 84 00 00 00       	add    $0x84,%eax
+  8044eb:	39 d0                	cmp    %edx,%eax
+  8044ed:	75 ec                	jne    8044db <va_alloc+0x5e>
+	va_inited = 1;
+  8044ef:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  8044f6:	eb a4                	jmp    80449c <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  8044f8:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  8044fe:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  804503:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804508:	89 da                	mov    %ebx,%edx
+  80450a:	e8 0e fe ff ff       	call   80431d <va_chunk_scan>
+  80450f:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804511:	6a 01                	push   $0x1
+  804513:	89 d9                	mov    %ebx,%ecx
+  804515:	89 c2                	mov    %eax,%edx
+  804517:	89 f0                	mov    %esi,%eax
+  804519:	e8 a4 fe ff ff       	call   8043c2 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  80451e:	c1 e6 16             	shl    $0x16,%esi
+  804521:	c1 e7 0c             	shl    $0xc,%edi
+  804524:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  80452b:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  80452e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804531:	5b                   	pop    %ebx
+  804532:	5e                   	pop    %esi
+  804533:	5f                   	pop    %edi
+  804534:	5d                   	pop    %ebp
+  804535:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804536:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  80453c:	c1 ee 0a             	shr    $0xa,%esi
+  80453f:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804544:	b8 00 00 00 00       	mov    $0x0,%eax
+  804549:	eb 0a                	jmp    804555 <va_alloc+0xd8>
+			first = c + 1;
+  80454b:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  80454d:	83 c2 01             	add    $0x1,%edx
+  804550:	83 fa 1d             	cmp    $0x1d,%edx
+  804553:	74 4f                	je     8045a4 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804555:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  80455b:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  804562:	00 04 
+  804564:	75 e5                	jne    80454b <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804566:	89 d1                	mov    %edx,%ecx
+  804568:	29 c1                	sub    %eax,%ecx
+  80456a:	39 f1                	cmp    %esi,%ecx
+  80456c:	75 df                	jne    80454d <va_alloc+0xd0>
+  80456e:	89 c7                	mov    %eax,%edi
+  804570:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804573:	be 00 04 00 00       	mov    $0x400,%esi
+  804578:	39 f3                	cmp    %esi,%ebx
+  80457a:	0f 46 f3             	cmovbe %ebx,%esi
+  80457d:	6a 01                	push   $0x1
+  80457f:	89 f1                	mov    %esi,%ecx
+  804581:	ba 00 00 00 00       	mov    $0x0,%edx
+  804586:	89 f8                	mov    %edi,%eax
+  804588:	e8 35 fe ff ff       	call   8043c2 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  80458d:	83 c7 01             	add    $0x1,%edi
+  804590:	83 c4 04             	add    $0x4,%esp
+  804593:	29 f3                	sub    %esi,%ebx
+  804595:	75 dc                	jne    804573 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804597:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80459a:	c1 e0 16             	shl    $0x16,%eax
+  80459d:	05 00 00 00 08       	add    $0x8000000,%eax
+  8045a2:	eb 8a                	jmp    80452e <va_alloc+0xb1>
+	return NULL;
+  8045a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045a9:	eb 83                	jmp    80452e <va_alloc+0xb1>
+		return NULL;
+  8045ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045b0:	e9 79 ff ff ff       	jmp    80452e <va_alloc+0xb1>
+
+008045b5 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  8045b5:	55                   	push   %ebp
+  8045b6:	89 e5                	mov    %esp,%ebp
+  8045b8:	57                   	push   %edi
+  8045b9:	56                   	push   %esi
+  8045ba:	53                   	push   %ebx
+  8045bb:	83 ec 0c             	sub    $0xc,%esp
+  8045be:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8045c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  8045c4:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  8045ca:	76 21                	jbe    8045ed <va_free+0x38>
+  8045cc:	89 f0                	mov    %esi,%eax
+  8045ce:	c1 e0 0c             	shl    $0xc,%eax
+  8045d1:	01 f8                	add    %edi,%eax
+  8045d3:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  8045d8:	77 13                	ja     8045ed <va_free+0x38>
+	    || PGOFF(va))
+  8045da:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8045e0:	75 0b                	jne    8045ed <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8045e2:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  8045e8:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  8045eb:	eb 45                	jmp    804632 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  8045ed:	83 ec 0c             	sub    $0xc,%esp
+  8045f0:	56                   	push   %esi
+  8045f1:	57                   	push   %edi
+  8045f2:	68 08 58 80 00       	push   $0x805808
+  8045f7:	68 8e 00 00 00       	push   $0x8e
+  8045fc:	68 28 58 80 00       	push   $0x805828
+  804601:	e8 c5 bb ff ff       	call   8001cb <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804606:	89 fa                	mov    %edi,%edx
+  804608:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80460e:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804613:	29 d3                	sub    %edx,%ebx
+  804615:	39 f3                	cmp    %esi,%ebx
+  804617:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  80461a:	89 f8                	mov    %edi,%eax
+  80461c:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  80461f:	83 ec 0c             	sub    $0xc,%esp
+  804622:	6a 00                	push   $0x0
+  804624:	89 d9                	mov    %ebx,%ecx
+  804626:	e8 97 fd ff ff       	call   8043c2 <va_chunk_mark>
+		i += n;
+  80462b:	01 df                	add    %ebx,%edi
+		npages -= n;
+  80462d:	29 de                	sub    %ebx,%esi
+  80462f:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804632:	85 f6                	test   %esi,%esi
+  804634:	75 d0                	jne    804606 <va_free+0x51>
+	}
+}
+  804636:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804639:	5b                   	pop    %ebx
+  80463a:	5e                   	pop    %esi
+  80463b:	5f                   	pop    %edi
+  80463c:	5d                   	pop    %ebp
+  80463d:	c3                   	ret
+
+0080463e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80463e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804643:	c3                   	ret
+
+00804644 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804644:	55                   	push   %ebp
+  804645:	89 e5                	mov    %esp,%ebp
+  804647:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80464a:	68 35 58 80 00       	push   $0x805835
+  80464f:	ff 75 0c             	push   0xc(%ebp)
+  804652:	e8 36 c2 ff ff       	call   80088d <strcpy>
+	return 0;
+}
+  804657:	b8 00 00 00 00       	mov    $0x0,%eax
+  80465c:	c9                   	leave
+  80465d:	c3                   	ret
+
+0080465e <devcons_write>:
+{
+  80465e:	55                   	push   %ebp
+  80465f:	89 e5                	mov    %esp,%ebp
+  804661:	57                   	push   %edi
+  804662:	56                   	push   %esi
+  804663:	53                   	push   %ebx
+  804664:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80466a:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80466f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804675:	eb 2e                	jmp    8046a5 <devcons_write+0x47>
+		m = n - tot;
+  804677:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80467a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80467c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804681:	39 c3                	cmp    %eax,%ebx
+  804683:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804686:	83 ec 04             	sub    $0x4,%esp
+  804689:	53                   	push   %ebx
+  80468a:	89 f0                	mov    %esi,%eax
+  80468c:	03 45 0c             	add    0xc(%ebp),%eax
+  80468f:	50                   	push   %eax
+  804690:	57                   	push   %edi
+  804691:	e8 7d c3 ff ff       	call   800a13 <memmove>
+		sys_cputs(buf, m);
+  804696:	83 c4 08             	add    $0x8,%esp
+  804699:	53                   	push   %ebx
+  80469a:	57                   	push   %edi
+  80469b:	e8 13 c6 ff ff       	call   800cb3 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8046a0:	01 de                	add    %ebx,%esi
+  8046a2:	83 c4 10             	add    $0x10,%esp
+  8046a5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8046a8:	72 cd                	jb     804677 <devcons_write+0x19>
+}
+  8046aa:	89 f0                	mov    %esi,%eax
+  8046ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046af:	5b                   	pop    %ebx
+  8046b0:	5e                   	pop    %esi
+  8046b1:	5f                   	pop    %edi
+  8046b2:	5d                   	pop    %ebp
+  8046b3:	c3                   	ret
+
+008046b4 <devcons_read>:
+{
+  8046b4:	55                   	push   %ebp
+  8046b5:	89 e5                	mov    %esp,%ebp
+  8046b7:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8046ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046bf:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8046c3:	75 07                	jne    8046cc <devcons_read+0x18>
+  8046c5:	eb 1f                	jmp    8046e6 <devcons_read+0x32>
+		sys_yield();
+  8046c7:	e8 95 c6 ff ff       	call   800d61 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8046cc:	e8 11 c6 ff ff       	call   800ce2 <sys_cgetc>
+  8046d1:	85 c0                	test   %eax,%eax
+  8046d3:	74 f2                	je     8046c7 <devcons_read+0x13>
+	if (c < 0)
+  8046d5:	78 0f                	js     8046e6 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8046d7:	83 f8 04             	cmp    $0x4,%eax
+  8046da:	74 0c                	je     8046e8 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8046dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8046df:	88 02                	mov    %al,(%edx)
+	return 1;
+  8046e1:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8046e6:	c9                   	leave
+  8046e7:	c3                   	ret
+		return 0;
+  8046e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046ed:	eb f7                	jmp    8046e6 <devcons_read+0x32>
+
+008046ef <cputchar>:
+{
+  8046ef:	55                   	push   %ebp
+  8046f0:	89 e5                	mov    %esp,%ebp
+  8046f2:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8046f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8046f8:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8046fb:	6a 01                	push   $0x1
+  8046fd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804700:	50                   	push   %eax
+  804701:	e8 ad c5 ff ff       	call   800cb3 <sys_cputs>
+}
+  804706:	83 c4 10             	add    $0x10,%esp
+  804709:	c9                   	leave
+  80470a:	c3                   	ret
+
+0080470b <getchar>:
+{
+  80470b:	55                   	push   %ebp
+  80470c:	89 e5                	mov    %esp,%ebp
+  80470e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804711:	6a 01                	push   $0x1
+  804713:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804716:	50                   	push   %eax
+  804717:	6a 00                	push   $0x0
+  804719:	e8 d7 ce ff ff       	call   8015f5 <read>
+	if (r < 0)
+  80471e:	83 c4 10             	add    $0x10,%esp
+  804721:	85 c0                	test   %eax,%eax
+  804723:	78 06                	js     80472b <getchar+0x20>
+	if (r < 1)
+  804725:	74 06                	je     80472d <getchar+0x22>
+	return c;
+  804727:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80472b:	c9                   	leave
+  80472c:	c3                   	ret
+		return -E_EOF;
+  80472d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804732:	eb f7                	jmp    80472b <getchar+0x20>
+
+00804734 <iscons>:
+{
+  804734:	55                   	push   %ebp
+  804735:	89 e5                	mov    %esp,%ebp
+  804737:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80473a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80473d:	50                   	push   %eax
+  80473e:	ff 75 08             	push   0x8(%ebp)
+  804741:	e8 50 cc ff ff       	call   801396 <fd_lookup>
+  804746:	83 c4 10             	add    $0x10,%esp
+  804749:	85 c0                	test   %eax,%eax
+  80474b:	78 11                	js     80475e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80474d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804750:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804756:	39 10                	cmp    %edx,(%eax)
+  804758:	0f 94 c0             	sete   %al
+  80475b:	0f b6 c0             	movzbl %al,%eax
+}
+  80475e:	c9                   	leave
+  80475f:	c3                   	ret
+
+00804760 <opencons>:
+{
+  804760:	55                   	push   %ebp
+  804761:	89 e5                	mov    %esp,%ebp
+  804763:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804766:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804769:	50                   	push   %eax
+  80476a:	e8 d3 cb ff ff       	call   801342 <fd_alloc>
+  80476f:	83 c4 10             	add    $0x10,%esp
+  804772:	85 c0                	test   %eax,%eax
+  804774:	78 3a                	js     8047b0 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804776:	83 ec 04             	sub    $0x4,%esp
+  804779:	68 07 04 00 00       	push   $0x407
+  80477e:	ff 75 f4             	push   -0xc(%ebp)
+  804781:	6a 00                	push   $0x0
+  804783:	e8 f8 c5 ff ff       	call   800d80 <sys_page_alloc>
+  804788:	83 c4 10             	add    $0x10,%esp
+  80478b:	85 c0                	test   %eax,%eax
+  80478d:	78 21                	js     8047b0 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80478f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804792:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804798:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80479a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80479d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8047a4:	83 ec 0c             	sub    $0xc,%esp
+  8047a7:	50                   	push   %eax
+  8047a8:	e8 6e cb ff ff       	call   80131b <fd2num>
+  8047ad:	83 c4 10             	add    $0x10,%esp
+}
+  8047b0:	c9                   	leave
+  8047b1:	c3                   	ret
+
+008047b2 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  8047b2:	55                   	push   %ebp
+  8047b3:	89 e5                	mov    %esp,%ebp
+  8047b5:	56                   	push   %esi
+  8047b6:	53                   	push   %ebx
+  8047b7:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8047ba:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  8047bf:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  8047c2:	85 db                	test   %ebx,%ebx
+  8047c4:	78 17                	js     8047dd <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  8047c6:	83 ec 0c             	sub    $0xc,%esp
+  8047c9:	56                   	push   %esi
+  8047ca:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  8047d1:	83 c4 10             	add    $0x10,%esp
+  8047d4:	85 c0                	test   %eax,%eax
+  8047d6:	75 27                	jne    8047ff <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8047d8:	83 eb 01             	sub    $0x1,%ebx
+  8047db:	eb e5                	jmp    8047c2 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  8047dd:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8047e2:	8b 40 48             	mov    0x48(%eax),%eax
+  8047e5:	83 ec 08             	sub    $0x8,%esp
+  8047e8:	ff 76 28             	push   0x28(%esi)
+  8047eb:	ff 36                	push   (%esi)
+  8047ed:	50                   	push   %eax
+  8047ee:	68 44 58 80 00       	push   $0x805844
+  8047f3:	6a 1d                	push   $0x1d
+  8047f5:	68 67 58 80 00       	push   $0x805867
+  8047fa:	e8 cc b9 ff ff       	call   8001cb <_panic>
+}
+  8047ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804802:	5b                   	pop    %ebx
+  804803:	5e                   	pop    %esi
+  804804:	5d                   	pop    %ebp
+  804805:	c3                   	ret
+
+00804806 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804806:	55                   	push   %ebp
+  804807:	89 e5                	mov    %esp,%ebp
+  804809:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  80480c:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  804813:	74 0a                	je     80481f <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804815:	8b 45 08             	mov    0x8(%ebp),%eax
+  804818:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  80481d:	c9                   	leave
+  80481e:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  80481f:	83 ec 04             	sub    $0x4,%esp
+  804822:	6a 07                	push   $0x7
+  804824:	68 00 f0 bf ee       	push   $0xeebff000
+  804829:	6a 00                	push   $0x0
+  80482b:	e8 50 c5 ff ff       	call   800d80 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804830:	83 c4 08             	add    $0x8,%esp
+  804833:	68 a6 48 80 00       	push   $0x8048a6
+  804838:	6a 00                	push   $0x0
+  80483a:	e8 a7 c8 ff ff       	call   8010e6 <sys_env_set_pgfault_upcall>
+  80483f:	83 c4 10             	add    $0x10,%esp
+  804842:	eb d1                	jmp    804815 <set_pgfault_handler+0xf>
+
+00804844 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804844:	55                   	push   %ebp
+  804845:	89 e5                	mov    %esp,%ebp
+  804847:	83 ec 08             	sub    $0x8,%esp
+  80484a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  80484d:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  804853:	b8 00 00 00 00       	mov    $0x0,%eax
+  804858:	eb 03                	jmp    80485d <add_pgfault_handler+0x19>
+  80485a:	83 c0 01             	add    $0x1,%eax
+  80485d:	39 d0                	cmp    %edx,%eax
+  80485f:	74 0b                	je     80486c <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804861:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  804868:	75 f0                	jne    80485a <add_pgfault_handler+0x16>
+  80486a:	eb 24                	jmp    804890 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  80486c:	83 fa 0a             	cmp    $0xa,%edx
+  80486f:	74 21                	je     804892 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  804871:	8d 42 01             	lea    0x1(%edx),%eax
+  804874:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  804879:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  804880:	83 ec 0c             	sub    $0xc,%esp
+  804883:	68 b2 47 80 00       	push   $0x8047b2
+  804888:	e8 79 ff ff ff       	call   804806 <set_pgfault_handler>
+  80488d:	83 c4 10             	add    $0x10,%esp
+}
+  804890:	c9                   	leave
+  804891:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  804892:	83 ec 04             	sub    $0x4,%esp
+  804895:	68 75 58 80 00       	push   $0x805875
+  80489a:	6a 44                	push   $0x44
+  80489c:	68 67 58 80 00       	push   $0x805867
+  8048a1:	e8 25 b9 ff ff       	call   8001cb <_panic>
+
+008048a6 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8048a6:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8048a7:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  8048ac:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8048ae:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  8048b1:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  8048b5:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  8048b9:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  8048bc:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  8048be:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  8048c2:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  8048c5:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  8048c6:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  8048c9:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  8048ca:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8048cb:	c3                   	ret
+
+008048cc <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8048cc:	55                   	push   %ebp
+  8048cd:	89 e5                	mov    %esp,%ebp
+  8048cf:	57                   	push   %edi
+  8048d0:	56                   	push   %esi
+  8048d1:	53                   	push   %ebx
+  8048d2:	83 ec 14             	sub    $0x14,%esp
+  8048d5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8048d8:	8b 75 14             	mov    0x14(%ebp),%esi
+  8048db:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8048de:	ff 75 10             	push   0x10(%ebp)
+  8048e1:	ff 75 0c             	push   0xc(%ebp)
+  8048e4:	e8 ba c8 ff ff       	call   8011a3 <sys_ipc_recv_pages>
+  8048e9:	83 c4 10             	add    $0x10,%esp
+  8048ec:	85 c0                	test   %eax,%eax
+  8048ee:	78 46                	js     804936 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8048f0:	85 ff                	test   %edi,%edi
+  8048f2:	74 0d                	je     804901 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  8048f4:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8048f9:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8048ff:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804901:	85 f6                	test   %esi,%esi
+  804903:	74 0d                	je     804912 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804905:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80490a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804910:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804912:	85 db                	test   %ebx,%ebx
+  804914:	74 0d                	je     804923 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804916:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80491b:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804921:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804923:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804928:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80492e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804931:	5b                   	pop    %ebx
+  804932:	5e                   	pop    %esi
+  804933:	5f                   	pop    %edi
+  804934:	5d                   	pop    %ebp
+  804935:	c3                   	ret
+		if (from_env_store) {
+  804936:	85 ff                	test   %edi,%edi
+  804938:	74 06                	je     804940 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80493a:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804940:	85 f6                	test   %esi,%esi
+  804942:	74 06                	je     80494a <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804944:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80494a:	85 db                	test   %ebx,%ebx
+  80494c:	74 e0                	je     80492e <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  80494e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804954:	eb d8                	jmp    80492e <ipc_recv_pages+0x62>
+
+00804956 <ipc_recv>:
+{
+  804956:	55                   	push   %ebp
+  804957:	89 e5                	mov    %esp,%ebp
+  804959:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  80495c:	6a 00                	push   $0x0
+  80495e:	ff 75 10             	push   0x10(%ebp)
+  804961:	6a 01                	push   $0x1
+  804963:	ff 75 0c             	push   0xc(%ebp)
+  804966:	ff 75 08             	push   0x8(%ebp)
+  804969:	e8 5e ff ff ff       	call   8048cc <ipc_recv_pages>
+}
+  80496e:	c9                   	leave
+  80496f:	c3                   	ret
+
+00804970 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804970:	55                   	push   %ebp
+  804971:	89 e5                	mov    %esp,%ebp
+  804973:	56                   	push   %esi
+  804974:	53                   	push   %ebx
+  804975:	8b 75 08             	mov    0x8(%ebp),%esi
+  804978:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  80497b:	83 ec 0c             	sub    $0xc,%esp
+  80497e:	ff 75 0c             	push   0xc(%ebp)
+  804981:	e8 51 c9 ff ff       	call   8012d7 <sys_ipc_try_recv>
+  804986:	83 c4 10             	add    $0x10,%esp
+  804989:	85 c0                	test   %eax,%eax
+  80498b:	78 34                	js     8049c1 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80498d:	85 f6                	test   %esi,%esi
+  80498f:	74 0d                	je     80499e <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  804991:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804996:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80499c:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  80499e:	85 db                	test   %ebx,%ebx
+  8049a0:	74 0d                	je     8049af <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8049a2:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049a7:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8049ad:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8049af:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049b4:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8049ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8049bd:	5b                   	pop    %ebx
+  8049be:	5e                   	pop    %esi
+  8049bf:	5d                   	pop    %ebp
+  8049c0:	c3                   	ret
+		if (from_env_store) {
+  8049c1:	85 f6                	test   %esi,%esi
+  8049c3:	74 06                	je     8049cb <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8049c5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8049cb:	85 db                	test   %ebx,%ebx
+  8049cd:	74 eb                	je     8049ba <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8049cf:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8049d5:	eb e3                	jmp    8049ba <ipc_try_recv+0x4a>
+
+008049d7 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8049d7:	55                   	push   %ebp
+  8049d8:	89 e5                	mov    %esp,%ebp
+  8049da:	83 ec 14             	sub    $0x14,%esp
+  8049dd:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8049e0:	85 c0                	test   %eax,%eax
+  8049e2:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8049e7:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8049ea:	ff 75 18             	push   0x18(%ebp)
+  8049ed:	ff 75 14             	push   0x14(%ebp)
+  8049f0:	50                   	push   %eax
+  8049f1:	ff 75 0c             	push   0xc(%ebp)
+  8049f4:	ff 75 08             	push   0x8(%ebp)
+  8049f7:	e8 6a c7 ff ff       	call   801166 <sys_ipc_send_pages>
+  8049fc:	83 c4 20             	add    $0x20,%esp
+  8049ff:	85 c0                	test   %eax,%eax
+  804a01:	78 02                	js     804a05 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804a03:	c9                   	leave
+  804a04:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804a05:	50                   	push   %eax
+  804a06:	68 90 58 80 00       	push   $0x805890
+  804a0b:	68 80 00 00 00       	push   $0x80
+  804a10:	68 bc 58 80 00       	push   $0x8058bc
+  804a15:	e8 b1 b7 ff ff       	call   8001cb <_panic>
+
+00804a1a <ipc_send>:
+{
+  804a1a:	55                   	push   %ebp
+  804a1b:	89 e5                	mov    %esp,%ebp
+  804a1d:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  804a20:	ff 75 14             	push   0x14(%ebp)
+  804a23:	6a 01                	push   $0x1
+  804a25:	ff 75 10             	push   0x10(%ebp)
+  804a28:	ff 75 0c             	push   0xc(%ebp)
+  804a2b:	ff 75 08             	push   0x8(%ebp)
+  804a2e:	e8 a4 ff ff ff       	call   8049d7 <ipc_send_pages>
+}
+  804a33:	83 c4 20             	add    $0x20,%esp
+  804a36:	c9                   	leave
+  804a37:	c3                   	ret
+
+00804a38 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804a38:	55                   	push   %ebp
+  804a39:	89 e5                	mov    %esp,%ebp
+  804a3b:	83 ec 14             	sub    $0x14,%esp
+  804a3e:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804a41:	85 c0                	test   %eax,%eax
+  804a43:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804a48:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804a4b:	ff 75 18             	push   0x18(%ebp)
+  804a4e:	ff 75 14             	push   0x14(%ebp)
+  804a51:	50                   	push   %eax
+  804a52:	ff 75 0c             	push   0xc(%ebp)
+  804a55:	ff 75 08             	push   0x8(%ebp)
+  804a58:	e8 9a c7 ff ff       	call   8011f7 <sys_ipc_call>
+  804a5d:	83 c4 20             	add    $0x20,%esp
+  804a60:	85 c0                	test   %eax,%eax
+  804a62:	78 0b                	js     804a6f <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  804a64:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804a69:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804a6f:	c9                   	leave
+  804a70:	c3                   	ret
+
+00804a71 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  804a71:	55                   	push   %ebp
+  804a72:	89 e5                	mov    %esp,%ebp
+  804a74:	57                   	push   %edi
+  804a75:	56                   	push   %esi
+  804a76:	53                   	push   %ebx
+  804a77:	83 ec 18             	sub    $0x18,%esp
+  804a7a:	8b 45 10             	mov    0x10(%ebp),%eax
+  804a7d:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  804a80:	8b 75 20             	mov    0x20(%ebp),%esi
+  804a83:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804a86:	85 c0                	test   %eax,%eax
+  804a88:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804a8d:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804a90:	ff 75 18             	push   0x18(%ebp)
+  804a93:	ff 75 14             	push   0x14(%ebp)
+  804a96:	50                   	push   %eax
+  804a97:	ff 75 0c             	push   0xc(%ebp)
+  804a9a:	ff 75 08             	push   0x8(%ebp)
+  804a9d:	e8 96 c7 ff ff       	call   801238 <sys_ipc_reply_recv>
+  804aa2:	83 c4 20             	add    $0x20,%esp
+  804aa5:	85 c0                	test   %eax,%eax
+  804aa7:	78 46                	js     804aef <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804aa9:	85 ff                	test   %edi,%edi
+  804aab:	74 0d                	je     804aba <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  804aad:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804ab2:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804ab8:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804aba:	85 f6                	test   %esi,%esi
+  804abc:	74 0d                	je     804acb <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  804abe:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804ac3:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804ac9:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804acb:	85 db                	test   %ebx,%ebx
+  804acd:	74 0d                	je     804adc <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  804acf:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804ad4:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804ada:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804adc:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804ae1:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804ae7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804aea:	5b                   	pop    %ebx
+  804aeb:	5e                   	pop    %esi
+  804aec:	5f                   	pop    %edi
+  804aed:	5d                   	pop    %ebp
+  804aee:	c3                   	ret
+		if (from_env_store) {
+  804aef:	85 ff                	test   %edi,%edi
+  804af1:	74 06                	je     804af9 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  804af3:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804af9:	85 f6                	test   %esi,%esi
+  804afb:	74 06                	je     804b03 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  804afd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804b03:	85 db                	test   %ebx,%ebx
+  804b05:	74 e0                	je     804ae7 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  804b07:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804b0d:	eb d8                	jmp    804ae7 <ipc_reply_recv+0x76>
+
+00804b0f <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804b0f:	55                   	push   %ebp
+  804b10:	89 e5                	mov    %esp,%ebp
+  804b12:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804b15:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804b1a:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804b1d:	c1 e0 06             	shl    $0x6,%eax
+  804b20:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804b25:	8b 40 50             	mov    0x50(%eax),%eax
+  804b28:	39 c8                	cmp    %ecx,%eax
+  804b2a:	74 12                	je     804b3e <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804b2c:	83 c2 01             	add    $0x1,%edx
+  804b2f:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804b35:	75 e3                	jne    804b1a <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804b37:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b3c:	eb 0e                	jmp    804b4c <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804b3e:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804b41:	c1 e0 06             	shl    $0x6,%eax
+  804b44:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804b49:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804b4c:	5d                   	pop    %ebp
+  804b4d:	c3                   	ret
+
+00804b4e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804b4e:	55                   	push   %ebp
+  804b4f:	89 e5                	mov    %esp,%ebp
+  804b51:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804b54:	89 c2                	mov    %eax,%edx
+  804b56:	c1 ea 16             	shr    $0x16,%edx
+  804b59:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804b60:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804b65:	f6 c1 01             	test   $0x1,%cl
+  804b68:	74 1e                	je     804b88 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  804b6a:	c1 e8 0c             	shr    $0xc,%eax
+  804b6d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804b74:	a8 01                	test   $0x1,%al
+  804b76:	74 10                	je     804b88 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804b78:	c1 e8 0c             	shr    $0xc,%eax
+  804b7b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  804b7e:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  804b85:	0f b7 d2             	movzwl %dx,%edx
+}
+  804b88:	89 d0                	mov    %edx,%eax
+  804b8a:	5d                   	pop    %ebp
+  804b8b:	c3                   	ret
+
+00804b8c <udivmod>:
+  804b8c:	55                   	push   %ebp
+  804b8d:	57                   	push   %edi
+  804b8e:	56                   	push   %esi
+  804b8f:	53                   	push   %ebx
+  804b90:	83 ec 24             	sub    $0x24,%esp
+  804b93:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804b97:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804b9b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804b9f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804ba3:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804ba7:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804bab:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  804baf:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804bb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bbe:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804bc5:	00 
+  804bc6:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804bcd:	00 
+  804bce:	89 fb                	mov    %edi,%ebx
+  804bd0:	eb 08                	jmp    804bda <udivmod+0x4e>
+  804bd2:	83 e9 01             	sub    $0x1,%ecx
+  804bd5:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804bd8:	74 68                	je     804c42 <udivmod+0xb6>
+  804bda:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804bde:	01 c0                	add    %eax,%eax
+  804be0:	89 c6                	mov    %eax,%esi
+  804be2:	89 d7                	mov    %edx,%edi
+  804be4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804be8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804bec:	0f ad d0             	shrd   %cl,%edx,%eax
+  804bef:	d3 ea                	shr    %cl,%edx
+  804bf1:	f6 c1 20             	test   $0x20,%cl
+  804bf4:	74 04                	je     804bfa <udivmod+0x6e>
+  804bf6:	89 d0                	mov    %edx,%eax
+  804bf8:	31 d2                	xor    %edx,%edx
+  804bfa:	83 e0 01             	and    $0x1,%eax
+  804bfd:	89 04 24             	mov    %eax,(%esp)
+  804c00:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804c07:	00 
+  804c08:	8b 04 24             	mov    (%esp),%eax
+  804c0b:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804c0f:	09 f0                	or     %esi,%eax
+  804c11:	09 fa                	or     %edi,%edx
+  804c13:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804c17:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804c1b:	39 f0                	cmp    %esi,%eax
+  804c1d:	89 d5                	mov    %edx,%ebp
+  804c1f:	19 fd                	sbb    %edi,%ebp
+  804c21:	72 af                	jb     804bd2 <udivmod+0x46>
+  804c23:	29 f0                	sub    %esi,%eax
+  804c25:	19 fa                	sbb    %edi,%edx
+  804c27:	89 cf                	mov    %ecx,%edi
+  804c29:	c1 ef 05             	shr    $0x5,%edi
+  804c2c:	83 e7 01             	and    $0x1,%edi
+  804c2f:	89 fe                	mov    %edi,%esi
+  804c31:	83 f6 01             	xor    $0x1,%esi
+  804c34:	d3 e6                	shl    %cl,%esi
+  804c36:	d3 e7                	shl    %cl,%edi
+  804c38:	09 74 24 18          	or     %esi,0x18(%esp)
+  804c3c:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804c40:	eb 90                	jmp    804bd2 <udivmod+0x46>
+  804c42:	85 db                	test   %ebx,%ebx
+  804c44:	74 05                	je     804c4b <udivmod+0xbf>
+  804c46:	89 03                	mov    %eax,(%ebx)
+  804c48:	89 53 04             	mov    %edx,0x4(%ebx)
+  804c4b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804c4f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804c53:	83 c4 24             	add    $0x24,%esp
+  804c56:	5b                   	pop    %ebx
+  804c57:	5e                   	pop    %esi
+  804c58:	5f                   	pop    %edi
+  804c59:	5d                   	pop    %ebp
+  804c5a:	c3                   	ret
+
+00804c5b <__udivdi3>:
+  804c5b:	83 ec 08             	sub    $0x8,%esp
+  804c5e:	6a 00                	push   $0x0
+  804c60:	ff 74 24 1c          	push   0x1c(%esp)
+  804c64:	ff 74 24 1c          	push   0x1c(%esp)
+  804c68:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804c6c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804c70:	e8 17 ff ff ff       	call   804b8c <udivmod>
+  804c75:	83 c4 14             	add    $0x14,%esp
+  804c78:	c3                   	ret
+
+00804c79 <__umoddi3>:
+  804c79:	83 ec 18             	sub    $0x18,%esp
+  804c7c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804c80:	50                   	push   %eax
+  804c81:	ff 74 24 2c          	push   0x2c(%esp)
+  804c85:	ff 74 24 2c          	push   0x2c(%esp)
+  804c89:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804c8d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804c91:	e8 f6 fe ff ff       	call   804b8c <udivmod>
+  804c96:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804c9a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804c9e:	83 c4 24             	add    $0x24,%esp
+  804ca1:	c3                   	ret
+
+00804ca2 <__divdi3>:
+  804ca2:	55                   	push   %ebp
+  804ca3:	57                   	push   %edi
+  804ca4:	56                   	push   %esi
+  804ca5:	53                   	push   %ebx
+  804ca6:	83 ec 10             	sub    $0x10,%esp
+  804ca9:	8b 44 24 24          	mov    0x24(%esp),%eax
+  804cad:	8b 54 24 28          	mov    0x28(%esp),%edx
+  804cb1:	89 c6                	mov    %eax,%esi
+  804cb3:	89 d7                	mov    %edx,%edi
+  804cb5:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  804cb9:	33 7c 24 30          	xor    0x30(%esp),%edi
+  804cbd:	89 74 24 04          	mov    %esi,0x4(%esp)
+  804cc1:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  804cc5:	89 c5                	mov    %eax,%ebp
+  804cc7:	f7 dd                	neg    %ebp
+  804cc9:	89 d6                	mov    %edx,%esi
+  804ccb:	83 d6 00             	adc    $0x0,%esi
+  804cce:	f7 de                	neg    %esi
+  804cd0:	0f 48 e8             	cmovs  %eax,%ebp
+  804cd3:	0f 49 d6             	cmovns %esi,%edx
+  804cd6:	6a 00                	push   $0x0
+  804cd8:	8b 74 24 30          	mov    0x30(%esp),%esi
+  804cdc:	f7 de                	neg    %esi
+  804cde:	8b 44 24 34          	mov    0x34(%esp),%eax
+  804ce2:	83 d0 00             	adc    $0x0,%eax
+  804ce5:	f7 d8                	neg    %eax
+  804ce7:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  804cec:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  804cf1:	50                   	push   %eax
+  804cf2:	56                   	push   %esi
+  804cf3:	89 e8                	mov    %ebp,%eax
+  804cf5:	e8 92 fe ff ff       	call   804b8c <udivmod>
+  804cfa:	83 c4 10             	add    $0x10,%esp
+  804cfd:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  804d02:	78 08                	js     804d0c <__divdi3+0x6a>
+  804d04:	83 c4 0c             	add    $0xc,%esp
+  804d07:	5b                   	pop    %ebx
+  804d08:	5e                   	pop    %esi
+  804d09:	5f                   	pop    %edi
+  804d0a:	5d                   	pop    %ebp
+  804d0b:	c3                   	ret
+  804d0c:	f7 d8                	neg    %eax
+  804d0e:	83 d2 00             	adc    $0x0,%edx
+  804d11:	f7 da                	neg    %edx
+  804d13:	eb ef                	jmp    804d04 <__divdi3+0x62>
+
+00804d15 <__moddi3>:
+  804d15:	55                   	push   %ebp
+  804d16:	57                   	push   %edi
+  804d17:	56                   	push   %esi
+  804d18:	53                   	push   %ebx
+  804d19:	83 ec 18             	sub    $0x18,%esp
+  804d1c:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  804d20:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  804d24:	89 f1                	mov    %esi,%ecx
+  804d26:	f7 d9                	neg    %ecx
+  804d28:	89 da                	mov    %ebx,%edx
+  804d2a:	83 d2 00             	adc    $0x0,%edx
+  804d2d:	f7 da                	neg    %edx
+  804d2f:	0f 48 ce             	cmovs  %esi,%ecx
+  804d32:	0f 48 d3             	cmovs  %ebx,%edx
+  804d35:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804d39:	50                   	push   %eax
+  804d3a:	8b 74 24 38          	mov    0x38(%esp),%esi
+  804d3e:	f7 de                	neg    %esi
+  804d40:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  804d44:	83 d0 00             	adc    $0x0,%eax
+  804d47:	f7 d8                	neg    %eax
+  804d49:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  804d4e:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  804d53:	50                   	push   %eax
+  804d54:	56                   	push   %esi
+  804d55:	89 c8                	mov    %ecx,%eax
+  804d57:	e8 30 fe ff ff       	call   804b8c <udivmod>
+  804d5c:	83 c4 10             	add    $0x10,%esp
+  804d5f:	85 db                	test   %ebx,%ebx
+  804d61:	78 10                	js     804d73 <__moddi3+0x5e>
+  804d63:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804d67:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804d6b:	83 c4 14             	add    $0x14,%esp
+  804d6e:	5b                   	pop    %ebx
+  804d6f:	5e                   	pop    %esi
+  804d70:	5f                   	pop    %edi
+  804d71:	5d                   	pop    %ebp
+  804d72:	c3                   	ret
+  804d73:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804d77:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804d7b:	f7 d8                	neg    %eax
+  804d7d:	83 d2 00             	adc    $0x0,%edx
+  804d80:	f7 da                	neg    %edx
+  804d82:	eb e7                	jmp    804d6b <__moddi3+0x56>
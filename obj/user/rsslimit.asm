@@ -0,0 +1,10680 @@
+
+obj/user/rsslimit.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 03 02 00 00       	call   800234 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define NPAGES 512
+#define BASE 0x10000000
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 10             	sub    $0x10,%esp
+	int r, limit;
+	uintptr_t va;
+	envid_t envid;
+
+	limit = thisenv->env_npages + 64;
+  80003c:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  800041:	8b 78 64             	mov    0x64(%eax),%edi
+  800044:	8d 77 40             	lea    0x40(%edi),%esi
+	if ((r = sys_env_set_rss(0, 0, limit)) < 0)
+  800047:	56                   	push   %esi
+  800048:	6a 00                	push   $0x0
+  80004a:	6a 00                	push   $0x0
+  80004c:	e8 ca 10 00 00       	call   80111b <sys_env_set_rss>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	85 c0                	test   %eax,%eax
+  800056:	0f 88 9d 00 00 00    	js     8000f9 <umain+0xc6>
+		panic("sys_env_set_rss: %e", r);
+
+	for (va = BASE; va < BASE + NPAGES*PGSIZE; va += PGSIZE) {
+  80005c:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+		if ((r = page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W, 1)) < 0)
+  800061:	6a 01                	push   $0x1
+  800063:	6a 07                	push   $0x7
+  800065:	53                   	push   %ebx
+  800066:	6a 00                	push   $0x0
+  800068:	e8 01 3c 00 00       	call   803c6e <page_alloc>
+  80006d:	83 c4 10             	add    $0x10,%esp
+  800070:	85 c0                	test   %eax,%eax
+  800072:	0f 88 93 00 00 00    	js     80010b <umain+0xd8>
+			panic("page_alloc on %p: %e", va, r);
+		// Store the address in the page
+		*(uintptr_t*)va = va;
+  800078:	89 1b                	mov    %ebx,(%ebx)
+		assert(thisenv->env_npages <= limit);
+  80007a:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80007f:	8b 40 64             	mov    0x64(%eax),%eax
+  800082:	39 f0                	cmp    %esi,%eax
+  800084:	0f 8f 97 00 00 00    	jg     800121 <umain+0xee>
+	for (va = BASE; va < BASE + NPAGES*PGSIZE; va += PGSIZE) {
+  80008a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800090:	81 fb 00 00 20 10    	cmp    $0x10200000,%ebx
+  800096:	75 c9                	jne    800061 <umain+0x2e>
+	}
+
+	if ((envid = fork()) < 0)
+  800098:	e8 96 14 00 00       	call   801533 <fork>
+  80009d:	85 c0                	test   %eax,%eax
+  80009f:	0f 88 92 00 00 00    	js     800137 <umain+0x104>
+		panic("fork: %e", envid);
+	if (envid == 0) {
+  8000a5:	0f 84 9e 00 00 00    	je     800149 <umain+0x116>
+		return;
+	}
+
+	for (va = BASE; va < BASE + NPAGES*PGSIZE; va += PGSIZE) {
+		assert(*(uintptr_t*)va == va);
+		assert(thisenv->env_npages <= limit);
+  8000ab:	8b 1d 18 f9 80 00    	mov    0x80f918,%ebx
+	for (va = BASE; va < BASE + NPAGES*PGSIZE; va += PGSIZE) {
+  8000b1:	ba 00 00 00 10       	mov    $0x10000000,%edx
+		assert(*(uintptr_t*)va == va);
+  8000b6:	39 12                	cmp    %edx,(%edx)
+  8000b8:	0f 85 4a 01 00 00    	jne    800208 <umain+0x1d5>
+		assert(thisenv->env_npages <= limit);
+  8000be:	8b 4b 64             	mov    0x64(%ebx),%ecx
+  8000c1:	39 f1                	cmp    %esi,%ecx
+  8000c3:	0f 8f 55 01 00 00    	jg     80021e <umain+0x1eb>
+	for (va = BASE; va < BASE + NPAGES*PGSIZE; va += PGSIZE) {
+  8000c9:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  8000cf:	81 fa 00 00 20 10    	cmp    $0x10200000,%edx
+  8000d5:	75 df                	jne    8000b6 <umain+0x83>
+	}
+	wait(envid);
+  8000d7:	83 ec 0c             	sub    $0xc,%esp
+  8000da:	50                   	push   %eax
+  8000db:	e8 27 27 00 00       	call   802807 <wait>
+	cprintf("rsslimit: Passed all checks!\n");
+  8000e0:	c7 04 24 35 55 80 00 	movl   $0x805535,(%esp)
+  8000e7:	e8 86 02 00 00       	call   800372 <cprintf>
+	get_and_print_paging_stats();
+  8000ec:	e8 b7 37 00 00       	call   8038a8 <get_and_print_paging_stats>
+  8000f1:	83 c4 10             	add    $0x10,%esp
+  8000f4:	e9 af 00 00 00       	jmp    8001a8 <umain+0x175>
+		panic("sys_env_set_rss: %e", r);
+  8000f9:	50                   	push   %eax
+  8000fa:	68 80 54 80 00       	push   $0x805480
+  8000ff:	6a 14                	push   $0x14
+  800101:	68 94 54 80 00       	push   $0x805494
+  800106:	e8 8c 01 00 00       	call   800297 <_panic>
+			panic("page_alloc on %p: %e", va, r);
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	50                   	push   %eax
+  80010f:	53                   	push   %ebx
+  800110:	68 b1 54 80 00       	push   $0x8054b1
+  800115:	6a 18                	push   $0x18
+  800117:	68 94 54 80 00       	push   $0x805494
+  80011c:	e8 76 01 00 00       	call   800297 <_panic>
+		assert(thisenv->env_npages <= limit);
+  800121:	68 c6 54 80 00       	push   $0x8054c6
+  800126:	68 e3 54 80 00       	push   $0x8054e3
+  80012b:	6a 1b                	push   $0x1b
+  80012d:	68 94 54 80 00       	push   $0x805494
+  800132:	e8 60 01 00 00       	call   800297 <_panic>
+		panic("fork: %e", envid);
+  800137:	50                   	push   %eax
+  800138:	68 f8 54 80 00       	push   $0x8054f8
+  80013d:	6a 1f                	push   $0x1f
+  80013f:	68 94 54 80 00       	push   $0x805494
+  800144:	e8 4e 01 00 00       	call   800297 <_panic>
+		assert(thisenv->env_rss_max == limit);
+  800149:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80014e:	8b 40 6c             	mov    0x6c(%eax),%eax
+  800151:	39 f0                	cmp    %esi,%eax
+  800153:	75 5b                	jne    8001b0 <umain+0x17d>
+		assert(sys_env_set_rss(0, 0, limit + 1) == -E_INVAL);
+  800155:	83 ec 04             	sub    $0x4,%esp
+  800158:	83 c7 41             	add    $0x41,%edi
+  80015b:	57                   	push   %edi
+  80015c:	6a 00                	push   $0x0
+  80015e:	6a 00                	push   $0x0
+  800160:	e8 b6 0f 00 00       	call   80111b <sys_env_set_rss>
+  800165:	83 c4 10             	add    $0x10,%esp
+  800168:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80016b:	75 59                	jne    8001c6 <umain+0x193>
+		assert(sys_env_set_rss(0, 0, 0) == -E_INVAL);
+  80016d:	83 ec 04             	sub    $0x4,%esp
+  800170:	6a 00                	push   $0x0
+  800172:	6a 00                	push   $0x0
+  800174:	6a 00                	push   $0x0
+  800176:	e8 a0 0f 00 00       	call   80111b <sys_env_set_rss>
+  80017b:	83 c4 10             	add    $0x10,%esp
+  80017e:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800181:	75 59                	jne    8001dc <umain+0x1a9>
+		for (va = BASE; va < BASE + NPAGES*PGSIZE; va += PGSIZE)
+  800183:	b8 00 00 00 10       	mov    $0x10000000,%eax
+			assert(*(uintptr_t*)va == va);
+  800188:	39 00                	cmp    %eax,(%eax)
+  80018a:	75 66                	jne    8001f2 <umain+0x1bf>
+		for (va = BASE; va < BASE + NPAGES*PGSIZE; va += PGSIZE)
+  80018c:	05 00 10 00 00       	add    $0x1000,%eax
+  800191:	3d 00 00 20 10       	cmp    $0x10200000,%eax
+  800196:	75 f0                	jne    800188 <umain+0x155>
+		cprintf("rsslimit: child passed all checks!\n");
+  800198:	83 ec 0c             	sub    $0xc,%esp
+  80019b:	68 ac 55 80 00       	push   $0x8055ac
+  8001a0:	e8 cd 01 00 00       	call   800372 <cprintf>
+		return;
+  8001a5:	83 c4 10             	add    $0x10,%esp
+}
+  8001a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001ab:	5b                   	pop    %ebx
+  8001ac:	5e                   	pop    %esi
+  8001ad:	5f                   	pop    %edi
+  8001ae:	5d                   	pop    %ebp
+  8001af:	c3                   	ret
+		assert(thisenv->env_rss_max == limit);
+  8001b0:	68 01 55 80 00       	push   $0x805501
+  8001b5:	68 e3 54 80 00       	push   $0x8054e3
+  8001ba:	6a 21                	push   $0x21
+  8001bc:	68 94 54 80 00       	push   $0x805494
+  8001c1:	e8 d1 00 00 00       	call   800297 <_panic>
+		assert(sys_env_set_rss(0, 0, limit + 1) == -E_INVAL);
+  8001c6:	68 54 55 80 00       	push   $0x805554
+  8001cb:	68 e3 54 80 00       	push   $0x8054e3
+  8001d0:	6a 22                	push   $0x22
+  8001d2:	68 94 54 80 00       	push   $0x805494
+  8001d7:	e8 bb 00 00 00       	call   800297 <_panic>
+		assert(sys_env_set_rss(0, 0, 0) == -E_INVAL);
+  8001dc:	68 84 55 80 00       	push   $0x805584
+  8001e1:	68 e3 54 80 00       	push   $0x8054e3
+  8001e6:	6a 23                	push   $0x23
+  8001e8:	68 94 54 80 00       	push   $0x805494
+  8001ed:	e8 a5 00 00 00       	call   800297 <_panic>
+			assert(*(uintptr_t*)va == va);
+  8001f2:	68 1f 55 80 00       	push   $0x80551f
+  8001f7:	68 e3 54 80 00       	push   $0x8054e3
+  8001fc:	6a 25                	push   $0x25
+  8001fe:	68 94 54 80 00       	push   $0x805494
+  800203:	e8 8f 00 00 00       	call   800297 <_panic>
+		assert(*(uintptr_t*)va == va);
+  800208:	68 1f 55 80 00       	push   $0x80551f
+  80020d:	68 e3 54 80 00       	push   $0x8054e3
+  800212:	6a 2b                	push   $0x2b
+  800214:	68 94 54 80 00       	push   $0x805494
+  800219:	e8 79 00 00 00       	call   800297 <_panic>
+		assert(thisenv->env_npages <= limit);
+  80021e:	68 c6 54 80 00       	push   $0x8054c6
+  800223:	68 e3 54 80 00       	push   $0x8054e3
+  800228:	6a 2c                	push   $0x2c
+  80022a:	68 94 54 80 00       	push   $0x805494
+  80022f:	e8 63 00 00 00       	call   800297 <_panic>
+
+00800234 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800234:	55                   	push   %ebp
+  800235:	89 e5                	mov    %esp,%ebp
+  800237:	56                   	push   %esi
+  800238:	53                   	push   %ebx
+  800239:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80023c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  80023f:	e8 ca 0b 00 00       	call   800e0e <sys_getenvid>
+  800244:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800249:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80024c:	c1 e0 06             	shl    $0x6,%eax
+  80024f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800254:	a3 18 f9 80 00       	mov    %eax,0x80f918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800259:	85 db                	test   %ebx,%ebx
+  80025b:	7e 07                	jle    800264 <libmain+0x30>
+		binaryname = argv[0];
+  80025d:	8b 06                	mov    (%esi),%eax
+  80025f:	a3 00 70 80 00       	mov    %eax,0x807000
+
+	// call user main routine
+	umain(argc, argv);
+  800264:	83 ec 08             	sub    $0x8,%esp
+  800267:	56                   	push   %esi
+  800268:	53                   	push   %ebx
+  800269:	e8 c5 fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80026e:	e8 0a 00 00 00       	call   80027d <exit>
+}
+  800273:	83 c4 10             	add    $0x10,%esp
+  800276:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800279:	5b                   	pop    %ebx
+  80027a:	5e                   	pop    %esi
+  80027b:	5d                   	pop    %ebp
+  80027c:	c3                   	ret
+
+0080027d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80027d:	55                   	push   %ebp
+  80027e:	89 e5                	mov    %esp,%ebp
+  800280:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800283:	e8 de 18 00 00       	call   801b66 <close_all>
+	sys_env_destroy(0);
+  800288:	83 ec 0c             	sub    $0xc,%esp
+  80028b:	6a 00                	push   $0x0
+  80028d:	e8 3b 0b 00 00       	call   800dcd <sys_env_destroy>
+}
+  800292:	83 c4 10             	add    $0x10,%esp
+  800295:	c9                   	leave
+  800296:	c3                   	ret
+
+00800297 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  80029a:	56                   	push   %esi
+  80029b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80029c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80029f:	8b 35 00 70 80 00    	mov    0x807000,%esi
+  8002a5:	e8 64 0b 00 00       	call   800e0e <sys_getenvid>
+  8002aa:	83 ec 0c             	sub    $0xc,%esp
+  8002ad:	ff 75 0c             	push   0xc(%ebp)
+  8002b0:	ff 75 08             	push   0x8(%ebp)
+  8002b3:	56                   	push   %esi
+  8002b4:	50                   	push   %eax
+  8002b5:	68 dc 55 80 00       	push   $0x8055dc
+  8002ba:	e8 b3 00 00 00       	call   800372 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002bf:	83 c4 18             	add    $0x18,%esp
+  8002c2:	53                   	push   %ebx
+  8002c3:	ff 75 10             	push   0x10(%ebp)
+  8002c6:	e8 56 00 00 00       	call   800321 <vcprintf>
+	cprintf("\n");
+  8002cb:	c7 04 24 51 55 80 00 	movl   $0x805551,(%esp)
+  8002d2:	e8 9b 00 00 00       	call   800372 <cprintf>
+  8002d7:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002da:	cc                   	int3
+	while (1)
+  8002db:	eb fd                	jmp    8002da <_panic+0x43>
+
+008002dd <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002dd:	55                   	push   %ebp
+  8002de:	89 e5                	mov    %esp,%ebp
+  8002e0:	53                   	push   %ebx
+  8002e1:	83 ec 04             	sub    $0x4,%esp
+  8002e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002e7:	8b 13                	mov    (%ebx),%edx
+  8002e9:	8d 42 01             	lea    0x1(%edx),%eax
+  8002ec:	89 03                	mov    %eax,(%ebx)
+  8002ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002f1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002f5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002fa:	74 09                	je     800305 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002fc:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800300:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800303:	c9                   	leave
+  800304:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800305:	83 ec 08             	sub    $0x8,%esp
+  800308:	68 ff 00 00 00       	push   $0xff
+  80030d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800310:	50                   	push   %eax
+  800311:	e8 69 0a 00 00       	call   800d7f <sys_cputs>
+		b->idx = 0;
+  800316:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	eb db                	jmp    8002fc <putch+0x1f>
+
+00800321 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800321:	55                   	push   %ebp
+  800322:	89 e5                	mov    %esp,%ebp
+  800324:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80032a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800331:	00 00 00 
+	b.cnt = 0;
+  800334:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80033b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80033e:	ff 75 0c             	push   0xc(%ebp)
+  800341:	ff 75 08             	push   0x8(%ebp)
+  800344:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80034a:	50                   	push   %eax
+  80034b:	68 dd 02 80 00       	push   $0x8002dd
+  800350:	e8 14 01 00 00       	call   800469 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800355:	83 c4 08             	add    $0x8,%esp
+  800358:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80035e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800364:	50                   	push   %eax
+  800365:	e8 15 0a 00 00       	call   800d7f <sys_cputs>
+
+	return b.cnt;
+}
+  80036a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800370:	c9                   	leave
+  800371:	c3                   	ret
+
+00800372 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800372:	55                   	push   %ebp
+  800373:	89 e5                	mov    %esp,%ebp
+  800375:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800378:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80037b:	50                   	push   %eax
+  80037c:	ff 75 08             	push   0x8(%ebp)
+  80037f:	e8 9d ff ff ff       	call   800321 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800384:	c9                   	leave
+  800385:	c3                   	ret
+
+00800386 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800386:	55                   	push   %ebp
+  800387:	89 e5                	mov    %esp,%ebp
+  800389:	57                   	push   %edi
+  80038a:	56                   	push   %esi
+  80038b:	53                   	push   %ebx
+  80038c:	83 ec 1c             	sub    $0x1c,%esp
+  80038f:	89 c7                	mov    %eax,%edi
+  800391:	89 d6                	mov    %edx,%esi
+  800393:	8b 45 08             	mov    0x8(%ebp),%eax
+  800396:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800399:	89 d1                	mov    %edx,%ecx
+  80039b:	89 c2                	mov    %eax,%edx
+  80039d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003a0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003a3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003a6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003a9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003ac:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003b3:	39 c2                	cmp    %eax,%edx
+  8003b5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003b8:	72 3e                	jb     8003f8 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003ba:	83 ec 0c             	sub    $0xc,%esp
+  8003bd:	ff 75 18             	push   0x18(%ebp)
+  8003c0:	83 eb 01             	sub    $0x1,%ebx
+  8003c3:	53                   	push   %ebx
+  8003c4:	50                   	push   %eax
+  8003c5:	83 ec 08             	sub    $0x8,%esp
+  8003c8:	ff 75 e4             	push   -0x1c(%ebp)
+  8003cb:	ff 75 e0             	push   -0x20(%ebp)
+  8003ce:	ff 75 dc             	push   -0x24(%ebp)
+  8003d1:	ff 75 d8             	push   -0x28(%ebp)
+  8003d4:	e8 6e 4f 00 00       	call   805347 <__udivdi3>
+  8003d9:	83 c4 18             	add    $0x18,%esp
+  8003dc:	52                   	push   %edx
+  8003dd:	50                   	push   %eax
+  8003de:	89 f2                	mov    %esi,%edx
+  8003e0:	89 f8                	mov    %edi,%eax
+  8003e2:	e8 9f ff ff ff       	call   800386 <printnum>
+  8003e7:	83 c4 20             	add    $0x20,%esp
+  8003ea:	eb 13                	jmp    8003ff <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003ec:	83 ec 08             	sub    $0x8,%esp
+  8003ef:	56                   	push   %esi
+  8003f0:	ff 75 18             	push   0x18(%ebp)
+  8003f3:	ff d7                	call   *%edi
+  8003f5:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003f8:	83 eb 01             	sub    $0x1,%ebx
+  8003fb:	85 db                	test   %ebx,%ebx
+  8003fd:	7f ed                	jg     8003ec <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003ff:	83 ec 08             	sub    $0x8,%esp
+  800402:	56                   	push   %esi
+  800403:	83 ec 04             	sub    $0x4,%esp
+  800406:	ff 75 e4             	push   -0x1c(%ebp)
+  800409:	ff 75 e0             	push   -0x20(%ebp)
+  80040c:	ff 75 dc             	push   -0x24(%ebp)
+  80040f:	ff 75 d8             	push   -0x28(%ebp)
+  800412:	e8 4e 4f 00 00       	call   805365 <__umoddi3>
+  800417:	83 c4 14             	add    $0x14,%esp
+  80041a:	0f be 80 ff 55 80 00 	movsbl 0x8055ff(%eax),%eax
+  800421:	50                   	push   %eax
+  800422:	ff d7                	call   *%edi
+}
+  800424:	83 c4 10             	add    $0x10,%esp
+  800427:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80042a:	5b                   	pop    %ebx
+  80042b:	5e                   	pop    %esi
+  80042c:	5f                   	pop    %edi
+  80042d:	5d                   	pop    %ebp
+  80042e:	c3                   	ret
+
+0080042f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80042f:	55                   	push   %ebp
+  800430:	89 e5                	mov    %esp,%ebp
+  800432:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800435:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800439:	8b 10                	mov    (%eax),%edx
+  80043b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80043e:	73 0a                	jae    80044a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800440:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800443:	89 08                	mov    %ecx,(%eax)
+  800445:	8b 45 08             	mov    0x8(%ebp),%eax
+  800448:	88 02                	mov    %al,(%edx)
+}
+  80044a:	5d                   	pop    %ebp
+  80044b:	c3                   	ret
+
+0080044c <printfmt>:
+{
+  80044c:	55                   	push   %ebp
+  80044d:	89 e5                	mov    %esp,%ebp
+  80044f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800452:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800455:	50                   	push   %eax
+  800456:	ff 75 10             	push   0x10(%ebp)
+  800459:	ff 75 0c             	push   0xc(%ebp)
+  80045c:	ff 75 08             	push   0x8(%ebp)
+  80045f:	e8 05 00 00 00       	call   800469 <vprintfmt>
+}
+  800464:	83 c4 10             	add    $0x10,%esp
+  800467:	c9                   	leave
+  800468:	c3                   	ret
+
+00800469 <vprintfmt>:
+{
+  800469:	55                   	push   %ebp
+  80046a:	89 e5                	mov    %esp,%ebp
+  80046c:	57                   	push   %edi
+  80046d:	56                   	push   %esi
+  80046e:	53                   	push   %ebx
+  80046f:	83 ec 2c             	sub    $0x2c,%esp
+  800472:	8b 75 08             	mov    0x8(%ebp),%esi
+  800475:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800478:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80047b:	eb 0a                	jmp    800487 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80047d:	83 ec 08             	sub    $0x8,%esp
+  800480:	53                   	push   %ebx
+  800481:	50                   	push   %eax
+  800482:	ff d6                	call   *%esi
+  800484:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800487:	83 c7 01             	add    $0x1,%edi
+  80048a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80048e:	83 f8 25             	cmp    $0x25,%eax
+  800491:	74 0c                	je     80049f <vprintfmt+0x36>
+			if (ch == '\0')
+  800493:	85 c0                	test   %eax,%eax
+  800495:	75 e6                	jne    80047d <vprintfmt+0x14>
+}
+  800497:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80049a:	5b                   	pop    %ebx
+  80049b:	5e                   	pop    %esi
+  80049c:	5f                   	pop    %edi
+  80049d:	5d                   	pop    %ebp
+  80049e:	c3                   	ret
+		padc = ' ';
+  80049f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8004a3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004aa:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004b1:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004bd:	8d 47 01             	lea    0x1(%edi),%eax
+  8004c0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004c3:	0f b6 17             	movzbl (%edi),%edx
+  8004c6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004c9:	3c 55                	cmp    $0x55,%al
+  8004cb:	0f 87 c5 03 00 00    	ja     800896 <vprintfmt+0x42d>
+  8004d1:	0f b6 c0             	movzbl %al,%eax
+  8004d4:	ff 24 85 80 57 80 00 	jmp    *0x805780(,%eax,4)
+  8004db:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8004de:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8004e2:	eb d9                	jmp    8004bd <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004e7:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004eb:	eb d0                	jmp    8004bd <vprintfmt+0x54>
+  8004ed:	0f b6 d2             	movzbl %dl,%edx
+  8004f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004fb:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004fe:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800502:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800505:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800508:	83 f9 09             	cmp    $0x9,%ecx
+  80050b:	77 55                	ja     800562 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80050d:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800510:	eb e9                	jmp    8004fb <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800512:	8b 45 14             	mov    0x14(%ebp),%eax
+  800515:	8b 00                	mov    (%eax),%eax
+  800517:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80051a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051d:	8d 40 04             	lea    0x4(%eax),%eax
+  800520:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800523:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800526:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80052a:	79 91                	jns    8004bd <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80052c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80052f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800532:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800539:	eb 82                	jmp    8004bd <vprintfmt+0x54>
+			if (width < 0)
+  80053b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80053e:	85 d2                	test   %edx,%edx
+  800540:	b8 00 00 00 00       	mov    $0x0,%eax
+  800545:	0f 49 c2             	cmovns %edx,%eax
+  800548:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80054b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80054e:	e9 6a ff ff ff       	jmp    8004bd <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800553:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800556:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80055d:	e9 5b ff ff ff       	jmp    8004bd <vprintfmt+0x54>
+  800562:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800565:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800568:	eb bc                	jmp    800526 <vprintfmt+0xbd>
+			lflag++;
+  80056a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80056d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800570:	e9 48 ff ff ff       	jmp    8004bd <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800575:	8b 45 14             	mov    0x14(%ebp),%eax
+  800578:	8d 78 04             	lea    0x4(%eax),%edi
+  80057b:	83 ec 08             	sub    $0x8,%esp
+  80057e:	53                   	push   %ebx
+  80057f:	ff 30                	push   (%eax)
+  800581:	ff d6                	call   *%esi
+			break;
+  800583:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800586:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800589:	e9 63 02 00 00       	jmp    8007f1 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  80058e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800591:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800594:	8b 10                	mov    (%eax),%edx
+  800596:	89 d0                	mov    %edx,%eax
+  800598:	f7 d8                	neg    %eax
+  80059a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80059d:	83 f8 12             	cmp    $0x12,%eax
+  8005a0:	7f 23                	jg     8005c5 <vprintfmt+0x15c>
+  8005a2:	8b 14 85 e0 58 80 00 	mov    0x8058e0(,%eax,4),%edx
+  8005a9:	85 d2                	test   %edx,%edx
+  8005ab:	74 18                	je     8005c5 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8005ad:	52                   	push   %edx
+  8005ae:	68 f5 54 80 00       	push   $0x8054f5
+  8005b3:	53                   	push   %ebx
+  8005b4:	56                   	push   %esi
+  8005b5:	e8 92 fe ff ff       	call   80044c <printfmt>
+  8005ba:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005bd:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005c0:	e9 2c 02 00 00       	jmp    8007f1 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  8005c5:	50                   	push   %eax
+  8005c6:	68 17 56 80 00       	push   $0x805617
+  8005cb:	53                   	push   %ebx
+  8005cc:	56                   	push   %esi
+  8005cd:	e8 7a fe ff ff       	call   80044c <printfmt>
+  8005d2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005d5:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005d8:	e9 14 02 00 00       	jmp    8007f1 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e0:	83 c0 04             	add    $0x4,%eax
+  8005e3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e9:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005eb:	85 c9                	test   %ecx,%ecx
+  8005ed:	b8 10 56 80 00       	mov    $0x805610,%eax
+  8005f2:	0f 45 c1             	cmovne %ecx,%eax
+  8005f5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005f8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005fc:	7e 06                	jle    800604 <vprintfmt+0x19b>
+  8005fe:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800602:	75 0b                	jne    80060f <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800604:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800607:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80060a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80060d:	eb 5c                	jmp    80066b <vprintfmt+0x202>
+  80060f:	83 ec 08             	sub    $0x8,%esp
+  800612:	ff 75 d0             	push   -0x30(%ebp)
+  800615:	ff 75 cc             	push   -0x34(%ebp)
+  800618:	e8 19 03 00 00       	call   800936 <strnlen>
+  80061d:	89 c2                	mov    %eax,%edx
+  80061f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800622:	29 d0                	sub    %edx,%eax
+  800624:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800627:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80062b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80062e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800631:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800633:	eb 0e                	jmp    800643 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800635:	83 ec 08             	sub    $0x8,%esp
+  800638:	53                   	push   %ebx
+  800639:	57                   	push   %edi
+  80063a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80063d:	83 ee 01             	sub    $0x1,%esi
+  800640:	83 c4 10             	add    $0x10,%esp
+  800643:	85 f6                	test   %esi,%esi
+  800645:	7f ee                	jg     800635 <vprintfmt+0x1cc>
+  800647:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80064a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80064d:	85 c0                	test   %eax,%eax
+  80064f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800654:	0f 49 d0             	cmovns %eax,%edx
+  800657:	29 d0                	sub    %edx,%eax
+  800659:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80065c:	eb a6                	jmp    800604 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80065e:	83 ec 08             	sub    $0x8,%esp
+  800661:	53                   	push   %ebx
+  800662:	52                   	push   %edx
+  800663:	ff 55 08             	call   *0x8(%ebp)
+  800666:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800669:	89 f1                	mov    %esi,%ecx
+  80066b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80066e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800672:	0f be d0             	movsbl %al,%edx
+  800675:	85 d2                	test   %edx,%edx
+  800677:	74 28                	je     8006a1 <vprintfmt+0x238>
+  800679:	85 ff                	test   %edi,%edi
+  80067b:	78 05                	js     800682 <vprintfmt+0x219>
+  80067d:	83 ef 01             	sub    $0x1,%edi
+  800680:	78 30                	js     8006b2 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800682:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800686:	74 d6                	je     80065e <vprintfmt+0x1f5>
+  800688:	0f be c0             	movsbl %al,%eax
+  80068b:	83 e8 20             	sub    $0x20,%eax
+  80068e:	83 f8 5e             	cmp    $0x5e,%eax
+  800691:	76 cb                	jbe    80065e <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800693:	83 ec 08             	sub    $0x8,%esp
+  800696:	53                   	push   %ebx
+  800697:	6a 3f                	push   $0x3f
+  800699:	ff 55 08             	call   *0x8(%ebp)
+  80069c:	83 c4 10             	add    $0x10,%esp
+  80069f:	eb c8                	jmp    800669 <vprintfmt+0x200>
+  8006a1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006a4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006a7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006aa:	01 d0                	add    %edx,%eax
+  8006ac:	29 c8                	sub    %ecx,%eax
+  8006ae:	89 c7                	mov    %eax,%edi
+  8006b0:	eb 13                	jmp    8006c5 <vprintfmt+0x25c>
+  8006b2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006b5:	eb ed                	jmp    8006a4 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8006b7:	83 ec 08             	sub    $0x8,%esp
+  8006ba:	53                   	push   %ebx
+  8006bb:	6a 20                	push   $0x20
+  8006bd:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8006bf:	83 ef 01             	sub    $0x1,%edi
+  8006c2:	83 c4 10             	add    $0x10,%esp
+  8006c5:	85 ff                	test   %edi,%edi
+  8006c7:	7f ee                	jg     8006b7 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006c9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006cc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006cf:	e9 1d 01 00 00       	jmp    8007f1 <vprintfmt+0x388>
+	if (lflag >= 2)
+  8006d4:	83 f9 01             	cmp    $0x1,%ecx
+  8006d7:	7f 1b                	jg     8006f4 <vprintfmt+0x28b>
+	else if (lflag)
+  8006d9:	85 c9                	test   %ecx,%ecx
+  8006db:	74 63                	je     800740 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  8006dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e0:	8b 00                	mov    (%eax),%eax
+  8006e2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e5:	99                   	cltd
+  8006e6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ef:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f2:	eb 17                	jmp    80070b <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  8006f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f7:	8b 50 04             	mov    0x4(%eax),%edx
+  8006fa:	8b 00                	mov    (%eax),%eax
+  8006fc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ff:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8d 40 08             	lea    0x8(%eax),%eax
+  800708:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80070b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80070e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800711:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800716:	85 c9                	test   %ecx,%ecx
+  800718:	0f 89 b9 00 00 00    	jns    8007d7 <vprintfmt+0x36e>
+				putch('-', putdat);
+  80071e:	83 ec 08             	sub    $0x8,%esp
+  800721:	53                   	push   %ebx
+  800722:	6a 2d                	push   $0x2d
+  800724:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800726:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800729:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80072c:	f7 da                	neg    %edx
+  80072e:	83 d1 00             	adc    $0x0,%ecx
+  800731:	f7 d9                	neg    %ecx
+  800733:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800736:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80073b:	e9 97 00 00 00       	jmp    8007d7 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800740:	8b 45 14             	mov    0x14(%ebp),%eax
+  800743:	8b 00                	mov    (%eax),%eax
+  800745:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800748:	99                   	cltd
+  800749:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80074c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074f:	8d 40 04             	lea    0x4(%eax),%eax
+  800752:	89 45 14             	mov    %eax,0x14(%ebp)
+  800755:	eb b4                	jmp    80070b <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  800757:	83 f9 01             	cmp    $0x1,%ecx
+  80075a:	7f 1b                	jg     800777 <vprintfmt+0x30e>
+	else if (lflag)
+  80075c:	85 c9                	test   %ecx,%ecx
+  80075e:	74 2c                	je     80078c <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800760:	8b 45 14             	mov    0x14(%ebp),%eax
+  800763:	8b 10                	mov    (%eax),%edx
+  800765:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076a:	8d 40 04             	lea    0x4(%eax),%eax
+  80076d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800770:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800775:	eb 60                	jmp    8007d7 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800777:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077a:	8b 10                	mov    (%eax),%edx
+  80077c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80077f:	8d 40 08             	lea    0x8(%eax),%eax
+  800782:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800785:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80078a:	eb 4b                	jmp    8007d7 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80078c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078f:	8b 10                	mov    (%eax),%edx
+  800791:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800796:	8d 40 04             	lea    0x4(%eax),%eax
+  800799:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80079c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8007a1:	eb 34                	jmp    8007d7 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8007a3:	83 f9 01             	cmp    $0x1,%ecx
+  8007a6:	7f 15                	jg     8007bd <vprintfmt+0x354>
+	else if (lflag)
+  8007a8:	85 c9                	test   %ecx,%ecx
+  8007aa:	74 4d                	je     8007f9 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8007ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007af:	8b 00                	mov    (%eax),%eax
+  8007b1:	99                   	cltd
+  8007b2:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8007b5:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8007b8:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8007bb:	eb 11                	jmp    8007ce <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  8007bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c0:	8b 50 04             	mov    0x4(%eax),%edx
+  8007c3:	8b 00                	mov    (%eax),%eax
+  8007c5:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8007c8:	8d 49 08             	lea    0x8(%ecx),%ecx
+  8007cb:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  8007ce:	89 d1                	mov    %edx,%ecx
+  8007d0:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  8007d2:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007d7:	83 ec 0c             	sub    $0xc,%esp
+  8007da:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007de:	50                   	push   %eax
+  8007df:	ff 75 e0             	push   -0x20(%ebp)
+  8007e2:	57                   	push   %edi
+  8007e3:	51                   	push   %ecx
+  8007e4:	52                   	push   %edx
+  8007e5:	89 da                	mov    %ebx,%edx
+  8007e7:	89 f0                	mov    %esi,%eax
+  8007e9:	e8 98 fb ff ff       	call   800386 <printnum>
+			break;
+  8007ee:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007f4:	e9 8e fc ff ff       	jmp    800487 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  8007f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fc:	8b 00                	mov    (%eax),%eax
+  8007fe:	99                   	cltd
+  8007ff:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800802:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800805:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800808:	eb c4                	jmp    8007ce <vprintfmt+0x365>
+			putch('0', putdat);
+  80080a:	83 ec 08             	sub    $0x8,%esp
+  80080d:	53                   	push   %ebx
+  80080e:	6a 30                	push   $0x30
+  800810:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800812:	83 c4 08             	add    $0x8,%esp
+  800815:	53                   	push   %ebx
+  800816:	6a 78                	push   $0x78
+  800818:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80081a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081d:	8b 10                	mov    (%eax),%edx
+  80081f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800824:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800827:	8d 40 04             	lea    0x4(%eax),%eax
+  80082a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80082d:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800832:	eb a3                	jmp    8007d7 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800834:	83 f9 01             	cmp    $0x1,%ecx
+  800837:	7f 1b                	jg     800854 <vprintfmt+0x3eb>
+	else if (lflag)
+  800839:	85 c9                	test   %ecx,%ecx
+  80083b:	74 2f                	je     80086c <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  80083d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800840:	8b 10                	mov    (%eax),%edx
+  800842:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800847:	8d 40 04             	lea    0x4(%eax),%eax
+  80084a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80084d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800852:	eb 83                	jmp    8007d7 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800854:	8b 45 14             	mov    0x14(%ebp),%eax
+  800857:	8b 10                	mov    (%eax),%edx
+  800859:	8b 48 04             	mov    0x4(%eax),%ecx
+  80085c:	8d 40 08             	lea    0x8(%eax),%eax
+  80085f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800862:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800867:	e9 6b ff ff ff       	jmp    8007d7 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80086c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086f:	8b 10                	mov    (%eax),%edx
+  800871:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800876:	8d 40 04             	lea    0x4(%eax),%eax
+  800879:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80087c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800881:	e9 51 ff ff ff       	jmp    8007d7 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800886:	83 ec 08             	sub    $0x8,%esp
+  800889:	53                   	push   %ebx
+  80088a:	6a 25                	push   $0x25
+  80088c:	ff d6                	call   *%esi
+			break;
+  80088e:	83 c4 10             	add    $0x10,%esp
+  800891:	e9 5b ff ff ff       	jmp    8007f1 <vprintfmt+0x388>
+			putch('%', putdat);
+  800896:	83 ec 08             	sub    $0x8,%esp
+  800899:	53                   	push   %ebx
+  80089a:	6a 25                	push   $0x25
+  80089c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80089e:	83 c4 10             	add    $0x10,%esp
+  8008a1:	89 f8                	mov    %edi,%eax
+  8008a3:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008a7:	74 05                	je     8008ae <vprintfmt+0x445>
+  8008a9:	83 e8 01             	sub    $0x1,%eax
+  8008ac:	eb f5                	jmp    8008a3 <vprintfmt+0x43a>
+  8008ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008b1:	e9 3b ff ff ff       	jmp    8007f1 <vprintfmt+0x388>
+
+008008b6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008b6:	55                   	push   %ebp
+  8008b7:	89 e5                	mov    %esp,%ebp
+  8008b9:	83 ec 18             	sub    $0x18,%esp
+  8008bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008c2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008c5:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008c9:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008cc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008d3:	85 c0                	test   %eax,%eax
+  8008d5:	74 26                	je     8008fd <vsnprintf+0x47>
+  8008d7:	85 d2                	test   %edx,%edx
+  8008d9:	7e 22                	jle    8008fd <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008db:	ff 75 14             	push   0x14(%ebp)
+  8008de:	ff 75 10             	push   0x10(%ebp)
+  8008e1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008e4:	50                   	push   %eax
+  8008e5:	68 2f 04 80 00       	push   $0x80042f
+  8008ea:	e8 7a fb ff ff       	call   800469 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008ef:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008f2:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008f8:	83 c4 10             	add    $0x10,%esp
+}
+  8008fb:	c9                   	leave
+  8008fc:	c3                   	ret
+		return -E_INVAL;
+  8008fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800902:	eb f7                	jmp    8008fb <vsnprintf+0x45>
+
+00800904 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800904:	55                   	push   %ebp
+  800905:	89 e5                	mov    %esp,%ebp
+  800907:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80090a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80090d:	50                   	push   %eax
+  80090e:	ff 75 10             	push   0x10(%ebp)
+  800911:	ff 75 0c             	push   0xc(%ebp)
+  800914:	ff 75 08             	push   0x8(%ebp)
+  800917:	e8 9a ff ff ff       	call   8008b6 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80091c:	c9                   	leave
+  80091d:	c3                   	ret
+
+0080091e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80091e:	55                   	push   %ebp
+  80091f:	89 e5                	mov    %esp,%ebp
+  800921:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800924:	b8 00 00 00 00       	mov    $0x0,%eax
+  800929:	eb 03                	jmp    80092e <strlen+0x10>
+		n++;
+  80092b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80092e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800932:	75 f7                	jne    80092b <strlen+0xd>
+	return n;
+}
+  800934:	5d                   	pop    %ebp
+  800935:	c3                   	ret
+
+00800936 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800936:	55                   	push   %ebp
+  800937:	89 e5                	mov    %esp,%ebp
+  800939:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80093c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80093f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800944:	eb 03                	jmp    800949 <strnlen+0x13>
+		n++;
+  800946:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800949:	39 d0                	cmp    %edx,%eax
+  80094b:	74 08                	je     800955 <strnlen+0x1f>
+  80094d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800951:	75 f3                	jne    800946 <strnlen+0x10>
+  800953:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800955:	89 d0                	mov    %edx,%eax
+  800957:	5d                   	pop    %ebp
+  800958:	c3                   	ret
+
+00800959 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800959:	55                   	push   %ebp
+  80095a:	89 e5                	mov    %esp,%ebp
+  80095c:	53                   	push   %ebx
+  80095d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800960:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800963:	b8 00 00 00 00       	mov    $0x0,%eax
+  800968:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80096c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80096f:	83 c0 01             	add    $0x1,%eax
+  800972:	84 d2                	test   %dl,%dl
+  800974:	75 f2                	jne    800968 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800976:	89 c8                	mov    %ecx,%eax
+  800978:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80097b:	c9                   	leave
+  80097c:	c3                   	ret
+
+0080097d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80097d:	55                   	push   %ebp
+  80097e:	89 e5                	mov    %esp,%ebp
+  800980:	53                   	push   %ebx
+  800981:	83 ec 10             	sub    $0x10,%esp
+  800984:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800987:	53                   	push   %ebx
+  800988:	e8 91 ff ff ff       	call   80091e <strlen>
+  80098d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800990:	ff 75 0c             	push   0xc(%ebp)
+  800993:	01 d8                	add    %ebx,%eax
+  800995:	50                   	push   %eax
+  800996:	e8 be ff ff ff       	call   800959 <strcpy>
+	return dst;
+}
+  80099b:	89 d8                	mov    %ebx,%eax
+  80099d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009a0:	c9                   	leave
+  8009a1:	c3                   	ret
+
+008009a2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009a2:	55                   	push   %ebp
+  8009a3:	89 e5                	mov    %esp,%ebp
+  8009a5:	56                   	push   %esi
+  8009a6:	53                   	push   %ebx
+  8009a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009ad:	89 f3                	mov    %esi,%ebx
+  8009af:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009b2:	89 f0                	mov    %esi,%eax
+  8009b4:	eb 0f                	jmp    8009c5 <strncpy+0x23>
+		*dst++ = *src;
+  8009b6:	83 c0 01             	add    $0x1,%eax
+  8009b9:	0f b6 0a             	movzbl (%edx),%ecx
+  8009bc:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009bf:	80 f9 01             	cmp    $0x1,%cl
+  8009c2:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009c5:	39 d8                	cmp    %ebx,%eax
+  8009c7:	75 ed                	jne    8009b6 <strncpy+0x14>
+	}
+	return ret;
+}
+  8009c9:	89 f0                	mov    %esi,%eax
+  8009cb:	5b                   	pop    %ebx
+  8009cc:	5e                   	pop    %esi
+  8009cd:	5d                   	pop    %ebp
+  8009ce:	c3                   	ret
+
+008009cf <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009cf:	55                   	push   %ebp
+  8009d0:	89 e5                	mov    %esp,%ebp
+  8009d2:	56                   	push   %esi
+  8009d3:	53                   	push   %ebx
+  8009d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009da:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009dd:	89 f0                	mov    %esi,%eax
+  8009df:	85 d2                	test   %edx,%edx
+  8009e1:	74 21                	je     800a04 <strlcpy+0x35>
+  8009e3:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009e7:	89 f2                	mov    %esi,%edx
+  8009e9:	eb 09                	jmp    8009f4 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009eb:	83 c1 01             	add    $0x1,%ecx
+  8009ee:	83 c2 01             	add    $0x1,%edx
+  8009f1:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009f4:	39 c2                	cmp    %eax,%edx
+  8009f6:	74 09                	je     800a01 <strlcpy+0x32>
+  8009f8:	0f b6 19             	movzbl (%ecx),%ebx
+  8009fb:	84 db                	test   %bl,%bl
+  8009fd:	75 ec                	jne    8009eb <strlcpy+0x1c>
+  8009ff:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a01:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a04:	29 f0                	sub    %esi,%eax
+}
+  800a06:	5b                   	pop    %ebx
+  800a07:	5e                   	pop    %esi
+  800a08:	5d                   	pop    %ebp
+  800a09:	c3                   	ret
+
+00800a0a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a0a:	55                   	push   %ebp
+  800a0b:	89 e5                	mov    %esp,%ebp
+  800a0d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a10:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a13:	eb 06                	jmp    800a1b <strcmp+0x11>
+		p++, q++;
+  800a15:	83 c1 01             	add    $0x1,%ecx
+  800a18:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a1b:	0f b6 01             	movzbl (%ecx),%eax
+  800a1e:	84 c0                	test   %al,%al
+  800a20:	74 04                	je     800a26 <strcmp+0x1c>
+  800a22:	3a 02                	cmp    (%edx),%al
+  800a24:	74 ef                	je     800a15 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a26:	0f b6 c0             	movzbl %al,%eax
+  800a29:	0f b6 12             	movzbl (%edx),%edx
+  800a2c:	29 d0                	sub    %edx,%eax
+}
+  800a2e:	5d                   	pop    %ebp
+  800a2f:	c3                   	ret
+
+00800a30 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a30:	55                   	push   %ebp
+  800a31:	89 e5                	mov    %esp,%ebp
+  800a33:	53                   	push   %ebx
+  800a34:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a3a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a3d:	eb 09                	jmp    800a48 <strncmp+0x18>
+		n--, p++, q++;
+  800a3f:	83 ea 01             	sub    $0x1,%edx
+  800a42:	83 c0 01             	add    $0x1,%eax
+  800a45:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a48:	85 d2                	test   %edx,%edx
+  800a4a:	74 18                	je     800a64 <strncmp+0x34>
+  800a4c:	0f b6 18             	movzbl (%eax),%ebx
+  800a4f:	84 db                	test   %bl,%bl
+  800a51:	74 04                	je     800a57 <strncmp+0x27>
+  800a53:	3a 19                	cmp    (%ecx),%bl
+  800a55:	74 e8                	je     800a3f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a57:	0f b6 00             	movzbl (%eax),%eax
+  800a5a:	0f b6 11             	movzbl (%ecx),%edx
+  800a5d:	29 d0                	sub    %edx,%eax
+}
+  800a5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a62:	c9                   	leave
+  800a63:	c3                   	ret
+		return 0;
+  800a64:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a69:	eb f4                	jmp    800a5f <strncmp+0x2f>
+
+00800a6b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a6b:	55                   	push   %ebp
+  800a6c:	89 e5                	mov    %esp,%ebp
+  800a6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a71:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a75:	eb 03                	jmp    800a7a <strchr+0xf>
+  800a77:	83 c0 01             	add    $0x1,%eax
+  800a7a:	0f b6 10             	movzbl (%eax),%edx
+  800a7d:	84 d2                	test   %dl,%dl
+  800a7f:	74 06                	je     800a87 <strchr+0x1c>
+		if (*s == c)
+  800a81:	38 ca                	cmp    %cl,%dl
+  800a83:	75 f2                	jne    800a77 <strchr+0xc>
+  800a85:	eb 05                	jmp    800a8c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a8c:	5d                   	pop    %ebp
+  800a8d:	c3                   	ret
+
+00800a8e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a8e:	55                   	push   %ebp
+  800a8f:	89 e5                	mov    %esp,%ebp
+  800a91:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a94:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a98:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a9b:	38 ca                	cmp    %cl,%dl
+  800a9d:	74 09                	je     800aa8 <strfind+0x1a>
+  800a9f:	84 d2                	test   %dl,%dl
+  800aa1:	74 05                	je     800aa8 <strfind+0x1a>
+	for (; *s; s++)
+  800aa3:	83 c0 01             	add    $0x1,%eax
+  800aa6:	eb f0                	jmp    800a98 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800aa8:	5d                   	pop    %ebp
+  800aa9:	c3                   	ret
+
+00800aaa <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800aaa:	55                   	push   %ebp
+  800aab:	89 e5                	mov    %esp,%ebp
+  800aad:	57                   	push   %edi
+  800aae:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ab1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ab4:	85 c9                	test   %ecx,%ecx
+  800ab6:	74 20                	je     800ad8 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ab8:	89 f8                	mov    %edi,%eax
+  800aba:	09 c8                	or     %ecx,%eax
+  800abc:	a8 03                	test   $0x3,%al
+  800abe:	75 12                	jne    800ad2 <memset+0x28>
+		c &= 0xFF;
+  800ac0:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ac4:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800aca:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800acd:	fc                   	cld
+  800ace:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ad0:	eb 06                	jmp    800ad8 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ad2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ad5:	fc                   	cld
+  800ad6:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ad8:	89 f8                	mov    %edi,%eax
+  800ada:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800add:	c9                   	leave
+  800ade:	c3                   	ret
+
+00800adf <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800adf:	55                   	push   %ebp
+  800ae0:	89 e5                	mov    %esp,%ebp
+  800ae2:	57                   	push   %edi
+  800ae3:	56                   	push   %esi
+  800ae4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aea:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800aed:	39 c6                	cmp    %eax,%esi
+  800aef:	73 32                	jae    800b23 <memmove+0x44>
+  800af1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800af4:	39 d0                	cmp    %edx,%eax
+  800af6:	73 2b                	jae    800b23 <memmove+0x44>
+		s += n;
+		d += n;
+  800af8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800afb:	89 d6                	mov    %edx,%esi
+  800afd:	09 fe                	or     %edi,%esi
+  800aff:	09 ce                	or     %ecx,%esi
+  800b01:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b07:	75 0e                	jne    800b17 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b09:	83 ef 04             	sub    $0x4,%edi
+  800b0c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b0f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b12:	fd                   	std
+  800b13:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b15:	eb 09                	jmp    800b20 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b17:	83 ef 01             	sub    $0x1,%edi
+  800b1a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b1d:	fd                   	std
+  800b1e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b20:	fc                   	cld
+  800b21:	eb 1a                	jmp    800b3d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b23:	89 f2                	mov    %esi,%edx
+  800b25:	09 c2                	or     %eax,%edx
+  800b27:	09 ca                	or     %ecx,%edx
+  800b29:	f6 c2 03             	test   $0x3,%dl
+  800b2c:	75 0a                	jne    800b38 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b2e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b31:	89 c7                	mov    %eax,%edi
+  800b33:	fc                   	cld
+  800b34:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b36:	eb 05                	jmp    800b3d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b38:	89 c7                	mov    %eax,%edi
+  800b3a:	fc                   	cld
+  800b3b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b3d:	5e                   	pop    %esi
+  800b3e:	5f                   	pop    %edi
+  800b3f:	5d                   	pop    %ebp
+  800b40:	c3                   	ret
+
+00800b41 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b41:	55                   	push   %ebp
+  800b42:	89 e5                	mov    %esp,%ebp
+  800b44:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b47:	ff 75 10             	push   0x10(%ebp)
+  800b4a:	ff 75 0c             	push   0xc(%ebp)
+  800b4d:	ff 75 08             	push   0x8(%ebp)
+  800b50:	e8 8a ff ff ff       	call   800adf <memmove>
+}
+  800b55:	c9                   	leave
+  800b56:	c3                   	ret
+
+00800b57 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b57:	55                   	push   %ebp
+  800b58:	89 e5                	mov    %esp,%ebp
+  800b5a:	56                   	push   %esi
+  800b5b:	53                   	push   %ebx
+  800b5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b62:	89 c6                	mov    %eax,%esi
+  800b64:	03 75 10             	add    0x10(%ebp),%esi
+  800b67:	eb 06                	jmp    800b6f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b69:	83 c0 01             	add    $0x1,%eax
+  800b6c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b6f:	39 f0                	cmp    %esi,%eax
+  800b71:	74 14                	je     800b87 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b73:	0f b6 08             	movzbl (%eax),%ecx
+  800b76:	0f b6 1a             	movzbl (%edx),%ebx
+  800b79:	38 d9                	cmp    %bl,%cl
+  800b7b:	74 ec                	je     800b69 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b7d:	0f b6 c1             	movzbl %cl,%eax
+  800b80:	0f b6 db             	movzbl %bl,%ebx
+  800b83:	29 d8                	sub    %ebx,%eax
+  800b85:	eb 05                	jmp    800b8c <memcmp+0x35>
+	}
+
+	return 0;
+  800b87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b8c:	5b                   	pop    %ebx
+  800b8d:	5e                   	pop    %esi
+  800b8e:	5d                   	pop    %ebp
+  800b8f:	c3                   	ret
+
+00800b90 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b90:	55                   	push   %ebp
+  800b91:	89 e5                	mov    %esp,%ebp
+  800b93:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b99:	89 c2                	mov    %eax,%edx
+  800b9b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b9e:	eb 03                	jmp    800ba3 <memfind+0x13>
+  800ba0:	83 c0 01             	add    $0x1,%eax
+  800ba3:	39 d0                	cmp    %edx,%eax
+  800ba5:	73 04                	jae    800bab <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ba7:	38 08                	cmp    %cl,(%eax)
+  800ba9:	75 f5                	jne    800ba0 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800bab:	5d                   	pop    %ebp
+  800bac:	c3                   	ret
+
+00800bad <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bad:	55                   	push   %ebp
+  800bae:	89 e5                	mov    %esp,%ebp
+  800bb0:	57                   	push   %edi
+  800bb1:	56                   	push   %esi
+  800bb2:	53                   	push   %ebx
+  800bb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bb9:	eb 03                	jmp    800bbe <strtol+0x11>
+		s++;
+  800bbb:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800bbe:	0f b6 02             	movzbl (%edx),%eax
+  800bc1:	3c 20                	cmp    $0x20,%al
+  800bc3:	74 f6                	je     800bbb <strtol+0xe>
+  800bc5:	3c 09                	cmp    $0x9,%al
+  800bc7:	74 f2                	je     800bbb <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bc9:	3c 2b                	cmp    $0x2b,%al
+  800bcb:	74 2a                	je     800bf7 <strtol+0x4a>
+	int neg = 0;
+  800bcd:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800bd2:	3c 2d                	cmp    $0x2d,%al
+  800bd4:	74 2b                	je     800c01 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bd6:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bdc:	75 0f                	jne    800bed <strtol+0x40>
+  800bde:	80 3a 30             	cmpb   $0x30,(%edx)
+  800be1:	74 28                	je     800c0b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800be3:	85 db                	test   %ebx,%ebx
+  800be5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bea:	0f 44 d8             	cmove  %eax,%ebx
+  800bed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf2:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bf5:	eb 46                	jmp    800c3d <strtol+0x90>
+		s++;
+  800bf7:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bfa:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bff:	eb d5                	jmp    800bd6 <strtol+0x29>
+		s++, neg = 1;
+  800c01:	83 c2 01             	add    $0x1,%edx
+  800c04:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c09:	eb cb                	jmp    800bd6 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c0b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c0f:	74 0e                	je     800c1f <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800c11:	85 db                	test   %ebx,%ebx
+  800c13:	75 d8                	jne    800bed <strtol+0x40>
+		s++, base = 8;
+  800c15:	83 c2 01             	add    $0x1,%edx
+  800c18:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c1d:	eb ce                	jmp    800bed <strtol+0x40>
+		s += 2, base = 16;
+  800c1f:	83 c2 02             	add    $0x2,%edx
+  800c22:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c27:	eb c4                	jmp    800bed <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c29:	0f be c0             	movsbl %al,%eax
+  800c2c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c2f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c32:	7d 3a                	jge    800c6e <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c34:	83 c2 01             	add    $0x1,%edx
+  800c37:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c3b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c3d:	0f b6 02             	movzbl (%edx),%eax
+  800c40:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c43:	89 f3                	mov    %esi,%ebx
+  800c45:	80 fb 09             	cmp    $0x9,%bl
+  800c48:	76 df                	jbe    800c29 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c4a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c4d:	89 f3                	mov    %esi,%ebx
+  800c4f:	80 fb 19             	cmp    $0x19,%bl
+  800c52:	77 08                	ja     800c5c <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c54:	0f be c0             	movsbl %al,%eax
+  800c57:	83 e8 57             	sub    $0x57,%eax
+  800c5a:	eb d3                	jmp    800c2f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c5c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c5f:	89 f3                	mov    %esi,%ebx
+  800c61:	80 fb 19             	cmp    $0x19,%bl
+  800c64:	77 08                	ja     800c6e <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c66:	0f be c0             	movsbl %al,%eax
+  800c69:	83 e8 37             	sub    $0x37,%eax
+  800c6c:	eb c1                	jmp    800c2f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c6e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c72:	74 05                	je     800c79 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c74:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c77:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c79:	89 c8                	mov    %ecx,%eax
+  800c7b:	f7 d8                	neg    %eax
+  800c7d:	85 ff                	test   %edi,%edi
+  800c7f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c82:	89 c8                	mov    %ecx,%eax
+  800c84:	5b                   	pop    %ebx
+  800c85:	5e                   	pop    %esi
+  800c86:	5f                   	pop    %edi
+  800c87:	5d                   	pop    %ebp
+  800c88:	c3                   	ret
+
+00800c89 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800c89:	55                   	push   %ebp
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	57                   	push   %edi
+  800c8d:	56                   	push   %esi
+  800c8e:	53                   	push   %ebx
+  800c8f:	83 ec 0c             	sub    $0xc,%esp
+  800c92:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800c95:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c98:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800c9b:	85 ff                	test   %edi,%edi
+  800c9d:	74 16                	je     800cb5 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800c9f:	83 ec 04             	sub    $0x4,%esp
+  800ca2:	56                   	push   %esi
+  800ca3:	6a 00                	push   $0x0
+  800ca5:	53                   	push   %ebx
+  800ca6:	e8 02 ff ff ff       	call   800bad <strtol>
+  800cab:	89 07                	mov    %eax,(%edi)
+  800cad:	83 c4 10             	add    $0x10,%esp
+  800cb0:	eb 03                	jmp    800cb5 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800cb2:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800cb5:	0f b6 03             	movzbl (%ebx),%eax
+  800cb8:	3c 20                	cmp    $0x20,%al
+  800cba:	74 f6                	je     800cb2 <strisl+0x29>
+  800cbc:	3c 09                	cmp    $0x9,%al
+  800cbe:	74 f2                	je     800cb2 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cc0:	3c 2b                	cmp    $0x2b,%al
+  800cc2:	74 23                	je     800ce7 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800cc4:	3c 2d                	cmp    $0x2d,%al
+  800cc6:	0f 94 c0             	sete   %al
+  800cc9:	0f b6 c0             	movzbl %al,%eax
+  800ccc:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cce:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800cd4:	75 41                	jne    800d17 <strisl+0x8e>
+  800cd6:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800cd9:	74 11                	je     800cec <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800cdb:	85 f6                	test   %esi,%esi
+  800cdd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ce2:	0f 44 f0             	cmove  %eax,%esi
+  800ce5:	eb 30                	jmp    800d17 <strisl+0x8e>
+		s++;
+  800ce7:	83 c3 01             	add    $0x1,%ebx
+  800cea:	eb e2                	jmp    800cce <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cec:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800cf0:	74 0e                	je     800d00 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800cf2:	85 f6                	test   %esi,%esi
+  800cf4:	75 21                	jne    800d17 <strisl+0x8e>
+		s++, base = 8;
+  800cf6:	83 c3 01             	add    $0x1,%ebx
+  800cf9:	be 08 00 00 00       	mov    $0x8,%esi
+  800cfe:	eb 17                	jmp    800d17 <strisl+0x8e>
+		s += 2, base = 16;
+  800d00:	83 c3 02             	add    $0x2,%ebx
+  800d03:	be 10 00 00 00       	mov    $0x10,%esi
+  800d08:	eb 0d                	jmp    800d17 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d0a:	0f be c0             	movsbl %al,%eax
+  800d0d:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800d10:	39 f0                	cmp    %esi,%eax
+  800d12:	7d 38                	jge    800d4c <strisl+0xc3>
+			return 0;
+		s++;
+  800d14:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800d17:	0f b6 03             	movzbl (%ebx),%eax
+  800d1a:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800d1d:	80 fa 09             	cmp    $0x9,%dl
+  800d20:	76 e8                	jbe    800d0a <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800d22:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800d25:	80 fa 19             	cmp    $0x19,%dl
+  800d28:	77 08                	ja     800d32 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800d2a:	0f be c0             	movsbl %al,%eax
+  800d2d:	83 e8 57             	sub    $0x57,%eax
+  800d30:	eb de                	jmp    800d10 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d32:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800d35:	80 fa 19             	cmp    $0x19,%dl
+  800d38:	77 08                	ja     800d42 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800d3a:	0f be c0             	movsbl %al,%eax
+  800d3d:	83 e8 37             	sub    $0x37,%eax
+  800d40:	eb ce                	jmp    800d10 <strisl+0x87>
+		else if (!*s)
+  800d42:	84 c0                	test   %al,%al
+  800d44:	0f 94 c0             	sete   %al
+  800d47:	0f b6 c0             	movzbl %al,%eax
+  800d4a:	eb 05                	jmp    800d51 <strisl+0xc8>
+			return 0;
+  800d4c:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800d51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d54:	5b                   	pop    %ebx
+  800d55:	5e                   	pop    %esi
+  800d56:	5f                   	pop    %edi
+  800d57:	5d                   	pop    %ebp
+  800d58:	c3                   	ret
+
+00800d59 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800d59:	55                   	push   %ebp
+  800d5a:	89 e5                	mov    %esp,%ebp
+  800d5c:	83 ec 10             	sub    $0x10,%esp
+  800d5f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800d62:	89 c8                	mov    %ecx,%eax
+  800d64:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800d69:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800d6c:	eb 0b                	jmp    800d79 <touch_mem+0x20>
+		c = *(char *)page;
+  800d6e:	0f b6 10             	movzbl (%eax),%edx
+  800d71:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800d74:	05 00 10 00 00       	add    $0x1000,%eax
+  800d79:	39 c8                	cmp    %ecx,%eax
+  800d7b:	72 f1                	jb     800d6e <touch_mem+0x15>
+}
+  800d7d:	c9                   	leave
+  800d7e:	c3                   	ret
+
+00800d7f <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d7f:	55                   	push   %ebp
+  800d80:	89 e5                	mov    %esp,%ebp
+  800d82:	57                   	push   %edi
+  800d83:	56                   	push   %esi
+  800d84:	53                   	push   %ebx
+	touch_mem(s, len);
+  800d85:	ff 75 0c             	push   0xc(%ebp)
+  800d88:	ff 75 08             	push   0x8(%ebp)
+  800d8b:	e8 c9 ff ff ff       	call   800d59 <touch_mem>
+	asm volatile("int %1\n"
+  800d90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9b:	89 c3                	mov    %eax,%ebx
+  800d9d:	89 c7                	mov    %eax,%edi
+  800d9f:	89 c6                	mov    %eax,%esi
+  800da1:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800da3:	83 c4 08             	add    $0x8,%esp
+  800da6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da9:	5b                   	pop    %ebx
+  800daa:	5e                   	pop    %esi
+  800dab:	5f                   	pop    %edi
+  800dac:	5d                   	pop    %ebp
+  800dad:	c3                   	ret
+
+00800dae <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800dae:	55                   	push   %ebp
+  800daf:	89 e5                	mov    %esp,%ebp
+  800db1:	57                   	push   %edi
+  800db2:	56                   	push   %esi
+  800db3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800db4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dbe:	89 d1                	mov    %edx,%ecx
+  800dc0:	89 d3                	mov    %edx,%ebx
+  800dc2:	89 d7                	mov    %edx,%edi
+  800dc4:	89 d6                	mov    %edx,%esi
+  800dc6:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dc8:	5b                   	pop    %ebx
+  800dc9:	5e                   	pop    %esi
+  800dca:	5f                   	pop    %edi
+  800dcb:	5d                   	pop    %ebp
+  800dcc:	c3                   	ret
+
+00800dcd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800dcd:	55                   	push   %ebp
+  800dce:	89 e5                	mov    %esp,%ebp
+  800dd0:	57                   	push   %edi
+  800dd1:	56                   	push   %esi
+  800dd2:	53                   	push   %ebx
+  800dd3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ddb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dde:	b8 03 00 00 00       	mov    $0x3,%eax
+  800de3:	89 cb                	mov    %ecx,%ebx
+  800de5:	89 cf                	mov    %ecx,%edi
+  800de7:	89 ce                	mov    %ecx,%esi
+  800de9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800deb:	85 c0                	test   %eax,%eax
+  800ded:	7f 08                	jg     800df7 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800def:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df2:	5b                   	pop    %ebx
+  800df3:	5e                   	pop    %esi
+  800df4:	5f                   	pop    %edi
+  800df5:	5d                   	pop    %ebp
+  800df6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df7:	83 ec 0c             	sub    $0xc,%esp
+  800dfa:	50                   	push   %eax
+  800dfb:	6a 03                	push   $0x3
+  800dfd:	68 4b 59 80 00       	push   $0x80594b
+  800e02:	6a 23                	push   $0x23
+  800e04:	68 68 59 80 00       	push   $0x805968
+  800e09:	e8 89 f4 ff ff       	call   800297 <_panic>
+
+00800e0e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e0e:	55                   	push   %ebp
+  800e0f:	89 e5                	mov    %esp,%ebp
+  800e11:	57                   	push   %edi
+  800e12:	56                   	push   %esi
+  800e13:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e14:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e19:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e1e:	89 d1                	mov    %edx,%ecx
+  800e20:	89 d3                	mov    %edx,%ebx
+  800e22:	89 d7                	mov    %edx,%edi
+  800e24:	89 d6                	mov    %edx,%esi
+  800e26:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e28:	5b                   	pop    %ebx
+  800e29:	5e                   	pop    %esi
+  800e2a:	5f                   	pop    %edi
+  800e2b:	5d                   	pop    %ebp
+  800e2c:	c3                   	ret
+
+00800e2d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e2d:	55                   	push   %ebp
+  800e2e:	89 e5                	mov    %esp,%ebp
+  800e30:	57                   	push   %edi
+  800e31:	56                   	push   %esi
+  800e32:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e33:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e38:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e3d:	89 d1                	mov    %edx,%ecx
+  800e3f:	89 d3                	mov    %edx,%ebx
+  800e41:	89 d7                	mov    %edx,%edi
+  800e43:	89 d6                	mov    %edx,%esi
+  800e45:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e47:	5b                   	pop    %ebx
+  800e48:	5e                   	pop    %esi
+  800e49:	5f                   	pop    %edi
+  800e4a:	5d                   	pop    %ebp
+  800e4b:	c3                   	ret
+
+00800e4c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e4c:	55                   	push   %ebp
+  800e4d:	89 e5                	mov    %esp,%ebp
+  800e4f:	57                   	push   %edi
+  800e50:	56                   	push   %esi
+  800e51:	53                   	push   %ebx
+  800e52:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e55:	be 00 00 00 00       	mov    $0x0,%esi
+  800e5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e60:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e65:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e68:	89 f7                	mov    %esi,%edi
+  800e6a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e6c:	85 c0                	test   %eax,%eax
+  800e6e:	7f 08                	jg     800e78 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e73:	5b                   	pop    %ebx
+  800e74:	5e                   	pop    %esi
+  800e75:	5f                   	pop    %edi
+  800e76:	5d                   	pop    %ebp
+  800e77:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e78:	83 ec 0c             	sub    $0xc,%esp
+  800e7b:	50                   	push   %eax
+  800e7c:	6a 04                	push   $0x4
+  800e7e:	68 4b 59 80 00       	push   $0x80594b
+  800e83:	6a 23                	push   $0x23
+  800e85:	68 68 59 80 00       	push   $0x805968
+  800e8a:	e8 08 f4 ff ff       	call   800297 <_panic>
+
+00800e8f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e8f:	55                   	push   %ebp
+  800e90:	89 e5                	mov    %esp,%ebp
+  800e92:	57                   	push   %edi
+  800e93:	56                   	push   %esi
+  800e94:	53                   	push   %ebx
+  800e95:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ea3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ea9:	8b 75 18             	mov    0x18(%ebp),%esi
+  800eac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eae:	85 c0                	test   %eax,%eax
+  800eb0:	7f 08                	jg     800eba <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800eb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb5:	5b                   	pop    %ebx
+  800eb6:	5e                   	pop    %esi
+  800eb7:	5f                   	pop    %edi
+  800eb8:	5d                   	pop    %ebp
+  800eb9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eba:	83 ec 0c             	sub    $0xc,%esp
+  800ebd:	50                   	push   %eax
+  800ebe:	6a 05                	push   $0x5
+  800ec0:	68 4b 59 80 00       	push   $0x80594b
+  800ec5:	6a 23                	push   $0x23
+  800ec7:	68 68 59 80 00       	push   $0x805968
+  800ecc:	e8 c6 f3 ff ff       	call   800297 <_panic>
+
+00800ed1 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ed1:	55                   	push   %ebp
+  800ed2:	89 e5                	mov    %esp,%ebp
+  800ed4:	57                   	push   %edi
+  800ed5:	56                   	push   %esi
+  800ed6:	53                   	push   %ebx
+  800ed7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800edf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800eea:	89 df                	mov    %ebx,%edi
+  800eec:	89 de                	mov    %ebx,%esi
+  800eee:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef0:	85 c0                	test   %eax,%eax
+  800ef2:	7f 08                	jg     800efc <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ef4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef7:	5b                   	pop    %ebx
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5f                   	pop    %edi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800efc:	83 ec 0c             	sub    $0xc,%esp
+  800eff:	50                   	push   %eax
+  800f00:	6a 06                	push   $0x6
+  800f02:	68 4b 59 80 00       	push   $0x80594b
+  800f07:	6a 23                	push   $0x23
+  800f09:	68 68 59 80 00       	push   $0x805968
+  800f0e:	e8 84 f3 ff ff       	call   800297 <_panic>
+
+00800f13 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	57                   	push   %edi
+  800f17:	56                   	push   %esi
+  800f18:	53                   	push   %ebx
+  800f19:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f27:	b8 18 00 00 00       	mov    $0x18,%eax
+  800f2c:	89 df                	mov    %ebx,%edi
+  800f2e:	89 de                	mov    %ebx,%esi
+  800f30:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f32:	85 c0                	test   %eax,%eax
+  800f34:	7f 08                	jg     800f3e <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f39:	5b                   	pop    %ebx
+  800f3a:	5e                   	pop    %esi
+  800f3b:	5f                   	pop    %edi
+  800f3c:	5d                   	pop    %ebp
+  800f3d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f3e:	83 ec 0c             	sub    $0xc,%esp
+  800f41:	50                   	push   %eax
+  800f42:	6a 18                	push   $0x18
+  800f44:	68 4b 59 80 00       	push   $0x80594b
+  800f49:	6a 23                	push   $0x23
+  800f4b:	68 68 59 80 00       	push   $0x805968
+  800f50:	e8 42 f3 ff ff       	call   800297 <_panic>
+
+00800f55 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800f55:	55                   	push   %ebp
+  800f56:	89 e5                	mov    %esp,%ebp
+  800f58:	57                   	push   %edi
+  800f59:	56                   	push   %esi
+  800f5a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f5b:	be 00 00 00 00       	mov    $0x0,%esi
+  800f60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f66:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f6e:	89 f7                	mov    %esi,%edi
+  800f70:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800f72:	5b                   	pop    %ebx
+  800f73:	5e                   	pop    %esi
+  800f74:	5f                   	pop    %edi
+  800f75:	5d                   	pop    %ebp
+  800f76:	c3                   	ret
+
+00800f77 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800f77:	55                   	push   %ebp
+  800f78:	89 e5                	mov    %esp,%ebp
+  800f7a:	57                   	push   %edi
+  800f7b:	56                   	push   %esi
+  800f7c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f83:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f88:	be 00 00 00 00       	mov    $0x0,%esi
+  800f8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f90:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f93:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800f95:	5b                   	pop    %ebx
+  800f96:	5e                   	pop    %esi
+  800f97:	5f                   	pop    %edi
+  800f98:	5d                   	pop    %ebp
+  800f99:	c3                   	ret
+
+00800f9a <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800f9a:	55                   	push   %ebp
+  800f9b:	89 e5                	mov    %esp,%ebp
+  800f9d:	57                   	push   %edi
+  800f9e:	56                   	push   %esi
+  800f9f:	53                   	push   %ebx
+  800fa0:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800fa3:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800fa6:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800fac:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800faf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb5:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fbd:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fc0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc2:	85 c0                	test   %eax,%eax
+  800fc4:	7f 08                	jg     800fce <sys_page_map_range+0x34>
+}
+  800fc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc9:	5b                   	pop    %ebx
+  800fca:	5e                   	pop    %esi
+  800fcb:	5f                   	pop    %edi
+  800fcc:	5d                   	pop    %ebp
+  800fcd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fce:	83 ec 0c             	sub    $0xc,%esp
+  800fd1:	50                   	push   %eax
+  800fd2:	6a 10                	push   $0x10
+  800fd4:	68 4b 59 80 00       	push   $0x80594b
+  800fd9:	6a 23                	push   $0x23
+  800fdb:	68 68 59 80 00       	push   $0x805968
+  800fe0:	e8 b2 f2 ff ff       	call   800297 <_panic>
+
+00800fe5 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800fe5:	55                   	push   %ebp
+  800fe6:	89 e5                	mov    %esp,%ebp
+  800fe8:	57                   	push   %edi
+  800fe9:	56                   	push   %esi
+  800fea:	53                   	push   %ebx
+  800feb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fee:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff9:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ffe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801001:	89 f7                	mov    %esi,%edi
+  801003:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801005:	85 c0                	test   %eax,%eax
+  801007:	7f 08                	jg     801011 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  801009:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100c:	5b                   	pop    %ebx
+  80100d:	5e                   	pop    %esi
+  80100e:	5f                   	pop    %edi
+  80100f:	5d                   	pop    %ebp
+  801010:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801011:	83 ec 0c             	sub    $0xc,%esp
+  801014:	50                   	push   %eax
+  801015:	6a 11                	push   $0x11
+  801017:	68 4b 59 80 00       	push   $0x80594b
+  80101c:	6a 23                	push   $0x23
+  80101e:	68 68 59 80 00       	push   $0x805968
+  801023:	e8 6f f2 ff ff       	call   800297 <_panic>
+
+00801028 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  801028:	55                   	push   %ebp
+  801029:	89 e5                	mov    %esp,%ebp
+  80102b:	57                   	push   %edi
+  80102c:	56                   	push   %esi
+  80102d:	53                   	push   %ebx
+  80102e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801031:	be 00 00 00 00       	mov    $0x0,%esi
+  801036:	8b 55 08             	mov    0x8(%ebp),%edx
+  801039:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801041:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801044:	89 f7                	mov    %esi,%edi
+  801046:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801048:	85 c0                	test   %eax,%eax
+  80104a:	7f 08                	jg     801054 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  80104c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104f:	5b                   	pop    %ebx
+  801050:	5e                   	pop    %esi
+  801051:	5f                   	pop    %edi
+  801052:	5d                   	pop    %ebp
+  801053:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801054:	83 ec 0c             	sub    $0xc,%esp
+  801057:	50                   	push   %eax
+  801058:	6a 1b                	push   $0x1b
+  80105a:	68 4b 59 80 00       	push   $0x80594b
+  80105f:	6a 23                	push   $0x23
+  801061:	68 68 59 80 00       	push   $0x805968
+  801066:	e8 2c f2 ff ff       	call   800297 <_panic>
+
+0080106b <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  80106b:	55                   	push   %ebp
+  80106c:	89 e5                	mov    %esp,%ebp
+  80106e:	57                   	push   %edi
+  80106f:	56                   	push   %esi
+  801070:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801071:	ba 00 00 00 00       	mov    $0x0,%edx
+  801076:	b8 12 00 00 00       	mov    $0x12,%eax
+  80107b:	89 d1                	mov    %edx,%ecx
+  80107d:	89 d3                	mov    %edx,%ebx
+  80107f:	89 d7                	mov    %edx,%edi
+  801081:	89 d6                	mov    %edx,%esi
+  801083:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801085:	5b                   	pop    %ebx
+  801086:	5e                   	pop    %esi
+  801087:	5f                   	pop    %edi
+  801088:	5d                   	pop    %ebp
+  801089:	c3                   	ret
+
+0080108a <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80108a:	55                   	push   %ebp
+  80108b:	89 e5                	mov    %esp,%ebp
+  80108d:	57                   	push   %edi
+  80108e:	56                   	push   %esi
+  80108f:	53                   	push   %ebx
+  801090:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801093:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801098:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109e:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010a3:	89 df                	mov    %ebx,%edi
+  8010a5:	89 de                	mov    %ebx,%esi
+  8010a7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010a9:	85 c0                	test   %eax,%eax
+  8010ab:	7f 08                	jg     8010b5 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8010ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b0:	5b                   	pop    %ebx
+  8010b1:	5e                   	pop    %esi
+  8010b2:	5f                   	pop    %edi
+  8010b3:	5d                   	pop    %ebp
+  8010b4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010b5:	83 ec 0c             	sub    $0xc,%esp
+  8010b8:	50                   	push   %eax
+  8010b9:	6a 08                	push   $0x8
+  8010bb:	68 4b 59 80 00       	push   $0x80594b
+  8010c0:	6a 23                	push   $0x23
+  8010c2:	68 68 59 80 00       	push   $0x805968
+  8010c7:	e8 cb f1 ff ff       	call   800297 <_panic>
+
+008010cc <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010cc:	55                   	push   %ebp
+  8010cd:	89 e5                	mov    %esp,%ebp
+  8010cf:	57                   	push   %edi
+  8010d0:	56                   	push   %esi
+  8010d1:	53                   	push   %ebx
+  8010d2:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  8010d5:	6a 44                	push   $0x44
+  8010d7:	ff 75 0c             	push   0xc(%ebp)
+  8010da:	e8 7a fc ff ff       	call   800d59 <touch_mem>
+	asm volatile("int %1\n"
+  8010df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ef:	89 df                	mov    %ebx,%edi
+  8010f1:	89 de                	mov    %ebx,%esi
+  8010f3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010f5:	83 c4 08             	add    $0x8,%esp
+  8010f8:	85 c0                	test   %eax,%eax
+  8010fa:	7f 08                	jg     801104 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ff:	5b                   	pop    %ebx
+  801100:	5e                   	pop    %esi
+  801101:	5f                   	pop    %edi
+  801102:	5d                   	pop    %ebp
+  801103:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801104:	83 ec 0c             	sub    $0xc,%esp
+  801107:	50                   	push   %eax
+  801108:	6a 09                	push   $0x9
+  80110a:	68 4b 59 80 00       	push   $0x80594b
+  80110f:	6a 23                	push   $0x23
+  801111:	68 68 59 80 00       	push   $0x805968
+  801116:	e8 7c f1 ff ff       	call   800297 <_panic>
+
+0080111b <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  80111b:	55                   	push   %ebp
+  80111c:	89 e5                	mov    %esp,%ebp
+  80111e:	57                   	push   %edi
+  80111f:	56                   	push   %esi
+  801120:	53                   	push   %ebx
+  801121:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801124:	be 00 00 00 00       	mov    $0x0,%esi
+  801129:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801134:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801137:	89 f7                	mov    %esi,%edi
+  801139:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80113b:	85 c0                	test   %eax,%eax
+  80113d:	7f 08                	jg     801147 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  80113f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801142:	5b                   	pop    %ebx
+  801143:	5e                   	pop    %esi
+  801144:	5f                   	pop    %edi
+  801145:	5d                   	pop    %ebp
+  801146:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801147:	83 ec 0c             	sub    $0xc,%esp
+  80114a:	50                   	push   %eax
+  80114b:	6a 1a                	push   $0x1a
+  80114d:	68 4b 59 80 00       	push   $0x80594b
+  801152:	6a 23                	push   $0x23
+  801154:	68 68 59 80 00       	push   $0x805968
+  801159:	e8 39 f1 ff ff       	call   800297 <_panic>
+
+0080115e <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  80115e:	55                   	push   %ebp
+  80115f:	89 e5                	mov    %esp,%ebp
+  801161:	57                   	push   %edi
+  801162:	56                   	push   %esi
+  801163:	53                   	push   %ebx
+  801164:	83 ec 0c             	sub    $0xc,%esp
+  801167:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  80116a:	89 d8                	mov    %ebx,%eax
+  80116c:	c1 e0 05             	shl    $0x5,%eax
+  80116f:	50                   	push   %eax
+  801170:	ff 75 0c             	push   0xc(%ebp)
+  801173:	e8 e1 fb ff ff       	call   800d59 <touch_mem>
+	asm volatile("int %1\n"
+  801178:	be 00 00 00 00       	mov    $0x0,%esi
+  80117d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801180:	b8 13 00 00 00       	mov    $0x13,%eax
+  801185:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801188:	89 f7                	mov    %esi,%edi
+  80118a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80118c:	83 c4 08             	add    $0x8,%esp
+  80118f:	85 c0                	test   %eax,%eax
+  801191:	7f 08                	jg     80119b <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  801193:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801196:	5b                   	pop    %ebx
+  801197:	5e                   	pop    %esi
+  801198:	5f                   	pop    %edi
+  801199:	5d                   	pop    %ebp
+  80119a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80119b:	83 ec 0c             	sub    $0xc,%esp
+  80119e:	50                   	push   %eax
+  80119f:	6a 13                	push   $0x13
+  8011a1:	68 4b 59 80 00       	push   $0x80594b
+  8011a6:	6a 23                	push   $0x23
+  8011a8:	68 68 59 80 00       	push   $0x805968
+  8011ad:	e8 e5 f0 ff ff       	call   800297 <_panic>
+
+008011b2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8011b2:	55                   	push   %ebp
+  8011b3:	89 e5                	mov    %esp,%ebp
+  8011b5:	57                   	push   %edi
+  8011b6:	56                   	push   %esi
+  8011b7:	53                   	push   %ebx
+  8011b8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011cb:	89 df                	mov    %ebx,%edi
+  8011cd:	89 de                	mov    %ebx,%esi
+  8011cf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011d1:	85 c0                	test   %eax,%eax
+  8011d3:	7f 08                	jg     8011dd <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8011d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d8:	5b                   	pop    %ebx
+  8011d9:	5e                   	pop    %esi
+  8011da:	5f                   	pop    %edi
+  8011db:	5d                   	pop    %ebp
+  8011dc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011dd:	83 ec 0c             	sub    $0xc,%esp
+  8011e0:	50                   	push   %eax
+  8011e1:	6a 0a                	push   $0xa
+  8011e3:	68 4b 59 80 00       	push   $0x80594b
+  8011e8:	6a 23                	push   $0x23
+  8011ea:	68 68 59 80 00       	push   $0x805968
+  8011ef:	e8 a3 f0 ff ff       	call   800297 <_panic>
+
+008011f4 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011f4:	55                   	push   %ebp
+  8011f5:	89 e5                	mov    %esp,%ebp
+  8011f7:	57                   	push   %edi
+  8011f8:	56                   	push   %esi
+  8011f9:	53                   	push   %ebx
+  8011fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  8011fd:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801203:	76 1d                	jbe    801222 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  801205:	8b 55 08             	mov    0x8(%ebp),%edx
+  801208:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801210:	be 01 00 00 00       	mov    $0x1,%esi
+  801215:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801218:	cd 30                	int    $0x30
+}
+  80121a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80121d:	5b                   	pop    %ebx
+  80121e:	5e                   	pop    %esi
+  80121f:	5f                   	pop    %edi
+  801220:	5d                   	pop    %ebp
+  801221:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801222:	68 00 10 00 00       	push   $0x1000
+  801227:	53                   	push   %ebx
+  801228:	e8 2c fb ff ff       	call   800d59 <touch_mem>
+  80122d:	83 c4 08             	add    $0x8,%esp
+  801230:	eb d3                	jmp    801205 <sys_ipc_send+0x11>
+
+00801232 <sys_ipc_send_pages>:
+{
+  801232:	55                   	push   %ebp
+  801233:	89 e5                	mov    %esp,%ebp
+  801235:	57                   	push   %edi
+  801236:	56                   	push   %esi
+  801237:	53                   	push   %ebx
+  801238:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80123b:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  80123e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801244:	76 18                	jbe    80125e <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  801246:	8b 55 08             	mov    0x8(%ebp),%edx
+  801249:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801251:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801254:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  801256:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801259:	5b                   	pop    %ebx
+  80125a:	5e                   	pop    %esi
+  80125b:	5f                   	pop    %edi
+  80125c:	5d                   	pop    %ebp
+  80125d:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80125e:	89 f0                	mov    %esi,%eax
+  801260:	c1 e0 0c             	shl    $0xc,%eax
+  801263:	50                   	push   %eax
+  801264:	53                   	push   %ebx
+  801265:	e8 ef fa ff ff       	call   800d59 <touch_mem>
+  80126a:	83 c4 08             	add    $0x8,%esp
+  80126d:	eb d7                	jmp    801246 <sys_ipc_send_pages+0x14>
+
+0080126f <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  80126f:	55                   	push   %ebp
+  801270:	89 e5                	mov    %esp,%ebp
+  801272:	57                   	push   %edi
+  801273:	56                   	push   %esi
+  801274:	53                   	push   %ebx
+  801275:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801278:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801280:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801283:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801288:	89 df                	mov    %ebx,%edi
+  80128a:	89 de                	mov    %ebx,%esi
+  80128c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80128e:	85 c0                	test   %eax,%eax
+  801290:	7f 08                	jg     80129a <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801292:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801295:	5b                   	pop    %ebx
+  801296:	5e                   	pop    %esi
+  801297:	5f                   	pop    %edi
+  801298:	5d                   	pop    %ebp
+  801299:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80129a:	83 ec 0c             	sub    $0xc,%esp
+  80129d:	50                   	push   %eax
+  80129e:	6a 0d                	push   $0xd
+  8012a0:	68 4b 59 80 00       	push   $0x80594b
+  8012a5:	6a 23                	push   $0x23
+  8012a7:	68 68 59 80 00       	push   $0x805968
+  8012ac:	e8 e6 ef ff ff       	call   800297 <_panic>
+
+008012b1 <sys_ipc_recv>:
+{
+  8012b1:	55                   	push   %ebp
+  8012b2:	89 e5                	mov    %esp,%ebp
+  8012b4:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8012b7:	6a 01                	push   $0x1
+  8012b9:	ff 75 08             	push   0x8(%ebp)
+  8012bc:	e8 ae ff ff ff       	call   80126f <sys_ipc_recv_pages>
+}
+  8012c1:	c9                   	leave
+  8012c2:	c3                   	ret
+
+008012c3 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8012c3:	55                   	push   %ebp
+  8012c4:	89 e5                	mov    %esp,%ebp
+  8012c6:	57                   	push   %edi
+  8012c7:	56                   	push   %esi
+  8012c8:	53                   	push   %ebx
+  8012c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012cc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012cf:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  8012d2:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8012d8:	77 04                	ja     8012de <sys_ipc_call+0x1b>
+  8012da:	85 f6                	test   %esi,%esi
+  8012dc:	75 15                	jne    8012f3 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8012de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e4:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012e9:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8012eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ee:	5b                   	pop    %ebx
+  8012ef:	5e                   	pop    %esi
+  8012f0:	5f                   	pop    %edi
+  8012f1:	5d                   	pop    %ebp
+  8012f2:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8012f3:	89 f8                	mov    %edi,%eax
+  8012f5:	c1 e0 0c             	shl    $0xc,%eax
+  8012f8:	50                   	push   %eax
+  8012f9:	53                   	push   %ebx
+  8012fa:	e8 5a fa ff ff       	call   800d59 <touch_mem>
+  8012ff:	83 c4 08             	add    $0x8,%esp
+  801302:	eb da                	jmp    8012de <sys_ipc_call+0x1b>
+
+00801304 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801304:	55                   	push   %ebp
+  801305:	89 e5                	mov    %esp,%ebp
+  801307:	57                   	push   %edi
+  801308:	56                   	push   %esi
+  801309:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80130a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801310:	b8 15 00 00 00       	mov    $0x15,%eax
+  801315:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801318:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80131b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80131e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801320:	5b                   	pop    %ebx
+  801321:	5e                   	pop    %esi
+  801322:	5f                   	pop    %edi
+  801323:	5d                   	pop    %ebp
+  801324:	c3                   	ret
+
+00801325 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  801325:	55                   	push   %ebp
+  801326:	89 e5                	mov    %esp,%ebp
+  801328:	57                   	push   %edi
+  801329:	56                   	push   %esi
+  80132a:	53                   	push   %ebx
+  80132b:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  80132e:	6a 04                	push   $0x4
+  801330:	ff 75 08             	push   0x8(%ebp)
+  801333:	e8 21 fa ff ff       	call   800d59 <touch_mem>
+	asm volatile("int %1\n"
+  801338:	be 00 00 00 00       	mov    $0x0,%esi
+  80133d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801340:	b8 16 00 00 00       	mov    $0x16,%eax
+  801345:	8b 55 08             	mov    0x8(%ebp),%edx
+  801348:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80134b:	89 f7                	mov    %esi,%edi
+  80134d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80134f:	83 c4 08             	add    $0x8,%esp
+  801352:	85 c0                	test   %eax,%eax
+  801354:	7f 08                	jg     80135e <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  801356:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801359:	5b                   	pop    %ebx
+  80135a:	5e                   	pop    %esi
+  80135b:	5f                   	pop    %edi
+  80135c:	5d                   	pop    %ebp
+  80135d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80135e:	83 ec 0c             	sub    $0xc,%esp
+  801361:	50                   	push   %eax
+  801362:	6a 16                	push   $0x16
+  801364:	68 4b 59 80 00       	push   $0x80594b
+  801369:	6a 23                	push   $0x23
+  80136b:	68 68 59 80 00       	push   $0x805968
+  801370:	e8 22 ef ff ff       	call   800297 <_panic>
+
+00801375 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801375:	55                   	push   %ebp
+  801376:	89 e5                	mov    %esp,%ebp
+  801378:	57                   	push   %edi
+  801379:	56                   	push   %esi
+  80137a:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  80137b:	6a 04                	push   $0x4
+  80137d:	ff 75 08             	push   0x8(%ebp)
+  801380:	e8 d4 f9 ff ff       	call   800d59 <touch_mem>
+	asm volatile("int %1\n"
+  801385:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80138d:	b8 17 00 00 00       	mov    $0x17,%eax
+  801392:	8b 55 08             	mov    0x8(%ebp),%edx
+  801395:	89 df                	mov    %ebx,%edi
+  801397:	89 de                	mov    %ebx,%esi
+  801399:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80139b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80139e:	5b                   	pop    %ebx
+  80139f:	5e                   	pop    %esi
+  8013a0:	5f                   	pop    %edi
+  8013a1:	5d                   	pop    %ebp
+  8013a2:	c3                   	ret
+
+008013a3 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8013a3:	55                   	push   %ebp
+  8013a4:	89 e5                	mov    %esp,%ebp
+  8013a6:	57                   	push   %edi
+  8013a7:	56                   	push   %esi
+  8013a8:	53                   	push   %ebx
+  8013a9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013b9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013be:	89 df                	mov    %ebx,%edi
+  8013c0:	89 de                	mov    %ebx,%esi
+  8013c2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013c4:	85 c0                	test   %eax,%eax
+  8013c6:	7f 08                	jg     8013d0 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  8013c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013cb:	5b                   	pop    %ebx
+  8013cc:	5e                   	pop    %esi
+  8013cd:	5f                   	pop    %edi
+  8013ce:	5d                   	pop    %ebp
+  8013cf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013d0:	83 ec 0c             	sub    $0xc,%esp
+  8013d3:	50                   	push   %eax
+  8013d4:	6a 0e                	push   $0xe
+  8013d6:	68 4b 59 80 00       	push   $0x80594b
+  8013db:	6a 23                	push   $0x23
+  8013dd:	68 68 59 80 00       	push   $0x805968
+  8013e2:	e8 b0 ee ff ff       	call   800297 <_panic>
+
+008013e7 <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  8013e7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013ee:	f6 c6 06             	test   $0x6,%dh
+  8013f1:	75 37                	jne    80142a <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  8013f3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013fa:	f6 c2 02             	test   $0x2,%dl
+  8013fd:	75 19                	jne    801418 <dupperm+0x31>
+  8013ff:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801406:	f6 c6 08             	test   $0x8,%dh
+  801409:	75 0d                	jne    801418 <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  80140b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801412:	25 07 0e 00 00       	and    $0xe07,%eax
+  801417:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801418:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80141f:	25 00 06 00 00       	and    $0x600,%eax
+  801424:	0d 05 08 00 00       	or     $0x805,%eax
+  801429:	c3                   	ret
+		return 0;
+  80142a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80142f:	c3                   	ret
+
+00801430 <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  801430:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  801432:	c1 e0 0c             	shl    $0xc,%eax
+  801435:	c1 e8 16             	shr    $0x16,%eax
+  801438:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  80143f:	f6 c1 01             	test   $0x1,%cl
+  801442:	74 2c                	je     801470 <dupable+0x40>
+  801444:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  80144b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801450:	f6 c1 04             	test   $0x4,%cl
+  801453:	74 20                	je     801475 <dupable+0x45>
+  801455:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80145c:	f6 c1 01             	test   $0x1,%cl
+  80145f:	74 14                	je     801475 <dupable+0x45>
+  801461:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801468:	c1 e8 02             	shr    $0x2,%eax
+  80146b:	83 e0 01             	and    $0x1,%eax
+  80146e:	eb 05                	jmp    801475 <dupable+0x45>
+  801470:	b8 00 00 00 00       	mov    $0x0,%eax
+  801475:	83 e0 01             	and    $0x1,%eax
+}
+  801478:	c3                   	ret
+
+00801479 <pgfault>:
+{
+  801479:	55                   	push   %ebp
+  80147a:	89 e5                	mov    %esp,%ebp
+  80147c:	56                   	push   %esi
+  80147d:	53                   	push   %ebx
+  80147e:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801481:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  801483:	89 ca                	mov    %ecx,%edx
+  801485:	c1 ea 0c             	shr    $0xc,%edx
+  801488:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  80148f:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801493:	0f 84 8e 00 00 00    	je     801527 <pgfault+0xae>
+		return 0;
+  801499:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  80149e:	f6 c6 08             	test   $0x8,%dh
+  8014a1:	0f 84 85 00 00 00    	je     80152c <pgfault+0xb3>
+	perm |= PTE_W;
+  8014a7:	81 e2 07 06 00 00    	and    $0x607,%edx
+  8014ad:	89 d3                	mov    %edx,%ebx
+  8014af:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8014b2:	89 ce                	mov    %ecx,%esi
+  8014b4:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  8014ba:	6a 01                	push   $0x1
+  8014bc:	53                   	push   %ebx
+  8014bd:	68 00 f0 7f 00       	push   $0x7ff000
+  8014c2:	6a 00                	push   $0x0
+  8014c4:	e8 a5 27 00 00       	call   803c6e <page_alloc>
+  8014c9:	83 c4 10             	add    $0x10,%esp
+  8014cc:	85 c0                	test   %eax,%eax
+  8014ce:	78 33                	js     801503 <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  8014d0:	83 ec 04             	sub    $0x4,%esp
+  8014d3:	68 00 10 00 00       	push   $0x1000
+  8014d8:	56                   	push   %esi
+  8014d9:	68 00 f0 7f 00       	push   $0x7ff000
+  8014de:	e8 fc f5 ff ff       	call   800adf <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  8014e3:	89 1c 24             	mov    %ebx,(%esp)
+  8014e6:	56                   	push   %esi
+  8014e7:	6a 00                	push   $0x0
+  8014e9:	68 00 f0 7f 00       	push   $0x7ff000
+  8014ee:	6a 00                	push   $0x0
+  8014f0:	e8 da 2d 00 00       	call   8042cf <page_map>
+  8014f5:	83 c4 20             	add    $0x20,%esp
+  8014f8:	85 c0                	test   %eax,%eax
+  8014fa:	78 19                	js     801515 <pgfault+0x9c>
+	return 1;
+  8014fc:	b8 01 00 00 00       	mov    $0x1,%eax
+  801501:	eb 29                	jmp    80152c <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  801503:	50                   	push   %eax
+  801504:	68 78 59 80 00       	push   $0x805978
+  801509:	6a 2e                	push   $0x2e
+  80150b:	68 cb 59 80 00       	push   $0x8059cb
+  801510:	e8 82 ed ff ff       	call   800297 <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  801515:	50                   	push   %eax
+  801516:	68 a4 59 80 00       	push   $0x8059a4
+  80151b:	6a 32                	push   $0x32
+  80151d:	68 cb 59 80 00       	push   $0x8059cb
+  801522:	e8 70 ed ff ff       	call   800297 <_panic>
+		return 0;
+  801527:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80152c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80152f:	5b                   	pop    %ebx
+  801530:	5e                   	pop    %esi
+  801531:	5d                   	pop    %ebp
+  801532:	c3                   	ret
+
+00801533 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  801533:	55                   	push   %ebp
+  801534:	89 e5                	mov    %esp,%ebp
+  801536:	57                   	push   %edi
+  801537:	56                   	push   %esi
+  801538:	53                   	push   %ebx
+  801539:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  80153c:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  801543:	74 5d                	je     8015a2 <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  801545:	83 ec 0c             	sub    $0xc,%esp
+  801548:	68 79 14 80 00       	push   $0x801479
+  80154d:	e8 de 39 00 00       	call   804f30 <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  801552:	e8 14 fb ff ff       	call   80106b <sys_fork>
+  801557:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80155a:	83 c4 10             	add    $0x10,%esp
+  80155d:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  801560:	74 47                	je     8015a9 <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  801562:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801566:	0f 84 c5 03 00 00    	je     801931 <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  80156c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801570:	78 25                	js     801597 <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  801572:	e8 6f 20 00 00       	call   8035e6 <page_share_paged_out>
+  801577:	85 c0                	test   %eax,%eax
+  801579:	0f 88 d8 03 00 00    	js     801957 <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  80157f:	83 ec 08             	sub    $0x8,%esp
+  801582:	6a 02                	push   $0x2
+  801584:	ff 75 e4             	push   -0x1c(%ebp)
+  801587:	e8 fe fa ff ff       	call   80108a <sys_env_set_status>
+  80158c:	83 c4 10             	add    $0x10,%esp
+  80158f:	85 c0                	test   %eax,%eax
+  801591:	0f 88 d5 03 00 00    	js     80196c <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  801597:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80159a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80159d:	5b                   	pop    %ebx
+  80159e:	5e                   	pop    %esi
+  80159f:	5f                   	pop    %edi
+  8015a0:	5d                   	pop    %ebp
+  8015a1:	c3                   	ret
+		init_map_dir();
+  8015a2:	e8 47 23 00 00       	call   8038ee <init_map_dir>
+  8015a7:	eb 9c                	jmp    801545 <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8015a9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8015ae:	cd 30                	int    $0x30
+  8015b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  8015b3:	85 c0                	test   %eax,%eax
+  8015b5:	78 10                	js     8015c7 <fork+0x94>
+	if (envid == 0)
+  8015b7:	0f 84 74 03 00 00    	je     801931 <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  8015bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8015c5:	eb 30                	jmp    8015f7 <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  8015c7:	50                   	push   %eax
+  8015c8:	68 d6 59 80 00       	push   $0x8059d6
+  8015cd:	68 cd 00 00 00       	push   $0xcd
+  8015d2:	68 cb 59 80 00       	push   $0x8059cb
+  8015d7:	e8 bb ec ff ff       	call   800297 <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  8015dc:	89 f2                	mov    %esi,%edx
+  8015de:	c1 fa 1f             	sar    $0x1f,%edx
+  8015e1:	c1 ea 16             	shr    $0x16,%edx
+  8015e4:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8015e7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8015ec:	29 d0                	sub    %edx,%eax
+  8015ee:	ba 00 04 00 00       	mov    $0x400,%edx
+  8015f3:	29 c2                	sub    %eax,%edx
+  8015f5:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  8015f7:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8015fa:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801600:	0f 87 ff 02 00 00    	ja     801905 <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  801606:	89 f3                	mov    %esi,%ebx
+  801608:	c1 e3 0c             	shl    $0xc,%ebx
+  80160b:	89 d8                	mov    %ebx,%eax
+  80160d:	c1 e8 16             	shr    $0x16,%eax
+  801610:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801617:	f6 c2 01             	test   $0x1,%dl
+  80161a:	74 c0                	je     8015dc <fork+0xa9>
+  80161c:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801623:	f6 c2 04             	test   $0x4,%dl
+  801626:	74 b4                	je     8015dc <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  801628:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80162f:	a8 80                	test   $0x80,%al
+  801631:	75 24                	jne    801657 <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  801633:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  80163a:	25 81 00 00 00       	and    $0x81,%eax
+  80163f:	3d 80 00 00 00       	cmp    $0x80,%eax
+  801644:	74 21                	je     801667 <fork+0x134>
+		if (!dupable(pn)) {
+  801646:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801649:	e8 e2 fd ff ff       	call   801430 <dupable>
+  80164e:	84 c0                	test   %al,%al
+  801650:	75 1a                	jne    80166c <fork+0x139>
+			++pn;
+  801652:	83 c6 01             	add    $0x1,%esi
+			continue;
+  801655:	eb a0                	jmp    8015f7 <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  801657:	83 ec 08             	sub    $0x8,%esp
+  80165a:	53                   	push   %ebx
+  80165b:	6a 00                	push   $0x0
+  80165d:	e8 b1 f8 ff ff       	call   800f13 <sys_page_split>
+  801662:	83 c4 10             	add    $0x10,%esp
+  801665:	eb cc                	jmp    801633 <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  801667:	0f b6 03             	movzbl (%ebx),%eax
+  80166a:	eb da                	jmp    801646 <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  80166c:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80166f:	89 f8                	mov    %edi,%eax
+  801671:	e8 71 fd ff ff       	call   8013e7 <dupperm>
+  801676:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801679:	85 c0                	test   %eax,%eax
+  80167b:	74 16                	je     801693 <fork+0x160>
+  80167d:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  801682:	29 f8                	sub    %edi,%eax
+  801684:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801687:	bf 01 00 00 00       	mov    $0x1,%edi
+  80168c:	89 c6                	mov    %eax,%esi
+  80168e:	e9 c4 01 00 00       	jmp    801857 <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  801693:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801696:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80169d:	f6 c4 04             	test   $0x4,%ah
+  8016a0:	0f 85 89 00 00 00    	jne    80172f <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  8016a6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016a9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016b0:	f6 c4 02             	test   $0x2,%ah
+  8016b3:	0f 85 b1 00 00 00    	jne    80176a <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  8016b9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8016bc:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8016c3:	a8 02                	test   $0x2,%al
+  8016c5:	75 10                	jne    8016d7 <fork+0x1a4>
+  8016c7:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8016ce:	f6 c4 08             	test   $0x8,%ah
+  8016d1:	0f 84 3e 01 00 00    	je     801815 <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  8016d7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8016da:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8016e1:	25 00 06 00 00       	and    $0x600,%eax
+  8016e6:	0d 05 08 00 00       	or     $0x805,%eax
+  8016eb:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  8016ed:	c1 e1 0c             	shl    $0xc,%ecx
+  8016f0:	89 cb                	mov    %ecx,%ebx
+  8016f2:	83 ec 0c             	sub    $0xc,%esp
+  8016f5:	50                   	push   %eax
+  8016f6:	51                   	push   %ecx
+  8016f7:	ff 75 e4             	push   -0x1c(%ebp)
+  8016fa:	51                   	push   %ecx
+  8016fb:	6a 00                	push   $0x0
+  8016fd:	e8 cd 2b 00 00       	call   8042cf <page_map>
+  801702:	83 c4 20             	add    $0x20,%esp
+  801705:	85 c0                	test   %eax,%eax
+  801707:	0f 88 e4 00 00 00    	js     8017f1 <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  80170d:	83 ec 0c             	sub    $0xc,%esp
+  801710:	57                   	push   %edi
+  801711:	53                   	push   %ebx
+  801712:	6a 00                	push   $0x0
+  801714:	53                   	push   %ebx
+  801715:	6a 00                	push   $0x0
+  801717:	e8 b3 2b 00 00       	call   8042cf <page_map>
+  80171c:	83 c4 20             	add    $0x20,%esp
+  80171f:	85 c0                	test   %eax,%eax
+  801721:	0f 88 dc 00 00 00    	js     801803 <fork+0x2d0>
+			++pn;
+  801727:	83 c6 01             	add    $0x1,%esi
+			continue;
+  80172a:	e9 c8 fe ff ff       	jmp    8015f7 <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  80172f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801732:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801739:	c1 e1 0c             	shl    $0xc,%ecx
+  80173c:	83 ec 0c             	sub    $0xc,%esp
+  80173f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801744:	50                   	push   %eax
+  801745:	51                   	push   %ecx
+  801746:	ff 75 e4             	push   -0x1c(%ebp)
+  801749:	51                   	push   %ecx
+  80174a:	6a 00                	push   $0x0
+  80174c:	e8 7e 2b 00 00       	call   8042cf <page_map>
+  801751:	83 c4 20             	add    $0x20,%esp
+  801754:	85 c0                	test   %eax,%eax
+  801756:	79 cf                	jns    801727 <fork+0x1f4>
+			panic("page_map %d", r);
+  801758:	50                   	push   %eax
+  801759:	68 e6 59 80 00       	push   $0x8059e6
+  80175e:	6a 4d                	push   $0x4d
+  801760:	68 cb 59 80 00       	push   $0x8059cb
+  801765:	e8 2d eb ff ff       	call   800297 <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  80176a:	83 ec 0c             	sub    $0xc,%esp
+  80176d:	68 00 10 00 00       	push   $0x1000
+  801772:	e8 4a 31 00 00       	call   8048c1 <malloc>
+  801777:	89 c7                	mov    %eax,%edi
+  801779:	83 c4 10             	add    $0x10,%esp
+  80177c:	85 c0                	test   %eax,%eax
+  80177e:	74 4b                	je     8017cb <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  801780:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801783:	c1 e3 0c             	shl    $0xc,%ebx
+  801786:	83 ec 04             	sub    $0x4,%esp
+  801789:	68 00 10 00 00       	push   $0x1000
+  80178e:	53                   	push   %ebx
+  80178f:	50                   	push   %eax
+  801790:	e8 ac f3 ff ff       	call   800b41 <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  801795:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801798:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80179f:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017a4:	89 04 24             	mov    %eax,(%esp)
+  8017a7:	53                   	push   %ebx
+  8017a8:	ff 75 e4             	push   -0x1c(%ebp)
+  8017ab:	57                   	push   %edi
+  8017ac:	6a 00                	push   $0x0
+  8017ae:	e8 1c 2b 00 00       	call   8042cf <page_map>
+  8017b3:	83 c4 20             	add    $0x20,%esp
+  8017b6:	85 c0                	test   %eax,%eax
+  8017b8:	78 25                	js     8017df <fork+0x2ac>
+		free(temp);
+  8017ba:	83 ec 0c             	sub    $0xc,%esp
+  8017bd:	57                   	push   %edi
+  8017be:	e8 fc 2e 00 00       	call   8046bf <free>
+  8017c3:	83 c4 10             	add    $0x10,%esp
+  8017c6:	e9 5c ff ff ff       	jmp    801727 <fork+0x1f4>
+			panic("malloc failed");
+  8017cb:	83 ec 04             	sub    $0x4,%esp
+  8017ce:	68 f2 59 80 00       	push   $0x8059f2
+  8017d3:	6a 56                	push   $0x56
+  8017d5:	68 cb 59 80 00       	push   $0x8059cb
+  8017da:	e8 b8 ea ff ff       	call   800297 <_panic>
+			panic("page_map: %e", r);
+  8017df:	50                   	push   %eax
+  8017e0:	68 00 5a 80 00       	push   $0x805a00
+  8017e5:	6a 59                	push   $0x59
+  8017e7:	68 cb 59 80 00       	push   $0x8059cb
+  8017ec:	e8 a6 ea ff ff       	call   800297 <_panic>
+			panic("page_map %d", r);
+  8017f1:	50                   	push   %eax
+  8017f2:	68 e6 59 80 00       	push   $0x8059e6
+  8017f7:	6a 65                	push   $0x65
+  8017f9:	68 cb 59 80 00       	push   $0x8059cb
+  8017fe:	e8 94 ea ff ff       	call   800297 <_panic>
+			panic("page_map %d", r);
+  801803:	50                   	push   %eax
+  801804:	68 e6 59 80 00       	push   $0x8059e6
+  801809:	6a 78                	push   $0x78
+  80180b:	68 cb 59 80 00       	push   $0x8059cb
+  801810:	e8 82 ea ff ff       	call   800297 <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  801815:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801818:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80181f:	c1 e1 0c             	shl    $0xc,%ecx
+  801822:	83 ec 0c             	sub    $0xc,%esp
+  801825:	25 07 0e 00 00       	and    $0xe07,%eax
+  80182a:	50                   	push   %eax
+  80182b:	51                   	push   %ecx
+  80182c:	ff 75 e4             	push   -0x1c(%ebp)
+  80182f:	51                   	push   %ecx
+  801830:	6a 00                	push   $0x0
+  801832:	e8 98 2a 00 00       	call   8042cf <page_map>
+  801837:	83 c4 20             	add    $0x20,%esp
+  80183a:	85 c0                	test   %eax,%eax
+  80183c:	0f 89 e5 fe ff ff    	jns    801727 <fork+0x1f4>
+			panic("page_map %d", r);
+  801842:	50                   	push   %eax
+  801843:	68 e6 59 80 00       	push   $0x8059e6
+  801848:	6a 7f                	push   $0x7f
+  80184a:	68 cb 59 80 00       	push   $0x8059cb
+  80184f:	e8 43 ea ff ff       	call   800297 <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801854:	83 c7 01             	add    $0x1,%edi
+  801857:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80185a:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  80185d:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  801860:	39 f7                	cmp    %esi,%edi
+  801862:	74 1c                	je     801880 <fork+0x34d>
+  801864:	89 d8                	mov    %ebx,%eax
+  801866:	e8 c5 fb ff ff       	call   801430 <dupable>
+  80186b:	84 c0                	test   %al,%al
+  80186d:	74 7c                	je     8018eb <fork+0x3b8>
+  80186f:	89 d8                	mov    %ebx,%eax
+  801871:	e8 71 fb ff ff       	call   8013e7 <dupperm>
+  801876:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  801879:	74 d9                	je     801854 <fork+0x321>
+  80187b:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80187e:	eb 06                	jmp    801886 <fork+0x353>
+  801880:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801883:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  801886:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801889:	c1 e0 0c             	shl    $0xc,%eax
+  80188c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80188f:	83 ec 08             	sub    $0x8,%esp
+  801892:	ff 75 dc             	push   -0x24(%ebp)
+  801895:	57                   	push   %edi
+  801896:	50                   	push   %eax
+  801897:	ff 75 e4             	push   -0x1c(%ebp)
+  80189a:	50                   	push   %eax
+  80189b:	6a 00                	push   $0x0
+  80189d:	e8 24 2c 00 00       	call   8044c6 <page_map_range>
+  8018a2:	83 c4 20             	add    $0x20,%esp
+  8018a5:	85 c0                	test   %eax,%eax
+  8018a7:	78 47                	js     8018f0 <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  8018a9:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  8018b0:	0f 84 41 fd ff ff    	je     8015f7 <fork+0xc4>
+  8018b6:	83 ec 08             	sub    $0x8,%esp
+  8018b9:	ff 75 dc             	push   -0x24(%ebp)
+  8018bc:	57                   	push   %edi
+  8018bd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018c0:	50                   	push   %eax
+  8018c1:	6a 00                	push   $0x0
+  8018c3:	50                   	push   %eax
+  8018c4:	6a 00                	push   $0x0
+  8018c6:	e8 fb 2b 00 00       	call   8044c6 <page_map_range>
+  8018cb:	83 c4 20             	add    $0x20,%esp
+  8018ce:	85 c0                	test   %eax,%eax
+  8018d0:	0f 89 21 fd ff ff    	jns    8015f7 <fork+0xc4>
+		panic("page_map_range %e", r);
+  8018d6:	50                   	push   %eax
+  8018d7:	68 0d 5a 80 00       	push   $0x805a0d
+  8018dc:	68 a2 00 00 00       	push   $0xa2
+  8018e1:	68 cb 59 80 00       	push   $0x8059cb
+  8018e6:	e8 ac e9 ff ff       	call   800297 <_panic>
+  8018eb:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8018ee:	eb 96                	jmp    801886 <fork+0x353>
+		panic("page_map_range %e", r);
+  8018f0:	50                   	push   %eax
+  8018f1:	68 0d 5a 80 00       	push   $0x805a0d
+  8018f6:	68 a0 00 00 00       	push   $0xa0
+  8018fb:	68 cb 59 80 00       	push   $0x8059cb
+  801900:	e8 92 e9 ff ff       	call   800297 <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  801905:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  801908:	6a 01                	push   $0x1
+  80190a:	6a 07                	push   $0x7
+  80190c:	68 00 f0 bf ee       	push   $0xeebff000
+  801911:	53                   	push   %ebx
+  801912:	e8 57 23 00 00       	call   803c6e <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801917:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80191c:	8b 40 74             	mov    0x74(%eax),%eax
+  80191f:	83 c4 08             	add    $0x8,%esp
+  801922:	50                   	push   %eax
+  801923:	53                   	push   %ebx
+  801924:	e8 89 f8 ff ff       	call   8011b2 <sys_env_set_pgfault_upcall>
+  801929:	83 c4 10             	add    $0x10,%esp
+  80192c:	e9 41 fc ff ff       	jmp    801572 <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801931:	e8 d8 f4 ff ff       	call   800e0e <sys_getenvid>
+  801936:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80193b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80193e:	c1 e0 06             	shl    $0x6,%eax
+  801941:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801946:	a3 18 f9 80 00       	mov    %eax,0x80f918
+		return 0;
+  80194b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801952:	e9 40 fc ff ff       	jmp    801597 <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  801957:	50                   	push   %eax
+  801958:	68 1f 5a 80 00       	push   $0x805a1f
+  80195d:	68 27 01 00 00       	push   $0x127
+  801962:	68 cb 59 80 00       	push   $0x8059cb
+  801967:	e8 2b e9 ff ff       	call   800297 <_panic>
+		panic("sys_env_set_status: %d", r);
+  80196c:	50                   	push   %eax
+  80196d:	68 38 5a 80 00       	push   $0x805a38
+  801972:	68 2b 01 00 00       	push   $0x12b
+  801977:	68 cb 59 80 00       	push   $0x8059cb
+  80197c:	e8 16 e9 ff ff       	call   800297 <_panic>
+
+00801981 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801981:	55                   	push   %ebp
+  801982:	89 e5                	mov    %esp,%ebp
+  801984:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801987:	68 4f 5a 80 00       	push   $0x805a4f
+  80198c:	68 35 01 00 00       	push   $0x135
+  801991:	68 cb 59 80 00       	push   $0x8059cb
+  801996:	e8 fc e8 ff ff       	call   800297 <_panic>
+
+0080199b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80199b:	55                   	push   %ebp
+  80199c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80199e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a1:	05 00 00 00 30       	add    $0x30000000,%eax
+  8019a6:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8019a9:	5d                   	pop    %ebp
+  8019aa:	c3                   	ret
+
+008019ab <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8019ab:	55                   	push   %ebp
+  8019ac:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b1:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8019b6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8019bb:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8019c0:	5d                   	pop    %ebp
+  8019c1:	c3                   	ret
+
+008019c2 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8019c2:	55                   	push   %ebp
+  8019c3:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8019c5:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8019ca:	a8 01                	test   $0x1,%al
+  8019cc:	74 3c                	je     801a0a <fd_alloc+0x48>
+  8019ce:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8019d3:	89 c2                	mov    %eax,%edx
+  8019d5:	c1 ea 0c             	shr    $0xc,%edx
+  8019d8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019df:	89 c1                	mov    %eax,%ecx
+  8019e1:	05 00 10 00 00       	add    $0x1000,%eax
+  8019e6:	f6 c2 01             	test   $0x1,%dl
+  8019e9:	74 13                	je     8019fe <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8019eb:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8019f0:	75 e1                	jne    8019d3 <fd_alloc+0x11>
+  8019f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8019f7:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8019fc:	eb 05                	jmp    801a03 <fd_alloc+0x41>
+			return 0;
+  8019fe:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801a03:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a06:	89 0a                	mov    %ecx,(%edx)
+}
+  801a08:	5d                   	pop    %ebp
+  801a09:	c3                   	ret
+  801a0a:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a14:	eb ed                	jmp    801a03 <fd_alloc+0x41>
+
+00801a16 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801a16:	55                   	push   %ebp
+  801a17:	89 e5                	mov    %esp,%ebp
+  801a19:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801a1c:	83 f8 1f             	cmp    $0x1f,%eax
+  801a1f:	77 30                	ja     801a51 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801a21:	c1 e0 0c             	shl    $0xc,%eax
+  801a24:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801a29:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801a2f:	f6 c2 01             	test   $0x1,%dl
+  801a32:	74 24                	je     801a58 <fd_lookup+0x42>
+  801a34:	89 c2                	mov    %eax,%edx
+  801a36:	c1 ea 0c             	shr    $0xc,%edx
+  801a39:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a40:	f6 c2 01             	test   $0x1,%dl
+  801a43:	74 1a                	je     801a5f <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801a45:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a48:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801a4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a4f:	5d                   	pop    %ebp
+  801a50:	c3                   	ret
+		return -E_INVAL;
+  801a51:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a56:	eb f7                	jmp    801a4f <fd_lookup+0x39>
+		return -E_INVAL;
+  801a58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a5d:	eb f0                	jmp    801a4f <fd_lookup+0x39>
+  801a5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a64:	eb e9                	jmp    801a4f <fd_lookup+0x39>
+
+00801a66 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801a66:	55                   	push   %ebp
+  801a67:	89 e5                	mov    %esp,%ebp
+  801a69:	53                   	push   %ebx
+  801a6a:	83 ec 04             	sub    $0x4,%esp
+  801a6d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801a70:	b8 e4 5a 80 00       	mov    $0x805ae4,%eax
+  801a75:	8b 18                	mov    (%eax),%ebx
+  801a77:	85 db                	test   %ebx,%ebx
+  801a79:	74 0e                	je     801a89 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801a7b:	83 c0 04             	add    $0x4,%eax
+  801a7e:	39 13                	cmp    %edx,(%ebx)
+  801a80:	75 f3                	jne    801a75 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801a82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a87:	eb 1f                	jmp    801aa8 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a89:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801a8e:	8b 40 48             	mov    0x48(%eax),%eax
+  801a91:	83 ec 04             	sub    $0x4,%esp
+  801a94:	52                   	push   %edx
+  801a95:	50                   	push   %eax
+  801a96:	68 68 5a 80 00       	push   $0x805a68
+  801a9b:	e8 d2 e8 ff ff       	call   800372 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801aa0:	83 c4 10             	add    $0x10,%esp
+  801aa3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801aa8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801aab:	89 1a                	mov    %ebx,(%edx)
+}
+  801aad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ab0:	c9                   	leave
+  801ab1:	c3                   	ret
+
+00801ab2 <fd_close>:
+{
+  801ab2:	55                   	push   %ebp
+  801ab3:	89 e5                	mov    %esp,%ebp
+  801ab5:	57                   	push   %edi
+  801ab6:	56                   	push   %esi
+  801ab7:	53                   	push   %ebx
+  801ab8:	83 ec 24             	sub    $0x24,%esp
+  801abb:	8b 75 08             	mov    0x8(%ebp),%esi
+  801abe:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ac1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ac4:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ac5:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801acb:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ace:	50                   	push   %eax
+  801acf:	e8 42 ff ff ff       	call   801a16 <fd_lookup>
+  801ad4:	89 c3                	mov    %eax,%ebx
+  801ad6:	83 c4 10             	add    $0x10,%esp
+  801ad9:	85 c0                	test   %eax,%eax
+  801adb:	78 05                	js     801ae2 <fd_close+0x30>
+	    || fd != fd2)
+  801add:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ae0:	74 16                	je     801af8 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801ae2:	89 f8                	mov    %edi,%eax
+  801ae4:	84 c0                	test   %al,%al
+  801ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aeb:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801aee:	89 d8                	mov    %ebx,%eax
+  801af0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801af3:	5b                   	pop    %ebx
+  801af4:	5e                   	pop    %esi
+  801af5:	5f                   	pop    %edi
+  801af6:	5d                   	pop    %ebp
+  801af7:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801af8:	83 ec 08             	sub    $0x8,%esp
+  801afb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801afe:	50                   	push   %eax
+  801aff:	ff 36                	push   (%esi)
+  801b01:	e8 60 ff ff ff       	call   801a66 <dev_lookup>
+  801b06:	89 c3                	mov    %eax,%ebx
+  801b08:	83 c4 10             	add    $0x10,%esp
+  801b0b:	85 c0                	test   %eax,%eax
+  801b0d:	78 1a                	js     801b29 <fd_close+0x77>
+		if (dev->dev_close)
+  801b0f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b12:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801b15:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801b1a:	85 c0                	test   %eax,%eax
+  801b1c:	74 0b                	je     801b29 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801b1e:	83 ec 0c             	sub    $0xc,%esp
+  801b21:	56                   	push   %esi
+  801b22:	ff d0                	call   *%eax
+  801b24:	89 c3                	mov    %eax,%ebx
+  801b26:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801b29:	83 ec 08             	sub    $0x8,%esp
+  801b2c:	56                   	push   %esi
+  801b2d:	6a 00                	push   $0x0
+  801b2f:	e8 9d f3 ff ff       	call   800ed1 <sys_page_unmap>
+	return r;
+  801b34:	83 c4 10             	add    $0x10,%esp
+  801b37:	eb b5                	jmp    801aee <fd_close+0x3c>
+
+00801b39 <close>:
+
+int
+close(int fdnum)
+{
+  801b39:	55                   	push   %ebp
+  801b3a:	89 e5                	mov    %esp,%ebp
+  801b3c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b3f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b42:	50                   	push   %eax
+  801b43:	ff 75 08             	push   0x8(%ebp)
+  801b46:	e8 cb fe ff ff       	call   801a16 <fd_lookup>
+  801b4b:	83 c4 10             	add    $0x10,%esp
+  801b4e:	85 c0                	test   %eax,%eax
+  801b50:	79 02                	jns    801b54 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801b52:	c9                   	leave
+  801b53:	c3                   	ret
+		return fd_close(fd, 1);
+  801b54:	83 ec 08             	sub    $0x8,%esp
+  801b57:	6a 01                	push   $0x1
+  801b59:	ff 75 f4             	push   -0xc(%ebp)
+  801b5c:	e8 51 ff ff ff       	call   801ab2 <fd_close>
+  801b61:	83 c4 10             	add    $0x10,%esp
+  801b64:	eb ec                	jmp    801b52 <close+0x19>
+
+00801b66 <close_all>:
+
+void
+close_all(void)
+{
+  801b66:	55                   	push   %ebp
+  801b67:	89 e5                	mov    %esp,%ebp
+  801b69:	53                   	push   %ebx
+  801b6a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801b6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801b72:	83 ec 0c             	sub    $0xc,%esp
+  801b75:	53                   	push   %ebx
+  801b76:	e8 be ff ff ff       	call   801b39 <close>
+	for (i = 0; i < MAXFD; i++)
+  801b7b:	83 c3 01             	add    $0x1,%ebx
+  801b7e:	83 c4 10             	add    $0x10,%esp
+  801b81:	83 fb 20             	cmp    $0x20,%ebx
+  801b84:	75 ec                	jne    801b72 <close_all+0xc>
+}
+  801b86:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b89:	c9                   	leave
+  801b8a:	c3                   	ret
+
+00801b8b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801b8b:	55                   	push   %ebp
+  801b8c:	89 e5                	mov    %esp,%ebp
+  801b8e:	57                   	push   %edi
+  801b8f:	56                   	push   %esi
+  801b90:	53                   	push   %ebx
+  801b91:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801b94:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b97:	50                   	push   %eax
+  801b98:	ff 75 08             	push   0x8(%ebp)
+  801b9b:	e8 76 fe ff ff       	call   801a16 <fd_lookup>
+  801ba0:	89 c3                	mov    %eax,%ebx
+  801ba2:	83 c4 10             	add    $0x10,%esp
+  801ba5:	85 c0                	test   %eax,%eax
+  801ba7:	78 7f                	js     801c28 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801ba9:	83 ec 0c             	sub    $0xc,%esp
+  801bac:	ff 75 0c             	push   0xc(%ebp)
+  801baf:	e8 85 ff ff ff       	call   801b39 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801bb4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801bb7:	c1 e6 0c             	shl    $0xc,%esi
+  801bba:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801bc0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801bc3:	89 3c 24             	mov    %edi,(%esp)
+  801bc6:	e8 e0 fd ff ff       	call   8019ab <fd2data>
+  801bcb:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801bcd:	89 34 24             	mov    %esi,(%esp)
+  801bd0:	e8 d6 fd ff ff       	call   8019ab <fd2data>
+  801bd5:	83 c4 10             	add    $0x10,%esp
+  801bd8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801bdb:	89 d8                	mov    %ebx,%eax
+  801bdd:	c1 e8 16             	shr    $0x16,%eax
+  801be0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801be7:	a8 01                	test   $0x1,%al
+  801be9:	74 11                	je     801bfc <dup+0x71>
+  801beb:	89 d8                	mov    %ebx,%eax
+  801bed:	c1 e8 0c             	shr    $0xc,%eax
+  801bf0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801bf7:	f6 c2 01             	test   $0x1,%dl
+  801bfa:	75 36                	jne    801c32 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801bfc:	89 f8                	mov    %edi,%eax
+  801bfe:	c1 e8 0c             	shr    $0xc,%eax
+  801c01:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c08:	83 ec 0c             	sub    $0xc,%esp
+  801c0b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c10:	50                   	push   %eax
+  801c11:	56                   	push   %esi
+  801c12:	6a 00                	push   $0x0
+  801c14:	57                   	push   %edi
+  801c15:	6a 00                	push   $0x0
+  801c17:	e8 73 f2 ff ff       	call   800e8f <sys_page_map>
+  801c1c:	89 c3                	mov    %eax,%ebx
+  801c1e:	83 c4 20             	add    $0x20,%esp
+  801c21:	85 c0                	test   %eax,%eax
+  801c23:	78 33                	js     801c58 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801c25:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801c28:	89 d8                	mov    %ebx,%eax
+  801c2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c2d:	5b                   	pop    %ebx
+  801c2e:	5e                   	pop    %esi
+  801c2f:	5f                   	pop    %edi
+  801c30:	5d                   	pop    %ebp
+  801c31:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801c32:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c39:	83 ec 0c             	sub    $0xc,%esp
+  801c3c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c41:	50                   	push   %eax
+  801c42:	ff 75 d4             	push   -0x2c(%ebp)
+  801c45:	6a 00                	push   $0x0
+  801c47:	53                   	push   %ebx
+  801c48:	6a 00                	push   $0x0
+  801c4a:	e8 40 f2 ff ff       	call   800e8f <sys_page_map>
+  801c4f:	89 c3                	mov    %eax,%ebx
+  801c51:	83 c4 20             	add    $0x20,%esp
+  801c54:	85 c0                	test   %eax,%eax
+  801c56:	79 a4                	jns    801bfc <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801c58:	83 ec 08             	sub    $0x8,%esp
+  801c5b:	56                   	push   %esi
+  801c5c:	6a 00                	push   $0x0
+  801c5e:	e8 6e f2 ff ff       	call   800ed1 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801c63:	83 c4 08             	add    $0x8,%esp
+  801c66:	ff 75 d4             	push   -0x2c(%ebp)
+  801c69:	6a 00                	push   $0x0
+  801c6b:	e8 61 f2 ff ff       	call   800ed1 <sys_page_unmap>
+	return r;
+  801c70:	83 c4 10             	add    $0x10,%esp
+  801c73:	eb b3                	jmp    801c28 <dup+0x9d>
+
+00801c75 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801c75:	55                   	push   %ebp
+  801c76:	89 e5                	mov    %esp,%ebp
+  801c78:	56                   	push   %esi
+  801c79:	53                   	push   %ebx
+  801c7a:	83 ec 18             	sub    $0x18,%esp
+  801c7d:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c80:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c83:	50                   	push   %eax
+  801c84:	56                   	push   %esi
+  801c85:	e8 8c fd ff ff       	call   801a16 <fd_lookup>
+  801c8a:	83 c4 10             	add    $0x10,%esp
+  801c8d:	85 c0                	test   %eax,%eax
+  801c8f:	78 3c                	js     801ccd <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c91:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801c94:	83 ec 08             	sub    $0x8,%esp
+  801c97:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c9a:	50                   	push   %eax
+  801c9b:	ff 33                	push   (%ebx)
+  801c9d:	e8 c4 fd ff ff       	call   801a66 <dev_lookup>
+  801ca2:	83 c4 10             	add    $0x10,%esp
+  801ca5:	85 c0                	test   %eax,%eax
+  801ca7:	78 24                	js     801ccd <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ca9:	8b 43 08             	mov    0x8(%ebx),%eax
+  801cac:	83 e0 03             	and    $0x3,%eax
+  801caf:	83 f8 01             	cmp    $0x1,%eax
+  801cb2:	74 20                	je     801cd4 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801cb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cb7:	8b 40 08             	mov    0x8(%eax),%eax
+  801cba:	85 c0                	test   %eax,%eax
+  801cbc:	74 37                	je     801cf5 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801cbe:	83 ec 04             	sub    $0x4,%esp
+  801cc1:	ff 75 10             	push   0x10(%ebp)
+  801cc4:	ff 75 0c             	push   0xc(%ebp)
+  801cc7:	53                   	push   %ebx
+  801cc8:	ff d0                	call   *%eax
+  801cca:	83 c4 10             	add    $0x10,%esp
+}
+  801ccd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cd0:	5b                   	pop    %ebx
+  801cd1:	5e                   	pop    %esi
+  801cd2:	5d                   	pop    %ebp
+  801cd3:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cd4:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801cd9:	8b 40 48             	mov    0x48(%eax),%eax
+  801cdc:	83 ec 04             	sub    $0x4,%esp
+  801cdf:	56                   	push   %esi
+  801ce0:	50                   	push   %eax
+  801ce1:	68 a9 5a 80 00       	push   $0x805aa9
+  801ce6:	e8 87 e6 ff ff       	call   800372 <cprintf>
+		return -E_INVAL;
+  801ceb:	83 c4 10             	add    $0x10,%esp
+  801cee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cf3:	eb d8                	jmp    801ccd <read+0x58>
+		return -E_NOT_SUPP;
+  801cf5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cfa:	eb d1                	jmp    801ccd <read+0x58>
+
+00801cfc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801cfc:	55                   	push   %ebp
+  801cfd:	89 e5                	mov    %esp,%ebp
+  801cff:	57                   	push   %edi
+  801d00:	56                   	push   %esi
+  801d01:	53                   	push   %ebx
+  801d02:	83 ec 0c             	sub    $0xc,%esp
+  801d05:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d08:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801d0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d10:	eb 02                	jmp    801d14 <readn+0x18>
+  801d12:	01 c3                	add    %eax,%ebx
+  801d14:	39 f3                	cmp    %esi,%ebx
+  801d16:	73 21                	jae    801d39 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d18:	83 ec 04             	sub    $0x4,%esp
+  801d1b:	89 f0                	mov    %esi,%eax
+  801d1d:	29 d8                	sub    %ebx,%eax
+  801d1f:	50                   	push   %eax
+  801d20:	89 d8                	mov    %ebx,%eax
+  801d22:	03 45 0c             	add    0xc(%ebp),%eax
+  801d25:	50                   	push   %eax
+  801d26:	57                   	push   %edi
+  801d27:	e8 49 ff ff ff       	call   801c75 <read>
+		if (m < 0)
+  801d2c:	83 c4 10             	add    $0x10,%esp
+  801d2f:	85 c0                	test   %eax,%eax
+  801d31:	78 04                	js     801d37 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801d33:	75 dd                	jne    801d12 <readn+0x16>
+  801d35:	eb 02                	jmp    801d39 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d37:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801d39:	89 d8                	mov    %ebx,%eax
+  801d3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d3e:	5b                   	pop    %ebx
+  801d3f:	5e                   	pop    %esi
+  801d40:	5f                   	pop    %edi
+  801d41:	5d                   	pop    %ebp
+  801d42:	c3                   	ret
+
+00801d43 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801d43:	55                   	push   %ebp
+  801d44:	89 e5                	mov    %esp,%ebp
+  801d46:	56                   	push   %esi
+  801d47:	53                   	push   %ebx
+  801d48:	83 ec 18             	sub    $0x18,%esp
+  801d4b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d4e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d51:	50                   	push   %eax
+  801d52:	53                   	push   %ebx
+  801d53:	e8 be fc ff ff       	call   801a16 <fd_lookup>
+  801d58:	83 c4 10             	add    $0x10,%esp
+  801d5b:	85 c0                	test   %eax,%eax
+  801d5d:	78 37                	js     801d96 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d5f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d62:	83 ec 08             	sub    $0x8,%esp
+  801d65:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d68:	50                   	push   %eax
+  801d69:	ff 36                	push   (%esi)
+  801d6b:	e8 f6 fc ff ff       	call   801a66 <dev_lookup>
+  801d70:	83 c4 10             	add    $0x10,%esp
+  801d73:	85 c0                	test   %eax,%eax
+  801d75:	78 1f                	js     801d96 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d77:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d7b:	74 20                	je     801d9d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801d7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d80:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d83:	85 c0                	test   %eax,%eax
+  801d85:	74 37                	je     801dbe <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801d87:	83 ec 04             	sub    $0x4,%esp
+  801d8a:	ff 75 10             	push   0x10(%ebp)
+  801d8d:	ff 75 0c             	push   0xc(%ebp)
+  801d90:	56                   	push   %esi
+  801d91:	ff d0                	call   *%eax
+  801d93:	83 c4 10             	add    $0x10,%esp
+}
+  801d96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d99:	5b                   	pop    %ebx
+  801d9a:	5e                   	pop    %esi
+  801d9b:	5d                   	pop    %ebp
+  801d9c:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d9d:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801da2:	8b 40 48             	mov    0x48(%eax),%eax
+  801da5:	83 ec 04             	sub    $0x4,%esp
+  801da8:	53                   	push   %ebx
+  801da9:	50                   	push   %eax
+  801daa:	68 c5 5a 80 00       	push   $0x805ac5
+  801daf:	e8 be e5 ff ff       	call   800372 <cprintf>
+		return -E_INVAL;
+  801db4:	83 c4 10             	add    $0x10,%esp
+  801db7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dbc:	eb d8                	jmp    801d96 <write+0x53>
+		return -E_NOT_SUPP;
+  801dbe:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dc3:	eb d1                	jmp    801d96 <write+0x53>
+
+00801dc5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801dc5:	55                   	push   %ebp
+  801dc6:	89 e5                	mov    %esp,%ebp
+  801dc8:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801dcb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dce:	50                   	push   %eax
+  801dcf:	ff 75 08             	push   0x8(%ebp)
+  801dd2:	e8 3f fc ff ff       	call   801a16 <fd_lookup>
+  801dd7:	83 c4 10             	add    $0x10,%esp
+  801dda:	85 c0                	test   %eax,%eax
+  801ddc:	78 0e                	js     801dec <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801dde:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801de1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801de4:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801de7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dec:	c9                   	leave
+  801ded:	c3                   	ret
+
+00801dee <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801dee:	55                   	push   %ebp
+  801def:	89 e5                	mov    %esp,%ebp
+  801df1:	56                   	push   %esi
+  801df2:	53                   	push   %ebx
+  801df3:	83 ec 18             	sub    $0x18,%esp
+  801df6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801df9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dfc:	50                   	push   %eax
+  801dfd:	53                   	push   %ebx
+  801dfe:	e8 13 fc ff ff       	call   801a16 <fd_lookup>
+  801e03:	83 c4 10             	add    $0x10,%esp
+  801e06:	85 c0                	test   %eax,%eax
+  801e08:	78 34                	js     801e3e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e0a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e0d:	83 ec 08             	sub    $0x8,%esp
+  801e10:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e13:	50                   	push   %eax
+  801e14:	ff 36                	push   (%esi)
+  801e16:	e8 4b fc ff ff       	call   801a66 <dev_lookup>
+  801e1b:	83 c4 10             	add    $0x10,%esp
+  801e1e:	85 c0                	test   %eax,%eax
+  801e20:	78 1c                	js     801e3e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e22:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e26:	74 1d                	je     801e45 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801e28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e2b:	8b 40 18             	mov    0x18(%eax),%eax
+  801e2e:	85 c0                	test   %eax,%eax
+  801e30:	74 34                	je     801e66 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801e32:	83 ec 08             	sub    $0x8,%esp
+  801e35:	ff 75 0c             	push   0xc(%ebp)
+  801e38:	56                   	push   %esi
+  801e39:	ff d0                	call   *%eax
+  801e3b:	83 c4 10             	add    $0x10,%esp
+}
+  801e3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e41:	5b                   	pop    %ebx
+  801e42:	5e                   	pop    %esi
+  801e43:	5d                   	pop    %ebp
+  801e44:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801e45:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801e4a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e4d:	83 ec 04             	sub    $0x4,%esp
+  801e50:	53                   	push   %ebx
+  801e51:	50                   	push   %eax
+  801e52:	68 88 5a 80 00       	push   $0x805a88
+  801e57:	e8 16 e5 ff ff       	call   800372 <cprintf>
+		return -E_INVAL;
+  801e5c:	83 c4 10             	add    $0x10,%esp
+  801e5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e64:	eb d8                	jmp    801e3e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801e66:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e6b:	eb d1                	jmp    801e3e <ftruncate+0x50>
+
+00801e6d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801e6d:	55                   	push   %ebp
+  801e6e:	89 e5                	mov    %esp,%ebp
+  801e70:	56                   	push   %esi
+  801e71:	53                   	push   %ebx
+  801e72:	83 ec 18             	sub    $0x18,%esp
+  801e75:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e78:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e7b:	50                   	push   %eax
+  801e7c:	ff 75 08             	push   0x8(%ebp)
+  801e7f:	e8 92 fb ff ff       	call   801a16 <fd_lookup>
+  801e84:	83 c4 10             	add    $0x10,%esp
+  801e87:	85 c0                	test   %eax,%eax
+  801e89:	78 49                	js     801ed4 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e8b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e8e:	83 ec 08             	sub    $0x8,%esp
+  801e91:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e94:	50                   	push   %eax
+  801e95:	ff 36                	push   (%esi)
+  801e97:	e8 ca fb ff ff       	call   801a66 <dev_lookup>
+  801e9c:	83 c4 10             	add    $0x10,%esp
+  801e9f:	85 c0                	test   %eax,%eax
+  801ea1:	78 31                	js     801ed4 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801ea3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ea6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801eaa:	74 2f                	je     801edb <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801eac:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801eaf:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801eb6:	00 00 00 
+	stat->st_isdir = 0;
+  801eb9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ec0:	00 00 00 
+	stat->st_dev = dev;
+  801ec3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801ec9:	83 ec 08             	sub    $0x8,%esp
+  801ecc:	53                   	push   %ebx
+  801ecd:	56                   	push   %esi
+  801ece:	ff 50 14             	call   *0x14(%eax)
+  801ed1:	83 c4 10             	add    $0x10,%esp
+}
+  801ed4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ed7:	5b                   	pop    %ebx
+  801ed8:	5e                   	pop    %esi
+  801ed9:	5d                   	pop    %ebp
+  801eda:	c3                   	ret
+		return -E_NOT_SUPP;
+  801edb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ee0:	eb f2                	jmp    801ed4 <fstat+0x67>
+
+00801ee2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801ee2:	55                   	push   %ebp
+  801ee3:	89 e5                	mov    %esp,%ebp
+  801ee5:	56                   	push   %esi
+  801ee6:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801ee7:	83 ec 08             	sub    $0x8,%esp
+  801eea:	6a 00                	push   $0x0
+  801eec:	ff 75 08             	push   0x8(%ebp)
+  801eef:	e8 bc 02 00 00       	call   8021b0 <open>
+  801ef4:	89 c3                	mov    %eax,%ebx
+  801ef6:	83 c4 10             	add    $0x10,%esp
+  801ef9:	85 c0                	test   %eax,%eax
+  801efb:	78 1b                	js     801f18 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801efd:	83 ec 08             	sub    $0x8,%esp
+  801f00:	ff 75 0c             	push   0xc(%ebp)
+  801f03:	50                   	push   %eax
+  801f04:	e8 64 ff ff ff       	call   801e6d <fstat>
+  801f09:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801f0b:	89 1c 24             	mov    %ebx,(%esp)
+  801f0e:	e8 26 fc ff ff       	call   801b39 <close>
+	return r;
+  801f13:	83 c4 10             	add    $0x10,%esp
+  801f16:	89 f3                	mov    %esi,%ebx
+}
+  801f18:	89 d8                	mov    %ebx,%eax
+  801f1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f1d:	5b                   	pop    %ebx
+  801f1e:	5e                   	pop    %esi
+  801f1f:	5d                   	pop    %ebp
+  801f20:	c3                   	ret
+
+00801f21 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801f21:	55                   	push   %ebp
+  801f22:	89 e5                	mov    %esp,%ebp
+  801f24:	57                   	push   %edi
+  801f25:	56                   	push   %esi
+  801f26:	53                   	push   %ebx
+  801f27:	83 ec 0c             	sub    $0xc,%esp
+  801f2a:	89 c7                	mov    %eax,%edi
+  801f2c:	89 d3                	mov    %edx,%ebx
+  801f2e:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801f30:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  801f37:	74 2d                	je     801f66 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801f39:	6a 07                	push   $0x7
+  801f3b:	68 00 00 81 00       	push   $0x810000
+  801f40:	57                   	push   %edi
+  801f41:	ff 35 00 80 80 00    	push   0x808000
+  801f47:	e8 ba 31 00 00       	call   805106 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801f4c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801f53:	6a 00                	push   $0x0
+  801f55:	56                   	push   %esi
+  801f56:	53                   	push   %ebx
+  801f57:	6a 00                	push   $0x0
+  801f59:	e8 5a 30 00 00       	call   804fb8 <ipc_recv_pages>
+}
+  801f5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f61:	5b                   	pop    %ebx
+  801f62:	5e                   	pop    %esi
+  801f63:	5f                   	pop    %edi
+  801f64:	5d                   	pop    %ebp
+  801f65:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f66:	83 ec 0c             	sub    $0xc,%esp
+  801f69:	6a 01                	push   $0x1
+  801f6b:	e8 8b 32 00 00       	call   8051fb <ipc_find_env>
+  801f70:	a3 00 80 80 00       	mov    %eax,0x808000
+  801f75:	83 c4 10             	add    $0x10,%esp
+  801f78:	eb bf                	jmp    801f39 <fsipc_pages+0x18>
+
+00801f7a <fsipc>:
+{
+  801f7a:	55                   	push   %ebp
+  801f7b:	89 e5                	mov    %esp,%ebp
+  801f7d:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801f80:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f85:	e8 97 ff ff ff       	call   801f21 <fsipc_pages>
+}
+  801f8a:	c9                   	leave
+  801f8b:	c3                   	ret
+
+00801f8c <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801f8c:	55                   	push   %ebp
+  801f8d:	89 e5                	mov    %esp,%ebp
+  801f8f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f92:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f95:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f98:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.set_size.req_size = newsize;
+  801f9d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fa0:	a3 04 00 81 00       	mov    %eax,0x810004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801fa5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801faa:	b8 02 00 00 00       	mov    $0x2,%eax
+  801faf:	e8 c6 ff ff ff       	call   801f7a <fsipc>
+}
+  801fb4:	c9                   	leave
+  801fb5:	c3                   	ret
+
+00801fb6 <devfile_flush>:
+{
+  801fb6:	55                   	push   %ebp
+  801fb7:	89 e5                	mov    %esp,%ebp
+  801fb9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801fbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fbf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fc2:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801fc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fcc:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fd1:	e8 a4 ff ff ff       	call   801f7a <fsipc>
+}
+  801fd6:	c9                   	leave
+  801fd7:	c3                   	ret
+
+00801fd8 <devfile_stat>:
+{
+  801fd8:	55                   	push   %ebp
+  801fd9:	89 e5                	mov    %esp,%ebp
+  801fdb:	53                   	push   %ebx
+  801fdc:	83 ec 04             	sub    $0x4,%esp
+  801fdf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801fe2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fe8:	a3 00 00 81 00       	mov    %eax,0x810000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801fed:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff2:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ff7:	e8 7e ff ff ff       	call   801f7a <fsipc>
+  801ffc:	85 c0                	test   %eax,%eax
+  801ffe:	78 2c                	js     80202c <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802000:	83 ec 08             	sub    $0x8,%esp
+  802003:	68 00 00 81 00       	push   $0x810000
+  802008:	53                   	push   %ebx
+  802009:	e8 4b e9 ff ff       	call   800959 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80200e:	a1 80 00 81 00       	mov    0x810080,%eax
+  802013:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802019:	a1 84 00 81 00       	mov    0x810084,%eax
+  80201e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802024:	83 c4 10             	add    $0x10,%esp
+  802027:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80202c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80202f:	c9                   	leave
+  802030:	c3                   	ret
+
+00802031 <devfile_write>:
+{
+  802031:	55                   	push   %ebp
+  802032:	89 e5                	mov    %esp,%ebp
+  802034:	83 ec 0c             	sub    $0xc,%esp
+  802037:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80203a:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80203f:	39 d0                	cmp    %edx,%eax
+  802041:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802044:	8b 55 08             	mov    0x8(%ebp),%edx
+  802047:	8b 52 0c             	mov    0xc(%edx),%edx
+  80204a:	89 15 00 00 81 00    	mov    %edx,0x810000
+	fsipcbuf.write.req_n = n;
+  802050:	a3 04 00 81 00       	mov    %eax,0x810004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  802055:	50                   	push   %eax
+  802056:	ff 75 0c             	push   0xc(%ebp)
+  802059:	68 08 00 81 00       	push   $0x810008
+  80205e:	e8 7c ea ff ff       	call   800adf <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  802063:	ba 00 00 00 00       	mov    $0x0,%edx
+  802068:	b8 04 00 00 00       	mov    $0x4,%eax
+  80206d:	e8 08 ff ff ff       	call   801f7a <fsipc>
+}
+  802072:	c9                   	leave
+  802073:	c3                   	ret
+
+00802074 <devfile_read>:
+{
+  802074:	55                   	push   %ebp
+  802075:	89 e5                	mov    %esp,%ebp
+  802077:	57                   	push   %edi
+  802078:	56                   	push   %esi
+  802079:	53                   	push   %ebx
+  80207a:	83 ec 1c             	sub    $0x1c,%esp
+  80207d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802080:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802083:	89 fe                	mov    %edi,%esi
+  802085:	c1 ee 0c             	shr    $0xc,%esi
+  802088:	b8 20 00 00 00       	mov    $0x20,%eax
+  80208d:	39 c6                	cmp    %eax,%esi
+  80208f:	0f 47 f0             	cmova  %eax,%esi
+  802092:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802095:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80209a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80209d:	eb 14                	jmp    8020b3 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  80209f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  8020a6:	05 00 10 00 00       	add    $0x1000,%eax
+  8020ab:	f6 c6 06             	test   $0x6,%dh
+  8020ae:	75 42                	jne    8020f2 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8020b0:	83 c1 01             	add    $0x1,%ecx
+  8020b3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8020b6:	39 f1                	cmp    %esi,%ecx
+  8020b8:	0f 84 95 00 00 00    	je     802153 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8020be:	89 c2                	mov    %eax,%edx
+  8020c0:	c1 ea 16             	shr    $0x16,%edx
+  8020c3:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8020ca:	f6 c2 01             	test   $0x1,%dl
+  8020cd:	74 23                	je     8020f2 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8020cf:	89 c2                	mov    %eax,%edx
+  8020d1:	c1 ea 0c             	shr    $0xc,%edx
+  8020d4:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8020db:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  8020e1:	74 0f                	je     8020f2 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  8020e3:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8020ea:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  8020f0:	75 ad                	jne    80209f <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  8020f2:	85 c9                	test   %ecx,%ecx
+  8020f4:	74 11                	je     802107 <devfile_read+0x93>
+  8020f6:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  8020fd:	75 08                	jne    802107 <devfile_read+0x93>
+  8020ff:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  802105:	74 50                	je     802157 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802107:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80210a:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.read.req_n = n;
+  80210f:	89 3d 04 00 81 00    	mov    %edi,0x810004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802115:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80211f:	e8 56 fe ff ff       	call   801f7a <fsipc>
+  802124:	89 c6                	mov    %eax,%esi
+  802126:	85 c0                	test   %eax,%eax
+  802128:	78 1f                	js     802149 <devfile_read+0xd5>
+	assert(r <= n);
+  80212a:	39 c7                	cmp    %eax,%edi
+  80212c:	72 50                	jb     80217e <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  80212e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802133:	7f 62                	jg     802197 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  802135:	83 ec 04             	sub    $0x4,%esp
+  802138:	50                   	push   %eax
+  802139:	68 00 00 81 00       	push   $0x810000
+  80213e:	ff 75 0c             	push   0xc(%ebp)
+  802141:	e8 99 e9 ff ff       	call   800adf <memmove>
+	return r;
+  802146:	83 c4 10             	add    $0x10,%esp
+}
+  802149:	89 f0                	mov    %esi,%eax
+  80214b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80214e:	5b                   	pop    %ebx
+  80214f:	5e                   	pop    %esi
+  802150:	5f                   	pop    %edi
+  802151:	5d                   	pop    %ebp
+  802152:	c3                   	ret
+  802153:	89 f1                	mov    %esi,%ecx
+  802155:	eb 9b                	jmp    8020f2 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  802157:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80215a:	a3 00 00 81 00       	mov    %eax,0x810000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  80215f:	89 c8                	mov    %ecx,%eax
+  802161:	c1 e0 0c             	shl    $0xc,%eax
+  802164:	a3 04 00 81 00       	mov    %eax,0x810004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  802169:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80216c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802171:	e8 ab fd ff ff       	call   801f21 <fsipc_pages>
+  802176:	89 c6                	mov    %eax,%esi
+  802178:	85 c0                	test   %eax,%eax
+  80217a:	78 8b                	js     802107 <devfile_read+0x93>
+  80217c:	eb cb                	jmp    802149 <devfile_read+0xd5>
+	assert(r <= n);
+  80217e:	68 f4 5a 80 00       	push   $0x805af4
+  802183:	68 e3 54 80 00       	push   $0x8054e3
+  802188:	68 a0 00 00 00       	push   $0xa0
+  80218d:	68 fb 5a 80 00       	push   $0x805afb
+  802192:	e8 00 e1 ff ff       	call   800297 <_panic>
+	assert(r <= PGSIZE);
+  802197:	68 06 5b 80 00       	push   $0x805b06
+  80219c:	68 e3 54 80 00       	push   $0x8054e3
+  8021a1:	68 a1 00 00 00       	push   $0xa1
+  8021a6:	68 fb 5a 80 00       	push   $0x805afb
+  8021ab:	e8 e7 e0 ff ff       	call   800297 <_panic>
+
+008021b0 <open>:
+{
+  8021b0:	55                   	push   %ebp
+  8021b1:	89 e5                	mov    %esp,%ebp
+  8021b3:	56                   	push   %esi
+  8021b4:	53                   	push   %ebx
+  8021b5:	83 ec 1c             	sub    $0x1c,%esp
+  8021b8:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8021bb:	56                   	push   %esi
+  8021bc:	e8 5d e7 ff ff       	call   80091e <strlen>
+  8021c1:	83 c4 10             	add    $0x10,%esp
+  8021c4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021c9:	7f 6c                	jg     802237 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8021cb:	83 ec 0c             	sub    $0xc,%esp
+  8021ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021d1:	50                   	push   %eax
+  8021d2:	e8 eb f7 ff ff       	call   8019c2 <fd_alloc>
+  8021d7:	89 c3                	mov    %eax,%ebx
+  8021d9:	83 c4 10             	add    $0x10,%esp
+  8021dc:	85 c0                	test   %eax,%eax
+  8021de:	78 3c                	js     80221c <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8021e0:	83 ec 08             	sub    $0x8,%esp
+  8021e3:	56                   	push   %esi
+  8021e4:	68 00 00 81 00       	push   $0x810000
+  8021e9:	e8 6b e7 ff ff       	call   800959 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8021ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021f1:	a3 00 04 81 00       	mov    %eax,0x810400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021f6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021fe:	e8 77 fd ff ff       	call   801f7a <fsipc>
+  802203:	89 c3                	mov    %eax,%ebx
+  802205:	83 c4 10             	add    $0x10,%esp
+  802208:	85 c0                	test   %eax,%eax
+  80220a:	78 19                	js     802225 <open+0x75>
+	return fd2num(fd);
+  80220c:	83 ec 0c             	sub    $0xc,%esp
+  80220f:	ff 75 f4             	push   -0xc(%ebp)
+  802212:	e8 84 f7 ff ff       	call   80199b <fd2num>
+  802217:	89 c3                	mov    %eax,%ebx
+  802219:	83 c4 10             	add    $0x10,%esp
+}
+  80221c:	89 d8                	mov    %ebx,%eax
+  80221e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802221:	5b                   	pop    %ebx
+  802222:	5e                   	pop    %esi
+  802223:	5d                   	pop    %ebp
+  802224:	c3                   	ret
+		fd_close(fd, 0);
+  802225:	83 ec 08             	sub    $0x8,%esp
+  802228:	6a 00                	push   $0x0
+  80222a:	ff 75 f4             	push   -0xc(%ebp)
+  80222d:	e8 80 f8 ff ff       	call   801ab2 <fd_close>
+		return r;
+  802232:	83 c4 10             	add    $0x10,%esp
+  802235:	eb e5                	jmp    80221c <open+0x6c>
+		return -E_BAD_PATH;
+  802237:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80223c:	eb de                	jmp    80221c <open+0x6c>
+
+0080223e <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80223e:	55                   	push   %ebp
+  80223f:	89 e5                	mov    %esp,%ebp
+  802241:	53                   	push   %ebx
+  802242:	83 ec 10             	sub    $0x10,%esp
+  802245:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802248:	53                   	push   %ebx
+  802249:	e8 d0 e6 ff ff       	call   80091e <strlen>
+  80224e:	83 c4 10             	add    $0x10,%esp
+  802251:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802256:	7f 25                	jg     80227d <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802258:	83 ec 08             	sub    $0x8,%esp
+  80225b:	53                   	push   %ebx
+  80225c:	68 00 00 81 00       	push   $0x810000
+  802261:	e8 f3 e6 ff ff       	call   800959 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802266:	ba 00 00 00 00       	mov    $0x0,%edx
+  80226b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802270:	e8 05 fd ff ff       	call   801f7a <fsipc>
+  802275:	83 c4 10             	add    $0x10,%esp
+}
+  802278:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80227b:	c9                   	leave
+  80227c:	c3                   	ret
+		return -E_BAD_PATH;
+  80227d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802282:	eb f4                	jmp    802278 <remove+0x3a>
+
+00802284 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802284:	55                   	push   %ebp
+  802285:	89 e5                	mov    %esp,%ebp
+  802287:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80228a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80228f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802294:	e8 e1 fc ff ff       	call   801f7a <fsipc>
+}
+  802299:	c9                   	leave
+  80229a:	c3                   	ret
+
+0080229b <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  80229b:	55                   	push   %ebp
+  80229c:	89 e5                	mov    %esp,%ebp
+  80229e:	53                   	push   %ebx
+  80229f:	83 ec 04             	sub    $0x4,%esp
+  8022a2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  8022a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022aa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8022af:	e8 c6 fc ff ff       	call   801f7a <fsipc>
+  8022b4:	85 c0                	test   %eax,%eax
+  8022b6:	78 3c                	js     8022f4 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  8022b8:	a1 00 00 81 00       	mov    0x810000,%eax
+  8022bd:	89 03                	mov    %eax,(%ebx)
+  8022bf:	a1 04 00 81 00       	mov    0x810004,%eax
+  8022c4:	89 43 04             	mov    %eax,0x4(%ebx)
+  8022c7:	a1 08 00 81 00       	mov    0x810008,%eax
+  8022cc:	89 43 08             	mov    %eax,0x8(%ebx)
+  8022cf:	a1 0c 00 81 00       	mov    0x81000c,%eax
+  8022d4:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8022d7:	a1 10 00 81 00       	mov    0x810010,%eax
+  8022dc:	89 43 10             	mov    %eax,0x10(%ebx)
+  8022df:	a1 14 00 81 00       	mov    0x810014,%eax
+  8022e4:	89 43 14             	mov    %eax,0x14(%ebx)
+  8022e7:	a1 18 00 81 00       	mov    0x810018,%eax
+  8022ec:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  8022ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022f7:	c9                   	leave
+  8022f8:	c3                   	ret
+
+008022f9 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  8022f9:	55                   	push   %ebp
+  8022fa:	89 e5                	mov    %esp,%ebp
+  8022fc:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  8022ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802302:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_BCSET, NULL);
+  802307:	ba 00 00 00 00       	mov    $0x0,%edx
+  80230c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802311:	e8 64 fc ff ff       	call   801f7a <fsipc>
+}
+  802316:	c9                   	leave
+  802317:	c3                   	ret
+
+00802318 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802318:	55                   	push   %ebp
+  802319:	89 e5                	mov    %esp,%ebp
+  80231b:	56                   	push   %esi
+  80231c:	53                   	push   %ebx
+  80231d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802320:	83 ec 0c             	sub    $0xc,%esp
+  802323:	ff 75 08             	push   0x8(%ebp)
+  802326:	e8 80 f6 ff ff       	call   8019ab <fd2data>
+  80232b:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80232d:	83 c4 08             	add    $0x8,%esp
+  802330:	68 12 5b 80 00       	push   $0x805b12
+  802335:	53                   	push   %ebx
+  802336:	e8 1e e6 ff ff       	call   800959 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80233b:	8b 46 04             	mov    0x4(%esi),%eax
+  80233e:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  802344:	2b 0e                	sub    (%esi),%ecx
+  802346:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80234b:	89 c8                	mov    %ecx,%eax
+  80234d:	f7 e2                	mul    %edx
+  80234f:	c1 ea 0c             	shr    $0xc,%edx
+  802352:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802358:	29 d1                	sub    %edx,%ecx
+  80235a:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  802360:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802367:	00 00 00 
+	stat->st_dev = &devpipe;
+  80236a:	c7 83 88 00 00 00 20 	movl   $0x807020,0x88(%ebx)
+  802371:	70 80 00 
+	return 0;
+}
+  802374:	b8 00 00 00 00       	mov    $0x0,%eax
+  802379:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80237c:	5b                   	pop    %ebx
+  80237d:	5e                   	pop    %esi
+  80237e:	5d                   	pop    %ebp
+  80237f:	c3                   	ret
+
+00802380 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802380:	55                   	push   %ebp
+  802381:	89 e5                	mov    %esp,%ebp
+  802383:	53                   	push   %ebx
+  802384:	83 ec 0c             	sub    $0xc,%esp
+  802387:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80238a:	53                   	push   %ebx
+  80238b:	6a 00                	push   $0x0
+  80238d:	e8 3f eb ff ff       	call   800ed1 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802392:	89 1c 24             	mov    %ebx,(%esp)
+  802395:	e8 11 f6 ff ff       	call   8019ab <fd2data>
+  80239a:	83 c4 08             	add    $0x8,%esp
+  80239d:	50                   	push   %eax
+  80239e:	6a 00                	push   $0x0
+  8023a0:	e8 2c eb ff ff       	call   800ed1 <sys_page_unmap>
+}
+  8023a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023a8:	c9                   	leave
+  8023a9:	c3                   	ret
+
+008023aa <_pipeisclosed>:
+{
+  8023aa:	55                   	push   %ebp
+  8023ab:	89 e5                	mov    %esp,%ebp
+  8023ad:	57                   	push   %edi
+  8023ae:	56                   	push   %esi
+  8023af:	53                   	push   %ebx
+  8023b0:	83 ec 1c             	sub    $0x1c,%esp
+  8023b3:	89 c7                	mov    %eax,%edi
+  8023b5:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8023b7:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8023bc:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8023bf:	83 ec 0c             	sub    $0xc,%esp
+  8023c2:	57                   	push   %edi
+  8023c3:	e8 72 2e 00 00       	call   80523a <pageref>
+  8023c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8023cb:	89 34 24             	mov    %esi,(%esp)
+  8023ce:	e8 67 2e 00 00       	call   80523a <pageref>
+		nn = thisenv->env_runs;
+  8023d3:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  8023d9:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8023dc:	83 c4 10             	add    $0x10,%esp
+  8023df:	39 cb                	cmp    %ecx,%ebx
+  8023e1:	74 1b                	je     8023fe <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8023e3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8023e6:	75 cf                	jne    8023b7 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8023e8:	8b 42 58             	mov    0x58(%edx),%eax
+  8023eb:	6a 01                	push   $0x1
+  8023ed:	50                   	push   %eax
+  8023ee:	53                   	push   %ebx
+  8023ef:	68 19 5b 80 00       	push   $0x805b19
+  8023f4:	e8 79 df ff ff       	call   800372 <cprintf>
+  8023f9:	83 c4 10             	add    $0x10,%esp
+  8023fc:	eb b9                	jmp    8023b7 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8023fe:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802401:	0f 94 c0             	sete   %al
+  802404:	0f b6 c0             	movzbl %al,%eax
+}
+  802407:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80240a:	5b                   	pop    %ebx
+  80240b:	5e                   	pop    %esi
+  80240c:	5f                   	pop    %edi
+  80240d:	5d                   	pop    %ebp
+  80240e:	c3                   	ret
+
+0080240f <devpipe_read>:
+{
+  80240f:	55                   	push   %ebp
+  802410:	89 e5                	mov    %esp,%ebp
+  802412:	57                   	push   %edi
+  802413:	56                   	push   %esi
+  802414:	53                   	push   %ebx
+  802415:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802418:	ff 75 08             	push   0x8(%ebp)
+  80241b:	e8 8b f5 ff ff       	call   8019ab <fd2data>
+  802420:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  802422:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  802425:	8d 40 04             	lea    0x4(%eax),%eax
+  802428:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80242b:	8b 7b 04             	mov    0x4(%ebx),%edi
+  80242e:	8b 0b                	mov    (%ebx),%ecx
+  802430:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  802436:	29 ce                	sub    %ecx,%esi
+  802438:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80243d:	f7 e6                	mul    %esi
+  80243f:	c1 ea 0c             	shr    $0xc,%edx
+  802442:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  802448:	29 c6                	sub    %eax,%esi
+  80244a:	89 f2                	mov    %esi,%edx
+  80244c:	75 43                	jne    802491 <devpipe_read+0x82>
+		ref = pageref(p);
+  80244e:	83 ec 0c             	sub    $0xc,%esp
+  802451:	53                   	push   %ebx
+  802452:	e8 e3 2d 00 00       	call   80523a <pageref>
+  802457:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  802459:	89 da                	mov    %ebx,%edx
+  80245b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80245e:	e8 47 ff ff ff       	call   8023aa <_pipeisclosed>
+  802463:	83 c4 10             	add    $0x10,%esp
+  802466:	85 c0                	test   %eax,%eax
+  802468:	0f 85 c1 00 00 00    	jne    80252f <devpipe_read+0x120>
+	*sleeping = 1;
+  80246e:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  802475:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80247a:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  80247d:	75 ac                	jne    80242b <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  80247f:	83 ec 04             	sub    $0x4,%esp
+  802482:	56                   	push   %esi
+  802483:	57                   	push   %edi
+  802484:	ff 75 e4             	push   -0x1c(%ebp)
+  802487:	e8 99 ee ff ff       	call   801325 <sys_futex_wait>
+  80248c:	83 c4 10             	add    $0x10,%esp
+  80248f:	eb 9a                	jmp    80242b <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  802491:	39 75 10             	cmp    %esi,0x10(%ebp)
+  802494:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  802498:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80249a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80249f:	f7 e1                	mul    %ecx
+  8024a1:	c1 ea 0b             	shr    $0xb,%edx
+  8024a4:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8024aa:	29 c1                	sub    %eax,%ecx
+  8024ac:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  8024ae:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8024b3:	29 cf                	sub    %ecx,%edi
+  8024b5:	39 f7                	cmp    %esi,%edi
+  8024b7:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  8024ba:	8d 43 10             	lea    0x10(%ebx),%eax
+  8024bd:	83 ec 04             	sub    $0x4,%esp
+  8024c0:	57                   	push   %edi
+  8024c1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024c4:	01 c2                	add    %eax,%edx
+  8024c6:	52                   	push   %edx
+  8024c7:	ff 75 0c             	push   0xc(%ebp)
+  8024ca:	e8 10 e6 ff ff       	call   800adf <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  8024cf:	83 c4 0c             	add    $0xc,%esp
+  8024d2:	89 f1                	mov    %esi,%ecx
+  8024d4:	29 f9                	sub    %edi,%ecx
+  8024d6:	51                   	push   %ecx
+  8024d7:	ff 75 e4             	push   -0x1c(%ebp)
+  8024da:	89 f8                	mov    %edi,%eax
+  8024dc:	03 45 0c             	add    0xc(%ebp),%eax
+  8024df:	50                   	push   %eax
+  8024e0:	e8 fa e5 ff ff       	call   800adf <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  8024e5:	89 f1                	mov    %esi,%ecx
+  8024e7:	03 0b                	add    (%ebx),%ecx
+  8024e9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8024ee:	f7 e1                	mul    %ecx
+  8024f0:	c1 ea 0c             	shr    $0xc,%edx
+  8024f3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8024f9:	29 d1                	sub    %edx,%ecx
+  8024fb:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  8024fd:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802502:	83 c4 10             	add    $0x10,%esp
+  802505:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  802509:	75 0a                	jne    802515 <devpipe_read+0x106>
+	return n;
+  80250b:	89 f0                	mov    %esi,%eax
+}
+  80250d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802510:	5b                   	pop    %ebx
+  802511:	5e                   	pop    %esi
+  802512:	5f                   	pop    %edi
+  802513:	5d                   	pop    %ebp
+  802514:	c3                   	ret
+		*sleeping = 0;
+  802515:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  80251c:	83 ec 08             	sub    $0x8,%esp
+  80251f:	68 00 04 00 00       	push   $0x400
+  802524:	53                   	push   %ebx
+  802525:	e8 4b ee ff ff       	call   801375 <sys_futex_wake>
+  80252a:	83 c4 10             	add    $0x10,%esp
+  80252d:	eb dc                	jmp    80250b <devpipe_read+0xfc>
+			return 0;
+  80252f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802534:	eb d7                	jmp    80250d <devpipe_read+0xfe>
+
+00802536 <devpipe_write>:
+{
+  802536:	55                   	push   %ebp
+  802537:	89 e5                	mov    %esp,%ebp
+  802539:	57                   	push   %edi
+  80253a:	56                   	push   %esi
+  80253b:	53                   	push   %ebx
+  80253c:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80253f:	ff 75 08             	push   0x8(%ebp)
+  802542:	e8 64 f4 ff ff       	call   8019ab <fd2data>
+  802547:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  802549:	83 c4 10             	add    $0x10,%esp
+  80254c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802553:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802556:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802559:	0f 83 23 01 00 00    	jae    802682 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80255f:	8b 77 04             	mov    0x4(%edi),%esi
+  802562:	8b 1f                	mov    (%edi),%ebx
+  802564:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  80256a:	29 d9                	sub    %ebx,%ecx
+  80256c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802571:	f7 e1                	mul    %ecx
+  802573:	c1 ea 0c             	shr    $0xc,%edx
+  802576:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80257c:	29 c1                	sub    %eax,%ecx
+  80257e:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802580:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802586:	75 40                	jne    8025c8 <devpipe_write+0x92>
+			ref = pageref(p);
+  802588:	83 ec 0c             	sub    $0xc,%esp
+  80258b:	57                   	push   %edi
+  80258c:	e8 a9 2c 00 00       	call   80523a <pageref>
+  802591:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  802593:	89 fa                	mov    %edi,%edx
+  802595:	8b 45 08             	mov    0x8(%ebp),%eax
+  802598:	e8 0d fe ff ff       	call   8023aa <_pipeisclosed>
+  80259d:	83 c4 10             	add    $0x10,%esp
+  8025a0:	85 c0                	test   %eax,%eax
+  8025a2:	0f 85 d5 00 00 00    	jne    80267d <devpipe_write+0x147>
+	*sleeping = 1;
+  8025a8:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  8025af:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8025b4:	39 1f                	cmp    %ebx,(%edi)
+  8025b6:	75 a7                	jne    80255f <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  8025b8:	83 ec 04             	sub    $0x4,%esp
+  8025bb:	56                   	push   %esi
+  8025bc:	53                   	push   %ebx
+  8025bd:	57                   	push   %edi
+  8025be:	e8 62 ed ff ff       	call   801325 <sys_futex_wait>
+  8025c3:	83 c4 10             	add    $0x10,%esp
+  8025c6:	eb 97                	jmp    80255f <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8025c8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8025cb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025ce:	29 c1                	sub    %eax,%ecx
+  8025d0:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8025d5:	89 d8                	mov    %ebx,%eax
+  8025d7:	29 d0                	sub    %edx,%eax
+  8025d9:	39 c1                	cmp    %eax,%ecx
+  8025db:	0f 46 c1             	cmovbe %ecx,%eax
+  8025de:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  8025e0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8025e5:	f7 e6                	mul    %esi
+  8025e7:	c1 ea 0b             	shr    $0xb,%edx
+  8025ea:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8025f0:	29 c6                	sub    %eax,%esi
+  8025f2:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8025f4:	29 f3                	sub    %esi,%ebx
+  8025f6:	39 cb                	cmp    %ecx,%ebx
+  8025f8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8025fb:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  8025fe:	8d 77 10             	lea    0x10(%edi),%esi
+  802601:	83 ec 04             	sub    $0x4,%esp
+  802604:	53                   	push   %ebx
+  802605:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802608:	03 45 0c             	add    0xc(%ebp),%eax
+  80260b:	50                   	push   %eax
+  80260c:	01 f2                	add    %esi,%edx
+  80260e:	52                   	push   %edx
+  80260f:	e8 cb e4 ff ff       	call   800adf <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802614:	83 c4 0c             	add    $0xc,%esp
+  802617:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80261a:	29 d8                	sub    %ebx,%eax
+  80261c:	50                   	push   %eax
+  80261d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802620:	01 d3                	add    %edx,%ebx
+  802622:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802625:	53                   	push   %ebx
+  802626:	56                   	push   %esi
+  802627:	e8 b3 e4 ff ff       	call   800adf <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  80262c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80262f:	03 4f 04             	add    0x4(%edi),%ecx
+  802632:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802637:	f7 e1                	mul    %ecx
+  802639:	c1 ea 0c             	shr    $0xc,%edx
+  80263c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802642:	29 d1                	sub    %edx,%ecx
+  802644:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  802647:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80264c:	83 c4 10             	add    $0x10,%esp
+  80264f:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802653:	75 0b                	jne    802660 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802655:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  802658:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80265b:	e9 f3 fe ff ff       	jmp    802553 <devpipe_write+0x1d>
+		*sleeping = 0;
+  802660:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  802667:	83 ec 08             	sub    $0x8,%esp
+  80266a:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  80266f:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802672:	50                   	push   %eax
+  802673:	e8 fd ec ff ff       	call   801375 <sys_futex_wake>
+  802678:	83 c4 10             	add    $0x10,%esp
+  80267b:	eb d8                	jmp    802655 <devpipe_write+0x11f>
+				return 0;
+  80267d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802682:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802685:	5b                   	pop    %ebx
+  802686:	5e                   	pop    %esi
+  802687:	5f                   	pop    %edi
+  802688:	5d                   	pop    %ebp
+  802689:	c3                   	ret
+
+0080268a <pipe>:
+{
+  80268a:	55                   	push   %ebp
+  80268b:	89 e5                	mov    %esp,%ebp
+  80268d:	56                   	push   %esi
+  80268e:	53                   	push   %ebx
+  80268f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802692:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802695:	50                   	push   %eax
+  802696:	e8 27 f3 ff ff       	call   8019c2 <fd_alloc>
+  80269b:	89 c3                	mov    %eax,%ebx
+  80269d:	83 c4 10             	add    $0x10,%esp
+  8026a0:	85 c0                	test   %eax,%eax
+  8026a2:	0f 88 23 01 00 00    	js     8027cb <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026a8:	83 ec 04             	sub    $0x4,%esp
+  8026ab:	68 07 04 00 00       	push   $0x407
+  8026b0:	ff 75 f4             	push   -0xc(%ebp)
+  8026b3:	6a 00                	push   $0x0
+  8026b5:	e8 92 e7 ff ff       	call   800e4c <sys_page_alloc>
+  8026ba:	89 c3                	mov    %eax,%ebx
+  8026bc:	83 c4 10             	add    $0x10,%esp
+  8026bf:	85 c0                	test   %eax,%eax
+  8026c1:	0f 88 04 01 00 00    	js     8027cb <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026c7:	83 ec 0c             	sub    $0xc,%esp
+  8026ca:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026cd:	50                   	push   %eax
+  8026ce:	e8 ef f2 ff ff       	call   8019c2 <fd_alloc>
+  8026d3:	89 c3                	mov    %eax,%ebx
+  8026d5:	83 c4 10             	add    $0x10,%esp
+  8026d8:	85 c0                	test   %eax,%eax
+  8026da:	0f 88 db 00 00 00    	js     8027bb <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026e0:	83 ec 04             	sub    $0x4,%esp
+  8026e3:	68 07 04 00 00       	push   $0x407
+  8026e8:	ff 75 f0             	push   -0x10(%ebp)
+  8026eb:	6a 00                	push   $0x0
+  8026ed:	e8 5a e7 ff ff       	call   800e4c <sys_page_alloc>
+  8026f2:	89 c3                	mov    %eax,%ebx
+  8026f4:	83 c4 10             	add    $0x10,%esp
+  8026f7:	85 c0                	test   %eax,%eax
+  8026f9:	0f 88 bc 00 00 00    	js     8027bb <pipe+0x131>
+	va = fd2data(fd0);
+  8026ff:	83 ec 0c             	sub    $0xc,%esp
+  802702:	ff 75 f4             	push   -0xc(%ebp)
+  802705:	e8 a1 f2 ff ff       	call   8019ab <fd2data>
+  80270a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80270c:	83 c4 0c             	add    $0xc,%esp
+  80270f:	68 07 04 00 00       	push   $0x407
+  802714:	50                   	push   %eax
+  802715:	6a 00                	push   $0x0
+  802717:	e8 30 e7 ff ff       	call   800e4c <sys_page_alloc>
+  80271c:	89 c3                	mov    %eax,%ebx
+  80271e:	83 c4 10             	add    $0x10,%esp
+  802721:	85 c0                	test   %eax,%eax
+  802723:	0f 88 82 00 00 00    	js     8027ab <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802729:	83 ec 0c             	sub    $0xc,%esp
+  80272c:	ff 75 f0             	push   -0x10(%ebp)
+  80272f:	e8 77 f2 ff ff       	call   8019ab <fd2data>
+  802734:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80273b:	50                   	push   %eax
+  80273c:	6a 00                	push   $0x0
+  80273e:	56                   	push   %esi
+  80273f:	6a 00                	push   $0x0
+  802741:	e8 49 e7 ff ff       	call   800e8f <sys_page_map>
+  802746:	89 c3                	mov    %eax,%ebx
+  802748:	83 c4 20             	add    $0x20,%esp
+  80274b:	85 c0                	test   %eax,%eax
+  80274d:	78 4e                	js     80279d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80274f:	a1 20 70 80 00       	mov    0x807020,%eax
+  802754:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802757:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802759:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80275c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802763:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802766:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802768:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80276b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802772:	83 ec 0c             	sub    $0xc,%esp
+  802775:	ff 75 f4             	push   -0xc(%ebp)
+  802778:	e8 1e f2 ff ff       	call   80199b <fd2num>
+  80277d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802780:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802782:	83 c4 04             	add    $0x4,%esp
+  802785:	ff 75 f0             	push   -0x10(%ebp)
+  802788:	e8 0e f2 ff ff       	call   80199b <fd2num>
+  80278d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802790:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802793:	83 c4 10             	add    $0x10,%esp
+  802796:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80279b:	eb 2e                	jmp    8027cb <pipe+0x141>
+	sys_page_unmap(0, va);
+  80279d:	83 ec 08             	sub    $0x8,%esp
+  8027a0:	56                   	push   %esi
+  8027a1:	6a 00                	push   $0x0
+  8027a3:	e8 29 e7 ff ff       	call   800ed1 <sys_page_unmap>
+  8027a8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027ab:	83 ec 08             	sub    $0x8,%esp
+  8027ae:	ff 75 f0             	push   -0x10(%ebp)
+  8027b1:	6a 00                	push   $0x0
+  8027b3:	e8 19 e7 ff ff       	call   800ed1 <sys_page_unmap>
+  8027b8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027bb:	83 ec 08             	sub    $0x8,%esp
+  8027be:	ff 75 f4             	push   -0xc(%ebp)
+  8027c1:	6a 00                	push   $0x0
+  8027c3:	e8 09 e7 ff ff       	call   800ed1 <sys_page_unmap>
+  8027c8:	83 c4 10             	add    $0x10,%esp
+}
+  8027cb:	89 d8                	mov    %ebx,%eax
+  8027cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027d0:	5b                   	pop    %ebx
+  8027d1:	5e                   	pop    %esi
+  8027d2:	5d                   	pop    %ebp
+  8027d3:	c3                   	ret
+
+008027d4 <pipeisclosed>:
+{
+  8027d4:	55                   	push   %ebp
+  8027d5:	89 e5                	mov    %esp,%ebp
+  8027d7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027dd:	50                   	push   %eax
+  8027de:	ff 75 08             	push   0x8(%ebp)
+  8027e1:	e8 30 f2 ff ff       	call   801a16 <fd_lookup>
+  8027e6:	83 c4 10             	add    $0x10,%esp
+  8027e9:	85 c0                	test   %eax,%eax
+  8027eb:	78 18                	js     802805 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8027ed:	83 ec 0c             	sub    $0xc,%esp
+  8027f0:	ff 75 f4             	push   -0xc(%ebp)
+  8027f3:	e8 b3 f1 ff ff       	call   8019ab <fd2data>
+  8027f8:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8027fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027fd:	e8 a8 fb ff ff       	call   8023aa <_pipeisclosed>
+  802802:	83 c4 10             	add    $0x10,%esp
+}
+  802805:	c9                   	leave
+  802806:	c3                   	ret
+
+00802807 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  802807:	55                   	push   %ebp
+  802808:	89 e5                	mov    %esp,%ebp
+  80280a:	57                   	push   %edi
+  80280b:	56                   	push   %esi
+  80280c:	53                   	push   %ebx
+  80280d:	83 ec 0c             	sub    $0xc,%esp
+  802810:	8b 7d 08             	mov    0x8(%ebp),%edi
+	const volatile struct Env *e;
+	unsigned status;
+
+	assert(envid != 0);
+  802813:	85 ff                	test   %edi,%edi
+  802815:	74 21                	je     802838 <wait+0x31>
+	e = &envs[ENVX(envid)];
+  802817:	89 f8                	mov    %edi,%eax
+  802819:	25 ff 03 00 00       	and    $0x3ff,%eax
+	// The kernel wakes us when it frees the environment.  Until then
+	// we sleep, unless its status changed since we looked.
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  80281e:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  802821:	c1 e6 06             	shl    $0x6,%esi
+  802824:	81 c6 54 00 c0 ee    	add    $0xeec00054,%esi
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  80282a:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  80282d:	c1 e3 06             	shl    $0x6,%ebx
+  802830:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  802836:	eb 25                	jmp    80285d <wait+0x56>
+	assert(envid != 0);
+  802838:	68 31 5b 80 00       	push   $0x805b31
+  80283d:	68 e3 54 80 00       	push   $0x8054e3
+  802842:	6a 0a                	push   $0xa
+  802844:	68 3c 5b 80 00       	push   $0x805b3c
+  802849:	e8 49 da ff ff       	call   800297 <_panic>
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  80284e:	83 ec 04             	sub    $0x4,%esp
+  802851:	6a ff                	push   $0xffffffff
+  802853:	50                   	push   %eax
+  802854:	56                   	push   %esi
+  802855:	e8 cb ea ff ff       	call   801325 <sys_futex_wait>
+  80285a:	83 c4 10             	add    $0x10,%esp
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  80285d:	8b 43 48             	mov    0x48(%ebx),%eax
+  802860:	39 f8                	cmp    %edi,%eax
+  802862:	75 07                	jne    80286b <wait+0x64>
+  802864:	8b 43 54             	mov    0x54(%ebx),%eax
+  802867:	85 c0                	test   %eax,%eax
+  802869:	75 e3                	jne    80284e <wait+0x47>
+}
+  80286b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80286e:	5b                   	pop    %ebx
+  80286f:	5e                   	pop    %esi
+  802870:	5f                   	pop    %edi
+  802871:	5d                   	pop    %ebp
+  802872:	c3                   	ret
+
+00802873 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802873:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802875:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  80287b:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802881:	81 c2 34 01 00 00    	add    $0x134,%edx
+  802887:	39 d0                	cmp    %edx,%eax
+  802889:	74 2e                	je     8028b9 <segment_lookup+0x46>
+{
+  80288b:	55                   	push   %ebp
+  80288c:	89 e5                	mov    %esp,%ebp
+  80288e:	57                   	push   %edi
+  80288f:	56                   	push   %esi
+  802890:	53                   	push   %ebx
+  802891:	eb 07                	jmp    80289a <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802893:	83 c0 20             	add    $0x20,%eax
+  802896:	39 d0                	cmp    %edx,%eax
+  802898:	74 15                	je     8028af <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  80289a:	8b 18                	mov    (%eax),%ebx
+  80289c:	39 d9                	cmp    %ebx,%ecx
+  80289e:	72 f3                	jb     802893 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  8028a0:	8b 38                	mov    (%eax),%edi
+  8028a2:	8b 58 04             	mov    0x4(%eax),%ebx
+  8028a5:	89 ce                	mov    %ecx,%esi
+  8028a7:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  8028a9:	39 de                	cmp    %ebx,%esi
+  8028ab:	73 e6                	jae    802893 <segment_lookup+0x20>
+  8028ad:	eb 05                	jmp    8028b4 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  8028af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028b4:	5b                   	pop    %ebx
+  8028b5:	5e                   	pop    %esi
+  8028b6:	5f                   	pop    %edi
+  8028b7:	5d                   	pop    %ebp
+  8028b8:	c3                   	ret
+	return NULL;
+  8028b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028be:	c3                   	ret
+
+008028bf <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  8028bf:	55                   	push   %ebp
+  8028c0:	89 e5                	mov    %esp,%ebp
+  8028c2:	53                   	push   %ebx
+  8028c3:	83 ec 04             	sub    $0x4,%esp
+  8028c6:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8028c8:	c1 e8 16             	shr    $0x16,%eax
+  8028cb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8028d2:	25 81 00 00 00       	and    $0x81,%eax
+  8028d7:	83 f8 01             	cmp    $0x1,%eax
+  8028da:	75 6b                	jne    802947 <page_is_clean+0x88>
+  8028dc:	89 da                	mov    %ebx,%edx
+  8028de:	c1 ea 0c             	shr    $0xc,%edx
+  8028e1:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  8028e8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8028ed:	f6 c1 01             	test   $0x1,%cl
+  8028f0:	74 5a                	je     80294c <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  8028f2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8028f9:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  8028ff:	75 4b                	jne    80294c <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  802901:	89 d8                	mov    %ebx,%eax
+  802903:	e8 6b ff ff ff       	call   802873 <segment_lookup>
+  802908:	89 c2                	mov    %eax,%edx
+		return 1;
+  80290a:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  80290f:	85 d2                	test   %edx,%edx
+  802911:	75 39                	jne    80294c <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  802913:	8b 15 0c c0 80 00    	mov    0x80c00c,%edx
+  802919:	b8 00 00 00 00       	mov    $0x0,%eax
+  80291e:	eb 03                	jmp    802923 <page_is_clean+0x64>
+  802920:	83 c0 01             	add    $0x1,%eax
+  802923:	39 c2                	cmp    %eax,%edx
+  802925:	7e 19                	jle    802940 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  802927:	3b 1c c5 20 c0 80 00 	cmp    0x80c020(,%eax,8),%ebx
+  80292e:	72 f0                	jb     802920 <page_is_clean+0x61>
+  802930:	3b 1c c5 24 c0 80 00 	cmp    0x80c024(,%eax,8),%ebx
+  802937:	73 e7                	jae    802920 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  802939:	b8 01 00 00 00       	mov    $0x1,%eax
+  80293e:	eb 0c                	jmp    80294c <page_is_clean+0x8d>
+	return 0;
+  802940:	b8 00 00 00 00       	mov    $0x0,%eax
+  802945:	eb 05                	jmp    80294c <page_is_clean+0x8d>
+		return 0;
+  802947:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80294c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80294f:	c9                   	leave
+  802950:	c3                   	ret
+
+00802951 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  802951:	55                   	push   %ebp
+  802952:	89 e5                	mov    %esp,%ebp
+  802954:	57                   	push   %edi
+  802955:	56                   	push   %esi
+  802956:	53                   	push   %ebx
+  802957:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80295a:	be 00 00 00 00       	mov    $0x0,%esi
+  80295f:	eb 19                	jmp    80297a <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802961:	f7 d3                	not    %ebx
+  802963:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802969:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80296b:	83 c6 01             	add    $0x1,%esi
+  80296e:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802974:	0f 87 97 00 00 00    	ja     802a11 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80297a:	89 f3                	mov    %esi,%ebx
+  80297c:	03 1d 34 90 80 00    	add    0x809034,%ebx
+  802982:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802988:	89 d8                	mov    %ebx,%eax
+  80298a:	c1 e8 0a             	shr    $0xa,%eax
+  80298d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802994:	25 81 00 00 00       	and    $0x81,%eax
+  802999:	83 f8 01             	cmp    $0x1,%eax
+  80299c:	75 c3                	jne    802961 <linear_walk+0x10>
+  80299e:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8029a4:	77 bb                	ja     802961 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8029a6:	89 df                	mov    %ebx,%edi
+  8029a8:	c1 e7 0c             	shl    $0xc,%edi
+  8029ab:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8029ae:	89 f8                	mov    %edi,%eax
+  8029b0:	e8 0a ff ff ff       	call   8028bf <page_is_clean>
+  8029b5:	84 c0                	test   %al,%al
+  8029b7:	75 64                	jne    802a1d <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8029b9:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  8029bf:	77 aa                	ja     80296b <linear_walk+0x1a>
+  8029c1:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  8029c7:	72 a2                	jb     80296b <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8029c9:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8029d0:	a8 01                	test   $0x1,%al
+  8029d2:	74 97                	je     80296b <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8029d4:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8029db:	f6 c4 04             	test   $0x4,%ah
+  8029de:	75 8b                	jne    80296b <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8029e0:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8029e7:	f6 c4 02             	test   $0x2,%ah
+  8029ea:	0f 85 7b ff ff ff    	jne    80296b <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8029f0:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8029f7:	c1 e8 0c             	shr    $0xc,%eax
+  8029fa:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8029fd:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802a02:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802a06:	66 83 f8 01          	cmp    $0x1,%ax
+  802a0a:	76 11                	jbe    802a1d <linear_walk+0xcc>
+  802a0c:	e9 5a ff ff ff       	jmp    80296b <linear_walk+0x1a>
+  802a11:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  802a16:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802a1d:	89 1d 34 90 80 00    	mov    %ebx,0x809034
+}
+  802a23:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a26:	83 c4 1c             	add    $0x1c,%esp
+  802a29:	5b                   	pop    %ebx
+  802a2a:	5e                   	pop    %esi
+  802a2b:	5f                   	pop    %edi
+  802a2c:	5d                   	pop    %ebp
+  802a2d:	c3                   	ret
+
+00802a2e <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802a2e:	55                   	push   %ebp
+  802a2f:	89 e5                	mov    %esp,%ebp
+  802a31:	56                   	push   %esi
+  802a32:	53                   	push   %ebx
+  802a33:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  802a35:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802a3a:	83 e0 7f             	and    $0x7f,%eax
+  802a3d:	c1 e0 04             	shl    $0x4,%eax
+  802a40:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  802a46:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802a4c:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802a52:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  802a58:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802a5d:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  802a60:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802a65:	83 c0 01             	add    $0x1,%eax
+  802a68:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  802a6d:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802a70:	5b                   	pop    %ebx
+  802a71:	5e                   	pop    %esi
+  802a72:	5d                   	pop    %ebp
+  802a73:	c3                   	ret
+
+00802a74 <page_ring_enter>:
+{
+  802a74:	55                   	push   %ebp
+  802a75:	89 e5                	mov    %esp,%ebp
+  802a77:	57                   	push   %edi
+  802a78:	56                   	push   %esi
+  802a79:	53                   	push   %ebx
+  802a7a:	83 ec 18             	sub    $0x18,%esp
+  802a7d:	89 c6                	mov    %eax,%esi
+  802a7f:	89 d7                	mov    %edx,%edi
+  802a81:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802a83:	6a 00                	push   $0x0
+  802a85:	6a 00                	push   $0x0
+  802a87:	6a 00                	push   $0x0
+  802a89:	6a 07                	push   $0x7
+  802a8b:	ff 35 40 c0 80 00    	push   0x80c040
+  802a91:	e8 8e 26 00 00       	call   805124 <ipc_call>
+  802a96:	83 c4 20             	add    $0x20,%esp
+  802a99:	85 c0                	test   %eax,%eax
+  802a9b:	79 22                	jns    802abf <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802a9d:	50                   	push   %eax
+  802a9e:	68 47 5b 80 00       	push   $0x805b47
+  802aa3:	68 13 02 00 00       	push   $0x213
+  802aa8:	68 5b 5b 80 00       	push   $0x805b5b
+  802aad:	e8 e5 d7 ff ff       	call   800297 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802ab2:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802ab7:	83 c0 01             	add    $0x1,%eax
+  802aba:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802abf:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802ac5:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802aca:	39 c2                	cmp    %eax,%edx
+  802acc:	74 24                	je     802af2 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802ace:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802ad3:	83 e0 7f             	and    $0x7f,%eax
+  802ad6:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802add:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802ae4:	29 f0                	sub    %esi,%eax
+  802ae6:	39 d8                	cmp    %ebx,%eax
+  802ae8:	73 c8                	jae    802ab2 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802aea:	8b 52 04             	mov    0x4(%edx),%edx
+  802aed:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802af0:	eb c0                	jmp    802ab2 <page_ring_enter+0x3e>
+}
+  802af2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802af5:	5b                   	pop    %ebx
+  802af6:	5e                   	pop    %esi
+  802af7:	5f                   	pop    %edi
+  802af8:	5d                   	pop    %ebp
+  802af9:	c3                   	ret
+
+00802afa <page_ring_reserve>:
+{
+  802afa:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802afc:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802b01:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802b07:	29 d0                	sub    %edx,%eax
+  802b09:	ba 80 00 00 00       	mov    $0x80,%edx
+  802b0e:	29 ca                	sub    %ecx,%edx
+  802b10:	39 c2                	cmp    %eax,%edx
+  802b12:	72 01                	jb     802b15 <page_ring_reserve+0x1b>
+  802b14:	c3                   	ret
+{
+  802b15:	55                   	push   %ebp
+  802b16:	89 e5                	mov    %esp,%ebp
+  802b18:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802b1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b20:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b25:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b2a:	e8 45 ff ff ff       	call   802a74 <page_ring_enter>
+}
+  802b2f:	c9                   	leave
+  802b30:	c3                   	ret
+
+00802b31 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802b31:	55                   	push   %ebp
+  802b32:	89 e5                	mov    %esp,%ebp
+  802b34:	53                   	push   %ebx
+  802b35:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802b38:	6a 07                	push   $0x7
+  802b3a:	6a 01                	push   $0x1
+  802b3c:	89 c3                	mov    %eax,%ebx
+  802b3e:	c1 e3 0c             	shl    $0xc,%ebx
+  802b41:	8d 93 00 a0 80 00    	lea    0x80a000(%ebx),%edx
+  802b47:	52                   	push   %edx
+  802b48:	6a 04                	push   $0x4
+  802b4a:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  802b51:	e8 ce 25 00 00       	call   805124 <ipc_call>
+	sharereqs[i].nslots = 0;
+  802b56:	c7 83 00 a0 80 00 00 	movl   $0x0,0x80a000(%ebx)
+  802b5d:	00 00 00 
+	return r;
+}
+  802b60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b63:	c9                   	leave
+  802b64:	c3                   	ret
+
+00802b65 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802b65:	55                   	push   %ebp
+  802b66:	89 e5                	mov    %esp,%ebp
+  802b68:	56                   	push   %esi
+  802b69:	53                   	push   %ebx
+  802b6a:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802b6c:	c1 e8 10             	shr    $0x10,%eax
+  802b6f:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802b72:	89 c2                	mov    %eax,%edx
+  802b74:	c1 e2 0c             	shl    $0xc,%edx
+  802b77:	8b b2 00 a0 80 00    	mov    0x80a000(%edx),%esi
+  802b7d:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802b80:	89 9a 00 a0 80 00    	mov    %ebx,0x80a000(%edx)
+  802b86:	89 c2                	mov    %eax,%edx
+  802b88:	c1 e2 0a             	shl    $0xa,%edx
+  802b8b:	01 f2                	add    %esi,%edx
+  802b8d:	89 0c 95 04 a0 80 00 	mov    %ecx,0x80a004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802b94:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802b9a:	74 09                	je     802ba5 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802b9c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ba1:	5b                   	pop    %ebx
+  802ba2:	5e                   	pop    %esi
+  802ba3:	5d                   	pop    %ebp
+  802ba4:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802ba5:	e8 87 ff ff ff       	call   802b31 <page_share_send>
+  802baa:	eb f5                	jmp    802ba1 <page_share_slot+0x3c>
+
+00802bac <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802bac:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802bb1:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802bb4:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802bb9:	3b 15 00 c0 80 00    	cmp    0x80c000,%edx
+  802bbf:	74 09                	je     802bca <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802bc1:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  802bc6:	85 c0                	test   %eax,%eax
+  802bc8:	75 01                	jne    802bcb <page_ring_ready+0x1f>
+}
+  802bca:	c3                   	ret
+{
+  802bcb:	55                   	push   %ebp
+  802bcc:	89 e5                	mov    %esp,%ebp
+  802bce:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802bd1:	68 07 06 00 00       	push   $0x607
+  802bd6:	6a 08                	push   $0x8
+  802bd8:	68 00 30 ad de       	push   $0xdead3000
+  802bdd:	6a 00                	push   $0x0
+  802bdf:	e8 93 e3 ff ff       	call   800f77 <sys_page_alloc_range>
+  802be4:	83 c4 10             	add    $0x10,%esp
+  802be7:	83 f8 08             	cmp    $0x8,%eax
+  802bea:	74 1b                	je     802c07 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802bec:	83 ec 04             	sub    $0x4,%esp
+  802bef:	6a 08                	push   $0x8
+  802bf1:	68 00 30 ad de       	push   $0xdead3000
+  802bf6:	6a 00                	push   $0x0
+  802bf8:	e8 e8 e3 ff ff       	call   800fe5 <sys_page_unmap_range>
+		return 0;
+  802bfd:	83 c4 10             	add    $0x10,%esp
+  802c00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c05:	c9                   	leave
+  802c06:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802c07:	83 ec 0c             	sub    $0xc,%esp
+  802c0a:	68 07 04 00 00       	push   $0x407
+  802c0f:	6a 08                	push   $0x8
+  802c11:	68 00 30 ad de       	push   $0xdead3000
+  802c16:	6a 06                	push   $0x6
+  802c18:	ff 35 40 c0 80 00    	push   0x80c040
+  802c1e:	e8 01 25 00 00       	call   805124 <ipc_call>
+  802c23:	83 c4 20             	add    $0x20,%esp
+  802c26:	85 c0                	test   %eax,%eax
+  802c28:	78 14                	js     802c3e <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802c2a:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802c2f:	8b 40 48             	mov    0x48(%eax),%eax
+  802c32:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	return 1;
+  802c37:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c3c:	eb c7                	jmp    802c05 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802c3e:	83 ec 04             	sub    $0x4,%esp
+  802c41:	6a 08                	push   $0x8
+  802c43:	68 00 30 ad de       	push   $0xdead3000
+  802c48:	6a 00                	push   $0x0
+  802c4a:	e8 96 e3 ff ff       	call   800fe5 <sys_page_unmap_range>
+		return 0;
+  802c4f:	83 c4 10             	add    $0x10,%esp
+  802c52:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c57:	eb ac                	jmp    802c05 <page_ring_ready+0x59>
+
+00802c59 <page_remove_slot>:
+{
+  802c59:	55                   	push   %ebp
+  802c5a:	89 e5                	mov    %esp,%ebp
+  802c5c:	56                   	push   %esi
+  802c5d:	53                   	push   %ebx
+  802c5e:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802c60:	89 c6                	mov    %eax,%esi
+  802c62:	c1 ee 10             	shr    $0x10,%esi
+  802c65:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802c68:	8b 04 b5 44 c0 80 00 	mov    0x80c044(,%esi,4),%eax
+  802c6f:	39 05 40 c0 80 00    	cmp    %eax,0x80c040
+  802c75:	74 2a                	je     802ca1 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802c77:	83 ec 0c             	sub    $0xc,%esp
+  802c7a:	6a 00                	push   $0x0
+  802c7c:	6a 00                	push   $0x0
+  802c7e:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802c80:	c1 e3 04             	shl    $0x4,%ebx
+  802c83:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802c86:	53                   	push   %ebx
+  802c87:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  802c8e:	e8 91 24 00 00       	call   805124 <ipc_call>
+  802c93:	83 c4 20             	add    $0x20,%esp
+  802c96:	85 c0                	test   %eax,%eax
+  802c98:	78 2d                	js     802cc7 <page_remove_slot+0x6e>
+}
+  802c9a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c9d:	5b                   	pop    %ebx
+  802c9e:	5e                   	pop    %esi
+  802c9f:	5d                   	pop    %ebp
+  802ca0:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802ca1:	e8 06 ff ff ff       	call   802bac <page_ring_ready>
+  802ca6:	85 c0                	test   %eax,%eax
+  802ca8:	74 cd                	je     802c77 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802caa:	b8 01 00 00 00       	mov    $0x1,%eax
+  802caf:	e8 46 fe ff ff       	call   802afa <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802cb4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802cb9:	89 da                	mov    %ebx,%edx
+  802cbb:	b8 02 00 00 00       	mov    $0x2,%eax
+  802cc0:	e8 69 fd ff ff       	call   802a2e <page_ring_post>
+		return;
+  802cc5:	eb d3                	jmp    802c9a <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802cc7:	50                   	push   %eax
+  802cc8:	68 b4 5b 80 00       	push   $0x805bb4
+  802ccd:	68 ac 03 00 00       	push   $0x3ac
+  802cd2:	68 5b 5b 80 00       	push   $0x805b5b
+  802cd7:	e8 bb d5 ff ff       	call   800297 <_panic>
+
+00802cdc <find_paging_env>:
+	if(pagingenv)
+  802cdc:	a1 40 c0 80 00       	mov    0x80c040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802ce1:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802ce3:	85 c0                	test   %eax,%eax
+  802ce5:	74 05                	je     802cec <find_paging_env+0x10>
+  802ce7:	eb 56                	jmp    802d3f <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802ce9:	83 c0 01             	add    $0x1,%eax
+  802cec:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802cf1:	7f 47                	jg     802d3a <find_paging_env+0x5e>
+  802cf3:	83 f9 01             	cmp    $0x1,%ecx
+  802cf6:	7f 42                	jg     802d3a <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802cf8:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802cfb:	c1 e2 06             	shl    $0x6,%edx
+  802cfe:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802d04:	8b 52 50             	mov    0x50(%edx),%edx
+  802d07:	83 fa 02             	cmp    $0x2,%edx
+  802d0a:	75 dd                	jne    802ce9 <find_paging_env+0xd>
+  802d0c:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802d0f:	c1 e2 06             	shl    $0x6,%edx
+  802d12:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802d18:	8b 52 54             	mov    0x54(%edx),%edx
+  802d1b:	85 d2                	test   %edx,%edx
+  802d1d:	74 ca                	je     802ce9 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802d1f:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802d22:	c1 e2 06             	shl    $0x6,%edx
+  802d25:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802d2b:	8b 52 48             	mov    0x48(%edx),%edx
+  802d2e:	89 14 8d 44 c0 80 00 	mov    %edx,0x80c044(,%ecx,4)
+  802d35:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802d38:	eb af                	jmp    802ce9 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802d3a:	83 f9 02             	cmp    $0x2,%ecx
+  802d3d:	74 01                	je     802d40 <find_paging_env+0x64>
+}
+  802d3f:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802d40:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802d45:	8b 40 48             	mov    0x48(%eax),%eax
+  802d48:	83 e0 01             	and    $0x1,%eax
+  802d4b:	8b 04 85 44 c0 80 00 	mov    0x80c044(,%eax,4),%eax
+  802d52:	a3 40 c0 80 00       	mov    %eax,0x80c040
+  802d57:	eb e6                	jmp    802d3f <find_paging_env+0x63>
+
+00802d59 <page_add_backed>:
+{
+  802d59:	55                   	push   %ebp
+  802d5a:	89 e5                	mov    %esp,%ebp
+  802d5c:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802d5f:	a1 0c c0 80 00       	mov    0x80c00c,%eax
+  802d64:	83 f8 04             	cmp    $0x4,%eax
+  802d67:	74 35                	je     802d9e <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802d69:	89 d1                	mov    %edx,%ecx
+  802d6b:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802d71:	89 0c c5 20 c0 80 00 	mov    %ecx,0x80c020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802d78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d7b:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802d82:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802d88:	89 14 c5 24 c0 80 00 	mov    %edx,0x80c024(,%eax,8)
+	num_backed_ranges++;
+  802d8f:	83 c0 01             	add    $0x1,%eax
+  802d92:	a3 0c c0 80 00       	mov    %eax,0x80c00c
+	return 0;
+  802d97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d9c:	5d                   	pop    %ebp
+  802d9d:	c3                   	ret
+		return -E_NO_MEM;
+  802d9e:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802da3:	eb f7                	jmp    802d9c <page_add_backed+0x43>
+
+00802da5 <percentage_of_pgdir_to_walk>:
+{
+  802da5:	55                   	push   %ebp
+  802da6:	89 e5                	mov    %esp,%ebp
+  802da8:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802dab:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802daf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802db2:	db 45 fc             	fildl  -0x4(%ebp)
+  802db5:	d8 35 40 60 80 00    	fdivs  0x806040
+	return ret*ret;
+  802dbb:	d8 c8                	fmul   %st(0),%st
+}
+  802dbd:	c9                   	leave
+  802dbe:	c3                   	ret
+
+00802dbf <nfu_with_aging_page_choice_func>:
+{
+  802dbf:	55                   	push   %ebp
+  802dc0:	89 e5                	mov    %esp,%ebp
+  802dc2:	57                   	push   %edi
+  802dc3:	56                   	push   %esi
+  802dc4:	53                   	push   %ebx
+  802dc5:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802dc8:	8b 35 30 90 80 00    	mov    0x809030,%esi
+	float pct_to_walk = 1.0f;
+  802dce:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802dd0:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802dd5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dda:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802de1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de6:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802de9:	eb 18                	jmp    802e03 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802deb:	f7 d0                	not    %eax
+  802ded:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802df2:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802df4:	83 c2 01             	add    $0x1,%edx
+  802df7:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802dfd:	0f 87 13 01 00 00    	ja     802f16 <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802e03:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802e07:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802e0a:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802e0f:	89 c1                	mov    %eax,%ecx
+  802e11:	c1 e9 0a             	shr    $0xa,%ecx
+  802e14:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802e1b:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802e21:	83 f9 01             	cmp    $0x1,%ecx
+  802e24:	75 c5                	jne    802deb <nfu_with_aging_page_choice_func+0x2c>
+  802e26:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802e2b:	77 be                	ja     802deb <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802e2d:	89 c1                	mov    %eax,%ecx
+  802e2f:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802e32:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  802e38:	0f 82 a5 00 00 00    	jb     802ee3 <nfu_with_aging_page_choice_func+0x124>
+  802e3e:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802e44:	0f 87 99 00 00 00    	ja     802ee3 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802e4a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802e51:	f6 c1 01             	test   $0x1,%cl
+  802e54:	0f 84 89 00 00 00    	je     802ee3 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802e5a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802e61:	f6 c5 04             	test   $0x4,%ch
+  802e64:	75 7d                	jne    802ee3 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802e66:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802e6d:	f6 c5 02             	test   $0x2,%ch
+  802e70:	75 71                	jne    802ee3 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802e72:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802e79:	c1 e9 0c             	shr    $0xc,%ecx
+  802e7c:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802e7f:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802e85:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802e89:	66 83 f9 01          	cmp    $0x1,%cx
+  802e8d:	77 54                	ja     802ee3 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802e8f:	89 f9                	mov    %edi,%ecx
+  802e91:	80 f9 ff             	cmp    $0xff,%cl
+  802e94:	74 21                	je     802eb7 <nfu_with_aging_page_choice_func+0xf8>
+  802e96:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802e9d:	c1 e9 0c             	shr    $0xc,%ecx
+  802ea0:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802ea3:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802ea9:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802ead:	89 fb                	mov    %edi,%ebx
+  802eaf:	38 d9                	cmp    %bl,%cl
+  802eb1:	73 30                	jae    802ee3 <nfu_with_aging_page_choice_func+0x124>
+  802eb3:	dd d8                	fstp   %st(0)
+  802eb5:	eb 02                	jmp    802eb9 <nfu_with_aging_page_choice_func+0xfa>
+  802eb7:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802eb9:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802ec0:	c1 e9 0c             	shr    $0xc,%ecx
+  802ec3:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802ec6:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802ecd:	89 fb                	mov    %edi,%ebx
+  802ecf:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802ed2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802ed5:	db 45 e0             	fildl  -0x20(%ebp)
+  802ed8:	d8 35 40 60 80 00    	fdivs  0x806040
+	return ret*ret;
+  802ede:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802ee0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802ee3:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802ee6:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802ee9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802ef0:	df 6d e0             	fildll -0x20(%ebp)
+  802ef3:	d9 c1                	fld    %st(1)
+  802ef5:	d8 0d 44 60 80 00    	fmuls  0x806044
+  802efb:	d9 c9                	fxch   %st(1)
+  802efd:	df f1                	fcomip %st(1),%st
+  802eff:	dd d8                	fstp   %st(0)
+  802f01:	0f 82 ed fe ff ff    	jb     802df4 <nfu_with_aging_page_choice_func+0x35>
+  802f07:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802f09:	a3 30 90 80 00       	mov    %eax,0x809030
+			return (void*)(pgnum_opt*PGSIZE);
+  802f0e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802f11:	c1 e0 0c             	shl    $0xc,%eax
+  802f14:	eb 0e                	jmp    802f24 <nfu_with_aging_page_choice_func+0x165>
+  802f16:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802f18:	89 f8                	mov    %edi,%eax
+  802f1a:	3c ff                	cmp    $0xff,%al
+  802f1c:	74 0e                	je     802f2c <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802f1e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802f21:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802f24:	83 c4 14             	add    $0x14,%esp
+  802f27:	5b                   	pop    %ebx
+  802f28:	5e                   	pop    %esi
+  802f29:	5f                   	pop    %edi
+  802f2a:	5d                   	pop    %ebp
+  802f2b:	c3                   	ret
+	pgnum = 0;
+  802f2c:	c7 05 30 90 80 00 00 	movl   $0x0,0x809030
+  802f33:	00 00 00 
+	return (void*)UTOP;
+  802f36:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802f3b:	eb e7                	jmp    802f24 <nfu_with_aging_page_choice_func+0x165>
+
+00802f3d <myRand>:
+    state = state * 1664525 + 1013904223;
+  802f3d:	69 05 40 70 80 00 0d 	imul   $0x19660d,0x807040,%eax
+  802f44:	66 19 00 
+  802f47:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802f4c:	a3 40 70 80 00       	mov    %eax,0x807040
+    return state >> 24;
+  802f51:	c1 e8 18             	shr    $0x18,%eax
+}
+  802f54:	c3                   	ret
+
+00802f55 <random_page_choice_func>:
+{
+  802f55:	55                   	push   %ebp
+  802f56:	89 e5                	mov    %esp,%ebp
+  802f58:	57                   	push   %edi
+  802f59:	56                   	push   %esi
+  802f5a:	53                   	push   %ebx
+  802f5b:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802f5e:	be 00 00 00 00       	mov    $0x0,%esi
+  802f63:	eb 19                	jmp    802f7e <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802f65:	f7 d3                	not    %ebx
+  802f67:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802f6d:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802f6f:	83 c6 01             	add    $0x1,%esi
+  802f72:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802f78:	0f 87 a0 00 00 00    	ja     80301e <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802f7e:	89 f3                	mov    %esi,%ebx
+  802f80:	03 1d 2c 90 80 00    	add    0x80902c,%ebx
+  802f86:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802f8c:	89 d8                	mov    %ebx,%eax
+  802f8e:	c1 e8 0a             	shr    $0xa,%eax
+  802f91:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802f98:	25 81 00 00 00       	and    $0x81,%eax
+  802f9d:	83 f8 01             	cmp    $0x1,%eax
+  802fa0:	75 c3                	jne    802f65 <random_page_choice_func+0x10>
+  802fa2:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802fa8:	77 bb                	ja     802f65 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802faa:	89 df                	mov    %ebx,%edi
+  802fac:	c1 e7 0c             	shl    $0xc,%edi
+  802faf:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802fb2:	89 f8                	mov    %edi,%eax
+  802fb4:	e8 06 f9 ff ff       	call   8028bf <page_is_clean>
+  802fb9:	84 c0                	test   %al,%al
+  802fbb:	0f 85 82 00 00 00    	jne    803043 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802fc1:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  802fc7:	72 a6                	jb     802f6f <random_page_choice_func+0x1a>
+  802fc9:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802fcf:	77 9e                	ja     802f6f <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802fd1:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802fd8:	a8 01                	test   $0x1,%al
+  802fda:	74 93                	je     802f6f <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802fdc:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802fe3:	f6 c4 04             	test   $0x4,%ah
+  802fe6:	75 87                	jne    802f6f <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802fe8:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802fef:	f6 c4 02             	test   $0x2,%ah
+  802ff2:	0f 85 77 ff ff ff    	jne    802f6f <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802ff8:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802fff:	c1 e8 0c             	shr    $0xc,%eax
+  803002:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803005:	05 00 00 00 ef       	add    $0xef000000,%eax
+  80300a:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80300e:	66 83 f8 01          	cmp    $0x1,%ax
+  803012:	0f 87 57 ff ff ff    	ja     802f6f <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  803018:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  80301e:	e8 1a ff ff ff       	call   802f3d <myRand>
+  803023:	8b 3d 2c 90 80 00    	mov    0x80902c,%edi
+  803029:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  80302e:	29 fe                	sub    %edi,%esi
+  803030:	0f be c0             	movsbl %al,%eax
+  803033:	ba 00 00 00 00       	mov    $0x0,%edx
+  803038:	f7 f6                	div    %esi
+  80303a:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  80303c:	bb 15 00 00 00       	mov    $0x15,%ebx
+  803041:	eb 1c                	jmp    80305f <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  803043:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+			return (void*)(pgnum*PGSIZE);
+  803049:	e9 8f 00 00 00       	jmp    8030dd <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  80304e:	e8 ea fe ff ff       	call   802f3d <myRand>
+  803053:	0f be c0             	movsbl %al,%eax
+  803056:	ba 00 00 00 00       	mov    $0x0,%edx
+  80305b:	f7 f6                	div    %esi
+  80305d:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  80305f:	83 eb 01             	sub    $0x1,%ebx
+  803062:	0f 84 c2 00 00 00    	je     80312a <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  803068:	89 d0                	mov    %edx,%eax
+  80306a:	c1 e8 0a             	shr    $0xa,%eax
+  80306d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803074:	25 81 00 00 00       	and    $0x81,%eax
+  803079:	83 f8 01             	cmp    $0x1,%eax
+  80307c:	75 d0                	jne    80304e <random_page_choice_func+0xf9>
+  80307e:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  803084:	77 c8                	ja     80304e <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  803086:	89 d0                	mov    %edx,%eax
+  803088:	c1 e0 0c             	shl    $0xc,%eax
+  80308b:	3d 2c 10 81 00       	cmp    $0x81102c,%eax
+  803090:	72 56                	jb     8030e8 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  803092:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  803097:	77 65                	ja     8030fe <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  803099:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8030a0:	f6 c1 01             	test   $0x1,%cl
+  8030a3:	74 59                	je     8030fe <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8030a5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8030ac:	f6 c5 04             	test   $0x4,%ch
+  8030af:	75 4d                	jne    8030fe <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  8030b1:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8030b8:	f6 c5 02             	test   $0x2,%ch
+  8030bb:	75 41                	jne    8030fe <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  8030bd:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8030c4:	c1 ea 0c             	shr    $0xc,%edx
+  8030c7:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  8030ca:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  8030d0:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  8030d4:	66 83 fa 01          	cmp    $0x1,%dx
+  8030d8:	77 3a                	ja     803114 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  8030da:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  8030dd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030e0:	83 c4 1c             	add    $0x1c,%esp
+  8030e3:	5b                   	pop    %ebx
+  8030e4:	5e                   	pop    %esi
+  8030e5:	5f                   	pop    %edi
+  8030e6:	5d                   	pop    %ebp
+  8030e7:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8030e8:	e8 50 fe ff ff       	call   802f3d <myRand>
+  8030ed:	0f be c0             	movsbl %al,%eax
+  8030f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030f5:	f7 f6                	div    %esi
+  8030f7:	01 fa                	add    %edi,%edx
+			continue;
+  8030f9:	e9 61 ff ff ff       	jmp    80305f <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  8030fe:	e8 3a fe ff ff       	call   802f3d <myRand>
+  803103:	0f be c0             	movsbl %al,%eax
+  803106:	ba 00 00 00 00       	mov    $0x0,%edx
+  80310b:	f7 f6                	div    %esi
+  80310d:	01 fa                	add    %edi,%edx
+			continue;
+  80310f:	e9 4b ff ff ff       	jmp    80305f <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  803114:	e8 24 fe ff ff       	call   802f3d <myRand>
+  803119:	0f be c0             	movsbl %al,%eax
+  80311c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803121:	f7 f6                	div    %esi
+  803123:	01 fa                	add    %edi,%edx
+			continue;
+  803125:	e9 35 ff ff ff       	jmp    80305f <random_page_choice_func+0x10a>
+	pgnum = 0;
+  80312a:	c7 05 2c 90 80 00 00 	movl   $0x0,0x80902c
+  803131:	00 00 00 
+	return (void*)UTOP;
+  803134:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  80313b:	eb a0                	jmp    8030dd <random_page_choice_func+0x188>
+
+0080313d <nfu>:
+{
+  80313d:	55                   	push   %ebp
+  80313e:	89 e5                	mov    %esp,%ebp
+  803140:	57                   	push   %edi
+  803141:	56                   	push   %esi
+  803142:	53                   	push   %ebx
+  803143:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803146:	8b 35 28 90 80 00    	mov    0x809028,%esi
+	float pct_to_walk = 1.0f;
+  80314c:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  80314e:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803153:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803158:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80315f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803164:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  803167:	eb 18                	jmp    803181 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803169:	f7 d0                	not    %eax
+  80316b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803170:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803172:	83 c2 01             	add    $0x1,%edx
+  803175:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  80317b:	0f 87 13 01 00 00    	ja     803294 <nfu+0x157>
+		++num_searched_ptes;
+  803181:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803185:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  803188:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80318d:	89 c1                	mov    %eax,%ecx
+  80318f:	c1 e9 0a             	shr    $0xa,%ecx
+  803192:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  803199:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  80319f:	83 f9 01             	cmp    $0x1,%ecx
+  8031a2:	75 c5                	jne    803169 <nfu+0x2c>
+  8031a4:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8031a9:	77 be                	ja     803169 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8031ab:	89 c1                	mov    %eax,%ecx
+  8031ad:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8031b0:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  8031b6:	0f 82 a5 00 00 00    	jb     803261 <nfu+0x124>
+  8031bc:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8031c2:	0f 87 99 00 00 00    	ja     803261 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8031c8:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8031cf:	f6 c1 01             	test   $0x1,%cl
+  8031d2:	0f 84 89 00 00 00    	je     803261 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8031d8:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8031df:	f6 c5 04             	test   $0x4,%ch
+  8031e2:	75 7d                	jne    803261 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8031e4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8031eb:	f6 c5 02             	test   $0x2,%ch
+  8031ee:	75 71                	jne    803261 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8031f0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8031f7:	c1 e9 0c             	shr    $0xc,%ecx
+  8031fa:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8031fd:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803203:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803207:	66 83 f9 01          	cmp    $0x1,%cx
+  80320b:	77 54                	ja     803261 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  80320d:	89 f9                	mov    %edi,%ecx
+  80320f:	80 f9 ff             	cmp    $0xff,%cl
+  803212:	74 21                	je     803235 <nfu+0xf8>
+  803214:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80321b:	c1 e9 0c             	shr    $0xc,%ecx
+  80321e:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803221:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803227:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  80322b:	89 fb                	mov    %edi,%ebx
+  80322d:	38 d9                	cmp    %bl,%cl
+  80322f:	73 30                	jae    803261 <nfu+0x124>
+  803231:	dd d8                	fstp   %st(0)
+  803233:	eb 02                	jmp    803237 <nfu+0xfa>
+  803235:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  803237:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80323e:	c1 e9 0c             	shr    $0xc,%ecx
+  803241:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803244:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  80324b:	89 fb                	mov    %edi,%ebx
+  80324d:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  803250:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803253:	db 45 e0             	fildl  -0x20(%ebp)
+  803256:	d8 35 40 60 80 00    	fdivs  0x806040
+	return ret*ret;
+  80325c:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80325e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803261:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  803264:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803267:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80326e:	df 6d e0             	fildll -0x20(%ebp)
+  803271:	d9 c1                	fld    %st(1)
+  803273:	d8 0d 44 60 80 00    	fmuls  0x806044
+  803279:	d9 c9                	fxch   %st(1)
+  80327b:	df f1                	fcomip %st(1),%st
+  80327d:	dd d8                	fstp   %st(0)
+  80327f:	0f 82 ed fe ff ff    	jb     803172 <nfu+0x35>
+  803285:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  803287:	a3 28 90 80 00       	mov    %eax,0x809028
+			return (void*)(pgnum_opt*PGSIZE);
+  80328c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80328f:	c1 e0 0c             	shl    $0xc,%eax
+  803292:	eb 0e                	jmp    8032a2 <nfu+0x165>
+  803294:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  803296:	89 f8                	mov    %edi,%eax
+  803298:	3c ff                	cmp    $0xff,%al
+  80329a:	74 0e                	je     8032aa <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  80329c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80329f:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8032a2:	83 c4 14             	add    $0x14,%esp
+  8032a5:	5b                   	pop    %ebx
+  8032a6:	5e                   	pop    %esi
+  8032a7:	5f                   	pop    %edi
+  8032a8:	5d                   	pop    %ebp
+  8032a9:	c3                   	ret
+	pgnum = 0;
+  8032aa:	c7 05 28 90 80 00 00 	movl   $0x0,0x809028
+  8032b1:	00 00 00 
+	return (void*)UTOP;
+  8032b4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8032b9:	eb e7                	jmp    8032a2 <nfu+0x165>
+
+008032bb <lru>:
+{
+  8032bb:	55                   	push   %ebp
+  8032bc:	89 e5                	mov    %esp,%ebp
+  8032be:	57                   	push   %edi
+  8032bf:	56                   	push   %esi
+  8032c0:	53                   	push   %ebx
+  8032c1:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8032c4:	8b 3d 24 90 80 00    	mov    0x809024,%edi
+	long long time_min = 9223372036854775807;
+  8032ca:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  8032d1:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8032d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8032dd:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8032e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032e9:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  8032ec:	eb 18                	jmp    803306 <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8032ee:	f7 d0                	not    %eax
+  8032f0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8032f5:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8032f7:	83 c2 01             	add    $0x1,%edx
+  8032fa:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803300:	0f 87 fa 00 00 00    	ja     803400 <lru+0x145>
+		++num_searched_ptes;
+  803306:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803309:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80330c:	01 d0                	add    %edx,%eax
+  80330e:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803313:	89 c1                	mov    %eax,%ecx
+  803315:	c1 e9 0a             	shr    $0xa,%ecx
+  803318:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80331f:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803325:	83 f9 01             	cmp    $0x1,%ecx
+  803328:	75 c4                	jne    8032ee <lru+0x33>
+  80332a:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  80332f:	77 bd                	ja     8032ee <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803331:	89 c1                	mov    %eax,%ecx
+  803333:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803336:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  80333c:	0f 87 92 00 00 00    	ja     8033d4 <lru+0x119>
+  803342:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  803348:	0f 82 86 00 00 00    	jb     8033d4 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80334e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803355:	f6 c1 01             	test   $0x1,%cl
+  803358:	74 7a                	je     8033d4 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80335a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803361:	f6 c5 04             	test   $0x4,%ch
+  803364:	75 6e                	jne    8033d4 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803366:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80336d:	f6 c5 02             	test   $0x2,%ch
+  803370:	75 62                	jne    8033d4 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803372:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803379:	c1 e9 0c             	shr    $0xc,%ecx
+  80337c:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80337f:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803385:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803389:	66 83 f9 01          	cmp    $0x1,%cx
+  80338d:	77 45                	ja     8033d4 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  80338f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803396:	c1 e9 0c             	shr    $0xc,%ecx
+  803399:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80339c:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8033a2:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8033a5:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8033a8:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  8033ab:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8033ae:	19 df                	sbb    %ebx,%edi
+  8033b0:	7c 22                	jl     8033d4 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  8033b2:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8033b9:	c1 e9 0c             	shr    $0xc,%ecx
+  8033bc:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8033bf:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8033c5:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8033c8:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8033cb:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8033ce:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8033d1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8033d4:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8033d7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8033de:	df 6d e0             	fildll -0x20(%ebp)
+  8033e1:	d9 05 44 60 80 00    	flds   0x806044
+  8033e7:	d9 c9                	fxch   %st(1)
+  8033e9:	df f1                	fcomip %st(1),%st
+  8033eb:	dd d8                	fstp   %st(0)
+  8033ed:	0f 82 04 ff ff ff    	jb     8032f7 <lru+0x3c>
+			pgnum = pgnum_actual;
+  8033f3:	a3 24 90 80 00       	mov    %eax,0x809024
+			return (void*)(pgnum_opt*PGSIZE);
+  8033f8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8033fb:	c1 e0 0c             	shl    $0xc,%eax
+  8033fe:	eb 06                	jmp    803406 <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  803400:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803403:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803406:	83 c4 1c             	add    $0x1c,%esp
+  803409:	5b                   	pop    %ebx
+  80340a:	5e                   	pop    %esi
+  80340b:	5f                   	pop    %edi
+  80340c:	5d                   	pop    %ebp
+  80340d:	c3                   	ret
+
+0080340e <set_page_choice_func>:
+{
+  80340e:	55                   	push   %ebp
+  80340f:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  803411:	8b 45 08             	mov    0x8(%ebp),%eax
+  803414:	a3 3c 70 80 00       	mov    %eax,0x80703c
+}
+  803419:	5d                   	pop    %ebp
+  80341a:	c3                   	ret
+
+0080341b <get_page_choice>:
+{
+  80341b:	55                   	push   %ebp
+  80341c:	89 e5                	mov    %esp,%ebp
+  80341e:	57                   	push   %edi
+  80341f:	56                   	push   %esi
+  803420:	53                   	push   %ebx
+  803421:	83 ec 24             	sub    $0x24,%esp
+  803424:	8b 75 08             	mov    0x8(%ebp),%esi
+  803427:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  80342a:	57                   	push   %edi
+  80342b:	56                   	push   %esi
+  80342c:	ff 15 3c 70 80 00    	call   *0x80703c
+  803432:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803434:	83 c4 10             	add    $0x10,%esp
+  803437:	eb 25                	jmp    80345e <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  803439:	83 ec 08             	sub    $0x8,%esp
+  80343c:	c1 e0 16             	shl    $0x16,%eax
+  80343f:	50                   	push   %eax
+  803440:	6a 00                	push   $0x0
+  803442:	e8 cc da ff ff       	call   800f13 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803447:	83 c4 10             	add    $0x10,%esp
+  80344a:	85 c0                	test   %eax,%eax
+  80344c:	75 43                	jne    803491 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  80344e:	83 ec 08             	sub    $0x8,%esp
+  803451:	57                   	push   %edi
+  803452:	56                   	push   %esi
+  803453:	ff 15 3c 70 80 00    	call   *0x80703c
+  803459:	89 c3                	mov    %eax,%ebx
+  80345b:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80345e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  803461:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803467:	0f 86 ae 00 00 00    	jbe    80351b <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80346d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  803472:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803479:	81 e2 81 00 00 00    	and    $0x81,%edx
+  80347f:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  803485:	74 b2                	je     803439 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803487:	83 c0 01             	add    $0x1,%eax
+  80348a:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  80348f:	75 e1                	jne    803472 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803491:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803494:	05 00 10 40 11       	add    $0x11401000,%eax
+  803499:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80349e:	76 1f                	jbe    8034bf <get_page_choice+0xa4>
+		return (void *) UTOP;
+  8034a0:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  8034a5:	89 d8                	mov    %ebx,%eax
+  8034a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034aa:	5b                   	pop    %ebx
+  8034ab:	5e                   	pop    %esi
+  8034ac:	5f                   	pop    %edi
+  8034ad:	5d                   	pop    %ebp
+  8034ae:	c3                   	ret
+		sys_page_split(0, pg_out);
+  8034af:	83 ec 08             	sub    $0x8,%esp
+  8034b2:	53                   	push   %ebx
+  8034b3:	6a 00                	push   $0x0
+  8034b5:	e8 59 da ff ff       	call   800f13 <sys_page_split>
+  8034ba:	83 c4 10             	add    $0x10,%esp
+  8034bd:	eb 6c                	jmp    80352b <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  8034bf:	83 ec 04             	sub    $0x4,%esp
+  8034c2:	68 ec 5b 80 00       	push   $0x805bec
+  8034c7:	68 cc 01 00 00       	push   $0x1cc
+  8034cc:	68 5b 5b 80 00       	push   $0x805b5b
+  8034d1:	e8 c1 cd ff ff       	call   800297 <_panic>
+		panic("We tried to page out code pages\n");
+  8034d6:	83 ec 04             	sub    $0x4,%esp
+  8034d9:	68 1c 5c 80 00       	push   $0x805c1c
+  8034de:	68 d6 01 00 00       	push   $0x1d6
+  8034e3:	68 5b 5b 80 00       	push   $0x805b5b
+  8034e8:	e8 aa cd ff ff       	call   800297 <_panic>
+		panic("Invalid mapping for the va\n");
+  8034ed:	83 ec 04             	sub    $0x4,%esp
+  8034f0:	68 68 5b 80 00       	push   $0x805b68
+  8034f5:	68 da 01 00 00       	push   $0x1da
+  8034fa:	68 5b 5b 80 00       	push   $0x805b5b
+  8034ff:	e8 93 cd ff ff       	call   800297 <_panic>
+		panic("We tried to page out a shared page\n");
+  803504:	83 ec 04             	sub    $0x4,%esp
+  803507:	68 40 5c 80 00       	push   $0x805c40
+  80350c:	68 e0 01 00 00       	push   $0x1e0
+  803511:	68 5b 5b 80 00       	push   $0x805b5b
+  803516:	e8 7c cd ff ff       	call   800297 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  80351b:	89 de                	mov    %ebx,%esi
+  80351d:	c1 ee 16             	shr    $0x16,%esi
+  803520:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803527:	a8 80                	test   $0x80,%al
+  803529:	75 84                	jne    8034af <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  80352b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80352e:	05 00 10 40 11       	add    $0x11401000,%eax
+  803533:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803538:	76 85                	jbe    8034bf <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  80353a:	89 d8                	mov    %ebx,%eax
+  80353c:	e8 7e f3 ff ff       	call   8028bf <page_is_clean>
+  803541:	84 c0                	test   %al,%al
+  803543:	0f 85 5c ff ff ff    	jne    8034a5 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  803549:	81 7d e4 2c 10 81 00 	cmpl   $0x81102c,-0x1c(%ebp)
+  803550:	76 84                	jbe    8034d6 <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  803552:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803559:	a8 01                	test   $0x1,%al
+  80355b:	74 90                	je     8034ed <get_page_choice+0xd2>
+  80355d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803560:	c1 e8 0c             	shr    $0xc,%eax
+  803563:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80356a:	f6 c2 01             	test   $0x1,%dl
+  80356d:	0f 84 7a ff ff ff    	je     8034ed <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803573:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  80357a:	f6 c2 01             	test   $0x1,%dl
+  80357d:	74 85                	je     803504 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  80357f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803586:	f6 c2 01             	test   $0x1,%dl
+  803589:	0f 84 75 ff ff ff    	je     803504 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  80358f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803596:	f6 c6 04             	test   $0x4,%dh
+  803599:	0f 85 65 ff ff ff    	jne    803504 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  80359f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8035a6:	f6 c6 02             	test   $0x2,%dh
+  8035a9:	0f 85 55 ff ff ff    	jne    803504 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  8035af:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8035b6:	c1 e8 0c             	shr    $0xc,%eax
+  8035b9:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8035bc:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8035c1:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8035c5:	66 83 f8 01          	cmp    $0x1,%ax
+  8035c9:	0f 86 d6 fe ff ff    	jbe    8034a5 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  8035cf:	83 ec 04             	sub    $0x4,%esp
+  8035d2:	68 64 5c 80 00       	push   $0x805c64
+  8035d7:	68 e2 01 00 00       	push   $0x1e2
+  8035dc:	68 5b 5b 80 00       	push   $0x805b5b
+  8035e1:	e8 b1 cc ff ff       	call   800297 <_panic>
+
+008035e6 <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  8035e6:	55                   	push   %ebp
+  8035e7:	89 e5                	mov    %esp,%ebp
+  8035e9:	57                   	push   %edi
+  8035ea:	56                   	push   %esi
+  8035eb:	53                   	push   %ebx
+  8035ec:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  8035ef:	e8 e8 f6 ff ff       	call   802cdc <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  8035f4:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  8035f9:	85 c0                	test   %eax,%eax
+  8035fb:	74 41                	je     80363e <page_share_paged_out+0x58>
+  8035fd:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803604:	0f 84 fd 00 00 00    	je     803707 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  80360a:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  803611:	00 00 00 
+  803614:	c7 05 00 b0 80 00 00 	movl   $0x0,0x80b000
+  80361b:	00 00 00 
+  80361e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803623:	eb 2c                	jmp    803651 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803625:	83 c3 04             	add    $0x4,%ebx
+  803628:	39 f3                	cmp    %esi,%ebx
+  80362a:	74 1a                	je     803646 <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  80362c:	8b 03                	mov    (%ebx),%eax
+  80362e:	a8 01                	test   $0x1,%al
+  803630:	74 f3                	je     803625 <page_share_paged_out+0x3f>
+  803632:	c1 e8 0c             	shr    $0xc,%eax
+  803635:	e8 2b f5 ff ff       	call   802b65 <page_share_slot>
+  80363a:	85 c0                	test   %eax,%eax
+  80363c:	79 e7                	jns    803625 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  80363e:	83 c4 0c             	add    $0xc,%esp
+  803641:	5b                   	pop    %ebx
+  803642:	5e                   	pop    %esi
+  803643:	5f                   	pop    %edi
+  803644:	5d                   	pop    %ebp
+  803645:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  803646:	83 c7 04             	add    $0x4,%edi
+  803649:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  80364f:	74 1b                	je     80366c <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  803651:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  803656:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  803659:	f6 c3 01             	test   $0x1,%bl
+  80365c:	74 e8                	je     803646 <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  80365e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803664:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  80366a:	eb bc                	jmp    803628 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80366c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803671:	eb 11                	jmp    803684 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  803673:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803679:	83 c3 01             	add    $0x1,%ebx
+  80367c:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803682:	77 41                	ja     8036c5 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  803684:	89 d8                	mov    %ebx,%eax
+  803686:	c1 e8 0a             	shr    $0xa,%eax
+  803689:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803690:	25 81 00 00 00       	and    $0x81,%eax
+  803695:	83 f8 01             	cmp    $0x1,%eax
+  803698:	75 d9                	jne    803673 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  80369a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8036a1:	25 81 00 00 00       	and    $0x81,%eax
+  8036a6:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8036ab:	75 cc                	jne    803679 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  8036ad:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8036b4:	c1 e8 0c             	shr    $0xc,%eax
+  8036b7:	e8 a9 f4 ff ff       	call   802b65 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  8036bc:	85 c0                	test   %eax,%eax
+  8036be:	79 b9                	jns    803679 <page_share_paged_out+0x93>
+  8036c0:	e9 79 ff ff ff       	jmp    80363e <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8036c5:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8036cc:	75 13                	jne    8036e1 <page_share_paged_out+0xfb>
+  8036ce:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  8036d5:	75 1d                	jne    8036f4 <page_share_paged_out+0x10e>
+	return 0;
+  8036d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036dc:	e9 5d ff ff ff       	jmp    80363e <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8036e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e6:	e8 46 f4 ff ff       	call   802b31 <page_share_send>
+  8036eb:	85 c0                	test   %eax,%eax
+  8036ed:	79 df                	jns    8036ce <page_share_paged_out+0xe8>
+  8036ef:	e9 4a ff ff ff       	jmp    80363e <page_share_paged_out+0x58>
+  8036f4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036f9:	e8 33 f4 ff ff       	call   802b31 <page_share_send>
+  8036fe:	85 c0                	test   %eax,%eax
+  803700:	79 d5                	jns    8036d7 <page_share_paged_out+0xf1>
+  803702:	e9 37 ff ff ff       	jmp    80363e <page_share_paged_out+0x58>
+		return 0;
+  803707:	b8 00 00 00 00       	mov    $0x0,%eax
+  80370c:	e9 2d ff ff ff       	jmp    80363e <page_share_paged_out+0x58>
+
+00803711 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  803711:	55                   	push   %ebp
+  803712:	89 e5                	mov    %esp,%ebp
+  803714:	56                   	push   %esi
+  803715:	53                   	push   %ebx
+  803716:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  803719:	e8 be f5 ff ff       	call   802cdc <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  80371e:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  803723:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  80372a:	0f 84 82 00 00 00    	je     8037b2 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  803730:	83 ec 0c             	sub    $0xc,%esp
+  803733:	68 00 10 00 00       	push   $0x1000
+  803738:	e8 84 11 00 00       	call   8048c1 <malloc>
+  80373d:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  80373f:	83 c4 0c             	add    $0xc,%esp
+  803742:	6a 14                	push   $0x14
+  803744:	6a 00                	push   $0x0
+  803746:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803749:	50                   	push   %eax
+  80374a:	e8 5b d3 ff ff       	call   800aaa <memset>
+  80374f:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  803752:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  803757:	83 ec 0c             	sub    $0xc,%esp
+  80375a:	6a 07                	push   $0x7
+  80375c:	6a 01                	push   $0x1
+  80375e:	53                   	push   %ebx
+  80375f:	6a 03                	push   $0x3
+  803761:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  803768:	e8 b7 19 00 00       	call   805124 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  80376d:	8b 03                	mov    (%ebx),%eax
+  80376f:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803772:	8b 43 04             	mov    0x4(%ebx),%eax
+  803775:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  803778:	8b 43 08             	mov    0x8(%ebx),%eax
+  80377b:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  80377e:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803781:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  803784:	8b 43 10             	mov    0x10(%ebx),%eax
+  803787:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  80378a:	83 c6 01             	add    $0x1,%esi
+  80378d:	83 c4 20             	add    $0x20,%esp
+  803790:	83 fe 02             	cmp    $0x2,%esi
+  803793:	75 c2                	jne    803757 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  803795:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803798:	89 03                	mov    %eax,(%ebx)
+  80379a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80379d:	89 43 04             	mov    %eax,0x4(%ebx)
+  8037a0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8037a3:	89 43 08             	mov    %eax,0x8(%ebx)
+  8037a6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8037a9:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8037ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037af:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  8037b2:	89 d8                	mov    %ebx,%eax
+  8037b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8037b7:	5b                   	pop    %ebx
+  8037b8:	5e                   	pop    %esi
+  8037b9:	5d                   	pop    %ebp
+  8037ba:	c3                   	ret
+
+008037bb <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  8037bb:	55                   	push   %ebp
+  8037bc:	89 e5                	mov    %esp,%ebp
+  8037be:	53                   	push   %ebx
+  8037bf:	83 ec 10             	sub    $0x10,%esp
+  8037c2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  8037c5:	68 51 55 80 00       	push   $0x805551
+  8037ca:	e8 a3 cb ff ff       	call   800372 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  8037cf:	83 c4 08             	add    $0x8,%esp
+  8037d2:	ff 33                	push   (%ebx)
+  8037d4:	68 98 5c 80 00       	push   $0x805c98
+  8037d9:	e8 94 cb ff ff       	call   800372 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  8037de:	83 c4 08             	add    $0x8,%esp
+  8037e1:	ff 73 04             	push   0x4(%ebx)
+  8037e4:	68 84 5b 80 00       	push   $0x805b84
+  8037e9:	e8 84 cb ff ff       	call   800372 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  8037ee:	83 c4 08             	add    $0x8,%esp
+  8037f1:	ff 73 08             	push   0x8(%ebx)
+  8037f4:	68 b8 5c 80 00       	push   $0x805cb8
+  8037f9:	e8 74 cb ff ff       	call   800372 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  8037fe:	83 c4 08             	add    $0x8,%esp
+  803801:	ff 73 0c             	push   0xc(%ebx)
+  803804:	68 dc 5c 80 00       	push   $0x805cdc
+  803809:	e8 64 cb ff ff       	call   800372 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  80380e:	83 c4 08             	add    $0x8,%esp
+  803811:	ff 73 10             	push   0x10(%ebx)
+  803814:	68 00 5d 80 00       	push   $0x805d00
+  803819:	e8 54 cb ff ff       	call   800372 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  80381e:	83 c4 08             	add    $0x8,%esp
+  803821:	ff 35 08 c0 80 00    	push   0x80c008
+  803827:	68 3c 5d 80 00       	push   $0x805d3c
+  80382c:	e8 41 cb ff ff       	call   800372 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  803831:	83 c4 08             	add    $0x8,%esp
+  803834:	ff 35 04 c0 80 00    	push   0x80c004
+  80383a:	68 70 5d 80 00       	push   $0x805d70
+  80383f:	e8 2e cb ff ff       	call   800372 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  803844:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803849:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  80384c:	8b 50 68             	mov    0x68(%eax),%edx
+  80384f:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  803852:	51                   	push   %ecx
+  803853:	52                   	push   %edx
+  803854:	50                   	push   %eax
+  803855:	68 b0 5d 80 00       	push   $0x805db0
+  80385a:	e8 13 cb ff ff       	call   800372 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  80385f:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803864:	8b 40 70             	mov    0x70(%eax),%eax
+  803867:	83 c4 18             	add    $0x18,%esp
+  80386a:	50                   	push   %eax
+  80386b:	68 e4 5d 80 00       	push   $0x805de4
+  803870:	e8 fd ca ff ff       	call   800372 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  803875:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  80387b:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803881:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  803886:	51                   	push   %ecx
+  803887:	52                   	push   %edx
+  803888:	50                   	push   %eax
+  803889:	68 14 5e 80 00       	push   $0x805e14
+  80388e:	e8 df ca ff ff       	call   800372 <cprintf>
+	cprintf("\n");
+  803893:	83 c4 14             	add    $0x14,%esp
+  803896:	68 51 55 80 00       	push   $0x805551
+  80389b:	e8 d2 ca ff ff       	call   800372 <cprintf>
+}
+  8038a0:	83 c4 10             	add    $0x10,%esp
+  8038a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038a6:	c9                   	leave
+  8038a7:	c3                   	ret
+
+008038a8 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  8038a8:	55                   	push   %ebp
+  8038a9:	89 e5                	mov    %esp,%ebp
+  8038ab:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  8038ae:	e8 5e fe ff ff       	call   803711 <get_paging_stats>
+  8038b3:	83 ec 0c             	sub    $0xc,%esp
+  8038b6:	50                   	push   %eax
+  8038b7:	e8 ff fe ff ff       	call   8037bb <print_paging_stats>
+}
+  8038bc:	83 c4 10             	add    $0x10,%esp
+  8038bf:	c9                   	leave
+  8038c0:	c3                   	ret
+
+008038c1 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  8038c1:	55                   	push   %ebp
+  8038c2:	89 e5                	mov    %esp,%ebp
+  8038c4:	53                   	push   %ebx
+  8038c5:	83 ec 04             	sub    $0x4,%esp
+  8038c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  8038cb:	eb 13                	jmp    8038e0 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  8038cd:	83 ec 04             	sub    $0x4,%esp
+  8038d0:	6a ff                	push   $0xffffffff
+  8038d2:	53                   	push   %ebx
+  8038d3:	68 00 f0 ff ee       	push   $0xeefff000
+  8038d8:	e8 48 da ff ff       	call   801325 <sys_futex_wait>
+  8038dd:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  8038e0:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  8038e5:	39 d8                	cmp    %ebx,%eax
+  8038e7:	74 e4                	je     8038cd <mem_pressure_wait+0xc>
+	return now;
+}
+  8038e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038ec:	c9                   	leave
+  8038ed:	c3                   	ret
+
+008038ee <init_map_dir>:
+
+void
+init_map_dir()
+{
+  8038ee:	55                   	push   %ebp
+  8038ef:	89 e5                	mov    %esp,%ebp
+  8038f1:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  8038f4:	68 60 45 80 00       	push   $0x804560
+  8038f9:	e8 32 16 00 00       	call   804f30 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  8038fe:	c7 05 14 f9 80 00 00 	movl   $0xdeadb000,0x80f914
+  803905:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  803908:	83 c4 0c             	add    $0xc,%esp
+  80390b:	68 07 02 00 00       	push   $0x207
+  803910:	68 00 b0 ad de       	push   $0xdeadb000
+  803915:	6a 00                	push   $0x0
+  803917:	e8 30 d5 ff ff       	call   800e4c <sys_page_alloc>
+  80391c:	83 c4 10             	add    $0x10,%esp
+  80391f:	85 c0                	test   %eax,%eax
+  803921:	78 0c                	js     80392f <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  803923:	e8 b4 f3 ff ff       	call   802cdc <find_paging_env>
+	page_ring_ready();
+  803928:	e8 7f f2 ff ff       	call   802bac <page_ring_ready>
+}
+  80392d:	c9                   	leave
+  80392e:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  80392f:	50                   	push   %eax
+  803930:	68 a2 5b 80 00       	push   $0x805ba2
+  803935:	68 13 05 00 00       	push   $0x513
+  80393a:	68 5b 5b 80 00       	push   $0x805b5b
+  80393f:	e8 53 c9 ff ff       	call   800297 <_panic>
+
+00803944 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  803944:	55                   	push   %ebp
+  803945:	89 e5                	mov    %esp,%ebp
+  803947:	57                   	push   %edi
+  803948:	56                   	push   %esi
+  803949:	53                   	push   %ebx
+  80394a:	83 ec 0c             	sub    $0xc,%esp
+  80394d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  803950:	89 fa                	mov    %edi,%edx
+  803952:	c1 ea 16             	shr    $0x16,%edx
+  803955:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  80395a:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  80395d:	f6 06 01             	testb  $0x1,(%esi)
+  803960:	75 3e                	jne    8039a0 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803962:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  803967:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80396b:	74 47                	je     8039b4 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  80396d:	83 ec 0c             	sub    $0xc,%esp
+  803970:	6a 01                	push   $0x1
+  803972:	e8 f2 11 00 00       	call   804b69 <va_alloc>
+  803977:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  803979:	83 c4 10             	add    $0x10,%esp
+  80397c:	85 c0                	test   %eax,%eax
+  80397e:	74 34                	je     8039b4 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803980:	6a 00                	push   $0x0
+  803982:	68 07 02 00 00       	push   $0x207
+  803987:	50                   	push   %eax
+  803988:	6a 00                	push   $0x0
+  80398a:	e8 df 02 00 00       	call   803c6e <page_alloc>
+  80398f:	83 c4 10             	add    $0x10,%esp
+  803992:	85 c0                	test   %eax,%eax
+  803994:	78 28                	js     8039be <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  803996:	f6 06 01             	testb  $0x1,(%esi)
+  803999:	75 38                	jne    8039d3 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  80399b:	83 cb 01             	or     $0x1,%ebx
+  80399e:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  8039a0:	89 f8                	mov    %edi,%eax
+  8039a2:	c1 e8 0a             	shr    $0xa,%eax
+  8039a5:	25 fc 0f 00 00       	and    $0xffc,%eax
+  8039aa:	8b 1e                	mov    (%esi),%ebx
+  8039ac:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8039b2:	01 c3                	add    %eax,%ebx
+}
+  8039b4:	89 d8                	mov    %ebx,%eax
+  8039b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039b9:	5b                   	pop    %ebx
+  8039ba:	5e                   	pop    %esi
+  8039bb:	5f                   	pop    %edi
+  8039bc:	5d                   	pop    %ebp
+  8039bd:	c3                   	ret
+			va_free(page, 1);
+  8039be:	83 ec 08             	sub    $0x8,%esp
+  8039c1:	6a 01                	push   $0x1
+  8039c3:	53                   	push   %ebx
+  8039c4:	e8 d8 12 00 00       	call   804ca1 <va_free>
+			return NULL;
+  8039c9:	83 c4 10             	add    $0x10,%esp
+  8039cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039d1:	eb e1                	jmp    8039b4 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  8039d3:	83 ec 08             	sub    $0x8,%esp
+  8039d6:	53                   	push   %ebx
+  8039d7:	6a 00                	push   $0x0
+  8039d9:	e8 f3 d4 ff ff       	call   800ed1 <sys_page_unmap>
+			va_free(page, 1);
+  8039de:	83 c4 08             	add    $0x8,%esp
+  8039e1:	6a 01                	push   $0x1
+  8039e3:	53                   	push   %ebx
+  8039e4:	e8 b8 12 00 00       	call   804ca1 <va_free>
+  8039e9:	83 c4 10             	add    $0x10,%esp
+  8039ec:	eb b2                	jmp    8039a0 <umapdir_walk+0x5c>
+
+008039ee <page_out>:
+{
+  8039ee:	55                   	push   %ebp
+  8039ef:	89 e5                	mov    %esp,%ebp
+  8039f1:	57                   	push   %edi
+  8039f2:	56                   	push   %esi
+  8039f3:	53                   	push   %ebx
+  8039f4:	83 ec 5c             	sub    $0x5c,%esp
+  8039f7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  8039fa:	e8 dd f2 ff ff       	call   802cdc <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  8039ff:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  803a04:	85 c0                	test   %eax,%eax
+  803a06:	74 1e                	je     803a26 <page_out+0x38>
+  803a08:	83 ec 0c             	sub    $0xc,%esp
+  803a0b:	6a 00                	push   $0x0
+  803a0d:	6a 00                	push   $0x0
+  803a0f:	6a 00                	push   $0x0
+  803a11:	6a 08                	push   $0x8
+  803a13:	50                   	push   %eax
+  803a14:	e8 0b 17 00 00       	call   805124 <ipc_call>
+  803a19:	89 c3                	mov    %eax,%ebx
+  803a1b:	83 c4 20             	add    $0x20,%esp
+  803a1e:	85 c0                	test   %eax,%eax
+  803a20:	0f 84 ac 00 00 00    	je     803ad2 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  803a26:	83 ec 08             	sub    $0x8,%esp
+  803a29:	ff 75 0c             	push   0xc(%ebp)
+  803a2c:	57                   	push   %edi
+  803a2d:	e8 e9 f9 ff ff       	call   80341b <get_page_choice>
+  803a32:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  803a34:	83 c4 10             	add    $0x10,%esp
+  803a37:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803a3c:	0f 84 18 02 00 00    	je     803c5a <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803a42:	e8 78 ee ff ff       	call   8028bf <page_is_clean>
+  803a47:	84 c0                	test   %al,%al
+  803a49:	0f 85 8c 00 00 00    	jne    803adb <page_out+0xed>
+	if (pagingenv == 0)
+  803a4f:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803a56:	0f 84 08 02 00 00    	je     803c64 <page_out+0x276>
+	if (page_ring_ready())
+  803a5c:	e8 4b f1 ff ff       	call   802bac <page_ring_ready>
+  803a61:	89 c3                	mov    %eax,%ebx
+  803a63:	85 c0                	test   %eax,%eax
+  803a65:	0f 85 89 00 00 00    	jne    803af4 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  803a6b:	83 ec 0c             	sub    $0xc,%esp
+  803a6e:	6a 05                	push   $0x5
+  803a70:	6a 01                	push   $0x1
+  803a72:	56                   	push   %esi
+  803a73:	6a 01                	push   $0x1
+  803a75:	ff 35 40 c0 80 00    	push   0x80c040
+  803a7b:	e8 a4 16 00 00       	call   805124 <ipc_call>
+  803a80:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803a82:	83 c4 20             	add    $0x20,%esp
+  803a85:	85 c0                	test   %eax,%eax
+  803a87:	0f 88 b8 01 00 00    	js     803c45 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803a8d:	89 f0                	mov    %esi,%eax
+  803a8f:	c1 e8 0c             	shr    $0xc,%eax
+  803a92:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803a99:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803a9c:	83 ec 08             	sub    $0x8,%esp
+  803a9f:	56                   	push   %esi
+  803aa0:	6a 00                	push   $0x0
+  803aa2:	e8 2a d4 ff ff       	call   800ed1 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803aa7:	83 c4 08             	add    $0x8,%esp
+  803aaa:	6a 01                	push   $0x1
+  803aac:	56                   	push   %esi
+  803aad:	e8 92 fe ff ff       	call   803944 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803ab2:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803ab5:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803abb:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803abe:	09 fe                	or     %edi,%esi
+  803ac0:	83 ce 01             	or     $0x1,%esi
+  803ac3:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803ac5:	83 c4 10             	add    $0x10,%esp
+}
+  803ac8:	89 d8                	mov    %ebx,%eax
+  803aca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803acd:	5b                   	pop    %ebx
+  803ace:	5e                   	pop    %esi
+  803acf:	5f                   	pop    %edi
+  803ad0:	5d                   	pop    %ebp
+  803ad1:	c3                   	ret
+		num_page_reclaims++;
+  803ad2:	83 05 04 c0 80 00 01 	addl   $0x1,0x80c004
+		return 0;
+  803ad9:	eb ed                	jmp    803ac8 <page_out+0xda>
+		num_page_drops++;
+  803adb:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+		return sys_page_unmap(0, map_out_addr);
+  803ae2:	83 ec 08             	sub    $0x8,%esp
+  803ae5:	56                   	push   %esi
+  803ae6:	6a 00                	push   $0x0
+  803ae8:	e8 e4 d3 ff ff       	call   800ed1 <sys_page_unmap>
+  803aed:	89 c3                	mov    %eax,%ebx
+  803aef:	83 c4 10             	add    $0x10,%esp
+  803af2:	eb d4                	jmp    803ac8 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803af4:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803af6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803afb:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803b00:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803b03:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803b05:	83 c0 08             	add    $0x8,%eax
+  803b08:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803b0b:	b8 07 00 00 00       	mov    $0x7,%eax
+  803b10:	e8 e5 ef ff ff       	call   802afa <page_ring_reserve>
+	first = ring->sq_tail;
+  803b15:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803b1a:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803b1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803b22:	83 ec 04             	sub    $0x4,%esp
+  803b25:	68 00 10 00 00       	push   $0x1000
+  803b2a:	56                   	push   %esi
+  803b2b:	89 d8                	mov    %ebx,%eax
+  803b2d:	c1 e0 0c             	shl    $0xc,%eax
+  803b30:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803b35:	50                   	push   %eax
+  803b36:	e8 06 d0 ff ff       	call   800b41 <memcpy>
+		vas[n] = va;
+  803b3b:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803b3f:	89 d9                	mov    %ebx,%ecx
+  803b41:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b46:	b8 01 00 00 00       	mov    $0x1,%eax
+  803b4b:	e8 de ee ff ff       	call   802a2e <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803b50:	8d 43 01             	lea    0x1(%ebx),%eax
+  803b53:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803b56:	83 c4 10             	add    $0x10,%esp
+  803b59:	83 fb 06             	cmp    $0x6,%ebx
+  803b5c:	74 62                	je     803bc0 <page_out+0x1d2>
+  803b5e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803b61:	eb 15                	jmp    803b78 <page_out+0x18a>
+			num_page_drops++;
+  803b63:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+			sys_page_unmap(0, va);
+  803b6a:	83 ec 08             	sub    $0x8,%esp
+  803b6d:	56                   	push   %esi
+  803b6e:	6a 00                	push   $0x0
+  803b70:	e8 5c d3 ff ff       	call   800ed1 <sys_page_unmap>
+  803b75:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803b78:	83 ec 08             	sub    $0x8,%esp
+  803b7b:	53                   	push   %ebx
+  803b7c:	57                   	push   %edi
+  803b7d:	e8 99 f8 ff ff       	call   80341b <get_page_choice>
+  803b82:	89 c6                	mov    %eax,%esi
+  803b84:	83 c4 10             	add    $0x10,%esp
+  803b87:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803b8c:	74 32                	je     803bc0 <page_out+0x1d2>
+  803b8e:	e8 2c ed ff ff       	call   8028bf <page_is_clean>
+  803b93:	84 c0                	test   %al,%al
+  803b95:	75 cc                	jne    803b63 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803b97:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803b9a:	39 c6                	cmp    %eax,%esi
+  803b9c:	72 07                	jb     803ba5 <page_out+0x1b7>
+  803b9e:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803ba1:	39 c6                	cmp    %eax,%esi
+  803ba3:	72 1b                	jb     803bc0 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803ba5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803baa:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803bad:	eb 03                	jmp    803bb2 <page_out+0x1c4>
+  803baf:	83 c3 01             	add    $0x1,%ebx
+  803bb2:	39 da                	cmp    %ebx,%edx
+  803bb4:	0f 84 68 ff ff ff    	je     803b22 <page_out+0x134>
+  803bba:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803bbe:	75 ef                	jne    803baf <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803bc0:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803bc3:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803bc6:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803bc9:	e8 a6 ee ff ff       	call   802a74 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803bce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803bd3:	eb 42                	jmp    803c17 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803bd5:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803bd9:	89 f8                	mov    %edi,%eax
+  803bdb:	c1 e8 0c             	shr    $0xc,%eax
+  803bde:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803be5:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803be8:	83 ec 08             	sub    $0x8,%esp
+  803beb:	57                   	push   %edi
+  803bec:	6a 00                	push   $0x0
+  803bee:	e8 de d2 ff ff       	call   800ed1 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803bf3:	83 c4 08             	add    $0x8,%esp
+  803bf6:	6a 01                	push   $0x1
+  803bf8:	57                   	push   %edi
+  803bf9:	e8 46 fd ff ff       	call   803944 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803bfe:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803c01:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803c07:	c1 e6 0c             	shl    $0xc,%esi
+  803c0a:	09 d6                	or     %edx,%esi
+  803c0c:	83 ce 01             	or     $0x1,%esi
+  803c0f:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803c11:	83 c3 01             	add    $0x1,%ebx
+  803c14:	83 c4 10             	add    $0x10,%esp
+  803c17:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803c1a:	39 c3                	cmp    %eax,%ebx
+  803c1c:	74 1d                	je     803c3b <page_out+0x24d>
+		if (res[i] < 0)
+  803c1e:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803c22:	85 f6                	test   %esi,%esi
+  803c24:	79 af                	jns    803bd5 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803c26:	56                   	push   %esi
+  803c27:	68 44 5e 80 00       	push   $0x805e44
+  803c2c:	68 d1 02 00 00       	push   $0x2d1
+  803c31:	68 5b 5b 80 00       	push   $0x805b5b
+  803c36:	e8 5c c6 ff ff       	call   800297 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803c3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c40:	e9 83 fe ff ff       	jmp    803ac8 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803c45:	50                   	push   %eax
+  803c46:	68 44 5e 80 00       	push   $0x805e44
+  803c4b:	68 0a 03 00 00       	push   $0x30a
+  803c50:	68 5b 5b 80 00       	push   $0x805b5b
+  803c55:	e8 3d c6 ff ff       	call   800297 <_panic>
+		return -E_NO_MEM;
+  803c5a:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803c5f:	e9 64 fe ff ff       	jmp    803ac8 <page_out+0xda>
+		return -E_PAGING;
+  803c64:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803c69:	e9 5a fe ff ff       	jmp    803ac8 <page_out+0xda>
+
+00803c6e <page_alloc>:
+{
+  803c6e:	55                   	push   %ebp
+  803c6f:	89 e5                	mov    %esp,%ebp
+  803c71:	57                   	push   %edi
+  803c72:	56                   	push   %esi
+  803c73:	53                   	push   %ebx
+  803c74:	83 ec 0c             	sub    $0xc,%esp
+  803c77:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803c7a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803c7d:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803c84:	74 34                	je     803cba <page_alloc+0x4c>
+	if (check_mte)
+  803c86:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803c8a:	75 35                	jne    803cc1 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803c8c:	83 ec 04             	sub    $0x4,%esp
+  803c8f:	ff 75 10             	push   0x10(%ebp)
+  803c92:	56                   	push   %esi
+  803c93:	57                   	push   %edi
+  803c94:	e8 b3 d1 ff ff       	call   800e4c <sys_page_alloc>
+  803c99:	89 c3                	mov    %eax,%ebx
+  803c9b:	83 c4 10             	add    $0x10,%esp
+  803c9e:	85 c0                	test   %eax,%eax
+  803ca0:	79 52                	jns    803cf4 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803ca2:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803ca5:	75 52                	jne    803cf9 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803ca7:	83 ec 08             	sub    $0x8,%esp
+  803caa:	56                   	push   %esi
+  803cab:	57                   	push   %edi
+  803cac:	e8 3d fd ff ff       	call   8039ee <page_out>
+  803cb1:	83 c4 10             	add    $0x10,%esp
+  803cb4:	85 c0                	test   %eax,%eax
+  803cb6:	79 d4                	jns    803c8c <page_alloc+0x1e>
+  803cb8:	eb 3f                	jmp    803cf9 <page_alloc+0x8b>
+		init_map_dir();
+  803cba:	e8 2f fc ff ff       	call   8038ee <init_map_dir>
+  803cbf:	eb c5                	jmp    803c86 <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803cc1:	83 ec 08             	sub    $0x8,%esp
+  803cc4:	6a 00                	push   $0x0
+  803cc6:	56                   	push   %esi
+  803cc7:	e8 78 fc ff ff       	call   803944 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803ccc:	83 c4 10             	add    $0x10,%esp
+  803ccf:	85 c0                	test   %eax,%eax
+  803cd1:	74 b9                	je     803c8c <page_alloc+0x1e>
+  803cd3:	8b 10                	mov    (%eax),%edx
+  803cd5:	f6 c2 01             	test   $0x1,%dl
+  803cd8:	74 b2                	je     803c8c <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803cda:	83 ec 08             	sub    $0x8,%esp
+  803cdd:	56                   	push   %esi
+  803cde:	52                   	push   %edx
+  803cdf:	50                   	push   %eax
+  803ce0:	68 68 5e 80 00       	push   $0x805e68
+  803ce5:	68 34 03 00 00       	push   $0x334
+  803cea:	68 5b 5b 80 00       	push   $0x805b5b
+  803cef:	e8 a3 c5 ff ff       	call   800297 <_panic>
+	return 0;
+  803cf4:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803cf9:	89 d8                	mov    %ebx,%eax
+  803cfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cfe:	5b                   	pop    %ebx
+  803cff:	5e                   	pop    %esi
+  803d00:	5f                   	pop    %edi
+  803d01:	5d                   	pop    %ebp
+  803d02:	c3                   	ret
+
+00803d03 <page_adopt>:
+{
+  803d03:	55                   	push   %ebp
+  803d04:	89 e5                	mov    %esp,%ebp
+  803d06:	56                   	push   %esi
+  803d07:	53                   	push   %ebx
+  803d08:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803d0a:	c1 e8 16             	shr    $0x16,%eax
+  803d0d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803d14:	25 81 00 00 00       	and    $0x81,%eax
+  803d19:	83 f8 01             	cmp    $0x1,%eax
+  803d1c:	75 53                	jne    803d71 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803d1e:	89 d8                	mov    %ebx,%eax
+  803d20:	c1 e8 0c             	shr    $0xc,%eax
+  803d23:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803d2a:	89 f2                	mov    %esi,%edx
+  803d2c:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803d32:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803d37:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803d3d:	75 37                	jne    803d76 <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803d3f:	83 ec 08             	sub    $0x8,%esp
+  803d42:	6a 01                	push   $0x1
+  803d44:	53                   	push   %ebx
+  803d45:	e8 fa fb ff ff       	call   803944 <umapdir_walk>
+  803d4a:	83 c4 10             	add    $0x10,%esp
+  803d4d:	85 c0                	test   %eax,%eax
+  803d4f:	74 2c                	je     803d7d <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803d51:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803d57:	83 ce 01             	or     $0x1,%esi
+  803d5a:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803d5c:	83 ec 08             	sub    $0x8,%esp
+  803d5f:	53                   	push   %ebx
+  803d60:	6a 00                	push   $0x0
+  803d62:	e8 6a d1 ff ff       	call   800ed1 <sys_page_unmap>
+	return 1;
+  803d67:	83 c4 10             	add    $0x10,%esp
+  803d6a:	b8 01 00 00 00       	mov    $0x1,%eax
+  803d6f:	eb 05                	jmp    803d76 <page_adopt+0x73>
+		return 0;
+  803d71:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d79:	5b                   	pop    %ebx
+  803d7a:	5e                   	pop    %esi
+  803d7b:	5d                   	pop    %ebp
+  803d7c:	c3                   	ret
+		return -E_NO_MEM;
+  803d7d:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803d82:	eb f2                	jmp    803d76 <page_adopt+0x73>
+
+00803d84 <page_forget>:
+{
+  803d84:	55                   	push   %ebp
+  803d85:	89 e5                	mov    %esp,%ebp
+  803d87:	53                   	push   %ebx
+  803d88:	83 ec 04             	sub    $0x4,%esp
+  803d8b:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803d8d:	e8 4a ef ff ff       	call   802cdc <find_paging_env>
+	if (pagingenv == 0)
+  803d92:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803d99:	74 39                	je     803dd4 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803d9b:	89 d8                	mov    %ebx,%eax
+  803d9d:	c1 e8 16             	shr    $0x16,%eax
+  803da0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803da7:	25 81 00 00 00       	and    $0x81,%eax
+  803dac:	83 f8 01             	cmp    $0x1,%eax
+  803daf:	74 28                	je     803dd9 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803db1:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803db8:	74 1a                	je     803dd4 <page_forget+0x50>
+  803dba:	83 ec 08             	sub    $0x8,%esp
+  803dbd:	6a 00                	push   $0x0
+  803dbf:	53                   	push   %ebx
+  803dc0:	e8 7f fb ff ff       	call   803944 <umapdir_walk>
+  803dc5:	89 c3                	mov    %eax,%ebx
+  803dc7:	83 c4 10             	add    $0x10,%esp
+  803dca:	85 c0                	test   %eax,%eax
+  803dcc:	74 06                	je     803dd4 <page_forget+0x50>
+  803dce:	8b 00                	mov    (%eax),%eax
+  803dd0:	a8 01                	test   $0x1,%al
+  803dd2:	75 2b                	jne    803dff <page_forget+0x7b>
+}
+  803dd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803dd7:	c9                   	leave
+  803dd8:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803dd9:	89 d8                	mov    %ebx,%eax
+  803ddb:	c1 e8 0c             	shr    $0xc,%eax
+  803dde:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803de5:	89 c2                	mov    %eax,%edx
+  803de7:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803ded:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803df3:	75 bc                	jne    803db1 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803df5:	c1 e8 0c             	shr    $0xc,%eax
+  803df8:	e8 5c ee ff ff       	call   802c59 <page_remove_slot>
+		return;
+  803dfd:	eb d5                	jmp    803dd4 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803dff:	c1 e8 0c             	shr    $0xc,%eax
+  803e02:	e8 52 ee ff ff       	call   802c59 <page_remove_slot>
+	*mte = 0;
+  803e07:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803e0d:	eb c5                	jmp    803dd4 <page_forget+0x50>
+
+00803e0f <page_unmap>:
+{
+  803e0f:	55                   	push   %ebp
+  803e10:	89 e5                	mov    %esp,%ebp
+  803e12:	57                   	push   %edi
+  803e13:	56                   	push   %esi
+  803e14:	53                   	push   %ebx
+  803e15:	83 ec 0c             	sub    $0xc,%esp
+  803e18:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803e1b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803e1e:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803e23:	8b 40 48             	mov    0x48(%eax),%eax
+  803e26:	85 db                	test   %ebx,%ebx
+  803e28:	0f 8e b4 00 00 00    	jle    803ee2 <page_unmap+0xd3>
+  803e2e:	39 d8                	cmp    %ebx,%eax
+  803e30:	0f 84 ac 00 00 00    	je     803ee2 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803e36:	83 ec 08             	sub    $0x8,%esp
+  803e39:	57                   	push   %edi
+  803e3a:	53                   	push   %ebx
+  803e3b:	e8 91 d0 ff ff       	call   800ed1 <sys_page_unmap>
+  803e40:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803e42:	e8 95 ee ff ff       	call   802cdc <find_paging_env>
+	if (pagingenv == 0)
+  803e47:	83 c4 10             	add    $0x10,%esp
+  803e4a:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803e51:	0f 84 a1 00 00 00    	je     803ef8 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803e57:	83 ec 0c             	sub    $0xc,%esp
+  803e5a:	6a 05                	push   $0x5
+  803e5c:	68 00 00 40 00       	push   $0x400000
+  803e61:	6a 00                	push   $0x0
+  803e63:	68 00 b0 ad de       	push   $0xdeadb000
+  803e68:	53                   	push   %ebx
+  803e69:	e8 21 d0 ff ff       	call   800e8f <sys_page_map>
+  803e6e:	83 c4 20             	add    $0x20,%esp
+  803e71:	85 c0                	test   %eax,%eax
+  803e73:	0f 88 89 00 00 00    	js     803f02 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803e79:	89 f8                	mov    %edi,%eax
+  803e7b:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803e7e:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803e85:	a8 01                	test   $0x1,%al
+  803e87:	74 6f                	je     803ef8 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803e89:	83 ec 0c             	sub    $0xc,%esp
+  803e8c:	6a 05                	push   $0x5
+  803e8e:	68 00 00 40 00       	push   $0x400000
+  803e93:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803e95:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803e9a:	50                   	push   %eax
+  803e9b:	53                   	push   %ebx
+  803e9c:	e8 ee cf ff ff       	call   800e8f <sys_page_map>
+  803ea1:	83 c4 20             	add    $0x20,%esp
+  803ea4:	85 c0                	test   %eax,%eax
+  803ea6:	78 6f                	js     803f17 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803ea8:	c1 ef 0c             	shr    $0xc,%edi
+  803eab:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803eb1:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803eb8:	01 
+  803eb9:	74 3d                	je     803ef8 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803ebb:	83 ec 08             	sub    $0x8,%esp
+  803ebe:	68 00 00 40 00       	push   $0x400000
+  803ec3:	6a 00                	push   $0x0
+  803ec5:	e8 07 d0 ff ff       	call   800ed1 <sys_page_unmap>
+  803eca:	83 c4 10             	add    $0x10,%esp
+  803ecd:	85 c0                	test   %eax,%eax
+  803ecf:	78 5b                	js     803f2c <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803ed1:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803ed8:	c1 e8 0c             	shr    $0xc,%eax
+  803edb:	e8 79 ed ff ff       	call   802c59 <page_remove_slot>
+	return r;
+  803ee0:	eb 16                	jmp    803ef8 <page_unmap+0xe9>
+		page_forget(va);
+  803ee2:	89 f8                	mov    %edi,%eax
+  803ee4:	e8 9b fe ff ff       	call   803d84 <page_forget>
+		return sys_page_unmap(envid, va);
+  803ee9:	83 ec 08             	sub    $0x8,%esp
+  803eec:	57                   	push   %edi
+  803eed:	53                   	push   %ebx
+  803eee:	e8 de cf ff ff       	call   800ed1 <sys_page_unmap>
+  803ef3:	89 c6                	mov    %eax,%esi
+  803ef5:	83 c4 10             	add    $0x10,%esp
+}
+  803ef8:	89 f0                	mov    %esi,%eax
+  803efa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803efd:	5b                   	pop    %ebx
+  803efe:	5e                   	pop    %esi
+  803eff:	5f                   	pop    %edi
+  803f00:	5d                   	pop    %ebp
+  803f01:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803f02:	50                   	push   %eax
+  803f03:	68 a4 5e 80 00       	push   $0x805ea4
+  803f08:	68 e4 03 00 00       	push   $0x3e4
+  803f0d:	68 5b 5b 80 00       	push   $0x805b5b
+  803f12:	e8 80 c3 ff ff       	call   800297 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803f17:	50                   	push   %eax
+  803f18:	68 d0 5e 80 00       	push   $0x805ed0
+  803f1d:	68 ea 03 00 00       	push   $0x3ea
+  803f22:	68 5b 5b 80 00       	push   $0x805b5b
+  803f27:	e8 6b c3 ff ff       	call   800297 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803f2c:	50                   	push   %eax
+  803f2d:	68 fc 5e 80 00       	push   $0x805efc
+  803f32:	68 ef 03 00 00       	push   $0x3ef
+  803f37:	68 5b 5b 80 00       	push   $0x805b5b
+  803f3c:	e8 56 c3 ff ff       	call   800297 <_panic>
+
+00803f41 <page_unmap_range>:
+{
+  803f41:	55                   	push   %ebp
+  803f42:	89 e5                	mov    %esp,%ebp
+  803f44:	57                   	push   %edi
+  803f45:	56                   	push   %esi
+  803f46:	53                   	push   %ebx
+  803f47:	83 ec 0c             	sub    $0xc,%esp
+  803f4a:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803f4d:	e8 8a ed ff ff       	call   802cdc <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803f52:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803f57:	8b 40 48             	mov    0x48(%eax),%eax
+  803f5a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803f5e:	7e 38                	jle    803f98 <page_unmap_range+0x57>
+  803f60:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803f63:	74 33                	je     803f98 <page_unmap_range+0x57>
+  803f65:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803f6c:	74 2a                	je     803f98 <page_unmap_range+0x57>
+  803f6e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  803f71:	be 00 00 00 00       	mov    $0x0,%esi
+  803f76:	39 fe                	cmp    %edi,%esi
+  803f78:	74 56                	je     803fd0 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  803f7a:	83 ec 08             	sub    $0x8,%esp
+  803f7d:	53                   	push   %ebx
+  803f7e:	ff 75 08             	push   0x8(%ebp)
+  803f81:	e8 89 fe ff ff       	call   803e0f <page_unmap>
+  803f86:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803f8c:	83 c4 10             	add    $0x10,%esp
+  803f8f:	85 c0                	test   %eax,%eax
+  803f91:	78 35                	js     803fc8 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  803f93:	83 c6 01             	add    $0x1,%esi
+  803f96:	eb de                	jmp    803f76 <page_unmap_range+0x35>
+  803f98:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803f9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803fa0:	eb 10                	jmp    803fb2 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803fa2:	89 f0                	mov    %esi,%eax
+  803fa4:	e8 db fd ff ff       	call   803d84 <page_forget>
+		for (i = 0; i < npages; i++)
+  803fa9:	83 c3 01             	add    $0x1,%ebx
+  803fac:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803fb2:	39 fb                	cmp    %edi,%ebx
+  803fb4:	75 ec                	jne    803fa2 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  803fb6:	83 ec 04             	sub    $0x4,%esp
+  803fb9:	57                   	push   %edi
+  803fba:	ff 75 0c             	push   0xc(%ebp)
+  803fbd:	ff 75 08             	push   0x8(%ebp)
+  803fc0:	e8 20 d0 ff ff       	call   800fe5 <sys_page_unmap_range>
+  803fc5:	83 c4 10             	add    $0x10,%esp
+}
+  803fc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fcb:	5b                   	pop    %ebx
+  803fcc:	5e                   	pop    %esi
+  803fcd:	5f                   	pop    %edi
+  803fce:	5d                   	pop    %ebp
+  803fcf:	c3                   	ret
+	return 0;
+  803fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd5:	eb f1                	jmp    803fc8 <page_unmap_range+0x87>
+
+00803fd7 <page_alloc_range>:
+{
+  803fd7:	55                   	push   %ebp
+  803fd8:	89 e5                	mov    %esp,%ebp
+  803fda:	57                   	push   %edi
+  803fdb:	56                   	push   %esi
+  803fdc:	53                   	push   %ebx
+  803fdd:	83 ec 1c             	sub    $0x1c,%esp
+  803fe0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803fe3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  803fe6:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803fed:	74 14                	je     804003 <page_alloc_range+0x2c>
+	if (check_mte)
+  803fef:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803ff3:	74 66                	je     80405b <page_alloc_range+0x84>
+  803ff5:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  803ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ffc:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803fff:	89 c7                	mov    %eax,%edi
+  804001:	eb 10                	jmp    804013 <page_alloc_range+0x3c>
+		init_map_dir();
+  804003:	e8 e6 f8 ff ff       	call   8038ee <init_map_dir>
+  804008:	eb e5                	jmp    803fef <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  80400a:	83 c7 01             	add    $0x1,%edi
+  80400d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  804013:	39 df                	cmp    %ebx,%edi
+  804015:	74 38                	je     80404f <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  804017:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80401a:	83 ec 08             	sub    $0x8,%esp
+  80401d:	6a 00                	push   $0x0
+  80401f:	56                   	push   %esi
+  804020:	e8 1f f9 ff ff       	call   803944 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  804025:	83 c4 10             	add    $0x10,%esp
+  804028:	85 c0                	test   %eax,%eax
+  80402a:	74 de                	je     80400a <page_alloc_range+0x33>
+  80402c:	8b 10                	mov    (%eax),%edx
+  80402e:	f6 c2 01             	test   $0x1,%dl
+  804031:	74 d7                	je     80400a <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  804033:	83 ec 08             	sub    $0x8,%esp
+  804036:	ff 75 e4             	push   -0x1c(%ebp)
+  804039:	52                   	push   %edx
+  80403a:	50                   	push   %eax
+  80403b:	68 68 5e 80 00       	push   $0x805e68
+  804040:	68 0b 04 00 00       	push   $0x40b
+  804045:	68 5b 5b 80 00       	push   $0x805b5b
+  80404a:	e8 48 c2 ff ff       	call   800297 <_panic>
+  80404f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804052:	eb 07                	jmp    80405b <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  804054:	c1 e0 0c             	shl    $0xc,%eax
+  804057:	01 c7                	add    %eax,%edi
+			npages -= r;
+  804059:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  80405b:	85 db                	test   %ebx,%ebx
+  80405d:	74 30                	je     80408f <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  80405f:	ff 75 14             	push   0x14(%ebp)
+  804062:	53                   	push   %ebx
+  804063:	57                   	push   %edi
+  804064:	ff 75 08             	push   0x8(%ebp)
+  804067:	e8 0b cf ff ff       	call   800f77 <sys_page_alloc_range>
+  80406c:	89 c6                	mov    %eax,%esi
+  80406e:	83 c4 10             	add    $0x10,%esp
+  804071:	85 c0                	test   %eax,%eax
+  804073:	7f df                	jg     804054 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  804075:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  804078:	75 1a                	jne    804094 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  80407a:	83 ec 08             	sub    $0x8,%esp
+  80407d:	57                   	push   %edi
+  80407e:	ff 75 08             	push   0x8(%ebp)
+  804081:	e8 68 f9 ff ff       	call   8039ee <page_out>
+  804086:	83 c4 10             	add    $0x10,%esp
+  804089:	85 c0                	test   %eax,%eax
+  80408b:	79 ce                	jns    80405b <page_alloc_range+0x84>
+  80408d:	eb 05                	jmp    804094 <page_alloc_range+0xbd>
+	return 0;
+  80408f:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  804094:	89 f0                	mov    %esi,%eax
+  804096:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804099:	5b                   	pop    %ebx
+  80409a:	5e                   	pop    %esi
+  80409b:	5f                   	pop    %edi
+  80409c:	5d                   	pop    %ebp
+  80409d:	c3                   	ret
+
+0080409e <page_in>:
+{
+  80409e:	55                   	push   %ebp
+  80409f:	89 e5                	mov    %esp,%ebp
+  8040a1:	57                   	push   %edi
+  8040a2:	56                   	push   %esi
+  8040a3:	53                   	push   %ebx
+  8040a4:	83 ec 3c             	sub    $0x3c,%esp
+  8040a7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  8040aa:	e8 2d ec ff ff       	call   802cdc <find_paging_env>
+	if (pagingenv == 0)
+  8040af:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  8040b6:	0f 84 09 02 00 00    	je     8042c5 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  8040bc:	83 ec 08             	sub    $0x8,%esp
+  8040bf:	6a 00                	push   $0x0
+  8040c1:	56                   	push   %esi
+  8040c2:	e8 7d f8 ff ff       	call   803944 <umapdir_walk>
+  8040c7:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8040c9:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8040cf:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  8040d2:	83 c4 10             	add    $0x10,%esp
+  8040d5:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8040d9:	74 0d                	je     8040e8 <page_in+0x4a>
+  8040db:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8040e0:	8b 40 48             	mov    0x48(%eax),%eax
+  8040e3:	3b 45 08             	cmp    0x8(%ebp),%eax
+  8040e6:	75 06                	jne    8040ee <page_in+0x50>
+  8040e8:	8b 03                	mov    (%ebx),%eax
+  8040ea:	a8 02                	test   $0x2,%al
+  8040ec:	75 63                	jne    804151 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  8040ee:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  8040f0:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  8040f2:	89 f0                	mov    %esi,%eax
+  8040f4:	25 06 0e 00 00       	and    $0xe06,%eax
+  8040f9:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  8040fc:	50                   	push   %eax
+  8040fd:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804100:	57                   	push   %edi
+  804101:	ff 75 08             	push   0x8(%ebp)
+  804104:	e8 65 fb ff ff       	call   803c6e <page_alloc>
+  804109:	83 c4 10             	add    $0x10,%esp
+  80410c:	85 c0                	test   %eax,%eax
+  80410e:	78 39                	js     804149 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  804110:	89 f0                	mov    %esi,%eax
+  804112:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  804115:	83 ec 0c             	sub    $0xc,%esp
+  804118:	6a 07                	push   $0x7
+  80411a:	6a 01                	push   $0x1
+  80411c:	57                   	push   %edi
+  80411d:	c1 e0 04             	shl    $0x4,%eax
+  804120:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  804121:	c1 ee 1c             	shr    $0x1c,%esi
+  804124:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  804127:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  80412e:	e8 f1 0f 00 00       	call   805124 <ipc_call>
+  804133:	83 c4 20             	add    $0x20,%esp
+  804136:	85 c0                	test   %eax,%eax
+  804138:	0f 88 72 01 00 00    	js     8042b0 <page_in+0x212>
+	*mte = 0;
+  80413e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  804144:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804149:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80414c:	5b                   	pop    %ebx
+  80414d:	5e                   	pop    %esi
+  80414e:	5f                   	pop    %edi
+  80414f:	5d                   	pop    %ebp
+  804150:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804151:	25 06 0e 00 00       	and    $0xe06,%eax
+  804156:	83 c8 01             	or     $0x1,%eax
+  804159:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  80415c:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  80415f:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  804162:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  804168:	be 01 00 00 00       	mov    $0x1,%esi
+  80416d:	eb 46                	jmp    8041b5 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  80416f:	83 ec 08             	sub    $0x8,%esp
+  804172:	6a 00                	push   $0x0
+  804174:	51                   	push   %ecx
+  804175:	e8 ca f7 ff ff       	call   803944 <umapdir_walk>
+  80417a:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  80417e:	83 c4 10             	add    $0x10,%esp
+  804181:	85 c0                	test   %eax,%eax
+  804183:	74 66                	je     8041eb <page_in+0x14d>
+  804185:	8b 00                	mov    (%eax),%eax
+  804187:	a8 01                	test   $0x1,%al
+  804189:	74 60                	je     8041eb <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  80418b:	89 c2                	mov    %eax,%edx
+  80418d:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  804193:	83 ca 01             	or     $0x1,%edx
+  804196:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  804199:	75 50                	jne    8041eb <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  80419b:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8041a1:	c1 e8 1c             	shr    $0x1c,%eax
+  8041a4:	8b 13                	mov    (%ebx),%edx
+  8041a6:	c1 ea 1c             	shr    $0x1c,%edx
+  8041a9:	39 d0                	cmp    %edx,%eax
+  8041ab:	75 3e                	jne    8041eb <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  8041ad:	83 c6 01             	add    $0x1,%esi
+  8041b0:	83 fe 08             	cmp    $0x8,%esi
+  8041b3:	74 3f                	je     8041f4 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  8041b5:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8041b7:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  8041bd:	77 2c                	ja     8041eb <page_in+0x14d>
+  8041bf:	89 f8                	mov    %edi,%eax
+  8041c1:	c1 e8 16             	shr    $0x16,%eax
+  8041c4:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8041cb:	f6 c2 01             	test   $0x1,%dl
+  8041ce:	74 9f                	je     80416f <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  8041d0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8041d7:	a8 80                	test   $0x80,%al
+  8041d9:	75 10                	jne    8041eb <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  8041db:	89 f8                	mov    %edi,%eax
+  8041dd:	c1 e8 0c             	shr    $0xc,%eax
+  8041e0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8041e7:	a8 01                	test   $0x1,%al
+  8041e9:	74 84                	je     80416f <page_in+0xd1>
+	if (n == 1)
+  8041eb:	83 fe 01             	cmp    $0x1,%esi
+  8041ee:	0f 84 fa fe ff ff    	je     8040ee <page_in+0x50>
+	req.nslots = n;
+  8041f4:	89 35 00 90 80 00    	mov    %esi,0x809000
+	for (i = 0; i < n; i++)
+  8041fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ff:	eb 13                	jmp    804214 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  804201:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  804205:	8b 12                	mov    (%edx),%edx
+  804207:	c1 ea 0c             	shr    $0xc,%edx
+  80420a:	89 14 85 04 90 80 00 	mov    %edx,0x809004(,%eax,4)
+	for (i = 0; i < n; i++)
+  804211:	83 c0 01             	add    $0x1,%eax
+  804214:	39 c6                	cmp    %eax,%esi
+  804216:	75 e9                	jne    804201 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  804218:	83 ec 0c             	sub    $0xc,%esp
+  80421b:	6a 00                	push   $0x0
+  80421d:	ff 75 c0             	push   -0x40(%ebp)
+  804220:	56                   	push   %esi
+  804221:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804224:	57                   	push   %edi
+  804225:	6a 00                	push   $0x0
+  804227:	e8 ab fd ff ff       	call   803fd7 <page_alloc_range>
+  80422c:	83 c4 20             	add    $0x20,%esp
+  80422f:	85 c0                	test   %eax,%eax
+  804231:	78 6e                	js     8042a1 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  804233:	83 ec 04             	sub    $0x4,%esp
+  804236:	6a 24                	push   $0x24
+  804238:	68 00 90 80 00       	push   $0x809000
+  80423d:	57                   	push   %edi
+  80423e:	e8 9c c8 ff ff       	call   800adf <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804243:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80424a:	56                   	push   %esi
+  80424b:	57                   	push   %edi
+  80424c:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  80424e:	0f b7 05 06 90 80 00 	movzwl 0x809006,%eax
+  804255:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804258:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  80425f:	e8 c0 0e 00 00       	call   805124 <ipc_call>
+  804264:	83 c4 20             	add    $0x20,%esp
+  804267:	85 c0                	test   %eax,%eax
+  804269:	78 08                	js     804273 <page_in+0x1d5>
+  80426b:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80426e:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  804271:	eb 20                	jmp    804293 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  804273:	50                   	push   %eax
+  804274:	68 28 5f 80 00       	push   $0x805f28
+  804279:	68 59 02 00 00       	push   $0x259
+  80427e:	68 5b 5b 80 00       	push   $0x805b5b
+  804283:	e8 0f c0 ff ff       	call   800297 <_panic>
+		*mtes[i] = 0;
+  804288:	8b 10                	mov    (%eax),%edx
+  80428a:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  804290:	83 c0 04             	add    $0x4,%eax
+  804293:	39 c8                	cmp    %ecx,%eax
+  804295:	75 f1                	jne    804288 <page_in+0x1ea>
+	return n;
+  804297:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  804299:	85 f6                	test   %esi,%esi
+  80429b:	0f 84 4d fe ff ff    	je     8040ee <page_in+0x50>
+		return r < 0 ? r : 0;
+  8042a1:	85 c0                	test   %eax,%eax
+  8042a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042a8:	0f 4f c2             	cmovg  %edx,%eax
+  8042ab:	e9 99 fe ff ff       	jmp    804149 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  8042b0:	50                   	push   %eax
+  8042b1:	68 60 5f 80 00       	push   $0x805f60
+  8042b6:	68 9a 02 00 00       	push   $0x29a
+  8042bb:	68 5b 5b 80 00       	push   $0x805b5b
+  8042c0:	e8 d2 bf ff ff       	call   800297 <_panic>
+		return -E_PAGING;
+  8042c5:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8042ca:	e9 7a fe ff ff       	jmp    804149 <page_in+0xab>
+
+008042cf <page_map>:
+{
+  8042cf:	55                   	push   %ebp
+  8042d0:	89 e5                	mov    %esp,%ebp
+  8042d2:	57                   	push   %edi
+  8042d3:	56                   	push   %esi
+  8042d4:	53                   	push   %ebx
+  8042d5:	83 ec 1c             	sub    $0x1c,%esp
+  8042d8:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8042db:	83 ec 0c             	sub    $0xc,%esp
+  8042de:	ff 75 18             	push   0x18(%ebp)
+  8042e1:	ff 75 14             	push   0x14(%ebp)
+  8042e4:	ff 75 10             	push   0x10(%ebp)
+  8042e7:	ff 75 0c             	push   0xc(%ebp)
+  8042ea:	56                   	push   %esi
+  8042eb:	e8 9f cb ff ff       	call   800e8f <sys_page_map>
+  8042f0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8042f3:	83 c4 20             	add    $0x20,%esp
+  8042f6:	85 c0                	test   %eax,%eax
+  8042f8:	0f 89 a9 01 00 00    	jns    8044a7 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  8042fe:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  804302:	74 5f                	je     804363 <page_map+0x94>
+		if (r != -E_INVAL)
+  804304:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  804308:	0f 85 a0 01 00 00    	jne    8044ae <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  80430e:	85 f6                	test   %esi,%esi
+  804310:	74 70                	je     804382 <page_map+0xb3>
+  804312:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804317:	8b 40 48             	mov    0x48(%eax),%eax
+  80431a:	39 f0                	cmp    %esi,%eax
+  80431c:	74 64                	je     804382 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80431e:	83 ec 0c             	sub    $0xc,%esp
+  804321:	6a 05                	push   $0x5
+  804323:	68 00 00 40 00       	push   $0x400000
+  804328:	6a 00                	push   $0x0
+  80432a:	68 00 b0 ad de       	push   $0xdeadb000
+  80432f:	56                   	push   %esi
+  804330:	e8 5a cb ff ff       	call   800e8f <sys_page_map>
+  804335:	89 c3                	mov    %eax,%ebx
+  804337:	83 c4 20             	add    $0x20,%esp
+  80433a:	85 c0                	test   %eax,%eax
+  80433c:	79 6a                	jns    8043a8 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  80433e:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804341:	75 50                	jne    804393 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  804343:	83 ec 08             	sub    $0x8,%esp
+  804346:	68 00 00 40 00       	push   $0x400000
+  80434b:	6a fc                	push   $0xfffffffc
+  80434d:	e8 9c f6 ff ff       	call   8039ee <page_out>
+  804352:	83 c4 10             	add    $0x10,%esp
+  804355:	85 c0                	test   %eax,%eax
+  804357:	79 c5                	jns    80431e <page_map+0x4f>
+}
+  804359:	89 d8                	mov    %ebx,%eax
+  80435b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80435e:	5b                   	pop    %ebx
+  80435f:	5e                   	pop    %esi
+  804360:	5f                   	pop    %edi
+  804361:	5d                   	pop    %ebp
+  804362:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  804363:	83 ec 08             	sub    $0x8,%esp
+  804366:	68 00 00 40 00       	push   $0x400000
+  80436b:	6a 00                	push   $0x0
+  80436d:	e8 7c f6 ff ff       	call   8039ee <page_out>
+  804372:	83 c4 10             	add    $0x10,%esp
+  804375:	85 c0                	test   %eax,%eax
+  804377:	0f 89 5e ff ff ff    	jns    8042db <page_map+0xc>
+				return r;
+  80437d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804380:	eb d7                	jmp    804359 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804382:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804385:	e8 79 f9 ff ff       	call   803d03 <page_adopt>
+  80438a:	85 c0                	test   %eax,%eax
+  80438c:	79 90                	jns    80431e <page_map+0x4f>
+			return r;
+  80438e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804391:	eb c6                	jmp    804359 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  804393:	53                   	push   %ebx
+  804394:	68 94 5f 80 00       	push   $0x805f94
+  804399:	68 77 03 00 00       	push   $0x377
+  80439e:	68 5b 5b 80 00       	push   $0x805b5b
+  8043a3:	e8 ef be ff ff       	call   800297 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  8043a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8043ab:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8043ae:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  8043b5:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8043bb:	0f 84 f5 00 00 00    	je     8044b6 <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8043c1:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8043c7:	83 ec 0c             	sub    $0xc,%esp
+  8043ca:	6a 05                	push   $0x5
+  8043cc:	68 00 00 40 00       	push   $0x400000
+  8043d1:	6a 00                	push   $0x0
+  8043d3:	57                   	push   %edi
+  8043d4:	56                   	push   %esi
+  8043d5:	e8 b5 ca ff ff       	call   800e8f <sys_page_map>
+  8043da:	89 c3                	mov    %eax,%ebx
+  8043dc:	83 c4 20             	add    $0x20,%esp
+  8043df:	85 c0                	test   %eax,%eax
+  8043e1:	79 35                	jns    804418 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  8043e3:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8043e6:	75 1b                	jne    804403 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8043e8:	83 ec 08             	sub    $0x8,%esp
+  8043eb:	68 00 00 40 00       	push   $0x400000
+  8043f0:	6a 00                	push   $0x0
+  8043f2:	e8 f7 f5 ff ff       	call   8039ee <page_out>
+  8043f7:	83 c4 10             	add    $0x10,%esp
+  8043fa:	85 c0                	test   %eax,%eax
+  8043fc:	79 c9                	jns    8043c7 <page_map+0xf8>
+  8043fe:	e9 56 ff ff ff       	jmp    804359 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  804403:	53                   	push   %ebx
+  804404:	68 bc 5f 80 00       	push   $0x805fbc
+  804409:	68 83 03 00 00       	push   $0x383
+  80440e:	68 5b 5b 80 00       	push   $0x805b5b
+  804413:	e8 7f be ff ff       	call   800297 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  804418:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80441b:	c1 e8 0c             	shr    $0xc,%eax
+  80441e:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  804423:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  80442a:	01 
+  80442b:	0f 84 8d 00 00 00    	je     8044be <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  804431:	83 ec 08             	sub    $0x8,%esp
+  804434:	68 00 00 40 00       	push   $0x400000
+  804439:	6a 00                	push   $0x0
+  80443b:	e8 91 ca ff ff       	call   800ed1 <sys_page_unmap>
+  804440:	83 c4 10             	add    $0x10,%esp
+  804443:	85 c0                	test   %eax,%eax
+  804445:	78 36                	js     80447d <page_map+0x1ae>
+  804447:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  80444a:	83 ec 08             	sub    $0x8,%esp
+  80444d:	57                   	push   %edi
+  80444e:	56                   	push   %esi
+  80444f:	e8 4a fc ff ff       	call   80409e <page_in>
+  804454:	89 c3                	mov    %eax,%ebx
+  804456:	83 c4 10             	add    $0x10,%esp
+  804459:	85 c0                	test   %eax,%eax
+  80445b:	0f 89 7a fe ff ff    	jns    8042db <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  804461:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804464:	75 2c                	jne    804492 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  804466:	83 ec 08             	sub    $0x8,%esp
+  804469:	57                   	push   %edi
+  80446a:	6a 00                	push   $0x0
+  80446c:	e8 7d f5 ff ff       	call   8039ee <page_out>
+  804471:	83 c4 10             	add    $0x10,%esp
+  804474:	85 c0                	test   %eax,%eax
+  804476:	79 d2                	jns    80444a <page_map+0x17b>
+  804478:	e9 dc fe ff ff       	jmp    804359 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  80447d:	50                   	push   %eax
+  80447e:	68 e8 5f 80 00       	push   $0x805fe8
+  804483:	68 8b 03 00 00       	push   $0x38b
+  804488:	68 5b 5b 80 00       	push   $0x805b5b
+  80448d:	e8 05 be ff ff       	call   800297 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  804492:	53                   	push   %ebx
+  804493:	68 10 60 80 00       	push   $0x806010
+  804498:	68 91 03 00 00       	push   $0x391
+  80449d:	68 5b 5b 80 00       	push   $0x805b5b
+  8044a2:	e8 f0 bd ff ff       	call   800297 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8044a7:	89 c3                	mov    %eax,%ebx
+  8044a9:	e9 ab fe ff ff       	jmp    804359 <page_map+0x8a>
+  8044ae:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8044b1:	e9 a3 fe ff ff       	jmp    804359 <page_map+0x8a>
+			return r; // Pass through the error
+  8044b6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8044b9:	e9 9b fe ff ff       	jmp    804359 <page_map+0x8a>
+			return r; // Pass through the error
+  8044be:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8044c1:	e9 93 fe ff ff       	jmp    804359 <page_map+0x8a>
+
+008044c6 <page_map_range>:
+{
+  8044c6:	55                   	push   %ebp
+  8044c7:	89 e5                	mov    %esp,%ebp
+  8044c9:	57                   	push   %edi
+  8044ca:	56                   	push   %esi
+  8044cb:	53                   	push   %ebx
+  8044cc:	83 ec 0c             	sub    $0xc,%esp
+  8044cf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8044d2:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  8044d5:	83 ec 08             	sub    $0x8,%esp
+  8044d8:	ff 75 1c             	push   0x1c(%ebp)
+  8044db:	ff 75 18             	push   0x18(%ebp)
+  8044de:	56                   	push   %esi
+  8044df:	ff 75 10             	push   0x10(%ebp)
+  8044e2:	57                   	push   %edi
+  8044e3:	ff 75 08             	push   0x8(%ebp)
+  8044e6:	e8 af ca ff ff       	call   800f9a <sys_page_map_range>
+  8044eb:	89 c3                	mov    %eax,%ebx
+  8044ed:	83 c4 20             	add    $0x20,%esp
+  8044f0:	85 c0                	test   %eax,%eax
+  8044f2:	79 1b                	jns    80450f <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  8044f4:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8044f7:	75 20                	jne    804519 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8044f9:	83 ec 08             	sub    $0x8,%esp
+  8044fc:	68 00 00 40 00       	push   $0x400000
+  804501:	6a 00                	push   $0x0
+  804503:	e8 e6 f4 ff ff       	call   8039ee <page_out>
+  804508:	83 c4 10             	add    $0x10,%esp
+  80450b:	85 c0                	test   %eax,%eax
+  80450d:	79 c6                	jns    8044d5 <page_map_range+0xf>
+}
+  80450f:	89 d8                	mov    %ebx,%eax
+  804511:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804514:	5b                   	pop    %ebx
+  804515:	5e                   	pop    %esi
+  804516:	5f                   	pop    %edi
+  804517:	5d                   	pop    %ebp
+  804518:	c3                   	ret
+		if (r != -E_INVAL)
+  804519:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  80451c:	75 f1                	jne    80450f <page_map_range+0x49>
+  80451e:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  804520:	be 00 00 00 00       	mov    $0x0,%esi
+  804525:	eb 03                	jmp    80452a <page_map_range+0x64>
+  804527:	83 c6 01             	add    $0x1,%esi
+  80452a:	3b 75 18             	cmp    0x18(%ebp),%esi
+  80452d:	74 2a                	je     804559 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  80452f:	83 ec 0c             	sub    $0xc,%esp
+  804532:	ff 75 1c             	push   0x1c(%ebp)
+  804535:	53                   	push   %ebx
+  804536:	ff 75 10             	push   0x10(%ebp)
+  804539:	57                   	push   %edi
+  80453a:	ff 75 08             	push   0x8(%ebp)
+  80453d:	e8 8d fd ff ff       	call   8042cf <page_map>
+  804542:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804548:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80454e:	83 c4 20             	add    $0x20,%esp
+  804551:	85 c0                	test   %eax,%eax
+  804553:	79 d2                	jns    804527 <page_map_range+0x61>
+  804555:	89 c3                	mov    %eax,%ebx
+  804557:	eb b6                	jmp    80450f <page_map_range+0x49>
+		return 0;
+  804559:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80455e:	eb af                	jmp    80450f <page_map_range+0x49>
+
+00804560 <paging_pgfault_handler>:
+{
+  804560:	55                   	push   %ebp
+  804561:	89 e5                	mov    %esp,%ebp
+  804563:	56                   	push   %esi
+  804564:	53                   	push   %ebx
+  804565:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  804568:	e8 6f e7 ff ff       	call   802cdc <find_paging_env>
+	if (pagingenv == 0)
+  80456d:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  804572:	85 c0                	test   %eax,%eax
+  804574:	74 3c                	je     8045b2 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  804576:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804578:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80457c:	75 12                	jne    804590 <paging_pgfault_handler+0x30>
+  80457e:	89 f0                	mov    %esi,%eax
+  804580:	e8 7e f7 ff ff       	call   803d03 <page_adopt>
+  804585:	89 c2                	mov    %eax,%edx
+		return 0;
+  804587:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  80458c:	85 d2                	test   %edx,%edx
+  80458e:	78 22                	js     8045b2 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  804590:	83 ec 08             	sub    $0x8,%esp
+  804593:	6a 00                	push   $0x0
+  804595:	56                   	push   %esi
+  804596:	e8 a9 f3 ff ff       	call   803944 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  80459b:	83 c4 10             	add    $0x10,%esp
+  80459e:	85 c0                	test   %eax,%eax
+  8045a0:	74 05                	je     8045a7 <paging_pgfault_handler+0x47>
+  8045a2:	f6 00 01             	testb  $0x1,(%eax)
+  8045a5:	75 12                	jne    8045b9 <paging_pgfault_handler+0x59>
+	return 0;
+  8045a7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8045ac:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8045b0:	74 23                	je     8045d5 <paging_pgfault_handler+0x75>
+}
+  8045b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8045b5:	5b                   	pop    %ebx
+  8045b6:	5e                   	pop    %esi
+  8045b7:	5d                   	pop    %ebp
+  8045b8:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  8045b9:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8045be:	8b 40 48             	mov    0x48(%eax),%eax
+  8045c1:	83 ec 08             	sub    $0x8,%esp
+  8045c4:	56                   	push   %esi
+  8045c5:	50                   	push   %eax
+  8045c6:	e8 d3 fa ff ff       	call   80409e <page_in>
+  8045cb:	f7 d0                	not    %eax
+  8045cd:	c1 e8 1f             	shr    $0x1f,%eax
+  8045d0:	83 c4 10             	add    $0x10,%esp
+  8045d3:	eb dd                	jmp    8045b2 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8045d5:	89 f0                	mov    %esi,%eax
+  8045d7:	e8 97 e2 ff ff       	call   802873 <segment_lookup>
+  8045dc:	89 c2                	mov    %eax,%edx
+	return 0;
+  8045de:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8045e3:	85 d2                	test   %edx,%edx
+  8045e5:	74 cb                	je     8045b2 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  8045e7:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8045ec:	8b 40 48             	mov    0x48(%eax),%eax
+  8045ef:	83 ec 08             	sub    $0x8,%esp
+  8045f2:	56                   	push   %esi
+  8045f3:	50                   	push   %eax
+  8045f4:	e8 f5 f3 ff ff       	call   8039ee <page_out>
+  8045f9:	f7 d0                	not    %eax
+  8045fb:	c1 e8 1f             	shr    $0x1f,%eax
+  8045fe:	83 c4 10             	add    $0x10,%esp
+  804601:	eb af                	jmp    8045b2 <paging_pgfault_handler+0x52>
+
+00804603 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  804603:	55                   	push   %ebp
+  804604:	89 e5                	mov    %esp,%ebp
+  804606:	57                   	push   %edi
+  804607:	56                   	push   %esi
+  804608:	53                   	push   %ebx
+  804609:	83 ec 2c             	sub    $0x2c,%esp
+  80460c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  80460f:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  804614:	89 c1                	mov    %eax,%ecx
+  804616:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  804619:	c1 e8 11             	shr    $0x11,%eax
+  80461c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80461f:	8b 3c 85 80 dc 80 00 	mov    0x80dc80(,%eax,4),%edi
+  804626:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  804629:	b8 01 00 00 00       	mov    $0x1,%eax
+  80462e:	d3 e0                	shl    %cl,%eax
+  804630:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  804633:	85 c7                	test   %eax,%edi
+  804635:	74 12                	je     804649 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804637:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80463c:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  80463f:	bf 01 00 00 00       	mov    $0x1,%edi
+  804644:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804647:	eb 17                	jmp    804660 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  804649:	ff 75 e0             	push   -0x20(%ebp)
+  80464c:	68 48 60 80 00       	push   $0x806048
+  804651:	6a 48                	push   $0x48
+  804653:	68 62 60 80 00       	push   $0x806062
+  804658:	e8 3a bc ff ff       	call   800297 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  80465d:	83 c3 01             	add    $0x1,%ebx
+  804660:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804663:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  804666:	89 c8                	mov    %ecx,%eax
+  804668:	c1 e8 05             	shr    $0x5,%eax
+  80466b:	8b 14 85 80 ce 80 00 	mov    0x80ce80(,%eax,4),%edx
+  804672:	89 fe                	mov    %edi,%esi
+  804674:	d3 e6                	shl    %cl,%esi
+  804676:	89 f1                	mov    %esi,%ecx
+  804678:	85 d6                	test   %edx,%esi
+  80467a:	74 e1                	je     80465d <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  80467c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  80467f:	f7 d6                	not    %esi
+  804681:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804684:	21 fe                	and    %edi,%esi
+  804686:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804689:	89 34 bd 80 dc 80 00 	mov    %esi,0x80dc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  804690:	f7 d1                	not    %ecx
+  804692:	21 d1                	and    %edx,%ecx
+  804694:	89 0c 85 80 ce 80 00 	mov    %ecx,0x80ce80(,%eax,4)
+	page_unmap_range(0, va, n);
+  80469b:	83 ec 04             	sub    $0x4,%esp
+  80469e:	53                   	push   %ebx
+  80469f:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8046a2:	57                   	push   %edi
+  8046a3:	6a 00                	push   $0x0
+  8046a5:	e8 97 f8 ff ff       	call   803f41 <page_unmap_range>
+	va_free(va, n);
+  8046aa:	83 c4 08             	add    $0x8,%esp
+  8046ad:	53                   	push   %ebx
+  8046ae:	57                   	push   %edi
+  8046af:	e8 ed 05 00 00       	call   804ca1 <va_free>
+}
+  8046b4:	83 c4 10             	add    $0x10,%esp
+  8046b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046ba:	5b                   	pop    %ebx
+  8046bb:	5e                   	pop    %esi
+  8046bc:	5f                   	pop    %edi
+  8046bd:	5d                   	pop    %ebp
+  8046be:	c3                   	ret
+
+008046bf <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  8046bf:	55                   	push   %ebp
+  8046c0:	89 e5                	mov    %esp,%ebp
+  8046c2:	57                   	push   %edi
+  8046c3:	56                   	push   %esi
+  8046c4:	53                   	push   %ebx
+  8046c5:	83 ec 1c             	sub    $0x1c,%esp
+  8046c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  8046cb:	85 db                	test   %ebx,%ebx
+  8046cd:	74 34                	je     804703 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  8046cf:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8046d5:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  8046da:	77 2f                	ja     80470b <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  8046dc:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8046e2:	75 51                	jne    804735 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  8046e4:	89 c1                	mov    %eax,%ecx
+  8046e6:	c1 e9 0c             	shr    $0xc,%ecx
+  8046e9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8046ee:	d3 e2                	shl    %cl,%edx
+  8046f0:	c1 e8 11             	shr    $0x11,%eax
+  8046f3:	23 14 85 80 c0 80 00 	and    0x80c080(,%eax,4),%edx
+  8046fa:	75 24                	jne    804720 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  8046fc:	89 d8                	mov    %ebx,%eax
+  8046fe:	e8 00 ff ff ff       	call   804603 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  804703:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804706:	5b                   	pop    %ebx
+  804707:	5e                   	pop    %esi
+  804708:	5f                   	pop    %edi
+  804709:	5d                   	pop    %ebp
+  80470a:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  80470b:	53                   	push   %ebx
+  80470c:	68 6f 60 80 00       	push   $0x80606f
+  804711:	68 a2 00 00 00       	push   $0xa2
+  804716:	68 62 60 80 00       	push   $0x806062
+  80471b:	e8 77 bb ff ff       	call   800297 <_panic>
+			panic("free: %p is not allocated", va);
+  804720:	53                   	push   %ebx
+  804721:	68 48 60 80 00       	push   $0x806048
+  804726:	68 a5 00 00 00       	push   $0xa5
+  80472b:	68 62 60 80 00       	push   $0x806062
+  804730:	e8 62 bb ff ff       	call   800297 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  804735:	89 de                	mov    %ebx,%esi
+  804737:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  80473d:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  804743:	89 c8                	mov    %ecx,%eax
+  804745:	c1 e8 11             	shr    $0x11,%eax
+  804748:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80474b:	8b 3c 85 80 c0 80 00 	mov    0x80c080(,%eax,4),%edi
+  804752:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  804755:	c1 e9 0c             	shr    $0xc,%ecx
+  804758:	b8 01 00 00 00       	mov    $0x1,%eax
+  80475d:	d3 e0                	shl    %cl,%eax
+  80475f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804762:	85 c7                	test   %eax,%edi
+  804764:	74 1b                	je     804781 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  804766:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  80476a:	89 d8                	mov    %ebx,%eax
+  80476c:	29 f0                	sub    %esi,%eax
+  80476e:	83 e8 10             	sub    $0x10,%eax
+  804771:	99                   	cltd
+  804772:	f7 ff                	idiv   %edi
+  804774:	89 d1                	mov    %edx,%ecx
+  804776:	85 d2                	test   %edx,%edx
+  804778:	75 07                	jne    804781 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80477a:	ba 10 00 00 00       	mov    $0x10,%edx
+  80477f:	eb 18                	jmp    804799 <free+0xda>
+		panic("free: %p is not allocated", va);
+  804781:	53                   	push   %ebx
+  804782:	68 48 60 80 00       	push   $0x806048
+  804787:	68 ad 00 00 00       	push   $0xad
+  80478c:	68 62 60 80 00       	push   $0x806062
+  804791:	e8 01 bb ff ff       	call   800297 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804796:	83 c1 01             	add    $0x1,%ecx
+  804799:	89 d0                	mov    %edx,%eax
+  80479b:	d3 e0                	shl    %cl,%eax
+  80479d:	39 c7                	cmp    %eax,%edi
+  80479f:	7f f5                	jg     804796 <free+0xd7>
+	*(void **) va = s->free;
+  8047a1:	8b 46 08             	mov    0x8(%esi),%eax
+  8047a4:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  8047a6:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  8047a9:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  8047ad:	8d 58 01             	lea    0x1(%eax),%ebx
+  8047b0:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  8047b4:	66 85 c0             	test   %ax,%ax
+  8047b7:	74 52                	je     80480b <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8047b9:	0f b7 db             	movzwl %bx,%ebx
+  8047bc:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8047c0:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8047c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047ca:	f7 ff                	idiv   %edi
+  8047cc:	39 c3                	cmp    %eax,%ebx
+  8047ce:	0f 85 2f ff ff ff    	jne    804703 <free+0x44>
+  8047d4:	8b 46 04             	mov    0x4(%esi),%eax
+  8047d7:	85 c0                	test   %eax,%eax
+  8047d9:	74 53                	je     80482e <free+0x16f>
+		s->prev->next = s->next;
+  8047db:	8b 16                	mov    (%esi),%edx
+  8047dd:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8047df:	8b 06                	mov    (%esi),%eax
+  8047e1:	85 c0                	test   %eax,%eax
+  8047e3:	74 06                	je     8047eb <free+0x12c>
+		s->next->prev = s->prev;
+  8047e5:	8b 56 04             	mov    0x4(%esi),%edx
+  8047e8:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8047eb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8047ee:	f7 d0                	not    %eax
+  8047f0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8047f3:	21 d0                	and    %edx,%eax
+  8047f5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8047f8:	89 04 95 80 c0 80 00 	mov    %eax,0x80c080(,%edx,4)
+		heap_free_pages(s);
+  8047ff:	89 f0                	mov    %esi,%eax
+  804801:	e8 fd fd ff ff       	call   804603 <heap_free_pages>
+  804806:	e9 f8 fe ff ff       	jmp    804703 <free+0x44>
+	s->prev = NULL;
+  80480b:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  804812:	8b 04 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%eax
+  804819:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  80481b:	85 c0                	test   %eax,%eax
+  80481d:	74 03                	je     804822 <free+0x163>
+		slabs[c]->prev = s;
+  80481f:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  804822:	89 34 8d 60 c0 80 00 	mov    %esi,0x80c060(,%ecx,4)
+}
+  804829:	e9 d5 fe ff ff       	jmp    804703 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  80482e:	8b 06                	mov    (%esi),%eax
+  804830:	85 c0                	test   %eax,%eax
+  804832:	0f 84 cb fe ff ff    	je     804703 <free+0x44>
+		slabs[c] = s->next;
+  804838:	89 04 8d 60 c0 80 00 	mov    %eax,0x80c060(,%ecx,4)
+	if (s->next)
+  80483f:	8b 06                	mov    (%esi),%eax
+  804841:	eb a2                	jmp    8047e5 <free+0x126>
+
+00804843 <heap_alloc_pages>:
+{
+  804843:	55                   	push   %ebp
+  804844:	89 e5                	mov    %esp,%ebp
+  804846:	57                   	push   %edi
+  804847:	56                   	push   %esi
+  804848:	53                   	push   %ebx
+  804849:	83 ec 18             	sub    $0x18,%esp
+  80484c:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  80484e:	50                   	push   %eax
+  80484f:	e8 15 03 00 00       	call   804b69 <va_alloc>
+  804854:	89 c3                	mov    %eax,%ebx
+  804856:	83 c4 10             	add    $0x10,%esp
+  804859:	85 c0                	test   %eax,%eax
+  80485b:	74 47                	je     8048a4 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  80485d:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804863:	89 c1                	mov    %eax,%ecx
+  804865:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  804868:	c1 e8 11             	shr    $0x11,%eax
+  80486b:	ba 01 00 00 00       	mov    $0x1,%edx
+  804870:	89 d7                	mov    %edx,%edi
+  804872:	d3 e7                	shl    %cl,%edi
+  804874:	09 3c 85 80 dc 80 00 	or     %edi,0x80dc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  80487b:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  80487f:	89 c8                	mov    %ecx,%eax
+  804881:	c1 e8 05             	shr    $0x5,%eax
+  804884:	d3 e2                	shl    %cl,%edx
+  804886:	09 14 85 80 ce 80 00 	or     %edx,0x80ce80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  80488d:	83 ec 0c             	sub    $0xc,%esp
+  804890:	6a 00                	push   $0x0
+  804892:	6a 07                	push   $0x7
+  804894:	56                   	push   %esi
+  804895:	53                   	push   %ebx
+  804896:	6a 00                	push   $0x0
+  804898:	e8 3a f7 ff ff       	call   803fd7 <page_alloc_range>
+  80489d:	83 c4 20             	add    $0x20,%esp
+  8048a0:	85 c0                	test   %eax,%eax
+  8048a2:	78 0a                	js     8048ae <heap_alloc_pages+0x6b>
+}
+  8048a4:	89 d8                	mov    %ebx,%eax
+  8048a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8048a9:	5b                   	pop    %ebx
+  8048aa:	5e                   	pop    %esi
+  8048ab:	5f                   	pop    %edi
+  8048ac:	5d                   	pop    %ebp
+  8048ad:	c3                   	ret
+		free(va);
+  8048ae:	83 ec 0c             	sub    $0xc,%esp
+  8048b1:	53                   	push   %ebx
+  8048b2:	e8 08 fe ff ff       	call   8046bf <free>
+		return NULL;
+  8048b7:	83 c4 10             	add    $0x10,%esp
+  8048ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8048bf:	eb e3                	jmp    8048a4 <heap_alloc_pages+0x61>
+
+008048c1 <malloc>:
+{
+  8048c1:	55                   	push   %ebp
+  8048c2:	89 e5                	mov    %esp,%ebp
+  8048c4:	57                   	push   %edi
+  8048c5:	56                   	push   %esi
+  8048c6:	53                   	push   %ebx
+  8048c7:	83 ec 1c             	sub    $0x1c,%esp
+  8048ca:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  8048cd:	8d 50 ff             	lea    -0x1(%eax),%edx
+  8048d0:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  8048d6:	0f 87 21 01 00 00    	ja     8049fd <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8048dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8048e1:	ba 10 00 00 00       	mov    $0x10,%edx
+  8048e6:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  8048e8:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8048ed:	76 15                	jbe    804904 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  8048ef:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8048f4:	c1 e8 0c             	shr    $0xc,%eax
+  8048f7:	e8 47 ff ff ff       	call   804843 <heap_alloc_pages>
+  8048fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8048ff:	eb 37                	jmp    804938 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804901:	83 c1 01             	add    $0x1,%ecx
+  804904:	89 d6                	mov    %edx,%esi
+  804906:	d3 e6                	shl    %cl,%esi
+  804908:	39 c6                	cmp    %eax,%esi
+  80490a:	72 f5                	jb     804901 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  80490c:	89 cb                	mov    %ecx,%ebx
+  80490e:	8b 3c 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%edi
+  804915:	85 ff                	test   %edi,%edi
+  804917:	74 2a                	je     804943 <malloc+0x82>
+	v = s->free;
+  804919:	8b 47 08             	mov    0x8(%edi),%eax
+  80491c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  80491f:	8b 00                	mov    (%eax),%eax
+  804921:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  804924:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  804928:	83 e8 01             	sub    $0x1,%eax
+  80492b:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  80492f:	66 85 c0             	test   %ax,%ax
+  804932:	0f 84 9a 00 00 00    	je     8049d2 <malloc+0x111>
+}
+  804938:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80493b:	83 c4 1c             	add    $0x1c,%esp
+  80493e:	5b                   	pop    %ebx
+  80493f:	5e                   	pop    %esi
+  804940:	5f                   	pop    %edi
+  804941:	5d                   	pop    %ebp
+  804942:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  804943:	b8 01 00 00 00       	mov    $0x1,%eax
+  804948:	e8 f6 fe ff ff       	call   804843 <heap_alloc_pages>
+  80494d:	89 c1                	mov    %eax,%ecx
+  80494f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804952:	85 c0                	test   %eax,%eax
+  804954:	74 e2                	je     804938 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804956:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  80495c:	89 c8                	mov    %ecx,%eax
+  80495e:	c1 e8 11             	shr    $0x11,%eax
+  804961:	c1 e9 0c             	shr    $0xc,%ecx
+  804964:	ba 01 00 00 00       	mov    $0x1,%edx
+  804969:	d3 e2                	shl    %cl,%edx
+  80496b:	09 14 85 80 c0 80 00 	or     %edx,0x80c080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804972:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804975:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  804979:	0f b7 f6             	movzwl %si,%esi
+  80497c:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804981:	ba 00 00 00 00       	mov    $0x0,%edx
+  804986:	f7 fe                	idiv   %esi
+  804988:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  80498c:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  80498f:	85 c0                	test   %eax,%eax
+  804991:	74 14                	je     8049a7 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  804993:	83 e8 01             	sub    $0x1,%eax
+  804996:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  80499a:	0f af d0             	imul   %eax,%edx
+  80499d:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  8049a1:	89 3a                	mov    %edi,(%edx)
+  8049a3:	89 d7                	mov    %edx,%edi
+  8049a5:	eb e5                	jmp    80498c <malloc+0xcb>
+	s->prev = NULL;
+  8049a7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8049aa:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  8049b1:	8b 04 9d 60 c0 80 00 	mov    0x80c060(,%ebx,4),%eax
+  8049b8:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  8049ba:	85 c0                	test   %eax,%eax
+  8049bc:	74 03                	je     8049c1 <malloc+0x100>
+		slabs[c]->prev = s;
+  8049be:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  8049c1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8049c4:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+	return s;
+  8049cb:	89 c7                	mov    %eax,%edi
+  8049cd:	e9 47 ff ff ff       	jmp    804919 <malloc+0x58>
+	if (s->prev)
+  8049d2:	8b 47 04             	mov    0x4(%edi),%eax
+  8049d5:	85 c0                	test   %eax,%eax
+  8049d7:	74 19                	je     8049f2 <malloc+0x131>
+		s->prev->next = s->next;
+  8049d9:	8b 17                	mov    (%edi),%edx
+  8049db:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8049dd:	8b 07                	mov    (%edi),%eax
+  8049df:	85 c0                	test   %eax,%eax
+  8049e1:	0f 84 51 ff ff ff    	je     804938 <malloc+0x77>
+		s->next->prev = s->prev;
+  8049e7:	8b 57 04             	mov    0x4(%edi),%edx
+  8049ea:	89 50 04             	mov    %edx,0x4(%eax)
+  8049ed:	e9 46 ff ff ff       	jmp    804938 <malloc+0x77>
+		slabs[c] = s->next;
+  8049f2:	8b 07                	mov    (%edi),%eax
+  8049f4:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+  8049fb:	eb e0                	jmp    8049dd <malloc+0x11c>
+		return NULL;
+  8049fd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804a04:	e9 2f ff ff ff       	jmp    804938 <malloc+0x77>
+
+00804a09 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804a09:	55                   	push   %ebp
+  804a0a:	89 e5                	mov    %esp,%ebp
+  804a0c:	57                   	push   %edi
+  804a0d:	56                   	push   %esi
+  804a0e:	53                   	push   %ebx
+  804a0f:	83 ec 0c             	sub    $0xc,%esp
+  804a12:	89 c6                	mov    %eax,%esi
+  804a14:	89 d7                	mov    %edx,%edi
+  804a16:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804a19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804a1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a23:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  804a28:	83 ef 01             	sub    $0x1,%edi
+  804a2b:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804a2e:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  804a31:	eb 34                	jmp    804a67 <va_chunk_scan+0x5e>
+			i += 31;
+  804a33:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  804a36:	89 ca                	mov    %ecx,%edx
+			continue;
+  804a38:	eb 23                	jmp    804a5d <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804a3a:	89 c7                	mov    %eax,%edi
+  804a3c:	c1 ef 05             	shr    $0x5,%edi
+  804a3f:	be 01 00 00 00       	mov    $0x1,%esi
+  804a44:	d3 e6                	shl    %cl,%esi
+  804a46:	89 f1                	mov    %esi,%ecx
+  804a48:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804a4b:	23 0c be             	and    (%esi,%edi,4),%ecx
+  804a4e:	75 41                	jne    804a91 <va_chunk_scan+0x88>
+			len++;
+  804a50:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804a53:	39 d3                	cmp    %edx,%ebx
+  804a55:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  804a58:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  804a5b:	72 2d                	jb     804a8a <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804a5d:	83 c0 01             	add    $0x1,%eax
+  804a60:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804a65:	77 31                	ja     804a98 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  804a67:	89 c1                	mov    %eax,%ecx
+  804a69:	83 e1 1f             	and    $0x1f,%ecx
+  804a6c:	75 cc                	jne    804a3a <va_chunk_scan+0x31>
+  804a6e:	89 c7                	mov    %eax,%edi
+  804a70:	c1 ef 05             	shr    $0x5,%edi
+  804a73:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804a76:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804a79:	83 ff ff             	cmp    $0xffffffff,%edi
+  804a7c:	74 b5                	je     804a33 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  804a7e:	85 ff                	test   %edi,%edi
+  804a80:	75 b8                	jne    804a3a <va_chunk_scan+0x31>
+			i += 31;
+  804a82:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804a85:	83 c2 20             	add    $0x20,%edx
+  804a88:	eb c9                	jmp    804a53 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804a8a:	83 c0 01             	add    $0x1,%eax
+  804a8d:	29 d0                	sub    %edx,%eax
+  804a8f:	eb 15                	jmp    804aa6 <va_chunk_scan+0x9d>
+			len = 0;
+  804a91:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a96:	eb c5                	jmp    804a5d <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804a98:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804a9d:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804aa0:	85 d2                	test   %edx,%edx
+  804aa2:	74 02                	je     804aa6 <va_chunk_scan+0x9d>
+		*run_store = best;
+  804aa4:	89 1a                	mov    %ebx,(%edx)
+}
+  804aa6:	83 c4 0c             	add    $0xc,%esp
+  804aa9:	5b                   	pop    %ebx
+  804aaa:	5e                   	pop    %esi
+  804aab:	5f                   	pop    %edi
+  804aac:	5d                   	pop    %ebp
+  804aad:	c3                   	ret
+
+00804aae <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804aae:	55                   	push   %ebp
+  804aaf:	89 e5                	mov    %esp,%ebp
+  804ab1:	57                   	push   %edi
+  804ab2:	56                   	push   %esi
+  804ab3:	53                   	push   %ebx
+  804ab4:	83 ec 14             	sub    $0x14,%esp
+  804ab7:	89 c3                	mov    %eax,%ebx
+  804ab9:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804abb:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804ac1:	8d ba a0 ea 80 00    	lea    0x80eaa0(%edx),%edi
+  804ac7:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804aca:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804acd:	89 d6                	mov    %edx,%esi
+  804acf:	81 c6 a0 ea 80 00    	add    $0x80eaa0,%esi
+  804ad5:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804ad7:	eb 34                	jmp    804b0d <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804ad9:	89 c8                	mov    %ecx,%eax
+  804adb:	c1 e8 05             	shr    $0x5,%eax
+  804ade:	89 da                	mov    %ebx,%edx
+  804ae0:	c1 e2 05             	shl    $0x5,%edx
+  804ae3:	01 da                	add    %ebx,%edx
+  804ae5:	01 c2                	add    %eax,%edx
+  804ae7:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804aec:	d3 c0                	rol    %cl,%eax
+  804aee:	21 04 95 a0 ea 80 00 	and    %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804af5:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804afc:	b8 01 00 00 00       	mov    $0x1,%eax
+  804b01:	01 d0                	add    %edx,%eax
+  804b03:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804b0a:	83 c1 01             	add    $0x1,%ecx
+  804b0d:	39 f9                	cmp    %edi,%ecx
+  804b0f:	74 30                	je     804b41 <va_chunk_mark+0x93>
+		if (alloc)
+  804b11:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804b15:	74 c2                	je     804ad9 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804b17:	89 c8                	mov    %ecx,%eax
+  804b19:	c1 e8 05             	shr    $0x5,%eax
+  804b1c:	89 da                	mov    %ebx,%edx
+  804b1e:	c1 e2 05             	shl    $0x5,%edx
+  804b21:	01 da                	add    %ebx,%edx
+  804b23:	01 c2                	add    %eax,%edx
+  804b25:	b8 01 00 00 00       	mov    $0x1,%eax
+  804b2a:	d3 e0                	shl    %cl,%eax
+  804b2c:	09 04 95 a0 ea 80 00 	or     %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804b33:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804b3a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804b3f:	eb c0                	jmp    804b01 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804b41:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804b44:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b49:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804b4c:	e8 b8 fe ff ff       	call   804a09 <va_chunk_scan>
+	ch->run = run;
+  804b51:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804b57:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804b5a:	66 89 83 22 eb 80 00 	mov    %ax,0x80eb22(%ebx)
+}
+  804b61:	83 c4 14             	add    $0x14,%esp
+  804b64:	5b                   	pop    %ebx
+  804b65:	5e                   	pop    %esi
+  804b66:	5f                   	pop    %edi
+  804b67:	5d                   	pop    %ebp
+  804b68:	c3                   	ret
+
+00804b69 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804b69:	55                   	push   %ebp
+  804b6a:	89 e5                	mov    %esp,%ebp
+  804b6c:	57                   	push   %edi
+  804b6d:	56                   	push   %esi
+  804b6e:	53                   	push   %ebx
+  804b6f:	83 ec 04             	sub    $0x4,%esp
+  804b72:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804b75:	b8 20 eb 80 00       	mov    $0x80eb20,%eax
+  804b7a:	ba 90 f9 80 00       	mov    $0x80f990,%edx
+  804b7f:	80 3d 80 ea 80 00 00 	cmpb   $0x0,0x80ea80
+  804b86:	74 4f                	je     804bd7 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804b88:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804b8b:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804b90:	0f 87 01 01 00 00    	ja     804c97 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804b96:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804b9c:	0f 87 80 00 00 00    	ja     804c22 <va_alloc+0xb9>
+  804ba2:	b8 22 eb 80 00       	mov    $0x80eb22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804ba7:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804bac:	0f b7 10             	movzwl (%eax),%edx
+  804baf:	05 84 00 00 00       	add    $0x84,%eax
+  804bb4:	39 da                	cmp    %ebx,%edx
+  804bb6:	73 2c                	jae    804be4 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804bb8:	83 c6 01             	add    $0x1,%esi
+  804bbb:	83 fe 1c             	cmp    $0x1c,%esi
+  804bbe:	75 ec                	jne    804bac <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bc5:	eb 53                	jmp    804c1a <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804bc7:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804bcd:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804bd2:	05 84 00 00 00       	add    $0x84,%eax
+  804bd7:	39 d0                	cmp    %edx,%eax
+  804bd9:	75 ec                	jne    804bc7 <va_alloc+0x5e>
+	va_inited = 1;
+  804bdb:	c6 05 80 ea 80 00 01 	movb   $0x1,0x80ea80
+}
+  804be2:	eb a4                	jmp    804b88 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804be4:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804bea:	05 a0 ea 80 00       	add    $0x80eaa0,%eax
+  804bef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804bf4:	89 da                	mov    %ebx,%edx
+  804bf6:	e8 0e fe ff ff       	call   804a09 <va_chunk_scan>
+  804bfb:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804bfd:	6a 01                	push   $0x1
+  804bff:	89 d9                	mov    %ebx,%ecx
+  804c01:	89 c2                	mov    %eax,%edx
+  804c03:	89 f0                	mov    %esi,%eax
+  804c05:	e8 a4 fe ff ff       	call   804aae <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804c0a:	c1 e6 16             	shl    $0x16,%esi
+  804c0d:	c1 e7 0c             	shl    $0xc,%edi
+  804c10:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804c17:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804c1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804c1d:	5b                   	pop    %ebx
+  804c1e:	5e                   	pop    %esi
+  804c1f:	5f                   	pop    %edi
+  804c20:	5d                   	pop    %ebp
+  804c21:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804c22:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804c28:	c1 ee 0a             	shr    $0xa,%esi
+  804c2b:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804c30:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c35:	eb 0a                	jmp    804c41 <va_alloc+0xd8>
+			first = c + 1;
+  804c37:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804c39:	83 c2 01             	add    $0x1,%edx
+  804c3c:	83 fa 1d             	cmp    $0x1d,%edx
+  804c3f:	74 4f                	je     804c90 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804c41:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804c47:	66 81 b9 9c ea 80 00 	cmpw   $0x400,0x80ea9c(%ecx)
+  804c4e:	00 04 
+  804c50:	75 e5                	jne    804c37 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804c52:	89 d1                	mov    %edx,%ecx
+  804c54:	29 c1                	sub    %eax,%ecx
+  804c56:	39 f1                	cmp    %esi,%ecx
+  804c58:	75 df                	jne    804c39 <va_alloc+0xd0>
+  804c5a:	89 c7                	mov    %eax,%edi
+  804c5c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804c5f:	be 00 04 00 00       	mov    $0x400,%esi
+  804c64:	39 f3                	cmp    %esi,%ebx
+  804c66:	0f 46 f3             	cmovbe %ebx,%esi
+  804c69:	6a 01                	push   $0x1
+  804c6b:	89 f1                	mov    %esi,%ecx
+  804c6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c72:	89 f8                	mov    %edi,%eax
+  804c74:	e8 35 fe ff ff       	call   804aae <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804c79:	83 c7 01             	add    $0x1,%edi
+  804c7c:	83 c4 04             	add    $0x4,%esp
+  804c7f:	29 f3                	sub    %esi,%ebx
+  804c81:	75 dc                	jne    804c5f <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804c83:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804c86:	c1 e0 16             	shl    $0x16,%eax
+  804c89:	05 00 00 00 08       	add    $0x8000000,%eax
+  804c8e:	eb 8a                	jmp    804c1a <va_alloc+0xb1>
+	return NULL;
+  804c90:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c95:	eb 83                	jmp    804c1a <va_alloc+0xb1>
+		return NULL;
+  804c97:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c9c:	e9 79 ff ff ff       	jmp    804c1a <va_alloc+0xb1>
+
+00804ca1 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804ca1:	55                   	push   %ebp
+  804ca2:	89 e5                	mov    %esp,%ebp
+  804ca4:	57                   	push   %edi
+  804ca5:	56                   	push   %esi
+  804ca6:	53                   	push   %ebx
+  804ca7:	83 ec 0c             	sub    $0xc,%esp
+  804caa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804cad:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804cb0:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804cb6:	76 21                	jbe    804cd9 <va_free+0x38>
+  804cb8:	89 f0                	mov    %esi,%eax
+  804cba:	c1 e0 0c             	shl    $0xc,%eax
+  804cbd:	01 f8                	add    %edi,%eax
+  804cbf:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804cc4:	77 13                	ja     804cd9 <va_free+0x38>
+	    || PGOFF(va))
+  804cc6:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804ccc:	75 0b                	jne    804cd9 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804cce:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804cd4:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804cd7:	eb 45                	jmp    804d1e <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804cd9:	83 ec 0c             	sub    $0xc,%esp
+  804cdc:	56                   	push   %esi
+  804cdd:	57                   	push   %edi
+  804cde:	68 8c 60 80 00       	push   $0x80608c
+  804ce3:	68 8e 00 00 00       	push   $0x8e
+  804ce8:	68 ac 60 80 00       	push   $0x8060ac
+  804ced:	e8 a5 b5 ff ff       	call   800297 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804cf2:	89 fa                	mov    %edi,%edx
+  804cf4:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804cfa:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804cff:	29 d3                	sub    %edx,%ebx
+  804d01:	39 f3                	cmp    %esi,%ebx
+  804d03:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804d06:	89 f8                	mov    %edi,%eax
+  804d08:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804d0b:	83 ec 0c             	sub    $0xc,%esp
+  804d0e:	6a 00                	push   $0x0
+  804d10:	89 d9                	mov    %ebx,%ecx
+  804d12:	e8 97 fd ff ff       	call   804aae <va_chunk_mark>
+		i += n;
+  804d17:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804d19:	29 de                	sub    %ebx,%esi
+  804d1b:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804d1e:	85 f6                	test   %esi,%esi
+  804d20:	75 d0                	jne    804cf2 <va_free+0x51>
+	}
+}
+  804d22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804d25:	5b                   	pop    %ebx
+  804d26:	5e                   	pop    %esi
+  804d27:	5f                   	pop    %edi
+  804d28:	5d                   	pop    %ebp
+  804d29:	c3                   	ret
+
+00804d2a <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804d2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d2f:	c3                   	ret
+
+00804d30 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804d30:	55                   	push   %ebp
+  804d31:	89 e5                	mov    %esp,%ebp
+  804d33:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804d36:	68 b9 60 80 00       	push   $0x8060b9
+  804d3b:	ff 75 0c             	push   0xc(%ebp)
+  804d3e:	e8 16 bc ff ff       	call   800959 <strcpy>
+	return 0;
+}
+  804d43:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d48:	c9                   	leave
+  804d49:	c3                   	ret
+
+00804d4a <devcons_write>:
+{
+  804d4a:	55                   	push   %ebp
+  804d4b:	89 e5                	mov    %esp,%ebp
+  804d4d:	57                   	push   %edi
+  804d4e:	56                   	push   %esi
+  804d4f:	53                   	push   %ebx
+  804d50:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804d56:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804d5b:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804d61:	eb 2e                	jmp    804d91 <devcons_write+0x47>
+		m = n - tot;
+  804d63:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804d66:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804d68:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804d6d:	39 c3                	cmp    %eax,%ebx
+  804d6f:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804d72:	83 ec 04             	sub    $0x4,%esp
+  804d75:	53                   	push   %ebx
+  804d76:	89 f0                	mov    %esi,%eax
+  804d78:	03 45 0c             	add    0xc(%ebp),%eax
+  804d7b:	50                   	push   %eax
+  804d7c:	57                   	push   %edi
+  804d7d:	e8 5d bd ff ff       	call   800adf <memmove>
+		sys_cputs(buf, m);
+  804d82:	83 c4 08             	add    $0x8,%esp
+  804d85:	53                   	push   %ebx
+  804d86:	57                   	push   %edi
+  804d87:	e8 f3 bf ff ff       	call   800d7f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804d8c:	01 de                	add    %ebx,%esi
+  804d8e:	83 c4 10             	add    $0x10,%esp
+  804d91:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804d94:	72 cd                	jb     804d63 <devcons_write+0x19>
+}
+  804d96:	89 f0                	mov    %esi,%eax
+  804d98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804d9b:	5b                   	pop    %ebx
+  804d9c:	5e                   	pop    %esi
+  804d9d:	5f                   	pop    %edi
+  804d9e:	5d                   	pop    %ebp
+  804d9f:	c3                   	ret
+
+00804da0 <devcons_read>:
+{
+  804da0:	55                   	push   %ebp
+  804da1:	89 e5                	mov    %esp,%ebp
+  804da3:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804da6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dab:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804daf:	75 07                	jne    804db8 <devcons_read+0x18>
+  804db1:	eb 1f                	jmp    804dd2 <devcons_read+0x32>
+		sys_yield();
+  804db3:	e8 75 c0 ff ff       	call   800e2d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804db8:	e8 f1 bf ff ff       	call   800dae <sys_cgetc>
+  804dbd:	85 c0                	test   %eax,%eax
+  804dbf:	74 f2                	je     804db3 <devcons_read+0x13>
+	if (c < 0)
+  804dc1:	78 0f                	js     804dd2 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804dc3:	83 f8 04             	cmp    $0x4,%eax
+  804dc6:	74 0c                	je     804dd4 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804dc8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804dcb:	88 02                	mov    %al,(%edx)
+	return 1;
+  804dcd:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804dd2:	c9                   	leave
+  804dd3:	c3                   	ret
+		return 0;
+  804dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dd9:	eb f7                	jmp    804dd2 <devcons_read+0x32>
+
+00804ddb <cputchar>:
+{
+  804ddb:	55                   	push   %ebp
+  804ddc:	89 e5                	mov    %esp,%ebp
+  804dde:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804de1:	8b 45 08             	mov    0x8(%ebp),%eax
+  804de4:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804de7:	6a 01                	push   $0x1
+  804de9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804dec:	50                   	push   %eax
+  804ded:	e8 8d bf ff ff       	call   800d7f <sys_cputs>
+}
+  804df2:	83 c4 10             	add    $0x10,%esp
+  804df5:	c9                   	leave
+  804df6:	c3                   	ret
+
+00804df7 <getchar>:
+{
+  804df7:	55                   	push   %ebp
+  804df8:	89 e5                	mov    %esp,%ebp
+  804dfa:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804dfd:	6a 01                	push   $0x1
+  804dff:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804e02:	50                   	push   %eax
+  804e03:	6a 00                	push   $0x0
+  804e05:	e8 6b ce ff ff       	call   801c75 <read>
+	if (r < 0)
+  804e0a:	83 c4 10             	add    $0x10,%esp
+  804e0d:	85 c0                	test   %eax,%eax
+  804e0f:	78 06                	js     804e17 <getchar+0x20>
+	if (r < 1)
+  804e11:	74 06                	je     804e19 <getchar+0x22>
+	return c;
+  804e13:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804e17:	c9                   	leave
+  804e18:	c3                   	ret
+		return -E_EOF;
+  804e19:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804e1e:	eb f7                	jmp    804e17 <getchar+0x20>
+
+00804e20 <iscons>:
+{
+  804e20:	55                   	push   %ebp
+  804e21:	89 e5                	mov    %esp,%ebp
+  804e23:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804e26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804e29:	50                   	push   %eax
+  804e2a:	ff 75 08             	push   0x8(%ebp)
+  804e2d:	e8 e4 cb ff ff       	call   801a16 <fd_lookup>
+  804e32:	83 c4 10             	add    $0x10,%esp
+  804e35:	85 c0                	test   %eax,%eax
+  804e37:	78 11                	js     804e4a <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804e39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804e3c:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  804e42:	39 10                	cmp    %edx,(%eax)
+  804e44:	0f 94 c0             	sete   %al
+  804e47:	0f b6 c0             	movzbl %al,%eax
+}
+  804e4a:	c9                   	leave
+  804e4b:	c3                   	ret
+
+00804e4c <opencons>:
+{
+  804e4c:	55                   	push   %ebp
+  804e4d:	89 e5                	mov    %esp,%ebp
+  804e4f:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804e52:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804e55:	50                   	push   %eax
+  804e56:	e8 67 cb ff ff       	call   8019c2 <fd_alloc>
+  804e5b:	83 c4 10             	add    $0x10,%esp
+  804e5e:	85 c0                	test   %eax,%eax
+  804e60:	78 3a                	js     804e9c <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804e62:	83 ec 04             	sub    $0x4,%esp
+  804e65:	68 07 04 00 00       	push   $0x407
+  804e6a:	ff 75 f4             	push   -0xc(%ebp)
+  804e6d:	6a 00                	push   $0x0
+  804e6f:	e8 d8 bf ff ff       	call   800e4c <sys_page_alloc>
+  804e74:	83 c4 10             	add    $0x10,%esp
+  804e77:	85 c0                	test   %eax,%eax
+  804e79:	78 21                	js     804e9c <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804e7b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804e7e:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  804e84:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804e86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804e89:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804e90:	83 ec 0c             	sub    $0xc,%esp
+  804e93:	50                   	push   %eax
+  804e94:	e8 02 cb ff ff       	call   80199b <fd2num>
+  804e99:	83 c4 10             	add    $0x10,%esp
+}
+  804e9c:	c9                   	leave
+  804e9d:	c3                   	ret
+
+00804e9e <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804e9e:	55                   	push   %ebp
+  804e9f:	89 e5                	mov    %esp,%ebp
+  804ea1:	56                   	push   %esi
+  804ea2:	53                   	push   %ebx
+  804ea3:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804ea6:	a1 10 f9 80 00       	mov    0x80f910,%eax
+  804eab:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804eae:	85 db                	test   %ebx,%ebx
+  804eb0:	78 17                	js     804ec9 <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804eb2:	83 ec 0c             	sub    $0xc,%esp
+  804eb5:	56                   	push   %esi
+  804eb6:	ff 14 9d 00 10 81 00 	call   *0x811000(,%ebx,4)
+  804ebd:	83 c4 10             	add    $0x10,%esp
+  804ec0:	85 c0                	test   %eax,%eax
+  804ec2:	75 27                	jne    804eeb <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804ec4:	83 eb 01             	sub    $0x1,%ebx
+  804ec7:	eb e5                	jmp    804eae <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804ec9:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804ece:	8b 40 48             	mov    0x48(%eax),%eax
+  804ed1:	83 ec 08             	sub    $0x8,%esp
+  804ed4:	ff 76 28             	push   0x28(%esi)
+  804ed7:	ff 36                	push   (%esi)
+  804ed9:	50                   	push   %eax
+  804eda:	68 c8 60 80 00       	push   $0x8060c8
+  804edf:	6a 1d                	push   $0x1d
+  804ee1:	68 eb 60 80 00       	push   $0x8060eb
+  804ee6:	e8 ac b3 ff ff       	call   800297 <_panic>
+}
+  804eeb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804eee:	5b                   	pop    %ebx
+  804eef:	5e                   	pop    %esi
+  804ef0:	5d                   	pop    %ebp
+  804ef1:	c3                   	ret
+
+00804ef2 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804ef2:	55                   	push   %ebp
+  804ef3:	89 e5                	mov    %esp,%ebp
+  804ef5:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804ef8:	83 3d 28 10 81 00 00 	cmpl   $0x0,0x811028
+  804eff:	74 0a                	je     804f0b <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804f01:	8b 45 08             	mov    0x8(%ebp),%eax
+  804f04:	a3 28 10 81 00       	mov    %eax,0x811028
+}
+  804f09:	c9                   	leave
+  804f0a:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804f0b:	83 ec 04             	sub    $0x4,%esp
+  804f0e:	6a 07                	push   $0x7
+  804f10:	68 00 f0 bf ee       	push   $0xeebff000
+  804f15:	6a 00                	push   $0x0
+  804f17:	e8 30 bf ff ff       	call   800e4c <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804f1c:	83 c4 08             	add    $0x8,%esp
+  804f1f:	68 92 4f 80 00       	push   $0x804f92
+  804f24:	6a 00                	push   $0x0
+  804f26:	e8 87 c2 ff ff       	call   8011b2 <sys_env_set_pgfault_upcall>
+  804f2b:	83 c4 10             	add    $0x10,%esp
+  804f2e:	eb d1                	jmp    804f01 <set_pgfault_handler+0xf>
+
+00804f30 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804f30:	55                   	push   %ebp
+  804f31:	89 e5                	mov    %esp,%ebp
+  804f33:	83 ec 08             	sub    $0x8,%esp
+  804f36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  804f39:	8b 15 10 f9 80 00    	mov    0x80f910,%edx
+  804f3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f44:	eb 03                	jmp    804f49 <add_pgfault_handler+0x19>
+  804f46:	83 c0 01             	add    $0x1,%eax
+  804f49:	39 d0                	cmp    %edx,%eax
+  804f4b:	74 0b                	je     804f58 <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804f4d:	39 0c 85 00 10 81 00 	cmp    %ecx,0x811000(,%eax,4)
+  804f54:	75 f0                	jne    804f46 <add_pgfault_handler+0x16>
+  804f56:	eb 24                	jmp    804f7c <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  804f58:	83 fa 0a             	cmp    $0xa,%edx
+  804f5b:	74 21                	je     804f7e <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  804f5d:	8d 42 01             	lea    0x1(%edx),%eax
+  804f60:	a3 10 f9 80 00       	mov    %eax,0x80f910
+  804f65:	89 0c 95 00 10 81 00 	mov    %ecx,0x811000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  804f6c:	83 ec 0c             	sub    $0xc,%esp
+  804f6f:	68 9e 4e 80 00       	push   $0x804e9e
+  804f74:	e8 79 ff ff ff       	call   804ef2 <set_pgfault_handler>
+  804f79:	83 c4 10             	add    $0x10,%esp
+}
+  804f7c:	c9                   	leave
+  804f7d:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  804f7e:	83 ec 04             	sub    $0x4,%esp
+  804f81:	68 f9 60 80 00       	push   $0x8060f9
+  804f86:	6a 44                	push   $0x44
+  804f88:	68 eb 60 80 00       	push   $0x8060eb
+  804f8d:	e8 05 b3 ff ff       	call   800297 <_panic>
+
+00804f92 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804f92:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804f93:	a1 28 10 81 00       	mov    0x811028,%eax
+	call *%eax
+  804f98:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804f9a:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  804f9d:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  804fa1:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  804fa5:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  804fa8:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  804faa:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  804fae:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  804fb1:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  804fb2:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  804fb5:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  804fb6:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  804fb7:	c3                   	ret
+
+00804fb8 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  804fb8:	55                   	push   %ebp
+  804fb9:	89 e5                	mov    %esp,%ebp
+  804fbb:	57                   	push   %edi
+  804fbc:	56                   	push   %esi
+  804fbd:	53                   	push   %ebx
+  804fbe:	83 ec 14             	sub    $0x14,%esp
+  804fc1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804fc4:	8b 75 14             	mov    0x14(%ebp),%esi
+  804fc7:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804fca:	ff 75 10             	push   0x10(%ebp)
+  804fcd:	ff 75 0c             	push   0xc(%ebp)
+  804fd0:	e8 9a c2 ff ff       	call   80126f <sys_ipc_recv_pages>
+  804fd5:	83 c4 10             	add    $0x10,%esp
+  804fd8:	85 c0                	test   %eax,%eax
+  804fda:	78 46                	js     805022 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804fdc:	85 ff                	test   %edi,%edi
+  804fde:	74 0d                	je     804fed <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804fe0:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804fe5:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804feb:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804fed:	85 f6                	test   %esi,%esi
+  804fef:	74 0d                	je     804ffe <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804ff1:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804ff6:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804ffc:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804ffe:	85 db                	test   %ebx,%ebx
+  805000:	74 0d                	je     80500f <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  805002:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805007:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80500d:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80500f:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805014:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80501a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80501d:	5b                   	pop    %ebx
+  80501e:	5e                   	pop    %esi
+  80501f:	5f                   	pop    %edi
+  805020:	5d                   	pop    %ebp
+  805021:	c3                   	ret
+		if (from_env_store) {
+  805022:	85 ff                	test   %edi,%edi
+  805024:	74 06                	je     80502c <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  805026:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80502c:	85 f6                	test   %esi,%esi
+  80502e:	74 06                	je     805036 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  805030:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  805036:	85 db                	test   %ebx,%ebx
+  805038:	74 e0                	je     80501a <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  80503a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  805040:	eb d8                	jmp    80501a <ipc_recv_pages+0x62>
+
+00805042 <ipc_recv>:
+{
+  805042:	55                   	push   %ebp
+  805043:	89 e5                	mov    %esp,%ebp
+  805045:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  805048:	6a 00                	push   $0x0
+  80504a:	ff 75 10             	push   0x10(%ebp)
+  80504d:	6a 01                	push   $0x1
+  80504f:	ff 75 0c             	push   0xc(%ebp)
+  805052:	ff 75 08             	push   0x8(%ebp)
+  805055:	e8 5e ff ff ff       	call   804fb8 <ipc_recv_pages>
+}
+  80505a:	c9                   	leave
+  80505b:	c3                   	ret
+
+0080505c <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80505c:	55                   	push   %ebp
+  80505d:	89 e5                	mov    %esp,%ebp
+  80505f:	56                   	push   %esi
+  805060:	53                   	push   %ebx
+  805061:	8b 75 08             	mov    0x8(%ebp),%esi
+  805064:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  805067:	83 ec 0c             	sub    $0xc,%esp
+  80506a:	ff 75 0c             	push   0xc(%ebp)
+  80506d:	e8 31 c3 ff ff       	call   8013a3 <sys_ipc_try_recv>
+  805072:	83 c4 10             	add    $0x10,%esp
+  805075:	85 c0                	test   %eax,%eax
+  805077:	78 34                	js     8050ad <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  805079:	85 f6                	test   %esi,%esi
+  80507b:	74 0d                	je     80508a <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  80507d:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805082:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  805088:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  80508a:	85 db                	test   %ebx,%ebx
+  80508c:	74 0d                	je     80509b <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  80508e:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805093:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  805099:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80509b:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050a0:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8050a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8050a9:	5b                   	pop    %ebx
+  8050aa:	5e                   	pop    %esi
+  8050ab:	5d                   	pop    %ebp
+  8050ac:	c3                   	ret
+		if (from_env_store) {
+  8050ad:	85 f6                	test   %esi,%esi
+  8050af:	74 06                	je     8050b7 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8050b1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8050b7:	85 db                	test   %ebx,%ebx
+  8050b9:	74 eb                	je     8050a6 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8050bb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8050c1:	eb e3                	jmp    8050a6 <ipc_try_recv+0x4a>
+
+008050c3 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8050c3:	55                   	push   %ebp
+  8050c4:	89 e5                	mov    %esp,%ebp
+  8050c6:	83 ec 14             	sub    $0x14,%esp
+  8050c9:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8050cc:	85 c0                	test   %eax,%eax
+  8050ce:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8050d3:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8050d6:	ff 75 18             	push   0x18(%ebp)
+  8050d9:	ff 75 14             	push   0x14(%ebp)
+  8050dc:	50                   	push   %eax
+  8050dd:	ff 75 0c             	push   0xc(%ebp)
+  8050e0:	ff 75 08             	push   0x8(%ebp)
+  8050e3:	e8 4a c1 ff ff       	call   801232 <sys_ipc_send_pages>
+  8050e8:	83 c4 20             	add    $0x20,%esp
+  8050eb:	85 c0                	test   %eax,%eax
+  8050ed:	78 02                	js     8050f1 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  8050ef:	c9                   	leave
+  8050f0:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  8050f1:	50                   	push   %eax
+  8050f2:	68 14 61 80 00       	push   $0x806114
+  8050f7:	68 80 00 00 00       	push   $0x80
+  8050fc:	68 40 61 80 00       	push   $0x806140
+  805101:	e8 91 b1 ff ff       	call   800297 <_panic>
+
+00805106 <ipc_send>:
+{
+  805106:	55                   	push   %ebp
+  805107:	89 e5                	mov    %esp,%ebp
+  805109:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  80510c:	ff 75 14             	push   0x14(%ebp)
+  80510f:	6a 01                	push   $0x1
+  805111:	ff 75 10             	push   0x10(%ebp)
+  805114:	ff 75 0c             	push   0xc(%ebp)
+  805117:	ff 75 08             	push   0x8(%ebp)
+  80511a:	e8 a4 ff ff ff       	call   8050c3 <ipc_send_pages>
+}
+  80511f:	83 c4 20             	add    $0x20,%esp
+  805122:	c9                   	leave
+  805123:	c3                   	ret
+
+00805124 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  805124:	55                   	push   %ebp
+  805125:	89 e5                	mov    %esp,%ebp
+  805127:	83 ec 14             	sub    $0x14,%esp
+  80512a:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80512d:	85 c0                	test   %eax,%eax
+  80512f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805134:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  805137:	ff 75 18             	push   0x18(%ebp)
+  80513a:	ff 75 14             	push   0x14(%ebp)
+  80513d:	50                   	push   %eax
+  80513e:	ff 75 0c             	push   0xc(%ebp)
+  805141:	ff 75 08             	push   0x8(%ebp)
+  805144:	e8 7a c1 ff ff       	call   8012c3 <sys_ipc_call>
+  805149:	83 c4 20             	add    $0x20,%esp
+  80514c:	85 c0                	test   %eax,%eax
+  80514e:	78 0b                	js     80515b <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  805150:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805155:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80515b:	c9                   	leave
+  80515c:	c3                   	ret
+
+0080515d <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  80515d:	55                   	push   %ebp
+  80515e:	89 e5                	mov    %esp,%ebp
+  805160:	57                   	push   %edi
+  805161:	56                   	push   %esi
+  805162:	53                   	push   %ebx
+  805163:	83 ec 18             	sub    $0x18,%esp
+  805166:	8b 45 10             	mov    0x10(%ebp),%eax
+  805169:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  80516c:	8b 75 20             	mov    0x20(%ebp),%esi
+  80516f:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805172:	85 c0                	test   %eax,%eax
+  805174:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805179:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80517c:	ff 75 18             	push   0x18(%ebp)
+  80517f:	ff 75 14             	push   0x14(%ebp)
+  805182:	50                   	push   %eax
+  805183:	ff 75 0c             	push   0xc(%ebp)
+  805186:	ff 75 08             	push   0x8(%ebp)
+  805189:	e8 76 c1 ff ff       	call   801304 <sys_ipc_reply_recv>
+  80518e:	83 c4 20             	add    $0x20,%esp
+  805191:	85 c0                	test   %eax,%eax
+  805193:	78 46                	js     8051db <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  805195:	85 ff                	test   %edi,%edi
+  805197:	74 0d                	je     8051a6 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  805199:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80519e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8051a4:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8051a6:	85 f6                	test   %esi,%esi
+  8051a8:	74 0d                	je     8051b7 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8051aa:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8051af:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8051b5:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8051b7:	85 db                	test   %ebx,%ebx
+  8051b9:	74 0d                	je     8051c8 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8051bb:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8051c0:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8051c6:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8051c8:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8051cd:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8051d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8051d6:	5b                   	pop    %ebx
+  8051d7:	5e                   	pop    %esi
+  8051d8:	5f                   	pop    %edi
+  8051d9:	5d                   	pop    %ebp
+  8051da:	c3                   	ret
+		if (from_env_store) {
+  8051db:	85 ff                	test   %edi,%edi
+  8051dd:	74 06                	je     8051e5 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  8051df:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8051e5:	85 f6                	test   %esi,%esi
+  8051e7:	74 06                	je     8051ef <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  8051e9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8051ef:	85 db                	test   %ebx,%ebx
+  8051f1:	74 e0                	je     8051d3 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  8051f3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8051f9:	eb d8                	jmp    8051d3 <ipc_reply_recv+0x76>
+
+008051fb <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8051fb:	55                   	push   %ebp
+  8051fc:	89 e5                	mov    %esp,%ebp
+  8051fe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  805201:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  805206:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  805209:	c1 e0 06             	shl    $0x6,%eax
+  80520c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805211:	8b 40 50             	mov    0x50(%eax),%eax
+  805214:	39 c8                	cmp    %ecx,%eax
+  805216:	74 12                	je     80522a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  805218:	83 c2 01             	add    $0x1,%edx
+  80521b:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  805221:	75 e3                	jne    805206 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  805223:	b8 00 00 00 00       	mov    $0x0,%eax
+  805228:	eb 0e                	jmp    805238 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80522a:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80522d:	c1 e0 06             	shl    $0x6,%eax
+  805230:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805235:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  805238:	5d                   	pop    %ebp
+  805239:	c3                   	ret
+
+0080523a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80523a:	55                   	push   %ebp
+  80523b:	89 e5                	mov    %esp,%ebp
+  80523d:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805240:	89 c2                	mov    %eax,%edx
+  805242:	c1 ea 16             	shr    $0x16,%edx
+  805245:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80524c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805251:	f6 c1 01             	test   $0x1,%cl
+  805254:	74 1e                	je     805274 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  805256:	c1 e8 0c             	shr    $0xc,%eax
+  805259:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  805260:	a8 01                	test   $0x1,%al
+  805262:	74 10                	je     805274 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  805264:	c1 e8 0c             	shr    $0xc,%eax
+  805267:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80526a:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  805271:	0f b7 d2             	movzwl %dx,%edx
+}
+  805274:	89 d0                	mov    %edx,%eax
+  805276:	5d                   	pop    %ebp
+  805277:	c3                   	ret
+
+00805278 <udivmod>:
+  805278:	55                   	push   %ebp
+  805279:	57                   	push   %edi
+  80527a:	56                   	push   %esi
+  80527b:	53                   	push   %ebx
+  80527c:	83 ec 24             	sub    $0x24,%esp
+  80527f:	89 44 24 08          	mov    %eax,0x8(%esp)
+  805283:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  805287:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80528b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80528f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  805293:	89 54 24 14          	mov    %edx,0x14(%esp)
+  805297:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80529b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8052a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052aa:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8052b1:	00 
+  8052b2:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8052b9:	00 
+  8052ba:	89 fb                	mov    %edi,%ebx
+  8052bc:	eb 08                	jmp    8052c6 <udivmod+0x4e>
+  8052be:	83 e9 01             	sub    $0x1,%ecx
+  8052c1:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8052c4:	74 68                	je     80532e <udivmod+0xb6>
+  8052c6:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8052ca:	01 c0                	add    %eax,%eax
+  8052cc:	89 c6                	mov    %eax,%esi
+  8052ce:	89 d7                	mov    %edx,%edi
+  8052d0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8052d4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8052d8:	0f ad d0             	shrd   %cl,%edx,%eax
+  8052db:	d3 ea                	shr    %cl,%edx
+  8052dd:	f6 c1 20             	test   $0x20,%cl
+  8052e0:	74 04                	je     8052e6 <udivmod+0x6e>
+  8052e2:	89 d0                	mov    %edx,%eax
+  8052e4:	31 d2                	xor    %edx,%edx
+  8052e6:	83 e0 01             	and    $0x1,%eax
+  8052e9:	89 04 24             	mov    %eax,(%esp)
+  8052ec:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8052f3:	00 
+  8052f4:	8b 04 24             	mov    (%esp),%eax
+  8052f7:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8052fb:	09 f0                	or     %esi,%eax
+  8052fd:	09 fa                	or     %edi,%edx
+  8052ff:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805303:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  805307:	39 f0                	cmp    %esi,%eax
+  805309:	89 d5                	mov    %edx,%ebp
+  80530b:	19 fd                	sbb    %edi,%ebp
+  80530d:	72 af                	jb     8052be <udivmod+0x46>
+  80530f:	29 f0                	sub    %esi,%eax
+  805311:	19 fa                	sbb    %edi,%edx
+  805313:	89 cf                	mov    %ecx,%edi
+  805315:	c1 ef 05             	shr    $0x5,%edi
+  805318:	83 e7 01             	and    $0x1,%edi
+  80531b:	89 fe                	mov    %edi,%esi
+  80531d:	83 f6 01             	xor    $0x1,%esi
+  805320:	d3 e6                	shl    %cl,%esi
+  805322:	d3 e7                	shl    %cl,%edi
+  805324:	09 74 24 18          	or     %esi,0x18(%esp)
+  805328:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80532c:	eb 90                	jmp    8052be <udivmod+0x46>
+  80532e:	85 db                	test   %ebx,%ebx
+  805330:	74 05                	je     805337 <udivmod+0xbf>
+  805332:	89 03                	mov    %eax,(%ebx)
+  805334:	89 53 04             	mov    %edx,0x4(%ebx)
+  805337:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80533b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80533f:	83 c4 24             	add    $0x24,%esp
+  805342:	5b                   	pop    %ebx
+  805343:	5e                   	pop    %esi
+  805344:	5f                   	pop    %edi
+  805345:	5d                   	pop    %ebp
+  805346:	c3                   	ret
+
+00805347 <__udivdi3>:
+  805347:	83 ec 08             	sub    $0x8,%esp
+  80534a:	6a 00                	push   $0x0
+  80534c:	ff 74 24 1c          	push   0x1c(%esp)
+  805350:	ff 74 24 1c          	push   0x1c(%esp)
+  805354:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805358:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80535c:	e8 17 ff ff ff       	call   805278 <udivmod>
+  805361:	83 c4 14             	add    $0x14,%esp
+  805364:	c3                   	ret
+
+00805365 <__umoddi3>:
+  805365:	83 ec 18             	sub    $0x18,%esp
+  805368:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80536c:	50                   	push   %eax
+  80536d:	ff 74 24 2c          	push   0x2c(%esp)
+  805371:	ff 74 24 2c          	push   0x2c(%esp)
+  805375:	8b 44 24 28          	mov    0x28(%esp),%eax
+  805379:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80537d:	e8 f6 fe ff ff       	call   805278 <udivmod>
+  805382:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805386:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80538a:	83 c4 24             	add    $0x24,%esp
+  80538d:	c3                   	ret
+
+0080538e <__divdi3>:
+  80538e:	55                   	push   %ebp
+  80538f:	57                   	push   %edi
+  805390:	56                   	push   %esi
+  805391:	53                   	push   %ebx
+  805392:	83 ec 10             	sub    $0x10,%esp
+  805395:	8b 44 24 24          	mov    0x24(%esp),%eax
+  805399:	8b 54 24 28          	mov    0x28(%esp),%edx
+  80539d:	89 c6                	mov    %eax,%esi
+  80539f:	89 d7                	mov    %edx,%edi
+  8053a1:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8053a5:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8053a9:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8053ad:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8053b1:	89 c5                	mov    %eax,%ebp
+  8053b3:	f7 dd                	neg    %ebp
+  8053b5:	89 d6                	mov    %edx,%esi
+  8053b7:	83 d6 00             	adc    $0x0,%esi
+  8053ba:	f7 de                	neg    %esi
+  8053bc:	0f 48 e8             	cmovs  %eax,%ebp
+  8053bf:	0f 49 d6             	cmovns %esi,%edx
+  8053c2:	6a 00                	push   $0x0
+  8053c4:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8053c8:	f7 de                	neg    %esi
+  8053ca:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8053ce:	83 d0 00             	adc    $0x0,%eax
+  8053d1:	f7 d8                	neg    %eax
+  8053d3:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  8053d8:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  8053dd:	50                   	push   %eax
+  8053de:	56                   	push   %esi
+  8053df:	89 e8                	mov    %ebp,%eax
+  8053e1:	e8 92 fe ff ff       	call   805278 <udivmod>
+  8053e6:	83 c4 10             	add    $0x10,%esp
+  8053e9:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  8053ee:	78 08                	js     8053f8 <__divdi3+0x6a>
+  8053f0:	83 c4 0c             	add    $0xc,%esp
+  8053f3:	5b                   	pop    %ebx
+  8053f4:	5e                   	pop    %esi
+  8053f5:	5f                   	pop    %edi
+  8053f6:	5d                   	pop    %ebp
+  8053f7:	c3                   	ret
+  8053f8:	f7 d8                	neg    %eax
+  8053fa:	83 d2 00             	adc    $0x0,%edx
+  8053fd:	f7 da                	neg    %edx
+  8053ff:	eb ef                	jmp    8053f0 <__divdi3+0x62>
+
+00805401 <__moddi3>:
+  805401:	55                   	push   %ebp
+  805402:	57                   	push   %edi
+  805403:	56                   	push   %esi
+  805404:	53                   	push   %ebx
+  805405:	83 ec 18             	sub    $0x18,%esp
+  805408:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80540c:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  805410:	89 f1                	mov    %esi,%ecx
+  805412:	f7 d9                	neg    %ecx
+  805414:	89 da                	mov    %ebx,%edx
+  805416:	83 d2 00             	adc    $0x0,%edx
+  805419:	f7 da                	neg    %edx
+  80541b:	0f 48 ce             	cmovs  %esi,%ecx
+  80541e:	0f 48 d3             	cmovs  %ebx,%edx
+  805421:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805425:	50                   	push   %eax
+  805426:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80542a:	f7 de                	neg    %esi
+  80542c:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  805430:	83 d0 00             	adc    $0x0,%eax
+  805433:	f7 d8                	neg    %eax
+  805435:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80543a:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  80543f:	50                   	push   %eax
+  805440:	56                   	push   %esi
+  805441:	89 c8                	mov    %ecx,%eax
+  805443:	e8 30 fe ff ff       	call   805278 <udivmod>
+  805448:	83 c4 10             	add    $0x10,%esp
+  80544b:	85 db                	test   %ebx,%ebx
+  80544d:	78 10                	js     80545f <__moddi3+0x5e>
+  80544f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805453:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805457:	83 c4 14             	add    $0x14,%esp
+  80545a:	5b                   	pop    %ebx
+  80545b:	5e                   	pop    %esi
+  80545c:	5f                   	pop    %edi
+  80545d:	5d                   	pop    %ebp
+  80545e:	c3                   	ret
+  80545f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805463:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805467:	f7 d8                	neg    %eax
+  805469:	83 d2 00             	adc    $0x0,%edx
+  80546c:	f7 da                	neg    %edx
+  80546e:	eb e7                	jmp    805457 <__moddi3+0x56>
@@ -0,0 +1,12543 @@
+
+obj/user/sh.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 f2 09 00 00       	call   800a23 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <_gettoken>:
+#define WHITESPACE " \t\r\n"
+#define SYMBOLS "<|>&;()"
+
+int
+_gettoken(char *s, char **p1, char **p2)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int t;
+
+	if (s == 0) {
+  800042:	85 db                	test   %ebx,%ebx
+  800044:	74 1a                	je     800060 <_gettoken+0x2d>
+		if (debug > 1)
+			cprintf("GETTOKEN NULL\n");
+		return 0;
+	}
+
+	if (debug > 1)
+  800046:	83 3d 00 90 80 00 01 	cmpl   $0x1,0x809000
+  80004d:	7f 31                	jg     800080 <_gettoken+0x4d>
+		cprintf("GETTOKEN: %s\n", s);
+
+	*p1 = 0;
+  80004f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+	*p2 = 0;
+  800055:	8b 45 10             	mov    0x10(%ebp),%eax
+  800058:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+
+	while (strchr(WHITESPACE, *s))
+  80005e:	eb 3a                	jmp    80009a <_gettoken+0x67>
+		return 0;
+  800060:	be 00 00 00 00       	mov    $0x0,%esi
+		if (debug > 1)
+  800065:	83 3d 00 90 80 00 01 	cmpl   $0x1,0x809000
+  80006c:	7e 59                	jle    8000c7 <_gettoken+0x94>
+			cprintf("GETTOKEN NULL\n");
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	68 20 65 80 00       	push   $0x806520
+  800076:	e8 e6 0a 00 00       	call   800b61 <cprintf>
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	eb 47                	jmp    8000c7 <_gettoken+0x94>
+		cprintf("GETTOKEN: %s\n", s);
+  800080:	83 ec 08             	sub    $0x8,%esp
+  800083:	53                   	push   %ebx
+  800084:	68 2f 65 80 00       	push   $0x80652f
+  800089:	e8 d3 0a 00 00       	call   800b61 <cprintf>
+  80008e:	83 c4 10             	add    $0x10,%esp
+  800091:	eb bc                	jmp    80004f <_gettoken+0x1c>
+		*s++ = 0;
+  800093:	83 c3 01             	add    $0x1,%ebx
+  800096:	c6 43 ff 00          	movb   $0x0,-0x1(%ebx)
+	while (strchr(WHITESPACE, *s))
+  80009a:	83 ec 08             	sub    $0x8,%esp
+  80009d:	0f be 03             	movsbl (%ebx),%eax
+  8000a0:	50                   	push   %eax
+  8000a1:	68 3d 65 80 00       	push   $0x80653d
+  8000a6:	e8 9f 12 00 00       	call   80134a <strchr>
+  8000ab:	83 c4 10             	add    $0x10,%esp
+  8000ae:	85 c0                	test   %eax,%eax
+  8000b0:	75 e1                	jne    800093 <_gettoken+0x60>
+	if (*s == 0) {
+  8000b2:	0f b6 03             	movzbl (%ebx),%eax
+  8000b5:	84 c0                	test   %al,%al
+  8000b7:	75 2a                	jne    8000e3 <_gettoken+0xb0>
+		if (debug > 1)
+			cprintf("EOL\n");
+		return 0;
+  8000b9:	be 00 00 00 00       	mov    $0x0,%esi
+		if (debug > 1)
+  8000be:	83 3d 00 90 80 00 01 	cmpl   $0x1,0x809000
+  8000c5:	7f 0a                	jg     8000d1 <_gettoken+0x9e>
+		**p2 = 0;
+		cprintf("WORD: %s\n", *p1);
+		**p2 = t;
+	}
+	return 'w';
+}
+  8000c7:	89 f0                	mov    %esi,%eax
+  8000c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000cc:	5b                   	pop    %ebx
+  8000cd:	5e                   	pop    %esi
+  8000ce:	5f                   	pop    %edi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+			cprintf("EOL\n");
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	68 42 65 80 00       	push   $0x806542
+  8000d9:	e8 83 0a 00 00       	call   800b61 <cprintf>
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	eb e4                	jmp    8000c7 <_gettoken+0x94>
+	if (strchr(SYMBOLS, *s)) {
+  8000e3:	83 ec 08             	sub    $0x8,%esp
+  8000e6:	0f be c0             	movsbl %al,%eax
+  8000e9:	50                   	push   %eax
+  8000ea:	68 53 65 80 00       	push   $0x806553
+  8000ef:	e8 56 12 00 00       	call   80134a <strchr>
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	85 c0                	test   %eax,%eax
+  8000f9:	74 2c                	je     800127 <_gettoken+0xf4>
+		t = *s;
+  8000fb:	0f be 33             	movsbl (%ebx),%esi
+		*p1 = s;
+  8000fe:	89 1f                	mov    %ebx,(%edi)
+		*s++ = 0;
+  800100:	c6 03 00             	movb   $0x0,(%ebx)
+  800103:	83 c3 01             	add    $0x1,%ebx
+  800106:	8b 45 10             	mov    0x10(%ebp),%eax
+  800109:	89 18                	mov    %ebx,(%eax)
+		if (debug > 1)
+  80010b:	83 3d 00 90 80 00 01 	cmpl   $0x1,0x809000
+  800112:	7e b3                	jle    8000c7 <_gettoken+0x94>
+			cprintf("TOK %c\n", t);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	56                   	push   %esi
+  800118:	68 47 65 80 00       	push   $0x806547
+  80011d:	e8 3f 0a 00 00       	call   800b61 <cprintf>
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	eb a0                	jmp    8000c7 <_gettoken+0x94>
+	*p1 = s;
+  800127:	89 1f                	mov    %ebx,(%edi)
+	while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  800129:	eb 03                	jmp    80012e <_gettoken+0xfb>
+		s++;
+  80012b:	83 c3 01             	add    $0x1,%ebx
+	while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  80012e:	0f b6 03             	movzbl (%ebx),%eax
+  800131:	84 c0                	test   %al,%al
+  800133:	74 18                	je     80014d <_gettoken+0x11a>
+  800135:	83 ec 08             	sub    $0x8,%esp
+  800138:	0f be c0             	movsbl %al,%eax
+  80013b:	50                   	push   %eax
+  80013c:	68 4f 65 80 00       	push   $0x80654f
+  800141:	e8 04 12 00 00       	call   80134a <strchr>
+  800146:	83 c4 10             	add    $0x10,%esp
+  800149:	85 c0                	test   %eax,%eax
+  80014b:	74 de                	je     80012b <_gettoken+0xf8>
+	*p2 = s;
+  80014d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800150:	89 18                	mov    %ebx,(%eax)
+	return 'w';
+  800152:	be 77 00 00 00       	mov    $0x77,%esi
+	if (debug > 1) {
+  800157:	83 3d 00 90 80 00 01 	cmpl   $0x1,0x809000
+  80015e:	0f 8e 63 ff ff ff    	jle    8000c7 <_gettoken+0x94>
+		t = **p2;
+  800164:	0f b6 33             	movzbl (%ebx),%esi
+		**p2 = 0;
+  800167:	c6 03 00             	movb   $0x0,(%ebx)
+		cprintf("WORD: %s\n", *p1);
+  80016a:	83 ec 08             	sub    $0x8,%esp
+  80016d:	ff 37                	push   (%edi)
+  80016f:	68 5b 65 80 00       	push   $0x80655b
+  800174:	e8 e8 09 00 00       	call   800b61 <cprintf>
+		**p2 = t;
+  800179:	8b 45 10             	mov    0x10(%ebp),%eax
+  80017c:	8b 00                	mov    (%eax),%eax
+  80017e:	89 f2                	mov    %esi,%edx
+  800180:	88 10                	mov    %dl,(%eax)
+  800182:	83 c4 10             	add    $0x10,%esp
+	return 'w';
+  800185:	be 77 00 00 00       	mov    $0x77,%esi
+  80018a:	e9 38 ff ff ff       	jmp    8000c7 <_gettoken+0x94>
+
+0080018f <gettoken>:
+
+int
+gettoken(char *s, char **p1)
+{
+  80018f:	55                   	push   %ebp
+  800190:	89 e5                	mov    %esp,%ebp
+  800192:	83 ec 08             	sub    $0x8,%esp
+  800195:	8b 45 08             	mov    0x8(%ebp),%eax
+	static int c, nc;
+	static char* np1, *np2;
+
+	if (s) {
+  800198:	85 c0                	test   %eax,%eax
+  80019a:	74 22                	je     8001be <gettoken+0x2f>
+		nc = _gettoken(s, &np1, &np2);
+  80019c:	83 ec 04             	sub    $0x4,%esp
+  80019f:	68 0c 90 80 00       	push   $0x80900c
+  8001a4:	68 10 90 80 00       	push   $0x809010
+  8001a9:	50                   	push   %eax
+  8001aa:	e8 84 fe ff ff       	call   800033 <_gettoken>
+  8001af:	a3 08 90 80 00       	mov    %eax,0x809008
+		return 0;
+  8001b4:	83 c4 10             	add    $0x10,%esp
+  8001b7:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	c = nc;
+	*p1 = np1;
+	nc = _gettoken(np2, &np1, &np2);
+	return c;
+}
+  8001bc:	c9                   	leave
+  8001bd:	c3                   	ret
+	c = nc;
+  8001be:	a1 08 90 80 00       	mov    0x809008,%eax
+  8001c3:	a3 04 90 80 00       	mov    %eax,0x809004
+	*p1 = np1;
+  8001c8:	8b 15 10 90 80 00    	mov    0x809010,%edx
+  8001ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8001d1:	89 10                	mov    %edx,(%eax)
+	nc = _gettoken(np2, &np1, &np2);
+  8001d3:	83 ec 04             	sub    $0x4,%esp
+  8001d6:	68 0c 90 80 00       	push   $0x80900c
+  8001db:	68 10 90 80 00       	push   $0x809010
+  8001e0:	ff 35 0c 90 80 00    	push   0x80900c
+  8001e6:	e8 48 fe ff ff       	call   800033 <_gettoken>
+  8001eb:	a3 08 90 80 00       	mov    %eax,0x809008
+	return c;
+  8001f0:	a1 04 90 80 00       	mov    0x809004,%eax
+  8001f5:	83 c4 10             	add    $0x10,%esp
+  8001f8:	eb c2                	jmp    8001bc <gettoken+0x2d>
+
+008001fa <runcmd>:
+{
+  8001fa:	55                   	push   %ebp
+  8001fb:	89 e5                	mov    %esp,%ebp
+  8001fd:	57                   	push   %edi
+  8001fe:	56                   	push   %esi
+  8001ff:	53                   	push   %ebx
+  800200:	81 ec 74 04 00 00    	sub    $0x474,%esp
+	gettoken(s, 0);
+  800206:	6a 00                	push   $0x0
+  800208:	ff 75 08             	push   0x8(%ebp)
+  80020b:	e8 7f ff ff ff       	call   80018f <gettoken>
+  800210:	83 c4 10             	add    $0x10,%esp
+		switch ((c = gettoken(0, &t))) {
+  800213:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	argc = 0;
+  800216:	bb 00 00 00 00       	mov    $0x0,%ebx
+		switch ((c = gettoken(0, &t))) {
+  80021b:	83 ec 08             	sub    $0x8,%esp
+  80021e:	56                   	push   %esi
+  80021f:	6a 00                	push   $0x0
+  800221:	e8 69 ff ff ff       	call   80018f <gettoken>
+  800226:	89 c7                	mov    %eax,%edi
+  800228:	83 c4 10             	add    $0x10,%esp
+  80022b:	83 f8 3e             	cmp    $0x3e,%eax
+  80022e:	0f 84 3f 01 00 00    	je     800373 <runcmd+0x179>
+  800234:	7f 53                	jg     800289 <runcmd+0x8f>
+  800236:	85 c0                	test   %eax,%eax
+  800238:	0f 84 36 02 00 00    	je     800474 <runcmd+0x27a>
+  80023e:	83 f8 3c             	cmp    $0x3c,%eax
+  800241:	0f 85 09 03 00 00    	jne    800550 <runcmd+0x356>
+			if (gettoken(0, &t) != 'w') {
+  800247:	83 ec 08             	sub    $0x8,%esp
+  80024a:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  80024d:	50                   	push   %eax
+  80024e:	6a 00                	push   $0x0
+  800250:	e8 3a ff ff ff       	call   80018f <gettoken>
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	83 f8 77             	cmp    $0x77,%eax
+  80025b:	0f 85 c1 00 00 00    	jne    800322 <runcmd+0x128>
+			if ((fd = open(t, O_RDONLY)) < 0) {
+  800261:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  800264:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  80026a:	83 ec 08             	sub    $0x8,%esp
+  80026d:	6a 00                	push   $0x0
+  80026f:	50                   	push   %eax
+  800270:	e8 69 29 00 00       	call   802bde <open>
+  800275:	89 c7                	mov    %eax,%edi
+  800277:	83 c4 10             	add    $0x10,%esp
+  80027a:	85 c0                	test   %eax,%eax
+  80027c:	0f 88 ba 00 00 00    	js     80033c <runcmd+0x142>
+			if (fd != 0) {
+  800282:	74 97                	je     80021b <runcmd+0x21>
+  800284:	e9 cf 00 00 00       	jmp    800358 <runcmd+0x15e>
+		switch ((c = gettoken(0, &t))) {
+  800289:	83 f8 77             	cmp    $0x77,%eax
+  80028c:	74 69                	je     8002f7 <runcmd+0xfd>
+  80028e:	83 f8 7c             	cmp    $0x7c,%eax
+  800291:	0f 85 b9 02 00 00    	jne    800550 <runcmd+0x356>
+			if ((r = pipe(p)) < 0) {
+  800297:	83 ec 0c             	sub    $0xc,%esp
+  80029a:	8d 85 9c fb ff ff    	lea    -0x464(%ebp),%eax
+  8002a0:	50                   	push   %eax
+  8002a1:	e8 fc 35 00 00       	call   8038a2 <pipe>
+  8002a6:	83 c4 10             	add    $0x10,%esp
+  8002a9:	85 c0                	test   %eax,%eax
+  8002ab:	0f 88 51 01 00 00    	js     800402 <runcmd+0x208>
+			if (debug)
+  8002b1:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8002b8:	0f 85 5f 01 00 00    	jne    80041d <runcmd+0x223>
+			if ((r = fork()) < 0) {
+  8002be:	e8 4f 1b 00 00       	call   801e12 <fork>
+  8002c3:	89 c7                	mov    %eax,%edi
+  8002c5:	85 c0                	test   %eax,%eax
+  8002c7:	0f 88 71 01 00 00    	js     80043e <runcmd+0x244>
+			if (r == 0) {
+  8002cd:	0f 85 81 01 00 00    	jne    800454 <runcmd+0x25a>
+				if (p[0] != 0) {
+  8002d3:	8b 85 9c fb ff ff    	mov    -0x464(%ebp),%eax
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	0f 85 2d 02 00 00    	jne    80050e <runcmd+0x314>
+				close(p[1]);
+  8002e1:	83 ec 0c             	sub    $0xc,%esp
+  8002e4:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  8002ea:	e8 78 22 00 00       	call   802567 <close>
+				goto again;
+  8002ef:	83 c4 10             	add    $0x10,%esp
+  8002f2:	e9 1f ff ff ff       	jmp    800216 <runcmd+0x1c>
+			if (argc == MAXARGS) {
+  8002f7:	83 fb 10             	cmp    $0x10,%ebx
+  8002fa:	74 0f                	je     80030b <runcmd+0x111>
+			argv[argc++] = t;
+  8002fc:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  8002ff:	89 44 9d a8          	mov    %eax,-0x58(%ebp,%ebx,4)
+  800303:	8d 5b 01             	lea    0x1(%ebx),%ebx
+			break;
+  800306:	e9 10 ff ff ff       	jmp    80021b <runcmd+0x21>
+				cprintf("too many arguments\n");
+  80030b:	83 ec 0c             	sub    $0xc,%esp
+  80030e:	68 65 65 80 00       	push   $0x806565
+  800313:	e8 49 08 00 00       	call   800b61 <cprintf>
+				exit();
+  800318:	e8 4f 07 00 00       	call   800a6c <exit>
+  80031d:	83 c4 10             	add    $0x10,%esp
+  800320:	eb da                	jmp    8002fc <runcmd+0x102>
+				cprintf("syntax error: < not followed by word\n");
+  800322:	83 ec 0c             	sub    $0xc,%esp
+  800325:	68 b8 66 80 00       	push   $0x8066b8
+  80032a:	e8 32 08 00 00       	call   800b61 <cprintf>
+				exit();
+  80032f:	e8 38 07 00 00       	call   800a6c <exit>
+  800334:	83 c4 10             	add    $0x10,%esp
+  800337:	e9 25 ff ff ff       	jmp    800261 <runcmd+0x67>
+				cprintf("open %s for read: %e", t, fd);
+  80033c:	83 ec 04             	sub    $0x4,%esp
+  80033f:	50                   	push   %eax
+  800340:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  800346:	68 79 65 80 00       	push   $0x806579
+  80034b:	e8 11 08 00 00       	call   800b61 <cprintf>
+				exit();
+  800350:	e8 17 07 00 00       	call   800a6c <exit>
+  800355:	83 c4 10             	add    $0x10,%esp
+				dup(fd, 0);
+  800358:	83 ec 08             	sub    $0x8,%esp
+  80035b:	6a 00                	push   $0x0
+  80035d:	57                   	push   %edi
+  80035e:	e8 56 22 00 00       	call   8025b9 <dup>
+				close(fd);
+  800363:	89 3c 24             	mov    %edi,(%esp)
+  800366:	e8 fc 21 00 00       	call   802567 <close>
+  80036b:	83 c4 10             	add    $0x10,%esp
+  80036e:	e9 a8 fe ff ff       	jmp    80021b <runcmd+0x21>
+			if (gettoken(0, &t) != 'w') {
+  800373:	83 ec 08             	sub    $0x8,%esp
+  800376:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  800379:	50                   	push   %eax
+  80037a:	6a 00                	push   $0x0
+  80037c:	e8 0e fe ff ff       	call   80018f <gettoken>
+  800381:	83 c4 10             	add    $0x10,%esp
+  800384:	83 f8 77             	cmp    $0x77,%eax
+  800387:	75 2b                	jne    8003b4 <runcmd+0x1ba>
+			if ((fd = open(t, O_WRONLY|O_CREAT|O_TRUNC)) < 0) {
+  800389:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  80038c:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  800392:	83 ec 08             	sub    $0x8,%esp
+  800395:	68 01 03 00 00       	push   $0x301
+  80039a:	50                   	push   %eax
+  80039b:	e8 3e 28 00 00       	call   802bde <open>
+  8003a0:	89 c7                	mov    %eax,%edi
+  8003a2:	83 c4 10             	add    $0x10,%esp
+  8003a5:	85 c0                	test   %eax,%eax
+  8003a7:	78 22                	js     8003cb <runcmd+0x1d1>
+			if (fd != 1) {
+  8003a9:	83 f8 01             	cmp    $0x1,%eax
+  8003ac:	0f 84 69 fe ff ff    	je     80021b <runcmd+0x21>
+  8003b2:	eb 33                	jmp    8003e7 <runcmd+0x1ed>
+				cprintf("syntax error: > not followed by word\n");
+  8003b4:	83 ec 0c             	sub    $0xc,%esp
+  8003b7:	68 e0 66 80 00       	push   $0x8066e0
+  8003bc:	e8 a0 07 00 00       	call   800b61 <cprintf>
+				exit();
+  8003c1:	e8 a6 06 00 00       	call   800a6c <exit>
+  8003c6:	83 c4 10             	add    $0x10,%esp
+  8003c9:	eb be                	jmp    800389 <runcmd+0x18f>
+				cprintf("open %s for write: %e", t, fd);
+  8003cb:	83 ec 04             	sub    $0x4,%esp
+  8003ce:	50                   	push   %eax
+  8003cf:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  8003d5:	68 8e 65 80 00       	push   $0x80658e
+  8003da:	e8 82 07 00 00       	call   800b61 <cprintf>
+				exit();
+  8003df:	e8 88 06 00 00       	call   800a6c <exit>
+  8003e4:	83 c4 10             	add    $0x10,%esp
+				dup(fd, 1);
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	6a 01                	push   $0x1
+  8003ec:	57                   	push   %edi
+  8003ed:	e8 c7 21 00 00       	call   8025b9 <dup>
+				close(fd);
+  8003f2:	89 3c 24             	mov    %edi,(%esp)
+  8003f5:	e8 6d 21 00 00       	call   802567 <close>
+  8003fa:	83 c4 10             	add    $0x10,%esp
+  8003fd:	e9 19 fe ff ff       	jmp    80021b <runcmd+0x21>
+				cprintf("pipe: %e", r);
+  800402:	83 ec 08             	sub    $0x8,%esp
+  800405:	50                   	push   %eax
+  800406:	68 a4 65 80 00       	push   $0x8065a4
+  80040b:	e8 51 07 00 00       	call   800b61 <cprintf>
+				exit();
+  800410:	e8 57 06 00 00       	call   800a6c <exit>
+  800415:	83 c4 10             	add    $0x10,%esp
+  800418:	e9 94 fe ff ff       	jmp    8002b1 <runcmd+0xb7>
+				cprintf("PIPE: %d %d\n", p[0], p[1]);
+  80041d:	83 ec 04             	sub    $0x4,%esp
+  800420:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  800426:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  80042c:	68 ad 65 80 00       	push   $0x8065ad
+  800431:	e8 2b 07 00 00       	call   800b61 <cprintf>
+  800436:	83 c4 10             	add    $0x10,%esp
+  800439:	e9 80 fe ff ff       	jmp    8002be <runcmd+0xc4>
+				cprintf("fork: %e", r);
+  80043e:	83 ec 08             	sub    $0x8,%esp
+  800441:	50                   	push   %eax
+  800442:	68 ba 65 80 00       	push   $0x8065ba
+  800447:	e8 15 07 00 00       	call   800b61 <cprintf>
+				exit();
+  80044c:	e8 1b 06 00 00       	call   800a6c <exit>
+  800451:	83 c4 10             	add    $0x10,%esp
+				if (p[1] != 1) {
+  800454:	8b 85 a0 fb ff ff    	mov    -0x460(%ebp),%eax
+  80045a:	83 f8 01             	cmp    $0x1,%eax
+  80045d:	0f 85 cc 00 00 00    	jne    80052f <runcmd+0x335>
+				close(p[0]);
+  800463:	83 ec 0c             	sub    $0xc,%esp
+  800466:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  80046c:	e8 f6 20 00 00       	call   802567 <close>
+				goto runit;
+  800471:	83 c4 10             	add    $0x10,%esp
+	if(argc == 0) {
+  800474:	85 db                	test   %ebx,%ebx
+  800476:	0f 84 e6 00 00 00    	je     800562 <runcmd+0x368>
+	if (argv[0][0] != '/') {
+  80047c:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  80047f:	80 38 2f             	cmpb   $0x2f,(%eax)
+  800482:	0f 85 f5 00 00 00    	jne    80057d <runcmd+0x383>
+	argv[argc] = 0;
+  800488:	c7 44 9d a8 00 00 00 	movl   $0x0,-0x58(%ebp,%ebx,4)
+  80048f:	00 
+	if (debug) {
+  800490:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  800497:	0f 85 08 01 00 00    	jne    8005a5 <runcmd+0x3ab>
+	if ((r = spawn(argv[0], (const char**) argv)) < 0)
+  80049d:	83 ec 08             	sub    $0x8,%esp
+  8004a0:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  8004a3:	50                   	push   %eax
+  8004a4:	ff 75 a8             	push   -0x58(%ebp)
+  8004a7:	e8 ae 29 00 00       	call   802e5a <spawn>
+  8004ac:	89 c3                	mov    %eax,%ebx
+  8004ae:	83 c4 10             	add    $0x10,%esp
+  8004b1:	85 c0                	test   %eax,%eax
+  8004b3:	0f 88 3a 01 00 00    	js     8005f3 <runcmd+0x3f9>
+	close_all();
+  8004b9:	e8 d6 20 00 00       	call   802594 <close_all>
+		if (debug)
+  8004be:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8004c5:	0f 85 75 01 00 00    	jne    800640 <runcmd+0x446>
+		wait(r);
+  8004cb:	83 ec 0c             	sub    $0xc,%esp
+  8004ce:	53                   	push   %ebx
+  8004cf:	e8 4b 35 00 00       	call   803a1f <wait>
+		if (debug)
+  8004d4:	83 c4 10             	add    $0x10,%esp
+  8004d7:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8004de:	0f 85 7b 01 00 00    	jne    80065f <runcmd+0x465>
+	if (pipe_child) {
+  8004e4:	85 ff                	test   %edi,%edi
+  8004e6:	74 19                	je     800501 <runcmd+0x307>
+		wait(pipe_child);
+  8004e8:	83 ec 0c             	sub    $0xc,%esp
+  8004eb:	57                   	push   %edi
+  8004ec:	e8 2e 35 00 00       	call   803a1f <wait>
+		if (debug)
+  8004f1:	83 c4 10             	add    $0x10,%esp
+  8004f4:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8004fb:	0f 85 79 01 00 00    	jne    80067a <runcmd+0x480>
+	exit();
+  800501:	e8 66 05 00 00       	call   800a6c <exit>
+}
+  800506:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800509:	5b                   	pop    %ebx
+  80050a:	5e                   	pop    %esi
+  80050b:	5f                   	pop    %edi
+  80050c:	5d                   	pop    %ebp
+  80050d:	c3                   	ret
+					dup(p[0], 0);
+  80050e:	83 ec 08             	sub    $0x8,%esp
+  800511:	6a 00                	push   $0x0
+  800513:	50                   	push   %eax
+  800514:	e8 a0 20 00 00       	call   8025b9 <dup>
+					close(p[0]);
+  800519:	83 c4 04             	add    $0x4,%esp
+  80051c:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  800522:	e8 40 20 00 00       	call   802567 <close>
+  800527:	83 c4 10             	add    $0x10,%esp
+  80052a:	e9 b2 fd ff ff       	jmp    8002e1 <runcmd+0xe7>
+					dup(p[1], 1);
+  80052f:	83 ec 08             	sub    $0x8,%esp
+  800532:	6a 01                	push   $0x1
+  800534:	50                   	push   %eax
+  800535:	e8 7f 20 00 00       	call   8025b9 <dup>
+					close(p[1]);
+  80053a:	83 c4 04             	add    $0x4,%esp
+  80053d:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  800543:	e8 1f 20 00 00       	call   802567 <close>
+  800548:	83 c4 10             	add    $0x10,%esp
+  80054b:	e9 13 ff ff ff       	jmp    800463 <runcmd+0x269>
+			panic("bad return %d from gettoken", c);
+  800550:	57                   	push   %edi
+  800551:	68 c3 65 80 00       	push   $0x8065c3
+  800556:	6a 6e                	push   $0x6e
+  800558:	68 df 65 80 00       	push   $0x8065df
+  80055d:	e8 24 05 00 00       	call   800a86 <_panic>
+		if (debug)
+  800562:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  800569:	74 9b                	je     800506 <runcmd+0x30c>
+			cprintf("EMPTY COMMAND\n");
+  80056b:	83 ec 0c             	sub    $0xc,%esp
+  80056e:	68 e9 65 80 00       	push   $0x8065e9
+  800573:	e8 e9 05 00 00       	call   800b61 <cprintf>
+  800578:	83 c4 10             	add    $0x10,%esp
+		return;
+  80057b:	eb 89                	jmp    800506 <runcmd+0x30c>
+		argv0buf[0] = '/';
+  80057d:	c6 85 a4 fb ff ff 2f 	movb   $0x2f,-0x45c(%ebp)
+		strcpy(argv0buf + 1, argv[0]);
+  800584:	83 ec 08             	sub    $0x8,%esp
+  800587:	50                   	push   %eax
+  800588:	8d b5 a4 fb ff ff    	lea    -0x45c(%ebp),%esi
+  80058e:	8d 85 a5 fb ff ff    	lea    -0x45b(%ebp),%eax
+  800594:	50                   	push   %eax
+  800595:	e8 9e 0c 00 00       	call   801238 <strcpy>
+		argv[0] = argv0buf;
+  80059a:	89 75 a8             	mov    %esi,-0x58(%ebp)
+  80059d:	83 c4 10             	add    $0x10,%esp
+  8005a0:	e9 e3 fe ff ff       	jmp    800488 <runcmd+0x28e>
+		cprintf("[%08x] SPAWN:", thisenv->env_id);
+  8005a5:	a1 18 09 81 00       	mov    0x810918,%eax
+  8005aa:	8b 40 48             	mov    0x48(%eax),%eax
+  8005ad:	83 ec 08             	sub    $0x8,%esp
+  8005b0:	50                   	push   %eax
+  8005b1:	68 f8 65 80 00       	push   $0x8065f8
+  8005b6:	e8 a6 05 00 00       	call   800b61 <cprintf>
+		for (i = 0; argv[i]; i++)
+  8005bb:	8d 5d a8             	lea    -0x58(%ebp),%ebx
+  8005be:	83 c4 10             	add    $0x10,%esp
+  8005c1:	eb 11                	jmp    8005d4 <runcmd+0x3da>
+			cprintf(" %s", argv[i]);
+  8005c3:	83 ec 08             	sub    $0x8,%esp
+  8005c6:	50                   	push   %eax
+  8005c7:	68 80 66 80 00       	push   $0x806680
+  8005cc:	e8 90 05 00 00       	call   800b61 <cprintf>
+  8005d1:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; argv[i]; i++)
+  8005d4:	83 c3 04             	add    $0x4,%ebx
+  8005d7:	8b 43 fc             	mov    -0x4(%ebx),%eax
+  8005da:	85 c0                	test   %eax,%eax
+  8005dc:	75 e5                	jne    8005c3 <runcmd+0x3c9>
+		cprintf("\n");
+  8005de:	83 ec 0c             	sub    $0xc,%esp
+  8005e1:	68 40 65 80 00       	push   $0x806540
+  8005e6:	e8 76 05 00 00       	call   800b61 <cprintf>
+  8005eb:	83 c4 10             	add    $0x10,%esp
+  8005ee:	e9 aa fe ff ff       	jmp    80049d <runcmd+0x2a3>
+		cprintf("spawn %s: %e\n", argv[0], r);
+  8005f3:	83 ec 04             	sub    $0x4,%esp
+  8005f6:	50                   	push   %eax
+  8005f7:	ff 75 a8             	push   -0x58(%ebp)
+  8005fa:	68 06 66 80 00       	push   $0x806606
+  8005ff:	e8 5d 05 00 00       	call   800b61 <cprintf>
+	close_all();
+  800604:	e8 8b 1f 00 00       	call   802594 <close_all>
+	if (r >= 0) {
+  800609:	83 c4 10             	add    $0x10,%esp
+	if (pipe_child) {
+  80060c:	85 ff                	test   %edi,%edi
+  80060e:	0f 84 ed fe ff ff    	je     800501 <runcmd+0x307>
+		if (debug)
+  800614:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80061b:	0f 84 c7 fe ff ff    	je     8004e8 <runcmd+0x2ee>
+			cprintf("[%08x] WAIT pipe_child %08x\n", thisenv->env_id, pipe_child);
+  800621:	a1 18 09 81 00       	mov    0x810918,%eax
+  800626:	8b 40 48             	mov    0x48(%eax),%eax
+  800629:	83 ec 04             	sub    $0x4,%esp
+  80062c:	57                   	push   %edi
+  80062d:	50                   	push   %eax
+  80062e:	68 3f 66 80 00       	push   $0x80663f
+  800633:	e8 29 05 00 00       	call   800b61 <cprintf>
+  800638:	83 c4 10             	add    $0x10,%esp
+  80063b:	e9 a8 fe ff ff       	jmp    8004e8 <runcmd+0x2ee>
+			cprintf("[%08x] WAIT %s %08x\n", thisenv->env_id, argv[0], r);
+  800640:	a1 18 09 81 00       	mov    0x810918,%eax
+  800645:	8b 40 48             	mov    0x48(%eax),%eax
+  800648:	53                   	push   %ebx
+  800649:	ff 75 a8             	push   -0x58(%ebp)
+  80064c:	50                   	push   %eax
+  80064d:	68 14 66 80 00       	push   $0x806614
+  800652:	e8 0a 05 00 00       	call   800b61 <cprintf>
+  800657:	83 c4 10             	add    $0x10,%esp
+  80065a:	e9 6c fe ff ff       	jmp    8004cb <runcmd+0x2d1>
+			cprintf("[%08x] wait finished\n", thisenv->env_id);
+  80065f:	a1 18 09 81 00       	mov    0x810918,%eax
+  800664:	8b 40 48             	mov    0x48(%eax),%eax
+  800667:	83 ec 08             	sub    $0x8,%esp
+  80066a:	50                   	push   %eax
+  80066b:	68 29 66 80 00       	push   $0x806629
+  800670:	e8 ec 04 00 00       	call   800b61 <cprintf>
+  800675:	83 c4 10             	add    $0x10,%esp
+  800678:	eb 92                	jmp    80060c <runcmd+0x412>
+			cprintf("[%08x] wait finished\n", thisenv->env_id);
+  80067a:	a1 18 09 81 00       	mov    0x810918,%eax
+  80067f:	8b 40 48             	mov    0x48(%eax),%eax
+  800682:	83 ec 08             	sub    $0x8,%esp
+  800685:	50                   	push   %eax
+  800686:	68 29 66 80 00       	push   $0x806629
+  80068b:	e8 d1 04 00 00       	call   800b61 <cprintf>
+  800690:	83 c4 10             	add    $0x10,%esp
+  800693:	e9 69 fe ff ff       	jmp    800501 <runcmd+0x307>
+
+00800698 <usage>:
+
+
+void
+usage(void)
+{
+  800698:	55                   	push   %ebp
+  800699:	89 e5                	mov    %esp,%ebp
+  80069b:	83 ec 14             	sub    $0x14,%esp
+	cprintf("usage: sh [-dix] [command-file]\n");
+  80069e:	68 08 67 80 00       	push   $0x806708
+  8006a3:	e8 b9 04 00 00       	call   800b61 <cprintf>
+	exit();
+  8006a8:	e8 bf 03 00 00       	call   800a6c <exit>
+}
+  8006ad:	83 c4 10             	add    $0x10,%esp
+  8006b0:	c9                   	leave
+  8006b1:	c3                   	ret
+
+008006b2 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8006b2:	55                   	push   %ebp
+  8006b3:	89 e5                	mov    %esp,%ebp
+  8006b5:	57                   	push   %edi
+  8006b6:	56                   	push   %esi
+  8006b7:	53                   	push   %ebx
+  8006b8:	83 ec 30             	sub    $0x30,%esp
+	int r, interactive, echocmds;
+	struct Argstate args;
+
+	interactive = '?';
+	echocmds = 0;
+	argstart(&argc, argv, &args);
+  8006bb:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  8006be:	50                   	push   %eax
+  8006bf:	ff 75 0c             	push   0xc(%ebp)
+  8006c2:	8d 45 08             	lea    0x8(%ebp),%eax
+  8006c5:	50                   	push   %eax
+  8006c6:	e8 af 1b 00 00       	call   80227a <argstart>
+	while ((r = argnext(&args)) >= 0)
+  8006cb:	83 c4 10             	add    $0x10,%esp
+	echocmds = 0;
+  8006ce:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+	interactive = '?';
+  8006d5:	bf 3f 00 00 00       	mov    $0x3f,%edi
+	while ((r = argnext(&args)) >= 0)
+  8006da:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+		switch (r) {
+		case 'd':
+			debug++;
+			break;
+		case 'i':
+			interactive = 1;
+  8006dd:	be 01 00 00 00       	mov    $0x1,%esi
+	while ((r = argnext(&args)) >= 0)
+  8006e2:	eb 10                	jmp    8006f4 <umain+0x42>
+			debug++;
+  8006e4:	83 05 00 90 80 00 01 	addl   $0x1,0x809000
+			break;
+  8006eb:	eb 07                	jmp    8006f4 <umain+0x42>
+			interactive = 1;
+  8006ed:	89 f7                	mov    %esi,%edi
+  8006ef:	eb 03                	jmp    8006f4 <umain+0x42>
+		switch (r) {
+  8006f1:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+	while ((r = argnext(&args)) >= 0)
+  8006f4:	83 ec 0c             	sub    $0xc,%esp
+  8006f7:	53                   	push   %ebx
+  8006f8:	e8 ad 1b 00 00       	call   8022aa <argnext>
+  8006fd:	83 c4 10             	add    $0x10,%esp
+  800700:	85 c0                	test   %eax,%eax
+  800702:	78 16                	js     80071a <umain+0x68>
+		switch (r) {
+  800704:	83 f8 69             	cmp    $0x69,%eax
+  800707:	74 e4                	je     8006ed <umain+0x3b>
+  800709:	83 f8 78             	cmp    $0x78,%eax
+  80070c:	74 e3                	je     8006f1 <umain+0x3f>
+  80070e:	83 f8 64             	cmp    $0x64,%eax
+  800711:	74 d1                	je     8006e4 <umain+0x32>
+			break;
+		case 'x':
+			echocmds = 1;
+			break;
+		default:
+			usage();
+  800713:	e8 80 ff ff ff       	call   800698 <usage>
+  800718:	eb da                	jmp    8006f4 <umain+0x42>
+		}
+
+	if (argc > 2)
+  80071a:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  80071e:	7f 1f                	jg     80073f <umain+0x8d>
+		usage();
+	if (argc == 2) {
+  800720:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  800724:	74 20                	je     800746 <umain+0x94>
+		close(0);
+		if ((r = open(argv[1], O_RDONLY)) < 0)
+			panic("open %s: %e", argv[1], r);
+		assert(r == 0);
+	}
+	if (interactive == '?')
+  800726:	83 ff 3f             	cmp    $0x3f,%edi
+  800729:	74 75                	je     8007a0 <umain+0xee>
+  80072b:	85 ff                	test   %edi,%edi
+  80072d:	bf 84 66 80 00       	mov    $0x806684,%edi
+  800732:	b8 00 00 00 00       	mov    $0x0,%eax
+  800737:	0f 44 f8             	cmove  %eax,%edi
+  80073a:	e9 06 01 00 00       	jmp    800845 <umain+0x193>
+		usage();
+  80073f:	e8 54 ff ff ff       	call   800698 <usage>
+  800744:	eb da                	jmp    800720 <umain+0x6e>
+		close(0);
+  800746:	83 ec 0c             	sub    $0xc,%esp
+  800749:	6a 00                	push   $0x0
+  80074b:	e8 17 1e 00 00       	call   802567 <close>
+		if ((r = open(argv[1], O_RDONLY)) < 0)
+  800750:	83 c4 08             	add    $0x8,%esp
+  800753:	6a 00                	push   $0x0
+  800755:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800758:	ff 70 04             	push   0x4(%eax)
+  80075b:	e8 7e 24 00 00       	call   802bde <open>
+  800760:	83 c4 10             	add    $0x10,%esp
+  800763:	85 c0                	test   %eax,%eax
+  800765:	78 1b                	js     800782 <umain+0xd0>
+		assert(r == 0);
+  800767:	74 bd                	je     800726 <umain+0x74>
+  800769:	68 68 66 80 00       	push   $0x806668
+  80076e:	68 6f 66 80 00       	push   $0x80666f
+  800773:	68 1f 01 00 00       	push   $0x11f
+  800778:	68 df 65 80 00       	push   $0x8065df
+  80077d:	e8 04 03 00 00       	call   800a86 <_panic>
+			panic("open %s: %e", argv[1], r);
+  800782:	83 ec 0c             	sub    $0xc,%esp
+  800785:	50                   	push   %eax
+  800786:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800789:	ff 70 04             	push   0x4(%eax)
+  80078c:	68 5c 66 80 00       	push   $0x80665c
+  800791:	68 1e 01 00 00       	push   $0x11e
+  800796:	68 df 65 80 00       	push   $0x8065df
+  80079b:	e8 e6 02 00 00       	call   800a86 <_panic>
+		interactive = iscons(0);
+  8007a0:	83 ec 0c             	sub    $0xc,%esp
+  8007a3:	6a 00                	push   $0x0
+  8007a5:	e8 fb 01 00 00       	call   8009a5 <iscons>
+  8007aa:	89 c7                	mov    %eax,%edi
+  8007ac:	83 c4 10             	add    $0x10,%esp
+  8007af:	e9 77 ff ff ff       	jmp    80072b <umain+0x79>
+	while (1) {
+		char *buf;
+
+		buf = readline(interactive ? "$ " : NULL);
+		if (buf == NULL) {
+			if (debug)
+  8007b4:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8007bb:	75 0a                	jne    8007c7 <umain+0x115>
+				cprintf("EXITING\n");
+			exit();	// end of file
+  8007bd:	e8 aa 02 00 00       	call   800a6c <exit>
+  8007c2:	e9 94 00 00 00       	jmp    80085b <umain+0x1a9>
+				cprintf("EXITING\n");
+  8007c7:	83 ec 0c             	sub    $0xc,%esp
+  8007ca:	68 87 66 80 00       	push   $0x806687
+  8007cf:	e8 8d 03 00 00       	call   800b61 <cprintf>
+  8007d4:	83 c4 10             	add    $0x10,%esp
+  8007d7:	eb e4                	jmp    8007bd <umain+0x10b>
+		}
+		if (debug)
+			cprintf("LINE: %s\n", buf);
+  8007d9:	83 ec 08             	sub    $0x8,%esp
+  8007dc:	53                   	push   %ebx
+  8007dd:	68 90 66 80 00       	push   $0x806690
+  8007e2:	e8 7a 03 00 00       	call   800b61 <cprintf>
+  8007e7:	83 c4 10             	add    $0x10,%esp
+  8007ea:	eb 7c                	jmp    800868 <umain+0x1b6>
+		if (buf[0] == '#')
+			continue;
+		if (echocmds)
+			printf("# %s\n", buf);
+  8007ec:	83 ec 08             	sub    $0x8,%esp
+  8007ef:	53                   	push   %ebx
+  8007f0:	68 9a 66 80 00       	push   $0x80669a
+  8007f5:	e8 4a 26 00 00       	call   802e44 <printf>
+  8007fa:	83 c4 10             	add    $0x10,%esp
+  8007fd:	eb 78                	jmp    800877 <umain+0x1c5>
+		if (debug)
+			cprintf("BEFORE FORK\n");
+  8007ff:	83 ec 0c             	sub    $0xc,%esp
+  800802:	68 a0 66 80 00       	push   $0x8066a0
+  800807:	e8 55 03 00 00       	call   800b61 <cprintf>
+  80080c:	83 c4 10             	add    $0x10,%esp
+  80080f:	eb 73                	jmp    800884 <umain+0x1d2>
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+  800811:	50                   	push   %eax
+  800812:	68 ba 65 80 00       	push   $0x8065ba
+  800817:	68 36 01 00 00       	push   $0x136
+  80081c:	68 df 65 80 00       	push   $0x8065df
+  800821:	e8 60 02 00 00       	call   800a86 <_panic>
+		if (debug)
+			cprintf("FORK: %d\n", r);
+  800826:	83 ec 08             	sub    $0x8,%esp
+  800829:	50                   	push   %eax
+  80082a:	68 ad 66 80 00       	push   $0x8066ad
+  80082f:	e8 2d 03 00 00       	call   800b61 <cprintf>
+  800834:	83 c4 10             	add    $0x10,%esp
+  800837:	eb 5f                	jmp    800898 <umain+0x1e6>
+		if (r == 0) {
+			runcmd(buf);
+			exit();
+		} else
+			wait(r);
+  800839:	83 ec 0c             	sub    $0xc,%esp
+  80083c:	56                   	push   %esi
+  80083d:	e8 dd 31 00 00       	call   803a1f <wait>
+  800842:	83 c4 10             	add    $0x10,%esp
+		buf = readline(interactive ? "$ " : NULL);
+  800845:	83 ec 0c             	sub    $0xc,%esp
+  800848:	57                   	push   %edi
+  800849:	e8 bf 08 00 00       	call   80110d <readline>
+  80084e:	89 c3                	mov    %eax,%ebx
+		if (buf == NULL) {
+  800850:	83 c4 10             	add    $0x10,%esp
+  800853:	85 c0                	test   %eax,%eax
+  800855:	0f 84 59 ff ff ff    	je     8007b4 <umain+0x102>
+		if (debug)
+  80085b:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  800862:	0f 85 71 ff ff ff    	jne    8007d9 <umain+0x127>
+		if (buf[0] == '#')
+  800868:	80 3b 23             	cmpb   $0x23,(%ebx)
+  80086b:	74 d8                	je     800845 <umain+0x193>
+		if (echocmds)
+  80086d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  800871:	0f 85 75 ff ff ff    	jne    8007ec <umain+0x13a>
+		if (debug)
+  800877:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80087e:	0f 85 7b ff ff ff    	jne    8007ff <umain+0x14d>
+		if ((r = fork()) < 0)
+  800884:	e8 89 15 00 00       	call   801e12 <fork>
+  800889:	89 c6                	mov    %eax,%esi
+  80088b:	85 c0                	test   %eax,%eax
+  80088d:	78 82                	js     800811 <umain+0x15f>
+		if (debug)
+  80088f:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  800896:	75 8e                	jne    800826 <umain+0x174>
+		if (r == 0) {
+  800898:	85 f6                	test   %esi,%esi
+  80089a:	75 9d                	jne    800839 <umain+0x187>
+			runcmd(buf);
+  80089c:	83 ec 0c             	sub    $0xc,%esp
+  80089f:	53                   	push   %ebx
+  8008a0:	e8 55 f9 ff ff       	call   8001fa <runcmd>
+			exit();
+  8008a5:	e8 c2 01 00 00       	call   800a6c <exit>
+  8008aa:	83 c4 10             	add    $0x10,%esp
+  8008ad:	eb 96                	jmp    800845 <umain+0x193>
+
+008008af <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8008af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b4:	c3                   	ret
+
+008008b5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8008b5:	55                   	push   %ebp
+  8008b6:	89 e5                	mov    %esp,%ebp
+  8008b8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8008bb:	68 29 67 80 00       	push   $0x806729
+  8008c0:	ff 75 0c             	push   0xc(%ebp)
+  8008c3:	e8 70 09 00 00       	call   801238 <strcpy>
+	return 0;
+}
+  8008c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008cd:	c9                   	leave
+  8008ce:	c3                   	ret
+
+008008cf <devcons_write>:
+{
+  8008cf:	55                   	push   %ebp
+  8008d0:	89 e5                	mov    %esp,%ebp
+  8008d2:	57                   	push   %edi
+  8008d3:	56                   	push   %esi
+  8008d4:	53                   	push   %ebx
+  8008d5:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8008db:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8008e0:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8008e6:	eb 2e                	jmp    800916 <devcons_write+0x47>
+		m = n - tot;
+  8008e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008eb:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8008ed:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8008f2:	39 c3                	cmp    %eax,%ebx
+  8008f4:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8008f7:	83 ec 04             	sub    $0x4,%esp
+  8008fa:	53                   	push   %ebx
+  8008fb:	89 f0                	mov    %esi,%eax
+  8008fd:	03 45 0c             	add    0xc(%ebp),%eax
+  800900:	50                   	push   %eax
+  800901:	57                   	push   %edi
+  800902:	e8 b7 0a 00 00       	call   8013be <memmove>
+		sys_cputs(buf, m);
+  800907:	83 c4 08             	add    $0x8,%esp
+  80090a:	53                   	push   %ebx
+  80090b:	57                   	push   %edi
+  80090c:	e8 4d 0d 00 00       	call   80165e <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800911:	01 de                	add    %ebx,%esi
+  800913:	83 c4 10             	add    $0x10,%esp
+  800916:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800919:	72 cd                	jb     8008e8 <devcons_write+0x19>
+}
+  80091b:	89 f0                	mov    %esi,%eax
+  80091d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800920:	5b                   	pop    %ebx
+  800921:	5e                   	pop    %esi
+  800922:	5f                   	pop    %edi
+  800923:	5d                   	pop    %ebp
+  800924:	c3                   	ret
+
+00800925 <devcons_read>:
+{
+  800925:	55                   	push   %ebp
+  800926:	89 e5                	mov    %esp,%ebp
+  800928:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80092b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800930:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800934:	75 07                	jne    80093d <devcons_read+0x18>
+  800936:	eb 1f                	jmp    800957 <devcons_read+0x32>
+		sys_yield();
+  800938:	e8 cf 0d 00 00       	call   80170c <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80093d:	e8 4b 0d 00 00       	call   80168d <sys_cgetc>
+  800942:	85 c0                	test   %eax,%eax
+  800944:	74 f2                	je     800938 <devcons_read+0x13>
+	if (c < 0)
+  800946:	78 0f                	js     800957 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  800948:	83 f8 04             	cmp    $0x4,%eax
+  80094b:	74 0c                	je     800959 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80094d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800950:	88 02                	mov    %al,(%edx)
+	return 1;
+  800952:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  800957:	c9                   	leave
+  800958:	c3                   	ret
+		return 0;
+  800959:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095e:	eb f7                	jmp    800957 <devcons_read+0x32>
+
+00800960 <cputchar>:
+{
+  800960:	55                   	push   %ebp
+  800961:	89 e5                	mov    %esp,%ebp
+  800963:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  800966:	8b 45 08             	mov    0x8(%ebp),%eax
+  800969:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80096c:	6a 01                	push   $0x1
+  80096e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800971:	50                   	push   %eax
+  800972:	e8 e7 0c 00 00       	call   80165e <sys_cputs>
+}
+  800977:	83 c4 10             	add    $0x10,%esp
+  80097a:	c9                   	leave
+  80097b:	c3                   	ret
+
+0080097c <getchar>:
+{
+  80097c:	55                   	push   %ebp
+  80097d:	89 e5                	mov    %esp,%ebp
+  80097f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  800982:	6a 01                	push   $0x1
+  800984:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800987:	50                   	push   %eax
+  800988:	6a 00                	push   $0x0
+  80098a:	e8 14 1d 00 00       	call   8026a3 <read>
+	if (r < 0)
+  80098f:	83 c4 10             	add    $0x10,%esp
+  800992:	85 c0                	test   %eax,%eax
+  800994:	78 06                	js     80099c <getchar+0x20>
+	if (r < 1)
+  800996:	74 06                	je     80099e <getchar+0x22>
+	return c;
+  800998:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80099c:	c9                   	leave
+  80099d:	c3                   	ret
+		return -E_EOF;
+  80099e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8009a3:	eb f7                	jmp    80099c <getchar+0x20>
+
+008009a5 <iscons>:
+{
+  8009a5:	55                   	push   %ebp
+  8009a6:	89 e5                	mov    %esp,%ebp
+  8009a8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8009ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009ae:	50                   	push   %eax
+  8009af:	ff 75 08             	push   0x8(%ebp)
+  8009b2:	e8 8d 1a 00 00       	call   802444 <fd_lookup>
+  8009b7:	83 c4 10             	add    $0x10,%esp
+  8009ba:	85 c0                	test   %eax,%eax
+  8009bc:	78 11                	js     8009cf <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8009be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009c1:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  8009c7:	39 10                	cmp    %edx,(%eax)
+  8009c9:	0f 94 c0             	sete   %al
+  8009cc:	0f b6 c0             	movzbl %al,%eax
+}
+  8009cf:	c9                   	leave
+  8009d0:	c3                   	ret
+
+008009d1 <opencons>:
+{
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8009d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009da:	50                   	push   %eax
+  8009db:	e8 10 1a 00 00       	call   8023f0 <fd_alloc>
+  8009e0:	83 c4 10             	add    $0x10,%esp
+  8009e3:	85 c0                	test   %eax,%eax
+  8009e5:	78 3a                	js     800a21 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8009e7:	83 ec 04             	sub    $0x4,%esp
+  8009ea:	68 07 04 00 00       	push   $0x407
+  8009ef:	ff 75 f4             	push   -0xc(%ebp)
+  8009f2:	6a 00                	push   $0x0
+  8009f4:	e8 32 0d 00 00       	call   80172b <sys_page_alloc>
+  8009f9:	83 c4 10             	add    $0x10,%esp
+  8009fc:	85 c0                	test   %eax,%eax
+  8009fe:	78 21                	js     800a21 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800a00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a03:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  800a09:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800a0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a0e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800a15:	83 ec 0c             	sub    $0xc,%esp
+  800a18:	50                   	push   %eax
+  800a19:	e8 ab 19 00 00       	call   8023c9 <fd2num>
+  800a1e:	83 c4 10             	add    $0x10,%esp
+}
+  800a21:	c9                   	leave
+  800a22:	c3                   	ret
+
+00800a23 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800a23:	55                   	push   %ebp
+  800a24:	89 e5                	mov    %esp,%ebp
+  800a26:	56                   	push   %esi
+  800a27:	53                   	push   %ebx
+  800a28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a2b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800a2e:	e8 ba 0c 00 00       	call   8016ed <sys_getenvid>
+  800a33:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800a38:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800a3b:	c1 e0 06             	shl    $0x6,%eax
+  800a3e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800a43:	a3 18 09 81 00       	mov    %eax,0x810918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800a48:	85 db                	test   %ebx,%ebx
+  800a4a:	7e 07                	jle    800a53 <libmain+0x30>
+		binaryname = argv[0];
+  800a4c:	8b 06                	mov    (%esi),%eax
+  800a4e:	a3 1c 80 80 00       	mov    %eax,0x80801c
+
+	// call user main routine
+	umain(argc, argv);
+  800a53:	83 ec 08             	sub    $0x8,%esp
+  800a56:	56                   	push   %esi
+  800a57:	53                   	push   %ebx
+  800a58:	e8 55 fc ff ff       	call   8006b2 <umain>
+
+	// exit gracefully
+	exit();
+  800a5d:	e8 0a 00 00 00       	call   800a6c <exit>
+}
+  800a62:	83 c4 10             	add    $0x10,%esp
+  800a65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a68:	5b                   	pop    %ebx
+  800a69:	5e                   	pop    %esi
+  800a6a:	5d                   	pop    %ebp
+  800a6b:	c3                   	ret
+
+00800a6c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800a6c:	55                   	push   %ebp
+  800a6d:	89 e5                	mov    %esp,%ebp
+  800a6f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800a72:	e8 1d 1b 00 00       	call   802594 <close_all>
+	sys_env_destroy(0);
+  800a77:	83 ec 0c             	sub    $0xc,%esp
+  800a7a:	6a 00                	push   $0x0
+  800a7c:	e8 2b 0c 00 00       	call   8016ac <sys_env_destroy>
+}
+  800a81:	83 c4 10             	add    $0x10,%esp
+  800a84:	c9                   	leave
+  800a85:	c3                   	ret
+
+00800a86 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800a86:	55                   	push   %ebp
+  800a87:	89 e5                	mov    %esp,%ebp
+  800a89:	56                   	push   %esi
+  800a8a:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800a8b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800a8e:	8b 35 1c 80 80 00    	mov    0x80801c,%esi
+  800a94:	e8 54 0c 00 00       	call   8016ed <sys_getenvid>
+  800a99:	83 ec 0c             	sub    $0xc,%esp
+  800a9c:	ff 75 0c             	push   0xc(%ebp)
+  800a9f:	ff 75 08             	push   0x8(%ebp)
+  800aa2:	56                   	push   %esi
+  800aa3:	50                   	push   %eax
+  800aa4:	68 40 67 80 00       	push   $0x806740
+  800aa9:	e8 b3 00 00 00       	call   800b61 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800aae:	83 c4 18             	add    $0x18,%esp
+  800ab1:	53                   	push   %ebx
+  800ab2:	ff 75 10             	push   0x10(%ebp)
+  800ab5:	e8 56 00 00 00       	call   800b10 <vcprintf>
+	cprintf("\n");
+  800aba:	c7 04 24 40 65 80 00 	movl   $0x806540,(%esp)
+  800ac1:	e8 9b 00 00 00       	call   800b61 <cprintf>
+  800ac6:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800ac9:	cc                   	int3
+	while (1)
+  800aca:	eb fd                	jmp    800ac9 <_panic+0x43>
+
+00800acc <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800acc:	55                   	push   %ebp
+  800acd:	89 e5                	mov    %esp,%ebp
+  800acf:	53                   	push   %ebx
+  800ad0:	83 ec 04             	sub    $0x4,%esp
+  800ad3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800ad6:	8b 13                	mov    (%ebx),%edx
+  800ad8:	8d 42 01             	lea    0x1(%edx),%eax
+  800adb:	89 03                	mov    %eax,(%ebx)
+  800add:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ae0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800ae4:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800ae9:	74 09                	je     800af4 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800aeb:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800aef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800af2:	c9                   	leave
+  800af3:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800af4:	83 ec 08             	sub    $0x8,%esp
+  800af7:	68 ff 00 00 00       	push   $0xff
+  800afc:	8d 43 08             	lea    0x8(%ebx),%eax
+  800aff:	50                   	push   %eax
+  800b00:	e8 59 0b 00 00       	call   80165e <sys_cputs>
+		b->idx = 0;
+  800b05:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800b0b:	83 c4 10             	add    $0x10,%esp
+  800b0e:	eb db                	jmp    800aeb <putch+0x1f>
+
+00800b10 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800b10:	55                   	push   %ebp
+  800b11:	89 e5                	mov    %esp,%ebp
+  800b13:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800b19:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800b20:	00 00 00 
+	b.cnt = 0;
+  800b23:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800b2a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800b2d:	ff 75 0c             	push   0xc(%ebp)
+  800b30:	ff 75 08             	push   0x8(%ebp)
+  800b33:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800b39:	50                   	push   %eax
+  800b3a:	68 cc 0a 80 00       	push   $0x800acc
+  800b3f:	e8 14 01 00 00       	call   800c58 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800b44:	83 c4 08             	add    $0x8,%esp
+  800b47:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800b4d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800b53:	50                   	push   %eax
+  800b54:	e8 05 0b 00 00       	call   80165e <sys_cputs>
+
+	return b.cnt;
+}
+  800b59:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800b5f:	c9                   	leave
+  800b60:	c3                   	ret
+
+00800b61 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800b61:	55                   	push   %ebp
+  800b62:	89 e5                	mov    %esp,%ebp
+  800b64:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800b67:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800b6a:	50                   	push   %eax
+  800b6b:	ff 75 08             	push   0x8(%ebp)
+  800b6e:	e8 9d ff ff ff       	call   800b10 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800b73:	c9                   	leave
+  800b74:	c3                   	ret
+
+00800b75 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800b75:	55                   	push   %ebp
+  800b76:	89 e5                	mov    %esp,%ebp
+  800b78:	57                   	push   %edi
+  800b79:	56                   	push   %esi
+  800b7a:	53                   	push   %ebx
+  800b7b:	83 ec 1c             	sub    $0x1c,%esp
+  800b7e:	89 c7                	mov    %eax,%edi
+  800b80:	89 d6                	mov    %edx,%esi
+  800b82:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b85:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b88:	89 d1                	mov    %edx,%ecx
+  800b8a:	89 c2                	mov    %eax,%edx
+  800b8c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b8f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b92:	8b 45 10             	mov    0x10(%ebp),%eax
+  800b95:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800b98:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b9b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800ba2:	39 c2                	cmp    %eax,%edx
+  800ba4:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800ba7:	72 3e                	jb     800be7 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800ba9:	83 ec 0c             	sub    $0xc,%esp
+  800bac:	ff 75 18             	push   0x18(%ebp)
+  800baf:	83 eb 01             	sub    $0x1,%ebx
+  800bb2:	53                   	push   %ebx
+  800bb3:	50                   	push   %eax
+  800bb4:	83 ec 08             	sub    $0x8,%esp
+  800bb7:	ff 75 e4             	push   -0x1c(%ebp)
+  800bba:	ff 75 e0             	push   -0x20(%ebp)
+  800bbd:	ff 75 dc             	push   -0x24(%ebp)
+  800bc0:	ff 75 d8             	push   -0x28(%ebp)
+  800bc3:	e8 23 58 00 00       	call   8063eb <__udivdi3>
+  800bc8:	83 c4 18             	add    $0x18,%esp
+  800bcb:	52                   	push   %edx
+  800bcc:	50                   	push   %eax
+  800bcd:	89 f2                	mov    %esi,%edx
+  800bcf:	89 f8                	mov    %edi,%eax
+  800bd1:	e8 9f ff ff ff       	call   800b75 <printnum>
+  800bd6:	83 c4 20             	add    $0x20,%esp
+  800bd9:	eb 13                	jmp    800bee <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800bdb:	83 ec 08             	sub    $0x8,%esp
+  800bde:	56                   	push   %esi
+  800bdf:	ff 75 18             	push   0x18(%ebp)
+  800be2:	ff d7                	call   *%edi
+  800be4:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800be7:	83 eb 01             	sub    $0x1,%ebx
+  800bea:	85 db                	test   %ebx,%ebx
+  800bec:	7f ed                	jg     800bdb <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800bee:	83 ec 08             	sub    $0x8,%esp
+  800bf1:	56                   	push   %esi
+  800bf2:	83 ec 04             	sub    $0x4,%esp
+  800bf5:	ff 75 e4             	push   -0x1c(%ebp)
+  800bf8:	ff 75 e0             	push   -0x20(%ebp)
+  800bfb:	ff 75 dc             	push   -0x24(%ebp)
+  800bfe:	ff 75 d8             	push   -0x28(%ebp)
+  800c01:	e8 03 58 00 00       	call   806409 <__umoddi3>
+  800c06:	83 c4 14             	add    $0x14,%esp
+  800c09:	0f be 80 63 67 80 00 	movsbl 0x806763(%eax),%eax
+  800c10:	50                   	push   %eax
+  800c11:	ff d7                	call   *%edi
+}
+  800c13:	83 c4 10             	add    $0x10,%esp
+  800c16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c19:	5b                   	pop    %ebx
+  800c1a:	5e                   	pop    %esi
+  800c1b:	5f                   	pop    %edi
+  800c1c:	5d                   	pop    %ebp
+  800c1d:	c3                   	ret
+
+00800c1e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800c1e:	55                   	push   %ebp
+  800c1f:	89 e5                	mov    %esp,%ebp
+  800c21:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800c24:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800c28:	8b 10                	mov    (%eax),%edx
+  800c2a:	3b 50 04             	cmp    0x4(%eax),%edx
+  800c2d:	73 0a                	jae    800c39 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800c2f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800c32:	89 08                	mov    %ecx,(%eax)
+  800c34:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c37:	88 02                	mov    %al,(%edx)
+}
+  800c39:	5d                   	pop    %ebp
+  800c3a:	c3                   	ret
+
+00800c3b <printfmt>:
+{
+  800c3b:	55                   	push   %ebp
+  800c3c:	89 e5                	mov    %esp,%ebp
+  800c3e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800c41:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800c44:	50                   	push   %eax
+  800c45:	ff 75 10             	push   0x10(%ebp)
+  800c48:	ff 75 0c             	push   0xc(%ebp)
+  800c4b:	ff 75 08             	push   0x8(%ebp)
+  800c4e:	e8 05 00 00 00       	call   800c58 <vprintfmt>
+}
+  800c53:	83 c4 10             	add    $0x10,%esp
+  800c56:	c9                   	leave
+  800c57:	c3                   	ret
+
+00800c58 <vprintfmt>:
+{
+  800c58:	55                   	push   %ebp
+  800c59:	89 e5                	mov    %esp,%ebp
+  800c5b:	57                   	push   %edi
+  800c5c:	56                   	push   %esi
+  800c5d:	53                   	push   %ebx
+  800c5e:	83 ec 2c             	sub    $0x2c,%esp
+  800c61:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c64:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c67:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800c6a:	eb 0a                	jmp    800c76 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800c6c:	83 ec 08             	sub    $0x8,%esp
+  800c6f:	53                   	push   %ebx
+  800c70:	50                   	push   %eax
+  800c71:	ff d6                	call   *%esi
+  800c73:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c76:	83 c7 01             	add    $0x1,%edi
+  800c79:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800c7d:	83 f8 25             	cmp    $0x25,%eax
+  800c80:	74 0c                	je     800c8e <vprintfmt+0x36>
+			if (ch == '\0')
+  800c82:	85 c0                	test   %eax,%eax
+  800c84:	75 e6                	jne    800c6c <vprintfmt+0x14>
+}
+  800c86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c89:	5b                   	pop    %ebx
+  800c8a:	5e                   	pop    %esi
+  800c8b:	5f                   	pop    %edi
+  800c8c:	5d                   	pop    %ebp
+  800c8d:	c3                   	ret
+		padc = ' ';
+  800c8e:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800c92:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800c99:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800ca0:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800ca7:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800cac:	8d 47 01             	lea    0x1(%edi),%eax
+  800caf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800cb2:	0f b6 17             	movzbl (%edi),%edx
+  800cb5:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800cb8:	3c 55                	cmp    $0x55,%al
+  800cba:	0f 87 c5 03 00 00    	ja     801085 <vprintfmt+0x42d>
+  800cc0:	0f b6 c0             	movzbl %al,%eax
+  800cc3:	ff 24 85 e0 68 80 00 	jmp    *0x8068e0(,%eax,4)
+  800cca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800ccd:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800cd1:	eb d9                	jmp    800cac <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800cd3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800cd6:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800cda:	eb d0                	jmp    800cac <vprintfmt+0x54>
+  800cdc:	0f b6 d2             	movzbl %dl,%edx
+  800cdf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800cea:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800ced:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800cf1:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800cf4:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800cf7:	83 f9 09             	cmp    $0x9,%ecx
+  800cfa:	77 55                	ja     800d51 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800cfc:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800cff:	eb e9                	jmp    800cea <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800d01:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d04:	8b 00                	mov    (%eax),%eax
+  800d06:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800d09:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d0c:	8d 40 04             	lea    0x4(%eax),%eax
+  800d0f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800d12:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800d15:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800d19:	79 91                	jns    800cac <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800d1b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800d1e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800d21:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800d28:	eb 82                	jmp    800cac <vprintfmt+0x54>
+			if (width < 0)
+  800d2a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800d2d:	85 d2                	test   %edx,%edx
+  800d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d34:	0f 49 c2             	cmovns %edx,%eax
+  800d37:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800d3a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800d3d:	e9 6a ff ff ff       	jmp    800cac <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800d42:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800d45:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800d4c:	e9 5b ff ff ff       	jmp    800cac <vprintfmt+0x54>
+  800d51:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800d54:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800d57:	eb bc                	jmp    800d15 <vprintfmt+0xbd>
+			lflag++;
+  800d59:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800d5c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800d5f:	e9 48 ff ff ff       	jmp    800cac <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800d64:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d67:	8d 78 04             	lea    0x4(%eax),%edi
+  800d6a:	83 ec 08             	sub    $0x8,%esp
+  800d6d:	53                   	push   %ebx
+  800d6e:	ff 30                	push   (%eax)
+  800d70:	ff d6                	call   *%esi
+			break;
+  800d72:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800d75:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800d78:	e9 63 02 00 00       	jmp    800fe0 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800d7d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d80:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800d83:	8b 10                	mov    (%eax),%edx
+  800d85:	89 d0                	mov    %edx,%eax
+  800d87:	f7 d8                	neg    %eax
+  800d89:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800d8c:	83 f8 12             	cmp    $0x12,%eax
+  800d8f:	7f 23                	jg     800db4 <vprintfmt+0x15c>
+  800d91:	8b 14 85 40 6a 80 00 	mov    0x806a40(,%eax,4),%edx
+  800d98:	85 d2                	test   %edx,%edx
+  800d9a:	74 18                	je     800db4 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800d9c:	52                   	push   %edx
+  800d9d:	68 81 66 80 00       	push   $0x806681
+  800da2:	53                   	push   %ebx
+  800da3:	56                   	push   %esi
+  800da4:	e8 92 fe ff ff       	call   800c3b <printfmt>
+  800da9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800dac:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800daf:	e9 2c 02 00 00       	jmp    800fe0 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  800db4:	50                   	push   %eax
+  800db5:	68 7b 67 80 00       	push   $0x80677b
+  800dba:	53                   	push   %ebx
+  800dbb:	56                   	push   %esi
+  800dbc:	e8 7a fe ff ff       	call   800c3b <printfmt>
+  800dc1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800dc4:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800dc7:	e9 14 02 00 00       	jmp    800fe0 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800dcc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dcf:	83 c0 04             	add    $0x4,%eax
+  800dd2:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800dd5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dd8:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800dda:	85 c9                	test   %ecx,%ecx
+  800ddc:	b8 74 67 80 00       	mov    $0x806774,%eax
+  800de1:	0f 45 c1             	cmovne %ecx,%eax
+  800de4:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800de7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800deb:	7e 06                	jle    800df3 <vprintfmt+0x19b>
+  800ded:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800df1:	75 0b                	jne    800dfe <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800df3:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800df6:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800df9:	89 75 08             	mov    %esi,0x8(%ebp)
+  800dfc:	eb 5c                	jmp    800e5a <vprintfmt+0x202>
+  800dfe:	83 ec 08             	sub    $0x8,%esp
+  800e01:	ff 75 d0             	push   -0x30(%ebp)
+  800e04:	ff 75 cc             	push   -0x34(%ebp)
+  800e07:	e8 09 04 00 00       	call   801215 <strnlen>
+  800e0c:	89 c2                	mov    %eax,%edx
+  800e0e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800e11:	29 d0                	sub    %edx,%eax
+  800e13:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800e16:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800e1a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e1d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800e20:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800e22:	eb 0e                	jmp    800e32 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800e24:	83 ec 08             	sub    $0x8,%esp
+  800e27:	53                   	push   %ebx
+  800e28:	57                   	push   %edi
+  800e29:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800e2c:	83 ee 01             	sub    $0x1,%esi
+  800e2f:	83 c4 10             	add    $0x10,%esp
+  800e32:	85 f6                	test   %esi,%esi
+  800e34:	7f ee                	jg     800e24 <vprintfmt+0x1cc>
+  800e36:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800e39:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e3c:	85 c0                	test   %eax,%eax
+  800e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e43:	0f 49 d0             	cmovns %eax,%edx
+  800e46:	29 d0                	sub    %edx,%eax
+  800e48:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e4b:	eb a6                	jmp    800df3 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800e4d:	83 ec 08             	sub    $0x8,%esp
+  800e50:	53                   	push   %ebx
+  800e51:	52                   	push   %edx
+  800e52:	ff 55 08             	call   *0x8(%ebp)
+  800e55:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e58:	89 f1                	mov    %esi,%ecx
+  800e5a:	8d 71 01             	lea    0x1(%ecx),%esi
+  800e5d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800e61:	0f be d0             	movsbl %al,%edx
+  800e64:	85 d2                	test   %edx,%edx
+  800e66:	74 28                	je     800e90 <vprintfmt+0x238>
+  800e68:	85 ff                	test   %edi,%edi
+  800e6a:	78 05                	js     800e71 <vprintfmt+0x219>
+  800e6c:	83 ef 01             	sub    $0x1,%edi
+  800e6f:	78 30                	js     800ea1 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800e71:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800e75:	74 d6                	je     800e4d <vprintfmt+0x1f5>
+  800e77:	0f be c0             	movsbl %al,%eax
+  800e7a:	83 e8 20             	sub    $0x20,%eax
+  800e7d:	83 f8 5e             	cmp    $0x5e,%eax
+  800e80:	76 cb                	jbe    800e4d <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800e82:	83 ec 08             	sub    $0x8,%esp
+  800e85:	53                   	push   %ebx
+  800e86:	6a 3f                	push   $0x3f
+  800e88:	ff 55 08             	call   *0x8(%ebp)
+  800e8b:	83 c4 10             	add    $0x10,%esp
+  800e8e:	eb c8                	jmp    800e58 <vprintfmt+0x200>
+  800e90:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e93:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800e96:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800e99:	01 d0                	add    %edx,%eax
+  800e9b:	29 c8                	sub    %ecx,%eax
+  800e9d:	89 c7                	mov    %eax,%edi
+  800e9f:	eb 13                	jmp    800eb4 <vprintfmt+0x25c>
+  800ea1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ea4:	eb ed                	jmp    800e93 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800ea6:	83 ec 08             	sub    $0x8,%esp
+  800ea9:	53                   	push   %ebx
+  800eaa:	6a 20                	push   $0x20
+  800eac:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800eae:	83 ef 01             	sub    $0x1,%edi
+  800eb1:	83 c4 10             	add    $0x10,%esp
+  800eb4:	85 ff                	test   %edi,%edi
+  800eb6:	7f ee                	jg     800ea6 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800eb8:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800ebb:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ebe:	e9 1d 01 00 00       	jmp    800fe0 <vprintfmt+0x388>
+	if (lflag >= 2)
+  800ec3:	83 f9 01             	cmp    $0x1,%ecx
+  800ec6:	7f 1b                	jg     800ee3 <vprintfmt+0x28b>
+	else if (lflag)
+  800ec8:	85 c9                	test   %ecx,%ecx
+  800eca:	74 63                	je     800f2f <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800ecc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ecf:	8b 00                	mov    (%eax),%eax
+  800ed1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ed4:	99                   	cltd
+  800ed5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800ed8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800edb:	8d 40 04             	lea    0x4(%eax),%eax
+  800ede:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ee1:	eb 17                	jmp    800efa <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  800ee3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ee6:	8b 50 04             	mov    0x4(%eax),%edx
+  800ee9:	8b 00                	mov    (%eax),%eax
+  800eeb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800eee:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800ef1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ef4:	8d 40 08             	lea    0x8(%eax),%eax
+  800ef7:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800efa:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800efd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800f00:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800f05:	85 c9                	test   %ecx,%ecx
+  800f07:	0f 89 b9 00 00 00    	jns    800fc6 <vprintfmt+0x36e>
+				putch('-', putdat);
+  800f0d:	83 ec 08             	sub    $0x8,%esp
+  800f10:	53                   	push   %ebx
+  800f11:	6a 2d                	push   $0x2d
+  800f13:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800f15:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800f18:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800f1b:	f7 da                	neg    %edx
+  800f1d:	83 d1 00             	adc    $0x0,%ecx
+  800f20:	f7 d9                	neg    %ecx
+  800f22:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800f25:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800f2a:	e9 97 00 00 00       	jmp    800fc6 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800f2f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f32:	8b 00                	mov    (%eax),%eax
+  800f34:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800f37:	99                   	cltd
+  800f38:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800f3b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f3e:	8d 40 04             	lea    0x4(%eax),%eax
+  800f41:	89 45 14             	mov    %eax,0x14(%ebp)
+  800f44:	eb b4                	jmp    800efa <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  800f46:	83 f9 01             	cmp    $0x1,%ecx
+  800f49:	7f 1b                	jg     800f66 <vprintfmt+0x30e>
+	else if (lflag)
+  800f4b:	85 c9                	test   %ecx,%ecx
+  800f4d:	74 2c                	je     800f7b <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800f4f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f52:	8b 10                	mov    (%eax),%edx
+  800f54:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f59:	8d 40 04             	lea    0x4(%eax),%eax
+  800f5c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f5f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800f64:	eb 60                	jmp    800fc6 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800f66:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f69:	8b 10                	mov    (%eax),%edx
+  800f6b:	8b 48 04             	mov    0x4(%eax),%ecx
+  800f6e:	8d 40 08             	lea    0x8(%eax),%eax
+  800f71:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f74:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800f79:	eb 4b                	jmp    800fc6 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800f7b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f7e:	8b 10                	mov    (%eax),%edx
+  800f80:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f85:	8d 40 04             	lea    0x4(%eax),%eax
+  800f88:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f8b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800f90:	eb 34                	jmp    800fc6 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800f92:	83 f9 01             	cmp    $0x1,%ecx
+  800f95:	7f 15                	jg     800fac <vprintfmt+0x354>
+	else if (lflag)
+  800f97:	85 c9                	test   %ecx,%ecx
+  800f99:	74 4d                	je     800fe8 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800f9b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f9e:	8b 00                	mov    (%eax),%eax
+  800fa0:	99                   	cltd
+  800fa1:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800fa4:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800fa7:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800faa:	eb 11                	jmp    800fbd <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800fac:	8b 45 14             	mov    0x14(%ebp),%eax
+  800faf:	8b 50 04             	mov    0x4(%eax),%edx
+  800fb2:	8b 00                	mov    (%eax),%eax
+  800fb4:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800fb7:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800fba:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800fbd:	89 d1                	mov    %edx,%ecx
+  800fbf:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800fc1:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800fc6:	83 ec 0c             	sub    $0xc,%esp
+  800fc9:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800fcd:	50                   	push   %eax
+  800fce:	ff 75 e0             	push   -0x20(%ebp)
+  800fd1:	57                   	push   %edi
+  800fd2:	51                   	push   %ecx
+  800fd3:	52                   	push   %edx
+  800fd4:	89 da                	mov    %ebx,%edx
+  800fd6:	89 f0                	mov    %esi,%eax
+  800fd8:	e8 98 fb ff ff       	call   800b75 <printnum>
+			break;
+  800fdd:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800fe0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800fe3:	e9 8e fc ff ff       	jmp    800c76 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800fe8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800feb:	8b 00                	mov    (%eax),%eax
+  800fed:	99                   	cltd
+  800fee:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800ff1:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800ff4:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800ff7:	eb c4                	jmp    800fbd <vprintfmt+0x365>
+			putch('0', putdat);
+  800ff9:	83 ec 08             	sub    $0x8,%esp
+  800ffc:	53                   	push   %ebx
+  800ffd:	6a 30                	push   $0x30
+  800fff:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801001:	83 c4 08             	add    $0x8,%esp
+  801004:	53                   	push   %ebx
+  801005:	6a 78                	push   $0x78
+  801007:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801009:	8b 45 14             	mov    0x14(%ebp),%eax
+  80100c:	8b 10                	mov    (%eax),%edx
+  80100e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801013:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801016:	8d 40 04             	lea    0x4(%eax),%eax
+  801019:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80101c:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  801021:	eb a3                	jmp    800fc6 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801023:	83 f9 01             	cmp    $0x1,%ecx
+  801026:	7f 1b                	jg     801043 <vprintfmt+0x3eb>
+	else if (lflag)
+  801028:	85 c9                	test   %ecx,%ecx
+  80102a:	74 2f                	je     80105b <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  80102c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80102f:	8b 10                	mov    (%eax),%edx
+  801031:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801036:	8d 40 04             	lea    0x4(%eax),%eax
+  801039:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80103c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801041:	eb 83                	jmp    800fc6 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801043:	8b 45 14             	mov    0x14(%ebp),%eax
+  801046:	8b 10                	mov    (%eax),%edx
+  801048:	8b 48 04             	mov    0x4(%eax),%ecx
+  80104b:	8d 40 08             	lea    0x8(%eax),%eax
+  80104e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801051:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801056:	e9 6b ff ff ff       	jmp    800fc6 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80105b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80105e:	8b 10                	mov    (%eax),%edx
+  801060:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801065:	8d 40 04             	lea    0x4(%eax),%eax
+  801068:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80106b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801070:	e9 51 ff ff ff       	jmp    800fc6 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  801075:	83 ec 08             	sub    $0x8,%esp
+  801078:	53                   	push   %ebx
+  801079:	6a 25                	push   $0x25
+  80107b:	ff d6                	call   *%esi
+			break;
+  80107d:	83 c4 10             	add    $0x10,%esp
+  801080:	e9 5b ff ff ff       	jmp    800fe0 <vprintfmt+0x388>
+			putch('%', putdat);
+  801085:	83 ec 08             	sub    $0x8,%esp
+  801088:	53                   	push   %ebx
+  801089:	6a 25                	push   $0x25
+  80108b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80108d:	83 c4 10             	add    $0x10,%esp
+  801090:	89 f8                	mov    %edi,%eax
+  801092:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801096:	74 05                	je     80109d <vprintfmt+0x445>
+  801098:	83 e8 01             	sub    $0x1,%eax
+  80109b:	eb f5                	jmp    801092 <vprintfmt+0x43a>
+  80109d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8010a0:	e9 3b ff ff ff       	jmp    800fe0 <vprintfmt+0x388>
+
+008010a5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8010a5:	55                   	push   %ebp
+  8010a6:	89 e5                	mov    %esp,%ebp
+  8010a8:	83 ec 18             	sub    $0x18,%esp
+  8010ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8010b1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8010b4:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8010b8:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8010bb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8010c2:	85 c0                	test   %eax,%eax
+  8010c4:	74 26                	je     8010ec <vsnprintf+0x47>
+  8010c6:	85 d2                	test   %edx,%edx
+  8010c8:	7e 22                	jle    8010ec <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8010ca:	ff 75 14             	push   0x14(%ebp)
+  8010cd:	ff 75 10             	push   0x10(%ebp)
+  8010d0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8010d3:	50                   	push   %eax
+  8010d4:	68 1e 0c 80 00       	push   $0x800c1e
+  8010d9:	e8 7a fb ff ff       	call   800c58 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8010de:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8010e1:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8010e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010e7:	83 c4 10             	add    $0x10,%esp
+}
+  8010ea:	c9                   	leave
+  8010eb:	c3                   	ret
+		return -E_INVAL;
+  8010ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010f1:	eb f7                	jmp    8010ea <vsnprintf+0x45>
+
+008010f3 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8010f3:	55                   	push   %ebp
+  8010f4:	89 e5                	mov    %esp,%ebp
+  8010f6:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8010f9:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8010fc:	50                   	push   %eax
+  8010fd:	ff 75 10             	push   0x10(%ebp)
+  801100:	ff 75 0c             	push   0xc(%ebp)
+  801103:	ff 75 08             	push   0x8(%ebp)
+  801106:	e8 9a ff ff ff       	call   8010a5 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80110b:	c9                   	leave
+  80110c:	c3                   	ret
+
+0080110d <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  80110d:	55                   	push   %ebp
+  80110e:	89 e5                	mov    %esp,%ebp
+  801110:	57                   	push   %edi
+  801111:	56                   	push   %esi
+  801112:	53                   	push   %ebx
+  801113:	83 ec 0c             	sub    $0xc,%esp
+  801116:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  801119:	85 c0                	test   %eax,%eax
+  80111b:	74 13                	je     801130 <readline+0x23>
+		fprintf(1, "%s", prompt);
+  80111d:	83 ec 04             	sub    $0x4,%esp
+  801120:	50                   	push   %eax
+  801121:	68 81 66 80 00       	push   $0x806681
+  801126:	6a 01                	push   $0x1
+  801128:	e8 00 1d 00 00       	call   802e2d <fprintf>
+  80112d:	83 c4 10             	add    $0x10,%esp
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+  801130:	83 ec 0c             	sub    $0xc,%esp
+  801133:	6a 00                	push   $0x0
+  801135:	e8 6b f8 ff ff       	call   8009a5 <iscons>
+  80113a:	89 c7                	mov    %eax,%edi
+  80113c:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+  80113f:	be 00 00 00 00       	mov    $0x0,%esi
+  801144:	eb 4b                	jmp    801191 <readline+0x84>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+  801146:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+  80114b:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  80114e:	75 08                	jne    801158 <readline+0x4b>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+  801150:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801153:	5b                   	pop    %ebx
+  801154:	5e                   	pop    %esi
+  801155:	5f                   	pop    %edi
+  801156:	5d                   	pop    %ebp
+  801157:	c3                   	ret
+				cprintf("read error: %e\n", c);
+  801158:	83 ec 08             	sub    $0x8,%esp
+  80115b:	53                   	push   %ebx
+  80115c:	68 ab 6a 80 00       	push   $0x806aab
+  801161:	e8 fb f9 ff ff       	call   800b61 <cprintf>
+  801166:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  801169:	b8 00 00 00 00       	mov    $0x0,%eax
+  80116e:	eb e0                	jmp    801150 <readline+0x43>
+			if (echoing)
+  801170:	85 ff                	test   %edi,%edi
+  801172:	75 05                	jne    801179 <readline+0x6c>
+			i--;
+  801174:	83 ee 01             	sub    $0x1,%esi
+  801177:	eb 18                	jmp    801191 <readline+0x84>
+				cputchar('\b');
+  801179:	83 ec 0c             	sub    $0xc,%esp
+  80117c:	6a 08                	push   $0x8
+  80117e:	e8 dd f7 ff ff       	call   800960 <cputchar>
+  801183:	83 c4 10             	add    $0x10,%esp
+  801186:	eb ec                	jmp    801174 <readline+0x67>
+			buf[i++] = c;
+  801188:	88 9e 20 90 80 00    	mov    %bl,0x809020(%esi)
+  80118e:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+  801191:	e8 e6 f7 ff ff       	call   80097c <getchar>
+  801196:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+  801198:	85 c0                	test   %eax,%eax
+  80119a:	78 aa                	js     801146 <readline+0x39>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  80119c:	83 f8 08             	cmp    $0x8,%eax
+  80119f:	0f 94 c0             	sete   %al
+  8011a2:	83 fb 7f             	cmp    $0x7f,%ebx
+  8011a5:	0f 94 c2             	sete   %dl
+  8011a8:	08 d0                	or     %dl,%al
+  8011aa:	74 04                	je     8011b0 <readline+0xa3>
+  8011ac:	85 f6                	test   %esi,%esi
+  8011ae:	7f c0                	jg     801170 <readline+0x63>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  8011b0:	83 fb 1f             	cmp    $0x1f,%ebx
+  8011b3:	7e 1a                	jle    8011cf <readline+0xc2>
+  8011b5:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  8011bb:	7f 12                	jg     8011cf <readline+0xc2>
+			if (echoing)
+  8011bd:	85 ff                	test   %edi,%edi
+  8011bf:	74 c7                	je     801188 <readline+0x7b>
+				cputchar(c);
+  8011c1:	83 ec 0c             	sub    $0xc,%esp
+  8011c4:	53                   	push   %ebx
+  8011c5:	e8 96 f7 ff ff       	call   800960 <cputchar>
+  8011ca:	83 c4 10             	add    $0x10,%esp
+  8011cd:	eb b9                	jmp    801188 <readline+0x7b>
+		} else if (c == '\n' || c == '\r') {
+  8011cf:	83 fb 0a             	cmp    $0xa,%ebx
+  8011d2:	74 05                	je     8011d9 <readline+0xcc>
+  8011d4:	83 fb 0d             	cmp    $0xd,%ebx
+  8011d7:	75 b8                	jne    801191 <readline+0x84>
+			if (echoing)
+  8011d9:	85 ff                	test   %edi,%edi
+  8011db:	75 11                	jne    8011ee <readline+0xe1>
+			buf[i] = 0;
+  8011dd:	c6 86 20 90 80 00 00 	movb   $0x0,0x809020(%esi)
+			return buf;
+  8011e4:	b8 20 90 80 00       	mov    $0x809020,%eax
+  8011e9:	e9 62 ff ff ff       	jmp    801150 <readline+0x43>
+				cputchar('\n');
+  8011ee:	83 ec 0c             	sub    $0xc,%esp
+  8011f1:	6a 0a                	push   $0xa
+  8011f3:	e8 68 f7 ff ff       	call   800960 <cputchar>
+  8011f8:	83 c4 10             	add    $0x10,%esp
+  8011fb:	eb e0                	jmp    8011dd <readline+0xd0>
+
+008011fd <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8011fd:	55                   	push   %ebp
+  8011fe:	89 e5                	mov    %esp,%ebp
+  801200:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801203:	b8 00 00 00 00       	mov    $0x0,%eax
+  801208:	eb 03                	jmp    80120d <strlen+0x10>
+		n++;
+  80120a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80120d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801211:	75 f7                	jne    80120a <strlen+0xd>
+	return n;
+}
+  801213:	5d                   	pop    %ebp
+  801214:	c3                   	ret
+
+00801215 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801215:	55                   	push   %ebp
+  801216:	89 e5                	mov    %esp,%ebp
+  801218:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80121b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80121e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801223:	eb 03                	jmp    801228 <strnlen+0x13>
+		n++;
+  801225:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801228:	39 d0                	cmp    %edx,%eax
+  80122a:	74 08                	je     801234 <strnlen+0x1f>
+  80122c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801230:	75 f3                	jne    801225 <strnlen+0x10>
+  801232:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801234:	89 d0                	mov    %edx,%eax
+  801236:	5d                   	pop    %ebp
+  801237:	c3                   	ret
+
+00801238 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801238:	55                   	push   %ebp
+  801239:	89 e5                	mov    %esp,%ebp
+  80123b:	53                   	push   %ebx
+  80123c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80123f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801242:	b8 00 00 00 00       	mov    $0x0,%eax
+  801247:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80124b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80124e:	83 c0 01             	add    $0x1,%eax
+  801251:	84 d2                	test   %dl,%dl
+  801253:	75 f2                	jne    801247 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801255:	89 c8                	mov    %ecx,%eax
+  801257:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80125a:	c9                   	leave
+  80125b:	c3                   	ret
+
+0080125c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80125c:	55                   	push   %ebp
+  80125d:	89 e5                	mov    %esp,%ebp
+  80125f:	53                   	push   %ebx
+  801260:	83 ec 10             	sub    $0x10,%esp
+  801263:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801266:	53                   	push   %ebx
+  801267:	e8 91 ff ff ff       	call   8011fd <strlen>
+  80126c:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80126f:	ff 75 0c             	push   0xc(%ebp)
+  801272:	01 d8                	add    %ebx,%eax
+  801274:	50                   	push   %eax
+  801275:	e8 be ff ff ff       	call   801238 <strcpy>
+	return dst;
+}
+  80127a:	89 d8                	mov    %ebx,%eax
+  80127c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80127f:	c9                   	leave
+  801280:	c3                   	ret
+
+00801281 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801281:	55                   	push   %ebp
+  801282:	89 e5                	mov    %esp,%ebp
+  801284:	56                   	push   %esi
+  801285:	53                   	push   %ebx
+  801286:	8b 75 08             	mov    0x8(%ebp),%esi
+  801289:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80128c:	89 f3                	mov    %esi,%ebx
+  80128e:	03 5d 10             	add    0x10(%ebp),%ebx
+  801291:	89 f0                	mov    %esi,%eax
+  801293:	eb 0f                	jmp    8012a4 <strncpy+0x23>
+		*dst++ = *src;
+  801295:	83 c0 01             	add    $0x1,%eax
+  801298:	0f b6 0a             	movzbl (%edx),%ecx
+  80129b:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80129e:	80 f9 01             	cmp    $0x1,%cl
+  8012a1:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8012a4:	39 d8                	cmp    %ebx,%eax
+  8012a6:	75 ed                	jne    801295 <strncpy+0x14>
+	}
+	return ret;
+}
+  8012a8:	89 f0                	mov    %esi,%eax
+  8012aa:	5b                   	pop    %ebx
+  8012ab:	5e                   	pop    %esi
+  8012ac:	5d                   	pop    %ebp
+  8012ad:	c3                   	ret
+
+008012ae <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8012ae:	55                   	push   %ebp
+  8012af:	89 e5                	mov    %esp,%ebp
+  8012b1:	56                   	push   %esi
+  8012b2:	53                   	push   %ebx
+  8012b3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b9:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8012bc:	89 f0                	mov    %esi,%eax
+  8012be:	85 d2                	test   %edx,%edx
+  8012c0:	74 21                	je     8012e3 <strlcpy+0x35>
+  8012c2:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8012c6:	89 f2                	mov    %esi,%edx
+  8012c8:	eb 09                	jmp    8012d3 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8012ca:	83 c1 01             	add    $0x1,%ecx
+  8012cd:	83 c2 01             	add    $0x1,%edx
+  8012d0:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8012d3:	39 c2                	cmp    %eax,%edx
+  8012d5:	74 09                	je     8012e0 <strlcpy+0x32>
+  8012d7:	0f b6 19             	movzbl (%ecx),%ebx
+  8012da:	84 db                	test   %bl,%bl
+  8012dc:	75 ec                	jne    8012ca <strlcpy+0x1c>
+  8012de:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8012e0:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8012e3:	29 f0                	sub    %esi,%eax
+}
+  8012e5:	5b                   	pop    %ebx
+  8012e6:	5e                   	pop    %esi
+  8012e7:	5d                   	pop    %ebp
+  8012e8:	c3                   	ret
+
+008012e9 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8012e9:	55                   	push   %ebp
+  8012ea:	89 e5                	mov    %esp,%ebp
+  8012ec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8012f2:	eb 06                	jmp    8012fa <strcmp+0x11>
+		p++, q++;
+  8012f4:	83 c1 01             	add    $0x1,%ecx
+  8012f7:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8012fa:	0f b6 01             	movzbl (%ecx),%eax
+  8012fd:	84 c0                	test   %al,%al
+  8012ff:	74 04                	je     801305 <strcmp+0x1c>
+  801301:	3a 02                	cmp    (%edx),%al
+  801303:	74 ef                	je     8012f4 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801305:	0f b6 c0             	movzbl %al,%eax
+  801308:	0f b6 12             	movzbl (%edx),%edx
+  80130b:	29 d0                	sub    %edx,%eax
+}
+  80130d:	5d                   	pop    %ebp
+  80130e:	c3                   	ret
+
+0080130f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80130f:	55                   	push   %ebp
+  801310:	89 e5                	mov    %esp,%ebp
+  801312:	53                   	push   %ebx
+  801313:	8b 45 08             	mov    0x8(%ebp),%eax
+  801316:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801319:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80131c:	eb 09                	jmp    801327 <strncmp+0x18>
+		n--, p++, q++;
+  80131e:	83 ea 01             	sub    $0x1,%edx
+  801321:	83 c0 01             	add    $0x1,%eax
+  801324:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801327:	85 d2                	test   %edx,%edx
+  801329:	74 18                	je     801343 <strncmp+0x34>
+  80132b:	0f b6 18             	movzbl (%eax),%ebx
+  80132e:	84 db                	test   %bl,%bl
+  801330:	74 04                	je     801336 <strncmp+0x27>
+  801332:	3a 19                	cmp    (%ecx),%bl
+  801334:	74 e8                	je     80131e <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801336:	0f b6 00             	movzbl (%eax),%eax
+  801339:	0f b6 11             	movzbl (%ecx),%edx
+  80133c:	29 d0                	sub    %edx,%eax
+}
+  80133e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801341:	c9                   	leave
+  801342:	c3                   	ret
+		return 0;
+  801343:	b8 00 00 00 00       	mov    $0x0,%eax
+  801348:	eb f4                	jmp    80133e <strncmp+0x2f>
+
+0080134a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80134a:	55                   	push   %ebp
+  80134b:	89 e5                	mov    %esp,%ebp
+  80134d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801350:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801354:	eb 03                	jmp    801359 <strchr+0xf>
+  801356:	83 c0 01             	add    $0x1,%eax
+  801359:	0f b6 10             	movzbl (%eax),%edx
+  80135c:	84 d2                	test   %dl,%dl
+  80135e:	74 06                	je     801366 <strchr+0x1c>
+		if (*s == c)
+  801360:	38 ca                	cmp    %cl,%dl
+  801362:	75 f2                	jne    801356 <strchr+0xc>
+  801364:	eb 05                	jmp    80136b <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801366:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80136b:	5d                   	pop    %ebp
+  80136c:	c3                   	ret
+
+0080136d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80136d:	55                   	push   %ebp
+  80136e:	89 e5                	mov    %esp,%ebp
+  801370:	8b 45 08             	mov    0x8(%ebp),%eax
+  801373:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801377:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80137a:	38 ca                	cmp    %cl,%dl
+  80137c:	74 09                	je     801387 <strfind+0x1a>
+  80137e:	84 d2                	test   %dl,%dl
+  801380:	74 05                	je     801387 <strfind+0x1a>
+	for (; *s; s++)
+  801382:	83 c0 01             	add    $0x1,%eax
+  801385:	eb f0                	jmp    801377 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801387:	5d                   	pop    %ebp
+  801388:	c3                   	ret
+
+00801389 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801389:	55                   	push   %ebp
+  80138a:	89 e5                	mov    %esp,%ebp
+  80138c:	57                   	push   %edi
+  80138d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801390:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801393:	85 c9                	test   %ecx,%ecx
+  801395:	74 20                	je     8013b7 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801397:	89 f8                	mov    %edi,%eax
+  801399:	09 c8                	or     %ecx,%eax
+  80139b:	a8 03                	test   $0x3,%al
+  80139d:	75 12                	jne    8013b1 <memset+0x28>
+		c &= 0xFF;
+  80139f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8013a3:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8013a9:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8013ac:	fc                   	cld
+  8013ad:	f3 ab                	rep stos %eax,%es:(%edi)
+  8013af:	eb 06                	jmp    8013b7 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8013b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013b4:	fc                   	cld
+  8013b5:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8013b7:	89 f8                	mov    %edi,%eax
+  8013b9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8013bc:	c9                   	leave
+  8013bd:	c3                   	ret
+
+008013be <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8013be:	55                   	push   %ebp
+  8013bf:	89 e5                	mov    %esp,%ebp
+  8013c1:	57                   	push   %edi
+  8013c2:	56                   	push   %esi
+  8013c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013c6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013c9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8013cc:	39 c6                	cmp    %eax,%esi
+  8013ce:	73 32                	jae    801402 <memmove+0x44>
+  8013d0:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8013d3:	39 d0                	cmp    %edx,%eax
+  8013d5:	73 2b                	jae    801402 <memmove+0x44>
+		s += n;
+		d += n;
+  8013d7:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8013da:	89 d6                	mov    %edx,%esi
+  8013dc:	09 fe                	or     %edi,%esi
+  8013de:	09 ce                	or     %ecx,%esi
+  8013e0:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8013e6:	75 0e                	jne    8013f6 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8013e8:	83 ef 04             	sub    $0x4,%edi
+  8013eb:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8013ee:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8013f1:	fd                   	std
+  8013f2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8013f4:	eb 09                	jmp    8013ff <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8013f6:	83 ef 01             	sub    $0x1,%edi
+  8013f9:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8013fc:	fd                   	std
+  8013fd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8013ff:	fc                   	cld
+  801400:	eb 1a                	jmp    80141c <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801402:	89 f2                	mov    %esi,%edx
+  801404:	09 c2                	or     %eax,%edx
+  801406:	09 ca                	or     %ecx,%edx
+  801408:	f6 c2 03             	test   $0x3,%dl
+  80140b:	75 0a                	jne    801417 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80140d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801410:	89 c7                	mov    %eax,%edi
+  801412:	fc                   	cld
+  801413:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801415:	eb 05                	jmp    80141c <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801417:	89 c7                	mov    %eax,%edi
+  801419:	fc                   	cld
+  80141a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80141c:	5e                   	pop    %esi
+  80141d:	5f                   	pop    %edi
+  80141e:	5d                   	pop    %ebp
+  80141f:	c3                   	ret
+
+00801420 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801420:	55                   	push   %ebp
+  801421:	89 e5                	mov    %esp,%ebp
+  801423:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801426:	ff 75 10             	push   0x10(%ebp)
+  801429:	ff 75 0c             	push   0xc(%ebp)
+  80142c:	ff 75 08             	push   0x8(%ebp)
+  80142f:	e8 8a ff ff ff       	call   8013be <memmove>
+}
+  801434:	c9                   	leave
+  801435:	c3                   	ret
+
+00801436 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801436:	55                   	push   %ebp
+  801437:	89 e5                	mov    %esp,%ebp
+  801439:	56                   	push   %esi
+  80143a:	53                   	push   %ebx
+  80143b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80143e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801441:	89 c6                	mov    %eax,%esi
+  801443:	03 75 10             	add    0x10(%ebp),%esi
+  801446:	eb 06                	jmp    80144e <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801448:	83 c0 01             	add    $0x1,%eax
+  80144b:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80144e:	39 f0                	cmp    %esi,%eax
+  801450:	74 14                	je     801466 <memcmp+0x30>
+		if (*s1 != *s2)
+  801452:	0f b6 08             	movzbl (%eax),%ecx
+  801455:	0f b6 1a             	movzbl (%edx),%ebx
+  801458:	38 d9                	cmp    %bl,%cl
+  80145a:	74 ec                	je     801448 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80145c:	0f b6 c1             	movzbl %cl,%eax
+  80145f:	0f b6 db             	movzbl %bl,%ebx
+  801462:	29 d8                	sub    %ebx,%eax
+  801464:	eb 05                	jmp    80146b <memcmp+0x35>
+	}
+
+	return 0;
+  801466:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80146b:	5b                   	pop    %ebx
+  80146c:	5e                   	pop    %esi
+  80146d:	5d                   	pop    %ebp
+  80146e:	c3                   	ret
+
+0080146f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80146f:	55                   	push   %ebp
+  801470:	89 e5                	mov    %esp,%ebp
+  801472:	8b 45 08             	mov    0x8(%ebp),%eax
+  801475:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801478:	89 c2                	mov    %eax,%edx
+  80147a:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80147d:	eb 03                	jmp    801482 <memfind+0x13>
+  80147f:	83 c0 01             	add    $0x1,%eax
+  801482:	39 d0                	cmp    %edx,%eax
+  801484:	73 04                	jae    80148a <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801486:	38 08                	cmp    %cl,(%eax)
+  801488:	75 f5                	jne    80147f <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80148a:	5d                   	pop    %ebp
+  80148b:	c3                   	ret
+
+0080148c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80148c:	55                   	push   %ebp
+  80148d:	89 e5                	mov    %esp,%ebp
+  80148f:	57                   	push   %edi
+  801490:	56                   	push   %esi
+  801491:	53                   	push   %ebx
+  801492:	8b 55 08             	mov    0x8(%ebp),%edx
+  801495:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801498:	eb 03                	jmp    80149d <strtol+0x11>
+		s++;
+  80149a:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80149d:	0f b6 02             	movzbl (%edx),%eax
+  8014a0:	3c 20                	cmp    $0x20,%al
+  8014a2:	74 f6                	je     80149a <strtol+0xe>
+  8014a4:	3c 09                	cmp    $0x9,%al
+  8014a6:	74 f2                	je     80149a <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8014a8:	3c 2b                	cmp    $0x2b,%al
+  8014aa:	74 2a                	je     8014d6 <strtol+0x4a>
+	int neg = 0;
+  8014ac:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8014b1:	3c 2d                	cmp    $0x2d,%al
+  8014b3:	74 2b                	je     8014e0 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8014b5:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8014bb:	75 0f                	jne    8014cc <strtol+0x40>
+  8014bd:	80 3a 30             	cmpb   $0x30,(%edx)
+  8014c0:	74 28                	je     8014ea <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8014c2:	85 db                	test   %ebx,%ebx
+  8014c4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8014c9:	0f 44 d8             	cmove  %eax,%ebx
+  8014cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014d1:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8014d4:	eb 46                	jmp    80151c <strtol+0x90>
+		s++;
+  8014d6:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8014d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014de:	eb d5                	jmp    8014b5 <strtol+0x29>
+		s++, neg = 1;
+  8014e0:	83 c2 01             	add    $0x1,%edx
+  8014e3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8014e8:	eb cb                	jmp    8014b5 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8014ea:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8014ee:	74 0e                	je     8014fe <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8014f0:	85 db                	test   %ebx,%ebx
+  8014f2:	75 d8                	jne    8014cc <strtol+0x40>
+		s++, base = 8;
+  8014f4:	83 c2 01             	add    $0x1,%edx
+  8014f7:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8014fc:	eb ce                	jmp    8014cc <strtol+0x40>
+		s += 2, base = 16;
+  8014fe:	83 c2 02             	add    $0x2,%edx
+  801501:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801506:	eb c4                	jmp    8014cc <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801508:	0f be c0             	movsbl %al,%eax
+  80150b:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  80150e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801511:	7d 3a                	jge    80154d <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801513:	83 c2 01             	add    $0x1,%edx
+  801516:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80151a:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  80151c:	0f b6 02             	movzbl (%edx),%eax
+  80151f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801522:	89 f3                	mov    %esi,%ebx
+  801524:	80 fb 09             	cmp    $0x9,%bl
+  801527:	76 df                	jbe    801508 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801529:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80152c:	89 f3                	mov    %esi,%ebx
+  80152e:	80 fb 19             	cmp    $0x19,%bl
+  801531:	77 08                	ja     80153b <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801533:	0f be c0             	movsbl %al,%eax
+  801536:	83 e8 57             	sub    $0x57,%eax
+  801539:	eb d3                	jmp    80150e <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  80153b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80153e:	89 f3                	mov    %esi,%ebx
+  801540:	80 fb 19             	cmp    $0x19,%bl
+  801543:	77 08                	ja     80154d <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801545:	0f be c0             	movsbl %al,%eax
+  801548:	83 e8 37             	sub    $0x37,%eax
+  80154b:	eb c1                	jmp    80150e <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80154d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801551:	74 05                	je     801558 <strtol+0xcc>
+		*endptr = (char *) s;
+  801553:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801556:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801558:	89 c8                	mov    %ecx,%eax
+  80155a:	f7 d8                	neg    %eax
+  80155c:	85 ff                	test   %edi,%edi
+  80155e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801561:	89 c8                	mov    %ecx,%eax
+  801563:	5b                   	pop    %ebx
+  801564:	5e                   	pop    %esi
+  801565:	5f                   	pop    %edi
+  801566:	5d                   	pop    %ebp
+  801567:	c3                   	ret
+
+00801568 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  801568:	55                   	push   %ebp
+  801569:	89 e5                	mov    %esp,%ebp
+  80156b:	57                   	push   %edi
+  80156c:	56                   	push   %esi
+  80156d:	53                   	push   %ebx
+  80156e:	83 ec 0c             	sub    $0xc,%esp
+  801571:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801574:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801577:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  80157a:	85 ff                	test   %edi,%edi
+  80157c:	74 16                	je     801594 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  80157e:	83 ec 04             	sub    $0x4,%esp
+  801581:	56                   	push   %esi
+  801582:	6a 00                	push   $0x0
+  801584:	53                   	push   %ebx
+  801585:	e8 02 ff ff ff       	call   80148c <strtol>
+  80158a:	89 07                	mov    %eax,(%edi)
+  80158c:	83 c4 10             	add    $0x10,%esp
+  80158f:	eb 03                	jmp    801594 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  801591:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  801594:	0f b6 03             	movzbl (%ebx),%eax
+  801597:	3c 20                	cmp    $0x20,%al
+  801599:	74 f6                	je     801591 <strisl+0x29>
+  80159b:	3c 09                	cmp    $0x9,%al
+  80159d:	74 f2                	je     801591 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  80159f:	3c 2b                	cmp    $0x2b,%al
+  8015a1:	74 23                	je     8015c6 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  8015a3:	3c 2d                	cmp    $0x2d,%al
+  8015a5:	0f 94 c0             	sete   %al
+  8015a8:	0f b6 c0             	movzbl %al,%eax
+  8015ab:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8015ad:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  8015b3:	75 41                	jne    8015f6 <strisl+0x8e>
+  8015b5:	80 3b 30             	cmpb   $0x30,(%ebx)
+  8015b8:	74 11                	je     8015cb <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8015ba:	85 f6                	test   %esi,%esi
+  8015bc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8015c1:	0f 44 f0             	cmove  %eax,%esi
+  8015c4:	eb 30                	jmp    8015f6 <strisl+0x8e>
+		s++;
+  8015c6:	83 c3 01             	add    $0x1,%ebx
+  8015c9:	eb e2                	jmp    8015ad <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8015cb:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  8015cf:	74 0e                	je     8015df <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  8015d1:	85 f6                	test   %esi,%esi
+  8015d3:	75 21                	jne    8015f6 <strisl+0x8e>
+		s++, base = 8;
+  8015d5:	83 c3 01             	add    $0x1,%ebx
+  8015d8:	be 08 00 00 00       	mov    $0x8,%esi
+  8015dd:	eb 17                	jmp    8015f6 <strisl+0x8e>
+		s += 2, base = 16;
+  8015df:	83 c3 02             	add    $0x2,%ebx
+  8015e2:	be 10 00 00 00       	mov    $0x10,%esi
+  8015e7:	eb 0d                	jmp    8015f6 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8015e9:	0f be c0             	movsbl %al,%eax
+  8015ec:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  8015ef:	39 f0                	cmp    %esi,%eax
+  8015f1:	7d 38                	jge    80162b <strisl+0xc3>
+			return 0;
+		s++;
+  8015f3:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  8015f6:	0f b6 03             	movzbl (%ebx),%eax
+  8015f9:	8d 50 d0             	lea    -0x30(%eax),%edx
+  8015fc:	80 fa 09             	cmp    $0x9,%dl
+  8015ff:	76 e8                	jbe    8015e9 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  801601:	8d 50 9f             	lea    -0x61(%eax),%edx
+  801604:	80 fa 19             	cmp    $0x19,%dl
+  801607:	77 08                	ja     801611 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  801609:	0f be c0             	movsbl %al,%eax
+  80160c:	83 e8 57             	sub    $0x57,%eax
+  80160f:	eb de                	jmp    8015ef <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  801611:	8d 50 bf             	lea    -0x41(%eax),%edx
+  801614:	80 fa 19             	cmp    $0x19,%dl
+  801617:	77 08                	ja     801621 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  801619:	0f be c0             	movsbl %al,%eax
+  80161c:	83 e8 37             	sub    $0x37,%eax
+  80161f:	eb ce                	jmp    8015ef <strisl+0x87>
+		else if (!*s)
+  801621:	84 c0                	test   %al,%al
+  801623:	0f 94 c0             	sete   %al
+  801626:	0f b6 c0             	movzbl %al,%eax
+  801629:	eb 05                	jmp    801630 <strisl+0xc8>
+			return 0;
+  80162b:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  801630:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801633:	5b                   	pop    %ebx
+  801634:	5e                   	pop    %esi
+  801635:	5f                   	pop    %edi
+  801636:	5d                   	pop    %ebp
+  801637:	c3                   	ret
+
+00801638 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  801638:	55                   	push   %ebp
+  801639:	89 e5                	mov    %esp,%ebp
+  80163b:	83 ec 10             	sub    $0x10,%esp
+  80163e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  801641:	89 c8                	mov    %ecx,%eax
+  801643:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801648:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80164b:	eb 0b                	jmp    801658 <touch_mem+0x20>
+		c = *(char *)page;
+  80164d:	0f b6 10             	movzbl (%eax),%edx
+  801650:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  801653:	05 00 10 00 00       	add    $0x1000,%eax
+  801658:	39 c8                	cmp    %ecx,%eax
+  80165a:	72 f1                	jb     80164d <touch_mem+0x15>
+}
+  80165c:	c9                   	leave
+  80165d:	c3                   	ret
+
+0080165e <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80165e:	55                   	push   %ebp
+  80165f:	89 e5                	mov    %esp,%ebp
+  801661:	57                   	push   %edi
+  801662:	56                   	push   %esi
+  801663:	53                   	push   %ebx
+	touch_mem(s, len);
+  801664:	ff 75 0c             	push   0xc(%ebp)
+  801667:	ff 75 08             	push   0x8(%ebp)
+  80166a:	e8 c9 ff ff ff       	call   801638 <touch_mem>
+	asm volatile("int %1\n"
+  80166f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801674:	8b 55 08             	mov    0x8(%ebp),%edx
+  801677:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80167a:	89 c3                	mov    %eax,%ebx
+  80167c:	89 c7                	mov    %eax,%edi
+  80167e:	89 c6                	mov    %eax,%esi
+  801680:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801682:	83 c4 08             	add    $0x8,%esp
+  801685:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801688:	5b                   	pop    %ebx
+  801689:	5e                   	pop    %esi
+  80168a:	5f                   	pop    %edi
+  80168b:	5d                   	pop    %ebp
+  80168c:	c3                   	ret
+
+0080168d <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80168d:	55                   	push   %ebp
+  80168e:	89 e5                	mov    %esp,%ebp
+  801690:	57                   	push   %edi
+  801691:	56                   	push   %esi
+  801692:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801693:	ba 00 00 00 00       	mov    $0x0,%edx
+  801698:	b8 01 00 00 00       	mov    $0x1,%eax
+  80169d:	89 d1                	mov    %edx,%ecx
+  80169f:	89 d3                	mov    %edx,%ebx
+  8016a1:	89 d7                	mov    %edx,%edi
+  8016a3:	89 d6                	mov    %edx,%esi
+  8016a5:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8016a7:	5b                   	pop    %ebx
+  8016a8:	5e                   	pop    %esi
+  8016a9:	5f                   	pop    %edi
+  8016aa:	5d                   	pop    %ebp
+  8016ab:	c3                   	ret
+
+008016ac <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8016ac:	55                   	push   %ebp
+  8016ad:	89 e5                	mov    %esp,%ebp
+  8016af:	57                   	push   %edi
+  8016b0:	56                   	push   %esi
+  8016b1:	53                   	push   %ebx
+  8016b2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8016b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016bd:	b8 03 00 00 00       	mov    $0x3,%eax
+  8016c2:	89 cb                	mov    %ecx,%ebx
+  8016c4:	89 cf                	mov    %ecx,%edi
+  8016c6:	89 ce                	mov    %ecx,%esi
+  8016c8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016ca:	85 c0                	test   %eax,%eax
+  8016cc:	7f 08                	jg     8016d6 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8016ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d1:	5b                   	pop    %ebx
+  8016d2:	5e                   	pop    %esi
+  8016d3:	5f                   	pop    %edi
+  8016d4:	5d                   	pop    %ebp
+  8016d5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016d6:	83 ec 0c             	sub    $0xc,%esp
+  8016d9:	50                   	push   %eax
+  8016da:	6a 03                	push   $0x3
+  8016dc:	68 bb 6a 80 00       	push   $0x806abb
+  8016e1:	6a 23                	push   $0x23
+  8016e3:	68 d8 6a 80 00       	push   $0x806ad8
+  8016e8:	e8 99 f3 ff ff       	call   800a86 <_panic>
+
+008016ed <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8016ed:	55                   	push   %ebp
+  8016ee:	89 e5                	mov    %esp,%ebp
+  8016f0:	57                   	push   %edi
+  8016f1:	56                   	push   %esi
+  8016f2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8016f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016f8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8016fd:	89 d1                	mov    %edx,%ecx
+  8016ff:	89 d3                	mov    %edx,%ebx
+  801701:	89 d7                	mov    %edx,%edi
+  801703:	89 d6                	mov    %edx,%esi
+  801705:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801707:	5b                   	pop    %ebx
+  801708:	5e                   	pop    %esi
+  801709:	5f                   	pop    %edi
+  80170a:	5d                   	pop    %ebp
+  80170b:	c3                   	ret
+
+0080170c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80170c:	55                   	push   %ebp
+  80170d:	89 e5                	mov    %esp,%ebp
+  80170f:	57                   	push   %edi
+  801710:	56                   	push   %esi
+  801711:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801712:	ba 00 00 00 00       	mov    $0x0,%edx
+  801717:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80171c:	89 d1                	mov    %edx,%ecx
+  80171e:	89 d3                	mov    %edx,%ebx
+  801720:	89 d7                	mov    %edx,%edi
+  801722:	89 d6                	mov    %edx,%esi
+  801724:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801726:	5b                   	pop    %ebx
+  801727:	5e                   	pop    %esi
+  801728:	5f                   	pop    %edi
+  801729:	5d                   	pop    %ebp
+  80172a:	c3                   	ret
+
+0080172b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80172b:	55                   	push   %ebp
+  80172c:	89 e5                	mov    %esp,%ebp
+  80172e:	57                   	push   %edi
+  80172f:	56                   	push   %esi
+  801730:	53                   	push   %ebx
+  801731:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801734:	be 00 00 00 00       	mov    $0x0,%esi
+  801739:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80173f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801744:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801747:	89 f7                	mov    %esi,%edi
+  801749:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80174b:	85 c0                	test   %eax,%eax
+  80174d:	7f 08                	jg     801757 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80174f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801752:	5b                   	pop    %ebx
+  801753:	5e                   	pop    %esi
+  801754:	5f                   	pop    %edi
+  801755:	5d                   	pop    %ebp
+  801756:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801757:	83 ec 0c             	sub    $0xc,%esp
+  80175a:	50                   	push   %eax
+  80175b:	6a 04                	push   $0x4
+  80175d:	68 bb 6a 80 00       	push   $0x806abb
+  801762:	6a 23                	push   $0x23
+  801764:	68 d8 6a 80 00       	push   $0x806ad8
+  801769:	e8 18 f3 ff ff       	call   800a86 <_panic>
+
+0080176e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80176e:	55                   	push   %ebp
+  80176f:	89 e5                	mov    %esp,%ebp
+  801771:	57                   	push   %edi
+  801772:	56                   	push   %esi
+  801773:	53                   	push   %ebx
+  801774:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801777:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801782:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801785:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801788:	8b 75 18             	mov    0x18(%ebp),%esi
+  80178b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80178d:	85 c0                	test   %eax,%eax
+  80178f:	7f 08                	jg     801799 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801791:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801794:	5b                   	pop    %ebx
+  801795:	5e                   	pop    %esi
+  801796:	5f                   	pop    %edi
+  801797:	5d                   	pop    %ebp
+  801798:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801799:	83 ec 0c             	sub    $0xc,%esp
+  80179c:	50                   	push   %eax
+  80179d:	6a 05                	push   $0x5
+  80179f:	68 bb 6a 80 00       	push   $0x806abb
+  8017a4:	6a 23                	push   $0x23
+  8017a6:	68 d8 6a 80 00       	push   $0x806ad8
+  8017ab:	e8 d6 f2 ff ff       	call   800a86 <_panic>
+
+008017b0 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8017b0:	55                   	push   %ebp
+  8017b1:	89 e5                	mov    %esp,%ebp
+  8017b3:	57                   	push   %edi
+  8017b4:	56                   	push   %esi
+  8017b5:	53                   	push   %ebx
+  8017b6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8017b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8017c9:	89 df                	mov    %ebx,%edi
+  8017cb:	89 de                	mov    %ebx,%esi
+  8017cd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017cf:	85 c0                	test   %eax,%eax
+  8017d1:	7f 08                	jg     8017db <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8017d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017d6:	5b                   	pop    %ebx
+  8017d7:	5e                   	pop    %esi
+  8017d8:	5f                   	pop    %edi
+  8017d9:	5d                   	pop    %ebp
+  8017da:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017db:	83 ec 0c             	sub    $0xc,%esp
+  8017de:	50                   	push   %eax
+  8017df:	6a 06                	push   $0x6
+  8017e1:	68 bb 6a 80 00       	push   $0x806abb
+  8017e6:	6a 23                	push   $0x23
+  8017e8:	68 d8 6a 80 00       	push   $0x806ad8
+  8017ed:	e8 94 f2 ff ff       	call   800a86 <_panic>
+
+008017f2 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  8017f2:	55                   	push   %ebp
+  8017f3:	89 e5                	mov    %esp,%ebp
+  8017f5:	57                   	push   %edi
+  8017f6:	56                   	push   %esi
+  8017f7:	53                   	push   %ebx
+  8017f8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8017fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801800:	8b 55 08             	mov    0x8(%ebp),%edx
+  801803:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801806:	b8 18 00 00 00       	mov    $0x18,%eax
+  80180b:	89 df                	mov    %ebx,%edi
+  80180d:	89 de                	mov    %ebx,%esi
+  80180f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801811:	85 c0                	test   %eax,%eax
+  801813:	7f 08                	jg     80181d <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801815:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801818:	5b                   	pop    %ebx
+  801819:	5e                   	pop    %esi
+  80181a:	5f                   	pop    %edi
+  80181b:	5d                   	pop    %ebp
+  80181c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80181d:	83 ec 0c             	sub    $0xc,%esp
+  801820:	50                   	push   %eax
+  801821:	6a 18                	push   $0x18
+  801823:	68 bb 6a 80 00       	push   $0x806abb
+  801828:	6a 23                	push   $0x23
+  80182a:	68 d8 6a 80 00       	push   $0x806ad8
+  80182f:	e8 52 f2 ff ff       	call   800a86 <_panic>
+
+00801834 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  801834:	55                   	push   %ebp
+  801835:	89 e5                	mov    %esp,%ebp
+  801837:	57                   	push   %edi
+  801838:	56                   	push   %esi
+  801839:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80183a:	be 00 00 00 00       	mov    $0x0,%esi
+  80183f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801842:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801845:	b8 19 00 00 00       	mov    $0x19,%eax
+  80184a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80184d:	89 f7                	mov    %esi,%edi
+  80184f:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  801851:	5b                   	pop    %ebx
+  801852:	5e                   	pop    %esi
+  801853:	5f                   	pop    %edi
+  801854:	5d                   	pop    %ebp
+  801855:	c3                   	ret
+
+00801856 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  801856:	55                   	push   %ebp
+  801857:	89 e5                	mov    %esp,%ebp
+  801859:	57                   	push   %edi
+  80185a:	56                   	push   %esi
+  80185b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80185c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801862:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801867:	be 00 00 00 00       	mov    $0x0,%esi
+  80186c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80186f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801872:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  801874:	5b                   	pop    %ebx
+  801875:	5e                   	pop    %esi
+  801876:	5f                   	pop    %edi
+  801877:	5d                   	pop    %ebp
+  801878:	c3                   	ret
+
+00801879 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  801879:	55                   	push   %ebp
+  80187a:	89 e5                	mov    %esp,%ebp
+  80187c:	57                   	push   %edi
+  80187d:	56                   	push   %esi
+  80187e:	53                   	push   %ebx
+  80187f:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  801882:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  801885:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  80188b:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  80188e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801891:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801894:	b8 10 00 00 00       	mov    $0x10,%eax
+  801899:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80189c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80189f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8018a1:	85 c0                	test   %eax,%eax
+  8018a3:	7f 08                	jg     8018ad <sys_page_map_range+0x34>
+}
+  8018a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018a8:	5b                   	pop    %ebx
+  8018a9:	5e                   	pop    %esi
+  8018aa:	5f                   	pop    %edi
+  8018ab:	5d                   	pop    %ebp
+  8018ac:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018ad:	83 ec 0c             	sub    $0xc,%esp
+  8018b0:	50                   	push   %eax
+  8018b1:	6a 10                	push   $0x10
+  8018b3:	68 bb 6a 80 00       	push   $0x806abb
+  8018b8:	6a 23                	push   $0x23
+  8018ba:	68 d8 6a 80 00       	push   $0x806ad8
+  8018bf:	e8 c2 f1 ff ff       	call   800a86 <_panic>
+
+008018c4 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  8018c4:	55                   	push   %ebp
+  8018c5:	89 e5                	mov    %esp,%ebp
+  8018c7:	57                   	push   %edi
+  8018c8:	56                   	push   %esi
+  8018c9:	53                   	push   %ebx
+  8018ca:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8018cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8018d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018d8:	b8 11 00 00 00       	mov    $0x11,%eax
+  8018dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018e0:	89 f7                	mov    %esi,%edi
+  8018e2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8018e4:	85 c0                	test   %eax,%eax
+  8018e6:	7f 08                	jg     8018f0 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8018e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018eb:	5b                   	pop    %ebx
+  8018ec:	5e                   	pop    %esi
+  8018ed:	5f                   	pop    %edi
+  8018ee:	5d                   	pop    %ebp
+  8018ef:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018f0:	83 ec 0c             	sub    $0xc,%esp
+  8018f3:	50                   	push   %eax
+  8018f4:	6a 11                	push   $0x11
+  8018f6:	68 bb 6a 80 00       	push   $0x806abb
+  8018fb:	6a 23                	push   $0x23
+  8018fd:	68 d8 6a 80 00       	push   $0x806ad8
+  801902:	e8 7f f1 ff ff       	call   800a86 <_panic>
+
+00801907 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  801907:	55                   	push   %ebp
+  801908:	89 e5                	mov    %esp,%ebp
+  80190a:	57                   	push   %edi
+  80190b:	56                   	push   %esi
+  80190c:	53                   	push   %ebx
+  80190d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801910:	be 00 00 00 00       	mov    $0x0,%esi
+  801915:	8b 55 08             	mov    0x8(%ebp),%edx
+  801918:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80191b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801920:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801923:	89 f7                	mov    %esi,%edi
+  801925:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801927:	85 c0                	test   %eax,%eax
+  801929:	7f 08                	jg     801933 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  80192b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80192e:	5b                   	pop    %ebx
+  80192f:	5e                   	pop    %esi
+  801930:	5f                   	pop    %edi
+  801931:	5d                   	pop    %ebp
+  801932:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801933:	83 ec 0c             	sub    $0xc,%esp
+  801936:	50                   	push   %eax
+  801937:	6a 1b                	push   $0x1b
+  801939:	68 bb 6a 80 00       	push   $0x806abb
+  80193e:	6a 23                	push   $0x23
+  801940:	68 d8 6a 80 00       	push   $0x806ad8
+  801945:	e8 3c f1 ff ff       	call   800a86 <_panic>
+
+0080194a <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  80194a:	55                   	push   %ebp
+  80194b:	89 e5                	mov    %esp,%ebp
+  80194d:	57                   	push   %edi
+  80194e:	56                   	push   %esi
+  80194f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801950:	ba 00 00 00 00       	mov    $0x0,%edx
+  801955:	b8 12 00 00 00       	mov    $0x12,%eax
+  80195a:	89 d1                	mov    %edx,%ecx
+  80195c:	89 d3                	mov    %edx,%ebx
+  80195e:	89 d7                	mov    %edx,%edi
+  801960:	89 d6                	mov    %edx,%esi
+  801962:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801964:	5b                   	pop    %ebx
+  801965:	5e                   	pop    %esi
+  801966:	5f                   	pop    %edi
+  801967:	5d                   	pop    %ebp
+  801968:	c3                   	ret
+
+00801969 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801969:	55                   	push   %ebp
+  80196a:	89 e5                	mov    %esp,%ebp
+  80196c:	57                   	push   %edi
+  80196d:	56                   	push   %esi
+  80196e:	53                   	push   %ebx
+  80196f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801972:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801977:	8b 55 08             	mov    0x8(%ebp),%edx
+  80197a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80197d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801982:	89 df                	mov    %ebx,%edi
+  801984:	89 de                	mov    %ebx,%esi
+  801986:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801988:	85 c0                	test   %eax,%eax
+  80198a:	7f 08                	jg     801994 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80198c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80198f:	5b                   	pop    %ebx
+  801990:	5e                   	pop    %esi
+  801991:	5f                   	pop    %edi
+  801992:	5d                   	pop    %ebp
+  801993:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801994:	83 ec 0c             	sub    $0xc,%esp
+  801997:	50                   	push   %eax
+  801998:	6a 08                	push   $0x8
+  80199a:	68 bb 6a 80 00       	push   $0x806abb
+  80199f:	6a 23                	push   $0x23
+  8019a1:	68 d8 6a 80 00       	push   $0x806ad8
+  8019a6:	e8 db f0 ff ff       	call   800a86 <_panic>
+
+008019ab <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8019ab:	55                   	push   %ebp
+  8019ac:	89 e5                	mov    %esp,%ebp
+  8019ae:	57                   	push   %edi
+  8019af:	56                   	push   %esi
+  8019b0:	53                   	push   %ebx
+  8019b1:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  8019b4:	6a 44                	push   $0x44
+  8019b6:	ff 75 0c             	push   0xc(%ebp)
+  8019b9:	e8 7a fc ff ff       	call   801638 <touch_mem>
+	asm volatile("int %1\n"
+  8019be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019c6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8019cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019ce:	89 df                	mov    %ebx,%edi
+  8019d0:	89 de                	mov    %ebx,%esi
+  8019d2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8019d4:	83 c4 08             	add    $0x8,%esp
+  8019d7:	85 c0                	test   %eax,%eax
+  8019d9:	7f 08                	jg     8019e3 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8019db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019de:	5b                   	pop    %ebx
+  8019df:	5e                   	pop    %esi
+  8019e0:	5f                   	pop    %edi
+  8019e1:	5d                   	pop    %ebp
+  8019e2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019e3:	83 ec 0c             	sub    $0xc,%esp
+  8019e6:	50                   	push   %eax
+  8019e7:	6a 09                	push   $0x9
+  8019e9:	68 bb 6a 80 00       	push   $0x806abb
+  8019ee:	6a 23                	push   $0x23
+  8019f0:	68 d8 6a 80 00       	push   $0x806ad8
+  8019f5:	e8 8c f0 ff ff       	call   800a86 <_panic>
+
+008019fa <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  8019fa:	55                   	push   %ebp
+  8019fb:	89 e5                	mov    %esp,%ebp
+  8019fd:	57                   	push   %edi
+  8019fe:	56                   	push   %esi
+  8019ff:	53                   	push   %ebx
+  801a00:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801a03:	be 00 00 00 00       	mov    $0x0,%esi
+  801a08:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a0e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801a13:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a16:	89 f7                	mov    %esi,%edi
+  801a18:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801a1a:	85 c0                	test   %eax,%eax
+  801a1c:	7f 08                	jg     801a26 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  801a1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a21:	5b                   	pop    %ebx
+  801a22:	5e                   	pop    %esi
+  801a23:	5f                   	pop    %edi
+  801a24:	5d                   	pop    %ebp
+  801a25:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a26:	83 ec 0c             	sub    $0xc,%esp
+  801a29:	50                   	push   %eax
+  801a2a:	6a 1a                	push   $0x1a
+  801a2c:	68 bb 6a 80 00       	push   $0x806abb
+  801a31:	6a 23                	push   $0x23
+  801a33:	68 d8 6a 80 00       	push   $0x806ad8
+  801a38:	e8 49 f0 ff ff       	call   800a86 <_panic>
+
+00801a3d <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  801a3d:	55                   	push   %ebp
+  801a3e:	89 e5                	mov    %esp,%ebp
+  801a40:	57                   	push   %edi
+  801a41:	56                   	push   %esi
+  801a42:	53                   	push   %ebx
+  801a43:	83 ec 0c             	sub    $0xc,%esp
+  801a46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801a49:	89 d8                	mov    %ebx,%eax
+  801a4b:	c1 e0 05             	shl    $0x5,%eax
+  801a4e:	50                   	push   %eax
+  801a4f:	ff 75 0c             	push   0xc(%ebp)
+  801a52:	e8 e1 fb ff ff       	call   801638 <touch_mem>
+	asm volatile("int %1\n"
+  801a57:	be 00 00 00 00       	mov    $0x0,%esi
+  801a5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a5f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801a64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a67:	89 f7                	mov    %esi,%edi
+  801a69:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801a6b:	83 c4 08             	add    $0x8,%esp
+  801a6e:	85 c0                	test   %eax,%eax
+  801a70:	7f 08                	jg     801a7a <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  801a72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a75:	5b                   	pop    %ebx
+  801a76:	5e                   	pop    %esi
+  801a77:	5f                   	pop    %edi
+  801a78:	5d                   	pop    %ebp
+  801a79:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a7a:	83 ec 0c             	sub    $0xc,%esp
+  801a7d:	50                   	push   %eax
+  801a7e:	6a 13                	push   $0x13
+  801a80:	68 bb 6a 80 00       	push   $0x806abb
+  801a85:	6a 23                	push   $0x23
+  801a87:	68 d8 6a 80 00       	push   $0x806ad8
+  801a8c:	e8 f5 ef ff ff       	call   800a86 <_panic>
+
+00801a91 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801a91:	55                   	push   %ebp
+  801a92:	89 e5                	mov    %esp,%ebp
+  801a94:	57                   	push   %edi
+  801a95:	56                   	push   %esi
+  801a96:	53                   	push   %ebx
+  801a97:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801a9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aa2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aa5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801aaa:	89 df                	mov    %ebx,%edi
+  801aac:	89 de                	mov    %ebx,%esi
+  801aae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801ab0:	85 c0                	test   %eax,%eax
+  801ab2:	7f 08                	jg     801abc <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801ab4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ab7:	5b                   	pop    %ebx
+  801ab8:	5e                   	pop    %esi
+  801ab9:	5f                   	pop    %edi
+  801aba:	5d                   	pop    %ebp
+  801abb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801abc:	83 ec 0c             	sub    $0xc,%esp
+  801abf:	50                   	push   %eax
+  801ac0:	6a 0a                	push   $0xa
+  801ac2:	68 bb 6a 80 00       	push   $0x806abb
+  801ac7:	6a 23                	push   $0x23
+  801ac9:	68 d8 6a 80 00       	push   $0x806ad8
+  801ace:	e8 b3 ef ff ff       	call   800a86 <_panic>
+
+00801ad3 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801ad3:	55                   	push   %ebp
+  801ad4:	89 e5                	mov    %esp,%ebp
+  801ad6:	57                   	push   %edi
+  801ad7:	56                   	push   %esi
+  801ad8:	53                   	push   %ebx
+  801ad9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801adc:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801ae2:	76 1d                	jbe    801b01 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  801ae4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ae7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aea:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801aef:	be 01 00 00 00       	mov    $0x1,%esi
+  801af4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801af7:	cd 30                	int    $0x30
+}
+  801af9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801afc:	5b                   	pop    %ebx
+  801afd:	5e                   	pop    %esi
+  801afe:	5f                   	pop    %edi
+  801aff:	5d                   	pop    %ebp
+  801b00:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801b01:	68 00 10 00 00       	push   $0x1000
+  801b06:	53                   	push   %ebx
+  801b07:	e8 2c fb ff ff       	call   801638 <touch_mem>
+  801b0c:	83 c4 08             	add    $0x8,%esp
+  801b0f:	eb d3                	jmp    801ae4 <sys_ipc_send+0x11>
+
+00801b11 <sys_ipc_send_pages>:
+{
+  801b11:	55                   	push   %ebp
+  801b12:	89 e5                	mov    %esp,%ebp
+  801b14:	57                   	push   %edi
+  801b15:	56                   	push   %esi
+  801b16:	53                   	push   %ebx
+  801b17:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b1a:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801b1d:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801b23:	76 18                	jbe    801b3d <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  801b25:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b2b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801b30:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801b33:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  801b35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b38:	5b                   	pop    %ebx
+  801b39:	5e                   	pop    %esi
+  801b3a:	5f                   	pop    %edi
+  801b3b:	5d                   	pop    %ebp
+  801b3c:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801b3d:	89 f0                	mov    %esi,%eax
+  801b3f:	c1 e0 0c             	shl    $0xc,%eax
+  801b42:	50                   	push   %eax
+  801b43:	53                   	push   %ebx
+  801b44:	e8 ef fa ff ff       	call   801638 <touch_mem>
+  801b49:	83 c4 08             	add    $0x8,%esp
+  801b4c:	eb d7                	jmp    801b25 <sys_ipc_send_pages+0x14>
+
+00801b4e <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801b4e:	55                   	push   %ebp
+  801b4f:	89 e5                	mov    %esp,%ebp
+  801b51:	57                   	push   %edi
+  801b52:	56                   	push   %esi
+  801b53:	53                   	push   %ebx
+  801b54:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801b57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b62:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801b67:	89 df                	mov    %ebx,%edi
+  801b69:	89 de                	mov    %ebx,%esi
+  801b6b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801b6d:	85 c0                	test   %eax,%eax
+  801b6f:	7f 08                	jg     801b79 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801b71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b74:	5b                   	pop    %ebx
+  801b75:	5e                   	pop    %esi
+  801b76:	5f                   	pop    %edi
+  801b77:	5d                   	pop    %ebp
+  801b78:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b79:	83 ec 0c             	sub    $0xc,%esp
+  801b7c:	50                   	push   %eax
+  801b7d:	6a 0d                	push   $0xd
+  801b7f:	68 bb 6a 80 00       	push   $0x806abb
+  801b84:	6a 23                	push   $0x23
+  801b86:	68 d8 6a 80 00       	push   $0x806ad8
+  801b8b:	e8 f6 ee ff ff       	call   800a86 <_panic>
+
+00801b90 <sys_ipc_recv>:
+{
+  801b90:	55                   	push   %ebp
+  801b91:	89 e5                	mov    %esp,%ebp
+  801b93:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801b96:	6a 01                	push   $0x1
+  801b98:	ff 75 08             	push   0x8(%ebp)
+  801b9b:	e8 ae ff ff ff       	call   801b4e <sys_ipc_recv_pages>
+}
+  801ba0:	c9                   	leave
+  801ba1:	c3                   	ret
+
+00801ba2 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801ba2:	55                   	push   %ebp
+  801ba3:	89 e5                	mov    %esp,%ebp
+  801ba5:	57                   	push   %edi
+  801ba6:	56                   	push   %esi
+  801ba7:	53                   	push   %ebx
+  801ba8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801bab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801bae:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801bb1:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801bb7:	77 04                	ja     801bbd <sys_ipc_call+0x1b>
+  801bb9:	85 f6                	test   %esi,%esi
+  801bbb:	75 15                	jne    801bd2 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801bbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bc3:	b8 14 00 00 00       	mov    $0x14,%eax
+  801bc8:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801bca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bcd:	5b                   	pop    %ebx
+  801bce:	5e                   	pop    %esi
+  801bcf:	5f                   	pop    %edi
+  801bd0:	5d                   	pop    %ebp
+  801bd1:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  801bd2:	89 f8                	mov    %edi,%eax
+  801bd4:	c1 e0 0c             	shl    $0xc,%eax
+  801bd7:	50                   	push   %eax
+  801bd8:	53                   	push   %ebx
+  801bd9:	e8 5a fa ff ff       	call   801638 <touch_mem>
+  801bde:	83 c4 08             	add    $0x8,%esp
+  801be1:	eb da                	jmp    801bbd <sys_ipc_call+0x1b>
+
+00801be3 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801be3:	55                   	push   %ebp
+  801be4:	89 e5                	mov    %esp,%ebp
+  801be6:	57                   	push   %edi
+  801be7:	56                   	push   %esi
+  801be8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801be9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bef:	b8 15 00 00 00       	mov    $0x15,%eax
+  801bf4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801bf7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801bfa:	8b 75 18             	mov    0x18(%ebp),%esi
+  801bfd:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801bff:	5b                   	pop    %ebx
+  801c00:	5e                   	pop    %esi
+  801c01:	5f                   	pop    %edi
+  801c02:	5d                   	pop    %ebp
+  801c03:	c3                   	ret
+
+00801c04 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  801c04:	55                   	push   %ebp
+  801c05:	89 e5                	mov    %esp,%ebp
+  801c07:	57                   	push   %edi
+  801c08:	56                   	push   %esi
+  801c09:	53                   	push   %ebx
+  801c0a:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801c0d:	6a 04                	push   $0x4
+  801c0f:	ff 75 08             	push   0x8(%ebp)
+  801c12:	e8 21 fa ff ff       	call   801638 <touch_mem>
+	asm volatile("int %1\n"
+  801c17:	be 00 00 00 00       	mov    $0x0,%esi
+  801c1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c1f:	b8 16 00 00 00       	mov    $0x16,%eax
+  801c24:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c2a:	89 f7                	mov    %esi,%edi
+  801c2c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801c2e:	83 c4 08             	add    $0x8,%esp
+  801c31:	85 c0                	test   %eax,%eax
+  801c33:	7f 08                	jg     801c3d <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  801c35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c38:	5b                   	pop    %ebx
+  801c39:	5e                   	pop    %esi
+  801c3a:	5f                   	pop    %edi
+  801c3b:	5d                   	pop    %ebp
+  801c3c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c3d:	83 ec 0c             	sub    $0xc,%esp
+  801c40:	50                   	push   %eax
+  801c41:	6a 16                	push   $0x16
+  801c43:	68 bb 6a 80 00       	push   $0x806abb
+  801c48:	6a 23                	push   $0x23
+  801c4a:	68 d8 6a 80 00       	push   $0x806ad8
+  801c4f:	e8 32 ee ff ff       	call   800a86 <_panic>
+
+00801c54 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801c54:	55                   	push   %ebp
+  801c55:	89 e5                	mov    %esp,%ebp
+  801c57:	57                   	push   %edi
+  801c58:	56                   	push   %esi
+  801c59:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801c5a:	6a 04                	push   $0x4
+  801c5c:	ff 75 08             	push   0x8(%ebp)
+  801c5f:	e8 d4 f9 ff ff       	call   801638 <touch_mem>
+	asm volatile("int %1\n"
+  801c64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c6c:	b8 17 00 00 00       	mov    $0x17,%eax
+  801c71:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c74:	89 df                	mov    %ebx,%edi
+  801c76:	89 de                	mov    %ebx,%esi
+  801c78:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801c7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c7d:	5b                   	pop    %ebx
+  801c7e:	5e                   	pop    %esi
+  801c7f:	5f                   	pop    %edi
+  801c80:	5d                   	pop    %ebp
+  801c81:	c3                   	ret
+
+00801c82 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  801c82:	55                   	push   %ebp
+  801c83:	89 e5                	mov    %esp,%ebp
+  801c85:	57                   	push   %edi
+  801c86:	56                   	push   %esi
+  801c87:	53                   	push   %ebx
+  801c88:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801c8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c90:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c93:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801c98:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c9d:	89 df                	mov    %ebx,%edi
+  801c9f:	89 de                	mov    %ebx,%esi
+  801ca1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801ca3:	85 c0                	test   %eax,%eax
+  801ca5:	7f 08                	jg     801caf <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801ca7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801caa:	5b                   	pop    %ebx
+  801cab:	5e                   	pop    %esi
+  801cac:	5f                   	pop    %edi
+  801cad:	5d                   	pop    %ebp
+  801cae:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801caf:	83 ec 0c             	sub    $0xc,%esp
+  801cb2:	50                   	push   %eax
+  801cb3:	6a 0e                	push   $0xe
+  801cb5:	68 bb 6a 80 00       	push   $0x806abb
+  801cba:	6a 23                	push   $0x23
+  801cbc:	68 d8 6a 80 00       	push   $0x806ad8
+  801cc1:	e8 c0 ed ff ff       	call   800a86 <_panic>
+
+00801cc6 <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  801cc6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ccd:	f6 c6 06             	test   $0x6,%dh
+  801cd0:	75 37                	jne    801d09 <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  801cd2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801cd9:	f6 c2 02             	test   $0x2,%dl
+  801cdc:	75 19                	jne    801cf7 <dupperm+0x31>
+  801cde:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ce5:	f6 c6 08             	test   $0x8,%dh
+  801ce8:	75 0d                	jne    801cf7 <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  801cea:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801cf1:	25 07 0e 00 00       	and    $0xe07,%eax
+  801cf6:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801cf7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801cfe:	25 00 06 00 00       	and    $0x600,%eax
+  801d03:	0d 05 08 00 00       	or     $0x805,%eax
+  801d08:	c3                   	ret
+		return 0;
+  801d09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d0e:	c3                   	ret
+
+00801d0f <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  801d0f:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  801d11:	c1 e0 0c             	shl    $0xc,%eax
+  801d14:	c1 e8 16             	shr    $0x16,%eax
+  801d17:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801d1e:	f6 c1 01             	test   $0x1,%cl
+  801d21:	74 2c                	je     801d4f <dupable+0x40>
+  801d23:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801d2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d2f:	f6 c1 04             	test   $0x4,%cl
+  801d32:	74 20                	je     801d54 <dupable+0x45>
+  801d34:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801d3b:	f6 c1 01             	test   $0x1,%cl
+  801d3e:	74 14                	je     801d54 <dupable+0x45>
+  801d40:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801d47:	c1 e8 02             	shr    $0x2,%eax
+  801d4a:	83 e0 01             	and    $0x1,%eax
+  801d4d:	eb 05                	jmp    801d54 <dupable+0x45>
+  801d4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d54:	83 e0 01             	and    $0x1,%eax
+}
+  801d57:	c3                   	ret
+
+00801d58 <pgfault>:
+{
+  801d58:	55                   	push   %ebp
+  801d59:	89 e5                	mov    %esp,%ebp
+  801d5b:	56                   	push   %esi
+  801d5c:	53                   	push   %ebx
+  801d5d:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801d60:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  801d62:	89 ca                	mov    %ecx,%edx
+  801d64:	c1 ea 0c             	shr    $0xc,%edx
+  801d67:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801d6e:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801d72:	0f 84 8e 00 00 00    	je     801e06 <pgfault+0xae>
+		return 0;
+  801d78:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801d7d:	f6 c6 08             	test   $0x8,%dh
+  801d80:	0f 84 85 00 00 00    	je     801e0b <pgfault+0xb3>
+	perm |= PTE_W;
+  801d86:	81 e2 07 06 00 00    	and    $0x607,%edx
+  801d8c:	89 d3                	mov    %edx,%ebx
+  801d8e:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801d91:	89 ce                	mov    %ecx,%esi
+  801d93:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  801d99:	6a 01                	push   $0x1
+  801d9b:	53                   	push   %ebx
+  801d9c:	68 00 f0 7f 00       	push   $0x7ff000
+  801da1:	6a 00                	push   $0x0
+  801da3:	e8 de 30 00 00       	call   804e86 <page_alloc>
+  801da8:	83 c4 10             	add    $0x10,%esp
+  801dab:	85 c0                	test   %eax,%eax
+  801dad:	78 33                	js     801de2 <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  801daf:	83 ec 04             	sub    $0x4,%esp
+  801db2:	68 00 10 00 00       	push   $0x1000
+  801db7:	56                   	push   %esi
+  801db8:	68 00 f0 7f 00       	push   $0x7ff000
+  801dbd:	e8 fc f5 ff ff       	call   8013be <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  801dc2:	89 1c 24             	mov    %ebx,(%esp)
+  801dc5:	56                   	push   %esi
+  801dc6:	6a 00                	push   $0x0
+  801dc8:	68 00 f0 7f 00       	push   $0x7ff000
+  801dcd:	6a 00                	push   $0x0
+  801dcf:	e8 13 37 00 00       	call   8054e7 <page_map>
+  801dd4:	83 c4 20             	add    $0x20,%esp
+  801dd7:	85 c0                	test   %eax,%eax
+  801dd9:	78 19                	js     801df4 <pgfault+0x9c>
+	return 1;
+  801ddb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801de0:	eb 29                	jmp    801e0b <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  801de2:	50                   	push   %eax
+  801de3:	68 e8 6a 80 00       	push   $0x806ae8
+  801de8:	6a 2e                	push   $0x2e
+  801dea:	68 3b 6b 80 00       	push   $0x806b3b
+  801def:	e8 92 ec ff ff       	call   800a86 <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  801df4:	50                   	push   %eax
+  801df5:	68 14 6b 80 00       	push   $0x806b14
+  801dfa:	6a 32                	push   $0x32
+  801dfc:	68 3b 6b 80 00       	push   $0x806b3b
+  801e01:	e8 80 ec ff ff       	call   800a86 <_panic>
+		return 0;
+  801e06:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e0e:	5b                   	pop    %ebx
+  801e0f:	5e                   	pop    %esi
+  801e10:	5d                   	pop    %ebp
+  801e11:	c3                   	ret
+
+00801e12 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  801e12:	55                   	push   %ebp
+  801e13:	89 e5                	mov    %esp,%ebp
+  801e15:	57                   	push   %edi
+  801e16:	56                   	push   %esi
+  801e17:	53                   	push   %ebx
+  801e18:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  801e1b:	83 3d 14 09 81 00 00 	cmpl   $0x0,0x810914
+  801e22:	74 5d                	je     801e81 <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  801e24:	83 ec 0c             	sub    $0xc,%esp
+  801e27:	68 58 1d 80 00       	push   $0x801d58
+  801e2c:	e8 a3 41 00 00       	call   805fd4 <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  801e31:	e8 14 fb ff ff       	call   80194a <sys_fork>
+  801e36:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e39:	83 c4 10             	add    $0x10,%esp
+  801e3c:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  801e3f:	74 47                	je     801e88 <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  801e41:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801e45:	0f 84 c5 03 00 00    	je     802210 <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  801e4b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801e4f:	78 25                	js     801e76 <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  801e51:	e8 a8 29 00 00       	call   8047fe <page_share_paged_out>
+  801e56:	85 c0                	test   %eax,%eax
+  801e58:	0f 88 d8 03 00 00    	js     802236 <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801e5e:	83 ec 08             	sub    $0x8,%esp
+  801e61:	6a 02                	push   $0x2
+  801e63:	ff 75 e4             	push   -0x1c(%ebp)
+  801e66:	e8 fe fa ff ff       	call   801969 <sys_env_set_status>
+  801e6b:	83 c4 10             	add    $0x10,%esp
+  801e6e:	85 c0                	test   %eax,%eax
+  801e70:	0f 88 d5 03 00 00    	js     80224b <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  801e76:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e7c:	5b                   	pop    %ebx
+  801e7d:	5e                   	pop    %esi
+  801e7e:	5f                   	pop    %edi
+  801e7f:	5d                   	pop    %ebp
+  801e80:	c3                   	ret
+		init_map_dir();
+  801e81:	e8 80 2c 00 00       	call   804b06 <init_map_dir>
+  801e86:	eb 9c                	jmp    801e24 <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801e88:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e8d:	cd 30                	int    $0x30
+  801e8f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  801e92:	85 c0                	test   %eax,%eax
+  801e94:	78 10                	js     801ea6 <fork+0x94>
+	if (envid == 0)
+  801e96:	0f 84 74 03 00 00    	je     802210 <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801e9c:	be 00 00 00 00       	mov    $0x0,%esi
+  801ea1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801ea4:	eb 30                	jmp    801ed6 <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  801ea6:	50                   	push   %eax
+  801ea7:	68 46 6b 80 00       	push   $0x806b46
+  801eac:	68 cd 00 00 00       	push   $0xcd
+  801eb1:	68 3b 6b 80 00       	push   $0x806b3b
+  801eb6:	e8 cb eb ff ff       	call   800a86 <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  801ebb:	89 f2                	mov    %esi,%edx
+  801ebd:	c1 fa 1f             	sar    $0x1f,%edx
+  801ec0:	c1 ea 16             	shr    $0x16,%edx
+  801ec3:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  801ec6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801ecb:	29 d0                	sub    %edx,%eax
+  801ecd:	ba 00 04 00 00       	mov    $0x400,%edx
+  801ed2:	29 c2                	sub    %eax,%edx
+  801ed4:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801ed6:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  801ed9:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801edf:	0f 87 ff 02 00 00    	ja     8021e4 <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  801ee5:	89 f3                	mov    %esi,%ebx
+  801ee7:	c1 e3 0c             	shl    $0xc,%ebx
+  801eea:	89 d8                	mov    %ebx,%eax
+  801eec:	c1 e8 16             	shr    $0x16,%eax
+  801eef:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801ef6:	f6 c2 01             	test   $0x1,%dl
+  801ef9:	74 c0                	je     801ebb <fork+0xa9>
+  801efb:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801f02:	f6 c2 04             	test   $0x4,%dl
+  801f05:	74 b4                	je     801ebb <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  801f07:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801f0e:	a8 80                	test   $0x80,%al
+  801f10:	75 24                	jne    801f36 <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  801f12:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801f19:	25 81 00 00 00       	and    $0x81,%eax
+  801f1e:	3d 80 00 00 00       	cmp    $0x80,%eax
+  801f23:	74 21                	je     801f46 <fork+0x134>
+		if (!dupable(pn)) {
+  801f25:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f28:	e8 e2 fd ff ff       	call   801d0f <dupable>
+  801f2d:	84 c0                	test   %al,%al
+  801f2f:	75 1a                	jne    801f4b <fork+0x139>
+			++pn;
+  801f31:	83 c6 01             	add    $0x1,%esi
+			continue;
+  801f34:	eb a0                	jmp    801ed6 <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  801f36:	83 ec 08             	sub    $0x8,%esp
+  801f39:	53                   	push   %ebx
+  801f3a:	6a 00                	push   $0x0
+  801f3c:	e8 b1 f8 ff ff       	call   8017f2 <sys_page_split>
+  801f41:	83 c4 10             	add    $0x10,%esp
+  801f44:	eb cc                	jmp    801f12 <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  801f46:	0f b6 03             	movzbl (%ebx),%eax
+  801f49:	eb da                	jmp    801f25 <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  801f4b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801f4e:	89 f8                	mov    %edi,%eax
+  801f50:	e8 71 fd ff ff       	call   801cc6 <dupperm>
+  801f55:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801f58:	85 c0                	test   %eax,%eax
+  801f5a:	74 16                	je     801f72 <fork+0x160>
+  801f5c:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  801f61:	29 f8                	sub    %edi,%eax
+  801f63:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801f66:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f6b:	89 c6                	mov    %eax,%esi
+  801f6d:	e9 c4 01 00 00       	jmp    802136 <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  801f72:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f75:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801f7c:	f6 c4 04             	test   $0x4,%ah
+  801f7f:	0f 85 89 00 00 00    	jne    80200e <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  801f85:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f88:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801f8f:	f6 c4 02             	test   $0x2,%ah
+  801f92:	0f 85 b1 00 00 00    	jne    802049 <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  801f98:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801f9b:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801fa2:	a8 02                	test   $0x2,%al
+  801fa4:	75 10                	jne    801fb6 <fork+0x1a4>
+  801fa6:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801fad:	f6 c4 08             	test   $0x8,%ah
+  801fb0:	0f 84 3e 01 00 00    	je     8020f4 <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801fb6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801fb9:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801fc0:	25 00 06 00 00       	and    $0x600,%eax
+  801fc5:	0d 05 08 00 00       	or     $0x805,%eax
+  801fca:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  801fcc:	c1 e1 0c             	shl    $0xc,%ecx
+  801fcf:	89 cb                	mov    %ecx,%ebx
+  801fd1:	83 ec 0c             	sub    $0xc,%esp
+  801fd4:	50                   	push   %eax
+  801fd5:	51                   	push   %ecx
+  801fd6:	ff 75 e4             	push   -0x1c(%ebp)
+  801fd9:	51                   	push   %ecx
+  801fda:	6a 00                	push   $0x0
+  801fdc:	e8 06 35 00 00       	call   8054e7 <page_map>
+  801fe1:	83 c4 20             	add    $0x20,%esp
+  801fe4:	85 c0                	test   %eax,%eax
+  801fe6:	0f 88 e4 00 00 00    	js     8020d0 <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  801fec:	83 ec 0c             	sub    $0xc,%esp
+  801fef:	57                   	push   %edi
+  801ff0:	53                   	push   %ebx
+  801ff1:	6a 00                	push   $0x0
+  801ff3:	53                   	push   %ebx
+  801ff4:	6a 00                	push   $0x0
+  801ff6:	e8 ec 34 00 00       	call   8054e7 <page_map>
+  801ffb:	83 c4 20             	add    $0x20,%esp
+  801ffe:	85 c0                	test   %eax,%eax
+  802000:	0f 88 dc 00 00 00    	js     8020e2 <fork+0x2d0>
+			++pn;
+  802006:	83 c6 01             	add    $0x1,%esi
+			continue;
+  802009:	e9 c8 fe ff ff       	jmp    801ed6 <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  80200e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802011:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  802018:	c1 e1 0c             	shl    $0xc,%ecx
+  80201b:	83 ec 0c             	sub    $0xc,%esp
+  80201e:	25 07 0e 00 00       	and    $0xe07,%eax
+  802023:	50                   	push   %eax
+  802024:	51                   	push   %ecx
+  802025:	ff 75 e4             	push   -0x1c(%ebp)
+  802028:	51                   	push   %ecx
+  802029:	6a 00                	push   $0x0
+  80202b:	e8 b7 34 00 00       	call   8054e7 <page_map>
+  802030:	83 c4 20             	add    $0x20,%esp
+  802033:	85 c0                	test   %eax,%eax
+  802035:	79 cf                	jns    802006 <fork+0x1f4>
+			panic("page_map %d", r);
+  802037:	50                   	push   %eax
+  802038:	68 56 6b 80 00       	push   $0x806b56
+  80203d:	6a 4d                	push   $0x4d
+  80203f:	68 3b 6b 80 00       	push   $0x806b3b
+  802044:	e8 3d ea ff ff       	call   800a86 <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  802049:	83 ec 0c             	sub    $0xc,%esp
+  80204c:	68 00 10 00 00       	push   $0x1000
+  802051:	e8 83 3a 00 00       	call   805ad9 <malloc>
+  802056:	89 c7                	mov    %eax,%edi
+  802058:	83 c4 10             	add    $0x10,%esp
+  80205b:	85 c0                	test   %eax,%eax
+  80205d:	74 4b                	je     8020aa <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  80205f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802062:	c1 e3 0c             	shl    $0xc,%ebx
+  802065:	83 ec 04             	sub    $0x4,%esp
+  802068:	68 00 10 00 00       	push   $0x1000
+  80206d:	53                   	push   %ebx
+  80206e:	50                   	push   %eax
+  80206f:	e8 ac f3 ff ff       	call   801420 <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  802074:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802077:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80207e:	25 07 0e 00 00       	and    $0xe07,%eax
+  802083:	89 04 24             	mov    %eax,(%esp)
+  802086:	53                   	push   %ebx
+  802087:	ff 75 e4             	push   -0x1c(%ebp)
+  80208a:	57                   	push   %edi
+  80208b:	6a 00                	push   $0x0
+  80208d:	e8 55 34 00 00       	call   8054e7 <page_map>
+  802092:	83 c4 20             	add    $0x20,%esp
+  802095:	85 c0                	test   %eax,%eax
+  802097:	78 25                	js     8020be <fork+0x2ac>
+		free(temp);
+  802099:	83 ec 0c             	sub    $0xc,%esp
+  80209c:	57                   	push   %edi
+  80209d:	e8 35 38 00 00       	call   8058d7 <free>
+  8020a2:	83 c4 10             	add    $0x10,%esp
+  8020a5:	e9 5c ff ff ff       	jmp    802006 <fork+0x1f4>
+			panic("malloc failed");
+  8020aa:	83 ec 04             	sub    $0x4,%esp
+  8020ad:	68 62 6b 80 00       	push   $0x806b62
+  8020b2:	6a 56                	push   $0x56
+  8020b4:	68 3b 6b 80 00       	push   $0x806b3b
+  8020b9:	e8 c8 e9 ff ff       	call   800a86 <_panic>
+			panic("page_map: %e", r);
+  8020be:	50                   	push   %eax
+  8020bf:	68 70 6b 80 00       	push   $0x806b70
+  8020c4:	6a 59                	push   $0x59
+  8020c6:	68 3b 6b 80 00       	push   $0x806b3b
+  8020cb:	e8 b6 e9 ff ff       	call   800a86 <_panic>
+			panic("page_map %d", r);
+  8020d0:	50                   	push   %eax
+  8020d1:	68 56 6b 80 00       	push   $0x806b56
+  8020d6:	6a 65                	push   $0x65
+  8020d8:	68 3b 6b 80 00       	push   $0x806b3b
+  8020dd:	e8 a4 e9 ff ff       	call   800a86 <_panic>
+			panic("page_map %d", r);
+  8020e2:	50                   	push   %eax
+  8020e3:	68 56 6b 80 00       	push   $0x806b56
+  8020e8:	6a 78                	push   $0x78
+  8020ea:	68 3b 6b 80 00       	push   $0x806b3b
+  8020ef:	e8 92 e9 ff ff       	call   800a86 <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8020f4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8020f7:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8020fe:	c1 e1 0c             	shl    $0xc,%ecx
+  802101:	83 ec 0c             	sub    $0xc,%esp
+  802104:	25 07 0e 00 00       	and    $0xe07,%eax
+  802109:	50                   	push   %eax
+  80210a:	51                   	push   %ecx
+  80210b:	ff 75 e4             	push   -0x1c(%ebp)
+  80210e:	51                   	push   %ecx
+  80210f:	6a 00                	push   $0x0
+  802111:	e8 d1 33 00 00       	call   8054e7 <page_map>
+  802116:	83 c4 20             	add    $0x20,%esp
+  802119:	85 c0                	test   %eax,%eax
+  80211b:	0f 89 e5 fe ff ff    	jns    802006 <fork+0x1f4>
+			panic("page_map %d", r);
+  802121:	50                   	push   %eax
+  802122:	68 56 6b 80 00       	push   $0x806b56
+  802127:	6a 7f                	push   $0x7f
+  802129:	68 3b 6b 80 00       	push   $0x806b3b
+  80212e:	e8 53 e9 ff ff       	call   800a86 <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  802133:	83 c7 01             	add    $0x1,%edi
+  802136:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802139:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  80213c:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  80213f:	39 f7                	cmp    %esi,%edi
+  802141:	74 1c                	je     80215f <fork+0x34d>
+  802143:	89 d8                	mov    %ebx,%eax
+  802145:	e8 c5 fb ff ff       	call   801d0f <dupable>
+  80214a:	84 c0                	test   %al,%al
+  80214c:	74 7c                	je     8021ca <fork+0x3b8>
+  80214e:	89 d8                	mov    %ebx,%eax
+  802150:	e8 71 fb ff ff       	call   801cc6 <dupperm>
+  802155:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  802158:	74 d9                	je     802133 <fork+0x321>
+  80215a:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80215d:	eb 06                	jmp    802165 <fork+0x353>
+  80215f:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  802162:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  802165:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802168:	c1 e0 0c             	shl    $0xc,%eax
+  80216b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80216e:	83 ec 08             	sub    $0x8,%esp
+  802171:	ff 75 dc             	push   -0x24(%ebp)
+  802174:	57                   	push   %edi
+  802175:	50                   	push   %eax
+  802176:	ff 75 e4             	push   -0x1c(%ebp)
+  802179:	50                   	push   %eax
+  80217a:	6a 00                	push   $0x0
+  80217c:	e8 5d 35 00 00       	call   8056de <page_map_range>
+  802181:	83 c4 20             	add    $0x20,%esp
+  802184:	85 c0                	test   %eax,%eax
+  802186:	78 47                	js     8021cf <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  802188:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  80218f:	0f 84 41 fd ff ff    	je     801ed6 <fork+0xc4>
+  802195:	83 ec 08             	sub    $0x8,%esp
+  802198:	ff 75 dc             	push   -0x24(%ebp)
+  80219b:	57                   	push   %edi
+  80219c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80219f:	50                   	push   %eax
+  8021a0:	6a 00                	push   $0x0
+  8021a2:	50                   	push   %eax
+  8021a3:	6a 00                	push   $0x0
+  8021a5:	e8 34 35 00 00       	call   8056de <page_map_range>
+  8021aa:	83 c4 20             	add    $0x20,%esp
+  8021ad:	85 c0                	test   %eax,%eax
+  8021af:	0f 89 21 fd ff ff    	jns    801ed6 <fork+0xc4>
+		panic("page_map_range %e", r);
+  8021b5:	50                   	push   %eax
+  8021b6:	68 7d 6b 80 00       	push   $0x806b7d
+  8021bb:	68 a2 00 00 00       	push   $0xa2
+  8021c0:	68 3b 6b 80 00       	push   $0x806b3b
+  8021c5:	e8 bc e8 ff ff       	call   800a86 <_panic>
+  8021ca:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8021cd:	eb 96                	jmp    802165 <fork+0x353>
+		panic("page_map_range %e", r);
+  8021cf:	50                   	push   %eax
+  8021d0:	68 7d 6b 80 00       	push   $0x806b7d
+  8021d5:	68 a0 00 00 00       	push   $0xa0
+  8021da:	68 3b 6b 80 00       	push   $0x806b3b
+  8021df:	e8 a2 e8 ff ff       	call   800a86 <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  8021e4:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  8021e7:	6a 01                	push   $0x1
+  8021e9:	6a 07                	push   $0x7
+  8021eb:	68 00 f0 bf ee       	push   $0xeebff000
+  8021f0:	53                   	push   %ebx
+  8021f1:	e8 90 2c 00 00       	call   804e86 <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8021f6:	a1 18 09 81 00       	mov    0x810918,%eax
+  8021fb:	8b 40 74             	mov    0x74(%eax),%eax
+  8021fe:	83 c4 08             	add    $0x8,%esp
+  802201:	50                   	push   %eax
+  802202:	53                   	push   %ebx
+  802203:	e8 89 f8 ff ff       	call   801a91 <sys_env_set_pgfault_upcall>
+  802208:	83 c4 10             	add    $0x10,%esp
+  80220b:	e9 41 fc ff ff       	jmp    801e51 <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802210:	e8 d8 f4 ff ff       	call   8016ed <sys_getenvid>
+  802215:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80221a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80221d:	c1 e0 06             	shl    $0x6,%eax
+  802220:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802225:	a3 18 09 81 00       	mov    %eax,0x810918
+		return 0;
+  80222a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802231:	e9 40 fc ff ff       	jmp    801e76 <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  802236:	50                   	push   %eax
+  802237:	68 8f 6b 80 00       	push   $0x806b8f
+  80223c:	68 27 01 00 00       	push   $0x127
+  802241:	68 3b 6b 80 00       	push   $0x806b3b
+  802246:	e8 3b e8 ff ff       	call   800a86 <_panic>
+		panic("sys_env_set_status: %d", r);
+  80224b:	50                   	push   %eax
+  80224c:	68 a8 6b 80 00       	push   $0x806ba8
+  802251:	68 2b 01 00 00       	push   $0x12b
+  802256:	68 3b 6b 80 00       	push   $0x806b3b
+  80225b:	e8 26 e8 ff ff       	call   800a86 <_panic>
+
+00802260 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  802260:	55                   	push   %ebp
+  802261:	89 e5                	mov    %esp,%ebp
+  802263:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  802266:	68 bf 6b 80 00       	push   $0x806bbf
+  80226b:	68 35 01 00 00       	push   $0x135
+  802270:	68 3b 6b 80 00       	push   $0x806b3b
+  802275:	e8 0c e8 ff ff       	call   800a86 <_panic>
+
+0080227a <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  80227a:	55                   	push   %ebp
+  80227b:	89 e5                	mov    %esp,%ebp
+  80227d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802280:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802283:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  802286:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  802288:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  80228b:	83 3a 01             	cmpl   $0x1,(%edx)
+  80228e:	7e 09                	jle    802299 <argstart+0x1f>
+  802290:	ba 41 65 80 00       	mov    $0x806541,%edx
+  802295:	85 c9                	test   %ecx,%ecx
+  802297:	75 05                	jne    80229e <argstart+0x24>
+  802299:	ba 00 00 00 00       	mov    $0x0,%edx
+  80229e:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  8022a1:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  8022a8:	5d                   	pop    %ebp
+  8022a9:	c3                   	ret
+
+008022aa <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  8022aa:	55                   	push   %ebp
+  8022ab:	89 e5                	mov    %esp,%ebp
+  8022ad:	53                   	push   %ebx
+  8022ae:	83 ec 04             	sub    $0x4,%esp
+  8022b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  8022b4:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  8022bb:	8b 43 08             	mov    0x8(%ebx),%eax
+  8022be:	85 c0                	test   %eax,%eax
+  8022c0:	74 74                	je     802336 <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  8022c2:	80 38 00             	cmpb   $0x0,(%eax)
+  8022c5:	75 48                	jne    80230f <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  8022c7:	8b 0b                	mov    (%ebx),%ecx
+  8022c9:	83 39 01             	cmpl   $0x1,(%ecx)
+  8022cc:	74 5a                	je     802328 <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  8022ce:	8b 53 04             	mov    0x4(%ebx),%edx
+  8022d1:	8b 42 04             	mov    0x4(%edx),%eax
+  8022d4:	80 38 2d             	cmpb   $0x2d,(%eax)
+  8022d7:	75 4f                	jne    802328 <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  8022d9:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  8022dd:	74 49                	je     802328 <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  8022df:	83 c0 01             	add    $0x1,%eax
+  8022e2:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8022e5:	83 ec 04             	sub    $0x4,%esp
+  8022e8:	8b 01                	mov    (%ecx),%eax
+  8022ea:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  8022f1:	50                   	push   %eax
+  8022f2:	8d 42 08             	lea    0x8(%edx),%eax
+  8022f5:	50                   	push   %eax
+  8022f6:	83 c2 04             	add    $0x4,%edx
+  8022f9:	52                   	push   %edx
+  8022fa:	e8 bf f0 ff ff       	call   8013be <memmove>
+		(*args->argc)--;
+  8022ff:	8b 03                	mov    (%ebx),%eax
+  802301:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  802304:	8b 43 08             	mov    0x8(%ebx),%eax
+  802307:	83 c4 10             	add    $0x10,%esp
+  80230a:	80 38 2d             	cmpb   $0x2d,(%eax)
+  80230d:	74 13                	je     802322 <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  80230f:	8b 43 08             	mov    0x8(%ebx),%eax
+  802312:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  802315:	83 c0 01             	add    $0x1,%eax
+  802318:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  80231b:	89 d0                	mov    %edx,%eax
+  80231d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802320:	c9                   	leave
+  802321:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  802322:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  802326:	75 e7                	jne    80230f <argnext+0x65>
+	args->curarg = 0;
+  802328:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  80232f:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802334:	eb e5                	jmp    80231b <argnext+0x71>
+		return -1;
+  802336:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80233b:	eb de                	jmp    80231b <argnext+0x71>
+
+0080233d <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  80233d:	55                   	push   %ebp
+  80233e:	89 e5                	mov    %esp,%ebp
+  802340:	53                   	push   %ebx
+  802341:	83 ec 04             	sub    $0x4,%esp
+  802344:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  802347:	8b 43 08             	mov    0x8(%ebx),%eax
+  80234a:	85 c0                	test   %eax,%eax
+  80234c:	74 12                	je     802360 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  80234e:	80 38 00             	cmpb   $0x0,(%eax)
+  802351:	74 12                	je     802365 <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  802353:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  802356:	c7 43 08 41 65 80 00 	movl   $0x806541,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  80235d:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  802360:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802363:	c9                   	leave
+  802364:	c3                   	ret
+	} else if (*args->argc > 1) {
+  802365:	8b 13                	mov    (%ebx),%edx
+  802367:	83 3a 01             	cmpl   $0x1,(%edx)
+  80236a:	7f 10                	jg     80237c <argnextvalue+0x3f>
+		args->argvalue = 0;
+  80236c:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  802373:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  80237a:	eb e1                	jmp    80235d <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  80237c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80237f:	8b 48 04             	mov    0x4(%eax),%ecx
+  802382:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  802385:	83 ec 04             	sub    $0x4,%esp
+  802388:	8b 12                	mov    (%edx),%edx
+  80238a:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  802391:	52                   	push   %edx
+  802392:	8d 50 08             	lea    0x8(%eax),%edx
+  802395:	52                   	push   %edx
+  802396:	83 c0 04             	add    $0x4,%eax
+  802399:	50                   	push   %eax
+  80239a:	e8 1f f0 ff ff       	call   8013be <memmove>
+		(*args->argc)--;
+  80239f:	8b 03                	mov    (%ebx),%eax
+  8023a1:	83 28 01             	subl   $0x1,(%eax)
+  8023a4:	83 c4 10             	add    $0x10,%esp
+  8023a7:	eb b4                	jmp    80235d <argnextvalue+0x20>
+
+008023a9 <argvalue>:
+{
+  8023a9:	55                   	push   %ebp
+  8023aa:	89 e5                	mov    %esp,%ebp
+  8023ac:	83 ec 08             	sub    $0x8,%esp
+  8023af:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8023b2:	8b 42 0c             	mov    0xc(%edx),%eax
+  8023b5:	85 c0                	test   %eax,%eax
+  8023b7:	74 02                	je     8023bb <argvalue+0x12>
+}
+  8023b9:	c9                   	leave
+  8023ba:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8023bb:	83 ec 0c             	sub    $0xc,%esp
+  8023be:	52                   	push   %edx
+  8023bf:	e8 79 ff ff ff       	call   80233d <argnextvalue>
+  8023c4:	83 c4 10             	add    $0x10,%esp
+  8023c7:	eb f0                	jmp    8023b9 <argvalue+0x10>
+
+008023c9 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8023c9:	55                   	push   %ebp
+  8023ca:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8023cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023cf:	05 00 00 00 30       	add    $0x30000000,%eax
+  8023d4:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8023d7:	5d                   	pop    %ebp
+  8023d8:	c3                   	ret
+
+008023d9 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8023d9:	55                   	push   %ebp
+  8023da:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8023dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023df:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8023e4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8023e9:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8023ee:	5d                   	pop    %ebp
+  8023ef:	c3                   	ret
+
+008023f0 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8023f0:	55                   	push   %ebp
+  8023f1:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8023f3:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8023f8:	a8 01                	test   $0x1,%al
+  8023fa:	74 3c                	je     802438 <fd_alloc+0x48>
+  8023fc:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802401:	89 c2                	mov    %eax,%edx
+  802403:	c1 ea 0c             	shr    $0xc,%edx
+  802406:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80240d:	89 c1                	mov    %eax,%ecx
+  80240f:	05 00 10 00 00       	add    $0x1000,%eax
+  802414:	f6 c2 01             	test   $0x1,%dl
+  802417:	74 13                	je     80242c <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  802419:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80241e:	75 e1                	jne    802401 <fd_alloc+0x11>
+  802420:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802425:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80242a:	eb 05                	jmp    802431 <fd_alloc+0x41>
+			return 0;
+  80242c:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  802431:	8b 55 08             	mov    0x8(%ebp),%edx
+  802434:	89 0a                	mov    %ecx,(%edx)
+}
+  802436:	5d                   	pop    %ebp
+  802437:	c3                   	ret
+  802438:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  80243d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802442:	eb ed                	jmp    802431 <fd_alloc+0x41>
+
+00802444 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802444:	55                   	push   %ebp
+  802445:	89 e5                	mov    %esp,%ebp
+  802447:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80244a:	83 f8 1f             	cmp    $0x1f,%eax
+  80244d:	77 30                	ja     80247f <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80244f:	c1 e0 0c             	shl    $0xc,%eax
+  802452:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802457:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80245d:	f6 c2 01             	test   $0x1,%dl
+  802460:	74 24                	je     802486 <fd_lookup+0x42>
+  802462:	89 c2                	mov    %eax,%edx
+  802464:	c1 ea 0c             	shr    $0xc,%edx
+  802467:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80246e:	f6 c2 01             	test   $0x1,%dl
+  802471:	74 1a                	je     80248d <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  802473:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802476:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802478:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80247d:	5d                   	pop    %ebp
+  80247e:	c3                   	ret
+		return -E_INVAL;
+  80247f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802484:	eb f7                	jmp    80247d <fd_lookup+0x39>
+		return -E_INVAL;
+  802486:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80248b:	eb f0                	jmp    80247d <fd_lookup+0x39>
+  80248d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802492:	eb e9                	jmp    80247d <fd_lookup+0x39>
+
+00802494 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802494:	55                   	push   %ebp
+  802495:	89 e5                	mov    %esp,%ebp
+  802497:	53                   	push   %ebx
+  802498:	83 ec 04             	sub    $0x4,%esp
+  80249b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80249e:	b8 54 6c 80 00       	mov    $0x806c54,%eax
+  8024a3:	8b 18                	mov    (%eax),%ebx
+  8024a5:	85 db                	test   %ebx,%ebx
+  8024a7:	74 0e                	je     8024b7 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  8024a9:	83 c0 04             	add    $0x4,%eax
+  8024ac:	39 13                	cmp    %edx,(%ebx)
+  8024ae:	75 f3                	jne    8024a3 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  8024b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b5:	eb 1f                	jmp    8024d6 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8024b7:	a1 18 09 81 00       	mov    0x810918,%eax
+  8024bc:	8b 40 48             	mov    0x48(%eax),%eax
+  8024bf:	83 ec 04             	sub    $0x4,%esp
+  8024c2:	52                   	push   %edx
+  8024c3:	50                   	push   %eax
+  8024c4:	68 d8 6b 80 00       	push   $0x806bd8
+  8024c9:	e8 93 e6 ff ff       	call   800b61 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8024ce:	83 c4 10             	add    $0x10,%esp
+  8024d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8024d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024d9:	89 1a                	mov    %ebx,(%edx)
+}
+  8024db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024de:	c9                   	leave
+  8024df:	c3                   	ret
+
+008024e0 <fd_close>:
+{
+  8024e0:	55                   	push   %ebp
+  8024e1:	89 e5                	mov    %esp,%ebp
+  8024e3:	57                   	push   %edi
+  8024e4:	56                   	push   %esi
+  8024e5:	53                   	push   %ebx
+  8024e6:	83 ec 24             	sub    $0x24,%esp
+  8024e9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8024ec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8024ef:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8024f2:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8024f3:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8024f9:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8024fc:	50                   	push   %eax
+  8024fd:	e8 42 ff ff ff       	call   802444 <fd_lookup>
+  802502:	89 c3                	mov    %eax,%ebx
+  802504:	83 c4 10             	add    $0x10,%esp
+  802507:	85 c0                	test   %eax,%eax
+  802509:	78 05                	js     802510 <fd_close+0x30>
+	    || fd != fd2)
+  80250b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80250e:	74 16                	je     802526 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802510:	89 f8                	mov    %edi,%eax
+  802512:	84 c0                	test   %al,%al
+  802514:	b8 00 00 00 00       	mov    $0x0,%eax
+  802519:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80251c:	89 d8                	mov    %ebx,%eax
+  80251e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802521:	5b                   	pop    %ebx
+  802522:	5e                   	pop    %esi
+  802523:	5f                   	pop    %edi
+  802524:	5d                   	pop    %ebp
+  802525:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802526:	83 ec 08             	sub    $0x8,%esp
+  802529:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80252c:	50                   	push   %eax
+  80252d:	ff 36                	push   (%esi)
+  80252f:	e8 60 ff ff ff       	call   802494 <dev_lookup>
+  802534:	89 c3                	mov    %eax,%ebx
+  802536:	83 c4 10             	add    $0x10,%esp
+  802539:	85 c0                	test   %eax,%eax
+  80253b:	78 1a                	js     802557 <fd_close+0x77>
+		if (dev->dev_close)
+  80253d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802540:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802543:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802548:	85 c0                	test   %eax,%eax
+  80254a:	74 0b                	je     802557 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80254c:	83 ec 0c             	sub    $0xc,%esp
+  80254f:	56                   	push   %esi
+  802550:	ff d0                	call   *%eax
+  802552:	89 c3                	mov    %eax,%ebx
+  802554:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802557:	83 ec 08             	sub    $0x8,%esp
+  80255a:	56                   	push   %esi
+  80255b:	6a 00                	push   $0x0
+  80255d:	e8 4e f2 ff ff       	call   8017b0 <sys_page_unmap>
+	return r;
+  802562:	83 c4 10             	add    $0x10,%esp
+  802565:	eb b5                	jmp    80251c <fd_close+0x3c>
+
+00802567 <close>:
+
+int
+close(int fdnum)
+{
+  802567:	55                   	push   %ebp
+  802568:	89 e5                	mov    %esp,%ebp
+  80256a:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80256d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802570:	50                   	push   %eax
+  802571:	ff 75 08             	push   0x8(%ebp)
+  802574:	e8 cb fe ff ff       	call   802444 <fd_lookup>
+  802579:	83 c4 10             	add    $0x10,%esp
+  80257c:	85 c0                	test   %eax,%eax
+  80257e:	79 02                	jns    802582 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802580:	c9                   	leave
+  802581:	c3                   	ret
+		return fd_close(fd, 1);
+  802582:	83 ec 08             	sub    $0x8,%esp
+  802585:	6a 01                	push   $0x1
+  802587:	ff 75 f4             	push   -0xc(%ebp)
+  80258a:	e8 51 ff ff ff       	call   8024e0 <fd_close>
+  80258f:	83 c4 10             	add    $0x10,%esp
+  802592:	eb ec                	jmp    802580 <close+0x19>
+
+00802594 <close_all>:
+
+void
+close_all(void)
+{
+  802594:	55                   	push   %ebp
+  802595:	89 e5                	mov    %esp,%ebp
+  802597:	53                   	push   %ebx
+  802598:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80259b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8025a0:	83 ec 0c             	sub    $0xc,%esp
+  8025a3:	53                   	push   %ebx
+  8025a4:	e8 be ff ff ff       	call   802567 <close>
+	for (i = 0; i < MAXFD; i++)
+  8025a9:	83 c3 01             	add    $0x1,%ebx
+  8025ac:	83 c4 10             	add    $0x10,%esp
+  8025af:	83 fb 20             	cmp    $0x20,%ebx
+  8025b2:	75 ec                	jne    8025a0 <close_all+0xc>
+}
+  8025b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025b7:	c9                   	leave
+  8025b8:	c3                   	ret
+
+008025b9 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8025b9:	55                   	push   %ebp
+  8025ba:	89 e5                	mov    %esp,%ebp
+  8025bc:	57                   	push   %edi
+  8025bd:	56                   	push   %esi
+  8025be:	53                   	push   %ebx
+  8025bf:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8025c2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8025c5:	50                   	push   %eax
+  8025c6:	ff 75 08             	push   0x8(%ebp)
+  8025c9:	e8 76 fe ff ff       	call   802444 <fd_lookup>
+  8025ce:	89 c3                	mov    %eax,%ebx
+  8025d0:	83 c4 10             	add    $0x10,%esp
+  8025d3:	85 c0                	test   %eax,%eax
+  8025d5:	78 7f                	js     802656 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8025d7:	83 ec 0c             	sub    $0xc,%esp
+  8025da:	ff 75 0c             	push   0xc(%ebp)
+  8025dd:	e8 85 ff ff ff       	call   802567 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8025e2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8025e5:	c1 e6 0c             	shl    $0xc,%esi
+  8025e8:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8025ee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8025f1:	89 3c 24             	mov    %edi,(%esp)
+  8025f4:	e8 e0 fd ff ff       	call   8023d9 <fd2data>
+  8025f9:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8025fb:	89 34 24             	mov    %esi,(%esp)
+  8025fe:	e8 d6 fd ff ff       	call   8023d9 <fd2data>
+  802603:	83 c4 10             	add    $0x10,%esp
+  802606:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802609:	89 d8                	mov    %ebx,%eax
+  80260b:	c1 e8 16             	shr    $0x16,%eax
+  80260e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802615:	a8 01                	test   $0x1,%al
+  802617:	74 11                	je     80262a <dup+0x71>
+  802619:	89 d8                	mov    %ebx,%eax
+  80261b:	c1 e8 0c             	shr    $0xc,%eax
+  80261e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802625:	f6 c2 01             	test   $0x1,%dl
+  802628:	75 36                	jne    802660 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80262a:	89 f8                	mov    %edi,%eax
+  80262c:	c1 e8 0c             	shr    $0xc,%eax
+  80262f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802636:	83 ec 0c             	sub    $0xc,%esp
+  802639:	25 07 0e 00 00       	and    $0xe07,%eax
+  80263e:	50                   	push   %eax
+  80263f:	56                   	push   %esi
+  802640:	6a 00                	push   $0x0
+  802642:	57                   	push   %edi
+  802643:	6a 00                	push   $0x0
+  802645:	e8 24 f1 ff ff       	call   80176e <sys_page_map>
+  80264a:	89 c3                	mov    %eax,%ebx
+  80264c:	83 c4 20             	add    $0x20,%esp
+  80264f:	85 c0                	test   %eax,%eax
+  802651:	78 33                	js     802686 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802653:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802656:	89 d8                	mov    %ebx,%eax
+  802658:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80265b:	5b                   	pop    %ebx
+  80265c:	5e                   	pop    %esi
+  80265d:	5f                   	pop    %edi
+  80265e:	5d                   	pop    %ebp
+  80265f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802660:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802667:	83 ec 0c             	sub    $0xc,%esp
+  80266a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80266f:	50                   	push   %eax
+  802670:	ff 75 d4             	push   -0x2c(%ebp)
+  802673:	6a 00                	push   $0x0
+  802675:	53                   	push   %ebx
+  802676:	6a 00                	push   $0x0
+  802678:	e8 f1 f0 ff ff       	call   80176e <sys_page_map>
+  80267d:	89 c3                	mov    %eax,%ebx
+  80267f:	83 c4 20             	add    $0x20,%esp
+  802682:	85 c0                	test   %eax,%eax
+  802684:	79 a4                	jns    80262a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802686:	83 ec 08             	sub    $0x8,%esp
+  802689:	56                   	push   %esi
+  80268a:	6a 00                	push   $0x0
+  80268c:	e8 1f f1 ff ff       	call   8017b0 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802691:	83 c4 08             	add    $0x8,%esp
+  802694:	ff 75 d4             	push   -0x2c(%ebp)
+  802697:	6a 00                	push   $0x0
+  802699:	e8 12 f1 ff ff       	call   8017b0 <sys_page_unmap>
+	return r;
+  80269e:	83 c4 10             	add    $0x10,%esp
+  8026a1:	eb b3                	jmp    802656 <dup+0x9d>
+
+008026a3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8026a3:	55                   	push   %ebp
+  8026a4:	89 e5                	mov    %esp,%ebp
+  8026a6:	56                   	push   %esi
+  8026a7:	53                   	push   %ebx
+  8026a8:	83 ec 18             	sub    $0x18,%esp
+  8026ab:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8026ae:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026b1:	50                   	push   %eax
+  8026b2:	56                   	push   %esi
+  8026b3:	e8 8c fd ff ff       	call   802444 <fd_lookup>
+  8026b8:	83 c4 10             	add    $0x10,%esp
+  8026bb:	85 c0                	test   %eax,%eax
+  8026bd:	78 3c                	js     8026fb <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8026bf:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8026c2:	83 ec 08             	sub    $0x8,%esp
+  8026c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026c8:	50                   	push   %eax
+  8026c9:	ff 33                	push   (%ebx)
+  8026cb:	e8 c4 fd ff ff       	call   802494 <dev_lookup>
+  8026d0:	83 c4 10             	add    $0x10,%esp
+  8026d3:	85 c0                	test   %eax,%eax
+  8026d5:	78 24                	js     8026fb <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8026d7:	8b 43 08             	mov    0x8(%ebx),%eax
+  8026da:	83 e0 03             	and    $0x3,%eax
+  8026dd:	83 f8 01             	cmp    $0x1,%eax
+  8026e0:	74 20                	je     802702 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8026e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026e5:	8b 40 08             	mov    0x8(%eax),%eax
+  8026e8:	85 c0                	test   %eax,%eax
+  8026ea:	74 37                	je     802723 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8026ec:	83 ec 04             	sub    $0x4,%esp
+  8026ef:	ff 75 10             	push   0x10(%ebp)
+  8026f2:	ff 75 0c             	push   0xc(%ebp)
+  8026f5:	53                   	push   %ebx
+  8026f6:	ff d0                	call   *%eax
+  8026f8:	83 c4 10             	add    $0x10,%esp
+}
+  8026fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026fe:	5b                   	pop    %ebx
+  8026ff:	5e                   	pop    %esi
+  802700:	5d                   	pop    %ebp
+  802701:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802702:	a1 18 09 81 00       	mov    0x810918,%eax
+  802707:	8b 40 48             	mov    0x48(%eax),%eax
+  80270a:	83 ec 04             	sub    $0x4,%esp
+  80270d:	56                   	push   %esi
+  80270e:	50                   	push   %eax
+  80270f:	68 19 6c 80 00       	push   $0x806c19
+  802714:	e8 48 e4 ff ff       	call   800b61 <cprintf>
+		return -E_INVAL;
+  802719:	83 c4 10             	add    $0x10,%esp
+  80271c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802721:	eb d8                	jmp    8026fb <read+0x58>
+		return -E_NOT_SUPP;
+  802723:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802728:	eb d1                	jmp    8026fb <read+0x58>
+
+0080272a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80272a:	55                   	push   %ebp
+  80272b:	89 e5                	mov    %esp,%ebp
+  80272d:	57                   	push   %edi
+  80272e:	56                   	push   %esi
+  80272f:	53                   	push   %ebx
+  802730:	83 ec 0c             	sub    $0xc,%esp
+  802733:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802736:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802739:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80273e:	eb 02                	jmp    802742 <readn+0x18>
+  802740:	01 c3                	add    %eax,%ebx
+  802742:	39 f3                	cmp    %esi,%ebx
+  802744:	73 21                	jae    802767 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802746:	83 ec 04             	sub    $0x4,%esp
+  802749:	89 f0                	mov    %esi,%eax
+  80274b:	29 d8                	sub    %ebx,%eax
+  80274d:	50                   	push   %eax
+  80274e:	89 d8                	mov    %ebx,%eax
+  802750:	03 45 0c             	add    0xc(%ebp),%eax
+  802753:	50                   	push   %eax
+  802754:	57                   	push   %edi
+  802755:	e8 49 ff ff ff       	call   8026a3 <read>
+		if (m < 0)
+  80275a:	83 c4 10             	add    $0x10,%esp
+  80275d:	85 c0                	test   %eax,%eax
+  80275f:	78 04                	js     802765 <readn+0x3b>
+			return m;
+		if (m == 0)
+  802761:	75 dd                	jne    802740 <readn+0x16>
+  802763:	eb 02                	jmp    802767 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802765:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802767:	89 d8                	mov    %ebx,%eax
+  802769:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80276c:	5b                   	pop    %ebx
+  80276d:	5e                   	pop    %esi
+  80276e:	5f                   	pop    %edi
+  80276f:	5d                   	pop    %ebp
+  802770:	c3                   	ret
+
+00802771 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802771:	55                   	push   %ebp
+  802772:	89 e5                	mov    %esp,%ebp
+  802774:	56                   	push   %esi
+  802775:	53                   	push   %ebx
+  802776:	83 ec 18             	sub    $0x18,%esp
+  802779:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80277c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80277f:	50                   	push   %eax
+  802780:	53                   	push   %ebx
+  802781:	e8 be fc ff ff       	call   802444 <fd_lookup>
+  802786:	83 c4 10             	add    $0x10,%esp
+  802789:	85 c0                	test   %eax,%eax
+  80278b:	78 37                	js     8027c4 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80278d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802790:	83 ec 08             	sub    $0x8,%esp
+  802793:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802796:	50                   	push   %eax
+  802797:	ff 36                	push   (%esi)
+  802799:	e8 f6 fc ff ff       	call   802494 <dev_lookup>
+  80279e:	83 c4 10             	add    $0x10,%esp
+  8027a1:	85 c0                	test   %eax,%eax
+  8027a3:	78 1f                	js     8027c4 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8027a5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8027a9:	74 20                	je     8027cb <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8027ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027ae:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027b1:	85 c0                	test   %eax,%eax
+  8027b3:	74 37                	je     8027ec <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8027b5:	83 ec 04             	sub    $0x4,%esp
+  8027b8:	ff 75 10             	push   0x10(%ebp)
+  8027bb:	ff 75 0c             	push   0xc(%ebp)
+  8027be:	56                   	push   %esi
+  8027bf:	ff d0                	call   *%eax
+  8027c1:	83 c4 10             	add    $0x10,%esp
+}
+  8027c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027c7:	5b                   	pop    %ebx
+  8027c8:	5e                   	pop    %esi
+  8027c9:	5d                   	pop    %ebp
+  8027ca:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8027cb:	a1 18 09 81 00       	mov    0x810918,%eax
+  8027d0:	8b 40 48             	mov    0x48(%eax),%eax
+  8027d3:	83 ec 04             	sub    $0x4,%esp
+  8027d6:	53                   	push   %ebx
+  8027d7:	50                   	push   %eax
+  8027d8:	68 35 6c 80 00       	push   $0x806c35
+  8027dd:	e8 7f e3 ff ff       	call   800b61 <cprintf>
+		return -E_INVAL;
+  8027e2:	83 c4 10             	add    $0x10,%esp
+  8027e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027ea:	eb d8                	jmp    8027c4 <write+0x53>
+		return -E_NOT_SUPP;
+  8027ec:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027f1:	eb d1                	jmp    8027c4 <write+0x53>
+
+008027f3 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8027f3:	55                   	push   %ebp
+  8027f4:	89 e5                	mov    %esp,%ebp
+  8027f6:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027fc:	50                   	push   %eax
+  8027fd:	ff 75 08             	push   0x8(%ebp)
+  802800:	e8 3f fc ff ff       	call   802444 <fd_lookup>
+  802805:	83 c4 10             	add    $0x10,%esp
+  802808:	85 c0                	test   %eax,%eax
+  80280a:	78 0e                	js     80281a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80280c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80280f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802812:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802815:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80281a:	c9                   	leave
+  80281b:	c3                   	ret
+
+0080281c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80281c:	55                   	push   %ebp
+  80281d:	89 e5                	mov    %esp,%ebp
+  80281f:	56                   	push   %esi
+  802820:	53                   	push   %ebx
+  802821:	83 ec 18             	sub    $0x18,%esp
+  802824:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802827:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80282a:	50                   	push   %eax
+  80282b:	53                   	push   %ebx
+  80282c:	e8 13 fc ff ff       	call   802444 <fd_lookup>
+  802831:	83 c4 10             	add    $0x10,%esp
+  802834:	85 c0                	test   %eax,%eax
+  802836:	78 34                	js     80286c <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802838:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80283b:	83 ec 08             	sub    $0x8,%esp
+  80283e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802841:	50                   	push   %eax
+  802842:	ff 36                	push   (%esi)
+  802844:	e8 4b fc ff ff       	call   802494 <dev_lookup>
+  802849:	83 c4 10             	add    $0x10,%esp
+  80284c:	85 c0                	test   %eax,%eax
+  80284e:	78 1c                	js     80286c <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802850:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802854:	74 1d                	je     802873 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802856:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802859:	8b 40 18             	mov    0x18(%eax),%eax
+  80285c:	85 c0                	test   %eax,%eax
+  80285e:	74 34                	je     802894 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802860:	83 ec 08             	sub    $0x8,%esp
+  802863:	ff 75 0c             	push   0xc(%ebp)
+  802866:	56                   	push   %esi
+  802867:	ff d0                	call   *%eax
+  802869:	83 c4 10             	add    $0x10,%esp
+}
+  80286c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80286f:	5b                   	pop    %ebx
+  802870:	5e                   	pop    %esi
+  802871:	5d                   	pop    %ebp
+  802872:	c3                   	ret
+			thisenv->env_id, fdnum);
+  802873:	a1 18 09 81 00       	mov    0x810918,%eax
+  802878:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80287b:	83 ec 04             	sub    $0x4,%esp
+  80287e:	53                   	push   %ebx
+  80287f:	50                   	push   %eax
+  802880:	68 f8 6b 80 00       	push   $0x806bf8
+  802885:	e8 d7 e2 ff ff       	call   800b61 <cprintf>
+		return -E_INVAL;
+  80288a:	83 c4 10             	add    $0x10,%esp
+  80288d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802892:	eb d8                	jmp    80286c <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802894:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802899:	eb d1                	jmp    80286c <ftruncate+0x50>
+
+0080289b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80289b:	55                   	push   %ebp
+  80289c:	89 e5                	mov    %esp,%ebp
+  80289e:	56                   	push   %esi
+  80289f:	53                   	push   %ebx
+  8028a0:	83 ec 18             	sub    $0x18,%esp
+  8028a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8028a6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8028a9:	50                   	push   %eax
+  8028aa:	ff 75 08             	push   0x8(%ebp)
+  8028ad:	e8 92 fb ff ff       	call   802444 <fd_lookup>
+  8028b2:	83 c4 10             	add    $0x10,%esp
+  8028b5:	85 c0                	test   %eax,%eax
+  8028b7:	78 49                	js     802902 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8028b9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8028bc:	83 ec 08             	sub    $0x8,%esp
+  8028bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028c2:	50                   	push   %eax
+  8028c3:	ff 36                	push   (%esi)
+  8028c5:	e8 ca fb ff ff       	call   802494 <dev_lookup>
+  8028ca:	83 c4 10             	add    $0x10,%esp
+  8028cd:	85 c0                	test   %eax,%eax
+  8028cf:	78 31                	js     802902 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8028d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028d4:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8028d8:	74 2f                	je     802909 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8028da:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8028dd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8028e4:	00 00 00 
+	stat->st_isdir = 0;
+  8028e7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8028ee:	00 00 00 
+	stat->st_dev = dev;
+  8028f1:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8028f7:	83 ec 08             	sub    $0x8,%esp
+  8028fa:	53                   	push   %ebx
+  8028fb:	56                   	push   %esi
+  8028fc:	ff 50 14             	call   *0x14(%eax)
+  8028ff:	83 c4 10             	add    $0x10,%esp
+}
+  802902:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802905:	5b                   	pop    %ebx
+  802906:	5e                   	pop    %esi
+  802907:	5d                   	pop    %ebp
+  802908:	c3                   	ret
+		return -E_NOT_SUPP;
+  802909:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80290e:	eb f2                	jmp    802902 <fstat+0x67>
+
+00802910 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802910:	55                   	push   %ebp
+  802911:	89 e5                	mov    %esp,%ebp
+  802913:	56                   	push   %esi
+  802914:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802915:	83 ec 08             	sub    $0x8,%esp
+  802918:	6a 00                	push   $0x0
+  80291a:	ff 75 08             	push   0x8(%ebp)
+  80291d:	e8 bc 02 00 00       	call   802bde <open>
+  802922:	89 c3                	mov    %eax,%ebx
+  802924:	83 c4 10             	add    $0x10,%esp
+  802927:	85 c0                	test   %eax,%eax
+  802929:	78 1b                	js     802946 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80292b:	83 ec 08             	sub    $0x8,%esp
+  80292e:	ff 75 0c             	push   0xc(%ebp)
+  802931:	50                   	push   %eax
+  802932:	e8 64 ff ff ff       	call   80289b <fstat>
+  802937:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802939:	89 1c 24             	mov    %ebx,(%esp)
+  80293c:	e8 26 fc ff ff       	call   802567 <close>
+	return r;
+  802941:	83 c4 10             	add    $0x10,%esp
+  802944:	89 f3                	mov    %esi,%ebx
+}
+  802946:	89 d8                	mov    %ebx,%eax
+  802948:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80294b:	5b                   	pop    %ebx
+  80294c:	5e                   	pop    %esi
+  80294d:	5d                   	pop    %ebp
+  80294e:	c3                   	ret
+
+0080294f <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  80294f:	55                   	push   %ebp
+  802950:	89 e5                	mov    %esp,%ebp
+  802952:	57                   	push   %edi
+  802953:	56                   	push   %esi
+  802954:	53                   	push   %ebx
+  802955:	83 ec 0c             	sub    $0xc,%esp
+  802958:	89 c7                	mov    %eax,%edi
+  80295a:	89 d3                	mov    %edx,%ebx
+  80295c:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80295e:	83 3d 20 94 80 00 00 	cmpl   $0x0,0x809420
+  802965:	74 2d                	je     802994 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802967:	6a 07                	push   $0x7
+  802969:	68 00 10 81 00       	push   $0x811000
+  80296e:	57                   	push   %edi
+  80296f:	ff 35 20 94 80 00    	push   0x809420
+  802975:	e8 30 38 00 00       	call   8061aa <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  80297a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802981:	6a 00                	push   $0x0
+  802983:	56                   	push   %esi
+  802984:	53                   	push   %ebx
+  802985:	6a 00                	push   $0x0
+  802987:	e8 d0 36 00 00       	call   80605c <ipc_recv_pages>
+}
+  80298c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80298f:	5b                   	pop    %ebx
+  802990:	5e                   	pop    %esi
+  802991:	5f                   	pop    %edi
+  802992:	5d                   	pop    %ebp
+  802993:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802994:	83 ec 0c             	sub    $0xc,%esp
+  802997:	6a 01                	push   $0x1
+  802999:	e8 01 39 00 00       	call   80629f <ipc_find_env>
+  80299e:	a3 20 94 80 00       	mov    %eax,0x809420
+  8029a3:	83 c4 10             	add    $0x10,%esp
+  8029a6:	eb bf                	jmp    802967 <fsipc_pages+0x18>
+
+008029a8 <fsipc>:
+{
+  8029a8:	55                   	push   %ebp
+  8029a9:	89 e5                	mov    %esp,%ebp
+  8029ab:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  8029ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8029b3:	e8 97 ff ff ff       	call   80294f <fsipc_pages>
+}
+  8029b8:	c9                   	leave
+  8029b9:	c3                   	ret
+
+008029ba <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8029ba:	55                   	push   %ebp
+  8029bb:	89 e5                	mov    %esp,%ebp
+  8029bd:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8029c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8029c6:	a3 00 10 81 00       	mov    %eax,0x811000
+	fsipcbuf.set_size.req_size = newsize;
+  8029cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029ce:	a3 04 10 81 00       	mov    %eax,0x811004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8029d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029d8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8029dd:	e8 c6 ff ff ff       	call   8029a8 <fsipc>
+}
+  8029e2:	c9                   	leave
+  8029e3:	c3                   	ret
+
+008029e4 <devfile_flush>:
+{
+  8029e4:	55                   	push   %ebp
+  8029e5:	89 e5                	mov    %esp,%ebp
+  8029e7:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8029ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ed:	8b 40 0c             	mov    0xc(%eax),%eax
+  8029f0:	a3 00 10 81 00       	mov    %eax,0x811000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8029f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029fa:	b8 06 00 00 00       	mov    $0x6,%eax
+  8029ff:	e8 a4 ff ff ff       	call   8029a8 <fsipc>
+}
+  802a04:	c9                   	leave
+  802a05:	c3                   	ret
+
+00802a06 <devfile_stat>:
+{
+  802a06:	55                   	push   %ebp
+  802a07:	89 e5                	mov    %esp,%ebp
+  802a09:	53                   	push   %ebx
+  802a0a:	83 ec 04             	sub    $0x4,%esp
+  802a0d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802a10:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a13:	8b 40 0c             	mov    0xc(%eax),%eax
+  802a16:	a3 00 10 81 00       	mov    %eax,0x811000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802a1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a20:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a25:	e8 7e ff ff ff       	call   8029a8 <fsipc>
+  802a2a:	85 c0                	test   %eax,%eax
+  802a2c:	78 2c                	js     802a5a <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802a2e:	83 ec 08             	sub    $0x8,%esp
+  802a31:	68 00 10 81 00       	push   $0x811000
+  802a36:	53                   	push   %ebx
+  802a37:	e8 fc e7 ff ff       	call   801238 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802a3c:	a1 80 10 81 00       	mov    0x811080,%eax
+  802a41:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802a47:	a1 84 10 81 00       	mov    0x811084,%eax
+  802a4c:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802a52:	83 c4 10             	add    $0x10,%esp
+  802a55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a5d:	c9                   	leave
+  802a5e:	c3                   	ret
+
+00802a5f <devfile_write>:
+{
+  802a5f:	55                   	push   %ebp
+  802a60:	89 e5                	mov    %esp,%ebp
+  802a62:	83 ec 0c             	sub    $0xc,%esp
+  802a65:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802a68:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802a6d:	39 d0                	cmp    %edx,%eax
+  802a6f:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802a72:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a75:	8b 52 0c             	mov    0xc(%edx),%edx
+  802a78:	89 15 00 10 81 00    	mov    %edx,0x811000
+	fsipcbuf.write.req_n = n;
+  802a7e:	a3 04 10 81 00       	mov    %eax,0x811004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  802a83:	50                   	push   %eax
+  802a84:	ff 75 0c             	push   0xc(%ebp)
+  802a87:	68 08 10 81 00       	push   $0x811008
+  802a8c:	e8 2d e9 ff ff       	call   8013be <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  802a91:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a96:	b8 04 00 00 00       	mov    $0x4,%eax
+  802a9b:	e8 08 ff ff ff       	call   8029a8 <fsipc>
+}
+  802aa0:	c9                   	leave
+  802aa1:	c3                   	ret
+
+00802aa2 <devfile_read>:
+{
+  802aa2:	55                   	push   %ebp
+  802aa3:	89 e5                	mov    %esp,%ebp
+  802aa5:	57                   	push   %edi
+  802aa6:	56                   	push   %esi
+  802aa7:	53                   	push   %ebx
+  802aa8:	83 ec 1c             	sub    $0x1c,%esp
+  802aab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802aae:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802ab1:	89 fe                	mov    %edi,%esi
+  802ab3:	c1 ee 0c             	shr    $0xc,%esi
+  802ab6:	b8 20 00 00 00       	mov    $0x20,%eax
+  802abb:	39 c6                	cmp    %eax,%esi
+  802abd:	0f 47 f0             	cmova  %eax,%esi
+  802ac0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ac3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ac8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802acb:	eb 14                	jmp    802ae1 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802acd:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  802ad4:	05 00 10 00 00       	add    $0x1000,%eax
+  802ad9:	f6 c6 06             	test   $0x6,%dh
+  802adc:	75 42                	jne    802b20 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802ade:	83 c1 01             	add    $0x1,%ecx
+  802ae1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802ae4:	39 f1                	cmp    %esi,%ecx
+  802ae6:	0f 84 95 00 00 00    	je     802b81 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  802aec:	89 c2                	mov    %eax,%edx
+  802aee:	c1 ea 16             	shr    $0x16,%edx
+  802af1:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802af8:	f6 c2 01             	test   $0x1,%dl
+  802afb:	74 23                	je     802b20 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  802afd:	89 c2                	mov    %eax,%edx
+  802aff:	c1 ea 0c             	shr    $0xc,%edx
+  802b02:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  802b09:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  802b0f:	74 0f                	je     802b20 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  802b11:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  802b18:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  802b1e:	75 ad                	jne    802acd <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  802b20:	85 c9                	test   %ecx,%ecx
+  802b22:	74 11                	je     802b35 <devfile_read+0x93>
+  802b24:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802b2b:	75 08                	jne    802b35 <devfile_read+0x93>
+  802b2d:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  802b33:	74 50                	je     802b85 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b35:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802b38:	a3 00 10 81 00       	mov    %eax,0x811000
+	fsipcbuf.read.req_n = n;
+  802b3d:	89 3d 04 10 81 00    	mov    %edi,0x811004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802b43:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b48:	b8 03 00 00 00       	mov    $0x3,%eax
+  802b4d:	e8 56 fe ff ff       	call   8029a8 <fsipc>
+  802b52:	89 c6                	mov    %eax,%esi
+  802b54:	85 c0                	test   %eax,%eax
+  802b56:	78 1f                	js     802b77 <devfile_read+0xd5>
+	assert(r <= n);
+  802b58:	39 c7                	cmp    %eax,%edi
+  802b5a:	72 50                	jb     802bac <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  802b5c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802b61:	7f 62                	jg     802bc5 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  802b63:	83 ec 04             	sub    $0x4,%esp
+  802b66:	50                   	push   %eax
+  802b67:	68 00 10 81 00       	push   $0x811000
+  802b6c:	ff 75 0c             	push   0xc(%ebp)
+  802b6f:	e8 4a e8 ff ff       	call   8013be <memmove>
+	return r;
+  802b74:	83 c4 10             	add    $0x10,%esp
+}
+  802b77:	89 f0                	mov    %esi,%eax
+  802b79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b7c:	5b                   	pop    %ebx
+  802b7d:	5e                   	pop    %esi
+  802b7e:	5f                   	pop    %edi
+  802b7f:	5d                   	pop    %ebp
+  802b80:	c3                   	ret
+  802b81:	89 f1                	mov    %esi,%ecx
+  802b83:	eb 9b                	jmp    802b20 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  802b85:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802b88:	a3 00 10 81 00       	mov    %eax,0x811000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  802b8d:	89 c8                	mov    %ecx,%eax
+  802b8f:	c1 e0 0c             	shl    $0xc,%eax
+  802b92:	a3 04 10 81 00       	mov    %eax,0x811004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  802b97:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b9a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802b9f:	e8 ab fd ff ff       	call   80294f <fsipc_pages>
+  802ba4:	89 c6                	mov    %eax,%esi
+  802ba6:	85 c0                	test   %eax,%eax
+  802ba8:	78 8b                	js     802b35 <devfile_read+0x93>
+  802baa:	eb cb                	jmp    802b77 <devfile_read+0xd5>
+	assert(r <= n);
+  802bac:	68 64 6c 80 00       	push   $0x806c64
+  802bb1:	68 6f 66 80 00       	push   $0x80666f
+  802bb6:	68 a0 00 00 00       	push   $0xa0
+  802bbb:	68 6b 6c 80 00       	push   $0x806c6b
+  802bc0:	e8 c1 de ff ff       	call   800a86 <_panic>
+	assert(r <= PGSIZE);
+  802bc5:	68 76 6c 80 00       	push   $0x806c76
+  802bca:	68 6f 66 80 00       	push   $0x80666f
+  802bcf:	68 a1 00 00 00       	push   $0xa1
+  802bd4:	68 6b 6c 80 00       	push   $0x806c6b
+  802bd9:	e8 a8 de ff ff       	call   800a86 <_panic>
+
+00802bde <open>:
+{
+  802bde:	55                   	push   %ebp
+  802bdf:	89 e5                	mov    %esp,%ebp
+  802be1:	56                   	push   %esi
+  802be2:	53                   	push   %ebx
+  802be3:	83 ec 1c             	sub    $0x1c,%esp
+  802be6:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802be9:	56                   	push   %esi
+  802bea:	e8 0e e6 ff ff       	call   8011fd <strlen>
+  802bef:	83 c4 10             	add    $0x10,%esp
+  802bf2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802bf7:	7f 6c                	jg     802c65 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802bf9:	83 ec 0c             	sub    $0xc,%esp
+  802bfc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bff:	50                   	push   %eax
+  802c00:	e8 eb f7 ff ff       	call   8023f0 <fd_alloc>
+  802c05:	89 c3                	mov    %eax,%ebx
+  802c07:	83 c4 10             	add    $0x10,%esp
+  802c0a:	85 c0                	test   %eax,%eax
+  802c0c:	78 3c                	js     802c4a <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802c0e:	83 ec 08             	sub    $0x8,%esp
+  802c11:	56                   	push   %esi
+  802c12:	68 00 10 81 00       	push   $0x811000
+  802c17:	e8 1c e6 ff ff       	call   801238 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802c1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c1f:	a3 00 14 81 00       	mov    %eax,0x811400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802c24:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802c27:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c2c:	e8 77 fd ff ff       	call   8029a8 <fsipc>
+  802c31:	89 c3                	mov    %eax,%ebx
+  802c33:	83 c4 10             	add    $0x10,%esp
+  802c36:	85 c0                	test   %eax,%eax
+  802c38:	78 19                	js     802c53 <open+0x75>
+	return fd2num(fd);
+  802c3a:	83 ec 0c             	sub    $0xc,%esp
+  802c3d:	ff 75 f4             	push   -0xc(%ebp)
+  802c40:	e8 84 f7 ff ff       	call   8023c9 <fd2num>
+  802c45:	89 c3                	mov    %eax,%ebx
+  802c47:	83 c4 10             	add    $0x10,%esp
+}
+  802c4a:	89 d8                	mov    %ebx,%eax
+  802c4c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c4f:	5b                   	pop    %ebx
+  802c50:	5e                   	pop    %esi
+  802c51:	5d                   	pop    %ebp
+  802c52:	c3                   	ret
+		fd_close(fd, 0);
+  802c53:	83 ec 08             	sub    $0x8,%esp
+  802c56:	6a 00                	push   $0x0
+  802c58:	ff 75 f4             	push   -0xc(%ebp)
+  802c5b:	e8 80 f8 ff ff       	call   8024e0 <fd_close>
+		return r;
+  802c60:	83 c4 10             	add    $0x10,%esp
+  802c63:	eb e5                	jmp    802c4a <open+0x6c>
+		return -E_BAD_PATH;
+  802c65:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802c6a:	eb de                	jmp    802c4a <open+0x6c>
+
+00802c6c <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802c6c:	55                   	push   %ebp
+  802c6d:	89 e5                	mov    %esp,%ebp
+  802c6f:	53                   	push   %ebx
+  802c70:	83 ec 10             	sub    $0x10,%esp
+  802c73:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802c76:	53                   	push   %ebx
+  802c77:	e8 81 e5 ff ff       	call   8011fd <strlen>
+  802c7c:	83 c4 10             	add    $0x10,%esp
+  802c7f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802c84:	7f 25                	jg     802cab <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802c86:	83 ec 08             	sub    $0x8,%esp
+  802c89:	53                   	push   %ebx
+  802c8a:	68 00 10 81 00       	push   $0x811000
+  802c8f:	e8 a4 e5 ff ff       	call   801238 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802c94:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c99:	b8 07 00 00 00       	mov    $0x7,%eax
+  802c9e:	e8 05 fd ff ff       	call   8029a8 <fsipc>
+  802ca3:	83 c4 10             	add    $0x10,%esp
+}
+  802ca6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ca9:	c9                   	leave
+  802caa:	c3                   	ret
+		return -E_BAD_PATH;
+  802cab:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802cb0:	eb f4                	jmp    802ca6 <remove+0x3a>
+
+00802cb2 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802cb2:	55                   	push   %ebp
+  802cb3:	89 e5                	mov    %esp,%ebp
+  802cb5:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802cb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cbd:	b8 08 00 00 00       	mov    $0x8,%eax
+  802cc2:	e8 e1 fc ff ff       	call   8029a8 <fsipc>
+}
+  802cc7:	c9                   	leave
+  802cc8:	c3                   	ret
+
+00802cc9 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  802cc9:	55                   	push   %ebp
+  802cca:	89 e5                	mov    %esp,%ebp
+  802ccc:	53                   	push   %ebx
+  802ccd:	83 ec 04             	sub    $0x4,%esp
+  802cd0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  802cd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cd8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802cdd:	e8 c6 fc ff ff       	call   8029a8 <fsipc>
+  802ce2:	85 c0                	test   %eax,%eax
+  802ce4:	78 3c                	js     802d22 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  802ce6:	a1 00 10 81 00       	mov    0x811000,%eax
+  802ceb:	89 03                	mov    %eax,(%ebx)
+  802ced:	a1 04 10 81 00       	mov    0x811004,%eax
+  802cf2:	89 43 04             	mov    %eax,0x4(%ebx)
+  802cf5:	a1 08 10 81 00       	mov    0x811008,%eax
+  802cfa:	89 43 08             	mov    %eax,0x8(%ebx)
+  802cfd:	a1 0c 10 81 00       	mov    0x81100c,%eax
+  802d02:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802d05:	a1 10 10 81 00       	mov    0x811010,%eax
+  802d0a:	89 43 10             	mov    %eax,0x10(%ebx)
+  802d0d:	a1 14 10 81 00       	mov    0x811014,%eax
+  802d12:	89 43 14             	mov    %eax,0x14(%ebx)
+  802d15:	a1 18 10 81 00       	mov    0x811018,%eax
+  802d1a:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  802d1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d25:	c9                   	leave
+  802d26:	c3                   	ret
+
+00802d27 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  802d27:	55                   	push   %ebp
+  802d28:	89 e5                	mov    %esp,%ebp
+  802d2a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  802d2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d30:	a3 00 10 81 00       	mov    %eax,0x811000
+	return fsipc(FSREQ_BCSET, NULL);
+  802d35:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d3a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802d3f:	e8 64 fc ff ff       	call   8029a8 <fsipc>
+}
+  802d44:	c9                   	leave
+  802d45:	c3                   	ret
+
+00802d46 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  802d46:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802d4a:	7f 01                	jg     802d4d <writebuf+0x7>
+  802d4c:	c3                   	ret
+{
+  802d4d:	55                   	push   %ebp
+  802d4e:	89 e5                	mov    %esp,%ebp
+  802d50:	53                   	push   %ebx
+  802d51:	83 ec 08             	sub    $0x8,%esp
+  802d54:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  802d56:	ff 70 04             	push   0x4(%eax)
+  802d59:	8d 40 10             	lea    0x10(%eax),%eax
+  802d5c:	50                   	push   %eax
+  802d5d:	ff 33                	push   (%ebx)
+  802d5f:	e8 0d fa ff ff       	call   802771 <write>
+		if (result > 0)
+  802d64:	83 c4 10             	add    $0x10,%esp
+  802d67:	85 c0                	test   %eax,%eax
+  802d69:	7e 03                	jle    802d6e <writebuf+0x28>
+			b->result += result;
+  802d6b:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802d6e:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802d71:	74 0d                	je     802d80 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802d73:	85 c0                	test   %eax,%eax
+  802d75:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d7a:	0f 4f c2             	cmovg  %edx,%eax
+  802d7d:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802d80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d83:	c9                   	leave
+  802d84:	c3                   	ret
+
+00802d85 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802d85:	55                   	push   %ebp
+  802d86:	89 e5                	mov    %esp,%ebp
+  802d88:	53                   	push   %ebx
+  802d89:	83 ec 04             	sub    $0x4,%esp
+  802d8c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802d8f:	8b 53 04             	mov    0x4(%ebx),%edx
+  802d92:	8d 42 01             	lea    0x1(%edx),%eax
+  802d95:	89 43 04             	mov    %eax,0x4(%ebx)
+  802d98:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d9b:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  802d9f:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802da4:	74 05                	je     802dab <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  802da6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802da9:	c9                   	leave
+  802daa:	c3                   	ret
+		writebuf(b);
+  802dab:	89 d8                	mov    %ebx,%eax
+  802dad:	e8 94 ff ff ff       	call   802d46 <writebuf>
+		b->idx = 0;
+  802db2:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  802db9:	eb eb                	jmp    802da6 <putch+0x21>
+
+00802dbb <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  802dbb:	55                   	push   %ebp
+  802dbc:	89 e5                	mov    %esp,%ebp
+  802dbe:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  802dc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc7:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  802dcd:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  802dd4:	00 00 00 
+	b.result = 0;
+  802dd7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802dde:	00 00 00 
+	b.error = 1;
+  802de1:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  802de8:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  802deb:	ff 75 10             	push   0x10(%ebp)
+  802dee:	ff 75 0c             	push   0xc(%ebp)
+  802df1:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802df7:	50                   	push   %eax
+  802df8:	68 85 2d 80 00       	push   $0x802d85
+  802dfd:	e8 56 de ff ff       	call   800c58 <vprintfmt>
+	if (b.idx > 0)
+  802e02:	83 c4 10             	add    $0x10,%esp
+  802e05:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  802e0c:	7f 12                	jg     802e20 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  802e0e:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  802e14:	85 c0                	test   %eax,%eax
+  802e16:	75 06                	jne    802e1e <vfprintf+0x63>
+  802e18:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  802e1e:	c9                   	leave
+  802e1f:	c3                   	ret
+		writebuf(&b);
+  802e20:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802e26:	e8 1b ff ff ff       	call   802d46 <writebuf>
+  802e2b:	eb e1                	jmp    802e0e <vfprintf+0x53>
+
+00802e2d <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  802e2d:	55                   	push   %ebp
+  802e2e:	89 e5                	mov    %esp,%ebp
+  802e30:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802e33:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  802e36:	50                   	push   %eax
+  802e37:	ff 75 0c             	push   0xc(%ebp)
+  802e3a:	ff 75 08             	push   0x8(%ebp)
+  802e3d:	e8 79 ff ff ff       	call   802dbb <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802e42:	c9                   	leave
+  802e43:	c3                   	ret
+
+00802e44 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  802e44:	55                   	push   %ebp
+  802e45:	89 e5                	mov    %esp,%ebp
+  802e47:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802e4a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  802e4d:	50                   	push   %eax
+  802e4e:	ff 75 08             	push   0x8(%ebp)
+  802e51:	6a 01                	push   $0x1
+  802e53:	e8 63 ff ff ff       	call   802dbb <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802e58:	c9                   	leave
+  802e59:	c3                   	ret
+
+00802e5a <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  802e5a:	55                   	push   %ebp
+  802e5b:	89 e5                	mov    %esp,%ebp
+  802e5d:	57                   	push   %edi
+  802e5e:	56                   	push   %esi
+  802e5f:	53                   	push   %ebx
+  802e60:	81 ec 14 03 00 00    	sub    $0x314,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  802e66:	6a 00                	push   $0x0
+  802e68:	ff 75 08             	push   0x8(%ebp)
+  802e6b:	e8 6e fd ff ff       	call   802bde <open>
+  802e70:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  802e76:	83 c4 10             	add    $0x10,%esp
+  802e79:	85 c0                	test   %eax,%eax
+  802e7b:	0f 88 06 06 00 00    	js     803487 <spawn+0x62d>
+  802e81:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802e83:	83 ec 04             	sub    $0x4,%esp
+  802e86:	68 00 02 00 00       	push   $0x200
+  802e8b:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802e91:	50                   	push   %eax
+  802e92:	51                   	push   %ecx
+  802e93:	e8 92 f8 ff ff       	call   80272a <readn>
+  802e98:	83 c4 10             	add    $0x10,%esp
+  802e9b:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802ea0:	75 74                	jne    802f16 <spawn+0xbc>
+	    || elf->e_magic != ELF_MAGIC) {
+  802ea2:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  802ea9:	45 4c 46 
+  802eac:	75 68                	jne    802f16 <spawn+0xbc>
+  802eae:	b8 07 00 00 00       	mov    $0x7,%eax
+  802eb3:	cd 30                	int    $0x30
+  802eb5:	89 85 0c fd ff ff    	mov    %eax,-0x2f4(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  802ebb:	85 c0                	test   %eax,%eax
+  802ebd:	0f 88 b8 05 00 00    	js     80347b <spawn+0x621>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  802ec3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802ec8:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  802ecb:	c1 e6 06             	shl    $0x6,%esi
+  802ece:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802ed4:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802eda:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802edf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  802ee1:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802ee7:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  802eed:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802ef2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802efa:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  802efd:	85 c0                	test   %eax,%eax
+  802eff:	74 4d                	je     802f4e <spawn+0xf4>
+		string_size += strlen(argv[argc]) + 1;
+  802f01:	83 ec 0c             	sub    $0xc,%esp
+  802f04:	50                   	push   %eax
+  802f05:	e8 f3 e2 ff ff       	call   8011fd <strlen>
+  802f0a:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802f0e:	83 c3 01             	add    $0x1,%ebx
+  802f11:	83 c4 10             	add    $0x10,%esp
+  802f14:	eb e4                	jmp    802efa <spawn+0xa0>
+		close(fd);
+  802f16:	83 ec 0c             	sub    $0xc,%esp
+  802f19:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  802f1f:	e8 43 f6 ff ff       	call   802567 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802f24:	83 c4 0c             	add    $0xc,%esp
+  802f27:	68 7f 45 4c 46       	push   $0x464c457f
+  802f2c:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802f32:	68 82 6c 80 00       	push   $0x806c82
+  802f37:	e8 25 dc ff ff       	call   800b61 <cprintf>
+		return -E_NOT_EXEC;
+  802f3c:	83 c4 10             	add    $0x10,%esp
+  802f3f:	c7 85 10 fd ff ff f2 	movl   $0xfffffff2,-0x2f0(%ebp)
+  802f46:	ff ff ff 
+  802f49:	e9 39 05 00 00       	jmp    803487 <spawn+0x62d>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802f4e:	89 9d 04 fd ff ff    	mov    %ebx,-0x2fc(%ebp)
+  802f54:	bf 00 10 40 00       	mov    $0x401000,%edi
+  802f59:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802f5b:	89 fa                	mov    %edi,%edx
+  802f5d:	83 e2 fc             	and    $0xfffffffc,%edx
+  802f60:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  802f67:	29 c2                	sub    %eax,%edx
+  802f69:	89 95 14 fd ff ff    	mov    %edx,-0x2ec(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  802f6f:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802f72:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802f77:	0f 86 18 05 00 00    	jbe    803495 <spawn+0x63b>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802f7d:	83 ec 04             	sub    $0x4,%esp
+  802f80:	6a 07                	push   $0x7
+  802f82:	68 00 00 40 00       	push   $0x400000
+  802f87:	6a 00                	push   $0x0
+  802f89:	e8 9d e7 ff ff       	call   80172b <sys_page_alloc>
+  802f8e:	83 c4 10             	add    $0x10,%esp
+  802f91:	85 c0                	test   %eax,%eax
+  802f93:	0f 88 01 05 00 00    	js     80349a <spawn+0x640>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  802f99:	be 00 00 00 00       	mov    $0x0,%esi
+  802f9e:	89 9d 08 fd ff ff    	mov    %ebx,-0x2f8(%ebp)
+  802fa4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802fa7:	eb 30                	jmp    802fd9 <spawn+0x17f>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  802fa9:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802faf:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  802fb5:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  802fb8:	83 ec 08             	sub    $0x8,%esp
+  802fbb:	ff 34 b3             	push   (%ebx,%esi,4)
+  802fbe:	57                   	push   %edi
+  802fbf:	e8 74 e2 ff ff       	call   801238 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  802fc4:	83 c4 04             	add    $0x4,%esp
+  802fc7:	ff 34 b3             	push   (%ebx,%esi,4)
+  802fca:	e8 2e e2 ff ff       	call   8011fd <strlen>
+  802fcf:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  802fd3:	83 c6 01             	add    $0x1,%esi
+  802fd6:	83 c4 10             	add    $0x10,%esp
+  802fd9:	39 b5 08 fd ff ff    	cmp    %esi,-0x2f8(%ebp)
+  802fdf:	7f c8                	jg     802fa9 <spawn+0x14f>
+	}
+	argv_store[argc] = 0;
+  802fe1:	8b 85 14 fd ff ff    	mov    -0x2ec(%ebp),%eax
+  802fe7:	8b 8d 04 fd ff ff    	mov    -0x2fc(%ebp),%ecx
+  802fed:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802ff4:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802ffa:	0f 85 fb 00 00 00    	jne    8030fb <spawn+0x2a1>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  803000:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  803006:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  80300c:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  80300f:	89 c8                	mov    %ecx,%eax
+  803011:	8b 8d 04 fd ff ff    	mov    -0x2fc(%ebp),%ecx
+  803017:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  80301a:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  80301f:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  803025:	83 ec 0c             	sub    $0xc,%esp
+  803028:	6a 07                	push   $0x7
+  80302a:	68 00 d0 bf ee       	push   $0xeebfd000
+  80302f:	8b b5 0c fd ff ff    	mov    -0x2f4(%ebp),%esi
+  803035:	56                   	push   %esi
+  803036:	68 00 00 40 00       	push   $0x400000
+  80303b:	6a 00                	push   $0x0
+  80303d:	e8 2c e7 ff ff       	call   80176e <sys_page_map>
+  803042:	89 c3                	mov    %eax,%ebx
+  803044:	83 c4 20             	add    $0x20,%esp
+  803047:	85 c0                	test   %eax,%eax
+  803049:	0f 88 53 04 00 00    	js     8034a2 <spawn+0x648>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80304f:	83 ec 08             	sub    $0x8,%esp
+  803052:	68 00 00 40 00       	push   $0x400000
+  803057:	6a 00                	push   $0x0
+  803059:	e8 52 e7 ff ff       	call   8017b0 <sys_page_unmap>
+  80305e:	89 c3                	mov    %eax,%ebx
+  803060:	83 c4 10             	add    $0x10,%esp
+  803063:	85 c0                	test   %eax,%eax
+  803065:	0f 88 37 04 00 00    	js     8034a2 <spawn+0x648>
+	if ((r = fd_lookup(fd, &fdp)) < 0)
+  80306b:	83 ec 08             	sub    $0x8,%esp
+  80306e:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  803074:	50                   	push   %eax
+  803075:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  80307b:	e8 c4 f3 ff ff       	call   802444 <fd_lookup>
+  803080:	89 c7                	mov    %eax,%edi
+  803082:	83 c4 10             	add    $0x10,%esp
+  803085:	85 c0                	test   %eax,%eax
+  803087:	0f 88 d6 01 00 00    	js     803263 <spawn+0x409>
+	if ((r = sys_page_map(0, fdp, child, (void*) PROGFD, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80308d:	83 ec 0c             	sub    $0xc,%esp
+  803090:	68 07 04 00 00       	push   $0x407
+  803095:	68 00 f0 ff cf       	push   $0xcffff000
+  80309a:	56                   	push   %esi
+  80309b:	ff b5 a0 fd ff ff    	push   -0x260(%ebp)
+  8030a1:	6a 00                	push   $0x0
+  8030a3:	e8 c6 e6 ff ff       	call   80176e <sys_page_map>
+  8030a8:	89 c7                	mov    %eax,%edi
+  8030aa:	83 c4 20             	add    $0x20,%esp
+  8030ad:	85 c0                	test   %eax,%eax
+  8030af:	0f 88 ae 01 00 00    	js     803263 <spawn+0x409>
+	pager = ipc_find_env(ENV_TYPE_FS);
+  8030b5:	83 ec 0c             	sub    $0xc,%esp
+  8030b8:	6a 01                	push   $0x1
+  8030ba:	e8 e0 31 00 00       	call   80629f <ipc_find_env>
+  8030bf:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%ebp)
+	memset(segs, 0, sizeof(segs));
+  8030c5:	83 c4 0c             	add    $0xc,%esp
+  8030c8:	68 80 00 00 00       	push   $0x80
+  8030cd:	6a 00                	push   $0x0
+  8030cf:	8d 9d 20 fd ff ff    	lea    -0x2e0(%ebp),%ebx
+  8030d5:	53                   	push   %ebx
+  8030d6:	e8 ae e2 ff ff       	call   801389 <memset>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  8030db:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  8030e1:	8d bc 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%edi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8030e8:	83 c4 10             	add    $0x10,%esp
+  8030eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030f0:	89 fe                	mov    %edi,%esi
+  8030f2:	89 d1                	mov    %edx,%ecx
+  8030f4:	89 da                	mov    %ebx,%edx
+  8030f6:	e9 bf 01 00 00       	jmp    8032ba <spawn+0x460>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  8030fb:	68 f8 6c 80 00       	push   $0x806cf8
+  803100:	68 6f 66 80 00       	push   $0x80666f
+  803105:	68 17 01 00 00       	push   $0x117
+  80310a:	68 9c 6c 80 00       	push   $0x806c9c
+  80310f:	e8 72 d9 ff ff       	call   800a86 <_panic>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  803114:	8b 5e 04             	mov    0x4(%esi),%ebx
+  803117:	89 9d 00 fd ff ff    	mov    %ebx,-0x300(%ebp)
+  80311d:	8b 46 10             	mov    0x10(%esi),%eax
+  803120:	89 85 14 fd ff ff    	mov    %eax,-0x2ec(%ebp)
+  803126:	8b 7e 14             	mov    0x14(%esi),%edi
+  803129:	89 bd 08 fd ff ff    	mov    %edi,-0x2f8(%ebp)
+  80312f:	8b 7e 08             	mov    0x8(%esi),%edi
+	int i, r;
+	void *blk;
+
+	//cprintf("map_segment %x+%x\n", va, memsz);
+
+	if ((i = PGOFF(va))) {
+  803132:	89 f8                	mov    %edi,%eax
+  803134:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803139:	74 16                	je     803151 <spawn+0x2f7>
+		va -= i;
+  80313b:	29 c7                	sub    %eax,%edi
+		memsz += i;
+  80313d:	01 85 08 fd ff ff    	add    %eax,-0x2f8(%ebp)
+		filesz += i;
+  803143:	01 85 14 fd ff ff    	add    %eax,-0x2ec(%ebp)
+		fileoffset -= i;
+  803149:	29 c3                	sub    %eax,%ebx
+  80314b:	89 9d 00 fd ff ff    	mov    %ebx,-0x300(%ebp)
+	}
+
+	for (i = 0; i < memsz; i += PGSIZE) {
+  803151:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803156:	89 8d fc fc ff ff    	mov    %ecx,-0x304(%ebp)
+  80315c:	89 b5 f8 fc ff ff    	mov    %esi,-0x308(%ebp)
+  803162:	8b b5 14 fd ff ff    	mov    -0x2ec(%ebp),%esi
+  803168:	89 95 f4 fc ff ff    	mov    %edx,-0x30c(%ebp)
+  80316e:	e9 ba 00 00 00       	jmp    80322d <spawn+0x3d3>
+			// allocate a blank page
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+				return r;
+		} else {
+			// from file
+			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  803173:	83 ec 04             	sub    $0x4,%esp
+  803176:	6a 07                	push   $0x7
+  803178:	68 00 00 40 00       	push   $0x400000
+  80317d:	6a 00                	push   $0x0
+  80317f:	e8 a7 e5 ff ff       	call   80172b <sys_page_alloc>
+  803184:	83 c4 10             	add    $0x10,%esp
+  803187:	85 c0                	test   %eax,%eax
+  803189:	0f 88 d7 02 00 00    	js     803466 <spawn+0x60c>
+				return r;
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  80318f:	83 ec 08             	sub    $0x8,%esp
+  803192:	8b 95 00 fd ff ff    	mov    -0x300(%ebp),%edx
+  803198:	8b 85 14 fd ff ff    	mov    -0x2ec(%ebp),%eax
+  80319e:	01 d0                	add    %edx,%eax
+  8031a0:	50                   	push   %eax
+  8031a1:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  8031a7:	e8 47 f6 ff ff       	call   8027f3 <seek>
+  8031ac:	83 c4 10             	add    $0x10,%esp
+  8031af:	85 c0                	test   %eax,%eax
+  8031b1:	0f 88 b6 02 00 00    	js     80346d <spawn+0x613>
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
+  8031b7:	83 ec 04             	sub    $0x4,%esp
+  8031ba:	89 f2                	mov    %esi,%edx
+  8031bc:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  8031c2:	29 ca                	sub    %ecx,%edx
+  8031c4:	89 d0                	mov    %edx,%eax
+  8031c6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031cb:	39 d0                	cmp    %edx,%eax
+  8031cd:	0f 47 c2             	cmova  %edx,%eax
+  8031d0:	50                   	push   %eax
+  8031d1:	68 00 00 40 00       	push   $0x400000
+  8031d6:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  8031dc:	e8 49 f5 ff ff       	call   80272a <readn>
+  8031e1:	83 c4 10             	add    $0x10,%esp
+  8031e4:	85 c0                	test   %eax,%eax
+  8031e6:	0f 88 88 02 00 00    	js     803474 <spawn+0x61a>
+				return r;
+			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
+  8031ec:	83 ec 0c             	sub    $0xc,%esp
+  8031ef:	ff b5 04 fd ff ff    	push   -0x2fc(%ebp)
+  8031f5:	57                   	push   %edi
+  8031f6:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  8031fc:	68 00 00 40 00       	push   $0x400000
+  803201:	6a 00                	push   $0x0
+  803203:	e8 66 e5 ff ff       	call   80176e <sys_page_map>
+  803208:	83 c4 20             	add    $0x20,%esp
+  80320b:	85 c0                	test   %eax,%eax
+  80320d:	78 7e                	js     80328d <spawn+0x433>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP);
+  80320f:	83 ec 08             	sub    $0x8,%esp
+  803212:	68 00 00 40 00       	push   $0x400000
+  803217:	6a 00                	push   $0x0
+  803219:	e8 92 e5 ff ff       	call   8017b0 <sys_page_unmap>
+  80321e:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < memsz; i += PGSIZE) {
+  803221:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803227:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80322d:	89 9d 14 fd ff ff    	mov    %ebx,-0x2ec(%ebp)
+  803233:	8b 85 08 fd ff ff    	mov    -0x2f8(%ebp),%eax
+  803239:	39 c3                	cmp    %eax,%ebx
+  80323b:	73 65                	jae    8032a2 <spawn+0x448>
+		if (i >= filesz) {
+  80323d:	39 f3                	cmp    %esi,%ebx
+  80323f:	0f 82 2e ff ff ff    	jb     803173 <spawn+0x319>
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  803245:	83 ec 04             	sub    $0x4,%esp
+  803248:	ff b5 04 fd ff ff    	push   -0x2fc(%ebp)
+  80324e:	57                   	push   %edi
+  80324f:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  803255:	e8 d1 e4 ff ff       	call   80172b <sys_page_alloc>
+  80325a:	83 c4 10             	add    $0x10,%esp
+  80325d:	85 c0                	test   %eax,%eax
+  80325f:	79 c0                	jns    803221 <spawn+0x3c7>
+  803261:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  803263:	83 ec 0c             	sub    $0xc,%esp
+  803266:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  80326c:	e8 3b e4 ff ff       	call   8016ac <sys_env_destroy>
+	close(fd);
+  803271:	83 c4 04             	add    $0x4,%esp
+  803274:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  80327a:	e8 e8 f2 ff ff       	call   802567 <close>
+	return r;
+  80327f:	83 c4 10             	add    $0x10,%esp
+  803282:	89 bd 10 fd ff ff    	mov    %edi,-0x2f0(%ebp)
+  803288:	e9 fa 01 00 00       	jmp    803487 <spawn+0x62d>
+				panic("spawn: sys_page_map data: %e", r);
+  80328d:	50                   	push   %eax
+  80328e:	68 a8 6c 80 00       	push   $0x806ca8
+  803293:	68 4a 01 00 00       	push   $0x14a
+  803298:	68 9c 6c 80 00       	push   $0x806c9c
+  80329d:	e8 e4 d7 ff ff       	call   800a86 <_panic>
+  8032a2:	8b 8d fc fc ff ff    	mov    -0x304(%ebp),%ecx
+  8032a8:	8b b5 f8 fc ff ff    	mov    -0x308(%ebp),%esi
+  8032ae:	8b 95 f4 fc ff ff    	mov    -0x30c(%ebp),%edx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8032b4:	83 c1 01             	add    $0x1,%ecx
+  8032b7:	83 c6 20             	add    $0x20,%esi
+  8032ba:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8032c1:	39 c8                	cmp    %ecx,%eax
+  8032c3:	7e 74                	jle    803339 <spawn+0x4df>
+		if (ph->p_type != ELF_PROG_LOAD)
+  8032c5:	83 3e 01             	cmpl   $0x1,(%esi)
+  8032c8:	75 ea                	jne    8032b4 <spawn+0x45a>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8032ca:	8b 46 18             	mov    0x18(%esi),%eax
+  8032cd:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  8032d0:	83 f8 01             	cmp    $0x1,%eax
+  8032d3:	19 ff                	sbb    %edi,%edi
+  8032d5:	83 e7 fe             	and    $0xfffffffe,%edi
+  8032d8:	83 c7 07             	add    $0x7,%edi
+  8032db:	89 bd 04 fd ff ff    	mov    %edi,-0x2fc(%ebp)
+		if (seg < segs + NSEGS) {
+  8032e1:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  8032e7:	39 c2                	cmp    %eax,%edx
+  8032e9:	0f 83 25 fe ff ff    	jae    803114 <spawn+0x2ba>
+			seg->seg_va = ROUNDDOWN(ph->p_va, PGSIZE);
+  8032ef:	8b 46 08             	mov    0x8(%esi),%eax
+  8032f2:	89 c3                	mov    %eax,%ebx
+  8032f4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8032fa:	89 1a                	mov    %ebx,(%edx)
+			seg->seg_memsz = ph->p_memsz + PGOFF(ph->p_va);
+  8032fc:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803301:	89 c3                	mov    %eax,%ebx
+  803303:	03 5e 14             	add    0x14(%esi),%ebx
+  803306:	89 5a 04             	mov    %ebx,0x4(%edx)
+			seg->seg_filesz = ph->p_filesz + PGOFF(ph->p_va);
+  803309:	89 c3                	mov    %eax,%ebx
+  80330b:	03 5e 10             	add    0x10(%esi),%ebx
+  80330e:	89 5a 08             	mov    %ebx,0x8(%edx)
+			seg->seg_offset = ph->p_offset - PGOFF(ph->p_va);
+  803311:	8b 5e 04             	mov    0x4(%esi),%ebx
+  803314:	29 c3                	sub    %eax,%ebx
+  803316:	89 5a 0c             	mov    %ebx,0xc(%edx)
+			seg->seg_perm = perm;
+  803319:	89 7a 10             	mov    %edi,0x10(%edx)
+			seg->seg_pager = pager;
+  80331c:	8b 85 f0 fc ff ff    	mov    -0x310(%ebp),%eax
+  803322:	89 42 14             	mov    %eax,0x14(%edx)
+			seg->seg_fileid = fdp->fd_file.id;
+  803325:	8b 85 a0 fd ff ff    	mov    -0x260(%ebp),%eax
+  80332b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80332e:	89 42 18             	mov    %eax,0x18(%edx)
+			seg++;
+  803331:	83 c2 20             	add    $0x20,%edx
+			continue;
+  803334:	e9 7b ff ff ff       	jmp    8032b4 <spawn+0x45a>
+	if ((r = sys_env_set_segments(child, segs, seg - segs)) < 0)
+  803339:	89 d1                	mov    %edx,%ecx
+  80333b:	83 ec 04             	sub    $0x4,%esp
+  80333e:	8d 95 20 fd ff ff    	lea    -0x2e0(%ebp),%edx
+  803344:	89 c8                	mov    %ecx,%eax
+  803346:	29 d0                	sub    %edx,%eax
+  803348:	c1 f8 05             	sar    $0x5,%eax
+  80334b:	50                   	push   %eax
+  80334c:	52                   	push   %edx
+  80334d:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  803353:	e8 e5 e6 ff ff       	call   801a3d <sys_env_set_segments>
+  803358:	89 c7                	mov    %eax,%edi
+  80335a:	83 c4 10             	add    $0x10,%esp
+  80335d:	85 c0                	test   %eax,%eax
+  80335f:	0f 88 fe fe ff ff    	js     803263 <spawn+0x409>
+	close(fd);
+  803365:	83 ec 0c             	sub    $0xc,%esp
+  803368:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  80336e:	e8 f4 f1 ff ff       	call   802567 <close>
+  803373:	83 c4 10             	add    $0x10,%esp
+	// Copy the mappings for shared pages into the child address.
+	// We need to iterate through all PTEs for addresses below UTOP.
+	// However, we handle the exception stack separately, so we only need to iterate up until UXSTACKTOP-PGSIZE.
+	// Since [USTACKTOP, UXSTACKTOP-PGSIZE) is empty memory, we can get away with only iterating up until USTACKTOP.
+	// This is the same as iterating through pages 0 through PGNUM(USTACKTOP)-1 inclusive.
+	for (pn = 0; pn < PGNUM(USTACKTOP); ++pn) {
+  803376:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80337b:	eb 2d                	jmp    8033aa <spawn+0x550>
+		// We only copy this page if it is present and readable in user mode, and if it is a shared page.
+		// This requires checking for PTE_P and PTE_U not only in uvpt[pn],
+		// but in the associated PDE as well, since page pn won't exist if its page table doesn't exist, i.e. if it isn't present in the page directory.
+		// Large pages are never shared (see sys_page_alloc), and have no uvpt entries.
+		if (((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U) && !(uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U) && (uvpt[pn]&PTE_SHARE))) {
+			sys_page_map(0, (void *)PGADDR(0,pn,0), child, (void *)PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL);
+  80337d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803384:	83 ec 0c             	sub    $0xc,%esp
+  803387:	25 07 0e 00 00       	and    $0xe07,%eax
+  80338c:	50                   	push   %eax
+  80338d:	52                   	push   %edx
+  80338e:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  803394:	52                   	push   %edx
+  803395:	6a 00                	push   $0x0
+  803397:	e8 d2 e3 ff ff       	call   80176e <sys_page_map>
+  80339c:	83 c4 20             	add    $0x20,%esp
+	for (pn = 0; pn < PGNUM(USTACKTOP); ++pn) {
+  80339f:	83 c3 01             	add    $0x1,%ebx
+  8033a2:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  8033a8:	74 51                	je     8033fb <spawn+0x5a1>
+		if (((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U) && !(uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U) && (uvpt[pn]&PTE_SHARE))) {
+  8033aa:	89 da                	mov    %ebx,%edx
+  8033ac:	c1 e2 0c             	shl    $0xc,%edx
+  8033af:	89 d0                	mov    %edx,%eax
+  8033b1:	c1 e8 16             	shr    $0x16,%eax
+  8033b4:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8033bb:	f6 c1 01             	test   $0x1,%cl
+  8033be:	74 df                	je     80339f <spawn+0x545>
+  8033c0:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8033c7:	f6 c1 04             	test   $0x4,%cl
+  8033ca:	74 d3                	je     80339f <spawn+0x545>
+  8033cc:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8033d3:	a8 80                	test   $0x80,%al
+  8033d5:	75 c8                	jne    80339f <spawn+0x545>
+  8033d7:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8033de:	a8 01                	test   $0x1,%al
+  8033e0:	74 bd                	je     80339f <spawn+0x545>
+  8033e2:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8033e9:	a8 04                	test   $0x4,%al
+  8033eb:	74 b2                	je     80339f <spawn+0x545>
+  8033ed:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8033f4:	f6 c4 04             	test   $0x4,%ah
+  8033f7:	74 a6                	je     80339f <spawn+0x545>
+  8033f9:	eb 82                	jmp    80337d <spawn+0x523>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8033fb:	83 ec 08             	sub    $0x8,%esp
+  8033fe:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  803404:	50                   	push   %eax
+  803405:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  80340b:	e8 9b e5 ff ff       	call   8019ab <sys_env_set_trapframe>
+  803410:	83 c4 10             	add    $0x10,%esp
+  803413:	85 c0                	test   %eax,%eax
+  803415:	78 25                	js     80343c <spawn+0x5e2>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  803417:	83 ec 08             	sub    $0x8,%esp
+  80341a:	6a 02                	push   $0x2
+  80341c:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  803422:	e8 42 e5 ff ff       	call   801969 <sys_env_set_status>
+  803427:	83 c4 10             	add    $0x10,%esp
+  80342a:	85 c0                	test   %eax,%eax
+  80342c:	78 23                	js     803451 <spawn+0x5f7>
+	return child;
+  80342e:	8b 85 0c fd ff ff    	mov    -0x2f4(%ebp),%eax
+  803434:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  80343a:	eb 4b                	jmp    803487 <spawn+0x62d>
+		panic("sys_env_set_trapframe: %e", r);
+  80343c:	50                   	push   %eax
+  80343d:	68 c5 6c 80 00       	push   $0x806cc5
+  803442:	68 ab 00 00 00       	push   $0xab
+  803447:	68 9c 6c 80 00       	push   $0x806c9c
+  80344c:	e8 35 d6 ff ff       	call   800a86 <_panic>
+		panic("sys_env_set_status: %e", r);
+  803451:	50                   	push   %eax
+  803452:	68 df 6c 80 00       	push   $0x806cdf
+  803457:	68 ae 00 00 00       	push   $0xae
+  80345c:	68 9c 6c 80 00       	push   $0x806c9c
+  803461:	e8 20 d6 ff ff       	call   800a86 <_panic>
+  803466:	89 c7                	mov    %eax,%edi
+  803468:	e9 f6 fd ff ff       	jmp    803263 <spawn+0x409>
+  80346d:	89 c7                	mov    %eax,%edi
+  80346f:	e9 ef fd ff ff       	jmp    803263 <spawn+0x409>
+  803474:	89 c7                	mov    %eax,%edi
+  803476:	e9 e8 fd ff ff       	jmp    803263 <spawn+0x409>
+		return r;
+  80347b:	8b 85 0c fd ff ff    	mov    -0x2f4(%ebp),%eax
+  803481:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+}
+  803487:	8b 85 10 fd ff ff    	mov    -0x2f0(%ebp),%eax
+  80348d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803490:	5b                   	pop    %ebx
+  803491:	5e                   	pop    %esi
+  803492:	5f                   	pop    %edi
+  803493:	5d                   	pop    %ebp
+  803494:	c3                   	ret
+		return -E_NO_MEM;
+  803495:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  80349a:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  8034a0:	eb e5                	jmp    803487 <spawn+0x62d>
+	sys_page_unmap(0, UTEMP);
+  8034a2:	83 ec 08             	sub    $0x8,%esp
+  8034a5:	68 00 00 40 00       	push   $0x400000
+  8034aa:	6a 00                	push   $0x0
+  8034ac:	e8 ff e2 ff ff       	call   8017b0 <sys_page_unmap>
+  8034b1:	83 c4 10             	add    $0x10,%esp
+  8034b4:	89 9d 10 fd ff ff    	mov    %ebx,-0x2f0(%ebp)
+  8034ba:	eb cb                	jmp    803487 <spawn+0x62d>
+
+008034bc <spawnl>:
+{
+  8034bc:	55                   	push   %ebp
+  8034bd:	89 e5                	mov    %esp,%ebp
+  8034bf:	56                   	push   %esi
+  8034c0:	53                   	push   %ebx
+	va_start(vl, arg0);
+  8034c1:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  8034c4:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  8034c9:	eb 05                	jmp    8034d0 <spawnl+0x14>
+		argc++;
+  8034cb:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  8034ce:	89 ca                	mov    %ecx,%edx
+  8034d0:	8d 4a 04             	lea    0x4(%edx),%ecx
+  8034d3:	83 3a 00             	cmpl   $0x0,(%edx)
+  8034d6:	75 f3                	jne    8034cb <spawnl+0xf>
+	const char *argv[argc+2];
+  8034d8:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  8034df:	83 e2 f0             	and    $0xfffffff0,%edx
+  8034e2:	29 d4                	sub    %edx,%esp
+  8034e4:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  8034e8:	89 da                	mov    %ebx,%edx
+  8034ea:	c1 ea 02             	shr    $0x2,%edx
+  8034ed:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  8034f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8034f3:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  8034fa:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  803501:	00 
+	va_start(vl, arg0);
+  803502:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  803505:	89 c2                	mov    %eax,%edx
+  803507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80350c:	eb 0b                	jmp    803519 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  80350e:	83 c0 01             	add    $0x1,%eax
+  803511:	8b 31                	mov    (%ecx),%esi
+  803513:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  803516:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  803519:	39 d0                	cmp    %edx,%eax
+  80351b:	75 f1                	jne    80350e <spawnl+0x52>
+	return spawn(prog, argv);
+  80351d:	83 ec 08             	sub    $0x8,%esp
+  803520:	53                   	push   %ebx
+  803521:	ff 75 08             	push   0x8(%ebp)
+  803524:	e8 31 f9 ff ff       	call   802e5a <spawn>
+}
+  803529:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80352c:	5b                   	pop    %ebx
+  80352d:	5e                   	pop    %esi
+  80352e:	5d                   	pop    %ebp
+  80352f:	c3                   	ret
+
+00803530 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803530:	55                   	push   %ebp
+  803531:	89 e5                	mov    %esp,%ebp
+  803533:	56                   	push   %esi
+  803534:	53                   	push   %ebx
+  803535:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803538:	83 ec 0c             	sub    $0xc,%esp
+  80353b:	ff 75 08             	push   0x8(%ebp)
+  80353e:	e8 96 ee ff ff       	call   8023d9 <fd2data>
+  803543:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803545:	83 c4 08             	add    $0x8,%esp
+  803548:	68 1e 6d 80 00       	push   $0x806d1e
+  80354d:	53                   	push   %ebx
+  80354e:	e8 e5 dc ff ff       	call   801238 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  803553:	8b 46 04             	mov    0x4(%esi),%eax
+  803556:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  80355c:	2b 0e                	sub    (%esi),%ecx
+  80355e:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803563:	89 c8                	mov    %ecx,%eax
+  803565:	f7 e2                	mul    %edx
+  803567:	c1 ea 0c             	shr    $0xc,%edx
+  80356a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803570:	29 d1                	sub    %edx,%ecx
+  803572:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  803578:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80357f:	00 00 00 
+	stat->st_dev = &devpipe;
+  803582:	c7 83 88 00 00 00 3c 	movl   $0x80803c,0x88(%ebx)
+  803589:	80 80 00 
+	return 0;
+}
+  80358c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803591:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803594:	5b                   	pop    %ebx
+  803595:	5e                   	pop    %esi
+  803596:	5d                   	pop    %ebp
+  803597:	c3                   	ret
+
+00803598 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803598:	55                   	push   %ebp
+  803599:	89 e5                	mov    %esp,%ebp
+  80359b:	53                   	push   %ebx
+  80359c:	83 ec 0c             	sub    $0xc,%esp
+  80359f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8035a2:	53                   	push   %ebx
+  8035a3:	6a 00                	push   $0x0
+  8035a5:	e8 06 e2 ff ff       	call   8017b0 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8035aa:	89 1c 24             	mov    %ebx,(%esp)
+  8035ad:	e8 27 ee ff ff       	call   8023d9 <fd2data>
+  8035b2:	83 c4 08             	add    $0x8,%esp
+  8035b5:	50                   	push   %eax
+  8035b6:	6a 00                	push   $0x0
+  8035b8:	e8 f3 e1 ff ff       	call   8017b0 <sys_page_unmap>
+}
+  8035bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035c0:	c9                   	leave
+  8035c1:	c3                   	ret
+
+008035c2 <_pipeisclosed>:
+{
+  8035c2:	55                   	push   %ebp
+  8035c3:	89 e5                	mov    %esp,%ebp
+  8035c5:	57                   	push   %edi
+  8035c6:	56                   	push   %esi
+  8035c7:	53                   	push   %ebx
+  8035c8:	83 ec 1c             	sub    $0x1c,%esp
+  8035cb:	89 c7                	mov    %eax,%edi
+  8035cd:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8035cf:	a1 18 09 81 00       	mov    0x810918,%eax
+  8035d4:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8035d7:	83 ec 0c             	sub    $0xc,%esp
+  8035da:	57                   	push   %edi
+  8035db:	e8 fe 2c 00 00       	call   8062de <pageref>
+  8035e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8035e3:	89 34 24             	mov    %esi,(%esp)
+  8035e6:	e8 f3 2c 00 00       	call   8062de <pageref>
+		nn = thisenv->env_runs;
+  8035eb:	8b 15 18 09 81 00    	mov    0x810918,%edx
+  8035f1:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8035f4:	83 c4 10             	add    $0x10,%esp
+  8035f7:	39 cb                	cmp    %ecx,%ebx
+  8035f9:	74 1b                	je     803616 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8035fb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8035fe:	75 cf                	jne    8035cf <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803600:	8b 42 58             	mov    0x58(%edx),%eax
+  803603:	6a 01                	push   $0x1
+  803605:	50                   	push   %eax
+  803606:	53                   	push   %ebx
+  803607:	68 25 6d 80 00       	push   $0x806d25
+  80360c:	e8 50 d5 ff ff       	call   800b61 <cprintf>
+  803611:	83 c4 10             	add    $0x10,%esp
+  803614:	eb b9                	jmp    8035cf <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  803616:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803619:	0f 94 c0             	sete   %al
+  80361c:	0f b6 c0             	movzbl %al,%eax
+}
+  80361f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803622:	5b                   	pop    %ebx
+  803623:	5e                   	pop    %esi
+  803624:	5f                   	pop    %edi
+  803625:	5d                   	pop    %ebp
+  803626:	c3                   	ret
+
+00803627 <devpipe_read>:
+{
+  803627:	55                   	push   %ebp
+  803628:	89 e5                	mov    %esp,%ebp
+  80362a:	57                   	push   %edi
+  80362b:	56                   	push   %esi
+  80362c:	53                   	push   %ebx
+  80362d:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803630:	ff 75 08             	push   0x8(%ebp)
+  803633:	e8 a1 ed ff ff       	call   8023d9 <fd2data>
+  803638:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  80363a:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  80363d:	8d 40 04             	lea    0x4(%eax),%eax
+  803640:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  803643:	8b 7b 04             	mov    0x4(%ebx),%edi
+  803646:	8b 0b                	mov    (%ebx),%ecx
+  803648:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  80364e:	29 ce                	sub    %ecx,%esi
+  803650:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803655:	f7 e6                	mul    %esi
+  803657:	c1 ea 0c             	shr    $0xc,%edx
+  80365a:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  803660:	29 c6                	sub    %eax,%esi
+  803662:	89 f2                	mov    %esi,%edx
+  803664:	75 43                	jne    8036a9 <devpipe_read+0x82>
+		ref = pageref(p);
+  803666:	83 ec 0c             	sub    $0xc,%esp
+  803669:	53                   	push   %ebx
+  80366a:	e8 6f 2c 00 00       	call   8062de <pageref>
+  80366f:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  803671:	89 da                	mov    %ebx,%edx
+  803673:	8b 45 08             	mov    0x8(%ebp),%eax
+  803676:	e8 47 ff ff ff       	call   8035c2 <_pipeisclosed>
+  80367b:	83 c4 10             	add    $0x10,%esp
+  80367e:	85 c0                	test   %eax,%eax
+  803680:	0f 85 c1 00 00 00    	jne    803747 <devpipe_read+0x120>
+	*sleeping = 1;
+  803686:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  80368d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  803692:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  803695:	75 ac                	jne    803643 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  803697:	83 ec 04             	sub    $0x4,%esp
+  80369a:	56                   	push   %esi
+  80369b:	57                   	push   %edi
+  80369c:	ff 75 e4             	push   -0x1c(%ebp)
+  80369f:	e8 60 e5 ff ff       	call   801c04 <sys_futex_wait>
+  8036a4:	83 c4 10             	add    $0x10,%esp
+  8036a7:	eb 9a                	jmp    803643 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  8036a9:	39 75 10             	cmp    %esi,0x10(%ebp)
+  8036ac:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  8036b0:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8036b2:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8036b7:	f7 e1                	mul    %ecx
+  8036b9:	c1 ea 0b             	shr    $0xb,%edx
+  8036bc:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8036c2:	29 c1                	sub    %eax,%ecx
+  8036c4:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  8036c6:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8036cb:	29 cf                	sub    %ecx,%edi
+  8036cd:	39 f7                	cmp    %esi,%edi
+  8036cf:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  8036d2:	8d 43 10             	lea    0x10(%ebx),%eax
+  8036d5:	83 ec 04             	sub    $0x4,%esp
+  8036d8:	57                   	push   %edi
+  8036d9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8036dc:	01 c2                	add    %eax,%edx
+  8036de:	52                   	push   %edx
+  8036df:	ff 75 0c             	push   0xc(%ebp)
+  8036e2:	e8 d7 dc ff ff       	call   8013be <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  8036e7:	83 c4 0c             	add    $0xc,%esp
+  8036ea:	89 f1                	mov    %esi,%ecx
+  8036ec:	29 f9                	sub    %edi,%ecx
+  8036ee:	51                   	push   %ecx
+  8036ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8036f2:	89 f8                	mov    %edi,%eax
+  8036f4:	03 45 0c             	add    0xc(%ebp),%eax
+  8036f7:	50                   	push   %eax
+  8036f8:	e8 c1 dc ff ff       	call   8013be <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  8036fd:	89 f1                	mov    %esi,%ecx
+  8036ff:	03 0b                	add    (%ebx),%ecx
+  803701:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803706:	f7 e1                	mul    %ecx
+  803708:	c1 ea 0c             	shr    $0xc,%edx
+  80370b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803711:	29 d1                	sub    %edx,%ecx
+  803713:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  803715:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80371a:	83 c4 10             	add    $0x10,%esp
+  80371d:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  803721:	75 0a                	jne    80372d <devpipe_read+0x106>
+	return n;
+  803723:	89 f0                	mov    %esi,%eax
+}
+  803725:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803728:	5b                   	pop    %ebx
+  803729:	5e                   	pop    %esi
+  80372a:	5f                   	pop    %edi
+  80372b:	5d                   	pop    %ebp
+  80372c:	c3                   	ret
+		*sleeping = 0;
+  80372d:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  803734:	83 ec 08             	sub    $0x8,%esp
+  803737:	68 00 04 00 00       	push   $0x400
+  80373c:	53                   	push   %ebx
+  80373d:	e8 12 e5 ff ff       	call   801c54 <sys_futex_wake>
+  803742:	83 c4 10             	add    $0x10,%esp
+  803745:	eb dc                	jmp    803723 <devpipe_read+0xfc>
+			return 0;
+  803747:	b8 00 00 00 00       	mov    $0x0,%eax
+  80374c:	eb d7                	jmp    803725 <devpipe_read+0xfe>
+
+0080374e <devpipe_write>:
+{
+  80374e:	55                   	push   %ebp
+  80374f:	89 e5                	mov    %esp,%ebp
+  803751:	57                   	push   %edi
+  803752:	56                   	push   %esi
+  803753:	53                   	push   %ebx
+  803754:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803757:	ff 75 08             	push   0x8(%ebp)
+  80375a:	e8 7a ec ff ff       	call   8023d9 <fd2data>
+  80375f:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  803761:	83 c4 10             	add    $0x10,%esp
+  803764:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80376b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80376e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803771:	0f 83 23 01 00 00    	jae    80389a <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  803777:	8b 77 04             	mov    0x4(%edi),%esi
+  80377a:	8b 1f                	mov    (%edi),%ebx
+  80377c:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  803782:	29 d9                	sub    %ebx,%ecx
+  803784:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803789:	f7 e1                	mul    %ecx
+  80378b:	c1 ea 0c             	shr    $0xc,%edx
+  80378e:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803794:	29 c1                	sub    %eax,%ecx
+  803796:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803798:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80379e:	75 40                	jne    8037e0 <devpipe_write+0x92>
+			ref = pageref(p);
+  8037a0:	83 ec 0c             	sub    $0xc,%esp
+  8037a3:	57                   	push   %edi
+  8037a4:	e8 35 2b 00 00       	call   8062de <pageref>
+  8037a9:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  8037ab:	89 fa                	mov    %edi,%edx
+  8037ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037b0:	e8 0d fe ff ff       	call   8035c2 <_pipeisclosed>
+  8037b5:	83 c4 10             	add    $0x10,%esp
+  8037b8:	85 c0                	test   %eax,%eax
+  8037ba:	0f 85 d5 00 00 00    	jne    803895 <devpipe_write+0x147>
+	*sleeping = 1;
+  8037c0:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  8037c7:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8037cc:	39 1f                	cmp    %ebx,(%edi)
+  8037ce:	75 a7                	jne    803777 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  8037d0:	83 ec 04             	sub    $0x4,%esp
+  8037d3:	56                   	push   %esi
+  8037d4:	53                   	push   %ebx
+  8037d5:	57                   	push   %edi
+  8037d6:	e8 29 e4 ff ff       	call   801c04 <sys_futex_wait>
+  8037db:	83 c4 10             	add    $0x10,%esp
+  8037de:	eb 97                	jmp    803777 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8037e0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8037e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8037e6:	29 c1                	sub    %eax,%ecx
+  8037e8:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8037ed:	89 d8                	mov    %ebx,%eax
+  8037ef:	29 d0                	sub    %edx,%eax
+  8037f1:	39 c1                	cmp    %eax,%ecx
+  8037f3:	0f 46 c1             	cmovbe %ecx,%eax
+  8037f6:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  8037f8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8037fd:	f7 e6                	mul    %esi
+  8037ff:	c1 ea 0b             	shr    $0xb,%edx
+  803802:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803808:	29 c6                	sub    %eax,%esi
+  80380a:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80380c:	29 f3                	sub    %esi,%ebx
+  80380e:	39 cb                	cmp    %ecx,%ebx
+  803810:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803813:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  803816:	8d 77 10             	lea    0x10(%edi),%esi
+  803819:	83 ec 04             	sub    $0x4,%esp
+  80381c:	53                   	push   %ebx
+  80381d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803820:	03 45 0c             	add    0xc(%ebp),%eax
+  803823:	50                   	push   %eax
+  803824:	01 f2                	add    %esi,%edx
+  803826:	52                   	push   %edx
+  803827:	e8 92 db ff ff       	call   8013be <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80382c:	83 c4 0c             	add    $0xc,%esp
+  80382f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803832:	29 d8                	sub    %ebx,%eax
+  803834:	50                   	push   %eax
+  803835:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803838:	01 d3                	add    %edx,%ebx
+  80383a:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80383d:	53                   	push   %ebx
+  80383e:	56                   	push   %esi
+  80383f:	e8 7a db ff ff       	call   8013be <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  803844:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803847:	03 4f 04             	add    0x4(%edi),%ecx
+  80384a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80384f:	f7 e1                	mul    %ecx
+  803851:	c1 ea 0c             	shr    $0xc,%edx
+  803854:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80385a:	29 d1                	sub    %edx,%ecx
+  80385c:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  80385f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  803864:	83 c4 10             	add    $0x10,%esp
+  803867:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  80386b:	75 0b                	jne    803878 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  80386d:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  803870:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  803873:	e9 f3 fe ff ff       	jmp    80376b <devpipe_write+0x1d>
+		*sleeping = 0;
+  803878:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  80387f:	83 ec 08             	sub    $0x8,%esp
+  803882:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  803887:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  80388a:	50                   	push   %eax
+  80388b:	e8 c4 e3 ff ff       	call   801c54 <sys_futex_wake>
+  803890:	83 c4 10             	add    $0x10,%esp
+  803893:	eb d8                	jmp    80386d <devpipe_write+0x11f>
+				return 0;
+  803895:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80389a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80389d:	5b                   	pop    %ebx
+  80389e:	5e                   	pop    %esi
+  80389f:	5f                   	pop    %edi
+  8038a0:	5d                   	pop    %ebp
+  8038a1:	c3                   	ret
+
+008038a2 <pipe>:
+{
+  8038a2:	55                   	push   %ebp
+  8038a3:	89 e5                	mov    %esp,%ebp
+  8038a5:	56                   	push   %esi
+  8038a6:	53                   	push   %ebx
+  8038a7:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8038aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8038ad:	50                   	push   %eax
+  8038ae:	e8 3d eb ff ff       	call   8023f0 <fd_alloc>
+  8038b3:	89 c3                	mov    %eax,%ebx
+  8038b5:	83 c4 10             	add    $0x10,%esp
+  8038b8:	85 c0                	test   %eax,%eax
+  8038ba:	0f 88 23 01 00 00    	js     8039e3 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038c0:	83 ec 04             	sub    $0x4,%esp
+  8038c3:	68 07 04 00 00       	push   $0x407
+  8038c8:	ff 75 f4             	push   -0xc(%ebp)
+  8038cb:	6a 00                	push   $0x0
+  8038cd:	e8 59 de ff ff       	call   80172b <sys_page_alloc>
+  8038d2:	89 c3                	mov    %eax,%ebx
+  8038d4:	83 c4 10             	add    $0x10,%esp
+  8038d7:	85 c0                	test   %eax,%eax
+  8038d9:	0f 88 04 01 00 00    	js     8039e3 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8038df:	83 ec 0c             	sub    $0xc,%esp
+  8038e2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8038e5:	50                   	push   %eax
+  8038e6:	e8 05 eb ff ff       	call   8023f0 <fd_alloc>
+  8038eb:	89 c3                	mov    %eax,%ebx
+  8038ed:	83 c4 10             	add    $0x10,%esp
+  8038f0:	85 c0                	test   %eax,%eax
+  8038f2:	0f 88 db 00 00 00    	js     8039d3 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038f8:	83 ec 04             	sub    $0x4,%esp
+  8038fb:	68 07 04 00 00       	push   $0x407
+  803900:	ff 75 f0             	push   -0x10(%ebp)
+  803903:	6a 00                	push   $0x0
+  803905:	e8 21 de ff ff       	call   80172b <sys_page_alloc>
+  80390a:	89 c3                	mov    %eax,%ebx
+  80390c:	83 c4 10             	add    $0x10,%esp
+  80390f:	85 c0                	test   %eax,%eax
+  803911:	0f 88 bc 00 00 00    	js     8039d3 <pipe+0x131>
+	va = fd2data(fd0);
+  803917:	83 ec 0c             	sub    $0xc,%esp
+  80391a:	ff 75 f4             	push   -0xc(%ebp)
+  80391d:	e8 b7 ea ff ff       	call   8023d9 <fd2data>
+  803922:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803924:	83 c4 0c             	add    $0xc,%esp
+  803927:	68 07 04 00 00       	push   $0x407
+  80392c:	50                   	push   %eax
+  80392d:	6a 00                	push   $0x0
+  80392f:	e8 f7 dd ff ff       	call   80172b <sys_page_alloc>
+  803934:	89 c3                	mov    %eax,%ebx
+  803936:	83 c4 10             	add    $0x10,%esp
+  803939:	85 c0                	test   %eax,%eax
+  80393b:	0f 88 82 00 00 00    	js     8039c3 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803941:	83 ec 0c             	sub    $0xc,%esp
+  803944:	ff 75 f0             	push   -0x10(%ebp)
+  803947:	e8 8d ea ff ff       	call   8023d9 <fd2data>
+  80394c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803953:	50                   	push   %eax
+  803954:	6a 00                	push   $0x0
+  803956:	56                   	push   %esi
+  803957:	6a 00                	push   $0x0
+  803959:	e8 10 de ff ff       	call   80176e <sys_page_map>
+  80395e:	89 c3                	mov    %eax,%ebx
+  803960:	83 c4 20             	add    $0x20,%esp
+  803963:	85 c0                	test   %eax,%eax
+  803965:	78 4e                	js     8039b5 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803967:	a1 3c 80 80 00       	mov    0x80803c,%eax
+  80396c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80396f:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803971:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803974:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80397b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80397e:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803980:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803983:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80398a:	83 ec 0c             	sub    $0xc,%esp
+  80398d:	ff 75 f4             	push   -0xc(%ebp)
+  803990:	e8 34 ea ff ff       	call   8023c9 <fd2num>
+  803995:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803998:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80399a:	83 c4 04             	add    $0x4,%esp
+  80399d:	ff 75 f0             	push   -0x10(%ebp)
+  8039a0:	e8 24 ea ff ff       	call   8023c9 <fd2num>
+  8039a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8039a8:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8039ab:	83 c4 10             	add    $0x10,%esp
+  8039ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039b3:	eb 2e                	jmp    8039e3 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8039b5:	83 ec 08             	sub    $0x8,%esp
+  8039b8:	56                   	push   %esi
+  8039b9:	6a 00                	push   $0x0
+  8039bb:	e8 f0 dd ff ff       	call   8017b0 <sys_page_unmap>
+  8039c0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8039c3:	83 ec 08             	sub    $0x8,%esp
+  8039c6:	ff 75 f0             	push   -0x10(%ebp)
+  8039c9:	6a 00                	push   $0x0
+  8039cb:	e8 e0 dd ff ff       	call   8017b0 <sys_page_unmap>
+  8039d0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8039d3:	83 ec 08             	sub    $0x8,%esp
+  8039d6:	ff 75 f4             	push   -0xc(%ebp)
+  8039d9:	6a 00                	push   $0x0
+  8039db:	e8 d0 dd ff ff       	call   8017b0 <sys_page_unmap>
+  8039e0:	83 c4 10             	add    $0x10,%esp
+}
+  8039e3:	89 d8                	mov    %ebx,%eax
+  8039e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8039e8:	5b                   	pop    %ebx
+  8039e9:	5e                   	pop    %esi
+  8039ea:	5d                   	pop    %ebp
+  8039eb:	c3                   	ret
+
+008039ec <pipeisclosed>:
+{
+  8039ec:	55                   	push   %ebp
+  8039ed:	89 e5                	mov    %esp,%ebp
+  8039ef:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8039f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8039f5:	50                   	push   %eax
+  8039f6:	ff 75 08             	push   0x8(%ebp)
+  8039f9:	e8 46 ea ff ff       	call   802444 <fd_lookup>
+  8039fe:	83 c4 10             	add    $0x10,%esp
+  803a01:	85 c0                	test   %eax,%eax
+  803a03:	78 18                	js     803a1d <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803a05:	83 ec 0c             	sub    $0xc,%esp
+  803a08:	ff 75 f4             	push   -0xc(%ebp)
+  803a0b:	e8 c9 e9 ff ff       	call   8023d9 <fd2data>
+  803a10:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803a12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a15:	e8 a8 fb ff ff       	call   8035c2 <_pipeisclosed>
+  803a1a:	83 c4 10             	add    $0x10,%esp
+}
+  803a1d:	c9                   	leave
+  803a1e:	c3                   	ret
+
+00803a1f <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803a1f:	55                   	push   %ebp
+  803a20:	89 e5                	mov    %esp,%ebp
+  803a22:	57                   	push   %edi
+  803a23:	56                   	push   %esi
+  803a24:	53                   	push   %ebx
+  803a25:	83 ec 0c             	sub    $0xc,%esp
+  803a28:	8b 7d 08             	mov    0x8(%ebp),%edi
+	const volatile struct Env *e;
+	unsigned status;
+
+	assert(envid != 0);
+  803a2b:	85 ff                	test   %edi,%edi
+  803a2d:	74 21                	je     803a50 <wait+0x31>
+	e = &envs[ENVX(envid)];
+  803a2f:	89 f8                	mov    %edi,%eax
+  803a31:	25 ff 03 00 00       	and    $0x3ff,%eax
+	// The kernel wakes us when it frees the environment.  Until then
+	// we sleep, unless its status changed since we looked.
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  803a36:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  803a39:	c1 e6 06             	shl    $0x6,%esi
+  803a3c:	81 c6 54 00 c0 ee    	add    $0xeec00054,%esi
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  803a42:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  803a45:	c1 e3 06             	shl    $0x6,%ebx
+  803a48:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803a4e:	eb 25                	jmp    803a75 <wait+0x56>
+	assert(envid != 0);
+  803a50:	68 3d 6d 80 00       	push   $0x806d3d
+  803a55:	68 6f 66 80 00       	push   $0x80666f
+  803a5a:	6a 0a                	push   $0xa
+  803a5c:	68 48 6d 80 00       	push   $0x806d48
+  803a61:	e8 20 d0 ff ff       	call   800a86 <_panic>
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  803a66:	83 ec 04             	sub    $0x4,%esp
+  803a69:	6a ff                	push   $0xffffffff
+  803a6b:	50                   	push   %eax
+  803a6c:	56                   	push   %esi
+  803a6d:	e8 92 e1 ff ff       	call   801c04 <sys_futex_wait>
+  803a72:	83 c4 10             	add    $0x10,%esp
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  803a75:	8b 43 48             	mov    0x48(%ebx),%eax
+  803a78:	39 f8                	cmp    %edi,%eax
+  803a7a:	75 07                	jne    803a83 <wait+0x64>
+  803a7c:	8b 43 54             	mov    0x54(%ebx),%eax
+  803a7f:	85 c0                	test   %eax,%eax
+  803a81:	75 e3                	jne    803a66 <wait+0x47>
+}
+  803a83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a86:	5b                   	pop    %ebx
+  803a87:	5e                   	pop    %esi
+  803a88:	5f                   	pop    %edi
+  803a89:	5d                   	pop    %ebp
+  803a8a:	c3                   	ret
+
+00803a8b <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  803a8b:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  803a8d:	8b 15 18 09 81 00    	mov    0x810918,%edx
+  803a93:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  803a99:	81 c2 34 01 00 00    	add    $0x134,%edx
+  803a9f:	39 d0                	cmp    %edx,%eax
+  803aa1:	74 2e                	je     803ad1 <segment_lookup+0x46>
+{
+  803aa3:	55                   	push   %ebp
+  803aa4:	89 e5                	mov    %esp,%ebp
+  803aa6:	57                   	push   %edi
+  803aa7:	56                   	push   %esi
+  803aa8:	53                   	push   %ebx
+  803aa9:	eb 07                	jmp    803ab2 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  803aab:	83 c0 20             	add    $0x20,%eax
+  803aae:	39 d0                	cmp    %edx,%eax
+  803ab0:	74 15                	je     803ac7 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  803ab2:	8b 18                	mov    (%eax),%ebx
+  803ab4:	39 d9                	cmp    %ebx,%ecx
+  803ab6:	72 f3                	jb     803aab <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  803ab8:	8b 38                	mov    (%eax),%edi
+  803aba:	8b 58 04             	mov    0x4(%eax),%ebx
+  803abd:	89 ce                	mov    %ecx,%esi
+  803abf:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  803ac1:	39 de                	cmp    %ebx,%esi
+  803ac3:	73 e6                	jae    803aab <segment_lookup+0x20>
+  803ac5:	eb 05                	jmp    803acc <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  803ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803acc:	5b                   	pop    %ebx
+  803acd:	5e                   	pop    %esi
+  803ace:	5f                   	pop    %edi
+  803acf:	5d                   	pop    %ebp
+  803ad0:	c3                   	ret
+	return NULL;
+  803ad1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ad6:	c3                   	ret
+
+00803ad7 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  803ad7:	55                   	push   %ebp
+  803ad8:	89 e5                	mov    %esp,%ebp
+  803ada:	53                   	push   %ebx
+  803adb:	83 ec 04             	sub    $0x4,%esp
+  803ade:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  803ae0:	c1 e8 16             	shr    $0x16,%eax
+  803ae3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803aea:	25 81 00 00 00       	and    $0x81,%eax
+  803aef:	83 f8 01             	cmp    $0x1,%eax
+  803af2:	75 6b                	jne    803b5f <page_is_clean+0x88>
+  803af4:	89 da                	mov    %ebx,%edx
+  803af6:	c1 ea 0c             	shr    $0xc,%edx
+  803af9:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  803b00:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  803b05:	f6 c1 01             	test   $0x1,%cl
+  803b08:	74 5a                	je     803b64 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  803b0a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  803b11:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  803b17:	75 4b                	jne    803b64 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  803b19:	89 d8                	mov    %ebx,%eax
+  803b1b:	e8 6b ff ff ff       	call   803a8b <segment_lookup>
+  803b20:	89 c2                	mov    %eax,%edx
+		return 1;
+  803b22:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  803b27:	85 d2                	test   %edx,%edx
+  803b29:	75 39                	jne    803b64 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  803b2b:	8b 15 0c d0 80 00    	mov    0x80d00c,%edx
+  803b31:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b36:	eb 03                	jmp    803b3b <page_is_clean+0x64>
+  803b38:	83 c0 01             	add    $0x1,%eax
+  803b3b:	39 c2                	cmp    %eax,%edx
+  803b3d:	7e 19                	jle    803b58 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  803b3f:	3b 1c c5 20 d0 80 00 	cmp    0x80d020(,%eax,8),%ebx
+  803b46:	72 f0                	jb     803b38 <page_is_clean+0x61>
+  803b48:	3b 1c c5 24 d0 80 00 	cmp    0x80d024(,%eax,8),%ebx
+  803b4f:	73 e7                	jae    803b38 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  803b51:	b8 01 00 00 00       	mov    $0x1,%eax
+  803b56:	eb 0c                	jmp    803b64 <page_is_clean+0x8d>
+	return 0;
+  803b58:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b5d:	eb 05                	jmp    803b64 <page_is_clean+0x8d>
+		return 0;
+  803b5f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b67:	c9                   	leave
+  803b68:	c3                   	ret
+
+00803b69 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  803b69:	55                   	push   %ebp
+  803b6a:	89 e5                	mov    %esp,%ebp
+  803b6c:	57                   	push   %edi
+  803b6d:	56                   	push   %esi
+  803b6e:	53                   	push   %ebx
+  803b6f:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803b72:	be 00 00 00 00       	mov    $0x0,%esi
+  803b77:	eb 19                	jmp    803b92 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803b79:	f7 d3                	not    %ebx
+  803b7b:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  803b81:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803b83:	83 c6 01             	add    $0x1,%esi
+  803b86:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  803b8c:	0f 87 97 00 00 00    	ja     803c29 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803b92:	89 f3                	mov    %esi,%ebx
+  803b94:	03 1d 34 a0 80 00    	add    0x80a034,%ebx
+  803b9a:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803ba0:	89 d8                	mov    %ebx,%eax
+  803ba2:	c1 e8 0a             	shr    $0xa,%eax
+  803ba5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803bac:	25 81 00 00 00       	and    $0x81,%eax
+  803bb1:	83 f8 01             	cmp    $0x1,%eax
+  803bb4:	75 c3                	jne    803b79 <linear_walk+0x10>
+  803bb6:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803bbc:	77 bb                	ja     803b79 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  803bbe:	89 df                	mov    %ebx,%edi
+  803bc0:	c1 e7 0c             	shl    $0xc,%edi
+  803bc3:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  803bc6:	89 f8                	mov    %edi,%eax
+  803bc8:	e8 0a ff ff ff       	call   803ad7 <page_is_clean>
+  803bcd:	84 c0                	test   %al,%al
+  803bcf:	75 64                	jne    803c35 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803bd1:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  803bd7:	77 aa                	ja     803b83 <linear_walk+0x1a>
+  803bd9:	81 ff 2c 20 81 00    	cmp    $0x81202c,%edi
+  803bdf:	72 a2                	jb     803b83 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803be1:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803be8:	a8 01                	test   $0x1,%al
+  803bea:	74 97                	je     803b83 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803bec:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803bf3:	f6 c4 04             	test   $0x4,%ah
+  803bf6:	75 8b                	jne    803b83 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803bf8:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803bff:	f6 c4 02             	test   $0x2,%ah
+  803c02:	0f 85 7b ff ff ff    	jne    803b83 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803c08:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803c0f:	c1 e8 0c             	shr    $0xc,%eax
+  803c12:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803c15:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803c1a:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  803c1e:	66 83 f8 01          	cmp    $0x1,%ax
+  803c22:	76 11                	jbe    803c35 <linear_walk+0xcc>
+  803c24:	e9 5a ff ff ff       	jmp    803b83 <linear_walk+0x1a>
+  803c29:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  803c2e:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  803c35:	89 1d 34 a0 80 00    	mov    %ebx,0x80a034
+}
+  803c3b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803c3e:	83 c4 1c             	add    $0x1c,%esp
+  803c41:	5b                   	pop    %ebx
+  803c42:	5e                   	pop    %esi
+  803c43:	5f                   	pop    %edi
+  803c44:	5d                   	pop    %ebp
+  803c45:	c3                   	ret
+
+00803c46 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  803c46:	55                   	push   %ebp
+  803c47:	89 e5                	mov    %esp,%ebp
+  803c49:	56                   	push   %esi
+  803c4a:	53                   	push   %ebx
+  803c4b:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  803c4d:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803c52:	83 e0 7f             	and    $0x7f,%eax
+  803c55:	c1 e0 04             	shl    $0x4,%eax
+  803c58:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  803c5e:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  803c64:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  803c6a:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  803c70:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803c75:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  803c78:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803c7d:	83 c0 01             	add    $0x1,%eax
+  803c80:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  803c85:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  803c88:	5b                   	pop    %ebx
+  803c89:	5e                   	pop    %esi
+  803c8a:	5d                   	pop    %ebp
+  803c8b:	c3                   	ret
+
+00803c8c <page_ring_enter>:
+{
+  803c8c:	55                   	push   %ebp
+  803c8d:	89 e5                	mov    %esp,%ebp
+  803c8f:	57                   	push   %edi
+  803c90:	56                   	push   %esi
+  803c91:	53                   	push   %ebx
+  803c92:	83 ec 18             	sub    $0x18,%esp
+  803c95:	89 c6                	mov    %eax,%esi
+  803c97:	89 d7                	mov    %edx,%edi
+  803c99:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  803c9b:	6a 00                	push   $0x0
+  803c9d:	6a 00                	push   $0x0
+  803c9f:	6a 00                	push   $0x0
+  803ca1:	6a 07                	push   $0x7
+  803ca3:	ff 35 40 d0 80 00    	push   0x80d040
+  803ca9:	e8 1a 25 00 00       	call   8061c8 <ipc_call>
+  803cae:	83 c4 20             	add    $0x20,%esp
+  803cb1:	85 c0                	test   %eax,%eax
+  803cb3:	79 22                	jns    803cd7 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  803cb5:	50                   	push   %eax
+  803cb6:	68 53 6d 80 00       	push   $0x806d53
+  803cbb:	68 13 02 00 00       	push   $0x213
+  803cc0:	68 67 6d 80 00       	push   $0x806d67
+  803cc5:	e8 bc cd ff ff       	call   800a86 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  803cca:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  803ccf:	83 c0 01             	add    $0x1,%eax
+  803cd2:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  803cd7:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  803cdd:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  803ce2:	39 c2                	cmp    %eax,%edx
+  803ce4:	74 24                	je     803d0a <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  803ce6:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  803ceb:	83 e0 7f             	and    $0x7f,%eax
+  803cee:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  803cf5:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  803cfc:	29 f0                	sub    %esi,%eax
+  803cfe:	39 d8                	cmp    %ebx,%eax
+  803d00:	73 c8                	jae    803cca <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  803d02:	8b 52 04             	mov    0x4(%edx),%edx
+  803d05:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  803d08:	eb c0                	jmp    803cca <page_ring_enter+0x3e>
+}
+  803d0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d0d:	5b                   	pop    %ebx
+  803d0e:	5e                   	pop    %esi
+  803d0f:	5f                   	pop    %edi
+  803d10:	5d                   	pop    %ebp
+  803d11:	c3                   	ret
+
+00803d12 <page_ring_reserve>:
+{
+  803d12:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  803d14:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803d19:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  803d1f:	29 d0                	sub    %edx,%eax
+  803d21:	ba 80 00 00 00       	mov    $0x80,%edx
+  803d26:	29 ca                	sub    %ecx,%edx
+  803d28:	39 c2                	cmp    %eax,%edx
+  803d2a:	72 01                	jb     803d2d <page_ring_reserve+0x1b>
+  803d2c:	c3                   	ret
+{
+  803d2d:	55                   	push   %ebp
+  803d2e:	89 e5                	mov    %esp,%ebp
+  803d30:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  803d33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d38:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d42:	e8 45 ff ff ff       	call   803c8c <page_ring_enter>
+}
+  803d47:	c9                   	leave
+  803d48:	c3                   	ret
+
+00803d49 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  803d49:	55                   	push   %ebp
+  803d4a:	89 e5                	mov    %esp,%ebp
+  803d4c:	53                   	push   %ebx
+  803d4d:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  803d50:	6a 07                	push   $0x7
+  803d52:	6a 01                	push   $0x1
+  803d54:	89 c3                	mov    %eax,%ebx
+  803d56:	c1 e3 0c             	shl    $0xc,%ebx
+  803d59:	8d 93 00 b0 80 00    	lea    0x80b000(%ebx),%edx
+  803d5f:	52                   	push   %edx
+  803d60:	6a 04                	push   $0x4
+  803d62:	ff 34 85 44 d0 80 00 	push   0x80d044(,%eax,4)
+  803d69:	e8 5a 24 00 00       	call   8061c8 <ipc_call>
+	sharereqs[i].nslots = 0;
+  803d6e:	c7 83 00 b0 80 00 00 	movl   $0x0,0x80b000(%ebx)
+  803d75:	00 00 00 
+	return r;
+}
+  803d78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d7b:	c9                   	leave
+  803d7c:	c3                   	ret
+
+00803d7d <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  803d7d:	55                   	push   %ebp
+  803d7e:	89 e5                	mov    %esp,%ebp
+  803d80:	56                   	push   %esi
+  803d81:	53                   	push   %ebx
+  803d82:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  803d84:	c1 e8 10             	shr    $0x10,%eax
+  803d87:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  803d8a:	89 c2                	mov    %eax,%edx
+  803d8c:	c1 e2 0c             	shl    $0xc,%edx
+  803d8f:	8b b2 00 b0 80 00    	mov    0x80b000(%edx),%esi
+  803d95:	8d 5e 01             	lea    0x1(%esi),%ebx
+  803d98:	89 9a 00 b0 80 00    	mov    %ebx,0x80b000(%edx)
+  803d9e:	89 c2                	mov    %eax,%edx
+  803da0:	c1 e2 0a             	shl    $0xa,%edx
+  803da3:	01 f2                	add    %esi,%edx
+  803da5:	89 0c 95 04 b0 80 00 	mov    %ecx,0x80b004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  803dac:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  803db2:	74 09                	je     803dbd <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  803db4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803db9:	5b                   	pop    %ebx
+  803dba:	5e                   	pop    %esi
+  803dbb:	5d                   	pop    %ebp
+  803dbc:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  803dbd:	e8 87 ff ff ff       	call   803d49 <page_share_send>
+  803dc2:	eb f5                	jmp    803db9 <page_share_slot+0x3c>
+
+00803dc4 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  803dc4:	a1 18 09 81 00       	mov    0x810918,%eax
+  803dc9:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  803dcc:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  803dd1:	3b 15 00 d0 80 00    	cmp    0x80d000,%edx
+  803dd7:	74 09                	je     803de2 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  803dd9:	a1 40 d0 80 00       	mov    0x80d040,%eax
+  803dde:	85 c0                	test   %eax,%eax
+  803de0:	75 01                	jne    803de3 <page_ring_ready+0x1f>
+}
+  803de2:	c3                   	ret
+{
+  803de3:	55                   	push   %ebp
+  803de4:	89 e5                	mov    %esp,%ebp
+  803de6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  803de9:	68 07 06 00 00       	push   $0x607
+  803dee:	6a 08                	push   $0x8
+  803df0:	68 00 30 ad de       	push   $0xdead3000
+  803df5:	6a 00                	push   $0x0
+  803df7:	e8 5a da ff ff       	call   801856 <sys_page_alloc_range>
+  803dfc:	83 c4 10             	add    $0x10,%esp
+  803dff:	83 f8 08             	cmp    $0x8,%eax
+  803e02:	74 1b                	je     803e1f <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  803e04:	83 ec 04             	sub    $0x4,%esp
+  803e07:	6a 08                	push   $0x8
+  803e09:	68 00 30 ad de       	push   $0xdead3000
+  803e0e:	6a 00                	push   $0x0
+  803e10:	e8 af da ff ff       	call   8018c4 <sys_page_unmap_range>
+		return 0;
+  803e15:	83 c4 10             	add    $0x10,%esp
+  803e18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e1d:	c9                   	leave
+  803e1e:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  803e1f:	83 ec 0c             	sub    $0xc,%esp
+  803e22:	68 07 04 00 00       	push   $0x407
+  803e27:	6a 08                	push   $0x8
+  803e29:	68 00 30 ad de       	push   $0xdead3000
+  803e2e:	6a 06                	push   $0x6
+  803e30:	ff 35 40 d0 80 00    	push   0x80d040
+  803e36:	e8 8d 23 00 00       	call   8061c8 <ipc_call>
+  803e3b:	83 c4 20             	add    $0x20,%esp
+  803e3e:	85 c0                	test   %eax,%eax
+  803e40:	78 14                	js     803e56 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  803e42:	a1 18 09 81 00       	mov    0x810918,%eax
+  803e47:	8b 40 48             	mov    0x48(%eax),%eax
+  803e4a:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	return 1;
+  803e4f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803e54:	eb c7                	jmp    803e1d <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  803e56:	83 ec 04             	sub    $0x4,%esp
+  803e59:	6a 08                	push   $0x8
+  803e5b:	68 00 30 ad de       	push   $0xdead3000
+  803e60:	6a 00                	push   $0x0
+  803e62:	e8 5d da ff ff       	call   8018c4 <sys_page_unmap_range>
+		return 0;
+  803e67:	83 c4 10             	add    $0x10,%esp
+  803e6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e6f:	eb ac                	jmp    803e1d <page_ring_ready+0x59>
+
+00803e71 <page_remove_slot>:
+{
+  803e71:	55                   	push   %ebp
+  803e72:	89 e5                	mov    %esp,%ebp
+  803e74:	56                   	push   %esi
+  803e75:	53                   	push   %ebx
+  803e76:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803e78:	89 c6                	mov    %eax,%esi
+  803e7a:	c1 ee 10             	shr    $0x10,%esi
+  803e7d:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  803e80:	8b 04 b5 44 d0 80 00 	mov    0x80d044(,%esi,4),%eax
+  803e87:	39 05 40 d0 80 00    	cmp    %eax,0x80d040
+  803e8d:	74 2a                	je     803eb9 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  803e8f:	83 ec 0c             	sub    $0xc,%esp
+  803e92:	6a 00                	push   $0x0
+  803e94:	6a 00                	push   $0x0
+  803e96:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  803e98:	c1 e3 04             	shl    $0x4,%ebx
+  803e9b:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  803e9e:	53                   	push   %ebx
+  803e9f:	ff 34 b5 44 d0 80 00 	push   0x80d044(,%esi,4)
+  803ea6:	e8 1d 23 00 00       	call   8061c8 <ipc_call>
+  803eab:	83 c4 20             	add    $0x20,%esp
+  803eae:	85 c0                	test   %eax,%eax
+  803eb0:	78 2d                	js     803edf <page_remove_slot+0x6e>
+}
+  803eb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803eb5:	5b                   	pop    %ebx
+  803eb6:	5e                   	pop    %esi
+  803eb7:	5d                   	pop    %ebp
+  803eb8:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  803eb9:	e8 06 ff ff ff       	call   803dc4 <page_ring_ready>
+  803ebe:	85 c0                	test   %eax,%eax
+  803ec0:	74 cd                	je     803e8f <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  803ec2:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ec7:	e8 46 fe ff ff       	call   803d12 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  803ecc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ed1:	89 da                	mov    %ebx,%edx
+  803ed3:	b8 02 00 00 00       	mov    $0x2,%eax
+  803ed8:	e8 69 fd ff ff       	call   803c46 <page_ring_post>
+		return;
+  803edd:	eb d3                	jmp    803eb2 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  803edf:	50                   	push   %eax
+  803ee0:	68 c0 6d 80 00       	push   $0x806dc0
+  803ee5:	68 ac 03 00 00       	push   $0x3ac
+  803eea:	68 67 6d 80 00       	push   $0x806d67
+  803eef:	e8 92 cb ff ff       	call   800a86 <_panic>
+
+00803ef4 <find_paging_env>:
+	if(pagingenv)
+  803ef4:	a1 40 d0 80 00       	mov    0x80d040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  803ef9:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  803efb:	85 c0                	test   %eax,%eax
+  803efd:	74 05                	je     803f04 <find_paging_env+0x10>
+  803eff:	eb 56                	jmp    803f57 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  803f01:	83 c0 01             	add    $0x1,%eax
+  803f04:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803f09:	7f 47                	jg     803f52 <find_paging_env+0x5e>
+  803f0b:	83 f9 01             	cmp    $0x1,%ecx
+  803f0e:	7f 42                	jg     803f52 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  803f10:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  803f13:	c1 e2 06             	shl    $0x6,%edx
+  803f16:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803f1c:	8b 52 50             	mov    0x50(%edx),%edx
+  803f1f:	83 fa 02             	cmp    $0x2,%edx
+  803f22:	75 dd                	jne    803f01 <find_paging_env+0xd>
+  803f24:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  803f27:	c1 e2 06             	shl    $0x6,%edx
+  803f2a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803f30:	8b 52 54             	mov    0x54(%edx),%edx
+  803f33:	85 d2                	test   %edx,%edx
+  803f35:	74 ca                	je     803f01 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  803f37:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  803f3a:	c1 e2 06             	shl    $0x6,%edx
+  803f3d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803f43:	8b 52 48             	mov    0x48(%edx),%edx
+  803f46:	89 14 8d 44 d0 80 00 	mov    %edx,0x80d044(,%ecx,4)
+  803f4d:	8d 49 01             	lea    0x1(%ecx),%ecx
+  803f50:	eb af                	jmp    803f01 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  803f52:	83 f9 02             	cmp    $0x2,%ecx
+  803f55:	74 01                	je     803f58 <find_paging_env+0x64>
+}
+  803f57:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  803f58:	a1 18 09 81 00       	mov    0x810918,%eax
+  803f5d:	8b 40 48             	mov    0x48(%eax),%eax
+  803f60:	83 e0 01             	and    $0x1,%eax
+  803f63:	8b 04 85 44 d0 80 00 	mov    0x80d044(,%eax,4),%eax
+  803f6a:	a3 40 d0 80 00       	mov    %eax,0x80d040
+  803f6f:	eb e6                	jmp    803f57 <find_paging_env+0x63>
+
+00803f71 <page_add_backed>:
+{
+  803f71:	55                   	push   %ebp
+  803f72:	89 e5                	mov    %esp,%ebp
+  803f74:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  803f77:	a1 0c d0 80 00       	mov    0x80d00c,%eax
+  803f7c:	83 f8 04             	cmp    $0x4,%eax
+  803f7f:	74 35                	je     803fb6 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  803f81:	89 d1                	mov    %edx,%ecx
+  803f83:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  803f89:	89 0c c5 20 d0 80 00 	mov    %ecx,0x80d020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  803f90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803f93:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  803f9a:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803fa0:	89 14 c5 24 d0 80 00 	mov    %edx,0x80d024(,%eax,8)
+	num_backed_ranges++;
+  803fa7:	83 c0 01             	add    $0x1,%eax
+  803faa:	a3 0c d0 80 00       	mov    %eax,0x80d00c
+	return 0;
+  803faf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fb4:	5d                   	pop    %ebp
+  803fb5:	c3                   	ret
+		return -E_NO_MEM;
+  803fb6:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803fbb:	eb f7                	jmp    803fb4 <page_add_backed+0x43>
+
+00803fbd <percentage_of_pgdir_to_walk>:
+{
+  803fbd:	55                   	push   %ebp
+  803fbe:	89 e5                	mov    %esp,%ebp
+  803fc0:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  803fc3:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  803fc7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  803fca:	db 45 fc             	fildl  -0x4(%ebp)
+  803fcd:	d8 35 4c 72 80 00    	fdivs  0x80724c
+	return ret*ret;
+  803fd3:	d8 c8                	fmul   %st(0),%st
+}
+  803fd5:	c9                   	leave
+  803fd6:	c3                   	ret
+
+00803fd7 <nfu_with_aging_page_choice_func>:
+{
+  803fd7:	55                   	push   %ebp
+  803fd8:	89 e5                	mov    %esp,%ebp
+  803fda:	57                   	push   %edi
+  803fdb:	56                   	push   %esi
+  803fdc:	53                   	push   %ebx
+  803fdd:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803fe0:	8b 35 30 a0 80 00    	mov    0x80a030,%esi
+	float pct_to_walk = 1.0f;
+  803fe6:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  803fe8:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803fed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ff2:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803ff9:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ffe:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  804001:	eb 18                	jmp    80401b <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  804003:	f7 d0                	not    %eax
+  804005:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80400a:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80400c:	83 c2 01             	add    $0x1,%edx
+  80400f:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  804015:	0f 87 13 01 00 00    	ja     80412e <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  80401b:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80401f:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  804022:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  804027:	89 c1                	mov    %eax,%ecx
+  804029:	c1 e9 0a             	shr    $0xa,%ecx
+  80402c:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  804033:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  804039:	83 f9 01             	cmp    $0x1,%ecx
+  80403c:	75 c5                	jne    804003 <nfu_with_aging_page_choice_func+0x2c>
+  80403e:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  804043:	77 be                	ja     804003 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  804045:	89 c1                	mov    %eax,%ecx
+  804047:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80404a:	81 f9 2c 20 81 00    	cmp    $0x81202c,%ecx
+  804050:	0f 82 a5 00 00 00    	jb     8040fb <nfu_with_aging_page_choice_func+0x124>
+  804056:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  80405c:	0f 87 99 00 00 00    	ja     8040fb <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  804062:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  804069:	f6 c1 01             	test   $0x1,%cl
+  80406c:	0f 84 89 00 00 00    	je     8040fb <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  804072:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  804079:	f6 c5 04             	test   $0x4,%ch
+  80407c:	75 7d                	jne    8040fb <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80407e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  804085:	f6 c5 02             	test   $0x2,%ch
+  804088:	75 71                	jne    8040fb <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80408a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  804091:	c1 e9 0c             	shr    $0xc,%ecx
+  804094:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  804097:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80409d:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8040a1:	66 83 f9 01          	cmp    $0x1,%cx
+  8040a5:	77 54                	ja     8040fb <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  8040a7:	89 f9                	mov    %edi,%ecx
+  8040a9:	80 f9 ff             	cmp    $0xff,%cl
+  8040ac:	74 21                	je     8040cf <nfu_with_aging_page_choice_func+0xf8>
+  8040ae:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8040b5:	c1 e9 0c             	shr    $0xc,%ecx
+  8040b8:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8040bb:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8040c1:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  8040c5:	89 fb                	mov    %edi,%ebx
+  8040c7:	38 d9                	cmp    %bl,%cl
+  8040c9:	73 30                	jae    8040fb <nfu_with_aging_page_choice_func+0x124>
+  8040cb:	dd d8                	fstp   %st(0)
+  8040cd:	eb 02                	jmp    8040d1 <nfu_with_aging_page_choice_func+0xfa>
+  8040cf:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  8040d1:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8040d8:	c1 e9 0c             	shr    $0xc,%ecx
+  8040db:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8040de:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  8040e5:	89 fb                	mov    %edi,%ebx
+  8040e7:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  8040ea:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8040ed:	db 45 e0             	fildl  -0x20(%ebp)
+  8040f0:	d8 35 4c 72 80 00    	fdivs  0x80724c
+	return ret*ret;
+  8040f6:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8040f8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8040fb:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8040fe:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  804101:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804108:	df 6d e0             	fildll -0x20(%ebp)
+  80410b:	d9 c1                	fld    %st(1)
+  80410d:	d8 0d 50 72 80 00    	fmuls  0x807250
+  804113:	d9 c9                	fxch   %st(1)
+  804115:	df f1                	fcomip %st(1),%st
+  804117:	dd d8                	fstp   %st(0)
+  804119:	0f 82 ed fe ff ff    	jb     80400c <nfu_with_aging_page_choice_func+0x35>
+  80411f:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  804121:	a3 30 a0 80 00       	mov    %eax,0x80a030
+			return (void*)(pgnum_opt*PGSIZE);
+  804126:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  804129:	c1 e0 0c             	shl    $0xc,%eax
+  80412c:	eb 0e                	jmp    80413c <nfu_with_aging_page_choice_func+0x165>
+  80412e:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  804130:	89 f8                	mov    %edi,%eax
+  804132:	3c ff                	cmp    $0xff,%al
+  804134:	74 0e                	je     804144 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  804136:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  804139:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80413c:	83 c4 14             	add    $0x14,%esp
+  80413f:	5b                   	pop    %ebx
+  804140:	5e                   	pop    %esi
+  804141:	5f                   	pop    %edi
+  804142:	5d                   	pop    %ebp
+  804143:	c3                   	ret
+	pgnum = 0;
+  804144:	c7 05 30 a0 80 00 00 	movl   $0x0,0x80a030
+  80414b:	00 00 00 
+	return (void*)UTOP;
+  80414e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804153:	eb e7                	jmp    80413c <nfu_with_aging_page_choice_func+0x165>
+
+00804155 <myRand>:
+    state = state * 1664525 + 1013904223;
+  804155:	69 05 5c 80 80 00 0d 	imul   $0x19660d,0x80805c,%eax
+  80415c:	66 19 00 
+  80415f:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  804164:	a3 5c 80 80 00       	mov    %eax,0x80805c
+    return state >> 24;
+  804169:	c1 e8 18             	shr    $0x18,%eax
+}
+  80416c:	c3                   	ret
+
+0080416d <random_page_choice_func>:
+{
+  80416d:	55                   	push   %ebp
+  80416e:	89 e5                	mov    %esp,%ebp
+  804170:	57                   	push   %edi
+  804171:	56                   	push   %esi
+  804172:	53                   	push   %ebx
+  804173:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  804176:	be 00 00 00 00       	mov    $0x0,%esi
+  80417b:	eb 19                	jmp    804196 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80417d:	f7 d3                	not    %ebx
+  80417f:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  804185:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  804187:	83 c6 01             	add    $0x1,%esi
+  80418a:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  804190:	0f 87 a0 00 00 00    	ja     804236 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  804196:	89 f3                	mov    %esi,%ebx
+  804198:	03 1d 2c a0 80 00    	add    0x80a02c,%ebx
+  80419e:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8041a4:	89 d8                	mov    %ebx,%eax
+  8041a6:	c1 e8 0a             	shr    $0xa,%eax
+  8041a9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8041b0:	25 81 00 00 00       	and    $0x81,%eax
+  8041b5:	83 f8 01             	cmp    $0x1,%eax
+  8041b8:	75 c3                	jne    80417d <random_page_choice_func+0x10>
+  8041ba:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8041c0:	77 bb                	ja     80417d <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8041c2:	89 df                	mov    %ebx,%edi
+  8041c4:	c1 e7 0c             	shl    $0xc,%edi
+  8041c7:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8041ca:	89 f8                	mov    %edi,%eax
+  8041cc:	e8 06 f9 ff ff       	call   803ad7 <page_is_clean>
+  8041d1:	84 c0                	test   %al,%al
+  8041d3:	0f 85 82 00 00 00    	jne    80425b <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8041d9:	81 ff 2c 20 81 00    	cmp    $0x81202c,%edi
+  8041df:	72 a6                	jb     804187 <random_page_choice_func+0x1a>
+  8041e1:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  8041e7:	77 9e                	ja     804187 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8041e9:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8041f0:	a8 01                	test   $0x1,%al
+  8041f2:	74 93                	je     804187 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8041f4:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8041fb:	f6 c4 04             	test   $0x4,%ah
+  8041fe:	75 87                	jne    804187 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  804200:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  804207:	f6 c4 02             	test   $0x2,%ah
+  80420a:	0f 85 77 ff ff ff    	jne    804187 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  804210:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  804217:	c1 e8 0c             	shr    $0xc,%eax
+  80421a:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80421d:	05 00 00 00 ef       	add    $0xef000000,%eax
+  804222:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  804226:	66 83 f8 01          	cmp    $0x1,%ax
+  80422a:	0f 87 57 ff ff ff    	ja     804187 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  804230:	89 1d 2c a0 80 00    	mov    %ebx,0x80a02c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  804236:	e8 1a ff ff ff       	call   804155 <myRand>
+  80423b:	8b 3d 2c a0 80 00    	mov    0x80a02c,%edi
+  804241:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  804246:	29 fe                	sub    %edi,%esi
+  804248:	0f be c0             	movsbl %al,%eax
+  80424b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804250:	f7 f6                	div    %esi
+  804252:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  804254:	bb 15 00 00 00       	mov    $0x15,%ebx
+  804259:	eb 1c                	jmp    804277 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  80425b:	89 1d 2c a0 80 00    	mov    %ebx,0x80a02c
+			return (void*)(pgnum*PGSIZE);
+  804261:	e9 8f 00 00 00       	jmp    8042f5 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  804266:	e8 ea fe ff ff       	call   804155 <myRand>
+  80426b:	0f be c0             	movsbl %al,%eax
+  80426e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804273:	f7 f6                	div    %esi
+  804275:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  804277:	83 eb 01             	sub    $0x1,%ebx
+  80427a:	0f 84 c2 00 00 00    	je     804342 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  804280:	89 d0                	mov    %edx,%eax
+  804282:	c1 e8 0a             	shr    $0xa,%eax
+  804285:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80428c:	25 81 00 00 00       	and    $0x81,%eax
+  804291:	83 f8 01             	cmp    $0x1,%eax
+  804294:	75 d0                	jne    804266 <random_page_choice_func+0xf9>
+  804296:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  80429c:	77 c8                	ja     804266 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  80429e:	89 d0                	mov    %edx,%eax
+  8042a0:	c1 e0 0c             	shl    $0xc,%eax
+  8042a3:	3d 2c 20 81 00       	cmp    $0x81202c,%eax
+  8042a8:	72 56                	jb     804300 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8042aa:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  8042af:	77 65                	ja     804316 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8042b1:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8042b8:	f6 c1 01             	test   $0x1,%cl
+  8042bb:	74 59                	je     804316 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8042bd:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8042c4:	f6 c5 04             	test   $0x4,%ch
+  8042c7:	75 4d                	jne    804316 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  8042c9:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8042d0:	f6 c5 02             	test   $0x2,%ch
+  8042d3:	75 41                	jne    804316 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  8042d5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8042dc:	c1 ea 0c             	shr    $0xc,%edx
+  8042df:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  8042e2:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  8042e8:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  8042ec:	66 83 fa 01          	cmp    $0x1,%dx
+  8042f0:	77 3a                	ja     80432c <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  8042f2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  8042f5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8042f8:	83 c4 1c             	add    $0x1c,%esp
+  8042fb:	5b                   	pop    %ebx
+  8042fc:	5e                   	pop    %esi
+  8042fd:	5f                   	pop    %edi
+  8042fe:	5d                   	pop    %ebp
+  8042ff:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  804300:	e8 50 fe ff ff       	call   804155 <myRand>
+  804305:	0f be c0             	movsbl %al,%eax
+  804308:	ba 00 00 00 00       	mov    $0x0,%edx
+  80430d:	f7 f6                	div    %esi
+  80430f:	01 fa                	add    %edi,%edx
+			continue;
+  804311:	e9 61 ff ff ff       	jmp    804277 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  804316:	e8 3a fe ff ff       	call   804155 <myRand>
+  80431b:	0f be c0             	movsbl %al,%eax
+  80431e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804323:	f7 f6                	div    %esi
+  804325:	01 fa                	add    %edi,%edx
+			continue;
+  804327:	e9 4b ff ff ff       	jmp    804277 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  80432c:	e8 24 fe ff ff       	call   804155 <myRand>
+  804331:	0f be c0             	movsbl %al,%eax
+  804334:	ba 00 00 00 00       	mov    $0x0,%edx
+  804339:	f7 f6                	div    %esi
+  80433b:	01 fa                	add    %edi,%edx
+			continue;
+  80433d:	e9 35 ff ff ff       	jmp    804277 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  804342:	c7 05 2c a0 80 00 00 	movl   $0x0,0x80a02c
+  804349:	00 00 00 
+	return (void*)UTOP;
+  80434c:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  804353:	eb a0                	jmp    8042f5 <random_page_choice_func+0x188>
+
+00804355 <nfu>:
+{
+  804355:	55                   	push   %ebp
+  804356:	89 e5                	mov    %esp,%ebp
+  804358:	57                   	push   %edi
+  804359:	56                   	push   %esi
+  80435a:	53                   	push   %ebx
+  80435b:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80435e:	8b 35 28 a0 80 00    	mov    0x80a028,%esi
+	float pct_to_walk = 1.0f;
+  804364:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  804366:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80436b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804370:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  804377:	ba 00 00 00 00       	mov    $0x0,%edx
+  80437c:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  80437f:	eb 18                	jmp    804399 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  804381:	f7 d0                	not    %eax
+  804383:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804388:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80438a:	83 c2 01             	add    $0x1,%edx
+  80438d:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  804393:	0f 87 13 01 00 00    	ja     8044ac <nfu+0x157>
+		++num_searched_ptes;
+  804399:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80439d:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8043a0:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8043a5:	89 c1                	mov    %eax,%ecx
+  8043a7:	c1 e9 0a             	shr    $0xa,%ecx
+  8043aa:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8043b1:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8043b7:	83 f9 01             	cmp    $0x1,%ecx
+  8043ba:	75 c5                	jne    804381 <nfu+0x2c>
+  8043bc:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8043c1:	77 be                	ja     804381 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8043c3:	89 c1                	mov    %eax,%ecx
+  8043c5:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8043c8:	81 f9 2c 20 81 00    	cmp    $0x81202c,%ecx
+  8043ce:	0f 82 a5 00 00 00    	jb     804479 <nfu+0x124>
+  8043d4:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8043da:	0f 87 99 00 00 00    	ja     804479 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8043e0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8043e7:	f6 c1 01             	test   $0x1,%cl
+  8043ea:	0f 84 89 00 00 00    	je     804479 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8043f0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8043f7:	f6 c5 04             	test   $0x4,%ch
+  8043fa:	75 7d                	jne    804479 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8043fc:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  804403:	f6 c5 02             	test   $0x2,%ch
+  804406:	75 71                	jne    804479 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  804408:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80440f:	c1 e9 0c             	shr    $0xc,%ecx
+  804412:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  804415:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80441b:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  80441f:	66 83 f9 01          	cmp    $0x1,%cx
+  804423:	77 54                	ja     804479 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  804425:	89 f9                	mov    %edi,%ecx
+  804427:	80 f9 ff             	cmp    $0xff,%cl
+  80442a:	74 21                	je     80444d <nfu+0xf8>
+  80442c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  804433:	c1 e9 0c             	shr    $0xc,%ecx
+  804436:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  804439:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80443f:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  804443:	89 fb                	mov    %edi,%ebx
+  804445:	38 d9                	cmp    %bl,%cl
+  804447:	73 30                	jae    804479 <nfu+0x124>
+  804449:	dd d8                	fstp   %st(0)
+  80444b:	eb 02                	jmp    80444f <nfu+0xfa>
+  80444d:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  80444f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  804456:	c1 e9 0c             	shr    $0xc,%ecx
+  804459:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80445c:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  804463:	89 fb                	mov    %edi,%ebx
+  804465:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  804468:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80446b:	db 45 e0             	fildl  -0x20(%ebp)
+  80446e:	d8 35 4c 72 80 00    	fdivs  0x80724c
+	return ret*ret;
+  804474:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  804476:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  804479:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80447c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80447f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804486:	df 6d e0             	fildll -0x20(%ebp)
+  804489:	d9 c1                	fld    %st(1)
+  80448b:	d8 0d 50 72 80 00    	fmuls  0x807250
+  804491:	d9 c9                	fxch   %st(1)
+  804493:	df f1                	fcomip %st(1),%st
+  804495:	dd d8                	fstp   %st(0)
+  804497:	0f 82 ed fe ff ff    	jb     80438a <nfu+0x35>
+  80449d:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  80449f:	a3 28 a0 80 00       	mov    %eax,0x80a028
+			return (void*)(pgnum_opt*PGSIZE);
+  8044a4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8044a7:	c1 e0 0c             	shl    $0xc,%eax
+  8044aa:	eb 0e                	jmp    8044ba <nfu+0x165>
+  8044ac:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  8044ae:	89 f8                	mov    %edi,%eax
+  8044b0:	3c ff                	cmp    $0xff,%al
+  8044b2:	74 0e                	je     8044c2 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  8044b4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8044b7:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8044ba:	83 c4 14             	add    $0x14,%esp
+  8044bd:	5b                   	pop    %ebx
+  8044be:	5e                   	pop    %esi
+  8044bf:	5f                   	pop    %edi
+  8044c0:	5d                   	pop    %ebp
+  8044c1:	c3                   	ret
+	pgnum = 0;
+  8044c2:	c7 05 28 a0 80 00 00 	movl   $0x0,0x80a028
+  8044c9:	00 00 00 
+	return (void*)UTOP;
+  8044cc:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8044d1:	eb e7                	jmp    8044ba <nfu+0x165>
+
+008044d3 <lru>:
+{
+  8044d3:	55                   	push   %ebp
+  8044d4:	89 e5                	mov    %esp,%ebp
+  8044d6:	57                   	push   %edi
+  8044d7:	56                   	push   %esi
+  8044d8:	53                   	push   %ebx
+  8044d9:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8044dc:	8b 3d 24 a0 80 00    	mov    0x80a024,%edi
+	long long time_min = 9223372036854775807;
+  8044e2:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  8044e9:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8044f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8044f5:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8044fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  804501:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  804504:	eb 18                	jmp    80451e <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  804506:	f7 d0                	not    %eax
+  804508:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80450d:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80450f:	83 c2 01             	add    $0x1,%edx
+  804512:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  804518:	0f 87 fa 00 00 00    	ja     804618 <lru+0x145>
+		++num_searched_ptes;
+  80451e:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  804521:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  804524:	01 d0                	add    %edx,%eax
+  804526:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80452b:	89 c1                	mov    %eax,%ecx
+  80452d:	c1 e9 0a             	shr    $0xa,%ecx
+  804530:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  804537:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  80453d:	83 f9 01             	cmp    $0x1,%ecx
+  804540:	75 c4                	jne    804506 <lru+0x33>
+  804542:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  804547:	77 bd                	ja     804506 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  804549:	89 c1                	mov    %eax,%ecx
+  80454b:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80454e:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  804554:	0f 87 92 00 00 00    	ja     8045ec <lru+0x119>
+  80455a:	81 f9 2c 20 81 00    	cmp    $0x81202c,%ecx
+  804560:	0f 82 86 00 00 00    	jb     8045ec <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  804566:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80456d:	f6 c1 01             	test   $0x1,%cl
+  804570:	74 7a                	je     8045ec <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  804572:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  804579:	f6 c5 04             	test   $0x4,%ch
+  80457c:	75 6e                	jne    8045ec <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80457e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  804585:	f6 c5 02             	test   $0x2,%ch
+  804588:	75 62                	jne    8045ec <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80458a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  804591:	c1 e9 0c             	shr    $0xc,%ecx
+  804594:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  804597:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80459d:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8045a1:	66 83 f9 01          	cmp    $0x1,%cx
+  8045a5:	77 45                	ja     8045ec <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  8045a7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8045ae:	c1 e9 0c             	shr    $0xc,%ecx
+  8045b1:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8045b4:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8045ba:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8045bd:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8045c0:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  8045c3:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8045c6:	19 df                	sbb    %ebx,%edi
+  8045c8:	7c 22                	jl     8045ec <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  8045ca:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8045d1:	c1 e9 0c             	shr    $0xc,%ecx
+  8045d4:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8045d7:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8045dd:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8045e0:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8045e3:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8045e6:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8045e9:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8045ec:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8045ef:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8045f6:	df 6d e0             	fildll -0x20(%ebp)
+  8045f9:	d9 05 50 72 80 00    	flds   0x807250
+  8045ff:	d9 c9                	fxch   %st(1)
+  804601:	df f1                	fcomip %st(1),%st
+  804603:	dd d8                	fstp   %st(0)
+  804605:	0f 82 04 ff ff ff    	jb     80450f <lru+0x3c>
+			pgnum = pgnum_actual;
+  80460b:	a3 24 a0 80 00       	mov    %eax,0x80a024
+			return (void*)(pgnum_opt*PGSIZE);
+  804610:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  804613:	c1 e0 0c             	shl    $0xc,%eax
+  804616:	eb 06                	jmp    80461e <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  804618:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80461b:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80461e:	83 c4 1c             	add    $0x1c,%esp
+  804621:	5b                   	pop    %ebx
+  804622:	5e                   	pop    %esi
+  804623:	5f                   	pop    %edi
+  804624:	5d                   	pop    %ebp
+  804625:	c3                   	ret
+
+00804626 <set_page_choice_func>:
+{
+  804626:	55                   	push   %ebp
+  804627:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  804629:	8b 45 08             	mov    0x8(%ebp),%eax
+  80462c:	a3 58 80 80 00       	mov    %eax,0x808058
+}
+  804631:	5d                   	pop    %ebp
+  804632:	c3                   	ret
+
+00804633 <get_page_choice>:
+{
+  804633:	55                   	push   %ebp
+  804634:	89 e5                	mov    %esp,%ebp
+  804636:	57                   	push   %edi
+  804637:	56                   	push   %esi
+  804638:	53                   	push   %ebx
+  804639:	83 ec 24             	sub    $0x24,%esp
+  80463c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80463f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  804642:	57                   	push   %edi
+  804643:	56                   	push   %esi
+  804644:	ff 15 58 80 80 00    	call   *0x808058
+  80464a:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80464c:	83 c4 10             	add    $0x10,%esp
+  80464f:	eb 25                	jmp    804676 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  804651:	83 ec 08             	sub    $0x8,%esp
+  804654:	c1 e0 16             	shl    $0x16,%eax
+  804657:	50                   	push   %eax
+  804658:	6a 00                	push   $0x0
+  80465a:	e8 93 d1 ff ff       	call   8017f2 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80465f:	83 c4 10             	add    $0x10,%esp
+  804662:	85 c0                	test   %eax,%eax
+  804664:	75 43                	jne    8046a9 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  804666:	83 ec 08             	sub    $0x8,%esp
+  804669:	57                   	push   %edi
+  80466a:	56                   	push   %esi
+  80466b:	ff 15 58 80 80 00    	call   *0x808058
+  804671:	89 c3                	mov    %eax,%ebx
+  804673:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  804676:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  804679:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80467f:	0f 86 ae 00 00 00    	jbe    804733 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  804685:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  80468a:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  804691:	81 e2 81 00 00 00    	and    $0x81,%edx
+  804697:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  80469d:	74 b2                	je     804651 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80469f:	83 c0 01             	add    $0x1,%eax
+  8046a2:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  8046a7:	75 e1                	jne    80468a <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  8046a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8046ac:	05 00 10 40 11       	add    $0x11401000,%eax
+  8046b1:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8046b6:	76 1f                	jbe    8046d7 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  8046b8:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  8046bd:	89 d8                	mov    %ebx,%eax
+  8046bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046c2:	5b                   	pop    %ebx
+  8046c3:	5e                   	pop    %esi
+  8046c4:	5f                   	pop    %edi
+  8046c5:	5d                   	pop    %ebp
+  8046c6:	c3                   	ret
+		sys_page_split(0, pg_out);
+  8046c7:	83 ec 08             	sub    $0x8,%esp
+  8046ca:	53                   	push   %ebx
+  8046cb:	6a 00                	push   $0x0
+  8046cd:	e8 20 d1 ff ff       	call   8017f2 <sys_page_split>
+  8046d2:	83 c4 10             	add    $0x10,%esp
+  8046d5:	eb 6c                	jmp    804743 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  8046d7:	83 ec 04             	sub    $0x4,%esp
+  8046da:	68 f8 6d 80 00       	push   $0x806df8
+  8046df:	68 cc 01 00 00       	push   $0x1cc
+  8046e4:	68 67 6d 80 00       	push   $0x806d67
+  8046e9:	e8 98 c3 ff ff       	call   800a86 <_panic>
+		panic("We tried to page out code pages\n");
+  8046ee:	83 ec 04             	sub    $0x4,%esp
+  8046f1:	68 28 6e 80 00       	push   $0x806e28
+  8046f6:	68 d6 01 00 00       	push   $0x1d6
+  8046fb:	68 67 6d 80 00       	push   $0x806d67
+  804700:	e8 81 c3 ff ff       	call   800a86 <_panic>
+		panic("Invalid mapping for the va\n");
+  804705:	83 ec 04             	sub    $0x4,%esp
+  804708:	68 74 6d 80 00       	push   $0x806d74
+  80470d:	68 da 01 00 00       	push   $0x1da
+  804712:	68 67 6d 80 00       	push   $0x806d67
+  804717:	e8 6a c3 ff ff       	call   800a86 <_panic>
+		panic("We tried to page out a shared page\n");
+  80471c:	83 ec 04             	sub    $0x4,%esp
+  80471f:	68 4c 6e 80 00       	push   $0x806e4c
+  804724:	68 e0 01 00 00       	push   $0x1e0
+  804729:	68 67 6d 80 00       	push   $0x806d67
+  80472e:	e8 53 c3 ff ff       	call   800a86 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  804733:	89 de                	mov    %ebx,%esi
+  804735:	c1 ee 16             	shr    $0x16,%esi
+  804738:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80473f:	a8 80                	test   $0x80,%al
+  804741:	75 84                	jne    8046c7 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  804743:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804746:	05 00 10 40 11       	add    $0x11401000,%eax
+  80474b:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  804750:	76 85                	jbe    8046d7 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  804752:	89 d8                	mov    %ebx,%eax
+  804754:	e8 7e f3 ff ff       	call   803ad7 <page_is_clean>
+  804759:	84 c0                	test   %al,%al
+  80475b:	0f 85 5c ff ff ff    	jne    8046bd <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  804761:	81 7d e4 2c 20 81 00 	cmpl   $0x81202c,-0x1c(%ebp)
+  804768:	76 84                	jbe    8046ee <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  80476a:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  804771:	a8 01                	test   $0x1,%al
+  804773:	74 90                	je     804705 <get_page_choice+0xd2>
+  804775:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804778:	c1 e8 0c             	shr    $0xc,%eax
+  80477b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  804782:	f6 c2 01             	test   $0x1,%dl
+  804785:	0f 84 7a ff ff ff    	je     804705 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  80478b:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  804792:	f6 c2 01             	test   $0x1,%dl
+  804795:	74 85                	je     80471c <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  804797:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  80479e:	f6 c2 01             	test   $0x1,%dl
+  8047a1:	0f 84 75 ff ff ff    	je     80471c <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8047a7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  8047ae:	f6 c6 04             	test   $0x4,%dh
+  8047b1:	0f 85 65 ff ff ff    	jne    80471c <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  8047b7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8047be:	f6 c6 02             	test   $0x2,%dh
+  8047c1:	0f 85 55 ff ff ff    	jne    80471c <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  8047c7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8047ce:	c1 e8 0c             	shr    $0xc,%eax
+  8047d1:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8047d4:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8047d9:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8047dd:	66 83 f8 01          	cmp    $0x1,%ax
+  8047e1:	0f 86 d6 fe ff ff    	jbe    8046bd <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  8047e7:	83 ec 04             	sub    $0x4,%esp
+  8047ea:	68 70 6e 80 00       	push   $0x806e70
+  8047ef:	68 e2 01 00 00       	push   $0x1e2
+  8047f4:	68 67 6d 80 00       	push   $0x806d67
+  8047f9:	e8 88 c2 ff ff       	call   800a86 <_panic>
+
+008047fe <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  8047fe:	55                   	push   %ebp
+  8047ff:	89 e5                	mov    %esp,%ebp
+  804801:	57                   	push   %edi
+  804802:	56                   	push   %esi
+  804803:	53                   	push   %ebx
+  804804:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  804807:	e8 e8 f6 ff ff       	call   803ef4 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  80480c:	a1 40 d0 80 00       	mov    0x80d040,%eax
+  804811:	85 c0                	test   %eax,%eax
+  804813:	74 41                	je     804856 <page_share_paged_out+0x58>
+  804815:	83 3d 14 09 81 00 00 	cmpl   $0x0,0x810914
+  80481c:	0f 84 fd 00 00 00    	je     80491f <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  804822:	c7 05 00 b0 80 00 00 	movl   $0x0,0x80b000
+  804829:	00 00 00 
+  80482c:	c7 05 00 c0 80 00 00 	movl   $0x0,0x80c000
+  804833:	00 00 00 
+  804836:	bf 00 00 00 00       	mov    $0x0,%edi
+  80483b:	eb 2c                	jmp    804869 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  80483d:	83 c3 04             	add    $0x4,%ebx
+  804840:	39 f3                	cmp    %esi,%ebx
+  804842:	74 1a                	je     80485e <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  804844:	8b 03                	mov    (%ebx),%eax
+  804846:	a8 01                	test   $0x1,%al
+  804848:	74 f3                	je     80483d <page_share_paged_out+0x3f>
+  80484a:	c1 e8 0c             	shr    $0xc,%eax
+  80484d:	e8 2b f5 ff ff       	call   803d7d <page_share_slot>
+  804852:	85 c0                	test   %eax,%eax
+  804854:	79 e7                	jns    80483d <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  804856:	83 c4 0c             	add    $0xc,%esp
+  804859:	5b                   	pop    %ebx
+  80485a:	5e                   	pop    %esi
+  80485b:	5f                   	pop    %edi
+  80485c:	5d                   	pop    %ebp
+  80485d:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  80485e:	83 c7 04             	add    $0x4,%edi
+  804861:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  804867:	74 1b                	je     804884 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  804869:	a1 14 09 81 00       	mov    0x810914,%eax
+  80486e:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  804871:	f6 c3 01             	test   $0x1,%bl
+  804874:	74 e8                	je     80485e <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  804876:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  80487c:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  804882:	eb bc                	jmp    804840 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  804884:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804889:	eb 11                	jmp    80489c <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  80488b:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  804891:	83 c3 01             	add    $0x1,%ebx
+  804894:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80489a:	77 41                	ja     8048dd <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  80489c:	89 d8                	mov    %ebx,%eax
+  80489e:	c1 e8 0a             	shr    $0xa,%eax
+  8048a1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8048a8:	25 81 00 00 00       	and    $0x81,%eax
+  8048ad:	83 f8 01             	cmp    $0x1,%eax
+  8048b0:	75 d9                	jne    80488b <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  8048b2:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8048b9:	25 81 00 00 00       	and    $0x81,%eax
+  8048be:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8048c3:	75 cc                	jne    804891 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  8048c5:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8048cc:	c1 e8 0c             	shr    $0xc,%eax
+  8048cf:	e8 a9 f4 ff ff       	call   803d7d <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  8048d4:	85 c0                	test   %eax,%eax
+  8048d6:	79 b9                	jns    804891 <page_share_paged_out+0x93>
+  8048d8:	e9 79 ff ff ff       	jmp    804856 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8048dd:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  8048e4:	75 13                	jne    8048f9 <page_share_paged_out+0xfb>
+  8048e6:	83 3d 00 c0 80 00 00 	cmpl   $0x0,0x80c000
+  8048ed:	75 1d                	jne    80490c <page_share_paged_out+0x10e>
+	return 0;
+  8048ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048f4:	e9 5d ff ff ff       	jmp    804856 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8048f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048fe:	e8 46 f4 ff ff       	call   803d49 <page_share_send>
+  804903:	85 c0                	test   %eax,%eax
+  804905:	79 df                	jns    8048e6 <page_share_paged_out+0xe8>
+  804907:	e9 4a ff ff ff       	jmp    804856 <page_share_paged_out+0x58>
+  80490c:	b8 01 00 00 00       	mov    $0x1,%eax
+  804911:	e8 33 f4 ff ff       	call   803d49 <page_share_send>
+  804916:	85 c0                	test   %eax,%eax
+  804918:	79 d5                	jns    8048ef <page_share_paged_out+0xf1>
+  80491a:	e9 37 ff ff ff       	jmp    804856 <page_share_paged_out+0x58>
+		return 0;
+  80491f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804924:	e9 2d ff ff ff       	jmp    804856 <page_share_paged_out+0x58>
+
+00804929 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  804929:	55                   	push   %ebp
+  80492a:	89 e5                	mov    %esp,%ebp
+  80492c:	56                   	push   %esi
+  80492d:	53                   	push   %ebx
+  80492e:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  804931:	e8 be f5 ff ff       	call   803ef4 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  804936:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  80493b:	83 3d 40 d0 80 00 00 	cmpl   $0x0,0x80d040
+  804942:	0f 84 82 00 00 00    	je     8049ca <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  804948:	83 ec 0c             	sub    $0xc,%esp
+  80494b:	68 00 10 00 00       	push   $0x1000
+  804950:	e8 84 11 00 00       	call   805ad9 <malloc>
+  804955:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  804957:	83 c4 0c             	add    $0xc,%esp
+  80495a:	6a 14                	push   $0x14
+  80495c:	6a 00                	push   $0x0
+  80495e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  804961:	50                   	push   %eax
+  804962:	e8 22 ca ff ff       	call   801389 <memset>
+  804967:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  80496a:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  80496f:	83 ec 0c             	sub    $0xc,%esp
+  804972:	6a 07                	push   $0x7
+  804974:	6a 01                	push   $0x1
+  804976:	53                   	push   %ebx
+  804977:	6a 03                	push   $0x3
+  804979:	ff 34 b5 44 d0 80 00 	push   0x80d044(,%esi,4)
+  804980:	e8 43 18 00 00       	call   8061c8 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  804985:	8b 03                	mov    (%ebx),%eax
+  804987:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  80498a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80498d:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  804990:	8b 43 08             	mov    0x8(%ebx),%eax
+  804993:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  804996:	8b 43 0c             	mov    0xc(%ebx),%eax
+  804999:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  80499c:	8b 43 10             	mov    0x10(%ebx),%eax
+  80499f:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  8049a2:	83 c6 01             	add    $0x1,%esi
+  8049a5:	83 c4 20             	add    $0x20,%esp
+  8049a8:	83 fe 02             	cmp    $0x2,%esi
+  8049ab:	75 c2                	jne    80496f <get_paging_stats+0x46>
+	}
+	*stats = total;
+  8049ad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8049b0:	89 03                	mov    %eax,(%ebx)
+  8049b2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8049b5:	89 43 04             	mov    %eax,0x4(%ebx)
+  8049b8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8049bb:	89 43 08             	mov    %eax,0x8(%ebx)
+  8049be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8049c1:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8049c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8049c7:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  8049ca:	89 d8                	mov    %ebx,%eax
+  8049cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8049cf:	5b                   	pop    %ebx
+  8049d0:	5e                   	pop    %esi
+  8049d1:	5d                   	pop    %ebp
+  8049d2:	c3                   	ret
+
+008049d3 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  8049d3:	55                   	push   %ebp
+  8049d4:	89 e5                	mov    %esp,%ebp
+  8049d6:	53                   	push   %ebx
+  8049d7:	83 ec 10             	sub    $0x10,%esp
+  8049da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  8049dd:	68 40 65 80 00       	push   $0x806540
+  8049e2:	e8 7a c1 ff ff       	call   800b61 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  8049e7:	83 c4 08             	add    $0x8,%esp
+  8049ea:	ff 33                	push   (%ebx)
+  8049ec:	68 a4 6e 80 00       	push   $0x806ea4
+  8049f1:	e8 6b c1 ff ff       	call   800b61 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  8049f6:	83 c4 08             	add    $0x8,%esp
+  8049f9:	ff 73 04             	push   0x4(%ebx)
+  8049fc:	68 90 6d 80 00       	push   $0x806d90
+  804a01:	e8 5b c1 ff ff       	call   800b61 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  804a06:	83 c4 08             	add    $0x8,%esp
+  804a09:	ff 73 08             	push   0x8(%ebx)
+  804a0c:	68 c4 6e 80 00       	push   $0x806ec4
+  804a11:	e8 4b c1 ff ff       	call   800b61 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  804a16:	83 c4 08             	add    $0x8,%esp
+  804a19:	ff 73 0c             	push   0xc(%ebx)
+  804a1c:	68 e8 6e 80 00       	push   $0x806ee8
+  804a21:	e8 3b c1 ff ff       	call   800b61 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  804a26:	83 c4 08             	add    $0x8,%esp
+  804a29:	ff 73 10             	push   0x10(%ebx)
+  804a2c:	68 0c 6f 80 00       	push   $0x806f0c
+  804a31:	e8 2b c1 ff ff       	call   800b61 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  804a36:	83 c4 08             	add    $0x8,%esp
+  804a39:	ff 35 08 d0 80 00    	push   0x80d008
+  804a3f:	68 48 6f 80 00       	push   $0x806f48
+  804a44:	e8 18 c1 ff ff       	call   800b61 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  804a49:	83 c4 08             	add    $0x8,%esp
+  804a4c:	ff 35 04 d0 80 00    	push   0x80d004
+  804a52:	68 7c 6f 80 00       	push   $0x806f7c
+  804a57:	e8 05 c1 ff ff       	call   800b61 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  804a5c:	a1 18 09 81 00       	mov    0x810918,%eax
+  804a61:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  804a64:	8b 50 68             	mov    0x68(%eax),%edx
+  804a67:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  804a6a:	51                   	push   %ecx
+  804a6b:	52                   	push   %edx
+  804a6c:	50                   	push   %eax
+  804a6d:	68 bc 6f 80 00       	push   $0x806fbc
+  804a72:	e8 ea c0 ff ff       	call   800b61 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  804a77:	a1 18 09 81 00       	mov    0x810918,%eax
+  804a7c:	8b 40 70             	mov    0x70(%eax),%eax
+  804a7f:	83 c4 18             	add    $0x18,%esp
+  804a82:	50                   	push   %eax
+  804a83:	68 f0 6f 80 00       	push   $0x806ff0
+  804a88:	e8 d4 c0 ff ff       	call   800b61 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  804a8d:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  804a93:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  804a99:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  804a9e:	51                   	push   %ecx
+  804a9f:	52                   	push   %edx
+  804aa0:	50                   	push   %eax
+  804aa1:	68 20 70 80 00       	push   $0x807020
+  804aa6:	e8 b6 c0 ff ff       	call   800b61 <cprintf>
+	cprintf("\n");
+  804aab:	83 c4 14             	add    $0x14,%esp
+  804aae:	68 40 65 80 00       	push   $0x806540
+  804ab3:	e8 a9 c0 ff ff       	call   800b61 <cprintf>
+}
+  804ab8:	83 c4 10             	add    $0x10,%esp
+  804abb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804abe:	c9                   	leave
+  804abf:	c3                   	ret
+
+00804ac0 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  804ac0:	55                   	push   %ebp
+  804ac1:	89 e5                	mov    %esp,%ebp
+  804ac3:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  804ac6:	e8 5e fe ff ff       	call   804929 <get_paging_stats>
+  804acb:	83 ec 0c             	sub    $0xc,%esp
+  804ace:	50                   	push   %eax
+  804acf:	e8 ff fe ff ff       	call   8049d3 <print_paging_stats>
+}
+  804ad4:	83 c4 10             	add    $0x10,%esp
+  804ad7:	c9                   	leave
+  804ad8:	c3                   	ret
+
+00804ad9 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  804ad9:	55                   	push   %ebp
+  804ada:	89 e5                	mov    %esp,%ebp
+  804adc:	53                   	push   %ebx
+  804add:	83 ec 04             	sub    $0x4,%esp
+  804ae0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  804ae3:	eb 13                	jmp    804af8 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  804ae5:	83 ec 04             	sub    $0x4,%esp
+  804ae8:	6a ff                	push   $0xffffffff
+  804aea:	53                   	push   %ebx
+  804aeb:	68 00 f0 ff ee       	push   $0xeefff000
+  804af0:	e8 0f d1 ff ff       	call   801c04 <sys_futex_wait>
+  804af5:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  804af8:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  804afd:	39 d8                	cmp    %ebx,%eax
+  804aff:	74 e4                	je     804ae5 <mem_pressure_wait+0xc>
+	return now;
+}
+  804b01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804b04:	c9                   	leave
+  804b05:	c3                   	ret
+
+00804b06 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  804b06:	55                   	push   %ebp
+  804b07:	89 e5                	mov    %esp,%ebp
+  804b09:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  804b0c:	68 78 57 80 00       	push   $0x805778
+  804b11:	e8 be 14 00 00       	call   805fd4 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  804b16:	c7 05 14 09 81 00 00 	movl   $0xdeadb000,0x810914
+  804b1d:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  804b20:	83 c4 0c             	add    $0xc,%esp
+  804b23:	68 07 02 00 00       	push   $0x207
+  804b28:	68 00 b0 ad de       	push   $0xdeadb000
+  804b2d:	6a 00                	push   $0x0
+  804b2f:	e8 f7 cb ff ff       	call   80172b <sys_page_alloc>
+  804b34:	83 c4 10             	add    $0x10,%esp
+  804b37:	85 c0                	test   %eax,%eax
+  804b39:	78 0c                	js     804b47 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  804b3b:	e8 b4 f3 ff ff       	call   803ef4 <find_paging_env>
+	page_ring_ready();
+  804b40:	e8 7f f2 ff ff       	call   803dc4 <page_ring_ready>
+}
+  804b45:	c9                   	leave
+  804b46:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  804b47:	50                   	push   %eax
+  804b48:	68 ae 6d 80 00       	push   $0x806dae
+  804b4d:	68 13 05 00 00       	push   $0x513
+  804b52:	68 67 6d 80 00       	push   $0x806d67
+  804b57:	e8 2a bf ff ff       	call   800a86 <_panic>
+
+00804b5c <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  804b5c:	55                   	push   %ebp
+  804b5d:	89 e5                	mov    %esp,%ebp
+  804b5f:	57                   	push   %edi
+  804b60:	56                   	push   %esi
+  804b61:	53                   	push   %ebx
+  804b62:	83 ec 0c             	sub    $0xc,%esp
+  804b65:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  804b68:	89 fa                	mov    %edi,%edx
+  804b6a:	c1 ea 16             	shr    $0x16,%edx
+  804b6d:	a1 14 09 81 00       	mov    0x810914,%eax
+  804b72:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  804b75:	f6 06 01             	testb  $0x1,(%esi)
+  804b78:	75 3e                	jne    804bb8 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  804b7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  804b7f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  804b83:	74 47                	je     804bcc <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  804b85:	83 ec 0c             	sub    $0xc,%esp
+  804b88:	6a 01                	push   $0x1
+  804b8a:	e8 f2 11 00 00       	call   805d81 <va_alloc>
+  804b8f:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  804b91:	83 c4 10             	add    $0x10,%esp
+  804b94:	85 c0                	test   %eax,%eax
+  804b96:	74 34                	je     804bcc <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  804b98:	6a 00                	push   $0x0
+  804b9a:	68 07 02 00 00       	push   $0x207
+  804b9f:	50                   	push   %eax
+  804ba0:	6a 00                	push   $0x0
+  804ba2:	e8 df 02 00 00       	call   804e86 <page_alloc>
+  804ba7:	83 c4 10             	add    $0x10,%esp
+  804baa:	85 c0                	test   %eax,%eax
+  804bac:	78 28                	js     804bd6 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  804bae:	f6 06 01             	testb  $0x1,(%esi)
+  804bb1:	75 38                	jne    804beb <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  804bb3:	83 cb 01             	or     $0x1,%ebx
+  804bb6:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  804bb8:	89 f8                	mov    %edi,%eax
+  804bba:	c1 e8 0a             	shr    $0xa,%eax
+  804bbd:	25 fc 0f 00 00       	and    $0xffc,%eax
+  804bc2:	8b 1e                	mov    (%esi),%ebx
+  804bc4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  804bca:	01 c3                	add    %eax,%ebx
+}
+  804bcc:	89 d8                	mov    %ebx,%eax
+  804bce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804bd1:	5b                   	pop    %ebx
+  804bd2:	5e                   	pop    %esi
+  804bd3:	5f                   	pop    %edi
+  804bd4:	5d                   	pop    %ebp
+  804bd5:	c3                   	ret
+			va_free(page, 1);
+  804bd6:	83 ec 08             	sub    $0x8,%esp
+  804bd9:	6a 01                	push   $0x1
+  804bdb:	53                   	push   %ebx
+  804bdc:	e8 d8 12 00 00       	call   805eb9 <va_free>
+			return NULL;
+  804be1:	83 c4 10             	add    $0x10,%esp
+  804be4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804be9:	eb e1                	jmp    804bcc <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  804beb:	83 ec 08             	sub    $0x8,%esp
+  804bee:	53                   	push   %ebx
+  804bef:	6a 00                	push   $0x0
+  804bf1:	e8 ba cb ff ff       	call   8017b0 <sys_page_unmap>
+			va_free(page, 1);
+  804bf6:	83 c4 08             	add    $0x8,%esp
+  804bf9:	6a 01                	push   $0x1
+  804bfb:	53                   	push   %ebx
+  804bfc:	e8 b8 12 00 00       	call   805eb9 <va_free>
+  804c01:	83 c4 10             	add    $0x10,%esp
+  804c04:	eb b2                	jmp    804bb8 <umapdir_walk+0x5c>
+
+00804c06 <page_out>:
+{
+  804c06:	55                   	push   %ebp
+  804c07:	89 e5                	mov    %esp,%ebp
+  804c09:	57                   	push   %edi
+  804c0a:	56                   	push   %esi
+  804c0b:	53                   	push   %ebx
+  804c0c:	83 ec 5c             	sub    $0x5c,%esp
+  804c0f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  804c12:	e8 dd f2 ff ff       	call   803ef4 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  804c17:	a1 40 d0 80 00       	mov    0x80d040,%eax
+  804c1c:	85 c0                	test   %eax,%eax
+  804c1e:	74 1e                	je     804c3e <page_out+0x38>
+  804c20:	83 ec 0c             	sub    $0xc,%esp
+  804c23:	6a 00                	push   $0x0
+  804c25:	6a 00                	push   $0x0
+  804c27:	6a 00                	push   $0x0
+  804c29:	6a 08                	push   $0x8
+  804c2b:	50                   	push   %eax
+  804c2c:	e8 97 15 00 00       	call   8061c8 <ipc_call>
+  804c31:	89 c3                	mov    %eax,%ebx
+  804c33:	83 c4 20             	add    $0x20,%esp
+  804c36:	85 c0                	test   %eax,%eax
+  804c38:	0f 84 ac 00 00 00    	je     804cea <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  804c3e:	83 ec 08             	sub    $0x8,%esp
+  804c41:	ff 75 0c             	push   0xc(%ebp)
+  804c44:	57                   	push   %edi
+  804c45:	e8 e9 f9 ff ff       	call   804633 <get_page_choice>
+  804c4a:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  804c4c:	83 c4 10             	add    $0x10,%esp
+  804c4f:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  804c54:	0f 84 18 02 00 00    	je     804e72 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  804c5a:	e8 78 ee ff ff       	call   803ad7 <page_is_clean>
+  804c5f:	84 c0                	test   %al,%al
+  804c61:	0f 85 8c 00 00 00    	jne    804cf3 <page_out+0xed>
+	if (pagingenv == 0)
+  804c67:	83 3d 40 d0 80 00 00 	cmpl   $0x0,0x80d040
+  804c6e:	0f 84 08 02 00 00    	je     804e7c <page_out+0x276>
+	if (page_ring_ready())
+  804c74:	e8 4b f1 ff ff       	call   803dc4 <page_ring_ready>
+  804c79:	89 c3                	mov    %eax,%ebx
+  804c7b:	85 c0                	test   %eax,%eax
+  804c7d:	0f 85 89 00 00 00    	jne    804d0c <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  804c83:	83 ec 0c             	sub    $0xc,%esp
+  804c86:	6a 05                	push   $0x5
+  804c88:	6a 01                	push   $0x1
+  804c8a:	56                   	push   %esi
+  804c8b:	6a 01                	push   $0x1
+  804c8d:	ff 35 40 d0 80 00    	push   0x80d040
+  804c93:	e8 30 15 00 00       	call   8061c8 <ipc_call>
+  804c98:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  804c9a:	83 c4 20             	add    $0x20,%esp
+  804c9d:	85 c0                	test   %eax,%eax
+  804c9f:	0f 88 b8 01 00 00    	js     804e5d <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  804ca5:	89 f0                	mov    %esi,%eax
+  804ca7:	c1 e8 0c             	shr    $0xc,%eax
+  804caa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804cb1:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  804cb4:	83 ec 08             	sub    $0x8,%esp
+  804cb7:	56                   	push   %esi
+  804cb8:	6a 00                	push   $0x0
+  804cba:	e8 f1 ca ff ff       	call   8017b0 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  804cbf:	83 c4 08             	add    $0x8,%esp
+  804cc2:	6a 01                	push   $0x1
+  804cc4:	56                   	push   %esi
+  804cc5:	e8 92 fe ff ff       	call   804b5c <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  804cca:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  804ccd:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  804cd3:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  804cd6:	09 fe                	or     %edi,%esi
+  804cd8:	83 ce 01             	or     $0x1,%esi
+  804cdb:	89 30                	mov    %esi,(%eax)
+	return 0;
+  804cdd:	83 c4 10             	add    $0x10,%esp
+}
+  804ce0:	89 d8                	mov    %ebx,%eax
+  804ce2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804ce5:	5b                   	pop    %ebx
+  804ce6:	5e                   	pop    %esi
+  804ce7:	5f                   	pop    %edi
+  804ce8:	5d                   	pop    %ebp
+  804ce9:	c3                   	ret
+		num_page_reclaims++;
+  804cea:	83 05 04 d0 80 00 01 	addl   $0x1,0x80d004
+		return 0;
+  804cf1:	eb ed                	jmp    804ce0 <page_out+0xda>
+		num_page_drops++;
+  804cf3:	83 05 08 d0 80 00 01 	addl   $0x1,0x80d008
+		return sys_page_unmap(0, map_out_addr);
+  804cfa:	83 ec 08             	sub    $0x8,%esp
+  804cfd:	56                   	push   %esi
+  804cfe:	6a 00                	push   $0x0
+  804d00:	e8 ab ca ff ff       	call   8017b0 <sys_page_unmap>
+  804d05:	89 c3                	mov    %eax,%ebx
+  804d07:	83 c4 10             	add    $0x10,%esp
+  804d0a:	eb d4                	jmp    804ce0 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  804d0c:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  804d0e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  804d13:	2d 00 10 00 00       	sub    $0x1000,%eax
+  804d18:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  804d1b:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  804d1d:	83 c0 08             	add    $0x8,%eax
+  804d20:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  804d23:	b8 07 00 00 00       	mov    $0x7,%eax
+  804d28:	e8 e5 ef ff ff       	call   803d12 <page_ring_reserve>
+	first = ring->sq_tail;
+  804d2d:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  804d32:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  804d35:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  804d3a:	83 ec 04             	sub    $0x4,%esp
+  804d3d:	68 00 10 00 00       	push   $0x1000
+  804d42:	56                   	push   %esi
+  804d43:	89 d8                	mov    %ebx,%eax
+  804d45:	c1 e0 0c             	shl    $0xc,%eax
+  804d48:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  804d4d:	50                   	push   %eax
+  804d4e:	e8 cd c6 ff ff       	call   801420 <memcpy>
+		vas[n] = va;
+  804d53:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  804d57:	89 d9                	mov    %ebx,%ecx
+  804d59:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d5e:	b8 01 00 00 00       	mov    $0x1,%eax
+  804d63:	e8 de ee ff ff       	call   803c46 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  804d68:	8d 43 01             	lea    0x1(%ebx),%eax
+  804d6b:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  804d6e:	83 c4 10             	add    $0x10,%esp
+  804d71:	83 fb 06             	cmp    $0x6,%ebx
+  804d74:	74 62                	je     804dd8 <page_out+0x1d2>
+  804d76:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  804d79:	eb 15                	jmp    804d90 <page_out+0x18a>
+			num_page_drops++;
+  804d7b:	83 05 08 d0 80 00 01 	addl   $0x1,0x80d008
+			sys_page_unmap(0, va);
+  804d82:	83 ec 08             	sub    $0x8,%esp
+  804d85:	56                   	push   %esi
+  804d86:	6a 00                	push   $0x0
+  804d88:	e8 23 ca ff ff       	call   8017b0 <sys_page_unmap>
+  804d8d:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  804d90:	83 ec 08             	sub    $0x8,%esp
+  804d93:	53                   	push   %ebx
+  804d94:	57                   	push   %edi
+  804d95:	e8 99 f8 ff ff       	call   804633 <get_page_choice>
+  804d9a:	89 c6                	mov    %eax,%esi
+  804d9c:	83 c4 10             	add    $0x10,%esp
+  804d9f:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  804da4:	74 32                	je     804dd8 <page_out+0x1d2>
+  804da6:	e8 2c ed ff ff       	call   803ad7 <page_is_clean>
+  804dab:	84 c0                	test   %al,%al
+  804dad:	75 cc                	jne    804d7b <page_out+0x175>
+		if (va == (void *) UTOP ||
+  804daf:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  804db2:	39 c6                	cmp    %eax,%esi
+  804db4:	72 07                	jb     804dbd <page_out+0x1b7>
+  804db6:	8b 45 98             	mov    -0x68(%ebp),%eax
+  804db9:	39 c6                	cmp    %eax,%esi
+  804dbb:	72 1b                	jb     804dd8 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  804dbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804dc2:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  804dc5:	eb 03                	jmp    804dca <page_out+0x1c4>
+  804dc7:	83 c3 01             	add    $0x1,%ebx
+  804dca:	39 da                	cmp    %ebx,%edx
+  804dcc:	0f 84 68 ff ff ff    	je     804d3a <page_out+0x134>
+  804dd2:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  804dd6:	75 ef                	jne    804dc7 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  804dd8:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  804ddb:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  804dde:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  804de1:	e8 a6 ee ff ff       	call   803c8c <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  804de6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804deb:	eb 42                	jmp    804e2f <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  804ded:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  804df1:	89 f8                	mov    %edi,%eax
+  804df3:	c1 e8 0c             	shr    $0xc,%eax
+  804df6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804dfd:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  804e00:	83 ec 08             	sub    $0x8,%esp
+  804e03:	57                   	push   %edi
+  804e04:	6a 00                	push   $0x0
+  804e06:	e8 a5 c9 ff ff       	call   8017b0 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  804e0b:	83 c4 08             	add    $0x8,%esp
+  804e0e:	6a 01                	push   $0x1
+  804e10:	57                   	push   %edi
+  804e11:	e8 46 fd ff ff       	call   804b5c <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  804e16:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  804e19:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  804e1f:	c1 e6 0c             	shl    $0xc,%esi
+  804e22:	09 d6                	or     %edx,%esi
+  804e24:	83 ce 01             	or     $0x1,%esi
+  804e27:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  804e29:	83 c3 01             	add    $0x1,%ebx
+  804e2c:	83 c4 10             	add    $0x10,%esp
+  804e2f:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  804e32:	39 c3                	cmp    %eax,%ebx
+  804e34:	74 1d                	je     804e53 <page_out+0x24d>
+		if (res[i] < 0)
+  804e36:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  804e3a:	85 f6                	test   %esi,%esi
+  804e3c:	79 af                	jns    804ded <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  804e3e:	56                   	push   %esi
+  804e3f:	68 50 70 80 00       	push   $0x807050
+  804e44:	68 d1 02 00 00       	push   $0x2d1
+  804e49:	68 67 6d 80 00       	push   $0x806d67
+  804e4e:	e8 33 bc ff ff       	call   800a86 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  804e53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804e58:	e9 83 fe ff ff       	jmp    804ce0 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  804e5d:	50                   	push   %eax
+  804e5e:	68 50 70 80 00       	push   $0x807050
+  804e63:	68 0a 03 00 00       	push   $0x30a
+  804e68:	68 67 6d 80 00       	push   $0x806d67
+  804e6d:	e8 14 bc ff ff       	call   800a86 <_panic>
+		return -E_NO_MEM;
+  804e72:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  804e77:	e9 64 fe ff ff       	jmp    804ce0 <page_out+0xda>
+		return -E_PAGING;
+  804e7c:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  804e81:	e9 5a fe ff ff       	jmp    804ce0 <page_out+0xda>
+
+00804e86 <page_alloc>:
+{
+  804e86:	55                   	push   %ebp
+  804e87:	89 e5                	mov    %esp,%ebp
+  804e89:	57                   	push   %edi
+  804e8a:	56                   	push   %esi
+  804e8b:	53                   	push   %ebx
+  804e8c:	83 ec 0c             	sub    $0xc,%esp
+  804e8f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804e92:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  804e95:	83 3d 14 09 81 00 00 	cmpl   $0x0,0x810914
+  804e9c:	74 34                	je     804ed2 <page_alloc+0x4c>
+	if (check_mte)
+  804e9e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  804ea2:	75 35                	jne    804ed9 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  804ea4:	83 ec 04             	sub    $0x4,%esp
+  804ea7:	ff 75 10             	push   0x10(%ebp)
+  804eaa:	56                   	push   %esi
+  804eab:	57                   	push   %edi
+  804eac:	e8 7a c8 ff ff       	call   80172b <sys_page_alloc>
+  804eb1:	89 c3                	mov    %eax,%ebx
+  804eb3:	83 c4 10             	add    $0x10,%esp
+  804eb6:	85 c0                	test   %eax,%eax
+  804eb8:	79 52                	jns    804f0c <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  804eba:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804ebd:	75 52                	jne    804f11 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  804ebf:	83 ec 08             	sub    $0x8,%esp
+  804ec2:	56                   	push   %esi
+  804ec3:	57                   	push   %edi
+  804ec4:	e8 3d fd ff ff       	call   804c06 <page_out>
+  804ec9:	83 c4 10             	add    $0x10,%esp
+  804ecc:	85 c0                	test   %eax,%eax
+  804ece:	79 d4                	jns    804ea4 <page_alloc+0x1e>
+  804ed0:	eb 3f                	jmp    804f11 <page_alloc+0x8b>
+		init_map_dir();
+  804ed2:	e8 2f fc ff ff       	call   804b06 <init_map_dir>
+  804ed7:	eb c5                	jmp    804e9e <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  804ed9:	83 ec 08             	sub    $0x8,%esp
+  804edc:	6a 00                	push   $0x0
+  804ede:	56                   	push   %esi
+  804edf:	e8 78 fc ff ff       	call   804b5c <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  804ee4:	83 c4 10             	add    $0x10,%esp
+  804ee7:	85 c0                	test   %eax,%eax
+  804ee9:	74 b9                	je     804ea4 <page_alloc+0x1e>
+  804eeb:	8b 10                	mov    (%eax),%edx
+  804eed:	f6 c2 01             	test   $0x1,%dl
+  804ef0:	74 b2                	je     804ea4 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  804ef2:	83 ec 08             	sub    $0x8,%esp
+  804ef5:	56                   	push   %esi
+  804ef6:	52                   	push   %edx
+  804ef7:	50                   	push   %eax
+  804ef8:	68 74 70 80 00       	push   $0x807074
+  804efd:	68 34 03 00 00       	push   $0x334
+  804f02:	68 67 6d 80 00       	push   $0x806d67
+  804f07:	e8 7a bb ff ff       	call   800a86 <_panic>
+	return 0;
+  804f0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  804f11:	89 d8                	mov    %ebx,%eax
+  804f13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804f16:	5b                   	pop    %ebx
+  804f17:	5e                   	pop    %esi
+  804f18:	5f                   	pop    %edi
+  804f19:	5d                   	pop    %ebp
+  804f1a:	c3                   	ret
+
+00804f1b <page_adopt>:
+{
+  804f1b:	55                   	push   %ebp
+  804f1c:	89 e5                	mov    %esp,%ebp
+  804f1e:	56                   	push   %esi
+  804f1f:	53                   	push   %ebx
+  804f20:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  804f22:	c1 e8 16             	shr    $0x16,%eax
+  804f25:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  804f2c:	25 81 00 00 00       	and    $0x81,%eax
+  804f31:	83 f8 01             	cmp    $0x1,%eax
+  804f34:	75 53                	jne    804f89 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  804f36:	89 d8                	mov    %ebx,%eax
+  804f38:	c1 e8 0c             	shr    $0xc,%eax
+  804f3b:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  804f42:	89 f2                	mov    %esi,%edx
+  804f44:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  804f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  804f4f:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  804f55:	75 37                	jne    804f8e <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  804f57:	83 ec 08             	sub    $0x8,%esp
+  804f5a:	6a 01                	push   $0x1
+  804f5c:	53                   	push   %ebx
+  804f5d:	e8 fa fb ff ff       	call   804b5c <umapdir_walk>
+  804f62:	83 c4 10             	add    $0x10,%esp
+  804f65:	85 c0                	test   %eax,%eax
+  804f67:	74 2c                	je     804f95 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  804f69:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  804f6f:	83 ce 01             	or     $0x1,%esi
+  804f72:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  804f74:	83 ec 08             	sub    $0x8,%esp
+  804f77:	53                   	push   %ebx
+  804f78:	6a 00                	push   $0x0
+  804f7a:	e8 31 c8 ff ff       	call   8017b0 <sys_page_unmap>
+	return 1;
+  804f7f:	83 c4 10             	add    $0x10,%esp
+  804f82:	b8 01 00 00 00       	mov    $0x1,%eax
+  804f87:	eb 05                	jmp    804f8e <page_adopt+0x73>
+		return 0;
+  804f89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f8e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804f91:	5b                   	pop    %ebx
+  804f92:	5e                   	pop    %esi
+  804f93:	5d                   	pop    %ebp
+  804f94:	c3                   	ret
+		return -E_NO_MEM;
+  804f95:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  804f9a:	eb f2                	jmp    804f8e <page_adopt+0x73>
+
+00804f9c <page_forget>:
+{
+  804f9c:	55                   	push   %ebp
+  804f9d:	89 e5                	mov    %esp,%ebp
+  804f9f:	53                   	push   %ebx
+  804fa0:	83 ec 04             	sub    $0x4,%esp
+  804fa3:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  804fa5:	e8 4a ef ff ff       	call   803ef4 <find_paging_env>
+	if (pagingenv == 0)
+  804faa:	83 3d 40 d0 80 00 00 	cmpl   $0x0,0x80d040
+  804fb1:	74 39                	je     804fec <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  804fb3:	89 d8                	mov    %ebx,%eax
+  804fb5:	c1 e8 16             	shr    $0x16,%eax
+  804fb8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  804fbf:	25 81 00 00 00       	and    $0x81,%eax
+  804fc4:	83 f8 01             	cmp    $0x1,%eax
+  804fc7:	74 28                	je     804ff1 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  804fc9:	83 3d 14 09 81 00 00 	cmpl   $0x0,0x810914
+  804fd0:	74 1a                	je     804fec <page_forget+0x50>
+  804fd2:	83 ec 08             	sub    $0x8,%esp
+  804fd5:	6a 00                	push   $0x0
+  804fd7:	53                   	push   %ebx
+  804fd8:	e8 7f fb ff ff       	call   804b5c <umapdir_walk>
+  804fdd:	89 c3                	mov    %eax,%ebx
+  804fdf:	83 c4 10             	add    $0x10,%esp
+  804fe2:	85 c0                	test   %eax,%eax
+  804fe4:	74 06                	je     804fec <page_forget+0x50>
+  804fe6:	8b 00                	mov    (%eax),%eax
+  804fe8:	a8 01                	test   $0x1,%al
+  804fea:	75 2b                	jne    805017 <page_forget+0x7b>
+}
+  804fec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804fef:	c9                   	leave
+  804ff0:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  804ff1:	89 d8                	mov    %ebx,%eax
+  804ff3:	c1 e8 0c             	shr    $0xc,%eax
+  804ff6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804ffd:	89 c2                	mov    %eax,%edx
+  804fff:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  805005:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  80500b:	75 bc                	jne    804fc9 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  80500d:	c1 e8 0c             	shr    $0xc,%eax
+  805010:	e8 5c ee ff ff       	call   803e71 <page_remove_slot>
+		return;
+  805015:	eb d5                	jmp    804fec <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  805017:	c1 e8 0c             	shr    $0xc,%eax
+  80501a:	e8 52 ee ff ff       	call   803e71 <page_remove_slot>
+	*mte = 0;
+  80501f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  805025:	eb c5                	jmp    804fec <page_forget+0x50>
+
+00805027 <page_unmap>:
+{
+  805027:	55                   	push   %ebp
+  805028:	89 e5                	mov    %esp,%ebp
+  80502a:	57                   	push   %edi
+  80502b:	56                   	push   %esi
+  80502c:	53                   	push   %ebx
+  80502d:	83 ec 0c             	sub    $0xc,%esp
+  805030:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  805033:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  805036:	a1 18 09 81 00       	mov    0x810918,%eax
+  80503b:	8b 40 48             	mov    0x48(%eax),%eax
+  80503e:	85 db                	test   %ebx,%ebx
+  805040:	0f 8e b4 00 00 00    	jle    8050fa <page_unmap+0xd3>
+  805046:	39 d8                	cmp    %ebx,%eax
+  805048:	0f 84 ac 00 00 00    	je     8050fa <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  80504e:	83 ec 08             	sub    $0x8,%esp
+  805051:	57                   	push   %edi
+  805052:	53                   	push   %ebx
+  805053:	e8 58 c7 ff ff       	call   8017b0 <sys_page_unmap>
+  805058:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  80505a:	e8 95 ee ff ff       	call   803ef4 <find_paging_env>
+	if (pagingenv == 0)
+  80505f:	83 c4 10             	add    $0x10,%esp
+  805062:	83 3d 40 d0 80 00 00 	cmpl   $0x0,0x80d040
+  805069:	0f 84 a1 00 00 00    	je     805110 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80506f:	83 ec 0c             	sub    $0xc,%esp
+  805072:	6a 05                	push   $0x5
+  805074:	68 00 00 40 00       	push   $0x400000
+  805079:	6a 00                	push   $0x0
+  80507b:	68 00 b0 ad de       	push   $0xdeadb000
+  805080:	53                   	push   %ebx
+  805081:	e8 e8 c6 ff ff       	call   80176e <sys_page_map>
+  805086:	83 c4 20             	add    $0x20,%esp
+  805089:	85 c0                	test   %eax,%eax
+  80508b:	0f 88 89 00 00 00    	js     80511a <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  805091:	89 f8                	mov    %edi,%eax
+  805093:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  805096:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  80509d:	a8 01                	test   $0x1,%al
+  80509f:	74 6f                	je     805110 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8050a1:	83 ec 0c             	sub    $0xc,%esp
+  8050a4:	6a 05                	push   $0x5
+  8050a6:	68 00 00 40 00       	push   $0x400000
+  8050ab:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8050ad:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8050b2:	50                   	push   %eax
+  8050b3:	53                   	push   %ebx
+  8050b4:	e8 b5 c6 ff ff       	call   80176e <sys_page_map>
+  8050b9:	83 c4 20             	add    $0x20,%esp
+  8050bc:	85 c0                	test   %eax,%eax
+  8050be:	78 6f                	js     80512f <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  8050c0:	c1 ef 0c             	shr    $0xc,%edi
+  8050c3:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8050c9:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  8050d0:	01 
+  8050d1:	74 3d                	je     805110 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  8050d3:	83 ec 08             	sub    $0x8,%esp
+  8050d6:	68 00 00 40 00       	push   $0x400000
+  8050db:	6a 00                	push   $0x0
+  8050dd:	e8 ce c6 ff ff       	call   8017b0 <sys_page_unmap>
+  8050e2:	83 c4 10             	add    $0x10,%esp
+  8050e5:	85 c0                	test   %eax,%eax
+  8050e7:	78 5b                	js     805144 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  8050e9:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  8050f0:	c1 e8 0c             	shr    $0xc,%eax
+  8050f3:	e8 79 ed ff ff       	call   803e71 <page_remove_slot>
+	return r;
+  8050f8:	eb 16                	jmp    805110 <page_unmap+0xe9>
+		page_forget(va);
+  8050fa:	89 f8                	mov    %edi,%eax
+  8050fc:	e8 9b fe ff ff       	call   804f9c <page_forget>
+		return sys_page_unmap(envid, va);
+  805101:	83 ec 08             	sub    $0x8,%esp
+  805104:	57                   	push   %edi
+  805105:	53                   	push   %ebx
+  805106:	e8 a5 c6 ff ff       	call   8017b0 <sys_page_unmap>
+  80510b:	89 c6                	mov    %eax,%esi
+  80510d:	83 c4 10             	add    $0x10,%esp
+}
+  805110:	89 f0                	mov    %esi,%eax
+  805112:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805115:	5b                   	pop    %ebx
+  805116:	5e                   	pop    %esi
+  805117:	5f                   	pop    %edi
+  805118:	5d                   	pop    %ebp
+  805119:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  80511a:	50                   	push   %eax
+  80511b:	68 b0 70 80 00       	push   $0x8070b0
+  805120:	68 e4 03 00 00       	push   $0x3e4
+  805125:	68 67 6d 80 00       	push   $0x806d67
+  80512a:	e8 57 b9 ff ff       	call   800a86 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  80512f:	50                   	push   %eax
+  805130:	68 dc 70 80 00       	push   $0x8070dc
+  805135:	68 ea 03 00 00       	push   $0x3ea
+  80513a:	68 67 6d 80 00       	push   $0x806d67
+  80513f:	e8 42 b9 ff ff       	call   800a86 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  805144:	50                   	push   %eax
+  805145:	68 08 71 80 00       	push   $0x807108
+  80514a:	68 ef 03 00 00       	push   $0x3ef
+  80514f:	68 67 6d 80 00       	push   $0x806d67
+  805154:	e8 2d b9 ff ff       	call   800a86 <_panic>
+
+00805159 <page_unmap_range>:
+{
+  805159:	55                   	push   %ebp
+  80515a:	89 e5                	mov    %esp,%ebp
+  80515c:	57                   	push   %edi
+  80515d:	56                   	push   %esi
+  80515e:	53                   	push   %ebx
+  80515f:	83 ec 0c             	sub    $0xc,%esp
+  805162:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  805165:	e8 8a ed ff ff       	call   803ef4 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  80516a:	a1 18 09 81 00       	mov    0x810918,%eax
+  80516f:	8b 40 48             	mov    0x48(%eax),%eax
+  805172:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  805176:	7e 38                	jle    8051b0 <page_unmap_range+0x57>
+  805178:	3b 45 08             	cmp    0x8(%ebp),%eax
+  80517b:	74 33                	je     8051b0 <page_unmap_range+0x57>
+  80517d:	83 3d 40 d0 80 00 00 	cmpl   $0x0,0x80d040
+  805184:	74 2a                	je     8051b0 <page_unmap_range+0x57>
+  805186:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  805189:	be 00 00 00 00       	mov    $0x0,%esi
+  80518e:	39 fe                	cmp    %edi,%esi
+  805190:	74 56                	je     8051e8 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  805192:	83 ec 08             	sub    $0x8,%esp
+  805195:	53                   	push   %ebx
+  805196:	ff 75 08             	push   0x8(%ebp)
+  805199:	e8 89 fe ff ff       	call   805027 <page_unmap>
+  80519e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8051a4:	83 c4 10             	add    $0x10,%esp
+  8051a7:	85 c0                	test   %eax,%eax
+  8051a9:	78 35                	js     8051e0 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  8051ab:	83 c6 01             	add    $0x1,%esi
+  8051ae:	eb de                	jmp    80518e <page_unmap_range+0x35>
+  8051b0:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  8051b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8051b8:	eb 10                	jmp    8051ca <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  8051ba:	89 f0                	mov    %esi,%eax
+  8051bc:	e8 db fd ff ff       	call   804f9c <page_forget>
+		for (i = 0; i < npages; i++)
+  8051c1:	83 c3 01             	add    $0x1,%ebx
+  8051c4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8051ca:	39 fb                	cmp    %edi,%ebx
+  8051cc:	75 ec                	jne    8051ba <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  8051ce:	83 ec 04             	sub    $0x4,%esp
+  8051d1:	57                   	push   %edi
+  8051d2:	ff 75 0c             	push   0xc(%ebp)
+  8051d5:	ff 75 08             	push   0x8(%ebp)
+  8051d8:	e8 e7 c6 ff ff       	call   8018c4 <sys_page_unmap_range>
+  8051dd:	83 c4 10             	add    $0x10,%esp
+}
+  8051e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8051e3:	5b                   	pop    %ebx
+  8051e4:	5e                   	pop    %esi
+  8051e5:	5f                   	pop    %edi
+  8051e6:	5d                   	pop    %ebp
+  8051e7:	c3                   	ret
+	return 0;
+  8051e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051ed:	eb f1                	jmp    8051e0 <page_unmap_range+0x87>
+
+008051ef <page_alloc_range>:
+{
+  8051ef:	55                   	push   %ebp
+  8051f0:	89 e5                	mov    %esp,%ebp
+  8051f2:	57                   	push   %edi
+  8051f3:	56                   	push   %esi
+  8051f4:	53                   	push   %ebx
+  8051f5:	83 ec 1c             	sub    $0x1c,%esp
+  8051f8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8051fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  8051fe:	83 3d 14 09 81 00 00 	cmpl   $0x0,0x810914
+  805205:	74 14                	je     80521b <page_alloc_range+0x2c>
+	if (check_mte)
+  805207:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80520b:	74 66                	je     805273 <page_alloc_range+0x84>
+  80520d:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  80520f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805214:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  805217:	89 c7                	mov    %eax,%edi
+  805219:	eb 10                	jmp    80522b <page_alloc_range+0x3c>
+		init_map_dir();
+  80521b:	e8 e6 f8 ff ff       	call   804b06 <init_map_dir>
+  805220:	eb e5                	jmp    805207 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  805222:	83 c7 01             	add    $0x1,%edi
+  805225:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80522b:	39 df                	cmp    %ebx,%edi
+  80522d:	74 38                	je     805267 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  80522f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  805232:	83 ec 08             	sub    $0x8,%esp
+  805235:	6a 00                	push   $0x0
+  805237:	56                   	push   %esi
+  805238:	e8 1f f9 ff ff       	call   804b5c <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  80523d:	83 c4 10             	add    $0x10,%esp
+  805240:	85 c0                	test   %eax,%eax
+  805242:	74 de                	je     805222 <page_alloc_range+0x33>
+  805244:	8b 10                	mov    (%eax),%edx
+  805246:	f6 c2 01             	test   $0x1,%dl
+  805249:	74 d7                	je     805222 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  80524b:	83 ec 08             	sub    $0x8,%esp
+  80524e:	ff 75 e4             	push   -0x1c(%ebp)
+  805251:	52                   	push   %edx
+  805252:	50                   	push   %eax
+  805253:	68 74 70 80 00       	push   $0x807074
+  805258:	68 0b 04 00 00       	push   $0x40b
+  80525d:	68 67 6d 80 00       	push   $0x806d67
+  805262:	e8 1f b8 ff ff       	call   800a86 <_panic>
+  805267:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80526a:	eb 07                	jmp    805273 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  80526c:	c1 e0 0c             	shl    $0xc,%eax
+  80526f:	01 c7                	add    %eax,%edi
+			npages -= r;
+  805271:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  805273:	85 db                	test   %ebx,%ebx
+  805275:	74 30                	je     8052a7 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  805277:	ff 75 14             	push   0x14(%ebp)
+  80527a:	53                   	push   %ebx
+  80527b:	57                   	push   %edi
+  80527c:	ff 75 08             	push   0x8(%ebp)
+  80527f:	e8 d2 c5 ff ff       	call   801856 <sys_page_alloc_range>
+  805284:	89 c6                	mov    %eax,%esi
+  805286:	83 c4 10             	add    $0x10,%esp
+  805289:	85 c0                	test   %eax,%eax
+  80528b:	7f df                	jg     80526c <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  80528d:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  805290:	75 1a                	jne    8052ac <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  805292:	83 ec 08             	sub    $0x8,%esp
+  805295:	57                   	push   %edi
+  805296:	ff 75 08             	push   0x8(%ebp)
+  805299:	e8 68 f9 ff ff       	call   804c06 <page_out>
+  80529e:	83 c4 10             	add    $0x10,%esp
+  8052a1:	85 c0                	test   %eax,%eax
+  8052a3:	79 ce                	jns    805273 <page_alloc_range+0x84>
+  8052a5:	eb 05                	jmp    8052ac <page_alloc_range+0xbd>
+	return 0;
+  8052a7:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8052ac:	89 f0                	mov    %esi,%eax
+  8052ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8052b1:	5b                   	pop    %ebx
+  8052b2:	5e                   	pop    %esi
+  8052b3:	5f                   	pop    %edi
+  8052b4:	5d                   	pop    %ebp
+  8052b5:	c3                   	ret
+
+008052b6 <page_in>:
+{
+  8052b6:	55                   	push   %ebp
+  8052b7:	89 e5                	mov    %esp,%ebp
+  8052b9:	57                   	push   %edi
+  8052ba:	56                   	push   %esi
+  8052bb:	53                   	push   %ebx
+  8052bc:	83 ec 3c             	sub    $0x3c,%esp
+  8052bf:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  8052c2:	e8 2d ec ff ff       	call   803ef4 <find_paging_env>
+	if (pagingenv == 0)
+  8052c7:	83 3d 40 d0 80 00 00 	cmpl   $0x0,0x80d040
+  8052ce:	0f 84 09 02 00 00    	je     8054dd <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  8052d4:	83 ec 08             	sub    $0x8,%esp
+  8052d7:	6a 00                	push   $0x0
+  8052d9:	56                   	push   %esi
+  8052da:	e8 7d f8 ff ff       	call   804b5c <umapdir_walk>
+  8052df:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8052e1:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8052e7:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  8052ea:	83 c4 10             	add    $0x10,%esp
+  8052ed:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8052f1:	74 0d                	je     805300 <page_in+0x4a>
+  8052f3:	a1 18 09 81 00       	mov    0x810918,%eax
+  8052f8:	8b 40 48             	mov    0x48(%eax),%eax
+  8052fb:	3b 45 08             	cmp    0x8(%ebp),%eax
+  8052fe:	75 06                	jne    805306 <page_in+0x50>
+  805300:	8b 03                	mov    (%ebx),%eax
+  805302:	a8 02                	test   $0x2,%al
+  805304:	75 63                	jne    805369 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  805306:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  805308:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  80530a:	89 f0                	mov    %esi,%eax
+  80530c:	25 06 0e 00 00       	and    $0xe06,%eax
+  805311:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  805314:	50                   	push   %eax
+  805315:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  805318:	57                   	push   %edi
+  805319:	ff 75 08             	push   0x8(%ebp)
+  80531c:	e8 65 fb ff ff       	call   804e86 <page_alloc>
+  805321:	83 c4 10             	add    $0x10,%esp
+  805324:	85 c0                	test   %eax,%eax
+  805326:	78 39                	js     805361 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  805328:	89 f0                	mov    %esi,%eax
+  80532a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  80532d:	83 ec 0c             	sub    $0xc,%esp
+  805330:	6a 07                	push   $0x7
+  805332:	6a 01                	push   $0x1
+  805334:	57                   	push   %edi
+  805335:	c1 e0 04             	shl    $0x4,%eax
+  805338:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  805339:	c1 ee 1c             	shr    $0x1c,%esi
+  80533c:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  80533f:	ff 34 b5 44 d0 80 00 	push   0x80d044(,%esi,4)
+  805346:	e8 7d 0e 00 00       	call   8061c8 <ipc_call>
+  80534b:	83 c4 20             	add    $0x20,%esp
+  80534e:	85 c0                	test   %eax,%eax
+  805350:	0f 88 72 01 00 00    	js     8054c8 <page_in+0x212>
+	*mte = 0;
+  805356:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  80535c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805361:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805364:	5b                   	pop    %ebx
+  805365:	5e                   	pop    %esi
+  805366:	5f                   	pop    %edi
+  805367:	5d                   	pop    %ebp
+  805368:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  805369:	25 06 0e 00 00       	and    $0xe06,%eax
+  80536e:	83 c8 01             	or     $0x1,%eax
+  805371:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  805374:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  805377:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80537a:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  805380:	be 01 00 00 00       	mov    $0x1,%esi
+  805385:	eb 46                	jmp    8053cd <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  805387:	83 ec 08             	sub    $0x8,%esp
+  80538a:	6a 00                	push   $0x0
+  80538c:	51                   	push   %ecx
+  80538d:	e8 ca f7 ff ff       	call   804b5c <umapdir_walk>
+  805392:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  805396:	83 c4 10             	add    $0x10,%esp
+  805399:	85 c0                	test   %eax,%eax
+  80539b:	74 66                	je     805403 <page_in+0x14d>
+  80539d:	8b 00                	mov    (%eax),%eax
+  80539f:	a8 01                	test   $0x1,%al
+  8053a1:	74 60                	je     805403 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  8053a3:	89 c2                	mov    %eax,%edx
+  8053a5:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  8053ab:	83 ca 01             	or     $0x1,%edx
+  8053ae:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  8053b1:	75 50                	jne    805403 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  8053b3:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8053b9:	c1 e8 1c             	shr    $0x1c,%eax
+  8053bc:	8b 13                	mov    (%ebx),%edx
+  8053be:	c1 ea 1c             	shr    $0x1c,%edx
+  8053c1:	39 d0                	cmp    %edx,%eax
+  8053c3:	75 3e                	jne    805403 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  8053c5:	83 c6 01             	add    $0x1,%esi
+  8053c8:	83 fe 08             	cmp    $0x8,%esi
+  8053cb:	74 3f                	je     80540c <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  8053cd:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8053cf:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  8053d5:	77 2c                	ja     805403 <page_in+0x14d>
+  8053d7:	89 f8                	mov    %edi,%eax
+  8053d9:	c1 e8 16             	shr    $0x16,%eax
+  8053dc:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8053e3:	f6 c2 01             	test   $0x1,%dl
+  8053e6:	74 9f                	je     805387 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  8053e8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8053ef:	a8 80                	test   $0x80,%al
+  8053f1:	75 10                	jne    805403 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  8053f3:	89 f8                	mov    %edi,%eax
+  8053f5:	c1 e8 0c             	shr    $0xc,%eax
+  8053f8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8053ff:	a8 01                	test   $0x1,%al
+  805401:	74 84                	je     805387 <page_in+0xd1>
+	if (n == 1)
+  805403:	83 fe 01             	cmp    $0x1,%esi
+  805406:	0f 84 fa fe ff ff    	je     805306 <page_in+0x50>
+	req.nslots = n;
+  80540c:	89 35 00 a0 80 00    	mov    %esi,0x80a000
+	for (i = 0; i < n; i++)
+  805412:	b8 00 00 00 00       	mov    $0x0,%eax
+  805417:	eb 13                	jmp    80542c <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  805419:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  80541d:	8b 12                	mov    (%edx),%edx
+  80541f:	c1 ea 0c             	shr    $0xc,%edx
+  805422:	89 14 85 04 a0 80 00 	mov    %edx,0x80a004(,%eax,4)
+	for (i = 0; i < n; i++)
+  805429:	83 c0 01             	add    $0x1,%eax
+  80542c:	39 c6                	cmp    %eax,%esi
+  80542e:	75 e9                	jne    805419 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  805430:	83 ec 0c             	sub    $0xc,%esp
+  805433:	6a 00                	push   $0x0
+  805435:	ff 75 c0             	push   -0x40(%ebp)
+  805438:	56                   	push   %esi
+  805439:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  80543c:	57                   	push   %edi
+  80543d:	6a 00                	push   $0x0
+  80543f:	e8 ab fd ff ff       	call   8051ef <page_alloc_range>
+  805444:	83 c4 20             	add    $0x20,%esp
+  805447:	85 c0                	test   %eax,%eax
+  805449:	78 6e                	js     8054b9 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  80544b:	83 ec 04             	sub    $0x4,%esp
+  80544e:	6a 24                	push   $0x24
+  805450:	68 00 a0 80 00       	push   $0x80a000
+  805455:	57                   	push   %edi
+  805456:	e8 63 bf ff ff       	call   8013be <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  80545b:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  805462:	56                   	push   %esi
+  805463:	57                   	push   %edi
+  805464:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  805466:	0f b7 05 06 a0 80 00 	movzwl 0x80a006,%eax
+  80546d:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  805470:	ff 34 85 44 d0 80 00 	push   0x80d044(,%eax,4)
+  805477:	e8 4c 0d 00 00       	call   8061c8 <ipc_call>
+  80547c:	83 c4 20             	add    $0x20,%esp
+  80547f:	85 c0                	test   %eax,%eax
+  805481:	78 08                	js     80548b <page_in+0x1d5>
+  805483:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  805486:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  805489:	eb 20                	jmp    8054ab <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  80548b:	50                   	push   %eax
+  80548c:	68 34 71 80 00       	push   $0x807134
+  805491:	68 59 02 00 00       	push   $0x259
+  805496:	68 67 6d 80 00       	push   $0x806d67
+  80549b:	e8 e6 b5 ff ff       	call   800a86 <_panic>
+		*mtes[i] = 0;
+  8054a0:	8b 10                	mov    (%eax),%edx
+  8054a2:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  8054a8:	83 c0 04             	add    $0x4,%eax
+  8054ab:	39 c8                	cmp    %ecx,%eax
+  8054ad:	75 f1                	jne    8054a0 <page_in+0x1ea>
+	return n;
+  8054af:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  8054b1:	85 f6                	test   %esi,%esi
+  8054b3:	0f 84 4d fe ff ff    	je     805306 <page_in+0x50>
+		return r < 0 ? r : 0;
+  8054b9:	85 c0                	test   %eax,%eax
+  8054bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054c0:	0f 4f c2             	cmovg  %edx,%eax
+  8054c3:	e9 99 fe ff ff       	jmp    805361 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  8054c8:	50                   	push   %eax
+  8054c9:	68 6c 71 80 00       	push   $0x80716c
+  8054ce:	68 9a 02 00 00       	push   $0x29a
+  8054d3:	68 67 6d 80 00       	push   $0x806d67
+  8054d8:	e8 a9 b5 ff ff       	call   800a86 <_panic>
+		return -E_PAGING;
+  8054dd:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8054e2:	e9 7a fe ff ff       	jmp    805361 <page_in+0xab>
+
+008054e7 <page_map>:
+{
+  8054e7:	55                   	push   %ebp
+  8054e8:	89 e5                	mov    %esp,%ebp
+  8054ea:	57                   	push   %edi
+  8054eb:	56                   	push   %esi
+  8054ec:	53                   	push   %ebx
+  8054ed:	83 ec 1c             	sub    $0x1c,%esp
+  8054f0:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8054f3:	83 ec 0c             	sub    $0xc,%esp
+  8054f6:	ff 75 18             	push   0x18(%ebp)
+  8054f9:	ff 75 14             	push   0x14(%ebp)
+  8054fc:	ff 75 10             	push   0x10(%ebp)
+  8054ff:	ff 75 0c             	push   0xc(%ebp)
+  805502:	56                   	push   %esi
+  805503:	e8 66 c2 ff ff       	call   80176e <sys_page_map>
+  805508:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80550b:	83 c4 20             	add    $0x20,%esp
+  80550e:	85 c0                	test   %eax,%eax
+  805510:	0f 89 a9 01 00 00    	jns    8056bf <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  805516:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  80551a:	74 5f                	je     80557b <page_map+0x94>
+		if (r != -E_INVAL)
+  80551c:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  805520:	0f 85 a0 01 00 00    	jne    8056c6 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  805526:	85 f6                	test   %esi,%esi
+  805528:	74 70                	je     80559a <page_map+0xb3>
+  80552a:	a1 18 09 81 00       	mov    0x810918,%eax
+  80552f:	8b 40 48             	mov    0x48(%eax),%eax
+  805532:	39 f0                	cmp    %esi,%eax
+  805534:	74 64                	je     80559a <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  805536:	83 ec 0c             	sub    $0xc,%esp
+  805539:	6a 05                	push   $0x5
+  80553b:	68 00 00 40 00       	push   $0x400000
+  805540:	6a 00                	push   $0x0
+  805542:	68 00 b0 ad de       	push   $0xdeadb000
+  805547:	56                   	push   %esi
+  805548:	e8 21 c2 ff ff       	call   80176e <sys_page_map>
+  80554d:	89 c3                	mov    %eax,%ebx
+  80554f:	83 c4 20             	add    $0x20,%esp
+  805552:	85 c0                	test   %eax,%eax
+  805554:	79 6a                	jns    8055c0 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  805556:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  805559:	75 50                	jne    8055ab <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  80555b:	83 ec 08             	sub    $0x8,%esp
+  80555e:	68 00 00 40 00       	push   $0x400000
+  805563:	6a fc                	push   $0xfffffffc
+  805565:	e8 9c f6 ff ff       	call   804c06 <page_out>
+  80556a:	83 c4 10             	add    $0x10,%esp
+  80556d:	85 c0                	test   %eax,%eax
+  80556f:	79 c5                	jns    805536 <page_map+0x4f>
+}
+  805571:	89 d8                	mov    %ebx,%eax
+  805573:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805576:	5b                   	pop    %ebx
+  805577:	5e                   	pop    %esi
+  805578:	5f                   	pop    %edi
+  805579:	5d                   	pop    %ebp
+  80557a:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  80557b:	83 ec 08             	sub    $0x8,%esp
+  80557e:	68 00 00 40 00       	push   $0x400000
+  805583:	6a 00                	push   $0x0
+  805585:	e8 7c f6 ff ff       	call   804c06 <page_out>
+  80558a:	83 c4 10             	add    $0x10,%esp
+  80558d:	85 c0                	test   %eax,%eax
+  80558f:	0f 89 5e ff ff ff    	jns    8054f3 <page_map+0xc>
+				return r;
+  805595:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  805598:	eb d7                	jmp    805571 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  80559a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80559d:	e8 79 f9 ff ff       	call   804f1b <page_adopt>
+  8055a2:	85 c0                	test   %eax,%eax
+  8055a4:	79 90                	jns    805536 <page_map+0x4f>
+			return r;
+  8055a6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8055a9:	eb c6                	jmp    805571 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  8055ab:	53                   	push   %ebx
+  8055ac:	68 a0 71 80 00       	push   $0x8071a0
+  8055b1:	68 77 03 00 00       	push   $0x377
+  8055b6:	68 67 6d 80 00       	push   $0x806d67
+  8055bb:	e8 c6 b4 ff ff       	call   800a86 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  8055c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8055c3:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8055c6:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  8055cd:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8055d3:	0f 84 f5 00 00 00    	je     8056ce <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8055d9:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8055df:	83 ec 0c             	sub    $0xc,%esp
+  8055e2:	6a 05                	push   $0x5
+  8055e4:	68 00 00 40 00       	push   $0x400000
+  8055e9:	6a 00                	push   $0x0
+  8055eb:	57                   	push   %edi
+  8055ec:	56                   	push   %esi
+  8055ed:	e8 7c c1 ff ff       	call   80176e <sys_page_map>
+  8055f2:	89 c3                	mov    %eax,%ebx
+  8055f4:	83 c4 20             	add    $0x20,%esp
+  8055f7:	85 c0                	test   %eax,%eax
+  8055f9:	79 35                	jns    805630 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  8055fb:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8055fe:	75 1b                	jne    80561b <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  805600:	83 ec 08             	sub    $0x8,%esp
+  805603:	68 00 00 40 00       	push   $0x400000
+  805608:	6a 00                	push   $0x0
+  80560a:	e8 f7 f5 ff ff       	call   804c06 <page_out>
+  80560f:	83 c4 10             	add    $0x10,%esp
+  805612:	85 c0                	test   %eax,%eax
+  805614:	79 c9                	jns    8055df <page_map+0xf8>
+  805616:	e9 56 ff ff ff       	jmp    805571 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  80561b:	53                   	push   %ebx
+  80561c:	68 c8 71 80 00       	push   $0x8071c8
+  805621:	68 83 03 00 00       	push   $0x383
+  805626:	68 67 6d 80 00       	push   $0x806d67
+  80562b:	e8 56 b4 ff ff       	call   800a86 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  805630:	8b 45 0c             	mov    0xc(%ebp),%eax
+  805633:	c1 e8 0c             	shr    $0xc,%eax
+  805636:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  80563b:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  805642:	01 
+  805643:	0f 84 8d 00 00 00    	je     8056d6 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  805649:	83 ec 08             	sub    $0x8,%esp
+  80564c:	68 00 00 40 00       	push   $0x400000
+  805651:	6a 00                	push   $0x0
+  805653:	e8 58 c1 ff ff       	call   8017b0 <sys_page_unmap>
+  805658:	83 c4 10             	add    $0x10,%esp
+  80565b:	85 c0                	test   %eax,%eax
+  80565d:	78 36                	js     805695 <page_map+0x1ae>
+  80565f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  805662:	83 ec 08             	sub    $0x8,%esp
+  805665:	57                   	push   %edi
+  805666:	56                   	push   %esi
+  805667:	e8 4a fc ff ff       	call   8052b6 <page_in>
+  80566c:	89 c3                	mov    %eax,%ebx
+  80566e:	83 c4 10             	add    $0x10,%esp
+  805671:	85 c0                	test   %eax,%eax
+  805673:	0f 89 7a fe ff ff    	jns    8054f3 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  805679:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80567c:	75 2c                	jne    8056aa <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  80567e:	83 ec 08             	sub    $0x8,%esp
+  805681:	57                   	push   %edi
+  805682:	6a 00                	push   $0x0
+  805684:	e8 7d f5 ff ff       	call   804c06 <page_out>
+  805689:	83 c4 10             	add    $0x10,%esp
+  80568c:	85 c0                	test   %eax,%eax
+  80568e:	79 d2                	jns    805662 <page_map+0x17b>
+  805690:	e9 dc fe ff ff       	jmp    805571 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  805695:	50                   	push   %eax
+  805696:	68 f4 71 80 00       	push   $0x8071f4
+  80569b:	68 8b 03 00 00       	push   $0x38b
+  8056a0:	68 67 6d 80 00       	push   $0x806d67
+  8056a5:	e8 dc b3 ff ff       	call   800a86 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  8056aa:	53                   	push   %ebx
+  8056ab:	68 1c 72 80 00       	push   $0x80721c
+  8056b0:	68 91 03 00 00       	push   $0x391
+  8056b5:	68 67 6d 80 00       	push   $0x806d67
+  8056ba:	e8 c7 b3 ff ff       	call   800a86 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8056bf:	89 c3                	mov    %eax,%ebx
+  8056c1:	e9 ab fe ff ff       	jmp    805571 <page_map+0x8a>
+  8056c6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8056c9:	e9 a3 fe ff ff       	jmp    805571 <page_map+0x8a>
+			return r; // Pass through the error
+  8056ce:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8056d1:	e9 9b fe ff ff       	jmp    805571 <page_map+0x8a>
+			return r; // Pass through the error
+  8056d6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8056d9:	e9 93 fe ff ff       	jmp    805571 <page_map+0x8a>
+
+008056de <page_map_range>:
+{
+  8056de:	55                   	push   %ebp
+  8056df:	89 e5                	mov    %esp,%ebp
+  8056e1:	57                   	push   %edi
+  8056e2:	56                   	push   %esi
+  8056e3:	53                   	push   %ebx
+  8056e4:	83 ec 0c             	sub    $0xc,%esp
+  8056e7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8056ea:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  8056ed:	83 ec 08             	sub    $0x8,%esp
+  8056f0:	ff 75 1c             	push   0x1c(%ebp)
+  8056f3:	ff 75 18             	push   0x18(%ebp)
+  8056f6:	56                   	push   %esi
+  8056f7:	ff 75 10             	push   0x10(%ebp)
+  8056fa:	57                   	push   %edi
+  8056fb:	ff 75 08             	push   0x8(%ebp)
+  8056fe:	e8 76 c1 ff ff       	call   801879 <sys_page_map_range>
+  805703:	89 c3                	mov    %eax,%ebx
+  805705:	83 c4 20             	add    $0x20,%esp
+  805708:	85 c0                	test   %eax,%eax
+  80570a:	79 1b                	jns    805727 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  80570c:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80570f:	75 20                	jne    805731 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  805711:	83 ec 08             	sub    $0x8,%esp
+  805714:	68 00 00 40 00       	push   $0x400000
+  805719:	6a 00                	push   $0x0
+  80571b:	e8 e6 f4 ff ff       	call   804c06 <page_out>
+  805720:	83 c4 10             	add    $0x10,%esp
+  805723:	85 c0                	test   %eax,%eax
+  805725:	79 c6                	jns    8056ed <page_map_range+0xf>
+}
+  805727:	89 d8                	mov    %ebx,%eax
+  805729:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80572c:	5b                   	pop    %ebx
+  80572d:	5e                   	pop    %esi
+  80572e:	5f                   	pop    %edi
+  80572f:	5d                   	pop    %ebp
+  805730:	c3                   	ret
+		if (r != -E_INVAL)
+  805731:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  805734:	75 f1                	jne    805727 <page_map_range+0x49>
+  805736:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  805738:	be 00 00 00 00       	mov    $0x0,%esi
+  80573d:	eb 03                	jmp    805742 <page_map_range+0x64>
+  80573f:	83 c6 01             	add    $0x1,%esi
+  805742:	3b 75 18             	cmp    0x18(%ebp),%esi
+  805745:	74 2a                	je     805771 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  805747:	83 ec 0c             	sub    $0xc,%esp
+  80574a:	ff 75 1c             	push   0x1c(%ebp)
+  80574d:	53                   	push   %ebx
+  80574e:	ff 75 10             	push   0x10(%ebp)
+  805751:	57                   	push   %edi
+  805752:	ff 75 08             	push   0x8(%ebp)
+  805755:	e8 8d fd ff ff       	call   8054e7 <page_map>
+  80575a:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  805760:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  805766:	83 c4 20             	add    $0x20,%esp
+  805769:	85 c0                	test   %eax,%eax
+  80576b:	79 d2                	jns    80573f <page_map_range+0x61>
+  80576d:	89 c3                	mov    %eax,%ebx
+  80576f:	eb b6                	jmp    805727 <page_map_range+0x49>
+		return 0;
+  805771:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805776:	eb af                	jmp    805727 <page_map_range+0x49>
+
+00805778 <paging_pgfault_handler>:
+{
+  805778:	55                   	push   %ebp
+  805779:	89 e5                	mov    %esp,%ebp
+  80577b:	56                   	push   %esi
+  80577c:	53                   	push   %ebx
+  80577d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  805780:	e8 6f e7 ff ff       	call   803ef4 <find_paging_env>
+	if (pagingenv == 0)
+  805785:	a1 40 d0 80 00       	mov    0x80d040,%eax
+  80578a:	85 c0                	test   %eax,%eax
+  80578c:	74 3c                	je     8057ca <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  80578e:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  805790:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  805794:	75 12                	jne    8057a8 <paging_pgfault_handler+0x30>
+  805796:	89 f0                	mov    %esi,%eax
+  805798:	e8 7e f7 ff ff       	call   804f1b <page_adopt>
+  80579d:	89 c2                	mov    %eax,%edx
+		return 0;
+  80579f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  8057a4:	85 d2                	test   %edx,%edx
+  8057a6:	78 22                	js     8057ca <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  8057a8:	83 ec 08             	sub    $0x8,%esp
+  8057ab:	6a 00                	push   $0x0
+  8057ad:	56                   	push   %esi
+  8057ae:	e8 a9 f3 ff ff       	call   804b5c <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  8057b3:	83 c4 10             	add    $0x10,%esp
+  8057b6:	85 c0                	test   %eax,%eax
+  8057b8:	74 05                	je     8057bf <paging_pgfault_handler+0x47>
+  8057ba:	f6 00 01             	testb  $0x1,(%eax)
+  8057bd:	75 12                	jne    8057d1 <paging_pgfault_handler+0x59>
+	return 0;
+  8057bf:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8057c4:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8057c8:	74 23                	je     8057ed <paging_pgfault_handler+0x75>
+}
+  8057ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8057cd:	5b                   	pop    %ebx
+  8057ce:	5e                   	pop    %esi
+  8057cf:	5d                   	pop    %ebp
+  8057d0:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  8057d1:	a1 18 09 81 00       	mov    0x810918,%eax
+  8057d6:	8b 40 48             	mov    0x48(%eax),%eax
+  8057d9:	83 ec 08             	sub    $0x8,%esp
+  8057dc:	56                   	push   %esi
+  8057dd:	50                   	push   %eax
+  8057de:	e8 d3 fa ff ff       	call   8052b6 <page_in>
+  8057e3:	f7 d0                	not    %eax
+  8057e5:	c1 e8 1f             	shr    $0x1f,%eax
+  8057e8:	83 c4 10             	add    $0x10,%esp
+  8057eb:	eb dd                	jmp    8057ca <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8057ed:	89 f0                	mov    %esi,%eax
+  8057ef:	e8 97 e2 ff ff       	call   803a8b <segment_lookup>
+  8057f4:	89 c2                	mov    %eax,%edx
+	return 0;
+  8057f6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8057fb:	85 d2                	test   %edx,%edx
+  8057fd:	74 cb                	je     8057ca <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  8057ff:	a1 18 09 81 00       	mov    0x810918,%eax
+  805804:	8b 40 48             	mov    0x48(%eax),%eax
+  805807:	83 ec 08             	sub    $0x8,%esp
+  80580a:	56                   	push   %esi
+  80580b:	50                   	push   %eax
+  80580c:	e8 f5 f3 ff ff       	call   804c06 <page_out>
+  805811:	f7 d0                	not    %eax
+  805813:	c1 e8 1f             	shr    $0x1f,%eax
+  805816:	83 c4 10             	add    $0x10,%esp
+  805819:	eb af                	jmp    8057ca <paging_pgfault_handler+0x52>
+
+0080581b <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  80581b:	55                   	push   %ebp
+  80581c:	89 e5                	mov    %esp,%ebp
+  80581e:	57                   	push   %edi
+  80581f:	56                   	push   %esi
+  805820:	53                   	push   %ebx
+  805821:	83 ec 2c             	sub    $0x2c,%esp
+  805824:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  805827:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  80582c:	89 c1                	mov    %eax,%ecx
+  80582e:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  805831:	c1 e8 11             	shr    $0x11,%eax
+  805834:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  805837:	8b 3c 85 80 ec 80 00 	mov    0x80ec80(,%eax,4),%edi
+  80583e:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  805841:	b8 01 00 00 00       	mov    $0x1,%eax
+  805846:	d3 e0                	shl    %cl,%eax
+  805848:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80584b:	85 c7                	test   %eax,%edi
+  80584d:	74 12                	je     805861 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  80584f:	bb 01 00 00 00       	mov    $0x1,%ebx
+  805854:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  805857:	bf 01 00 00 00       	mov    $0x1,%edi
+  80585c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80585f:	eb 17                	jmp    805878 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  805861:	ff 75 e0             	push   -0x20(%ebp)
+  805864:	68 54 72 80 00       	push   $0x807254
+  805869:	6a 48                	push   $0x48
+  80586b:	68 6e 72 80 00       	push   $0x80726e
+  805870:	e8 11 b2 ff ff       	call   800a86 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  805875:	83 c3 01             	add    $0x1,%ebx
+  805878:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80587b:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  80587e:	89 c8                	mov    %ecx,%eax
+  805880:	c1 e8 05             	shr    $0x5,%eax
+  805883:	8b 14 85 80 de 80 00 	mov    0x80de80(,%eax,4),%edx
+  80588a:	89 fe                	mov    %edi,%esi
+  80588c:	d3 e6                	shl    %cl,%esi
+  80588e:	89 f1                	mov    %esi,%ecx
+  805890:	85 d6                	test   %edx,%esi
+  805892:	74 e1                	je     805875 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  805894:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  805897:	f7 d6                	not    %esi
+  805899:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80589c:	21 fe                	and    %edi,%esi
+  80589e:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8058a1:	89 34 bd 80 ec 80 00 	mov    %esi,0x80ec80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  8058a8:	f7 d1                	not    %ecx
+  8058aa:	21 d1                	and    %edx,%ecx
+  8058ac:	89 0c 85 80 de 80 00 	mov    %ecx,0x80de80(,%eax,4)
+	page_unmap_range(0, va, n);
+  8058b3:	83 ec 04             	sub    $0x4,%esp
+  8058b6:	53                   	push   %ebx
+  8058b7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8058ba:	57                   	push   %edi
+  8058bb:	6a 00                	push   $0x0
+  8058bd:	e8 97 f8 ff ff       	call   805159 <page_unmap_range>
+	va_free(va, n);
+  8058c2:	83 c4 08             	add    $0x8,%esp
+  8058c5:	53                   	push   %ebx
+  8058c6:	57                   	push   %edi
+  8058c7:	e8 ed 05 00 00       	call   805eb9 <va_free>
+}
+  8058cc:	83 c4 10             	add    $0x10,%esp
+  8058cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8058d2:	5b                   	pop    %ebx
+  8058d3:	5e                   	pop    %esi
+  8058d4:	5f                   	pop    %edi
+  8058d5:	5d                   	pop    %ebp
+  8058d6:	c3                   	ret
+
+008058d7 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  8058d7:	55                   	push   %ebp
+  8058d8:	89 e5                	mov    %esp,%ebp
+  8058da:	57                   	push   %edi
+  8058db:	56                   	push   %esi
+  8058dc:	53                   	push   %ebx
+  8058dd:	83 ec 1c             	sub    $0x1c,%esp
+  8058e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  8058e3:	85 db                	test   %ebx,%ebx
+  8058e5:	74 34                	je     80591b <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  8058e7:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8058ed:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  8058f2:	77 2f                	ja     805923 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  8058f4:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8058fa:	75 51                	jne    80594d <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  8058fc:	89 c1                	mov    %eax,%ecx
+  8058fe:	c1 e9 0c             	shr    $0xc,%ecx
+  805901:	ba 01 00 00 00       	mov    $0x1,%edx
+  805906:	d3 e2                	shl    %cl,%edx
+  805908:	c1 e8 11             	shr    $0x11,%eax
+  80590b:	23 14 85 80 d0 80 00 	and    0x80d080(,%eax,4),%edx
+  805912:	75 24                	jne    805938 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  805914:	89 d8                	mov    %ebx,%eax
+  805916:	e8 00 ff ff ff       	call   80581b <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  80591b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80591e:	5b                   	pop    %ebx
+  80591f:	5e                   	pop    %esi
+  805920:	5f                   	pop    %edi
+  805921:	5d                   	pop    %ebp
+  805922:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  805923:	53                   	push   %ebx
+  805924:	68 7b 72 80 00       	push   $0x80727b
+  805929:	68 a2 00 00 00       	push   $0xa2
+  80592e:	68 6e 72 80 00       	push   $0x80726e
+  805933:	e8 4e b1 ff ff       	call   800a86 <_panic>
+			panic("free: %p is not allocated", va);
+  805938:	53                   	push   %ebx
+  805939:	68 54 72 80 00       	push   $0x807254
+  80593e:	68 a5 00 00 00       	push   $0xa5
+  805943:	68 6e 72 80 00       	push   $0x80726e
+  805948:	e8 39 b1 ff ff       	call   800a86 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  80594d:	89 de                	mov    %ebx,%esi
+  80594f:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  805955:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  80595b:	89 c8                	mov    %ecx,%eax
+  80595d:	c1 e8 11             	shr    $0x11,%eax
+  805960:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  805963:	8b 3c 85 80 d0 80 00 	mov    0x80d080(,%eax,4),%edi
+  80596a:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  80596d:	c1 e9 0c             	shr    $0xc,%ecx
+  805970:	b8 01 00 00 00       	mov    $0x1,%eax
+  805975:	d3 e0                	shl    %cl,%eax
+  805977:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80597a:	85 c7                	test   %eax,%edi
+  80597c:	74 1b                	je     805999 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  80597e:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  805982:	89 d8                	mov    %ebx,%eax
+  805984:	29 f0                	sub    %esi,%eax
+  805986:	83 e8 10             	sub    $0x10,%eax
+  805989:	99                   	cltd
+  80598a:	f7 ff                	idiv   %edi
+  80598c:	89 d1                	mov    %edx,%ecx
+  80598e:	85 d2                	test   %edx,%edx
+  805990:	75 07                	jne    805999 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  805992:	ba 10 00 00 00       	mov    $0x10,%edx
+  805997:	eb 18                	jmp    8059b1 <free+0xda>
+		panic("free: %p is not allocated", va);
+  805999:	53                   	push   %ebx
+  80599a:	68 54 72 80 00       	push   $0x807254
+  80599f:	68 ad 00 00 00       	push   $0xad
+  8059a4:	68 6e 72 80 00       	push   $0x80726e
+  8059a9:	e8 d8 b0 ff ff       	call   800a86 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8059ae:	83 c1 01             	add    $0x1,%ecx
+  8059b1:	89 d0                	mov    %edx,%eax
+  8059b3:	d3 e0                	shl    %cl,%eax
+  8059b5:	39 c7                	cmp    %eax,%edi
+  8059b7:	7f f5                	jg     8059ae <free+0xd7>
+	*(void **) va = s->free;
+  8059b9:	8b 46 08             	mov    0x8(%esi),%eax
+  8059bc:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  8059be:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  8059c1:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  8059c5:	8d 58 01             	lea    0x1(%eax),%ebx
+  8059c8:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  8059cc:	66 85 c0             	test   %ax,%ax
+  8059cf:	74 52                	je     805a23 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8059d1:	0f b7 db             	movzwl %bx,%ebx
+  8059d4:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8059d8:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8059dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8059e2:	f7 ff                	idiv   %edi
+  8059e4:	39 c3                	cmp    %eax,%ebx
+  8059e6:	0f 85 2f ff ff ff    	jne    80591b <free+0x44>
+  8059ec:	8b 46 04             	mov    0x4(%esi),%eax
+  8059ef:	85 c0                	test   %eax,%eax
+  8059f1:	74 53                	je     805a46 <free+0x16f>
+		s->prev->next = s->next;
+  8059f3:	8b 16                	mov    (%esi),%edx
+  8059f5:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8059f7:	8b 06                	mov    (%esi),%eax
+  8059f9:	85 c0                	test   %eax,%eax
+  8059fb:	74 06                	je     805a03 <free+0x12c>
+		s->next->prev = s->prev;
+  8059fd:	8b 56 04             	mov    0x4(%esi),%edx
+  805a00:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  805a03:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  805a06:	f7 d0                	not    %eax
+  805a08:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  805a0b:	21 d0                	and    %edx,%eax
+  805a0d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  805a10:	89 04 95 80 d0 80 00 	mov    %eax,0x80d080(,%edx,4)
+		heap_free_pages(s);
+  805a17:	89 f0                	mov    %esi,%eax
+  805a19:	e8 fd fd ff ff       	call   80581b <heap_free_pages>
+  805a1e:	e9 f8 fe ff ff       	jmp    80591b <free+0x44>
+	s->prev = NULL;
+  805a23:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  805a2a:	8b 04 8d 60 d0 80 00 	mov    0x80d060(,%ecx,4),%eax
+  805a31:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  805a33:	85 c0                	test   %eax,%eax
+  805a35:	74 03                	je     805a3a <free+0x163>
+		slabs[c]->prev = s;
+  805a37:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  805a3a:	89 34 8d 60 d0 80 00 	mov    %esi,0x80d060(,%ecx,4)
+}
+  805a41:	e9 d5 fe ff ff       	jmp    80591b <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  805a46:	8b 06                	mov    (%esi),%eax
+  805a48:	85 c0                	test   %eax,%eax
+  805a4a:	0f 84 cb fe ff ff    	je     80591b <free+0x44>
+		slabs[c] = s->next;
+  805a50:	89 04 8d 60 d0 80 00 	mov    %eax,0x80d060(,%ecx,4)
+	if (s->next)
+  805a57:	8b 06                	mov    (%esi),%eax
+  805a59:	eb a2                	jmp    8059fd <free+0x126>
+
+00805a5b <heap_alloc_pages>:
+{
+  805a5b:	55                   	push   %ebp
+  805a5c:	89 e5                	mov    %esp,%ebp
+  805a5e:	57                   	push   %edi
+  805a5f:	56                   	push   %esi
+  805a60:	53                   	push   %ebx
+  805a61:	83 ec 18             	sub    $0x18,%esp
+  805a64:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  805a66:	50                   	push   %eax
+  805a67:	e8 15 03 00 00       	call   805d81 <va_alloc>
+  805a6c:	89 c3                	mov    %eax,%ebx
+  805a6e:	83 c4 10             	add    $0x10,%esp
+  805a71:	85 c0                	test   %eax,%eax
+  805a73:	74 47                	je     805abc <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  805a75:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  805a7b:	89 c1                	mov    %eax,%ecx
+  805a7d:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  805a80:	c1 e8 11             	shr    $0x11,%eax
+  805a83:	ba 01 00 00 00       	mov    $0x1,%edx
+  805a88:	89 d7                	mov    %edx,%edi
+  805a8a:	d3 e7                	shl    %cl,%edi
+  805a8c:	09 3c 85 80 ec 80 00 	or     %edi,0x80ec80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  805a93:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  805a97:	89 c8                	mov    %ecx,%eax
+  805a99:	c1 e8 05             	shr    $0x5,%eax
+  805a9c:	d3 e2                	shl    %cl,%edx
+  805a9e:	09 14 85 80 de 80 00 	or     %edx,0x80de80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  805aa5:	83 ec 0c             	sub    $0xc,%esp
+  805aa8:	6a 00                	push   $0x0
+  805aaa:	6a 07                	push   $0x7
+  805aac:	56                   	push   %esi
+  805aad:	53                   	push   %ebx
+  805aae:	6a 00                	push   $0x0
+  805ab0:	e8 3a f7 ff ff       	call   8051ef <page_alloc_range>
+  805ab5:	83 c4 20             	add    $0x20,%esp
+  805ab8:	85 c0                	test   %eax,%eax
+  805aba:	78 0a                	js     805ac6 <heap_alloc_pages+0x6b>
+}
+  805abc:	89 d8                	mov    %ebx,%eax
+  805abe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805ac1:	5b                   	pop    %ebx
+  805ac2:	5e                   	pop    %esi
+  805ac3:	5f                   	pop    %edi
+  805ac4:	5d                   	pop    %ebp
+  805ac5:	c3                   	ret
+		free(va);
+  805ac6:	83 ec 0c             	sub    $0xc,%esp
+  805ac9:	53                   	push   %ebx
+  805aca:	e8 08 fe ff ff       	call   8058d7 <free>
+		return NULL;
+  805acf:	83 c4 10             	add    $0x10,%esp
+  805ad2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805ad7:	eb e3                	jmp    805abc <heap_alloc_pages+0x61>
+
+00805ad9 <malloc>:
+{
+  805ad9:	55                   	push   %ebp
+  805ada:	89 e5                	mov    %esp,%ebp
+  805adc:	57                   	push   %edi
+  805add:	56                   	push   %esi
+  805ade:	53                   	push   %ebx
+  805adf:	83 ec 1c             	sub    $0x1c,%esp
+  805ae2:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  805ae5:	8d 50 ff             	lea    -0x1(%eax),%edx
+  805ae8:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  805aee:	0f 87 21 01 00 00    	ja     805c15 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  805af4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805af9:	ba 10 00 00 00       	mov    $0x10,%edx
+  805afe:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  805b00:	3d 00 04 00 00       	cmp    $0x400,%eax
+  805b05:	76 15                	jbe    805b1c <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  805b07:	05 ff 0f 00 00       	add    $0xfff,%eax
+  805b0c:	c1 e8 0c             	shr    $0xc,%eax
+  805b0f:	e8 47 ff ff ff       	call   805a5b <heap_alloc_pages>
+  805b14:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  805b17:	eb 37                	jmp    805b50 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  805b19:	83 c1 01             	add    $0x1,%ecx
+  805b1c:	89 d6                	mov    %edx,%esi
+  805b1e:	d3 e6                	shl    %cl,%esi
+  805b20:	39 c6                	cmp    %eax,%esi
+  805b22:	72 f5                	jb     805b19 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  805b24:	89 cb                	mov    %ecx,%ebx
+  805b26:	8b 3c 8d 60 d0 80 00 	mov    0x80d060(,%ecx,4),%edi
+  805b2d:	85 ff                	test   %edi,%edi
+  805b2f:	74 2a                	je     805b5b <malloc+0x82>
+	v = s->free;
+  805b31:	8b 47 08             	mov    0x8(%edi),%eax
+  805b34:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  805b37:	8b 00                	mov    (%eax),%eax
+  805b39:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  805b3c:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  805b40:	83 e8 01             	sub    $0x1,%eax
+  805b43:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  805b47:	66 85 c0             	test   %ax,%ax
+  805b4a:	0f 84 9a 00 00 00    	je     805bea <malloc+0x111>
+}
+  805b50:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  805b53:	83 c4 1c             	add    $0x1c,%esp
+  805b56:	5b                   	pop    %ebx
+  805b57:	5e                   	pop    %esi
+  805b58:	5f                   	pop    %edi
+  805b59:	5d                   	pop    %ebp
+  805b5a:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  805b5b:	b8 01 00 00 00       	mov    $0x1,%eax
+  805b60:	e8 f6 fe ff ff       	call   805a5b <heap_alloc_pages>
+  805b65:	89 c1                	mov    %eax,%ecx
+  805b67:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  805b6a:	85 c0                	test   %eax,%eax
+  805b6c:	74 e2                	je     805b50 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  805b6e:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  805b74:	89 c8                	mov    %ecx,%eax
+  805b76:	c1 e8 11             	shr    $0x11,%eax
+  805b79:	c1 e9 0c             	shr    $0xc,%ecx
+  805b7c:	ba 01 00 00 00       	mov    $0x1,%edx
+  805b81:	d3 e2                	shl    %cl,%edx
+  805b83:	09 14 85 80 d0 80 00 	or     %edx,0x80d080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  805b8a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  805b8d:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  805b91:	0f b7 f6             	movzwl %si,%esi
+  805b94:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  805b99:	ba 00 00 00 00       	mov    $0x0,%edx
+  805b9e:	f7 fe                	idiv   %esi
+  805ba0:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  805ba4:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  805ba7:	85 c0                	test   %eax,%eax
+  805ba9:	74 14                	je     805bbf <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  805bab:	83 e8 01             	sub    $0x1,%eax
+  805bae:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  805bb2:	0f af d0             	imul   %eax,%edx
+  805bb5:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  805bb9:	89 3a                	mov    %edi,(%edx)
+  805bbb:	89 d7                	mov    %edx,%edi
+  805bbd:	eb e5                	jmp    805ba4 <malloc+0xcb>
+	s->prev = NULL;
+  805bbf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  805bc2:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  805bc9:	8b 04 9d 60 d0 80 00 	mov    0x80d060(,%ebx,4),%eax
+  805bd0:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  805bd2:	85 c0                	test   %eax,%eax
+  805bd4:	74 03                	je     805bd9 <malloc+0x100>
+		slabs[c]->prev = s;
+  805bd6:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  805bd9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  805bdc:	89 04 9d 60 d0 80 00 	mov    %eax,0x80d060(,%ebx,4)
+	return s;
+  805be3:	89 c7                	mov    %eax,%edi
+  805be5:	e9 47 ff ff ff       	jmp    805b31 <malloc+0x58>
+	if (s->prev)
+  805bea:	8b 47 04             	mov    0x4(%edi),%eax
+  805bed:	85 c0                	test   %eax,%eax
+  805bef:	74 19                	je     805c0a <malloc+0x131>
+		s->prev->next = s->next;
+  805bf1:	8b 17                	mov    (%edi),%edx
+  805bf3:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  805bf5:	8b 07                	mov    (%edi),%eax
+  805bf7:	85 c0                	test   %eax,%eax
+  805bf9:	0f 84 51 ff ff ff    	je     805b50 <malloc+0x77>
+		s->next->prev = s->prev;
+  805bff:	8b 57 04             	mov    0x4(%edi),%edx
+  805c02:	89 50 04             	mov    %edx,0x4(%eax)
+  805c05:	e9 46 ff ff ff       	jmp    805b50 <malloc+0x77>
+		slabs[c] = s->next;
+  805c0a:	8b 07                	mov    (%edi),%eax
+  805c0c:	89 04 9d 60 d0 80 00 	mov    %eax,0x80d060(,%ebx,4)
+  805c13:	eb e0                	jmp    805bf5 <malloc+0x11c>
+		return NULL;
+  805c15:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  805c1c:	e9 2f ff ff ff       	jmp    805b50 <malloc+0x77>
+
+00805c21 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  805c21:	55                   	push   %ebp
+  805c22:	89 e5                	mov    %esp,%ebp
+  805c24:	57                   	push   %edi
+  805c25:	56                   	push   %esi
+  805c26:	53                   	push   %ebx
+  805c27:	83 ec 0c             	sub    $0xc,%esp
+  805c2a:	89 c6                	mov    %eax,%esi
+  805c2c:	89 d7                	mov    %edx,%edi
+  805c2e:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  805c31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805c36:	ba 00 00 00 00       	mov    $0x0,%edx
+  805c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  805c40:	83 ef 01             	sub    $0x1,%edi
+  805c43:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  805c46:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  805c49:	eb 34                	jmp    805c7f <va_chunk_scan+0x5e>
+			i += 31;
+  805c4b:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  805c4e:	89 ca                	mov    %ecx,%edx
+			continue;
+  805c50:	eb 23                	jmp    805c75 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  805c52:	89 c7                	mov    %eax,%edi
+  805c54:	c1 ef 05             	shr    $0x5,%edi
+  805c57:	be 01 00 00 00       	mov    $0x1,%esi
+  805c5c:	d3 e6                	shl    %cl,%esi
+  805c5e:	89 f1                	mov    %esi,%ecx
+  805c60:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  805c63:	23 0c be             	and    (%esi,%edi,4),%ecx
+  805c66:	75 41                	jne    805ca9 <va_chunk_scan+0x88>
+			len++;
+  805c68:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  805c6b:	39 d3                	cmp    %edx,%ebx
+  805c6d:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  805c70:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  805c73:	72 2d                	jb     805ca2 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  805c75:	83 c0 01             	add    $0x1,%eax
+  805c78:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  805c7d:	77 31                	ja     805cb0 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  805c7f:	89 c1                	mov    %eax,%ecx
+  805c81:	83 e1 1f             	and    $0x1f,%ecx
+  805c84:	75 cc                	jne    805c52 <va_chunk_scan+0x31>
+  805c86:	89 c7                	mov    %eax,%edi
+  805c88:	c1 ef 05             	shr    $0x5,%edi
+  805c8b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  805c8e:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  805c91:	83 ff ff             	cmp    $0xffffffff,%edi
+  805c94:	74 b5                	je     805c4b <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  805c96:	85 ff                	test   %edi,%edi
+  805c98:	75 b8                	jne    805c52 <va_chunk_scan+0x31>
+			i += 31;
+  805c9a:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  805c9d:	83 c2 20             	add    $0x20,%edx
+  805ca0:	eb c9                	jmp    805c6b <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  805ca2:	83 c0 01             	add    $0x1,%eax
+  805ca5:	29 d0                	sub    %edx,%eax
+  805ca7:	eb 15                	jmp    805cbe <va_chunk_scan+0x9d>
+			len = 0;
+  805ca9:	ba 00 00 00 00       	mov    $0x0,%edx
+  805cae:	eb c5                	jmp    805c75 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  805cb0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  805cb5:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  805cb8:	85 d2                	test   %edx,%edx
+  805cba:	74 02                	je     805cbe <va_chunk_scan+0x9d>
+		*run_store = best;
+  805cbc:	89 1a                	mov    %ebx,(%edx)
+}
+  805cbe:	83 c4 0c             	add    $0xc,%esp
+  805cc1:	5b                   	pop    %ebx
+  805cc2:	5e                   	pop    %esi
+  805cc3:	5f                   	pop    %edi
+  805cc4:	5d                   	pop    %ebp
+  805cc5:	c3                   	ret
+
+00805cc6 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  805cc6:	55                   	push   %ebp
+  805cc7:	89 e5                	mov    %esp,%ebp
+  805cc9:	57                   	push   %edi
+  805cca:	56                   	push   %esi
+  805ccb:	53                   	push   %ebx
+  805ccc:	83 ec 14             	sub    $0x14,%esp
+  805ccf:	89 c3                	mov    %eax,%ebx
+  805cd1:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  805cd3:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  805cd9:	8d ba a0 fa 80 00    	lea    0x80faa0(%edx),%edi
+  805cdf:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  805ce2:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  805ce5:	89 d6                	mov    %edx,%esi
+  805ce7:	81 c6 a0 fa 80 00    	add    $0x80faa0,%esi
+  805ced:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  805cef:	eb 34                	jmp    805d25 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  805cf1:	89 c8                	mov    %ecx,%eax
+  805cf3:	c1 e8 05             	shr    $0x5,%eax
+  805cf6:	89 da                	mov    %ebx,%edx
+  805cf8:	c1 e2 05             	shl    $0x5,%edx
+  805cfb:	01 da                	add    %ebx,%edx
+  805cfd:	01 c2                	add    %eax,%edx
+  805cff:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  805d04:	d3 c0                	rol    %cl,%eax
+  805d06:	21 04 95 a0 fa 80 00 	and    %eax,0x80faa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  805d0d:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  805d14:	b8 01 00 00 00       	mov    $0x1,%eax
+  805d19:	01 d0                	add    %edx,%eax
+  805d1b:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  805d22:	83 c1 01             	add    $0x1,%ecx
+  805d25:	39 f9                	cmp    %edi,%ecx
+  805d27:	74 30                	je     805d59 <va_chunk_mark+0x93>
+		if (alloc)
+  805d29:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  805d2d:	74 c2                	je     805cf1 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  805d2f:	89 c8                	mov    %ecx,%eax
+  805d31:	c1 e8 05             	shr    $0x5,%eax
+  805d34:	89 da                	mov    %ebx,%edx
+  805d36:	c1 e2 05             	shl    $0x5,%edx
+  805d39:	01 da                	add    %ebx,%edx
+  805d3b:	01 c2                	add    %eax,%edx
+  805d3d:	b8 01 00 00 00       	mov    $0x1,%eax
+  805d42:	d3 e0                	shl    %cl,%eax
+  805d44:	09 04 95 a0 fa 80 00 	or     %eax,0x80faa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  805d4b:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  805d52:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  805d57:	eb c0                	jmp    805d19 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  805d59:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  805d5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805d61:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  805d64:	e8 b8 fe ff ff       	call   805c21 <va_chunk_scan>
+	ch->run = run;
+  805d69:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  805d6f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  805d72:	66 89 83 22 fb 80 00 	mov    %ax,0x80fb22(%ebx)
+}
+  805d79:	83 c4 14             	add    $0x14,%esp
+  805d7c:	5b                   	pop    %ebx
+  805d7d:	5e                   	pop    %esi
+  805d7e:	5f                   	pop    %edi
+  805d7f:	5d                   	pop    %ebp
+  805d80:	c3                   	ret
+
+00805d81 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  805d81:	55                   	push   %ebp
+  805d82:	89 e5                	mov    %esp,%ebp
+  805d84:	57                   	push   %edi
+  805d85:	56                   	push   %esi
+  805d86:	53                   	push   %ebx
+  805d87:	83 ec 04             	sub    $0x4,%esp
+  805d8a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  805d8d:	b8 20 fb 80 00       	mov    $0x80fb20,%eax
+  805d92:	ba 90 09 81 00       	mov    $0x810990,%edx
+  805d97:	80 3d 80 fa 80 00 00 	cmpb   $0x0,0x80fa80
+  805d9e:	74 4f                	je     805def <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  805da0:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  805da3:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  805da8:	0f 87 01 01 00 00    	ja     805eaf <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  805dae:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  805db4:	0f 87 80 00 00 00    	ja     805e3a <va_alloc+0xb9>
+  805dba:	b8 22 fb 80 00       	mov    $0x80fb22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  805dbf:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  805dc4:	0f b7 10             	movzwl (%eax),%edx
+  805dc7:	05 84 00 00 00       	add    $0x84,%eax
+  805dcc:	39 da                	cmp    %ebx,%edx
+  805dce:	73 2c                	jae    805dfc <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  805dd0:	83 c6 01             	add    $0x1,%esi
+  805dd3:	83 fe 1c             	cmp    $0x1c,%esi
+  805dd6:	75 ec                	jne    805dc4 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  805dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ddd:	eb 53                	jmp    805e32 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  805ddf:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  805de5:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  805dea:	05 84 00 00 00       	add    $0x84,%eax
+  805def:	39 d0                	cmp    %edx,%eax
+  805df1:	75 ec                	jne    805ddf <va_alloc+0x5e>
+	va_inited = 1;
+  805df3:	c6 05 80 fa 80 00 01 	movb   $0x1,0x80fa80
+}
+  805dfa:	eb a4                	jmp    805da0 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  805dfc:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  805e02:	05 a0 fa 80 00       	add    $0x80faa0,%eax
+  805e07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805e0c:	89 da                	mov    %ebx,%edx
+  805e0e:	e8 0e fe ff ff       	call   805c21 <va_chunk_scan>
+  805e13:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  805e15:	6a 01                	push   $0x1
+  805e17:	89 d9                	mov    %ebx,%ecx
+  805e19:	89 c2                	mov    %eax,%edx
+  805e1b:	89 f0                	mov    %esi,%eax
+  805e1d:	e8 a4 fe ff ff       	call   805cc6 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  805e22:	c1 e6 16             	shl    $0x16,%esi
+  805e25:	c1 e7 0c             	shl    $0xc,%edi
+  805e28:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  805e2f:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  805e32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805e35:	5b                   	pop    %ebx
+  805e36:	5e                   	pop    %esi
+  805e37:	5f                   	pop    %edi
+  805e38:	5d                   	pop    %ebp
+  805e39:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  805e3a:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  805e40:	c1 ee 0a             	shr    $0xa,%esi
+  805e43:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  805e48:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e4d:	eb 0a                	jmp    805e59 <va_alloc+0xd8>
+			first = c + 1;
+  805e4f:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  805e51:	83 c2 01             	add    $0x1,%edx
+  805e54:	83 fa 1d             	cmp    $0x1d,%edx
+  805e57:	74 4f                	je     805ea8 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  805e59:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  805e5f:	66 81 b9 9c fa 80 00 	cmpw   $0x400,0x80fa9c(%ecx)
+  805e66:	00 04 
+  805e68:	75 e5                	jne    805e4f <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  805e6a:	89 d1                	mov    %edx,%ecx
+  805e6c:	29 c1                	sub    %eax,%ecx
+  805e6e:	39 f1                	cmp    %esi,%ecx
+  805e70:	75 df                	jne    805e51 <va_alloc+0xd0>
+  805e72:	89 c7                	mov    %eax,%edi
+  805e74:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  805e77:	be 00 04 00 00       	mov    $0x400,%esi
+  805e7c:	39 f3                	cmp    %esi,%ebx
+  805e7e:	0f 46 f3             	cmovbe %ebx,%esi
+  805e81:	6a 01                	push   $0x1
+  805e83:	89 f1                	mov    %esi,%ecx
+  805e85:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e8a:	89 f8                	mov    %edi,%eax
+  805e8c:	e8 35 fe ff ff       	call   805cc6 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  805e91:	83 c7 01             	add    $0x1,%edi
+  805e94:	83 c4 04             	add    $0x4,%esp
+  805e97:	29 f3                	sub    %esi,%ebx
+  805e99:	75 dc                	jne    805e77 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  805e9b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  805e9e:	c1 e0 16             	shl    $0x16,%eax
+  805ea1:	05 00 00 00 08       	add    $0x8000000,%eax
+  805ea6:	eb 8a                	jmp    805e32 <va_alloc+0xb1>
+	return NULL;
+  805ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ead:	eb 83                	jmp    805e32 <va_alloc+0xb1>
+		return NULL;
+  805eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  805eb4:	e9 79 ff ff ff       	jmp    805e32 <va_alloc+0xb1>
+
+00805eb9 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  805eb9:	55                   	push   %ebp
+  805eba:	89 e5                	mov    %esp,%ebp
+  805ebc:	57                   	push   %edi
+  805ebd:	56                   	push   %esi
+  805ebe:	53                   	push   %ebx
+  805ebf:	83 ec 0c             	sub    $0xc,%esp
+  805ec2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  805ec5:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  805ec8:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  805ece:	76 21                	jbe    805ef1 <va_free+0x38>
+  805ed0:	89 f0                	mov    %esi,%eax
+  805ed2:	c1 e0 0c             	shl    $0xc,%eax
+  805ed5:	01 f8                	add    %edi,%eax
+  805ed7:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  805edc:	77 13                	ja     805ef1 <va_free+0x38>
+	    || PGOFF(va))
+  805ede:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  805ee4:	75 0b                	jne    805ef1 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  805ee6:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  805eec:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  805eef:	eb 45                	jmp    805f36 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  805ef1:	83 ec 0c             	sub    $0xc,%esp
+  805ef4:	56                   	push   %esi
+  805ef5:	57                   	push   %edi
+  805ef6:	68 98 72 80 00       	push   $0x807298
+  805efb:	68 8e 00 00 00       	push   $0x8e
+  805f00:	68 b8 72 80 00       	push   $0x8072b8
+  805f05:	e8 7c ab ff ff       	call   800a86 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  805f0a:	89 fa                	mov    %edi,%edx
+  805f0c:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  805f12:	bb 00 04 00 00       	mov    $0x400,%ebx
+  805f17:	29 d3                	sub    %edx,%ebx
+  805f19:	39 f3                	cmp    %esi,%ebx
+  805f1b:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  805f1e:	89 f8                	mov    %edi,%eax
+  805f20:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  805f23:	83 ec 0c             	sub    $0xc,%esp
+  805f26:	6a 00                	push   $0x0
+  805f28:	89 d9                	mov    %ebx,%ecx
+  805f2a:	e8 97 fd ff ff       	call   805cc6 <va_chunk_mark>
+		i += n;
+  805f2f:	01 df                	add    %ebx,%edi
+		npages -= n;
+  805f31:	29 de                	sub    %ebx,%esi
+  805f33:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  805f36:	85 f6                	test   %esi,%esi
+  805f38:	75 d0                	jne    805f0a <va_free+0x51>
+	}
+}
+  805f3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805f3d:	5b                   	pop    %ebx
+  805f3e:	5e                   	pop    %esi
+  805f3f:	5f                   	pop    %edi
+  805f40:	5d                   	pop    %ebp
+  805f41:	c3                   	ret
+
+00805f42 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  805f42:	55                   	push   %ebp
+  805f43:	89 e5                	mov    %esp,%ebp
+  805f45:	56                   	push   %esi
+  805f46:	53                   	push   %ebx
+  805f47:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  805f4a:	a1 10 09 81 00       	mov    0x810910,%eax
+  805f4f:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  805f52:	85 db                	test   %ebx,%ebx
+  805f54:	78 17                	js     805f6d <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  805f56:	83 ec 0c             	sub    $0xc,%esp
+  805f59:	56                   	push   %esi
+  805f5a:	ff 14 9d 00 20 81 00 	call   *0x812000(,%ebx,4)
+  805f61:	83 c4 10             	add    $0x10,%esp
+  805f64:	85 c0                	test   %eax,%eax
+  805f66:	75 27                	jne    805f8f <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  805f68:	83 eb 01             	sub    $0x1,%ebx
+  805f6b:	eb e5                	jmp    805f52 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  805f6d:	a1 18 09 81 00       	mov    0x810918,%eax
+  805f72:	8b 40 48             	mov    0x48(%eax),%eax
+  805f75:	83 ec 08             	sub    $0x8,%esp
+  805f78:	ff 76 28             	push   0x28(%esi)
+  805f7b:	ff 36                	push   (%esi)
+  805f7d:	50                   	push   %eax
+  805f7e:	68 c8 72 80 00       	push   $0x8072c8
+  805f83:	6a 1d                	push   $0x1d
+  805f85:	68 eb 72 80 00       	push   $0x8072eb
+  805f8a:	e8 f7 aa ff ff       	call   800a86 <_panic>
+}
+  805f8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805f92:	5b                   	pop    %ebx
+  805f93:	5e                   	pop    %esi
+  805f94:	5d                   	pop    %ebp
+  805f95:	c3                   	ret
+
+00805f96 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  805f96:	55                   	push   %ebp
+  805f97:	89 e5                	mov    %esp,%ebp
+  805f99:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  805f9c:	83 3d 28 20 81 00 00 	cmpl   $0x0,0x812028
+  805fa3:	74 0a                	je     805faf <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  805fa5:	8b 45 08             	mov    0x8(%ebp),%eax
+  805fa8:	a3 28 20 81 00       	mov    %eax,0x812028
+}
+  805fad:	c9                   	leave
+  805fae:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  805faf:	83 ec 04             	sub    $0x4,%esp
+  805fb2:	6a 07                	push   $0x7
+  805fb4:	68 00 f0 bf ee       	push   $0xeebff000
+  805fb9:	6a 00                	push   $0x0
+  805fbb:	e8 6b b7 ff ff       	call   80172b <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805fc0:	83 c4 08             	add    $0x8,%esp
+  805fc3:	68 36 60 80 00       	push   $0x806036
+  805fc8:	6a 00                	push   $0x0
+  805fca:	e8 c2 ba ff ff       	call   801a91 <sys_env_set_pgfault_upcall>
+  805fcf:	83 c4 10             	add    $0x10,%esp
+  805fd2:	eb d1                	jmp    805fa5 <set_pgfault_handler+0xf>
+
+00805fd4 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  805fd4:	55                   	push   %ebp
+  805fd5:	89 e5                	mov    %esp,%ebp
+  805fd7:	83 ec 08             	sub    $0x8,%esp
+  805fda:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  805fdd:	8b 15 10 09 81 00    	mov    0x810910,%edx
+  805fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+  805fe8:	eb 03                	jmp    805fed <add_pgfault_handler+0x19>
+  805fea:	83 c0 01             	add    $0x1,%eax
+  805fed:	39 d0                	cmp    %edx,%eax
+  805fef:	74 0b                	je     805ffc <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  805ff1:	39 0c 85 00 20 81 00 	cmp    %ecx,0x812000(,%eax,4)
+  805ff8:	75 f0                	jne    805fea <add_pgfault_handler+0x16>
+  805ffa:	eb 24                	jmp    806020 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  805ffc:	83 fa 0a             	cmp    $0xa,%edx
+  805fff:	74 21                	je     806022 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  806001:	8d 42 01             	lea    0x1(%edx),%eax
+  806004:	a3 10 09 81 00       	mov    %eax,0x810910
+  806009:	89 0c 95 00 20 81 00 	mov    %ecx,0x812000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  806010:	83 ec 0c             	sub    $0xc,%esp
+  806013:	68 42 5f 80 00       	push   $0x805f42
+  806018:	e8 79 ff ff ff       	call   805f96 <set_pgfault_handler>
+  80601d:	83 c4 10             	add    $0x10,%esp
+}
+  806020:	c9                   	leave
+  806021:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  806022:	83 ec 04             	sub    $0x4,%esp
+  806025:	68 f9 72 80 00       	push   $0x8072f9
+  80602a:	6a 44                	push   $0x44
+  80602c:	68 eb 72 80 00       	push   $0x8072eb
+  806031:	e8 50 aa ff ff       	call   800a86 <_panic>
+
+00806036 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  806036:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  806037:	a1 28 20 81 00       	mov    0x812028,%eax
+	call *%eax
+  80603c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80603e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  806041:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  806045:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  806049:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  80604c:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  80604e:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  806052:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  806055:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  806056:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  806059:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  80605a:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80605b:	c3                   	ret
+
+0080605c <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  80605c:	55                   	push   %ebp
+  80605d:	89 e5                	mov    %esp,%ebp
+  80605f:	57                   	push   %edi
+  806060:	56                   	push   %esi
+  806061:	53                   	push   %ebx
+  806062:	83 ec 14             	sub    $0x14,%esp
+  806065:	8b 7d 08             	mov    0x8(%ebp),%edi
+  806068:	8b 75 14             	mov    0x14(%ebp),%esi
+  80606b:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  80606e:	ff 75 10             	push   0x10(%ebp)
+  806071:	ff 75 0c             	push   0xc(%ebp)
+  806074:	e8 d5 ba ff ff       	call   801b4e <sys_ipc_recv_pages>
+  806079:	83 c4 10             	add    $0x10,%esp
+  80607c:	85 c0                	test   %eax,%eax
+  80607e:	78 46                	js     8060c6 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  806080:	85 ff                	test   %edi,%edi
+  806082:	74 0d                	je     806091 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  806084:	a1 18 09 81 00       	mov    0x810918,%eax
+  806089:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80608f:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  806091:	85 f6                	test   %esi,%esi
+  806093:	74 0d                	je     8060a2 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  806095:	a1 18 09 81 00       	mov    0x810918,%eax
+  80609a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8060a0:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8060a2:	85 db                	test   %ebx,%ebx
+  8060a4:	74 0d                	je     8060b3 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  8060a6:	a1 18 09 81 00       	mov    0x810918,%eax
+  8060ab:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8060b1:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8060b3:	a1 18 09 81 00       	mov    0x810918,%eax
+  8060b8:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8060be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8060c1:	5b                   	pop    %ebx
+  8060c2:	5e                   	pop    %esi
+  8060c3:	5f                   	pop    %edi
+  8060c4:	5d                   	pop    %ebp
+  8060c5:	c3                   	ret
+		if (from_env_store) {
+  8060c6:	85 ff                	test   %edi,%edi
+  8060c8:	74 06                	je     8060d0 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  8060ca:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8060d0:	85 f6                	test   %esi,%esi
+  8060d2:	74 06                	je     8060da <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  8060d4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8060da:	85 db                	test   %ebx,%ebx
+  8060dc:	74 e0                	je     8060be <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8060de:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8060e4:	eb d8                	jmp    8060be <ipc_recv_pages+0x62>
+
+008060e6 <ipc_recv>:
+{
+  8060e6:	55                   	push   %ebp
+  8060e7:	89 e5                	mov    %esp,%ebp
+  8060e9:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8060ec:	6a 00                	push   $0x0
+  8060ee:	ff 75 10             	push   0x10(%ebp)
+  8060f1:	6a 01                	push   $0x1
+  8060f3:	ff 75 0c             	push   0xc(%ebp)
+  8060f6:	ff 75 08             	push   0x8(%ebp)
+  8060f9:	e8 5e ff ff ff       	call   80605c <ipc_recv_pages>
+}
+  8060fe:	c9                   	leave
+  8060ff:	c3                   	ret
+
+00806100 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  806100:	55                   	push   %ebp
+  806101:	89 e5                	mov    %esp,%ebp
+  806103:	56                   	push   %esi
+  806104:	53                   	push   %ebx
+  806105:	8b 75 08             	mov    0x8(%ebp),%esi
+  806108:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  80610b:	83 ec 0c             	sub    $0xc,%esp
+  80610e:	ff 75 0c             	push   0xc(%ebp)
+  806111:	e8 6c bb ff ff       	call   801c82 <sys_ipc_try_recv>
+  806116:	83 c4 10             	add    $0x10,%esp
+  806119:	85 c0                	test   %eax,%eax
+  80611b:	78 34                	js     806151 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80611d:	85 f6                	test   %esi,%esi
+  80611f:	74 0d                	je     80612e <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  806121:	a1 18 09 81 00       	mov    0x810918,%eax
+  806126:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80612c:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  80612e:	85 db                	test   %ebx,%ebx
+  806130:	74 0d                	je     80613f <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  806132:	a1 18 09 81 00       	mov    0x810918,%eax
+  806137:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80613d:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80613f:	a1 18 09 81 00       	mov    0x810918,%eax
+  806144:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80614a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80614d:	5b                   	pop    %ebx
+  80614e:	5e                   	pop    %esi
+  80614f:	5d                   	pop    %ebp
+  806150:	c3                   	ret
+		if (from_env_store) {
+  806151:	85 f6                	test   %esi,%esi
+  806153:	74 06                	je     80615b <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  806155:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  80615b:	85 db                	test   %ebx,%ebx
+  80615d:	74 eb                	je     80614a <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  80615f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  806165:	eb e3                	jmp    80614a <ipc_try_recv+0x4a>
+
+00806167 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  806167:	55                   	push   %ebp
+  806168:	89 e5                	mov    %esp,%ebp
+  80616a:	83 ec 14             	sub    $0x14,%esp
+  80616d:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  806170:	85 c0                	test   %eax,%eax
+  806172:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  806177:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80617a:	ff 75 18             	push   0x18(%ebp)
+  80617d:	ff 75 14             	push   0x14(%ebp)
+  806180:	50                   	push   %eax
+  806181:	ff 75 0c             	push   0xc(%ebp)
+  806184:	ff 75 08             	push   0x8(%ebp)
+  806187:	e8 85 b9 ff ff       	call   801b11 <sys_ipc_send_pages>
+  80618c:	83 c4 20             	add    $0x20,%esp
+  80618f:	85 c0                	test   %eax,%eax
+  806191:	78 02                	js     806195 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  806193:	c9                   	leave
+  806194:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  806195:	50                   	push   %eax
+  806196:	68 14 73 80 00       	push   $0x807314
+  80619b:	68 80 00 00 00       	push   $0x80
+  8061a0:	68 40 73 80 00       	push   $0x807340
+  8061a5:	e8 dc a8 ff ff       	call   800a86 <_panic>
+
+008061aa <ipc_send>:
+{
+  8061aa:	55                   	push   %ebp
+  8061ab:	89 e5                	mov    %esp,%ebp
+  8061ad:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  8061b0:	ff 75 14             	push   0x14(%ebp)
+  8061b3:	6a 01                	push   $0x1
+  8061b5:	ff 75 10             	push   0x10(%ebp)
+  8061b8:	ff 75 0c             	push   0xc(%ebp)
+  8061bb:	ff 75 08             	push   0x8(%ebp)
+  8061be:	e8 a4 ff ff ff       	call   806167 <ipc_send_pages>
+}
+  8061c3:	83 c4 20             	add    $0x20,%esp
+  8061c6:	c9                   	leave
+  8061c7:	c3                   	ret
+
+008061c8 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8061c8:	55                   	push   %ebp
+  8061c9:	89 e5                	mov    %esp,%ebp
+  8061cb:	83 ec 14             	sub    $0x14,%esp
+  8061ce:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8061d1:	85 c0                	test   %eax,%eax
+  8061d3:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8061d8:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8061db:	ff 75 18             	push   0x18(%ebp)
+  8061de:	ff 75 14             	push   0x14(%ebp)
+  8061e1:	50                   	push   %eax
+  8061e2:	ff 75 0c             	push   0xc(%ebp)
+  8061e5:	ff 75 08             	push   0x8(%ebp)
+  8061e8:	e8 b5 b9 ff ff       	call   801ba2 <sys_ipc_call>
+  8061ed:	83 c4 20             	add    $0x20,%esp
+  8061f0:	85 c0                	test   %eax,%eax
+  8061f2:	78 0b                	js     8061ff <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  8061f4:	a1 18 09 81 00       	mov    0x810918,%eax
+  8061f9:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8061ff:	c9                   	leave
+  806200:	c3                   	ret
+
+00806201 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  806201:	55                   	push   %ebp
+  806202:	89 e5                	mov    %esp,%ebp
+  806204:	57                   	push   %edi
+  806205:	56                   	push   %esi
+  806206:	53                   	push   %ebx
+  806207:	83 ec 18             	sub    $0x18,%esp
+  80620a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80620d:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  806210:	8b 75 20             	mov    0x20(%ebp),%esi
+  806213:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  806216:	85 c0                	test   %eax,%eax
+  806218:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80621d:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  806220:	ff 75 18             	push   0x18(%ebp)
+  806223:	ff 75 14             	push   0x14(%ebp)
+  806226:	50                   	push   %eax
+  806227:	ff 75 0c             	push   0xc(%ebp)
+  80622a:	ff 75 08             	push   0x8(%ebp)
+  80622d:	e8 b1 b9 ff ff       	call   801be3 <sys_ipc_reply_recv>
+  806232:	83 c4 20             	add    $0x20,%esp
+  806235:	85 c0                	test   %eax,%eax
+  806237:	78 46                	js     80627f <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  806239:	85 ff                	test   %edi,%edi
+  80623b:	74 0d                	je     80624a <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  80623d:	a1 18 09 81 00       	mov    0x810918,%eax
+  806242:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  806248:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80624a:	85 f6                	test   %esi,%esi
+  80624c:	74 0d                	je     80625b <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  80624e:	a1 18 09 81 00       	mov    0x810918,%eax
+  806253:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  806259:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80625b:	85 db                	test   %ebx,%ebx
+  80625d:	74 0d                	je     80626c <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  80625f:	a1 18 09 81 00       	mov    0x810918,%eax
+  806264:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80626a:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80626c:	a1 18 09 81 00       	mov    0x810918,%eax
+  806271:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  806277:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80627a:	5b                   	pop    %ebx
+  80627b:	5e                   	pop    %esi
+  80627c:	5f                   	pop    %edi
+  80627d:	5d                   	pop    %ebp
+  80627e:	c3                   	ret
+		if (from_env_store) {
+  80627f:	85 ff                	test   %edi,%edi
+  806281:	74 06                	je     806289 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  806283:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  806289:	85 f6                	test   %esi,%esi
+  80628b:	74 06                	je     806293 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  80628d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  806293:	85 db                	test   %ebx,%ebx
+  806295:	74 e0                	je     806277 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  806297:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80629d:	eb d8                	jmp    806277 <ipc_reply_recv+0x76>
+
+0080629f <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80629f:	55                   	push   %ebp
+  8062a0:	89 e5                	mov    %esp,%ebp
+  8062a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8062a5:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8062aa:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8062ad:	c1 e0 06             	shl    $0x6,%eax
+  8062b0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8062b5:	8b 40 50             	mov    0x50(%eax),%eax
+  8062b8:	39 c8                	cmp    %ecx,%eax
+  8062ba:	74 12                	je     8062ce <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8062bc:	83 c2 01             	add    $0x1,%edx
+  8062bf:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8062c5:	75 e3                	jne    8062aa <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8062c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062cc:	eb 0e                	jmp    8062dc <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8062ce:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8062d1:	c1 e0 06             	shl    $0x6,%eax
+  8062d4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8062d9:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8062dc:	5d                   	pop    %ebp
+  8062dd:	c3                   	ret
+
+008062de <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8062de:	55                   	push   %ebp
+  8062df:	89 e5                	mov    %esp,%ebp
+  8062e1:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8062e4:	89 c2                	mov    %eax,%edx
+  8062e6:	c1 ea 16             	shr    $0x16,%edx
+  8062e9:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8062f0:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8062f5:	f6 c1 01             	test   $0x1,%cl
+  8062f8:	74 1e                	je     806318 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  8062fa:	c1 e8 0c             	shr    $0xc,%eax
+  8062fd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  806304:	a8 01                	test   $0x1,%al
+  806306:	74 10                	je     806318 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  806308:	c1 e8 0c             	shr    $0xc,%eax
+  80630b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80630e:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  806315:	0f b7 d2             	movzwl %dx,%edx
+}
+  806318:	89 d0                	mov    %edx,%eax
+  80631a:	5d                   	pop    %ebp
+  80631b:	c3                   	ret
+
+0080631c <udivmod>:
+  80631c:	55                   	push   %ebp
+  80631d:	57                   	push   %edi
+  80631e:	56                   	push   %esi
+  80631f:	53                   	push   %ebx
+  806320:	83 ec 24             	sub    $0x24,%esp
+  806323:	89 44 24 08          	mov    %eax,0x8(%esp)
+  806327:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80632b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80632f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  806333:	89 44 24 10          	mov    %eax,0x10(%esp)
+  806337:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80633b:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80633f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  806344:	b8 00 00 00 00       	mov    $0x0,%eax
+  806349:	ba 00 00 00 00       	mov    $0x0,%edx
+  80634e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  806355:	00 
+  806356:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80635d:	00 
+  80635e:	89 fb                	mov    %edi,%ebx
+  806360:	eb 08                	jmp    80636a <udivmod+0x4e>
+  806362:	83 e9 01             	sub    $0x1,%ecx
+  806365:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  806368:	74 68                	je     8063d2 <udivmod+0xb6>
+  80636a:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80636e:	01 c0                	add    %eax,%eax
+  806370:	89 c6                	mov    %eax,%esi
+  806372:	89 d7                	mov    %edx,%edi
+  806374:	8b 44 24 08          	mov    0x8(%esp),%eax
+  806378:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80637c:	0f ad d0             	shrd   %cl,%edx,%eax
+  80637f:	d3 ea                	shr    %cl,%edx
+  806381:	f6 c1 20             	test   $0x20,%cl
+  806384:	74 04                	je     80638a <udivmod+0x6e>
+  806386:	89 d0                	mov    %edx,%eax
+  806388:	31 d2                	xor    %edx,%edx
+  80638a:	83 e0 01             	and    $0x1,%eax
+  80638d:	89 04 24             	mov    %eax,(%esp)
+  806390:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  806397:	00 
+  806398:	8b 04 24             	mov    (%esp),%eax
+  80639b:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80639f:	09 f0                	or     %esi,%eax
+  8063a1:	09 fa                	or     %edi,%edx
+  8063a3:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8063a7:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8063ab:	39 f0                	cmp    %esi,%eax
+  8063ad:	89 d5                	mov    %edx,%ebp
+  8063af:	19 fd                	sbb    %edi,%ebp
+  8063b1:	72 af                	jb     806362 <udivmod+0x46>
+  8063b3:	29 f0                	sub    %esi,%eax
+  8063b5:	19 fa                	sbb    %edi,%edx
+  8063b7:	89 cf                	mov    %ecx,%edi
+  8063b9:	c1 ef 05             	shr    $0x5,%edi
+  8063bc:	83 e7 01             	and    $0x1,%edi
+  8063bf:	89 fe                	mov    %edi,%esi
+  8063c1:	83 f6 01             	xor    $0x1,%esi
+  8063c4:	d3 e6                	shl    %cl,%esi
+  8063c6:	d3 e7                	shl    %cl,%edi
+  8063c8:	09 74 24 18          	or     %esi,0x18(%esp)
+  8063cc:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8063d0:	eb 90                	jmp    806362 <udivmod+0x46>
+  8063d2:	85 db                	test   %ebx,%ebx
+  8063d4:	74 05                	je     8063db <udivmod+0xbf>
+  8063d6:	89 03                	mov    %eax,(%ebx)
+  8063d8:	89 53 04             	mov    %edx,0x4(%ebx)
+  8063db:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8063df:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8063e3:	83 c4 24             	add    $0x24,%esp
+  8063e6:	5b                   	pop    %ebx
+  8063e7:	5e                   	pop    %esi
+  8063e8:	5f                   	pop    %edi
+  8063e9:	5d                   	pop    %ebp
+  8063ea:	c3                   	ret
+
+008063eb <__udivdi3>:
+  8063eb:	83 ec 08             	sub    $0x8,%esp
+  8063ee:	6a 00                	push   $0x0
+  8063f0:	ff 74 24 1c          	push   0x1c(%esp)
+  8063f4:	ff 74 24 1c          	push   0x1c(%esp)
+  8063f8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8063fc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  806400:	e8 17 ff ff ff       	call   80631c <udivmod>
+  806405:	83 c4 14             	add    $0x14,%esp
+  806408:	c3                   	ret
+
+00806409 <__umoddi3>:
+  806409:	83 ec 18             	sub    $0x18,%esp
+  80640c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  806410:	50                   	push   %eax
+  806411:	ff 74 24 2c          	push   0x2c(%esp)
+  806415:	ff 74 24 2c          	push   0x2c(%esp)
+  806419:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80641d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  806421:	e8 f6 fe ff ff       	call   80631c <udivmod>
+  806426:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80642a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80642e:	83 c4 24             	add    $0x24,%esp
+  806431:	c3                   	ret
+
+00806432 <__divdi3>:
+  806432:	55                   	push   %ebp
+  806433:	57                   	push   %edi
+  806434:	56                   	push   %esi
+  806435:	53                   	push   %ebx
+  806436:	83 ec 10             	sub    $0x10,%esp
+  806439:	8b 44 24 24          	mov    0x24(%esp),%eax
+  80643d:	8b 54 24 28          	mov    0x28(%esp),%edx
+  806441:	89 c6                	mov    %eax,%esi
+  806443:	89 d7                	mov    %edx,%edi
+  806445:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  806449:	33 7c 24 30          	xor    0x30(%esp),%edi
+  80644d:	89 74 24 04          	mov    %esi,0x4(%esp)
+  806451:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  806455:	89 c5                	mov    %eax,%ebp
+  806457:	f7 dd                	neg    %ebp
+  806459:	89 d6                	mov    %edx,%esi
+  80645b:	83 d6 00             	adc    $0x0,%esi
+  80645e:	f7 de                	neg    %esi
+  806460:	0f 48 e8             	cmovs  %eax,%ebp
+  806463:	0f 49 d6             	cmovns %esi,%edx
+  806466:	6a 00                	push   $0x0
+  806468:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80646c:	f7 de                	neg    %esi
+  80646e:	8b 44 24 34          	mov    0x34(%esp),%eax
+  806472:	83 d0 00             	adc    $0x0,%eax
+  806475:	f7 d8                	neg    %eax
+  806477:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  80647c:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  806481:	50                   	push   %eax
+  806482:	56                   	push   %esi
+  806483:	89 e8                	mov    %ebp,%eax
+  806485:	e8 92 fe ff ff       	call   80631c <udivmod>
+  80648a:	83 c4 10             	add    $0x10,%esp
+  80648d:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  806492:	78 08                	js     80649c <__divdi3+0x6a>
+  806494:	83 c4 0c             	add    $0xc,%esp
+  806497:	5b                   	pop    %ebx
+  806498:	5e                   	pop    %esi
+  806499:	5f                   	pop    %edi
+  80649a:	5d                   	pop    %ebp
+  80649b:	c3                   	ret
+  80649c:	f7 d8                	neg    %eax
+  80649e:	83 d2 00             	adc    $0x0,%edx
+  8064a1:	f7 da                	neg    %edx
+  8064a3:	eb ef                	jmp    806494 <__divdi3+0x62>
+
+008064a5 <__moddi3>:
+  8064a5:	55                   	push   %ebp
+  8064a6:	57                   	push   %edi
+  8064a7:	56                   	push   %esi
+  8064a8:	53                   	push   %ebx
+  8064a9:	83 ec 18             	sub    $0x18,%esp
+  8064ac:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8064b0:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8064b4:	89 f1                	mov    %esi,%ecx
+  8064b6:	f7 d9                	neg    %ecx
+  8064b8:	89 da                	mov    %ebx,%edx
+  8064ba:	83 d2 00             	adc    $0x0,%edx
+  8064bd:	f7 da                	neg    %edx
+  8064bf:	0f 48 ce             	cmovs  %esi,%ecx
+  8064c2:	0f 48 d3             	cmovs  %ebx,%edx
+  8064c5:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8064c9:	50                   	push   %eax
+  8064ca:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8064ce:	f7 de                	neg    %esi
+  8064d0:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8064d4:	83 d0 00             	adc    $0x0,%eax
+  8064d7:	f7 d8                	neg    %eax
+  8064d9:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8064de:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8064e3:	50                   	push   %eax
+  8064e4:	56                   	push   %esi
+  8064e5:	89 c8                	mov    %ecx,%eax
+  8064e7:	e8 30 fe ff ff       	call   80631c <udivmod>
+  8064ec:	83 c4 10             	add    $0x10,%esp
+  8064ef:	85 db                	test   %ebx,%ebx
+  8064f1:	78 10                	js     806503 <__moddi3+0x5e>
+  8064f3:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8064f7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8064fb:	83 c4 14             	add    $0x14,%esp
+  8064fe:	5b                   	pop    %ebx
+  8064ff:	5e                   	pop    %esi
+  806500:	5f                   	pop    %edi
+  806501:	5d                   	pop    %ebp
+  806502:	c3                   	ret
+  806503:	8b 44 24 08          	mov    0x8(%esp),%eax
+  806507:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80650b:	f7 d8                	neg    %eax
+  80650d:	83 d2 00             	adc    $0x0,%edx
+  806510:	f7 da                	neg    %edx
+  806512:	eb e7                	jmp    8064fb <__moddi3+0x56>
@@ -0,0 +1,5556 @@
+
+obj/user/softint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 05 00 00 00       	call   800036 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $14");	// page fault
+  800033:	cd 0e                	int    $0xe
+}
+  800035:	c3                   	ret
+
+00800036 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800036:	55                   	push   %ebp
+  800037:	89 e5                	mov    %esp,%ebp
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800041:	e8 08 01 00 00       	call   80014e <sys_getenvid>
+  800046:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80004e:	c1 e0 06             	shl    $0x6,%eax
+  800051:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800056:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80005b:	85 db                	test   %ebx,%ebx
+  80005d:	7e 07                	jle    800066 <libmain+0x30>
+		binaryname = argv[0];
+  80005f:	8b 06                	mov    (%esi),%eax
+  800061:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  800066:	83 ec 08             	sub    $0x8,%esp
+  800069:	56                   	push   %esi
+  80006a:	53                   	push   %ebx
+  80006b:	e8 c3 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800070:	e8 0a 00 00 00       	call   80007f <exit>
+}
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007b:	5b                   	pop    %ebx
+  80007c:	5e                   	pop    %esi
+  80007d:	5d                   	pop    %ebp
+  80007e:	c3                   	ret
+
+0080007f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80007f:	55                   	push   %ebp
+  800080:	89 e5                	mov    %esp,%ebp
+  800082:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800085:	e8 68 08 00 00       	call   8008f2 <close_all>
+	sys_env_destroy(0);
+  80008a:	83 ec 0c             	sub    $0xc,%esp
+  80008d:	6a 00                	push   $0x0
+  80008f:	e8 79 00 00 00       	call   80010d <sys_env_destroy>
+}
+  800094:	83 c4 10             	add    $0x10,%esp
+  800097:	c9                   	leave
+  800098:	c3                   	ret
+
+00800099 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800099:	55                   	push   %ebp
+  80009a:	89 e5                	mov    %esp,%ebp
+  80009c:	83 ec 10             	sub    $0x10,%esp
+  80009f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000a2:	89 c8                	mov    %ecx,%eax
+  8000a4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8000a9:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8000ac:	eb 0b                	jmp    8000b9 <touch_mem+0x20>
+		c = *(char *)page;
+  8000ae:	0f b6 10             	movzbl (%eax),%edx
+  8000b1:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  8000b4:	05 00 10 00 00       	add    $0x1000,%eax
+  8000b9:	39 c8                	cmp    %ecx,%eax
+  8000bb:	72 f1                	jb     8000ae <touch_mem+0x15>
+}
+  8000bd:	c9                   	leave
+  8000be:	c3                   	ret
+
+008000bf <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000bf:	55                   	push   %ebp
+  8000c0:	89 e5                	mov    %esp,%ebp
+  8000c2:	57                   	push   %edi
+  8000c3:	56                   	push   %esi
+  8000c4:	53                   	push   %ebx
+	touch_mem(s, len);
+  8000c5:	ff 75 0c             	push   0xc(%ebp)
+  8000c8:	ff 75 08             	push   0x8(%ebp)
+  8000cb:	e8 c9 ff ff ff       	call   800099 <touch_mem>
+	asm volatile("int %1\n"
+  8000d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000db:	89 c3                	mov    %eax,%ebx
+  8000dd:	89 c7                	mov    %eax,%edi
+  8000df:	89 c6                	mov    %eax,%esi
+  8000e1:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000e3:	83 c4 08             	add    $0x8,%esp
+  8000e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e9:	5b                   	pop    %ebx
+  8000ea:	5e                   	pop    %esi
+  8000eb:	5f                   	pop    %edi
+  8000ec:	5d                   	pop    %ebp
+  8000ed:	c3                   	ret
+
+008000ee <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000ee:	55                   	push   %ebp
+  8000ef:	89 e5                	mov    %esp,%ebp
+  8000f1:	57                   	push   %edi
+  8000f2:	56                   	push   %esi
+  8000f3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000fe:	89 d1                	mov    %edx,%ecx
+  800100:	89 d3                	mov    %edx,%ebx
+  800102:	89 d7                	mov    %edx,%edi
+  800104:	89 d6                	mov    %edx,%esi
+  800106:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800108:	5b                   	pop    %ebx
+  800109:	5e                   	pop    %esi
+  80010a:	5f                   	pop    %edi
+  80010b:	5d                   	pop    %ebp
+  80010c:	c3                   	ret
+
+0080010d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80010d:	55                   	push   %ebp
+  80010e:	89 e5                	mov    %esp,%ebp
+  800110:	57                   	push   %edi
+  800111:	56                   	push   %esi
+  800112:	53                   	push   %ebx
+  800113:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800116:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80011b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80011e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800123:	89 cb                	mov    %ecx,%ebx
+  800125:	89 cf                	mov    %ecx,%edi
+  800127:	89 ce                	mov    %ecx,%esi
+  800129:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80012b:	85 c0                	test   %eax,%eax
+  80012d:	7f 08                	jg     800137 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80012f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800132:	5b                   	pop    %ebx
+  800133:	5e                   	pop    %esi
+  800134:	5f                   	pop    %edi
+  800135:	5d                   	pop    %ebp
+  800136:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800137:	83 ec 0c             	sub    $0xc,%esp
+  80013a:	50                   	push   %eax
+  80013b:	6a 03                	push   $0x3
+  80013d:	68 aa 26 80 00       	push   $0x8026aa
+  800142:	6a 23                	push   $0x23
+  800144:	68 c7 26 80 00       	push   $0x8026c7
+  800149:	e8 b9 15 00 00       	call   801707 <_panic>
+
+0080014e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80014e:	55                   	push   %ebp
+  80014f:	89 e5                	mov    %esp,%ebp
+  800151:	57                   	push   %edi
+  800152:	56                   	push   %esi
+  800153:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800154:	ba 00 00 00 00       	mov    $0x0,%edx
+  800159:	b8 02 00 00 00       	mov    $0x2,%eax
+  80015e:	89 d1                	mov    %edx,%ecx
+  800160:	89 d3                	mov    %edx,%ebx
+  800162:	89 d7                	mov    %edx,%edi
+  800164:	89 d6                	mov    %edx,%esi
+  800166:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800168:	5b                   	pop    %ebx
+  800169:	5e                   	pop    %esi
+  80016a:	5f                   	pop    %edi
+  80016b:	5d                   	pop    %ebp
+  80016c:	c3                   	ret
+
+0080016d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80016d:	55                   	push   %ebp
+  80016e:	89 e5                	mov    %esp,%ebp
+  800170:	57                   	push   %edi
+  800171:	56                   	push   %esi
+  800172:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800173:	ba 00 00 00 00       	mov    $0x0,%edx
+  800178:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80017d:	89 d1                	mov    %edx,%ecx
+  80017f:	89 d3                	mov    %edx,%ebx
+  800181:	89 d7                	mov    %edx,%edi
+  800183:	89 d6                	mov    %edx,%esi
+  800185:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800187:	5b                   	pop    %ebx
+  800188:	5e                   	pop    %esi
+  800189:	5f                   	pop    %edi
+  80018a:	5d                   	pop    %ebp
+  80018b:	c3                   	ret
+
+0080018c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80018c:	55                   	push   %ebp
+  80018d:	89 e5                	mov    %esp,%ebp
+  80018f:	57                   	push   %edi
+  800190:	56                   	push   %esi
+  800191:	53                   	push   %ebx
+  800192:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800195:	be 00 00 00 00       	mov    $0x0,%esi
+  80019a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80019d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001a0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001a8:	89 f7                	mov    %esi,%edi
+  8001aa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001ac:	85 c0                	test   %eax,%eax
+  8001ae:	7f 08                	jg     8001b8 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001b3:	5b                   	pop    %ebx
+  8001b4:	5e                   	pop    %esi
+  8001b5:	5f                   	pop    %edi
+  8001b6:	5d                   	pop    %ebp
+  8001b7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001b8:	83 ec 0c             	sub    $0xc,%esp
+  8001bb:	50                   	push   %eax
+  8001bc:	6a 04                	push   $0x4
+  8001be:	68 aa 26 80 00       	push   $0x8026aa
+  8001c3:	6a 23                	push   $0x23
+  8001c5:	68 c7 26 80 00       	push   $0x8026c7
+  8001ca:	e8 38 15 00 00       	call   801707 <_panic>
+
+008001cf <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001cf:	55                   	push   %ebp
+  8001d0:	89 e5                	mov    %esp,%ebp
+  8001d2:	57                   	push   %edi
+  8001d3:	56                   	push   %esi
+  8001d4:	53                   	push   %ebx
+  8001d5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001de:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001e6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001e9:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001ec:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001ee:	85 c0                	test   %eax,%eax
+  8001f0:	7f 08                	jg     8001fa <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001f5:	5b                   	pop    %ebx
+  8001f6:	5e                   	pop    %esi
+  8001f7:	5f                   	pop    %edi
+  8001f8:	5d                   	pop    %ebp
+  8001f9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001fa:	83 ec 0c             	sub    $0xc,%esp
+  8001fd:	50                   	push   %eax
+  8001fe:	6a 05                	push   $0x5
+  800200:	68 aa 26 80 00       	push   $0x8026aa
+  800205:	6a 23                	push   $0x23
+  800207:	68 c7 26 80 00       	push   $0x8026c7
+  80020c:	e8 f6 14 00 00       	call   801707 <_panic>
+
+00800211 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800211:	55                   	push   %ebp
+  800212:	89 e5                	mov    %esp,%ebp
+  800214:	57                   	push   %edi
+  800215:	56                   	push   %esi
+  800216:	53                   	push   %ebx
+  800217:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80021a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80021f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800222:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800225:	b8 06 00 00 00       	mov    $0x6,%eax
+  80022a:	89 df                	mov    %ebx,%edi
+  80022c:	89 de                	mov    %ebx,%esi
+  80022e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800230:	85 c0                	test   %eax,%eax
+  800232:	7f 08                	jg     80023c <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800234:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800237:	5b                   	pop    %ebx
+  800238:	5e                   	pop    %esi
+  800239:	5f                   	pop    %edi
+  80023a:	5d                   	pop    %ebp
+  80023b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80023c:	83 ec 0c             	sub    $0xc,%esp
+  80023f:	50                   	push   %eax
+  800240:	6a 06                	push   $0x6
+  800242:	68 aa 26 80 00       	push   $0x8026aa
+  800247:	6a 23                	push   $0x23
+  800249:	68 c7 26 80 00       	push   $0x8026c7
+  80024e:	e8 b4 14 00 00       	call   801707 <_panic>
+
+00800253 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800253:	55                   	push   %ebp
+  800254:	89 e5                	mov    %esp,%ebp
+  800256:	57                   	push   %edi
+  800257:	56                   	push   %esi
+  800258:	53                   	push   %ebx
+  800259:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80025c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800261:	8b 55 08             	mov    0x8(%ebp),%edx
+  800264:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800267:	b8 18 00 00 00       	mov    $0x18,%eax
+  80026c:	89 df                	mov    %ebx,%edi
+  80026e:	89 de                	mov    %ebx,%esi
+  800270:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800272:	85 c0                	test   %eax,%eax
+  800274:	7f 08                	jg     80027e <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800276:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800279:	5b                   	pop    %ebx
+  80027a:	5e                   	pop    %esi
+  80027b:	5f                   	pop    %edi
+  80027c:	5d                   	pop    %ebp
+  80027d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80027e:	83 ec 0c             	sub    $0xc,%esp
+  800281:	50                   	push   %eax
+  800282:	6a 18                	push   $0x18
+  800284:	68 aa 26 80 00       	push   $0x8026aa
+  800289:	6a 23                	push   $0x23
+  80028b:	68 c7 26 80 00       	push   $0x8026c7
+  800290:	e8 72 14 00 00       	call   801707 <_panic>
+
+00800295 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800295:	55                   	push   %ebp
+  800296:	89 e5                	mov    %esp,%ebp
+  800298:	57                   	push   %edi
+  800299:	56                   	push   %esi
+  80029a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80029b:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002a6:	b8 19 00 00 00       	mov    $0x19,%eax
+  8002ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002ae:	89 f7                	mov    %esi,%edi
+  8002b0:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  8002b2:	5b                   	pop    %ebx
+  8002b3:	5e                   	pop    %esi
+  8002b4:	5f                   	pop    %edi
+  8002b5:	5d                   	pop    %ebp
+  8002b6:	c3                   	ret
+
+008002b7 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8002b7:	55                   	push   %ebp
+  8002b8:	89 e5                	mov    %esp,%ebp
+  8002ba:	57                   	push   %edi
+  8002bb:	56                   	push   %esi
+  8002bc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8002bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8002c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8002cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002d0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002d3:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8002d5:	5b                   	pop    %ebx
+  8002d6:	5e                   	pop    %esi
+  8002d7:	5f                   	pop    %edi
+  8002d8:	5d                   	pop    %ebp
+  8002d9:	c3                   	ret
+
+008002da <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  8002da:	55                   	push   %ebp
+  8002db:	89 e5                	mov    %esp,%ebp
+  8002dd:	57                   	push   %edi
+  8002de:	56                   	push   %esi
+  8002df:	53                   	push   %ebx
+  8002e0:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  8002e3:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8002e6:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8002ec:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  8002ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f5:	b8 10 00 00 00       	mov    $0x10,%eax
+  8002fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002fd:	8b 75 18             	mov    0x18(%ebp),%esi
+  800300:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800302:	85 c0                	test   %eax,%eax
+  800304:	7f 08                	jg     80030e <sys_page_map_range+0x34>
+}
+  800306:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800309:	5b                   	pop    %ebx
+  80030a:	5e                   	pop    %esi
+  80030b:	5f                   	pop    %edi
+  80030c:	5d                   	pop    %ebp
+  80030d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80030e:	83 ec 0c             	sub    $0xc,%esp
+  800311:	50                   	push   %eax
+  800312:	6a 10                	push   $0x10
+  800314:	68 aa 26 80 00       	push   $0x8026aa
+  800319:	6a 23                	push   $0x23
+  80031b:	68 c7 26 80 00       	push   $0x8026c7
+  800320:	e8 e2 13 00 00       	call   801707 <_panic>
+
+00800325 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800325:	55                   	push   %ebp
+  800326:	89 e5                	mov    %esp,%ebp
+  800328:	57                   	push   %edi
+  800329:	56                   	push   %esi
+  80032a:	53                   	push   %ebx
+  80032b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	8b 55 08             	mov    0x8(%ebp),%edx
+  800336:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800339:	b8 11 00 00 00       	mov    $0x11,%eax
+  80033e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800341:	89 f7                	mov    %esi,%edi
+  800343:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800345:	85 c0                	test   %eax,%eax
+  800347:	7f 08                	jg     800351 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800349:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80034c:	5b                   	pop    %ebx
+  80034d:	5e                   	pop    %esi
+  80034e:	5f                   	pop    %edi
+  80034f:	5d                   	pop    %ebp
+  800350:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800351:	83 ec 0c             	sub    $0xc,%esp
+  800354:	50                   	push   %eax
+  800355:	6a 11                	push   $0x11
+  800357:	68 aa 26 80 00       	push   $0x8026aa
+  80035c:	6a 23                	push   $0x23
+  80035e:	68 c7 26 80 00       	push   $0x8026c7
+  800363:	e8 9f 13 00 00       	call   801707 <_panic>
+
+00800368 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800368:	55                   	push   %ebp
+  800369:	89 e5                	mov    %esp,%ebp
+  80036b:	57                   	push   %edi
+  80036c:	56                   	push   %esi
+  80036d:	53                   	push   %ebx
+  80036e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800371:	be 00 00 00 00       	mov    $0x0,%esi
+  800376:	8b 55 08             	mov    0x8(%ebp),%edx
+  800379:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80037c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800381:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800384:	89 f7                	mov    %esi,%edi
+  800386:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800388:	85 c0                	test   %eax,%eax
+  80038a:	7f 08                	jg     800394 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  80038c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80038f:	5b                   	pop    %ebx
+  800390:	5e                   	pop    %esi
+  800391:	5f                   	pop    %edi
+  800392:	5d                   	pop    %ebp
+  800393:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800394:	83 ec 0c             	sub    $0xc,%esp
+  800397:	50                   	push   %eax
+  800398:	6a 1b                	push   $0x1b
+  80039a:	68 aa 26 80 00       	push   $0x8026aa
+  80039f:	6a 23                	push   $0x23
+  8003a1:	68 c7 26 80 00       	push   $0x8026c7
+  8003a6:	e8 5c 13 00 00       	call   801707 <_panic>
+
+008003ab <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  8003ab:	55                   	push   %ebp
+  8003ac:	89 e5                	mov    %esp,%ebp
+  8003ae:	57                   	push   %edi
+  8003af:	56                   	push   %esi
+  8003b0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b6:	b8 12 00 00 00       	mov    $0x12,%eax
+  8003bb:	89 d1                	mov    %edx,%ecx
+  8003bd:	89 d3                	mov    %edx,%ebx
+  8003bf:	89 d7                	mov    %edx,%edi
+  8003c1:	89 d6                	mov    %edx,%esi
+  8003c3:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8003c5:	5b                   	pop    %ebx
+  8003c6:	5e                   	pop    %esi
+  8003c7:	5f                   	pop    %edi
+  8003c8:	5d                   	pop    %ebp
+  8003c9:	c3                   	ret
+
+008003ca <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003ca:	55                   	push   %ebp
+  8003cb:	89 e5                	mov    %esp,%ebp
+  8003cd:	57                   	push   %edi
+  8003ce:	56                   	push   %esi
+  8003cf:	53                   	push   %ebx
+  8003d0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003de:	b8 08 00 00 00       	mov    $0x8,%eax
+  8003e3:	89 df                	mov    %ebx,%edi
+  8003e5:	89 de                	mov    %ebx,%esi
+  8003e7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003e9:	85 c0                	test   %eax,%eax
+  8003eb:	7f 08                	jg     8003f5 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f0:	5b                   	pop    %ebx
+  8003f1:	5e                   	pop    %esi
+  8003f2:	5f                   	pop    %edi
+  8003f3:	5d                   	pop    %ebp
+  8003f4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003f5:	83 ec 0c             	sub    $0xc,%esp
+  8003f8:	50                   	push   %eax
+  8003f9:	6a 08                	push   $0x8
+  8003fb:	68 aa 26 80 00       	push   $0x8026aa
+  800400:	6a 23                	push   $0x23
+  800402:	68 c7 26 80 00       	push   $0x8026c7
+  800407:	e8 fb 12 00 00       	call   801707 <_panic>
+
+0080040c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80040c:	55                   	push   %ebp
+  80040d:	89 e5                	mov    %esp,%ebp
+  80040f:	57                   	push   %edi
+  800410:	56                   	push   %esi
+  800411:	53                   	push   %ebx
+  800412:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800415:	6a 44                	push   $0x44
+  800417:	ff 75 0c             	push   0xc(%ebp)
+  80041a:	e8 7a fc ff ff       	call   800099 <touch_mem>
+	asm volatile("int %1\n"
+  80041f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800424:	8b 55 08             	mov    0x8(%ebp),%edx
+  800427:	b8 09 00 00 00       	mov    $0x9,%eax
+  80042c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80042f:	89 df                	mov    %ebx,%edi
+  800431:	89 de                	mov    %ebx,%esi
+  800433:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800435:	83 c4 08             	add    $0x8,%esp
+  800438:	85 c0                	test   %eax,%eax
+  80043a:	7f 08                	jg     800444 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80043c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80043f:	5b                   	pop    %ebx
+  800440:	5e                   	pop    %esi
+  800441:	5f                   	pop    %edi
+  800442:	5d                   	pop    %ebp
+  800443:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800444:	83 ec 0c             	sub    $0xc,%esp
+  800447:	50                   	push   %eax
+  800448:	6a 09                	push   $0x9
+  80044a:	68 aa 26 80 00       	push   $0x8026aa
+  80044f:	6a 23                	push   $0x23
+  800451:	68 c7 26 80 00       	push   $0x8026c7
+  800456:	e8 ac 12 00 00       	call   801707 <_panic>
+
+0080045b <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  80045b:	55                   	push   %ebp
+  80045c:	89 e5                	mov    %esp,%ebp
+  80045e:	57                   	push   %edi
+  80045f:	56                   	push   %esi
+  800460:	53                   	push   %ebx
+  800461:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800464:	be 00 00 00 00       	mov    $0x0,%esi
+  800469:	8b 55 08             	mov    0x8(%ebp),%edx
+  80046c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80046f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800474:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800477:	89 f7                	mov    %esi,%edi
+  800479:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80047b:	85 c0                	test   %eax,%eax
+  80047d:	7f 08                	jg     800487 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  80047f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800482:	5b                   	pop    %ebx
+  800483:	5e                   	pop    %esi
+  800484:	5f                   	pop    %edi
+  800485:	5d                   	pop    %ebp
+  800486:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800487:	83 ec 0c             	sub    $0xc,%esp
+  80048a:	50                   	push   %eax
+  80048b:	6a 1a                	push   $0x1a
+  80048d:	68 aa 26 80 00       	push   $0x8026aa
+  800492:	6a 23                	push   $0x23
+  800494:	68 c7 26 80 00       	push   $0x8026c7
+  800499:	e8 69 12 00 00       	call   801707 <_panic>
+
+0080049e <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  80049e:	55                   	push   %ebp
+  80049f:	89 e5                	mov    %esp,%ebp
+  8004a1:	57                   	push   %edi
+  8004a2:	56                   	push   %esi
+  8004a3:	53                   	push   %ebx
+  8004a4:	83 ec 0c             	sub    $0xc,%esp
+  8004a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8004aa:	89 d8                	mov    %ebx,%eax
+  8004ac:	c1 e0 05             	shl    $0x5,%eax
+  8004af:	50                   	push   %eax
+  8004b0:	ff 75 0c             	push   0xc(%ebp)
+  8004b3:	e8 e1 fb ff ff       	call   800099 <touch_mem>
+	asm volatile("int %1\n"
+  8004b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8004bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c0:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004c8:	89 f7                	mov    %esi,%edi
+  8004ca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8004cc:	83 c4 08             	add    $0x8,%esp
+  8004cf:	85 c0                	test   %eax,%eax
+  8004d1:	7f 08                	jg     8004db <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8004d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004d6:	5b                   	pop    %ebx
+  8004d7:	5e                   	pop    %esi
+  8004d8:	5f                   	pop    %edi
+  8004d9:	5d                   	pop    %ebp
+  8004da:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8004db:	83 ec 0c             	sub    $0xc,%esp
+  8004de:	50                   	push   %eax
+  8004df:	6a 13                	push   $0x13
+  8004e1:	68 aa 26 80 00       	push   $0x8026aa
+  8004e6:	6a 23                	push   $0x23
+  8004e8:	68 c7 26 80 00       	push   $0x8026c7
+  8004ed:	e8 15 12 00 00       	call   801707 <_panic>
+
+008004f2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8004f2:	55                   	push   %ebp
+  8004f3:	89 e5                	mov    %esp,%ebp
+  8004f5:	57                   	push   %edi
+  8004f6:	56                   	push   %esi
+  8004f7:	53                   	push   %ebx
+  8004f8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8004fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800500:	8b 55 08             	mov    0x8(%ebp),%edx
+  800503:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800506:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80050b:	89 df                	mov    %ebx,%edi
+  80050d:	89 de                	mov    %ebx,%esi
+  80050f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800511:	85 c0                	test   %eax,%eax
+  800513:	7f 08                	jg     80051d <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800515:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800518:	5b                   	pop    %ebx
+  800519:	5e                   	pop    %esi
+  80051a:	5f                   	pop    %edi
+  80051b:	5d                   	pop    %ebp
+  80051c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80051d:	83 ec 0c             	sub    $0xc,%esp
+  800520:	50                   	push   %eax
+  800521:	6a 0a                	push   $0xa
+  800523:	68 aa 26 80 00       	push   $0x8026aa
+  800528:	6a 23                	push   $0x23
+  80052a:	68 c7 26 80 00       	push   $0x8026c7
+  80052f:	e8 d3 11 00 00       	call   801707 <_panic>
+
+00800534 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800534:	55                   	push   %ebp
+  800535:	89 e5                	mov    %esp,%ebp
+  800537:	57                   	push   %edi
+  800538:	56                   	push   %esi
+  800539:	53                   	push   %ebx
+  80053a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  80053d:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800543:	76 1d                	jbe    800562 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  800545:	8b 55 08             	mov    0x8(%ebp),%edx
+  800548:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80054b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800550:	be 01 00 00 00       	mov    $0x1,%esi
+  800555:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800558:	cd 30                	int    $0x30
+}
+  80055a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80055d:	5b                   	pop    %ebx
+  80055e:	5e                   	pop    %esi
+  80055f:	5f                   	pop    %edi
+  800560:	5d                   	pop    %ebp
+  800561:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  800562:	68 00 10 00 00       	push   $0x1000
+  800567:	53                   	push   %ebx
+  800568:	e8 2c fb ff ff       	call   800099 <touch_mem>
+  80056d:	83 c4 08             	add    $0x8,%esp
+  800570:	eb d3                	jmp    800545 <sys_ipc_send+0x11>
+
+00800572 <sys_ipc_send_pages>:
+{
+  800572:	55                   	push   %ebp
+  800573:	89 e5                	mov    %esp,%ebp
+  800575:	57                   	push   %edi
+  800576:	56                   	push   %esi
+  800577:	53                   	push   %ebx
+  800578:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80057b:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  80057e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800584:	76 18                	jbe    80059e <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  800586:	8b 55 08             	mov    0x8(%ebp),%edx
+  800589:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80058c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800591:	8b 7d 18             	mov    0x18(%ebp),%edi
+  800594:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  800596:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800599:	5b                   	pop    %ebx
+  80059a:	5e                   	pop    %esi
+  80059b:	5f                   	pop    %edi
+  80059c:	5d                   	pop    %ebp
+  80059d:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80059e:	89 f0                	mov    %esi,%eax
+  8005a0:	c1 e0 0c             	shl    $0xc,%eax
+  8005a3:	50                   	push   %eax
+  8005a4:	53                   	push   %ebx
+  8005a5:	e8 ef fa ff ff       	call   800099 <touch_mem>
+  8005aa:	83 c4 08             	add    $0x8,%esp
+  8005ad:	eb d7                	jmp    800586 <sys_ipc_send_pages+0x14>
+
+008005af <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8005af:	55                   	push   %ebp
+  8005b0:	89 e5                	mov    %esp,%ebp
+  8005b2:	57                   	push   %edi
+  8005b3:	56                   	push   %esi
+  8005b4:	53                   	push   %ebx
+  8005b5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8005b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8005c8:	89 df                	mov    %ebx,%edi
+  8005ca:	89 de                	mov    %ebx,%esi
+  8005cc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8005ce:	85 c0                	test   %eax,%eax
+  8005d0:	7f 08                	jg     8005da <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8005d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005d5:	5b                   	pop    %ebx
+  8005d6:	5e                   	pop    %esi
+  8005d7:	5f                   	pop    %edi
+  8005d8:	5d                   	pop    %ebp
+  8005d9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8005da:	83 ec 0c             	sub    $0xc,%esp
+  8005dd:	50                   	push   %eax
+  8005de:	6a 0d                	push   $0xd
+  8005e0:	68 aa 26 80 00       	push   $0x8026aa
+  8005e5:	6a 23                	push   $0x23
+  8005e7:	68 c7 26 80 00       	push   $0x8026c7
+  8005ec:	e8 16 11 00 00       	call   801707 <_panic>
+
+008005f1 <sys_ipc_recv>:
+{
+  8005f1:	55                   	push   %ebp
+  8005f2:	89 e5                	mov    %esp,%ebp
+  8005f4:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8005f7:	6a 01                	push   $0x1
+  8005f9:	ff 75 08             	push   0x8(%ebp)
+  8005fc:	e8 ae ff ff ff       	call   8005af <sys_ipc_recv_pages>
+}
+  800601:	c9                   	leave
+  800602:	c3                   	ret
+
+00800603 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  800603:	55                   	push   %ebp
+  800604:	89 e5                	mov    %esp,%ebp
+  800606:	57                   	push   %edi
+  800607:	56                   	push   %esi
+  800608:	53                   	push   %ebx
+  800609:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80060c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80060f:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  800612:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  800618:	77 04                	ja     80061e <sys_ipc_call+0x1b>
+  80061a:	85 f6                	test   %esi,%esi
+  80061c:	75 15                	jne    800633 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  80061e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800621:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800624:	b8 14 00 00 00       	mov    $0x14,%eax
+  800629:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80062b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80062e:	5b                   	pop    %ebx
+  80062f:	5e                   	pop    %esi
+  800630:	5f                   	pop    %edi
+  800631:	5d                   	pop    %ebp
+  800632:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  800633:	89 f8                	mov    %edi,%eax
+  800635:	c1 e0 0c             	shl    $0xc,%eax
+  800638:	50                   	push   %eax
+  800639:	53                   	push   %ebx
+  80063a:	e8 5a fa ff ff       	call   800099 <touch_mem>
+  80063f:	83 c4 08             	add    $0x8,%esp
+  800642:	eb da                	jmp    80061e <sys_ipc_call+0x1b>
+
+00800644 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  800644:	55                   	push   %ebp
+  800645:	89 e5                	mov    %esp,%ebp
+  800647:	57                   	push   %edi
+  800648:	56                   	push   %esi
+  800649:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80064a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80064d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800650:	b8 15 00 00 00       	mov    $0x15,%eax
+  800655:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800658:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80065b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80065e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  800660:	5b                   	pop    %ebx
+  800661:	5e                   	pop    %esi
+  800662:	5f                   	pop    %edi
+  800663:	5d                   	pop    %ebp
+  800664:	c3                   	ret
+
+00800665 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  800665:	55                   	push   %ebp
+  800666:	89 e5                	mov    %esp,%ebp
+  800668:	57                   	push   %edi
+  800669:	56                   	push   %esi
+  80066a:	53                   	push   %ebx
+  80066b:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  80066e:	6a 04                	push   $0x4
+  800670:	ff 75 08             	push   0x8(%ebp)
+  800673:	e8 21 fa ff ff       	call   800099 <touch_mem>
+	asm volatile("int %1\n"
+  800678:	be 00 00 00 00       	mov    $0x0,%esi
+  80067d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800680:	b8 16 00 00 00       	mov    $0x16,%eax
+  800685:	8b 55 08             	mov    0x8(%ebp),%edx
+  800688:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80068b:	89 f7                	mov    %esi,%edi
+  80068d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80068f:	83 c4 08             	add    $0x8,%esp
+  800692:	85 c0                	test   %eax,%eax
+  800694:	7f 08                	jg     80069e <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  800696:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800699:	5b                   	pop    %ebx
+  80069a:	5e                   	pop    %esi
+  80069b:	5f                   	pop    %edi
+  80069c:	5d                   	pop    %ebp
+  80069d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80069e:	83 ec 0c             	sub    $0xc,%esp
+  8006a1:	50                   	push   %eax
+  8006a2:	6a 16                	push   $0x16
+  8006a4:	68 aa 26 80 00       	push   $0x8026aa
+  8006a9:	6a 23                	push   $0x23
+  8006ab:	68 c7 26 80 00       	push   $0x8026c7
+  8006b0:	e8 52 10 00 00       	call   801707 <_panic>
+
+008006b5 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8006b5:	55                   	push   %ebp
+  8006b6:	89 e5                	mov    %esp,%ebp
+  8006b8:	57                   	push   %edi
+  8006b9:	56                   	push   %esi
+  8006ba:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8006bb:	6a 04                	push   $0x4
+  8006bd:	ff 75 08             	push   0x8(%ebp)
+  8006c0:	e8 d4 f9 ff ff       	call   800099 <touch_mem>
+	asm volatile("int %1\n"
+  8006c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006cd:	b8 17 00 00 00       	mov    $0x17,%eax
+  8006d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006d5:	89 df                	mov    %ebx,%edi
+  8006d7:	89 de                	mov    %ebx,%esi
+  8006d9:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8006db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006de:	5b                   	pop    %ebx
+  8006df:	5e                   	pop    %esi
+  8006e0:	5f                   	pop    %edi
+  8006e1:	5d                   	pop    %ebp
+  8006e2:	c3                   	ret
+
+008006e3 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8006e3:	55                   	push   %ebp
+  8006e4:	89 e5                	mov    %esp,%ebp
+  8006e6:	57                   	push   %edi
+  8006e7:	56                   	push   %esi
+  8006e8:	53                   	push   %ebx
+  8006e9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8006ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006f4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8006f9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8006fe:	89 df                	mov    %ebx,%edi
+  800700:	89 de                	mov    %ebx,%esi
+  800702:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800704:	85 c0                	test   %eax,%eax
+  800706:	7f 08                	jg     800710 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  800708:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80070b:	5b                   	pop    %ebx
+  80070c:	5e                   	pop    %esi
+  80070d:	5f                   	pop    %edi
+  80070e:	5d                   	pop    %ebp
+  80070f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800710:	83 ec 0c             	sub    $0xc,%esp
+  800713:	50                   	push   %eax
+  800714:	6a 0e                	push   $0xe
+  800716:	68 aa 26 80 00       	push   $0x8026aa
+  80071b:	6a 23                	push   $0x23
+  80071d:	68 c7 26 80 00       	push   $0x8026c7
+  800722:	e8 e0 0f 00 00       	call   801707 <_panic>
+
+00800727 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800727:	55                   	push   %ebp
+  800728:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80072a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80072d:	05 00 00 00 30       	add    $0x30000000,%eax
+  800732:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800735:	5d                   	pop    %ebp
+  800736:	c3                   	ret
+
+00800737 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800737:	55                   	push   %ebp
+  800738:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80073a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80073d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800742:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800747:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80074c:	5d                   	pop    %ebp
+  80074d:	c3                   	ret
+
+0080074e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80074e:	55                   	push   %ebp
+  80074f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  800751:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  800756:	a8 01                	test   $0x1,%al
+  800758:	74 3c                	je     800796 <fd_alloc+0x48>
+  80075a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80075f:	89 c2                	mov    %eax,%edx
+  800761:	c1 ea 0c             	shr    $0xc,%edx
+  800764:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80076b:	89 c1                	mov    %eax,%ecx
+  80076d:	05 00 10 00 00       	add    $0x1000,%eax
+  800772:	f6 c2 01             	test   $0x1,%dl
+  800775:	74 13                	je     80078a <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  800777:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80077c:	75 e1                	jne    80075f <fd_alloc+0x11>
+  80077e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800783:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  800788:	eb 05                	jmp    80078f <fd_alloc+0x41>
+			return 0;
+  80078a:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  80078f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800792:	89 0a                	mov    %ecx,(%edx)
+}
+  800794:	5d                   	pop    %ebp
+  800795:	c3                   	ret
+  800796:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  80079b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a0:	eb ed                	jmp    80078f <fd_alloc+0x41>
+
+008007a2 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8007a2:	55                   	push   %ebp
+  8007a3:	89 e5                	mov    %esp,%ebp
+  8007a5:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8007a8:	83 f8 1f             	cmp    $0x1f,%eax
+  8007ab:	77 30                	ja     8007dd <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8007ad:	c1 e0 0c             	shl    $0xc,%eax
+  8007b0:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8007b5:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8007bb:	f6 c2 01             	test   $0x1,%dl
+  8007be:	74 24                	je     8007e4 <fd_lookup+0x42>
+  8007c0:	89 c2                	mov    %eax,%edx
+  8007c2:	c1 ea 0c             	shr    $0xc,%edx
+  8007c5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8007cc:	f6 c2 01             	test   $0x1,%dl
+  8007cf:	74 1a                	je     8007eb <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8007d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007d4:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8007d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007db:	5d                   	pop    %ebp
+  8007dc:	c3                   	ret
+		return -E_INVAL;
+  8007dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007e2:	eb f7                	jmp    8007db <fd_lookup+0x39>
+		return -E_INVAL;
+  8007e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007e9:	eb f0                	jmp    8007db <fd_lookup+0x39>
+  8007eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007f0:	eb e9                	jmp    8007db <fd_lookup+0x39>
+
+008007f2 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8007f2:	55                   	push   %ebp
+  8007f3:	89 e5                	mov    %esp,%ebp
+  8007f5:	53                   	push   %ebx
+  8007f6:	83 ec 04             	sub    $0x4,%esp
+  8007f9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8007fc:	b8 54 27 80 00       	mov    $0x802754,%eax
+  800801:	8b 18                	mov    (%eax),%ebx
+  800803:	85 db                	test   %ebx,%ebx
+  800805:	74 0e                	je     800815 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  800807:	83 c0 04             	add    $0x4,%eax
+  80080a:	39 13                	cmp    %edx,(%ebx)
+  80080c:	75 f3                	jne    800801 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  80080e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800813:	eb 1f                	jmp    800834 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800815:	a1 08 40 80 00       	mov    0x804008,%eax
+  80081a:	8b 40 48             	mov    0x48(%eax),%eax
+  80081d:	83 ec 04             	sub    $0x4,%esp
+  800820:	52                   	push   %edx
+  800821:	50                   	push   %eax
+  800822:	68 d8 26 80 00       	push   $0x8026d8
+  800827:	e8 b6 0f 00 00       	call   8017e2 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80082c:	83 c4 10             	add    $0x10,%esp
+  80082f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800834:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800837:	89 1a                	mov    %ebx,(%edx)
+}
+  800839:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083c:	c9                   	leave
+  80083d:	c3                   	ret
+
+0080083e <fd_close>:
+{
+  80083e:	55                   	push   %ebp
+  80083f:	89 e5                	mov    %esp,%ebp
+  800841:	57                   	push   %edi
+  800842:	56                   	push   %esi
+  800843:	53                   	push   %ebx
+  800844:	83 ec 24             	sub    $0x24,%esp
+  800847:	8b 75 08             	mov    0x8(%ebp),%esi
+  80084a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80084d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800850:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800851:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800857:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80085a:	50                   	push   %eax
+  80085b:	e8 42 ff ff ff       	call   8007a2 <fd_lookup>
+  800860:	89 c3                	mov    %eax,%ebx
+  800862:	83 c4 10             	add    $0x10,%esp
+  800865:	85 c0                	test   %eax,%eax
+  800867:	78 05                	js     80086e <fd_close+0x30>
+	    || fd != fd2)
+  800869:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80086c:	74 16                	je     800884 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80086e:	89 f8                	mov    %edi,%eax
+  800870:	84 c0                	test   %al,%al
+  800872:	b8 00 00 00 00       	mov    $0x0,%eax
+  800877:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80087a:	89 d8                	mov    %ebx,%eax
+  80087c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80087f:	5b                   	pop    %ebx
+  800880:	5e                   	pop    %esi
+  800881:	5f                   	pop    %edi
+  800882:	5d                   	pop    %ebp
+  800883:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800884:	83 ec 08             	sub    $0x8,%esp
+  800887:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80088a:	50                   	push   %eax
+  80088b:	ff 36                	push   (%esi)
+  80088d:	e8 60 ff ff ff       	call   8007f2 <dev_lookup>
+  800892:	89 c3                	mov    %eax,%ebx
+  800894:	83 c4 10             	add    $0x10,%esp
+  800897:	85 c0                	test   %eax,%eax
+  800899:	78 1a                	js     8008b5 <fd_close+0x77>
+		if (dev->dev_close)
+  80089b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80089e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8008a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8008a6:	85 c0                	test   %eax,%eax
+  8008a8:	74 0b                	je     8008b5 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8008aa:	83 ec 0c             	sub    $0xc,%esp
+  8008ad:	56                   	push   %esi
+  8008ae:	ff d0                	call   *%eax
+  8008b0:	89 c3                	mov    %eax,%ebx
+  8008b2:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8008b5:	83 ec 08             	sub    $0x8,%esp
+  8008b8:	56                   	push   %esi
+  8008b9:	6a 00                	push   $0x0
+  8008bb:	e8 51 f9 ff ff       	call   800211 <sys_page_unmap>
+	return r;
+  8008c0:	83 c4 10             	add    $0x10,%esp
+  8008c3:	eb b5                	jmp    80087a <fd_close+0x3c>
+
+008008c5 <close>:
+
+int
+close(int fdnum)
+{
+  8008c5:	55                   	push   %ebp
+  8008c6:	89 e5                	mov    %esp,%ebp
+  8008c8:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8008cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008ce:	50                   	push   %eax
+  8008cf:	ff 75 08             	push   0x8(%ebp)
+  8008d2:	e8 cb fe ff ff       	call   8007a2 <fd_lookup>
+  8008d7:	83 c4 10             	add    $0x10,%esp
+  8008da:	85 c0                	test   %eax,%eax
+  8008dc:	79 02                	jns    8008e0 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8008de:	c9                   	leave
+  8008df:	c3                   	ret
+		return fd_close(fd, 1);
+  8008e0:	83 ec 08             	sub    $0x8,%esp
+  8008e3:	6a 01                	push   $0x1
+  8008e5:	ff 75 f4             	push   -0xc(%ebp)
+  8008e8:	e8 51 ff ff ff       	call   80083e <fd_close>
+  8008ed:	83 c4 10             	add    $0x10,%esp
+  8008f0:	eb ec                	jmp    8008de <close+0x19>
+
+008008f2 <close_all>:
+
+void
+close_all(void)
+{
+  8008f2:	55                   	push   %ebp
+  8008f3:	89 e5                	mov    %esp,%ebp
+  8008f5:	53                   	push   %ebx
+  8008f6:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8008f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8008fe:	83 ec 0c             	sub    $0xc,%esp
+  800901:	53                   	push   %ebx
+  800902:	e8 be ff ff ff       	call   8008c5 <close>
+	for (i = 0; i < MAXFD; i++)
+  800907:	83 c3 01             	add    $0x1,%ebx
+  80090a:	83 c4 10             	add    $0x10,%esp
+  80090d:	83 fb 20             	cmp    $0x20,%ebx
+  800910:	75 ec                	jne    8008fe <close_all+0xc>
+}
+  800912:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800915:	c9                   	leave
+  800916:	c3                   	ret
+
+00800917 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800917:	55                   	push   %ebp
+  800918:	89 e5                	mov    %esp,%ebp
+  80091a:	57                   	push   %edi
+  80091b:	56                   	push   %esi
+  80091c:	53                   	push   %ebx
+  80091d:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800920:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800923:	50                   	push   %eax
+  800924:	ff 75 08             	push   0x8(%ebp)
+  800927:	e8 76 fe ff ff       	call   8007a2 <fd_lookup>
+  80092c:	89 c3                	mov    %eax,%ebx
+  80092e:	83 c4 10             	add    $0x10,%esp
+  800931:	85 c0                	test   %eax,%eax
+  800933:	78 7f                	js     8009b4 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800935:	83 ec 0c             	sub    $0xc,%esp
+  800938:	ff 75 0c             	push   0xc(%ebp)
+  80093b:	e8 85 ff ff ff       	call   8008c5 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800940:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800943:	c1 e6 0c             	shl    $0xc,%esi
+  800946:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80094c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80094f:	89 3c 24             	mov    %edi,(%esp)
+  800952:	e8 e0 fd ff ff       	call   800737 <fd2data>
+  800957:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800959:	89 34 24             	mov    %esi,(%esp)
+  80095c:	e8 d6 fd ff ff       	call   800737 <fd2data>
+  800961:	83 c4 10             	add    $0x10,%esp
+  800964:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800967:	89 d8                	mov    %ebx,%eax
+  800969:	c1 e8 16             	shr    $0x16,%eax
+  80096c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800973:	a8 01                	test   $0x1,%al
+  800975:	74 11                	je     800988 <dup+0x71>
+  800977:	89 d8                	mov    %ebx,%eax
+  800979:	c1 e8 0c             	shr    $0xc,%eax
+  80097c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800983:	f6 c2 01             	test   $0x1,%dl
+  800986:	75 36                	jne    8009be <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800988:	89 f8                	mov    %edi,%eax
+  80098a:	c1 e8 0c             	shr    $0xc,%eax
+  80098d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800994:	83 ec 0c             	sub    $0xc,%esp
+  800997:	25 07 0e 00 00       	and    $0xe07,%eax
+  80099c:	50                   	push   %eax
+  80099d:	56                   	push   %esi
+  80099e:	6a 00                	push   $0x0
+  8009a0:	57                   	push   %edi
+  8009a1:	6a 00                	push   $0x0
+  8009a3:	e8 27 f8 ff ff       	call   8001cf <sys_page_map>
+  8009a8:	89 c3                	mov    %eax,%ebx
+  8009aa:	83 c4 20             	add    $0x20,%esp
+  8009ad:	85 c0                	test   %eax,%eax
+  8009af:	78 33                	js     8009e4 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8009b1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8009b4:	89 d8                	mov    %ebx,%eax
+  8009b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009b9:	5b                   	pop    %ebx
+  8009ba:	5e                   	pop    %esi
+  8009bb:	5f                   	pop    %edi
+  8009bc:	5d                   	pop    %ebp
+  8009bd:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8009be:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8009c5:	83 ec 0c             	sub    $0xc,%esp
+  8009c8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8009cd:	50                   	push   %eax
+  8009ce:	ff 75 d4             	push   -0x2c(%ebp)
+  8009d1:	6a 00                	push   $0x0
+  8009d3:	53                   	push   %ebx
+  8009d4:	6a 00                	push   $0x0
+  8009d6:	e8 f4 f7 ff ff       	call   8001cf <sys_page_map>
+  8009db:	89 c3                	mov    %eax,%ebx
+  8009dd:	83 c4 20             	add    $0x20,%esp
+  8009e0:	85 c0                	test   %eax,%eax
+  8009e2:	79 a4                	jns    800988 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8009e4:	83 ec 08             	sub    $0x8,%esp
+  8009e7:	56                   	push   %esi
+  8009e8:	6a 00                	push   $0x0
+  8009ea:	e8 22 f8 ff ff       	call   800211 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8009ef:	83 c4 08             	add    $0x8,%esp
+  8009f2:	ff 75 d4             	push   -0x2c(%ebp)
+  8009f5:	6a 00                	push   $0x0
+  8009f7:	e8 15 f8 ff ff       	call   800211 <sys_page_unmap>
+	return r;
+  8009fc:	83 c4 10             	add    $0x10,%esp
+  8009ff:	eb b3                	jmp    8009b4 <dup+0x9d>
+
+00800a01 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800a01:	55                   	push   %ebp
+  800a02:	89 e5                	mov    %esp,%ebp
+  800a04:	56                   	push   %esi
+  800a05:	53                   	push   %ebx
+  800a06:	83 ec 18             	sub    $0x18,%esp
+  800a09:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a0c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a0f:	50                   	push   %eax
+  800a10:	56                   	push   %esi
+  800a11:	e8 8c fd ff ff       	call   8007a2 <fd_lookup>
+  800a16:	83 c4 10             	add    $0x10,%esp
+  800a19:	85 c0                	test   %eax,%eax
+  800a1b:	78 3c                	js     800a59 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a1d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a20:	83 ec 08             	sub    $0x8,%esp
+  800a23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a26:	50                   	push   %eax
+  800a27:	ff 33                	push   (%ebx)
+  800a29:	e8 c4 fd ff ff       	call   8007f2 <dev_lookup>
+  800a2e:	83 c4 10             	add    $0x10,%esp
+  800a31:	85 c0                	test   %eax,%eax
+  800a33:	78 24                	js     800a59 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a35:	8b 43 08             	mov    0x8(%ebx),%eax
+  800a38:	83 e0 03             	and    $0x3,%eax
+  800a3b:	83 f8 01             	cmp    $0x1,%eax
+  800a3e:	74 20                	je     800a60 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800a40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a43:	8b 40 08             	mov    0x8(%eax),%eax
+  800a46:	85 c0                	test   %eax,%eax
+  800a48:	74 37                	je     800a81 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800a4a:	83 ec 04             	sub    $0x4,%esp
+  800a4d:	ff 75 10             	push   0x10(%ebp)
+  800a50:	ff 75 0c             	push   0xc(%ebp)
+  800a53:	53                   	push   %ebx
+  800a54:	ff d0                	call   *%eax
+  800a56:	83 c4 10             	add    $0x10,%esp
+}
+  800a59:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a5c:	5b                   	pop    %ebx
+  800a5d:	5e                   	pop    %esi
+  800a5e:	5d                   	pop    %ebp
+  800a5f:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a60:	a1 08 40 80 00       	mov    0x804008,%eax
+  800a65:	8b 40 48             	mov    0x48(%eax),%eax
+  800a68:	83 ec 04             	sub    $0x4,%esp
+  800a6b:	56                   	push   %esi
+  800a6c:	50                   	push   %eax
+  800a6d:	68 19 27 80 00       	push   $0x802719
+  800a72:	e8 6b 0d 00 00       	call   8017e2 <cprintf>
+		return -E_INVAL;
+  800a77:	83 c4 10             	add    $0x10,%esp
+  800a7a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a7f:	eb d8                	jmp    800a59 <read+0x58>
+		return -E_NOT_SUPP;
+  800a81:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a86:	eb d1                	jmp    800a59 <read+0x58>
+
+00800a88 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a88:	55                   	push   %ebp
+  800a89:	89 e5                	mov    %esp,%ebp
+  800a8b:	57                   	push   %edi
+  800a8c:	56                   	push   %esi
+  800a8d:	53                   	push   %ebx
+  800a8e:	83 ec 0c             	sub    $0xc,%esp
+  800a91:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a94:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800a97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a9c:	eb 02                	jmp    800aa0 <readn+0x18>
+  800a9e:	01 c3                	add    %eax,%ebx
+  800aa0:	39 f3                	cmp    %esi,%ebx
+  800aa2:	73 21                	jae    800ac5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800aa4:	83 ec 04             	sub    $0x4,%esp
+  800aa7:	89 f0                	mov    %esi,%eax
+  800aa9:	29 d8                	sub    %ebx,%eax
+  800aab:	50                   	push   %eax
+  800aac:	89 d8                	mov    %ebx,%eax
+  800aae:	03 45 0c             	add    0xc(%ebp),%eax
+  800ab1:	50                   	push   %eax
+  800ab2:	57                   	push   %edi
+  800ab3:	e8 49 ff ff ff       	call   800a01 <read>
+		if (m < 0)
+  800ab8:	83 c4 10             	add    $0x10,%esp
+  800abb:	85 c0                	test   %eax,%eax
+  800abd:	78 04                	js     800ac3 <readn+0x3b>
+			return m;
+		if (m == 0)
+  800abf:	75 dd                	jne    800a9e <readn+0x16>
+  800ac1:	eb 02                	jmp    800ac5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800ac3:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800ac5:	89 d8                	mov    %ebx,%eax
+  800ac7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800aca:	5b                   	pop    %ebx
+  800acb:	5e                   	pop    %esi
+  800acc:	5f                   	pop    %edi
+  800acd:	5d                   	pop    %ebp
+  800ace:	c3                   	ret
+
+00800acf <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800acf:	55                   	push   %ebp
+  800ad0:	89 e5                	mov    %esp,%ebp
+  800ad2:	56                   	push   %esi
+  800ad3:	53                   	push   %ebx
+  800ad4:	83 ec 18             	sub    $0x18,%esp
+  800ad7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800ada:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800add:	50                   	push   %eax
+  800ade:	53                   	push   %ebx
+  800adf:	e8 be fc ff ff       	call   8007a2 <fd_lookup>
+  800ae4:	83 c4 10             	add    $0x10,%esp
+  800ae7:	85 c0                	test   %eax,%eax
+  800ae9:	78 37                	js     800b22 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800aeb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800aee:	83 ec 08             	sub    $0x8,%esp
+  800af1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800af4:	50                   	push   %eax
+  800af5:	ff 36                	push   (%esi)
+  800af7:	e8 f6 fc ff ff       	call   8007f2 <dev_lookup>
+  800afc:	83 c4 10             	add    $0x10,%esp
+  800aff:	85 c0                	test   %eax,%eax
+  800b01:	78 1f                	js     800b22 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b03:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b07:	74 20                	je     800b29 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800b09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b0c:	8b 40 0c             	mov    0xc(%eax),%eax
+  800b0f:	85 c0                	test   %eax,%eax
+  800b11:	74 37                	je     800b4a <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800b13:	83 ec 04             	sub    $0x4,%esp
+  800b16:	ff 75 10             	push   0x10(%ebp)
+  800b19:	ff 75 0c             	push   0xc(%ebp)
+  800b1c:	56                   	push   %esi
+  800b1d:	ff d0                	call   *%eax
+  800b1f:	83 c4 10             	add    $0x10,%esp
+}
+  800b22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b25:	5b                   	pop    %ebx
+  800b26:	5e                   	pop    %esi
+  800b27:	5d                   	pop    %ebp
+  800b28:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b29:	a1 08 40 80 00       	mov    0x804008,%eax
+  800b2e:	8b 40 48             	mov    0x48(%eax),%eax
+  800b31:	83 ec 04             	sub    $0x4,%esp
+  800b34:	53                   	push   %ebx
+  800b35:	50                   	push   %eax
+  800b36:	68 35 27 80 00       	push   $0x802735
+  800b3b:	e8 a2 0c 00 00       	call   8017e2 <cprintf>
+		return -E_INVAL;
+  800b40:	83 c4 10             	add    $0x10,%esp
+  800b43:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b48:	eb d8                	jmp    800b22 <write+0x53>
+		return -E_NOT_SUPP;
+  800b4a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b4f:	eb d1                	jmp    800b22 <write+0x53>
+
+00800b51 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b51:	55                   	push   %ebp
+  800b52:	89 e5                	mov    %esp,%ebp
+  800b54:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b57:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b5a:	50                   	push   %eax
+  800b5b:	ff 75 08             	push   0x8(%ebp)
+  800b5e:	e8 3f fc ff ff       	call   8007a2 <fd_lookup>
+  800b63:	83 c4 10             	add    $0x10,%esp
+  800b66:	85 c0                	test   %eax,%eax
+  800b68:	78 0e                	js     800b78 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800b6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b70:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800b73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b78:	c9                   	leave
+  800b79:	c3                   	ret
+
+00800b7a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b7a:	55                   	push   %ebp
+  800b7b:	89 e5                	mov    %esp,%ebp
+  800b7d:	56                   	push   %esi
+  800b7e:	53                   	push   %ebx
+  800b7f:	83 ec 18             	sub    $0x18,%esp
+  800b82:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b85:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b88:	50                   	push   %eax
+  800b89:	53                   	push   %ebx
+  800b8a:	e8 13 fc ff ff       	call   8007a2 <fd_lookup>
+  800b8f:	83 c4 10             	add    $0x10,%esp
+  800b92:	85 c0                	test   %eax,%eax
+  800b94:	78 34                	js     800bca <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b96:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b99:	83 ec 08             	sub    $0x8,%esp
+  800b9c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b9f:	50                   	push   %eax
+  800ba0:	ff 36                	push   (%esi)
+  800ba2:	e8 4b fc ff ff       	call   8007f2 <dev_lookup>
+  800ba7:	83 c4 10             	add    $0x10,%esp
+  800baa:	85 c0                	test   %eax,%eax
+  800bac:	78 1c                	js     800bca <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bae:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800bb2:	74 1d                	je     800bd1 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800bb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bb7:	8b 40 18             	mov    0x18(%eax),%eax
+  800bba:	85 c0                	test   %eax,%eax
+  800bbc:	74 34                	je     800bf2 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800bbe:	83 ec 08             	sub    $0x8,%esp
+  800bc1:	ff 75 0c             	push   0xc(%ebp)
+  800bc4:	56                   	push   %esi
+  800bc5:	ff d0                	call   *%eax
+  800bc7:	83 c4 10             	add    $0x10,%esp
+}
+  800bca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bcd:	5b                   	pop    %ebx
+  800bce:	5e                   	pop    %esi
+  800bcf:	5d                   	pop    %ebp
+  800bd0:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800bd1:	a1 08 40 80 00       	mov    0x804008,%eax
+  800bd6:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800bd9:	83 ec 04             	sub    $0x4,%esp
+  800bdc:	53                   	push   %ebx
+  800bdd:	50                   	push   %eax
+  800bde:	68 f8 26 80 00       	push   $0x8026f8
+  800be3:	e8 fa 0b 00 00       	call   8017e2 <cprintf>
+		return -E_INVAL;
+  800be8:	83 c4 10             	add    $0x10,%esp
+  800beb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bf0:	eb d8                	jmp    800bca <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800bf2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bf7:	eb d1                	jmp    800bca <ftruncate+0x50>
+
+00800bf9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800bf9:	55                   	push   %ebp
+  800bfa:	89 e5                	mov    %esp,%ebp
+  800bfc:	56                   	push   %esi
+  800bfd:	53                   	push   %ebx
+  800bfe:	83 ec 18             	sub    $0x18,%esp
+  800c01:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c04:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c07:	50                   	push   %eax
+  800c08:	ff 75 08             	push   0x8(%ebp)
+  800c0b:	e8 92 fb ff ff       	call   8007a2 <fd_lookup>
+  800c10:	83 c4 10             	add    $0x10,%esp
+  800c13:	85 c0                	test   %eax,%eax
+  800c15:	78 49                	js     800c60 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c17:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800c1a:	83 ec 08             	sub    $0x8,%esp
+  800c1d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c20:	50                   	push   %eax
+  800c21:	ff 36                	push   (%esi)
+  800c23:	e8 ca fb ff ff       	call   8007f2 <dev_lookup>
+  800c28:	83 c4 10             	add    $0x10,%esp
+  800c2b:	85 c0                	test   %eax,%eax
+  800c2d:	78 31                	js     800c60 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800c2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c32:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800c36:	74 2f                	je     800c67 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800c38:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800c3b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800c42:	00 00 00 
+	stat->st_isdir = 0;
+  800c45:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c4c:	00 00 00 
+	stat->st_dev = dev;
+  800c4f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c55:	83 ec 08             	sub    $0x8,%esp
+  800c58:	53                   	push   %ebx
+  800c59:	56                   	push   %esi
+  800c5a:	ff 50 14             	call   *0x14(%eax)
+  800c5d:	83 c4 10             	add    $0x10,%esp
+}
+  800c60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c63:	5b                   	pop    %ebx
+  800c64:	5e                   	pop    %esi
+  800c65:	5d                   	pop    %ebp
+  800c66:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c67:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c6c:	eb f2                	jmp    800c60 <fstat+0x67>
+
+00800c6e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c6e:	55                   	push   %ebp
+  800c6f:	89 e5                	mov    %esp,%ebp
+  800c71:	56                   	push   %esi
+  800c72:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c73:	83 ec 08             	sub    $0x8,%esp
+  800c76:	6a 00                	push   $0x0
+  800c78:	ff 75 08             	push   0x8(%ebp)
+  800c7b:	e8 bc 02 00 00       	call   800f3c <open>
+  800c80:	89 c3                	mov    %eax,%ebx
+  800c82:	83 c4 10             	add    $0x10,%esp
+  800c85:	85 c0                	test   %eax,%eax
+  800c87:	78 1b                	js     800ca4 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c89:	83 ec 08             	sub    $0x8,%esp
+  800c8c:	ff 75 0c             	push   0xc(%ebp)
+  800c8f:	50                   	push   %eax
+  800c90:	e8 64 ff ff ff       	call   800bf9 <fstat>
+  800c95:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c97:	89 1c 24             	mov    %ebx,(%esp)
+  800c9a:	e8 26 fc ff ff       	call   8008c5 <close>
+	return r;
+  800c9f:	83 c4 10             	add    $0x10,%esp
+  800ca2:	89 f3                	mov    %esi,%ebx
+}
+  800ca4:	89 d8                	mov    %ebx,%eax
+  800ca6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ca9:	5b                   	pop    %ebx
+  800caa:	5e                   	pop    %esi
+  800cab:	5d                   	pop    %ebp
+  800cac:	c3                   	ret
+
+00800cad <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  800cad:	55                   	push   %ebp
+  800cae:	89 e5                	mov    %esp,%ebp
+  800cb0:	57                   	push   %edi
+  800cb1:	56                   	push   %esi
+  800cb2:	53                   	push   %ebx
+  800cb3:	83 ec 0c             	sub    $0xc,%esp
+  800cb6:	89 c7                	mov    %eax,%edi
+  800cb8:	89 d3                	mov    %edx,%ebx
+  800cba:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  800cbc:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800cc3:	74 2d                	je     800cf2 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cc5:	6a 07                	push   $0x7
+  800cc7:	68 00 50 80 00       	push   $0x805000
+  800ccc:	57                   	push   %edi
+  800ccd:	ff 35 00 40 80 00    	push   0x804000
+  800cd3:	e8 3f 16 00 00       	call   802317 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  800cd8:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800cdf:	6a 00                	push   $0x0
+  800ce1:	56                   	push   %esi
+  800ce2:	53                   	push   %ebx
+  800ce3:	6a 00                	push   $0x0
+  800ce5:	e8 df 14 00 00       	call   8021c9 <ipc_recv_pages>
+}
+  800cea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ced:	5b                   	pop    %ebx
+  800cee:	5e                   	pop    %esi
+  800cef:	5f                   	pop    %edi
+  800cf0:	5d                   	pop    %ebp
+  800cf1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800cf2:	83 ec 0c             	sub    $0xc,%esp
+  800cf5:	6a 01                	push   $0x1
+  800cf7:	e8 10 17 00 00       	call   80240c <ipc_find_env>
+  800cfc:	a3 00 40 80 00       	mov    %eax,0x804000
+  800d01:	83 c4 10             	add    $0x10,%esp
+  800d04:	eb bf                	jmp    800cc5 <fsipc_pages+0x18>
+
+00800d06 <fsipc>:
+{
+  800d06:	55                   	push   %ebp
+  800d07:	89 e5                	mov    %esp,%ebp
+  800d09:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  800d0c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d11:	e8 97 ff ff ff       	call   800cad <fsipc_pages>
+}
+  800d16:	c9                   	leave
+  800d17:	c3                   	ret
+
+00800d18 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d18:	55                   	push   %ebp
+  800d19:	89 e5                	mov    %esp,%ebp
+  800d1b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d21:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d24:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  800d29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d2c:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800d31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d36:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d3b:	e8 c6 ff ff ff       	call   800d06 <fsipc>
+}
+  800d40:	c9                   	leave
+  800d41:	c3                   	ret
+
+00800d42 <devfile_flush>:
+{
+  800d42:	55                   	push   %ebp
+  800d43:	89 e5                	mov    %esp,%ebp
+  800d45:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d48:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d4b:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d4e:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800d53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d58:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d5d:	e8 a4 ff ff ff       	call   800d06 <fsipc>
+}
+  800d62:	c9                   	leave
+  800d63:	c3                   	ret
+
+00800d64 <devfile_stat>:
+{
+  800d64:	55                   	push   %ebp
+  800d65:	89 e5                	mov    %esp,%ebp
+  800d67:	53                   	push   %ebx
+  800d68:	83 ec 04             	sub    $0x4,%esp
+  800d6b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d71:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d74:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800d79:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d83:	e8 7e ff ff ff       	call   800d06 <fsipc>
+  800d88:	85 c0                	test   %eax,%eax
+  800d8a:	78 2c                	js     800db8 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800d8c:	83 ec 08             	sub    $0x8,%esp
+  800d8f:	68 00 50 80 00       	push   $0x805000
+  800d94:	53                   	push   %ebx
+  800d95:	e8 2f 10 00 00       	call   801dc9 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800d9a:	a1 80 50 80 00       	mov    0x805080,%eax
+  800d9f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800da5:	a1 84 50 80 00       	mov    0x805084,%eax
+  800daa:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  800db0:	83 c4 10             	add    $0x10,%esp
+  800db3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800db8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dbb:	c9                   	leave
+  800dbc:	c3                   	ret
+
+00800dbd <devfile_write>:
+{
+  800dbd:	55                   	push   %ebp
+  800dbe:	89 e5                	mov    %esp,%ebp
+  800dc0:	83 ec 0c             	sub    $0xc,%esp
+  800dc3:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800dc6:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800dcb:	39 d0                	cmp    %edx,%eax
+  800dcd:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800dd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd3:	8b 52 0c             	mov    0xc(%edx),%edx
+  800dd6:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  800ddc:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800de1:	50                   	push   %eax
+  800de2:	ff 75 0c             	push   0xc(%ebp)
+  800de5:	68 08 50 80 00       	push   $0x805008
+  800dea:	e8 60 11 00 00       	call   801f4f <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800def:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800df9:	e8 08 ff ff ff       	call   800d06 <fsipc>
+}
+  800dfe:	c9                   	leave
+  800dff:	c3                   	ret
+
+00800e00 <devfile_read>:
+{
+  800e00:	55                   	push   %ebp
+  800e01:	89 e5                	mov    %esp,%ebp
+  800e03:	57                   	push   %edi
+  800e04:	56                   	push   %esi
+  800e05:	53                   	push   %ebx
+  800e06:	83 ec 1c             	sub    $0x1c,%esp
+  800e09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e0c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e0f:	89 fe                	mov    %edi,%esi
+  800e11:	c1 ee 0c             	shr    $0xc,%esi
+  800e14:	b8 20 00 00 00       	mov    $0x20,%eax
+  800e19:	39 c6                	cmp    %eax,%esi
+  800e1b:	0f 47 f0             	cmova  %eax,%esi
+  800e1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e21:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e26:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  800e29:	eb 14                	jmp    800e3f <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e2b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  800e32:	05 00 10 00 00       	add    $0x1000,%eax
+  800e37:	f6 c6 06             	test   $0x6,%dh
+  800e3a:	75 42                	jne    800e7e <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  800e3c:	83 c1 01             	add    $0x1,%ecx
+  800e3f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800e42:	39 f1                	cmp    %esi,%ecx
+  800e44:	0f 84 95 00 00 00    	je     800edf <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e4a:	89 c2                	mov    %eax,%edx
+  800e4c:	c1 ea 16             	shr    $0x16,%edx
+  800e4f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  800e56:	f6 c2 01             	test   $0x1,%dl
+  800e59:	74 23                	je     800e7e <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  800e5b:	89 c2                	mov    %eax,%edx
+  800e5d:	c1 ea 0c             	shr    $0xc,%edx
+  800e60:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800e67:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  800e6d:	74 0f                	je     800e7e <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  800e6f:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  800e76:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  800e7c:	75 ad                	jne    800e2b <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  800e7e:	85 c9                	test   %ecx,%ecx
+  800e80:	74 11                	je     800e93 <devfile_read+0x93>
+  800e82:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  800e89:	75 08                	jne    800e93 <devfile_read+0x93>
+  800e8b:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  800e91:	74 50                	je     800ee3 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800e93:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800e96:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  800e9b:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800ea1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800eab:	e8 56 fe ff ff       	call   800d06 <fsipc>
+  800eb0:	89 c6                	mov    %eax,%esi
+  800eb2:	85 c0                	test   %eax,%eax
+  800eb4:	78 1f                	js     800ed5 <devfile_read+0xd5>
+	assert(r <= n);
+  800eb6:	39 c7                	cmp    %eax,%edi
+  800eb8:	72 50                	jb     800f0a <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  800eba:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800ebf:	7f 62                	jg     800f23 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  800ec1:	83 ec 04             	sub    $0x4,%esp
+  800ec4:	50                   	push   %eax
+  800ec5:	68 00 50 80 00       	push   $0x805000
+  800eca:	ff 75 0c             	push   0xc(%ebp)
+  800ecd:	e8 7d 10 00 00       	call   801f4f <memmove>
+	return r;
+  800ed2:	83 c4 10             	add    $0x10,%esp
+}
+  800ed5:	89 f0                	mov    %esi,%eax
+  800ed7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eda:	5b                   	pop    %ebx
+  800edb:	5e                   	pop    %esi
+  800edc:	5f                   	pop    %edi
+  800edd:	5d                   	pop    %ebp
+  800ede:	c3                   	ret
+  800edf:	89 f1                	mov    %esi,%ecx
+  800ee1:	eb 9b                	jmp    800e7e <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  800ee3:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800ee6:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  800eeb:	89 c8                	mov    %ecx,%eax
+  800eed:	c1 e0 0c             	shl    $0xc,%eax
+  800ef0:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  800ef5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ef8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800efd:	e8 ab fd ff ff       	call   800cad <fsipc_pages>
+  800f02:	89 c6                	mov    %eax,%esi
+  800f04:	85 c0                	test   %eax,%eax
+  800f06:	78 8b                	js     800e93 <devfile_read+0x93>
+  800f08:	eb cb                	jmp    800ed5 <devfile_read+0xd5>
+	assert(r <= n);
+  800f0a:	68 64 27 80 00       	push   $0x802764
+  800f0f:	68 6b 27 80 00       	push   $0x80276b
+  800f14:	68 a0 00 00 00       	push   $0xa0
+  800f19:	68 80 27 80 00       	push   $0x802780
+  800f1e:	e8 e4 07 00 00       	call   801707 <_panic>
+	assert(r <= PGSIZE);
+  800f23:	68 8b 27 80 00       	push   $0x80278b
+  800f28:	68 6b 27 80 00       	push   $0x80276b
+  800f2d:	68 a1 00 00 00       	push   $0xa1
+  800f32:	68 80 27 80 00       	push   $0x802780
+  800f37:	e8 cb 07 00 00       	call   801707 <_panic>
+
+00800f3c <open>:
+{
+  800f3c:	55                   	push   %ebp
+  800f3d:	89 e5                	mov    %esp,%ebp
+  800f3f:	56                   	push   %esi
+  800f40:	53                   	push   %ebx
+  800f41:	83 ec 1c             	sub    $0x1c,%esp
+  800f44:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  800f47:	56                   	push   %esi
+  800f48:	e8 41 0e 00 00       	call   801d8e <strlen>
+  800f4d:	83 c4 10             	add    $0x10,%esp
+  800f50:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f55:	7f 6c                	jg     800fc3 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  800f57:	83 ec 0c             	sub    $0xc,%esp
+  800f5a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f5d:	50                   	push   %eax
+  800f5e:	e8 eb f7 ff ff       	call   80074e <fd_alloc>
+  800f63:	89 c3                	mov    %eax,%ebx
+  800f65:	83 c4 10             	add    $0x10,%esp
+  800f68:	85 c0                	test   %eax,%eax
+  800f6a:	78 3c                	js     800fa8 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  800f6c:	83 ec 08             	sub    $0x8,%esp
+  800f6f:	56                   	push   %esi
+  800f70:	68 00 50 80 00       	push   $0x805000
+  800f75:	e8 4f 0e 00 00       	call   801dc9 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800f7a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f7d:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  800f82:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800f85:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8a:	e8 77 fd ff ff       	call   800d06 <fsipc>
+  800f8f:	89 c3                	mov    %eax,%ebx
+  800f91:	83 c4 10             	add    $0x10,%esp
+  800f94:	85 c0                	test   %eax,%eax
+  800f96:	78 19                	js     800fb1 <open+0x75>
+	return fd2num(fd);
+  800f98:	83 ec 0c             	sub    $0xc,%esp
+  800f9b:	ff 75 f4             	push   -0xc(%ebp)
+  800f9e:	e8 84 f7 ff ff       	call   800727 <fd2num>
+  800fa3:	89 c3                	mov    %eax,%ebx
+  800fa5:	83 c4 10             	add    $0x10,%esp
+}
+  800fa8:	89 d8                	mov    %ebx,%eax
+  800faa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fad:	5b                   	pop    %ebx
+  800fae:	5e                   	pop    %esi
+  800faf:	5d                   	pop    %ebp
+  800fb0:	c3                   	ret
+		fd_close(fd, 0);
+  800fb1:	83 ec 08             	sub    $0x8,%esp
+  800fb4:	6a 00                	push   $0x0
+  800fb6:	ff 75 f4             	push   -0xc(%ebp)
+  800fb9:	e8 80 f8 ff ff       	call   80083e <fd_close>
+		return r;
+  800fbe:	83 c4 10             	add    $0x10,%esp
+  800fc1:	eb e5                	jmp    800fa8 <open+0x6c>
+		return -E_BAD_PATH;
+  800fc3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800fc8:	eb de                	jmp    800fa8 <open+0x6c>
+
+00800fca <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800fca:	55                   	push   %ebp
+  800fcb:	89 e5                	mov    %esp,%ebp
+  800fcd:	53                   	push   %ebx
+  800fce:	83 ec 10             	sub    $0x10,%esp
+  800fd1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  800fd4:	53                   	push   %ebx
+  800fd5:	e8 b4 0d 00 00       	call   801d8e <strlen>
+  800fda:	83 c4 10             	add    $0x10,%esp
+  800fdd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800fe2:	7f 25                	jg     801009 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  800fe4:	83 ec 08             	sub    $0x8,%esp
+  800fe7:	53                   	push   %ebx
+  800fe8:	68 00 50 80 00       	push   $0x805000
+  800fed:	e8 d7 0d 00 00       	call   801dc9 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  800ff2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff7:	b8 07 00 00 00       	mov    $0x7,%eax
+  800ffc:	e8 05 fd ff ff       	call   800d06 <fsipc>
+  801001:	83 c4 10             	add    $0x10,%esp
+}
+  801004:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801007:	c9                   	leave
+  801008:	c3                   	ret
+		return -E_BAD_PATH;
+  801009:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80100e:	eb f4                	jmp    801004 <remove+0x3a>
+
+00801010 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801010:	55                   	push   %ebp
+  801011:	89 e5                	mov    %esp,%ebp
+  801013:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801016:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801020:	e8 e1 fc ff ff       	call   800d06 <fsipc>
+}
+  801025:	c9                   	leave
+  801026:	c3                   	ret
+
+00801027 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801027:	55                   	push   %ebp
+  801028:	89 e5                	mov    %esp,%ebp
+  80102a:	53                   	push   %ebx
+  80102b:	83 ec 04             	sub    $0x4,%esp
+  80102e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801031:	ba 00 00 00 00       	mov    $0x0,%edx
+  801036:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80103b:	e8 c6 fc ff ff       	call   800d06 <fsipc>
+  801040:	85 c0                	test   %eax,%eax
+  801042:	78 3c                	js     801080 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801044:	a1 00 50 80 00       	mov    0x805000,%eax
+  801049:	89 03                	mov    %eax,(%ebx)
+  80104b:	a1 04 50 80 00       	mov    0x805004,%eax
+  801050:	89 43 04             	mov    %eax,0x4(%ebx)
+  801053:	a1 08 50 80 00       	mov    0x805008,%eax
+  801058:	89 43 08             	mov    %eax,0x8(%ebx)
+  80105b:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801060:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801063:	a1 10 50 80 00       	mov    0x805010,%eax
+  801068:	89 43 10             	mov    %eax,0x10(%ebx)
+  80106b:	a1 14 50 80 00       	mov    0x805014,%eax
+  801070:	89 43 14             	mov    %eax,0x14(%ebx)
+  801073:	a1 18 50 80 00       	mov    0x805018,%eax
+  801078:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  80107b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801080:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801083:	c9                   	leave
+  801084:	c3                   	ret
+
+00801085 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801085:	55                   	push   %ebp
+  801086:	89 e5                	mov    %esp,%ebp
+  801088:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  80108b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80108e:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  801093:	ba 00 00 00 00       	mov    $0x0,%edx
+  801098:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80109d:	e8 64 fc ff ff       	call   800d06 <fsipc>
+}
+  8010a2:	c9                   	leave
+  8010a3:	c3                   	ret
+
+008010a4 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8010a4:	55                   	push   %ebp
+  8010a5:	89 e5                	mov    %esp,%ebp
+  8010a7:	56                   	push   %esi
+  8010a8:	53                   	push   %ebx
+  8010a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8010ac:	83 ec 0c             	sub    $0xc,%esp
+  8010af:	ff 75 08             	push   0x8(%ebp)
+  8010b2:	e8 80 f6 ff ff       	call   800737 <fd2data>
+  8010b7:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8010b9:	83 c4 08             	add    $0x8,%esp
+  8010bc:	68 97 27 80 00       	push   $0x802797
+  8010c1:	53                   	push   %ebx
+  8010c2:	e8 02 0d 00 00       	call   801dc9 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8010c7:	8b 46 04             	mov    0x4(%esi),%eax
+  8010ca:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8010d0:	2b 0e                	sub    (%esi),%ecx
+  8010d2:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8010d7:	89 c8                	mov    %ecx,%eax
+  8010d9:	f7 e2                	mul    %edx
+  8010db:	c1 ea 0c             	shr    $0xc,%edx
+  8010de:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8010e4:	29 d1                	sub    %edx,%ecx
+  8010e6:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8010ec:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8010f3:	00 00 00 
+	stat->st_dev = &devpipe;
+  8010f6:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  8010fd:	30 80 00 
+	return 0;
+}
+  801100:	b8 00 00 00 00       	mov    $0x0,%eax
+  801105:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801108:	5b                   	pop    %ebx
+  801109:	5e                   	pop    %esi
+  80110a:	5d                   	pop    %ebp
+  80110b:	c3                   	ret
+
+0080110c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80110c:	55                   	push   %ebp
+  80110d:	89 e5                	mov    %esp,%ebp
+  80110f:	53                   	push   %ebx
+  801110:	83 ec 0c             	sub    $0xc,%esp
+  801113:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801116:	53                   	push   %ebx
+  801117:	6a 00                	push   $0x0
+  801119:	e8 f3 f0 ff ff       	call   800211 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80111e:	89 1c 24             	mov    %ebx,(%esp)
+  801121:	e8 11 f6 ff ff       	call   800737 <fd2data>
+  801126:	83 c4 08             	add    $0x8,%esp
+  801129:	50                   	push   %eax
+  80112a:	6a 00                	push   $0x0
+  80112c:	e8 e0 f0 ff ff       	call   800211 <sys_page_unmap>
+}
+  801131:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801134:	c9                   	leave
+  801135:	c3                   	ret
+
+00801136 <_pipeisclosed>:
+{
+  801136:	55                   	push   %ebp
+  801137:	89 e5                	mov    %esp,%ebp
+  801139:	57                   	push   %edi
+  80113a:	56                   	push   %esi
+  80113b:	53                   	push   %ebx
+  80113c:	83 ec 1c             	sub    $0x1c,%esp
+  80113f:	89 c7                	mov    %eax,%edi
+  801141:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801143:	a1 08 40 80 00       	mov    0x804008,%eax
+  801148:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80114b:	83 ec 0c             	sub    $0xc,%esp
+  80114e:	57                   	push   %edi
+  80114f:	e8 f7 12 00 00       	call   80244b <pageref>
+  801154:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801157:	89 34 24             	mov    %esi,(%esp)
+  80115a:	e8 ec 12 00 00       	call   80244b <pageref>
+		nn = thisenv->env_runs;
+  80115f:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801165:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801168:	83 c4 10             	add    $0x10,%esp
+  80116b:	39 cb                	cmp    %ecx,%ebx
+  80116d:	74 1b                	je     80118a <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80116f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801172:	75 cf                	jne    801143 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801174:	8b 42 58             	mov    0x58(%edx),%eax
+  801177:	6a 01                	push   $0x1
+  801179:	50                   	push   %eax
+  80117a:	53                   	push   %ebx
+  80117b:	68 9e 27 80 00       	push   $0x80279e
+  801180:	e8 5d 06 00 00       	call   8017e2 <cprintf>
+  801185:	83 c4 10             	add    $0x10,%esp
+  801188:	eb b9                	jmp    801143 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80118a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80118d:	0f 94 c0             	sete   %al
+  801190:	0f b6 c0             	movzbl %al,%eax
+}
+  801193:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801196:	5b                   	pop    %ebx
+  801197:	5e                   	pop    %esi
+  801198:	5f                   	pop    %edi
+  801199:	5d                   	pop    %ebp
+  80119a:	c3                   	ret
+
+0080119b <devpipe_read>:
+{
+  80119b:	55                   	push   %ebp
+  80119c:	89 e5                	mov    %esp,%ebp
+  80119e:	57                   	push   %edi
+  80119f:	56                   	push   %esi
+  8011a0:	53                   	push   %ebx
+  8011a1:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8011a4:	ff 75 08             	push   0x8(%ebp)
+  8011a7:	e8 8b f5 ff ff       	call   800737 <fd2data>
+  8011ac:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8011ae:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8011b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8011b4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8011b7:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8011ba:	8b 0b                	mov    (%ebx),%ecx
+  8011bc:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8011c2:	29 ce                	sub    %ecx,%esi
+  8011c4:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8011c9:	f7 e6                	mul    %esi
+  8011cb:	c1 ea 0c             	shr    $0xc,%edx
+  8011ce:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8011d4:	29 c6                	sub    %eax,%esi
+  8011d6:	89 f2                	mov    %esi,%edx
+  8011d8:	75 43                	jne    80121d <devpipe_read+0x82>
+		ref = pageref(p);
+  8011da:	83 ec 0c             	sub    $0xc,%esp
+  8011dd:	53                   	push   %ebx
+  8011de:	e8 68 12 00 00       	call   80244b <pageref>
+  8011e3:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8011e5:	89 da                	mov    %ebx,%edx
+  8011e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011ea:	e8 47 ff ff ff       	call   801136 <_pipeisclosed>
+  8011ef:	83 c4 10             	add    $0x10,%esp
+  8011f2:	85 c0                	test   %eax,%eax
+  8011f4:	0f 85 c1 00 00 00    	jne    8012bb <devpipe_read+0x120>
+	*sleeping = 1;
+  8011fa:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801201:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801206:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801209:	75 ac                	jne    8011b7 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  80120b:	83 ec 04             	sub    $0x4,%esp
+  80120e:	56                   	push   %esi
+  80120f:	57                   	push   %edi
+  801210:	ff 75 e4             	push   -0x1c(%ebp)
+  801213:	e8 4d f4 ff ff       	call   800665 <sys_futex_wait>
+  801218:	83 c4 10             	add    $0x10,%esp
+  80121b:	eb 9a                	jmp    8011b7 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  80121d:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801220:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801224:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801226:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80122b:	f7 e1                	mul    %ecx
+  80122d:	c1 ea 0b             	shr    $0xb,%edx
+  801230:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801236:	29 c1                	sub    %eax,%ecx
+  801238:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  80123a:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80123f:	29 cf                	sub    %ecx,%edi
+  801241:	39 f7                	cmp    %esi,%edi
+  801243:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801246:	8d 43 10             	lea    0x10(%ebx),%eax
+  801249:	83 ec 04             	sub    $0x4,%esp
+  80124c:	57                   	push   %edi
+  80124d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801250:	01 c2                	add    %eax,%edx
+  801252:	52                   	push   %edx
+  801253:	ff 75 0c             	push   0xc(%ebp)
+  801256:	e8 f4 0c 00 00       	call   801f4f <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  80125b:	83 c4 0c             	add    $0xc,%esp
+  80125e:	89 f1                	mov    %esi,%ecx
+  801260:	29 f9                	sub    %edi,%ecx
+  801262:	51                   	push   %ecx
+  801263:	ff 75 e4             	push   -0x1c(%ebp)
+  801266:	89 f8                	mov    %edi,%eax
+  801268:	03 45 0c             	add    0xc(%ebp),%eax
+  80126b:	50                   	push   %eax
+  80126c:	e8 de 0c 00 00       	call   801f4f <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801271:	89 f1                	mov    %esi,%ecx
+  801273:	03 0b                	add    (%ebx),%ecx
+  801275:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80127a:	f7 e1                	mul    %ecx
+  80127c:	c1 ea 0c             	shr    $0xc,%edx
+  80127f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801285:	29 d1                	sub    %edx,%ecx
+  801287:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801289:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80128e:	83 c4 10             	add    $0x10,%esp
+  801291:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801295:	75 0a                	jne    8012a1 <devpipe_read+0x106>
+	return n;
+  801297:	89 f0                	mov    %esi,%eax
+}
+  801299:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129c:	5b                   	pop    %ebx
+  80129d:	5e                   	pop    %esi
+  80129e:	5f                   	pop    %edi
+  80129f:	5d                   	pop    %ebp
+  8012a0:	c3                   	ret
+		*sleeping = 0;
+  8012a1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8012a8:	83 ec 08             	sub    $0x8,%esp
+  8012ab:	68 00 04 00 00       	push   $0x400
+  8012b0:	53                   	push   %ebx
+  8012b1:	e8 ff f3 ff ff       	call   8006b5 <sys_futex_wake>
+  8012b6:	83 c4 10             	add    $0x10,%esp
+  8012b9:	eb dc                	jmp    801297 <devpipe_read+0xfc>
+			return 0;
+  8012bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c0:	eb d7                	jmp    801299 <devpipe_read+0xfe>
+
+008012c2 <devpipe_write>:
+{
+  8012c2:	55                   	push   %ebp
+  8012c3:	89 e5                	mov    %esp,%ebp
+  8012c5:	57                   	push   %edi
+  8012c6:	56                   	push   %esi
+  8012c7:	53                   	push   %ebx
+  8012c8:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8012cb:	ff 75 08             	push   0x8(%ebp)
+  8012ce:	e8 64 f4 ff ff       	call   800737 <fd2data>
+  8012d3:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8012d5:	83 c4 10             	add    $0x10,%esp
+  8012d8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8012df:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8012e2:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8012e5:	0f 83 23 01 00 00    	jae    80140e <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8012eb:	8b 77 04             	mov    0x4(%edi),%esi
+  8012ee:	8b 1f                	mov    (%edi),%ebx
+  8012f0:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  8012f6:	29 d9                	sub    %ebx,%ecx
+  8012f8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8012fd:	f7 e1                	mul    %ecx
+  8012ff:	c1 ea 0c             	shr    $0xc,%edx
+  801302:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801308:	29 c1                	sub    %eax,%ecx
+  80130a:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80130c:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801312:	75 40                	jne    801354 <devpipe_write+0x92>
+			ref = pageref(p);
+  801314:	83 ec 0c             	sub    $0xc,%esp
+  801317:	57                   	push   %edi
+  801318:	e8 2e 11 00 00       	call   80244b <pageref>
+  80131d:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  80131f:	89 fa                	mov    %edi,%edx
+  801321:	8b 45 08             	mov    0x8(%ebp),%eax
+  801324:	e8 0d fe ff ff       	call   801136 <_pipeisclosed>
+  801329:	83 c4 10             	add    $0x10,%esp
+  80132c:	85 c0                	test   %eax,%eax
+  80132e:	0f 85 d5 00 00 00    	jne    801409 <devpipe_write+0x147>
+	*sleeping = 1;
+  801334:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  80133b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801340:	39 1f                	cmp    %ebx,(%edi)
+  801342:	75 a7                	jne    8012eb <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801344:	83 ec 04             	sub    $0x4,%esp
+  801347:	56                   	push   %esi
+  801348:	53                   	push   %ebx
+  801349:	57                   	push   %edi
+  80134a:	e8 16 f3 ff ff       	call   800665 <sys_futex_wait>
+  80134f:	83 c4 10             	add    $0x10,%esp
+  801352:	eb 97                	jmp    8012eb <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801354:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801357:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80135a:	29 c1                	sub    %eax,%ecx
+  80135c:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801361:	89 d8                	mov    %ebx,%eax
+  801363:	29 d0                	sub    %edx,%eax
+  801365:	39 c1                	cmp    %eax,%ecx
+  801367:	0f 46 c1             	cmovbe %ecx,%eax
+  80136a:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  80136c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801371:	f7 e6                	mul    %esi
+  801373:	c1 ea 0b             	shr    $0xb,%edx
+  801376:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80137c:	29 c6                	sub    %eax,%esi
+  80137e:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801380:	29 f3                	sub    %esi,%ebx
+  801382:	39 cb                	cmp    %ecx,%ebx
+  801384:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801387:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  80138a:	8d 77 10             	lea    0x10(%edi),%esi
+  80138d:	83 ec 04             	sub    $0x4,%esp
+  801390:	53                   	push   %ebx
+  801391:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801394:	03 45 0c             	add    0xc(%ebp),%eax
+  801397:	50                   	push   %eax
+  801398:	01 f2                	add    %esi,%edx
+  80139a:	52                   	push   %edx
+  80139b:	e8 af 0b 00 00       	call   801f4f <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8013a0:	83 c4 0c             	add    $0xc,%esp
+  8013a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013a6:	29 d8                	sub    %ebx,%eax
+  8013a8:	50                   	push   %eax
+  8013a9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8013ac:	01 d3                	add    %edx,%ebx
+  8013ae:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8013b1:	53                   	push   %ebx
+  8013b2:	56                   	push   %esi
+  8013b3:	e8 97 0b 00 00       	call   801f4f <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8013b8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8013bb:	03 4f 04             	add    0x4(%edi),%ecx
+  8013be:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8013c3:	f7 e1                	mul    %ecx
+  8013c5:	c1 ea 0c             	shr    $0xc,%edx
+  8013c8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8013ce:	29 d1                	sub    %edx,%ecx
+  8013d0:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8013d3:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8013d8:	83 c4 10             	add    $0x10,%esp
+  8013db:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8013df:	75 0b                	jne    8013ec <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8013e1:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8013e4:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8013e7:	e9 f3 fe ff ff       	jmp    8012df <devpipe_write+0x1d>
+		*sleeping = 0;
+  8013ec:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8013f3:	83 ec 08             	sub    $0x8,%esp
+  8013f6:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  8013fb:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  8013fe:	50                   	push   %eax
+  8013ff:	e8 b1 f2 ff ff       	call   8006b5 <sys_futex_wake>
+  801404:	83 c4 10             	add    $0x10,%esp
+  801407:	eb d8                	jmp    8013e1 <devpipe_write+0x11f>
+				return 0;
+  801409:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80140e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801411:	5b                   	pop    %ebx
+  801412:	5e                   	pop    %esi
+  801413:	5f                   	pop    %edi
+  801414:	5d                   	pop    %ebp
+  801415:	c3                   	ret
+
+00801416 <pipe>:
+{
+  801416:	55                   	push   %ebp
+  801417:	89 e5                	mov    %esp,%ebp
+  801419:	56                   	push   %esi
+  80141a:	53                   	push   %ebx
+  80141b:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80141e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801421:	50                   	push   %eax
+  801422:	e8 27 f3 ff ff       	call   80074e <fd_alloc>
+  801427:	89 c3                	mov    %eax,%ebx
+  801429:	83 c4 10             	add    $0x10,%esp
+  80142c:	85 c0                	test   %eax,%eax
+  80142e:	0f 88 23 01 00 00    	js     801557 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801434:	83 ec 04             	sub    $0x4,%esp
+  801437:	68 07 04 00 00       	push   $0x407
+  80143c:	ff 75 f4             	push   -0xc(%ebp)
+  80143f:	6a 00                	push   $0x0
+  801441:	e8 46 ed ff ff       	call   80018c <sys_page_alloc>
+  801446:	89 c3                	mov    %eax,%ebx
+  801448:	83 c4 10             	add    $0x10,%esp
+  80144b:	85 c0                	test   %eax,%eax
+  80144d:	0f 88 04 01 00 00    	js     801557 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801453:	83 ec 0c             	sub    $0xc,%esp
+  801456:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801459:	50                   	push   %eax
+  80145a:	e8 ef f2 ff ff       	call   80074e <fd_alloc>
+  80145f:	89 c3                	mov    %eax,%ebx
+  801461:	83 c4 10             	add    $0x10,%esp
+  801464:	85 c0                	test   %eax,%eax
+  801466:	0f 88 db 00 00 00    	js     801547 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80146c:	83 ec 04             	sub    $0x4,%esp
+  80146f:	68 07 04 00 00       	push   $0x407
+  801474:	ff 75 f0             	push   -0x10(%ebp)
+  801477:	6a 00                	push   $0x0
+  801479:	e8 0e ed ff ff       	call   80018c <sys_page_alloc>
+  80147e:	89 c3                	mov    %eax,%ebx
+  801480:	83 c4 10             	add    $0x10,%esp
+  801483:	85 c0                	test   %eax,%eax
+  801485:	0f 88 bc 00 00 00    	js     801547 <pipe+0x131>
+	va = fd2data(fd0);
+  80148b:	83 ec 0c             	sub    $0xc,%esp
+  80148e:	ff 75 f4             	push   -0xc(%ebp)
+  801491:	e8 a1 f2 ff ff       	call   800737 <fd2data>
+  801496:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801498:	83 c4 0c             	add    $0xc,%esp
+  80149b:	68 07 04 00 00       	push   $0x407
+  8014a0:	50                   	push   %eax
+  8014a1:	6a 00                	push   $0x0
+  8014a3:	e8 e4 ec ff ff       	call   80018c <sys_page_alloc>
+  8014a8:	89 c3                	mov    %eax,%ebx
+  8014aa:	83 c4 10             	add    $0x10,%esp
+  8014ad:	85 c0                	test   %eax,%eax
+  8014af:	0f 88 82 00 00 00    	js     801537 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8014b5:	83 ec 0c             	sub    $0xc,%esp
+  8014b8:	ff 75 f0             	push   -0x10(%ebp)
+  8014bb:	e8 77 f2 ff ff       	call   800737 <fd2data>
+  8014c0:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8014c7:	50                   	push   %eax
+  8014c8:	6a 00                	push   $0x0
+  8014ca:	56                   	push   %esi
+  8014cb:	6a 00                	push   $0x0
+  8014cd:	e8 fd ec ff ff       	call   8001cf <sys_page_map>
+  8014d2:	89 c3                	mov    %eax,%ebx
+  8014d4:	83 c4 20             	add    $0x20,%esp
+  8014d7:	85 c0                	test   %eax,%eax
+  8014d9:	78 4e                	js     801529 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8014db:	a1 20 30 80 00       	mov    0x803020,%eax
+  8014e0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014e3:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8014e5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014e8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8014ef:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8014f2:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8014f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8014f7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8014fe:	83 ec 0c             	sub    $0xc,%esp
+  801501:	ff 75 f4             	push   -0xc(%ebp)
+  801504:	e8 1e f2 ff ff       	call   800727 <fd2num>
+  801509:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80150c:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80150e:	83 c4 04             	add    $0x4,%esp
+  801511:	ff 75 f0             	push   -0x10(%ebp)
+  801514:	e8 0e f2 ff ff       	call   800727 <fd2num>
+  801519:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80151c:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80151f:	83 c4 10             	add    $0x10,%esp
+  801522:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801527:	eb 2e                	jmp    801557 <pipe+0x141>
+	sys_page_unmap(0, va);
+  801529:	83 ec 08             	sub    $0x8,%esp
+  80152c:	56                   	push   %esi
+  80152d:	6a 00                	push   $0x0
+  80152f:	e8 dd ec ff ff       	call   800211 <sys_page_unmap>
+  801534:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  801537:	83 ec 08             	sub    $0x8,%esp
+  80153a:	ff 75 f0             	push   -0x10(%ebp)
+  80153d:	6a 00                	push   $0x0
+  80153f:	e8 cd ec ff ff       	call   800211 <sys_page_unmap>
+  801544:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  801547:	83 ec 08             	sub    $0x8,%esp
+  80154a:	ff 75 f4             	push   -0xc(%ebp)
+  80154d:	6a 00                	push   $0x0
+  80154f:	e8 bd ec ff ff       	call   800211 <sys_page_unmap>
+  801554:	83 c4 10             	add    $0x10,%esp
+}
+  801557:	89 d8                	mov    %ebx,%eax
+  801559:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80155c:	5b                   	pop    %ebx
+  80155d:	5e                   	pop    %esi
+  80155e:	5d                   	pop    %ebp
+  80155f:	c3                   	ret
+
+00801560 <pipeisclosed>:
+{
+  801560:	55                   	push   %ebp
+  801561:	89 e5                	mov    %esp,%ebp
+  801563:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801566:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801569:	50                   	push   %eax
+  80156a:	ff 75 08             	push   0x8(%ebp)
+  80156d:	e8 30 f2 ff ff       	call   8007a2 <fd_lookup>
+  801572:	83 c4 10             	add    $0x10,%esp
+  801575:	85 c0                	test   %eax,%eax
+  801577:	78 18                	js     801591 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  801579:	83 ec 0c             	sub    $0xc,%esp
+  80157c:	ff 75 f4             	push   -0xc(%ebp)
+  80157f:	e8 b3 f1 ff ff       	call   800737 <fd2data>
+  801584:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  801586:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801589:	e8 a8 fb ff ff       	call   801136 <_pipeisclosed>
+  80158e:	83 c4 10             	add    $0x10,%esp
+}
+  801591:	c9                   	leave
+  801592:	c3                   	ret
+
+00801593 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  801593:	b8 00 00 00 00       	mov    $0x0,%eax
+  801598:	c3                   	ret
+
+00801599 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801599:	55                   	push   %ebp
+  80159a:	89 e5                	mov    %esp,%ebp
+  80159c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80159f:	68 b6 27 80 00       	push   $0x8027b6
+  8015a4:	ff 75 0c             	push   0xc(%ebp)
+  8015a7:	e8 1d 08 00 00       	call   801dc9 <strcpy>
+	return 0;
+}
+  8015ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b1:	c9                   	leave
+  8015b2:	c3                   	ret
+
+008015b3 <devcons_write>:
+{
+  8015b3:	55                   	push   %ebp
+  8015b4:	89 e5                	mov    %esp,%ebp
+  8015b6:	57                   	push   %edi
+  8015b7:	56                   	push   %esi
+  8015b8:	53                   	push   %ebx
+  8015b9:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8015bf:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8015c4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8015ca:	eb 2e                	jmp    8015fa <devcons_write+0x47>
+		m = n - tot;
+  8015cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015cf:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8015d1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8015d6:	39 c3                	cmp    %eax,%ebx
+  8015d8:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8015db:	83 ec 04             	sub    $0x4,%esp
+  8015de:	53                   	push   %ebx
+  8015df:	89 f0                	mov    %esi,%eax
+  8015e1:	03 45 0c             	add    0xc(%ebp),%eax
+  8015e4:	50                   	push   %eax
+  8015e5:	57                   	push   %edi
+  8015e6:	e8 64 09 00 00       	call   801f4f <memmove>
+		sys_cputs(buf, m);
+  8015eb:	83 c4 08             	add    $0x8,%esp
+  8015ee:	53                   	push   %ebx
+  8015ef:	57                   	push   %edi
+  8015f0:	e8 ca ea ff ff       	call   8000bf <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8015f5:	01 de                	add    %ebx,%esi
+  8015f7:	83 c4 10             	add    $0x10,%esp
+  8015fa:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8015fd:	72 cd                	jb     8015cc <devcons_write+0x19>
+}
+  8015ff:	89 f0                	mov    %esi,%eax
+  801601:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801604:	5b                   	pop    %ebx
+  801605:	5e                   	pop    %esi
+  801606:	5f                   	pop    %edi
+  801607:	5d                   	pop    %ebp
+  801608:	c3                   	ret
+
+00801609 <devcons_read>:
+{
+  801609:	55                   	push   %ebp
+  80160a:	89 e5                	mov    %esp,%ebp
+  80160c:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80160f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801614:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801618:	75 07                	jne    801621 <devcons_read+0x18>
+  80161a:	eb 1f                	jmp    80163b <devcons_read+0x32>
+		sys_yield();
+  80161c:	e8 4c eb ff ff       	call   80016d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  801621:	e8 c8 ea ff ff       	call   8000ee <sys_cgetc>
+  801626:	85 c0                	test   %eax,%eax
+  801628:	74 f2                	je     80161c <devcons_read+0x13>
+	if (c < 0)
+  80162a:	78 0f                	js     80163b <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80162c:	83 f8 04             	cmp    $0x4,%eax
+  80162f:	74 0c                	je     80163d <devcons_read+0x34>
+	*(char*)vbuf = c;
+  801631:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801634:	88 02                	mov    %al,(%edx)
+	return 1;
+  801636:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80163b:	c9                   	leave
+  80163c:	c3                   	ret
+		return 0;
+  80163d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801642:	eb f7                	jmp    80163b <devcons_read+0x32>
+
+00801644 <cputchar>:
+{
+  801644:	55                   	push   %ebp
+  801645:	89 e5                	mov    %esp,%ebp
+  801647:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80164a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80164d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  801650:	6a 01                	push   $0x1
+  801652:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801655:	50                   	push   %eax
+  801656:	e8 64 ea ff ff       	call   8000bf <sys_cputs>
+}
+  80165b:	83 c4 10             	add    $0x10,%esp
+  80165e:	c9                   	leave
+  80165f:	c3                   	ret
+
+00801660 <getchar>:
+{
+  801660:	55                   	push   %ebp
+  801661:	89 e5                	mov    %esp,%ebp
+  801663:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  801666:	6a 01                	push   $0x1
+  801668:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80166b:	50                   	push   %eax
+  80166c:	6a 00                	push   $0x0
+  80166e:	e8 8e f3 ff ff       	call   800a01 <read>
+	if (r < 0)
+  801673:	83 c4 10             	add    $0x10,%esp
+  801676:	85 c0                	test   %eax,%eax
+  801678:	78 06                	js     801680 <getchar+0x20>
+	if (r < 1)
+  80167a:	74 06                	je     801682 <getchar+0x22>
+	return c;
+  80167c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801680:	c9                   	leave
+  801681:	c3                   	ret
+		return -E_EOF;
+  801682:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801687:	eb f7                	jmp    801680 <getchar+0x20>
+
+00801689 <iscons>:
+{
+  801689:	55                   	push   %ebp
+  80168a:	89 e5                	mov    %esp,%ebp
+  80168c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80168f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801692:	50                   	push   %eax
+  801693:	ff 75 08             	push   0x8(%ebp)
+  801696:	e8 07 f1 ff ff       	call   8007a2 <fd_lookup>
+  80169b:	83 c4 10             	add    $0x10,%esp
+  80169e:	85 c0                	test   %eax,%eax
+  8016a0:	78 11                	js     8016b3 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8016a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016a5:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  8016ab:	39 10                	cmp    %edx,(%eax)
+  8016ad:	0f 94 c0             	sete   %al
+  8016b0:	0f b6 c0             	movzbl %al,%eax
+}
+  8016b3:	c9                   	leave
+  8016b4:	c3                   	ret
+
+008016b5 <opencons>:
+{
+  8016b5:	55                   	push   %ebp
+  8016b6:	89 e5                	mov    %esp,%ebp
+  8016b8:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8016bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016be:	50                   	push   %eax
+  8016bf:	e8 8a f0 ff ff       	call   80074e <fd_alloc>
+  8016c4:	83 c4 10             	add    $0x10,%esp
+  8016c7:	85 c0                	test   %eax,%eax
+  8016c9:	78 3a                	js     801705 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8016cb:	83 ec 04             	sub    $0x4,%esp
+  8016ce:	68 07 04 00 00       	push   $0x407
+  8016d3:	ff 75 f4             	push   -0xc(%ebp)
+  8016d6:	6a 00                	push   $0x0
+  8016d8:	e8 af ea ff ff       	call   80018c <sys_page_alloc>
+  8016dd:	83 c4 10             	add    $0x10,%esp
+  8016e0:	85 c0                	test   %eax,%eax
+  8016e2:	78 21                	js     801705 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8016e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e7:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  8016ed:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8016ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8016f9:	83 ec 0c             	sub    $0xc,%esp
+  8016fc:	50                   	push   %eax
+  8016fd:	e8 25 f0 ff ff       	call   800727 <fd2num>
+  801702:	83 c4 10             	add    $0x10,%esp
+}
+  801705:	c9                   	leave
+  801706:	c3                   	ret
+
+00801707 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801707:	55                   	push   %ebp
+  801708:	89 e5                	mov    %esp,%ebp
+  80170a:	56                   	push   %esi
+  80170b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80170c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80170f:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  801715:	e8 34 ea ff ff       	call   80014e <sys_getenvid>
+  80171a:	83 ec 0c             	sub    $0xc,%esp
+  80171d:	ff 75 0c             	push   0xc(%ebp)
+  801720:	ff 75 08             	push   0x8(%ebp)
+  801723:	56                   	push   %esi
+  801724:	50                   	push   %eax
+  801725:	68 c4 27 80 00       	push   $0x8027c4
+  80172a:	e8 b3 00 00 00       	call   8017e2 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80172f:	83 c4 18             	add    $0x18,%esp
+  801732:	53                   	push   %ebx
+  801733:	ff 75 10             	push   0x10(%ebp)
+  801736:	e8 56 00 00 00       	call   801791 <vcprintf>
+	cprintf("\n");
+  80173b:	c7 04 24 af 27 80 00 	movl   $0x8027af,(%esp)
+  801742:	e8 9b 00 00 00       	call   8017e2 <cprintf>
+  801747:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80174a:	cc                   	int3
+	while (1)
+  80174b:	eb fd                	jmp    80174a <_panic+0x43>
+
+0080174d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80174d:	55                   	push   %ebp
+  80174e:	89 e5                	mov    %esp,%ebp
+  801750:	53                   	push   %ebx
+  801751:	83 ec 04             	sub    $0x4,%esp
+  801754:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801757:	8b 13                	mov    (%ebx),%edx
+  801759:	8d 42 01             	lea    0x1(%edx),%eax
+  80175c:	89 03                	mov    %eax,(%ebx)
+  80175e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801761:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801765:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80176a:	74 09                	je     801775 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80176c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801770:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801773:	c9                   	leave
+  801774:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  801775:	83 ec 08             	sub    $0x8,%esp
+  801778:	68 ff 00 00 00       	push   $0xff
+  80177d:	8d 43 08             	lea    0x8(%ebx),%eax
+  801780:	50                   	push   %eax
+  801781:	e8 39 e9 ff ff       	call   8000bf <sys_cputs>
+		b->idx = 0;
+  801786:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80178c:	83 c4 10             	add    $0x10,%esp
+  80178f:	eb db                	jmp    80176c <putch+0x1f>
+
+00801791 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  801791:	55                   	push   %ebp
+  801792:	89 e5                	mov    %esp,%ebp
+  801794:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80179a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8017a1:	00 00 00 
+	b.cnt = 0;
+  8017a4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8017ab:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8017ae:	ff 75 0c             	push   0xc(%ebp)
+  8017b1:	ff 75 08             	push   0x8(%ebp)
+  8017b4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8017ba:	50                   	push   %eax
+  8017bb:	68 4d 17 80 00       	push   $0x80174d
+  8017c0:	e8 14 01 00 00       	call   8018d9 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8017c5:	83 c4 08             	add    $0x8,%esp
+  8017c8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8017ce:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8017d4:	50                   	push   %eax
+  8017d5:	e8 e5 e8 ff ff       	call   8000bf <sys_cputs>
+
+	return b.cnt;
+}
+  8017da:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8017e0:	c9                   	leave
+  8017e1:	c3                   	ret
+
+008017e2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8017e2:	55                   	push   %ebp
+  8017e3:	89 e5                	mov    %esp,%ebp
+  8017e5:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8017e8:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8017eb:	50                   	push   %eax
+  8017ec:	ff 75 08             	push   0x8(%ebp)
+  8017ef:	e8 9d ff ff ff       	call   801791 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8017f4:	c9                   	leave
+  8017f5:	c3                   	ret
+
+008017f6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8017f6:	55                   	push   %ebp
+  8017f7:	89 e5                	mov    %esp,%ebp
+  8017f9:	57                   	push   %edi
+  8017fa:	56                   	push   %esi
+  8017fb:	53                   	push   %ebx
+  8017fc:	83 ec 1c             	sub    $0x1c,%esp
+  8017ff:	89 c7                	mov    %eax,%edi
+  801801:	89 d6                	mov    %edx,%esi
+  801803:	8b 45 08             	mov    0x8(%ebp),%eax
+  801806:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801809:	89 d1                	mov    %edx,%ecx
+  80180b:	89 c2                	mov    %eax,%edx
+  80180d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801810:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801813:	8b 45 10             	mov    0x10(%ebp),%eax
+  801816:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801819:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80181c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801823:	39 c2                	cmp    %eax,%edx
+  801825:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  801828:	72 3e                	jb     801868 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80182a:	83 ec 0c             	sub    $0xc,%esp
+  80182d:	ff 75 18             	push   0x18(%ebp)
+  801830:	83 eb 01             	sub    $0x1,%ebx
+  801833:	53                   	push   %ebx
+  801834:	50                   	push   %eax
+  801835:	83 ec 08             	sub    $0x8,%esp
+  801838:	ff 75 e4             	push   -0x1c(%ebp)
+  80183b:	ff 75 e0             	push   -0x20(%ebp)
+  80183e:	ff 75 dc             	push   -0x24(%ebp)
+  801841:	ff 75 d8             	push   -0x28(%ebp)
+  801844:	e8 0f 0d 00 00       	call   802558 <__udivdi3>
+  801849:	83 c4 18             	add    $0x18,%esp
+  80184c:	52                   	push   %edx
+  80184d:	50                   	push   %eax
+  80184e:	89 f2                	mov    %esi,%edx
+  801850:	89 f8                	mov    %edi,%eax
+  801852:	e8 9f ff ff ff       	call   8017f6 <printnum>
+  801857:	83 c4 20             	add    $0x20,%esp
+  80185a:	eb 13                	jmp    80186f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80185c:	83 ec 08             	sub    $0x8,%esp
+  80185f:	56                   	push   %esi
+  801860:	ff 75 18             	push   0x18(%ebp)
+  801863:	ff d7                	call   *%edi
+  801865:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801868:	83 eb 01             	sub    $0x1,%ebx
+  80186b:	85 db                	test   %ebx,%ebx
+  80186d:	7f ed                	jg     80185c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80186f:	83 ec 08             	sub    $0x8,%esp
+  801872:	56                   	push   %esi
+  801873:	83 ec 04             	sub    $0x4,%esp
+  801876:	ff 75 e4             	push   -0x1c(%ebp)
+  801879:	ff 75 e0             	push   -0x20(%ebp)
+  80187c:	ff 75 dc             	push   -0x24(%ebp)
+  80187f:	ff 75 d8             	push   -0x28(%ebp)
+  801882:	e8 ef 0c 00 00       	call   802576 <__umoddi3>
+  801887:	83 c4 14             	add    $0x14,%esp
+  80188a:	0f be 80 e7 27 80 00 	movsbl 0x8027e7(%eax),%eax
+  801891:	50                   	push   %eax
+  801892:	ff d7                	call   *%edi
+}
+  801894:	83 c4 10             	add    $0x10,%esp
+  801897:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80189a:	5b                   	pop    %ebx
+  80189b:	5e                   	pop    %esi
+  80189c:	5f                   	pop    %edi
+  80189d:	5d                   	pop    %ebp
+  80189e:	c3                   	ret
+
+0080189f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80189f:	55                   	push   %ebp
+  8018a0:	89 e5                	mov    %esp,%ebp
+  8018a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8018a5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8018a9:	8b 10                	mov    (%eax),%edx
+  8018ab:	3b 50 04             	cmp    0x4(%eax),%edx
+  8018ae:	73 0a                	jae    8018ba <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8018b0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8018b3:	89 08                	mov    %ecx,(%eax)
+  8018b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b8:	88 02                	mov    %al,(%edx)
+}
+  8018ba:	5d                   	pop    %ebp
+  8018bb:	c3                   	ret
+
+008018bc <printfmt>:
+{
+  8018bc:	55                   	push   %ebp
+  8018bd:	89 e5                	mov    %esp,%ebp
+  8018bf:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8018c2:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8018c5:	50                   	push   %eax
+  8018c6:	ff 75 10             	push   0x10(%ebp)
+  8018c9:	ff 75 0c             	push   0xc(%ebp)
+  8018cc:	ff 75 08             	push   0x8(%ebp)
+  8018cf:	e8 05 00 00 00       	call   8018d9 <vprintfmt>
+}
+  8018d4:	83 c4 10             	add    $0x10,%esp
+  8018d7:	c9                   	leave
+  8018d8:	c3                   	ret
+
+008018d9 <vprintfmt>:
+{
+  8018d9:	55                   	push   %ebp
+  8018da:	89 e5                	mov    %esp,%ebp
+  8018dc:	57                   	push   %edi
+  8018dd:	56                   	push   %esi
+  8018de:	53                   	push   %ebx
+  8018df:	83 ec 2c             	sub    $0x2c,%esp
+  8018e2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018e5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8018e8:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8018eb:	eb 0a                	jmp    8018f7 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8018ed:	83 ec 08             	sub    $0x8,%esp
+  8018f0:	53                   	push   %ebx
+  8018f1:	50                   	push   %eax
+  8018f2:	ff d6                	call   *%esi
+  8018f4:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8018f7:	83 c7 01             	add    $0x1,%edi
+  8018fa:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8018fe:	83 f8 25             	cmp    $0x25,%eax
+  801901:	74 0c                	je     80190f <vprintfmt+0x36>
+			if (ch == '\0')
+  801903:	85 c0                	test   %eax,%eax
+  801905:	75 e6                	jne    8018ed <vprintfmt+0x14>
+}
+  801907:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80190a:	5b                   	pop    %ebx
+  80190b:	5e                   	pop    %esi
+  80190c:	5f                   	pop    %edi
+  80190d:	5d                   	pop    %ebp
+  80190e:	c3                   	ret
+		padc = ' ';
+  80190f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  801913:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80191a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801921:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801928:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80192d:	8d 47 01             	lea    0x1(%edi),%eax
+  801930:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801933:	0f b6 17             	movzbl (%edi),%edx
+  801936:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801939:	3c 55                	cmp    $0x55,%al
+  80193b:	0f 87 c5 03 00 00    	ja     801d06 <vprintfmt+0x42d>
+  801941:	0f b6 c0             	movzbl %al,%eax
+  801944:	ff 24 85 60 29 80 00 	jmp    *0x802960(,%eax,4)
+  80194b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80194e:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  801952:	eb d9                	jmp    80192d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  801954:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801957:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80195b:	eb d0                	jmp    80192d <vprintfmt+0x54>
+  80195d:	0f b6 d2             	movzbl %dl,%edx
+  801960:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  801963:	b8 00 00 00 00       	mov    $0x0,%eax
+  801968:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80196b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80196e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801972:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  801975:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  801978:	83 f9 09             	cmp    $0x9,%ecx
+  80197b:	77 55                	ja     8019d2 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80197d:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  801980:	eb e9                	jmp    80196b <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  801982:	8b 45 14             	mov    0x14(%ebp),%eax
+  801985:	8b 00                	mov    (%eax),%eax
+  801987:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80198a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80198d:	8d 40 04             	lea    0x4(%eax),%eax
+  801990:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801993:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  801996:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80199a:	79 91                	jns    80192d <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80199c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80199f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019a2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8019a9:	eb 82                	jmp    80192d <vprintfmt+0x54>
+			if (width < 0)
+  8019ab:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8019ae:	85 d2                	test   %edx,%edx
+  8019b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b5:	0f 49 c2             	cmovns %edx,%eax
+  8019b8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8019bb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019be:	e9 6a ff ff ff       	jmp    80192d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8019c3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8019c6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8019cd:	e9 5b ff ff ff       	jmp    80192d <vprintfmt+0x54>
+  8019d2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019d5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019d8:	eb bc                	jmp    801996 <vprintfmt+0xbd>
+			lflag++;
+  8019da:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8019dd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8019e0:	e9 48 ff ff ff       	jmp    80192d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8019e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019e8:	8d 78 04             	lea    0x4(%eax),%edi
+  8019eb:	83 ec 08             	sub    $0x8,%esp
+  8019ee:	53                   	push   %ebx
+  8019ef:	ff 30                	push   (%eax)
+  8019f1:	ff d6                	call   *%esi
+			break;
+  8019f3:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8019f6:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8019f9:	e9 63 02 00 00       	jmp    801c61 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8019fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a01:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  801a04:	8b 10                	mov    (%eax),%edx
+  801a06:	89 d0                	mov    %edx,%eax
+  801a08:	f7 d8                	neg    %eax
+  801a0a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801a0d:	83 f8 12             	cmp    $0x12,%eax
+  801a10:	7f 23                	jg     801a35 <vprintfmt+0x15c>
+  801a12:	8b 14 85 c0 2a 80 00 	mov    0x802ac0(,%eax,4),%edx
+  801a19:	85 d2                	test   %edx,%edx
+  801a1b:	74 18                	je     801a35 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  801a1d:	52                   	push   %edx
+  801a1e:	68 7d 27 80 00       	push   $0x80277d
+  801a23:	53                   	push   %ebx
+  801a24:	56                   	push   %esi
+  801a25:	e8 92 fe ff ff       	call   8018bc <printfmt>
+  801a2a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a2d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  801a30:	e9 2c 02 00 00       	jmp    801c61 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  801a35:	50                   	push   %eax
+  801a36:	68 ff 27 80 00       	push   $0x8027ff
+  801a3b:	53                   	push   %ebx
+  801a3c:	56                   	push   %esi
+  801a3d:	e8 7a fe ff ff       	call   8018bc <printfmt>
+  801a42:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801a45:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801a48:	e9 14 02 00 00       	jmp    801c61 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801a4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a50:	83 c0 04             	add    $0x4,%eax
+  801a53:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801a56:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a59:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801a5b:	85 c9                	test   %ecx,%ecx
+  801a5d:	b8 f8 27 80 00       	mov    $0x8027f8,%eax
+  801a62:	0f 45 c1             	cmovne %ecx,%eax
+  801a65:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  801a68:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801a6c:	7e 06                	jle    801a74 <vprintfmt+0x19b>
+  801a6e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  801a72:	75 0b                	jne    801a7f <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801a74:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801a77:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801a7a:	89 75 08             	mov    %esi,0x8(%ebp)
+  801a7d:	eb 5c                	jmp    801adb <vprintfmt+0x202>
+  801a7f:	83 ec 08             	sub    $0x8,%esp
+  801a82:	ff 75 d0             	push   -0x30(%ebp)
+  801a85:	ff 75 cc             	push   -0x34(%ebp)
+  801a88:	e8 19 03 00 00       	call   801da6 <strnlen>
+  801a8d:	89 c2                	mov    %eax,%edx
+  801a8f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a92:	29 d0                	sub    %edx,%eax
+  801a94:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  801a97:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  801a9b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801a9e:	89 75 08             	mov    %esi,0x8(%ebp)
+  801aa1:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801aa3:	eb 0e                	jmp    801ab3 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  801aa5:	83 ec 08             	sub    $0x8,%esp
+  801aa8:	53                   	push   %ebx
+  801aa9:	57                   	push   %edi
+  801aaa:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801aad:	83 ee 01             	sub    $0x1,%esi
+  801ab0:	83 c4 10             	add    $0x10,%esp
+  801ab3:	85 f6                	test   %esi,%esi
+  801ab5:	7f ee                	jg     801aa5 <vprintfmt+0x1cc>
+  801ab7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801aba:	8b 75 08             	mov    0x8(%ebp),%esi
+  801abd:	85 c0                	test   %eax,%eax
+  801abf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac4:	0f 49 d0             	cmovns %eax,%edx
+  801ac7:	29 d0                	sub    %edx,%eax
+  801ac9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801acc:	eb a6                	jmp    801a74 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  801ace:	83 ec 08             	sub    $0x8,%esp
+  801ad1:	53                   	push   %ebx
+  801ad2:	52                   	push   %edx
+  801ad3:	ff 55 08             	call   *0x8(%ebp)
+  801ad6:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801ad9:	89 f1                	mov    %esi,%ecx
+  801adb:	8d 71 01             	lea    0x1(%ecx),%esi
+  801ade:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  801ae2:	0f be d0             	movsbl %al,%edx
+  801ae5:	85 d2                	test   %edx,%edx
+  801ae7:	74 28                	je     801b11 <vprintfmt+0x238>
+  801ae9:	85 ff                	test   %edi,%edi
+  801aeb:	78 05                	js     801af2 <vprintfmt+0x219>
+  801aed:	83 ef 01             	sub    $0x1,%edi
+  801af0:	78 30                	js     801b22 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801af2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801af6:	74 d6                	je     801ace <vprintfmt+0x1f5>
+  801af8:	0f be c0             	movsbl %al,%eax
+  801afb:	83 e8 20             	sub    $0x20,%eax
+  801afe:	83 f8 5e             	cmp    $0x5e,%eax
+  801b01:	76 cb                	jbe    801ace <vprintfmt+0x1f5>
+					putch('?', putdat);
+  801b03:	83 ec 08             	sub    $0x8,%esp
+  801b06:	53                   	push   %ebx
+  801b07:	6a 3f                	push   $0x3f
+  801b09:	ff 55 08             	call   *0x8(%ebp)
+  801b0c:	83 c4 10             	add    $0x10,%esp
+  801b0f:	eb c8                	jmp    801ad9 <vprintfmt+0x200>
+  801b11:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b14:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b17:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801b1a:	01 d0                	add    %edx,%eax
+  801b1c:	29 c8                	sub    %ecx,%eax
+  801b1e:	89 c7                	mov    %eax,%edi
+  801b20:	eb 13                	jmp    801b35 <vprintfmt+0x25c>
+  801b22:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b25:	eb ed                	jmp    801b14 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  801b27:	83 ec 08             	sub    $0x8,%esp
+  801b2a:	53                   	push   %ebx
+  801b2b:	6a 20                	push   $0x20
+  801b2d:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  801b2f:	83 ef 01             	sub    $0x1,%edi
+  801b32:	83 c4 10             	add    $0x10,%esp
+  801b35:	85 ff                	test   %edi,%edi
+  801b37:	7f ee                	jg     801b27 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801b39:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b3c:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b3f:	e9 1d 01 00 00       	jmp    801c61 <vprintfmt+0x388>
+	if (lflag >= 2)
+  801b44:	83 f9 01             	cmp    $0x1,%ecx
+  801b47:	7f 1b                	jg     801b64 <vprintfmt+0x28b>
+	else if (lflag)
+  801b49:	85 c9                	test   %ecx,%ecx
+  801b4b:	74 63                	je     801bb0 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  801b4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b50:	8b 00                	mov    (%eax),%eax
+  801b52:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b55:	99                   	cltd
+  801b56:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b59:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b5c:	8d 40 04             	lea    0x4(%eax),%eax
+  801b5f:	89 45 14             	mov    %eax,0x14(%ebp)
+  801b62:	eb 17                	jmp    801b7b <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  801b64:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b67:	8b 50 04             	mov    0x4(%eax),%edx
+  801b6a:	8b 00                	mov    (%eax),%eax
+  801b6c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801b6f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801b72:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b75:	8d 40 08             	lea    0x8(%eax),%eax
+  801b78:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801b7b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b7e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  801b81:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  801b86:	85 c9                	test   %ecx,%ecx
+  801b88:	0f 89 b9 00 00 00    	jns    801c47 <vprintfmt+0x36e>
+				putch('-', putdat);
+  801b8e:	83 ec 08             	sub    $0x8,%esp
+  801b91:	53                   	push   %ebx
+  801b92:	6a 2d                	push   $0x2d
+  801b94:	ff d6                	call   *%esi
+				num = -(long long) num;
+  801b96:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801b99:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801b9c:	f7 da                	neg    %edx
+  801b9e:	83 d1 00             	adc    $0x0,%ecx
+  801ba1:	f7 d9                	neg    %ecx
+  801ba3:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  801ba6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801bab:	e9 97 00 00 00       	jmp    801c47 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  801bb0:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bb3:	8b 00                	mov    (%eax),%eax
+  801bb5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801bb8:	99                   	cltd
+  801bb9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801bbc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bbf:	8d 40 04             	lea    0x4(%eax),%eax
+  801bc2:	89 45 14             	mov    %eax,0x14(%ebp)
+  801bc5:	eb b4                	jmp    801b7b <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  801bc7:	83 f9 01             	cmp    $0x1,%ecx
+  801bca:	7f 1b                	jg     801be7 <vprintfmt+0x30e>
+	else if (lflag)
+  801bcc:	85 c9                	test   %ecx,%ecx
+  801bce:	74 2c                	je     801bfc <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  801bd0:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bd3:	8b 10                	mov    (%eax),%edx
+  801bd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bda:	8d 40 04             	lea    0x4(%eax),%eax
+  801bdd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801be0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  801be5:	eb 60                	jmp    801c47 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801be7:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bea:	8b 10                	mov    (%eax),%edx
+  801bec:	8b 48 04             	mov    0x4(%eax),%ecx
+  801bef:	8d 40 08             	lea    0x8(%eax),%eax
+  801bf2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801bf5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  801bfa:	eb 4b                	jmp    801c47 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  801bfc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801bff:	8b 10                	mov    (%eax),%edx
+  801c01:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c06:	8d 40 04             	lea    0x4(%eax),%eax
+  801c09:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801c0c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  801c11:	eb 34                	jmp    801c47 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801c13:	83 f9 01             	cmp    $0x1,%ecx
+  801c16:	7f 15                	jg     801c2d <vprintfmt+0x354>
+	else if (lflag)
+  801c18:	85 c9                	test   %ecx,%ecx
+  801c1a:	74 4d                	je     801c69 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  801c1c:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c1f:	8b 00                	mov    (%eax),%eax
+  801c21:	99                   	cltd
+  801c22:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c25:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801c28:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  801c2b:	eb 11                	jmp    801c3e <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  801c2d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c30:	8b 50 04             	mov    0x4(%eax),%edx
+  801c33:	8b 00                	mov    (%eax),%eax
+  801c35:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c38:	8d 49 08             	lea    0x8(%ecx),%ecx
+  801c3b:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  801c3e:	89 d1                	mov    %edx,%ecx
+  801c40:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  801c42:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801c47:	83 ec 0c             	sub    $0xc,%esp
+  801c4a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  801c4e:	50                   	push   %eax
+  801c4f:	ff 75 e0             	push   -0x20(%ebp)
+  801c52:	57                   	push   %edi
+  801c53:	51                   	push   %ecx
+  801c54:	52                   	push   %edx
+  801c55:	89 da                	mov    %ebx,%edx
+  801c57:	89 f0                	mov    %esi,%eax
+  801c59:	e8 98 fb ff ff       	call   8017f6 <printnum>
+			break;
+  801c5e:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  801c61:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801c64:	e9 8e fc ff ff       	jmp    8018f7 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  801c69:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c6c:	8b 00                	mov    (%eax),%eax
+  801c6e:	99                   	cltd
+  801c6f:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801c72:	8d 49 04             	lea    0x4(%ecx),%ecx
+  801c75:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  801c78:	eb c4                	jmp    801c3e <vprintfmt+0x365>
+			putch('0', putdat);
+  801c7a:	83 ec 08             	sub    $0x8,%esp
+  801c7d:	53                   	push   %ebx
+  801c7e:	6a 30                	push   $0x30
+  801c80:	ff d6                	call   *%esi
+			putch('x', putdat);
+  801c82:	83 c4 08             	add    $0x8,%esp
+  801c85:	53                   	push   %ebx
+  801c86:	6a 78                	push   $0x78
+  801c88:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  801c8a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c8d:	8b 10                	mov    (%eax),%edx
+  801c8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801c94:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801c97:	8d 40 04             	lea    0x4(%eax),%eax
+  801c9a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801c9d:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  801ca2:	eb a3                	jmp    801c47 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  801ca4:	83 f9 01             	cmp    $0x1,%ecx
+  801ca7:	7f 1b                	jg     801cc4 <vprintfmt+0x3eb>
+	else if (lflag)
+  801ca9:	85 c9                	test   %ecx,%ecx
+  801cab:	74 2f                	je     801cdc <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  801cad:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cb0:	8b 10                	mov    (%eax),%edx
+  801cb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cb7:	8d 40 04             	lea    0x4(%eax),%eax
+  801cba:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cbd:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801cc2:	eb 83                	jmp    801c47 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  801cc4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cc7:	8b 10                	mov    (%eax),%edx
+  801cc9:	8b 48 04             	mov    0x4(%eax),%ecx
+  801ccc:	8d 40 08             	lea    0x8(%eax),%eax
+  801ccf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cd2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801cd7:	e9 6b ff ff ff       	jmp    801c47 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  801cdc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cdf:	8b 10                	mov    (%eax),%edx
+  801ce1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ce6:	8d 40 04             	lea    0x4(%eax),%eax
+  801ce9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801cec:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801cf1:	e9 51 ff ff ff       	jmp    801c47 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  801cf6:	83 ec 08             	sub    $0x8,%esp
+  801cf9:	53                   	push   %ebx
+  801cfa:	6a 25                	push   $0x25
+  801cfc:	ff d6                	call   *%esi
+			break;
+  801cfe:	83 c4 10             	add    $0x10,%esp
+  801d01:	e9 5b ff ff ff       	jmp    801c61 <vprintfmt+0x388>
+			putch('%', putdat);
+  801d06:	83 ec 08             	sub    $0x8,%esp
+  801d09:	53                   	push   %ebx
+  801d0a:	6a 25                	push   $0x25
+  801d0c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801d0e:	83 c4 10             	add    $0x10,%esp
+  801d11:	89 f8                	mov    %edi,%eax
+  801d13:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801d17:	74 05                	je     801d1e <vprintfmt+0x445>
+  801d19:	83 e8 01             	sub    $0x1,%eax
+  801d1c:	eb f5                	jmp    801d13 <vprintfmt+0x43a>
+  801d1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d21:	e9 3b ff ff ff       	jmp    801c61 <vprintfmt+0x388>
+
+00801d26 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801d26:	55                   	push   %ebp
+  801d27:	89 e5                	mov    %esp,%ebp
+  801d29:	83 ec 18             	sub    $0x18,%esp
+  801d2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d2f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801d32:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801d35:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801d39:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801d3c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801d43:	85 c0                	test   %eax,%eax
+  801d45:	74 26                	je     801d6d <vsnprintf+0x47>
+  801d47:	85 d2                	test   %edx,%edx
+  801d49:	7e 22                	jle    801d6d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801d4b:	ff 75 14             	push   0x14(%ebp)
+  801d4e:	ff 75 10             	push   0x10(%ebp)
+  801d51:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801d54:	50                   	push   %eax
+  801d55:	68 9f 18 80 00       	push   $0x80189f
+  801d5a:	e8 7a fb ff ff       	call   8018d9 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801d5f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801d62:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801d65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d68:	83 c4 10             	add    $0x10,%esp
+}
+  801d6b:	c9                   	leave
+  801d6c:	c3                   	ret
+		return -E_INVAL;
+  801d6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d72:	eb f7                	jmp    801d6b <vsnprintf+0x45>
+
+00801d74 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801d74:	55                   	push   %ebp
+  801d75:	89 e5                	mov    %esp,%ebp
+  801d77:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801d7a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801d7d:	50                   	push   %eax
+  801d7e:	ff 75 10             	push   0x10(%ebp)
+  801d81:	ff 75 0c             	push   0xc(%ebp)
+  801d84:	ff 75 08             	push   0x8(%ebp)
+  801d87:	e8 9a ff ff ff       	call   801d26 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801d8c:	c9                   	leave
+  801d8d:	c3                   	ret
+
+00801d8e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801d8e:	55                   	push   %ebp
+  801d8f:	89 e5                	mov    %esp,%ebp
+  801d91:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801d94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d99:	eb 03                	jmp    801d9e <strlen+0x10>
+		n++;
+  801d9b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801d9e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801da2:	75 f7                	jne    801d9b <strlen+0xd>
+	return n;
+}
+  801da4:	5d                   	pop    %ebp
+  801da5:	c3                   	ret
+
+00801da6 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801da6:	55                   	push   %ebp
+  801da7:	89 e5                	mov    %esp,%ebp
+  801da9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dac:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801daf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db4:	eb 03                	jmp    801db9 <strnlen+0x13>
+		n++;
+  801db6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801db9:	39 d0                	cmp    %edx,%eax
+  801dbb:	74 08                	je     801dc5 <strnlen+0x1f>
+  801dbd:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801dc1:	75 f3                	jne    801db6 <strnlen+0x10>
+  801dc3:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801dc5:	89 d0                	mov    %edx,%eax
+  801dc7:	5d                   	pop    %ebp
+  801dc8:	c3                   	ret
+
+00801dc9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801dc9:	55                   	push   %ebp
+  801dca:	89 e5                	mov    %esp,%ebp
+  801dcc:	53                   	push   %ebx
+  801dcd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801dd0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801dd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801ddc:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801ddf:	83 c0 01             	add    $0x1,%eax
+  801de2:	84 d2                	test   %dl,%dl
+  801de4:	75 f2                	jne    801dd8 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801de6:	89 c8                	mov    %ecx,%eax
+  801de8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801deb:	c9                   	leave
+  801dec:	c3                   	ret
+
+00801ded <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801ded:	55                   	push   %ebp
+  801dee:	89 e5                	mov    %esp,%ebp
+  801df0:	53                   	push   %ebx
+  801df1:	83 ec 10             	sub    $0x10,%esp
+  801df4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801df7:	53                   	push   %ebx
+  801df8:	e8 91 ff ff ff       	call   801d8e <strlen>
+  801dfd:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801e00:	ff 75 0c             	push   0xc(%ebp)
+  801e03:	01 d8                	add    %ebx,%eax
+  801e05:	50                   	push   %eax
+  801e06:	e8 be ff ff ff       	call   801dc9 <strcpy>
+	return dst;
+}
+  801e0b:	89 d8                	mov    %ebx,%eax
+  801e0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e10:	c9                   	leave
+  801e11:	c3                   	ret
+
+00801e12 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801e12:	55                   	push   %ebp
+  801e13:	89 e5                	mov    %esp,%ebp
+  801e15:	56                   	push   %esi
+  801e16:	53                   	push   %ebx
+  801e17:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e1a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801e1d:	89 f3                	mov    %esi,%ebx
+  801e1f:	03 5d 10             	add    0x10(%ebp),%ebx
+  801e22:	89 f0                	mov    %esi,%eax
+  801e24:	eb 0f                	jmp    801e35 <strncpy+0x23>
+		*dst++ = *src;
+  801e26:	83 c0 01             	add    $0x1,%eax
+  801e29:	0f b6 0a             	movzbl (%edx),%ecx
+  801e2c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801e2f:	80 f9 01             	cmp    $0x1,%cl
+  801e32:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801e35:	39 d8                	cmp    %ebx,%eax
+  801e37:	75 ed                	jne    801e26 <strncpy+0x14>
+	}
+	return ret;
+}
+  801e39:	89 f0                	mov    %esi,%eax
+  801e3b:	5b                   	pop    %ebx
+  801e3c:	5e                   	pop    %esi
+  801e3d:	5d                   	pop    %ebp
+  801e3e:	c3                   	ret
+
+00801e3f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e3f:	55                   	push   %ebp
+  801e40:	89 e5                	mov    %esp,%ebp
+  801e42:	56                   	push   %esi
+  801e43:	53                   	push   %ebx
+  801e44:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e4a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801e4d:	89 f0                	mov    %esi,%eax
+  801e4f:	85 d2                	test   %edx,%edx
+  801e51:	74 21                	je     801e74 <strlcpy+0x35>
+  801e53:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801e57:	89 f2                	mov    %esi,%edx
+  801e59:	eb 09                	jmp    801e64 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801e5b:	83 c1 01             	add    $0x1,%ecx
+  801e5e:	83 c2 01             	add    $0x1,%edx
+  801e61:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801e64:	39 c2                	cmp    %eax,%edx
+  801e66:	74 09                	je     801e71 <strlcpy+0x32>
+  801e68:	0f b6 19             	movzbl (%ecx),%ebx
+  801e6b:	84 db                	test   %bl,%bl
+  801e6d:	75 ec                	jne    801e5b <strlcpy+0x1c>
+  801e6f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801e71:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801e74:	29 f0                	sub    %esi,%eax
+}
+  801e76:	5b                   	pop    %ebx
+  801e77:	5e                   	pop    %esi
+  801e78:	5d                   	pop    %ebp
+  801e79:	c3                   	ret
+
+00801e7a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801e7a:	55                   	push   %ebp
+  801e7b:	89 e5                	mov    %esp,%ebp
+  801e7d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e80:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801e83:	eb 06                	jmp    801e8b <strcmp+0x11>
+		p++, q++;
+  801e85:	83 c1 01             	add    $0x1,%ecx
+  801e88:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801e8b:	0f b6 01             	movzbl (%ecx),%eax
+  801e8e:	84 c0                	test   %al,%al
+  801e90:	74 04                	je     801e96 <strcmp+0x1c>
+  801e92:	3a 02                	cmp    (%edx),%al
+  801e94:	74 ef                	je     801e85 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801e96:	0f b6 c0             	movzbl %al,%eax
+  801e99:	0f b6 12             	movzbl (%edx),%edx
+  801e9c:	29 d0                	sub    %edx,%eax
+}
+  801e9e:	5d                   	pop    %ebp
+  801e9f:	c3                   	ret
+
+00801ea0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801ea0:	55                   	push   %ebp
+  801ea1:	89 e5                	mov    %esp,%ebp
+  801ea3:	53                   	push   %ebx
+  801ea4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eaa:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801ead:	eb 09                	jmp    801eb8 <strncmp+0x18>
+		n--, p++, q++;
+  801eaf:	83 ea 01             	sub    $0x1,%edx
+  801eb2:	83 c0 01             	add    $0x1,%eax
+  801eb5:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801eb8:	85 d2                	test   %edx,%edx
+  801eba:	74 18                	je     801ed4 <strncmp+0x34>
+  801ebc:	0f b6 18             	movzbl (%eax),%ebx
+  801ebf:	84 db                	test   %bl,%bl
+  801ec1:	74 04                	je     801ec7 <strncmp+0x27>
+  801ec3:	3a 19                	cmp    (%ecx),%bl
+  801ec5:	74 e8                	je     801eaf <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ec7:	0f b6 00             	movzbl (%eax),%eax
+  801eca:	0f b6 11             	movzbl (%ecx),%edx
+  801ecd:	29 d0                	sub    %edx,%eax
+}
+  801ecf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed2:	c9                   	leave
+  801ed3:	c3                   	ret
+		return 0;
+  801ed4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed9:	eb f4                	jmp    801ecf <strncmp+0x2f>
+
+00801edb <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801edb:	55                   	push   %ebp
+  801edc:	89 e5                	mov    %esp,%ebp
+  801ede:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801ee5:	eb 03                	jmp    801eea <strchr+0xf>
+  801ee7:	83 c0 01             	add    $0x1,%eax
+  801eea:	0f b6 10             	movzbl (%eax),%edx
+  801eed:	84 d2                	test   %dl,%dl
+  801eef:	74 06                	je     801ef7 <strchr+0x1c>
+		if (*s == c)
+  801ef1:	38 ca                	cmp    %cl,%dl
+  801ef3:	75 f2                	jne    801ee7 <strchr+0xc>
+  801ef5:	eb 05                	jmp    801efc <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801ef7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801efc:	5d                   	pop    %ebp
+  801efd:	c3                   	ret
+
+00801efe <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801efe:	55                   	push   %ebp
+  801eff:	89 e5                	mov    %esp,%ebp
+  801f01:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f04:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801f08:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801f0b:	38 ca                	cmp    %cl,%dl
+  801f0d:	74 09                	je     801f18 <strfind+0x1a>
+  801f0f:	84 d2                	test   %dl,%dl
+  801f11:	74 05                	je     801f18 <strfind+0x1a>
+	for (; *s; s++)
+  801f13:	83 c0 01             	add    $0x1,%eax
+  801f16:	eb f0                	jmp    801f08 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801f18:	5d                   	pop    %ebp
+  801f19:	c3                   	ret
+
+00801f1a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801f1a:	55                   	push   %ebp
+  801f1b:	89 e5                	mov    %esp,%ebp
+  801f1d:	57                   	push   %edi
+  801f1e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f21:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801f24:	85 c9                	test   %ecx,%ecx
+  801f26:	74 20                	je     801f48 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801f28:	89 f8                	mov    %edi,%eax
+  801f2a:	09 c8                	or     %ecx,%eax
+  801f2c:	a8 03                	test   $0x3,%al
+  801f2e:	75 12                	jne    801f42 <memset+0x28>
+		c &= 0xFF;
+  801f30:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801f34:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801f3a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801f3d:	fc                   	cld
+  801f3e:	f3 ab                	rep stos %eax,%es:(%edi)
+  801f40:	eb 06                	jmp    801f48 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801f42:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f45:	fc                   	cld
+  801f46:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801f48:	89 f8                	mov    %edi,%eax
+  801f4a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801f4d:	c9                   	leave
+  801f4e:	c3                   	ret
+
+00801f4f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801f4f:	55                   	push   %ebp
+  801f50:	89 e5                	mov    %esp,%ebp
+  801f52:	57                   	push   %edi
+  801f53:	56                   	push   %esi
+  801f54:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f57:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f5a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801f5d:	39 c6                	cmp    %eax,%esi
+  801f5f:	73 32                	jae    801f93 <memmove+0x44>
+  801f61:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801f64:	39 d0                	cmp    %edx,%eax
+  801f66:	73 2b                	jae    801f93 <memmove+0x44>
+		s += n;
+		d += n;
+  801f68:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f6b:	89 d6                	mov    %edx,%esi
+  801f6d:	09 fe                	or     %edi,%esi
+  801f6f:	09 ce                	or     %ecx,%esi
+  801f71:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801f77:	75 0e                	jne    801f87 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801f79:	83 ef 04             	sub    $0x4,%edi
+  801f7c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801f7f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801f82:	fd                   	std
+  801f83:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801f85:	eb 09                	jmp    801f90 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801f87:	83 ef 01             	sub    $0x1,%edi
+  801f8a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801f8d:	fd                   	std
+  801f8e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801f90:	fc                   	cld
+  801f91:	eb 1a                	jmp    801fad <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801f93:	89 f2                	mov    %esi,%edx
+  801f95:	09 c2                	or     %eax,%edx
+  801f97:	09 ca                	or     %ecx,%edx
+  801f99:	f6 c2 03             	test   $0x3,%dl
+  801f9c:	75 0a                	jne    801fa8 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801f9e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801fa1:	89 c7                	mov    %eax,%edi
+  801fa3:	fc                   	cld
+  801fa4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801fa6:	eb 05                	jmp    801fad <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801fa8:	89 c7                	mov    %eax,%edi
+  801faa:	fc                   	cld
+  801fab:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801fad:	5e                   	pop    %esi
+  801fae:	5f                   	pop    %edi
+  801faf:	5d                   	pop    %ebp
+  801fb0:	c3                   	ret
+
+00801fb1 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801fb1:	55                   	push   %ebp
+  801fb2:	89 e5                	mov    %esp,%ebp
+  801fb4:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801fb7:	ff 75 10             	push   0x10(%ebp)
+  801fba:	ff 75 0c             	push   0xc(%ebp)
+  801fbd:	ff 75 08             	push   0x8(%ebp)
+  801fc0:	e8 8a ff ff ff       	call   801f4f <memmove>
+}
+  801fc5:	c9                   	leave
+  801fc6:	c3                   	ret
+
+00801fc7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801fc7:	55                   	push   %ebp
+  801fc8:	89 e5                	mov    %esp,%ebp
+  801fca:	56                   	push   %esi
+  801fcb:	53                   	push   %ebx
+  801fcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fcf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801fd2:	89 c6                	mov    %eax,%esi
+  801fd4:	03 75 10             	add    0x10(%ebp),%esi
+  801fd7:	eb 06                	jmp    801fdf <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801fd9:	83 c0 01             	add    $0x1,%eax
+  801fdc:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801fdf:	39 f0                	cmp    %esi,%eax
+  801fe1:	74 14                	je     801ff7 <memcmp+0x30>
+		if (*s1 != *s2)
+  801fe3:	0f b6 08             	movzbl (%eax),%ecx
+  801fe6:	0f b6 1a             	movzbl (%edx),%ebx
+  801fe9:	38 d9                	cmp    %bl,%cl
+  801feb:	74 ec                	je     801fd9 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801fed:	0f b6 c1             	movzbl %cl,%eax
+  801ff0:	0f b6 db             	movzbl %bl,%ebx
+  801ff3:	29 d8                	sub    %ebx,%eax
+  801ff5:	eb 05                	jmp    801ffc <memcmp+0x35>
+	}
+
+	return 0;
+  801ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ffc:	5b                   	pop    %ebx
+  801ffd:	5e                   	pop    %esi
+  801ffe:	5d                   	pop    %ebp
+  801fff:	c3                   	ret
+
+00802000 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802000:	55                   	push   %ebp
+  802001:	89 e5                	mov    %esp,%ebp
+  802003:	8b 45 08             	mov    0x8(%ebp),%eax
+  802006:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802009:	89 c2                	mov    %eax,%edx
+  80200b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80200e:	eb 03                	jmp    802013 <memfind+0x13>
+  802010:	83 c0 01             	add    $0x1,%eax
+  802013:	39 d0                	cmp    %edx,%eax
+  802015:	73 04                	jae    80201b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802017:	38 08                	cmp    %cl,(%eax)
+  802019:	75 f5                	jne    802010 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80201b:	5d                   	pop    %ebp
+  80201c:	c3                   	ret
+
+0080201d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80201d:	55                   	push   %ebp
+  80201e:	89 e5                	mov    %esp,%ebp
+  802020:	57                   	push   %edi
+  802021:	56                   	push   %esi
+  802022:	53                   	push   %ebx
+  802023:	8b 55 08             	mov    0x8(%ebp),%edx
+  802026:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802029:	eb 03                	jmp    80202e <strtol+0x11>
+		s++;
+  80202b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80202e:	0f b6 02             	movzbl (%edx),%eax
+  802031:	3c 20                	cmp    $0x20,%al
+  802033:	74 f6                	je     80202b <strtol+0xe>
+  802035:	3c 09                	cmp    $0x9,%al
+  802037:	74 f2                	je     80202b <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802039:	3c 2b                	cmp    $0x2b,%al
+  80203b:	74 2a                	je     802067 <strtol+0x4a>
+	int neg = 0;
+  80203d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802042:	3c 2d                	cmp    $0x2d,%al
+  802044:	74 2b                	je     802071 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802046:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80204c:	75 0f                	jne    80205d <strtol+0x40>
+  80204e:	80 3a 30             	cmpb   $0x30,(%edx)
+  802051:	74 28                	je     80207b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802053:	85 db                	test   %ebx,%ebx
+  802055:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80205a:	0f 44 d8             	cmove  %eax,%ebx
+  80205d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802062:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802065:	eb 46                	jmp    8020ad <strtol+0x90>
+		s++;
+  802067:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  80206a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80206f:	eb d5                	jmp    802046 <strtol+0x29>
+		s++, neg = 1;
+  802071:	83 c2 01             	add    $0x1,%edx
+  802074:	bf 01 00 00 00       	mov    $0x1,%edi
+  802079:	eb cb                	jmp    802046 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80207b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80207f:	74 0e                	je     80208f <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802081:	85 db                	test   %ebx,%ebx
+  802083:	75 d8                	jne    80205d <strtol+0x40>
+		s++, base = 8;
+  802085:	83 c2 01             	add    $0x1,%edx
+  802088:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80208d:	eb ce                	jmp    80205d <strtol+0x40>
+		s += 2, base = 16;
+  80208f:	83 c2 02             	add    $0x2,%edx
+  802092:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802097:	eb c4                	jmp    80205d <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802099:	0f be c0             	movsbl %al,%eax
+  80209c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  80209f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8020a2:	7d 3a                	jge    8020de <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8020a4:	83 c2 01             	add    $0x1,%edx
+  8020a7:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8020ab:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8020ad:	0f b6 02             	movzbl (%edx),%eax
+  8020b0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8020b3:	89 f3                	mov    %esi,%ebx
+  8020b5:	80 fb 09             	cmp    $0x9,%bl
+  8020b8:	76 df                	jbe    802099 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8020ba:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8020bd:	89 f3                	mov    %esi,%ebx
+  8020bf:	80 fb 19             	cmp    $0x19,%bl
+  8020c2:	77 08                	ja     8020cc <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8020c4:	0f be c0             	movsbl %al,%eax
+  8020c7:	83 e8 57             	sub    $0x57,%eax
+  8020ca:	eb d3                	jmp    80209f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8020cc:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8020cf:	89 f3                	mov    %esi,%ebx
+  8020d1:	80 fb 19             	cmp    $0x19,%bl
+  8020d4:	77 08                	ja     8020de <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8020d6:	0f be c0             	movsbl %al,%eax
+  8020d9:	83 e8 37             	sub    $0x37,%eax
+  8020dc:	eb c1                	jmp    80209f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8020de:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8020e2:	74 05                	je     8020e9 <strtol+0xcc>
+		*endptr = (char *) s;
+  8020e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020e7:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8020e9:	89 c8                	mov    %ecx,%eax
+  8020eb:	f7 d8                	neg    %eax
+  8020ed:	85 ff                	test   %edi,%edi
+  8020ef:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8020f2:	89 c8                	mov    %ecx,%eax
+  8020f4:	5b                   	pop    %ebx
+  8020f5:	5e                   	pop    %esi
+  8020f6:	5f                   	pop    %edi
+  8020f7:	5d                   	pop    %ebp
+  8020f8:	c3                   	ret
+
+008020f9 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  8020f9:	55                   	push   %ebp
+  8020fa:	89 e5                	mov    %esp,%ebp
+  8020fc:	57                   	push   %edi
+  8020fd:	56                   	push   %esi
+  8020fe:	53                   	push   %ebx
+  8020ff:	83 ec 0c             	sub    $0xc,%esp
+  802102:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802105:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802108:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  80210b:	85 ff                	test   %edi,%edi
+  80210d:	74 16                	je     802125 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  80210f:	83 ec 04             	sub    $0x4,%esp
+  802112:	56                   	push   %esi
+  802113:	6a 00                	push   $0x0
+  802115:	53                   	push   %ebx
+  802116:	e8 02 ff ff ff       	call   80201d <strtol>
+  80211b:	89 07                	mov    %eax,(%edi)
+  80211d:	83 c4 10             	add    $0x10,%esp
+  802120:	eb 03                	jmp    802125 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  802122:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  802125:	0f b6 03             	movzbl (%ebx),%eax
+  802128:	3c 20                	cmp    $0x20,%al
+  80212a:	74 f6                	je     802122 <strisl+0x29>
+  80212c:	3c 09                	cmp    $0x9,%al
+  80212e:	74 f2                	je     802122 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  802130:	3c 2b                	cmp    $0x2b,%al
+  802132:	74 23                	je     802157 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  802134:	3c 2d                	cmp    $0x2d,%al
+  802136:	0f 94 c0             	sete   %al
+  802139:	0f b6 c0             	movzbl %al,%eax
+  80213c:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80213e:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  802144:	75 41                	jne    802187 <strisl+0x8e>
+  802146:	80 3b 30             	cmpb   $0x30,(%ebx)
+  802149:	74 11                	je     80215c <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80214b:	85 f6                	test   %esi,%esi
+  80214d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802152:	0f 44 f0             	cmove  %eax,%esi
+  802155:	eb 30                	jmp    802187 <strisl+0x8e>
+		s++;
+  802157:	83 c3 01             	add    $0x1,%ebx
+  80215a:	eb e2                	jmp    80213e <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80215c:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  802160:	74 0e                	je     802170 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  802162:	85 f6                	test   %esi,%esi
+  802164:	75 21                	jne    802187 <strisl+0x8e>
+		s++, base = 8;
+  802166:	83 c3 01             	add    $0x1,%ebx
+  802169:	be 08 00 00 00       	mov    $0x8,%esi
+  80216e:	eb 17                	jmp    802187 <strisl+0x8e>
+		s += 2, base = 16;
+  802170:	83 c3 02             	add    $0x2,%ebx
+  802173:	be 10 00 00 00       	mov    $0x10,%esi
+  802178:	eb 0d                	jmp    802187 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80217a:	0f be c0             	movsbl %al,%eax
+  80217d:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  802180:	39 f0                	cmp    %esi,%eax
+  802182:	7d 38                	jge    8021bc <strisl+0xc3>
+			return 0;
+		s++;
+  802184:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  802187:	0f b6 03             	movzbl (%ebx),%eax
+  80218a:	8d 50 d0             	lea    -0x30(%eax),%edx
+  80218d:	80 fa 09             	cmp    $0x9,%dl
+  802190:	76 e8                	jbe    80217a <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  802192:	8d 50 9f             	lea    -0x61(%eax),%edx
+  802195:	80 fa 19             	cmp    $0x19,%dl
+  802198:	77 08                	ja     8021a2 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  80219a:	0f be c0             	movsbl %al,%eax
+  80219d:	83 e8 57             	sub    $0x57,%eax
+  8021a0:	eb de                	jmp    802180 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  8021a2:	8d 50 bf             	lea    -0x41(%eax),%edx
+  8021a5:	80 fa 19             	cmp    $0x19,%dl
+  8021a8:	77 08                	ja     8021b2 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  8021aa:	0f be c0             	movsbl %al,%eax
+  8021ad:	83 e8 37             	sub    $0x37,%eax
+  8021b0:	eb ce                	jmp    802180 <strisl+0x87>
+		else if (!*s)
+  8021b2:	84 c0                	test   %al,%al
+  8021b4:	0f 94 c0             	sete   %al
+  8021b7:	0f b6 c0             	movzbl %al,%eax
+  8021ba:	eb 05                	jmp    8021c1 <strisl+0xc8>
+			return 0;
+  8021bc:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  8021c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021c4:	5b                   	pop    %ebx
+  8021c5:	5e                   	pop    %esi
+  8021c6:	5f                   	pop    %edi
+  8021c7:	5d                   	pop    %ebp
+  8021c8:	c3                   	ret
+
+008021c9 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8021c9:	55                   	push   %ebp
+  8021ca:	89 e5                	mov    %esp,%ebp
+  8021cc:	57                   	push   %edi
+  8021cd:	56                   	push   %esi
+  8021ce:	53                   	push   %ebx
+  8021cf:	83 ec 14             	sub    $0x14,%esp
+  8021d2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021d5:	8b 75 14             	mov    0x14(%ebp),%esi
+  8021d8:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8021db:	ff 75 10             	push   0x10(%ebp)
+  8021de:	ff 75 0c             	push   0xc(%ebp)
+  8021e1:	e8 c9 e3 ff ff       	call   8005af <sys_ipc_recv_pages>
+  8021e6:	83 c4 10             	add    $0x10,%esp
+  8021e9:	85 c0                	test   %eax,%eax
+  8021eb:	78 46                	js     802233 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8021ed:	85 ff                	test   %edi,%edi
+  8021ef:	74 0d                	je     8021fe <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  8021f1:	a1 08 40 80 00       	mov    0x804008,%eax
+  8021f6:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8021fc:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8021fe:	85 f6                	test   %esi,%esi
+  802200:	74 0d                	je     80220f <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  802202:	a1 08 40 80 00       	mov    0x804008,%eax
+  802207:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80220d:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80220f:	85 db                	test   %ebx,%ebx
+  802211:	74 0d                	je     802220 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  802213:	a1 08 40 80 00       	mov    0x804008,%eax
+  802218:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80221e:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802220:	a1 08 40 80 00       	mov    0x804008,%eax
+  802225:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80222b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80222e:	5b                   	pop    %ebx
+  80222f:	5e                   	pop    %esi
+  802230:	5f                   	pop    %edi
+  802231:	5d                   	pop    %ebp
+  802232:	c3                   	ret
+		if (from_env_store) {
+  802233:	85 ff                	test   %edi,%edi
+  802235:	74 06                	je     80223d <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  802237:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80223d:	85 f6                	test   %esi,%esi
+  80223f:	74 06                	je     802247 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  802241:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802247:	85 db                	test   %ebx,%ebx
+  802249:	74 e0                	je     80222b <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  80224b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802251:	eb d8                	jmp    80222b <ipc_recv_pages+0x62>
+
+00802253 <ipc_recv>:
+{
+  802253:	55                   	push   %ebp
+  802254:	89 e5                	mov    %esp,%ebp
+  802256:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  802259:	6a 00                	push   $0x0
+  80225b:	ff 75 10             	push   0x10(%ebp)
+  80225e:	6a 01                	push   $0x1
+  802260:	ff 75 0c             	push   0xc(%ebp)
+  802263:	ff 75 08             	push   0x8(%ebp)
+  802266:	e8 5e ff ff ff       	call   8021c9 <ipc_recv_pages>
+}
+  80226b:	c9                   	leave
+  80226c:	c3                   	ret
+
+0080226d <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80226d:	55                   	push   %ebp
+  80226e:	89 e5                	mov    %esp,%ebp
+  802270:	56                   	push   %esi
+  802271:	53                   	push   %ebx
+  802272:	8b 75 08             	mov    0x8(%ebp),%esi
+  802275:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  802278:	83 ec 0c             	sub    $0xc,%esp
+  80227b:	ff 75 0c             	push   0xc(%ebp)
+  80227e:	e8 60 e4 ff ff       	call   8006e3 <sys_ipc_try_recv>
+  802283:	83 c4 10             	add    $0x10,%esp
+  802286:	85 c0                	test   %eax,%eax
+  802288:	78 34                	js     8022be <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80228a:	85 f6                	test   %esi,%esi
+  80228c:	74 0d                	je     80229b <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  80228e:	a1 08 40 80 00       	mov    0x804008,%eax
+  802293:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802299:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  80229b:	85 db                	test   %ebx,%ebx
+  80229d:	74 0d                	je     8022ac <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  80229f:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022a4:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8022aa:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8022ac:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022b1:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8022b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022ba:	5b                   	pop    %ebx
+  8022bb:	5e                   	pop    %esi
+  8022bc:	5d                   	pop    %ebp
+  8022bd:	c3                   	ret
+		if (from_env_store) {
+  8022be:	85 f6                	test   %esi,%esi
+  8022c0:	74 06                	je     8022c8 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8022c2:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8022c8:	85 db                	test   %ebx,%ebx
+  8022ca:	74 eb                	je     8022b7 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8022cc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8022d2:	eb e3                	jmp    8022b7 <ipc_try_recv+0x4a>
+
+008022d4 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8022d4:	55                   	push   %ebp
+  8022d5:	89 e5                	mov    %esp,%ebp
+  8022d7:	83 ec 14             	sub    $0x14,%esp
+  8022da:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8022dd:	85 c0                	test   %eax,%eax
+  8022df:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8022e4:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8022e7:	ff 75 18             	push   0x18(%ebp)
+  8022ea:	ff 75 14             	push   0x14(%ebp)
+  8022ed:	50                   	push   %eax
+  8022ee:	ff 75 0c             	push   0xc(%ebp)
+  8022f1:	ff 75 08             	push   0x8(%ebp)
+  8022f4:	e8 79 e2 ff ff       	call   800572 <sys_ipc_send_pages>
+  8022f9:	83 c4 20             	add    $0x20,%esp
+  8022fc:	85 c0                	test   %eax,%eax
+  8022fe:	78 02                	js     802302 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  802300:	c9                   	leave
+  802301:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  802302:	50                   	push   %eax
+  802303:	68 2c 2b 80 00       	push   $0x802b2c
+  802308:	68 80 00 00 00       	push   $0x80
+  80230d:	68 58 2b 80 00       	push   $0x802b58
+  802312:	e8 f0 f3 ff ff       	call   801707 <_panic>
+
+00802317 <ipc_send>:
+{
+  802317:	55                   	push   %ebp
+  802318:	89 e5                	mov    %esp,%ebp
+  80231a:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  80231d:	ff 75 14             	push   0x14(%ebp)
+  802320:	6a 01                	push   $0x1
+  802322:	ff 75 10             	push   0x10(%ebp)
+  802325:	ff 75 0c             	push   0xc(%ebp)
+  802328:	ff 75 08             	push   0x8(%ebp)
+  80232b:	e8 a4 ff ff ff       	call   8022d4 <ipc_send_pages>
+}
+  802330:	83 c4 20             	add    $0x20,%esp
+  802333:	c9                   	leave
+  802334:	c3                   	ret
+
+00802335 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802335:	55                   	push   %ebp
+  802336:	89 e5                	mov    %esp,%ebp
+  802338:	83 ec 14             	sub    $0x14,%esp
+  80233b:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80233e:	85 c0                	test   %eax,%eax
+  802340:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802345:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802348:	ff 75 18             	push   0x18(%ebp)
+  80234b:	ff 75 14             	push   0x14(%ebp)
+  80234e:	50                   	push   %eax
+  80234f:	ff 75 0c             	push   0xc(%ebp)
+  802352:	ff 75 08             	push   0x8(%ebp)
+  802355:	e8 a9 e2 ff ff       	call   800603 <sys_ipc_call>
+  80235a:	83 c4 20             	add    $0x20,%esp
+  80235d:	85 c0                	test   %eax,%eax
+  80235f:	78 0b                	js     80236c <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  802361:	a1 08 40 80 00       	mov    0x804008,%eax
+  802366:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80236c:	c9                   	leave
+  80236d:	c3                   	ret
+
+0080236e <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  80236e:	55                   	push   %ebp
+  80236f:	89 e5                	mov    %esp,%ebp
+  802371:	57                   	push   %edi
+  802372:	56                   	push   %esi
+  802373:	53                   	push   %ebx
+  802374:	83 ec 18             	sub    $0x18,%esp
+  802377:	8b 45 10             	mov    0x10(%ebp),%eax
+  80237a:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  80237d:	8b 75 20             	mov    0x20(%ebp),%esi
+  802380:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802383:	85 c0                	test   %eax,%eax
+  802385:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80238a:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80238d:	ff 75 18             	push   0x18(%ebp)
+  802390:	ff 75 14             	push   0x14(%ebp)
+  802393:	50                   	push   %eax
+  802394:	ff 75 0c             	push   0xc(%ebp)
+  802397:	ff 75 08             	push   0x8(%ebp)
+  80239a:	e8 a5 e2 ff ff       	call   800644 <sys_ipc_reply_recv>
+  80239f:	83 c4 20             	add    $0x20,%esp
+  8023a2:	85 c0                	test   %eax,%eax
+  8023a4:	78 46                	js     8023ec <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8023a6:	85 ff                	test   %edi,%edi
+  8023a8:	74 0d                	je     8023b7 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8023aa:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023af:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8023b5:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8023b7:	85 f6                	test   %esi,%esi
+  8023b9:	74 0d                	je     8023c8 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8023bb:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023c0:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8023c6:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8023c8:	85 db                	test   %ebx,%ebx
+  8023ca:	74 0d                	je     8023d9 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8023cc:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023d1:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8023d7:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8023d9:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023de:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8023e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023e7:	5b                   	pop    %ebx
+  8023e8:	5e                   	pop    %esi
+  8023e9:	5f                   	pop    %edi
+  8023ea:	5d                   	pop    %ebp
+  8023eb:	c3                   	ret
+		if (from_env_store) {
+  8023ec:	85 ff                	test   %edi,%edi
+  8023ee:	74 06                	je     8023f6 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  8023f0:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8023f6:	85 f6                	test   %esi,%esi
+  8023f8:	74 06                	je     802400 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  8023fa:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802400:	85 db                	test   %ebx,%ebx
+  802402:	74 e0                	je     8023e4 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  802404:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80240a:	eb d8                	jmp    8023e4 <ipc_reply_recv+0x76>
+
+0080240c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80240c:	55                   	push   %ebp
+  80240d:	89 e5                	mov    %esp,%ebp
+  80240f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802412:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  802417:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80241a:	c1 e0 06             	shl    $0x6,%eax
+  80241d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802422:	8b 40 50             	mov    0x50(%eax),%eax
+  802425:	39 c8                	cmp    %ecx,%eax
+  802427:	74 12                	je     80243b <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802429:	83 c2 01             	add    $0x1,%edx
+  80242c:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802432:	75 e3                	jne    802417 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802434:	b8 00 00 00 00       	mov    $0x0,%eax
+  802439:	eb 0e                	jmp    802449 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80243b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80243e:	c1 e0 06             	shl    $0x6,%eax
+  802441:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802446:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802449:	5d                   	pop    %ebp
+  80244a:	c3                   	ret
+
+0080244b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80244b:	55                   	push   %ebp
+  80244c:	89 e5                	mov    %esp,%ebp
+  80244e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802451:	89 c2                	mov    %eax,%edx
+  802453:	c1 ea 16             	shr    $0x16,%edx
+  802456:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80245d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802462:	f6 c1 01             	test   $0x1,%cl
+  802465:	74 1e                	je     802485 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  802467:	c1 e8 0c             	shr    $0xc,%eax
+  80246a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802471:	a8 01                	test   $0x1,%al
+  802473:	74 10                	je     802485 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802475:	c1 e8 0c             	shr    $0xc,%eax
+  802478:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80247b:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  802482:	0f b7 d2             	movzwl %dx,%edx
+}
+  802485:	89 d0                	mov    %edx,%eax
+  802487:	5d                   	pop    %ebp
+  802488:	c3                   	ret
+
+00802489 <udivmod>:
+  802489:	55                   	push   %ebp
+  80248a:	57                   	push   %edi
+  80248b:	56                   	push   %esi
+  80248c:	53                   	push   %ebx
+  80248d:	83 ec 24             	sub    $0x24,%esp
+  802490:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802494:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802498:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80249c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8024a0:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8024a4:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8024a8:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8024ac:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8024b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024bb:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8024c2:	00 
+  8024c3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8024ca:	00 
+  8024cb:	89 fb                	mov    %edi,%ebx
+  8024cd:	eb 08                	jmp    8024d7 <udivmod+0x4e>
+  8024cf:	83 e9 01             	sub    $0x1,%ecx
+  8024d2:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8024d5:	74 68                	je     80253f <udivmod+0xb6>
+  8024d7:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8024db:	01 c0                	add    %eax,%eax
+  8024dd:	89 c6                	mov    %eax,%esi
+  8024df:	89 d7                	mov    %edx,%edi
+  8024e1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8024e5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8024e9:	0f ad d0             	shrd   %cl,%edx,%eax
+  8024ec:	d3 ea                	shr    %cl,%edx
+  8024ee:	f6 c1 20             	test   $0x20,%cl
+  8024f1:	74 04                	je     8024f7 <udivmod+0x6e>
+  8024f3:	89 d0                	mov    %edx,%eax
+  8024f5:	31 d2                	xor    %edx,%edx
+  8024f7:	83 e0 01             	and    $0x1,%eax
+  8024fa:	89 04 24             	mov    %eax,(%esp)
+  8024fd:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802504:	00 
+  802505:	8b 04 24             	mov    (%esp),%eax
+  802508:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80250c:	09 f0                	or     %esi,%eax
+  80250e:	09 fa                	or     %edi,%edx
+  802510:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802514:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802518:	39 f0                	cmp    %esi,%eax
+  80251a:	89 d5                	mov    %edx,%ebp
+  80251c:	19 fd                	sbb    %edi,%ebp
+  80251e:	72 af                	jb     8024cf <udivmod+0x46>
+  802520:	29 f0                	sub    %esi,%eax
+  802522:	19 fa                	sbb    %edi,%edx
+  802524:	89 cf                	mov    %ecx,%edi
+  802526:	c1 ef 05             	shr    $0x5,%edi
+  802529:	83 e7 01             	and    $0x1,%edi
+  80252c:	89 fe                	mov    %edi,%esi
+  80252e:	83 f6 01             	xor    $0x1,%esi
+  802531:	d3 e6                	shl    %cl,%esi
+  802533:	d3 e7                	shl    %cl,%edi
+  802535:	09 74 24 18          	or     %esi,0x18(%esp)
+  802539:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80253d:	eb 90                	jmp    8024cf <udivmod+0x46>
+  80253f:	85 db                	test   %ebx,%ebx
+  802541:	74 05                	je     802548 <udivmod+0xbf>
+  802543:	89 03                	mov    %eax,(%ebx)
+  802545:	89 53 04             	mov    %edx,0x4(%ebx)
+  802548:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80254c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802550:	83 c4 24             	add    $0x24,%esp
+  802553:	5b                   	pop    %ebx
+  802554:	5e                   	pop    %esi
+  802555:	5f                   	pop    %edi
+  802556:	5d                   	pop    %ebp
+  802557:	c3                   	ret
+
+00802558 <__udivdi3>:
+  802558:	83 ec 08             	sub    $0x8,%esp
+  80255b:	6a 00                	push   $0x0
+  80255d:	ff 74 24 1c          	push   0x1c(%esp)
+  802561:	ff 74 24 1c          	push   0x1c(%esp)
+  802565:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802569:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80256d:	e8 17 ff ff ff       	call   802489 <udivmod>
+  802572:	83 c4 14             	add    $0x14,%esp
+  802575:	c3                   	ret
+
+00802576 <__umoddi3>:
+  802576:	83 ec 18             	sub    $0x18,%esp
+  802579:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80257d:	50                   	push   %eax
+  80257e:	ff 74 24 2c          	push   0x2c(%esp)
+  802582:	ff 74 24 2c          	push   0x2c(%esp)
+  802586:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80258a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80258e:	e8 f6 fe ff ff       	call   802489 <udivmod>
+  802593:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802597:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80259b:	83 c4 24             	add    $0x24,%esp
+  80259e:	c3                   	ret
+
+0080259f <__divdi3>:
+  80259f:	55                   	push   %ebp
+  8025a0:	57                   	push   %edi
+  8025a1:	56                   	push   %esi
+  8025a2:	53                   	push   %ebx
+  8025a3:	83 ec 10             	sub    $0x10,%esp
+  8025a6:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8025aa:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8025ae:	89 c6                	mov    %eax,%esi
+  8025b0:	89 d7                	mov    %edx,%edi
+  8025b2:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8025b6:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8025ba:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8025be:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8025c2:	89 c5                	mov    %eax,%ebp
+  8025c4:	f7 dd                	neg    %ebp
+  8025c6:	89 d6                	mov    %edx,%esi
+  8025c8:	83 d6 00             	adc    $0x0,%esi
+  8025cb:	f7 de                	neg    %esi
+  8025cd:	0f 48 e8             	cmovs  %eax,%ebp
+  8025d0:	0f 49 d6             	cmovns %esi,%edx
+  8025d3:	6a 00                	push   $0x0
+  8025d5:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8025d9:	f7 de                	neg    %esi
+  8025db:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8025df:	83 d0 00             	adc    $0x0,%eax
+  8025e2:	f7 d8                	neg    %eax
+  8025e4:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  8025e9:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  8025ee:	50                   	push   %eax
+  8025ef:	56                   	push   %esi
+  8025f0:	89 e8                	mov    %ebp,%eax
+  8025f2:	e8 92 fe ff ff       	call   802489 <udivmod>
+  8025f7:	83 c4 10             	add    $0x10,%esp
+  8025fa:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  8025ff:	78 08                	js     802609 <__divdi3+0x6a>
+  802601:	83 c4 0c             	add    $0xc,%esp
+  802604:	5b                   	pop    %ebx
+  802605:	5e                   	pop    %esi
+  802606:	5f                   	pop    %edi
+  802607:	5d                   	pop    %ebp
+  802608:	c3                   	ret
+  802609:	f7 d8                	neg    %eax
+  80260b:	83 d2 00             	adc    $0x0,%edx
+  80260e:	f7 da                	neg    %edx
+  802610:	eb ef                	jmp    802601 <__divdi3+0x62>
+
+00802612 <__moddi3>:
+  802612:	55                   	push   %ebp
+  802613:	57                   	push   %edi
+  802614:	56                   	push   %esi
+  802615:	53                   	push   %ebx
+  802616:	83 ec 18             	sub    $0x18,%esp
+  802619:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80261d:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802621:	89 f1                	mov    %esi,%ecx
+  802623:	f7 d9                	neg    %ecx
+  802625:	89 da                	mov    %ebx,%edx
+  802627:	83 d2 00             	adc    $0x0,%edx
+  80262a:	f7 da                	neg    %edx
+  80262c:	0f 48 ce             	cmovs  %esi,%ecx
+  80262f:	0f 48 d3             	cmovs  %ebx,%edx
+  802632:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802636:	50                   	push   %eax
+  802637:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80263b:	f7 de                	neg    %esi
+  80263d:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802641:	83 d0 00             	adc    $0x0,%eax
+  802644:	f7 d8                	neg    %eax
+  802646:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80264b:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802650:	50                   	push   %eax
+  802651:	56                   	push   %esi
+  802652:	89 c8                	mov    %ecx,%eax
+  802654:	e8 30 fe ff ff       	call   802489 <udivmod>
+  802659:	83 c4 10             	add    $0x10,%esp
+  80265c:	85 db                	test   %ebx,%ebx
+  80265e:	78 10                	js     802670 <__moddi3+0x5e>
+  802660:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802664:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802668:	83 c4 14             	add    $0x14,%esp
+  80266b:	5b                   	pop    %ebx
+  80266c:	5e                   	pop    %esi
+  80266d:	5f                   	pop    %edi
+  80266e:	5d                   	pop    %ebp
+  80266f:	c3                   	ret
+  802670:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802674:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802678:	f7 d8                	neg    %eax
+  80267a:	83 d2 00             	adc    $0x0,%edx
+  80267d:	f7 da                	neg    %edx
+  80267f:	eb e7                	jmp    802668 <__moddi3+0x56>
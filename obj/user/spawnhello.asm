@@ -0,0 +1,6245 @@
+
+obj/user/spawnhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4a 00 00 00       	call   80007b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	int r;
+	cprintf("i am parent environment %08x\n", thisenv->env_id);
+  800039:	a1 08 50 80 00       	mov    0x805008,%eax
+  80003e:	8b 40 48             	mov    0x48(%eax),%eax
+  800041:	50                   	push   %eax
+  800042:	68 a0 2d 80 00       	push   $0x802da0
+  800047:	e8 6d 01 00 00       	call   8001b9 <cprintf>
+	if ((r = spawnl("hello", "hello", 0)) < 0)
+  80004c:	83 c4 0c             	add    $0xc,%esp
+  80004f:	6a 00                	push   $0x0
+  800051:	68 be 2d 80 00       	push   $0x802dbe
+  800056:	68 be 2d 80 00       	push   $0x802dbe
+  80005b:	e8 ad 21 00 00       	call   80220d <spawnl>
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	85 c0                	test   %eax,%eax
+  800065:	78 02                	js     800069 <umain+0x36>
+		panic("spawn(hello) failed: %e", r);
+}
+  800067:	c9                   	leave
+  800068:	c3                   	ret
+		panic("spawn(hello) failed: %e", r);
+  800069:	50                   	push   %eax
+  80006a:	68 c4 2d 80 00       	push   $0x802dc4
+  80006f:	6a 09                	push   $0x9
+  800071:	68 dc 2d 80 00       	push   $0x802ddc
+  800076:	e8 63 00 00 00       	call   8000de <_panic>
+
+0080007b <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80007b:	55                   	push   %ebp
+  80007c:	89 e5                	mov    %esp,%ebp
+  80007e:	56                   	push   %esi
+  80007f:	53                   	push   %ebx
+  800080:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800083:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800086:	e8 ca 0b 00 00       	call   800c55 <sys_getenvid>
+  80008b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800090:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800093:	c1 e0 06             	shl    $0x6,%eax
+  800096:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80009b:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000a0:	85 db                	test   %ebx,%ebx
+  8000a2:	7e 07                	jle    8000ab <libmain+0x30>
+		binaryname = argv[0];
+  8000a4:	8b 06                	mov    (%esi),%eax
+  8000a6:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000ab:	83 ec 08             	sub    $0x8,%esp
+  8000ae:	56                   	push   %esi
+  8000af:	53                   	push   %ebx
+  8000b0:	e8 7e ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000b5:	e8 0a 00 00 00       	call   8000c4 <exit>
+}
+  8000ba:	83 c4 10             	add    $0x10,%esp
+  8000bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000c0:	5b                   	pop    %ebx
+  8000c1:	5e                   	pop    %esi
+  8000c2:	5d                   	pop    %ebp
+  8000c3:	c3                   	ret
+
+008000c4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000c4:	55                   	push   %ebp
+  8000c5:	89 e5                	mov    %esp,%ebp
+  8000c7:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000ca:	e8 2a 13 00 00       	call   8013f9 <close_all>
+	sys_env_destroy(0);
+  8000cf:	83 ec 0c             	sub    $0xc,%esp
+  8000d2:	6a 00                	push   $0x0
+  8000d4:	e8 3b 0b 00 00       	call   800c14 <sys_env_destroy>
+}
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	c9                   	leave
+  8000dd:	c3                   	ret
+
+008000de <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8000de:	55                   	push   %ebp
+  8000df:	89 e5                	mov    %esp,%ebp
+  8000e1:	56                   	push   %esi
+  8000e2:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8000e3:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8000e6:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8000ec:	e8 64 0b 00 00       	call   800c55 <sys_getenvid>
+  8000f1:	83 ec 0c             	sub    $0xc,%esp
+  8000f4:	ff 75 0c             	push   0xc(%ebp)
+  8000f7:	ff 75 08             	push   0x8(%ebp)
+  8000fa:	56                   	push   %esi
+  8000fb:	50                   	push   %eax
+  8000fc:	68 f8 2d 80 00       	push   $0x802df8
+  800101:	e8 b3 00 00 00       	call   8001b9 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800106:	83 c4 18             	add    $0x18,%esp
+  800109:	53                   	push   %ebx
+  80010a:	ff 75 10             	push   0x10(%ebp)
+  80010d:	e8 56 00 00 00       	call   800168 <vcprintf>
+	cprintf("\n");
+  800112:	c7 04 24 0a 33 80 00 	movl   $0x80330a,(%esp)
+  800119:	e8 9b 00 00 00       	call   8001b9 <cprintf>
+  80011e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800121:	cc                   	int3
+	while (1)
+  800122:	eb fd                	jmp    800121 <_panic+0x43>
+
+00800124 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800124:	55                   	push   %ebp
+  800125:	89 e5                	mov    %esp,%ebp
+  800127:	53                   	push   %ebx
+  800128:	83 ec 04             	sub    $0x4,%esp
+  80012b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80012e:	8b 13                	mov    (%ebx),%edx
+  800130:	8d 42 01             	lea    0x1(%edx),%eax
+  800133:	89 03                	mov    %eax,(%ebx)
+  800135:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800138:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80013c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800141:	74 09                	je     80014c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800143:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800147:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80014a:	c9                   	leave
+  80014b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80014c:	83 ec 08             	sub    $0x8,%esp
+  80014f:	68 ff 00 00 00       	push   $0xff
+  800154:	8d 43 08             	lea    0x8(%ebx),%eax
+  800157:	50                   	push   %eax
+  800158:	e8 69 0a 00 00       	call   800bc6 <sys_cputs>
+		b->idx = 0;
+  80015d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800163:	83 c4 10             	add    $0x10,%esp
+  800166:	eb db                	jmp    800143 <putch+0x1f>
+
+00800168 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800168:	55                   	push   %ebp
+  800169:	89 e5                	mov    %esp,%ebp
+  80016b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800171:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800178:	00 00 00 
+	b.cnt = 0;
+  80017b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800182:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800185:	ff 75 0c             	push   0xc(%ebp)
+  800188:	ff 75 08             	push   0x8(%ebp)
+  80018b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800191:	50                   	push   %eax
+  800192:	68 24 01 80 00       	push   $0x800124
+  800197:	e8 14 01 00 00       	call   8002b0 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80019c:	83 c4 08             	add    $0x8,%esp
+  80019f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001a5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001ab:	50                   	push   %eax
+  8001ac:	e8 15 0a 00 00       	call   800bc6 <sys_cputs>
+
+	return b.cnt;
+}
+  8001b1:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001b7:	c9                   	leave
+  8001b8:	c3                   	ret
+
+008001b9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001b9:	55                   	push   %ebp
+  8001ba:	89 e5                	mov    %esp,%ebp
+  8001bc:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001bf:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001c2:	50                   	push   %eax
+  8001c3:	ff 75 08             	push   0x8(%ebp)
+  8001c6:	e8 9d ff ff ff       	call   800168 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001cb:	c9                   	leave
+  8001cc:	c3                   	ret
+
+008001cd <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001cd:	55                   	push   %ebp
+  8001ce:	89 e5                	mov    %esp,%ebp
+  8001d0:	57                   	push   %edi
+  8001d1:	56                   	push   %esi
+  8001d2:	53                   	push   %ebx
+  8001d3:	83 ec 1c             	sub    $0x1c,%esp
+  8001d6:	89 c7                	mov    %eax,%edi
+  8001d8:	89 d6                	mov    %edx,%esi
+  8001da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001e0:	89 d1                	mov    %edx,%ecx
+  8001e2:	89 c2                	mov    %eax,%edx
+  8001e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001e7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001ea:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001ed:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001f3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001fa:	39 c2                	cmp    %eax,%edx
+  8001fc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001ff:	72 3e                	jb     80023f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800201:	83 ec 0c             	sub    $0xc,%esp
+  800204:	ff 75 18             	push   0x18(%ebp)
+  800207:	83 eb 01             	sub    $0x1,%ebx
+  80020a:	53                   	push   %ebx
+  80020b:	50                   	push   %eax
+  80020c:	83 ec 08             	sub    $0x8,%esp
+  80020f:	ff 75 e4             	push   -0x1c(%ebp)
+  800212:	ff 75 e0             	push   -0x20(%ebp)
+  800215:	ff 75 dc             	push   -0x24(%ebp)
+  800218:	ff 75 d8             	push   -0x28(%ebp)
+  80021b:	e8 53 2a 00 00       	call   802c73 <__udivdi3>
+  800220:	83 c4 18             	add    $0x18,%esp
+  800223:	52                   	push   %edx
+  800224:	50                   	push   %eax
+  800225:	89 f2                	mov    %esi,%edx
+  800227:	89 f8                	mov    %edi,%eax
+  800229:	e8 9f ff ff ff       	call   8001cd <printnum>
+  80022e:	83 c4 20             	add    $0x20,%esp
+  800231:	eb 13                	jmp    800246 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800233:	83 ec 08             	sub    $0x8,%esp
+  800236:	56                   	push   %esi
+  800237:	ff 75 18             	push   0x18(%ebp)
+  80023a:	ff d7                	call   *%edi
+  80023c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80023f:	83 eb 01             	sub    $0x1,%ebx
+  800242:	85 db                	test   %ebx,%ebx
+  800244:	7f ed                	jg     800233 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800246:	83 ec 08             	sub    $0x8,%esp
+  800249:	56                   	push   %esi
+  80024a:	83 ec 04             	sub    $0x4,%esp
+  80024d:	ff 75 e4             	push   -0x1c(%ebp)
+  800250:	ff 75 e0             	push   -0x20(%ebp)
+  800253:	ff 75 dc             	push   -0x24(%ebp)
+  800256:	ff 75 d8             	push   -0x28(%ebp)
+  800259:	e8 33 2a 00 00       	call   802c91 <__umoddi3>
+  80025e:	83 c4 14             	add    $0x14,%esp
+  800261:	0f be 80 1b 2e 80 00 	movsbl 0x802e1b(%eax),%eax
+  800268:	50                   	push   %eax
+  800269:	ff d7                	call   *%edi
+}
+  80026b:	83 c4 10             	add    $0x10,%esp
+  80026e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800271:	5b                   	pop    %ebx
+  800272:	5e                   	pop    %esi
+  800273:	5f                   	pop    %edi
+  800274:	5d                   	pop    %ebp
+  800275:	c3                   	ret
+
+00800276 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800276:	55                   	push   %ebp
+  800277:	89 e5                	mov    %esp,%ebp
+  800279:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80027c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800280:	8b 10                	mov    (%eax),%edx
+  800282:	3b 50 04             	cmp    0x4(%eax),%edx
+  800285:	73 0a                	jae    800291 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800287:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80028a:	89 08                	mov    %ecx,(%eax)
+  80028c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028f:	88 02                	mov    %al,(%edx)
+}
+  800291:	5d                   	pop    %ebp
+  800292:	c3                   	ret
+
+00800293 <printfmt>:
+{
+  800293:	55                   	push   %ebp
+  800294:	89 e5                	mov    %esp,%ebp
+  800296:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800299:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80029c:	50                   	push   %eax
+  80029d:	ff 75 10             	push   0x10(%ebp)
+  8002a0:	ff 75 0c             	push   0xc(%ebp)
+  8002a3:	ff 75 08             	push   0x8(%ebp)
+  8002a6:	e8 05 00 00 00       	call   8002b0 <vprintfmt>
+}
+  8002ab:	83 c4 10             	add    $0x10,%esp
+  8002ae:	c9                   	leave
+  8002af:	c3                   	ret
+
+008002b0 <vprintfmt>:
+{
+  8002b0:	55                   	push   %ebp
+  8002b1:	89 e5                	mov    %esp,%ebp
+  8002b3:	57                   	push   %edi
+  8002b4:	56                   	push   %esi
+  8002b5:	53                   	push   %ebx
+  8002b6:	83 ec 2c             	sub    $0x2c,%esp
+  8002b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002bf:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002c2:	eb 0a                	jmp    8002ce <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002c4:	83 ec 08             	sub    $0x8,%esp
+  8002c7:	53                   	push   %ebx
+  8002c8:	50                   	push   %eax
+  8002c9:	ff d6                	call   *%esi
+  8002cb:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002ce:	83 c7 01             	add    $0x1,%edi
+  8002d1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002d5:	83 f8 25             	cmp    $0x25,%eax
+  8002d8:	74 0c                	je     8002e6 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002da:	85 c0                	test   %eax,%eax
+  8002dc:	75 e6                	jne    8002c4 <vprintfmt+0x14>
+}
+  8002de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e1:	5b                   	pop    %ebx
+  8002e2:	5e                   	pop    %esi
+  8002e3:	5f                   	pop    %edi
+  8002e4:	5d                   	pop    %ebp
+  8002e5:	c3                   	ret
+		padc = ' ';
+  8002e6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002ea:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002f1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002f8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800304:	8d 47 01             	lea    0x1(%edi),%eax
+  800307:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80030a:	0f b6 17             	movzbl (%edi),%edx
+  80030d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800310:	3c 55                	cmp    $0x55,%al
+  800312:	0f 87 c5 03 00 00    	ja     8006dd <vprintfmt+0x42d>
+  800318:	0f b6 c0             	movzbl %al,%eax
+  80031b:	ff 24 85 a0 2f 80 00 	jmp    *0x802fa0(,%eax,4)
+  800322:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800325:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800329:	eb d9                	jmp    800304 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80032b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80032e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800332:	eb d0                	jmp    800304 <vprintfmt+0x54>
+  800334:	0f b6 d2             	movzbl %dl,%edx
+  800337:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80033a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800342:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800345:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800349:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80034c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80034f:	83 f9 09             	cmp    $0x9,%ecx
+  800352:	77 55                	ja     8003a9 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800354:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800357:	eb e9                	jmp    800342 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800359:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035c:	8b 00                	mov    (%eax),%eax
+  80035e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800361:	8b 45 14             	mov    0x14(%ebp),%eax
+  800364:	8d 40 04             	lea    0x4(%eax),%eax
+  800367:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80036a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80036d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800371:	79 91                	jns    800304 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800373:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800376:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800379:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800380:	eb 82                	jmp    800304 <vprintfmt+0x54>
+			if (width < 0)
+  800382:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800385:	85 d2                	test   %edx,%edx
+  800387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038c:	0f 49 c2             	cmovns %edx,%eax
+  80038f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800392:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800395:	e9 6a ff ff ff       	jmp    800304 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80039a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80039d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003a4:	e9 5b ff ff ff       	jmp    800304 <vprintfmt+0x54>
+  8003a9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003af:	eb bc                	jmp    80036d <vprintfmt+0xbd>
+			lflag++;
+  8003b1:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003b7:	e9 48 ff ff ff       	jmp    800304 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bf:	8d 78 04             	lea    0x4(%eax),%edi
+  8003c2:	83 ec 08             	sub    $0x8,%esp
+  8003c5:	53                   	push   %ebx
+  8003c6:	ff 30                	push   (%eax)
+  8003c8:	ff d6                	call   *%esi
+			break;
+  8003ca:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003cd:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003d0:	e9 63 02 00 00       	jmp    800638 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8003d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d8:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003db:	8b 10                	mov    (%eax),%edx
+  8003dd:	89 d0                	mov    %edx,%eax
+  8003df:	f7 d8                	neg    %eax
+  8003e1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003e4:	83 f8 12             	cmp    $0x12,%eax
+  8003e7:	7f 23                	jg     80040c <vprintfmt+0x15c>
+  8003e9:	8b 14 85 00 31 80 00 	mov    0x803100(,%eax,4),%edx
+  8003f0:	85 d2                	test   %edx,%edx
+  8003f2:	74 18                	je     80040c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003f4:	52                   	push   %edx
+  8003f5:	68 3d 32 80 00       	push   $0x80323d
+  8003fa:	53                   	push   %ebx
+  8003fb:	56                   	push   %esi
+  8003fc:	e8 92 fe ff ff       	call   800293 <printfmt>
+  800401:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800404:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800407:	e9 2c 02 00 00       	jmp    800638 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80040c:	50                   	push   %eax
+  80040d:	68 33 2e 80 00       	push   $0x802e33
+  800412:	53                   	push   %ebx
+  800413:	56                   	push   %esi
+  800414:	e8 7a fe ff ff       	call   800293 <printfmt>
+  800419:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80041c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80041f:	e9 14 02 00 00       	jmp    800638 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800424:	8b 45 14             	mov    0x14(%ebp),%eax
+  800427:	83 c0 04             	add    $0x4,%eax
+  80042a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80042d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800430:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800432:	85 c9                	test   %ecx,%ecx
+  800434:	b8 2c 2e 80 00       	mov    $0x802e2c,%eax
+  800439:	0f 45 c1             	cmovne %ecx,%eax
+  80043c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80043f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800443:	7e 06                	jle    80044b <vprintfmt+0x19b>
+  800445:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800449:	75 0b                	jne    800456 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80044b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80044e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800451:	89 75 08             	mov    %esi,0x8(%ebp)
+  800454:	eb 5c                	jmp    8004b2 <vprintfmt+0x202>
+  800456:	83 ec 08             	sub    $0x8,%esp
+  800459:	ff 75 d0             	push   -0x30(%ebp)
+  80045c:	ff 75 cc             	push   -0x34(%ebp)
+  80045f:	e8 19 03 00 00       	call   80077d <strnlen>
+  800464:	89 c2                	mov    %eax,%edx
+  800466:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800469:	29 d0                	sub    %edx,%eax
+  80046b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80046e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800472:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800475:	89 75 08             	mov    %esi,0x8(%ebp)
+  800478:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80047a:	eb 0e                	jmp    80048a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80047c:	83 ec 08             	sub    $0x8,%esp
+  80047f:	53                   	push   %ebx
+  800480:	57                   	push   %edi
+  800481:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800484:	83 ee 01             	sub    $0x1,%esi
+  800487:	83 c4 10             	add    $0x10,%esp
+  80048a:	85 f6                	test   %esi,%esi
+  80048c:	7f ee                	jg     80047c <vprintfmt+0x1cc>
+  80048e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800491:	8b 75 08             	mov    0x8(%ebp),%esi
+  800494:	85 c0                	test   %eax,%eax
+  800496:	ba 00 00 00 00       	mov    $0x0,%edx
+  80049b:	0f 49 d0             	cmovns %eax,%edx
+  80049e:	29 d0                	sub    %edx,%eax
+  8004a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004a3:	eb a6                	jmp    80044b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004a5:	83 ec 08             	sub    $0x8,%esp
+  8004a8:	53                   	push   %ebx
+  8004a9:	52                   	push   %edx
+  8004aa:	ff 55 08             	call   *0x8(%ebp)
+  8004ad:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004b0:	89 f1                	mov    %esi,%ecx
+  8004b2:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004b5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004b9:	0f be d0             	movsbl %al,%edx
+  8004bc:	85 d2                	test   %edx,%edx
+  8004be:	74 28                	je     8004e8 <vprintfmt+0x238>
+  8004c0:	85 ff                	test   %edi,%edi
+  8004c2:	78 05                	js     8004c9 <vprintfmt+0x219>
+  8004c4:	83 ef 01             	sub    $0x1,%edi
+  8004c7:	78 30                	js     8004f9 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004c9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004cd:	74 d6                	je     8004a5 <vprintfmt+0x1f5>
+  8004cf:	0f be c0             	movsbl %al,%eax
+  8004d2:	83 e8 20             	sub    $0x20,%eax
+  8004d5:	83 f8 5e             	cmp    $0x5e,%eax
+  8004d8:	76 cb                	jbe    8004a5 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004da:	83 ec 08             	sub    $0x8,%esp
+  8004dd:	53                   	push   %ebx
+  8004de:	6a 3f                	push   $0x3f
+  8004e0:	ff 55 08             	call   *0x8(%ebp)
+  8004e3:	83 c4 10             	add    $0x10,%esp
+  8004e6:	eb c8                	jmp    8004b0 <vprintfmt+0x200>
+  8004e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004eb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ee:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004f1:	01 d0                	add    %edx,%eax
+  8004f3:	29 c8                	sub    %ecx,%eax
+  8004f5:	89 c7                	mov    %eax,%edi
+  8004f7:	eb 13                	jmp    80050c <vprintfmt+0x25c>
+  8004f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004fc:	eb ed                	jmp    8004eb <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004fe:	83 ec 08             	sub    $0x8,%esp
+  800501:	53                   	push   %ebx
+  800502:	6a 20                	push   $0x20
+  800504:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800506:	83 ef 01             	sub    $0x1,%edi
+  800509:	83 c4 10             	add    $0x10,%esp
+  80050c:	85 ff                	test   %edi,%edi
+  80050e:	7f ee                	jg     8004fe <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800510:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800513:	89 45 14             	mov    %eax,0x14(%ebp)
+  800516:	e9 1d 01 00 00       	jmp    800638 <vprintfmt+0x388>
+	if (lflag >= 2)
+  80051b:	83 f9 01             	cmp    $0x1,%ecx
+  80051e:	7f 1b                	jg     80053b <vprintfmt+0x28b>
+	else if (lflag)
+  800520:	85 c9                	test   %ecx,%ecx
+  800522:	74 63                	je     800587 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800524:	8b 45 14             	mov    0x14(%ebp),%eax
+  800527:	8b 00                	mov    (%eax),%eax
+  800529:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052c:	99                   	cltd
+  80052d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800530:	8b 45 14             	mov    0x14(%ebp),%eax
+  800533:	8d 40 04             	lea    0x4(%eax),%eax
+  800536:	89 45 14             	mov    %eax,0x14(%ebp)
+  800539:	eb 17                	jmp    800552 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80053b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053e:	8b 50 04             	mov    0x4(%eax),%edx
+  800541:	8b 00                	mov    (%eax),%eax
+  800543:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800546:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800549:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054c:	8d 40 08             	lea    0x8(%eax),%eax
+  80054f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800552:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800555:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800558:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80055d:	85 c9                	test   %ecx,%ecx
+  80055f:	0f 89 b9 00 00 00    	jns    80061e <vprintfmt+0x36e>
+				putch('-', putdat);
+  800565:	83 ec 08             	sub    $0x8,%esp
+  800568:	53                   	push   %ebx
+  800569:	6a 2d                	push   $0x2d
+  80056b:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80056d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800570:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800573:	f7 da                	neg    %edx
+  800575:	83 d1 00             	adc    $0x0,%ecx
+  800578:	f7 d9                	neg    %ecx
+  80057a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80057d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800582:	e9 97 00 00 00       	jmp    80061e <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800587:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058a:	8b 00                	mov    (%eax),%eax
+  80058c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80058f:	99                   	cltd
+  800590:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800593:	8b 45 14             	mov    0x14(%ebp),%eax
+  800596:	8d 40 04             	lea    0x4(%eax),%eax
+  800599:	89 45 14             	mov    %eax,0x14(%ebp)
+  80059c:	eb b4                	jmp    800552 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  80059e:	83 f9 01             	cmp    $0x1,%ecx
+  8005a1:	7f 1b                	jg     8005be <vprintfmt+0x30e>
+	else if (lflag)
+  8005a3:	85 c9                	test   %ecx,%ecx
+  8005a5:	74 2c                	je     8005d3 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8005a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005aa:	8b 10                	mov    (%eax),%edx
+  8005ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005b7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005bc:	eb 60                	jmp    80061e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8005be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c1:	8b 10                	mov    (%eax),%edx
+  8005c3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005c6:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005cc:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005d1:	eb 4b                	jmp    80061e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8005d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d6:	8b 10                	mov    (%eax),%edx
+  8005d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005e3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005e8:	eb 34                	jmp    80061e <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8005ea:	83 f9 01             	cmp    $0x1,%ecx
+  8005ed:	7f 15                	jg     800604 <vprintfmt+0x354>
+	else if (lflag)
+  8005ef:	85 c9                	test   %ecx,%ecx
+  8005f1:	74 4d                	je     800640 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8005f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f6:	8b 00                	mov    (%eax),%eax
+  8005f8:	99                   	cltd
+  8005f9:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005fc:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8005ff:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800602:	eb 11                	jmp    800615 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800604:	8b 45 14             	mov    0x14(%ebp),%eax
+  800607:	8b 50 04             	mov    0x4(%eax),%edx
+  80060a:	8b 00                	mov    (%eax),%eax
+  80060c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80060f:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800612:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800615:	89 d1                	mov    %edx,%ecx
+  800617:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800619:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80061e:	83 ec 0c             	sub    $0xc,%esp
+  800621:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800625:	50                   	push   %eax
+  800626:	ff 75 e0             	push   -0x20(%ebp)
+  800629:	57                   	push   %edi
+  80062a:	51                   	push   %ecx
+  80062b:	52                   	push   %edx
+  80062c:	89 da                	mov    %ebx,%edx
+  80062e:	89 f0                	mov    %esi,%eax
+  800630:	e8 98 fb ff ff       	call   8001cd <printnum>
+			break;
+  800635:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800638:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80063b:	e9 8e fc ff ff       	jmp    8002ce <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800640:	8b 45 14             	mov    0x14(%ebp),%eax
+  800643:	8b 00                	mov    (%eax),%eax
+  800645:	99                   	cltd
+  800646:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800649:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80064c:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80064f:	eb c4                	jmp    800615 <vprintfmt+0x365>
+			putch('0', putdat);
+  800651:	83 ec 08             	sub    $0x8,%esp
+  800654:	53                   	push   %ebx
+  800655:	6a 30                	push   $0x30
+  800657:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800659:	83 c4 08             	add    $0x8,%esp
+  80065c:	53                   	push   %ebx
+  80065d:	6a 78                	push   $0x78
+  80065f:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800661:	8b 45 14             	mov    0x14(%ebp),%eax
+  800664:	8b 10                	mov    (%eax),%edx
+  800666:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80066b:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80066e:	8d 40 04             	lea    0x4(%eax),%eax
+  800671:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800674:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800679:	eb a3                	jmp    80061e <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80067b:	83 f9 01             	cmp    $0x1,%ecx
+  80067e:	7f 1b                	jg     80069b <vprintfmt+0x3eb>
+	else if (lflag)
+  800680:	85 c9                	test   %ecx,%ecx
+  800682:	74 2f                	je     8006b3 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800684:	8b 45 14             	mov    0x14(%ebp),%eax
+  800687:	8b 10                	mov    (%eax),%edx
+  800689:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068e:	8d 40 04             	lea    0x4(%eax),%eax
+  800691:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800694:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800699:	eb 83                	jmp    80061e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80069b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069e:	8b 10                	mov    (%eax),%edx
+  8006a0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006a3:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006ae:	e9 6b ff ff ff       	jmp    80061e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8006b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b6:	8b 10                	mov    (%eax),%edx
+  8006b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006c8:	e9 51 ff ff ff       	jmp    80061e <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8006cd:	83 ec 08             	sub    $0x8,%esp
+  8006d0:	53                   	push   %ebx
+  8006d1:	6a 25                	push   $0x25
+  8006d3:	ff d6                	call   *%esi
+			break;
+  8006d5:	83 c4 10             	add    $0x10,%esp
+  8006d8:	e9 5b ff ff ff       	jmp    800638 <vprintfmt+0x388>
+			putch('%', putdat);
+  8006dd:	83 ec 08             	sub    $0x8,%esp
+  8006e0:	53                   	push   %ebx
+  8006e1:	6a 25                	push   $0x25
+  8006e3:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006e5:	83 c4 10             	add    $0x10,%esp
+  8006e8:	89 f8                	mov    %edi,%eax
+  8006ea:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006ee:	74 05                	je     8006f5 <vprintfmt+0x445>
+  8006f0:	83 e8 01             	sub    $0x1,%eax
+  8006f3:	eb f5                	jmp    8006ea <vprintfmt+0x43a>
+  8006f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006f8:	e9 3b ff ff ff       	jmp    800638 <vprintfmt+0x388>
+
+008006fd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006fd:	55                   	push   %ebp
+  8006fe:	89 e5                	mov    %esp,%ebp
+  800700:	83 ec 18             	sub    $0x18,%esp
+  800703:	8b 45 08             	mov    0x8(%ebp),%eax
+  800706:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800709:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80070c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800710:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800713:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80071a:	85 c0                	test   %eax,%eax
+  80071c:	74 26                	je     800744 <vsnprintf+0x47>
+  80071e:	85 d2                	test   %edx,%edx
+  800720:	7e 22                	jle    800744 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800722:	ff 75 14             	push   0x14(%ebp)
+  800725:	ff 75 10             	push   0x10(%ebp)
+  800728:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80072b:	50                   	push   %eax
+  80072c:	68 76 02 80 00       	push   $0x800276
+  800731:	e8 7a fb ff ff       	call   8002b0 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800736:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800739:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80073c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80073f:	83 c4 10             	add    $0x10,%esp
+}
+  800742:	c9                   	leave
+  800743:	c3                   	ret
+		return -E_INVAL;
+  800744:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800749:	eb f7                	jmp    800742 <vsnprintf+0x45>
+
+0080074b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80074b:	55                   	push   %ebp
+  80074c:	89 e5                	mov    %esp,%ebp
+  80074e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800751:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800754:	50                   	push   %eax
+  800755:	ff 75 10             	push   0x10(%ebp)
+  800758:	ff 75 0c             	push   0xc(%ebp)
+  80075b:	ff 75 08             	push   0x8(%ebp)
+  80075e:	e8 9a ff ff ff       	call   8006fd <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800763:	c9                   	leave
+  800764:	c3                   	ret
+
+00800765 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800765:	55                   	push   %ebp
+  800766:	89 e5                	mov    %esp,%ebp
+  800768:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80076b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800770:	eb 03                	jmp    800775 <strlen+0x10>
+		n++;
+  800772:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800775:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800779:	75 f7                	jne    800772 <strlen+0xd>
+	return n;
+}
+  80077b:	5d                   	pop    %ebp
+  80077c:	c3                   	ret
+
+0080077d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80077d:	55                   	push   %ebp
+  80077e:	89 e5                	mov    %esp,%ebp
+  800780:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800783:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800786:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078b:	eb 03                	jmp    800790 <strnlen+0x13>
+		n++;
+  80078d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800790:	39 d0                	cmp    %edx,%eax
+  800792:	74 08                	je     80079c <strnlen+0x1f>
+  800794:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800798:	75 f3                	jne    80078d <strnlen+0x10>
+  80079a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80079c:	89 d0                	mov    %edx,%eax
+  80079e:	5d                   	pop    %ebp
+  80079f:	c3                   	ret
+
+008007a0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007a0:	55                   	push   %ebp
+  8007a1:	89 e5                	mov    %esp,%ebp
+  8007a3:	53                   	push   %ebx
+  8007a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007af:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007b3:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007b6:	83 c0 01             	add    $0x1,%eax
+  8007b9:	84 d2                	test   %dl,%dl
+  8007bb:	75 f2                	jne    8007af <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007bd:	89 c8                	mov    %ecx,%eax
+  8007bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c2:	c9                   	leave
+  8007c3:	c3                   	ret
+
+008007c4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007c4:	55                   	push   %ebp
+  8007c5:	89 e5                	mov    %esp,%ebp
+  8007c7:	53                   	push   %ebx
+  8007c8:	83 ec 10             	sub    $0x10,%esp
+  8007cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007ce:	53                   	push   %ebx
+  8007cf:	e8 91 ff ff ff       	call   800765 <strlen>
+  8007d4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007d7:	ff 75 0c             	push   0xc(%ebp)
+  8007da:	01 d8                	add    %ebx,%eax
+  8007dc:	50                   	push   %eax
+  8007dd:	e8 be ff ff ff       	call   8007a0 <strcpy>
+	return dst;
+}
+  8007e2:	89 d8                	mov    %ebx,%eax
+  8007e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007e7:	c9                   	leave
+  8007e8:	c3                   	ret
+
+008007e9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007e9:	55                   	push   %ebp
+  8007ea:	89 e5                	mov    %esp,%ebp
+  8007ec:	56                   	push   %esi
+  8007ed:	53                   	push   %ebx
+  8007ee:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007f4:	89 f3                	mov    %esi,%ebx
+  8007f6:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007f9:	89 f0                	mov    %esi,%eax
+  8007fb:	eb 0f                	jmp    80080c <strncpy+0x23>
+		*dst++ = *src;
+  8007fd:	83 c0 01             	add    $0x1,%eax
+  800800:	0f b6 0a             	movzbl (%edx),%ecx
+  800803:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800806:	80 f9 01             	cmp    $0x1,%cl
+  800809:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80080c:	39 d8                	cmp    %ebx,%eax
+  80080e:	75 ed                	jne    8007fd <strncpy+0x14>
+	}
+	return ret;
+}
+  800810:	89 f0                	mov    %esi,%eax
+  800812:	5b                   	pop    %ebx
+  800813:	5e                   	pop    %esi
+  800814:	5d                   	pop    %ebp
+  800815:	c3                   	ret
+
+00800816 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800816:	55                   	push   %ebp
+  800817:	89 e5                	mov    %esp,%ebp
+  800819:	56                   	push   %esi
+  80081a:	53                   	push   %ebx
+  80081b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80081e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800821:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800824:	89 f0                	mov    %esi,%eax
+  800826:	85 d2                	test   %edx,%edx
+  800828:	74 21                	je     80084b <strlcpy+0x35>
+  80082a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80082e:	89 f2                	mov    %esi,%edx
+  800830:	eb 09                	jmp    80083b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800832:	83 c1 01             	add    $0x1,%ecx
+  800835:	83 c2 01             	add    $0x1,%edx
+  800838:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80083b:	39 c2                	cmp    %eax,%edx
+  80083d:	74 09                	je     800848 <strlcpy+0x32>
+  80083f:	0f b6 19             	movzbl (%ecx),%ebx
+  800842:	84 db                	test   %bl,%bl
+  800844:	75 ec                	jne    800832 <strlcpy+0x1c>
+  800846:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800848:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80084b:	29 f0                	sub    %esi,%eax
+}
+  80084d:	5b                   	pop    %ebx
+  80084e:	5e                   	pop    %esi
+  80084f:	5d                   	pop    %ebp
+  800850:	c3                   	ret
+
+00800851 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800851:	55                   	push   %ebp
+  800852:	89 e5                	mov    %esp,%ebp
+  800854:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800857:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80085a:	eb 06                	jmp    800862 <strcmp+0x11>
+		p++, q++;
+  80085c:	83 c1 01             	add    $0x1,%ecx
+  80085f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800862:	0f b6 01             	movzbl (%ecx),%eax
+  800865:	84 c0                	test   %al,%al
+  800867:	74 04                	je     80086d <strcmp+0x1c>
+  800869:	3a 02                	cmp    (%edx),%al
+  80086b:	74 ef                	je     80085c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80086d:	0f b6 c0             	movzbl %al,%eax
+  800870:	0f b6 12             	movzbl (%edx),%edx
+  800873:	29 d0                	sub    %edx,%eax
+}
+  800875:	5d                   	pop    %ebp
+  800876:	c3                   	ret
+
+00800877 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800877:	55                   	push   %ebp
+  800878:	89 e5                	mov    %esp,%ebp
+  80087a:	53                   	push   %ebx
+  80087b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80087e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800881:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800884:	eb 09                	jmp    80088f <strncmp+0x18>
+		n--, p++, q++;
+  800886:	83 ea 01             	sub    $0x1,%edx
+  800889:	83 c0 01             	add    $0x1,%eax
+  80088c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80088f:	85 d2                	test   %edx,%edx
+  800891:	74 18                	je     8008ab <strncmp+0x34>
+  800893:	0f b6 18             	movzbl (%eax),%ebx
+  800896:	84 db                	test   %bl,%bl
+  800898:	74 04                	je     80089e <strncmp+0x27>
+  80089a:	3a 19                	cmp    (%ecx),%bl
+  80089c:	74 e8                	je     800886 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80089e:	0f b6 00             	movzbl (%eax),%eax
+  8008a1:	0f b6 11             	movzbl (%ecx),%edx
+  8008a4:	29 d0                	sub    %edx,%eax
+}
+  8008a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a9:	c9                   	leave
+  8008aa:	c3                   	ret
+		return 0;
+  8008ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b0:	eb f4                	jmp    8008a6 <strncmp+0x2f>
+
+008008b2 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008b2:	55                   	push   %ebp
+  8008b3:	89 e5                	mov    %esp,%ebp
+  8008b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008bc:	eb 03                	jmp    8008c1 <strchr+0xf>
+  8008be:	83 c0 01             	add    $0x1,%eax
+  8008c1:	0f b6 10             	movzbl (%eax),%edx
+  8008c4:	84 d2                	test   %dl,%dl
+  8008c6:	74 06                	je     8008ce <strchr+0x1c>
+		if (*s == c)
+  8008c8:	38 ca                	cmp    %cl,%dl
+  8008ca:	75 f2                	jne    8008be <strchr+0xc>
+  8008cc:	eb 05                	jmp    8008d3 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008d3:	5d                   	pop    %ebp
+  8008d4:	c3                   	ret
+
+008008d5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008d5:	55                   	push   %ebp
+  8008d6:	89 e5                	mov    %esp,%ebp
+  8008d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008db:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008df:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008e2:	38 ca                	cmp    %cl,%dl
+  8008e4:	74 09                	je     8008ef <strfind+0x1a>
+  8008e6:	84 d2                	test   %dl,%dl
+  8008e8:	74 05                	je     8008ef <strfind+0x1a>
+	for (; *s; s++)
+  8008ea:	83 c0 01             	add    $0x1,%eax
+  8008ed:	eb f0                	jmp    8008df <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008ef:	5d                   	pop    %ebp
+  8008f0:	c3                   	ret
+
+008008f1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008f1:	55                   	push   %ebp
+  8008f2:	89 e5                	mov    %esp,%ebp
+  8008f4:	57                   	push   %edi
+  8008f5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008f8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008fb:	85 c9                	test   %ecx,%ecx
+  8008fd:	74 20                	je     80091f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008ff:	89 f8                	mov    %edi,%eax
+  800901:	09 c8                	or     %ecx,%eax
+  800903:	a8 03                	test   $0x3,%al
+  800905:	75 12                	jne    800919 <memset+0x28>
+		c &= 0xFF;
+  800907:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80090b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800911:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800914:	fc                   	cld
+  800915:	f3 ab                	rep stos %eax,%es:(%edi)
+  800917:	eb 06                	jmp    80091f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800919:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80091c:	fc                   	cld
+  80091d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80091f:	89 f8                	mov    %edi,%eax
+  800921:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800924:	c9                   	leave
+  800925:	c3                   	ret
+
+00800926 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800926:	55                   	push   %ebp
+  800927:	89 e5                	mov    %esp,%ebp
+  800929:	57                   	push   %edi
+  80092a:	56                   	push   %esi
+  80092b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800931:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800934:	39 c6                	cmp    %eax,%esi
+  800936:	73 32                	jae    80096a <memmove+0x44>
+  800938:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80093b:	39 d0                	cmp    %edx,%eax
+  80093d:	73 2b                	jae    80096a <memmove+0x44>
+		s += n;
+		d += n;
+  80093f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800942:	89 d6                	mov    %edx,%esi
+  800944:	09 fe                	or     %edi,%esi
+  800946:	09 ce                	or     %ecx,%esi
+  800948:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80094e:	75 0e                	jne    80095e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800950:	83 ef 04             	sub    $0x4,%edi
+  800953:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800956:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800959:	fd                   	std
+  80095a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80095c:	eb 09                	jmp    800967 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80095e:	83 ef 01             	sub    $0x1,%edi
+  800961:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800964:	fd                   	std
+  800965:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800967:	fc                   	cld
+  800968:	eb 1a                	jmp    800984 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80096a:	89 f2                	mov    %esi,%edx
+  80096c:	09 c2                	or     %eax,%edx
+  80096e:	09 ca                	or     %ecx,%edx
+  800970:	f6 c2 03             	test   $0x3,%dl
+  800973:	75 0a                	jne    80097f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800975:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800978:	89 c7                	mov    %eax,%edi
+  80097a:	fc                   	cld
+  80097b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80097d:	eb 05                	jmp    800984 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80097f:	89 c7                	mov    %eax,%edi
+  800981:	fc                   	cld
+  800982:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800984:	5e                   	pop    %esi
+  800985:	5f                   	pop    %edi
+  800986:	5d                   	pop    %ebp
+  800987:	c3                   	ret
+
+00800988 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800988:	55                   	push   %ebp
+  800989:	89 e5                	mov    %esp,%ebp
+  80098b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80098e:	ff 75 10             	push   0x10(%ebp)
+  800991:	ff 75 0c             	push   0xc(%ebp)
+  800994:	ff 75 08             	push   0x8(%ebp)
+  800997:	e8 8a ff ff ff       	call   800926 <memmove>
+}
+  80099c:	c9                   	leave
+  80099d:	c3                   	ret
+
+0080099e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80099e:	55                   	push   %ebp
+  80099f:	89 e5                	mov    %esp,%ebp
+  8009a1:	56                   	push   %esi
+  8009a2:	53                   	push   %ebx
+  8009a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009a9:	89 c6                	mov    %eax,%esi
+  8009ab:	03 75 10             	add    0x10(%ebp),%esi
+  8009ae:	eb 06                	jmp    8009b6 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009b0:	83 c0 01             	add    $0x1,%eax
+  8009b3:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009b6:	39 f0                	cmp    %esi,%eax
+  8009b8:	74 14                	je     8009ce <memcmp+0x30>
+		if (*s1 != *s2)
+  8009ba:	0f b6 08             	movzbl (%eax),%ecx
+  8009bd:	0f b6 1a             	movzbl (%edx),%ebx
+  8009c0:	38 d9                	cmp    %bl,%cl
+  8009c2:	74 ec                	je     8009b0 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009c4:	0f b6 c1             	movzbl %cl,%eax
+  8009c7:	0f b6 db             	movzbl %bl,%ebx
+  8009ca:	29 d8                	sub    %ebx,%eax
+  8009cc:	eb 05                	jmp    8009d3 <memcmp+0x35>
+	}
+
+	return 0;
+  8009ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009d3:	5b                   	pop    %ebx
+  8009d4:	5e                   	pop    %esi
+  8009d5:	5d                   	pop    %ebp
+  8009d6:	c3                   	ret
+
+008009d7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009d7:	55                   	push   %ebp
+  8009d8:	89 e5                	mov    %esp,%ebp
+  8009da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009e0:	89 c2                	mov    %eax,%edx
+  8009e2:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009e5:	eb 03                	jmp    8009ea <memfind+0x13>
+  8009e7:	83 c0 01             	add    $0x1,%eax
+  8009ea:	39 d0                	cmp    %edx,%eax
+  8009ec:	73 04                	jae    8009f2 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009ee:	38 08                	cmp    %cl,(%eax)
+  8009f0:	75 f5                	jne    8009e7 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009f2:	5d                   	pop    %ebp
+  8009f3:	c3                   	ret
+
+008009f4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009f4:	55                   	push   %ebp
+  8009f5:	89 e5                	mov    %esp,%ebp
+  8009f7:	57                   	push   %edi
+  8009f8:	56                   	push   %esi
+  8009f9:	53                   	push   %ebx
+  8009fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a00:	eb 03                	jmp    800a05 <strtol+0x11>
+		s++;
+  800a02:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a05:	0f b6 02             	movzbl (%edx),%eax
+  800a08:	3c 20                	cmp    $0x20,%al
+  800a0a:	74 f6                	je     800a02 <strtol+0xe>
+  800a0c:	3c 09                	cmp    $0x9,%al
+  800a0e:	74 f2                	je     800a02 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a10:	3c 2b                	cmp    $0x2b,%al
+  800a12:	74 2a                	je     800a3e <strtol+0x4a>
+	int neg = 0;
+  800a14:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a19:	3c 2d                	cmp    $0x2d,%al
+  800a1b:	74 2b                	je     800a48 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a1d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a23:	75 0f                	jne    800a34 <strtol+0x40>
+  800a25:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a28:	74 28                	je     800a52 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a2a:	85 db                	test   %ebx,%ebx
+  800a2c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a31:	0f 44 d8             	cmove  %eax,%ebx
+  800a34:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a39:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a3c:	eb 46                	jmp    800a84 <strtol+0x90>
+		s++;
+  800a3e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a41:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a46:	eb d5                	jmp    800a1d <strtol+0x29>
+		s++, neg = 1;
+  800a48:	83 c2 01             	add    $0x1,%edx
+  800a4b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a50:	eb cb                	jmp    800a1d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a52:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a56:	74 0e                	je     800a66 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a58:	85 db                	test   %ebx,%ebx
+  800a5a:	75 d8                	jne    800a34 <strtol+0x40>
+		s++, base = 8;
+  800a5c:	83 c2 01             	add    $0x1,%edx
+  800a5f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a64:	eb ce                	jmp    800a34 <strtol+0x40>
+		s += 2, base = 16;
+  800a66:	83 c2 02             	add    $0x2,%edx
+  800a69:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a6e:	eb c4                	jmp    800a34 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a70:	0f be c0             	movsbl %al,%eax
+  800a73:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a76:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a79:	7d 3a                	jge    800ab5 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a7b:	83 c2 01             	add    $0x1,%edx
+  800a7e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a82:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a84:	0f b6 02             	movzbl (%edx),%eax
+  800a87:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a8a:	89 f3                	mov    %esi,%ebx
+  800a8c:	80 fb 09             	cmp    $0x9,%bl
+  800a8f:	76 df                	jbe    800a70 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a91:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a94:	89 f3                	mov    %esi,%ebx
+  800a96:	80 fb 19             	cmp    $0x19,%bl
+  800a99:	77 08                	ja     800aa3 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a9b:	0f be c0             	movsbl %al,%eax
+  800a9e:	83 e8 57             	sub    $0x57,%eax
+  800aa1:	eb d3                	jmp    800a76 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800aa3:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800aa6:	89 f3                	mov    %esi,%ebx
+  800aa8:	80 fb 19             	cmp    $0x19,%bl
+  800aab:	77 08                	ja     800ab5 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800aad:	0f be c0             	movsbl %al,%eax
+  800ab0:	83 e8 37             	sub    $0x37,%eax
+  800ab3:	eb c1                	jmp    800a76 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ab5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ab9:	74 05                	je     800ac0 <strtol+0xcc>
+		*endptr = (char *) s;
+  800abb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800abe:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ac0:	89 c8                	mov    %ecx,%eax
+  800ac2:	f7 d8                	neg    %eax
+  800ac4:	85 ff                	test   %edi,%edi
+  800ac6:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ac9:	89 c8                	mov    %ecx,%eax
+  800acb:	5b                   	pop    %ebx
+  800acc:	5e                   	pop    %esi
+  800acd:	5f                   	pop    %edi
+  800ace:	5d                   	pop    %ebp
+  800acf:	c3                   	ret
+
+00800ad0 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800ad0:	55                   	push   %ebp
+  800ad1:	89 e5                	mov    %esp,%ebp
+  800ad3:	57                   	push   %edi
+  800ad4:	56                   	push   %esi
+  800ad5:	53                   	push   %ebx
+  800ad6:	83 ec 0c             	sub    $0xc,%esp
+  800ad9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800adc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800adf:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800ae2:	85 ff                	test   %edi,%edi
+  800ae4:	74 16                	je     800afc <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800ae6:	83 ec 04             	sub    $0x4,%esp
+  800ae9:	56                   	push   %esi
+  800aea:	6a 00                	push   $0x0
+  800aec:	53                   	push   %ebx
+  800aed:	e8 02 ff ff ff       	call   8009f4 <strtol>
+  800af2:	89 07                	mov    %eax,(%edi)
+  800af4:	83 c4 10             	add    $0x10,%esp
+  800af7:	eb 03                	jmp    800afc <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800af9:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800afc:	0f b6 03             	movzbl (%ebx),%eax
+  800aff:	3c 20                	cmp    $0x20,%al
+  800b01:	74 f6                	je     800af9 <strisl+0x29>
+  800b03:	3c 09                	cmp    $0x9,%al
+  800b05:	74 f2                	je     800af9 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b07:	3c 2b                	cmp    $0x2b,%al
+  800b09:	74 23                	je     800b2e <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800b0b:	3c 2d                	cmp    $0x2d,%al
+  800b0d:	0f 94 c0             	sete   %al
+  800b10:	0f b6 c0             	movzbl %al,%eax
+  800b13:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b15:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800b1b:	75 41                	jne    800b5e <strisl+0x8e>
+  800b1d:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800b20:	74 11                	je     800b33 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b22:	85 f6                	test   %esi,%esi
+  800b24:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b29:	0f 44 f0             	cmove  %eax,%esi
+  800b2c:	eb 30                	jmp    800b5e <strisl+0x8e>
+		s++;
+  800b2e:	83 c3 01             	add    $0x1,%ebx
+  800b31:	eb e2                	jmp    800b15 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b33:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800b37:	74 0e                	je     800b47 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800b39:	85 f6                	test   %esi,%esi
+  800b3b:	75 21                	jne    800b5e <strisl+0x8e>
+		s++, base = 8;
+  800b3d:	83 c3 01             	add    $0x1,%ebx
+  800b40:	be 08 00 00 00       	mov    $0x8,%esi
+  800b45:	eb 17                	jmp    800b5e <strisl+0x8e>
+		s += 2, base = 16;
+  800b47:	83 c3 02             	add    $0x2,%ebx
+  800b4a:	be 10 00 00 00       	mov    $0x10,%esi
+  800b4f:	eb 0d                	jmp    800b5e <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b51:	0f be c0             	movsbl %al,%eax
+  800b54:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800b57:	39 f0                	cmp    %esi,%eax
+  800b59:	7d 38                	jge    800b93 <strisl+0xc3>
+			return 0;
+		s++;
+  800b5b:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800b5e:	0f b6 03             	movzbl (%ebx),%eax
+  800b61:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800b64:	80 fa 09             	cmp    $0x9,%dl
+  800b67:	76 e8                	jbe    800b51 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800b69:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800b6c:	80 fa 19             	cmp    $0x19,%dl
+  800b6f:	77 08                	ja     800b79 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800b71:	0f be c0             	movsbl %al,%eax
+  800b74:	83 e8 57             	sub    $0x57,%eax
+  800b77:	eb de                	jmp    800b57 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b79:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800b7c:	80 fa 19             	cmp    $0x19,%dl
+  800b7f:	77 08                	ja     800b89 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800b81:	0f be c0             	movsbl %al,%eax
+  800b84:	83 e8 37             	sub    $0x37,%eax
+  800b87:	eb ce                	jmp    800b57 <strisl+0x87>
+		else if (!*s)
+  800b89:	84 c0                	test   %al,%al
+  800b8b:	0f 94 c0             	sete   %al
+  800b8e:	0f b6 c0             	movzbl %al,%eax
+  800b91:	eb 05                	jmp    800b98 <strisl+0xc8>
+			return 0;
+  800b93:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800b98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b9b:	5b                   	pop    %ebx
+  800b9c:	5e                   	pop    %esi
+  800b9d:	5f                   	pop    %edi
+  800b9e:	5d                   	pop    %ebp
+  800b9f:	c3                   	ret
+
+00800ba0 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800ba0:	55                   	push   %ebp
+  800ba1:	89 e5                	mov    %esp,%ebp
+  800ba3:	83 ec 10             	sub    $0x10,%esp
+  800ba6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800ba9:	89 c8                	mov    %ecx,%eax
+  800bab:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800bb0:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800bb3:	eb 0b                	jmp    800bc0 <touch_mem+0x20>
+		c = *(char *)page;
+  800bb5:	0f b6 10             	movzbl (%eax),%edx
+  800bb8:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800bbb:	05 00 10 00 00       	add    $0x1000,%eax
+  800bc0:	39 c8                	cmp    %ecx,%eax
+  800bc2:	72 f1                	jb     800bb5 <touch_mem+0x15>
+}
+  800bc4:	c9                   	leave
+  800bc5:	c3                   	ret
+
+00800bc6 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bc6:	55                   	push   %ebp
+  800bc7:	89 e5                	mov    %esp,%ebp
+  800bc9:	57                   	push   %edi
+  800bca:	56                   	push   %esi
+  800bcb:	53                   	push   %ebx
+	touch_mem(s, len);
+  800bcc:	ff 75 0c             	push   0xc(%ebp)
+  800bcf:	ff 75 08             	push   0x8(%ebp)
+  800bd2:	e8 c9 ff ff ff       	call   800ba0 <touch_mem>
+	asm volatile("int %1\n"
+  800bd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bdc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bdf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be2:	89 c3                	mov    %eax,%ebx
+  800be4:	89 c7                	mov    %eax,%edi
+  800be6:	89 c6                	mov    %eax,%esi
+  800be8:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bea:	83 c4 08             	add    $0x8,%esp
+  800bed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bf0:	5b                   	pop    %ebx
+  800bf1:	5e                   	pop    %esi
+  800bf2:	5f                   	pop    %edi
+  800bf3:	5d                   	pop    %ebp
+  800bf4:	c3                   	ret
+
+00800bf5 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bf5:	55                   	push   %ebp
+  800bf6:	89 e5                	mov    %esp,%ebp
+  800bf8:	57                   	push   %edi
+  800bf9:	56                   	push   %esi
+  800bfa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bfb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c00:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c05:	89 d1                	mov    %edx,%ecx
+  800c07:	89 d3                	mov    %edx,%ebx
+  800c09:	89 d7                	mov    %edx,%edi
+  800c0b:	89 d6                	mov    %edx,%esi
+  800c0d:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c0f:	5b                   	pop    %ebx
+  800c10:	5e                   	pop    %esi
+  800c11:	5f                   	pop    %edi
+  800c12:	5d                   	pop    %ebp
+  800c13:	c3                   	ret
+
+00800c14 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c14:	55                   	push   %ebp
+  800c15:	89 e5                	mov    %esp,%ebp
+  800c17:	57                   	push   %edi
+  800c18:	56                   	push   %esi
+  800c19:	53                   	push   %ebx
+  800c1a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c25:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c2a:	89 cb                	mov    %ecx,%ebx
+  800c2c:	89 cf                	mov    %ecx,%edi
+  800c2e:	89 ce                	mov    %ecx,%esi
+  800c30:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c32:	85 c0                	test   %eax,%eax
+  800c34:	7f 08                	jg     800c3e <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c39:	5b                   	pop    %ebx
+  800c3a:	5e                   	pop    %esi
+  800c3b:	5f                   	pop    %edi
+  800c3c:	5d                   	pop    %ebp
+  800c3d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c3e:	83 ec 0c             	sub    $0xc,%esp
+  800c41:	50                   	push   %eax
+  800c42:	6a 03                	push   $0x3
+  800c44:	68 6b 31 80 00       	push   $0x80316b
+  800c49:	6a 23                	push   $0x23
+  800c4b:	68 88 31 80 00       	push   $0x803188
+  800c50:	e8 89 f4 ff ff       	call   8000de <_panic>
+
+00800c55 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c55:	55                   	push   %ebp
+  800c56:	89 e5                	mov    %esp,%ebp
+  800c58:	57                   	push   %edi
+  800c59:	56                   	push   %esi
+  800c5a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c60:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c65:	89 d1                	mov    %edx,%ecx
+  800c67:	89 d3                	mov    %edx,%ebx
+  800c69:	89 d7                	mov    %edx,%edi
+  800c6b:	89 d6                	mov    %edx,%esi
+  800c6d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c6f:	5b                   	pop    %ebx
+  800c70:	5e                   	pop    %esi
+  800c71:	5f                   	pop    %edi
+  800c72:	5d                   	pop    %ebp
+  800c73:	c3                   	ret
+
+00800c74 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c74:	55                   	push   %ebp
+  800c75:	89 e5                	mov    %esp,%ebp
+  800c77:	57                   	push   %edi
+  800c78:	56                   	push   %esi
+  800c79:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c7f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c84:	89 d1                	mov    %edx,%ecx
+  800c86:	89 d3                	mov    %edx,%ebx
+  800c88:	89 d7                	mov    %edx,%edi
+  800c8a:	89 d6                	mov    %edx,%esi
+  800c8c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c8e:	5b                   	pop    %ebx
+  800c8f:	5e                   	pop    %esi
+  800c90:	5f                   	pop    %edi
+  800c91:	5d                   	pop    %ebp
+  800c92:	c3                   	ret
+
+00800c93 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c93:	55                   	push   %ebp
+  800c94:	89 e5                	mov    %esp,%ebp
+  800c96:	57                   	push   %edi
+  800c97:	56                   	push   %esi
+  800c98:	53                   	push   %ebx
+  800c99:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c9c:	be 00 00 00 00       	mov    $0x0,%esi
+  800ca1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca7:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800caf:	89 f7                	mov    %esi,%edi
+  800cb1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cb3:	85 c0                	test   %eax,%eax
+  800cb5:	7f 08                	jg     800cbf <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cba:	5b                   	pop    %ebx
+  800cbb:	5e                   	pop    %esi
+  800cbc:	5f                   	pop    %edi
+  800cbd:	5d                   	pop    %ebp
+  800cbe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cbf:	83 ec 0c             	sub    $0xc,%esp
+  800cc2:	50                   	push   %eax
+  800cc3:	6a 04                	push   $0x4
+  800cc5:	68 6b 31 80 00       	push   $0x80316b
+  800cca:	6a 23                	push   $0x23
+  800ccc:	68 88 31 80 00       	push   $0x803188
+  800cd1:	e8 08 f4 ff ff       	call   8000de <_panic>
+
+00800cd6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cd6:	55                   	push   %ebp
+  800cd7:	89 e5                	mov    %esp,%ebp
+  800cd9:	57                   	push   %edi
+  800cda:	56                   	push   %esi
+  800cdb:	53                   	push   %ebx
+  800cdc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce5:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ced:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cf0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cf3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cf5:	85 c0                	test   %eax,%eax
+  800cf7:	7f 08                	jg     800d01 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cf9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cfc:	5b                   	pop    %ebx
+  800cfd:	5e                   	pop    %esi
+  800cfe:	5f                   	pop    %edi
+  800cff:	5d                   	pop    %ebp
+  800d00:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d01:	83 ec 0c             	sub    $0xc,%esp
+  800d04:	50                   	push   %eax
+  800d05:	6a 05                	push   $0x5
+  800d07:	68 6b 31 80 00       	push   $0x80316b
+  800d0c:	6a 23                	push   $0x23
+  800d0e:	68 88 31 80 00       	push   $0x803188
+  800d13:	e8 c6 f3 ff ff       	call   8000de <_panic>
+
+00800d18 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d18:	55                   	push   %ebp
+  800d19:	89 e5                	mov    %esp,%ebp
+  800d1b:	57                   	push   %edi
+  800d1c:	56                   	push   %esi
+  800d1d:	53                   	push   %ebx
+  800d1e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d21:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d29:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d31:	89 df                	mov    %ebx,%edi
+  800d33:	89 de                	mov    %ebx,%esi
+  800d35:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d37:	85 c0                	test   %eax,%eax
+  800d39:	7f 08                	jg     800d43 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3e:	5b                   	pop    %ebx
+  800d3f:	5e                   	pop    %esi
+  800d40:	5f                   	pop    %edi
+  800d41:	5d                   	pop    %ebp
+  800d42:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d43:	83 ec 0c             	sub    $0xc,%esp
+  800d46:	50                   	push   %eax
+  800d47:	6a 06                	push   $0x6
+  800d49:	68 6b 31 80 00       	push   $0x80316b
+  800d4e:	6a 23                	push   $0x23
+  800d50:	68 88 31 80 00       	push   $0x803188
+  800d55:	e8 84 f3 ff ff       	call   8000de <_panic>
+
+00800d5a <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800d5a:	55                   	push   %ebp
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	57                   	push   %edi
+  800d5e:	56                   	push   %esi
+  800d5f:	53                   	push   %ebx
+  800d60:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6e:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d73:	89 df                	mov    %ebx,%edi
+  800d75:	89 de                	mov    %ebx,%esi
+  800d77:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d79:	85 c0                	test   %eax,%eax
+  800d7b:	7f 08                	jg     800d85 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d80:	5b                   	pop    %ebx
+  800d81:	5e                   	pop    %esi
+  800d82:	5f                   	pop    %edi
+  800d83:	5d                   	pop    %ebp
+  800d84:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d85:	83 ec 0c             	sub    $0xc,%esp
+  800d88:	50                   	push   %eax
+  800d89:	6a 18                	push   $0x18
+  800d8b:	68 6b 31 80 00       	push   $0x80316b
+  800d90:	6a 23                	push   $0x23
+  800d92:	68 88 31 80 00       	push   $0x803188
+  800d97:	e8 42 f3 ff ff       	call   8000de <_panic>
+
+00800d9c <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800d9c:	55                   	push   %ebp
+  800d9d:	89 e5                	mov    %esp,%ebp
+  800d9f:	57                   	push   %edi
+  800da0:	56                   	push   %esi
+  800da1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800da2:	be 00 00 00 00       	mov    $0x0,%esi
+  800da7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800daa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dad:	b8 19 00 00 00       	mov    $0x19,%eax
+  800db2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db5:	89 f7                	mov    %esi,%edi
+  800db7:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800db9:	5b                   	pop    %ebx
+  800dba:	5e                   	pop    %esi
+  800dbb:	5f                   	pop    %edi
+  800dbc:	5d                   	pop    %ebp
+  800dbd:	c3                   	ret
+
+00800dbe <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800dbe:	55                   	push   %ebp
+  800dbf:	89 e5                	mov    %esp,%ebp
+  800dc1:	57                   	push   %edi
+  800dc2:	56                   	push   %esi
+  800dc3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dc4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dca:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800dcf:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dda:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800ddc:	5b                   	pop    %ebx
+  800ddd:	5e                   	pop    %esi
+  800dde:	5f                   	pop    %edi
+  800ddf:	5d                   	pop    %ebp
+  800de0:	c3                   	ret
+
+00800de1 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800de1:	55                   	push   %ebp
+  800de2:	89 e5                	mov    %esp,%ebp
+  800de4:	57                   	push   %edi
+  800de5:	56                   	push   %esi
+  800de6:	53                   	push   %ebx
+  800de7:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800dea:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800ded:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800df3:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800df6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfc:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e04:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e07:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e09:	85 c0                	test   %eax,%eax
+  800e0b:	7f 08                	jg     800e15 <sys_page_map_range+0x34>
+}
+  800e0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e10:	5b                   	pop    %ebx
+  800e11:	5e                   	pop    %esi
+  800e12:	5f                   	pop    %edi
+  800e13:	5d                   	pop    %ebp
+  800e14:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e15:	83 ec 0c             	sub    $0xc,%esp
+  800e18:	50                   	push   %eax
+  800e19:	6a 10                	push   $0x10
+  800e1b:	68 6b 31 80 00       	push   $0x80316b
+  800e20:	6a 23                	push   $0x23
+  800e22:	68 88 31 80 00       	push   $0x803188
+  800e27:	e8 b2 f2 ff ff       	call   8000de <_panic>
+
+00800e2c <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e2c:	55                   	push   %ebp
+  800e2d:	89 e5                	mov    %esp,%ebp
+  800e2f:	57                   	push   %edi
+  800e30:	56                   	push   %esi
+  800e31:	53                   	push   %ebx
+  800e32:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e35:	be 00 00 00 00       	mov    $0x0,%esi
+  800e3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e40:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e48:	89 f7                	mov    %esi,%edi
+  800e4a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e4c:	85 c0                	test   %eax,%eax
+  800e4e:	7f 08                	jg     800e58 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e53:	5b                   	pop    %ebx
+  800e54:	5e                   	pop    %esi
+  800e55:	5f                   	pop    %edi
+  800e56:	5d                   	pop    %ebp
+  800e57:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e58:	83 ec 0c             	sub    $0xc,%esp
+  800e5b:	50                   	push   %eax
+  800e5c:	6a 11                	push   $0x11
+  800e5e:	68 6b 31 80 00       	push   $0x80316b
+  800e63:	6a 23                	push   $0x23
+  800e65:	68 88 31 80 00       	push   $0x803188
+  800e6a:	e8 6f f2 ff ff       	call   8000de <_panic>
+
+00800e6f <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800e6f:	55                   	push   %ebp
+  800e70:	89 e5                	mov    %esp,%ebp
+  800e72:	57                   	push   %edi
+  800e73:	56                   	push   %esi
+  800e74:	53                   	push   %ebx
+  800e75:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e78:	be 00 00 00 00       	mov    $0x0,%esi
+  800e7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e83:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800e88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8b:	89 f7                	mov    %esi,%edi
+  800e8d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e8f:	85 c0                	test   %eax,%eax
+  800e91:	7f 08                	jg     800e9b <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e96:	5b                   	pop    %ebx
+  800e97:	5e                   	pop    %esi
+  800e98:	5f                   	pop    %edi
+  800e99:	5d                   	pop    %ebp
+  800e9a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9b:	83 ec 0c             	sub    $0xc,%esp
+  800e9e:	50                   	push   %eax
+  800e9f:	6a 1b                	push   $0x1b
+  800ea1:	68 6b 31 80 00       	push   $0x80316b
+  800ea6:	6a 23                	push   $0x23
+  800ea8:	68 88 31 80 00       	push   $0x803188
+  800ead:	e8 2c f2 ff ff       	call   8000de <_panic>
+
+00800eb2 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800eb2:	55                   	push   %ebp
+  800eb3:	89 e5                	mov    %esp,%ebp
+  800eb5:	57                   	push   %edi
+  800eb6:	56                   	push   %esi
+  800eb7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ebd:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ec2:	89 d1                	mov    %edx,%ecx
+  800ec4:	89 d3                	mov    %edx,%ebx
+  800ec6:	89 d7                	mov    %edx,%edi
+  800ec8:	89 d6                	mov    %edx,%esi
+  800eca:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800ecc:	5b                   	pop    %ebx
+  800ecd:	5e                   	pop    %esi
+  800ece:	5f                   	pop    %edi
+  800ecf:	5d                   	pop    %ebp
+  800ed0:	c3                   	ret
+
+00800ed1 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ed1:	55                   	push   %ebp
+  800ed2:	89 e5                	mov    %esp,%ebp
+  800ed4:	57                   	push   %edi
+  800ed5:	56                   	push   %esi
+  800ed6:	53                   	push   %ebx
+  800ed7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800edf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee5:	b8 08 00 00 00       	mov    $0x8,%eax
+  800eea:	89 df                	mov    %ebx,%edi
+  800eec:	89 de                	mov    %ebx,%esi
+  800eee:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef0:	85 c0                	test   %eax,%eax
+  800ef2:	7f 08                	jg     800efc <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ef4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef7:	5b                   	pop    %ebx
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5f                   	pop    %edi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800efc:	83 ec 0c             	sub    $0xc,%esp
+  800eff:	50                   	push   %eax
+  800f00:	6a 08                	push   $0x8
+  800f02:	68 6b 31 80 00       	push   $0x80316b
+  800f07:	6a 23                	push   $0x23
+  800f09:	68 88 31 80 00       	push   $0x803188
+  800f0e:	e8 cb f1 ff ff       	call   8000de <_panic>
+
+00800f13 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	57                   	push   %edi
+  800f17:	56                   	push   %esi
+  800f18:	53                   	push   %ebx
+  800f19:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800f1c:	6a 44                	push   $0x44
+  800f1e:	ff 75 0c             	push   0xc(%ebp)
+  800f21:	e8 7a fc ff ff       	call   800ba0 <touch_mem>
+	asm volatile("int %1\n"
+  800f26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2e:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f36:	89 df                	mov    %ebx,%edi
+  800f38:	89 de                	mov    %ebx,%esi
+  800f3a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f3c:	83 c4 08             	add    $0x8,%esp
+  800f3f:	85 c0                	test   %eax,%eax
+  800f41:	7f 08                	jg     800f4b <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f46:	5b                   	pop    %ebx
+  800f47:	5e                   	pop    %esi
+  800f48:	5f                   	pop    %edi
+  800f49:	5d                   	pop    %ebp
+  800f4a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f4b:	83 ec 0c             	sub    $0xc,%esp
+  800f4e:	50                   	push   %eax
+  800f4f:	6a 09                	push   $0x9
+  800f51:	68 6b 31 80 00       	push   $0x80316b
+  800f56:	6a 23                	push   $0x23
+  800f58:	68 88 31 80 00       	push   $0x803188
+  800f5d:	e8 7c f1 ff ff       	call   8000de <_panic>
+
+00800f62 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800f62:	55                   	push   %ebp
+  800f63:	89 e5                	mov    %esp,%ebp
+  800f65:	57                   	push   %edi
+  800f66:	56                   	push   %esi
+  800f67:	53                   	push   %ebx
+  800f68:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f6b:	be 00 00 00 00       	mov    $0x0,%esi
+  800f70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f76:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800f7b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f7e:	89 f7                	mov    %esi,%edi
+  800f80:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f82:	85 c0                	test   %eax,%eax
+  800f84:	7f 08                	jg     800f8e <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800f86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f89:	5b                   	pop    %ebx
+  800f8a:	5e                   	pop    %esi
+  800f8b:	5f                   	pop    %edi
+  800f8c:	5d                   	pop    %ebp
+  800f8d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f8e:	83 ec 0c             	sub    $0xc,%esp
+  800f91:	50                   	push   %eax
+  800f92:	6a 1a                	push   $0x1a
+  800f94:	68 6b 31 80 00       	push   $0x80316b
+  800f99:	6a 23                	push   $0x23
+  800f9b:	68 88 31 80 00       	push   $0x803188
+  800fa0:	e8 39 f1 ff ff       	call   8000de <_panic>
+
+00800fa5 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  800fa5:	55                   	push   %ebp
+  800fa6:	89 e5                	mov    %esp,%ebp
+  800fa8:	57                   	push   %edi
+  800fa9:	56                   	push   %esi
+  800faa:	53                   	push   %ebx
+  800fab:	83 ec 0c             	sub    $0xc,%esp
+  800fae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  800fb1:	89 d8                	mov    %ebx,%eax
+  800fb3:	c1 e0 05             	shl    $0x5,%eax
+  800fb6:	50                   	push   %eax
+  800fb7:	ff 75 0c             	push   0xc(%ebp)
+  800fba:	e8 e1 fb ff ff       	call   800ba0 <touch_mem>
+	asm volatile("int %1\n"
+  800fbf:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc7:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fcc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcf:	89 f7                	mov    %esi,%edi
+  800fd1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd3:	83 c4 08             	add    $0x8,%esp
+  800fd6:	85 c0                	test   %eax,%eax
+  800fd8:	7f 08                	jg     800fe2 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  800fda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdd:	5b                   	pop    %ebx
+  800fde:	5e                   	pop    %esi
+  800fdf:	5f                   	pop    %edi
+  800fe0:	5d                   	pop    %ebp
+  800fe1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe2:	83 ec 0c             	sub    $0xc,%esp
+  800fe5:	50                   	push   %eax
+  800fe6:	6a 13                	push   $0x13
+  800fe8:	68 6b 31 80 00       	push   $0x80316b
+  800fed:	6a 23                	push   $0x23
+  800fef:	68 88 31 80 00       	push   $0x803188
+  800ff4:	e8 e5 f0 ff ff       	call   8000de <_panic>
+
+00800ff9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ff9:	55                   	push   %ebp
+  800ffa:	89 e5                	mov    %esp,%ebp
+  800ffc:	57                   	push   %edi
+  800ffd:	56                   	push   %esi
+  800ffe:	53                   	push   %ebx
+  800fff:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801002:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801007:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801012:	89 df                	mov    %ebx,%edi
+  801014:	89 de                	mov    %ebx,%esi
+  801016:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801018:	85 c0                	test   %eax,%eax
+  80101a:	7f 08                	jg     801024 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80101c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101f:	5b                   	pop    %ebx
+  801020:	5e                   	pop    %esi
+  801021:	5f                   	pop    %edi
+  801022:	5d                   	pop    %ebp
+  801023:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801024:	83 ec 0c             	sub    $0xc,%esp
+  801027:	50                   	push   %eax
+  801028:	6a 0a                	push   $0xa
+  80102a:	68 6b 31 80 00       	push   $0x80316b
+  80102f:	6a 23                	push   $0x23
+  801031:	68 88 31 80 00       	push   $0x803188
+  801036:	e8 a3 f0 ff ff       	call   8000de <_panic>
+
+0080103b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80103b:	55                   	push   %ebp
+  80103c:	89 e5                	mov    %esp,%ebp
+  80103e:	57                   	push   %edi
+  80103f:	56                   	push   %esi
+  801040:	53                   	push   %ebx
+  801041:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801044:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80104a:	76 1d                	jbe    801069 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80104c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801052:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801057:	be 01 00 00 00       	mov    $0x1,%esi
+  80105c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80105f:	cd 30                	int    $0x30
+}
+  801061:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801064:	5b                   	pop    %ebx
+  801065:	5e                   	pop    %esi
+  801066:	5f                   	pop    %edi
+  801067:	5d                   	pop    %ebp
+  801068:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801069:	68 00 10 00 00       	push   $0x1000
+  80106e:	53                   	push   %ebx
+  80106f:	e8 2c fb ff ff       	call   800ba0 <touch_mem>
+  801074:	83 c4 08             	add    $0x8,%esp
+  801077:	eb d3                	jmp    80104c <sys_ipc_send+0x11>
+
+00801079 <sys_ipc_send_pages>:
+{
+  801079:	55                   	push   %ebp
+  80107a:	89 e5                	mov    %esp,%ebp
+  80107c:	57                   	push   %edi
+  80107d:	56                   	push   %esi
+  80107e:	53                   	push   %ebx
+  80107f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801082:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801085:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80108b:	76 18                	jbe    8010a5 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80108d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801090:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801093:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801098:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80109b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  80109d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a0:	5b                   	pop    %ebx
+  8010a1:	5e                   	pop    %esi
+  8010a2:	5f                   	pop    %edi
+  8010a3:	5d                   	pop    %ebp
+  8010a4:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8010a5:	89 f0                	mov    %esi,%eax
+  8010a7:	c1 e0 0c             	shl    $0xc,%eax
+  8010aa:	50                   	push   %eax
+  8010ab:	53                   	push   %ebx
+  8010ac:	e8 ef fa ff ff       	call   800ba0 <touch_mem>
+  8010b1:	83 c4 08             	add    $0x8,%esp
+  8010b4:	eb d7                	jmp    80108d <sys_ipc_send_pages+0x14>
+
+008010b6 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8010b6:	55                   	push   %ebp
+  8010b7:	89 e5                	mov    %esp,%ebp
+  8010b9:	57                   	push   %edi
+  8010ba:	56                   	push   %esi
+  8010bb:	53                   	push   %ebx
+  8010bc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ca:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010cf:	89 df                	mov    %ebx,%edi
+  8010d1:	89 de                	mov    %ebx,%esi
+  8010d3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010d5:	85 c0                	test   %eax,%eax
+  8010d7:	7f 08                	jg     8010e1 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8010d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010dc:	5b                   	pop    %ebx
+  8010dd:	5e                   	pop    %esi
+  8010de:	5f                   	pop    %edi
+  8010df:	5d                   	pop    %ebp
+  8010e0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e1:	83 ec 0c             	sub    $0xc,%esp
+  8010e4:	50                   	push   %eax
+  8010e5:	6a 0d                	push   $0xd
+  8010e7:	68 6b 31 80 00       	push   $0x80316b
+  8010ec:	6a 23                	push   $0x23
+  8010ee:	68 88 31 80 00       	push   $0x803188
+  8010f3:	e8 e6 ef ff ff       	call   8000de <_panic>
+
+008010f8 <sys_ipc_recv>:
+{
+  8010f8:	55                   	push   %ebp
+  8010f9:	89 e5                	mov    %esp,%ebp
+  8010fb:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8010fe:	6a 01                	push   $0x1
+  801100:	ff 75 08             	push   0x8(%ebp)
+  801103:	e8 ae ff ff ff       	call   8010b6 <sys_ipc_recv_pages>
+}
+  801108:	c9                   	leave
+  801109:	c3                   	ret
+
+0080110a <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80110a:	55                   	push   %ebp
+  80110b:	89 e5                	mov    %esp,%ebp
+  80110d:	57                   	push   %edi
+  80110e:	56                   	push   %esi
+  80110f:	53                   	push   %ebx
+  801110:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801113:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801116:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801119:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80111f:	77 04                	ja     801125 <sys_ipc_call+0x1b>
+  801121:	85 f6                	test   %esi,%esi
+  801123:	75 15                	jne    80113a <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801125:	8b 55 08             	mov    0x8(%ebp),%edx
+  801128:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801130:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801132:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801135:	5b                   	pop    %ebx
+  801136:	5e                   	pop    %esi
+  801137:	5f                   	pop    %edi
+  801138:	5d                   	pop    %ebp
+  801139:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80113a:	89 f8                	mov    %edi,%eax
+  80113c:	c1 e0 0c             	shl    $0xc,%eax
+  80113f:	50                   	push   %eax
+  801140:	53                   	push   %ebx
+  801141:	e8 5a fa ff ff       	call   800ba0 <touch_mem>
+  801146:	83 c4 08             	add    $0x8,%esp
+  801149:	eb da                	jmp    801125 <sys_ipc_call+0x1b>
+
+0080114b <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80114b:	55                   	push   %ebp
+  80114c:	89 e5                	mov    %esp,%ebp
+  80114e:	57                   	push   %edi
+  80114f:	56                   	push   %esi
+  801150:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801151:	8b 55 08             	mov    0x8(%ebp),%edx
+  801154:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801157:	b8 15 00 00 00       	mov    $0x15,%eax
+  80115c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801162:	8b 75 18             	mov    0x18(%ebp),%esi
+  801165:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801167:	5b                   	pop    %ebx
+  801168:	5e                   	pop    %esi
+  801169:	5f                   	pop    %edi
+  80116a:	5d                   	pop    %ebp
+  80116b:	c3                   	ret
+
+0080116c <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  80116c:	55                   	push   %ebp
+  80116d:	89 e5                	mov    %esp,%ebp
+  80116f:	57                   	push   %edi
+  801170:	56                   	push   %esi
+  801171:	53                   	push   %ebx
+  801172:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801175:	6a 04                	push   $0x4
+  801177:	ff 75 08             	push   0x8(%ebp)
+  80117a:	e8 21 fa ff ff       	call   800ba0 <touch_mem>
+	asm volatile("int %1\n"
+  80117f:	be 00 00 00 00       	mov    $0x0,%esi
+  801184:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801187:	b8 16 00 00 00       	mov    $0x16,%eax
+  80118c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801192:	89 f7                	mov    %esi,%edi
+  801194:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801196:	83 c4 08             	add    $0x8,%esp
+  801199:	85 c0                	test   %eax,%eax
+  80119b:	7f 08                	jg     8011a5 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  80119d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a0:	5b                   	pop    %ebx
+  8011a1:	5e                   	pop    %esi
+  8011a2:	5f                   	pop    %edi
+  8011a3:	5d                   	pop    %ebp
+  8011a4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a5:	83 ec 0c             	sub    $0xc,%esp
+  8011a8:	50                   	push   %eax
+  8011a9:	6a 16                	push   $0x16
+  8011ab:	68 6b 31 80 00       	push   $0x80316b
+  8011b0:	6a 23                	push   $0x23
+  8011b2:	68 88 31 80 00       	push   $0x803188
+  8011b7:	e8 22 ef ff ff       	call   8000de <_panic>
+
+008011bc <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	57                   	push   %edi
+  8011c0:	56                   	push   %esi
+  8011c1:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8011c2:	6a 04                	push   $0x4
+  8011c4:	ff 75 08             	push   0x8(%ebp)
+  8011c7:	e8 d4 f9 ff ff       	call   800ba0 <touch_mem>
+	asm volatile("int %1\n"
+  8011cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d4:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011dc:	89 df                	mov    %ebx,%edi
+  8011de:	89 de                	mov    %ebx,%esi
+  8011e0:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8011e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e5:	5b                   	pop    %ebx
+  8011e6:	5e                   	pop    %esi
+  8011e7:	5f                   	pop    %edi
+  8011e8:	5d                   	pop    %ebp
+  8011e9:	c3                   	ret
+
+008011ea <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8011ea:	55                   	push   %ebp
+  8011eb:	89 e5                	mov    %esp,%ebp
+  8011ed:	57                   	push   %edi
+  8011ee:	56                   	push   %esi
+  8011ef:	53                   	push   %ebx
+  8011f0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801200:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801205:	89 df                	mov    %ebx,%edi
+  801207:	89 de                	mov    %ebx,%esi
+  801209:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80120b:	85 c0                	test   %eax,%eax
+  80120d:	7f 08                	jg     801217 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80120f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801212:	5b                   	pop    %ebx
+  801213:	5e                   	pop    %esi
+  801214:	5f                   	pop    %edi
+  801215:	5d                   	pop    %ebp
+  801216:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801217:	83 ec 0c             	sub    $0xc,%esp
+  80121a:	50                   	push   %eax
+  80121b:	6a 0e                	push   $0xe
+  80121d:	68 6b 31 80 00       	push   $0x80316b
+  801222:	6a 23                	push   $0x23
+  801224:	68 88 31 80 00       	push   $0x803188
+  801229:	e8 b0 ee ff ff       	call   8000de <_panic>
+
+0080122e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80122e:	55                   	push   %ebp
+  80122f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801231:	8b 45 08             	mov    0x8(%ebp),%eax
+  801234:	05 00 00 00 30       	add    $0x30000000,%eax
+  801239:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80123c:	5d                   	pop    %ebp
+  80123d:	c3                   	ret
+
+0080123e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80123e:	55                   	push   %ebp
+  80123f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801241:	8b 45 08             	mov    0x8(%ebp),%eax
+  801244:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801249:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80124e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801253:	5d                   	pop    %ebp
+  801254:	c3                   	ret
+
+00801255 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801255:	55                   	push   %ebp
+  801256:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801258:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  80125d:	a8 01                	test   $0x1,%al
+  80125f:	74 3c                	je     80129d <fd_alloc+0x48>
+  801261:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801266:	89 c2                	mov    %eax,%edx
+  801268:	c1 ea 0c             	shr    $0xc,%edx
+  80126b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801272:	89 c1                	mov    %eax,%ecx
+  801274:	05 00 10 00 00       	add    $0x1000,%eax
+  801279:	f6 c2 01             	test   $0x1,%dl
+  80127c:	74 13                	je     801291 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80127e:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801283:	75 e1                	jne    801266 <fd_alloc+0x11>
+  801285:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80128a:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80128f:	eb 05                	jmp    801296 <fd_alloc+0x41>
+			return 0;
+  801291:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801296:	8b 55 08             	mov    0x8(%ebp),%edx
+  801299:	89 0a                	mov    %ecx,(%edx)
+}
+  80129b:	5d                   	pop    %ebp
+  80129c:	c3                   	ret
+  80129d:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8012a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a7:	eb ed                	jmp    801296 <fd_alloc+0x41>
+
+008012a9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8012a9:	55                   	push   %ebp
+  8012aa:	89 e5                	mov    %esp,%ebp
+  8012ac:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8012af:	83 f8 1f             	cmp    $0x1f,%eax
+  8012b2:	77 30                	ja     8012e4 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8012b4:	c1 e0 0c             	shl    $0xc,%eax
+  8012b7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8012bc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012c2:	f6 c2 01             	test   $0x1,%dl
+  8012c5:	74 24                	je     8012eb <fd_lookup+0x42>
+  8012c7:	89 c2                	mov    %eax,%edx
+  8012c9:	c1 ea 0c             	shr    $0xc,%edx
+  8012cc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012d3:	f6 c2 01             	test   $0x1,%dl
+  8012d6:	74 1a                	je     8012f2 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8012d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012db:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8012dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012e2:	5d                   	pop    %ebp
+  8012e3:	c3                   	ret
+		return -E_INVAL;
+  8012e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012e9:	eb f7                	jmp    8012e2 <fd_lookup+0x39>
+		return -E_INVAL;
+  8012eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012f0:	eb f0                	jmp    8012e2 <fd_lookup+0x39>
+  8012f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012f7:	eb e9                	jmp    8012e2 <fd_lookup+0x39>
+
+008012f9 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8012f9:	55                   	push   %ebp
+  8012fa:	89 e5                	mov    %esp,%ebp
+  8012fc:	53                   	push   %ebx
+  8012fd:	83 ec 04             	sub    $0x4,%esp
+  801300:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801303:	b8 14 32 80 00       	mov    $0x803214,%eax
+  801308:	8b 18                	mov    (%eax),%ebx
+  80130a:	85 db                	test   %ebx,%ebx
+  80130c:	74 0e                	je     80131c <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  80130e:	83 c0 04             	add    $0x4,%eax
+  801311:	39 13                	cmp    %edx,(%ebx)
+  801313:	75 f3                	jne    801308 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801315:	b8 00 00 00 00       	mov    $0x0,%eax
+  80131a:	eb 1f                	jmp    80133b <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80131c:	a1 08 50 80 00       	mov    0x805008,%eax
+  801321:	8b 40 48             	mov    0x48(%eax),%eax
+  801324:	83 ec 04             	sub    $0x4,%esp
+  801327:	52                   	push   %edx
+  801328:	50                   	push   %eax
+  801329:	68 98 31 80 00       	push   $0x803198
+  80132e:	e8 86 ee ff ff       	call   8001b9 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801333:	83 c4 10             	add    $0x10,%esp
+  801336:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80133b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80133e:	89 1a                	mov    %ebx,(%edx)
+}
+  801340:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801343:	c9                   	leave
+  801344:	c3                   	ret
+
+00801345 <fd_close>:
+{
+  801345:	55                   	push   %ebp
+  801346:	89 e5                	mov    %esp,%ebp
+  801348:	57                   	push   %edi
+  801349:	56                   	push   %esi
+  80134a:	53                   	push   %ebx
+  80134b:	83 ec 24             	sub    $0x24,%esp
+  80134e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801351:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801354:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801357:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801358:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80135e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801361:	50                   	push   %eax
+  801362:	e8 42 ff ff ff       	call   8012a9 <fd_lookup>
+  801367:	89 c3                	mov    %eax,%ebx
+  801369:	83 c4 10             	add    $0x10,%esp
+  80136c:	85 c0                	test   %eax,%eax
+  80136e:	78 05                	js     801375 <fd_close+0x30>
+	    || fd != fd2)
+  801370:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801373:	74 16                	je     80138b <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801375:	89 f8                	mov    %edi,%eax
+  801377:	84 c0                	test   %al,%al
+  801379:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801381:	89 d8                	mov    %ebx,%eax
+  801383:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801386:	5b                   	pop    %ebx
+  801387:	5e                   	pop    %esi
+  801388:	5f                   	pop    %edi
+  801389:	5d                   	pop    %ebp
+  80138a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80138b:	83 ec 08             	sub    $0x8,%esp
+  80138e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801391:	50                   	push   %eax
+  801392:	ff 36                	push   (%esi)
+  801394:	e8 60 ff ff ff       	call   8012f9 <dev_lookup>
+  801399:	89 c3                	mov    %eax,%ebx
+  80139b:	83 c4 10             	add    $0x10,%esp
+  80139e:	85 c0                	test   %eax,%eax
+  8013a0:	78 1a                	js     8013bc <fd_close+0x77>
+		if (dev->dev_close)
+  8013a2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013a5:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8013a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8013ad:	85 c0                	test   %eax,%eax
+  8013af:	74 0b                	je     8013bc <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8013b1:	83 ec 0c             	sub    $0xc,%esp
+  8013b4:	56                   	push   %esi
+  8013b5:	ff d0                	call   *%eax
+  8013b7:	89 c3                	mov    %eax,%ebx
+  8013b9:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8013bc:	83 ec 08             	sub    $0x8,%esp
+  8013bf:	56                   	push   %esi
+  8013c0:	6a 00                	push   $0x0
+  8013c2:	e8 51 f9 ff ff       	call   800d18 <sys_page_unmap>
+	return r;
+  8013c7:	83 c4 10             	add    $0x10,%esp
+  8013ca:	eb b5                	jmp    801381 <fd_close+0x3c>
+
+008013cc <close>:
+
+int
+close(int fdnum)
+{
+  8013cc:	55                   	push   %ebp
+  8013cd:	89 e5                	mov    %esp,%ebp
+  8013cf:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013d5:	50                   	push   %eax
+  8013d6:	ff 75 08             	push   0x8(%ebp)
+  8013d9:	e8 cb fe ff ff       	call   8012a9 <fd_lookup>
+  8013de:	83 c4 10             	add    $0x10,%esp
+  8013e1:	85 c0                	test   %eax,%eax
+  8013e3:	79 02                	jns    8013e7 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8013e5:	c9                   	leave
+  8013e6:	c3                   	ret
+		return fd_close(fd, 1);
+  8013e7:	83 ec 08             	sub    $0x8,%esp
+  8013ea:	6a 01                	push   $0x1
+  8013ec:	ff 75 f4             	push   -0xc(%ebp)
+  8013ef:	e8 51 ff ff ff       	call   801345 <fd_close>
+  8013f4:	83 c4 10             	add    $0x10,%esp
+  8013f7:	eb ec                	jmp    8013e5 <close+0x19>
+
+008013f9 <close_all>:
+
+void
+close_all(void)
+{
+  8013f9:	55                   	push   %ebp
+  8013fa:	89 e5                	mov    %esp,%ebp
+  8013fc:	53                   	push   %ebx
+  8013fd:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801400:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801405:	83 ec 0c             	sub    $0xc,%esp
+  801408:	53                   	push   %ebx
+  801409:	e8 be ff ff ff       	call   8013cc <close>
+	for (i = 0; i < MAXFD; i++)
+  80140e:	83 c3 01             	add    $0x1,%ebx
+  801411:	83 c4 10             	add    $0x10,%esp
+  801414:	83 fb 20             	cmp    $0x20,%ebx
+  801417:	75 ec                	jne    801405 <close_all+0xc>
+}
+  801419:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80141c:	c9                   	leave
+  80141d:	c3                   	ret
+
+0080141e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80141e:	55                   	push   %ebp
+  80141f:	89 e5                	mov    %esp,%ebp
+  801421:	57                   	push   %edi
+  801422:	56                   	push   %esi
+  801423:	53                   	push   %ebx
+  801424:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801427:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80142a:	50                   	push   %eax
+  80142b:	ff 75 08             	push   0x8(%ebp)
+  80142e:	e8 76 fe ff ff       	call   8012a9 <fd_lookup>
+  801433:	89 c3                	mov    %eax,%ebx
+  801435:	83 c4 10             	add    $0x10,%esp
+  801438:	85 c0                	test   %eax,%eax
+  80143a:	78 7f                	js     8014bb <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80143c:	83 ec 0c             	sub    $0xc,%esp
+  80143f:	ff 75 0c             	push   0xc(%ebp)
+  801442:	e8 85 ff ff ff       	call   8013cc <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801447:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80144a:	c1 e6 0c             	shl    $0xc,%esi
+  80144d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801453:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801456:	89 3c 24             	mov    %edi,(%esp)
+  801459:	e8 e0 fd ff ff       	call   80123e <fd2data>
+  80145e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801460:	89 34 24             	mov    %esi,(%esp)
+  801463:	e8 d6 fd ff ff       	call   80123e <fd2data>
+  801468:	83 c4 10             	add    $0x10,%esp
+  80146b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80146e:	89 d8                	mov    %ebx,%eax
+  801470:	c1 e8 16             	shr    $0x16,%eax
+  801473:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80147a:	a8 01                	test   $0x1,%al
+  80147c:	74 11                	je     80148f <dup+0x71>
+  80147e:	89 d8                	mov    %ebx,%eax
+  801480:	c1 e8 0c             	shr    $0xc,%eax
+  801483:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80148a:	f6 c2 01             	test   $0x1,%dl
+  80148d:	75 36                	jne    8014c5 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80148f:	89 f8                	mov    %edi,%eax
+  801491:	c1 e8 0c             	shr    $0xc,%eax
+  801494:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80149b:	83 ec 0c             	sub    $0xc,%esp
+  80149e:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014a3:	50                   	push   %eax
+  8014a4:	56                   	push   %esi
+  8014a5:	6a 00                	push   $0x0
+  8014a7:	57                   	push   %edi
+  8014a8:	6a 00                	push   $0x0
+  8014aa:	e8 27 f8 ff ff       	call   800cd6 <sys_page_map>
+  8014af:	89 c3                	mov    %eax,%ebx
+  8014b1:	83 c4 20             	add    $0x20,%esp
+  8014b4:	85 c0                	test   %eax,%eax
+  8014b6:	78 33                	js     8014eb <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8014b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8014bb:	89 d8                	mov    %ebx,%eax
+  8014bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c0:	5b                   	pop    %ebx
+  8014c1:	5e                   	pop    %esi
+  8014c2:	5f                   	pop    %edi
+  8014c3:	5d                   	pop    %ebp
+  8014c4:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8014c5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014cc:	83 ec 0c             	sub    $0xc,%esp
+  8014cf:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014d4:	50                   	push   %eax
+  8014d5:	ff 75 d4             	push   -0x2c(%ebp)
+  8014d8:	6a 00                	push   $0x0
+  8014da:	53                   	push   %ebx
+  8014db:	6a 00                	push   $0x0
+  8014dd:	e8 f4 f7 ff ff       	call   800cd6 <sys_page_map>
+  8014e2:	89 c3                	mov    %eax,%ebx
+  8014e4:	83 c4 20             	add    $0x20,%esp
+  8014e7:	85 c0                	test   %eax,%eax
+  8014e9:	79 a4                	jns    80148f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8014eb:	83 ec 08             	sub    $0x8,%esp
+  8014ee:	56                   	push   %esi
+  8014ef:	6a 00                	push   $0x0
+  8014f1:	e8 22 f8 ff ff       	call   800d18 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8014f6:	83 c4 08             	add    $0x8,%esp
+  8014f9:	ff 75 d4             	push   -0x2c(%ebp)
+  8014fc:	6a 00                	push   $0x0
+  8014fe:	e8 15 f8 ff ff       	call   800d18 <sys_page_unmap>
+	return r;
+  801503:	83 c4 10             	add    $0x10,%esp
+  801506:	eb b3                	jmp    8014bb <dup+0x9d>
+
+00801508 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801508:	55                   	push   %ebp
+  801509:	89 e5                	mov    %esp,%ebp
+  80150b:	56                   	push   %esi
+  80150c:	53                   	push   %ebx
+  80150d:	83 ec 18             	sub    $0x18,%esp
+  801510:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801513:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801516:	50                   	push   %eax
+  801517:	56                   	push   %esi
+  801518:	e8 8c fd ff ff       	call   8012a9 <fd_lookup>
+  80151d:	83 c4 10             	add    $0x10,%esp
+  801520:	85 c0                	test   %eax,%eax
+  801522:	78 3c                	js     801560 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801524:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801527:	83 ec 08             	sub    $0x8,%esp
+  80152a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80152d:	50                   	push   %eax
+  80152e:	ff 33                	push   (%ebx)
+  801530:	e8 c4 fd ff ff       	call   8012f9 <dev_lookup>
+  801535:	83 c4 10             	add    $0x10,%esp
+  801538:	85 c0                	test   %eax,%eax
+  80153a:	78 24                	js     801560 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80153c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80153f:	83 e0 03             	and    $0x3,%eax
+  801542:	83 f8 01             	cmp    $0x1,%eax
+  801545:	74 20                	je     801567 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801547:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80154a:	8b 40 08             	mov    0x8(%eax),%eax
+  80154d:	85 c0                	test   %eax,%eax
+  80154f:	74 37                	je     801588 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801551:	83 ec 04             	sub    $0x4,%esp
+  801554:	ff 75 10             	push   0x10(%ebp)
+  801557:	ff 75 0c             	push   0xc(%ebp)
+  80155a:	53                   	push   %ebx
+  80155b:	ff d0                	call   *%eax
+  80155d:	83 c4 10             	add    $0x10,%esp
+}
+  801560:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801563:	5b                   	pop    %ebx
+  801564:	5e                   	pop    %esi
+  801565:	5d                   	pop    %ebp
+  801566:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801567:	a1 08 50 80 00       	mov    0x805008,%eax
+  80156c:	8b 40 48             	mov    0x48(%eax),%eax
+  80156f:	83 ec 04             	sub    $0x4,%esp
+  801572:	56                   	push   %esi
+  801573:	50                   	push   %eax
+  801574:	68 d9 31 80 00       	push   $0x8031d9
+  801579:	e8 3b ec ff ff       	call   8001b9 <cprintf>
+		return -E_INVAL;
+  80157e:	83 c4 10             	add    $0x10,%esp
+  801581:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801586:	eb d8                	jmp    801560 <read+0x58>
+		return -E_NOT_SUPP;
+  801588:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80158d:	eb d1                	jmp    801560 <read+0x58>
+
+0080158f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80158f:	55                   	push   %ebp
+  801590:	89 e5                	mov    %esp,%ebp
+  801592:	57                   	push   %edi
+  801593:	56                   	push   %esi
+  801594:	53                   	push   %ebx
+  801595:	83 ec 0c             	sub    $0xc,%esp
+  801598:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80159b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80159e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a3:	eb 02                	jmp    8015a7 <readn+0x18>
+  8015a5:	01 c3                	add    %eax,%ebx
+  8015a7:	39 f3                	cmp    %esi,%ebx
+  8015a9:	73 21                	jae    8015cc <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015ab:	83 ec 04             	sub    $0x4,%esp
+  8015ae:	89 f0                	mov    %esi,%eax
+  8015b0:	29 d8                	sub    %ebx,%eax
+  8015b2:	50                   	push   %eax
+  8015b3:	89 d8                	mov    %ebx,%eax
+  8015b5:	03 45 0c             	add    0xc(%ebp),%eax
+  8015b8:	50                   	push   %eax
+  8015b9:	57                   	push   %edi
+  8015ba:	e8 49 ff ff ff       	call   801508 <read>
+		if (m < 0)
+  8015bf:	83 c4 10             	add    $0x10,%esp
+  8015c2:	85 c0                	test   %eax,%eax
+  8015c4:	78 04                	js     8015ca <readn+0x3b>
+			return m;
+		if (m == 0)
+  8015c6:	75 dd                	jne    8015a5 <readn+0x16>
+  8015c8:	eb 02                	jmp    8015cc <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015ca:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8015cc:	89 d8                	mov    %ebx,%eax
+  8015ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015d1:	5b                   	pop    %ebx
+  8015d2:	5e                   	pop    %esi
+  8015d3:	5f                   	pop    %edi
+  8015d4:	5d                   	pop    %ebp
+  8015d5:	c3                   	ret
+
+008015d6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8015d6:	55                   	push   %ebp
+  8015d7:	89 e5                	mov    %esp,%ebp
+  8015d9:	56                   	push   %esi
+  8015da:	53                   	push   %ebx
+  8015db:	83 ec 18             	sub    $0x18,%esp
+  8015de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015e1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015e4:	50                   	push   %eax
+  8015e5:	53                   	push   %ebx
+  8015e6:	e8 be fc ff ff       	call   8012a9 <fd_lookup>
+  8015eb:	83 c4 10             	add    $0x10,%esp
+  8015ee:	85 c0                	test   %eax,%eax
+  8015f0:	78 37                	js     801629 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015f2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015f5:	83 ec 08             	sub    $0x8,%esp
+  8015f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015fb:	50                   	push   %eax
+  8015fc:	ff 36                	push   (%esi)
+  8015fe:	e8 f6 fc ff ff       	call   8012f9 <dev_lookup>
+  801603:	83 c4 10             	add    $0x10,%esp
+  801606:	85 c0                	test   %eax,%eax
+  801608:	78 1f                	js     801629 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80160a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80160e:	74 20                	je     801630 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801610:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801613:	8b 40 0c             	mov    0xc(%eax),%eax
+  801616:	85 c0                	test   %eax,%eax
+  801618:	74 37                	je     801651 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80161a:	83 ec 04             	sub    $0x4,%esp
+  80161d:	ff 75 10             	push   0x10(%ebp)
+  801620:	ff 75 0c             	push   0xc(%ebp)
+  801623:	56                   	push   %esi
+  801624:	ff d0                	call   *%eax
+  801626:	83 c4 10             	add    $0x10,%esp
+}
+  801629:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80162c:	5b                   	pop    %ebx
+  80162d:	5e                   	pop    %esi
+  80162e:	5d                   	pop    %ebp
+  80162f:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801630:	a1 08 50 80 00       	mov    0x805008,%eax
+  801635:	8b 40 48             	mov    0x48(%eax),%eax
+  801638:	83 ec 04             	sub    $0x4,%esp
+  80163b:	53                   	push   %ebx
+  80163c:	50                   	push   %eax
+  80163d:	68 f5 31 80 00       	push   $0x8031f5
+  801642:	e8 72 eb ff ff       	call   8001b9 <cprintf>
+		return -E_INVAL;
+  801647:	83 c4 10             	add    $0x10,%esp
+  80164a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80164f:	eb d8                	jmp    801629 <write+0x53>
+		return -E_NOT_SUPP;
+  801651:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801656:	eb d1                	jmp    801629 <write+0x53>
+
+00801658 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801658:	55                   	push   %ebp
+  801659:	89 e5                	mov    %esp,%ebp
+  80165b:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80165e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801661:	50                   	push   %eax
+  801662:	ff 75 08             	push   0x8(%ebp)
+  801665:	e8 3f fc ff ff       	call   8012a9 <fd_lookup>
+  80166a:	83 c4 10             	add    $0x10,%esp
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	78 0e                	js     80167f <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801671:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801674:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801677:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80167a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80167f:	c9                   	leave
+  801680:	c3                   	ret
+
+00801681 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801681:	55                   	push   %ebp
+  801682:	89 e5                	mov    %esp,%ebp
+  801684:	56                   	push   %esi
+  801685:	53                   	push   %ebx
+  801686:	83 ec 18             	sub    $0x18,%esp
+  801689:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80168c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80168f:	50                   	push   %eax
+  801690:	53                   	push   %ebx
+  801691:	e8 13 fc ff ff       	call   8012a9 <fd_lookup>
+  801696:	83 c4 10             	add    $0x10,%esp
+  801699:	85 c0                	test   %eax,%eax
+  80169b:	78 34                	js     8016d1 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80169d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016a0:	83 ec 08             	sub    $0x8,%esp
+  8016a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016a6:	50                   	push   %eax
+  8016a7:	ff 36                	push   (%esi)
+  8016a9:	e8 4b fc ff ff       	call   8012f9 <dev_lookup>
+  8016ae:	83 c4 10             	add    $0x10,%esp
+  8016b1:	85 c0                	test   %eax,%eax
+  8016b3:	78 1c                	js     8016d1 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016b5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016b9:	74 1d                	je     8016d8 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8016bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016be:	8b 40 18             	mov    0x18(%eax),%eax
+  8016c1:	85 c0                	test   %eax,%eax
+  8016c3:	74 34                	je     8016f9 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8016c5:	83 ec 08             	sub    $0x8,%esp
+  8016c8:	ff 75 0c             	push   0xc(%ebp)
+  8016cb:	56                   	push   %esi
+  8016cc:	ff d0                	call   *%eax
+  8016ce:	83 c4 10             	add    $0x10,%esp
+}
+  8016d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016d4:	5b                   	pop    %ebx
+  8016d5:	5e                   	pop    %esi
+  8016d6:	5d                   	pop    %ebp
+  8016d7:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8016d8:	a1 08 50 80 00       	mov    0x805008,%eax
+  8016dd:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8016e0:	83 ec 04             	sub    $0x4,%esp
+  8016e3:	53                   	push   %ebx
+  8016e4:	50                   	push   %eax
+  8016e5:	68 b8 31 80 00       	push   $0x8031b8
+  8016ea:	e8 ca ea ff ff       	call   8001b9 <cprintf>
+		return -E_INVAL;
+  8016ef:	83 c4 10             	add    $0x10,%esp
+  8016f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016f7:	eb d8                	jmp    8016d1 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8016f9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016fe:	eb d1                	jmp    8016d1 <ftruncate+0x50>
+
+00801700 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801700:	55                   	push   %ebp
+  801701:	89 e5                	mov    %esp,%ebp
+  801703:	56                   	push   %esi
+  801704:	53                   	push   %ebx
+  801705:	83 ec 18             	sub    $0x18,%esp
+  801708:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80170b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80170e:	50                   	push   %eax
+  80170f:	ff 75 08             	push   0x8(%ebp)
+  801712:	e8 92 fb ff ff       	call   8012a9 <fd_lookup>
+  801717:	83 c4 10             	add    $0x10,%esp
+  80171a:	85 c0                	test   %eax,%eax
+  80171c:	78 49                	js     801767 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80171e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801721:	83 ec 08             	sub    $0x8,%esp
+  801724:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801727:	50                   	push   %eax
+  801728:	ff 36                	push   (%esi)
+  80172a:	e8 ca fb ff ff       	call   8012f9 <dev_lookup>
+  80172f:	83 c4 10             	add    $0x10,%esp
+  801732:	85 c0                	test   %eax,%eax
+  801734:	78 31                	js     801767 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801736:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801739:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80173d:	74 2f                	je     80176e <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80173f:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801742:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801749:	00 00 00 
+	stat->st_isdir = 0;
+  80174c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801753:	00 00 00 
+	stat->st_dev = dev;
+  801756:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80175c:	83 ec 08             	sub    $0x8,%esp
+  80175f:	53                   	push   %ebx
+  801760:	56                   	push   %esi
+  801761:	ff 50 14             	call   *0x14(%eax)
+  801764:	83 c4 10             	add    $0x10,%esp
+}
+  801767:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80176a:	5b                   	pop    %ebx
+  80176b:	5e                   	pop    %esi
+  80176c:	5d                   	pop    %ebp
+  80176d:	c3                   	ret
+		return -E_NOT_SUPP;
+  80176e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801773:	eb f2                	jmp    801767 <fstat+0x67>
+
+00801775 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801775:	55                   	push   %ebp
+  801776:	89 e5                	mov    %esp,%ebp
+  801778:	56                   	push   %esi
+  801779:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80177a:	83 ec 08             	sub    $0x8,%esp
+  80177d:	6a 00                	push   $0x0
+  80177f:	ff 75 08             	push   0x8(%ebp)
+  801782:	e8 bc 02 00 00       	call   801a43 <open>
+  801787:	89 c3                	mov    %eax,%ebx
+  801789:	83 c4 10             	add    $0x10,%esp
+  80178c:	85 c0                	test   %eax,%eax
+  80178e:	78 1b                	js     8017ab <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801790:	83 ec 08             	sub    $0x8,%esp
+  801793:	ff 75 0c             	push   0xc(%ebp)
+  801796:	50                   	push   %eax
+  801797:	e8 64 ff ff ff       	call   801700 <fstat>
+  80179c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80179e:	89 1c 24             	mov    %ebx,(%esp)
+  8017a1:	e8 26 fc ff ff       	call   8013cc <close>
+	return r;
+  8017a6:	83 c4 10             	add    $0x10,%esp
+  8017a9:	89 f3                	mov    %esi,%ebx
+}
+  8017ab:	89 d8                	mov    %ebx,%eax
+  8017ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017b0:	5b                   	pop    %ebx
+  8017b1:	5e                   	pop    %esi
+  8017b2:	5d                   	pop    %ebp
+  8017b3:	c3                   	ret
+
+008017b4 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  8017b4:	55                   	push   %ebp
+  8017b5:	89 e5                	mov    %esp,%ebp
+  8017b7:	57                   	push   %edi
+  8017b8:	56                   	push   %esi
+  8017b9:	53                   	push   %ebx
+  8017ba:	83 ec 0c             	sub    $0xc,%esp
+  8017bd:	89 c7                	mov    %eax,%edi
+  8017bf:	89 d3                	mov    %edx,%ebx
+  8017c1:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8017c3:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8017ca:	74 2d                	je     8017f9 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017cc:	6a 07                	push   $0x7
+  8017ce:	68 00 60 80 00       	push   $0x806000
+  8017d3:	57                   	push   %edi
+  8017d4:	ff 35 00 50 80 00    	push   0x805000
+  8017da:	e8 53 12 00 00       	call   802a32 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  8017df:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8017e6:	6a 00                	push   $0x0
+  8017e8:	56                   	push   %esi
+  8017e9:	53                   	push   %ebx
+  8017ea:	6a 00                	push   $0x0
+  8017ec:	e8 f3 10 00 00       	call   8028e4 <ipc_recv_pages>
+}
+  8017f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f4:	5b                   	pop    %ebx
+  8017f5:	5e                   	pop    %esi
+  8017f6:	5f                   	pop    %edi
+  8017f7:	5d                   	pop    %ebp
+  8017f8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017f9:	83 ec 0c             	sub    $0xc,%esp
+  8017fc:	6a 01                	push   $0x1
+  8017fe:	e8 24 13 00 00       	call   802b27 <ipc_find_env>
+  801803:	a3 00 50 80 00       	mov    %eax,0x805000
+  801808:	83 c4 10             	add    $0x10,%esp
+  80180b:	eb bf                	jmp    8017cc <fsipc_pages+0x18>
+
+0080180d <fsipc>:
+{
+  80180d:	55                   	push   %ebp
+  80180e:	89 e5                	mov    %esp,%ebp
+  801810:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801813:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801818:	e8 97 ff ff ff       	call   8017b4 <fsipc_pages>
+}
+  80181d:	c9                   	leave
+  80181e:	c3                   	ret
+
+0080181f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80181f:	55                   	push   %ebp
+  801820:	89 e5                	mov    %esp,%ebp
+  801822:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801825:	8b 45 08             	mov    0x8(%ebp),%eax
+  801828:	8b 40 0c             	mov    0xc(%eax),%eax
+  80182b:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801830:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801833:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801838:	ba 00 00 00 00       	mov    $0x0,%edx
+  80183d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801842:	e8 c6 ff ff ff       	call   80180d <fsipc>
+}
+  801847:	c9                   	leave
+  801848:	c3                   	ret
+
+00801849 <devfile_flush>:
+{
+  801849:	55                   	push   %ebp
+  80184a:	89 e5                	mov    %esp,%ebp
+  80184c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80184f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801852:	8b 40 0c             	mov    0xc(%eax),%eax
+  801855:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80185a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80185f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801864:	e8 a4 ff ff ff       	call   80180d <fsipc>
+}
+  801869:	c9                   	leave
+  80186a:	c3                   	ret
+
+0080186b <devfile_stat>:
+{
+  80186b:	55                   	push   %ebp
+  80186c:	89 e5                	mov    %esp,%ebp
+  80186e:	53                   	push   %ebx
+  80186f:	83 ec 04             	sub    $0x4,%esp
+  801872:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801875:	8b 45 08             	mov    0x8(%ebp),%eax
+  801878:	8b 40 0c             	mov    0xc(%eax),%eax
+  80187b:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801880:	ba 00 00 00 00       	mov    $0x0,%edx
+  801885:	b8 05 00 00 00       	mov    $0x5,%eax
+  80188a:	e8 7e ff ff ff       	call   80180d <fsipc>
+  80188f:	85 c0                	test   %eax,%eax
+  801891:	78 2c                	js     8018bf <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801893:	83 ec 08             	sub    $0x8,%esp
+  801896:	68 00 60 80 00       	push   $0x806000
+  80189b:	53                   	push   %ebx
+  80189c:	e8 ff ee ff ff       	call   8007a0 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8018a1:	a1 80 60 80 00       	mov    0x806080,%eax
+  8018a6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018ac:	a1 84 60 80 00       	mov    0x806084,%eax
+  8018b1:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8018b7:	83 c4 10             	add    $0x10,%esp
+  8018ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018c2:	c9                   	leave
+  8018c3:	c3                   	ret
+
+008018c4 <devfile_write>:
+{
+  8018c4:	55                   	push   %ebp
+  8018c5:	89 e5                	mov    %esp,%ebp
+  8018c7:	83 ec 0c             	sub    $0xc,%esp
+  8018ca:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8018cd:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8018d2:	39 d0                	cmp    %edx,%eax
+  8018d4:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8018d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018da:	8b 52 0c             	mov    0xc(%edx),%edx
+  8018dd:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8018e3:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8018e8:	50                   	push   %eax
+  8018e9:	ff 75 0c             	push   0xc(%ebp)
+  8018ec:	68 08 60 80 00       	push   $0x806008
+  8018f1:	e8 30 f0 ff ff       	call   800926 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8018f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018fb:	b8 04 00 00 00       	mov    $0x4,%eax
+  801900:	e8 08 ff ff ff       	call   80180d <fsipc>
+}
+  801905:	c9                   	leave
+  801906:	c3                   	ret
+
+00801907 <devfile_read>:
+{
+  801907:	55                   	push   %ebp
+  801908:	89 e5                	mov    %esp,%ebp
+  80190a:	57                   	push   %edi
+  80190b:	56                   	push   %esi
+  80190c:	53                   	push   %ebx
+  80190d:	83 ec 1c             	sub    $0x1c,%esp
+  801910:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801913:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801916:	89 fe                	mov    %edi,%esi
+  801918:	c1 ee 0c             	shr    $0xc,%esi
+  80191b:	b8 20 00 00 00       	mov    $0x20,%eax
+  801920:	39 c6                	cmp    %eax,%esi
+  801922:	0f 47 f0             	cmova  %eax,%esi
+  801925:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801928:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80192d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801930:	eb 14                	jmp    801946 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801932:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801939:	05 00 10 00 00       	add    $0x1000,%eax
+  80193e:	f6 c6 06             	test   $0x6,%dh
+  801941:	75 42                	jne    801985 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801943:	83 c1 01             	add    $0x1,%ecx
+  801946:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801949:	39 f1                	cmp    %esi,%ecx
+  80194b:	0f 84 95 00 00 00    	je     8019e6 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801951:	89 c2                	mov    %eax,%edx
+  801953:	c1 ea 16             	shr    $0x16,%edx
+  801956:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  80195d:	f6 c2 01             	test   $0x1,%dl
+  801960:	74 23                	je     801985 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801962:	89 c2                	mov    %eax,%edx
+  801964:	c1 ea 0c             	shr    $0xc,%edx
+  801967:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  80196e:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801974:	74 0f                	je     801985 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801976:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  80197d:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801983:	75 ad                	jne    801932 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801985:	85 c9                	test   %ecx,%ecx
+  801987:	74 11                	je     80199a <devfile_read+0x93>
+  801989:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801990:	75 08                	jne    80199a <devfile_read+0x93>
+  801992:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801998:	74 50                	je     8019ea <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80199a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80199d:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8019a2:	89 3d 04 60 80 00    	mov    %edi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8019a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ad:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019b2:	e8 56 fe ff ff       	call   80180d <fsipc>
+  8019b7:	89 c6                	mov    %eax,%esi
+  8019b9:	85 c0                	test   %eax,%eax
+  8019bb:	78 1f                	js     8019dc <devfile_read+0xd5>
+	assert(r <= n);
+  8019bd:	39 c7                	cmp    %eax,%edi
+  8019bf:	72 50                	jb     801a11 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  8019c1:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8019c6:	7f 62                	jg     801a2a <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  8019c8:	83 ec 04             	sub    $0x4,%esp
+  8019cb:	50                   	push   %eax
+  8019cc:	68 00 60 80 00       	push   $0x806000
+  8019d1:	ff 75 0c             	push   0xc(%ebp)
+  8019d4:	e8 4d ef ff ff       	call   800926 <memmove>
+	return r;
+  8019d9:	83 c4 10             	add    $0x10,%esp
+}
+  8019dc:	89 f0                	mov    %esi,%eax
+  8019de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019e1:	5b                   	pop    %ebx
+  8019e2:	5e                   	pop    %esi
+  8019e3:	5f                   	pop    %edi
+  8019e4:	5d                   	pop    %ebp
+  8019e5:	c3                   	ret
+  8019e6:	89 f1                	mov    %esi,%ecx
+  8019e8:	eb 9b                	jmp    801985 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  8019ea:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8019ed:	a3 00 60 80 00       	mov    %eax,0x806000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  8019f2:	89 c8                	mov    %ecx,%eax
+  8019f4:	c1 e0 0c             	shl    $0xc,%eax
+  8019f7:	a3 04 60 80 00       	mov    %eax,0x806004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  8019fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019ff:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801a04:	e8 ab fd ff ff       	call   8017b4 <fsipc_pages>
+  801a09:	89 c6                	mov    %eax,%esi
+  801a0b:	85 c0                	test   %eax,%eax
+  801a0d:	78 8b                	js     80199a <devfile_read+0x93>
+  801a0f:	eb cb                	jmp    8019dc <devfile_read+0xd5>
+	assert(r <= n);
+  801a11:	68 24 32 80 00       	push   $0x803224
+  801a16:	68 2b 32 80 00       	push   $0x80322b
+  801a1b:	68 a0 00 00 00       	push   $0xa0
+  801a20:	68 40 32 80 00       	push   $0x803240
+  801a25:	e8 b4 e6 ff ff       	call   8000de <_panic>
+	assert(r <= PGSIZE);
+  801a2a:	68 4b 32 80 00       	push   $0x80324b
+  801a2f:	68 2b 32 80 00       	push   $0x80322b
+  801a34:	68 a1 00 00 00       	push   $0xa1
+  801a39:	68 40 32 80 00       	push   $0x803240
+  801a3e:	e8 9b e6 ff ff       	call   8000de <_panic>
+
+00801a43 <open>:
+{
+  801a43:	55                   	push   %ebp
+  801a44:	89 e5                	mov    %esp,%ebp
+  801a46:	56                   	push   %esi
+  801a47:	53                   	push   %ebx
+  801a48:	83 ec 1c             	sub    $0x1c,%esp
+  801a4b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801a4e:	56                   	push   %esi
+  801a4f:	e8 11 ed ff ff       	call   800765 <strlen>
+  801a54:	83 c4 10             	add    $0x10,%esp
+  801a57:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a5c:	7f 6c                	jg     801aca <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801a5e:	83 ec 0c             	sub    $0xc,%esp
+  801a61:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a64:	50                   	push   %eax
+  801a65:	e8 eb f7 ff ff       	call   801255 <fd_alloc>
+  801a6a:	89 c3                	mov    %eax,%ebx
+  801a6c:	83 c4 10             	add    $0x10,%esp
+  801a6f:	85 c0                	test   %eax,%eax
+  801a71:	78 3c                	js     801aaf <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801a73:	83 ec 08             	sub    $0x8,%esp
+  801a76:	56                   	push   %esi
+  801a77:	68 00 60 80 00       	push   $0x806000
+  801a7c:	e8 1f ed ff ff       	call   8007a0 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a84:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801a89:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a8c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a91:	e8 77 fd ff ff       	call   80180d <fsipc>
+  801a96:	89 c3                	mov    %eax,%ebx
+  801a98:	83 c4 10             	add    $0x10,%esp
+  801a9b:	85 c0                	test   %eax,%eax
+  801a9d:	78 19                	js     801ab8 <open+0x75>
+	return fd2num(fd);
+  801a9f:	83 ec 0c             	sub    $0xc,%esp
+  801aa2:	ff 75 f4             	push   -0xc(%ebp)
+  801aa5:	e8 84 f7 ff ff       	call   80122e <fd2num>
+  801aaa:	89 c3                	mov    %eax,%ebx
+  801aac:	83 c4 10             	add    $0x10,%esp
+}
+  801aaf:	89 d8                	mov    %ebx,%eax
+  801ab1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ab4:	5b                   	pop    %ebx
+  801ab5:	5e                   	pop    %esi
+  801ab6:	5d                   	pop    %ebp
+  801ab7:	c3                   	ret
+		fd_close(fd, 0);
+  801ab8:	83 ec 08             	sub    $0x8,%esp
+  801abb:	6a 00                	push   $0x0
+  801abd:	ff 75 f4             	push   -0xc(%ebp)
+  801ac0:	e8 80 f8 ff ff       	call   801345 <fd_close>
+		return r;
+  801ac5:	83 c4 10             	add    $0x10,%esp
+  801ac8:	eb e5                	jmp    801aaf <open+0x6c>
+		return -E_BAD_PATH;
+  801aca:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801acf:	eb de                	jmp    801aaf <open+0x6c>
+
+00801ad1 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801ad1:	55                   	push   %ebp
+  801ad2:	89 e5                	mov    %esp,%ebp
+  801ad4:	53                   	push   %ebx
+  801ad5:	83 ec 10             	sub    $0x10,%esp
+  801ad8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801adb:	53                   	push   %ebx
+  801adc:	e8 84 ec ff ff       	call   800765 <strlen>
+  801ae1:	83 c4 10             	add    $0x10,%esp
+  801ae4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ae9:	7f 25                	jg     801b10 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801aeb:	83 ec 08             	sub    $0x8,%esp
+  801aee:	53                   	push   %ebx
+  801aef:	68 00 60 80 00       	push   $0x806000
+  801af4:	e8 a7 ec ff ff       	call   8007a0 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801af9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801afe:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b03:	e8 05 fd ff ff       	call   80180d <fsipc>
+  801b08:	83 c4 10             	add    $0x10,%esp
+}
+  801b0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b0e:	c9                   	leave
+  801b0f:	c3                   	ret
+		return -E_BAD_PATH;
+  801b10:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b15:	eb f4                	jmp    801b0b <remove+0x3a>
+
+00801b17 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b17:	55                   	push   %ebp
+  801b18:	89 e5                	mov    %esp,%ebp
+  801b1a:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b22:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b27:	e8 e1 fc ff ff       	call   80180d <fsipc>
+}
+  801b2c:	c9                   	leave
+  801b2d:	c3                   	ret
+
+00801b2e <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801b2e:	55                   	push   %ebp
+  801b2f:	89 e5                	mov    %esp,%ebp
+  801b31:	53                   	push   %ebx
+  801b32:	83 ec 04             	sub    $0x4,%esp
+  801b35:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801b38:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801b42:	e8 c6 fc ff ff       	call   80180d <fsipc>
+  801b47:	85 c0                	test   %eax,%eax
+  801b49:	78 3c                	js     801b87 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801b4b:	a1 00 60 80 00       	mov    0x806000,%eax
+  801b50:	89 03                	mov    %eax,(%ebx)
+  801b52:	a1 04 60 80 00       	mov    0x806004,%eax
+  801b57:	89 43 04             	mov    %eax,0x4(%ebx)
+  801b5a:	a1 08 60 80 00       	mov    0x806008,%eax
+  801b5f:	89 43 08             	mov    %eax,0x8(%ebx)
+  801b62:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  801b67:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801b6a:	a1 10 60 80 00       	mov    0x806010,%eax
+  801b6f:	89 43 10             	mov    %eax,0x10(%ebx)
+  801b72:	a1 14 60 80 00       	mov    0x806014,%eax
+  801b77:	89 43 14             	mov    %eax,0x14(%ebx)
+  801b7a:	a1 18 60 80 00       	mov    0x806018,%eax
+  801b7f:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801b82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b8a:	c9                   	leave
+  801b8b:	c3                   	ret
+
+00801b8c <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801b8c:	55                   	push   %ebp
+  801b8d:	89 e5                	mov    %esp,%ebp
+  801b8f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801b92:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b95:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_BCSET, NULL);
+  801b9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b9f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801ba4:	e8 64 fc ff ff       	call   80180d <fsipc>
+}
+  801ba9:	c9                   	leave
+  801baa:	c3                   	ret
+
+00801bab <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  801bab:	55                   	push   %ebp
+  801bac:	89 e5                	mov    %esp,%ebp
+  801bae:	57                   	push   %edi
+  801baf:	56                   	push   %esi
+  801bb0:	53                   	push   %ebx
+  801bb1:	81 ec 14 03 00 00    	sub    $0x314,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  801bb7:	6a 00                	push   $0x0
+  801bb9:	ff 75 08             	push   0x8(%ebp)
+  801bbc:	e8 82 fe ff ff       	call   801a43 <open>
+  801bc1:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  801bc7:	83 c4 10             	add    $0x10,%esp
+  801bca:	85 c0                	test   %eax,%eax
+  801bcc:	0f 88 06 06 00 00    	js     8021d8 <spawn+0x62d>
+  801bd2:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  801bd4:	83 ec 04             	sub    $0x4,%esp
+  801bd7:	68 00 02 00 00       	push   $0x200
+  801bdc:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  801be2:	50                   	push   %eax
+  801be3:	51                   	push   %ecx
+  801be4:	e8 a6 f9 ff ff       	call   80158f <readn>
+  801be9:	83 c4 10             	add    $0x10,%esp
+  801bec:	3d 00 02 00 00       	cmp    $0x200,%eax
+  801bf1:	75 74                	jne    801c67 <spawn+0xbc>
+	    || elf->e_magic != ELF_MAGIC) {
+  801bf3:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  801bfa:	45 4c 46 
+  801bfd:	75 68                	jne    801c67 <spawn+0xbc>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801bff:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c04:	cd 30                	int    $0x30
+  801c06:	89 85 0c fd ff ff    	mov    %eax,-0x2f4(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  801c0c:	85 c0                	test   %eax,%eax
+  801c0e:	0f 88 b8 05 00 00    	js     8021cc <spawn+0x621>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  801c14:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c19:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  801c1c:	c1 e6 06             	shl    $0x6,%esi
+  801c1f:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801c25:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  801c2b:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801c30:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  801c32:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  801c38:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  801c3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  801c43:	be 00 00 00 00       	mov    $0x0,%esi
+  801c48:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  801c4b:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  801c4e:	85 c0                	test   %eax,%eax
+  801c50:	74 4d                	je     801c9f <spawn+0xf4>
+		string_size += strlen(argv[argc]) + 1;
+  801c52:	83 ec 0c             	sub    $0xc,%esp
+  801c55:	50                   	push   %eax
+  801c56:	e8 0a eb ff ff       	call   800765 <strlen>
+  801c5b:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  801c5f:	83 c3 01             	add    $0x1,%ebx
+  801c62:	83 c4 10             	add    $0x10,%esp
+  801c65:	eb e4                	jmp    801c4b <spawn+0xa0>
+		close(fd);
+  801c67:	83 ec 0c             	sub    $0xc,%esp
+  801c6a:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  801c70:	e8 57 f7 ff ff       	call   8013cc <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  801c75:	83 c4 0c             	add    $0xc,%esp
+  801c78:	68 7f 45 4c 46       	push   $0x464c457f
+  801c7d:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  801c83:	68 57 32 80 00       	push   $0x803257
+  801c88:	e8 2c e5 ff ff       	call   8001b9 <cprintf>
+		return -E_NOT_EXEC;
+  801c8d:	83 c4 10             	add    $0x10,%esp
+  801c90:	c7 85 10 fd ff ff f2 	movl   $0xfffffff2,-0x2f0(%ebp)
+  801c97:	ff ff ff 
+  801c9a:	e9 39 05 00 00       	jmp    8021d8 <spawn+0x62d>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  801c9f:	89 9d 04 fd ff ff    	mov    %ebx,-0x2fc(%ebp)
+  801ca5:	bf 00 10 40 00       	mov    $0x401000,%edi
+  801caa:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  801cac:	89 fa                	mov    %edi,%edx
+  801cae:	83 e2 fc             	and    $0xfffffffc,%edx
+  801cb1:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  801cb8:	29 c2                	sub    %eax,%edx
+  801cba:	89 95 14 fd ff ff    	mov    %edx,-0x2ec(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  801cc0:	8d 42 f8             	lea    -0x8(%edx),%eax
+  801cc3:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  801cc8:	0f 86 18 05 00 00    	jbe    8021e6 <spawn+0x63b>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  801cce:	83 ec 04             	sub    $0x4,%esp
+  801cd1:	6a 07                	push   $0x7
+  801cd3:	68 00 00 40 00       	push   $0x400000
+  801cd8:	6a 00                	push   $0x0
+  801cda:	e8 b4 ef ff ff       	call   800c93 <sys_page_alloc>
+  801cdf:	83 c4 10             	add    $0x10,%esp
+  801ce2:	85 c0                	test   %eax,%eax
+  801ce4:	0f 88 01 05 00 00    	js     8021eb <spawn+0x640>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  801cea:	be 00 00 00 00       	mov    $0x0,%esi
+  801cef:	89 9d 08 fd ff ff    	mov    %ebx,-0x2f8(%ebp)
+  801cf5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801cf8:	eb 30                	jmp    801d2a <spawn+0x17f>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  801cfa:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  801d00:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  801d06:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  801d09:	83 ec 08             	sub    $0x8,%esp
+  801d0c:	ff 34 b3             	push   (%ebx,%esi,4)
+  801d0f:	57                   	push   %edi
+  801d10:	e8 8b ea ff ff       	call   8007a0 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  801d15:	83 c4 04             	add    $0x4,%esp
+  801d18:	ff 34 b3             	push   (%ebx,%esi,4)
+  801d1b:	e8 45 ea ff ff       	call   800765 <strlen>
+  801d20:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  801d24:	83 c6 01             	add    $0x1,%esi
+  801d27:	83 c4 10             	add    $0x10,%esp
+  801d2a:	39 b5 08 fd ff ff    	cmp    %esi,-0x2f8(%ebp)
+  801d30:	7f c8                	jg     801cfa <spawn+0x14f>
+	}
+	argv_store[argc] = 0;
+  801d32:	8b 85 14 fd ff ff    	mov    -0x2ec(%ebp),%eax
+  801d38:	8b 8d 04 fd ff ff    	mov    -0x2fc(%ebp),%ecx
+  801d3e:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  801d45:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  801d4b:	0f 85 fb 00 00 00    	jne    801e4c <spawn+0x2a1>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  801d51:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  801d57:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  801d5d:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  801d60:	89 c8                	mov    %ecx,%eax
+  801d62:	8b 8d 04 fd ff ff    	mov    -0x2fc(%ebp),%ecx
+  801d68:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  801d6b:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  801d70:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  801d76:	83 ec 0c             	sub    $0xc,%esp
+  801d79:	6a 07                	push   $0x7
+  801d7b:	68 00 d0 bf ee       	push   $0xeebfd000
+  801d80:	8b b5 0c fd ff ff    	mov    -0x2f4(%ebp),%esi
+  801d86:	56                   	push   %esi
+  801d87:	68 00 00 40 00       	push   $0x400000
+  801d8c:	6a 00                	push   $0x0
+  801d8e:	e8 43 ef ff ff       	call   800cd6 <sys_page_map>
+  801d93:	89 c3                	mov    %eax,%ebx
+  801d95:	83 c4 20             	add    $0x20,%esp
+  801d98:	85 c0                	test   %eax,%eax
+  801d9a:	0f 88 53 04 00 00    	js     8021f3 <spawn+0x648>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801da0:	83 ec 08             	sub    $0x8,%esp
+  801da3:	68 00 00 40 00       	push   $0x400000
+  801da8:	6a 00                	push   $0x0
+  801daa:	e8 69 ef ff ff       	call   800d18 <sys_page_unmap>
+  801daf:	89 c3                	mov    %eax,%ebx
+  801db1:	83 c4 10             	add    $0x10,%esp
+  801db4:	85 c0                	test   %eax,%eax
+  801db6:	0f 88 37 04 00 00    	js     8021f3 <spawn+0x648>
+	if ((r = fd_lookup(fd, &fdp)) < 0)
+  801dbc:	83 ec 08             	sub    $0x8,%esp
+  801dbf:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  801dc5:	50                   	push   %eax
+  801dc6:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  801dcc:	e8 d8 f4 ff ff       	call   8012a9 <fd_lookup>
+  801dd1:	89 c7                	mov    %eax,%edi
+  801dd3:	83 c4 10             	add    $0x10,%esp
+  801dd6:	85 c0                	test   %eax,%eax
+  801dd8:	0f 88 d6 01 00 00    	js     801fb4 <spawn+0x409>
+	if ((r = sys_page_map(0, fdp, child, (void*) PROGFD, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801dde:	83 ec 0c             	sub    $0xc,%esp
+  801de1:	68 07 04 00 00       	push   $0x407
+  801de6:	68 00 f0 ff cf       	push   $0xcffff000
+  801deb:	56                   	push   %esi
+  801dec:	ff b5 a0 fd ff ff    	push   -0x260(%ebp)
+  801df2:	6a 00                	push   $0x0
+  801df4:	e8 dd ee ff ff       	call   800cd6 <sys_page_map>
+  801df9:	89 c7                	mov    %eax,%edi
+  801dfb:	83 c4 20             	add    $0x20,%esp
+  801dfe:	85 c0                	test   %eax,%eax
+  801e00:	0f 88 ae 01 00 00    	js     801fb4 <spawn+0x409>
+	pager = ipc_find_env(ENV_TYPE_FS);
+  801e06:	83 ec 0c             	sub    $0xc,%esp
+  801e09:	6a 01                	push   $0x1
+  801e0b:	e8 17 0d 00 00       	call   802b27 <ipc_find_env>
+  801e10:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%ebp)
+	memset(segs, 0, sizeof(segs));
+  801e16:	83 c4 0c             	add    $0xc,%esp
+  801e19:	68 80 00 00 00       	push   $0x80
+  801e1e:	6a 00                	push   $0x0
+  801e20:	8d 9d 20 fd ff ff    	lea    -0x2e0(%ebp),%ebx
+  801e26:	53                   	push   %ebx
+  801e27:	e8 c5 ea ff ff       	call   8008f1 <memset>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  801e2c:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  801e32:	8d bc 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%edi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  801e39:	83 c4 10             	add    $0x10,%esp
+  801e3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e41:	89 fe                	mov    %edi,%esi
+  801e43:	89 d1                	mov    %edx,%ecx
+  801e45:	89 da                	mov    %ebx,%edx
+  801e47:	e9 bf 01 00 00       	jmp    80200b <spawn+0x460>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  801e4c:	68 cc 32 80 00       	push   $0x8032cc
+  801e51:	68 2b 32 80 00       	push   $0x80322b
+  801e56:	68 17 01 00 00       	push   $0x117
+  801e5b:	68 71 32 80 00       	push   $0x803271
+  801e60:	e8 79 e2 ff ff       	call   8000de <_panic>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  801e65:	8b 5e 04             	mov    0x4(%esi),%ebx
+  801e68:	89 9d 00 fd ff ff    	mov    %ebx,-0x300(%ebp)
+  801e6e:	8b 46 10             	mov    0x10(%esi),%eax
+  801e71:	89 85 14 fd ff ff    	mov    %eax,-0x2ec(%ebp)
+  801e77:	8b 7e 14             	mov    0x14(%esi),%edi
+  801e7a:	89 bd 08 fd ff ff    	mov    %edi,-0x2f8(%ebp)
+  801e80:	8b 7e 08             	mov    0x8(%esi),%edi
+	int i, r;
+	void *blk;
+
+	//cprintf("map_segment %x+%x\n", va, memsz);
+
+	if ((i = PGOFF(va))) {
+  801e83:	89 f8                	mov    %edi,%eax
+  801e85:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801e8a:	74 16                	je     801ea2 <spawn+0x2f7>
+		va -= i;
+  801e8c:	29 c7                	sub    %eax,%edi
+		memsz += i;
+  801e8e:	01 85 08 fd ff ff    	add    %eax,-0x2f8(%ebp)
+		filesz += i;
+  801e94:	01 85 14 fd ff ff    	add    %eax,-0x2ec(%ebp)
+		fileoffset -= i;
+  801e9a:	29 c3                	sub    %eax,%ebx
+  801e9c:	89 9d 00 fd ff ff    	mov    %ebx,-0x300(%ebp)
+	}
+
+	for (i = 0; i < memsz; i += PGSIZE) {
+  801ea2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ea7:	89 8d fc fc ff ff    	mov    %ecx,-0x304(%ebp)
+  801ead:	89 b5 f8 fc ff ff    	mov    %esi,-0x308(%ebp)
+  801eb3:	8b b5 14 fd ff ff    	mov    -0x2ec(%ebp),%esi
+  801eb9:	89 95 f4 fc ff ff    	mov    %edx,-0x30c(%ebp)
+  801ebf:	e9 ba 00 00 00       	jmp    801f7e <spawn+0x3d3>
+			// allocate a blank page
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+				return r;
+		} else {
+			// from file
+			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  801ec4:	83 ec 04             	sub    $0x4,%esp
+  801ec7:	6a 07                	push   $0x7
+  801ec9:	68 00 00 40 00       	push   $0x400000
+  801ece:	6a 00                	push   $0x0
+  801ed0:	e8 be ed ff ff       	call   800c93 <sys_page_alloc>
+  801ed5:	83 c4 10             	add    $0x10,%esp
+  801ed8:	85 c0                	test   %eax,%eax
+  801eda:	0f 88 d7 02 00 00    	js     8021b7 <spawn+0x60c>
+				return r;
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  801ee0:	83 ec 08             	sub    $0x8,%esp
+  801ee3:	8b 95 00 fd ff ff    	mov    -0x300(%ebp),%edx
+  801ee9:	8b 85 14 fd ff ff    	mov    -0x2ec(%ebp),%eax
+  801eef:	01 d0                	add    %edx,%eax
+  801ef1:	50                   	push   %eax
+  801ef2:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  801ef8:	e8 5b f7 ff ff       	call   801658 <seek>
+  801efd:	83 c4 10             	add    $0x10,%esp
+  801f00:	85 c0                	test   %eax,%eax
+  801f02:	0f 88 b6 02 00 00    	js     8021be <spawn+0x613>
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
+  801f08:	83 ec 04             	sub    $0x4,%esp
+  801f0b:	89 f2                	mov    %esi,%edx
+  801f0d:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  801f13:	29 ca                	sub    %ecx,%edx
+  801f15:	89 d0                	mov    %edx,%eax
+  801f17:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f1c:	39 d0                	cmp    %edx,%eax
+  801f1e:	0f 47 c2             	cmova  %edx,%eax
+  801f21:	50                   	push   %eax
+  801f22:	68 00 00 40 00       	push   $0x400000
+  801f27:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  801f2d:	e8 5d f6 ff ff       	call   80158f <readn>
+  801f32:	83 c4 10             	add    $0x10,%esp
+  801f35:	85 c0                	test   %eax,%eax
+  801f37:	0f 88 88 02 00 00    	js     8021c5 <spawn+0x61a>
+				return r;
+			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
+  801f3d:	83 ec 0c             	sub    $0xc,%esp
+  801f40:	ff b5 04 fd ff ff    	push   -0x2fc(%ebp)
+  801f46:	57                   	push   %edi
+  801f47:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  801f4d:	68 00 00 40 00       	push   $0x400000
+  801f52:	6a 00                	push   $0x0
+  801f54:	e8 7d ed ff ff       	call   800cd6 <sys_page_map>
+  801f59:	83 c4 20             	add    $0x20,%esp
+  801f5c:	85 c0                	test   %eax,%eax
+  801f5e:	78 7e                	js     801fde <spawn+0x433>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP);
+  801f60:	83 ec 08             	sub    $0x8,%esp
+  801f63:	68 00 00 40 00       	push   $0x400000
+  801f68:	6a 00                	push   $0x0
+  801f6a:	e8 a9 ed ff ff       	call   800d18 <sys_page_unmap>
+  801f6f:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < memsz; i += PGSIZE) {
+  801f72:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f78:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801f7e:	89 9d 14 fd ff ff    	mov    %ebx,-0x2ec(%ebp)
+  801f84:	8b 85 08 fd ff ff    	mov    -0x2f8(%ebp),%eax
+  801f8a:	39 c3                	cmp    %eax,%ebx
+  801f8c:	73 65                	jae    801ff3 <spawn+0x448>
+		if (i >= filesz) {
+  801f8e:	39 f3                	cmp    %esi,%ebx
+  801f90:	0f 82 2e ff ff ff    	jb     801ec4 <spawn+0x319>
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  801f96:	83 ec 04             	sub    $0x4,%esp
+  801f99:	ff b5 04 fd ff ff    	push   -0x2fc(%ebp)
+  801f9f:	57                   	push   %edi
+  801fa0:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  801fa6:	e8 e8 ec ff ff       	call   800c93 <sys_page_alloc>
+  801fab:	83 c4 10             	add    $0x10,%esp
+  801fae:	85 c0                	test   %eax,%eax
+  801fb0:	79 c0                	jns    801f72 <spawn+0x3c7>
+  801fb2:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  801fb4:	83 ec 0c             	sub    $0xc,%esp
+  801fb7:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  801fbd:	e8 52 ec ff ff       	call   800c14 <sys_env_destroy>
+	close(fd);
+  801fc2:	83 c4 04             	add    $0x4,%esp
+  801fc5:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  801fcb:	e8 fc f3 ff ff       	call   8013cc <close>
+	return r;
+  801fd0:	83 c4 10             	add    $0x10,%esp
+  801fd3:	89 bd 10 fd ff ff    	mov    %edi,-0x2f0(%ebp)
+  801fd9:	e9 fa 01 00 00       	jmp    8021d8 <spawn+0x62d>
+				panic("spawn: sys_page_map data: %e", r);
+  801fde:	50                   	push   %eax
+  801fdf:	68 7d 32 80 00       	push   $0x80327d
+  801fe4:	68 4a 01 00 00       	push   $0x14a
+  801fe9:	68 71 32 80 00       	push   $0x803271
+  801fee:	e8 eb e0 ff ff       	call   8000de <_panic>
+  801ff3:	8b 8d fc fc ff ff    	mov    -0x304(%ebp),%ecx
+  801ff9:	8b b5 f8 fc ff ff    	mov    -0x308(%ebp),%esi
+  801fff:	8b 95 f4 fc ff ff    	mov    -0x30c(%ebp),%edx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802005:	83 c1 01             	add    $0x1,%ecx
+  802008:	83 c6 20             	add    $0x20,%esi
+  80200b:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802012:	39 c8                	cmp    %ecx,%eax
+  802014:	7e 74                	jle    80208a <spawn+0x4df>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802016:	83 3e 01             	cmpl   $0x1,(%esi)
+  802019:	75 ea                	jne    802005 <spawn+0x45a>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  80201b:	8b 46 18             	mov    0x18(%esi),%eax
+  80201e:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802021:	83 f8 01             	cmp    $0x1,%eax
+  802024:	19 ff                	sbb    %edi,%edi
+  802026:	83 e7 fe             	and    $0xfffffffe,%edi
+  802029:	83 c7 07             	add    $0x7,%edi
+  80202c:	89 bd 04 fd ff ff    	mov    %edi,-0x2fc(%ebp)
+		if (seg < segs + NSEGS) {
+  802032:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  802038:	39 c2                	cmp    %eax,%edx
+  80203a:	0f 83 25 fe ff ff    	jae    801e65 <spawn+0x2ba>
+			seg->seg_va = ROUNDDOWN(ph->p_va, PGSIZE);
+  802040:	8b 46 08             	mov    0x8(%esi),%eax
+  802043:	89 c3                	mov    %eax,%ebx
+  802045:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  80204b:	89 1a                	mov    %ebx,(%edx)
+			seg->seg_memsz = ph->p_memsz + PGOFF(ph->p_va);
+  80204d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802052:	89 c3                	mov    %eax,%ebx
+  802054:	03 5e 14             	add    0x14(%esi),%ebx
+  802057:	89 5a 04             	mov    %ebx,0x4(%edx)
+			seg->seg_filesz = ph->p_filesz + PGOFF(ph->p_va);
+  80205a:	89 c3                	mov    %eax,%ebx
+  80205c:	03 5e 10             	add    0x10(%esi),%ebx
+  80205f:	89 5a 08             	mov    %ebx,0x8(%edx)
+			seg->seg_offset = ph->p_offset - PGOFF(ph->p_va);
+  802062:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802065:	29 c3                	sub    %eax,%ebx
+  802067:	89 5a 0c             	mov    %ebx,0xc(%edx)
+			seg->seg_perm = perm;
+  80206a:	89 7a 10             	mov    %edi,0x10(%edx)
+			seg->seg_pager = pager;
+  80206d:	8b 85 f0 fc ff ff    	mov    -0x310(%ebp),%eax
+  802073:	89 42 14             	mov    %eax,0x14(%edx)
+			seg->seg_fileid = fdp->fd_file.id;
+  802076:	8b 85 a0 fd ff ff    	mov    -0x260(%ebp),%eax
+  80207c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80207f:	89 42 18             	mov    %eax,0x18(%edx)
+			seg++;
+  802082:	83 c2 20             	add    $0x20,%edx
+			continue;
+  802085:	e9 7b ff ff ff       	jmp    802005 <spawn+0x45a>
+	if ((r = sys_env_set_segments(child, segs, seg - segs)) < 0)
+  80208a:	89 d1                	mov    %edx,%ecx
+  80208c:	83 ec 04             	sub    $0x4,%esp
+  80208f:	8d 95 20 fd ff ff    	lea    -0x2e0(%ebp),%edx
+  802095:	89 c8                	mov    %ecx,%eax
+  802097:	29 d0                	sub    %edx,%eax
+  802099:	c1 f8 05             	sar    $0x5,%eax
+  80209c:	50                   	push   %eax
+  80209d:	52                   	push   %edx
+  80209e:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  8020a4:	e8 fc ee ff ff       	call   800fa5 <sys_env_set_segments>
+  8020a9:	89 c7                	mov    %eax,%edi
+  8020ab:	83 c4 10             	add    $0x10,%esp
+  8020ae:	85 c0                	test   %eax,%eax
+  8020b0:	0f 88 fe fe ff ff    	js     801fb4 <spawn+0x409>
+	close(fd);
+  8020b6:	83 ec 0c             	sub    $0xc,%esp
+  8020b9:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  8020bf:	e8 08 f3 ff ff       	call   8013cc <close>
+  8020c4:	83 c4 10             	add    $0x10,%esp
+	// Copy the mappings for shared pages into the child address.
+	// We need to iterate through all PTEs for addresses below UTOP.
+	// However, we handle the exception stack separately, so we only need to iterate up until UXSTACKTOP-PGSIZE.
+	// Since [USTACKTOP, UXSTACKTOP-PGSIZE) is empty memory, we can get away with only iterating up until USTACKTOP.
+	// This is the same as iterating through pages 0 through PGNUM(USTACKTOP)-1 inclusive.
+	for (pn = 0; pn < PGNUM(USTACKTOP); ++pn) {
+  8020c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020cc:	eb 2d                	jmp    8020fb <spawn+0x550>
+		// We only copy this page if it is present and readable in user mode, and if it is a shared page.
+		// This requires checking for PTE_P and PTE_U not only in uvpt[pn],
+		// but in the associated PDE as well, since page pn won't exist if its page table doesn't exist, i.e. if it isn't present in the page directory.
+		// Large pages are never shared (see sys_page_alloc), and have no uvpt entries.
+		if (((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U) && !(uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U) && (uvpt[pn]&PTE_SHARE))) {
+			sys_page_map(0, (void *)PGADDR(0,pn,0), child, (void *)PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL);
+  8020ce:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8020d5:	83 ec 0c             	sub    $0xc,%esp
+  8020d8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8020dd:	50                   	push   %eax
+  8020de:	52                   	push   %edx
+  8020df:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  8020e5:	52                   	push   %edx
+  8020e6:	6a 00                	push   $0x0
+  8020e8:	e8 e9 eb ff ff       	call   800cd6 <sys_page_map>
+  8020ed:	83 c4 20             	add    $0x20,%esp
+	for (pn = 0; pn < PGNUM(USTACKTOP); ++pn) {
+  8020f0:	83 c3 01             	add    $0x1,%ebx
+  8020f3:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  8020f9:	74 51                	je     80214c <spawn+0x5a1>
+		if (((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U) && !(uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U) && (uvpt[pn]&PTE_SHARE))) {
+  8020fb:	89 da                	mov    %ebx,%edx
+  8020fd:	c1 e2 0c             	shl    $0xc,%edx
+  802100:	89 d0                	mov    %edx,%eax
+  802102:	c1 e8 16             	shr    $0x16,%eax
+  802105:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  80210c:	f6 c1 01             	test   $0x1,%cl
+  80210f:	74 df                	je     8020f0 <spawn+0x545>
+  802111:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  802118:	f6 c1 04             	test   $0x4,%cl
+  80211b:	74 d3                	je     8020f0 <spawn+0x545>
+  80211d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802124:	a8 80                	test   $0x80,%al
+  802126:	75 c8                	jne    8020f0 <spawn+0x545>
+  802128:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80212f:	a8 01                	test   $0x1,%al
+  802131:	74 bd                	je     8020f0 <spawn+0x545>
+  802133:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80213a:	a8 04                	test   $0x4,%al
+  80213c:	74 b2                	je     8020f0 <spawn+0x545>
+  80213e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802145:	f6 c4 04             	test   $0x4,%ah
+  802148:	74 a6                	je     8020f0 <spawn+0x545>
+  80214a:	eb 82                	jmp    8020ce <spawn+0x523>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  80214c:	83 ec 08             	sub    $0x8,%esp
+  80214f:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802155:	50                   	push   %eax
+  802156:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  80215c:	e8 b2 ed ff ff       	call   800f13 <sys_env_set_trapframe>
+  802161:	83 c4 10             	add    $0x10,%esp
+  802164:	85 c0                	test   %eax,%eax
+  802166:	78 25                	js     80218d <spawn+0x5e2>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802168:	83 ec 08             	sub    $0x8,%esp
+  80216b:	6a 02                	push   $0x2
+  80216d:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802173:	e8 59 ed ff ff       	call   800ed1 <sys_env_set_status>
+  802178:	83 c4 10             	add    $0x10,%esp
+  80217b:	85 c0                	test   %eax,%eax
+  80217d:	78 23                	js     8021a2 <spawn+0x5f7>
+	return child;
+  80217f:	8b 85 0c fd ff ff    	mov    -0x2f4(%ebp),%eax
+  802185:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  80218b:	eb 4b                	jmp    8021d8 <spawn+0x62d>
+		panic("sys_env_set_trapframe: %e", r);
+  80218d:	50                   	push   %eax
+  80218e:	68 9a 32 80 00       	push   $0x80329a
+  802193:	68 ab 00 00 00       	push   $0xab
+  802198:	68 71 32 80 00       	push   $0x803271
+  80219d:	e8 3c df ff ff       	call   8000de <_panic>
+		panic("sys_env_set_status: %e", r);
+  8021a2:	50                   	push   %eax
+  8021a3:	68 b4 32 80 00       	push   $0x8032b4
+  8021a8:	68 ae 00 00 00       	push   $0xae
+  8021ad:	68 71 32 80 00       	push   $0x803271
+  8021b2:	e8 27 df ff ff       	call   8000de <_panic>
+  8021b7:	89 c7                	mov    %eax,%edi
+  8021b9:	e9 f6 fd ff ff       	jmp    801fb4 <spawn+0x409>
+  8021be:	89 c7                	mov    %eax,%edi
+  8021c0:	e9 ef fd ff ff       	jmp    801fb4 <spawn+0x409>
+  8021c5:	89 c7                	mov    %eax,%edi
+  8021c7:	e9 e8 fd ff ff       	jmp    801fb4 <spawn+0x409>
+		return r;
+  8021cc:	8b 85 0c fd ff ff    	mov    -0x2f4(%ebp),%eax
+  8021d2:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+}
+  8021d8:	8b 85 10 fd ff ff    	mov    -0x2f0(%ebp),%eax
+  8021de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021e1:	5b                   	pop    %ebx
+  8021e2:	5e                   	pop    %esi
+  8021e3:	5f                   	pop    %edi
+  8021e4:	5d                   	pop    %ebp
+  8021e5:	c3                   	ret
+		return -E_NO_MEM;
+  8021e6:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  8021eb:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  8021f1:	eb e5                	jmp    8021d8 <spawn+0x62d>
+	sys_page_unmap(0, UTEMP);
+  8021f3:	83 ec 08             	sub    $0x8,%esp
+  8021f6:	68 00 00 40 00       	push   $0x400000
+  8021fb:	6a 00                	push   $0x0
+  8021fd:	e8 16 eb ff ff       	call   800d18 <sys_page_unmap>
+  802202:	83 c4 10             	add    $0x10,%esp
+  802205:	89 9d 10 fd ff ff    	mov    %ebx,-0x2f0(%ebp)
+  80220b:	eb cb                	jmp    8021d8 <spawn+0x62d>
+
+0080220d <spawnl>:
+{
+  80220d:	55                   	push   %ebp
+  80220e:	89 e5                	mov    %esp,%ebp
+  802210:	56                   	push   %esi
+  802211:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802212:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  802215:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  80221a:	eb 05                	jmp    802221 <spawnl+0x14>
+		argc++;
+  80221c:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  80221f:	89 ca                	mov    %ecx,%edx
+  802221:	8d 4a 04             	lea    0x4(%edx),%ecx
+  802224:	83 3a 00             	cmpl   $0x0,(%edx)
+  802227:	75 f3                	jne    80221c <spawnl+0xf>
+	const char *argv[argc+2];
+  802229:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  802230:	83 e2 f0             	and    $0xfffffff0,%edx
+  802233:	29 d4                	sub    %edx,%esp
+  802235:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802239:	89 da                	mov    %ebx,%edx
+  80223b:	c1 ea 02             	shr    $0x2,%edx
+  80223e:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802241:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802244:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  80224b:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  802252:	00 
+	va_start(vl, arg0);
+  802253:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  802256:	89 c2                	mov    %eax,%edx
+  802258:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225d:	eb 0b                	jmp    80226a <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  80225f:	83 c0 01             	add    $0x1,%eax
+  802262:	8b 31                	mov    (%ecx),%esi
+  802264:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802267:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  80226a:	39 d0                	cmp    %edx,%eax
+  80226c:	75 f1                	jne    80225f <spawnl+0x52>
+	return spawn(prog, argv);
+  80226e:	83 ec 08             	sub    $0x8,%esp
+  802271:	53                   	push   %ebx
+  802272:	ff 75 08             	push   0x8(%ebp)
+  802275:	e8 31 f9 ff ff       	call   801bab <spawn>
+}
+  80227a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80227d:	5b                   	pop    %ebx
+  80227e:	5e                   	pop    %esi
+  80227f:	5d                   	pop    %ebp
+  802280:	c3                   	ret
+
+00802281 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802281:	55                   	push   %ebp
+  802282:	89 e5                	mov    %esp,%ebp
+  802284:	56                   	push   %esi
+  802285:	53                   	push   %ebx
+  802286:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802289:	83 ec 0c             	sub    $0xc,%esp
+  80228c:	ff 75 08             	push   0x8(%ebp)
+  80228f:	e8 aa ef ff ff       	call   80123e <fd2data>
+  802294:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802296:	83 c4 08             	add    $0x8,%esp
+  802299:	68 f2 32 80 00       	push   $0x8032f2
+  80229e:	53                   	push   %ebx
+  80229f:	e8 fc e4 ff ff       	call   8007a0 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8022a4:	8b 46 04             	mov    0x4(%esi),%eax
+  8022a7:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8022ad:	2b 0e                	sub    (%esi),%ecx
+  8022af:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8022b4:	89 c8                	mov    %ecx,%eax
+  8022b6:	f7 e2                	mul    %edx
+  8022b8:	c1 ea 0c             	shr    $0xc,%edx
+  8022bb:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022c1:	29 d1                	sub    %edx,%ecx
+  8022c3:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8022c9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8022d0:	00 00 00 
+	stat->st_dev = &devpipe;
+  8022d3:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8022da:	40 80 00 
+	return 0;
+}
+  8022dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022e5:	5b                   	pop    %ebx
+  8022e6:	5e                   	pop    %esi
+  8022e7:	5d                   	pop    %ebp
+  8022e8:	c3                   	ret
+
+008022e9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8022e9:	55                   	push   %ebp
+  8022ea:	89 e5                	mov    %esp,%ebp
+  8022ec:	53                   	push   %ebx
+  8022ed:	83 ec 0c             	sub    $0xc,%esp
+  8022f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8022f3:	53                   	push   %ebx
+  8022f4:	6a 00                	push   $0x0
+  8022f6:	e8 1d ea ff ff       	call   800d18 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8022fb:	89 1c 24             	mov    %ebx,(%esp)
+  8022fe:	e8 3b ef ff ff       	call   80123e <fd2data>
+  802303:	83 c4 08             	add    $0x8,%esp
+  802306:	50                   	push   %eax
+  802307:	6a 00                	push   $0x0
+  802309:	e8 0a ea ff ff       	call   800d18 <sys_page_unmap>
+}
+  80230e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802311:	c9                   	leave
+  802312:	c3                   	ret
+
+00802313 <_pipeisclosed>:
+{
+  802313:	55                   	push   %ebp
+  802314:	89 e5                	mov    %esp,%ebp
+  802316:	57                   	push   %edi
+  802317:	56                   	push   %esi
+  802318:	53                   	push   %ebx
+  802319:	83 ec 1c             	sub    $0x1c,%esp
+  80231c:	89 c7                	mov    %eax,%edi
+  80231e:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802320:	a1 08 50 80 00       	mov    0x805008,%eax
+  802325:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802328:	83 ec 0c             	sub    $0xc,%esp
+  80232b:	57                   	push   %edi
+  80232c:	e8 35 08 00 00       	call   802b66 <pageref>
+  802331:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802334:	89 34 24             	mov    %esi,(%esp)
+  802337:	e8 2a 08 00 00       	call   802b66 <pageref>
+		nn = thisenv->env_runs;
+  80233c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  802342:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802345:	83 c4 10             	add    $0x10,%esp
+  802348:	39 cb                	cmp    %ecx,%ebx
+  80234a:	74 1b                	je     802367 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80234c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80234f:	75 cf                	jne    802320 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802351:	8b 42 58             	mov    0x58(%edx),%eax
+  802354:	6a 01                	push   $0x1
+  802356:	50                   	push   %eax
+  802357:	53                   	push   %ebx
+  802358:	68 f9 32 80 00       	push   $0x8032f9
+  80235d:	e8 57 de ff ff       	call   8001b9 <cprintf>
+  802362:	83 c4 10             	add    $0x10,%esp
+  802365:	eb b9                	jmp    802320 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802367:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80236a:	0f 94 c0             	sete   %al
+  80236d:	0f b6 c0             	movzbl %al,%eax
+}
+  802370:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802373:	5b                   	pop    %ebx
+  802374:	5e                   	pop    %esi
+  802375:	5f                   	pop    %edi
+  802376:	5d                   	pop    %ebp
+  802377:	c3                   	ret
+
+00802378 <devpipe_read>:
+{
+  802378:	55                   	push   %ebp
+  802379:	89 e5                	mov    %esp,%ebp
+  80237b:	57                   	push   %edi
+  80237c:	56                   	push   %esi
+  80237d:	53                   	push   %ebx
+  80237e:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802381:	ff 75 08             	push   0x8(%ebp)
+  802384:	e8 b5 ee ff ff       	call   80123e <fd2data>
+  802389:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  80238b:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  80238e:	8d 40 04             	lea    0x4(%eax),%eax
+  802391:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802394:	8b 7b 04             	mov    0x4(%ebx),%edi
+  802397:	8b 0b                	mov    (%ebx),%ecx
+  802399:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  80239f:	29 ce                	sub    %ecx,%esi
+  8023a1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8023a6:	f7 e6                	mul    %esi
+  8023a8:	c1 ea 0c             	shr    $0xc,%edx
+  8023ab:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8023b1:	29 c6                	sub    %eax,%esi
+  8023b3:	89 f2                	mov    %esi,%edx
+  8023b5:	75 43                	jne    8023fa <devpipe_read+0x82>
+		ref = pageref(p);
+  8023b7:	83 ec 0c             	sub    $0xc,%esp
+  8023ba:	53                   	push   %ebx
+  8023bb:	e8 a6 07 00 00       	call   802b66 <pageref>
+  8023c0:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8023c2:	89 da                	mov    %ebx,%edx
+  8023c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023c7:	e8 47 ff ff ff       	call   802313 <_pipeisclosed>
+  8023cc:	83 c4 10             	add    $0x10,%esp
+  8023cf:	85 c0                	test   %eax,%eax
+  8023d1:	0f 85 c1 00 00 00    	jne    802498 <devpipe_read+0x120>
+	*sleeping = 1;
+  8023d7:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  8023de:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8023e3:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  8023e6:	75 ac                	jne    802394 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  8023e8:	83 ec 04             	sub    $0x4,%esp
+  8023eb:	56                   	push   %esi
+  8023ec:	57                   	push   %edi
+  8023ed:	ff 75 e4             	push   -0x1c(%ebp)
+  8023f0:	e8 77 ed ff ff       	call   80116c <sys_futex_wait>
+  8023f5:	83 c4 10             	add    $0x10,%esp
+  8023f8:	eb 9a                	jmp    802394 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  8023fa:	39 75 10             	cmp    %esi,0x10(%ebp)
+  8023fd:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  802401:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802403:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802408:	f7 e1                	mul    %ecx
+  80240a:	c1 ea 0b             	shr    $0xb,%edx
+  80240d:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802413:	29 c1                	sub    %eax,%ecx
+  802415:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  802417:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80241c:	29 cf                	sub    %ecx,%edi
+  80241e:	39 f7                	cmp    %esi,%edi
+  802420:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  802423:	8d 43 10             	lea    0x10(%ebx),%eax
+  802426:	83 ec 04             	sub    $0x4,%esp
+  802429:	57                   	push   %edi
+  80242a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80242d:	01 c2                	add    %eax,%edx
+  80242f:	52                   	push   %edx
+  802430:	ff 75 0c             	push   0xc(%ebp)
+  802433:	e8 ee e4 ff ff       	call   800926 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  802438:	83 c4 0c             	add    $0xc,%esp
+  80243b:	89 f1                	mov    %esi,%ecx
+  80243d:	29 f9                	sub    %edi,%ecx
+  80243f:	51                   	push   %ecx
+  802440:	ff 75 e4             	push   -0x1c(%ebp)
+  802443:	89 f8                	mov    %edi,%eax
+  802445:	03 45 0c             	add    0xc(%ebp),%eax
+  802448:	50                   	push   %eax
+  802449:	e8 d8 e4 ff ff       	call   800926 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  80244e:	89 f1                	mov    %esi,%ecx
+  802450:	03 0b                	add    (%ebx),%ecx
+  802452:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802457:	f7 e1                	mul    %ecx
+  802459:	c1 ea 0c             	shr    $0xc,%edx
+  80245c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802462:	29 d1                	sub    %edx,%ecx
+  802464:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  802466:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80246b:	83 c4 10             	add    $0x10,%esp
+  80246e:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  802472:	75 0a                	jne    80247e <devpipe_read+0x106>
+	return n;
+  802474:	89 f0                	mov    %esi,%eax
+}
+  802476:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802479:	5b                   	pop    %ebx
+  80247a:	5e                   	pop    %esi
+  80247b:	5f                   	pop    %edi
+  80247c:	5d                   	pop    %ebp
+  80247d:	c3                   	ret
+		*sleeping = 0;
+  80247e:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  802485:	83 ec 08             	sub    $0x8,%esp
+  802488:	68 00 04 00 00       	push   $0x400
+  80248d:	53                   	push   %ebx
+  80248e:	e8 29 ed ff ff       	call   8011bc <sys_futex_wake>
+  802493:	83 c4 10             	add    $0x10,%esp
+  802496:	eb dc                	jmp    802474 <devpipe_read+0xfc>
+			return 0;
+  802498:	b8 00 00 00 00       	mov    $0x0,%eax
+  80249d:	eb d7                	jmp    802476 <devpipe_read+0xfe>
+
+0080249f <devpipe_write>:
+{
+  80249f:	55                   	push   %ebp
+  8024a0:	89 e5                	mov    %esp,%ebp
+  8024a2:	57                   	push   %edi
+  8024a3:	56                   	push   %esi
+  8024a4:	53                   	push   %ebx
+  8024a5:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8024a8:	ff 75 08             	push   0x8(%ebp)
+  8024ab:	e8 8e ed ff ff       	call   80123e <fd2data>
+  8024b0:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8024b2:	83 c4 10             	add    $0x10,%esp
+  8024b5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8024bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024bf:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8024c2:	0f 83 23 01 00 00    	jae    8025eb <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8024c8:	8b 77 04             	mov    0x4(%edi),%esi
+  8024cb:	8b 1f                	mov    (%edi),%ebx
+  8024cd:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  8024d3:	29 d9                	sub    %ebx,%ecx
+  8024d5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8024da:	f7 e1                	mul    %ecx
+  8024dc:	c1 ea 0c             	shr    $0xc,%edx
+  8024df:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8024e5:	29 c1                	sub    %eax,%ecx
+  8024e7:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8024e9:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8024ef:	75 40                	jne    802531 <devpipe_write+0x92>
+			ref = pageref(p);
+  8024f1:	83 ec 0c             	sub    $0xc,%esp
+  8024f4:	57                   	push   %edi
+  8024f5:	e8 6c 06 00 00       	call   802b66 <pageref>
+  8024fa:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  8024fc:	89 fa                	mov    %edi,%edx
+  8024fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802501:	e8 0d fe ff ff       	call   802313 <_pipeisclosed>
+  802506:	83 c4 10             	add    $0x10,%esp
+  802509:	85 c0                	test   %eax,%eax
+  80250b:	0f 85 d5 00 00 00    	jne    8025e6 <devpipe_write+0x147>
+	*sleeping = 1;
+  802511:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  802518:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80251d:	39 1f                	cmp    %ebx,(%edi)
+  80251f:	75 a7                	jne    8024c8 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  802521:	83 ec 04             	sub    $0x4,%esp
+  802524:	56                   	push   %esi
+  802525:	53                   	push   %ebx
+  802526:	57                   	push   %edi
+  802527:	e8 40 ec ff ff       	call   80116c <sys_futex_wait>
+  80252c:	83 c4 10             	add    $0x10,%esp
+  80252f:	eb 97                	jmp    8024c8 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802531:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802534:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802537:	29 c1                	sub    %eax,%ecx
+  802539:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80253e:	89 d8                	mov    %ebx,%eax
+  802540:	29 d0                	sub    %edx,%eax
+  802542:	39 c1                	cmp    %eax,%ecx
+  802544:	0f 46 c1             	cmovbe %ecx,%eax
+  802547:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  802549:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80254e:	f7 e6                	mul    %esi
+  802550:	c1 ea 0b             	shr    $0xb,%edx
+  802553:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802559:	29 c6                	sub    %eax,%esi
+  80255b:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80255d:	29 f3                	sub    %esi,%ebx
+  80255f:	39 cb                	cmp    %ecx,%ebx
+  802561:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802564:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  802567:	8d 77 10             	lea    0x10(%edi),%esi
+  80256a:	83 ec 04             	sub    $0x4,%esp
+  80256d:	53                   	push   %ebx
+  80256e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802571:	03 45 0c             	add    0xc(%ebp),%eax
+  802574:	50                   	push   %eax
+  802575:	01 f2                	add    %esi,%edx
+  802577:	52                   	push   %edx
+  802578:	e8 a9 e3 ff ff       	call   800926 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80257d:	83 c4 0c             	add    $0xc,%esp
+  802580:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802583:	29 d8                	sub    %ebx,%eax
+  802585:	50                   	push   %eax
+  802586:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802589:	01 d3                	add    %edx,%ebx
+  80258b:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80258e:	53                   	push   %ebx
+  80258f:	56                   	push   %esi
+  802590:	e8 91 e3 ff ff       	call   800926 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802595:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802598:	03 4f 04             	add    0x4(%edi),%ecx
+  80259b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8025a0:	f7 e1                	mul    %ecx
+  8025a2:	c1 ea 0c             	shr    $0xc,%edx
+  8025a5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8025ab:	29 d1                	sub    %edx,%ecx
+  8025ad:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8025b0:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8025b5:	83 c4 10             	add    $0x10,%esp
+  8025b8:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8025bc:	75 0b                	jne    8025c9 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8025be:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8025c1:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8025c4:	e9 f3 fe ff ff       	jmp    8024bc <devpipe_write+0x1d>
+		*sleeping = 0;
+  8025c9:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8025d0:	83 ec 08             	sub    $0x8,%esp
+  8025d3:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  8025d8:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  8025db:	50                   	push   %eax
+  8025dc:	e8 db eb ff ff       	call   8011bc <sys_futex_wake>
+  8025e1:	83 c4 10             	add    $0x10,%esp
+  8025e4:	eb d8                	jmp    8025be <devpipe_write+0x11f>
+				return 0;
+  8025e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025ee:	5b                   	pop    %ebx
+  8025ef:	5e                   	pop    %esi
+  8025f0:	5f                   	pop    %edi
+  8025f1:	5d                   	pop    %ebp
+  8025f2:	c3                   	ret
+
+008025f3 <pipe>:
+{
+  8025f3:	55                   	push   %ebp
+  8025f4:	89 e5                	mov    %esp,%ebp
+  8025f6:	56                   	push   %esi
+  8025f7:	53                   	push   %ebx
+  8025f8:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8025fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025fe:	50                   	push   %eax
+  8025ff:	e8 51 ec ff ff       	call   801255 <fd_alloc>
+  802604:	89 c3                	mov    %eax,%ebx
+  802606:	83 c4 10             	add    $0x10,%esp
+  802609:	85 c0                	test   %eax,%eax
+  80260b:	0f 88 23 01 00 00    	js     802734 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802611:	83 ec 04             	sub    $0x4,%esp
+  802614:	68 07 04 00 00       	push   $0x407
+  802619:	ff 75 f4             	push   -0xc(%ebp)
+  80261c:	6a 00                	push   $0x0
+  80261e:	e8 70 e6 ff ff       	call   800c93 <sys_page_alloc>
+  802623:	89 c3                	mov    %eax,%ebx
+  802625:	83 c4 10             	add    $0x10,%esp
+  802628:	85 c0                	test   %eax,%eax
+  80262a:	0f 88 04 01 00 00    	js     802734 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802630:	83 ec 0c             	sub    $0xc,%esp
+  802633:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802636:	50                   	push   %eax
+  802637:	e8 19 ec ff ff       	call   801255 <fd_alloc>
+  80263c:	89 c3                	mov    %eax,%ebx
+  80263e:	83 c4 10             	add    $0x10,%esp
+  802641:	85 c0                	test   %eax,%eax
+  802643:	0f 88 db 00 00 00    	js     802724 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802649:	83 ec 04             	sub    $0x4,%esp
+  80264c:	68 07 04 00 00       	push   $0x407
+  802651:	ff 75 f0             	push   -0x10(%ebp)
+  802654:	6a 00                	push   $0x0
+  802656:	e8 38 e6 ff ff       	call   800c93 <sys_page_alloc>
+  80265b:	89 c3                	mov    %eax,%ebx
+  80265d:	83 c4 10             	add    $0x10,%esp
+  802660:	85 c0                	test   %eax,%eax
+  802662:	0f 88 bc 00 00 00    	js     802724 <pipe+0x131>
+	va = fd2data(fd0);
+  802668:	83 ec 0c             	sub    $0xc,%esp
+  80266b:	ff 75 f4             	push   -0xc(%ebp)
+  80266e:	e8 cb eb ff ff       	call   80123e <fd2data>
+  802673:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802675:	83 c4 0c             	add    $0xc,%esp
+  802678:	68 07 04 00 00       	push   $0x407
+  80267d:	50                   	push   %eax
+  80267e:	6a 00                	push   $0x0
+  802680:	e8 0e e6 ff ff       	call   800c93 <sys_page_alloc>
+  802685:	89 c3                	mov    %eax,%ebx
+  802687:	83 c4 10             	add    $0x10,%esp
+  80268a:	85 c0                	test   %eax,%eax
+  80268c:	0f 88 82 00 00 00    	js     802714 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802692:	83 ec 0c             	sub    $0xc,%esp
+  802695:	ff 75 f0             	push   -0x10(%ebp)
+  802698:	e8 a1 eb ff ff       	call   80123e <fd2data>
+  80269d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8026a4:	50                   	push   %eax
+  8026a5:	6a 00                	push   $0x0
+  8026a7:	56                   	push   %esi
+  8026a8:	6a 00                	push   $0x0
+  8026aa:	e8 27 e6 ff ff       	call   800cd6 <sys_page_map>
+  8026af:	89 c3                	mov    %eax,%ebx
+  8026b1:	83 c4 20             	add    $0x20,%esp
+  8026b4:	85 c0                	test   %eax,%eax
+  8026b6:	78 4e                	js     802706 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8026b8:	a1 20 40 80 00       	mov    0x804020,%eax
+  8026bd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026c0:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8026c2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026c5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8026cc:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8026cf:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8026d1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8026d4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8026db:	83 ec 0c             	sub    $0xc,%esp
+  8026de:	ff 75 f4             	push   -0xc(%ebp)
+  8026e1:	e8 48 eb ff ff       	call   80122e <fd2num>
+  8026e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8026e9:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8026eb:	83 c4 04             	add    $0x4,%esp
+  8026ee:	ff 75 f0             	push   -0x10(%ebp)
+  8026f1:	e8 38 eb ff ff       	call   80122e <fd2num>
+  8026f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8026f9:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8026fc:	83 c4 10             	add    $0x10,%esp
+  8026ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802704:	eb 2e                	jmp    802734 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802706:	83 ec 08             	sub    $0x8,%esp
+  802709:	56                   	push   %esi
+  80270a:	6a 00                	push   $0x0
+  80270c:	e8 07 e6 ff ff       	call   800d18 <sys_page_unmap>
+  802711:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802714:	83 ec 08             	sub    $0x8,%esp
+  802717:	ff 75 f0             	push   -0x10(%ebp)
+  80271a:	6a 00                	push   $0x0
+  80271c:	e8 f7 e5 ff ff       	call   800d18 <sys_page_unmap>
+  802721:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802724:	83 ec 08             	sub    $0x8,%esp
+  802727:	ff 75 f4             	push   -0xc(%ebp)
+  80272a:	6a 00                	push   $0x0
+  80272c:	e8 e7 e5 ff ff       	call   800d18 <sys_page_unmap>
+  802731:	83 c4 10             	add    $0x10,%esp
+}
+  802734:	89 d8                	mov    %ebx,%eax
+  802736:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802739:	5b                   	pop    %ebx
+  80273a:	5e                   	pop    %esi
+  80273b:	5d                   	pop    %ebp
+  80273c:	c3                   	ret
+
+0080273d <pipeisclosed>:
+{
+  80273d:	55                   	push   %ebp
+  80273e:	89 e5                	mov    %esp,%ebp
+  802740:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802743:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802746:	50                   	push   %eax
+  802747:	ff 75 08             	push   0x8(%ebp)
+  80274a:	e8 5a eb ff ff       	call   8012a9 <fd_lookup>
+  80274f:	83 c4 10             	add    $0x10,%esp
+  802752:	85 c0                	test   %eax,%eax
+  802754:	78 18                	js     80276e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802756:	83 ec 0c             	sub    $0xc,%esp
+  802759:	ff 75 f4             	push   -0xc(%ebp)
+  80275c:	e8 dd ea ff ff       	call   80123e <fd2data>
+  802761:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802763:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802766:	e8 a8 fb ff ff       	call   802313 <_pipeisclosed>
+  80276b:	83 c4 10             	add    $0x10,%esp
+}
+  80276e:	c9                   	leave
+  80276f:	c3                   	ret
+
+00802770 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802770:	b8 00 00 00 00       	mov    $0x0,%eax
+  802775:	c3                   	ret
+
+00802776 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802776:	55                   	push   %ebp
+  802777:	89 e5                	mov    %esp,%ebp
+  802779:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80277c:	68 11 33 80 00       	push   $0x803311
+  802781:	ff 75 0c             	push   0xc(%ebp)
+  802784:	e8 17 e0 ff ff       	call   8007a0 <strcpy>
+	return 0;
+}
+  802789:	b8 00 00 00 00       	mov    $0x0,%eax
+  80278e:	c9                   	leave
+  80278f:	c3                   	ret
+
+00802790 <devcons_write>:
+{
+  802790:	55                   	push   %ebp
+  802791:	89 e5                	mov    %esp,%ebp
+  802793:	57                   	push   %edi
+  802794:	56                   	push   %esi
+  802795:	53                   	push   %ebx
+  802796:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80279c:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8027a1:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8027a7:	eb 2e                	jmp    8027d7 <devcons_write+0x47>
+		m = n - tot;
+  8027a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8027ac:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8027ae:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8027b3:	39 c3                	cmp    %eax,%ebx
+  8027b5:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8027b8:	83 ec 04             	sub    $0x4,%esp
+  8027bb:	53                   	push   %ebx
+  8027bc:	89 f0                	mov    %esi,%eax
+  8027be:	03 45 0c             	add    0xc(%ebp),%eax
+  8027c1:	50                   	push   %eax
+  8027c2:	57                   	push   %edi
+  8027c3:	e8 5e e1 ff ff       	call   800926 <memmove>
+		sys_cputs(buf, m);
+  8027c8:	83 c4 08             	add    $0x8,%esp
+  8027cb:	53                   	push   %ebx
+  8027cc:	57                   	push   %edi
+  8027cd:	e8 f4 e3 ff ff       	call   800bc6 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8027d2:	01 de                	add    %ebx,%esi
+  8027d4:	83 c4 10             	add    $0x10,%esp
+  8027d7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8027da:	72 cd                	jb     8027a9 <devcons_write+0x19>
+}
+  8027dc:	89 f0                	mov    %esi,%eax
+  8027de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027e1:	5b                   	pop    %ebx
+  8027e2:	5e                   	pop    %esi
+  8027e3:	5f                   	pop    %edi
+  8027e4:	5d                   	pop    %ebp
+  8027e5:	c3                   	ret
+
+008027e6 <devcons_read>:
+{
+  8027e6:	55                   	push   %ebp
+  8027e7:	89 e5                	mov    %esp,%ebp
+  8027e9:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8027ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8027f5:	75 07                	jne    8027fe <devcons_read+0x18>
+  8027f7:	eb 1f                	jmp    802818 <devcons_read+0x32>
+		sys_yield();
+  8027f9:	e8 76 e4 ff ff       	call   800c74 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8027fe:	e8 f2 e3 ff ff       	call   800bf5 <sys_cgetc>
+  802803:	85 c0                	test   %eax,%eax
+  802805:	74 f2                	je     8027f9 <devcons_read+0x13>
+	if (c < 0)
+  802807:	78 0f                	js     802818 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802809:	83 f8 04             	cmp    $0x4,%eax
+  80280c:	74 0c                	je     80281a <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80280e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802811:	88 02                	mov    %al,(%edx)
+	return 1;
+  802813:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802818:	c9                   	leave
+  802819:	c3                   	ret
+		return 0;
+  80281a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80281f:	eb f7                	jmp    802818 <devcons_read+0x32>
+
+00802821 <cputchar>:
+{
+  802821:	55                   	push   %ebp
+  802822:	89 e5                	mov    %esp,%ebp
+  802824:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802827:	8b 45 08             	mov    0x8(%ebp),%eax
+  80282a:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80282d:	6a 01                	push   $0x1
+  80282f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802832:	50                   	push   %eax
+  802833:	e8 8e e3 ff ff       	call   800bc6 <sys_cputs>
+}
+  802838:	83 c4 10             	add    $0x10,%esp
+  80283b:	c9                   	leave
+  80283c:	c3                   	ret
+
+0080283d <getchar>:
+{
+  80283d:	55                   	push   %ebp
+  80283e:	89 e5                	mov    %esp,%ebp
+  802840:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802843:	6a 01                	push   $0x1
+  802845:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802848:	50                   	push   %eax
+  802849:	6a 00                	push   $0x0
+  80284b:	e8 b8 ec ff ff       	call   801508 <read>
+	if (r < 0)
+  802850:	83 c4 10             	add    $0x10,%esp
+  802853:	85 c0                	test   %eax,%eax
+  802855:	78 06                	js     80285d <getchar+0x20>
+	if (r < 1)
+  802857:	74 06                	je     80285f <getchar+0x22>
+	return c;
+  802859:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80285d:	c9                   	leave
+  80285e:	c3                   	ret
+		return -E_EOF;
+  80285f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802864:	eb f7                	jmp    80285d <getchar+0x20>
+
+00802866 <iscons>:
+{
+  802866:	55                   	push   %ebp
+  802867:	89 e5                	mov    %esp,%ebp
+  802869:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80286c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80286f:	50                   	push   %eax
+  802870:	ff 75 08             	push   0x8(%ebp)
+  802873:	e8 31 ea ff ff       	call   8012a9 <fd_lookup>
+  802878:	83 c4 10             	add    $0x10,%esp
+  80287b:	85 c0                	test   %eax,%eax
+  80287d:	78 11                	js     802890 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80287f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802882:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802888:	39 10                	cmp    %edx,(%eax)
+  80288a:	0f 94 c0             	sete   %al
+  80288d:	0f b6 c0             	movzbl %al,%eax
+}
+  802890:	c9                   	leave
+  802891:	c3                   	ret
+
+00802892 <opencons>:
+{
+  802892:	55                   	push   %ebp
+  802893:	89 e5                	mov    %esp,%ebp
+  802895:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802898:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80289b:	50                   	push   %eax
+  80289c:	e8 b4 e9 ff ff       	call   801255 <fd_alloc>
+  8028a1:	83 c4 10             	add    $0x10,%esp
+  8028a4:	85 c0                	test   %eax,%eax
+  8028a6:	78 3a                	js     8028e2 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8028a8:	83 ec 04             	sub    $0x4,%esp
+  8028ab:	68 07 04 00 00       	push   $0x407
+  8028b0:	ff 75 f4             	push   -0xc(%ebp)
+  8028b3:	6a 00                	push   $0x0
+  8028b5:	e8 d9 e3 ff ff       	call   800c93 <sys_page_alloc>
+  8028ba:	83 c4 10             	add    $0x10,%esp
+  8028bd:	85 c0                	test   %eax,%eax
+  8028bf:	78 21                	js     8028e2 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8028c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028c4:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  8028ca:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8028cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028cf:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8028d6:	83 ec 0c             	sub    $0xc,%esp
+  8028d9:	50                   	push   %eax
+  8028da:	e8 4f e9 ff ff       	call   80122e <fd2num>
+  8028df:	83 c4 10             	add    $0x10,%esp
+}
+  8028e2:	c9                   	leave
+  8028e3:	c3                   	ret
+
+008028e4 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8028e4:	55                   	push   %ebp
+  8028e5:	89 e5                	mov    %esp,%ebp
+  8028e7:	57                   	push   %edi
+  8028e8:	56                   	push   %esi
+  8028e9:	53                   	push   %ebx
+  8028ea:	83 ec 14             	sub    $0x14,%esp
+  8028ed:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8028f0:	8b 75 14             	mov    0x14(%ebp),%esi
+  8028f3:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8028f6:	ff 75 10             	push   0x10(%ebp)
+  8028f9:	ff 75 0c             	push   0xc(%ebp)
+  8028fc:	e8 b5 e7 ff ff       	call   8010b6 <sys_ipc_recv_pages>
+  802901:	83 c4 10             	add    $0x10,%esp
+  802904:	85 c0                	test   %eax,%eax
+  802906:	78 46                	js     80294e <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802908:	85 ff                	test   %edi,%edi
+  80290a:	74 0d                	je     802919 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  80290c:	a1 08 50 80 00       	mov    0x805008,%eax
+  802911:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802917:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802919:	85 f6                	test   %esi,%esi
+  80291b:	74 0d                	je     80292a <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  80291d:	a1 08 50 80 00       	mov    0x805008,%eax
+  802922:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802928:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80292a:	85 db                	test   %ebx,%ebx
+  80292c:	74 0d                	je     80293b <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  80292e:	a1 08 50 80 00       	mov    0x805008,%eax
+  802933:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802939:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80293b:	a1 08 50 80 00       	mov    0x805008,%eax
+  802940:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802946:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802949:	5b                   	pop    %ebx
+  80294a:	5e                   	pop    %esi
+  80294b:	5f                   	pop    %edi
+  80294c:	5d                   	pop    %ebp
+  80294d:	c3                   	ret
+		if (from_env_store) {
+  80294e:	85 ff                	test   %edi,%edi
+  802950:	74 06                	je     802958 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  802952:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802958:	85 f6                	test   %esi,%esi
+  80295a:	74 06                	je     802962 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  80295c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802962:	85 db                	test   %ebx,%ebx
+  802964:	74 e0                	je     802946 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  802966:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80296c:	eb d8                	jmp    802946 <ipc_recv_pages+0x62>
+
+0080296e <ipc_recv>:
+{
+  80296e:	55                   	push   %ebp
+  80296f:	89 e5                	mov    %esp,%ebp
+  802971:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  802974:	6a 00                	push   $0x0
+  802976:	ff 75 10             	push   0x10(%ebp)
+  802979:	6a 01                	push   $0x1
+  80297b:	ff 75 0c             	push   0xc(%ebp)
+  80297e:	ff 75 08             	push   0x8(%ebp)
+  802981:	e8 5e ff ff ff       	call   8028e4 <ipc_recv_pages>
+}
+  802986:	c9                   	leave
+  802987:	c3                   	ret
+
+00802988 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802988:	55                   	push   %ebp
+  802989:	89 e5                	mov    %esp,%ebp
+  80298b:	56                   	push   %esi
+  80298c:	53                   	push   %ebx
+  80298d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802990:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  802993:	83 ec 0c             	sub    $0xc,%esp
+  802996:	ff 75 0c             	push   0xc(%ebp)
+  802999:	e8 4c e8 ff ff       	call   8011ea <sys_ipc_try_recv>
+  80299e:	83 c4 10             	add    $0x10,%esp
+  8029a1:	85 c0                	test   %eax,%eax
+  8029a3:	78 34                	js     8029d9 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8029a5:	85 f6                	test   %esi,%esi
+  8029a7:	74 0d                	je     8029b6 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8029a9:	a1 08 50 80 00       	mov    0x805008,%eax
+  8029ae:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8029b4:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8029b6:	85 db                	test   %ebx,%ebx
+  8029b8:	74 0d                	je     8029c7 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8029ba:	a1 08 50 80 00       	mov    0x805008,%eax
+  8029bf:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8029c5:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8029c7:	a1 08 50 80 00       	mov    0x805008,%eax
+  8029cc:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8029d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029d5:	5b                   	pop    %ebx
+  8029d6:	5e                   	pop    %esi
+  8029d7:	5d                   	pop    %ebp
+  8029d8:	c3                   	ret
+		if (from_env_store) {
+  8029d9:	85 f6                	test   %esi,%esi
+  8029db:	74 06                	je     8029e3 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8029dd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8029e3:	85 db                	test   %ebx,%ebx
+  8029e5:	74 eb                	je     8029d2 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8029e7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8029ed:	eb e3                	jmp    8029d2 <ipc_try_recv+0x4a>
+
+008029ef <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8029ef:	55                   	push   %ebp
+  8029f0:	89 e5                	mov    %esp,%ebp
+  8029f2:	83 ec 14             	sub    $0x14,%esp
+  8029f5:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8029f8:	85 c0                	test   %eax,%eax
+  8029fa:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8029ff:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802a02:	ff 75 18             	push   0x18(%ebp)
+  802a05:	ff 75 14             	push   0x14(%ebp)
+  802a08:	50                   	push   %eax
+  802a09:	ff 75 0c             	push   0xc(%ebp)
+  802a0c:	ff 75 08             	push   0x8(%ebp)
+  802a0f:	e8 65 e6 ff ff       	call   801079 <sys_ipc_send_pages>
+  802a14:	83 c4 20             	add    $0x20,%esp
+  802a17:	85 c0                	test   %eax,%eax
+  802a19:	78 02                	js     802a1d <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  802a1b:	c9                   	leave
+  802a1c:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  802a1d:	50                   	push   %eax
+  802a1e:	68 20 33 80 00       	push   $0x803320
+  802a23:	68 80 00 00 00       	push   $0x80
+  802a28:	68 4c 33 80 00       	push   $0x80334c
+  802a2d:	e8 ac d6 ff ff       	call   8000de <_panic>
+
+00802a32 <ipc_send>:
+{
+  802a32:	55                   	push   %ebp
+  802a33:	89 e5                	mov    %esp,%ebp
+  802a35:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  802a38:	ff 75 14             	push   0x14(%ebp)
+  802a3b:	6a 01                	push   $0x1
+  802a3d:	ff 75 10             	push   0x10(%ebp)
+  802a40:	ff 75 0c             	push   0xc(%ebp)
+  802a43:	ff 75 08             	push   0x8(%ebp)
+  802a46:	e8 a4 ff ff ff       	call   8029ef <ipc_send_pages>
+}
+  802a4b:	83 c4 20             	add    $0x20,%esp
+  802a4e:	c9                   	leave
+  802a4f:	c3                   	ret
+
+00802a50 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802a50:	55                   	push   %ebp
+  802a51:	89 e5                	mov    %esp,%ebp
+  802a53:	83 ec 14             	sub    $0x14,%esp
+  802a56:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802a59:	85 c0                	test   %eax,%eax
+  802a5b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a60:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802a63:	ff 75 18             	push   0x18(%ebp)
+  802a66:	ff 75 14             	push   0x14(%ebp)
+  802a69:	50                   	push   %eax
+  802a6a:	ff 75 0c             	push   0xc(%ebp)
+  802a6d:	ff 75 08             	push   0x8(%ebp)
+  802a70:	e8 95 e6 ff ff       	call   80110a <sys_ipc_call>
+  802a75:	83 c4 20             	add    $0x20,%esp
+  802a78:	85 c0                	test   %eax,%eax
+  802a7a:	78 0b                	js     802a87 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  802a7c:	a1 08 50 80 00       	mov    0x805008,%eax
+  802a81:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802a87:	c9                   	leave
+  802a88:	c3                   	ret
+
+00802a89 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  802a89:	55                   	push   %ebp
+  802a8a:	89 e5                	mov    %esp,%ebp
+  802a8c:	57                   	push   %edi
+  802a8d:	56                   	push   %esi
+  802a8e:	53                   	push   %ebx
+  802a8f:	83 ec 18             	sub    $0x18,%esp
+  802a92:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a95:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  802a98:	8b 75 20             	mov    0x20(%ebp),%esi
+  802a9b:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802a9e:	85 c0                	test   %eax,%eax
+  802aa0:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802aa5:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802aa8:	ff 75 18             	push   0x18(%ebp)
+  802aab:	ff 75 14             	push   0x14(%ebp)
+  802aae:	50                   	push   %eax
+  802aaf:	ff 75 0c             	push   0xc(%ebp)
+  802ab2:	ff 75 08             	push   0x8(%ebp)
+  802ab5:	e8 91 e6 ff ff       	call   80114b <sys_ipc_reply_recv>
+  802aba:	83 c4 20             	add    $0x20,%esp
+  802abd:	85 c0                	test   %eax,%eax
+  802abf:	78 46                	js     802b07 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802ac1:	85 ff                	test   %edi,%edi
+  802ac3:	74 0d                	je     802ad2 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  802ac5:	a1 08 50 80 00       	mov    0x805008,%eax
+  802aca:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802ad0:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802ad2:	85 f6                	test   %esi,%esi
+  802ad4:	74 0d                	je     802ae3 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  802ad6:	a1 08 50 80 00       	mov    0x805008,%eax
+  802adb:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802ae1:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802ae3:	85 db                	test   %ebx,%ebx
+  802ae5:	74 0d                	je     802af4 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  802ae7:	a1 08 50 80 00       	mov    0x805008,%eax
+  802aec:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802af2:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802af4:	a1 08 50 80 00       	mov    0x805008,%eax
+  802af9:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802aff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b02:	5b                   	pop    %ebx
+  802b03:	5e                   	pop    %esi
+  802b04:	5f                   	pop    %edi
+  802b05:	5d                   	pop    %ebp
+  802b06:	c3                   	ret
+		if (from_env_store) {
+  802b07:	85 ff                	test   %edi,%edi
+  802b09:	74 06                	je     802b11 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  802b0b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  802b11:	85 f6                	test   %esi,%esi
+  802b13:	74 06                	je     802b1b <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  802b15:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802b1b:	85 db                	test   %ebx,%ebx
+  802b1d:	74 e0                	je     802aff <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  802b1f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802b25:	eb d8                	jmp    802aff <ipc_reply_recv+0x76>
+
+00802b27 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b27:	55                   	push   %ebp
+  802b28:	89 e5                	mov    %esp,%ebp
+  802b2a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802b2d:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  802b32:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802b35:	c1 e0 06             	shl    $0x6,%eax
+  802b38:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b3d:	8b 40 50             	mov    0x50(%eax),%eax
+  802b40:	39 c8                	cmp    %ecx,%eax
+  802b42:	74 12                	je     802b56 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802b44:	83 c2 01             	add    $0x1,%edx
+  802b47:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802b4d:	75 e3                	jne    802b32 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802b4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b54:	eb 0e                	jmp    802b64 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802b56:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  802b59:	c1 e0 06             	shl    $0x6,%eax
+  802b5c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b61:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802b64:	5d                   	pop    %ebp
+  802b65:	c3                   	ret
+
+00802b66 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802b66:	55                   	push   %ebp
+  802b67:	89 e5                	mov    %esp,%ebp
+  802b69:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b6c:	89 c2                	mov    %eax,%edx
+  802b6e:	c1 ea 16             	shr    $0x16,%edx
+  802b71:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802b78:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b7d:	f6 c1 01             	test   $0x1,%cl
+  802b80:	74 1e                	je     802ba0 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  802b82:	c1 e8 0c             	shr    $0xc,%eax
+  802b85:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802b8c:	a8 01                	test   $0x1,%al
+  802b8e:	74 10                	je     802ba0 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802b90:	c1 e8 0c             	shr    $0xc,%eax
+  802b93:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802b96:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  802b9d:	0f b7 d2             	movzwl %dx,%edx
+}
+  802ba0:	89 d0                	mov    %edx,%eax
+  802ba2:	5d                   	pop    %ebp
+  802ba3:	c3                   	ret
+
+00802ba4 <udivmod>:
+  802ba4:	55                   	push   %ebp
+  802ba5:	57                   	push   %edi
+  802ba6:	56                   	push   %esi
+  802ba7:	53                   	push   %ebx
+  802ba8:	83 ec 24             	sub    $0x24,%esp
+  802bab:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802baf:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802bb3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802bb7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802bbb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802bbf:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802bc3:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802bc7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bd6:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802bdd:	00 
+  802bde:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802be5:	00 
+  802be6:	89 fb                	mov    %edi,%ebx
+  802be8:	eb 08                	jmp    802bf2 <udivmod+0x4e>
+  802bea:	83 e9 01             	sub    $0x1,%ecx
+  802bed:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802bf0:	74 68                	je     802c5a <udivmod+0xb6>
+  802bf2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802bf6:	01 c0                	add    %eax,%eax
+  802bf8:	89 c6                	mov    %eax,%esi
+  802bfa:	89 d7                	mov    %edx,%edi
+  802bfc:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802c00:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802c04:	0f ad d0             	shrd   %cl,%edx,%eax
+  802c07:	d3 ea                	shr    %cl,%edx
+  802c09:	f6 c1 20             	test   $0x20,%cl
+  802c0c:	74 04                	je     802c12 <udivmod+0x6e>
+  802c0e:	89 d0                	mov    %edx,%eax
+  802c10:	31 d2                	xor    %edx,%edx
+  802c12:	83 e0 01             	and    $0x1,%eax
+  802c15:	89 04 24             	mov    %eax,(%esp)
+  802c18:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802c1f:	00 
+  802c20:	8b 04 24             	mov    (%esp),%eax
+  802c23:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802c27:	09 f0                	or     %esi,%eax
+  802c29:	09 fa                	or     %edi,%edx
+  802c2b:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802c2f:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802c33:	39 f0                	cmp    %esi,%eax
+  802c35:	89 d5                	mov    %edx,%ebp
+  802c37:	19 fd                	sbb    %edi,%ebp
+  802c39:	72 af                	jb     802bea <udivmod+0x46>
+  802c3b:	29 f0                	sub    %esi,%eax
+  802c3d:	19 fa                	sbb    %edi,%edx
+  802c3f:	89 cf                	mov    %ecx,%edi
+  802c41:	c1 ef 05             	shr    $0x5,%edi
+  802c44:	83 e7 01             	and    $0x1,%edi
+  802c47:	89 fe                	mov    %edi,%esi
+  802c49:	83 f6 01             	xor    $0x1,%esi
+  802c4c:	d3 e6                	shl    %cl,%esi
+  802c4e:	d3 e7                	shl    %cl,%edi
+  802c50:	09 74 24 18          	or     %esi,0x18(%esp)
+  802c54:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802c58:	eb 90                	jmp    802bea <udivmod+0x46>
+  802c5a:	85 db                	test   %ebx,%ebx
+  802c5c:	74 05                	je     802c63 <udivmod+0xbf>
+  802c5e:	89 03                	mov    %eax,(%ebx)
+  802c60:	89 53 04             	mov    %edx,0x4(%ebx)
+  802c63:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802c67:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802c6b:	83 c4 24             	add    $0x24,%esp
+  802c6e:	5b                   	pop    %ebx
+  802c6f:	5e                   	pop    %esi
+  802c70:	5f                   	pop    %edi
+  802c71:	5d                   	pop    %ebp
+  802c72:	c3                   	ret
+
+00802c73 <__udivdi3>:
+  802c73:	83 ec 08             	sub    $0x8,%esp
+  802c76:	6a 00                	push   $0x0
+  802c78:	ff 74 24 1c          	push   0x1c(%esp)
+  802c7c:	ff 74 24 1c          	push   0x1c(%esp)
+  802c80:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802c84:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802c88:	e8 17 ff ff ff       	call   802ba4 <udivmod>
+  802c8d:	83 c4 14             	add    $0x14,%esp
+  802c90:	c3                   	ret
+
+00802c91 <__umoddi3>:
+  802c91:	83 ec 18             	sub    $0x18,%esp
+  802c94:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802c98:	50                   	push   %eax
+  802c99:	ff 74 24 2c          	push   0x2c(%esp)
+  802c9d:	ff 74 24 2c          	push   0x2c(%esp)
+  802ca1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802ca5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802ca9:	e8 f6 fe ff ff       	call   802ba4 <udivmod>
+  802cae:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802cb2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802cb6:	83 c4 24             	add    $0x24,%esp
+  802cb9:	c3                   	ret
+
+00802cba <__divdi3>:
+  802cba:	55                   	push   %ebp
+  802cbb:	57                   	push   %edi
+  802cbc:	56                   	push   %esi
+  802cbd:	53                   	push   %ebx
+  802cbe:	83 ec 10             	sub    $0x10,%esp
+  802cc1:	8b 44 24 24          	mov    0x24(%esp),%eax
+  802cc5:	8b 54 24 28          	mov    0x28(%esp),%edx
+  802cc9:	89 c6                	mov    %eax,%esi
+  802ccb:	89 d7                	mov    %edx,%edi
+  802ccd:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  802cd1:	33 7c 24 30          	xor    0x30(%esp),%edi
+  802cd5:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802cd9:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  802cdd:	89 c5                	mov    %eax,%ebp
+  802cdf:	f7 dd                	neg    %ebp
+  802ce1:	89 d6                	mov    %edx,%esi
+  802ce3:	83 d6 00             	adc    $0x0,%esi
+  802ce6:	f7 de                	neg    %esi
+  802ce8:	0f 48 e8             	cmovs  %eax,%ebp
+  802ceb:	0f 49 d6             	cmovns %esi,%edx
+  802cee:	6a 00                	push   $0x0
+  802cf0:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802cf4:	f7 de                	neg    %esi
+  802cf6:	8b 44 24 34          	mov    0x34(%esp),%eax
+  802cfa:	83 d0 00             	adc    $0x0,%eax
+  802cfd:	f7 d8                	neg    %eax
+  802cff:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  802d04:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  802d09:	50                   	push   %eax
+  802d0a:	56                   	push   %esi
+  802d0b:	89 e8                	mov    %ebp,%eax
+  802d0d:	e8 92 fe ff ff       	call   802ba4 <udivmod>
+  802d12:	83 c4 10             	add    $0x10,%esp
+  802d15:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  802d1a:	78 08                	js     802d24 <__divdi3+0x6a>
+  802d1c:	83 c4 0c             	add    $0xc,%esp
+  802d1f:	5b                   	pop    %ebx
+  802d20:	5e                   	pop    %esi
+  802d21:	5f                   	pop    %edi
+  802d22:	5d                   	pop    %ebp
+  802d23:	c3                   	ret
+  802d24:	f7 d8                	neg    %eax
+  802d26:	83 d2 00             	adc    $0x0,%edx
+  802d29:	f7 da                	neg    %edx
+  802d2b:	eb ef                	jmp    802d1c <__divdi3+0x62>
+
+00802d2d <__moddi3>:
+  802d2d:	55                   	push   %ebp
+  802d2e:	57                   	push   %edi
+  802d2f:	56                   	push   %esi
+  802d30:	53                   	push   %ebx
+  802d31:	83 ec 18             	sub    $0x18,%esp
+  802d34:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802d38:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802d3c:	89 f1                	mov    %esi,%ecx
+  802d3e:	f7 d9                	neg    %ecx
+  802d40:	89 da                	mov    %ebx,%edx
+  802d42:	83 d2 00             	adc    $0x0,%edx
+  802d45:	f7 da                	neg    %edx
+  802d47:	0f 48 ce             	cmovs  %esi,%ecx
+  802d4a:	0f 48 d3             	cmovs  %ebx,%edx
+  802d4d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d51:	50                   	push   %eax
+  802d52:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802d56:	f7 de                	neg    %esi
+  802d58:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802d5c:	83 d0 00             	adc    $0x0,%eax
+  802d5f:	f7 d8                	neg    %eax
+  802d61:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802d66:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802d6b:	50                   	push   %eax
+  802d6c:	56                   	push   %esi
+  802d6d:	89 c8                	mov    %ecx,%eax
+  802d6f:	e8 30 fe ff ff       	call   802ba4 <udivmod>
+  802d74:	83 c4 10             	add    $0x10,%esp
+  802d77:	85 db                	test   %ebx,%ebx
+  802d79:	78 10                	js     802d8b <__moddi3+0x5e>
+  802d7b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d7f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d83:	83 c4 14             	add    $0x14,%esp
+  802d86:	5b                   	pop    %ebx
+  802d87:	5e                   	pop    %esi
+  802d88:	5f                   	pop    %edi
+  802d89:	5d                   	pop    %ebp
+  802d8a:	c3                   	ret
+  802d8b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d8f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d93:	f7 d8                	neg    %eax
+  802d95:	83 d2 00             	adc    $0x0,%edx
+  802d98:	f7 da                	neg    %edx
+  802d9a:	eb e7                	jmp    802d83 <__moddi3+0x56>
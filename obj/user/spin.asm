@@ -0,0 +1,10477 @@
+
+obj/user/spin.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 10             	sub    $0x10,%esp
+	envid_t env;
+
+	cprintf("I am the parent.  Forking the child...\n");
+  80003a:	68 a0 52 80 00       	push   $0x8052a0
+  80003f:	e8 69 01 00 00       	call   8001ad <cprintf>
+	if ((env = fork()) == 0) {
+  800044:	e8 25 13 00 00       	call   80136e <fork>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	85 c0                	test   %eax,%eax
+  80004e:	75 12                	jne    800062 <umain+0x2f>
+		cprintf("I am the child.  Spinning...\n");
+  800050:	83 ec 0c             	sub    $0xc,%esp
+  800053:	68 18 53 80 00       	push   $0x805318
+  800058:	e8 50 01 00 00       	call   8001ad <cprintf>
+  80005d:	83 c4 10             	add    $0x10,%esp
+		while (1)
+  800060:	eb fe                	jmp    800060 <umain+0x2d>
+  800062:	89 c3                	mov    %eax,%ebx
+			/* do nothing */;
+	}
+
+	cprintf("I am the parent.  Running the child...\n");
+  800064:	83 ec 0c             	sub    $0xc,%esp
+  800067:	68 c8 52 80 00       	push   $0x8052c8
+  80006c:	e8 3c 01 00 00       	call   8001ad <cprintf>
+	sys_yield();
+  800071:	e8 f2 0b 00 00       	call   800c68 <sys_yield>
+	sys_yield();
+  800076:	e8 ed 0b 00 00       	call   800c68 <sys_yield>
+	sys_yield();
+  80007b:	e8 e8 0b 00 00       	call   800c68 <sys_yield>
+	sys_yield();
+  800080:	e8 e3 0b 00 00       	call   800c68 <sys_yield>
+	sys_yield();
+  800085:	e8 de 0b 00 00       	call   800c68 <sys_yield>
+	sys_yield();
+  80008a:	e8 d9 0b 00 00       	call   800c68 <sys_yield>
+	sys_yield();
+  80008f:	e8 d4 0b 00 00       	call   800c68 <sys_yield>
+	sys_yield();
+  800094:	e8 cf 0b 00 00       	call   800c68 <sys_yield>
+
+	cprintf("I am the parent.  Killing the child...\n");
+  800099:	c7 04 24 f0 52 80 00 	movl   $0x8052f0,(%esp)
+  8000a0:	e8 08 01 00 00       	call   8001ad <cprintf>
+	sys_env_destroy(env);
+  8000a5:	89 1c 24             	mov    %ebx,(%esp)
+  8000a8:	e8 5b 0b 00 00       	call   800c08 <sys_env_destroy>
+}
+  8000ad:	83 c4 10             	add    $0x10,%esp
+  8000b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8000c0:	e8 84 0b 00 00       	call   800c49 <sys_getenvid>
+  8000c5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ca:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8000cd:	c1 e0 06             	shl    $0x6,%eax
+  8000d0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000d5:	a3 18 e9 80 00       	mov    %eax,0x80e918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000da:	85 db                	test   %ebx,%ebx
+  8000dc:	7e 07                	jle    8000e5 <libmain+0x30>
+		binaryname = argv[0];
+  8000de:	8b 06                	mov    (%esi),%eax
+  8000e0:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  8000e5:	83 ec 08             	sub    $0x8,%esp
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+  8000ea:	e8 44 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000ef:	e8 0a 00 00 00       	call   8000fe <exit>
+}
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000fa:	5b                   	pop    %ebx
+  8000fb:	5e                   	pop    %esi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	c3                   	ret
+
+008000fe <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800104:	e8 98 18 00 00       	call   8019a1 <close_all>
+	sys_env_destroy(0);
+  800109:	83 ec 0c             	sub    $0xc,%esp
+  80010c:	6a 00                	push   $0x0
+  80010e:	e8 f5 0a 00 00       	call   800c08 <sys_env_destroy>
+}
+  800113:	83 c4 10             	add    $0x10,%esp
+  800116:	c9                   	leave
+  800117:	c3                   	ret
+
+00800118 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800118:	55                   	push   %ebp
+  800119:	89 e5                	mov    %esp,%ebp
+  80011b:	53                   	push   %ebx
+  80011c:	83 ec 04             	sub    $0x4,%esp
+  80011f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800122:	8b 13                	mov    (%ebx),%edx
+  800124:	8d 42 01             	lea    0x1(%edx),%eax
+  800127:	89 03                	mov    %eax,(%ebx)
+  800129:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80012c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800130:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800135:	74 09                	je     800140 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800137:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80013b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80013e:	c9                   	leave
+  80013f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800140:	83 ec 08             	sub    $0x8,%esp
+  800143:	68 ff 00 00 00       	push   $0xff
+  800148:	8d 43 08             	lea    0x8(%ebx),%eax
+  80014b:	50                   	push   %eax
+  80014c:	e8 69 0a 00 00       	call   800bba <sys_cputs>
+		b->idx = 0;
+  800151:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800157:	83 c4 10             	add    $0x10,%esp
+  80015a:	eb db                	jmp    800137 <putch+0x1f>
+
+0080015c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80015c:	55                   	push   %ebp
+  80015d:	89 e5                	mov    %esp,%ebp
+  80015f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800165:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80016c:	00 00 00 
+	b.cnt = 0;
+  80016f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800176:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800179:	ff 75 0c             	push   0xc(%ebp)
+  80017c:	ff 75 08             	push   0x8(%ebp)
+  80017f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800185:	50                   	push   %eax
+  800186:	68 18 01 80 00       	push   $0x800118
+  80018b:	e8 14 01 00 00       	call   8002a4 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800190:	83 c4 08             	add    $0x8,%esp
+  800193:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800199:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80019f:	50                   	push   %eax
+  8001a0:	e8 15 0a 00 00       	call   800bba <sys_cputs>
+
+	return b.cnt;
+}
+  8001a5:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001ab:	c9                   	leave
+  8001ac:	c3                   	ret
+
+008001ad <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001ad:	55                   	push   %ebp
+  8001ae:	89 e5                	mov    %esp,%ebp
+  8001b0:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001b3:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001b6:	50                   	push   %eax
+  8001b7:	ff 75 08             	push   0x8(%ebp)
+  8001ba:	e8 9d ff ff ff       	call   80015c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001bf:	c9                   	leave
+  8001c0:	c3                   	ret
+
+008001c1 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001c1:	55                   	push   %ebp
+  8001c2:	89 e5                	mov    %esp,%ebp
+  8001c4:	57                   	push   %edi
+  8001c5:	56                   	push   %esi
+  8001c6:	53                   	push   %ebx
+  8001c7:	83 ec 1c             	sub    $0x1c,%esp
+  8001ca:	89 c7                	mov    %eax,%edi
+  8001cc:	89 d6                	mov    %edx,%esi
+  8001ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001d4:	89 d1                	mov    %edx,%ecx
+  8001d6:	89 c2                	mov    %eax,%edx
+  8001d8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001db:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001de:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001e1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001e4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001e7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001ee:	39 c2                	cmp    %eax,%edx
+  8001f0:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001f3:	72 3e                	jb     800233 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001f5:	83 ec 0c             	sub    $0xc,%esp
+  8001f8:	ff 75 18             	push   0x18(%ebp)
+  8001fb:	83 eb 01             	sub    $0x1,%ebx
+  8001fe:	53                   	push   %ebx
+  8001ff:	50                   	push   %eax
+  800200:	83 ec 08             	sub    $0x8,%esp
+  800203:	ff 75 e4             	push   -0x1c(%ebp)
+  800206:	ff 75 e0             	push   -0x20(%ebp)
+  800209:	ff 75 dc             	push   -0x24(%ebp)
+  80020c:	ff 75 d8             	push   -0x28(%ebp)
+  80020f:	e8 48 4f 00 00       	call   80515c <__udivdi3>
+  800214:	83 c4 18             	add    $0x18,%esp
+  800217:	52                   	push   %edx
+  800218:	50                   	push   %eax
+  800219:	89 f2                	mov    %esi,%edx
+  80021b:	89 f8                	mov    %edi,%eax
+  80021d:	e8 9f ff ff ff       	call   8001c1 <printnum>
+  800222:	83 c4 20             	add    $0x20,%esp
+  800225:	eb 13                	jmp    80023a <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800227:	83 ec 08             	sub    $0x8,%esp
+  80022a:	56                   	push   %esi
+  80022b:	ff 75 18             	push   0x18(%ebp)
+  80022e:	ff d7                	call   *%edi
+  800230:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800233:	83 eb 01             	sub    $0x1,%ebx
+  800236:	85 db                	test   %ebx,%ebx
+  800238:	7f ed                	jg     800227 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80023a:	83 ec 08             	sub    $0x8,%esp
+  80023d:	56                   	push   %esi
+  80023e:	83 ec 04             	sub    $0x4,%esp
+  800241:	ff 75 e4             	push   -0x1c(%ebp)
+  800244:	ff 75 e0             	push   -0x20(%ebp)
+  800247:	ff 75 dc             	push   -0x24(%ebp)
+  80024a:	ff 75 d8             	push   -0x28(%ebp)
+  80024d:	e8 28 4f 00 00       	call   80517a <__umoddi3>
+  800252:	83 c4 14             	add    $0x14,%esp
+  800255:	0f be 80 40 53 80 00 	movsbl 0x805340(%eax),%eax
+  80025c:	50                   	push   %eax
+  80025d:	ff d7                	call   *%edi
+}
+  80025f:	83 c4 10             	add    $0x10,%esp
+  800262:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800265:	5b                   	pop    %ebx
+  800266:	5e                   	pop    %esi
+  800267:	5f                   	pop    %edi
+  800268:	5d                   	pop    %ebp
+  800269:	c3                   	ret
+
+0080026a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80026a:	55                   	push   %ebp
+  80026b:	89 e5                	mov    %esp,%ebp
+  80026d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800270:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800274:	8b 10                	mov    (%eax),%edx
+  800276:	3b 50 04             	cmp    0x4(%eax),%edx
+  800279:	73 0a                	jae    800285 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80027b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80027e:	89 08                	mov    %ecx,(%eax)
+  800280:	8b 45 08             	mov    0x8(%ebp),%eax
+  800283:	88 02                	mov    %al,(%edx)
+}
+  800285:	5d                   	pop    %ebp
+  800286:	c3                   	ret
+
+00800287 <printfmt>:
+{
+  800287:	55                   	push   %ebp
+  800288:	89 e5                	mov    %esp,%ebp
+  80028a:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80028d:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800290:	50                   	push   %eax
+  800291:	ff 75 10             	push   0x10(%ebp)
+  800294:	ff 75 0c             	push   0xc(%ebp)
+  800297:	ff 75 08             	push   0x8(%ebp)
+  80029a:	e8 05 00 00 00       	call   8002a4 <vprintfmt>
+}
+  80029f:	83 c4 10             	add    $0x10,%esp
+  8002a2:	c9                   	leave
+  8002a3:	c3                   	ret
+
+008002a4 <vprintfmt>:
+{
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  8002a7:	57                   	push   %edi
+  8002a8:	56                   	push   %esi
+  8002a9:	53                   	push   %ebx
+  8002aa:	83 ec 2c             	sub    $0x2c,%esp
+  8002ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002b0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002b3:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002b6:	eb 0a                	jmp    8002c2 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002b8:	83 ec 08             	sub    $0x8,%esp
+  8002bb:	53                   	push   %ebx
+  8002bc:	50                   	push   %eax
+  8002bd:	ff d6                	call   *%esi
+  8002bf:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002c2:	83 c7 01             	add    $0x1,%edi
+  8002c5:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002c9:	83 f8 25             	cmp    $0x25,%eax
+  8002cc:	74 0c                	je     8002da <vprintfmt+0x36>
+			if (ch == '\0')
+  8002ce:	85 c0                	test   %eax,%eax
+  8002d0:	75 e6                	jne    8002b8 <vprintfmt+0x14>
+}
+  8002d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d5:	5b                   	pop    %ebx
+  8002d6:	5e                   	pop    %esi
+  8002d7:	5f                   	pop    %edi
+  8002d8:	5d                   	pop    %ebp
+  8002d9:	c3                   	ret
+		padc = ' ';
+  8002da:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002de:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002e5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002ec:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002f8:	8d 47 01             	lea    0x1(%edi),%eax
+  8002fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002fe:	0f b6 17             	movzbl (%edi),%edx
+  800301:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800304:	3c 55                	cmp    $0x55,%al
+  800306:	0f 87 c5 03 00 00    	ja     8006d1 <vprintfmt+0x42d>
+  80030c:	0f b6 c0             	movzbl %al,%eax
+  80030f:	ff 24 85 c0 54 80 00 	jmp    *0x8054c0(,%eax,4)
+  800316:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800319:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80031d:	eb d9                	jmp    8002f8 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80031f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800322:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800326:	eb d0                	jmp    8002f8 <vprintfmt+0x54>
+  800328:	0f b6 d2             	movzbl %dl,%edx
+  80032b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80032e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800333:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800336:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800339:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80033d:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800340:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800343:	83 f9 09             	cmp    $0x9,%ecx
+  800346:	77 55                	ja     80039d <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800348:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80034b:	eb e9                	jmp    800336 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80034d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800350:	8b 00                	mov    (%eax),%eax
+  800352:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800355:	8b 45 14             	mov    0x14(%ebp),%eax
+  800358:	8d 40 04             	lea    0x4(%eax),%eax
+  80035b:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80035e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800361:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800365:	79 91                	jns    8002f8 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800367:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80036a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80036d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800374:	eb 82                	jmp    8002f8 <vprintfmt+0x54>
+			if (width < 0)
+  800376:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800379:	85 d2                	test   %edx,%edx
+  80037b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800380:	0f 49 c2             	cmovns %edx,%eax
+  800383:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800386:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800389:	e9 6a ff ff ff       	jmp    8002f8 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80038e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800391:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800398:	e9 5b ff ff ff       	jmp    8002f8 <vprintfmt+0x54>
+  80039d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003a0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003a3:	eb bc                	jmp    800361 <vprintfmt+0xbd>
+			lflag++;
+  8003a5:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003ab:	e9 48 ff ff ff       	jmp    8002f8 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b3:	8d 78 04             	lea    0x4(%eax),%edi
+  8003b6:	83 ec 08             	sub    $0x8,%esp
+  8003b9:	53                   	push   %ebx
+  8003ba:	ff 30                	push   (%eax)
+  8003bc:	ff d6                	call   *%esi
+			break;
+  8003be:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003c1:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003c4:	e9 63 02 00 00       	jmp    80062c <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8003c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cc:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003cf:	8b 10                	mov    (%eax),%edx
+  8003d1:	89 d0                	mov    %edx,%eax
+  8003d3:	f7 d8                	neg    %eax
+  8003d5:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003d8:	83 f8 12             	cmp    $0x12,%eax
+  8003db:	7f 23                	jg     800400 <vprintfmt+0x15c>
+  8003dd:	8b 14 85 20 56 80 00 	mov    0x805620(,%eax,4),%edx
+  8003e4:	85 d2                	test   %edx,%edx
+  8003e6:	74 18                	je     800400 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003e8:	52                   	push   %edx
+  8003e9:	68 4d 58 80 00       	push   $0x80584d
+  8003ee:	53                   	push   %ebx
+  8003ef:	56                   	push   %esi
+  8003f0:	e8 92 fe ff ff       	call   800287 <printfmt>
+  8003f5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003f8:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003fb:	e9 2c 02 00 00       	jmp    80062c <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  800400:	50                   	push   %eax
+  800401:	68 58 53 80 00       	push   $0x805358
+  800406:	53                   	push   %ebx
+  800407:	56                   	push   %esi
+  800408:	e8 7a fe ff ff       	call   800287 <printfmt>
+  80040d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800410:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800413:	e9 14 02 00 00       	jmp    80062c <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800418:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041b:	83 c0 04             	add    $0x4,%eax
+  80041e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800421:	8b 45 14             	mov    0x14(%ebp),%eax
+  800424:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800426:	85 c9                	test   %ecx,%ecx
+  800428:	b8 51 53 80 00       	mov    $0x805351,%eax
+  80042d:	0f 45 c1             	cmovne %ecx,%eax
+  800430:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800433:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800437:	7e 06                	jle    80043f <vprintfmt+0x19b>
+  800439:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80043d:	75 0b                	jne    80044a <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80043f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800442:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800445:	89 75 08             	mov    %esi,0x8(%ebp)
+  800448:	eb 5c                	jmp    8004a6 <vprintfmt+0x202>
+  80044a:	83 ec 08             	sub    $0x8,%esp
+  80044d:	ff 75 d0             	push   -0x30(%ebp)
+  800450:	ff 75 cc             	push   -0x34(%ebp)
+  800453:	e8 19 03 00 00       	call   800771 <strnlen>
+  800458:	89 c2                	mov    %eax,%edx
+  80045a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80045d:	29 d0                	sub    %edx,%eax
+  80045f:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800462:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800466:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800469:	89 75 08             	mov    %esi,0x8(%ebp)
+  80046c:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80046e:	eb 0e                	jmp    80047e <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800470:	83 ec 08             	sub    $0x8,%esp
+  800473:	53                   	push   %ebx
+  800474:	57                   	push   %edi
+  800475:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800478:	83 ee 01             	sub    $0x1,%esi
+  80047b:	83 c4 10             	add    $0x10,%esp
+  80047e:	85 f6                	test   %esi,%esi
+  800480:	7f ee                	jg     800470 <vprintfmt+0x1cc>
+  800482:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800485:	8b 75 08             	mov    0x8(%ebp),%esi
+  800488:	85 c0                	test   %eax,%eax
+  80048a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80048f:	0f 49 d0             	cmovns %eax,%edx
+  800492:	29 d0                	sub    %edx,%eax
+  800494:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800497:	eb a6                	jmp    80043f <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800499:	83 ec 08             	sub    $0x8,%esp
+  80049c:	53                   	push   %ebx
+  80049d:	52                   	push   %edx
+  80049e:	ff 55 08             	call   *0x8(%ebp)
+  8004a1:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004a4:	89 f1                	mov    %esi,%ecx
+  8004a6:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004a9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004ad:	0f be d0             	movsbl %al,%edx
+  8004b0:	85 d2                	test   %edx,%edx
+  8004b2:	74 28                	je     8004dc <vprintfmt+0x238>
+  8004b4:	85 ff                	test   %edi,%edi
+  8004b6:	78 05                	js     8004bd <vprintfmt+0x219>
+  8004b8:	83 ef 01             	sub    $0x1,%edi
+  8004bb:	78 30                	js     8004ed <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004bd:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004c1:	74 d6                	je     800499 <vprintfmt+0x1f5>
+  8004c3:	0f be c0             	movsbl %al,%eax
+  8004c6:	83 e8 20             	sub    $0x20,%eax
+  8004c9:	83 f8 5e             	cmp    $0x5e,%eax
+  8004cc:	76 cb                	jbe    800499 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004ce:	83 ec 08             	sub    $0x8,%esp
+  8004d1:	53                   	push   %ebx
+  8004d2:	6a 3f                	push   $0x3f
+  8004d4:	ff 55 08             	call   *0x8(%ebp)
+  8004d7:	83 c4 10             	add    $0x10,%esp
+  8004da:	eb c8                	jmp    8004a4 <vprintfmt+0x200>
+  8004dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004df:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004e2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004e5:	01 d0                	add    %edx,%eax
+  8004e7:	29 c8                	sub    %ecx,%eax
+  8004e9:	89 c7                	mov    %eax,%edi
+  8004eb:	eb 13                	jmp    800500 <vprintfmt+0x25c>
+  8004ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f0:	eb ed                	jmp    8004df <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004f2:	83 ec 08             	sub    $0x8,%esp
+  8004f5:	53                   	push   %ebx
+  8004f6:	6a 20                	push   $0x20
+  8004f8:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004fa:	83 ef 01             	sub    $0x1,%edi
+  8004fd:	83 c4 10             	add    $0x10,%esp
+  800500:	85 ff                	test   %edi,%edi
+  800502:	7f ee                	jg     8004f2 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800504:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800507:	89 45 14             	mov    %eax,0x14(%ebp)
+  80050a:	e9 1d 01 00 00       	jmp    80062c <vprintfmt+0x388>
+	if (lflag >= 2)
+  80050f:	83 f9 01             	cmp    $0x1,%ecx
+  800512:	7f 1b                	jg     80052f <vprintfmt+0x28b>
+	else if (lflag)
+  800514:	85 c9                	test   %ecx,%ecx
+  800516:	74 63                	je     80057b <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800518:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051b:	8b 00                	mov    (%eax),%eax
+  80051d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800520:	99                   	cltd
+  800521:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800524:	8b 45 14             	mov    0x14(%ebp),%eax
+  800527:	8d 40 04             	lea    0x4(%eax),%eax
+  80052a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80052d:	eb 17                	jmp    800546 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80052f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800532:	8b 50 04             	mov    0x4(%eax),%edx
+  800535:	8b 00                	mov    (%eax),%eax
+  800537:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80053a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80053d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800540:	8d 40 08             	lea    0x8(%eax),%eax
+  800543:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800546:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800549:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80054c:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800551:	85 c9                	test   %ecx,%ecx
+  800553:	0f 89 b9 00 00 00    	jns    800612 <vprintfmt+0x36e>
+				putch('-', putdat);
+  800559:	83 ec 08             	sub    $0x8,%esp
+  80055c:	53                   	push   %ebx
+  80055d:	6a 2d                	push   $0x2d
+  80055f:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800561:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800564:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800567:	f7 da                	neg    %edx
+  800569:	83 d1 00             	adc    $0x0,%ecx
+  80056c:	f7 d9                	neg    %ecx
+  80056e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800571:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800576:	e9 97 00 00 00       	jmp    800612 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  80057b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057e:	8b 00                	mov    (%eax),%eax
+  800580:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800583:	99                   	cltd
+  800584:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800587:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058a:	8d 40 04             	lea    0x4(%eax),%eax
+  80058d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800590:	eb b4                	jmp    800546 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  800592:	83 f9 01             	cmp    $0x1,%ecx
+  800595:	7f 1b                	jg     8005b2 <vprintfmt+0x30e>
+	else if (lflag)
+  800597:	85 c9                	test   %ecx,%ecx
+  800599:	74 2c                	je     8005c7 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  80059b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059e:	8b 10                	mov    (%eax),%edx
+  8005a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005ab:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005b0:	eb 60                	jmp    800612 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8005b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b5:	8b 10                	mov    (%eax),%edx
+  8005b7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005ba:	8d 40 08             	lea    0x8(%eax),%eax
+  8005bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005c0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005c5:	eb 4b                	jmp    800612 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8005c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ca:	8b 10                	mov    (%eax),%edx
+  8005cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005d7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005dc:	eb 34                	jmp    800612 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8005de:	83 f9 01             	cmp    $0x1,%ecx
+  8005e1:	7f 15                	jg     8005f8 <vprintfmt+0x354>
+	else if (lflag)
+  8005e3:	85 c9                	test   %ecx,%ecx
+  8005e5:	74 4d                	je     800634 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8005e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ea:	8b 00                	mov    (%eax),%eax
+  8005ec:	99                   	cltd
+  8005ed:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005f0:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8005f3:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8005f6:	eb 11                	jmp    800609 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  8005f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fb:	8b 50 04             	mov    0x4(%eax),%edx
+  8005fe:	8b 00                	mov    (%eax),%eax
+  800600:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800603:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800606:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800609:	89 d1                	mov    %edx,%ecx
+  80060b:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  80060d:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800612:	83 ec 0c             	sub    $0xc,%esp
+  800615:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800619:	50                   	push   %eax
+  80061a:	ff 75 e0             	push   -0x20(%ebp)
+  80061d:	57                   	push   %edi
+  80061e:	51                   	push   %ecx
+  80061f:	52                   	push   %edx
+  800620:	89 da                	mov    %ebx,%edx
+  800622:	89 f0                	mov    %esi,%eax
+  800624:	e8 98 fb ff ff       	call   8001c1 <printnum>
+			break;
+  800629:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80062c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80062f:	e9 8e fc ff ff       	jmp    8002c2 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800634:	8b 45 14             	mov    0x14(%ebp),%eax
+  800637:	8b 00                	mov    (%eax),%eax
+  800639:	99                   	cltd
+  80063a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80063d:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800640:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800643:	eb c4                	jmp    800609 <vprintfmt+0x365>
+			putch('0', putdat);
+  800645:	83 ec 08             	sub    $0x8,%esp
+  800648:	53                   	push   %ebx
+  800649:	6a 30                	push   $0x30
+  80064b:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80064d:	83 c4 08             	add    $0x8,%esp
+  800650:	53                   	push   %ebx
+  800651:	6a 78                	push   $0x78
+  800653:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800655:	8b 45 14             	mov    0x14(%ebp),%eax
+  800658:	8b 10                	mov    (%eax),%edx
+  80065a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80065f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800662:	8d 40 04             	lea    0x4(%eax),%eax
+  800665:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800668:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  80066d:	eb a3                	jmp    800612 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80066f:	83 f9 01             	cmp    $0x1,%ecx
+  800672:	7f 1b                	jg     80068f <vprintfmt+0x3eb>
+	else if (lflag)
+  800674:	85 c9                	test   %ecx,%ecx
+  800676:	74 2f                	je     8006a7 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800678:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067b:	8b 10                	mov    (%eax),%edx
+  80067d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800682:	8d 40 04             	lea    0x4(%eax),%eax
+  800685:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800688:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80068d:	eb 83                	jmp    800612 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80068f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800692:	8b 10                	mov    (%eax),%edx
+  800694:	8b 48 04             	mov    0x4(%eax),%ecx
+  800697:	8d 40 08             	lea    0x8(%eax),%eax
+  80069a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80069d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006a2:	e9 6b ff ff ff       	jmp    800612 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8006a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006aa:	8b 10                	mov    (%eax),%edx
+  8006ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006bc:	e9 51 ff ff ff       	jmp    800612 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8006c1:	83 ec 08             	sub    $0x8,%esp
+  8006c4:	53                   	push   %ebx
+  8006c5:	6a 25                	push   $0x25
+  8006c7:	ff d6                	call   *%esi
+			break;
+  8006c9:	83 c4 10             	add    $0x10,%esp
+  8006cc:	e9 5b ff ff ff       	jmp    80062c <vprintfmt+0x388>
+			putch('%', putdat);
+  8006d1:	83 ec 08             	sub    $0x8,%esp
+  8006d4:	53                   	push   %ebx
+  8006d5:	6a 25                	push   $0x25
+  8006d7:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006d9:	83 c4 10             	add    $0x10,%esp
+  8006dc:	89 f8                	mov    %edi,%eax
+  8006de:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006e2:	74 05                	je     8006e9 <vprintfmt+0x445>
+  8006e4:	83 e8 01             	sub    $0x1,%eax
+  8006e7:	eb f5                	jmp    8006de <vprintfmt+0x43a>
+  8006e9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006ec:	e9 3b ff ff ff       	jmp    80062c <vprintfmt+0x388>
+
+008006f1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006f1:	55                   	push   %ebp
+  8006f2:	89 e5                	mov    %esp,%ebp
+  8006f4:	83 ec 18             	sub    $0x18,%esp
+  8006f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006fd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800700:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800704:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800707:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80070e:	85 c0                	test   %eax,%eax
+  800710:	74 26                	je     800738 <vsnprintf+0x47>
+  800712:	85 d2                	test   %edx,%edx
+  800714:	7e 22                	jle    800738 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800716:	ff 75 14             	push   0x14(%ebp)
+  800719:	ff 75 10             	push   0x10(%ebp)
+  80071c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80071f:	50                   	push   %eax
+  800720:	68 6a 02 80 00       	push   $0x80026a
+  800725:	e8 7a fb ff ff       	call   8002a4 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80072a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80072d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800730:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800733:	83 c4 10             	add    $0x10,%esp
+}
+  800736:	c9                   	leave
+  800737:	c3                   	ret
+		return -E_INVAL;
+  800738:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80073d:	eb f7                	jmp    800736 <vsnprintf+0x45>
+
+0080073f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80073f:	55                   	push   %ebp
+  800740:	89 e5                	mov    %esp,%ebp
+  800742:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800745:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800748:	50                   	push   %eax
+  800749:	ff 75 10             	push   0x10(%ebp)
+  80074c:	ff 75 0c             	push   0xc(%ebp)
+  80074f:	ff 75 08             	push   0x8(%ebp)
+  800752:	e8 9a ff ff ff       	call   8006f1 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800757:	c9                   	leave
+  800758:	c3                   	ret
+
+00800759 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800759:	55                   	push   %ebp
+  80075a:	89 e5                	mov    %esp,%ebp
+  80075c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80075f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800764:	eb 03                	jmp    800769 <strlen+0x10>
+		n++;
+  800766:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800769:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80076d:	75 f7                	jne    800766 <strlen+0xd>
+	return n;
+}
+  80076f:	5d                   	pop    %ebp
+  800770:	c3                   	ret
+
+00800771 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800771:	55                   	push   %ebp
+  800772:	89 e5                	mov    %esp,%ebp
+  800774:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800777:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80077a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077f:	eb 03                	jmp    800784 <strnlen+0x13>
+		n++;
+  800781:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800784:	39 d0                	cmp    %edx,%eax
+  800786:	74 08                	je     800790 <strnlen+0x1f>
+  800788:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80078c:	75 f3                	jne    800781 <strnlen+0x10>
+  80078e:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800790:	89 d0                	mov    %edx,%eax
+  800792:	5d                   	pop    %ebp
+  800793:	c3                   	ret
+
+00800794 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800794:	55                   	push   %ebp
+  800795:	89 e5                	mov    %esp,%ebp
+  800797:	53                   	push   %ebx
+  800798:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80079b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80079e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a3:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007a7:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007aa:	83 c0 01             	add    $0x1,%eax
+  8007ad:	84 d2                	test   %dl,%dl
+  8007af:	75 f2                	jne    8007a3 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007b1:	89 c8                	mov    %ecx,%eax
+  8007b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007b6:	c9                   	leave
+  8007b7:	c3                   	ret
+
+008007b8 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007b8:	55                   	push   %ebp
+  8007b9:	89 e5                	mov    %esp,%ebp
+  8007bb:	53                   	push   %ebx
+  8007bc:	83 ec 10             	sub    $0x10,%esp
+  8007bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007c2:	53                   	push   %ebx
+  8007c3:	e8 91 ff ff ff       	call   800759 <strlen>
+  8007c8:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007cb:	ff 75 0c             	push   0xc(%ebp)
+  8007ce:	01 d8                	add    %ebx,%eax
+  8007d0:	50                   	push   %eax
+  8007d1:	e8 be ff ff ff       	call   800794 <strcpy>
+	return dst;
+}
+  8007d6:	89 d8                	mov    %ebx,%eax
+  8007d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007db:	c9                   	leave
+  8007dc:	c3                   	ret
+
+008007dd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007dd:	55                   	push   %ebp
+  8007de:	89 e5                	mov    %esp,%ebp
+  8007e0:	56                   	push   %esi
+  8007e1:	53                   	push   %ebx
+  8007e2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007e8:	89 f3                	mov    %esi,%ebx
+  8007ea:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007ed:	89 f0                	mov    %esi,%eax
+  8007ef:	eb 0f                	jmp    800800 <strncpy+0x23>
+		*dst++ = *src;
+  8007f1:	83 c0 01             	add    $0x1,%eax
+  8007f4:	0f b6 0a             	movzbl (%edx),%ecx
+  8007f7:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007fa:	80 f9 01             	cmp    $0x1,%cl
+  8007fd:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800800:	39 d8                	cmp    %ebx,%eax
+  800802:	75 ed                	jne    8007f1 <strncpy+0x14>
+	}
+	return ret;
+}
+  800804:	89 f0                	mov    %esi,%eax
+  800806:	5b                   	pop    %ebx
+  800807:	5e                   	pop    %esi
+  800808:	5d                   	pop    %ebp
+  800809:	c3                   	ret
+
+0080080a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80080a:	55                   	push   %ebp
+  80080b:	89 e5                	mov    %esp,%ebp
+  80080d:	56                   	push   %esi
+  80080e:	53                   	push   %ebx
+  80080f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800812:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800815:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800818:	89 f0                	mov    %esi,%eax
+  80081a:	85 d2                	test   %edx,%edx
+  80081c:	74 21                	je     80083f <strlcpy+0x35>
+  80081e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800822:	89 f2                	mov    %esi,%edx
+  800824:	eb 09                	jmp    80082f <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800826:	83 c1 01             	add    $0x1,%ecx
+  800829:	83 c2 01             	add    $0x1,%edx
+  80082c:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80082f:	39 c2                	cmp    %eax,%edx
+  800831:	74 09                	je     80083c <strlcpy+0x32>
+  800833:	0f b6 19             	movzbl (%ecx),%ebx
+  800836:	84 db                	test   %bl,%bl
+  800838:	75 ec                	jne    800826 <strlcpy+0x1c>
+  80083a:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80083c:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80083f:	29 f0                	sub    %esi,%eax
+}
+  800841:	5b                   	pop    %ebx
+  800842:	5e                   	pop    %esi
+  800843:	5d                   	pop    %ebp
+  800844:	c3                   	ret
+
+00800845 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800845:	55                   	push   %ebp
+  800846:	89 e5                	mov    %esp,%ebp
+  800848:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80084b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80084e:	eb 06                	jmp    800856 <strcmp+0x11>
+		p++, q++;
+  800850:	83 c1 01             	add    $0x1,%ecx
+  800853:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800856:	0f b6 01             	movzbl (%ecx),%eax
+  800859:	84 c0                	test   %al,%al
+  80085b:	74 04                	je     800861 <strcmp+0x1c>
+  80085d:	3a 02                	cmp    (%edx),%al
+  80085f:	74 ef                	je     800850 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800861:	0f b6 c0             	movzbl %al,%eax
+  800864:	0f b6 12             	movzbl (%edx),%edx
+  800867:	29 d0                	sub    %edx,%eax
+}
+  800869:	5d                   	pop    %ebp
+  80086a:	c3                   	ret
+
+0080086b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80086b:	55                   	push   %ebp
+  80086c:	89 e5                	mov    %esp,%ebp
+  80086e:	53                   	push   %ebx
+  80086f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800872:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800875:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800878:	eb 09                	jmp    800883 <strncmp+0x18>
+		n--, p++, q++;
+  80087a:	83 ea 01             	sub    $0x1,%edx
+  80087d:	83 c0 01             	add    $0x1,%eax
+  800880:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800883:	85 d2                	test   %edx,%edx
+  800885:	74 18                	je     80089f <strncmp+0x34>
+  800887:	0f b6 18             	movzbl (%eax),%ebx
+  80088a:	84 db                	test   %bl,%bl
+  80088c:	74 04                	je     800892 <strncmp+0x27>
+  80088e:	3a 19                	cmp    (%ecx),%bl
+  800890:	74 e8                	je     80087a <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800892:	0f b6 00             	movzbl (%eax),%eax
+  800895:	0f b6 11             	movzbl (%ecx),%edx
+  800898:	29 d0                	sub    %edx,%eax
+}
+  80089a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80089d:	c9                   	leave
+  80089e:	c3                   	ret
+		return 0;
+  80089f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a4:	eb f4                	jmp    80089a <strncmp+0x2f>
+
+008008a6 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008a6:	55                   	push   %ebp
+  8008a7:	89 e5                	mov    %esp,%ebp
+  8008a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ac:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008b0:	eb 03                	jmp    8008b5 <strchr+0xf>
+  8008b2:	83 c0 01             	add    $0x1,%eax
+  8008b5:	0f b6 10             	movzbl (%eax),%edx
+  8008b8:	84 d2                	test   %dl,%dl
+  8008ba:	74 06                	je     8008c2 <strchr+0x1c>
+		if (*s == c)
+  8008bc:	38 ca                	cmp    %cl,%dl
+  8008be:	75 f2                	jne    8008b2 <strchr+0xc>
+  8008c0:	eb 05                	jmp    8008c7 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008c7:	5d                   	pop    %ebp
+  8008c8:	c3                   	ret
+
+008008c9 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008c9:	55                   	push   %ebp
+  8008ca:	89 e5                	mov    %esp,%ebp
+  8008cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008cf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008d3:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008d6:	38 ca                	cmp    %cl,%dl
+  8008d8:	74 09                	je     8008e3 <strfind+0x1a>
+  8008da:	84 d2                	test   %dl,%dl
+  8008dc:	74 05                	je     8008e3 <strfind+0x1a>
+	for (; *s; s++)
+  8008de:	83 c0 01             	add    $0x1,%eax
+  8008e1:	eb f0                	jmp    8008d3 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008e3:	5d                   	pop    %ebp
+  8008e4:	c3                   	ret
+
+008008e5 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008e5:	55                   	push   %ebp
+  8008e6:	89 e5                	mov    %esp,%ebp
+  8008e8:	57                   	push   %edi
+  8008e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008ec:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008ef:	85 c9                	test   %ecx,%ecx
+  8008f1:	74 20                	je     800913 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008f3:	89 f8                	mov    %edi,%eax
+  8008f5:	09 c8                	or     %ecx,%eax
+  8008f7:	a8 03                	test   $0x3,%al
+  8008f9:	75 12                	jne    80090d <memset+0x28>
+		c &= 0xFF;
+  8008fb:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008ff:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800905:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800908:	fc                   	cld
+  800909:	f3 ab                	rep stos %eax,%es:(%edi)
+  80090b:	eb 06                	jmp    800913 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80090d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800910:	fc                   	cld
+  800911:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800913:	89 f8                	mov    %edi,%eax
+  800915:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800918:	c9                   	leave
+  800919:	c3                   	ret
+
+0080091a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80091a:	55                   	push   %ebp
+  80091b:	89 e5                	mov    %esp,%ebp
+  80091d:	57                   	push   %edi
+  80091e:	56                   	push   %esi
+  80091f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800922:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800925:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800928:	39 c6                	cmp    %eax,%esi
+  80092a:	73 32                	jae    80095e <memmove+0x44>
+  80092c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80092f:	39 d0                	cmp    %edx,%eax
+  800931:	73 2b                	jae    80095e <memmove+0x44>
+		s += n;
+		d += n;
+  800933:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800936:	89 d6                	mov    %edx,%esi
+  800938:	09 fe                	or     %edi,%esi
+  80093a:	09 ce                	or     %ecx,%esi
+  80093c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800942:	75 0e                	jne    800952 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800944:	83 ef 04             	sub    $0x4,%edi
+  800947:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80094a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80094d:	fd                   	std
+  80094e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800950:	eb 09                	jmp    80095b <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800952:	83 ef 01             	sub    $0x1,%edi
+  800955:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800958:	fd                   	std
+  800959:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80095b:	fc                   	cld
+  80095c:	eb 1a                	jmp    800978 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80095e:	89 f2                	mov    %esi,%edx
+  800960:	09 c2                	or     %eax,%edx
+  800962:	09 ca                	or     %ecx,%edx
+  800964:	f6 c2 03             	test   $0x3,%dl
+  800967:	75 0a                	jne    800973 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800969:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80096c:	89 c7                	mov    %eax,%edi
+  80096e:	fc                   	cld
+  80096f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800971:	eb 05                	jmp    800978 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800973:	89 c7                	mov    %eax,%edi
+  800975:	fc                   	cld
+  800976:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800978:	5e                   	pop    %esi
+  800979:	5f                   	pop    %edi
+  80097a:	5d                   	pop    %ebp
+  80097b:	c3                   	ret
+
+0080097c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80097c:	55                   	push   %ebp
+  80097d:	89 e5                	mov    %esp,%ebp
+  80097f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800982:	ff 75 10             	push   0x10(%ebp)
+  800985:	ff 75 0c             	push   0xc(%ebp)
+  800988:	ff 75 08             	push   0x8(%ebp)
+  80098b:	e8 8a ff ff ff       	call   80091a <memmove>
+}
+  800990:	c9                   	leave
+  800991:	c3                   	ret
+
+00800992 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800992:	55                   	push   %ebp
+  800993:	89 e5                	mov    %esp,%ebp
+  800995:	56                   	push   %esi
+  800996:	53                   	push   %ebx
+  800997:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80099d:	89 c6                	mov    %eax,%esi
+  80099f:	03 75 10             	add    0x10(%ebp),%esi
+  8009a2:	eb 06                	jmp    8009aa <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009a4:	83 c0 01             	add    $0x1,%eax
+  8009a7:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009aa:	39 f0                	cmp    %esi,%eax
+  8009ac:	74 14                	je     8009c2 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009ae:	0f b6 08             	movzbl (%eax),%ecx
+  8009b1:	0f b6 1a             	movzbl (%edx),%ebx
+  8009b4:	38 d9                	cmp    %bl,%cl
+  8009b6:	74 ec                	je     8009a4 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009b8:	0f b6 c1             	movzbl %cl,%eax
+  8009bb:	0f b6 db             	movzbl %bl,%ebx
+  8009be:	29 d8                	sub    %ebx,%eax
+  8009c0:	eb 05                	jmp    8009c7 <memcmp+0x35>
+	}
+
+	return 0;
+  8009c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009c7:	5b                   	pop    %ebx
+  8009c8:	5e                   	pop    %esi
+  8009c9:	5d                   	pop    %ebp
+  8009ca:	c3                   	ret
+
+008009cb <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009cb:	55                   	push   %ebp
+  8009cc:	89 e5                	mov    %esp,%ebp
+  8009ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009d4:	89 c2                	mov    %eax,%edx
+  8009d6:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009d9:	eb 03                	jmp    8009de <memfind+0x13>
+  8009db:	83 c0 01             	add    $0x1,%eax
+  8009de:	39 d0                	cmp    %edx,%eax
+  8009e0:	73 04                	jae    8009e6 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009e2:	38 08                	cmp    %cl,(%eax)
+  8009e4:	75 f5                	jne    8009db <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009e6:	5d                   	pop    %ebp
+  8009e7:	c3                   	ret
+
+008009e8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009e8:	55                   	push   %ebp
+  8009e9:	89 e5                	mov    %esp,%ebp
+  8009eb:	57                   	push   %edi
+  8009ec:	56                   	push   %esi
+  8009ed:	53                   	push   %ebx
+  8009ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009f4:	eb 03                	jmp    8009f9 <strtol+0x11>
+		s++;
+  8009f6:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009f9:	0f b6 02             	movzbl (%edx),%eax
+  8009fc:	3c 20                	cmp    $0x20,%al
+  8009fe:	74 f6                	je     8009f6 <strtol+0xe>
+  800a00:	3c 09                	cmp    $0x9,%al
+  800a02:	74 f2                	je     8009f6 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a04:	3c 2b                	cmp    $0x2b,%al
+  800a06:	74 2a                	je     800a32 <strtol+0x4a>
+	int neg = 0;
+  800a08:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a0d:	3c 2d                	cmp    $0x2d,%al
+  800a0f:	74 2b                	je     800a3c <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a11:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a17:	75 0f                	jne    800a28 <strtol+0x40>
+  800a19:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a1c:	74 28                	je     800a46 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a1e:	85 db                	test   %ebx,%ebx
+  800a20:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a25:	0f 44 d8             	cmove  %eax,%ebx
+  800a28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a2d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a30:	eb 46                	jmp    800a78 <strtol+0x90>
+		s++;
+  800a32:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a35:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a3a:	eb d5                	jmp    800a11 <strtol+0x29>
+		s++, neg = 1;
+  800a3c:	83 c2 01             	add    $0x1,%edx
+  800a3f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a44:	eb cb                	jmp    800a11 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a46:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a4a:	74 0e                	je     800a5a <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a4c:	85 db                	test   %ebx,%ebx
+  800a4e:	75 d8                	jne    800a28 <strtol+0x40>
+		s++, base = 8;
+  800a50:	83 c2 01             	add    $0x1,%edx
+  800a53:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a58:	eb ce                	jmp    800a28 <strtol+0x40>
+		s += 2, base = 16;
+  800a5a:	83 c2 02             	add    $0x2,%edx
+  800a5d:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a62:	eb c4                	jmp    800a28 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a64:	0f be c0             	movsbl %al,%eax
+  800a67:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a6a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a6d:	7d 3a                	jge    800aa9 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a6f:	83 c2 01             	add    $0x1,%edx
+  800a72:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a76:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a78:	0f b6 02             	movzbl (%edx),%eax
+  800a7b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a7e:	89 f3                	mov    %esi,%ebx
+  800a80:	80 fb 09             	cmp    $0x9,%bl
+  800a83:	76 df                	jbe    800a64 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a85:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a88:	89 f3                	mov    %esi,%ebx
+  800a8a:	80 fb 19             	cmp    $0x19,%bl
+  800a8d:	77 08                	ja     800a97 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a8f:	0f be c0             	movsbl %al,%eax
+  800a92:	83 e8 57             	sub    $0x57,%eax
+  800a95:	eb d3                	jmp    800a6a <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a97:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a9a:	89 f3                	mov    %esi,%ebx
+  800a9c:	80 fb 19             	cmp    $0x19,%bl
+  800a9f:	77 08                	ja     800aa9 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800aa1:	0f be c0             	movsbl %al,%eax
+  800aa4:	83 e8 37             	sub    $0x37,%eax
+  800aa7:	eb c1                	jmp    800a6a <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800aa9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800aad:	74 05                	je     800ab4 <strtol+0xcc>
+		*endptr = (char *) s;
+  800aaf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ab2:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ab4:	89 c8                	mov    %ecx,%eax
+  800ab6:	f7 d8                	neg    %eax
+  800ab8:	85 ff                	test   %edi,%edi
+  800aba:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800abd:	89 c8                	mov    %ecx,%eax
+  800abf:	5b                   	pop    %ebx
+  800ac0:	5e                   	pop    %esi
+  800ac1:	5f                   	pop    %edi
+  800ac2:	5d                   	pop    %ebp
+  800ac3:	c3                   	ret
+
+00800ac4 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800ac4:	55                   	push   %ebp
+  800ac5:	89 e5                	mov    %esp,%ebp
+  800ac7:	57                   	push   %edi
+  800ac8:	56                   	push   %esi
+  800ac9:	53                   	push   %ebx
+  800aca:	83 ec 0c             	sub    $0xc,%esp
+  800acd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800ad0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ad3:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800ad6:	85 ff                	test   %edi,%edi
+  800ad8:	74 16                	je     800af0 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800ada:	83 ec 04             	sub    $0x4,%esp
+  800add:	56                   	push   %esi
+  800ade:	6a 00                	push   $0x0
+  800ae0:	53                   	push   %ebx
+  800ae1:	e8 02 ff ff ff       	call   8009e8 <strtol>
+  800ae6:	89 07                	mov    %eax,(%edi)
+  800ae8:	83 c4 10             	add    $0x10,%esp
+  800aeb:	eb 03                	jmp    800af0 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800aed:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800af0:	0f b6 03             	movzbl (%ebx),%eax
+  800af3:	3c 20                	cmp    $0x20,%al
+  800af5:	74 f6                	je     800aed <strisl+0x29>
+  800af7:	3c 09                	cmp    $0x9,%al
+  800af9:	74 f2                	je     800aed <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800afb:	3c 2b                	cmp    $0x2b,%al
+  800afd:	74 23                	je     800b22 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800aff:	3c 2d                	cmp    $0x2d,%al
+  800b01:	0f 94 c0             	sete   %al
+  800b04:	0f b6 c0             	movzbl %al,%eax
+  800b07:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b09:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800b0f:	75 41                	jne    800b52 <strisl+0x8e>
+  800b11:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800b14:	74 11                	je     800b27 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b16:	85 f6                	test   %esi,%esi
+  800b18:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b1d:	0f 44 f0             	cmove  %eax,%esi
+  800b20:	eb 30                	jmp    800b52 <strisl+0x8e>
+		s++;
+  800b22:	83 c3 01             	add    $0x1,%ebx
+  800b25:	eb e2                	jmp    800b09 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b27:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800b2b:	74 0e                	je     800b3b <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800b2d:	85 f6                	test   %esi,%esi
+  800b2f:	75 21                	jne    800b52 <strisl+0x8e>
+		s++, base = 8;
+  800b31:	83 c3 01             	add    $0x1,%ebx
+  800b34:	be 08 00 00 00       	mov    $0x8,%esi
+  800b39:	eb 17                	jmp    800b52 <strisl+0x8e>
+		s += 2, base = 16;
+  800b3b:	83 c3 02             	add    $0x2,%ebx
+  800b3e:	be 10 00 00 00       	mov    $0x10,%esi
+  800b43:	eb 0d                	jmp    800b52 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b45:	0f be c0             	movsbl %al,%eax
+  800b48:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800b4b:	39 f0                	cmp    %esi,%eax
+  800b4d:	7d 38                	jge    800b87 <strisl+0xc3>
+			return 0;
+		s++;
+  800b4f:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800b52:	0f b6 03             	movzbl (%ebx),%eax
+  800b55:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800b58:	80 fa 09             	cmp    $0x9,%dl
+  800b5b:	76 e8                	jbe    800b45 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800b5d:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800b60:	80 fa 19             	cmp    $0x19,%dl
+  800b63:	77 08                	ja     800b6d <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800b65:	0f be c0             	movsbl %al,%eax
+  800b68:	83 e8 57             	sub    $0x57,%eax
+  800b6b:	eb de                	jmp    800b4b <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b6d:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800b70:	80 fa 19             	cmp    $0x19,%dl
+  800b73:	77 08                	ja     800b7d <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800b75:	0f be c0             	movsbl %al,%eax
+  800b78:	83 e8 37             	sub    $0x37,%eax
+  800b7b:	eb ce                	jmp    800b4b <strisl+0x87>
+		else if (!*s)
+  800b7d:	84 c0                	test   %al,%al
+  800b7f:	0f 94 c0             	sete   %al
+  800b82:	0f b6 c0             	movzbl %al,%eax
+  800b85:	eb 05                	jmp    800b8c <strisl+0xc8>
+			return 0;
+  800b87:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800b8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b8f:	5b                   	pop    %ebx
+  800b90:	5e                   	pop    %esi
+  800b91:	5f                   	pop    %edi
+  800b92:	5d                   	pop    %ebp
+  800b93:	c3                   	ret
+
+00800b94 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800b94:	55                   	push   %ebp
+  800b95:	89 e5                	mov    %esp,%ebp
+  800b97:	83 ec 10             	sub    $0x10,%esp
+  800b9a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800b9d:	89 c8                	mov    %ecx,%eax
+  800b9f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800ba4:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800ba7:	eb 0b                	jmp    800bb4 <touch_mem+0x20>
+		c = *(char *)page;
+  800ba9:	0f b6 10             	movzbl (%eax),%edx
+  800bac:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800baf:	05 00 10 00 00       	add    $0x1000,%eax
+  800bb4:	39 c8                	cmp    %ecx,%eax
+  800bb6:	72 f1                	jb     800ba9 <touch_mem+0x15>
+}
+  800bb8:	c9                   	leave
+  800bb9:	c3                   	ret
+
+00800bba <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bba:	55                   	push   %ebp
+  800bbb:	89 e5                	mov    %esp,%ebp
+  800bbd:	57                   	push   %edi
+  800bbe:	56                   	push   %esi
+  800bbf:	53                   	push   %ebx
+	touch_mem(s, len);
+  800bc0:	ff 75 0c             	push   0xc(%ebp)
+  800bc3:	ff 75 08             	push   0x8(%ebp)
+  800bc6:	e8 c9 ff ff ff       	call   800b94 <touch_mem>
+	asm volatile("int %1\n"
+  800bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd6:	89 c3                	mov    %eax,%ebx
+  800bd8:	89 c7                	mov    %eax,%edi
+  800bda:	89 c6                	mov    %eax,%esi
+  800bdc:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bde:	83 c4 08             	add    $0x8,%esp
+  800be1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800be4:	5b                   	pop    %ebx
+  800be5:	5e                   	pop    %esi
+  800be6:	5f                   	pop    %edi
+  800be7:	5d                   	pop    %ebp
+  800be8:	c3                   	ret
+
+00800be9 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800be9:	55                   	push   %ebp
+  800bea:	89 e5                	mov    %esp,%ebp
+  800bec:	57                   	push   %edi
+  800bed:	56                   	push   %esi
+  800bee:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bef:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bf9:	89 d1                	mov    %edx,%ecx
+  800bfb:	89 d3                	mov    %edx,%ebx
+  800bfd:	89 d7                	mov    %edx,%edi
+  800bff:	89 d6                	mov    %edx,%esi
+  800c01:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c03:	5b                   	pop    %ebx
+  800c04:	5e                   	pop    %esi
+  800c05:	5f                   	pop    %edi
+  800c06:	5d                   	pop    %ebp
+  800c07:	c3                   	ret
+
+00800c08 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c08:	55                   	push   %ebp
+  800c09:	89 e5                	mov    %esp,%ebp
+  800c0b:	57                   	push   %edi
+  800c0c:	56                   	push   %esi
+  800c0d:	53                   	push   %ebx
+  800c0e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c19:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c1e:	89 cb                	mov    %ecx,%ebx
+  800c20:	89 cf                	mov    %ecx,%edi
+  800c22:	89 ce                	mov    %ecx,%esi
+  800c24:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c26:	85 c0                	test   %eax,%eax
+  800c28:	7f 08                	jg     800c32 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c2d:	5b                   	pop    %ebx
+  800c2e:	5e                   	pop    %esi
+  800c2f:	5f                   	pop    %edi
+  800c30:	5d                   	pop    %ebp
+  800c31:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c32:	83 ec 0c             	sub    $0xc,%esp
+  800c35:	50                   	push   %eax
+  800c36:	6a 03                	push   $0x3
+  800c38:	68 8b 56 80 00       	push   $0x80568b
+  800c3d:	6a 23                	push   $0x23
+  800c3f:	68 a8 56 80 00       	push   $0x8056a8
+  800c44:	e8 24 40 00 00       	call   804c6d <_panic>
+
+00800c49 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c49:	55                   	push   %ebp
+  800c4a:	89 e5                	mov    %esp,%ebp
+  800c4c:	57                   	push   %edi
+  800c4d:	56                   	push   %esi
+  800c4e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c54:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c59:	89 d1                	mov    %edx,%ecx
+  800c5b:	89 d3                	mov    %edx,%ebx
+  800c5d:	89 d7                	mov    %edx,%edi
+  800c5f:	89 d6                	mov    %edx,%esi
+  800c61:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c63:	5b                   	pop    %ebx
+  800c64:	5e                   	pop    %esi
+  800c65:	5f                   	pop    %edi
+  800c66:	5d                   	pop    %ebp
+  800c67:	c3                   	ret
+
+00800c68 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c68:	55                   	push   %ebp
+  800c69:	89 e5                	mov    %esp,%ebp
+  800c6b:	57                   	push   %edi
+  800c6c:	56                   	push   %esi
+  800c6d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c73:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c78:	89 d1                	mov    %edx,%ecx
+  800c7a:	89 d3                	mov    %edx,%ebx
+  800c7c:	89 d7                	mov    %edx,%edi
+  800c7e:	89 d6                	mov    %edx,%esi
+  800c80:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c82:	5b                   	pop    %ebx
+  800c83:	5e                   	pop    %esi
+  800c84:	5f                   	pop    %edi
+  800c85:	5d                   	pop    %ebp
+  800c86:	c3                   	ret
+
+00800c87 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c87:	55                   	push   %ebp
+  800c88:	89 e5                	mov    %esp,%ebp
+  800c8a:	57                   	push   %edi
+  800c8b:	56                   	push   %esi
+  800c8c:	53                   	push   %ebx
+  800c8d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c90:	be 00 00 00 00       	mov    $0x0,%esi
+  800c95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ca0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ca3:	89 f7                	mov    %esi,%edi
+  800ca5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ca7:	85 c0                	test   %eax,%eax
+  800ca9:	7f 08                	jg     800cb3 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800cab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cae:	5b                   	pop    %ebx
+  800caf:	5e                   	pop    %esi
+  800cb0:	5f                   	pop    %edi
+  800cb1:	5d                   	pop    %ebp
+  800cb2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cb3:	83 ec 0c             	sub    $0xc,%esp
+  800cb6:	50                   	push   %eax
+  800cb7:	6a 04                	push   $0x4
+  800cb9:	68 8b 56 80 00       	push   $0x80568b
+  800cbe:	6a 23                	push   $0x23
+  800cc0:	68 a8 56 80 00       	push   $0x8056a8
+  800cc5:	e8 a3 3f 00 00       	call   804c6d <_panic>
+
+00800cca <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cca:	55                   	push   %ebp
+  800ccb:	89 e5                	mov    %esp,%ebp
+  800ccd:	57                   	push   %edi
+  800cce:	56                   	push   %esi
+  800ccf:	53                   	push   %ebx
+  800cd0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd9:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cde:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ce1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ce4:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ce7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ce9:	85 c0                	test   %eax,%eax
+  800ceb:	7f 08                	jg     800cf5 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ced:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf0:	5b                   	pop    %ebx
+  800cf1:	5e                   	pop    %esi
+  800cf2:	5f                   	pop    %edi
+  800cf3:	5d                   	pop    %ebp
+  800cf4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf5:	83 ec 0c             	sub    $0xc,%esp
+  800cf8:	50                   	push   %eax
+  800cf9:	6a 05                	push   $0x5
+  800cfb:	68 8b 56 80 00       	push   $0x80568b
+  800d00:	6a 23                	push   $0x23
+  800d02:	68 a8 56 80 00       	push   $0x8056a8
+  800d07:	e8 61 3f 00 00       	call   804c6d <_panic>
+
+00800d0c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d0c:	55                   	push   %ebp
+  800d0d:	89 e5                	mov    %esp,%ebp
+  800d0f:	57                   	push   %edi
+  800d10:	56                   	push   %esi
+  800d11:	53                   	push   %ebx
+  800d12:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d20:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d25:	89 df                	mov    %ebx,%edi
+  800d27:	89 de                	mov    %ebx,%esi
+  800d29:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d2b:	85 c0                	test   %eax,%eax
+  800d2d:	7f 08                	jg     800d37 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d32:	5b                   	pop    %ebx
+  800d33:	5e                   	pop    %esi
+  800d34:	5f                   	pop    %edi
+  800d35:	5d                   	pop    %ebp
+  800d36:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d37:	83 ec 0c             	sub    $0xc,%esp
+  800d3a:	50                   	push   %eax
+  800d3b:	6a 06                	push   $0x6
+  800d3d:	68 8b 56 80 00       	push   $0x80568b
+  800d42:	6a 23                	push   $0x23
+  800d44:	68 a8 56 80 00       	push   $0x8056a8
+  800d49:	e8 1f 3f 00 00       	call   804c6d <_panic>
+
+00800d4e <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800d4e:	55                   	push   %ebp
+  800d4f:	89 e5                	mov    %esp,%ebp
+  800d51:	57                   	push   %edi
+  800d52:	56                   	push   %esi
+  800d53:	53                   	push   %ebx
+  800d54:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d62:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d67:	89 df                	mov    %ebx,%edi
+  800d69:	89 de                	mov    %ebx,%esi
+  800d6b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d6d:	85 c0                	test   %eax,%eax
+  800d6f:	7f 08                	jg     800d79 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d74:	5b                   	pop    %ebx
+  800d75:	5e                   	pop    %esi
+  800d76:	5f                   	pop    %edi
+  800d77:	5d                   	pop    %ebp
+  800d78:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d79:	83 ec 0c             	sub    $0xc,%esp
+  800d7c:	50                   	push   %eax
+  800d7d:	6a 18                	push   $0x18
+  800d7f:	68 8b 56 80 00       	push   $0x80568b
+  800d84:	6a 23                	push   $0x23
+  800d86:	68 a8 56 80 00       	push   $0x8056a8
+  800d8b:	e8 dd 3e 00 00       	call   804c6d <_panic>
+
+00800d90 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800d90:	55                   	push   %ebp
+  800d91:	89 e5                	mov    %esp,%ebp
+  800d93:	57                   	push   %edi
+  800d94:	56                   	push   %esi
+  800d95:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d96:	be 00 00 00 00       	mov    $0x0,%esi
+  800d9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da1:	b8 19 00 00 00       	mov    $0x19,%eax
+  800da6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da9:	89 f7                	mov    %esi,%edi
+  800dab:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800dad:	5b                   	pop    %ebx
+  800dae:	5e                   	pop    %esi
+  800daf:	5f                   	pop    %edi
+  800db0:	5d                   	pop    %ebp
+  800db1:	c3                   	ret
+
+00800db2 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800db2:	55                   	push   %ebp
+  800db3:	89 e5                	mov    %esp,%ebp
+  800db5:	57                   	push   %edi
+  800db6:	56                   	push   %esi
+  800db7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800db8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbe:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800dc3:	be 00 00 00 00       	mov    $0x0,%esi
+  800dc8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dcb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dce:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800dd0:	5b                   	pop    %ebx
+  800dd1:	5e                   	pop    %esi
+  800dd2:	5f                   	pop    %edi
+  800dd3:	5d                   	pop    %ebp
+  800dd4:	c3                   	ret
+
+00800dd5 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800dd5:	55                   	push   %ebp
+  800dd6:	89 e5                	mov    %esp,%ebp
+  800dd8:	57                   	push   %edi
+  800dd9:	56                   	push   %esi
+  800dda:	53                   	push   %ebx
+  800ddb:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800dde:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800de1:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800de7:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800dea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ded:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df0:	b8 10 00 00 00       	mov    $0x10,%eax
+  800df5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df8:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dfb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dfd:	85 c0                	test   %eax,%eax
+  800dff:	7f 08                	jg     800e09 <sys_page_map_range+0x34>
+}
+  800e01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e04:	5b                   	pop    %ebx
+  800e05:	5e                   	pop    %esi
+  800e06:	5f                   	pop    %edi
+  800e07:	5d                   	pop    %ebp
+  800e08:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e09:	83 ec 0c             	sub    $0xc,%esp
+  800e0c:	50                   	push   %eax
+  800e0d:	6a 10                	push   $0x10
+  800e0f:	68 8b 56 80 00       	push   $0x80568b
+  800e14:	6a 23                	push   $0x23
+  800e16:	68 a8 56 80 00       	push   $0x8056a8
+  800e1b:	e8 4d 3e 00 00       	call   804c6d <_panic>
+
+00800e20 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e20:	55                   	push   %ebp
+  800e21:	89 e5                	mov    %esp,%ebp
+  800e23:	57                   	push   %edi
+  800e24:	56                   	push   %esi
+  800e25:	53                   	push   %ebx
+  800e26:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e29:	be 00 00 00 00       	mov    $0x0,%esi
+  800e2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e34:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e3c:	89 f7                	mov    %esi,%edi
+  800e3e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e40:	85 c0                	test   %eax,%eax
+  800e42:	7f 08                	jg     800e4c <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e47:	5b                   	pop    %ebx
+  800e48:	5e                   	pop    %esi
+  800e49:	5f                   	pop    %edi
+  800e4a:	5d                   	pop    %ebp
+  800e4b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e4c:	83 ec 0c             	sub    $0xc,%esp
+  800e4f:	50                   	push   %eax
+  800e50:	6a 11                	push   $0x11
+  800e52:	68 8b 56 80 00       	push   $0x80568b
+  800e57:	6a 23                	push   $0x23
+  800e59:	68 a8 56 80 00       	push   $0x8056a8
+  800e5e:	e8 0a 3e 00 00       	call   804c6d <_panic>
+
+00800e63 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800e63:	55                   	push   %ebp
+  800e64:	89 e5                	mov    %esp,%ebp
+  800e66:	57                   	push   %edi
+  800e67:	56                   	push   %esi
+  800e68:	53                   	push   %ebx
+  800e69:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e6c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e77:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800e7c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e7f:	89 f7                	mov    %esi,%edi
+  800e81:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e83:	85 c0                	test   %eax,%eax
+  800e85:	7f 08                	jg     800e8f <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8a:	5b                   	pop    %ebx
+  800e8b:	5e                   	pop    %esi
+  800e8c:	5f                   	pop    %edi
+  800e8d:	5d                   	pop    %ebp
+  800e8e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8f:	83 ec 0c             	sub    $0xc,%esp
+  800e92:	50                   	push   %eax
+  800e93:	6a 1b                	push   $0x1b
+  800e95:	68 8b 56 80 00       	push   $0x80568b
+  800e9a:	6a 23                	push   $0x23
+  800e9c:	68 a8 56 80 00       	push   $0x8056a8
+  800ea1:	e8 c7 3d 00 00       	call   804c6d <_panic>
+
+00800ea6 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800ea6:	55                   	push   %ebp
+  800ea7:	89 e5                	mov    %esp,%ebp
+  800ea9:	57                   	push   %edi
+  800eaa:	56                   	push   %esi
+  800eab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eac:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb1:	b8 12 00 00 00       	mov    $0x12,%eax
+  800eb6:	89 d1                	mov    %edx,%ecx
+  800eb8:	89 d3                	mov    %edx,%ebx
+  800eba:	89 d7                	mov    %edx,%edi
+  800ebc:	89 d6                	mov    %edx,%esi
+  800ebe:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800ec0:	5b                   	pop    %ebx
+  800ec1:	5e                   	pop    %esi
+  800ec2:	5f                   	pop    %edi
+  800ec3:	5d                   	pop    %ebp
+  800ec4:	c3                   	ret
+
+00800ec5 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ec5:	55                   	push   %ebp
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	57                   	push   %edi
+  800ec9:	56                   	push   %esi
+  800eca:	53                   	push   %ebx
+  800ecb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ece:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed9:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ede:	89 df                	mov    %ebx,%edi
+  800ee0:	89 de                	mov    %ebx,%esi
+  800ee2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee4:	85 c0                	test   %eax,%eax
+  800ee6:	7f 08                	jg     800ef0 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ee8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eeb:	5b                   	pop    %ebx
+  800eec:	5e                   	pop    %esi
+  800eed:	5f                   	pop    %edi
+  800eee:	5d                   	pop    %ebp
+  800eef:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef0:	83 ec 0c             	sub    $0xc,%esp
+  800ef3:	50                   	push   %eax
+  800ef4:	6a 08                	push   $0x8
+  800ef6:	68 8b 56 80 00       	push   $0x80568b
+  800efb:	6a 23                	push   $0x23
+  800efd:	68 a8 56 80 00       	push   $0x8056a8
+  800f02:	e8 66 3d 00 00       	call   804c6d <_panic>
+
+00800f07 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f07:	55                   	push   %ebp
+  800f08:	89 e5                	mov    %esp,%ebp
+  800f0a:	57                   	push   %edi
+  800f0b:	56                   	push   %esi
+  800f0c:	53                   	push   %ebx
+  800f0d:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800f10:	6a 44                	push   $0x44
+  800f12:	ff 75 0c             	push   0xc(%ebp)
+  800f15:	e8 7a fc ff ff       	call   800b94 <touch_mem>
+	asm volatile("int %1\n"
+  800f1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f22:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2a:	89 df                	mov    %ebx,%edi
+  800f2c:	89 de                	mov    %ebx,%esi
+  800f2e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f30:	83 c4 08             	add    $0x8,%esp
+  800f33:	85 c0                	test   %eax,%eax
+  800f35:	7f 08                	jg     800f3f <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3a:	5b                   	pop    %ebx
+  800f3b:	5e                   	pop    %esi
+  800f3c:	5f                   	pop    %edi
+  800f3d:	5d                   	pop    %ebp
+  800f3e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f3f:	83 ec 0c             	sub    $0xc,%esp
+  800f42:	50                   	push   %eax
+  800f43:	6a 09                	push   $0x9
+  800f45:	68 8b 56 80 00       	push   $0x80568b
+  800f4a:	6a 23                	push   $0x23
+  800f4c:	68 a8 56 80 00       	push   $0x8056a8
+  800f51:	e8 17 3d 00 00       	call   804c6d <_panic>
+
+00800f56 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800f56:	55                   	push   %ebp
+  800f57:	89 e5                	mov    %esp,%ebp
+  800f59:	57                   	push   %edi
+  800f5a:	56                   	push   %esi
+  800f5b:	53                   	push   %ebx
+  800f5c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f5f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800f6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f72:	89 f7                	mov    %esi,%edi
+  800f74:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f76:	85 c0                	test   %eax,%eax
+  800f78:	7f 08                	jg     800f82 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800f7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7d:	5b                   	pop    %ebx
+  800f7e:	5e                   	pop    %esi
+  800f7f:	5f                   	pop    %edi
+  800f80:	5d                   	pop    %ebp
+  800f81:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f82:	83 ec 0c             	sub    $0xc,%esp
+  800f85:	50                   	push   %eax
+  800f86:	6a 1a                	push   $0x1a
+  800f88:	68 8b 56 80 00       	push   $0x80568b
+  800f8d:	6a 23                	push   $0x23
+  800f8f:	68 a8 56 80 00       	push   $0x8056a8
+  800f94:	e8 d4 3c 00 00       	call   804c6d <_panic>
+
+00800f99 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  800f99:	55                   	push   %ebp
+  800f9a:	89 e5                	mov    %esp,%ebp
+  800f9c:	57                   	push   %edi
+  800f9d:	56                   	push   %esi
+  800f9e:	53                   	push   %ebx
+  800f9f:	83 ec 0c             	sub    $0xc,%esp
+  800fa2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  800fa5:	89 d8                	mov    %ebx,%eax
+  800fa7:	c1 e0 05             	shl    $0x5,%eax
+  800faa:	50                   	push   %eax
+  800fab:	ff 75 0c             	push   0xc(%ebp)
+  800fae:	e8 e1 fb ff ff       	call   800b94 <touch_mem>
+	asm volatile("int %1\n"
+  800fb3:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbb:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc3:	89 f7                	mov    %esi,%edi
+  800fc5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc7:	83 c4 08             	add    $0x8,%esp
+  800fca:	85 c0                	test   %eax,%eax
+  800fcc:	7f 08                	jg     800fd6 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  800fce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd1:	5b                   	pop    %ebx
+  800fd2:	5e                   	pop    %esi
+  800fd3:	5f                   	pop    %edi
+  800fd4:	5d                   	pop    %ebp
+  800fd5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd6:	83 ec 0c             	sub    $0xc,%esp
+  800fd9:	50                   	push   %eax
+  800fda:	6a 13                	push   $0x13
+  800fdc:	68 8b 56 80 00       	push   $0x80568b
+  800fe1:	6a 23                	push   $0x23
+  800fe3:	68 a8 56 80 00       	push   $0x8056a8
+  800fe8:	e8 80 3c 00 00       	call   804c6d <_panic>
+
+00800fed <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fed:	55                   	push   %ebp
+  800fee:	89 e5                	mov    %esp,%ebp
+  800ff0:	57                   	push   %edi
+  800ff1:	56                   	push   %esi
+  800ff2:	53                   	push   %ebx
+  800ff3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ff6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801001:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801006:	89 df                	mov    %ebx,%edi
+  801008:	89 de                	mov    %ebx,%esi
+  80100a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80100c:	85 c0                	test   %eax,%eax
+  80100e:	7f 08                	jg     801018 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801010:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801013:	5b                   	pop    %ebx
+  801014:	5e                   	pop    %esi
+  801015:	5f                   	pop    %edi
+  801016:	5d                   	pop    %ebp
+  801017:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801018:	83 ec 0c             	sub    $0xc,%esp
+  80101b:	50                   	push   %eax
+  80101c:	6a 0a                	push   $0xa
+  80101e:	68 8b 56 80 00       	push   $0x80568b
+  801023:	6a 23                	push   $0x23
+  801025:	68 a8 56 80 00       	push   $0x8056a8
+  80102a:	e8 3e 3c 00 00       	call   804c6d <_panic>
+
+0080102f <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80102f:	55                   	push   %ebp
+  801030:	89 e5                	mov    %esp,%ebp
+  801032:	57                   	push   %edi
+  801033:	56                   	push   %esi
+  801034:	53                   	push   %ebx
+  801035:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801038:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80103e:	76 1d                	jbe    80105d <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  801040:	8b 55 08             	mov    0x8(%ebp),%edx
+  801043:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801046:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80104b:	be 01 00 00 00       	mov    $0x1,%esi
+  801050:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801053:	cd 30                	int    $0x30
+}
+  801055:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801058:	5b                   	pop    %ebx
+  801059:	5e                   	pop    %esi
+  80105a:	5f                   	pop    %edi
+  80105b:	5d                   	pop    %ebp
+  80105c:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80105d:	68 00 10 00 00       	push   $0x1000
+  801062:	53                   	push   %ebx
+  801063:	e8 2c fb ff ff       	call   800b94 <touch_mem>
+  801068:	83 c4 08             	add    $0x8,%esp
+  80106b:	eb d3                	jmp    801040 <sys_ipc_send+0x11>
+
+0080106d <sys_ipc_send_pages>:
+{
+  80106d:	55                   	push   %ebp
+  80106e:	89 e5                	mov    %esp,%ebp
+  801070:	57                   	push   %edi
+  801071:	56                   	push   %esi
+  801072:	53                   	push   %ebx
+  801073:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801076:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801079:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80107f:	76 18                	jbe    801099 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  801081:	8b 55 08             	mov    0x8(%ebp),%edx
+  801084:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801087:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80108c:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80108f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  801091:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801094:	5b                   	pop    %ebx
+  801095:	5e                   	pop    %esi
+  801096:	5f                   	pop    %edi
+  801097:	5d                   	pop    %ebp
+  801098:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801099:	89 f0                	mov    %esi,%eax
+  80109b:	c1 e0 0c             	shl    $0xc,%eax
+  80109e:	50                   	push   %eax
+  80109f:	53                   	push   %ebx
+  8010a0:	e8 ef fa ff ff       	call   800b94 <touch_mem>
+  8010a5:	83 c4 08             	add    $0x8,%esp
+  8010a8:	eb d7                	jmp    801081 <sys_ipc_send_pages+0x14>
+
+008010aa <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8010aa:	55                   	push   %ebp
+  8010ab:	89 e5                	mov    %esp,%ebp
+  8010ad:	57                   	push   %edi
+  8010ae:	56                   	push   %esi
+  8010af:	53                   	push   %ebx
+  8010b0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010be:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010c3:	89 df                	mov    %ebx,%edi
+  8010c5:	89 de                	mov    %ebx,%esi
+  8010c7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010c9:	85 c0                	test   %eax,%eax
+  8010cb:	7f 08                	jg     8010d5 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8010cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d0:	5b                   	pop    %ebx
+  8010d1:	5e                   	pop    %esi
+  8010d2:	5f                   	pop    %edi
+  8010d3:	5d                   	pop    %ebp
+  8010d4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d5:	83 ec 0c             	sub    $0xc,%esp
+  8010d8:	50                   	push   %eax
+  8010d9:	6a 0d                	push   $0xd
+  8010db:	68 8b 56 80 00       	push   $0x80568b
+  8010e0:	6a 23                	push   $0x23
+  8010e2:	68 a8 56 80 00       	push   $0x8056a8
+  8010e7:	e8 81 3b 00 00       	call   804c6d <_panic>
+
+008010ec <sys_ipc_recv>:
+{
+  8010ec:	55                   	push   %ebp
+  8010ed:	89 e5                	mov    %esp,%ebp
+  8010ef:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8010f2:	6a 01                	push   $0x1
+  8010f4:	ff 75 08             	push   0x8(%ebp)
+  8010f7:	e8 ae ff ff ff       	call   8010aa <sys_ipc_recv_pages>
+}
+  8010fc:	c9                   	leave
+  8010fd:	c3                   	ret
+
+008010fe <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8010fe:	55                   	push   %ebp
+  8010ff:	89 e5                	mov    %esp,%ebp
+  801101:	57                   	push   %edi
+  801102:	56                   	push   %esi
+  801103:	53                   	push   %ebx
+  801104:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801107:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80110a:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  80110d:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801113:	77 04                	ja     801119 <sys_ipc_call+0x1b>
+  801115:	85 f6                	test   %esi,%esi
+  801117:	75 15                	jne    80112e <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801119:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801124:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801129:	5b                   	pop    %ebx
+  80112a:	5e                   	pop    %esi
+  80112b:	5f                   	pop    %edi
+  80112c:	5d                   	pop    %ebp
+  80112d:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80112e:	89 f8                	mov    %edi,%eax
+  801130:	c1 e0 0c             	shl    $0xc,%eax
+  801133:	50                   	push   %eax
+  801134:	53                   	push   %ebx
+  801135:	e8 5a fa ff ff       	call   800b94 <touch_mem>
+  80113a:	83 c4 08             	add    $0x8,%esp
+  80113d:	eb da                	jmp    801119 <sys_ipc_call+0x1b>
+
+0080113f <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80113f:	55                   	push   %ebp
+  801140:	89 e5                	mov    %esp,%ebp
+  801142:	57                   	push   %edi
+  801143:	56                   	push   %esi
+  801144:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801145:	8b 55 08             	mov    0x8(%ebp),%edx
+  801148:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801150:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801153:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801156:	8b 75 18             	mov    0x18(%ebp),%esi
+  801159:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80115b:	5b                   	pop    %ebx
+  80115c:	5e                   	pop    %esi
+  80115d:	5f                   	pop    %edi
+  80115e:	5d                   	pop    %ebp
+  80115f:	c3                   	ret
+
+00801160 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  801160:	55                   	push   %ebp
+  801161:	89 e5                	mov    %esp,%ebp
+  801163:	57                   	push   %edi
+  801164:	56                   	push   %esi
+  801165:	53                   	push   %ebx
+  801166:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801169:	6a 04                	push   $0x4
+  80116b:	ff 75 08             	push   0x8(%ebp)
+  80116e:	e8 21 fa ff ff       	call   800b94 <touch_mem>
+	asm volatile("int %1\n"
+  801173:	be 00 00 00 00       	mov    $0x0,%esi
+  801178:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117b:	b8 16 00 00 00       	mov    $0x16,%eax
+  801180:	8b 55 08             	mov    0x8(%ebp),%edx
+  801183:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801186:	89 f7                	mov    %esi,%edi
+  801188:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80118a:	83 c4 08             	add    $0x8,%esp
+  80118d:	85 c0                	test   %eax,%eax
+  80118f:	7f 08                	jg     801199 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  801191:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801194:	5b                   	pop    %ebx
+  801195:	5e                   	pop    %esi
+  801196:	5f                   	pop    %edi
+  801197:	5d                   	pop    %ebp
+  801198:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801199:	83 ec 0c             	sub    $0xc,%esp
+  80119c:	50                   	push   %eax
+  80119d:	6a 16                	push   $0x16
+  80119f:	68 8b 56 80 00       	push   $0x80568b
+  8011a4:	6a 23                	push   $0x23
+  8011a6:	68 a8 56 80 00       	push   $0x8056a8
+  8011ab:	e8 bd 3a 00 00       	call   804c6d <_panic>
+
+008011b0 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8011b0:	55                   	push   %ebp
+  8011b1:	89 e5                	mov    %esp,%ebp
+  8011b3:	57                   	push   %edi
+  8011b4:	56                   	push   %esi
+  8011b5:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8011b6:	6a 04                	push   $0x4
+  8011b8:	ff 75 08             	push   0x8(%ebp)
+  8011bb:	e8 d4 f9 ff ff       	call   800b94 <touch_mem>
+	asm volatile("int %1\n"
+  8011c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c8:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d0:	89 df                	mov    %ebx,%edi
+  8011d2:	89 de                	mov    %ebx,%esi
+  8011d4:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8011d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d9:	5b                   	pop    %ebx
+  8011da:	5e                   	pop    %esi
+  8011db:	5f                   	pop    %edi
+  8011dc:	5d                   	pop    %ebp
+  8011dd:	c3                   	ret
+
+008011de <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8011de:	55                   	push   %ebp
+  8011df:	89 e5                	mov    %esp,%ebp
+  8011e1:	57                   	push   %edi
+  8011e2:	56                   	push   %esi
+  8011e3:	53                   	push   %ebx
+  8011e4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ef:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011f4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011f9:	89 df                	mov    %ebx,%edi
+  8011fb:	89 de                	mov    %ebx,%esi
+  8011fd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011ff:	85 c0                	test   %eax,%eax
+  801201:	7f 08                	jg     80120b <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801203:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801206:	5b                   	pop    %ebx
+  801207:	5e                   	pop    %esi
+  801208:	5f                   	pop    %edi
+  801209:	5d                   	pop    %ebp
+  80120a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80120b:	83 ec 0c             	sub    $0xc,%esp
+  80120e:	50                   	push   %eax
+  80120f:	6a 0e                	push   $0xe
+  801211:	68 8b 56 80 00       	push   $0x80568b
+  801216:	6a 23                	push   $0x23
+  801218:	68 a8 56 80 00       	push   $0x8056a8
+  80121d:	e8 4b 3a 00 00       	call   804c6d <_panic>
+
+00801222 <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  801222:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801229:	f6 c6 06             	test   $0x6,%dh
+  80122c:	75 37                	jne    801265 <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  80122e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801235:	f6 c2 02             	test   $0x2,%dl
+  801238:	75 19                	jne    801253 <dupperm+0x31>
+  80123a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801241:	f6 c6 08             	test   $0x8,%dh
+  801244:	75 0d                	jne    801253 <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  801246:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80124d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801252:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801253:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80125a:	25 00 06 00 00       	and    $0x600,%eax
+  80125f:	0d 05 08 00 00       	or     $0x805,%eax
+  801264:	c3                   	ret
+		return 0;
+  801265:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80126a:	c3                   	ret
+
+0080126b <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  80126b:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  80126d:	c1 e0 0c             	shl    $0xc,%eax
+  801270:	c1 e8 16             	shr    $0x16,%eax
+  801273:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  80127a:	f6 c1 01             	test   $0x1,%cl
+  80127d:	74 2c                	je     8012ab <dupable+0x40>
+  80127f:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801286:	b8 00 00 00 00       	mov    $0x0,%eax
+  80128b:	f6 c1 04             	test   $0x4,%cl
+  80128e:	74 20                	je     8012b0 <dupable+0x45>
+  801290:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801297:	f6 c1 01             	test   $0x1,%cl
+  80129a:	74 14                	je     8012b0 <dupable+0x45>
+  80129c:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8012a3:	c1 e8 02             	shr    $0x2,%eax
+  8012a6:	83 e0 01             	and    $0x1,%eax
+  8012a9:	eb 05                	jmp    8012b0 <dupable+0x45>
+  8012ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b0:	83 e0 01             	and    $0x1,%eax
+}
+  8012b3:	c3                   	ret
+
+008012b4 <pgfault>:
+{
+  8012b4:	55                   	push   %ebp
+  8012b5:	89 e5                	mov    %esp,%ebp
+  8012b7:	56                   	push   %esi
+  8012b8:	53                   	push   %ebx
+  8012b9:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8012bc:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  8012be:	89 ca                	mov    %ecx,%edx
+  8012c0:	c1 ea 0c             	shr    $0xc,%edx
+  8012c3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  8012ca:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8012ce:	0f 84 8e 00 00 00    	je     801362 <pgfault+0xae>
+		return 0;
+  8012d4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  8012d9:	f6 c6 08             	test   $0x8,%dh
+  8012dc:	0f 84 85 00 00 00    	je     801367 <pgfault+0xb3>
+	perm |= PTE_W;
+  8012e2:	81 e2 07 06 00 00    	and    $0x607,%edx
+  8012e8:	89 d3                	mov    %edx,%ebx
+  8012ea:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8012ed:	89 ce                	mov    %ecx,%esi
+  8012ef:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  8012f5:	6a 01                	push   $0x1
+  8012f7:	53                   	push   %ebx
+  8012f8:	68 00 f0 7f 00       	push   $0x7ff000
+  8012fd:	6a 00                	push   $0x0
+  8012ff:	e8 39 27 00 00       	call   803a3d <page_alloc>
+  801304:	83 c4 10             	add    $0x10,%esp
+  801307:	85 c0                	test   %eax,%eax
+  801309:	78 33                	js     80133e <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  80130b:	83 ec 04             	sub    $0x4,%esp
+  80130e:	68 00 10 00 00       	push   $0x1000
+  801313:	56                   	push   %esi
+  801314:	68 00 f0 7f 00       	push   $0x7ff000
+  801319:	e8 fc f5 ff ff       	call   80091a <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  80131e:	89 1c 24             	mov    %ebx,(%esp)
+  801321:	56                   	push   %esi
+  801322:	6a 00                	push   $0x0
+  801324:	68 00 f0 7f 00       	push   $0x7ff000
+  801329:	6a 00                	push   $0x0
+  80132b:	e8 6e 2d 00 00       	call   80409e <page_map>
+  801330:	83 c4 20             	add    $0x20,%esp
+  801333:	85 c0                	test   %eax,%eax
+  801335:	78 19                	js     801350 <pgfault+0x9c>
+	return 1;
+  801337:	b8 01 00 00 00       	mov    $0x1,%eax
+  80133c:	eb 29                	jmp    801367 <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  80133e:	50                   	push   %eax
+  80133f:	68 b8 56 80 00       	push   $0x8056b8
+  801344:	6a 2e                	push   $0x2e
+  801346:	68 0b 57 80 00       	push   $0x80570b
+  80134b:	e8 1d 39 00 00       	call   804c6d <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  801350:	50                   	push   %eax
+  801351:	68 e4 56 80 00       	push   $0x8056e4
+  801356:	6a 32                	push   $0x32
+  801358:	68 0b 57 80 00       	push   $0x80570b
+  80135d:	e8 0b 39 00 00       	call   804c6d <_panic>
+		return 0;
+  801362:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801367:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80136a:	5b                   	pop    %ebx
+  80136b:	5e                   	pop    %esi
+  80136c:	5d                   	pop    %ebp
+  80136d:	c3                   	ret
+
+0080136e <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  80136e:	55                   	push   %ebp
+  80136f:	89 e5                	mov    %esp,%ebp
+  801371:	57                   	push   %edi
+  801372:	56                   	push   %esi
+  801373:	53                   	push   %ebx
+  801374:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  801377:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  80137e:	74 5d                	je     8013dd <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  801380:	83 ec 0c             	sub    $0xc,%esp
+  801383:	68 b4 12 80 00       	push   $0x8012b4
+  801388:	e8 b8 39 00 00       	call   804d45 <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  80138d:	e8 14 fb ff ff       	call   800ea6 <sys_fork>
+  801392:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801395:	83 c4 10             	add    $0x10,%esp
+  801398:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  80139b:	74 47                	je     8013e4 <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  80139d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8013a1:	0f 84 c5 03 00 00    	je     80176c <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  8013a7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8013ab:	78 25                	js     8013d2 <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  8013ad:	e8 03 20 00 00       	call   8033b5 <page_share_paged_out>
+  8013b2:	85 c0                	test   %eax,%eax
+  8013b4:	0f 88 d8 03 00 00    	js     801792 <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  8013ba:	83 ec 08             	sub    $0x8,%esp
+  8013bd:	6a 02                	push   $0x2
+  8013bf:	ff 75 e4             	push   -0x1c(%ebp)
+  8013c2:	e8 fe fa ff ff       	call   800ec5 <sys_env_set_status>
+  8013c7:	83 c4 10             	add    $0x10,%esp
+  8013ca:	85 c0                	test   %eax,%eax
+  8013cc:	0f 88 d5 03 00 00    	js     8017a7 <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  8013d2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8013d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d8:	5b                   	pop    %ebx
+  8013d9:	5e                   	pop    %esi
+  8013da:	5f                   	pop    %edi
+  8013db:	5d                   	pop    %ebp
+  8013dc:	c3                   	ret
+		init_map_dir();
+  8013dd:	e8 db 22 00 00       	call   8036bd <init_map_dir>
+  8013e2:	eb 9c                	jmp    801380 <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8013e4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013e9:	cd 30                	int    $0x30
+  8013eb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  8013ee:	85 c0                	test   %eax,%eax
+  8013f0:	78 10                	js     801402 <fork+0x94>
+	if (envid == 0)
+  8013f2:	0f 84 74 03 00 00    	je     80176c <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  8013f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013fd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801400:	eb 30                	jmp    801432 <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  801402:	50                   	push   %eax
+  801403:	68 16 57 80 00       	push   $0x805716
+  801408:	68 cd 00 00 00       	push   $0xcd
+  80140d:	68 0b 57 80 00       	push   $0x80570b
+  801412:	e8 56 38 00 00       	call   804c6d <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  801417:	89 f2                	mov    %esi,%edx
+  801419:	c1 fa 1f             	sar    $0x1f,%edx
+  80141c:	c1 ea 16             	shr    $0x16,%edx
+  80141f:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  801422:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801427:	29 d0                	sub    %edx,%eax
+  801429:	ba 00 04 00 00       	mov    $0x400,%edx
+  80142e:	29 c2                	sub    %eax,%edx
+  801430:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801432:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  801435:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  80143b:	0f 87 ff 02 00 00    	ja     801740 <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  801441:	89 f3                	mov    %esi,%ebx
+  801443:	c1 e3 0c             	shl    $0xc,%ebx
+  801446:	89 d8                	mov    %ebx,%eax
+  801448:	c1 e8 16             	shr    $0x16,%eax
+  80144b:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801452:	f6 c2 01             	test   $0x1,%dl
+  801455:	74 c0                	je     801417 <fork+0xa9>
+  801457:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80145e:	f6 c2 04             	test   $0x4,%dl
+  801461:	74 b4                	je     801417 <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  801463:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80146a:	a8 80                	test   $0x80,%al
+  80146c:	75 24                	jne    801492 <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  80146e:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801475:	25 81 00 00 00       	and    $0x81,%eax
+  80147a:	3d 80 00 00 00       	cmp    $0x80,%eax
+  80147f:	74 21                	je     8014a2 <fork+0x134>
+		if (!dupable(pn)) {
+  801481:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801484:	e8 e2 fd ff ff       	call   80126b <dupable>
+  801489:	84 c0                	test   %al,%al
+  80148b:	75 1a                	jne    8014a7 <fork+0x139>
+			++pn;
+  80148d:	83 c6 01             	add    $0x1,%esi
+			continue;
+  801490:	eb a0                	jmp    801432 <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  801492:	83 ec 08             	sub    $0x8,%esp
+  801495:	53                   	push   %ebx
+  801496:	6a 00                	push   $0x0
+  801498:	e8 b1 f8 ff ff       	call   800d4e <sys_page_split>
+  80149d:	83 c4 10             	add    $0x10,%esp
+  8014a0:	eb cc                	jmp    80146e <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  8014a2:	0f b6 03             	movzbl (%ebx),%eax
+  8014a5:	eb da                	jmp    801481 <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  8014a7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8014aa:	89 f8                	mov    %edi,%eax
+  8014ac:	e8 71 fd ff ff       	call   801222 <dupperm>
+  8014b1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8014b4:	85 c0                	test   %eax,%eax
+  8014b6:	74 16                	je     8014ce <fork+0x160>
+  8014b8:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  8014bd:	29 f8                	sub    %edi,%eax
+  8014bf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  8014c2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8014c7:	89 c6                	mov    %eax,%esi
+  8014c9:	e9 c4 01 00 00       	jmp    801692 <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  8014ce:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014d1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014d8:	f6 c4 04             	test   $0x4,%ah
+  8014db:	0f 85 89 00 00 00    	jne    80156a <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  8014e1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014e4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014eb:	f6 c4 02             	test   $0x2,%ah
+  8014ee:	0f 85 b1 00 00 00    	jne    8015a5 <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  8014f4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8014f7:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8014fe:	a8 02                	test   $0x2,%al
+  801500:	75 10                	jne    801512 <fork+0x1a4>
+  801502:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801509:	f6 c4 08             	test   $0x8,%ah
+  80150c:	0f 84 3e 01 00 00    	je     801650 <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801512:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801515:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80151c:	25 00 06 00 00       	and    $0x600,%eax
+  801521:	0d 05 08 00 00       	or     $0x805,%eax
+  801526:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  801528:	c1 e1 0c             	shl    $0xc,%ecx
+  80152b:	89 cb                	mov    %ecx,%ebx
+  80152d:	83 ec 0c             	sub    $0xc,%esp
+  801530:	50                   	push   %eax
+  801531:	51                   	push   %ecx
+  801532:	ff 75 e4             	push   -0x1c(%ebp)
+  801535:	51                   	push   %ecx
+  801536:	6a 00                	push   $0x0
+  801538:	e8 61 2b 00 00       	call   80409e <page_map>
+  80153d:	83 c4 20             	add    $0x20,%esp
+  801540:	85 c0                	test   %eax,%eax
+  801542:	0f 88 e4 00 00 00    	js     80162c <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  801548:	83 ec 0c             	sub    $0xc,%esp
+  80154b:	57                   	push   %edi
+  80154c:	53                   	push   %ebx
+  80154d:	6a 00                	push   $0x0
+  80154f:	53                   	push   %ebx
+  801550:	6a 00                	push   $0x0
+  801552:	e8 47 2b 00 00       	call   80409e <page_map>
+  801557:	83 c4 20             	add    $0x20,%esp
+  80155a:	85 c0                	test   %eax,%eax
+  80155c:	0f 88 dc 00 00 00    	js     80163e <fork+0x2d0>
+			++pn;
+  801562:	83 c6 01             	add    $0x1,%esi
+			continue;
+  801565:	e9 c8 fe ff ff       	jmp    801432 <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  80156a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80156d:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801574:	c1 e1 0c             	shl    $0xc,%ecx
+  801577:	83 ec 0c             	sub    $0xc,%esp
+  80157a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80157f:	50                   	push   %eax
+  801580:	51                   	push   %ecx
+  801581:	ff 75 e4             	push   -0x1c(%ebp)
+  801584:	51                   	push   %ecx
+  801585:	6a 00                	push   $0x0
+  801587:	e8 12 2b 00 00       	call   80409e <page_map>
+  80158c:	83 c4 20             	add    $0x20,%esp
+  80158f:	85 c0                	test   %eax,%eax
+  801591:	79 cf                	jns    801562 <fork+0x1f4>
+			panic("page_map %d", r);
+  801593:	50                   	push   %eax
+  801594:	68 26 57 80 00       	push   $0x805726
+  801599:	6a 4d                	push   $0x4d
+  80159b:	68 0b 57 80 00       	push   $0x80570b
+  8015a0:	e8 c8 36 00 00       	call   804c6d <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  8015a5:	83 ec 0c             	sub    $0xc,%esp
+  8015a8:	68 00 10 00 00       	push   $0x1000
+  8015ad:	e8 de 30 00 00       	call   804690 <malloc>
+  8015b2:	89 c7                	mov    %eax,%edi
+  8015b4:	83 c4 10             	add    $0x10,%esp
+  8015b7:	85 c0                	test   %eax,%eax
+  8015b9:	74 4b                	je     801606 <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  8015bb:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8015be:	c1 e3 0c             	shl    $0xc,%ebx
+  8015c1:	83 ec 04             	sub    $0x4,%esp
+  8015c4:	68 00 10 00 00       	push   $0x1000
+  8015c9:	53                   	push   %ebx
+  8015ca:	50                   	push   %eax
+  8015cb:	e8 ac f3 ff ff       	call   80097c <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  8015d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015d3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015da:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015df:	89 04 24             	mov    %eax,(%esp)
+  8015e2:	53                   	push   %ebx
+  8015e3:	ff 75 e4             	push   -0x1c(%ebp)
+  8015e6:	57                   	push   %edi
+  8015e7:	6a 00                	push   $0x0
+  8015e9:	e8 b0 2a 00 00       	call   80409e <page_map>
+  8015ee:	83 c4 20             	add    $0x20,%esp
+  8015f1:	85 c0                	test   %eax,%eax
+  8015f3:	78 25                	js     80161a <fork+0x2ac>
+		free(temp);
+  8015f5:	83 ec 0c             	sub    $0xc,%esp
+  8015f8:	57                   	push   %edi
+  8015f9:	e8 90 2e 00 00       	call   80448e <free>
+  8015fe:	83 c4 10             	add    $0x10,%esp
+  801601:	e9 5c ff ff ff       	jmp    801562 <fork+0x1f4>
+			panic("malloc failed");
+  801606:	83 ec 04             	sub    $0x4,%esp
+  801609:	68 32 57 80 00       	push   $0x805732
+  80160e:	6a 56                	push   $0x56
+  801610:	68 0b 57 80 00       	push   $0x80570b
+  801615:	e8 53 36 00 00       	call   804c6d <_panic>
+			panic("page_map: %e", r);
+  80161a:	50                   	push   %eax
+  80161b:	68 40 57 80 00       	push   $0x805740
+  801620:	6a 59                	push   $0x59
+  801622:	68 0b 57 80 00       	push   $0x80570b
+  801627:	e8 41 36 00 00       	call   804c6d <_panic>
+			panic("page_map %d", r);
+  80162c:	50                   	push   %eax
+  80162d:	68 26 57 80 00       	push   $0x805726
+  801632:	6a 65                	push   $0x65
+  801634:	68 0b 57 80 00       	push   $0x80570b
+  801639:	e8 2f 36 00 00       	call   804c6d <_panic>
+			panic("page_map %d", r);
+  80163e:	50                   	push   %eax
+  80163f:	68 26 57 80 00       	push   $0x805726
+  801644:	6a 78                	push   $0x78
+  801646:	68 0b 57 80 00       	push   $0x80570b
+  80164b:	e8 1d 36 00 00       	call   804c6d <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  801650:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801653:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80165a:	c1 e1 0c             	shl    $0xc,%ecx
+  80165d:	83 ec 0c             	sub    $0xc,%esp
+  801660:	25 07 0e 00 00       	and    $0xe07,%eax
+  801665:	50                   	push   %eax
+  801666:	51                   	push   %ecx
+  801667:	ff 75 e4             	push   -0x1c(%ebp)
+  80166a:	51                   	push   %ecx
+  80166b:	6a 00                	push   $0x0
+  80166d:	e8 2c 2a 00 00       	call   80409e <page_map>
+  801672:	83 c4 20             	add    $0x20,%esp
+  801675:	85 c0                	test   %eax,%eax
+  801677:	0f 89 e5 fe ff ff    	jns    801562 <fork+0x1f4>
+			panic("page_map %d", r);
+  80167d:	50                   	push   %eax
+  80167e:	68 26 57 80 00       	push   $0x805726
+  801683:	6a 7f                	push   $0x7f
+  801685:	68 0b 57 80 00       	push   $0x80570b
+  80168a:	e8 de 35 00 00       	call   804c6d <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  80168f:	83 c7 01             	add    $0x1,%edi
+  801692:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801695:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  801698:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  80169b:	39 f7                	cmp    %esi,%edi
+  80169d:	74 1c                	je     8016bb <fork+0x34d>
+  80169f:	89 d8                	mov    %ebx,%eax
+  8016a1:	e8 c5 fb ff ff       	call   80126b <dupable>
+  8016a6:	84 c0                	test   %al,%al
+  8016a8:	74 7c                	je     801726 <fork+0x3b8>
+  8016aa:	89 d8                	mov    %ebx,%eax
+  8016ac:	e8 71 fb ff ff       	call   801222 <dupperm>
+  8016b1:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  8016b4:	74 d9                	je     80168f <fork+0x321>
+  8016b6:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8016b9:	eb 06                	jmp    8016c1 <fork+0x353>
+  8016bb:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8016be:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  8016c1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016c4:	c1 e0 0c             	shl    $0xc,%eax
+  8016c7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8016ca:	83 ec 08             	sub    $0x8,%esp
+  8016cd:	ff 75 dc             	push   -0x24(%ebp)
+  8016d0:	57                   	push   %edi
+  8016d1:	50                   	push   %eax
+  8016d2:	ff 75 e4             	push   -0x1c(%ebp)
+  8016d5:	50                   	push   %eax
+  8016d6:	6a 00                	push   $0x0
+  8016d8:	e8 b8 2b 00 00       	call   804295 <page_map_range>
+  8016dd:	83 c4 20             	add    $0x20,%esp
+  8016e0:	85 c0                	test   %eax,%eax
+  8016e2:	78 47                	js     80172b <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  8016e4:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  8016eb:	0f 84 41 fd ff ff    	je     801432 <fork+0xc4>
+  8016f1:	83 ec 08             	sub    $0x8,%esp
+  8016f4:	ff 75 dc             	push   -0x24(%ebp)
+  8016f7:	57                   	push   %edi
+  8016f8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016fb:	50                   	push   %eax
+  8016fc:	6a 00                	push   $0x0
+  8016fe:	50                   	push   %eax
+  8016ff:	6a 00                	push   $0x0
+  801701:	e8 8f 2b 00 00       	call   804295 <page_map_range>
+  801706:	83 c4 20             	add    $0x20,%esp
+  801709:	85 c0                	test   %eax,%eax
+  80170b:	0f 89 21 fd ff ff    	jns    801432 <fork+0xc4>
+		panic("page_map_range %e", r);
+  801711:	50                   	push   %eax
+  801712:	68 4d 57 80 00       	push   $0x80574d
+  801717:	68 a2 00 00 00       	push   $0xa2
+  80171c:	68 0b 57 80 00       	push   $0x80570b
+  801721:	e8 47 35 00 00       	call   804c6d <_panic>
+  801726:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801729:	eb 96                	jmp    8016c1 <fork+0x353>
+		panic("page_map_range %e", r);
+  80172b:	50                   	push   %eax
+  80172c:	68 4d 57 80 00       	push   $0x80574d
+  801731:	68 a0 00 00 00       	push   $0xa0
+  801736:	68 0b 57 80 00       	push   $0x80570b
+  80173b:	e8 2d 35 00 00       	call   804c6d <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  801740:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  801743:	6a 01                	push   $0x1
+  801745:	6a 07                	push   $0x7
+  801747:	68 00 f0 bf ee       	push   $0xeebff000
+  80174c:	53                   	push   %ebx
+  80174d:	e8 eb 22 00 00       	call   803a3d <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801752:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801757:	8b 40 74             	mov    0x74(%eax),%eax
+  80175a:	83 c4 08             	add    $0x8,%esp
+  80175d:	50                   	push   %eax
+  80175e:	53                   	push   %ebx
+  80175f:	e8 89 f8 ff ff       	call   800fed <sys_env_set_pgfault_upcall>
+  801764:	83 c4 10             	add    $0x10,%esp
+  801767:	e9 41 fc ff ff       	jmp    8013ad <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80176c:	e8 d8 f4 ff ff       	call   800c49 <sys_getenvid>
+  801771:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801776:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801779:	c1 e0 06             	shl    $0x6,%eax
+  80177c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801781:	a3 18 e9 80 00       	mov    %eax,0x80e918
+		return 0;
+  801786:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80178d:	e9 40 fc ff ff       	jmp    8013d2 <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  801792:	50                   	push   %eax
+  801793:	68 5f 57 80 00       	push   $0x80575f
+  801798:	68 27 01 00 00       	push   $0x127
+  80179d:	68 0b 57 80 00       	push   $0x80570b
+  8017a2:	e8 c6 34 00 00       	call   804c6d <_panic>
+		panic("sys_env_set_status: %d", r);
+  8017a7:	50                   	push   %eax
+  8017a8:	68 78 57 80 00       	push   $0x805778
+  8017ad:	68 2b 01 00 00       	push   $0x12b
+  8017b2:	68 0b 57 80 00       	push   $0x80570b
+  8017b7:	e8 b1 34 00 00       	call   804c6d <_panic>
+
+008017bc <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8017bc:	55                   	push   %ebp
+  8017bd:	89 e5                	mov    %esp,%ebp
+  8017bf:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8017c2:	68 8f 57 80 00       	push   $0x80578f
+  8017c7:	68 35 01 00 00       	push   $0x135
+  8017cc:	68 0b 57 80 00       	push   $0x80570b
+  8017d1:	e8 97 34 00 00       	call   804c6d <_panic>
+
+008017d6 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8017d6:	55                   	push   %ebp
+  8017d7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017dc:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017e1:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8017e4:	5d                   	pop    %ebp
+  8017e5:	c3                   	ret
+
+008017e6 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8017e6:	55                   	push   %ebp
+  8017e7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ec:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017f1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017f6:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8017fb:	5d                   	pop    %ebp
+  8017fc:	c3                   	ret
+
+008017fd <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017fd:	55                   	push   %ebp
+  8017fe:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801800:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801805:	a8 01                	test   $0x1,%al
+  801807:	74 3c                	je     801845 <fd_alloc+0x48>
+  801809:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80180e:	89 c2                	mov    %eax,%edx
+  801810:	c1 ea 0c             	shr    $0xc,%edx
+  801813:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80181a:	89 c1                	mov    %eax,%ecx
+  80181c:	05 00 10 00 00       	add    $0x1000,%eax
+  801821:	f6 c2 01             	test   $0x1,%dl
+  801824:	74 13                	je     801839 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801826:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80182b:	75 e1                	jne    80180e <fd_alloc+0x11>
+  80182d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801832:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801837:	eb 05                	jmp    80183e <fd_alloc+0x41>
+			return 0;
+  801839:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  80183e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801841:	89 0a                	mov    %ecx,(%edx)
+}
+  801843:	5d                   	pop    %ebp
+  801844:	c3                   	ret
+  801845:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  80184a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80184f:	eb ed                	jmp    80183e <fd_alloc+0x41>
+
+00801851 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801851:	55                   	push   %ebp
+  801852:	89 e5                	mov    %esp,%ebp
+  801854:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801857:	83 f8 1f             	cmp    $0x1f,%eax
+  80185a:	77 30                	ja     80188c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80185c:	c1 e0 0c             	shl    $0xc,%eax
+  80185f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801864:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80186a:	f6 c2 01             	test   $0x1,%dl
+  80186d:	74 24                	je     801893 <fd_lookup+0x42>
+  80186f:	89 c2                	mov    %eax,%edx
+  801871:	c1 ea 0c             	shr    $0xc,%edx
+  801874:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80187b:	f6 c2 01             	test   $0x1,%dl
+  80187e:	74 1a                	je     80189a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801880:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801883:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801885:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80188a:	5d                   	pop    %ebp
+  80188b:	c3                   	ret
+		return -E_INVAL;
+  80188c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801891:	eb f7                	jmp    80188a <fd_lookup+0x39>
+		return -E_INVAL;
+  801893:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801898:	eb f0                	jmp    80188a <fd_lookup+0x39>
+  80189a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80189f:	eb e9                	jmp    80188a <fd_lookup+0x39>
+
+008018a1 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8018a1:	55                   	push   %ebp
+  8018a2:	89 e5                	mov    %esp,%ebp
+  8018a4:	53                   	push   %ebx
+  8018a5:	83 ec 04             	sub    $0x4,%esp
+  8018a8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8018ab:	b8 24 58 80 00       	mov    $0x805824,%eax
+  8018b0:	8b 18                	mov    (%eax),%ebx
+  8018b2:	85 db                	test   %ebx,%ebx
+  8018b4:	74 0e                	je     8018c4 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  8018b6:	83 c0 04             	add    $0x4,%eax
+  8018b9:	39 13                	cmp    %edx,(%ebx)
+  8018bb:	75 f3                	jne    8018b0 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  8018bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c2:	eb 1f                	jmp    8018e3 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018c4:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8018c9:	8b 40 48             	mov    0x48(%eax),%eax
+  8018cc:	83 ec 04             	sub    $0x4,%esp
+  8018cf:	52                   	push   %edx
+  8018d0:	50                   	push   %eax
+  8018d1:	68 a8 57 80 00       	push   $0x8057a8
+  8018d6:	e8 d2 e8 ff ff       	call   8001ad <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018db:	83 c4 10             	add    $0x10,%esp
+  8018de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8018e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018e6:	89 1a                	mov    %ebx,(%edx)
+}
+  8018e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018eb:	c9                   	leave
+  8018ec:	c3                   	ret
+
+008018ed <fd_close>:
+{
+  8018ed:	55                   	push   %ebp
+  8018ee:	89 e5                	mov    %esp,%ebp
+  8018f0:	57                   	push   %edi
+  8018f1:	56                   	push   %esi
+  8018f2:	53                   	push   %ebx
+  8018f3:	83 ec 24             	sub    $0x24,%esp
+  8018f6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018f9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018fc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018ff:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801900:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801906:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801909:	50                   	push   %eax
+  80190a:	e8 42 ff ff ff       	call   801851 <fd_lookup>
+  80190f:	89 c3                	mov    %eax,%ebx
+  801911:	83 c4 10             	add    $0x10,%esp
+  801914:	85 c0                	test   %eax,%eax
+  801916:	78 05                	js     80191d <fd_close+0x30>
+	    || fd != fd2)
+  801918:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80191b:	74 16                	je     801933 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80191d:	89 f8                	mov    %edi,%eax
+  80191f:	84 c0                	test   %al,%al
+  801921:	b8 00 00 00 00       	mov    $0x0,%eax
+  801926:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801929:	89 d8                	mov    %ebx,%eax
+  80192b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80192e:	5b                   	pop    %ebx
+  80192f:	5e                   	pop    %esi
+  801930:	5f                   	pop    %edi
+  801931:	5d                   	pop    %ebp
+  801932:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801933:	83 ec 08             	sub    $0x8,%esp
+  801936:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801939:	50                   	push   %eax
+  80193a:	ff 36                	push   (%esi)
+  80193c:	e8 60 ff ff ff       	call   8018a1 <dev_lookup>
+  801941:	89 c3                	mov    %eax,%ebx
+  801943:	83 c4 10             	add    $0x10,%esp
+  801946:	85 c0                	test   %eax,%eax
+  801948:	78 1a                	js     801964 <fd_close+0x77>
+		if (dev->dev_close)
+  80194a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80194d:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801950:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801955:	85 c0                	test   %eax,%eax
+  801957:	74 0b                	je     801964 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801959:	83 ec 0c             	sub    $0xc,%esp
+  80195c:	56                   	push   %esi
+  80195d:	ff d0                	call   *%eax
+  80195f:	89 c3                	mov    %eax,%ebx
+  801961:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801964:	83 ec 08             	sub    $0x8,%esp
+  801967:	56                   	push   %esi
+  801968:	6a 00                	push   $0x0
+  80196a:	e8 9d f3 ff ff       	call   800d0c <sys_page_unmap>
+	return r;
+  80196f:	83 c4 10             	add    $0x10,%esp
+  801972:	eb b5                	jmp    801929 <fd_close+0x3c>
+
+00801974 <close>:
+
+int
+close(int fdnum)
+{
+  801974:	55                   	push   %ebp
+  801975:	89 e5                	mov    %esp,%ebp
+  801977:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80197a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80197d:	50                   	push   %eax
+  80197e:	ff 75 08             	push   0x8(%ebp)
+  801981:	e8 cb fe ff ff       	call   801851 <fd_lookup>
+  801986:	83 c4 10             	add    $0x10,%esp
+  801989:	85 c0                	test   %eax,%eax
+  80198b:	79 02                	jns    80198f <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80198d:	c9                   	leave
+  80198e:	c3                   	ret
+		return fd_close(fd, 1);
+  80198f:	83 ec 08             	sub    $0x8,%esp
+  801992:	6a 01                	push   $0x1
+  801994:	ff 75 f4             	push   -0xc(%ebp)
+  801997:	e8 51 ff ff ff       	call   8018ed <fd_close>
+  80199c:	83 c4 10             	add    $0x10,%esp
+  80199f:	eb ec                	jmp    80198d <close+0x19>
+
+008019a1 <close_all>:
+
+void
+close_all(void)
+{
+  8019a1:	55                   	push   %ebp
+  8019a2:	89 e5                	mov    %esp,%ebp
+  8019a4:	53                   	push   %ebx
+  8019a5:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8019a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8019ad:	83 ec 0c             	sub    $0xc,%esp
+  8019b0:	53                   	push   %ebx
+  8019b1:	e8 be ff ff ff       	call   801974 <close>
+	for (i = 0; i < MAXFD; i++)
+  8019b6:	83 c3 01             	add    $0x1,%ebx
+  8019b9:	83 c4 10             	add    $0x10,%esp
+  8019bc:	83 fb 20             	cmp    $0x20,%ebx
+  8019bf:	75 ec                	jne    8019ad <close_all+0xc>
+}
+  8019c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019c4:	c9                   	leave
+  8019c5:	c3                   	ret
+
+008019c6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019c6:	55                   	push   %ebp
+  8019c7:	89 e5                	mov    %esp,%ebp
+  8019c9:	57                   	push   %edi
+  8019ca:	56                   	push   %esi
+  8019cb:	53                   	push   %ebx
+  8019cc:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019cf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019d2:	50                   	push   %eax
+  8019d3:	ff 75 08             	push   0x8(%ebp)
+  8019d6:	e8 76 fe ff ff       	call   801851 <fd_lookup>
+  8019db:	89 c3                	mov    %eax,%ebx
+  8019dd:	83 c4 10             	add    $0x10,%esp
+  8019e0:	85 c0                	test   %eax,%eax
+  8019e2:	78 7f                	js     801a63 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8019e4:	83 ec 0c             	sub    $0xc,%esp
+  8019e7:	ff 75 0c             	push   0xc(%ebp)
+  8019ea:	e8 85 ff ff ff       	call   801974 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8019ef:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019f2:	c1 e6 0c             	shl    $0xc,%esi
+  8019f5:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8019fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019fe:	89 3c 24             	mov    %edi,(%esp)
+  801a01:	e8 e0 fd ff ff       	call   8017e6 <fd2data>
+  801a06:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801a08:	89 34 24             	mov    %esi,(%esp)
+  801a0b:	e8 d6 fd ff ff       	call   8017e6 <fd2data>
+  801a10:	83 c4 10             	add    $0x10,%esp
+  801a13:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a16:	89 d8                	mov    %ebx,%eax
+  801a18:	c1 e8 16             	shr    $0x16,%eax
+  801a1b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a22:	a8 01                	test   $0x1,%al
+  801a24:	74 11                	je     801a37 <dup+0x71>
+  801a26:	89 d8                	mov    %ebx,%eax
+  801a28:	c1 e8 0c             	shr    $0xc,%eax
+  801a2b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a32:	f6 c2 01             	test   $0x1,%dl
+  801a35:	75 36                	jne    801a6d <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a37:	89 f8                	mov    %edi,%eax
+  801a39:	c1 e8 0c             	shr    $0xc,%eax
+  801a3c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a43:	83 ec 0c             	sub    $0xc,%esp
+  801a46:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a4b:	50                   	push   %eax
+  801a4c:	56                   	push   %esi
+  801a4d:	6a 00                	push   $0x0
+  801a4f:	57                   	push   %edi
+  801a50:	6a 00                	push   $0x0
+  801a52:	e8 73 f2 ff ff       	call   800cca <sys_page_map>
+  801a57:	89 c3                	mov    %eax,%ebx
+  801a59:	83 c4 20             	add    $0x20,%esp
+  801a5c:	85 c0                	test   %eax,%eax
+  801a5e:	78 33                	js     801a93 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a60:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a63:	89 d8                	mov    %ebx,%eax
+  801a65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a68:	5b                   	pop    %ebx
+  801a69:	5e                   	pop    %esi
+  801a6a:	5f                   	pop    %edi
+  801a6b:	5d                   	pop    %ebp
+  801a6c:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a6d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a74:	83 ec 0c             	sub    $0xc,%esp
+  801a77:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a7c:	50                   	push   %eax
+  801a7d:	ff 75 d4             	push   -0x2c(%ebp)
+  801a80:	6a 00                	push   $0x0
+  801a82:	53                   	push   %ebx
+  801a83:	6a 00                	push   $0x0
+  801a85:	e8 40 f2 ff ff       	call   800cca <sys_page_map>
+  801a8a:	89 c3                	mov    %eax,%ebx
+  801a8c:	83 c4 20             	add    $0x20,%esp
+  801a8f:	85 c0                	test   %eax,%eax
+  801a91:	79 a4                	jns    801a37 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a93:	83 ec 08             	sub    $0x8,%esp
+  801a96:	56                   	push   %esi
+  801a97:	6a 00                	push   $0x0
+  801a99:	e8 6e f2 ff ff       	call   800d0c <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a9e:	83 c4 08             	add    $0x8,%esp
+  801aa1:	ff 75 d4             	push   -0x2c(%ebp)
+  801aa4:	6a 00                	push   $0x0
+  801aa6:	e8 61 f2 ff ff       	call   800d0c <sys_page_unmap>
+	return r;
+  801aab:	83 c4 10             	add    $0x10,%esp
+  801aae:	eb b3                	jmp    801a63 <dup+0x9d>
+
+00801ab0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801ab0:	55                   	push   %ebp
+  801ab1:	89 e5                	mov    %esp,%ebp
+  801ab3:	56                   	push   %esi
+  801ab4:	53                   	push   %ebx
+  801ab5:	83 ec 18             	sub    $0x18,%esp
+  801ab8:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801abb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801abe:	50                   	push   %eax
+  801abf:	56                   	push   %esi
+  801ac0:	e8 8c fd ff ff       	call   801851 <fd_lookup>
+  801ac5:	83 c4 10             	add    $0x10,%esp
+  801ac8:	85 c0                	test   %eax,%eax
+  801aca:	78 3c                	js     801b08 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801acc:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801acf:	83 ec 08             	sub    $0x8,%esp
+  801ad2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad5:	50                   	push   %eax
+  801ad6:	ff 33                	push   (%ebx)
+  801ad8:	e8 c4 fd ff ff       	call   8018a1 <dev_lookup>
+  801add:	83 c4 10             	add    $0x10,%esp
+  801ae0:	85 c0                	test   %eax,%eax
+  801ae2:	78 24                	js     801b08 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ae4:	8b 43 08             	mov    0x8(%ebx),%eax
+  801ae7:	83 e0 03             	and    $0x3,%eax
+  801aea:	83 f8 01             	cmp    $0x1,%eax
+  801aed:	74 20                	je     801b0f <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801aef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801af2:	8b 40 08             	mov    0x8(%eax),%eax
+  801af5:	85 c0                	test   %eax,%eax
+  801af7:	74 37                	je     801b30 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801af9:	83 ec 04             	sub    $0x4,%esp
+  801afc:	ff 75 10             	push   0x10(%ebp)
+  801aff:	ff 75 0c             	push   0xc(%ebp)
+  801b02:	53                   	push   %ebx
+  801b03:	ff d0                	call   *%eax
+  801b05:	83 c4 10             	add    $0x10,%esp
+}
+  801b08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b0b:	5b                   	pop    %ebx
+  801b0c:	5e                   	pop    %esi
+  801b0d:	5d                   	pop    %ebp
+  801b0e:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b0f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801b14:	8b 40 48             	mov    0x48(%eax),%eax
+  801b17:	83 ec 04             	sub    $0x4,%esp
+  801b1a:	56                   	push   %esi
+  801b1b:	50                   	push   %eax
+  801b1c:	68 e9 57 80 00       	push   $0x8057e9
+  801b21:	e8 87 e6 ff ff       	call   8001ad <cprintf>
+		return -E_INVAL;
+  801b26:	83 c4 10             	add    $0x10,%esp
+  801b29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b2e:	eb d8                	jmp    801b08 <read+0x58>
+		return -E_NOT_SUPP;
+  801b30:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b35:	eb d1                	jmp    801b08 <read+0x58>
+
+00801b37 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b37:	55                   	push   %ebp
+  801b38:	89 e5                	mov    %esp,%ebp
+  801b3a:	57                   	push   %edi
+  801b3b:	56                   	push   %esi
+  801b3c:	53                   	push   %ebx
+  801b3d:	83 ec 0c             	sub    $0xc,%esp
+  801b40:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b43:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b46:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b4b:	eb 02                	jmp    801b4f <readn+0x18>
+  801b4d:	01 c3                	add    %eax,%ebx
+  801b4f:	39 f3                	cmp    %esi,%ebx
+  801b51:	73 21                	jae    801b74 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b53:	83 ec 04             	sub    $0x4,%esp
+  801b56:	89 f0                	mov    %esi,%eax
+  801b58:	29 d8                	sub    %ebx,%eax
+  801b5a:	50                   	push   %eax
+  801b5b:	89 d8                	mov    %ebx,%eax
+  801b5d:	03 45 0c             	add    0xc(%ebp),%eax
+  801b60:	50                   	push   %eax
+  801b61:	57                   	push   %edi
+  801b62:	e8 49 ff ff ff       	call   801ab0 <read>
+		if (m < 0)
+  801b67:	83 c4 10             	add    $0x10,%esp
+  801b6a:	85 c0                	test   %eax,%eax
+  801b6c:	78 04                	js     801b72 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b6e:	75 dd                	jne    801b4d <readn+0x16>
+  801b70:	eb 02                	jmp    801b74 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b72:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801b74:	89 d8                	mov    %ebx,%eax
+  801b76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b79:	5b                   	pop    %ebx
+  801b7a:	5e                   	pop    %esi
+  801b7b:	5f                   	pop    %edi
+  801b7c:	5d                   	pop    %ebp
+  801b7d:	c3                   	ret
+
+00801b7e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b7e:	55                   	push   %ebp
+  801b7f:	89 e5                	mov    %esp,%ebp
+  801b81:	56                   	push   %esi
+  801b82:	53                   	push   %ebx
+  801b83:	83 ec 18             	sub    $0x18,%esp
+  801b86:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b89:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b8c:	50                   	push   %eax
+  801b8d:	53                   	push   %ebx
+  801b8e:	e8 be fc ff ff       	call   801851 <fd_lookup>
+  801b93:	83 c4 10             	add    $0x10,%esp
+  801b96:	85 c0                	test   %eax,%eax
+  801b98:	78 37                	js     801bd1 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b9a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b9d:	83 ec 08             	sub    $0x8,%esp
+  801ba0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ba3:	50                   	push   %eax
+  801ba4:	ff 36                	push   (%esi)
+  801ba6:	e8 f6 fc ff ff       	call   8018a1 <dev_lookup>
+  801bab:	83 c4 10             	add    $0x10,%esp
+  801bae:	85 c0                	test   %eax,%eax
+  801bb0:	78 1f                	js     801bd1 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bb2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bb6:	74 20                	je     801bd8 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801bb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bbb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bbe:	85 c0                	test   %eax,%eax
+  801bc0:	74 37                	je     801bf9 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801bc2:	83 ec 04             	sub    $0x4,%esp
+  801bc5:	ff 75 10             	push   0x10(%ebp)
+  801bc8:	ff 75 0c             	push   0xc(%ebp)
+  801bcb:	56                   	push   %esi
+  801bcc:	ff d0                	call   *%eax
+  801bce:	83 c4 10             	add    $0x10,%esp
+}
+  801bd1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bd4:	5b                   	pop    %ebx
+  801bd5:	5e                   	pop    %esi
+  801bd6:	5d                   	pop    %ebp
+  801bd7:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bd8:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801bdd:	8b 40 48             	mov    0x48(%eax),%eax
+  801be0:	83 ec 04             	sub    $0x4,%esp
+  801be3:	53                   	push   %ebx
+  801be4:	50                   	push   %eax
+  801be5:	68 05 58 80 00       	push   $0x805805
+  801bea:	e8 be e5 ff ff       	call   8001ad <cprintf>
+		return -E_INVAL;
+  801bef:	83 c4 10             	add    $0x10,%esp
+  801bf2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bf7:	eb d8                	jmp    801bd1 <write+0x53>
+		return -E_NOT_SUPP;
+  801bf9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bfe:	eb d1                	jmp    801bd1 <write+0x53>
+
+00801c00 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c00:	55                   	push   %ebp
+  801c01:	89 e5                	mov    %esp,%ebp
+  801c03:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c09:	50                   	push   %eax
+  801c0a:	ff 75 08             	push   0x8(%ebp)
+  801c0d:	e8 3f fc ff ff       	call   801851 <fd_lookup>
+  801c12:	83 c4 10             	add    $0x10,%esp
+  801c15:	85 c0                	test   %eax,%eax
+  801c17:	78 0e                	js     801c27 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c19:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c1f:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c22:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c27:	c9                   	leave
+  801c28:	c3                   	ret
+
+00801c29 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c29:	55                   	push   %ebp
+  801c2a:	89 e5                	mov    %esp,%ebp
+  801c2c:	56                   	push   %esi
+  801c2d:	53                   	push   %ebx
+  801c2e:	83 ec 18             	sub    $0x18,%esp
+  801c31:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c34:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c37:	50                   	push   %eax
+  801c38:	53                   	push   %ebx
+  801c39:	e8 13 fc ff ff       	call   801851 <fd_lookup>
+  801c3e:	83 c4 10             	add    $0x10,%esp
+  801c41:	85 c0                	test   %eax,%eax
+  801c43:	78 34                	js     801c79 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c45:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c48:	83 ec 08             	sub    $0x8,%esp
+  801c4b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c4e:	50                   	push   %eax
+  801c4f:	ff 36                	push   (%esi)
+  801c51:	e8 4b fc ff ff       	call   8018a1 <dev_lookup>
+  801c56:	83 c4 10             	add    $0x10,%esp
+  801c59:	85 c0                	test   %eax,%eax
+  801c5b:	78 1c                	js     801c79 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c5d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c61:	74 1d                	je     801c80 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801c63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c66:	8b 40 18             	mov    0x18(%eax),%eax
+  801c69:	85 c0                	test   %eax,%eax
+  801c6b:	74 34                	je     801ca1 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801c6d:	83 ec 08             	sub    $0x8,%esp
+  801c70:	ff 75 0c             	push   0xc(%ebp)
+  801c73:	56                   	push   %esi
+  801c74:	ff d0                	call   *%eax
+  801c76:	83 c4 10             	add    $0x10,%esp
+}
+  801c79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c7c:	5b                   	pop    %ebx
+  801c7d:	5e                   	pop    %esi
+  801c7e:	5d                   	pop    %ebp
+  801c7f:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801c80:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801c85:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c88:	83 ec 04             	sub    $0x4,%esp
+  801c8b:	53                   	push   %ebx
+  801c8c:	50                   	push   %eax
+  801c8d:	68 c8 57 80 00       	push   $0x8057c8
+  801c92:	e8 16 e5 ff ff       	call   8001ad <cprintf>
+		return -E_INVAL;
+  801c97:	83 c4 10             	add    $0x10,%esp
+  801c9a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c9f:	eb d8                	jmp    801c79 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801ca1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ca6:	eb d1                	jmp    801c79 <ftruncate+0x50>
+
+00801ca8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ca8:	55                   	push   %ebp
+  801ca9:	89 e5                	mov    %esp,%ebp
+  801cab:	56                   	push   %esi
+  801cac:	53                   	push   %ebx
+  801cad:	83 ec 18             	sub    $0x18,%esp
+  801cb0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cb3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cb6:	50                   	push   %eax
+  801cb7:	ff 75 08             	push   0x8(%ebp)
+  801cba:	e8 92 fb ff ff       	call   801851 <fd_lookup>
+  801cbf:	83 c4 10             	add    $0x10,%esp
+  801cc2:	85 c0                	test   %eax,%eax
+  801cc4:	78 49                	js     801d0f <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cc6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cc9:	83 ec 08             	sub    $0x8,%esp
+  801ccc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ccf:	50                   	push   %eax
+  801cd0:	ff 36                	push   (%esi)
+  801cd2:	e8 ca fb ff ff       	call   8018a1 <dev_lookup>
+  801cd7:	83 c4 10             	add    $0x10,%esp
+  801cda:	85 c0                	test   %eax,%eax
+  801cdc:	78 31                	js     801d0f <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801cde:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ce1:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801ce5:	74 2f                	je     801d16 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801ce7:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801cea:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801cf1:	00 00 00 
+	stat->st_isdir = 0;
+  801cf4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801cfb:	00 00 00 
+	stat->st_dev = dev;
+  801cfe:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d04:	83 ec 08             	sub    $0x8,%esp
+  801d07:	53                   	push   %ebx
+  801d08:	56                   	push   %esi
+  801d09:	ff 50 14             	call   *0x14(%eax)
+  801d0c:	83 c4 10             	add    $0x10,%esp
+}
+  801d0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d12:	5b                   	pop    %ebx
+  801d13:	5e                   	pop    %esi
+  801d14:	5d                   	pop    %ebp
+  801d15:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d16:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d1b:	eb f2                	jmp    801d0f <fstat+0x67>
+
+00801d1d <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d1d:	55                   	push   %ebp
+  801d1e:	89 e5                	mov    %esp,%ebp
+  801d20:	56                   	push   %esi
+  801d21:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801d22:	83 ec 08             	sub    $0x8,%esp
+  801d25:	6a 00                	push   $0x0
+  801d27:	ff 75 08             	push   0x8(%ebp)
+  801d2a:	e8 bc 02 00 00       	call   801feb <open>
+  801d2f:	89 c3                	mov    %eax,%ebx
+  801d31:	83 c4 10             	add    $0x10,%esp
+  801d34:	85 c0                	test   %eax,%eax
+  801d36:	78 1b                	js     801d53 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801d38:	83 ec 08             	sub    $0x8,%esp
+  801d3b:	ff 75 0c             	push   0xc(%ebp)
+  801d3e:	50                   	push   %eax
+  801d3f:	e8 64 ff ff ff       	call   801ca8 <fstat>
+  801d44:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801d46:	89 1c 24             	mov    %ebx,(%esp)
+  801d49:	e8 26 fc ff ff       	call   801974 <close>
+	return r;
+  801d4e:	83 c4 10             	add    $0x10,%esp
+  801d51:	89 f3                	mov    %esi,%ebx
+}
+  801d53:	89 d8                	mov    %ebx,%eax
+  801d55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d58:	5b                   	pop    %ebx
+  801d59:	5e                   	pop    %esi
+  801d5a:	5d                   	pop    %ebp
+  801d5b:	c3                   	ret
+
+00801d5c <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801d5c:	55                   	push   %ebp
+  801d5d:	89 e5                	mov    %esp,%ebp
+  801d5f:	57                   	push   %edi
+  801d60:	56                   	push   %esi
+  801d61:	53                   	push   %ebx
+  801d62:	83 ec 0c             	sub    $0xc,%esp
+  801d65:	89 c7                	mov    %eax,%edi
+  801d67:	89 d3                	mov    %edx,%ebx
+  801d69:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801d6b:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801d72:	74 2d                	je     801da1 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801d74:	6a 07                	push   $0x7
+  801d76:	68 00 f0 80 00       	push   $0x80f000
+  801d7b:	57                   	push   %edi
+  801d7c:	ff 35 00 70 80 00    	push   0x807000
+  801d82:	e8 94 31 00 00       	call   804f1b <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801d87:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801d8e:	6a 00                	push   $0x0
+  801d90:	56                   	push   %esi
+  801d91:	53                   	push   %ebx
+  801d92:	6a 00                	push   $0x0
+  801d94:	e8 34 30 00 00       	call   804dcd <ipc_recv_pages>
+}
+  801d99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d9c:	5b                   	pop    %ebx
+  801d9d:	5e                   	pop    %esi
+  801d9e:	5f                   	pop    %edi
+  801d9f:	5d                   	pop    %ebp
+  801da0:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801da1:	83 ec 0c             	sub    $0xc,%esp
+  801da4:	6a 01                	push   $0x1
+  801da6:	e8 65 32 00 00       	call   805010 <ipc_find_env>
+  801dab:	a3 00 70 80 00       	mov    %eax,0x807000
+  801db0:	83 c4 10             	add    $0x10,%esp
+  801db3:	eb bf                	jmp    801d74 <fsipc_pages+0x18>
+
+00801db5 <fsipc>:
+{
+  801db5:	55                   	push   %ebp
+  801db6:	89 e5                	mov    %esp,%ebp
+  801db8:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801dbb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801dc0:	e8 97 ff ff ff       	call   801d5c <fsipc_pages>
+}
+  801dc5:	c9                   	leave
+  801dc6:	c3                   	ret
+
+00801dc7 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801dc7:	55                   	push   %ebp
+  801dc8:	89 e5                	mov    %esp,%ebp
+  801dca:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801dcd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dd3:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  801dd8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ddb:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801de0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801de5:	b8 02 00 00 00       	mov    $0x2,%eax
+  801dea:	e8 c6 ff ff ff       	call   801db5 <fsipc>
+}
+  801def:	c9                   	leave
+  801df0:	c3                   	ret
+
+00801df1 <devfile_flush>:
+{
+  801df1:	55                   	push   %ebp
+  801df2:	89 e5                	mov    %esp,%ebp
+  801df4:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801df7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dfa:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dfd:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e02:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e07:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e0c:	e8 a4 ff ff ff       	call   801db5 <fsipc>
+}
+  801e11:	c9                   	leave
+  801e12:	c3                   	ret
+
+00801e13 <devfile_stat>:
+{
+  801e13:	55                   	push   %ebp
+  801e14:	89 e5                	mov    %esp,%ebp
+  801e16:	53                   	push   %ebx
+  801e17:	83 ec 04             	sub    $0x4,%esp
+  801e1a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e20:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e23:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e28:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e2d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e32:	e8 7e ff ff ff       	call   801db5 <fsipc>
+  801e37:	85 c0                	test   %eax,%eax
+  801e39:	78 2c                	js     801e67 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e3b:	83 ec 08             	sub    $0x8,%esp
+  801e3e:	68 00 f0 80 00       	push   $0x80f000
+  801e43:	53                   	push   %ebx
+  801e44:	e8 4b e9 ff ff       	call   800794 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801e49:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  801e4e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e54:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  801e59:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801e5f:	83 c4 10             	add    $0x10,%esp
+  801e62:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e6a:	c9                   	leave
+  801e6b:	c3                   	ret
+
+00801e6c <devfile_write>:
+{
+  801e6c:	55                   	push   %ebp
+  801e6d:	89 e5                	mov    %esp,%ebp
+  801e6f:	83 ec 0c             	sub    $0xc,%esp
+  801e72:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801e75:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801e7a:	39 d0                	cmp    %edx,%eax
+  801e7c:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e82:	8b 52 0c             	mov    0xc(%edx),%edx
+  801e85:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  801e8b:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801e90:	50                   	push   %eax
+  801e91:	ff 75 0c             	push   0xc(%ebp)
+  801e94:	68 08 f0 80 00       	push   $0x80f008
+  801e99:	e8 7c ea ff ff       	call   80091a <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801e9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea3:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ea8:	e8 08 ff ff ff       	call   801db5 <fsipc>
+}
+  801ead:	c9                   	leave
+  801eae:	c3                   	ret
+
+00801eaf <devfile_read>:
+{
+  801eaf:	55                   	push   %ebp
+  801eb0:	89 e5                	mov    %esp,%ebp
+  801eb2:	57                   	push   %edi
+  801eb3:	56                   	push   %esi
+  801eb4:	53                   	push   %ebx
+  801eb5:	83 ec 1c             	sub    $0x1c,%esp
+  801eb8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ebb:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801ebe:	89 fe                	mov    %edi,%esi
+  801ec0:	c1 ee 0c             	shr    $0xc,%esi
+  801ec3:	b8 20 00 00 00       	mov    $0x20,%eax
+  801ec8:	39 c6                	cmp    %eax,%esi
+  801eca:	0f 47 f0             	cmova  %eax,%esi
+  801ecd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ed0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ed5:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801ed8:	eb 14                	jmp    801eee <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801eda:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801ee1:	05 00 10 00 00       	add    $0x1000,%eax
+  801ee6:	f6 c6 06             	test   $0x6,%dh
+  801ee9:	75 42                	jne    801f2d <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801eeb:	83 c1 01             	add    $0x1,%ecx
+  801eee:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801ef1:	39 f1                	cmp    %esi,%ecx
+  801ef3:	0f 84 95 00 00 00    	je     801f8e <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801ef9:	89 c2                	mov    %eax,%edx
+  801efb:	c1 ea 16             	shr    $0x16,%edx
+  801efe:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801f05:	f6 c2 01             	test   $0x1,%dl
+  801f08:	74 23                	je     801f2d <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801f0a:	89 c2                	mov    %eax,%edx
+  801f0c:	c1 ea 0c             	shr    $0xc,%edx
+  801f0f:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801f16:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801f1c:	74 0f                	je     801f2d <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801f1e:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801f25:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801f2b:	75 ad                	jne    801eda <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801f2d:	85 c9                	test   %ecx,%ecx
+  801f2f:	74 11                	je     801f42 <devfile_read+0x93>
+  801f31:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801f38:	75 08                	jne    801f42 <devfile_read+0x93>
+  801f3a:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801f40:	74 50                	je     801f92 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f42:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801f45:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  801f4a:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801f50:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f55:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f5a:	e8 56 fe ff ff       	call   801db5 <fsipc>
+  801f5f:	89 c6                	mov    %eax,%esi
+  801f61:	85 c0                	test   %eax,%eax
+  801f63:	78 1f                	js     801f84 <devfile_read+0xd5>
+	assert(r <= n);
+  801f65:	39 c7                	cmp    %eax,%edi
+  801f67:	72 50                	jb     801fb9 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801f69:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f6e:	7f 62                	jg     801fd2 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801f70:	83 ec 04             	sub    $0x4,%esp
+  801f73:	50                   	push   %eax
+  801f74:	68 00 f0 80 00       	push   $0x80f000
+  801f79:	ff 75 0c             	push   0xc(%ebp)
+  801f7c:	e8 99 e9 ff ff       	call   80091a <memmove>
+	return r;
+  801f81:	83 c4 10             	add    $0x10,%esp
+}
+  801f84:	89 f0                	mov    %esi,%eax
+  801f86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f89:	5b                   	pop    %ebx
+  801f8a:	5e                   	pop    %esi
+  801f8b:	5f                   	pop    %edi
+  801f8c:	5d                   	pop    %ebp
+  801f8d:	c3                   	ret
+  801f8e:	89 f1                	mov    %esi,%ecx
+  801f90:	eb 9b                	jmp    801f2d <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801f92:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801f95:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801f9a:	89 c8                	mov    %ecx,%eax
+  801f9c:	c1 e0 0c             	shl    $0xc,%eax
+  801f9f:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801fa4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fa7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801fac:	e8 ab fd ff ff       	call   801d5c <fsipc_pages>
+  801fb1:	89 c6                	mov    %eax,%esi
+  801fb3:	85 c0                	test   %eax,%eax
+  801fb5:	78 8b                	js     801f42 <devfile_read+0x93>
+  801fb7:	eb cb                	jmp    801f84 <devfile_read+0xd5>
+	assert(r <= n);
+  801fb9:	68 34 58 80 00       	push   $0x805834
+  801fbe:	68 3b 58 80 00       	push   $0x80583b
+  801fc3:	68 a0 00 00 00       	push   $0xa0
+  801fc8:	68 50 58 80 00       	push   $0x805850
+  801fcd:	e8 9b 2c 00 00       	call   804c6d <_panic>
+	assert(r <= PGSIZE);
+  801fd2:	68 5b 58 80 00       	push   $0x80585b
+  801fd7:	68 3b 58 80 00       	push   $0x80583b
+  801fdc:	68 a1 00 00 00       	push   $0xa1
+  801fe1:	68 50 58 80 00       	push   $0x805850
+  801fe6:	e8 82 2c 00 00       	call   804c6d <_panic>
+
+00801feb <open>:
+{
+  801feb:	55                   	push   %ebp
+  801fec:	89 e5                	mov    %esp,%ebp
+  801fee:	56                   	push   %esi
+  801fef:	53                   	push   %ebx
+  801ff0:	83 ec 1c             	sub    $0x1c,%esp
+  801ff3:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801ff6:	56                   	push   %esi
+  801ff7:	e8 5d e7 ff ff       	call   800759 <strlen>
+  801ffc:	83 c4 10             	add    $0x10,%esp
+  801fff:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802004:	7f 6c                	jg     802072 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802006:	83 ec 0c             	sub    $0xc,%esp
+  802009:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80200c:	50                   	push   %eax
+  80200d:	e8 eb f7 ff ff       	call   8017fd <fd_alloc>
+  802012:	89 c3                	mov    %eax,%ebx
+  802014:	83 c4 10             	add    $0x10,%esp
+  802017:	85 c0                	test   %eax,%eax
+  802019:	78 3c                	js     802057 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80201b:	83 ec 08             	sub    $0x8,%esp
+  80201e:	56                   	push   %esi
+  80201f:	68 00 f0 80 00       	push   $0x80f000
+  802024:	e8 6b e7 ff ff       	call   800794 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802029:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80202c:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802031:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802034:	b8 01 00 00 00       	mov    $0x1,%eax
+  802039:	e8 77 fd ff ff       	call   801db5 <fsipc>
+  80203e:	89 c3                	mov    %eax,%ebx
+  802040:	83 c4 10             	add    $0x10,%esp
+  802043:	85 c0                	test   %eax,%eax
+  802045:	78 19                	js     802060 <open+0x75>
+	return fd2num(fd);
+  802047:	83 ec 0c             	sub    $0xc,%esp
+  80204a:	ff 75 f4             	push   -0xc(%ebp)
+  80204d:	e8 84 f7 ff ff       	call   8017d6 <fd2num>
+  802052:	89 c3                	mov    %eax,%ebx
+  802054:	83 c4 10             	add    $0x10,%esp
+}
+  802057:	89 d8                	mov    %ebx,%eax
+  802059:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80205c:	5b                   	pop    %ebx
+  80205d:	5e                   	pop    %esi
+  80205e:	5d                   	pop    %ebp
+  80205f:	c3                   	ret
+		fd_close(fd, 0);
+  802060:	83 ec 08             	sub    $0x8,%esp
+  802063:	6a 00                	push   $0x0
+  802065:	ff 75 f4             	push   -0xc(%ebp)
+  802068:	e8 80 f8 ff ff       	call   8018ed <fd_close>
+		return r;
+  80206d:	83 c4 10             	add    $0x10,%esp
+  802070:	eb e5                	jmp    802057 <open+0x6c>
+		return -E_BAD_PATH;
+  802072:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802077:	eb de                	jmp    802057 <open+0x6c>
+
+00802079 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802079:	55                   	push   %ebp
+  80207a:	89 e5                	mov    %esp,%ebp
+  80207c:	53                   	push   %ebx
+  80207d:	83 ec 10             	sub    $0x10,%esp
+  802080:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802083:	53                   	push   %ebx
+  802084:	e8 d0 e6 ff ff       	call   800759 <strlen>
+  802089:	83 c4 10             	add    $0x10,%esp
+  80208c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802091:	7f 25                	jg     8020b8 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802093:	83 ec 08             	sub    $0x8,%esp
+  802096:	53                   	push   %ebx
+  802097:	68 00 f0 80 00       	push   $0x80f000
+  80209c:	e8 f3 e6 ff ff       	call   800794 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8020a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020a6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8020ab:	e8 05 fd ff ff       	call   801db5 <fsipc>
+  8020b0:	83 c4 10             	add    $0x10,%esp
+}
+  8020b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020b6:	c9                   	leave
+  8020b7:	c3                   	ret
+		return -E_BAD_PATH;
+  8020b8:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8020bd:	eb f4                	jmp    8020b3 <remove+0x3a>
+
+008020bf <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8020bf:	55                   	push   %ebp
+  8020c0:	89 e5                	mov    %esp,%ebp
+  8020c2:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8020c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ca:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020cf:	e8 e1 fc ff ff       	call   801db5 <fsipc>
+}
+  8020d4:	c9                   	leave
+  8020d5:	c3                   	ret
+
+008020d6 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  8020d6:	55                   	push   %ebp
+  8020d7:	89 e5                	mov    %esp,%ebp
+  8020d9:	53                   	push   %ebx
+  8020da:	83 ec 04             	sub    $0x4,%esp
+  8020dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  8020e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8020ea:	e8 c6 fc ff ff       	call   801db5 <fsipc>
+  8020ef:	85 c0                	test   %eax,%eax
+  8020f1:	78 3c                	js     80212f <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  8020f3:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  8020f8:	89 03                	mov    %eax,(%ebx)
+  8020fa:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  8020ff:	89 43 04             	mov    %eax,0x4(%ebx)
+  802102:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  802107:	89 43 08             	mov    %eax,0x8(%ebx)
+  80210a:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  80210f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802112:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  802117:	89 43 10             	mov    %eax,0x10(%ebx)
+  80211a:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  80211f:	89 43 14             	mov    %eax,0x14(%ebx)
+  802122:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  802127:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  80212a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80212f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802132:	c9                   	leave
+  802133:	c3                   	ret
+
+00802134 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  802134:	55                   	push   %ebp
+  802135:	89 e5                	mov    %esp,%ebp
+  802137:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  80213a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80213d:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  802142:	ba 00 00 00 00       	mov    $0x0,%edx
+  802147:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80214c:	e8 64 fc ff ff       	call   801db5 <fsipc>
+}
+  802151:	c9                   	leave
+  802152:	c3                   	ret
+
+00802153 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802153:	55                   	push   %ebp
+  802154:	89 e5                	mov    %esp,%ebp
+  802156:	56                   	push   %esi
+  802157:	53                   	push   %ebx
+  802158:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80215b:	83 ec 0c             	sub    $0xc,%esp
+  80215e:	ff 75 08             	push   0x8(%ebp)
+  802161:	e8 80 f6 ff ff       	call   8017e6 <fd2data>
+  802166:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802168:	83 c4 08             	add    $0x8,%esp
+  80216b:	68 67 58 80 00       	push   $0x805867
+  802170:	53                   	push   %ebx
+  802171:	e8 1e e6 ff ff       	call   800794 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802176:	8b 46 04             	mov    0x4(%esi),%eax
+  802179:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  80217f:	2b 0e                	sub    (%esi),%ecx
+  802181:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802186:	89 c8                	mov    %ecx,%eax
+  802188:	f7 e2                	mul    %edx
+  80218a:	c1 ea 0c             	shr    $0xc,%edx
+  80218d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802193:	29 d1                	sub    %edx,%ecx
+  802195:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  80219b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8021a2:	00 00 00 
+	stat->st_dev = &devpipe;
+  8021a5:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  8021ac:	60 80 00 
+	return 0;
+}
+  8021af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b7:	5b                   	pop    %ebx
+  8021b8:	5e                   	pop    %esi
+  8021b9:	5d                   	pop    %ebp
+  8021ba:	c3                   	ret
+
+008021bb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8021bb:	55                   	push   %ebp
+  8021bc:	89 e5                	mov    %esp,%ebp
+  8021be:	53                   	push   %ebx
+  8021bf:	83 ec 0c             	sub    $0xc,%esp
+  8021c2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8021c5:	53                   	push   %ebx
+  8021c6:	6a 00                	push   $0x0
+  8021c8:	e8 3f eb ff ff       	call   800d0c <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8021cd:	89 1c 24             	mov    %ebx,(%esp)
+  8021d0:	e8 11 f6 ff ff       	call   8017e6 <fd2data>
+  8021d5:	83 c4 08             	add    $0x8,%esp
+  8021d8:	50                   	push   %eax
+  8021d9:	6a 00                	push   $0x0
+  8021db:	e8 2c eb ff ff       	call   800d0c <sys_page_unmap>
+}
+  8021e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021e3:	c9                   	leave
+  8021e4:	c3                   	ret
+
+008021e5 <_pipeisclosed>:
+{
+  8021e5:	55                   	push   %ebp
+  8021e6:	89 e5                	mov    %esp,%ebp
+  8021e8:	57                   	push   %edi
+  8021e9:	56                   	push   %esi
+  8021ea:	53                   	push   %ebx
+  8021eb:	83 ec 1c             	sub    $0x1c,%esp
+  8021ee:	89 c7                	mov    %eax,%edi
+  8021f0:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8021f2:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8021f7:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8021fa:	83 ec 0c             	sub    $0xc,%esp
+  8021fd:	57                   	push   %edi
+  8021fe:	e8 4c 2e 00 00       	call   80504f <pageref>
+  802203:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802206:	89 34 24             	mov    %esi,(%esp)
+  802209:	e8 41 2e 00 00       	call   80504f <pageref>
+		nn = thisenv->env_runs;
+  80220e:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  802214:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802217:	83 c4 10             	add    $0x10,%esp
+  80221a:	39 cb                	cmp    %ecx,%ebx
+  80221c:	74 1b                	je     802239 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80221e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802221:	75 cf                	jne    8021f2 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802223:	8b 42 58             	mov    0x58(%edx),%eax
+  802226:	6a 01                	push   $0x1
+  802228:	50                   	push   %eax
+  802229:	53                   	push   %ebx
+  80222a:	68 6e 58 80 00       	push   $0x80586e
+  80222f:	e8 79 df ff ff       	call   8001ad <cprintf>
+  802234:	83 c4 10             	add    $0x10,%esp
+  802237:	eb b9                	jmp    8021f2 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802239:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80223c:	0f 94 c0             	sete   %al
+  80223f:	0f b6 c0             	movzbl %al,%eax
+}
+  802242:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802245:	5b                   	pop    %ebx
+  802246:	5e                   	pop    %esi
+  802247:	5f                   	pop    %edi
+  802248:	5d                   	pop    %ebp
+  802249:	c3                   	ret
+
+0080224a <devpipe_read>:
+{
+  80224a:	55                   	push   %ebp
+  80224b:	89 e5                	mov    %esp,%ebp
+  80224d:	57                   	push   %edi
+  80224e:	56                   	push   %esi
+  80224f:	53                   	push   %ebx
+  802250:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802253:	ff 75 08             	push   0x8(%ebp)
+  802256:	e8 8b f5 ff ff       	call   8017e6 <fd2data>
+  80225b:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  80225d:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  802260:	8d 40 04             	lea    0x4(%eax),%eax
+  802263:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802266:	8b 7b 04             	mov    0x4(%ebx),%edi
+  802269:	8b 0b                	mov    (%ebx),%ecx
+  80226b:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  802271:	29 ce                	sub    %ecx,%esi
+  802273:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802278:	f7 e6                	mul    %esi
+  80227a:	c1 ea 0c             	shr    $0xc,%edx
+  80227d:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  802283:	29 c6                	sub    %eax,%esi
+  802285:	89 f2                	mov    %esi,%edx
+  802287:	75 43                	jne    8022cc <devpipe_read+0x82>
+		ref = pageref(p);
+  802289:	83 ec 0c             	sub    $0xc,%esp
+  80228c:	53                   	push   %ebx
+  80228d:	e8 bd 2d 00 00       	call   80504f <pageref>
+  802292:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  802294:	89 da                	mov    %ebx,%edx
+  802296:	8b 45 08             	mov    0x8(%ebp),%eax
+  802299:	e8 47 ff ff ff       	call   8021e5 <_pipeisclosed>
+  80229e:	83 c4 10             	add    $0x10,%esp
+  8022a1:	85 c0                	test   %eax,%eax
+  8022a3:	0f 85 c1 00 00 00    	jne    80236a <devpipe_read+0x120>
+	*sleeping = 1;
+  8022a9:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  8022b0:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8022b5:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  8022b8:	75 ac                	jne    802266 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  8022ba:	83 ec 04             	sub    $0x4,%esp
+  8022bd:	56                   	push   %esi
+  8022be:	57                   	push   %edi
+  8022bf:	ff 75 e4             	push   -0x1c(%ebp)
+  8022c2:	e8 99 ee ff ff       	call   801160 <sys_futex_wait>
+  8022c7:	83 c4 10             	add    $0x10,%esp
+  8022ca:	eb 9a                	jmp    802266 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  8022cc:	39 75 10             	cmp    %esi,0x10(%ebp)
+  8022cf:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  8022d3:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8022d5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8022da:	f7 e1                	mul    %ecx
+  8022dc:	c1 ea 0b             	shr    $0xb,%edx
+  8022df:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8022e5:	29 c1                	sub    %eax,%ecx
+  8022e7:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  8022e9:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8022ee:	29 cf                	sub    %ecx,%edi
+  8022f0:	39 f7                	cmp    %esi,%edi
+  8022f2:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  8022f5:	8d 43 10             	lea    0x10(%ebx),%eax
+  8022f8:	83 ec 04             	sub    $0x4,%esp
+  8022fb:	57                   	push   %edi
+  8022fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8022ff:	01 c2                	add    %eax,%edx
+  802301:	52                   	push   %edx
+  802302:	ff 75 0c             	push   0xc(%ebp)
+  802305:	e8 10 e6 ff ff       	call   80091a <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  80230a:	83 c4 0c             	add    $0xc,%esp
+  80230d:	89 f1                	mov    %esi,%ecx
+  80230f:	29 f9                	sub    %edi,%ecx
+  802311:	51                   	push   %ecx
+  802312:	ff 75 e4             	push   -0x1c(%ebp)
+  802315:	89 f8                	mov    %edi,%eax
+  802317:	03 45 0c             	add    0xc(%ebp),%eax
+  80231a:	50                   	push   %eax
+  80231b:	e8 fa e5 ff ff       	call   80091a <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  802320:	89 f1                	mov    %esi,%ecx
+  802322:	03 0b                	add    (%ebx),%ecx
+  802324:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802329:	f7 e1                	mul    %ecx
+  80232b:	c1 ea 0c             	shr    $0xc,%edx
+  80232e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802334:	29 d1                	sub    %edx,%ecx
+  802336:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  802338:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80233d:	83 c4 10             	add    $0x10,%esp
+  802340:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  802344:	75 0a                	jne    802350 <devpipe_read+0x106>
+	return n;
+  802346:	89 f0                	mov    %esi,%eax
+}
+  802348:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80234b:	5b                   	pop    %ebx
+  80234c:	5e                   	pop    %esi
+  80234d:	5f                   	pop    %edi
+  80234e:	5d                   	pop    %ebp
+  80234f:	c3                   	ret
+		*sleeping = 0;
+  802350:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  802357:	83 ec 08             	sub    $0x8,%esp
+  80235a:	68 00 04 00 00       	push   $0x400
+  80235f:	53                   	push   %ebx
+  802360:	e8 4b ee ff ff       	call   8011b0 <sys_futex_wake>
+  802365:	83 c4 10             	add    $0x10,%esp
+  802368:	eb dc                	jmp    802346 <devpipe_read+0xfc>
+			return 0;
+  80236a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80236f:	eb d7                	jmp    802348 <devpipe_read+0xfe>
+
+00802371 <devpipe_write>:
+{
+  802371:	55                   	push   %ebp
+  802372:	89 e5                	mov    %esp,%ebp
+  802374:	57                   	push   %edi
+  802375:	56                   	push   %esi
+  802376:	53                   	push   %ebx
+  802377:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80237a:	ff 75 08             	push   0x8(%ebp)
+  80237d:	e8 64 f4 ff ff       	call   8017e6 <fd2data>
+  802382:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  802384:	83 c4 10             	add    $0x10,%esp
+  802387:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80238e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802391:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802394:	0f 83 23 01 00 00    	jae    8024bd <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80239a:	8b 77 04             	mov    0x4(%edi),%esi
+  80239d:	8b 1f                	mov    (%edi),%ebx
+  80239f:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  8023a5:	29 d9                	sub    %ebx,%ecx
+  8023a7:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8023ac:	f7 e1                	mul    %ecx
+  8023ae:	c1 ea 0c             	shr    $0xc,%edx
+  8023b1:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8023b7:	29 c1                	sub    %eax,%ecx
+  8023b9:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8023bb:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8023c1:	75 40                	jne    802403 <devpipe_write+0x92>
+			ref = pageref(p);
+  8023c3:	83 ec 0c             	sub    $0xc,%esp
+  8023c6:	57                   	push   %edi
+  8023c7:	e8 83 2c 00 00       	call   80504f <pageref>
+  8023cc:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  8023ce:	89 fa                	mov    %edi,%edx
+  8023d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d3:	e8 0d fe ff ff       	call   8021e5 <_pipeisclosed>
+  8023d8:	83 c4 10             	add    $0x10,%esp
+  8023db:	85 c0                	test   %eax,%eax
+  8023dd:	0f 85 d5 00 00 00    	jne    8024b8 <devpipe_write+0x147>
+	*sleeping = 1;
+  8023e3:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  8023ea:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8023ef:	39 1f                	cmp    %ebx,(%edi)
+  8023f1:	75 a7                	jne    80239a <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  8023f3:	83 ec 04             	sub    $0x4,%esp
+  8023f6:	56                   	push   %esi
+  8023f7:	53                   	push   %ebx
+  8023f8:	57                   	push   %edi
+  8023f9:	e8 62 ed ff ff       	call   801160 <sys_futex_wait>
+  8023fe:	83 c4 10             	add    $0x10,%esp
+  802401:	eb 97                	jmp    80239a <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802403:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802406:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802409:	29 c1                	sub    %eax,%ecx
+  80240b:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802410:	89 d8                	mov    %ebx,%eax
+  802412:	29 d0                	sub    %edx,%eax
+  802414:	39 c1                	cmp    %eax,%ecx
+  802416:	0f 46 c1             	cmovbe %ecx,%eax
+  802419:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  80241b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802420:	f7 e6                	mul    %esi
+  802422:	c1 ea 0b             	shr    $0xb,%edx
+  802425:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80242b:	29 c6                	sub    %eax,%esi
+  80242d:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80242f:	29 f3                	sub    %esi,%ebx
+  802431:	39 cb                	cmp    %ecx,%ebx
+  802433:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802436:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  802439:	8d 77 10             	lea    0x10(%edi),%esi
+  80243c:	83 ec 04             	sub    $0x4,%esp
+  80243f:	53                   	push   %ebx
+  802440:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802443:	03 45 0c             	add    0xc(%ebp),%eax
+  802446:	50                   	push   %eax
+  802447:	01 f2                	add    %esi,%edx
+  802449:	52                   	push   %edx
+  80244a:	e8 cb e4 ff ff       	call   80091a <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80244f:	83 c4 0c             	add    $0xc,%esp
+  802452:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802455:	29 d8                	sub    %ebx,%eax
+  802457:	50                   	push   %eax
+  802458:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80245b:	01 d3                	add    %edx,%ebx
+  80245d:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802460:	53                   	push   %ebx
+  802461:	56                   	push   %esi
+  802462:	e8 b3 e4 ff ff       	call   80091a <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802467:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80246a:	03 4f 04             	add    0x4(%edi),%ecx
+  80246d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802472:	f7 e1                	mul    %ecx
+  802474:	c1 ea 0c             	shr    $0xc,%edx
+  802477:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80247d:	29 d1                	sub    %edx,%ecx
+  80247f:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  802482:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802487:	83 c4 10             	add    $0x10,%esp
+  80248a:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  80248e:	75 0b                	jne    80249b <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802490:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  802493:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802496:	e9 f3 fe ff ff       	jmp    80238e <devpipe_write+0x1d>
+		*sleeping = 0;
+  80249b:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8024a2:	83 ec 08             	sub    $0x8,%esp
+  8024a5:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  8024aa:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  8024ad:	50                   	push   %eax
+  8024ae:	e8 fd ec ff ff       	call   8011b0 <sys_futex_wake>
+  8024b3:	83 c4 10             	add    $0x10,%esp
+  8024b6:	eb d8                	jmp    802490 <devpipe_write+0x11f>
+				return 0;
+  8024b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024c0:	5b                   	pop    %ebx
+  8024c1:	5e                   	pop    %esi
+  8024c2:	5f                   	pop    %edi
+  8024c3:	5d                   	pop    %ebp
+  8024c4:	c3                   	ret
+
+008024c5 <pipe>:
+{
+  8024c5:	55                   	push   %ebp
+  8024c6:	89 e5                	mov    %esp,%ebp
+  8024c8:	56                   	push   %esi
+  8024c9:	53                   	push   %ebx
+  8024ca:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8024cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024d0:	50                   	push   %eax
+  8024d1:	e8 27 f3 ff ff       	call   8017fd <fd_alloc>
+  8024d6:	89 c3                	mov    %eax,%ebx
+  8024d8:	83 c4 10             	add    $0x10,%esp
+  8024db:	85 c0                	test   %eax,%eax
+  8024dd:	0f 88 23 01 00 00    	js     802606 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024e3:	83 ec 04             	sub    $0x4,%esp
+  8024e6:	68 07 04 00 00       	push   $0x407
+  8024eb:	ff 75 f4             	push   -0xc(%ebp)
+  8024ee:	6a 00                	push   $0x0
+  8024f0:	e8 92 e7 ff ff       	call   800c87 <sys_page_alloc>
+  8024f5:	89 c3                	mov    %eax,%ebx
+  8024f7:	83 c4 10             	add    $0x10,%esp
+  8024fa:	85 c0                	test   %eax,%eax
+  8024fc:	0f 88 04 01 00 00    	js     802606 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802502:	83 ec 0c             	sub    $0xc,%esp
+  802505:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802508:	50                   	push   %eax
+  802509:	e8 ef f2 ff ff       	call   8017fd <fd_alloc>
+  80250e:	89 c3                	mov    %eax,%ebx
+  802510:	83 c4 10             	add    $0x10,%esp
+  802513:	85 c0                	test   %eax,%eax
+  802515:	0f 88 db 00 00 00    	js     8025f6 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80251b:	83 ec 04             	sub    $0x4,%esp
+  80251e:	68 07 04 00 00       	push   $0x407
+  802523:	ff 75 f0             	push   -0x10(%ebp)
+  802526:	6a 00                	push   $0x0
+  802528:	e8 5a e7 ff ff       	call   800c87 <sys_page_alloc>
+  80252d:	89 c3                	mov    %eax,%ebx
+  80252f:	83 c4 10             	add    $0x10,%esp
+  802532:	85 c0                	test   %eax,%eax
+  802534:	0f 88 bc 00 00 00    	js     8025f6 <pipe+0x131>
+	va = fd2data(fd0);
+  80253a:	83 ec 0c             	sub    $0xc,%esp
+  80253d:	ff 75 f4             	push   -0xc(%ebp)
+  802540:	e8 a1 f2 ff ff       	call   8017e6 <fd2data>
+  802545:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802547:	83 c4 0c             	add    $0xc,%esp
+  80254a:	68 07 04 00 00       	push   $0x407
+  80254f:	50                   	push   %eax
+  802550:	6a 00                	push   $0x0
+  802552:	e8 30 e7 ff ff       	call   800c87 <sys_page_alloc>
+  802557:	89 c3                	mov    %eax,%ebx
+  802559:	83 c4 10             	add    $0x10,%esp
+  80255c:	85 c0                	test   %eax,%eax
+  80255e:	0f 88 82 00 00 00    	js     8025e6 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802564:	83 ec 0c             	sub    $0xc,%esp
+  802567:	ff 75 f0             	push   -0x10(%ebp)
+  80256a:	e8 77 f2 ff ff       	call   8017e6 <fd2data>
+  80256f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802576:	50                   	push   %eax
+  802577:	6a 00                	push   $0x0
+  802579:	56                   	push   %esi
+  80257a:	6a 00                	push   $0x0
+  80257c:	e8 49 e7 ff ff       	call   800cca <sys_page_map>
+  802581:	89 c3                	mov    %eax,%ebx
+  802583:	83 c4 20             	add    $0x20,%esp
+  802586:	85 c0                	test   %eax,%eax
+  802588:	78 4e                	js     8025d8 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80258a:	a1 20 60 80 00       	mov    0x806020,%eax
+  80258f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802592:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802594:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802597:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80259e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8025a1:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8025a3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8025a6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8025ad:	83 ec 0c             	sub    $0xc,%esp
+  8025b0:	ff 75 f4             	push   -0xc(%ebp)
+  8025b3:	e8 1e f2 ff ff       	call   8017d6 <fd2num>
+  8025b8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025bb:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8025bd:	83 c4 04             	add    $0x4,%esp
+  8025c0:	ff 75 f0             	push   -0x10(%ebp)
+  8025c3:	e8 0e f2 ff ff       	call   8017d6 <fd2num>
+  8025c8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025cb:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8025ce:	83 c4 10             	add    $0x10,%esp
+  8025d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025d6:	eb 2e                	jmp    802606 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8025d8:	83 ec 08             	sub    $0x8,%esp
+  8025db:	56                   	push   %esi
+  8025dc:	6a 00                	push   $0x0
+  8025de:	e8 29 e7 ff ff       	call   800d0c <sys_page_unmap>
+  8025e3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8025e6:	83 ec 08             	sub    $0x8,%esp
+  8025e9:	ff 75 f0             	push   -0x10(%ebp)
+  8025ec:	6a 00                	push   $0x0
+  8025ee:	e8 19 e7 ff ff       	call   800d0c <sys_page_unmap>
+  8025f3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8025f6:	83 ec 08             	sub    $0x8,%esp
+  8025f9:	ff 75 f4             	push   -0xc(%ebp)
+  8025fc:	6a 00                	push   $0x0
+  8025fe:	e8 09 e7 ff ff       	call   800d0c <sys_page_unmap>
+  802603:	83 c4 10             	add    $0x10,%esp
+}
+  802606:	89 d8                	mov    %ebx,%eax
+  802608:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80260b:	5b                   	pop    %ebx
+  80260c:	5e                   	pop    %esi
+  80260d:	5d                   	pop    %ebp
+  80260e:	c3                   	ret
+
+0080260f <pipeisclosed>:
+{
+  80260f:	55                   	push   %ebp
+  802610:	89 e5                	mov    %esp,%ebp
+  802612:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802615:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802618:	50                   	push   %eax
+  802619:	ff 75 08             	push   0x8(%ebp)
+  80261c:	e8 30 f2 ff ff       	call   801851 <fd_lookup>
+  802621:	83 c4 10             	add    $0x10,%esp
+  802624:	85 c0                	test   %eax,%eax
+  802626:	78 18                	js     802640 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802628:	83 ec 0c             	sub    $0xc,%esp
+  80262b:	ff 75 f4             	push   -0xc(%ebp)
+  80262e:	e8 b3 f1 ff ff       	call   8017e6 <fd2data>
+  802633:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802635:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802638:	e8 a8 fb ff ff       	call   8021e5 <_pipeisclosed>
+  80263d:	83 c4 10             	add    $0x10,%esp
+}
+  802640:	c9                   	leave
+  802641:	c3                   	ret
+
+00802642 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802642:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802644:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  80264a:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802650:	81 c2 34 01 00 00    	add    $0x134,%edx
+  802656:	39 d0                	cmp    %edx,%eax
+  802658:	74 2e                	je     802688 <segment_lookup+0x46>
+{
+  80265a:	55                   	push   %ebp
+  80265b:	89 e5                	mov    %esp,%ebp
+  80265d:	57                   	push   %edi
+  80265e:	56                   	push   %esi
+  80265f:	53                   	push   %ebx
+  802660:	eb 07                	jmp    802669 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802662:	83 c0 20             	add    $0x20,%eax
+  802665:	39 d0                	cmp    %edx,%eax
+  802667:	74 15                	je     80267e <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802669:	8b 18                	mov    (%eax),%ebx
+  80266b:	39 d9                	cmp    %ebx,%ecx
+  80266d:	72 f3                	jb     802662 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  80266f:	8b 38                	mov    (%eax),%edi
+  802671:	8b 58 04             	mov    0x4(%eax),%ebx
+  802674:	89 ce                	mov    %ecx,%esi
+  802676:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  802678:	39 de                	cmp    %ebx,%esi
+  80267a:	73 e6                	jae    802662 <segment_lookup+0x20>
+  80267c:	eb 05                	jmp    802683 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  80267e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802683:	5b                   	pop    %ebx
+  802684:	5e                   	pop    %esi
+  802685:	5f                   	pop    %edi
+  802686:	5d                   	pop    %ebp
+  802687:	c3                   	ret
+	return NULL;
+  802688:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80268d:	c3                   	ret
+
+0080268e <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  80268e:	55                   	push   %ebp
+  80268f:	89 e5                	mov    %esp,%ebp
+  802691:	53                   	push   %ebx
+  802692:	83 ec 04             	sub    $0x4,%esp
+  802695:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802697:	c1 e8 16             	shr    $0x16,%eax
+  80269a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8026a1:	25 81 00 00 00       	and    $0x81,%eax
+  8026a6:	83 f8 01             	cmp    $0x1,%eax
+  8026a9:	75 6b                	jne    802716 <page_is_clean+0x88>
+  8026ab:	89 da                	mov    %ebx,%edx
+  8026ad:	c1 ea 0c             	shr    $0xc,%edx
+  8026b0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  8026b7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8026bc:	f6 c1 01             	test   $0x1,%cl
+  8026bf:	74 5a                	je     80271b <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  8026c1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8026c8:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  8026ce:	75 4b                	jne    80271b <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  8026d0:	89 d8                	mov    %ebx,%eax
+  8026d2:	e8 6b ff ff ff       	call   802642 <segment_lookup>
+  8026d7:	89 c2                	mov    %eax,%edx
+		return 1;
+  8026d9:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  8026de:	85 d2                	test   %edx,%edx
+  8026e0:	75 39                	jne    80271b <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  8026e2:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  8026e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ed:	eb 03                	jmp    8026f2 <page_is_clean+0x64>
+  8026ef:	83 c0 01             	add    $0x1,%eax
+  8026f2:	39 c2                	cmp    %eax,%edx
+  8026f4:	7e 19                	jle    80270f <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  8026f6:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  8026fd:	72 f0                	jb     8026ef <page_is_clean+0x61>
+  8026ff:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  802706:	73 e7                	jae    8026ef <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  802708:	b8 01 00 00 00       	mov    $0x1,%eax
+  80270d:	eb 0c                	jmp    80271b <page_is_clean+0x8d>
+	return 0;
+  80270f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802714:	eb 05                	jmp    80271b <page_is_clean+0x8d>
+		return 0;
+  802716:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80271b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80271e:	c9                   	leave
+  80271f:	c3                   	ret
+
+00802720 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  802720:	55                   	push   %ebp
+  802721:	89 e5                	mov    %esp,%ebp
+  802723:	57                   	push   %edi
+  802724:	56                   	push   %esi
+  802725:	53                   	push   %ebx
+  802726:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802729:	be 00 00 00 00       	mov    $0x0,%esi
+  80272e:	eb 19                	jmp    802749 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802730:	f7 d3                	not    %ebx
+  802732:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802738:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80273a:	83 c6 01             	add    $0x1,%esi
+  80273d:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802743:	0f 87 97 00 00 00    	ja     8027e0 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802749:	89 f3                	mov    %esi,%ebx
+  80274b:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  802751:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802757:	89 d8                	mov    %ebx,%eax
+  802759:	c1 e8 0a             	shr    $0xa,%eax
+  80275c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802763:	25 81 00 00 00       	and    $0x81,%eax
+  802768:	83 f8 01             	cmp    $0x1,%eax
+  80276b:	75 c3                	jne    802730 <linear_walk+0x10>
+  80276d:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802773:	77 bb                	ja     802730 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802775:	89 df                	mov    %ebx,%edi
+  802777:	c1 e7 0c             	shl    $0xc,%edi
+  80277a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80277d:	89 f8                	mov    %edi,%eax
+  80277f:	e8 0a ff ff ff       	call   80268e <page_is_clean>
+  802784:	84 c0                	test   %al,%al
+  802786:	75 64                	jne    8027ec <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802788:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  80278e:	77 aa                	ja     80273a <linear_walk+0x1a>
+  802790:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  802796:	72 a2                	jb     80273a <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802798:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80279f:	a8 01                	test   $0x1,%al
+  8027a1:	74 97                	je     80273a <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027a3:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8027aa:	f6 c4 04             	test   $0x4,%ah
+  8027ad:	75 8b                	jne    80273a <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8027af:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027b6:	f6 c4 02             	test   $0x2,%ah
+  8027b9:	0f 85 7b ff ff ff    	jne    80273a <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8027bf:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8027c6:	c1 e8 0c             	shr    $0xc,%eax
+  8027c9:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8027cc:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8027d1:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8027d5:	66 83 f8 01          	cmp    $0x1,%ax
+  8027d9:	76 11                	jbe    8027ec <linear_walk+0xcc>
+  8027db:	e9 5a ff ff ff       	jmp    80273a <linear_walk+0x1a>
+  8027e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  8027e5:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  8027ec:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  8027f2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027f5:	83 c4 1c             	add    $0x1c,%esp
+  8027f8:	5b                   	pop    %ebx
+  8027f9:	5e                   	pop    %esi
+  8027fa:	5f                   	pop    %edi
+  8027fb:	5d                   	pop    %ebp
+  8027fc:	c3                   	ret
+
+008027fd <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  8027fd:	55                   	push   %ebp
+  8027fe:	89 e5                	mov    %esp,%ebp
+  802800:	56                   	push   %esi
+  802801:	53                   	push   %ebx
+  802802:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  802804:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802809:	83 e0 7f             	and    $0x7f,%eax
+  80280c:	c1 e0 04             	shl    $0x4,%eax
+  80280f:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  802815:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  80281b:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802821:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  802827:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80282c:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  80282f:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802834:	83 c0 01             	add    $0x1,%eax
+  802837:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  80283c:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  80283f:	5b                   	pop    %ebx
+  802840:	5e                   	pop    %esi
+  802841:	5d                   	pop    %ebp
+  802842:	c3                   	ret
+
+00802843 <page_ring_enter>:
+{
+  802843:	55                   	push   %ebp
+  802844:	89 e5                	mov    %esp,%ebp
+  802846:	57                   	push   %edi
+  802847:	56                   	push   %esi
+  802848:	53                   	push   %ebx
+  802849:	83 ec 18             	sub    $0x18,%esp
+  80284c:	89 c6                	mov    %eax,%esi
+  80284e:	89 d7                	mov    %edx,%edi
+  802850:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802852:	6a 00                	push   $0x0
+  802854:	6a 00                	push   $0x0
+  802856:	6a 00                	push   $0x0
+  802858:	6a 07                	push   $0x7
+  80285a:	ff 35 40 b0 80 00    	push   0x80b040
+  802860:	e8 d4 26 00 00       	call   804f39 <ipc_call>
+  802865:	83 c4 20             	add    $0x20,%esp
+  802868:	85 c0                	test   %eax,%eax
+  80286a:	79 22                	jns    80288e <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  80286c:	50                   	push   %eax
+  80286d:	68 86 58 80 00       	push   $0x805886
+  802872:	68 13 02 00 00       	push   $0x213
+  802877:	68 9a 58 80 00       	push   $0x80589a
+  80287c:	e8 ec 23 00 00       	call   804c6d <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802881:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802886:	83 c0 01             	add    $0x1,%eax
+  802889:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  80288e:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802894:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802899:	39 c2                	cmp    %eax,%edx
+  80289b:	74 24                	je     8028c1 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  80289d:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8028a2:	83 e0 7f             	and    $0x7f,%eax
+  8028a5:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  8028ac:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  8028b3:	29 f0                	sub    %esi,%eax
+  8028b5:	39 d8                	cmp    %ebx,%eax
+  8028b7:	73 c8                	jae    802881 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  8028b9:	8b 52 04             	mov    0x4(%edx),%edx
+  8028bc:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  8028bf:	eb c0                	jmp    802881 <page_ring_enter+0x3e>
+}
+  8028c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028c4:	5b                   	pop    %ebx
+  8028c5:	5e                   	pop    %esi
+  8028c6:	5f                   	pop    %edi
+  8028c7:	5d                   	pop    %ebp
+  8028c8:	c3                   	ret
+
+008028c9 <page_ring_reserve>:
+{
+  8028c9:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  8028cb:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8028d0:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  8028d6:	29 d0                	sub    %edx,%eax
+  8028d8:	ba 80 00 00 00       	mov    $0x80,%edx
+  8028dd:	29 ca                	sub    %ecx,%edx
+  8028df:	39 c2                	cmp    %eax,%edx
+  8028e1:	72 01                	jb     8028e4 <page_ring_reserve+0x1b>
+  8028e3:	c3                   	ret
+{
+  8028e4:	55                   	push   %ebp
+  8028e5:	89 e5                	mov    %esp,%ebp
+  8028e7:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  8028ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f9:	e8 45 ff ff ff       	call   802843 <page_ring_enter>
+}
+  8028fe:	c9                   	leave
+  8028ff:	c3                   	ret
+
+00802900 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802900:	55                   	push   %ebp
+  802901:	89 e5                	mov    %esp,%ebp
+  802903:	53                   	push   %ebx
+  802904:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802907:	6a 07                	push   $0x7
+  802909:	6a 01                	push   $0x1
+  80290b:	89 c3                	mov    %eax,%ebx
+  80290d:	c1 e3 0c             	shl    $0xc,%ebx
+  802910:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  802916:	52                   	push   %edx
+  802917:	6a 04                	push   $0x4
+  802919:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  802920:	e8 14 26 00 00       	call   804f39 <ipc_call>
+	sharereqs[i].nslots = 0;
+  802925:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  80292c:	00 00 00 
+	return r;
+}
+  80292f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802932:	c9                   	leave
+  802933:	c3                   	ret
+
+00802934 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802934:	55                   	push   %ebp
+  802935:	89 e5                	mov    %esp,%ebp
+  802937:	56                   	push   %esi
+  802938:	53                   	push   %ebx
+  802939:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  80293b:	c1 e8 10             	shr    $0x10,%eax
+  80293e:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802941:	89 c2                	mov    %eax,%edx
+  802943:	c1 e2 0c             	shl    $0xc,%edx
+  802946:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  80294c:	8d 5e 01             	lea    0x1(%esi),%ebx
+  80294f:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  802955:	89 c2                	mov    %eax,%edx
+  802957:	c1 e2 0a             	shl    $0xa,%edx
+  80295a:	01 f2                	add    %esi,%edx
+  80295c:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802963:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802969:	74 09                	je     802974 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  80296b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802970:	5b                   	pop    %ebx
+  802971:	5e                   	pop    %esi
+  802972:	5d                   	pop    %ebp
+  802973:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802974:	e8 87 ff ff ff       	call   802900 <page_share_send>
+  802979:	eb f5                	jmp    802970 <page_share_slot+0x3c>
+
+0080297b <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  80297b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802980:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802983:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802988:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  80298e:	74 09                	je     802999 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802990:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802995:	85 c0                	test   %eax,%eax
+  802997:	75 01                	jne    80299a <page_ring_ready+0x1f>
+}
+  802999:	c3                   	ret
+{
+  80299a:	55                   	push   %ebp
+  80299b:	89 e5                	mov    %esp,%ebp
+  80299d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  8029a0:	68 07 06 00 00       	push   $0x607
+  8029a5:	6a 08                	push   $0x8
+  8029a7:	68 00 30 ad de       	push   $0xdead3000
+  8029ac:	6a 00                	push   $0x0
+  8029ae:	e8 ff e3 ff ff       	call   800db2 <sys_page_alloc_range>
+  8029b3:	83 c4 10             	add    $0x10,%esp
+  8029b6:	83 f8 08             	cmp    $0x8,%eax
+  8029b9:	74 1b                	je     8029d6 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  8029bb:	83 ec 04             	sub    $0x4,%esp
+  8029be:	6a 08                	push   $0x8
+  8029c0:	68 00 30 ad de       	push   $0xdead3000
+  8029c5:	6a 00                	push   $0x0
+  8029c7:	e8 54 e4 ff ff       	call   800e20 <sys_page_unmap_range>
+		return 0;
+  8029cc:	83 c4 10             	add    $0x10,%esp
+  8029cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029d4:	c9                   	leave
+  8029d5:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  8029d6:	83 ec 0c             	sub    $0xc,%esp
+  8029d9:	68 07 04 00 00       	push   $0x407
+  8029de:	6a 08                	push   $0x8
+  8029e0:	68 00 30 ad de       	push   $0xdead3000
+  8029e5:	6a 06                	push   $0x6
+  8029e7:	ff 35 40 b0 80 00    	push   0x80b040
+  8029ed:	e8 47 25 00 00       	call   804f39 <ipc_call>
+  8029f2:	83 c4 20             	add    $0x20,%esp
+  8029f5:	85 c0                	test   %eax,%eax
+  8029f7:	78 14                	js     802a0d <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  8029f9:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8029fe:	8b 40 48             	mov    0x48(%eax),%eax
+  802a01:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  802a06:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a0b:	eb c7                	jmp    8029d4 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802a0d:	83 ec 04             	sub    $0x4,%esp
+  802a10:	6a 08                	push   $0x8
+  802a12:	68 00 30 ad de       	push   $0xdead3000
+  802a17:	6a 00                	push   $0x0
+  802a19:	e8 02 e4 ff ff       	call   800e20 <sys_page_unmap_range>
+		return 0;
+  802a1e:	83 c4 10             	add    $0x10,%esp
+  802a21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a26:	eb ac                	jmp    8029d4 <page_ring_ready+0x59>
+
+00802a28 <page_remove_slot>:
+{
+  802a28:	55                   	push   %ebp
+  802a29:	89 e5                	mov    %esp,%ebp
+  802a2b:	56                   	push   %esi
+  802a2c:	53                   	push   %ebx
+  802a2d:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802a2f:	89 c6                	mov    %eax,%esi
+  802a31:	c1 ee 10             	shr    $0x10,%esi
+  802a34:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802a37:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  802a3e:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  802a44:	74 2a                	je     802a70 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802a46:	83 ec 0c             	sub    $0xc,%esp
+  802a49:	6a 00                	push   $0x0
+  802a4b:	6a 00                	push   $0x0
+  802a4d:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802a4f:	c1 e3 04             	shl    $0x4,%ebx
+  802a52:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802a55:	53                   	push   %ebx
+  802a56:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  802a5d:	e8 d7 24 00 00       	call   804f39 <ipc_call>
+  802a62:	83 c4 20             	add    $0x20,%esp
+  802a65:	85 c0                	test   %eax,%eax
+  802a67:	78 2d                	js     802a96 <page_remove_slot+0x6e>
+}
+  802a69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a6c:	5b                   	pop    %ebx
+  802a6d:	5e                   	pop    %esi
+  802a6e:	5d                   	pop    %ebp
+  802a6f:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802a70:	e8 06 ff ff ff       	call   80297b <page_ring_ready>
+  802a75:	85 c0                	test   %eax,%eax
+  802a77:	74 cd                	je     802a46 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802a79:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a7e:	e8 46 fe ff ff       	call   8028c9 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802a83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a88:	89 da                	mov    %ebx,%edx
+  802a8a:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a8f:	e8 69 fd ff ff       	call   8027fd <page_ring_post>
+		return;
+  802a94:	eb d3                	jmp    802a69 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802a96:	50                   	push   %eax
+  802a97:	68 f4 58 80 00       	push   $0x8058f4
+  802a9c:	68 ac 03 00 00       	push   $0x3ac
+  802aa1:	68 9a 58 80 00       	push   $0x80589a
+  802aa6:	e8 c2 21 00 00       	call   804c6d <_panic>
+
+00802aab <find_paging_env>:
+	if(pagingenv)
+  802aab:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802ab0:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802ab2:	85 c0                	test   %eax,%eax
+  802ab4:	74 05                	je     802abb <find_paging_env+0x10>
+  802ab6:	eb 56                	jmp    802b0e <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802ab8:	83 c0 01             	add    $0x1,%eax
+  802abb:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802ac0:	7f 47                	jg     802b09 <find_paging_env+0x5e>
+  802ac2:	83 f9 01             	cmp    $0x1,%ecx
+  802ac5:	7f 42                	jg     802b09 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802ac7:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802aca:	c1 e2 06             	shl    $0x6,%edx
+  802acd:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802ad3:	8b 52 50             	mov    0x50(%edx),%edx
+  802ad6:	83 fa 02             	cmp    $0x2,%edx
+  802ad9:	75 dd                	jne    802ab8 <find_paging_env+0xd>
+  802adb:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802ade:	c1 e2 06             	shl    $0x6,%edx
+  802ae1:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802ae7:	8b 52 54             	mov    0x54(%edx),%edx
+  802aea:	85 d2                	test   %edx,%edx
+  802aec:	74 ca                	je     802ab8 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802aee:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802af1:	c1 e2 06             	shl    $0x6,%edx
+  802af4:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802afa:	8b 52 48             	mov    0x48(%edx),%edx
+  802afd:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  802b04:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802b07:	eb af                	jmp    802ab8 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802b09:	83 f9 02             	cmp    $0x2,%ecx
+  802b0c:	74 01                	je     802b0f <find_paging_env+0x64>
+}
+  802b0e:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802b0f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802b14:	8b 40 48             	mov    0x48(%eax),%eax
+  802b17:	83 e0 01             	and    $0x1,%eax
+  802b1a:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  802b21:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  802b26:	eb e6                	jmp    802b0e <find_paging_env+0x63>
+
+00802b28 <page_add_backed>:
+{
+  802b28:	55                   	push   %ebp
+  802b29:	89 e5                	mov    %esp,%ebp
+  802b2b:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802b2e:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  802b33:	83 f8 04             	cmp    $0x4,%eax
+  802b36:	74 35                	je     802b6d <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802b38:	89 d1                	mov    %edx,%ecx
+  802b3a:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802b40:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802b47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b4a:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802b51:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802b57:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  802b5e:	83 c0 01             	add    $0x1,%eax
+  802b61:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  802b66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b6b:	5d                   	pop    %ebp
+  802b6c:	c3                   	ret
+		return -E_NO_MEM;
+  802b6d:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802b72:	eb f7                	jmp    802b6b <page_add_backed+0x43>
+
+00802b74 <percentage_of_pgdir_to_walk>:
+{
+  802b74:	55                   	push   %ebp
+  802b75:	89 e5                	mov    %esp,%ebp
+  802b77:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802b7a:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802b7e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802b81:	db 45 fc             	fildl  -0x4(%ebp)
+  802b84:	d8 35 80 5d 80 00    	fdivs  0x805d80
+	return ret*ret;
+  802b8a:	d8 c8                	fmul   %st(0),%st
+}
+  802b8c:	c9                   	leave
+  802b8d:	c3                   	ret
+
+00802b8e <nfu_with_aging_page_choice_func>:
+{
+  802b8e:	55                   	push   %ebp
+  802b8f:	89 e5                	mov    %esp,%ebp
+  802b91:	57                   	push   %edi
+  802b92:	56                   	push   %esi
+  802b93:	53                   	push   %ebx
+  802b94:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802b97:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  802b9d:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802b9f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802ba4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ba9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802bb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bb5:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802bb8:	eb 18                	jmp    802bd2 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802bba:	f7 d0                	not    %eax
+  802bbc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802bc1:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802bc3:	83 c2 01             	add    $0x1,%edx
+  802bc6:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802bcc:	0f 87 13 01 00 00    	ja     802ce5 <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802bd2:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802bd6:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802bd9:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802bde:	89 c1                	mov    %eax,%ecx
+  802be0:	c1 e9 0a             	shr    $0xa,%ecx
+  802be3:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802bea:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802bf0:	83 f9 01             	cmp    $0x1,%ecx
+  802bf3:	75 c5                	jne    802bba <nfu_with_aging_page_choice_func+0x2c>
+  802bf5:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802bfa:	77 be                	ja     802bba <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802bfc:	89 c1                	mov    %eax,%ecx
+  802bfe:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802c01:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802c07:	0f 82 a5 00 00 00    	jb     802cb2 <nfu_with_aging_page_choice_func+0x124>
+  802c0d:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802c13:	0f 87 99 00 00 00    	ja     802cb2 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802c19:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802c20:	f6 c1 01             	test   $0x1,%cl
+  802c23:	0f 84 89 00 00 00    	je     802cb2 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802c29:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802c30:	f6 c5 04             	test   $0x4,%ch
+  802c33:	75 7d                	jne    802cb2 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802c35:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802c3c:	f6 c5 02             	test   $0x2,%ch
+  802c3f:	75 71                	jne    802cb2 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802c41:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802c48:	c1 e9 0c             	shr    $0xc,%ecx
+  802c4b:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802c4e:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802c54:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802c58:	66 83 f9 01          	cmp    $0x1,%cx
+  802c5c:	77 54                	ja     802cb2 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802c5e:	89 f9                	mov    %edi,%ecx
+  802c60:	80 f9 ff             	cmp    $0xff,%cl
+  802c63:	74 21                	je     802c86 <nfu_with_aging_page_choice_func+0xf8>
+  802c65:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802c6c:	c1 e9 0c             	shr    $0xc,%ecx
+  802c6f:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802c72:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802c78:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802c7c:	89 fb                	mov    %edi,%ebx
+  802c7e:	38 d9                	cmp    %bl,%cl
+  802c80:	73 30                	jae    802cb2 <nfu_with_aging_page_choice_func+0x124>
+  802c82:	dd d8                	fstp   %st(0)
+  802c84:	eb 02                	jmp    802c88 <nfu_with_aging_page_choice_func+0xfa>
+  802c86:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802c88:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802c8f:	c1 e9 0c             	shr    $0xc,%ecx
+  802c92:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802c95:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802c9c:	89 fb                	mov    %edi,%ebx
+  802c9e:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802ca1:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802ca4:	db 45 e0             	fildl  -0x20(%ebp)
+  802ca7:	d8 35 80 5d 80 00    	fdivs  0x805d80
+	return ret*ret;
+  802cad:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802caf:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802cb2:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802cb5:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802cb8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802cbf:	df 6d e0             	fildll -0x20(%ebp)
+  802cc2:	d9 c1                	fld    %st(1)
+  802cc4:	d8 0d 84 5d 80 00    	fmuls  0x805d84
+  802cca:	d9 c9                	fxch   %st(1)
+  802ccc:	df f1                	fcomip %st(1),%st
+  802cce:	dd d8                	fstp   %st(0)
+  802cd0:	0f 82 ed fe ff ff    	jb     802bc3 <nfu_with_aging_page_choice_func+0x35>
+  802cd6:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802cd8:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  802cdd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802ce0:	c1 e0 0c             	shl    $0xc,%eax
+  802ce3:	eb 0e                	jmp    802cf3 <nfu_with_aging_page_choice_func+0x165>
+  802ce5:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802ce7:	89 f8                	mov    %edi,%eax
+  802ce9:	3c ff                	cmp    $0xff,%al
+  802ceb:	74 0e                	je     802cfb <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802ced:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802cf0:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802cf3:	83 c4 14             	add    $0x14,%esp
+  802cf6:	5b                   	pop    %ebx
+  802cf7:	5e                   	pop    %esi
+  802cf8:	5f                   	pop    %edi
+  802cf9:	5d                   	pop    %ebp
+  802cfa:	c3                   	ret
+	pgnum = 0;
+  802cfb:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  802d02:	00 00 00 
+	return (void*)UTOP;
+  802d05:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802d0a:	eb e7                	jmp    802cf3 <nfu_with_aging_page_choice_func+0x165>
+
+00802d0c <myRand>:
+    state = state * 1664525 + 1013904223;
+  802d0c:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  802d13:	66 19 00 
+  802d16:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802d1b:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  802d20:	c1 e8 18             	shr    $0x18,%eax
+}
+  802d23:	c3                   	ret
+
+00802d24 <random_page_choice_func>:
+{
+  802d24:	55                   	push   %ebp
+  802d25:	89 e5                	mov    %esp,%ebp
+  802d27:	57                   	push   %edi
+  802d28:	56                   	push   %esi
+  802d29:	53                   	push   %ebx
+  802d2a:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802d2d:	be 00 00 00 00       	mov    $0x0,%esi
+  802d32:	eb 19                	jmp    802d4d <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802d34:	f7 d3                	not    %ebx
+  802d36:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802d3c:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802d3e:	83 c6 01             	add    $0x1,%esi
+  802d41:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802d47:	0f 87 a0 00 00 00    	ja     802ded <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d4d:	89 f3                	mov    %esi,%ebx
+  802d4f:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  802d55:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802d5b:	89 d8                	mov    %ebx,%eax
+  802d5d:	c1 e8 0a             	shr    $0xa,%eax
+  802d60:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802d67:	25 81 00 00 00       	and    $0x81,%eax
+  802d6c:	83 f8 01             	cmp    $0x1,%eax
+  802d6f:	75 c3                	jne    802d34 <random_page_choice_func+0x10>
+  802d71:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802d77:	77 bb                	ja     802d34 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802d79:	89 df                	mov    %ebx,%edi
+  802d7b:	c1 e7 0c             	shl    $0xc,%edi
+  802d7e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802d81:	89 f8                	mov    %edi,%eax
+  802d83:	e8 06 f9 ff ff       	call   80268e <page_is_clean>
+  802d88:	84 c0                	test   %al,%al
+  802d8a:	0f 85 82 00 00 00    	jne    802e12 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802d90:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  802d96:	72 a6                	jb     802d3e <random_page_choice_func+0x1a>
+  802d98:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802d9e:	77 9e                	ja     802d3e <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802da0:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802da7:	a8 01                	test   $0x1,%al
+  802da9:	74 93                	je     802d3e <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802dab:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802db2:	f6 c4 04             	test   $0x4,%ah
+  802db5:	75 87                	jne    802d3e <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802db7:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802dbe:	f6 c4 02             	test   $0x2,%ah
+  802dc1:	0f 85 77 ff ff ff    	jne    802d3e <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802dc7:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802dce:	c1 e8 0c             	shr    $0xc,%eax
+  802dd1:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802dd4:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802dd9:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802ddd:	66 83 f8 01          	cmp    $0x1,%ax
+  802de1:	0f 87 57 ff ff ff    	ja     802d3e <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  802de7:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802ded:	e8 1a ff ff ff       	call   802d0c <myRand>
+  802df2:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  802df8:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  802dfd:	29 fe                	sub    %edi,%esi
+  802dff:	0f be c0             	movsbl %al,%eax
+  802e02:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e07:	f7 f6                	div    %esi
+  802e09:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802e0b:	bb 15 00 00 00       	mov    $0x15,%ebx
+  802e10:	eb 1c                	jmp    802e2e <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  802e12:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  802e18:	e9 8f 00 00 00       	jmp    802eac <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802e1d:	e8 ea fe ff ff       	call   802d0c <myRand>
+  802e22:	0f be c0             	movsbl %al,%eax
+  802e25:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e2a:	f7 f6                	div    %esi
+  802e2c:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802e2e:	83 eb 01             	sub    $0x1,%ebx
+  802e31:	0f 84 c2 00 00 00    	je     802ef9 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  802e37:	89 d0                	mov    %edx,%eax
+  802e39:	c1 e8 0a             	shr    $0xa,%eax
+  802e3c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802e43:	25 81 00 00 00       	and    $0x81,%eax
+  802e48:	83 f8 01             	cmp    $0x1,%eax
+  802e4b:	75 d0                	jne    802e1d <random_page_choice_func+0xf9>
+  802e4d:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  802e53:	77 c8                	ja     802e1d <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  802e55:	89 d0                	mov    %edx,%eax
+  802e57:	c1 e0 0c             	shl    $0xc,%eax
+  802e5a:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  802e5f:	72 56                	jb     802eb7 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802e61:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  802e66:	77 65                	ja     802ecd <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802e68:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802e6f:	f6 c1 01             	test   $0x1,%cl
+  802e72:	74 59                	je     802ecd <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802e74:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802e7b:	f6 c5 04             	test   $0x4,%ch
+  802e7e:	75 4d                	jne    802ecd <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  802e80:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802e87:	f6 c5 02             	test   $0x2,%ch
+  802e8a:	75 41                	jne    802ecd <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  802e8c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802e93:	c1 ea 0c             	shr    $0xc,%edx
+  802e96:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  802e99:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  802e9f:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  802ea3:	66 83 fa 01          	cmp    $0x1,%dx
+  802ea7:	77 3a                	ja     802ee3 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  802ea9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  802eac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802eaf:	83 c4 1c             	add    $0x1c,%esp
+  802eb2:	5b                   	pop    %ebx
+  802eb3:	5e                   	pop    %esi
+  802eb4:	5f                   	pop    %edi
+  802eb5:	5d                   	pop    %ebp
+  802eb6:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802eb7:	e8 50 fe ff ff       	call   802d0c <myRand>
+  802ebc:	0f be c0             	movsbl %al,%eax
+  802ebf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ec4:	f7 f6                	div    %esi
+  802ec6:	01 fa                	add    %edi,%edx
+			continue;
+  802ec8:	e9 61 ff ff ff       	jmp    802e2e <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802ecd:	e8 3a fe ff ff       	call   802d0c <myRand>
+  802ed2:	0f be c0             	movsbl %al,%eax
+  802ed5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eda:	f7 f6                	div    %esi
+  802edc:	01 fa                	add    %edi,%edx
+			continue;
+  802ede:	e9 4b ff ff ff       	jmp    802e2e <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802ee3:	e8 24 fe ff ff       	call   802d0c <myRand>
+  802ee8:	0f be c0             	movsbl %al,%eax
+  802eeb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ef0:	f7 f6                	div    %esi
+  802ef2:	01 fa                	add    %edi,%edx
+			continue;
+  802ef4:	e9 35 ff ff ff       	jmp    802e2e <random_page_choice_func+0x10a>
+	pgnum = 0;
+  802ef9:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  802f00:	00 00 00 
+	return (void*)UTOP;
+  802f03:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  802f0a:	eb a0                	jmp    802eac <random_page_choice_func+0x188>
+
+00802f0c <nfu>:
+{
+  802f0c:	55                   	push   %ebp
+  802f0d:	89 e5                	mov    %esp,%ebp
+  802f0f:	57                   	push   %edi
+  802f10:	56                   	push   %esi
+  802f11:	53                   	push   %ebx
+  802f12:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802f15:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  802f1b:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802f1d:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802f22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f27:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802f2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f33:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802f36:	eb 18                	jmp    802f50 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802f38:	f7 d0                	not    %eax
+  802f3a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f3f:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802f41:	83 c2 01             	add    $0x1,%edx
+  802f44:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802f4a:	0f 87 13 01 00 00    	ja     803063 <nfu+0x157>
+		++num_searched_ptes;
+  802f50:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802f54:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802f57:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802f5c:	89 c1                	mov    %eax,%ecx
+  802f5e:	c1 e9 0a             	shr    $0xa,%ecx
+  802f61:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802f68:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802f6e:	83 f9 01             	cmp    $0x1,%ecx
+  802f71:	75 c5                	jne    802f38 <nfu+0x2c>
+  802f73:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802f78:	77 be                	ja     802f38 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802f7a:	89 c1                	mov    %eax,%ecx
+  802f7c:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f7f:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802f85:	0f 82 a5 00 00 00    	jb     803030 <nfu+0x124>
+  802f8b:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802f91:	0f 87 99 00 00 00    	ja     803030 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802f97:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f9e:	f6 c1 01             	test   $0x1,%cl
+  802fa1:	0f 84 89 00 00 00    	je     803030 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802fa7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802fae:	f6 c5 04             	test   $0x4,%ch
+  802fb1:	75 7d                	jne    803030 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802fb3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802fba:	f6 c5 02             	test   $0x2,%ch
+  802fbd:	75 71                	jne    803030 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802fbf:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802fc6:	c1 e9 0c             	shr    $0xc,%ecx
+  802fc9:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802fcc:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802fd2:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802fd6:	66 83 f9 01          	cmp    $0x1,%cx
+  802fda:	77 54                	ja     803030 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  802fdc:	89 f9                	mov    %edi,%ecx
+  802fde:	80 f9 ff             	cmp    $0xff,%cl
+  802fe1:	74 21                	je     803004 <nfu+0xf8>
+  802fe3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802fea:	c1 e9 0c             	shr    $0xc,%ecx
+  802fed:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802ff0:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802ff6:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  802ffa:	89 fb                	mov    %edi,%ebx
+  802ffc:	38 d9                	cmp    %bl,%cl
+  802ffe:	73 30                	jae    803030 <nfu+0x124>
+  803000:	dd d8                	fstp   %st(0)
+  803002:	eb 02                	jmp    803006 <nfu+0xfa>
+  803004:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  803006:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80300d:	c1 e9 0c             	shr    $0xc,%ecx
+  803010:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803013:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  80301a:	89 fb                	mov    %edi,%ebx
+  80301c:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  80301f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803022:	db 45 e0             	fildl  -0x20(%ebp)
+  803025:	d8 35 80 5d 80 00    	fdivs  0x805d80
+	return ret*ret;
+  80302b:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80302d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803030:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  803033:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803036:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80303d:	df 6d e0             	fildll -0x20(%ebp)
+  803040:	d9 c1                	fld    %st(1)
+  803042:	d8 0d 84 5d 80 00    	fmuls  0x805d84
+  803048:	d9 c9                	fxch   %st(1)
+  80304a:	df f1                	fcomip %st(1),%st
+  80304c:	dd d8                	fstp   %st(0)
+  80304e:	0f 82 ed fe ff ff    	jb     802f41 <nfu+0x35>
+  803054:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  803056:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  80305b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80305e:	c1 e0 0c             	shl    $0xc,%eax
+  803061:	eb 0e                	jmp    803071 <nfu+0x165>
+  803063:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  803065:	89 f8                	mov    %edi,%eax
+  803067:	3c ff                	cmp    $0xff,%al
+  803069:	74 0e                	je     803079 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  80306b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80306e:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803071:	83 c4 14             	add    $0x14,%esp
+  803074:	5b                   	pop    %ebx
+  803075:	5e                   	pop    %esi
+  803076:	5f                   	pop    %edi
+  803077:	5d                   	pop    %ebp
+  803078:	c3                   	ret
+	pgnum = 0;
+  803079:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  803080:	00 00 00 
+	return (void*)UTOP;
+  803083:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803088:	eb e7                	jmp    803071 <nfu+0x165>
+
+0080308a <lru>:
+{
+  80308a:	55                   	push   %ebp
+  80308b:	89 e5                	mov    %esp,%ebp
+  80308d:	57                   	push   %edi
+  80308e:	56                   	push   %esi
+  80308f:	53                   	push   %ebx
+  803090:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803093:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  803099:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  8030a0:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8030a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8030ac:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8030b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030b8:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  8030bb:	eb 18                	jmp    8030d5 <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8030bd:	f7 d0                	not    %eax
+  8030bf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030c4:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8030c6:	83 c2 01             	add    $0x1,%edx
+  8030c9:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  8030cf:	0f 87 fa 00 00 00    	ja     8031cf <lru+0x145>
+		++num_searched_ptes;
+  8030d5:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8030d8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8030db:	01 d0                	add    %edx,%eax
+  8030dd:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8030e2:	89 c1                	mov    %eax,%ecx
+  8030e4:	c1 e9 0a             	shr    $0xa,%ecx
+  8030e7:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8030ee:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8030f4:	83 f9 01             	cmp    $0x1,%ecx
+  8030f7:	75 c4                	jne    8030bd <lru+0x33>
+  8030f9:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8030fe:	77 bd                	ja     8030bd <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803100:	89 c1                	mov    %eax,%ecx
+  803102:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803105:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  80310b:	0f 87 92 00 00 00    	ja     8031a3 <lru+0x119>
+  803111:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  803117:	0f 82 86 00 00 00    	jb     8031a3 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80311d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803124:	f6 c1 01             	test   $0x1,%cl
+  803127:	74 7a                	je     8031a3 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803129:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803130:	f6 c5 04             	test   $0x4,%ch
+  803133:	75 6e                	jne    8031a3 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803135:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80313c:	f6 c5 02             	test   $0x2,%ch
+  80313f:	75 62                	jne    8031a3 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803141:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803148:	c1 e9 0c             	shr    $0xc,%ecx
+  80314b:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80314e:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803154:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803158:	66 83 f9 01          	cmp    $0x1,%cx
+  80315c:	77 45                	ja     8031a3 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  80315e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803165:	c1 e9 0c             	shr    $0xc,%ecx
+  803168:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80316b:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803171:	8b 59 14             	mov    0x14(%ecx),%ebx
+  803174:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803177:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  80317a:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80317d:	19 df                	sbb    %ebx,%edi
+  80317f:	7c 22                	jl     8031a3 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  803181:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803188:	c1 e9 0c             	shr    $0xc,%ecx
+  80318b:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80318e:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803194:	8b 59 14             	mov    0x14(%ecx),%ebx
+  803197:	8b 49 10             	mov    0x10(%ecx),%ecx
+  80319a:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  80319d:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8031a0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8031a3:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8031a6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8031ad:	df 6d e0             	fildll -0x20(%ebp)
+  8031b0:	d9 05 84 5d 80 00    	flds   0x805d84
+  8031b6:	d9 c9                	fxch   %st(1)
+  8031b8:	df f1                	fcomip %st(1),%st
+  8031ba:	dd d8                	fstp   %st(0)
+  8031bc:	0f 82 04 ff ff ff    	jb     8030c6 <lru+0x3c>
+			pgnum = pgnum_actual;
+  8031c2:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  8031c7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8031ca:	c1 e0 0c             	shl    $0xc,%eax
+  8031cd:	eb 06                	jmp    8031d5 <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  8031cf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8031d2:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8031d5:	83 c4 1c             	add    $0x1c,%esp
+  8031d8:	5b                   	pop    %ebx
+  8031d9:	5e                   	pop    %esi
+  8031da:	5f                   	pop    %edi
+  8031db:	5d                   	pop    %ebp
+  8031dc:	c3                   	ret
+
+008031dd <set_page_choice_func>:
+{
+  8031dd:	55                   	push   %ebp
+  8031de:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  8031e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031e3:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  8031e8:	5d                   	pop    %ebp
+  8031e9:	c3                   	ret
+
+008031ea <get_page_choice>:
+{
+  8031ea:	55                   	push   %ebp
+  8031eb:	89 e5                	mov    %esp,%ebp
+  8031ed:	57                   	push   %edi
+  8031ee:	56                   	push   %esi
+  8031ef:	53                   	push   %ebx
+  8031f0:	83 ec 24             	sub    $0x24,%esp
+  8031f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8031f6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  8031f9:	57                   	push   %edi
+  8031fa:	56                   	push   %esi
+  8031fb:	ff 15 3c 60 80 00    	call   *0x80603c
+  803201:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803203:	83 c4 10             	add    $0x10,%esp
+  803206:	eb 25                	jmp    80322d <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  803208:	83 ec 08             	sub    $0x8,%esp
+  80320b:	c1 e0 16             	shl    $0x16,%eax
+  80320e:	50                   	push   %eax
+  80320f:	6a 00                	push   $0x0
+  803211:	e8 38 db ff ff       	call   800d4e <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803216:	83 c4 10             	add    $0x10,%esp
+  803219:	85 c0                	test   %eax,%eax
+  80321b:	75 43                	jne    803260 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  80321d:	83 ec 08             	sub    $0x8,%esp
+  803220:	57                   	push   %edi
+  803221:	56                   	push   %esi
+  803222:	ff 15 3c 60 80 00    	call   *0x80603c
+  803228:	89 c3                	mov    %eax,%ebx
+  80322a:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80322d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  803230:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803236:	0f 86 ae 00 00 00    	jbe    8032ea <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80323c:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  803241:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803248:	81 e2 81 00 00 00    	and    $0x81,%edx
+  80324e:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  803254:	74 b2                	je     803208 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803256:	83 c0 01             	add    $0x1,%eax
+  803259:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  80325e:	75 e1                	jne    803241 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803260:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803263:	05 00 10 40 11       	add    $0x11401000,%eax
+  803268:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80326d:	76 1f                	jbe    80328e <get_page_choice+0xa4>
+		return (void *) UTOP;
+  80326f:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  803274:	89 d8                	mov    %ebx,%eax
+  803276:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803279:	5b                   	pop    %ebx
+  80327a:	5e                   	pop    %esi
+  80327b:	5f                   	pop    %edi
+  80327c:	5d                   	pop    %ebp
+  80327d:	c3                   	ret
+		sys_page_split(0, pg_out);
+  80327e:	83 ec 08             	sub    $0x8,%esp
+  803281:	53                   	push   %ebx
+  803282:	6a 00                	push   $0x0
+  803284:	e8 c5 da ff ff       	call   800d4e <sys_page_split>
+  803289:	83 c4 10             	add    $0x10,%esp
+  80328c:	eb 6c                	jmp    8032fa <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  80328e:	83 ec 04             	sub    $0x4,%esp
+  803291:	68 2c 59 80 00       	push   $0x80592c
+  803296:	68 cc 01 00 00       	push   $0x1cc
+  80329b:	68 9a 58 80 00       	push   $0x80589a
+  8032a0:	e8 c8 19 00 00       	call   804c6d <_panic>
+		panic("We tried to page out code pages\n");
+  8032a5:	83 ec 04             	sub    $0x4,%esp
+  8032a8:	68 5c 59 80 00       	push   $0x80595c
+  8032ad:	68 d6 01 00 00       	push   $0x1d6
+  8032b2:	68 9a 58 80 00       	push   $0x80589a
+  8032b7:	e8 b1 19 00 00       	call   804c6d <_panic>
+		panic("Invalid mapping for the va\n");
+  8032bc:	83 ec 04             	sub    $0x4,%esp
+  8032bf:	68 a7 58 80 00       	push   $0x8058a7
+  8032c4:	68 da 01 00 00       	push   $0x1da
+  8032c9:	68 9a 58 80 00       	push   $0x80589a
+  8032ce:	e8 9a 19 00 00       	call   804c6d <_panic>
+		panic("We tried to page out a shared page\n");
+  8032d3:	83 ec 04             	sub    $0x4,%esp
+  8032d6:	68 80 59 80 00       	push   $0x805980
+  8032db:	68 e0 01 00 00       	push   $0x1e0
+  8032e0:	68 9a 58 80 00       	push   $0x80589a
+  8032e5:	e8 83 19 00 00       	call   804c6d <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  8032ea:	89 de                	mov    %ebx,%esi
+  8032ec:	c1 ee 16             	shr    $0x16,%esi
+  8032ef:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8032f6:	a8 80                	test   $0x80,%al
+  8032f8:	75 84                	jne    80327e <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  8032fa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032fd:	05 00 10 40 11       	add    $0x11401000,%eax
+  803302:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803307:	76 85                	jbe    80328e <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  803309:	89 d8                	mov    %ebx,%eax
+  80330b:	e8 7e f3 ff ff       	call   80268e <page_is_clean>
+  803310:	84 c0                	test   %al,%al
+  803312:	0f 85 5c ff ff ff    	jne    803274 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  803318:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  80331f:	76 84                	jbe    8032a5 <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  803321:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803328:	a8 01                	test   $0x1,%al
+  80332a:	74 90                	je     8032bc <get_page_choice+0xd2>
+  80332c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80332f:	c1 e8 0c             	shr    $0xc,%eax
+  803332:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803339:	f6 c2 01             	test   $0x1,%dl
+  80333c:	0f 84 7a ff ff ff    	je     8032bc <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803342:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  803349:	f6 c2 01             	test   $0x1,%dl
+  80334c:	74 85                	je     8032d3 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  80334e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803355:	f6 c2 01             	test   $0x1,%dl
+  803358:	0f 84 75 ff ff ff    	je     8032d3 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  80335e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803365:	f6 c6 04             	test   $0x4,%dh
+  803368:	0f 85 65 ff ff ff    	jne    8032d3 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  80336e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  803375:	f6 c6 02             	test   $0x2,%dh
+  803378:	0f 85 55 ff ff ff    	jne    8032d3 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  80337e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803385:	c1 e8 0c             	shr    $0xc,%eax
+  803388:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80338b:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803390:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  803394:	66 83 f8 01          	cmp    $0x1,%ax
+  803398:	0f 86 d6 fe ff ff    	jbe    803274 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  80339e:	83 ec 04             	sub    $0x4,%esp
+  8033a1:	68 a4 59 80 00       	push   $0x8059a4
+  8033a6:	68 e2 01 00 00       	push   $0x1e2
+  8033ab:	68 9a 58 80 00       	push   $0x80589a
+  8033b0:	e8 b8 18 00 00       	call   804c6d <_panic>
+
+008033b5 <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  8033b5:	55                   	push   %ebp
+  8033b6:	89 e5                	mov    %esp,%ebp
+  8033b8:	57                   	push   %edi
+  8033b9:	56                   	push   %esi
+  8033ba:	53                   	push   %ebx
+  8033bb:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  8033be:	e8 e8 f6 ff ff       	call   802aab <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  8033c3:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  8033c8:	85 c0                	test   %eax,%eax
+  8033ca:	74 41                	je     80340d <page_share_paged_out+0x58>
+  8033cc:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  8033d3:	0f 84 fd 00 00 00    	je     8034d6 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  8033d9:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  8033e0:	00 00 00 
+  8033e3:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  8033ea:	00 00 00 
+  8033ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033f2:	eb 2c                	jmp    803420 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8033f4:	83 c3 04             	add    $0x4,%ebx
+  8033f7:	39 f3                	cmp    %esi,%ebx
+  8033f9:	74 1a                	je     803415 <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  8033fb:	8b 03                	mov    (%ebx),%eax
+  8033fd:	a8 01                	test   $0x1,%al
+  8033ff:	74 f3                	je     8033f4 <page_share_paged_out+0x3f>
+  803401:	c1 e8 0c             	shr    $0xc,%eax
+  803404:	e8 2b f5 ff ff       	call   802934 <page_share_slot>
+  803409:	85 c0                	test   %eax,%eax
+  80340b:	79 e7                	jns    8033f4 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  80340d:	83 c4 0c             	add    $0xc,%esp
+  803410:	5b                   	pop    %ebx
+  803411:	5e                   	pop    %esi
+  803412:	5f                   	pop    %edi
+  803413:	5d                   	pop    %ebp
+  803414:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  803415:	83 c7 04             	add    $0x4,%edi
+  803418:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  80341e:	74 1b                	je     80343b <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  803420:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803425:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  803428:	f6 c3 01             	test   $0x1,%bl
+  80342b:	74 e8                	je     803415 <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  80342d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803433:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  803439:	eb bc                	jmp    8033f7 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80343b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803440:	eb 11                	jmp    803453 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  803442:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803448:	83 c3 01             	add    $0x1,%ebx
+  80344b:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803451:	77 41                	ja     803494 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  803453:	89 d8                	mov    %ebx,%eax
+  803455:	c1 e8 0a             	shr    $0xa,%eax
+  803458:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80345f:	25 81 00 00 00       	and    $0x81,%eax
+  803464:	83 f8 01             	cmp    $0x1,%eax
+  803467:	75 d9                	jne    803442 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803469:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803470:	25 81 00 00 00       	and    $0x81,%eax
+  803475:	3d 80 00 00 00       	cmp    $0x80,%eax
+  80347a:	75 cc                	jne    803448 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  80347c:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803483:	c1 e8 0c             	shr    $0xc,%eax
+  803486:	e8 a9 f4 ff ff       	call   802934 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  80348b:	85 c0                	test   %eax,%eax
+  80348d:	79 b9                	jns    803448 <page_share_paged_out+0x93>
+  80348f:	e9 79 ff ff ff       	jmp    80340d <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803494:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80349b:	75 13                	jne    8034b0 <page_share_paged_out+0xfb>
+  80349d:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8034a4:	75 1d                	jne    8034c3 <page_share_paged_out+0x10e>
+	return 0;
+  8034a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ab:	e9 5d ff ff ff       	jmp    80340d <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8034b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b5:	e8 46 f4 ff ff       	call   802900 <page_share_send>
+  8034ba:	85 c0                	test   %eax,%eax
+  8034bc:	79 df                	jns    80349d <page_share_paged_out+0xe8>
+  8034be:	e9 4a ff ff ff       	jmp    80340d <page_share_paged_out+0x58>
+  8034c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034c8:	e8 33 f4 ff ff       	call   802900 <page_share_send>
+  8034cd:	85 c0                	test   %eax,%eax
+  8034cf:	79 d5                	jns    8034a6 <page_share_paged_out+0xf1>
+  8034d1:	e9 37 ff ff ff       	jmp    80340d <page_share_paged_out+0x58>
+		return 0;
+  8034d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034db:	e9 2d ff ff ff       	jmp    80340d <page_share_paged_out+0x58>
+
+008034e0 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  8034e0:	55                   	push   %ebp
+  8034e1:	89 e5                	mov    %esp,%ebp
+  8034e3:	56                   	push   %esi
+  8034e4:	53                   	push   %ebx
+  8034e5:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  8034e8:	e8 be f5 ff ff       	call   802aab <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  8034ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  8034f2:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8034f9:	0f 84 82 00 00 00    	je     803581 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  8034ff:	83 ec 0c             	sub    $0xc,%esp
+  803502:	68 00 10 00 00       	push   $0x1000
+  803507:	e8 84 11 00 00       	call   804690 <malloc>
+  80350c:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  80350e:	83 c4 0c             	add    $0xc,%esp
+  803511:	6a 14                	push   $0x14
+  803513:	6a 00                	push   $0x0
+  803515:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803518:	50                   	push   %eax
+  803519:	e8 c7 d3 ff ff       	call   8008e5 <memset>
+  80351e:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  803521:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  803526:	83 ec 0c             	sub    $0xc,%esp
+  803529:	6a 07                	push   $0x7
+  80352b:	6a 01                	push   $0x1
+  80352d:	53                   	push   %ebx
+  80352e:	6a 03                	push   $0x3
+  803530:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803537:	e8 fd 19 00 00       	call   804f39 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  80353c:	8b 03                	mov    (%ebx),%eax
+  80353e:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803541:	8b 43 04             	mov    0x4(%ebx),%eax
+  803544:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  803547:	8b 43 08             	mov    0x8(%ebx),%eax
+  80354a:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  80354d:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803550:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  803553:	8b 43 10             	mov    0x10(%ebx),%eax
+  803556:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803559:	83 c6 01             	add    $0x1,%esi
+  80355c:	83 c4 20             	add    $0x20,%esp
+  80355f:	83 fe 02             	cmp    $0x2,%esi
+  803562:	75 c2                	jne    803526 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  803564:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803567:	89 03                	mov    %eax,(%ebx)
+  803569:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80356c:	89 43 04             	mov    %eax,0x4(%ebx)
+  80356f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803572:	89 43 08             	mov    %eax,0x8(%ebx)
+  803575:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803578:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80357b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80357e:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  803581:	89 d8                	mov    %ebx,%eax
+  803583:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803586:	5b                   	pop    %ebx
+  803587:	5e                   	pop    %esi
+  803588:	5d                   	pop    %ebp
+  803589:	c3                   	ret
+
+0080358a <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  80358a:	55                   	push   %ebp
+  80358b:	89 e5                	mov    %esp,%ebp
+  80358d:	53                   	push   %ebx
+  80358e:	83 ec 10             	sub    $0x10,%esp
+  803591:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  803594:	68 34 53 80 00       	push   $0x805334
+  803599:	e8 0f cc ff ff       	call   8001ad <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  80359e:	83 c4 08             	add    $0x8,%esp
+  8035a1:	ff 33                	push   (%ebx)
+  8035a3:	68 d8 59 80 00       	push   $0x8059d8
+  8035a8:	e8 00 cc ff ff       	call   8001ad <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  8035ad:	83 c4 08             	add    $0x8,%esp
+  8035b0:	ff 73 04             	push   0x4(%ebx)
+  8035b3:	68 c3 58 80 00       	push   $0x8058c3
+  8035b8:	e8 f0 cb ff ff       	call   8001ad <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  8035bd:	83 c4 08             	add    $0x8,%esp
+  8035c0:	ff 73 08             	push   0x8(%ebx)
+  8035c3:	68 f8 59 80 00       	push   $0x8059f8
+  8035c8:	e8 e0 cb ff ff       	call   8001ad <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  8035cd:	83 c4 08             	add    $0x8,%esp
+  8035d0:	ff 73 0c             	push   0xc(%ebx)
+  8035d3:	68 1c 5a 80 00       	push   $0x805a1c
+  8035d8:	e8 d0 cb ff ff       	call   8001ad <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  8035dd:	83 c4 08             	add    $0x8,%esp
+  8035e0:	ff 73 10             	push   0x10(%ebx)
+  8035e3:	68 40 5a 80 00       	push   $0x805a40
+  8035e8:	e8 c0 cb ff ff       	call   8001ad <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  8035ed:	83 c4 08             	add    $0x8,%esp
+  8035f0:	ff 35 08 b0 80 00    	push   0x80b008
+  8035f6:	68 7c 5a 80 00       	push   $0x805a7c
+  8035fb:	e8 ad cb ff ff       	call   8001ad <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  803600:	83 c4 08             	add    $0x8,%esp
+  803603:	ff 35 04 b0 80 00    	push   0x80b004
+  803609:	68 b0 5a 80 00       	push   $0x805ab0
+  80360e:	e8 9a cb ff ff       	call   8001ad <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  803613:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803618:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  80361b:	8b 50 68             	mov    0x68(%eax),%edx
+  80361e:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  803621:	51                   	push   %ecx
+  803622:	52                   	push   %edx
+  803623:	50                   	push   %eax
+  803624:	68 f0 5a 80 00       	push   $0x805af0
+  803629:	e8 7f cb ff ff       	call   8001ad <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  80362e:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803633:	8b 40 70             	mov    0x70(%eax),%eax
+  803636:	83 c4 18             	add    $0x18,%esp
+  803639:	50                   	push   %eax
+  80363a:	68 24 5b 80 00       	push   $0x805b24
+  80363f:	e8 69 cb ff ff       	call   8001ad <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  803644:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  80364a:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803650:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  803655:	51                   	push   %ecx
+  803656:	52                   	push   %edx
+  803657:	50                   	push   %eax
+  803658:	68 54 5b 80 00       	push   $0x805b54
+  80365d:	e8 4b cb ff ff       	call   8001ad <cprintf>
+	cprintf("\n");
+  803662:	83 c4 14             	add    $0x14,%esp
+  803665:	68 34 53 80 00       	push   $0x805334
+  80366a:	e8 3e cb ff ff       	call   8001ad <cprintf>
+}
+  80366f:	83 c4 10             	add    $0x10,%esp
+  803672:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803675:	c9                   	leave
+  803676:	c3                   	ret
+
+00803677 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  803677:	55                   	push   %ebp
+  803678:	89 e5                	mov    %esp,%ebp
+  80367a:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  80367d:	e8 5e fe ff ff       	call   8034e0 <get_paging_stats>
+  803682:	83 ec 0c             	sub    $0xc,%esp
+  803685:	50                   	push   %eax
+  803686:	e8 ff fe ff ff       	call   80358a <print_paging_stats>
+}
+  80368b:	83 c4 10             	add    $0x10,%esp
+  80368e:	c9                   	leave
+  80368f:	c3                   	ret
+
+00803690 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803690:	55                   	push   %ebp
+  803691:	89 e5                	mov    %esp,%ebp
+  803693:	53                   	push   %ebx
+  803694:	83 ec 04             	sub    $0x4,%esp
+  803697:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  80369a:	eb 13                	jmp    8036af <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  80369c:	83 ec 04             	sub    $0x4,%esp
+  80369f:	6a ff                	push   $0xffffffff
+  8036a1:	53                   	push   %ebx
+  8036a2:	68 00 f0 ff ee       	push   $0xeefff000
+  8036a7:	e8 b4 da ff ff       	call   801160 <sys_futex_wait>
+  8036ac:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  8036af:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  8036b4:	39 d8                	cmp    %ebx,%eax
+  8036b6:	74 e4                	je     80369c <mem_pressure_wait+0xc>
+	return now;
+}
+  8036b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036bb:	c9                   	leave
+  8036bc:	c3                   	ret
+
+008036bd <init_map_dir>:
+
+void
+init_map_dir()
+{
+  8036bd:	55                   	push   %ebp
+  8036be:	89 e5                	mov    %esp,%ebp
+  8036c0:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  8036c3:	68 2f 43 80 00       	push   $0x80432f
+  8036c8:	e8 78 16 00 00       	call   804d45 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  8036cd:	c7 05 14 e9 80 00 00 	movl   $0xdeadb000,0x80e914
+  8036d4:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  8036d7:	83 c4 0c             	add    $0xc,%esp
+  8036da:	68 07 02 00 00       	push   $0x207
+  8036df:	68 00 b0 ad de       	push   $0xdeadb000
+  8036e4:	6a 00                	push   $0x0
+  8036e6:	e8 9c d5 ff ff       	call   800c87 <sys_page_alloc>
+  8036eb:	83 c4 10             	add    $0x10,%esp
+  8036ee:	85 c0                	test   %eax,%eax
+  8036f0:	78 0c                	js     8036fe <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  8036f2:	e8 b4 f3 ff ff       	call   802aab <find_paging_env>
+	page_ring_ready();
+  8036f7:	e8 7f f2 ff ff       	call   80297b <page_ring_ready>
+}
+  8036fc:	c9                   	leave
+  8036fd:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  8036fe:	50                   	push   %eax
+  8036ff:	68 e1 58 80 00       	push   $0x8058e1
+  803704:	68 13 05 00 00       	push   $0x513
+  803709:	68 9a 58 80 00       	push   $0x80589a
+  80370e:	e8 5a 15 00 00       	call   804c6d <_panic>
+
+00803713 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  803713:	55                   	push   %ebp
+  803714:	89 e5                	mov    %esp,%ebp
+  803716:	57                   	push   %edi
+  803717:	56                   	push   %esi
+  803718:	53                   	push   %ebx
+  803719:	83 ec 0c             	sub    $0xc,%esp
+  80371c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  80371f:	89 fa                	mov    %edi,%edx
+  803721:	c1 ea 16             	shr    $0x16,%edx
+  803724:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  803729:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  80372c:	f6 06 01             	testb  $0x1,(%esi)
+  80372f:	75 3e                	jne    80376f <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803731:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  803736:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80373a:	74 47                	je     803783 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  80373c:	83 ec 0c             	sub    $0xc,%esp
+  80373f:	6a 01                	push   $0x1
+  803741:	e8 f2 11 00 00       	call   804938 <va_alloc>
+  803746:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  803748:	83 c4 10             	add    $0x10,%esp
+  80374b:	85 c0                	test   %eax,%eax
+  80374d:	74 34                	je     803783 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  80374f:	6a 00                	push   $0x0
+  803751:	68 07 02 00 00       	push   $0x207
+  803756:	50                   	push   %eax
+  803757:	6a 00                	push   $0x0
+  803759:	e8 df 02 00 00       	call   803a3d <page_alloc>
+  80375e:	83 c4 10             	add    $0x10,%esp
+  803761:	85 c0                	test   %eax,%eax
+  803763:	78 28                	js     80378d <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  803765:	f6 06 01             	testb  $0x1,(%esi)
+  803768:	75 38                	jne    8037a2 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  80376a:	83 cb 01             	or     $0x1,%ebx
+  80376d:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  80376f:	89 f8                	mov    %edi,%eax
+  803771:	c1 e8 0a             	shr    $0xa,%eax
+  803774:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803779:	8b 1e                	mov    (%esi),%ebx
+  80377b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803781:	01 c3                	add    %eax,%ebx
+}
+  803783:	89 d8                	mov    %ebx,%eax
+  803785:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803788:	5b                   	pop    %ebx
+  803789:	5e                   	pop    %esi
+  80378a:	5f                   	pop    %edi
+  80378b:	5d                   	pop    %ebp
+  80378c:	c3                   	ret
+			va_free(page, 1);
+  80378d:	83 ec 08             	sub    $0x8,%esp
+  803790:	6a 01                	push   $0x1
+  803792:	53                   	push   %ebx
+  803793:	e8 d8 12 00 00       	call   804a70 <va_free>
+			return NULL;
+  803798:	83 c4 10             	add    $0x10,%esp
+  80379b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037a0:	eb e1                	jmp    803783 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  8037a2:	83 ec 08             	sub    $0x8,%esp
+  8037a5:	53                   	push   %ebx
+  8037a6:	6a 00                	push   $0x0
+  8037a8:	e8 5f d5 ff ff       	call   800d0c <sys_page_unmap>
+			va_free(page, 1);
+  8037ad:	83 c4 08             	add    $0x8,%esp
+  8037b0:	6a 01                	push   $0x1
+  8037b2:	53                   	push   %ebx
+  8037b3:	e8 b8 12 00 00       	call   804a70 <va_free>
+  8037b8:	83 c4 10             	add    $0x10,%esp
+  8037bb:	eb b2                	jmp    80376f <umapdir_walk+0x5c>
+
+008037bd <page_out>:
+{
+  8037bd:	55                   	push   %ebp
+  8037be:	89 e5                	mov    %esp,%ebp
+  8037c0:	57                   	push   %edi
+  8037c1:	56                   	push   %esi
+  8037c2:	53                   	push   %ebx
+  8037c3:	83 ec 5c             	sub    $0x5c,%esp
+  8037c6:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  8037c9:	e8 dd f2 ff ff       	call   802aab <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  8037ce:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  8037d3:	85 c0                	test   %eax,%eax
+  8037d5:	74 1e                	je     8037f5 <page_out+0x38>
+  8037d7:	83 ec 0c             	sub    $0xc,%esp
+  8037da:	6a 00                	push   $0x0
+  8037dc:	6a 00                	push   $0x0
+  8037de:	6a 00                	push   $0x0
+  8037e0:	6a 08                	push   $0x8
+  8037e2:	50                   	push   %eax
+  8037e3:	e8 51 17 00 00       	call   804f39 <ipc_call>
+  8037e8:	89 c3                	mov    %eax,%ebx
+  8037ea:	83 c4 20             	add    $0x20,%esp
+  8037ed:	85 c0                	test   %eax,%eax
+  8037ef:	0f 84 ac 00 00 00    	je     8038a1 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  8037f5:	83 ec 08             	sub    $0x8,%esp
+  8037f8:	ff 75 0c             	push   0xc(%ebp)
+  8037fb:	57                   	push   %edi
+  8037fc:	e8 e9 f9 ff ff       	call   8031ea <get_page_choice>
+  803801:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  803803:	83 c4 10             	add    $0x10,%esp
+  803806:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  80380b:	0f 84 18 02 00 00    	je     803a29 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803811:	e8 78 ee ff ff       	call   80268e <page_is_clean>
+  803816:	84 c0                	test   %al,%al
+  803818:	0f 85 8c 00 00 00    	jne    8038aa <page_out+0xed>
+	if (pagingenv == 0)
+  80381e:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803825:	0f 84 08 02 00 00    	je     803a33 <page_out+0x276>
+	if (page_ring_ready())
+  80382b:	e8 4b f1 ff ff       	call   80297b <page_ring_ready>
+  803830:	89 c3                	mov    %eax,%ebx
+  803832:	85 c0                	test   %eax,%eax
+  803834:	0f 85 89 00 00 00    	jne    8038c3 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  80383a:	83 ec 0c             	sub    $0xc,%esp
+  80383d:	6a 05                	push   $0x5
+  80383f:	6a 01                	push   $0x1
+  803841:	56                   	push   %esi
+  803842:	6a 01                	push   $0x1
+  803844:	ff 35 40 b0 80 00    	push   0x80b040
+  80384a:	e8 ea 16 00 00       	call   804f39 <ipc_call>
+  80384f:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803851:	83 c4 20             	add    $0x20,%esp
+  803854:	85 c0                	test   %eax,%eax
+  803856:	0f 88 b8 01 00 00    	js     803a14 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  80385c:	89 f0                	mov    %esi,%eax
+  80385e:	c1 e8 0c             	shr    $0xc,%eax
+  803861:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803868:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  80386b:	83 ec 08             	sub    $0x8,%esp
+  80386e:	56                   	push   %esi
+  80386f:	6a 00                	push   $0x0
+  803871:	e8 96 d4 ff ff       	call   800d0c <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803876:	83 c4 08             	add    $0x8,%esp
+  803879:	6a 01                	push   $0x1
+  80387b:	56                   	push   %esi
+  80387c:	e8 92 fe ff ff       	call   803713 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803881:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803884:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  80388a:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  80388d:	09 fe                	or     %edi,%esi
+  80388f:	83 ce 01             	or     $0x1,%esi
+  803892:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803894:	83 c4 10             	add    $0x10,%esp
+}
+  803897:	89 d8                	mov    %ebx,%eax
+  803899:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80389c:	5b                   	pop    %ebx
+  80389d:	5e                   	pop    %esi
+  80389e:	5f                   	pop    %edi
+  80389f:	5d                   	pop    %ebp
+  8038a0:	c3                   	ret
+		num_page_reclaims++;
+  8038a1:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  8038a8:	eb ed                	jmp    803897 <page_out+0xda>
+		num_page_drops++;
+  8038aa:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  8038b1:	83 ec 08             	sub    $0x8,%esp
+  8038b4:	56                   	push   %esi
+  8038b5:	6a 00                	push   $0x0
+  8038b7:	e8 50 d4 ff ff       	call   800d0c <sys_page_unmap>
+  8038bc:	89 c3                	mov    %eax,%ebx
+  8038be:	83 c4 10             	add    $0x10,%esp
+  8038c1:	eb d4                	jmp    803897 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8038c3:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  8038c5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8038ca:	2d 00 10 00 00       	sub    $0x1000,%eax
+  8038cf:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  8038d2:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  8038d4:	83 c0 08             	add    $0x8,%eax
+  8038d7:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  8038da:	b8 07 00 00 00       	mov    $0x7,%eax
+  8038df:	e8 e5 ef ff ff       	call   8028c9 <page_ring_reserve>
+	first = ring->sq_tail;
+  8038e4:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8038e9:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  8038ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  8038f1:	83 ec 04             	sub    $0x4,%esp
+  8038f4:	68 00 10 00 00       	push   $0x1000
+  8038f9:	56                   	push   %esi
+  8038fa:	89 d8                	mov    %ebx,%eax
+  8038fc:	c1 e0 0c             	shl    $0xc,%eax
+  8038ff:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803904:	50                   	push   %eax
+  803905:	e8 72 d0 ff ff       	call   80097c <memcpy>
+		vas[n] = va;
+  80390a:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  80390e:	89 d9                	mov    %ebx,%ecx
+  803910:	ba 00 00 00 00       	mov    $0x0,%edx
+  803915:	b8 01 00 00 00       	mov    $0x1,%eax
+  80391a:	e8 de ee ff ff       	call   8027fd <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  80391f:	8d 43 01             	lea    0x1(%ebx),%eax
+  803922:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803925:	83 c4 10             	add    $0x10,%esp
+  803928:	83 fb 06             	cmp    $0x6,%ebx
+  80392b:	74 62                	je     80398f <page_out+0x1d2>
+  80392d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803930:	eb 15                	jmp    803947 <page_out+0x18a>
+			num_page_drops++;
+  803932:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  803939:	83 ec 08             	sub    $0x8,%esp
+  80393c:	56                   	push   %esi
+  80393d:	6a 00                	push   $0x0
+  80393f:	e8 c8 d3 ff ff       	call   800d0c <sys_page_unmap>
+  803944:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803947:	83 ec 08             	sub    $0x8,%esp
+  80394a:	53                   	push   %ebx
+  80394b:	57                   	push   %edi
+  80394c:	e8 99 f8 ff ff       	call   8031ea <get_page_choice>
+  803951:	89 c6                	mov    %eax,%esi
+  803953:	83 c4 10             	add    $0x10,%esp
+  803956:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  80395b:	74 32                	je     80398f <page_out+0x1d2>
+  80395d:	e8 2c ed ff ff       	call   80268e <page_is_clean>
+  803962:	84 c0                	test   %al,%al
+  803964:	75 cc                	jne    803932 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803966:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803969:	39 c6                	cmp    %eax,%esi
+  80396b:	72 07                	jb     803974 <page_out+0x1b7>
+  80396d:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803970:	39 c6                	cmp    %eax,%esi
+  803972:	72 1b                	jb     80398f <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803974:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803979:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  80397c:	eb 03                	jmp    803981 <page_out+0x1c4>
+  80397e:	83 c3 01             	add    $0x1,%ebx
+  803981:	39 da                	cmp    %ebx,%edx
+  803983:	0f 84 68 ff ff ff    	je     8038f1 <page_out+0x134>
+  803989:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  80398d:	75 ef                	jne    80397e <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  80398f:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803992:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803995:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803998:	e8 a6 ee ff ff       	call   802843 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  80399d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039a2:	eb 42                	jmp    8039e6 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  8039a4:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  8039a8:	89 f8                	mov    %edi,%eax
+  8039aa:	c1 e8 0c             	shr    $0xc,%eax
+  8039ad:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8039b4:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  8039b7:	83 ec 08             	sub    $0x8,%esp
+  8039ba:	57                   	push   %edi
+  8039bb:	6a 00                	push   $0x0
+  8039bd:	e8 4a d3 ff ff       	call   800d0c <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  8039c2:	83 c4 08             	add    $0x8,%esp
+  8039c5:	6a 01                	push   $0x1
+  8039c7:	57                   	push   %edi
+  8039c8:	e8 46 fd ff ff       	call   803713 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  8039cd:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  8039d0:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  8039d6:	c1 e6 0c             	shl    $0xc,%esi
+  8039d9:	09 d6                	or     %edx,%esi
+  8039db:	83 ce 01             	or     $0x1,%esi
+  8039de:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  8039e0:	83 c3 01             	add    $0x1,%ebx
+  8039e3:	83 c4 10             	add    $0x10,%esp
+  8039e6:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  8039e9:	39 c3                	cmp    %eax,%ebx
+  8039eb:	74 1d                	je     803a0a <page_out+0x24d>
+		if (res[i] < 0)
+  8039ed:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  8039f1:	85 f6                	test   %esi,%esi
+  8039f3:	79 af                	jns    8039a4 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  8039f5:	56                   	push   %esi
+  8039f6:	68 84 5b 80 00       	push   $0x805b84
+  8039fb:	68 d1 02 00 00       	push   $0x2d1
+  803a00:	68 9a 58 80 00       	push   $0x80589a
+  803a05:	e8 63 12 00 00       	call   804c6d <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803a0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a0f:	e9 83 fe ff ff       	jmp    803897 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803a14:	50                   	push   %eax
+  803a15:	68 84 5b 80 00       	push   $0x805b84
+  803a1a:	68 0a 03 00 00       	push   $0x30a
+  803a1f:	68 9a 58 80 00       	push   $0x80589a
+  803a24:	e8 44 12 00 00       	call   804c6d <_panic>
+		return -E_NO_MEM;
+  803a29:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803a2e:	e9 64 fe ff ff       	jmp    803897 <page_out+0xda>
+		return -E_PAGING;
+  803a33:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a38:	e9 5a fe ff ff       	jmp    803897 <page_out+0xda>
+
+00803a3d <page_alloc>:
+{
+  803a3d:	55                   	push   %ebp
+  803a3e:	89 e5                	mov    %esp,%ebp
+  803a40:	57                   	push   %edi
+  803a41:	56                   	push   %esi
+  803a42:	53                   	push   %ebx
+  803a43:	83 ec 0c             	sub    $0xc,%esp
+  803a46:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803a49:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803a4c:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803a53:	74 34                	je     803a89 <page_alloc+0x4c>
+	if (check_mte)
+  803a55:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803a59:	75 35                	jne    803a90 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803a5b:	83 ec 04             	sub    $0x4,%esp
+  803a5e:	ff 75 10             	push   0x10(%ebp)
+  803a61:	56                   	push   %esi
+  803a62:	57                   	push   %edi
+  803a63:	e8 1f d2 ff ff       	call   800c87 <sys_page_alloc>
+  803a68:	89 c3                	mov    %eax,%ebx
+  803a6a:	83 c4 10             	add    $0x10,%esp
+  803a6d:	85 c0                	test   %eax,%eax
+  803a6f:	79 52                	jns    803ac3 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803a71:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803a74:	75 52                	jne    803ac8 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803a76:	83 ec 08             	sub    $0x8,%esp
+  803a79:	56                   	push   %esi
+  803a7a:	57                   	push   %edi
+  803a7b:	e8 3d fd ff ff       	call   8037bd <page_out>
+  803a80:	83 c4 10             	add    $0x10,%esp
+  803a83:	85 c0                	test   %eax,%eax
+  803a85:	79 d4                	jns    803a5b <page_alloc+0x1e>
+  803a87:	eb 3f                	jmp    803ac8 <page_alloc+0x8b>
+		init_map_dir();
+  803a89:	e8 2f fc ff ff       	call   8036bd <init_map_dir>
+  803a8e:	eb c5                	jmp    803a55 <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803a90:	83 ec 08             	sub    $0x8,%esp
+  803a93:	6a 00                	push   $0x0
+  803a95:	56                   	push   %esi
+  803a96:	e8 78 fc ff ff       	call   803713 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803a9b:	83 c4 10             	add    $0x10,%esp
+  803a9e:	85 c0                	test   %eax,%eax
+  803aa0:	74 b9                	je     803a5b <page_alloc+0x1e>
+  803aa2:	8b 10                	mov    (%eax),%edx
+  803aa4:	f6 c2 01             	test   $0x1,%dl
+  803aa7:	74 b2                	je     803a5b <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803aa9:	83 ec 08             	sub    $0x8,%esp
+  803aac:	56                   	push   %esi
+  803aad:	52                   	push   %edx
+  803aae:	50                   	push   %eax
+  803aaf:	68 a8 5b 80 00       	push   $0x805ba8
+  803ab4:	68 34 03 00 00       	push   $0x334
+  803ab9:	68 9a 58 80 00       	push   $0x80589a
+  803abe:	e8 aa 11 00 00       	call   804c6d <_panic>
+	return 0;
+  803ac3:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803ac8:	89 d8                	mov    %ebx,%eax
+  803aca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803acd:	5b                   	pop    %ebx
+  803ace:	5e                   	pop    %esi
+  803acf:	5f                   	pop    %edi
+  803ad0:	5d                   	pop    %ebp
+  803ad1:	c3                   	ret
+
+00803ad2 <page_adopt>:
+{
+  803ad2:	55                   	push   %ebp
+  803ad3:	89 e5                	mov    %esp,%ebp
+  803ad5:	56                   	push   %esi
+  803ad6:	53                   	push   %ebx
+  803ad7:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803ad9:	c1 e8 16             	shr    $0x16,%eax
+  803adc:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803ae3:	25 81 00 00 00       	and    $0x81,%eax
+  803ae8:	83 f8 01             	cmp    $0x1,%eax
+  803aeb:	75 53                	jne    803b40 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803aed:	89 d8                	mov    %ebx,%eax
+  803aef:	c1 e8 0c             	shr    $0xc,%eax
+  803af2:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803af9:	89 f2                	mov    %esi,%edx
+  803afb:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803b01:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803b06:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803b0c:	75 37                	jne    803b45 <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803b0e:	83 ec 08             	sub    $0x8,%esp
+  803b11:	6a 01                	push   $0x1
+  803b13:	53                   	push   %ebx
+  803b14:	e8 fa fb ff ff       	call   803713 <umapdir_walk>
+  803b19:	83 c4 10             	add    $0x10,%esp
+  803b1c:	85 c0                	test   %eax,%eax
+  803b1e:	74 2c                	je     803b4c <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803b20:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803b26:	83 ce 01             	or     $0x1,%esi
+  803b29:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803b2b:	83 ec 08             	sub    $0x8,%esp
+  803b2e:	53                   	push   %ebx
+  803b2f:	6a 00                	push   $0x0
+  803b31:	e8 d6 d1 ff ff       	call   800d0c <sys_page_unmap>
+	return 1;
+  803b36:	83 c4 10             	add    $0x10,%esp
+  803b39:	b8 01 00 00 00       	mov    $0x1,%eax
+  803b3e:	eb 05                	jmp    803b45 <page_adopt+0x73>
+		return 0;
+  803b40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b45:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b48:	5b                   	pop    %ebx
+  803b49:	5e                   	pop    %esi
+  803b4a:	5d                   	pop    %ebp
+  803b4b:	c3                   	ret
+		return -E_NO_MEM;
+  803b4c:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803b51:	eb f2                	jmp    803b45 <page_adopt+0x73>
+
+00803b53 <page_forget>:
+{
+  803b53:	55                   	push   %ebp
+  803b54:	89 e5                	mov    %esp,%ebp
+  803b56:	53                   	push   %ebx
+  803b57:	83 ec 04             	sub    $0x4,%esp
+  803b5a:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803b5c:	e8 4a ef ff ff       	call   802aab <find_paging_env>
+	if (pagingenv == 0)
+  803b61:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803b68:	74 39                	je     803ba3 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803b6a:	89 d8                	mov    %ebx,%eax
+  803b6c:	c1 e8 16             	shr    $0x16,%eax
+  803b6f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803b76:	25 81 00 00 00       	and    $0x81,%eax
+  803b7b:	83 f8 01             	cmp    $0x1,%eax
+  803b7e:	74 28                	je     803ba8 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803b80:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803b87:	74 1a                	je     803ba3 <page_forget+0x50>
+  803b89:	83 ec 08             	sub    $0x8,%esp
+  803b8c:	6a 00                	push   $0x0
+  803b8e:	53                   	push   %ebx
+  803b8f:	e8 7f fb ff ff       	call   803713 <umapdir_walk>
+  803b94:	89 c3                	mov    %eax,%ebx
+  803b96:	83 c4 10             	add    $0x10,%esp
+  803b99:	85 c0                	test   %eax,%eax
+  803b9b:	74 06                	je     803ba3 <page_forget+0x50>
+  803b9d:	8b 00                	mov    (%eax),%eax
+  803b9f:	a8 01                	test   $0x1,%al
+  803ba1:	75 2b                	jne    803bce <page_forget+0x7b>
+}
+  803ba3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ba6:	c9                   	leave
+  803ba7:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803ba8:	89 d8                	mov    %ebx,%eax
+  803baa:	c1 e8 0c             	shr    $0xc,%eax
+  803bad:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803bb4:	89 c2                	mov    %eax,%edx
+  803bb6:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803bbc:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803bc2:	75 bc                	jne    803b80 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803bc4:	c1 e8 0c             	shr    $0xc,%eax
+  803bc7:	e8 5c ee ff ff       	call   802a28 <page_remove_slot>
+		return;
+  803bcc:	eb d5                	jmp    803ba3 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803bce:	c1 e8 0c             	shr    $0xc,%eax
+  803bd1:	e8 52 ee ff ff       	call   802a28 <page_remove_slot>
+	*mte = 0;
+  803bd6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803bdc:	eb c5                	jmp    803ba3 <page_forget+0x50>
+
+00803bde <page_unmap>:
+{
+  803bde:	55                   	push   %ebp
+  803bdf:	89 e5                	mov    %esp,%ebp
+  803be1:	57                   	push   %edi
+  803be2:	56                   	push   %esi
+  803be3:	53                   	push   %ebx
+  803be4:	83 ec 0c             	sub    $0xc,%esp
+  803be7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803bea:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803bed:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803bf2:	8b 40 48             	mov    0x48(%eax),%eax
+  803bf5:	85 db                	test   %ebx,%ebx
+  803bf7:	0f 8e b4 00 00 00    	jle    803cb1 <page_unmap+0xd3>
+  803bfd:	39 d8                	cmp    %ebx,%eax
+  803bff:	0f 84 ac 00 00 00    	je     803cb1 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803c05:	83 ec 08             	sub    $0x8,%esp
+  803c08:	57                   	push   %edi
+  803c09:	53                   	push   %ebx
+  803c0a:	e8 fd d0 ff ff       	call   800d0c <sys_page_unmap>
+  803c0f:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803c11:	e8 95 ee ff ff       	call   802aab <find_paging_env>
+	if (pagingenv == 0)
+  803c16:	83 c4 10             	add    $0x10,%esp
+  803c19:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803c20:	0f 84 a1 00 00 00    	je     803cc7 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803c26:	83 ec 0c             	sub    $0xc,%esp
+  803c29:	6a 05                	push   $0x5
+  803c2b:	68 00 00 40 00       	push   $0x400000
+  803c30:	6a 00                	push   $0x0
+  803c32:	68 00 b0 ad de       	push   $0xdeadb000
+  803c37:	53                   	push   %ebx
+  803c38:	e8 8d d0 ff ff       	call   800cca <sys_page_map>
+  803c3d:	83 c4 20             	add    $0x20,%esp
+  803c40:	85 c0                	test   %eax,%eax
+  803c42:	0f 88 89 00 00 00    	js     803cd1 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803c48:	89 f8                	mov    %edi,%eax
+  803c4a:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803c4d:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803c54:	a8 01                	test   $0x1,%al
+  803c56:	74 6f                	je     803cc7 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803c58:	83 ec 0c             	sub    $0xc,%esp
+  803c5b:	6a 05                	push   $0x5
+  803c5d:	68 00 00 40 00       	push   $0x400000
+  803c62:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803c64:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803c69:	50                   	push   %eax
+  803c6a:	53                   	push   %ebx
+  803c6b:	e8 5a d0 ff ff       	call   800cca <sys_page_map>
+  803c70:	83 c4 20             	add    $0x20,%esp
+  803c73:	85 c0                	test   %eax,%eax
+  803c75:	78 6f                	js     803ce6 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803c77:	c1 ef 0c             	shr    $0xc,%edi
+  803c7a:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803c80:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803c87:	01 
+  803c88:	74 3d                	je     803cc7 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803c8a:	83 ec 08             	sub    $0x8,%esp
+  803c8d:	68 00 00 40 00       	push   $0x400000
+  803c92:	6a 00                	push   $0x0
+  803c94:	e8 73 d0 ff ff       	call   800d0c <sys_page_unmap>
+  803c99:	83 c4 10             	add    $0x10,%esp
+  803c9c:	85 c0                	test   %eax,%eax
+  803c9e:	78 5b                	js     803cfb <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803ca0:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803ca7:	c1 e8 0c             	shr    $0xc,%eax
+  803caa:	e8 79 ed ff ff       	call   802a28 <page_remove_slot>
+	return r;
+  803caf:	eb 16                	jmp    803cc7 <page_unmap+0xe9>
+		page_forget(va);
+  803cb1:	89 f8                	mov    %edi,%eax
+  803cb3:	e8 9b fe ff ff       	call   803b53 <page_forget>
+		return sys_page_unmap(envid, va);
+  803cb8:	83 ec 08             	sub    $0x8,%esp
+  803cbb:	57                   	push   %edi
+  803cbc:	53                   	push   %ebx
+  803cbd:	e8 4a d0 ff ff       	call   800d0c <sys_page_unmap>
+  803cc2:	89 c6                	mov    %eax,%esi
+  803cc4:	83 c4 10             	add    $0x10,%esp
+}
+  803cc7:	89 f0                	mov    %esi,%eax
+  803cc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ccc:	5b                   	pop    %ebx
+  803ccd:	5e                   	pop    %esi
+  803cce:	5f                   	pop    %edi
+  803ccf:	5d                   	pop    %ebp
+  803cd0:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803cd1:	50                   	push   %eax
+  803cd2:	68 e4 5b 80 00       	push   $0x805be4
+  803cd7:	68 e4 03 00 00       	push   $0x3e4
+  803cdc:	68 9a 58 80 00       	push   $0x80589a
+  803ce1:	e8 87 0f 00 00       	call   804c6d <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803ce6:	50                   	push   %eax
+  803ce7:	68 10 5c 80 00       	push   $0x805c10
+  803cec:	68 ea 03 00 00       	push   $0x3ea
+  803cf1:	68 9a 58 80 00       	push   $0x80589a
+  803cf6:	e8 72 0f 00 00       	call   804c6d <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803cfb:	50                   	push   %eax
+  803cfc:	68 3c 5c 80 00       	push   $0x805c3c
+  803d01:	68 ef 03 00 00       	push   $0x3ef
+  803d06:	68 9a 58 80 00       	push   $0x80589a
+  803d0b:	e8 5d 0f 00 00       	call   804c6d <_panic>
+
+00803d10 <page_unmap_range>:
+{
+  803d10:	55                   	push   %ebp
+  803d11:	89 e5                	mov    %esp,%ebp
+  803d13:	57                   	push   %edi
+  803d14:	56                   	push   %esi
+  803d15:	53                   	push   %ebx
+  803d16:	83 ec 0c             	sub    $0xc,%esp
+  803d19:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803d1c:	e8 8a ed ff ff       	call   802aab <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803d21:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803d26:	8b 40 48             	mov    0x48(%eax),%eax
+  803d29:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803d2d:	7e 38                	jle    803d67 <page_unmap_range+0x57>
+  803d2f:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803d32:	74 33                	je     803d67 <page_unmap_range+0x57>
+  803d34:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803d3b:	74 2a                	je     803d67 <page_unmap_range+0x57>
+  803d3d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  803d40:	be 00 00 00 00       	mov    $0x0,%esi
+  803d45:	39 fe                	cmp    %edi,%esi
+  803d47:	74 56                	je     803d9f <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  803d49:	83 ec 08             	sub    $0x8,%esp
+  803d4c:	53                   	push   %ebx
+  803d4d:	ff 75 08             	push   0x8(%ebp)
+  803d50:	e8 89 fe ff ff       	call   803bde <page_unmap>
+  803d55:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803d5b:	83 c4 10             	add    $0x10,%esp
+  803d5e:	85 c0                	test   %eax,%eax
+  803d60:	78 35                	js     803d97 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  803d62:	83 c6 01             	add    $0x1,%esi
+  803d65:	eb de                	jmp    803d45 <page_unmap_range+0x35>
+  803d67:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803d6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d6f:	eb 10                	jmp    803d81 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803d71:	89 f0                	mov    %esi,%eax
+  803d73:	e8 db fd ff ff       	call   803b53 <page_forget>
+		for (i = 0; i < npages; i++)
+  803d78:	83 c3 01             	add    $0x1,%ebx
+  803d7b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803d81:	39 fb                	cmp    %edi,%ebx
+  803d83:	75 ec                	jne    803d71 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  803d85:	83 ec 04             	sub    $0x4,%esp
+  803d88:	57                   	push   %edi
+  803d89:	ff 75 0c             	push   0xc(%ebp)
+  803d8c:	ff 75 08             	push   0x8(%ebp)
+  803d8f:	e8 8c d0 ff ff       	call   800e20 <sys_page_unmap_range>
+  803d94:	83 c4 10             	add    $0x10,%esp
+}
+  803d97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d9a:	5b                   	pop    %ebx
+  803d9b:	5e                   	pop    %esi
+  803d9c:	5f                   	pop    %edi
+  803d9d:	5d                   	pop    %ebp
+  803d9e:	c3                   	ret
+	return 0;
+  803d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803da4:	eb f1                	jmp    803d97 <page_unmap_range+0x87>
+
+00803da6 <page_alloc_range>:
+{
+  803da6:	55                   	push   %ebp
+  803da7:	89 e5                	mov    %esp,%ebp
+  803da9:	57                   	push   %edi
+  803daa:	56                   	push   %esi
+  803dab:	53                   	push   %ebx
+  803dac:	83 ec 1c             	sub    $0x1c,%esp
+  803daf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803db2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  803db5:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803dbc:	74 14                	je     803dd2 <page_alloc_range+0x2c>
+	if (check_mte)
+  803dbe:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803dc2:	74 66                	je     803e2a <page_alloc_range+0x84>
+  803dc4:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  803dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dcb:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803dce:	89 c7                	mov    %eax,%edi
+  803dd0:	eb 10                	jmp    803de2 <page_alloc_range+0x3c>
+		init_map_dir();
+  803dd2:	e8 e6 f8 ff ff       	call   8036bd <init_map_dir>
+  803dd7:	eb e5                	jmp    803dbe <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803dd9:	83 c7 01             	add    $0x1,%edi
+  803ddc:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803de2:	39 df                	cmp    %ebx,%edi
+  803de4:	74 38                	je     803e1e <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  803de6:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803de9:	83 ec 08             	sub    $0x8,%esp
+  803dec:	6a 00                	push   $0x0
+  803dee:	56                   	push   %esi
+  803def:	e8 1f f9 ff ff       	call   803713 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  803df4:	83 c4 10             	add    $0x10,%esp
+  803df7:	85 c0                	test   %eax,%eax
+  803df9:	74 de                	je     803dd9 <page_alloc_range+0x33>
+  803dfb:	8b 10                	mov    (%eax),%edx
+  803dfd:	f6 c2 01             	test   $0x1,%dl
+  803e00:	74 d7                	je     803dd9 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  803e02:	83 ec 08             	sub    $0x8,%esp
+  803e05:	ff 75 e4             	push   -0x1c(%ebp)
+  803e08:	52                   	push   %edx
+  803e09:	50                   	push   %eax
+  803e0a:	68 a8 5b 80 00       	push   $0x805ba8
+  803e0f:	68 0b 04 00 00       	push   $0x40b
+  803e14:	68 9a 58 80 00       	push   $0x80589a
+  803e19:	e8 4f 0e 00 00       	call   804c6d <_panic>
+  803e1e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803e21:	eb 07                	jmp    803e2a <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  803e23:	c1 e0 0c             	shl    $0xc,%eax
+  803e26:	01 c7                	add    %eax,%edi
+			npages -= r;
+  803e28:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  803e2a:	85 db                	test   %ebx,%ebx
+  803e2c:	74 30                	je     803e5e <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  803e2e:	ff 75 14             	push   0x14(%ebp)
+  803e31:	53                   	push   %ebx
+  803e32:	57                   	push   %edi
+  803e33:	ff 75 08             	push   0x8(%ebp)
+  803e36:	e8 77 cf ff ff       	call   800db2 <sys_page_alloc_range>
+  803e3b:	89 c6                	mov    %eax,%esi
+  803e3d:	83 c4 10             	add    $0x10,%esp
+  803e40:	85 c0                	test   %eax,%eax
+  803e42:	7f df                	jg     803e23 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  803e44:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  803e47:	75 1a                	jne    803e63 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  803e49:	83 ec 08             	sub    $0x8,%esp
+  803e4c:	57                   	push   %edi
+  803e4d:	ff 75 08             	push   0x8(%ebp)
+  803e50:	e8 68 f9 ff ff       	call   8037bd <page_out>
+  803e55:	83 c4 10             	add    $0x10,%esp
+  803e58:	85 c0                	test   %eax,%eax
+  803e5a:	79 ce                	jns    803e2a <page_alloc_range+0x84>
+  803e5c:	eb 05                	jmp    803e63 <page_alloc_range+0xbd>
+	return 0;
+  803e5e:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803e63:	89 f0                	mov    %esi,%eax
+  803e65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e68:	5b                   	pop    %ebx
+  803e69:	5e                   	pop    %esi
+  803e6a:	5f                   	pop    %edi
+  803e6b:	5d                   	pop    %ebp
+  803e6c:	c3                   	ret
+
+00803e6d <page_in>:
+{
+  803e6d:	55                   	push   %ebp
+  803e6e:	89 e5                	mov    %esp,%ebp
+  803e70:	57                   	push   %edi
+  803e71:	56                   	push   %esi
+  803e72:	53                   	push   %ebx
+  803e73:	83 ec 3c             	sub    $0x3c,%esp
+  803e76:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  803e79:	e8 2d ec ff ff       	call   802aab <find_paging_env>
+	if (pagingenv == 0)
+  803e7e:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803e85:	0f 84 09 02 00 00    	je     804094 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  803e8b:	83 ec 08             	sub    $0x8,%esp
+  803e8e:	6a 00                	push   $0x0
+  803e90:	56                   	push   %esi
+  803e91:	e8 7d f8 ff ff       	call   803713 <umapdir_walk>
+  803e96:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803e98:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803e9e:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  803ea1:	83 c4 10             	add    $0x10,%esp
+  803ea4:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803ea8:	74 0d                	je     803eb7 <page_in+0x4a>
+  803eaa:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803eaf:	8b 40 48             	mov    0x48(%eax),%eax
+  803eb2:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803eb5:	75 06                	jne    803ebd <page_in+0x50>
+  803eb7:	8b 03                	mov    (%ebx),%eax
+  803eb9:	a8 02                	test   $0x2,%al
+  803ebb:	75 63                	jne    803f20 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  803ebd:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803ebf:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803ec1:	89 f0                	mov    %esi,%eax
+  803ec3:	25 06 0e 00 00       	and    $0xe06,%eax
+  803ec8:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803ecb:	50                   	push   %eax
+  803ecc:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803ecf:	57                   	push   %edi
+  803ed0:	ff 75 08             	push   0x8(%ebp)
+  803ed3:	e8 65 fb ff ff       	call   803a3d <page_alloc>
+  803ed8:	83 c4 10             	add    $0x10,%esp
+  803edb:	85 c0                	test   %eax,%eax
+  803edd:	78 39                	js     803f18 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  803edf:	89 f0                	mov    %esi,%eax
+  803ee1:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803ee4:	83 ec 0c             	sub    $0xc,%esp
+  803ee7:	6a 07                	push   $0x7
+  803ee9:	6a 01                	push   $0x1
+  803eeb:	57                   	push   %edi
+  803eec:	c1 e0 04             	shl    $0x4,%eax
+  803eef:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803ef0:	c1 ee 1c             	shr    $0x1c,%esi
+  803ef3:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803ef6:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803efd:	e8 37 10 00 00       	call   804f39 <ipc_call>
+  803f02:	83 c4 20             	add    $0x20,%esp
+  803f05:	85 c0                	test   %eax,%eax
+  803f07:	0f 88 72 01 00 00    	js     80407f <page_in+0x212>
+	*mte = 0;
+  803f0d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  803f13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f1b:	5b                   	pop    %ebx
+  803f1c:	5e                   	pop    %esi
+  803f1d:	5f                   	pop    %edi
+  803f1e:	5d                   	pop    %ebp
+  803f1f:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803f20:	25 06 0e 00 00       	and    $0xe06,%eax
+  803f25:	83 c8 01             	or     $0x1,%eax
+  803f28:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  803f2b:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803f2e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  803f31:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  803f37:	be 01 00 00 00       	mov    $0x1,%esi
+  803f3c:	eb 46                	jmp    803f84 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  803f3e:	83 ec 08             	sub    $0x8,%esp
+  803f41:	6a 00                	push   $0x0
+  803f43:	51                   	push   %ecx
+  803f44:	e8 ca f7 ff ff       	call   803713 <umapdir_walk>
+  803f49:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  803f4d:	83 c4 10             	add    $0x10,%esp
+  803f50:	85 c0                	test   %eax,%eax
+  803f52:	74 66                	je     803fba <page_in+0x14d>
+  803f54:	8b 00                	mov    (%eax),%eax
+  803f56:	a8 01                	test   $0x1,%al
+  803f58:	74 60                	je     803fba <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  803f5a:	89 c2                	mov    %eax,%edx
+  803f5c:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  803f62:	83 ca 01             	or     $0x1,%edx
+  803f65:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  803f68:	75 50                	jne    803fba <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  803f6a:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803f70:	c1 e8 1c             	shr    $0x1c,%eax
+  803f73:	8b 13                	mov    (%ebx),%edx
+  803f75:	c1 ea 1c             	shr    $0x1c,%edx
+  803f78:	39 d0                	cmp    %edx,%eax
+  803f7a:	75 3e                	jne    803fba <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803f7c:	83 c6 01             	add    $0x1,%esi
+  803f7f:	83 fe 08             	cmp    $0x8,%esi
+  803f82:	74 3f                	je     803fc3 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  803f84:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803f86:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  803f8c:	77 2c                	ja     803fba <page_in+0x14d>
+  803f8e:	89 f8                	mov    %edi,%eax
+  803f90:	c1 e8 16             	shr    $0x16,%eax
+  803f93:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803f9a:	f6 c2 01             	test   $0x1,%dl
+  803f9d:	74 9f                	je     803f3e <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803f9f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803fa6:	a8 80                	test   $0x80,%al
+  803fa8:	75 10                	jne    803fba <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803faa:	89 f8                	mov    %edi,%eax
+  803fac:	c1 e8 0c             	shr    $0xc,%eax
+  803faf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803fb6:	a8 01                	test   $0x1,%al
+  803fb8:	74 84                	je     803f3e <page_in+0xd1>
+	if (n == 1)
+  803fba:	83 fe 01             	cmp    $0x1,%esi
+  803fbd:	0f 84 fa fe ff ff    	je     803ebd <page_in+0x50>
+	req.nslots = n;
+  803fc3:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  803fc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fce:	eb 13                	jmp    803fe3 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  803fd0:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  803fd4:	8b 12                	mov    (%edx),%edx
+  803fd6:	c1 ea 0c             	shr    $0xc,%edx
+  803fd9:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  803fe0:	83 c0 01             	add    $0x1,%eax
+  803fe3:	39 c6                	cmp    %eax,%esi
+  803fe5:	75 e9                	jne    803fd0 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  803fe7:	83 ec 0c             	sub    $0xc,%esp
+  803fea:	6a 00                	push   $0x0
+  803fec:	ff 75 c0             	push   -0x40(%ebp)
+  803fef:	56                   	push   %esi
+  803ff0:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803ff3:	57                   	push   %edi
+  803ff4:	6a 00                	push   $0x0
+  803ff6:	e8 ab fd ff ff       	call   803da6 <page_alloc_range>
+  803ffb:	83 c4 20             	add    $0x20,%esp
+  803ffe:	85 c0                	test   %eax,%eax
+  804000:	78 6e                	js     804070 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  804002:	83 ec 04             	sub    $0x4,%esp
+  804005:	6a 24                	push   $0x24
+  804007:	68 00 80 80 00       	push   $0x808000
+  80400c:	57                   	push   %edi
+  80400d:	e8 08 c9 ff ff       	call   80091a <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804012:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  804019:	56                   	push   %esi
+  80401a:	57                   	push   %edi
+  80401b:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  80401d:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  804024:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804027:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  80402e:	e8 06 0f 00 00       	call   804f39 <ipc_call>
+  804033:	83 c4 20             	add    $0x20,%esp
+  804036:	85 c0                	test   %eax,%eax
+  804038:	78 08                	js     804042 <page_in+0x1d5>
+  80403a:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80403d:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  804040:	eb 20                	jmp    804062 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  804042:	50                   	push   %eax
+  804043:	68 68 5c 80 00       	push   $0x805c68
+  804048:	68 59 02 00 00       	push   $0x259
+  80404d:	68 9a 58 80 00       	push   $0x80589a
+  804052:	e8 16 0c 00 00       	call   804c6d <_panic>
+		*mtes[i] = 0;
+  804057:	8b 10                	mov    (%eax),%edx
+  804059:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  80405f:	83 c0 04             	add    $0x4,%eax
+  804062:	39 c8                	cmp    %ecx,%eax
+  804064:	75 f1                	jne    804057 <page_in+0x1ea>
+	return n;
+  804066:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  804068:	85 f6                	test   %esi,%esi
+  80406a:	0f 84 4d fe ff ff    	je     803ebd <page_in+0x50>
+		return r < 0 ? r : 0;
+  804070:	85 c0                	test   %eax,%eax
+  804072:	ba 00 00 00 00       	mov    $0x0,%edx
+  804077:	0f 4f c2             	cmovg  %edx,%eax
+  80407a:	e9 99 fe ff ff       	jmp    803f18 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  80407f:	50                   	push   %eax
+  804080:	68 a0 5c 80 00       	push   $0x805ca0
+  804085:	68 9a 02 00 00       	push   $0x29a
+  80408a:	68 9a 58 80 00       	push   $0x80589a
+  80408f:	e8 d9 0b 00 00       	call   804c6d <_panic>
+		return -E_PAGING;
+  804094:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804099:	e9 7a fe ff ff       	jmp    803f18 <page_in+0xab>
+
+0080409e <page_map>:
+{
+  80409e:	55                   	push   %ebp
+  80409f:	89 e5                	mov    %esp,%ebp
+  8040a1:	57                   	push   %edi
+  8040a2:	56                   	push   %esi
+  8040a3:	53                   	push   %ebx
+  8040a4:	83 ec 1c             	sub    $0x1c,%esp
+  8040a7:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8040aa:	83 ec 0c             	sub    $0xc,%esp
+  8040ad:	ff 75 18             	push   0x18(%ebp)
+  8040b0:	ff 75 14             	push   0x14(%ebp)
+  8040b3:	ff 75 10             	push   0x10(%ebp)
+  8040b6:	ff 75 0c             	push   0xc(%ebp)
+  8040b9:	56                   	push   %esi
+  8040ba:	e8 0b cc ff ff       	call   800cca <sys_page_map>
+  8040bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8040c2:	83 c4 20             	add    $0x20,%esp
+  8040c5:	85 c0                	test   %eax,%eax
+  8040c7:	0f 89 a9 01 00 00    	jns    804276 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  8040cd:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  8040d1:	74 5f                	je     804132 <page_map+0x94>
+		if (r != -E_INVAL)
+  8040d3:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  8040d7:	0f 85 a0 01 00 00    	jne    80427d <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8040dd:	85 f6                	test   %esi,%esi
+  8040df:	74 70                	je     804151 <page_map+0xb3>
+  8040e1:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8040e6:	8b 40 48             	mov    0x48(%eax),%eax
+  8040e9:	39 f0                	cmp    %esi,%eax
+  8040eb:	74 64                	je     804151 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8040ed:	83 ec 0c             	sub    $0xc,%esp
+  8040f0:	6a 05                	push   $0x5
+  8040f2:	68 00 00 40 00       	push   $0x400000
+  8040f7:	6a 00                	push   $0x0
+  8040f9:	68 00 b0 ad de       	push   $0xdeadb000
+  8040fe:	56                   	push   %esi
+  8040ff:	e8 c6 cb ff ff       	call   800cca <sys_page_map>
+  804104:	89 c3                	mov    %eax,%ebx
+  804106:	83 c4 20             	add    $0x20,%esp
+  804109:	85 c0                	test   %eax,%eax
+  80410b:	79 6a                	jns    804177 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  80410d:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804110:	75 50                	jne    804162 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  804112:	83 ec 08             	sub    $0x8,%esp
+  804115:	68 00 00 40 00       	push   $0x400000
+  80411a:	6a fc                	push   $0xfffffffc
+  80411c:	e8 9c f6 ff ff       	call   8037bd <page_out>
+  804121:	83 c4 10             	add    $0x10,%esp
+  804124:	85 c0                	test   %eax,%eax
+  804126:	79 c5                	jns    8040ed <page_map+0x4f>
+}
+  804128:	89 d8                	mov    %ebx,%eax
+  80412a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80412d:	5b                   	pop    %ebx
+  80412e:	5e                   	pop    %esi
+  80412f:	5f                   	pop    %edi
+  804130:	5d                   	pop    %ebp
+  804131:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  804132:	83 ec 08             	sub    $0x8,%esp
+  804135:	68 00 00 40 00       	push   $0x400000
+  80413a:	6a 00                	push   $0x0
+  80413c:	e8 7c f6 ff ff       	call   8037bd <page_out>
+  804141:	83 c4 10             	add    $0x10,%esp
+  804144:	85 c0                	test   %eax,%eax
+  804146:	0f 89 5e ff ff ff    	jns    8040aa <page_map+0xc>
+				return r;
+  80414c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80414f:	eb d7                	jmp    804128 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804151:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804154:	e8 79 f9 ff ff       	call   803ad2 <page_adopt>
+  804159:	85 c0                	test   %eax,%eax
+  80415b:	79 90                	jns    8040ed <page_map+0x4f>
+			return r;
+  80415d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804160:	eb c6                	jmp    804128 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  804162:	53                   	push   %ebx
+  804163:	68 d4 5c 80 00       	push   $0x805cd4
+  804168:	68 77 03 00 00       	push   $0x377
+  80416d:	68 9a 58 80 00       	push   $0x80589a
+  804172:	e8 f6 0a 00 00       	call   804c6d <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  804177:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80417a:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  80417d:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  804184:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  80418a:	0f 84 f5 00 00 00    	je     804285 <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  804190:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804196:	83 ec 0c             	sub    $0xc,%esp
+  804199:	6a 05                	push   $0x5
+  80419b:	68 00 00 40 00       	push   $0x400000
+  8041a0:	6a 00                	push   $0x0
+  8041a2:	57                   	push   %edi
+  8041a3:	56                   	push   %esi
+  8041a4:	e8 21 cb ff ff       	call   800cca <sys_page_map>
+  8041a9:	89 c3                	mov    %eax,%ebx
+  8041ab:	83 c4 20             	add    $0x20,%esp
+  8041ae:	85 c0                	test   %eax,%eax
+  8041b0:	79 35                	jns    8041e7 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  8041b2:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8041b5:	75 1b                	jne    8041d2 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8041b7:	83 ec 08             	sub    $0x8,%esp
+  8041ba:	68 00 00 40 00       	push   $0x400000
+  8041bf:	6a 00                	push   $0x0
+  8041c1:	e8 f7 f5 ff ff       	call   8037bd <page_out>
+  8041c6:	83 c4 10             	add    $0x10,%esp
+  8041c9:	85 c0                	test   %eax,%eax
+  8041cb:	79 c9                	jns    804196 <page_map+0xf8>
+  8041cd:	e9 56 ff ff ff       	jmp    804128 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  8041d2:	53                   	push   %ebx
+  8041d3:	68 fc 5c 80 00       	push   $0x805cfc
+  8041d8:	68 83 03 00 00       	push   $0x383
+  8041dd:	68 9a 58 80 00       	push   $0x80589a
+  8041e2:	e8 86 0a 00 00       	call   804c6d <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  8041e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8041ea:	c1 e8 0c             	shr    $0xc,%eax
+  8041ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8041f2:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  8041f9:	01 
+  8041fa:	0f 84 8d 00 00 00    	je     80428d <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  804200:	83 ec 08             	sub    $0x8,%esp
+  804203:	68 00 00 40 00       	push   $0x400000
+  804208:	6a 00                	push   $0x0
+  80420a:	e8 fd ca ff ff       	call   800d0c <sys_page_unmap>
+  80420f:	83 c4 10             	add    $0x10,%esp
+  804212:	85 c0                	test   %eax,%eax
+  804214:	78 36                	js     80424c <page_map+0x1ae>
+  804216:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  804219:	83 ec 08             	sub    $0x8,%esp
+  80421c:	57                   	push   %edi
+  80421d:	56                   	push   %esi
+  80421e:	e8 4a fc ff ff       	call   803e6d <page_in>
+  804223:	89 c3                	mov    %eax,%ebx
+  804225:	83 c4 10             	add    $0x10,%esp
+  804228:	85 c0                	test   %eax,%eax
+  80422a:	0f 89 7a fe ff ff    	jns    8040aa <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  804230:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804233:	75 2c                	jne    804261 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  804235:	83 ec 08             	sub    $0x8,%esp
+  804238:	57                   	push   %edi
+  804239:	6a 00                	push   $0x0
+  80423b:	e8 7d f5 ff ff       	call   8037bd <page_out>
+  804240:	83 c4 10             	add    $0x10,%esp
+  804243:	85 c0                	test   %eax,%eax
+  804245:	79 d2                	jns    804219 <page_map+0x17b>
+  804247:	e9 dc fe ff ff       	jmp    804128 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  80424c:	50                   	push   %eax
+  80424d:	68 28 5d 80 00       	push   $0x805d28
+  804252:	68 8b 03 00 00       	push   $0x38b
+  804257:	68 9a 58 80 00       	push   $0x80589a
+  80425c:	e8 0c 0a 00 00       	call   804c6d <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  804261:	53                   	push   %ebx
+  804262:	68 50 5d 80 00       	push   $0x805d50
+  804267:	68 91 03 00 00       	push   $0x391
+  80426c:	68 9a 58 80 00       	push   $0x80589a
+  804271:	e8 f7 09 00 00       	call   804c6d <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  804276:	89 c3                	mov    %eax,%ebx
+  804278:	e9 ab fe ff ff       	jmp    804128 <page_map+0x8a>
+  80427d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804280:	e9 a3 fe ff ff       	jmp    804128 <page_map+0x8a>
+			return r; // Pass through the error
+  804285:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804288:	e9 9b fe ff ff       	jmp    804128 <page_map+0x8a>
+			return r; // Pass through the error
+  80428d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804290:	e9 93 fe ff ff       	jmp    804128 <page_map+0x8a>
+
+00804295 <page_map_range>:
+{
+  804295:	55                   	push   %ebp
+  804296:	89 e5                	mov    %esp,%ebp
+  804298:	57                   	push   %edi
+  804299:	56                   	push   %esi
+  80429a:	53                   	push   %ebx
+  80429b:	83 ec 0c             	sub    $0xc,%esp
+  80429e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8042a1:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  8042a4:	83 ec 08             	sub    $0x8,%esp
+  8042a7:	ff 75 1c             	push   0x1c(%ebp)
+  8042aa:	ff 75 18             	push   0x18(%ebp)
+  8042ad:	56                   	push   %esi
+  8042ae:	ff 75 10             	push   0x10(%ebp)
+  8042b1:	57                   	push   %edi
+  8042b2:	ff 75 08             	push   0x8(%ebp)
+  8042b5:	e8 1b cb ff ff       	call   800dd5 <sys_page_map_range>
+  8042ba:	89 c3                	mov    %eax,%ebx
+  8042bc:	83 c4 20             	add    $0x20,%esp
+  8042bf:	85 c0                	test   %eax,%eax
+  8042c1:	79 1b                	jns    8042de <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  8042c3:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8042c6:	75 20                	jne    8042e8 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8042c8:	83 ec 08             	sub    $0x8,%esp
+  8042cb:	68 00 00 40 00       	push   $0x400000
+  8042d0:	6a 00                	push   $0x0
+  8042d2:	e8 e6 f4 ff ff       	call   8037bd <page_out>
+  8042d7:	83 c4 10             	add    $0x10,%esp
+  8042da:	85 c0                	test   %eax,%eax
+  8042dc:	79 c6                	jns    8042a4 <page_map_range+0xf>
+}
+  8042de:	89 d8                	mov    %ebx,%eax
+  8042e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042e3:	5b                   	pop    %ebx
+  8042e4:	5e                   	pop    %esi
+  8042e5:	5f                   	pop    %edi
+  8042e6:	5d                   	pop    %ebp
+  8042e7:	c3                   	ret
+		if (r != -E_INVAL)
+  8042e8:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  8042eb:	75 f1                	jne    8042de <page_map_range+0x49>
+  8042ed:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  8042ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8042f4:	eb 03                	jmp    8042f9 <page_map_range+0x64>
+  8042f6:	83 c6 01             	add    $0x1,%esi
+  8042f9:	3b 75 18             	cmp    0x18(%ebp),%esi
+  8042fc:	74 2a                	je     804328 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  8042fe:	83 ec 0c             	sub    $0xc,%esp
+  804301:	ff 75 1c             	push   0x1c(%ebp)
+  804304:	53                   	push   %ebx
+  804305:	ff 75 10             	push   0x10(%ebp)
+  804308:	57                   	push   %edi
+  804309:	ff 75 08             	push   0x8(%ebp)
+  80430c:	e8 8d fd ff ff       	call   80409e <page_map>
+  804311:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804317:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80431d:	83 c4 20             	add    $0x20,%esp
+  804320:	85 c0                	test   %eax,%eax
+  804322:	79 d2                	jns    8042f6 <page_map_range+0x61>
+  804324:	89 c3                	mov    %eax,%ebx
+  804326:	eb b6                	jmp    8042de <page_map_range+0x49>
+		return 0;
+  804328:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80432d:	eb af                	jmp    8042de <page_map_range+0x49>
+
+0080432f <paging_pgfault_handler>:
+{
+  80432f:	55                   	push   %ebp
+  804330:	89 e5                	mov    %esp,%ebp
+  804332:	56                   	push   %esi
+  804333:	53                   	push   %ebx
+  804334:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  804337:	e8 6f e7 ff ff       	call   802aab <find_paging_env>
+	if (pagingenv == 0)
+  80433c:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  804341:	85 c0                	test   %eax,%eax
+  804343:	74 3c                	je     804381 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  804345:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804347:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80434b:	75 12                	jne    80435f <paging_pgfault_handler+0x30>
+  80434d:	89 f0                	mov    %esi,%eax
+  80434f:	e8 7e f7 ff ff       	call   803ad2 <page_adopt>
+  804354:	89 c2                	mov    %eax,%edx
+		return 0;
+  804356:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  80435b:	85 d2                	test   %edx,%edx
+  80435d:	78 22                	js     804381 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  80435f:	83 ec 08             	sub    $0x8,%esp
+  804362:	6a 00                	push   $0x0
+  804364:	56                   	push   %esi
+  804365:	e8 a9 f3 ff ff       	call   803713 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  80436a:	83 c4 10             	add    $0x10,%esp
+  80436d:	85 c0                	test   %eax,%eax
+  80436f:	74 05                	je     804376 <paging_pgfault_handler+0x47>
+  804371:	f6 00 01             	testb  $0x1,(%eax)
+  804374:	75 12                	jne    804388 <paging_pgfault_handler+0x59>
+	return 0;
+  804376:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  80437b:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80437f:	74 23                	je     8043a4 <paging_pgfault_handler+0x75>
+}
+  804381:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804384:	5b                   	pop    %ebx
+  804385:	5e                   	pop    %esi
+  804386:	5d                   	pop    %ebp
+  804387:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  804388:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80438d:	8b 40 48             	mov    0x48(%eax),%eax
+  804390:	83 ec 08             	sub    $0x8,%esp
+  804393:	56                   	push   %esi
+  804394:	50                   	push   %eax
+  804395:	e8 d3 fa ff ff       	call   803e6d <page_in>
+  80439a:	f7 d0                	not    %eax
+  80439c:	c1 e8 1f             	shr    $0x1f,%eax
+  80439f:	83 c4 10             	add    $0x10,%esp
+  8043a2:	eb dd                	jmp    804381 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8043a4:	89 f0                	mov    %esi,%eax
+  8043a6:	e8 97 e2 ff ff       	call   802642 <segment_lookup>
+  8043ab:	89 c2                	mov    %eax,%edx
+	return 0;
+  8043ad:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8043b2:	85 d2                	test   %edx,%edx
+  8043b4:	74 cb                	je     804381 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  8043b6:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8043bb:	8b 40 48             	mov    0x48(%eax),%eax
+  8043be:	83 ec 08             	sub    $0x8,%esp
+  8043c1:	56                   	push   %esi
+  8043c2:	50                   	push   %eax
+  8043c3:	e8 f5 f3 ff ff       	call   8037bd <page_out>
+  8043c8:	f7 d0                	not    %eax
+  8043ca:	c1 e8 1f             	shr    $0x1f,%eax
+  8043cd:	83 c4 10             	add    $0x10,%esp
+  8043d0:	eb af                	jmp    804381 <paging_pgfault_handler+0x52>
+
+008043d2 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  8043d2:	55                   	push   %ebp
+  8043d3:	89 e5                	mov    %esp,%ebp
+  8043d5:	57                   	push   %edi
+  8043d6:	56                   	push   %esi
+  8043d7:	53                   	push   %ebx
+  8043d8:	83 ec 2c             	sub    $0x2c,%esp
+  8043db:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8043de:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  8043e3:	89 c1                	mov    %eax,%ecx
+  8043e5:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  8043e8:	c1 e8 11             	shr    $0x11,%eax
+  8043eb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8043ee:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  8043f5:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  8043f8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8043fd:	d3 e0                	shl    %cl,%eax
+  8043ff:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  804402:	85 c7                	test   %eax,%edi
+  804404:	74 12                	je     804418 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804406:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80440b:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  80440e:	bf 01 00 00 00       	mov    $0x1,%edi
+  804413:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804416:	eb 17                	jmp    80442f <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  804418:	ff 75 e0             	push   -0x20(%ebp)
+  80441b:	68 88 5d 80 00       	push   $0x805d88
+  804420:	6a 48                	push   $0x48
+  804422:	68 a2 5d 80 00       	push   $0x805da2
+  804427:	e8 41 08 00 00       	call   804c6d <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  80442c:	83 c3 01             	add    $0x1,%ebx
+  80442f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804432:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  804435:	89 c8                	mov    %ecx,%eax
+  804437:	c1 e8 05             	shr    $0x5,%eax
+  80443a:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  804441:	89 fe                	mov    %edi,%esi
+  804443:	d3 e6                	shl    %cl,%esi
+  804445:	89 f1                	mov    %esi,%ecx
+  804447:	85 d6                	test   %edx,%esi
+  804449:	74 e1                	je     80442c <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  80444b:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  80444e:	f7 d6                	not    %esi
+  804450:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804453:	21 fe                	and    %edi,%esi
+  804455:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804458:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  80445f:	f7 d1                	not    %ecx
+  804461:	21 d1                	and    %edx,%ecx
+  804463:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  80446a:	83 ec 04             	sub    $0x4,%esp
+  80446d:	53                   	push   %ebx
+  80446e:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804471:	57                   	push   %edi
+  804472:	6a 00                	push   $0x0
+  804474:	e8 97 f8 ff ff       	call   803d10 <page_unmap_range>
+	va_free(va, n);
+  804479:	83 c4 08             	add    $0x8,%esp
+  80447c:	53                   	push   %ebx
+  80447d:	57                   	push   %edi
+  80447e:	e8 ed 05 00 00       	call   804a70 <va_free>
+}
+  804483:	83 c4 10             	add    $0x10,%esp
+  804486:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804489:	5b                   	pop    %ebx
+  80448a:	5e                   	pop    %esi
+  80448b:	5f                   	pop    %edi
+  80448c:	5d                   	pop    %ebp
+  80448d:	c3                   	ret
+
+0080448e <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  80448e:	55                   	push   %ebp
+  80448f:	89 e5                	mov    %esp,%ebp
+  804491:	57                   	push   %edi
+  804492:	56                   	push   %esi
+  804493:	53                   	push   %ebx
+  804494:	83 ec 1c             	sub    $0x1c,%esp
+  804497:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  80449a:	85 db                	test   %ebx,%ebx
+  80449c:	74 34                	je     8044d2 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  80449e:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8044a4:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  8044a9:	77 2f                	ja     8044da <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  8044ab:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8044b1:	75 51                	jne    804504 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  8044b3:	89 c1                	mov    %eax,%ecx
+  8044b5:	c1 e9 0c             	shr    $0xc,%ecx
+  8044b8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8044bd:	d3 e2                	shl    %cl,%edx
+  8044bf:	c1 e8 11             	shr    $0x11,%eax
+  8044c2:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  8044c9:	75 24                	jne    8044ef <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  8044cb:	89 d8                	mov    %ebx,%eax
+  8044cd:	e8 00 ff ff ff       	call   8043d2 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  8044d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044d5:	5b                   	pop    %ebx
+  8044d6:	5e                   	pop    %esi
+  8044d7:	5f                   	pop    %edi
+  8044d8:	5d                   	pop    %ebp
+  8044d9:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  8044da:	53                   	push   %ebx
+  8044db:	68 af 5d 80 00       	push   $0x805daf
+  8044e0:	68 a2 00 00 00       	push   $0xa2
+  8044e5:	68 a2 5d 80 00       	push   $0x805da2
+  8044ea:	e8 7e 07 00 00       	call   804c6d <_panic>
+			panic("free: %p is not allocated", va);
+  8044ef:	53                   	push   %ebx
+  8044f0:	68 88 5d 80 00       	push   $0x805d88
+  8044f5:	68 a5 00 00 00       	push   $0xa5
+  8044fa:	68 a2 5d 80 00       	push   $0x805da2
+  8044ff:	e8 69 07 00 00       	call   804c6d <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  804504:	89 de                	mov    %ebx,%esi
+  804506:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  80450c:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  804512:	89 c8                	mov    %ecx,%eax
+  804514:	c1 e8 11             	shr    $0x11,%eax
+  804517:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80451a:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  804521:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  804524:	c1 e9 0c             	shr    $0xc,%ecx
+  804527:	b8 01 00 00 00       	mov    $0x1,%eax
+  80452c:	d3 e0                	shl    %cl,%eax
+  80452e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804531:	85 c7                	test   %eax,%edi
+  804533:	74 1b                	je     804550 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  804535:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804539:	89 d8                	mov    %ebx,%eax
+  80453b:	29 f0                	sub    %esi,%eax
+  80453d:	83 e8 10             	sub    $0x10,%eax
+  804540:	99                   	cltd
+  804541:	f7 ff                	idiv   %edi
+  804543:	89 d1                	mov    %edx,%ecx
+  804545:	85 d2                	test   %edx,%edx
+  804547:	75 07                	jne    804550 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804549:	ba 10 00 00 00       	mov    $0x10,%edx
+  80454e:	eb 18                	jmp    804568 <free+0xda>
+		panic("free: %p is not allocated", va);
+  804550:	53                   	push   %ebx
+  804551:	68 88 5d 80 00       	push   $0x805d88
+  804556:	68 ad 00 00 00       	push   $0xad
+  80455b:	68 a2 5d 80 00       	push   $0x805da2
+  804560:	e8 08 07 00 00       	call   804c6d <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804565:	83 c1 01             	add    $0x1,%ecx
+  804568:	89 d0                	mov    %edx,%eax
+  80456a:	d3 e0                	shl    %cl,%eax
+  80456c:	39 c7                	cmp    %eax,%edi
+  80456e:	7f f5                	jg     804565 <free+0xd7>
+	*(void **) va = s->free;
+  804570:	8b 46 08             	mov    0x8(%esi),%eax
+  804573:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  804575:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  804578:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  80457c:	8d 58 01             	lea    0x1(%eax),%ebx
+  80457f:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  804583:	66 85 c0             	test   %ax,%ax
+  804586:	74 52                	je     8045da <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804588:	0f b7 db             	movzwl %bx,%ebx
+  80458b:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  80458f:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804594:	ba 00 00 00 00       	mov    $0x0,%edx
+  804599:	f7 ff                	idiv   %edi
+  80459b:	39 c3                	cmp    %eax,%ebx
+  80459d:	0f 85 2f ff ff ff    	jne    8044d2 <free+0x44>
+  8045a3:	8b 46 04             	mov    0x4(%esi),%eax
+  8045a6:	85 c0                	test   %eax,%eax
+  8045a8:	74 53                	je     8045fd <free+0x16f>
+		s->prev->next = s->next;
+  8045aa:	8b 16                	mov    (%esi),%edx
+  8045ac:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8045ae:	8b 06                	mov    (%esi),%eax
+  8045b0:	85 c0                	test   %eax,%eax
+  8045b2:	74 06                	je     8045ba <free+0x12c>
+		s->next->prev = s->prev;
+  8045b4:	8b 56 04             	mov    0x4(%esi),%edx
+  8045b7:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8045ba:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8045bd:	f7 d0                	not    %eax
+  8045bf:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8045c2:	21 d0                	and    %edx,%eax
+  8045c4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8045c7:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  8045ce:	89 f0                	mov    %esi,%eax
+  8045d0:	e8 fd fd ff ff       	call   8043d2 <heap_free_pages>
+  8045d5:	e9 f8 fe ff ff       	jmp    8044d2 <free+0x44>
+	s->prev = NULL;
+  8045da:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  8045e1:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  8045e8:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  8045ea:	85 c0                	test   %eax,%eax
+  8045ec:	74 03                	je     8045f1 <free+0x163>
+		slabs[c]->prev = s;
+  8045ee:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  8045f1:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  8045f8:	e9 d5 fe ff ff       	jmp    8044d2 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8045fd:	8b 06                	mov    (%esi),%eax
+  8045ff:	85 c0                	test   %eax,%eax
+  804601:	0f 84 cb fe ff ff    	je     8044d2 <free+0x44>
+		slabs[c] = s->next;
+  804607:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  80460e:	8b 06                	mov    (%esi),%eax
+  804610:	eb a2                	jmp    8045b4 <free+0x126>
+
+00804612 <heap_alloc_pages>:
+{
+  804612:	55                   	push   %ebp
+  804613:	89 e5                	mov    %esp,%ebp
+  804615:	57                   	push   %edi
+  804616:	56                   	push   %esi
+  804617:	53                   	push   %ebx
+  804618:	83 ec 18             	sub    $0x18,%esp
+  80461b:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  80461d:	50                   	push   %eax
+  80461e:	e8 15 03 00 00       	call   804938 <va_alloc>
+  804623:	89 c3                	mov    %eax,%ebx
+  804625:	83 c4 10             	add    $0x10,%esp
+  804628:	85 c0                	test   %eax,%eax
+  80462a:	74 47                	je     804673 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  80462c:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804632:	89 c1                	mov    %eax,%ecx
+  804634:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  804637:	c1 e8 11             	shr    $0x11,%eax
+  80463a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80463f:	89 d7                	mov    %edx,%edi
+  804641:	d3 e7                	shl    %cl,%edi
+  804643:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  80464a:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  80464e:	89 c8                	mov    %ecx,%eax
+  804650:	c1 e8 05             	shr    $0x5,%eax
+  804653:	d3 e2                	shl    %cl,%edx
+  804655:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  80465c:	83 ec 0c             	sub    $0xc,%esp
+  80465f:	6a 00                	push   $0x0
+  804661:	6a 07                	push   $0x7
+  804663:	56                   	push   %esi
+  804664:	53                   	push   %ebx
+  804665:	6a 00                	push   $0x0
+  804667:	e8 3a f7 ff ff       	call   803da6 <page_alloc_range>
+  80466c:	83 c4 20             	add    $0x20,%esp
+  80466f:	85 c0                	test   %eax,%eax
+  804671:	78 0a                	js     80467d <heap_alloc_pages+0x6b>
+}
+  804673:	89 d8                	mov    %ebx,%eax
+  804675:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804678:	5b                   	pop    %ebx
+  804679:	5e                   	pop    %esi
+  80467a:	5f                   	pop    %edi
+  80467b:	5d                   	pop    %ebp
+  80467c:	c3                   	ret
+		free(va);
+  80467d:	83 ec 0c             	sub    $0xc,%esp
+  804680:	53                   	push   %ebx
+  804681:	e8 08 fe ff ff       	call   80448e <free>
+		return NULL;
+  804686:	83 c4 10             	add    $0x10,%esp
+  804689:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80468e:	eb e3                	jmp    804673 <heap_alloc_pages+0x61>
+
+00804690 <malloc>:
+{
+  804690:	55                   	push   %ebp
+  804691:	89 e5                	mov    %esp,%ebp
+  804693:	57                   	push   %edi
+  804694:	56                   	push   %esi
+  804695:	53                   	push   %ebx
+  804696:	83 ec 1c             	sub    $0x1c,%esp
+  804699:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  80469c:	8d 50 ff             	lea    -0x1(%eax),%edx
+  80469f:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  8046a5:	0f 87 21 01 00 00    	ja     8047cc <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8046ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8046b0:	ba 10 00 00 00       	mov    $0x10,%edx
+  8046b5:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  8046b7:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8046bc:	76 15                	jbe    8046d3 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  8046be:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8046c3:	c1 e8 0c             	shr    $0xc,%eax
+  8046c6:	e8 47 ff ff ff       	call   804612 <heap_alloc_pages>
+  8046cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8046ce:	eb 37                	jmp    804707 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  8046d0:	83 c1 01             	add    $0x1,%ecx
+  8046d3:	89 d6                	mov    %edx,%esi
+  8046d5:	d3 e6                	shl    %cl,%esi
+  8046d7:	39 c6                	cmp    %eax,%esi
+  8046d9:	72 f5                	jb     8046d0 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  8046db:	89 cb                	mov    %ecx,%ebx
+  8046dd:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  8046e4:	85 ff                	test   %edi,%edi
+  8046e6:	74 2a                	je     804712 <malloc+0x82>
+	v = s->free;
+  8046e8:	8b 47 08             	mov    0x8(%edi),%eax
+  8046eb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  8046ee:	8b 00                	mov    (%eax),%eax
+  8046f0:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  8046f3:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  8046f7:	83 e8 01             	sub    $0x1,%eax
+  8046fa:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  8046fe:	66 85 c0             	test   %ax,%ax
+  804701:	0f 84 9a 00 00 00    	je     8047a1 <malloc+0x111>
+}
+  804707:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80470a:	83 c4 1c             	add    $0x1c,%esp
+  80470d:	5b                   	pop    %ebx
+  80470e:	5e                   	pop    %esi
+  80470f:	5f                   	pop    %edi
+  804710:	5d                   	pop    %ebp
+  804711:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  804712:	b8 01 00 00 00       	mov    $0x1,%eax
+  804717:	e8 f6 fe ff ff       	call   804612 <heap_alloc_pages>
+  80471c:	89 c1                	mov    %eax,%ecx
+  80471e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804721:	85 c0                	test   %eax,%eax
+  804723:	74 e2                	je     804707 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804725:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  80472b:	89 c8                	mov    %ecx,%eax
+  80472d:	c1 e8 11             	shr    $0x11,%eax
+  804730:	c1 e9 0c             	shr    $0xc,%ecx
+  804733:	ba 01 00 00 00       	mov    $0x1,%edx
+  804738:	d3 e2                	shl    %cl,%edx
+  80473a:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804741:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804744:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  804748:	0f b7 f6             	movzwl %si,%esi
+  80474b:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804750:	ba 00 00 00 00       	mov    $0x0,%edx
+  804755:	f7 fe                	idiv   %esi
+  804757:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  80475b:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  80475e:	85 c0                	test   %eax,%eax
+  804760:	74 14                	je     804776 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  804762:	83 e8 01             	sub    $0x1,%eax
+  804765:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804769:	0f af d0             	imul   %eax,%edx
+  80476c:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804770:	89 3a                	mov    %edi,(%edx)
+  804772:	89 d7                	mov    %edx,%edi
+  804774:	eb e5                	jmp    80475b <malloc+0xcb>
+	s->prev = NULL;
+  804776:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804779:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804780:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  804787:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804789:	85 c0                	test   %eax,%eax
+  80478b:	74 03                	je     804790 <malloc+0x100>
+		slabs[c]->prev = s;
+  80478d:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804790:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804793:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  80479a:	89 c7                	mov    %eax,%edi
+  80479c:	e9 47 ff ff ff       	jmp    8046e8 <malloc+0x58>
+	if (s->prev)
+  8047a1:	8b 47 04             	mov    0x4(%edi),%eax
+  8047a4:	85 c0                	test   %eax,%eax
+  8047a6:	74 19                	je     8047c1 <malloc+0x131>
+		s->prev->next = s->next;
+  8047a8:	8b 17                	mov    (%edi),%edx
+  8047aa:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8047ac:	8b 07                	mov    (%edi),%eax
+  8047ae:	85 c0                	test   %eax,%eax
+  8047b0:	0f 84 51 ff ff ff    	je     804707 <malloc+0x77>
+		s->next->prev = s->prev;
+  8047b6:	8b 57 04             	mov    0x4(%edi),%edx
+  8047b9:	89 50 04             	mov    %edx,0x4(%eax)
+  8047bc:	e9 46 ff ff ff       	jmp    804707 <malloc+0x77>
+		slabs[c] = s->next;
+  8047c1:	8b 07                	mov    (%edi),%eax
+  8047c3:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  8047ca:	eb e0                	jmp    8047ac <malloc+0x11c>
+		return NULL;
+  8047cc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8047d3:	e9 2f ff ff ff       	jmp    804707 <malloc+0x77>
+
+008047d8 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  8047d8:	55                   	push   %ebp
+  8047d9:	89 e5                	mov    %esp,%ebp
+  8047db:	57                   	push   %edi
+  8047dc:	56                   	push   %esi
+  8047dd:	53                   	push   %ebx
+  8047de:	83 ec 0c             	sub    $0xc,%esp
+  8047e1:	89 c6                	mov    %eax,%esi
+  8047e3:	89 d7                	mov    %edx,%edi
+  8047e5:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8047e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8047ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047f2:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  8047f7:	83 ef 01             	sub    $0x1,%edi
+  8047fa:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8047fd:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  804800:	eb 34                	jmp    804836 <va_chunk_scan+0x5e>
+			i += 31;
+  804802:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  804805:	89 ca                	mov    %ecx,%edx
+			continue;
+  804807:	eb 23                	jmp    80482c <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804809:	89 c7                	mov    %eax,%edi
+  80480b:	c1 ef 05             	shr    $0x5,%edi
+  80480e:	be 01 00 00 00       	mov    $0x1,%esi
+  804813:	d3 e6                	shl    %cl,%esi
+  804815:	89 f1                	mov    %esi,%ecx
+  804817:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80481a:	23 0c be             	and    (%esi,%edi,4),%ecx
+  80481d:	75 41                	jne    804860 <va_chunk_scan+0x88>
+			len++;
+  80481f:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804822:	39 d3                	cmp    %edx,%ebx
+  804824:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  804827:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  80482a:	72 2d                	jb     804859 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  80482c:	83 c0 01             	add    $0x1,%eax
+  80482f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804834:	77 31                	ja     804867 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  804836:	89 c1                	mov    %eax,%ecx
+  804838:	83 e1 1f             	and    $0x1f,%ecx
+  80483b:	75 cc                	jne    804809 <va_chunk_scan+0x31>
+  80483d:	89 c7                	mov    %eax,%edi
+  80483f:	c1 ef 05             	shr    $0x5,%edi
+  804842:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804845:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804848:	83 ff ff             	cmp    $0xffffffff,%edi
+  80484b:	74 b5                	je     804802 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  80484d:	85 ff                	test   %edi,%edi
+  80484f:	75 b8                	jne    804809 <va_chunk_scan+0x31>
+			i += 31;
+  804851:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804854:	83 c2 20             	add    $0x20,%edx
+  804857:	eb c9                	jmp    804822 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804859:	83 c0 01             	add    $0x1,%eax
+  80485c:	29 d0                	sub    %edx,%eax
+  80485e:	eb 15                	jmp    804875 <va_chunk_scan+0x9d>
+			len = 0;
+  804860:	ba 00 00 00 00       	mov    $0x0,%edx
+  804865:	eb c5                	jmp    80482c <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804867:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  80486c:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  80486f:	85 d2                	test   %edx,%edx
+  804871:	74 02                	je     804875 <va_chunk_scan+0x9d>
+		*run_store = best;
+  804873:	89 1a                	mov    %ebx,(%edx)
+}
+  804875:	83 c4 0c             	add    $0xc,%esp
+  804878:	5b                   	pop    %ebx
+  804879:	5e                   	pop    %esi
+  80487a:	5f                   	pop    %edi
+  80487b:	5d                   	pop    %ebp
+  80487c:	c3                   	ret
+
+0080487d <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  80487d:	55                   	push   %ebp
+  80487e:	89 e5                	mov    %esp,%ebp
+  804880:	57                   	push   %edi
+  804881:	56                   	push   %esi
+  804882:	53                   	push   %ebx
+  804883:	83 ec 14             	sub    $0x14,%esp
+  804886:	89 c3                	mov    %eax,%ebx
+  804888:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  80488a:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804890:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  804896:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804899:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  80489c:	89 d6                	mov    %edx,%esi
+  80489e:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  8048a4:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  8048a6:	eb 34                	jmp    8048dc <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  8048a8:	89 c8                	mov    %ecx,%eax
+  8048aa:	c1 e8 05             	shr    $0x5,%eax
+  8048ad:	89 da                	mov    %ebx,%edx
+  8048af:	c1 e2 05             	shl    $0x5,%edx
+  8048b2:	01 da                	add    %ebx,%edx
+  8048b4:	01 c2                	add    %eax,%edx
+  8048b6:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8048bb:	d3 c0                	rol    %cl,%eax
+  8048bd:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  8048c4:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  8048cb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8048d0:	01 d0                	add    %edx,%eax
+  8048d2:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  8048d9:	83 c1 01             	add    $0x1,%ecx
+  8048dc:	39 f9                	cmp    %edi,%ecx
+  8048de:	74 30                	je     804910 <va_chunk_mark+0x93>
+		if (alloc)
+  8048e0:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8048e4:	74 c2                	je     8048a8 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  8048e6:	89 c8                	mov    %ecx,%eax
+  8048e8:	c1 e8 05             	shr    $0x5,%eax
+  8048eb:	89 da                	mov    %ebx,%edx
+  8048ed:	c1 e2 05             	shl    $0x5,%edx
+  8048f0:	01 da                	add    %ebx,%edx
+  8048f2:	01 c2                	add    %eax,%edx
+  8048f4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8048f9:	d3 e0                	shl    %cl,%eax
+  8048fb:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804902:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804909:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80490e:	eb c0                	jmp    8048d0 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804910:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804913:	ba 00 00 00 00       	mov    $0x0,%edx
+  804918:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80491b:	e8 b8 fe ff ff       	call   8047d8 <va_chunk_scan>
+	ch->run = run;
+  804920:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804926:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804929:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  804930:	83 c4 14             	add    $0x14,%esp
+  804933:	5b                   	pop    %ebx
+  804934:	5e                   	pop    %esi
+  804935:	5f                   	pop    %edi
+  804936:	5d                   	pop    %ebp
+  804937:	c3                   	ret
+
+00804938 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804938:	55                   	push   %ebp
+  804939:	89 e5                	mov    %esp,%ebp
+  80493b:	57                   	push   %edi
+  80493c:	56                   	push   %esi
+  80493d:	53                   	push   %ebx
+  80493e:	83 ec 04             	sub    $0x4,%esp
+  804941:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804944:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  804949:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  80494e:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  804955:	74 4f                	je     8049a6 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804957:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  80495a:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  80495f:	0f 87 01 01 00 00    	ja     804a66 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804965:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  80496b:	0f 87 80 00 00 00    	ja     8049f1 <va_alloc+0xb9>
+  804971:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804976:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  80497b:	0f b7 10             	movzwl (%eax),%edx
+  80497e:	05 84 00 00 00       	add    $0x84,%eax
+  804983:	39 da                	cmp    %ebx,%edx
+  804985:	73 2c                	jae    8049b3 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804987:	83 c6 01             	add    $0x1,%esi
+  80498a:	83 fe 1c             	cmp    $0x1c,%esi
+  80498d:	75 ec                	jne    80497b <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  80498f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804994:	eb 53                	jmp    8049e9 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804996:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  80499c:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  8049a1:	05 84 00 00 00       	add    $0x84,%eax
+  8049a6:	39 d0                	cmp    %edx,%eax
+  8049a8:	75 ec                	jne    804996 <va_alloc+0x5e>
+	va_inited = 1;
+  8049aa:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  8049b1:	eb a4                	jmp    804957 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  8049b3:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  8049b9:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  8049be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8049c3:	89 da                	mov    %ebx,%edx
+  8049c5:	e8 0e fe ff ff       	call   8047d8 <va_chunk_scan>
+  8049ca:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  8049cc:	6a 01                	push   $0x1
+  8049ce:	89 d9                	mov    %ebx,%ecx
+  8049d0:	89 c2                	mov    %eax,%edx
+  8049d2:	89 f0                	mov    %esi,%eax
+  8049d4:	e8 a4 fe ff ff       	call   80487d <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  8049d9:	c1 e6 16             	shl    $0x16,%esi
+  8049dc:	c1 e7 0c             	shl    $0xc,%edi
+  8049df:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  8049e6:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  8049e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8049ec:	5b                   	pop    %ebx
+  8049ed:	5e                   	pop    %esi
+  8049ee:	5f                   	pop    %edi
+  8049ef:	5d                   	pop    %ebp
+  8049f0:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  8049f1:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  8049f7:	c1 ee 0a             	shr    $0xa,%esi
+  8049fa:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  8049ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a04:	eb 0a                	jmp    804a10 <va_alloc+0xd8>
+			first = c + 1;
+  804a06:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804a08:	83 c2 01             	add    $0x1,%edx
+  804a0b:	83 fa 1d             	cmp    $0x1d,%edx
+  804a0e:	74 4f                	je     804a5f <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804a10:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804a16:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  804a1d:	00 04 
+  804a1f:	75 e5                	jne    804a06 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804a21:	89 d1                	mov    %edx,%ecx
+  804a23:	29 c1                	sub    %eax,%ecx
+  804a25:	39 f1                	cmp    %esi,%ecx
+  804a27:	75 df                	jne    804a08 <va_alloc+0xd0>
+  804a29:	89 c7                	mov    %eax,%edi
+  804a2b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804a2e:	be 00 04 00 00       	mov    $0x400,%esi
+  804a33:	39 f3                	cmp    %esi,%ebx
+  804a35:	0f 46 f3             	cmovbe %ebx,%esi
+  804a38:	6a 01                	push   $0x1
+  804a3a:	89 f1                	mov    %esi,%ecx
+  804a3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a41:	89 f8                	mov    %edi,%eax
+  804a43:	e8 35 fe ff ff       	call   80487d <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804a48:	83 c7 01             	add    $0x1,%edi
+  804a4b:	83 c4 04             	add    $0x4,%esp
+  804a4e:	29 f3                	sub    %esi,%ebx
+  804a50:	75 dc                	jne    804a2e <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804a52:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804a55:	c1 e0 16             	shl    $0x16,%eax
+  804a58:	05 00 00 00 08       	add    $0x8000000,%eax
+  804a5d:	eb 8a                	jmp    8049e9 <va_alloc+0xb1>
+	return NULL;
+  804a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a64:	eb 83                	jmp    8049e9 <va_alloc+0xb1>
+		return NULL;
+  804a66:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a6b:	e9 79 ff ff ff       	jmp    8049e9 <va_alloc+0xb1>
+
+00804a70 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804a70:	55                   	push   %ebp
+  804a71:	89 e5                	mov    %esp,%ebp
+  804a73:	57                   	push   %edi
+  804a74:	56                   	push   %esi
+  804a75:	53                   	push   %ebx
+  804a76:	83 ec 0c             	sub    $0xc,%esp
+  804a79:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804a7c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804a7f:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804a85:	76 21                	jbe    804aa8 <va_free+0x38>
+  804a87:	89 f0                	mov    %esi,%eax
+  804a89:	c1 e0 0c             	shl    $0xc,%eax
+  804a8c:	01 f8                	add    %edi,%eax
+  804a8e:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804a93:	77 13                	ja     804aa8 <va_free+0x38>
+	    || PGOFF(va))
+  804a95:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804a9b:	75 0b                	jne    804aa8 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804a9d:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804aa3:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804aa6:	eb 45                	jmp    804aed <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804aa8:	83 ec 0c             	sub    $0xc,%esp
+  804aab:	56                   	push   %esi
+  804aac:	57                   	push   %edi
+  804aad:	68 cc 5d 80 00       	push   $0x805dcc
+  804ab2:	68 8e 00 00 00       	push   $0x8e
+  804ab7:	68 ec 5d 80 00       	push   $0x805dec
+  804abc:	e8 ac 01 00 00       	call   804c6d <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804ac1:	89 fa                	mov    %edi,%edx
+  804ac3:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804ac9:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804ace:	29 d3                	sub    %edx,%ebx
+  804ad0:	39 f3                	cmp    %esi,%ebx
+  804ad2:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804ad5:	89 f8                	mov    %edi,%eax
+  804ad7:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804ada:	83 ec 0c             	sub    $0xc,%esp
+  804add:	6a 00                	push   $0x0
+  804adf:	89 d9                	mov    %ebx,%ecx
+  804ae1:	e8 97 fd ff ff       	call   80487d <va_chunk_mark>
+		i += n;
+  804ae6:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804ae8:	29 de                	sub    %ebx,%esi
+  804aea:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804aed:	85 f6                	test   %esi,%esi
+  804aef:	75 d0                	jne    804ac1 <va_free+0x51>
+	}
+}
+  804af1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804af4:	5b                   	pop    %ebx
+  804af5:	5e                   	pop    %esi
+  804af6:	5f                   	pop    %edi
+  804af7:	5d                   	pop    %ebp
+  804af8:	c3                   	ret
+
+00804af9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804af9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804afe:	c3                   	ret
+
+00804aff <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804aff:	55                   	push   %ebp
+  804b00:	89 e5                	mov    %esp,%ebp
+  804b02:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804b05:	68 f9 5d 80 00       	push   $0x805df9
+  804b0a:	ff 75 0c             	push   0xc(%ebp)
+  804b0d:	e8 82 bc ff ff       	call   800794 <strcpy>
+	return 0;
+}
+  804b12:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b17:	c9                   	leave
+  804b18:	c3                   	ret
+
+00804b19 <devcons_write>:
+{
+  804b19:	55                   	push   %ebp
+  804b1a:	89 e5                	mov    %esp,%ebp
+  804b1c:	57                   	push   %edi
+  804b1d:	56                   	push   %esi
+  804b1e:	53                   	push   %ebx
+  804b1f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804b25:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804b2a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804b30:	eb 2e                	jmp    804b60 <devcons_write+0x47>
+		m = n - tot;
+  804b32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804b35:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804b37:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804b3c:	39 c3                	cmp    %eax,%ebx
+  804b3e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804b41:	83 ec 04             	sub    $0x4,%esp
+  804b44:	53                   	push   %ebx
+  804b45:	89 f0                	mov    %esi,%eax
+  804b47:	03 45 0c             	add    0xc(%ebp),%eax
+  804b4a:	50                   	push   %eax
+  804b4b:	57                   	push   %edi
+  804b4c:	e8 c9 bd ff ff       	call   80091a <memmove>
+		sys_cputs(buf, m);
+  804b51:	83 c4 08             	add    $0x8,%esp
+  804b54:	53                   	push   %ebx
+  804b55:	57                   	push   %edi
+  804b56:	e8 5f c0 ff ff       	call   800bba <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804b5b:	01 de                	add    %ebx,%esi
+  804b5d:	83 c4 10             	add    $0x10,%esp
+  804b60:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804b63:	72 cd                	jb     804b32 <devcons_write+0x19>
+}
+  804b65:	89 f0                	mov    %esi,%eax
+  804b67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b6a:	5b                   	pop    %ebx
+  804b6b:	5e                   	pop    %esi
+  804b6c:	5f                   	pop    %edi
+  804b6d:	5d                   	pop    %ebp
+  804b6e:	c3                   	ret
+
+00804b6f <devcons_read>:
+{
+  804b6f:	55                   	push   %ebp
+  804b70:	89 e5                	mov    %esp,%ebp
+  804b72:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804b75:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b7a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804b7e:	75 07                	jne    804b87 <devcons_read+0x18>
+  804b80:	eb 1f                	jmp    804ba1 <devcons_read+0x32>
+		sys_yield();
+  804b82:	e8 e1 c0 ff ff       	call   800c68 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804b87:	e8 5d c0 ff ff       	call   800be9 <sys_cgetc>
+  804b8c:	85 c0                	test   %eax,%eax
+  804b8e:	74 f2                	je     804b82 <devcons_read+0x13>
+	if (c < 0)
+  804b90:	78 0f                	js     804ba1 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804b92:	83 f8 04             	cmp    $0x4,%eax
+  804b95:	74 0c                	je     804ba3 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804b97:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804b9a:	88 02                	mov    %al,(%edx)
+	return 1;
+  804b9c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804ba1:	c9                   	leave
+  804ba2:	c3                   	ret
+		return 0;
+  804ba3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ba8:	eb f7                	jmp    804ba1 <devcons_read+0x32>
+
+00804baa <cputchar>:
+{
+  804baa:	55                   	push   %ebp
+  804bab:	89 e5                	mov    %esp,%ebp
+  804bad:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804bb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  804bb3:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804bb6:	6a 01                	push   $0x1
+  804bb8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804bbb:	50                   	push   %eax
+  804bbc:	e8 f9 bf ff ff       	call   800bba <sys_cputs>
+}
+  804bc1:	83 c4 10             	add    $0x10,%esp
+  804bc4:	c9                   	leave
+  804bc5:	c3                   	ret
+
+00804bc6 <getchar>:
+{
+  804bc6:	55                   	push   %ebp
+  804bc7:	89 e5                	mov    %esp,%ebp
+  804bc9:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804bcc:	6a 01                	push   $0x1
+  804bce:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804bd1:	50                   	push   %eax
+  804bd2:	6a 00                	push   $0x0
+  804bd4:	e8 d7 ce ff ff       	call   801ab0 <read>
+	if (r < 0)
+  804bd9:	83 c4 10             	add    $0x10,%esp
+  804bdc:	85 c0                	test   %eax,%eax
+  804bde:	78 06                	js     804be6 <getchar+0x20>
+	if (r < 1)
+  804be0:	74 06                	je     804be8 <getchar+0x22>
+	return c;
+  804be2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804be6:	c9                   	leave
+  804be7:	c3                   	ret
+		return -E_EOF;
+  804be8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804bed:	eb f7                	jmp    804be6 <getchar+0x20>
+
+00804bef <iscons>:
+{
+  804bef:	55                   	push   %ebp
+  804bf0:	89 e5                	mov    %esp,%ebp
+  804bf2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804bf5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804bf8:	50                   	push   %eax
+  804bf9:	ff 75 08             	push   0x8(%ebp)
+  804bfc:	e8 50 cc ff ff       	call   801851 <fd_lookup>
+  804c01:	83 c4 10             	add    $0x10,%esp
+  804c04:	85 c0                	test   %eax,%eax
+  804c06:	78 11                	js     804c19 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804c08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804c0b:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804c11:	39 10                	cmp    %edx,(%eax)
+  804c13:	0f 94 c0             	sete   %al
+  804c16:	0f b6 c0             	movzbl %al,%eax
+}
+  804c19:	c9                   	leave
+  804c1a:	c3                   	ret
+
+00804c1b <opencons>:
+{
+  804c1b:	55                   	push   %ebp
+  804c1c:	89 e5                	mov    %esp,%ebp
+  804c1e:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804c21:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804c24:	50                   	push   %eax
+  804c25:	e8 d3 cb ff ff       	call   8017fd <fd_alloc>
+  804c2a:	83 c4 10             	add    $0x10,%esp
+  804c2d:	85 c0                	test   %eax,%eax
+  804c2f:	78 3a                	js     804c6b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804c31:	83 ec 04             	sub    $0x4,%esp
+  804c34:	68 07 04 00 00       	push   $0x407
+  804c39:	ff 75 f4             	push   -0xc(%ebp)
+  804c3c:	6a 00                	push   $0x0
+  804c3e:	e8 44 c0 ff ff       	call   800c87 <sys_page_alloc>
+  804c43:	83 c4 10             	add    $0x10,%esp
+  804c46:	85 c0                	test   %eax,%eax
+  804c48:	78 21                	js     804c6b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804c4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804c4d:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804c53:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804c55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804c58:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804c5f:	83 ec 0c             	sub    $0xc,%esp
+  804c62:	50                   	push   %eax
+  804c63:	e8 6e cb ff ff       	call   8017d6 <fd2num>
+  804c68:	83 c4 10             	add    $0x10,%esp
+}
+  804c6b:	c9                   	leave
+  804c6c:	c3                   	ret
+
+00804c6d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  804c6d:	55                   	push   %ebp
+  804c6e:	89 e5                	mov    %esp,%ebp
+  804c70:	56                   	push   %esi
+  804c71:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  804c72:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  804c75:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  804c7b:	e8 c9 bf ff ff       	call   800c49 <sys_getenvid>
+  804c80:	83 ec 0c             	sub    $0xc,%esp
+  804c83:	ff 75 0c             	push   0xc(%ebp)
+  804c86:	ff 75 08             	push   0x8(%ebp)
+  804c89:	56                   	push   %esi
+  804c8a:	50                   	push   %eax
+  804c8b:	68 08 5e 80 00       	push   $0x805e08
+  804c90:	e8 18 b5 ff ff       	call   8001ad <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  804c95:	83 c4 18             	add    $0x18,%esp
+  804c98:	53                   	push   %ebx
+  804c99:	ff 75 10             	push   0x10(%ebp)
+  804c9c:	e8 bb b4 ff ff       	call   80015c <vcprintf>
+	cprintf("\n");
+  804ca1:	c7 04 24 34 53 80 00 	movl   $0x805334,(%esp)
+  804ca8:	e8 00 b5 ff ff       	call   8001ad <cprintf>
+  804cad:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  804cb0:	cc                   	int3
+	while (1)
+  804cb1:	eb fd                	jmp    804cb0 <_panic+0x43>
+
+00804cb3 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804cb3:	55                   	push   %ebp
+  804cb4:	89 e5                	mov    %esp,%ebp
+  804cb6:	56                   	push   %esi
+  804cb7:	53                   	push   %ebx
+  804cb8:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804cbb:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  804cc0:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804cc3:	85 db                	test   %ebx,%ebx
+  804cc5:	78 17                	js     804cde <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804cc7:	83 ec 0c             	sub    $0xc,%esp
+  804cca:	56                   	push   %esi
+  804ccb:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  804cd2:	83 c4 10             	add    $0x10,%esp
+  804cd5:	85 c0                	test   %eax,%eax
+  804cd7:	75 27                	jne    804d00 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804cd9:	83 eb 01             	sub    $0x1,%ebx
+  804cdc:	eb e5                	jmp    804cc3 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804cde:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804ce3:	8b 40 48             	mov    0x48(%eax),%eax
+  804ce6:	83 ec 08             	sub    $0x8,%esp
+  804ce9:	ff 76 28             	push   0x28(%esi)
+  804cec:	ff 36                	push   (%esi)
+  804cee:	50                   	push   %eax
+  804cef:	68 2c 5e 80 00       	push   $0x805e2c
+  804cf4:	6a 1d                	push   $0x1d
+  804cf6:	68 4f 5e 80 00       	push   $0x805e4f
+  804cfb:	e8 6d ff ff ff       	call   804c6d <_panic>
+}
+  804d00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804d03:	5b                   	pop    %ebx
+  804d04:	5e                   	pop    %esi
+  804d05:	5d                   	pop    %ebp
+  804d06:	c3                   	ret
+
+00804d07 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804d07:	55                   	push   %ebp
+  804d08:	89 e5                	mov    %esp,%ebp
+  804d0a:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804d0d:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  804d14:	74 0a                	je     804d20 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804d16:	8b 45 08             	mov    0x8(%ebp),%eax
+  804d19:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  804d1e:	c9                   	leave
+  804d1f:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804d20:	83 ec 04             	sub    $0x4,%esp
+  804d23:	6a 07                	push   $0x7
+  804d25:	68 00 f0 bf ee       	push   $0xeebff000
+  804d2a:	6a 00                	push   $0x0
+  804d2c:	e8 56 bf ff ff       	call   800c87 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804d31:	83 c4 08             	add    $0x8,%esp
+  804d34:	68 a7 4d 80 00       	push   $0x804da7
+  804d39:	6a 00                	push   $0x0
+  804d3b:	e8 ad c2 ff ff       	call   800fed <sys_env_set_pgfault_upcall>
+  804d40:	83 c4 10             	add    $0x10,%esp
+  804d43:	eb d1                	jmp    804d16 <set_pgfault_handler+0xf>
+
+00804d45 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804d45:	55                   	push   %ebp
+  804d46:	89 e5                	mov    %esp,%ebp
+  804d48:	83 ec 08             	sub    $0x8,%esp
+  804d4b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  804d4e:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  804d54:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d59:	eb 03                	jmp    804d5e <add_pgfault_handler+0x19>
+  804d5b:	83 c0 01             	add    $0x1,%eax
+  804d5e:	39 d0                	cmp    %edx,%eax
+  804d60:	74 0b                	je     804d6d <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804d62:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  804d69:	75 f0                	jne    804d5b <add_pgfault_handler+0x16>
+  804d6b:	eb 24                	jmp    804d91 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  804d6d:	83 fa 0a             	cmp    $0xa,%edx
+  804d70:	74 21                	je     804d93 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  804d72:	8d 42 01             	lea    0x1(%edx),%eax
+  804d75:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  804d7a:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  804d81:	83 ec 0c             	sub    $0xc,%esp
+  804d84:	68 b3 4c 80 00       	push   $0x804cb3
+  804d89:	e8 79 ff ff ff       	call   804d07 <set_pgfault_handler>
+  804d8e:	83 c4 10             	add    $0x10,%esp
+}
+  804d91:	c9                   	leave
+  804d92:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  804d93:	83 ec 04             	sub    $0x4,%esp
+  804d96:	68 5d 5e 80 00       	push   $0x805e5d
+  804d9b:	6a 44                	push   $0x44
+  804d9d:	68 4f 5e 80 00       	push   $0x805e4f
+  804da2:	e8 c6 fe ff ff       	call   804c6d <_panic>
+
+00804da7 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804da7:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804da8:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  804dad:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804daf:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  804db2:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  804db6:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  804dba:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  804dbd:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  804dbf:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  804dc3:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  804dc6:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  804dc7:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  804dca:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  804dcb:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  804dcc:	c3                   	ret
+
+00804dcd <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  804dcd:	55                   	push   %ebp
+  804dce:	89 e5                	mov    %esp,%ebp
+  804dd0:	57                   	push   %edi
+  804dd1:	56                   	push   %esi
+  804dd2:	53                   	push   %ebx
+  804dd3:	83 ec 14             	sub    $0x14,%esp
+  804dd6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804dd9:	8b 75 14             	mov    0x14(%ebp),%esi
+  804ddc:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804ddf:	ff 75 10             	push   0x10(%ebp)
+  804de2:	ff 75 0c             	push   0xc(%ebp)
+  804de5:	e8 c0 c2 ff ff       	call   8010aa <sys_ipc_recv_pages>
+  804dea:	83 c4 10             	add    $0x10,%esp
+  804ded:	85 c0                	test   %eax,%eax
+  804def:	78 46                	js     804e37 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804df1:	85 ff                	test   %edi,%edi
+  804df3:	74 0d                	je     804e02 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804df5:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804dfa:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804e00:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804e02:	85 f6                	test   %esi,%esi
+  804e04:	74 0d                	je     804e13 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804e06:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804e0b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804e11:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804e13:	85 db                	test   %ebx,%ebx
+  804e15:	74 0d                	je     804e24 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804e17:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804e1c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804e22:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804e24:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804e29:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804e2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804e32:	5b                   	pop    %ebx
+  804e33:	5e                   	pop    %esi
+  804e34:	5f                   	pop    %edi
+  804e35:	5d                   	pop    %ebp
+  804e36:	c3                   	ret
+		if (from_env_store) {
+  804e37:	85 ff                	test   %edi,%edi
+  804e39:	74 06                	je     804e41 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  804e3b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804e41:	85 f6                	test   %esi,%esi
+  804e43:	74 06                	je     804e4b <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804e45:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804e4b:	85 db                	test   %ebx,%ebx
+  804e4d:	74 e0                	je     804e2f <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  804e4f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804e55:	eb d8                	jmp    804e2f <ipc_recv_pages+0x62>
+
+00804e57 <ipc_recv>:
+{
+  804e57:	55                   	push   %ebp
+  804e58:	89 e5                	mov    %esp,%ebp
+  804e5a:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  804e5d:	6a 00                	push   $0x0
+  804e5f:	ff 75 10             	push   0x10(%ebp)
+  804e62:	6a 01                	push   $0x1
+  804e64:	ff 75 0c             	push   0xc(%ebp)
+  804e67:	ff 75 08             	push   0x8(%ebp)
+  804e6a:	e8 5e ff ff ff       	call   804dcd <ipc_recv_pages>
+}
+  804e6f:	c9                   	leave
+  804e70:	c3                   	ret
+
+00804e71 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804e71:	55                   	push   %ebp
+  804e72:	89 e5                	mov    %esp,%ebp
+  804e74:	56                   	push   %esi
+  804e75:	53                   	push   %ebx
+  804e76:	8b 75 08             	mov    0x8(%ebp),%esi
+  804e79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  804e7c:	83 ec 0c             	sub    $0xc,%esp
+  804e7f:	ff 75 0c             	push   0xc(%ebp)
+  804e82:	e8 57 c3 ff ff       	call   8011de <sys_ipc_try_recv>
+  804e87:	83 c4 10             	add    $0x10,%esp
+  804e8a:	85 c0                	test   %eax,%eax
+  804e8c:	78 34                	js     804ec2 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804e8e:	85 f6                	test   %esi,%esi
+  804e90:	74 0d                	je     804e9f <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  804e92:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804e97:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804e9d:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  804e9f:	85 db                	test   %ebx,%ebx
+  804ea1:	74 0d                	je     804eb0 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  804ea3:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804ea8:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804eae:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804eb0:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804eb5:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804ebb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804ebe:	5b                   	pop    %ebx
+  804ebf:	5e                   	pop    %esi
+  804ec0:	5d                   	pop    %ebp
+  804ec1:	c3                   	ret
+		if (from_env_store) {
+  804ec2:	85 f6                	test   %esi,%esi
+  804ec4:	74 06                	je     804ecc <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  804ec6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  804ecc:	85 db                	test   %ebx,%ebx
+  804ece:	74 eb                	je     804ebb <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  804ed0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804ed6:	eb e3                	jmp    804ebb <ipc_try_recv+0x4a>
+
+00804ed8 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804ed8:	55                   	push   %ebp
+  804ed9:	89 e5                	mov    %esp,%ebp
+  804edb:	83 ec 14             	sub    $0x14,%esp
+  804ede:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804ee1:	85 c0                	test   %eax,%eax
+  804ee3:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804ee8:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804eeb:	ff 75 18             	push   0x18(%ebp)
+  804eee:	ff 75 14             	push   0x14(%ebp)
+  804ef1:	50                   	push   %eax
+  804ef2:	ff 75 0c             	push   0xc(%ebp)
+  804ef5:	ff 75 08             	push   0x8(%ebp)
+  804ef8:	e8 70 c1 ff ff       	call   80106d <sys_ipc_send_pages>
+  804efd:	83 c4 20             	add    $0x20,%esp
+  804f00:	85 c0                	test   %eax,%eax
+  804f02:	78 02                	js     804f06 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804f04:	c9                   	leave
+  804f05:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804f06:	50                   	push   %eax
+  804f07:	68 78 5e 80 00       	push   $0x805e78
+  804f0c:	68 80 00 00 00       	push   $0x80
+  804f11:	68 a4 5e 80 00       	push   $0x805ea4
+  804f16:	e8 52 fd ff ff       	call   804c6d <_panic>
+
+00804f1b <ipc_send>:
+{
+  804f1b:	55                   	push   %ebp
+  804f1c:	89 e5                	mov    %esp,%ebp
+  804f1e:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  804f21:	ff 75 14             	push   0x14(%ebp)
+  804f24:	6a 01                	push   $0x1
+  804f26:	ff 75 10             	push   0x10(%ebp)
+  804f29:	ff 75 0c             	push   0xc(%ebp)
+  804f2c:	ff 75 08             	push   0x8(%ebp)
+  804f2f:	e8 a4 ff ff ff       	call   804ed8 <ipc_send_pages>
+}
+  804f34:	83 c4 20             	add    $0x20,%esp
+  804f37:	c9                   	leave
+  804f38:	c3                   	ret
+
+00804f39 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804f39:	55                   	push   %ebp
+  804f3a:	89 e5                	mov    %esp,%ebp
+  804f3c:	83 ec 14             	sub    $0x14,%esp
+  804f3f:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804f42:	85 c0                	test   %eax,%eax
+  804f44:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804f49:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804f4c:	ff 75 18             	push   0x18(%ebp)
+  804f4f:	ff 75 14             	push   0x14(%ebp)
+  804f52:	50                   	push   %eax
+  804f53:	ff 75 0c             	push   0xc(%ebp)
+  804f56:	ff 75 08             	push   0x8(%ebp)
+  804f59:	e8 a0 c1 ff ff       	call   8010fe <sys_ipc_call>
+  804f5e:	83 c4 20             	add    $0x20,%esp
+  804f61:	85 c0                	test   %eax,%eax
+  804f63:	78 0b                	js     804f70 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  804f65:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804f6a:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804f70:	c9                   	leave
+  804f71:	c3                   	ret
+
+00804f72 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  804f72:	55                   	push   %ebp
+  804f73:	89 e5                	mov    %esp,%ebp
+  804f75:	57                   	push   %edi
+  804f76:	56                   	push   %esi
+  804f77:	53                   	push   %ebx
+  804f78:	83 ec 18             	sub    $0x18,%esp
+  804f7b:	8b 45 10             	mov    0x10(%ebp),%eax
+  804f7e:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  804f81:	8b 75 20             	mov    0x20(%ebp),%esi
+  804f84:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804f87:	85 c0                	test   %eax,%eax
+  804f89:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804f8e:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804f91:	ff 75 18             	push   0x18(%ebp)
+  804f94:	ff 75 14             	push   0x14(%ebp)
+  804f97:	50                   	push   %eax
+  804f98:	ff 75 0c             	push   0xc(%ebp)
+  804f9b:	ff 75 08             	push   0x8(%ebp)
+  804f9e:	e8 9c c1 ff ff       	call   80113f <sys_ipc_reply_recv>
+  804fa3:	83 c4 20             	add    $0x20,%esp
+  804fa6:	85 c0                	test   %eax,%eax
+  804fa8:	78 46                	js     804ff0 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804faa:	85 ff                	test   %edi,%edi
+  804fac:	74 0d                	je     804fbb <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  804fae:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804fb3:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804fb9:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804fbb:	85 f6                	test   %esi,%esi
+  804fbd:	74 0d                	je     804fcc <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  804fbf:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804fc4:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804fca:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804fcc:	85 db                	test   %ebx,%ebx
+  804fce:	74 0d                	je     804fdd <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  804fd0:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804fd5:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804fdb:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804fdd:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804fe2:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804fe8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804feb:	5b                   	pop    %ebx
+  804fec:	5e                   	pop    %esi
+  804fed:	5f                   	pop    %edi
+  804fee:	5d                   	pop    %ebp
+  804fef:	c3                   	ret
+		if (from_env_store) {
+  804ff0:	85 ff                	test   %edi,%edi
+  804ff2:	74 06                	je     804ffa <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  804ff4:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804ffa:	85 f6                	test   %esi,%esi
+  804ffc:	74 06                	je     805004 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  804ffe:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  805004:	85 db                	test   %ebx,%ebx
+  805006:	74 e0                	je     804fe8 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  805008:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80500e:	eb d8                	jmp    804fe8 <ipc_reply_recv+0x76>
+
+00805010 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805010:	55                   	push   %ebp
+  805011:	89 e5                	mov    %esp,%ebp
+  805013:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  805016:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80501b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80501e:	c1 e0 06             	shl    $0x6,%eax
+  805021:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805026:	8b 40 50             	mov    0x50(%eax),%eax
+  805029:	39 c8                	cmp    %ecx,%eax
+  80502b:	74 12                	je     80503f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80502d:	83 c2 01             	add    $0x1,%edx
+  805030:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  805036:	75 e3                	jne    80501b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  805038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80503d:	eb 0e                	jmp    80504d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80503f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  805042:	c1 e0 06             	shl    $0x6,%eax
+  805045:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80504a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80504d:	5d                   	pop    %ebp
+  80504e:	c3                   	ret
+
+0080504f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80504f:	55                   	push   %ebp
+  805050:	89 e5                	mov    %esp,%ebp
+  805052:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805055:	89 c2                	mov    %eax,%edx
+  805057:	c1 ea 16             	shr    $0x16,%edx
+  80505a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  805061:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805066:	f6 c1 01             	test   $0x1,%cl
+  805069:	74 1e                	je     805089 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  80506b:	c1 e8 0c             	shr    $0xc,%eax
+  80506e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  805075:	a8 01                	test   $0x1,%al
+  805077:	74 10                	je     805089 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  805079:	c1 e8 0c             	shr    $0xc,%eax
+  80507c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80507f:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  805086:	0f b7 d2             	movzwl %dx,%edx
+}
+  805089:	89 d0                	mov    %edx,%eax
+  80508b:	5d                   	pop    %ebp
+  80508c:	c3                   	ret
+
+0080508d <udivmod>:
+  80508d:	55                   	push   %ebp
+  80508e:	57                   	push   %edi
+  80508f:	56                   	push   %esi
+  805090:	53                   	push   %ebx
+  805091:	83 ec 24             	sub    $0x24,%esp
+  805094:	89 44 24 08          	mov    %eax,0x8(%esp)
+  805098:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80509c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8050a0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8050a4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8050a8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8050ac:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8050b0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8050b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050bf:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8050c6:	00 
+  8050c7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8050ce:	00 
+  8050cf:	89 fb                	mov    %edi,%ebx
+  8050d1:	eb 08                	jmp    8050db <udivmod+0x4e>
+  8050d3:	83 e9 01             	sub    $0x1,%ecx
+  8050d6:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8050d9:	74 68                	je     805143 <udivmod+0xb6>
+  8050db:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8050df:	01 c0                	add    %eax,%eax
+  8050e1:	89 c6                	mov    %eax,%esi
+  8050e3:	89 d7                	mov    %edx,%edi
+  8050e5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8050e9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8050ed:	0f ad d0             	shrd   %cl,%edx,%eax
+  8050f0:	d3 ea                	shr    %cl,%edx
+  8050f2:	f6 c1 20             	test   $0x20,%cl
+  8050f5:	74 04                	je     8050fb <udivmod+0x6e>
+  8050f7:	89 d0                	mov    %edx,%eax
+  8050f9:	31 d2                	xor    %edx,%edx
+  8050fb:	83 e0 01             	and    $0x1,%eax
+  8050fe:	89 04 24             	mov    %eax,(%esp)
+  805101:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805108:	00 
+  805109:	8b 04 24             	mov    (%esp),%eax
+  80510c:	8b 54 24 04          	mov    0x4(%esp),%edx
+  805110:	09 f0                	or     %esi,%eax
+  805112:	09 fa                	or     %edi,%edx
+  805114:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805118:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80511c:	39 f0                	cmp    %esi,%eax
+  80511e:	89 d5                	mov    %edx,%ebp
+  805120:	19 fd                	sbb    %edi,%ebp
+  805122:	72 af                	jb     8050d3 <udivmod+0x46>
+  805124:	29 f0                	sub    %esi,%eax
+  805126:	19 fa                	sbb    %edi,%edx
+  805128:	89 cf                	mov    %ecx,%edi
+  80512a:	c1 ef 05             	shr    $0x5,%edi
+  80512d:	83 e7 01             	and    $0x1,%edi
+  805130:	89 fe                	mov    %edi,%esi
+  805132:	83 f6 01             	xor    $0x1,%esi
+  805135:	d3 e6                	shl    %cl,%esi
+  805137:	d3 e7                	shl    %cl,%edi
+  805139:	09 74 24 18          	or     %esi,0x18(%esp)
+  80513d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  805141:	eb 90                	jmp    8050d3 <udivmod+0x46>
+  805143:	85 db                	test   %ebx,%ebx
+  805145:	74 05                	je     80514c <udivmod+0xbf>
+  805147:	89 03                	mov    %eax,(%ebx)
+  805149:	89 53 04             	mov    %edx,0x4(%ebx)
+  80514c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805150:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805154:	83 c4 24             	add    $0x24,%esp
+  805157:	5b                   	pop    %ebx
+  805158:	5e                   	pop    %esi
+  805159:	5f                   	pop    %edi
+  80515a:	5d                   	pop    %ebp
+  80515b:	c3                   	ret
+
+0080515c <__udivdi3>:
+  80515c:	83 ec 08             	sub    $0x8,%esp
+  80515f:	6a 00                	push   $0x0
+  805161:	ff 74 24 1c          	push   0x1c(%esp)
+  805165:	ff 74 24 1c          	push   0x1c(%esp)
+  805169:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80516d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805171:	e8 17 ff ff ff       	call   80508d <udivmod>
+  805176:	83 c4 14             	add    $0x14,%esp
+  805179:	c3                   	ret
+
+0080517a <__umoddi3>:
+  80517a:	83 ec 18             	sub    $0x18,%esp
+  80517d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805181:	50                   	push   %eax
+  805182:	ff 74 24 2c          	push   0x2c(%esp)
+  805186:	ff 74 24 2c          	push   0x2c(%esp)
+  80518a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80518e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  805192:	e8 f6 fe ff ff       	call   80508d <udivmod>
+  805197:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80519b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80519f:	83 c4 24             	add    $0x24,%esp
+  8051a2:	c3                   	ret
+
+008051a3 <__divdi3>:
+  8051a3:	55                   	push   %ebp
+  8051a4:	57                   	push   %edi
+  8051a5:	56                   	push   %esi
+  8051a6:	53                   	push   %ebx
+  8051a7:	83 ec 10             	sub    $0x10,%esp
+  8051aa:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8051ae:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8051b2:	89 c6                	mov    %eax,%esi
+  8051b4:	89 d7                	mov    %edx,%edi
+  8051b6:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8051ba:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8051be:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8051c2:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8051c6:	89 c5                	mov    %eax,%ebp
+  8051c8:	f7 dd                	neg    %ebp
+  8051ca:	89 d6                	mov    %edx,%esi
+  8051cc:	83 d6 00             	adc    $0x0,%esi
+  8051cf:	f7 de                	neg    %esi
+  8051d1:	0f 48 e8             	cmovs  %eax,%ebp
+  8051d4:	0f 49 d6             	cmovns %esi,%edx
+  8051d7:	6a 00                	push   $0x0
+  8051d9:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8051dd:	f7 de                	neg    %esi
+  8051df:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8051e3:	83 d0 00             	adc    $0x0,%eax
+  8051e6:	f7 d8                	neg    %eax
+  8051e8:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  8051ed:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  8051f2:	50                   	push   %eax
+  8051f3:	56                   	push   %esi
+  8051f4:	89 e8                	mov    %ebp,%eax
+  8051f6:	e8 92 fe ff ff       	call   80508d <udivmod>
+  8051fb:	83 c4 10             	add    $0x10,%esp
+  8051fe:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  805203:	78 08                	js     80520d <__divdi3+0x6a>
+  805205:	83 c4 0c             	add    $0xc,%esp
+  805208:	5b                   	pop    %ebx
+  805209:	5e                   	pop    %esi
+  80520a:	5f                   	pop    %edi
+  80520b:	5d                   	pop    %ebp
+  80520c:	c3                   	ret
+  80520d:	f7 d8                	neg    %eax
+  80520f:	83 d2 00             	adc    $0x0,%edx
+  805212:	f7 da                	neg    %edx
+  805214:	eb ef                	jmp    805205 <__divdi3+0x62>
+
+00805216 <__moddi3>:
+  805216:	55                   	push   %ebp
+  805217:	57                   	push   %edi
+  805218:	56                   	push   %esi
+  805219:	53                   	push   %ebx
+  80521a:	83 ec 18             	sub    $0x18,%esp
+  80521d:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  805221:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  805225:	89 f1                	mov    %esi,%ecx
+  805227:	f7 d9                	neg    %ecx
+  805229:	89 da                	mov    %ebx,%edx
+  80522b:	83 d2 00             	adc    $0x0,%edx
+  80522e:	f7 da                	neg    %edx
+  805230:	0f 48 ce             	cmovs  %esi,%ecx
+  805233:	0f 48 d3             	cmovs  %ebx,%edx
+  805236:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80523a:	50                   	push   %eax
+  80523b:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80523f:	f7 de                	neg    %esi
+  805241:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  805245:	83 d0 00             	adc    $0x0,%eax
+  805248:	f7 d8                	neg    %eax
+  80524a:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80524f:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  805254:	50                   	push   %eax
+  805255:	56                   	push   %esi
+  805256:	89 c8                	mov    %ecx,%eax
+  805258:	e8 30 fe ff ff       	call   80508d <udivmod>
+  80525d:	83 c4 10             	add    $0x10,%esp
+  805260:	85 db                	test   %ebx,%ebx
+  805262:	78 10                	js     805274 <__moddi3+0x5e>
+  805264:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805268:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80526c:	83 c4 14             	add    $0x14,%esp
+  80526f:	5b                   	pop    %ebx
+  805270:	5e                   	pop    %esi
+  805271:	5f                   	pop    %edi
+  805272:	5d                   	pop    %ebp
+  805273:	c3                   	ret
+  805274:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805278:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80527c:	f7 d8                	neg    %eax
+  80527e:	83 d2 00             	adc    $0x0,%edx
+  805281:	f7 da                	neg    %edx
+  805283:	eb e7                	jmp    80526c <__moddi3+0x56>
@@ -0,0 +1,10518 @@
+
+obj/user/stresssched.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ba 00 00 00       	call   8000eb <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+volatile int counter;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	int i, j;
+	int seen;
+	envid_t parent = sys_getenvid();
+  800038:	e8 88 0c 00 00       	call   800cc5 <sys_getenvid>
+  80003d:	89 c6                	mov    %eax,%esi
+
+	// Fork several environments
+	for (i = 0; i < 20; i++)
+  80003f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (fork() == 0)
+  800044:	e8 a1 13 00 00       	call   8013ea <fork>
+  800049:	85 c0                	test   %eax,%eax
+  80004b:	74 0f                	je     80005c <umain+0x29>
+	for (i = 0; i < 20; i++)
+  80004d:	83 c3 01             	add    $0x1,%ebx
+  800050:	83 fb 14             	cmp    $0x14,%ebx
+  800053:	75 ef                	jne    800044 <umain+0x11>
+			break;
+	if (i == 20) {
+		sys_yield();
+  800055:	e8 8a 0c 00 00       	call   800ce4 <sys_yield>
+		return;
+  80005a:	eb 71                	jmp    8000cd <umain+0x9a>
+	}
+
+	// Wait for the parent to finish forking
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  80005c:	89 f0                	mov    %esi,%eax
+  80005e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800063:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  800066:	c1 e2 06             	shl    $0x6,%edx
+  800069:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80006f:	eb 02                	jmp    800073 <umain+0x40>
+		asm volatile("pause");
+  800071:	f3 90                	pause
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  800073:	8b 42 54             	mov    0x54(%edx),%eax
+  800076:	85 c0                	test   %eax,%eax
+  800078:	75 f7                	jne    800071 <umain+0x3e>
+  80007a:	bb 0b 00 00 00       	mov    $0xb,%ebx
+  80007f:	eb 12                	jmp    800093 <umain+0x60>
+
+	// Check that one environment doesn't run on two CPUs at once
+	for (i = 0; i < 10; i++) {
+		sys_yield();
+		for (j = 0; j < 10000; j++)
+			counter++;
+  800081:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  800086:	83 c0 01             	add    $0x1,%eax
+  800089:	a3 14 e9 80 00       	mov    %eax,0x80e914
+		for (j = 0; j < 10000; j++)
+  80008e:	83 ea 01             	sub    $0x1,%edx
+  800091:	75 ee                	jne    800081 <umain+0x4e>
+	for (i = 0; i < 10; i++) {
+  800093:	83 eb 01             	sub    $0x1,%ebx
+  800096:	74 0c                	je     8000a4 <umain+0x71>
+		sys_yield();
+  800098:	e8 47 0c 00 00       	call   800ce4 <sys_yield>
+		for (j = 0; j < 10000; j++)
+  80009d:	ba 11 27 00 00       	mov    $0x2711,%edx
+  8000a2:	eb ea                	jmp    80008e <umain+0x5b>
+	}
+
+	if (counter != 10*10000)
+  8000a4:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8000a9:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  8000ae:	75 24                	jne    8000d4 <umain+0xa1>
+		panic("ran on two CPUs at once (counter is %d)", counter);
+
+	// Check that we see environments running on different CPUs
+	cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+  8000b0:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  8000b5:	8b 50 5c             	mov    0x5c(%eax),%edx
+  8000b8:	8b 40 48             	mov    0x48(%eax),%eax
+  8000bb:	83 ec 04             	sub    $0x4,%esp
+  8000be:	52                   	push   %edx
+  8000bf:	50                   	push   %eax
+  8000c0:	68 fb 52 80 00       	push   $0x8052fb
+  8000c5:	e8 5f 01 00 00       	call   800229 <cprintf>
+  8000ca:	83 c4 10             	add    $0x10,%esp
+
+}
+  8000cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000d0:	5b                   	pop    %ebx
+  8000d1:	5e                   	pop    %esi
+  8000d2:	5d                   	pop    %ebp
+  8000d3:	c3                   	ret
+		panic("ran on two CPUs at once (counter is %d)", counter);
+  8000d4:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8000d9:	50                   	push   %eax
+  8000da:	68 c0 52 80 00       	push   $0x8052c0
+  8000df:	6a 21                	push   $0x21
+  8000e1:	68 e8 52 80 00       	push   $0x8052e8
+  8000e6:	e8 63 00 00 00       	call   80014e <_panic>
+
+008000eb <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	56                   	push   %esi
+  8000ef:	53                   	push   %ebx
+  8000f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000f3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8000f6:	e8 ca 0b 00 00       	call   800cc5 <sys_getenvid>
+  8000fb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800100:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800103:	c1 e0 06             	shl    $0x6,%eax
+  800106:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80010b:	a3 1c e9 80 00       	mov    %eax,0x80e91c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800110:	85 db                	test   %ebx,%ebx
+  800112:	7e 07                	jle    80011b <libmain+0x30>
+		binaryname = argv[0];
+  800114:	8b 06                	mov    (%esi),%eax
+  800116:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  80011b:	83 ec 08             	sub    $0x8,%esp
+  80011e:	56                   	push   %esi
+  80011f:	53                   	push   %ebx
+  800120:	e8 0e ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800125:	e8 0a 00 00 00       	call   800134 <exit>
+}
+  80012a:	83 c4 10             	add    $0x10,%esp
+  80012d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800130:	5b                   	pop    %ebx
+  800131:	5e                   	pop    %esi
+  800132:	5d                   	pop    %ebp
+  800133:	c3                   	ret
+
+00800134 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800134:	55                   	push   %ebp
+  800135:	89 e5                	mov    %esp,%ebp
+  800137:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80013a:	e8 de 18 00 00       	call   801a1d <close_all>
+	sys_env_destroy(0);
+  80013f:	83 ec 0c             	sub    $0xc,%esp
+  800142:	6a 00                	push   $0x0
+  800144:	e8 3b 0b 00 00       	call   800c84 <sys_env_destroy>
+}
+  800149:	83 c4 10             	add    $0x10,%esp
+  80014c:	c9                   	leave
+  80014d:	c3                   	ret
+
+0080014e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80014e:	55                   	push   %ebp
+  80014f:	89 e5                	mov    %esp,%ebp
+  800151:	56                   	push   %esi
+  800152:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800153:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800156:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80015c:	e8 64 0b 00 00       	call   800cc5 <sys_getenvid>
+  800161:	83 ec 0c             	sub    $0xc,%esp
+  800164:	ff 75 0c             	push   0xc(%ebp)
+  800167:	ff 75 08             	push   0x8(%ebp)
+  80016a:	56                   	push   %esi
+  80016b:	50                   	push   %eax
+  80016c:	68 24 53 80 00       	push   $0x805324
+  800171:	e8 b3 00 00 00       	call   800229 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800176:	83 c4 18             	add    $0x18,%esp
+  800179:	53                   	push   %ebx
+  80017a:	ff 75 10             	push   0x10(%ebp)
+  80017d:	e8 56 00 00 00       	call   8001d8 <vcprintf>
+	cprintf("\n");
+  800182:	c7 04 24 c1 58 80 00 	movl   $0x8058c1,(%esp)
+  800189:	e8 9b 00 00 00       	call   800229 <cprintf>
+  80018e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800191:	cc                   	int3
+	while (1)
+  800192:	eb fd                	jmp    800191 <_panic+0x43>
+
+00800194 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800194:	55                   	push   %ebp
+  800195:	89 e5                	mov    %esp,%ebp
+  800197:	53                   	push   %ebx
+  800198:	83 ec 04             	sub    $0x4,%esp
+  80019b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80019e:	8b 13                	mov    (%ebx),%edx
+  8001a0:	8d 42 01             	lea    0x1(%edx),%eax
+  8001a3:	89 03                	mov    %eax,(%ebx)
+  8001a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001a8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001ac:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001b1:	74 09                	je     8001bc <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001b3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001ba:	c9                   	leave
+  8001bb:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001bc:	83 ec 08             	sub    $0x8,%esp
+  8001bf:	68 ff 00 00 00       	push   $0xff
+  8001c4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001c7:	50                   	push   %eax
+  8001c8:	e8 69 0a 00 00       	call   800c36 <sys_cputs>
+		b->idx = 0;
+  8001cd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001d3:	83 c4 10             	add    $0x10,%esp
+  8001d6:	eb db                	jmp    8001b3 <putch+0x1f>
+
+008001d8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001d8:	55                   	push   %ebp
+  8001d9:	89 e5                	mov    %esp,%ebp
+  8001db:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001e1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001e8:	00 00 00 
+	b.cnt = 0;
+  8001eb:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001f2:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001f5:	ff 75 0c             	push   0xc(%ebp)
+  8001f8:	ff 75 08             	push   0x8(%ebp)
+  8001fb:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800201:	50                   	push   %eax
+  800202:	68 94 01 80 00       	push   $0x800194
+  800207:	e8 14 01 00 00       	call   800320 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80020c:	83 c4 08             	add    $0x8,%esp
+  80020f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800215:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80021b:	50                   	push   %eax
+  80021c:	e8 15 0a 00 00       	call   800c36 <sys_cputs>
+
+	return b.cnt;
+}
+  800221:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800227:	c9                   	leave
+  800228:	c3                   	ret
+
+00800229 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800229:	55                   	push   %ebp
+  80022a:	89 e5                	mov    %esp,%ebp
+  80022c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80022f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800232:	50                   	push   %eax
+  800233:	ff 75 08             	push   0x8(%ebp)
+  800236:	e8 9d ff ff ff       	call   8001d8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80023b:	c9                   	leave
+  80023c:	c3                   	ret
+
+0080023d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80023d:	55                   	push   %ebp
+  80023e:	89 e5                	mov    %esp,%ebp
+  800240:	57                   	push   %edi
+  800241:	56                   	push   %esi
+  800242:	53                   	push   %ebx
+  800243:	83 ec 1c             	sub    $0x1c,%esp
+  800246:	89 c7                	mov    %eax,%edi
+  800248:	89 d6                	mov    %edx,%esi
+  80024a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80024d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800250:	89 d1                	mov    %edx,%ecx
+  800252:	89 c2                	mov    %eax,%edx
+  800254:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800257:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80025a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80025d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800260:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800263:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80026a:	39 c2                	cmp    %eax,%edx
+  80026c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80026f:	72 3e                	jb     8002af <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800271:	83 ec 0c             	sub    $0xc,%esp
+  800274:	ff 75 18             	push   0x18(%ebp)
+  800277:	83 eb 01             	sub    $0x1,%ebx
+  80027a:	53                   	push   %ebx
+  80027b:	50                   	push   %eax
+  80027c:	83 ec 08             	sub    $0x8,%esp
+  80027f:	ff 75 e4             	push   -0x1c(%ebp)
+  800282:	ff 75 e0             	push   -0x20(%ebp)
+  800285:	ff 75 dc             	push   -0x24(%ebp)
+  800288:	ff 75 d8             	push   -0x28(%ebp)
+  80028b:	e8 02 4f 00 00       	call   805192 <__udivdi3>
+  800290:	83 c4 18             	add    $0x18,%esp
+  800293:	52                   	push   %edx
+  800294:	50                   	push   %eax
+  800295:	89 f2                	mov    %esi,%edx
+  800297:	89 f8                	mov    %edi,%eax
+  800299:	e8 9f ff ff ff       	call   80023d <printnum>
+  80029e:	83 c4 20             	add    $0x20,%esp
+  8002a1:	eb 13                	jmp    8002b6 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002a3:	83 ec 08             	sub    $0x8,%esp
+  8002a6:	56                   	push   %esi
+  8002a7:	ff 75 18             	push   0x18(%ebp)
+  8002aa:	ff d7                	call   *%edi
+  8002ac:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002af:	83 eb 01             	sub    $0x1,%ebx
+  8002b2:	85 db                	test   %ebx,%ebx
+  8002b4:	7f ed                	jg     8002a3 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002b6:	83 ec 08             	sub    $0x8,%esp
+  8002b9:	56                   	push   %esi
+  8002ba:	83 ec 04             	sub    $0x4,%esp
+  8002bd:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c0:	ff 75 e0             	push   -0x20(%ebp)
+  8002c3:	ff 75 dc             	push   -0x24(%ebp)
+  8002c6:	ff 75 d8             	push   -0x28(%ebp)
+  8002c9:	e8 e2 4e 00 00       	call   8051b0 <__umoddi3>
+  8002ce:	83 c4 14             	add    $0x14,%esp
+  8002d1:	0f be 80 47 53 80 00 	movsbl 0x805347(%eax),%eax
+  8002d8:	50                   	push   %eax
+  8002d9:	ff d7                	call   *%edi
+}
+  8002db:	83 c4 10             	add    $0x10,%esp
+  8002de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e1:	5b                   	pop    %ebx
+  8002e2:	5e                   	pop    %esi
+  8002e3:	5f                   	pop    %edi
+  8002e4:	5d                   	pop    %ebp
+  8002e5:	c3                   	ret
+
+008002e6 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002e6:	55                   	push   %ebp
+  8002e7:	89 e5                	mov    %esp,%ebp
+  8002e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002ec:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002f0:	8b 10                	mov    (%eax),%edx
+  8002f2:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002f5:	73 0a                	jae    800301 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002f7:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002fa:	89 08                	mov    %ecx,(%eax)
+  8002fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ff:	88 02                	mov    %al,(%edx)
+}
+  800301:	5d                   	pop    %ebp
+  800302:	c3                   	ret
+
+00800303 <printfmt>:
+{
+  800303:	55                   	push   %ebp
+  800304:	89 e5                	mov    %esp,%ebp
+  800306:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800309:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80030c:	50                   	push   %eax
+  80030d:	ff 75 10             	push   0x10(%ebp)
+  800310:	ff 75 0c             	push   0xc(%ebp)
+  800313:	ff 75 08             	push   0x8(%ebp)
+  800316:	e8 05 00 00 00       	call   800320 <vprintfmt>
+}
+  80031b:	83 c4 10             	add    $0x10,%esp
+  80031e:	c9                   	leave
+  80031f:	c3                   	ret
+
+00800320 <vprintfmt>:
+{
+  800320:	55                   	push   %ebp
+  800321:	89 e5                	mov    %esp,%ebp
+  800323:	57                   	push   %edi
+  800324:	56                   	push   %esi
+  800325:	53                   	push   %ebx
+  800326:	83 ec 2c             	sub    $0x2c,%esp
+  800329:	8b 75 08             	mov    0x8(%ebp),%esi
+  80032c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80032f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800332:	eb 0a                	jmp    80033e <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800334:	83 ec 08             	sub    $0x8,%esp
+  800337:	53                   	push   %ebx
+  800338:	50                   	push   %eax
+  800339:	ff d6                	call   *%esi
+  80033b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80033e:	83 c7 01             	add    $0x1,%edi
+  800341:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800345:	83 f8 25             	cmp    $0x25,%eax
+  800348:	74 0c                	je     800356 <vprintfmt+0x36>
+			if (ch == '\0')
+  80034a:	85 c0                	test   %eax,%eax
+  80034c:	75 e6                	jne    800334 <vprintfmt+0x14>
+}
+  80034e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800351:	5b                   	pop    %ebx
+  800352:	5e                   	pop    %esi
+  800353:	5f                   	pop    %edi
+  800354:	5d                   	pop    %ebp
+  800355:	c3                   	ret
+		padc = ' ';
+  800356:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80035a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800361:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800368:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80036f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800374:	8d 47 01             	lea    0x1(%edi),%eax
+  800377:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80037a:	0f b6 17             	movzbl (%edi),%edx
+  80037d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800380:	3c 55                	cmp    $0x55,%al
+  800382:	0f 87 c5 03 00 00    	ja     80074d <vprintfmt+0x42d>
+  800388:	0f b6 c0             	movzbl %al,%eax
+  80038b:	ff 24 85 c0 54 80 00 	jmp    *0x8054c0(,%eax,4)
+  800392:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800395:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800399:	eb d9                	jmp    800374 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80039b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80039e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003a2:	eb d0                	jmp    800374 <vprintfmt+0x54>
+  8003a4:	0f b6 d2             	movzbl %dl,%edx
+  8003a7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003af:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003b2:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003b5:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003b9:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003bc:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003bf:	83 f9 09             	cmp    $0x9,%ecx
+  8003c2:	77 55                	ja     800419 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003c4:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003c7:	eb e9                	jmp    8003b2 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cc:	8b 00                	mov    (%eax),%eax
+  8003ce:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8003d7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003da:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003dd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003e1:	79 91                	jns    800374 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003e3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003e9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003f0:	eb 82                	jmp    800374 <vprintfmt+0x54>
+			if (width < 0)
+  8003f2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003f5:	85 d2                	test   %edx,%edx
+  8003f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003fc:	0f 49 c2             	cmovns %edx,%eax
+  8003ff:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800402:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800405:	e9 6a ff ff ff       	jmp    800374 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80040a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80040d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800414:	e9 5b ff ff ff       	jmp    800374 <vprintfmt+0x54>
+  800419:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80041c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80041f:	eb bc                	jmp    8003dd <vprintfmt+0xbd>
+			lflag++;
+  800421:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800424:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800427:	e9 48 ff ff ff       	jmp    800374 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80042c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042f:	8d 78 04             	lea    0x4(%eax),%edi
+  800432:	83 ec 08             	sub    $0x8,%esp
+  800435:	53                   	push   %ebx
+  800436:	ff 30                	push   (%eax)
+  800438:	ff d6                	call   *%esi
+			break;
+  80043a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80043d:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800440:	e9 63 02 00 00       	jmp    8006a8 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800445:	8b 45 14             	mov    0x14(%ebp),%eax
+  800448:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80044b:	8b 10                	mov    (%eax),%edx
+  80044d:	89 d0                	mov    %edx,%eax
+  80044f:	f7 d8                	neg    %eax
+  800451:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800454:	83 f8 12             	cmp    $0x12,%eax
+  800457:	7f 23                	jg     80047c <vprintfmt+0x15c>
+  800459:	8b 14 85 20 56 80 00 	mov    0x805620(,%eax,4),%edx
+  800460:	85 d2                	test   %edx,%edx
+  800462:	74 18                	je     80047c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800464:	52                   	push   %edx
+  800465:	68 4d 58 80 00       	push   $0x80584d
+  80046a:	53                   	push   %ebx
+  80046b:	56                   	push   %esi
+  80046c:	e8 92 fe ff ff       	call   800303 <printfmt>
+  800471:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800474:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800477:	e9 2c 02 00 00       	jmp    8006a8 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80047c:	50                   	push   %eax
+  80047d:	68 5f 53 80 00       	push   $0x80535f
+  800482:	53                   	push   %ebx
+  800483:	56                   	push   %esi
+  800484:	e8 7a fe ff ff       	call   800303 <printfmt>
+  800489:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80048c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80048f:	e9 14 02 00 00       	jmp    8006a8 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800494:	8b 45 14             	mov    0x14(%ebp),%eax
+  800497:	83 c0 04             	add    $0x4,%eax
+  80049a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80049d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a0:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004a2:	85 c9                	test   %ecx,%ecx
+  8004a4:	b8 58 53 80 00       	mov    $0x805358,%eax
+  8004a9:	0f 45 c1             	cmovne %ecx,%eax
+  8004ac:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004af:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004b3:	7e 06                	jle    8004bb <vprintfmt+0x19b>
+  8004b5:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004b9:	75 0b                	jne    8004c6 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004bb:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004be:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004c1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004c4:	eb 5c                	jmp    800522 <vprintfmt+0x202>
+  8004c6:	83 ec 08             	sub    $0x8,%esp
+  8004c9:	ff 75 d0             	push   -0x30(%ebp)
+  8004cc:	ff 75 cc             	push   -0x34(%ebp)
+  8004cf:	e8 19 03 00 00       	call   8007ed <strnlen>
+  8004d4:	89 c2                	mov    %eax,%edx
+  8004d6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004d9:	29 d0                	sub    %edx,%eax
+  8004db:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004de:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004e8:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ea:	eb 0e                	jmp    8004fa <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004ec:	83 ec 08             	sub    $0x8,%esp
+  8004ef:	53                   	push   %ebx
+  8004f0:	57                   	push   %edi
+  8004f1:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004f4:	83 ee 01             	sub    $0x1,%esi
+  8004f7:	83 c4 10             	add    $0x10,%esp
+  8004fa:	85 f6                	test   %esi,%esi
+  8004fc:	7f ee                	jg     8004ec <vprintfmt+0x1cc>
+  8004fe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800501:	8b 75 08             	mov    0x8(%ebp),%esi
+  800504:	85 c0                	test   %eax,%eax
+  800506:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050b:	0f 49 d0             	cmovns %eax,%edx
+  80050e:	29 d0                	sub    %edx,%eax
+  800510:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800513:	eb a6                	jmp    8004bb <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800515:	83 ec 08             	sub    $0x8,%esp
+  800518:	53                   	push   %ebx
+  800519:	52                   	push   %edx
+  80051a:	ff 55 08             	call   *0x8(%ebp)
+  80051d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800520:	89 f1                	mov    %esi,%ecx
+  800522:	8d 71 01             	lea    0x1(%ecx),%esi
+  800525:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800529:	0f be d0             	movsbl %al,%edx
+  80052c:	85 d2                	test   %edx,%edx
+  80052e:	74 28                	je     800558 <vprintfmt+0x238>
+  800530:	85 ff                	test   %edi,%edi
+  800532:	78 05                	js     800539 <vprintfmt+0x219>
+  800534:	83 ef 01             	sub    $0x1,%edi
+  800537:	78 30                	js     800569 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800539:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80053d:	74 d6                	je     800515 <vprintfmt+0x1f5>
+  80053f:	0f be c0             	movsbl %al,%eax
+  800542:	83 e8 20             	sub    $0x20,%eax
+  800545:	83 f8 5e             	cmp    $0x5e,%eax
+  800548:	76 cb                	jbe    800515 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80054a:	83 ec 08             	sub    $0x8,%esp
+  80054d:	53                   	push   %ebx
+  80054e:	6a 3f                	push   $0x3f
+  800550:	ff 55 08             	call   *0x8(%ebp)
+  800553:	83 c4 10             	add    $0x10,%esp
+  800556:	eb c8                	jmp    800520 <vprintfmt+0x200>
+  800558:	8b 75 08             	mov    0x8(%ebp),%esi
+  80055b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80055e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800561:	01 d0                	add    %edx,%eax
+  800563:	29 c8                	sub    %ecx,%eax
+  800565:	89 c7                	mov    %eax,%edi
+  800567:	eb 13                	jmp    80057c <vprintfmt+0x25c>
+  800569:	8b 75 08             	mov    0x8(%ebp),%esi
+  80056c:	eb ed                	jmp    80055b <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80056e:	83 ec 08             	sub    $0x8,%esp
+  800571:	53                   	push   %ebx
+  800572:	6a 20                	push   $0x20
+  800574:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800576:	83 ef 01             	sub    $0x1,%edi
+  800579:	83 c4 10             	add    $0x10,%esp
+  80057c:	85 ff                	test   %edi,%edi
+  80057e:	7f ee                	jg     80056e <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800580:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800583:	89 45 14             	mov    %eax,0x14(%ebp)
+  800586:	e9 1d 01 00 00       	jmp    8006a8 <vprintfmt+0x388>
+	if (lflag >= 2)
+  80058b:	83 f9 01             	cmp    $0x1,%ecx
+  80058e:	7f 1b                	jg     8005ab <vprintfmt+0x28b>
+	else if (lflag)
+  800590:	85 c9                	test   %ecx,%ecx
+  800592:	74 63                	je     8005f7 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800594:	8b 45 14             	mov    0x14(%ebp),%eax
+  800597:	8b 00                	mov    (%eax),%eax
+  800599:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80059c:	99                   	cltd
+  80059d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a9:	eb 17                	jmp    8005c2 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  8005ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ae:	8b 50 04             	mov    0x4(%eax),%edx
+  8005b1:	8b 00                	mov    (%eax),%eax
+  8005b3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bc:	8d 40 08             	lea    0x8(%eax),%eax
+  8005bf:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005c2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005c8:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005cd:	85 c9                	test   %ecx,%ecx
+  8005cf:	0f 89 b9 00 00 00    	jns    80068e <vprintfmt+0x36e>
+				putch('-', putdat);
+  8005d5:	83 ec 08             	sub    $0x8,%esp
+  8005d8:	53                   	push   %ebx
+  8005d9:	6a 2d                	push   $0x2d
+  8005db:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005dd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005e0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005e3:	f7 da                	neg    %edx
+  8005e5:	83 d1 00             	adc    $0x0,%ecx
+  8005e8:	f7 d9                	neg    %ecx
+  8005ea:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005ed:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005f2:	e9 97 00 00 00       	jmp    80068e <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8005f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fa:	8b 00                	mov    (%eax),%eax
+  8005fc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ff:	99                   	cltd
+  800600:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800603:	8b 45 14             	mov    0x14(%ebp),%eax
+  800606:	8d 40 04             	lea    0x4(%eax),%eax
+  800609:	89 45 14             	mov    %eax,0x14(%ebp)
+  80060c:	eb b4                	jmp    8005c2 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  80060e:	83 f9 01             	cmp    $0x1,%ecx
+  800611:	7f 1b                	jg     80062e <vprintfmt+0x30e>
+	else if (lflag)
+  800613:	85 c9                	test   %ecx,%ecx
+  800615:	74 2c                	je     800643 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800617:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061a:	8b 10                	mov    (%eax),%edx
+  80061c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800621:	8d 40 04             	lea    0x4(%eax),%eax
+  800624:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800627:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80062c:	eb 60                	jmp    80068e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80062e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800631:	8b 10                	mov    (%eax),%edx
+  800633:	8b 48 04             	mov    0x4(%eax),%ecx
+  800636:	8d 40 08             	lea    0x8(%eax),%eax
+  800639:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80063c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800641:	eb 4b                	jmp    80068e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800643:	8b 45 14             	mov    0x14(%ebp),%eax
+  800646:	8b 10                	mov    (%eax),%edx
+  800648:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064d:	8d 40 04             	lea    0x4(%eax),%eax
+  800650:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800653:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800658:	eb 34                	jmp    80068e <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80065a:	83 f9 01             	cmp    $0x1,%ecx
+  80065d:	7f 15                	jg     800674 <vprintfmt+0x354>
+	else if (lflag)
+  80065f:	85 c9                	test   %ecx,%ecx
+  800661:	74 4d                	je     8006b0 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800663:	8b 45 14             	mov    0x14(%ebp),%eax
+  800666:	8b 00                	mov    (%eax),%eax
+  800668:	99                   	cltd
+  800669:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80066c:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80066f:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800672:	eb 11                	jmp    800685 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800674:	8b 45 14             	mov    0x14(%ebp),%eax
+  800677:	8b 50 04             	mov    0x4(%eax),%edx
+  80067a:	8b 00                	mov    (%eax),%eax
+  80067c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80067f:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800682:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800685:	89 d1                	mov    %edx,%ecx
+  800687:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800689:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80068e:	83 ec 0c             	sub    $0xc,%esp
+  800691:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800695:	50                   	push   %eax
+  800696:	ff 75 e0             	push   -0x20(%ebp)
+  800699:	57                   	push   %edi
+  80069a:	51                   	push   %ecx
+  80069b:	52                   	push   %edx
+  80069c:	89 da                	mov    %ebx,%edx
+  80069e:	89 f0                	mov    %esi,%eax
+  8006a0:	e8 98 fb ff ff       	call   80023d <printnum>
+			break;
+  8006a5:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006ab:	e9 8e fc ff ff       	jmp    80033e <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  8006b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b3:	8b 00                	mov    (%eax),%eax
+  8006b5:	99                   	cltd
+  8006b6:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006b9:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8006bc:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8006bf:	eb c4                	jmp    800685 <vprintfmt+0x365>
+			putch('0', putdat);
+  8006c1:	83 ec 08             	sub    $0x8,%esp
+  8006c4:	53                   	push   %ebx
+  8006c5:	6a 30                	push   $0x30
+  8006c7:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006c9:	83 c4 08             	add    $0x8,%esp
+  8006cc:	53                   	push   %ebx
+  8006cd:	6a 78                	push   $0x78
+  8006cf:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d4:	8b 10                	mov    (%eax),%edx
+  8006d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006db:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006de:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e4:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8006e9:	eb a3                	jmp    80068e <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8006eb:	83 f9 01             	cmp    $0x1,%ecx
+  8006ee:	7f 1b                	jg     80070b <vprintfmt+0x3eb>
+	else if (lflag)
+  8006f0:	85 c9                	test   %ecx,%ecx
+  8006f2:	74 2f                	je     800723 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8006f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f7:	8b 10                	mov    (%eax),%edx
+  8006f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006fe:	8d 40 04             	lea    0x4(%eax),%eax
+  800701:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800704:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800709:	eb 83                	jmp    80068e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80070b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070e:	8b 10                	mov    (%eax),%edx
+  800710:	8b 48 04             	mov    0x4(%eax),%ecx
+  800713:	8d 40 08             	lea    0x8(%eax),%eax
+  800716:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800719:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80071e:	e9 6b ff ff ff       	jmp    80068e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800723:	8b 45 14             	mov    0x14(%ebp),%eax
+  800726:	8b 10                	mov    (%eax),%edx
+  800728:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80072d:	8d 40 04             	lea    0x4(%eax),%eax
+  800730:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800733:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800738:	e9 51 ff ff ff       	jmp    80068e <vprintfmt+0x36e>
+			putch(ch, putdat);
+  80073d:	83 ec 08             	sub    $0x8,%esp
+  800740:	53                   	push   %ebx
+  800741:	6a 25                	push   $0x25
+  800743:	ff d6                	call   *%esi
+			break;
+  800745:	83 c4 10             	add    $0x10,%esp
+  800748:	e9 5b ff ff ff       	jmp    8006a8 <vprintfmt+0x388>
+			putch('%', putdat);
+  80074d:	83 ec 08             	sub    $0x8,%esp
+  800750:	53                   	push   %ebx
+  800751:	6a 25                	push   $0x25
+  800753:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800755:	83 c4 10             	add    $0x10,%esp
+  800758:	89 f8                	mov    %edi,%eax
+  80075a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80075e:	74 05                	je     800765 <vprintfmt+0x445>
+  800760:	83 e8 01             	sub    $0x1,%eax
+  800763:	eb f5                	jmp    80075a <vprintfmt+0x43a>
+  800765:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800768:	e9 3b ff ff ff       	jmp    8006a8 <vprintfmt+0x388>
+
+0080076d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80076d:	55                   	push   %ebp
+  80076e:	89 e5                	mov    %esp,%ebp
+  800770:	83 ec 18             	sub    $0x18,%esp
+  800773:	8b 45 08             	mov    0x8(%ebp),%eax
+  800776:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800779:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80077c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800780:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800783:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80078a:	85 c0                	test   %eax,%eax
+  80078c:	74 26                	je     8007b4 <vsnprintf+0x47>
+  80078e:	85 d2                	test   %edx,%edx
+  800790:	7e 22                	jle    8007b4 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800792:	ff 75 14             	push   0x14(%ebp)
+  800795:	ff 75 10             	push   0x10(%ebp)
+  800798:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80079b:	50                   	push   %eax
+  80079c:	68 e6 02 80 00       	push   $0x8002e6
+  8007a1:	e8 7a fb ff ff       	call   800320 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007a6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007a9:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007af:	83 c4 10             	add    $0x10,%esp
+}
+  8007b2:	c9                   	leave
+  8007b3:	c3                   	ret
+		return -E_INVAL;
+  8007b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007b9:	eb f7                	jmp    8007b2 <vsnprintf+0x45>
+
+008007bb <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007bb:	55                   	push   %ebp
+  8007bc:	89 e5                	mov    %esp,%ebp
+  8007be:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007c1:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007c4:	50                   	push   %eax
+  8007c5:	ff 75 10             	push   0x10(%ebp)
+  8007c8:	ff 75 0c             	push   0xc(%ebp)
+  8007cb:	ff 75 08             	push   0x8(%ebp)
+  8007ce:	e8 9a ff ff ff       	call   80076d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007d3:	c9                   	leave
+  8007d4:	c3                   	ret
+
+008007d5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007d5:	55                   	push   %ebp
+  8007d6:	89 e5                	mov    %esp,%ebp
+  8007d8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e0:	eb 03                	jmp    8007e5 <strlen+0x10>
+		n++;
+  8007e2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007e5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007e9:	75 f7                	jne    8007e2 <strlen+0xd>
+	return n;
+}
+  8007eb:	5d                   	pop    %ebp
+  8007ec:	c3                   	ret
+
+008007ed <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007ed:	55                   	push   %ebp
+  8007ee:	89 e5                	mov    %esp,%ebp
+  8007f0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fb:	eb 03                	jmp    800800 <strnlen+0x13>
+		n++;
+  8007fd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800800:	39 d0                	cmp    %edx,%eax
+  800802:	74 08                	je     80080c <strnlen+0x1f>
+  800804:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800808:	75 f3                	jne    8007fd <strnlen+0x10>
+  80080a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80080c:	89 d0                	mov    %edx,%eax
+  80080e:	5d                   	pop    %ebp
+  80080f:	c3                   	ret
+
+00800810 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800810:	55                   	push   %ebp
+  800811:	89 e5                	mov    %esp,%ebp
+  800813:	53                   	push   %ebx
+  800814:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800817:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800823:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800826:	83 c0 01             	add    $0x1,%eax
+  800829:	84 d2                	test   %dl,%dl
+  80082b:	75 f2                	jne    80081f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80082d:	89 c8                	mov    %ecx,%eax
+  80082f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800832:	c9                   	leave
+  800833:	c3                   	ret
+
+00800834 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800834:	55                   	push   %ebp
+  800835:	89 e5                	mov    %esp,%ebp
+  800837:	53                   	push   %ebx
+  800838:	83 ec 10             	sub    $0x10,%esp
+  80083b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80083e:	53                   	push   %ebx
+  80083f:	e8 91 ff ff ff       	call   8007d5 <strlen>
+  800844:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800847:	ff 75 0c             	push   0xc(%ebp)
+  80084a:	01 d8                	add    %ebx,%eax
+  80084c:	50                   	push   %eax
+  80084d:	e8 be ff ff ff       	call   800810 <strcpy>
+	return dst;
+}
+  800852:	89 d8                	mov    %ebx,%eax
+  800854:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800857:	c9                   	leave
+  800858:	c3                   	ret
+
+00800859 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800859:	55                   	push   %ebp
+  80085a:	89 e5                	mov    %esp,%ebp
+  80085c:	56                   	push   %esi
+  80085d:	53                   	push   %ebx
+  80085e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800861:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800864:	89 f3                	mov    %esi,%ebx
+  800866:	03 5d 10             	add    0x10(%ebp),%ebx
+  800869:	89 f0                	mov    %esi,%eax
+  80086b:	eb 0f                	jmp    80087c <strncpy+0x23>
+		*dst++ = *src;
+  80086d:	83 c0 01             	add    $0x1,%eax
+  800870:	0f b6 0a             	movzbl (%edx),%ecx
+  800873:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800876:	80 f9 01             	cmp    $0x1,%cl
+  800879:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80087c:	39 d8                	cmp    %ebx,%eax
+  80087e:	75 ed                	jne    80086d <strncpy+0x14>
+	}
+	return ret;
+}
+  800880:	89 f0                	mov    %esi,%eax
+  800882:	5b                   	pop    %ebx
+  800883:	5e                   	pop    %esi
+  800884:	5d                   	pop    %ebp
+  800885:	c3                   	ret
+
+00800886 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800886:	55                   	push   %ebp
+  800887:	89 e5                	mov    %esp,%ebp
+  800889:	56                   	push   %esi
+  80088a:	53                   	push   %ebx
+  80088b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80088e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800891:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800894:	89 f0                	mov    %esi,%eax
+  800896:	85 d2                	test   %edx,%edx
+  800898:	74 21                	je     8008bb <strlcpy+0x35>
+  80089a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80089e:	89 f2                	mov    %esi,%edx
+  8008a0:	eb 09                	jmp    8008ab <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008a2:	83 c1 01             	add    $0x1,%ecx
+  8008a5:	83 c2 01             	add    $0x1,%edx
+  8008a8:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008ab:	39 c2                	cmp    %eax,%edx
+  8008ad:	74 09                	je     8008b8 <strlcpy+0x32>
+  8008af:	0f b6 19             	movzbl (%ecx),%ebx
+  8008b2:	84 db                	test   %bl,%bl
+  8008b4:	75 ec                	jne    8008a2 <strlcpy+0x1c>
+  8008b6:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008b8:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008bb:	29 f0                	sub    %esi,%eax
+}
+  8008bd:	5b                   	pop    %ebx
+  8008be:	5e                   	pop    %esi
+  8008bf:	5d                   	pop    %ebp
+  8008c0:	c3                   	ret
+
+008008c1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008c1:	55                   	push   %ebp
+  8008c2:	89 e5                	mov    %esp,%ebp
+  8008c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008ca:	eb 06                	jmp    8008d2 <strcmp+0x11>
+		p++, q++;
+  8008cc:	83 c1 01             	add    $0x1,%ecx
+  8008cf:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008d2:	0f b6 01             	movzbl (%ecx),%eax
+  8008d5:	84 c0                	test   %al,%al
+  8008d7:	74 04                	je     8008dd <strcmp+0x1c>
+  8008d9:	3a 02                	cmp    (%edx),%al
+  8008db:	74 ef                	je     8008cc <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008dd:	0f b6 c0             	movzbl %al,%eax
+  8008e0:	0f b6 12             	movzbl (%edx),%edx
+  8008e3:	29 d0                	sub    %edx,%eax
+}
+  8008e5:	5d                   	pop    %ebp
+  8008e6:	c3                   	ret
+
+008008e7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008e7:	55                   	push   %ebp
+  8008e8:	89 e5                	mov    %esp,%ebp
+  8008ea:	53                   	push   %ebx
+  8008eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008f1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008f4:	eb 09                	jmp    8008ff <strncmp+0x18>
+		n--, p++, q++;
+  8008f6:	83 ea 01             	sub    $0x1,%edx
+  8008f9:	83 c0 01             	add    $0x1,%eax
+  8008fc:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008ff:	85 d2                	test   %edx,%edx
+  800901:	74 18                	je     80091b <strncmp+0x34>
+  800903:	0f b6 18             	movzbl (%eax),%ebx
+  800906:	84 db                	test   %bl,%bl
+  800908:	74 04                	je     80090e <strncmp+0x27>
+  80090a:	3a 19                	cmp    (%ecx),%bl
+  80090c:	74 e8                	je     8008f6 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80090e:	0f b6 00             	movzbl (%eax),%eax
+  800911:	0f b6 11             	movzbl (%ecx),%edx
+  800914:	29 d0                	sub    %edx,%eax
+}
+  800916:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800919:	c9                   	leave
+  80091a:	c3                   	ret
+		return 0;
+  80091b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800920:	eb f4                	jmp    800916 <strncmp+0x2f>
+
+00800922 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800922:	55                   	push   %ebp
+  800923:	89 e5                	mov    %esp,%ebp
+  800925:	8b 45 08             	mov    0x8(%ebp),%eax
+  800928:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80092c:	eb 03                	jmp    800931 <strchr+0xf>
+  80092e:	83 c0 01             	add    $0x1,%eax
+  800931:	0f b6 10             	movzbl (%eax),%edx
+  800934:	84 d2                	test   %dl,%dl
+  800936:	74 06                	je     80093e <strchr+0x1c>
+		if (*s == c)
+  800938:	38 ca                	cmp    %cl,%dl
+  80093a:	75 f2                	jne    80092e <strchr+0xc>
+  80093c:	eb 05                	jmp    800943 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80093e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800943:	5d                   	pop    %ebp
+  800944:	c3                   	ret
+
+00800945 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800945:	55                   	push   %ebp
+  800946:	89 e5                	mov    %esp,%ebp
+  800948:	8b 45 08             	mov    0x8(%ebp),%eax
+  80094b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80094f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800952:	38 ca                	cmp    %cl,%dl
+  800954:	74 09                	je     80095f <strfind+0x1a>
+  800956:	84 d2                	test   %dl,%dl
+  800958:	74 05                	je     80095f <strfind+0x1a>
+	for (; *s; s++)
+  80095a:	83 c0 01             	add    $0x1,%eax
+  80095d:	eb f0                	jmp    80094f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80095f:	5d                   	pop    %ebp
+  800960:	c3                   	ret
+
+00800961 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800961:	55                   	push   %ebp
+  800962:	89 e5                	mov    %esp,%ebp
+  800964:	57                   	push   %edi
+  800965:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800968:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80096b:	85 c9                	test   %ecx,%ecx
+  80096d:	74 20                	je     80098f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80096f:	89 f8                	mov    %edi,%eax
+  800971:	09 c8                	or     %ecx,%eax
+  800973:	a8 03                	test   $0x3,%al
+  800975:	75 12                	jne    800989 <memset+0x28>
+		c &= 0xFF;
+  800977:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80097b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800981:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800984:	fc                   	cld
+  800985:	f3 ab                	rep stos %eax,%es:(%edi)
+  800987:	eb 06                	jmp    80098f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800989:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80098c:	fc                   	cld
+  80098d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80098f:	89 f8                	mov    %edi,%eax
+  800991:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800994:	c9                   	leave
+  800995:	c3                   	ret
+
+00800996 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800996:	55                   	push   %ebp
+  800997:	89 e5                	mov    %esp,%ebp
+  800999:	57                   	push   %edi
+  80099a:	56                   	push   %esi
+  80099b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009a1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009a4:	39 c6                	cmp    %eax,%esi
+  8009a6:	73 32                	jae    8009da <memmove+0x44>
+  8009a8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009ab:	39 d0                	cmp    %edx,%eax
+  8009ad:	73 2b                	jae    8009da <memmove+0x44>
+		s += n;
+		d += n;
+  8009af:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009b2:	89 d6                	mov    %edx,%esi
+  8009b4:	09 fe                	or     %edi,%esi
+  8009b6:	09 ce                	or     %ecx,%esi
+  8009b8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009be:	75 0e                	jne    8009ce <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009c0:	83 ef 04             	sub    $0x4,%edi
+  8009c3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009c6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009c9:	fd                   	std
+  8009ca:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009cc:	eb 09                	jmp    8009d7 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009ce:	83 ef 01             	sub    $0x1,%edi
+  8009d1:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009d4:	fd                   	std
+  8009d5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009d7:	fc                   	cld
+  8009d8:	eb 1a                	jmp    8009f4 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009da:	89 f2                	mov    %esi,%edx
+  8009dc:	09 c2                	or     %eax,%edx
+  8009de:	09 ca                	or     %ecx,%edx
+  8009e0:	f6 c2 03             	test   $0x3,%dl
+  8009e3:	75 0a                	jne    8009ef <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009e5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009e8:	89 c7                	mov    %eax,%edi
+  8009ea:	fc                   	cld
+  8009eb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009ed:	eb 05                	jmp    8009f4 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009ef:	89 c7                	mov    %eax,%edi
+  8009f1:	fc                   	cld
+  8009f2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009f4:	5e                   	pop    %esi
+  8009f5:	5f                   	pop    %edi
+  8009f6:	5d                   	pop    %ebp
+  8009f7:	c3                   	ret
+
+008009f8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009f8:	55                   	push   %ebp
+  8009f9:	89 e5                	mov    %esp,%ebp
+  8009fb:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009fe:	ff 75 10             	push   0x10(%ebp)
+  800a01:	ff 75 0c             	push   0xc(%ebp)
+  800a04:	ff 75 08             	push   0x8(%ebp)
+  800a07:	e8 8a ff ff ff       	call   800996 <memmove>
+}
+  800a0c:	c9                   	leave
+  800a0d:	c3                   	ret
+
+00800a0e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a0e:	55                   	push   %ebp
+  800a0f:	89 e5                	mov    %esp,%ebp
+  800a11:	56                   	push   %esi
+  800a12:	53                   	push   %ebx
+  800a13:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a16:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a19:	89 c6                	mov    %eax,%esi
+  800a1b:	03 75 10             	add    0x10(%ebp),%esi
+  800a1e:	eb 06                	jmp    800a26 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a20:	83 c0 01             	add    $0x1,%eax
+  800a23:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a26:	39 f0                	cmp    %esi,%eax
+  800a28:	74 14                	je     800a3e <memcmp+0x30>
+		if (*s1 != *s2)
+  800a2a:	0f b6 08             	movzbl (%eax),%ecx
+  800a2d:	0f b6 1a             	movzbl (%edx),%ebx
+  800a30:	38 d9                	cmp    %bl,%cl
+  800a32:	74 ec                	je     800a20 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a34:	0f b6 c1             	movzbl %cl,%eax
+  800a37:	0f b6 db             	movzbl %bl,%ebx
+  800a3a:	29 d8                	sub    %ebx,%eax
+  800a3c:	eb 05                	jmp    800a43 <memcmp+0x35>
+	}
+
+	return 0;
+  800a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a43:	5b                   	pop    %ebx
+  800a44:	5e                   	pop    %esi
+  800a45:	5d                   	pop    %ebp
+  800a46:	c3                   	ret
+
+00800a47 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a47:	55                   	push   %ebp
+  800a48:	89 e5                	mov    %esp,%ebp
+  800a4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a50:	89 c2                	mov    %eax,%edx
+  800a52:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a55:	eb 03                	jmp    800a5a <memfind+0x13>
+  800a57:	83 c0 01             	add    $0x1,%eax
+  800a5a:	39 d0                	cmp    %edx,%eax
+  800a5c:	73 04                	jae    800a62 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a5e:	38 08                	cmp    %cl,(%eax)
+  800a60:	75 f5                	jne    800a57 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a62:	5d                   	pop    %ebp
+  800a63:	c3                   	ret
+
+00800a64 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a64:	55                   	push   %ebp
+  800a65:	89 e5                	mov    %esp,%ebp
+  800a67:	57                   	push   %edi
+  800a68:	56                   	push   %esi
+  800a69:	53                   	push   %ebx
+  800a6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a70:	eb 03                	jmp    800a75 <strtol+0x11>
+		s++;
+  800a72:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a75:	0f b6 02             	movzbl (%edx),%eax
+  800a78:	3c 20                	cmp    $0x20,%al
+  800a7a:	74 f6                	je     800a72 <strtol+0xe>
+  800a7c:	3c 09                	cmp    $0x9,%al
+  800a7e:	74 f2                	je     800a72 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a80:	3c 2b                	cmp    $0x2b,%al
+  800a82:	74 2a                	je     800aae <strtol+0x4a>
+	int neg = 0;
+  800a84:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a89:	3c 2d                	cmp    $0x2d,%al
+  800a8b:	74 2b                	je     800ab8 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a8d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a93:	75 0f                	jne    800aa4 <strtol+0x40>
+  800a95:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a98:	74 28                	je     800ac2 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a9a:	85 db                	test   %ebx,%ebx
+  800a9c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800aa1:	0f 44 d8             	cmove  %eax,%ebx
+  800aa4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800aac:	eb 46                	jmp    800af4 <strtol+0x90>
+		s++;
+  800aae:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ab1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ab6:	eb d5                	jmp    800a8d <strtol+0x29>
+		s++, neg = 1;
+  800ab8:	83 c2 01             	add    $0x1,%edx
+  800abb:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ac0:	eb cb                	jmp    800a8d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ac2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ac6:	74 0e                	je     800ad6 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ac8:	85 db                	test   %ebx,%ebx
+  800aca:	75 d8                	jne    800aa4 <strtol+0x40>
+		s++, base = 8;
+  800acc:	83 c2 01             	add    $0x1,%edx
+  800acf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ad4:	eb ce                	jmp    800aa4 <strtol+0x40>
+		s += 2, base = 16;
+  800ad6:	83 c2 02             	add    $0x2,%edx
+  800ad9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ade:	eb c4                	jmp    800aa4 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ae0:	0f be c0             	movsbl %al,%eax
+  800ae3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ae6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ae9:	7d 3a                	jge    800b25 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800aeb:	83 c2 01             	add    $0x1,%edx
+  800aee:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800af2:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800af4:	0f b6 02             	movzbl (%edx),%eax
+  800af7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800afa:	89 f3                	mov    %esi,%ebx
+  800afc:	80 fb 09             	cmp    $0x9,%bl
+  800aff:	76 df                	jbe    800ae0 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b01:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b04:	89 f3                	mov    %esi,%ebx
+  800b06:	80 fb 19             	cmp    $0x19,%bl
+  800b09:	77 08                	ja     800b13 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b0b:	0f be c0             	movsbl %al,%eax
+  800b0e:	83 e8 57             	sub    $0x57,%eax
+  800b11:	eb d3                	jmp    800ae6 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b13:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b16:	89 f3                	mov    %esi,%ebx
+  800b18:	80 fb 19             	cmp    $0x19,%bl
+  800b1b:	77 08                	ja     800b25 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b1d:	0f be c0             	movsbl %al,%eax
+  800b20:	83 e8 37             	sub    $0x37,%eax
+  800b23:	eb c1                	jmp    800ae6 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b25:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b29:	74 05                	je     800b30 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b2e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b30:	89 c8                	mov    %ecx,%eax
+  800b32:	f7 d8                	neg    %eax
+  800b34:	85 ff                	test   %edi,%edi
+  800b36:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b39:	89 c8                	mov    %ecx,%eax
+  800b3b:	5b                   	pop    %ebx
+  800b3c:	5e                   	pop    %esi
+  800b3d:	5f                   	pop    %edi
+  800b3e:	5d                   	pop    %ebp
+  800b3f:	c3                   	ret
+
+00800b40 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800b40:	55                   	push   %ebp
+  800b41:	89 e5                	mov    %esp,%ebp
+  800b43:	57                   	push   %edi
+  800b44:	56                   	push   %esi
+  800b45:	53                   	push   %ebx
+  800b46:	83 ec 0c             	sub    $0xc,%esp
+  800b49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b4c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b4f:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800b52:	85 ff                	test   %edi,%edi
+  800b54:	74 16                	je     800b6c <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800b56:	83 ec 04             	sub    $0x4,%esp
+  800b59:	56                   	push   %esi
+  800b5a:	6a 00                	push   $0x0
+  800b5c:	53                   	push   %ebx
+  800b5d:	e8 02 ff ff ff       	call   800a64 <strtol>
+  800b62:	89 07                	mov    %eax,(%edi)
+  800b64:	83 c4 10             	add    $0x10,%esp
+  800b67:	eb 03                	jmp    800b6c <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800b69:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800b6c:	0f b6 03             	movzbl (%ebx),%eax
+  800b6f:	3c 20                	cmp    $0x20,%al
+  800b71:	74 f6                	je     800b69 <strisl+0x29>
+  800b73:	3c 09                	cmp    $0x9,%al
+  800b75:	74 f2                	je     800b69 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b77:	3c 2b                	cmp    $0x2b,%al
+  800b79:	74 23                	je     800b9e <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800b7b:	3c 2d                	cmp    $0x2d,%al
+  800b7d:	0f 94 c0             	sete   %al
+  800b80:	0f b6 c0             	movzbl %al,%eax
+  800b83:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b85:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800b8b:	75 41                	jne    800bce <strisl+0x8e>
+  800b8d:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800b90:	74 11                	je     800ba3 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b92:	85 f6                	test   %esi,%esi
+  800b94:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b99:	0f 44 f0             	cmove  %eax,%esi
+  800b9c:	eb 30                	jmp    800bce <strisl+0x8e>
+		s++;
+  800b9e:	83 c3 01             	add    $0x1,%ebx
+  800ba1:	eb e2                	jmp    800b85 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ba3:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800ba7:	74 0e                	je     800bb7 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800ba9:	85 f6                	test   %esi,%esi
+  800bab:	75 21                	jne    800bce <strisl+0x8e>
+		s++, base = 8;
+  800bad:	83 c3 01             	add    $0x1,%ebx
+  800bb0:	be 08 00 00 00       	mov    $0x8,%esi
+  800bb5:	eb 17                	jmp    800bce <strisl+0x8e>
+		s += 2, base = 16;
+  800bb7:	83 c3 02             	add    $0x2,%ebx
+  800bba:	be 10 00 00 00       	mov    $0x10,%esi
+  800bbf:	eb 0d                	jmp    800bce <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bc1:	0f be c0             	movsbl %al,%eax
+  800bc4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800bc7:	39 f0                	cmp    %esi,%eax
+  800bc9:	7d 38                	jge    800c03 <strisl+0xc3>
+			return 0;
+		s++;
+  800bcb:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800bce:	0f b6 03             	movzbl (%ebx),%eax
+  800bd1:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800bd4:	80 fa 09             	cmp    $0x9,%dl
+  800bd7:	76 e8                	jbe    800bc1 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800bd9:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800bdc:	80 fa 19             	cmp    $0x19,%dl
+  800bdf:	77 08                	ja     800be9 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800be1:	0f be c0             	movsbl %al,%eax
+  800be4:	83 e8 57             	sub    $0x57,%eax
+  800be7:	eb de                	jmp    800bc7 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800be9:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800bec:	80 fa 19             	cmp    $0x19,%dl
+  800bef:	77 08                	ja     800bf9 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800bf1:	0f be c0             	movsbl %al,%eax
+  800bf4:	83 e8 37             	sub    $0x37,%eax
+  800bf7:	eb ce                	jmp    800bc7 <strisl+0x87>
+		else if (!*s)
+  800bf9:	84 c0                	test   %al,%al
+  800bfb:	0f 94 c0             	sete   %al
+  800bfe:	0f b6 c0             	movzbl %al,%eax
+  800c01:	eb 05                	jmp    800c08 <strisl+0xc8>
+			return 0;
+  800c03:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800c08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c0b:	5b                   	pop    %ebx
+  800c0c:	5e                   	pop    %esi
+  800c0d:	5f                   	pop    %edi
+  800c0e:	5d                   	pop    %ebp
+  800c0f:	c3                   	ret
+
+00800c10 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800c10:	55                   	push   %ebp
+  800c11:	89 e5                	mov    %esp,%ebp
+  800c13:	83 ec 10             	sub    $0x10,%esp
+  800c16:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c19:	89 c8                	mov    %ecx,%eax
+  800c1b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800c20:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800c23:	eb 0b                	jmp    800c30 <touch_mem+0x20>
+		c = *(char *)page;
+  800c25:	0f b6 10             	movzbl (%eax),%edx
+  800c28:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c2b:	05 00 10 00 00       	add    $0x1000,%eax
+  800c30:	39 c8                	cmp    %ecx,%eax
+  800c32:	72 f1                	jb     800c25 <touch_mem+0x15>
+}
+  800c34:	c9                   	leave
+  800c35:	c3                   	ret
+
+00800c36 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c36:	55                   	push   %ebp
+  800c37:	89 e5                	mov    %esp,%ebp
+  800c39:	57                   	push   %edi
+  800c3a:	56                   	push   %esi
+  800c3b:	53                   	push   %ebx
+	touch_mem(s, len);
+  800c3c:	ff 75 0c             	push   0xc(%ebp)
+  800c3f:	ff 75 08             	push   0x8(%ebp)
+  800c42:	e8 c9 ff ff ff       	call   800c10 <touch_mem>
+	asm volatile("int %1\n"
+  800c47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c52:	89 c3                	mov    %eax,%ebx
+  800c54:	89 c7                	mov    %eax,%edi
+  800c56:	89 c6                	mov    %eax,%esi
+  800c58:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c5a:	83 c4 08             	add    $0x8,%esp
+  800c5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c60:	5b                   	pop    %ebx
+  800c61:	5e                   	pop    %esi
+  800c62:	5f                   	pop    %edi
+  800c63:	5d                   	pop    %ebp
+  800c64:	c3                   	ret
+
+00800c65 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c65:	55                   	push   %ebp
+  800c66:	89 e5                	mov    %esp,%ebp
+  800c68:	57                   	push   %edi
+  800c69:	56                   	push   %esi
+  800c6a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c70:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c75:	89 d1                	mov    %edx,%ecx
+  800c77:	89 d3                	mov    %edx,%ebx
+  800c79:	89 d7                	mov    %edx,%edi
+  800c7b:	89 d6                	mov    %edx,%esi
+  800c7d:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c7f:	5b                   	pop    %ebx
+  800c80:	5e                   	pop    %esi
+  800c81:	5f                   	pop    %edi
+  800c82:	5d                   	pop    %ebp
+  800c83:	c3                   	ret
+
+00800c84 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c84:	55                   	push   %ebp
+  800c85:	89 e5                	mov    %esp,%ebp
+  800c87:	57                   	push   %edi
+  800c88:	56                   	push   %esi
+  800c89:	53                   	push   %ebx
+  800c8a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c8d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c92:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c95:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c9a:	89 cb                	mov    %ecx,%ebx
+  800c9c:	89 cf                	mov    %ecx,%edi
+  800c9e:	89 ce                	mov    %ecx,%esi
+  800ca0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ca2:	85 c0                	test   %eax,%eax
+  800ca4:	7f 08                	jg     800cae <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ca6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca9:	5b                   	pop    %ebx
+  800caa:	5e                   	pop    %esi
+  800cab:	5f                   	pop    %edi
+  800cac:	5d                   	pop    %ebp
+  800cad:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cae:	83 ec 0c             	sub    $0xc,%esp
+  800cb1:	50                   	push   %eax
+  800cb2:	6a 03                	push   $0x3
+  800cb4:	68 8b 56 80 00       	push   $0x80568b
+  800cb9:	6a 23                	push   $0x23
+  800cbb:	68 a8 56 80 00       	push   $0x8056a8
+  800cc0:	e8 89 f4 ff ff       	call   80014e <_panic>
+
+00800cc5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cc5:	55                   	push   %ebp
+  800cc6:	89 e5                	mov    %esp,%ebp
+  800cc8:	57                   	push   %edi
+  800cc9:	56                   	push   %esi
+  800cca:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ccb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd0:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cd5:	89 d1                	mov    %edx,%ecx
+  800cd7:	89 d3                	mov    %edx,%ebx
+  800cd9:	89 d7                	mov    %edx,%edi
+  800cdb:	89 d6                	mov    %edx,%esi
+  800cdd:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cdf:	5b                   	pop    %ebx
+  800ce0:	5e                   	pop    %esi
+  800ce1:	5f                   	pop    %edi
+  800ce2:	5d                   	pop    %ebp
+  800ce3:	c3                   	ret
+
+00800ce4 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ce4:	55                   	push   %ebp
+  800ce5:	89 e5                	mov    %esp,%ebp
+  800ce7:	57                   	push   %edi
+  800ce8:	56                   	push   %esi
+  800ce9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cef:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cf4:	89 d1                	mov    %edx,%ecx
+  800cf6:	89 d3                	mov    %edx,%ebx
+  800cf8:	89 d7                	mov    %edx,%edi
+  800cfa:	89 d6                	mov    %edx,%esi
+  800cfc:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cfe:	5b                   	pop    %ebx
+  800cff:	5e                   	pop    %esi
+  800d00:	5f                   	pop    %edi
+  800d01:	5d                   	pop    %ebp
+  800d02:	c3                   	ret
+
+00800d03 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d03:	55                   	push   %ebp
+  800d04:	89 e5                	mov    %esp,%ebp
+  800d06:	57                   	push   %edi
+  800d07:	56                   	push   %esi
+  800d08:	53                   	push   %ebx
+  800d09:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d0c:	be 00 00 00 00       	mov    $0x0,%esi
+  800d11:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d14:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d17:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d1f:	89 f7                	mov    %esi,%edi
+  800d21:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d23:	85 c0                	test   %eax,%eax
+  800d25:	7f 08                	jg     800d2f <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d2a:	5b                   	pop    %ebx
+  800d2b:	5e                   	pop    %esi
+  800d2c:	5f                   	pop    %edi
+  800d2d:	5d                   	pop    %ebp
+  800d2e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d2f:	83 ec 0c             	sub    $0xc,%esp
+  800d32:	50                   	push   %eax
+  800d33:	6a 04                	push   $0x4
+  800d35:	68 8b 56 80 00       	push   $0x80568b
+  800d3a:	6a 23                	push   $0x23
+  800d3c:	68 a8 56 80 00       	push   $0x8056a8
+  800d41:	e8 08 f4 ff ff       	call   80014e <_panic>
+
+00800d46 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d46:	55                   	push   %ebp
+  800d47:	89 e5                	mov    %esp,%ebp
+  800d49:	57                   	push   %edi
+  800d4a:	56                   	push   %esi
+  800d4b:	53                   	push   %ebx
+  800d4c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d55:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d5d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d60:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d63:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d65:	85 c0                	test   %eax,%eax
+  800d67:	7f 08                	jg     800d71 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6c:	5b                   	pop    %ebx
+  800d6d:	5e                   	pop    %esi
+  800d6e:	5f                   	pop    %edi
+  800d6f:	5d                   	pop    %ebp
+  800d70:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d71:	83 ec 0c             	sub    $0xc,%esp
+  800d74:	50                   	push   %eax
+  800d75:	6a 05                	push   $0x5
+  800d77:	68 8b 56 80 00       	push   $0x80568b
+  800d7c:	6a 23                	push   $0x23
+  800d7e:	68 a8 56 80 00       	push   $0x8056a8
+  800d83:	e8 c6 f3 ff ff       	call   80014e <_panic>
+
+00800d88 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d88:	55                   	push   %ebp
+  800d89:	89 e5                	mov    %esp,%ebp
+  800d8b:	57                   	push   %edi
+  800d8c:	56                   	push   %esi
+  800d8d:	53                   	push   %ebx
+  800d8e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800da1:	89 df                	mov    %ebx,%edi
+  800da3:	89 de                	mov    %ebx,%esi
+  800da5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800da7:	85 c0                	test   %eax,%eax
+  800da9:	7f 08                	jg     800db3 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800dab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dae:	5b                   	pop    %ebx
+  800daf:	5e                   	pop    %esi
+  800db0:	5f                   	pop    %edi
+  800db1:	5d                   	pop    %ebp
+  800db2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db3:	83 ec 0c             	sub    $0xc,%esp
+  800db6:	50                   	push   %eax
+  800db7:	6a 06                	push   $0x6
+  800db9:	68 8b 56 80 00       	push   $0x80568b
+  800dbe:	6a 23                	push   $0x23
+  800dc0:	68 a8 56 80 00       	push   $0x8056a8
+  800dc5:	e8 84 f3 ff ff       	call   80014e <_panic>
+
+00800dca <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800dca:	55                   	push   %ebp
+  800dcb:	89 e5                	mov    %esp,%ebp
+  800dcd:	57                   	push   %edi
+  800dce:	56                   	push   %esi
+  800dcf:	53                   	push   %ebx
+  800dd0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dde:	b8 18 00 00 00       	mov    $0x18,%eax
+  800de3:	89 df                	mov    %ebx,%edi
+  800de5:	89 de                	mov    %ebx,%esi
+  800de7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de9:	85 c0                	test   %eax,%eax
+  800deb:	7f 08                	jg     800df5 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ded:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df0:	5b                   	pop    %ebx
+  800df1:	5e                   	pop    %esi
+  800df2:	5f                   	pop    %edi
+  800df3:	5d                   	pop    %ebp
+  800df4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df5:	83 ec 0c             	sub    $0xc,%esp
+  800df8:	50                   	push   %eax
+  800df9:	6a 18                	push   $0x18
+  800dfb:	68 8b 56 80 00       	push   $0x80568b
+  800e00:	6a 23                	push   $0x23
+  800e02:	68 a8 56 80 00       	push   $0x8056a8
+  800e07:	e8 42 f3 ff ff       	call   80014e <_panic>
+
+00800e0c <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800e0c:	55                   	push   %ebp
+  800e0d:	89 e5                	mov    %esp,%ebp
+  800e0f:	57                   	push   %edi
+  800e10:	56                   	push   %esi
+  800e11:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e12:	be 00 00 00 00       	mov    $0x0,%esi
+  800e17:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1d:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e22:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e25:	89 f7                	mov    %esi,%edi
+  800e27:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800e29:	5b                   	pop    %ebx
+  800e2a:	5e                   	pop    %esi
+  800e2b:	5f                   	pop    %edi
+  800e2c:	5d                   	pop    %ebp
+  800e2d:	c3                   	ret
+
+00800e2e <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800e2e:	55                   	push   %ebp
+  800e2f:	89 e5                	mov    %esp,%ebp
+  800e31:	57                   	push   %edi
+  800e32:	56                   	push   %esi
+  800e33:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e3f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e47:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e4a:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e4c:	5b                   	pop    %ebx
+  800e4d:	5e                   	pop    %esi
+  800e4e:	5f                   	pop    %edi
+  800e4f:	5d                   	pop    %ebp
+  800e50:	c3                   	ret
+
+00800e51 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e51:	55                   	push   %ebp
+  800e52:	89 e5                	mov    %esp,%ebp
+  800e54:	57                   	push   %edi
+  800e55:	56                   	push   %esi
+  800e56:	53                   	push   %ebx
+  800e57:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800e5a:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800e5d:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800e63:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800e66:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e74:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e77:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e79:	85 c0                	test   %eax,%eax
+  800e7b:	7f 08                	jg     800e85 <sys_page_map_range+0x34>
+}
+  800e7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e80:	5b                   	pop    %ebx
+  800e81:	5e                   	pop    %esi
+  800e82:	5f                   	pop    %edi
+  800e83:	5d                   	pop    %ebp
+  800e84:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e85:	83 ec 0c             	sub    $0xc,%esp
+  800e88:	50                   	push   %eax
+  800e89:	6a 10                	push   $0x10
+  800e8b:	68 8b 56 80 00       	push   $0x80568b
+  800e90:	6a 23                	push   $0x23
+  800e92:	68 a8 56 80 00       	push   $0x8056a8
+  800e97:	e8 b2 f2 ff ff       	call   80014e <_panic>
+
+00800e9c <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e9c:	55                   	push   %ebp
+  800e9d:	89 e5                	mov    %esp,%ebp
+  800e9f:	57                   	push   %edi
+  800ea0:	56                   	push   %esi
+  800ea1:	53                   	push   %ebx
+  800ea2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ea5:	be 00 00 00 00       	mov    $0x0,%esi
+  800eaa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ead:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb0:	b8 11 00 00 00       	mov    $0x11,%eax
+  800eb5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eb8:	89 f7                	mov    %esi,%edi
+  800eba:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ebc:	85 c0                	test   %eax,%eax
+  800ebe:	7f 08                	jg     800ec8 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ec0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec3:	5b                   	pop    %ebx
+  800ec4:	5e                   	pop    %esi
+  800ec5:	5f                   	pop    %edi
+  800ec6:	5d                   	pop    %ebp
+  800ec7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec8:	83 ec 0c             	sub    $0xc,%esp
+  800ecb:	50                   	push   %eax
+  800ecc:	6a 11                	push   $0x11
+  800ece:	68 8b 56 80 00       	push   $0x80568b
+  800ed3:	6a 23                	push   $0x23
+  800ed5:	68 a8 56 80 00       	push   $0x8056a8
+  800eda:	e8 6f f2 ff ff       	call   80014e <_panic>
+
+00800edf <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800edf:	55                   	push   %ebp
+  800ee0:	89 e5                	mov    %esp,%ebp
+  800ee2:	57                   	push   %edi
+  800ee3:	56                   	push   %esi
+  800ee4:	53                   	push   %ebx
+  800ee5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ee8:	be 00 00 00 00       	mov    $0x0,%esi
+  800eed:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800ef8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800efb:	89 f7                	mov    %esi,%edi
+  800efd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eff:	85 c0                	test   %eax,%eax
+  800f01:	7f 08                	jg     800f0b <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f06:	5b                   	pop    %ebx
+  800f07:	5e                   	pop    %esi
+  800f08:	5f                   	pop    %edi
+  800f09:	5d                   	pop    %ebp
+  800f0a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0b:	83 ec 0c             	sub    $0xc,%esp
+  800f0e:	50                   	push   %eax
+  800f0f:	6a 1b                	push   $0x1b
+  800f11:	68 8b 56 80 00       	push   $0x80568b
+  800f16:	6a 23                	push   $0x23
+  800f18:	68 a8 56 80 00       	push   $0x8056a8
+  800f1d:	e8 2c f2 ff ff       	call   80014e <_panic>
+
+00800f22 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800f22:	55                   	push   %ebp
+  800f23:	89 e5                	mov    %esp,%ebp
+  800f25:	57                   	push   %edi
+  800f26:	56                   	push   %esi
+  800f27:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f28:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f2d:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f32:	89 d1                	mov    %edx,%ecx
+  800f34:	89 d3                	mov    %edx,%ebx
+  800f36:	89 d7                	mov    %edx,%edi
+  800f38:	89 d6                	mov    %edx,%esi
+  800f3a:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f3c:	5b                   	pop    %ebx
+  800f3d:	5e                   	pop    %esi
+  800f3e:	5f                   	pop    %edi
+  800f3f:	5d                   	pop    %ebp
+  800f40:	c3                   	ret
+
+00800f41 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f41:	55                   	push   %ebp
+  800f42:	89 e5                	mov    %esp,%ebp
+  800f44:	57                   	push   %edi
+  800f45:	56                   	push   %esi
+  800f46:	53                   	push   %ebx
+  800f47:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f55:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f5a:	89 df                	mov    %ebx,%edi
+  800f5c:	89 de                	mov    %ebx,%esi
+  800f5e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f60:	85 c0                	test   %eax,%eax
+  800f62:	7f 08                	jg     800f6c <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f67:	5b                   	pop    %ebx
+  800f68:	5e                   	pop    %esi
+  800f69:	5f                   	pop    %edi
+  800f6a:	5d                   	pop    %ebp
+  800f6b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6c:	83 ec 0c             	sub    $0xc,%esp
+  800f6f:	50                   	push   %eax
+  800f70:	6a 08                	push   $0x8
+  800f72:	68 8b 56 80 00       	push   $0x80568b
+  800f77:	6a 23                	push   $0x23
+  800f79:	68 a8 56 80 00       	push   $0x8056a8
+  800f7e:	e8 cb f1 ff ff       	call   80014e <_panic>
+
+00800f83 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	57                   	push   %edi
+  800f87:	56                   	push   %esi
+  800f88:	53                   	push   %ebx
+  800f89:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800f8c:	6a 44                	push   $0x44
+  800f8e:	ff 75 0c             	push   0xc(%ebp)
+  800f91:	e8 7a fc ff ff       	call   800c10 <touch_mem>
+	asm volatile("int %1\n"
+  800f96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9e:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fa3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa6:	89 df                	mov    %ebx,%edi
+  800fa8:	89 de                	mov    %ebx,%esi
+  800faa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fac:	83 c4 08             	add    $0x8,%esp
+  800faf:	85 c0                	test   %eax,%eax
+  800fb1:	7f 08                	jg     800fbb <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb6:	5b                   	pop    %ebx
+  800fb7:	5e                   	pop    %esi
+  800fb8:	5f                   	pop    %edi
+  800fb9:	5d                   	pop    %ebp
+  800fba:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fbb:	83 ec 0c             	sub    $0xc,%esp
+  800fbe:	50                   	push   %eax
+  800fbf:	6a 09                	push   $0x9
+  800fc1:	68 8b 56 80 00       	push   $0x80568b
+  800fc6:	6a 23                	push   $0x23
+  800fc8:	68 a8 56 80 00       	push   $0x8056a8
+  800fcd:	e8 7c f1 ff ff       	call   80014e <_panic>
+
+00800fd2 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800fd2:	55                   	push   %ebp
+  800fd3:	89 e5                	mov    %esp,%ebp
+  800fd5:	57                   	push   %edi
+  800fd6:	56                   	push   %esi
+  800fd7:	53                   	push   %ebx
+  800fd8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fdb:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800feb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fee:	89 f7                	mov    %esi,%edi
+  800ff0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff2:	85 c0                	test   %eax,%eax
+  800ff4:	7f 08                	jg     800ffe <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800ff6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff9:	5b                   	pop    %ebx
+  800ffa:	5e                   	pop    %esi
+  800ffb:	5f                   	pop    %edi
+  800ffc:	5d                   	pop    %ebp
+  800ffd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ffe:	83 ec 0c             	sub    $0xc,%esp
+  801001:	50                   	push   %eax
+  801002:	6a 1a                	push   $0x1a
+  801004:	68 8b 56 80 00       	push   $0x80568b
+  801009:	6a 23                	push   $0x23
+  80100b:	68 a8 56 80 00       	push   $0x8056a8
+  801010:	e8 39 f1 ff ff       	call   80014e <_panic>
+
+00801015 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  801015:	55                   	push   %ebp
+  801016:	89 e5                	mov    %esp,%ebp
+  801018:	57                   	push   %edi
+  801019:	56                   	push   %esi
+  80101a:	53                   	push   %ebx
+  80101b:	83 ec 0c             	sub    $0xc,%esp
+  80101e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801021:	89 d8                	mov    %ebx,%eax
+  801023:	c1 e0 05             	shl    $0x5,%eax
+  801026:	50                   	push   %eax
+  801027:	ff 75 0c             	push   0xc(%ebp)
+  80102a:	e8 e1 fb ff ff       	call   800c10 <touch_mem>
+	asm volatile("int %1\n"
+  80102f:	be 00 00 00 00       	mov    $0x0,%esi
+  801034:	8b 55 08             	mov    0x8(%ebp),%edx
+  801037:	b8 13 00 00 00       	mov    $0x13,%eax
+  80103c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103f:	89 f7                	mov    %esi,%edi
+  801041:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801043:	83 c4 08             	add    $0x8,%esp
+  801046:	85 c0                	test   %eax,%eax
+  801048:	7f 08                	jg     801052 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  80104a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104d:	5b                   	pop    %ebx
+  80104e:	5e                   	pop    %esi
+  80104f:	5f                   	pop    %edi
+  801050:	5d                   	pop    %ebp
+  801051:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801052:	83 ec 0c             	sub    $0xc,%esp
+  801055:	50                   	push   %eax
+  801056:	6a 13                	push   $0x13
+  801058:	68 8b 56 80 00       	push   $0x80568b
+  80105d:	6a 23                	push   $0x23
+  80105f:	68 a8 56 80 00       	push   $0x8056a8
+  801064:	e8 e5 f0 ff ff       	call   80014e <_panic>
+
+00801069 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801069:	55                   	push   %ebp
+  80106a:	89 e5                	mov    %esp,%ebp
+  80106c:	57                   	push   %edi
+  80106d:	56                   	push   %esi
+  80106e:	53                   	push   %ebx
+  80106f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801072:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801077:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801082:	89 df                	mov    %ebx,%edi
+  801084:	89 de                	mov    %ebx,%esi
+  801086:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801088:	85 c0                	test   %eax,%eax
+  80108a:	7f 08                	jg     801094 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80108c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108f:	5b                   	pop    %ebx
+  801090:	5e                   	pop    %esi
+  801091:	5f                   	pop    %edi
+  801092:	5d                   	pop    %ebp
+  801093:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801094:	83 ec 0c             	sub    $0xc,%esp
+  801097:	50                   	push   %eax
+  801098:	6a 0a                	push   $0xa
+  80109a:	68 8b 56 80 00       	push   $0x80568b
+  80109f:	6a 23                	push   $0x23
+  8010a1:	68 a8 56 80 00       	push   $0x8056a8
+  8010a6:	e8 a3 f0 ff ff       	call   80014e <_panic>
+
+008010ab <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010ab:	55                   	push   %ebp
+  8010ac:	89 e5                	mov    %esp,%ebp
+  8010ae:	57                   	push   %edi
+  8010af:	56                   	push   %esi
+  8010b0:	53                   	push   %ebx
+  8010b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  8010b4:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010ba:	76 1d                	jbe    8010d9 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  8010bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010c7:	be 01 00 00 00       	mov    $0x1,%esi
+  8010cc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010cf:	cd 30                	int    $0x30
+}
+  8010d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d4:	5b                   	pop    %ebx
+  8010d5:	5e                   	pop    %esi
+  8010d6:	5f                   	pop    %edi
+  8010d7:	5d                   	pop    %ebp
+  8010d8:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8010d9:	68 00 10 00 00       	push   $0x1000
+  8010de:	53                   	push   %ebx
+  8010df:	e8 2c fb ff ff       	call   800c10 <touch_mem>
+  8010e4:	83 c4 08             	add    $0x8,%esp
+  8010e7:	eb d3                	jmp    8010bc <sys_ipc_send+0x11>
+
+008010e9 <sys_ipc_send_pages>:
+{
+  8010e9:	55                   	push   %ebp
+  8010ea:	89 e5                	mov    %esp,%ebp
+  8010ec:	57                   	push   %edi
+  8010ed:	56                   	push   %esi
+  8010ee:	53                   	push   %ebx
+  8010ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f2:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8010f5:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010fb:	76 18                	jbe    801115 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8010fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801100:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801103:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801108:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80110b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  80110d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801110:	5b                   	pop    %ebx
+  801111:	5e                   	pop    %esi
+  801112:	5f                   	pop    %edi
+  801113:	5d                   	pop    %ebp
+  801114:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801115:	89 f0                	mov    %esi,%eax
+  801117:	c1 e0 0c             	shl    $0xc,%eax
+  80111a:	50                   	push   %eax
+  80111b:	53                   	push   %ebx
+  80111c:	e8 ef fa ff ff       	call   800c10 <touch_mem>
+  801121:	83 c4 08             	add    $0x8,%esp
+  801124:	eb d7                	jmp    8010fd <sys_ipc_send_pages+0x14>
+
+00801126 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801126:	55                   	push   %ebp
+  801127:	89 e5                	mov    %esp,%ebp
+  801129:	57                   	push   %edi
+  80112a:	56                   	push   %esi
+  80112b:	53                   	push   %ebx
+  80112c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80112f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801134:	8b 55 08             	mov    0x8(%ebp),%edx
+  801137:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80113f:	89 df                	mov    %ebx,%edi
+  801141:	89 de                	mov    %ebx,%esi
+  801143:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801145:	85 c0                	test   %eax,%eax
+  801147:	7f 08                	jg     801151 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801149:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80114c:	5b                   	pop    %ebx
+  80114d:	5e                   	pop    %esi
+  80114e:	5f                   	pop    %edi
+  80114f:	5d                   	pop    %ebp
+  801150:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801151:	83 ec 0c             	sub    $0xc,%esp
+  801154:	50                   	push   %eax
+  801155:	6a 0d                	push   $0xd
+  801157:	68 8b 56 80 00       	push   $0x80568b
+  80115c:	6a 23                	push   $0x23
+  80115e:	68 a8 56 80 00       	push   $0x8056a8
+  801163:	e8 e6 ef ff ff       	call   80014e <_panic>
+
+00801168 <sys_ipc_recv>:
+{
+  801168:	55                   	push   %ebp
+  801169:	89 e5                	mov    %esp,%ebp
+  80116b:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80116e:	6a 01                	push   $0x1
+  801170:	ff 75 08             	push   0x8(%ebp)
+  801173:	e8 ae ff ff ff       	call   801126 <sys_ipc_recv_pages>
+}
+  801178:	c9                   	leave
+  801179:	c3                   	ret
+
+0080117a <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	57                   	push   %edi
+  80117e:	56                   	push   %esi
+  80117f:	53                   	push   %ebx
+  801180:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801183:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801186:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801189:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80118f:	77 04                	ja     801195 <sys_ipc_call+0x1b>
+  801191:	85 f6                	test   %esi,%esi
+  801193:	75 15                	jne    8011aa <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801195:	8b 55 08             	mov    0x8(%ebp),%edx
+  801198:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119b:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011a0:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8011a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a5:	5b                   	pop    %ebx
+  8011a6:	5e                   	pop    %esi
+  8011a7:	5f                   	pop    %edi
+  8011a8:	5d                   	pop    %ebp
+  8011a9:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8011aa:	89 f8                	mov    %edi,%eax
+  8011ac:	c1 e0 0c             	shl    $0xc,%eax
+  8011af:	50                   	push   %eax
+  8011b0:	53                   	push   %ebx
+  8011b1:	e8 5a fa ff ff       	call   800c10 <touch_mem>
+  8011b6:	83 c4 08             	add    $0x8,%esp
+  8011b9:	eb da                	jmp    801195 <sys_ipc_call+0x1b>
+
+008011bb <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8011bb:	55                   	push   %ebp
+  8011bc:	89 e5                	mov    %esp,%ebp
+  8011be:	57                   	push   %edi
+  8011bf:	56                   	push   %esi
+  8011c0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011cf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011d2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011d5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8011d7:	5b                   	pop    %ebx
+  8011d8:	5e                   	pop    %esi
+  8011d9:	5f                   	pop    %edi
+  8011da:	5d                   	pop    %ebp
+  8011db:	c3                   	ret
+
+008011dc <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8011dc:	55                   	push   %ebp
+  8011dd:	89 e5                	mov    %esp,%ebp
+  8011df:	57                   	push   %edi
+  8011e0:	56                   	push   %esi
+  8011e1:	53                   	push   %ebx
+  8011e2:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8011e5:	6a 04                	push   $0x4
+  8011e7:	ff 75 08             	push   0x8(%ebp)
+  8011ea:	e8 21 fa ff ff       	call   800c10 <touch_mem>
+	asm volatile("int %1\n"
+  8011ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f7:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801202:	89 f7                	mov    %esi,%edi
+  801204:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801206:	83 c4 08             	add    $0x8,%esp
+  801209:	85 c0                	test   %eax,%eax
+  80120b:	7f 08                	jg     801215 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  80120d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801210:	5b                   	pop    %ebx
+  801211:	5e                   	pop    %esi
+  801212:	5f                   	pop    %edi
+  801213:	5d                   	pop    %ebp
+  801214:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801215:	83 ec 0c             	sub    $0xc,%esp
+  801218:	50                   	push   %eax
+  801219:	6a 16                	push   $0x16
+  80121b:	68 8b 56 80 00       	push   $0x80568b
+  801220:	6a 23                	push   $0x23
+  801222:	68 a8 56 80 00       	push   $0x8056a8
+  801227:	e8 22 ef ff ff       	call   80014e <_panic>
+
+0080122c <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80122c:	55                   	push   %ebp
+  80122d:	89 e5                	mov    %esp,%ebp
+  80122f:	57                   	push   %edi
+  801230:	56                   	push   %esi
+  801231:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801232:	6a 04                	push   $0x4
+  801234:	ff 75 08             	push   0x8(%ebp)
+  801237:	e8 d4 f9 ff ff       	call   800c10 <touch_mem>
+	asm volatile("int %1\n"
+  80123c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801241:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801244:	b8 17 00 00 00       	mov    $0x17,%eax
+  801249:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124c:	89 df                	mov    %ebx,%edi
+  80124e:	89 de                	mov    %ebx,%esi
+  801250:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801252:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801255:	5b                   	pop    %ebx
+  801256:	5e                   	pop    %esi
+  801257:	5f                   	pop    %edi
+  801258:	5d                   	pop    %ebp
+  801259:	c3                   	ret
+
+0080125a <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80125a:	55                   	push   %ebp
+  80125b:	89 e5                	mov    %esp,%ebp
+  80125d:	57                   	push   %edi
+  80125e:	56                   	push   %esi
+  80125f:	53                   	push   %ebx
+  801260:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801263:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801268:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801270:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801275:	89 df                	mov    %ebx,%edi
+  801277:	89 de                	mov    %ebx,%esi
+  801279:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80127b:	85 c0                	test   %eax,%eax
+  80127d:	7f 08                	jg     801287 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80127f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801282:	5b                   	pop    %ebx
+  801283:	5e                   	pop    %esi
+  801284:	5f                   	pop    %edi
+  801285:	5d                   	pop    %ebp
+  801286:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801287:	83 ec 0c             	sub    $0xc,%esp
+  80128a:	50                   	push   %eax
+  80128b:	6a 0e                	push   $0xe
+  80128d:	68 8b 56 80 00       	push   $0x80568b
+  801292:	6a 23                	push   $0x23
+  801294:	68 a8 56 80 00       	push   $0x8056a8
+  801299:	e8 b0 ee ff ff       	call   80014e <_panic>
+
+0080129e <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  80129e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012a5:	f6 c6 06             	test   $0x6,%dh
+  8012a8:	75 37                	jne    8012e1 <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  8012aa:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012b1:	f6 c2 02             	test   $0x2,%dl
+  8012b4:	75 19                	jne    8012cf <dupperm+0x31>
+  8012b6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012bd:	f6 c6 08             	test   $0x8,%dh
+  8012c0:	75 0d                	jne    8012cf <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  8012c2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012c9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012ce:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  8012cf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012d6:	25 00 06 00 00       	and    $0x600,%eax
+  8012db:	0d 05 08 00 00       	or     $0x805,%eax
+  8012e0:	c3                   	ret
+		return 0;
+  8012e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012e6:	c3                   	ret
+
+008012e7 <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  8012e7:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  8012e9:	c1 e0 0c             	shl    $0xc,%eax
+  8012ec:	c1 e8 16             	shr    $0x16,%eax
+  8012ef:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8012f6:	f6 c1 01             	test   $0x1,%cl
+  8012f9:	74 2c                	je     801327 <dupable+0x40>
+  8012fb:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801302:	b8 00 00 00 00       	mov    $0x0,%eax
+  801307:	f6 c1 04             	test   $0x4,%cl
+  80130a:	74 20                	je     80132c <dupable+0x45>
+  80130c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801313:	f6 c1 01             	test   $0x1,%cl
+  801316:	74 14                	je     80132c <dupable+0x45>
+  801318:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  80131f:	c1 e8 02             	shr    $0x2,%eax
+  801322:	83 e0 01             	and    $0x1,%eax
+  801325:	eb 05                	jmp    80132c <dupable+0x45>
+  801327:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132c:	83 e0 01             	and    $0x1,%eax
+}
+  80132f:	c3                   	ret
+
+00801330 <pgfault>:
+{
+  801330:	55                   	push   %ebp
+  801331:	89 e5                	mov    %esp,%ebp
+  801333:	56                   	push   %esi
+  801334:	53                   	push   %ebx
+  801335:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801338:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  80133a:	89 ca                	mov    %ecx,%edx
+  80133c:	c1 ea 0c             	shr    $0xc,%edx
+  80133f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801346:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  80134a:	0f 84 8e 00 00 00    	je     8013de <pgfault+0xae>
+		return 0;
+  801350:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801355:	f6 c6 08             	test   $0x8,%dh
+  801358:	0f 84 85 00 00 00    	je     8013e3 <pgfault+0xb3>
+	perm |= PTE_W;
+  80135e:	81 e2 07 06 00 00    	and    $0x607,%edx
+  801364:	89 d3                	mov    %edx,%ebx
+  801366:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801369:	89 ce                	mov    %ecx,%esi
+  80136b:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  801371:	6a 01                	push   $0x1
+  801373:	53                   	push   %ebx
+  801374:	68 00 f0 7f 00       	push   $0x7ff000
+  801379:	6a 00                	push   $0x0
+  80137b:	e8 39 27 00 00       	call   803ab9 <page_alloc>
+  801380:	83 c4 10             	add    $0x10,%esp
+  801383:	85 c0                	test   %eax,%eax
+  801385:	78 33                	js     8013ba <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  801387:	83 ec 04             	sub    $0x4,%esp
+  80138a:	68 00 10 00 00       	push   $0x1000
+  80138f:	56                   	push   %esi
+  801390:	68 00 f0 7f 00       	push   $0x7ff000
+  801395:	e8 fc f5 ff ff       	call   800996 <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  80139a:	89 1c 24             	mov    %ebx,(%esp)
+  80139d:	56                   	push   %esi
+  80139e:	6a 00                	push   $0x0
+  8013a0:	68 00 f0 7f 00       	push   $0x7ff000
+  8013a5:	6a 00                	push   $0x0
+  8013a7:	e8 6e 2d 00 00       	call   80411a <page_map>
+  8013ac:	83 c4 20             	add    $0x20,%esp
+  8013af:	85 c0                	test   %eax,%eax
+  8013b1:	78 19                	js     8013cc <pgfault+0x9c>
+	return 1;
+  8013b3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013b8:	eb 29                	jmp    8013e3 <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  8013ba:	50                   	push   %eax
+  8013bb:	68 b8 56 80 00       	push   $0x8056b8
+  8013c0:	6a 2e                	push   $0x2e
+  8013c2:	68 0b 57 80 00       	push   $0x80570b
+  8013c7:	e8 82 ed ff ff       	call   80014e <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  8013cc:	50                   	push   %eax
+  8013cd:	68 e4 56 80 00       	push   $0x8056e4
+  8013d2:	6a 32                	push   $0x32
+  8013d4:	68 0b 57 80 00       	push   $0x80570b
+  8013d9:	e8 70 ed ff ff       	call   80014e <_panic>
+		return 0;
+  8013de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013e6:	5b                   	pop    %ebx
+  8013e7:	5e                   	pop    %esi
+  8013e8:	5d                   	pop    %ebp
+  8013e9:	c3                   	ret
+
+008013ea <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8013ea:	55                   	push   %ebp
+  8013eb:	89 e5                	mov    %esp,%ebp
+  8013ed:	57                   	push   %edi
+  8013ee:	56                   	push   %esi
+  8013ef:	53                   	push   %ebx
+  8013f0:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  8013f3:	83 3d 18 e9 80 00 00 	cmpl   $0x0,0x80e918
+  8013fa:	74 5d                	je     801459 <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  8013fc:	83 ec 0c             	sub    $0xc,%esp
+  8013ff:	68 30 13 80 00       	push   $0x801330
+  801404:	e8 72 39 00 00       	call   804d7b <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  801409:	e8 14 fb ff ff       	call   800f22 <sys_fork>
+  80140e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801411:	83 c4 10             	add    $0x10,%esp
+  801414:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  801417:	74 47                	je     801460 <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  801419:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80141d:	0f 84 c5 03 00 00    	je     8017e8 <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  801423:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801427:	78 25                	js     80144e <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  801429:	e8 03 20 00 00       	call   803431 <page_share_paged_out>
+  80142e:	85 c0                	test   %eax,%eax
+  801430:	0f 88 d8 03 00 00    	js     80180e <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801436:	83 ec 08             	sub    $0x8,%esp
+  801439:	6a 02                	push   $0x2
+  80143b:	ff 75 e4             	push   -0x1c(%ebp)
+  80143e:	e8 fe fa ff ff       	call   800f41 <sys_env_set_status>
+  801443:	83 c4 10             	add    $0x10,%esp
+  801446:	85 c0                	test   %eax,%eax
+  801448:	0f 88 d5 03 00 00    	js     801823 <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  80144e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801451:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801454:	5b                   	pop    %ebx
+  801455:	5e                   	pop    %esi
+  801456:	5f                   	pop    %edi
+  801457:	5d                   	pop    %ebp
+  801458:	c3                   	ret
+		init_map_dir();
+  801459:	e8 db 22 00 00       	call   803739 <init_map_dir>
+  80145e:	eb 9c                	jmp    8013fc <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801460:	b8 07 00 00 00       	mov    $0x7,%eax
+  801465:	cd 30                	int    $0x30
+  801467:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  80146a:	85 c0                	test   %eax,%eax
+  80146c:	78 10                	js     80147e <fork+0x94>
+	if (envid == 0)
+  80146e:	0f 84 74 03 00 00    	je     8017e8 <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801474:	be 00 00 00 00       	mov    $0x0,%esi
+  801479:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80147c:	eb 30                	jmp    8014ae <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  80147e:	50                   	push   %eax
+  80147f:	68 16 57 80 00       	push   $0x805716
+  801484:	68 cd 00 00 00       	push   $0xcd
+  801489:	68 0b 57 80 00       	push   $0x80570b
+  80148e:	e8 bb ec ff ff       	call   80014e <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  801493:	89 f2                	mov    %esi,%edx
+  801495:	c1 fa 1f             	sar    $0x1f,%edx
+  801498:	c1 ea 16             	shr    $0x16,%edx
+  80149b:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  80149e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014a3:	29 d0                	sub    %edx,%eax
+  8014a5:	ba 00 04 00 00       	mov    $0x400,%edx
+  8014aa:	29 c2                	sub    %eax,%edx
+  8014ac:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  8014ae:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8014b1:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  8014b7:	0f 87 ff 02 00 00    	ja     8017bc <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  8014bd:	89 f3                	mov    %esi,%ebx
+  8014bf:	c1 e3 0c             	shl    $0xc,%ebx
+  8014c2:	89 d8                	mov    %ebx,%eax
+  8014c4:	c1 e8 16             	shr    $0x16,%eax
+  8014c7:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8014ce:	f6 c2 01             	test   $0x1,%dl
+  8014d1:	74 c0                	je     801493 <fork+0xa9>
+  8014d3:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8014da:	f6 c2 04             	test   $0x4,%dl
+  8014dd:	74 b4                	je     801493 <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  8014df:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014e6:	a8 80                	test   $0x80,%al
+  8014e8:	75 24                	jne    80150e <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  8014ea:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8014f1:	25 81 00 00 00       	and    $0x81,%eax
+  8014f6:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8014fb:	74 21                	je     80151e <fork+0x134>
+		if (!dupable(pn)) {
+  8014fd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801500:	e8 e2 fd ff ff       	call   8012e7 <dupable>
+  801505:	84 c0                	test   %al,%al
+  801507:	75 1a                	jne    801523 <fork+0x139>
+			++pn;
+  801509:	83 c6 01             	add    $0x1,%esi
+			continue;
+  80150c:	eb a0                	jmp    8014ae <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  80150e:	83 ec 08             	sub    $0x8,%esp
+  801511:	53                   	push   %ebx
+  801512:	6a 00                	push   $0x0
+  801514:	e8 b1 f8 ff ff       	call   800dca <sys_page_split>
+  801519:	83 c4 10             	add    $0x10,%esp
+  80151c:	eb cc                	jmp    8014ea <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  80151e:	0f b6 03             	movzbl (%ebx),%eax
+  801521:	eb da                	jmp    8014fd <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  801523:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801526:	89 f8                	mov    %edi,%eax
+  801528:	e8 71 fd ff ff       	call   80129e <dupperm>
+  80152d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801530:	85 c0                	test   %eax,%eax
+  801532:	74 16                	je     80154a <fork+0x160>
+  801534:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  801539:	29 f8                	sub    %edi,%eax
+  80153b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  80153e:	bf 01 00 00 00       	mov    $0x1,%edi
+  801543:	89 c6                	mov    %eax,%esi
+  801545:	e9 c4 01 00 00       	jmp    80170e <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  80154a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80154d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801554:	f6 c4 04             	test   $0x4,%ah
+  801557:	0f 85 89 00 00 00    	jne    8015e6 <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  80155d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801560:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801567:	f6 c4 02             	test   $0x2,%ah
+  80156a:	0f 85 b1 00 00 00    	jne    801621 <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  801570:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801573:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80157a:	a8 02                	test   $0x2,%al
+  80157c:	75 10                	jne    80158e <fork+0x1a4>
+  80157e:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801585:	f6 c4 08             	test   $0x8,%ah
+  801588:	0f 84 3e 01 00 00    	je     8016cc <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  80158e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801591:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801598:	25 00 06 00 00       	and    $0x600,%eax
+  80159d:	0d 05 08 00 00       	or     $0x805,%eax
+  8015a2:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  8015a4:	c1 e1 0c             	shl    $0xc,%ecx
+  8015a7:	89 cb                	mov    %ecx,%ebx
+  8015a9:	83 ec 0c             	sub    $0xc,%esp
+  8015ac:	50                   	push   %eax
+  8015ad:	51                   	push   %ecx
+  8015ae:	ff 75 e4             	push   -0x1c(%ebp)
+  8015b1:	51                   	push   %ecx
+  8015b2:	6a 00                	push   $0x0
+  8015b4:	e8 61 2b 00 00       	call   80411a <page_map>
+  8015b9:	83 c4 20             	add    $0x20,%esp
+  8015bc:	85 c0                	test   %eax,%eax
+  8015be:	0f 88 e4 00 00 00    	js     8016a8 <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  8015c4:	83 ec 0c             	sub    $0xc,%esp
+  8015c7:	57                   	push   %edi
+  8015c8:	53                   	push   %ebx
+  8015c9:	6a 00                	push   $0x0
+  8015cb:	53                   	push   %ebx
+  8015cc:	6a 00                	push   $0x0
+  8015ce:	e8 47 2b 00 00       	call   80411a <page_map>
+  8015d3:	83 c4 20             	add    $0x20,%esp
+  8015d6:	85 c0                	test   %eax,%eax
+  8015d8:	0f 88 dc 00 00 00    	js     8016ba <fork+0x2d0>
+			++pn;
+  8015de:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8015e1:	e9 c8 fe ff ff       	jmp    8014ae <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8015e6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8015e9:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8015f0:	c1 e1 0c             	shl    $0xc,%ecx
+  8015f3:	83 ec 0c             	sub    $0xc,%esp
+  8015f6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015fb:	50                   	push   %eax
+  8015fc:	51                   	push   %ecx
+  8015fd:	ff 75 e4             	push   -0x1c(%ebp)
+  801600:	51                   	push   %ecx
+  801601:	6a 00                	push   $0x0
+  801603:	e8 12 2b 00 00       	call   80411a <page_map>
+  801608:	83 c4 20             	add    $0x20,%esp
+  80160b:	85 c0                	test   %eax,%eax
+  80160d:	79 cf                	jns    8015de <fork+0x1f4>
+			panic("page_map %d", r);
+  80160f:	50                   	push   %eax
+  801610:	68 26 57 80 00       	push   $0x805726
+  801615:	6a 4d                	push   $0x4d
+  801617:	68 0b 57 80 00       	push   $0x80570b
+  80161c:	e8 2d eb ff ff       	call   80014e <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  801621:	83 ec 0c             	sub    $0xc,%esp
+  801624:	68 00 10 00 00       	push   $0x1000
+  801629:	e8 de 30 00 00       	call   80470c <malloc>
+  80162e:	89 c7                	mov    %eax,%edi
+  801630:	83 c4 10             	add    $0x10,%esp
+  801633:	85 c0                	test   %eax,%eax
+  801635:	74 4b                	je     801682 <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  801637:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80163a:	c1 e3 0c             	shl    $0xc,%ebx
+  80163d:	83 ec 04             	sub    $0x4,%esp
+  801640:	68 00 10 00 00       	push   $0x1000
+  801645:	53                   	push   %ebx
+  801646:	50                   	push   %eax
+  801647:	e8 ac f3 ff ff       	call   8009f8 <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  80164c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80164f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801656:	25 07 0e 00 00       	and    $0xe07,%eax
+  80165b:	89 04 24             	mov    %eax,(%esp)
+  80165e:	53                   	push   %ebx
+  80165f:	ff 75 e4             	push   -0x1c(%ebp)
+  801662:	57                   	push   %edi
+  801663:	6a 00                	push   $0x0
+  801665:	e8 b0 2a 00 00       	call   80411a <page_map>
+  80166a:	83 c4 20             	add    $0x20,%esp
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	78 25                	js     801696 <fork+0x2ac>
+		free(temp);
+  801671:	83 ec 0c             	sub    $0xc,%esp
+  801674:	57                   	push   %edi
+  801675:	e8 90 2e 00 00       	call   80450a <free>
+  80167a:	83 c4 10             	add    $0x10,%esp
+  80167d:	e9 5c ff ff ff       	jmp    8015de <fork+0x1f4>
+			panic("malloc failed");
+  801682:	83 ec 04             	sub    $0x4,%esp
+  801685:	68 32 57 80 00       	push   $0x805732
+  80168a:	6a 56                	push   $0x56
+  80168c:	68 0b 57 80 00       	push   $0x80570b
+  801691:	e8 b8 ea ff ff       	call   80014e <_panic>
+			panic("page_map: %e", r);
+  801696:	50                   	push   %eax
+  801697:	68 40 57 80 00       	push   $0x805740
+  80169c:	6a 59                	push   $0x59
+  80169e:	68 0b 57 80 00       	push   $0x80570b
+  8016a3:	e8 a6 ea ff ff       	call   80014e <_panic>
+			panic("page_map %d", r);
+  8016a8:	50                   	push   %eax
+  8016a9:	68 26 57 80 00       	push   $0x805726
+  8016ae:	6a 65                	push   $0x65
+  8016b0:	68 0b 57 80 00       	push   $0x80570b
+  8016b5:	e8 94 ea ff ff       	call   80014e <_panic>
+			panic("page_map %d", r);
+  8016ba:	50                   	push   %eax
+  8016bb:	68 26 57 80 00       	push   $0x805726
+  8016c0:	6a 78                	push   $0x78
+  8016c2:	68 0b 57 80 00       	push   $0x80570b
+  8016c7:	e8 82 ea ff ff       	call   80014e <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8016cc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8016cf:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8016d6:	c1 e1 0c             	shl    $0xc,%ecx
+  8016d9:	83 ec 0c             	sub    $0xc,%esp
+  8016dc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016e1:	50                   	push   %eax
+  8016e2:	51                   	push   %ecx
+  8016e3:	ff 75 e4             	push   -0x1c(%ebp)
+  8016e6:	51                   	push   %ecx
+  8016e7:	6a 00                	push   $0x0
+  8016e9:	e8 2c 2a 00 00       	call   80411a <page_map>
+  8016ee:	83 c4 20             	add    $0x20,%esp
+  8016f1:	85 c0                	test   %eax,%eax
+  8016f3:	0f 89 e5 fe ff ff    	jns    8015de <fork+0x1f4>
+			panic("page_map %d", r);
+  8016f9:	50                   	push   %eax
+  8016fa:	68 26 57 80 00       	push   $0x805726
+  8016ff:	6a 7f                	push   $0x7f
+  801701:	68 0b 57 80 00       	push   $0x80570b
+  801706:	e8 43 ea ff ff       	call   80014e <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  80170b:	83 c7 01             	add    $0x1,%edi
+  80170e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801711:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  801714:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  801717:	39 f7                	cmp    %esi,%edi
+  801719:	74 1c                	je     801737 <fork+0x34d>
+  80171b:	89 d8                	mov    %ebx,%eax
+  80171d:	e8 c5 fb ff ff       	call   8012e7 <dupable>
+  801722:	84 c0                	test   %al,%al
+  801724:	74 7c                	je     8017a2 <fork+0x3b8>
+  801726:	89 d8                	mov    %ebx,%eax
+  801728:	e8 71 fb ff ff       	call   80129e <dupperm>
+  80172d:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  801730:	74 d9                	je     80170b <fork+0x321>
+  801732:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801735:	eb 06                	jmp    80173d <fork+0x353>
+  801737:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80173a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  80173d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801740:	c1 e0 0c             	shl    $0xc,%eax
+  801743:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801746:	83 ec 08             	sub    $0x8,%esp
+  801749:	ff 75 dc             	push   -0x24(%ebp)
+  80174c:	57                   	push   %edi
+  80174d:	50                   	push   %eax
+  80174e:	ff 75 e4             	push   -0x1c(%ebp)
+  801751:	50                   	push   %eax
+  801752:	6a 00                	push   $0x0
+  801754:	e8 b8 2b 00 00       	call   804311 <page_map_range>
+  801759:	83 c4 20             	add    $0x20,%esp
+  80175c:	85 c0                	test   %eax,%eax
+  80175e:	78 47                	js     8017a7 <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  801760:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801767:	0f 84 41 fd ff ff    	je     8014ae <fork+0xc4>
+  80176d:	83 ec 08             	sub    $0x8,%esp
+  801770:	ff 75 dc             	push   -0x24(%ebp)
+  801773:	57                   	push   %edi
+  801774:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801777:	50                   	push   %eax
+  801778:	6a 00                	push   $0x0
+  80177a:	50                   	push   %eax
+  80177b:	6a 00                	push   $0x0
+  80177d:	e8 8f 2b 00 00       	call   804311 <page_map_range>
+  801782:	83 c4 20             	add    $0x20,%esp
+  801785:	85 c0                	test   %eax,%eax
+  801787:	0f 89 21 fd ff ff    	jns    8014ae <fork+0xc4>
+		panic("page_map_range %e", r);
+  80178d:	50                   	push   %eax
+  80178e:	68 4d 57 80 00       	push   $0x80574d
+  801793:	68 a2 00 00 00       	push   $0xa2
+  801798:	68 0b 57 80 00       	push   $0x80570b
+  80179d:	e8 ac e9 ff ff       	call   80014e <_panic>
+  8017a2:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8017a5:	eb 96                	jmp    80173d <fork+0x353>
+		panic("page_map_range %e", r);
+  8017a7:	50                   	push   %eax
+  8017a8:	68 4d 57 80 00       	push   $0x80574d
+  8017ad:	68 a0 00 00 00       	push   $0xa0
+  8017b2:	68 0b 57 80 00       	push   $0x80570b
+  8017b7:	e8 92 e9 ff ff       	call   80014e <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  8017bc:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  8017bf:	6a 01                	push   $0x1
+  8017c1:	6a 07                	push   $0x7
+  8017c3:	68 00 f0 bf ee       	push   $0xeebff000
+  8017c8:	53                   	push   %ebx
+  8017c9:	e8 eb 22 00 00       	call   803ab9 <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8017ce:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  8017d3:	8b 40 74             	mov    0x74(%eax),%eax
+  8017d6:	83 c4 08             	add    $0x8,%esp
+  8017d9:	50                   	push   %eax
+  8017da:	53                   	push   %ebx
+  8017db:	e8 89 f8 ff ff       	call   801069 <sys_env_set_pgfault_upcall>
+  8017e0:	83 c4 10             	add    $0x10,%esp
+  8017e3:	e9 41 fc ff ff       	jmp    801429 <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8017e8:	e8 d8 f4 ff ff       	call   800cc5 <sys_getenvid>
+  8017ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017f2:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8017f5:	c1 e0 06             	shl    $0x6,%eax
+  8017f8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017fd:	a3 1c e9 80 00       	mov    %eax,0x80e91c
+		return 0;
+  801802:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801809:	e9 40 fc ff ff       	jmp    80144e <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  80180e:	50                   	push   %eax
+  80180f:	68 5f 57 80 00       	push   $0x80575f
+  801814:	68 27 01 00 00       	push   $0x127
+  801819:	68 0b 57 80 00       	push   $0x80570b
+  80181e:	e8 2b e9 ff ff       	call   80014e <_panic>
+		panic("sys_env_set_status: %d", r);
+  801823:	50                   	push   %eax
+  801824:	68 78 57 80 00       	push   $0x805778
+  801829:	68 2b 01 00 00       	push   $0x12b
+  80182e:	68 0b 57 80 00       	push   $0x80570b
+  801833:	e8 16 e9 ff ff       	call   80014e <_panic>
+
+00801838 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801838:	55                   	push   %ebp
+  801839:	89 e5                	mov    %esp,%ebp
+  80183b:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80183e:	68 8f 57 80 00       	push   $0x80578f
+  801843:	68 35 01 00 00       	push   $0x135
+  801848:	68 0b 57 80 00       	push   $0x80570b
+  80184d:	e8 fc e8 ff ff       	call   80014e <_panic>
+
+00801852 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801852:	55                   	push   %ebp
+  801853:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801855:	8b 45 08             	mov    0x8(%ebp),%eax
+  801858:	05 00 00 00 30       	add    $0x30000000,%eax
+  80185d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801860:	5d                   	pop    %ebp
+  801861:	c3                   	ret
+
+00801862 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801862:	55                   	push   %ebp
+  801863:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801865:	8b 45 08             	mov    0x8(%ebp),%eax
+  801868:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80186d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801872:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801877:	5d                   	pop    %ebp
+  801878:	c3                   	ret
+
+00801879 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801879:	55                   	push   %ebp
+  80187a:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  80187c:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801881:	a8 01                	test   $0x1,%al
+  801883:	74 3c                	je     8018c1 <fd_alloc+0x48>
+  801885:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80188a:	89 c2                	mov    %eax,%edx
+  80188c:	c1 ea 0c             	shr    $0xc,%edx
+  80188f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801896:	89 c1                	mov    %eax,%ecx
+  801898:	05 00 10 00 00       	add    $0x1000,%eax
+  80189d:	f6 c2 01             	test   $0x1,%dl
+  8018a0:	74 13                	je     8018b5 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8018a2:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8018a7:	75 e1                	jne    80188a <fd_alloc+0x11>
+  8018a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8018ae:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8018b3:	eb 05                	jmp    8018ba <fd_alloc+0x41>
+			return 0;
+  8018b5:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8018ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018bd:	89 0a                	mov    %ecx,(%edx)
+}
+  8018bf:	5d                   	pop    %ebp
+  8018c0:	c3                   	ret
+  8018c1:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8018c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018cb:	eb ed                	jmp    8018ba <fd_alloc+0x41>
+
+008018cd <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8018cd:	55                   	push   %ebp
+  8018ce:	89 e5                	mov    %esp,%ebp
+  8018d0:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8018d3:	83 f8 1f             	cmp    $0x1f,%eax
+  8018d6:	77 30                	ja     801908 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8018d8:	c1 e0 0c             	shl    $0xc,%eax
+  8018db:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8018e0:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8018e6:	f6 c2 01             	test   $0x1,%dl
+  8018e9:	74 24                	je     80190f <fd_lookup+0x42>
+  8018eb:	89 c2                	mov    %eax,%edx
+  8018ed:	c1 ea 0c             	shr    $0xc,%edx
+  8018f0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8018f7:	f6 c2 01             	test   $0x1,%dl
+  8018fa:	74 1a                	je     801916 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8018fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018ff:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801901:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801906:	5d                   	pop    %ebp
+  801907:	c3                   	ret
+		return -E_INVAL;
+  801908:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80190d:	eb f7                	jmp    801906 <fd_lookup+0x39>
+		return -E_INVAL;
+  80190f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801914:	eb f0                	jmp    801906 <fd_lookup+0x39>
+  801916:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80191b:	eb e9                	jmp    801906 <fd_lookup+0x39>
+
+0080191d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80191d:	55                   	push   %ebp
+  80191e:	89 e5                	mov    %esp,%ebp
+  801920:	53                   	push   %ebx
+  801921:	83 ec 04             	sub    $0x4,%esp
+  801924:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801927:	b8 24 58 80 00       	mov    $0x805824,%eax
+  80192c:	8b 18                	mov    (%eax),%ebx
+  80192e:	85 db                	test   %ebx,%ebx
+  801930:	74 0e                	je     801940 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801932:	83 c0 04             	add    $0x4,%eax
+  801935:	39 13                	cmp    %edx,(%ebx)
+  801937:	75 f3                	jne    80192c <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801939:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193e:	eb 1f                	jmp    80195f <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801940:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  801945:	8b 40 48             	mov    0x48(%eax),%eax
+  801948:	83 ec 04             	sub    $0x4,%esp
+  80194b:	52                   	push   %edx
+  80194c:	50                   	push   %eax
+  80194d:	68 a8 57 80 00       	push   $0x8057a8
+  801952:	e8 d2 e8 ff ff       	call   800229 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801957:	83 c4 10             	add    $0x10,%esp
+  80195a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80195f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801962:	89 1a                	mov    %ebx,(%edx)
+}
+  801964:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801967:	c9                   	leave
+  801968:	c3                   	ret
+
+00801969 <fd_close>:
+{
+  801969:	55                   	push   %ebp
+  80196a:	89 e5                	mov    %esp,%ebp
+  80196c:	57                   	push   %edi
+  80196d:	56                   	push   %esi
+  80196e:	53                   	push   %ebx
+  80196f:	83 ec 24             	sub    $0x24,%esp
+  801972:	8b 75 08             	mov    0x8(%ebp),%esi
+  801975:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801978:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80197b:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80197c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801982:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801985:	50                   	push   %eax
+  801986:	e8 42 ff ff ff       	call   8018cd <fd_lookup>
+  80198b:	89 c3                	mov    %eax,%ebx
+  80198d:	83 c4 10             	add    $0x10,%esp
+  801990:	85 c0                	test   %eax,%eax
+  801992:	78 05                	js     801999 <fd_close+0x30>
+	    || fd != fd2)
+  801994:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801997:	74 16                	je     8019af <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801999:	89 f8                	mov    %edi,%eax
+  80199b:	84 c0                	test   %al,%al
+  80199d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a2:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8019a5:	89 d8                	mov    %ebx,%eax
+  8019a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019aa:	5b                   	pop    %ebx
+  8019ab:	5e                   	pop    %esi
+  8019ac:	5f                   	pop    %edi
+  8019ad:	5d                   	pop    %ebp
+  8019ae:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019af:	83 ec 08             	sub    $0x8,%esp
+  8019b2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8019b5:	50                   	push   %eax
+  8019b6:	ff 36                	push   (%esi)
+  8019b8:	e8 60 ff ff ff       	call   80191d <dev_lookup>
+  8019bd:	89 c3                	mov    %eax,%ebx
+  8019bf:	83 c4 10             	add    $0x10,%esp
+  8019c2:	85 c0                	test   %eax,%eax
+  8019c4:	78 1a                	js     8019e0 <fd_close+0x77>
+		if (dev->dev_close)
+  8019c6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019c9:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8019cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8019d1:	85 c0                	test   %eax,%eax
+  8019d3:	74 0b                	je     8019e0 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8019d5:	83 ec 0c             	sub    $0xc,%esp
+  8019d8:	56                   	push   %esi
+  8019d9:	ff d0                	call   *%eax
+  8019db:	89 c3                	mov    %eax,%ebx
+  8019dd:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8019e0:	83 ec 08             	sub    $0x8,%esp
+  8019e3:	56                   	push   %esi
+  8019e4:	6a 00                	push   $0x0
+  8019e6:	e8 9d f3 ff ff       	call   800d88 <sys_page_unmap>
+	return r;
+  8019eb:	83 c4 10             	add    $0x10,%esp
+  8019ee:	eb b5                	jmp    8019a5 <fd_close+0x3c>
+
+008019f0 <close>:
+
+int
+close(int fdnum)
+{
+  8019f0:	55                   	push   %ebp
+  8019f1:	89 e5                	mov    %esp,%ebp
+  8019f3:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019f9:	50                   	push   %eax
+  8019fa:	ff 75 08             	push   0x8(%ebp)
+  8019fd:	e8 cb fe ff ff       	call   8018cd <fd_lookup>
+  801a02:	83 c4 10             	add    $0x10,%esp
+  801a05:	85 c0                	test   %eax,%eax
+  801a07:	79 02                	jns    801a0b <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a09:	c9                   	leave
+  801a0a:	c3                   	ret
+		return fd_close(fd, 1);
+  801a0b:	83 ec 08             	sub    $0x8,%esp
+  801a0e:	6a 01                	push   $0x1
+  801a10:	ff 75 f4             	push   -0xc(%ebp)
+  801a13:	e8 51 ff ff ff       	call   801969 <fd_close>
+  801a18:	83 c4 10             	add    $0x10,%esp
+  801a1b:	eb ec                	jmp    801a09 <close+0x19>
+
+00801a1d <close_all>:
+
+void
+close_all(void)
+{
+  801a1d:	55                   	push   %ebp
+  801a1e:	89 e5                	mov    %esp,%ebp
+  801a20:	53                   	push   %ebx
+  801a21:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a24:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a29:	83 ec 0c             	sub    $0xc,%esp
+  801a2c:	53                   	push   %ebx
+  801a2d:	e8 be ff ff ff       	call   8019f0 <close>
+	for (i = 0; i < MAXFD; i++)
+  801a32:	83 c3 01             	add    $0x1,%ebx
+  801a35:	83 c4 10             	add    $0x10,%esp
+  801a38:	83 fb 20             	cmp    $0x20,%ebx
+  801a3b:	75 ec                	jne    801a29 <close_all+0xc>
+}
+  801a3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a40:	c9                   	leave
+  801a41:	c3                   	ret
+
+00801a42 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801a42:	55                   	push   %ebp
+  801a43:	89 e5                	mov    %esp,%ebp
+  801a45:	57                   	push   %edi
+  801a46:	56                   	push   %esi
+  801a47:	53                   	push   %ebx
+  801a48:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801a4b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a4e:	50                   	push   %eax
+  801a4f:	ff 75 08             	push   0x8(%ebp)
+  801a52:	e8 76 fe ff ff       	call   8018cd <fd_lookup>
+  801a57:	89 c3                	mov    %eax,%ebx
+  801a59:	83 c4 10             	add    $0x10,%esp
+  801a5c:	85 c0                	test   %eax,%eax
+  801a5e:	78 7f                	js     801adf <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a60:	83 ec 0c             	sub    $0xc,%esp
+  801a63:	ff 75 0c             	push   0xc(%ebp)
+  801a66:	e8 85 ff ff ff       	call   8019f0 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801a6b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a6e:	c1 e6 0c             	shl    $0xc,%esi
+  801a71:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801a77:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a7a:	89 3c 24             	mov    %edi,(%esp)
+  801a7d:	e8 e0 fd ff ff       	call   801862 <fd2data>
+  801a82:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801a84:	89 34 24             	mov    %esi,(%esp)
+  801a87:	e8 d6 fd ff ff       	call   801862 <fd2data>
+  801a8c:	83 c4 10             	add    $0x10,%esp
+  801a8f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a92:	89 d8                	mov    %ebx,%eax
+  801a94:	c1 e8 16             	shr    $0x16,%eax
+  801a97:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a9e:	a8 01                	test   $0x1,%al
+  801aa0:	74 11                	je     801ab3 <dup+0x71>
+  801aa2:	89 d8                	mov    %ebx,%eax
+  801aa4:	c1 e8 0c             	shr    $0xc,%eax
+  801aa7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801aae:	f6 c2 01             	test   $0x1,%dl
+  801ab1:	75 36                	jne    801ae9 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801ab3:	89 f8                	mov    %edi,%eax
+  801ab5:	c1 e8 0c             	shr    $0xc,%eax
+  801ab8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801abf:	83 ec 0c             	sub    $0xc,%esp
+  801ac2:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ac7:	50                   	push   %eax
+  801ac8:	56                   	push   %esi
+  801ac9:	6a 00                	push   $0x0
+  801acb:	57                   	push   %edi
+  801acc:	6a 00                	push   $0x0
+  801ace:	e8 73 f2 ff ff       	call   800d46 <sys_page_map>
+  801ad3:	89 c3                	mov    %eax,%ebx
+  801ad5:	83 c4 20             	add    $0x20,%esp
+  801ad8:	85 c0                	test   %eax,%eax
+  801ada:	78 33                	js     801b0f <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801adc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801adf:	89 d8                	mov    %ebx,%eax
+  801ae1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ae4:	5b                   	pop    %ebx
+  801ae5:	5e                   	pop    %esi
+  801ae6:	5f                   	pop    %edi
+  801ae7:	5d                   	pop    %ebp
+  801ae8:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801ae9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801af0:	83 ec 0c             	sub    $0xc,%esp
+  801af3:	25 07 0e 00 00       	and    $0xe07,%eax
+  801af8:	50                   	push   %eax
+  801af9:	ff 75 d4             	push   -0x2c(%ebp)
+  801afc:	6a 00                	push   $0x0
+  801afe:	53                   	push   %ebx
+  801aff:	6a 00                	push   $0x0
+  801b01:	e8 40 f2 ff ff       	call   800d46 <sys_page_map>
+  801b06:	89 c3                	mov    %eax,%ebx
+  801b08:	83 c4 20             	add    $0x20,%esp
+  801b0b:	85 c0                	test   %eax,%eax
+  801b0d:	79 a4                	jns    801ab3 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b0f:	83 ec 08             	sub    $0x8,%esp
+  801b12:	56                   	push   %esi
+  801b13:	6a 00                	push   $0x0
+  801b15:	e8 6e f2 ff ff       	call   800d88 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b1a:	83 c4 08             	add    $0x8,%esp
+  801b1d:	ff 75 d4             	push   -0x2c(%ebp)
+  801b20:	6a 00                	push   $0x0
+  801b22:	e8 61 f2 ff ff       	call   800d88 <sys_page_unmap>
+	return r;
+  801b27:	83 c4 10             	add    $0x10,%esp
+  801b2a:	eb b3                	jmp    801adf <dup+0x9d>
+
+00801b2c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b2c:	55                   	push   %ebp
+  801b2d:	89 e5                	mov    %esp,%ebp
+  801b2f:	56                   	push   %esi
+  801b30:	53                   	push   %ebx
+  801b31:	83 ec 18             	sub    $0x18,%esp
+  801b34:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b37:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b3a:	50                   	push   %eax
+  801b3b:	56                   	push   %esi
+  801b3c:	e8 8c fd ff ff       	call   8018cd <fd_lookup>
+  801b41:	83 c4 10             	add    $0x10,%esp
+  801b44:	85 c0                	test   %eax,%eax
+  801b46:	78 3c                	js     801b84 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b48:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801b4b:	83 ec 08             	sub    $0x8,%esp
+  801b4e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b51:	50                   	push   %eax
+  801b52:	ff 33                	push   (%ebx)
+  801b54:	e8 c4 fd ff ff       	call   80191d <dev_lookup>
+  801b59:	83 c4 10             	add    $0x10,%esp
+  801b5c:	85 c0                	test   %eax,%eax
+  801b5e:	78 24                	js     801b84 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b60:	8b 43 08             	mov    0x8(%ebx),%eax
+  801b63:	83 e0 03             	and    $0x3,%eax
+  801b66:	83 f8 01             	cmp    $0x1,%eax
+  801b69:	74 20                	je     801b8b <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801b6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b6e:	8b 40 08             	mov    0x8(%eax),%eax
+  801b71:	85 c0                	test   %eax,%eax
+  801b73:	74 37                	je     801bac <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801b75:	83 ec 04             	sub    $0x4,%esp
+  801b78:	ff 75 10             	push   0x10(%ebp)
+  801b7b:	ff 75 0c             	push   0xc(%ebp)
+  801b7e:	53                   	push   %ebx
+  801b7f:	ff d0                	call   *%eax
+  801b81:	83 c4 10             	add    $0x10,%esp
+}
+  801b84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b87:	5b                   	pop    %ebx
+  801b88:	5e                   	pop    %esi
+  801b89:	5d                   	pop    %ebp
+  801b8a:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b8b:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  801b90:	8b 40 48             	mov    0x48(%eax),%eax
+  801b93:	83 ec 04             	sub    $0x4,%esp
+  801b96:	56                   	push   %esi
+  801b97:	50                   	push   %eax
+  801b98:	68 e9 57 80 00       	push   $0x8057e9
+  801b9d:	e8 87 e6 ff ff       	call   800229 <cprintf>
+		return -E_INVAL;
+  801ba2:	83 c4 10             	add    $0x10,%esp
+  801ba5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801baa:	eb d8                	jmp    801b84 <read+0x58>
+		return -E_NOT_SUPP;
+  801bac:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bb1:	eb d1                	jmp    801b84 <read+0x58>
+
+00801bb3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801bb3:	55                   	push   %ebp
+  801bb4:	89 e5                	mov    %esp,%ebp
+  801bb6:	57                   	push   %edi
+  801bb7:	56                   	push   %esi
+  801bb8:	53                   	push   %ebx
+  801bb9:	83 ec 0c             	sub    $0xc,%esp
+  801bbc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801bbf:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801bc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bc7:	eb 02                	jmp    801bcb <readn+0x18>
+  801bc9:	01 c3                	add    %eax,%ebx
+  801bcb:	39 f3                	cmp    %esi,%ebx
+  801bcd:	73 21                	jae    801bf0 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801bcf:	83 ec 04             	sub    $0x4,%esp
+  801bd2:	89 f0                	mov    %esi,%eax
+  801bd4:	29 d8                	sub    %ebx,%eax
+  801bd6:	50                   	push   %eax
+  801bd7:	89 d8                	mov    %ebx,%eax
+  801bd9:	03 45 0c             	add    0xc(%ebp),%eax
+  801bdc:	50                   	push   %eax
+  801bdd:	57                   	push   %edi
+  801bde:	e8 49 ff ff ff       	call   801b2c <read>
+		if (m < 0)
+  801be3:	83 c4 10             	add    $0x10,%esp
+  801be6:	85 c0                	test   %eax,%eax
+  801be8:	78 04                	js     801bee <readn+0x3b>
+			return m;
+		if (m == 0)
+  801bea:	75 dd                	jne    801bc9 <readn+0x16>
+  801bec:	eb 02                	jmp    801bf0 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801bee:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801bf0:	89 d8                	mov    %ebx,%eax
+  801bf2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bf5:	5b                   	pop    %ebx
+  801bf6:	5e                   	pop    %esi
+  801bf7:	5f                   	pop    %edi
+  801bf8:	5d                   	pop    %ebp
+  801bf9:	c3                   	ret
+
+00801bfa <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801bfa:	55                   	push   %ebp
+  801bfb:	89 e5                	mov    %esp,%ebp
+  801bfd:	56                   	push   %esi
+  801bfe:	53                   	push   %ebx
+  801bff:	83 ec 18             	sub    $0x18,%esp
+  801c02:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c05:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c08:	50                   	push   %eax
+  801c09:	53                   	push   %ebx
+  801c0a:	e8 be fc ff ff       	call   8018cd <fd_lookup>
+  801c0f:	83 c4 10             	add    $0x10,%esp
+  801c12:	85 c0                	test   %eax,%eax
+  801c14:	78 37                	js     801c4d <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c16:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c19:	83 ec 08             	sub    $0x8,%esp
+  801c1c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c1f:	50                   	push   %eax
+  801c20:	ff 36                	push   (%esi)
+  801c22:	e8 f6 fc ff ff       	call   80191d <dev_lookup>
+  801c27:	83 c4 10             	add    $0x10,%esp
+  801c2a:	85 c0                	test   %eax,%eax
+  801c2c:	78 1f                	js     801c4d <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c2e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c32:	74 20                	je     801c54 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801c34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c37:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c3a:	85 c0                	test   %eax,%eax
+  801c3c:	74 37                	je     801c75 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c3e:	83 ec 04             	sub    $0x4,%esp
+  801c41:	ff 75 10             	push   0x10(%ebp)
+  801c44:	ff 75 0c             	push   0xc(%ebp)
+  801c47:	56                   	push   %esi
+  801c48:	ff d0                	call   *%eax
+  801c4a:	83 c4 10             	add    $0x10,%esp
+}
+  801c4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c50:	5b                   	pop    %ebx
+  801c51:	5e                   	pop    %esi
+  801c52:	5d                   	pop    %ebp
+  801c53:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c54:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  801c59:	8b 40 48             	mov    0x48(%eax),%eax
+  801c5c:	83 ec 04             	sub    $0x4,%esp
+  801c5f:	53                   	push   %ebx
+  801c60:	50                   	push   %eax
+  801c61:	68 05 58 80 00       	push   $0x805805
+  801c66:	e8 be e5 ff ff       	call   800229 <cprintf>
+		return -E_INVAL;
+  801c6b:	83 c4 10             	add    $0x10,%esp
+  801c6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c73:	eb d8                	jmp    801c4d <write+0x53>
+		return -E_NOT_SUPP;
+  801c75:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c7a:	eb d1                	jmp    801c4d <write+0x53>
+
+00801c7c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c7c:	55                   	push   %ebp
+  801c7d:	89 e5                	mov    %esp,%ebp
+  801c7f:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c82:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c85:	50                   	push   %eax
+  801c86:	ff 75 08             	push   0x8(%ebp)
+  801c89:	e8 3f fc ff ff       	call   8018cd <fd_lookup>
+  801c8e:	83 c4 10             	add    $0x10,%esp
+  801c91:	85 c0                	test   %eax,%eax
+  801c93:	78 0e                	js     801ca3 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c95:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c9b:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ca3:	c9                   	leave
+  801ca4:	c3                   	ret
+
+00801ca5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801ca5:	55                   	push   %ebp
+  801ca6:	89 e5                	mov    %esp,%ebp
+  801ca8:	56                   	push   %esi
+  801ca9:	53                   	push   %ebx
+  801caa:	83 ec 18             	sub    $0x18,%esp
+  801cad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cb0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cb3:	50                   	push   %eax
+  801cb4:	53                   	push   %ebx
+  801cb5:	e8 13 fc ff ff       	call   8018cd <fd_lookup>
+  801cba:	83 c4 10             	add    $0x10,%esp
+  801cbd:	85 c0                	test   %eax,%eax
+  801cbf:	78 34                	js     801cf5 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cc1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cc4:	83 ec 08             	sub    $0x8,%esp
+  801cc7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cca:	50                   	push   %eax
+  801ccb:	ff 36                	push   (%esi)
+  801ccd:	e8 4b fc ff ff       	call   80191d <dev_lookup>
+  801cd2:	83 c4 10             	add    $0x10,%esp
+  801cd5:	85 c0                	test   %eax,%eax
+  801cd7:	78 1c                	js     801cf5 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cd9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cdd:	74 1d                	je     801cfc <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801cdf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ce2:	8b 40 18             	mov    0x18(%eax),%eax
+  801ce5:	85 c0                	test   %eax,%eax
+  801ce7:	74 34                	je     801d1d <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801ce9:	83 ec 08             	sub    $0x8,%esp
+  801cec:	ff 75 0c             	push   0xc(%ebp)
+  801cef:	56                   	push   %esi
+  801cf0:	ff d0                	call   *%eax
+  801cf2:	83 c4 10             	add    $0x10,%esp
+}
+  801cf5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cf8:	5b                   	pop    %ebx
+  801cf9:	5e                   	pop    %esi
+  801cfa:	5d                   	pop    %ebp
+  801cfb:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801cfc:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  801d01:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d04:	83 ec 04             	sub    $0x4,%esp
+  801d07:	53                   	push   %ebx
+  801d08:	50                   	push   %eax
+  801d09:	68 c8 57 80 00       	push   $0x8057c8
+  801d0e:	e8 16 e5 ff ff       	call   800229 <cprintf>
+		return -E_INVAL;
+  801d13:	83 c4 10             	add    $0x10,%esp
+  801d16:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d1b:	eb d8                	jmp    801cf5 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801d1d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d22:	eb d1                	jmp    801cf5 <ftruncate+0x50>
+
+00801d24 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d24:	55                   	push   %ebp
+  801d25:	89 e5                	mov    %esp,%ebp
+  801d27:	56                   	push   %esi
+  801d28:	53                   	push   %ebx
+  801d29:	83 ec 18             	sub    $0x18,%esp
+  801d2c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d2f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d32:	50                   	push   %eax
+  801d33:	ff 75 08             	push   0x8(%ebp)
+  801d36:	e8 92 fb ff ff       	call   8018cd <fd_lookup>
+  801d3b:	83 c4 10             	add    $0x10,%esp
+  801d3e:	85 c0                	test   %eax,%eax
+  801d40:	78 49                	js     801d8b <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d42:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d45:	83 ec 08             	sub    $0x8,%esp
+  801d48:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d4b:	50                   	push   %eax
+  801d4c:	ff 36                	push   (%esi)
+  801d4e:	e8 ca fb ff ff       	call   80191d <dev_lookup>
+  801d53:	83 c4 10             	add    $0x10,%esp
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	78 31                	js     801d8b <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d5d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d61:	74 2f                	je     801d92 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d63:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d66:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d6d:	00 00 00 
+	stat->st_isdir = 0;
+  801d70:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d77:	00 00 00 
+	stat->st_dev = dev;
+  801d7a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d80:	83 ec 08             	sub    $0x8,%esp
+  801d83:	53                   	push   %ebx
+  801d84:	56                   	push   %esi
+  801d85:	ff 50 14             	call   *0x14(%eax)
+  801d88:	83 c4 10             	add    $0x10,%esp
+}
+  801d8b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d8e:	5b                   	pop    %ebx
+  801d8f:	5e                   	pop    %esi
+  801d90:	5d                   	pop    %ebp
+  801d91:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d92:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d97:	eb f2                	jmp    801d8b <fstat+0x67>
+
+00801d99 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d99:	55                   	push   %ebp
+  801d9a:	89 e5                	mov    %esp,%ebp
+  801d9c:	56                   	push   %esi
+  801d9d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801d9e:	83 ec 08             	sub    $0x8,%esp
+  801da1:	6a 00                	push   $0x0
+  801da3:	ff 75 08             	push   0x8(%ebp)
+  801da6:	e8 bc 02 00 00       	call   802067 <open>
+  801dab:	89 c3                	mov    %eax,%ebx
+  801dad:	83 c4 10             	add    $0x10,%esp
+  801db0:	85 c0                	test   %eax,%eax
+  801db2:	78 1b                	js     801dcf <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801db4:	83 ec 08             	sub    $0x8,%esp
+  801db7:	ff 75 0c             	push   0xc(%ebp)
+  801dba:	50                   	push   %eax
+  801dbb:	e8 64 ff ff ff       	call   801d24 <fstat>
+  801dc0:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801dc2:	89 1c 24             	mov    %ebx,(%esp)
+  801dc5:	e8 26 fc ff ff       	call   8019f0 <close>
+	return r;
+  801dca:	83 c4 10             	add    $0x10,%esp
+  801dcd:	89 f3                	mov    %esi,%ebx
+}
+  801dcf:	89 d8                	mov    %ebx,%eax
+  801dd1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dd4:	5b                   	pop    %ebx
+  801dd5:	5e                   	pop    %esi
+  801dd6:	5d                   	pop    %ebp
+  801dd7:	c3                   	ret
+
+00801dd8 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801dd8:	55                   	push   %ebp
+  801dd9:	89 e5                	mov    %esp,%ebp
+  801ddb:	57                   	push   %edi
+  801ddc:	56                   	push   %esi
+  801ddd:	53                   	push   %ebx
+  801dde:	83 ec 0c             	sub    $0xc,%esp
+  801de1:	89 c7                	mov    %eax,%edi
+  801de3:	89 d3                	mov    %edx,%ebx
+  801de5:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801de7:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  801dee:	74 2d                	je     801e1d <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801df0:	6a 07                	push   $0x7
+  801df2:	68 00 f0 80 00       	push   $0x80f000
+  801df7:	57                   	push   %edi
+  801df8:	ff 35 00 70 80 00    	push   0x807000
+  801dfe:	e8 4e 31 00 00       	call   804f51 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801e03:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801e0a:	6a 00                	push   $0x0
+  801e0c:	56                   	push   %esi
+  801e0d:	53                   	push   %ebx
+  801e0e:	6a 00                	push   $0x0
+  801e10:	e8 ee 2f 00 00       	call   804e03 <ipc_recv_pages>
+}
+  801e15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e18:	5b                   	pop    %ebx
+  801e19:	5e                   	pop    %esi
+  801e1a:	5f                   	pop    %edi
+  801e1b:	5d                   	pop    %ebp
+  801e1c:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e1d:	83 ec 0c             	sub    $0xc,%esp
+  801e20:	6a 01                	push   $0x1
+  801e22:	e8 1f 32 00 00       	call   805046 <ipc_find_env>
+  801e27:	a3 00 70 80 00       	mov    %eax,0x807000
+  801e2c:	83 c4 10             	add    $0x10,%esp
+  801e2f:	eb bf                	jmp    801df0 <fsipc_pages+0x18>
+
+00801e31 <fsipc>:
+{
+  801e31:	55                   	push   %ebp
+  801e32:	89 e5                	mov    %esp,%ebp
+  801e34:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801e37:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e3c:	e8 97 ff ff ff       	call   801dd8 <fsipc_pages>
+}
+  801e41:	c9                   	leave
+  801e42:	c3                   	ret
+
+00801e43 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e43:	55                   	push   %ebp
+  801e44:	89 e5                	mov    %esp,%ebp
+  801e46:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e49:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e4c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e4f:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  801e54:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e57:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e61:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e66:	e8 c6 ff ff ff       	call   801e31 <fsipc>
+}
+  801e6b:	c9                   	leave
+  801e6c:	c3                   	ret
+
+00801e6d <devfile_flush>:
+{
+  801e6d:	55                   	push   %ebp
+  801e6e:	89 e5                	mov    %esp,%ebp
+  801e70:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e73:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e76:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e79:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e83:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e88:	e8 a4 ff ff ff       	call   801e31 <fsipc>
+}
+  801e8d:	c9                   	leave
+  801e8e:	c3                   	ret
+
+00801e8f <devfile_stat>:
+{
+  801e8f:	55                   	push   %ebp
+  801e90:	89 e5                	mov    %esp,%ebp
+  801e92:	53                   	push   %ebx
+  801e93:	83 ec 04             	sub    $0x4,%esp
+  801e96:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e99:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e9c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e9f:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801ea4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea9:	b8 05 00 00 00       	mov    $0x5,%eax
+  801eae:	e8 7e ff ff ff       	call   801e31 <fsipc>
+  801eb3:	85 c0                	test   %eax,%eax
+  801eb5:	78 2c                	js     801ee3 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801eb7:	83 ec 08             	sub    $0x8,%esp
+  801eba:	68 00 f0 80 00       	push   $0x80f000
+  801ebf:	53                   	push   %ebx
+  801ec0:	e8 4b e9 ff ff       	call   800810 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801ec5:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  801eca:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ed0:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  801ed5:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801edb:	83 c4 10             	add    $0x10,%esp
+  801ede:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ee3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee6:	c9                   	leave
+  801ee7:	c3                   	ret
+
+00801ee8 <devfile_write>:
+{
+  801ee8:	55                   	push   %ebp
+  801ee9:	89 e5                	mov    %esp,%ebp
+  801eeb:	83 ec 0c             	sub    $0xc,%esp
+  801eee:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801ef1:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801ef6:	39 d0                	cmp    %edx,%eax
+  801ef8:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801efb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801efe:	8b 52 0c             	mov    0xc(%edx),%edx
+  801f01:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  801f07:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801f0c:	50                   	push   %eax
+  801f0d:	ff 75 0c             	push   0xc(%ebp)
+  801f10:	68 08 f0 80 00       	push   $0x80f008
+  801f15:	e8 7c ea ff ff       	call   800996 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801f1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f1f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f24:	e8 08 ff ff ff       	call   801e31 <fsipc>
+}
+  801f29:	c9                   	leave
+  801f2a:	c3                   	ret
+
+00801f2b <devfile_read>:
+{
+  801f2b:	55                   	push   %ebp
+  801f2c:	89 e5                	mov    %esp,%ebp
+  801f2e:	57                   	push   %edi
+  801f2f:	56                   	push   %esi
+  801f30:	53                   	push   %ebx
+  801f31:	83 ec 1c             	sub    $0x1c,%esp
+  801f34:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f37:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801f3a:	89 fe                	mov    %edi,%esi
+  801f3c:	c1 ee 0c             	shr    $0xc,%esi
+  801f3f:	b8 20 00 00 00       	mov    $0x20,%eax
+  801f44:	39 c6                	cmp    %eax,%esi
+  801f46:	0f 47 f0             	cmova  %eax,%esi
+  801f49:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f51:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801f54:	eb 14                	jmp    801f6a <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801f56:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801f5d:	05 00 10 00 00       	add    $0x1000,%eax
+  801f62:	f6 c6 06             	test   $0x6,%dh
+  801f65:	75 42                	jne    801fa9 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801f67:	83 c1 01             	add    $0x1,%ecx
+  801f6a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801f6d:	39 f1                	cmp    %esi,%ecx
+  801f6f:	0f 84 95 00 00 00    	je     80200a <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801f75:	89 c2                	mov    %eax,%edx
+  801f77:	c1 ea 16             	shr    $0x16,%edx
+  801f7a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801f81:	f6 c2 01             	test   $0x1,%dl
+  801f84:	74 23                	je     801fa9 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801f86:	89 c2                	mov    %eax,%edx
+  801f88:	c1 ea 0c             	shr    $0xc,%edx
+  801f8b:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801f92:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801f98:	74 0f                	je     801fa9 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801f9a:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801fa1:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801fa7:	75 ad                	jne    801f56 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801fa9:	85 c9                	test   %ecx,%ecx
+  801fab:	74 11                	je     801fbe <devfile_read+0x93>
+  801fad:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801fb4:	75 08                	jne    801fbe <devfile_read+0x93>
+  801fb6:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801fbc:	74 50                	je     80200e <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fbe:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801fc1:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  801fc6:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801fcc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd1:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fd6:	e8 56 fe ff ff       	call   801e31 <fsipc>
+  801fdb:	89 c6                	mov    %eax,%esi
+  801fdd:	85 c0                	test   %eax,%eax
+  801fdf:	78 1f                	js     802000 <devfile_read+0xd5>
+	assert(r <= n);
+  801fe1:	39 c7                	cmp    %eax,%edi
+  801fe3:	72 50                	jb     802035 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801fe5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801fea:	7f 62                	jg     80204e <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801fec:	83 ec 04             	sub    $0x4,%esp
+  801fef:	50                   	push   %eax
+  801ff0:	68 00 f0 80 00       	push   $0x80f000
+  801ff5:	ff 75 0c             	push   0xc(%ebp)
+  801ff8:	e8 99 e9 ff ff       	call   800996 <memmove>
+	return r;
+  801ffd:	83 c4 10             	add    $0x10,%esp
+}
+  802000:	89 f0                	mov    %esi,%eax
+  802002:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802005:	5b                   	pop    %ebx
+  802006:	5e                   	pop    %esi
+  802007:	5f                   	pop    %edi
+  802008:	5d                   	pop    %ebp
+  802009:	c3                   	ret
+  80200a:	89 f1                	mov    %esi,%ecx
+  80200c:	eb 9b                	jmp    801fa9 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  80200e:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802011:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  802016:	89 c8                	mov    %ecx,%eax
+  802018:	c1 e0 0c             	shl    $0xc,%eax
+  80201b:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  802020:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802023:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802028:	e8 ab fd ff ff       	call   801dd8 <fsipc_pages>
+  80202d:	89 c6                	mov    %eax,%esi
+  80202f:	85 c0                	test   %eax,%eax
+  802031:	78 8b                	js     801fbe <devfile_read+0x93>
+  802033:	eb cb                	jmp    802000 <devfile_read+0xd5>
+	assert(r <= n);
+  802035:	68 34 58 80 00       	push   $0x805834
+  80203a:	68 3b 58 80 00       	push   $0x80583b
+  80203f:	68 a0 00 00 00       	push   $0xa0
+  802044:	68 50 58 80 00       	push   $0x805850
+  802049:	e8 00 e1 ff ff       	call   80014e <_panic>
+	assert(r <= PGSIZE);
+  80204e:	68 5b 58 80 00       	push   $0x80585b
+  802053:	68 3b 58 80 00       	push   $0x80583b
+  802058:	68 a1 00 00 00       	push   $0xa1
+  80205d:	68 50 58 80 00       	push   $0x805850
+  802062:	e8 e7 e0 ff ff       	call   80014e <_panic>
+
+00802067 <open>:
+{
+  802067:	55                   	push   %ebp
+  802068:	89 e5                	mov    %esp,%ebp
+  80206a:	56                   	push   %esi
+  80206b:	53                   	push   %ebx
+  80206c:	83 ec 1c             	sub    $0x1c,%esp
+  80206f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802072:	56                   	push   %esi
+  802073:	e8 5d e7 ff ff       	call   8007d5 <strlen>
+  802078:	83 c4 10             	add    $0x10,%esp
+  80207b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802080:	7f 6c                	jg     8020ee <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802082:	83 ec 0c             	sub    $0xc,%esp
+  802085:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802088:	50                   	push   %eax
+  802089:	e8 eb f7 ff ff       	call   801879 <fd_alloc>
+  80208e:	89 c3                	mov    %eax,%ebx
+  802090:	83 c4 10             	add    $0x10,%esp
+  802093:	85 c0                	test   %eax,%eax
+  802095:	78 3c                	js     8020d3 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802097:	83 ec 08             	sub    $0x8,%esp
+  80209a:	56                   	push   %esi
+  80209b:	68 00 f0 80 00       	push   $0x80f000
+  8020a0:	e8 6b e7 ff ff       	call   800810 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8020a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020a8:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8020ad:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020b5:	e8 77 fd ff ff       	call   801e31 <fsipc>
+  8020ba:	89 c3                	mov    %eax,%ebx
+  8020bc:	83 c4 10             	add    $0x10,%esp
+  8020bf:	85 c0                	test   %eax,%eax
+  8020c1:	78 19                	js     8020dc <open+0x75>
+	return fd2num(fd);
+  8020c3:	83 ec 0c             	sub    $0xc,%esp
+  8020c6:	ff 75 f4             	push   -0xc(%ebp)
+  8020c9:	e8 84 f7 ff ff       	call   801852 <fd2num>
+  8020ce:	89 c3                	mov    %eax,%ebx
+  8020d0:	83 c4 10             	add    $0x10,%esp
+}
+  8020d3:	89 d8                	mov    %ebx,%eax
+  8020d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020d8:	5b                   	pop    %ebx
+  8020d9:	5e                   	pop    %esi
+  8020da:	5d                   	pop    %ebp
+  8020db:	c3                   	ret
+		fd_close(fd, 0);
+  8020dc:	83 ec 08             	sub    $0x8,%esp
+  8020df:	6a 00                	push   $0x0
+  8020e1:	ff 75 f4             	push   -0xc(%ebp)
+  8020e4:	e8 80 f8 ff ff       	call   801969 <fd_close>
+		return r;
+  8020e9:	83 c4 10             	add    $0x10,%esp
+  8020ec:	eb e5                	jmp    8020d3 <open+0x6c>
+		return -E_BAD_PATH;
+  8020ee:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8020f3:	eb de                	jmp    8020d3 <open+0x6c>
+
+008020f5 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8020f5:	55                   	push   %ebp
+  8020f6:	89 e5                	mov    %esp,%ebp
+  8020f8:	53                   	push   %ebx
+  8020f9:	83 ec 10             	sub    $0x10,%esp
+  8020fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8020ff:	53                   	push   %ebx
+  802100:	e8 d0 e6 ff ff       	call   8007d5 <strlen>
+  802105:	83 c4 10             	add    $0x10,%esp
+  802108:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80210d:	7f 25                	jg     802134 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80210f:	83 ec 08             	sub    $0x8,%esp
+  802112:	53                   	push   %ebx
+  802113:	68 00 f0 80 00       	push   $0x80f000
+  802118:	e8 f3 e6 ff ff       	call   800810 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80211d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802122:	b8 07 00 00 00       	mov    $0x7,%eax
+  802127:	e8 05 fd ff ff       	call   801e31 <fsipc>
+  80212c:	83 c4 10             	add    $0x10,%esp
+}
+  80212f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802132:	c9                   	leave
+  802133:	c3                   	ret
+		return -E_BAD_PATH;
+  802134:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802139:	eb f4                	jmp    80212f <remove+0x3a>
+
+0080213b <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80213b:	55                   	push   %ebp
+  80213c:	89 e5                	mov    %esp,%ebp
+  80213e:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802141:	ba 00 00 00 00       	mov    $0x0,%edx
+  802146:	b8 08 00 00 00       	mov    $0x8,%eax
+  80214b:	e8 e1 fc ff ff       	call   801e31 <fsipc>
+}
+  802150:	c9                   	leave
+  802151:	c3                   	ret
+
+00802152 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  802152:	55                   	push   %ebp
+  802153:	89 e5                	mov    %esp,%ebp
+  802155:	53                   	push   %ebx
+  802156:	83 ec 04             	sub    $0x4,%esp
+  802159:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  80215c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802161:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802166:	e8 c6 fc ff ff       	call   801e31 <fsipc>
+  80216b:	85 c0                	test   %eax,%eax
+  80216d:	78 3c                	js     8021ab <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  80216f:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  802174:	89 03                	mov    %eax,(%ebx)
+  802176:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  80217b:	89 43 04             	mov    %eax,0x4(%ebx)
+  80217e:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  802183:	89 43 08             	mov    %eax,0x8(%ebx)
+  802186:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  80218b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80218e:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  802193:	89 43 10             	mov    %eax,0x10(%ebx)
+  802196:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  80219b:	89 43 14             	mov    %eax,0x14(%ebx)
+  80219e:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  8021a3:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  8021a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021ae:	c9                   	leave
+  8021af:	c3                   	ret
+
+008021b0 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  8021b0:	55                   	push   %ebp
+  8021b1:	89 e5                	mov    %esp,%ebp
+  8021b3:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  8021b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b9:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  8021be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8021c8:	e8 64 fc ff ff       	call   801e31 <fsipc>
+}
+  8021cd:	c9                   	leave
+  8021ce:	c3                   	ret
+
+008021cf <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8021cf:	55                   	push   %ebp
+  8021d0:	89 e5                	mov    %esp,%ebp
+  8021d2:	56                   	push   %esi
+  8021d3:	53                   	push   %ebx
+  8021d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8021d7:	83 ec 0c             	sub    $0xc,%esp
+  8021da:	ff 75 08             	push   0x8(%ebp)
+  8021dd:	e8 80 f6 ff ff       	call   801862 <fd2data>
+  8021e2:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8021e4:	83 c4 08             	add    $0x8,%esp
+  8021e7:	68 67 58 80 00       	push   $0x805867
+  8021ec:	53                   	push   %ebx
+  8021ed:	e8 1e e6 ff ff       	call   800810 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8021f2:	8b 46 04             	mov    0x4(%esi),%eax
+  8021f5:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8021fb:	2b 0e                	sub    (%esi),%ecx
+  8021fd:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802202:	89 c8                	mov    %ecx,%eax
+  802204:	f7 e2                	mul    %edx
+  802206:	c1 ea 0c             	shr    $0xc,%edx
+  802209:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80220f:	29 d1                	sub    %edx,%ecx
+  802211:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  802217:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80221e:	00 00 00 
+	stat->st_dev = &devpipe;
+  802221:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  802228:	60 80 00 
+	return 0;
+}
+  80222b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802230:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802233:	5b                   	pop    %ebx
+  802234:	5e                   	pop    %esi
+  802235:	5d                   	pop    %ebp
+  802236:	c3                   	ret
+
+00802237 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802237:	55                   	push   %ebp
+  802238:	89 e5                	mov    %esp,%ebp
+  80223a:	53                   	push   %ebx
+  80223b:	83 ec 0c             	sub    $0xc,%esp
+  80223e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802241:	53                   	push   %ebx
+  802242:	6a 00                	push   $0x0
+  802244:	e8 3f eb ff ff       	call   800d88 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802249:	89 1c 24             	mov    %ebx,(%esp)
+  80224c:	e8 11 f6 ff ff       	call   801862 <fd2data>
+  802251:	83 c4 08             	add    $0x8,%esp
+  802254:	50                   	push   %eax
+  802255:	6a 00                	push   $0x0
+  802257:	e8 2c eb ff ff       	call   800d88 <sys_page_unmap>
+}
+  80225c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80225f:	c9                   	leave
+  802260:	c3                   	ret
+
+00802261 <_pipeisclosed>:
+{
+  802261:	55                   	push   %ebp
+  802262:	89 e5                	mov    %esp,%ebp
+  802264:	57                   	push   %edi
+  802265:	56                   	push   %esi
+  802266:	53                   	push   %ebx
+  802267:	83 ec 1c             	sub    $0x1c,%esp
+  80226a:	89 c7                	mov    %eax,%edi
+  80226c:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80226e:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  802273:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802276:	83 ec 0c             	sub    $0xc,%esp
+  802279:	57                   	push   %edi
+  80227a:	e8 06 2e 00 00       	call   805085 <pageref>
+  80227f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802282:	89 34 24             	mov    %esi,(%esp)
+  802285:	e8 fb 2d 00 00       	call   805085 <pageref>
+		nn = thisenv->env_runs;
+  80228a:	8b 15 1c e9 80 00    	mov    0x80e91c,%edx
+  802290:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802293:	83 c4 10             	add    $0x10,%esp
+  802296:	39 cb                	cmp    %ecx,%ebx
+  802298:	74 1b                	je     8022b5 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80229a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80229d:	75 cf                	jne    80226e <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80229f:	8b 42 58             	mov    0x58(%edx),%eax
+  8022a2:	6a 01                	push   $0x1
+  8022a4:	50                   	push   %eax
+  8022a5:	53                   	push   %ebx
+  8022a6:	68 6e 58 80 00       	push   $0x80586e
+  8022ab:	e8 79 df ff ff       	call   800229 <cprintf>
+  8022b0:	83 c4 10             	add    $0x10,%esp
+  8022b3:	eb b9                	jmp    80226e <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8022b5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8022b8:	0f 94 c0             	sete   %al
+  8022bb:	0f b6 c0             	movzbl %al,%eax
+}
+  8022be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022c1:	5b                   	pop    %ebx
+  8022c2:	5e                   	pop    %esi
+  8022c3:	5f                   	pop    %edi
+  8022c4:	5d                   	pop    %ebp
+  8022c5:	c3                   	ret
+
+008022c6 <devpipe_read>:
+{
+  8022c6:	55                   	push   %ebp
+  8022c7:	89 e5                	mov    %esp,%ebp
+  8022c9:	57                   	push   %edi
+  8022ca:	56                   	push   %esi
+  8022cb:	53                   	push   %ebx
+  8022cc:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8022cf:	ff 75 08             	push   0x8(%ebp)
+  8022d2:	e8 8b f5 ff ff       	call   801862 <fd2data>
+  8022d7:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8022d9:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8022dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8022df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8022e2:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8022e5:	8b 0b                	mov    (%ebx),%ecx
+  8022e7:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8022ed:	29 ce                	sub    %ecx,%esi
+  8022ef:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8022f4:	f7 e6                	mul    %esi
+  8022f6:	c1 ea 0c             	shr    $0xc,%edx
+  8022f9:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8022ff:	29 c6                	sub    %eax,%esi
+  802301:	89 f2                	mov    %esi,%edx
+  802303:	75 43                	jne    802348 <devpipe_read+0x82>
+		ref = pageref(p);
+  802305:	83 ec 0c             	sub    $0xc,%esp
+  802308:	53                   	push   %ebx
+  802309:	e8 77 2d 00 00       	call   805085 <pageref>
+  80230e:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  802310:	89 da                	mov    %ebx,%edx
+  802312:	8b 45 08             	mov    0x8(%ebp),%eax
+  802315:	e8 47 ff ff ff       	call   802261 <_pipeisclosed>
+  80231a:	83 c4 10             	add    $0x10,%esp
+  80231d:	85 c0                	test   %eax,%eax
+  80231f:	0f 85 c1 00 00 00    	jne    8023e6 <devpipe_read+0x120>
+	*sleeping = 1;
+  802325:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  80232c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802331:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  802334:	75 ac                	jne    8022e2 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  802336:	83 ec 04             	sub    $0x4,%esp
+  802339:	56                   	push   %esi
+  80233a:	57                   	push   %edi
+  80233b:	ff 75 e4             	push   -0x1c(%ebp)
+  80233e:	e8 99 ee ff ff       	call   8011dc <sys_futex_wait>
+  802343:	83 c4 10             	add    $0x10,%esp
+  802346:	eb 9a                	jmp    8022e2 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  802348:	39 75 10             	cmp    %esi,0x10(%ebp)
+  80234b:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  80234f:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802351:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802356:	f7 e1                	mul    %ecx
+  802358:	c1 ea 0b             	shr    $0xb,%edx
+  80235b:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802361:	29 c1                	sub    %eax,%ecx
+  802363:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  802365:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80236a:	29 cf                	sub    %ecx,%edi
+  80236c:	39 f7                	cmp    %esi,%edi
+  80236e:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  802371:	8d 43 10             	lea    0x10(%ebx),%eax
+  802374:	83 ec 04             	sub    $0x4,%esp
+  802377:	57                   	push   %edi
+  802378:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80237b:	01 c2                	add    %eax,%edx
+  80237d:	52                   	push   %edx
+  80237e:	ff 75 0c             	push   0xc(%ebp)
+  802381:	e8 10 e6 ff ff       	call   800996 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  802386:	83 c4 0c             	add    $0xc,%esp
+  802389:	89 f1                	mov    %esi,%ecx
+  80238b:	29 f9                	sub    %edi,%ecx
+  80238d:	51                   	push   %ecx
+  80238e:	ff 75 e4             	push   -0x1c(%ebp)
+  802391:	89 f8                	mov    %edi,%eax
+  802393:	03 45 0c             	add    0xc(%ebp),%eax
+  802396:	50                   	push   %eax
+  802397:	e8 fa e5 ff ff       	call   800996 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  80239c:	89 f1                	mov    %esi,%ecx
+  80239e:	03 0b                	add    (%ebx),%ecx
+  8023a0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8023a5:	f7 e1                	mul    %ecx
+  8023a7:	c1 ea 0c             	shr    $0xc,%edx
+  8023aa:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8023b0:	29 d1                	sub    %edx,%ecx
+  8023b2:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  8023b4:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8023b9:	83 c4 10             	add    $0x10,%esp
+  8023bc:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  8023c0:	75 0a                	jne    8023cc <devpipe_read+0x106>
+	return n;
+  8023c2:	89 f0                	mov    %esi,%eax
+}
+  8023c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023c7:	5b                   	pop    %ebx
+  8023c8:	5e                   	pop    %esi
+  8023c9:	5f                   	pop    %edi
+  8023ca:	5d                   	pop    %ebp
+  8023cb:	c3                   	ret
+		*sleeping = 0;
+  8023cc:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8023d3:	83 ec 08             	sub    $0x8,%esp
+  8023d6:	68 00 04 00 00       	push   $0x400
+  8023db:	53                   	push   %ebx
+  8023dc:	e8 4b ee ff ff       	call   80122c <sys_futex_wake>
+  8023e1:	83 c4 10             	add    $0x10,%esp
+  8023e4:	eb dc                	jmp    8023c2 <devpipe_read+0xfc>
+			return 0;
+  8023e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023eb:	eb d7                	jmp    8023c4 <devpipe_read+0xfe>
+
+008023ed <devpipe_write>:
+{
+  8023ed:	55                   	push   %ebp
+  8023ee:	89 e5                	mov    %esp,%ebp
+  8023f0:	57                   	push   %edi
+  8023f1:	56                   	push   %esi
+  8023f2:	53                   	push   %ebx
+  8023f3:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8023f6:	ff 75 08             	push   0x8(%ebp)
+  8023f9:	e8 64 f4 ff ff       	call   801862 <fd2data>
+  8023fe:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  802400:	83 c4 10             	add    $0x10,%esp
+  802403:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80240a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80240d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802410:	0f 83 23 01 00 00    	jae    802539 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802416:	8b 77 04             	mov    0x4(%edi),%esi
+  802419:	8b 1f                	mov    (%edi),%ebx
+  80241b:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  802421:	29 d9                	sub    %ebx,%ecx
+  802423:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802428:	f7 e1                	mul    %ecx
+  80242a:	c1 ea 0c             	shr    $0xc,%edx
+  80242d:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802433:	29 c1                	sub    %eax,%ecx
+  802435:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802437:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80243d:	75 40                	jne    80247f <devpipe_write+0x92>
+			ref = pageref(p);
+  80243f:	83 ec 0c             	sub    $0xc,%esp
+  802442:	57                   	push   %edi
+  802443:	e8 3d 2c 00 00       	call   805085 <pageref>
+  802448:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  80244a:	89 fa                	mov    %edi,%edx
+  80244c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80244f:	e8 0d fe ff ff       	call   802261 <_pipeisclosed>
+  802454:	83 c4 10             	add    $0x10,%esp
+  802457:	85 c0                	test   %eax,%eax
+  802459:	0f 85 d5 00 00 00    	jne    802534 <devpipe_write+0x147>
+	*sleeping = 1;
+  80245f:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  802466:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80246b:	39 1f                	cmp    %ebx,(%edi)
+  80246d:	75 a7                	jne    802416 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  80246f:	83 ec 04             	sub    $0x4,%esp
+  802472:	56                   	push   %esi
+  802473:	53                   	push   %ebx
+  802474:	57                   	push   %edi
+  802475:	e8 62 ed ff ff       	call   8011dc <sys_futex_wait>
+  80247a:	83 c4 10             	add    $0x10,%esp
+  80247d:	eb 97                	jmp    802416 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80247f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802482:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802485:	29 c1                	sub    %eax,%ecx
+  802487:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80248c:	89 d8                	mov    %ebx,%eax
+  80248e:	29 d0                	sub    %edx,%eax
+  802490:	39 c1                	cmp    %eax,%ecx
+  802492:	0f 46 c1             	cmovbe %ecx,%eax
+  802495:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  802497:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80249c:	f7 e6                	mul    %esi
+  80249e:	c1 ea 0b             	shr    $0xb,%edx
+  8024a1:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8024a7:	29 c6                	sub    %eax,%esi
+  8024a9:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8024ab:	29 f3                	sub    %esi,%ebx
+  8024ad:	39 cb                	cmp    %ecx,%ebx
+  8024af:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8024b2:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  8024b5:	8d 77 10             	lea    0x10(%edi),%esi
+  8024b8:	83 ec 04             	sub    $0x4,%esp
+  8024bb:	53                   	push   %ebx
+  8024bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024bf:	03 45 0c             	add    0xc(%ebp),%eax
+  8024c2:	50                   	push   %eax
+  8024c3:	01 f2                	add    %esi,%edx
+  8024c5:	52                   	push   %edx
+  8024c6:	e8 cb e4 ff ff       	call   800996 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8024cb:	83 c4 0c             	add    $0xc,%esp
+  8024ce:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8024d1:	29 d8                	sub    %ebx,%eax
+  8024d3:	50                   	push   %eax
+  8024d4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024d7:	01 d3                	add    %edx,%ebx
+  8024d9:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8024dc:	53                   	push   %ebx
+  8024dd:	56                   	push   %esi
+  8024de:	e8 b3 e4 ff ff       	call   800996 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8024e3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8024e6:	03 4f 04             	add    0x4(%edi),%ecx
+  8024e9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8024ee:	f7 e1                	mul    %ecx
+  8024f0:	c1 ea 0c             	shr    $0xc,%edx
+  8024f3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8024f9:	29 d1                	sub    %edx,%ecx
+  8024fb:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8024fe:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802503:	83 c4 10             	add    $0x10,%esp
+  802506:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  80250a:	75 0b                	jne    802517 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  80250c:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  80250f:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802512:	e9 f3 fe ff ff       	jmp    80240a <devpipe_write+0x1d>
+		*sleeping = 0;
+  802517:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  80251e:	83 ec 08             	sub    $0x8,%esp
+  802521:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802526:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802529:	50                   	push   %eax
+  80252a:	e8 fd ec ff ff       	call   80122c <sys_futex_wake>
+  80252f:	83 c4 10             	add    $0x10,%esp
+  802532:	eb d8                	jmp    80250c <devpipe_write+0x11f>
+				return 0;
+  802534:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802539:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80253c:	5b                   	pop    %ebx
+  80253d:	5e                   	pop    %esi
+  80253e:	5f                   	pop    %edi
+  80253f:	5d                   	pop    %ebp
+  802540:	c3                   	ret
+
+00802541 <pipe>:
+{
+  802541:	55                   	push   %ebp
+  802542:	89 e5                	mov    %esp,%ebp
+  802544:	56                   	push   %esi
+  802545:	53                   	push   %ebx
+  802546:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802549:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80254c:	50                   	push   %eax
+  80254d:	e8 27 f3 ff ff       	call   801879 <fd_alloc>
+  802552:	89 c3                	mov    %eax,%ebx
+  802554:	83 c4 10             	add    $0x10,%esp
+  802557:	85 c0                	test   %eax,%eax
+  802559:	0f 88 23 01 00 00    	js     802682 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80255f:	83 ec 04             	sub    $0x4,%esp
+  802562:	68 07 04 00 00       	push   $0x407
+  802567:	ff 75 f4             	push   -0xc(%ebp)
+  80256a:	6a 00                	push   $0x0
+  80256c:	e8 92 e7 ff ff       	call   800d03 <sys_page_alloc>
+  802571:	89 c3                	mov    %eax,%ebx
+  802573:	83 c4 10             	add    $0x10,%esp
+  802576:	85 c0                	test   %eax,%eax
+  802578:	0f 88 04 01 00 00    	js     802682 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80257e:	83 ec 0c             	sub    $0xc,%esp
+  802581:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802584:	50                   	push   %eax
+  802585:	e8 ef f2 ff ff       	call   801879 <fd_alloc>
+  80258a:	89 c3                	mov    %eax,%ebx
+  80258c:	83 c4 10             	add    $0x10,%esp
+  80258f:	85 c0                	test   %eax,%eax
+  802591:	0f 88 db 00 00 00    	js     802672 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802597:	83 ec 04             	sub    $0x4,%esp
+  80259a:	68 07 04 00 00       	push   $0x407
+  80259f:	ff 75 f0             	push   -0x10(%ebp)
+  8025a2:	6a 00                	push   $0x0
+  8025a4:	e8 5a e7 ff ff       	call   800d03 <sys_page_alloc>
+  8025a9:	89 c3                	mov    %eax,%ebx
+  8025ab:	83 c4 10             	add    $0x10,%esp
+  8025ae:	85 c0                	test   %eax,%eax
+  8025b0:	0f 88 bc 00 00 00    	js     802672 <pipe+0x131>
+	va = fd2data(fd0);
+  8025b6:	83 ec 0c             	sub    $0xc,%esp
+  8025b9:	ff 75 f4             	push   -0xc(%ebp)
+  8025bc:	e8 a1 f2 ff ff       	call   801862 <fd2data>
+  8025c1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025c3:	83 c4 0c             	add    $0xc,%esp
+  8025c6:	68 07 04 00 00       	push   $0x407
+  8025cb:	50                   	push   %eax
+  8025cc:	6a 00                	push   $0x0
+  8025ce:	e8 30 e7 ff ff       	call   800d03 <sys_page_alloc>
+  8025d3:	89 c3                	mov    %eax,%ebx
+  8025d5:	83 c4 10             	add    $0x10,%esp
+  8025d8:	85 c0                	test   %eax,%eax
+  8025da:	0f 88 82 00 00 00    	js     802662 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025e0:	83 ec 0c             	sub    $0xc,%esp
+  8025e3:	ff 75 f0             	push   -0x10(%ebp)
+  8025e6:	e8 77 f2 ff ff       	call   801862 <fd2data>
+  8025eb:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8025f2:	50                   	push   %eax
+  8025f3:	6a 00                	push   $0x0
+  8025f5:	56                   	push   %esi
+  8025f6:	6a 00                	push   $0x0
+  8025f8:	e8 49 e7 ff ff       	call   800d46 <sys_page_map>
+  8025fd:	89 c3                	mov    %eax,%ebx
+  8025ff:	83 c4 20             	add    $0x20,%esp
+  802602:	85 c0                	test   %eax,%eax
+  802604:	78 4e                	js     802654 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802606:	a1 20 60 80 00       	mov    0x806020,%eax
+  80260b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80260e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802610:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802613:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80261a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80261d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80261f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802622:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802629:	83 ec 0c             	sub    $0xc,%esp
+  80262c:	ff 75 f4             	push   -0xc(%ebp)
+  80262f:	e8 1e f2 ff ff       	call   801852 <fd2num>
+  802634:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802637:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802639:	83 c4 04             	add    $0x4,%esp
+  80263c:	ff 75 f0             	push   -0x10(%ebp)
+  80263f:	e8 0e f2 ff ff       	call   801852 <fd2num>
+  802644:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802647:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80264a:	83 c4 10             	add    $0x10,%esp
+  80264d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802652:	eb 2e                	jmp    802682 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802654:	83 ec 08             	sub    $0x8,%esp
+  802657:	56                   	push   %esi
+  802658:	6a 00                	push   $0x0
+  80265a:	e8 29 e7 ff ff       	call   800d88 <sys_page_unmap>
+  80265f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802662:	83 ec 08             	sub    $0x8,%esp
+  802665:	ff 75 f0             	push   -0x10(%ebp)
+  802668:	6a 00                	push   $0x0
+  80266a:	e8 19 e7 ff ff       	call   800d88 <sys_page_unmap>
+  80266f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802672:	83 ec 08             	sub    $0x8,%esp
+  802675:	ff 75 f4             	push   -0xc(%ebp)
+  802678:	6a 00                	push   $0x0
+  80267a:	e8 09 e7 ff ff       	call   800d88 <sys_page_unmap>
+  80267f:	83 c4 10             	add    $0x10,%esp
+}
+  802682:	89 d8                	mov    %ebx,%eax
+  802684:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802687:	5b                   	pop    %ebx
+  802688:	5e                   	pop    %esi
+  802689:	5d                   	pop    %ebp
+  80268a:	c3                   	ret
+
+0080268b <pipeisclosed>:
+{
+  80268b:	55                   	push   %ebp
+  80268c:	89 e5                	mov    %esp,%ebp
+  80268e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802691:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802694:	50                   	push   %eax
+  802695:	ff 75 08             	push   0x8(%ebp)
+  802698:	e8 30 f2 ff ff       	call   8018cd <fd_lookup>
+  80269d:	83 c4 10             	add    $0x10,%esp
+  8026a0:	85 c0                	test   %eax,%eax
+  8026a2:	78 18                	js     8026bc <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8026a4:	83 ec 0c             	sub    $0xc,%esp
+  8026a7:	ff 75 f4             	push   -0xc(%ebp)
+  8026aa:	e8 b3 f1 ff ff       	call   801862 <fd2data>
+  8026af:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8026b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026b4:	e8 a8 fb ff ff       	call   802261 <_pipeisclosed>
+  8026b9:	83 c4 10             	add    $0x10,%esp
+}
+  8026bc:	c9                   	leave
+  8026bd:	c3                   	ret
+
+008026be <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  8026be:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8026c0:	8b 15 1c e9 80 00    	mov    0x80e91c,%edx
+  8026c6:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  8026cc:	81 c2 34 01 00 00    	add    $0x134,%edx
+  8026d2:	39 d0                	cmp    %edx,%eax
+  8026d4:	74 2e                	je     802704 <segment_lookup+0x46>
+{
+  8026d6:	55                   	push   %ebp
+  8026d7:	89 e5                	mov    %esp,%ebp
+  8026d9:	57                   	push   %edi
+  8026da:	56                   	push   %esi
+  8026db:	53                   	push   %ebx
+  8026dc:	eb 07                	jmp    8026e5 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8026de:	83 c0 20             	add    $0x20,%eax
+  8026e1:	39 d0                	cmp    %edx,%eax
+  8026e3:	74 15                	je     8026fa <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  8026e5:	8b 18                	mov    (%eax),%ebx
+  8026e7:	39 d9                	cmp    %ebx,%ecx
+  8026e9:	72 f3                	jb     8026de <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  8026eb:	8b 38                	mov    (%eax),%edi
+  8026ed:	8b 58 04             	mov    0x4(%eax),%ebx
+  8026f0:	89 ce                	mov    %ecx,%esi
+  8026f2:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  8026f4:	39 de                	cmp    %ebx,%esi
+  8026f6:	73 e6                	jae    8026de <segment_lookup+0x20>
+  8026f8:	eb 05                	jmp    8026ff <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  8026fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026ff:	5b                   	pop    %ebx
+  802700:	5e                   	pop    %esi
+  802701:	5f                   	pop    %edi
+  802702:	5d                   	pop    %ebp
+  802703:	c3                   	ret
+	return NULL;
+  802704:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802709:	c3                   	ret
+
+0080270a <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  80270a:	55                   	push   %ebp
+  80270b:	89 e5                	mov    %esp,%ebp
+  80270d:	53                   	push   %ebx
+  80270e:	83 ec 04             	sub    $0x4,%esp
+  802711:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802713:	c1 e8 16             	shr    $0x16,%eax
+  802716:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80271d:	25 81 00 00 00       	and    $0x81,%eax
+  802722:	83 f8 01             	cmp    $0x1,%eax
+  802725:	75 6b                	jne    802792 <page_is_clean+0x88>
+  802727:	89 da                	mov    %ebx,%edx
+  802729:	c1 ea 0c             	shr    $0xc,%edx
+  80272c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  802733:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802738:	f6 c1 01             	test   $0x1,%cl
+  80273b:	74 5a                	je     802797 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  80273d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802744:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  80274a:	75 4b                	jne    802797 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  80274c:	89 d8                	mov    %ebx,%eax
+  80274e:	e8 6b ff ff ff       	call   8026be <segment_lookup>
+  802753:	89 c2                	mov    %eax,%edx
+		return 1;
+  802755:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  80275a:	85 d2                	test   %edx,%edx
+  80275c:	75 39                	jne    802797 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  80275e:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  802764:	b8 00 00 00 00       	mov    $0x0,%eax
+  802769:	eb 03                	jmp    80276e <page_is_clean+0x64>
+  80276b:	83 c0 01             	add    $0x1,%eax
+  80276e:	39 c2                	cmp    %eax,%edx
+  802770:	7e 19                	jle    80278b <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  802772:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  802779:	72 f0                	jb     80276b <page_is_clean+0x61>
+  80277b:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  802782:	73 e7                	jae    80276b <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  802784:	b8 01 00 00 00       	mov    $0x1,%eax
+  802789:	eb 0c                	jmp    802797 <page_is_clean+0x8d>
+	return 0;
+  80278b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802790:	eb 05                	jmp    802797 <page_is_clean+0x8d>
+		return 0;
+  802792:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802797:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80279a:	c9                   	leave
+  80279b:	c3                   	ret
+
+0080279c <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  80279c:	55                   	push   %ebp
+  80279d:	89 e5                	mov    %esp,%ebp
+  80279f:	57                   	push   %edi
+  8027a0:	56                   	push   %esi
+  8027a1:	53                   	push   %ebx
+  8027a2:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8027a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8027aa:	eb 19                	jmp    8027c5 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8027ac:	f7 d3                	not    %ebx
+  8027ae:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8027b4:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8027b6:	83 c6 01             	add    $0x1,%esi
+  8027b9:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8027bf:	0f 87 97 00 00 00    	ja     80285c <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8027c5:	89 f3                	mov    %esi,%ebx
+  8027c7:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  8027cd:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8027d3:	89 d8                	mov    %ebx,%eax
+  8027d5:	c1 e8 0a             	shr    $0xa,%eax
+  8027d8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8027df:	25 81 00 00 00       	and    $0x81,%eax
+  8027e4:	83 f8 01             	cmp    $0x1,%eax
+  8027e7:	75 c3                	jne    8027ac <linear_walk+0x10>
+  8027e9:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8027ef:	77 bb                	ja     8027ac <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8027f1:	89 df                	mov    %ebx,%edi
+  8027f3:	c1 e7 0c             	shl    $0xc,%edi
+  8027f6:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8027f9:	89 f8                	mov    %edi,%eax
+  8027fb:	e8 0a ff ff ff       	call   80270a <page_is_clean>
+  802800:	84 c0                	test   %al,%al
+  802802:	75 64                	jne    802868 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802804:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  80280a:	77 aa                	ja     8027b6 <linear_walk+0x1a>
+  80280c:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  802812:	72 a2                	jb     8027b6 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802814:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80281b:	a8 01                	test   $0x1,%al
+  80281d:	74 97                	je     8027b6 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80281f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802826:	f6 c4 04             	test   $0x4,%ah
+  802829:	75 8b                	jne    8027b6 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80282b:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802832:	f6 c4 02             	test   $0x2,%ah
+  802835:	0f 85 7b ff ff ff    	jne    8027b6 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80283b:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802842:	c1 e8 0c             	shr    $0xc,%eax
+  802845:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802848:	05 00 00 00 ef       	add    $0xef000000,%eax
+  80284d:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802851:	66 83 f8 01          	cmp    $0x1,%ax
+  802855:	76 11                	jbe    802868 <linear_walk+0xcc>
+  802857:	e9 5a ff ff ff       	jmp    8027b6 <linear_walk+0x1a>
+  80285c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  802861:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802868:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  80286e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802871:	83 c4 1c             	add    $0x1c,%esp
+  802874:	5b                   	pop    %ebx
+  802875:	5e                   	pop    %esi
+  802876:	5f                   	pop    %edi
+  802877:	5d                   	pop    %ebp
+  802878:	c3                   	ret
+
+00802879 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802879:	55                   	push   %ebp
+  80287a:	89 e5                	mov    %esp,%ebp
+  80287c:	56                   	push   %esi
+  80287d:	53                   	push   %ebx
+  80287e:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  802880:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802885:	83 e0 7f             	and    $0x7f,%eax
+  802888:	c1 e0 04             	shl    $0x4,%eax
+  80288b:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  802891:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802897:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  80289d:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  8028a3:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8028a8:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  8028ab:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8028b0:	83 c0 01             	add    $0x1,%eax
+  8028b3:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  8028b8:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  8028bb:	5b                   	pop    %ebx
+  8028bc:	5e                   	pop    %esi
+  8028bd:	5d                   	pop    %ebp
+  8028be:	c3                   	ret
+
+008028bf <page_ring_enter>:
+{
+  8028bf:	55                   	push   %ebp
+  8028c0:	89 e5                	mov    %esp,%ebp
+  8028c2:	57                   	push   %edi
+  8028c3:	56                   	push   %esi
+  8028c4:	53                   	push   %ebx
+  8028c5:	83 ec 18             	sub    $0x18,%esp
+  8028c8:	89 c6                	mov    %eax,%esi
+  8028ca:	89 d7                	mov    %edx,%edi
+  8028cc:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  8028ce:	6a 00                	push   $0x0
+  8028d0:	6a 00                	push   $0x0
+  8028d2:	6a 00                	push   $0x0
+  8028d4:	6a 07                	push   $0x7
+  8028d6:	ff 35 40 b0 80 00    	push   0x80b040
+  8028dc:	e8 8e 26 00 00       	call   804f6f <ipc_call>
+  8028e1:	83 c4 20             	add    $0x20,%esp
+  8028e4:	85 c0                	test   %eax,%eax
+  8028e6:	79 22                	jns    80290a <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  8028e8:	50                   	push   %eax
+  8028e9:	68 86 58 80 00       	push   $0x805886
+  8028ee:	68 13 02 00 00       	push   $0x213
+  8028f3:	68 9a 58 80 00       	push   $0x80589a
+  8028f8:	e8 51 d8 ff ff       	call   80014e <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  8028fd:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802902:	83 c0 01             	add    $0x1,%eax
+  802905:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  80290a:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802910:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802915:	39 c2                	cmp    %eax,%edx
+  802917:	74 24                	je     80293d <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802919:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  80291e:	83 e0 7f             	and    $0x7f,%eax
+  802921:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802928:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  80292f:	29 f0                	sub    %esi,%eax
+  802931:	39 d8                	cmp    %ebx,%eax
+  802933:	73 c8                	jae    8028fd <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802935:	8b 52 04             	mov    0x4(%edx),%edx
+  802938:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  80293b:	eb c0                	jmp    8028fd <page_ring_enter+0x3e>
+}
+  80293d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802940:	5b                   	pop    %ebx
+  802941:	5e                   	pop    %esi
+  802942:	5f                   	pop    %edi
+  802943:	5d                   	pop    %ebp
+  802944:	c3                   	ret
+
+00802945 <page_ring_reserve>:
+{
+  802945:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802947:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80294c:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802952:	29 d0                	sub    %edx,%eax
+  802954:	ba 80 00 00 00       	mov    $0x80,%edx
+  802959:	29 ca                	sub    %ecx,%edx
+  80295b:	39 c2                	cmp    %eax,%edx
+  80295d:	72 01                	jb     802960 <page_ring_reserve+0x1b>
+  80295f:	c3                   	ret
+{
+  802960:	55                   	push   %ebp
+  802961:	89 e5                	mov    %esp,%ebp
+  802963:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802966:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80296b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802970:	b8 00 00 00 00       	mov    $0x0,%eax
+  802975:	e8 45 ff ff ff       	call   8028bf <page_ring_enter>
+}
+  80297a:	c9                   	leave
+  80297b:	c3                   	ret
+
+0080297c <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  80297c:	55                   	push   %ebp
+  80297d:	89 e5                	mov    %esp,%ebp
+  80297f:	53                   	push   %ebx
+  802980:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802983:	6a 07                	push   $0x7
+  802985:	6a 01                	push   $0x1
+  802987:	89 c3                	mov    %eax,%ebx
+  802989:	c1 e3 0c             	shl    $0xc,%ebx
+  80298c:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  802992:	52                   	push   %edx
+  802993:	6a 04                	push   $0x4
+  802995:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  80299c:	e8 ce 25 00 00       	call   804f6f <ipc_call>
+	sharereqs[i].nslots = 0;
+  8029a1:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  8029a8:	00 00 00 
+	return r;
+}
+  8029ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029ae:	c9                   	leave
+  8029af:	c3                   	ret
+
+008029b0 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  8029b0:	55                   	push   %ebp
+  8029b1:	89 e5                	mov    %esp,%ebp
+  8029b3:	56                   	push   %esi
+  8029b4:	53                   	push   %ebx
+  8029b5:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  8029b7:	c1 e8 10             	shr    $0x10,%eax
+  8029ba:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  8029bd:	89 c2                	mov    %eax,%edx
+  8029bf:	c1 e2 0c             	shl    $0xc,%edx
+  8029c2:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  8029c8:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8029cb:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  8029d1:	89 c2                	mov    %eax,%edx
+  8029d3:	c1 e2 0a             	shl    $0xa,%edx
+  8029d6:	01 f2                	add    %esi,%edx
+  8029d8:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  8029df:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  8029e5:	74 09                	je     8029f0 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  8029e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029ec:	5b                   	pop    %ebx
+  8029ed:	5e                   	pop    %esi
+  8029ee:	5d                   	pop    %ebp
+  8029ef:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  8029f0:	e8 87 ff ff ff       	call   80297c <page_share_send>
+  8029f5:	eb f5                	jmp    8029ec <page_share_slot+0x3c>
+
+008029f7 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  8029f7:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  8029fc:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  8029ff:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802a04:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  802a0a:	74 09                	je     802a15 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802a0c:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802a11:	85 c0                	test   %eax,%eax
+  802a13:	75 01                	jne    802a16 <page_ring_ready+0x1f>
+}
+  802a15:	c3                   	ret
+{
+  802a16:	55                   	push   %ebp
+  802a17:	89 e5                	mov    %esp,%ebp
+  802a19:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802a1c:	68 07 06 00 00       	push   $0x607
+  802a21:	6a 08                	push   $0x8
+  802a23:	68 00 30 ad de       	push   $0xdead3000
+  802a28:	6a 00                	push   $0x0
+  802a2a:	e8 ff e3 ff ff       	call   800e2e <sys_page_alloc_range>
+  802a2f:	83 c4 10             	add    $0x10,%esp
+  802a32:	83 f8 08             	cmp    $0x8,%eax
+  802a35:	74 1b                	je     802a52 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802a37:	83 ec 04             	sub    $0x4,%esp
+  802a3a:	6a 08                	push   $0x8
+  802a3c:	68 00 30 ad de       	push   $0xdead3000
+  802a41:	6a 00                	push   $0x0
+  802a43:	e8 54 e4 ff ff       	call   800e9c <sys_page_unmap_range>
+		return 0;
+  802a48:	83 c4 10             	add    $0x10,%esp
+  802a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a50:	c9                   	leave
+  802a51:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802a52:	83 ec 0c             	sub    $0xc,%esp
+  802a55:	68 07 04 00 00       	push   $0x407
+  802a5a:	6a 08                	push   $0x8
+  802a5c:	68 00 30 ad de       	push   $0xdead3000
+  802a61:	6a 06                	push   $0x6
+  802a63:	ff 35 40 b0 80 00    	push   0x80b040
+  802a69:	e8 01 25 00 00       	call   804f6f <ipc_call>
+  802a6e:	83 c4 20             	add    $0x20,%esp
+  802a71:	85 c0                	test   %eax,%eax
+  802a73:	78 14                	js     802a89 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802a75:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  802a7a:	8b 40 48             	mov    0x48(%eax),%eax
+  802a7d:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  802a82:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a87:	eb c7                	jmp    802a50 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802a89:	83 ec 04             	sub    $0x4,%esp
+  802a8c:	6a 08                	push   $0x8
+  802a8e:	68 00 30 ad de       	push   $0xdead3000
+  802a93:	6a 00                	push   $0x0
+  802a95:	e8 02 e4 ff ff       	call   800e9c <sys_page_unmap_range>
+		return 0;
+  802a9a:	83 c4 10             	add    $0x10,%esp
+  802a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa2:	eb ac                	jmp    802a50 <page_ring_ready+0x59>
+
+00802aa4 <page_remove_slot>:
+{
+  802aa4:	55                   	push   %ebp
+  802aa5:	89 e5                	mov    %esp,%ebp
+  802aa7:	56                   	push   %esi
+  802aa8:	53                   	push   %ebx
+  802aa9:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802aab:	89 c6                	mov    %eax,%esi
+  802aad:	c1 ee 10             	shr    $0x10,%esi
+  802ab0:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802ab3:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  802aba:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  802ac0:	74 2a                	je     802aec <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802ac2:	83 ec 0c             	sub    $0xc,%esp
+  802ac5:	6a 00                	push   $0x0
+  802ac7:	6a 00                	push   $0x0
+  802ac9:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802acb:	c1 e3 04             	shl    $0x4,%ebx
+  802ace:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802ad1:	53                   	push   %ebx
+  802ad2:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  802ad9:	e8 91 24 00 00       	call   804f6f <ipc_call>
+  802ade:	83 c4 20             	add    $0x20,%esp
+  802ae1:	85 c0                	test   %eax,%eax
+  802ae3:	78 2d                	js     802b12 <page_remove_slot+0x6e>
+}
+  802ae5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ae8:	5b                   	pop    %ebx
+  802ae9:	5e                   	pop    %esi
+  802aea:	5d                   	pop    %ebp
+  802aeb:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802aec:	e8 06 ff ff ff       	call   8029f7 <page_ring_ready>
+  802af1:	85 c0                	test   %eax,%eax
+  802af3:	74 cd                	je     802ac2 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802af5:	b8 01 00 00 00       	mov    $0x1,%eax
+  802afa:	e8 46 fe ff ff       	call   802945 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802aff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b04:	89 da                	mov    %ebx,%edx
+  802b06:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b0b:	e8 69 fd ff ff       	call   802879 <page_ring_post>
+		return;
+  802b10:	eb d3                	jmp    802ae5 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802b12:	50                   	push   %eax
+  802b13:	68 f4 58 80 00       	push   $0x8058f4
+  802b18:	68 ac 03 00 00       	push   $0x3ac
+  802b1d:	68 9a 58 80 00       	push   $0x80589a
+  802b22:	e8 27 d6 ff ff       	call   80014e <_panic>
+
+00802b27 <find_paging_env>:
+	if(pagingenv)
+  802b27:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802b2c:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802b2e:	85 c0                	test   %eax,%eax
+  802b30:	74 05                	je     802b37 <find_paging_env+0x10>
+  802b32:	eb 56                	jmp    802b8a <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802b34:	83 c0 01             	add    $0x1,%eax
+  802b37:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802b3c:	7f 47                	jg     802b85 <find_paging_env+0x5e>
+  802b3e:	83 f9 01             	cmp    $0x1,%ecx
+  802b41:	7f 42                	jg     802b85 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802b43:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802b46:	c1 e2 06             	shl    $0x6,%edx
+  802b49:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802b4f:	8b 52 50             	mov    0x50(%edx),%edx
+  802b52:	83 fa 02             	cmp    $0x2,%edx
+  802b55:	75 dd                	jne    802b34 <find_paging_env+0xd>
+  802b57:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802b5a:	c1 e2 06             	shl    $0x6,%edx
+  802b5d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802b63:	8b 52 54             	mov    0x54(%edx),%edx
+  802b66:	85 d2                	test   %edx,%edx
+  802b68:	74 ca                	je     802b34 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802b6a:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802b6d:	c1 e2 06             	shl    $0x6,%edx
+  802b70:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802b76:	8b 52 48             	mov    0x48(%edx),%edx
+  802b79:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  802b80:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802b83:	eb af                	jmp    802b34 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802b85:	83 f9 02             	cmp    $0x2,%ecx
+  802b88:	74 01                	je     802b8b <find_paging_env+0x64>
+}
+  802b8a:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802b8b:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  802b90:	8b 40 48             	mov    0x48(%eax),%eax
+  802b93:	83 e0 01             	and    $0x1,%eax
+  802b96:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  802b9d:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  802ba2:	eb e6                	jmp    802b8a <find_paging_env+0x63>
+
+00802ba4 <page_add_backed>:
+{
+  802ba4:	55                   	push   %ebp
+  802ba5:	89 e5                	mov    %esp,%ebp
+  802ba7:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802baa:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  802baf:	83 f8 04             	cmp    $0x4,%eax
+  802bb2:	74 35                	je     802be9 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802bb4:	89 d1                	mov    %edx,%ecx
+  802bb6:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802bbc:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802bc3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bc6:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802bcd:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802bd3:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  802bda:	83 c0 01             	add    $0x1,%eax
+  802bdd:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  802be2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802be7:	5d                   	pop    %ebp
+  802be8:	c3                   	ret
+		return -E_NO_MEM;
+  802be9:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802bee:	eb f7                	jmp    802be7 <page_add_backed+0x43>
+
+00802bf0 <percentage_of_pgdir_to_walk>:
+{
+  802bf0:	55                   	push   %ebp
+  802bf1:	89 e5                	mov    %esp,%ebp
+  802bf3:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802bf6:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802bfa:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802bfd:	db 45 fc             	fildl  -0x4(%ebp)
+  802c00:	d8 35 80 5d 80 00    	fdivs  0x805d80
+	return ret*ret;
+  802c06:	d8 c8                	fmul   %st(0),%st
+}
+  802c08:	c9                   	leave
+  802c09:	c3                   	ret
+
+00802c0a <nfu_with_aging_page_choice_func>:
+{
+  802c0a:	55                   	push   %ebp
+  802c0b:	89 e5                	mov    %esp,%ebp
+  802c0d:	57                   	push   %edi
+  802c0e:	56                   	push   %esi
+  802c0f:	53                   	push   %ebx
+  802c10:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c13:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  802c19:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802c1b:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802c20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c25:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c31:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802c34:	eb 18                	jmp    802c4e <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802c36:	f7 d0                	not    %eax
+  802c38:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802c3d:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c3f:	83 c2 01             	add    $0x1,%edx
+  802c42:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802c48:	0f 87 13 01 00 00    	ja     802d61 <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802c4e:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c52:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802c55:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802c5a:	89 c1                	mov    %eax,%ecx
+  802c5c:	c1 e9 0a             	shr    $0xa,%ecx
+  802c5f:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802c66:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802c6c:	83 f9 01             	cmp    $0x1,%ecx
+  802c6f:	75 c5                	jne    802c36 <nfu_with_aging_page_choice_func+0x2c>
+  802c71:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802c76:	77 be                	ja     802c36 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802c78:	89 c1                	mov    %eax,%ecx
+  802c7a:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802c7d:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802c83:	0f 82 a5 00 00 00    	jb     802d2e <nfu_with_aging_page_choice_func+0x124>
+  802c89:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802c8f:	0f 87 99 00 00 00    	ja     802d2e <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802c95:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802c9c:	f6 c1 01             	test   $0x1,%cl
+  802c9f:	0f 84 89 00 00 00    	je     802d2e <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802ca5:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802cac:	f6 c5 04             	test   $0x4,%ch
+  802caf:	75 7d                	jne    802d2e <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802cb1:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802cb8:	f6 c5 02             	test   $0x2,%ch
+  802cbb:	75 71                	jne    802d2e <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802cbd:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802cc4:	c1 e9 0c             	shr    $0xc,%ecx
+  802cc7:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802cca:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802cd0:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802cd4:	66 83 f9 01          	cmp    $0x1,%cx
+  802cd8:	77 54                	ja     802d2e <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802cda:	89 f9                	mov    %edi,%ecx
+  802cdc:	80 f9 ff             	cmp    $0xff,%cl
+  802cdf:	74 21                	je     802d02 <nfu_with_aging_page_choice_func+0xf8>
+  802ce1:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802ce8:	c1 e9 0c             	shr    $0xc,%ecx
+  802ceb:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802cee:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802cf4:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802cf8:	89 fb                	mov    %edi,%ebx
+  802cfa:	38 d9                	cmp    %bl,%cl
+  802cfc:	73 30                	jae    802d2e <nfu_with_aging_page_choice_func+0x124>
+  802cfe:	dd d8                	fstp   %st(0)
+  802d00:	eb 02                	jmp    802d04 <nfu_with_aging_page_choice_func+0xfa>
+  802d02:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802d04:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d0b:	c1 e9 0c             	shr    $0xc,%ecx
+  802d0e:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d11:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802d18:	89 fb                	mov    %edi,%ebx
+  802d1a:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802d1d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802d20:	db 45 e0             	fildl  -0x20(%ebp)
+  802d23:	d8 35 80 5d 80 00    	fdivs  0x805d80
+	return ret*ret;
+  802d29:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d2b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802d2e:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802d31:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802d34:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802d3b:	df 6d e0             	fildll -0x20(%ebp)
+  802d3e:	d9 c1                	fld    %st(1)
+  802d40:	d8 0d 84 5d 80 00    	fmuls  0x805d84
+  802d46:	d9 c9                	fxch   %st(1)
+  802d48:	df f1                	fcomip %st(1),%st
+  802d4a:	dd d8                	fstp   %st(0)
+  802d4c:	0f 82 ed fe ff ff    	jb     802c3f <nfu_with_aging_page_choice_func+0x35>
+  802d52:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802d54:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  802d59:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d5c:	c1 e0 0c             	shl    $0xc,%eax
+  802d5f:	eb 0e                	jmp    802d6f <nfu_with_aging_page_choice_func+0x165>
+  802d61:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802d63:	89 f8                	mov    %edi,%eax
+  802d65:	3c ff                	cmp    $0xff,%al
+  802d67:	74 0e                	je     802d77 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802d69:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d6c:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802d6f:	83 c4 14             	add    $0x14,%esp
+  802d72:	5b                   	pop    %ebx
+  802d73:	5e                   	pop    %esi
+  802d74:	5f                   	pop    %edi
+  802d75:	5d                   	pop    %ebp
+  802d76:	c3                   	ret
+	pgnum = 0;
+  802d77:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  802d7e:	00 00 00 
+	return (void*)UTOP;
+  802d81:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802d86:	eb e7                	jmp    802d6f <nfu_with_aging_page_choice_func+0x165>
+
+00802d88 <myRand>:
+    state = state * 1664525 + 1013904223;
+  802d88:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  802d8f:	66 19 00 
+  802d92:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802d97:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  802d9c:	c1 e8 18             	shr    $0x18,%eax
+}
+  802d9f:	c3                   	ret
+
+00802da0 <random_page_choice_func>:
+{
+  802da0:	55                   	push   %ebp
+  802da1:	89 e5                	mov    %esp,%ebp
+  802da3:	57                   	push   %edi
+  802da4:	56                   	push   %esi
+  802da5:	53                   	push   %ebx
+  802da6:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802da9:	be 00 00 00 00       	mov    $0x0,%esi
+  802dae:	eb 19                	jmp    802dc9 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802db0:	f7 d3                	not    %ebx
+  802db2:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802db8:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802dba:	83 c6 01             	add    $0x1,%esi
+  802dbd:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802dc3:	0f 87 a0 00 00 00    	ja     802e69 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802dc9:	89 f3                	mov    %esi,%ebx
+  802dcb:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  802dd1:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802dd7:	89 d8                	mov    %ebx,%eax
+  802dd9:	c1 e8 0a             	shr    $0xa,%eax
+  802ddc:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802de3:	25 81 00 00 00       	and    $0x81,%eax
+  802de8:	83 f8 01             	cmp    $0x1,%eax
+  802deb:	75 c3                	jne    802db0 <random_page_choice_func+0x10>
+  802ded:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802df3:	77 bb                	ja     802db0 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802df5:	89 df                	mov    %ebx,%edi
+  802df7:	c1 e7 0c             	shl    $0xc,%edi
+  802dfa:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802dfd:	89 f8                	mov    %edi,%eax
+  802dff:	e8 06 f9 ff ff       	call   80270a <page_is_clean>
+  802e04:	84 c0                	test   %al,%al
+  802e06:	0f 85 82 00 00 00    	jne    802e8e <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802e0c:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  802e12:	72 a6                	jb     802dba <random_page_choice_func+0x1a>
+  802e14:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802e1a:	77 9e                	ja     802dba <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802e1c:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802e23:	a8 01                	test   $0x1,%al
+  802e25:	74 93                	je     802dba <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802e27:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802e2e:	f6 c4 04             	test   $0x4,%ah
+  802e31:	75 87                	jne    802dba <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802e33:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802e3a:	f6 c4 02             	test   $0x2,%ah
+  802e3d:	0f 85 77 ff ff ff    	jne    802dba <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802e43:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802e4a:	c1 e8 0c             	shr    $0xc,%eax
+  802e4d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802e50:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802e55:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802e59:	66 83 f8 01          	cmp    $0x1,%ax
+  802e5d:	0f 87 57 ff ff ff    	ja     802dba <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  802e63:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802e69:	e8 1a ff ff ff       	call   802d88 <myRand>
+  802e6e:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  802e74:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  802e79:	29 fe                	sub    %edi,%esi
+  802e7b:	0f be c0             	movsbl %al,%eax
+  802e7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e83:	f7 f6                	div    %esi
+  802e85:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802e87:	bb 15 00 00 00       	mov    $0x15,%ebx
+  802e8c:	eb 1c                	jmp    802eaa <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  802e8e:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  802e94:	e9 8f 00 00 00       	jmp    802f28 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802e99:	e8 ea fe ff ff       	call   802d88 <myRand>
+  802e9e:	0f be c0             	movsbl %al,%eax
+  802ea1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ea6:	f7 f6                	div    %esi
+  802ea8:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802eaa:	83 eb 01             	sub    $0x1,%ebx
+  802ead:	0f 84 c2 00 00 00    	je     802f75 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  802eb3:	89 d0                	mov    %edx,%eax
+  802eb5:	c1 e8 0a             	shr    $0xa,%eax
+  802eb8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802ebf:	25 81 00 00 00       	and    $0x81,%eax
+  802ec4:	83 f8 01             	cmp    $0x1,%eax
+  802ec7:	75 d0                	jne    802e99 <random_page_choice_func+0xf9>
+  802ec9:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  802ecf:	77 c8                	ja     802e99 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  802ed1:	89 d0                	mov    %edx,%eax
+  802ed3:	c1 e0 0c             	shl    $0xc,%eax
+  802ed6:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  802edb:	72 56                	jb     802f33 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802edd:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  802ee2:	77 65                	ja     802f49 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802ee4:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802eeb:	f6 c1 01             	test   $0x1,%cl
+  802eee:	74 59                	je     802f49 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802ef0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802ef7:	f6 c5 04             	test   $0x4,%ch
+  802efa:	75 4d                	jne    802f49 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  802efc:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802f03:	f6 c5 02             	test   $0x2,%ch
+  802f06:	75 41                	jne    802f49 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  802f08:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802f0f:	c1 ea 0c             	shr    $0xc,%edx
+  802f12:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  802f15:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  802f1b:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  802f1f:	66 83 fa 01          	cmp    $0x1,%dx
+  802f23:	77 3a                	ja     802f5f <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  802f25:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  802f28:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f2b:	83 c4 1c             	add    $0x1c,%esp
+  802f2e:	5b                   	pop    %ebx
+  802f2f:	5e                   	pop    %esi
+  802f30:	5f                   	pop    %edi
+  802f31:	5d                   	pop    %ebp
+  802f32:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802f33:	e8 50 fe ff ff       	call   802d88 <myRand>
+  802f38:	0f be c0             	movsbl %al,%eax
+  802f3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f40:	f7 f6                	div    %esi
+  802f42:	01 fa                	add    %edi,%edx
+			continue;
+  802f44:	e9 61 ff ff ff       	jmp    802eaa <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802f49:	e8 3a fe ff ff       	call   802d88 <myRand>
+  802f4e:	0f be c0             	movsbl %al,%eax
+  802f51:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f56:	f7 f6                	div    %esi
+  802f58:	01 fa                	add    %edi,%edx
+			continue;
+  802f5a:	e9 4b ff ff ff       	jmp    802eaa <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802f5f:	e8 24 fe ff ff       	call   802d88 <myRand>
+  802f64:	0f be c0             	movsbl %al,%eax
+  802f67:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f6c:	f7 f6                	div    %esi
+  802f6e:	01 fa                	add    %edi,%edx
+			continue;
+  802f70:	e9 35 ff ff ff       	jmp    802eaa <random_page_choice_func+0x10a>
+	pgnum = 0;
+  802f75:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  802f7c:	00 00 00 
+	return (void*)UTOP;
+  802f7f:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  802f86:	eb a0                	jmp    802f28 <random_page_choice_func+0x188>
+
+00802f88 <nfu>:
+{
+  802f88:	55                   	push   %ebp
+  802f89:	89 e5                	mov    %esp,%ebp
+  802f8b:	57                   	push   %edi
+  802f8c:	56                   	push   %esi
+  802f8d:	53                   	push   %ebx
+  802f8e:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802f91:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  802f97:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802f99:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802f9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fa3:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802faa:	ba 00 00 00 00       	mov    $0x0,%edx
+  802faf:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802fb2:	eb 18                	jmp    802fcc <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802fb4:	f7 d0                	not    %eax
+  802fb6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802fbb:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802fbd:	83 c2 01             	add    $0x1,%edx
+  802fc0:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802fc6:	0f 87 13 01 00 00    	ja     8030df <nfu+0x157>
+		++num_searched_ptes;
+  802fcc:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802fd0:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802fd3:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802fd8:	89 c1                	mov    %eax,%ecx
+  802fda:	c1 e9 0a             	shr    $0xa,%ecx
+  802fdd:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802fe4:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802fea:	83 f9 01             	cmp    $0x1,%ecx
+  802fed:	75 c5                	jne    802fb4 <nfu+0x2c>
+  802fef:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802ff4:	77 be                	ja     802fb4 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802ff6:	89 c1                	mov    %eax,%ecx
+  802ff8:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802ffb:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  803001:	0f 82 a5 00 00 00    	jb     8030ac <nfu+0x124>
+  803007:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  80300d:	0f 87 99 00 00 00    	ja     8030ac <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803013:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80301a:	f6 c1 01             	test   $0x1,%cl
+  80301d:	0f 84 89 00 00 00    	je     8030ac <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803023:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80302a:	f6 c5 04             	test   $0x4,%ch
+  80302d:	75 7d                	jne    8030ac <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80302f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803036:	f6 c5 02             	test   $0x2,%ch
+  803039:	75 71                	jne    8030ac <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80303b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803042:	c1 e9 0c             	shr    $0xc,%ecx
+  803045:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803048:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80304e:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803052:	66 83 f9 01          	cmp    $0x1,%cx
+  803056:	77 54                	ja     8030ac <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  803058:	89 f9                	mov    %edi,%ecx
+  80305a:	80 f9 ff             	cmp    $0xff,%cl
+  80305d:	74 21                	je     803080 <nfu+0xf8>
+  80305f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803066:	c1 e9 0c             	shr    $0xc,%ecx
+  803069:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80306c:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803072:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  803076:	89 fb                	mov    %edi,%ebx
+  803078:	38 d9                	cmp    %bl,%cl
+  80307a:	73 30                	jae    8030ac <nfu+0x124>
+  80307c:	dd d8                	fstp   %st(0)
+  80307e:	eb 02                	jmp    803082 <nfu+0xfa>
+  803080:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  803082:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803089:	c1 e9 0c             	shr    $0xc,%ecx
+  80308c:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80308f:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  803096:	89 fb                	mov    %edi,%ebx
+  803098:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  80309b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80309e:	db 45 e0             	fildl  -0x20(%ebp)
+  8030a1:	d8 35 80 5d 80 00    	fdivs  0x805d80
+	return ret*ret;
+  8030a7:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8030a9:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8030ac:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8030af:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8030b2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8030b9:	df 6d e0             	fildll -0x20(%ebp)
+  8030bc:	d9 c1                	fld    %st(1)
+  8030be:	d8 0d 84 5d 80 00    	fmuls  0x805d84
+  8030c4:	d9 c9                	fxch   %st(1)
+  8030c6:	df f1                	fcomip %st(1),%st
+  8030c8:	dd d8                	fstp   %st(0)
+  8030ca:	0f 82 ed fe ff ff    	jb     802fbd <nfu+0x35>
+  8030d0:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  8030d2:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  8030d7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8030da:	c1 e0 0c             	shl    $0xc,%eax
+  8030dd:	eb 0e                	jmp    8030ed <nfu+0x165>
+  8030df:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  8030e1:	89 f8                	mov    %edi,%eax
+  8030e3:	3c ff                	cmp    $0xff,%al
+  8030e5:	74 0e                	je     8030f5 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  8030e7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8030ea:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8030ed:	83 c4 14             	add    $0x14,%esp
+  8030f0:	5b                   	pop    %ebx
+  8030f1:	5e                   	pop    %esi
+  8030f2:	5f                   	pop    %edi
+  8030f3:	5d                   	pop    %ebp
+  8030f4:	c3                   	ret
+	pgnum = 0;
+  8030f5:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  8030fc:	00 00 00 
+	return (void*)UTOP;
+  8030ff:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803104:	eb e7                	jmp    8030ed <nfu+0x165>
+
+00803106 <lru>:
+{
+  803106:	55                   	push   %ebp
+  803107:	89 e5                	mov    %esp,%ebp
+  803109:	57                   	push   %edi
+  80310a:	56                   	push   %esi
+  80310b:	53                   	push   %ebx
+  80310c:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80310f:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  803115:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  80311c:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803123:	be 00 00 00 00       	mov    $0x0,%esi
+  803128:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80312f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803134:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  803137:	eb 18                	jmp    803151 <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803139:	f7 d0                	not    %eax
+  80313b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803140:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803142:	83 c2 01             	add    $0x1,%edx
+  803145:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  80314b:	0f 87 fa 00 00 00    	ja     80324b <lru+0x145>
+		++num_searched_ptes;
+  803151:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803154:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803157:	01 d0                	add    %edx,%eax
+  803159:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80315e:	89 c1                	mov    %eax,%ecx
+  803160:	c1 e9 0a             	shr    $0xa,%ecx
+  803163:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80316a:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803170:	83 f9 01             	cmp    $0x1,%ecx
+  803173:	75 c4                	jne    803139 <lru+0x33>
+  803175:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  80317a:	77 bd                	ja     803139 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  80317c:	89 c1                	mov    %eax,%ecx
+  80317e:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803181:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803187:	0f 87 92 00 00 00    	ja     80321f <lru+0x119>
+  80318d:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  803193:	0f 82 86 00 00 00    	jb     80321f <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803199:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8031a0:	f6 c1 01             	test   $0x1,%cl
+  8031a3:	74 7a                	je     80321f <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8031a5:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8031ac:	f6 c5 04             	test   $0x4,%ch
+  8031af:	75 6e                	jne    80321f <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8031b1:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8031b8:	f6 c5 02             	test   $0x2,%ch
+  8031bb:	75 62                	jne    80321f <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8031bd:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8031c4:	c1 e9 0c             	shr    $0xc,%ecx
+  8031c7:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8031ca:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8031d0:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8031d4:	66 83 f9 01          	cmp    $0x1,%cx
+  8031d8:	77 45                	ja     80321f <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  8031da:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8031e1:	c1 e9 0c             	shr    $0xc,%ecx
+  8031e4:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8031e7:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8031ed:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8031f0:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8031f3:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  8031f6:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8031f9:	19 df                	sbb    %ebx,%edi
+  8031fb:	7c 22                	jl     80321f <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  8031fd:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803204:	c1 e9 0c             	shr    $0xc,%ecx
+  803207:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80320a:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803210:	8b 59 14             	mov    0x14(%ecx),%ebx
+  803213:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803216:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  803219:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80321c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  80321f:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  803222:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803229:	df 6d e0             	fildll -0x20(%ebp)
+  80322c:	d9 05 84 5d 80 00    	flds   0x805d84
+  803232:	d9 c9                	fxch   %st(1)
+  803234:	df f1                	fcomip %st(1),%st
+  803236:	dd d8                	fstp   %st(0)
+  803238:	0f 82 04 ff ff ff    	jb     803142 <lru+0x3c>
+			pgnum = pgnum_actual;
+  80323e:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  803243:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803246:	c1 e0 0c             	shl    $0xc,%eax
+  803249:	eb 06                	jmp    803251 <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  80324b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80324e:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803251:	83 c4 1c             	add    $0x1c,%esp
+  803254:	5b                   	pop    %ebx
+  803255:	5e                   	pop    %esi
+  803256:	5f                   	pop    %edi
+  803257:	5d                   	pop    %ebp
+  803258:	c3                   	ret
+
+00803259 <set_page_choice_func>:
+{
+  803259:	55                   	push   %ebp
+  80325a:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  80325c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80325f:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  803264:	5d                   	pop    %ebp
+  803265:	c3                   	ret
+
+00803266 <get_page_choice>:
+{
+  803266:	55                   	push   %ebp
+  803267:	89 e5                	mov    %esp,%ebp
+  803269:	57                   	push   %edi
+  80326a:	56                   	push   %esi
+  80326b:	53                   	push   %ebx
+  80326c:	83 ec 24             	sub    $0x24,%esp
+  80326f:	8b 75 08             	mov    0x8(%ebp),%esi
+  803272:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  803275:	57                   	push   %edi
+  803276:	56                   	push   %esi
+  803277:	ff 15 3c 60 80 00    	call   *0x80603c
+  80327d:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80327f:	83 c4 10             	add    $0x10,%esp
+  803282:	eb 25                	jmp    8032a9 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  803284:	83 ec 08             	sub    $0x8,%esp
+  803287:	c1 e0 16             	shl    $0x16,%eax
+  80328a:	50                   	push   %eax
+  80328b:	6a 00                	push   $0x0
+  80328d:	e8 38 db ff ff       	call   800dca <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803292:	83 c4 10             	add    $0x10,%esp
+  803295:	85 c0                	test   %eax,%eax
+  803297:	75 43                	jne    8032dc <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  803299:	83 ec 08             	sub    $0x8,%esp
+  80329c:	57                   	push   %edi
+  80329d:	56                   	push   %esi
+  80329e:	ff 15 3c 60 80 00    	call   *0x80603c
+  8032a4:	89 c3                	mov    %eax,%ebx
+  8032a6:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8032a9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8032ac:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8032b2:	0f 86 ae 00 00 00    	jbe    803366 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  8032b8:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  8032bd:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8032c4:	81 e2 81 00 00 00    	and    $0x81,%edx
+  8032ca:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  8032d0:	74 b2                	je     803284 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  8032d2:	83 c0 01             	add    $0x1,%eax
+  8032d5:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  8032da:	75 e1                	jne    8032bd <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  8032dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032df:	05 00 10 40 11       	add    $0x11401000,%eax
+  8032e4:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8032e9:	76 1f                	jbe    80330a <get_page_choice+0xa4>
+		return (void *) UTOP;
+  8032eb:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  8032f0:	89 d8                	mov    %ebx,%eax
+  8032f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032f5:	5b                   	pop    %ebx
+  8032f6:	5e                   	pop    %esi
+  8032f7:	5f                   	pop    %edi
+  8032f8:	5d                   	pop    %ebp
+  8032f9:	c3                   	ret
+		sys_page_split(0, pg_out);
+  8032fa:	83 ec 08             	sub    $0x8,%esp
+  8032fd:	53                   	push   %ebx
+  8032fe:	6a 00                	push   $0x0
+  803300:	e8 c5 da ff ff       	call   800dca <sys_page_split>
+  803305:	83 c4 10             	add    $0x10,%esp
+  803308:	eb 6c                	jmp    803376 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  80330a:	83 ec 04             	sub    $0x4,%esp
+  80330d:	68 2c 59 80 00       	push   $0x80592c
+  803312:	68 cc 01 00 00       	push   $0x1cc
+  803317:	68 9a 58 80 00       	push   $0x80589a
+  80331c:	e8 2d ce ff ff       	call   80014e <_panic>
+		panic("We tried to page out code pages\n");
+  803321:	83 ec 04             	sub    $0x4,%esp
+  803324:	68 5c 59 80 00       	push   $0x80595c
+  803329:	68 d6 01 00 00       	push   $0x1d6
+  80332e:	68 9a 58 80 00       	push   $0x80589a
+  803333:	e8 16 ce ff ff       	call   80014e <_panic>
+		panic("Invalid mapping for the va\n");
+  803338:	83 ec 04             	sub    $0x4,%esp
+  80333b:	68 a7 58 80 00       	push   $0x8058a7
+  803340:	68 da 01 00 00       	push   $0x1da
+  803345:	68 9a 58 80 00       	push   $0x80589a
+  80334a:	e8 ff cd ff ff       	call   80014e <_panic>
+		panic("We tried to page out a shared page\n");
+  80334f:	83 ec 04             	sub    $0x4,%esp
+  803352:	68 80 59 80 00       	push   $0x805980
+  803357:	68 e0 01 00 00       	push   $0x1e0
+  80335c:	68 9a 58 80 00       	push   $0x80589a
+  803361:	e8 e8 cd ff ff       	call   80014e <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  803366:	89 de                	mov    %ebx,%esi
+  803368:	c1 ee 16             	shr    $0x16,%esi
+  80336b:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803372:	a8 80                	test   $0x80,%al
+  803374:	75 84                	jne    8032fa <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803376:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803379:	05 00 10 40 11       	add    $0x11401000,%eax
+  80337e:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803383:	76 85                	jbe    80330a <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  803385:	89 d8                	mov    %ebx,%eax
+  803387:	e8 7e f3 ff ff       	call   80270a <page_is_clean>
+  80338c:	84 c0                	test   %al,%al
+  80338e:	0f 85 5c ff ff ff    	jne    8032f0 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  803394:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  80339b:	76 84                	jbe    803321 <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  80339d:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8033a4:	a8 01                	test   $0x1,%al
+  8033a6:	74 90                	je     803338 <get_page_choice+0xd2>
+  8033a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8033ab:	c1 e8 0c             	shr    $0xc,%eax
+  8033ae:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8033b5:	f6 c2 01             	test   $0x1,%dl
+  8033b8:	0f 84 7a ff ff ff    	je     803338 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  8033be:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  8033c5:	f6 c2 01             	test   $0x1,%dl
+  8033c8:	74 85                	je     80334f <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  8033ca:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  8033d1:	f6 c2 01             	test   $0x1,%dl
+  8033d4:	0f 84 75 ff ff ff    	je     80334f <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8033da:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  8033e1:	f6 c6 04             	test   $0x4,%dh
+  8033e4:	0f 85 65 ff ff ff    	jne    80334f <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  8033ea:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8033f1:	f6 c6 02             	test   $0x2,%dh
+  8033f4:	0f 85 55 ff ff ff    	jne    80334f <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  8033fa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803401:	c1 e8 0c             	shr    $0xc,%eax
+  803404:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803407:	05 00 00 00 ef       	add    $0xef000000,%eax
+  80340c:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  803410:	66 83 f8 01          	cmp    $0x1,%ax
+  803414:	0f 86 d6 fe ff ff    	jbe    8032f0 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  80341a:	83 ec 04             	sub    $0x4,%esp
+  80341d:	68 a4 59 80 00       	push   $0x8059a4
+  803422:	68 e2 01 00 00       	push   $0x1e2
+  803427:	68 9a 58 80 00       	push   $0x80589a
+  80342c:	e8 1d cd ff ff       	call   80014e <_panic>
+
+00803431 <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  803431:	55                   	push   %ebp
+  803432:	89 e5                	mov    %esp,%ebp
+  803434:	57                   	push   %edi
+  803435:	56                   	push   %esi
+  803436:	53                   	push   %ebx
+  803437:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  80343a:	e8 e8 f6 ff ff       	call   802b27 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  80343f:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803444:	85 c0                	test   %eax,%eax
+  803446:	74 41                	je     803489 <page_share_paged_out+0x58>
+  803448:	83 3d 18 e9 80 00 00 	cmpl   $0x0,0x80e918
+  80344f:	0f 84 fd 00 00 00    	je     803552 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  803455:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  80345c:	00 00 00 
+  80345f:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  803466:	00 00 00 
+  803469:	bf 00 00 00 00       	mov    $0x0,%edi
+  80346e:	eb 2c                	jmp    80349c <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803470:	83 c3 04             	add    $0x4,%ebx
+  803473:	39 f3                	cmp    %esi,%ebx
+  803475:	74 1a                	je     803491 <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  803477:	8b 03                	mov    (%ebx),%eax
+  803479:	a8 01                	test   $0x1,%al
+  80347b:	74 f3                	je     803470 <page_share_paged_out+0x3f>
+  80347d:	c1 e8 0c             	shr    $0xc,%eax
+  803480:	e8 2b f5 ff ff       	call   8029b0 <page_share_slot>
+  803485:	85 c0                	test   %eax,%eax
+  803487:	79 e7                	jns    803470 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  803489:	83 c4 0c             	add    $0xc,%esp
+  80348c:	5b                   	pop    %ebx
+  80348d:	5e                   	pop    %esi
+  80348e:	5f                   	pop    %edi
+  80348f:	5d                   	pop    %ebp
+  803490:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  803491:	83 c7 04             	add    $0x4,%edi
+  803494:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  80349a:	74 1b                	je     8034b7 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  80349c:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8034a1:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  8034a4:	f6 c3 01             	test   $0x1,%bl
+  8034a7:	74 e8                	je     803491 <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  8034a9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8034af:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  8034b5:	eb bc                	jmp    803473 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8034b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034bc:	eb 11                	jmp    8034cf <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  8034be:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8034c4:	83 c3 01             	add    $0x1,%ebx
+  8034c7:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8034cd:	77 41                	ja     803510 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  8034cf:	89 d8                	mov    %ebx,%eax
+  8034d1:	c1 e8 0a             	shr    $0xa,%eax
+  8034d4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8034db:	25 81 00 00 00       	and    $0x81,%eax
+  8034e0:	83 f8 01             	cmp    $0x1,%eax
+  8034e3:	75 d9                	jne    8034be <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  8034e5:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8034ec:	25 81 00 00 00       	and    $0x81,%eax
+  8034f1:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8034f6:	75 cc                	jne    8034c4 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  8034f8:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8034ff:	c1 e8 0c             	shr    $0xc,%eax
+  803502:	e8 a9 f4 ff ff       	call   8029b0 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803507:	85 c0                	test   %eax,%eax
+  803509:	79 b9                	jns    8034c4 <page_share_paged_out+0x93>
+  80350b:	e9 79 ff ff ff       	jmp    803489 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803510:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803517:	75 13                	jne    80352c <page_share_paged_out+0xfb>
+  803519:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  803520:	75 1d                	jne    80353f <page_share_paged_out+0x10e>
+	return 0;
+  803522:	b8 00 00 00 00       	mov    $0x0,%eax
+  803527:	e9 5d ff ff ff       	jmp    803489 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80352c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803531:	e8 46 f4 ff ff       	call   80297c <page_share_send>
+  803536:	85 c0                	test   %eax,%eax
+  803538:	79 df                	jns    803519 <page_share_paged_out+0xe8>
+  80353a:	e9 4a ff ff ff       	jmp    803489 <page_share_paged_out+0x58>
+  80353f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803544:	e8 33 f4 ff ff       	call   80297c <page_share_send>
+  803549:	85 c0                	test   %eax,%eax
+  80354b:	79 d5                	jns    803522 <page_share_paged_out+0xf1>
+  80354d:	e9 37 ff ff ff       	jmp    803489 <page_share_paged_out+0x58>
+		return 0;
+  803552:	b8 00 00 00 00       	mov    $0x0,%eax
+  803557:	e9 2d ff ff ff       	jmp    803489 <page_share_paged_out+0x58>
+
+0080355c <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  80355c:	55                   	push   %ebp
+  80355d:	89 e5                	mov    %esp,%ebp
+  80355f:	56                   	push   %esi
+  803560:	53                   	push   %ebx
+  803561:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  803564:	e8 be f5 ff ff       	call   802b27 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  803569:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  80356e:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803575:	0f 84 82 00 00 00    	je     8035fd <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  80357b:	83 ec 0c             	sub    $0xc,%esp
+  80357e:	68 00 10 00 00       	push   $0x1000
+  803583:	e8 84 11 00 00       	call   80470c <malloc>
+  803588:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  80358a:	83 c4 0c             	add    $0xc,%esp
+  80358d:	6a 14                	push   $0x14
+  80358f:	6a 00                	push   $0x0
+  803591:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803594:	50                   	push   %eax
+  803595:	e8 c7 d3 ff ff       	call   800961 <memset>
+  80359a:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  80359d:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  8035a2:	83 ec 0c             	sub    $0xc,%esp
+  8035a5:	6a 07                	push   $0x7
+  8035a7:	6a 01                	push   $0x1
+  8035a9:	53                   	push   %ebx
+  8035aa:	6a 03                	push   $0x3
+  8035ac:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8035b3:	e8 b7 19 00 00       	call   804f6f <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  8035b8:	8b 03                	mov    (%ebx),%eax
+  8035ba:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  8035bd:	8b 43 04             	mov    0x4(%ebx),%eax
+  8035c0:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  8035c3:	8b 43 08             	mov    0x8(%ebx),%eax
+  8035c6:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  8035c9:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8035cc:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  8035cf:	8b 43 10             	mov    0x10(%ebx),%eax
+  8035d2:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  8035d5:	83 c6 01             	add    $0x1,%esi
+  8035d8:	83 c4 20             	add    $0x20,%esp
+  8035db:	83 fe 02             	cmp    $0x2,%esi
+  8035de:	75 c2                	jne    8035a2 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  8035e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8035e3:	89 03                	mov    %eax,(%ebx)
+  8035e5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8035e8:	89 43 04             	mov    %eax,0x4(%ebx)
+  8035eb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8035ee:	89 43 08             	mov    %eax,0x8(%ebx)
+  8035f1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8035f4:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8035f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035fa:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  8035fd:	89 d8                	mov    %ebx,%eax
+  8035ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803602:	5b                   	pop    %ebx
+  803603:	5e                   	pop    %esi
+  803604:	5d                   	pop    %ebp
+  803605:	c3                   	ret
+
+00803606 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803606:	55                   	push   %ebp
+  803607:	89 e5                	mov    %esp,%ebp
+  803609:	53                   	push   %ebx
+  80360a:	83 ec 10             	sub    $0x10,%esp
+  80360d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  803610:	68 c1 58 80 00       	push   $0x8058c1
+  803615:	e8 0f cc ff ff       	call   800229 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  80361a:	83 c4 08             	add    $0x8,%esp
+  80361d:	ff 33                	push   (%ebx)
+  80361f:	68 d8 59 80 00       	push   $0x8059d8
+  803624:	e8 00 cc ff ff       	call   800229 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  803629:	83 c4 08             	add    $0x8,%esp
+  80362c:	ff 73 04             	push   0x4(%ebx)
+  80362f:	68 c3 58 80 00       	push   $0x8058c3
+  803634:	e8 f0 cb ff ff       	call   800229 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  803639:	83 c4 08             	add    $0x8,%esp
+  80363c:	ff 73 08             	push   0x8(%ebx)
+  80363f:	68 f8 59 80 00       	push   $0x8059f8
+  803644:	e8 e0 cb ff ff       	call   800229 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  803649:	83 c4 08             	add    $0x8,%esp
+  80364c:	ff 73 0c             	push   0xc(%ebx)
+  80364f:	68 1c 5a 80 00       	push   $0x805a1c
+  803654:	e8 d0 cb ff ff       	call   800229 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  803659:	83 c4 08             	add    $0x8,%esp
+  80365c:	ff 73 10             	push   0x10(%ebx)
+  80365f:	68 40 5a 80 00       	push   $0x805a40
+  803664:	e8 c0 cb ff ff       	call   800229 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  803669:	83 c4 08             	add    $0x8,%esp
+  80366c:	ff 35 08 b0 80 00    	push   0x80b008
+  803672:	68 7c 5a 80 00       	push   $0x805a7c
+  803677:	e8 ad cb ff ff       	call   800229 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  80367c:	83 c4 08             	add    $0x8,%esp
+  80367f:	ff 35 04 b0 80 00    	push   0x80b004
+  803685:	68 b0 5a 80 00       	push   $0x805ab0
+  80368a:	e8 9a cb ff ff       	call   800229 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  80368f:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  803694:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  803697:	8b 50 68             	mov    0x68(%eax),%edx
+  80369a:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  80369d:	51                   	push   %ecx
+  80369e:	52                   	push   %edx
+  80369f:	50                   	push   %eax
+  8036a0:	68 f0 5a 80 00       	push   $0x805af0
+  8036a5:	e8 7f cb ff ff       	call   800229 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  8036aa:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  8036af:	8b 40 70             	mov    0x70(%eax),%eax
+  8036b2:	83 c4 18             	add    $0x18,%esp
+  8036b5:	50                   	push   %eax
+  8036b6:	68 24 5b 80 00       	push   $0x805b24
+  8036bb:	e8 69 cb ff ff       	call   800229 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  8036c0:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  8036c6:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  8036cc:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  8036d1:	51                   	push   %ecx
+  8036d2:	52                   	push   %edx
+  8036d3:	50                   	push   %eax
+  8036d4:	68 54 5b 80 00       	push   $0x805b54
+  8036d9:	e8 4b cb ff ff       	call   800229 <cprintf>
+	cprintf("\n");
+  8036de:	83 c4 14             	add    $0x14,%esp
+  8036e1:	68 c1 58 80 00       	push   $0x8058c1
+  8036e6:	e8 3e cb ff ff       	call   800229 <cprintf>
+}
+  8036eb:	83 c4 10             	add    $0x10,%esp
+  8036ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036f1:	c9                   	leave
+  8036f2:	c3                   	ret
+
+008036f3 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  8036f3:	55                   	push   %ebp
+  8036f4:	89 e5                	mov    %esp,%ebp
+  8036f6:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  8036f9:	e8 5e fe ff ff       	call   80355c <get_paging_stats>
+  8036fe:	83 ec 0c             	sub    $0xc,%esp
+  803701:	50                   	push   %eax
+  803702:	e8 ff fe ff ff       	call   803606 <print_paging_stats>
+}
+  803707:	83 c4 10             	add    $0x10,%esp
+  80370a:	c9                   	leave
+  80370b:	c3                   	ret
+
+0080370c <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  80370c:	55                   	push   %ebp
+  80370d:	89 e5                	mov    %esp,%ebp
+  80370f:	53                   	push   %ebx
+  803710:	83 ec 04             	sub    $0x4,%esp
+  803713:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803716:	eb 13                	jmp    80372b <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803718:	83 ec 04             	sub    $0x4,%esp
+  80371b:	6a ff                	push   $0xffffffff
+  80371d:	53                   	push   %ebx
+  80371e:	68 00 f0 ff ee       	push   $0xeefff000
+  803723:	e8 b4 da ff ff       	call   8011dc <sys_futex_wait>
+  803728:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  80372b:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  803730:	39 d8                	cmp    %ebx,%eax
+  803732:	74 e4                	je     803718 <mem_pressure_wait+0xc>
+	return now;
+}
+  803734:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803737:	c9                   	leave
+  803738:	c3                   	ret
+
+00803739 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803739:	55                   	push   %ebp
+  80373a:	89 e5                	mov    %esp,%ebp
+  80373c:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  80373f:	68 ab 43 80 00       	push   $0x8043ab
+  803744:	e8 32 16 00 00       	call   804d7b <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803749:	c7 05 18 e9 80 00 00 	movl   $0xdeadb000,0x80e918
+  803750:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  803753:	83 c4 0c             	add    $0xc,%esp
+  803756:	68 07 02 00 00       	push   $0x207
+  80375b:	68 00 b0 ad de       	push   $0xdeadb000
+  803760:	6a 00                	push   $0x0
+  803762:	e8 9c d5 ff ff       	call   800d03 <sys_page_alloc>
+  803767:	83 c4 10             	add    $0x10,%esp
+  80376a:	85 c0                	test   %eax,%eax
+  80376c:	78 0c                	js     80377a <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  80376e:	e8 b4 f3 ff ff       	call   802b27 <find_paging_env>
+	page_ring_ready();
+  803773:	e8 7f f2 ff ff       	call   8029f7 <page_ring_ready>
+}
+  803778:	c9                   	leave
+  803779:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  80377a:	50                   	push   %eax
+  80377b:	68 e1 58 80 00       	push   $0x8058e1
+  803780:	68 13 05 00 00       	push   $0x513
+  803785:	68 9a 58 80 00       	push   $0x80589a
+  80378a:	e8 bf c9 ff ff       	call   80014e <_panic>
+
+0080378f <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  80378f:	55                   	push   %ebp
+  803790:	89 e5                	mov    %esp,%ebp
+  803792:	57                   	push   %edi
+  803793:	56                   	push   %esi
+  803794:	53                   	push   %ebx
+  803795:	83 ec 0c             	sub    $0xc,%esp
+  803798:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  80379b:	89 fa                	mov    %edi,%edx
+  80379d:	c1 ea 16             	shr    $0x16,%edx
+  8037a0:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8037a5:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  8037a8:	f6 06 01             	testb  $0x1,(%esi)
+  8037ab:	75 3e                	jne    8037eb <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  8037ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  8037b2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8037b6:	74 47                	je     8037ff <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  8037b8:	83 ec 0c             	sub    $0xc,%esp
+  8037bb:	6a 01                	push   $0x1
+  8037bd:	e8 f2 11 00 00       	call   8049b4 <va_alloc>
+  8037c2:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  8037c4:	83 c4 10             	add    $0x10,%esp
+  8037c7:	85 c0                	test   %eax,%eax
+  8037c9:	74 34                	je     8037ff <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  8037cb:	6a 00                	push   $0x0
+  8037cd:	68 07 02 00 00       	push   $0x207
+  8037d2:	50                   	push   %eax
+  8037d3:	6a 00                	push   $0x0
+  8037d5:	e8 df 02 00 00       	call   803ab9 <page_alloc>
+  8037da:	83 c4 10             	add    $0x10,%esp
+  8037dd:	85 c0                	test   %eax,%eax
+  8037df:	78 28                	js     803809 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  8037e1:	f6 06 01             	testb  $0x1,(%esi)
+  8037e4:	75 38                	jne    80381e <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  8037e6:	83 cb 01             	or     $0x1,%ebx
+  8037e9:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  8037eb:	89 f8                	mov    %edi,%eax
+  8037ed:	c1 e8 0a             	shr    $0xa,%eax
+  8037f0:	25 fc 0f 00 00       	and    $0xffc,%eax
+  8037f5:	8b 1e                	mov    (%esi),%ebx
+  8037f7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8037fd:	01 c3                	add    %eax,%ebx
+}
+  8037ff:	89 d8                	mov    %ebx,%eax
+  803801:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803804:	5b                   	pop    %ebx
+  803805:	5e                   	pop    %esi
+  803806:	5f                   	pop    %edi
+  803807:	5d                   	pop    %ebp
+  803808:	c3                   	ret
+			va_free(page, 1);
+  803809:	83 ec 08             	sub    $0x8,%esp
+  80380c:	6a 01                	push   $0x1
+  80380e:	53                   	push   %ebx
+  80380f:	e8 d8 12 00 00       	call   804aec <va_free>
+			return NULL;
+  803814:	83 c4 10             	add    $0x10,%esp
+  803817:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80381c:	eb e1                	jmp    8037ff <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  80381e:	83 ec 08             	sub    $0x8,%esp
+  803821:	53                   	push   %ebx
+  803822:	6a 00                	push   $0x0
+  803824:	e8 5f d5 ff ff       	call   800d88 <sys_page_unmap>
+			va_free(page, 1);
+  803829:	83 c4 08             	add    $0x8,%esp
+  80382c:	6a 01                	push   $0x1
+  80382e:	53                   	push   %ebx
+  80382f:	e8 b8 12 00 00       	call   804aec <va_free>
+  803834:	83 c4 10             	add    $0x10,%esp
+  803837:	eb b2                	jmp    8037eb <umapdir_walk+0x5c>
+
+00803839 <page_out>:
+{
+  803839:	55                   	push   %ebp
+  80383a:	89 e5                	mov    %esp,%ebp
+  80383c:	57                   	push   %edi
+  80383d:	56                   	push   %esi
+  80383e:	53                   	push   %ebx
+  80383f:	83 ec 5c             	sub    $0x5c,%esp
+  803842:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803845:	e8 dd f2 ff ff       	call   802b27 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  80384a:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80384f:	85 c0                	test   %eax,%eax
+  803851:	74 1e                	je     803871 <page_out+0x38>
+  803853:	83 ec 0c             	sub    $0xc,%esp
+  803856:	6a 00                	push   $0x0
+  803858:	6a 00                	push   $0x0
+  80385a:	6a 00                	push   $0x0
+  80385c:	6a 08                	push   $0x8
+  80385e:	50                   	push   %eax
+  80385f:	e8 0b 17 00 00       	call   804f6f <ipc_call>
+  803864:	89 c3                	mov    %eax,%ebx
+  803866:	83 c4 20             	add    $0x20,%esp
+  803869:	85 c0                	test   %eax,%eax
+  80386b:	0f 84 ac 00 00 00    	je     80391d <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  803871:	83 ec 08             	sub    $0x8,%esp
+  803874:	ff 75 0c             	push   0xc(%ebp)
+  803877:	57                   	push   %edi
+  803878:	e8 e9 f9 ff ff       	call   803266 <get_page_choice>
+  80387d:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  80387f:	83 c4 10             	add    $0x10,%esp
+  803882:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803887:	0f 84 18 02 00 00    	je     803aa5 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  80388d:	e8 78 ee ff ff       	call   80270a <page_is_clean>
+  803892:	84 c0                	test   %al,%al
+  803894:	0f 85 8c 00 00 00    	jne    803926 <page_out+0xed>
+	if (pagingenv == 0)
+  80389a:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8038a1:	0f 84 08 02 00 00    	je     803aaf <page_out+0x276>
+	if (page_ring_ready())
+  8038a7:	e8 4b f1 ff ff       	call   8029f7 <page_ring_ready>
+  8038ac:	89 c3                	mov    %eax,%ebx
+  8038ae:	85 c0                	test   %eax,%eax
+  8038b0:	0f 85 89 00 00 00    	jne    80393f <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  8038b6:	83 ec 0c             	sub    $0xc,%esp
+  8038b9:	6a 05                	push   $0x5
+  8038bb:	6a 01                	push   $0x1
+  8038bd:	56                   	push   %esi
+  8038be:	6a 01                	push   $0x1
+  8038c0:	ff 35 40 b0 80 00    	push   0x80b040
+  8038c6:	e8 a4 16 00 00       	call   804f6f <ipc_call>
+  8038cb:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  8038cd:	83 c4 20             	add    $0x20,%esp
+  8038d0:	85 c0                	test   %eax,%eax
+  8038d2:	0f 88 b8 01 00 00    	js     803a90 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  8038d8:	89 f0                	mov    %esi,%eax
+  8038da:	c1 e8 0c             	shr    $0xc,%eax
+  8038dd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8038e4:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  8038e7:	83 ec 08             	sub    $0x8,%esp
+  8038ea:	56                   	push   %esi
+  8038eb:	6a 00                	push   $0x0
+  8038ed:	e8 96 d4 ff ff       	call   800d88 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  8038f2:	83 c4 08             	add    $0x8,%esp
+  8038f5:	6a 01                	push   $0x1
+  8038f7:	56                   	push   %esi
+  8038f8:	e8 92 fe ff ff       	call   80378f <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  8038fd:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803900:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803906:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803909:	09 fe                	or     %edi,%esi
+  80390b:	83 ce 01             	or     $0x1,%esi
+  80390e:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803910:	83 c4 10             	add    $0x10,%esp
+}
+  803913:	89 d8                	mov    %ebx,%eax
+  803915:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803918:	5b                   	pop    %ebx
+  803919:	5e                   	pop    %esi
+  80391a:	5f                   	pop    %edi
+  80391b:	5d                   	pop    %ebp
+  80391c:	c3                   	ret
+		num_page_reclaims++;
+  80391d:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  803924:	eb ed                	jmp    803913 <page_out+0xda>
+		num_page_drops++;
+  803926:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  80392d:	83 ec 08             	sub    $0x8,%esp
+  803930:	56                   	push   %esi
+  803931:	6a 00                	push   $0x0
+  803933:	e8 50 d4 ff ff       	call   800d88 <sys_page_unmap>
+  803938:	89 c3                	mov    %eax,%ebx
+  80393a:	83 c4 10             	add    $0x10,%esp
+  80393d:	eb d4                	jmp    803913 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80393f:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803941:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803946:	2d 00 10 00 00       	sub    $0x1000,%eax
+  80394b:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  80394e:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803950:	83 c0 08             	add    $0x8,%eax
+  803953:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803956:	b8 07 00 00 00       	mov    $0x7,%eax
+  80395b:	e8 e5 ef ff ff       	call   802945 <page_ring_reserve>
+	first = ring->sq_tail;
+  803960:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803965:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803968:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  80396d:	83 ec 04             	sub    $0x4,%esp
+  803970:	68 00 10 00 00       	push   $0x1000
+  803975:	56                   	push   %esi
+  803976:	89 d8                	mov    %ebx,%eax
+  803978:	c1 e0 0c             	shl    $0xc,%eax
+  80397b:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803980:	50                   	push   %eax
+  803981:	e8 72 d0 ff ff       	call   8009f8 <memcpy>
+		vas[n] = va;
+  803986:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  80398a:	89 d9                	mov    %ebx,%ecx
+  80398c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803991:	b8 01 00 00 00       	mov    $0x1,%eax
+  803996:	e8 de ee ff ff       	call   802879 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  80399b:	8d 43 01             	lea    0x1(%ebx),%eax
+  80399e:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  8039a1:	83 c4 10             	add    $0x10,%esp
+  8039a4:	83 fb 06             	cmp    $0x6,%ebx
+  8039a7:	74 62                	je     803a0b <page_out+0x1d2>
+  8039a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8039ac:	eb 15                	jmp    8039c3 <page_out+0x18a>
+			num_page_drops++;
+  8039ae:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  8039b5:	83 ec 08             	sub    $0x8,%esp
+  8039b8:	56                   	push   %esi
+  8039b9:	6a 00                	push   $0x0
+  8039bb:	e8 c8 d3 ff ff       	call   800d88 <sys_page_unmap>
+  8039c0:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  8039c3:	83 ec 08             	sub    $0x8,%esp
+  8039c6:	53                   	push   %ebx
+  8039c7:	57                   	push   %edi
+  8039c8:	e8 99 f8 ff ff       	call   803266 <get_page_choice>
+  8039cd:	89 c6                	mov    %eax,%esi
+  8039cf:	83 c4 10             	add    $0x10,%esp
+  8039d2:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8039d7:	74 32                	je     803a0b <page_out+0x1d2>
+  8039d9:	e8 2c ed ff ff       	call   80270a <page_is_clean>
+  8039de:	84 c0                	test   %al,%al
+  8039e0:	75 cc                	jne    8039ae <page_out+0x175>
+		if (va == (void *) UTOP ||
+  8039e2:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  8039e5:	39 c6                	cmp    %eax,%esi
+  8039e7:	72 07                	jb     8039f0 <page_out+0x1b7>
+  8039e9:	8b 45 98             	mov    -0x68(%ebp),%eax
+  8039ec:	39 c6                	cmp    %eax,%esi
+  8039ee:	72 1b                	jb     803a0b <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  8039f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039f5:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  8039f8:	eb 03                	jmp    8039fd <page_out+0x1c4>
+  8039fa:	83 c3 01             	add    $0x1,%ebx
+  8039fd:	39 da                	cmp    %ebx,%edx
+  8039ff:	0f 84 68 ff ff ff    	je     80396d <page_out+0x134>
+  803a05:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803a09:	75 ef                	jne    8039fa <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803a0b:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803a0e:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803a11:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803a14:	e8 a6 ee ff ff       	call   8028bf <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803a19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a1e:	eb 42                	jmp    803a62 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803a20:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803a24:	89 f8                	mov    %edi,%eax
+  803a26:	c1 e8 0c             	shr    $0xc,%eax
+  803a29:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803a30:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803a33:	83 ec 08             	sub    $0x8,%esp
+  803a36:	57                   	push   %edi
+  803a37:	6a 00                	push   $0x0
+  803a39:	e8 4a d3 ff ff       	call   800d88 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803a3e:	83 c4 08             	add    $0x8,%esp
+  803a41:	6a 01                	push   $0x1
+  803a43:	57                   	push   %edi
+  803a44:	e8 46 fd ff ff       	call   80378f <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803a49:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803a4c:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803a52:	c1 e6 0c             	shl    $0xc,%esi
+  803a55:	09 d6                	or     %edx,%esi
+  803a57:	83 ce 01             	or     $0x1,%esi
+  803a5a:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803a5c:	83 c3 01             	add    $0x1,%ebx
+  803a5f:	83 c4 10             	add    $0x10,%esp
+  803a62:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803a65:	39 c3                	cmp    %eax,%ebx
+  803a67:	74 1d                	je     803a86 <page_out+0x24d>
+		if (res[i] < 0)
+  803a69:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803a6d:	85 f6                	test   %esi,%esi
+  803a6f:	79 af                	jns    803a20 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803a71:	56                   	push   %esi
+  803a72:	68 84 5b 80 00       	push   $0x805b84
+  803a77:	68 d1 02 00 00       	push   $0x2d1
+  803a7c:	68 9a 58 80 00       	push   $0x80589a
+  803a81:	e8 c8 c6 ff ff       	call   80014e <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803a86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a8b:	e9 83 fe ff ff       	jmp    803913 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803a90:	50                   	push   %eax
+  803a91:	68 84 5b 80 00       	push   $0x805b84
+  803a96:	68 0a 03 00 00       	push   $0x30a
+  803a9b:	68 9a 58 80 00       	push   $0x80589a
+  803aa0:	e8 a9 c6 ff ff       	call   80014e <_panic>
+		return -E_NO_MEM;
+  803aa5:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803aaa:	e9 64 fe ff ff       	jmp    803913 <page_out+0xda>
+		return -E_PAGING;
+  803aaf:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803ab4:	e9 5a fe ff ff       	jmp    803913 <page_out+0xda>
+
+00803ab9 <page_alloc>:
+{
+  803ab9:	55                   	push   %ebp
+  803aba:	89 e5                	mov    %esp,%ebp
+  803abc:	57                   	push   %edi
+  803abd:	56                   	push   %esi
+  803abe:	53                   	push   %ebx
+  803abf:	83 ec 0c             	sub    $0xc,%esp
+  803ac2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803ac5:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803ac8:	83 3d 18 e9 80 00 00 	cmpl   $0x0,0x80e918
+  803acf:	74 34                	je     803b05 <page_alloc+0x4c>
+	if (check_mte)
+  803ad1:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803ad5:	75 35                	jne    803b0c <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803ad7:	83 ec 04             	sub    $0x4,%esp
+  803ada:	ff 75 10             	push   0x10(%ebp)
+  803add:	56                   	push   %esi
+  803ade:	57                   	push   %edi
+  803adf:	e8 1f d2 ff ff       	call   800d03 <sys_page_alloc>
+  803ae4:	89 c3                	mov    %eax,%ebx
+  803ae6:	83 c4 10             	add    $0x10,%esp
+  803ae9:	85 c0                	test   %eax,%eax
+  803aeb:	79 52                	jns    803b3f <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803aed:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803af0:	75 52                	jne    803b44 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803af2:	83 ec 08             	sub    $0x8,%esp
+  803af5:	56                   	push   %esi
+  803af6:	57                   	push   %edi
+  803af7:	e8 3d fd ff ff       	call   803839 <page_out>
+  803afc:	83 c4 10             	add    $0x10,%esp
+  803aff:	85 c0                	test   %eax,%eax
+  803b01:	79 d4                	jns    803ad7 <page_alloc+0x1e>
+  803b03:	eb 3f                	jmp    803b44 <page_alloc+0x8b>
+		init_map_dir();
+  803b05:	e8 2f fc ff ff       	call   803739 <init_map_dir>
+  803b0a:	eb c5                	jmp    803ad1 <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803b0c:	83 ec 08             	sub    $0x8,%esp
+  803b0f:	6a 00                	push   $0x0
+  803b11:	56                   	push   %esi
+  803b12:	e8 78 fc ff ff       	call   80378f <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803b17:	83 c4 10             	add    $0x10,%esp
+  803b1a:	85 c0                	test   %eax,%eax
+  803b1c:	74 b9                	je     803ad7 <page_alloc+0x1e>
+  803b1e:	8b 10                	mov    (%eax),%edx
+  803b20:	f6 c2 01             	test   $0x1,%dl
+  803b23:	74 b2                	je     803ad7 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803b25:	83 ec 08             	sub    $0x8,%esp
+  803b28:	56                   	push   %esi
+  803b29:	52                   	push   %edx
+  803b2a:	50                   	push   %eax
+  803b2b:	68 a8 5b 80 00       	push   $0x805ba8
+  803b30:	68 34 03 00 00       	push   $0x334
+  803b35:	68 9a 58 80 00       	push   $0x80589a
+  803b3a:	e8 0f c6 ff ff       	call   80014e <_panic>
+	return 0;
+  803b3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803b44:	89 d8                	mov    %ebx,%eax
+  803b46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b49:	5b                   	pop    %ebx
+  803b4a:	5e                   	pop    %esi
+  803b4b:	5f                   	pop    %edi
+  803b4c:	5d                   	pop    %ebp
+  803b4d:	c3                   	ret
+
+00803b4e <page_adopt>:
+{
+  803b4e:	55                   	push   %ebp
+  803b4f:	89 e5                	mov    %esp,%ebp
+  803b51:	56                   	push   %esi
+  803b52:	53                   	push   %ebx
+  803b53:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803b55:	c1 e8 16             	shr    $0x16,%eax
+  803b58:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803b5f:	25 81 00 00 00       	and    $0x81,%eax
+  803b64:	83 f8 01             	cmp    $0x1,%eax
+  803b67:	75 53                	jne    803bbc <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803b69:	89 d8                	mov    %ebx,%eax
+  803b6b:	c1 e8 0c             	shr    $0xc,%eax
+  803b6e:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803b75:	89 f2                	mov    %esi,%edx
+  803b77:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803b7d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803b82:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803b88:	75 37                	jne    803bc1 <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803b8a:	83 ec 08             	sub    $0x8,%esp
+  803b8d:	6a 01                	push   $0x1
+  803b8f:	53                   	push   %ebx
+  803b90:	e8 fa fb ff ff       	call   80378f <umapdir_walk>
+  803b95:	83 c4 10             	add    $0x10,%esp
+  803b98:	85 c0                	test   %eax,%eax
+  803b9a:	74 2c                	je     803bc8 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803b9c:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803ba2:	83 ce 01             	or     $0x1,%esi
+  803ba5:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803ba7:	83 ec 08             	sub    $0x8,%esp
+  803baa:	53                   	push   %ebx
+  803bab:	6a 00                	push   $0x0
+  803bad:	e8 d6 d1 ff ff       	call   800d88 <sys_page_unmap>
+	return 1;
+  803bb2:	83 c4 10             	add    $0x10,%esp
+  803bb5:	b8 01 00 00 00       	mov    $0x1,%eax
+  803bba:	eb 05                	jmp    803bc1 <page_adopt+0x73>
+		return 0;
+  803bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bc1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803bc4:	5b                   	pop    %ebx
+  803bc5:	5e                   	pop    %esi
+  803bc6:	5d                   	pop    %ebp
+  803bc7:	c3                   	ret
+		return -E_NO_MEM;
+  803bc8:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803bcd:	eb f2                	jmp    803bc1 <page_adopt+0x73>
+
+00803bcf <page_forget>:
+{
+  803bcf:	55                   	push   %ebp
+  803bd0:	89 e5                	mov    %esp,%ebp
+  803bd2:	53                   	push   %ebx
+  803bd3:	83 ec 04             	sub    $0x4,%esp
+  803bd6:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803bd8:	e8 4a ef ff ff       	call   802b27 <find_paging_env>
+	if (pagingenv == 0)
+  803bdd:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803be4:	74 39                	je     803c1f <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803be6:	89 d8                	mov    %ebx,%eax
+  803be8:	c1 e8 16             	shr    $0x16,%eax
+  803beb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803bf2:	25 81 00 00 00       	and    $0x81,%eax
+  803bf7:	83 f8 01             	cmp    $0x1,%eax
+  803bfa:	74 28                	je     803c24 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803bfc:	83 3d 18 e9 80 00 00 	cmpl   $0x0,0x80e918
+  803c03:	74 1a                	je     803c1f <page_forget+0x50>
+  803c05:	83 ec 08             	sub    $0x8,%esp
+  803c08:	6a 00                	push   $0x0
+  803c0a:	53                   	push   %ebx
+  803c0b:	e8 7f fb ff ff       	call   80378f <umapdir_walk>
+  803c10:	89 c3                	mov    %eax,%ebx
+  803c12:	83 c4 10             	add    $0x10,%esp
+  803c15:	85 c0                	test   %eax,%eax
+  803c17:	74 06                	je     803c1f <page_forget+0x50>
+  803c19:	8b 00                	mov    (%eax),%eax
+  803c1b:	a8 01                	test   $0x1,%al
+  803c1d:	75 2b                	jne    803c4a <page_forget+0x7b>
+}
+  803c1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c22:	c9                   	leave
+  803c23:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803c24:	89 d8                	mov    %ebx,%eax
+  803c26:	c1 e8 0c             	shr    $0xc,%eax
+  803c29:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803c30:	89 c2                	mov    %eax,%edx
+  803c32:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803c38:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803c3e:	75 bc                	jne    803bfc <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803c40:	c1 e8 0c             	shr    $0xc,%eax
+  803c43:	e8 5c ee ff ff       	call   802aa4 <page_remove_slot>
+		return;
+  803c48:	eb d5                	jmp    803c1f <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803c4a:	c1 e8 0c             	shr    $0xc,%eax
+  803c4d:	e8 52 ee ff ff       	call   802aa4 <page_remove_slot>
+	*mte = 0;
+  803c52:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803c58:	eb c5                	jmp    803c1f <page_forget+0x50>
+
+00803c5a <page_unmap>:
+{
+  803c5a:	55                   	push   %ebp
+  803c5b:	89 e5                	mov    %esp,%ebp
+  803c5d:	57                   	push   %edi
+  803c5e:	56                   	push   %esi
+  803c5f:	53                   	push   %ebx
+  803c60:	83 ec 0c             	sub    $0xc,%esp
+  803c63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803c66:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803c69:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  803c6e:	8b 40 48             	mov    0x48(%eax),%eax
+  803c71:	85 db                	test   %ebx,%ebx
+  803c73:	0f 8e b4 00 00 00    	jle    803d2d <page_unmap+0xd3>
+  803c79:	39 d8                	cmp    %ebx,%eax
+  803c7b:	0f 84 ac 00 00 00    	je     803d2d <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803c81:	83 ec 08             	sub    $0x8,%esp
+  803c84:	57                   	push   %edi
+  803c85:	53                   	push   %ebx
+  803c86:	e8 fd d0 ff ff       	call   800d88 <sys_page_unmap>
+  803c8b:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803c8d:	e8 95 ee ff ff       	call   802b27 <find_paging_env>
+	if (pagingenv == 0)
+  803c92:	83 c4 10             	add    $0x10,%esp
+  803c95:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803c9c:	0f 84 a1 00 00 00    	je     803d43 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803ca2:	83 ec 0c             	sub    $0xc,%esp
+  803ca5:	6a 05                	push   $0x5
+  803ca7:	68 00 00 40 00       	push   $0x400000
+  803cac:	6a 00                	push   $0x0
+  803cae:	68 00 b0 ad de       	push   $0xdeadb000
+  803cb3:	53                   	push   %ebx
+  803cb4:	e8 8d d0 ff ff       	call   800d46 <sys_page_map>
+  803cb9:	83 c4 20             	add    $0x20,%esp
+  803cbc:	85 c0                	test   %eax,%eax
+  803cbe:	0f 88 89 00 00 00    	js     803d4d <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803cc4:	89 f8                	mov    %edi,%eax
+  803cc6:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803cc9:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803cd0:	a8 01                	test   $0x1,%al
+  803cd2:	74 6f                	je     803d43 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803cd4:	83 ec 0c             	sub    $0xc,%esp
+  803cd7:	6a 05                	push   $0x5
+  803cd9:	68 00 00 40 00       	push   $0x400000
+  803cde:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803ce0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803ce5:	50                   	push   %eax
+  803ce6:	53                   	push   %ebx
+  803ce7:	e8 5a d0 ff ff       	call   800d46 <sys_page_map>
+  803cec:	83 c4 20             	add    $0x20,%esp
+  803cef:	85 c0                	test   %eax,%eax
+  803cf1:	78 6f                	js     803d62 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803cf3:	c1 ef 0c             	shr    $0xc,%edi
+  803cf6:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803cfc:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803d03:	01 
+  803d04:	74 3d                	je     803d43 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803d06:	83 ec 08             	sub    $0x8,%esp
+  803d09:	68 00 00 40 00       	push   $0x400000
+  803d0e:	6a 00                	push   $0x0
+  803d10:	e8 73 d0 ff ff       	call   800d88 <sys_page_unmap>
+  803d15:	83 c4 10             	add    $0x10,%esp
+  803d18:	85 c0                	test   %eax,%eax
+  803d1a:	78 5b                	js     803d77 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803d1c:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803d23:	c1 e8 0c             	shr    $0xc,%eax
+  803d26:	e8 79 ed ff ff       	call   802aa4 <page_remove_slot>
+	return r;
+  803d2b:	eb 16                	jmp    803d43 <page_unmap+0xe9>
+		page_forget(va);
+  803d2d:	89 f8                	mov    %edi,%eax
+  803d2f:	e8 9b fe ff ff       	call   803bcf <page_forget>
+		return sys_page_unmap(envid, va);
+  803d34:	83 ec 08             	sub    $0x8,%esp
+  803d37:	57                   	push   %edi
+  803d38:	53                   	push   %ebx
+  803d39:	e8 4a d0 ff ff       	call   800d88 <sys_page_unmap>
+  803d3e:	89 c6                	mov    %eax,%esi
+  803d40:	83 c4 10             	add    $0x10,%esp
+}
+  803d43:	89 f0                	mov    %esi,%eax
+  803d45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d48:	5b                   	pop    %ebx
+  803d49:	5e                   	pop    %esi
+  803d4a:	5f                   	pop    %edi
+  803d4b:	5d                   	pop    %ebp
+  803d4c:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803d4d:	50                   	push   %eax
+  803d4e:	68 e4 5b 80 00       	push   $0x805be4
+  803d53:	68 e4 03 00 00       	push   $0x3e4
+  803d58:	68 9a 58 80 00       	push   $0x80589a
+  803d5d:	e8 ec c3 ff ff       	call   80014e <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803d62:	50                   	push   %eax
+  803d63:	68 10 5c 80 00       	push   $0x805c10
+  803d68:	68 ea 03 00 00       	push   $0x3ea
+  803d6d:	68 9a 58 80 00       	push   $0x80589a
+  803d72:	e8 d7 c3 ff ff       	call   80014e <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803d77:	50                   	push   %eax
+  803d78:	68 3c 5c 80 00       	push   $0x805c3c
+  803d7d:	68 ef 03 00 00       	push   $0x3ef
+  803d82:	68 9a 58 80 00       	push   $0x80589a
+  803d87:	e8 c2 c3 ff ff       	call   80014e <_panic>
+
+00803d8c <page_unmap_range>:
+{
+  803d8c:	55                   	push   %ebp
+  803d8d:	89 e5                	mov    %esp,%ebp
+  803d8f:	57                   	push   %edi
+  803d90:	56                   	push   %esi
+  803d91:	53                   	push   %ebx
+  803d92:	83 ec 0c             	sub    $0xc,%esp
+  803d95:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803d98:	e8 8a ed ff ff       	call   802b27 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803d9d:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  803da2:	8b 40 48             	mov    0x48(%eax),%eax
+  803da5:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803da9:	7e 38                	jle    803de3 <page_unmap_range+0x57>
+  803dab:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803dae:	74 33                	je     803de3 <page_unmap_range+0x57>
+  803db0:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803db7:	74 2a                	je     803de3 <page_unmap_range+0x57>
+  803db9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  803dbc:	be 00 00 00 00       	mov    $0x0,%esi
+  803dc1:	39 fe                	cmp    %edi,%esi
+  803dc3:	74 56                	je     803e1b <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  803dc5:	83 ec 08             	sub    $0x8,%esp
+  803dc8:	53                   	push   %ebx
+  803dc9:	ff 75 08             	push   0x8(%ebp)
+  803dcc:	e8 89 fe ff ff       	call   803c5a <page_unmap>
+  803dd1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803dd7:	83 c4 10             	add    $0x10,%esp
+  803dda:	85 c0                	test   %eax,%eax
+  803ddc:	78 35                	js     803e13 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  803dde:	83 c6 01             	add    $0x1,%esi
+  803de1:	eb de                	jmp    803dc1 <page_unmap_range+0x35>
+  803de3:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803de6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803deb:	eb 10                	jmp    803dfd <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803ded:	89 f0                	mov    %esi,%eax
+  803def:	e8 db fd ff ff       	call   803bcf <page_forget>
+		for (i = 0; i < npages; i++)
+  803df4:	83 c3 01             	add    $0x1,%ebx
+  803df7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803dfd:	39 fb                	cmp    %edi,%ebx
+  803dff:	75 ec                	jne    803ded <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  803e01:	83 ec 04             	sub    $0x4,%esp
+  803e04:	57                   	push   %edi
+  803e05:	ff 75 0c             	push   0xc(%ebp)
+  803e08:	ff 75 08             	push   0x8(%ebp)
+  803e0b:	e8 8c d0 ff ff       	call   800e9c <sys_page_unmap_range>
+  803e10:	83 c4 10             	add    $0x10,%esp
+}
+  803e13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e16:	5b                   	pop    %ebx
+  803e17:	5e                   	pop    %esi
+  803e18:	5f                   	pop    %edi
+  803e19:	5d                   	pop    %ebp
+  803e1a:	c3                   	ret
+	return 0;
+  803e1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e20:	eb f1                	jmp    803e13 <page_unmap_range+0x87>
+
+00803e22 <page_alloc_range>:
+{
+  803e22:	55                   	push   %ebp
+  803e23:	89 e5                	mov    %esp,%ebp
+  803e25:	57                   	push   %edi
+  803e26:	56                   	push   %esi
+  803e27:	53                   	push   %ebx
+  803e28:	83 ec 1c             	sub    $0x1c,%esp
+  803e2b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803e2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  803e31:	83 3d 18 e9 80 00 00 	cmpl   $0x0,0x80e918
+  803e38:	74 14                	je     803e4e <page_alloc_range+0x2c>
+	if (check_mte)
+  803e3a:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803e3e:	74 66                	je     803ea6 <page_alloc_range+0x84>
+  803e40:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  803e42:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e47:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803e4a:	89 c7                	mov    %eax,%edi
+  803e4c:	eb 10                	jmp    803e5e <page_alloc_range+0x3c>
+		init_map_dir();
+  803e4e:	e8 e6 f8 ff ff       	call   803739 <init_map_dir>
+  803e53:	eb e5                	jmp    803e3a <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803e55:	83 c7 01             	add    $0x1,%edi
+  803e58:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803e5e:	39 df                	cmp    %ebx,%edi
+  803e60:	74 38                	je     803e9a <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  803e62:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803e65:	83 ec 08             	sub    $0x8,%esp
+  803e68:	6a 00                	push   $0x0
+  803e6a:	56                   	push   %esi
+  803e6b:	e8 1f f9 ff ff       	call   80378f <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  803e70:	83 c4 10             	add    $0x10,%esp
+  803e73:	85 c0                	test   %eax,%eax
+  803e75:	74 de                	je     803e55 <page_alloc_range+0x33>
+  803e77:	8b 10                	mov    (%eax),%edx
+  803e79:	f6 c2 01             	test   $0x1,%dl
+  803e7c:	74 d7                	je     803e55 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  803e7e:	83 ec 08             	sub    $0x8,%esp
+  803e81:	ff 75 e4             	push   -0x1c(%ebp)
+  803e84:	52                   	push   %edx
+  803e85:	50                   	push   %eax
+  803e86:	68 a8 5b 80 00       	push   $0x805ba8
+  803e8b:	68 0b 04 00 00       	push   $0x40b
+  803e90:	68 9a 58 80 00       	push   $0x80589a
+  803e95:	e8 b4 c2 ff ff       	call   80014e <_panic>
+  803e9a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803e9d:	eb 07                	jmp    803ea6 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  803e9f:	c1 e0 0c             	shl    $0xc,%eax
+  803ea2:	01 c7                	add    %eax,%edi
+			npages -= r;
+  803ea4:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  803ea6:	85 db                	test   %ebx,%ebx
+  803ea8:	74 30                	je     803eda <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  803eaa:	ff 75 14             	push   0x14(%ebp)
+  803ead:	53                   	push   %ebx
+  803eae:	57                   	push   %edi
+  803eaf:	ff 75 08             	push   0x8(%ebp)
+  803eb2:	e8 77 cf ff ff       	call   800e2e <sys_page_alloc_range>
+  803eb7:	89 c6                	mov    %eax,%esi
+  803eb9:	83 c4 10             	add    $0x10,%esp
+  803ebc:	85 c0                	test   %eax,%eax
+  803ebe:	7f df                	jg     803e9f <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  803ec0:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  803ec3:	75 1a                	jne    803edf <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  803ec5:	83 ec 08             	sub    $0x8,%esp
+  803ec8:	57                   	push   %edi
+  803ec9:	ff 75 08             	push   0x8(%ebp)
+  803ecc:	e8 68 f9 ff ff       	call   803839 <page_out>
+  803ed1:	83 c4 10             	add    $0x10,%esp
+  803ed4:	85 c0                	test   %eax,%eax
+  803ed6:	79 ce                	jns    803ea6 <page_alloc_range+0x84>
+  803ed8:	eb 05                	jmp    803edf <page_alloc_range+0xbd>
+	return 0;
+  803eda:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803edf:	89 f0                	mov    %esi,%eax
+  803ee1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ee4:	5b                   	pop    %ebx
+  803ee5:	5e                   	pop    %esi
+  803ee6:	5f                   	pop    %edi
+  803ee7:	5d                   	pop    %ebp
+  803ee8:	c3                   	ret
+
+00803ee9 <page_in>:
+{
+  803ee9:	55                   	push   %ebp
+  803eea:	89 e5                	mov    %esp,%ebp
+  803eec:	57                   	push   %edi
+  803eed:	56                   	push   %esi
+  803eee:	53                   	push   %ebx
+  803eef:	83 ec 3c             	sub    $0x3c,%esp
+  803ef2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  803ef5:	e8 2d ec ff ff       	call   802b27 <find_paging_env>
+	if (pagingenv == 0)
+  803efa:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803f01:	0f 84 09 02 00 00    	je     804110 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  803f07:	83 ec 08             	sub    $0x8,%esp
+  803f0a:	6a 00                	push   $0x0
+  803f0c:	56                   	push   %esi
+  803f0d:	e8 7d f8 ff ff       	call   80378f <umapdir_walk>
+  803f12:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803f14:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803f1a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  803f1d:	83 c4 10             	add    $0x10,%esp
+  803f20:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803f24:	74 0d                	je     803f33 <page_in+0x4a>
+  803f26:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  803f2b:	8b 40 48             	mov    0x48(%eax),%eax
+  803f2e:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803f31:	75 06                	jne    803f39 <page_in+0x50>
+  803f33:	8b 03                	mov    (%ebx),%eax
+  803f35:	a8 02                	test   $0x2,%al
+  803f37:	75 63                	jne    803f9c <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  803f39:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803f3b:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803f3d:	89 f0                	mov    %esi,%eax
+  803f3f:	25 06 0e 00 00       	and    $0xe06,%eax
+  803f44:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803f47:	50                   	push   %eax
+  803f48:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803f4b:	57                   	push   %edi
+  803f4c:	ff 75 08             	push   0x8(%ebp)
+  803f4f:	e8 65 fb ff ff       	call   803ab9 <page_alloc>
+  803f54:	83 c4 10             	add    $0x10,%esp
+  803f57:	85 c0                	test   %eax,%eax
+  803f59:	78 39                	js     803f94 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  803f5b:	89 f0                	mov    %esi,%eax
+  803f5d:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803f60:	83 ec 0c             	sub    $0xc,%esp
+  803f63:	6a 07                	push   $0x7
+  803f65:	6a 01                	push   $0x1
+  803f67:	57                   	push   %edi
+  803f68:	c1 e0 04             	shl    $0x4,%eax
+  803f6b:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803f6c:	c1 ee 1c             	shr    $0x1c,%esi
+  803f6f:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803f72:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803f79:	e8 f1 0f 00 00       	call   804f6f <ipc_call>
+  803f7e:	83 c4 20             	add    $0x20,%esp
+  803f81:	85 c0                	test   %eax,%eax
+  803f83:	0f 88 72 01 00 00    	js     8040fb <page_in+0x212>
+	*mte = 0;
+  803f89:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  803f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f97:	5b                   	pop    %ebx
+  803f98:	5e                   	pop    %esi
+  803f99:	5f                   	pop    %edi
+  803f9a:	5d                   	pop    %ebp
+  803f9b:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803f9c:	25 06 0e 00 00       	and    $0xe06,%eax
+  803fa1:	83 c8 01             	or     $0x1,%eax
+  803fa4:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  803fa7:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803faa:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  803fad:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  803fb3:	be 01 00 00 00       	mov    $0x1,%esi
+  803fb8:	eb 46                	jmp    804000 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  803fba:	83 ec 08             	sub    $0x8,%esp
+  803fbd:	6a 00                	push   $0x0
+  803fbf:	51                   	push   %ecx
+  803fc0:	e8 ca f7 ff ff       	call   80378f <umapdir_walk>
+  803fc5:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  803fc9:	83 c4 10             	add    $0x10,%esp
+  803fcc:	85 c0                	test   %eax,%eax
+  803fce:	74 66                	je     804036 <page_in+0x14d>
+  803fd0:	8b 00                	mov    (%eax),%eax
+  803fd2:	a8 01                	test   $0x1,%al
+  803fd4:	74 60                	je     804036 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  803fd6:	89 c2                	mov    %eax,%edx
+  803fd8:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  803fde:	83 ca 01             	or     $0x1,%edx
+  803fe1:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  803fe4:	75 50                	jne    804036 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  803fe6:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803fec:	c1 e8 1c             	shr    $0x1c,%eax
+  803fef:	8b 13                	mov    (%ebx),%edx
+  803ff1:	c1 ea 1c             	shr    $0x1c,%edx
+  803ff4:	39 d0                	cmp    %edx,%eax
+  803ff6:	75 3e                	jne    804036 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803ff8:	83 c6 01             	add    $0x1,%esi
+  803ffb:	83 fe 08             	cmp    $0x8,%esi
+  803ffe:	74 3f                	je     80403f <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  804000:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  804002:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  804008:	77 2c                	ja     804036 <page_in+0x14d>
+  80400a:	89 f8                	mov    %edi,%eax
+  80400c:	c1 e8 16             	shr    $0x16,%eax
+  80400f:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  804016:	f6 c2 01             	test   $0x1,%dl
+  804019:	74 9f                	je     803fba <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  80401b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  804022:	a8 80                	test   $0x80,%al
+  804024:	75 10                	jne    804036 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804026:	89 f8                	mov    %edi,%eax
+  804028:	c1 e8 0c             	shr    $0xc,%eax
+  80402b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804032:	a8 01                	test   $0x1,%al
+  804034:	74 84                	je     803fba <page_in+0xd1>
+	if (n == 1)
+  804036:	83 fe 01             	cmp    $0x1,%esi
+  804039:	0f 84 fa fe ff ff    	je     803f39 <page_in+0x50>
+	req.nslots = n;
+  80403f:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  804045:	b8 00 00 00 00       	mov    $0x0,%eax
+  80404a:	eb 13                	jmp    80405f <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  80404c:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  804050:	8b 12                	mov    (%edx),%edx
+  804052:	c1 ea 0c             	shr    $0xc,%edx
+  804055:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  80405c:	83 c0 01             	add    $0x1,%eax
+  80405f:	39 c6                	cmp    %eax,%esi
+  804061:	75 e9                	jne    80404c <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  804063:	83 ec 0c             	sub    $0xc,%esp
+  804066:	6a 00                	push   $0x0
+  804068:	ff 75 c0             	push   -0x40(%ebp)
+  80406b:	56                   	push   %esi
+  80406c:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  80406f:	57                   	push   %edi
+  804070:	6a 00                	push   $0x0
+  804072:	e8 ab fd ff ff       	call   803e22 <page_alloc_range>
+  804077:	83 c4 20             	add    $0x20,%esp
+  80407a:	85 c0                	test   %eax,%eax
+  80407c:	78 6e                	js     8040ec <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  80407e:	83 ec 04             	sub    $0x4,%esp
+  804081:	6a 24                	push   $0x24
+  804083:	68 00 80 80 00       	push   $0x808000
+  804088:	57                   	push   %edi
+  804089:	e8 08 c9 ff ff       	call   800996 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  80408e:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  804095:	56                   	push   %esi
+  804096:	57                   	push   %edi
+  804097:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  804099:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  8040a0:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  8040a3:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  8040aa:	e8 c0 0e 00 00       	call   804f6f <ipc_call>
+  8040af:	83 c4 20             	add    $0x20,%esp
+  8040b2:	85 c0                	test   %eax,%eax
+  8040b4:	78 08                	js     8040be <page_in+0x1d5>
+  8040b6:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8040b9:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  8040bc:	eb 20                	jmp    8040de <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  8040be:	50                   	push   %eax
+  8040bf:	68 68 5c 80 00       	push   $0x805c68
+  8040c4:	68 59 02 00 00       	push   $0x259
+  8040c9:	68 9a 58 80 00       	push   $0x80589a
+  8040ce:	e8 7b c0 ff ff       	call   80014e <_panic>
+		*mtes[i] = 0;
+  8040d3:	8b 10                	mov    (%eax),%edx
+  8040d5:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  8040db:	83 c0 04             	add    $0x4,%eax
+  8040de:	39 c8                	cmp    %ecx,%eax
+  8040e0:	75 f1                	jne    8040d3 <page_in+0x1ea>
+	return n;
+  8040e2:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  8040e4:	85 f6                	test   %esi,%esi
+  8040e6:	0f 84 4d fe ff ff    	je     803f39 <page_in+0x50>
+		return r < 0 ? r : 0;
+  8040ec:	85 c0                	test   %eax,%eax
+  8040ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040f3:	0f 4f c2             	cmovg  %edx,%eax
+  8040f6:	e9 99 fe ff ff       	jmp    803f94 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  8040fb:	50                   	push   %eax
+  8040fc:	68 a0 5c 80 00       	push   $0x805ca0
+  804101:	68 9a 02 00 00       	push   $0x29a
+  804106:	68 9a 58 80 00       	push   $0x80589a
+  80410b:	e8 3e c0 ff ff       	call   80014e <_panic>
+		return -E_PAGING;
+  804110:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804115:	e9 7a fe ff ff       	jmp    803f94 <page_in+0xab>
+
+0080411a <page_map>:
+{
+  80411a:	55                   	push   %ebp
+  80411b:	89 e5                	mov    %esp,%ebp
+  80411d:	57                   	push   %edi
+  80411e:	56                   	push   %esi
+  80411f:	53                   	push   %ebx
+  804120:	83 ec 1c             	sub    $0x1c,%esp
+  804123:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  804126:	83 ec 0c             	sub    $0xc,%esp
+  804129:	ff 75 18             	push   0x18(%ebp)
+  80412c:	ff 75 14             	push   0x14(%ebp)
+  80412f:	ff 75 10             	push   0x10(%ebp)
+  804132:	ff 75 0c             	push   0xc(%ebp)
+  804135:	56                   	push   %esi
+  804136:	e8 0b cc ff ff       	call   800d46 <sys_page_map>
+  80413b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80413e:	83 c4 20             	add    $0x20,%esp
+  804141:	85 c0                	test   %eax,%eax
+  804143:	0f 89 a9 01 00 00    	jns    8042f2 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  804149:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  80414d:	74 5f                	je     8041ae <page_map+0x94>
+		if (r != -E_INVAL)
+  80414f:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  804153:	0f 85 a0 01 00 00    	jne    8042f9 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804159:	85 f6                	test   %esi,%esi
+  80415b:	74 70                	je     8041cd <page_map+0xb3>
+  80415d:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  804162:	8b 40 48             	mov    0x48(%eax),%eax
+  804165:	39 f0                	cmp    %esi,%eax
+  804167:	74 64                	je     8041cd <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804169:	83 ec 0c             	sub    $0xc,%esp
+  80416c:	6a 05                	push   $0x5
+  80416e:	68 00 00 40 00       	push   $0x400000
+  804173:	6a 00                	push   $0x0
+  804175:	68 00 b0 ad de       	push   $0xdeadb000
+  80417a:	56                   	push   %esi
+  80417b:	e8 c6 cb ff ff       	call   800d46 <sys_page_map>
+  804180:	89 c3                	mov    %eax,%ebx
+  804182:	83 c4 20             	add    $0x20,%esp
+  804185:	85 c0                	test   %eax,%eax
+  804187:	79 6a                	jns    8041f3 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  804189:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80418c:	75 50                	jne    8041de <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  80418e:	83 ec 08             	sub    $0x8,%esp
+  804191:	68 00 00 40 00       	push   $0x400000
+  804196:	6a fc                	push   $0xfffffffc
+  804198:	e8 9c f6 ff ff       	call   803839 <page_out>
+  80419d:	83 c4 10             	add    $0x10,%esp
+  8041a0:	85 c0                	test   %eax,%eax
+  8041a2:	79 c5                	jns    804169 <page_map+0x4f>
+}
+  8041a4:	89 d8                	mov    %ebx,%eax
+  8041a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041a9:	5b                   	pop    %ebx
+  8041aa:	5e                   	pop    %esi
+  8041ab:	5f                   	pop    %edi
+  8041ac:	5d                   	pop    %ebp
+  8041ad:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  8041ae:	83 ec 08             	sub    $0x8,%esp
+  8041b1:	68 00 00 40 00       	push   $0x400000
+  8041b6:	6a 00                	push   $0x0
+  8041b8:	e8 7c f6 ff ff       	call   803839 <page_out>
+  8041bd:	83 c4 10             	add    $0x10,%esp
+  8041c0:	85 c0                	test   %eax,%eax
+  8041c2:	0f 89 5e ff ff ff    	jns    804126 <page_map+0xc>
+				return r;
+  8041c8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8041cb:	eb d7                	jmp    8041a4 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8041cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8041d0:	e8 79 f9 ff ff       	call   803b4e <page_adopt>
+  8041d5:	85 c0                	test   %eax,%eax
+  8041d7:	79 90                	jns    804169 <page_map+0x4f>
+			return r;
+  8041d9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8041dc:	eb c6                	jmp    8041a4 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  8041de:	53                   	push   %ebx
+  8041df:	68 d4 5c 80 00       	push   $0x805cd4
+  8041e4:	68 77 03 00 00       	push   $0x377
+  8041e9:	68 9a 58 80 00       	push   $0x80589a
+  8041ee:	e8 5b bf ff ff       	call   80014e <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  8041f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8041f6:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8041f9:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  804200:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  804206:	0f 84 f5 00 00 00    	je     804301 <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  80420c:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804212:	83 ec 0c             	sub    $0xc,%esp
+  804215:	6a 05                	push   $0x5
+  804217:	68 00 00 40 00       	push   $0x400000
+  80421c:	6a 00                	push   $0x0
+  80421e:	57                   	push   %edi
+  80421f:	56                   	push   %esi
+  804220:	e8 21 cb ff ff       	call   800d46 <sys_page_map>
+  804225:	89 c3                	mov    %eax,%ebx
+  804227:	83 c4 20             	add    $0x20,%esp
+  80422a:	85 c0                	test   %eax,%eax
+  80422c:	79 35                	jns    804263 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  80422e:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804231:	75 1b                	jne    80424e <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  804233:	83 ec 08             	sub    $0x8,%esp
+  804236:	68 00 00 40 00       	push   $0x400000
+  80423b:	6a 00                	push   $0x0
+  80423d:	e8 f7 f5 ff ff       	call   803839 <page_out>
+  804242:	83 c4 10             	add    $0x10,%esp
+  804245:	85 c0                	test   %eax,%eax
+  804247:	79 c9                	jns    804212 <page_map+0xf8>
+  804249:	e9 56 ff ff ff       	jmp    8041a4 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  80424e:	53                   	push   %ebx
+  80424f:	68 fc 5c 80 00       	push   $0x805cfc
+  804254:	68 83 03 00 00       	push   $0x383
+  804259:	68 9a 58 80 00       	push   $0x80589a
+  80425e:	e8 eb be ff ff       	call   80014e <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  804263:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804266:	c1 e8 0c             	shr    $0xc,%eax
+  804269:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  80426e:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  804275:	01 
+  804276:	0f 84 8d 00 00 00    	je     804309 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  80427c:	83 ec 08             	sub    $0x8,%esp
+  80427f:	68 00 00 40 00       	push   $0x400000
+  804284:	6a 00                	push   $0x0
+  804286:	e8 fd ca ff ff       	call   800d88 <sys_page_unmap>
+  80428b:	83 c4 10             	add    $0x10,%esp
+  80428e:	85 c0                	test   %eax,%eax
+  804290:	78 36                	js     8042c8 <page_map+0x1ae>
+  804292:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  804295:	83 ec 08             	sub    $0x8,%esp
+  804298:	57                   	push   %edi
+  804299:	56                   	push   %esi
+  80429a:	e8 4a fc ff ff       	call   803ee9 <page_in>
+  80429f:	89 c3                	mov    %eax,%ebx
+  8042a1:	83 c4 10             	add    $0x10,%esp
+  8042a4:	85 c0                	test   %eax,%eax
+  8042a6:	0f 89 7a fe ff ff    	jns    804126 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  8042ac:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8042af:	75 2c                	jne    8042dd <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  8042b1:	83 ec 08             	sub    $0x8,%esp
+  8042b4:	57                   	push   %edi
+  8042b5:	6a 00                	push   $0x0
+  8042b7:	e8 7d f5 ff ff       	call   803839 <page_out>
+  8042bc:	83 c4 10             	add    $0x10,%esp
+  8042bf:	85 c0                	test   %eax,%eax
+  8042c1:	79 d2                	jns    804295 <page_map+0x17b>
+  8042c3:	e9 dc fe ff ff       	jmp    8041a4 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  8042c8:	50                   	push   %eax
+  8042c9:	68 28 5d 80 00       	push   $0x805d28
+  8042ce:	68 8b 03 00 00       	push   $0x38b
+  8042d3:	68 9a 58 80 00       	push   $0x80589a
+  8042d8:	e8 71 be ff ff       	call   80014e <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  8042dd:	53                   	push   %ebx
+  8042de:	68 50 5d 80 00       	push   $0x805d50
+  8042e3:	68 91 03 00 00       	push   $0x391
+  8042e8:	68 9a 58 80 00       	push   $0x80589a
+  8042ed:	e8 5c be ff ff       	call   80014e <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8042f2:	89 c3                	mov    %eax,%ebx
+  8042f4:	e9 ab fe ff ff       	jmp    8041a4 <page_map+0x8a>
+  8042f9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8042fc:	e9 a3 fe ff ff       	jmp    8041a4 <page_map+0x8a>
+			return r; // Pass through the error
+  804301:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804304:	e9 9b fe ff ff       	jmp    8041a4 <page_map+0x8a>
+			return r; // Pass through the error
+  804309:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80430c:	e9 93 fe ff ff       	jmp    8041a4 <page_map+0x8a>
+
+00804311 <page_map_range>:
+{
+  804311:	55                   	push   %ebp
+  804312:	89 e5                	mov    %esp,%ebp
+  804314:	57                   	push   %edi
+  804315:	56                   	push   %esi
+  804316:	53                   	push   %ebx
+  804317:	83 ec 0c             	sub    $0xc,%esp
+  80431a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80431d:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  804320:	83 ec 08             	sub    $0x8,%esp
+  804323:	ff 75 1c             	push   0x1c(%ebp)
+  804326:	ff 75 18             	push   0x18(%ebp)
+  804329:	56                   	push   %esi
+  80432a:	ff 75 10             	push   0x10(%ebp)
+  80432d:	57                   	push   %edi
+  80432e:	ff 75 08             	push   0x8(%ebp)
+  804331:	e8 1b cb ff ff       	call   800e51 <sys_page_map_range>
+  804336:	89 c3                	mov    %eax,%ebx
+  804338:	83 c4 20             	add    $0x20,%esp
+  80433b:	85 c0                	test   %eax,%eax
+  80433d:	79 1b                	jns    80435a <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  80433f:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804342:	75 20                	jne    804364 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  804344:	83 ec 08             	sub    $0x8,%esp
+  804347:	68 00 00 40 00       	push   $0x400000
+  80434c:	6a 00                	push   $0x0
+  80434e:	e8 e6 f4 ff ff       	call   803839 <page_out>
+  804353:	83 c4 10             	add    $0x10,%esp
+  804356:	85 c0                	test   %eax,%eax
+  804358:	79 c6                	jns    804320 <page_map_range+0xf>
+}
+  80435a:	89 d8                	mov    %ebx,%eax
+  80435c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80435f:	5b                   	pop    %ebx
+  804360:	5e                   	pop    %esi
+  804361:	5f                   	pop    %edi
+  804362:	5d                   	pop    %ebp
+  804363:	c3                   	ret
+		if (r != -E_INVAL)
+  804364:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  804367:	75 f1                	jne    80435a <page_map_range+0x49>
+  804369:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  80436b:	be 00 00 00 00       	mov    $0x0,%esi
+  804370:	eb 03                	jmp    804375 <page_map_range+0x64>
+  804372:	83 c6 01             	add    $0x1,%esi
+  804375:	3b 75 18             	cmp    0x18(%ebp),%esi
+  804378:	74 2a                	je     8043a4 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  80437a:	83 ec 0c             	sub    $0xc,%esp
+  80437d:	ff 75 1c             	push   0x1c(%ebp)
+  804380:	53                   	push   %ebx
+  804381:	ff 75 10             	push   0x10(%ebp)
+  804384:	57                   	push   %edi
+  804385:	ff 75 08             	push   0x8(%ebp)
+  804388:	e8 8d fd ff ff       	call   80411a <page_map>
+  80438d:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804393:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  804399:	83 c4 20             	add    $0x20,%esp
+  80439c:	85 c0                	test   %eax,%eax
+  80439e:	79 d2                	jns    804372 <page_map_range+0x61>
+  8043a0:	89 c3                	mov    %eax,%ebx
+  8043a2:	eb b6                	jmp    80435a <page_map_range+0x49>
+		return 0;
+  8043a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8043a9:	eb af                	jmp    80435a <page_map_range+0x49>
+
+008043ab <paging_pgfault_handler>:
+{
+  8043ab:	55                   	push   %ebp
+  8043ac:	89 e5                	mov    %esp,%ebp
+  8043ae:	56                   	push   %esi
+  8043af:	53                   	push   %ebx
+  8043b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  8043b3:	e8 6f e7 ff ff       	call   802b27 <find_paging_env>
+	if (pagingenv == 0)
+  8043b8:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  8043bd:	85 c0                	test   %eax,%eax
+  8043bf:	74 3c                	je     8043fd <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  8043c1:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  8043c3:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8043c7:	75 12                	jne    8043db <paging_pgfault_handler+0x30>
+  8043c9:	89 f0                	mov    %esi,%eax
+  8043cb:	e8 7e f7 ff ff       	call   803b4e <page_adopt>
+  8043d0:	89 c2                	mov    %eax,%edx
+		return 0;
+  8043d2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  8043d7:	85 d2                	test   %edx,%edx
+  8043d9:	78 22                	js     8043fd <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  8043db:	83 ec 08             	sub    $0x8,%esp
+  8043de:	6a 00                	push   $0x0
+  8043e0:	56                   	push   %esi
+  8043e1:	e8 a9 f3 ff ff       	call   80378f <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  8043e6:	83 c4 10             	add    $0x10,%esp
+  8043e9:	85 c0                	test   %eax,%eax
+  8043eb:	74 05                	je     8043f2 <paging_pgfault_handler+0x47>
+  8043ed:	f6 00 01             	testb  $0x1,(%eax)
+  8043f0:	75 12                	jne    804404 <paging_pgfault_handler+0x59>
+	return 0;
+  8043f2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8043f7:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8043fb:	74 23                	je     804420 <paging_pgfault_handler+0x75>
+}
+  8043fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804400:	5b                   	pop    %ebx
+  804401:	5e                   	pop    %esi
+  804402:	5d                   	pop    %ebp
+  804403:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  804404:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  804409:	8b 40 48             	mov    0x48(%eax),%eax
+  80440c:	83 ec 08             	sub    $0x8,%esp
+  80440f:	56                   	push   %esi
+  804410:	50                   	push   %eax
+  804411:	e8 d3 fa ff ff       	call   803ee9 <page_in>
+  804416:	f7 d0                	not    %eax
+  804418:	c1 e8 1f             	shr    $0x1f,%eax
+  80441b:	83 c4 10             	add    $0x10,%esp
+  80441e:	eb dd                	jmp    8043fd <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804420:	89 f0                	mov    %esi,%eax
+  804422:	e8 97 e2 ff ff       	call   8026be <segment_lookup>
+  804427:	89 c2                	mov    %eax,%edx
+	return 0;
+  804429:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  80442e:	85 d2                	test   %edx,%edx
+  804430:	74 cb                	je     8043fd <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  804432:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  804437:	8b 40 48             	mov    0x48(%eax),%eax
+  80443a:	83 ec 08             	sub    $0x8,%esp
+  80443d:	56                   	push   %esi
+  80443e:	50                   	push   %eax
+  80443f:	e8 f5 f3 ff ff       	call   803839 <page_out>
+  804444:	f7 d0                	not    %eax
+  804446:	c1 e8 1f             	shr    $0x1f,%eax
+  804449:	83 c4 10             	add    $0x10,%esp
+  80444c:	eb af                	jmp    8043fd <paging_pgfault_handler+0x52>
+
+0080444e <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  80444e:	55                   	push   %ebp
+  80444f:	89 e5                	mov    %esp,%ebp
+  804451:	57                   	push   %edi
+  804452:	56                   	push   %esi
+  804453:	53                   	push   %ebx
+  804454:	83 ec 2c             	sub    $0x2c,%esp
+  804457:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  80445a:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  80445f:	89 c1                	mov    %eax,%ecx
+  804461:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  804464:	c1 e8 11             	shr    $0x11,%eax
+  804467:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80446a:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  804471:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  804474:	b8 01 00 00 00       	mov    $0x1,%eax
+  804479:	d3 e0                	shl    %cl,%eax
+  80447b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80447e:	85 c7                	test   %eax,%edi
+  804480:	74 12                	je     804494 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804482:	bb 01 00 00 00       	mov    $0x1,%ebx
+  804487:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  80448a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80448f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804492:	eb 17                	jmp    8044ab <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  804494:	ff 75 e0             	push   -0x20(%ebp)
+  804497:	68 88 5d 80 00       	push   $0x805d88
+  80449c:	6a 48                	push   $0x48
+  80449e:	68 a2 5d 80 00       	push   $0x805da2
+  8044a3:	e8 a6 bc ff ff       	call   80014e <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  8044a8:	83 c3 01             	add    $0x1,%ebx
+  8044ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8044ae:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  8044b1:	89 c8                	mov    %ecx,%eax
+  8044b3:	c1 e8 05             	shr    $0x5,%eax
+  8044b6:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  8044bd:	89 fe                	mov    %edi,%esi
+  8044bf:	d3 e6                	shl    %cl,%esi
+  8044c1:	89 f1                	mov    %esi,%ecx
+  8044c3:	85 d6                	test   %edx,%esi
+  8044c5:	74 e1                	je     8044a8 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  8044c7:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  8044ca:	f7 d6                	not    %esi
+  8044cc:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8044cf:	21 fe                	and    %edi,%esi
+  8044d1:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8044d4:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  8044db:	f7 d1                	not    %ecx
+  8044dd:	21 d1                	and    %edx,%ecx
+  8044df:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  8044e6:	83 ec 04             	sub    $0x4,%esp
+  8044e9:	53                   	push   %ebx
+  8044ea:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8044ed:	57                   	push   %edi
+  8044ee:	6a 00                	push   $0x0
+  8044f0:	e8 97 f8 ff ff       	call   803d8c <page_unmap_range>
+	va_free(va, n);
+  8044f5:	83 c4 08             	add    $0x8,%esp
+  8044f8:	53                   	push   %ebx
+  8044f9:	57                   	push   %edi
+  8044fa:	e8 ed 05 00 00       	call   804aec <va_free>
+}
+  8044ff:	83 c4 10             	add    $0x10,%esp
+  804502:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804505:	5b                   	pop    %ebx
+  804506:	5e                   	pop    %esi
+  804507:	5f                   	pop    %edi
+  804508:	5d                   	pop    %ebp
+  804509:	c3                   	ret
+
+0080450a <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  80450a:	55                   	push   %ebp
+  80450b:	89 e5                	mov    %esp,%ebp
+  80450d:	57                   	push   %edi
+  80450e:	56                   	push   %esi
+  80450f:	53                   	push   %ebx
+  804510:	83 ec 1c             	sub    $0x1c,%esp
+  804513:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804516:	85 db                	test   %ebx,%ebx
+  804518:	74 34                	je     80454e <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  80451a:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  804520:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  804525:	77 2f                	ja     804556 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  804527:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80452d:	75 51                	jne    804580 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  80452f:	89 c1                	mov    %eax,%ecx
+  804531:	c1 e9 0c             	shr    $0xc,%ecx
+  804534:	ba 01 00 00 00       	mov    $0x1,%edx
+  804539:	d3 e2                	shl    %cl,%edx
+  80453b:	c1 e8 11             	shr    $0x11,%eax
+  80453e:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  804545:	75 24                	jne    80456b <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  804547:	89 d8                	mov    %ebx,%eax
+  804549:	e8 00 ff ff ff       	call   80444e <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  80454e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804551:	5b                   	pop    %ebx
+  804552:	5e                   	pop    %esi
+  804553:	5f                   	pop    %edi
+  804554:	5d                   	pop    %ebp
+  804555:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  804556:	53                   	push   %ebx
+  804557:	68 af 5d 80 00       	push   $0x805daf
+  80455c:	68 a2 00 00 00       	push   $0xa2
+  804561:	68 a2 5d 80 00       	push   $0x805da2
+  804566:	e8 e3 bb ff ff       	call   80014e <_panic>
+			panic("free: %p is not allocated", va);
+  80456b:	53                   	push   %ebx
+  80456c:	68 88 5d 80 00       	push   $0x805d88
+  804571:	68 a5 00 00 00       	push   $0xa5
+  804576:	68 a2 5d 80 00       	push   $0x805da2
+  80457b:	e8 ce bb ff ff       	call   80014e <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  804580:	89 de                	mov    %ebx,%esi
+  804582:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  804588:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  80458e:	89 c8                	mov    %ecx,%eax
+  804590:	c1 e8 11             	shr    $0x11,%eax
+  804593:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804596:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  80459d:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8045a0:	c1 e9 0c             	shr    $0xc,%ecx
+  8045a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8045a8:	d3 e0                	shl    %cl,%eax
+  8045aa:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8045ad:	85 c7                	test   %eax,%edi
+  8045af:	74 1b                	je     8045cc <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  8045b1:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8045b5:	89 d8                	mov    %ebx,%eax
+  8045b7:	29 f0                	sub    %esi,%eax
+  8045b9:	83 e8 10             	sub    $0x10,%eax
+  8045bc:	99                   	cltd
+  8045bd:	f7 ff                	idiv   %edi
+  8045bf:	89 d1                	mov    %edx,%ecx
+  8045c1:	85 d2                	test   %edx,%edx
+  8045c3:	75 07                	jne    8045cc <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8045c5:	ba 10 00 00 00       	mov    $0x10,%edx
+  8045ca:	eb 18                	jmp    8045e4 <free+0xda>
+		panic("free: %p is not allocated", va);
+  8045cc:	53                   	push   %ebx
+  8045cd:	68 88 5d 80 00       	push   $0x805d88
+  8045d2:	68 ad 00 00 00       	push   $0xad
+  8045d7:	68 a2 5d 80 00       	push   $0x805da2
+  8045dc:	e8 6d bb ff ff       	call   80014e <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8045e1:	83 c1 01             	add    $0x1,%ecx
+  8045e4:	89 d0                	mov    %edx,%eax
+  8045e6:	d3 e0                	shl    %cl,%eax
+  8045e8:	39 c7                	cmp    %eax,%edi
+  8045ea:	7f f5                	jg     8045e1 <free+0xd7>
+	*(void **) va = s->free;
+  8045ec:	8b 46 08             	mov    0x8(%esi),%eax
+  8045ef:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  8045f1:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  8045f4:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  8045f8:	8d 58 01             	lea    0x1(%eax),%ebx
+  8045fb:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  8045ff:	66 85 c0             	test   %ax,%ax
+  804602:	74 52                	je     804656 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804604:	0f b7 db             	movzwl %bx,%ebx
+  804607:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  80460b:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804610:	ba 00 00 00 00       	mov    $0x0,%edx
+  804615:	f7 ff                	idiv   %edi
+  804617:	39 c3                	cmp    %eax,%ebx
+  804619:	0f 85 2f ff ff ff    	jne    80454e <free+0x44>
+  80461f:	8b 46 04             	mov    0x4(%esi),%eax
+  804622:	85 c0                	test   %eax,%eax
+  804624:	74 53                	je     804679 <free+0x16f>
+		s->prev->next = s->next;
+  804626:	8b 16                	mov    (%esi),%edx
+  804628:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  80462a:	8b 06                	mov    (%esi),%eax
+  80462c:	85 c0                	test   %eax,%eax
+  80462e:	74 06                	je     804636 <free+0x12c>
+		s->next->prev = s->prev;
+  804630:	8b 56 04             	mov    0x4(%esi),%edx
+  804633:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804636:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804639:	f7 d0                	not    %eax
+  80463b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80463e:	21 d0                	and    %edx,%eax
+  804640:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  804643:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  80464a:	89 f0                	mov    %esi,%eax
+  80464c:	e8 fd fd ff ff       	call   80444e <heap_free_pages>
+  804651:	e9 f8 fe ff ff       	jmp    80454e <free+0x44>
+	s->prev = NULL;
+  804656:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  80465d:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  804664:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  804666:	85 c0                	test   %eax,%eax
+  804668:	74 03                	je     80466d <free+0x163>
+		slabs[c]->prev = s;
+  80466a:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  80466d:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  804674:	e9 d5 fe ff ff       	jmp    80454e <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804679:	8b 06                	mov    (%esi),%eax
+  80467b:	85 c0                	test   %eax,%eax
+  80467d:	0f 84 cb fe ff ff    	je     80454e <free+0x44>
+		slabs[c] = s->next;
+  804683:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  80468a:	8b 06                	mov    (%esi),%eax
+  80468c:	eb a2                	jmp    804630 <free+0x126>
+
+0080468e <heap_alloc_pages>:
+{
+  80468e:	55                   	push   %ebp
+  80468f:	89 e5                	mov    %esp,%ebp
+  804691:	57                   	push   %edi
+  804692:	56                   	push   %esi
+  804693:	53                   	push   %ebx
+  804694:	83 ec 18             	sub    $0x18,%esp
+  804697:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  804699:	50                   	push   %eax
+  80469a:	e8 15 03 00 00       	call   8049b4 <va_alloc>
+  80469f:	89 c3                	mov    %eax,%ebx
+  8046a1:	83 c4 10             	add    $0x10,%esp
+  8046a4:	85 c0                	test   %eax,%eax
+  8046a6:	74 47                	je     8046ef <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8046a8:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  8046ae:	89 c1                	mov    %eax,%ecx
+  8046b0:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  8046b3:	c1 e8 11             	shr    $0x11,%eax
+  8046b6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8046bb:	89 d7                	mov    %edx,%edi
+  8046bd:	d3 e7                	shl    %cl,%edi
+  8046bf:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  8046c6:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  8046ca:	89 c8                	mov    %ecx,%eax
+  8046cc:	c1 e8 05             	shr    $0x5,%eax
+  8046cf:	d3 e2                	shl    %cl,%edx
+  8046d1:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  8046d8:	83 ec 0c             	sub    $0xc,%esp
+  8046db:	6a 00                	push   $0x0
+  8046dd:	6a 07                	push   $0x7
+  8046df:	56                   	push   %esi
+  8046e0:	53                   	push   %ebx
+  8046e1:	6a 00                	push   $0x0
+  8046e3:	e8 3a f7 ff ff       	call   803e22 <page_alloc_range>
+  8046e8:	83 c4 20             	add    $0x20,%esp
+  8046eb:	85 c0                	test   %eax,%eax
+  8046ed:	78 0a                	js     8046f9 <heap_alloc_pages+0x6b>
+}
+  8046ef:	89 d8                	mov    %ebx,%eax
+  8046f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046f4:	5b                   	pop    %ebx
+  8046f5:	5e                   	pop    %esi
+  8046f6:	5f                   	pop    %edi
+  8046f7:	5d                   	pop    %ebp
+  8046f8:	c3                   	ret
+		free(va);
+  8046f9:	83 ec 0c             	sub    $0xc,%esp
+  8046fc:	53                   	push   %ebx
+  8046fd:	e8 08 fe ff ff       	call   80450a <free>
+		return NULL;
+  804702:	83 c4 10             	add    $0x10,%esp
+  804705:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80470a:	eb e3                	jmp    8046ef <heap_alloc_pages+0x61>
+
+0080470c <malloc>:
+{
+  80470c:	55                   	push   %ebp
+  80470d:	89 e5                	mov    %esp,%ebp
+  80470f:	57                   	push   %edi
+  804710:	56                   	push   %esi
+  804711:	53                   	push   %ebx
+  804712:	83 ec 1c             	sub    $0x1c,%esp
+  804715:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804718:	8d 50 ff             	lea    -0x1(%eax),%edx
+  80471b:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  804721:	0f 87 21 01 00 00    	ja     804848 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804727:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80472c:	ba 10 00 00 00       	mov    $0x10,%edx
+  804731:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  804733:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804738:	76 15                	jbe    80474f <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  80473a:	05 ff 0f 00 00       	add    $0xfff,%eax
+  80473f:	c1 e8 0c             	shr    $0xc,%eax
+  804742:	e8 47 ff ff ff       	call   80468e <heap_alloc_pages>
+  804747:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80474a:	eb 37                	jmp    804783 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  80474c:	83 c1 01             	add    $0x1,%ecx
+  80474f:	89 d6                	mov    %edx,%esi
+  804751:	d3 e6                	shl    %cl,%esi
+  804753:	39 c6                	cmp    %eax,%esi
+  804755:	72 f5                	jb     80474c <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804757:	89 cb                	mov    %ecx,%ebx
+  804759:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  804760:	85 ff                	test   %edi,%edi
+  804762:	74 2a                	je     80478e <malloc+0x82>
+	v = s->free;
+  804764:	8b 47 08             	mov    0x8(%edi),%eax
+  804767:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  80476a:	8b 00                	mov    (%eax),%eax
+  80476c:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  80476f:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  804773:	83 e8 01             	sub    $0x1,%eax
+  804776:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  80477a:	66 85 c0             	test   %ax,%ax
+  80477d:	0f 84 9a 00 00 00    	je     80481d <malloc+0x111>
+}
+  804783:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804786:	83 c4 1c             	add    $0x1c,%esp
+  804789:	5b                   	pop    %ebx
+  80478a:	5e                   	pop    %esi
+  80478b:	5f                   	pop    %edi
+  80478c:	5d                   	pop    %ebp
+  80478d:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  80478e:	b8 01 00 00 00       	mov    $0x1,%eax
+  804793:	e8 f6 fe ff ff       	call   80468e <heap_alloc_pages>
+  804798:	89 c1                	mov    %eax,%ecx
+  80479a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80479d:	85 c0                	test   %eax,%eax
+  80479f:	74 e2                	je     804783 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8047a1:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  8047a7:	89 c8                	mov    %ecx,%eax
+  8047a9:	c1 e8 11             	shr    $0x11,%eax
+  8047ac:	c1 e9 0c             	shr    $0xc,%ecx
+  8047af:	ba 01 00 00 00       	mov    $0x1,%edx
+  8047b4:	d3 e2                	shl    %cl,%edx
+  8047b6:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  8047bd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8047c0:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  8047c4:	0f b7 f6             	movzwl %si,%esi
+  8047c7:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8047cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047d1:	f7 fe                	idiv   %esi
+  8047d3:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  8047d7:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  8047da:	85 c0                	test   %eax,%eax
+  8047dc:	74 14                	je     8047f2 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  8047de:	83 e8 01             	sub    $0x1,%eax
+  8047e1:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  8047e5:	0f af d0             	imul   %eax,%edx
+  8047e8:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  8047ec:	89 3a                	mov    %edi,(%edx)
+  8047ee:	89 d7                	mov    %edx,%edi
+  8047f0:	eb e5                	jmp    8047d7 <malloc+0xcb>
+	s->prev = NULL;
+  8047f2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8047f5:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  8047fc:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  804803:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804805:	85 c0                	test   %eax,%eax
+  804807:	74 03                	je     80480c <malloc+0x100>
+		slabs[c]->prev = s;
+  804809:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  80480c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80480f:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  804816:	89 c7                	mov    %eax,%edi
+  804818:	e9 47 ff ff ff       	jmp    804764 <malloc+0x58>
+	if (s->prev)
+  80481d:	8b 47 04             	mov    0x4(%edi),%eax
+  804820:	85 c0                	test   %eax,%eax
+  804822:	74 19                	je     80483d <malloc+0x131>
+		s->prev->next = s->next;
+  804824:	8b 17                	mov    (%edi),%edx
+  804826:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804828:	8b 07                	mov    (%edi),%eax
+  80482a:	85 c0                	test   %eax,%eax
+  80482c:	0f 84 51 ff ff ff    	je     804783 <malloc+0x77>
+		s->next->prev = s->prev;
+  804832:	8b 57 04             	mov    0x4(%edi),%edx
+  804835:	89 50 04             	mov    %edx,0x4(%eax)
+  804838:	e9 46 ff ff ff       	jmp    804783 <malloc+0x77>
+		slabs[c] = s->next;
+  80483d:	8b 07                	mov    (%edi),%eax
+  80483f:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  804846:	eb e0                	jmp    804828 <malloc+0x11c>
+		return NULL;
+  804848:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80484f:	e9 2f ff ff ff       	jmp    804783 <malloc+0x77>
+
+00804854 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804854:	55                   	push   %ebp
+  804855:	89 e5                	mov    %esp,%ebp
+  804857:	57                   	push   %edi
+  804858:	56                   	push   %esi
+  804859:	53                   	push   %ebx
+  80485a:	83 ec 0c             	sub    $0xc,%esp
+  80485d:	89 c6                	mov    %eax,%esi
+  80485f:	89 d7                	mov    %edx,%edi
+  804861:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804864:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804869:	ba 00 00 00 00       	mov    $0x0,%edx
+  80486e:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  804873:	83 ef 01             	sub    $0x1,%edi
+  804876:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804879:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  80487c:	eb 34                	jmp    8048b2 <va_chunk_scan+0x5e>
+			i += 31;
+  80487e:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  804881:	89 ca                	mov    %ecx,%edx
+			continue;
+  804883:	eb 23                	jmp    8048a8 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804885:	89 c7                	mov    %eax,%edi
+  804887:	c1 ef 05             	shr    $0x5,%edi
+  80488a:	be 01 00 00 00       	mov    $0x1,%esi
+  80488f:	d3 e6                	shl    %cl,%esi
+  804891:	89 f1                	mov    %esi,%ecx
+  804893:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804896:	23 0c be             	and    (%esi,%edi,4),%ecx
+  804899:	75 41                	jne    8048dc <va_chunk_scan+0x88>
+			len++;
+  80489b:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  80489e:	39 d3                	cmp    %edx,%ebx
+  8048a0:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  8048a3:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  8048a6:	72 2d                	jb     8048d5 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8048a8:	83 c0 01             	add    $0x1,%eax
+  8048ab:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8048b0:	77 31                	ja     8048e3 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  8048b2:	89 c1                	mov    %eax,%ecx
+  8048b4:	83 e1 1f             	and    $0x1f,%ecx
+  8048b7:	75 cc                	jne    804885 <va_chunk_scan+0x31>
+  8048b9:	89 c7                	mov    %eax,%edi
+  8048bb:	c1 ef 05             	shr    $0x5,%edi
+  8048be:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8048c1:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  8048c4:	83 ff ff             	cmp    $0xffffffff,%edi
+  8048c7:	74 b5                	je     80487e <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  8048c9:	85 ff                	test   %edi,%edi
+  8048cb:	75 b8                	jne    804885 <va_chunk_scan+0x31>
+			i += 31;
+  8048cd:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  8048d0:	83 c2 20             	add    $0x20,%edx
+  8048d3:	eb c9                	jmp    80489e <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  8048d5:	83 c0 01             	add    $0x1,%eax
+  8048d8:	29 d0                	sub    %edx,%eax
+  8048da:	eb 15                	jmp    8048f1 <va_chunk_scan+0x9d>
+			len = 0;
+  8048dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048e1:	eb c5                	jmp    8048a8 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  8048e3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  8048e8:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  8048eb:	85 d2                	test   %edx,%edx
+  8048ed:	74 02                	je     8048f1 <va_chunk_scan+0x9d>
+		*run_store = best;
+  8048ef:	89 1a                	mov    %ebx,(%edx)
+}
+  8048f1:	83 c4 0c             	add    $0xc,%esp
+  8048f4:	5b                   	pop    %ebx
+  8048f5:	5e                   	pop    %esi
+  8048f6:	5f                   	pop    %edi
+  8048f7:	5d                   	pop    %ebp
+  8048f8:	c3                   	ret
+
+008048f9 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  8048f9:	55                   	push   %ebp
+  8048fa:	89 e5                	mov    %esp,%ebp
+  8048fc:	57                   	push   %edi
+  8048fd:	56                   	push   %esi
+  8048fe:	53                   	push   %ebx
+  8048ff:	83 ec 14             	sub    $0x14,%esp
+  804902:	89 c3                	mov    %eax,%ebx
+  804904:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804906:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  80490c:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  804912:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804915:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804918:	89 d6                	mov    %edx,%esi
+  80491a:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  804920:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804922:	eb 34                	jmp    804958 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804924:	89 c8                	mov    %ecx,%eax
+  804926:	c1 e8 05             	shr    $0x5,%eax
+  804929:	89 da                	mov    %ebx,%edx
+  80492b:	c1 e2 05             	shl    $0x5,%edx
+  80492e:	01 da                	add    %ebx,%edx
+  804930:	01 c2                	add    %eax,%edx
+  804932:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804937:	d3 c0                	rol    %cl,%eax
+  804939:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804940:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804947:	b8 01 00 00 00       	mov    $0x1,%eax
+  80494c:	01 d0                	add    %edx,%eax
+  80494e:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804955:	83 c1 01             	add    $0x1,%ecx
+  804958:	39 f9                	cmp    %edi,%ecx
+  80495a:	74 30                	je     80498c <va_chunk_mark+0x93>
+		if (alloc)
+  80495c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804960:	74 c2                	je     804924 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804962:	89 c8                	mov    %ecx,%eax
+  804964:	c1 e8 05             	shr    $0x5,%eax
+  804967:	89 da                	mov    %ebx,%edx
+  804969:	c1 e2 05             	shl    $0x5,%edx
+  80496c:	01 da                	add    %ebx,%edx
+  80496e:	01 c2                	add    %eax,%edx
+  804970:	b8 01 00 00 00       	mov    $0x1,%eax
+  804975:	d3 e0                	shl    %cl,%eax
+  804977:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  80497e:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804985:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80498a:	eb c0                	jmp    80494c <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  80498c:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  80498f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804994:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804997:	e8 b8 fe ff ff       	call   804854 <va_chunk_scan>
+	ch->run = run;
+  80499c:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  8049a2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8049a5:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  8049ac:	83 c4 14             	add    $0x14,%esp
+  8049af:	5b                   	pop    %ebx
+  8049b0:	5e                   	pop    %esi
+  8049b1:	5f                   	pop    %edi
+  8049b2:	5d                   	pop    %ebp
+  8049b3:	c3                   	ret
+
+008049b4 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  8049b4:	55                   	push   %ebp
+  8049b5:	89 e5                	mov    %esp,%ebp
+  8049b7:	57                   	push   %edi
+  8049b8:	56                   	push   %esi
+  8049b9:	53                   	push   %ebx
+  8049ba:	83 ec 04             	sub    $0x4,%esp
+  8049bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  8049c0:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  8049c5:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  8049ca:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  8049d1:	74 4f                	je     804a22 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  8049d3:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8049d6:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  8049db:	0f 87 01 01 00 00    	ja     804ae2 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  8049e1:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  8049e7:	0f 87 80 00 00 00    	ja     804a6d <va_alloc+0xb9>
+  8049ed:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  8049f2:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  8049f7:	0f b7 10             	movzwl (%eax),%edx
+  8049fa:	05 84 00 00 00       	add    $0x84,%eax
+  8049ff:	39 da                	cmp    %ebx,%edx
+  804a01:	73 2c                	jae    804a2f <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804a03:	83 c6 01             	add    $0x1,%esi
+  804a06:	83 fe 1c             	cmp    $0x1c,%esi
+  804a09:	75 ec                	jne    8049f7 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804a0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a10:	eb 53                	jmp    804a65 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804a12:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804a18:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804a1d:	05 84 00 00 00       	add    $0x84,%eax
+  804a22:	39 d0                	cmp    %edx,%eax
+  804a24:	75 ec                	jne    804a12 <va_alloc+0x5e>
+	va_inited = 1;
+  804a26:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  804a2d:	eb a4                	jmp    8049d3 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804a2f:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804a35:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  804a3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804a3f:	89 da                	mov    %ebx,%edx
+  804a41:	e8 0e fe ff ff       	call   804854 <va_chunk_scan>
+  804a46:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804a48:	6a 01                	push   $0x1
+  804a4a:	89 d9                	mov    %ebx,%ecx
+  804a4c:	89 c2                	mov    %eax,%edx
+  804a4e:	89 f0                	mov    %esi,%eax
+  804a50:	e8 a4 fe ff ff       	call   8048f9 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804a55:	c1 e6 16             	shl    $0x16,%esi
+  804a58:	c1 e7 0c             	shl    $0xc,%edi
+  804a5b:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804a62:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804a65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a68:	5b                   	pop    %ebx
+  804a69:	5e                   	pop    %esi
+  804a6a:	5f                   	pop    %edi
+  804a6b:	5d                   	pop    %ebp
+  804a6c:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804a6d:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804a73:	c1 ee 0a             	shr    $0xa,%esi
+  804a76:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a80:	eb 0a                	jmp    804a8c <va_alloc+0xd8>
+			first = c + 1;
+  804a82:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804a84:	83 c2 01             	add    $0x1,%edx
+  804a87:	83 fa 1d             	cmp    $0x1d,%edx
+  804a8a:	74 4f                	je     804adb <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804a8c:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804a92:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  804a99:	00 04 
+  804a9b:	75 e5                	jne    804a82 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804a9d:	89 d1                	mov    %edx,%ecx
+  804a9f:	29 c1                	sub    %eax,%ecx
+  804aa1:	39 f1                	cmp    %esi,%ecx
+  804aa3:	75 df                	jne    804a84 <va_alloc+0xd0>
+  804aa5:	89 c7                	mov    %eax,%edi
+  804aa7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804aaa:	be 00 04 00 00       	mov    $0x400,%esi
+  804aaf:	39 f3                	cmp    %esi,%ebx
+  804ab1:	0f 46 f3             	cmovbe %ebx,%esi
+  804ab4:	6a 01                	push   $0x1
+  804ab6:	89 f1                	mov    %esi,%ecx
+  804ab8:	ba 00 00 00 00       	mov    $0x0,%edx
+  804abd:	89 f8                	mov    %edi,%eax
+  804abf:	e8 35 fe ff ff       	call   8048f9 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804ac4:	83 c7 01             	add    $0x1,%edi
+  804ac7:	83 c4 04             	add    $0x4,%esp
+  804aca:	29 f3                	sub    %esi,%ebx
+  804acc:	75 dc                	jne    804aaa <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804ace:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804ad1:	c1 e0 16             	shl    $0x16,%eax
+  804ad4:	05 00 00 00 08       	add    $0x8000000,%eax
+  804ad9:	eb 8a                	jmp    804a65 <va_alloc+0xb1>
+	return NULL;
+  804adb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ae0:	eb 83                	jmp    804a65 <va_alloc+0xb1>
+		return NULL;
+  804ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ae7:	e9 79 ff ff ff       	jmp    804a65 <va_alloc+0xb1>
+
+00804aec <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804aec:	55                   	push   %ebp
+  804aed:	89 e5                	mov    %esp,%ebp
+  804aef:	57                   	push   %edi
+  804af0:	56                   	push   %esi
+  804af1:	53                   	push   %ebx
+  804af2:	83 ec 0c             	sub    $0xc,%esp
+  804af5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804af8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804afb:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804b01:	76 21                	jbe    804b24 <va_free+0x38>
+  804b03:	89 f0                	mov    %esi,%eax
+  804b05:	c1 e0 0c             	shl    $0xc,%eax
+  804b08:	01 f8                	add    %edi,%eax
+  804b0a:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804b0f:	77 13                	ja     804b24 <va_free+0x38>
+	    || PGOFF(va))
+  804b11:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804b17:	75 0b                	jne    804b24 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804b19:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804b1f:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804b22:	eb 45                	jmp    804b69 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804b24:	83 ec 0c             	sub    $0xc,%esp
+  804b27:	56                   	push   %esi
+  804b28:	57                   	push   %edi
+  804b29:	68 cc 5d 80 00       	push   $0x805dcc
+  804b2e:	68 8e 00 00 00       	push   $0x8e
+  804b33:	68 ec 5d 80 00       	push   $0x805dec
+  804b38:	e8 11 b6 ff ff       	call   80014e <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804b3d:	89 fa                	mov    %edi,%edx
+  804b3f:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804b45:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804b4a:	29 d3                	sub    %edx,%ebx
+  804b4c:	39 f3                	cmp    %esi,%ebx
+  804b4e:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804b51:	89 f8                	mov    %edi,%eax
+  804b53:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804b56:	83 ec 0c             	sub    $0xc,%esp
+  804b59:	6a 00                	push   $0x0
+  804b5b:	89 d9                	mov    %ebx,%ecx
+  804b5d:	e8 97 fd ff ff       	call   8048f9 <va_chunk_mark>
+		i += n;
+  804b62:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804b64:	29 de                	sub    %ebx,%esi
+  804b66:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804b69:	85 f6                	test   %esi,%esi
+  804b6b:	75 d0                	jne    804b3d <va_free+0x51>
+	}
+}
+  804b6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b70:	5b                   	pop    %ebx
+  804b71:	5e                   	pop    %esi
+  804b72:	5f                   	pop    %edi
+  804b73:	5d                   	pop    %ebp
+  804b74:	c3                   	ret
+
+00804b75 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804b75:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b7a:	c3                   	ret
+
+00804b7b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804b7b:	55                   	push   %ebp
+  804b7c:	89 e5                	mov    %esp,%ebp
+  804b7e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804b81:	68 f9 5d 80 00       	push   $0x805df9
+  804b86:	ff 75 0c             	push   0xc(%ebp)
+  804b89:	e8 82 bc ff ff       	call   800810 <strcpy>
+	return 0;
+}
+  804b8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b93:	c9                   	leave
+  804b94:	c3                   	ret
+
+00804b95 <devcons_write>:
+{
+  804b95:	55                   	push   %ebp
+  804b96:	89 e5                	mov    %esp,%ebp
+  804b98:	57                   	push   %edi
+  804b99:	56                   	push   %esi
+  804b9a:	53                   	push   %ebx
+  804b9b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804ba1:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804ba6:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804bac:	eb 2e                	jmp    804bdc <devcons_write+0x47>
+		m = n - tot;
+  804bae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804bb1:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804bb3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804bb8:	39 c3                	cmp    %eax,%ebx
+  804bba:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804bbd:	83 ec 04             	sub    $0x4,%esp
+  804bc0:	53                   	push   %ebx
+  804bc1:	89 f0                	mov    %esi,%eax
+  804bc3:	03 45 0c             	add    0xc(%ebp),%eax
+  804bc6:	50                   	push   %eax
+  804bc7:	57                   	push   %edi
+  804bc8:	e8 c9 bd ff ff       	call   800996 <memmove>
+		sys_cputs(buf, m);
+  804bcd:	83 c4 08             	add    $0x8,%esp
+  804bd0:	53                   	push   %ebx
+  804bd1:	57                   	push   %edi
+  804bd2:	e8 5f c0 ff ff       	call   800c36 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804bd7:	01 de                	add    %ebx,%esi
+  804bd9:	83 c4 10             	add    $0x10,%esp
+  804bdc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804bdf:	72 cd                	jb     804bae <devcons_write+0x19>
+}
+  804be1:	89 f0                	mov    %esi,%eax
+  804be3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804be6:	5b                   	pop    %ebx
+  804be7:	5e                   	pop    %esi
+  804be8:	5f                   	pop    %edi
+  804be9:	5d                   	pop    %ebp
+  804bea:	c3                   	ret
+
+00804beb <devcons_read>:
+{
+  804beb:	55                   	push   %ebp
+  804bec:	89 e5                	mov    %esp,%ebp
+  804bee:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bf6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804bfa:	75 07                	jne    804c03 <devcons_read+0x18>
+  804bfc:	eb 1f                	jmp    804c1d <devcons_read+0x32>
+		sys_yield();
+  804bfe:	e8 e1 c0 ff ff       	call   800ce4 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804c03:	e8 5d c0 ff ff       	call   800c65 <sys_cgetc>
+  804c08:	85 c0                	test   %eax,%eax
+  804c0a:	74 f2                	je     804bfe <devcons_read+0x13>
+	if (c < 0)
+  804c0c:	78 0f                	js     804c1d <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804c0e:	83 f8 04             	cmp    $0x4,%eax
+  804c11:	74 0c                	je     804c1f <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804c13:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804c16:	88 02                	mov    %al,(%edx)
+	return 1;
+  804c18:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804c1d:	c9                   	leave
+  804c1e:	c3                   	ret
+		return 0;
+  804c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c24:	eb f7                	jmp    804c1d <devcons_read+0x32>
+
+00804c26 <cputchar>:
+{
+  804c26:	55                   	push   %ebp
+  804c27:	89 e5                	mov    %esp,%ebp
+  804c29:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804c2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  804c2f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804c32:	6a 01                	push   $0x1
+  804c34:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804c37:	50                   	push   %eax
+  804c38:	e8 f9 bf ff ff       	call   800c36 <sys_cputs>
+}
+  804c3d:	83 c4 10             	add    $0x10,%esp
+  804c40:	c9                   	leave
+  804c41:	c3                   	ret
+
+00804c42 <getchar>:
+{
+  804c42:	55                   	push   %ebp
+  804c43:	89 e5                	mov    %esp,%ebp
+  804c45:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804c48:	6a 01                	push   $0x1
+  804c4a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804c4d:	50                   	push   %eax
+  804c4e:	6a 00                	push   $0x0
+  804c50:	e8 d7 ce ff ff       	call   801b2c <read>
+	if (r < 0)
+  804c55:	83 c4 10             	add    $0x10,%esp
+  804c58:	85 c0                	test   %eax,%eax
+  804c5a:	78 06                	js     804c62 <getchar+0x20>
+	if (r < 1)
+  804c5c:	74 06                	je     804c64 <getchar+0x22>
+	return c;
+  804c5e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804c62:	c9                   	leave
+  804c63:	c3                   	ret
+		return -E_EOF;
+  804c64:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804c69:	eb f7                	jmp    804c62 <getchar+0x20>
+
+00804c6b <iscons>:
+{
+  804c6b:	55                   	push   %ebp
+  804c6c:	89 e5                	mov    %esp,%ebp
+  804c6e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804c71:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804c74:	50                   	push   %eax
+  804c75:	ff 75 08             	push   0x8(%ebp)
+  804c78:	e8 50 cc ff ff       	call   8018cd <fd_lookup>
+  804c7d:	83 c4 10             	add    $0x10,%esp
+  804c80:	85 c0                	test   %eax,%eax
+  804c82:	78 11                	js     804c95 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804c84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804c87:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804c8d:	39 10                	cmp    %edx,(%eax)
+  804c8f:	0f 94 c0             	sete   %al
+  804c92:	0f b6 c0             	movzbl %al,%eax
+}
+  804c95:	c9                   	leave
+  804c96:	c3                   	ret
+
+00804c97 <opencons>:
+{
+  804c97:	55                   	push   %ebp
+  804c98:	89 e5                	mov    %esp,%ebp
+  804c9a:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804c9d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804ca0:	50                   	push   %eax
+  804ca1:	e8 d3 cb ff ff       	call   801879 <fd_alloc>
+  804ca6:	83 c4 10             	add    $0x10,%esp
+  804ca9:	85 c0                	test   %eax,%eax
+  804cab:	78 3a                	js     804ce7 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804cad:	83 ec 04             	sub    $0x4,%esp
+  804cb0:	68 07 04 00 00       	push   $0x407
+  804cb5:	ff 75 f4             	push   -0xc(%ebp)
+  804cb8:	6a 00                	push   $0x0
+  804cba:	e8 44 c0 ff ff       	call   800d03 <sys_page_alloc>
+  804cbf:	83 c4 10             	add    $0x10,%esp
+  804cc2:	85 c0                	test   %eax,%eax
+  804cc4:	78 21                	js     804ce7 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804cc6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804cc9:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804ccf:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804cd1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804cd4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804cdb:	83 ec 0c             	sub    $0xc,%esp
+  804cde:	50                   	push   %eax
+  804cdf:	e8 6e cb ff ff       	call   801852 <fd2num>
+  804ce4:	83 c4 10             	add    $0x10,%esp
+}
+  804ce7:	c9                   	leave
+  804ce8:	c3                   	ret
+
+00804ce9 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804ce9:	55                   	push   %ebp
+  804cea:	89 e5                	mov    %esp,%ebp
+  804cec:	56                   	push   %esi
+  804ced:	53                   	push   %ebx
+  804cee:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804cf1:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  804cf6:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804cf9:	85 db                	test   %ebx,%ebx
+  804cfb:	78 17                	js     804d14 <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804cfd:	83 ec 0c             	sub    $0xc,%esp
+  804d00:	56                   	push   %esi
+  804d01:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  804d08:	83 c4 10             	add    $0x10,%esp
+  804d0b:	85 c0                	test   %eax,%eax
+  804d0d:	75 27                	jne    804d36 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804d0f:	83 eb 01             	sub    $0x1,%ebx
+  804d12:	eb e5                	jmp    804cf9 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804d14:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  804d19:	8b 40 48             	mov    0x48(%eax),%eax
+  804d1c:	83 ec 08             	sub    $0x8,%esp
+  804d1f:	ff 76 28             	push   0x28(%esi)
+  804d22:	ff 36                	push   (%esi)
+  804d24:	50                   	push   %eax
+  804d25:	68 08 5e 80 00       	push   $0x805e08
+  804d2a:	6a 1d                	push   $0x1d
+  804d2c:	68 2b 5e 80 00       	push   $0x805e2b
+  804d31:	e8 18 b4 ff ff       	call   80014e <_panic>
+}
+  804d36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804d39:	5b                   	pop    %ebx
+  804d3a:	5e                   	pop    %esi
+  804d3b:	5d                   	pop    %ebp
+  804d3c:	c3                   	ret
+
+00804d3d <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804d3d:	55                   	push   %ebp
+  804d3e:	89 e5                	mov    %esp,%ebp
+  804d40:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804d43:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  804d4a:	74 0a                	je     804d56 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804d4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  804d4f:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  804d54:	c9                   	leave
+  804d55:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804d56:	83 ec 04             	sub    $0x4,%esp
+  804d59:	6a 07                	push   $0x7
+  804d5b:	68 00 f0 bf ee       	push   $0xeebff000
+  804d60:	6a 00                	push   $0x0
+  804d62:	e8 9c bf ff ff       	call   800d03 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804d67:	83 c4 08             	add    $0x8,%esp
+  804d6a:	68 dd 4d 80 00       	push   $0x804ddd
+  804d6f:	6a 00                	push   $0x0
+  804d71:	e8 f3 c2 ff ff       	call   801069 <sys_env_set_pgfault_upcall>
+  804d76:	83 c4 10             	add    $0x10,%esp
+  804d79:	eb d1                	jmp    804d4c <set_pgfault_handler+0xf>
+
+00804d7b <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804d7b:	55                   	push   %ebp
+  804d7c:	89 e5                	mov    %esp,%ebp
+  804d7e:	83 ec 08             	sub    $0x8,%esp
+  804d81:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  804d84:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  804d8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d8f:	eb 03                	jmp    804d94 <add_pgfault_handler+0x19>
+  804d91:	83 c0 01             	add    $0x1,%eax
+  804d94:	39 d0                	cmp    %edx,%eax
+  804d96:	74 0b                	je     804da3 <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804d98:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  804d9f:	75 f0                	jne    804d91 <add_pgfault_handler+0x16>
+  804da1:	eb 24                	jmp    804dc7 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  804da3:	83 fa 0a             	cmp    $0xa,%edx
+  804da6:	74 21                	je     804dc9 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  804da8:	8d 42 01             	lea    0x1(%edx),%eax
+  804dab:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  804db0:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  804db7:	83 ec 0c             	sub    $0xc,%esp
+  804dba:	68 e9 4c 80 00       	push   $0x804ce9
+  804dbf:	e8 79 ff ff ff       	call   804d3d <set_pgfault_handler>
+  804dc4:	83 c4 10             	add    $0x10,%esp
+}
+  804dc7:	c9                   	leave
+  804dc8:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  804dc9:	83 ec 04             	sub    $0x4,%esp
+  804dcc:	68 39 5e 80 00       	push   $0x805e39
+  804dd1:	6a 44                	push   $0x44
+  804dd3:	68 2b 5e 80 00       	push   $0x805e2b
+  804dd8:	e8 71 b3 ff ff       	call   80014e <_panic>
+
+00804ddd <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804ddd:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804dde:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  804de3:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804de5:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  804de8:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  804dec:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  804df0:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  804df3:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  804df5:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  804df9:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  804dfc:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  804dfd:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  804e00:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  804e01:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  804e02:	c3                   	ret
+
+00804e03 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  804e03:	55                   	push   %ebp
+  804e04:	89 e5                	mov    %esp,%ebp
+  804e06:	57                   	push   %edi
+  804e07:	56                   	push   %esi
+  804e08:	53                   	push   %ebx
+  804e09:	83 ec 14             	sub    $0x14,%esp
+  804e0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804e0f:	8b 75 14             	mov    0x14(%ebp),%esi
+  804e12:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804e15:	ff 75 10             	push   0x10(%ebp)
+  804e18:	ff 75 0c             	push   0xc(%ebp)
+  804e1b:	e8 06 c3 ff ff       	call   801126 <sys_ipc_recv_pages>
+  804e20:	83 c4 10             	add    $0x10,%esp
+  804e23:	85 c0                	test   %eax,%eax
+  804e25:	78 46                	js     804e6d <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804e27:	85 ff                	test   %edi,%edi
+  804e29:	74 0d                	je     804e38 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804e2b:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  804e30:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804e36:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804e38:	85 f6                	test   %esi,%esi
+  804e3a:	74 0d                	je     804e49 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804e3c:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  804e41:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804e47:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804e49:	85 db                	test   %ebx,%ebx
+  804e4b:	74 0d                	je     804e5a <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804e4d:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  804e52:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804e58:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804e5a:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  804e5f:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804e65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804e68:	5b                   	pop    %ebx
+  804e69:	5e                   	pop    %esi
+  804e6a:	5f                   	pop    %edi
+  804e6b:	5d                   	pop    %ebp
+  804e6c:	c3                   	ret
+		if (from_env_store) {
+  804e6d:	85 ff                	test   %edi,%edi
+  804e6f:	74 06                	je     804e77 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  804e71:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804e77:	85 f6                	test   %esi,%esi
+  804e79:	74 06                	je     804e81 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804e7b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804e81:	85 db                	test   %ebx,%ebx
+  804e83:	74 e0                	je     804e65 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  804e85:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804e8b:	eb d8                	jmp    804e65 <ipc_recv_pages+0x62>
+
+00804e8d <ipc_recv>:
+{
+  804e8d:	55                   	push   %ebp
+  804e8e:	89 e5                	mov    %esp,%ebp
+  804e90:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  804e93:	6a 00                	push   $0x0
+  804e95:	ff 75 10             	push   0x10(%ebp)
+  804e98:	6a 01                	push   $0x1
+  804e9a:	ff 75 0c             	push   0xc(%ebp)
+  804e9d:	ff 75 08             	push   0x8(%ebp)
+  804ea0:	e8 5e ff ff ff       	call   804e03 <ipc_recv_pages>
+}
+  804ea5:	c9                   	leave
+  804ea6:	c3                   	ret
+
+00804ea7 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804ea7:	55                   	push   %ebp
+  804ea8:	89 e5                	mov    %esp,%ebp
+  804eaa:	56                   	push   %esi
+  804eab:	53                   	push   %ebx
+  804eac:	8b 75 08             	mov    0x8(%ebp),%esi
+  804eaf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  804eb2:	83 ec 0c             	sub    $0xc,%esp
+  804eb5:	ff 75 0c             	push   0xc(%ebp)
+  804eb8:	e8 9d c3 ff ff       	call   80125a <sys_ipc_try_recv>
+  804ebd:	83 c4 10             	add    $0x10,%esp
+  804ec0:	85 c0                	test   %eax,%eax
+  804ec2:	78 34                	js     804ef8 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804ec4:	85 f6                	test   %esi,%esi
+  804ec6:	74 0d                	je     804ed5 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  804ec8:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  804ecd:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804ed3:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  804ed5:	85 db                	test   %ebx,%ebx
+  804ed7:	74 0d                	je     804ee6 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  804ed9:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  804ede:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804ee4:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804ee6:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  804eeb:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804ef1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804ef4:	5b                   	pop    %ebx
+  804ef5:	5e                   	pop    %esi
+  804ef6:	5d                   	pop    %ebp
+  804ef7:	c3                   	ret
+		if (from_env_store) {
+  804ef8:	85 f6                	test   %esi,%esi
+  804efa:	74 06                	je     804f02 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  804efc:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  804f02:	85 db                	test   %ebx,%ebx
+  804f04:	74 eb                	je     804ef1 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  804f06:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804f0c:	eb e3                	jmp    804ef1 <ipc_try_recv+0x4a>
+
+00804f0e <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804f0e:	55                   	push   %ebp
+  804f0f:	89 e5                	mov    %esp,%ebp
+  804f11:	83 ec 14             	sub    $0x14,%esp
+  804f14:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804f17:	85 c0                	test   %eax,%eax
+  804f19:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804f1e:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804f21:	ff 75 18             	push   0x18(%ebp)
+  804f24:	ff 75 14             	push   0x14(%ebp)
+  804f27:	50                   	push   %eax
+  804f28:	ff 75 0c             	push   0xc(%ebp)
+  804f2b:	ff 75 08             	push   0x8(%ebp)
+  804f2e:	e8 b6 c1 ff ff       	call   8010e9 <sys_ipc_send_pages>
+  804f33:	83 c4 20             	add    $0x20,%esp
+  804f36:	85 c0                	test   %eax,%eax
+  804f38:	78 02                	js     804f3c <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804f3a:	c9                   	leave
+  804f3b:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804f3c:	50                   	push   %eax
+  804f3d:	68 54 5e 80 00       	push   $0x805e54
+  804f42:	68 80 00 00 00       	push   $0x80
+  804f47:	68 80 5e 80 00       	push   $0x805e80
+  804f4c:	e8 fd b1 ff ff       	call   80014e <_panic>
+
+00804f51 <ipc_send>:
+{
+  804f51:	55                   	push   %ebp
+  804f52:	89 e5                	mov    %esp,%ebp
+  804f54:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  804f57:	ff 75 14             	push   0x14(%ebp)
+  804f5a:	6a 01                	push   $0x1
+  804f5c:	ff 75 10             	push   0x10(%ebp)
+  804f5f:	ff 75 0c             	push   0xc(%ebp)
+  804f62:	ff 75 08             	push   0x8(%ebp)
+  804f65:	e8 a4 ff ff ff       	call   804f0e <ipc_send_pages>
+}
+  804f6a:	83 c4 20             	add    $0x20,%esp
+  804f6d:	c9                   	leave
+  804f6e:	c3                   	ret
+
+00804f6f <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804f6f:	55                   	push   %ebp
+  804f70:	89 e5                	mov    %esp,%ebp
+  804f72:	83 ec 14             	sub    $0x14,%esp
+  804f75:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804f78:	85 c0                	test   %eax,%eax
+  804f7a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804f7f:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804f82:	ff 75 18             	push   0x18(%ebp)
+  804f85:	ff 75 14             	push   0x14(%ebp)
+  804f88:	50                   	push   %eax
+  804f89:	ff 75 0c             	push   0xc(%ebp)
+  804f8c:	ff 75 08             	push   0x8(%ebp)
+  804f8f:	e8 e6 c1 ff ff       	call   80117a <sys_ipc_call>
+  804f94:	83 c4 20             	add    $0x20,%esp
+  804f97:	85 c0                	test   %eax,%eax
+  804f99:	78 0b                	js     804fa6 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  804f9b:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  804fa0:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804fa6:	c9                   	leave
+  804fa7:	c3                   	ret
+
+00804fa8 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  804fa8:	55                   	push   %ebp
+  804fa9:	89 e5                	mov    %esp,%ebp
+  804fab:	57                   	push   %edi
+  804fac:	56                   	push   %esi
+  804fad:	53                   	push   %ebx
+  804fae:	83 ec 18             	sub    $0x18,%esp
+  804fb1:	8b 45 10             	mov    0x10(%ebp),%eax
+  804fb4:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  804fb7:	8b 75 20             	mov    0x20(%ebp),%esi
+  804fba:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804fbd:	85 c0                	test   %eax,%eax
+  804fbf:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804fc4:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804fc7:	ff 75 18             	push   0x18(%ebp)
+  804fca:	ff 75 14             	push   0x14(%ebp)
+  804fcd:	50                   	push   %eax
+  804fce:	ff 75 0c             	push   0xc(%ebp)
+  804fd1:	ff 75 08             	push   0x8(%ebp)
+  804fd4:	e8 e2 c1 ff ff       	call   8011bb <sys_ipc_reply_recv>
+  804fd9:	83 c4 20             	add    $0x20,%esp
+  804fdc:	85 c0                	test   %eax,%eax
+  804fde:	78 46                	js     805026 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804fe0:	85 ff                	test   %edi,%edi
+  804fe2:	74 0d                	je     804ff1 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  804fe4:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  804fe9:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804fef:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804ff1:	85 f6                	test   %esi,%esi
+  804ff3:	74 0d                	je     805002 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  804ff5:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  804ffa:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  805000:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  805002:	85 db                	test   %ebx,%ebx
+  805004:	74 0d                	je     805013 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  805006:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  80500b:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  805011:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  805013:	a1 1c e9 80 00       	mov    0x80e91c,%eax
+  805018:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80501e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805021:	5b                   	pop    %ebx
+  805022:	5e                   	pop    %esi
+  805023:	5f                   	pop    %edi
+  805024:	5d                   	pop    %ebp
+  805025:	c3                   	ret
+		if (from_env_store) {
+  805026:	85 ff                	test   %edi,%edi
+  805028:	74 06                	je     805030 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  80502a:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  805030:	85 f6                	test   %esi,%esi
+  805032:	74 06                	je     80503a <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  805034:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80503a:	85 db                	test   %ebx,%ebx
+  80503c:	74 e0                	je     80501e <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  80503e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  805044:	eb d8                	jmp    80501e <ipc_reply_recv+0x76>
+
+00805046 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805046:	55                   	push   %ebp
+  805047:	89 e5                	mov    %esp,%ebp
+  805049:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80504c:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  805051:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  805054:	c1 e0 06             	shl    $0x6,%eax
+  805057:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80505c:	8b 40 50             	mov    0x50(%eax),%eax
+  80505f:	39 c8                	cmp    %ecx,%eax
+  805061:	74 12                	je     805075 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  805063:	83 c2 01             	add    $0x1,%edx
+  805066:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80506c:	75 e3                	jne    805051 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80506e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805073:	eb 0e                	jmp    805083 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  805075:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  805078:	c1 e0 06             	shl    $0x6,%eax
+  80507b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805080:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  805083:	5d                   	pop    %ebp
+  805084:	c3                   	ret
+
+00805085 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  805085:	55                   	push   %ebp
+  805086:	89 e5                	mov    %esp,%ebp
+  805088:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80508b:	89 c2                	mov    %eax,%edx
+  80508d:	c1 ea 16             	shr    $0x16,%edx
+  805090:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  805097:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80509c:	f6 c1 01             	test   $0x1,%cl
+  80509f:	74 1e                	je     8050bf <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  8050a1:	c1 e8 0c             	shr    $0xc,%eax
+  8050a4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8050ab:	a8 01                	test   $0x1,%al
+  8050ad:	74 10                	je     8050bf <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8050af:	c1 e8 0c             	shr    $0xc,%eax
+  8050b2:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8050b5:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  8050bc:	0f b7 d2             	movzwl %dx,%edx
+}
+  8050bf:	89 d0                	mov    %edx,%eax
+  8050c1:	5d                   	pop    %ebp
+  8050c2:	c3                   	ret
+
+008050c3 <udivmod>:
+  8050c3:	55                   	push   %ebp
+  8050c4:	57                   	push   %edi
+  8050c5:	56                   	push   %esi
+  8050c6:	53                   	push   %ebx
+  8050c7:	83 ec 24             	sub    $0x24,%esp
+  8050ca:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8050ce:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8050d2:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8050d6:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8050da:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8050de:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8050e2:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8050e6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8050eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050f5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8050fc:	00 
+  8050fd:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  805104:	00 
+  805105:	89 fb                	mov    %edi,%ebx
+  805107:	eb 08                	jmp    805111 <udivmod+0x4e>
+  805109:	83 e9 01             	sub    $0x1,%ecx
+  80510c:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80510f:	74 68                	je     805179 <udivmod+0xb6>
+  805111:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  805115:	01 c0                	add    %eax,%eax
+  805117:	89 c6                	mov    %eax,%esi
+  805119:	89 d7                	mov    %edx,%edi
+  80511b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80511f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805123:	0f ad d0             	shrd   %cl,%edx,%eax
+  805126:	d3 ea                	shr    %cl,%edx
+  805128:	f6 c1 20             	test   $0x20,%cl
+  80512b:	74 04                	je     805131 <udivmod+0x6e>
+  80512d:	89 d0                	mov    %edx,%eax
+  80512f:	31 d2                	xor    %edx,%edx
+  805131:	83 e0 01             	and    $0x1,%eax
+  805134:	89 04 24             	mov    %eax,(%esp)
+  805137:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80513e:	00 
+  80513f:	8b 04 24             	mov    (%esp),%eax
+  805142:	8b 54 24 04          	mov    0x4(%esp),%edx
+  805146:	09 f0                	or     %esi,%eax
+  805148:	09 fa                	or     %edi,%edx
+  80514a:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80514e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  805152:	39 f0                	cmp    %esi,%eax
+  805154:	89 d5                	mov    %edx,%ebp
+  805156:	19 fd                	sbb    %edi,%ebp
+  805158:	72 af                	jb     805109 <udivmod+0x46>
+  80515a:	29 f0                	sub    %esi,%eax
+  80515c:	19 fa                	sbb    %edi,%edx
+  80515e:	89 cf                	mov    %ecx,%edi
+  805160:	c1 ef 05             	shr    $0x5,%edi
+  805163:	83 e7 01             	and    $0x1,%edi
+  805166:	89 fe                	mov    %edi,%esi
+  805168:	83 f6 01             	xor    $0x1,%esi
+  80516b:	d3 e6                	shl    %cl,%esi
+  80516d:	d3 e7                	shl    %cl,%edi
+  80516f:	09 74 24 18          	or     %esi,0x18(%esp)
+  805173:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  805177:	eb 90                	jmp    805109 <udivmod+0x46>
+  805179:	85 db                	test   %ebx,%ebx
+  80517b:	74 05                	je     805182 <udivmod+0xbf>
+  80517d:	89 03                	mov    %eax,(%ebx)
+  80517f:	89 53 04             	mov    %edx,0x4(%ebx)
+  805182:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805186:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80518a:	83 c4 24             	add    $0x24,%esp
+  80518d:	5b                   	pop    %ebx
+  80518e:	5e                   	pop    %esi
+  80518f:	5f                   	pop    %edi
+  805190:	5d                   	pop    %ebp
+  805191:	c3                   	ret
+
+00805192 <__udivdi3>:
+  805192:	83 ec 08             	sub    $0x8,%esp
+  805195:	6a 00                	push   $0x0
+  805197:	ff 74 24 1c          	push   0x1c(%esp)
+  80519b:	ff 74 24 1c          	push   0x1c(%esp)
+  80519f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8051a3:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8051a7:	e8 17 ff ff ff       	call   8050c3 <udivmod>
+  8051ac:	83 c4 14             	add    $0x14,%esp
+  8051af:	c3                   	ret
+
+008051b0 <__umoddi3>:
+  8051b0:	83 ec 18             	sub    $0x18,%esp
+  8051b3:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8051b7:	50                   	push   %eax
+  8051b8:	ff 74 24 2c          	push   0x2c(%esp)
+  8051bc:	ff 74 24 2c          	push   0x2c(%esp)
+  8051c0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8051c4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8051c8:	e8 f6 fe ff ff       	call   8050c3 <udivmod>
+  8051cd:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8051d1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8051d5:	83 c4 24             	add    $0x24,%esp
+  8051d8:	c3                   	ret
+
+008051d9 <__divdi3>:
+  8051d9:	55                   	push   %ebp
+  8051da:	57                   	push   %edi
+  8051db:	56                   	push   %esi
+  8051dc:	53                   	push   %ebx
+  8051dd:	83 ec 10             	sub    $0x10,%esp
+  8051e0:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8051e4:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8051e8:	89 c6                	mov    %eax,%esi
+  8051ea:	89 d7                	mov    %edx,%edi
+  8051ec:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8051f0:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8051f4:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8051f8:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8051fc:	89 c5                	mov    %eax,%ebp
+  8051fe:	f7 dd                	neg    %ebp
+  805200:	89 d6                	mov    %edx,%esi
+  805202:	83 d6 00             	adc    $0x0,%esi
+  805205:	f7 de                	neg    %esi
+  805207:	0f 48 e8             	cmovs  %eax,%ebp
+  80520a:	0f 49 d6             	cmovns %esi,%edx
+  80520d:	6a 00                	push   $0x0
+  80520f:	8b 74 24 30          	mov    0x30(%esp),%esi
+  805213:	f7 de                	neg    %esi
+  805215:	8b 44 24 34          	mov    0x34(%esp),%eax
+  805219:	83 d0 00             	adc    $0x0,%eax
+  80521c:	f7 d8                	neg    %eax
+  80521e:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  805223:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  805228:	50                   	push   %eax
+  805229:	56                   	push   %esi
+  80522a:	89 e8                	mov    %ebp,%eax
+  80522c:	e8 92 fe ff ff       	call   8050c3 <udivmod>
+  805231:	83 c4 10             	add    $0x10,%esp
+  805234:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  805239:	78 08                	js     805243 <__divdi3+0x6a>
+  80523b:	83 c4 0c             	add    $0xc,%esp
+  80523e:	5b                   	pop    %ebx
+  80523f:	5e                   	pop    %esi
+  805240:	5f                   	pop    %edi
+  805241:	5d                   	pop    %ebp
+  805242:	c3                   	ret
+  805243:	f7 d8                	neg    %eax
+  805245:	83 d2 00             	adc    $0x0,%edx
+  805248:	f7 da                	neg    %edx
+  80524a:	eb ef                	jmp    80523b <__divdi3+0x62>
+
+0080524c <__moddi3>:
+  80524c:	55                   	push   %ebp
+  80524d:	57                   	push   %edi
+  80524e:	56                   	push   %esi
+  80524f:	53                   	push   %ebx
+  805250:	83 ec 18             	sub    $0x18,%esp
+  805253:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  805257:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80525b:	89 f1                	mov    %esi,%ecx
+  80525d:	f7 d9                	neg    %ecx
+  80525f:	89 da                	mov    %ebx,%edx
+  805261:	83 d2 00             	adc    $0x0,%edx
+  805264:	f7 da                	neg    %edx
+  805266:	0f 48 ce             	cmovs  %esi,%ecx
+  805269:	0f 48 d3             	cmovs  %ebx,%edx
+  80526c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805270:	50                   	push   %eax
+  805271:	8b 74 24 38          	mov    0x38(%esp),%esi
+  805275:	f7 de                	neg    %esi
+  805277:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  80527b:	83 d0 00             	adc    $0x0,%eax
+  80527e:	f7 d8                	neg    %eax
+  805280:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  805285:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  80528a:	50                   	push   %eax
+  80528b:	56                   	push   %esi
+  80528c:	89 c8                	mov    %ecx,%eax
+  80528e:	e8 30 fe ff ff       	call   8050c3 <udivmod>
+  805293:	83 c4 10             	add    $0x10,%esp
+  805296:	85 db                	test   %ebx,%ebx
+  805298:	78 10                	js     8052aa <__moddi3+0x5e>
+  80529a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80529e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8052a2:	83 c4 14             	add    $0x14,%esp
+  8052a5:	5b                   	pop    %ebx
+  8052a6:	5e                   	pop    %esi
+  8052a7:	5f                   	pop    %edi
+  8052a8:	5d                   	pop    %ebp
+  8052a9:	c3                   	ret
+  8052aa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8052ae:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8052b2:	f7 d8                	neg    %eax
+  8052b4:	83 d2 00             	adc    $0x0,%edx
+  8052b7:	f7 da                	neg    %edx
+  8052b9:	eb e7                	jmp    8052a2 <__moddi3+0x56>
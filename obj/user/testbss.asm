@@ -0,0 +1,5617 @@
+
+obj/user/testbss.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ab 00 00 00       	call   8000dc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	int i;
+
+	cprintf("Making sure bss works right...\n");
+  800039:	68 40 27 80 00       	push   $0x802740
+  80003e:	e8 d7 01 00 00       	call   80021a <cprintf>
+  800043:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < ARRAYSIZE; i++)
+  800046:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (bigarray[i] != 0)
+  80004b:	83 3c 85 20 40 80 00 	cmpl   $0x0,0x804020(,%eax,4)
+  800052:	00 
+  800053:	75 63                	jne    8000b8 <umain+0x85>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800055:	83 c0 01             	add    $0x1,%eax
+  800058:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80005d:	75 ec                	jne    80004b <umain+0x18>
+			panic("bigarray[%d] isn't cleared!\n", i);
+	for (i = 0; i < ARRAYSIZE; i++)
+  80005f:	b8 00 00 00 00       	mov    $0x0,%eax
+		bigarray[i] = i;
+  800064:	89 04 85 20 40 80 00 	mov    %eax,0x804020(,%eax,4)
+	for (i = 0; i < ARRAYSIZE; i++)
+  80006b:	83 c0 01             	add    $0x1,%eax
+  80006e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800073:	75 ef                	jne    800064 <umain+0x31>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (bigarray[i] != i)
+  80007a:	39 04 85 20 40 80 00 	cmp    %eax,0x804020(,%eax,4)
+  800081:	75 47                	jne    8000ca <umain+0x97>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800083:	83 c0 01             	add    $0x1,%eax
+  800086:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80008b:	75 ed                	jne    80007a <umain+0x47>
+			panic("bigarray[%d] didn't hold its value!\n", i);
+
+	cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  80008d:	83 ec 0c             	sub    $0xc,%esp
+  800090:	68 88 27 80 00       	push   $0x802788
+  800095:	e8 80 01 00 00       	call   80021a <cprintf>
+	bigarray[ARRAYSIZE+1024] = 0;
+  80009a:	c7 05 20 50 c0 00 00 	movl   $0x0,0xc05020
+  8000a1:	00 00 00 
+	panic("SHOULD HAVE TRAPPED!!!");
+  8000a4:	83 c4 0c             	add    $0xc,%esp
+  8000a7:	68 e7 27 80 00       	push   $0x8027e7
+  8000ac:	6a 1a                	push   $0x1a
+  8000ae:	68 d8 27 80 00       	push   $0x8027d8
+  8000b3:	e8 87 00 00 00       	call   80013f <_panic>
+			panic("bigarray[%d] isn't cleared!\n", i);
+  8000b8:	50                   	push   %eax
+  8000b9:	68 bb 27 80 00       	push   $0x8027bb
+  8000be:	6a 11                	push   $0x11
+  8000c0:	68 d8 27 80 00       	push   $0x8027d8
+  8000c5:	e8 75 00 00 00       	call   80013f <_panic>
+			panic("bigarray[%d] didn't hold its value!\n", i);
+  8000ca:	50                   	push   %eax
+  8000cb:	68 60 27 80 00       	push   $0x802760
+  8000d0:	6a 16                	push   $0x16
+  8000d2:	68 d8 27 80 00       	push   $0x8027d8
+  8000d7:	e8 63 00 00 00       	call   80013f <_panic>
+
+008000dc <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000dc:	55                   	push   %ebp
+  8000dd:	89 e5                	mov    %esp,%ebp
+  8000df:	56                   	push   %esi
+  8000e0:	53                   	push   %ebx
+  8000e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8000e7:	e8 ca 0b 00 00       	call   800cb6 <sys_getenvid>
+  8000ec:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f1:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8000f4:	c1 e0 06             	shl    $0x6,%eax
+  8000f7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000fc:	a3 24 40 c0 00       	mov    %eax,0xc04024
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800101:	85 db                	test   %ebx,%ebx
+  800103:	7e 07                	jle    80010c <libmain+0x30>
+		binaryname = argv[0];
+  800105:	8b 06                	mov    (%esi),%eax
+  800107:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  80010c:	83 ec 08             	sub    $0x8,%esp
+  80010f:	56                   	push   %esi
+  800110:	53                   	push   %ebx
+  800111:	e8 1d ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800116:	e8 0a 00 00 00       	call   800125 <exit>
+}
+  80011b:	83 c4 10             	add    $0x10,%esp
+  80011e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800121:	5b                   	pop    %ebx
+  800122:	5e                   	pop    %esi
+  800123:	5d                   	pop    %ebp
+  800124:	c3                   	ret
+
+00800125 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800125:	55                   	push   %ebp
+  800126:	89 e5                	mov    %esp,%ebp
+  800128:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80012b:	e8 2a 13 00 00       	call   80145a <close_all>
+	sys_env_destroy(0);
+  800130:	83 ec 0c             	sub    $0xc,%esp
+  800133:	6a 00                	push   $0x0
+  800135:	e8 3b 0b 00 00       	call   800c75 <sys_env_destroy>
+}
+  80013a:	83 c4 10             	add    $0x10,%esp
+  80013d:	c9                   	leave
+  80013e:	c3                   	ret
+
+0080013f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80013f:	55                   	push   %ebp
+  800140:	89 e5                	mov    %esp,%ebp
+  800142:	56                   	push   %esi
+  800143:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800144:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800147:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  80014d:	e8 64 0b 00 00       	call   800cb6 <sys_getenvid>
+  800152:	83 ec 0c             	sub    $0xc,%esp
+  800155:	ff 75 0c             	push   0xc(%ebp)
+  800158:	ff 75 08             	push   0x8(%ebp)
+  80015b:	56                   	push   %esi
+  80015c:	50                   	push   %eax
+  80015d:	68 08 28 80 00       	push   $0x802808
+  800162:	e8 b3 00 00 00       	call   80021a <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800167:	83 c4 18             	add    $0x18,%esp
+  80016a:	53                   	push   %ebx
+  80016b:	ff 75 10             	push   0x10(%ebp)
+  80016e:	e8 56 00 00 00       	call   8001c9 <vcprintf>
+	cprintf("\n");
+  800173:	c7 04 24 d6 27 80 00 	movl   $0x8027d6,(%esp)
+  80017a:	e8 9b 00 00 00       	call   80021a <cprintf>
+  80017f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800182:	cc                   	int3
+	while (1)
+  800183:	eb fd                	jmp    800182 <_panic+0x43>
+
+00800185 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800185:	55                   	push   %ebp
+  800186:	89 e5                	mov    %esp,%ebp
+  800188:	53                   	push   %ebx
+  800189:	83 ec 04             	sub    $0x4,%esp
+  80018c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80018f:	8b 13                	mov    (%ebx),%edx
+  800191:	8d 42 01             	lea    0x1(%edx),%eax
+  800194:	89 03                	mov    %eax,(%ebx)
+  800196:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800199:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80019d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001a2:	74 09                	je     8001ad <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001a4:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001ab:	c9                   	leave
+  8001ac:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001ad:	83 ec 08             	sub    $0x8,%esp
+  8001b0:	68 ff 00 00 00       	push   $0xff
+  8001b5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001b8:	50                   	push   %eax
+  8001b9:	e8 69 0a 00 00       	call   800c27 <sys_cputs>
+		b->idx = 0;
+  8001be:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001c4:	83 c4 10             	add    $0x10,%esp
+  8001c7:	eb db                	jmp    8001a4 <putch+0x1f>
+
+008001c9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001c9:	55                   	push   %ebp
+  8001ca:	89 e5                	mov    %esp,%ebp
+  8001cc:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001d2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001d9:	00 00 00 
+	b.cnt = 0;
+  8001dc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001e3:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001e6:	ff 75 0c             	push   0xc(%ebp)
+  8001e9:	ff 75 08             	push   0x8(%ebp)
+  8001ec:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001f2:	50                   	push   %eax
+  8001f3:	68 85 01 80 00       	push   $0x800185
+  8001f8:	e8 14 01 00 00       	call   800311 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001fd:	83 c4 08             	add    $0x8,%esp
+  800200:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800206:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80020c:	50                   	push   %eax
+  80020d:	e8 15 0a 00 00       	call   800c27 <sys_cputs>
+
+	return b.cnt;
+}
+  800212:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800218:	c9                   	leave
+  800219:	c3                   	ret
+
+0080021a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80021a:	55                   	push   %ebp
+  80021b:	89 e5                	mov    %esp,%ebp
+  80021d:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800220:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800223:	50                   	push   %eax
+  800224:	ff 75 08             	push   0x8(%ebp)
+  800227:	e8 9d ff ff ff       	call   8001c9 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80022c:	c9                   	leave
+  80022d:	c3                   	ret
+
+0080022e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80022e:	55                   	push   %ebp
+  80022f:	89 e5                	mov    %esp,%ebp
+  800231:	57                   	push   %edi
+  800232:	56                   	push   %esi
+  800233:	53                   	push   %ebx
+  800234:	83 ec 1c             	sub    $0x1c,%esp
+  800237:	89 c7                	mov    %eax,%edi
+  800239:	89 d6                	mov    %edx,%esi
+  80023b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80023e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800241:	89 d1                	mov    %edx,%ecx
+  800243:	89 c2                	mov    %eax,%edx
+  800245:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800248:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80024b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80024e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800251:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800254:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80025b:	39 c2                	cmp    %eax,%edx
+  80025d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800260:	72 3e                	jb     8002a0 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800262:	83 ec 0c             	sub    $0xc,%esp
+  800265:	ff 75 18             	push   0x18(%ebp)
+  800268:	83 eb 01             	sub    $0x1,%ebx
+  80026b:	53                   	push   %ebx
+  80026c:	50                   	push   %eax
+  80026d:	83 ec 08             	sub    $0x8,%esp
+  800270:	ff 75 e4             	push   -0x1c(%ebp)
+  800273:	ff 75 e0             	push   -0x20(%ebp)
+  800276:	ff 75 dc             	push   -0x24(%ebp)
+  800279:	ff 75 d8             	push   -0x28(%ebp)
+  80027c:	e8 7d 23 00 00       	call   8025fe <__udivdi3>
+  800281:	83 c4 18             	add    $0x18,%esp
+  800284:	52                   	push   %edx
+  800285:	50                   	push   %eax
+  800286:	89 f2                	mov    %esi,%edx
+  800288:	89 f8                	mov    %edi,%eax
+  80028a:	e8 9f ff ff ff       	call   80022e <printnum>
+  80028f:	83 c4 20             	add    $0x20,%esp
+  800292:	eb 13                	jmp    8002a7 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800294:	83 ec 08             	sub    $0x8,%esp
+  800297:	56                   	push   %esi
+  800298:	ff 75 18             	push   0x18(%ebp)
+  80029b:	ff d7                	call   *%edi
+  80029d:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002a0:	83 eb 01             	sub    $0x1,%ebx
+  8002a3:	85 db                	test   %ebx,%ebx
+  8002a5:	7f ed                	jg     800294 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002a7:	83 ec 08             	sub    $0x8,%esp
+  8002aa:	56                   	push   %esi
+  8002ab:	83 ec 04             	sub    $0x4,%esp
+  8002ae:	ff 75 e4             	push   -0x1c(%ebp)
+  8002b1:	ff 75 e0             	push   -0x20(%ebp)
+  8002b4:	ff 75 dc             	push   -0x24(%ebp)
+  8002b7:	ff 75 d8             	push   -0x28(%ebp)
+  8002ba:	e8 5d 23 00 00       	call   80261c <__umoddi3>
+  8002bf:	83 c4 14             	add    $0x14,%esp
+  8002c2:	0f be 80 2b 28 80 00 	movsbl 0x80282b(%eax),%eax
+  8002c9:	50                   	push   %eax
+  8002ca:	ff d7                	call   *%edi
+}
+  8002cc:	83 c4 10             	add    $0x10,%esp
+  8002cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d2:	5b                   	pop    %ebx
+  8002d3:	5e                   	pop    %esi
+  8002d4:	5f                   	pop    %edi
+  8002d5:	5d                   	pop    %ebp
+  8002d6:	c3                   	ret
+
+008002d7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002d7:	55                   	push   %ebp
+  8002d8:	89 e5                	mov    %esp,%ebp
+  8002da:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002dd:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002e1:	8b 10                	mov    (%eax),%edx
+  8002e3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002e6:	73 0a                	jae    8002f2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002e8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002eb:	89 08                	mov    %ecx,(%eax)
+  8002ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002f0:	88 02                	mov    %al,(%edx)
+}
+  8002f2:	5d                   	pop    %ebp
+  8002f3:	c3                   	ret
+
+008002f4 <printfmt>:
+{
+  8002f4:	55                   	push   %ebp
+  8002f5:	89 e5                	mov    %esp,%ebp
+  8002f7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002fa:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002fd:	50                   	push   %eax
+  8002fe:	ff 75 10             	push   0x10(%ebp)
+  800301:	ff 75 0c             	push   0xc(%ebp)
+  800304:	ff 75 08             	push   0x8(%ebp)
+  800307:	e8 05 00 00 00       	call   800311 <vprintfmt>
+}
+  80030c:	83 c4 10             	add    $0x10,%esp
+  80030f:	c9                   	leave
+  800310:	c3                   	ret
+
+00800311 <vprintfmt>:
+{
+  800311:	55                   	push   %ebp
+  800312:	89 e5                	mov    %esp,%ebp
+  800314:	57                   	push   %edi
+  800315:	56                   	push   %esi
+  800316:	53                   	push   %ebx
+  800317:	83 ec 2c             	sub    $0x2c,%esp
+  80031a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80031d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800320:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800323:	eb 0a                	jmp    80032f <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800325:	83 ec 08             	sub    $0x8,%esp
+  800328:	53                   	push   %ebx
+  800329:	50                   	push   %eax
+  80032a:	ff d6                	call   *%esi
+  80032c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80032f:	83 c7 01             	add    $0x1,%edi
+  800332:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800336:	83 f8 25             	cmp    $0x25,%eax
+  800339:	74 0c                	je     800347 <vprintfmt+0x36>
+			if (ch == '\0')
+  80033b:	85 c0                	test   %eax,%eax
+  80033d:	75 e6                	jne    800325 <vprintfmt+0x14>
+}
+  80033f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800342:	5b                   	pop    %ebx
+  800343:	5e                   	pop    %esi
+  800344:	5f                   	pop    %edi
+  800345:	5d                   	pop    %ebp
+  800346:	c3                   	ret
+		padc = ' ';
+  800347:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80034b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800352:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800359:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800360:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800365:	8d 47 01             	lea    0x1(%edi),%eax
+  800368:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80036b:	0f b6 17             	movzbl (%edi),%edx
+  80036e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800371:	3c 55                	cmp    $0x55,%al
+  800373:	0f 87 c5 03 00 00    	ja     80073e <vprintfmt+0x42d>
+  800379:	0f b6 c0             	movzbl %al,%eax
+  80037c:	ff 24 85 c0 29 80 00 	jmp    *0x8029c0(,%eax,4)
+  800383:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800386:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80038a:	eb d9                	jmp    800365 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80038c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80038f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800393:	eb d0                	jmp    800365 <vprintfmt+0x54>
+  800395:	0f b6 d2             	movzbl %dl,%edx
+  800398:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80039b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003a3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003a6:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003aa:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003ad:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003b0:	83 f9 09             	cmp    $0x9,%ecx
+  8003b3:	77 55                	ja     80040a <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003b5:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003b8:	eb e9                	jmp    8003a3 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bd:	8b 00                	mov    (%eax),%eax
+  8003bf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8003c8:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003cb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003ce:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d2:	79 91                	jns    800365 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003d4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003da:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003e1:	eb 82                	jmp    800365 <vprintfmt+0x54>
+			if (width < 0)
+  8003e3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003e6:	85 d2                	test   %edx,%edx
+  8003e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ed:	0f 49 c2             	cmovns %edx,%eax
+  8003f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003f6:	e9 6a ff ff ff       	jmp    800365 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003fe:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800405:	e9 5b ff ff ff       	jmp    800365 <vprintfmt+0x54>
+  80040a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80040d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800410:	eb bc                	jmp    8003ce <vprintfmt+0xbd>
+			lflag++;
+  800412:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800415:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800418:	e9 48 ff ff ff       	jmp    800365 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80041d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800420:	8d 78 04             	lea    0x4(%eax),%edi
+  800423:	83 ec 08             	sub    $0x8,%esp
+  800426:	53                   	push   %ebx
+  800427:	ff 30                	push   (%eax)
+  800429:	ff d6                	call   *%esi
+			break;
+  80042b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80042e:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800431:	e9 63 02 00 00       	jmp    800699 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800436:	8b 45 14             	mov    0x14(%ebp),%eax
+  800439:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80043c:	8b 10                	mov    (%eax),%edx
+  80043e:	89 d0                	mov    %edx,%eax
+  800440:	f7 d8                	neg    %eax
+  800442:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800445:	83 f8 12             	cmp    $0x12,%eax
+  800448:	7f 23                	jg     80046d <vprintfmt+0x15c>
+  80044a:	8b 14 85 20 2b 80 00 	mov    0x802b20(,%eax,4),%edx
+  800451:	85 d2                	test   %edx,%edx
+  800453:	74 18                	je     80046d <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800455:	52                   	push   %edx
+  800456:	68 5d 2c 80 00       	push   $0x802c5d
+  80045b:	53                   	push   %ebx
+  80045c:	56                   	push   %esi
+  80045d:	e8 92 fe ff ff       	call   8002f4 <printfmt>
+  800462:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800465:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800468:	e9 2c 02 00 00       	jmp    800699 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80046d:	50                   	push   %eax
+  80046e:	68 43 28 80 00       	push   $0x802843
+  800473:	53                   	push   %ebx
+  800474:	56                   	push   %esi
+  800475:	e8 7a fe ff ff       	call   8002f4 <printfmt>
+  80047a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80047d:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800480:	e9 14 02 00 00       	jmp    800699 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800485:	8b 45 14             	mov    0x14(%ebp),%eax
+  800488:	83 c0 04             	add    $0x4,%eax
+  80048b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80048e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800491:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800493:	85 c9                	test   %ecx,%ecx
+  800495:	b8 3c 28 80 00       	mov    $0x80283c,%eax
+  80049a:	0f 45 c1             	cmovne %ecx,%eax
+  80049d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004a0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004a4:	7e 06                	jle    8004ac <vprintfmt+0x19b>
+  8004a6:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004aa:	75 0b                	jne    8004b7 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ac:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004af:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004b2:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004b5:	eb 5c                	jmp    800513 <vprintfmt+0x202>
+  8004b7:	83 ec 08             	sub    $0x8,%esp
+  8004ba:	ff 75 d0             	push   -0x30(%ebp)
+  8004bd:	ff 75 cc             	push   -0x34(%ebp)
+  8004c0:	e8 19 03 00 00       	call   8007de <strnlen>
+  8004c5:	89 c2                	mov    %eax,%edx
+  8004c7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ca:	29 d0                	sub    %edx,%eax
+  8004cc:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004cf:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004d6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004d9:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004db:	eb 0e                	jmp    8004eb <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004dd:	83 ec 08             	sub    $0x8,%esp
+  8004e0:	53                   	push   %ebx
+  8004e1:	57                   	push   %edi
+  8004e2:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004e5:	83 ee 01             	sub    $0x1,%esi
+  8004e8:	83 c4 10             	add    $0x10,%esp
+  8004eb:	85 f6                	test   %esi,%esi
+  8004ed:	7f ee                	jg     8004dd <vprintfmt+0x1cc>
+  8004ef:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f5:	85 c0                	test   %eax,%eax
+  8004f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004fc:	0f 49 d0             	cmovns %eax,%edx
+  8004ff:	29 d0                	sub    %edx,%eax
+  800501:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800504:	eb a6                	jmp    8004ac <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800506:	83 ec 08             	sub    $0x8,%esp
+  800509:	53                   	push   %ebx
+  80050a:	52                   	push   %edx
+  80050b:	ff 55 08             	call   *0x8(%ebp)
+  80050e:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800511:	89 f1                	mov    %esi,%ecx
+  800513:	8d 71 01             	lea    0x1(%ecx),%esi
+  800516:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80051a:	0f be d0             	movsbl %al,%edx
+  80051d:	85 d2                	test   %edx,%edx
+  80051f:	74 28                	je     800549 <vprintfmt+0x238>
+  800521:	85 ff                	test   %edi,%edi
+  800523:	78 05                	js     80052a <vprintfmt+0x219>
+  800525:	83 ef 01             	sub    $0x1,%edi
+  800528:	78 30                	js     80055a <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80052a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80052e:	74 d6                	je     800506 <vprintfmt+0x1f5>
+  800530:	0f be c0             	movsbl %al,%eax
+  800533:	83 e8 20             	sub    $0x20,%eax
+  800536:	83 f8 5e             	cmp    $0x5e,%eax
+  800539:	76 cb                	jbe    800506 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80053b:	83 ec 08             	sub    $0x8,%esp
+  80053e:	53                   	push   %ebx
+  80053f:	6a 3f                	push   $0x3f
+  800541:	ff 55 08             	call   *0x8(%ebp)
+  800544:	83 c4 10             	add    $0x10,%esp
+  800547:	eb c8                	jmp    800511 <vprintfmt+0x200>
+  800549:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80054f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800552:	01 d0                	add    %edx,%eax
+  800554:	29 c8                	sub    %ecx,%eax
+  800556:	89 c7                	mov    %eax,%edi
+  800558:	eb 13                	jmp    80056d <vprintfmt+0x25c>
+  80055a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80055d:	eb ed                	jmp    80054c <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80055f:	83 ec 08             	sub    $0x8,%esp
+  800562:	53                   	push   %ebx
+  800563:	6a 20                	push   $0x20
+  800565:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800567:	83 ef 01             	sub    $0x1,%edi
+  80056a:	83 c4 10             	add    $0x10,%esp
+  80056d:	85 ff                	test   %edi,%edi
+  80056f:	7f ee                	jg     80055f <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800571:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800574:	89 45 14             	mov    %eax,0x14(%ebp)
+  800577:	e9 1d 01 00 00       	jmp    800699 <vprintfmt+0x388>
+	if (lflag >= 2)
+  80057c:	83 f9 01             	cmp    $0x1,%ecx
+  80057f:	7f 1b                	jg     80059c <vprintfmt+0x28b>
+	else if (lflag)
+  800581:	85 c9                	test   %ecx,%ecx
+  800583:	74 63                	je     8005e8 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800585:	8b 45 14             	mov    0x14(%ebp),%eax
+  800588:	8b 00                	mov    (%eax),%eax
+  80058a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80058d:	99                   	cltd
+  80058e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800591:	8b 45 14             	mov    0x14(%ebp),%eax
+  800594:	8d 40 04             	lea    0x4(%eax),%eax
+  800597:	89 45 14             	mov    %eax,0x14(%ebp)
+  80059a:	eb 17                	jmp    8005b3 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80059c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059f:	8b 50 04             	mov    0x4(%eax),%edx
+  8005a2:	8b 00                	mov    (%eax),%eax
+  8005a4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ad:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005b3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005b6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005b9:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005be:	85 c9                	test   %ecx,%ecx
+  8005c0:	0f 89 b9 00 00 00    	jns    80067f <vprintfmt+0x36e>
+				putch('-', putdat);
+  8005c6:	83 ec 08             	sub    $0x8,%esp
+  8005c9:	53                   	push   %ebx
+  8005ca:	6a 2d                	push   $0x2d
+  8005cc:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005ce:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005d4:	f7 da                	neg    %edx
+  8005d6:	83 d1 00             	adc    $0x0,%ecx
+  8005d9:	f7 d9                	neg    %ecx
+  8005db:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005de:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005e3:	e9 97 00 00 00       	jmp    80067f <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8005e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005eb:	8b 00                	mov    (%eax),%eax
+  8005ed:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f0:	99                   	cltd
+  8005f1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005fd:	eb b4                	jmp    8005b3 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8005ff:	83 f9 01             	cmp    $0x1,%ecx
+  800602:	7f 1b                	jg     80061f <vprintfmt+0x30e>
+	else if (lflag)
+  800604:	85 c9                	test   %ecx,%ecx
+  800606:	74 2c                	je     800634 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800608:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060b:	8b 10                	mov    (%eax),%edx
+  80060d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800612:	8d 40 04             	lea    0x4(%eax),%eax
+  800615:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800618:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80061d:	eb 60                	jmp    80067f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80061f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800622:	8b 10                	mov    (%eax),%edx
+  800624:	8b 48 04             	mov    0x4(%eax),%ecx
+  800627:	8d 40 08             	lea    0x8(%eax),%eax
+  80062a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80062d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800632:	eb 4b                	jmp    80067f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800634:	8b 45 14             	mov    0x14(%ebp),%eax
+  800637:	8b 10                	mov    (%eax),%edx
+  800639:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80063e:	8d 40 04             	lea    0x4(%eax),%eax
+  800641:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800644:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800649:	eb 34                	jmp    80067f <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80064b:	83 f9 01             	cmp    $0x1,%ecx
+  80064e:	7f 15                	jg     800665 <vprintfmt+0x354>
+	else if (lflag)
+  800650:	85 c9                	test   %ecx,%ecx
+  800652:	74 4d                	je     8006a1 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800654:	8b 45 14             	mov    0x14(%ebp),%eax
+  800657:	8b 00                	mov    (%eax),%eax
+  800659:	99                   	cltd
+  80065a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80065d:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800660:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800663:	eb 11                	jmp    800676 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800665:	8b 45 14             	mov    0x14(%ebp),%eax
+  800668:	8b 50 04             	mov    0x4(%eax),%edx
+  80066b:	8b 00                	mov    (%eax),%eax
+  80066d:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800670:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800673:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800676:	89 d1                	mov    %edx,%ecx
+  800678:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  80067a:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80067f:	83 ec 0c             	sub    $0xc,%esp
+  800682:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800686:	50                   	push   %eax
+  800687:	ff 75 e0             	push   -0x20(%ebp)
+  80068a:	57                   	push   %edi
+  80068b:	51                   	push   %ecx
+  80068c:	52                   	push   %edx
+  80068d:	89 da                	mov    %ebx,%edx
+  80068f:	89 f0                	mov    %esi,%eax
+  800691:	e8 98 fb ff ff       	call   80022e <printnum>
+			break;
+  800696:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800699:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80069c:	e9 8e fc ff ff       	jmp    80032f <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  8006a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a4:	8b 00                	mov    (%eax),%eax
+  8006a6:	99                   	cltd
+  8006a7:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006aa:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8006ad:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8006b0:	eb c4                	jmp    800676 <vprintfmt+0x365>
+			putch('0', putdat);
+  8006b2:	83 ec 08             	sub    $0x8,%esp
+  8006b5:	53                   	push   %ebx
+  8006b6:	6a 30                	push   $0x30
+  8006b8:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006ba:	83 c4 08             	add    $0x8,%esp
+  8006bd:	53                   	push   %ebx
+  8006be:	6a 78                	push   $0x78
+  8006c0:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c5:	8b 10                	mov    (%eax),%edx
+  8006c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006cc:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d5:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8006da:	eb a3                	jmp    80067f <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8006dc:	83 f9 01             	cmp    $0x1,%ecx
+  8006df:	7f 1b                	jg     8006fc <vprintfmt+0x3eb>
+	else if (lflag)
+  8006e1:	85 c9                	test   %ecx,%ecx
+  8006e3:	74 2f                	je     800714 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8006e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e8:	8b 10                	mov    (%eax),%edx
+  8006ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006fa:	eb 83                	jmp    80067f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8006fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ff:	8b 10                	mov    (%eax),%edx
+  800701:	8b 48 04             	mov    0x4(%eax),%ecx
+  800704:	8d 40 08             	lea    0x8(%eax),%eax
+  800707:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80070a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80070f:	e9 6b ff ff ff       	jmp    80067f <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800714:	8b 45 14             	mov    0x14(%ebp),%eax
+  800717:	8b 10                	mov    (%eax),%edx
+  800719:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071e:	8d 40 04             	lea    0x4(%eax),%eax
+  800721:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800724:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800729:	e9 51 ff ff ff       	jmp    80067f <vprintfmt+0x36e>
+			putch(ch, putdat);
+  80072e:	83 ec 08             	sub    $0x8,%esp
+  800731:	53                   	push   %ebx
+  800732:	6a 25                	push   $0x25
+  800734:	ff d6                	call   *%esi
+			break;
+  800736:	83 c4 10             	add    $0x10,%esp
+  800739:	e9 5b ff ff ff       	jmp    800699 <vprintfmt+0x388>
+			putch('%', putdat);
+  80073e:	83 ec 08             	sub    $0x8,%esp
+  800741:	53                   	push   %ebx
+  800742:	6a 25                	push   $0x25
+  800744:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800746:	83 c4 10             	add    $0x10,%esp
+  800749:	89 f8                	mov    %edi,%eax
+  80074b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80074f:	74 05                	je     800756 <vprintfmt+0x445>
+  800751:	83 e8 01             	sub    $0x1,%eax
+  800754:	eb f5                	jmp    80074b <vprintfmt+0x43a>
+  800756:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800759:	e9 3b ff ff ff       	jmp    800699 <vprintfmt+0x388>
+
+0080075e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80075e:	55                   	push   %ebp
+  80075f:	89 e5                	mov    %esp,%ebp
+  800761:	83 ec 18             	sub    $0x18,%esp
+  800764:	8b 45 08             	mov    0x8(%ebp),%eax
+  800767:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80076a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80076d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800771:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800774:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80077b:	85 c0                	test   %eax,%eax
+  80077d:	74 26                	je     8007a5 <vsnprintf+0x47>
+  80077f:	85 d2                	test   %edx,%edx
+  800781:	7e 22                	jle    8007a5 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800783:	ff 75 14             	push   0x14(%ebp)
+  800786:	ff 75 10             	push   0x10(%ebp)
+  800789:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80078c:	50                   	push   %eax
+  80078d:	68 d7 02 80 00       	push   $0x8002d7
+  800792:	e8 7a fb ff ff       	call   800311 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800797:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80079a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80079d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007a0:	83 c4 10             	add    $0x10,%esp
+}
+  8007a3:	c9                   	leave
+  8007a4:	c3                   	ret
+		return -E_INVAL;
+  8007a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007aa:	eb f7                	jmp    8007a3 <vsnprintf+0x45>
+
+008007ac <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007ac:	55                   	push   %ebp
+  8007ad:	89 e5                	mov    %esp,%ebp
+  8007af:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007b2:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007b5:	50                   	push   %eax
+  8007b6:	ff 75 10             	push   0x10(%ebp)
+  8007b9:	ff 75 0c             	push   0xc(%ebp)
+  8007bc:	ff 75 08             	push   0x8(%ebp)
+  8007bf:	e8 9a ff ff ff       	call   80075e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007c4:	c9                   	leave
+  8007c5:	c3                   	ret
+
+008007c6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007c6:	55                   	push   %ebp
+  8007c7:	89 e5                	mov    %esp,%ebp
+  8007c9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d1:	eb 03                	jmp    8007d6 <strlen+0x10>
+		n++;
+  8007d3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007d6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007da:	75 f7                	jne    8007d3 <strlen+0xd>
+	return n;
+}
+  8007dc:	5d                   	pop    %ebp
+  8007dd:	c3                   	ret
+
+008007de <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007de:	55                   	push   %ebp
+  8007df:	89 e5                	mov    %esp,%ebp
+  8007e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ec:	eb 03                	jmp    8007f1 <strnlen+0x13>
+		n++;
+  8007ee:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007f1:	39 d0                	cmp    %edx,%eax
+  8007f3:	74 08                	je     8007fd <strnlen+0x1f>
+  8007f5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007f9:	75 f3                	jne    8007ee <strnlen+0x10>
+  8007fb:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007fd:	89 d0                	mov    %edx,%eax
+  8007ff:	5d                   	pop    %ebp
+  800800:	c3                   	ret
+
+00800801 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800801:	55                   	push   %ebp
+  800802:	89 e5                	mov    %esp,%ebp
+  800804:	53                   	push   %ebx
+  800805:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800808:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80080b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800810:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800814:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800817:	83 c0 01             	add    $0x1,%eax
+  80081a:	84 d2                	test   %dl,%dl
+  80081c:	75 f2                	jne    800810 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80081e:	89 c8                	mov    %ecx,%eax
+  800820:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800823:	c9                   	leave
+  800824:	c3                   	ret
+
+00800825 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800825:	55                   	push   %ebp
+  800826:	89 e5                	mov    %esp,%ebp
+  800828:	53                   	push   %ebx
+  800829:	83 ec 10             	sub    $0x10,%esp
+  80082c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80082f:	53                   	push   %ebx
+  800830:	e8 91 ff ff ff       	call   8007c6 <strlen>
+  800835:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800838:	ff 75 0c             	push   0xc(%ebp)
+  80083b:	01 d8                	add    %ebx,%eax
+  80083d:	50                   	push   %eax
+  80083e:	e8 be ff ff ff       	call   800801 <strcpy>
+	return dst;
+}
+  800843:	89 d8                	mov    %ebx,%eax
+  800845:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800848:	c9                   	leave
+  800849:	c3                   	ret
+
+0080084a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80084a:	55                   	push   %ebp
+  80084b:	89 e5                	mov    %esp,%ebp
+  80084d:	56                   	push   %esi
+  80084e:	53                   	push   %ebx
+  80084f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800852:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800855:	89 f3                	mov    %esi,%ebx
+  800857:	03 5d 10             	add    0x10(%ebp),%ebx
+  80085a:	89 f0                	mov    %esi,%eax
+  80085c:	eb 0f                	jmp    80086d <strncpy+0x23>
+		*dst++ = *src;
+  80085e:	83 c0 01             	add    $0x1,%eax
+  800861:	0f b6 0a             	movzbl (%edx),%ecx
+  800864:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800867:	80 f9 01             	cmp    $0x1,%cl
+  80086a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80086d:	39 d8                	cmp    %ebx,%eax
+  80086f:	75 ed                	jne    80085e <strncpy+0x14>
+	}
+	return ret;
+}
+  800871:	89 f0                	mov    %esi,%eax
+  800873:	5b                   	pop    %ebx
+  800874:	5e                   	pop    %esi
+  800875:	5d                   	pop    %ebp
+  800876:	c3                   	ret
+
+00800877 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800877:	55                   	push   %ebp
+  800878:	89 e5                	mov    %esp,%ebp
+  80087a:	56                   	push   %esi
+  80087b:	53                   	push   %ebx
+  80087c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80087f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800882:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800885:	89 f0                	mov    %esi,%eax
+  800887:	85 d2                	test   %edx,%edx
+  800889:	74 21                	je     8008ac <strlcpy+0x35>
+  80088b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80088f:	89 f2                	mov    %esi,%edx
+  800891:	eb 09                	jmp    80089c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800893:	83 c1 01             	add    $0x1,%ecx
+  800896:	83 c2 01             	add    $0x1,%edx
+  800899:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80089c:	39 c2                	cmp    %eax,%edx
+  80089e:	74 09                	je     8008a9 <strlcpy+0x32>
+  8008a0:	0f b6 19             	movzbl (%ecx),%ebx
+  8008a3:	84 db                	test   %bl,%bl
+  8008a5:	75 ec                	jne    800893 <strlcpy+0x1c>
+  8008a7:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008a9:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008ac:	29 f0                	sub    %esi,%eax
+}
+  8008ae:	5b                   	pop    %ebx
+  8008af:	5e                   	pop    %esi
+  8008b0:	5d                   	pop    %ebp
+  8008b1:	c3                   	ret
+
+008008b2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008b2:	55                   	push   %ebp
+  8008b3:	89 e5                	mov    %esp,%ebp
+  8008b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008bb:	eb 06                	jmp    8008c3 <strcmp+0x11>
+		p++, q++;
+  8008bd:	83 c1 01             	add    $0x1,%ecx
+  8008c0:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008c3:	0f b6 01             	movzbl (%ecx),%eax
+  8008c6:	84 c0                	test   %al,%al
+  8008c8:	74 04                	je     8008ce <strcmp+0x1c>
+  8008ca:	3a 02                	cmp    (%edx),%al
+  8008cc:	74 ef                	je     8008bd <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008ce:	0f b6 c0             	movzbl %al,%eax
+  8008d1:	0f b6 12             	movzbl (%edx),%edx
+  8008d4:	29 d0                	sub    %edx,%eax
+}
+  8008d6:	5d                   	pop    %ebp
+  8008d7:	c3                   	ret
+
+008008d8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008d8:	55                   	push   %ebp
+  8008d9:	89 e5                	mov    %esp,%ebp
+  8008db:	53                   	push   %ebx
+  8008dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008e2:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008e5:	eb 09                	jmp    8008f0 <strncmp+0x18>
+		n--, p++, q++;
+  8008e7:	83 ea 01             	sub    $0x1,%edx
+  8008ea:	83 c0 01             	add    $0x1,%eax
+  8008ed:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008f0:	85 d2                	test   %edx,%edx
+  8008f2:	74 18                	je     80090c <strncmp+0x34>
+  8008f4:	0f b6 18             	movzbl (%eax),%ebx
+  8008f7:	84 db                	test   %bl,%bl
+  8008f9:	74 04                	je     8008ff <strncmp+0x27>
+  8008fb:	3a 19                	cmp    (%ecx),%bl
+  8008fd:	74 e8                	je     8008e7 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008ff:	0f b6 00             	movzbl (%eax),%eax
+  800902:	0f b6 11             	movzbl (%ecx),%edx
+  800905:	29 d0                	sub    %edx,%eax
+}
+  800907:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80090a:	c9                   	leave
+  80090b:	c3                   	ret
+		return 0;
+  80090c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800911:	eb f4                	jmp    800907 <strncmp+0x2f>
+
+00800913 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800913:	55                   	push   %ebp
+  800914:	89 e5                	mov    %esp,%ebp
+  800916:	8b 45 08             	mov    0x8(%ebp),%eax
+  800919:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80091d:	eb 03                	jmp    800922 <strchr+0xf>
+  80091f:	83 c0 01             	add    $0x1,%eax
+  800922:	0f b6 10             	movzbl (%eax),%edx
+  800925:	84 d2                	test   %dl,%dl
+  800927:	74 06                	je     80092f <strchr+0x1c>
+		if (*s == c)
+  800929:	38 ca                	cmp    %cl,%dl
+  80092b:	75 f2                	jne    80091f <strchr+0xc>
+  80092d:	eb 05                	jmp    800934 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80092f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800934:	5d                   	pop    %ebp
+  800935:	c3                   	ret
+
+00800936 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800936:	55                   	push   %ebp
+  800937:	89 e5                	mov    %esp,%ebp
+  800939:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800940:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800943:	38 ca                	cmp    %cl,%dl
+  800945:	74 09                	je     800950 <strfind+0x1a>
+  800947:	84 d2                	test   %dl,%dl
+  800949:	74 05                	je     800950 <strfind+0x1a>
+	for (; *s; s++)
+  80094b:	83 c0 01             	add    $0x1,%eax
+  80094e:	eb f0                	jmp    800940 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800950:	5d                   	pop    %ebp
+  800951:	c3                   	ret
+
+00800952 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800952:	55                   	push   %ebp
+  800953:	89 e5                	mov    %esp,%ebp
+  800955:	57                   	push   %edi
+  800956:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800959:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80095c:	85 c9                	test   %ecx,%ecx
+  80095e:	74 20                	je     800980 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800960:	89 f8                	mov    %edi,%eax
+  800962:	09 c8                	or     %ecx,%eax
+  800964:	a8 03                	test   $0x3,%al
+  800966:	75 12                	jne    80097a <memset+0x28>
+		c &= 0xFF;
+  800968:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80096c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800972:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800975:	fc                   	cld
+  800976:	f3 ab                	rep stos %eax,%es:(%edi)
+  800978:	eb 06                	jmp    800980 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80097a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80097d:	fc                   	cld
+  80097e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800980:	89 f8                	mov    %edi,%eax
+  800982:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800985:	c9                   	leave
+  800986:	c3                   	ret
+
+00800987 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800987:	55                   	push   %ebp
+  800988:	89 e5                	mov    %esp,%ebp
+  80098a:	57                   	push   %edi
+  80098b:	56                   	push   %esi
+  80098c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800992:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800995:	39 c6                	cmp    %eax,%esi
+  800997:	73 32                	jae    8009cb <memmove+0x44>
+  800999:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80099c:	39 d0                	cmp    %edx,%eax
+  80099e:	73 2b                	jae    8009cb <memmove+0x44>
+		s += n;
+		d += n;
+  8009a0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009a3:	89 d6                	mov    %edx,%esi
+  8009a5:	09 fe                	or     %edi,%esi
+  8009a7:	09 ce                	or     %ecx,%esi
+  8009a9:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009af:	75 0e                	jne    8009bf <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009b1:	83 ef 04             	sub    $0x4,%edi
+  8009b4:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009b7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009ba:	fd                   	std
+  8009bb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009bd:	eb 09                	jmp    8009c8 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009bf:	83 ef 01             	sub    $0x1,%edi
+  8009c2:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009c5:	fd                   	std
+  8009c6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009c8:	fc                   	cld
+  8009c9:	eb 1a                	jmp    8009e5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009cb:	89 f2                	mov    %esi,%edx
+  8009cd:	09 c2                	or     %eax,%edx
+  8009cf:	09 ca                	or     %ecx,%edx
+  8009d1:	f6 c2 03             	test   $0x3,%dl
+  8009d4:	75 0a                	jne    8009e0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009d6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009d9:	89 c7                	mov    %eax,%edi
+  8009db:	fc                   	cld
+  8009dc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009de:	eb 05                	jmp    8009e5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009e0:	89 c7                	mov    %eax,%edi
+  8009e2:	fc                   	cld
+  8009e3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009e5:	5e                   	pop    %esi
+  8009e6:	5f                   	pop    %edi
+  8009e7:	5d                   	pop    %ebp
+  8009e8:	c3                   	ret
+
+008009e9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009e9:	55                   	push   %ebp
+  8009ea:	89 e5                	mov    %esp,%ebp
+  8009ec:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009ef:	ff 75 10             	push   0x10(%ebp)
+  8009f2:	ff 75 0c             	push   0xc(%ebp)
+  8009f5:	ff 75 08             	push   0x8(%ebp)
+  8009f8:	e8 8a ff ff ff       	call   800987 <memmove>
+}
+  8009fd:	c9                   	leave
+  8009fe:	c3                   	ret
+
+008009ff <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009ff:	55                   	push   %ebp
+  800a00:	89 e5                	mov    %esp,%ebp
+  800a02:	56                   	push   %esi
+  800a03:	53                   	push   %ebx
+  800a04:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a07:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a0a:	89 c6                	mov    %eax,%esi
+  800a0c:	03 75 10             	add    0x10(%ebp),%esi
+  800a0f:	eb 06                	jmp    800a17 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a11:	83 c0 01             	add    $0x1,%eax
+  800a14:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a17:	39 f0                	cmp    %esi,%eax
+  800a19:	74 14                	je     800a2f <memcmp+0x30>
+		if (*s1 != *s2)
+  800a1b:	0f b6 08             	movzbl (%eax),%ecx
+  800a1e:	0f b6 1a             	movzbl (%edx),%ebx
+  800a21:	38 d9                	cmp    %bl,%cl
+  800a23:	74 ec                	je     800a11 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a25:	0f b6 c1             	movzbl %cl,%eax
+  800a28:	0f b6 db             	movzbl %bl,%ebx
+  800a2b:	29 d8                	sub    %ebx,%eax
+  800a2d:	eb 05                	jmp    800a34 <memcmp+0x35>
+	}
+
+	return 0;
+  800a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a34:	5b                   	pop    %ebx
+  800a35:	5e                   	pop    %esi
+  800a36:	5d                   	pop    %ebp
+  800a37:	c3                   	ret
+
+00800a38 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a38:	55                   	push   %ebp
+  800a39:	89 e5                	mov    %esp,%ebp
+  800a3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a41:	89 c2                	mov    %eax,%edx
+  800a43:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a46:	eb 03                	jmp    800a4b <memfind+0x13>
+  800a48:	83 c0 01             	add    $0x1,%eax
+  800a4b:	39 d0                	cmp    %edx,%eax
+  800a4d:	73 04                	jae    800a53 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a4f:	38 08                	cmp    %cl,(%eax)
+  800a51:	75 f5                	jne    800a48 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a53:	5d                   	pop    %ebp
+  800a54:	c3                   	ret
+
+00800a55 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a55:	55                   	push   %ebp
+  800a56:	89 e5                	mov    %esp,%ebp
+  800a58:	57                   	push   %edi
+  800a59:	56                   	push   %esi
+  800a5a:	53                   	push   %ebx
+  800a5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a61:	eb 03                	jmp    800a66 <strtol+0x11>
+		s++;
+  800a63:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a66:	0f b6 02             	movzbl (%edx),%eax
+  800a69:	3c 20                	cmp    $0x20,%al
+  800a6b:	74 f6                	je     800a63 <strtol+0xe>
+  800a6d:	3c 09                	cmp    $0x9,%al
+  800a6f:	74 f2                	je     800a63 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a71:	3c 2b                	cmp    $0x2b,%al
+  800a73:	74 2a                	je     800a9f <strtol+0x4a>
+	int neg = 0;
+  800a75:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a7a:	3c 2d                	cmp    $0x2d,%al
+  800a7c:	74 2b                	je     800aa9 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a7e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a84:	75 0f                	jne    800a95 <strtol+0x40>
+  800a86:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a89:	74 28                	je     800ab3 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a8b:	85 db                	test   %ebx,%ebx
+  800a8d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a92:	0f 44 d8             	cmove  %eax,%ebx
+  800a95:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a9a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a9d:	eb 46                	jmp    800ae5 <strtol+0x90>
+		s++;
+  800a9f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800aa2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800aa7:	eb d5                	jmp    800a7e <strtol+0x29>
+		s++, neg = 1;
+  800aa9:	83 c2 01             	add    $0x1,%edx
+  800aac:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ab1:	eb cb                	jmp    800a7e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ab3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ab7:	74 0e                	je     800ac7 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ab9:	85 db                	test   %ebx,%ebx
+  800abb:	75 d8                	jne    800a95 <strtol+0x40>
+		s++, base = 8;
+  800abd:	83 c2 01             	add    $0x1,%edx
+  800ac0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ac5:	eb ce                	jmp    800a95 <strtol+0x40>
+		s += 2, base = 16;
+  800ac7:	83 c2 02             	add    $0x2,%edx
+  800aca:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800acf:	eb c4                	jmp    800a95 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ad1:	0f be c0             	movsbl %al,%eax
+  800ad4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ad7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ada:	7d 3a                	jge    800b16 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800adc:	83 c2 01             	add    $0x1,%edx
+  800adf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ae3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ae5:	0f b6 02             	movzbl (%edx),%eax
+  800ae8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800aeb:	89 f3                	mov    %esi,%ebx
+  800aed:	80 fb 09             	cmp    $0x9,%bl
+  800af0:	76 df                	jbe    800ad1 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800af2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800af5:	89 f3                	mov    %esi,%ebx
+  800af7:	80 fb 19             	cmp    $0x19,%bl
+  800afa:	77 08                	ja     800b04 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800afc:	0f be c0             	movsbl %al,%eax
+  800aff:	83 e8 57             	sub    $0x57,%eax
+  800b02:	eb d3                	jmp    800ad7 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b04:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b07:	89 f3                	mov    %esi,%ebx
+  800b09:	80 fb 19             	cmp    $0x19,%bl
+  800b0c:	77 08                	ja     800b16 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b0e:	0f be c0             	movsbl %al,%eax
+  800b11:	83 e8 37             	sub    $0x37,%eax
+  800b14:	eb c1                	jmp    800ad7 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b16:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b1a:	74 05                	je     800b21 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b1f:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b21:	89 c8                	mov    %ecx,%eax
+  800b23:	f7 d8                	neg    %eax
+  800b25:	85 ff                	test   %edi,%edi
+  800b27:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b2a:	89 c8                	mov    %ecx,%eax
+  800b2c:	5b                   	pop    %ebx
+  800b2d:	5e                   	pop    %esi
+  800b2e:	5f                   	pop    %edi
+  800b2f:	5d                   	pop    %ebp
+  800b30:	c3                   	ret
+
+00800b31 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800b31:	55                   	push   %ebp
+  800b32:	89 e5                	mov    %esp,%ebp
+  800b34:	57                   	push   %edi
+  800b35:	56                   	push   %esi
+  800b36:	53                   	push   %ebx
+  800b37:	83 ec 0c             	sub    $0xc,%esp
+  800b3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b3d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b40:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800b43:	85 ff                	test   %edi,%edi
+  800b45:	74 16                	je     800b5d <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800b47:	83 ec 04             	sub    $0x4,%esp
+  800b4a:	56                   	push   %esi
+  800b4b:	6a 00                	push   $0x0
+  800b4d:	53                   	push   %ebx
+  800b4e:	e8 02 ff ff ff       	call   800a55 <strtol>
+  800b53:	89 07                	mov    %eax,(%edi)
+  800b55:	83 c4 10             	add    $0x10,%esp
+  800b58:	eb 03                	jmp    800b5d <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800b5a:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800b5d:	0f b6 03             	movzbl (%ebx),%eax
+  800b60:	3c 20                	cmp    $0x20,%al
+  800b62:	74 f6                	je     800b5a <strisl+0x29>
+  800b64:	3c 09                	cmp    $0x9,%al
+  800b66:	74 f2                	je     800b5a <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b68:	3c 2b                	cmp    $0x2b,%al
+  800b6a:	74 23                	je     800b8f <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800b6c:	3c 2d                	cmp    $0x2d,%al
+  800b6e:	0f 94 c0             	sete   %al
+  800b71:	0f b6 c0             	movzbl %al,%eax
+  800b74:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b76:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800b7c:	75 41                	jne    800bbf <strisl+0x8e>
+  800b7e:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800b81:	74 11                	je     800b94 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b83:	85 f6                	test   %esi,%esi
+  800b85:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b8a:	0f 44 f0             	cmove  %eax,%esi
+  800b8d:	eb 30                	jmp    800bbf <strisl+0x8e>
+		s++;
+  800b8f:	83 c3 01             	add    $0x1,%ebx
+  800b92:	eb e2                	jmp    800b76 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b94:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800b98:	74 0e                	je     800ba8 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800b9a:	85 f6                	test   %esi,%esi
+  800b9c:	75 21                	jne    800bbf <strisl+0x8e>
+		s++, base = 8;
+  800b9e:	83 c3 01             	add    $0x1,%ebx
+  800ba1:	be 08 00 00 00       	mov    $0x8,%esi
+  800ba6:	eb 17                	jmp    800bbf <strisl+0x8e>
+		s += 2, base = 16;
+  800ba8:	83 c3 02             	add    $0x2,%ebx
+  800bab:	be 10 00 00 00       	mov    $0x10,%esi
+  800bb0:	eb 0d                	jmp    800bbf <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bb2:	0f be c0             	movsbl %al,%eax
+  800bb5:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800bb8:	39 f0                	cmp    %esi,%eax
+  800bba:	7d 38                	jge    800bf4 <strisl+0xc3>
+			return 0;
+		s++;
+  800bbc:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800bbf:	0f b6 03             	movzbl (%ebx),%eax
+  800bc2:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800bc5:	80 fa 09             	cmp    $0x9,%dl
+  800bc8:	76 e8                	jbe    800bb2 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800bca:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800bcd:	80 fa 19             	cmp    $0x19,%dl
+  800bd0:	77 08                	ja     800bda <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800bd2:	0f be c0             	movsbl %al,%eax
+  800bd5:	83 e8 57             	sub    $0x57,%eax
+  800bd8:	eb de                	jmp    800bb8 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bda:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800bdd:	80 fa 19             	cmp    $0x19,%dl
+  800be0:	77 08                	ja     800bea <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800be2:	0f be c0             	movsbl %al,%eax
+  800be5:	83 e8 37             	sub    $0x37,%eax
+  800be8:	eb ce                	jmp    800bb8 <strisl+0x87>
+		else if (!*s)
+  800bea:	84 c0                	test   %al,%al
+  800bec:	0f 94 c0             	sete   %al
+  800bef:	0f b6 c0             	movzbl %al,%eax
+  800bf2:	eb 05                	jmp    800bf9 <strisl+0xc8>
+			return 0;
+  800bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800bf9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bfc:	5b                   	pop    %ebx
+  800bfd:	5e                   	pop    %esi
+  800bfe:	5f                   	pop    %edi
+  800bff:	5d                   	pop    %ebp
+  800c00:	c3                   	ret
+
+00800c01 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800c01:	55                   	push   %ebp
+  800c02:	89 e5                	mov    %esp,%ebp
+  800c04:	83 ec 10             	sub    $0x10,%esp
+  800c07:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c0a:	89 c8                	mov    %ecx,%eax
+  800c0c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800c11:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800c14:	eb 0b                	jmp    800c21 <touch_mem+0x20>
+		c = *(char *)page;
+  800c16:	0f b6 10             	movzbl (%eax),%edx
+  800c19:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800c1c:	05 00 10 00 00       	add    $0x1000,%eax
+  800c21:	39 c8                	cmp    %ecx,%eax
+  800c23:	72 f1                	jb     800c16 <touch_mem+0x15>
+}
+  800c25:	c9                   	leave
+  800c26:	c3                   	ret
+
+00800c27 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c27:	55                   	push   %ebp
+  800c28:	89 e5                	mov    %esp,%ebp
+  800c2a:	57                   	push   %edi
+  800c2b:	56                   	push   %esi
+  800c2c:	53                   	push   %ebx
+	touch_mem(s, len);
+  800c2d:	ff 75 0c             	push   0xc(%ebp)
+  800c30:	ff 75 08             	push   0x8(%ebp)
+  800c33:	e8 c9 ff ff ff       	call   800c01 <touch_mem>
+	asm volatile("int %1\n"
+  800c38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c43:	89 c3                	mov    %eax,%ebx
+  800c45:	89 c7                	mov    %eax,%edi
+  800c47:	89 c6                	mov    %eax,%esi
+  800c49:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c4b:	83 c4 08             	add    $0x8,%esp
+  800c4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c51:	5b                   	pop    %ebx
+  800c52:	5e                   	pop    %esi
+  800c53:	5f                   	pop    %edi
+  800c54:	5d                   	pop    %ebp
+  800c55:	c3                   	ret
+
+00800c56 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c56:	55                   	push   %ebp
+  800c57:	89 e5                	mov    %esp,%ebp
+  800c59:	57                   	push   %edi
+  800c5a:	56                   	push   %esi
+  800c5b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c61:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c66:	89 d1                	mov    %edx,%ecx
+  800c68:	89 d3                	mov    %edx,%ebx
+  800c6a:	89 d7                	mov    %edx,%edi
+  800c6c:	89 d6                	mov    %edx,%esi
+  800c6e:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c70:	5b                   	pop    %ebx
+  800c71:	5e                   	pop    %esi
+  800c72:	5f                   	pop    %edi
+  800c73:	5d                   	pop    %ebp
+  800c74:	c3                   	ret
+
+00800c75 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c75:	55                   	push   %ebp
+  800c76:	89 e5                	mov    %esp,%ebp
+  800c78:	57                   	push   %edi
+  800c79:	56                   	push   %esi
+  800c7a:	53                   	push   %ebx
+  800c7b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c86:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c8b:	89 cb                	mov    %ecx,%ebx
+  800c8d:	89 cf                	mov    %ecx,%edi
+  800c8f:	89 ce                	mov    %ecx,%esi
+  800c91:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c93:	85 c0                	test   %eax,%eax
+  800c95:	7f 08                	jg     800c9f <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9a:	5b                   	pop    %ebx
+  800c9b:	5e                   	pop    %esi
+  800c9c:	5f                   	pop    %edi
+  800c9d:	5d                   	pop    %ebp
+  800c9e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c9f:	83 ec 0c             	sub    $0xc,%esp
+  800ca2:	50                   	push   %eax
+  800ca3:	6a 03                	push   $0x3
+  800ca5:	68 8b 2b 80 00       	push   $0x802b8b
+  800caa:	6a 23                	push   $0x23
+  800cac:	68 a8 2b 80 00       	push   $0x802ba8
+  800cb1:	e8 89 f4 ff ff       	call   80013f <_panic>
+
+00800cb6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cb6:	55                   	push   %ebp
+  800cb7:	89 e5                	mov    %esp,%ebp
+  800cb9:	57                   	push   %edi
+  800cba:	56                   	push   %esi
+  800cbb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc1:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cc6:	89 d1                	mov    %edx,%ecx
+  800cc8:	89 d3                	mov    %edx,%ebx
+  800cca:	89 d7                	mov    %edx,%edi
+  800ccc:	89 d6                	mov    %edx,%esi
+  800cce:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cd0:	5b                   	pop    %ebx
+  800cd1:	5e                   	pop    %esi
+  800cd2:	5f                   	pop    %edi
+  800cd3:	5d                   	pop    %ebp
+  800cd4:	c3                   	ret
+
+00800cd5 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cd5:	55                   	push   %ebp
+  800cd6:	89 e5                	mov    %esp,%ebp
+  800cd8:	57                   	push   %edi
+  800cd9:	56                   	push   %esi
+  800cda:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ce5:	89 d1                	mov    %edx,%ecx
+  800ce7:	89 d3                	mov    %edx,%ebx
+  800ce9:	89 d7                	mov    %edx,%edi
+  800ceb:	89 d6                	mov    %edx,%esi
+  800ced:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cef:	5b                   	pop    %ebx
+  800cf0:	5e                   	pop    %esi
+  800cf1:	5f                   	pop    %edi
+  800cf2:	5d                   	pop    %ebp
+  800cf3:	c3                   	ret
+
+00800cf4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cf4:	55                   	push   %ebp
+  800cf5:	89 e5                	mov    %esp,%ebp
+  800cf7:	57                   	push   %edi
+  800cf8:	56                   	push   %esi
+  800cf9:	53                   	push   %ebx
+  800cfa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cfd:	be 00 00 00 00       	mov    $0x0,%esi
+  800d02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d05:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d08:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d10:	89 f7                	mov    %esi,%edi
+  800d12:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d14:	85 c0                	test   %eax,%eax
+  800d16:	7f 08                	jg     800d20 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1b:	5b                   	pop    %ebx
+  800d1c:	5e                   	pop    %esi
+  800d1d:	5f                   	pop    %edi
+  800d1e:	5d                   	pop    %ebp
+  800d1f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d20:	83 ec 0c             	sub    $0xc,%esp
+  800d23:	50                   	push   %eax
+  800d24:	6a 04                	push   $0x4
+  800d26:	68 8b 2b 80 00       	push   $0x802b8b
+  800d2b:	6a 23                	push   $0x23
+  800d2d:	68 a8 2b 80 00       	push   $0x802ba8
+  800d32:	e8 08 f4 ff ff       	call   80013f <_panic>
+
+00800d37 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d37:	55                   	push   %ebp
+  800d38:	89 e5                	mov    %esp,%ebp
+  800d3a:	57                   	push   %edi
+  800d3b:	56                   	push   %esi
+  800d3c:	53                   	push   %ebx
+  800d3d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d46:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d4b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d4e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d51:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d54:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d56:	85 c0                	test   %eax,%eax
+  800d58:	7f 08                	jg     800d62 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d5d:	5b                   	pop    %ebx
+  800d5e:	5e                   	pop    %esi
+  800d5f:	5f                   	pop    %edi
+  800d60:	5d                   	pop    %ebp
+  800d61:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d62:	83 ec 0c             	sub    $0xc,%esp
+  800d65:	50                   	push   %eax
+  800d66:	6a 05                	push   $0x5
+  800d68:	68 8b 2b 80 00       	push   $0x802b8b
+  800d6d:	6a 23                	push   $0x23
+  800d6f:	68 a8 2b 80 00       	push   $0x802ba8
+  800d74:	e8 c6 f3 ff ff       	call   80013f <_panic>
+
+00800d79 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d79:	55                   	push   %ebp
+  800d7a:	89 e5                	mov    %esp,%ebp
+  800d7c:	57                   	push   %edi
+  800d7d:	56                   	push   %esi
+  800d7e:	53                   	push   %ebx
+  800d7f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d92:	89 df                	mov    %ebx,%edi
+  800d94:	89 de                	mov    %ebx,%esi
+  800d96:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d98:	85 c0                	test   %eax,%eax
+  800d9a:	7f 08                	jg     800da4 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9f:	5b                   	pop    %ebx
+  800da0:	5e                   	pop    %esi
+  800da1:	5f                   	pop    %edi
+  800da2:	5d                   	pop    %ebp
+  800da3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da4:	83 ec 0c             	sub    $0xc,%esp
+  800da7:	50                   	push   %eax
+  800da8:	6a 06                	push   $0x6
+  800daa:	68 8b 2b 80 00       	push   $0x802b8b
+  800daf:	6a 23                	push   $0x23
+  800db1:	68 a8 2b 80 00       	push   $0x802ba8
+  800db6:	e8 84 f3 ff ff       	call   80013f <_panic>
+
+00800dbb <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800dbb:	55                   	push   %ebp
+  800dbc:	89 e5                	mov    %esp,%ebp
+  800dbe:	57                   	push   %edi
+  800dbf:	56                   	push   %esi
+  800dc0:	53                   	push   %ebx
+  800dc1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcf:	b8 18 00 00 00       	mov    $0x18,%eax
+  800dd4:	89 df                	mov    %ebx,%edi
+  800dd6:	89 de                	mov    %ebx,%esi
+  800dd8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dda:	85 c0                	test   %eax,%eax
+  800ddc:	7f 08                	jg     800de6 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800dde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de1:	5b                   	pop    %ebx
+  800de2:	5e                   	pop    %esi
+  800de3:	5f                   	pop    %edi
+  800de4:	5d                   	pop    %ebp
+  800de5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de6:	83 ec 0c             	sub    $0xc,%esp
+  800de9:	50                   	push   %eax
+  800dea:	6a 18                	push   $0x18
+  800dec:	68 8b 2b 80 00       	push   $0x802b8b
+  800df1:	6a 23                	push   $0x23
+  800df3:	68 a8 2b 80 00       	push   $0x802ba8
+  800df8:	e8 42 f3 ff ff       	call   80013f <_panic>
+
+00800dfd <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800dfd:	55                   	push   %ebp
+  800dfe:	89 e5                	mov    %esp,%ebp
+  800e00:	57                   	push   %edi
+  800e01:	56                   	push   %esi
+  800e02:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e03:	be 00 00 00 00       	mov    $0x0,%esi
+  800e08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0e:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e13:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e16:	89 f7                	mov    %esi,%edi
+  800e18:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800e1a:	5b                   	pop    %ebx
+  800e1b:	5e                   	pop    %esi
+  800e1c:	5f                   	pop    %edi
+  800e1d:	5d                   	pop    %ebp
+  800e1e:	c3                   	ret
+
+00800e1f <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800e1f:	55                   	push   %ebp
+  800e20:	89 e5                	mov    %esp,%ebp
+  800e22:	57                   	push   %edi
+  800e23:	56                   	push   %esi
+  800e24:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e30:	be 00 00 00 00       	mov    $0x0,%esi
+  800e35:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e38:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e3b:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800e3d:	5b                   	pop    %ebx
+  800e3e:	5e                   	pop    %esi
+  800e3f:	5f                   	pop    %edi
+  800e40:	5d                   	pop    %ebp
+  800e41:	c3                   	ret
+
+00800e42 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800e42:	55                   	push   %ebp
+  800e43:	89 e5                	mov    %esp,%ebp
+  800e45:	57                   	push   %edi
+  800e46:	56                   	push   %esi
+  800e47:	53                   	push   %ebx
+  800e48:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800e4b:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800e4e:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800e54:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800e57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e62:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e65:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e68:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e6a:	85 c0                	test   %eax,%eax
+  800e6c:	7f 08                	jg     800e76 <sys_page_map_range+0x34>
+}
+  800e6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e71:	5b                   	pop    %ebx
+  800e72:	5e                   	pop    %esi
+  800e73:	5f                   	pop    %edi
+  800e74:	5d                   	pop    %ebp
+  800e75:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e76:	83 ec 0c             	sub    $0xc,%esp
+  800e79:	50                   	push   %eax
+  800e7a:	6a 10                	push   $0x10
+  800e7c:	68 8b 2b 80 00       	push   $0x802b8b
+  800e81:	6a 23                	push   $0x23
+  800e83:	68 a8 2b 80 00       	push   $0x802ba8
+  800e88:	e8 b2 f2 ff ff       	call   80013f <_panic>
+
+00800e8d <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e8d:	55                   	push   %ebp
+  800e8e:	89 e5                	mov    %esp,%ebp
+  800e90:	57                   	push   %edi
+  800e91:	56                   	push   %esi
+  800e92:	53                   	push   %ebx
+  800e93:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e96:	be 00 00 00 00       	mov    $0x0,%esi
+  800e9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea1:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ea6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea9:	89 f7                	mov    %esi,%edi
+  800eab:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ead:	85 c0                	test   %eax,%eax
+  800eaf:	7f 08                	jg     800eb9 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800eb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb4:	5b                   	pop    %ebx
+  800eb5:	5e                   	pop    %esi
+  800eb6:	5f                   	pop    %edi
+  800eb7:	5d                   	pop    %ebp
+  800eb8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb9:	83 ec 0c             	sub    $0xc,%esp
+  800ebc:	50                   	push   %eax
+  800ebd:	6a 11                	push   $0x11
+  800ebf:	68 8b 2b 80 00       	push   $0x802b8b
+  800ec4:	6a 23                	push   $0x23
+  800ec6:	68 a8 2b 80 00       	push   $0x802ba8
+  800ecb:	e8 6f f2 ff ff       	call   80013f <_panic>
+
+00800ed0 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800ed0:	55                   	push   %ebp
+  800ed1:	89 e5                	mov    %esp,%ebp
+  800ed3:	57                   	push   %edi
+  800ed4:	56                   	push   %esi
+  800ed5:	53                   	push   %ebx
+  800ed6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed9:	be 00 00 00 00       	mov    $0x0,%esi
+  800ede:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800ee9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eec:	89 f7                	mov    %esi,%edi
+  800eee:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef0:	85 c0                	test   %eax,%eax
+  800ef2:	7f 08                	jg     800efc <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800ef4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef7:	5b                   	pop    %ebx
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5f                   	pop    %edi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800efc:	83 ec 0c             	sub    $0xc,%esp
+  800eff:	50                   	push   %eax
+  800f00:	6a 1b                	push   $0x1b
+  800f02:	68 8b 2b 80 00       	push   $0x802b8b
+  800f07:	6a 23                	push   $0x23
+  800f09:	68 a8 2b 80 00       	push   $0x802ba8
+  800f0e:	e8 2c f2 ff ff       	call   80013f <_panic>
+
+00800f13 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	57                   	push   %edi
+  800f17:	56                   	push   %esi
+  800f18:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f19:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f1e:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f23:	89 d1                	mov    %edx,%ecx
+  800f25:	89 d3                	mov    %edx,%ebx
+  800f27:	89 d7                	mov    %edx,%edi
+  800f29:	89 d6                	mov    %edx,%esi
+  800f2b:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f2d:	5b                   	pop    %ebx
+  800f2e:	5e                   	pop    %esi
+  800f2f:	5f                   	pop    %edi
+  800f30:	5d                   	pop    %ebp
+  800f31:	c3                   	ret
+
+00800f32 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f32:	55                   	push   %ebp
+  800f33:	89 e5                	mov    %esp,%ebp
+  800f35:	57                   	push   %edi
+  800f36:	56                   	push   %esi
+  800f37:	53                   	push   %ebx
+  800f38:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f46:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f4b:	89 df                	mov    %ebx,%edi
+  800f4d:	89 de                	mov    %ebx,%esi
+  800f4f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f51:	85 c0                	test   %eax,%eax
+  800f53:	7f 08                	jg     800f5d <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f58:	5b                   	pop    %ebx
+  800f59:	5e                   	pop    %esi
+  800f5a:	5f                   	pop    %edi
+  800f5b:	5d                   	pop    %ebp
+  800f5c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5d:	83 ec 0c             	sub    $0xc,%esp
+  800f60:	50                   	push   %eax
+  800f61:	6a 08                	push   $0x8
+  800f63:	68 8b 2b 80 00       	push   $0x802b8b
+  800f68:	6a 23                	push   $0x23
+  800f6a:	68 a8 2b 80 00       	push   $0x802ba8
+  800f6f:	e8 cb f1 ff ff       	call   80013f <_panic>
+
+00800f74 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	57                   	push   %edi
+  800f78:	56                   	push   %esi
+  800f79:	53                   	push   %ebx
+  800f7a:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800f7d:	6a 44                	push   $0x44
+  800f7f:	ff 75 0c             	push   0xc(%ebp)
+  800f82:	e8 7a fc ff ff       	call   800c01 <touch_mem>
+	asm volatile("int %1\n"
+  800f87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8f:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f97:	89 df                	mov    %ebx,%edi
+  800f99:	89 de                	mov    %ebx,%esi
+  800f9b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f9d:	83 c4 08             	add    $0x8,%esp
+  800fa0:	85 c0                	test   %eax,%eax
+  800fa2:	7f 08                	jg     800fac <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fa4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa7:	5b                   	pop    %ebx
+  800fa8:	5e                   	pop    %esi
+  800fa9:	5f                   	pop    %edi
+  800faa:	5d                   	pop    %ebp
+  800fab:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fac:	83 ec 0c             	sub    $0xc,%esp
+  800faf:	50                   	push   %eax
+  800fb0:	6a 09                	push   $0x9
+  800fb2:	68 8b 2b 80 00       	push   $0x802b8b
+  800fb7:	6a 23                	push   $0x23
+  800fb9:	68 a8 2b 80 00       	push   $0x802ba8
+  800fbe:	e8 7c f1 ff ff       	call   80013f <_panic>
+
+00800fc3 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800fc3:	55                   	push   %ebp
+  800fc4:	89 e5                	mov    %esp,%ebp
+  800fc6:	57                   	push   %edi
+  800fc7:	56                   	push   %esi
+  800fc8:	53                   	push   %ebx
+  800fc9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fcc:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800fdc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fdf:	89 f7                	mov    %esi,%edi
+  800fe1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fe3:	85 c0                	test   %eax,%eax
+  800fe5:	7f 08                	jg     800fef <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800fe7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fea:	5b                   	pop    %ebx
+  800feb:	5e                   	pop    %esi
+  800fec:	5f                   	pop    %edi
+  800fed:	5d                   	pop    %ebp
+  800fee:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fef:	83 ec 0c             	sub    $0xc,%esp
+  800ff2:	50                   	push   %eax
+  800ff3:	6a 1a                	push   $0x1a
+  800ff5:	68 8b 2b 80 00       	push   $0x802b8b
+  800ffa:	6a 23                	push   $0x23
+  800ffc:	68 a8 2b 80 00       	push   $0x802ba8
+  801001:	e8 39 f1 ff ff       	call   80013f <_panic>
+
+00801006 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  801006:	55                   	push   %ebp
+  801007:	89 e5                	mov    %esp,%ebp
+  801009:	57                   	push   %edi
+  80100a:	56                   	push   %esi
+  80100b:	53                   	push   %ebx
+  80100c:	83 ec 0c             	sub    $0xc,%esp
+  80100f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801012:	89 d8                	mov    %ebx,%eax
+  801014:	c1 e0 05             	shl    $0x5,%eax
+  801017:	50                   	push   %eax
+  801018:	ff 75 0c             	push   0xc(%ebp)
+  80101b:	e8 e1 fb ff ff       	call   800c01 <touch_mem>
+	asm volatile("int %1\n"
+  801020:	be 00 00 00 00       	mov    $0x0,%esi
+  801025:	8b 55 08             	mov    0x8(%ebp),%edx
+  801028:	b8 13 00 00 00       	mov    $0x13,%eax
+  80102d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801030:	89 f7                	mov    %esi,%edi
+  801032:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801034:	83 c4 08             	add    $0x8,%esp
+  801037:	85 c0                	test   %eax,%eax
+  801039:	7f 08                	jg     801043 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  80103b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103e:	5b                   	pop    %ebx
+  80103f:	5e                   	pop    %esi
+  801040:	5f                   	pop    %edi
+  801041:	5d                   	pop    %ebp
+  801042:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801043:	83 ec 0c             	sub    $0xc,%esp
+  801046:	50                   	push   %eax
+  801047:	6a 13                	push   $0x13
+  801049:	68 8b 2b 80 00       	push   $0x802b8b
+  80104e:	6a 23                	push   $0x23
+  801050:	68 a8 2b 80 00       	push   $0x802ba8
+  801055:	e8 e5 f0 ff ff       	call   80013f <_panic>
+
+0080105a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80105a:	55                   	push   %ebp
+  80105b:	89 e5                	mov    %esp,%ebp
+  80105d:	57                   	push   %edi
+  80105e:	56                   	push   %esi
+  80105f:	53                   	push   %ebx
+  801060:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801063:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801068:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801073:	89 df                	mov    %ebx,%edi
+  801075:	89 de                	mov    %ebx,%esi
+  801077:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801079:	85 c0                	test   %eax,%eax
+  80107b:	7f 08                	jg     801085 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80107d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801080:	5b                   	pop    %ebx
+  801081:	5e                   	pop    %esi
+  801082:	5f                   	pop    %edi
+  801083:	5d                   	pop    %ebp
+  801084:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801085:	83 ec 0c             	sub    $0xc,%esp
+  801088:	50                   	push   %eax
+  801089:	6a 0a                	push   $0xa
+  80108b:	68 8b 2b 80 00       	push   $0x802b8b
+  801090:	6a 23                	push   $0x23
+  801092:	68 a8 2b 80 00       	push   $0x802ba8
+  801097:	e8 a3 f0 ff ff       	call   80013f <_panic>
+
+0080109c <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80109c:	55                   	push   %ebp
+  80109d:	89 e5                	mov    %esp,%ebp
+  80109f:	57                   	push   %edi
+  8010a0:	56                   	push   %esi
+  8010a1:	53                   	push   %ebx
+  8010a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  8010a5:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010ab:	76 1d                	jbe    8010ca <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  8010ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010b8:	be 01 00 00 00       	mov    $0x1,%esi
+  8010bd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c0:	cd 30                	int    $0x30
+}
+  8010c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c5:	5b                   	pop    %ebx
+  8010c6:	5e                   	pop    %esi
+  8010c7:	5f                   	pop    %edi
+  8010c8:	5d                   	pop    %ebp
+  8010c9:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8010ca:	68 00 10 00 00       	push   $0x1000
+  8010cf:	53                   	push   %ebx
+  8010d0:	e8 2c fb ff ff       	call   800c01 <touch_mem>
+  8010d5:	83 c4 08             	add    $0x8,%esp
+  8010d8:	eb d3                	jmp    8010ad <sys_ipc_send+0x11>
+
+008010da <sys_ipc_send_pages>:
+{
+  8010da:	55                   	push   %ebp
+  8010db:	89 e5                	mov    %esp,%ebp
+  8010dd:	57                   	push   %edi
+  8010de:	56                   	push   %esi
+  8010df:	53                   	push   %ebx
+  8010e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e3:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8010e6:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010ec:	76 18                	jbe    801106 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8010ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010f9:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8010fc:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8010fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801101:	5b                   	pop    %ebx
+  801102:	5e                   	pop    %esi
+  801103:	5f                   	pop    %edi
+  801104:	5d                   	pop    %ebp
+  801105:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801106:	89 f0                	mov    %esi,%eax
+  801108:	c1 e0 0c             	shl    $0xc,%eax
+  80110b:	50                   	push   %eax
+  80110c:	53                   	push   %ebx
+  80110d:	e8 ef fa ff ff       	call   800c01 <touch_mem>
+  801112:	83 c4 08             	add    $0x8,%esp
+  801115:	eb d7                	jmp    8010ee <sys_ipc_send_pages+0x14>
+
+00801117 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801117:	55                   	push   %ebp
+  801118:	89 e5                	mov    %esp,%ebp
+  80111a:	57                   	push   %edi
+  80111b:	56                   	push   %esi
+  80111c:	53                   	push   %ebx
+  80111d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801120:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801125:	8b 55 08             	mov    0x8(%ebp),%edx
+  801128:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801130:	89 df                	mov    %ebx,%edi
+  801132:	89 de                	mov    %ebx,%esi
+  801134:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801136:	85 c0                	test   %eax,%eax
+  801138:	7f 08                	jg     801142 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  80113a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80113d:	5b                   	pop    %ebx
+  80113e:	5e                   	pop    %esi
+  80113f:	5f                   	pop    %edi
+  801140:	5d                   	pop    %ebp
+  801141:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801142:	83 ec 0c             	sub    $0xc,%esp
+  801145:	50                   	push   %eax
+  801146:	6a 0d                	push   $0xd
+  801148:	68 8b 2b 80 00       	push   $0x802b8b
+  80114d:	6a 23                	push   $0x23
+  80114f:	68 a8 2b 80 00       	push   $0x802ba8
+  801154:	e8 e6 ef ff ff       	call   80013f <_panic>
+
+00801159 <sys_ipc_recv>:
+{
+  801159:	55                   	push   %ebp
+  80115a:	89 e5                	mov    %esp,%ebp
+  80115c:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80115f:	6a 01                	push   $0x1
+  801161:	ff 75 08             	push   0x8(%ebp)
+  801164:	e8 ae ff ff ff       	call   801117 <sys_ipc_recv_pages>
+}
+  801169:	c9                   	leave
+  80116a:	c3                   	ret
+
+0080116b <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80116b:	55                   	push   %ebp
+  80116c:	89 e5                	mov    %esp,%ebp
+  80116e:	57                   	push   %edi
+  80116f:	56                   	push   %esi
+  801170:	53                   	push   %ebx
+  801171:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801174:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801177:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  80117a:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801180:	77 04                	ja     801186 <sys_ipc_call+0x1b>
+  801182:	85 f6                	test   %esi,%esi
+  801184:	75 15                	jne    80119b <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801186:	8b 55 08             	mov    0x8(%ebp),%edx
+  801189:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801191:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801193:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801196:	5b                   	pop    %ebx
+  801197:	5e                   	pop    %esi
+  801198:	5f                   	pop    %edi
+  801199:	5d                   	pop    %ebp
+  80119a:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80119b:	89 f8                	mov    %edi,%eax
+  80119d:	c1 e0 0c             	shl    $0xc,%eax
+  8011a0:	50                   	push   %eax
+  8011a1:	53                   	push   %ebx
+  8011a2:	e8 5a fa ff ff       	call   800c01 <touch_mem>
+  8011a7:	83 c4 08             	add    $0x8,%esp
+  8011aa:	eb da                	jmp    801186 <sys_ipc_call+0x1b>
+
+008011ac <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8011ac:	55                   	push   %ebp
+  8011ad:	89 e5                	mov    %esp,%ebp
+  8011af:	57                   	push   %edi
+  8011b0:	56                   	push   %esi
+  8011b1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b8:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011c3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011c6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8011c8:	5b                   	pop    %ebx
+  8011c9:	5e                   	pop    %esi
+  8011ca:	5f                   	pop    %edi
+  8011cb:	5d                   	pop    %ebp
+  8011cc:	c3                   	ret
+
+008011cd <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8011cd:	55                   	push   %ebp
+  8011ce:	89 e5                	mov    %esp,%ebp
+  8011d0:	57                   	push   %edi
+  8011d1:	56                   	push   %esi
+  8011d2:	53                   	push   %ebx
+  8011d3:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8011d6:	6a 04                	push   $0x4
+  8011d8:	ff 75 08             	push   0x8(%ebp)
+  8011db:	e8 21 fa ff ff       	call   800c01 <touch_mem>
+	asm volatile("int %1\n"
+  8011e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e8:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011f3:	89 f7                	mov    %esi,%edi
+  8011f5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011f7:	83 c4 08             	add    $0x8,%esp
+  8011fa:	85 c0                	test   %eax,%eax
+  8011fc:	7f 08                	jg     801206 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8011fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801201:	5b                   	pop    %ebx
+  801202:	5e                   	pop    %esi
+  801203:	5f                   	pop    %edi
+  801204:	5d                   	pop    %ebp
+  801205:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801206:	83 ec 0c             	sub    $0xc,%esp
+  801209:	50                   	push   %eax
+  80120a:	6a 16                	push   $0x16
+  80120c:	68 8b 2b 80 00       	push   $0x802b8b
+  801211:	6a 23                	push   $0x23
+  801213:	68 a8 2b 80 00       	push   $0x802ba8
+  801218:	e8 22 ef ff ff       	call   80013f <_panic>
+
+0080121d <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80121d:	55                   	push   %ebp
+  80121e:	89 e5                	mov    %esp,%ebp
+  801220:	57                   	push   %edi
+  801221:	56                   	push   %esi
+  801222:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801223:	6a 04                	push   $0x4
+  801225:	ff 75 08             	push   0x8(%ebp)
+  801228:	e8 d4 f9 ff ff       	call   800c01 <touch_mem>
+	asm volatile("int %1\n"
+  80122d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801232:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801235:	b8 17 00 00 00       	mov    $0x17,%eax
+  80123a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123d:	89 df                	mov    %ebx,%edi
+  80123f:	89 de                	mov    %ebx,%esi
+  801241:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801243:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801246:	5b                   	pop    %ebx
+  801247:	5e                   	pop    %esi
+  801248:	5f                   	pop    %edi
+  801249:	5d                   	pop    %ebp
+  80124a:	c3                   	ret
+
+0080124b <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80124b:	55                   	push   %ebp
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	57                   	push   %edi
+  80124f:	56                   	push   %esi
+  801250:	53                   	push   %ebx
+  801251:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801254:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801259:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801261:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801266:	89 df                	mov    %ebx,%edi
+  801268:	89 de                	mov    %ebx,%esi
+  80126a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80126c:	85 c0                	test   %eax,%eax
+  80126e:	7f 08                	jg     801278 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801270:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801273:	5b                   	pop    %ebx
+  801274:	5e                   	pop    %esi
+  801275:	5f                   	pop    %edi
+  801276:	5d                   	pop    %ebp
+  801277:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801278:	83 ec 0c             	sub    $0xc,%esp
+  80127b:	50                   	push   %eax
+  80127c:	6a 0e                	push   $0xe
+  80127e:	68 8b 2b 80 00       	push   $0x802b8b
+  801283:	6a 23                	push   $0x23
+  801285:	68 a8 2b 80 00       	push   $0x802ba8
+  80128a:	e8 b0 ee ff ff       	call   80013f <_panic>
+
+0080128f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80128f:	55                   	push   %ebp
+  801290:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801292:	8b 45 08             	mov    0x8(%ebp),%eax
+  801295:	05 00 00 00 30       	add    $0x30000000,%eax
+  80129a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80129d:	5d                   	pop    %ebp
+  80129e:	c3                   	ret
+
+0080129f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80129f:	55                   	push   %ebp
+  8012a0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012a5:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8012aa:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8012af:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8012b4:	5d                   	pop    %ebp
+  8012b5:	c3                   	ret
+
+008012b6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8012b6:	55                   	push   %ebp
+  8012b7:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  8012b9:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  8012be:	a8 01                	test   $0x1,%al
+  8012c0:	74 3c                	je     8012fe <fd_alloc+0x48>
+  8012c2:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8012c7:	89 c2                	mov    %eax,%edx
+  8012c9:	c1 ea 0c             	shr    $0xc,%edx
+  8012cc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012d3:	89 c1                	mov    %eax,%ecx
+  8012d5:	05 00 10 00 00       	add    $0x1000,%eax
+  8012da:	f6 c2 01             	test   $0x1,%dl
+  8012dd:	74 13                	je     8012f2 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  8012df:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8012e4:	75 e1                	jne    8012c7 <fd_alloc+0x11>
+  8012e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8012eb:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8012f0:	eb 05                	jmp    8012f7 <fd_alloc+0x41>
+			return 0;
+  8012f2:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8012f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fa:	89 0a                	mov    %ecx,(%edx)
+}
+  8012fc:	5d                   	pop    %ebp
+  8012fd:	c3                   	ret
+  8012fe:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801303:	b8 00 00 00 00       	mov    $0x0,%eax
+  801308:	eb ed                	jmp    8012f7 <fd_alloc+0x41>
+
+0080130a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80130a:	55                   	push   %ebp
+  80130b:	89 e5                	mov    %esp,%ebp
+  80130d:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801310:	83 f8 1f             	cmp    $0x1f,%eax
+  801313:	77 30                	ja     801345 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801315:	c1 e0 0c             	shl    $0xc,%eax
+  801318:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80131d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801323:	f6 c2 01             	test   $0x1,%dl
+  801326:	74 24                	je     80134c <fd_lookup+0x42>
+  801328:	89 c2                	mov    %eax,%edx
+  80132a:	c1 ea 0c             	shr    $0xc,%edx
+  80132d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801334:	f6 c2 01             	test   $0x1,%dl
+  801337:	74 1a                	je     801353 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801339:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80133c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80133e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801343:	5d                   	pop    %ebp
+  801344:	c3                   	ret
+		return -E_INVAL;
+  801345:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80134a:	eb f7                	jmp    801343 <fd_lookup+0x39>
+		return -E_INVAL;
+  80134c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801351:	eb f0                	jmp    801343 <fd_lookup+0x39>
+  801353:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801358:	eb e9                	jmp    801343 <fd_lookup+0x39>
+
+0080135a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80135a:	55                   	push   %ebp
+  80135b:	89 e5                	mov    %esp,%ebp
+  80135d:	53                   	push   %ebx
+  80135e:	83 ec 04             	sub    $0x4,%esp
+  801361:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801364:	b8 34 2c 80 00       	mov    $0x802c34,%eax
+  801369:	8b 18                	mov    (%eax),%ebx
+  80136b:	85 db                	test   %ebx,%ebx
+  80136d:	74 0e                	je     80137d <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  80136f:	83 c0 04             	add    $0x4,%eax
+  801372:	39 13                	cmp    %edx,(%ebx)
+  801374:	75 f3                	jne    801369 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801376:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137b:	eb 1f                	jmp    80139c <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80137d:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  801382:	8b 40 48             	mov    0x48(%eax),%eax
+  801385:	83 ec 04             	sub    $0x4,%esp
+  801388:	52                   	push   %edx
+  801389:	50                   	push   %eax
+  80138a:	68 b8 2b 80 00       	push   $0x802bb8
+  80138f:	e8 86 ee ff ff       	call   80021a <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801394:	83 c4 10             	add    $0x10,%esp
+  801397:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80139c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80139f:	89 1a                	mov    %ebx,(%edx)
+}
+  8013a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013a4:	c9                   	leave
+  8013a5:	c3                   	ret
+
+008013a6 <fd_close>:
+{
+  8013a6:	55                   	push   %ebp
+  8013a7:	89 e5                	mov    %esp,%ebp
+  8013a9:	57                   	push   %edi
+  8013aa:	56                   	push   %esi
+  8013ab:	53                   	push   %ebx
+  8013ac:	83 ec 24             	sub    $0x24,%esp
+  8013af:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013b2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013b5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013b8:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013b9:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8013bf:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013c2:	50                   	push   %eax
+  8013c3:	e8 42 ff ff ff       	call   80130a <fd_lookup>
+  8013c8:	89 c3                	mov    %eax,%ebx
+  8013ca:	83 c4 10             	add    $0x10,%esp
+  8013cd:	85 c0                	test   %eax,%eax
+  8013cf:	78 05                	js     8013d6 <fd_close+0x30>
+	    || fd != fd2)
+  8013d1:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8013d4:	74 16                	je     8013ec <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8013d6:	89 f8                	mov    %edi,%eax
+  8013d8:	84 c0                	test   %al,%al
+  8013da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013df:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8013e2:	89 d8                	mov    %ebx,%eax
+  8013e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e7:	5b                   	pop    %ebx
+  8013e8:	5e                   	pop    %esi
+  8013e9:	5f                   	pop    %edi
+  8013ea:	5d                   	pop    %ebp
+  8013eb:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8013ec:	83 ec 08             	sub    $0x8,%esp
+  8013ef:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8013f2:	50                   	push   %eax
+  8013f3:	ff 36                	push   (%esi)
+  8013f5:	e8 60 ff ff ff       	call   80135a <dev_lookup>
+  8013fa:	89 c3                	mov    %eax,%ebx
+  8013fc:	83 c4 10             	add    $0x10,%esp
+  8013ff:	85 c0                	test   %eax,%eax
+  801401:	78 1a                	js     80141d <fd_close+0x77>
+		if (dev->dev_close)
+  801403:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801406:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801409:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80140e:	85 c0                	test   %eax,%eax
+  801410:	74 0b                	je     80141d <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801412:	83 ec 0c             	sub    $0xc,%esp
+  801415:	56                   	push   %esi
+  801416:	ff d0                	call   *%eax
+  801418:	89 c3                	mov    %eax,%ebx
+  80141a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80141d:	83 ec 08             	sub    $0x8,%esp
+  801420:	56                   	push   %esi
+  801421:	6a 00                	push   $0x0
+  801423:	e8 51 f9 ff ff       	call   800d79 <sys_page_unmap>
+	return r;
+  801428:	83 c4 10             	add    $0x10,%esp
+  80142b:	eb b5                	jmp    8013e2 <fd_close+0x3c>
+
+0080142d <close>:
+
+int
+close(int fdnum)
+{
+  80142d:	55                   	push   %ebp
+  80142e:	89 e5                	mov    %esp,%ebp
+  801430:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801433:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801436:	50                   	push   %eax
+  801437:	ff 75 08             	push   0x8(%ebp)
+  80143a:	e8 cb fe ff ff       	call   80130a <fd_lookup>
+  80143f:	83 c4 10             	add    $0x10,%esp
+  801442:	85 c0                	test   %eax,%eax
+  801444:	79 02                	jns    801448 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801446:	c9                   	leave
+  801447:	c3                   	ret
+		return fd_close(fd, 1);
+  801448:	83 ec 08             	sub    $0x8,%esp
+  80144b:	6a 01                	push   $0x1
+  80144d:	ff 75 f4             	push   -0xc(%ebp)
+  801450:	e8 51 ff ff ff       	call   8013a6 <fd_close>
+  801455:	83 c4 10             	add    $0x10,%esp
+  801458:	eb ec                	jmp    801446 <close+0x19>
+
+0080145a <close_all>:
+
+void
+close_all(void)
+{
+  80145a:	55                   	push   %ebp
+  80145b:	89 e5                	mov    %esp,%ebp
+  80145d:	53                   	push   %ebx
+  80145e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801461:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801466:	83 ec 0c             	sub    $0xc,%esp
+  801469:	53                   	push   %ebx
+  80146a:	e8 be ff ff ff       	call   80142d <close>
+	for (i = 0; i < MAXFD; i++)
+  80146f:	83 c3 01             	add    $0x1,%ebx
+  801472:	83 c4 10             	add    $0x10,%esp
+  801475:	83 fb 20             	cmp    $0x20,%ebx
+  801478:	75 ec                	jne    801466 <close_all+0xc>
+}
+  80147a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80147d:	c9                   	leave
+  80147e:	c3                   	ret
+
+0080147f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80147f:	55                   	push   %ebp
+  801480:	89 e5                	mov    %esp,%ebp
+  801482:	57                   	push   %edi
+  801483:	56                   	push   %esi
+  801484:	53                   	push   %ebx
+  801485:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801488:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80148b:	50                   	push   %eax
+  80148c:	ff 75 08             	push   0x8(%ebp)
+  80148f:	e8 76 fe ff ff       	call   80130a <fd_lookup>
+  801494:	89 c3                	mov    %eax,%ebx
+  801496:	83 c4 10             	add    $0x10,%esp
+  801499:	85 c0                	test   %eax,%eax
+  80149b:	78 7f                	js     80151c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80149d:	83 ec 0c             	sub    $0xc,%esp
+  8014a0:	ff 75 0c             	push   0xc(%ebp)
+  8014a3:	e8 85 ff ff ff       	call   80142d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8014a8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014ab:	c1 e6 0c             	shl    $0xc,%esi
+  8014ae:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8014b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014b7:	89 3c 24             	mov    %edi,(%esp)
+  8014ba:	e8 e0 fd ff ff       	call   80129f <fd2data>
+  8014bf:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8014c1:	89 34 24             	mov    %esi,(%esp)
+  8014c4:	e8 d6 fd ff ff       	call   80129f <fd2data>
+  8014c9:	83 c4 10             	add    $0x10,%esp
+  8014cc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8014cf:	89 d8                	mov    %ebx,%eax
+  8014d1:	c1 e8 16             	shr    $0x16,%eax
+  8014d4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014db:	a8 01                	test   $0x1,%al
+  8014dd:	74 11                	je     8014f0 <dup+0x71>
+  8014df:	89 d8                	mov    %ebx,%eax
+  8014e1:	c1 e8 0c             	shr    $0xc,%eax
+  8014e4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014eb:	f6 c2 01             	test   $0x1,%dl
+  8014ee:	75 36                	jne    801526 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8014f0:	89 f8                	mov    %edi,%eax
+  8014f2:	c1 e8 0c             	shr    $0xc,%eax
+  8014f5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014fc:	83 ec 0c             	sub    $0xc,%esp
+  8014ff:	25 07 0e 00 00       	and    $0xe07,%eax
+  801504:	50                   	push   %eax
+  801505:	56                   	push   %esi
+  801506:	6a 00                	push   $0x0
+  801508:	57                   	push   %edi
+  801509:	6a 00                	push   $0x0
+  80150b:	e8 27 f8 ff ff       	call   800d37 <sys_page_map>
+  801510:	89 c3                	mov    %eax,%ebx
+  801512:	83 c4 20             	add    $0x20,%esp
+  801515:	85 c0                	test   %eax,%eax
+  801517:	78 33                	js     80154c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801519:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80151c:	89 d8                	mov    %ebx,%eax
+  80151e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801521:	5b                   	pop    %ebx
+  801522:	5e                   	pop    %esi
+  801523:	5f                   	pop    %edi
+  801524:	5d                   	pop    %ebp
+  801525:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801526:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80152d:	83 ec 0c             	sub    $0xc,%esp
+  801530:	25 07 0e 00 00       	and    $0xe07,%eax
+  801535:	50                   	push   %eax
+  801536:	ff 75 d4             	push   -0x2c(%ebp)
+  801539:	6a 00                	push   $0x0
+  80153b:	53                   	push   %ebx
+  80153c:	6a 00                	push   $0x0
+  80153e:	e8 f4 f7 ff ff       	call   800d37 <sys_page_map>
+  801543:	89 c3                	mov    %eax,%ebx
+  801545:	83 c4 20             	add    $0x20,%esp
+  801548:	85 c0                	test   %eax,%eax
+  80154a:	79 a4                	jns    8014f0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80154c:	83 ec 08             	sub    $0x8,%esp
+  80154f:	56                   	push   %esi
+  801550:	6a 00                	push   $0x0
+  801552:	e8 22 f8 ff ff       	call   800d79 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801557:	83 c4 08             	add    $0x8,%esp
+  80155a:	ff 75 d4             	push   -0x2c(%ebp)
+  80155d:	6a 00                	push   $0x0
+  80155f:	e8 15 f8 ff ff       	call   800d79 <sys_page_unmap>
+	return r;
+  801564:	83 c4 10             	add    $0x10,%esp
+  801567:	eb b3                	jmp    80151c <dup+0x9d>
+
+00801569 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801569:	55                   	push   %ebp
+  80156a:	89 e5                	mov    %esp,%ebp
+  80156c:	56                   	push   %esi
+  80156d:	53                   	push   %ebx
+  80156e:	83 ec 18             	sub    $0x18,%esp
+  801571:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801574:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801577:	50                   	push   %eax
+  801578:	56                   	push   %esi
+  801579:	e8 8c fd ff ff       	call   80130a <fd_lookup>
+  80157e:	83 c4 10             	add    $0x10,%esp
+  801581:	85 c0                	test   %eax,%eax
+  801583:	78 3c                	js     8015c1 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801585:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801588:	83 ec 08             	sub    $0x8,%esp
+  80158b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80158e:	50                   	push   %eax
+  80158f:	ff 33                	push   (%ebx)
+  801591:	e8 c4 fd ff ff       	call   80135a <dev_lookup>
+  801596:	83 c4 10             	add    $0x10,%esp
+  801599:	85 c0                	test   %eax,%eax
+  80159b:	78 24                	js     8015c1 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80159d:	8b 43 08             	mov    0x8(%ebx),%eax
+  8015a0:	83 e0 03             	and    $0x3,%eax
+  8015a3:	83 f8 01             	cmp    $0x1,%eax
+  8015a6:	74 20                	je     8015c8 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8015a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015ab:	8b 40 08             	mov    0x8(%eax),%eax
+  8015ae:	85 c0                	test   %eax,%eax
+  8015b0:	74 37                	je     8015e9 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8015b2:	83 ec 04             	sub    $0x4,%esp
+  8015b5:	ff 75 10             	push   0x10(%ebp)
+  8015b8:	ff 75 0c             	push   0xc(%ebp)
+  8015bb:	53                   	push   %ebx
+  8015bc:	ff d0                	call   *%eax
+  8015be:	83 c4 10             	add    $0x10,%esp
+}
+  8015c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015c4:	5b                   	pop    %ebx
+  8015c5:	5e                   	pop    %esi
+  8015c6:	5d                   	pop    %ebp
+  8015c7:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015c8:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  8015cd:	8b 40 48             	mov    0x48(%eax),%eax
+  8015d0:	83 ec 04             	sub    $0x4,%esp
+  8015d3:	56                   	push   %esi
+  8015d4:	50                   	push   %eax
+  8015d5:	68 f9 2b 80 00       	push   $0x802bf9
+  8015da:	e8 3b ec ff ff       	call   80021a <cprintf>
+		return -E_INVAL;
+  8015df:	83 c4 10             	add    $0x10,%esp
+  8015e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e7:	eb d8                	jmp    8015c1 <read+0x58>
+		return -E_NOT_SUPP;
+  8015e9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015ee:	eb d1                	jmp    8015c1 <read+0x58>
+
+008015f0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015f0:	55                   	push   %ebp
+  8015f1:	89 e5                	mov    %esp,%ebp
+  8015f3:	57                   	push   %edi
+  8015f4:	56                   	push   %esi
+  8015f5:	53                   	push   %ebx
+  8015f6:	83 ec 0c             	sub    $0xc,%esp
+  8015f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015fc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8015ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801604:	eb 02                	jmp    801608 <readn+0x18>
+  801606:	01 c3                	add    %eax,%ebx
+  801608:	39 f3                	cmp    %esi,%ebx
+  80160a:	73 21                	jae    80162d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80160c:	83 ec 04             	sub    $0x4,%esp
+  80160f:	89 f0                	mov    %esi,%eax
+  801611:	29 d8                	sub    %ebx,%eax
+  801613:	50                   	push   %eax
+  801614:	89 d8                	mov    %ebx,%eax
+  801616:	03 45 0c             	add    0xc(%ebp),%eax
+  801619:	50                   	push   %eax
+  80161a:	57                   	push   %edi
+  80161b:	e8 49 ff ff ff       	call   801569 <read>
+		if (m < 0)
+  801620:	83 c4 10             	add    $0x10,%esp
+  801623:	85 c0                	test   %eax,%eax
+  801625:	78 04                	js     80162b <readn+0x3b>
+			return m;
+		if (m == 0)
+  801627:	75 dd                	jne    801606 <readn+0x16>
+  801629:	eb 02                	jmp    80162d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80162b:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80162d:	89 d8                	mov    %ebx,%eax
+  80162f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801632:	5b                   	pop    %ebx
+  801633:	5e                   	pop    %esi
+  801634:	5f                   	pop    %edi
+  801635:	5d                   	pop    %ebp
+  801636:	c3                   	ret
+
+00801637 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801637:	55                   	push   %ebp
+  801638:	89 e5                	mov    %esp,%ebp
+  80163a:	56                   	push   %esi
+  80163b:	53                   	push   %ebx
+  80163c:	83 ec 18             	sub    $0x18,%esp
+  80163f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801642:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801645:	50                   	push   %eax
+  801646:	53                   	push   %ebx
+  801647:	e8 be fc ff ff       	call   80130a <fd_lookup>
+  80164c:	83 c4 10             	add    $0x10,%esp
+  80164f:	85 c0                	test   %eax,%eax
+  801651:	78 37                	js     80168a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801653:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801656:	83 ec 08             	sub    $0x8,%esp
+  801659:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80165c:	50                   	push   %eax
+  80165d:	ff 36                	push   (%esi)
+  80165f:	e8 f6 fc ff ff       	call   80135a <dev_lookup>
+  801664:	83 c4 10             	add    $0x10,%esp
+  801667:	85 c0                	test   %eax,%eax
+  801669:	78 1f                	js     80168a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80166b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80166f:	74 20                	je     801691 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801671:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801674:	8b 40 0c             	mov    0xc(%eax),%eax
+  801677:	85 c0                	test   %eax,%eax
+  801679:	74 37                	je     8016b2 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80167b:	83 ec 04             	sub    $0x4,%esp
+  80167e:	ff 75 10             	push   0x10(%ebp)
+  801681:	ff 75 0c             	push   0xc(%ebp)
+  801684:	56                   	push   %esi
+  801685:	ff d0                	call   *%eax
+  801687:	83 c4 10             	add    $0x10,%esp
+}
+  80168a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80168d:	5b                   	pop    %ebx
+  80168e:	5e                   	pop    %esi
+  80168f:	5d                   	pop    %ebp
+  801690:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801691:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  801696:	8b 40 48             	mov    0x48(%eax),%eax
+  801699:	83 ec 04             	sub    $0x4,%esp
+  80169c:	53                   	push   %ebx
+  80169d:	50                   	push   %eax
+  80169e:	68 15 2c 80 00       	push   $0x802c15
+  8016a3:	e8 72 eb ff ff       	call   80021a <cprintf>
+		return -E_INVAL;
+  8016a8:	83 c4 10             	add    $0x10,%esp
+  8016ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016b0:	eb d8                	jmp    80168a <write+0x53>
+		return -E_NOT_SUPP;
+  8016b2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016b7:	eb d1                	jmp    80168a <write+0x53>
+
+008016b9 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016b9:	55                   	push   %ebp
+  8016ba:	89 e5                	mov    %esp,%ebp
+  8016bc:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c2:	50                   	push   %eax
+  8016c3:	ff 75 08             	push   0x8(%ebp)
+  8016c6:	e8 3f fc ff ff       	call   80130a <fd_lookup>
+  8016cb:	83 c4 10             	add    $0x10,%esp
+  8016ce:	85 c0                	test   %eax,%eax
+  8016d0:	78 0e                	js     8016e0 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8016d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016d8:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8016db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016e0:	c9                   	leave
+  8016e1:	c3                   	ret
+
+008016e2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016e2:	55                   	push   %ebp
+  8016e3:	89 e5                	mov    %esp,%ebp
+  8016e5:	56                   	push   %esi
+  8016e6:	53                   	push   %ebx
+  8016e7:	83 ec 18             	sub    $0x18,%esp
+  8016ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016ed:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016f0:	50                   	push   %eax
+  8016f1:	53                   	push   %ebx
+  8016f2:	e8 13 fc ff ff       	call   80130a <fd_lookup>
+  8016f7:	83 c4 10             	add    $0x10,%esp
+  8016fa:	85 c0                	test   %eax,%eax
+  8016fc:	78 34                	js     801732 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016fe:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801701:	83 ec 08             	sub    $0x8,%esp
+  801704:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801707:	50                   	push   %eax
+  801708:	ff 36                	push   (%esi)
+  80170a:	e8 4b fc ff ff       	call   80135a <dev_lookup>
+  80170f:	83 c4 10             	add    $0x10,%esp
+  801712:	85 c0                	test   %eax,%eax
+  801714:	78 1c                	js     801732 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801716:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80171a:	74 1d                	je     801739 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80171c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80171f:	8b 40 18             	mov    0x18(%eax),%eax
+  801722:	85 c0                	test   %eax,%eax
+  801724:	74 34                	je     80175a <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801726:	83 ec 08             	sub    $0x8,%esp
+  801729:	ff 75 0c             	push   0xc(%ebp)
+  80172c:	56                   	push   %esi
+  80172d:	ff d0                	call   *%eax
+  80172f:	83 c4 10             	add    $0x10,%esp
+}
+  801732:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801735:	5b                   	pop    %ebx
+  801736:	5e                   	pop    %esi
+  801737:	5d                   	pop    %ebp
+  801738:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801739:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  80173e:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801741:	83 ec 04             	sub    $0x4,%esp
+  801744:	53                   	push   %ebx
+  801745:	50                   	push   %eax
+  801746:	68 d8 2b 80 00       	push   $0x802bd8
+  80174b:	e8 ca ea ff ff       	call   80021a <cprintf>
+		return -E_INVAL;
+  801750:	83 c4 10             	add    $0x10,%esp
+  801753:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801758:	eb d8                	jmp    801732 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80175a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80175f:	eb d1                	jmp    801732 <ftruncate+0x50>
+
+00801761 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801761:	55                   	push   %ebp
+  801762:	89 e5                	mov    %esp,%ebp
+  801764:	56                   	push   %esi
+  801765:	53                   	push   %ebx
+  801766:	83 ec 18             	sub    $0x18,%esp
+  801769:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80176c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80176f:	50                   	push   %eax
+  801770:	ff 75 08             	push   0x8(%ebp)
+  801773:	e8 92 fb ff ff       	call   80130a <fd_lookup>
+  801778:	83 c4 10             	add    $0x10,%esp
+  80177b:	85 c0                	test   %eax,%eax
+  80177d:	78 49                	js     8017c8 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80177f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801782:	83 ec 08             	sub    $0x8,%esp
+  801785:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801788:	50                   	push   %eax
+  801789:	ff 36                	push   (%esi)
+  80178b:	e8 ca fb ff ff       	call   80135a <dev_lookup>
+  801790:	83 c4 10             	add    $0x10,%esp
+  801793:	85 c0                	test   %eax,%eax
+  801795:	78 31                	js     8017c8 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801797:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80179a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80179e:	74 2f                	je     8017cf <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8017a0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8017a3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8017aa:	00 00 00 
+	stat->st_isdir = 0;
+  8017ad:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8017b4:	00 00 00 
+	stat->st_dev = dev;
+  8017b7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8017bd:	83 ec 08             	sub    $0x8,%esp
+  8017c0:	53                   	push   %ebx
+  8017c1:	56                   	push   %esi
+  8017c2:	ff 50 14             	call   *0x14(%eax)
+  8017c5:	83 c4 10             	add    $0x10,%esp
+}
+  8017c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017cb:	5b                   	pop    %ebx
+  8017cc:	5e                   	pop    %esi
+  8017cd:	5d                   	pop    %ebp
+  8017ce:	c3                   	ret
+		return -E_NOT_SUPP;
+  8017cf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017d4:	eb f2                	jmp    8017c8 <fstat+0x67>
+
+008017d6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8017d6:	55                   	push   %ebp
+  8017d7:	89 e5                	mov    %esp,%ebp
+  8017d9:	56                   	push   %esi
+  8017da:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8017db:	83 ec 08             	sub    $0x8,%esp
+  8017de:	6a 00                	push   $0x0
+  8017e0:	ff 75 08             	push   0x8(%ebp)
+  8017e3:	e8 bc 02 00 00       	call   801aa4 <open>
+  8017e8:	89 c3                	mov    %eax,%ebx
+  8017ea:	83 c4 10             	add    $0x10,%esp
+  8017ed:	85 c0                	test   %eax,%eax
+  8017ef:	78 1b                	js     80180c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8017f1:	83 ec 08             	sub    $0x8,%esp
+  8017f4:	ff 75 0c             	push   0xc(%ebp)
+  8017f7:	50                   	push   %eax
+  8017f8:	e8 64 ff ff ff       	call   801761 <fstat>
+  8017fd:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8017ff:	89 1c 24             	mov    %ebx,(%esp)
+  801802:	e8 26 fc ff ff       	call   80142d <close>
+	return r;
+  801807:	83 c4 10             	add    $0x10,%esp
+  80180a:	89 f3                	mov    %esi,%ebx
+}
+  80180c:	89 d8                	mov    %ebx,%eax
+  80180e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801811:	5b                   	pop    %ebx
+  801812:	5e                   	pop    %esi
+  801813:	5d                   	pop    %ebp
+  801814:	c3                   	ret
+
+00801815 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801815:	55                   	push   %ebp
+  801816:	89 e5                	mov    %esp,%ebp
+  801818:	57                   	push   %edi
+  801819:	56                   	push   %esi
+  80181a:	53                   	push   %ebx
+  80181b:	83 ec 0c             	sub    $0xc,%esp
+  80181e:	89 c7                	mov    %eax,%edi
+  801820:	89 d3                	mov    %edx,%ebx
+  801822:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801824:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  80182b:	74 2d                	je     80185a <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80182d:	6a 07                	push   $0x7
+  80182f:	68 00 50 c0 00       	push   $0xc05000
+  801834:	57                   	push   %edi
+  801835:	ff 35 00 40 80 00    	push   0x804000
+  80183b:	e8 7d 0b 00 00       	call   8023bd <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801840:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801847:	6a 00                	push   $0x0
+  801849:	56                   	push   %esi
+  80184a:	53                   	push   %ebx
+  80184b:	6a 00                	push   $0x0
+  80184d:	e8 1d 0a 00 00       	call   80226f <ipc_recv_pages>
+}
+  801852:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801855:	5b                   	pop    %ebx
+  801856:	5e                   	pop    %esi
+  801857:	5f                   	pop    %edi
+  801858:	5d                   	pop    %ebp
+  801859:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80185a:	83 ec 0c             	sub    $0xc,%esp
+  80185d:	6a 01                	push   $0x1
+  80185f:	e8 4e 0c 00 00       	call   8024b2 <ipc_find_env>
+  801864:	a3 00 40 80 00       	mov    %eax,0x804000
+  801869:	83 c4 10             	add    $0x10,%esp
+  80186c:	eb bf                	jmp    80182d <fsipc_pages+0x18>
+
+0080186e <fsipc>:
+{
+  80186e:	55                   	push   %ebp
+  80186f:	89 e5                	mov    %esp,%ebp
+  801871:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801874:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801879:	e8 97 ff ff ff       	call   801815 <fsipc_pages>
+}
+  80187e:	c9                   	leave
+  80187f:	c3                   	ret
+
+00801880 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801880:	55                   	push   %ebp
+  801881:	89 e5                	mov    %esp,%ebp
+  801883:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801886:	8b 45 08             	mov    0x8(%ebp),%eax
+  801889:	8b 40 0c             	mov    0xc(%eax),%eax
+  80188c:	a3 00 50 c0 00       	mov    %eax,0xc05000
+	fsipcbuf.set_size.req_size = newsize;
+  801891:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801894:	a3 04 50 c0 00       	mov    %eax,0xc05004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801899:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189e:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018a3:	e8 c6 ff ff ff       	call   80186e <fsipc>
+}
+  8018a8:	c9                   	leave
+  8018a9:	c3                   	ret
+
+008018aa <devfile_flush>:
+{
+  8018aa:	55                   	push   %ebp
+  8018ab:	89 e5                	mov    %esp,%ebp
+  8018ad:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8018b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018b6:	a3 00 50 c0 00       	mov    %eax,0xc05000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8018bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018c0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018c5:	e8 a4 ff ff ff       	call   80186e <fsipc>
+}
+  8018ca:	c9                   	leave
+  8018cb:	c3                   	ret
+
+008018cc <devfile_stat>:
+{
+  8018cc:	55                   	push   %ebp
+  8018cd:	89 e5                	mov    %esp,%ebp
+  8018cf:	53                   	push   %ebx
+  8018d0:	83 ec 04             	sub    $0x4,%esp
+  8018d3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018dc:	a3 00 50 c0 00       	mov    %eax,0xc05000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8018e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018e6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018eb:	e8 7e ff ff ff       	call   80186e <fsipc>
+  8018f0:	85 c0                	test   %eax,%eax
+  8018f2:	78 2c                	js     801920 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018f4:	83 ec 08             	sub    $0x8,%esp
+  8018f7:	68 00 50 c0 00       	push   $0xc05000
+  8018fc:	53                   	push   %ebx
+  8018fd:	e8 ff ee ff ff       	call   800801 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801902:	a1 80 50 c0 00       	mov    0xc05080,%eax
+  801907:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80190d:	a1 84 50 c0 00       	mov    0xc05084,%eax
+  801912:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801918:	83 c4 10             	add    $0x10,%esp
+  80191b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801920:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801923:	c9                   	leave
+  801924:	c3                   	ret
+
+00801925 <devfile_write>:
+{
+  801925:	55                   	push   %ebp
+  801926:	89 e5                	mov    %esp,%ebp
+  801928:	83 ec 0c             	sub    $0xc,%esp
+  80192b:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80192e:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801933:	39 d0                	cmp    %edx,%eax
+  801935:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801938:	8b 55 08             	mov    0x8(%ebp),%edx
+  80193b:	8b 52 0c             	mov    0xc(%edx),%edx
+  80193e:	89 15 00 50 c0 00    	mov    %edx,0xc05000
+	fsipcbuf.write.req_n = n;
+  801944:	a3 04 50 c0 00       	mov    %eax,0xc05004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801949:	50                   	push   %eax
+  80194a:	ff 75 0c             	push   0xc(%ebp)
+  80194d:	68 08 50 c0 00       	push   $0xc05008
+  801952:	e8 30 f0 ff ff       	call   800987 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801957:	ba 00 00 00 00       	mov    $0x0,%edx
+  80195c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801961:	e8 08 ff ff ff       	call   80186e <fsipc>
+}
+  801966:	c9                   	leave
+  801967:	c3                   	ret
+
+00801968 <devfile_read>:
+{
+  801968:	55                   	push   %ebp
+  801969:	89 e5                	mov    %esp,%ebp
+  80196b:	57                   	push   %edi
+  80196c:	56                   	push   %esi
+  80196d:	53                   	push   %ebx
+  80196e:	83 ec 1c             	sub    $0x1c,%esp
+  801971:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801974:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801977:	89 fe                	mov    %edi,%esi
+  801979:	c1 ee 0c             	shr    $0xc,%esi
+  80197c:	b8 20 00 00 00       	mov    $0x20,%eax
+  801981:	39 c6                	cmp    %eax,%esi
+  801983:	0f 47 f0             	cmova  %eax,%esi
+  801986:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801989:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80198e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801991:	eb 14                	jmp    8019a7 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801993:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  80199a:	05 00 10 00 00       	add    $0x1000,%eax
+  80199f:	f6 c6 06             	test   $0x6,%dh
+  8019a2:	75 42                	jne    8019e6 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8019a4:	83 c1 01             	add    $0x1,%ecx
+  8019a7:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8019aa:	39 f1                	cmp    %esi,%ecx
+  8019ac:	0f 84 95 00 00 00    	je     801a47 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8019b2:	89 c2                	mov    %eax,%edx
+  8019b4:	c1 ea 16             	shr    $0x16,%edx
+  8019b7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8019be:	f6 c2 01             	test   $0x1,%dl
+  8019c1:	74 23                	je     8019e6 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8019c3:	89 c2                	mov    %eax,%edx
+  8019c5:	c1 ea 0c             	shr    $0xc,%edx
+  8019c8:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8019cf:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  8019d5:	74 0f                	je     8019e6 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  8019d7:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8019de:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  8019e4:	75 ad                	jne    801993 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  8019e6:	85 c9                	test   %ecx,%ecx
+  8019e8:	74 11                	je     8019fb <devfile_read+0x93>
+  8019ea:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  8019f1:	75 08                	jne    8019fb <devfile_read+0x93>
+  8019f3:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  8019f9:	74 50                	je     801a4b <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019fb:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8019fe:	a3 00 50 c0 00       	mov    %eax,0xc05000
+	fsipcbuf.read.req_n = n;
+  801a03:	89 3d 04 50 c0 00    	mov    %edi,0xc05004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a09:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a0e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a13:	e8 56 fe ff ff       	call   80186e <fsipc>
+  801a18:	89 c6                	mov    %eax,%esi
+  801a1a:	85 c0                	test   %eax,%eax
+  801a1c:	78 1f                	js     801a3d <devfile_read+0xd5>
+	assert(r <= n);
+  801a1e:	39 c7                	cmp    %eax,%edi
+  801a20:	72 50                	jb     801a72 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801a22:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a27:	7f 62                	jg     801a8b <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801a29:	83 ec 04             	sub    $0x4,%esp
+  801a2c:	50                   	push   %eax
+  801a2d:	68 00 50 c0 00       	push   $0xc05000
+  801a32:	ff 75 0c             	push   0xc(%ebp)
+  801a35:	e8 4d ef ff ff       	call   800987 <memmove>
+	return r;
+  801a3a:	83 c4 10             	add    $0x10,%esp
+}
+  801a3d:	89 f0                	mov    %esi,%eax
+  801a3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a42:	5b                   	pop    %ebx
+  801a43:	5e                   	pop    %esi
+  801a44:	5f                   	pop    %edi
+  801a45:	5d                   	pop    %ebp
+  801a46:	c3                   	ret
+  801a47:	89 f1                	mov    %esi,%ecx
+  801a49:	eb 9b                	jmp    8019e6 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801a4b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a4e:	a3 00 50 c0 00       	mov    %eax,0xc05000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801a53:	89 c8                	mov    %ecx,%eax
+  801a55:	c1 e0 0c             	shl    $0xc,%eax
+  801a58:	a3 04 50 c0 00       	mov    %eax,0xc05004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801a5d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a60:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801a65:	e8 ab fd ff ff       	call   801815 <fsipc_pages>
+  801a6a:	89 c6                	mov    %eax,%esi
+  801a6c:	85 c0                	test   %eax,%eax
+  801a6e:	78 8b                	js     8019fb <devfile_read+0x93>
+  801a70:	eb cb                	jmp    801a3d <devfile_read+0xd5>
+	assert(r <= n);
+  801a72:	68 44 2c 80 00       	push   $0x802c44
+  801a77:	68 4b 2c 80 00       	push   $0x802c4b
+  801a7c:	68 a0 00 00 00       	push   $0xa0
+  801a81:	68 60 2c 80 00       	push   $0x802c60
+  801a86:	e8 b4 e6 ff ff       	call   80013f <_panic>
+	assert(r <= PGSIZE);
+  801a8b:	68 6b 2c 80 00       	push   $0x802c6b
+  801a90:	68 4b 2c 80 00       	push   $0x802c4b
+  801a95:	68 a1 00 00 00       	push   $0xa1
+  801a9a:	68 60 2c 80 00       	push   $0x802c60
+  801a9f:	e8 9b e6 ff ff       	call   80013f <_panic>
+
+00801aa4 <open>:
+{
+  801aa4:	55                   	push   %ebp
+  801aa5:	89 e5                	mov    %esp,%ebp
+  801aa7:	56                   	push   %esi
+  801aa8:	53                   	push   %ebx
+  801aa9:	83 ec 1c             	sub    $0x1c,%esp
+  801aac:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801aaf:	56                   	push   %esi
+  801ab0:	e8 11 ed ff ff       	call   8007c6 <strlen>
+  801ab5:	83 c4 10             	add    $0x10,%esp
+  801ab8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801abd:	7f 6c                	jg     801b2b <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801abf:	83 ec 0c             	sub    $0xc,%esp
+  801ac2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ac5:	50                   	push   %eax
+  801ac6:	e8 eb f7 ff ff       	call   8012b6 <fd_alloc>
+  801acb:	89 c3                	mov    %eax,%ebx
+  801acd:	83 c4 10             	add    $0x10,%esp
+  801ad0:	85 c0                	test   %eax,%eax
+  801ad2:	78 3c                	js     801b10 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801ad4:	83 ec 08             	sub    $0x8,%esp
+  801ad7:	56                   	push   %esi
+  801ad8:	68 00 50 c0 00       	push   $0xc05000
+  801add:	e8 1f ed ff ff       	call   800801 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801ae2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ae5:	a3 00 54 c0 00       	mov    %eax,0xc05400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801aea:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801aed:	b8 01 00 00 00       	mov    $0x1,%eax
+  801af2:	e8 77 fd ff ff       	call   80186e <fsipc>
+  801af7:	89 c3                	mov    %eax,%ebx
+  801af9:	83 c4 10             	add    $0x10,%esp
+  801afc:	85 c0                	test   %eax,%eax
+  801afe:	78 19                	js     801b19 <open+0x75>
+	return fd2num(fd);
+  801b00:	83 ec 0c             	sub    $0xc,%esp
+  801b03:	ff 75 f4             	push   -0xc(%ebp)
+  801b06:	e8 84 f7 ff ff       	call   80128f <fd2num>
+  801b0b:	89 c3                	mov    %eax,%ebx
+  801b0d:	83 c4 10             	add    $0x10,%esp
+}
+  801b10:	89 d8                	mov    %ebx,%eax
+  801b12:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b15:	5b                   	pop    %ebx
+  801b16:	5e                   	pop    %esi
+  801b17:	5d                   	pop    %ebp
+  801b18:	c3                   	ret
+		fd_close(fd, 0);
+  801b19:	83 ec 08             	sub    $0x8,%esp
+  801b1c:	6a 00                	push   $0x0
+  801b1e:	ff 75 f4             	push   -0xc(%ebp)
+  801b21:	e8 80 f8 ff ff       	call   8013a6 <fd_close>
+		return r;
+  801b26:	83 c4 10             	add    $0x10,%esp
+  801b29:	eb e5                	jmp    801b10 <open+0x6c>
+		return -E_BAD_PATH;
+  801b2b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801b30:	eb de                	jmp    801b10 <open+0x6c>
+
+00801b32 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801b32:	55                   	push   %ebp
+  801b33:	89 e5                	mov    %esp,%ebp
+  801b35:	53                   	push   %ebx
+  801b36:	83 ec 10             	sub    $0x10,%esp
+  801b39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801b3c:	53                   	push   %ebx
+  801b3d:	e8 84 ec ff ff       	call   8007c6 <strlen>
+  801b42:	83 c4 10             	add    $0x10,%esp
+  801b45:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b4a:	7f 25                	jg     801b71 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b4c:	83 ec 08             	sub    $0x8,%esp
+  801b4f:	53                   	push   %ebx
+  801b50:	68 00 50 c0 00       	push   $0xc05000
+  801b55:	e8 a7 ec ff ff       	call   800801 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5f:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b64:	e8 05 fd ff ff       	call   80186e <fsipc>
+  801b69:	83 c4 10             	add    $0x10,%esp
+}
+  801b6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b6f:	c9                   	leave
+  801b70:	c3                   	ret
+		return -E_BAD_PATH;
+  801b71:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b76:	eb f4                	jmp    801b6c <remove+0x3a>
+
+00801b78 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b78:	55                   	push   %ebp
+  801b79:	89 e5                	mov    %esp,%ebp
+  801b7b:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b83:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b88:	e8 e1 fc ff ff       	call   80186e <fsipc>
+}
+  801b8d:	c9                   	leave
+  801b8e:	c3                   	ret
+
+00801b8f <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801b8f:	55                   	push   %ebp
+  801b90:	89 e5                	mov    %esp,%ebp
+  801b92:	53                   	push   %ebx
+  801b93:	83 ec 04             	sub    $0x4,%esp
+  801b96:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801b99:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b9e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801ba3:	e8 c6 fc ff ff       	call   80186e <fsipc>
+  801ba8:	85 c0                	test   %eax,%eax
+  801baa:	78 3c                	js     801be8 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801bac:	a1 00 50 c0 00       	mov    0xc05000,%eax
+  801bb1:	89 03                	mov    %eax,(%ebx)
+  801bb3:	a1 04 50 c0 00       	mov    0xc05004,%eax
+  801bb8:	89 43 04             	mov    %eax,0x4(%ebx)
+  801bbb:	a1 08 50 c0 00       	mov    0xc05008,%eax
+  801bc0:	89 43 08             	mov    %eax,0x8(%ebx)
+  801bc3:	a1 0c 50 c0 00       	mov    0xc0500c,%eax
+  801bc8:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801bcb:	a1 10 50 c0 00       	mov    0xc05010,%eax
+  801bd0:	89 43 10             	mov    %eax,0x10(%ebx)
+  801bd3:	a1 14 50 c0 00       	mov    0xc05014,%eax
+  801bd8:	89 43 14             	mov    %eax,0x14(%ebx)
+  801bdb:	a1 18 50 c0 00       	mov    0xc05018,%eax
+  801be0:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801be3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801be8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801beb:	c9                   	leave
+  801bec:	c3                   	ret
+
+00801bed <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801bed:	55                   	push   %ebp
+  801bee:	89 e5                	mov    %esp,%ebp
+  801bf0:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801bf3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bf6:	a3 00 50 c0 00       	mov    %eax,0xc05000
+	return fsipc(FSREQ_BCSET, NULL);
+  801bfb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c00:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c05:	e8 64 fc ff ff       	call   80186e <fsipc>
+}
+  801c0a:	c9                   	leave
+  801c0b:	c3                   	ret
+
+00801c0c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c0c:	55                   	push   %ebp
+  801c0d:	89 e5                	mov    %esp,%ebp
+  801c0f:	56                   	push   %esi
+  801c10:	53                   	push   %ebx
+  801c11:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801c14:	83 ec 0c             	sub    $0xc,%esp
+  801c17:	ff 75 08             	push   0x8(%ebp)
+  801c1a:	e8 80 f6 ff ff       	call   80129f <fd2data>
+  801c1f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801c21:	83 c4 08             	add    $0x8,%esp
+  801c24:	68 77 2c 80 00       	push   $0x802c77
+  801c29:	53                   	push   %ebx
+  801c2a:	e8 d2 eb ff ff       	call   800801 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801c2f:	8b 46 04             	mov    0x4(%esi),%eax
+  801c32:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801c38:	2b 0e                	sub    (%esi),%ecx
+  801c3a:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801c3f:	89 c8                	mov    %ecx,%eax
+  801c41:	f7 e2                	mul    %edx
+  801c43:	c1 ea 0c             	shr    $0xc,%edx
+  801c46:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801c4c:	29 d1                	sub    %edx,%ecx
+  801c4e:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801c54:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c5b:	00 00 00 
+	stat->st_dev = &devpipe;
+  801c5e:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  801c65:	30 80 00 
+	return 0;
+}
+  801c68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c70:	5b                   	pop    %ebx
+  801c71:	5e                   	pop    %esi
+  801c72:	5d                   	pop    %ebp
+  801c73:	c3                   	ret
+
+00801c74 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801c74:	55                   	push   %ebp
+  801c75:	89 e5                	mov    %esp,%ebp
+  801c77:	53                   	push   %ebx
+  801c78:	83 ec 0c             	sub    $0xc,%esp
+  801c7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801c7e:	53                   	push   %ebx
+  801c7f:	6a 00                	push   $0x0
+  801c81:	e8 f3 f0 ff ff       	call   800d79 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801c86:	89 1c 24             	mov    %ebx,(%esp)
+  801c89:	e8 11 f6 ff ff       	call   80129f <fd2data>
+  801c8e:	83 c4 08             	add    $0x8,%esp
+  801c91:	50                   	push   %eax
+  801c92:	6a 00                	push   $0x0
+  801c94:	e8 e0 f0 ff ff       	call   800d79 <sys_page_unmap>
+}
+  801c99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c9c:	c9                   	leave
+  801c9d:	c3                   	ret
+
+00801c9e <_pipeisclosed>:
+{
+  801c9e:	55                   	push   %ebp
+  801c9f:	89 e5                	mov    %esp,%ebp
+  801ca1:	57                   	push   %edi
+  801ca2:	56                   	push   %esi
+  801ca3:	53                   	push   %ebx
+  801ca4:	83 ec 1c             	sub    $0x1c,%esp
+  801ca7:	89 c7                	mov    %eax,%edi
+  801ca9:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801cab:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  801cb0:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801cb3:	83 ec 0c             	sub    $0xc,%esp
+  801cb6:	57                   	push   %edi
+  801cb7:	e8 35 08 00 00       	call   8024f1 <pageref>
+  801cbc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801cbf:	89 34 24             	mov    %esi,(%esp)
+  801cc2:	e8 2a 08 00 00       	call   8024f1 <pageref>
+		nn = thisenv->env_runs;
+  801cc7:	8b 15 24 40 c0 00    	mov    0xc04024,%edx
+  801ccd:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801cd0:	83 c4 10             	add    $0x10,%esp
+  801cd3:	39 cb                	cmp    %ecx,%ebx
+  801cd5:	74 1b                	je     801cf2 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801cd7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801cda:	75 cf                	jne    801cab <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801cdc:	8b 42 58             	mov    0x58(%edx),%eax
+  801cdf:	6a 01                	push   $0x1
+  801ce1:	50                   	push   %eax
+  801ce2:	53                   	push   %ebx
+  801ce3:	68 7e 2c 80 00       	push   $0x802c7e
+  801ce8:	e8 2d e5 ff ff       	call   80021a <cprintf>
+  801ced:	83 c4 10             	add    $0x10,%esp
+  801cf0:	eb b9                	jmp    801cab <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801cf2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801cf5:	0f 94 c0             	sete   %al
+  801cf8:	0f b6 c0             	movzbl %al,%eax
+}
+  801cfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cfe:	5b                   	pop    %ebx
+  801cff:	5e                   	pop    %esi
+  801d00:	5f                   	pop    %edi
+  801d01:	5d                   	pop    %ebp
+  801d02:	c3                   	ret
+
+00801d03 <devpipe_read>:
+{
+  801d03:	55                   	push   %ebp
+  801d04:	89 e5                	mov    %esp,%ebp
+  801d06:	57                   	push   %edi
+  801d07:	56                   	push   %esi
+  801d08:	53                   	push   %ebx
+  801d09:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801d0c:	ff 75 08             	push   0x8(%ebp)
+  801d0f:	e8 8b f5 ff ff       	call   80129f <fd2data>
+  801d14:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801d16:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801d19:	8d 40 04             	lea    0x4(%eax),%eax
+  801d1c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801d1f:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801d22:	8b 0b                	mov    (%ebx),%ecx
+  801d24:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801d2a:	29 ce                	sub    %ecx,%esi
+  801d2c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801d31:	f7 e6                	mul    %esi
+  801d33:	c1 ea 0c             	shr    $0xc,%edx
+  801d36:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801d3c:	29 c6                	sub    %eax,%esi
+  801d3e:	89 f2                	mov    %esi,%edx
+  801d40:	75 43                	jne    801d85 <devpipe_read+0x82>
+		ref = pageref(p);
+  801d42:	83 ec 0c             	sub    $0xc,%esp
+  801d45:	53                   	push   %ebx
+  801d46:	e8 a6 07 00 00       	call   8024f1 <pageref>
+  801d4b:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801d4d:	89 da                	mov    %ebx,%edx
+  801d4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d52:	e8 47 ff ff ff       	call   801c9e <_pipeisclosed>
+  801d57:	83 c4 10             	add    $0x10,%esp
+  801d5a:	85 c0                	test   %eax,%eax
+  801d5c:	0f 85 c1 00 00 00    	jne    801e23 <devpipe_read+0x120>
+	*sleeping = 1;
+  801d62:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801d69:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801d6e:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801d71:	75 ac                	jne    801d1f <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801d73:	83 ec 04             	sub    $0x4,%esp
+  801d76:	56                   	push   %esi
+  801d77:	57                   	push   %edi
+  801d78:	ff 75 e4             	push   -0x1c(%ebp)
+  801d7b:	e8 4d f4 ff ff       	call   8011cd <sys_futex_wait>
+  801d80:	83 c4 10             	add    $0x10,%esp
+  801d83:	eb 9a                	jmp    801d1f <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801d85:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801d88:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801d8c:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801d8e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801d93:	f7 e1                	mul    %ecx
+  801d95:	c1 ea 0b             	shr    $0xb,%edx
+  801d98:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801d9e:	29 c1                	sub    %eax,%ecx
+  801da0:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801da2:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801da7:	29 cf                	sub    %ecx,%edi
+  801da9:	39 f7                	cmp    %esi,%edi
+  801dab:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801dae:	8d 43 10             	lea    0x10(%ebx),%eax
+  801db1:	83 ec 04             	sub    $0x4,%esp
+  801db4:	57                   	push   %edi
+  801db5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801db8:	01 c2                	add    %eax,%edx
+  801dba:	52                   	push   %edx
+  801dbb:	ff 75 0c             	push   0xc(%ebp)
+  801dbe:	e8 c4 eb ff ff       	call   800987 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801dc3:	83 c4 0c             	add    $0xc,%esp
+  801dc6:	89 f1                	mov    %esi,%ecx
+  801dc8:	29 f9                	sub    %edi,%ecx
+  801dca:	51                   	push   %ecx
+  801dcb:	ff 75 e4             	push   -0x1c(%ebp)
+  801dce:	89 f8                	mov    %edi,%eax
+  801dd0:	03 45 0c             	add    0xc(%ebp),%eax
+  801dd3:	50                   	push   %eax
+  801dd4:	e8 ae eb ff ff       	call   800987 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801dd9:	89 f1                	mov    %esi,%ecx
+  801ddb:	03 0b                	add    (%ebx),%ecx
+  801ddd:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801de2:	f7 e1                	mul    %ecx
+  801de4:	c1 ea 0c             	shr    $0xc,%edx
+  801de7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801ded:	29 d1                	sub    %edx,%ecx
+  801def:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801df1:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801df6:	83 c4 10             	add    $0x10,%esp
+  801df9:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801dfd:	75 0a                	jne    801e09 <devpipe_read+0x106>
+	return n;
+  801dff:	89 f0                	mov    %esi,%eax
+}
+  801e01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e04:	5b                   	pop    %ebx
+  801e05:	5e                   	pop    %esi
+  801e06:	5f                   	pop    %edi
+  801e07:	5d                   	pop    %ebp
+  801e08:	c3                   	ret
+		*sleeping = 0;
+  801e09:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801e10:	83 ec 08             	sub    $0x8,%esp
+  801e13:	68 00 04 00 00       	push   $0x400
+  801e18:	53                   	push   %ebx
+  801e19:	e8 ff f3 ff ff       	call   80121d <sys_futex_wake>
+  801e1e:	83 c4 10             	add    $0x10,%esp
+  801e21:	eb dc                	jmp    801dff <devpipe_read+0xfc>
+			return 0;
+  801e23:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e28:	eb d7                	jmp    801e01 <devpipe_read+0xfe>
+
+00801e2a <devpipe_write>:
+{
+  801e2a:	55                   	push   %ebp
+  801e2b:	89 e5                	mov    %esp,%ebp
+  801e2d:	57                   	push   %edi
+  801e2e:	56                   	push   %esi
+  801e2f:	53                   	push   %ebx
+  801e30:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801e33:	ff 75 08             	push   0x8(%ebp)
+  801e36:	e8 64 f4 ff ff       	call   80129f <fd2data>
+  801e3b:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801e3d:	83 c4 10             	add    $0x10,%esp
+  801e40:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801e47:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e4a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801e4d:	0f 83 23 01 00 00    	jae    801f76 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801e53:	8b 77 04             	mov    0x4(%edi),%esi
+  801e56:	8b 1f                	mov    (%edi),%ebx
+  801e58:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801e5e:	29 d9                	sub    %ebx,%ecx
+  801e60:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e65:	f7 e1                	mul    %ecx
+  801e67:	c1 ea 0c             	shr    $0xc,%edx
+  801e6a:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801e70:	29 c1                	sub    %eax,%ecx
+  801e72:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801e74:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801e7a:	75 40                	jne    801ebc <devpipe_write+0x92>
+			ref = pageref(p);
+  801e7c:	83 ec 0c             	sub    $0xc,%esp
+  801e7f:	57                   	push   %edi
+  801e80:	e8 6c 06 00 00       	call   8024f1 <pageref>
+  801e85:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801e87:	89 fa                	mov    %edi,%edx
+  801e89:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e8c:	e8 0d fe ff ff       	call   801c9e <_pipeisclosed>
+  801e91:	83 c4 10             	add    $0x10,%esp
+  801e94:	85 c0                	test   %eax,%eax
+  801e96:	0f 85 d5 00 00 00    	jne    801f71 <devpipe_write+0x147>
+	*sleeping = 1;
+  801e9c:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801ea3:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801ea8:	39 1f                	cmp    %ebx,(%edi)
+  801eaa:	75 a7                	jne    801e53 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801eac:	83 ec 04             	sub    $0x4,%esp
+  801eaf:	56                   	push   %esi
+  801eb0:	53                   	push   %ebx
+  801eb1:	57                   	push   %edi
+  801eb2:	e8 16 f3 ff ff       	call   8011cd <sys_futex_wait>
+  801eb7:	83 c4 10             	add    $0x10,%esp
+  801eba:	eb 97                	jmp    801e53 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801ebc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801ebf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ec2:	29 c1                	sub    %eax,%ecx
+  801ec4:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801ec9:	89 d8                	mov    %ebx,%eax
+  801ecb:	29 d0                	sub    %edx,%eax
+  801ecd:	39 c1                	cmp    %eax,%ecx
+  801ecf:	0f 46 c1             	cmovbe %ecx,%eax
+  801ed2:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801ed4:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801ed9:	f7 e6                	mul    %esi
+  801edb:	c1 ea 0b             	shr    $0xb,%edx
+  801ede:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801ee4:	29 c6                	sub    %eax,%esi
+  801ee6:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801ee8:	29 f3                	sub    %esi,%ebx
+  801eea:	39 cb                	cmp    %ecx,%ebx
+  801eec:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801eef:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801ef2:	8d 77 10             	lea    0x10(%edi),%esi
+  801ef5:	83 ec 04             	sub    $0x4,%esp
+  801ef8:	53                   	push   %ebx
+  801ef9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801efc:	03 45 0c             	add    0xc(%ebp),%eax
+  801eff:	50                   	push   %eax
+  801f00:	01 f2                	add    %esi,%edx
+  801f02:	52                   	push   %edx
+  801f03:	e8 7f ea ff ff       	call   800987 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  801f08:	83 c4 0c             	add    $0xc,%esp
+  801f0b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f0e:	29 d8                	sub    %ebx,%eax
+  801f10:	50                   	push   %eax
+  801f11:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f14:	01 d3                	add    %edx,%ebx
+  801f16:	03 5d 0c             	add    0xc(%ebp),%ebx
+  801f19:	53                   	push   %ebx
+  801f1a:	56                   	push   %esi
+  801f1b:	e8 67 ea ff ff       	call   800987 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  801f20:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801f23:	03 4f 04             	add    0x4(%edi),%ecx
+  801f26:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f2b:	f7 e1                	mul    %ecx
+  801f2d:	c1 ea 0c             	shr    $0xc,%edx
+  801f30:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801f36:	29 d1                	sub    %edx,%ecx
+  801f38:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  801f3b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801f40:	83 c4 10             	add    $0x10,%esp
+  801f43:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  801f47:	75 0b                	jne    801f54 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  801f49:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  801f4c:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801f4f:	e9 f3 fe ff ff       	jmp    801e47 <devpipe_write+0x1d>
+		*sleeping = 0;
+  801f54:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  801f5b:	83 ec 08             	sub    $0x8,%esp
+  801f5e:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  801f63:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  801f66:	50                   	push   %eax
+  801f67:	e8 b1 f2 ff ff       	call   80121d <sys_futex_wake>
+  801f6c:	83 c4 10             	add    $0x10,%esp
+  801f6f:	eb d8                	jmp    801f49 <devpipe_write+0x11f>
+				return 0;
+  801f71:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f79:	5b                   	pop    %ebx
+  801f7a:	5e                   	pop    %esi
+  801f7b:	5f                   	pop    %edi
+  801f7c:	5d                   	pop    %ebp
+  801f7d:	c3                   	ret
+
+00801f7e <pipe>:
+{
+  801f7e:	55                   	push   %ebp
+  801f7f:	89 e5                	mov    %esp,%ebp
+  801f81:	56                   	push   %esi
+  801f82:	53                   	push   %ebx
+  801f83:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801f86:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f89:	50                   	push   %eax
+  801f8a:	e8 27 f3 ff ff       	call   8012b6 <fd_alloc>
+  801f8f:	89 c3                	mov    %eax,%ebx
+  801f91:	83 c4 10             	add    $0x10,%esp
+  801f94:	85 c0                	test   %eax,%eax
+  801f96:	0f 88 23 01 00 00    	js     8020bf <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f9c:	83 ec 04             	sub    $0x4,%esp
+  801f9f:	68 07 04 00 00       	push   $0x407
+  801fa4:	ff 75 f4             	push   -0xc(%ebp)
+  801fa7:	6a 00                	push   $0x0
+  801fa9:	e8 46 ed ff ff       	call   800cf4 <sys_page_alloc>
+  801fae:	89 c3                	mov    %eax,%ebx
+  801fb0:	83 c4 10             	add    $0x10,%esp
+  801fb3:	85 c0                	test   %eax,%eax
+  801fb5:	0f 88 04 01 00 00    	js     8020bf <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801fbb:	83 ec 0c             	sub    $0xc,%esp
+  801fbe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fc1:	50                   	push   %eax
+  801fc2:	e8 ef f2 ff ff       	call   8012b6 <fd_alloc>
+  801fc7:	89 c3                	mov    %eax,%ebx
+  801fc9:	83 c4 10             	add    $0x10,%esp
+  801fcc:	85 c0                	test   %eax,%eax
+  801fce:	0f 88 db 00 00 00    	js     8020af <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801fd4:	83 ec 04             	sub    $0x4,%esp
+  801fd7:	68 07 04 00 00       	push   $0x407
+  801fdc:	ff 75 f0             	push   -0x10(%ebp)
+  801fdf:	6a 00                	push   $0x0
+  801fe1:	e8 0e ed ff ff       	call   800cf4 <sys_page_alloc>
+  801fe6:	89 c3                	mov    %eax,%ebx
+  801fe8:	83 c4 10             	add    $0x10,%esp
+  801feb:	85 c0                	test   %eax,%eax
+  801fed:	0f 88 bc 00 00 00    	js     8020af <pipe+0x131>
+	va = fd2data(fd0);
+  801ff3:	83 ec 0c             	sub    $0xc,%esp
+  801ff6:	ff 75 f4             	push   -0xc(%ebp)
+  801ff9:	e8 a1 f2 ff ff       	call   80129f <fd2data>
+  801ffe:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802000:	83 c4 0c             	add    $0xc,%esp
+  802003:	68 07 04 00 00       	push   $0x407
+  802008:	50                   	push   %eax
+  802009:	6a 00                	push   $0x0
+  80200b:	e8 e4 ec ff ff       	call   800cf4 <sys_page_alloc>
+  802010:	89 c3                	mov    %eax,%ebx
+  802012:	83 c4 10             	add    $0x10,%esp
+  802015:	85 c0                	test   %eax,%eax
+  802017:	0f 88 82 00 00 00    	js     80209f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80201d:	83 ec 0c             	sub    $0xc,%esp
+  802020:	ff 75 f0             	push   -0x10(%ebp)
+  802023:	e8 77 f2 ff ff       	call   80129f <fd2data>
+  802028:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80202f:	50                   	push   %eax
+  802030:	6a 00                	push   $0x0
+  802032:	56                   	push   %esi
+  802033:	6a 00                	push   $0x0
+  802035:	e8 fd ec ff ff       	call   800d37 <sys_page_map>
+  80203a:	89 c3                	mov    %eax,%ebx
+  80203c:	83 c4 20             	add    $0x20,%esp
+  80203f:	85 c0                	test   %eax,%eax
+  802041:	78 4e                	js     802091 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802043:	a1 20 30 80 00       	mov    0x803020,%eax
+  802048:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80204b:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80204d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802050:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802057:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80205a:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80205c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80205f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802066:	83 ec 0c             	sub    $0xc,%esp
+  802069:	ff 75 f4             	push   -0xc(%ebp)
+  80206c:	e8 1e f2 ff ff       	call   80128f <fd2num>
+  802071:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802074:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802076:	83 c4 04             	add    $0x4,%esp
+  802079:	ff 75 f0             	push   -0x10(%ebp)
+  80207c:	e8 0e f2 ff ff       	call   80128f <fd2num>
+  802081:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802084:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802087:	83 c4 10             	add    $0x10,%esp
+  80208a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80208f:	eb 2e                	jmp    8020bf <pipe+0x141>
+	sys_page_unmap(0, va);
+  802091:	83 ec 08             	sub    $0x8,%esp
+  802094:	56                   	push   %esi
+  802095:	6a 00                	push   $0x0
+  802097:	e8 dd ec ff ff       	call   800d79 <sys_page_unmap>
+  80209c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80209f:	83 ec 08             	sub    $0x8,%esp
+  8020a2:	ff 75 f0             	push   -0x10(%ebp)
+  8020a5:	6a 00                	push   $0x0
+  8020a7:	e8 cd ec ff ff       	call   800d79 <sys_page_unmap>
+  8020ac:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8020af:	83 ec 08             	sub    $0x8,%esp
+  8020b2:	ff 75 f4             	push   -0xc(%ebp)
+  8020b5:	6a 00                	push   $0x0
+  8020b7:	e8 bd ec ff ff       	call   800d79 <sys_page_unmap>
+  8020bc:	83 c4 10             	add    $0x10,%esp
+}
+  8020bf:	89 d8                	mov    %ebx,%eax
+  8020c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020c4:	5b                   	pop    %ebx
+  8020c5:	5e                   	pop    %esi
+  8020c6:	5d                   	pop    %ebp
+  8020c7:	c3                   	ret
+
+008020c8 <pipeisclosed>:
+{
+  8020c8:	55                   	push   %ebp
+  8020c9:	89 e5                	mov    %esp,%ebp
+  8020cb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020d1:	50                   	push   %eax
+  8020d2:	ff 75 08             	push   0x8(%ebp)
+  8020d5:	e8 30 f2 ff ff       	call   80130a <fd_lookup>
+  8020da:	83 c4 10             	add    $0x10,%esp
+  8020dd:	85 c0                	test   %eax,%eax
+  8020df:	78 18                	js     8020f9 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8020e1:	83 ec 0c             	sub    $0xc,%esp
+  8020e4:	ff 75 f4             	push   -0xc(%ebp)
+  8020e7:	e8 b3 f1 ff ff       	call   80129f <fd2data>
+  8020ec:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8020ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020f1:	e8 a8 fb ff ff       	call   801c9e <_pipeisclosed>
+  8020f6:	83 c4 10             	add    $0x10,%esp
+}
+  8020f9:	c9                   	leave
+  8020fa:	c3                   	ret
+
+008020fb <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8020fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802100:	c3                   	ret
+
+00802101 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802101:	55                   	push   %ebp
+  802102:	89 e5                	mov    %esp,%ebp
+  802104:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802107:	68 96 2c 80 00       	push   $0x802c96
+  80210c:	ff 75 0c             	push   0xc(%ebp)
+  80210f:	e8 ed e6 ff ff       	call   800801 <strcpy>
+	return 0;
+}
+  802114:	b8 00 00 00 00       	mov    $0x0,%eax
+  802119:	c9                   	leave
+  80211a:	c3                   	ret
+
+0080211b <devcons_write>:
+{
+  80211b:	55                   	push   %ebp
+  80211c:	89 e5                	mov    %esp,%ebp
+  80211e:	57                   	push   %edi
+  80211f:	56                   	push   %esi
+  802120:	53                   	push   %ebx
+  802121:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802127:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80212c:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802132:	eb 2e                	jmp    802162 <devcons_write+0x47>
+		m = n - tot;
+  802134:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802137:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802139:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80213e:	39 c3                	cmp    %eax,%ebx
+  802140:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802143:	83 ec 04             	sub    $0x4,%esp
+  802146:	53                   	push   %ebx
+  802147:	89 f0                	mov    %esi,%eax
+  802149:	03 45 0c             	add    0xc(%ebp),%eax
+  80214c:	50                   	push   %eax
+  80214d:	57                   	push   %edi
+  80214e:	e8 34 e8 ff ff       	call   800987 <memmove>
+		sys_cputs(buf, m);
+  802153:	83 c4 08             	add    $0x8,%esp
+  802156:	53                   	push   %ebx
+  802157:	57                   	push   %edi
+  802158:	e8 ca ea ff ff       	call   800c27 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80215d:	01 de                	add    %ebx,%esi
+  80215f:	83 c4 10             	add    $0x10,%esp
+  802162:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802165:	72 cd                	jb     802134 <devcons_write+0x19>
+}
+  802167:	89 f0                	mov    %esi,%eax
+  802169:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80216c:	5b                   	pop    %ebx
+  80216d:	5e                   	pop    %esi
+  80216e:	5f                   	pop    %edi
+  80216f:	5d                   	pop    %ebp
+  802170:	c3                   	ret
+
+00802171 <devcons_read>:
+{
+  802171:	55                   	push   %ebp
+  802172:	89 e5                	mov    %esp,%ebp
+  802174:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802177:	b8 00 00 00 00       	mov    $0x0,%eax
+  80217c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802180:	75 07                	jne    802189 <devcons_read+0x18>
+  802182:	eb 1f                	jmp    8021a3 <devcons_read+0x32>
+		sys_yield();
+  802184:	e8 4c eb ff ff       	call   800cd5 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802189:	e8 c8 ea ff ff       	call   800c56 <sys_cgetc>
+  80218e:	85 c0                	test   %eax,%eax
+  802190:	74 f2                	je     802184 <devcons_read+0x13>
+	if (c < 0)
+  802192:	78 0f                	js     8021a3 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802194:	83 f8 04             	cmp    $0x4,%eax
+  802197:	74 0c                	je     8021a5 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802199:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80219c:	88 02                	mov    %al,(%edx)
+	return 1;
+  80219e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8021a3:	c9                   	leave
+  8021a4:	c3                   	ret
+		return 0;
+  8021a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021aa:	eb f7                	jmp    8021a3 <devcons_read+0x32>
+
+008021ac <cputchar>:
+{
+  8021ac:	55                   	push   %ebp
+  8021ad:	89 e5                	mov    %esp,%ebp
+  8021af:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8021b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b5:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8021b8:	6a 01                	push   $0x1
+  8021ba:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8021bd:	50                   	push   %eax
+  8021be:	e8 64 ea ff ff       	call   800c27 <sys_cputs>
+}
+  8021c3:	83 c4 10             	add    $0x10,%esp
+  8021c6:	c9                   	leave
+  8021c7:	c3                   	ret
+
+008021c8 <getchar>:
+{
+  8021c8:	55                   	push   %ebp
+  8021c9:	89 e5                	mov    %esp,%ebp
+  8021cb:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8021ce:	6a 01                	push   $0x1
+  8021d0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8021d3:	50                   	push   %eax
+  8021d4:	6a 00                	push   $0x0
+  8021d6:	e8 8e f3 ff ff       	call   801569 <read>
+	if (r < 0)
+  8021db:	83 c4 10             	add    $0x10,%esp
+  8021de:	85 c0                	test   %eax,%eax
+  8021e0:	78 06                	js     8021e8 <getchar+0x20>
+	if (r < 1)
+  8021e2:	74 06                	je     8021ea <getchar+0x22>
+	return c;
+  8021e4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8021e8:	c9                   	leave
+  8021e9:	c3                   	ret
+		return -E_EOF;
+  8021ea:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8021ef:	eb f7                	jmp    8021e8 <getchar+0x20>
+
+008021f1 <iscons>:
+{
+  8021f1:	55                   	push   %ebp
+  8021f2:	89 e5                	mov    %esp,%ebp
+  8021f4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021fa:	50                   	push   %eax
+  8021fb:	ff 75 08             	push   0x8(%ebp)
+  8021fe:	e8 07 f1 ff ff       	call   80130a <fd_lookup>
+  802203:	83 c4 10             	add    $0x10,%esp
+  802206:	85 c0                	test   %eax,%eax
+  802208:	78 11                	js     80221b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80220a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80220d:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  802213:	39 10                	cmp    %edx,(%eax)
+  802215:	0f 94 c0             	sete   %al
+  802218:	0f b6 c0             	movzbl %al,%eax
+}
+  80221b:	c9                   	leave
+  80221c:	c3                   	ret
+
+0080221d <opencons>:
+{
+  80221d:	55                   	push   %ebp
+  80221e:	89 e5                	mov    %esp,%ebp
+  802220:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802223:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802226:	50                   	push   %eax
+  802227:	e8 8a f0 ff ff       	call   8012b6 <fd_alloc>
+  80222c:	83 c4 10             	add    $0x10,%esp
+  80222f:	85 c0                	test   %eax,%eax
+  802231:	78 3a                	js     80226d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802233:	83 ec 04             	sub    $0x4,%esp
+  802236:	68 07 04 00 00       	push   $0x407
+  80223b:	ff 75 f4             	push   -0xc(%ebp)
+  80223e:	6a 00                	push   $0x0
+  802240:	e8 af ea ff ff       	call   800cf4 <sys_page_alloc>
+  802245:	83 c4 10             	add    $0x10,%esp
+  802248:	85 c0                	test   %eax,%eax
+  80224a:	78 21                	js     80226d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80224c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80224f:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  802255:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802257:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80225a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802261:	83 ec 0c             	sub    $0xc,%esp
+  802264:	50                   	push   %eax
+  802265:	e8 25 f0 ff ff       	call   80128f <fd2num>
+  80226a:	83 c4 10             	add    $0x10,%esp
+}
+  80226d:	c9                   	leave
+  80226e:	c3                   	ret
+
+0080226f <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  80226f:	55                   	push   %ebp
+  802270:	89 e5                	mov    %esp,%ebp
+  802272:	57                   	push   %edi
+  802273:	56                   	push   %esi
+  802274:	53                   	push   %ebx
+  802275:	83 ec 14             	sub    $0x14,%esp
+  802278:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80227b:	8b 75 14             	mov    0x14(%ebp),%esi
+  80227e:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  802281:	ff 75 10             	push   0x10(%ebp)
+  802284:	ff 75 0c             	push   0xc(%ebp)
+  802287:	e8 8b ee ff ff       	call   801117 <sys_ipc_recv_pages>
+  80228c:	83 c4 10             	add    $0x10,%esp
+  80228f:	85 c0                	test   %eax,%eax
+  802291:	78 46                	js     8022d9 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802293:	85 ff                	test   %edi,%edi
+  802295:	74 0d                	je     8022a4 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  802297:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  80229c:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8022a2:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8022a4:	85 f6                	test   %esi,%esi
+  8022a6:	74 0d                	je     8022b5 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  8022a8:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  8022ad:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8022b3:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8022b5:	85 db                	test   %ebx,%ebx
+  8022b7:	74 0d                	je     8022c6 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  8022b9:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  8022be:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8022c4:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8022c6:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  8022cb:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8022d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022d4:	5b                   	pop    %ebx
+  8022d5:	5e                   	pop    %esi
+  8022d6:	5f                   	pop    %edi
+  8022d7:	5d                   	pop    %ebp
+  8022d8:	c3                   	ret
+		if (from_env_store) {
+  8022d9:	85 ff                	test   %edi,%edi
+  8022db:	74 06                	je     8022e3 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  8022dd:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8022e3:	85 f6                	test   %esi,%esi
+  8022e5:	74 06                	je     8022ed <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  8022e7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8022ed:	85 db                	test   %ebx,%ebx
+  8022ef:	74 e0                	je     8022d1 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8022f1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8022f7:	eb d8                	jmp    8022d1 <ipc_recv_pages+0x62>
+
+008022f9 <ipc_recv>:
+{
+  8022f9:	55                   	push   %ebp
+  8022fa:	89 e5                	mov    %esp,%ebp
+  8022fc:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8022ff:	6a 00                	push   $0x0
+  802301:	ff 75 10             	push   0x10(%ebp)
+  802304:	6a 01                	push   $0x1
+  802306:	ff 75 0c             	push   0xc(%ebp)
+  802309:	ff 75 08             	push   0x8(%ebp)
+  80230c:	e8 5e ff ff ff       	call   80226f <ipc_recv_pages>
+}
+  802311:	c9                   	leave
+  802312:	c3                   	ret
+
+00802313 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802313:	55                   	push   %ebp
+  802314:	89 e5                	mov    %esp,%ebp
+  802316:	56                   	push   %esi
+  802317:	53                   	push   %ebx
+  802318:	8b 75 08             	mov    0x8(%ebp),%esi
+  80231b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  80231e:	83 ec 0c             	sub    $0xc,%esp
+  802321:	ff 75 0c             	push   0xc(%ebp)
+  802324:	e8 22 ef ff ff       	call   80124b <sys_ipc_try_recv>
+  802329:	83 c4 10             	add    $0x10,%esp
+  80232c:	85 c0                	test   %eax,%eax
+  80232e:	78 34                	js     802364 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802330:	85 f6                	test   %esi,%esi
+  802332:	74 0d                	je     802341 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  802334:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  802339:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80233f:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  802341:	85 db                	test   %ebx,%ebx
+  802343:	74 0d                	je     802352 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  802345:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  80234a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802350:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802352:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  802357:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80235d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802360:	5b                   	pop    %ebx
+  802361:	5e                   	pop    %esi
+  802362:	5d                   	pop    %ebp
+  802363:	c3                   	ret
+		if (from_env_store) {
+  802364:	85 f6                	test   %esi,%esi
+  802366:	74 06                	je     80236e <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  802368:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  80236e:	85 db                	test   %ebx,%ebx
+  802370:	74 eb                	je     80235d <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  802372:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802378:	eb e3                	jmp    80235d <ipc_try_recv+0x4a>
+
+0080237a <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  80237a:	55                   	push   %ebp
+  80237b:	89 e5                	mov    %esp,%ebp
+  80237d:	83 ec 14             	sub    $0x14,%esp
+  802380:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802383:	85 c0                	test   %eax,%eax
+  802385:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80238a:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80238d:	ff 75 18             	push   0x18(%ebp)
+  802390:	ff 75 14             	push   0x14(%ebp)
+  802393:	50                   	push   %eax
+  802394:	ff 75 0c             	push   0xc(%ebp)
+  802397:	ff 75 08             	push   0x8(%ebp)
+  80239a:	e8 3b ed ff ff       	call   8010da <sys_ipc_send_pages>
+  80239f:	83 c4 20             	add    $0x20,%esp
+  8023a2:	85 c0                	test   %eax,%eax
+  8023a4:	78 02                	js     8023a8 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  8023a6:	c9                   	leave
+  8023a7:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  8023a8:	50                   	push   %eax
+  8023a9:	68 a4 2c 80 00       	push   $0x802ca4
+  8023ae:	68 80 00 00 00       	push   $0x80
+  8023b3:	68 d0 2c 80 00       	push   $0x802cd0
+  8023b8:	e8 82 dd ff ff       	call   80013f <_panic>
+
+008023bd <ipc_send>:
+{
+  8023bd:	55                   	push   %ebp
+  8023be:	89 e5                	mov    %esp,%ebp
+  8023c0:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  8023c3:	ff 75 14             	push   0x14(%ebp)
+  8023c6:	6a 01                	push   $0x1
+  8023c8:	ff 75 10             	push   0x10(%ebp)
+  8023cb:	ff 75 0c             	push   0xc(%ebp)
+  8023ce:	ff 75 08             	push   0x8(%ebp)
+  8023d1:	e8 a4 ff ff ff       	call   80237a <ipc_send_pages>
+}
+  8023d6:	83 c4 20             	add    $0x20,%esp
+  8023d9:	c9                   	leave
+  8023da:	c3                   	ret
+
+008023db <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8023db:	55                   	push   %ebp
+  8023dc:	89 e5                	mov    %esp,%ebp
+  8023de:	83 ec 14             	sub    $0x14,%esp
+  8023e1:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8023e4:	85 c0                	test   %eax,%eax
+  8023e6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8023eb:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8023ee:	ff 75 18             	push   0x18(%ebp)
+  8023f1:	ff 75 14             	push   0x14(%ebp)
+  8023f4:	50                   	push   %eax
+  8023f5:	ff 75 0c             	push   0xc(%ebp)
+  8023f8:	ff 75 08             	push   0x8(%ebp)
+  8023fb:	e8 6b ed ff ff       	call   80116b <sys_ipc_call>
+  802400:	83 c4 20             	add    $0x20,%esp
+  802403:	85 c0                	test   %eax,%eax
+  802405:	78 0b                	js     802412 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  802407:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  80240c:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802412:	c9                   	leave
+  802413:	c3                   	ret
+
+00802414 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  802414:	55                   	push   %ebp
+  802415:	89 e5                	mov    %esp,%ebp
+  802417:	57                   	push   %edi
+  802418:	56                   	push   %esi
+  802419:	53                   	push   %ebx
+  80241a:	83 ec 18             	sub    $0x18,%esp
+  80241d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802420:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  802423:	8b 75 20             	mov    0x20(%ebp),%esi
+  802426:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802429:	85 c0                	test   %eax,%eax
+  80242b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802430:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802433:	ff 75 18             	push   0x18(%ebp)
+  802436:	ff 75 14             	push   0x14(%ebp)
+  802439:	50                   	push   %eax
+  80243a:	ff 75 0c             	push   0xc(%ebp)
+  80243d:	ff 75 08             	push   0x8(%ebp)
+  802440:	e8 67 ed ff ff       	call   8011ac <sys_ipc_reply_recv>
+  802445:	83 c4 20             	add    $0x20,%esp
+  802448:	85 c0                	test   %eax,%eax
+  80244a:	78 46                	js     802492 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80244c:	85 ff                	test   %edi,%edi
+  80244e:	74 0d                	je     80245d <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  802450:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  802455:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80245b:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80245d:	85 f6                	test   %esi,%esi
+  80245f:	74 0d                	je     80246e <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  802461:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  802466:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80246c:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80246e:	85 db                	test   %ebx,%ebx
+  802470:	74 0d                	je     80247f <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  802472:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  802477:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80247d:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80247f:	a1 24 40 c0 00       	mov    0xc04024,%eax
+  802484:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80248a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80248d:	5b                   	pop    %ebx
+  80248e:	5e                   	pop    %esi
+  80248f:	5f                   	pop    %edi
+  802490:	5d                   	pop    %ebp
+  802491:	c3                   	ret
+		if (from_env_store) {
+  802492:	85 ff                	test   %edi,%edi
+  802494:	74 06                	je     80249c <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  802496:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80249c:	85 f6                	test   %esi,%esi
+  80249e:	74 06                	je     8024a6 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  8024a0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8024a6:	85 db                	test   %ebx,%ebx
+  8024a8:	74 e0                	je     80248a <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  8024aa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8024b0:	eb d8                	jmp    80248a <ipc_reply_recv+0x76>
+
+008024b2 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8024b2:	55                   	push   %ebp
+  8024b3:	89 e5                	mov    %esp,%ebp
+  8024b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8024b8:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8024bd:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8024c0:	c1 e0 06             	shl    $0x6,%eax
+  8024c3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8024c8:	8b 40 50             	mov    0x50(%eax),%eax
+  8024cb:	39 c8                	cmp    %ecx,%eax
+  8024cd:	74 12                	je     8024e1 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8024cf:	83 c2 01             	add    $0x1,%edx
+  8024d2:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8024d8:	75 e3                	jne    8024bd <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8024da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024df:	eb 0e                	jmp    8024ef <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8024e1:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8024e4:	c1 e0 06             	shl    $0x6,%eax
+  8024e7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8024ec:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8024ef:	5d                   	pop    %ebp
+  8024f0:	c3                   	ret
+
+008024f1 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8024f1:	55                   	push   %ebp
+  8024f2:	89 e5                	mov    %esp,%ebp
+  8024f4:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8024f7:	89 c2                	mov    %eax,%edx
+  8024f9:	c1 ea 16             	shr    $0x16,%edx
+  8024fc:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802503:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802508:	f6 c1 01             	test   $0x1,%cl
+  80250b:	74 1e                	je     80252b <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  80250d:	c1 e8 0c             	shr    $0xc,%eax
+  802510:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802517:	a8 01                	test   $0x1,%al
+  802519:	74 10                	je     80252b <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80251b:	c1 e8 0c             	shr    $0xc,%eax
+  80251e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802521:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  802528:	0f b7 d2             	movzwl %dx,%edx
+}
+  80252b:	89 d0                	mov    %edx,%eax
+  80252d:	5d                   	pop    %ebp
+  80252e:	c3                   	ret
+
+0080252f <udivmod>:
+  80252f:	55                   	push   %ebp
+  802530:	57                   	push   %edi
+  802531:	56                   	push   %esi
+  802532:	53                   	push   %ebx
+  802533:	83 ec 24             	sub    $0x24,%esp
+  802536:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80253a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80253e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802542:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802546:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80254a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80254e:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802552:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802557:	b8 00 00 00 00       	mov    $0x0,%eax
+  80255c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802561:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802568:	00 
+  802569:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802570:	00 
+  802571:	89 fb                	mov    %edi,%ebx
+  802573:	eb 08                	jmp    80257d <udivmod+0x4e>
+  802575:	83 e9 01             	sub    $0x1,%ecx
+  802578:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80257b:	74 68                	je     8025e5 <udivmod+0xb6>
+  80257d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802581:	01 c0                	add    %eax,%eax
+  802583:	89 c6                	mov    %eax,%esi
+  802585:	89 d7                	mov    %edx,%edi
+  802587:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80258b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80258f:	0f ad d0             	shrd   %cl,%edx,%eax
+  802592:	d3 ea                	shr    %cl,%edx
+  802594:	f6 c1 20             	test   $0x20,%cl
+  802597:	74 04                	je     80259d <udivmod+0x6e>
+  802599:	89 d0                	mov    %edx,%eax
+  80259b:	31 d2                	xor    %edx,%edx
+  80259d:	83 e0 01             	and    $0x1,%eax
+  8025a0:	89 04 24             	mov    %eax,(%esp)
+  8025a3:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8025aa:	00 
+  8025ab:	8b 04 24             	mov    (%esp),%eax
+  8025ae:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8025b2:	09 f0                	or     %esi,%eax
+  8025b4:	09 fa                	or     %edi,%edx
+  8025b6:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8025ba:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8025be:	39 f0                	cmp    %esi,%eax
+  8025c0:	89 d5                	mov    %edx,%ebp
+  8025c2:	19 fd                	sbb    %edi,%ebp
+  8025c4:	72 af                	jb     802575 <udivmod+0x46>
+  8025c6:	29 f0                	sub    %esi,%eax
+  8025c8:	19 fa                	sbb    %edi,%edx
+  8025ca:	89 cf                	mov    %ecx,%edi
+  8025cc:	c1 ef 05             	shr    $0x5,%edi
+  8025cf:	83 e7 01             	and    $0x1,%edi
+  8025d2:	89 fe                	mov    %edi,%esi
+  8025d4:	83 f6 01             	xor    $0x1,%esi
+  8025d7:	d3 e6                	shl    %cl,%esi
+  8025d9:	d3 e7                	shl    %cl,%edi
+  8025db:	09 74 24 18          	or     %esi,0x18(%esp)
+  8025df:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8025e3:	eb 90                	jmp    802575 <udivmod+0x46>
+  8025e5:	85 db                	test   %ebx,%ebx
+  8025e7:	74 05                	je     8025ee <udivmod+0xbf>
+  8025e9:	89 03                	mov    %eax,(%ebx)
+  8025eb:	89 53 04             	mov    %edx,0x4(%ebx)
+  8025ee:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025f2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025f6:	83 c4 24             	add    $0x24,%esp
+  8025f9:	5b                   	pop    %ebx
+  8025fa:	5e                   	pop    %esi
+  8025fb:	5f                   	pop    %edi
+  8025fc:	5d                   	pop    %ebp
+  8025fd:	c3                   	ret
+
+008025fe <__udivdi3>:
+  8025fe:	83 ec 08             	sub    $0x8,%esp
+  802601:	6a 00                	push   $0x0
+  802603:	ff 74 24 1c          	push   0x1c(%esp)
+  802607:	ff 74 24 1c          	push   0x1c(%esp)
+  80260b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80260f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802613:	e8 17 ff ff ff       	call   80252f <udivmod>
+  802618:	83 c4 14             	add    $0x14,%esp
+  80261b:	c3                   	ret
+
+0080261c <__umoddi3>:
+  80261c:	83 ec 18             	sub    $0x18,%esp
+  80261f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802623:	50                   	push   %eax
+  802624:	ff 74 24 2c          	push   0x2c(%esp)
+  802628:	ff 74 24 2c          	push   0x2c(%esp)
+  80262c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802630:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802634:	e8 f6 fe ff ff       	call   80252f <udivmod>
+  802639:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80263d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802641:	83 c4 24             	add    $0x24,%esp
+  802644:	c3                   	ret
+
+00802645 <__divdi3>:
+  802645:	55                   	push   %ebp
+  802646:	57                   	push   %edi
+  802647:	56                   	push   %esi
+  802648:	53                   	push   %ebx
+  802649:	83 ec 10             	sub    $0x10,%esp
+  80264c:	8b 44 24 24          	mov    0x24(%esp),%eax
+  802650:	8b 54 24 28          	mov    0x28(%esp),%edx
+  802654:	89 c6                	mov    %eax,%esi
+  802656:	89 d7                	mov    %edx,%edi
+  802658:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  80265c:	33 7c 24 30          	xor    0x30(%esp),%edi
+  802660:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802664:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  802668:	89 c5                	mov    %eax,%ebp
+  80266a:	f7 dd                	neg    %ebp
+  80266c:	89 d6                	mov    %edx,%esi
+  80266e:	83 d6 00             	adc    $0x0,%esi
+  802671:	f7 de                	neg    %esi
+  802673:	0f 48 e8             	cmovs  %eax,%ebp
+  802676:	0f 49 d6             	cmovns %esi,%edx
+  802679:	6a 00                	push   $0x0
+  80267b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80267f:	f7 de                	neg    %esi
+  802681:	8b 44 24 34          	mov    0x34(%esp),%eax
+  802685:	83 d0 00             	adc    $0x0,%eax
+  802688:	f7 d8                	neg    %eax
+  80268a:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  80268f:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  802694:	50                   	push   %eax
+  802695:	56                   	push   %esi
+  802696:	89 e8                	mov    %ebp,%eax
+  802698:	e8 92 fe ff ff       	call   80252f <udivmod>
+  80269d:	83 c4 10             	add    $0x10,%esp
+  8026a0:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  8026a5:	78 08                	js     8026af <__divdi3+0x6a>
+  8026a7:	83 c4 0c             	add    $0xc,%esp
+  8026aa:	5b                   	pop    %ebx
+  8026ab:	5e                   	pop    %esi
+  8026ac:	5f                   	pop    %edi
+  8026ad:	5d                   	pop    %ebp
+  8026ae:	c3                   	ret
+  8026af:	f7 d8                	neg    %eax
+  8026b1:	83 d2 00             	adc    $0x0,%edx
+  8026b4:	f7 da                	neg    %edx
+  8026b6:	eb ef                	jmp    8026a7 <__divdi3+0x62>
+
+008026b8 <__moddi3>:
+  8026b8:	55                   	push   %ebp
+  8026b9:	57                   	push   %edi
+  8026ba:	56                   	push   %esi
+  8026bb:	53                   	push   %ebx
+  8026bc:	83 ec 18             	sub    $0x18,%esp
+  8026bf:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8026c3:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8026c7:	89 f1                	mov    %esi,%ecx
+  8026c9:	f7 d9                	neg    %ecx
+  8026cb:	89 da                	mov    %ebx,%edx
+  8026cd:	83 d2 00             	adc    $0x0,%edx
+  8026d0:	f7 da                	neg    %edx
+  8026d2:	0f 48 ce             	cmovs  %esi,%ecx
+  8026d5:	0f 48 d3             	cmovs  %ebx,%edx
+  8026d8:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8026dc:	50                   	push   %eax
+  8026dd:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8026e1:	f7 de                	neg    %esi
+  8026e3:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8026e7:	83 d0 00             	adc    $0x0,%eax
+  8026ea:	f7 d8                	neg    %eax
+  8026ec:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8026f1:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8026f6:	50                   	push   %eax
+  8026f7:	56                   	push   %esi
+  8026f8:	89 c8                	mov    %ecx,%eax
+  8026fa:	e8 30 fe ff ff       	call   80252f <udivmod>
+  8026ff:	83 c4 10             	add    $0x10,%esp
+  802702:	85 db                	test   %ebx,%ebx
+  802704:	78 10                	js     802716 <__moddi3+0x5e>
+  802706:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80270a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80270e:	83 c4 14             	add    $0x14,%esp
+  802711:	5b                   	pop    %ebx
+  802712:	5e                   	pop    %esi
+  802713:	5f                   	pop    %edi
+  802714:	5d                   	pop    %ebp
+  802715:	c3                   	ret
+  802716:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80271a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80271e:	f7 d8                	neg    %eax
+  802720:	83 d2 00             	adc    $0x0,%edx
+  802723:	f7 da                	neg    %edx
+  802725:	eb e7                	jmp    80270e <__moddi3+0x56>
@@ -0,0 +1,10593 @@
+
+obj/user/testfairness.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 94 01 00 00       	call   8001c5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define MIN_ADDR 0x10000000
+#define MAX_ADDR 0x14000000
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	int r;
+	uintptr_t va;
+	envid_t envid, parent_envid;
+
+	parent_envid = thisenv->env_id;
+  800038:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80003d:	8b 40 48             	mov    0x48(%eax),%eax
+	envid = fork();
+  800040:	e8 7f 14 00 00       	call   8014c4 <fork>
+  800045:	89 c6                	mov    %eax,%esi
+	if(envid<0){
+  800047:	85 c0                	test   %eax,%eax
+  800049:	0f 88 a0 00 00 00    	js     8000ef <umain+0xbc>
+		panic("fork: %e", envid);
+	} else if (envid){
+  80004f:	0f 84 ea 00 00 00    	je     80013f <umain+0x10c>
+		// Parent
+		for(va = MIN_ADDR; va < MAX_ADDR; va+=PGSIZE){
+  800055:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+			cprintf("parent +%x\n", va);
+  80005a:	83 ec 08             	sub    $0x8,%esp
+  80005d:	53                   	push   %ebx
+  80005e:	68 a9 53 80 00       	push   $0x8053a9
+  800063:	e8 9b 02 00 00       	call   800303 <cprintf>
+			if((r = page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W, 1)) < 0)
+  800068:	6a 01                	push   $0x1
+  80006a:	6a 07                	push   $0x7
+  80006c:	53                   	push   %ebx
+  80006d:	6a 00                	push   $0x0
+  80006f:	e8 1f 3b 00 00       	call   803b93 <page_alloc>
+  800074:	83 c4 20             	add    $0x20,%esp
+  800077:	85 c0                	test   %eax,%eax
+  800079:	0f 88 82 00 00 00    	js     800101 <umain+0xce>
+				panic("sys_page_alloc on %p: %e", va, r);
+
+			// Store the address in the page
+			*(uintptr_t*)va = (uintptr_t)va;
+  80007f:	89 1b                	mov    %ebx,(%ebx)
+		for(va = MIN_ADDR; va < MAX_ADDR; va+=PGSIZE){
+  800081:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800087:	81 fb 00 00 00 14    	cmp    $0x14000000,%ebx
+  80008d:	75 cb                	jne    80005a <umain+0x27>
+		}
+
+		cprintf("starting child\n");
+  80008f:	83 ec 0c             	sub    $0xc,%esp
+  800092:	68 ce 53 80 00       	push   $0x8053ce
+  800097:	e8 67 02 00 00       	call   800303 <cprintf>
+		if((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80009c:	83 c4 08             	add    $0x8,%esp
+  80009f:	6a 02                	push   $0x2
+  8000a1:	56                   	push   %esi
+  8000a2:	e8 74 0f 00 00       	call   80101b <sys_env_set_status>
+  8000a7:	83 c4 10             	add    $0x10,%esp
+  8000aa:	85 c0                	test   %eax,%eax
+  8000ac:	78 69                	js     800117 <umain+0xe4>
+			panic("parent sys_env_set_status: %e", r);
+
+		for(va = MIN_ADDR; va < MIN_ADDR + PGSIZE*250; va+=PGSIZE){
+  8000ae:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+                	cprintf("parent +%x=%x\n", va, *(uintptr_t*)va);
+  8000b3:	83 ec 04             	sub    $0x4,%esp
+  8000b6:	ff 33                	push   (%ebx)
+  8000b8:	53                   	push   %ebx
+  8000b9:	68 fc 53 80 00       	push   $0x8053fc
+  8000be:	e8 40 02 00 00       	call   800303 <cprintf>
+                	assert(*(uintptr_t*)va == (uintptr_t)va);
+  8000c3:	83 c4 10             	add    $0x10,%esp
+  8000c6:	39 1b                	cmp    %ebx,(%ebx)
+  8000c8:	75 5f                	jne    800129 <umain+0xf6>
+		for(va = MIN_ADDR; va < MIN_ADDR + PGSIZE*250; va+=PGSIZE){
+  8000ca:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8000d0:	81 fb 00 a0 0f 10    	cmp    $0x100fa000,%ebx
+  8000d6:	75 db                	jne    8000b3 <umain+0x80>
+		}
+
+		cprintf("parent done\n");
+  8000d8:	83 ec 0c             	sub    $0xc,%esp
+  8000db:	68 20 54 80 00       	push   $0x805420
+  8000e0:	e8 1e 02 00 00       	call   800303 <cprintf>
+  8000e5:	83 c4 10             	add    $0x10,%esp
+			*(uintptr_t*)va = (uintptr_t)va;
+		}
+		cprintf("child done\n");
+	}
+
+}
+  8000e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000eb:	5b                   	pop    %ebx
+  8000ec:	5e                   	pop    %esi
+  8000ed:	5d                   	pop    %ebp
+  8000ee:	c3                   	ret
+		panic("fork: %e", envid);
+  8000ef:	50                   	push   %eax
+  8000f0:	68 a0 53 80 00       	push   $0x8053a0
+  8000f5:	6a 15                	push   $0x15
+  8000f7:	68 64 54 80 00       	push   $0x805464
+  8000fc:	e8 27 01 00 00       	call   800228 <_panic>
+				panic("sys_page_alloc on %p: %e", va, r);
+  800101:	83 ec 0c             	sub    $0xc,%esp
+  800104:	50                   	push   %eax
+  800105:	53                   	push   %ebx
+  800106:	68 b5 53 80 00       	push   $0x8053b5
+  80010b:	6a 1b                	push   $0x1b
+  80010d:	68 64 54 80 00       	push   $0x805464
+  800112:	e8 11 01 00 00       	call   800228 <_panic>
+			panic("parent sys_env_set_status: %e", r);
+  800117:	50                   	push   %eax
+  800118:	68 de 53 80 00       	push   $0x8053de
+  80011d:	6a 23                	push   $0x23
+  80011f:	68 64 54 80 00       	push   $0x805464
+  800124:	e8 ff 00 00 00       	call   800228 <_panic>
+                	assert(*(uintptr_t*)va == (uintptr_t)va);
+  800129:	68 88 54 80 00       	push   $0x805488
+  80012e:	68 0b 54 80 00       	push   $0x80540b
+  800133:	6a 27                	push   $0x27
+  800135:	68 64 54 80 00       	push   $0x805464
+  80013a:	e8 e9 00 00 00       	call   800228 <_panic>
+		if((r = sys_env_set_status(0, ENV_NOT_RUNNABLE)) < 0)
+  80013f:	83 ec 08             	sub    $0x8,%esp
+  800142:	6a 04                	push   $0x4
+  800144:	6a 00                	push   $0x0
+  800146:	e8 d0 0e 00 00       	call   80101b <sys_env_set_status>
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	85 c0                	test   %eax,%eax
+  800150:	78 4b                	js     80019d <umain+0x16a>
+		for(va = MIN_ADDR; va < MIN_ADDR + PGSIZE*250; va+=PGSIZE){
+  800152:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+			cprintf("child +%x\n", va);
+  800157:	83 ec 08             	sub    $0x8,%esp
+  80015a:	53                   	push   %ebx
+  80015b:	68 4a 54 80 00       	push   $0x80544a
+  800160:	e8 9e 01 00 00       	call   800303 <cprintf>
+			if((r = page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W, 1)) < 0)
+  800165:	6a 01                	push   $0x1
+  800167:	6a 07                	push   $0x7
+  800169:	53                   	push   %ebx
+  80016a:	6a 00                	push   $0x0
+  80016c:	e8 22 3a 00 00       	call   803b93 <page_alloc>
+  800171:	83 c4 20             	add    $0x20,%esp
+  800174:	85 c0                	test   %eax,%eax
+  800176:	78 37                	js     8001af <umain+0x17c>
+			*(uintptr_t*)va = (uintptr_t)va;
+  800178:	89 1b                	mov    %ebx,(%ebx)
+		for(va = MIN_ADDR; va < MIN_ADDR + PGSIZE*250; va+=PGSIZE){
+  80017a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800180:	81 fb 00 a0 0f 10    	cmp    $0x100fa000,%ebx
+  800186:	75 cf                	jne    800157 <umain+0x124>
+		cprintf("child done\n");
+  800188:	83 ec 0c             	sub    $0xc,%esp
+  80018b:	68 55 54 80 00       	push   $0x805455
+  800190:	e8 6e 01 00 00       	call   800303 <cprintf>
+  800195:	83 c4 10             	add    $0x10,%esp
+}
+  800198:	e9 4b ff ff ff       	jmp    8000e8 <umain+0xb5>
+			panic("child sys_env_set_status: %e", r);
+  80019d:	50                   	push   %eax
+  80019e:	68 2d 54 80 00       	push   $0x80542d
+  8001a3:	6a 2e                	push   $0x2e
+  8001a5:	68 64 54 80 00       	push   $0x805464
+  8001aa:	e8 79 00 00 00       	call   800228 <_panic>
+				panic("sys_page_alloc on %p: %e", va, r);
+  8001af:	83 ec 0c             	sub    $0xc,%esp
+  8001b2:	50                   	push   %eax
+  8001b3:	53                   	push   %ebx
+  8001b4:	68 b5 53 80 00       	push   $0x8053b5
+  8001b9:	6a 33                	push   $0x33
+  8001bb:	68 64 54 80 00       	push   $0x805464
+  8001c0:	e8 63 00 00 00       	call   800228 <_panic>
+
+008001c5 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001c5:	55                   	push   %ebp
+  8001c6:	89 e5                	mov    %esp,%ebp
+  8001c8:	56                   	push   %esi
+  8001c9:	53                   	push   %ebx
+  8001ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001cd:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8001d0:	e8 ca 0b 00 00       	call   800d9f <sys_getenvid>
+  8001d5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001da:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8001dd:	c1 e0 06             	shl    $0x6,%eax
+  8001e0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001e5:	a3 18 f9 80 00       	mov    %eax,0x80f918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001ea:	85 db                	test   %ebx,%ebx
+  8001ec:	7e 07                	jle    8001f5 <libmain+0x30>
+		binaryname = argv[0];
+  8001ee:	8b 06                	mov    (%esi),%eax
+  8001f0:	a3 00 70 80 00       	mov    %eax,0x807000
+
+	// call user main routine
+	umain(argc, argv);
+  8001f5:	83 ec 08             	sub    $0x8,%esp
+  8001f8:	56                   	push   %esi
+  8001f9:	53                   	push   %ebx
+  8001fa:	e8 34 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8001ff:	e8 0a 00 00 00       	call   80020e <exit>
+}
+  800204:	83 c4 10             	add    $0x10,%esp
+  800207:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80020a:	5b                   	pop    %ebx
+  80020b:	5e                   	pop    %esi
+  80020c:	5d                   	pop    %ebp
+  80020d:	c3                   	ret
+
+0080020e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80020e:	55                   	push   %ebp
+  80020f:	89 e5                	mov    %esp,%ebp
+  800211:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800214:	e8 de 18 00 00       	call   801af7 <close_all>
+	sys_env_destroy(0);
+  800219:	83 ec 0c             	sub    $0xc,%esp
+  80021c:	6a 00                	push   $0x0
+  80021e:	e8 3b 0b 00 00       	call   800d5e <sys_env_destroy>
+}
+  800223:	83 c4 10             	add    $0x10,%esp
+  800226:	c9                   	leave
+  800227:	c3                   	ret
+
+00800228 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800228:	55                   	push   %ebp
+  800229:	89 e5                	mov    %esp,%ebp
+  80022b:	56                   	push   %esi
+  80022c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80022d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800230:	8b 35 00 70 80 00    	mov    0x807000,%esi
+  800236:	e8 64 0b 00 00       	call   800d9f <sys_getenvid>
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	ff 75 0c             	push   0xc(%ebp)
+  800241:	ff 75 08             	push   0x8(%ebp)
+  800244:	56                   	push   %esi
+  800245:	50                   	push   %eax
+  800246:	68 b4 54 80 00       	push   $0x8054b4
+  80024b:	e8 b3 00 00 00       	call   800303 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800250:	83 c4 18             	add    $0x18,%esp
+  800253:	53                   	push   %ebx
+  800254:	ff 75 10             	push   0x10(%ebp)
+  800257:	e8 56 00 00 00       	call   8002b2 <vcprintf>
+	cprintf("\n");
+  80025c:	c7 04 24 4c 5a 80 00 	movl   $0x805a4c,(%esp)
+  800263:	e8 9b 00 00 00       	call   800303 <cprintf>
+  800268:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80026b:	cc                   	int3
+	while (1)
+  80026c:	eb fd                	jmp    80026b <_panic+0x43>
+
+0080026e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80026e:	55                   	push   %ebp
+  80026f:	89 e5                	mov    %esp,%ebp
+  800271:	53                   	push   %ebx
+  800272:	83 ec 04             	sub    $0x4,%esp
+  800275:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800278:	8b 13                	mov    (%ebx),%edx
+  80027a:	8d 42 01             	lea    0x1(%edx),%eax
+  80027d:	89 03                	mov    %eax,(%ebx)
+  80027f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800282:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800286:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80028b:	74 09                	je     800296 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80028d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800291:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800294:	c9                   	leave
+  800295:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800296:	83 ec 08             	sub    $0x8,%esp
+  800299:	68 ff 00 00 00       	push   $0xff
+  80029e:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002a1:	50                   	push   %eax
+  8002a2:	e8 69 0a 00 00       	call   800d10 <sys_cputs>
+		b->idx = 0;
+  8002a7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002ad:	83 c4 10             	add    $0x10,%esp
+  8002b0:	eb db                	jmp    80028d <putch+0x1f>
+
+008002b2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002b2:	55                   	push   %ebp
+  8002b3:	89 e5                	mov    %esp,%ebp
+  8002b5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002bb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002c2:	00 00 00 
+	b.cnt = 0;
+  8002c5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002cc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002cf:	ff 75 0c             	push   0xc(%ebp)
+  8002d2:	ff 75 08             	push   0x8(%ebp)
+  8002d5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002db:	50                   	push   %eax
+  8002dc:	68 6e 02 80 00       	push   $0x80026e
+  8002e1:	e8 14 01 00 00       	call   8003fa <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002e6:	83 c4 08             	add    $0x8,%esp
+  8002e9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002ef:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002f5:	50                   	push   %eax
+  8002f6:	e8 15 0a 00 00       	call   800d10 <sys_cputs>
+
+	return b.cnt;
+}
+  8002fb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800301:	c9                   	leave
+  800302:	c3                   	ret
+
+00800303 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800303:	55                   	push   %ebp
+  800304:	89 e5                	mov    %esp,%ebp
+  800306:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800309:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80030c:	50                   	push   %eax
+  80030d:	ff 75 08             	push   0x8(%ebp)
+  800310:	e8 9d ff ff ff       	call   8002b2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800315:	c9                   	leave
+  800316:	c3                   	ret
+
+00800317 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800317:	55                   	push   %ebp
+  800318:	89 e5                	mov    %esp,%ebp
+  80031a:	57                   	push   %edi
+  80031b:	56                   	push   %esi
+  80031c:	53                   	push   %ebx
+  80031d:	83 ec 1c             	sub    $0x1c,%esp
+  800320:	89 c7                	mov    %eax,%edi
+  800322:	89 d6                	mov    %edx,%esi
+  800324:	8b 45 08             	mov    0x8(%ebp),%eax
+  800327:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80032a:	89 d1                	mov    %edx,%ecx
+  80032c:	89 c2                	mov    %eax,%edx
+  80032e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800331:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800334:	8b 45 10             	mov    0x10(%ebp),%eax
+  800337:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80033a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80033d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800344:	39 c2                	cmp    %eax,%edx
+  800346:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800349:	72 3e                	jb     800389 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80034b:	83 ec 0c             	sub    $0xc,%esp
+  80034e:	ff 75 18             	push   0x18(%ebp)
+  800351:	83 eb 01             	sub    $0x1,%ebx
+  800354:	53                   	push   %ebx
+  800355:	50                   	push   %eax
+  800356:	83 ec 08             	sub    $0x8,%esp
+  800359:	ff 75 e4             	push   -0x1c(%ebp)
+  80035c:	ff 75 e0             	push   -0x20(%ebp)
+  80035f:	ff 75 dc             	push   -0x24(%ebp)
+  800362:	ff 75 d8             	push   -0x28(%ebp)
+  800365:	e8 02 4f 00 00       	call   80526c <__udivdi3>
+  80036a:	83 c4 18             	add    $0x18,%esp
+  80036d:	52                   	push   %edx
+  80036e:	50                   	push   %eax
+  80036f:	89 f2                	mov    %esi,%edx
+  800371:	89 f8                	mov    %edi,%eax
+  800373:	e8 9f ff ff ff       	call   800317 <printnum>
+  800378:	83 c4 20             	add    $0x20,%esp
+  80037b:	eb 13                	jmp    800390 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80037d:	83 ec 08             	sub    $0x8,%esp
+  800380:	56                   	push   %esi
+  800381:	ff 75 18             	push   0x18(%ebp)
+  800384:	ff d7                	call   *%edi
+  800386:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800389:	83 eb 01             	sub    $0x1,%ebx
+  80038c:	85 db                	test   %ebx,%ebx
+  80038e:	7f ed                	jg     80037d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800390:	83 ec 08             	sub    $0x8,%esp
+  800393:	56                   	push   %esi
+  800394:	83 ec 04             	sub    $0x4,%esp
+  800397:	ff 75 e4             	push   -0x1c(%ebp)
+  80039a:	ff 75 e0             	push   -0x20(%ebp)
+  80039d:	ff 75 dc             	push   -0x24(%ebp)
+  8003a0:	ff 75 d8             	push   -0x28(%ebp)
+  8003a3:	e8 e2 4e 00 00       	call   80528a <__umoddi3>
+  8003a8:	83 c4 14             	add    $0x14,%esp
+  8003ab:	0f be 80 d7 54 80 00 	movsbl 0x8054d7(%eax),%eax
+  8003b2:	50                   	push   %eax
+  8003b3:	ff d7                	call   *%edi
+}
+  8003b5:	83 c4 10             	add    $0x10,%esp
+  8003b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003bb:	5b                   	pop    %ebx
+  8003bc:	5e                   	pop    %esi
+  8003bd:	5f                   	pop    %edi
+  8003be:	5d                   	pop    %ebp
+  8003bf:	c3                   	ret
+
+008003c0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003c0:	55                   	push   %ebp
+  8003c1:	89 e5                	mov    %esp,%ebp
+  8003c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003c6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003ca:	8b 10                	mov    (%eax),%edx
+  8003cc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003cf:	73 0a                	jae    8003db <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003d1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003d4:	89 08                	mov    %ecx,(%eax)
+  8003d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003d9:	88 02                	mov    %al,(%edx)
+}
+  8003db:	5d                   	pop    %ebp
+  8003dc:	c3                   	ret
+
+008003dd <printfmt>:
+{
+  8003dd:	55                   	push   %ebp
+  8003de:	89 e5                	mov    %esp,%ebp
+  8003e0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003e3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003e6:	50                   	push   %eax
+  8003e7:	ff 75 10             	push   0x10(%ebp)
+  8003ea:	ff 75 0c             	push   0xc(%ebp)
+  8003ed:	ff 75 08             	push   0x8(%ebp)
+  8003f0:	e8 05 00 00 00       	call   8003fa <vprintfmt>
+}
+  8003f5:	83 c4 10             	add    $0x10,%esp
+  8003f8:	c9                   	leave
+  8003f9:	c3                   	ret
+
+008003fa <vprintfmt>:
+{
+  8003fa:	55                   	push   %ebp
+  8003fb:	89 e5                	mov    %esp,%ebp
+  8003fd:	57                   	push   %edi
+  8003fe:	56                   	push   %esi
+  8003ff:	53                   	push   %ebx
+  800400:	83 ec 2c             	sub    $0x2c,%esp
+  800403:	8b 75 08             	mov    0x8(%ebp),%esi
+  800406:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800409:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80040c:	eb 0a                	jmp    800418 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80040e:	83 ec 08             	sub    $0x8,%esp
+  800411:	53                   	push   %ebx
+  800412:	50                   	push   %eax
+  800413:	ff d6                	call   *%esi
+  800415:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800418:	83 c7 01             	add    $0x1,%edi
+  80041b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80041f:	83 f8 25             	cmp    $0x25,%eax
+  800422:	74 0c                	je     800430 <vprintfmt+0x36>
+			if (ch == '\0')
+  800424:	85 c0                	test   %eax,%eax
+  800426:	75 e6                	jne    80040e <vprintfmt+0x14>
+}
+  800428:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80042b:	5b                   	pop    %ebx
+  80042c:	5e                   	pop    %esi
+  80042d:	5f                   	pop    %edi
+  80042e:	5d                   	pop    %ebp
+  80042f:	c3                   	ret
+		padc = ' ';
+  800430:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800434:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80043b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800442:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800449:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80044e:	8d 47 01             	lea    0x1(%edi),%eax
+  800451:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800454:	0f b6 17             	movzbl (%edi),%edx
+  800457:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80045a:	3c 55                	cmp    $0x55,%al
+  80045c:	0f 87 c5 03 00 00    	ja     800827 <vprintfmt+0x42d>
+  800462:	0f b6 c0             	movzbl %al,%eax
+  800465:	ff 24 85 60 56 80 00 	jmp    *0x805660(,%eax,4)
+  80046c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80046f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800473:	eb d9                	jmp    80044e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800475:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800478:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80047c:	eb d0                	jmp    80044e <vprintfmt+0x54>
+  80047e:	0f b6 d2             	movzbl %dl,%edx
+  800481:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800484:	b8 00 00 00 00       	mov    $0x0,%eax
+  800489:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80048c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80048f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800493:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800496:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800499:	83 f9 09             	cmp    $0x9,%ecx
+  80049c:	77 55                	ja     8004f3 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80049e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004a1:	eb e9                	jmp    80048c <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a6:	8b 00                	mov    (%eax),%eax
+  8004a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ae:	8d 40 04             	lea    0x4(%eax),%eax
+  8004b1:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004b7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004bb:	79 91                	jns    80044e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004bd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004ca:	eb 82                	jmp    80044e <vprintfmt+0x54>
+			if (width < 0)
+  8004cc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004cf:	85 d2                	test   %edx,%edx
+  8004d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d6:	0f 49 c2             	cmovns %edx,%eax
+  8004d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004dc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004df:	e9 6a ff ff ff       	jmp    80044e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004e7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004ee:	e9 5b ff ff ff       	jmp    80044e <vprintfmt+0x54>
+  8004f3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004f6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004f9:	eb bc                	jmp    8004b7 <vprintfmt+0xbd>
+			lflag++;
+  8004fb:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004fe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800501:	e9 48 ff ff ff       	jmp    80044e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800506:	8b 45 14             	mov    0x14(%ebp),%eax
+  800509:	8d 78 04             	lea    0x4(%eax),%edi
+  80050c:	83 ec 08             	sub    $0x8,%esp
+  80050f:	53                   	push   %ebx
+  800510:	ff 30                	push   (%eax)
+  800512:	ff d6                	call   *%esi
+			break;
+  800514:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800517:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80051a:	e9 63 02 00 00       	jmp    800782 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  80051f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800522:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800525:	8b 10                	mov    (%eax),%edx
+  800527:	89 d0                	mov    %edx,%eax
+  800529:	f7 d8                	neg    %eax
+  80052b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80052e:	83 f8 12             	cmp    $0x12,%eax
+  800531:	7f 23                	jg     800556 <vprintfmt+0x15c>
+  800533:	8b 14 85 c0 57 80 00 	mov    0x8057c0(,%eax,4),%edx
+  80053a:	85 d2                	test   %edx,%edx
+  80053c:	74 18                	je     800556 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80053e:	52                   	push   %edx
+  80053f:	68 1d 54 80 00       	push   $0x80541d
+  800544:	53                   	push   %ebx
+  800545:	56                   	push   %esi
+  800546:	e8 92 fe ff ff       	call   8003dd <printfmt>
+  80054b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80054e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800551:	e9 2c 02 00 00       	jmp    800782 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  800556:	50                   	push   %eax
+  800557:	68 ef 54 80 00       	push   $0x8054ef
+  80055c:	53                   	push   %ebx
+  80055d:	56                   	push   %esi
+  80055e:	e8 7a fe ff ff       	call   8003dd <printfmt>
+  800563:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800566:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800569:	e9 14 02 00 00       	jmp    800782 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80056e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800571:	83 c0 04             	add    $0x4,%eax
+  800574:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800577:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80057c:	85 c9                	test   %ecx,%ecx
+  80057e:	b8 e8 54 80 00       	mov    $0x8054e8,%eax
+  800583:	0f 45 c1             	cmovne %ecx,%eax
+  800586:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800589:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80058d:	7e 06                	jle    800595 <vprintfmt+0x19b>
+  80058f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800593:	75 0b                	jne    8005a0 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800595:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800598:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80059b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80059e:	eb 5c                	jmp    8005fc <vprintfmt+0x202>
+  8005a0:	83 ec 08             	sub    $0x8,%esp
+  8005a3:	ff 75 d0             	push   -0x30(%ebp)
+  8005a6:	ff 75 cc             	push   -0x34(%ebp)
+  8005a9:	e8 19 03 00 00       	call   8008c7 <strnlen>
+  8005ae:	89 c2                	mov    %eax,%edx
+  8005b0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005b3:	29 d0                	sub    %edx,%eax
+  8005b5:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005b8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005bc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005bf:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005c2:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c4:	eb 0e                	jmp    8005d4 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005c6:	83 ec 08             	sub    $0x8,%esp
+  8005c9:	53                   	push   %ebx
+  8005ca:	57                   	push   %edi
+  8005cb:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005ce:	83 ee 01             	sub    $0x1,%esi
+  8005d1:	83 c4 10             	add    $0x10,%esp
+  8005d4:	85 f6                	test   %esi,%esi
+  8005d6:	7f ee                	jg     8005c6 <vprintfmt+0x1cc>
+  8005d8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005db:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005de:	85 c0                	test   %eax,%eax
+  8005e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005e5:	0f 49 d0             	cmovns %eax,%edx
+  8005e8:	29 d0                	sub    %edx,%eax
+  8005ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005ed:	eb a6                	jmp    800595 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005ef:	83 ec 08             	sub    $0x8,%esp
+  8005f2:	53                   	push   %ebx
+  8005f3:	52                   	push   %edx
+  8005f4:	ff 55 08             	call   *0x8(%ebp)
+  8005f7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005fa:	89 f1                	mov    %esi,%ecx
+  8005fc:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005ff:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800603:	0f be d0             	movsbl %al,%edx
+  800606:	85 d2                	test   %edx,%edx
+  800608:	74 28                	je     800632 <vprintfmt+0x238>
+  80060a:	85 ff                	test   %edi,%edi
+  80060c:	78 05                	js     800613 <vprintfmt+0x219>
+  80060e:	83 ef 01             	sub    $0x1,%edi
+  800611:	78 30                	js     800643 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800613:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800617:	74 d6                	je     8005ef <vprintfmt+0x1f5>
+  800619:	0f be c0             	movsbl %al,%eax
+  80061c:	83 e8 20             	sub    $0x20,%eax
+  80061f:	83 f8 5e             	cmp    $0x5e,%eax
+  800622:	76 cb                	jbe    8005ef <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800624:	83 ec 08             	sub    $0x8,%esp
+  800627:	53                   	push   %ebx
+  800628:	6a 3f                	push   $0x3f
+  80062a:	ff 55 08             	call   *0x8(%ebp)
+  80062d:	83 c4 10             	add    $0x10,%esp
+  800630:	eb c8                	jmp    8005fa <vprintfmt+0x200>
+  800632:	8b 75 08             	mov    0x8(%ebp),%esi
+  800635:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800638:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80063b:	01 d0                	add    %edx,%eax
+  80063d:	29 c8                	sub    %ecx,%eax
+  80063f:	89 c7                	mov    %eax,%edi
+  800641:	eb 13                	jmp    800656 <vprintfmt+0x25c>
+  800643:	8b 75 08             	mov    0x8(%ebp),%esi
+  800646:	eb ed                	jmp    800635 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800648:	83 ec 08             	sub    $0x8,%esp
+  80064b:	53                   	push   %ebx
+  80064c:	6a 20                	push   $0x20
+  80064e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800650:	83 ef 01             	sub    $0x1,%edi
+  800653:	83 c4 10             	add    $0x10,%esp
+  800656:	85 ff                	test   %edi,%edi
+  800658:	7f ee                	jg     800648 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80065a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80065d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800660:	e9 1d 01 00 00       	jmp    800782 <vprintfmt+0x388>
+	if (lflag >= 2)
+  800665:	83 f9 01             	cmp    $0x1,%ecx
+  800668:	7f 1b                	jg     800685 <vprintfmt+0x28b>
+	else if (lflag)
+  80066a:	85 c9                	test   %ecx,%ecx
+  80066c:	74 63                	je     8006d1 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  80066e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800671:	8b 00                	mov    (%eax),%eax
+  800673:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800676:	99                   	cltd
+  800677:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80067a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067d:	8d 40 04             	lea    0x4(%eax),%eax
+  800680:	89 45 14             	mov    %eax,0x14(%ebp)
+  800683:	eb 17                	jmp    80069c <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  800685:	8b 45 14             	mov    0x14(%ebp),%eax
+  800688:	8b 50 04             	mov    0x4(%eax),%edx
+  80068b:	8b 00                	mov    (%eax),%eax
+  80068d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800690:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800693:	8b 45 14             	mov    0x14(%ebp),%eax
+  800696:	8d 40 08             	lea    0x8(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80069c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80069f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006a2:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006a7:	85 c9                	test   %ecx,%ecx
+  8006a9:	0f 89 b9 00 00 00    	jns    800768 <vprintfmt+0x36e>
+				putch('-', putdat);
+  8006af:	83 ec 08             	sub    $0x8,%esp
+  8006b2:	53                   	push   %ebx
+  8006b3:	6a 2d                	push   $0x2d
+  8006b5:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006b7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006ba:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006bd:	f7 da                	neg    %edx
+  8006bf:	83 d1 00             	adc    $0x0,%ecx
+  8006c2:	f7 d9                	neg    %ecx
+  8006c4:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006c7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006cc:	e9 97 00 00 00       	jmp    800768 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8006d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d4:	8b 00                	mov    (%eax),%eax
+  8006d6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006d9:	99                   	cltd
+  8006da:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e6:	eb b4                	jmp    80069c <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8006e8:	83 f9 01             	cmp    $0x1,%ecx
+  8006eb:	7f 1b                	jg     800708 <vprintfmt+0x30e>
+	else if (lflag)
+  8006ed:	85 c9                	test   %ecx,%ecx
+  8006ef:	74 2c                	je     80071d <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8006f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f4:	8b 10                	mov    (%eax),%edx
+  8006f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800701:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800706:	eb 60                	jmp    800768 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800708:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070b:	8b 10                	mov    (%eax),%edx
+  80070d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800710:	8d 40 08             	lea    0x8(%eax),%eax
+  800713:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800716:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80071b:	eb 4b                	jmp    800768 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80071d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800720:	8b 10                	mov    (%eax),%edx
+  800722:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800727:	8d 40 04             	lea    0x4(%eax),%eax
+  80072a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80072d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800732:	eb 34                	jmp    800768 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800734:	83 f9 01             	cmp    $0x1,%ecx
+  800737:	7f 15                	jg     80074e <vprintfmt+0x354>
+	else if (lflag)
+  800739:	85 c9                	test   %ecx,%ecx
+  80073b:	74 4d                	je     80078a <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  80073d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800740:	8b 00                	mov    (%eax),%eax
+  800742:	99                   	cltd
+  800743:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800746:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800749:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80074c:	eb 11                	jmp    80075f <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  80074e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800751:	8b 50 04             	mov    0x4(%eax),%edx
+  800754:	8b 00                	mov    (%eax),%eax
+  800756:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800759:	8d 49 08             	lea    0x8(%ecx),%ecx
+  80075c:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  80075f:	89 d1                	mov    %edx,%ecx
+  800761:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800763:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800768:	83 ec 0c             	sub    $0xc,%esp
+  80076b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80076f:	50                   	push   %eax
+  800770:	ff 75 e0             	push   -0x20(%ebp)
+  800773:	57                   	push   %edi
+  800774:	51                   	push   %ecx
+  800775:	52                   	push   %edx
+  800776:	89 da                	mov    %ebx,%edx
+  800778:	89 f0                	mov    %esi,%eax
+  80077a:	e8 98 fb ff ff       	call   800317 <printnum>
+			break;
+  80077f:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800782:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800785:	e9 8e fc ff ff       	jmp    800418 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  80078a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078d:	8b 00                	mov    (%eax),%eax
+  80078f:	99                   	cltd
+  800790:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800793:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800796:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800799:	eb c4                	jmp    80075f <vprintfmt+0x365>
+			putch('0', putdat);
+  80079b:	83 ec 08             	sub    $0x8,%esp
+  80079e:	53                   	push   %ebx
+  80079f:	6a 30                	push   $0x30
+  8007a1:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007a3:	83 c4 08             	add    $0x8,%esp
+  8007a6:	53                   	push   %ebx
+  8007a7:	6a 78                	push   $0x78
+  8007a9:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ae:	8b 10                	mov    (%eax),%edx
+  8007b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007b5:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007bb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007be:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8007c3:	eb a3                	jmp    800768 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8007c5:	83 f9 01             	cmp    $0x1,%ecx
+  8007c8:	7f 1b                	jg     8007e5 <vprintfmt+0x3eb>
+	else if (lflag)
+  8007ca:	85 c9                	test   %ecx,%ecx
+  8007cc:	74 2f                	je     8007fd <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8007ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d1:	8b 10                	mov    (%eax),%edx
+  8007d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007de:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007e3:	eb 83                	jmp    800768 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8007e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e8:	8b 10                	mov    (%eax),%edx
+  8007ea:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007ed:	8d 40 08             	lea    0x8(%eax),%eax
+  8007f0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007f8:	e9 6b ff ff ff       	jmp    800768 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8007fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800800:	8b 10                	mov    (%eax),%edx
+  800802:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800807:	8d 40 04             	lea    0x4(%eax),%eax
+  80080a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80080d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800812:	e9 51 ff ff ff       	jmp    800768 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800817:	83 ec 08             	sub    $0x8,%esp
+  80081a:	53                   	push   %ebx
+  80081b:	6a 25                	push   $0x25
+  80081d:	ff d6                	call   *%esi
+			break;
+  80081f:	83 c4 10             	add    $0x10,%esp
+  800822:	e9 5b ff ff ff       	jmp    800782 <vprintfmt+0x388>
+			putch('%', putdat);
+  800827:	83 ec 08             	sub    $0x8,%esp
+  80082a:	53                   	push   %ebx
+  80082b:	6a 25                	push   $0x25
+  80082d:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80082f:	83 c4 10             	add    $0x10,%esp
+  800832:	89 f8                	mov    %edi,%eax
+  800834:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800838:	74 05                	je     80083f <vprintfmt+0x445>
+  80083a:	83 e8 01             	sub    $0x1,%eax
+  80083d:	eb f5                	jmp    800834 <vprintfmt+0x43a>
+  80083f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800842:	e9 3b ff ff ff       	jmp    800782 <vprintfmt+0x388>
+
+00800847 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800847:	55                   	push   %ebp
+  800848:	89 e5                	mov    %esp,%ebp
+  80084a:	83 ec 18             	sub    $0x18,%esp
+  80084d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800850:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800853:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800856:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80085a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80085d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800864:	85 c0                	test   %eax,%eax
+  800866:	74 26                	je     80088e <vsnprintf+0x47>
+  800868:	85 d2                	test   %edx,%edx
+  80086a:	7e 22                	jle    80088e <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80086c:	ff 75 14             	push   0x14(%ebp)
+  80086f:	ff 75 10             	push   0x10(%ebp)
+  800872:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800875:	50                   	push   %eax
+  800876:	68 c0 03 80 00       	push   $0x8003c0
+  80087b:	e8 7a fb ff ff       	call   8003fa <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800880:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800883:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800886:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800889:	83 c4 10             	add    $0x10,%esp
+}
+  80088c:	c9                   	leave
+  80088d:	c3                   	ret
+		return -E_INVAL;
+  80088e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800893:	eb f7                	jmp    80088c <vsnprintf+0x45>
+
+00800895 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800895:	55                   	push   %ebp
+  800896:	89 e5                	mov    %esp,%ebp
+  800898:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80089b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80089e:	50                   	push   %eax
+  80089f:	ff 75 10             	push   0x10(%ebp)
+  8008a2:	ff 75 0c             	push   0xc(%ebp)
+  8008a5:	ff 75 08             	push   0x8(%ebp)
+  8008a8:	e8 9a ff ff ff       	call   800847 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008ad:	c9                   	leave
+  8008ae:	c3                   	ret
+
+008008af <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008af:	55                   	push   %ebp
+  8008b0:	89 e5                	mov    %esp,%ebp
+  8008b2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ba:	eb 03                	jmp    8008bf <strlen+0x10>
+		n++;
+  8008bc:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008bf:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008c3:	75 f7                	jne    8008bc <strlen+0xd>
+	return n;
+}
+  8008c5:	5d                   	pop    %ebp
+  8008c6:	c3                   	ret
+
+008008c7 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008c7:	55                   	push   %ebp
+  8008c8:	89 e5                	mov    %esp,%ebp
+  8008ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d5:	eb 03                	jmp    8008da <strnlen+0x13>
+		n++;
+  8008d7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008da:	39 d0                	cmp    %edx,%eax
+  8008dc:	74 08                	je     8008e6 <strnlen+0x1f>
+  8008de:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008e2:	75 f3                	jne    8008d7 <strnlen+0x10>
+  8008e4:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008e6:	89 d0                	mov    %edx,%eax
+  8008e8:	5d                   	pop    %ebp
+  8008e9:	c3                   	ret
+
+008008ea <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008ea:	55                   	push   %ebp
+  8008eb:	89 e5                	mov    %esp,%ebp
+  8008ed:	53                   	push   %ebx
+  8008ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008fd:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800900:	83 c0 01             	add    $0x1,%eax
+  800903:	84 d2                	test   %dl,%dl
+  800905:	75 f2                	jne    8008f9 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800907:	89 c8                	mov    %ecx,%eax
+  800909:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80090c:	c9                   	leave
+  80090d:	c3                   	ret
+
+0080090e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80090e:	55                   	push   %ebp
+  80090f:	89 e5                	mov    %esp,%ebp
+  800911:	53                   	push   %ebx
+  800912:	83 ec 10             	sub    $0x10,%esp
+  800915:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800918:	53                   	push   %ebx
+  800919:	e8 91 ff ff ff       	call   8008af <strlen>
+  80091e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800921:	ff 75 0c             	push   0xc(%ebp)
+  800924:	01 d8                	add    %ebx,%eax
+  800926:	50                   	push   %eax
+  800927:	e8 be ff ff ff       	call   8008ea <strcpy>
+	return dst;
+}
+  80092c:	89 d8                	mov    %ebx,%eax
+  80092e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800931:	c9                   	leave
+  800932:	c3                   	ret
+
+00800933 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800933:	55                   	push   %ebp
+  800934:	89 e5                	mov    %esp,%ebp
+  800936:	56                   	push   %esi
+  800937:	53                   	push   %ebx
+  800938:	8b 75 08             	mov    0x8(%ebp),%esi
+  80093b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80093e:	89 f3                	mov    %esi,%ebx
+  800940:	03 5d 10             	add    0x10(%ebp),%ebx
+  800943:	89 f0                	mov    %esi,%eax
+  800945:	eb 0f                	jmp    800956 <strncpy+0x23>
+		*dst++ = *src;
+  800947:	83 c0 01             	add    $0x1,%eax
+  80094a:	0f b6 0a             	movzbl (%edx),%ecx
+  80094d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800950:	80 f9 01             	cmp    $0x1,%cl
+  800953:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800956:	39 d8                	cmp    %ebx,%eax
+  800958:	75 ed                	jne    800947 <strncpy+0x14>
+	}
+	return ret;
+}
+  80095a:	89 f0                	mov    %esi,%eax
+  80095c:	5b                   	pop    %ebx
+  80095d:	5e                   	pop    %esi
+  80095e:	5d                   	pop    %ebp
+  80095f:	c3                   	ret
+
+00800960 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800960:	55                   	push   %ebp
+  800961:	89 e5                	mov    %esp,%ebp
+  800963:	56                   	push   %esi
+  800964:	53                   	push   %ebx
+  800965:	8b 75 08             	mov    0x8(%ebp),%esi
+  800968:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80096b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80096e:	89 f0                	mov    %esi,%eax
+  800970:	85 d2                	test   %edx,%edx
+  800972:	74 21                	je     800995 <strlcpy+0x35>
+  800974:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800978:	89 f2                	mov    %esi,%edx
+  80097a:	eb 09                	jmp    800985 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80097c:	83 c1 01             	add    $0x1,%ecx
+  80097f:	83 c2 01             	add    $0x1,%edx
+  800982:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800985:	39 c2                	cmp    %eax,%edx
+  800987:	74 09                	je     800992 <strlcpy+0x32>
+  800989:	0f b6 19             	movzbl (%ecx),%ebx
+  80098c:	84 db                	test   %bl,%bl
+  80098e:	75 ec                	jne    80097c <strlcpy+0x1c>
+  800990:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800992:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800995:	29 f0                	sub    %esi,%eax
+}
+  800997:	5b                   	pop    %ebx
+  800998:	5e                   	pop    %esi
+  800999:	5d                   	pop    %ebp
+  80099a:	c3                   	ret
+
+0080099b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80099b:	55                   	push   %ebp
+  80099c:	89 e5                	mov    %esp,%ebp
+  80099e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009a4:	eb 06                	jmp    8009ac <strcmp+0x11>
+		p++, q++;
+  8009a6:	83 c1 01             	add    $0x1,%ecx
+  8009a9:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009ac:	0f b6 01             	movzbl (%ecx),%eax
+  8009af:	84 c0                	test   %al,%al
+  8009b1:	74 04                	je     8009b7 <strcmp+0x1c>
+  8009b3:	3a 02                	cmp    (%edx),%al
+  8009b5:	74 ef                	je     8009a6 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009b7:	0f b6 c0             	movzbl %al,%eax
+  8009ba:	0f b6 12             	movzbl (%edx),%edx
+  8009bd:	29 d0                	sub    %edx,%eax
+}
+  8009bf:	5d                   	pop    %ebp
+  8009c0:	c3                   	ret
+
+008009c1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009c1:	55                   	push   %ebp
+  8009c2:	89 e5                	mov    %esp,%ebp
+  8009c4:	53                   	push   %ebx
+  8009c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009cb:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009ce:	eb 09                	jmp    8009d9 <strncmp+0x18>
+		n--, p++, q++;
+  8009d0:	83 ea 01             	sub    $0x1,%edx
+  8009d3:	83 c0 01             	add    $0x1,%eax
+  8009d6:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009d9:	85 d2                	test   %edx,%edx
+  8009db:	74 18                	je     8009f5 <strncmp+0x34>
+  8009dd:	0f b6 18             	movzbl (%eax),%ebx
+  8009e0:	84 db                	test   %bl,%bl
+  8009e2:	74 04                	je     8009e8 <strncmp+0x27>
+  8009e4:	3a 19                	cmp    (%ecx),%bl
+  8009e6:	74 e8                	je     8009d0 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009e8:	0f b6 00             	movzbl (%eax),%eax
+  8009eb:	0f b6 11             	movzbl (%ecx),%edx
+  8009ee:	29 d0                	sub    %edx,%eax
+}
+  8009f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009f3:	c9                   	leave
+  8009f4:	c3                   	ret
+		return 0;
+  8009f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009fa:	eb f4                	jmp    8009f0 <strncmp+0x2f>
+
+008009fc <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009fc:	55                   	push   %ebp
+  8009fd:	89 e5                	mov    %esp,%ebp
+  8009ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a02:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a06:	eb 03                	jmp    800a0b <strchr+0xf>
+  800a08:	83 c0 01             	add    $0x1,%eax
+  800a0b:	0f b6 10             	movzbl (%eax),%edx
+  800a0e:	84 d2                	test   %dl,%dl
+  800a10:	74 06                	je     800a18 <strchr+0x1c>
+		if (*s == c)
+  800a12:	38 ca                	cmp    %cl,%dl
+  800a14:	75 f2                	jne    800a08 <strchr+0xc>
+  800a16:	eb 05                	jmp    800a1d <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a1d:	5d                   	pop    %ebp
+  800a1e:	c3                   	ret
+
+00800a1f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a1f:	55                   	push   %ebp
+  800a20:	89 e5                	mov    %esp,%ebp
+  800a22:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a25:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a29:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a2c:	38 ca                	cmp    %cl,%dl
+  800a2e:	74 09                	je     800a39 <strfind+0x1a>
+  800a30:	84 d2                	test   %dl,%dl
+  800a32:	74 05                	je     800a39 <strfind+0x1a>
+	for (; *s; s++)
+  800a34:	83 c0 01             	add    $0x1,%eax
+  800a37:	eb f0                	jmp    800a29 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a39:	5d                   	pop    %ebp
+  800a3a:	c3                   	ret
+
+00800a3b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a3b:	55                   	push   %ebp
+  800a3c:	89 e5                	mov    %esp,%ebp
+  800a3e:	57                   	push   %edi
+  800a3f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a42:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a45:	85 c9                	test   %ecx,%ecx
+  800a47:	74 20                	je     800a69 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a49:	89 f8                	mov    %edi,%eax
+  800a4b:	09 c8                	or     %ecx,%eax
+  800a4d:	a8 03                	test   $0x3,%al
+  800a4f:	75 12                	jne    800a63 <memset+0x28>
+		c &= 0xFF;
+  800a51:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a55:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a5b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a5e:	fc                   	cld
+  800a5f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a61:	eb 06                	jmp    800a69 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a63:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a66:	fc                   	cld
+  800a67:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a69:	89 f8                	mov    %edi,%eax
+  800a6b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a6e:	c9                   	leave
+  800a6f:	c3                   	ret
+
+00800a70 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a70:	55                   	push   %ebp
+  800a71:	89 e5                	mov    %esp,%ebp
+  800a73:	57                   	push   %edi
+  800a74:	56                   	push   %esi
+  800a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a78:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a7b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a7e:	39 c6                	cmp    %eax,%esi
+  800a80:	73 32                	jae    800ab4 <memmove+0x44>
+  800a82:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a85:	39 d0                	cmp    %edx,%eax
+  800a87:	73 2b                	jae    800ab4 <memmove+0x44>
+		s += n;
+		d += n;
+  800a89:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a8c:	89 d6                	mov    %edx,%esi
+  800a8e:	09 fe                	or     %edi,%esi
+  800a90:	09 ce                	or     %ecx,%esi
+  800a92:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a98:	75 0e                	jne    800aa8 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a9a:	83 ef 04             	sub    $0x4,%edi
+  800a9d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aa0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800aa3:	fd                   	std
+  800aa4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aa6:	eb 09                	jmp    800ab1 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800aa8:	83 ef 01             	sub    $0x1,%edi
+  800aab:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800aae:	fd                   	std
+  800aaf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ab1:	fc                   	cld
+  800ab2:	eb 1a                	jmp    800ace <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ab4:	89 f2                	mov    %esi,%edx
+  800ab6:	09 c2                	or     %eax,%edx
+  800ab8:	09 ca                	or     %ecx,%edx
+  800aba:	f6 c2 03             	test   $0x3,%dl
+  800abd:	75 0a                	jne    800ac9 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800abf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ac2:	89 c7                	mov    %eax,%edi
+  800ac4:	fc                   	cld
+  800ac5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ac7:	eb 05                	jmp    800ace <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ac9:	89 c7                	mov    %eax,%edi
+  800acb:	fc                   	cld
+  800acc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ace:	5e                   	pop    %esi
+  800acf:	5f                   	pop    %edi
+  800ad0:	5d                   	pop    %ebp
+  800ad1:	c3                   	ret
+
+00800ad2 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ad2:	55                   	push   %ebp
+  800ad3:	89 e5                	mov    %esp,%ebp
+  800ad5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ad8:	ff 75 10             	push   0x10(%ebp)
+  800adb:	ff 75 0c             	push   0xc(%ebp)
+  800ade:	ff 75 08             	push   0x8(%ebp)
+  800ae1:	e8 8a ff ff ff       	call   800a70 <memmove>
+}
+  800ae6:	c9                   	leave
+  800ae7:	c3                   	ret
+
+00800ae8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ae8:	55                   	push   %ebp
+  800ae9:	89 e5                	mov    %esp,%ebp
+  800aeb:	56                   	push   %esi
+  800aec:	53                   	push   %ebx
+  800aed:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800af3:	89 c6                	mov    %eax,%esi
+  800af5:	03 75 10             	add    0x10(%ebp),%esi
+  800af8:	eb 06                	jmp    800b00 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800afa:	83 c0 01             	add    $0x1,%eax
+  800afd:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b00:	39 f0                	cmp    %esi,%eax
+  800b02:	74 14                	je     800b18 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b04:	0f b6 08             	movzbl (%eax),%ecx
+  800b07:	0f b6 1a             	movzbl (%edx),%ebx
+  800b0a:	38 d9                	cmp    %bl,%cl
+  800b0c:	74 ec                	je     800afa <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b0e:	0f b6 c1             	movzbl %cl,%eax
+  800b11:	0f b6 db             	movzbl %bl,%ebx
+  800b14:	29 d8                	sub    %ebx,%eax
+  800b16:	eb 05                	jmp    800b1d <memcmp+0x35>
+	}
+
+	return 0;
+  800b18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b1d:	5b                   	pop    %ebx
+  800b1e:	5e                   	pop    %esi
+  800b1f:	5d                   	pop    %ebp
+  800b20:	c3                   	ret
+
+00800b21 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b21:	55                   	push   %ebp
+  800b22:	89 e5                	mov    %esp,%ebp
+  800b24:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b2a:	89 c2                	mov    %eax,%edx
+  800b2c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b2f:	eb 03                	jmp    800b34 <memfind+0x13>
+  800b31:	83 c0 01             	add    $0x1,%eax
+  800b34:	39 d0                	cmp    %edx,%eax
+  800b36:	73 04                	jae    800b3c <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b38:	38 08                	cmp    %cl,(%eax)
+  800b3a:	75 f5                	jne    800b31 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b3c:	5d                   	pop    %ebp
+  800b3d:	c3                   	ret
+
+00800b3e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b3e:	55                   	push   %ebp
+  800b3f:	89 e5                	mov    %esp,%ebp
+  800b41:	57                   	push   %edi
+  800b42:	56                   	push   %esi
+  800b43:	53                   	push   %ebx
+  800b44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b47:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b4a:	eb 03                	jmp    800b4f <strtol+0x11>
+		s++;
+  800b4c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b4f:	0f b6 02             	movzbl (%edx),%eax
+  800b52:	3c 20                	cmp    $0x20,%al
+  800b54:	74 f6                	je     800b4c <strtol+0xe>
+  800b56:	3c 09                	cmp    $0x9,%al
+  800b58:	74 f2                	je     800b4c <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b5a:	3c 2b                	cmp    $0x2b,%al
+  800b5c:	74 2a                	je     800b88 <strtol+0x4a>
+	int neg = 0;
+  800b5e:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b63:	3c 2d                	cmp    $0x2d,%al
+  800b65:	74 2b                	je     800b92 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b67:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b6d:	75 0f                	jne    800b7e <strtol+0x40>
+  800b6f:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b72:	74 28                	je     800b9c <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b74:	85 db                	test   %ebx,%ebx
+  800b76:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b7b:	0f 44 d8             	cmove  %eax,%ebx
+  800b7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b83:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b86:	eb 46                	jmp    800bce <strtol+0x90>
+		s++;
+  800b88:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b90:	eb d5                	jmp    800b67 <strtol+0x29>
+		s++, neg = 1;
+  800b92:	83 c2 01             	add    $0x1,%edx
+  800b95:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b9a:	eb cb                	jmp    800b67 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b9c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ba0:	74 0e                	je     800bb0 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ba2:	85 db                	test   %ebx,%ebx
+  800ba4:	75 d8                	jne    800b7e <strtol+0x40>
+		s++, base = 8;
+  800ba6:	83 c2 01             	add    $0x1,%edx
+  800ba9:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bae:	eb ce                	jmp    800b7e <strtol+0x40>
+		s += 2, base = 16;
+  800bb0:	83 c2 02             	add    $0x2,%edx
+  800bb3:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bb8:	eb c4                	jmp    800b7e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bba:	0f be c0             	movsbl %al,%eax
+  800bbd:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bc0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bc3:	7d 3a                	jge    800bff <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bc5:	83 c2 01             	add    $0x1,%edx
+  800bc8:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bcc:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bce:	0f b6 02             	movzbl (%edx),%eax
+  800bd1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bd4:	89 f3                	mov    %esi,%ebx
+  800bd6:	80 fb 09             	cmp    $0x9,%bl
+  800bd9:	76 df                	jbe    800bba <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bdb:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bde:	89 f3                	mov    %esi,%ebx
+  800be0:	80 fb 19             	cmp    $0x19,%bl
+  800be3:	77 08                	ja     800bed <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800be5:	0f be c0             	movsbl %al,%eax
+  800be8:	83 e8 57             	sub    $0x57,%eax
+  800beb:	eb d3                	jmp    800bc0 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bed:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bf0:	89 f3                	mov    %esi,%ebx
+  800bf2:	80 fb 19             	cmp    $0x19,%bl
+  800bf5:	77 08                	ja     800bff <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bf7:	0f be c0             	movsbl %al,%eax
+  800bfa:	83 e8 37             	sub    $0x37,%eax
+  800bfd:	eb c1                	jmp    800bc0 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bff:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c03:	74 05                	je     800c0a <strtol+0xcc>
+		*endptr = (char *) s;
+  800c05:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c08:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c0a:	89 c8                	mov    %ecx,%eax
+  800c0c:	f7 d8                	neg    %eax
+  800c0e:	85 ff                	test   %edi,%edi
+  800c10:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c13:	89 c8                	mov    %ecx,%eax
+  800c15:	5b                   	pop    %ebx
+  800c16:	5e                   	pop    %esi
+  800c17:	5f                   	pop    %edi
+  800c18:	5d                   	pop    %ebp
+  800c19:	c3                   	ret
+
+00800c1a <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800c1a:	55                   	push   %ebp
+  800c1b:	89 e5                	mov    %esp,%ebp
+  800c1d:	57                   	push   %edi
+  800c1e:	56                   	push   %esi
+  800c1f:	53                   	push   %ebx
+  800c20:	83 ec 0c             	sub    $0xc,%esp
+  800c23:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800c26:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c29:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800c2c:	85 ff                	test   %edi,%edi
+  800c2e:	74 16                	je     800c46 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800c30:	83 ec 04             	sub    $0x4,%esp
+  800c33:	56                   	push   %esi
+  800c34:	6a 00                	push   $0x0
+  800c36:	53                   	push   %ebx
+  800c37:	e8 02 ff ff ff       	call   800b3e <strtol>
+  800c3c:	89 07                	mov    %eax,(%edi)
+  800c3e:	83 c4 10             	add    $0x10,%esp
+  800c41:	eb 03                	jmp    800c46 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800c43:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800c46:	0f b6 03             	movzbl (%ebx),%eax
+  800c49:	3c 20                	cmp    $0x20,%al
+  800c4b:	74 f6                	je     800c43 <strisl+0x29>
+  800c4d:	3c 09                	cmp    $0x9,%al
+  800c4f:	74 f2                	je     800c43 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c51:	3c 2b                	cmp    $0x2b,%al
+  800c53:	74 23                	je     800c78 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800c55:	3c 2d                	cmp    $0x2d,%al
+  800c57:	0f 94 c0             	sete   %al
+  800c5a:	0f b6 c0             	movzbl %al,%eax
+  800c5d:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c5f:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800c65:	75 41                	jne    800ca8 <strisl+0x8e>
+  800c67:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800c6a:	74 11                	je     800c7d <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c6c:	85 f6                	test   %esi,%esi
+  800c6e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c73:	0f 44 f0             	cmove  %eax,%esi
+  800c76:	eb 30                	jmp    800ca8 <strisl+0x8e>
+		s++;
+  800c78:	83 c3 01             	add    $0x1,%ebx
+  800c7b:	eb e2                	jmp    800c5f <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c7d:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800c81:	74 0e                	je     800c91 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800c83:	85 f6                	test   %esi,%esi
+  800c85:	75 21                	jne    800ca8 <strisl+0x8e>
+		s++, base = 8;
+  800c87:	83 c3 01             	add    $0x1,%ebx
+  800c8a:	be 08 00 00 00       	mov    $0x8,%esi
+  800c8f:	eb 17                	jmp    800ca8 <strisl+0x8e>
+		s += 2, base = 16;
+  800c91:	83 c3 02             	add    $0x2,%ebx
+  800c94:	be 10 00 00 00       	mov    $0x10,%esi
+  800c99:	eb 0d                	jmp    800ca8 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c9b:	0f be c0             	movsbl %al,%eax
+  800c9e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800ca1:	39 f0                	cmp    %esi,%eax
+  800ca3:	7d 38                	jge    800cdd <strisl+0xc3>
+			return 0;
+		s++;
+  800ca5:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800ca8:	0f b6 03             	movzbl (%ebx),%eax
+  800cab:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800cae:	80 fa 09             	cmp    $0x9,%dl
+  800cb1:	76 e8                	jbe    800c9b <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800cb3:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800cb6:	80 fa 19             	cmp    $0x19,%dl
+  800cb9:	77 08                	ja     800cc3 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800cbb:	0f be c0             	movsbl %al,%eax
+  800cbe:	83 e8 57             	sub    $0x57,%eax
+  800cc1:	eb de                	jmp    800ca1 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cc3:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800cc6:	80 fa 19             	cmp    $0x19,%dl
+  800cc9:	77 08                	ja     800cd3 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800ccb:	0f be c0             	movsbl %al,%eax
+  800cce:	83 e8 37             	sub    $0x37,%eax
+  800cd1:	eb ce                	jmp    800ca1 <strisl+0x87>
+		else if (!*s)
+  800cd3:	84 c0                	test   %al,%al
+  800cd5:	0f 94 c0             	sete   %al
+  800cd8:	0f b6 c0             	movzbl %al,%eax
+  800cdb:	eb 05                	jmp    800ce2 <strisl+0xc8>
+			return 0;
+  800cdd:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800ce2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ce5:	5b                   	pop    %ebx
+  800ce6:	5e                   	pop    %esi
+  800ce7:	5f                   	pop    %edi
+  800ce8:	5d                   	pop    %ebp
+  800ce9:	c3                   	ret
+
+00800cea <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800cea:	55                   	push   %ebp
+  800ceb:	89 e5                	mov    %esp,%ebp
+  800ced:	83 ec 10             	sub    $0x10,%esp
+  800cf0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800cf3:	89 c8                	mov    %ecx,%eax
+  800cf5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800cfa:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800cfd:	eb 0b                	jmp    800d0a <touch_mem+0x20>
+		c = *(char *)page;
+  800cff:	0f b6 10             	movzbl (%eax),%edx
+  800d02:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800d05:	05 00 10 00 00       	add    $0x1000,%eax
+  800d0a:	39 c8                	cmp    %ecx,%eax
+  800d0c:	72 f1                	jb     800cff <touch_mem+0x15>
+}
+  800d0e:	c9                   	leave
+  800d0f:	c3                   	ret
+
+00800d10 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d10:	55                   	push   %ebp
+  800d11:	89 e5                	mov    %esp,%ebp
+  800d13:	57                   	push   %edi
+  800d14:	56                   	push   %esi
+  800d15:	53                   	push   %ebx
+	touch_mem(s, len);
+  800d16:	ff 75 0c             	push   0xc(%ebp)
+  800d19:	ff 75 08             	push   0x8(%ebp)
+  800d1c:	e8 c9 ff ff ff       	call   800cea <touch_mem>
+	asm volatile("int %1\n"
+  800d21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d29:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2c:	89 c3                	mov    %eax,%ebx
+  800d2e:	89 c7                	mov    %eax,%edi
+  800d30:	89 c6                	mov    %eax,%esi
+  800d32:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d34:	83 c4 08             	add    $0x8,%esp
+  800d37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3a:	5b                   	pop    %ebx
+  800d3b:	5e                   	pop    %esi
+  800d3c:	5f                   	pop    %edi
+  800d3d:	5d                   	pop    %ebp
+  800d3e:	c3                   	ret
+
+00800d3f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d3f:	55                   	push   %ebp
+  800d40:	89 e5                	mov    %esp,%ebp
+  800d42:	57                   	push   %edi
+  800d43:	56                   	push   %esi
+  800d44:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d4f:	89 d1                	mov    %edx,%ecx
+  800d51:	89 d3                	mov    %edx,%ebx
+  800d53:	89 d7                	mov    %edx,%edi
+  800d55:	89 d6                	mov    %edx,%esi
+  800d57:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d59:	5b                   	pop    %ebx
+  800d5a:	5e                   	pop    %esi
+  800d5b:	5f                   	pop    %edi
+  800d5c:	5d                   	pop    %ebp
+  800d5d:	c3                   	ret
+
+00800d5e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d5e:	55                   	push   %ebp
+  800d5f:	89 e5                	mov    %esp,%ebp
+  800d61:	57                   	push   %edi
+  800d62:	56                   	push   %esi
+  800d63:	53                   	push   %ebx
+  800d64:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d74:	89 cb                	mov    %ecx,%ebx
+  800d76:	89 cf                	mov    %ecx,%edi
+  800d78:	89 ce                	mov    %ecx,%esi
+  800d7a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d7c:	85 c0                	test   %eax,%eax
+  800d7e:	7f 08                	jg     800d88 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d83:	5b                   	pop    %ebx
+  800d84:	5e                   	pop    %esi
+  800d85:	5f                   	pop    %edi
+  800d86:	5d                   	pop    %ebp
+  800d87:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d88:	83 ec 0c             	sub    $0xc,%esp
+  800d8b:	50                   	push   %eax
+  800d8c:	6a 03                	push   $0x3
+  800d8e:	68 2b 58 80 00       	push   $0x80582b
+  800d93:	6a 23                	push   $0x23
+  800d95:	68 48 58 80 00       	push   $0x805848
+  800d9a:	e8 89 f4 ff ff       	call   800228 <_panic>
+
+00800d9f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d9f:	55                   	push   %ebp
+  800da0:	89 e5                	mov    %esp,%ebp
+  800da2:	57                   	push   %edi
+  800da3:	56                   	push   %esi
+  800da4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800da5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800daa:	b8 02 00 00 00       	mov    $0x2,%eax
+  800daf:	89 d1                	mov    %edx,%ecx
+  800db1:	89 d3                	mov    %edx,%ebx
+  800db3:	89 d7                	mov    %edx,%edi
+  800db5:	89 d6                	mov    %edx,%esi
+  800db7:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800db9:	5b                   	pop    %ebx
+  800dba:	5e                   	pop    %esi
+  800dbb:	5f                   	pop    %edi
+  800dbc:	5d                   	pop    %ebp
+  800dbd:	c3                   	ret
+
+00800dbe <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dbe:	55                   	push   %ebp
+  800dbf:	89 e5                	mov    %esp,%ebp
+  800dc1:	57                   	push   %edi
+  800dc2:	56                   	push   %esi
+  800dc3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dce:	89 d1                	mov    %edx,%ecx
+  800dd0:	89 d3                	mov    %edx,%ebx
+  800dd2:	89 d7                	mov    %edx,%edi
+  800dd4:	89 d6                	mov    %edx,%esi
+  800dd6:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800dd8:	5b                   	pop    %ebx
+  800dd9:	5e                   	pop    %esi
+  800dda:	5f                   	pop    %edi
+  800ddb:	5d                   	pop    %ebp
+  800ddc:	c3                   	ret
+
+00800ddd <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ddd:	55                   	push   %ebp
+  800dde:	89 e5                	mov    %esp,%ebp
+  800de0:	57                   	push   %edi
+  800de1:	56                   	push   %esi
+  800de2:	53                   	push   %ebx
+  800de3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800de6:	be 00 00 00 00       	mov    $0x0,%esi
+  800deb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800df6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df9:	89 f7                	mov    %esi,%edi
+  800dfb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dfd:	85 c0                	test   %eax,%eax
+  800dff:	7f 08                	jg     800e09 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e04:	5b                   	pop    %ebx
+  800e05:	5e                   	pop    %esi
+  800e06:	5f                   	pop    %edi
+  800e07:	5d                   	pop    %ebp
+  800e08:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e09:	83 ec 0c             	sub    $0xc,%esp
+  800e0c:	50                   	push   %eax
+  800e0d:	6a 04                	push   $0x4
+  800e0f:	68 2b 58 80 00       	push   $0x80582b
+  800e14:	6a 23                	push   $0x23
+  800e16:	68 48 58 80 00       	push   $0x805848
+  800e1b:	e8 08 f4 ff ff       	call   800228 <_panic>
+
+00800e20 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e20:	55                   	push   %ebp
+  800e21:	89 e5                	mov    %esp,%ebp
+  800e23:	57                   	push   %edi
+  800e24:	56                   	push   %esi
+  800e25:	53                   	push   %ebx
+  800e26:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e34:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e37:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e3a:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e3d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e3f:	85 c0                	test   %eax,%eax
+  800e41:	7f 08                	jg     800e4b <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e46:	5b                   	pop    %ebx
+  800e47:	5e                   	pop    %esi
+  800e48:	5f                   	pop    %edi
+  800e49:	5d                   	pop    %ebp
+  800e4a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e4b:	83 ec 0c             	sub    $0xc,%esp
+  800e4e:	50                   	push   %eax
+  800e4f:	6a 05                	push   $0x5
+  800e51:	68 2b 58 80 00       	push   $0x80582b
+  800e56:	6a 23                	push   $0x23
+  800e58:	68 48 58 80 00       	push   $0x805848
+  800e5d:	e8 c6 f3 ff ff       	call   800228 <_panic>
+
+00800e62 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e62:	55                   	push   %ebp
+  800e63:	89 e5                	mov    %esp,%ebp
+  800e65:	57                   	push   %edi
+  800e66:	56                   	push   %esi
+  800e67:	53                   	push   %ebx
+  800e68:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e76:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e7b:	89 df                	mov    %ebx,%edi
+  800e7d:	89 de                	mov    %ebx,%esi
+  800e7f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e81:	85 c0                	test   %eax,%eax
+  800e83:	7f 08                	jg     800e8d <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e88:	5b                   	pop    %ebx
+  800e89:	5e                   	pop    %esi
+  800e8a:	5f                   	pop    %edi
+  800e8b:	5d                   	pop    %ebp
+  800e8c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8d:	83 ec 0c             	sub    $0xc,%esp
+  800e90:	50                   	push   %eax
+  800e91:	6a 06                	push   $0x6
+  800e93:	68 2b 58 80 00       	push   $0x80582b
+  800e98:	6a 23                	push   $0x23
+  800e9a:	68 48 58 80 00       	push   $0x805848
+  800e9f:	e8 84 f3 ff ff       	call   800228 <_panic>
+
+00800ea4 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800ea4:	55                   	push   %ebp
+  800ea5:	89 e5                	mov    %esp,%ebp
+  800ea7:	57                   	push   %edi
+  800ea8:	56                   	push   %esi
+  800ea9:	53                   	push   %ebx
+  800eaa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ead:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb8:	b8 18 00 00 00       	mov    $0x18,%eax
+  800ebd:	89 df                	mov    %ebx,%edi
+  800ebf:	89 de                	mov    %ebx,%esi
+  800ec1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec3:	85 c0                	test   %eax,%eax
+  800ec5:	7f 08                	jg     800ecf <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ec7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eca:	5b                   	pop    %ebx
+  800ecb:	5e                   	pop    %esi
+  800ecc:	5f                   	pop    %edi
+  800ecd:	5d                   	pop    %ebp
+  800ece:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ecf:	83 ec 0c             	sub    $0xc,%esp
+  800ed2:	50                   	push   %eax
+  800ed3:	6a 18                	push   $0x18
+  800ed5:	68 2b 58 80 00       	push   $0x80582b
+  800eda:	6a 23                	push   $0x23
+  800edc:	68 48 58 80 00       	push   $0x805848
+  800ee1:	e8 42 f3 ff ff       	call   800228 <_panic>
+
+00800ee6 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800ee6:	55                   	push   %ebp
+  800ee7:	89 e5                	mov    %esp,%ebp
+  800ee9:	57                   	push   %edi
+  800eea:	56                   	push   %esi
+  800eeb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eec:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef7:	b8 19 00 00 00       	mov    $0x19,%eax
+  800efc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eff:	89 f7                	mov    %esi,%edi
+  800f01:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800f03:	5b                   	pop    %ebx
+  800f04:	5e                   	pop    %esi
+  800f05:	5f                   	pop    %edi
+  800f06:	5d                   	pop    %ebp
+  800f07:	c3                   	ret
+
+00800f08 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800f08:	55                   	push   %ebp
+  800f09:	89 e5                	mov    %esp,%ebp
+  800f0b:	57                   	push   %edi
+  800f0c:	56                   	push   %esi
+  800f0d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f14:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f19:	be 00 00 00 00       	mov    $0x0,%esi
+  800f1e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f21:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f24:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800f26:	5b                   	pop    %ebx
+  800f27:	5e                   	pop    %esi
+  800f28:	5f                   	pop    %edi
+  800f29:	5d                   	pop    %ebp
+  800f2a:	c3                   	ret
+
+00800f2b <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	57                   	push   %edi
+  800f2f:	56                   	push   %esi
+  800f30:	53                   	push   %ebx
+  800f31:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800f34:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800f37:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800f3d:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800f40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f46:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f4b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f4e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f51:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f53:	85 c0                	test   %eax,%eax
+  800f55:	7f 08                	jg     800f5f <sys_page_map_range+0x34>
+}
+  800f57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5a:	5b                   	pop    %ebx
+  800f5b:	5e                   	pop    %esi
+  800f5c:	5f                   	pop    %edi
+  800f5d:	5d                   	pop    %ebp
+  800f5e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5f:	83 ec 0c             	sub    $0xc,%esp
+  800f62:	50                   	push   %eax
+  800f63:	6a 10                	push   $0x10
+  800f65:	68 2b 58 80 00       	push   $0x80582b
+  800f6a:	6a 23                	push   $0x23
+  800f6c:	68 48 58 80 00       	push   $0x805848
+  800f71:	e8 b2 f2 ff ff       	call   800228 <_panic>
+
+00800f76 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f76:	55                   	push   %ebp
+  800f77:	89 e5                	mov    %esp,%ebp
+  800f79:	57                   	push   %edi
+  800f7a:	56                   	push   %esi
+  800f7b:	53                   	push   %ebx
+  800f7c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f7f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8a:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f8f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f92:	89 f7                	mov    %esi,%edi
+  800f94:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f96:	85 c0                	test   %eax,%eax
+  800f98:	7f 08                	jg     800fa2 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9d:	5b                   	pop    %ebx
+  800f9e:	5e                   	pop    %esi
+  800f9f:	5f                   	pop    %edi
+  800fa0:	5d                   	pop    %ebp
+  800fa1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa2:	83 ec 0c             	sub    $0xc,%esp
+  800fa5:	50                   	push   %eax
+  800fa6:	6a 11                	push   $0x11
+  800fa8:	68 2b 58 80 00       	push   $0x80582b
+  800fad:	6a 23                	push   $0x23
+  800faf:	68 48 58 80 00       	push   $0x805848
+  800fb4:	e8 6f f2 ff ff       	call   800228 <_panic>
+
+00800fb9 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800fb9:	55                   	push   %ebp
+  800fba:	89 e5                	mov    %esp,%ebp
+  800fbc:	57                   	push   %edi
+  800fbd:	56                   	push   %esi
+  800fbe:	53                   	push   %ebx
+  800fbf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fc2:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800fd2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd5:	89 f7                	mov    %esi,%edi
+  800fd7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd9:	85 c0                	test   %eax,%eax
+  800fdb:	7f 08                	jg     800fe5 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800fdd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe0:	5b                   	pop    %ebx
+  800fe1:	5e                   	pop    %esi
+  800fe2:	5f                   	pop    %edi
+  800fe3:	5d                   	pop    %ebp
+  800fe4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe5:	83 ec 0c             	sub    $0xc,%esp
+  800fe8:	50                   	push   %eax
+  800fe9:	6a 1b                	push   $0x1b
+  800feb:	68 2b 58 80 00       	push   $0x80582b
+  800ff0:	6a 23                	push   $0x23
+  800ff2:	68 48 58 80 00       	push   $0x805848
+  800ff7:	e8 2c f2 ff ff       	call   800228 <_panic>
+
+00800ffc <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800ffc:	55                   	push   %ebp
+  800ffd:	89 e5                	mov    %esp,%ebp
+  800fff:	57                   	push   %edi
+  801000:	56                   	push   %esi
+  801001:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801002:	ba 00 00 00 00       	mov    $0x0,%edx
+  801007:	b8 12 00 00 00       	mov    $0x12,%eax
+  80100c:	89 d1                	mov    %edx,%ecx
+  80100e:	89 d3                	mov    %edx,%ebx
+  801010:	89 d7                	mov    %edx,%edi
+  801012:	89 d6                	mov    %edx,%esi
+  801014:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801016:	5b                   	pop    %ebx
+  801017:	5e                   	pop    %esi
+  801018:	5f                   	pop    %edi
+  801019:	5d                   	pop    %ebp
+  80101a:	c3                   	ret
+
+0080101b <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	57                   	push   %edi
+  80101f:	56                   	push   %esi
+  801020:	53                   	push   %ebx
+  801021:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801024:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801029:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801034:	89 df                	mov    %ebx,%edi
+  801036:	89 de                	mov    %ebx,%esi
+  801038:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80103a:	85 c0                	test   %eax,%eax
+  80103c:	7f 08                	jg     801046 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80103e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801041:	5b                   	pop    %ebx
+  801042:	5e                   	pop    %esi
+  801043:	5f                   	pop    %edi
+  801044:	5d                   	pop    %ebp
+  801045:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801046:	83 ec 0c             	sub    $0xc,%esp
+  801049:	50                   	push   %eax
+  80104a:	6a 08                	push   $0x8
+  80104c:	68 2b 58 80 00       	push   $0x80582b
+  801051:	6a 23                	push   $0x23
+  801053:	68 48 58 80 00       	push   $0x805848
+  801058:	e8 cb f1 ff ff       	call   800228 <_panic>
+
+0080105d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80105d:	55                   	push   %ebp
+  80105e:	89 e5                	mov    %esp,%ebp
+  801060:	57                   	push   %edi
+  801061:	56                   	push   %esi
+  801062:	53                   	push   %ebx
+  801063:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  801066:	6a 44                	push   $0x44
+  801068:	ff 75 0c             	push   0xc(%ebp)
+  80106b:	e8 7a fc ff ff       	call   800cea <touch_mem>
+	asm volatile("int %1\n"
+  801070:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801075:	8b 55 08             	mov    0x8(%ebp),%edx
+  801078:	b8 09 00 00 00       	mov    $0x9,%eax
+  80107d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801080:	89 df                	mov    %ebx,%edi
+  801082:	89 de                	mov    %ebx,%esi
+  801084:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801086:	83 c4 08             	add    $0x8,%esp
+  801089:	85 c0                	test   %eax,%eax
+  80108b:	7f 08                	jg     801095 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80108d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801090:	5b                   	pop    %ebx
+  801091:	5e                   	pop    %esi
+  801092:	5f                   	pop    %edi
+  801093:	5d                   	pop    %ebp
+  801094:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801095:	83 ec 0c             	sub    $0xc,%esp
+  801098:	50                   	push   %eax
+  801099:	6a 09                	push   $0x9
+  80109b:	68 2b 58 80 00       	push   $0x80582b
+  8010a0:	6a 23                	push   $0x23
+  8010a2:	68 48 58 80 00       	push   $0x805848
+  8010a7:	e8 7c f1 ff ff       	call   800228 <_panic>
+
+008010ac <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  8010ac:	55                   	push   %ebp
+  8010ad:	89 e5                	mov    %esp,%ebp
+  8010af:	57                   	push   %edi
+  8010b0:	56                   	push   %esi
+  8010b1:	53                   	push   %ebx
+  8010b2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8010c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c8:	89 f7                	mov    %esi,%edi
+  8010ca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010cc:	85 c0                	test   %eax,%eax
+  8010ce:	7f 08                	jg     8010d8 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  8010d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d3:	5b                   	pop    %ebx
+  8010d4:	5e                   	pop    %esi
+  8010d5:	5f                   	pop    %edi
+  8010d6:	5d                   	pop    %ebp
+  8010d7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d8:	83 ec 0c             	sub    $0xc,%esp
+  8010db:	50                   	push   %eax
+  8010dc:	6a 1a                	push   $0x1a
+  8010de:	68 2b 58 80 00       	push   $0x80582b
+  8010e3:	6a 23                	push   $0x23
+  8010e5:	68 48 58 80 00       	push   $0x805848
+  8010ea:	e8 39 f1 ff ff       	call   800228 <_panic>
+
+008010ef <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8010ef:	55                   	push   %ebp
+  8010f0:	89 e5                	mov    %esp,%ebp
+  8010f2:	57                   	push   %edi
+  8010f3:	56                   	push   %esi
+  8010f4:	53                   	push   %ebx
+  8010f5:	83 ec 0c             	sub    $0xc,%esp
+  8010f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8010fb:	89 d8                	mov    %ebx,%eax
+  8010fd:	c1 e0 05             	shl    $0x5,%eax
+  801100:	50                   	push   %eax
+  801101:	ff 75 0c             	push   0xc(%ebp)
+  801104:	e8 e1 fb ff ff       	call   800cea <touch_mem>
+	asm volatile("int %1\n"
+  801109:	be 00 00 00 00       	mov    $0x0,%esi
+  80110e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801111:	b8 13 00 00 00       	mov    $0x13,%eax
+  801116:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801119:	89 f7                	mov    %esi,%edi
+  80111b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80111d:	83 c4 08             	add    $0x8,%esp
+  801120:	85 c0                	test   %eax,%eax
+  801122:	7f 08                	jg     80112c <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  801124:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801127:	5b                   	pop    %ebx
+  801128:	5e                   	pop    %esi
+  801129:	5f                   	pop    %edi
+  80112a:	5d                   	pop    %ebp
+  80112b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80112c:	83 ec 0c             	sub    $0xc,%esp
+  80112f:	50                   	push   %eax
+  801130:	6a 13                	push   $0x13
+  801132:	68 2b 58 80 00       	push   $0x80582b
+  801137:	6a 23                	push   $0x23
+  801139:	68 48 58 80 00       	push   $0x805848
+  80113e:	e8 e5 f0 ff ff       	call   800228 <_panic>
+
+00801143 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801143:	55                   	push   %ebp
+  801144:	89 e5                	mov    %esp,%ebp
+  801146:	57                   	push   %edi
+  801147:	56                   	push   %esi
+  801148:	53                   	push   %ebx
+  801149:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80114c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801151:	8b 55 08             	mov    0x8(%ebp),%edx
+  801154:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801157:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80115c:	89 df                	mov    %ebx,%edi
+  80115e:	89 de                	mov    %ebx,%esi
+  801160:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801162:	85 c0                	test   %eax,%eax
+  801164:	7f 08                	jg     80116e <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801166:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801169:	5b                   	pop    %ebx
+  80116a:	5e                   	pop    %esi
+  80116b:	5f                   	pop    %edi
+  80116c:	5d                   	pop    %ebp
+  80116d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80116e:	83 ec 0c             	sub    $0xc,%esp
+  801171:	50                   	push   %eax
+  801172:	6a 0a                	push   $0xa
+  801174:	68 2b 58 80 00       	push   $0x80582b
+  801179:	6a 23                	push   $0x23
+  80117b:	68 48 58 80 00       	push   $0x805848
+  801180:	e8 a3 f0 ff ff       	call   800228 <_panic>
+
+00801185 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801185:	55                   	push   %ebp
+  801186:	89 e5                	mov    %esp,%ebp
+  801188:	57                   	push   %edi
+  801189:	56                   	push   %esi
+  80118a:	53                   	push   %ebx
+  80118b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  80118e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801194:	76 1d                	jbe    8011b3 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  801196:	8b 55 08             	mov    0x8(%ebp),%edx
+  801199:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011a1:	be 01 00 00 00       	mov    $0x1,%esi
+  8011a6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011a9:	cd 30                	int    $0x30
+}
+  8011ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ae:	5b                   	pop    %ebx
+  8011af:	5e                   	pop    %esi
+  8011b0:	5f                   	pop    %edi
+  8011b1:	5d                   	pop    %ebp
+  8011b2:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011b3:	68 00 10 00 00       	push   $0x1000
+  8011b8:	53                   	push   %ebx
+  8011b9:	e8 2c fb ff ff       	call   800cea <touch_mem>
+  8011be:	83 c4 08             	add    $0x8,%esp
+  8011c1:	eb d3                	jmp    801196 <sys_ipc_send+0x11>
+
+008011c3 <sys_ipc_send_pages>:
+{
+  8011c3:	55                   	push   %ebp
+  8011c4:	89 e5                	mov    %esp,%ebp
+  8011c6:	57                   	push   %edi
+  8011c7:	56                   	push   %esi
+  8011c8:	53                   	push   %ebx
+  8011c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011cc:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8011cf:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011d5:	76 18                	jbe    8011ef <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8011d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011dd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011e2:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8011e5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8011e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ea:	5b                   	pop    %ebx
+  8011eb:	5e                   	pop    %esi
+  8011ec:	5f                   	pop    %edi
+  8011ed:	5d                   	pop    %ebp
+  8011ee:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011ef:	89 f0                	mov    %esi,%eax
+  8011f1:	c1 e0 0c             	shl    $0xc,%eax
+  8011f4:	50                   	push   %eax
+  8011f5:	53                   	push   %ebx
+  8011f6:	e8 ef fa ff ff       	call   800cea <touch_mem>
+  8011fb:	83 c4 08             	add    $0x8,%esp
+  8011fe:	eb d7                	jmp    8011d7 <sys_ipc_send_pages+0x14>
+
+00801200 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801200:	55                   	push   %ebp
+  801201:	89 e5                	mov    %esp,%ebp
+  801203:	57                   	push   %edi
+  801204:	56                   	push   %esi
+  801205:	53                   	push   %ebx
+  801206:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801209:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801211:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801214:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801219:	89 df                	mov    %ebx,%edi
+  80121b:	89 de                	mov    %ebx,%esi
+  80121d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80121f:	85 c0                	test   %eax,%eax
+  801221:	7f 08                	jg     80122b <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801223:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801226:	5b                   	pop    %ebx
+  801227:	5e                   	pop    %esi
+  801228:	5f                   	pop    %edi
+  801229:	5d                   	pop    %ebp
+  80122a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80122b:	83 ec 0c             	sub    $0xc,%esp
+  80122e:	50                   	push   %eax
+  80122f:	6a 0d                	push   $0xd
+  801231:	68 2b 58 80 00       	push   $0x80582b
+  801236:	6a 23                	push   $0x23
+  801238:	68 48 58 80 00       	push   $0x805848
+  80123d:	e8 e6 ef ff ff       	call   800228 <_panic>
+
+00801242 <sys_ipc_recv>:
+{
+  801242:	55                   	push   %ebp
+  801243:	89 e5                	mov    %esp,%ebp
+  801245:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801248:	6a 01                	push   $0x1
+  80124a:	ff 75 08             	push   0x8(%ebp)
+  80124d:	e8 ae ff ff ff       	call   801200 <sys_ipc_recv_pages>
+}
+  801252:	c9                   	leave
+  801253:	c3                   	ret
+
+00801254 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801254:	55                   	push   %ebp
+  801255:	89 e5                	mov    %esp,%ebp
+  801257:	57                   	push   %edi
+  801258:	56                   	push   %esi
+  801259:	53                   	push   %ebx
+  80125a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80125d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801260:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801263:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801269:	77 04                	ja     80126f <sys_ipc_call+0x1b>
+  80126b:	85 f6                	test   %esi,%esi
+  80126d:	75 15                	jne    801284 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  80126f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801272:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801275:	b8 14 00 00 00       	mov    $0x14,%eax
+  80127a:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80127c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80127f:	5b                   	pop    %ebx
+  801280:	5e                   	pop    %esi
+  801281:	5f                   	pop    %edi
+  801282:	5d                   	pop    %ebp
+  801283:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  801284:	89 f8                	mov    %edi,%eax
+  801286:	c1 e0 0c             	shl    $0xc,%eax
+  801289:	50                   	push   %eax
+  80128a:	53                   	push   %ebx
+  80128b:	e8 5a fa ff ff       	call   800cea <touch_mem>
+  801290:	83 c4 08             	add    $0x8,%esp
+  801293:	eb da                	jmp    80126f <sys_ipc_call+0x1b>
+
+00801295 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801295:	55                   	push   %ebp
+  801296:	89 e5                	mov    %esp,%ebp
+  801298:	57                   	push   %edi
+  801299:	56                   	push   %esi
+  80129a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80129b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a1:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012a9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012ac:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012af:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8012b1:	5b                   	pop    %ebx
+  8012b2:	5e                   	pop    %esi
+  8012b3:	5f                   	pop    %edi
+  8012b4:	5d                   	pop    %ebp
+  8012b5:	c3                   	ret
+
+008012b6 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8012b6:	55                   	push   %ebp
+  8012b7:	89 e5                	mov    %esp,%ebp
+  8012b9:	57                   	push   %edi
+  8012ba:	56                   	push   %esi
+  8012bb:	53                   	push   %ebx
+  8012bc:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8012bf:	6a 04                	push   $0x4
+  8012c1:	ff 75 08             	push   0x8(%ebp)
+  8012c4:	e8 21 fa ff ff       	call   800cea <touch_mem>
+	asm volatile("int %1\n"
+  8012c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d1:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012dc:	89 f7                	mov    %esi,%edi
+  8012de:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012e0:	83 c4 08             	add    $0x8,%esp
+  8012e3:	85 c0                	test   %eax,%eax
+  8012e5:	7f 08                	jg     8012ef <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8012e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ea:	5b                   	pop    %ebx
+  8012eb:	5e                   	pop    %esi
+  8012ec:	5f                   	pop    %edi
+  8012ed:	5d                   	pop    %ebp
+  8012ee:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012ef:	83 ec 0c             	sub    $0xc,%esp
+  8012f2:	50                   	push   %eax
+  8012f3:	6a 16                	push   $0x16
+  8012f5:	68 2b 58 80 00       	push   $0x80582b
+  8012fa:	6a 23                	push   $0x23
+  8012fc:	68 48 58 80 00       	push   $0x805848
+  801301:	e8 22 ef ff ff       	call   800228 <_panic>
+
+00801306 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801306:	55                   	push   %ebp
+  801307:	89 e5                	mov    %esp,%ebp
+  801309:	57                   	push   %edi
+  80130a:	56                   	push   %esi
+  80130b:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  80130c:	6a 04                	push   $0x4
+  80130e:	ff 75 08             	push   0x8(%ebp)
+  801311:	e8 d4 f9 ff ff       	call   800cea <touch_mem>
+	asm volatile("int %1\n"
+  801316:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131e:	b8 17 00 00 00       	mov    $0x17,%eax
+  801323:	8b 55 08             	mov    0x8(%ebp),%edx
+  801326:	89 df                	mov    %ebx,%edi
+  801328:	89 de                	mov    %ebx,%esi
+  80132a:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80132c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132f:	5b                   	pop    %ebx
+  801330:	5e                   	pop    %esi
+  801331:	5f                   	pop    %edi
+  801332:	5d                   	pop    %ebp
+  801333:	c3                   	ret
+
+00801334 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  801334:	55                   	push   %ebp
+  801335:	89 e5                	mov    %esp,%ebp
+  801337:	57                   	push   %edi
+  801338:	56                   	push   %esi
+  801339:	53                   	push   %ebx
+  80133a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80133d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801342:	8b 55 08             	mov    0x8(%ebp),%edx
+  801345:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80134a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80134f:	89 df                	mov    %ebx,%edi
+  801351:	89 de                	mov    %ebx,%esi
+  801353:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801355:	85 c0                	test   %eax,%eax
+  801357:	7f 08                	jg     801361 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801359:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80135c:	5b                   	pop    %ebx
+  80135d:	5e                   	pop    %esi
+  80135e:	5f                   	pop    %edi
+  80135f:	5d                   	pop    %ebp
+  801360:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801361:	83 ec 0c             	sub    $0xc,%esp
+  801364:	50                   	push   %eax
+  801365:	6a 0e                	push   $0xe
+  801367:	68 2b 58 80 00       	push   $0x80582b
+  80136c:	6a 23                	push   $0x23
+  80136e:	68 48 58 80 00       	push   $0x805848
+  801373:	e8 b0 ee ff ff       	call   800228 <_panic>
+
+00801378 <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  801378:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80137f:	f6 c6 06             	test   $0x6,%dh
+  801382:	75 37                	jne    8013bb <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  801384:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80138b:	f6 c2 02             	test   $0x2,%dl
+  80138e:	75 19                	jne    8013a9 <dupperm+0x31>
+  801390:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801397:	f6 c6 08             	test   $0x8,%dh
+  80139a:	75 0d                	jne    8013a9 <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  80139c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013a3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013a8:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  8013a9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013b0:	25 00 06 00 00       	and    $0x600,%eax
+  8013b5:	0d 05 08 00 00       	or     $0x805,%eax
+  8013ba:	c3                   	ret
+		return 0;
+  8013bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013c0:	c3                   	ret
+
+008013c1 <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  8013c1:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  8013c3:	c1 e0 0c             	shl    $0xc,%eax
+  8013c6:	c1 e8 16             	shr    $0x16,%eax
+  8013c9:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8013d0:	f6 c1 01             	test   $0x1,%cl
+  8013d3:	74 2c                	je     801401 <dupable+0x40>
+  8013d5:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8013dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e1:	f6 c1 04             	test   $0x4,%cl
+  8013e4:	74 20                	je     801406 <dupable+0x45>
+  8013e6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8013ed:	f6 c1 01             	test   $0x1,%cl
+  8013f0:	74 14                	je     801406 <dupable+0x45>
+  8013f2:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8013f9:	c1 e8 02             	shr    $0x2,%eax
+  8013fc:	83 e0 01             	and    $0x1,%eax
+  8013ff:	eb 05                	jmp    801406 <dupable+0x45>
+  801401:	b8 00 00 00 00       	mov    $0x0,%eax
+  801406:	83 e0 01             	and    $0x1,%eax
+}
+  801409:	c3                   	ret
+
+0080140a <pgfault>:
+{
+  80140a:	55                   	push   %ebp
+  80140b:	89 e5                	mov    %esp,%ebp
+  80140d:	56                   	push   %esi
+  80140e:	53                   	push   %ebx
+  80140f:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801412:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  801414:	89 ca                	mov    %ecx,%edx
+  801416:	c1 ea 0c             	shr    $0xc,%edx
+  801419:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801420:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801424:	0f 84 8e 00 00 00    	je     8014b8 <pgfault+0xae>
+		return 0;
+  80142a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  80142f:	f6 c6 08             	test   $0x8,%dh
+  801432:	0f 84 85 00 00 00    	je     8014bd <pgfault+0xb3>
+	perm |= PTE_W;
+  801438:	81 e2 07 06 00 00    	and    $0x607,%edx
+  80143e:	89 d3                	mov    %edx,%ebx
+  801440:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801443:	89 ce                	mov    %ecx,%esi
+  801445:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  80144b:	6a 01                	push   $0x1
+  80144d:	53                   	push   %ebx
+  80144e:	68 00 f0 7f 00       	push   $0x7ff000
+  801453:	6a 00                	push   $0x0
+  801455:	e8 39 27 00 00       	call   803b93 <page_alloc>
+  80145a:	83 c4 10             	add    $0x10,%esp
+  80145d:	85 c0                	test   %eax,%eax
+  80145f:	78 33                	js     801494 <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  801461:	83 ec 04             	sub    $0x4,%esp
+  801464:	68 00 10 00 00       	push   $0x1000
+  801469:	56                   	push   %esi
+  80146a:	68 00 f0 7f 00       	push   $0x7ff000
+  80146f:	e8 fc f5 ff ff       	call   800a70 <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  801474:	89 1c 24             	mov    %ebx,(%esp)
+  801477:	56                   	push   %esi
+  801478:	6a 00                	push   $0x0
+  80147a:	68 00 f0 7f 00       	push   $0x7ff000
+  80147f:	6a 00                	push   $0x0
+  801481:	e8 6e 2d 00 00       	call   8041f4 <page_map>
+  801486:	83 c4 20             	add    $0x20,%esp
+  801489:	85 c0                	test   %eax,%eax
+  80148b:	78 19                	js     8014a6 <pgfault+0x9c>
+	return 1;
+  80148d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801492:	eb 29                	jmp    8014bd <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  801494:	50                   	push   %eax
+  801495:	68 58 58 80 00       	push   $0x805858
+  80149a:	6a 2e                	push   $0x2e
+  80149c:	68 ab 58 80 00       	push   $0x8058ab
+  8014a1:	e8 82 ed ff ff       	call   800228 <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  8014a6:	50                   	push   %eax
+  8014a7:	68 84 58 80 00       	push   $0x805884
+  8014ac:	6a 32                	push   $0x32
+  8014ae:	68 ab 58 80 00       	push   $0x8058ab
+  8014b3:	e8 70 ed ff ff       	call   800228 <_panic>
+		return 0;
+  8014b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014c0:	5b                   	pop    %ebx
+  8014c1:	5e                   	pop    %esi
+  8014c2:	5d                   	pop    %ebp
+  8014c3:	c3                   	ret
+
+008014c4 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8014c4:	55                   	push   %ebp
+  8014c5:	89 e5                	mov    %esp,%ebp
+  8014c7:	57                   	push   %edi
+  8014c8:	56                   	push   %esi
+  8014c9:	53                   	push   %ebx
+  8014ca:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  8014cd:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  8014d4:	74 5d                	je     801533 <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  8014d6:	83 ec 0c             	sub    $0xc,%esp
+  8014d9:	68 0a 14 80 00       	push   $0x80140a
+  8014de:	e8 72 39 00 00       	call   804e55 <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  8014e3:	e8 14 fb ff ff       	call   800ffc <sys_fork>
+  8014e8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8014eb:	83 c4 10             	add    $0x10,%esp
+  8014ee:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8014f1:	74 47                	je     80153a <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  8014f3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8014f7:	0f 84 c5 03 00 00    	je     8018c2 <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  8014fd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801501:	78 25                	js     801528 <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  801503:	e8 03 20 00 00       	call   80350b <page_share_paged_out>
+  801508:	85 c0                	test   %eax,%eax
+  80150a:	0f 88 d8 03 00 00    	js     8018e8 <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801510:	83 ec 08             	sub    $0x8,%esp
+  801513:	6a 02                	push   $0x2
+  801515:	ff 75 e4             	push   -0x1c(%ebp)
+  801518:	e8 fe fa ff ff       	call   80101b <sys_env_set_status>
+  80151d:	83 c4 10             	add    $0x10,%esp
+  801520:	85 c0                	test   %eax,%eax
+  801522:	0f 88 d5 03 00 00    	js     8018fd <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  801528:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80152b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80152e:	5b                   	pop    %ebx
+  80152f:	5e                   	pop    %esi
+  801530:	5f                   	pop    %edi
+  801531:	5d                   	pop    %ebp
+  801532:	c3                   	ret
+		init_map_dir();
+  801533:	e8 db 22 00 00       	call   803813 <init_map_dir>
+  801538:	eb 9c                	jmp    8014d6 <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80153a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80153f:	cd 30                	int    $0x30
+  801541:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  801544:	85 c0                	test   %eax,%eax
+  801546:	78 10                	js     801558 <fork+0x94>
+	if (envid == 0)
+  801548:	0f 84 74 03 00 00    	je     8018c2 <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  80154e:	be 00 00 00 00       	mov    $0x0,%esi
+  801553:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801556:	eb 30                	jmp    801588 <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  801558:	50                   	push   %eax
+  801559:	68 b6 58 80 00       	push   $0x8058b6
+  80155e:	68 cd 00 00 00       	push   $0xcd
+  801563:	68 ab 58 80 00       	push   $0x8058ab
+  801568:	e8 bb ec ff ff       	call   800228 <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  80156d:	89 f2                	mov    %esi,%edx
+  80156f:	c1 fa 1f             	sar    $0x1f,%edx
+  801572:	c1 ea 16             	shr    $0x16,%edx
+  801575:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  801578:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80157d:	29 d0                	sub    %edx,%eax
+  80157f:	ba 00 04 00 00       	mov    $0x400,%edx
+  801584:	29 c2                	sub    %eax,%edx
+  801586:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801588:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  80158b:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801591:	0f 87 ff 02 00 00    	ja     801896 <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  801597:	89 f3                	mov    %esi,%ebx
+  801599:	c1 e3 0c             	shl    $0xc,%ebx
+  80159c:	89 d8                	mov    %ebx,%eax
+  80159e:	c1 e8 16             	shr    $0x16,%eax
+  8015a1:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8015a8:	f6 c2 01             	test   $0x1,%dl
+  8015ab:	74 c0                	je     80156d <fork+0xa9>
+  8015ad:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8015b4:	f6 c2 04             	test   $0x4,%dl
+  8015b7:	74 b4                	je     80156d <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  8015b9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015c0:	a8 80                	test   $0x80,%al
+  8015c2:	75 24                	jne    8015e8 <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  8015c4:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8015cb:	25 81 00 00 00       	and    $0x81,%eax
+  8015d0:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8015d5:	74 21                	je     8015f8 <fork+0x134>
+		if (!dupable(pn)) {
+  8015d7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015da:	e8 e2 fd ff ff       	call   8013c1 <dupable>
+  8015df:	84 c0                	test   %al,%al
+  8015e1:	75 1a                	jne    8015fd <fork+0x139>
+			++pn;
+  8015e3:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8015e6:	eb a0                	jmp    801588 <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  8015e8:	83 ec 08             	sub    $0x8,%esp
+  8015eb:	53                   	push   %ebx
+  8015ec:	6a 00                	push   $0x0
+  8015ee:	e8 b1 f8 ff ff       	call   800ea4 <sys_page_split>
+  8015f3:	83 c4 10             	add    $0x10,%esp
+  8015f6:	eb cc                	jmp    8015c4 <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  8015f8:	0f b6 03             	movzbl (%ebx),%eax
+  8015fb:	eb da                	jmp    8015d7 <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  8015fd:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801600:	89 f8                	mov    %edi,%eax
+  801602:	e8 71 fd ff ff       	call   801378 <dupperm>
+  801607:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80160a:	85 c0                	test   %eax,%eax
+  80160c:	74 16                	je     801624 <fork+0x160>
+  80160e:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  801613:	29 f8                	sub    %edi,%eax
+  801615:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801618:	bf 01 00 00 00       	mov    $0x1,%edi
+  80161d:	89 c6                	mov    %eax,%esi
+  80161f:	e9 c4 01 00 00       	jmp    8017e8 <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  801624:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801627:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80162e:	f6 c4 04             	test   $0x4,%ah
+  801631:	0f 85 89 00 00 00    	jne    8016c0 <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  801637:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80163a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801641:	f6 c4 02             	test   $0x2,%ah
+  801644:	0f 85 b1 00 00 00    	jne    8016fb <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  80164a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80164d:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801654:	a8 02                	test   $0x2,%al
+  801656:	75 10                	jne    801668 <fork+0x1a4>
+  801658:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80165f:	f6 c4 08             	test   $0x8,%ah
+  801662:	0f 84 3e 01 00 00    	je     8017a6 <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801668:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80166b:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801672:	25 00 06 00 00       	and    $0x600,%eax
+  801677:	0d 05 08 00 00       	or     $0x805,%eax
+  80167c:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  80167e:	c1 e1 0c             	shl    $0xc,%ecx
+  801681:	89 cb                	mov    %ecx,%ebx
+  801683:	83 ec 0c             	sub    $0xc,%esp
+  801686:	50                   	push   %eax
+  801687:	51                   	push   %ecx
+  801688:	ff 75 e4             	push   -0x1c(%ebp)
+  80168b:	51                   	push   %ecx
+  80168c:	6a 00                	push   $0x0
+  80168e:	e8 61 2b 00 00       	call   8041f4 <page_map>
+  801693:	83 c4 20             	add    $0x20,%esp
+  801696:	85 c0                	test   %eax,%eax
+  801698:	0f 88 e4 00 00 00    	js     801782 <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  80169e:	83 ec 0c             	sub    $0xc,%esp
+  8016a1:	57                   	push   %edi
+  8016a2:	53                   	push   %ebx
+  8016a3:	6a 00                	push   $0x0
+  8016a5:	53                   	push   %ebx
+  8016a6:	6a 00                	push   $0x0
+  8016a8:	e8 47 2b 00 00       	call   8041f4 <page_map>
+  8016ad:	83 c4 20             	add    $0x20,%esp
+  8016b0:	85 c0                	test   %eax,%eax
+  8016b2:	0f 88 dc 00 00 00    	js     801794 <fork+0x2d0>
+			++pn;
+  8016b8:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8016bb:	e9 c8 fe ff ff       	jmp    801588 <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8016c0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8016c3:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8016ca:	c1 e1 0c             	shl    $0xc,%ecx
+  8016cd:	83 ec 0c             	sub    $0xc,%esp
+  8016d0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016d5:	50                   	push   %eax
+  8016d6:	51                   	push   %ecx
+  8016d7:	ff 75 e4             	push   -0x1c(%ebp)
+  8016da:	51                   	push   %ecx
+  8016db:	6a 00                	push   $0x0
+  8016dd:	e8 12 2b 00 00       	call   8041f4 <page_map>
+  8016e2:	83 c4 20             	add    $0x20,%esp
+  8016e5:	85 c0                	test   %eax,%eax
+  8016e7:	79 cf                	jns    8016b8 <fork+0x1f4>
+			panic("page_map %d", r);
+  8016e9:	50                   	push   %eax
+  8016ea:	68 c6 58 80 00       	push   $0x8058c6
+  8016ef:	6a 4d                	push   $0x4d
+  8016f1:	68 ab 58 80 00       	push   $0x8058ab
+  8016f6:	e8 2d eb ff ff       	call   800228 <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  8016fb:	83 ec 0c             	sub    $0xc,%esp
+  8016fe:	68 00 10 00 00       	push   $0x1000
+  801703:	e8 de 30 00 00       	call   8047e6 <malloc>
+  801708:	89 c7                	mov    %eax,%edi
+  80170a:	83 c4 10             	add    $0x10,%esp
+  80170d:	85 c0                	test   %eax,%eax
+  80170f:	74 4b                	je     80175c <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  801711:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801714:	c1 e3 0c             	shl    $0xc,%ebx
+  801717:	83 ec 04             	sub    $0x4,%esp
+  80171a:	68 00 10 00 00       	push   $0x1000
+  80171f:	53                   	push   %ebx
+  801720:	50                   	push   %eax
+  801721:	e8 ac f3 ff ff       	call   800ad2 <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  801726:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801729:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801730:	25 07 0e 00 00       	and    $0xe07,%eax
+  801735:	89 04 24             	mov    %eax,(%esp)
+  801738:	53                   	push   %ebx
+  801739:	ff 75 e4             	push   -0x1c(%ebp)
+  80173c:	57                   	push   %edi
+  80173d:	6a 00                	push   $0x0
+  80173f:	e8 b0 2a 00 00       	call   8041f4 <page_map>
+  801744:	83 c4 20             	add    $0x20,%esp
+  801747:	85 c0                	test   %eax,%eax
+  801749:	78 25                	js     801770 <fork+0x2ac>
+		free(temp);
+  80174b:	83 ec 0c             	sub    $0xc,%esp
+  80174e:	57                   	push   %edi
+  80174f:	e8 90 2e 00 00       	call   8045e4 <free>
+  801754:	83 c4 10             	add    $0x10,%esp
+  801757:	e9 5c ff ff ff       	jmp    8016b8 <fork+0x1f4>
+			panic("malloc failed");
+  80175c:	83 ec 04             	sub    $0x4,%esp
+  80175f:	68 d2 58 80 00       	push   $0x8058d2
+  801764:	6a 56                	push   $0x56
+  801766:	68 ab 58 80 00       	push   $0x8058ab
+  80176b:	e8 b8 ea ff ff       	call   800228 <_panic>
+			panic("page_map: %e", r);
+  801770:	50                   	push   %eax
+  801771:	68 e0 58 80 00       	push   $0x8058e0
+  801776:	6a 59                	push   $0x59
+  801778:	68 ab 58 80 00       	push   $0x8058ab
+  80177d:	e8 a6 ea ff ff       	call   800228 <_panic>
+			panic("page_map %d", r);
+  801782:	50                   	push   %eax
+  801783:	68 c6 58 80 00       	push   $0x8058c6
+  801788:	6a 65                	push   $0x65
+  80178a:	68 ab 58 80 00       	push   $0x8058ab
+  80178f:	e8 94 ea ff ff       	call   800228 <_panic>
+			panic("page_map %d", r);
+  801794:	50                   	push   %eax
+  801795:	68 c6 58 80 00       	push   $0x8058c6
+  80179a:	6a 78                	push   $0x78
+  80179c:	68 ab 58 80 00       	push   $0x8058ab
+  8017a1:	e8 82 ea ff ff       	call   800228 <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8017a6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8017a9:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8017b0:	c1 e1 0c             	shl    $0xc,%ecx
+  8017b3:	83 ec 0c             	sub    $0xc,%esp
+  8017b6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017bb:	50                   	push   %eax
+  8017bc:	51                   	push   %ecx
+  8017bd:	ff 75 e4             	push   -0x1c(%ebp)
+  8017c0:	51                   	push   %ecx
+  8017c1:	6a 00                	push   $0x0
+  8017c3:	e8 2c 2a 00 00       	call   8041f4 <page_map>
+  8017c8:	83 c4 20             	add    $0x20,%esp
+  8017cb:	85 c0                	test   %eax,%eax
+  8017cd:	0f 89 e5 fe ff ff    	jns    8016b8 <fork+0x1f4>
+			panic("page_map %d", r);
+  8017d3:	50                   	push   %eax
+  8017d4:	68 c6 58 80 00       	push   $0x8058c6
+  8017d9:	6a 7f                	push   $0x7f
+  8017db:	68 ab 58 80 00       	push   $0x8058ab
+  8017e0:	e8 43 ea ff ff       	call   800228 <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  8017e5:	83 c7 01             	add    $0x1,%edi
+  8017e8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017eb:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  8017ee:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  8017f1:	39 f7                	cmp    %esi,%edi
+  8017f3:	74 1c                	je     801811 <fork+0x34d>
+  8017f5:	89 d8                	mov    %ebx,%eax
+  8017f7:	e8 c5 fb ff ff       	call   8013c1 <dupable>
+  8017fc:	84 c0                	test   %al,%al
+  8017fe:	74 7c                	je     80187c <fork+0x3b8>
+  801800:	89 d8                	mov    %ebx,%eax
+  801802:	e8 71 fb ff ff       	call   801378 <dupperm>
+  801807:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  80180a:	74 d9                	je     8017e5 <fork+0x321>
+  80180c:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80180f:	eb 06                	jmp    801817 <fork+0x353>
+  801811:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801814:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  801817:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80181a:	c1 e0 0c             	shl    $0xc,%eax
+  80181d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801820:	83 ec 08             	sub    $0x8,%esp
+  801823:	ff 75 dc             	push   -0x24(%ebp)
+  801826:	57                   	push   %edi
+  801827:	50                   	push   %eax
+  801828:	ff 75 e4             	push   -0x1c(%ebp)
+  80182b:	50                   	push   %eax
+  80182c:	6a 00                	push   $0x0
+  80182e:	e8 b8 2b 00 00       	call   8043eb <page_map_range>
+  801833:	83 c4 20             	add    $0x20,%esp
+  801836:	85 c0                	test   %eax,%eax
+  801838:	78 47                	js     801881 <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  80183a:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801841:	0f 84 41 fd ff ff    	je     801588 <fork+0xc4>
+  801847:	83 ec 08             	sub    $0x8,%esp
+  80184a:	ff 75 dc             	push   -0x24(%ebp)
+  80184d:	57                   	push   %edi
+  80184e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801851:	50                   	push   %eax
+  801852:	6a 00                	push   $0x0
+  801854:	50                   	push   %eax
+  801855:	6a 00                	push   $0x0
+  801857:	e8 8f 2b 00 00       	call   8043eb <page_map_range>
+  80185c:	83 c4 20             	add    $0x20,%esp
+  80185f:	85 c0                	test   %eax,%eax
+  801861:	0f 89 21 fd ff ff    	jns    801588 <fork+0xc4>
+		panic("page_map_range %e", r);
+  801867:	50                   	push   %eax
+  801868:	68 ed 58 80 00       	push   $0x8058ed
+  80186d:	68 a2 00 00 00       	push   $0xa2
+  801872:	68 ab 58 80 00       	push   $0x8058ab
+  801877:	e8 ac e9 ff ff       	call   800228 <_panic>
+  80187c:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80187f:	eb 96                	jmp    801817 <fork+0x353>
+		panic("page_map_range %e", r);
+  801881:	50                   	push   %eax
+  801882:	68 ed 58 80 00       	push   $0x8058ed
+  801887:	68 a0 00 00 00       	push   $0xa0
+  80188c:	68 ab 58 80 00       	push   $0x8058ab
+  801891:	e8 92 e9 ff ff       	call   800228 <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  801896:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  801899:	6a 01                	push   $0x1
+  80189b:	6a 07                	push   $0x7
+  80189d:	68 00 f0 bf ee       	push   $0xeebff000
+  8018a2:	53                   	push   %ebx
+  8018a3:	e8 eb 22 00 00       	call   803b93 <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8018a8:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8018ad:	8b 40 74             	mov    0x74(%eax),%eax
+  8018b0:	83 c4 08             	add    $0x8,%esp
+  8018b3:	50                   	push   %eax
+  8018b4:	53                   	push   %ebx
+  8018b5:	e8 89 f8 ff ff       	call   801143 <sys_env_set_pgfault_upcall>
+  8018ba:	83 c4 10             	add    $0x10,%esp
+  8018bd:	e9 41 fc ff ff       	jmp    801503 <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8018c2:	e8 d8 f4 ff ff       	call   800d9f <sys_getenvid>
+  8018c7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018cc:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8018cf:	c1 e0 06             	shl    $0x6,%eax
+  8018d2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8018d7:	a3 18 f9 80 00       	mov    %eax,0x80f918
+		return 0;
+  8018dc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8018e3:	e9 40 fc ff ff       	jmp    801528 <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  8018e8:	50                   	push   %eax
+  8018e9:	68 ff 58 80 00       	push   $0x8058ff
+  8018ee:	68 27 01 00 00       	push   $0x127
+  8018f3:	68 ab 58 80 00       	push   $0x8058ab
+  8018f8:	e8 2b e9 ff ff       	call   800228 <_panic>
+		panic("sys_env_set_status: %d", r);
+  8018fd:	50                   	push   %eax
+  8018fe:	68 18 59 80 00       	push   $0x805918
+  801903:	68 2b 01 00 00       	push   $0x12b
+  801908:	68 ab 58 80 00       	push   $0x8058ab
+  80190d:	e8 16 e9 ff ff       	call   800228 <_panic>
+
+00801912 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801912:	55                   	push   %ebp
+  801913:	89 e5                	mov    %esp,%ebp
+  801915:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801918:	68 2f 59 80 00       	push   $0x80592f
+  80191d:	68 35 01 00 00       	push   $0x135
+  801922:	68 ab 58 80 00       	push   $0x8058ab
+  801927:	e8 fc e8 ff ff       	call   800228 <_panic>
+
+0080192c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80192c:	55                   	push   %ebp
+  80192d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80192f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801932:	05 00 00 00 30       	add    $0x30000000,%eax
+  801937:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80193a:	5d                   	pop    %ebp
+  80193b:	c3                   	ret
+
+0080193c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80193c:	55                   	push   %ebp
+  80193d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80193f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801942:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801947:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80194c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801951:	5d                   	pop    %ebp
+  801952:	c3                   	ret
+
+00801953 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801953:	55                   	push   %ebp
+  801954:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801956:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  80195b:	a8 01                	test   $0x1,%al
+  80195d:	74 3c                	je     80199b <fd_alloc+0x48>
+  80195f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801964:	89 c2                	mov    %eax,%edx
+  801966:	c1 ea 0c             	shr    $0xc,%edx
+  801969:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801970:	89 c1                	mov    %eax,%ecx
+  801972:	05 00 10 00 00       	add    $0x1000,%eax
+  801977:	f6 c2 01             	test   $0x1,%dl
+  80197a:	74 13                	je     80198f <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80197c:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801981:	75 e1                	jne    801964 <fd_alloc+0x11>
+  801983:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801988:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80198d:	eb 05                	jmp    801994 <fd_alloc+0x41>
+			return 0;
+  80198f:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801994:	8b 55 08             	mov    0x8(%ebp),%edx
+  801997:	89 0a                	mov    %ecx,(%edx)
+}
+  801999:	5d                   	pop    %ebp
+  80199a:	c3                   	ret
+  80199b:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8019a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a5:	eb ed                	jmp    801994 <fd_alloc+0x41>
+
+008019a7 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8019a7:	55                   	push   %ebp
+  8019a8:	89 e5                	mov    %esp,%ebp
+  8019aa:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8019ad:	83 f8 1f             	cmp    $0x1f,%eax
+  8019b0:	77 30                	ja     8019e2 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8019b2:	c1 e0 0c             	shl    $0xc,%eax
+  8019b5:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8019ba:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8019c0:	f6 c2 01             	test   $0x1,%dl
+  8019c3:	74 24                	je     8019e9 <fd_lookup+0x42>
+  8019c5:	89 c2                	mov    %eax,%edx
+  8019c7:	c1 ea 0c             	shr    $0xc,%edx
+  8019ca:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019d1:	f6 c2 01             	test   $0x1,%dl
+  8019d4:	74 1a                	je     8019f0 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8019d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019d9:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8019db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019e0:	5d                   	pop    %ebp
+  8019e1:	c3                   	ret
+		return -E_INVAL;
+  8019e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019e7:	eb f7                	jmp    8019e0 <fd_lookup+0x39>
+		return -E_INVAL;
+  8019e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019ee:	eb f0                	jmp    8019e0 <fd_lookup+0x39>
+  8019f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019f5:	eb e9                	jmp    8019e0 <fd_lookup+0x39>
+
+008019f7 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8019f7:	55                   	push   %ebp
+  8019f8:	89 e5                	mov    %esp,%ebp
+  8019fa:	53                   	push   %ebx
+  8019fb:	83 ec 04             	sub    $0x4,%esp
+  8019fe:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801a01:	b8 c4 59 80 00       	mov    $0x8059c4,%eax
+  801a06:	8b 18                	mov    (%eax),%ebx
+  801a08:	85 db                	test   %ebx,%ebx
+  801a0a:	74 0e                	je     801a1a <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801a0c:	83 c0 04             	add    $0x4,%eax
+  801a0f:	39 13                	cmp    %edx,(%ebx)
+  801a11:	75 f3                	jne    801a06 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801a13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a18:	eb 1f                	jmp    801a39 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a1a:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801a1f:	8b 40 48             	mov    0x48(%eax),%eax
+  801a22:	83 ec 04             	sub    $0x4,%esp
+  801a25:	52                   	push   %edx
+  801a26:	50                   	push   %eax
+  801a27:	68 48 59 80 00       	push   $0x805948
+  801a2c:	e8 d2 e8 ff ff       	call   800303 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801a31:	83 c4 10             	add    $0x10,%esp
+  801a34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801a39:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a3c:	89 1a                	mov    %ebx,(%edx)
+}
+  801a3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a41:	c9                   	leave
+  801a42:	c3                   	ret
+
+00801a43 <fd_close>:
+{
+  801a43:	55                   	push   %ebp
+  801a44:	89 e5                	mov    %esp,%ebp
+  801a46:	57                   	push   %edi
+  801a47:	56                   	push   %esi
+  801a48:	53                   	push   %ebx
+  801a49:	83 ec 24             	sub    $0x24,%esp
+  801a4c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a4f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a52:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a55:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a56:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a5c:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a5f:	50                   	push   %eax
+  801a60:	e8 42 ff ff ff       	call   8019a7 <fd_lookup>
+  801a65:	89 c3                	mov    %eax,%ebx
+  801a67:	83 c4 10             	add    $0x10,%esp
+  801a6a:	85 c0                	test   %eax,%eax
+  801a6c:	78 05                	js     801a73 <fd_close+0x30>
+	    || fd != fd2)
+  801a6e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a71:	74 16                	je     801a89 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801a73:	89 f8                	mov    %edi,%eax
+  801a75:	84 c0                	test   %al,%al
+  801a77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a7c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a7f:	89 d8                	mov    %ebx,%eax
+  801a81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a84:	5b                   	pop    %ebx
+  801a85:	5e                   	pop    %esi
+  801a86:	5f                   	pop    %edi
+  801a87:	5d                   	pop    %ebp
+  801a88:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a89:	83 ec 08             	sub    $0x8,%esp
+  801a8c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a8f:	50                   	push   %eax
+  801a90:	ff 36                	push   (%esi)
+  801a92:	e8 60 ff ff ff       	call   8019f7 <dev_lookup>
+  801a97:	89 c3                	mov    %eax,%ebx
+  801a99:	83 c4 10             	add    $0x10,%esp
+  801a9c:	85 c0                	test   %eax,%eax
+  801a9e:	78 1a                	js     801aba <fd_close+0x77>
+		if (dev->dev_close)
+  801aa0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801aa3:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801aa6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801aab:	85 c0                	test   %eax,%eax
+  801aad:	74 0b                	je     801aba <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801aaf:	83 ec 0c             	sub    $0xc,%esp
+  801ab2:	56                   	push   %esi
+  801ab3:	ff d0                	call   *%eax
+  801ab5:	89 c3                	mov    %eax,%ebx
+  801ab7:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801aba:	83 ec 08             	sub    $0x8,%esp
+  801abd:	56                   	push   %esi
+  801abe:	6a 00                	push   $0x0
+  801ac0:	e8 9d f3 ff ff       	call   800e62 <sys_page_unmap>
+	return r;
+  801ac5:	83 c4 10             	add    $0x10,%esp
+  801ac8:	eb b5                	jmp    801a7f <fd_close+0x3c>
+
+00801aca <close>:
+
+int
+close(int fdnum)
+{
+  801aca:	55                   	push   %ebp
+  801acb:	89 e5                	mov    %esp,%ebp
+  801acd:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ad0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad3:	50                   	push   %eax
+  801ad4:	ff 75 08             	push   0x8(%ebp)
+  801ad7:	e8 cb fe ff ff       	call   8019a7 <fd_lookup>
+  801adc:	83 c4 10             	add    $0x10,%esp
+  801adf:	85 c0                	test   %eax,%eax
+  801ae1:	79 02                	jns    801ae5 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801ae3:	c9                   	leave
+  801ae4:	c3                   	ret
+		return fd_close(fd, 1);
+  801ae5:	83 ec 08             	sub    $0x8,%esp
+  801ae8:	6a 01                	push   $0x1
+  801aea:	ff 75 f4             	push   -0xc(%ebp)
+  801aed:	e8 51 ff ff ff       	call   801a43 <fd_close>
+  801af2:	83 c4 10             	add    $0x10,%esp
+  801af5:	eb ec                	jmp    801ae3 <close+0x19>
+
+00801af7 <close_all>:
+
+void
+close_all(void)
+{
+  801af7:	55                   	push   %ebp
+  801af8:	89 e5                	mov    %esp,%ebp
+  801afa:	53                   	push   %ebx
+  801afb:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801afe:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801b03:	83 ec 0c             	sub    $0xc,%esp
+  801b06:	53                   	push   %ebx
+  801b07:	e8 be ff ff ff       	call   801aca <close>
+	for (i = 0; i < MAXFD; i++)
+  801b0c:	83 c3 01             	add    $0x1,%ebx
+  801b0f:	83 c4 10             	add    $0x10,%esp
+  801b12:	83 fb 20             	cmp    $0x20,%ebx
+  801b15:	75 ec                	jne    801b03 <close_all+0xc>
+}
+  801b17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b1a:	c9                   	leave
+  801b1b:	c3                   	ret
+
+00801b1c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801b1c:	55                   	push   %ebp
+  801b1d:	89 e5                	mov    %esp,%ebp
+  801b1f:	57                   	push   %edi
+  801b20:	56                   	push   %esi
+  801b21:	53                   	push   %ebx
+  801b22:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801b25:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b28:	50                   	push   %eax
+  801b29:	ff 75 08             	push   0x8(%ebp)
+  801b2c:	e8 76 fe ff ff       	call   8019a7 <fd_lookup>
+  801b31:	89 c3                	mov    %eax,%ebx
+  801b33:	83 c4 10             	add    $0x10,%esp
+  801b36:	85 c0                	test   %eax,%eax
+  801b38:	78 7f                	js     801bb9 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801b3a:	83 ec 0c             	sub    $0xc,%esp
+  801b3d:	ff 75 0c             	push   0xc(%ebp)
+  801b40:	e8 85 ff ff ff       	call   801aca <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801b45:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b48:	c1 e6 0c             	shl    $0xc,%esi
+  801b4b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801b51:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b54:	89 3c 24             	mov    %edi,(%esp)
+  801b57:	e8 e0 fd ff ff       	call   80193c <fd2data>
+  801b5c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801b5e:	89 34 24             	mov    %esi,(%esp)
+  801b61:	e8 d6 fd ff ff       	call   80193c <fd2data>
+  801b66:	83 c4 10             	add    $0x10,%esp
+  801b69:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801b6c:	89 d8                	mov    %ebx,%eax
+  801b6e:	c1 e8 16             	shr    $0x16,%eax
+  801b71:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b78:	a8 01                	test   $0x1,%al
+  801b7a:	74 11                	je     801b8d <dup+0x71>
+  801b7c:	89 d8                	mov    %ebx,%eax
+  801b7e:	c1 e8 0c             	shr    $0xc,%eax
+  801b81:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b88:	f6 c2 01             	test   $0x1,%dl
+  801b8b:	75 36                	jne    801bc3 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b8d:	89 f8                	mov    %edi,%eax
+  801b8f:	c1 e8 0c             	shr    $0xc,%eax
+  801b92:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b99:	83 ec 0c             	sub    $0xc,%esp
+  801b9c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ba1:	50                   	push   %eax
+  801ba2:	56                   	push   %esi
+  801ba3:	6a 00                	push   $0x0
+  801ba5:	57                   	push   %edi
+  801ba6:	6a 00                	push   $0x0
+  801ba8:	e8 73 f2 ff ff       	call   800e20 <sys_page_map>
+  801bad:	89 c3                	mov    %eax,%ebx
+  801baf:	83 c4 20             	add    $0x20,%esp
+  801bb2:	85 c0                	test   %eax,%eax
+  801bb4:	78 33                	js     801be9 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801bb6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801bb9:	89 d8                	mov    %ebx,%eax
+  801bbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bbe:	5b                   	pop    %ebx
+  801bbf:	5e                   	pop    %esi
+  801bc0:	5f                   	pop    %edi
+  801bc1:	5d                   	pop    %ebp
+  801bc2:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801bc3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801bca:	83 ec 0c             	sub    $0xc,%esp
+  801bcd:	25 07 0e 00 00       	and    $0xe07,%eax
+  801bd2:	50                   	push   %eax
+  801bd3:	ff 75 d4             	push   -0x2c(%ebp)
+  801bd6:	6a 00                	push   $0x0
+  801bd8:	53                   	push   %ebx
+  801bd9:	6a 00                	push   $0x0
+  801bdb:	e8 40 f2 ff ff       	call   800e20 <sys_page_map>
+  801be0:	89 c3                	mov    %eax,%ebx
+  801be2:	83 c4 20             	add    $0x20,%esp
+  801be5:	85 c0                	test   %eax,%eax
+  801be7:	79 a4                	jns    801b8d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801be9:	83 ec 08             	sub    $0x8,%esp
+  801bec:	56                   	push   %esi
+  801bed:	6a 00                	push   $0x0
+  801bef:	e8 6e f2 ff ff       	call   800e62 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801bf4:	83 c4 08             	add    $0x8,%esp
+  801bf7:	ff 75 d4             	push   -0x2c(%ebp)
+  801bfa:	6a 00                	push   $0x0
+  801bfc:	e8 61 f2 ff ff       	call   800e62 <sys_page_unmap>
+	return r;
+  801c01:	83 c4 10             	add    $0x10,%esp
+  801c04:	eb b3                	jmp    801bb9 <dup+0x9d>
+
+00801c06 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801c06:	55                   	push   %ebp
+  801c07:	89 e5                	mov    %esp,%ebp
+  801c09:	56                   	push   %esi
+  801c0a:	53                   	push   %ebx
+  801c0b:	83 ec 18             	sub    $0x18,%esp
+  801c0e:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c11:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c14:	50                   	push   %eax
+  801c15:	56                   	push   %esi
+  801c16:	e8 8c fd ff ff       	call   8019a7 <fd_lookup>
+  801c1b:	83 c4 10             	add    $0x10,%esp
+  801c1e:	85 c0                	test   %eax,%eax
+  801c20:	78 3c                	js     801c5e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c22:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801c25:	83 ec 08             	sub    $0x8,%esp
+  801c28:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c2b:	50                   	push   %eax
+  801c2c:	ff 33                	push   (%ebx)
+  801c2e:	e8 c4 fd ff ff       	call   8019f7 <dev_lookup>
+  801c33:	83 c4 10             	add    $0x10,%esp
+  801c36:	85 c0                	test   %eax,%eax
+  801c38:	78 24                	js     801c5e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c3a:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c3d:	83 e0 03             	and    $0x3,%eax
+  801c40:	83 f8 01             	cmp    $0x1,%eax
+  801c43:	74 20                	je     801c65 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801c45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c48:	8b 40 08             	mov    0x8(%eax),%eax
+  801c4b:	85 c0                	test   %eax,%eax
+  801c4d:	74 37                	je     801c86 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801c4f:	83 ec 04             	sub    $0x4,%esp
+  801c52:	ff 75 10             	push   0x10(%ebp)
+  801c55:	ff 75 0c             	push   0xc(%ebp)
+  801c58:	53                   	push   %ebx
+  801c59:	ff d0                	call   *%eax
+  801c5b:	83 c4 10             	add    $0x10,%esp
+}
+  801c5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c61:	5b                   	pop    %ebx
+  801c62:	5e                   	pop    %esi
+  801c63:	5d                   	pop    %ebp
+  801c64:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c65:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801c6a:	8b 40 48             	mov    0x48(%eax),%eax
+  801c6d:	83 ec 04             	sub    $0x4,%esp
+  801c70:	56                   	push   %esi
+  801c71:	50                   	push   %eax
+  801c72:	68 89 59 80 00       	push   $0x805989
+  801c77:	e8 87 e6 ff ff       	call   800303 <cprintf>
+		return -E_INVAL;
+  801c7c:	83 c4 10             	add    $0x10,%esp
+  801c7f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c84:	eb d8                	jmp    801c5e <read+0x58>
+		return -E_NOT_SUPP;
+  801c86:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c8b:	eb d1                	jmp    801c5e <read+0x58>
+
+00801c8d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c8d:	55                   	push   %ebp
+  801c8e:	89 e5                	mov    %esp,%ebp
+  801c90:	57                   	push   %edi
+  801c91:	56                   	push   %esi
+  801c92:	53                   	push   %ebx
+  801c93:	83 ec 0c             	sub    $0xc,%esp
+  801c96:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c99:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ca1:	eb 02                	jmp    801ca5 <readn+0x18>
+  801ca3:	01 c3                	add    %eax,%ebx
+  801ca5:	39 f3                	cmp    %esi,%ebx
+  801ca7:	73 21                	jae    801cca <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801ca9:	83 ec 04             	sub    $0x4,%esp
+  801cac:	89 f0                	mov    %esi,%eax
+  801cae:	29 d8                	sub    %ebx,%eax
+  801cb0:	50                   	push   %eax
+  801cb1:	89 d8                	mov    %ebx,%eax
+  801cb3:	03 45 0c             	add    0xc(%ebp),%eax
+  801cb6:	50                   	push   %eax
+  801cb7:	57                   	push   %edi
+  801cb8:	e8 49 ff ff ff       	call   801c06 <read>
+		if (m < 0)
+  801cbd:	83 c4 10             	add    $0x10,%esp
+  801cc0:	85 c0                	test   %eax,%eax
+  801cc2:	78 04                	js     801cc8 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801cc4:	75 dd                	jne    801ca3 <readn+0x16>
+  801cc6:	eb 02                	jmp    801cca <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801cc8:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801cca:	89 d8                	mov    %ebx,%eax
+  801ccc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ccf:	5b                   	pop    %ebx
+  801cd0:	5e                   	pop    %esi
+  801cd1:	5f                   	pop    %edi
+  801cd2:	5d                   	pop    %ebp
+  801cd3:	c3                   	ret
+
+00801cd4 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801cd4:	55                   	push   %ebp
+  801cd5:	89 e5                	mov    %esp,%ebp
+  801cd7:	56                   	push   %esi
+  801cd8:	53                   	push   %ebx
+  801cd9:	83 ec 18             	sub    $0x18,%esp
+  801cdc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cdf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ce2:	50                   	push   %eax
+  801ce3:	53                   	push   %ebx
+  801ce4:	e8 be fc ff ff       	call   8019a7 <fd_lookup>
+  801ce9:	83 c4 10             	add    $0x10,%esp
+  801cec:	85 c0                	test   %eax,%eax
+  801cee:	78 37                	js     801d27 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cf0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cf3:	83 ec 08             	sub    $0x8,%esp
+  801cf6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cf9:	50                   	push   %eax
+  801cfa:	ff 36                	push   (%esi)
+  801cfc:	e8 f6 fc ff ff       	call   8019f7 <dev_lookup>
+  801d01:	83 c4 10             	add    $0x10,%esp
+  801d04:	85 c0                	test   %eax,%eax
+  801d06:	78 1f                	js     801d27 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d08:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d0c:	74 20                	je     801d2e <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801d0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d11:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d14:	85 c0                	test   %eax,%eax
+  801d16:	74 37                	je     801d4f <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801d18:	83 ec 04             	sub    $0x4,%esp
+  801d1b:	ff 75 10             	push   0x10(%ebp)
+  801d1e:	ff 75 0c             	push   0xc(%ebp)
+  801d21:	56                   	push   %esi
+  801d22:	ff d0                	call   *%eax
+  801d24:	83 c4 10             	add    $0x10,%esp
+}
+  801d27:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d2a:	5b                   	pop    %ebx
+  801d2b:	5e                   	pop    %esi
+  801d2c:	5d                   	pop    %ebp
+  801d2d:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d2e:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801d33:	8b 40 48             	mov    0x48(%eax),%eax
+  801d36:	83 ec 04             	sub    $0x4,%esp
+  801d39:	53                   	push   %ebx
+  801d3a:	50                   	push   %eax
+  801d3b:	68 a5 59 80 00       	push   $0x8059a5
+  801d40:	e8 be e5 ff ff       	call   800303 <cprintf>
+		return -E_INVAL;
+  801d45:	83 c4 10             	add    $0x10,%esp
+  801d48:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d4d:	eb d8                	jmp    801d27 <write+0x53>
+		return -E_NOT_SUPP;
+  801d4f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d54:	eb d1                	jmp    801d27 <write+0x53>
+
+00801d56 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d56:	55                   	push   %ebp
+  801d57:	89 e5                	mov    %esp,%ebp
+  801d59:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d5c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d5f:	50                   	push   %eax
+  801d60:	ff 75 08             	push   0x8(%ebp)
+  801d63:	e8 3f fc ff ff       	call   8019a7 <fd_lookup>
+  801d68:	83 c4 10             	add    $0x10,%esp
+  801d6b:	85 c0                	test   %eax,%eax
+  801d6d:	78 0e                	js     801d7d <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d75:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d78:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d7d:	c9                   	leave
+  801d7e:	c3                   	ret
+
+00801d7f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d7f:	55                   	push   %ebp
+  801d80:	89 e5                	mov    %esp,%ebp
+  801d82:	56                   	push   %esi
+  801d83:	53                   	push   %ebx
+  801d84:	83 ec 18             	sub    $0x18,%esp
+  801d87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d8a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d8d:	50                   	push   %eax
+  801d8e:	53                   	push   %ebx
+  801d8f:	e8 13 fc ff ff       	call   8019a7 <fd_lookup>
+  801d94:	83 c4 10             	add    $0x10,%esp
+  801d97:	85 c0                	test   %eax,%eax
+  801d99:	78 34                	js     801dcf <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d9b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d9e:	83 ec 08             	sub    $0x8,%esp
+  801da1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801da4:	50                   	push   %eax
+  801da5:	ff 36                	push   (%esi)
+  801da7:	e8 4b fc ff ff       	call   8019f7 <dev_lookup>
+  801dac:	83 c4 10             	add    $0x10,%esp
+  801daf:	85 c0                	test   %eax,%eax
+  801db1:	78 1c                	js     801dcf <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801db3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801db7:	74 1d                	je     801dd6 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801db9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dbc:	8b 40 18             	mov    0x18(%eax),%eax
+  801dbf:	85 c0                	test   %eax,%eax
+  801dc1:	74 34                	je     801df7 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801dc3:	83 ec 08             	sub    $0x8,%esp
+  801dc6:	ff 75 0c             	push   0xc(%ebp)
+  801dc9:	56                   	push   %esi
+  801dca:	ff d0                	call   *%eax
+  801dcc:	83 c4 10             	add    $0x10,%esp
+}
+  801dcf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dd2:	5b                   	pop    %ebx
+  801dd3:	5e                   	pop    %esi
+  801dd4:	5d                   	pop    %ebp
+  801dd5:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801dd6:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801ddb:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dde:	83 ec 04             	sub    $0x4,%esp
+  801de1:	53                   	push   %ebx
+  801de2:	50                   	push   %eax
+  801de3:	68 68 59 80 00       	push   $0x805968
+  801de8:	e8 16 e5 ff ff       	call   800303 <cprintf>
+		return -E_INVAL;
+  801ded:	83 c4 10             	add    $0x10,%esp
+  801df0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801df5:	eb d8                	jmp    801dcf <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801df7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dfc:	eb d1                	jmp    801dcf <ftruncate+0x50>
+
+00801dfe <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801dfe:	55                   	push   %ebp
+  801dff:	89 e5                	mov    %esp,%ebp
+  801e01:	56                   	push   %esi
+  801e02:	53                   	push   %ebx
+  801e03:	83 ec 18             	sub    $0x18,%esp
+  801e06:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e09:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e0c:	50                   	push   %eax
+  801e0d:	ff 75 08             	push   0x8(%ebp)
+  801e10:	e8 92 fb ff ff       	call   8019a7 <fd_lookup>
+  801e15:	83 c4 10             	add    $0x10,%esp
+  801e18:	85 c0                	test   %eax,%eax
+  801e1a:	78 49                	js     801e65 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e1c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e1f:	83 ec 08             	sub    $0x8,%esp
+  801e22:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e25:	50                   	push   %eax
+  801e26:	ff 36                	push   (%esi)
+  801e28:	e8 ca fb ff ff       	call   8019f7 <dev_lookup>
+  801e2d:	83 c4 10             	add    $0x10,%esp
+  801e30:	85 c0                	test   %eax,%eax
+  801e32:	78 31                	js     801e65 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e37:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e3b:	74 2f                	je     801e6c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e3d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e40:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e47:	00 00 00 
+	stat->st_isdir = 0;
+  801e4a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e51:	00 00 00 
+	stat->st_dev = dev;
+  801e54:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e5a:	83 ec 08             	sub    $0x8,%esp
+  801e5d:	53                   	push   %ebx
+  801e5e:	56                   	push   %esi
+  801e5f:	ff 50 14             	call   *0x14(%eax)
+  801e62:	83 c4 10             	add    $0x10,%esp
+}
+  801e65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e68:	5b                   	pop    %ebx
+  801e69:	5e                   	pop    %esi
+  801e6a:	5d                   	pop    %ebp
+  801e6b:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e6c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e71:	eb f2                	jmp    801e65 <fstat+0x67>
+
+00801e73 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e73:	55                   	push   %ebp
+  801e74:	89 e5                	mov    %esp,%ebp
+  801e76:	56                   	push   %esi
+  801e77:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e78:	83 ec 08             	sub    $0x8,%esp
+  801e7b:	6a 00                	push   $0x0
+  801e7d:	ff 75 08             	push   0x8(%ebp)
+  801e80:	e8 bc 02 00 00       	call   802141 <open>
+  801e85:	89 c3                	mov    %eax,%ebx
+  801e87:	83 c4 10             	add    $0x10,%esp
+  801e8a:	85 c0                	test   %eax,%eax
+  801e8c:	78 1b                	js     801ea9 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e8e:	83 ec 08             	sub    $0x8,%esp
+  801e91:	ff 75 0c             	push   0xc(%ebp)
+  801e94:	50                   	push   %eax
+  801e95:	e8 64 ff ff ff       	call   801dfe <fstat>
+  801e9a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e9c:	89 1c 24             	mov    %ebx,(%esp)
+  801e9f:	e8 26 fc ff ff       	call   801aca <close>
+	return r;
+  801ea4:	83 c4 10             	add    $0x10,%esp
+  801ea7:	89 f3                	mov    %esi,%ebx
+}
+  801ea9:	89 d8                	mov    %ebx,%eax
+  801eab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eae:	5b                   	pop    %ebx
+  801eaf:	5e                   	pop    %esi
+  801eb0:	5d                   	pop    %ebp
+  801eb1:	c3                   	ret
+
+00801eb2 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801eb2:	55                   	push   %ebp
+  801eb3:	89 e5                	mov    %esp,%ebp
+  801eb5:	57                   	push   %edi
+  801eb6:	56                   	push   %esi
+  801eb7:	53                   	push   %ebx
+  801eb8:	83 ec 0c             	sub    $0xc,%esp
+  801ebb:	89 c7                	mov    %eax,%edi
+  801ebd:	89 d3                	mov    %edx,%ebx
+  801ebf:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801ec1:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  801ec8:	74 2d                	je     801ef7 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801eca:	6a 07                	push   $0x7
+  801ecc:	68 00 00 81 00       	push   $0x810000
+  801ed1:	57                   	push   %edi
+  801ed2:	ff 35 00 80 80 00    	push   0x808000
+  801ed8:	e8 4e 31 00 00       	call   80502b <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801edd:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801ee4:	6a 00                	push   $0x0
+  801ee6:	56                   	push   %esi
+  801ee7:	53                   	push   %ebx
+  801ee8:	6a 00                	push   $0x0
+  801eea:	e8 ee 2f 00 00       	call   804edd <ipc_recv_pages>
+}
+  801eef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ef2:	5b                   	pop    %ebx
+  801ef3:	5e                   	pop    %esi
+  801ef4:	5f                   	pop    %edi
+  801ef5:	5d                   	pop    %ebp
+  801ef6:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ef7:	83 ec 0c             	sub    $0xc,%esp
+  801efa:	6a 01                	push   $0x1
+  801efc:	e8 1f 32 00 00       	call   805120 <ipc_find_env>
+  801f01:	a3 00 80 80 00       	mov    %eax,0x808000
+  801f06:	83 c4 10             	add    $0x10,%esp
+  801f09:	eb bf                	jmp    801eca <fsipc_pages+0x18>
+
+00801f0b <fsipc>:
+{
+  801f0b:	55                   	push   %ebp
+  801f0c:	89 e5                	mov    %esp,%ebp
+  801f0e:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801f11:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f16:	e8 97 ff ff ff       	call   801eb2 <fsipc_pages>
+}
+  801f1b:	c9                   	leave
+  801f1c:	c3                   	ret
+
+00801f1d <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801f1d:	55                   	push   %ebp
+  801f1e:	89 e5                	mov    %esp,%ebp
+  801f20:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f23:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f26:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f29:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.set_size.req_size = newsize;
+  801f2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f31:	a3 04 00 81 00       	mov    %eax,0x810004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801f36:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f40:	e8 c6 ff ff ff       	call   801f0b <fsipc>
+}
+  801f45:	c9                   	leave
+  801f46:	c3                   	ret
+
+00801f47 <devfile_flush>:
+{
+  801f47:	55                   	push   %ebp
+  801f48:	89 e5                	mov    %esp,%ebp
+  801f4a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f50:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f53:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801f58:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f5d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f62:	e8 a4 ff ff ff       	call   801f0b <fsipc>
+}
+  801f67:	c9                   	leave
+  801f68:	c3                   	ret
+
+00801f69 <devfile_stat>:
+{
+  801f69:	55                   	push   %ebp
+  801f6a:	89 e5                	mov    %esp,%ebp
+  801f6c:	53                   	push   %ebx
+  801f6d:	83 ec 04             	sub    $0x4,%esp
+  801f70:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f73:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f76:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f79:	a3 00 00 81 00       	mov    %eax,0x810000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f83:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f88:	e8 7e ff ff ff       	call   801f0b <fsipc>
+  801f8d:	85 c0                	test   %eax,%eax
+  801f8f:	78 2c                	js     801fbd <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f91:	83 ec 08             	sub    $0x8,%esp
+  801f94:	68 00 00 81 00       	push   $0x810000
+  801f99:	53                   	push   %ebx
+  801f9a:	e8 4b e9 ff ff       	call   8008ea <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f9f:	a1 80 00 81 00       	mov    0x810080,%eax
+  801fa4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801faa:	a1 84 00 81 00       	mov    0x810084,%eax
+  801faf:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801fb5:	83 c4 10             	add    $0x10,%esp
+  801fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fc0:	c9                   	leave
+  801fc1:	c3                   	ret
+
+00801fc2 <devfile_write>:
+{
+  801fc2:	55                   	push   %ebp
+  801fc3:	89 e5                	mov    %esp,%ebp
+  801fc5:	83 ec 0c             	sub    $0xc,%esp
+  801fc8:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801fcb:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801fd0:	39 d0                	cmp    %edx,%eax
+  801fd2:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fd5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fd8:	8b 52 0c             	mov    0xc(%edx),%edx
+  801fdb:	89 15 00 00 81 00    	mov    %edx,0x810000
+	fsipcbuf.write.req_n = n;
+  801fe1:	a3 04 00 81 00       	mov    %eax,0x810004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801fe6:	50                   	push   %eax
+  801fe7:	ff 75 0c             	push   0xc(%ebp)
+  801fea:	68 08 00 81 00       	push   $0x810008
+  801fef:	e8 7c ea ff ff       	call   800a70 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801ff4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff9:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ffe:	e8 08 ff ff ff       	call   801f0b <fsipc>
+}
+  802003:	c9                   	leave
+  802004:	c3                   	ret
+
+00802005 <devfile_read>:
+{
+  802005:	55                   	push   %ebp
+  802006:	89 e5                	mov    %esp,%ebp
+  802008:	57                   	push   %edi
+  802009:	56                   	push   %esi
+  80200a:	53                   	push   %ebx
+  80200b:	83 ec 1c             	sub    $0x1c,%esp
+  80200e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802011:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802014:	89 fe                	mov    %edi,%esi
+  802016:	c1 ee 0c             	shr    $0xc,%esi
+  802019:	b8 20 00 00 00       	mov    $0x20,%eax
+  80201e:	39 c6                	cmp    %eax,%esi
+  802020:	0f 47 f0             	cmova  %eax,%esi
+  802023:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802026:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80202b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80202e:	eb 14                	jmp    802044 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802030:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  802037:	05 00 10 00 00       	add    $0x1000,%eax
+  80203c:	f6 c6 06             	test   $0x6,%dh
+  80203f:	75 42                	jne    802083 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802041:	83 c1 01             	add    $0x1,%ecx
+  802044:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802047:	39 f1                	cmp    %esi,%ecx
+  802049:	0f 84 95 00 00 00    	je     8020e4 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  80204f:	89 c2                	mov    %eax,%edx
+  802051:	c1 ea 16             	shr    $0x16,%edx
+  802054:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  80205b:	f6 c2 01             	test   $0x1,%dl
+  80205e:	74 23                	je     802083 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  802060:	89 c2                	mov    %eax,%edx
+  802062:	c1 ea 0c             	shr    $0xc,%edx
+  802065:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  80206c:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  802072:	74 0f                	je     802083 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  802074:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  80207b:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  802081:	75 ad                	jne    802030 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  802083:	85 c9                	test   %ecx,%ecx
+  802085:	74 11                	je     802098 <devfile_read+0x93>
+  802087:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80208e:	75 08                	jne    802098 <devfile_read+0x93>
+  802090:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  802096:	74 50                	je     8020e8 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802098:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80209b:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.read.req_n = n;
+  8020a0:	89 3d 04 00 81 00    	mov    %edi,0x810004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8020a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ab:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020b0:	e8 56 fe ff ff       	call   801f0b <fsipc>
+  8020b5:	89 c6                	mov    %eax,%esi
+  8020b7:	85 c0                	test   %eax,%eax
+  8020b9:	78 1f                	js     8020da <devfile_read+0xd5>
+	assert(r <= n);
+  8020bb:	39 c7                	cmp    %eax,%edi
+  8020bd:	72 50                	jb     80210f <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  8020bf:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8020c4:	7f 62                	jg     802128 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  8020c6:	83 ec 04             	sub    $0x4,%esp
+  8020c9:	50                   	push   %eax
+  8020ca:	68 00 00 81 00       	push   $0x810000
+  8020cf:	ff 75 0c             	push   0xc(%ebp)
+  8020d2:	e8 99 e9 ff ff       	call   800a70 <memmove>
+	return r;
+  8020d7:	83 c4 10             	add    $0x10,%esp
+}
+  8020da:	89 f0                	mov    %esi,%eax
+  8020dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020df:	5b                   	pop    %ebx
+  8020e0:	5e                   	pop    %esi
+  8020e1:	5f                   	pop    %edi
+  8020e2:	5d                   	pop    %ebp
+  8020e3:	c3                   	ret
+  8020e4:	89 f1                	mov    %esi,%ecx
+  8020e6:	eb 9b                	jmp    802083 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  8020e8:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8020eb:	a3 00 00 81 00       	mov    %eax,0x810000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  8020f0:	89 c8                	mov    %ecx,%eax
+  8020f2:	c1 e0 0c             	shl    $0xc,%eax
+  8020f5:	a3 04 00 81 00       	mov    %eax,0x810004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  8020fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020fd:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802102:	e8 ab fd ff ff       	call   801eb2 <fsipc_pages>
+  802107:	89 c6                	mov    %eax,%esi
+  802109:	85 c0                	test   %eax,%eax
+  80210b:	78 8b                	js     802098 <devfile_read+0x93>
+  80210d:	eb cb                	jmp    8020da <devfile_read+0xd5>
+	assert(r <= n);
+  80210f:	68 d4 59 80 00       	push   $0x8059d4
+  802114:	68 0b 54 80 00       	push   $0x80540b
+  802119:	68 a0 00 00 00       	push   $0xa0
+  80211e:	68 db 59 80 00       	push   $0x8059db
+  802123:	e8 00 e1 ff ff       	call   800228 <_panic>
+	assert(r <= PGSIZE);
+  802128:	68 e6 59 80 00       	push   $0x8059e6
+  80212d:	68 0b 54 80 00       	push   $0x80540b
+  802132:	68 a1 00 00 00       	push   $0xa1
+  802137:	68 db 59 80 00       	push   $0x8059db
+  80213c:	e8 e7 e0 ff ff       	call   800228 <_panic>
+
+00802141 <open>:
+{
+  802141:	55                   	push   %ebp
+  802142:	89 e5                	mov    %esp,%ebp
+  802144:	56                   	push   %esi
+  802145:	53                   	push   %ebx
+  802146:	83 ec 1c             	sub    $0x1c,%esp
+  802149:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80214c:	56                   	push   %esi
+  80214d:	e8 5d e7 ff ff       	call   8008af <strlen>
+  802152:	83 c4 10             	add    $0x10,%esp
+  802155:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80215a:	7f 6c                	jg     8021c8 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  80215c:	83 ec 0c             	sub    $0xc,%esp
+  80215f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802162:	50                   	push   %eax
+  802163:	e8 eb f7 ff ff       	call   801953 <fd_alloc>
+  802168:	89 c3                	mov    %eax,%ebx
+  80216a:	83 c4 10             	add    $0x10,%esp
+  80216d:	85 c0                	test   %eax,%eax
+  80216f:	78 3c                	js     8021ad <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802171:	83 ec 08             	sub    $0x8,%esp
+  802174:	56                   	push   %esi
+  802175:	68 00 00 81 00       	push   $0x810000
+  80217a:	e8 6b e7 ff ff       	call   8008ea <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80217f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802182:	a3 00 04 81 00       	mov    %eax,0x810400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802187:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80218a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80218f:	e8 77 fd ff ff       	call   801f0b <fsipc>
+  802194:	89 c3                	mov    %eax,%ebx
+  802196:	83 c4 10             	add    $0x10,%esp
+  802199:	85 c0                	test   %eax,%eax
+  80219b:	78 19                	js     8021b6 <open+0x75>
+	return fd2num(fd);
+  80219d:	83 ec 0c             	sub    $0xc,%esp
+  8021a0:	ff 75 f4             	push   -0xc(%ebp)
+  8021a3:	e8 84 f7 ff ff       	call   80192c <fd2num>
+  8021a8:	89 c3                	mov    %eax,%ebx
+  8021aa:	83 c4 10             	add    $0x10,%esp
+}
+  8021ad:	89 d8                	mov    %ebx,%eax
+  8021af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b2:	5b                   	pop    %ebx
+  8021b3:	5e                   	pop    %esi
+  8021b4:	5d                   	pop    %ebp
+  8021b5:	c3                   	ret
+		fd_close(fd, 0);
+  8021b6:	83 ec 08             	sub    $0x8,%esp
+  8021b9:	6a 00                	push   $0x0
+  8021bb:	ff 75 f4             	push   -0xc(%ebp)
+  8021be:	e8 80 f8 ff ff       	call   801a43 <fd_close>
+		return r;
+  8021c3:	83 c4 10             	add    $0x10,%esp
+  8021c6:	eb e5                	jmp    8021ad <open+0x6c>
+		return -E_BAD_PATH;
+  8021c8:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021cd:	eb de                	jmp    8021ad <open+0x6c>
+
+008021cf <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8021cf:	55                   	push   %ebp
+  8021d0:	89 e5                	mov    %esp,%ebp
+  8021d2:	53                   	push   %ebx
+  8021d3:	83 ec 10             	sub    $0x10,%esp
+  8021d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8021d9:	53                   	push   %ebx
+  8021da:	e8 d0 e6 ff ff       	call   8008af <strlen>
+  8021df:	83 c4 10             	add    $0x10,%esp
+  8021e2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021e7:	7f 25                	jg     80220e <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8021e9:	83 ec 08             	sub    $0x8,%esp
+  8021ec:	53                   	push   %ebx
+  8021ed:	68 00 00 81 00       	push   $0x810000
+  8021f2:	e8 f3 e6 ff ff       	call   8008ea <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8021f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021fc:	b8 07 00 00 00       	mov    $0x7,%eax
+  802201:	e8 05 fd ff ff       	call   801f0b <fsipc>
+  802206:	83 c4 10             	add    $0x10,%esp
+}
+  802209:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80220c:	c9                   	leave
+  80220d:	c3                   	ret
+		return -E_BAD_PATH;
+  80220e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802213:	eb f4                	jmp    802209 <remove+0x3a>
+
+00802215 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802215:	55                   	push   %ebp
+  802216:	89 e5                	mov    %esp,%ebp
+  802218:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80221b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802220:	b8 08 00 00 00       	mov    $0x8,%eax
+  802225:	e8 e1 fc ff ff       	call   801f0b <fsipc>
+}
+  80222a:	c9                   	leave
+  80222b:	c3                   	ret
+
+0080222c <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  80222c:	55                   	push   %ebp
+  80222d:	89 e5                	mov    %esp,%ebp
+  80222f:	53                   	push   %ebx
+  802230:	83 ec 04             	sub    $0x4,%esp
+  802233:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  802236:	ba 00 00 00 00       	mov    $0x0,%edx
+  80223b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802240:	e8 c6 fc ff ff       	call   801f0b <fsipc>
+  802245:	85 c0                	test   %eax,%eax
+  802247:	78 3c                	js     802285 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  802249:	a1 00 00 81 00       	mov    0x810000,%eax
+  80224e:	89 03                	mov    %eax,(%ebx)
+  802250:	a1 04 00 81 00       	mov    0x810004,%eax
+  802255:	89 43 04             	mov    %eax,0x4(%ebx)
+  802258:	a1 08 00 81 00       	mov    0x810008,%eax
+  80225d:	89 43 08             	mov    %eax,0x8(%ebx)
+  802260:	a1 0c 00 81 00       	mov    0x81000c,%eax
+  802265:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802268:	a1 10 00 81 00       	mov    0x810010,%eax
+  80226d:	89 43 10             	mov    %eax,0x10(%ebx)
+  802270:	a1 14 00 81 00       	mov    0x810014,%eax
+  802275:	89 43 14             	mov    %eax,0x14(%ebx)
+  802278:	a1 18 00 81 00       	mov    0x810018,%eax
+  80227d:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  802280:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802288:	c9                   	leave
+  802289:	c3                   	ret
+
+0080228a <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  80228a:	55                   	push   %ebp
+  80228b:	89 e5                	mov    %esp,%ebp
+  80228d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  802290:	8b 45 08             	mov    0x8(%ebp),%eax
+  802293:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_BCSET, NULL);
+  802298:	ba 00 00 00 00       	mov    $0x0,%edx
+  80229d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8022a2:	e8 64 fc ff ff       	call   801f0b <fsipc>
+}
+  8022a7:	c9                   	leave
+  8022a8:	c3                   	ret
+
+008022a9 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8022a9:	55                   	push   %ebp
+  8022aa:	89 e5                	mov    %esp,%ebp
+  8022ac:	56                   	push   %esi
+  8022ad:	53                   	push   %ebx
+  8022ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8022b1:	83 ec 0c             	sub    $0xc,%esp
+  8022b4:	ff 75 08             	push   0x8(%ebp)
+  8022b7:	e8 80 f6 ff ff       	call   80193c <fd2data>
+  8022bc:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8022be:	83 c4 08             	add    $0x8,%esp
+  8022c1:	68 f2 59 80 00       	push   $0x8059f2
+  8022c6:	53                   	push   %ebx
+  8022c7:	e8 1e e6 ff ff       	call   8008ea <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8022cc:	8b 46 04             	mov    0x4(%esi),%eax
+  8022cf:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8022d5:	2b 0e                	sub    (%esi),%ecx
+  8022d7:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8022dc:	89 c8                	mov    %ecx,%eax
+  8022de:	f7 e2                	mul    %edx
+  8022e0:	c1 ea 0c             	shr    $0xc,%edx
+  8022e3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022e9:	29 d1                	sub    %edx,%ecx
+  8022eb:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8022f1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8022f8:	00 00 00 
+	stat->st_dev = &devpipe;
+  8022fb:	c7 83 88 00 00 00 20 	movl   $0x807020,0x88(%ebx)
+  802302:	70 80 00 
+	return 0;
+}
+  802305:	b8 00 00 00 00       	mov    $0x0,%eax
+  80230a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80230d:	5b                   	pop    %ebx
+  80230e:	5e                   	pop    %esi
+  80230f:	5d                   	pop    %ebp
+  802310:	c3                   	ret
+
+00802311 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802311:	55                   	push   %ebp
+  802312:	89 e5                	mov    %esp,%ebp
+  802314:	53                   	push   %ebx
+  802315:	83 ec 0c             	sub    $0xc,%esp
+  802318:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80231b:	53                   	push   %ebx
+  80231c:	6a 00                	push   $0x0
+  80231e:	e8 3f eb ff ff       	call   800e62 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802323:	89 1c 24             	mov    %ebx,(%esp)
+  802326:	e8 11 f6 ff ff       	call   80193c <fd2data>
+  80232b:	83 c4 08             	add    $0x8,%esp
+  80232e:	50                   	push   %eax
+  80232f:	6a 00                	push   $0x0
+  802331:	e8 2c eb ff ff       	call   800e62 <sys_page_unmap>
+}
+  802336:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802339:	c9                   	leave
+  80233a:	c3                   	ret
+
+0080233b <_pipeisclosed>:
+{
+  80233b:	55                   	push   %ebp
+  80233c:	89 e5                	mov    %esp,%ebp
+  80233e:	57                   	push   %edi
+  80233f:	56                   	push   %esi
+  802340:	53                   	push   %ebx
+  802341:	83 ec 1c             	sub    $0x1c,%esp
+  802344:	89 c7                	mov    %eax,%edi
+  802346:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802348:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80234d:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802350:	83 ec 0c             	sub    $0xc,%esp
+  802353:	57                   	push   %edi
+  802354:	e8 06 2e 00 00       	call   80515f <pageref>
+  802359:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80235c:	89 34 24             	mov    %esi,(%esp)
+  80235f:	e8 fb 2d 00 00       	call   80515f <pageref>
+		nn = thisenv->env_runs;
+  802364:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  80236a:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80236d:	83 c4 10             	add    $0x10,%esp
+  802370:	39 cb                	cmp    %ecx,%ebx
+  802372:	74 1b                	je     80238f <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802374:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802377:	75 cf                	jne    802348 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802379:	8b 42 58             	mov    0x58(%edx),%eax
+  80237c:	6a 01                	push   $0x1
+  80237e:	50                   	push   %eax
+  80237f:	53                   	push   %ebx
+  802380:	68 f9 59 80 00       	push   $0x8059f9
+  802385:	e8 79 df ff ff       	call   800303 <cprintf>
+  80238a:	83 c4 10             	add    $0x10,%esp
+  80238d:	eb b9                	jmp    802348 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80238f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802392:	0f 94 c0             	sete   %al
+  802395:	0f b6 c0             	movzbl %al,%eax
+}
+  802398:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80239b:	5b                   	pop    %ebx
+  80239c:	5e                   	pop    %esi
+  80239d:	5f                   	pop    %edi
+  80239e:	5d                   	pop    %ebp
+  80239f:	c3                   	ret
+
+008023a0 <devpipe_read>:
+{
+  8023a0:	55                   	push   %ebp
+  8023a1:	89 e5                	mov    %esp,%ebp
+  8023a3:	57                   	push   %edi
+  8023a4:	56                   	push   %esi
+  8023a5:	53                   	push   %ebx
+  8023a6:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8023a9:	ff 75 08             	push   0x8(%ebp)
+  8023ac:	e8 8b f5 ff ff       	call   80193c <fd2data>
+  8023b1:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8023b3:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8023b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8023b9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8023bc:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8023bf:	8b 0b                	mov    (%ebx),%ecx
+  8023c1:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8023c7:	29 ce                	sub    %ecx,%esi
+  8023c9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8023ce:	f7 e6                	mul    %esi
+  8023d0:	c1 ea 0c             	shr    $0xc,%edx
+  8023d3:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8023d9:	29 c6                	sub    %eax,%esi
+  8023db:	89 f2                	mov    %esi,%edx
+  8023dd:	75 43                	jne    802422 <devpipe_read+0x82>
+		ref = pageref(p);
+  8023df:	83 ec 0c             	sub    $0xc,%esp
+  8023e2:	53                   	push   %ebx
+  8023e3:	e8 77 2d 00 00       	call   80515f <pageref>
+  8023e8:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8023ea:	89 da                	mov    %ebx,%edx
+  8023ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ef:	e8 47 ff ff ff       	call   80233b <_pipeisclosed>
+  8023f4:	83 c4 10             	add    $0x10,%esp
+  8023f7:	85 c0                	test   %eax,%eax
+  8023f9:	0f 85 c1 00 00 00    	jne    8024c0 <devpipe_read+0x120>
+	*sleeping = 1;
+  8023ff:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  802406:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80240b:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  80240e:	75 ac                	jne    8023bc <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  802410:	83 ec 04             	sub    $0x4,%esp
+  802413:	56                   	push   %esi
+  802414:	57                   	push   %edi
+  802415:	ff 75 e4             	push   -0x1c(%ebp)
+  802418:	e8 99 ee ff ff       	call   8012b6 <sys_futex_wait>
+  80241d:	83 c4 10             	add    $0x10,%esp
+  802420:	eb 9a                	jmp    8023bc <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  802422:	39 75 10             	cmp    %esi,0x10(%ebp)
+  802425:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  802429:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80242b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802430:	f7 e1                	mul    %ecx
+  802432:	c1 ea 0b             	shr    $0xb,%edx
+  802435:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80243b:	29 c1                	sub    %eax,%ecx
+  80243d:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  80243f:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802444:	29 cf                	sub    %ecx,%edi
+  802446:	39 f7                	cmp    %esi,%edi
+  802448:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  80244b:	8d 43 10             	lea    0x10(%ebx),%eax
+  80244e:	83 ec 04             	sub    $0x4,%esp
+  802451:	57                   	push   %edi
+  802452:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802455:	01 c2                	add    %eax,%edx
+  802457:	52                   	push   %edx
+  802458:	ff 75 0c             	push   0xc(%ebp)
+  80245b:	e8 10 e6 ff ff       	call   800a70 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  802460:	83 c4 0c             	add    $0xc,%esp
+  802463:	89 f1                	mov    %esi,%ecx
+  802465:	29 f9                	sub    %edi,%ecx
+  802467:	51                   	push   %ecx
+  802468:	ff 75 e4             	push   -0x1c(%ebp)
+  80246b:	89 f8                	mov    %edi,%eax
+  80246d:	03 45 0c             	add    0xc(%ebp),%eax
+  802470:	50                   	push   %eax
+  802471:	e8 fa e5 ff ff       	call   800a70 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  802476:	89 f1                	mov    %esi,%ecx
+  802478:	03 0b                	add    (%ebx),%ecx
+  80247a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80247f:	f7 e1                	mul    %ecx
+  802481:	c1 ea 0c             	shr    $0xc,%edx
+  802484:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80248a:	29 d1                	sub    %edx,%ecx
+  80248c:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  80248e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802493:	83 c4 10             	add    $0x10,%esp
+  802496:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  80249a:	75 0a                	jne    8024a6 <devpipe_read+0x106>
+	return n;
+  80249c:	89 f0                	mov    %esi,%eax
+}
+  80249e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024a1:	5b                   	pop    %ebx
+  8024a2:	5e                   	pop    %esi
+  8024a3:	5f                   	pop    %edi
+  8024a4:	5d                   	pop    %ebp
+  8024a5:	c3                   	ret
+		*sleeping = 0;
+  8024a6:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8024ad:	83 ec 08             	sub    $0x8,%esp
+  8024b0:	68 00 04 00 00       	push   $0x400
+  8024b5:	53                   	push   %ebx
+  8024b6:	e8 4b ee ff ff       	call   801306 <sys_futex_wake>
+  8024bb:	83 c4 10             	add    $0x10,%esp
+  8024be:	eb dc                	jmp    80249c <devpipe_read+0xfc>
+			return 0;
+  8024c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c5:	eb d7                	jmp    80249e <devpipe_read+0xfe>
+
+008024c7 <devpipe_write>:
+{
+  8024c7:	55                   	push   %ebp
+  8024c8:	89 e5                	mov    %esp,%ebp
+  8024ca:	57                   	push   %edi
+  8024cb:	56                   	push   %esi
+  8024cc:	53                   	push   %ebx
+  8024cd:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8024d0:	ff 75 08             	push   0x8(%ebp)
+  8024d3:	e8 64 f4 ff ff       	call   80193c <fd2data>
+  8024d8:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8024da:	83 c4 10             	add    $0x10,%esp
+  8024dd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8024e4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024e7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8024ea:	0f 83 23 01 00 00    	jae    802613 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8024f0:	8b 77 04             	mov    0x4(%edi),%esi
+  8024f3:	8b 1f                	mov    (%edi),%ebx
+  8024f5:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  8024fb:	29 d9                	sub    %ebx,%ecx
+  8024fd:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802502:	f7 e1                	mul    %ecx
+  802504:	c1 ea 0c             	shr    $0xc,%edx
+  802507:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80250d:	29 c1                	sub    %eax,%ecx
+  80250f:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802511:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802517:	75 40                	jne    802559 <devpipe_write+0x92>
+			ref = pageref(p);
+  802519:	83 ec 0c             	sub    $0xc,%esp
+  80251c:	57                   	push   %edi
+  80251d:	e8 3d 2c 00 00       	call   80515f <pageref>
+  802522:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  802524:	89 fa                	mov    %edi,%edx
+  802526:	8b 45 08             	mov    0x8(%ebp),%eax
+  802529:	e8 0d fe ff ff       	call   80233b <_pipeisclosed>
+  80252e:	83 c4 10             	add    $0x10,%esp
+  802531:	85 c0                	test   %eax,%eax
+  802533:	0f 85 d5 00 00 00    	jne    80260e <devpipe_write+0x147>
+	*sleeping = 1;
+  802539:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  802540:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802545:	39 1f                	cmp    %ebx,(%edi)
+  802547:	75 a7                	jne    8024f0 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  802549:	83 ec 04             	sub    $0x4,%esp
+  80254c:	56                   	push   %esi
+  80254d:	53                   	push   %ebx
+  80254e:	57                   	push   %edi
+  80254f:	e8 62 ed ff ff       	call   8012b6 <sys_futex_wait>
+  802554:	83 c4 10             	add    $0x10,%esp
+  802557:	eb 97                	jmp    8024f0 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802559:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80255c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80255f:	29 c1                	sub    %eax,%ecx
+  802561:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802566:	89 d8                	mov    %ebx,%eax
+  802568:	29 d0                	sub    %edx,%eax
+  80256a:	39 c1                	cmp    %eax,%ecx
+  80256c:	0f 46 c1             	cmovbe %ecx,%eax
+  80256f:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  802571:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802576:	f7 e6                	mul    %esi
+  802578:	c1 ea 0b             	shr    $0xb,%edx
+  80257b:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802581:	29 c6                	sub    %eax,%esi
+  802583:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802585:	29 f3                	sub    %esi,%ebx
+  802587:	39 cb                	cmp    %ecx,%ebx
+  802589:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80258c:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  80258f:	8d 77 10             	lea    0x10(%edi),%esi
+  802592:	83 ec 04             	sub    $0x4,%esp
+  802595:	53                   	push   %ebx
+  802596:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802599:	03 45 0c             	add    0xc(%ebp),%eax
+  80259c:	50                   	push   %eax
+  80259d:	01 f2                	add    %esi,%edx
+  80259f:	52                   	push   %edx
+  8025a0:	e8 cb e4 ff ff       	call   800a70 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8025a5:	83 c4 0c             	add    $0xc,%esp
+  8025a8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8025ab:	29 d8                	sub    %ebx,%eax
+  8025ad:	50                   	push   %eax
+  8025ae:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025b1:	01 d3                	add    %edx,%ebx
+  8025b3:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8025b6:	53                   	push   %ebx
+  8025b7:	56                   	push   %esi
+  8025b8:	e8 b3 e4 ff ff       	call   800a70 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8025bd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8025c0:	03 4f 04             	add    0x4(%edi),%ecx
+  8025c3:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8025c8:	f7 e1                	mul    %ecx
+  8025ca:	c1 ea 0c             	shr    $0xc,%edx
+  8025cd:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8025d3:	29 d1                	sub    %edx,%ecx
+  8025d5:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8025d8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8025dd:	83 c4 10             	add    $0x10,%esp
+  8025e0:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8025e4:	75 0b                	jne    8025f1 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8025e6:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8025e9:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8025ec:	e9 f3 fe ff ff       	jmp    8024e4 <devpipe_write+0x1d>
+		*sleeping = 0;
+  8025f1:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8025f8:	83 ec 08             	sub    $0x8,%esp
+  8025fb:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802600:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802603:	50                   	push   %eax
+  802604:	e8 fd ec ff ff       	call   801306 <sys_futex_wake>
+  802609:	83 c4 10             	add    $0x10,%esp
+  80260c:	eb d8                	jmp    8025e6 <devpipe_write+0x11f>
+				return 0;
+  80260e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802613:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802616:	5b                   	pop    %ebx
+  802617:	5e                   	pop    %esi
+  802618:	5f                   	pop    %edi
+  802619:	5d                   	pop    %ebp
+  80261a:	c3                   	ret
+
+0080261b <pipe>:
+{
+  80261b:	55                   	push   %ebp
+  80261c:	89 e5                	mov    %esp,%ebp
+  80261e:	56                   	push   %esi
+  80261f:	53                   	push   %ebx
+  802620:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802623:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802626:	50                   	push   %eax
+  802627:	e8 27 f3 ff ff       	call   801953 <fd_alloc>
+  80262c:	89 c3                	mov    %eax,%ebx
+  80262e:	83 c4 10             	add    $0x10,%esp
+  802631:	85 c0                	test   %eax,%eax
+  802633:	0f 88 23 01 00 00    	js     80275c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802639:	83 ec 04             	sub    $0x4,%esp
+  80263c:	68 07 04 00 00       	push   $0x407
+  802641:	ff 75 f4             	push   -0xc(%ebp)
+  802644:	6a 00                	push   $0x0
+  802646:	e8 92 e7 ff ff       	call   800ddd <sys_page_alloc>
+  80264b:	89 c3                	mov    %eax,%ebx
+  80264d:	83 c4 10             	add    $0x10,%esp
+  802650:	85 c0                	test   %eax,%eax
+  802652:	0f 88 04 01 00 00    	js     80275c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802658:	83 ec 0c             	sub    $0xc,%esp
+  80265b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80265e:	50                   	push   %eax
+  80265f:	e8 ef f2 ff ff       	call   801953 <fd_alloc>
+  802664:	89 c3                	mov    %eax,%ebx
+  802666:	83 c4 10             	add    $0x10,%esp
+  802669:	85 c0                	test   %eax,%eax
+  80266b:	0f 88 db 00 00 00    	js     80274c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802671:	83 ec 04             	sub    $0x4,%esp
+  802674:	68 07 04 00 00       	push   $0x407
+  802679:	ff 75 f0             	push   -0x10(%ebp)
+  80267c:	6a 00                	push   $0x0
+  80267e:	e8 5a e7 ff ff       	call   800ddd <sys_page_alloc>
+  802683:	89 c3                	mov    %eax,%ebx
+  802685:	83 c4 10             	add    $0x10,%esp
+  802688:	85 c0                	test   %eax,%eax
+  80268a:	0f 88 bc 00 00 00    	js     80274c <pipe+0x131>
+	va = fd2data(fd0);
+  802690:	83 ec 0c             	sub    $0xc,%esp
+  802693:	ff 75 f4             	push   -0xc(%ebp)
+  802696:	e8 a1 f2 ff ff       	call   80193c <fd2data>
+  80269b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80269d:	83 c4 0c             	add    $0xc,%esp
+  8026a0:	68 07 04 00 00       	push   $0x407
+  8026a5:	50                   	push   %eax
+  8026a6:	6a 00                	push   $0x0
+  8026a8:	e8 30 e7 ff ff       	call   800ddd <sys_page_alloc>
+  8026ad:	89 c3                	mov    %eax,%ebx
+  8026af:	83 c4 10             	add    $0x10,%esp
+  8026b2:	85 c0                	test   %eax,%eax
+  8026b4:	0f 88 82 00 00 00    	js     80273c <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026ba:	83 ec 0c             	sub    $0xc,%esp
+  8026bd:	ff 75 f0             	push   -0x10(%ebp)
+  8026c0:	e8 77 f2 ff ff       	call   80193c <fd2data>
+  8026c5:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8026cc:	50                   	push   %eax
+  8026cd:	6a 00                	push   $0x0
+  8026cf:	56                   	push   %esi
+  8026d0:	6a 00                	push   $0x0
+  8026d2:	e8 49 e7 ff ff       	call   800e20 <sys_page_map>
+  8026d7:	89 c3                	mov    %eax,%ebx
+  8026d9:	83 c4 20             	add    $0x20,%esp
+  8026dc:	85 c0                	test   %eax,%eax
+  8026de:	78 4e                	js     80272e <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8026e0:	a1 20 70 80 00       	mov    0x807020,%eax
+  8026e5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026e8:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8026ea:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026ed:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8026f4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8026f7:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8026f9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8026fc:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802703:	83 ec 0c             	sub    $0xc,%esp
+  802706:	ff 75 f4             	push   -0xc(%ebp)
+  802709:	e8 1e f2 ff ff       	call   80192c <fd2num>
+  80270e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802711:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802713:	83 c4 04             	add    $0x4,%esp
+  802716:	ff 75 f0             	push   -0x10(%ebp)
+  802719:	e8 0e f2 ff ff       	call   80192c <fd2num>
+  80271e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802721:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802724:	83 c4 10             	add    $0x10,%esp
+  802727:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80272c:	eb 2e                	jmp    80275c <pipe+0x141>
+	sys_page_unmap(0, va);
+  80272e:	83 ec 08             	sub    $0x8,%esp
+  802731:	56                   	push   %esi
+  802732:	6a 00                	push   $0x0
+  802734:	e8 29 e7 ff ff       	call   800e62 <sys_page_unmap>
+  802739:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80273c:	83 ec 08             	sub    $0x8,%esp
+  80273f:	ff 75 f0             	push   -0x10(%ebp)
+  802742:	6a 00                	push   $0x0
+  802744:	e8 19 e7 ff ff       	call   800e62 <sys_page_unmap>
+  802749:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80274c:	83 ec 08             	sub    $0x8,%esp
+  80274f:	ff 75 f4             	push   -0xc(%ebp)
+  802752:	6a 00                	push   $0x0
+  802754:	e8 09 e7 ff ff       	call   800e62 <sys_page_unmap>
+  802759:	83 c4 10             	add    $0x10,%esp
+}
+  80275c:	89 d8                	mov    %ebx,%eax
+  80275e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802761:	5b                   	pop    %ebx
+  802762:	5e                   	pop    %esi
+  802763:	5d                   	pop    %ebp
+  802764:	c3                   	ret
+
+00802765 <pipeisclosed>:
+{
+  802765:	55                   	push   %ebp
+  802766:	89 e5                	mov    %esp,%ebp
+  802768:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80276b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80276e:	50                   	push   %eax
+  80276f:	ff 75 08             	push   0x8(%ebp)
+  802772:	e8 30 f2 ff ff       	call   8019a7 <fd_lookup>
+  802777:	83 c4 10             	add    $0x10,%esp
+  80277a:	85 c0                	test   %eax,%eax
+  80277c:	78 18                	js     802796 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80277e:	83 ec 0c             	sub    $0xc,%esp
+  802781:	ff 75 f4             	push   -0xc(%ebp)
+  802784:	e8 b3 f1 ff ff       	call   80193c <fd2data>
+  802789:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80278b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80278e:	e8 a8 fb ff ff       	call   80233b <_pipeisclosed>
+  802793:	83 c4 10             	add    $0x10,%esp
+}
+  802796:	c9                   	leave
+  802797:	c3                   	ret
+
+00802798 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802798:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  80279a:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  8027a0:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  8027a6:	81 c2 34 01 00 00    	add    $0x134,%edx
+  8027ac:	39 d0                	cmp    %edx,%eax
+  8027ae:	74 2e                	je     8027de <segment_lookup+0x46>
+{
+  8027b0:	55                   	push   %ebp
+  8027b1:	89 e5                	mov    %esp,%ebp
+  8027b3:	57                   	push   %edi
+  8027b4:	56                   	push   %esi
+  8027b5:	53                   	push   %ebx
+  8027b6:	eb 07                	jmp    8027bf <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8027b8:	83 c0 20             	add    $0x20,%eax
+  8027bb:	39 d0                	cmp    %edx,%eax
+  8027bd:	74 15                	je     8027d4 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  8027bf:	8b 18                	mov    (%eax),%ebx
+  8027c1:	39 d9                	cmp    %ebx,%ecx
+  8027c3:	72 f3                	jb     8027b8 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  8027c5:	8b 38                	mov    (%eax),%edi
+  8027c7:	8b 58 04             	mov    0x4(%eax),%ebx
+  8027ca:	89 ce                	mov    %ecx,%esi
+  8027cc:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  8027ce:	39 de                	cmp    %ebx,%esi
+  8027d0:	73 e6                	jae    8027b8 <segment_lookup+0x20>
+  8027d2:	eb 05                	jmp    8027d9 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  8027d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027d9:	5b                   	pop    %ebx
+  8027da:	5e                   	pop    %esi
+  8027db:	5f                   	pop    %edi
+  8027dc:	5d                   	pop    %ebp
+  8027dd:	c3                   	ret
+	return NULL;
+  8027de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027e3:	c3                   	ret
+
+008027e4 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  8027e4:	55                   	push   %ebp
+  8027e5:	89 e5                	mov    %esp,%ebp
+  8027e7:	53                   	push   %ebx
+  8027e8:	83 ec 04             	sub    $0x4,%esp
+  8027eb:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8027ed:	c1 e8 16             	shr    $0x16,%eax
+  8027f0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8027f7:	25 81 00 00 00       	and    $0x81,%eax
+  8027fc:	83 f8 01             	cmp    $0x1,%eax
+  8027ff:	75 6b                	jne    80286c <page_is_clean+0x88>
+  802801:	89 da                	mov    %ebx,%edx
+  802803:	c1 ea 0c             	shr    $0xc,%edx
+  802806:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  80280d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802812:	f6 c1 01             	test   $0x1,%cl
+  802815:	74 5a                	je     802871 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802817:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80281e:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802824:	75 4b                	jne    802871 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  802826:	89 d8                	mov    %ebx,%eax
+  802828:	e8 6b ff ff ff       	call   802798 <segment_lookup>
+  80282d:	89 c2                	mov    %eax,%edx
+		return 1;
+  80282f:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  802834:	85 d2                	test   %edx,%edx
+  802836:	75 39                	jne    802871 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  802838:	8b 15 0c c0 80 00    	mov    0x80c00c,%edx
+  80283e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802843:	eb 03                	jmp    802848 <page_is_clean+0x64>
+  802845:	83 c0 01             	add    $0x1,%eax
+  802848:	39 c2                	cmp    %eax,%edx
+  80284a:	7e 19                	jle    802865 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  80284c:	3b 1c c5 20 c0 80 00 	cmp    0x80c020(,%eax,8),%ebx
+  802853:	72 f0                	jb     802845 <page_is_clean+0x61>
+  802855:	3b 1c c5 24 c0 80 00 	cmp    0x80c024(,%eax,8),%ebx
+  80285c:	73 e7                	jae    802845 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  80285e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802863:	eb 0c                	jmp    802871 <page_is_clean+0x8d>
+	return 0;
+  802865:	b8 00 00 00 00       	mov    $0x0,%eax
+  80286a:	eb 05                	jmp    802871 <page_is_clean+0x8d>
+		return 0;
+  80286c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802871:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802874:	c9                   	leave
+  802875:	c3                   	ret
+
+00802876 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  802876:	55                   	push   %ebp
+  802877:	89 e5                	mov    %esp,%ebp
+  802879:	57                   	push   %edi
+  80287a:	56                   	push   %esi
+  80287b:	53                   	push   %ebx
+  80287c:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80287f:	be 00 00 00 00       	mov    $0x0,%esi
+  802884:	eb 19                	jmp    80289f <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802886:	f7 d3                	not    %ebx
+  802888:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80288e:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802890:	83 c6 01             	add    $0x1,%esi
+  802893:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802899:	0f 87 97 00 00 00    	ja     802936 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80289f:	89 f3                	mov    %esi,%ebx
+  8028a1:	03 1d 34 90 80 00    	add    0x809034,%ebx
+  8028a7:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8028ad:	89 d8                	mov    %ebx,%eax
+  8028af:	c1 e8 0a             	shr    $0xa,%eax
+  8028b2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8028b9:	25 81 00 00 00       	and    $0x81,%eax
+  8028be:	83 f8 01             	cmp    $0x1,%eax
+  8028c1:	75 c3                	jne    802886 <linear_walk+0x10>
+  8028c3:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8028c9:	77 bb                	ja     802886 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8028cb:	89 df                	mov    %ebx,%edi
+  8028cd:	c1 e7 0c             	shl    $0xc,%edi
+  8028d0:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8028d3:	89 f8                	mov    %edi,%eax
+  8028d5:	e8 0a ff ff ff       	call   8027e4 <page_is_clean>
+  8028da:	84 c0                	test   %al,%al
+  8028dc:	75 64                	jne    802942 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8028de:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  8028e4:	77 aa                	ja     802890 <linear_walk+0x1a>
+  8028e6:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  8028ec:	72 a2                	jb     802890 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8028ee:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8028f5:	a8 01                	test   $0x1,%al
+  8028f7:	74 97                	je     802890 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8028f9:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802900:	f6 c4 04             	test   $0x4,%ah
+  802903:	75 8b                	jne    802890 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802905:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80290c:	f6 c4 02             	test   $0x2,%ah
+  80290f:	0f 85 7b ff ff ff    	jne    802890 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802915:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80291c:	c1 e8 0c             	shr    $0xc,%eax
+  80291f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802922:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802927:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80292b:	66 83 f8 01          	cmp    $0x1,%ax
+  80292f:	76 11                	jbe    802942 <linear_walk+0xcc>
+  802931:	e9 5a ff ff ff       	jmp    802890 <linear_walk+0x1a>
+  802936:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  80293b:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802942:	89 1d 34 90 80 00    	mov    %ebx,0x809034
+}
+  802948:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80294b:	83 c4 1c             	add    $0x1c,%esp
+  80294e:	5b                   	pop    %ebx
+  80294f:	5e                   	pop    %esi
+  802950:	5f                   	pop    %edi
+  802951:	5d                   	pop    %ebp
+  802952:	c3                   	ret
+
+00802953 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802953:	55                   	push   %ebp
+  802954:	89 e5                	mov    %esp,%ebp
+  802956:	56                   	push   %esi
+  802957:	53                   	push   %ebx
+  802958:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  80295a:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80295f:	83 e0 7f             	and    $0x7f,%eax
+  802962:	c1 e0 04             	shl    $0x4,%eax
+  802965:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  80296b:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802971:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802977:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  80297d:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802982:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  802985:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80298a:	83 c0 01             	add    $0x1,%eax
+  80298d:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  802992:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802995:	5b                   	pop    %ebx
+  802996:	5e                   	pop    %esi
+  802997:	5d                   	pop    %ebp
+  802998:	c3                   	ret
+
+00802999 <page_ring_enter>:
+{
+  802999:	55                   	push   %ebp
+  80299a:	89 e5                	mov    %esp,%ebp
+  80299c:	57                   	push   %edi
+  80299d:	56                   	push   %esi
+  80299e:	53                   	push   %ebx
+  80299f:	83 ec 18             	sub    $0x18,%esp
+  8029a2:	89 c6                	mov    %eax,%esi
+  8029a4:	89 d7                	mov    %edx,%edi
+  8029a6:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  8029a8:	6a 00                	push   $0x0
+  8029aa:	6a 00                	push   $0x0
+  8029ac:	6a 00                	push   $0x0
+  8029ae:	6a 07                	push   $0x7
+  8029b0:	ff 35 40 c0 80 00    	push   0x80c040
+  8029b6:	e8 8e 26 00 00       	call   805049 <ipc_call>
+  8029bb:	83 c4 20             	add    $0x20,%esp
+  8029be:	85 c0                	test   %eax,%eax
+  8029c0:	79 22                	jns    8029e4 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  8029c2:	50                   	push   %eax
+  8029c3:	68 11 5a 80 00       	push   $0x805a11
+  8029c8:	68 13 02 00 00       	push   $0x213
+  8029cd:	68 25 5a 80 00       	push   $0x805a25
+  8029d2:	e8 51 d8 ff ff       	call   800228 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  8029d7:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8029dc:	83 c0 01             	add    $0x1,%eax
+  8029df:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  8029e4:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  8029ea:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  8029ef:	39 c2                	cmp    %eax,%edx
+  8029f1:	74 24                	je     802a17 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  8029f3:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8029f8:	83 e0 7f             	and    $0x7f,%eax
+  8029fb:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802a02:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802a09:	29 f0                	sub    %esi,%eax
+  802a0b:	39 d8                	cmp    %ebx,%eax
+  802a0d:	73 c8                	jae    8029d7 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802a0f:	8b 52 04             	mov    0x4(%edx),%edx
+  802a12:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802a15:	eb c0                	jmp    8029d7 <page_ring_enter+0x3e>
+}
+  802a17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a1a:	5b                   	pop    %ebx
+  802a1b:	5e                   	pop    %esi
+  802a1c:	5f                   	pop    %edi
+  802a1d:	5d                   	pop    %ebp
+  802a1e:	c3                   	ret
+
+00802a1f <page_ring_reserve>:
+{
+  802a1f:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802a21:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802a26:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802a2c:	29 d0                	sub    %edx,%eax
+  802a2e:	ba 80 00 00 00       	mov    $0x80,%edx
+  802a33:	29 ca                	sub    %ecx,%edx
+  802a35:	39 c2                	cmp    %eax,%edx
+  802a37:	72 01                	jb     802a3a <page_ring_reserve+0x1b>
+  802a39:	c3                   	ret
+{
+  802a3a:	55                   	push   %ebp
+  802a3b:	89 e5                	mov    %esp,%ebp
+  802a3d:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802a40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a45:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4f:	e8 45 ff ff ff       	call   802999 <page_ring_enter>
+}
+  802a54:	c9                   	leave
+  802a55:	c3                   	ret
+
+00802a56 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802a56:	55                   	push   %ebp
+  802a57:	89 e5                	mov    %esp,%ebp
+  802a59:	53                   	push   %ebx
+  802a5a:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802a5d:	6a 07                	push   $0x7
+  802a5f:	6a 01                	push   $0x1
+  802a61:	89 c3                	mov    %eax,%ebx
+  802a63:	c1 e3 0c             	shl    $0xc,%ebx
+  802a66:	8d 93 00 a0 80 00    	lea    0x80a000(%ebx),%edx
+  802a6c:	52                   	push   %edx
+  802a6d:	6a 04                	push   $0x4
+  802a6f:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  802a76:	e8 ce 25 00 00       	call   805049 <ipc_call>
+	sharereqs[i].nslots = 0;
+  802a7b:	c7 83 00 a0 80 00 00 	movl   $0x0,0x80a000(%ebx)
+  802a82:	00 00 00 
+	return r;
+}
+  802a85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a88:	c9                   	leave
+  802a89:	c3                   	ret
+
+00802a8a <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802a8a:	55                   	push   %ebp
+  802a8b:	89 e5                	mov    %esp,%ebp
+  802a8d:	56                   	push   %esi
+  802a8e:	53                   	push   %ebx
+  802a8f:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802a91:	c1 e8 10             	shr    $0x10,%eax
+  802a94:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802a97:	89 c2                	mov    %eax,%edx
+  802a99:	c1 e2 0c             	shl    $0xc,%edx
+  802a9c:	8b b2 00 a0 80 00    	mov    0x80a000(%edx),%esi
+  802aa2:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802aa5:	89 9a 00 a0 80 00    	mov    %ebx,0x80a000(%edx)
+  802aab:	89 c2                	mov    %eax,%edx
+  802aad:	c1 e2 0a             	shl    $0xa,%edx
+  802ab0:	01 f2                	add    %esi,%edx
+  802ab2:	89 0c 95 04 a0 80 00 	mov    %ecx,0x80a004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802ab9:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802abf:	74 09                	je     802aca <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ac6:	5b                   	pop    %ebx
+  802ac7:	5e                   	pop    %esi
+  802ac8:	5d                   	pop    %ebp
+  802ac9:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802aca:	e8 87 ff ff ff       	call   802a56 <page_share_send>
+  802acf:	eb f5                	jmp    802ac6 <page_share_slot+0x3c>
+
+00802ad1 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802ad1:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802ad6:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802ad9:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802ade:	3b 15 00 c0 80 00    	cmp    0x80c000,%edx
+  802ae4:	74 09                	je     802aef <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802ae6:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  802aeb:	85 c0                	test   %eax,%eax
+  802aed:	75 01                	jne    802af0 <page_ring_ready+0x1f>
+}
+  802aef:	c3                   	ret
+{
+  802af0:	55                   	push   %ebp
+  802af1:	89 e5                	mov    %esp,%ebp
+  802af3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802af6:	68 07 06 00 00       	push   $0x607
+  802afb:	6a 08                	push   $0x8
+  802afd:	68 00 30 ad de       	push   $0xdead3000
+  802b02:	6a 00                	push   $0x0
+  802b04:	e8 ff e3 ff ff       	call   800f08 <sys_page_alloc_range>
+  802b09:	83 c4 10             	add    $0x10,%esp
+  802b0c:	83 f8 08             	cmp    $0x8,%eax
+  802b0f:	74 1b                	je     802b2c <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802b11:	83 ec 04             	sub    $0x4,%esp
+  802b14:	6a 08                	push   $0x8
+  802b16:	68 00 30 ad de       	push   $0xdead3000
+  802b1b:	6a 00                	push   $0x0
+  802b1d:	e8 54 e4 ff ff       	call   800f76 <sys_page_unmap_range>
+		return 0;
+  802b22:	83 c4 10             	add    $0x10,%esp
+  802b25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b2a:	c9                   	leave
+  802b2b:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802b2c:	83 ec 0c             	sub    $0xc,%esp
+  802b2f:	68 07 04 00 00       	push   $0x407
+  802b34:	6a 08                	push   $0x8
+  802b36:	68 00 30 ad de       	push   $0xdead3000
+  802b3b:	6a 06                	push   $0x6
+  802b3d:	ff 35 40 c0 80 00    	push   0x80c040
+  802b43:	e8 01 25 00 00       	call   805049 <ipc_call>
+  802b48:	83 c4 20             	add    $0x20,%esp
+  802b4b:	85 c0                	test   %eax,%eax
+  802b4d:	78 14                	js     802b63 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802b4f:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802b54:	8b 40 48             	mov    0x48(%eax),%eax
+  802b57:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	return 1;
+  802b5c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b61:	eb c7                	jmp    802b2a <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802b63:	83 ec 04             	sub    $0x4,%esp
+  802b66:	6a 08                	push   $0x8
+  802b68:	68 00 30 ad de       	push   $0xdead3000
+  802b6d:	6a 00                	push   $0x0
+  802b6f:	e8 02 e4 ff ff       	call   800f76 <sys_page_unmap_range>
+		return 0;
+  802b74:	83 c4 10             	add    $0x10,%esp
+  802b77:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b7c:	eb ac                	jmp    802b2a <page_ring_ready+0x59>
+
+00802b7e <page_remove_slot>:
+{
+  802b7e:	55                   	push   %ebp
+  802b7f:	89 e5                	mov    %esp,%ebp
+  802b81:	56                   	push   %esi
+  802b82:	53                   	push   %ebx
+  802b83:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802b85:	89 c6                	mov    %eax,%esi
+  802b87:	c1 ee 10             	shr    $0x10,%esi
+  802b8a:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802b8d:	8b 04 b5 44 c0 80 00 	mov    0x80c044(,%esi,4),%eax
+  802b94:	39 05 40 c0 80 00    	cmp    %eax,0x80c040
+  802b9a:	74 2a                	je     802bc6 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802b9c:	83 ec 0c             	sub    $0xc,%esp
+  802b9f:	6a 00                	push   $0x0
+  802ba1:	6a 00                	push   $0x0
+  802ba3:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802ba5:	c1 e3 04             	shl    $0x4,%ebx
+  802ba8:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802bab:	53                   	push   %ebx
+  802bac:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  802bb3:	e8 91 24 00 00       	call   805049 <ipc_call>
+  802bb8:	83 c4 20             	add    $0x20,%esp
+  802bbb:	85 c0                	test   %eax,%eax
+  802bbd:	78 2d                	js     802bec <page_remove_slot+0x6e>
+}
+  802bbf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bc2:	5b                   	pop    %ebx
+  802bc3:	5e                   	pop    %esi
+  802bc4:	5d                   	pop    %ebp
+  802bc5:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802bc6:	e8 06 ff ff ff       	call   802ad1 <page_ring_ready>
+  802bcb:	85 c0                	test   %eax,%eax
+  802bcd:	74 cd                	je     802b9c <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802bcf:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bd4:	e8 46 fe ff ff       	call   802a1f <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802bd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bde:	89 da                	mov    %ebx,%edx
+  802be0:	b8 02 00 00 00       	mov    $0x2,%eax
+  802be5:	e8 69 fd ff ff       	call   802953 <page_ring_post>
+		return;
+  802bea:	eb d3                	jmp    802bbf <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802bec:	50                   	push   %eax
+  802bed:	68 80 5a 80 00       	push   $0x805a80
+  802bf2:	68 ac 03 00 00       	push   $0x3ac
+  802bf7:	68 25 5a 80 00       	push   $0x805a25
+  802bfc:	e8 27 d6 ff ff       	call   800228 <_panic>
+
+00802c01 <find_paging_env>:
+	if(pagingenv)
+  802c01:	a1 40 c0 80 00       	mov    0x80c040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802c06:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802c08:	85 c0                	test   %eax,%eax
+  802c0a:	74 05                	je     802c11 <find_paging_env+0x10>
+  802c0c:	eb 56                	jmp    802c64 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802c0e:	83 c0 01             	add    $0x1,%eax
+  802c11:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802c16:	7f 47                	jg     802c5f <find_paging_env+0x5e>
+  802c18:	83 f9 01             	cmp    $0x1,%ecx
+  802c1b:	7f 42                	jg     802c5f <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802c1d:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802c20:	c1 e2 06             	shl    $0x6,%edx
+  802c23:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802c29:	8b 52 50             	mov    0x50(%edx),%edx
+  802c2c:	83 fa 02             	cmp    $0x2,%edx
+  802c2f:	75 dd                	jne    802c0e <find_paging_env+0xd>
+  802c31:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802c34:	c1 e2 06             	shl    $0x6,%edx
+  802c37:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802c3d:	8b 52 54             	mov    0x54(%edx),%edx
+  802c40:	85 d2                	test   %edx,%edx
+  802c42:	74 ca                	je     802c0e <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802c44:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802c47:	c1 e2 06             	shl    $0x6,%edx
+  802c4a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802c50:	8b 52 48             	mov    0x48(%edx),%edx
+  802c53:	89 14 8d 44 c0 80 00 	mov    %edx,0x80c044(,%ecx,4)
+  802c5a:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802c5d:	eb af                	jmp    802c0e <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802c5f:	83 f9 02             	cmp    $0x2,%ecx
+  802c62:	74 01                	je     802c65 <find_paging_env+0x64>
+}
+  802c64:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802c65:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802c6a:	8b 40 48             	mov    0x48(%eax),%eax
+  802c6d:	83 e0 01             	and    $0x1,%eax
+  802c70:	8b 04 85 44 c0 80 00 	mov    0x80c044(,%eax,4),%eax
+  802c77:	a3 40 c0 80 00       	mov    %eax,0x80c040
+  802c7c:	eb e6                	jmp    802c64 <find_paging_env+0x63>
+
+00802c7e <page_add_backed>:
+{
+  802c7e:	55                   	push   %ebp
+  802c7f:	89 e5                	mov    %esp,%ebp
+  802c81:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802c84:	a1 0c c0 80 00       	mov    0x80c00c,%eax
+  802c89:	83 f8 04             	cmp    $0x4,%eax
+  802c8c:	74 35                	je     802cc3 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802c8e:	89 d1                	mov    %edx,%ecx
+  802c90:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802c96:	89 0c c5 20 c0 80 00 	mov    %ecx,0x80c020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802c9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ca0:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802ca7:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802cad:	89 14 c5 24 c0 80 00 	mov    %edx,0x80c024(,%eax,8)
+	num_backed_ranges++;
+  802cb4:	83 c0 01             	add    $0x1,%eax
+  802cb7:	a3 0c c0 80 00       	mov    %eax,0x80c00c
+	return 0;
+  802cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cc1:	5d                   	pop    %ebp
+  802cc2:	c3                   	ret
+		return -E_NO_MEM;
+  802cc3:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802cc8:	eb f7                	jmp    802cc1 <page_add_backed+0x43>
+
+00802cca <percentage_of_pgdir_to_walk>:
+{
+  802cca:	55                   	push   %ebp
+  802ccb:	89 e5                	mov    %esp,%ebp
+  802ccd:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802cd0:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802cd4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802cd7:	db 45 fc             	fildl  -0x4(%ebp)
+  802cda:	d8 35 0c 5f 80 00    	fdivs  0x805f0c
+	return ret*ret;
+  802ce0:	d8 c8                	fmul   %st(0),%st
+}
+  802ce2:	c9                   	leave
+  802ce3:	c3                   	ret
+
+00802ce4 <nfu_with_aging_page_choice_func>:
+{
+  802ce4:	55                   	push   %ebp
+  802ce5:	89 e5                	mov    %esp,%ebp
+  802ce7:	57                   	push   %edi
+  802ce8:	56                   	push   %esi
+  802ce9:	53                   	push   %ebx
+  802cea:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802ced:	8b 35 30 90 80 00    	mov    0x809030,%esi
+	float pct_to_walk = 1.0f;
+  802cf3:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802cf5:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802cfa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cff:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802d06:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d0b:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802d0e:	eb 18                	jmp    802d28 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802d10:	f7 d0                	not    %eax
+  802d12:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802d17:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802d19:	83 c2 01             	add    $0x1,%edx
+  802d1c:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802d22:	0f 87 13 01 00 00    	ja     802e3b <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802d28:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d2c:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802d2f:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802d34:	89 c1                	mov    %eax,%ecx
+  802d36:	c1 e9 0a             	shr    $0xa,%ecx
+  802d39:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802d40:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802d46:	83 f9 01             	cmp    $0x1,%ecx
+  802d49:	75 c5                	jne    802d10 <nfu_with_aging_page_choice_func+0x2c>
+  802d4b:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802d50:	77 be                	ja     802d10 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802d52:	89 c1                	mov    %eax,%ecx
+  802d54:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802d57:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  802d5d:	0f 82 a5 00 00 00    	jb     802e08 <nfu_with_aging_page_choice_func+0x124>
+  802d63:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802d69:	0f 87 99 00 00 00    	ja     802e08 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802d6f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802d76:	f6 c1 01             	test   $0x1,%cl
+  802d79:	0f 84 89 00 00 00    	je     802e08 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802d7f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802d86:	f6 c5 04             	test   $0x4,%ch
+  802d89:	75 7d                	jne    802e08 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802d8b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802d92:	f6 c5 02             	test   $0x2,%ch
+  802d95:	75 71                	jne    802e08 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802d97:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d9e:	c1 e9 0c             	shr    $0xc,%ecx
+  802da1:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802da4:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802daa:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802dae:	66 83 f9 01          	cmp    $0x1,%cx
+  802db2:	77 54                	ja     802e08 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802db4:	89 f9                	mov    %edi,%ecx
+  802db6:	80 f9 ff             	cmp    $0xff,%cl
+  802db9:	74 21                	je     802ddc <nfu_with_aging_page_choice_func+0xf8>
+  802dbb:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802dc2:	c1 e9 0c             	shr    $0xc,%ecx
+  802dc5:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802dc8:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802dce:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802dd2:	89 fb                	mov    %edi,%ebx
+  802dd4:	38 d9                	cmp    %bl,%cl
+  802dd6:	73 30                	jae    802e08 <nfu_with_aging_page_choice_func+0x124>
+  802dd8:	dd d8                	fstp   %st(0)
+  802dda:	eb 02                	jmp    802dde <nfu_with_aging_page_choice_func+0xfa>
+  802ddc:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802dde:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802de5:	c1 e9 0c             	shr    $0xc,%ecx
+  802de8:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802deb:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802df2:	89 fb                	mov    %edi,%ebx
+  802df4:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802df7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802dfa:	db 45 e0             	fildl  -0x20(%ebp)
+  802dfd:	d8 35 0c 5f 80 00    	fdivs  0x805f0c
+	return ret*ret;
+  802e03:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802e05:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802e08:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802e0b:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802e0e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802e15:	df 6d e0             	fildll -0x20(%ebp)
+  802e18:	d9 c1                	fld    %st(1)
+  802e1a:	d8 0d 10 5f 80 00    	fmuls  0x805f10
+  802e20:	d9 c9                	fxch   %st(1)
+  802e22:	df f1                	fcomip %st(1),%st
+  802e24:	dd d8                	fstp   %st(0)
+  802e26:	0f 82 ed fe ff ff    	jb     802d19 <nfu_with_aging_page_choice_func+0x35>
+  802e2c:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802e2e:	a3 30 90 80 00       	mov    %eax,0x809030
+			return (void*)(pgnum_opt*PGSIZE);
+  802e33:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802e36:	c1 e0 0c             	shl    $0xc,%eax
+  802e39:	eb 0e                	jmp    802e49 <nfu_with_aging_page_choice_func+0x165>
+  802e3b:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802e3d:	89 f8                	mov    %edi,%eax
+  802e3f:	3c ff                	cmp    $0xff,%al
+  802e41:	74 0e                	je     802e51 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802e43:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802e46:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802e49:	83 c4 14             	add    $0x14,%esp
+  802e4c:	5b                   	pop    %ebx
+  802e4d:	5e                   	pop    %esi
+  802e4e:	5f                   	pop    %edi
+  802e4f:	5d                   	pop    %ebp
+  802e50:	c3                   	ret
+	pgnum = 0;
+  802e51:	c7 05 30 90 80 00 00 	movl   $0x0,0x809030
+  802e58:	00 00 00 
+	return (void*)UTOP;
+  802e5b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802e60:	eb e7                	jmp    802e49 <nfu_with_aging_page_choice_func+0x165>
+
+00802e62 <myRand>:
+    state = state * 1664525 + 1013904223;
+  802e62:	69 05 40 70 80 00 0d 	imul   $0x19660d,0x807040,%eax
+  802e69:	66 19 00 
+  802e6c:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802e71:	a3 40 70 80 00       	mov    %eax,0x807040
+    return state >> 24;
+  802e76:	c1 e8 18             	shr    $0x18,%eax
+}
+  802e79:	c3                   	ret
+
+00802e7a <random_page_choice_func>:
+{
+  802e7a:	55                   	push   %ebp
+  802e7b:	89 e5                	mov    %esp,%ebp
+  802e7d:	57                   	push   %edi
+  802e7e:	56                   	push   %esi
+  802e7f:	53                   	push   %ebx
+  802e80:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802e83:	be 00 00 00 00       	mov    $0x0,%esi
+  802e88:	eb 19                	jmp    802ea3 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802e8a:	f7 d3                	not    %ebx
+  802e8c:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802e92:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802e94:	83 c6 01             	add    $0x1,%esi
+  802e97:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802e9d:	0f 87 a0 00 00 00    	ja     802f43 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802ea3:	89 f3                	mov    %esi,%ebx
+  802ea5:	03 1d 2c 90 80 00    	add    0x80902c,%ebx
+  802eab:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802eb1:	89 d8                	mov    %ebx,%eax
+  802eb3:	c1 e8 0a             	shr    $0xa,%eax
+  802eb6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802ebd:	25 81 00 00 00       	and    $0x81,%eax
+  802ec2:	83 f8 01             	cmp    $0x1,%eax
+  802ec5:	75 c3                	jne    802e8a <random_page_choice_func+0x10>
+  802ec7:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802ecd:	77 bb                	ja     802e8a <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802ecf:	89 df                	mov    %ebx,%edi
+  802ed1:	c1 e7 0c             	shl    $0xc,%edi
+  802ed4:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802ed7:	89 f8                	mov    %edi,%eax
+  802ed9:	e8 06 f9 ff ff       	call   8027e4 <page_is_clean>
+  802ede:	84 c0                	test   %al,%al
+  802ee0:	0f 85 82 00 00 00    	jne    802f68 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802ee6:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  802eec:	72 a6                	jb     802e94 <random_page_choice_func+0x1a>
+  802eee:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802ef4:	77 9e                	ja     802e94 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802ef6:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802efd:	a8 01                	test   $0x1,%al
+  802eff:	74 93                	je     802e94 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802f01:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802f08:	f6 c4 04             	test   $0x4,%ah
+  802f0b:	75 87                	jne    802e94 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802f0d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802f14:	f6 c4 02             	test   $0x2,%ah
+  802f17:	0f 85 77 ff ff ff    	jne    802e94 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802f1d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802f24:	c1 e8 0c             	shr    $0xc,%eax
+  802f27:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802f2a:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802f2f:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802f33:	66 83 f8 01          	cmp    $0x1,%ax
+  802f37:	0f 87 57 ff ff ff    	ja     802e94 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  802f3d:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802f43:	e8 1a ff ff ff       	call   802e62 <myRand>
+  802f48:	8b 3d 2c 90 80 00    	mov    0x80902c,%edi
+  802f4e:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  802f53:	29 fe                	sub    %edi,%esi
+  802f55:	0f be c0             	movsbl %al,%eax
+  802f58:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f5d:	f7 f6                	div    %esi
+  802f5f:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802f61:	bb 15 00 00 00       	mov    $0x15,%ebx
+  802f66:	eb 1c                	jmp    802f84 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  802f68:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+			return (void*)(pgnum*PGSIZE);
+  802f6e:	e9 8f 00 00 00       	jmp    803002 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802f73:	e8 ea fe ff ff       	call   802e62 <myRand>
+  802f78:	0f be c0             	movsbl %al,%eax
+  802f7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f80:	f7 f6                	div    %esi
+  802f82:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802f84:	83 eb 01             	sub    $0x1,%ebx
+  802f87:	0f 84 c2 00 00 00    	je     80304f <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  802f8d:	89 d0                	mov    %edx,%eax
+  802f8f:	c1 e8 0a             	shr    $0xa,%eax
+  802f92:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802f99:	25 81 00 00 00       	and    $0x81,%eax
+  802f9e:	83 f8 01             	cmp    $0x1,%eax
+  802fa1:	75 d0                	jne    802f73 <random_page_choice_func+0xf9>
+  802fa3:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  802fa9:	77 c8                	ja     802f73 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  802fab:	89 d0                	mov    %edx,%eax
+  802fad:	c1 e0 0c             	shl    $0xc,%eax
+  802fb0:	3d 2c 10 81 00       	cmp    $0x81102c,%eax
+  802fb5:	72 56                	jb     80300d <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802fb7:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  802fbc:	77 65                	ja     803023 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802fbe:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802fc5:	f6 c1 01             	test   $0x1,%cl
+  802fc8:	74 59                	je     803023 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802fca:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802fd1:	f6 c5 04             	test   $0x4,%ch
+  802fd4:	75 4d                	jne    803023 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  802fd6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802fdd:	f6 c5 02             	test   $0x2,%ch
+  802fe0:	75 41                	jne    803023 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  802fe2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802fe9:	c1 ea 0c             	shr    $0xc,%edx
+  802fec:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  802fef:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  802ff5:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  802ff9:	66 83 fa 01          	cmp    $0x1,%dx
+  802ffd:	77 3a                	ja     803039 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  802fff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  803002:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803005:	83 c4 1c             	add    $0x1c,%esp
+  803008:	5b                   	pop    %ebx
+  803009:	5e                   	pop    %esi
+  80300a:	5f                   	pop    %edi
+  80300b:	5d                   	pop    %ebp
+  80300c:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  80300d:	e8 50 fe ff ff       	call   802e62 <myRand>
+  803012:	0f be c0             	movsbl %al,%eax
+  803015:	ba 00 00 00 00       	mov    $0x0,%edx
+  80301a:	f7 f6                	div    %esi
+  80301c:	01 fa                	add    %edi,%edx
+			continue;
+  80301e:	e9 61 ff ff ff       	jmp    802f84 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  803023:	e8 3a fe ff ff       	call   802e62 <myRand>
+  803028:	0f be c0             	movsbl %al,%eax
+  80302b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803030:	f7 f6                	div    %esi
+  803032:	01 fa                	add    %edi,%edx
+			continue;
+  803034:	e9 4b ff ff ff       	jmp    802f84 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  803039:	e8 24 fe ff ff       	call   802e62 <myRand>
+  80303e:	0f be c0             	movsbl %al,%eax
+  803041:	ba 00 00 00 00       	mov    $0x0,%edx
+  803046:	f7 f6                	div    %esi
+  803048:	01 fa                	add    %edi,%edx
+			continue;
+  80304a:	e9 35 ff ff ff       	jmp    802f84 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  80304f:	c7 05 2c 90 80 00 00 	movl   $0x0,0x80902c
+  803056:	00 00 00 
+	return (void*)UTOP;
+  803059:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  803060:	eb a0                	jmp    803002 <random_page_choice_func+0x188>
+
+00803062 <nfu>:
+{
+  803062:	55                   	push   %ebp
+  803063:	89 e5                	mov    %esp,%ebp
+  803065:	57                   	push   %edi
+  803066:	56                   	push   %esi
+  803067:	53                   	push   %ebx
+  803068:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80306b:	8b 35 28 90 80 00    	mov    0x809028,%esi
+	float pct_to_walk = 1.0f;
+  803071:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  803073:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803078:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80307d:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803084:	ba 00 00 00 00       	mov    $0x0,%edx
+  803089:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  80308c:	eb 18                	jmp    8030a6 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80308e:	f7 d0                	not    %eax
+  803090:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803095:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803097:	83 c2 01             	add    $0x1,%edx
+  80309a:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  8030a0:	0f 87 13 01 00 00    	ja     8031b9 <nfu+0x157>
+		++num_searched_ptes;
+  8030a6:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8030aa:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8030ad:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8030b2:	89 c1                	mov    %eax,%ecx
+  8030b4:	c1 e9 0a             	shr    $0xa,%ecx
+  8030b7:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8030be:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8030c4:	83 f9 01             	cmp    $0x1,%ecx
+  8030c7:	75 c5                	jne    80308e <nfu+0x2c>
+  8030c9:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8030ce:	77 be                	ja     80308e <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8030d0:	89 c1                	mov    %eax,%ecx
+  8030d2:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8030d5:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  8030db:	0f 82 a5 00 00 00    	jb     803186 <nfu+0x124>
+  8030e1:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8030e7:	0f 87 99 00 00 00    	ja     803186 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8030ed:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8030f4:	f6 c1 01             	test   $0x1,%cl
+  8030f7:	0f 84 89 00 00 00    	je     803186 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8030fd:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803104:	f6 c5 04             	test   $0x4,%ch
+  803107:	75 7d                	jne    803186 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803109:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803110:	f6 c5 02             	test   $0x2,%ch
+  803113:	75 71                	jne    803186 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803115:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80311c:	c1 e9 0c             	shr    $0xc,%ecx
+  80311f:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803122:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803128:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  80312c:	66 83 f9 01          	cmp    $0x1,%cx
+  803130:	77 54                	ja     803186 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  803132:	89 f9                	mov    %edi,%ecx
+  803134:	80 f9 ff             	cmp    $0xff,%cl
+  803137:	74 21                	je     80315a <nfu+0xf8>
+  803139:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803140:	c1 e9 0c             	shr    $0xc,%ecx
+  803143:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803146:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80314c:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  803150:	89 fb                	mov    %edi,%ebx
+  803152:	38 d9                	cmp    %bl,%cl
+  803154:	73 30                	jae    803186 <nfu+0x124>
+  803156:	dd d8                	fstp   %st(0)
+  803158:	eb 02                	jmp    80315c <nfu+0xfa>
+  80315a:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  80315c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803163:	c1 e9 0c             	shr    $0xc,%ecx
+  803166:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803169:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  803170:	89 fb                	mov    %edi,%ebx
+  803172:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  803175:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803178:	db 45 e0             	fildl  -0x20(%ebp)
+  80317b:	d8 35 0c 5f 80 00    	fdivs  0x805f0c
+	return ret*ret;
+  803181:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803183:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803186:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  803189:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80318c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803193:	df 6d e0             	fildll -0x20(%ebp)
+  803196:	d9 c1                	fld    %st(1)
+  803198:	d8 0d 10 5f 80 00    	fmuls  0x805f10
+  80319e:	d9 c9                	fxch   %st(1)
+  8031a0:	df f1                	fcomip %st(1),%st
+  8031a2:	dd d8                	fstp   %st(0)
+  8031a4:	0f 82 ed fe ff ff    	jb     803097 <nfu+0x35>
+  8031aa:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  8031ac:	a3 28 90 80 00       	mov    %eax,0x809028
+			return (void*)(pgnum_opt*PGSIZE);
+  8031b1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8031b4:	c1 e0 0c             	shl    $0xc,%eax
+  8031b7:	eb 0e                	jmp    8031c7 <nfu+0x165>
+  8031b9:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  8031bb:	89 f8                	mov    %edi,%eax
+  8031bd:	3c ff                	cmp    $0xff,%al
+  8031bf:	74 0e                	je     8031cf <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  8031c1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8031c4:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8031c7:	83 c4 14             	add    $0x14,%esp
+  8031ca:	5b                   	pop    %ebx
+  8031cb:	5e                   	pop    %esi
+  8031cc:	5f                   	pop    %edi
+  8031cd:	5d                   	pop    %ebp
+  8031ce:	c3                   	ret
+	pgnum = 0;
+  8031cf:	c7 05 28 90 80 00 00 	movl   $0x0,0x809028
+  8031d6:	00 00 00 
+	return (void*)UTOP;
+  8031d9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8031de:	eb e7                	jmp    8031c7 <nfu+0x165>
+
+008031e0 <lru>:
+{
+  8031e0:	55                   	push   %ebp
+  8031e1:	89 e5                	mov    %esp,%ebp
+  8031e3:	57                   	push   %edi
+  8031e4:	56                   	push   %esi
+  8031e5:	53                   	push   %ebx
+  8031e6:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8031e9:	8b 3d 24 90 80 00    	mov    0x809024,%edi
+	long long time_min = 9223372036854775807;
+  8031ef:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  8031f6:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8031fd:	be 00 00 00 00       	mov    $0x0,%esi
+  803202:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803209:	ba 00 00 00 00       	mov    $0x0,%edx
+  80320e:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  803211:	eb 18                	jmp    80322b <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803213:	f7 d0                	not    %eax
+  803215:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80321a:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80321c:	83 c2 01             	add    $0x1,%edx
+  80321f:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803225:	0f 87 fa 00 00 00    	ja     803325 <lru+0x145>
+		++num_searched_ptes;
+  80322b:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80322e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803231:	01 d0                	add    %edx,%eax
+  803233:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803238:	89 c1                	mov    %eax,%ecx
+  80323a:	c1 e9 0a             	shr    $0xa,%ecx
+  80323d:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  803244:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  80324a:	83 f9 01             	cmp    $0x1,%ecx
+  80324d:	75 c4                	jne    803213 <lru+0x33>
+  80324f:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803254:	77 bd                	ja     803213 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803256:	89 c1                	mov    %eax,%ecx
+  803258:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80325b:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803261:	0f 87 92 00 00 00    	ja     8032f9 <lru+0x119>
+  803267:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  80326d:	0f 82 86 00 00 00    	jb     8032f9 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803273:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80327a:	f6 c1 01             	test   $0x1,%cl
+  80327d:	74 7a                	je     8032f9 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80327f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803286:	f6 c5 04             	test   $0x4,%ch
+  803289:	75 6e                	jne    8032f9 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80328b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803292:	f6 c5 02             	test   $0x2,%ch
+  803295:	75 62                	jne    8032f9 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803297:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80329e:	c1 e9 0c             	shr    $0xc,%ecx
+  8032a1:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032a4:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032aa:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8032ae:	66 83 f9 01          	cmp    $0x1,%cx
+  8032b2:	77 45                	ja     8032f9 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  8032b4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032bb:	c1 e9 0c             	shr    $0xc,%ecx
+  8032be:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032c1:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032c7:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8032ca:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8032cd:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  8032d0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8032d3:	19 df                	sbb    %ebx,%edi
+  8032d5:	7c 22                	jl     8032f9 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  8032d7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032de:	c1 e9 0c             	shr    $0xc,%ecx
+  8032e1:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032e4:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032ea:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8032ed:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8032f0:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8032f3:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8032f6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8032f9:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8032fc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803303:	df 6d e0             	fildll -0x20(%ebp)
+  803306:	d9 05 10 5f 80 00    	flds   0x805f10
+  80330c:	d9 c9                	fxch   %st(1)
+  80330e:	df f1                	fcomip %st(1),%st
+  803310:	dd d8                	fstp   %st(0)
+  803312:	0f 82 04 ff ff ff    	jb     80321c <lru+0x3c>
+			pgnum = pgnum_actual;
+  803318:	a3 24 90 80 00       	mov    %eax,0x809024
+			return (void*)(pgnum_opt*PGSIZE);
+  80331d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803320:	c1 e0 0c             	shl    $0xc,%eax
+  803323:	eb 06                	jmp    80332b <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  803325:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803328:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80332b:	83 c4 1c             	add    $0x1c,%esp
+  80332e:	5b                   	pop    %ebx
+  80332f:	5e                   	pop    %esi
+  803330:	5f                   	pop    %edi
+  803331:	5d                   	pop    %ebp
+  803332:	c3                   	ret
+
+00803333 <set_page_choice_func>:
+{
+  803333:	55                   	push   %ebp
+  803334:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  803336:	8b 45 08             	mov    0x8(%ebp),%eax
+  803339:	a3 3c 70 80 00       	mov    %eax,0x80703c
+}
+  80333e:	5d                   	pop    %ebp
+  80333f:	c3                   	ret
+
+00803340 <get_page_choice>:
+{
+  803340:	55                   	push   %ebp
+  803341:	89 e5                	mov    %esp,%ebp
+  803343:	57                   	push   %edi
+  803344:	56                   	push   %esi
+  803345:	53                   	push   %ebx
+  803346:	83 ec 24             	sub    $0x24,%esp
+  803349:	8b 75 08             	mov    0x8(%ebp),%esi
+  80334c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  80334f:	57                   	push   %edi
+  803350:	56                   	push   %esi
+  803351:	ff 15 3c 70 80 00    	call   *0x80703c
+  803357:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803359:	83 c4 10             	add    $0x10,%esp
+  80335c:	eb 25                	jmp    803383 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  80335e:	83 ec 08             	sub    $0x8,%esp
+  803361:	c1 e0 16             	shl    $0x16,%eax
+  803364:	50                   	push   %eax
+  803365:	6a 00                	push   $0x0
+  803367:	e8 38 db ff ff       	call   800ea4 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80336c:	83 c4 10             	add    $0x10,%esp
+  80336f:	85 c0                	test   %eax,%eax
+  803371:	75 43                	jne    8033b6 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  803373:	83 ec 08             	sub    $0x8,%esp
+  803376:	57                   	push   %edi
+  803377:	56                   	push   %esi
+  803378:	ff 15 3c 70 80 00    	call   *0x80703c
+  80337e:	89 c3                	mov    %eax,%ebx
+  803380:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803383:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  803386:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80338c:	0f 86 ae 00 00 00    	jbe    803440 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803392:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  803397:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80339e:	81 e2 81 00 00 00    	and    $0x81,%edx
+  8033a4:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  8033aa:	74 b2                	je     80335e <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  8033ac:	83 c0 01             	add    $0x1,%eax
+  8033af:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  8033b4:	75 e1                	jne    803397 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  8033b6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8033b9:	05 00 10 40 11       	add    $0x11401000,%eax
+  8033be:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8033c3:	76 1f                	jbe    8033e4 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  8033c5:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  8033ca:	89 d8                	mov    %ebx,%eax
+  8033cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033cf:	5b                   	pop    %ebx
+  8033d0:	5e                   	pop    %esi
+  8033d1:	5f                   	pop    %edi
+  8033d2:	5d                   	pop    %ebp
+  8033d3:	c3                   	ret
+		sys_page_split(0, pg_out);
+  8033d4:	83 ec 08             	sub    $0x8,%esp
+  8033d7:	53                   	push   %ebx
+  8033d8:	6a 00                	push   $0x0
+  8033da:	e8 c5 da ff ff       	call   800ea4 <sys_page_split>
+  8033df:	83 c4 10             	add    $0x10,%esp
+  8033e2:	eb 6c                	jmp    803450 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  8033e4:	83 ec 04             	sub    $0x4,%esp
+  8033e7:	68 b8 5a 80 00       	push   $0x805ab8
+  8033ec:	68 cc 01 00 00       	push   $0x1cc
+  8033f1:	68 25 5a 80 00       	push   $0x805a25
+  8033f6:	e8 2d ce ff ff       	call   800228 <_panic>
+		panic("We tried to page out code pages\n");
+  8033fb:	83 ec 04             	sub    $0x4,%esp
+  8033fe:	68 e8 5a 80 00       	push   $0x805ae8
+  803403:	68 d6 01 00 00       	push   $0x1d6
+  803408:	68 25 5a 80 00       	push   $0x805a25
+  80340d:	e8 16 ce ff ff       	call   800228 <_panic>
+		panic("Invalid mapping for the va\n");
+  803412:	83 ec 04             	sub    $0x4,%esp
+  803415:	68 32 5a 80 00       	push   $0x805a32
+  80341a:	68 da 01 00 00       	push   $0x1da
+  80341f:	68 25 5a 80 00       	push   $0x805a25
+  803424:	e8 ff cd ff ff       	call   800228 <_panic>
+		panic("We tried to page out a shared page\n");
+  803429:	83 ec 04             	sub    $0x4,%esp
+  80342c:	68 0c 5b 80 00       	push   $0x805b0c
+  803431:	68 e0 01 00 00       	push   $0x1e0
+  803436:	68 25 5a 80 00       	push   $0x805a25
+  80343b:	e8 e8 cd ff ff       	call   800228 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  803440:	89 de                	mov    %ebx,%esi
+  803442:	c1 ee 16             	shr    $0x16,%esi
+  803445:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80344c:	a8 80                	test   $0x80,%al
+  80344e:	75 84                	jne    8033d4 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803450:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803453:	05 00 10 40 11       	add    $0x11401000,%eax
+  803458:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80345d:	76 85                	jbe    8033e4 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  80345f:	89 d8                	mov    %ebx,%eax
+  803461:	e8 7e f3 ff ff       	call   8027e4 <page_is_clean>
+  803466:	84 c0                	test   %al,%al
+  803468:	0f 85 5c ff ff ff    	jne    8033ca <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  80346e:	81 7d e4 2c 10 81 00 	cmpl   $0x81102c,-0x1c(%ebp)
+  803475:	76 84                	jbe    8033fb <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  803477:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80347e:	a8 01                	test   $0x1,%al
+  803480:	74 90                	je     803412 <get_page_choice+0xd2>
+  803482:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803485:	c1 e8 0c             	shr    $0xc,%eax
+  803488:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80348f:	f6 c2 01             	test   $0x1,%dl
+  803492:	0f 84 7a ff ff ff    	je     803412 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803498:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  80349f:	f6 c2 01             	test   $0x1,%dl
+  8034a2:	74 85                	je     803429 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  8034a4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  8034ab:	f6 c2 01             	test   $0x1,%dl
+  8034ae:	0f 84 75 ff ff ff    	je     803429 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8034b4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  8034bb:	f6 c6 04             	test   $0x4,%dh
+  8034be:	0f 85 65 ff ff ff    	jne    803429 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  8034c4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8034cb:	f6 c6 02             	test   $0x2,%dh
+  8034ce:	0f 85 55 ff ff ff    	jne    803429 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  8034d4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8034db:	c1 e8 0c             	shr    $0xc,%eax
+  8034de:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8034e1:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8034e6:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8034ea:	66 83 f8 01          	cmp    $0x1,%ax
+  8034ee:	0f 86 d6 fe ff ff    	jbe    8033ca <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  8034f4:	83 ec 04             	sub    $0x4,%esp
+  8034f7:	68 30 5b 80 00       	push   $0x805b30
+  8034fc:	68 e2 01 00 00       	push   $0x1e2
+  803501:	68 25 5a 80 00       	push   $0x805a25
+  803506:	e8 1d cd ff ff       	call   800228 <_panic>
+
+0080350b <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  80350b:	55                   	push   %ebp
+  80350c:	89 e5                	mov    %esp,%ebp
+  80350e:	57                   	push   %edi
+  80350f:	56                   	push   %esi
+  803510:	53                   	push   %ebx
+  803511:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  803514:	e8 e8 f6 ff ff       	call   802c01 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  803519:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  80351e:	85 c0                	test   %eax,%eax
+  803520:	74 41                	je     803563 <page_share_paged_out+0x58>
+  803522:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803529:	0f 84 fd 00 00 00    	je     80362c <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  80352f:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  803536:	00 00 00 
+  803539:	c7 05 00 b0 80 00 00 	movl   $0x0,0x80b000
+  803540:	00 00 00 
+  803543:	bf 00 00 00 00       	mov    $0x0,%edi
+  803548:	eb 2c                	jmp    803576 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  80354a:	83 c3 04             	add    $0x4,%ebx
+  80354d:	39 f3                	cmp    %esi,%ebx
+  80354f:	74 1a                	je     80356b <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  803551:	8b 03                	mov    (%ebx),%eax
+  803553:	a8 01                	test   $0x1,%al
+  803555:	74 f3                	je     80354a <page_share_paged_out+0x3f>
+  803557:	c1 e8 0c             	shr    $0xc,%eax
+  80355a:	e8 2b f5 ff ff       	call   802a8a <page_share_slot>
+  80355f:	85 c0                	test   %eax,%eax
+  803561:	79 e7                	jns    80354a <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  803563:	83 c4 0c             	add    $0xc,%esp
+  803566:	5b                   	pop    %ebx
+  803567:	5e                   	pop    %esi
+  803568:	5f                   	pop    %edi
+  803569:	5d                   	pop    %ebp
+  80356a:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  80356b:	83 c7 04             	add    $0x4,%edi
+  80356e:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  803574:	74 1b                	je     803591 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  803576:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  80357b:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  80357e:	f6 c3 01             	test   $0x1,%bl
+  803581:	74 e8                	je     80356b <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  803583:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803589:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  80358f:	eb bc                	jmp    80354d <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803591:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803596:	eb 11                	jmp    8035a9 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  803598:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80359e:	83 c3 01             	add    $0x1,%ebx
+  8035a1:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8035a7:	77 41                	ja     8035ea <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  8035a9:	89 d8                	mov    %ebx,%eax
+  8035ab:	c1 e8 0a             	shr    $0xa,%eax
+  8035ae:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8035b5:	25 81 00 00 00       	and    $0x81,%eax
+  8035ba:	83 f8 01             	cmp    $0x1,%eax
+  8035bd:	75 d9                	jne    803598 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  8035bf:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8035c6:	25 81 00 00 00       	and    $0x81,%eax
+  8035cb:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8035d0:	75 cc                	jne    80359e <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  8035d2:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8035d9:	c1 e8 0c             	shr    $0xc,%eax
+  8035dc:	e8 a9 f4 ff ff       	call   802a8a <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  8035e1:	85 c0                	test   %eax,%eax
+  8035e3:	79 b9                	jns    80359e <page_share_paged_out+0x93>
+  8035e5:	e9 79 ff ff ff       	jmp    803563 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8035ea:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8035f1:	75 13                	jne    803606 <page_share_paged_out+0xfb>
+  8035f3:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  8035fa:	75 1d                	jne    803619 <page_share_paged_out+0x10e>
+	return 0;
+  8035fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803601:	e9 5d ff ff ff       	jmp    803563 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803606:	b8 00 00 00 00       	mov    $0x0,%eax
+  80360b:	e8 46 f4 ff ff       	call   802a56 <page_share_send>
+  803610:	85 c0                	test   %eax,%eax
+  803612:	79 df                	jns    8035f3 <page_share_paged_out+0xe8>
+  803614:	e9 4a ff ff ff       	jmp    803563 <page_share_paged_out+0x58>
+  803619:	b8 01 00 00 00       	mov    $0x1,%eax
+  80361e:	e8 33 f4 ff ff       	call   802a56 <page_share_send>
+  803623:	85 c0                	test   %eax,%eax
+  803625:	79 d5                	jns    8035fc <page_share_paged_out+0xf1>
+  803627:	e9 37 ff ff ff       	jmp    803563 <page_share_paged_out+0x58>
+		return 0;
+  80362c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803631:	e9 2d ff ff ff       	jmp    803563 <page_share_paged_out+0x58>
+
+00803636 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  803636:	55                   	push   %ebp
+  803637:	89 e5                	mov    %esp,%ebp
+  803639:	56                   	push   %esi
+  80363a:	53                   	push   %ebx
+  80363b:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  80363e:	e8 be f5 ff ff       	call   802c01 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  803643:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  803648:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  80364f:	0f 84 82 00 00 00    	je     8036d7 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  803655:	83 ec 0c             	sub    $0xc,%esp
+  803658:	68 00 10 00 00       	push   $0x1000
+  80365d:	e8 84 11 00 00       	call   8047e6 <malloc>
+  803662:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  803664:	83 c4 0c             	add    $0xc,%esp
+  803667:	6a 14                	push   $0x14
+  803669:	6a 00                	push   $0x0
+  80366b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80366e:	50                   	push   %eax
+  80366f:	e8 c7 d3 ff ff       	call   800a3b <memset>
+  803674:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  803677:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  80367c:	83 ec 0c             	sub    $0xc,%esp
+  80367f:	6a 07                	push   $0x7
+  803681:	6a 01                	push   $0x1
+  803683:	53                   	push   %ebx
+  803684:	6a 03                	push   $0x3
+  803686:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  80368d:	e8 b7 19 00 00       	call   805049 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  803692:	8b 03                	mov    (%ebx),%eax
+  803694:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803697:	8b 43 04             	mov    0x4(%ebx),%eax
+  80369a:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  80369d:	8b 43 08             	mov    0x8(%ebx),%eax
+  8036a0:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  8036a3:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8036a6:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  8036a9:	8b 43 10             	mov    0x10(%ebx),%eax
+  8036ac:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  8036af:	83 c6 01             	add    $0x1,%esi
+  8036b2:	83 c4 20             	add    $0x20,%esp
+  8036b5:	83 fe 02             	cmp    $0x2,%esi
+  8036b8:	75 c2                	jne    80367c <get_paging_stats+0x46>
+	}
+	*stats = total;
+  8036ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036bd:	89 03                	mov    %eax,(%ebx)
+  8036bf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8036c2:	89 43 04             	mov    %eax,0x4(%ebx)
+  8036c5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8036c8:	89 43 08             	mov    %eax,0x8(%ebx)
+  8036cb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8036ce:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8036d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036d4:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  8036d7:	89 d8                	mov    %ebx,%eax
+  8036d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036dc:	5b                   	pop    %ebx
+  8036dd:	5e                   	pop    %esi
+  8036de:	5d                   	pop    %ebp
+  8036df:	c3                   	ret
+
+008036e0 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  8036e0:	55                   	push   %ebp
+  8036e1:	89 e5                	mov    %esp,%ebp
+  8036e3:	53                   	push   %ebx
+  8036e4:	83 ec 10             	sub    $0x10,%esp
+  8036e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  8036ea:	68 4c 5a 80 00       	push   $0x805a4c
+  8036ef:	e8 0f cc ff ff       	call   800303 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  8036f4:	83 c4 08             	add    $0x8,%esp
+  8036f7:	ff 33                	push   (%ebx)
+  8036f9:	68 64 5b 80 00       	push   $0x805b64
+  8036fe:	e8 00 cc ff ff       	call   800303 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  803703:	83 c4 08             	add    $0x8,%esp
+  803706:	ff 73 04             	push   0x4(%ebx)
+  803709:	68 4e 5a 80 00       	push   $0x805a4e
+  80370e:	e8 f0 cb ff ff       	call   800303 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  803713:	83 c4 08             	add    $0x8,%esp
+  803716:	ff 73 08             	push   0x8(%ebx)
+  803719:	68 84 5b 80 00       	push   $0x805b84
+  80371e:	e8 e0 cb ff ff       	call   800303 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  803723:	83 c4 08             	add    $0x8,%esp
+  803726:	ff 73 0c             	push   0xc(%ebx)
+  803729:	68 a8 5b 80 00       	push   $0x805ba8
+  80372e:	e8 d0 cb ff ff       	call   800303 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  803733:	83 c4 08             	add    $0x8,%esp
+  803736:	ff 73 10             	push   0x10(%ebx)
+  803739:	68 cc 5b 80 00       	push   $0x805bcc
+  80373e:	e8 c0 cb ff ff       	call   800303 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  803743:	83 c4 08             	add    $0x8,%esp
+  803746:	ff 35 08 c0 80 00    	push   0x80c008
+  80374c:	68 08 5c 80 00       	push   $0x805c08
+  803751:	e8 ad cb ff ff       	call   800303 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  803756:	83 c4 08             	add    $0x8,%esp
+  803759:	ff 35 04 c0 80 00    	push   0x80c004
+  80375f:	68 3c 5c 80 00       	push   $0x805c3c
+  803764:	e8 9a cb ff ff       	call   800303 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  803769:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80376e:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  803771:	8b 50 68             	mov    0x68(%eax),%edx
+  803774:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  803777:	51                   	push   %ecx
+  803778:	52                   	push   %edx
+  803779:	50                   	push   %eax
+  80377a:	68 7c 5c 80 00       	push   $0x805c7c
+  80377f:	e8 7f cb ff ff       	call   800303 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  803784:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803789:	8b 40 70             	mov    0x70(%eax),%eax
+  80378c:	83 c4 18             	add    $0x18,%esp
+  80378f:	50                   	push   %eax
+  803790:	68 b0 5c 80 00       	push   $0x805cb0
+  803795:	e8 69 cb ff ff       	call   800303 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  80379a:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  8037a0:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  8037a6:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  8037ab:	51                   	push   %ecx
+  8037ac:	52                   	push   %edx
+  8037ad:	50                   	push   %eax
+  8037ae:	68 e0 5c 80 00       	push   $0x805ce0
+  8037b3:	e8 4b cb ff ff       	call   800303 <cprintf>
+	cprintf("\n");
+  8037b8:	83 c4 14             	add    $0x14,%esp
+  8037bb:	68 4c 5a 80 00       	push   $0x805a4c
+  8037c0:	e8 3e cb ff ff       	call   800303 <cprintf>
+}
+  8037c5:	83 c4 10             	add    $0x10,%esp
+  8037c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037cb:	c9                   	leave
+  8037cc:	c3                   	ret
+
+008037cd <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  8037cd:	55                   	push   %ebp
+  8037ce:	89 e5                	mov    %esp,%ebp
+  8037d0:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  8037d3:	e8 5e fe ff ff       	call   803636 <get_paging_stats>
+  8037d8:	83 ec 0c             	sub    $0xc,%esp
+  8037db:	50                   	push   %eax
+  8037dc:	e8 ff fe ff ff       	call   8036e0 <print_paging_stats>
+}
+  8037e1:	83 c4 10             	add    $0x10,%esp
+  8037e4:	c9                   	leave
+  8037e5:	c3                   	ret
+
+008037e6 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  8037e6:	55                   	push   %ebp
+  8037e7:	89 e5                	mov    %esp,%ebp
+  8037e9:	53                   	push   %ebx
+  8037ea:	83 ec 04             	sub    $0x4,%esp
+  8037ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  8037f0:	eb 13                	jmp    803805 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  8037f2:	83 ec 04             	sub    $0x4,%esp
+  8037f5:	6a ff                	push   $0xffffffff
+  8037f7:	53                   	push   %ebx
+  8037f8:	68 00 f0 ff ee       	push   $0xeefff000
+  8037fd:	e8 b4 da ff ff       	call   8012b6 <sys_futex_wait>
+  803802:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803805:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  80380a:	39 d8                	cmp    %ebx,%eax
+  80380c:	74 e4                	je     8037f2 <mem_pressure_wait+0xc>
+	return now;
+}
+  80380e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803811:	c9                   	leave
+  803812:	c3                   	ret
+
+00803813 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803813:	55                   	push   %ebp
+  803814:	89 e5                	mov    %esp,%ebp
+  803816:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  803819:	68 85 44 80 00       	push   $0x804485
+  80381e:	e8 32 16 00 00       	call   804e55 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803823:	c7 05 14 f9 80 00 00 	movl   $0xdeadb000,0x80f914
+  80382a:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  80382d:	83 c4 0c             	add    $0xc,%esp
+  803830:	68 07 02 00 00       	push   $0x207
+  803835:	68 00 b0 ad de       	push   $0xdeadb000
+  80383a:	6a 00                	push   $0x0
+  80383c:	e8 9c d5 ff ff       	call   800ddd <sys_page_alloc>
+  803841:	83 c4 10             	add    $0x10,%esp
+  803844:	85 c0                	test   %eax,%eax
+  803846:	78 0c                	js     803854 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  803848:	e8 b4 f3 ff ff       	call   802c01 <find_paging_env>
+	page_ring_ready();
+  80384d:	e8 7f f2 ff ff       	call   802ad1 <page_ring_ready>
+}
+  803852:	c9                   	leave
+  803853:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  803854:	50                   	push   %eax
+  803855:	68 6c 5a 80 00       	push   $0x805a6c
+  80385a:	68 13 05 00 00       	push   $0x513
+  80385f:	68 25 5a 80 00       	push   $0x805a25
+  803864:	e8 bf c9 ff ff       	call   800228 <_panic>
+
+00803869 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  803869:	55                   	push   %ebp
+  80386a:	89 e5                	mov    %esp,%ebp
+  80386c:	57                   	push   %edi
+  80386d:	56                   	push   %esi
+  80386e:	53                   	push   %ebx
+  80386f:	83 ec 0c             	sub    $0xc,%esp
+  803872:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  803875:	89 fa                	mov    %edi,%edx
+  803877:	c1 ea 16             	shr    $0x16,%edx
+  80387a:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  80387f:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  803882:	f6 06 01             	testb  $0x1,(%esi)
+  803885:	75 3e                	jne    8038c5 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803887:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  80388c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803890:	74 47                	je     8038d9 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  803892:	83 ec 0c             	sub    $0xc,%esp
+  803895:	6a 01                	push   $0x1
+  803897:	e8 f2 11 00 00       	call   804a8e <va_alloc>
+  80389c:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  80389e:	83 c4 10             	add    $0x10,%esp
+  8038a1:	85 c0                	test   %eax,%eax
+  8038a3:	74 34                	je     8038d9 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  8038a5:	6a 00                	push   $0x0
+  8038a7:	68 07 02 00 00       	push   $0x207
+  8038ac:	50                   	push   %eax
+  8038ad:	6a 00                	push   $0x0
+  8038af:	e8 df 02 00 00       	call   803b93 <page_alloc>
+  8038b4:	83 c4 10             	add    $0x10,%esp
+  8038b7:	85 c0                	test   %eax,%eax
+  8038b9:	78 28                	js     8038e3 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  8038bb:	f6 06 01             	testb  $0x1,(%esi)
+  8038be:	75 38                	jne    8038f8 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  8038c0:	83 cb 01             	or     $0x1,%ebx
+  8038c3:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  8038c5:	89 f8                	mov    %edi,%eax
+  8038c7:	c1 e8 0a             	shr    $0xa,%eax
+  8038ca:	25 fc 0f 00 00       	and    $0xffc,%eax
+  8038cf:	8b 1e                	mov    (%esi),%ebx
+  8038d1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8038d7:	01 c3                	add    %eax,%ebx
+}
+  8038d9:	89 d8                	mov    %ebx,%eax
+  8038db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038de:	5b                   	pop    %ebx
+  8038df:	5e                   	pop    %esi
+  8038e0:	5f                   	pop    %edi
+  8038e1:	5d                   	pop    %ebp
+  8038e2:	c3                   	ret
+			va_free(page, 1);
+  8038e3:	83 ec 08             	sub    $0x8,%esp
+  8038e6:	6a 01                	push   $0x1
+  8038e8:	53                   	push   %ebx
+  8038e9:	e8 d8 12 00 00       	call   804bc6 <va_free>
+			return NULL;
+  8038ee:	83 c4 10             	add    $0x10,%esp
+  8038f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038f6:	eb e1                	jmp    8038d9 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  8038f8:	83 ec 08             	sub    $0x8,%esp
+  8038fb:	53                   	push   %ebx
+  8038fc:	6a 00                	push   $0x0
+  8038fe:	e8 5f d5 ff ff       	call   800e62 <sys_page_unmap>
+			va_free(page, 1);
+  803903:	83 c4 08             	add    $0x8,%esp
+  803906:	6a 01                	push   $0x1
+  803908:	53                   	push   %ebx
+  803909:	e8 b8 12 00 00       	call   804bc6 <va_free>
+  80390e:	83 c4 10             	add    $0x10,%esp
+  803911:	eb b2                	jmp    8038c5 <umapdir_walk+0x5c>
+
+00803913 <page_out>:
+{
+  803913:	55                   	push   %ebp
+  803914:	89 e5                	mov    %esp,%ebp
+  803916:	57                   	push   %edi
+  803917:	56                   	push   %esi
+  803918:	53                   	push   %ebx
+  803919:	83 ec 5c             	sub    $0x5c,%esp
+  80391c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  80391f:	e8 dd f2 ff ff       	call   802c01 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803924:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  803929:	85 c0                	test   %eax,%eax
+  80392b:	74 1e                	je     80394b <page_out+0x38>
+  80392d:	83 ec 0c             	sub    $0xc,%esp
+  803930:	6a 00                	push   $0x0
+  803932:	6a 00                	push   $0x0
+  803934:	6a 00                	push   $0x0
+  803936:	6a 08                	push   $0x8
+  803938:	50                   	push   %eax
+  803939:	e8 0b 17 00 00       	call   805049 <ipc_call>
+  80393e:	89 c3                	mov    %eax,%ebx
+  803940:	83 c4 20             	add    $0x20,%esp
+  803943:	85 c0                	test   %eax,%eax
+  803945:	0f 84 ac 00 00 00    	je     8039f7 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  80394b:	83 ec 08             	sub    $0x8,%esp
+  80394e:	ff 75 0c             	push   0xc(%ebp)
+  803951:	57                   	push   %edi
+  803952:	e8 e9 f9 ff ff       	call   803340 <get_page_choice>
+  803957:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  803959:	83 c4 10             	add    $0x10,%esp
+  80395c:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803961:	0f 84 18 02 00 00    	je     803b7f <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803967:	e8 78 ee ff ff       	call   8027e4 <page_is_clean>
+  80396c:	84 c0                	test   %al,%al
+  80396e:	0f 85 8c 00 00 00    	jne    803a00 <page_out+0xed>
+	if (pagingenv == 0)
+  803974:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  80397b:	0f 84 08 02 00 00    	je     803b89 <page_out+0x276>
+	if (page_ring_ready())
+  803981:	e8 4b f1 ff ff       	call   802ad1 <page_ring_ready>
+  803986:	89 c3                	mov    %eax,%ebx
+  803988:	85 c0                	test   %eax,%eax
+  80398a:	0f 85 89 00 00 00    	jne    803a19 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  803990:	83 ec 0c             	sub    $0xc,%esp
+  803993:	6a 05                	push   $0x5
+  803995:	6a 01                	push   $0x1
+  803997:	56                   	push   %esi
+  803998:	6a 01                	push   $0x1
+  80399a:	ff 35 40 c0 80 00    	push   0x80c040
+  8039a0:	e8 a4 16 00 00       	call   805049 <ipc_call>
+  8039a5:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  8039a7:	83 c4 20             	add    $0x20,%esp
+  8039aa:	85 c0                	test   %eax,%eax
+  8039ac:	0f 88 b8 01 00 00    	js     803b6a <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  8039b2:	89 f0                	mov    %esi,%eax
+  8039b4:	c1 e8 0c             	shr    $0xc,%eax
+  8039b7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8039be:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  8039c1:	83 ec 08             	sub    $0x8,%esp
+  8039c4:	56                   	push   %esi
+  8039c5:	6a 00                	push   $0x0
+  8039c7:	e8 96 d4 ff ff       	call   800e62 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  8039cc:	83 c4 08             	add    $0x8,%esp
+  8039cf:	6a 01                	push   $0x1
+  8039d1:	56                   	push   %esi
+  8039d2:	e8 92 fe ff ff       	call   803869 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  8039d7:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  8039da:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  8039e0:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  8039e3:	09 fe                	or     %edi,%esi
+  8039e5:	83 ce 01             	or     $0x1,%esi
+  8039e8:	89 30                	mov    %esi,(%eax)
+	return 0;
+  8039ea:	83 c4 10             	add    $0x10,%esp
+}
+  8039ed:	89 d8                	mov    %ebx,%eax
+  8039ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039f2:	5b                   	pop    %ebx
+  8039f3:	5e                   	pop    %esi
+  8039f4:	5f                   	pop    %edi
+  8039f5:	5d                   	pop    %ebp
+  8039f6:	c3                   	ret
+		num_page_reclaims++;
+  8039f7:	83 05 04 c0 80 00 01 	addl   $0x1,0x80c004
+		return 0;
+  8039fe:	eb ed                	jmp    8039ed <page_out+0xda>
+		num_page_drops++;
+  803a00:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+		return sys_page_unmap(0, map_out_addr);
+  803a07:	83 ec 08             	sub    $0x8,%esp
+  803a0a:	56                   	push   %esi
+  803a0b:	6a 00                	push   $0x0
+  803a0d:	e8 50 d4 ff ff       	call   800e62 <sys_page_unmap>
+  803a12:	89 c3                	mov    %eax,%ebx
+  803a14:	83 c4 10             	add    $0x10,%esp
+  803a17:	eb d4                	jmp    8039ed <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803a19:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803a1b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803a20:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803a25:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803a28:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803a2a:	83 c0 08             	add    $0x8,%eax
+  803a2d:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803a30:	b8 07 00 00 00       	mov    $0x7,%eax
+  803a35:	e8 e5 ef ff ff       	call   802a1f <page_ring_reserve>
+	first = ring->sq_tail;
+  803a3a:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803a3f:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803a42:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803a47:	83 ec 04             	sub    $0x4,%esp
+  803a4a:	68 00 10 00 00       	push   $0x1000
+  803a4f:	56                   	push   %esi
+  803a50:	89 d8                	mov    %ebx,%eax
+  803a52:	c1 e0 0c             	shl    $0xc,%eax
+  803a55:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803a5a:	50                   	push   %eax
+  803a5b:	e8 72 d0 ff ff       	call   800ad2 <memcpy>
+		vas[n] = va;
+  803a60:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803a64:	89 d9                	mov    %ebx,%ecx
+  803a66:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a6b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803a70:	e8 de ee ff ff       	call   802953 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803a75:	8d 43 01             	lea    0x1(%ebx),%eax
+  803a78:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803a7b:	83 c4 10             	add    $0x10,%esp
+  803a7e:	83 fb 06             	cmp    $0x6,%ebx
+  803a81:	74 62                	je     803ae5 <page_out+0x1d2>
+  803a83:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803a86:	eb 15                	jmp    803a9d <page_out+0x18a>
+			num_page_drops++;
+  803a88:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+			sys_page_unmap(0, va);
+  803a8f:	83 ec 08             	sub    $0x8,%esp
+  803a92:	56                   	push   %esi
+  803a93:	6a 00                	push   $0x0
+  803a95:	e8 c8 d3 ff ff       	call   800e62 <sys_page_unmap>
+  803a9a:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803a9d:	83 ec 08             	sub    $0x8,%esp
+  803aa0:	53                   	push   %ebx
+  803aa1:	57                   	push   %edi
+  803aa2:	e8 99 f8 ff ff       	call   803340 <get_page_choice>
+  803aa7:	89 c6                	mov    %eax,%esi
+  803aa9:	83 c4 10             	add    $0x10,%esp
+  803aac:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803ab1:	74 32                	je     803ae5 <page_out+0x1d2>
+  803ab3:	e8 2c ed ff ff       	call   8027e4 <page_is_clean>
+  803ab8:	84 c0                	test   %al,%al
+  803aba:	75 cc                	jne    803a88 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803abc:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803abf:	39 c6                	cmp    %eax,%esi
+  803ac1:	72 07                	jb     803aca <page_out+0x1b7>
+  803ac3:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803ac6:	39 c6                	cmp    %eax,%esi
+  803ac8:	72 1b                	jb     803ae5 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803aca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803acf:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803ad2:	eb 03                	jmp    803ad7 <page_out+0x1c4>
+  803ad4:	83 c3 01             	add    $0x1,%ebx
+  803ad7:	39 da                	cmp    %ebx,%edx
+  803ad9:	0f 84 68 ff ff ff    	je     803a47 <page_out+0x134>
+  803adf:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803ae3:	75 ef                	jne    803ad4 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803ae5:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803ae8:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803aeb:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803aee:	e8 a6 ee ff ff       	call   802999 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803af3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803af8:	eb 42                	jmp    803b3c <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803afa:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803afe:	89 f8                	mov    %edi,%eax
+  803b00:	c1 e8 0c             	shr    $0xc,%eax
+  803b03:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b0a:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803b0d:	83 ec 08             	sub    $0x8,%esp
+  803b10:	57                   	push   %edi
+  803b11:	6a 00                	push   $0x0
+  803b13:	e8 4a d3 ff ff       	call   800e62 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803b18:	83 c4 08             	add    $0x8,%esp
+  803b1b:	6a 01                	push   $0x1
+  803b1d:	57                   	push   %edi
+  803b1e:	e8 46 fd ff ff       	call   803869 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803b23:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803b26:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803b2c:	c1 e6 0c             	shl    $0xc,%esi
+  803b2f:	09 d6                	or     %edx,%esi
+  803b31:	83 ce 01             	or     $0x1,%esi
+  803b34:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803b36:	83 c3 01             	add    $0x1,%ebx
+  803b39:	83 c4 10             	add    $0x10,%esp
+  803b3c:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803b3f:	39 c3                	cmp    %eax,%ebx
+  803b41:	74 1d                	je     803b60 <page_out+0x24d>
+		if (res[i] < 0)
+  803b43:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803b47:	85 f6                	test   %esi,%esi
+  803b49:	79 af                	jns    803afa <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803b4b:	56                   	push   %esi
+  803b4c:	68 10 5d 80 00       	push   $0x805d10
+  803b51:	68 d1 02 00 00       	push   $0x2d1
+  803b56:	68 25 5a 80 00       	push   $0x805a25
+  803b5b:	e8 c8 c6 ff ff       	call   800228 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803b60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b65:	e9 83 fe ff ff       	jmp    8039ed <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803b6a:	50                   	push   %eax
+  803b6b:	68 10 5d 80 00       	push   $0x805d10
+  803b70:	68 0a 03 00 00       	push   $0x30a
+  803b75:	68 25 5a 80 00       	push   $0x805a25
+  803b7a:	e8 a9 c6 ff ff       	call   800228 <_panic>
+		return -E_NO_MEM;
+  803b7f:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803b84:	e9 64 fe ff ff       	jmp    8039ed <page_out+0xda>
+		return -E_PAGING;
+  803b89:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803b8e:	e9 5a fe ff ff       	jmp    8039ed <page_out+0xda>
+
+00803b93 <page_alloc>:
+{
+  803b93:	55                   	push   %ebp
+  803b94:	89 e5                	mov    %esp,%ebp
+  803b96:	57                   	push   %edi
+  803b97:	56                   	push   %esi
+  803b98:	53                   	push   %ebx
+  803b99:	83 ec 0c             	sub    $0xc,%esp
+  803b9c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803b9f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803ba2:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803ba9:	74 34                	je     803bdf <page_alloc+0x4c>
+	if (check_mte)
+  803bab:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803baf:	75 35                	jne    803be6 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803bb1:	83 ec 04             	sub    $0x4,%esp
+  803bb4:	ff 75 10             	push   0x10(%ebp)
+  803bb7:	56                   	push   %esi
+  803bb8:	57                   	push   %edi
+  803bb9:	e8 1f d2 ff ff       	call   800ddd <sys_page_alloc>
+  803bbe:	89 c3                	mov    %eax,%ebx
+  803bc0:	83 c4 10             	add    $0x10,%esp
+  803bc3:	85 c0                	test   %eax,%eax
+  803bc5:	79 52                	jns    803c19 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803bc7:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803bca:	75 52                	jne    803c1e <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803bcc:	83 ec 08             	sub    $0x8,%esp
+  803bcf:	56                   	push   %esi
+  803bd0:	57                   	push   %edi
+  803bd1:	e8 3d fd ff ff       	call   803913 <page_out>
+  803bd6:	83 c4 10             	add    $0x10,%esp
+  803bd9:	85 c0                	test   %eax,%eax
+  803bdb:	79 d4                	jns    803bb1 <page_alloc+0x1e>
+  803bdd:	eb 3f                	jmp    803c1e <page_alloc+0x8b>
+		init_map_dir();
+  803bdf:	e8 2f fc ff ff       	call   803813 <init_map_dir>
+  803be4:	eb c5                	jmp    803bab <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803be6:	83 ec 08             	sub    $0x8,%esp
+  803be9:	6a 00                	push   $0x0
+  803beb:	56                   	push   %esi
+  803bec:	e8 78 fc ff ff       	call   803869 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803bf1:	83 c4 10             	add    $0x10,%esp
+  803bf4:	85 c0                	test   %eax,%eax
+  803bf6:	74 b9                	je     803bb1 <page_alloc+0x1e>
+  803bf8:	8b 10                	mov    (%eax),%edx
+  803bfa:	f6 c2 01             	test   $0x1,%dl
+  803bfd:	74 b2                	je     803bb1 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803bff:	83 ec 08             	sub    $0x8,%esp
+  803c02:	56                   	push   %esi
+  803c03:	52                   	push   %edx
+  803c04:	50                   	push   %eax
+  803c05:	68 34 5d 80 00       	push   $0x805d34
+  803c0a:	68 34 03 00 00       	push   $0x334
+  803c0f:	68 25 5a 80 00       	push   $0x805a25
+  803c14:	e8 0f c6 ff ff       	call   800228 <_panic>
+	return 0;
+  803c19:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c1e:	89 d8                	mov    %ebx,%eax
+  803c20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c23:	5b                   	pop    %ebx
+  803c24:	5e                   	pop    %esi
+  803c25:	5f                   	pop    %edi
+  803c26:	5d                   	pop    %ebp
+  803c27:	c3                   	ret
+
+00803c28 <page_adopt>:
+{
+  803c28:	55                   	push   %ebp
+  803c29:	89 e5                	mov    %esp,%ebp
+  803c2b:	56                   	push   %esi
+  803c2c:	53                   	push   %ebx
+  803c2d:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803c2f:	c1 e8 16             	shr    $0x16,%eax
+  803c32:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803c39:	25 81 00 00 00       	and    $0x81,%eax
+  803c3e:	83 f8 01             	cmp    $0x1,%eax
+  803c41:	75 53                	jne    803c96 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803c43:	89 d8                	mov    %ebx,%eax
+  803c45:	c1 e8 0c             	shr    $0xc,%eax
+  803c48:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803c4f:	89 f2                	mov    %esi,%edx
+  803c51:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803c57:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803c5c:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803c62:	75 37                	jne    803c9b <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803c64:	83 ec 08             	sub    $0x8,%esp
+  803c67:	6a 01                	push   $0x1
+  803c69:	53                   	push   %ebx
+  803c6a:	e8 fa fb ff ff       	call   803869 <umapdir_walk>
+  803c6f:	83 c4 10             	add    $0x10,%esp
+  803c72:	85 c0                	test   %eax,%eax
+  803c74:	74 2c                	je     803ca2 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803c76:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803c7c:	83 ce 01             	or     $0x1,%esi
+  803c7f:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803c81:	83 ec 08             	sub    $0x8,%esp
+  803c84:	53                   	push   %ebx
+  803c85:	6a 00                	push   $0x0
+  803c87:	e8 d6 d1 ff ff       	call   800e62 <sys_page_unmap>
+	return 1;
+  803c8c:	83 c4 10             	add    $0x10,%esp
+  803c8f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803c94:	eb 05                	jmp    803c9b <page_adopt+0x73>
+		return 0;
+  803c96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c9e:	5b                   	pop    %ebx
+  803c9f:	5e                   	pop    %esi
+  803ca0:	5d                   	pop    %ebp
+  803ca1:	c3                   	ret
+		return -E_NO_MEM;
+  803ca2:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803ca7:	eb f2                	jmp    803c9b <page_adopt+0x73>
+
+00803ca9 <page_forget>:
+{
+  803ca9:	55                   	push   %ebp
+  803caa:	89 e5                	mov    %esp,%ebp
+  803cac:	53                   	push   %ebx
+  803cad:	83 ec 04             	sub    $0x4,%esp
+  803cb0:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803cb2:	e8 4a ef ff ff       	call   802c01 <find_paging_env>
+	if (pagingenv == 0)
+  803cb7:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803cbe:	74 39                	je     803cf9 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803cc0:	89 d8                	mov    %ebx,%eax
+  803cc2:	c1 e8 16             	shr    $0x16,%eax
+  803cc5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803ccc:	25 81 00 00 00       	and    $0x81,%eax
+  803cd1:	83 f8 01             	cmp    $0x1,%eax
+  803cd4:	74 28                	je     803cfe <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803cd6:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803cdd:	74 1a                	je     803cf9 <page_forget+0x50>
+  803cdf:	83 ec 08             	sub    $0x8,%esp
+  803ce2:	6a 00                	push   $0x0
+  803ce4:	53                   	push   %ebx
+  803ce5:	e8 7f fb ff ff       	call   803869 <umapdir_walk>
+  803cea:	89 c3                	mov    %eax,%ebx
+  803cec:	83 c4 10             	add    $0x10,%esp
+  803cef:	85 c0                	test   %eax,%eax
+  803cf1:	74 06                	je     803cf9 <page_forget+0x50>
+  803cf3:	8b 00                	mov    (%eax),%eax
+  803cf5:	a8 01                	test   $0x1,%al
+  803cf7:	75 2b                	jne    803d24 <page_forget+0x7b>
+}
+  803cf9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803cfc:	c9                   	leave
+  803cfd:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803cfe:	89 d8                	mov    %ebx,%eax
+  803d00:	c1 e8 0c             	shr    $0xc,%eax
+  803d03:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803d0a:	89 c2                	mov    %eax,%edx
+  803d0c:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803d12:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803d18:	75 bc                	jne    803cd6 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803d1a:	c1 e8 0c             	shr    $0xc,%eax
+  803d1d:	e8 5c ee ff ff       	call   802b7e <page_remove_slot>
+		return;
+  803d22:	eb d5                	jmp    803cf9 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803d24:	c1 e8 0c             	shr    $0xc,%eax
+  803d27:	e8 52 ee ff ff       	call   802b7e <page_remove_slot>
+	*mte = 0;
+  803d2c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803d32:	eb c5                	jmp    803cf9 <page_forget+0x50>
+
+00803d34 <page_unmap>:
+{
+  803d34:	55                   	push   %ebp
+  803d35:	89 e5                	mov    %esp,%ebp
+  803d37:	57                   	push   %edi
+  803d38:	56                   	push   %esi
+  803d39:	53                   	push   %ebx
+  803d3a:	83 ec 0c             	sub    $0xc,%esp
+  803d3d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803d40:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803d43:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803d48:	8b 40 48             	mov    0x48(%eax),%eax
+  803d4b:	85 db                	test   %ebx,%ebx
+  803d4d:	0f 8e b4 00 00 00    	jle    803e07 <page_unmap+0xd3>
+  803d53:	39 d8                	cmp    %ebx,%eax
+  803d55:	0f 84 ac 00 00 00    	je     803e07 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803d5b:	83 ec 08             	sub    $0x8,%esp
+  803d5e:	57                   	push   %edi
+  803d5f:	53                   	push   %ebx
+  803d60:	e8 fd d0 ff ff       	call   800e62 <sys_page_unmap>
+  803d65:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803d67:	e8 95 ee ff ff       	call   802c01 <find_paging_env>
+	if (pagingenv == 0)
+  803d6c:	83 c4 10             	add    $0x10,%esp
+  803d6f:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803d76:	0f 84 a1 00 00 00    	je     803e1d <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803d7c:	83 ec 0c             	sub    $0xc,%esp
+  803d7f:	6a 05                	push   $0x5
+  803d81:	68 00 00 40 00       	push   $0x400000
+  803d86:	6a 00                	push   $0x0
+  803d88:	68 00 b0 ad de       	push   $0xdeadb000
+  803d8d:	53                   	push   %ebx
+  803d8e:	e8 8d d0 ff ff       	call   800e20 <sys_page_map>
+  803d93:	83 c4 20             	add    $0x20,%esp
+  803d96:	85 c0                	test   %eax,%eax
+  803d98:	0f 88 89 00 00 00    	js     803e27 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803d9e:	89 f8                	mov    %edi,%eax
+  803da0:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803da3:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803daa:	a8 01                	test   $0x1,%al
+  803dac:	74 6f                	je     803e1d <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803dae:	83 ec 0c             	sub    $0xc,%esp
+  803db1:	6a 05                	push   $0x5
+  803db3:	68 00 00 40 00       	push   $0x400000
+  803db8:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803dba:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803dbf:	50                   	push   %eax
+  803dc0:	53                   	push   %ebx
+  803dc1:	e8 5a d0 ff ff       	call   800e20 <sys_page_map>
+  803dc6:	83 c4 20             	add    $0x20,%esp
+  803dc9:	85 c0                	test   %eax,%eax
+  803dcb:	78 6f                	js     803e3c <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803dcd:	c1 ef 0c             	shr    $0xc,%edi
+  803dd0:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803dd6:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803ddd:	01 
+  803dde:	74 3d                	je     803e1d <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803de0:	83 ec 08             	sub    $0x8,%esp
+  803de3:	68 00 00 40 00       	push   $0x400000
+  803de8:	6a 00                	push   $0x0
+  803dea:	e8 73 d0 ff ff       	call   800e62 <sys_page_unmap>
+  803def:	83 c4 10             	add    $0x10,%esp
+  803df2:	85 c0                	test   %eax,%eax
+  803df4:	78 5b                	js     803e51 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803df6:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803dfd:	c1 e8 0c             	shr    $0xc,%eax
+  803e00:	e8 79 ed ff ff       	call   802b7e <page_remove_slot>
+	return r;
+  803e05:	eb 16                	jmp    803e1d <page_unmap+0xe9>
+		page_forget(va);
+  803e07:	89 f8                	mov    %edi,%eax
+  803e09:	e8 9b fe ff ff       	call   803ca9 <page_forget>
+		return sys_page_unmap(envid, va);
+  803e0e:	83 ec 08             	sub    $0x8,%esp
+  803e11:	57                   	push   %edi
+  803e12:	53                   	push   %ebx
+  803e13:	e8 4a d0 ff ff       	call   800e62 <sys_page_unmap>
+  803e18:	89 c6                	mov    %eax,%esi
+  803e1a:	83 c4 10             	add    $0x10,%esp
+}
+  803e1d:	89 f0                	mov    %esi,%eax
+  803e1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e22:	5b                   	pop    %ebx
+  803e23:	5e                   	pop    %esi
+  803e24:	5f                   	pop    %edi
+  803e25:	5d                   	pop    %ebp
+  803e26:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803e27:	50                   	push   %eax
+  803e28:	68 70 5d 80 00       	push   $0x805d70
+  803e2d:	68 e4 03 00 00       	push   $0x3e4
+  803e32:	68 25 5a 80 00       	push   $0x805a25
+  803e37:	e8 ec c3 ff ff       	call   800228 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803e3c:	50                   	push   %eax
+  803e3d:	68 9c 5d 80 00       	push   $0x805d9c
+  803e42:	68 ea 03 00 00       	push   $0x3ea
+  803e47:	68 25 5a 80 00       	push   $0x805a25
+  803e4c:	e8 d7 c3 ff ff       	call   800228 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803e51:	50                   	push   %eax
+  803e52:	68 c8 5d 80 00       	push   $0x805dc8
+  803e57:	68 ef 03 00 00       	push   $0x3ef
+  803e5c:	68 25 5a 80 00       	push   $0x805a25
+  803e61:	e8 c2 c3 ff ff       	call   800228 <_panic>
+
+00803e66 <page_unmap_range>:
+{
+  803e66:	55                   	push   %ebp
+  803e67:	89 e5                	mov    %esp,%ebp
+  803e69:	57                   	push   %edi
+  803e6a:	56                   	push   %esi
+  803e6b:	53                   	push   %ebx
+  803e6c:	83 ec 0c             	sub    $0xc,%esp
+  803e6f:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803e72:	e8 8a ed ff ff       	call   802c01 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803e77:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803e7c:	8b 40 48             	mov    0x48(%eax),%eax
+  803e7f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803e83:	7e 38                	jle    803ebd <page_unmap_range+0x57>
+  803e85:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803e88:	74 33                	je     803ebd <page_unmap_range+0x57>
+  803e8a:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803e91:	74 2a                	je     803ebd <page_unmap_range+0x57>
+  803e93:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  803e96:	be 00 00 00 00       	mov    $0x0,%esi
+  803e9b:	39 fe                	cmp    %edi,%esi
+  803e9d:	74 56                	je     803ef5 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  803e9f:	83 ec 08             	sub    $0x8,%esp
+  803ea2:	53                   	push   %ebx
+  803ea3:	ff 75 08             	push   0x8(%ebp)
+  803ea6:	e8 89 fe ff ff       	call   803d34 <page_unmap>
+  803eab:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803eb1:	83 c4 10             	add    $0x10,%esp
+  803eb4:	85 c0                	test   %eax,%eax
+  803eb6:	78 35                	js     803eed <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  803eb8:	83 c6 01             	add    $0x1,%esi
+  803ebb:	eb de                	jmp    803e9b <page_unmap_range+0x35>
+  803ebd:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803ec0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ec5:	eb 10                	jmp    803ed7 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803ec7:	89 f0                	mov    %esi,%eax
+  803ec9:	e8 db fd ff ff       	call   803ca9 <page_forget>
+		for (i = 0; i < npages; i++)
+  803ece:	83 c3 01             	add    $0x1,%ebx
+  803ed1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803ed7:	39 fb                	cmp    %edi,%ebx
+  803ed9:	75 ec                	jne    803ec7 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  803edb:	83 ec 04             	sub    $0x4,%esp
+  803ede:	57                   	push   %edi
+  803edf:	ff 75 0c             	push   0xc(%ebp)
+  803ee2:	ff 75 08             	push   0x8(%ebp)
+  803ee5:	e8 8c d0 ff ff       	call   800f76 <sys_page_unmap_range>
+  803eea:	83 c4 10             	add    $0x10,%esp
+}
+  803eed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ef0:	5b                   	pop    %ebx
+  803ef1:	5e                   	pop    %esi
+  803ef2:	5f                   	pop    %edi
+  803ef3:	5d                   	pop    %ebp
+  803ef4:	c3                   	ret
+	return 0;
+  803ef5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803efa:	eb f1                	jmp    803eed <page_unmap_range+0x87>
+
+00803efc <page_alloc_range>:
+{
+  803efc:	55                   	push   %ebp
+  803efd:	89 e5                	mov    %esp,%ebp
+  803eff:	57                   	push   %edi
+  803f00:	56                   	push   %esi
+  803f01:	53                   	push   %ebx
+  803f02:	83 ec 1c             	sub    $0x1c,%esp
+  803f05:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803f08:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  803f0b:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803f12:	74 14                	je     803f28 <page_alloc_range+0x2c>
+	if (check_mte)
+  803f14:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803f18:	74 66                	je     803f80 <page_alloc_range+0x84>
+  803f1a:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  803f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f21:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803f24:	89 c7                	mov    %eax,%edi
+  803f26:	eb 10                	jmp    803f38 <page_alloc_range+0x3c>
+		init_map_dir();
+  803f28:	e8 e6 f8 ff ff       	call   803813 <init_map_dir>
+  803f2d:	eb e5                	jmp    803f14 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803f2f:	83 c7 01             	add    $0x1,%edi
+  803f32:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803f38:	39 df                	cmp    %ebx,%edi
+  803f3a:	74 38                	je     803f74 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  803f3c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803f3f:	83 ec 08             	sub    $0x8,%esp
+  803f42:	6a 00                	push   $0x0
+  803f44:	56                   	push   %esi
+  803f45:	e8 1f f9 ff ff       	call   803869 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  803f4a:	83 c4 10             	add    $0x10,%esp
+  803f4d:	85 c0                	test   %eax,%eax
+  803f4f:	74 de                	je     803f2f <page_alloc_range+0x33>
+  803f51:	8b 10                	mov    (%eax),%edx
+  803f53:	f6 c2 01             	test   $0x1,%dl
+  803f56:	74 d7                	je     803f2f <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  803f58:	83 ec 08             	sub    $0x8,%esp
+  803f5b:	ff 75 e4             	push   -0x1c(%ebp)
+  803f5e:	52                   	push   %edx
+  803f5f:	50                   	push   %eax
+  803f60:	68 34 5d 80 00       	push   $0x805d34
+  803f65:	68 0b 04 00 00       	push   $0x40b
+  803f6a:	68 25 5a 80 00       	push   $0x805a25
+  803f6f:	e8 b4 c2 ff ff       	call   800228 <_panic>
+  803f74:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803f77:	eb 07                	jmp    803f80 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  803f79:	c1 e0 0c             	shl    $0xc,%eax
+  803f7c:	01 c7                	add    %eax,%edi
+			npages -= r;
+  803f7e:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  803f80:	85 db                	test   %ebx,%ebx
+  803f82:	74 30                	je     803fb4 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  803f84:	ff 75 14             	push   0x14(%ebp)
+  803f87:	53                   	push   %ebx
+  803f88:	57                   	push   %edi
+  803f89:	ff 75 08             	push   0x8(%ebp)
+  803f8c:	e8 77 cf ff ff       	call   800f08 <sys_page_alloc_range>
+  803f91:	89 c6                	mov    %eax,%esi
+  803f93:	83 c4 10             	add    $0x10,%esp
+  803f96:	85 c0                	test   %eax,%eax
+  803f98:	7f df                	jg     803f79 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  803f9a:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  803f9d:	75 1a                	jne    803fb9 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  803f9f:	83 ec 08             	sub    $0x8,%esp
+  803fa2:	57                   	push   %edi
+  803fa3:	ff 75 08             	push   0x8(%ebp)
+  803fa6:	e8 68 f9 ff ff       	call   803913 <page_out>
+  803fab:	83 c4 10             	add    $0x10,%esp
+  803fae:	85 c0                	test   %eax,%eax
+  803fb0:	79 ce                	jns    803f80 <page_alloc_range+0x84>
+  803fb2:	eb 05                	jmp    803fb9 <page_alloc_range+0xbd>
+	return 0;
+  803fb4:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803fb9:	89 f0                	mov    %esi,%eax
+  803fbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fbe:	5b                   	pop    %ebx
+  803fbf:	5e                   	pop    %esi
+  803fc0:	5f                   	pop    %edi
+  803fc1:	5d                   	pop    %ebp
+  803fc2:	c3                   	ret
+
+00803fc3 <page_in>:
+{
+  803fc3:	55                   	push   %ebp
+  803fc4:	89 e5                	mov    %esp,%ebp
+  803fc6:	57                   	push   %edi
+  803fc7:	56                   	push   %esi
+  803fc8:	53                   	push   %ebx
+  803fc9:	83 ec 3c             	sub    $0x3c,%esp
+  803fcc:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  803fcf:	e8 2d ec ff ff       	call   802c01 <find_paging_env>
+	if (pagingenv == 0)
+  803fd4:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803fdb:	0f 84 09 02 00 00    	je     8041ea <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  803fe1:	83 ec 08             	sub    $0x8,%esp
+  803fe4:	6a 00                	push   $0x0
+  803fe6:	56                   	push   %esi
+  803fe7:	e8 7d f8 ff ff       	call   803869 <umapdir_walk>
+  803fec:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803fee:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803ff4:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  803ff7:	83 c4 10             	add    $0x10,%esp
+  803ffa:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803ffe:	74 0d                	je     80400d <page_in+0x4a>
+  804000:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804005:	8b 40 48             	mov    0x48(%eax),%eax
+  804008:	3b 45 08             	cmp    0x8(%ebp),%eax
+  80400b:	75 06                	jne    804013 <page_in+0x50>
+  80400d:	8b 03                	mov    (%ebx),%eax
+  80400f:	a8 02                	test   $0x2,%al
+  804011:	75 63                	jne    804076 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  804013:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  804015:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804017:	89 f0                	mov    %esi,%eax
+  804019:	25 06 0e 00 00       	and    $0xe06,%eax
+  80401e:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  804021:	50                   	push   %eax
+  804022:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804025:	57                   	push   %edi
+  804026:	ff 75 08             	push   0x8(%ebp)
+  804029:	e8 65 fb ff ff       	call   803b93 <page_alloc>
+  80402e:	83 c4 10             	add    $0x10,%esp
+  804031:	85 c0                	test   %eax,%eax
+  804033:	78 39                	js     80406e <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  804035:	89 f0                	mov    %esi,%eax
+  804037:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  80403a:	83 ec 0c             	sub    $0xc,%esp
+  80403d:	6a 07                	push   $0x7
+  80403f:	6a 01                	push   $0x1
+  804041:	57                   	push   %edi
+  804042:	c1 e0 04             	shl    $0x4,%eax
+  804045:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  804046:	c1 ee 1c             	shr    $0x1c,%esi
+  804049:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  80404c:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  804053:	e8 f1 0f 00 00       	call   805049 <ipc_call>
+  804058:	83 c4 20             	add    $0x20,%esp
+  80405b:	85 c0                	test   %eax,%eax
+  80405d:	0f 88 72 01 00 00    	js     8041d5 <page_in+0x212>
+	*mte = 0;
+  804063:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  804069:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80406e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804071:	5b                   	pop    %ebx
+  804072:	5e                   	pop    %esi
+  804073:	5f                   	pop    %edi
+  804074:	5d                   	pop    %ebp
+  804075:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804076:	25 06 0e 00 00       	and    $0xe06,%eax
+  80407b:	83 c8 01             	or     $0x1,%eax
+  80407e:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  804081:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804084:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  804087:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  80408d:	be 01 00 00 00       	mov    $0x1,%esi
+  804092:	eb 46                	jmp    8040da <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  804094:	83 ec 08             	sub    $0x8,%esp
+  804097:	6a 00                	push   $0x0
+  804099:	51                   	push   %ecx
+  80409a:	e8 ca f7 ff ff       	call   803869 <umapdir_walk>
+  80409f:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  8040a3:	83 c4 10             	add    $0x10,%esp
+  8040a6:	85 c0                	test   %eax,%eax
+  8040a8:	74 66                	je     804110 <page_in+0x14d>
+  8040aa:	8b 00                	mov    (%eax),%eax
+  8040ac:	a8 01                	test   $0x1,%al
+  8040ae:	74 60                	je     804110 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  8040b0:	89 c2                	mov    %eax,%edx
+  8040b2:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  8040b8:	83 ca 01             	or     $0x1,%edx
+  8040bb:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  8040be:	75 50                	jne    804110 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  8040c0:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8040c6:	c1 e8 1c             	shr    $0x1c,%eax
+  8040c9:	8b 13                	mov    (%ebx),%edx
+  8040cb:	c1 ea 1c             	shr    $0x1c,%edx
+  8040ce:	39 d0                	cmp    %edx,%eax
+  8040d0:	75 3e                	jne    804110 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  8040d2:	83 c6 01             	add    $0x1,%esi
+  8040d5:	83 fe 08             	cmp    $0x8,%esi
+  8040d8:	74 3f                	je     804119 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  8040da:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8040dc:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  8040e2:	77 2c                	ja     804110 <page_in+0x14d>
+  8040e4:	89 f8                	mov    %edi,%eax
+  8040e6:	c1 e8 16             	shr    $0x16,%eax
+  8040e9:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8040f0:	f6 c2 01             	test   $0x1,%dl
+  8040f3:	74 9f                	je     804094 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  8040f5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8040fc:	a8 80                	test   $0x80,%al
+  8040fe:	75 10                	jne    804110 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804100:	89 f8                	mov    %edi,%eax
+  804102:	c1 e8 0c             	shr    $0xc,%eax
+  804105:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80410c:	a8 01                	test   $0x1,%al
+  80410e:	74 84                	je     804094 <page_in+0xd1>
+	if (n == 1)
+  804110:	83 fe 01             	cmp    $0x1,%esi
+  804113:	0f 84 fa fe ff ff    	je     804013 <page_in+0x50>
+	req.nslots = n;
+  804119:	89 35 00 90 80 00    	mov    %esi,0x809000
+	for (i = 0; i < n; i++)
+  80411f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804124:	eb 13                	jmp    804139 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  804126:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  80412a:	8b 12                	mov    (%edx),%edx
+  80412c:	c1 ea 0c             	shr    $0xc,%edx
+  80412f:	89 14 85 04 90 80 00 	mov    %edx,0x809004(,%eax,4)
+	for (i = 0; i < n; i++)
+  804136:	83 c0 01             	add    $0x1,%eax
+  804139:	39 c6                	cmp    %eax,%esi
+  80413b:	75 e9                	jne    804126 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  80413d:	83 ec 0c             	sub    $0xc,%esp
+  804140:	6a 00                	push   $0x0
+  804142:	ff 75 c0             	push   -0x40(%ebp)
+  804145:	56                   	push   %esi
+  804146:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804149:	57                   	push   %edi
+  80414a:	6a 00                	push   $0x0
+  80414c:	e8 ab fd ff ff       	call   803efc <page_alloc_range>
+  804151:	83 c4 20             	add    $0x20,%esp
+  804154:	85 c0                	test   %eax,%eax
+  804156:	78 6e                	js     8041c6 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  804158:	83 ec 04             	sub    $0x4,%esp
+  80415b:	6a 24                	push   $0x24
+  80415d:	68 00 90 80 00       	push   $0x809000
+  804162:	57                   	push   %edi
+  804163:	e8 08 c9 ff ff       	call   800a70 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804168:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80416f:	56                   	push   %esi
+  804170:	57                   	push   %edi
+  804171:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  804173:	0f b7 05 06 90 80 00 	movzwl 0x809006,%eax
+  80417a:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  80417d:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  804184:	e8 c0 0e 00 00       	call   805049 <ipc_call>
+  804189:	83 c4 20             	add    $0x20,%esp
+  80418c:	85 c0                	test   %eax,%eax
+  80418e:	78 08                	js     804198 <page_in+0x1d5>
+  804190:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  804193:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  804196:	eb 20                	jmp    8041b8 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  804198:	50                   	push   %eax
+  804199:	68 f4 5d 80 00       	push   $0x805df4
+  80419e:	68 59 02 00 00       	push   $0x259
+  8041a3:	68 25 5a 80 00       	push   $0x805a25
+  8041a8:	e8 7b c0 ff ff       	call   800228 <_panic>
+		*mtes[i] = 0;
+  8041ad:	8b 10                	mov    (%eax),%edx
+  8041af:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  8041b5:	83 c0 04             	add    $0x4,%eax
+  8041b8:	39 c8                	cmp    %ecx,%eax
+  8041ba:	75 f1                	jne    8041ad <page_in+0x1ea>
+	return n;
+  8041bc:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  8041be:	85 f6                	test   %esi,%esi
+  8041c0:	0f 84 4d fe ff ff    	je     804013 <page_in+0x50>
+		return r < 0 ? r : 0;
+  8041c6:	85 c0                	test   %eax,%eax
+  8041c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041cd:	0f 4f c2             	cmovg  %edx,%eax
+  8041d0:	e9 99 fe ff ff       	jmp    80406e <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  8041d5:	50                   	push   %eax
+  8041d6:	68 2c 5e 80 00       	push   $0x805e2c
+  8041db:	68 9a 02 00 00       	push   $0x29a
+  8041e0:	68 25 5a 80 00       	push   $0x805a25
+  8041e5:	e8 3e c0 ff ff       	call   800228 <_panic>
+		return -E_PAGING;
+  8041ea:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8041ef:	e9 7a fe ff ff       	jmp    80406e <page_in+0xab>
+
+008041f4 <page_map>:
+{
+  8041f4:	55                   	push   %ebp
+  8041f5:	89 e5                	mov    %esp,%ebp
+  8041f7:	57                   	push   %edi
+  8041f8:	56                   	push   %esi
+  8041f9:	53                   	push   %ebx
+  8041fa:	83 ec 1c             	sub    $0x1c,%esp
+  8041fd:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  804200:	83 ec 0c             	sub    $0xc,%esp
+  804203:	ff 75 18             	push   0x18(%ebp)
+  804206:	ff 75 14             	push   0x14(%ebp)
+  804209:	ff 75 10             	push   0x10(%ebp)
+  80420c:	ff 75 0c             	push   0xc(%ebp)
+  80420f:	56                   	push   %esi
+  804210:	e8 0b cc ff ff       	call   800e20 <sys_page_map>
+  804215:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804218:	83 c4 20             	add    $0x20,%esp
+  80421b:	85 c0                	test   %eax,%eax
+  80421d:	0f 89 a9 01 00 00    	jns    8043cc <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  804223:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  804227:	74 5f                	je     804288 <page_map+0x94>
+		if (r != -E_INVAL)
+  804229:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  80422d:	0f 85 a0 01 00 00    	jne    8043d3 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804233:	85 f6                	test   %esi,%esi
+  804235:	74 70                	je     8042a7 <page_map+0xb3>
+  804237:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80423c:	8b 40 48             	mov    0x48(%eax),%eax
+  80423f:	39 f0                	cmp    %esi,%eax
+  804241:	74 64                	je     8042a7 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804243:	83 ec 0c             	sub    $0xc,%esp
+  804246:	6a 05                	push   $0x5
+  804248:	68 00 00 40 00       	push   $0x400000
+  80424d:	6a 00                	push   $0x0
+  80424f:	68 00 b0 ad de       	push   $0xdeadb000
+  804254:	56                   	push   %esi
+  804255:	e8 c6 cb ff ff       	call   800e20 <sys_page_map>
+  80425a:	89 c3                	mov    %eax,%ebx
+  80425c:	83 c4 20             	add    $0x20,%esp
+  80425f:	85 c0                	test   %eax,%eax
+  804261:	79 6a                	jns    8042cd <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  804263:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804266:	75 50                	jne    8042b8 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  804268:	83 ec 08             	sub    $0x8,%esp
+  80426b:	68 00 00 40 00       	push   $0x400000
+  804270:	6a fc                	push   $0xfffffffc
+  804272:	e8 9c f6 ff ff       	call   803913 <page_out>
+  804277:	83 c4 10             	add    $0x10,%esp
+  80427a:	85 c0                	test   %eax,%eax
+  80427c:	79 c5                	jns    804243 <page_map+0x4f>
+}
+  80427e:	89 d8                	mov    %ebx,%eax
+  804280:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804283:	5b                   	pop    %ebx
+  804284:	5e                   	pop    %esi
+  804285:	5f                   	pop    %edi
+  804286:	5d                   	pop    %ebp
+  804287:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  804288:	83 ec 08             	sub    $0x8,%esp
+  80428b:	68 00 00 40 00       	push   $0x400000
+  804290:	6a 00                	push   $0x0
+  804292:	e8 7c f6 ff ff       	call   803913 <page_out>
+  804297:	83 c4 10             	add    $0x10,%esp
+  80429a:	85 c0                	test   %eax,%eax
+  80429c:	0f 89 5e ff ff ff    	jns    804200 <page_map+0xc>
+				return r;
+  8042a2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8042a5:	eb d7                	jmp    80427e <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8042a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8042aa:	e8 79 f9 ff ff       	call   803c28 <page_adopt>
+  8042af:	85 c0                	test   %eax,%eax
+  8042b1:	79 90                	jns    804243 <page_map+0x4f>
+			return r;
+  8042b3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8042b6:	eb c6                	jmp    80427e <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  8042b8:	53                   	push   %ebx
+  8042b9:	68 60 5e 80 00       	push   $0x805e60
+  8042be:	68 77 03 00 00       	push   $0x377
+  8042c3:	68 25 5a 80 00       	push   $0x805a25
+  8042c8:	e8 5b bf ff ff       	call   800228 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  8042cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8042d0:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8042d3:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  8042da:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8042e0:	0f 84 f5 00 00 00    	je     8043db <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8042e6:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8042ec:	83 ec 0c             	sub    $0xc,%esp
+  8042ef:	6a 05                	push   $0x5
+  8042f1:	68 00 00 40 00       	push   $0x400000
+  8042f6:	6a 00                	push   $0x0
+  8042f8:	57                   	push   %edi
+  8042f9:	56                   	push   %esi
+  8042fa:	e8 21 cb ff ff       	call   800e20 <sys_page_map>
+  8042ff:	89 c3                	mov    %eax,%ebx
+  804301:	83 c4 20             	add    $0x20,%esp
+  804304:	85 c0                	test   %eax,%eax
+  804306:	79 35                	jns    80433d <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  804308:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80430b:	75 1b                	jne    804328 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  80430d:	83 ec 08             	sub    $0x8,%esp
+  804310:	68 00 00 40 00       	push   $0x400000
+  804315:	6a 00                	push   $0x0
+  804317:	e8 f7 f5 ff ff       	call   803913 <page_out>
+  80431c:	83 c4 10             	add    $0x10,%esp
+  80431f:	85 c0                	test   %eax,%eax
+  804321:	79 c9                	jns    8042ec <page_map+0xf8>
+  804323:	e9 56 ff ff ff       	jmp    80427e <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  804328:	53                   	push   %ebx
+  804329:	68 88 5e 80 00       	push   $0x805e88
+  80432e:	68 83 03 00 00       	push   $0x383
+  804333:	68 25 5a 80 00       	push   $0x805a25
+  804338:	e8 eb be ff ff       	call   800228 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  80433d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804340:	c1 e8 0c             	shr    $0xc,%eax
+  804343:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  804348:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  80434f:	01 
+  804350:	0f 84 8d 00 00 00    	je     8043e3 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  804356:	83 ec 08             	sub    $0x8,%esp
+  804359:	68 00 00 40 00       	push   $0x400000
+  80435e:	6a 00                	push   $0x0
+  804360:	e8 fd ca ff ff       	call   800e62 <sys_page_unmap>
+  804365:	83 c4 10             	add    $0x10,%esp
+  804368:	85 c0                	test   %eax,%eax
+  80436a:	78 36                	js     8043a2 <page_map+0x1ae>
+  80436c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  80436f:	83 ec 08             	sub    $0x8,%esp
+  804372:	57                   	push   %edi
+  804373:	56                   	push   %esi
+  804374:	e8 4a fc ff ff       	call   803fc3 <page_in>
+  804379:	89 c3                	mov    %eax,%ebx
+  80437b:	83 c4 10             	add    $0x10,%esp
+  80437e:	85 c0                	test   %eax,%eax
+  804380:	0f 89 7a fe ff ff    	jns    804200 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  804386:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804389:	75 2c                	jne    8043b7 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  80438b:	83 ec 08             	sub    $0x8,%esp
+  80438e:	57                   	push   %edi
+  80438f:	6a 00                	push   $0x0
+  804391:	e8 7d f5 ff ff       	call   803913 <page_out>
+  804396:	83 c4 10             	add    $0x10,%esp
+  804399:	85 c0                	test   %eax,%eax
+  80439b:	79 d2                	jns    80436f <page_map+0x17b>
+  80439d:	e9 dc fe ff ff       	jmp    80427e <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  8043a2:	50                   	push   %eax
+  8043a3:	68 b4 5e 80 00       	push   $0x805eb4
+  8043a8:	68 8b 03 00 00       	push   $0x38b
+  8043ad:	68 25 5a 80 00       	push   $0x805a25
+  8043b2:	e8 71 be ff ff       	call   800228 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  8043b7:	53                   	push   %ebx
+  8043b8:	68 dc 5e 80 00       	push   $0x805edc
+  8043bd:	68 91 03 00 00       	push   $0x391
+  8043c2:	68 25 5a 80 00       	push   $0x805a25
+  8043c7:	e8 5c be ff ff       	call   800228 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8043cc:	89 c3                	mov    %eax,%ebx
+  8043ce:	e9 ab fe ff ff       	jmp    80427e <page_map+0x8a>
+  8043d3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8043d6:	e9 a3 fe ff ff       	jmp    80427e <page_map+0x8a>
+			return r; // Pass through the error
+  8043db:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8043de:	e9 9b fe ff ff       	jmp    80427e <page_map+0x8a>
+			return r; // Pass through the error
+  8043e3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8043e6:	e9 93 fe ff ff       	jmp    80427e <page_map+0x8a>
+
+008043eb <page_map_range>:
+{
+  8043eb:	55                   	push   %ebp
+  8043ec:	89 e5                	mov    %esp,%ebp
+  8043ee:	57                   	push   %edi
+  8043ef:	56                   	push   %esi
+  8043f0:	53                   	push   %ebx
+  8043f1:	83 ec 0c             	sub    $0xc,%esp
+  8043f4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8043f7:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  8043fa:	83 ec 08             	sub    $0x8,%esp
+  8043fd:	ff 75 1c             	push   0x1c(%ebp)
+  804400:	ff 75 18             	push   0x18(%ebp)
+  804403:	56                   	push   %esi
+  804404:	ff 75 10             	push   0x10(%ebp)
+  804407:	57                   	push   %edi
+  804408:	ff 75 08             	push   0x8(%ebp)
+  80440b:	e8 1b cb ff ff       	call   800f2b <sys_page_map_range>
+  804410:	89 c3                	mov    %eax,%ebx
+  804412:	83 c4 20             	add    $0x20,%esp
+  804415:	85 c0                	test   %eax,%eax
+  804417:	79 1b                	jns    804434 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  804419:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80441c:	75 20                	jne    80443e <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  80441e:	83 ec 08             	sub    $0x8,%esp
+  804421:	68 00 00 40 00       	push   $0x400000
+  804426:	6a 00                	push   $0x0
+  804428:	e8 e6 f4 ff ff       	call   803913 <page_out>
+  80442d:	83 c4 10             	add    $0x10,%esp
+  804430:	85 c0                	test   %eax,%eax
+  804432:	79 c6                	jns    8043fa <page_map_range+0xf>
+}
+  804434:	89 d8                	mov    %ebx,%eax
+  804436:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804439:	5b                   	pop    %ebx
+  80443a:	5e                   	pop    %esi
+  80443b:	5f                   	pop    %edi
+  80443c:	5d                   	pop    %ebp
+  80443d:	c3                   	ret
+		if (r != -E_INVAL)
+  80443e:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  804441:	75 f1                	jne    804434 <page_map_range+0x49>
+  804443:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  804445:	be 00 00 00 00       	mov    $0x0,%esi
+  80444a:	eb 03                	jmp    80444f <page_map_range+0x64>
+  80444c:	83 c6 01             	add    $0x1,%esi
+  80444f:	3b 75 18             	cmp    0x18(%ebp),%esi
+  804452:	74 2a                	je     80447e <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  804454:	83 ec 0c             	sub    $0xc,%esp
+  804457:	ff 75 1c             	push   0x1c(%ebp)
+  80445a:	53                   	push   %ebx
+  80445b:	ff 75 10             	push   0x10(%ebp)
+  80445e:	57                   	push   %edi
+  80445f:	ff 75 08             	push   0x8(%ebp)
+  804462:	e8 8d fd ff ff       	call   8041f4 <page_map>
+  804467:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80446d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  804473:	83 c4 20             	add    $0x20,%esp
+  804476:	85 c0                	test   %eax,%eax
+  804478:	79 d2                	jns    80444c <page_map_range+0x61>
+  80447a:	89 c3                	mov    %eax,%ebx
+  80447c:	eb b6                	jmp    804434 <page_map_range+0x49>
+		return 0;
+  80447e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804483:	eb af                	jmp    804434 <page_map_range+0x49>
+
+00804485 <paging_pgfault_handler>:
+{
+  804485:	55                   	push   %ebp
+  804486:	89 e5                	mov    %esp,%ebp
+  804488:	56                   	push   %esi
+  804489:	53                   	push   %ebx
+  80448a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  80448d:	e8 6f e7 ff ff       	call   802c01 <find_paging_env>
+	if (pagingenv == 0)
+  804492:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  804497:	85 c0                	test   %eax,%eax
+  804499:	74 3c                	je     8044d7 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  80449b:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  80449d:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8044a1:	75 12                	jne    8044b5 <paging_pgfault_handler+0x30>
+  8044a3:	89 f0                	mov    %esi,%eax
+  8044a5:	e8 7e f7 ff ff       	call   803c28 <page_adopt>
+  8044aa:	89 c2                	mov    %eax,%edx
+		return 0;
+  8044ac:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  8044b1:	85 d2                	test   %edx,%edx
+  8044b3:	78 22                	js     8044d7 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  8044b5:	83 ec 08             	sub    $0x8,%esp
+  8044b8:	6a 00                	push   $0x0
+  8044ba:	56                   	push   %esi
+  8044bb:	e8 a9 f3 ff ff       	call   803869 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  8044c0:	83 c4 10             	add    $0x10,%esp
+  8044c3:	85 c0                	test   %eax,%eax
+  8044c5:	74 05                	je     8044cc <paging_pgfault_handler+0x47>
+  8044c7:	f6 00 01             	testb  $0x1,(%eax)
+  8044ca:	75 12                	jne    8044de <paging_pgfault_handler+0x59>
+	return 0;
+  8044cc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8044d1:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8044d5:	74 23                	je     8044fa <paging_pgfault_handler+0x75>
+}
+  8044d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8044da:	5b                   	pop    %ebx
+  8044db:	5e                   	pop    %esi
+  8044dc:	5d                   	pop    %ebp
+  8044dd:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  8044de:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8044e3:	8b 40 48             	mov    0x48(%eax),%eax
+  8044e6:	83 ec 08             	sub    $0x8,%esp
+  8044e9:	56                   	push   %esi
+  8044ea:	50                   	push   %eax
+  8044eb:	e8 d3 fa ff ff       	call   803fc3 <page_in>
+  8044f0:	f7 d0                	not    %eax
+  8044f2:	c1 e8 1f             	shr    $0x1f,%eax
+  8044f5:	83 c4 10             	add    $0x10,%esp
+  8044f8:	eb dd                	jmp    8044d7 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8044fa:	89 f0                	mov    %esi,%eax
+  8044fc:	e8 97 e2 ff ff       	call   802798 <segment_lookup>
+  804501:	89 c2                	mov    %eax,%edx
+	return 0;
+  804503:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804508:	85 d2                	test   %edx,%edx
+  80450a:	74 cb                	je     8044d7 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  80450c:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804511:	8b 40 48             	mov    0x48(%eax),%eax
+  804514:	83 ec 08             	sub    $0x8,%esp
+  804517:	56                   	push   %esi
+  804518:	50                   	push   %eax
+  804519:	e8 f5 f3 ff ff       	call   803913 <page_out>
+  80451e:	f7 d0                	not    %eax
+  804520:	c1 e8 1f             	shr    $0x1f,%eax
+  804523:	83 c4 10             	add    $0x10,%esp
+  804526:	eb af                	jmp    8044d7 <paging_pgfault_handler+0x52>
+
+00804528 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  804528:	55                   	push   %ebp
+  804529:	89 e5                	mov    %esp,%ebp
+  80452b:	57                   	push   %edi
+  80452c:	56                   	push   %esi
+  80452d:	53                   	push   %ebx
+  80452e:	83 ec 2c             	sub    $0x2c,%esp
+  804531:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804534:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  804539:	89 c1                	mov    %eax,%ecx
+  80453b:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  80453e:	c1 e8 11             	shr    $0x11,%eax
+  804541:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804544:	8b 3c 85 80 dc 80 00 	mov    0x80dc80(,%eax,4),%edi
+  80454b:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  80454e:	b8 01 00 00 00       	mov    $0x1,%eax
+  804553:	d3 e0                	shl    %cl,%eax
+  804555:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  804558:	85 c7                	test   %eax,%edi
+  80455a:	74 12                	je     80456e <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  80455c:	bb 01 00 00 00       	mov    $0x1,%ebx
+  804561:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  804564:	bf 01 00 00 00       	mov    $0x1,%edi
+  804569:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80456c:	eb 17                	jmp    804585 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  80456e:	ff 75 e0             	push   -0x20(%ebp)
+  804571:	68 14 5f 80 00       	push   $0x805f14
+  804576:	6a 48                	push   $0x48
+  804578:	68 2e 5f 80 00       	push   $0x805f2e
+  80457d:	e8 a6 bc ff ff       	call   800228 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804582:	83 c3 01             	add    $0x1,%ebx
+  804585:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804588:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  80458b:	89 c8                	mov    %ecx,%eax
+  80458d:	c1 e8 05             	shr    $0x5,%eax
+  804590:	8b 14 85 80 ce 80 00 	mov    0x80ce80(,%eax,4),%edx
+  804597:	89 fe                	mov    %edi,%esi
+  804599:	d3 e6                	shl    %cl,%esi
+  80459b:	89 f1                	mov    %esi,%ecx
+  80459d:	85 d6                	test   %edx,%esi
+  80459f:	74 e1                	je     804582 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  8045a1:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  8045a4:	f7 d6                	not    %esi
+  8045a6:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8045a9:	21 fe                	and    %edi,%esi
+  8045ab:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8045ae:	89 34 bd 80 dc 80 00 	mov    %esi,0x80dc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  8045b5:	f7 d1                	not    %ecx
+  8045b7:	21 d1                	and    %edx,%ecx
+  8045b9:	89 0c 85 80 ce 80 00 	mov    %ecx,0x80ce80(,%eax,4)
+	page_unmap_range(0, va, n);
+  8045c0:	83 ec 04             	sub    $0x4,%esp
+  8045c3:	53                   	push   %ebx
+  8045c4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8045c7:	57                   	push   %edi
+  8045c8:	6a 00                	push   $0x0
+  8045ca:	e8 97 f8 ff ff       	call   803e66 <page_unmap_range>
+	va_free(va, n);
+  8045cf:	83 c4 08             	add    $0x8,%esp
+  8045d2:	53                   	push   %ebx
+  8045d3:	57                   	push   %edi
+  8045d4:	e8 ed 05 00 00       	call   804bc6 <va_free>
+}
+  8045d9:	83 c4 10             	add    $0x10,%esp
+  8045dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045df:	5b                   	pop    %ebx
+  8045e0:	5e                   	pop    %esi
+  8045e1:	5f                   	pop    %edi
+  8045e2:	5d                   	pop    %ebp
+  8045e3:	c3                   	ret
+
+008045e4 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  8045e4:	55                   	push   %ebp
+  8045e5:	89 e5                	mov    %esp,%ebp
+  8045e7:	57                   	push   %edi
+  8045e8:	56                   	push   %esi
+  8045e9:	53                   	push   %ebx
+  8045ea:	83 ec 1c             	sub    $0x1c,%esp
+  8045ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  8045f0:	85 db                	test   %ebx,%ebx
+  8045f2:	74 34                	je     804628 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  8045f4:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8045fa:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  8045ff:	77 2f                	ja     804630 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  804601:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  804607:	75 51                	jne    80465a <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  804609:	89 c1                	mov    %eax,%ecx
+  80460b:	c1 e9 0c             	shr    $0xc,%ecx
+  80460e:	ba 01 00 00 00       	mov    $0x1,%edx
+  804613:	d3 e2                	shl    %cl,%edx
+  804615:	c1 e8 11             	shr    $0x11,%eax
+  804618:	23 14 85 80 c0 80 00 	and    0x80c080(,%eax,4),%edx
+  80461f:	75 24                	jne    804645 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  804621:	89 d8                	mov    %ebx,%eax
+  804623:	e8 00 ff ff ff       	call   804528 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  804628:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80462b:	5b                   	pop    %ebx
+  80462c:	5e                   	pop    %esi
+  80462d:	5f                   	pop    %edi
+  80462e:	5d                   	pop    %ebp
+  80462f:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  804630:	53                   	push   %ebx
+  804631:	68 3b 5f 80 00       	push   $0x805f3b
+  804636:	68 a2 00 00 00       	push   $0xa2
+  80463b:	68 2e 5f 80 00       	push   $0x805f2e
+  804640:	e8 e3 bb ff ff       	call   800228 <_panic>
+			panic("free: %p is not allocated", va);
+  804645:	53                   	push   %ebx
+  804646:	68 14 5f 80 00       	push   $0x805f14
+  80464b:	68 a5 00 00 00       	push   $0xa5
+  804650:	68 2e 5f 80 00       	push   $0x805f2e
+  804655:	e8 ce bb ff ff       	call   800228 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  80465a:	89 de                	mov    %ebx,%esi
+  80465c:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  804662:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  804668:	89 c8                	mov    %ecx,%eax
+  80466a:	c1 e8 11             	shr    $0x11,%eax
+  80466d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804670:	8b 3c 85 80 c0 80 00 	mov    0x80c080(,%eax,4),%edi
+  804677:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  80467a:	c1 e9 0c             	shr    $0xc,%ecx
+  80467d:	b8 01 00 00 00       	mov    $0x1,%eax
+  804682:	d3 e0                	shl    %cl,%eax
+  804684:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804687:	85 c7                	test   %eax,%edi
+  804689:	74 1b                	je     8046a6 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  80468b:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  80468f:	89 d8                	mov    %ebx,%eax
+  804691:	29 f0                	sub    %esi,%eax
+  804693:	83 e8 10             	sub    $0x10,%eax
+  804696:	99                   	cltd
+  804697:	f7 ff                	idiv   %edi
+  804699:	89 d1                	mov    %edx,%ecx
+  80469b:	85 d2                	test   %edx,%edx
+  80469d:	75 07                	jne    8046a6 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80469f:	ba 10 00 00 00       	mov    $0x10,%edx
+  8046a4:	eb 18                	jmp    8046be <free+0xda>
+		panic("free: %p is not allocated", va);
+  8046a6:	53                   	push   %ebx
+  8046a7:	68 14 5f 80 00       	push   $0x805f14
+  8046ac:	68 ad 00 00 00       	push   $0xad
+  8046b1:	68 2e 5f 80 00       	push   $0x805f2e
+  8046b6:	e8 6d bb ff ff       	call   800228 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8046bb:	83 c1 01             	add    $0x1,%ecx
+  8046be:	89 d0                	mov    %edx,%eax
+  8046c0:	d3 e0                	shl    %cl,%eax
+  8046c2:	39 c7                	cmp    %eax,%edi
+  8046c4:	7f f5                	jg     8046bb <free+0xd7>
+	*(void **) va = s->free;
+  8046c6:	8b 46 08             	mov    0x8(%esi),%eax
+  8046c9:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  8046cb:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  8046ce:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  8046d2:	8d 58 01             	lea    0x1(%eax),%ebx
+  8046d5:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  8046d9:	66 85 c0             	test   %ax,%ax
+  8046dc:	74 52                	je     804730 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8046de:	0f b7 db             	movzwl %bx,%ebx
+  8046e1:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8046e5:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8046ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046ef:	f7 ff                	idiv   %edi
+  8046f1:	39 c3                	cmp    %eax,%ebx
+  8046f3:	0f 85 2f ff ff ff    	jne    804628 <free+0x44>
+  8046f9:	8b 46 04             	mov    0x4(%esi),%eax
+  8046fc:	85 c0                	test   %eax,%eax
+  8046fe:	74 53                	je     804753 <free+0x16f>
+		s->prev->next = s->next;
+  804700:	8b 16                	mov    (%esi),%edx
+  804702:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804704:	8b 06                	mov    (%esi),%eax
+  804706:	85 c0                	test   %eax,%eax
+  804708:	74 06                	je     804710 <free+0x12c>
+		s->next->prev = s->prev;
+  80470a:	8b 56 04             	mov    0x4(%esi),%edx
+  80470d:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804710:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804713:	f7 d0                	not    %eax
+  804715:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804718:	21 d0                	and    %edx,%eax
+  80471a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80471d:	89 04 95 80 c0 80 00 	mov    %eax,0x80c080(,%edx,4)
+		heap_free_pages(s);
+  804724:	89 f0                	mov    %esi,%eax
+  804726:	e8 fd fd ff ff       	call   804528 <heap_free_pages>
+  80472b:	e9 f8 fe ff ff       	jmp    804628 <free+0x44>
+	s->prev = NULL;
+  804730:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  804737:	8b 04 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%eax
+  80473e:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  804740:	85 c0                	test   %eax,%eax
+  804742:	74 03                	je     804747 <free+0x163>
+		slabs[c]->prev = s;
+  804744:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  804747:	89 34 8d 60 c0 80 00 	mov    %esi,0x80c060(,%ecx,4)
+}
+  80474e:	e9 d5 fe ff ff       	jmp    804628 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804753:	8b 06                	mov    (%esi),%eax
+  804755:	85 c0                	test   %eax,%eax
+  804757:	0f 84 cb fe ff ff    	je     804628 <free+0x44>
+		slabs[c] = s->next;
+  80475d:	89 04 8d 60 c0 80 00 	mov    %eax,0x80c060(,%ecx,4)
+	if (s->next)
+  804764:	8b 06                	mov    (%esi),%eax
+  804766:	eb a2                	jmp    80470a <free+0x126>
+
+00804768 <heap_alloc_pages>:
+{
+  804768:	55                   	push   %ebp
+  804769:	89 e5                	mov    %esp,%ebp
+  80476b:	57                   	push   %edi
+  80476c:	56                   	push   %esi
+  80476d:	53                   	push   %ebx
+  80476e:	83 ec 18             	sub    $0x18,%esp
+  804771:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  804773:	50                   	push   %eax
+  804774:	e8 15 03 00 00       	call   804a8e <va_alloc>
+  804779:	89 c3                	mov    %eax,%ebx
+  80477b:	83 c4 10             	add    $0x10,%esp
+  80477e:	85 c0                	test   %eax,%eax
+  804780:	74 47                	je     8047c9 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804782:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804788:	89 c1                	mov    %eax,%ecx
+  80478a:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  80478d:	c1 e8 11             	shr    $0x11,%eax
+  804790:	ba 01 00 00 00       	mov    $0x1,%edx
+  804795:	89 d7                	mov    %edx,%edi
+  804797:	d3 e7                	shl    %cl,%edi
+  804799:	09 3c 85 80 dc 80 00 	or     %edi,0x80dc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  8047a0:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  8047a4:	89 c8                	mov    %ecx,%eax
+  8047a6:	c1 e8 05             	shr    $0x5,%eax
+  8047a9:	d3 e2                	shl    %cl,%edx
+  8047ab:	09 14 85 80 ce 80 00 	or     %edx,0x80ce80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  8047b2:	83 ec 0c             	sub    $0xc,%esp
+  8047b5:	6a 00                	push   $0x0
+  8047b7:	6a 07                	push   $0x7
+  8047b9:	56                   	push   %esi
+  8047ba:	53                   	push   %ebx
+  8047bb:	6a 00                	push   $0x0
+  8047bd:	e8 3a f7 ff ff       	call   803efc <page_alloc_range>
+  8047c2:	83 c4 20             	add    $0x20,%esp
+  8047c5:	85 c0                	test   %eax,%eax
+  8047c7:	78 0a                	js     8047d3 <heap_alloc_pages+0x6b>
+}
+  8047c9:	89 d8                	mov    %ebx,%eax
+  8047cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8047ce:	5b                   	pop    %ebx
+  8047cf:	5e                   	pop    %esi
+  8047d0:	5f                   	pop    %edi
+  8047d1:	5d                   	pop    %ebp
+  8047d2:	c3                   	ret
+		free(va);
+  8047d3:	83 ec 0c             	sub    $0xc,%esp
+  8047d6:	53                   	push   %ebx
+  8047d7:	e8 08 fe ff ff       	call   8045e4 <free>
+		return NULL;
+  8047dc:	83 c4 10             	add    $0x10,%esp
+  8047df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8047e4:	eb e3                	jmp    8047c9 <heap_alloc_pages+0x61>
+
+008047e6 <malloc>:
+{
+  8047e6:	55                   	push   %ebp
+  8047e7:	89 e5                	mov    %esp,%ebp
+  8047e9:	57                   	push   %edi
+  8047ea:	56                   	push   %esi
+  8047eb:	53                   	push   %ebx
+  8047ec:	83 ec 1c             	sub    $0x1c,%esp
+  8047ef:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  8047f2:	8d 50 ff             	lea    -0x1(%eax),%edx
+  8047f5:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  8047fb:	0f 87 21 01 00 00    	ja     804922 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804801:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804806:	ba 10 00 00 00       	mov    $0x10,%edx
+  80480b:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  80480d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804812:	76 15                	jbe    804829 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804814:	05 ff 0f 00 00       	add    $0xfff,%eax
+  804819:	c1 e8 0c             	shr    $0xc,%eax
+  80481c:	e8 47 ff ff ff       	call   804768 <heap_alloc_pages>
+  804821:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804824:	eb 37                	jmp    80485d <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804826:	83 c1 01             	add    $0x1,%ecx
+  804829:	89 d6                	mov    %edx,%esi
+  80482b:	d3 e6                	shl    %cl,%esi
+  80482d:	39 c6                	cmp    %eax,%esi
+  80482f:	72 f5                	jb     804826 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804831:	89 cb                	mov    %ecx,%ebx
+  804833:	8b 3c 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%edi
+  80483a:	85 ff                	test   %edi,%edi
+  80483c:	74 2a                	je     804868 <malloc+0x82>
+	v = s->free;
+  80483e:	8b 47 08             	mov    0x8(%edi),%eax
+  804841:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  804844:	8b 00                	mov    (%eax),%eax
+  804846:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  804849:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  80484d:	83 e8 01             	sub    $0x1,%eax
+  804850:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  804854:	66 85 c0             	test   %ax,%ax
+  804857:	0f 84 9a 00 00 00    	je     8048f7 <malloc+0x111>
+}
+  80485d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804860:	83 c4 1c             	add    $0x1c,%esp
+  804863:	5b                   	pop    %ebx
+  804864:	5e                   	pop    %esi
+  804865:	5f                   	pop    %edi
+  804866:	5d                   	pop    %ebp
+  804867:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  804868:	b8 01 00 00 00       	mov    $0x1,%eax
+  80486d:	e8 f6 fe ff ff       	call   804768 <heap_alloc_pages>
+  804872:	89 c1                	mov    %eax,%ecx
+  804874:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804877:	85 c0                	test   %eax,%eax
+  804879:	74 e2                	je     80485d <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  80487b:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  804881:	89 c8                	mov    %ecx,%eax
+  804883:	c1 e8 11             	shr    $0x11,%eax
+  804886:	c1 e9 0c             	shr    $0xc,%ecx
+  804889:	ba 01 00 00 00       	mov    $0x1,%edx
+  80488e:	d3 e2                	shl    %cl,%edx
+  804890:	09 14 85 80 c0 80 00 	or     %edx,0x80c080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804897:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80489a:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  80489e:	0f b7 f6             	movzwl %si,%esi
+  8048a1:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8048a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048ab:	f7 fe                	idiv   %esi
+  8048ad:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  8048b1:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  8048b4:	85 c0                	test   %eax,%eax
+  8048b6:	74 14                	je     8048cc <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  8048b8:	83 e8 01             	sub    $0x1,%eax
+  8048bb:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  8048bf:	0f af d0             	imul   %eax,%edx
+  8048c2:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  8048c6:	89 3a                	mov    %edi,(%edx)
+  8048c8:	89 d7                	mov    %edx,%edi
+  8048ca:	eb e5                	jmp    8048b1 <malloc+0xcb>
+	s->prev = NULL;
+  8048cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8048cf:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  8048d6:	8b 04 9d 60 c0 80 00 	mov    0x80c060(,%ebx,4),%eax
+  8048dd:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  8048df:	85 c0                	test   %eax,%eax
+  8048e1:	74 03                	je     8048e6 <malloc+0x100>
+		slabs[c]->prev = s;
+  8048e3:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  8048e6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8048e9:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+	return s;
+  8048f0:	89 c7                	mov    %eax,%edi
+  8048f2:	e9 47 ff ff ff       	jmp    80483e <malloc+0x58>
+	if (s->prev)
+  8048f7:	8b 47 04             	mov    0x4(%edi),%eax
+  8048fa:	85 c0                	test   %eax,%eax
+  8048fc:	74 19                	je     804917 <malloc+0x131>
+		s->prev->next = s->next;
+  8048fe:	8b 17                	mov    (%edi),%edx
+  804900:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804902:	8b 07                	mov    (%edi),%eax
+  804904:	85 c0                	test   %eax,%eax
+  804906:	0f 84 51 ff ff ff    	je     80485d <malloc+0x77>
+		s->next->prev = s->prev;
+  80490c:	8b 57 04             	mov    0x4(%edi),%edx
+  80490f:	89 50 04             	mov    %edx,0x4(%eax)
+  804912:	e9 46 ff ff ff       	jmp    80485d <malloc+0x77>
+		slabs[c] = s->next;
+  804917:	8b 07                	mov    (%edi),%eax
+  804919:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+  804920:	eb e0                	jmp    804902 <malloc+0x11c>
+		return NULL;
+  804922:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804929:	e9 2f ff ff ff       	jmp    80485d <malloc+0x77>
+
+0080492e <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  80492e:	55                   	push   %ebp
+  80492f:	89 e5                	mov    %esp,%ebp
+  804931:	57                   	push   %edi
+  804932:	56                   	push   %esi
+  804933:	53                   	push   %ebx
+  804934:	83 ec 0c             	sub    $0xc,%esp
+  804937:	89 c6                	mov    %eax,%esi
+  804939:	89 d7                	mov    %edx,%edi
+  80493b:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  80493e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804943:	ba 00 00 00 00       	mov    $0x0,%edx
+  804948:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  80494d:	83 ef 01             	sub    $0x1,%edi
+  804950:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804953:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  804956:	eb 34                	jmp    80498c <va_chunk_scan+0x5e>
+			i += 31;
+  804958:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  80495b:	89 ca                	mov    %ecx,%edx
+			continue;
+  80495d:	eb 23                	jmp    804982 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  80495f:	89 c7                	mov    %eax,%edi
+  804961:	c1 ef 05             	shr    $0x5,%edi
+  804964:	be 01 00 00 00       	mov    $0x1,%esi
+  804969:	d3 e6                	shl    %cl,%esi
+  80496b:	89 f1                	mov    %esi,%ecx
+  80496d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804970:	23 0c be             	and    (%esi,%edi,4),%ecx
+  804973:	75 41                	jne    8049b6 <va_chunk_scan+0x88>
+			len++;
+  804975:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804978:	39 d3                	cmp    %edx,%ebx
+  80497a:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  80497d:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  804980:	72 2d                	jb     8049af <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804982:	83 c0 01             	add    $0x1,%eax
+  804985:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80498a:	77 31                	ja     8049bd <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  80498c:	89 c1                	mov    %eax,%ecx
+  80498e:	83 e1 1f             	and    $0x1f,%ecx
+  804991:	75 cc                	jne    80495f <va_chunk_scan+0x31>
+  804993:	89 c7                	mov    %eax,%edi
+  804995:	c1 ef 05             	shr    $0x5,%edi
+  804998:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80499b:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  80499e:	83 ff ff             	cmp    $0xffffffff,%edi
+  8049a1:	74 b5                	je     804958 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  8049a3:	85 ff                	test   %edi,%edi
+  8049a5:	75 b8                	jne    80495f <va_chunk_scan+0x31>
+			i += 31;
+  8049a7:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  8049aa:	83 c2 20             	add    $0x20,%edx
+  8049ad:	eb c9                	jmp    804978 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  8049af:	83 c0 01             	add    $0x1,%eax
+  8049b2:	29 d0                	sub    %edx,%eax
+  8049b4:	eb 15                	jmp    8049cb <va_chunk_scan+0x9d>
+			len = 0;
+  8049b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049bb:	eb c5                	jmp    804982 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  8049bd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  8049c2:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  8049c5:	85 d2                	test   %edx,%edx
+  8049c7:	74 02                	je     8049cb <va_chunk_scan+0x9d>
+		*run_store = best;
+  8049c9:	89 1a                	mov    %ebx,(%edx)
+}
+  8049cb:	83 c4 0c             	add    $0xc,%esp
+  8049ce:	5b                   	pop    %ebx
+  8049cf:	5e                   	pop    %esi
+  8049d0:	5f                   	pop    %edi
+  8049d1:	5d                   	pop    %ebp
+  8049d2:	c3                   	ret
+
+008049d3 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  8049d3:	55                   	push   %ebp
+  8049d4:	89 e5                	mov    %esp,%ebp
+  8049d6:	57                   	push   %edi
+  8049d7:	56                   	push   %esi
+  8049d8:	53                   	push   %ebx
+  8049d9:	83 ec 14             	sub    $0x14,%esp
+  8049dc:	89 c3                	mov    %eax,%ebx
+  8049de:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  8049e0:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  8049e6:	8d ba a0 ea 80 00    	lea    0x80eaa0(%edx),%edi
+  8049ec:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  8049ef:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  8049f2:	89 d6                	mov    %edx,%esi
+  8049f4:	81 c6 a0 ea 80 00    	add    $0x80eaa0,%esi
+  8049fa:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  8049fc:	eb 34                	jmp    804a32 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  8049fe:	89 c8                	mov    %ecx,%eax
+  804a00:	c1 e8 05             	shr    $0x5,%eax
+  804a03:	89 da                	mov    %ebx,%edx
+  804a05:	c1 e2 05             	shl    $0x5,%edx
+  804a08:	01 da                	add    %ebx,%edx
+  804a0a:	01 c2                	add    %eax,%edx
+  804a0c:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804a11:	d3 c0                	rol    %cl,%eax
+  804a13:	21 04 95 a0 ea 80 00 	and    %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804a1a:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804a21:	b8 01 00 00 00       	mov    $0x1,%eax
+  804a26:	01 d0                	add    %edx,%eax
+  804a28:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804a2f:	83 c1 01             	add    $0x1,%ecx
+  804a32:	39 f9                	cmp    %edi,%ecx
+  804a34:	74 30                	je     804a66 <va_chunk_mark+0x93>
+		if (alloc)
+  804a36:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804a3a:	74 c2                	je     8049fe <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804a3c:	89 c8                	mov    %ecx,%eax
+  804a3e:	c1 e8 05             	shr    $0x5,%eax
+  804a41:	89 da                	mov    %ebx,%edx
+  804a43:	c1 e2 05             	shl    $0x5,%edx
+  804a46:	01 da                	add    %ebx,%edx
+  804a48:	01 c2                	add    %eax,%edx
+  804a4a:	b8 01 00 00 00       	mov    $0x1,%eax
+  804a4f:	d3 e0                	shl    %cl,%eax
+  804a51:	09 04 95 a0 ea 80 00 	or     %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804a58:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804a5f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804a64:	eb c0                	jmp    804a26 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804a66:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804a69:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a6e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804a71:	e8 b8 fe ff ff       	call   80492e <va_chunk_scan>
+	ch->run = run;
+  804a76:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804a7c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804a7f:	66 89 83 22 eb 80 00 	mov    %ax,0x80eb22(%ebx)
+}
+  804a86:	83 c4 14             	add    $0x14,%esp
+  804a89:	5b                   	pop    %ebx
+  804a8a:	5e                   	pop    %esi
+  804a8b:	5f                   	pop    %edi
+  804a8c:	5d                   	pop    %ebp
+  804a8d:	c3                   	ret
+
+00804a8e <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804a8e:	55                   	push   %ebp
+  804a8f:	89 e5                	mov    %esp,%ebp
+  804a91:	57                   	push   %edi
+  804a92:	56                   	push   %esi
+  804a93:	53                   	push   %ebx
+  804a94:	83 ec 04             	sub    $0x4,%esp
+  804a97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804a9a:	b8 20 eb 80 00       	mov    $0x80eb20,%eax
+  804a9f:	ba 90 f9 80 00       	mov    $0x80f990,%edx
+  804aa4:	80 3d 80 ea 80 00 00 	cmpb   $0x0,0x80ea80
+  804aab:	74 4f                	je     804afc <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804aad:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804ab0:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804ab5:	0f 87 01 01 00 00    	ja     804bbc <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804abb:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804ac1:	0f 87 80 00 00 00    	ja     804b47 <va_alloc+0xb9>
+  804ac7:	b8 22 eb 80 00       	mov    $0x80eb22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804acc:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804ad1:	0f b7 10             	movzwl (%eax),%edx
+  804ad4:	05 84 00 00 00       	add    $0x84,%eax
+  804ad9:	39 da                	cmp    %ebx,%edx
+  804adb:	73 2c                	jae    804b09 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804add:	83 c6 01             	add    $0x1,%esi
+  804ae0:	83 fe 1c             	cmp    $0x1c,%esi
+  804ae3:	75 ec                	jne    804ad1 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804aea:	eb 53                	jmp    804b3f <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804aec:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804af2:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804af7:	05 84 00 00 00       	add    $0x84,%eax
+  804afc:	39 d0                	cmp    %edx,%eax
+  804afe:	75 ec                	jne    804aec <va_alloc+0x5e>
+	va_inited = 1;
+  804b00:	c6 05 80 ea 80 00 01 	movb   $0x1,0x80ea80
+}
+  804b07:	eb a4                	jmp    804aad <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804b09:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804b0f:	05 a0 ea 80 00       	add    $0x80eaa0,%eax
+  804b14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804b19:	89 da                	mov    %ebx,%edx
+  804b1b:	e8 0e fe ff ff       	call   80492e <va_chunk_scan>
+  804b20:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804b22:	6a 01                	push   $0x1
+  804b24:	89 d9                	mov    %ebx,%ecx
+  804b26:	89 c2                	mov    %eax,%edx
+  804b28:	89 f0                	mov    %esi,%eax
+  804b2a:	e8 a4 fe ff ff       	call   8049d3 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804b2f:	c1 e6 16             	shl    $0x16,%esi
+  804b32:	c1 e7 0c             	shl    $0xc,%edi
+  804b35:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804b3c:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804b3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b42:	5b                   	pop    %ebx
+  804b43:	5e                   	pop    %esi
+  804b44:	5f                   	pop    %edi
+  804b45:	5d                   	pop    %ebp
+  804b46:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804b47:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804b4d:	c1 ee 0a             	shr    $0xa,%esi
+  804b50:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804b55:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b5a:	eb 0a                	jmp    804b66 <va_alloc+0xd8>
+			first = c + 1;
+  804b5c:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804b5e:	83 c2 01             	add    $0x1,%edx
+  804b61:	83 fa 1d             	cmp    $0x1d,%edx
+  804b64:	74 4f                	je     804bb5 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804b66:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804b6c:	66 81 b9 9c ea 80 00 	cmpw   $0x400,0x80ea9c(%ecx)
+  804b73:	00 04 
+  804b75:	75 e5                	jne    804b5c <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804b77:	89 d1                	mov    %edx,%ecx
+  804b79:	29 c1                	sub    %eax,%ecx
+  804b7b:	39 f1                	cmp    %esi,%ecx
+  804b7d:	75 df                	jne    804b5e <va_alloc+0xd0>
+  804b7f:	89 c7                	mov    %eax,%edi
+  804b81:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804b84:	be 00 04 00 00       	mov    $0x400,%esi
+  804b89:	39 f3                	cmp    %esi,%ebx
+  804b8b:	0f 46 f3             	cmovbe %ebx,%esi
+  804b8e:	6a 01                	push   $0x1
+  804b90:	89 f1                	mov    %esi,%ecx
+  804b92:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b97:	89 f8                	mov    %edi,%eax
+  804b99:	e8 35 fe ff ff       	call   8049d3 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804b9e:	83 c7 01             	add    $0x1,%edi
+  804ba1:	83 c4 04             	add    $0x4,%esp
+  804ba4:	29 f3                	sub    %esi,%ebx
+  804ba6:	75 dc                	jne    804b84 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804ba8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804bab:	c1 e0 16             	shl    $0x16,%eax
+  804bae:	05 00 00 00 08       	add    $0x8000000,%eax
+  804bb3:	eb 8a                	jmp    804b3f <va_alloc+0xb1>
+	return NULL;
+  804bb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bba:	eb 83                	jmp    804b3f <va_alloc+0xb1>
+		return NULL;
+  804bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bc1:	e9 79 ff ff ff       	jmp    804b3f <va_alloc+0xb1>
+
+00804bc6 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804bc6:	55                   	push   %ebp
+  804bc7:	89 e5                	mov    %esp,%ebp
+  804bc9:	57                   	push   %edi
+  804bca:	56                   	push   %esi
+  804bcb:	53                   	push   %ebx
+  804bcc:	83 ec 0c             	sub    $0xc,%esp
+  804bcf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804bd2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804bd5:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804bdb:	76 21                	jbe    804bfe <va_free+0x38>
+  804bdd:	89 f0                	mov    %esi,%eax
+  804bdf:	c1 e0 0c             	shl    $0xc,%eax
+  804be2:	01 f8                	add    %edi,%eax
+  804be4:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804be9:	77 13                	ja     804bfe <va_free+0x38>
+	    || PGOFF(va))
+  804beb:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804bf1:	75 0b                	jne    804bfe <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804bf3:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804bf9:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804bfc:	eb 45                	jmp    804c43 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804bfe:	83 ec 0c             	sub    $0xc,%esp
+  804c01:	56                   	push   %esi
+  804c02:	57                   	push   %edi
+  804c03:	68 58 5f 80 00       	push   $0x805f58
+  804c08:	68 8e 00 00 00       	push   $0x8e
+  804c0d:	68 78 5f 80 00       	push   $0x805f78
+  804c12:	e8 11 b6 ff ff       	call   800228 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804c17:	89 fa                	mov    %edi,%edx
+  804c19:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804c1f:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804c24:	29 d3                	sub    %edx,%ebx
+  804c26:	39 f3                	cmp    %esi,%ebx
+  804c28:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804c2b:	89 f8                	mov    %edi,%eax
+  804c2d:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804c30:	83 ec 0c             	sub    $0xc,%esp
+  804c33:	6a 00                	push   $0x0
+  804c35:	89 d9                	mov    %ebx,%ecx
+  804c37:	e8 97 fd ff ff       	call   8049d3 <va_chunk_mark>
+		i += n;
+  804c3c:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804c3e:	29 de                	sub    %ebx,%esi
+  804c40:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804c43:	85 f6                	test   %esi,%esi
+  804c45:	75 d0                	jne    804c17 <va_free+0x51>
+	}
+}
+  804c47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804c4a:	5b                   	pop    %ebx
+  804c4b:	5e                   	pop    %esi
+  804c4c:	5f                   	pop    %edi
+  804c4d:	5d                   	pop    %ebp
+  804c4e:	c3                   	ret
+
+00804c4f <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c54:	c3                   	ret
+
+00804c55 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804c55:	55                   	push   %ebp
+  804c56:	89 e5                	mov    %esp,%ebp
+  804c58:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804c5b:	68 85 5f 80 00       	push   $0x805f85
+  804c60:	ff 75 0c             	push   0xc(%ebp)
+  804c63:	e8 82 bc ff ff       	call   8008ea <strcpy>
+	return 0;
+}
+  804c68:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c6d:	c9                   	leave
+  804c6e:	c3                   	ret
+
+00804c6f <devcons_write>:
+{
+  804c6f:	55                   	push   %ebp
+  804c70:	89 e5                	mov    %esp,%ebp
+  804c72:	57                   	push   %edi
+  804c73:	56                   	push   %esi
+  804c74:	53                   	push   %ebx
+  804c75:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804c7b:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804c80:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804c86:	eb 2e                	jmp    804cb6 <devcons_write+0x47>
+		m = n - tot;
+  804c88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804c8b:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804c8d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804c92:	39 c3                	cmp    %eax,%ebx
+  804c94:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804c97:	83 ec 04             	sub    $0x4,%esp
+  804c9a:	53                   	push   %ebx
+  804c9b:	89 f0                	mov    %esi,%eax
+  804c9d:	03 45 0c             	add    0xc(%ebp),%eax
+  804ca0:	50                   	push   %eax
+  804ca1:	57                   	push   %edi
+  804ca2:	e8 c9 bd ff ff       	call   800a70 <memmove>
+		sys_cputs(buf, m);
+  804ca7:	83 c4 08             	add    $0x8,%esp
+  804caa:	53                   	push   %ebx
+  804cab:	57                   	push   %edi
+  804cac:	e8 5f c0 ff ff       	call   800d10 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804cb1:	01 de                	add    %ebx,%esi
+  804cb3:	83 c4 10             	add    $0x10,%esp
+  804cb6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804cb9:	72 cd                	jb     804c88 <devcons_write+0x19>
+}
+  804cbb:	89 f0                	mov    %esi,%eax
+  804cbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804cc0:	5b                   	pop    %ebx
+  804cc1:	5e                   	pop    %esi
+  804cc2:	5f                   	pop    %edi
+  804cc3:	5d                   	pop    %ebp
+  804cc4:	c3                   	ret
+
+00804cc5 <devcons_read>:
+{
+  804cc5:	55                   	push   %ebp
+  804cc6:	89 e5                	mov    %esp,%ebp
+  804cc8:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804ccb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cd0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804cd4:	75 07                	jne    804cdd <devcons_read+0x18>
+  804cd6:	eb 1f                	jmp    804cf7 <devcons_read+0x32>
+		sys_yield();
+  804cd8:	e8 e1 c0 ff ff       	call   800dbe <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804cdd:	e8 5d c0 ff ff       	call   800d3f <sys_cgetc>
+  804ce2:	85 c0                	test   %eax,%eax
+  804ce4:	74 f2                	je     804cd8 <devcons_read+0x13>
+	if (c < 0)
+  804ce6:	78 0f                	js     804cf7 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804ce8:	83 f8 04             	cmp    $0x4,%eax
+  804ceb:	74 0c                	je     804cf9 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804ced:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804cf0:	88 02                	mov    %al,(%edx)
+	return 1;
+  804cf2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804cf7:	c9                   	leave
+  804cf8:	c3                   	ret
+		return 0;
+  804cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cfe:	eb f7                	jmp    804cf7 <devcons_read+0x32>
+
+00804d00 <cputchar>:
+{
+  804d00:	55                   	push   %ebp
+  804d01:	89 e5                	mov    %esp,%ebp
+  804d03:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804d06:	8b 45 08             	mov    0x8(%ebp),%eax
+  804d09:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804d0c:	6a 01                	push   $0x1
+  804d0e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804d11:	50                   	push   %eax
+  804d12:	e8 f9 bf ff ff       	call   800d10 <sys_cputs>
+}
+  804d17:	83 c4 10             	add    $0x10,%esp
+  804d1a:	c9                   	leave
+  804d1b:	c3                   	ret
+
+00804d1c <getchar>:
+{
+  804d1c:	55                   	push   %ebp
+  804d1d:	89 e5                	mov    %esp,%ebp
+  804d1f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804d22:	6a 01                	push   $0x1
+  804d24:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804d27:	50                   	push   %eax
+  804d28:	6a 00                	push   $0x0
+  804d2a:	e8 d7 ce ff ff       	call   801c06 <read>
+	if (r < 0)
+  804d2f:	83 c4 10             	add    $0x10,%esp
+  804d32:	85 c0                	test   %eax,%eax
+  804d34:	78 06                	js     804d3c <getchar+0x20>
+	if (r < 1)
+  804d36:	74 06                	je     804d3e <getchar+0x22>
+	return c;
+  804d38:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804d3c:	c9                   	leave
+  804d3d:	c3                   	ret
+		return -E_EOF;
+  804d3e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804d43:	eb f7                	jmp    804d3c <getchar+0x20>
+
+00804d45 <iscons>:
+{
+  804d45:	55                   	push   %ebp
+  804d46:	89 e5                	mov    %esp,%ebp
+  804d48:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804d4b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804d4e:	50                   	push   %eax
+  804d4f:	ff 75 08             	push   0x8(%ebp)
+  804d52:	e8 50 cc ff ff       	call   8019a7 <fd_lookup>
+  804d57:	83 c4 10             	add    $0x10,%esp
+  804d5a:	85 c0                	test   %eax,%eax
+  804d5c:	78 11                	js     804d6f <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804d5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804d61:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  804d67:	39 10                	cmp    %edx,(%eax)
+  804d69:	0f 94 c0             	sete   %al
+  804d6c:	0f b6 c0             	movzbl %al,%eax
+}
+  804d6f:	c9                   	leave
+  804d70:	c3                   	ret
+
+00804d71 <opencons>:
+{
+  804d71:	55                   	push   %ebp
+  804d72:	89 e5                	mov    %esp,%ebp
+  804d74:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804d77:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804d7a:	50                   	push   %eax
+  804d7b:	e8 d3 cb ff ff       	call   801953 <fd_alloc>
+  804d80:	83 c4 10             	add    $0x10,%esp
+  804d83:	85 c0                	test   %eax,%eax
+  804d85:	78 3a                	js     804dc1 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804d87:	83 ec 04             	sub    $0x4,%esp
+  804d8a:	68 07 04 00 00       	push   $0x407
+  804d8f:	ff 75 f4             	push   -0xc(%ebp)
+  804d92:	6a 00                	push   $0x0
+  804d94:	e8 44 c0 ff ff       	call   800ddd <sys_page_alloc>
+  804d99:	83 c4 10             	add    $0x10,%esp
+  804d9c:	85 c0                	test   %eax,%eax
+  804d9e:	78 21                	js     804dc1 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804da0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804da3:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  804da9:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804dab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804dae:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804db5:	83 ec 0c             	sub    $0xc,%esp
+  804db8:	50                   	push   %eax
+  804db9:	e8 6e cb ff ff       	call   80192c <fd2num>
+  804dbe:	83 c4 10             	add    $0x10,%esp
+}
+  804dc1:	c9                   	leave
+  804dc2:	c3                   	ret
+
+00804dc3 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804dc3:	55                   	push   %ebp
+  804dc4:	89 e5                	mov    %esp,%ebp
+  804dc6:	56                   	push   %esi
+  804dc7:	53                   	push   %ebx
+  804dc8:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804dcb:	a1 10 f9 80 00       	mov    0x80f910,%eax
+  804dd0:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804dd3:	85 db                	test   %ebx,%ebx
+  804dd5:	78 17                	js     804dee <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804dd7:	83 ec 0c             	sub    $0xc,%esp
+  804dda:	56                   	push   %esi
+  804ddb:	ff 14 9d 00 10 81 00 	call   *0x811000(,%ebx,4)
+  804de2:	83 c4 10             	add    $0x10,%esp
+  804de5:	85 c0                	test   %eax,%eax
+  804de7:	75 27                	jne    804e10 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804de9:	83 eb 01             	sub    $0x1,%ebx
+  804dec:	eb e5                	jmp    804dd3 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804dee:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804df3:	8b 40 48             	mov    0x48(%eax),%eax
+  804df6:	83 ec 08             	sub    $0x8,%esp
+  804df9:	ff 76 28             	push   0x28(%esi)
+  804dfc:	ff 36                	push   (%esi)
+  804dfe:	50                   	push   %eax
+  804dff:	68 94 5f 80 00       	push   $0x805f94
+  804e04:	6a 1d                	push   $0x1d
+  804e06:	68 b7 5f 80 00       	push   $0x805fb7
+  804e0b:	e8 18 b4 ff ff       	call   800228 <_panic>
+}
+  804e10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804e13:	5b                   	pop    %ebx
+  804e14:	5e                   	pop    %esi
+  804e15:	5d                   	pop    %ebp
+  804e16:	c3                   	ret
+
+00804e17 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804e17:	55                   	push   %ebp
+  804e18:	89 e5                	mov    %esp,%ebp
+  804e1a:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804e1d:	83 3d 28 10 81 00 00 	cmpl   $0x0,0x811028
+  804e24:	74 0a                	je     804e30 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804e26:	8b 45 08             	mov    0x8(%ebp),%eax
+  804e29:	a3 28 10 81 00       	mov    %eax,0x811028
+}
+  804e2e:	c9                   	leave
+  804e2f:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804e30:	83 ec 04             	sub    $0x4,%esp
+  804e33:	6a 07                	push   $0x7
+  804e35:	68 00 f0 bf ee       	push   $0xeebff000
+  804e3a:	6a 00                	push   $0x0
+  804e3c:	e8 9c bf ff ff       	call   800ddd <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804e41:	83 c4 08             	add    $0x8,%esp
+  804e44:	68 b7 4e 80 00       	push   $0x804eb7
+  804e49:	6a 00                	push   $0x0
+  804e4b:	e8 f3 c2 ff ff       	call   801143 <sys_env_set_pgfault_upcall>
+  804e50:	83 c4 10             	add    $0x10,%esp
+  804e53:	eb d1                	jmp    804e26 <set_pgfault_handler+0xf>
+
+00804e55 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804e55:	55                   	push   %ebp
+  804e56:	89 e5                	mov    %esp,%ebp
+  804e58:	83 ec 08             	sub    $0x8,%esp
+  804e5b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  804e5e:	8b 15 10 f9 80 00    	mov    0x80f910,%edx
+  804e64:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e69:	eb 03                	jmp    804e6e <add_pgfault_handler+0x19>
+  804e6b:	83 c0 01             	add    $0x1,%eax
+  804e6e:	39 d0                	cmp    %edx,%eax
+  804e70:	74 0b                	je     804e7d <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804e72:	39 0c 85 00 10 81 00 	cmp    %ecx,0x811000(,%eax,4)
+  804e79:	75 f0                	jne    804e6b <add_pgfault_handler+0x16>
+  804e7b:	eb 24                	jmp    804ea1 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  804e7d:	83 fa 0a             	cmp    $0xa,%edx
+  804e80:	74 21                	je     804ea3 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  804e82:	8d 42 01             	lea    0x1(%edx),%eax
+  804e85:	a3 10 f9 80 00       	mov    %eax,0x80f910
+  804e8a:	89 0c 95 00 10 81 00 	mov    %ecx,0x811000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  804e91:	83 ec 0c             	sub    $0xc,%esp
+  804e94:	68 c3 4d 80 00       	push   $0x804dc3
+  804e99:	e8 79 ff ff ff       	call   804e17 <set_pgfault_handler>
+  804e9e:	83 c4 10             	add    $0x10,%esp
+}
+  804ea1:	c9                   	leave
+  804ea2:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  804ea3:	83 ec 04             	sub    $0x4,%esp
+  804ea6:	68 c5 5f 80 00       	push   $0x805fc5
+  804eab:	6a 44                	push   $0x44
+  804ead:	68 b7 5f 80 00       	push   $0x805fb7
+  804eb2:	e8 71 b3 ff ff       	call   800228 <_panic>
+
+00804eb7 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804eb7:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804eb8:	a1 28 10 81 00       	mov    0x811028,%eax
+	call *%eax
+  804ebd:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804ebf:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  804ec2:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  804ec6:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  804eca:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  804ecd:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  804ecf:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  804ed3:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  804ed6:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  804ed7:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  804eda:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  804edb:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  804edc:	c3                   	ret
+
+00804edd <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  804edd:	55                   	push   %ebp
+  804ede:	89 e5                	mov    %esp,%ebp
+  804ee0:	57                   	push   %edi
+  804ee1:	56                   	push   %esi
+  804ee2:	53                   	push   %ebx
+  804ee3:	83 ec 14             	sub    $0x14,%esp
+  804ee6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804ee9:	8b 75 14             	mov    0x14(%ebp),%esi
+  804eec:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804eef:	ff 75 10             	push   0x10(%ebp)
+  804ef2:	ff 75 0c             	push   0xc(%ebp)
+  804ef5:	e8 06 c3 ff ff       	call   801200 <sys_ipc_recv_pages>
+  804efa:	83 c4 10             	add    $0x10,%esp
+  804efd:	85 c0                	test   %eax,%eax
+  804eff:	78 46                	js     804f47 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804f01:	85 ff                	test   %edi,%edi
+  804f03:	74 0d                	je     804f12 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804f05:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804f0a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804f10:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804f12:	85 f6                	test   %esi,%esi
+  804f14:	74 0d                	je     804f23 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804f16:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804f1b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804f21:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804f23:	85 db                	test   %ebx,%ebx
+  804f25:	74 0d                	je     804f34 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804f27:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804f2c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804f32:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804f34:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804f39:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804f3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804f42:	5b                   	pop    %ebx
+  804f43:	5e                   	pop    %esi
+  804f44:	5f                   	pop    %edi
+  804f45:	5d                   	pop    %ebp
+  804f46:	c3                   	ret
+		if (from_env_store) {
+  804f47:	85 ff                	test   %edi,%edi
+  804f49:	74 06                	je     804f51 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  804f4b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804f51:	85 f6                	test   %esi,%esi
+  804f53:	74 06                	je     804f5b <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804f55:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804f5b:	85 db                	test   %ebx,%ebx
+  804f5d:	74 e0                	je     804f3f <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  804f5f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804f65:	eb d8                	jmp    804f3f <ipc_recv_pages+0x62>
+
+00804f67 <ipc_recv>:
+{
+  804f67:	55                   	push   %ebp
+  804f68:	89 e5                	mov    %esp,%ebp
+  804f6a:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  804f6d:	6a 00                	push   $0x0
+  804f6f:	ff 75 10             	push   0x10(%ebp)
+  804f72:	6a 01                	push   $0x1
+  804f74:	ff 75 0c             	push   0xc(%ebp)
+  804f77:	ff 75 08             	push   0x8(%ebp)
+  804f7a:	e8 5e ff ff ff       	call   804edd <ipc_recv_pages>
+}
+  804f7f:	c9                   	leave
+  804f80:	c3                   	ret
+
+00804f81 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804f81:	55                   	push   %ebp
+  804f82:	89 e5                	mov    %esp,%ebp
+  804f84:	56                   	push   %esi
+  804f85:	53                   	push   %ebx
+  804f86:	8b 75 08             	mov    0x8(%ebp),%esi
+  804f89:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  804f8c:	83 ec 0c             	sub    $0xc,%esp
+  804f8f:	ff 75 0c             	push   0xc(%ebp)
+  804f92:	e8 9d c3 ff ff       	call   801334 <sys_ipc_try_recv>
+  804f97:	83 c4 10             	add    $0x10,%esp
+  804f9a:	85 c0                	test   %eax,%eax
+  804f9c:	78 34                	js     804fd2 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804f9e:	85 f6                	test   %esi,%esi
+  804fa0:	74 0d                	je     804faf <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  804fa2:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804fa7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804fad:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  804faf:	85 db                	test   %ebx,%ebx
+  804fb1:	74 0d                	je     804fc0 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  804fb3:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804fb8:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804fbe:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804fc0:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804fc5:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804fcb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804fce:	5b                   	pop    %ebx
+  804fcf:	5e                   	pop    %esi
+  804fd0:	5d                   	pop    %ebp
+  804fd1:	c3                   	ret
+		if (from_env_store) {
+  804fd2:	85 f6                	test   %esi,%esi
+  804fd4:	74 06                	je     804fdc <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  804fd6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  804fdc:	85 db                	test   %ebx,%ebx
+  804fde:	74 eb                	je     804fcb <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  804fe0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804fe6:	eb e3                	jmp    804fcb <ipc_try_recv+0x4a>
+
+00804fe8 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804fe8:	55                   	push   %ebp
+  804fe9:	89 e5                	mov    %esp,%ebp
+  804feb:	83 ec 14             	sub    $0x14,%esp
+  804fee:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804ff1:	85 c0                	test   %eax,%eax
+  804ff3:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804ff8:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804ffb:	ff 75 18             	push   0x18(%ebp)
+  804ffe:	ff 75 14             	push   0x14(%ebp)
+  805001:	50                   	push   %eax
+  805002:	ff 75 0c             	push   0xc(%ebp)
+  805005:	ff 75 08             	push   0x8(%ebp)
+  805008:	e8 b6 c1 ff ff       	call   8011c3 <sys_ipc_send_pages>
+  80500d:	83 c4 20             	add    $0x20,%esp
+  805010:	85 c0                	test   %eax,%eax
+  805012:	78 02                	js     805016 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  805014:	c9                   	leave
+  805015:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  805016:	50                   	push   %eax
+  805017:	68 e0 5f 80 00       	push   $0x805fe0
+  80501c:	68 80 00 00 00       	push   $0x80
+  805021:	68 0c 60 80 00       	push   $0x80600c
+  805026:	e8 fd b1 ff ff       	call   800228 <_panic>
+
+0080502b <ipc_send>:
+{
+  80502b:	55                   	push   %ebp
+  80502c:	89 e5                	mov    %esp,%ebp
+  80502e:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  805031:	ff 75 14             	push   0x14(%ebp)
+  805034:	6a 01                	push   $0x1
+  805036:	ff 75 10             	push   0x10(%ebp)
+  805039:	ff 75 0c             	push   0xc(%ebp)
+  80503c:	ff 75 08             	push   0x8(%ebp)
+  80503f:	e8 a4 ff ff ff       	call   804fe8 <ipc_send_pages>
+}
+  805044:	83 c4 20             	add    $0x20,%esp
+  805047:	c9                   	leave
+  805048:	c3                   	ret
+
+00805049 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  805049:	55                   	push   %ebp
+  80504a:	89 e5                	mov    %esp,%ebp
+  80504c:	83 ec 14             	sub    $0x14,%esp
+  80504f:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805052:	85 c0                	test   %eax,%eax
+  805054:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805059:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80505c:	ff 75 18             	push   0x18(%ebp)
+  80505f:	ff 75 14             	push   0x14(%ebp)
+  805062:	50                   	push   %eax
+  805063:	ff 75 0c             	push   0xc(%ebp)
+  805066:	ff 75 08             	push   0x8(%ebp)
+  805069:	e8 e6 c1 ff ff       	call   801254 <sys_ipc_call>
+  80506e:	83 c4 20             	add    $0x20,%esp
+  805071:	85 c0                	test   %eax,%eax
+  805073:	78 0b                	js     805080 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  805075:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80507a:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  805080:	c9                   	leave
+  805081:	c3                   	ret
+
+00805082 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  805082:	55                   	push   %ebp
+  805083:	89 e5                	mov    %esp,%ebp
+  805085:	57                   	push   %edi
+  805086:	56                   	push   %esi
+  805087:	53                   	push   %ebx
+  805088:	83 ec 18             	sub    $0x18,%esp
+  80508b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80508e:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  805091:	8b 75 20             	mov    0x20(%ebp),%esi
+  805094:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805097:	85 c0                	test   %eax,%eax
+  805099:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80509e:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8050a1:	ff 75 18             	push   0x18(%ebp)
+  8050a4:	ff 75 14             	push   0x14(%ebp)
+  8050a7:	50                   	push   %eax
+  8050a8:	ff 75 0c             	push   0xc(%ebp)
+  8050ab:	ff 75 08             	push   0x8(%ebp)
+  8050ae:	e8 e2 c1 ff ff       	call   801295 <sys_ipc_reply_recv>
+  8050b3:	83 c4 20             	add    $0x20,%esp
+  8050b6:	85 c0                	test   %eax,%eax
+  8050b8:	78 46                	js     805100 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8050ba:	85 ff                	test   %edi,%edi
+  8050bc:	74 0d                	je     8050cb <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8050be:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050c3:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8050c9:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8050cb:	85 f6                	test   %esi,%esi
+  8050cd:	74 0d                	je     8050dc <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8050cf:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050d4:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8050da:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8050dc:	85 db                	test   %ebx,%ebx
+  8050de:	74 0d                	je     8050ed <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8050e0:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050e5:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8050eb:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8050ed:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050f2:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8050f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8050fb:	5b                   	pop    %ebx
+  8050fc:	5e                   	pop    %esi
+  8050fd:	5f                   	pop    %edi
+  8050fe:	5d                   	pop    %ebp
+  8050ff:	c3                   	ret
+		if (from_env_store) {
+  805100:	85 ff                	test   %edi,%edi
+  805102:	74 06                	je     80510a <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  805104:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80510a:	85 f6                	test   %esi,%esi
+  80510c:	74 06                	je     805114 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  80510e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  805114:	85 db                	test   %ebx,%ebx
+  805116:	74 e0                	je     8050f8 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  805118:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80511e:	eb d8                	jmp    8050f8 <ipc_reply_recv+0x76>
+
+00805120 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805120:	55                   	push   %ebp
+  805121:	89 e5                	mov    %esp,%ebp
+  805123:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  805126:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80512b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80512e:	c1 e0 06             	shl    $0x6,%eax
+  805131:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805136:	8b 40 50             	mov    0x50(%eax),%eax
+  805139:	39 c8                	cmp    %ecx,%eax
+  80513b:	74 12                	je     80514f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80513d:	83 c2 01             	add    $0x1,%edx
+  805140:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  805146:	75 e3                	jne    80512b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  805148:	b8 00 00 00 00       	mov    $0x0,%eax
+  80514d:	eb 0e                	jmp    80515d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80514f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  805152:	c1 e0 06             	shl    $0x6,%eax
+  805155:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80515a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80515d:	5d                   	pop    %ebp
+  80515e:	c3                   	ret
+
+0080515f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80515f:	55                   	push   %ebp
+  805160:	89 e5                	mov    %esp,%ebp
+  805162:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805165:	89 c2                	mov    %eax,%edx
+  805167:	c1 ea 16             	shr    $0x16,%edx
+  80516a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  805171:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805176:	f6 c1 01             	test   $0x1,%cl
+  805179:	74 1e                	je     805199 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  80517b:	c1 e8 0c             	shr    $0xc,%eax
+  80517e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  805185:	a8 01                	test   $0x1,%al
+  805187:	74 10                	je     805199 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  805189:	c1 e8 0c             	shr    $0xc,%eax
+  80518c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80518f:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  805196:	0f b7 d2             	movzwl %dx,%edx
+}
+  805199:	89 d0                	mov    %edx,%eax
+  80519b:	5d                   	pop    %ebp
+  80519c:	c3                   	ret
+
+0080519d <udivmod>:
+  80519d:	55                   	push   %ebp
+  80519e:	57                   	push   %edi
+  80519f:	56                   	push   %esi
+  8051a0:	53                   	push   %ebx
+  8051a1:	83 ec 24             	sub    $0x24,%esp
+  8051a4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8051a8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8051ac:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8051b0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8051b4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8051b8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8051bc:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8051c0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8051c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051cf:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8051d6:	00 
+  8051d7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8051de:	00 
+  8051df:	89 fb                	mov    %edi,%ebx
+  8051e1:	eb 08                	jmp    8051eb <udivmod+0x4e>
+  8051e3:	83 e9 01             	sub    $0x1,%ecx
+  8051e6:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8051e9:	74 68                	je     805253 <udivmod+0xb6>
+  8051eb:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8051ef:	01 c0                	add    %eax,%eax
+  8051f1:	89 c6                	mov    %eax,%esi
+  8051f3:	89 d7                	mov    %edx,%edi
+  8051f5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8051f9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8051fd:	0f ad d0             	shrd   %cl,%edx,%eax
+  805200:	d3 ea                	shr    %cl,%edx
+  805202:	f6 c1 20             	test   $0x20,%cl
+  805205:	74 04                	je     80520b <udivmod+0x6e>
+  805207:	89 d0                	mov    %edx,%eax
+  805209:	31 d2                	xor    %edx,%edx
+  80520b:	83 e0 01             	and    $0x1,%eax
+  80520e:	89 04 24             	mov    %eax,(%esp)
+  805211:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805218:	00 
+  805219:	8b 04 24             	mov    (%esp),%eax
+  80521c:	8b 54 24 04          	mov    0x4(%esp),%edx
+  805220:	09 f0                	or     %esi,%eax
+  805222:	09 fa                	or     %edi,%edx
+  805224:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805228:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80522c:	39 f0                	cmp    %esi,%eax
+  80522e:	89 d5                	mov    %edx,%ebp
+  805230:	19 fd                	sbb    %edi,%ebp
+  805232:	72 af                	jb     8051e3 <udivmod+0x46>
+  805234:	29 f0                	sub    %esi,%eax
+  805236:	19 fa                	sbb    %edi,%edx
+  805238:	89 cf                	mov    %ecx,%edi
+  80523a:	c1 ef 05             	shr    $0x5,%edi
+  80523d:	83 e7 01             	and    $0x1,%edi
+  805240:	89 fe                	mov    %edi,%esi
+  805242:	83 f6 01             	xor    $0x1,%esi
+  805245:	d3 e6                	shl    %cl,%esi
+  805247:	d3 e7                	shl    %cl,%edi
+  805249:	09 74 24 18          	or     %esi,0x18(%esp)
+  80524d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  805251:	eb 90                	jmp    8051e3 <udivmod+0x46>
+  805253:	85 db                	test   %ebx,%ebx
+  805255:	74 05                	je     80525c <udivmod+0xbf>
+  805257:	89 03                	mov    %eax,(%ebx)
+  805259:	89 53 04             	mov    %edx,0x4(%ebx)
+  80525c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805260:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805264:	83 c4 24             	add    $0x24,%esp
+  805267:	5b                   	pop    %ebx
+  805268:	5e                   	pop    %esi
+  805269:	5f                   	pop    %edi
+  80526a:	5d                   	pop    %ebp
+  80526b:	c3                   	ret
+
+0080526c <__udivdi3>:
+  80526c:	83 ec 08             	sub    $0x8,%esp
+  80526f:	6a 00                	push   $0x0
+  805271:	ff 74 24 1c          	push   0x1c(%esp)
+  805275:	ff 74 24 1c          	push   0x1c(%esp)
+  805279:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80527d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805281:	e8 17 ff ff ff       	call   80519d <udivmod>
+  805286:	83 c4 14             	add    $0x14,%esp
+  805289:	c3                   	ret
+
+0080528a <__umoddi3>:
+  80528a:	83 ec 18             	sub    $0x18,%esp
+  80528d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805291:	50                   	push   %eax
+  805292:	ff 74 24 2c          	push   0x2c(%esp)
+  805296:	ff 74 24 2c          	push   0x2c(%esp)
+  80529a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80529e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8052a2:	e8 f6 fe ff ff       	call   80519d <udivmod>
+  8052a7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8052ab:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8052af:	83 c4 24             	add    $0x24,%esp
+  8052b2:	c3                   	ret
+
+008052b3 <__divdi3>:
+  8052b3:	55                   	push   %ebp
+  8052b4:	57                   	push   %edi
+  8052b5:	56                   	push   %esi
+  8052b6:	53                   	push   %ebx
+  8052b7:	83 ec 10             	sub    $0x10,%esp
+  8052ba:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8052be:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8052c2:	89 c6                	mov    %eax,%esi
+  8052c4:	89 d7                	mov    %edx,%edi
+  8052c6:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8052ca:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8052ce:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8052d2:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8052d6:	89 c5                	mov    %eax,%ebp
+  8052d8:	f7 dd                	neg    %ebp
+  8052da:	89 d6                	mov    %edx,%esi
+  8052dc:	83 d6 00             	adc    $0x0,%esi
+  8052df:	f7 de                	neg    %esi
+  8052e1:	0f 48 e8             	cmovs  %eax,%ebp
+  8052e4:	0f 49 d6             	cmovns %esi,%edx
+  8052e7:	6a 00                	push   $0x0
+  8052e9:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8052ed:	f7 de                	neg    %esi
+  8052ef:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8052f3:	83 d0 00             	adc    $0x0,%eax
+  8052f6:	f7 d8                	neg    %eax
+  8052f8:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  8052fd:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  805302:	50                   	push   %eax
+  805303:	56                   	push   %esi
+  805304:	89 e8                	mov    %ebp,%eax
+  805306:	e8 92 fe ff ff       	call   80519d <udivmod>
+  80530b:	83 c4 10             	add    $0x10,%esp
+  80530e:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  805313:	78 08                	js     80531d <__divdi3+0x6a>
+  805315:	83 c4 0c             	add    $0xc,%esp
+  805318:	5b                   	pop    %ebx
+  805319:	5e                   	pop    %esi
+  80531a:	5f                   	pop    %edi
+  80531b:	5d                   	pop    %ebp
+  80531c:	c3                   	ret
+  80531d:	f7 d8                	neg    %eax
+  80531f:	83 d2 00             	adc    $0x0,%edx
+  805322:	f7 da                	neg    %edx
+  805324:	eb ef                	jmp    805315 <__divdi3+0x62>
+
+00805326 <__moddi3>:
+  805326:	55                   	push   %ebp
+  805327:	57                   	push   %edi
+  805328:	56                   	push   %esi
+  805329:	53                   	push   %ebx
+  80532a:	83 ec 18             	sub    $0x18,%esp
+  80532d:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  805331:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  805335:	89 f1                	mov    %esi,%ecx
+  805337:	f7 d9                	neg    %ecx
+  805339:	89 da                	mov    %ebx,%edx
+  80533b:	83 d2 00             	adc    $0x0,%edx
+  80533e:	f7 da                	neg    %edx
+  805340:	0f 48 ce             	cmovs  %esi,%ecx
+  805343:	0f 48 d3             	cmovs  %ebx,%edx
+  805346:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80534a:	50                   	push   %eax
+  80534b:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80534f:	f7 de                	neg    %esi
+  805351:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  805355:	83 d0 00             	adc    $0x0,%eax
+  805358:	f7 d8                	neg    %eax
+  80535a:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80535f:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  805364:	50                   	push   %eax
+  805365:	56                   	push   %esi
+  805366:	89 c8                	mov    %ecx,%eax
+  805368:	e8 30 fe ff ff       	call   80519d <udivmod>
+  80536d:	83 c4 10             	add    $0x10,%esp
+  805370:	85 db                	test   %ebx,%ebx
+  805372:	78 10                	js     805384 <__moddi3+0x5e>
+  805374:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805378:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80537c:	83 c4 14             	add    $0x14,%esp
+  80537f:	5b                   	pop    %ebx
+  805380:	5e                   	pop    %esi
+  805381:	5f                   	pop    %edi
+  805382:	5d                   	pop    %ebp
+  805383:	c3                   	ret
+  805384:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805388:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80538c:	f7 d8                	neg    %eax
+  80538e:	83 d2 00             	adc    $0x0,%edx
+  805391:	f7 da                	neg    %edx
+  805393:	eb e7                	jmp    80537c <__moddi3+0x56>
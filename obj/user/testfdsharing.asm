@@ -0,0 +1,10647 @@
+
+obj/user/testfdsharing.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 99 01 00 00       	call   8001ca <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 14             	sub    $0x14,%esp
+	int fd, r, n, n2;
+
+	if ((fd = open("motd", O_RDONLY)) < 0)
+  80003c:	6a 00                	push   $0x0
+  80003e:	68 20 54 80 00       	push   $0x805420
+  800043:	e8 fe 20 00 00       	call   802146 <open>
+  800048:	89 c3                	mov    %eax,%ebx
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	0f 88 ff 00 00 00    	js     800154 <umain+0x121>
+		panic("open motd: %e", fd);
+	seek(fd, 0);
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	6a 00                	push   $0x0
+  80005a:	50                   	push   %eax
+  80005b:	e8 fb 1c 00 00       	call   801d5b <seek>
+	if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  800060:	83 c4 0c             	add    $0xc,%esp
+  800063:	68 00 02 00 00       	push   $0x200
+  800068:	68 20 fb 80 00       	push   $0x80fb20
+  80006d:	53                   	push   %ebx
+  80006e:	e8 1f 1c 00 00       	call   801c92 <readn>
+  800073:	89 c6                	mov    %eax,%esi
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 8e e6 00 00 00    	jle    800166 <umain+0x133>
+		panic("readn: %e", n);
+
+	if ((r = fork()) < 0)
+  800080:	e8 44 14 00 00       	call   8014c9 <fork>
+  800085:	89 c7                	mov    %eax,%edi
+  800087:	85 c0                	test   %eax,%eax
+  800089:	0f 88 e9 00 00 00    	js     800178 <umain+0x145>
+		panic("fork: %e", r);
+	if (r == 0) {
+  80008f:	75 7b                	jne    80010c <umain+0xd9>
+		seek(fd, 0);
+  800091:	83 ec 08             	sub    $0x8,%esp
+  800094:	6a 00                	push   $0x0
+  800096:	53                   	push   %ebx
+  800097:	e8 bf 1c 00 00       	call   801d5b <seek>
+		cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  80009c:	c7 04 24 90 54 80 00 	movl   $0x805490,(%esp)
+  8000a3:	e8 60 02 00 00       	call   800308 <cprintf>
+		if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8000a8:	83 c4 0c             	add    $0xc,%esp
+  8000ab:	68 00 02 00 00       	push   $0x200
+  8000b0:	68 20 f9 80 00       	push   $0x80f920
+  8000b5:	53                   	push   %ebx
+  8000b6:	e8 d7 1b 00 00       	call   801c92 <readn>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	39 c6                	cmp    %eax,%esi
+  8000c0:	0f 85 c4 00 00 00    	jne    80018a <umain+0x157>
+			panic("read in parent got %d, read in child got %d", n, n2);
+		if (memcmp(buf, buf2, n) != 0)
+  8000c6:	83 ec 04             	sub    $0x4,%esp
+  8000c9:	56                   	push   %esi
+  8000ca:	68 20 f9 80 00       	push   $0x80f920
+  8000cf:	68 20 fb 80 00       	push   $0x80fb20
+  8000d4:	e8 14 0a 00 00       	call   800aed <memcmp>
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	85 c0                	test   %eax,%eax
+  8000de:	0f 85 bc 00 00 00    	jne    8001a0 <umain+0x16d>
+			panic("read in parent got different bytes from read in child");
+		cprintf("read in child succeeded\n");
+  8000e4:	83 ec 0c             	sub    $0xc,%esp
+  8000e7:	68 5b 54 80 00       	push   $0x80545b
+  8000ec:	e8 17 02 00 00       	call   800308 <cprintf>
+		seek(fd, 0);
+  8000f1:	83 c4 08             	add    $0x8,%esp
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	53                   	push   %ebx
+  8000f7:	e8 5f 1c 00 00       	call   801d5b <seek>
+		close(fd);
+  8000fc:	89 1c 24             	mov    %ebx,(%esp)
+  8000ff:	e8 cb 19 00 00       	call   801acf <close>
+		exit();
+  800104:	e8 0a 01 00 00       	call   800213 <exit>
+  800109:	83 c4 10             	add    $0x10,%esp
+	}
+	wait(r);
+  80010c:	83 ec 0c             	sub    $0xc,%esp
+  80010f:	57                   	push   %edi
+  800110:	e8 88 26 00 00       	call   80279d <wait>
+	if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  800115:	83 c4 0c             	add    $0xc,%esp
+  800118:	68 00 02 00 00       	push   $0x200
+  80011d:	68 20 f9 80 00       	push   $0x80f920
+  800122:	53                   	push   %ebx
+  800123:	e8 6a 1b 00 00       	call   801c92 <readn>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	39 c6                	cmp    %eax,%esi
+  80012d:	0f 85 81 00 00 00    	jne    8001b4 <umain+0x181>
+		panic("read in parent got %d, then got %d", n, n2);
+	cprintf("read in parent succeeded\n");
+  800133:	83 ec 0c             	sub    $0xc,%esp
+  800136:	68 74 54 80 00       	push   $0x805474
+  80013b:	e8 c8 01 00 00       	call   800308 <cprintf>
+	close(fd);
+  800140:	89 1c 24             	mov    %ebx,(%esp)
+  800143:	e8 87 19 00 00       	call   801acf <close>
+static __inline uint64_t read_tsc(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  800148:	cc                   	int3
+
+	breakpoint();
+}
+  800149:	83 c4 10             	add    $0x10,%esp
+  80014c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80014f:	5b                   	pop    %ebx
+  800150:	5e                   	pop    %esi
+  800151:	5f                   	pop    %edi
+  800152:	5d                   	pop    %ebp
+  800153:	c3                   	ret
+		panic("open motd: %e", fd);
+  800154:	50                   	push   %eax
+  800155:	68 25 54 80 00       	push   $0x805425
+  80015a:	6a 0c                	push   $0xc
+  80015c:	68 33 54 80 00       	push   $0x805433
+  800161:	e8 c7 00 00 00       	call   80022d <_panic>
+		panic("readn: %e", n);
+  800166:	50                   	push   %eax
+  800167:	68 48 54 80 00       	push   $0x805448
+  80016c:	6a 0f                	push   $0xf
+  80016e:	68 33 54 80 00       	push   $0x805433
+  800173:	e8 b5 00 00 00       	call   80022d <_panic>
+		panic("fork: %e", r);
+  800178:	50                   	push   %eax
+  800179:	68 52 54 80 00       	push   $0x805452
+  80017e:	6a 12                	push   $0x12
+  800180:	68 33 54 80 00       	push   $0x805433
+  800185:	e8 a3 00 00 00       	call   80022d <_panic>
+			panic("read in parent got %d, read in child got %d", n, n2);
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  80018d:	50                   	push   %eax
+  80018e:	56                   	push   %esi
+  80018f:	68 d4 54 80 00       	push   $0x8054d4
+  800194:	6a 17                	push   $0x17
+  800196:	68 33 54 80 00       	push   $0x805433
+  80019b:	e8 8d 00 00 00       	call   80022d <_panic>
+			panic("read in parent got different bytes from read in child");
+  8001a0:	83 ec 04             	sub    $0x4,%esp
+  8001a3:	68 00 55 80 00       	push   $0x805500
+  8001a8:	6a 19                	push   $0x19
+  8001aa:	68 33 54 80 00       	push   $0x805433
+  8001af:	e8 79 00 00 00       	call   80022d <_panic>
+		panic("read in parent got %d, then got %d", n, n2);
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+  8001b7:	50                   	push   %eax
+  8001b8:	56                   	push   %esi
+  8001b9:	68 38 55 80 00       	push   $0x805538
+  8001be:	6a 21                	push   $0x21
+  8001c0:	68 33 54 80 00       	push   $0x805433
+  8001c5:	e8 63 00 00 00       	call   80022d <_panic>
+
+008001ca <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ca:	55                   	push   %ebp
+  8001cb:	89 e5                	mov    %esp,%ebp
+  8001cd:	56                   	push   %esi
+  8001ce:	53                   	push   %ebx
+  8001cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8001d5:	e8 ca 0b 00 00       	call   800da4 <sys_getenvid>
+  8001da:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001df:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8001e2:	c1 e0 06             	shl    $0x6,%eax
+  8001e5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001ea:	a3 24 fd 80 00       	mov    %eax,0x80fd24
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001ef:	85 db                	test   %ebx,%ebx
+  8001f1:	7e 07                	jle    8001fa <libmain+0x30>
+		binaryname = argv[0];
+  8001f3:	8b 06                	mov    (%esi),%eax
+  8001f5:	a3 00 70 80 00       	mov    %eax,0x807000
+
+	// call user main routine
+	umain(argc, argv);
+  8001fa:	83 ec 08             	sub    $0x8,%esp
+  8001fd:	56                   	push   %esi
+  8001fe:	53                   	push   %ebx
+  8001ff:	e8 2f fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800204:	e8 0a 00 00 00       	call   800213 <exit>
+}
+  800209:	83 c4 10             	add    $0x10,%esp
+  80020c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80020f:	5b                   	pop    %ebx
+  800210:	5e                   	pop    %esi
+  800211:	5d                   	pop    %ebp
+  800212:	c3                   	ret
+
+00800213 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800213:	55                   	push   %ebp
+  800214:	89 e5                	mov    %esp,%ebp
+  800216:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800219:	e8 de 18 00 00       	call   801afc <close_all>
+	sys_env_destroy(0);
+  80021e:	83 ec 0c             	sub    $0xc,%esp
+  800221:	6a 00                	push   $0x0
+  800223:	e8 3b 0b 00 00       	call   800d63 <sys_env_destroy>
+}
+  800228:	83 c4 10             	add    $0x10,%esp
+  80022b:	c9                   	leave
+  80022c:	c3                   	ret
+
+0080022d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80022d:	55                   	push   %ebp
+  80022e:	89 e5                	mov    %esp,%ebp
+  800230:	56                   	push   %esi
+  800231:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800232:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800235:	8b 35 00 70 80 00    	mov    0x807000,%esi
+  80023b:	e8 64 0b 00 00       	call   800da4 <sys_getenvid>
+  800240:	83 ec 0c             	sub    $0xc,%esp
+  800243:	ff 75 0c             	push   0xc(%ebp)
+  800246:	ff 75 08             	push   0x8(%ebp)
+  800249:	56                   	push   %esi
+  80024a:	50                   	push   %eax
+  80024b:	68 68 55 80 00       	push   $0x805568
+  800250:	e8 b3 00 00 00       	call   800308 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800255:	83 c4 18             	add    $0x18,%esp
+  800258:	53                   	push   %ebx
+  800259:	ff 75 10             	push   0x10(%ebp)
+  80025c:	e8 56 00 00 00       	call   8002b7 <vcprintf>
+	cprintf("\n");
+  800261:	c7 04 24 37 5b 80 00 	movl   $0x805b37,(%esp)
+  800268:	e8 9b 00 00 00       	call   800308 <cprintf>
+  80026d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800270:	cc                   	int3
+	while (1)
+  800271:	eb fd                	jmp    800270 <_panic+0x43>
+
+00800273 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800273:	55                   	push   %ebp
+  800274:	89 e5                	mov    %esp,%ebp
+  800276:	53                   	push   %ebx
+  800277:	83 ec 04             	sub    $0x4,%esp
+  80027a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80027d:	8b 13                	mov    (%ebx),%edx
+  80027f:	8d 42 01             	lea    0x1(%edx),%eax
+  800282:	89 03                	mov    %eax,(%ebx)
+  800284:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800287:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80028b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800290:	74 09                	je     80029b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800292:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800296:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800299:	c9                   	leave
+  80029a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80029b:	83 ec 08             	sub    $0x8,%esp
+  80029e:	68 ff 00 00 00       	push   $0xff
+  8002a3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002a6:	50                   	push   %eax
+  8002a7:	e8 69 0a 00 00       	call   800d15 <sys_cputs>
+		b->idx = 0;
+  8002ac:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002b2:	83 c4 10             	add    $0x10,%esp
+  8002b5:	eb db                	jmp    800292 <putch+0x1f>
+
+008002b7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002b7:	55                   	push   %ebp
+  8002b8:	89 e5                	mov    %esp,%ebp
+  8002ba:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002c0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002c7:	00 00 00 
+	b.cnt = 0;
+  8002ca:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002d1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002d4:	ff 75 0c             	push   0xc(%ebp)
+  8002d7:	ff 75 08             	push   0x8(%ebp)
+  8002da:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002e0:	50                   	push   %eax
+  8002e1:	68 73 02 80 00       	push   $0x800273
+  8002e6:	e8 14 01 00 00       	call   8003ff <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002eb:	83 c4 08             	add    $0x8,%esp
+  8002ee:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002f4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002fa:	50                   	push   %eax
+  8002fb:	e8 15 0a 00 00       	call   800d15 <sys_cputs>
+
+	return b.cnt;
+}
+  800300:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800306:	c9                   	leave
+  800307:	c3                   	ret
+
+00800308 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800308:	55                   	push   %ebp
+  800309:	89 e5                	mov    %esp,%ebp
+  80030b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80030e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800311:	50                   	push   %eax
+  800312:	ff 75 08             	push   0x8(%ebp)
+  800315:	e8 9d ff ff ff       	call   8002b7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80031a:	c9                   	leave
+  80031b:	c3                   	ret
+
+0080031c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80031c:	55                   	push   %ebp
+  80031d:	89 e5                	mov    %esp,%ebp
+  80031f:	57                   	push   %edi
+  800320:	56                   	push   %esi
+  800321:	53                   	push   %ebx
+  800322:	83 ec 1c             	sub    $0x1c,%esp
+  800325:	89 c7                	mov    %eax,%edi
+  800327:	89 d6                	mov    %edx,%esi
+  800329:	8b 45 08             	mov    0x8(%ebp),%eax
+  80032c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80032f:	89 d1                	mov    %edx,%ecx
+  800331:	89 c2                	mov    %eax,%edx
+  800333:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800336:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800339:	8b 45 10             	mov    0x10(%ebp),%eax
+  80033c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80033f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800342:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800349:	39 c2                	cmp    %eax,%edx
+  80034b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80034e:	72 3e                	jb     80038e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800350:	83 ec 0c             	sub    $0xc,%esp
+  800353:	ff 75 18             	push   0x18(%ebp)
+  800356:	83 eb 01             	sub    $0x1,%ebx
+  800359:	53                   	push   %ebx
+  80035a:	50                   	push   %eax
+  80035b:	83 ec 08             	sub    $0x8,%esp
+  80035e:	ff 75 e4             	push   -0x1c(%ebp)
+  800361:	ff 75 e0             	push   -0x20(%ebp)
+  800364:	ff 75 dc             	push   -0x24(%ebp)
+  800367:	ff 75 d8             	push   -0x28(%ebp)
+  80036a:	e8 6e 4f 00 00       	call   8052dd <__udivdi3>
+  80036f:	83 c4 18             	add    $0x18,%esp
+  800372:	52                   	push   %edx
+  800373:	50                   	push   %eax
+  800374:	89 f2                	mov    %esi,%edx
+  800376:	89 f8                	mov    %edi,%eax
+  800378:	e8 9f ff ff ff       	call   80031c <printnum>
+  80037d:	83 c4 20             	add    $0x20,%esp
+  800380:	eb 13                	jmp    800395 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800382:	83 ec 08             	sub    $0x8,%esp
+  800385:	56                   	push   %esi
+  800386:	ff 75 18             	push   0x18(%ebp)
+  800389:	ff d7                	call   *%edi
+  80038b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80038e:	83 eb 01             	sub    $0x1,%ebx
+  800391:	85 db                	test   %ebx,%ebx
+  800393:	7f ed                	jg     800382 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800395:	83 ec 08             	sub    $0x8,%esp
+  800398:	56                   	push   %esi
+  800399:	83 ec 04             	sub    $0x4,%esp
+  80039c:	ff 75 e4             	push   -0x1c(%ebp)
+  80039f:	ff 75 e0             	push   -0x20(%ebp)
+  8003a2:	ff 75 dc             	push   -0x24(%ebp)
+  8003a5:	ff 75 d8             	push   -0x28(%ebp)
+  8003a8:	e8 4e 4f 00 00       	call   8052fb <__umoddi3>
+  8003ad:	83 c4 14             	add    $0x14,%esp
+  8003b0:	0f be 80 8b 55 80 00 	movsbl 0x80558b(%eax),%eax
+  8003b7:	50                   	push   %eax
+  8003b8:	ff d7                	call   *%edi
+}
+  8003ba:	83 c4 10             	add    $0x10,%esp
+  8003bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c0:	5b                   	pop    %ebx
+  8003c1:	5e                   	pop    %esi
+  8003c2:	5f                   	pop    %edi
+  8003c3:	5d                   	pop    %ebp
+  8003c4:	c3                   	ret
+
+008003c5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003c5:	55                   	push   %ebp
+  8003c6:	89 e5                	mov    %esp,%ebp
+  8003c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003cb:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003cf:	8b 10                	mov    (%eax),%edx
+  8003d1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003d4:	73 0a                	jae    8003e0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003d6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003d9:	89 08                	mov    %ecx,(%eax)
+  8003db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003de:	88 02                	mov    %al,(%edx)
+}
+  8003e0:	5d                   	pop    %ebp
+  8003e1:	c3                   	ret
+
+008003e2 <printfmt>:
+{
+  8003e2:	55                   	push   %ebp
+  8003e3:	89 e5                	mov    %esp,%ebp
+  8003e5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003e8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003eb:	50                   	push   %eax
+  8003ec:	ff 75 10             	push   0x10(%ebp)
+  8003ef:	ff 75 0c             	push   0xc(%ebp)
+  8003f2:	ff 75 08             	push   0x8(%ebp)
+  8003f5:	e8 05 00 00 00       	call   8003ff <vprintfmt>
+}
+  8003fa:	83 c4 10             	add    $0x10,%esp
+  8003fd:	c9                   	leave
+  8003fe:	c3                   	ret
+
+008003ff <vprintfmt>:
+{
+  8003ff:	55                   	push   %ebp
+  800400:	89 e5                	mov    %esp,%ebp
+  800402:	57                   	push   %edi
+  800403:	56                   	push   %esi
+  800404:	53                   	push   %ebx
+  800405:	83 ec 2c             	sub    $0x2c,%esp
+  800408:	8b 75 08             	mov    0x8(%ebp),%esi
+  80040b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80040e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800411:	eb 0a                	jmp    80041d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800413:	83 ec 08             	sub    $0x8,%esp
+  800416:	53                   	push   %ebx
+  800417:	50                   	push   %eax
+  800418:	ff d6                	call   *%esi
+  80041a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80041d:	83 c7 01             	add    $0x1,%edi
+  800420:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800424:	83 f8 25             	cmp    $0x25,%eax
+  800427:	74 0c                	je     800435 <vprintfmt+0x36>
+			if (ch == '\0')
+  800429:	85 c0                	test   %eax,%eax
+  80042b:	75 e6                	jne    800413 <vprintfmt+0x14>
+}
+  80042d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800430:	5b                   	pop    %ebx
+  800431:	5e                   	pop    %esi
+  800432:	5f                   	pop    %edi
+  800433:	5d                   	pop    %ebp
+  800434:	c3                   	ret
+		padc = ' ';
+  800435:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800439:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800440:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800447:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80044e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800453:	8d 47 01             	lea    0x1(%edi),%eax
+  800456:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800459:	0f b6 17             	movzbl (%edi),%edx
+  80045c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80045f:	3c 55                	cmp    $0x55,%al
+  800461:	0f 87 c5 03 00 00    	ja     80082c <vprintfmt+0x42d>
+  800467:	0f b6 c0             	movzbl %al,%eax
+  80046a:	ff 24 85 20 57 80 00 	jmp    *0x805720(,%eax,4)
+  800471:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800474:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800478:	eb d9                	jmp    800453 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80047d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800481:	eb d0                	jmp    800453 <vprintfmt+0x54>
+  800483:	0f b6 d2             	movzbl %dl,%edx
+  800486:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800489:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800491:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800494:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800498:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80049b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80049e:	83 f9 09             	cmp    $0x9,%ecx
+  8004a1:	77 55                	ja     8004f8 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004a3:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004a6:	eb e9                	jmp    800491 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ab:	8b 00                	mov    (%eax),%eax
+  8004ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8004b6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004bc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c0:	79 91                	jns    800453 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004c2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004cf:	eb 82                	jmp    800453 <vprintfmt+0x54>
+			if (width < 0)
+  8004d1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d4:	85 d2                	test   %edx,%edx
+  8004d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004db:	0f 49 c2             	cmovns %edx,%eax
+  8004de:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004e4:	e9 6a ff ff ff       	jmp    800453 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004ec:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004f3:	e9 5b ff ff ff       	jmp    800453 <vprintfmt+0x54>
+  8004f8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004fe:	eb bc                	jmp    8004bc <vprintfmt+0xbd>
+			lflag++;
+  800500:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800503:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800506:	e9 48 ff ff ff       	jmp    800453 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80050b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050e:	8d 78 04             	lea    0x4(%eax),%edi
+  800511:	83 ec 08             	sub    $0x8,%esp
+  800514:	53                   	push   %ebx
+  800515:	ff 30                	push   (%eax)
+  800517:	ff d6                	call   *%esi
+			break;
+  800519:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80051c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80051f:	e9 63 02 00 00       	jmp    800787 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800524:	8b 45 14             	mov    0x14(%ebp),%eax
+  800527:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80052a:	8b 10                	mov    (%eax),%edx
+  80052c:	89 d0                	mov    %edx,%eax
+  80052e:	f7 d8                	neg    %eax
+  800530:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800533:	83 f8 12             	cmp    $0x12,%eax
+  800536:	7f 23                	jg     80055b <vprintfmt+0x15c>
+  800538:	8b 14 85 80 58 80 00 	mov    0x805880(,%eax,4),%edx
+  80053f:	85 d2                	test   %edx,%edx
+  800541:	74 18                	je     80055b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800543:	52                   	push   %edx
+  800544:	68 ad 5a 80 00       	push   $0x805aad
+  800549:	53                   	push   %ebx
+  80054a:	56                   	push   %esi
+  80054b:	e8 92 fe ff ff       	call   8003e2 <printfmt>
+  800550:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800553:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800556:	e9 2c 02 00 00       	jmp    800787 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80055b:	50                   	push   %eax
+  80055c:	68 a3 55 80 00       	push   $0x8055a3
+  800561:	53                   	push   %ebx
+  800562:	56                   	push   %esi
+  800563:	e8 7a fe ff ff       	call   8003e2 <printfmt>
+  800568:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80056b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80056e:	e9 14 02 00 00       	jmp    800787 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800573:	8b 45 14             	mov    0x14(%ebp),%eax
+  800576:	83 c0 04             	add    $0x4,%eax
+  800579:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80057c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800581:	85 c9                	test   %ecx,%ecx
+  800583:	b8 9c 55 80 00       	mov    $0x80559c,%eax
+  800588:	0f 45 c1             	cmovne %ecx,%eax
+  80058b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80058e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800592:	7e 06                	jle    80059a <vprintfmt+0x19b>
+  800594:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800598:	75 0b                	jne    8005a5 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80059d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005a0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005a3:	eb 5c                	jmp    800601 <vprintfmt+0x202>
+  8005a5:	83 ec 08             	sub    $0x8,%esp
+  8005a8:	ff 75 d0             	push   -0x30(%ebp)
+  8005ab:	ff 75 cc             	push   -0x34(%ebp)
+  8005ae:	e8 19 03 00 00       	call   8008cc <strnlen>
+  8005b3:	89 c2                	mov    %eax,%edx
+  8005b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005b8:	29 d0                	sub    %edx,%eax
+  8005ba:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005bd:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005c7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c9:	eb 0e                	jmp    8005d9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005cb:	83 ec 08             	sub    $0x8,%esp
+  8005ce:	53                   	push   %ebx
+  8005cf:	57                   	push   %edi
+  8005d0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d3:	83 ee 01             	sub    $0x1,%esi
+  8005d6:	83 c4 10             	add    $0x10,%esp
+  8005d9:	85 f6                	test   %esi,%esi
+  8005db:	7f ee                	jg     8005cb <vprintfmt+0x1cc>
+  8005dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e3:	85 c0                	test   %eax,%eax
+  8005e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ea:	0f 49 d0             	cmovns %eax,%edx
+  8005ed:	29 d0                	sub    %edx,%eax
+  8005ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f2:	eb a6                	jmp    80059a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005f4:	83 ec 08             	sub    $0x8,%esp
+  8005f7:	53                   	push   %ebx
+  8005f8:	52                   	push   %edx
+  8005f9:	ff 55 08             	call   *0x8(%ebp)
+  8005fc:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005ff:	89 f1                	mov    %esi,%ecx
+  800601:	8d 71 01             	lea    0x1(%ecx),%esi
+  800604:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800608:	0f be d0             	movsbl %al,%edx
+  80060b:	85 d2                	test   %edx,%edx
+  80060d:	74 28                	je     800637 <vprintfmt+0x238>
+  80060f:	85 ff                	test   %edi,%edi
+  800611:	78 05                	js     800618 <vprintfmt+0x219>
+  800613:	83 ef 01             	sub    $0x1,%edi
+  800616:	78 30                	js     800648 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800618:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80061c:	74 d6                	je     8005f4 <vprintfmt+0x1f5>
+  80061e:	0f be c0             	movsbl %al,%eax
+  800621:	83 e8 20             	sub    $0x20,%eax
+  800624:	83 f8 5e             	cmp    $0x5e,%eax
+  800627:	76 cb                	jbe    8005f4 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800629:	83 ec 08             	sub    $0x8,%esp
+  80062c:	53                   	push   %ebx
+  80062d:	6a 3f                	push   $0x3f
+  80062f:	ff 55 08             	call   *0x8(%ebp)
+  800632:	83 c4 10             	add    $0x10,%esp
+  800635:	eb c8                	jmp    8005ff <vprintfmt+0x200>
+  800637:	8b 75 08             	mov    0x8(%ebp),%esi
+  80063a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80063d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800640:	01 d0                	add    %edx,%eax
+  800642:	29 c8                	sub    %ecx,%eax
+  800644:	89 c7                	mov    %eax,%edi
+  800646:	eb 13                	jmp    80065b <vprintfmt+0x25c>
+  800648:	8b 75 08             	mov    0x8(%ebp),%esi
+  80064b:	eb ed                	jmp    80063a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80064d:	83 ec 08             	sub    $0x8,%esp
+  800650:	53                   	push   %ebx
+  800651:	6a 20                	push   $0x20
+  800653:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800655:	83 ef 01             	sub    $0x1,%edi
+  800658:	83 c4 10             	add    $0x10,%esp
+  80065b:	85 ff                	test   %edi,%edi
+  80065d:	7f ee                	jg     80064d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80065f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800662:	89 45 14             	mov    %eax,0x14(%ebp)
+  800665:	e9 1d 01 00 00       	jmp    800787 <vprintfmt+0x388>
+	if (lflag >= 2)
+  80066a:	83 f9 01             	cmp    $0x1,%ecx
+  80066d:	7f 1b                	jg     80068a <vprintfmt+0x28b>
+	else if (lflag)
+  80066f:	85 c9                	test   %ecx,%ecx
+  800671:	74 63                	je     8006d6 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800673:	8b 45 14             	mov    0x14(%ebp),%eax
+  800676:	8b 00                	mov    (%eax),%eax
+  800678:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80067b:	99                   	cltd
+  80067c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80067f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800682:	8d 40 04             	lea    0x4(%eax),%eax
+  800685:	89 45 14             	mov    %eax,0x14(%ebp)
+  800688:	eb 17                	jmp    8006a1 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80068a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068d:	8b 50 04             	mov    0x4(%eax),%edx
+  800690:	8b 00                	mov    (%eax),%eax
+  800692:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800695:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8d 40 08             	lea    0x8(%eax),%eax
+  80069e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006a1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006a4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006a7:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006ac:	85 c9                	test   %ecx,%ecx
+  8006ae:	0f 89 b9 00 00 00    	jns    80076d <vprintfmt+0x36e>
+				putch('-', putdat);
+  8006b4:	83 ec 08             	sub    $0x8,%esp
+  8006b7:	53                   	push   %ebx
+  8006b8:	6a 2d                	push   $0x2d
+  8006ba:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006bc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006bf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006c2:	f7 da                	neg    %edx
+  8006c4:	83 d1 00             	adc    $0x0,%ecx
+  8006c7:	f7 d9                	neg    %ecx
+  8006c9:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006cc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006d1:	e9 97 00 00 00       	jmp    80076d <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8006d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d9:	8b 00                	mov    (%eax),%eax
+  8006db:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006de:	99                   	cltd
+  8006df:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006eb:	eb b4                	jmp    8006a1 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8006ed:	83 f9 01             	cmp    $0x1,%ecx
+  8006f0:	7f 1b                	jg     80070d <vprintfmt+0x30e>
+	else if (lflag)
+  8006f2:	85 c9                	test   %ecx,%ecx
+  8006f4:	74 2c                	je     800722 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8006f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f9:	8b 10                	mov    (%eax),%edx
+  8006fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800700:	8d 40 04             	lea    0x4(%eax),%eax
+  800703:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800706:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80070b:	eb 60                	jmp    80076d <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80070d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800710:	8b 10                	mov    (%eax),%edx
+  800712:	8b 48 04             	mov    0x4(%eax),%ecx
+  800715:	8d 40 08             	lea    0x8(%eax),%eax
+  800718:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80071b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800720:	eb 4b                	jmp    80076d <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800722:	8b 45 14             	mov    0x14(%ebp),%eax
+  800725:	8b 10                	mov    (%eax),%edx
+  800727:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80072c:	8d 40 04             	lea    0x4(%eax),%eax
+  80072f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800732:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800737:	eb 34                	jmp    80076d <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800739:	83 f9 01             	cmp    $0x1,%ecx
+  80073c:	7f 15                	jg     800753 <vprintfmt+0x354>
+	else if (lflag)
+  80073e:	85 c9                	test   %ecx,%ecx
+  800740:	74 4d                	je     80078f <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800742:	8b 45 14             	mov    0x14(%ebp),%eax
+  800745:	8b 00                	mov    (%eax),%eax
+  800747:	99                   	cltd
+  800748:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80074b:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80074e:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800751:	eb 11                	jmp    800764 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800753:	8b 45 14             	mov    0x14(%ebp),%eax
+  800756:	8b 50 04             	mov    0x4(%eax),%edx
+  800759:	8b 00                	mov    (%eax),%eax
+  80075b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80075e:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800761:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800764:	89 d1                	mov    %edx,%ecx
+  800766:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800768:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80076d:	83 ec 0c             	sub    $0xc,%esp
+  800770:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800774:	50                   	push   %eax
+  800775:	ff 75 e0             	push   -0x20(%ebp)
+  800778:	57                   	push   %edi
+  800779:	51                   	push   %ecx
+  80077a:	52                   	push   %edx
+  80077b:	89 da                	mov    %ebx,%edx
+  80077d:	89 f0                	mov    %esi,%eax
+  80077f:	e8 98 fb ff ff       	call   80031c <printnum>
+			break;
+  800784:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800787:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80078a:	e9 8e fc ff ff       	jmp    80041d <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  80078f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800792:	8b 00                	mov    (%eax),%eax
+  800794:	99                   	cltd
+  800795:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800798:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80079b:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80079e:	eb c4                	jmp    800764 <vprintfmt+0x365>
+			putch('0', putdat);
+  8007a0:	83 ec 08             	sub    $0x8,%esp
+  8007a3:	53                   	push   %ebx
+  8007a4:	6a 30                	push   $0x30
+  8007a6:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007a8:	83 c4 08             	add    $0x8,%esp
+  8007ab:	53                   	push   %ebx
+  8007ac:	6a 78                	push   $0x78
+  8007ae:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b3:	8b 10                	mov    (%eax),%edx
+  8007b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007ba:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c3:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8007c8:	eb a3                	jmp    80076d <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8007ca:	83 f9 01             	cmp    $0x1,%ecx
+  8007cd:	7f 1b                	jg     8007ea <vprintfmt+0x3eb>
+	else if (lflag)
+  8007cf:	85 c9                	test   %ecx,%ecx
+  8007d1:	74 2f                	je     800802 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8007d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d6:	8b 10                	mov    (%eax),%edx
+  8007d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007e3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007e8:	eb 83                	jmp    80076d <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8007ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ed:	8b 10                	mov    (%eax),%edx
+  8007ef:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007f2:	8d 40 08             	lea    0x8(%eax),%eax
+  8007f5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007fd:	e9 6b ff ff ff       	jmp    80076d <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800802:	8b 45 14             	mov    0x14(%ebp),%eax
+  800805:	8b 10                	mov    (%eax),%edx
+  800807:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80080c:	8d 40 04             	lea    0x4(%eax),%eax
+  80080f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800812:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800817:	e9 51 ff ff ff       	jmp    80076d <vprintfmt+0x36e>
+			putch(ch, putdat);
+  80081c:	83 ec 08             	sub    $0x8,%esp
+  80081f:	53                   	push   %ebx
+  800820:	6a 25                	push   $0x25
+  800822:	ff d6                	call   *%esi
+			break;
+  800824:	83 c4 10             	add    $0x10,%esp
+  800827:	e9 5b ff ff ff       	jmp    800787 <vprintfmt+0x388>
+			putch('%', putdat);
+  80082c:	83 ec 08             	sub    $0x8,%esp
+  80082f:	53                   	push   %ebx
+  800830:	6a 25                	push   $0x25
+  800832:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800834:	83 c4 10             	add    $0x10,%esp
+  800837:	89 f8                	mov    %edi,%eax
+  800839:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80083d:	74 05                	je     800844 <vprintfmt+0x445>
+  80083f:	83 e8 01             	sub    $0x1,%eax
+  800842:	eb f5                	jmp    800839 <vprintfmt+0x43a>
+  800844:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800847:	e9 3b ff ff ff       	jmp    800787 <vprintfmt+0x388>
+
+0080084c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80084c:	55                   	push   %ebp
+  80084d:	89 e5                	mov    %esp,%ebp
+  80084f:	83 ec 18             	sub    $0x18,%esp
+  800852:	8b 45 08             	mov    0x8(%ebp),%eax
+  800855:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800858:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80085b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80085f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800862:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800869:	85 c0                	test   %eax,%eax
+  80086b:	74 26                	je     800893 <vsnprintf+0x47>
+  80086d:	85 d2                	test   %edx,%edx
+  80086f:	7e 22                	jle    800893 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800871:	ff 75 14             	push   0x14(%ebp)
+  800874:	ff 75 10             	push   0x10(%ebp)
+  800877:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80087a:	50                   	push   %eax
+  80087b:	68 c5 03 80 00       	push   $0x8003c5
+  800880:	e8 7a fb ff ff       	call   8003ff <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800885:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800888:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80088b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80088e:	83 c4 10             	add    $0x10,%esp
+}
+  800891:	c9                   	leave
+  800892:	c3                   	ret
+		return -E_INVAL;
+  800893:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800898:	eb f7                	jmp    800891 <vsnprintf+0x45>
+
+0080089a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80089a:	55                   	push   %ebp
+  80089b:	89 e5                	mov    %esp,%ebp
+  80089d:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008a0:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008a3:	50                   	push   %eax
+  8008a4:	ff 75 10             	push   0x10(%ebp)
+  8008a7:	ff 75 0c             	push   0xc(%ebp)
+  8008aa:	ff 75 08             	push   0x8(%ebp)
+  8008ad:	e8 9a ff ff ff       	call   80084c <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008b2:	c9                   	leave
+  8008b3:	c3                   	ret
+
+008008b4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008b4:	55                   	push   %ebp
+  8008b5:	89 e5                	mov    %esp,%ebp
+  8008b7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008bf:	eb 03                	jmp    8008c4 <strlen+0x10>
+		n++;
+  8008c1:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008c4:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008c8:	75 f7                	jne    8008c1 <strlen+0xd>
+	return n;
+}
+  8008ca:	5d                   	pop    %ebp
+  8008cb:	c3                   	ret
+
+008008cc <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008cc:	55                   	push   %ebp
+  8008cd:	89 e5                	mov    %esp,%ebp
+  8008cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008da:	eb 03                	jmp    8008df <strnlen+0x13>
+		n++;
+  8008dc:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008df:	39 d0                	cmp    %edx,%eax
+  8008e1:	74 08                	je     8008eb <strnlen+0x1f>
+  8008e3:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008e7:	75 f3                	jne    8008dc <strnlen+0x10>
+  8008e9:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008eb:	89 d0                	mov    %edx,%eax
+  8008ed:	5d                   	pop    %ebp
+  8008ee:	c3                   	ret
+
+008008ef <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008ef:	55                   	push   %ebp
+  8008f0:	89 e5                	mov    %esp,%ebp
+  8008f2:	53                   	push   %ebx
+  8008f3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fe:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800902:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800905:	83 c0 01             	add    $0x1,%eax
+  800908:	84 d2                	test   %dl,%dl
+  80090a:	75 f2                	jne    8008fe <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80090c:	89 c8                	mov    %ecx,%eax
+  80090e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800911:	c9                   	leave
+  800912:	c3                   	ret
+
+00800913 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800913:	55                   	push   %ebp
+  800914:	89 e5                	mov    %esp,%ebp
+  800916:	53                   	push   %ebx
+  800917:	83 ec 10             	sub    $0x10,%esp
+  80091a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80091d:	53                   	push   %ebx
+  80091e:	e8 91 ff ff ff       	call   8008b4 <strlen>
+  800923:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800926:	ff 75 0c             	push   0xc(%ebp)
+  800929:	01 d8                	add    %ebx,%eax
+  80092b:	50                   	push   %eax
+  80092c:	e8 be ff ff ff       	call   8008ef <strcpy>
+	return dst;
+}
+  800931:	89 d8                	mov    %ebx,%eax
+  800933:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800936:	c9                   	leave
+  800937:	c3                   	ret
+
+00800938 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800938:	55                   	push   %ebp
+  800939:	89 e5                	mov    %esp,%ebp
+  80093b:	56                   	push   %esi
+  80093c:	53                   	push   %ebx
+  80093d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800940:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800943:	89 f3                	mov    %esi,%ebx
+  800945:	03 5d 10             	add    0x10(%ebp),%ebx
+  800948:	89 f0                	mov    %esi,%eax
+  80094a:	eb 0f                	jmp    80095b <strncpy+0x23>
+		*dst++ = *src;
+  80094c:	83 c0 01             	add    $0x1,%eax
+  80094f:	0f b6 0a             	movzbl (%edx),%ecx
+  800952:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800955:	80 f9 01             	cmp    $0x1,%cl
+  800958:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80095b:	39 d8                	cmp    %ebx,%eax
+  80095d:	75 ed                	jne    80094c <strncpy+0x14>
+	}
+	return ret;
+}
+  80095f:	89 f0                	mov    %esi,%eax
+  800961:	5b                   	pop    %ebx
+  800962:	5e                   	pop    %esi
+  800963:	5d                   	pop    %ebp
+  800964:	c3                   	ret
+
+00800965 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800965:	55                   	push   %ebp
+  800966:	89 e5                	mov    %esp,%ebp
+  800968:	56                   	push   %esi
+  800969:	53                   	push   %ebx
+  80096a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80096d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800970:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800973:	89 f0                	mov    %esi,%eax
+  800975:	85 d2                	test   %edx,%edx
+  800977:	74 21                	je     80099a <strlcpy+0x35>
+  800979:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80097d:	89 f2                	mov    %esi,%edx
+  80097f:	eb 09                	jmp    80098a <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800981:	83 c1 01             	add    $0x1,%ecx
+  800984:	83 c2 01             	add    $0x1,%edx
+  800987:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80098a:	39 c2                	cmp    %eax,%edx
+  80098c:	74 09                	je     800997 <strlcpy+0x32>
+  80098e:	0f b6 19             	movzbl (%ecx),%ebx
+  800991:	84 db                	test   %bl,%bl
+  800993:	75 ec                	jne    800981 <strlcpy+0x1c>
+  800995:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800997:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80099a:	29 f0                	sub    %esi,%eax
+}
+  80099c:	5b                   	pop    %ebx
+  80099d:	5e                   	pop    %esi
+  80099e:	5d                   	pop    %ebp
+  80099f:	c3                   	ret
+
+008009a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009a0:	55                   	push   %ebp
+  8009a1:	89 e5                	mov    %esp,%ebp
+  8009a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009a9:	eb 06                	jmp    8009b1 <strcmp+0x11>
+		p++, q++;
+  8009ab:	83 c1 01             	add    $0x1,%ecx
+  8009ae:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009b1:	0f b6 01             	movzbl (%ecx),%eax
+  8009b4:	84 c0                	test   %al,%al
+  8009b6:	74 04                	je     8009bc <strcmp+0x1c>
+  8009b8:	3a 02                	cmp    (%edx),%al
+  8009ba:	74 ef                	je     8009ab <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009bc:	0f b6 c0             	movzbl %al,%eax
+  8009bf:	0f b6 12             	movzbl (%edx),%edx
+  8009c2:	29 d0                	sub    %edx,%eax
+}
+  8009c4:	5d                   	pop    %ebp
+  8009c5:	c3                   	ret
+
+008009c6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009c6:	55                   	push   %ebp
+  8009c7:	89 e5                	mov    %esp,%ebp
+  8009c9:	53                   	push   %ebx
+  8009ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009d0:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009d3:	eb 09                	jmp    8009de <strncmp+0x18>
+		n--, p++, q++;
+  8009d5:	83 ea 01             	sub    $0x1,%edx
+  8009d8:	83 c0 01             	add    $0x1,%eax
+  8009db:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009de:	85 d2                	test   %edx,%edx
+  8009e0:	74 18                	je     8009fa <strncmp+0x34>
+  8009e2:	0f b6 18             	movzbl (%eax),%ebx
+  8009e5:	84 db                	test   %bl,%bl
+  8009e7:	74 04                	je     8009ed <strncmp+0x27>
+  8009e9:	3a 19                	cmp    (%ecx),%bl
+  8009eb:	74 e8                	je     8009d5 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009ed:	0f b6 00             	movzbl (%eax),%eax
+  8009f0:	0f b6 11             	movzbl (%ecx),%edx
+  8009f3:	29 d0                	sub    %edx,%eax
+}
+  8009f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009f8:	c9                   	leave
+  8009f9:	c3                   	ret
+		return 0;
+  8009fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ff:	eb f4                	jmp    8009f5 <strncmp+0x2f>
+
+00800a01 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a01:	55                   	push   %ebp
+  800a02:	89 e5                	mov    %esp,%ebp
+  800a04:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a07:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a0b:	eb 03                	jmp    800a10 <strchr+0xf>
+  800a0d:	83 c0 01             	add    $0x1,%eax
+  800a10:	0f b6 10             	movzbl (%eax),%edx
+  800a13:	84 d2                	test   %dl,%dl
+  800a15:	74 06                	je     800a1d <strchr+0x1c>
+		if (*s == c)
+  800a17:	38 ca                	cmp    %cl,%dl
+  800a19:	75 f2                	jne    800a0d <strchr+0xc>
+  800a1b:	eb 05                	jmp    800a22 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a22:	5d                   	pop    %ebp
+  800a23:	c3                   	ret
+
+00800a24 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a24:	55                   	push   %ebp
+  800a25:	89 e5                	mov    %esp,%ebp
+  800a27:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a2e:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a31:	38 ca                	cmp    %cl,%dl
+  800a33:	74 09                	je     800a3e <strfind+0x1a>
+  800a35:	84 d2                	test   %dl,%dl
+  800a37:	74 05                	je     800a3e <strfind+0x1a>
+	for (; *s; s++)
+  800a39:	83 c0 01             	add    $0x1,%eax
+  800a3c:	eb f0                	jmp    800a2e <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a3e:	5d                   	pop    %ebp
+  800a3f:	c3                   	ret
+
+00800a40 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a40:	55                   	push   %ebp
+  800a41:	89 e5                	mov    %esp,%ebp
+  800a43:	57                   	push   %edi
+  800a44:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a47:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a4a:	85 c9                	test   %ecx,%ecx
+  800a4c:	74 20                	je     800a6e <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a4e:	89 f8                	mov    %edi,%eax
+  800a50:	09 c8                	or     %ecx,%eax
+  800a52:	a8 03                	test   $0x3,%al
+  800a54:	75 12                	jne    800a68 <memset+0x28>
+		c &= 0xFF;
+  800a56:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a5a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a60:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a63:	fc                   	cld
+  800a64:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a66:	eb 06                	jmp    800a6e <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a6b:	fc                   	cld
+  800a6c:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a6e:	89 f8                	mov    %edi,%eax
+  800a70:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a73:	c9                   	leave
+  800a74:	c3                   	ret
+
+00800a75 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a75:	55                   	push   %ebp
+  800a76:	89 e5                	mov    %esp,%ebp
+  800a78:	57                   	push   %edi
+  800a79:	56                   	push   %esi
+  800a7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a7d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a80:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a83:	39 c6                	cmp    %eax,%esi
+  800a85:	73 32                	jae    800ab9 <memmove+0x44>
+  800a87:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a8a:	39 d0                	cmp    %edx,%eax
+  800a8c:	73 2b                	jae    800ab9 <memmove+0x44>
+		s += n;
+		d += n;
+  800a8e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a91:	89 d6                	mov    %edx,%esi
+  800a93:	09 fe                	or     %edi,%esi
+  800a95:	09 ce                	or     %ecx,%esi
+  800a97:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a9d:	75 0e                	jne    800aad <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a9f:	83 ef 04             	sub    $0x4,%edi
+  800aa2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aa5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800aa8:	fd                   	std
+  800aa9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aab:	eb 09                	jmp    800ab6 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800aad:	83 ef 01             	sub    $0x1,%edi
+  800ab0:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ab3:	fd                   	std
+  800ab4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ab6:	fc                   	cld
+  800ab7:	eb 1a                	jmp    800ad3 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ab9:	89 f2                	mov    %esi,%edx
+  800abb:	09 c2                	or     %eax,%edx
+  800abd:	09 ca                	or     %ecx,%edx
+  800abf:	f6 c2 03             	test   $0x3,%dl
+  800ac2:	75 0a                	jne    800ace <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ac4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ac7:	89 c7                	mov    %eax,%edi
+  800ac9:	fc                   	cld
+  800aca:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800acc:	eb 05                	jmp    800ad3 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ace:	89 c7                	mov    %eax,%edi
+  800ad0:	fc                   	cld
+  800ad1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ad3:	5e                   	pop    %esi
+  800ad4:	5f                   	pop    %edi
+  800ad5:	5d                   	pop    %ebp
+  800ad6:	c3                   	ret
+
+00800ad7 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800add:	ff 75 10             	push   0x10(%ebp)
+  800ae0:	ff 75 0c             	push   0xc(%ebp)
+  800ae3:	ff 75 08             	push   0x8(%ebp)
+  800ae6:	e8 8a ff ff ff       	call   800a75 <memmove>
+}
+  800aeb:	c9                   	leave
+  800aec:	c3                   	ret
+
+00800aed <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800aed:	55                   	push   %ebp
+  800aee:	89 e5                	mov    %esp,%ebp
+  800af0:	56                   	push   %esi
+  800af1:	53                   	push   %ebx
+  800af2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800af8:	89 c6                	mov    %eax,%esi
+  800afa:	03 75 10             	add    0x10(%ebp),%esi
+  800afd:	eb 06                	jmp    800b05 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800aff:	83 c0 01             	add    $0x1,%eax
+  800b02:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b05:	39 f0                	cmp    %esi,%eax
+  800b07:	74 14                	je     800b1d <memcmp+0x30>
+		if (*s1 != *s2)
+  800b09:	0f b6 08             	movzbl (%eax),%ecx
+  800b0c:	0f b6 1a             	movzbl (%edx),%ebx
+  800b0f:	38 d9                	cmp    %bl,%cl
+  800b11:	74 ec                	je     800aff <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b13:	0f b6 c1             	movzbl %cl,%eax
+  800b16:	0f b6 db             	movzbl %bl,%ebx
+  800b19:	29 d8                	sub    %ebx,%eax
+  800b1b:	eb 05                	jmp    800b22 <memcmp+0x35>
+	}
+
+	return 0;
+  800b1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b22:	5b                   	pop    %ebx
+  800b23:	5e                   	pop    %esi
+  800b24:	5d                   	pop    %ebp
+  800b25:	c3                   	ret
+
+00800b26 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b26:	55                   	push   %ebp
+  800b27:	89 e5                	mov    %esp,%ebp
+  800b29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b2f:	89 c2                	mov    %eax,%edx
+  800b31:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b34:	eb 03                	jmp    800b39 <memfind+0x13>
+  800b36:	83 c0 01             	add    $0x1,%eax
+  800b39:	39 d0                	cmp    %edx,%eax
+  800b3b:	73 04                	jae    800b41 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b3d:	38 08                	cmp    %cl,(%eax)
+  800b3f:	75 f5                	jne    800b36 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b41:	5d                   	pop    %ebp
+  800b42:	c3                   	ret
+
+00800b43 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b43:	55                   	push   %ebp
+  800b44:	89 e5                	mov    %esp,%ebp
+  800b46:	57                   	push   %edi
+  800b47:	56                   	push   %esi
+  800b48:	53                   	push   %ebx
+  800b49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b4f:	eb 03                	jmp    800b54 <strtol+0x11>
+		s++;
+  800b51:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b54:	0f b6 02             	movzbl (%edx),%eax
+  800b57:	3c 20                	cmp    $0x20,%al
+  800b59:	74 f6                	je     800b51 <strtol+0xe>
+  800b5b:	3c 09                	cmp    $0x9,%al
+  800b5d:	74 f2                	je     800b51 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b5f:	3c 2b                	cmp    $0x2b,%al
+  800b61:	74 2a                	je     800b8d <strtol+0x4a>
+	int neg = 0;
+  800b63:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b68:	3c 2d                	cmp    $0x2d,%al
+  800b6a:	74 2b                	je     800b97 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b6c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b72:	75 0f                	jne    800b83 <strtol+0x40>
+  800b74:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b77:	74 28                	je     800ba1 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b79:	85 db                	test   %ebx,%ebx
+  800b7b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b80:	0f 44 d8             	cmove  %eax,%ebx
+  800b83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b88:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b8b:	eb 46                	jmp    800bd3 <strtol+0x90>
+		s++;
+  800b8d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b90:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b95:	eb d5                	jmp    800b6c <strtol+0x29>
+		s++, neg = 1;
+  800b97:	83 c2 01             	add    $0x1,%edx
+  800b9a:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b9f:	eb cb                	jmp    800b6c <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ba1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ba5:	74 0e                	je     800bb5 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ba7:	85 db                	test   %ebx,%ebx
+  800ba9:	75 d8                	jne    800b83 <strtol+0x40>
+		s++, base = 8;
+  800bab:	83 c2 01             	add    $0x1,%edx
+  800bae:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bb3:	eb ce                	jmp    800b83 <strtol+0x40>
+		s += 2, base = 16;
+  800bb5:	83 c2 02             	add    $0x2,%edx
+  800bb8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bbd:	eb c4                	jmp    800b83 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bbf:	0f be c0             	movsbl %al,%eax
+  800bc2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bc5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bc8:	7d 3a                	jge    800c04 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bca:	83 c2 01             	add    $0x1,%edx
+  800bcd:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bd1:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bd3:	0f b6 02             	movzbl (%edx),%eax
+  800bd6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bd9:	89 f3                	mov    %esi,%ebx
+  800bdb:	80 fb 09             	cmp    $0x9,%bl
+  800bde:	76 df                	jbe    800bbf <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800be0:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800be3:	89 f3                	mov    %esi,%ebx
+  800be5:	80 fb 19             	cmp    $0x19,%bl
+  800be8:	77 08                	ja     800bf2 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bea:	0f be c0             	movsbl %al,%eax
+  800bed:	83 e8 57             	sub    $0x57,%eax
+  800bf0:	eb d3                	jmp    800bc5 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bf2:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bf5:	89 f3                	mov    %esi,%ebx
+  800bf7:	80 fb 19             	cmp    $0x19,%bl
+  800bfa:	77 08                	ja     800c04 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bfc:	0f be c0             	movsbl %al,%eax
+  800bff:	83 e8 37             	sub    $0x37,%eax
+  800c02:	eb c1                	jmp    800bc5 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c04:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c08:	74 05                	je     800c0f <strtol+0xcc>
+		*endptr = (char *) s;
+  800c0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c0d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c0f:	89 c8                	mov    %ecx,%eax
+  800c11:	f7 d8                	neg    %eax
+  800c13:	85 ff                	test   %edi,%edi
+  800c15:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c18:	89 c8                	mov    %ecx,%eax
+  800c1a:	5b                   	pop    %ebx
+  800c1b:	5e                   	pop    %esi
+  800c1c:	5f                   	pop    %edi
+  800c1d:	5d                   	pop    %ebp
+  800c1e:	c3                   	ret
+
+00800c1f <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800c1f:	55                   	push   %ebp
+  800c20:	89 e5                	mov    %esp,%ebp
+  800c22:	57                   	push   %edi
+  800c23:	56                   	push   %esi
+  800c24:	53                   	push   %ebx
+  800c25:	83 ec 0c             	sub    $0xc,%esp
+  800c28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800c2b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c2e:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800c31:	85 ff                	test   %edi,%edi
+  800c33:	74 16                	je     800c4b <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800c35:	83 ec 04             	sub    $0x4,%esp
+  800c38:	56                   	push   %esi
+  800c39:	6a 00                	push   $0x0
+  800c3b:	53                   	push   %ebx
+  800c3c:	e8 02 ff ff ff       	call   800b43 <strtol>
+  800c41:	89 07                	mov    %eax,(%edi)
+  800c43:	83 c4 10             	add    $0x10,%esp
+  800c46:	eb 03                	jmp    800c4b <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800c48:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800c4b:	0f b6 03             	movzbl (%ebx),%eax
+  800c4e:	3c 20                	cmp    $0x20,%al
+  800c50:	74 f6                	je     800c48 <strisl+0x29>
+  800c52:	3c 09                	cmp    $0x9,%al
+  800c54:	74 f2                	je     800c48 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c56:	3c 2b                	cmp    $0x2b,%al
+  800c58:	74 23                	je     800c7d <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800c5a:	3c 2d                	cmp    $0x2d,%al
+  800c5c:	0f 94 c0             	sete   %al
+  800c5f:	0f b6 c0             	movzbl %al,%eax
+  800c62:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c64:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800c6a:	75 41                	jne    800cad <strisl+0x8e>
+  800c6c:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800c6f:	74 11                	je     800c82 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c71:	85 f6                	test   %esi,%esi
+  800c73:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c78:	0f 44 f0             	cmove  %eax,%esi
+  800c7b:	eb 30                	jmp    800cad <strisl+0x8e>
+		s++;
+  800c7d:	83 c3 01             	add    $0x1,%ebx
+  800c80:	eb e2                	jmp    800c64 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c82:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800c86:	74 0e                	je     800c96 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800c88:	85 f6                	test   %esi,%esi
+  800c8a:	75 21                	jne    800cad <strisl+0x8e>
+		s++, base = 8;
+  800c8c:	83 c3 01             	add    $0x1,%ebx
+  800c8f:	be 08 00 00 00       	mov    $0x8,%esi
+  800c94:	eb 17                	jmp    800cad <strisl+0x8e>
+		s += 2, base = 16;
+  800c96:	83 c3 02             	add    $0x2,%ebx
+  800c99:	be 10 00 00 00       	mov    $0x10,%esi
+  800c9e:	eb 0d                	jmp    800cad <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ca0:	0f be c0             	movsbl %al,%eax
+  800ca3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800ca6:	39 f0                	cmp    %esi,%eax
+  800ca8:	7d 38                	jge    800ce2 <strisl+0xc3>
+			return 0;
+		s++;
+  800caa:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800cad:	0f b6 03             	movzbl (%ebx),%eax
+  800cb0:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800cb3:	80 fa 09             	cmp    $0x9,%dl
+  800cb6:	76 e8                	jbe    800ca0 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800cb8:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800cbb:	80 fa 19             	cmp    $0x19,%dl
+  800cbe:	77 08                	ja     800cc8 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800cc0:	0f be c0             	movsbl %al,%eax
+  800cc3:	83 e8 57             	sub    $0x57,%eax
+  800cc6:	eb de                	jmp    800ca6 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cc8:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800ccb:	80 fa 19             	cmp    $0x19,%dl
+  800cce:	77 08                	ja     800cd8 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800cd0:	0f be c0             	movsbl %al,%eax
+  800cd3:	83 e8 37             	sub    $0x37,%eax
+  800cd6:	eb ce                	jmp    800ca6 <strisl+0x87>
+		else if (!*s)
+  800cd8:	84 c0                	test   %al,%al
+  800cda:	0f 94 c0             	sete   %al
+  800cdd:	0f b6 c0             	movzbl %al,%eax
+  800ce0:	eb 05                	jmp    800ce7 <strisl+0xc8>
+			return 0;
+  800ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800ce7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cea:	5b                   	pop    %ebx
+  800ceb:	5e                   	pop    %esi
+  800cec:	5f                   	pop    %edi
+  800ced:	5d                   	pop    %ebp
+  800cee:	c3                   	ret
+
+00800cef <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800cef:	55                   	push   %ebp
+  800cf0:	89 e5                	mov    %esp,%ebp
+  800cf2:	83 ec 10             	sub    $0x10,%esp
+  800cf5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800cf8:	89 c8                	mov    %ecx,%eax
+  800cfa:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800cff:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800d02:	eb 0b                	jmp    800d0f <touch_mem+0x20>
+		c = *(char *)page;
+  800d04:	0f b6 10             	movzbl (%eax),%edx
+  800d07:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800d0a:	05 00 10 00 00       	add    $0x1000,%eax
+  800d0f:	39 c8                	cmp    %ecx,%eax
+  800d11:	72 f1                	jb     800d04 <touch_mem+0x15>
+}
+  800d13:	c9                   	leave
+  800d14:	c3                   	ret
+
+00800d15 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d15:	55                   	push   %ebp
+  800d16:	89 e5                	mov    %esp,%ebp
+  800d18:	57                   	push   %edi
+  800d19:	56                   	push   %esi
+  800d1a:	53                   	push   %ebx
+	touch_mem(s, len);
+  800d1b:	ff 75 0c             	push   0xc(%ebp)
+  800d1e:	ff 75 08             	push   0x8(%ebp)
+  800d21:	e8 c9 ff ff ff       	call   800cef <touch_mem>
+	asm volatile("int %1\n"
+  800d26:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d31:	89 c3                	mov    %eax,%ebx
+  800d33:	89 c7                	mov    %eax,%edi
+  800d35:	89 c6                	mov    %eax,%esi
+  800d37:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d39:	83 c4 08             	add    $0x8,%esp
+  800d3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3f:	5b                   	pop    %ebx
+  800d40:	5e                   	pop    %esi
+  800d41:	5f                   	pop    %edi
+  800d42:	5d                   	pop    %ebp
+  800d43:	c3                   	ret
+
+00800d44 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d44:	55                   	push   %ebp
+  800d45:	89 e5                	mov    %esp,%ebp
+  800d47:	57                   	push   %edi
+  800d48:	56                   	push   %esi
+  800d49:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d54:	89 d1                	mov    %edx,%ecx
+  800d56:	89 d3                	mov    %edx,%ebx
+  800d58:	89 d7                	mov    %edx,%edi
+  800d5a:	89 d6                	mov    %edx,%esi
+  800d5c:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d5e:	5b                   	pop    %ebx
+  800d5f:	5e                   	pop    %esi
+  800d60:	5f                   	pop    %edi
+  800d61:	5d                   	pop    %ebp
+  800d62:	c3                   	ret
+
+00800d63 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d63:	55                   	push   %ebp
+  800d64:	89 e5                	mov    %esp,%ebp
+  800d66:	57                   	push   %edi
+  800d67:	56                   	push   %esi
+  800d68:	53                   	push   %ebx
+  800d69:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d74:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d79:	89 cb                	mov    %ecx,%ebx
+  800d7b:	89 cf                	mov    %ecx,%edi
+  800d7d:	89 ce                	mov    %ecx,%esi
+  800d7f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d81:	85 c0                	test   %eax,%eax
+  800d83:	7f 08                	jg     800d8d <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d88:	5b                   	pop    %ebx
+  800d89:	5e                   	pop    %esi
+  800d8a:	5f                   	pop    %edi
+  800d8b:	5d                   	pop    %ebp
+  800d8c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d8d:	83 ec 0c             	sub    $0xc,%esp
+  800d90:	50                   	push   %eax
+  800d91:	6a 03                	push   $0x3
+  800d93:	68 eb 58 80 00       	push   $0x8058eb
+  800d98:	6a 23                	push   $0x23
+  800d9a:	68 08 59 80 00       	push   $0x805908
+  800d9f:	e8 89 f4 ff ff       	call   80022d <_panic>
+
+00800da4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800da4:	55                   	push   %ebp
+  800da5:	89 e5                	mov    %esp,%ebp
+  800da7:	57                   	push   %edi
+  800da8:	56                   	push   %esi
+  800da9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800daa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800daf:	b8 02 00 00 00       	mov    $0x2,%eax
+  800db4:	89 d1                	mov    %edx,%ecx
+  800db6:	89 d3                	mov    %edx,%ebx
+  800db8:	89 d7                	mov    %edx,%edi
+  800dba:	89 d6                	mov    %edx,%esi
+  800dbc:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dbe:	5b                   	pop    %ebx
+  800dbf:	5e                   	pop    %esi
+  800dc0:	5f                   	pop    %edi
+  800dc1:	5d                   	pop    %ebp
+  800dc2:	c3                   	ret
+
+00800dc3 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dc3:	55                   	push   %ebp
+  800dc4:	89 e5                	mov    %esp,%ebp
+  800dc6:	57                   	push   %edi
+  800dc7:	56                   	push   %esi
+  800dc8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dce:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dd3:	89 d1                	mov    %edx,%ecx
+  800dd5:	89 d3                	mov    %edx,%ebx
+  800dd7:	89 d7                	mov    %edx,%edi
+  800dd9:	89 d6                	mov    %edx,%esi
+  800ddb:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ddd:	5b                   	pop    %ebx
+  800dde:	5e                   	pop    %esi
+  800ddf:	5f                   	pop    %edi
+  800de0:	5d                   	pop    %ebp
+  800de1:	c3                   	ret
+
+00800de2 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800de2:	55                   	push   %ebp
+  800de3:	89 e5                	mov    %esp,%ebp
+  800de5:	57                   	push   %edi
+  800de6:	56                   	push   %esi
+  800de7:	53                   	push   %ebx
+  800de8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800deb:	be 00 00 00 00       	mov    $0x0,%esi
+  800df0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df6:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dfb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dfe:	89 f7                	mov    %esi,%edi
+  800e00:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e02:	85 c0                	test   %eax,%eax
+  800e04:	7f 08                	jg     800e0e <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e09:	5b                   	pop    %ebx
+  800e0a:	5e                   	pop    %esi
+  800e0b:	5f                   	pop    %edi
+  800e0c:	5d                   	pop    %ebp
+  800e0d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e0e:	83 ec 0c             	sub    $0xc,%esp
+  800e11:	50                   	push   %eax
+  800e12:	6a 04                	push   $0x4
+  800e14:	68 eb 58 80 00       	push   $0x8058eb
+  800e19:	6a 23                	push   $0x23
+  800e1b:	68 08 59 80 00       	push   $0x805908
+  800e20:	e8 08 f4 ff ff       	call   80022d <_panic>
+
+00800e25 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e25:	55                   	push   %ebp
+  800e26:	89 e5                	mov    %esp,%ebp
+  800e28:	57                   	push   %edi
+  800e29:	56                   	push   %esi
+  800e2a:	53                   	push   %ebx
+  800e2b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e34:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e3c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e3f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e42:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e44:	85 c0                	test   %eax,%eax
+  800e46:	7f 08                	jg     800e50 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4b:	5b                   	pop    %ebx
+  800e4c:	5e                   	pop    %esi
+  800e4d:	5f                   	pop    %edi
+  800e4e:	5d                   	pop    %ebp
+  800e4f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e50:	83 ec 0c             	sub    $0xc,%esp
+  800e53:	50                   	push   %eax
+  800e54:	6a 05                	push   $0x5
+  800e56:	68 eb 58 80 00       	push   $0x8058eb
+  800e5b:	6a 23                	push   $0x23
+  800e5d:	68 08 59 80 00       	push   $0x805908
+  800e62:	e8 c6 f3 ff ff       	call   80022d <_panic>
+
+00800e67 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e67:	55                   	push   %ebp
+  800e68:	89 e5                	mov    %esp,%ebp
+  800e6a:	57                   	push   %edi
+  800e6b:	56                   	push   %esi
+  800e6c:	53                   	push   %ebx
+  800e6d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e80:	89 df                	mov    %ebx,%edi
+  800e82:	89 de                	mov    %ebx,%esi
+  800e84:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e86:	85 c0                	test   %eax,%eax
+  800e88:	7f 08                	jg     800e92 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8d:	5b                   	pop    %ebx
+  800e8e:	5e                   	pop    %esi
+  800e8f:	5f                   	pop    %edi
+  800e90:	5d                   	pop    %ebp
+  800e91:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e92:	83 ec 0c             	sub    $0xc,%esp
+  800e95:	50                   	push   %eax
+  800e96:	6a 06                	push   $0x6
+  800e98:	68 eb 58 80 00       	push   $0x8058eb
+  800e9d:	6a 23                	push   $0x23
+  800e9f:	68 08 59 80 00       	push   $0x805908
+  800ea4:	e8 84 f3 ff ff       	call   80022d <_panic>
+
+00800ea9 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800ea9:	55                   	push   %ebp
+  800eaa:	89 e5                	mov    %esp,%ebp
+  800eac:	57                   	push   %edi
+  800ead:	56                   	push   %esi
+  800eae:	53                   	push   %ebx
+  800eaf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebd:	b8 18 00 00 00       	mov    $0x18,%eax
+  800ec2:	89 df                	mov    %ebx,%edi
+  800ec4:	89 de                	mov    %ebx,%esi
+  800ec6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec8:	85 c0                	test   %eax,%eax
+  800eca:	7f 08                	jg     800ed4 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ecc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecf:	5b                   	pop    %ebx
+  800ed0:	5e                   	pop    %esi
+  800ed1:	5f                   	pop    %edi
+  800ed2:	5d                   	pop    %ebp
+  800ed3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed4:	83 ec 0c             	sub    $0xc,%esp
+  800ed7:	50                   	push   %eax
+  800ed8:	6a 18                	push   $0x18
+  800eda:	68 eb 58 80 00       	push   $0x8058eb
+  800edf:	6a 23                	push   $0x23
+  800ee1:	68 08 59 80 00       	push   $0x805908
+  800ee6:	e8 42 f3 ff ff       	call   80022d <_panic>
+
+00800eeb <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800eeb:	55                   	push   %ebp
+  800eec:	89 e5                	mov    %esp,%ebp
+  800eee:	57                   	push   %edi
+  800eef:	56                   	push   %esi
+  800ef0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ef1:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efc:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f04:	89 f7                	mov    %esi,%edi
+  800f06:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800f08:	5b                   	pop    %ebx
+  800f09:	5e                   	pop    %esi
+  800f0a:	5f                   	pop    %edi
+  800f0b:	5d                   	pop    %ebp
+  800f0c:	c3                   	ret
+
+00800f0d <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800f0d:	55                   	push   %ebp
+  800f0e:	89 e5                	mov    %esp,%ebp
+  800f10:	57                   	push   %edi
+  800f11:	56                   	push   %esi
+  800f12:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f19:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f1e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f26:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f29:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800f2b:	5b                   	pop    %ebx
+  800f2c:	5e                   	pop    %esi
+  800f2d:	5f                   	pop    %edi
+  800f2e:	5d                   	pop    %ebp
+  800f2f:	c3                   	ret
+
+00800f30 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800f30:	55                   	push   %ebp
+  800f31:	89 e5                	mov    %esp,%ebp
+  800f33:	57                   	push   %edi
+  800f34:	56                   	push   %esi
+  800f35:	53                   	push   %ebx
+  800f36:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800f39:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800f3c:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800f42:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800f45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f53:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f56:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f58:	85 c0                	test   %eax,%eax
+  800f5a:	7f 08                	jg     800f64 <sys_page_map_range+0x34>
+}
+  800f5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5f:	5b                   	pop    %ebx
+  800f60:	5e                   	pop    %esi
+  800f61:	5f                   	pop    %edi
+  800f62:	5d                   	pop    %ebp
+  800f63:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f64:	83 ec 0c             	sub    $0xc,%esp
+  800f67:	50                   	push   %eax
+  800f68:	6a 10                	push   $0x10
+  800f6a:	68 eb 58 80 00       	push   $0x8058eb
+  800f6f:	6a 23                	push   $0x23
+  800f71:	68 08 59 80 00       	push   $0x805908
+  800f76:	e8 b2 f2 ff ff       	call   80022d <_panic>
+
+00800f7b <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f7b:	55                   	push   %ebp
+  800f7c:	89 e5                	mov    %esp,%ebp
+  800f7e:	57                   	push   %edi
+  800f7f:	56                   	push   %esi
+  800f80:	53                   	push   %ebx
+  800f81:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f84:	be 00 00 00 00       	mov    $0x0,%esi
+  800f89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8f:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f97:	89 f7                	mov    %esi,%edi
+  800f99:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f9b:	85 c0                	test   %eax,%eax
+  800f9d:	7f 08                	jg     800fa7 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa2:	5b                   	pop    %ebx
+  800fa3:	5e                   	pop    %esi
+  800fa4:	5f                   	pop    %edi
+  800fa5:	5d                   	pop    %ebp
+  800fa6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa7:	83 ec 0c             	sub    $0xc,%esp
+  800faa:	50                   	push   %eax
+  800fab:	6a 11                	push   $0x11
+  800fad:	68 eb 58 80 00       	push   $0x8058eb
+  800fb2:	6a 23                	push   $0x23
+  800fb4:	68 08 59 80 00       	push   $0x805908
+  800fb9:	e8 6f f2 ff ff       	call   80022d <_panic>
+
+00800fbe <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800fbe:	55                   	push   %ebp
+  800fbf:	89 e5                	mov    %esp,%ebp
+  800fc1:	57                   	push   %edi
+  800fc2:	56                   	push   %esi
+  800fc3:	53                   	push   %ebx
+  800fc4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fc7:	be 00 00 00 00       	mov    $0x0,%esi
+  800fcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800fd7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fda:	89 f7                	mov    %esi,%edi
+  800fdc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fde:	85 c0                	test   %eax,%eax
+  800fe0:	7f 08                	jg     800fea <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800fe2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe5:	5b                   	pop    %ebx
+  800fe6:	5e                   	pop    %esi
+  800fe7:	5f                   	pop    %edi
+  800fe8:	5d                   	pop    %ebp
+  800fe9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fea:	83 ec 0c             	sub    $0xc,%esp
+  800fed:	50                   	push   %eax
+  800fee:	6a 1b                	push   $0x1b
+  800ff0:	68 eb 58 80 00       	push   $0x8058eb
+  800ff5:	6a 23                	push   $0x23
+  800ff7:	68 08 59 80 00       	push   $0x805908
+  800ffc:	e8 2c f2 ff ff       	call   80022d <_panic>
+
+00801001 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  801001:	55                   	push   %ebp
+  801002:	89 e5                	mov    %esp,%ebp
+  801004:	57                   	push   %edi
+  801005:	56                   	push   %esi
+  801006:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801007:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801011:	89 d1                	mov    %edx,%ecx
+  801013:	89 d3                	mov    %edx,%ebx
+  801015:	89 d7                	mov    %edx,%edi
+  801017:	89 d6                	mov    %edx,%esi
+  801019:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80101b:	5b                   	pop    %ebx
+  80101c:	5e                   	pop    %esi
+  80101d:	5f                   	pop    %edi
+  80101e:	5d                   	pop    %ebp
+  80101f:	c3                   	ret
+
+00801020 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801020:	55                   	push   %ebp
+  801021:	89 e5                	mov    %esp,%ebp
+  801023:	57                   	push   %edi
+  801024:	56                   	push   %esi
+  801025:	53                   	push   %ebx
+  801026:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801029:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801031:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801034:	b8 08 00 00 00       	mov    $0x8,%eax
+  801039:	89 df                	mov    %ebx,%edi
+  80103b:	89 de                	mov    %ebx,%esi
+  80103d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80103f:	85 c0                	test   %eax,%eax
+  801041:	7f 08                	jg     80104b <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801043:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801046:	5b                   	pop    %ebx
+  801047:	5e                   	pop    %esi
+  801048:	5f                   	pop    %edi
+  801049:	5d                   	pop    %ebp
+  80104a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80104b:	83 ec 0c             	sub    $0xc,%esp
+  80104e:	50                   	push   %eax
+  80104f:	6a 08                	push   $0x8
+  801051:	68 eb 58 80 00       	push   $0x8058eb
+  801056:	6a 23                	push   $0x23
+  801058:	68 08 59 80 00       	push   $0x805908
+  80105d:	e8 cb f1 ff ff       	call   80022d <_panic>
+
+00801062 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801062:	55                   	push   %ebp
+  801063:	89 e5                	mov    %esp,%ebp
+  801065:	57                   	push   %edi
+  801066:	56                   	push   %esi
+  801067:	53                   	push   %ebx
+  801068:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  80106b:	6a 44                	push   $0x44
+  80106d:	ff 75 0c             	push   0xc(%ebp)
+  801070:	e8 7a fc ff ff       	call   800cef <touch_mem>
+	asm volatile("int %1\n"
+  801075:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801082:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801085:	89 df                	mov    %ebx,%edi
+  801087:	89 de                	mov    %ebx,%esi
+  801089:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80108b:	83 c4 08             	add    $0x8,%esp
+  80108e:	85 c0                	test   %eax,%eax
+  801090:	7f 08                	jg     80109a <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801092:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801095:	5b                   	pop    %ebx
+  801096:	5e                   	pop    %esi
+  801097:	5f                   	pop    %edi
+  801098:	5d                   	pop    %ebp
+  801099:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109a:	83 ec 0c             	sub    $0xc,%esp
+  80109d:	50                   	push   %eax
+  80109e:	6a 09                	push   $0x9
+  8010a0:	68 eb 58 80 00       	push   $0x8058eb
+  8010a5:	6a 23                	push   $0x23
+  8010a7:	68 08 59 80 00       	push   $0x805908
+  8010ac:	e8 7c f1 ff ff       	call   80022d <_panic>
+
+008010b1 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  8010b1:	55                   	push   %ebp
+  8010b2:	89 e5                	mov    %esp,%ebp
+  8010b4:	57                   	push   %edi
+  8010b5:	56                   	push   %esi
+  8010b6:	53                   	push   %ebx
+  8010b7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8010bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8010ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010cd:	89 f7                	mov    %esi,%edi
+  8010cf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010d1:	85 c0                	test   %eax,%eax
+  8010d3:	7f 08                	jg     8010dd <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  8010d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d8:	5b                   	pop    %ebx
+  8010d9:	5e                   	pop    %esi
+  8010da:	5f                   	pop    %edi
+  8010db:	5d                   	pop    %ebp
+  8010dc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010dd:	83 ec 0c             	sub    $0xc,%esp
+  8010e0:	50                   	push   %eax
+  8010e1:	6a 1a                	push   $0x1a
+  8010e3:	68 eb 58 80 00       	push   $0x8058eb
+  8010e8:	6a 23                	push   $0x23
+  8010ea:	68 08 59 80 00       	push   $0x805908
+  8010ef:	e8 39 f1 ff ff       	call   80022d <_panic>
+
+008010f4 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8010f4:	55                   	push   %ebp
+  8010f5:	89 e5                	mov    %esp,%ebp
+  8010f7:	57                   	push   %edi
+  8010f8:	56                   	push   %esi
+  8010f9:	53                   	push   %ebx
+  8010fa:	83 ec 0c             	sub    $0xc,%esp
+  8010fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801100:	89 d8                	mov    %ebx,%eax
+  801102:	c1 e0 05             	shl    $0x5,%eax
+  801105:	50                   	push   %eax
+  801106:	ff 75 0c             	push   0xc(%ebp)
+  801109:	e8 e1 fb ff ff       	call   800cef <touch_mem>
+	asm volatile("int %1\n"
+  80110e:	be 00 00 00 00       	mov    $0x0,%esi
+  801113:	8b 55 08             	mov    0x8(%ebp),%edx
+  801116:	b8 13 00 00 00       	mov    $0x13,%eax
+  80111b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111e:	89 f7                	mov    %esi,%edi
+  801120:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801122:	83 c4 08             	add    $0x8,%esp
+  801125:	85 c0                	test   %eax,%eax
+  801127:	7f 08                	jg     801131 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  801129:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112c:	5b                   	pop    %ebx
+  80112d:	5e                   	pop    %esi
+  80112e:	5f                   	pop    %edi
+  80112f:	5d                   	pop    %ebp
+  801130:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801131:	83 ec 0c             	sub    $0xc,%esp
+  801134:	50                   	push   %eax
+  801135:	6a 13                	push   $0x13
+  801137:	68 eb 58 80 00       	push   $0x8058eb
+  80113c:	6a 23                	push   $0x23
+  80113e:	68 08 59 80 00       	push   $0x805908
+  801143:	e8 e5 f0 ff ff       	call   80022d <_panic>
+
+00801148 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	57                   	push   %edi
+  80114c:	56                   	push   %esi
+  80114d:	53                   	push   %ebx
+  80114e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801151:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801156:	8b 55 08             	mov    0x8(%ebp),%edx
+  801159:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801161:	89 df                	mov    %ebx,%edi
+  801163:	89 de                	mov    %ebx,%esi
+  801165:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801167:	85 c0                	test   %eax,%eax
+  801169:	7f 08                	jg     801173 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80116b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80116e:	5b                   	pop    %ebx
+  80116f:	5e                   	pop    %esi
+  801170:	5f                   	pop    %edi
+  801171:	5d                   	pop    %ebp
+  801172:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801173:	83 ec 0c             	sub    $0xc,%esp
+  801176:	50                   	push   %eax
+  801177:	6a 0a                	push   $0xa
+  801179:	68 eb 58 80 00       	push   $0x8058eb
+  80117e:	6a 23                	push   $0x23
+  801180:	68 08 59 80 00       	push   $0x805908
+  801185:	e8 a3 f0 ff ff       	call   80022d <_panic>
+
+0080118a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80118a:	55                   	push   %ebp
+  80118b:	89 e5                	mov    %esp,%ebp
+  80118d:	57                   	push   %edi
+  80118e:	56                   	push   %esi
+  80118f:	53                   	push   %ebx
+  801190:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801193:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801199:	76 1d                	jbe    8011b8 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80119b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011a6:	be 01 00 00 00       	mov    $0x1,%esi
+  8011ab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011ae:	cd 30                	int    $0x30
+}
+  8011b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b3:	5b                   	pop    %ebx
+  8011b4:	5e                   	pop    %esi
+  8011b5:	5f                   	pop    %edi
+  8011b6:	5d                   	pop    %ebp
+  8011b7:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011b8:	68 00 10 00 00       	push   $0x1000
+  8011bd:	53                   	push   %ebx
+  8011be:	e8 2c fb ff ff       	call   800cef <touch_mem>
+  8011c3:	83 c4 08             	add    $0x8,%esp
+  8011c6:	eb d3                	jmp    80119b <sys_ipc_send+0x11>
+
+008011c8 <sys_ipc_send_pages>:
+{
+  8011c8:	55                   	push   %ebp
+  8011c9:	89 e5                	mov    %esp,%ebp
+  8011cb:	57                   	push   %edi
+  8011cc:	56                   	push   %esi
+  8011cd:	53                   	push   %ebx
+  8011ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d1:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8011d4:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011da:	76 18                	jbe    8011f4 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8011dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011e7:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8011ea:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8011ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ef:	5b                   	pop    %ebx
+  8011f0:	5e                   	pop    %esi
+  8011f1:	5f                   	pop    %edi
+  8011f2:	5d                   	pop    %ebp
+  8011f3:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011f4:	89 f0                	mov    %esi,%eax
+  8011f6:	c1 e0 0c             	shl    $0xc,%eax
+  8011f9:	50                   	push   %eax
+  8011fa:	53                   	push   %ebx
+  8011fb:	e8 ef fa ff ff       	call   800cef <touch_mem>
+  801200:	83 c4 08             	add    $0x8,%esp
+  801203:	eb d7                	jmp    8011dc <sys_ipc_send_pages+0x14>
+
+00801205 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801205:	55                   	push   %ebp
+  801206:	89 e5                	mov    %esp,%ebp
+  801208:	57                   	push   %edi
+  801209:	56                   	push   %esi
+  80120a:	53                   	push   %ebx
+  80120b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80120e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801213:	8b 55 08             	mov    0x8(%ebp),%edx
+  801216:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801219:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80121e:	89 df                	mov    %ebx,%edi
+  801220:	89 de                	mov    %ebx,%esi
+  801222:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801224:	85 c0                	test   %eax,%eax
+  801226:	7f 08                	jg     801230 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801228:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80122b:	5b                   	pop    %ebx
+  80122c:	5e                   	pop    %esi
+  80122d:	5f                   	pop    %edi
+  80122e:	5d                   	pop    %ebp
+  80122f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801230:	83 ec 0c             	sub    $0xc,%esp
+  801233:	50                   	push   %eax
+  801234:	6a 0d                	push   $0xd
+  801236:	68 eb 58 80 00       	push   $0x8058eb
+  80123b:	6a 23                	push   $0x23
+  80123d:	68 08 59 80 00       	push   $0x805908
+  801242:	e8 e6 ef ff ff       	call   80022d <_panic>
+
+00801247 <sys_ipc_recv>:
+{
+  801247:	55                   	push   %ebp
+  801248:	89 e5                	mov    %esp,%ebp
+  80124a:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80124d:	6a 01                	push   $0x1
+  80124f:	ff 75 08             	push   0x8(%ebp)
+  801252:	e8 ae ff ff ff       	call   801205 <sys_ipc_recv_pages>
+}
+  801257:	c9                   	leave
+  801258:	c3                   	ret
+
+00801259 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801259:	55                   	push   %ebp
+  80125a:	89 e5                	mov    %esp,%ebp
+  80125c:	57                   	push   %edi
+  80125d:	56                   	push   %esi
+  80125e:	53                   	push   %ebx
+  80125f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801262:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801265:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801268:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80126e:	77 04                	ja     801274 <sys_ipc_call+0x1b>
+  801270:	85 f6                	test   %esi,%esi
+  801272:	75 15                	jne    801289 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801274:	8b 55 08             	mov    0x8(%ebp),%edx
+  801277:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80127f:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801281:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801284:	5b                   	pop    %ebx
+  801285:	5e                   	pop    %esi
+  801286:	5f                   	pop    %edi
+  801287:	5d                   	pop    %ebp
+  801288:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  801289:	89 f8                	mov    %edi,%eax
+  80128b:	c1 e0 0c             	shl    $0xc,%eax
+  80128e:	50                   	push   %eax
+  80128f:	53                   	push   %ebx
+  801290:	e8 5a fa ff ff       	call   800cef <touch_mem>
+  801295:	83 c4 08             	add    $0x8,%esp
+  801298:	eb da                	jmp    801274 <sys_ipc_call+0x1b>
+
+0080129a <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80129a:	55                   	push   %ebp
+  80129b:	89 e5                	mov    %esp,%ebp
+  80129d:	57                   	push   %edi
+  80129e:	56                   	push   %esi
+  80129f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a6:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012ae:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012b1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012b4:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8012b6:	5b                   	pop    %ebx
+  8012b7:	5e                   	pop    %esi
+  8012b8:	5f                   	pop    %edi
+  8012b9:	5d                   	pop    %ebp
+  8012ba:	c3                   	ret
+
+008012bb <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8012bb:	55                   	push   %ebp
+  8012bc:	89 e5                	mov    %esp,%ebp
+  8012be:	57                   	push   %edi
+  8012bf:	56                   	push   %esi
+  8012c0:	53                   	push   %ebx
+  8012c1:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8012c4:	6a 04                	push   $0x4
+  8012c6:	ff 75 08             	push   0x8(%ebp)
+  8012c9:	e8 21 fa ff ff       	call   800cef <touch_mem>
+	asm volatile("int %1\n"
+  8012ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d6:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012e1:	89 f7                	mov    %esi,%edi
+  8012e3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012e5:	83 c4 08             	add    $0x8,%esp
+  8012e8:	85 c0                	test   %eax,%eax
+  8012ea:	7f 08                	jg     8012f4 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8012ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ef:	5b                   	pop    %ebx
+  8012f0:	5e                   	pop    %esi
+  8012f1:	5f                   	pop    %edi
+  8012f2:	5d                   	pop    %ebp
+  8012f3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012f4:	83 ec 0c             	sub    $0xc,%esp
+  8012f7:	50                   	push   %eax
+  8012f8:	6a 16                	push   $0x16
+  8012fa:	68 eb 58 80 00       	push   $0x8058eb
+  8012ff:	6a 23                	push   $0x23
+  801301:	68 08 59 80 00       	push   $0x805908
+  801306:	e8 22 ef ff ff       	call   80022d <_panic>
+
+0080130b <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80130b:	55                   	push   %ebp
+  80130c:	89 e5                	mov    %esp,%ebp
+  80130e:	57                   	push   %edi
+  80130f:	56                   	push   %esi
+  801310:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801311:	6a 04                	push   $0x4
+  801313:	ff 75 08             	push   0x8(%ebp)
+  801316:	e8 d4 f9 ff ff       	call   800cef <touch_mem>
+	asm volatile("int %1\n"
+  80131b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801320:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801323:	b8 17 00 00 00       	mov    $0x17,%eax
+  801328:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132b:	89 df                	mov    %ebx,%edi
+  80132d:	89 de                	mov    %ebx,%esi
+  80132f:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801331:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801334:	5b                   	pop    %ebx
+  801335:	5e                   	pop    %esi
+  801336:	5f                   	pop    %edi
+  801337:	5d                   	pop    %ebp
+  801338:	c3                   	ret
+
+00801339 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  801339:	55                   	push   %ebp
+  80133a:	89 e5                	mov    %esp,%ebp
+  80133c:	57                   	push   %edi
+  80133d:	56                   	push   %esi
+  80133e:	53                   	push   %ebx
+  80133f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801342:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801347:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80134f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801354:	89 df                	mov    %ebx,%edi
+  801356:	89 de                	mov    %ebx,%esi
+  801358:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80135a:	85 c0                	test   %eax,%eax
+  80135c:	7f 08                	jg     801366 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80135e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801361:	5b                   	pop    %ebx
+  801362:	5e                   	pop    %esi
+  801363:	5f                   	pop    %edi
+  801364:	5d                   	pop    %ebp
+  801365:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801366:	83 ec 0c             	sub    $0xc,%esp
+  801369:	50                   	push   %eax
+  80136a:	6a 0e                	push   $0xe
+  80136c:	68 eb 58 80 00       	push   $0x8058eb
+  801371:	6a 23                	push   $0x23
+  801373:	68 08 59 80 00       	push   $0x805908
+  801378:	e8 b0 ee ff ff       	call   80022d <_panic>
+
+0080137d <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  80137d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801384:	f6 c6 06             	test   $0x6,%dh
+  801387:	75 37                	jne    8013c0 <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  801389:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801390:	f6 c2 02             	test   $0x2,%dl
+  801393:	75 19                	jne    8013ae <dupperm+0x31>
+  801395:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80139c:	f6 c6 08             	test   $0x8,%dh
+  80139f:	75 0d                	jne    8013ae <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  8013a1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013a8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013ad:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  8013ae:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013b5:	25 00 06 00 00       	and    $0x600,%eax
+  8013ba:	0d 05 08 00 00       	or     $0x805,%eax
+  8013bf:	c3                   	ret
+		return 0;
+  8013c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013c5:	c3                   	ret
+
+008013c6 <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  8013c6:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  8013c8:	c1 e0 0c             	shl    $0xc,%eax
+  8013cb:	c1 e8 16             	shr    $0x16,%eax
+  8013ce:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8013d5:	f6 c1 01             	test   $0x1,%cl
+  8013d8:	74 2c                	je     801406 <dupable+0x40>
+  8013da:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8013e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e6:	f6 c1 04             	test   $0x4,%cl
+  8013e9:	74 20                	je     80140b <dupable+0x45>
+  8013eb:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8013f2:	f6 c1 01             	test   $0x1,%cl
+  8013f5:	74 14                	je     80140b <dupable+0x45>
+  8013f7:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8013fe:	c1 e8 02             	shr    $0x2,%eax
+  801401:	83 e0 01             	and    $0x1,%eax
+  801404:	eb 05                	jmp    80140b <dupable+0x45>
+  801406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140b:	83 e0 01             	and    $0x1,%eax
+}
+  80140e:	c3                   	ret
+
+0080140f <pgfault>:
+{
+  80140f:	55                   	push   %ebp
+  801410:	89 e5                	mov    %esp,%ebp
+  801412:	56                   	push   %esi
+  801413:	53                   	push   %ebx
+  801414:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801417:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  801419:	89 ca                	mov    %ecx,%edx
+  80141b:	c1 ea 0c             	shr    $0xc,%edx
+  80141e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801425:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801429:	0f 84 8e 00 00 00    	je     8014bd <pgfault+0xae>
+		return 0;
+  80142f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801434:	f6 c6 08             	test   $0x8,%dh
+  801437:	0f 84 85 00 00 00    	je     8014c2 <pgfault+0xb3>
+	perm |= PTE_W;
+  80143d:	81 e2 07 06 00 00    	and    $0x607,%edx
+  801443:	89 d3                	mov    %edx,%ebx
+  801445:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801448:	89 ce                	mov    %ecx,%esi
+  80144a:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  801450:	6a 01                	push   $0x1
+  801452:	53                   	push   %ebx
+  801453:	68 00 f0 7f 00       	push   $0x7ff000
+  801458:	6a 00                	push   $0x0
+  80145a:	e8 a5 27 00 00       	call   803c04 <page_alloc>
+  80145f:	83 c4 10             	add    $0x10,%esp
+  801462:	85 c0                	test   %eax,%eax
+  801464:	78 33                	js     801499 <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  801466:	83 ec 04             	sub    $0x4,%esp
+  801469:	68 00 10 00 00       	push   $0x1000
+  80146e:	56                   	push   %esi
+  80146f:	68 00 f0 7f 00       	push   $0x7ff000
+  801474:	e8 fc f5 ff ff       	call   800a75 <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  801479:	89 1c 24             	mov    %ebx,(%esp)
+  80147c:	56                   	push   %esi
+  80147d:	6a 00                	push   $0x0
+  80147f:	68 00 f0 7f 00       	push   $0x7ff000
+  801484:	6a 00                	push   $0x0
+  801486:	e8 da 2d 00 00       	call   804265 <page_map>
+  80148b:	83 c4 20             	add    $0x20,%esp
+  80148e:	85 c0                	test   %eax,%eax
+  801490:	78 19                	js     8014ab <pgfault+0x9c>
+	return 1;
+  801492:	b8 01 00 00 00       	mov    $0x1,%eax
+  801497:	eb 29                	jmp    8014c2 <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  801499:	50                   	push   %eax
+  80149a:	68 18 59 80 00       	push   $0x805918
+  80149f:	6a 2e                	push   $0x2e
+  8014a1:	68 6b 59 80 00       	push   $0x80596b
+  8014a6:	e8 82 ed ff ff       	call   80022d <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  8014ab:	50                   	push   %eax
+  8014ac:	68 44 59 80 00       	push   $0x805944
+  8014b1:	6a 32                	push   $0x32
+  8014b3:	68 6b 59 80 00       	push   $0x80596b
+  8014b8:	e8 70 ed ff ff       	call   80022d <_panic>
+		return 0;
+  8014bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014c5:	5b                   	pop    %ebx
+  8014c6:	5e                   	pop    %esi
+  8014c7:	5d                   	pop    %ebp
+  8014c8:	c3                   	ret
+
+008014c9 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8014c9:	55                   	push   %ebp
+  8014ca:	89 e5                	mov    %esp,%ebp
+  8014cc:	57                   	push   %edi
+  8014cd:	56                   	push   %esi
+  8014ce:	53                   	push   %ebx
+  8014cf:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  8014d2:	83 3d 20 fd 80 00 00 	cmpl   $0x0,0x80fd20
+  8014d9:	74 5d                	je     801538 <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  8014db:	83 ec 0c             	sub    $0xc,%esp
+  8014de:	68 0f 14 80 00       	push   $0x80140f
+  8014e3:	e8 de 39 00 00       	call   804ec6 <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  8014e8:	e8 14 fb ff ff       	call   801001 <sys_fork>
+  8014ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8014f0:	83 c4 10             	add    $0x10,%esp
+  8014f3:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8014f6:	74 47                	je     80153f <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  8014f8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8014fc:	0f 84 c5 03 00 00    	je     8018c7 <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  801502:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801506:	78 25                	js     80152d <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  801508:	e8 6f 20 00 00       	call   80357c <page_share_paged_out>
+  80150d:	85 c0                	test   %eax,%eax
+  80150f:	0f 88 d8 03 00 00    	js     8018ed <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801515:	83 ec 08             	sub    $0x8,%esp
+  801518:	6a 02                	push   $0x2
+  80151a:	ff 75 e4             	push   -0x1c(%ebp)
+  80151d:	e8 fe fa ff ff       	call   801020 <sys_env_set_status>
+  801522:	83 c4 10             	add    $0x10,%esp
+  801525:	85 c0                	test   %eax,%eax
+  801527:	0f 88 d5 03 00 00    	js     801902 <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  80152d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801530:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801533:	5b                   	pop    %ebx
+  801534:	5e                   	pop    %esi
+  801535:	5f                   	pop    %edi
+  801536:	5d                   	pop    %ebp
+  801537:	c3                   	ret
+		init_map_dir();
+  801538:	e8 47 23 00 00       	call   803884 <init_map_dir>
+  80153d:	eb 9c                	jmp    8014db <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80153f:	b8 07 00 00 00       	mov    $0x7,%eax
+  801544:	cd 30                	int    $0x30
+  801546:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  801549:	85 c0                	test   %eax,%eax
+  80154b:	78 10                	js     80155d <fork+0x94>
+	if (envid == 0)
+  80154d:	0f 84 74 03 00 00    	je     8018c7 <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801553:	be 00 00 00 00       	mov    $0x0,%esi
+  801558:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80155b:	eb 30                	jmp    80158d <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  80155d:	50                   	push   %eax
+  80155e:	68 76 59 80 00       	push   $0x805976
+  801563:	68 cd 00 00 00       	push   $0xcd
+  801568:	68 6b 59 80 00       	push   $0x80596b
+  80156d:	e8 bb ec ff ff       	call   80022d <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  801572:	89 f2                	mov    %esi,%edx
+  801574:	c1 fa 1f             	sar    $0x1f,%edx
+  801577:	c1 ea 16             	shr    $0x16,%edx
+  80157a:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  80157d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801582:	29 d0                	sub    %edx,%eax
+  801584:	ba 00 04 00 00       	mov    $0x400,%edx
+  801589:	29 c2                	sub    %eax,%edx
+  80158b:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  80158d:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  801590:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801596:	0f 87 ff 02 00 00    	ja     80189b <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  80159c:	89 f3                	mov    %esi,%ebx
+  80159e:	c1 e3 0c             	shl    $0xc,%ebx
+  8015a1:	89 d8                	mov    %ebx,%eax
+  8015a3:	c1 e8 16             	shr    $0x16,%eax
+  8015a6:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8015ad:	f6 c2 01             	test   $0x1,%dl
+  8015b0:	74 c0                	je     801572 <fork+0xa9>
+  8015b2:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8015b9:	f6 c2 04             	test   $0x4,%dl
+  8015bc:	74 b4                	je     801572 <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  8015be:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015c5:	a8 80                	test   $0x80,%al
+  8015c7:	75 24                	jne    8015ed <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  8015c9:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8015d0:	25 81 00 00 00       	and    $0x81,%eax
+  8015d5:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8015da:	74 21                	je     8015fd <fork+0x134>
+		if (!dupable(pn)) {
+  8015dc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015df:	e8 e2 fd ff ff       	call   8013c6 <dupable>
+  8015e4:	84 c0                	test   %al,%al
+  8015e6:	75 1a                	jne    801602 <fork+0x139>
+			++pn;
+  8015e8:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8015eb:	eb a0                	jmp    80158d <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  8015ed:	83 ec 08             	sub    $0x8,%esp
+  8015f0:	53                   	push   %ebx
+  8015f1:	6a 00                	push   $0x0
+  8015f3:	e8 b1 f8 ff ff       	call   800ea9 <sys_page_split>
+  8015f8:	83 c4 10             	add    $0x10,%esp
+  8015fb:	eb cc                	jmp    8015c9 <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  8015fd:	0f b6 03             	movzbl (%ebx),%eax
+  801600:	eb da                	jmp    8015dc <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  801602:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801605:	89 f8                	mov    %edi,%eax
+  801607:	e8 71 fd ff ff       	call   80137d <dupperm>
+  80160c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80160f:	85 c0                	test   %eax,%eax
+  801611:	74 16                	je     801629 <fork+0x160>
+  801613:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  801618:	29 f8                	sub    %edi,%eax
+  80161a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  80161d:	bf 01 00 00 00       	mov    $0x1,%edi
+  801622:	89 c6                	mov    %eax,%esi
+  801624:	e9 c4 01 00 00       	jmp    8017ed <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  801629:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80162c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801633:	f6 c4 04             	test   $0x4,%ah
+  801636:	0f 85 89 00 00 00    	jne    8016c5 <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  80163c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80163f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801646:	f6 c4 02             	test   $0x2,%ah
+  801649:	0f 85 b1 00 00 00    	jne    801700 <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  80164f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801652:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801659:	a8 02                	test   $0x2,%al
+  80165b:	75 10                	jne    80166d <fork+0x1a4>
+  80165d:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801664:	f6 c4 08             	test   $0x8,%ah
+  801667:	0f 84 3e 01 00 00    	je     8017ab <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  80166d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801670:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801677:	25 00 06 00 00       	and    $0x600,%eax
+  80167c:	0d 05 08 00 00       	or     $0x805,%eax
+  801681:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  801683:	c1 e1 0c             	shl    $0xc,%ecx
+  801686:	89 cb                	mov    %ecx,%ebx
+  801688:	83 ec 0c             	sub    $0xc,%esp
+  80168b:	50                   	push   %eax
+  80168c:	51                   	push   %ecx
+  80168d:	ff 75 e4             	push   -0x1c(%ebp)
+  801690:	51                   	push   %ecx
+  801691:	6a 00                	push   $0x0
+  801693:	e8 cd 2b 00 00       	call   804265 <page_map>
+  801698:	83 c4 20             	add    $0x20,%esp
+  80169b:	85 c0                	test   %eax,%eax
+  80169d:	0f 88 e4 00 00 00    	js     801787 <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  8016a3:	83 ec 0c             	sub    $0xc,%esp
+  8016a6:	57                   	push   %edi
+  8016a7:	53                   	push   %ebx
+  8016a8:	6a 00                	push   $0x0
+  8016aa:	53                   	push   %ebx
+  8016ab:	6a 00                	push   $0x0
+  8016ad:	e8 b3 2b 00 00       	call   804265 <page_map>
+  8016b2:	83 c4 20             	add    $0x20,%esp
+  8016b5:	85 c0                	test   %eax,%eax
+  8016b7:	0f 88 dc 00 00 00    	js     801799 <fork+0x2d0>
+			++pn;
+  8016bd:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8016c0:	e9 c8 fe ff ff       	jmp    80158d <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8016c5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8016c8:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8016cf:	c1 e1 0c             	shl    $0xc,%ecx
+  8016d2:	83 ec 0c             	sub    $0xc,%esp
+  8016d5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016da:	50                   	push   %eax
+  8016db:	51                   	push   %ecx
+  8016dc:	ff 75 e4             	push   -0x1c(%ebp)
+  8016df:	51                   	push   %ecx
+  8016e0:	6a 00                	push   $0x0
+  8016e2:	e8 7e 2b 00 00       	call   804265 <page_map>
+  8016e7:	83 c4 20             	add    $0x20,%esp
+  8016ea:	85 c0                	test   %eax,%eax
+  8016ec:	79 cf                	jns    8016bd <fork+0x1f4>
+			panic("page_map %d", r);
+  8016ee:	50                   	push   %eax
+  8016ef:	68 86 59 80 00       	push   $0x805986
+  8016f4:	6a 4d                	push   $0x4d
+  8016f6:	68 6b 59 80 00       	push   $0x80596b
+  8016fb:	e8 2d eb ff ff       	call   80022d <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  801700:	83 ec 0c             	sub    $0xc,%esp
+  801703:	68 00 10 00 00       	push   $0x1000
+  801708:	e8 4a 31 00 00       	call   804857 <malloc>
+  80170d:	89 c7                	mov    %eax,%edi
+  80170f:	83 c4 10             	add    $0x10,%esp
+  801712:	85 c0                	test   %eax,%eax
+  801714:	74 4b                	je     801761 <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  801716:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801719:	c1 e3 0c             	shl    $0xc,%ebx
+  80171c:	83 ec 04             	sub    $0x4,%esp
+  80171f:	68 00 10 00 00       	push   $0x1000
+  801724:	53                   	push   %ebx
+  801725:	50                   	push   %eax
+  801726:	e8 ac f3 ff ff       	call   800ad7 <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  80172b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80172e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801735:	25 07 0e 00 00       	and    $0xe07,%eax
+  80173a:	89 04 24             	mov    %eax,(%esp)
+  80173d:	53                   	push   %ebx
+  80173e:	ff 75 e4             	push   -0x1c(%ebp)
+  801741:	57                   	push   %edi
+  801742:	6a 00                	push   $0x0
+  801744:	e8 1c 2b 00 00       	call   804265 <page_map>
+  801749:	83 c4 20             	add    $0x20,%esp
+  80174c:	85 c0                	test   %eax,%eax
+  80174e:	78 25                	js     801775 <fork+0x2ac>
+		free(temp);
+  801750:	83 ec 0c             	sub    $0xc,%esp
+  801753:	57                   	push   %edi
+  801754:	e8 fc 2e 00 00       	call   804655 <free>
+  801759:	83 c4 10             	add    $0x10,%esp
+  80175c:	e9 5c ff ff ff       	jmp    8016bd <fork+0x1f4>
+			panic("malloc failed");
+  801761:	83 ec 04             	sub    $0x4,%esp
+  801764:	68 92 59 80 00       	push   $0x805992
+  801769:	6a 56                	push   $0x56
+  80176b:	68 6b 59 80 00       	push   $0x80596b
+  801770:	e8 b8 ea ff ff       	call   80022d <_panic>
+			panic("page_map: %e", r);
+  801775:	50                   	push   %eax
+  801776:	68 a0 59 80 00       	push   $0x8059a0
+  80177b:	6a 59                	push   $0x59
+  80177d:	68 6b 59 80 00       	push   $0x80596b
+  801782:	e8 a6 ea ff ff       	call   80022d <_panic>
+			panic("page_map %d", r);
+  801787:	50                   	push   %eax
+  801788:	68 86 59 80 00       	push   $0x805986
+  80178d:	6a 65                	push   $0x65
+  80178f:	68 6b 59 80 00       	push   $0x80596b
+  801794:	e8 94 ea ff ff       	call   80022d <_panic>
+			panic("page_map %d", r);
+  801799:	50                   	push   %eax
+  80179a:	68 86 59 80 00       	push   $0x805986
+  80179f:	6a 78                	push   $0x78
+  8017a1:	68 6b 59 80 00       	push   $0x80596b
+  8017a6:	e8 82 ea ff ff       	call   80022d <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8017ab:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8017ae:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8017b5:	c1 e1 0c             	shl    $0xc,%ecx
+  8017b8:	83 ec 0c             	sub    $0xc,%esp
+  8017bb:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017c0:	50                   	push   %eax
+  8017c1:	51                   	push   %ecx
+  8017c2:	ff 75 e4             	push   -0x1c(%ebp)
+  8017c5:	51                   	push   %ecx
+  8017c6:	6a 00                	push   $0x0
+  8017c8:	e8 98 2a 00 00       	call   804265 <page_map>
+  8017cd:	83 c4 20             	add    $0x20,%esp
+  8017d0:	85 c0                	test   %eax,%eax
+  8017d2:	0f 89 e5 fe ff ff    	jns    8016bd <fork+0x1f4>
+			panic("page_map %d", r);
+  8017d8:	50                   	push   %eax
+  8017d9:	68 86 59 80 00       	push   $0x805986
+  8017de:	6a 7f                	push   $0x7f
+  8017e0:	68 6b 59 80 00       	push   $0x80596b
+  8017e5:	e8 43 ea ff ff       	call   80022d <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  8017ea:	83 c7 01             	add    $0x1,%edi
+  8017ed:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017f0:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  8017f3:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  8017f6:	39 f7                	cmp    %esi,%edi
+  8017f8:	74 1c                	je     801816 <fork+0x34d>
+  8017fa:	89 d8                	mov    %ebx,%eax
+  8017fc:	e8 c5 fb ff ff       	call   8013c6 <dupable>
+  801801:	84 c0                	test   %al,%al
+  801803:	74 7c                	je     801881 <fork+0x3b8>
+  801805:	89 d8                	mov    %ebx,%eax
+  801807:	e8 71 fb ff ff       	call   80137d <dupperm>
+  80180c:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  80180f:	74 d9                	je     8017ea <fork+0x321>
+  801811:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801814:	eb 06                	jmp    80181c <fork+0x353>
+  801816:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801819:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  80181c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80181f:	c1 e0 0c             	shl    $0xc,%eax
+  801822:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801825:	83 ec 08             	sub    $0x8,%esp
+  801828:	ff 75 dc             	push   -0x24(%ebp)
+  80182b:	57                   	push   %edi
+  80182c:	50                   	push   %eax
+  80182d:	ff 75 e4             	push   -0x1c(%ebp)
+  801830:	50                   	push   %eax
+  801831:	6a 00                	push   $0x0
+  801833:	e8 24 2c 00 00       	call   80445c <page_map_range>
+  801838:	83 c4 20             	add    $0x20,%esp
+  80183b:	85 c0                	test   %eax,%eax
+  80183d:	78 47                	js     801886 <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  80183f:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801846:	0f 84 41 fd ff ff    	je     80158d <fork+0xc4>
+  80184c:	83 ec 08             	sub    $0x8,%esp
+  80184f:	ff 75 dc             	push   -0x24(%ebp)
+  801852:	57                   	push   %edi
+  801853:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801856:	50                   	push   %eax
+  801857:	6a 00                	push   $0x0
+  801859:	50                   	push   %eax
+  80185a:	6a 00                	push   $0x0
+  80185c:	e8 fb 2b 00 00       	call   80445c <page_map_range>
+  801861:	83 c4 20             	add    $0x20,%esp
+  801864:	85 c0                	test   %eax,%eax
+  801866:	0f 89 21 fd ff ff    	jns    80158d <fork+0xc4>
+		panic("page_map_range %e", r);
+  80186c:	50                   	push   %eax
+  80186d:	68 ad 59 80 00       	push   $0x8059ad
+  801872:	68 a2 00 00 00       	push   $0xa2
+  801877:	68 6b 59 80 00       	push   $0x80596b
+  80187c:	e8 ac e9 ff ff       	call   80022d <_panic>
+  801881:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801884:	eb 96                	jmp    80181c <fork+0x353>
+		panic("page_map_range %e", r);
+  801886:	50                   	push   %eax
+  801887:	68 ad 59 80 00       	push   $0x8059ad
+  80188c:	68 a0 00 00 00       	push   $0xa0
+  801891:	68 6b 59 80 00       	push   $0x80596b
+  801896:	e8 92 e9 ff ff       	call   80022d <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  80189b:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  80189e:	6a 01                	push   $0x1
+  8018a0:	6a 07                	push   $0x7
+  8018a2:	68 00 f0 bf ee       	push   $0xeebff000
+  8018a7:	53                   	push   %ebx
+  8018a8:	e8 57 23 00 00       	call   803c04 <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8018ad:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  8018b2:	8b 40 74             	mov    0x74(%eax),%eax
+  8018b5:	83 c4 08             	add    $0x8,%esp
+  8018b8:	50                   	push   %eax
+  8018b9:	53                   	push   %ebx
+  8018ba:	e8 89 f8 ff ff       	call   801148 <sys_env_set_pgfault_upcall>
+  8018bf:	83 c4 10             	add    $0x10,%esp
+  8018c2:	e9 41 fc ff ff       	jmp    801508 <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8018c7:	e8 d8 f4 ff ff       	call   800da4 <sys_getenvid>
+  8018cc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018d1:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8018d4:	c1 e0 06             	shl    $0x6,%eax
+  8018d7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8018dc:	a3 24 fd 80 00       	mov    %eax,0x80fd24
+		return 0;
+  8018e1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8018e8:	e9 40 fc ff ff       	jmp    80152d <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  8018ed:	50                   	push   %eax
+  8018ee:	68 bf 59 80 00       	push   $0x8059bf
+  8018f3:	68 27 01 00 00       	push   $0x127
+  8018f8:	68 6b 59 80 00       	push   $0x80596b
+  8018fd:	e8 2b e9 ff ff       	call   80022d <_panic>
+		panic("sys_env_set_status: %d", r);
+  801902:	50                   	push   %eax
+  801903:	68 d8 59 80 00       	push   $0x8059d8
+  801908:	68 2b 01 00 00       	push   $0x12b
+  80190d:	68 6b 59 80 00       	push   $0x80596b
+  801912:	e8 16 e9 ff ff       	call   80022d <_panic>
+
+00801917 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801917:	55                   	push   %ebp
+  801918:	89 e5                	mov    %esp,%ebp
+  80191a:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80191d:	68 ef 59 80 00       	push   $0x8059ef
+  801922:	68 35 01 00 00       	push   $0x135
+  801927:	68 6b 59 80 00       	push   $0x80596b
+  80192c:	e8 fc e8 ff ff       	call   80022d <_panic>
+
+00801931 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801931:	55                   	push   %ebp
+  801932:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801934:	8b 45 08             	mov    0x8(%ebp),%eax
+  801937:	05 00 00 00 30       	add    $0x30000000,%eax
+  80193c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80193f:	5d                   	pop    %ebp
+  801940:	c3                   	ret
+
+00801941 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801941:	55                   	push   %ebp
+  801942:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801944:	8b 45 08             	mov    0x8(%ebp),%eax
+  801947:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80194c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801951:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801956:	5d                   	pop    %ebp
+  801957:	c3                   	ret
+
+00801958 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801958:	55                   	push   %ebp
+  801959:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  80195b:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801960:	a8 01                	test   $0x1,%al
+  801962:	74 3c                	je     8019a0 <fd_alloc+0x48>
+  801964:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801969:	89 c2                	mov    %eax,%edx
+  80196b:	c1 ea 0c             	shr    $0xc,%edx
+  80196e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801975:	89 c1                	mov    %eax,%ecx
+  801977:	05 00 10 00 00       	add    $0x1000,%eax
+  80197c:	f6 c2 01             	test   $0x1,%dl
+  80197f:	74 13                	je     801994 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801981:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801986:	75 e1                	jne    801969 <fd_alloc+0x11>
+  801988:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80198d:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801992:	eb 05                	jmp    801999 <fd_alloc+0x41>
+			return 0;
+  801994:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801999:	8b 55 08             	mov    0x8(%ebp),%edx
+  80199c:	89 0a                	mov    %ecx,(%edx)
+}
+  80199e:	5d                   	pop    %ebp
+  80199f:	c3                   	ret
+  8019a0:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8019a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019aa:	eb ed                	jmp    801999 <fd_alloc+0x41>
+
+008019ac <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8019ac:	55                   	push   %ebp
+  8019ad:	89 e5                	mov    %esp,%ebp
+  8019af:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8019b2:	83 f8 1f             	cmp    $0x1f,%eax
+  8019b5:	77 30                	ja     8019e7 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8019b7:	c1 e0 0c             	shl    $0xc,%eax
+  8019ba:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8019bf:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8019c5:	f6 c2 01             	test   $0x1,%dl
+  8019c8:	74 24                	je     8019ee <fd_lookup+0x42>
+  8019ca:	89 c2                	mov    %eax,%edx
+  8019cc:	c1 ea 0c             	shr    $0xc,%edx
+  8019cf:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019d6:	f6 c2 01             	test   $0x1,%dl
+  8019d9:	74 1a                	je     8019f5 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8019db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019de:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8019e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019e5:	5d                   	pop    %ebp
+  8019e6:	c3                   	ret
+		return -E_INVAL;
+  8019e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019ec:	eb f7                	jmp    8019e5 <fd_lookup+0x39>
+		return -E_INVAL;
+  8019ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019f3:	eb f0                	jmp    8019e5 <fd_lookup+0x39>
+  8019f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019fa:	eb e9                	jmp    8019e5 <fd_lookup+0x39>
+
+008019fc <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8019fc:	55                   	push   %ebp
+  8019fd:	89 e5                	mov    %esp,%ebp
+  8019ff:	53                   	push   %ebx
+  801a00:	83 ec 04             	sub    $0x4,%esp
+  801a03:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801a06:	b8 84 5a 80 00       	mov    $0x805a84,%eax
+  801a0b:	8b 18                	mov    (%eax),%ebx
+  801a0d:	85 db                	test   %ebx,%ebx
+  801a0f:	74 0e                	je     801a1f <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801a11:	83 c0 04             	add    $0x4,%eax
+  801a14:	39 13                	cmp    %edx,(%ebx)
+  801a16:	75 f3                	jne    801a0b <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801a18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1d:	eb 1f                	jmp    801a3e <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a1f:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  801a24:	8b 40 48             	mov    0x48(%eax),%eax
+  801a27:	83 ec 04             	sub    $0x4,%esp
+  801a2a:	52                   	push   %edx
+  801a2b:	50                   	push   %eax
+  801a2c:	68 08 5a 80 00       	push   $0x805a08
+  801a31:	e8 d2 e8 ff ff       	call   800308 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801a36:	83 c4 10             	add    $0x10,%esp
+  801a39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801a3e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a41:	89 1a                	mov    %ebx,(%edx)
+}
+  801a43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a46:	c9                   	leave
+  801a47:	c3                   	ret
+
+00801a48 <fd_close>:
+{
+  801a48:	55                   	push   %ebp
+  801a49:	89 e5                	mov    %esp,%ebp
+  801a4b:	57                   	push   %edi
+  801a4c:	56                   	push   %esi
+  801a4d:	53                   	push   %ebx
+  801a4e:	83 ec 24             	sub    $0x24,%esp
+  801a51:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a54:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a57:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a5a:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a5b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a61:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a64:	50                   	push   %eax
+  801a65:	e8 42 ff ff ff       	call   8019ac <fd_lookup>
+  801a6a:	89 c3                	mov    %eax,%ebx
+  801a6c:	83 c4 10             	add    $0x10,%esp
+  801a6f:	85 c0                	test   %eax,%eax
+  801a71:	78 05                	js     801a78 <fd_close+0x30>
+	    || fd != fd2)
+  801a73:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a76:	74 16                	je     801a8e <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801a78:	89 f8                	mov    %edi,%eax
+  801a7a:	84 c0                	test   %al,%al
+  801a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a81:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a84:	89 d8                	mov    %ebx,%eax
+  801a86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a89:	5b                   	pop    %ebx
+  801a8a:	5e                   	pop    %esi
+  801a8b:	5f                   	pop    %edi
+  801a8c:	5d                   	pop    %ebp
+  801a8d:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a8e:	83 ec 08             	sub    $0x8,%esp
+  801a91:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a94:	50                   	push   %eax
+  801a95:	ff 36                	push   (%esi)
+  801a97:	e8 60 ff ff ff       	call   8019fc <dev_lookup>
+  801a9c:	89 c3                	mov    %eax,%ebx
+  801a9e:	83 c4 10             	add    $0x10,%esp
+  801aa1:	85 c0                	test   %eax,%eax
+  801aa3:	78 1a                	js     801abf <fd_close+0x77>
+		if (dev->dev_close)
+  801aa5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801aa8:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801aab:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801ab0:	85 c0                	test   %eax,%eax
+  801ab2:	74 0b                	je     801abf <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801ab4:	83 ec 0c             	sub    $0xc,%esp
+  801ab7:	56                   	push   %esi
+  801ab8:	ff d0                	call   *%eax
+  801aba:	89 c3                	mov    %eax,%ebx
+  801abc:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801abf:	83 ec 08             	sub    $0x8,%esp
+  801ac2:	56                   	push   %esi
+  801ac3:	6a 00                	push   $0x0
+  801ac5:	e8 9d f3 ff ff       	call   800e67 <sys_page_unmap>
+	return r;
+  801aca:	83 c4 10             	add    $0x10,%esp
+  801acd:	eb b5                	jmp    801a84 <fd_close+0x3c>
+
+00801acf <close>:
+
+int
+close(int fdnum)
+{
+  801acf:	55                   	push   %ebp
+  801ad0:	89 e5                	mov    %esp,%ebp
+  801ad2:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ad5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad8:	50                   	push   %eax
+  801ad9:	ff 75 08             	push   0x8(%ebp)
+  801adc:	e8 cb fe ff ff       	call   8019ac <fd_lookup>
+  801ae1:	83 c4 10             	add    $0x10,%esp
+  801ae4:	85 c0                	test   %eax,%eax
+  801ae6:	79 02                	jns    801aea <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801ae8:	c9                   	leave
+  801ae9:	c3                   	ret
+		return fd_close(fd, 1);
+  801aea:	83 ec 08             	sub    $0x8,%esp
+  801aed:	6a 01                	push   $0x1
+  801aef:	ff 75 f4             	push   -0xc(%ebp)
+  801af2:	e8 51 ff ff ff       	call   801a48 <fd_close>
+  801af7:	83 c4 10             	add    $0x10,%esp
+  801afa:	eb ec                	jmp    801ae8 <close+0x19>
+
+00801afc <close_all>:
+
+void
+close_all(void)
+{
+  801afc:	55                   	push   %ebp
+  801afd:	89 e5                	mov    %esp,%ebp
+  801aff:	53                   	push   %ebx
+  801b00:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801b03:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801b08:	83 ec 0c             	sub    $0xc,%esp
+  801b0b:	53                   	push   %ebx
+  801b0c:	e8 be ff ff ff       	call   801acf <close>
+	for (i = 0; i < MAXFD; i++)
+  801b11:	83 c3 01             	add    $0x1,%ebx
+  801b14:	83 c4 10             	add    $0x10,%esp
+  801b17:	83 fb 20             	cmp    $0x20,%ebx
+  801b1a:	75 ec                	jne    801b08 <close_all+0xc>
+}
+  801b1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b1f:	c9                   	leave
+  801b20:	c3                   	ret
+
+00801b21 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801b21:	55                   	push   %ebp
+  801b22:	89 e5                	mov    %esp,%ebp
+  801b24:	57                   	push   %edi
+  801b25:	56                   	push   %esi
+  801b26:	53                   	push   %ebx
+  801b27:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801b2a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b2d:	50                   	push   %eax
+  801b2e:	ff 75 08             	push   0x8(%ebp)
+  801b31:	e8 76 fe ff ff       	call   8019ac <fd_lookup>
+  801b36:	89 c3                	mov    %eax,%ebx
+  801b38:	83 c4 10             	add    $0x10,%esp
+  801b3b:	85 c0                	test   %eax,%eax
+  801b3d:	78 7f                	js     801bbe <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801b3f:	83 ec 0c             	sub    $0xc,%esp
+  801b42:	ff 75 0c             	push   0xc(%ebp)
+  801b45:	e8 85 ff ff ff       	call   801acf <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801b4a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b4d:	c1 e6 0c             	shl    $0xc,%esi
+  801b50:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801b56:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b59:	89 3c 24             	mov    %edi,(%esp)
+  801b5c:	e8 e0 fd ff ff       	call   801941 <fd2data>
+  801b61:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801b63:	89 34 24             	mov    %esi,(%esp)
+  801b66:	e8 d6 fd ff ff       	call   801941 <fd2data>
+  801b6b:	83 c4 10             	add    $0x10,%esp
+  801b6e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801b71:	89 d8                	mov    %ebx,%eax
+  801b73:	c1 e8 16             	shr    $0x16,%eax
+  801b76:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b7d:	a8 01                	test   $0x1,%al
+  801b7f:	74 11                	je     801b92 <dup+0x71>
+  801b81:	89 d8                	mov    %ebx,%eax
+  801b83:	c1 e8 0c             	shr    $0xc,%eax
+  801b86:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b8d:	f6 c2 01             	test   $0x1,%dl
+  801b90:	75 36                	jne    801bc8 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b92:	89 f8                	mov    %edi,%eax
+  801b94:	c1 e8 0c             	shr    $0xc,%eax
+  801b97:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b9e:	83 ec 0c             	sub    $0xc,%esp
+  801ba1:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ba6:	50                   	push   %eax
+  801ba7:	56                   	push   %esi
+  801ba8:	6a 00                	push   $0x0
+  801baa:	57                   	push   %edi
+  801bab:	6a 00                	push   $0x0
+  801bad:	e8 73 f2 ff ff       	call   800e25 <sys_page_map>
+  801bb2:	89 c3                	mov    %eax,%ebx
+  801bb4:	83 c4 20             	add    $0x20,%esp
+  801bb7:	85 c0                	test   %eax,%eax
+  801bb9:	78 33                	js     801bee <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801bbb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801bbe:	89 d8                	mov    %ebx,%eax
+  801bc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bc3:	5b                   	pop    %ebx
+  801bc4:	5e                   	pop    %esi
+  801bc5:	5f                   	pop    %edi
+  801bc6:	5d                   	pop    %ebp
+  801bc7:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801bc8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801bcf:	83 ec 0c             	sub    $0xc,%esp
+  801bd2:	25 07 0e 00 00       	and    $0xe07,%eax
+  801bd7:	50                   	push   %eax
+  801bd8:	ff 75 d4             	push   -0x2c(%ebp)
+  801bdb:	6a 00                	push   $0x0
+  801bdd:	53                   	push   %ebx
+  801bde:	6a 00                	push   $0x0
+  801be0:	e8 40 f2 ff ff       	call   800e25 <sys_page_map>
+  801be5:	89 c3                	mov    %eax,%ebx
+  801be7:	83 c4 20             	add    $0x20,%esp
+  801bea:	85 c0                	test   %eax,%eax
+  801bec:	79 a4                	jns    801b92 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801bee:	83 ec 08             	sub    $0x8,%esp
+  801bf1:	56                   	push   %esi
+  801bf2:	6a 00                	push   $0x0
+  801bf4:	e8 6e f2 ff ff       	call   800e67 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801bf9:	83 c4 08             	add    $0x8,%esp
+  801bfc:	ff 75 d4             	push   -0x2c(%ebp)
+  801bff:	6a 00                	push   $0x0
+  801c01:	e8 61 f2 ff ff       	call   800e67 <sys_page_unmap>
+	return r;
+  801c06:	83 c4 10             	add    $0x10,%esp
+  801c09:	eb b3                	jmp    801bbe <dup+0x9d>
+
+00801c0b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801c0b:	55                   	push   %ebp
+  801c0c:	89 e5                	mov    %esp,%ebp
+  801c0e:	56                   	push   %esi
+  801c0f:	53                   	push   %ebx
+  801c10:	83 ec 18             	sub    $0x18,%esp
+  801c13:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c16:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c19:	50                   	push   %eax
+  801c1a:	56                   	push   %esi
+  801c1b:	e8 8c fd ff ff       	call   8019ac <fd_lookup>
+  801c20:	83 c4 10             	add    $0x10,%esp
+  801c23:	85 c0                	test   %eax,%eax
+  801c25:	78 3c                	js     801c63 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c27:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801c2a:	83 ec 08             	sub    $0x8,%esp
+  801c2d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c30:	50                   	push   %eax
+  801c31:	ff 33                	push   (%ebx)
+  801c33:	e8 c4 fd ff ff       	call   8019fc <dev_lookup>
+  801c38:	83 c4 10             	add    $0x10,%esp
+  801c3b:	85 c0                	test   %eax,%eax
+  801c3d:	78 24                	js     801c63 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c3f:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c42:	83 e0 03             	and    $0x3,%eax
+  801c45:	83 f8 01             	cmp    $0x1,%eax
+  801c48:	74 20                	je     801c6a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801c4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c4d:	8b 40 08             	mov    0x8(%eax),%eax
+  801c50:	85 c0                	test   %eax,%eax
+  801c52:	74 37                	je     801c8b <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801c54:	83 ec 04             	sub    $0x4,%esp
+  801c57:	ff 75 10             	push   0x10(%ebp)
+  801c5a:	ff 75 0c             	push   0xc(%ebp)
+  801c5d:	53                   	push   %ebx
+  801c5e:	ff d0                	call   *%eax
+  801c60:	83 c4 10             	add    $0x10,%esp
+}
+  801c63:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c66:	5b                   	pop    %ebx
+  801c67:	5e                   	pop    %esi
+  801c68:	5d                   	pop    %ebp
+  801c69:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c6a:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  801c6f:	8b 40 48             	mov    0x48(%eax),%eax
+  801c72:	83 ec 04             	sub    $0x4,%esp
+  801c75:	56                   	push   %esi
+  801c76:	50                   	push   %eax
+  801c77:	68 49 5a 80 00       	push   $0x805a49
+  801c7c:	e8 87 e6 ff ff       	call   800308 <cprintf>
+		return -E_INVAL;
+  801c81:	83 c4 10             	add    $0x10,%esp
+  801c84:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c89:	eb d8                	jmp    801c63 <read+0x58>
+		return -E_NOT_SUPP;
+  801c8b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c90:	eb d1                	jmp    801c63 <read+0x58>
+
+00801c92 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c92:	55                   	push   %ebp
+  801c93:	89 e5                	mov    %esp,%ebp
+  801c95:	57                   	push   %edi
+  801c96:	56                   	push   %esi
+  801c97:	53                   	push   %ebx
+  801c98:	83 ec 0c             	sub    $0xc,%esp
+  801c9b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c9e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801ca1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ca6:	eb 02                	jmp    801caa <readn+0x18>
+  801ca8:	01 c3                	add    %eax,%ebx
+  801caa:	39 f3                	cmp    %esi,%ebx
+  801cac:	73 21                	jae    801ccf <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801cae:	83 ec 04             	sub    $0x4,%esp
+  801cb1:	89 f0                	mov    %esi,%eax
+  801cb3:	29 d8                	sub    %ebx,%eax
+  801cb5:	50                   	push   %eax
+  801cb6:	89 d8                	mov    %ebx,%eax
+  801cb8:	03 45 0c             	add    0xc(%ebp),%eax
+  801cbb:	50                   	push   %eax
+  801cbc:	57                   	push   %edi
+  801cbd:	e8 49 ff ff ff       	call   801c0b <read>
+		if (m < 0)
+  801cc2:	83 c4 10             	add    $0x10,%esp
+  801cc5:	85 c0                	test   %eax,%eax
+  801cc7:	78 04                	js     801ccd <readn+0x3b>
+			return m;
+		if (m == 0)
+  801cc9:	75 dd                	jne    801ca8 <readn+0x16>
+  801ccb:	eb 02                	jmp    801ccf <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801ccd:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801ccf:	89 d8                	mov    %ebx,%eax
+  801cd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cd4:	5b                   	pop    %ebx
+  801cd5:	5e                   	pop    %esi
+  801cd6:	5f                   	pop    %edi
+  801cd7:	5d                   	pop    %ebp
+  801cd8:	c3                   	ret
+
+00801cd9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801cd9:	55                   	push   %ebp
+  801cda:	89 e5                	mov    %esp,%ebp
+  801cdc:	56                   	push   %esi
+  801cdd:	53                   	push   %ebx
+  801cde:	83 ec 18             	sub    $0x18,%esp
+  801ce1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ce4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ce7:	50                   	push   %eax
+  801ce8:	53                   	push   %ebx
+  801ce9:	e8 be fc ff ff       	call   8019ac <fd_lookup>
+  801cee:	83 c4 10             	add    $0x10,%esp
+  801cf1:	85 c0                	test   %eax,%eax
+  801cf3:	78 37                	js     801d2c <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cf5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cf8:	83 ec 08             	sub    $0x8,%esp
+  801cfb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cfe:	50                   	push   %eax
+  801cff:	ff 36                	push   (%esi)
+  801d01:	e8 f6 fc ff ff       	call   8019fc <dev_lookup>
+  801d06:	83 c4 10             	add    $0x10,%esp
+  801d09:	85 c0                	test   %eax,%eax
+  801d0b:	78 1f                	js     801d2c <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d0d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d11:	74 20                	je     801d33 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801d13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d16:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d19:	85 c0                	test   %eax,%eax
+  801d1b:	74 37                	je     801d54 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801d1d:	83 ec 04             	sub    $0x4,%esp
+  801d20:	ff 75 10             	push   0x10(%ebp)
+  801d23:	ff 75 0c             	push   0xc(%ebp)
+  801d26:	56                   	push   %esi
+  801d27:	ff d0                	call   *%eax
+  801d29:	83 c4 10             	add    $0x10,%esp
+}
+  801d2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d2f:	5b                   	pop    %ebx
+  801d30:	5e                   	pop    %esi
+  801d31:	5d                   	pop    %ebp
+  801d32:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d33:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  801d38:	8b 40 48             	mov    0x48(%eax),%eax
+  801d3b:	83 ec 04             	sub    $0x4,%esp
+  801d3e:	53                   	push   %ebx
+  801d3f:	50                   	push   %eax
+  801d40:	68 65 5a 80 00       	push   $0x805a65
+  801d45:	e8 be e5 ff ff       	call   800308 <cprintf>
+		return -E_INVAL;
+  801d4a:	83 c4 10             	add    $0x10,%esp
+  801d4d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d52:	eb d8                	jmp    801d2c <write+0x53>
+		return -E_NOT_SUPP;
+  801d54:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d59:	eb d1                	jmp    801d2c <write+0x53>
+
+00801d5b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d5b:	55                   	push   %ebp
+  801d5c:	89 e5                	mov    %esp,%ebp
+  801d5e:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d61:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d64:	50                   	push   %eax
+  801d65:	ff 75 08             	push   0x8(%ebp)
+  801d68:	e8 3f fc ff ff       	call   8019ac <fd_lookup>
+  801d6d:	83 c4 10             	add    $0x10,%esp
+  801d70:	85 c0                	test   %eax,%eax
+  801d72:	78 0e                	js     801d82 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d74:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d7a:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d7d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d82:	c9                   	leave
+  801d83:	c3                   	ret
+
+00801d84 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d84:	55                   	push   %ebp
+  801d85:	89 e5                	mov    %esp,%ebp
+  801d87:	56                   	push   %esi
+  801d88:	53                   	push   %ebx
+  801d89:	83 ec 18             	sub    $0x18,%esp
+  801d8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d8f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d92:	50                   	push   %eax
+  801d93:	53                   	push   %ebx
+  801d94:	e8 13 fc ff ff       	call   8019ac <fd_lookup>
+  801d99:	83 c4 10             	add    $0x10,%esp
+  801d9c:	85 c0                	test   %eax,%eax
+  801d9e:	78 34                	js     801dd4 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801da0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801da3:	83 ec 08             	sub    $0x8,%esp
+  801da6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801da9:	50                   	push   %eax
+  801daa:	ff 36                	push   (%esi)
+  801dac:	e8 4b fc ff ff       	call   8019fc <dev_lookup>
+  801db1:	83 c4 10             	add    $0x10,%esp
+  801db4:	85 c0                	test   %eax,%eax
+  801db6:	78 1c                	js     801dd4 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801db8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801dbc:	74 1d                	je     801ddb <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801dbe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc1:	8b 40 18             	mov    0x18(%eax),%eax
+  801dc4:	85 c0                	test   %eax,%eax
+  801dc6:	74 34                	je     801dfc <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801dc8:	83 ec 08             	sub    $0x8,%esp
+  801dcb:	ff 75 0c             	push   0xc(%ebp)
+  801dce:	56                   	push   %esi
+  801dcf:	ff d0                	call   *%eax
+  801dd1:	83 c4 10             	add    $0x10,%esp
+}
+  801dd4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dd7:	5b                   	pop    %ebx
+  801dd8:	5e                   	pop    %esi
+  801dd9:	5d                   	pop    %ebp
+  801dda:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801ddb:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  801de0:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801de3:	83 ec 04             	sub    $0x4,%esp
+  801de6:	53                   	push   %ebx
+  801de7:	50                   	push   %eax
+  801de8:	68 28 5a 80 00       	push   $0x805a28
+  801ded:	e8 16 e5 ff ff       	call   800308 <cprintf>
+		return -E_INVAL;
+  801df2:	83 c4 10             	add    $0x10,%esp
+  801df5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dfa:	eb d8                	jmp    801dd4 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801dfc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e01:	eb d1                	jmp    801dd4 <ftruncate+0x50>
+
+00801e03 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801e03:	55                   	push   %ebp
+  801e04:	89 e5                	mov    %esp,%ebp
+  801e06:	56                   	push   %esi
+  801e07:	53                   	push   %ebx
+  801e08:	83 ec 18             	sub    $0x18,%esp
+  801e0b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e0e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e11:	50                   	push   %eax
+  801e12:	ff 75 08             	push   0x8(%ebp)
+  801e15:	e8 92 fb ff ff       	call   8019ac <fd_lookup>
+  801e1a:	83 c4 10             	add    $0x10,%esp
+  801e1d:	85 c0                	test   %eax,%eax
+  801e1f:	78 49                	js     801e6a <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e21:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e24:	83 ec 08             	sub    $0x8,%esp
+  801e27:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e2a:	50                   	push   %eax
+  801e2b:	ff 36                	push   (%esi)
+  801e2d:	e8 ca fb ff ff       	call   8019fc <dev_lookup>
+  801e32:	83 c4 10             	add    $0x10,%esp
+  801e35:	85 c0                	test   %eax,%eax
+  801e37:	78 31                	js     801e6a <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e3c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e40:	74 2f                	je     801e71 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e42:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e45:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e4c:	00 00 00 
+	stat->st_isdir = 0;
+  801e4f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e56:	00 00 00 
+	stat->st_dev = dev;
+  801e59:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e5f:	83 ec 08             	sub    $0x8,%esp
+  801e62:	53                   	push   %ebx
+  801e63:	56                   	push   %esi
+  801e64:	ff 50 14             	call   *0x14(%eax)
+  801e67:	83 c4 10             	add    $0x10,%esp
+}
+  801e6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e6d:	5b                   	pop    %ebx
+  801e6e:	5e                   	pop    %esi
+  801e6f:	5d                   	pop    %ebp
+  801e70:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e71:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e76:	eb f2                	jmp    801e6a <fstat+0x67>
+
+00801e78 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e78:	55                   	push   %ebp
+  801e79:	89 e5                	mov    %esp,%ebp
+  801e7b:	56                   	push   %esi
+  801e7c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e7d:	83 ec 08             	sub    $0x8,%esp
+  801e80:	6a 00                	push   $0x0
+  801e82:	ff 75 08             	push   0x8(%ebp)
+  801e85:	e8 bc 02 00 00       	call   802146 <open>
+  801e8a:	89 c3                	mov    %eax,%ebx
+  801e8c:	83 c4 10             	add    $0x10,%esp
+  801e8f:	85 c0                	test   %eax,%eax
+  801e91:	78 1b                	js     801eae <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e93:	83 ec 08             	sub    $0x8,%esp
+  801e96:	ff 75 0c             	push   0xc(%ebp)
+  801e99:	50                   	push   %eax
+  801e9a:	e8 64 ff ff ff       	call   801e03 <fstat>
+  801e9f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801ea1:	89 1c 24             	mov    %ebx,(%esp)
+  801ea4:	e8 26 fc ff ff       	call   801acf <close>
+	return r;
+  801ea9:	83 c4 10             	add    $0x10,%esp
+  801eac:	89 f3                	mov    %esi,%ebx
+}
+  801eae:	89 d8                	mov    %ebx,%eax
+  801eb0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb3:	5b                   	pop    %ebx
+  801eb4:	5e                   	pop    %esi
+  801eb5:	5d                   	pop    %ebp
+  801eb6:	c3                   	ret
+
+00801eb7 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801eb7:	55                   	push   %ebp
+  801eb8:	89 e5                	mov    %esp,%ebp
+  801eba:	57                   	push   %edi
+  801ebb:	56                   	push   %esi
+  801ebc:	53                   	push   %ebx
+  801ebd:	83 ec 0c             	sub    $0xc,%esp
+  801ec0:	89 c7                	mov    %eax,%edi
+  801ec2:	89 d3                	mov    %edx,%ebx
+  801ec4:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801ec6:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  801ecd:	74 2d                	je     801efc <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ecf:	6a 07                	push   $0x7
+  801ed1:	68 00 00 81 00       	push   $0x810000
+  801ed6:	57                   	push   %edi
+  801ed7:	ff 35 00 80 80 00    	push   0x808000
+  801edd:	e8 ba 31 00 00       	call   80509c <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801ee2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801ee9:	6a 00                	push   $0x0
+  801eeb:	56                   	push   %esi
+  801eec:	53                   	push   %ebx
+  801eed:	6a 00                	push   $0x0
+  801eef:	e8 5a 30 00 00       	call   804f4e <ipc_recv_pages>
+}
+  801ef4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ef7:	5b                   	pop    %ebx
+  801ef8:	5e                   	pop    %esi
+  801ef9:	5f                   	pop    %edi
+  801efa:	5d                   	pop    %ebp
+  801efb:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801efc:	83 ec 0c             	sub    $0xc,%esp
+  801eff:	6a 01                	push   $0x1
+  801f01:	e8 8b 32 00 00       	call   805191 <ipc_find_env>
+  801f06:	a3 00 80 80 00       	mov    %eax,0x808000
+  801f0b:	83 c4 10             	add    $0x10,%esp
+  801f0e:	eb bf                	jmp    801ecf <fsipc_pages+0x18>
+
+00801f10 <fsipc>:
+{
+  801f10:	55                   	push   %ebp
+  801f11:	89 e5                	mov    %esp,%ebp
+  801f13:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801f16:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f1b:	e8 97 ff ff ff       	call   801eb7 <fsipc_pages>
+}
+  801f20:	c9                   	leave
+  801f21:	c3                   	ret
+
+00801f22 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801f22:	55                   	push   %ebp
+  801f23:	89 e5                	mov    %esp,%ebp
+  801f25:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f28:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f2e:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.set_size.req_size = newsize;
+  801f33:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f36:	a3 04 00 81 00       	mov    %eax,0x810004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801f3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f40:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f45:	e8 c6 ff ff ff       	call   801f10 <fsipc>
+}
+  801f4a:	c9                   	leave
+  801f4b:	c3                   	ret
+
+00801f4c <devfile_flush>:
+{
+  801f4c:	55                   	push   %ebp
+  801f4d:	89 e5                	mov    %esp,%ebp
+  801f4f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f52:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f55:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f58:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801f5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f62:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f67:	e8 a4 ff ff ff       	call   801f10 <fsipc>
+}
+  801f6c:	c9                   	leave
+  801f6d:	c3                   	ret
+
+00801f6e <devfile_stat>:
+{
+  801f6e:	55                   	push   %ebp
+  801f6f:	89 e5                	mov    %esp,%ebp
+  801f71:	53                   	push   %ebx
+  801f72:	83 ec 04             	sub    $0x4,%esp
+  801f75:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f78:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f7b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f7e:	a3 00 00 81 00       	mov    %eax,0x810000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f83:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f88:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f8d:	e8 7e ff ff ff       	call   801f10 <fsipc>
+  801f92:	85 c0                	test   %eax,%eax
+  801f94:	78 2c                	js     801fc2 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f96:	83 ec 08             	sub    $0x8,%esp
+  801f99:	68 00 00 81 00       	push   $0x810000
+  801f9e:	53                   	push   %ebx
+  801f9f:	e8 4b e9 ff ff       	call   8008ef <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801fa4:	a1 80 00 81 00       	mov    0x810080,%eax
+  801fa9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801faf:	a1 84 00 81 00       	mov    0x810084,%eax
+  801fb4:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801fba:	83 c4 10             	add    $0x10,%esp
+  801fbd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fc2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fc5:	c9                   	leave
+  801fc6:	c3                   	ret
+
+00801fc7 <devfile_write>:
+{
+  801fc7:	55                   	push   %ebp
+  801fc8:	89 e5                	mov    %esp,%ebp
+  801fca:	83 ec 0c             	sub    $0xc,%esp
+  801fcd:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801fd0:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801fd5:	39 d0                	cmp    %edx,%eax
+  801fd7:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fda:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fdd:	8b 52 0c             	mov    0xc(%edx),%edx
+  801fe0:	89 15 00 00 81 00    	mov    %edx,0x810000
+	fsipcbuf.write.req_n = n;
+  801fe6:	a3 04 00 81 00       	mov    %eax,0x810004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801feb:	50                   	push   %eax
+  801fec:	ff 75 0c             	push   0xc(%ebp)
+  801fef:	68 08 00 81 00       	push   $0x810008
+  801ff4:	e8 7c ea ff ff       	call   800a75 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801ff9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ffe:	b8 04 00 00 00       	mov    $0x4,%eax
+  802003:	e8 08 ff ff ff       	call   801f10 <fsipc>
+}
+  802008:	c9                   	leave
+  802009:	c3                   	ret
+
+0080200a <devfile_read>:
+{
+  80200a:	55                   	push   %ebp
+  80200b:	89 e5                	mov    %esp,%ebp
+  80200d:	57                   	push   %edi
+  80200e:	56                   	push   %esi
+  80200f:	53                   	push   %ebx
+  802010:	83 ec 1c             	sub    $0x1c,%esp
+  802013:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802016:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802019:	89 fe                	mov    %edi,%esi
+  80201b:	c1 ee 0c             	shr    $0xc,%esi
+  80201e:	b8 20 00 00 00       	mov    $0x20,%eax
+  802023:	39 c6                	cmp    %eax,%esi
+  802025:	0f 47 f0             	cmova  %eax,%esi
+  802028:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80202b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802030:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802033:	eb 14                	jmp    802049 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802035:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  80203c:	05 00 10 00 00       	add    $0x1000,%eax
+  802041:	f6 c6 06             	test   $0x6,%dh
+  802044:	75 42                	jne    802088 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802046:	83 c1 01             	add    $0x1,%ecx
+  802049:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80204c:	39 f1                	cmp    %esi,%ecx
+  80204e:	0f 84 95 00 00 00    	je     8020e9 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  802054:	89 c2                	mov    %eax,%edx
+  802056:	c1 ea 16             	shr    $0x16,%edx
+  802059:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802060:	f6 c2 01             	test   $0x1,%dl
+  802063:	74 23                	je     802088 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  802065:	89 c2                	mov    %eax,%edx
+  802067:	c1 ea 0c             	shr    $0xc,%edx
+  80206a:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  802071:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  802077:	74 0f                	je     802088 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  802079:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  802080:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  802086:	75 ad                	jne    802035 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  802088:	85 c9                	test   %ecx,%ecx
+  80208a:	74 11                	je     80209d <devfile_read+0x93>
+  80208c:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802093:	75 08                	jne    80209d <devfile_read+0x93>
+  802095:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  80209b:	74 50                	je     8020ed <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80209d:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8020a0:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.read.req_n = n;
+  8020a5:	89 3d 04 00 81 00    	mov    %edi,0x810004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8020ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020b0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020b5:	e8 56 fe ff ff       	call   801f10 <fsipc>
+  8020ba:	89 c6                	mov    %eax,%esi
+  8020bc:	85 c0                	test   %eax,%eax
+  8020be:	78 1f                	js     8020df <devfile_read+0xd5>
+	assert(r <= n);
+  8020c0:	39 c7                	cmp    %eax,%edi
+  8020c2:	72 50                	jb     802114 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  8020c4:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8020c9:	7f 62                	jg     80212d <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  8020cb:	83 ec 04             	sub    $0x4,%esp
+  8020ce:	50                   	push   %eax
+  8020cf:	68 00 00 81 00       	push   $0x810000
+  8020d4:	ff 75 0c             	push   0xc(%ebp)
+  8020d7:	e8 99 e9 ff ff       	call   800a75 <memmove>
+	return r;
+  8020dc:	83 c4 10             	add    $0x10,%esp
+}
+  8020df:	89 f0                	mov    %esi,%eax
+  8020e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020e4:	5b                   	pop    %ebx
+  8020e5:	5e                   	pop    %esi
+  8020e6:	5f                   	pop    %edi
+  8020e7:	5d                   	pop    %ebp
+  8020e8:	c3                   	ret
+  8020e9:	89 f1                	mov    %esi,%ecx
+  8020eb:	eb 9b                	jmp    802088 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  8020ed:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8020f0:	a3 00 00 81 00       	mov    %eax,0x810000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  8020f5:	89 c8                	mov    %ecx,%eax
+  8020f7:	c1 e0 0c             	shl    $0xc,%eax
+  8020fa:	a3 04 00 81 00       	mov    %eax,0x810004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  8020ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802102:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802107:	e8 ab fd ff ff       	call   801eb7 <fsipc_pages>
+  80210c:	89 c6                	mov    %eax,%esi
+  80210e:	85 c0                	test   %eax,%eax
+  802110:	78 8b                	js     80209d <devfile_read+0x93>
+  802112:	eb cb                	jmp    8020df <devfile_read+0xd5>
+	assert(r <= n);
+  802114:	68 94 5a 80 00       	push   $0x805a94
+  802119:	68 9b 5a 80 00       	push   $0x805a9b
+  80211e:	68 a0 00 00 00       	push   $0xa0
+  802123:	68 b0 5a 80 00       	push   $0x805ab0
+  802128:	e8 00 e1 ff ff       	call   80022d <_panic>
+	assert(r <= PGSIZE);
+  80212d:	68 bb 5a 80 00       	push   $0x805abb
+  802132:	68 9b 5a 80 00       	push   $0x805a9b
+  802137:	68 a1 00 00 00       	push   $0xa1
+  80213c:	68 b0 5a 80 00       	push   $0x805ab0
+  802141:	e8 e7 e0 ff ff       	call   80022d <_panic>
+
+00802146 <open>:
+{
+  802146:	55                   	push   %ebp
+  802147:	89 e5                	mov    %esp,%ebp
+  802149:	56                   	push   %esi
+  80214a:	53                   	push   %ebx
+  80214b:	83 ec 1c             	sub    $0x1c,%esp
+  80214e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802151:	56                   	push   %esi
+  802152:	e8 5d e7 ff ff       	call   8008b4 <strlen>
+  802157:	83 c4 10             	add    $0x10,%esp
+  80215a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80215f:	7f 6c                	jg     8021cd <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802161:	83 ec 0c             	sub    $0xc,%esp
+  802164:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802167:	50                   	push   %eax
+  802168:	e8 eb f7 ff ff       	call   801958 <fd_alloc>
+  80216d:	89 c3                	mov    %eax,%ebx
+  80216f:	83 c4 10             	add    $0x10,%esp
+  802172:	85 c0                	test   %eax,%eax
+  802174:	78 3c                	js     8021b2 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802176:	83 ec 08             	sub    $0x8,%esp
+  802179:	56                   	push   %esi
+  80217a:	68 00 00 81 00       	push   $0x810000
+  80217f:	e8 6b e7 ff ff       	call   8008ef <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802184:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802187:	a3 00 04 81 00       	mov    %eax,0x810400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80218c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80218f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802194:	e8 77 fd ff ff       	call   801f10 <fsipc>
+  802199:	89 c3                	mov    %eax,%ebx
+  80219b:	83 c4 10             	add    $0x10,%esp
+  80219e:	85 c0                	test   %eax,%eax
+  8021a0:	78 19                	js     8021bb <open+0x75>
+	return fd2num(fd);
+  8021a2:	83 ec 0c             	sub    $0xc,%esp
+  8021a5:	ff 75 f4             	push   -0xc(%ebp)
+  8021a8:	e8 84 f7 ff ff       	call   801931 <fd2num>
+  8021ad:	89 c3                	mov    %eax,%ebx
+  8021af:	83 c4 10             	add    $0x10,%esp
+}
+  8021b2:	89 d8                	mov    %ebx,%eax
+  8021b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b7:	5b                   	pop    %ebx
+  8021b8:	5e                   	pop    %esi
+  8021b9:	5d                   	pop    %ebp
+  8021ba:	c3                   	ret
+		fd_close(fd, 0);
+  8021bb:	83 ec 08             	sub    $0x8,%esp
+  8021be:	6a 00                	push   $0x0
+  8021c0:	ff 75 f4             	push   -0xc(%ebp)
+  8021c3:	e8 80 f8 ff ff       	call   801a48 <fd_close>
+		return r;
+  8021c8:	83 c4 10             	add    $0x10,%esp
+  8021cb:	eb e5                	jmp    8021b2 <open+0x6c>
+		return -E_BAD_PATH;
+  8021cd:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021d2:	eb de                	jmp    8021b2 <open+0x6c>
+
+008021d4 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8021d4:	55                   	push   %ebp
+  8021d5:	89 e5                	mov    %esp,%ebp
+  8021d7:	53                   	push   %ebx
+  8021d8:	83 ec 10             	sub    $0x10,%esp
+  8021db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8021de:	53                   	push   %ebx
+  8021df:	e8 d0 e6 ff ff       	call   8008b4 <strlen>
+  8021e4:	83 c4 10             	add    $0x10,%esp
+  8021e7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021ec:	7f 25                	jg     802213 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8021ee:	83 ec 08             	sub    $0x8,%esp
+  8021f1:	53                   	push   %ebx
+  8021f2:	68 00 00 81 00       	push   $0x810000
+  8021f7:	e8 f3 e6 ff ff       	call   8008ef <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8021fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802201:	b8 07 00 00 00       	mov    $0x7,%eax
+  802206:	e8 05 fd ff ff       	call   801f10 <fsipc>
+  80220b:	83 c4 10             	add    $0x10,%esp
+}
+  80220e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802211:	c9                   	leave
+  802212:	c3                   	ret
+		return -E_BAD_PATH;
+  802213:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802218:	eb f4                	jmp    80220e <remove+0x3a>
+
+0080221a <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80221a:	55                   	push   %ebp
+  80221b:	89 e5                	mov    %esp,%ebp
+  80221d:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802220:	ba 00 00 00 00       	mov    $0x0,%edx
+  802225:	b8 08 00 00 00       	mov    $0x8,%eax
+  80222a:	e8 e1 fc ff ff       	call   801f10 <fsipc>
+}
+  80222f:	c9                   	leave
+  802230:	c3                   	ret
+
+00802231 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  802231:	55                   	push   %ebp
+  802232:	89 e5                	mov    %esp,%ebp
+  802234:	53                   	push   %ebx
+  802235:	83 ec 04             	sub    $0x4,%esp
+  802238:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  80223b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802240:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802245:	e8 c6 fc ff ff       	call   801f10 <fsipc>
+  80224a:	85 c0                	test   %eax,%eax
+  80224c:	78 3c                	js     80228a <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  80224e:	a1 00 00 81 00       	mov    0x810000,%eax
+  802253:	89 03                	mov    %eax,(%ebx)
+  802255:	a1 04 00 81 00       	mov    0x810004,%eax
+  80225a:	89 43 04             	mov    %eax,0x4(%ebx)
+  80225d:	a1 08 00 81 00       	mov    0x810008,%eax
+  802262:	89 43 08             	mov    %eax,0x8(%ebx)
+  802265:	a1 0c 00 81 00       	mov    0x81000c,%eax
+  80226a:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80226d:	a1 10 00 81 00       	mov    0x810010,%eax
+  802272:	89 43 10             	mov    %eax,0x10(%ebx)
+  802275:	a1 14 00 81 00       	mov    0x810014,%eax
+  80227a:	89 43 14             	mov    %eax,0x14(%ebx)
+  80227d:	a1 18 00 81 00       	mov    0x810018,%eax
+  802282:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  802285:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80228a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80228d:	c9                   	leave
+  80228e:	c3                   	ret
+
+0080228f <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  80228f:	55                   	push   %ebp
+  802290:	89 e5                	mov    %esp,%ebp
+  802292:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  802295:	8b 45 08             	mov    0x8(%ebp),%eax
+  802298:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_BCSET, NULL);
+  80229d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8022a7:	e8 64 fc ff ff       	call   801f10 <fsipc>
+}
+  8022ac:	c9                   	leave
+  8022ad:	c3                   	ret
+
+008022ae <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8022ae:	55                   	push   %ebp
+  8022af:	89 e5                	mov    %esp,%ebp
+  8022b1:	56                   	push   %esi
+  8022b2:	53                   	push   %ebx
+  8022b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8022b6:	83 ec 0c             	sub    $0xc,%esp
+  8022b9:	ff 75 08             	push   0x8(%ebp)
+  8022bc:	e8 80 f6 ff ff       	call   801941 <fd2data>
+  8022c1:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8022c3:	83 c4 08             	add    $0x8,%esp
+  8022c6:	68 c7 5a 80 00       	push   $0x805ac7
+  8022cb:	53                   	push   %ebx
+  8022cc:	e8 1e e6 ff ff       	call   8008ef <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8022d1:	8b 46 04             	mov    0x4(%esi),%eax
+  8022d4:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8022da:	2b 0e                	sub    (%esi),%ecx
+  8022dc:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8022e1:	89 c8                	mov    %ecx,%eax
+  8022e3:	f7 e2                	mul    %edx
+  8022e5:	c1 ea 0c             	shr    $0xc,%edx
+  8022e8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022ee:	29 d1                	sub    %edx,%ecx
+  8022f0:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8022f6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8022fd:	00 00 00 
+	stat->st_dev = &devpipe;
+  802300:	c7 83 88 00 00 00 20 	movl   $0x807020,0x88(%ebx)
+  802307:	70 80 00 
+	return 0;
+}
+  80230a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80230f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802312:	5b                   	pop    %ebx
+  802313:	5e                   	pop    %esi
+  802314:	5d                   	pop    %ebp
+  802315:	c3                   	ret
+
+00802316 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802316:	55                   	push   %ebp
+  802317:	89 e5                	mov    %esp,%ebp
+  802319:	53                   	push   %ebx
+  80231a:	83 ec 0c             	sub    $0xc,%esp
+  80231d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802320:	53                   	push   %ebx
+  802321:	6a 00                	push   $0x0
+  802323:	e8 3f eb ff ff       	call   800e67 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802328:	89 1c 24             	mov    %ebx,(%esp)
+  80232b:	e8 11 f6 ff ff       	call   801941 <fd2data>
+  802330:	83 c4 08             	add    $0x8,%esp
+  802333:	50                   	push   %eax
+  802334:	6a 00                	push   $0x0
+  802336:	e8 2c eb ff ff       	call   800e67 <sys_page_unmap>
+}
+  80233b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80233e:	c9                   	leave
+  80233f:	c3                   	ret
+
+00802340 <_pipeisclosed>:
+{
+  802340:	55                   	push   %ebp
+  802341:	89 e5                	mov    %esp,%ebp
+  802343:	57                   	push   %edi
+  802344:	56                   	push   %esi
+  802345:	53                   	push   %ebx
+  802346:	83 ec 1c             	sub    $0x1c,%esp
+  802349:	89 c7                	mov    %eax,%edi
+  80234b:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80234d:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  802352:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802355:	83 ec 0c             	sub    $0xc,%esp
+  802358:	57                   	push   %edi
+  802359:	e8 72 2e 00 00       	call   8051d0 <pageref>
+  80235e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802361:	89 34 24             	mov    %esi,(%esp)
+  802364:	e8 67 2e 00 00       	call   8051d0 <pageref>
+		nn = thisenv->env_runs;
+  802369:	8b 15 24 fd 80 00    	mov    0x80fd24,%edx
+  80236f:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802372:	83 c4 10             	add    $0x10,%esp
+  802375:	39 cb                	cmp    %ecx,%ebx
+  802377:	74 1b                	je     802394 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802379:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80237c:	75 cf                	jne    80234d <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80237e:	8b 42 58             	mov    0x58(%edx),%eax
+  802381:	6a 01                	push   $0x1
+  802383:	50                   	push   %eax
+  802384:	53                   	push   %ebx
+  802385:	68 ce 5a 80 00       	push   $0x805ace
+  80238a:	e8 79 df ff ff       	call   800308 <cprintf>
+  80238f:	83 c4 10             	add    $0x10,%esp
+  802392:	eb b9                	jmp    80234d <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802394:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802397:	0f 94 c0             	sete   %al
+  80239a:	0f b6 c0             	movzbl %al,%eax
+}
+  80239d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023a0:	5b                   	pop    %ebx
+  8023a1:	5e                   	pop    %esi
+  8023a2:	5f                   	pop    %edi
+  8023a3:	5d                   	pop    %ebp
+  8023a4:	c3                   	ret
+
+008023a5 <devpipe_read>:
+{
+  8023a5:	55                   	push   %ebp
+  8023a6:	89 e5                	mov    %esp,%ebp
+  8023a8:	57                   	push   %edi
+  8023a9:	56                   	push   %esi
+  8023aa:	53                   	push   %ebx
+  8023ab:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8023ae:	ff 75 08             	push   0x8(%ebp)
+  8023b1:	e8 8b f5 ff ff       	call   801941 <fd2data>
+  8023b6:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8023b8:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8023bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8023be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8023c1:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8023c4:	8b 0b                	mov    (%ebx),%ecx
+  8023c6:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8023cc:	29 ce                	sub    %ecx,%esi
+  8023ce:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8023d3:	f7 e6                	mul    %esi
+  8023d5:	c1 ea 0c             	shr    $0xc,%edx
+  8023d8:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8023de:	29 c6                	sub    %eax,%esi
+  8023e0:	89 f2                	mov    %esi,%edx
+  8023e2:	75 43                	jne    802427 <devpipe_read+0x82>
+		ref = pageref(p);
+  8023e4:	83 ec 0c             	sub    $0xc,%esp
+  8023e7:	53                   	push   %ebx
+  8023e8:	e8 e3 2d 00 00       	call   8051d0 <pageref>
+  8023ed:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8023ef:	89 da                	mov    %ebx,%edx
+  8023f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f4:	e8 47 ff ff ff       	call   802340 <_pipeisclosed>
+  8023f9:	83 c4 10             	add    $0x10,%esp
+  8023fc:	85 c0                	test   %eax,%eax
+  8023fe:	0f 85 c1 00 00 00    	jne    8024c5 <devpipe_read+0x120>
+	*sleeping = 1;
+  802404:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  80240b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802410:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  802413:	75 ac                	jne    8023c1 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  802415:	83 ec 04             	sub    $0x4,%esp
+  802418:	56                   	push   %esi
+  802419:	57                   	push   %edi
+  80241a:	ff 75 e4             	push   -0x1c(%ebp)
+  80241d:	e8 99 ee ff ff       	call   8012bb <sys_futex_wait>
+  802422:	83 c4 10             	add    $0x10,%esp
+  802425:	eb 9a                	jmp    8023c1 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  802427:	39 75 10             	cmp    %esi,0x10(%ebp)
+  80242a:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  80242e:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802430:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802435:	f7 e1                	mul    %ecx
+  802437:	c1 ea 0b             	shr    $0xb,%edx
+  80243a:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802440:	29 c1                	sub    %eax,%ecx
+  802442:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  802444:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802449:	29 cf                	sub    %ecx,%edi
+  80244b:	39 f7                	cmp    %esi,%edi
+  80244d:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  802450:	8d 43 10             	lea    0x10(%ebx),%eax
+  802453:	83 ec 04             	sub    $0x4,%esp
+  802456:	57                   	push   %edi
+  802457:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80245a:	01 c2                	add    %eax,%edx
+  80245c:	52                   	push   %edx
+  80245d:	ff 75 0c             	push   0xc(%ebp)
+  802460:	e8 10 e6 ff ff       	call   800a75 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  802465:	83 c4 0c             	add    $0xc,%esp
+  802468:	89 f1                	mov    %esi,%ecx
+  80246a:	29 f9                	sub    %edi,%ecx
+  80246c:	51                   	push   %ecx
+  80246d:	ff 75 e4             	push   -0x1c(%ebp)
+  802470:	89 f8                	mov    %edi,%eax
+  802472:	03 45 0c             	add    0xc(%ebp),%eax
+  802475:	50                   	push   %eax
+  802476:	e8 fa e5 ff ff       	call   800a75 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  80247b:	89 f1                	mov    %esi,%ecx
+  80247d:	03 0b                	add    (%ebx),%ecx
+  80247f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802484:	f7 e1                	mul    %ecx
+  802486:	c1 ea 0c             	shr    $0xc,%edx
+  802489:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80248f:	29 d1                	sub    %edx,%ecx
+  802491:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  802493:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802498:	83 c4 10             	add    $0x10,%esp
+  80249b:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  80249f:	75 0a                	jne    8024ab <devpipe_read+0x106>
+	return n;
+  8024a1:	89 f0                	mov    %esi,%eax
+}
+  8024a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024a6:	5b                   	pop    %ebx
+  8024a7:	5e                   	pop    %esi
+  8024a8:	5f                   	pop    %edi
+  8024a9:	5d                   	pop    %ebp
+  8024aa:	c3                   	ret
+		*sleeping = 0;
+  8024ab:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8024b2:	83 ec 08             	sub    $0x8,%esp
+  8024b5:	68 00 04 00 00       	push   $0x400
+  8024ba:	53                   	push   %ebx
+  8024bb:	e8 4b ee ff ff       	call   80130b <sys_futex_wake>
+  8024c0:	83 c4 10             	add    $0x10,%esp
+  8024c3:	eb dc                	jmp    8024a1 <devpipe_read+0xfc>
+			return 0;
+  8024c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ca:	eb d7                	jmp    8024a3 <devpipe_read+0xfe>
+
+008024cc <devpipe_write>:
+{
+  8024cc:	55                   	push   %ebp
+  8024cd:	89 e5                	mov    %esp,%ebp
+  8024cf:	57                   	push   %edi
+  8024d0:	56                   	push   %esi
+  8024d1:	53                   	push   %ebx
+  8024d2:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8024d5:	ff 75 08             	push   0x8(%ebp)
+  8024d8:	e8 64 f4 ff ff       	call   801941 <fd2data>
+  8024dd:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8024df:	83 c4 10             	add    $0x10,%esp
+  8024e2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8024e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024ec:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8024ef:	0f 83 23 01 00 00    	jae    802618 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8024f5:	8b 77 04             	mov    0x4(%edi),%esi
+  8024f8:	8b 1f                	mov    (%edi),%ebx
+  8024fa:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  802500:	29 d9                	sub    %ebx,%ecx
+  802502:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802507:	f7 e1                	mul    %ecx
+  802509:	c1 ea 0c             	shr    $0xc,%edx
+  80250c:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802512:	29 c1                	sub    %eax,%ecx
+  802514:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802516:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80251c:	75 40                	jne    80255e <devpipe_write+0x92>
+			ref = pageref(p);
+  80251e:	83 ec 0c             	sub    $0xc,%esp
+  802521:	57                   	push   %edi
+  802522:	e8 a9 2c 00 00       	call   8051d0 <pageref>
+  802527:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  802529:	89 fa                	mov    %edi,%edx
+  80252b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80252e:	e8 0d fe ff ff       	call   802340 <_pipeisclosed>
+  802533:	83 c4 10             	add    $0x10,%esp
+  802536:	85 c0                	test   %eax,%eax
+  802538:	0f 85 d5 00 00 00    	jne    802613 <devpipe_write+0x147>
+	*sleeping = 1;
+  80253e:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  802545:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80254a:	39 1f                	cmp    %ebx,(%edi)
+  80254c:	75 a7                	jne    8024f5 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  80254e:	83 ec 04             	sub    $0x4,%esp
+  802551:	56                   	push   %esi
+  802552:	53                   	push   %ebx
+  802553:	57                   	push   %edi
+  802554:	e8 62 ed ff ff       	call   8012bb <sys_futex_wait>
+  802559:	83 c4 10             	add    $0x10,%esp
+  80255c:	eb 97                	jmp    8024f5 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80255e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802561:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802564:	29 c1                	sub    %eax,%ecx
+  802566:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80256b:	89 d8                	mov    %ebx,%eax
+  80256d:	29 d0                	sub    %edx,%eax
+  80256f:	39 c1                	cmp    %eax,%ecx
+  802571:	0f 46 c1             	cmovbe %ecx,%eax
+  802574:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  802576:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80257b:	f7 e6                	mul    %esi
+  80257d:	c1 ea 0b             	shr    $0xb,%edx
+  802580:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802586:	29 c6                	sub    %eax,%esi
+  802588:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80258a:	29 f3                	sub    %esi,%ebx
+  80258c:	39 cb                	cmp    %ecx,%ebx
+  80258e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802591:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  802594:	8d 77 10             	lea    0x10(%edi),%esi
+  802597:	83 ec 04             	sub    $0x4,%esp
+  80259a:	53                   	push   %ebx
+  80259b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80259e:	03 45 0c             	add    0xc(%ebp),%eax
+  8025a1:	50                   	push   %eax
+  8025a2:	01 f2                	add    %esi,%edx
+  8025a4:	52                   	push   %edx
+  8025a5:	e8 cb e4 ff ff       	call   800a75 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8025aa:	83 c4 0c             	add    $0xc,%esp
+  8025ad:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8025b0:	29 d8                	sub    %ebx,%eax
+  8025b2:	50                   	push   %eax
+  8025b3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025b6:	01 d3                	add    %edx,%ebx
+  8025b8:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8025bb:	53                   	push   %ebx
+  8025bc:	56                   	push   %esi
+  8025bd:	e8 b3 e4 ff ff       	call   800a75 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8025c2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8025c5:	03 4f 04             	add    0x4(%edi),%ecx
+  8025c8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8025cd:	f7 e1                	mul    %ecx
+  8025cf:	c1 ea 0c             	shr    $0xc,%edx
+  8025d2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8025d8:	29 d1                	sub    %edx,%ecx
+  8025da:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8025dd:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8025e2:	83 c4 10             	add    $0x10,%esp
+  8025e5:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8025e9:	75 0b                	jne    8025f6 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8025eb:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8025ee:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8025f1:	e9 f3 fe ff ff       	jmp    8024e9 <devpipe_write+0x1d>
+		*sleeping = 0;
+  8025f6:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8025fd:	83 ec 08             	sub    $0x8,%esp
+  802600:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802605:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802608:	50                   	push   %eax
+  802609:	e8 fd ec ff ff       	call   80130b <sys_futex_wake>
+  80260e:	83 c4 10             	add    $0x10,%esp
+  802611:	eb d8                	jmp    8025eb <devpipe_write+0x11f>
+				return 0;
+  802613:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802618:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80261b:	5b                   	pop    %ebx
+  80261c:	5e                   	pop    %esi
+  80261d:	5f                   	pop    %edi
+  80261e:	5d                   	pop    %ebp
+  80261f:	c3                   	ret
+
+00802620 <pipe>:
+{
+  802620:	55                   	push   %ebp
+  802621:	89 e5                	mov    %esp,%ebp
+  802623:	56                   	push   %esi
+  802624:	53                   	push   %ebx
+  802625:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802628:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80262b:	50                   	push   %eax
+  80262c:	e8 27 f3 ff ff       	call   801958 <fd_alloc>
+  802631:	89 c3                	mov    %eax,%ebx
+  802633:	83 c4 10             	add    $0x10,%esp
+  802636:	85 c0                	test   %eax,%eax
+  802638:	0f 88 23 01 00 00    	js     802761 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80263e:	83 ec 04             	sub    $0x4,%esp
+  802641:	68 07 04 00 00       	push   $0x407
+  802646:	ff 75 f4             	push   -0xc(%ebp)
+  802649:	6a 00                	push   $0x0
+  80264b:	e8 92 e7 ff ff       	call   800de2 <sys_page_alloc>
+  802650:	89 c3                	mov    %eax,%ebx
+  802652:	83 c4 10             	add    $0x10,%esp
+  802655:	85 c0                	test   %eax,%eax
+  802657:	0f 88 04 01 00 00    	js     802761 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80265d:	83 ec 0c             	sub    $0xc,%esp
+  802660:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802663:	50                   	push   %eax
+  802664:	e8 ef f2 ff ff       	call   801958 <fd_alloc>
+  802669:	89 c3                	mov    %eax,%ebx
+  80266b:	83 c4 10             	add    $0x10,%esp
+  80266e:	85 c0                	test   %eax,%eax
+  802670:	0f 88 db 00 00 00    	js     802751 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802676:	83 ec 04             	sub    $0x4,%esp
+  802679:	68 07 04 00 00       	push   $0x407
+  80267e:	ff 75 f0             	push   -0x10(%ebp)
+  802681:	6a 00                	push   $0x0
+  802683:	e8 5a e7 ff ff       	call   800de2 <sys_page_alloc>
+  802688:	89 c3                	mov    %eax,%ebx
+  80268a:	83 c4 10             	add    $0x10,%esp
+  80268d:	85 c0                	test   %eax,%eax
+  80268f:	0f 88 bc 00 00 00    	js     802751 <pipe+0x131>
+	va = fd2data(fd0);
+  802695:	83 ec 0c             	sub    $0xc,%esp
+  802698:	ff 75 f4             	push   -0xc(%ebp)
+  80269b:	e8 a1 f2 ff ff       	call   801941 <fd2data>
+  8026a0:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026a2:	83 c4 0c             	add    $0xc,%esp
+  8026a5:	68 07 04 00 00       	push   $0x407
+  8026aa:	50                   	push   %eax
+  8026ab:	6a 00                	push   $0x0
+  8026ad:	e8 30 e7 ff ff       	call   800de2 <sys_page_alloc>
+  8026b2:	89 c3                	mov    %eax,%ebx
+  8026b4:	83 c4 10             	add    $0x10,%esp
+  8026b7:	85 c0                	test   %eax,%eax
+  8026b9:	0f 88 82 00 00 00    	js     802741 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026bf:	83 ec 0c             	sub    $0xc,%esp
+  8026c2:	ff 75 f0             	push   -0x10(%ebp)
+  8026c5:	e8 77 f2 ff ff       	call   801941 <fd2data>
+  8026ca:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8026d1:	50                   	push   %eax
+  8026d2:	6a 00                	push   $0x0
+  8026d4:	56                   	push   %esi
+  8026d5:	6a 00                	push   $0x0
+  8026d7:	e8 49 e7 ff ff       	call   800e25 <sys_page_map>
+  8026dc:	89 c3                	mov    %eax,%ebx
+  8026de:	83 c4 20             	add    $0x20,%esp
+  8026e1:	85 c0                	test   %eax,%eax
+  8026e3:	78 4e                	js     802733 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8026e5:	a1 20 70 80 00       	mov    0x807020,%eax
+  8026ea:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026ed:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8026ef:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026f2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8026f9:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8026fc:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8026fe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802701:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802708:	83 ec 0c             	sub    $0xc,%esp
+  80270b:	ff 75 f4             	push   -0xc(%ebp)
+  80270e:	e8 1e f2 ff ff       	call   801931 <fd2num>
+  802713:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802716:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802718:	83 c4 04             	add    $0x4,%esp
+  80271b:	ff 75 f0             	push   -0x10(%ebp)
+  80271e:	e8 0e f2 ff ff       	call   801931 <fd2num>
+  802723:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802726:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802729:	83 c4 10             	add    $0x10,%esp
+  80272c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802731:	eb 2e                	jmp    802761 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802733:	83 ec 08             	sub    $0x8,%esp
+  802736:	56                   	push   %esi
+  802737:	6a 00                	push   $0x0
+  802739:	e8 29 e7 ff ff       	call   800e67 <sys_page_unmap>
+  80273e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802741:	83 ec 08             	sub    $0x8,%esp
+  802744:	ff 75 f0             	push   -0x10(%ebp)
+  802747:	6a 00                	push   $0x0
+  802749:	e8 19 e7 ff ff       	call   800e67 <sys_page_unmap>
+  80274e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802751:	83 ec 08             	sub    $0x8,%esp
+  802754:	ff 75 f4             	push   -0xc(%ebp)
+  802757:	6a 00                	push   $0x0
+  802759:	e8 09 e7 ff ff       	call   800e67 <sys_page_unmap>
+  80275e:	83 c4 10             	add    $0x10,%esp
+}
+  802761:	89 d8                	mov    %ebx,%eax
+  802763:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802766:	5b                   	pop    %ebx
+  802767:	5e                   	pop    %esi
+  802768:	5d                   	pop    %ebp
+  802769:	c3                   	ret
+
+0080276a <pipeisclosed>:
+{
+  80276a:	55                   	push   %ebp
+  80276b:	89 e5                	mov    %esp,%ebp
+  80276d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802770:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802773:	50                   	push   %eax
+  802774:	ff 75 08             	push   0x8(%ebp)
+  802777:	e8 30 f2 ff ff       	call   8019ac <fd_lookup>
+  80277c:	83 c4 10             	add    $0x10,%esp
+  80277f:	85 c0                	test   %eax,%eax
+  802781:	78 18                	js     80279b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802783:	83 ec 0c             	sub    $0xc,%esp
+  802786:	ff 75 f4             	push   -0xc(%ebp)
+  802789:	e8 b3 f1 ff ff       	call   801941 <fd2data>
+  80278e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802790:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802793:	e8 a8 fb ff ff       	call   802340 <_pipeisclosed>
+  802798:	83 c4 10             	add    $0x10,%esp
+}
+  80279b:	c9                   	leave
+  80279c:	c3                   	ret
+
+0080279d <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  80279d:	55                   	push   %ebp
+  80279e:	89 e5                	mov    %esp,%ebp
+  8027a0:	57                   	push   %edi
+  8027a1:	56                   	push   %esi
+  8027a2:	53                   	push   %ebx
+  8027a3:	83 ec 0c             	sub    $0xc,%esp
+  8027a6:	8b 7d 08             	mov    0x8(%ebp),%edi
+	const volatile struct Env *e;
+	unsigned status;
+
+	assert(envid != 0);
+  8027a9:	85 ff                	test   %edi,%edi
+  8027ab:	74 21                	je     8027ce <wait+0x31>
+	e = &envs[ENVX(envid)];
+  8027ad:	89 f8                	mov    %edi,%eax
+  8027af:	25 ff 03 00 00       	and    $0x3ff,%eax
+	// The kernel wakes us when it frees the environment.  Until then
+	// we sleep, unless its status changed since we looked.
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  8027b4:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  8027b7:	c1 e6 06             	shl    $0x6,%esi
+  8027ba:	81 c6 54 00 c0 ee    	add    $0xeec00054,%esi
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  8027c0:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  8027c3:	c1 e3 06             	shl    $0x6,%ebx
+  8027c6:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8027cc:	eb 25                	jmp    8027f3 <wait+0x56>
+	assert(envid != 0);
+  8027ce:	68 e6 5a 80 00       	push   $0x805ae6
+  8027d3:	68 9b 5a 80 00       	push   $0x805a9b
+  8027d8:	6a 0a                	push   $0xa
+  8027da:	68 f1 5a 80 00       	push   $0x805af1
+  8027df:	e8 49 da ff ff       	call   80022d <_panic>
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  8027e4:	83 ec 04             	sub    $0x4,%esp
+  8027e7:	6a ff                	push   $0xffffffff
+  8027e9:	50                   	push   %eax
+  8027ea:	56                   	push   %esi
+  8027eb:	e8 cb ea ff ff       	call   8012bb <sys_futex_wait>
+  8027f0:	83 c4 10             	add    $0x10,%esp
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  8027f3:	8b 43 48             	mov    0x48(%ebx),%eax
+  8027f6:	39 f8                	cmp    %edi,%eax
+  8027f8:	75 07                	jne    802801 <wait+0x64>
+  8027fa:	8b 43 54             	mov    0x54(%ebx),%eax
+  8027fd:	85 c0                	test   %eax,%eax
+  8027ff:	75 e3                	jne    8027e4 <wait+0x47>
+}
+  802801:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802804:	5b                   	pop    %ebx
+  802805:	5e                   	pop    %esi
+  802806:	5f                   	pop    %edi
+  802807:	5d                   	pop    %ebp
+  802808:	c3                   	ret
+
+00802809 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802809:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  80280b:	8b 15 24 fd 80 00    	mov    0x80fd24,%edx
+  802811:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802817:	81 c2 34 01 00 00    	add    $0x134,%edx
+  80281d:	39 d0                	cmp    %edx,%eax
+  80281f:	74 2e                	je     80284f <segment_lookup+0x46>
+{
+  802821:	55                   	push   %ebp
+  802822:	89 e5                	mov    %esp,%ebp
+  802824:	57                   	push   %edi
+  802825:	56                   	push   %esi
+  802826:	53                   	push   %ebx
+  802827:	eb 07                	jmp    802830 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802829:	83 c0 20             	add    $0x20,%eax
+  80282c:	39 d0                	cmp    %edx,%eax
+  80282e:	74 15                	je     802845 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802830:	8b 18                	mov    (%eax),%ebx
+  802832:	39 d9                	cmp    %ebx,%ecx
+  802834:	72 f3                	jb     802829 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  802836:	8b 38                	mov    (%eax),%edi
+  802838:	8b 58 04             	mov    0x4(%eax),%ebx
+  80283b:	89 ce                	mov    %ecx,%esi
+  80283d:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  80283f:	39 de                	cmp    %ebx,%esi
+  802841:	73 e6                	jae    802829 <segment_lookup+0x20>
+  802843:	eb 05                	jmp    80284a <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  802845:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80284a:	5b                   	pop    %ebx
+  80284b:	5e                   	pop    %esi
+  80284c:	5f                   	pop    %edi
+  80284d:	5d                   	pop    %ebp
+  80284e:	c3                   	ret
+	return NULL;
+  80284f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802854:	c3                   	ret
+
+00802855 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802855:	55                   	push   %ebp
+  802856:	89 e5                	mov    %esp,%ebp
+  802858:	53                   	push   %ebx
+  802859:	83 ec 04             	sub    $0x4,%esp
+  80285c:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80285e:	c1 e8 16             	shr    $0x16,%eax
+  802861:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802868:	25 81 00 00 00       	and    $0x81,%eax
+  80286d:	83 f8 01             	cmp    $0x1,%eax
+  802870:	75 6b                	jne    8028dd <page_is_clean+0x88>
+  802872:	89 da                	mov    %ebx,%edx
+  802874:	c1 ea 0c             	shr    $0xc,%edx
+  802877:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  80287e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802883:	f6 c1 01             	test   $0x1,%cl
+  802886:	74 5a                	je     8028e2 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802888:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80288f:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802895:	75 4b                	jne    8028e2 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  802897:	89 d8                	mov    %ebx,%eax
+  802899:	e8 6b ff ff ff       	call   802809 <segment_lookup>
+  80289e:	89 c2                	mov    %eax,%edx
+		return 1;
+  8028a0:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  8028a5:	85 d2                	test   %edx,%edx
+  8028a7:	75 39                	jne    8028e2 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  8028a9:	8b 15 0c c0 80 00    	mov    0x80c00c,%edx
+  8028af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b4:	eb 03                	jmp    8028b9 <page_is_clean+0x64>
+  8028b6:	83 c0 01             	add    $0x1,%eax
+  8028b9:	39 c2                	cmp    %eax,%edx
+  8028bb:	7e 19                	jle    8028d6 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  8028bd:	3b 1c c5 20 c0 80 00 	cmp    0x80c020(,%eax,8),%ebx
+  8028c4:	72 f0                	jb     8028b6 <page_is_clean+0x61>
+  8028c6:	3b 1c c5 24 c0 80 00 	cmp    0x80c024(,%eax,8),%ebx
+  8028cd:	73 e7                	jae    8028b6 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  8028cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028d4:	eb 0c                	jmp    8028e2 <page_is_clean+0x8d>
+	return 0;
+  8028d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028db:	eb 05                	jmp    8028e2 <page_is_clean+0x8d>
+		return 0;
+  8028dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028e5:	c9                   	leave
+  8028e6:	c3                   	ret
+
+008028e7 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  8028e7:	55                   	push   %ebp
+  8028e8:	89 e5                	mov    %esp,%ebp
+  8028ea:	57                   	push   %edi
+  8028eb:	56                   	push   %esi
+  8028ec:	53                   	push   %ebx
+  8028ed:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8028f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8028f5:	eb 19                	jmp    802910 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8028f7:	f7 d3                	not    %ebx
+  8028f9:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8028ff:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802901:	83 c6 01             	add    $0x1,%esi
+  802904:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  80290a:	0f 87 97 00 00 00    	ja     8029a7 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802910:	89 f3                	mov    %esi,%ebx
+  802912:	03 1d 34 90 80 00    	add    0x809034,%ebx
+  802918:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80291e:	89 d8                	mov    %ebx,%eax
+  802920:	c1 e8 0a             	shr    $0xa,%eax
+  802923:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80292a:	25 81 00 00 00       	and    $0x81,%eax
+  80292f:	83 f8 01             	cmp    $0x1,%eax
+  802932:	75 c3                	jne    8028f7 <linear_walk+0x10>
+  802934:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  80293a:	77 bb                	ja     8028f7 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  80293c:	89 df                	mov    %ebx,%edi
+  80293e:	c1 e7 0c             	shl    $0xc,%edi
+  802941:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802944:	89 f8                	mov    %edi,%eax
+  802946:	e8 0a ff ff ff       	call   802855 <page_is_clean>
+  80294b:	84 c0                	test   %al,%al
+  80294d:	75 64                	jne    8029b3 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80294f:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802955:	77 aa                	ja     802901 <linear_walk+0x1a>
+  802957:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  80295d:	72 a2                	jb     802901 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80295f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802966:	a8 01                	test   $0x1,%al
+  802968:	74 97                	je     802901 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80296a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802971:	f6 c4 04             	test   $0x4,%ah
+  802974:	75 8b                	jne    802901 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802976:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80297d:	f6 c4 02             	test   $0x2,%ah
+  802980:	0f 85 7b ff ff ff    	jne    802901 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802986:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80298d:	c1 e8 0c             	shr    $0xc,%eax
+  802990:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802993:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802998:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80299c:	66 83 f8 01          	cmp    $0x1,%ax
+  8029a0:	76 11                	jbe    8029b3 <linear_walk+0xcc>
+  8029a2:	e9 5a ff ff ff       	jmp    802901 <linear_walk+0x1a>
+  8029a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  8029ac:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  8029b3:	89 1d 34 90 80 00    	mov    %ebx,0x809034
+}
+  8029b9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029bc:	83 c4 1c             	add    $0x1c,%esp
+  8029bf:	5b                   	pop    %ebx
+  8029c0:	5e                   	pop    %esi
+  8029c1:	5f                   	pop    %edi
+  8029c2:	5d                   	pop    %ebp
+  8029c3:	c3                   	ret
+
+008029c4 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  8029c4:	55                   	push   %ebp
+  8029c5:	89 e5                	mov    %esp,%ebp
+  8029c7:	56                   	push   %esi
+  8029c8:	53                   	push   %ebx
+  8029c9:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  8029cb:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8029d0:	83 e0 7f             	and    $0x7f,%eax
+  8029d3:	c1 e0 04             	shl    $0x4,%eax
+  8029d6:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  8029dc:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  8029e2:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  8029e8:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  8029ee:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8029f3:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  8029f6:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8029fb:	83 c0 01             	add    $0x1,%eax
+  8029fe:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  802a03:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802a06:	5b                   	pop    %ebx
+  802a07:	5e                   	pop    %esi
+  802a08:	5d                   	pop    %ebp
+  802a09:	c3                   	ret
+
+00802a0a <page_ring_enter>:
+{
+  802a0a:	55                   	push   %ebp
+  802a0b:	89 e5                	mov    %esp,%ebp
+  802a0d:	57                   	push   %edi
+  802a0e:	56                   	push   %esi
+  802a0f:	53                   	push   %ebx
+  802a10:	83 ec 18             	sub    $0x18,%esp
+  802a13:	89 c6                	mov    %eax,%esi
+  802a15:	89 d7                	mov    %edx,%edi
+  802a17:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802a19:	6a 00                	push   $0x0
+  802a1b:	6a 00                	push   $0x0
+  802a1d:	6a 00                	push   $0x0
+  802a1f:	6a 07                	push   $0x7
+  802a21:	ff 35 40 c0 80 00    	push   0x80c040
+  802a27:	e8 8e 26 00 00       	call   8050ba <ipc_call>
+  802a2c:	83 c4 20             	add    $0x20,%esp
+  802a2f:	85 c0                	test   %eax,%eax
+  802a31:	79 22                	jns    802a55 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802a33:	50                   	push   %eax
+  802a34:	68 fc 5a 80 00       	push   $0x805afc
+  802a39:	68 13 02 00 00       	push   $0x213
+  802a3e:	68 10 5b 80 00       	push   $0x805b10
+  802a43:	e8 e5 d7 ff ff       	call   80022d <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802a48:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802a4d:	83 c0 01             	add    $0x1,%eax
+  802a50:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802a55:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802a5b:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802a60:	39 c2                	cmp    %eax,%edx
+  802a62:	74 24                	je     802a88 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802a64:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802a69:	83 e0 7f             	and    $0x7f,%eax
+  802a6c:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802a73:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802a7a:	29 f0                	sub    %esi,%eax
+  802a7c:	39 d8                	cmp    %ebx,%eax
+  802a7e:	73 c8                	jae    802a48 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802a80:	8b 52 04             	mov    0x4(%edx),%edx
+  802a83:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802a86:	eb c0                	jmp    802a48 <page_ring_enter+0x3e>
+}
+  802a88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a8b:	5b                   	pop    %ebx
+  802a8c:	5e                   	pop    %esi
+  802a8d:	5f                   	pop    %edi
+  802a8e:	5d                   	pop    %ebp
+  802a8f:	c3                   	ret
+
+00802a90 <page_ring_reserve>:
+{
+  802a90:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802a92:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802a97:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802a9d:	29 d0                	sub    %edx,%eax
+  802a9f:	ba 80 00 00 00       	mov    $0x80,%edx
+  802aa4:	29 ca                	sub    %ecx,%edx
+  802aa6:	39 c2                	cmp    %eax,%edx
+  802aa8:	72 01                	jb     802aab <page_ring_reserve+0x1b>
+  802aaa:	c3                   	ret
+{
+  802aab:	55                   	push   %ebp
+  802aac:	89 e5                	mov    %esp,%ebp
+  802aae:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802ab1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ab6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802abb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac0:	e8 45 ff ff ff       	call   802a0a <page_ring_enter>
+}
+  802ac5:	c9                   	leave
+  802ac6:	c3                   	ret
+
+00802ac7 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802ac7:	55                   	push   %ebp
+  802ac8:	89 e5                	mov    %esp,%ebp
+  802aca:	53                   	push   %ebx
+  802acb:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802ace:	6a 07                	push   $0x7
+  802ad0:	6a 01                	push   $0x1
+  802ad2:	89 c3                	mov    %eax,%ebx
+  802ad4:	c1 e3 0c             	shl    $0xc,%ebx
+  802ad7:	8d 93 00 a0 80 00    	lea    0x80a000(%ebx),%edx
+  802add:	52                   	push   %edx
+  802ade:	6a 04                	push   $0x4
+  802ae0:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  802ae7:	e8 ce 25 00 00       	call   8050ba <ipc_call>
+	sharereqs[i].nslots = 0;
+  802aec:	c7 83 00 a0 80 00 00 	movl   $0x0,0x80a000(%ebx)
+  802af3:	00 00 00 
+	return r;
+}
+  802af6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802af9:	c9                   	leave
+  802afa:	c3                   	ret
+
+00802afb <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802afb:	55                   	push   %ebp
+  802afc:	89 e5                	mov    %esp,%ebp
+  802afe:	56                   	push   %esi
+  802aff:	53                   	push   %ebx
+  802b00:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802b02:	c1 e8 10             	shr    $0x10,%eax
+  802b05:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802b08:	89 c2                	mov    %eax,%edx
+  802b0a:	c1 e2 0c             	shl    $0xc,%edx
+  802b0d:	8b b2 00 a0 80 00    	mov    0x80a000(%edx),%esi
+  802b13:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802b16:	89 9a 00 a0 80 00    	mov    %ebx,0x80a000(%edx)
+  802b1c:	89 c2                	mov    %eax,%edx
+  802b1e:	c1 e2 0a             	shl    $0xa,%edx
+  802b21:	01 f2                	add    %esi,%edx
+  802b23:	89 0c 95 04 a0 80 00 	mov    %ecx,0x80a004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802b2a:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802b30:	74 09                	je     802b3b <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802b32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b37:	5b                   	pop    %ebx
+  802b38:	5e                   	pop    %esi
+  802b39:	5d                   	pop    %ebp
+  802b3a:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802b3b:	e8 87 ff ff ff       	call   802ac7 <page_share_send>
+  802b40:	eb f5                	jmp    802b37 <page_share_slot+0x3c>
+
+00802b42 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802b42:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  802b47:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802b4a:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802b4f:	3b 15 00 c0 80 00    	cmp    0x80c000,%edx
+  802b55:	74 09                	je     802b60 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802b57:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  802b5c:	85 c0                	test   %eax,%eax
+  802b5e:	75 01                	jne    802b61 <page_ring_ready+0x1f>
+}
+  802b60:	c3                   	ret
+{
+  802b61:	55                   	push   %ebp
+  802b62:	89 e5                	mov    %esp,%ebp
+  802b64:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802b67:	68 07 06 00 00       	push   $0x607
+  802b6c:	6a 08                	push   $0x8
+  802b6e:	68 00 30 ad de       	push   $0xdead3000
+  802b73:	6a 00                	push   $0x0
+  802b75:	e8 93 e3 ff ff       	call   800f0d <sys_page_alloc_range>
+  802b7a:	83 c4 10             	add    $0x10,%esp
+  802b7d:	83 f8 08             	cmp    $0x8,%eax
+  802b80:	74 1b                	je     802b9d <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802b82:	83 ec 04             	sub    $0x4,%esp
+  802b85:	6a 08                	push   $0x8
+  802b87:	68 00 30 ad de       	push   $0xdead3000
+  802b8c:	6a 00                	push   $0x0
+  802b8e:	e8 e8 e3 ff ff       	call   800f7b <sys_page_unmap_range>
+		return 0;
+  802b93:	83 c4 10             	add    $0x10,%esp
+  802b96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b9b:	c9                   	leave
+  802b9c:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802b9d:	83 ec 0c             	sub    $0xc,%esp
+  802ba0:	68 07 04 00 00       	push   $0x407
+  802ba5:	6a 08                	push   $0x8
+  802ba7:	68 00 30 ad de       	push   $0xdead3000
+  802bac:	6a 06                	push   $0x6
+  802bae:	ff 35 40 c0 80 00    	push   0x80c040
+  802bb4:	e8 01 25 00 00       	call   8050ba <ipc_call>
+  802bb9:	83 c4 20             	add    $0x20,%esp
+  802bbc:	85 c0                	test   %eax,%eax
+  802bbe:	78 14                	js     802bd4 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802bc0:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  802bc5:	8b 40 48             	mov    0x48(%eax),%eax
+  802bc8:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	return 1;
+  802bcd:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bd2:	eb c7                	jmp    802b9b <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802bd4:	83 ec 04             	sub    $0x4,%esp
+  802bd7:	6a 08                	push   $0x8
+  802bd9:	68 00 30 ad de       	push   $0xdead3000
+  802bde:	6a 00                	push   $0x0
+  802be0:	e8 96 e3 ff ff       	call   800f7b <sys_page_unmap_range>
+		return 0;
+  802be5:	83 c4 10             	add    $0x10,%esp
+  802be8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bed:	eb ac                	jmp    802b9b <page_ring_ready+0x59>
+
+00802bef <page_remove_slot>:
+{
+  802bef:	55                   	push   %ebp
+  802bf0:	89 e5                	mov    %esp,%ebp
+  802bf2:	56                   	push   %esi
+  802bf3:	53                   	push   %ebx
+  802bf4:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802bf6:	89 c6                	mov    %eax,%esi
+  802bf8:	c1 ee 10             	shr    $0x10,%esi
+  802bfb:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802bfe:	8b 04 b5 44 c0 80 00 	mov    0x80c044(,%esi,4),%eax
+  802c05:	39 05 40 c0 80 00    	cmp    %eax,0x80c040
+  802c0b:	74 2a                	je     802c37 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802c0d:	83 ec 0c             	sub    $0xc,%esp
+  802c10:	6a 00                	push   $0x0
+  802c12:	6a 00                	push   $0x0
+  802c14:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802c16:	c1 e3 04             	shl    $0x4,%ebx
+  802c19:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802c1c:	53                   	push   %ebx
+  802c1d:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  802c24:	e8 91 24 00 00       	call   8050ba <ipc_call>
+  802c29:	83 c4 20             	add    $0x20,%esp
+  802c2c:	85 c0                	test   %eax,%eax
+  802c2e:	78 2d                	js     802c5d <page_remove_slot+0x6e>
+}
+  802c30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c33:	5b                   	pop    %ebx
+  802c34:	5e                   	pop    %esi
+  802c35:	5d                   	pop    %ebp
+  802c36:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802c37:	e8 06 ff ff ff       	call   802b42 <page_ring_ready>
+  802c3c:	85 c0                	test   %eax,%eax
+  802c3e:	74 cd                	je     802c0d <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802c40:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c45:	e8 46 fe ff ff       	call   802a90 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802c4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c4f:	89 da                	mov    %ebx,%edx
+  802c51:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c56:	e8 69 fd ff ff       	call   8029c4 <page_ring_post>
+		return;
+  802c5b:	eb d3                	jmp    802c30 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802c5d:	50                   	push   %eax
+  802c5e:	68 68 5b 80 00       	push   $0x805b68
+  802c63:	68 ac 03 00 00       	push   $0x3ac
+  802c68:	68 10 5b 80 00       	push   $0x805b10
+  802c6d:	e8 bb d5 ff ff       	call   80022d <_panic>
+
+00802c72 <find_paging_env>:
+	if(pagingenv)
+  802c72:	a1 40 c0 80 00       	mov    0x80c040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802c77:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802c79:	85 c0                	test   %eax,%eax
+  802c7b:	74 05                	je     802c82 <find_paging_env+0x10>
+  802c7d:	eb 56                	jmp    802cd5 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802c7f:	83 c0 01             	add    $0x1,%eax
+  802c82:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802c87:	7f 47                	jg     802cd0 <find_paging_env+0x5e>
+  802c89:	83 f9 01             	cmp    $0x1,%ecx
+  802c8c:	7f 42                	jg     802cd0 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802c8e:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802c91:	c1 e2 06             	shl    $0x6,%edx
+  802c94:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802c9a:	8b 52 50             	mov    0x50(%edx),%edx
+  802c9d:	83 fa 02             	cmp    $0x2,%edx
+  802ca0:	75 dd                	jne    802c7f <find_paging_env+0xd>
+  802ca2:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802ca5:	c1 e2 06             	shl    $0x6,%edx
+  802ca8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802cae:	8b 52 54             	mov    0x54(%edx),%edx
+  802cb1:	85 d2                	test   %edx,%edx
+  802cb3:	74 ca                	je     802c7f <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802cb5:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802cb8:	c1 e2 06             	shl    $0x6,%edx
+  802cbb:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802cc1:	8b 52 48             	mov    0x48(%edx),%edx
+  802cc4:	89 14 8d 44 c0 80 00 	mov    %edx,0x80c044(,%ecx,4)
+  802ccb:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802cce:	eb af                	jmp    802c7f <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802cd0:	83 f9 02             	cmp    $0x2,%ecx
+  802cd3:	74 01                	je     802cd6 <find_paging_env+0x64>
+}
+  802cd5:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802cd6:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  802cdb:	8b 40 48             	mov    0x48(%eax),%eax
+  802cde:	83 e0 01             	and    $0x1,%eax
+  802ce1:	8b 04 85 44 c0 80 00 	mov    0x80c044(,%eax,4),%eax
+  802ce8:	a3 40 c0 80 00       	mov    %eax,0x80c040
+  802ced:	eb e6                	jmp    802cd5 <find_paging_env+0x63>
+
+00802cef <page_add_backed>:
+{
+  802cef:	55                   	push   %ebp
+  802cf0:	89 e5                	mov    %esp,%ebp
+  802cf2:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802cf5:	a1 0c c0 80 00       	mov    0x80c00c,%eax
+  802cfa:	83 f8 04             	cmp    $0x4,%eax
+  802cfd:	74 35                	je     802d34 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802cff:	89 d1                	mov    %edx,%ecx
+  802d01:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802d07:	89 0c c5 20 c0 80 00 	mov    %ecx,0x80c020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802d0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d11:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802d18:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802d1e:	89 14 c5 24 c0 80 00 	mov    %edx,0x80c024(,%eax,8)
+	num_backed_ranges++;
+  802d25:	83 c0 01             	add    $0x1,%eax
+  802d28:	a3 0c c0 80 00       	mov    %eax,0x80c00c
+	return 0;
+  802d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d32:	5d                   	pop    %ebp
+  802d33:	c3                   	ret
+		return -E_NO_MEM;
+  802d34:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802d39:	eb f7                	jmp    802d32 <page_add_backed+0x43>
+
+00802d3b <percentage_of_pgdir_to_walk>:
+{
+  802d3b:	55                   	push   %ebp
+  802d3c:	89 e5                	mov    %esp,%ebp
+  802d3e:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802d41:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802d45:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802d48:	db 45 fc             	fildl  -0x4(%ebp)
+  802d4b:	d8 35 f4 5f 80 00    	fdivs  0x805ff4
+	return ret*ret;
+  802d51:	d8 c8                	fmul   %st(0),%st
+}
+  802d53:	c9                   	leave
+  802d54:	c3                   	ret
+
+00802d55 <nfu_with_aging_page_choice_func>:
+{
+  802d55:	55                   	push   %ebp
+  802d56:	89 e5                	mov    %esp,%ebp
+  802d58:	57                   	push   %edi
+  802d59:	56                   	push   %esi
+  802d5a:	53                   	push   %ebx
+  802d5b:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d5e:	8b 35 30 90 80 00    	mov    0x809030,%esi
+	float pct_to_walk = 1.0f;
+  802d64:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802d66:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802d6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d70:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802d77:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d7c:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802d7f:	eb 18                	jmp    802d99 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802d81:	f7 d0                	not    %eax
+  802d83:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802d88:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802d8a:	83 c2 01             	add    $0x1,%edx
+  802d8d:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802d93:	0f 87 13 01 00 00    	ja     802eac <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802d99:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d9d:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802da0:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802da5:	89 c1                	mov    %eax,%ecx
+  802da7:	c1 e9 0a             	shr    $0xa,%ecx
+  802daa:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802db1:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802db7:	83 f9 01             	cmp    $0x1,%ecx
+  802dba:	75 c5                	jne    802d81 <nfu_with_aging_page_choice_func+0x2c>
+  802dbc:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802dc1:	77 be                	ja     802d81 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802dc3:	89 c1                	mov    %eax,%ecx
+  802dc5:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802dc8:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  802dce:	0f 82 a5 00 00 00    	jb     802e79 <nfu_with_aging_page_choice_func+0x124>
+  802dd4:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802dda:	0f 87 99 00 00 00    	ja     802e79 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802de0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802de7:	f6 c1 01             	test   $0x1,%cl
+  802dea:	0f 84 89 00 00 00    	je     802e79 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802df0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802df7:	f6 c5 04             	test   $0x4,%ch
+  802dfa:	75 7d                	jne    802e79 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802dfc:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802e03:	f6 c5 02             	test   $0x2,%ch
+  802e06:	75 71                	jne    802e79 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802e08:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802e0f:	c1 e9 0c             	shr    $0xc,%ecx
+  802e12:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802e15:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802e1b:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802e1f:	66 83 f9 01          	cmp    $0x1,%cx
+  802e23:	77 54                	ja     802e79 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802e25:	89 f9                	mov    %edi,%ecx
+  802e27:	80 f9 ff             	cmp    $0xff,%cl
+  802e2a:	74 21                	je     802e4d <nfu_with_aging_page_choice_func+0xf8>
+  802e2c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802e33:	c1 e9 0c             	shr    $0xc,%ecx
+  802e36:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802e39:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802e3f:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802e43:	89 fb                	mov    %edi,%ebx
+  802e45:	38 d9                	cmp    %bl,%cl
+  802e47:	73 30                	jae    802e79 <nfu_with_aging_page_choice_func+0x124>
+  802e49:	dd d8                	fstp   %st(0)
+  802e4b:	eb 02                	jmp    802e4f <nfu_with_aging_page_choice_func+0xfa>
+  802e4d:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802e4f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802e56:	c1 e9 0c             	shr    $0xc,%ecx
+  802e59:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802e5c:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802e63:	89 fb                	mov    %edi,%ebx
+  802e65:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802e68:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802e6b:	db 45 e0             	fildl  -0x20(%ebp)
+  802e6e:	d8 35 f4 5f 80 00    	fdivs  0x805ff4
+	return ret*ret;
+  802e74:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802e76:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802e79:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802e7c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802e7f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802e86:	df 6d e0             	fildll -0x20(%ebp)
+  802e89:	d9 c1                	fld    %st(1)
+  802e8b:	d8 0d f8 5f 80 00    	fmuls  0x805ff8
+  802e91:	d9 c9                	fxch   %st(1)
+  802e93:	df f1                	fcomip %st(1),%st
+  802e95:	dd d8                	fstp   %st(0)
+  802e97:	0f 82 ed fe ff ff    	jb     802d8a <nfu_with_aging_page_choice_func+0x35>
+  802e9d:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802e9f:	a3 30 90 80 00       	mov    %eax,0x809030
+			return (void*)(pgnum_opt*PGSIZE);
+  802ea4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802ea7:	c1 e0 0c             	shl    $0xc,%eax
+  802eaa:	eb 0e                	jmp    802eba <nfu_with_aging_page_choice_func+0x165>
+  802eac:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802eae:	89 f8                	mov    %edi,%eax
+  802eb0:	3c ff                	cmp    $0xff,%al
+  802eb2:	74 0e                	je     802ec2 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802eb4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802eb7:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802eba:	83 c4 14             	add    $0x14,%esp
+  802ebd:	5b                   	pop    %ebx
+  802ebe:	5e                   	pop    %esi
+  802ebf:	5f                   	pop    %edi
+  802ec0:	5d                   	pop    %ebp
+  802ec1:	c3                   	ret
+	pgnum = 0;
+  802ec2:	c7 05 30 90 80 00 00 	movl   $0x0,0x809030
+  802ec9:	00 00 00 
+	return (void*)UTOP;
+  802ecc:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802ed1:	eb e7                	jmp    802eba <nfu_with_aging_page_choice_func+0x165>
+
+00802ed3 <myRand>:
+    state = state * 1664525 + 1013904223;
+  802ed3:	69 05 40 70 80 00 0d 	imul   $0x19660d,0x807040,%eax
+  802eda:	66 19 00 
+  802edd:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802ee2:	a3 40 70 80 00       	mov    %eax,0x807040
+    return state >> 24;
+  802ee7:	c1 e8 18             	shr    $0x18,%eax
+}
+  802eea:	c3                   	ret
+
+00802eeb <random_page_choice_func>:
+{
+  802eeb:	55                   	push   %ebp
+  802eec:	89 e5                	mov    %esp,%ebp
+  802eee:	57                   	push   %edi
+  802eef:	56                   	push   %esi
+  802ef0:	53                   	push   %ebx
+  802ef1:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802ef4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef9:	eb 19                	jmp    802f14 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802efb:	f7 d3                	not    %ebx
+  802efd:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802f03:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802f05:	83 c6 01             	add    $0x1,%esi
+  802f08:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802f0e:	0f 87 a0 00 00 00    	ja     802fb4 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802f14:	89 f3                	mov    %esi,%ebx
+  802f16:	03 1d 2c 90 80 00    	add    0x80902c,%ebx
+  802f1c:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802f22:	89 d8                	mov    %ebx,%eax
+  802f24:	c1 e8 0a             	shr    $0xa,%eax
+  802f27:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802f2e:	25 81 00 00 00       	and    $0x81,%eax
+  802f33:	83 f8 01             	cmp    $0x1,%eax
+  802f36:	75 c3                	jne    802efb <random_page_choice_func+0x10>
+  802f38:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802f3e:	77 bb                	ja     802efb <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802f40:	89 df                	mov    %ebx,%edi
+  802f42:	c1 e7 0c             	shl    $0xc,%edi
+  802f45:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802f48:	89 f8                	mov    %edi,%eax
+  802f4a:	e8 06 f9 ff ff       	call   802855 <page_is_clean>
+  802f4f:	84 c0                	test   %al,%al
+  802f51:	0f 85 82 00 00 00    	jne    802fd9 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f57:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  802f5d:	72 a6                	jb     802f05 <random_page_choice_func+0x1a>
+  802f5f:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802f65:	77 9e                	ja     802f05 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802f67:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f6e:	a8 01                	test   $0x1,%al
+  802f70:	74 93                	je     802f05 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802f72:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802f79:	f6 c4 04             	test   $0x4,%ah
+  802f7c:	75 87                	jne    802f05 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802f7e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802f85:	f6 c4 02             	test   $0x2,%ah
+  802f88:	0f 85 77 ff ff ff    	jne    802f05 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802f8e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802f95:	c1 e8 0c             	shr    $0xc,%eax
+  802f98:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802f9b:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802fa0:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802fa4:	66 83 f8 01          	cmp    $0x1,%ax
+  802fa8:	0f 87 57 ff ff ff    	ja     802f05 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  802fae:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802fb4:	e8 1a ff ff ff       	call   802ed3 <myRand>
+  802fb9:	8b 3d 2c 90 80 00    	mov    0x80902c,%edi
+  802fbf:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  802fc4:	29 fe                	sub    %edi,%esi
+  802fc6:	0f be c0             	movsbl %al,%eax
+  802fc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fce:	f7 f6                	div    %esi
+  802fd0:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802fd2:	bb 15 00 00 00       	mov    $0x15,%ebx
+  802fd7:	eb 1c                	jmp    802ff5 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  802fd9:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+			return (void*)(pgnum*PGSIZE);
+  802fdf:	e9 8f 00 00 00       	jmp    803073 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802fe4:	e8 ea fe ff ff       	call   802ed3 <myRand>
+  802fe9:	0f be c0             	movsbl %al,%eax
+  802fec:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ff1:	f7 f6                	div    %esi
+  802ff3:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802ff5:	83 eb 01             	sub    $0x1,%ebx
+  802ff8:	0f 84 c2 00 00 00    	je     8030c0 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  802ffe:	89 d0                	mov    %edx,%eax
+  803000:	c1 e8 0a             	shr    $0xa,%eax
+  803003:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80300a:	25 81 00 00 00       	and    $0x81,%eax
+  80300f:	83 f8 01             	cmp    $0x1,%eax
+  803012:	75 d0                	jne    802fe4 <random_page_choice_func+0xf9>
+  803014:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  80301a:	77 c8                	ja     802fe4 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  80301c:	89 d0                	mov    %edx,%eax
+  80301e:	c1 e0 0c             	shl    $0xc,%eax
+  803021:	3d 2c 10 81 00       	cmp    $0x81102c,%eax
+  803026:	72 56                	jb     80307e <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  803028:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  80302d:	77 65                	ja     803094 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  80302f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  803036:	f6 c1 01             	test   $0x1,%cl
+  803039:	74 59                	je     803094 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  80303b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  803042:	f6 c5 04             	test   $0x4,%ch
+  803045:	75 4d                	jne    803094 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  803047:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  80304e:	f6 c5 02             	test   $0x2,%ch
+  803051:	75 41                	jne    803094 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  803053:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80305a:	c1 ea 0c             	shr    $0xc,%edx
+  80305d:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  803060:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  803066:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  80306a:	66 83 fa 01          	cmp    $0x1,%dx
+  80306e:	77 3a                	ja     8030aa <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  803070:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  803073:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803076:	83 c4 1c             	add    $0x1c,%esp
+  803079:	5b                   	pop    %ebx
+  80307a:	5e                   	pop    %esi
+  80307b:	5f                   	pop    %edi
+  80307c:	5d                   	pop    %ebp
+  80307d:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  80307e:	e8 50 fe ff ff       	call   802ed3 <myRand>
+  803083:	0f be c0             	movsbl %al,%eax
+  803086:	ba 00 00 00 00       	mov    $0x0,%edx
+  80308b:	f7 f6                	div    %esi
+  80308d:	01 fa                	add    %edi,%edx
+			continue;
+  80308f:	e9 61 ff ff ff       	jmp    802ff5 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  803094:	e8 3a fe ff ff       	call   802ed3 <myRand>
+  803099:	0f be c0             	movsbl %al,%eax
+  80309c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030a1:	f7 f6                	div    %esi
+  8030a3:	01 fa                	add    %edi,%edx
+			continue;
+  8030a5:	e9 4b ff ff ff       	jmp    802ff5 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  8030aa:	e8 24 fe ff ff       	call   802ed3 <myRand>
+  8030af:	0f be c0             	movsbl %al,%eax
+  8030b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030b7:	f7 f6                	div    %esi
+  8030b9:	01 fa                	add    %edi,%edx
+			continue;
+  8030bb:	e9 35 ff ff ff       	jmp    802ff5 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  8030c0:	c7 05 2c 90 80 00 00 	movl   $0x0,0x80902c
+  8030c7:	00 00 00 
+	return (void*)UTOP;
+  8030ca:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  8030d1:	eb a0                	jmp    803073 <random_page_choice_func+0x188>
+
+008030d3 <nfu>:
+{
+  8030d3:	55                   	push   %ebp
+  8030d4:	89 e5                	mov    %esp,%ebp
+  8030d6:	57                   	push   %edi
+  8030d7:	56                   	push   %esi
+  8030d8:	53                   	push   %ebx
+  8030d9:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8030dc:	8b 35 28 90 80 00    	mov    0x809028,%esi
+	float pct_to_walk = 1.0f;
+  8030e2:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  8030e4:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8030e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030ee:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8030f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030fa:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  8030fd:	eb 18                	jmp    803117 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8030ff:	f7 d0                	not    %eax
+  803101:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803106:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803108:	83 c2 01             	add    $0x1,%edx
+  80310b:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803111:	0f 87 13 01 00 00    	ja     80322a <nfu+0x157>
+		++num_searched_ptes;
+  803117:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80311b:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  80311e:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803123:	89 c1                	mov    %eax,%ecx
+  803125:	c1 e9 0a             	shr    $0xa,%ecx
+  803128:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80312f:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803135:	83 f9 01             	cmp    $0x1,%ecx
+  803138:	75 c5                	jne    8030ff <nfu+0x2c>
+  80313a:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  80313f:	77 be                	ja     8030ff <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803141:	89 c1                	mov    %eax,%ecx
+  803143:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803146:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  80314c:	0f 82 a5 00 00 00    	jb     8031f7 <nfu+0x124>
+  803152:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803158:	0f 87 99 00 00 00    	ja     8031f7 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80315e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803165:	f6 c1 01             	test   $0x1,%cl
+  803168:	0f 84 89 00 00 00    	je     8031f7 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80316e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803175:	f6 c5 04             	test   $0x4,%ch
+  803178:	75 7d                	jne    8031f7 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80317a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803181:	f6 c5 02             	test   $0x2,%ch
+  803184:	75 71                	jne    8031f7 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803186:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80318d:	c1 e9 0c             	shr    $0xc,%ecx
+  803190:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803193:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803199:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  80319d:	66 83 f9 01          	cmp    $0x1,%cx
+  8031a1:	77 54                	ja     8031f7 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  8031a3:	89 f9                	mov    %edi,%ecx
+  8031a5:	80 f9 ff             	cmp    $0xff,%cl
+  8031a8:	74 21                	je     8031cb <nfu+0xf8>
+  8031aa:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8031b1:	c1 e9 0c             	shr    $0xc,%ecx
+  8031b4:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8031b7:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8031bd:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  8031c1:	89 fb                	mov    %edi,%ebx
+  8031c3:	38 d9                	cmp    %bl,%cl
+  8031c5:	73 30                	jae    8031f7 <nfu+0x124>
+  8031c7:	dd d8                	fstp   %st(0)
+  8031c9:	eb 02                	jmp    8031cd <nfu+0xfa>
+  8031cb:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  8031cd:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8031d4:	c1 e9 0c             	shr    $0xc,%ecx
+  8031d7:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8031da:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  8031e1:	89 fb                	mov    %edi,%ebx
+  8031e3:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  8031e6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8031e9:	db 45 e0             	fildl  -0x20(%ebp)
+  8031ec:	d8 35 f4 5f 80 00    	fdivs  0x805ff4
+	return ret*ret;
+  8031f2:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8031f4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8031f7:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8031fa:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8031fd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803204:	df 6d e0             	fildll -0x20(%ebp)
+  803207:	d9 c1                	fld    %st(1)
+  803209:	d8 0d f8 5f 80 00    	fmuls  0x805ff8
+  80320f:	d9 c9                	fxch   %st(1)
+  803211:	df f1                	fcomip %st(1),%st
+  803213:	dd d8                	fstp   %st(0)
+  803215:	0f 82 ed fe ff ff    	jb     803108 <nfu+0x35>
+  80321b:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  80321d:	a3 28 90 80 00       	mov    %eax,0x809028
+			return (void*)(pgnum_opt*PGSIZE);
+  803222:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803225:	c1 e0 0c             	shl    $0xc,%eax
+  803228:	eb 0e                	jmp    803238 <nfu+0x165>
+  80322a:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  80322c:	89 f8                	mov    %edi,%eax
+  80322e:	3c ff                	cmp    $0xff,%al
+  803230:	74 0e                	je     803240 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  803232:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803235:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803238:	83 c4 14             	add    $0x14,%esp
+  80323b:	5b                   	pop    %ebx
+  80323c:	5e                   	pop    %esi
+  80323d:	5f                   	pop    %edi
+  80323e:	5d                   	pop    %ebp
+  80323f:	c3                   	ret
+	pgnum = 0;
+  803240:	c7 05 28 90 80 00 00 	movl   $0x0,0x809028
+  803247:	00 00 00 
+	return (void*)UTOP;
+  80324a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80324f:	eb e7                	jmp    803238 <nfu+0x165>
+
+00803251 <lru>:
+{
+  803251:	55                   	push   %ebp
+  803252:	89 e5                	mov    %esp,%ebp
+  803254:	57                   	push   %edi
+  803255:	56                   	push   %esi
+  803256:	53                   	push   %ebx
+  803257:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80325a:	8b 3d 24 90 80 00    	mov    0x809024,%edi
+	long long time_min = 9223372036854775807;
+  803260:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  803267:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80326e:	be 00 00 00 00       	mov    $0x0,%esi
+  803273:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80327a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80327f:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  803282:	eb 18                	jmp    80329c <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803284:	f7 d0                	not    %eax
+  803286:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80328b:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80328d:	83 c2 01             	add    $0x1,%edx
+  803290:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803296:	0f 87 fa 00 00 00    	ja     803396 <lru+0x145>
+		++num_searched_ptes;
+  80329c:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80329f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8032a2:	01 d0                	add    %edx,%eax
+  8032a4:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8032a9:	89 c1                	mov    %eax,%ecx
+  8032ab:	c1 e9 0a             	shr    $0xa,%ecx
+  8032ae:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8032b5:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8032bb:	83 f9 01             	cmp    $0x1,%ecx
+  8032be:	75 c4                	jne    803284 <lru+0x33>
+  8032c0:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8032c5:	77 bd                	ja     803284 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8032c7:	89 c1                	mov    %eax,%ecx
+  8032c9:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8032cc:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8032d2:	0f 87 92 00 00 00    	ja     80336a <lru+0x119>
+  8032d8:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  8032de:	0f 82 86 00 00 00    	jb     80336a <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8032e4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8032eb:	f6 c1 01             	test   $0x1,%cl
+  8032ee:	74 7a                	je     80336a <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8032f0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8032f7:	f6 c5 04             	test   $0x4,%ch
+  8032fa:	75 6e                	jne    80336a <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8032fc:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803303:	f6 c5 02             	test   $0x2,%ch
+  803306:	75 62                	jne    80336a <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803308:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80330f:	c1 e9 0c             	shr    $0xc,%ecx
+  803312:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803315:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80331b:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  80331f:	66 83 f9 01          	cmp    $0x1,%cx
+  803323:	77 45                	ja     80336a <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  803325:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80332c:	c1 e9 0c             	shr    $0xc,%ecx
+  80332f:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803332:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803338:	8b 59 14             	mov    0x14(%ecx),%ebx
+  80333b:	8b 49 10             	mov    0x10(%ecx),%ecx
+  80333e:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  803341:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803344:	19 df                	sbb    %ebx,%edi
+  803346:	7c 22                	jl     80336a <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  803348:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80334f:	c1 e9 0c             	shr    $0xc,%ecx
+  803352:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803355:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80335b:	8b 59 14             	mov    0x14(%ecx),%ebx
+  80335e:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803361:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  803364:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803367:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  80336a:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  80336d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803374:	df 6d e0             	fildll -0x20(%ebp)
+  803377:	d9 05 f8 5f 80 00    	flds   0x805ff8
+  80337d:	d9 c9                	fxch   %st(1)
+  80337f:	df f1                	fcomip %st(1),%st
+  803381:	dd d8                	fstp   %st(0)
+  803383:	0f 82 04 ff ff ff    	jb     80328d <lru+0x3c>
+			pgnum = pgnum_actual;
+  803389:	a3 24 90 80 00       	mov    %eax,0x809024
+			return (void*)(pgnum_opt*PGSIZE);
+  80338e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803391:	c1 e0 0c             	shl    $0xc,%eax
+  803394:	eb 06                	jmp    80339c <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  803396:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803399:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80339c:	83 c4 1c             	add    $0x1c,%esp
+  80339f:	5b                   	pop    %ebx
+  8033a0:	5e                   	pop    %esi
+  8033a1:	5f                   	pop    %edi
+  8033a2:	5d                   	pop    %ebp
+  8033a3:	c3                   	ret
+
+008033a4 <set_page_choice_func>:
+{
+  8033a4:	55                   	push   %ebp
+  8033a5:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  8033a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033aa:	a3 3c 70 80 00       	mov    %eax,0x80703c
+}
+  8033af:	5d                   	pop    %ebp
+  8033b0:	c3                   	ret
+
+008033b1 <get_page_choice>:
+{
+  8033b1:	55                   	push   %ebp
+  8033b2:	89 e5                	mov    %esp,%ebp
+  8033b4:	57                   	push   %edi
+  8033b5:	56                   	push   %esi
+  8033b6:	53                   	push   %ebx
+  8033b7:	83 ec 24             	sub    $0x24,%esp
+  8033ba:	8b 75 08             	mov    0x8(%ebp),%esi
+  8033bd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  8033c0:	57                   	push   %edi
+  8033c1:	56                   	push   %esi
+  8033c2:	ff 15 3c 70 80 00    	call   *0x80703c
+  8033c8:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8033ca:	83 c4 10             	add    $0x10,%esp
+  8033cd:	eb 25                	jmp    8033f4 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  8033cf:	83 ec 08             	sub    $0x8,%esp
+  8033d2:	c1 e0 16             	shl    $0x16,%eax
+  8033d5:	50                   	push   %eax
+  8033d6:	6a 00                	push   $0x0
+  8033d8:	e8 cc da ff ff       	call   800ea9 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8033dd:	83 c4 10             	add    $0x10,%esp
+  8033e0:	85 c0                	test   %eax,%eax
+  8033e2:	75 43                	jne    803427 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  8033e4:	83 ec 08             	sub    $0x8,%esp
+  8033e7:	57                   	push   %edi
+  8033e8:	56                   	push   %esi
+  8033e9:	ff 15 3c 70 80 00    	call   *0x80703c
+  8033ef:	89 c3                	mov    %eax,%ebx
+  8033f1:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8033f4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8033f7:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8033fd:	0f 86 ae 00 00 00    	jbe    8034b1 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803403:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  803408:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80340f:	81 e2 81 00 00 00    	and    $0x81,%edx
+  803415:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  80341b:	74 b2                	je     8033cf <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80341d:	83 c0 01             	add    $0x1,%eax
+  803420:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  803425:	75 e1                	jne    803408 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803427:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80342a:	05 00 10 40 11       	add    $0x11401000,%eax
+  80342f:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803434:	76 1f                	jbe    803455 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  803436:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  80343b:	89 d8                	mov    %ebx,%eax
+  80343d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803440:	5b                   	pop    %ebx
+  803441:	5e                   	pop    %esi
+  803442:	5f                   	pop    %edi
+  803443:	5d                   	pop    %ebp
+  803444:	c3                   	ret
+		sys_page_split(0, pg_out);
+  803445:	83 ec 08             	sub    $0x8,%esp
+  803448:	53                   	push   %ebx
+  803449:	6a 00                	push   $0x0
+  80344b:	e8 59 da ff ff       	call   800ea9 <sys_page_split>
+  803450:	83 c4 10             	add    $0x10,%esp
+  803453:	eb 6c                	jmp    8034c1 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  803455:	83 ec 04             	sub    $0x4,%esp
+  803458:	68 a0 5b 80 00       	push   $0x805ba0
+  80345d:	68 cc 01 00 00       	push   $0x1cc
+  803462:	68 10 5b 80 00       	push   $0x805b10
+  803467:	e8 c1 cd ff ff       	call   80022d <_panic>
+		panic("We tried to page out code pages\n");
+  80346c:	83 ec 04             	sub    $0x4,%esp
+  80346f:	68 d0 5b 80 00       	push   $0x805bd0
+  803474:	68 d6 01 00 00       	push   $0x1d6
+  803479:	68 10 5b 80 00       	push   $0x805b10
+  80347e:	e8 aa cd ff ff       	call   80022d <_panic>
+		panic("Invalid mapping for the va\n");
+  803483:	83 ec 04             	sub    $0x4,%esp
+  803486:	68 1d 5b 80 00       	push   $0x805b1d
+  80348b:	68 da 01 00 00       	push   $0x1da
+  803490:	68 10 5b 80 00       	push   $0x805b10
+  803495:	e8 93 cd ff ff       	call   80022d <_panic>
+		panic("We tried to page out a shared page\n");
+  80349a:	83 ec 04             	sub    $0x4,%esp
+  80349d:	68 f4 5b 80 00       	push   $0x805bf4
+  8034a2:	68 e0 01 00 00       	push   $0x1e0
+  8034a7:	68 10 5b 80 00       	push   $0x805b10
+  8034ac:	e8 7c cd ff ff       	call   80022d <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  8034b1:	89 de                	mov    %ebx,%esi
+  8034b3:	c1 ee 16             	shr    $0x16,%esi
+  8034b6:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8034bd:	a8 80                	test   $0x80,%al
+  8034bf:	75 84                	jne    803445 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  8034c1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8034c4:	05 00 10 40 11       	add    $0x11401000,%eax
+  8034c9:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8034ce:	76 85                	jbe    803455 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  8034d0:	89 d8                	mov    %ebx,%eax
+  8034d2:	e8 7e f3 ff ff       	call   802855 <page_is_clean>
+  8034d7:	84 c0                	test   %al,%al
+  8034d9:	0f 85 5c ff ff ff    	jne    80343b <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  8034df:	81 7d e4 2c 10 81 00 	cmpl   $0x81102c,-0x1c(%ebp)
+  8034e6:	76 84                	jbe    80346c <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  8034e8:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8034ef:	a8 01                	test   $0x1,%al
+  8034f1:	74 90                	je     803483 <get_page_choice+0xd2>
+  8034f3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8034f6:	c1 e8 0c             	shr    $0xc,%eax
+  8034f9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803500:	f6 c2 01             	test   $0x1,%dl
+  803503:	0f 84 7a ff ff ff    	je     803483 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803509:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  803510:	f6 c2 01             	test   $0x1,%dl
+  803513:	74 85                	je     80349a <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803515:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  80351c:	f6 c2 01             	test   $0x1,%dl
+  80351f:	0f 84 75 ff ff ff    	je     80349a <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  803525:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  80352c:	f6 c6 04             	test   $0x4,%dh
+  80352f:	0f 85 65 ff ff ff    	jne    80349a <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  803535:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  80353c:	f6 c6 02             	test   $0x2,%dh
+  80353f:	0f 85 55 ff ff ff    	jne    80349a <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  803545:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80354c:	c1 e8 0c             	shr    $0xc,%eax
+  80354f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803552:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803557:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80355b:	66 83 f8 01          	cmp    $0x1,%ax
+  80355f:	0f 86 d6 fe ff ff    	jbe    80343b <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  803565:	83 ec 04             	sub    $0x4,%esp
+  803568:	68 18 5c 80 00       	push   $0x805c18
+  80356d:	68 e2 01 00 00       	push   $0x1e2
+  803572:	68 10 5b 80 00       	push   $0x805b10
+  803577:	e8 b1 cc ff ff       	call   80022d <_panic>
+
+0080357c <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  80357c:	55                   	push   %ebp
+  80357d:	89 e5                	mov    %esp,%ebp
+  80357f:	57                   	push   %edi
+  803580:	56                   	push   %esi
+  803581:	53                   	push   %ebx
+  803582:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  803585:	e8 e8 f6 ff ff       	call   802c72 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  80358a:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  80358f:	85 c0                	test   %eax,%eax
+  803591:	74 41                	je     8035d4 <page_share_paged_out+0x58>
+  803593:	83 3d 20 fd 80 00 00 	cmpl   $0x0,0x80fd20
+  80359a:	0f 84 fd 00 00 00    	je     80369d <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  8035a0:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  8035a7:	00 00 00 
+  8035aa:	c7 05 00 b0 80 00 00 	movl   $0x0,0x80b000
+  8035b1:	00 00 00 
+  8035b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035b9:	eb 2c                	jmp    8035e7 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8035bb:	83 c3 04             	add    $0x4,%ebx
+  8035be:	39 f3                	cmp    %esi,%ebx
+  8035c0:	74 1a                	je     8035dc <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  8035c2:	8b 03                	mov    (%ebx),%eax
+  8035c4:	a8 01                	test   $0x1,%al
+  8035c6:	74 f3                	je     8035bb <page_share_paged_out+0x3f>
+  8035c8:	c1 e8 0c             	shr    $0xc,%eax
+  8035cb:	e8 2b f5 ff ff       	call   802afb <page_share_slot>
+  8035d0:	85 c0                	test   %eax,%eax
+  8035d2:	79 e7                	jns    8035bb <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  8035d4:	83 c4 0c             	add    $0xc,%esp
+  8035d7:	5b                   	pop    %ebx
+  8035d8:	5e                   	pop    %esi
+  8035d9:	5f                   	pop    %edi
+  8035da:	5d                   	pop    %ebp
+  8035db:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  8035dc:	83 c7 04             	add    $0x4,%edi
+  8035df:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  8035e5:	74 1b                	je     803602 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  8035e7:	a1 20 fd 80 00       	mov    0x80fd20,%eax
+  8035ec:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  8035ef:	f6 c3 01             	test   $0x1,%bl
+  8035f2:	74 e8                	je     8035dc <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  8035f4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8035fa:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  803600:	eb bc                	jmp    8035be <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803602:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803607:	eb 11                	jmp    80361a <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  803609:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80360f:	83 c3 01             	add    $0x1,%ebx
+  803612:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803618:	77 41                	ja     80365b <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  80361a:	89 d8                	mov    %ebx,%eax
+  80361c:	c1 e8 0a             	shr    $0xa,%eax
+  80361f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803626:	25 81 00 00 00       	and    $0x81,%eax
+  80362b:	83 f8 01             	cmp    $0x1,%eax
+  80362e:	75 d9                	jne    803609 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803630:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803637:	25 81 00 00 00       	and    $0x81,%eax
+  80363c:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803641:	75 cc                	jne    80360f <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803643:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80364a:	c1 e8 0c             	shr    $0xc,%eax
+  80364d:	e8 a9 f4 ff ff       	call   802afb <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803652:	85 c0                	test   %eax,%eax
+  803654:	79 b9                	jns    80360f <page_share_paged_out+0x93>
+  803656:	e9 79 ff ff ff       	jmp    8035d4 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80365b:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  803662:	75 13                	jne    803677 <page_share_paged_out+0xfb>
+  803664:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  80366b:	75 1d                	jne    80368a <page_share_paged_out+0x10e>
+	return 0;
+  80366d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803672:	e9 5d ff ff ff       	jmp    8035d4 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803677:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367c:	e8 46 f4 ff ff       	call   802ac7 <page_share_send>
+  803681:	85 c0                	test   %eax,%eax
+  803683:	79 df                	jns    803664 <page_share_paged_out+0xe8>
+  803685:	e9 4a ff ff ff       	jmp    8035d4 <page_share_paged_out+0x58>
+  80368a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80368f:	e8 33 f4 ff ff       	call   802ac7 <page_share_send>
+  803694:	85 c0                	test   %eax,%eax
+  803696:	79 d5                	jns    80366d <page_share_paged_out+0xf1>
+  803698:	e9 37 ff ff ff       	jmp    8035d4 <page_share_paged_out+0x58>
+		return 0;
+  80369d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a2:	e9 2d ff ff ff       	jmp    8035d4 <page_share_paged_out+0x58>
+
+008036a7 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  8036a7:	55                   	push   %ebp
+  8036a8:	89 e5                	mov    %esp,%ebp
+  8036aa:	56                   	push   %esi
+  8036ab:	53                   	push   %ebx
+  8036ac:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  8036af:	e8 be f5 ff ff       	call   802c72 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  8036b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  8036b9:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  8036c0:	0f 84 82 00 00 00    	je     803748 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  8036c6:	83 ec 0c             	sub    $0xc,%esp
+  8036c9:	68 00 10 00 00       	push   $0x1000
+  8036ce:	e8 84 11 00 00       	call   804857 <malloc>
+  8036d3:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  8036d5:	83 c4 0c             	add    $0xc,%esp
+  8036d8:	6a 14                	push   $0x14
+  8036da:	6a 00                	push   $0x0
+  8036dc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8036df:	50                   	push   %eax
+  8036e0:	e8 5b d3 ff ff       	call   800a40 <memset>
+  8036e5:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  8036e8:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  8036ed:	83 ec 0c             	sub    $0xc,%esp
+  8036f0:	6a 07                	push   $0x7
+  8036f2:	6a 01                	push   $0x1
+  8036f4:	53                   	push   %ebx
+  8036f5:	6a 03                	push   $0x3
+  8036f7:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  8036fe:	e8 b7 19 00 00       	call   8050ba <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  803703:	8b 03                	mov    (%ebx),%eax
+  803705:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803708:	8b 43 04             	mov    0x4(%ebx),%eax
+  80370b:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  80370e:	8b 43 08             	mov    0x8(%ebx),%eax
+  803711:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  803714:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803717:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  80371a:	8b 43 10             	mov    0x10(%ebx),%eax
+  80371d:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803720:	83 c6 01             	add    $0x1,%esi
+  803723:	83 c4 20             	add    $0x20,%esp
+  803726:	83 fe 02             	cmp    $0x2,%esi
+  803729:	75 c2                	jne    8036ed <get_paging_stats+0x46>
+	}
+	*stats = total;
+  80372b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80372e:	89 03                	mov    %eax,(%ebx)
+  803730:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803733:	89 43 04             	mov    %eax,0x4(%ebx)
+  803736:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803739:	89 43 08             	mov    %eax,0x8(%ebx)
+  80373c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80373f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803742:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803745:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  803748:	89 d8                	mov    %ebx,%eax
+  80374a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80374d:	5b                   	pop    %ebx
+  80374e:	5e                   	pop    %esi
+  80374f:	5d                   	pop    %ebp
+  803750:	c3                   	ret
+
+00803751 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803751:	55                   	push   %ebp
+  803752:	89 e5                	mov    %esp,%ebp
+  803754:	53                   	push   %ebx
+  803755:	83 ec 10             	sub    $0x10,%esp
+  803758:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  80375b:	68 37 5b 80 00       	push   $0x805b37
+  803760:	e8 a3 cb ff ff       	call   800308 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  803765:	83 c4 08             	add    $0x8,%esp
+  803768:	ff 33                	push   (%ebx)
+  80376a:	68 4c 5c 80 00       	push   $0x805c4c
+  80376f:	e8 94 cb ff ff       	call   800308 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  803774:	83 c4 08             	add    $0x8,%esp
+  803777:	ff 73 04             	push   0x4(%ebx)
+  80377a:	68 39 5b 80 00       	push   $0x805b39
+  80377f:	e8 84 cb ff ff       	call   800308 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  803784:	83 c4 08             	add    $0x8,%esp
+  803787:	ff 73 08             	push   0x8(%ebx)
+  80378a:	68 6c 5c 80 00       	push   $0x805c6c
+  80378f:	e8 74 cb ff ff       	call   800308 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  803794:	83 c4 08             	add    $0x8,%esp
+  803797:	ff 73 0c             	push   0xc(%ebx)
+  80379a:	68 90 5c 80 00       	push   $0x805c90
+  80379f:	e8 64 cb ff ff       	call   800308 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  8037a4:	83 c4 08             	add    $0x8,%esp
+  8037a7:	ff 73 10             	push   0x10(%ebx)
+  8037aa:	68 b4 5c 80 00       	push   $0x805cb4
+  8037af:	e8 54 cb ff ff       	call   800308 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  8037b4:	83 c4 08             	add    $0x8,%esp
+  8037b7:	ff 35 08 c0 80 00    	push   0x80c008
+  8037bd:	68 f0 5c 80 00       	push   $0x805cf0
+  8037c2:	e8 41 cb ff ff       	call   800308 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  8037c7:	83 c4 08             	add    $0x8,%esp
+  8037ca:	ff 35 04 c0 80 00    	push   0x80c004
+  8037d0:	68 24 5d 80 00       	push   $0x805d24
+  8037d5:	e8 2e cb ff ff       	call   800308 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  8037da:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  8037df:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  8037e2:	8b 50 68             	mov    0x68(%eax),%edx
+  8037e5:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  8037e8:	51                   	push   %ecx
+  8037e9:	52                   	push   %edx
+  8037ea:	50                   	push   %eax
+  8037eb:	68 64 5d 80 00       	push   $0x805d64
+  8037f0:	e8 13 cb ff ff       	call   800308 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  8037f5:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  8037fa:	8b 40 70             	mov    0x70(%eax),%eax
+  8037fd:	83 c4 18             	add    $0x18,%esp
+  803800:	50                   	push   %eax
+  803801:	68 98 5d 80 00       	push   $0x805d98
+  803806:	e8 fd ca ff ff       	call   800308 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  80380b:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  803811:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803817:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  80381c:	51                   	push   %ecx
+  80381d:	52                   	push   %edx
+  80381e:	50                   	push   %eax
+  80381f:	68 c8 5d 80 00       	push   $0x805dc8
+  803824:	e8 df ca ff ff       	call   800308 <cprintf>
+	cprintf("\n");
+  803829:	83 c4 14             	add    $0x14,%esp
+  80382c:	68 37 5b 80 00       	push   $0x805b37
+  803831:	e8 d2 ca ff ff       	call   800308 <cprintf>
+}
+  803836:	83 c4 10             	add    $0x10,%esp
+  803839:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80383c:	c9                   	leave
+  80383d:	c3                   	ret
+
+0080383e <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  80383e:	55                   	push   %ebp
+  80383f:	89 e5                	mov    %esp,%ebp
+  803841:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  803844:	e8 5e fe ff ff       	call   8036a7 <get_paging_stats>
+  803849:	83 ec 0c             	sub    $0xc,%esp
+  80384c:	50                   	push   %eax
+  80384d:	e8 ff fe ff ff       	call   803751 <print_paging_stats>
+}
+  803852:	83 c4 10             	add    $0x10,%esp
+  803855:	c9                   	leave
+  803856:	c3                   	ret
+
+00803857 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803857:	55                   	push   %ebp
+  803858:	89 e5                	mov    %esp,%ebp
+  80385a:	53                   	push   %ebx
+  80385b:	83 ec 04             	sub    $0x4,%esp
+  80385e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803861:	eb 13                	jmp    803876 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803863:	83 ec 04             	sub    $0x4,%esp
+  803866:	6a ff                	push   $0xffffffff
+  803868:	53                   	push   %ebx
+  803869:	68 00 f0 ff ee       	push   $0xeefff000
+  80386e:	e8 48 da ff ff       	call   8012bb <sys_futex_wait>
+  803873:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803876:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  80387b:	39 d8                	cmp    %ebx,%eax
+  80387d:	74 e4                	je     803863 <mem_pressure_wait+0xc>
+	return now;
+}
+  80387f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803882:	c9                   	leave
+  803883:	c3                   	ret
+
+00803884 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803884:	55                   	push   %ebp
+  803885:	89 e5                	mov    %esp,%ebp
+  803887:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  80388a:	68 f6 44 80 00       	push   $0x8044f6
+  80388f:	e8 32 16 00 00       	call   804ec6 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803894:	c7 05 20 fd 80 00 00 	movl   $0xdeadb000,0x80fd20
+  80389b:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  80389e:	83 c4 0c             	add    $0xc,%esp
+  8038a1:	68 07 02 00 00       	push   $0x207
+  8038a6:	68 00 b0 ad de       	push   $0xdeadb000
+  8038ab:	6a 00                	push   $0x0
+  8038ad:	e8 30 d5 ff ff       	call   800de2 <sys_page_alloc>
+  8038b2:	83 c4 10             	add    $0x10,%esp
+  8038b5:	85 c0                	test   %eax,%eax
+  8038b7:	78 0c                	js     8038c5 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  8038b9:	e8 b4 f3 ff ff       	call   802c72 <find_paging_env>
+	page_ring_ready();
+  8038be:	e8 7f f2 ff ff       	call   802b42 <page_ring_ready>
+}
+  8038c3:	c9                   	leave
+  8038c4:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  8038c5:	50                   	push   %eax
+  8038c6:	68 57 5b 80 00       	push   $0x805b57
+  8038cb:	68 13 05 00 00       	push   $0x513
+  8038d0:	68 10 5b 80 00       	push   $0x805b10
+  8038d5:	e8 53 c9 ff ff       	call   80022d <_panic>
+
+008038da <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  8038da:	55                   	push   %ebp
+  8038db:	89 e5                	mov    %esp,%ebp
+  8038dd:	57                   	push   %edi
+  8038de:	56                   	push   %esi
+  8038df:	53                   	push   %ebx
+  8038e0:	83 ec 0c             	sub    $0xc,%esp
+  8038e3:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  8038e6:	89 fa                	mov    %edi,%edx
+  8038e8:	c1 ea 16             	shr    $0x16,%edx
+  8038eb:	a1 20 fd 80 00       	mov    0x80fd20,%eax
+  8038f0:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  8038f3:	f6 06 01             	testb  $0x1,(%esi)
+  8038f6:	75 3e                	jne    803936 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  8038f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  8038fd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803901:	74 47                	je     80394a <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  803903:	83 ec 0c             	sub    $0xc,%esp
+  803906:	6a 01                	push   $0x1
+  803908:	e8 f2 11 00 00       	call   804aff <va_alloc>
+  80390d:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  80390f:	83 c4 10             	add    $0x10,%esp
+  803912:	85 c0                	test   %eax,%eax
+  803914:	74 34                	je     80394a <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803916:	6a 00                	push   $0x0
+  803918:	68 07 02 00 00       	push   $0x207
+  80391d:	50                   	push   %eax
+  80391e:	6a 00                	push   $0x0
+  803920:	e8 df 02 00 00       	call   803c04 <page_alloc>
+  803925:	83 c4 10             	add    $0x10,%esp
+  803928:	85 c0                	test   %eax,%eax
+  80392a:	78 28                	js     803954 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  80392c:	f6 06 01             	testb  $0x1,(%esi)
+  80392f:	75 38                	jne    803969 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803931:	83 cb 01             	or     $0x1,%ebx
+  803934:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803936:	89 f8                	mov    %edi,%eax
+  803938:	c1 e8 0a             	shr    $0xa,%eax
+  80393b:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803940:	8b 1e                	mov    (%esi),%ebx
+  803942:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803948:	01 c3                	add    %eax,%ebx
+}
+  80394a:	89 d8                	mov    %ebx,%eax
+  80394c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80394f:	5b                   	pop    %ebx
+  803950:	5e                   	pop    %esi
+  803951:	5f                   	pop    %edi
+  803952:	5d                   	pop    %ebp
+  803953:	c3                   	ret
+			va_free(page, 1);
+  803954:	83 ec 08             	sub    $0x8,%esp
+  803957:	6a 01                	push   $0x1
+  803959:	53                   	push   %ebx
+  80395a:	e8 d8 12 00 00       	call   804c37 <va_free>
+			return NULL;
+  80395f:	83 c4 10             	add    $0x10,%esp
+  803962:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803967:	eb e1                	jmp    80394a <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  803969:	83 ec 08             	sub    $0x8,%esp
+  80396c:	53                   	push   %ebx
+  80396d:	6a 00                	push   $0x0
+  80396f:	e8 f3 d4 ff ff       	call   800e67 <sys_page_unmap>
+			va_free(page, 1);
+  803974:	83 c4 08             	add    $0x8,%esp
+  803977:	6a 01                	push   $0x1
+  803979:	53                   	push   %ebx
+  80397a:	e8 b8 12 00 00       	call   804c37 <va_free>
+  80397f:	83 c4 10             	add    $0x10,%esp
+  803982:	eb b2                	jmp    803936 <umapdir_walk+0x5c>
+
+00803984 <page_out>:
+{
+  803984:	55                   	push   %ebp
+  803985:	89 e5                	mov    %esp,%ebp
+  803987:	57                   	push   %edi
+  803988:	56                   	push   %esi
+  803989:	53                   	push   %ebx
+  80398a:	83 ec 5c             	sub    $0x5c,%esp
+  80398d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803990:	e8 dd f2 ff ff       	call   802c72 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803995:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  80399a:	85 c0                	test   %eax,%eax
+  80399c:	74 1e                	je     8039bc <page_out+0x38>
+  80399e:	83 ec 0c             	sub    $0xc,%esp
+  8039a1:	6a 00                	push   $0x0
+  8039a3:	6a 00                	push   $0x0
+  8039a5:	6a 00                	push   $0x0
+  8039a7:	6a 08                	push   $0x8
+  8039a9:	50                   	push   %eax
+  8039aa:	e8 0b 17 00 00       	call   8050ba <ipc_call>
+  8039af:	89 c3                	mov    %eax,%ebx
+  8039b1:	83 c4 20             	add    $0x20,%esp
+  8039b4:	85 c0                	test   %eax,%eax
+  8039b6:	0f 84 ac 00 00 00    	je     803a68 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  8039bc:	83 ec 08             	sub    $0x8,%esp
+  8039bf:	ff 75 0c             	push   0xc(%ebp)
+  8039c2:	57                   	push   %edi
+  8039c3:	e8 e9 f9 ff ff       	call   8033b1 <get_page_choice>
+  8039c8:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  8039ca:	83 c4 10             	add    $0x10,%esp
+  8039cd:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8039d2:	0f 84 18 02 00 00    	je     803bf0 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  8039d8:	e8 78 ee ff ff       	call   802855 <page_is_clean>
+  8039dd:	84 c0                	test   %al,%al
+  8039df:	0f 85 8c 00 00 00    	jne    803a71 <page_out+0xed>
+	if (pagingenv == 0)
+  8039e5:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  8039ec:	0f 84 08 02 00 00    	je     803bfa <page_out+0x276>
+	if (page_ring_ready())
+  8039f2:	e8 4b f1 ff ff       	call   802b42 <page_ring_ready>
+  8039f7:	89 c3                	mov    %eax,%ebx
+  8039f9:	85 c0                	test   %eax,%eax
+  8039fb:	0f 85 89 00 00 00    	jne    803a8a <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  803a01:	83 ec 0c             	sub    $0xc,%esp
+  803a04:	6a 05                	push   $0x5
+  803a06:	6a 01                	push   $0x1
+  803a08:	56                   	push   %esi
+  803a09:	6a 01                	push   $0x1
+  803a0b:	ff 35 40 c0 80 00    	push   0x80c040
+  803a11:	e8 a4 16 00 00       	call   8050ba <ipc_call>
+  803a16:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803a18:	83 c4 20             	add    $0x20,%esp
+  803a1b:	85 c0                	test   %eax,%eax
+  803a1d:	0f 88 b8 01 00 00    	js     803bdb <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803a23:	89 f0                	mov    %esi,%eax
+  803a25:	c1 e8 0c             	shr    $0xc,%eax
+  803a28:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803a2f:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803a32:	83 ec 08             	sub    $0x8,%esp
+  803a35:	56                   	push   %esi
+  803a36:	6a 00                	push   $0x0
+  803a38:	e8 2a d4 ff ff       	call   800e67 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803a3d:	83 c4 08             	add    $0x8,%esp
+  803a40:	6a 01                	push   $0x1
+  803a42:	56                   	push   %esi
+  803a43:	e8 92 fe ff ff       	call   8038da <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803a48:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803a4b:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803a51:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803a54:	09 fe                	or     %edi,%esi
+  803a56:	83 ce 01             	or     $0x1,%esi
+  803a59:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803a5b:	83 c4 10             	add    $0x10,%esp
+}
+  803a5e:	89 d8                	mov    %ebx,%eax
+  803a60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a63:	5b                   	pop    %ebx
+  803a64:	5e                   	pop    %esi
+  803a65:	5f                   	pop    %edi
+  803a66:	5d                   	pop    %ebp
+  803a67:	c3                   	ret
+		num_page_reclaims++;
+  803a68:	83 05 04 c0 80 00 01 	addl   $0x1,0x80c004
+		return 0;
+  803a6f:	eb ed                	jmp    803a5e <page_out+0xda>
+		num_page_drops++;
+  803a71:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+		return sys_page_unmap(0, map_out_addr);
+  803a78:	83 ec 08             	sub    $0x8,%esp
+  803a7b:	56                   	push   %esi
+  803a7c:	6a 00                	push   $0x0
+  803a7e:	e8 e4 d3 ff ff       	call   800e67 <sys_page_unmap>
+  803a83:	89 c3                	mov    %eax,%ebx
+  803a85:	83 c4 10             	add    $0x10,%esp
+  803a88:	eb d4                	jmp    803a5e <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803a8a:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803a8c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803a91:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803a96:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803a99:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803a9b:	83 c0 08             	add    $0x8,%eax
+  803a9e:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803aa1:	b8 07 00 00 00       	mov    $0x7,%eax
+  803aa6:	e8 e5 ef ff ff       	call   802a90 <page_ring_reserve>
+	first = ring->sq_tail;
+  803aab:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803ab0:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803ab3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803ab8:	83 ec 04             	sub    $0x4,%esp
+  803abb:	68 00 10 00 00       	push   $0x1000
+  803ac0:	56                   	push   %esi
+  803ac1:	89 d8                	mov    %ebx,%eax
+  803ac3:	c1 e0 0c             	shl    $0xc,%eax
+  803ac6:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803acb:	50                   	push   %eax
+  803acc:	e8 06 d0 ff ff       	call   800ad7 <memcpy>
+		vas[n] = va;
+  803ad1:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803ad5:	89 d9                	mov    %ebx,%ecx
+  803ad7:	ba 00 00 00 00       	mov    $0x0,%edx
+  803adc:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ae1:	e8 de ee ff ff       	call   8029c4 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803ae6:	8d 43 01             	lea    0x1(%ebx),%eax
+  803ae9:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803aec:	83 c4 10             	add    $0x10,%esp
+  803aef:	83 fb 06             	cmp    $0x6,%ebx
+  803af2:	74 62                	je     803b56 <page_out+0x1d2>
+  803af4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803af7:	eb 15                	jmp    803b0e <page_out+0x18a>
+			num_page_drops++;
+  803af9:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+			sys_page_unmap(0, va);
+  803b00:	83 ec 08             	sub    $0x8,%esp
+  803b03:	56                   	push   %esi
+  803b04:	6a 00                	push   $0x0
+  803b06:	e8 5c d3 ff ff       	call   800e67 <sys_page_unmap>
+  803b0b:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803b0e:	83 ec 08             	sub    $0x8,%esp
+  803b11:	53                   	push   %ebx
+  803b12:	57                   	push   %edi
+  803b13:	e8 99 f8 ff ff       	call   8033b1 <get_page_choice>
+  803b18:	89 c6                	mov    %eax,%esi
+  803b1a:	83 c4 10             	add    $0x10,%esp
+  803b1d:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803b22:	74 32                	je     803b56 <page_out+0x1d2>
+  803b24:	e8 2c ed ff ff       	call   802855 <page_is_clean>
+  803b29:	84 c0                	test   %al,%al
+  803b2b:	75 cc                	jne    803af9 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803b2d:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803b30:	39 c6                	cmp    %eax,%esi
+  803b32:	72 07                	jb     803b3b <page_out+0x1b7>
+  803b34:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803b37:	39 c6                	cmp    %eax,%esi
+  803b39:	72 1b                	jb     803b56 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803b3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b40:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803b43:	eb 03                	jmp    803b48 <page_out+0x1c4>
+  803b45:	83 c3 01             	add    $0x1,%ebx
+  803b48:	39 da                	cmp    %ebx,%edx
+  803b4a:	0f 84 68 ff ff ff    	je     803ab8 <page_out+0x134>
+  803b50:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803b54:	75 ef                	jne    803b45 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803b56:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803b59:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803b5c:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803b5f:	e8 a6 ee ff ff       	call   802a0a <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803b64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b69:	eb 42                	jmp    803bad <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803b6b:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803b6f:	89 f8                	mov    %edi,%eax
+  803b71:	c1 e8 0c             	shr    $0xc,%eax
+  803b74:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b7b:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803b7e:	83 ec 08             	sub    $0x8,%esp
+  803b81:	57                   	push   %edi
+  803b82:	6a 00                	push   $0x0
+  803b84:	e8 de d2 ff ff       	call   800e67 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803b89:	83 c4 08             	add    $0x8,%esp
+  803b8c:	6a 01                	push   $0x1
+  803b8e:	57                   	push   %edi
+  803b8f:	e8 46 fd ff ff       	call   8038da <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803b94:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803b97:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803b9d:	c1 e6 0c             	shl    $0xc,%esi
+  803ba0:	09 d6                	or     %edx,%esi
+  803ba2:	83 ce 01             	or     $0x1,%esi
+  803ba5:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803ba7:	83 c3 01             	add    $0x1,%ebx
+  803baa:	83 c4 10             	add    $0x10,%esp
+  803bad:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803bb0:	39 c3                	cmp    %eax,%ebx
+  803bb2:	74 1d                	je     803bd1 <page_out+0x24d>
+		if (res[i] < 0)
+  803bb4:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803bb8:	85 f6                	test   %esi,%esi
+  803bba:	79 af                	jns    803b6b <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803bbc:	56                   	push   %esi
+  803bbd:	68 f8 5d 80 00       	push   $0x805df8
+  803bc2:	68 d1 02 00 00       	push   $0x2d1
+  803bc7:	68 10 5b 80 00       	push   $0x805b10
+  803bcc:	e8 5c c6 ff ff       	call   80022d <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803bd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803bd6:	e9 83 fe ff ff       	jmp    803a5e <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803bdb:	50                   	push   %eax
+  803bdc:	68 f8 5d 80 00       	push   $0x805df8
+  803be1:	68 0a 03 00 00       	push   $0x30a
+  803be6:	68 10 5b 80 00       	push   $0x805b10
+  803beb:	e8 3d c6 ff ff       	call   80022d <_panic>
+		return -E_NO_MEM;
+  803bf0:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803bf5:	e9 64 fe ff ff       	jmp    803a5e <page_out+0xda>
+		return -E_PAGING;
+  803bfa:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803bff:	e9 5a fe ff ff       	jmp    803a5e <page_out+0xda>
+
+00803c04 <page_alloc>:
+{
+  803c04:	55                   	push   %ebp
+  803c05:	89 e5                	mov    %esp,%ebp
+  803c07:	57                   	push   %edi
+  803c08:	56                   	push   %esi
+  803c09:	53                   	push   %ebx
+  803c0a:	83 ec 0c             	sub    $0xc,%esp
+  803c0d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803c10:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803c13:	83 3d 20 fd 80 00 00 	cmpl   $0x0,0x80fd20
+  803c1a:	74 34                	je     803c50 <page_alloc+0x4c>
+	if (check_mte)
+  803c1c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803c20:	75 35                	jne    803c57 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803c22:	83 ec 04             	sub    $0x4,%esp
+  803c25:	ff 75 10             	push   0x10(%ebp)
+  803c28:	56                   	push   %esi
+  803c29:	57                   	push   %edi
+  803c2a:	e8 b3 d1 ff ff       	call   800de2 <sys_page_alloc>
+  803c2f:	89 c3                	mov    %eax,%ebx
+  803c31:	83 c4 10             	add    $0x10,%esp
+  803c34:	85 c0                	test   %eax,%eax
+  803c36:	79 52                	jns    803c8a <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803c38:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803c3b:	75 52                	jne    803c8f <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803c3d:	83 ec 08             	sub    $0x8,%esp
+  803c40:	56                   	push   %esi
+  803c41:	57                   	push   %edi
+  803c42:	e8 3d fd ff ff       	call   803984 <page_out>
+  803c47:	83 c4 10             	add    $0x10,%esp
+  803c4a:	85 c0                	test   %eax,%eax
+  803c4c:	79 d4                	jns    803c22 <page_alloc+0x1e>
+  803c4e:	eb 3f                	jmp    803c8f <page_alloc+0x8b>
+		init_map_dir();
+  803c50:	e8 2f fc ff ff       	call   803884 <init_map_dir>
+  803c55:	eb c5                	jmp    803c1c <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803c57:	83 ec 08             	sub    $0x8,%esp
+  803c5a:	6a 00                	push   $0x0
+  803c5c:	56                   	push   %esi
+  803c5d:	e8 78 fc ff ff       	call   8038da <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803c62:	83 c4 10             	add    $0x10,%esp
+  803c65:	85 c0                	test   %eax,%eax
+  803c67:	74 b9                	je     803c22 <page_alloc+0x1e>
+  803c69:	8b 10                	mov    (%eax),%edx
+  803c6b:	f6 c2 01             	test   $0x1,%dl
+  803c6e:	74 b2                	je     803c22 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803c70:	83 ec 08             	sub    $0x8,%esp
+  803c73:	56                   	push   %esi
+  803c74:	52                   	push   %edx
+  803c75:	50                   	push   %eax
+  803c76:	68 1c 5e 80 00       	push   $0x805e1c
+  803c7b:	68 34 03 00 00       	push   $0x334
+  803c80:	68 10 5b 80 00       	push   $0x805b10
+  803c85:	e8 a3 c5 ff ff       	call   80022d <_panic>
+	return 0;
+  803c8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c8f:	89 d8                	mov    %ebx,%eax
+  803c91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c94:	5b                   	pop    %ebx
+  803c95:	5e                   	pop    %esi
+  803c96:	5f                   	pop    %edi
+  803c97:	5d                   	pop    %ebp
+  803c98:	c3                   	ret
+
+00803c99 <page_adopt>:
+{
+  803c99:	55                   	push   %ebp
+  803c9a:	89 e5                	mov    %esp,%ebp
+  803c9c:	56                   	push   %esi
+  803c9d:	53                   	push   %ebx
+  803c9e:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803ca0:	c1 e8 16             	shr    $0x16,%eax
+  803ca3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803caa:	25 81 00 00 00       	and    $0x81,%eax
+  803caf:	83 f8 01             	cmp    $0x1,%eax
+  803cb2:	75 53                	jne    803d07 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803cb4:	89 d8                	mov    %ebx,%eax
+  803cb6:	c1 e8 0c             	shr    $0xc,%eax
+  803cb9:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803cc0:	89 f2                	mov    %esi,%edx
+  803cc2:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803ccd:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803cd3:	75 37                	jne    803d0c <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803cd5:	83 ec 08             	sub    $0x8,%esp
+  803cd8:	6a 01                	push   $0x1
+  803cda:	53                   	push   %ebx
+  803cdb:	e8 fa fb ff ff       	call   8038da <umapdir_walk>
+  803ce0:	83 c4 10             	add    $0x10,%esp
+  803ce3:	85 c0                	test   %eax,%eax
+  803ce5:	74 2c                	je     803d13 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803ce7:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803ced:	83 ce 01             	or     $0x1,%esi
+  803cf0:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803cf2:	83 ec 08             	sub    $0x8,%esp
+  803cf5:	53                   	push   %ebx
+  803cf6:	6a 00                	push   $0x0
+  803cf8:	e8 6a d1 ff ff       	call   800e67 <sys_page_unmap>
+	return 1;
+  803cfd:	83 c4 10             	add    $0x10,%esp
+  803d00:	b8 01 00 00 00       	mov    $0x1,%eax
+  803d05:	eb 05                	jmp    803d0c <page_adopt+0x73>
+		return 0;
+  803d07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d0f:	5b                   	pop    %ebx
+  803d10:	5e                   	pop    %esi
+  803d11:	5d                   	pop    %ebp
+  803d12:	c3                   	ret
+		return -E_NO_MEM;
+  803d13:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803d18:	eb f2                	jmp    803d0c <page_adopt+0x73>
+
+00803d1a <page_forget>:
+{
+  803d1a:	55                   	push   %ebp
+  803d1b:	89 e5                	mov    %esp,%ebp
+  803d1d:	53                   	push   %ebx
+  803d1e:	83 ec 04             	sub    $0x4,%esp
+  803d21:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803d23:	e8 4a ef ff ff       	call   802c72 <find_paging_env>
+	if (pagingenv == 0)
+  803d28:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803d2f:	74 39                	je     803d6a <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803d31:	89 d8                	mov    %ebx,%eax
+  803d33:	c1 e8 16             	shr    $0x16,%eax
+  803d36:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803d3d:	25 81 00 00 00       	and    $0x81,%eax
+  803d42:	83 f8 01             	cmp    $0x1,%eax
+  803d45:	74 28                	je     803d6f <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803d47:	83 3d 20 fd 80 00 00 	cmpl   $0x0,0x80fd20
+  803d4e:	74 1a                	je     803d6a <page_forget+0x50>
+  803d50:	83 ec 08             	sub    $0x8,%esp
+  803d53:	6a 00                	push   $0x0
+  803d55:	53                   	push   %ebx
+  803d56:	e8 7f fb ff ff       	call   8038da <umapdir_walk>
+  803d5b:	89 c3                	mov    %eax,%ebx
+  803d5d:	83 c4 10             	add    $0x10,%esp
+  803d60:	85 c0                	test   %eax,%eax
+  803d62:	74 06                	je     803d6a <page_forget+0x50>
+  803d64:	8b 00                	mov    (%eax),%eax
+  803d66:	a8 01                	test   $0x1,%al
+  803d68:	75 2b                	jne    803d95 <page_forget+0x7b>
+}
+  803d6a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d6d:	c9                   	leave
+  803d6e:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803d6f:	89 d8                	mov    %ebx,%eax
+  803d71:	c1 e8 0c             	shr    $0xc,%eax
+  803d74:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803d7b:	89 c2                	mov    %eax,%edx
+  803d7d:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803d83:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803d89:	75 bc                	jne    803d47 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803d8b:	c1 e8 0c             	shr    $0xc,%eax
+  803d8e:	e8 5c ee ff ff       	call   802bef <page_remove_slot>
+		return;
+  803d93:	eb d5                	jmp    803d6a <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803d95:	c1 e8 0c             	shr    $0xc,%eax
+  803d98:	e8 52 ee ff ff       	call   802bef <page_remove_slot>
+	*mte = 0;
+  803d9d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803da3:	eb c5                	jmp    803d6a <page_forget+0x50>
+
+00803da5 <page_unmap>:
+{
+  803da5:	55                   	push   %ebp
+  803da6:	89 e5                	mov    %esp,%ebp
+  803da8:	57                   	push   %edi
+  803da9:	56                   	push   %esi
+  803daa:	53                   	push   %ebx
+  803dab:	83 ec 0c             	sub    $0xc,%esp
+  803dae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803db1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803db4:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  803db9:	8b 40 48             	mov    0x48(%eax),%eax
+  803dbc:	85 db                	test   %ebx,%ebx
+  803dbe:	0f 8e b4 00 00 00    	jle    803e78 <page_unmap+0xd3>
+  803dc4:	39 d8                	cmp    %ebx,%eax
+  803dc6:	0f 84 ac 00 00 00    	je     803e78 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803dcc:	83 ec 08             	sub    $0x8,%esp
+  803dcf:	57                   	push   %edi
+  803dd0:	53                   	push   %ebx
+  803dd1:	e8 91 d0 ff ff       	call   800e67 <sys_page_unmap>
+  803dd6:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803dd8:	e8 95 ee ff ff       	call   802c72 <find_paging_env>
+	if (pagingenv == 0)
+  803ddd:	83 c4 10             	add    $0x10,%esp
+  803de0:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803de7:	0f 84 a1 00 00 00    	je     803e8e <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803ded:	83 ec 0c             	sub    $0xc,%esp
+  803df0:	6a 05                	push   $0x5
+  803df2:	68 00 00 40 00       	push   $0x400000
+  803df7:	6a 00                	push   $0x0
+  803df9:	68 00 b0 ad de       	push   $0xdeadb000
+  803dfe:	53                   	push   %ebx
+  803dff:	e8 21 d0 ff ff       	call   800e25 <sys_page_map>
+  803e04:	83 c4 20             	add    $0x20,%esp
+  803e07:	85 c0                	test   %eax,%eax
+  803e09:	0f 88 89 00 00 00    	js     803e98 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803e0f:	89 f8                	mov    %edi,%eax
+  803e11:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803e14:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803e1b:	a8 01                	test   $0x1,%al
+  803e1d:	74 6f                	je     803e8e <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803e1f:	83 ec 0c             	sub    $0xc,%esp
+  803e22:	6a 05                	push   $0x5
+  803e24:	68 00 00 40 00       	push   $0x400000
+  803e29:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803e2b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803e30:	50                   	push   %eax
+  803e31:	53                   	push   %ebx
+  803e32:	e8 ee cf ff ff       	call   800e25 <sys_page_map>
+  803e37:	83 c4 20             	add    $0x20,%esp
+  803e3a:	85 c0                	test   %eax,%eax
+  803e3c:	78 6f                	js     803ead <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803e3e:	c1 ef 0c             	shr    $0xc,%edi
+  803e41:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803e47:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803e4e:	01 
+  803e4f:	74 3d                	je     803e8e <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803e51:	83 ec 08             	sub    $0x8,%esp
+  803e54:	68 00 00 40 00       	push   $0x400000
+  803e59:	6a 00                	push   $0x0
+  803e5b:	e8 07 d0 ff ff       	call   800e67 <sys_page_unmap>
+  803e60:	83 c4 10             	add    $0x10,%esp
+  803e63:	85 c0                	test   %eax,%eax
+  803e65:	78 5b                	js     803ec2 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803e67:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803e6e:	c1 e8 0c             	shr    $0xc,%eax
+  803e71:	e8 79 ed ff ff       	call   802bef <page_remove_slot>
+	return r;
+  803e76:	eb 16                	jmp    803e8e <page_unmap+0xe9>
+		page_forget(va);
+  803e78:	89 f8                	mov    %edi,%eax
+  803e7a:	e8 9b fe ff ff       	call   803d1a <page_forget>
+		return sys_page_unmap(envid, va);
+  803e7f:	83 ec 08             	sub    $0x8,%esp
+  803e82:	57                   	push   %edi
+  803e83:	53                   	push   %ebx
+  803e84:	e8 de cf ff ff       	call   800e67 <sys_page_unmap>
+  803e89:	89 c6                	mov    %eax,%esi
+  803e8b:	83 c4 10             	add    $0x10,%esp
+}
+  803e8e:	89 f0                	mov    %esi,%eax
+  803e90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e93:	5b                   	pop    %ebx
+  803e94:	5e                   	pop    %esi
+  803e95:	5f                   	pop    %edi
+  803e96:	5d                   	pop    %ebp
+  803e97:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803e98:	50                   	push   %eax
+  803e99:	68 58 5e 80 00       	push   $0x805e58
+  803e9e:	68 e4 03 00 00       	push   $0x3e4
+  803ea3:	68 10 5b 80 00       	push   $0x805b10
+  803ea8:	e8 80 c3 ff ff       	call   80022d <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803ead:	50                   	push   %eax
+  803eae:	68 84 5e 80 00       	push   $0x805e84
+  803eb3:	68 ea 03 00 00       	push   $0x3ea
+  803eb8:	68 10 5b 80 00       	push   $0x805b10
+  803ebd:	e8 6b c3 ff ff       	call   80022d <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803ec2:	50                   	push   %eax
+  803ec3:	68 b0 5e 80 00       	push   $0x805eb0
+  803ec8:	68 ef 03 00 00       	push   $0x3ef
+  803ecd:	68 10 5b 80 00       	push   $0x805b10
+  803ed2:	e8 56 c3 ff ff       	call   80022d <_panic>
+
+00803ed7 <page_unmap_range>:
+{
+  803ed7:	55                   	push   %ebp
+  803ed8:	89 e5                	mov    %esp,%ebp
+  803eda:	57                   	push   %edi
+  803edb:	56                   	push   %esi
+  803edc:	53                   	push   %ebx
+  803edd:	83 ec 0c             	sub    $0xc,%esp
+  803ee0:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803ee3:	e8 8a ed ff ff       	call   802c72 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803ee8:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  803eed:	8b 40 48             	mov    0x48(%eax),%eax
+  803ef0:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803ef4:	7e 38                	jle    803f2e <page_unmap_range+0x57>
+  803ef6:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803ef9:	74 33                	je     803f2e <page_unmap_range+0x57>
+  803efb:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803f02:	74 2a                	je     803f2e <page_unmap_range+0x57>
+  803f04:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  803f07:	be 00 00 00 00       	mov    $0x0,%esi
+  803f0c:	39 fe                	cmp    %edi,%esi
+  803f0e:	74 56                	je     803f66 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  803f10:	83 ec 08             	sub    $0x8,%esp
+  803f13:	53                   	push   %ebx
+  803f14:	ff 75 08             	push   0x8(%ebp)
+  803f17:	e8 89 fe ff ff       	call   803da5 <page_unmap>
+  803f1c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803f22:	83 c4 10             	add    $0x10,%esp
+  803f25:	85 c0                	test   %eax,%eax
+  803f27:	78 35                	js     803f5e <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  803f29:	83 c6 01             	add    $0x1,%esi
+  803f2c:	eb de                	jmp    803f0c <page_unmap_range+0x35>
+  803f2e:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803f31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f36:	eb 10                	jmp    803f48 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803f38:	89 f0                	mov    %esi,%eax
+  803f3a:	e8 db fd ff ff       	call   803d1a <page_forget>
+		for (i = 0; i < npages; i++)
+  803f3f:	83 c3 01             	add    $0x1,%ebx
+  803f42:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803f48:	39 fb                	cmp    %edi,%ebx
+  803f4a:	75 ec                	jne    803f38 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  803f4c:	83 ec 04             	sub    $0x4,%esp
+  803f4f:	57                   	push   %edi
+  803f50:	ff 75 0c             	push   0xc(%ebp)
+  803f53:	ff 75 08             	push   0x8(%ebp)
+  803f56:	e8 20 d0 ff ff       	call   800f7b <sys_page_unmap_range>
+  803f5b:	83 c4 10             	add    $0x10,%esp
+}
+  803f5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f61:	5b                   	pop    %ebx
+  803f62:	5e                   	pop    %esi
+  803f63:	5f                   	pop    %edi
+  803f64:	5d                   	pop    %ebp
+  803f65:	c3                   	ret
+	return 0;
+  803f66:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f6b:	eb f1                	jmp    803f5e <page_unmap_range+0x87>
+
+00803f6d <page_alloc_range>:
+{
+  803f6d:	55                   	push   %ebp
+  803f6e:	89 e5                	mov    %esp,%ebp
+  803f70:	57                   	push   %edi
+  803f71:	56                   	push   %esi
+  803f72:	53                   	push   %ebx
+  803f73:	83 ec 1c             	sub    $0x1c,%esp
+  803f76:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803f79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  803f7c:	83 3d 20 fd 80 00 00 	cmpl   $0x0,0x80fd20
+  803f83:	74 14                	je     803f99 <page_alloc_range+0x2c>
+	if (check_mte)
+  803f85:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803f89:	74 66                	je     803ff1 <page_alloc_range+0x84>
+  803f8b:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  803f8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f92:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803f95:	89 c7                	mov    %eax,%edi
+  803f97:	eb 10                	jmp    803fa9 <page_alloc_range+0x3c>
+		init_map_dir();
+  803f99:	e8 e6 f8 ff ff       	call   803884 <init_map_dir>
+  803f9e:	eb e5                	jmp    803f85 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803fa0:	83 c7 01             	add    $0x1,%edi
+  803fa3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803fa9:	39 df                	cmp    %ebx,%edi
+  803fab:	74 38                	je     803fe5 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  803fad:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803fb0:	83 ec 08             	sub    $0x8,%esp
+  803fb3:	6a 00                	push   $0x0
+  803fb5:	56                   	push   %esi
+  803fb6:	e8 1f f9 ff ff       	call   8038da <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  803fbb:	83 c4 10             	add    $0x10,%esp
+  803fbe:	85 c0                	test   %eax,%eax
+  803fc0:	74 de                	je     803fa0 <page_alloc_range+0x33>
+  803fc2:	8b 10                	mov    (%eax),%edx
+  803fc4:	f6 c2 01             	test   $0x1,%dl
+  803fc7:	74 d7                	je     803fa0 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  803fc9:	83 ec 08             	sub    $0x8,%esp
+  803fcc:	ff 75 e4             	push   -0x1c(%ebp)
+  803fcf:	52                   	push   %edx
+  803fd0:	50                   	push   %eax
+  803fd1:	68 1c 5e 80 00       	push   $0x805e1c
+  803fd6:	68 0b 04 00 00       	push   $0x40b
+  803fdb:	68 10 5b 80 00       	push   $0x805b10
+  803fe0:	e8 48 c2 ff ff       	call   80022d <_panic>
+  803fe5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803fe8:	eb 07                	jmp    803ff1 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  803fea:	c1 e0 0c             	shl    $0xc,%eax
+  803fed:	01 c7                	add    %eax,%edi
+			npages -= r;
+  803fef:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  803ff1:	85 db                	test   %ebx,%ebx
+  803ff3:	74 30                	je     804025 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  803ff5:	ff 75 14             	push   0x14(%ebp)
+  803ff8:	53                   	push   %ebx
+  803ff9:	57                   	push   %edi
+  803ffa:	ff 75 08             	push   0x8(%ebp)
+  803ffd:	e8 0b cf ff ff       	call   800f0d <sys_page_alloc_range>
+  804002:	89 c6                	mov    %eax,%esi
+  804004:	83 c4 10             	add    $0x10,%esp
+  804007:	85 c0                	test   %eax,%eax
+  804009:	7f df                	jg     803fea <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  80400b:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  80400e:	75 1a                	jne    80402a <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  804010:	83 ec 08             	sub    $0x8,%esp
+  804013:	57                   	push   %edi
+  804014:	ff 75 08             	push   0x8(%ebp)
+  804017:	e8 68 f9 ff ff       	call   803984 <page_out>
+  80401c:	83 c4 10             	add    $0x10,%esp
+  80401f:	85 c0                	test   %eax,%eax
+  804021:	79 ce                	jns    803ff1 <page_alloc_range+0x84>
+  804023:	eb 05                	jmp    80402a <page_alloc_range+0xbd>
+	return 0;
+  804025:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  80402a:	89 f0                	mov    %esi,%eax
+  80402c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80402f:	5b                   	pop    %ebx
+  804030:	5e                   	pop    %esi
+  804031:	5f                   	pop    %edi
+  804032:	5d                   	pop    %ebp
+  804033:	c3                   	ret
+
+00804034 <page_in>:
+{
+  804034:	55                   	push   %ebp
+  804035:	89 e5                	mov    %esp,%ebp
+  804037:	57                   	push   %edi
+  804038:	56                   	push   %esi
+  804039:	53                   	push   %ebx
+  80403a:	83 ec 3c             	sub    $0x3c,%esp
+  80403d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  804040:	e8 2d ec ff ff       	call   802c72 <find_paging_env>
+	if (pagingenv == 0)
+  804045:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  80404c:	0f 84 09 02 00 00    	je     80425b <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  804052:	83 ec 08             	sub    $0x8,%esp
+  804055:	6a 00                	push   $0x0
+  804057:	56                   	push   %esi
+  804058:	e8 7d f8 ff ff       	call   8038da <umapdir_walk>
+  80405d:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80405f:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  804065:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  804068:	83 c4 10             	add    $0x10,%esp
+  80406b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80406f:	74 0d                	je     80407e <page_in+0x4a>
+  804071:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  804076:	8b 40 48             	mov    0x48(%eax),%eax
+  804079:	3b 45 08             	cmp    0x8(%ebp),%eax
+  80407c:	75 06                	jne    804084 <page_in+0x50>
+  80407e:	8b 03                	mov    (%ebx),%eax
+  804080:	a8 02                	test   $0x2,%al
+  804082:	75 63                	jne    8040e7 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  804084:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  804086:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804088:	89 f0                	mov    %esi,%eax
+  80408a:	25 06 0e 00 00       	and    $0xe06,%eax
+  80408f:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  804092:	50                   	push   %eax
+  804093:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804096:	57                   	push   %edi
+  804097:	ff 75 08             	push   0x8(%ebp)
+  80409a:	e8 65 fb ff ff       	call   803c04 <page_alloc>
+  80409f:	83 c4 10             	add    $0x10,%esp
+  8040a2:	85 c0                	test   %eax,%eax
+  8040a4:	78 39                	js     8040df <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  8040a6:	89 f0                	mov    %esi,%eax
+  8040a8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8040ab:	83 ec 0c             	sub    $0xc,%esp
+  8040ae:	6a 07                	push   $0x7
+  8040b0:	6a 01                	push   $0x1
+  8040b2:	57                   	push   %edi
+  8040b3:	c1 e0 04             	shl    $0x4,%eax
+  8040b6:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8040b7:	c1 ee 1c             	shr    $0x1c,%esi
+  8040ba:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8040bd:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  8040c4:	e8 f1 0f 00 00       	call   8050ba <ipc_call>
+  8040c9:	83 c4 20             	add    $0x20,%esp
+  8040cc:	85 c0                	test   %eax,%eax
+  8040ce:	0f 88 72 01 00 00    	js     804246 <page_in+0x212>
+	*mte = 0;
+  8040d4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  8040da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040e2:	5b                   	pop    %ebx
+  8040e3:	5e                   	pop    %esi
+  8040e4:	5f                   	pop    %edi
+  8040e5:	5d                   	pop    %ebp
+  8040e6:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  8040e7:	25 06 0e 00 00       	and    $0xe06,%eax
+  8040ec:	83 c8 01             	or     $0x1,%eax
+  8040ef:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  8040f2:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  8040f5:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8040f8:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  8040fe:	be 01 00 00 00       	mov    $0x1,%esi
+  804103:	eb 46                	jmp    80414b <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  804105:	83 ec 08             	sub    $0x8,%esp
+  804108:	6a 00                	push   $0x0
+  80410a:	51                   	push   %ecx
+  80410b:	e8 ca f7 ff ff       	call   8038da <umapdir_walk>
+  804110:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  804114:	83 c4 10             	add    $0x10,%esp
+  804117:	85 c0                	test   %eax,%eax
+  804119:	74 66                	je     804181 <page_in+0x14d>
+  80411b:	8b 00                	mov    (%eax),%eax
+  80411d:	a8 01                	test   $0x1,%al
+  80411f:	74 60                	je     804181 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  804121:	89 c2                	mov    %eax,%edx
+  804123:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  804129:	83 ca 01             	or     $0x1,%edx
+  80412c:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  80412f:	75 50                	jne    804181 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  804131:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804137:	c1 e8 1c             	shr    $0x1c,%eax
+  80413a:	8b 13                	mov    (%ebx),%edx
+  80413c:	c1 ea 1c             	shr    $0x1c,%edx
+  80413f:	39 d0                	cmp    %edx,%eax
+  804141:	75 3e                	jne    804181 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804143:	83 c6 01             	add    $0x1,%esi
+  804146:	83 fe 08             	cmp    $0x8,%esi
+  804149:	74 3f                	je     80418a <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  80414b:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  80414d:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  804153:	77 2c                	ja     804181 <page_in+0x14d>
+  804155:	89 f8                	mov    %edi,%eax
+  804157:	c1 e8 16             	shr    $0x16,%eax
+  80415a:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  804161:	f6 c2 01             	test   $0x1,%dl
+  804164:	74 9f                	je     804105 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804166:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  80416d:	a8 80                	test   $0x80,%al
+  80416f:	75 10                	jne    804181 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804171:	89 f8                	mov    %edi,%eax
+  804173:	c1 e8 0c             	shr    $0xc,%eax
+  804176:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80417d:	a8 01                	test   $0x1,%al
+  80417f:	74 84                	je     804105 <page_in+0xd1>
+	if (n == 1)
+  804181:	83 fe 01             	cmp    $0x1,%esi
+  804184:	0f 84 fa fe ff ff    	je     804084 <page_in+0x50>
+	req.nslots = n;
+  80418a:	89 35 00 90 80 00    	mov    %esi,0x809000
+	for (i = 0; i < n; i++)
+  804190:	b8 00 00 00 00       	mov    $0x0,%eax
+  804195:	eb 13                	jmp    8041aa <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  804197:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  80419b:	8b 12                	mov    (%edx),%edx
+  80419d:	c1 ea 0c             	shr    $0xc,%edx
+  8041a0:	89 14 85 04 90 80 00 	mov    %edx,0x809004(,%eax,4)
+	for (i = 0; i < n; i++)
+  8041a7:	83 c0 01             	add    $0x1,%eax
+  8041aa:	39 c6                	cmp    %eax,%esi
+  8041ac:	75 e9                	jne    804197 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  8041ae:	83 ec 0c             	sub    $0xc,%esp
+  8041b1:	6a 00                	push   $0x0
+  8041b3:	ff 75 c0             	push   -0x40(%ebp)
+  8041b6:	56                   	push   %esi
+  8041b7:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  8041ba:	57                   	push   %edi
+  8041bb:	6a 00                	push   $0x0
+  8041bd:	e8 ab fd ff ff       	call   803f6d <page_alloc_range>
+  8041c2:	83 c4 20             	add    $0x20,%esp
+  8041c5:	85 c0                	test   %eax,%eax
+  8041c7:	78 6e                	js     804237 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  8041c9:	83 ec 04             	sub    $0x4,%esp
+  8041cc:	6a 24                	push   $0x24
+  8041ce:	68 00 90 80 00       	push   $0x809000
+  8041d3:	57                   	push   %edi
+  8041d4:	e8 9c c8 ff ff       	call   800a75 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  8041d9:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8041e0:	56                   	push   %esi
+  8041e1:	57                   	push   %edi
+  8041e2:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8041e4:	0f b7 05 06 90 80 00 	movzwl 0x809006,%eax
+  8041eb:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  8041ee:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  8041f5:	e8 c0 0e 00 00       	call   8050ba <ipc_call>
+  8041fa:	83 c4 20             	add    $0x20,%esp
+  8041fd:	85 c0                	test   %eax,%eax
+  8041ff:	78 08                	js     804209 <page_in+0x1d5>
+  804201:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  804204:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  804207:	eb 20                	jmp    804229 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  804209:	50                   	push   %eax
+  80420a:	68 dc 5e 80 00       	push   $0x805edc
+  80420f:	68 59 02 00 00       	push   $0x259
+  804214:	68 10 5b 80 00       	push   $0x805b10
+  804219:	e8 0f c0 ff ff       	call   80022d <_panic>
+		*mtes[i] = 0;
+  80421e:	8b 10                	mov    (%eax),%edx
+  804220:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  804226:	83 c0 04             	add    $0x4,%eax
+  804229:	39 c8                	cmp    %ecx,%eax
+  80422b:	75 f1                	jne    80421e <page_in+0x1ea>
+	return n;
+  80422d:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  80422f:	85 f6                	test   %esi,%esi
+  804231:	0f 84 4d fe ff ff    	je     804084 <page_in+0x50>
+		return r < 0 ? r : 0;
+  804237:	85 c0                	test   %eax,%eax
+  804239:	ba 00 00 00 00       	mov    $0x0,%edx
+  80423e:	0f 4f c2             	cmovg  %edx,%eax
+  804241:	e9 99 fe ff ff       	jmp    8040df <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  804246:	50                   	push   %eax
+  804247:	68 14 5f 80 00       	push   $0x805f14
+  80424c:	68 9a 02 00 00       	push   $0x29a
+  804251:	68 10 5b 80 00       	push   $0x805b10
+  804256:	e8 d2 bf ff ff       	call   80022d <_panic>
+		return -E_PAGING;
+  80425b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804260:	e9 7a fe ff ff       	jmp    8040df <page_in+0xab>
+
+00804265 <page_map>:
+{
+  804265:	55                   	push   %ebp
+  804266:	89 e5                	mov    %esp,%ebp
+  804268:	57                   	push   %edi
+  804269:	56                   	push   %esi
+  80426a:	53                   	push   %ebx
+  80426b:	83 ec 1c             	sub    $0x1c,%esp
+  80426e:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  804271:	83 ec 0c             	sub    $0xc,%esp
+  804274:	ff 75 18             	push   0x18(%ebp)
+  804277:	ff 75 14             	push   0x14(%ebp)
+  80427a:	ff 75 10             	push   0x10(%ebp)
+  80427d:	ff 75 0c             	push   0xc(%ebp)
+  804280:	56                   	push   %esi
+  804281:	e8 9f cb ff ff       	call   800e25 <sys_page_map>
+  804286:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804289:	83 c4 20             	add    $0x20,%esp
+  80428c:	85 c0                	test   %eax,%eax
+  80428e:	0f 89 a9 01 00 00    	jns    80443d <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  804294:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  804298:	74 5f                	je     8042f9 <page_map+0x94>
+		if (r != -E_INVAL)
+  80429a:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  80429e:	0f 85 a0 01 00 00    	jne    804444 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8042a4:	85 f6                	test   %esi,%esi
+  8042a6:	74 70                	je     804318 <page_map+0xb3>
+  8042a8:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  8042ad:	8b 40 48             	mov    0x48(%eax),%eax
+  8042b0:	39 f0                	cmp    %esi,%eax
+  8042b2:	74 64                	je     804318 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8042b4:	83 ec 0c             	sub    $0xc,%esp
+  8042b7:	6a 05                	push   $0x5
+  8042b9:	68 00 00 40 00       	push   $0x400000
+  8042be:	6a 00                	push   $0x0
+  8042c0:	68 00 b0 ad de       	push   $0xdeadb000
+  8042c5:	56                   	push   %esi
+  8042c6:	e8 5a cb ff ff       	call   800e25 <sys_page_map>
+  8042cb:	89 c3                	mov    %eax,%ebx
+  8042cd:	83 c4 20             	add    $0x20,%esp
+  8042d0:	85 c0                	test   %eax,%eax
+  8042d2:	79 6a                	jns    80433e <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  8042d4:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8042d7:	75 50                	jne    804329 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  8042d9:	83 ec 08             	sub    $0x8,%esp
+  8042dc:	68 00 00 40 00       	push   $0x400000
+  8042e1:	6a fc                	push   $0xfffffffc
+  8042e3:	e8 9c f6 ff ff       	call   803984 <page_out>
+  8042e8:	83 c4 10             	add    $0x10,%esp
+  8042eb:	85 c0                	test   %eax,%eax
+  8042ed:	79 c5                	jns    8042b4 <page_map+0x4f>
+}
+  8042ef:	89 d8                	mov    %ebx,%eax
+  8042f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042f4:	5b                   	pop    %ebx
+  8042f5:	5e                   	pop    %esi
+  8042f6:	5f                   	pop    %edi
+  8042f7:	5d                   	pop    %ebp
+  8042f8:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  8042f9:	83 ec 08             	sub    $0x8,%esp
+  8042fc:	68 00 00 40 00       	push   $0x400000
+  804301:	6a 00                	push   $0x0
+  804303:	e8 7c f6 ff ff       	call   803984 <page_out>
+  804308:	83 c4 10             	add    $0x10,%esp
+  80430b:	85 c0                	test   %eax,%eax
+  80430d:	0f 89 5e ff ff ff    	jns    804271 <page_map+0xc>
+				return r;
+  804313:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804316:	eb d7                	jmp    8042ef <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804318:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80431b:	e8 79 f9 ff ff       	call   803c99 <page_adopt>
+  804320:	85 c0                	test   %eax,%eax
+  804322:	79 90                	jns    8042b4 <page_map+0x4f>
+			return r;
+  804324:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804327:	eb c6                	jmp    8042ef <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  804329:	53                   	push   %ebx
+  80432a:	68 48 5f 80 00       	push   $0x805f48
+  80432f:	68 77 03 00 00       	push   $0x377
+  804334:	68 10 5b 80 00       	push   $0x805b10
+  804339:	e8 ef be ff ff       	call   80022d <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  80433e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804341:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  804344:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  80434b:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  804351:	0f 84 f5 00 00 00    	je     80444c <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  804357:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80435d:	83 ec 0c             	sub    $0xc,%esp
+  804360:	6a 05                	push   $0x5
+  804362:	68 00 00 40 00       	push   $0x400000
+  804367:	6a 00                	push   $0x0
+  804369:	57                   	push   %edi
+  80436a:	56                   	push   %esi
+  80436b:	e8 b5 ca ff ff       	call   800e25 <sys_page_map>
+  804370:	89 c3                	mov    %eax,%ebx
+  804372:	83 c4 20             	add    $0x20,%esp
+  804375:	85 c0                	test   %eax,%eax
+  804377:	79 35                	jns    8043ae <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  804379:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80437c:	75 1b                	jne    804399 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  80437e:	83 ec 08             	sub    $0x8,%esp
+  804381:	68 00 00 40 00       	push   $0x400000
+  804386:	6a 00                	push   $0x0
+  804388:	e8 f7 f5 ff ff       	call   803984 <page_out>
+  80438d:	83 c4 10             	add    $0x10,%esp
+  804390:	85 c0                	test   %eax,%eax
+  804392:	79 c9                	jns    80435d <page_map+0xf8>
+  804394:	e9 56 ff ff ff       	jmp    8042ef <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  804399:	53                   	push   %ebx
+  80439a:	68 70 5f 80 00       	push   $0x805f70
+  80439f:	68 83 03 00 00       	push   $0x383
+  8043a4:	68 10 5b 80 00       	push   $0x805b10
+  8043a9:	e8 7f be ff ff       	call   80022d <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  8043ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8043b1:	c1 e8 0c             	shr    $0xc,%eax
+  8043b4:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8043b9:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  8043c0:	01 
+  8043c1:	0f 84 8d 00 00 00    	je     804454 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  8043c7:	83 ec 08             	sub    $0x8,%esp
+  8043ca:	68 00 00 40 00       	push   $0x400000
+  8043cf:	6a 00                	push   $0x0
+  8043d1:	e8 91 ca ff ff       	call   800e67 <sys_page_unmap>
+  8043d6:	83 c4 10             	add    $0x10,%esp
+  8043d9:	85 c0                	test   %eax,%eax
+  8043db:	78 36                	js     804413 <page_map+0x1ae>
+  8043dd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  8043e0:	83 ec 08             	sub    $0x8,%esp
+  8043e3:	57                   	push   %edi
+  8043e4:	56                   	push   %esi
+  8043e5:	e8 4a fc ff ff       	call   804034 <page_in>
+  8043ea:	89 c3                	mov    %eax,%ebx
+  8043ec:	83 c4 10             	add    $0x10,%esp
+  8043ef:	85 c0                	test   %eax,%eax
+  8043f1:	0f 89 7a fe ff ff    	jns    804271 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  8043f7:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8043fa:	75 2c                	jne    804428 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  8043fc:	83 ec 08             	sub    $0x8,%esp
+  8043ff:	57                   	push   %edi
+  804400:	6a 00                	push   $0x0
+  804402:	e8 7d f5 ff ff       	call   803984 <page_out>
+  804407:	83 c4 10             	add    $0x10,%esp
+  80440a:	85 c0                	test   %eax,%eax
+  80440c:	79 d2                	jns    8043e0 <page_map+0x17b>
+  80440e:	e9 dc fe ff ff       	jmp    8042ef <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  804413:	50                   	push   %eax
+  804414:	68 9c 5f 80 00       	push   $0x805f9c
+  804419:	68 8b 03 00 00       	push   $0x38b
+  80441e:	68 10 5b 80 00       	push   $0x805b10
+  804423:	e8 05 be ff ff       	call   80022d <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  804428:	53                   	push   %ebx
+  804429:	68 c4 5f 80 00       	push   $0x805fc4
+  80442e:	68 91 03 00 00       	push   $0x391
+  804433:	68 10 5b 80 00       	push   $0x805b10
+  804438:	e8 f0 bd ff ff       	call   80022d <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  80443d:	89 c3                	mov    %eax,%ebx
+  80443f:	e9 ab fe ff ff       	jmp    8042ef <page_map+0x8a>
+  804444:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804447:	e9 a3 fe ff ff       	jmp    8042ef <page_map+0x8a>
+			return r; // Pass through the error
+  80444c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80444f:	e9 9b fe ff ff       	jmp    8042ef <page_map+0x8a>
+			return r; // Pass through the error
+  804454:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804457:	e9 93 fe ff ff       	jmp    8042ef <page_map+0x8a>
+
+0080445c <page_map_range>:
+{
+  80445c:	55                   	push   %ebp
+  80445d:	89 e5                	mov    %esp,%ebp
+  80445f:	57                   	push   %edi
+  804460:	56                   	push   %esi
+  804461:	53                   	push   %ebx
+  804462:	83 ec 0c             	sub    $0xc,%esp
+  804465:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804468:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  80446b:	83 ec 08             	sub    $0x8,%esp
+  80446e:	ff 75 1c             	push   0x1c(%ebp)
+  804471:	ff 75 18             	push   0x18(%ebp)
+  804474:	56                   	push   %esi
+  804475:	ff 75 10             	push   0x10(%ebp)
+  804478:	57                   	push   %edi
+  804479:	ff 75 08             	push   0x8(%ebp)
+  80447c:	e8 af ca ff ff       	call   800f30 <sys_page_map_range>
+  804481:	89 c3                	mov    %eax,%ebx
+  804483:	83 c4 20             	add    $0x20,%esp
+  804486:	85 c0                	test   %eax,%eax
+  804488:	79 1b                	jns    8044a5 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  80448a:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80448d:	75 20                	jne    8044af <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  80448f:	83 ec 08             	sub    $0x8,%esp
+  804492:	68 00 00 40 00       	push   $0x400000
+  804497:	6a 00                	push   $0x0
+  804499:	e8 e6 f4 ff ff       	call   803984 <page_out>
+  80449e:	83 c4 10             	add    $0x10,%esp
+  8044a1:	85 c0                	test   %eax,%eax
+  8044a3:	79 c6                	jns    80446b <page_map_range+0xf>
+}
+  8044a5:	89 d8                	mov    %ebx,%eax
+  8044a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044aa:	5b                   	pop    %ebx
+  8044ab:	5e                   	pop    %esi
+  8044ac:	5f                   	pop    %edi
+  8044ad:	5d                   	pop    %ebp
+  8044ae:	c3                   	ret
+		if (r != -E_INVAL)
+  8044af:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  8044b2:	75 f1                	jne    8044a5 <page_map_range+0x49>
+  8044b4:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  8044b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8044bb:	eb 03                	jmp    8044c0 <page_map_range+0x64>
+  8044bd:	83 c6 01             	add    $0x1,%esi
+  8044c0:	3b 75 18             	cmp    0x18(%ebp),%esi
+  8044c3:	74 2a                	je     8044ef <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  8044c5:	83 ec 0c             	sub    $0xc,%esp
+  8044c8:	ff 75 1c             	push   0x1c(%ebp)
+  8044cb:	53                   	push   %ebx
+  8044cc:	ff 75 10             	push   0x10(%ebp)
+  8044cf:	57                   	push   %edi
+  8044d0:	ff 75 08             	push   0x8(%ebp)
+  8044d3:	e8 8d fd ff ff       	call   804265 <page_map>
+  8044d8:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8044de:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8044e4:	83 c4 20             	add    $0x20,%esp
+  8044e7:	85 c0                	test   %eax,%eax
+  8044e9:	79 d2                	jns    8044bd <page_map_range+0x61>
+  8044eb:	89 c3                	mov    %eax,%ebx
+  8044ed:	eb b6                	jmp    8044a5 <page_map_range+0x49>
+		return 0;
+  8044ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8044f4:	eb af                	jmp    8044a5 <page_map_range+0x49>
+
+008044f6 <paging_pgfault_handler>:
+{
+  8044f6:	55                   	push   %ebp
+  8044f7:	89 e5                	mov    %esp,%ebp
+  8044f9:	56                   	push   %esi
+  8044fa:	53                   	push   %ebx
+  8044fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  8044fe:	e8 6f e7 ff ff       	call   802c72 <find_paging_env>
+	if (pagingenv == 0)
+  804503:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  804508:	85 c0                	test   %eax,%eax
+  80450a:	74 3c                	je     804548 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  80450c:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  80450e:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804512:	75 12                	jne    804526 <paging_pgfault_handler+0x30>
+  804514:	89 f0                	mov    %esi,%eax
+  804516:	e8 7e f7 ff ff       	call   803c99 <page_adopt>
+  80451b:	89 c2                	mov    %eax,%edx
+		return 0;
+  80451d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804522:	85 d2                	test   %edx,%edx
+  804524:	78 22                	js     804548 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  804526:	83 ec 08             	sub    $0x8,%esp
+  804529:	6a 00                	push   $0x0
+  80452b:	56                   	push   %esi
+  80452c:	e8 a9 f3 ff ff       	call   8038da <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  804531:	83 c4 10             	add    $0x10,%esp
+  804534:	85 c0                	test   %eax,%eax
+  804536:	74 05                	je     80453d <paging_pgfault_handler+0x47>
+  804538:	f6 00 01             	testb  $0x1,(%eax)
+  80453b:	75 12                	jne    80454f <paging_pgfault_handler+0x59>
+	return 0;
+  80453d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804542:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804546:	74 23                	je     80456b <paging_pgfault_handler+0x75>
+}
+  804548:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80454b:	5b                   	pop    %ebx
+  80454c:	5e                   	pop    %esi
+  80454d:	5d                   	pop    %ebp
+  80454e:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  80454f:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  804554:	8b 40 48             	mov    0x48(%eax),%eax
+  804557:	83 ec 08             	sub    $0x8,%esp
+  80455a:	56                   	push   %esi
+  80455b:	50                   	push   %eax
+  80455c:	e8 d3 fa ff ff       	call   804034 <page_in>
+  804561:	f7 d0                	not    %eax
+  804563:	c1 e8 1f             	shr    $0x1f,%eax
+  804566:	83 c4 10             	add    $0x10,%esp
+  804569:	eb dd                	jmp    804548 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  80456b:	89 f0                	mov    %esi,%eax
+  80456d:	e8 97 e2 ff ff       	call   802809 <segment_lookup>
+  804572:	89 c2                	mov    %eax,%edx
+	return 0;
+  804574:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804579:	85 d2                	test   %edx,%edx
+  80457b:	74 cb                	je     804548 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  80457d:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  804582:	8b 40 48             	mov    0x48(%eax),%eax
+  804585:	83 ec 08             	sub    $0x8,%esp
+  804588:	56                   	push   %esi
+  804589:	50                   	push   %eax
+  80458a:	e8 f5 f3 ff ff       	call   803984 <page_out>
+  80458f:	f7 d0                	not    %eax
+  804591:	c1 e8 1f             	shr    $0x1f,%eax
+  804594:	83 c4 10             	add    $0x10,%esp
+  804597:	eb af                	jmp    804548 <paging_pgfault_handler+0x52>
+
+00804599 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  804599:	55                   	push   %ebp
+  80459a:	89 e5                	mov    %esp,%ebp
+  80459c:	57                   	push   %edi
+  80459d:	56                   	push   %esi
+  80459e:	53                   	push   %ebx
+  80459f:	83 ec 2c             	sub    $0x2c,%esp
+  8045a2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8045a5:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  8045aa:	89 c1                	mov    %eax,%ecx
+  8045ac:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  8045af:	c1 e8 11             	shr    $0x11,%eax
+  8045b2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8045b5:	8b 3c 85 80 dc 80 00 	mov    0x80dc80(,%eax,4),%edi
+  8045bc:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  8045bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8045c4:	d3 e0                	shl    %cl,%eax
+  8045c6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8045c9:	85 c7                	test   %eax,%edi
+  8045cb:	74 12                	je     8045df <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  8045cd:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8045d2:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  8045d5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8045da:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8045dd:	eb 17                	jmp    8045f6 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  8045df:	ff 75 e0             	push   -0x20(%ebp)
+  8045e2:	68 fc 5f 80 00       	push   $0x805ffc
+  8045e7:	6a 48                	push   $0x48
+  8045e9:	68 16 60 80 00       	push   $0x806016
+  8045ee:	e8 3a bc ff ff       	call   80022d <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  8045f3:	83 c3 01             	add    $0x1,%ebx
+  8045f6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8045f9:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  8045fc:	89 c8                	mov    %ecx,%eax
+  8045fe:	c1 e8 05             	shr    $0x5,%eax
+  804601:	8b 14 85 80 ce 80 00 	mov    0x80ce80(,%eax,4),%edx
+  804608:	89 fe                	mov    %edi,%esi
+  80460a:	d3 e6                	shl    %cl,%esi
+  80460c:	89 f1                	mov    %esi,%ecx
+  80460e:	85 d6                	test   %edx,%esi
+  804610:	74 e1                	je     8045f3 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  804612:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  804615:	f7 d6                	not    %esi
+  804617:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80461a:	21 fe                	and    %edi,%esi
+  80461c:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80461f:	89 34 bd 80 dc 80 00 	mov    %esi,0x80dc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  804626:	f7 d1                	not    %ecx
+  804628:	21 d1                	and    %edx,%ecx
+  80462a:	89 0c 85 80 ce 80 00 	mov    %ecx,0x80ce80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804631:	83 ec 04             	sub    $0x4,%esp
+  804634:	53                   	push   %ebx
+  804635:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804638:	57                   	push   %edi
+  804639:	6a 00                	push   $0x0
+  80463b:	e8 97 f8 ff ff       	call   803ed7 <page_unmap_range>
+	va_free(va, n);
+  804640:	83 c4 08             	add    $0x8,%esp
+  804643:	53                   	push   %ebx
+  804644:	57                   	push   %edi
+  804645:	e8 ed 05 00 00       	call   804c37 <va_free>
+}
+  80464a:	83 c4 10             	add    $0x10,%esp
+  80464d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804650:	5b                   	pop    %ebx
+  804651:	5e                   	pop    %esi
+  804652:	5f                   	pop    %edi
+  804653:	5d                   	pop    %ebp
+  804654:	c3                   	ret
+
+00804655 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  804655:	55                   	push   %ebp
+  804656:	89 e5                	mov    %esp,%ebp
+  804658:	57                   	push   %edi
+  804659:	56                   	push   %esi
+  80465a:	53                   	push   %ebx
+  80465b:	83 ec 1c             	sub    $0x1c,%esp
+  80465e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804661:	85 db                	test   %ebx,%ebx
+  804663:	74 34                	je     804699 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  804665:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80466b:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  804670:	77 2f                	ja     8046a1 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  804672:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  804678:	75 51                	jne    8046cb <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  80467a:	89 c1                	mov    %eax,%ecx
+  80467c:	c1 e9 0c             	shr    $0xc,%ecx
+  80467f:	ba 01 00 00 00       	mov    $0x1,%edx
+  804684:	d3 e2                	shl    %cl,%edx
+  804686:	c1 e8 11             	shr    $0x11,%eax
+  804689:	23 14 85 80 c0 80 00 	and    0x80c080(,%eax,4),%edx
+  804690:	75 24                	jne    8046b6 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  804692:	89 d8                	mov    %ebx,%eax
+  804694:	e8 00 ff ff ff       	call   804599 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  804699:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80469c:	5b                   	pop    %ebx
+  80469d:	5e                   	pop    %esi
+  80469e:	5f                   	pop    %edi
+  80469f:	5d                   	pop    %ebp
+  8046a0:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  8046a1:	53                   	push   %ebx
+  8046a2:	68 23 60 80 00       	push   $0x806023
+  8046a7:	68 a2 00 00 00       	push   $0xa2
+  8046ac:	68 16 60 80 00       	push   $0x806016
+  8046b1:	e8 77 bb ff ff       	call   80022d <_panic>
+			panic("free: %p is not allocated", va);
+  8046b6:	53                   	push   %ebx
+  8046b7:	68 fc 5f 80 00       	push   $0x805ffc
+  8046bc:	68 a5 00 00 00       	push   $0xa5
+  8046c1:	68 16 60 80 00       	push   $0x806016
+  8046c6:	e8 62 bb ff ff       	call   80022d <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  8046cb:	89 de                	mov    %ebx,%esi
+  8046cd:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  8046d3:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  8046d9:	89 c8                	mov    %ecx,%eax
+  8046db:	c1 e8 11             	shr    $0x11,%eax
+  8046de:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8046e1:	8b 3c 85 80 c0 80 00 	mov    0x80c080(,%eax,4),%edi
+  8046e8:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8046eb:	c1 e9 0c             	shr    $0xc,%ecx
+  8046ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8046f3:	d3 e0                	shl    %cl,%eax
+  8046f5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8046f8:	85 c7                	test   %eax,%edi
+  8046fa:	74 1b                	je     804717 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  8046fc:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804700:	89 d8                	mov    %ebx,%eax
+  804702:	29 f0                	sub    %esi,%eax
+  804704:	83 e8 10             	sub    $0x10,%eax
+  804707:	99                   	cltd
+  804708:	f7 ff                	idiv   %edi
+  80470a:	89 d1                	mov    %edx,%ecx
+  80470c:	85 d2                	test   %edx,%edx
+  80470e:	75 07                	jne    804717 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804710:	ba 10 00 00 00       	mov    $0x10,%edx
+  804715:	eb 18                	jmp    80472f <free+0xda>
+		panic("free: %p is not allocated", va);
+  804717:	53                   	push   %ebx
+  804718:	68 fc 5f 80 00       	push   $0x805ffc
+  80471d:	68 ad 00 00 00       	push   $0xad
+  804722:	68 16 60 80 00       	push   $0x806016
+  804727:	e8 01 bb ff ff       	call   80022d <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  80472c:	83 c1 01             	add    $0x1,%ecx
+  80472f:	89 d0                	mov    %edx,%eax
+  804731:	d3 e0                	shl    %cl,%eax
+  804733:	39 c7                	cmp    %eax,%edi
+  804735:	7f f5                	jg     80472c <free+0xd7>
+	*(void **) va = s->free;
+  804737:	8b 46 08             	mov    0x8(%esi),%eax
+  80473a:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  80473c:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  80473f:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  804743:	8d 58 01             	lea    0x1(%eax),%ebx
+  804746:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  80474a:	66 85 c0             	test   %ax,%ax
+  80474d:	74 52                	je     8047a1 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  80474f:	0f b7 db             	movzwl %bx,%ebx
+  804752:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804756:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80475b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804760:	f7 ff                	idiv   %edi
+  804762:	39 c3                	cmp    %eax,%ebx
+  804764:	0f 85 2f ff ff ff    	jne    804699 <free+0x44>
+  80476a:	8b 46 04             	mov    0x4(%esi),%eax
+  80476d:	85 c0                	test   %eax,%eax
+  80476f:	74 53                	je     8047c4 <free+0x16f>
+		s->prev->next = s->next;
+  804771:	8b 16                	mov    (%esi),%edx
+  804773:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804775:	8b 06                	mov    (%esi),%eax
+  804777:	85 c0                	test   %eax,%eax
+  804779:	74 06                	je     804781 <free+0x12c>
+		s->next->prev = s->prev;
+  80477b:	8b 56 04             	mov    0x4(%esi),%edx
+  80477e:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804781:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804784:	f7 d0                	not    %eax
+  804786:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804789:	21 d0                	and    %edx,%eax
+  80478b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80478e:	89 04 95 80 c0 80 00 	mov    %eax,0x80c080(,%edx,4)
+		heap_free_pages(s);
+  804795:	89 f0                	mov    %esi,%eax
+  804797:	e8 fd fd ff ff       	call   804599 <heap_free_pages>
+  80479c:	e9 f8 fe ff ff       	jmp    804699 <free+0x44>
+	s->prev = NULL;
+  8047a1:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  8047a8:	8b 04 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%eax
+  8047af:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  8047b1:	85 c0                	test   %eax,%eax
+  8047b3:	74 03                	je     8047b8 <free+0x163>
+		slabs[c]->prev = s;
+  8047b5:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  8047b8:	89 34 8d 60 c0 80 00 	mov    %esi,0x80c060(,%ecx,4)
+}
+  8047bf:	e9 d5 fe ff ff       	jmp    804699 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8047c4:	8b 06                	mov    (%esi),%eax
+  8047c6:	85 c0                	test   %eax,%eax
+  8047c8:	0f 84 cb fe ff ff    	je     804699 <free+0x44>
+		slabs[c] = s->next;
+  8047ce:	89 04 8d 60 c0 80 00 	mov    %eax,0x80c060(,%ecx,4)
+	if (s->next)
+  8047d5:	8b 06                	mov    (%esi),%eax
+  8047d7:	eb a2                	jmp    80477b <free+0x126>
+
+008047d9 <heap_alloc_pages>:
+{
+  8047d9:	55                   	push   %ebp
+  8047da:	89 e5                	mov    %esp,%ebp
+  8047dc:	57                   	push   %edi
+  8047dd:	56                   	push   %esi
+  8047de:	53                   	push   %ebx
+  8047df:	83 ec 18             	sub    $0x18,%esp
+  8047e2:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  8047e4:	50                   	push   %eax
+  8047e5:	e8 15 03 00 00       	call   804aff <va_alloc>
+  8047ea:	89 c3                	mov    %eax,%ebx
+  8047ec:	83 c4 10             	add    $0x10,%esp
+  8047ef:	85 c0                	test   %eax,%eax
+  8047f1:	74 47                	je     80483a <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8047f3:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  8047f9:	89 c1                	mov    %eax,%ecx
+  8047fb:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  8047fe:	c1 e8 11             	shr    $0x11,%eax
+  804801:	ba 01 00 00 00       	mov    $0x1,%edx
+  804806:	89 d7                	mov    %edx,%edi
+  804808:	d3 e7                	shl    %cl,%edi
+  80480a:	09 3c 85 80 dc 80 00 	or     %edi,0x80dc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  804811:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  804815:	89 c8                	mov    %ecx,%eax
+  804817:	c1 e8 05             	shr    $0x5,%eax
+  80481a:	d3 e2                	shl    %cl,%edx
+  80481c:	09 14 85 80 ce 80 00 	or     %edx,0x80ce80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  804823:	83 ec 0c             	sub    $0xc,%esp
+  804826:	6a 00                	push   $0x0
+  804828:	6a 07                	push   $0x7
+  80482a:	56                   	push   %esi
+  80482b:	53                   	push   %ebx
+  80482c:	6a 00                	push   $0x0
+  80482e:	e8 3a f7 ff ff       	call   803f6d <page_alloc_range>
+  804833:	83 c4 20             	add    $0x20,%esp
+  804836:	85 c0                	test   %eax,%eax
+  804838:	78 0a                	js     804844 <heap_alloc_pages+0x6b>
+}
+  80483a:	89 d8                	mov    %ebx,%eax
+  80483c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80483f:	5b                   	pop    %ebx
+  804840:	5e                   	pop    %esi
+  804841:	5f                   	pop    %edi
+  804842:	5d                   	pop    %ebp
+  804843:	c3                   	ret
+		free(va);
+  804844:	83 ec 0c             	sub    $0xc,%esp
+  804847:	53                   	push   %ebx
+  804848:	e8 08 fe ff ff       	call   804655 <free>
+		return NULL;
+  80484d:	83 c4 10             	add    $0x10,%esp
+  804850:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804855:	eb e3                	jmp    80483a <heap_alloc_pages+0x61>
+
+00804857 <malloc>:
+{
+  804857:	55                   	push   %ebp
+  804858:	89 e5                	mov    %esp,%ebp
+  80485a:	57                   	push   %edi
+  80485b:	56                   	push   %esi
+  80485c:	53                   	push   %ebx
+  80485d:	83 ec 1c             	sub    $0x1c,%esp
+  804860:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804863:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804866:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  80486c:	0f 87 21 01 00 00    	ja     804993 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804872:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804877:	ba 10 00 00 00       	mov    $0x10,%edx
+  80487c:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  80487e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804883:	76 15                	jbe    80489a <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804885:	05 ff 0f 00 00       	add    $0xfff,%eax
+  80488a:	c1 e8 0c             	shr    $0xc,%eax
+  80488d:	e8 47 ff ff ff       	call   8047d9 <heap_alloc_pages>
+  804892:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804895:	eb 37                	jmp    8048ce <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804897:	83 c1 01             	add    $0x1,%ecx
+  80489a:	89 d6                	mov    %edx,%esi
+  80489c:	d3 e6                	shl    %cl,%esi
+  80489e:	39 c6                	cmp    %eax,%esi
+  8048a0:	72 f5                	jb     804897 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  8048a2:	89 cb                	mov    %ecx,%ebx
+  8048a4:	8b 3c 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%edi
+  8048ab:	85 ff                	test   %edi,%edi
+  8048ad:	74 2a                	je     8048d9 <malloc+0x82>
+	v = s->free;
+  8048af:	8b 47 08             	mov    0x8(%edi),%eax
+  8048b2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  8048b5:	8b 00                	mov    (%eax),%eax
+  8048b7:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  8048ba:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  8048be:	83 e8 01             	sub    $0x1,%eax
+  8048c1:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  8048c5:	66 85 c0             	test   %ax,%ax
+  8048c8:	0f 84 9a 00 00 00    	je     804968 <malloc+0x111>
+}
+  8048ce:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8048d1:	83 c4 1c             	add    $0x1c,%esp
+  8048d4:	5b                   	pop    %ebx
+  8048d5:	5e                   	pop    %esi
+  8048d6:	5f                   	pop    %edi
+  8048d7:	5d                   	pop    %ebp
+  8048d8:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  8048d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8048de:	e8 f6 fe ff ff       	call   8047d9 <heap_alloc_pages>
+  8048e3:	89 c1                	mov    %eax,%ecx
+  8048e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8048e8:	85 c0                	test   %eax,%eax
+  8048ea:	74 e2                	je     8048ce <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8048ec:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  8048f2:	89 c8                	mov    %ecx,%eax
+  8048f4:	c1 e8 11             	shr    $0x11,%eax
+  8048f7:	c1 e9 0c             	shr    $0xc,%ecx
+  8048fa:	ba 01 00 00 00       	mov    $0x1,%edx
+  8048ff:	d3 e2                	shl    %cl,%edx
+  804901:	09 14 85 80 c0 80 00 	or     %edx,0x80c080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804908:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80490b:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  80490f:	0f b7 f6             	movzwl %si,%esi
+  804912:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804917:	ba 00 00 00 00       	mov    $0x0,%edx
+  80491c:	f7 fe                	idiv   %esi
+  80491e:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804922:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  804925:	85 c0                	test   %eax,%eax
+  804927:	74 14                	je     80493d <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  804929:	83 e8 01             	sub    $0x1,%eax
+  80492c:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804930:	0f af d0             	imul   %eax,%edx
+  804933:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804937:	89 3a                	mov    %edi,(%edx)
+  804939:	89 d7                	mov    %edx,%edi
+  80493b:	eb e5                	jmp    804922 <malloc+0xcb>
+	s->prev = NULL;
+  80493d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804940:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804947:	8b 04 9d 60 c0 80 00 	mov    0x80c060(,%ebx,4),%eax
+  80494e:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804950:	85 c0                	test   %eax,%eax
+  804952:	74 03                	je     804957 <malloc+0x100>
+		slabs[c]->prev = s;
+  804954:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804957:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80495a:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+	return s;
+  804961:	89 c7                	mov    %eax,%edi
+  804963:	e9 47 ff ff ff       	jmp    8048af <malloc+0x58>
+	if (s->prev)
+  804968:	8b 47 04             	mov    0x4(%edi),%eax
+  80496b:	85 c0                	test   %eax,%eax
+  80496d:	74 19                	je     804988 <malloc+0x131>
+		s->prev->next = s->next;
+  80496f:	8b 17                	mov    (%edi),%edx
+  804971:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804973:	8b 07                	mov    (%edi),%eax
+  804975:	85 c0                	test   %eax,%eax
+  804977:	0f 84 51 ff ff ff    	je     8048ce <malloc+0x77>
+		s->next->prev = s->prev;
+  80497d:	8b 57 04             	mov    0x4(%edi),%edx
+  804980:	89 50 04             	mov    %edx,0x4(%eax)
+  804983:	e9 46 ff ff ff       	jmp    8048ce <malloc+0x77>
+		slabs[c] = s->next;
+  804988:	8b 07                	mov    (%edi),%eax
+  80498a:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+  804991:	eb e0                	jmp    804973 <malloc+0x11c>
+		return NULL;
+  804993:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80499a:	e9 2f ff ff ff       	jmp    8048ce <malloc+0x77>
+
+0080499f <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  80499f:	55                   	push   %ebp
+  8049a0:	89 e5                	mov    %esp,%ebp
+  8049a2:	57                   	push   %edi
+  8049a3:	56                   	push   %esi
+  8049a4:	53                   	push   %ebx
+  8049a5:	83 ec 0c             	sub    $0xc,%esp
+  8049a8:	89 c6                	mov    %eax,%esi
+  8049aa:	89 d7                	mov    %edx,%edi
+  8049ac:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8049af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8049b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049b9:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  8049be:	83 ef 01             	sub    $0x1,%edi
+  8049c1:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8049c4:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8049c7:	eb 34                	jmp    8049fd <va_chunk_scan+0x5e>
+			i += 31;
+  8049c9:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  8049cc:	89 ca                	mov    %ecx,%edx
+			continue;
+  8049ce:	eb 23                	jmp    8049f3 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  8049d0:	89 c7                	mov    %eax,%edi
+  8049d2:	c1 ef 05             	shr    $0x5,%edi
+  8049d5:	be 01 00 00 00       	mov    $0x1,%esi
+  8049da:	d3 e6                	shl    %cl,%esi
+  8049dc:	89 f1                	mov    %esi,%ecx
+  8049de:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8049e1:	23 0c be             	and    (%esi,%edi,4),%ecx
+  8049e4:	75 41                	jne    804a27 <va_chunk_scan+0x88>
+			len++;
+  8049e6:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  8049e9:	39 d3                	cmp    %edx,%ebx
+  8049eb:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  8049ee:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  8049f1:	72 2d                	jb     804a20 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8049f3:	83 c0 01             	add    $0x1,%eax
+  8049f6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8049fb:	77 31                	ja     804a2e <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  8049fd:	89 c1                	mov    %eax,%ecx
+  8049ff:	83 e1 1f             	and    $0x1f,%ecx
+  804a02:	75 cc                	jne    8049d0 <va_chunk_scan+0x31>
+  804a04:	89 c7                	mov    %eax,%edi
+  804a06:	c1 ef 05             	shr    $0x5,%edi
+  804a09:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804a0c:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804a0f:	83 ff ff             	cmp    $0xffffffff,%edi
+  804a12:	74 b5                	je     8049c9 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  804a14:	85 ff                	test   %edi,%edi
+  804a16:	75 b8                	jne    8049d0 <va_chunk_scan+0x31>
+			i += 31;
+  804a18:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804a1b:	83 c2 20             	add    $0x20,%edx
+  804a1e:	eb c9                	jmp    8049e9 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804a20:	83 c0 01             	add    $0x1,%eax
+  804a23:	29 d0                	sub    %edx,%eax
+  804a25:	eb 15                	jmp    804a3c <va_chunk_scan+0x9d>
+			len = 0;
+  804a27:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a2c:	eb c5                	jmp    8049f3 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804a2e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804a33:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804a36:	85 d2                	test   %edx,%edx
+  804a38:	74 02                	je     804a3c <va_chunk_scan+0x9d>
+		*run_store = best;
+  804a3a:	89 1a                	mov    %ebx,(%edx)
+}
+  804a3c:	83 c4 0c             	add    $0xc,%esp
+  804a3f:	5b                   	pop    %ebx
+  804a40:	5e                   	pop    %esi
+  804a41:	5f                   	pop    %edi
+  804a42:	5d                   	pop    %ebp
+  804a43:	c3                   	ret
+
+00804a44 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804a44:	55                   	push   %ebp
+  804a45:	89 e5                	mov    %esp,%ebp
+  804a47:	57                   	push   %edi
+  804a48:	56                   	push   %esi
+  804a49:	53                   	push   %ebx
+  804a4a:	83 ec 14             	sub    $0x14,%esp
+  804a4d:	89 c3                	mov    %eax,%ebx
+  804a4f:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804a51:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804a57:	8d ba a0 ea 80 00    	lea    0x80eaa0(%edx),%edi
+  804a5d:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804a60:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804a63:	89 d6                	mov    %edx,%esi
+  804a65:	81 c6 a0 ea 80 00    	add    $0x80eaa0,%esi
+  804a6b:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804a6d:	eb 34                	jmp    804aa3 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804a6f:	89 c8                	mov    %ecx,%eax
+  804a71:	c1 e8 05             	shr    $0x5,%eax
+  804a74:	89 da                	mov    %ebx,%edx
+  804a76:	c1 e2 05             	shl    $0x5,%edx
+  804a79:	01 da                	add    %ebx,%edx
+  804a7b:	01 c2                	add    %eax,%edx
+  804a7d:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804a82:	d3 c0                	rol    %cl,%eax
+  804a84:	21 04 95 a0 ea 80 00 	and    %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804a8b:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804a92:	b8 01 00 00 00       	mov    $0x1,%eax
+  804a97:	01 d0                	add    %edx,%eax
+  804a99:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804aa0:	83 c1 01             	add    $0x1,%ecx
+  804aa3:	39 f9                	cmp    %edi,%ecx
+  804aa5:	74 30                	je     804ad7 <va_chunk_mark+0x93>
+		if (alloc)
+  804aa7:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804aab:	74 c2                	je     804a6f <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804aad:	89 c8                	mov    %ecx,%eax
+  804aaf:	c1 e8 05             	shr    $0x5,%eax
+  804ab2:	89 da                	mov    %ebx,%edx
+  804ab4:	c1 e2 05             	shl    $0x5,%edx
+  804ab7:	01 da                	add    %ebx,%edx
+  804ab9:	01 c2                	add    %eax,%edx
+  804abb:	b8 01 00 00 00       	mov    $0x1,%eax
+  804ac0:	d3 e0                	shl    %cl,%eax
+  804ac2:	09 04 95 a0 ea 80 00 	or     %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804ac9:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804ad0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804ad5:	eb c0                	jmp    804a97 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804ad7:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804ada:	ba 00 00 00 00       	mov    $0x0,%edx
+  804adf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804ae2:	e8 b8 fe ff ff       	call   80499f <va_chunk_scan>
+	ch->run = run;
+  804ae7:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804aed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804af0:	66 89 83 22 eb 80 00 	mov    %ax,0x80eb22(%ebx)
+}
+  804af7:	83 c4 14             	add    $0x14,%esp
+  804afa:	5b                   	pop    %ebx
+  804afb:	5e                   	pop    %esi
+  804afc:	5f                   	pop    %edi
+  804afd:	5d                   	pop    %ebp
+  804afe:	c3                   	ret
+
+00804aff <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804aff:	55                   	push   %ebp
+  804b00:	89 e5                	mov    %esp,%ebp
+  804b02:	57                   	push   %edi
+  804b03:	56                   	push   %esi
+  804b04:	53                   	push   %ebx
+  804b05:	83 ec 04             	sub    $0x4,%esp
+  804b08:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804b0b:	b8 20 eb 80 00       	mov    $0x80eb20,%eax
+  804b10:	ba 90 f9 80 00       	mov    $0x80f990,%edx
+  804b15:	80 3d 80 ea 80 00 00 	cmpb   $0x0,0x80ea80
+  804b1c:	74 4f                	je     804b6d <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804b1e:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804b21:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804b26:	0f 87 01 01 00 00    	ja     804c2d <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804b2c:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804b32:	0f 87 80 00 00 00    	ja     804bb8 <va_alloc+0xb9>
+  804b38:	b8 22 eb 80 00       	mov    $0x80eb22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804b3d:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804b42:	0f b7 10             	movzwl (%eax),%edx
+  804b45:	05 84 00 00 00       	add    $0x84,%eax
+  804b4a:	39 da                	cmp    %ebx,%edx
+  804b4c:	73 2c                	jae    804b7a <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804b4e:	83 c6 01             	add    $0x1,%esi
+  804b51:	83 fe 1c             	cmp    $0x1c,%esi
+  804b54:	75 ec                	jne    804b42 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804b56:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b5b:	eb 53                	jmp    804bb0 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804b5d:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804b63:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804b68:	05 84 00 00 00       	add    $0x84,%eax
+  804b6d:	39 d0                	cmp    %edx,%eax
+  804b6f:	75 ec                	jne    804b5d <va_alloc+0x5e>
+	va_inited = 1;
+  804b71:	c6 05 80 ea 80 00 01 	movb   $0x1,0x80ea80
+}
+  804b78:	eb a4                	jmp    804b1e <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804b7a:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804b80:	05 a0 ea 80 00       	add    $0x80eaa0,%eax
+  804b85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804b8a:	89 da                	mov    %ebx,%edx
+  804b8c:	e8 0e fe ff ff       	call   80499f <va_chunk_scan>
+  804b91:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804b93:	6a 01                	push   $0x1
+  804b95:	89 d9                	mov    %ebx,%ecx
+  804b97:	89 c2                	mov    %eax,%edx
+  804b99:	89 f0                	mov    %esi,%eax
+  804b9b:	e8 a4 fe ff ff       	call   804a44 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804ba0:	c1 e6 16             	shl    $0x16,%esi
+  804ba3:	c1 e7 0c             	shl    $0xc,%edi
+  804ba6:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804bad:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804bb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804bb3:	5b                   	pop    %ebx
+  804bb4:	5e                   	pop    %esi
+  804bb5:	5f                   	pop    %edi
+  804bb6:	5d                   	pop    %ebp
+  804bb7:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804bb8:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804bbe:	c1 ee 0a             	shr    $0xa,%esi
+  804bc1:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804bc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bcb:	eb 0a                	jmp    804bd7 <va_alloc+0xd8>
+			first = c + 1;
+  804bcd:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804bcf:	83 c2 01             	add    $0x1,%edx
+  804bd2:	83 fa 1d             	cmp    $0x1d,%edx
+  804bd5:	74 4f                	je     804c26 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804bd7:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804bdd:	66 81 b9 9c ea 80 00 	cmpw   $0x400,0x80ea9c(%ecx)
+  804be4:	00 04 
+  804be6:	75 e5                	jne    804bcd <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804be8:	89 d1                	mov    %edx,%ecx
+  804bea:	29 c1                	sub    %eax,%ecx
+  804bec:	39 f1                	cmp    %esi,%ecx
+  804bee:	75 df                	jne    804bcf <va_alloc+0xd0>
+  804bf0:	89 c7                	mov    %eax,%edi
+  804bf2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804bf5:	be 00 04 00 00       	mov    $0x400,%esi
+  804bfa:	39 f3                	cmp    %esi,%ebx
+  804bfc:	0f 46 f3             	cmovbe %ebx,%esi
+  804bff:	6a 01                	push   $0x1
+  804c01:	89 f1                	mov    %esi,%ecx
+  804c03:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c08:	89 f8                	mov    %edi,%eax
+  804c0a:	e8 35 fe ff ff       	call   804a44 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804c0f:	83 c7 01             	add    $0x1,%edi
+  804c12:	83 c4 04             	add    $0x4,%esp
+  804c15:	29 f3                	sub    %esi,%ebx
+  804c17:	75 dc                	jne    804bf5 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804c19:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804c1c:	c1 e0 16             	shl    $0x16,%eax
+  804c1f:	05 00 00 00 08       	add    $0x8000000,%eax
+  804c24:	eb 8a                	jmp    804bb0 <va_alloc+0xb1>
+	return NULL;
+  804c26:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c2b:	eb 83                	jmp    804bb0 <va_alloc+0xb1>
+		return NULL;
+  804c2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c32:	e9 79 ff ff ff       	jmp    804bb0 <va_alloc+0xb1>
+
+00804c37 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804c37:	55                   	push   %ebp
+  804c38:	89 e5                	mov    %esp,%ebp
+  804c3a:	57                   	push   %edi
+  804c3b:	56                   	push   %esi
+  804c3c:	53                   	push   %ebx
+  804c3d:	83 ec 0c             	sub    $0xc,%esp
+  804c40:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804c43:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804c46:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804c4c:	76 21                	jbe    804c6f <va_free+0x38>
+  804c4e:	89 f0                	mov    %esi,%eax
+  804c50:	c1 e0 0c             	shl    $0xc,%eax
+  804c53:	01 f8                	add    %edi,%eax
+  804c55:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804c5a:	77 13                	ja     804c6f <va_free+0x38>
+	    || PGOFF(va))
+  804c5c:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804c62:	75 0b                	jne    804c6f <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804c64:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804c6a:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804c6d:	eb 45                	jmp    804cb4 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804c6f:	83 ec 0c             	sub    $0xc,%esp
+  804c72:	56                   	push   %esi
+  804c73:	57                   	push   %edi
+  804c74:	68 40 60 80 00       	push   $0x806040
+  804c79:	68 8e 00 00 00       	push   $0x8e
+  804c7e:	68 60 60 80 00       	push   $0x806060
+  804c83:	e8 a5 b5 ff ff       	call   80022d <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804c88:	89 fa                	mov    %edi,%edx
+  804c8a:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804c90:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804c95:	29 d3                	sub    %edx,%ebx
+  804c97:	39 f3                	cmp    %esi,%ebx
+  804c99:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804c9c:	89 f8                	mov    %edi,%eax
+  804c9e:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804ca1:	83 ec 0c             	sub    $0xc,%esp
+  804ca4:	6a 00                	push   $0x0
+  804ca6:	89 d9                	mov    %ebx,%ecx
+  804ca8:	e8 97 fd ff ff       	call   804a44 <va_chunk_mark>
+		i += n;
+  804cad:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804caf:	29 de                	sub    %ebx,%esi
+  804cb1:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804cb4:	85 f6                	test   %esi,%esi
+  804cb6:	75 d0                	jne    804c88 <va_free+0x51>
+	}
+}
+  804cb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804cbb:	5b                   	pop    %ebx
+  804cbc:	5e                   	pop    %esi
+  804cbd:	5f                   	pop    %edi
+  804cbe:	5d                   	pop    %ebp
+  804cbf:	c3                   	ret
+
+00804cc0 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cc5:	c3                   	ret
+
+00804cc6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804cc6:	55                   	push   %ebp
+  804cc7:	89 e5                	mov    %esp,%ebp
+  804cc9:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804ccc:	68 6d 60 80 00       	push   $0x80606d
+  804cd1:	ff 75 0c             	push   0xc(%ebp)
+  804cd4:	e8 16 bc ff ff       	call   8008ef <strcpy>
+	return 0;
+}
+  804cd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cde:	c9                   	leave
+  804cdf:	c3                   	ret
+
+00804ce0 <devcons_write>:
+{
+  804ce0:	55                   	push   %ebp
+  804ce1:	89 e5                	mov    %esp,%ebp
+  804ce3:	57                   	push   %edi
+  804ce4:	56                   	push   %esi
+  804ce5:	53                   	push   %ebx
+  804ce6:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804cec:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804cf1:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804cf7:	eb 2e                	jmp    804d27 <devcons_write+0x47>
+		m = n - tot;
+  804cf9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804cfc:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804cfe:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804d03:	39 c3                	cmp    %eax,%ebx
+  804d05:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804d08:	83 ec 04             	sub    $0x4,%esp
+  804d0b:	53                   	push   %ebx
+  804d0c:	89 f0                	mov    %esi,%eax
+  804d0e:	03 45 0c             	add    0xc(%ebp),%eax
+  804d11:	50                   	push   %eax
+  804d12:	57                   	push   %edi
+  804d13:	e8 5d bd ff ff       	call   800a75 <memmove>
+		sys_cputs(buf, m);
+  804d18:	83 c4 08             	add    $0x8,%esp
+  804d1b:	53                   	push   %ebx
+  804d1c:	57                   	push   %edi
+  804d1d:	e8 f3 bf ff ff       	call   800d15 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804d22:	01 de                	add    %ebx,%esi
+  804d24:	83 c4 10             	add    $0x10,%esp
+  804d27:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804d2a:	72 cd                	jb     804cf9 <devcons_write+0x19>
+}
+  804d2c:	89 f0                	mov    %esi,%eax
+  804d2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804d31:	5b                   	pop    %ebx
+  804d32:	5e                   	pop    %esi
+  804d33:	5f                   	pop    %edi
+  804d34:	5d                   	pop    %ebp
+  804d35:	c3                   	ret
+
+00804d36 <devcons_read>:
+{
+  804d36:	55                   	push   %ebp
+  804d37:	89 e5                	mov    %esp,%ebp
+  804d39:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d41:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804d45:	75 07                	jne    804d4e <devcons_read+0x18>
+  804d47:	eb 1f                	jmp    804d68 <devcons_read+0x32>
+		sys_yield();
+  804d49:	e8 75 c0 ff ff       	call   800dc3 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804d4e:	e8 f1 bf ff ff       	call   800d44 <sys_cgetc>
+  804d53:	85 c0                	test   %eax,%eax
+  804d55:	74 f2                	je     804d49 <devcons_read+0x13>
+	if (c < 0)
+  804d57:	78 0f                	js     804d68 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804d59:	83 f8 04             	cmp    $0x4,%eax
+  804d5c:	74 0c                	je     804d6a <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804d5e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804d61:	88 02                	mov    %al,(%edx)
+	return 1;
+  804d63:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804d68:	c9                   	leave
+  804d69:	c3                   	ret
+		return 0;
+  804d6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d6f:	eb f7                	jmp    804d68 <devcons_read+0x32>
+
+00804d71 <cputchar>:
+{
+  804d71:	55                   	push   %ebp
+  804d72:	89 e5                	mov    %esp,%ebp
+  804d74:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804d77:	8b 45 08             	mov    0x8(%ebp),%eax
+  804d7a:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804d7d:	6a 01                	push   $0x1
+  804d7f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804d82:	50                   	push   %eax
+  804d83:	e8 8d bf ff ff       	call   800d15 <sys_cputs>
+}
+  804d88:	83 c4 10             	add    $0x10,%esp
+  804d8b:	c9                   	leave
+  804d8c:	c3                   	ret
+
+00804d8d <getchar>:
+{
+  804d8d:	55                   	push   %ebp
+  804d8e:	89 e5                	mov    %esp,%ebp
+  804d90:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804d93:	6a 01                	push   $0x1
+  804d95:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804d98:	50                   	push   %eax
+  804d99:	6a 00                	push   $0x0
+  804d9b:	e8 6b ce ff ff       	call   801c0b <read>
+	if (r < 0)
+  804da0:	83 c4 10             	add    $0x10,%esp
+  804da3:	85 c0                	test   %eax,%eax
+  804da5:	78 06                	js     804dad <getchar+0x20>
+	if (r < 1)
+  804da7:	74 06                	je     804daf <getchar+0x22>
+	return c;
+  804da9:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804dad:	c9                   	leave
+  804dae:	c3                   	ret
+		return -E_EOF;
+  804daf:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804db4:	eb f7                	jmp    804dad <getchar+0x20>
+
+00804db6 <iscons>:
+{
+  804db6:	55                   	push   %ebp
+  804db7:	89 e5                	mov    %esp,%ebp
+  804db9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804dbc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804dbf:	50                   	push   %eax
+  804dc0:	ff 75 08             	push   0x8(%ebp)
+  804dc3:	e8 e4 cb ff ff       	call   8019ac <fd_lookup>
+  804dc8:	83 c4 10             	add    $0x10,%esp
+  804dcb:	85 c0                	test   %eax,%eax
+  804dcd:	78 11                	js     804de0 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804dcf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804dd2:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  804dd8:	39 10                	cmp    %edx,(%eax)
+  804dda:	0f 94 c0             	sete   %al
+  804ddd:	0f b6 c0             	movzbl %al,%eax
+}
+  804de0:	c9                   	leave
+  804de1:	c3                   	ret
+
+00804de2 <opencons>:
+{
+  804de2:	55                   	push   %ebp
+  804de3:	89 e5                	mov    %esp,%ebp
+  804de5:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804de8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804deb:	50                   	push   %eax
+  804dec:	e8 67 cb ff ff       	call   801958 <fd_alloc>
+  804df1:	83 c4 10             	add    $0x10,%esp
+  804df4:	85 c0                	test   %eax,%eax
+  804df6:	78 3a                	js     804e32 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804df8:	83 ec 04             	sub    $0x4,%esp
+  804dfb:	68 07 04 00 00       	push   $0x407
+  804e00:	ff 75 f4             	push   -0xc(%ebp)
+  804e03:	6a 00                	push   $0x0
+  804e05:	e8 d8 bf ff ff       	call   800de2 <sys_page_alloc>
+  804e0a:	83 c4 10             	add    $0x10,%esp
+  804e0d:	85 c0                	test   %eax,%eax
+  804e0f:	78 21                	js     804e32 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804e11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804e14:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  804e1a:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804e1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804e1f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804e26:	83 ec 0c             	sub    $0xc,%esp
+  804e29:	50                   	push   %eax
+  804e2a:	e8 02 cb ff ff       	call   801931 <fd2num>
+  804e2f:	83 c4 10             	add    $0x10,%esp
+}
+  804e32:	c9                   	leave
+  804e33:	c3                   	ret
+
+00804e34 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804e34:	55                   	push   %ebp
+  804e35:	89 e5                	mov    %esp,%ebp
+  804e37:	56                   	push   %esi
+  804e38:	53                   	push   %ebx
+  804e39:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804e3c:	a1 10 f9 80 00       	mov    0x80f910,%eax
+  804e41:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804e44:	85 db                	test   %ebx,%ebx
+  804e46:	78 17                	js     804e5f <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804e48:	83 ec 0c             	sub    $0xc,%esp
+  804e4b:	56                   	push   %esi
+  804e4c:	ff 14 9d 00 10 81 00 	call   *0x811000(,%ebx,4)
+  804e53:	83 c4 10             	add    $0x10,%esp
+  804e56:	85 c0                	test   %eax,%eax
+  804e58:	75 27                	jne    804e81 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804e5a:	83 eb 01             	sub    $0x1,%ebx
+  804e5d:	eb e5                	jmp    804e44 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804e5f:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  804e64:	8b 40 48             	mov    0x48(%eax),%eax
+  804e67:	83 ec 08             	sub    $0x8,%esp
+  804e6a:	ff 76 28             	push   0x28(%esi)
+  804e6d:	ff 36                	push   (%esi)
+  804e6f:	50                   	push   %eax
+  804e70:	68 7c 60 80 00       	push   $0x80607c
+  804e75:	6a 1d                	push   $0x1d
+  804e77:	68 9f 60 80 00       	push   $0x80609f
+  804e7c:	e8 ac b3 ff ff       	call   80022d <_panic>
+}
+  804e81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804e84:	5b                   	pop    %ebx
+  804e85:	5e                   	pop    %esi
+  804e86:	5d                   	pop    %ebp
+  804e87:	c3                   	ret
+
+00804e88 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804e88:	55                   	push   %ebp
+  804e89:	89 e5                	mov    %esp,%ebp
+  804e8b:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804e8e:	83 3d 28 10 81 00 00 	cmpl   $0x0,0x811028
+  804e95:	74 0a                	je     804ea1 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804e97:	8b 45 08             	mov    0x8(%ebp),%eax
+  804e9a:	a3 28 10 81 00       	mov    %eax,0x811028
+}
+  804e9f:	c9                   	leave
+  804ea0:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804ea1:	83 ec 04             	sub    $0x4,%esp
+  804ea4:	6a 07                	push   $0x7
+  804ea6:	68 00 f0 bf ee       	push   $0xeebff000
+  804eab:	6a 00                	push   $0x0
+  804ead:	e8 30 bf ff ff       	call   800de2 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804eb2:	83 c4 08             	add    $0x8,%esp
+  804eb5:	68 28 4f 80 00       	push   $0x804f28
+  804eba:	6a 00                	push   $0x0
+  804ebc:	e8 87 c2 ff ff       	call   801148 <sys_env_set_pgfault_upcall>
+  804ec1:	83 c4 10             	add    $0x10,%esp
+  804ec4:	eb d1                	jmp    804e97 <set_pgfault_handler+0xf>
+
+00804ec6 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804ec6:	55                   	push   %ebp
+  804ec7:	89 e5                	mov    %esp,%ebp
+  804ec9:	83 ec 08             	sub    $0x8,%esp
+  804ecc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  804ecf:	8b 15 10 f9 80 00    	mov    0x80f910,%edx
+  804ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804eda:	eb 03                	jmp    804edf <add_pgfault_handler+0x19>
+  804edc:	83 c0 01             	add    $0x1,%eax
+  804edf:	39 d0                	cmp    %edx,%eax
+  804ee1:	74 0b                	je     804eee <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804ee3:	39 0c 85 00 10 81 00 	cmp    %ecx,0x811000(,%eax,4)
+  804eea:	75 f0                	jne    804edc <add_pgfault_handler+0x16>
+  804eec:	eb 24                	jmp    804f12 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  804eee:	83 fa 0a             	cmp    $0xa,%edx
+  804ef1:	74 21                	je     804f14 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  804ef3:	8d 42 01             	lea    0x1(%edx),%eax
+  804ef6:	a3 10 f9 80 00       	mov    %eax,0x80f910
+  804efb:	89 0c 95 00 10 81 00 	mov    %ecx,0x811000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  804f02:	83 ec 0c             	sub    $0xc,%esp
+  804f05:	68 34 4e 80 00       	push   $0x804e34
+  804f0a:	e8 79 ff ff ff       	call   804e88 <set_pgfault_handler>
+  804f0f:	83 c4 10             	add    $0x10,%esp
+}
+  804f12:	c9                   	leave
+  804f13:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  804f14:	83 ec 04             	sub    $0x4,%esp
+  804f17:	68 ad 60 80 00       	push   $0x8060ad
+  804f1c:	6a 44                	push   $0x44
+  804f1e:	68 9f 60 80 00       	push   $0x80609f
+  804f23:	e8 05 b3 ff ff       	call   80022d <_panic>
+
+00804f28 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804f28:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804f29:	a1 28 10 81 00       	mov    0x811028,%eax
+	call *%eax
+  804f2e:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804f30:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  804f33:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  804f37:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  804f3b:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  804f3e:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  804f40:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  804f44:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  804f47:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  804f48:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  804f4b:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  804f4c:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  804f4d:	c3                   	ret
+
+00804f4e <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  804f4e:	55                   	push   %ebp
+  804f4f:	89 e5                	mov    %esp,%ebp
+  804f51:	57                   	push   %edi
+  804f52:	56                   	push   %esi
+  804f53:	53                   	push   %ebx
+  804f54:	83 ec 14             	sub    $0x14,%esp
+  804f57:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804f5a:	8b 75 14             	mov    0x14(%ebp),%esi
+  804f5d:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804f60:	ff 75 10             	push   0x10(%ebp)
+  804f63:	ff 75 0c             	push   0xc(%ebp)
+  804f66:	e8 9a c2 ff ff       	call   801205 <sys_ipc_recv_pages>
+  804f6b:	83 c4 10             	add    $0x10,%esp
+  804f6e:	85 c0                	test   %eax,%eax
+  804f70:	78 46                	js     804fb8 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804f72:	85 ff                	test   %edi,%edi
+  804f74:	74 0d                	je     804f83 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804f76:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  804f7b:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804f81:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804f83:	85 f6                	test   %esi,%esi
+  804f85:	74 0d                	je     804f94 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804f87:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  804f8c:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804f92:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804f94:	85 db                	test   %ebx,%ebx
+  804f96:	74 0d                	je     804fa5 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804f98:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  804f9d:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804fa3:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804fa5:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  804faa:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804fb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804fb3:	5b                   	pop    %ebx
+  804fb4:	5e                   	pop    %esi
+  804fb5:	5f                   	pop    %edi
+  804fb6:	5d                   	pop    %ebp
+  804fb7:	c3                   	ret
+		if (from_env_store) {
+  804fb8:	85 ff                	test   %edi,%edi
+  804fba:	74 06                	je     804fc2 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  804fbc:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804fc2:	85 f6                	test   %esi,%esi
+  804fc4:	74 06                	je     804fcc <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804fc6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804fcc:	85 db                	test   %ebx,%ebx
+  804fce:	74 e0                	je     804fb0 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  804fd0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804fd6:	eb d8                	jmp    804fb0 <ipc_recv_pages+0x62>
+
+00804fd8 <ipc_recv>:
+{
+  804fd8:	55                   	push   %ebp
+  804fd9:	89 e5                	mov    %esp,%ebp
+  804fdb:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  804fde:	6a 00                	push   $0x0
+  804fe0:	ff 75 10             	push   0x10(%ebp)
+  804fe3:	6a 01                	push   $0x1
+  804fe5:	ff 75 0c             	push   0xc(%ebp)
+  804fe8:	ff 75 08             	push   0x8(%ebp)
+  804feb:	e8 5e ff ff ff       	call   804f4e <ipc_recv_pages>
+}
+  804ff0:	c9                   	leave
+  804ff1:	c3                   	ret
+
+00804ff2 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804ff2:	55                   	push   %ebp
+  804ff3:	89 e5                	mov    %esp,%ebp
+  804ff5:	56                   	push   %esi
+  804ff6:	53                   	push   %ebx
+  804ff7:	8b 75 08             	mov    0x8(%ebp),%esi
+  804ffa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  804ffd:	83 ec 0c             	sub    $0xc,%esp
+  805000:	ff 75 0c             	push   0xc(%ebp)
+  805003:	e8 31 c3 ff ff       	call   801339 <sys_ipc_try_recv>
+  805008:	83 c4 10             	add    $0x10,%esp
+  80500b:	85 c0                	test   %eax,%eax
+  80500d:	78 34                	js     805043 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80500f:	85 f6                	test   %esi,%esi
+  805011:	74 0d                	je     805020 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  805013:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  805018:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80501e:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  805020:	85 db                	test   %ebx,%ebx
+  805022:	74 0d                	je     805031 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  805024:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  805029:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80502f:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  805031:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  805036:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80503c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80503f:	5b                   	pop    %ebx
+  805040:	5e                   	pop    %esi
+  805041:	5d                   	pop    %ebp
+  805042:	c3                   	ret
+		if (from_env_store) {
+  805043:	85 f6                	test   %esi,%esi
+  805045:	74 06                	je     80504d <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  805047:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  80504d:	85 db                	test   %ebx,%ebx
+  80504f:	74 eb                	je     80503c <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  805051:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  805057:	eb e3                	jmp    80503c <ipc_try_recv+0x4a>
+
+00805059 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  805059:	55                   	push   %ebp
+  80505a:	89 e5                	mov    %esp,%ebp
+  80505c:	83 ec 14             	sub    $0x14,%esp
+  80505f:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805062:	85 c0                	test   %eax,%eax
+  805064:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805069:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80506c:	ff 75 18             	push   0x18(%ebp)
+  80506f:	ff 75 14             	push   0x14(%ebp)
+  805072:	50                   	push   %eax
+  805073:	ff 75 0c             	push   0xc(%ebp)
+  805076:	ff 75 08             	push   0x8(%ebp)
+  805079:	e8 4a c1 ff ff       	call   8011c8 <sys_ipc_send_pages>
+  80507e:	83 c4 20             	add    $0x20,%esp
+  805081:	85 c0                	test   %eax,%eax
+  805083:	78 02                	js     805087 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  805085:	c9                   	leave
+  805086:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  805087:	50                   	push   %eax
+  805088:	68 c8 60 80 00       	push   $0x8060c8
+  80508d:	68 80 00 00 00       	push   $0x80
+  805092:	68 f4 60 80 00       	push   $0x8060f4
+  805097:	e8 91 b1 ff ff       	call   80022d <_panic>
+
+0080509c <ipc_send>:
+{
+  80509c:	55                   	push   %ebp
+  80509d:	89 e5                	mov    %esp,%ebp
+  80509f:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  8050a2:	ff 75 14             	push   0x14(%ebp)
+  8050a5:	6a 01                	push   $0x1
+  8050a7:	ff 75 10             	push   0x10(%ebp)
+  8050aa:	ff 75 0c             	push   0xc(%ebp)
+  8050ad:	ff 75 08             	push   0x8(%ebp)
+  8050b0:	e8 a4 ff ff ff       	call   805059 <ipc_send_pages>
+}
+  8050b5:	83 c4 20             	add    $0x20,%esp
+  8050b8:	c9                   	leave
+  8050b9:	c3                   	ret
+
+008050ba <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8050ba:	55                   	push   %ebp
+  8050bb:	89 e5                	mov    %esp,%ebp
+  8050bd:	83 ec 14             	sub    $0x14,%esp
+  8050c0:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8050c3:	85 c0                	test   %eax,%eax
+  8050c5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8050ca:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8050cd:	ff 75 18             	push   0x18(%ebp)
+  8050d0:	ff 75 14             	push   0x14(%ebp)
+  8050d3:	50                   	push   %eax
+  8050d4:	ff 75 0c             	push   0xc(%ebp)
+  8050d7:	ff 75 08             	push   0x8(%ebp)
+  8050da:	e8 7a c1 ff ff       	call   801259 <sys_ipc_call>
+  8050df:	83 c4 20             	add    $0x20,%esp
+  8050e2:	85 c0                	test   %eax,%eax
+  8050e4:	78 0b                	js     8050f1 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  8050e6:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  8050eb:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8050f1:	c9                   	leave
+  8050f2:	c3                   	ret
+
+008050f3 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  8050f3:	55                   	push   %ebp
+  8050f4:	89 e5                	mov    %esp,%ebp
+  8050f6:	57                   	push   %edi
+  8050f7:	56                   	push   %esi
+  8050f8:	53                   	push   %ebx
+  8050f9:	83 ec 18             	sub    $0x18,%esp
+  8050fc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8050ff:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  805102:	8b 75 20             	mov    0x20(%ebp),%esi
+  805105:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805108:	85 c0                	test   %eax,%eax
+  80510a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80510f:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  805112:	ff 75 18             	push   0x18(%ebp)
+  805115:	ff 75 14             	push   0x14(%ebp)
+  805118:	50                   	push   %eax
+  805119:	ff 75 0c             	push   0xc(%ebp)
+  80511c:	ff 75 08             	push   0x8(%ebp)
+  80511f:	e8 76 c1 ff ff       	call   80129a <sys_ipc_reply_recv>
+  805124:	83 c4 20             	add    $0x20,%esp
+  805127:	85 c0                	test   %eax,%eax
+  805129:	78 46                	js     805171 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80512b:	85 ff                	test   %edi,%edi
+  80512d:	74 0d                	je     80513c <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  80512f:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  805134:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80513a:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80513c:	85 f6                	test   %esi,%esi
+  80513e:	74 0d                	je     80514d <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  805140:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  805145:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80514b:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80514d:	85 db                	test   %ebx,%ebx
+  80514f:	74 0d                	je     80515e <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  805151:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  805156:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80515c:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80515e:	a1 24 fd 80 00       	mov    0x80fd24,%eax
+  805163:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  805169:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80516c:	5b                   	pop    %ebx
+  80516d:	5e                   	pop    %esi
+  80516e:	5f                   	pop    %edi
+  80516f:	5d                   	pop    %ebp
+  805170:	c3                   	ret
+		if (from_env_store) {
+  805171:	85 ff                	test   %edi,%edi
+  805173:	74 06                	je     80517b <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  805175:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80517b:	85 f6                	test   %esi,%esi
+  80517d:	74 06                	je     805185 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  80517f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  805185:	85 db                	test   %ebx,%ebx
+  805187:	74 e0                	je     805169 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  805189:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80518f:	eb d8                	jmp    805169 <ipc_reply_recv+0x76>
+
+00805191 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805191:	55                   	push   %ebp
+  805192:	89 e5                	mov    %esp,%ebp
+  805194:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  805197:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80519c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80519f:	c1 e0 06             	shl    $0x6,%eax
+  8051a2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8051a7:	8b 40 50             	mov    0x50(%eax),%eax
+  8051aa:	39 c8                	cmp    %ecx,%eax
+  8051ac:	74 12                	je     8051c0 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8051ae:	83 c2 01             	add    $0x1,%edx
+  8051b1:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8051b7:	75 e3                	jne    80519c <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8051b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051be:	eb 0e                	jmp    8051ce <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8051c0:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8051c3:	c1 e0 06             	shl    $0x6,%eax
+  8051c6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8051cb:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8051ce:	5d                   	pop    %ebp
+  8051cf:	c3                   	ret
+
+008051d0 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8051d0:	55                   	push   %ebp
+  8051d1:	89 e5                	mov    %esp,%ebp
+  8051d3:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8051d6:	89 c2                	mov    %eax,%edx
+  8051d8:	c1 ea 16             	shr    $0x16,%edx
+  8051db:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8051e2:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8051e7:	f6 c1 01             	test   $0x1,%cl
+  8051ea:	74 1e                	je     80520a <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  8051ec:	c1 e8 0c             	shr    $0xc,%eax
+  8051ef:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8051f6:	a8 01                	test   $0x1,%al
+  8051f8:	74 10                	je     80520a <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8051fa:	c1 e8 0c             	shr    $0xc,%eax
+  8051fd:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  805200:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  805207:	0f b7 d2             	movzwl %dx,%edx
+}
+  80520a:	89 d0                	mov    %edx,%eax
+  80520c:	5d                   	pop    %ebp
+  80520d:	c3                   	ret
+
+0080520e <udivmod>:
+  80520e:	55                   	push   %ebp
+  80520f:	57                   	push   %edi
+  805210:	56                   	push   %esi
+  805211:	53                   	push   %ebx
+  805212:	83 ec 24             	sub    $0x24,%esp
+  805215:	89 44 24 08          	mov    %eax,0x8(%esp)
+  805219:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80521d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  805221:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  805225:	89 44 24 10          	mov    %eax,0x10(%esp)
+  805229:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80522d:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  805231:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  805236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80523b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805240:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  805247:	00 
+  805248:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80524f:	00 
+  805250:	89 fb                	mov    %edi,%ebx
+  805252:	eb 08                	jmp    80525c <udivmod+0x4e>
+  805254:	83 e9 01             	sub    $0x1,%ecx
+  805257:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80525a:	74 68                	je     8052c4 <udivmod+0xb6>
+  80525c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  805260:	01 c0                	add    %eax,%eax
+  805262:	89 c6                	mov    %eax,%esi
+  805264:	89 d7                	mov    %edx,%edi
+  805266:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80526a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80526e:	0f ad d0             	shrd   %cl,%edx,%eax
+  805271:	d3 ea                	shr    %cl,%edx
+  805273:	f6 c1 20             	test   $0x20,%cl
+  805276:	74 04                	je     80527c <udivmod+0x6e>
+  805278:	89 d0                	mov    %edx,%eax
+  80527a:	31 d2                	xor    %edx,%edx
+  80527c:	83 e0 01             	and    $0x1,%eax
+  80527f:	89 04 24             	mov    %eax,(%esp)
+  805282:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805289:	00 
+  80528a:	8b 04 24             	mov    (%esp),%eax
+  80528d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  805291:	09 f0                	or     %esi,%eax
+  805293:	09 fa                	or     %edi,%edx
+  805295:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805299:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80529d:	39 f0                	cmp    %esi,%eax
+  80529f:	89 d5                	mov    %edx,%ebp
+  8052a1:	19 fd                	sbb    %edi,%ebp
+  8052a3:	72 af                	jb     805254 <udivmod+0x46>
+  8052a5:	29 f0                	sub    %esi,%eax
+  8052a7:	19 fa                	sbb    %edi,%edx
+  8052a9:	89 cf                	mov    %ecx,%edi
+  8052ab:	c1 ef 05             	shr    $0x5,%edi
+  8052ae:	83 e7 01             	and    $0x1,%edi
+  8052b1:	89 fe                	mov    %edi,%esi
+  8052b3:	83 f6 01             	xor    $0x1,%esi
+  8052b6:	d3 e6                	shl    %cl,%esi
+  8052b8:	d3 e7                	shl    %cl,%edi
+  8052ba:	09 74 24 18          	or     %esi,0x18(%esp)
+  8052be:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8052c2:	eb 90                	jmp    805254 <udivmod+0x46>
+  8052c4:	85 db                	test   %ebx,%ebx
+  8052c6:	74 05                	je     8052cd <udivmod+0xbf>
+  8052c8:	89 03                	mov    %eax,(%ebx)
+  8052ca:	89 53 04             	mov    %edx,0x4(%ebx)
+  8052cd:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8052d1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8052d5:	83 c4 24             	add    $0x24,%esp
+  8052d8:	5b                   	pop    %ebx
+  8052d9:	5e                   	pop    %esi
+  8052da:	5f                   	pop    %edi
+  8052db:	5d                   	pop    %ebp
+  8052dc:	c3                   	ret
+
+008052dd <__udivdi3>:
+  8052dd:	83 ec 08             	sub    $0x8,%esp
+  8052e0:	6a 00                	push   $0x0
+  8052e2:	ff 74 24 1c          	push   0x1c(%esp)
+  8052e6:	ff 74 24 1c          	push   0x1c(%esp)
+  8052ea:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8052ee:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8052f2:	e8 17 ff ff ff       	call   80520e <udivmod>
+  8052f7:	83 c4 14             	add    $0x14,%esp
+  8052fa:	c3                   	ret
+
+008052fb <__umoddi3>:
+  8052fb:	83 ec 18             	sub    $0x18,%esp
+  8052fe:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805302:	50                   	push   %eax
+  805303:	ff 74 24 2c          	push   0x2c(%esp)
+  805307:	ff 74 24 2c          	push   0x2c(%esp)
+  80530b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80530f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  805313:	e8 f6 fe ff ff       	call   80520e <udivmod>
+  805318:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80531c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805320:	83 c4 24             	add    $0x24,%esp
+  805323:	c3                   	ret
+
+00805324 <__divdi3>:
+  805324:	55                   	push   %ebp
+  805325:	57                   	push   %edi
+  805326:	56                   	push   %esi
+  805327:	53                   	push   %ebx
+  805328:	83 ec 10             	sub    $0x10,%esp
+  80532b:	8b 44 24 24          	mov    0x24(%esp),%eax
+  80532f:	8b 54 24 28          	mov    0x28(%esp),%edx
+  805333:	89 c6                	mov    %eax,%esi
+  805335:	89 d7                	mov    %edx,%edi
+  805337:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  80533b:	33 7c 24 30          	xor    0x30(%esp),%edi
+  80533f:	89 74 24 04          	mov    %esi,0x4(%esp)
+  805343:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  805347:	89 c5                	mov    %eax,%ebp
+  805349:	f7 dd                	neg    %ebp
+  80534b:	89 d6                	mov    %edx,%esi
+  80534d:	83 d6 00             	adc    $0x0,%esi
+  805350:	f7 de                	neg    %esi
+  805352:	0f 48 e8             	cmovs  %eax,%ebp
+  805355:	0f 49 d6             	cmovns %esi,%edx
+  805358:	6a 00                	push   $0x0
+  80535a:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80535e:	f7 de                	neg    %esi
+  805360:	8b 44 24 34          	mov    0x34(%esp),%eax
+  805364:	83 d0 00             	adc    $0x0,%eax
+  805367:	f7 d8                	neg    %eax
+  805369:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  80536e:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  805373:	50                   	push   %eax
+  805374:	56                   	push   %esi
+  805375:	89 e8                	mov    %ebp,%eax
+  805377:	e8 92 fe ff ff       	call   80520e <udivmod>
+  80537c:	83 c4 10             	add    $0x10,%esp
+  80537f:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  805384:	78 08                	js     80538e <__divdi3+0x6a>
+  805386:	83 c4 0c             	add    $0xc,%esp
+  805389:	5b                   	pop    %ebx
+  80538a:	5e                   	pop    %esi
+  80538b:	5f                   	pop    %edi
+  80538c:	5d                   	pop    %ebp
+  80538d:	c3                   	ret
+  80538e:	f7 d8                	neg    %eax
+  805390:	83 d2 00             	adc    $0x0,%edx
+  805393:	f7 da                	neg    %edx
+  805395:	eb ef                	jmp    805386 <__divdi3+0x62>
+
+00805397 <__moddi3>:
+  805397:	55                   	push   %ebp
+  805398:	57                   	push   %edi
+  805399:	56                   	push   %esi
+  80539a:	53                   	push   %ebx
+  80539b:	83 ec 18             	sub    $0x18,%esp
+  80539e:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8053a2:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8053a6:	89 f1                	mov    %esi,%ecx
+  8053a8:	f7 d9                	neg    %ecx
+  8053aa:	89 da                	mov    %ebx,%edx
+  8053ac:	83 d2 00             	adc    $0x0,%edx
+  8053af:	f7 da                	neg    %edx
+  8053b1:	0f 48 ce             	cmovs  %esi,%ecx
+  8053b4:	0f 48 d3             	cmovs  %ebx,%edx
+  8053b7:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8053bb:	50                   	push   %eax
+  8053bc:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8053c0:	f7 de                	neg    %esi
+  8053c2:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8053c6:	83 d0 00             	adc    $0x0,%eax
+  8053c9:	f7 d8                	neg    %eax
+  8053cb:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8053d0:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8053d5:	50                   	push   %eax
+  8053d6:	56                   	push   %esi
+  8053d7:	89 c8                	mov    %ecx,%eax
+  8053d9:	e8 30 fe ff ff       	call   80520e <udivmod>
+  8053de:	83 c4 10             	add    $0x10,%esp
+  8053e1:	85 db                	test   %ebx,%ebx
+  8053e3:	78 10                	js     8053f5 <__moddi3+0x5e>
+  8053e5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8053e9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8053ed:	83 c4 14             	add    $0x14,%esp
+  8053f0:	5b                   	pop    %ebx
+  8053f1:	5e                   	pop    %esi
+  8053f2:	5f                   	pop    %edi
+  8053f3:	5d                   	pop    %ebp
+  8053f4:	c3                   	ret
+  8053f5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8053f9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8053fd:	f7 d8                	neg    %eax
+  8053ff:	83 d2 00             	adc    $0x0,%edx
+  805402:	f7 da                	neg    %edx
+  805404:	eb e7                	jmp    8053ed <__moddi3+0x56>